@@ -18,3 +18,14 @@ V = @
 # following line and set it to the full path to QEMU.
 #
 # QEMU=
+
+# Uncomment to attach the file system image as a virtio-blk disk
+# (legacy PCI) instead of the second IDE disk.
+#
+# CONFIG_VIRTIO_BLK=y
+
+# Uncomment to run the file system self-tests that create, accept and
+# collect snapshots at boot.  QEMU then runs on a throwaway copy of the
+# disk image.
+#
+# CONFIG_FS_TESTS=y
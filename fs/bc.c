@@ -13,6 +13,118 @@ diskaddr(uint32_t blockno) {
     return r;
 }
 
+/* Blocks in memory in CLOCK order, at most BC_NBLOCKS of them.
+ * The superblock and the bitmap are pinned and never enter the ring. */
+static blockno_t bc_ring[BC_NBLOCKS];
+static uint32_t bc_count, bc_hand;
+
+static bool
+bc_pinned(blockno_t blockno) {
+    return blockno < 2 || (super && blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE);
+}
+
+/* Pick the ring slot for a new block, evicting the block there.
+ * Accessed blocks get a second chance and dirty ones are queued for
+ * write-back, which also clears their accessed bit once done.  After
+ * a whole turn without a victim the queued writes are run. */
+static uint32_t
+bc_evict(void) {
+    uint32_t scanned = 0;
+
+    for (;; bc_hand = (bc_hand + 1) % bc_count) {
+        void *addr = (void *)(uintptr_t)(DISKMAP + bc_ring[bc_hand] * BLKSIZE);
+
+        if (scanned++ == bc_count) {
+            bio_run();
+            scanned = 0;
+        }
+
+        if (!is_page_present(addr)) break;
+
+        if (is_page_dirty(addr)) {
+            flush_block(addr);
+        } else if (is_page_accessed(addr)) {
+            int res = sys_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
+            if (res < 0) panic("bc_evict.sys_map_region failed: %i\n", res);
+        } else {
+            int res = sys_unmap_region(CURENVID, addr, PAGE_SIZE);
+            if (res < 0) panic("bc_evict.sys_unmap_region failed: %i\n", res);
+            break;
+        }
+    }
+
+    uint32_t slot = bc_hand;
+    bc_hand = (bc_hand + 1) % bc_count;
+    return slot;
+}
+
+/* Sequential streams of faults: the block expected to fault next and
+ * the readahead window, which doubles on every fault that continues
+ * the stream, up to BC_RA_MAX and 1/16 of the cache budget. */
+struct Bc_stream {
+    blockno_t next;
+    uint32_t window;
+};
+
+static struct Bc_stream bc_streams[BC_RA_STREAMS];
+static uint32_t bc_stream_victim;
+
+/* Number of blocks to read from 'blockno' on */
+static uint32_t
+bc_readahead(blockno_t blockno) {
+    struct Bc_stream *stream = NULL;
+
+    if (!super) return 1;
+
+    for (uint32_t i = 0; i < BC_RA_STREAMS; i++) {
+        if (bc_streams[i].window && bc_streams[i].next == blockno) stream = &bc_streams[i];
+    }
+
+    if (stream) {
+        stream->window = MIN(stream->window * 2, MIN(BC_RA_MAX, MAX(BC_NBLOCKS / 16, 1)));
+    } else {
+        stream = &bc_streams[bc_stream_victim++ % BC_RA_STREAMS];
+        stream->window = 1;
+    }
+
+    uint32_t count = 1;
+    while (count < stream->window && blockno + count < super->s_nblocks &&
+           !is_page_present((void *)(uintptr_t)(DISKMAP + (blockno + count) * BLKSIZE))) {
+        count++;
+    }
+
+    stream->next = blockno + count;
+    return count;
+}
+
+/* The blocks match the disk, clear the dirty bit left by the read */
+static void
+bc_read_done(struct Bio *bio, int res) {
+    void *addr = (void *)(uintptr_t)(DISKMAP + bio->bio_blockno * BLKSIZE);
+
+    if (res < 0) {
+        panic("bc_read_done: reading block %08x failed: %i\n", bio->bio_blockno, res);
+    }
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, bio->bio_count * PAGE_SIZE, get_prot(addr));
+    if (res < 0) {
+        panic("bc_read_done.sys_map_region failed: %i\n", res);
+    }
+}
+
+/* The blocks are on disk, clear their dirty bits */
+static void
+bc_write_done(struct Bio *bio, int res) {
+    void *addr = (void *)(uintptr_t)(DISKMAP + bio->bio_blockno * BLKSIZE);
+
+    if (res < 0) {
+        panic("bc_write_done: writing block %08x failed: %i\n", bio->bio_blockno, res);
+    }
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, bio->bio_count * PAGE_SIZE, get_prot(addr));
+    if (res < 0) {
+        panic("bc_write_done.sys_map_region failed: %i\n", res);
+    }
+}
+
 /* Fault any disk block that is read in to memory by
  * loading it from disk. */
 static bool
@@ -33,25 +145,34 @@ bc_pgfault(struct UTrapframe *utf) {
      * the disk. */
     // LAB 10: Your code here
     addr = ROUNDDOWN(addr, PAGE_SIZE);
-    int res = sys_alloc_region(CURENVID, addr, PAGE_SIZE, PROT_RW);
+
+    /* Blocks of a sequential stream are read ahead in the same command */
+    uint32_t count = bc_readahead(blockno);
+
+    int res = sys_alloc_region(CURENVID, addr, count * PAGE_SIZE, PROT_RW);
     if (res < 0) {
         panic("bc_pgfault.sys_alloc_region failed: %i\n", res);
     }
-    res = ide_read(blockno * BLKSECTS, addr, BLKSECTS);
-    if (res < 0) {
-        panic("bc_pgfault.ide_read failed: %i\n", res);
+    /* The read goes out in one sweep with the writes queued so far */
+    bio_queue(blockno, count, 0, bc_read_done);
+    bio_run();
+
+    for (blockno_t i = blockno; i < blockno + count; i++) {
+        if (bc_pinned(i)) continue;
+
+        if (bc_count < BC_NBLOCKS)
+            bc_ring[bc_count++] = i;
+        else
+            bc_ring[bc_evict()] = i;
     }
 
     return 1;
 }
 
-/* Flush the contents of the block containing VA out to disk if
- * necessary, then clear the PTE_D bit using sys_page_map.
- * If the block is not in the block cache or is not dirty, does
- * nothing.
- * Hint: Use is_page_present, is_page_dirty, and ide_write.
- * Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
- * Hint: Don't forget to round addr down. */
+/* Queue the block containing VA for write-back if necessary; the
+ * PTE_D bit is cleared using sys_map_region once it is written by
+ * the next bio_run.  If the block is not in the block cache or is
+ * not dirty, does nothing. */
 void
 flush_block(void *addr) {
     blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
@@ -66,16 +187,63 @@ flush_block(void *addr) {
     if (!is_page_present(addr) || !is_page_dirty(addr)) {
         return;
     }
-    int res = ide_write(blockno * BLKSECTS, ROUNDDOWN(addr, PAGE_SIZE), BLKSECTS);
-    if (res < 0) {
-        panic("flush_block.ide_write failed: %i\n", res);
+    bio_queue(blockno, 1, 1, bc_write_done);
+}
+
+static void
+bc_sort(blockno_t *blocks, uint32_t n) {
+    for (uint32_t gap = n / 2; gap > 0; gap /= 2) {
+        for (uint32_t i = gap; i < n; i++) {
+            blockno_t b = blocks[i];
+            uint32_t j = i;
+
+            for (; j >= gap && blocks[j - gap] > b; j -= gap) {
+                blocks[j] = blocks[j - gap];
+            }
+            blocks[j] = b;
+        }
     }
-    res = sys_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
-    if (res < 0) {
-        panic("flush_block.sys_map_region failed: %i\n", res);
+}
+
+/* Whether any block in memory is dirty */
+bool
+bc_dirty(void) {
+    for (blockno_t i = 1; bc_pinned(i) && (!super || i < super->s_nblocks); i++) {
+        void *addr = (void *)(uintptr_t)(DISKMAP + i * BLKSIZE);
+        if (is_page_present(addr) && is_page_dirty(addr)) return 1;
+    }
+    for (uint32_t i = 0; i < bc_count; i++) {
+        void *addr = (void *)(uintptr_t)(DISKMAP + bc_ring[i] * BLKSIZE);
+        if (is_page_present(addr) && is_page_dirty(addr)) return 1;
+    }
+    return 0;
+}
+
+/* Write back every dirty block.  Only blocks in memory are looked at:
+ * the pinned ones and those in the CLOCK ring.  They are queued in
+ * disk order, so even a sync larger than the bio queue sweeps the
+ * disk once. */
+void
+bc_sync(void) {
+    static blockno_t dirty[BC_NBLOCKS + 2 + MAXBITBLOCKS];
+    uint32_t n = 0;
+
+    for (blockno_t i = 1; bc_pinned(i) && (!super || i < super->s_nblocks); i++) {
+        void *addr = (void *)(uintptr_t)(DISKMAP + i * BLKSIZE);
+        if (is_page_present(addr) && is_page_dirty(addr)) dirty[n++] = i;
+    }
+    for (uint32_t i = 0; i < bc_count; i++) {
+        void *addr = (void *)(uintptr_t)(DISKMAP + bc_ring[i] * BLKSIZE);
+        if (is_page_present(addr) && is_page_dirty(addr)) dirty[n++] = bc_ring[i];
+    }
+
+    bc_sort(dirty, n);
+
+    for (uint32_t i = 0; i < n; i++) {
+        flush_block((void *)(uintptr_t)(DISKMAP + dirty[i] * BLKSIZE));
     }
 
-    assert(!is_page_dirty(addr));
+    bio_run();
 }
 
 /* Test that the block cache works, by smashing the superblock and
@@ -90,6 +258,7 @@ check_bc(void) {
     /* Smash it */
     strcpy(diskaddr(1), "OOPS!\n");
     flush_block(diskaddr(1));
+    bio_run();
     assert(is_page_present(diskaddr(1)));
     assert(!is_page_dirty(diskaddr(1)));
 
@@ -103,6 +272,7 @@ check_bc(void) {
     /* Fix it */
     memmove(diskaddr(1), &backup, sizeof backup);
     flush_block(diskaddr(1));
+    bio_run();
 
     cprintf("block cache is good\n");
 }
@@ -0,0 +1,155 @@
+/*
+ * Asynchronous block I/O queue of the file system server.
+ * Requests are queued by bio_queue and reach the disk at the next
+ * bio_run, sorted into one elevator sweep from where the disk was
+ * left.  Adjacent requests in the same direction go out as one
+ * command, and as many commands are kept in flight as the disk
+ * queue takes.  Each request's callback runs when its command is done.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+static struct Bio bio_pending[BIO_QUEUE_SIZE];
+static uint32_t bio_npending;
+
+/* Block following the last command: the elevator position */
+static blockno_t bio_head;
+
+/* A merged run of queued requests sent as one disk command */
+struct Bio_cmd {
+    int tag;
+    uint32_t first, nbios;
+};
+
+/* Per direction (read, write): requests completed, commands and
+ * blocks they took, and queue to completion latency in TSC cycles */
+static struct {
+    uint64_t requests, commands, blocks;
+    uint64_t cycles, max_cycles;
+} bio_stats[2];
+
+void
+bio_queue(blockno_t blockno, uint32_t count, bool write, void (*done)(struct Bio *bio, int res)) {
+    assert(count && count <= BIO_MAX_BLOCKS);
+
+    for (uint32_t i = 0; i < bio_npending; i++) {
+        struct Bio *bio = &bio_pending[i];
+        if (bio->bio_blockno == blockno && bio->bio_count == count && bio->bio_write == write) return;
+    }
+
+    if (bio_npending == BIO_QUEUE_SIZE) bio_run();
+
+    bio_pending[bio_npending++] = (struct Bio){
+            .bio_blockno = blockno,
+            .bio_count = count,
+            .bio_write = write,
+            .bio_done = done,
+            .bio_queued = read_tsc(),
+    };
+}
+
+/* Blocks at or past the elevator position come first, in order,
+ * then the sweep starts over from the lowest ones */
+static bool
+bio_before(struct Bio *a, struct Bio *b) {
+    bool wrap_a = a->bio_blockno < bio_head, wrap_b = b->bio_blockno < bio_head;
+    return wrap_a != wrap_b ? !wrap_a : a->bio_blockno < b->bio_blockno;
+}
+
+static void
+bio_sort(void) {
+    for (uint32_t gap = bio_npending / 2; gap > 0; gap /= 2) {
+        for (uint32_t i = gap; i < bio_npending; i++) {
+            struct Bio bio = bio_pending[i];
+            uint32_t j = i;
+
+            for (; j >= gap && bio_before(&bio, &bio_pending[j - gap]); j -= gap) {
+                bio_pending[j] = bio_pending[j - gap];
+            }
+            bio_pending[j] = bio;
+        }
+    }
+}
+
+static void
+bio_complete(struct Bio_cmd *cmd) {
+    int res = cmd->tag < 0 ? cmd->tag : disk_wait(cmd->tag);
+    uint64_t now = read_tsc();
+    bool write = bio_pending[cmd->first].bio_write;
+
+    bio_stats[write].commands++;
+    for (uint32_t i = cmd->first; i < cmd->first + cmd->nbios; i++) {
+        struct Bio *bio = &bio_pending[i];
+
+        bio_stats[write].requests++;
+        bio_stats[write].blocks += bio->bio_count;
+        bio_stats[write].cycles += now - bio->bio_queued;
+        bio_stats[write].max_cycles = MAX(bio_stats[write].max_cycles, now - bio->bio_queued);
+
+        if (bio->bio_done) bio->bio_done(bio, res);
+    }
+}
+
+/* Send every queued request to the disk and wait for all of them.
+ * Callbacks must not queue new requests. */
+void
+bio_run(void) {
+    static struct Bio_cmd cmds[BIO_QUEUE_SIZE];
+    uint32_t ncmds = 0, ndone = 0, n = 0;
+
+    /* A block that left memory since its write was queued
+     * has nothing left to write */
+    for (uint32_t i = 0; i < bio_npending; i++) {
+        struct Bio *bio = &bio_pending[i];
+        if (!bio->bio_write || is_page_present((void *)(uintptr_t)(DISKMAP + bio->bio_blockno * BLKSIZE)))
+            bio_pending[n++] = *bio;
+    }
+    bio_npending = n;
+
+    bio_sort();
+
+    for (uint32_t i = 0; i < bio_npending;) {
+        struct Bio *first = &bio_pending[i];
+        uint32_t count = first->bio_count, nbios = 1;
+
+        while (i + nbios < bio_npending) {
+            struct Bio *next = &bio_pending[i + nbios];
+            if (next->bio_write != first->bio_write || next->bio_blockno != first->bio_blockno + count ||
+                count + next->bio_count > BIO_MAX_BLOCKS) break;
+            count += next->bio_count;
+            nbios++;
+        }
+
+        struct Bio_cmd *cmd = &cmds[ncmds++];
+        void *addr = (void *)(uintptr_t)(DISKMAP + first->bio_blockno * BLKSIZE);
+
+        cmd->first = i;
+        cmd->nbios = nbios;
+        while ((cmd->tag = disk_submit(first->bio_blockno * BLKSECTS, addr, count * BLKSECTS, first->bio_write)) == -E_NO_MEM) {
+            bio_complete(&cmds[ndone++]);
+        }
+
+        bio_head = first->bio_blockno + count;
+        i += nbios;
+    }
+
+    while (ndone < ncmds) bio_complete(&cmds[ndone++]);
+
+    bio_npending = 0;
+}
+
+void
+bio_print_stats(void) {
+    static const char *dir[] = {"read", "write"};
+
+    for (int w = 0; w < 2; w++) {
+        if (!bio_stats[w].requests) continue;
+
+        cprintf("bio %s: %lu requests in %lu commands, %lu blocks, latency avg %lu max %lu cycles\n",
+                dir[w], (unsigned long)bio_stats[w].requests, (unsigned long)bio_stats[w].commands,
+                (unsigned long)bio_stats[w].blocks,
+                (unsigned long)(bio_stats[w].cycles / bio_stats[w].requests),
+                (unsigned long)bio_stats[w].max_cycles);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Block device selection.  The buffer cache reads and writes through
+ * the backend found here: a virtio-blk disk if there is one, else IDE.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+static struct Blockdev *disk;
+
+/* PCI configuration space of bus 0, for the drivers to find their
+ * controllers.  'tag' is the device and function number << 8. */
+uint32_t
+pci_conf_read(uint32_t tag, uint32_t off) {
+    outl(0xCF8, 0x80000000 | tag | off);
+    return inl(0xCFC);
+}
+
+void
+pci_conf_write(uint32_t tag, uint32_t off, uint32_t val) {
+    outl(0xCF8, 0x80000000 | tag | off);
+    outl(0xCFC, val);
+}
+
+void
+disk_init(void) {
+    if (virtio_blk_init()) {
+        disk = &virtio_blockdev;
+    } else {
+        /* Find a JOS disk.  Use the second IDE disk (number 1) if available */
+        if (ide_probe_disk1())
+            ide_set_disk(1);
+        else
+            ide_set_disk(0);
+        ide_init();
+        disk = &ide_blockdev;
+    }
+
+    cprintf("FS is running on %s disk\n", disk->bd_name);
+}
+
+int
+disk_read(uint32_t secno, void *dst, size_t nsecs) {
+    return disk->bd_read(secno, dst, nsecs);
+}
+
+int
+disk_write(uint32_t secno, const void *src, size_t nsecs) {
+    return disk->bd_write(secno, src, nsecs);
+}
+
+/* Start a transfer and return the tag to pass to disk_wait.
+ * Returns -E_NO_MEM when the device queue is full: wait for
+ * an earlier tag and try again. */
+int
+disk_submit(uint32_t secno, void *buf, size_t nsecs, bool write) {
+    if (disk->bd_submit) return disk->bd_submit(secno, buf, nsecs, write);
+
+    /* Synchronous backends are done by now and report errors here */
+    int res = write ? disk_write(secno, buf, nsecs) : disk_read(secno, buf, nsecs);
+    return res < 0 ? res : 0;
+}
+
+int
+disk_wait(int tag) {
+    if (disk->bd_wait) return disk->bd_wait(tag);
+
+    return 0;
+}
@@ -11,13 +11,18 @@ uint32_t *bitmap;
 
 /********************************************************** snapshot region *****************/
 
-uint64_t *root_snapshot_file = 0;
-uint64_t *snapshot_file_dir = 0;
-uint64_t *snapshot_config_file = 0;
-uint64_t *current_snapshot_file = 0;
+/* References to the snapshot service files, kept in the superblock page */
+fileref_t *root_snapshot_file = 0;
+fileref_t *snapshot_file_dir = 0;
+fileref_t *snapshot_config_file = 0;
+fileref_t *current_snapshot_file = 0;
 
 bool SNAPSHOT_DEBUG = false;
 
+/* Snapshot copies share block pointers with their source and only the
+ * blocks actually written get a private copy (see create_and_share). */
+bool SNAPSHOT_COW = true;
+
 #define printf_debug(M, ...) if (SNAPSHOT_DEBUG) cprintf("[%s:%d] Note: " M "\n",__FILE__, __LINE__,##__VA_ARGS__);
 
 #define snapshot_name(variable,name) \
@@ -26,17 +31,14 @@ bool SNAPSHOT_DEBUG = false;
     strcat(variable, SNAPDIR);       \
     strcat(variable, name);          \
 
-#define snapshoted_file_name(variable,file_name,snapshot_name)  \
-    char variable[MAXNAMELEN];                                  \
-    variable[0] = '\0';                                         \
-    strcat(variable, SNAPDIR);                                  \
-    strcat(variable, file_name);                                 \
-    strcat(variable, SNAPFILESEP);                               \
-    strcat(variable, snapshot_name);                             \
-
-#define to_file(ptr) ((struct File *)(*ptr))
+// Имя копии уникально для оригинала: к имени файла добавляется
+// ссылка на него, иначе копии одноимённых файлов совпадут
+#define snapshoted_file_name(variable,file_name,file_ref,snapshot_name)  \
+    char variable[MAXPATHLEN];                                           \
+    snprintf(variable, MAXPATHLEN, SNAPDIR "%s" SNAPIDSEP "%x-%x" SNAPFILESEP "%s", \
+             file_name, FILEREF_BLOCK(file_ref), FILEREF_SLOT(file_ref), snapshot_name);
 
-#define PTROFFSET 1
+#define to_file(ptr) sh_ref_file(*(ptr))
 
 //Функция, выводящая актуальное состояние bitmap
 // 0 если занят
@@ -73,8 +75,38 @@ internal_print_deleted_snapshot_modified_file_list(struct File *snapshot_file);
 static bool
 internal_print_previous(struct File *snapshot_file);
 
+static void
+internal_print_entries(struct File *snapshot_file, struct Snapshot_header *header, uint32_t type);
+
+static int
+sh_index_init(struct File *snapshot_file);
+
+static int
+sh_entry_read(struct File *snapshot_file, uint32_t n, struct Snapshot_entry *entry);
+
 static int
-strcmp_snapshoted(char *snapshoted_file_name, char *file_name);
+sh_entry_add(struct File *snapshot_file, struct Snapshot_header *header, struct Snapshot_entry *entry);
+
+static int
+sh_entry_free(struct File *snapshot_file, struct Snapshot_header *header, uint32_t n);
+
+static void
+resolve_cache_invalidate(void);
+
+static struct File *
+sh_ref_file(fileref_t ref);
+
+static fileref_t
+sh_file_ref(struct File *file);
+
+static uint32_t
+sh_name_hash(const char *name);
+
+static uint32_t
+sh_ref_hash(fileref_t ref);
+
+static void
+sh_tree_load(void);
 /********************************************************** snapshot endregion *************/
 
 /****************************************************************
@@ -93,6 +125,32 @@ check_super(void) {
     cprintf("superblock is good\n");
 }
 
+/* Convert a snapshot file slot of an image older than FS_VERSION_SUPER,
+ * which held a pointer into the block cache */
+static fileref_t
+super_legacy_ref(fileref_t slot) {
+    if (slot < DISKMAP + BLKSIZE || slot >= DISKMAP + DISKSIZE)
+        return 0;
+    return sh_file_ref((struct File *)slot);
+}
+
+/* Bring the fields following s_root up to FS_VERSION_SUPER.
+ * Older images only kept the snapshot pointers there, so the reference
+ * count table and the free block counter are rebuilt from scratch. */
+static void
+upgrade_super(void) {
+    if (super->s_version >= FS_VERSION_SUPER) return;
+
+    super->s_root_snapshot = super_legacy_ref(super->s_root_snapshot);
+    super->s_snapshot_dir = super_legacy_ref(super->s_snapshot_dir);
+    super->s_snapshot_config = super_legacy_ref(super->s_snapshot_config);
+    super->s_current_snapshot = super_legacy_ref(super->s_current_snapshot);
+    super->s_refmap = 0;
+    super->s_nfree = 0;
+    super->s_version = FS_VERSION_SUPER;
+    flush_block(super);
+}
+
 /****************************************************************
  *                         Free block bitmap
  ****************************************************************/
@@ -106,22 +164,124 @@ block_is_free(uint32_t blockno) {
     return 0;
 }
 
-/* Mark a block free in the bitmap */
+static void refcount_add(blockno_t blockno, int delta);
+
+/* Number of free blocks described by every bitmap block, so that the
+ * allocator skips full parts of the disk without looking at them */
+static uint32_t bitmap_free[MAXBITBLOCKS];
+
+/* Next-fit cursor: the search starts where the last one stopped */
+static blockno_t alloc_cursor = 1;
+
+/* Drop a reference to a block, marking it free in the bitmap
+ * when it was the last one */
 void
 free_block(uint32_t blockno) {
     /* Blockno zero is the null pointer of block numbers. */
     if (blockno == 0) panic("attempt to free zero block");
+    if (block_refs(blockno) > 1) {
+        refcount_add(blockno, -1);
+        return;
+    }
+    if (!block_is_free(blockno)) {
+        super->s_nfree++;
+        bitmap_free[blockno / BLKBITSIZE]++;
+    }
     SETBIT(bitmap, blockno);
 }
 
-/* Search the bitmap for a free block and allocate it.  When you
- * allocate a block, immediately flush the changed bitmap block
- * to disk.
+/* Find the first free block in [from, to), 0 if there is none.
+ * The bitmap is scanned a 64-bit word at a time. */
+static blockno_t
+alloc_scan(blockno_t from, blockno_t to) {
+    uint64_t *words = (uint64_t *)bitmap;
+
+    for (blockno_t blockno = from; blockno < to;) {
+        if (!bitmap_free[blockno / BLKBITSIZE]) {
+            blockno = ROUNDDOWN(blockno, BLKBITSIZE) + BLKBITSIZE;
+            continue;
+        }
+
+        uint64_t word = words[blockno / 64] & (~0ULL << (blockno % 64));
+        if (word) {
+            blockno = ROUNDDOWN(blockno, 64) + __builtin_ctzll(word);
+            return blockno < to ? blockno : 0;
+        }
+        blockno = ROUNDDOWN(blockno, 64) + 64;
+    }
+
+    return 0;
+}
+
+/* Number of free blocks in a row starting from the free block
+ * 'blockno', at most max */
+static uint32_t
+free_run(blockno_t blockno, uint32_t max) {
+    uint64_t *words = (uint64_t *)bitmap;
+    uint32_t run = 0;
+
+    max = MIN(max, super->s_nblocks - blockno);
+
+    while (run < max) {
+        blockno_t next = blockno + run;
+        uint64_t used = ~words[next / 64] >> (next % 64);
+
+        if (used) {
+            run += __builtin_ctzll(used);
+            break;
+        }
+        run += 64 - next % 64;
+    }
+
+    return MIN(run, max);
+}
+
+/* Allocate from min to max contiguous blocks, starting the search from
+ * the goal block 'hint' (0 for no preference).  The changed bitmap
+ * blocks are only marked dirty, they are written by flush_bitmap at
+ * the end of the request.
  *
- * Return block number allocated on success,
- * 0 if we are out of blocks.
+ * Return the first block of the extent and set *pcount to its length,
+ * 0 if there is no run of min free blocks. */
+blockno_t
+alloc_extent(blockno_t hint, uint32_t min, uint32_t max, uint32_t *pcount) {
+    if (!min || min > max || super->s_nfree < min) return 0;
+
+    if (!hint || hint >= super->s_nblocks) hint = alloc_cursor;
+    if (hint >= super->s_nblocks) hint = 1;
+
+    /* Search [hint, nblocks) first, then wrap around to [1, hint) */
+    blockno_t from = hint, to = super->s_nblocks;
+
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t run;
+
+        for (blockno_t blockno = alloc_scan(from, to); blockno; blockno = alloc_scan(blockno + run + 1, to)) {
+            run = free_run(blockno, max);
+            if (run < min) continue;
+
+            for (blockno_t i = blockno; i < blockno + run; i++) {
+                CLRBIT(bitmap, i);
+                bitmap_free[i / BLKBITSIZE]--;
+            }
+            super->s_nfree -= run;
+            alloc_cursor = blockno + run;
+
+            *pcount = run;
+            return blockno;
+        }
+
+        from = 1;
+        to = hint;
+    }
+
+    return 0;
+}
+
+/* Search the bitmap for a free block and allocate it.
  *
- * Hint: use free_block as an example for manipulating the bitmap. */
+ * Return block number allocated on success,
+ * 0 if we are out of blocks. */
 blockno_t
 alloc_block(void) {
     /* The bitmap consists of one or more blocks.  A single bitmap block
@@ -129,15 +289,148 @@ alloc_block(void) {
      * super->s_nblocks blocks in the disk altogether. */
 
     // LAB 10: Your code here
+    uint32_t count;
+
+    return alloc_extent(alloc_cursor, 1, 1, &count);
+}
+
+/* Write the bitmap blocks, the free block counter and the reference
+ * counts back to disk.  free_block only marks them dirty, so this has
+ * to be called after freeing blocks. */
+void
+flush_bitmap(void) {
+    refcount_flush();
+    for (blockno_t i = 0; i < CEILDIV(super->s_nblocks, BLKBITSIZE); i++) {
+        flush_block(diskaddr(2 + i));
+    }
+    flush_block(super);
+}
+
+/* Count the free blocks of every bitmap block.  Images formatted
+ * without the free block counter get it here as well. */
+static void
+count_free_blocks(void) {
+    blockno_t nfree = 0;
+
     for (blockno_t blockno = 1; blockno < super->s_nblocks; blockno++) {
-        if (block_is_free(blockno)) {
-            CLRBIT(bitmap, blockno);
-            flush_block(&bitmap[blockno / 32]);
-            return blockno;
+        if (blockno % 64 == 0 && blockno + 64 <= super->s_nblocks) {
+            uint32_t n = __builtin_popcountll(((uint64_t *)bitmap)[blockno / 64]);
+            bitmap_free[blockno / BLKBITSIZE] += n;
+            nfree += n;
+            blockno += 63;
+        } else if (block_is_free(blockno)) {
+            bitmap_free[blockno / BLKBITSIZE]++;
+            nfree++;
+        }
+    }
+
+    if (super->s_nfree != nfree) {
+        super->s_nfree = nfree;
+        flush_block(super);
+    }
+}
+
+/****************************************************************
+ *                    Block reference counts
+ ****************************************************************/
+
+/* A block may be referenced by several files: a file and its snapshot
+ * copies share the blocks nobody has written yet.  For every block the
+ * disk keeps one byte with the number of references besides the first
+ * one, so blocks with a single owner need no bookkeeping at all.  The
+ * bytes live in table blocks listed in the s_refmap block and are paged
+ * through the block cache like other metadata.  Updates go to a small
+ * in-memory delta log first and reach the table when the log fills up
+ * or on refcount_flush. */
+
+struct Refcount_delta {
+    blockno_t rd_blockno;
+    int rd_delta;
+};
+
+static struct Refcount_delta refcount_log[REFCOUNT_LOG_SIZE];
+static int refcount_log_size;
+
+static uint8_t *
+refcount_slot(blockno_t blockno) {
+    blockno_t *table = diskaddr(super->s_refmap);
+
+    return (uint8_t *)diskaddr(table[blockno / BLKSIZE]) + blockno % BLKSIZE;
+}
+
+/* Write the delta log to the reference count table */
+void
+refcount_flush(void) {
+    for (int i = 0; i < refcount_log_size; i++) {
+        uint8_t *slot = refcount_slot(refcount_log[i].rd_blockno);
+        *slot += refcount_log[i].rd_delta;
+        flush_block(slot);
+    }
+    refcount_log_size = 0;
+}
+
+static void
+refcount_add(blockno_t blockno, int delta) {
+    for (int i = 0; i < refcount_log_size; i++) {
+        if (refcount_log[i].rd_blockno == blockno) {
+            refcount_log[i].rd_delta += delta;
+            if (!refcount_log[i].rd_delta)
+                refcount_log[i] = refcount_log[--refcount_log_size];
+            return;
         }
     }
 
-    return -E_NO_DISK;
+    if (refcount_log_size == REFCOUNT_LOG_SIZE) refcount_flush();
+
+    refcount_log[refcount_log_size].rd_blockno = blockno;
+    refcount_log[refcount_log_size].rd_delta = delta;
+    refcount_log_size++;
+}
+
+/* Number of files referencing the block, 0 if it is free */
+int
+block_refs(blockno_t blockno) {
+    if (block_is_free(blockno)) return 0;
+    if (!super->s_refmap) return 1;
+
+    int refs = *refcount_slot(blockno) + 1;
+    for (int i = 0; i < refcount_log_size; i++) {
+        if (refcount_log[i].rd_blockno == blockno)
+            refs += refcount_log[i].rd_delta;
+    }
+    return refs;
+}
+
+/* Add a reference to an allocated block.
+ * Returns -E_NO_MEM if the counter is saturated, then the caller
+ * has to use a copy of the block instead. */
+int
+block_share(blockno_t blockno) {
+    if (!super->s_refmap || block_refs(blockno) > REFCOUNT_MAX) return -E_NO_MEM;
+    refcount_add(blockno, 1);
+    return 0;
+}
+
+/* Allocate the reference count table on the first mount */
+void
+refcount_init(void) {
+    if (super->s_refmap) return;
+
+    blockno_t index = alloc_block();
+    if (!index) panic("Out of memory! Reference count table cannot be created");
+    memset(diskaddr(index), 0, BLKSIZE);
+
+    blockno_t *table = diskaddr(index);
+    for (blockno_t i = 0; i < CEILDIV(super->s_nblocks, BLKSIZE); i++) {
+        if (!(table[i] = alloc_block()))
+            panic("Out of memory! Reference count table cannot be created");
+        memset(diskaddr(table[i]), 0, BLKSIZE);
+        flush_block(diskaddr(table[i]));
+    }
+    flush_block(table);
+
+    super->s_refmap = index;
+    flush_block(super);
 }
 
 /* Validate the file system bitmap.
@@ -172,7 +465,7 @@ sh_cfg_init(void) {
         .root_snapshot_name = ROOTSNAP,
         .current_snapshot_name = ROOTSNAP};
 
-    if(pure_file_write((struct File *) *snapshot_config_file, &cfg, sizeof(struct Snapshot_config), HEADERPOS) != sizeof(struct Snapshot_config)) {
+    if(pure_file_write(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS) != sizeof(struct Snapshot_config)) {
         panic("Snapshot config cannot be inited\n");
     } else {
         printf_debug("Snapshot config inited\n");
@@ -207,11 +500,15 @@ sh_root_init(void) {
 
     printf_debug("Root snapshot old bitmap block flushed\n");
     
-    if (pure_file_write((struct File *) *root_snapshot_file, &root_header, sizeof(struct Snapshot_header), HEADERPOS) != sizeof(struct Snapshot_header)) {
+    if (pure_file_write(to_file(root_snapshot_file), &root_header, sizeof(struct Snapshot_header), HEADERPOS) != sizeof(struct Snapshot_header)) {
         panic("Root snapshot cannot be inited\n");
     } else {
         printf_debug("Root snapshot inited\n");
     }
+
+    if (sh_index_init(to_file(root_snapshot_file)) != 0) {
+        panic("Root snapshot index cannot be inited\n");
+    }
 }
 
 void
@@ -220,15 +517,18 @@ sh_curr_snap_init(void) {
 
     struct Snapshot_config cfg;
 
-    if (pure_file_read((struct File *) *snapshot_config_file, &cfg, sizeof(struct Snapshot_config), HEADERPOS) != sizeof(struct Snapshot_config)) {
+    if (pure_file_read(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS) != sizeof(struct Snapshot_config)) {
         panic("Cannot read cfg for snapshot to init current snapshot\n");
     }
     
     snapshot_name(snapshot_name, cfg.current_snapshot_name);
 
-    if(file_open(snapshot_name, (struct File **) current_snapshot_file) != 0) {
+    struct File *current;
+
+    if(file_open(snapshot_name, &current) != 0) {
         panic("Cannot open current snapshot with path %s, cfg value is %s\n", snapshot_name, cfg.current_snapshot_name);
     } else {
+        *current_snapshot_file = sh_file_ref(current);
         printf_debug("Current snapshot inited\n");
     }
 }
@@ -239,19 +539,22 @@ sh_init(void) {
 
     int res;
 
-    root_snapshot_file = (uint64_t *) (super + PTROFFSET);
-    
-    snapshot_file_dir = (uint64_t *) (root_snapshot_file + PTROFFSET);
+    struct File *created;
+
+    root_snapshot_file = &super->s_root_snapshot;
 
-    snapshot_config_file =  (uint64_t *) (snapshot_file_dir + PTROFFSET);
+    snapshot_file_dir = &super->s_snapshot_dir;
 
-    current_snapshot_file = (uint64_t *) (snapshot_config_file + PTROFFSET);
+    snapshot_config_file = &super->s_snapshot_config;
+
+    current_snapshot_file = &super->s_current_snapshot;
 
     printf_debug("Pointers inited\n");
 
-    if((res = pure_file_create(SNAPDIR, (struct File **)snapshot_file_dir)) == 0) {
+    if((res = pure_file_create(SNAPDIR, &created)) == 0) {
         printf_debug("Snapshot dir created\n");
-        ((struct File *)(*snapshot_file_dir))->f_type = FTYPE_DIR;
+        *snapshot_file_dir = sh_file_ref(created);
+        created->f_type = FTYPE_DIR;
         printf_debug("Snapshot file type dir inited\n");
     } else if (res == -E_FILE_EXISTS){
         printf_debug("Snapshot dir ptr inited");
@@ -259,8 +562,9 @@ sh_init(void) {
         panic("Snapshot dir cannot be created");
     }
 
-    if ((res = pure_file_create(SNAPCFG, (struct File **)snapshot_config_file)) == 0)  {
+    if ((res = pure_file_create(SNAPCFG, &created)) == 0)  {
         printf_debug("Snapshot config created\n");
+        *snapshot_config_file = sh_file_ref(created);
         sh_cfg_init();
     } else if (res == -E_FILE_EXISTS){
         printf_debug("Snapshot config ptr inited\n");
@@ -270,8 +574,9 @@ sh_init(void) {
 
     snapshot_name(root_snap_name, ROOTSNAP);
 
-    if ((res = pure_file_create(root_snap_name, (struct File **)root_snapshot_file)) == 0) {
+    if ((res = pure_file_create(root_snap_name, &created)) == 0) {
         printf_debug("Root snapshot created\n");
+        *root_snapshot_file = sh_file_ref(created);
         sh_root_init();
     } else if (res == -E_FILE_EXISTS){
         printf_debug("Root snapshot ptr inited\n");
@@ -280,6 +585,8 @@ sh_init(void) {
     }
 
     sh_curr_snap_init();
+
+    sh_tree_load();
 }
 
 void
@@ -288,23 +595,24 @@ fs_init(void) {
 
     printf_debug("Start fs init\n");
 
-    /* Find a JOS disk.  Use the second IDE disk (number 1) if availabl */
-    if (ide_probe_disk1())
-        ide_set_disk(1);
-    else
-        ide_set_disk(0);
+    disk_init();
     bc_init();
 
     /* Set "super" to point to the super block. */
     super = diskaddr(1);
 
     check_super();
+    upgrade_super();
 
     /* Set "bitmap" to the beginning of the first bitmap block. */
     bitmap = diskaddr(2);
 
     check_bitmap();
 
+    count_free_blocks();
+
+    refcount_init();
+
     sh_init();
 
     fs_sync();
@@ -312,11 +620,35 @@ fs_init(void) {
     fs_create_tmp_snapshot();
 }
 
+/* Whether the blocks of file 'f' are mapped by extents */
+static bool
+file_has_extents(struct File *f) {
+    return super->s_version >= FS_VERSION_EXTENTS && (f->f_flags & FILE_EXTENTS);
+}
+
+/* Number of file blocks mapped by a slot 'depth' levels of
+ * indirect blocks above the data */
+static uint32_t
+indirect_span(int depth) {
+    uint32_t span = 1;
+
+    while (depth-- > 0) span *= NINDIRECT;
+    return span;
+}
+
+/* Slots of the single, double and triple indirect blocks of 'f',
+ * which follow f_direct[] */
+static blockno_t *
+file_indirect_roots(struct File *f) {
+    return (blockno_t *)f->f_direct + NDIRECT;
+}
+
 /* Find the disk block number slot for the 'filebno'th block in file 'f'.
  * Set '*ppdiskbno' to point to that slot.
  * The slot will be one of the f->f_direct[] entries,
- * or an entry in the indirect block.
- * When 'alloc' is set, this function will allocate an indirect block
+ * or an entry in an indirect block.  Blocks past the single indirect
+ * one are reached through the double and then the triple indirect block.
+ * When 'alloc' is set, this function will allocate indirect blocks
  * if necessary.
  *
  * Returns:
@@ -324,20 +656,35 @@ fs_init(void) {
  *  -E_NOT_FOUND if the function needed to allocate an indirect block, but
  *      alloc was 0.
  *  -E_NO_DISK if there's no space on the disk for an indirect block.
- *  -E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+ *  -E_INVAL if filebno is out of range (it's >= MAXFILEBLOCKS).
+ *
+ * Only files in the old format have such slots, use file_map_block
+ * and file_set_block to access blocks of any file.
  *
  * Analogy: This is like pgdir_walk for files.
  * Hint: Don't forget to clear any block you allocate. */
 int
 file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
     // LAB 10: Your code here
-    if (filebno >= NDIRECT + NINDIRECT) {
+    if (filebno >= MAXFILEBLOCKS || file_has_extents(f)) {
         return -E_INVAL;
     }
     if (filebno < NDIRECT) {
         *ppdiskbno = (uint32_t*)f->f_direct + filebno;
-    } else {
-        if (!f->f_indirect) {
+        return 0;
+    }
+
+    blockno_t *slot;
+    int depth;
+
+    filebno -= NDIRECT;
+    for (depth = 1; filebno >= indirect_span(depth); depth++) {
+        filebno -= indirect_span(depth);
+    }
+    slot = file_indirect_roots(f) + depth - 1;
+
+    for (; depth > 0; depth--) {
+        if (!*slot) {
             if (!alloc) {
                 return -E_NOT_FOUND;
             }
@@ -345,635 +692,2683 @@ file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool a
             if (!block) {
                 return -E_NO_DISK;
             }
-            f->f_indirect = block;
-            memset(diskaddr(f->f_indirect), 0, BLKSIZE);
+            memset(diskaddr(block), 0, BLKSIZE);
+            *slot = block;
         }
-        *ppdiskbno = (uint32_t *)diskaddr(f->f_indirect) + filebno - NDIRECT;
+        uint32_t span = indirect_span(depth - 1);
+        slot = (blockno_t *)diskaddr(*slot) + filebno / span;
+        filebno %= span;
     }
+    *ppdiskbno = slot;
     return 0;
 }
 
-/* Set *blk to the address in memory where the filebno'th
- * block of file 'f' would be mapped.
- *
- * Returns 0 on success, < 0 on error.  Errors are:
- *  -E_NO_DISK if a block needed to be allocated but the disk is full.
- *  -E_INVAL if filebno is out of range.
- *
- * Hint: Use file_block_walk and alloc_block. */
-int
-file_get_block(struct File *f, uint32_t filebno, char **blk) {
-    // LAB 10: Your code here
-    uint32_t *pdiskbno;
-    file_block_walk(f, filebno, &pdiskbno, 1);
-    if (!*pdiskbno) {
-        blockno_t block = alloc_block();
-        if (!block) {
-            return -E_NO_DISK;
+/* Release what 'slot', 'depth' levels of indirect blocks above the
+ * data, maps from its 'first'th file block on.  Whole subtrees past
+ * 'first' go in one pass.  Data blocks are only freed if 'free_data'
+ * is set, otherwise they are just forgotten. */
+static void
+indirect_trim(blockno_t *slot, int depth, uint32_t first, bool free_data) {
+    if (!*slot) return;
+
+    if (depth > 0) {
+        blockno_t *table = diskaddr(*slot);
+        uint32_t span = indirect_span(depth - 1);
+
+        for (uint32_t i = first / span; i < NINDIRECT; i++) {
+            indirect_trim(&table[i], depth - 1, i == first / span ? first % span : 0, free_data);
         }
-        *pdiskbno = block;
     }
-    *blk = (char *)diskaddr(*pdiskbno);
-    return 0;
+
+    if (first == 0) {
+        if (depth > 0 || free_data) free_block(*slot);
+        *slot = 0;
+    }
 }
 
-/* Try to find a file named "name" in dir.  If so, set *file to it.
- *
- * Returns 0 and sets *file on success, < 0 on error.  Errors are:
- *  -E_NOT_FOUND if the file is not found */
-static int
-dir_lookup(struct File *dir, const char *name, struct File **file) {
-    /* Search dir for name.
-     * We maintain the invariant that the size of a directory-file
-     * is always a multiple of the file system's block size. */
-    assert((dir->f_size % BLKSIZE) == 0);
-    blockno_t nblock = dir->f_size / BLKSIZE;
-    for (blockno_t i = 0; i < nblock; i++) {
-        char *blk;
-        int res = file_get_block(dir, i, &blk);
-        if (res < 0) return res;
+/* Remove the blocks of old format file 'f' from 'filebno' on */
+static void
+file_trim_indirect(struct File *f, blockno_t filebno, bool free_data) {
+    blockno_t *roots = file_indirect_roots(f);
+    blockno_t base = NDIRECT;
 
-        struct File *f = (struct File *)blk;
-        for (blockno_t j = 0; j < BLKFILES; j++)
-            if (strcmp(f[j].f_name, name) == 0) {
-                *file = &f[j];
-                return 0;
-            }
+    for (blockno_t i = filebno; i < NDIRECT; i++) {
+        indirect_trim((blockno_t *)f->f_direct + i, 0, 0, free_data);
+    }
+    for (int depth = 1; depth <= 3; depth++) {
+        uint32_t span = indirect_span(depth);
+
+        if (filebno < base + span)
+            indirect_trim(&roots[depth - 1], depth, filebno > base ? filebno - base : 0, free_data);
+        base += span;
     }
-    return -E_NOT_FOUND;
 }
 
-/* Set *file to point at a free File structure in dir.  The caller is
- * responsible for filling in the File fields. */
+/* Give 'slot' its own copy of the indirect blocks it points to.
+ * On failure the slots not copied yet are cleared, so the tree holds
+ * only blocks of its own. */
 static int
-dir_alloc_file(struct File *dir, struct File **file) {
-    char *blk;
-
-    assert((dir->f_size % BLKSIZE) == 0);
-    blockno_t nblock = dir->f_size / BLKSIZE;
-    for (blockno_t i = 0; i < nblock; i++) {
-        
-        int res = file_get_block(dir, i, &blk);
-        if (res < 0) return res;
+indirect_copy(blockno_t *slot, int depth) {
+    if (!*slot || depth == 0) return 0;
 
-        struct File *f = (struct File *)blk;
-        for (blockno_t j = 0; j < BLKFILES; j++) {
-            if (f[j].f_name[0] == '\0') {
-                *file = &f[j];
-                return 0;
-            }
+    blockno_t block = alloc_block();
+    if (!block) {
+        *slot = 0;
+        return -E_NO_DISK;
+    }
+    memmove(diskaddr(block), diskaddr(*slot), BLKSIZE);
+    *slot = block;
+
+    blockno_t *table = diskaddr(block);
+    for (uint32_t i = 0; depth > 1 && i < NINDIRECT; i++) {
+        int res = indirect_copy(&table[i], depth - 1);
+        if (res < 0) {
+            memset(&table[i + 1], 0, (NINDIRECT - i - 1) * sizeof(blockno_t));
+            return res;
         }
     }
-    dir->f_size += BLKSIZE;
-    int res = file_get_block(dir, nblock, &blk);
-    if (res < 0) return res;
-
-    *file = (struct File *)blk;
     return 0;
 }
 
-/* Skip over slashes. */
-static const char *
-skip_slash(const char *p) {
-    while (*p == '/')
-        p++;
-    return p;
-}
+/* Count the indirect blocks under 'slot', writing them if 'flush' is set */
+static uint32_t
+indirect_tables(blockno_t slot, int depth, bool flush) {
+    if (!slot || depth == 0) return 0;
 
-/* Evaluate a path name, starting at the root.
- * On success, set *pf to the file we found
- * and set *pdir to the directory the file is in.
- * If we cannot find the file but find the directory
- * it should be in, set *pdir and copy the final path
- * element into lastelem. */
-static int
-walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
-    // printf_debug("Walk_path path: %s\n", path);
+    blockno_t *table = diskaddr(slot);
+    uint32_t count = 1;
 
-    const char *p;
-    char name[MAXNAMELEN];
-    struct File *dir, *f;
-    int r;
+    for (uint32_t i = 0; depth > 1 && i < NINDIRECT; i++) {
+        count += indirect_tables(table[i], depth - 1, flush);
+    }
+    if (flush) flush_block(table);
+    return count;
+}
 
-    //if (*path != '/')
-    //    return -E_BAD_PATH;
-    path = skip_slash(path);
-    f = &super->s_root;
-    dir = 0;
-    name[0] = 0;
+/* Count the indirect blocks of old format file 'f' */
+static uint32_t
+file_indirect_tables(struct File *f, bool flush) {
+    return indirect_tables(f->f_indirect, 1, flush) +
+           indirect_tables(f->f_dindirect, 2, flush) +
+           indirect_tables(f->f_tindirect, 3, flush);
+}
 
-    if (pdir)
-        *pdir = 0;
-    *pf = 0;
+/****************************************************************
+ *                         Extent mapping
+ ****************************************************************/
 
-    while (*path != '\0') {
-        dir = f;
-        p = path;
-        while (*path != '/' && *path != '\0')
-            path++;
-        if (path - p >= MAXNAMELEN)
-            return -E_BAD_PATH;
+/* Files created on a FS_VERSION_EXTENTS file system map their blocks
+ * with extents: runs of file blocks kept in consecutive disk blocks.
+ * Up to NEXTENT_INLINE extents sorted by file block live in the File
+ * itself.  Files with more extents keep them in leaf blocks listed by
+ * the f_extmap index block, each leaf covering a range of file blocks. */
+
+/* Room for a leaf that has grown by one split extent */
+static struct File_extent extent_scratch[NEXTENT_LEAF + 2];
+
+/* Index of the first extent that ends after 'filebno' */
+static uint32_t
+extent_search(struct File_extent *ext, uint32_t count, blockno_t filebno) {
+    uint32_t lo = 0, hi = count;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (ext[mid].e_fileblk + ext[mid].e_len <= filebno)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
 
-        memmove(name, p, path - p);
-        name[path - p] = '\0';
-        path = skip_slash(path);
+static blockno_t
+extent_lookup(struct File_extent *ext, uint32_t count, blockno_t filebno) {
+    uint32_t i = extent_search(ext, count, filebno);
 
-        if (dir->f_type != FTYPE_DIR)
-            return -E_NOT_FOUND;
+    if (i < count && ext[i].e_fileblk <= filebno)
+        return ext[i].e_diskblk + (filebno - ext[i].e_fileblk);
+    return 0;
+}
 
-        if ((r = dir_lookup(dir, name, &f)) < 0) {
-            if (r == -E_NOT_FOUND && *path == '\0') {
-                if (pdir)
-                    *pdir = dir;
-                if (lastelem)
-                    strcpy(lastelem, name);
-
-                *pf = 0;
-            }
-            return r;
-        }
+/* Map 'filebno' to 'diskbno', or unmap it if 'diskbno' is 0.
+ * The array must have room for two more extents.
+ * Returns the new number of extents. */
+static uint32_t
+extent_update(struct File_extent *ext, uint32_t count, blockno_t filebno, blockno_t diskbno) {
+    uint32_t i = extent_search(ext, count, filebno);
+
+    if (i < count && ext[i].e_fileblk <= filebno) {
+        struct File_extent e = ext[i], parts[3];
+        blockno_t off = filebno - e.e_fileblk;
+        uint32_t n = 0;
+
+        if (diskbno && e.e_diskblk + off == diskbno) return count;
+
+        /* Split the extent around the changed block */
+        if (off)
+            parts[n++] = (struct File_extent){e.e_fileblk, off, e.e_diskblk};
+        if (diskbno)
+            parts[n++] = (struct File_extent){filebno, 1, diskbno};
+        if (off + 1 < e.e_len)
+            parts[n++] = (struct File_extent){filebno + 1, e.e_len - off - 1, e.e_diskblk + off + 1};
+
+        memmove(&ext[i + n], &ext[i + 1], (count - i - 1) * sizeof(*ext));
+        memmove(&ext[i], parts, n * sizeof(*ext));
+        return count - 1 + n;
     }
 
-    if (pdir)
-        *pdir = dir;
-    *pf = f;
-    return 0;
+    if (!diskbno) return count;
+
+    bool prev = i > 0 && ext[i - 1].e_fileblk + ext[i - 1].e_len == filebno &&
+                ext[i - 1].e_diskblk + ext[i - 1].e_len == diskbno;
+    bool next = i < count && ext[i].e_fileblk == filebno + 1 && ext[i].e_diskblk == diskbno + 1;
+
+    if (prev && next) {
+        ext[i - 1].e_len += 1 + ext[i].e_len;
+        memmove(&ext[i], &ext[i + 1], (count - i - 1) * sizeof(*ext));
+        count--;
+    } else if (prev) {
+        ext[i - 1].e_len++;
+    } else if (next) {
+        ext[i].e_fileblk--;
+        ext[i].e_diskblk--;
+        ext[i].e_len++;
+    } else {
+        memmove(&ext[i + 1], &ext[i], (count - i) * sizeof(*ext));
+        ext[i] = (struct File_extent){filebno, 1, diskbno};
+        count++;
+    }
+    return count;
 }
 
-/****************************************************************
- *                        File operations
- ****************************************************************/
+/* Drop the mapping of blocks from 'filebno' on.
+ * Returns the new number of extents. */
+static uint32_t
+extent_trim(struct File_extent *ext, uint32_t count, blockno_t filebno) {
+    uint32_t i = extent_search(ext, count, filebno);
 
-/* Create "path".  On success set *pf to point at the file and return 0.
- * On error return < 0. */
-int
-file_create(const char *path, struct File **pf) {
+    if (i < count && ext[i].e_fileblk < filebno) {
+        ext[i].e_len = filebno - ext[i].e_fileblk;
+        i++;
+    }
+    return i;
+}
 
-    printf_debug("Start of creating file %s\n", path);
+/* Position in the index of the leaf holding 'filebno' */
+static uint32_t
+extent_index_search(struct Extent_index *index, blockno_t filebno) {
+    uint32_t lo = 0, hi = index->ei_count;
+
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (index->ei_entries[mid].ei_fileblk <= filebno)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
 
-    struct Snapshot_header snapshot_header;
+/* Move the extents of a file with few enough of them back inline,
+ * freeing the index and the leaves */
+static void
+extent_collapse(struct File *f) {
+    blockno_t index_block = f->f_extmap;
+    struct Extent_index *index = diskaddr(index_block);
+    uint32_t count = 0;
 
-    struct File *snapshot_file = to_file(current_snapshot_file);
+    for (uint32_t i = 0; i < index->ei_count; i++) {
+        count += ((struct Extent_leaf *)diskaddr(index->ei_entries[i].ei_leaf))->el_count;
+    }
+    if (count > NEXTENT_INLINE) return;
 
-    int pure_file_create_result = pure_file_create(path, pf);
+    f->f_extmap = 0;
+    f->f_nextents = 0;
+    for (uint32_t i = 0; i < index->ei_count; i++) {
+        struct Extent_leaf *leaf = diskaddr(index->ei_entries[i].ei_leaf);
 
-    if (pure_file_create_result == 0) {
-        printf_debug("File with path %s created\n", path);
-        
-        if(pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
-            printf_debug("Cannot create file with path %s in snapshot %s because header cannot be readed\n", path, snapshot_file->f_name);
-            return -E_INVAL;
-        }
+        memmove(&f->f_extents[f->f_nextents], leaf->el_extents, leaf->el_count * sizeof(struct File_extent));
+        f->f_nextents += leaf->el_count;
+        free_block(index->ei_entries[i].ei_leaf);
+    }
+    free_block(index_block);
+}
 
-        int counter = 0;
-        while(snapshot_header.created_files[counter] != 0) {
-            ++counter;
-        }
+/* Store a changed leaf kept in extent_scratch, splitting it in two if
+ * it has grown too large */
+static int
+extent_leaf_store(struct Extent_index *index, uint32_t pos, uint32_t count) {
+    struct Extent_leaf *leaf = diskaddr(index->ei_entries[pos].ei_leaf);
 
-        snapshot_header.created_files[counter] = (uint64_t) (*pf);
-        strcpy(snapshot_header.created_files_names[counter], path);
+    if (count <= NEXTENT_LEAF) {
+        memmove(leaf->el_extents, extent_scratch, count * sizeof(struct File_extent));
+        leaf->el_count = count;
+        return 0;
+    }
 
-        if(pure_file_write(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
-            printf_debug("Cannot create file with path %s in snapshot %s because header cannot be updated\n", path, snapshot_file->f_name);
-            return -E_INVAL;
-        }
+    if (index->ei_count == NEXTENT_LEAVES) return -E_NO_DISK;
 
-        pure_file_flush(snapshot_file);
+    blockno_t right = alloc_block();
+    if (!right) return -E_NO_DISK;
 
-    } else if (pure_file_create_result == -E_FILE_EXISTS){
-        printf_debug("File with path %s alllready exist\n", path);
-    } else {
-        panic("File with path %s cannot be created: errror %d\n", path, pure_file_create_result);
-    }
+    struct Extent_leaf *rleaf = diskaddr(right);
+    uint32_t half = count / 2;
 
-    return pure_file_create_result;
+    memset(rleaf, 0, BLKSIZE);
+    rleaf->el_count = count - half;
+    memmove(rleaf->el_extents, extent_scratch + half, rleaf->el_count * sizeof(struct File_extent));
+    leaf->el_count = half;
+    memmove(leaf->el_extents, extent_scratch, half * sizeof(struct File_extent));
+
+    memmove(&index->ei_entries[pos + 2], &index->ei_entries[pos + 1],
+            (index->ei_count - pos - 1) * sizeof(index->ei_entries[0]));
+    index->ei_entries[pos + 1].ei_fileblk = rleaf->el_extents[0].e_fileblk;
+    index->ei_entries[pos + 1].ei_leaf = right;
+    index->ei_count++;
+    return 0;
 }
 
+/* Find the disk block holding the 'filebno'th block of file 'f'.
+ * Sets *pdiskbno to 0 for blocks that are not allocated.
+ * Returns 0 on success, -E_INVAL if filebno is out of range. */
 int
-pure_file_create(const char *path, struct File **pf) {
-    printf_debug("Start of real creating file %s\n", path);
-
-    char name[MAXNAMELEN];
-    int res;
-    struct File *dir, *filp;
+file_map_block(struct File *f, uint32_t filebno, blockno_t *pdiskbno) {
+    if (!file_has_extents(f)) {
+        blockno_t *slot;
+        int res = file_block_walk(f, filebno, &slot, 0);
 
-    if ((res = walk_path(path, &dir, &filp, name)) == 0) { 
-        printf_debug("Two files with same names cannot be created: %s\n", name);
-        return -E_FILE_EXISTS;
+        *pdiskbno = res < 0 ? 0 : *slot;
+        return res == -E_NOT_FOUND ? 0 : res;
     }
-    if (res != -E_NOT_FOUND || dir == 0) return res;
-    if ((res = dir_alloc_file(dir, &filp)) < 0) return res;
 
-    strcpy(filp->f_name, name);
+    if (!f->f_extmap) {
+        *pdiskbno = extent_lookup(f->f_extents, f->f_nextents, filebno);
+        return 0;
+    }
 
-    *pf = filp;
-    pure_file_flush(dir);
+    struct Extent_index *index = diskaddr(f->f_extmap);
+    struct Extent_leaf *leaf = diskaddr(index->ei_entries[extent_index_search(index, filebno)].ei_leaf);
 
+    *pdiskbno = extent_lookup(leaf->el_extents, leaf->el_count, filebno);
     return 0;
 }
 
-/* Open "path".  On success set *pf to point at the file and return 0.
- * On error return < 0. */
+/* Make the 'filebno'th block of file 'f' be the disk block 'diskbno',
+ * or a hole if 'diskbno' is 0.  The old block is not freed.
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_NO_DISK if the mapping needs a block but the disk is full.
+ *  -E_INVAL if filebno is out of range. */
 int
-file_open(const char *path, struct File **pf) {
-    return walk_path(path, 0, pf, 0);
-}
-
-/* Read count bytes from f into buf, starting from seek position
- * offset.  This meant to mimic the standard pread function.
- * Returns the number of bytes read, < 0 on error. */
+file_set_block(struct File *f, uint32_t filebno, blockno_t diskbno) {
+    uint32_t count;
+    int res;
 
-ssize_t
-file_read(struct File *f, void *buf, size_t count, off_t offset) {
-    printf_debug("Try to read from file %s...\n", f->f_name);
+    if (!file_has_extents(f)) {
+        blockno_t *slot;
 
-    struct File *tmp_file;
+        if ((res = file_block_walk(f, filebno, &slot, diskbno != 0)) < 0)
+            return res == -E_NOT_FOUND ? 0 : res;
+        *slot = diskbno;
+        return 0;
+    }
 
-    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+    if (f->f_extmap) {
+        struct Extent_index *index = diskaddr(f->f_extmap);
+        uint32_t pos = extent_index_search(index, filebno);
+        struct Extent_leaf *leaf = diskaddr(index->ei_entries[pos].ei_leaf);
 
-    tmp_file = f;
+        if (leaf->el_count + 2 <= NEXTENT_LEAF) {
+            leaf->el_count = extent_update(leaf->el_extents, leaf->el_count, filebno, diskbno);
+            return 0;
+        }
 
-    if(resolve_file_for_read(&tmp_file, tmp_snapshot_file) != 0) {
-        return -E_INVAL;
+        count = leaf->el_count;
+        memmove(extent_scratch, leaf->el_extents, count * sizeof(struct File_extent));
+        count = extent_update(extent_scratch, count, filebno, diskbno);
+        return extent_leaf_store(index, pos, count);
     }
 
-    return pure_file_read(tmp_file, buf, count, offset);
-}
-
-// ssize_t
-// file_read(struct File *f, void *buf, size_t count, off_t offset) {
-//     if (*old_current_snapshot_file != 0 && find_in_snapshot_list(f) == false && f->f_type != FTYPE_DIR) {
-//         return snapshot_file_read(f, buf, count, offset);
-//     } else {
-//         return pure_file_read(f, buf, count, offset);
-//     }
-// }
+    if (f->f_nextents + 2 <= NEXTENT_INLINE) {
+        f->f_nextents = extent_update(f->f_extents, f->f_nextents, filebno, diskbno);
+        return 0;
+    }
 
-// Чтение файлов с диска без учета снэпшотов
-ssize_t
-pure_file_read(struct File *f, void *buf, size_t count, off_t offset) {
-    int r, bn;
-    off_t pos;
-    char *blk;
+    count = f->f_nextents;
+    memmove(extent_scratch, f->f_extents, count * sizeof(struct File_extent));
+    count = extent_update(extent_scratch, count, filebno, diskbno);
 
-    if (offset >= f->f_size) {
+    if (count <= NEXTENT_INLINE) {
+        memmove(f->f_extents, extent_scratch, count * sizeof(struct File_extent));
+        f->f_nextents = count;
         return 0;
     }
 
-    count = MIN(count, f->f_size - offset);
-
-    for (pos = offset; pos < offset + count;) {
-        if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0) {
-            return r;
-        }
-        bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-        memmove(buf, blk + pos % BLKSIZE, bn);
-        pos += bn;
-        buf += bn;
+    /* Out of inline extents: move them to an index with one leaf */
+    blockno_t index_block = alloc_block();
+    if (!index_block) return -E_NO_DISK;
+    blockno_t leaf_block = alloc_block();
+    if (!leaf_block) {
+        free_block(index_block);
+        return -E_NO_DISK;
     }
 
-    return count;
+    struct Extent_index *index = diskaddr(index_block);
+    memset(index, 0, BLKSIZE);
+    memset(diskaddr(leaf_block), 0, BLKSIZE);
+    index->ei_count = 1;
+    index->ei_entries[0].ei_fileblk = 0;
+    index->ei_entries[0].ei_leaf = leaf_block;
+
+    memset(f->f_extents, 0, sizeof(f->f_extents));
+    f->f_nextents = 0;
+    f->f_extmap = index_block;
+
+    return extent_leaf_store(index, 0, count);
 }
 
-// ssize_t
-// file_read(struct File *f, void *buf, size_t count, off_t offset) {
-//     char *blk;
+/* Forget the blocks of file 'f' from 'filebno' on without freeing
+ * them, releasing the mapping blocks no longer needed. */
+static void
+file_trim_blocks(struct File *f, blockno_t filebno) {
+    if (!file_has_extents(f)) {
+        file_trim_indirect(f, filebno, 0);
+        return;
+    }
 
-//     if (offset >= f->f_size)
-//         return 0;
+    if (!f->f_extmap) {
+        f->f_nextents = extent_trim(f->f_extents, f->f_nextents, filebno);
+        return;
+    }
 
-//     count = MIN(count, f->f_size - offset);
+    struct Extent_index *index = diskaddr(f->f_extmap);
+    uint32_t pos = extent_index_search(index, filebno);
+    struct Extent_leaf *leaf = diskaddr(index->ei_entries[pos].ei_leaf);
 
-//     for (off_t pos = offset; pos < offset + count;) {
-//         int r = file_get_block(f, pos / BLKSIZE, &blk);
-//         if (r < 0) return r;
+    leaf->el_count = extent_trim(leaf->el_extents, leaf->el_count, filebno);
+    for (uint32_t i = pos + 1; i < index->ei_count; i++) {
+        free_block(index->ei_entries[i].ei_leaf);
+    }
+    index->ei_count = pos + 1;
 
-//         int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-//         memmove(buf, blk + pos % BLKSIZE, bn);
-//         pos += bn;
-//         buf += bn;
-//     }
+    extent_collapse(f);
+}
 
-//     return count;
-// }
+/* Give 'dst' its own copy of the block mapping of 'src' */
+static int
+file_copy_mapping(struct File *dst, struct File *src) {
+    dst->f_flags = src->f_flags;
+
+    if (!file_has_extents(src)) {
+        blockno_t *slots = file_indirect_roots(dst);
+
+        memmove(dst->f_direct, src->f_direct, sizeof(src->f_direct));
+        dst->f_indirect = src->f_indirect;
+        dst->f_dindirect = src->f_dindirect;
+        dst->f_tindirect = src->f_tindirect;
+
+        for (int depth = 1; depth <= 3; depth++) {
+            int res = indirect_copy(&slots[depth - 1], depth);
+            if (res < 0) {
+                /* Drop the trees not copied yet along with the copies */
+                while (depth < 3) slots[depth++] = 0;
+                file_trim_indirect(dst, 0, 0);
+                return res;
+            }
+        }
+        return 0;
+    }
 
-/* Write count bytes from buf into f, starting at seek position
- * offset.  This is meant to mimic the standard pwrite function.
- * Extends the file if necessary.
- * Returns the number of bytes written, < 0 on error. */
+    memmove(dst->f_extents, src->f_extents, sizeof(src->f_extents));
+    dst->f_nextents = src->f_nextents;
+    dst->f_extmap = 0;
 
+    if (!src->f_extmap) return 0;
 
-ssize_t
-file_write(struct File *f, const void *buf, size_t count, off_t offset) {
-    printf_debug("Try to write to file %s...\n", f->f_name);
+    struct Extent_index *src_index = diskaddr(src->f_extmap);
+    blockno_t index_block = alloc_block();
+    if (!index_block) return -E_NO_DISK;
 
-    struct File *tmp_file;
+    struct Extent_index *index = diskaddr(index_block);
+    memmove(index, src_index, BLKSIZE);
 
-    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+    for (uint32_t i = 0; i < index->ei_count; i++) {
+        blockno_t leaf = alloc_block();
+        if (!leaf) {
+            while (i-- > 0) free_block(index->ei_entries[i].ei_leaf);
+            free_block(index_block);
+            return -E_NO_DISK;
+        }
+        memmove(diskaddr(leaf), diskaddr(src_index->ei_entries[i].ei_leaf), BLKSIZE);
+        index->ei_entries[i].ei_leaf = leaf;
+    }
 
-    tmp_file = f;
+    dst->f_extmap = index_block;
+    return 0;
+}
 
-    if(resolve_file_for_write(&tmp_file, tmp_snapshot_file) != 0) {
-        return -E_INVAL;
+/* Write the blocks holding the block mapping of file 'f' */
+static void
+file_flush_mapping(struct File *f) {
+    if (!file_has_extents(f)) {
+        file_indirect_tables(f, 1);
+        return;
     }
 
-    return pure_file_write(tmp_file, buf, count, offset);
+    if (!f->f_extmap) return;
+
+    struct Extent_index *index = diskaddr(f->f_extmap);
+    for (uint32_t i = 0; i < index->ei_count; i++) {
+        flush_block(diskaddr(index->ei_entries[i].ei_leaf));
+    }
+    flush_block(index);
 }
 
-// ssize_t
-// file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+/* Number of blocks holding the block mapping of file 'f' */
+static uint32_t
+file_mapping_blocks(struct File *f) {
+    if (!file_has_extents(f)) return file_indirect_tables(f, 0);
+    if (!f->f_extmap) return 0;
 
-//     printf_debug("writing in file %s...\n",f->f_name);
+    return 1 + ((struct Extent_index *)diskaddr(f->f_extmap))->ei_count;
+}
 
-//     if (*old_current_snapshot_file != 0 && find_in_snapshot_list(f) == false) { 
-//         if (find_in_snapshot_list(f) == 0) {
-//             return snapshot_file_write(f, buf, count, offset);
-//         }
-//     }
+/* Set *blk to the address in memory where the filebno'th
+ * block of file 'f' would be mapped.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_NO_DISK if a block needed to be allocated but the disk is full.
+ *  -E_INVAL if filebno is out of range.
+ *
+ * Hint: Use file_map_block and alloc_block. */
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+    // LAB 10: Your code here
+    blockno_t diskbno;
+    int res;
 
-//     return pure_file_write(f, buf, count, offset);
-// }
+    if ((res = file_map_block(f, filebno, &diskbno)) < 0) return res;
 
-// Запись в файл без учета снапшотов
-ssize_t
-pure_file_write(struct File *f, const void *buf, size_t count, off_t offset) {
-    printf_debug("Value %s writen to file %s\n",(char *)buf, f->f_name);
+    if (!diskbno) {
+        if (!(diskbno = alloc_block())) {
+            return -E_NO_DISK;
+        }
+        if ((res = file_set_block(f, filebno, diskbno)) < 0) {
+            free_block(diskbno);
+            return res;
+        }
+    }
+    *blk = (char *)diskaddr(diskbno);
+    return 0;
+}
+
+/* Same as file_get_block, but the returned block may be modified.
+ * If the block is shared with another file (a snapshot copy and its
+ * source), 'f' gets a private copy of it first. */
+static int
+file_get_writable_block(struct File *f, uint32_t filebno, char **blk) {
+    blockno_t diskbno, block;
     int res;
 
-    /* Extend file if necessary */
-    if (offset + count > f->f_size)
-        // todo:: Chancge to pure???
-        if ((res = pure_file_set_size(f, offset + count)) < 0) return res;
+    if ((res = file_map_block(f, filebno, &diskbno)) < 0) return res;
 
-    for (off_t pos = offset; pos < offset + count;) {
-        char *blk;
-        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+    if (diskbno && block_refs(diskbno) <= 1) {
+        *blk = (char *)diskaddr(diskbno);
+        return 0;
+    }
 
-        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-        memmove(blk + pos % BLKSIZE, buf, bn);
-        pos += bn;
-        buf += bn;
+    if (!(block = alloc_block())) {
+        return -E_NO_DISK;
+    }
+    if ((res = file_set_block(f, filebno, block)) < 0) {
+        free_block(block);
+        return res;
     }
 
-    return count;
-}
+    if (diskbno) {
+        printf_debug("COW of block %u of file %s: %u -> %u\n", filebno, f->f_name, diskbno, block);
+        memmove(diskaddr(block), diskaddr(diskbno), BLKSIZE);
+        free_block(diskbno);
+    }
 
-// ssize_t
-// file_write(struct File *f, const void *buf, size_t count, off_t offset) {
-//     int res;
+    *blk = (char *)diskaddr(block);
+    return 0;
+}
 
-//     /* Extend file if necessary */
-//     if (offset + count > f->f_size)
-//         if ((res = file_set_size(f, offset + count)) < 0) return res;
+/****************************************************************
+ *                     Directory hash index
+ ****************************************************************/
 
-//     for (off_t pos = offset; pos < offset + count;) {
-//         char *blk;
-//         if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+/* Directories of DIRINDEX_MIN_BLOCKS blocks and more are indexed by
+ * name hash.  The index is built when a file is allocated in such a
+ * directory, and lookups scan directories that have none.  An entry
+ * only tells where a file may be and lookups compare the name, so
+ * files removed or renamed in place just leave stale entries behind;
+ * they are dropped when the table is rebuilt.  A renamed file must be
+ * added again with dir_index_add. */
+
+static struct Dir_entry *
+dir_index_entry(struct Dir_index *index, uint32_t i) {
+    return (struct Dir_entry *)diskaddr(index->di_blocks[i / DIRINDEX_ENTRIES]) + i % DIRINDEX_ENTRIES;
+}
 
-//         uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-//         memmove(blk + pos % BLKSIZE, buf, bn);
-//         pos += bn;
-//         buf += bn;
-//     }
+static void
+dir_index_insert(struct Dir_index *index, uint32_t hash, uint32_t place) {
+    uint32_t mask = index->di_nblocks * DIRINDEX_ENTRIES - 1;
 
-//     return count;
-// }
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+        struct Dir_entry *entry = dir_index_entry(index, i);
 
-/* Remove a block from file f.  If it's not there, just silently succeed.
- * Returns 0 on success, < 0 on error. */
-static int
-file_free_block(struct File *f, uint32_t filebno) {
-    blockno_t *ptr;
-    int res = file_block_walk(f, filebno, &ptr, 0);
-    if (res < 0) return res;
+        if (entry->de_file && entry->de_file != place) continue;
 
-    if (*ptr) {
-        free_block(*ptr);
-        *ptr = 0;
+        if (!entry->de_file) index->di_nused++;
+        entry->de_hash = hash;
+        entry->de_file = place;
+        flush_block(entry);
+        return;
     }
-    return 0;
 }
 
-/* Remove any blocks currently used by file 'f',
- * but not necessary for a file of size 'newsize'.
- * For both the old and new sizes, figure out the number of blocks required,
- * and then clear the blocks from new_nblocks to old_nblocks.
- * If the new_nblocks is no more than NDIRECT, and the indirect block has
- * been allocated (f->f_indirect != 0), then free the indirect block too.
- * (Remember to clear the f->f_indirect pointer so you'll know
- * whether it's valid!)
- * Do not change f->f_size. */
+static void
+dir_index_release(blockno_t index_block) {
+    struct Dir_index *index = diskaddr(index_block);
+
+    for (uint32_t i = 0; i < index->di_nblocks; i++) {
+        free_block(index->di_blocks[i]);
+    }
+    free_block(index_block);
+}
+
+/* Drop the index of directory 'dir' */
+static void
+dir_index_free(struct File *dir) {
+    if (!dir->f_dirindex) return;
+
+    dir_index_release(dir->f_dirindex);
+    dir->f_dirindex = 0;
+    flush_block(dir);
+}
+
+/* (Re)build the index of directory 'dir' from its entries, sized for
+ * the directory to fill at most half of it. */
+static int
+dir_index_build(struct File *dir) {
+    uint32_t nfiles = dir->f_size / BLKSIZE * BLKFILES;
+    uint32_t nblocks = 1;
+
+    while (nblocks * DIRINDEX_ENTRIES < 2 * nfiles && nblocks < DIRINDEX_NBLOCKS) {
+        nblocks *= 2;
+    }
+    if (nblocks * DIRINDEX_ENTRIES < 2 * nfiles) return -E_NO_DISK;
+
+    blockno_t index_block = alloc_block();
+    if (!index_block) return -E_NO_DISK;
+
+    struct Dir_index *index = diskaddr(index_block);
+    memset(index, 0, BLKSIZE);
+    for (; index->di_nblocks < nblocks; index->di_nblocks++) {
+        blockno_t block = alloc_block();
+        if (!block) {
+            dir_index_release(index_block);
+            return -E_NO_DISK;
+        }
+        memset(diskaddr(block), 0, BLKSIZE);
+        index->di_blocks[index->di_nblocks] = block;
+    }
+
+    for (blockno_t i = 0; i < dir->f_size / BLKSIZE; i++) {
+        char *blk;
+        int res = file_get_block(dir, i, &blk);
+        if (res < 0) {
+            dir_index_release(index_block);
+            return res;
+        }
+
+        struct File *f = (struct File *)blk;
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+            if (f[j].f_name[0] != '\0')
+                dir_index_insert(index, sh_name_hash(f[j].f_name), ((uintptr_t)&f[j] - DISKMAP) / sizeof(struct File));
+        }
+    }
+    flush_block(index);
+
+    dir_index_free(dir);
+    dir->f_dirindex = index_block;
+    flush_block(dir);
+    return 0;
+}
+
+/* Record that 'f', an entry of directory 'dir', got its name */
+static void
+dir_index_add(struct File *dir, struct File *f) {
+    if (!dir->f_dirindex) return;
+
+    struct Dir_index *index = diskaddr(dir->f_dirindex);
+
+    /* Keep the table at most 3/4 full, the directory already holds 'f' */
+    if (4 * (index->di_nused + 1) > 3 * index->di_nblocks * DIRINDEX_ENTRIES) {
+        if (dir_index_build(dir) < 0) dir_index_free(dir);
+        return;
+    }
+
+    dir_index_insert(index, sh_name_hash(f->f_name), ((uintptr_t)f - DISKMAP) / sizeof(struct File));
+    flush_block(index);
+}
+
+static int
+dir_index_lookup(struct File *dir, const char *name, struct File **file) {
+    struct Dir_index *index = diskaddr(dir->f_dirindex);
+    uint32_t hash = sh_name_hash(name);
+    uint32_t mask = index->di_nblocks * DIRINDEX_ENTRIES - 1;
+
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+        struct Dir_entry *entry = dir_index_entry(index, i);
+
+        if (!entry->de_file) return -E_NOT_FOUND;
+        if (entry->de_hash != hash) continue;
+
+        struct File *f = (struct File *)diskaddr(entry->de_file / BLKFILES) + entry->de_file % BLKFILES;
+        if (strcmp(f->f_name, name) == 0) {
+            *file = f;
+            return 0;
+        }
+    }
+}
+
+/****************************************************************
+ *                      Path lookup cache
+ ****************************************************************/
+
+/* Results of dir_lookup by (directory, name), direct mapped.  A NULL
+ * file records a name known to be missing.  Found files are checked
+ * to still carry the name, so files cleared or renamed in place need
+ * no invalidation; names that appear in a directory must be passed to
+ * dentry_cache_update to replace negative entries. */
+
+struct Dentry_cache_entry {
+    struct File *dir;
+    struct File *file;
+    uint32_t hash;
+    char name[MAXNAMELEN];
+};
+
+static struct Dentry_cache_entry dentry_cache[DENTRY_CACHE_SIZE];
+
+static struct Dentry_cache_entry *
+dentry_cache_slot(struct File *dir, uint32_t hash) {
+    return &dentry_cache[(hash ^ ((uintptr_t)dir / sizeof(struct File))) % DENTRY_CACHE_SIZE];
+}
+
+static void
+dentry_cache_invalidate(void) {
+    memset(dentry_cache, 0, sizeof(dentry_cache));
+}
+
+static void
+dentry_cache_update(struct File *dir, const char *name, struct File *file) {
+    uint32_t hash = sh_name_hash(name);
+    struct Dentry_cache_entry *entry = dentry_cache_slot(dir, hash);
+
+    entry->dir = dir;
+    entry->file = file;
+    entry->hash = hash;
+    strcpy(entry->name, name);
+}
+
+/* Returns 0 and sets *file for a cached file, -E_NOT_FOUND for a
+ * cached missing name, 1 if the cache knows nothing */
+static int
+dentry_cache_lookup(struct File *dir, const char *name, struct File **file) {
+    uint32_t hash = sh_name_hash(name);
+    struct Dentry_cache_entry *entry = dentry_cache_slot(dir, hash);
+
+    if (entry->dir != dir || entry->hash != hash || strcmp(entry->name, name) != 0)
+        return 1;
+
+    if (!entry->file) return -E_NOT_FOUND;
+    if (strcmp(entry->file->f_name, name) != 0) return 1;
+
+    *file = entry->file;
+    return 0;
+}
+
+/* Try to find a file named "name" in dir.  If so, set *file to it.
+ *
+ * Returns 0 and sets *file on success, < 0 on error.  Errors are:
+ *  -E_NOT_FOUND if the file is not found */
+static int
+dir_lookup(struct File *dir, const char *name, struct File **file) {
+    int res = dentry_cache_lookup(dir, name, file);
+    if (res <= 0) return res;
+
+    /* Search dir for name.
+     * We maintain the invariant that the size of a directory-file
+     * is always a multiple of the file system's block size. */
+    assert((dir->f_size % BLKSIZE) == 0);
+    blockno_t nblock = dir->f_size / BLKSIZE;
+
+    if (dir->f_dirindex) {
+        res = dir_index_lookup(dir, name, file);
+        if (res == 0 || res == -E_NOT_FOUND)
+            dentry_cache_update(dir, name, res == 0 ? *file : NULL);
+        return res;
+    }
+
+    for (blockno_t i = 0; i < nblock; i++) {
+        char *blk;
+        if ((res = file_get_block(dir, i, &blk)) < 0) return res;
+
+        struct File *f = (struct File *)blk;
+        for (blockno_t j = 0; j < BLKFILES; j++)
+            if (strcmp(f[j].f_name, name) == 0) {
+                *file = &f[j];
+                dentry_cache_update(dir, name, *file);
+                return 0;
+            }
+    }
+    dentry_cache_update(dir, name, NULL);
+    return -E_NOT_FOUND;
+}
+
+/* Free slot hints: for recently used directories, the slot below
+ * which every File is in use, so dir_alloc_file starts searching
+ * there.  Files are cleared in place without knowing their directory,
+ * so file_release drops all the hints. */
+
+struct Dir_slot_hint {
+    struct File *dir;
+    uint32_t slot;
+};
+
+static struct Dir_slot_hint dir_slot_hints[DIRHINT_CACHE_SIZE];
+
+static struct Dir_slot_hint *
+dir_slot_hint(struct File *dir) {
+    struct Dir_slot_hint *hint = &dir_slot_hints[((uintptr_t)dir / sizeof(struct File)) % DIRHINT_CACHE_SIZE];
+
+    if (hint->dir != dir) {
+        hint->dir = dir;
+        hint->slot = 0;
+    }
+    return hint;
+}
+
+/* Set *file to point at a free File structure in dir.  The caller is
+ * responsible for filling in the File fields. */
+static int
+dir_alloc_file(struct File *dir, struct File **file) {
+    struct Dir_slot_hint *hint = dir_slot_hint(dir);
+    char *blk;
+
+    assert((dir->f_size % BLKSIZE) == 0);
+    blockno_t nblock = dir->f_size / BLKSIZE;
+
+    /* Directories of images without an index get one on the next
+     * creation; the caller adds the new file with dir_index_add */
+    if (!dir->f_dirindex && nblock >= DIRINDEX_MIN_BLOCKS) dir_index_build(dir);
+
+    for (blockno_t i = hint->slot / BLKFILES; i < nblock; i++) {
+        
+        int res = file_get_block(dir, i, &blk);
+        if (res < 0) return res;
+
+        struct File *f = (struct File *)blk;
+        for (blockno_t j = i == hint->slot / BLKFILES ? hint->slot % BLKFILES : 0; j < BLKFILES; j++) {
+            if (f[j].f_name[0] == '\0') {
+                hint->slot = i * BLKFILES + j + 1;
+                *file = &f[j];
+                return 0;
+            }
+        }
+    }
+    dir->f_size += BLKSIZE;
+    int res = file_get_block(dir, nblock, &blk);
+    if (res < 0) return res;
+
+    memset(blk, 0, BLKSIZE);
+    hint->slot = nblock * BLKFILES + 1;
+    *file = (struct File *)blk;
+
+    if (!dir->f_dirindex && nblock + 1 >= DIRINDEX_MIN_BLOCKS) dir_index_build(dir);
+    return 0;
+}
+
+/* Skip over slashes. */
+static const char *
+skip_slash(const char *p) {
+    while (*p == '/')
+        p++;
+    return p;
+}
+
+/* Evaluate a path name, starting at the root.
+ * On success, set *pf to the file we found
+ * and set *pdir to the directory the file is in.
+ * If we cannot find the file but find the directory
+ * it should be in, set *pdir and copy the final path
+ * element into lastelem. */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+    // printf_debug("Walk_path path: %s\n", path);
+
+    const char *p;
+    char name[MAXNAMELEN];
+    struct File *dir, *f;
+    int r;
+
+    //if (*path != '/')
+    //    return -E_BAD_PATH;
+    path = skip_slash(path);
+    f = &super->s_root;
+    dir = 0;
+    name[0] = 0;
+
+    if (pdir)
+        *pdir = 0;
+    *pf = 0;
+
+    while (*path != '\0') {
+        dir = f;
+        p = path;
+        while (*path != '/' && *path != '\0')
+            path++;
+        if (path - p >= MAXNAMELEN)
+            return -E_BAD_PATH;
+
+        memmove(name, p, path - p);
+        name[path - p] = '\0';
+        path = skip_slash(path);
+
+        if (dir->f_type != FTYPE_DIR)
+            return -E_NOT_FOUND;
+
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+            if (r == -E_NOT_FOUND && *path == '\0') {
+                if (pdir)
+                    *pdir = dir;
+                if (lastelem)
+                    strcpy(lastelem, name);
+
+                *pf = 0;
+            }
+            return r;
+        }
+    }
+
+    if (pdir)
+        *pdir = dir;
+    *pf = f;
+    return 0;
+}
+
+/****************************************************************
+ *                        File operations
+ ****************************************************************/
+
+/* Create "path" of type 'type' and record it in the current snapshot */
+static int
+file_create_type(const char *path, uint32_t type, struct File **pf) {
+
+    printf_debug("Start of creating file %s\n", path);
+
+    struct Snapshot_header snapshot_header;
+
+    struct File *snapshot_file = to_file(current_snapshot_file);
+
+    int pure_file_create_result = pure_file_create(path, pf);
+
+    if (pure_file_create_result == 0) {
+        printf_debug("File with path %s created\n", path);
+
+        (*pf)->f_type = type;
+        flush_block(*pf);
+
+        if(pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+            printf_debug("Cannot create file with path %s in snapshot %s because header cannot be readed\n", path, snapshot_file->f_name);
+            return -E_INVAL;
+        }
+
+        struct Snapshot_entry created_entry = {
+            .se_type = SH_ENTRY_CREATED,
+            .se_file = sh_file_ref(*pf),
+            .se_ftype = type};
+        strncpy(created_entry.se_name, path, MAXNAMELEN - 1);
+
+        if (sh_entry_add(snapshot_file, &snapshot_header, &created_entry) != 0) {
+            printf_debug("Cannot create file with path %s in snapshot %s because entry cannot be added\n", path, snapshot_file->f_name);
+            return -E_INVAL;
+        }
+
+        if(pure_file_write(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+            printf_debug("Cannot create file with path %s in snapshot %s because header cannot be updated\n", path, snapshot_file->f_name);
+            return -E_INVAL;
+        }
+
+        pure_file_flush(snapshot_file);
+
+    } else if (pure_file_create_result == -E_FILE_EXISTS){
+        printf_debug("File with path %s alllready exist\n", path);
+    } else {
+        panic("File with path %s cannot be created: errror %d\n", path, pure_file_create_result);
+    }
+
+    return pure_file_create_result;
+}
+
+/* Create "path".  On success set *pf to point at the file and return 0.
+ * On error return < 0. */
+int
+file_create(const char *path, struct File **pf) {
+    return file_create_type(path, FTYPE_REG, pf);
+}
+
+/* Create directory "path", otherwise like file_create */
+int
+file_mkdir(const char *path, struct File **pf) {
+    return file_create_type(path, FTYPE_DIR, pf);
+}
+
+/* The File at 'place' if it is a free slot of directory 'dir', else NULL */
+static struct File *
+dir_free_slot(struct File *dir, fileref_t place) {
+    blockno_t diskbno;
+
+    for (blockno_t i = 0; place && i < dir->f_size / BLKSIZE; i++) {
+        if (file_map_block(dir, i, &diskbno) < 0 || diskbno != FILEREF_BLOCK(place)) continue;
+
+        struct File *f = sh_ref_file(place);
+        return f != NULL && f->f_name[0] == '\0' ? f : NULL;
+    }
+    return NULL;
+}
+
+int
+pure_file_create(const char *path, struct File **pf) {
+    return pure_file_create_at(path, 0, pf);
+}
+
+/* Like pure_file_create, but put the file at 'place' if that is still
+ * a free slot of its directory, so references to the file stay valid */
+int
+pure_file_create_at(const char *path, fileref_t place, struct File **pf) {
+    printf_debug("Start of real creating file %s\n", path);
+
+    char name[MAXNAMELEN];
+    int res;
+    struct File *dir, *filp;
+
+    if ((res = walk_path(path, &dir, &filp, name)) == 0) { 
+        printf_debug("Two files with same names cannot be created: %s\n", name);
+        return -E_FILE_EXISTS;
+    }
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+    if (!(filp = dir_free_slot(dir, place)) && (res = dir_alloc_file(dir, &filp)) < 0) return res;
+
+    memset(filp, 0, sizeof(struct File));
+    strcpy(filp->f_name, name);
+    if (super->s_version >= FS_VERSION_EXTENTS)
+        filp->f_flags = FILE_EXTENTS;
+    dir_index_add(dir, filp);
+    dentry_cache_update(dir, name, filp);
+
+    *pf = filp;
+    pure_file_flush(dir);
+
+    return 0;
+}
+
+/* Remove file 'f' from its directory, freeing its blocks.
+ * The slot can then be reused by dir_alloc_file. */
+static void
+file_release(struct File *f) {
+    pure_file_set_size(f, 0);
+    memset(f, 0, sizeof(struct File));
+    flush_block(f);
+    memset(dir_slot_hints, 0, sizeof(dir_slot_hints));
+}
+
+/* Open "path".  On success set *pf to point at the file and return 0.
+ * On error return < 0. */
+int
+file_open(const char *path, struct File **pf) {
+    return walk_path(path, 0, pf, 0);
+}
+
+/* Read count bytes from f into buf, starting from seek position
+ * offset.  This meant to mimic the standard pread function.
+ * Returns the number of bytes read, < 0 on error. */
+
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+    printf_debug("Try to read from file %s...\n", f->f_name);
+
+    struct File *tmp_file;
+
+    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+
+    tmp_file = f;
+
+    if(resolve_file_for_read(&tmp_file, tmp_snapshot_file) != 0) {
+        return -E_INVAL;
+    }
+
+    return pure_file_read(tmp_file, buf, count, offset);
+}
+
+/* Map the blocks holding count bytes of f from offset, which must be
+ * block aligned, copy-on-write at dst instead of copying them like
+ * file_read does.  Only whole blocks inside the file are mapped.
+ * Returns the number of bytes mapped, < 0 on error. */
+ssize_t
+file_map_read(struct File *f, void *dst, size_t count, off_t offset) {
+    struct File *tmp_file = f;
+    char *blk;
+    int res;
+
+    if (offset % BLKSIZE) return -E_INVAL;
+
+    if (resolve_file_for_read(&tmp_file, to_file(current_snapshot_file)) != 0) {
+        return -E_INVAL;
+    }
+    f = tmp_file;
+
+    if (offset >= f->f_size) return 0;
+
+    count = ROUNDDOWN(MIN(count, f->f_size - offset), BLKSIZE);
+
+    /* A lazy mapping drops the dirty bit of the cached block,
+     * so whatever is dirty goes to the disk first */
+    for (size_t pos = 0; pos < count; pos += BLKSIZE) {
+        if ((res = file_get_block(f, (offset + pos) / BLKSIZE, &blk)) < 0) return res;
+        if (is_page_dirty(blk)) flush_block(blk);
+    }
+    bio_run();
+
+    for (size_t pos = 0; pos < count; pos += BLKSIZE) {
+        if ((res = file_get_block(f, (offset + pos) / BLKSIZE, &blk)) < 0) return res;
+
+        /* Fault the block in before mapping it */
+        (void)*(volatile char *)blk;
+        if ((res = sys_map_region(CURENVID, blk, CURENVID, (char *)dst + pos, BLKSIZE, PROT_R | PROT_LAZY)) < 0) {
+            return res;
+        }
+    }
+
+    return count;
+}
+
+// ssize_t
+// file_read(struct File *f, void *buf, size_t count, off_t offset) {
+//     if (*old_current_snapshot_file != 0 && find_in_snapshot_list(f) == false && f->f_type != FTYPE_DIR) {
+//         return snapshot_file_read(f, buf, count, offset);
+//     } else {
+//         return pure_file_read(f, buf, count, offset);
+//     }
+// }
+
+// Чтение файлов с диска без учета снэпшотов
+ssize_t
+pure_file_read(struct File *f, void *buf, size_t count, off_t offset) {
+    int r, bn;
+    off_t pos;
+    char *blk;
+
+    if (offset >= f->f_size) {
+        return 0;
+    }
+
+    count = MIN(count, f->f_size - offset);
+
+    for (pos = offset; pos < offset + count;) {
+        if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0) {
+            return r;
+        }
+        bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+        memmove(buf, blk + pos % BLKSIZE, bn);
+        pos += bn;
+        buf += bn;
+    }
+
+    return count;
+}
+
+// ssize_t
+// file_read(struct File *f, void *buf, size_t count, off_t offset) {
+//     char *blk;
+
+//     if (offset >= f->f_size)
+//         return 0;
+
+//     count = MIN(count, f->f_size - offset);
+
+//     for (off_t pos = offset; pos < offset + count;) {
+//         int r = file_get_block(f, pos / BLKSIZE, &blk);
+//         if (r < 0) return r;
+
+//         int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+//         memmove(buf, blk + pos % BLKSIZE, bn);
+//         pos += bn;
+//         buf += bn;
+//     }
+
+//     return count;
+// }
+
+/* Write count bytes from buf into f, starting at seek position
+ * offset.  This is meant to mimic the standard pwrite function.
+ * Extends the file if necessary.
+ * Returns the number of bytes written, < 0 on error. */
+
+
+ssize_t
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+    printf_debug("Try to write to file %s...\n", f->f_name);
+
+    struct File *tmp_file;
+
+    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+
+    tmp_file = f;
+
+    if(resolve_file_for_write(&tmp_file, tmp_snapshot_file) != 0) {
+        return -E_INVAL;
+    }
+
+    return pure_file_write(tmp_file, buf, count, offset);
+}
+
+// ssize_t
+// file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+
+//     printf_debug("writing in file %s...\n",f->f_name);
+
+//     if (*old_current_snapshot_file != 0 && find_in_snapshot_list(f) == false) { 
+//         if (find_in_snapshot_list(f) == 0) {
+//             return snapshot_file_write(f, buf, count, offset);
+//         }
+//     }
+
+//     return pure_file_write(f, buf, count, offset);
+// }
+
+// Запись в файл без учета снапшотов
+ssize_t
+pure_file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+    printf_debug("Value %s writen to file %s\n",(char *)buf, f->f_name);
+    int res;
+
+    /* Extend file if necessary */
+    if (offset + count > f->f_size)
+        // todo:: Chancge to pure???
+        if ((res = pure_file_set_size(f, offset + count)) < 0) return res;
+
+    for (off_t pos = offset; pos < offset + count;) {
+        char *blk;
+        if ((res = file_get_writable_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+
+        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+        memmove(blk + pos % BLKSIZE, buf, bn);
+        pos += bn;
+        buf += bn;
+    }
+
+    return count;
+}
+
+// ssize_t
+// file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+//     int res;
+
+//     /* Extend file if necessary */
+//     if (offset + count > f->f_size)
+//         if ((res = file_set_size(f, offset + count)) < 0) return res;
+
+//     for (off_t pos = offset; pos < offset + count;) {
+//         char *blk;
+//         if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+
+//         uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+//         memmove(blk + pos % BLKSIZE, buf, bn);
+//         pos += bn;
+//         buf += bn;
+//     }
+
+//     return count;
+// }
+
+/* Remove any blocks currently used by file 'f',
+ * but not necessary for a file of size 'newsize'.
+ * For both the old and new sizes, figure out the number of blocks required,
+ * and then free the blocks from new_nblocks to old_nblocks.
+ * The mapping blocks no longer needed are freed as well.
+ * Blocks which a snapshot copy still shares with its source are only
+ * unlinked, they belong to the source.
+ * Do not change f->f_size. */
 static void
 file_truncate_blocks(struct File *f, off_t newsize) {
     blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
     blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+    blockno_t diskbno;
+
+    if (!file_has_extents(f)) {
+        file_trim_indirect(f, new_nblocks, 1);
+        return;
+    }
+
     for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
-        int res = file_free_block(f, bno);
-        if (res < 0) cprintf("warning: file_free_block: %i", res);
+        int res = file_map_block(f, bno, &diskbno);
+        if (res < 0) cprintf("warning: file_map_block: %i", res);
+        if (res == 0 && diskbno) free_block(diskbno);
+    }
+
+    file_trim_blocks(f, new_nblocks);
+}
+
+/* Set the size of file f, truncating or extending as necessary. */
+
+int
+file_set_size(struct File *f, off_t newsize) {
+    printf_debug("Try to set new size %d for file %s\n", (int)newsize, f->f_name);
+
+    // find file in snapshot
+    // if deleting -> delete real file
+    // if not found create copy
+    // then modify original and copy
+
+    struct File *tmp_file;
+
+    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+
+    tmp_file = f;
+
+    if(resolve_file_for_write(&tmp_file, tmp_snapshot_file) != 0) {
+        return -E_INVAL;
+    }
+
+    // todo remove from test set size
+    // if (tmp_file != f) {
+    //     f->f_size = newsize;
+    // }
+    
+    return pure_file_set_size(tmp_file, newsize);
+}
+
+/* Allocate the blocks a file grows by as contiguous extents placed
+ * right after its last block.  Blocks that cannot be allocated now
+ * are left for file_get_block to allocate one at a time. */
+static void
+file_extend_blocks(struct File *f, off_t newsize) {
+    blockno_t filebno = CEILDIV(f->f_size, BLKSIZE);
+    blockno_t nblocks = CEILDIV(newsize, BLKSIZE);
+    blockno_t *pdiskbno, diskbno, hint = 0;
+    uint32_t count;
+
+    if (!file_has_extents(f)) {
+        nblocks = MIN(nblocks, MAXFILEBLOCKS);
+
+        /* The indirect block goes first so it does not split the extent */
+        if (nblocks > NDIRECT && file_block_walk(f, NDIRECT, &pdiskbno, 1) < 0) return;
+    }
+
+    if (filebno >= nblocks) return;
+
+    if (filebno && file_map_block(f, filebno - 1, &diskbno) == 0 && diskbno)
+        hint = diskbno + 1;
+
+    while (filebno < nblocks) {
+        blockno_t start = alloc_extent(hint, 1, nblocks - filebno, &count);
+        if (!start) return;
+
+        for (blockno_t i = 0; i < count; i++, filebno++) {
+            if (file_map_block(f, filebno, &diskbno) < 0 || diskbno ||
+                    file_set_block(f, filebno, start + i) < 0)
+                free_block(start + i);
+        }
+
+        hint = start + count;
+    }
+}
+
+int
+pure_file_set_size(struct File *f, off_t newsize) {
+    printf_debug("Setting new size %d old size is %d, for file %s\n",(int)newsize, (int)f->f_size, f->f_name);
+
+    if (f->f_size > newsize)
+        file_truncate_blocks(f, newsize);
+    else
+        file_extend_blocks(f, newsize);
+    if (newsize == 0 && f->f_type == FTYPE_DIR) {
+        dir_index_free(f);
+        dentry_cache_invalidate();
+    }
+    f->f_size = newsize;
+    flush_block(f);
+    return 0;
+}
+
+// int
+// file_set_size(struct File *f, off_t newsize) {
+//     if (f->f_size > newsize)
+//         file_truncate_blocks(f, newsize);
+//     f->f_size = newsize;
+//     flush_block(f);
+//     return 0;
+// }
+
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+
+void
+file_flush(struct File *f) {
+    printf_debug("Start flushing file %s\n", f->f_name);
+
+    struct File *tmp_file;
+
+    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+
+    tmp_file = f;
+
+    if(resolve_file_for_read(&tmp_file, tmp_snapshot_file) != 0) {
+        printf_debug("File %s cannot be flushed, because nothing was writen to it\n", f->f_name);
+    }
+
+    pure_file_flush(tmp_file);
+}
+
+void
+pure_file_flush(struct File *f) {
+    blockno_t diskbno;
+
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+        if (file_map_block(f, i, &diskbno) < 0 || diskbno == 0)
+            continue;
+        flush_block(diskaddr(diskbno));
+    }
+    file_flush_mapping(f);
+    flush_block(f);
+}
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+    refcount_flush();
+    bc_sync();
+}
+
+
+
+/********************** snapshot start ***************************************************************/
+
+/********************** utils start ******************************************************************/
+
+// Переводит ссылку (блок, слот) в указатель на File в кэше блоков
+static struct File *
+sh_ref_file(fileref_t ref) {
+    if (ref == 0) {
+        return NULL;
+    }
+
+    if (FILEREF_BLOCK(ref) == 1 && FILEREF_SLOT(ref) == FILEREF_ROOT_SLOT) {
+        return &super->s_root;
+    }
+
+    if (FILEREF_BLOCK(ref) >= super->s_nblocks || FILEREF_SLOT(ref) >= BLKFILES) {
+        printf_debug("Bad file reference: block %u slot %u\n", FILEREF_BLOCK(ref), FILEREF_SLOT(ref));
+        return NULL;
+    }
+
+    return (struct File *)diskaddr(FILEREF_BLOCK(ref)) + FILEREF_SLOT(ref);
+}
+
+// Строит ссылку (блок, слот) на File, лежащий в кэше блоков
+static fileref_t
+sh_file_ref(struct File *file) {
+    if (file == NULL) {
+        return 0;
+    }
+
+    if (file == &super->s_root) {
+        return FILEREF(1, FILEREF_ROOT_SLOT);
+    }
+
+    uintptr_t offset = (uintptr_t)file - DISKMAP;
+
+    return FILEREF(offset / BLKSIZE, (offset % BLKSIZE) / sizeof(struct File));
+}
+
+// Файл в .snapshots/ переименован на месте: добавляем новое имя в индекс каталога
+static void
+sh_file_renamed(struct File *file) {
+    struct File *dir;
+
+    if (walk_path(SNAPDIR, NULL, &dir, NULL) == 0) {
+        dir_index_add(dir, file);
+        dentry_cache_update(dir, file->f_name, file);
+    }
+}
+
+/* In-memory copy of the snapshot tree, so that the chain of snapshots
+ * can be walked without reading their headers.  Built and validated by
+ * sh_tree_load at sh_init and kept in sync by the snapshot operations.
+ * If the tree outgrows the table the copy is dropped and the headers
+ * are read from disk instead. */
+struct Snapshot_node {
+    struct File *sn_file;
+    struct File *sn_parent;
+    bool sn_deleted;
+};
+
+static struct Snapshot_node sh_nodes[SH_NODE_CACHE_SIZE];
+static int sh_nodes_count;
+static bool sh_nodes_valid;
+
+static struct Snapshot_node *
+sh_node_find(struct File *snapshot_file) {
+    if (!sh_nodes_valid) {
+        return NULL;
+    }
+
+    for (int i = 0; i < sh_nodes_count; ++i) {
+        if (sh_nodes[i].sn_file == snapshot_file) {
+            return &sh_nodes[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void
+sh_node_add(struct File *snapshot_file, struct File *parent, bool is_deleted) {
+    if (!sh_nodes_valid) {
+        return;
+    }
+
+    if (sh_nodes_count == SH_NODE_CACHE_SIZE) {
+        printf_debug("Snapshot tree does not fit in memory, headers will be used\n");
+        sh_nodes_valid = false;
+        return;
+    }
+
+    sh_nodes[sh_nodes_count].sn_file = snapshot_file;
+    sh_nodes[sh_nodes_count].sn_parent = parent;
+    sh_nodes[sh_nodes_count].sn_deleted = is_deleted;
+    ++sh_nodes_count;
+}
+
+static void
+sh_node_remove(struct File *snapshot_file) {
+    struct Snapshot_node *node = sh_node_find(snapshot_file);
+
+    if (node != NULL) {
+        *node = sh_nodes[--sh_nodes_count];
+    }
+}
+
+// Загружает дерево снапшотов в память, проверяя все ссылки
+static void
+sh_tree_load(void) {
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+    struct File *snapshot_file, *child;
+
+    sh_nodes_count = 0;
+    sh_nodes_valid = true;
+
+    sh_node_add(to_file(root_snapshot_file), NULL, false);
+
+    // обход в ширину, очередью служит сама таблица
+    for (int i = 0; sh_nodes_valid && i < sh_nodes_count; ++i) {
+        snapshot_file = sh_nodes[i].sn_file;
+
+        if (snapshot_file == NULL || snapshot_file->f_name[0] == '\0') {
+            panic("Snapshot tree is corrupted: bad reference to snapshot\n");
+        }
+
+        if (pure_file_read(snapshot_file, &header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+            panic("Snapshot tree is corrupted: cannot read header of %s\n", snapshot_file->f_name);
+        }
+
+        if (sh_ref_file(header.prev_snapshot) != sh_nodes[i].sn_parent) {
+            panic("Snapshot tree is corrupted: %s has wrong previous snapshot\n", snapshot_file->f_name);
+        }
+
+        sh_nodes[i].sn_deleted = header.is_deleted;
+
+        for (uint32_t n = 0; n < header.entries_size; ++n) {
+            if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+                panic("Snapshot tree is corrupted: cannot read entries of %s\n", snapshot_file->f_name);
+            }
+            if (entry.se_type != SH_ENTRY_CHILD) {
+                continue;
+            }
+
+            child = sh_ref_file(entry.se_file);
+            if (child == NULL || block_is_free(FILEREF_BLOCK(entry.se_file))) {
+                panic("Snapshot tree is corrupted: bad child reference in %s\n", snapshot_file->f_name);
+            }
+
+            sh_node_add(child, snapshot_file, false);
+        }
+    }
+
+    if (sh_nodes_valid && sh_node_find(to_file(current_snapshot_file)) == NULL) {
+        panic("Snapshot tree is corrupted: current snapshot is not reachable from root\n");
+    }
+
+    printf_debug("Snapshot tree loaded: %d snapshots\n", sh_nodes_count);
+}
+
+/* Cache of resolve_file_for_read/resolve_file_for_write results:
+ * file -> file that holds its data in the current snapshot.
+ * 'in_current' is set if the resolved file belongs to the current
+ * snapshot itself, so writes may go to it directly.
+ * Valid until the snapshot tree changes (create/accept/delete). */
+struct Resolve_cache_entry {
+    struct File *file;
+    struct File *resolved;
+    bool in_current;
+};
+
+static struct Resolve_cache_entry resolve_cache[RESOLVE_CACHE_SIZE];
+
+static struct Resolve_cache_entry *
+resolve_cache_slot(struct File *file) {
+    return &resolve_cache[((uintptr_t)file / sizeof(struct File)) % RESOLVE_CACHE_SIZE];
+}
+
+static void
+resolve_cache_invalidate(void) {
+    memset(resolve_cache, 0, sizeof(resolve_cache));
+}
+
+static void
+resolve_cache_update(struct File *file, struct File *resolved, bool in_current) {
+    struct Resolve_cache_entry *entry = resolve_cache_slot(file);
+
+    entry->file = file;
+    entry->resolved = resolved;
+    entry->in_current = in_current;
+}
+
+static uint32_t
+sh_name_hash(const char *name) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static uint32_t
+sh_ref_hash(fileref_t ref) {
+    return (FILEREF_BLOCK(ref) * 2654435761U) ^ FILEREF_SLOT(ref);
+}
+
+// Создает пустую таблицу индекса снапшота
+static int
+sh_index_init(struct File *snapshot_file) {
+    uint32_t buckets[INDEXBUCKETS];
+
+    memset(buckets, 0, sizeof(buckets));
+
+    if (pure_file_write(snapshot_file, buckets, sizeof(buckets), INDEXPOS) != sizeof(buckets)) {
+        printf_debug("Index for snapshot %s cannot be inited\n", snapshot_file->f_name);
+        return -E_INVAL;
+    }
+
+    return 0;
+}
+
+// Ищет копию файла orig в снапшоте по индексу. Имя name различает
+// только принятые копии файлов, которых здесь нет (orig == 0)
+static int
+sh_index_lookup(struct File *snapshot_file, fileref_t orig, const char *name, struct File **pfound) {
+    struct Snapshot_entry entry;
+    uint32_t hash, next;
+
+    if (snapshot_file->f_size < ENTRIESPOS) {
+        /* Snapshot without index, nothing was modified in it */
+        return -E_NOT_FOUND;
+    }
+
+    hash = sh_ref_hash(orig);
+
+    if (pure_file_read(snapshot_file, &next, sizeof(next), INDEXPOS + (hash % INDEXBUCKETS) * sizeof(uint32_t)) != sizeof(next)) {
+        return -E_INVAL;
+    }
+
+    while (next != 0) {
+        if (sh_entry_read(snapshot_file, next - 1, &entry) != 0) {
+            return -E_INVAL;
+        }
+
+        if (entry.se_type == SH_ENTRY_MODIFIED && entry.se_orig == orig &&
+                (orig != 0 || strcmp(entry.se_name, name) == 0)) {
+            *pfound = sh_ref_file(entry.se_file);
+            return 0;
+        }
+
+        next = entry.se_next;
+    }
+
+    return -E_NOT_FOUND;
+}
+
+// Читает запись снапшота с номером n
+static int
+sh_entry_read(struct File *snapshot_file, uint32_t n, struct Snapshot_entry *entry) {
+    if (pure_file_read(snapshot_file, entry, ENTRYSIZE, ENTRIESPOS + n * ENTRYSIZE) != ENTRYSIZE) {
+        printf_debug("Entry %u of snapshot %s cannot be readed\n", n, snapshot_file->f_name);
+        return -E_INVAL;
+    }
+
+    return 0;
+}
+
+static int
+sh_entry_write(struct File *snapshot_file, uint32_t n, struct Snapshot_entry *entry) {
+    if (pure_file_write(snapshot_file, entry, ENTRYSIZE, ENTRIESPOS + n * ENTRYSIZE) != ENTRYSIZE) {
+        printf_debug("Entry %u of snapshot %s cannot be written\n", n, snapshot_file->f_name);
+        return -E_INVAL;
+    }
+
+    return 0;
+}
+
+static off_t
+sh_bucket_pos(uint32_t hash) {
+    return INDEXPOS + (hash % INDEXBUCKETS) * sizeof(uint32_t);
+}
+
+// Добавляет запись в снапшот (модифицированные файлы еще и в индекс),
+// заголовок записывает вызывающий
+static int
+sh_entry_add(struct File *snapshot_file, struct Snapshot_header *header, struct Snapshot_entry *entry) {
+    struct Snapshot_entry free_entry;
+    uint32_t n;
+
+    if (header->free_entries != 0) {
+        n = header->free_entries - 1;
+
+        if (sh_entry_read(snapshot_file, n, &free_entry) != 0) {
+            return -E_INVAL;
+        }
+
+        header->free_entries = free_entry.se_next;
+    } else {
+        n = header->entries_size++;
+    }
+
+    entry->se_next = 0;
+
+    if (entry->se_type == SH_ENTRY_MODIFIED) {
+        if (pure_file_read(snapshot_file, &entry->se_next, sizeof(uint32_t), sh_bucket_pos(entry->se_hash)) != sizeof(uint32_t)) {
+            return -E_INVAL;
+        }
+    }
+
+    if (sh_entry_write(snapshot_file, n, entry) != 0) {
+        return -E_INVAL;
+    }
+
+    if (entry->se_type == SH_ENTRY_MODIFIED) {
+        uint32_t head = n + 1;
+
+        if (pure_file_write(snapshot_file, &head, sizeof(uint32_t), sh_bucket_pos(entry->se_hash)) != sizeof(uint32_t)) {
+            return -E_INVAL;
+        }
+    }
+
+    return 0;
+}
+
+// Освобождает запись снапшота (модифицированные файлы удаляются из индекса),
+// заголовок записывает вызывающий
+static int
+sh_entry_free(struct File *snapshot_file, struct Snapshot_header *header, uint32_t n) {
+    struct Snapshot_entry entry, prev_entry;
+    uint32_t next, prev = 0;
+
+    if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+        return -E_INVAL;
+    }
+
+    if (entry.se_type == SH_ENTRY_MODIFIED) {
+        if (pure_file_read(snapshot_file, &next, sizeof(uint32_t), sh_bucket_pos(entry.se_hash)) != sizeof(uint32_t)) {
+            return -E_INVAL;
+        }
+
+        while (next != 0 && next != n + 1) {
+            prev = next;
+            if (sh_entry_read(snapshot_file, next - 1, &prev_entry) != 0) {
+                return -E_INVAL;
+            }
+            next = prev_entry.se_next;
+        }
+
+        if (next == 0) {
+            printf_debug("Entry %u of snapshot %s is not indexed\n", n, snapshot_file->f_name);
+        } else if (prev == 0) {
+            if (pure_file_write(snapshot_file, &entry.se_next, sizeof(uint32_t), sh_bucket_pos(entry.se_hash)) != sizeof(uint32_t)) {
+                return -E_INVAL;
+            }
+        } else {
+            prev_entry.se_next = entry.se_next;
+            if (sh_entry_write(snapshot_file, prev - 1, &prev_entry) != 0) {
+                return -E_INVAL;
+            }
+        }
+    }
+
+    memset(&entry, 0, ENTRYSIZE);
+    entry.se_type = SH_ENTRY_FREE;
+    entry.se_next = header->free_entries;
+    header->free_entries = n + 1;
+
+    return sh_entry_write(snapshot_file, n, &entry);
+}
+
+// Ищет запись заданного типа, ссылающуюся на файл
+static int
+sh_entry_find(struct File *snapshot_file, struct Snapshot_header *header, uint32_t type, struct File *file, uint32_t *pn) {
+    struct Snapshot_entry entry;
+
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+
+        if (entry.se_type == type && entry.se_file == sh_file_ref(file)) {
+            *pn = n;
+            return 0;
+        }
+    }
+
+    return -E_NOT_FOUND;
+}
+
+// Возвращает предыдущий снапшот без чтения всего заголовка
+static struct File *
+sh_prev_snapshot(struct File *snapshot_file) {
+    struct Snapshot_node *node = sh_node_find(snapshot_file);
+    fileref_t prev_snapshot;
+
+    if (node != NULL) {
+        return node->sn_parent;
+    }
+
+    if (pure_file_read(snapshot_file, &prev_snapshot, sizeof(prev_snapshot), HEADERPOS + offsetof(struct Snapshot_header, prev_snapshot)) != sizeof(prev_snapshot)) {
+        return NULL;
+    }
+
+    return sh_ref_file(prev_snapshot);
+}
+
+// Ищет ближайшего общего предка двух снапшотов
+static struct File *
+sh_common_ancestor(struct File *first, struct File *second) {
+    int first_depth = 0, second_depth = 0;
+
+    for (struct File *snap = sh_prev_snapshot(first); snap != NULL; snap = sh_prev_snapshot(snap)) {
+        ++first_depth;
+    }
+
+    for (struct File *snap = sh_prev_snapshot(second); snap != NULL; snap = sh_prev_snapshot(snap)) {
+        ++second_depth;
+    }
+
+    for (; first_depth > second_depth; --first_depth) {
+        first = sh_prev_snapshot(first);
+    }
+
+    for (; second_depth > first_depth; --second_depth) {
+        second = sh_prev_snapshot(second);
+    }
+
+    while (first != second) {
+        first = sh_prev_snapshot(first);
+        second = sh_prev_snapshot(second);
+    }
+
+    return first;
+}
+
+// выбирает правильный файл для чтения снапшотированных данных
+int
+resolve_file_for_read(struct File **pfile, struct File *snapshot_file) {
+    printf_debug("Resolving real file for read for %s with current snapshot %s\n", (*pfile)->f_name, snapshot_file->f_name);
+
+    struct Resolve_cache_entry *cached = resolve_cache_slot(*pfile);
+    struct File *file, *found;
+    bool in_current = true;
+    int res;
+
+    file = *pfile;
+
+    if (cached->file == file && snapshot_file == to_file(current_snapshot_file)) {
+        *pfile = cached->resolved;
+        return 0;
+    }
+
+    for (struct File *snap = snapshot_file; snap != NULL; snap = sh_prev_snapshot(snap)) {
+        if ((res = sh_index_lookup(snap, sh_file_ref(file), file->f_name, &found)) == 0) {
+            printf_debug("File for read %s founded in snapshot %s and have name %s\n", file->f_name, snap->f_name, found->f_name);
+
+            *pfile = found;
+            break;
+        } else if (res != -E_NOT_FOUND) {
+            printf_debug("Index for snapshot %s cannot be readed\n", snap->f_name);
+            return res;
+        }
+
+        in_current = false;
+    }
+
+    if (*pfile == file) {
+        printf_debug("File %s for read not founded in current snapshot\n", file->f_name);
+        in_current = false;
+    }
+
+    if (snapshot_file == to_file(current_snapshot_file)) {
+        resolve_cache_update(file, *pfile, in_current);
+    }
+
+    return 0;
+}
+
+int
+resolve_file_for_write(struct File **pfile, struct File *snapshot_file) {
+    printf_debug("Resolving real file for wtite for %s with current snapshot %s\n", (*pfile)->f_name, snapshot_file->f_name);
+
+    struct Resolve_cache_entry *cached = resolve_cache_slot(*pfile);
+    struct File *file;
+    struct Snapshot_header snapshot_header;
+    int res;
+
+    file = *pfile;
+
+    if (cached->file == file && cached->in_current && snapshot_file == to_file(current_snapshot_file)) {
+        *pfile = cached->resolved;
+        return 0;
+    }
+
+    if ((res = sh_index_lookup(snapshot_file, sh_file_ref(file), file->f_name, pfile)) == 0) {
+        printf_debug("File for write %s founded in snapshot %s and have name %s\n", file->f_name, snapshot_file->f_name, (*pfile)->f_name);
+        return 0;
+    } else if (res != -E_NOT_FOUND) {
+        return res;
+    }
+    
+    printf_debug("File %s not founded in current snapshot, it must be created\n", file->f_name);
+
+    if((res = resolve_file_for_read(pfile, snapshot_file)) < 0) {
+        printf_debug("File for write %s cannot be resolved because file for read %s cannot be found in %s\n",file->f_name, file->f_name, snapshot_file->f_name);
+        return res;
+    }
+
+    if(pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+        printf_debug("Cannot read header for snapshot %s to resolve file %s for write\n", snapshot_file->f_name, file->f_name);
+        return -E_INVAL;
+    }
+
+    struct File *pfile_for_write;
+
+    if((res = create_and_copy(&pfile_for_write, pfile)) != (*pfile)->f_size) {
+        printf_debug("File %s for write cannot be CAC: error code %d\n", file->f_name, res);
+        return res;
+    }
+
+    *pfile = pfile_for_write;
+
+    struct Snapshot_entry modified_entry = {
+        .se_type = SH_ENTRY_MODIFIED,
+        .se_hash = sh_ref_hash(sh_file_ref(file)),
+        .se_file = sh_file_ref(pfile_for_write),
+        .se_orig = sh_file_ref(file)};
+    strcpy(modified_entry.se_name, file->f_name);
+
+    if ((res = sh_entry_add(snapshot_file, &snapshot_header, &modified_entry)) < 0) {
+        printf_debug("Cannot index file %s in snapshot %s\n", file->f_name, snapshot_file->f_name);
+        return res;
+    }
+
+    if(pure_file_write(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+        printf_debug("Cannot write header for snapshot %s after resolving file %s for write\n", snapshot_file->f_name, file->f_name);
+        return -E_INVAL;
+    }
+
+    pure_file_flush(snapshot_file);
+
+    if (snapshot_file == to_file(current_snapshot_file)) {
+        resolve_cache_update(file, pfile_for_write, true);
+    }
+
+    return 0;
+}
+
+/* Make 'dst' reference the data blocks of 'src': the indirect block
+ * is duplicated and every data block gets one more reference, or is
+ * copied if its reference counter is saturated. */
+static int
+file_share_blocks(struct File *dst, struct File *src) {
+    blockno_t diskbno;
+    blockno_t filebno, nblocks = CEILDIV(src->f_size, BLKSIZE);
+    int res;
+
+    if ((res = file_copy_mapping(dst, src)) < 0) return res;
+
+    dst->f_size = src->f_size;
+    dst->f_type = src->f_type;
+
+    for (filebno = 0; filebno < nblocks; filebno++) {
+        if (file_map_block(dst, filebno, &diskbno) < 0 || !diskbno) continue;
+        if (block_share(diskbno) == 0) continue;
+
+        blockno_t block = alloc_block();
+        if (!block) break;
+        memmove(diskaddr(block), diskaddr(diskbno), BLKSIZE);
+        flush_block(diskaddr(block));
+        if (file_set_block(dst, filebno, block) < 0) {
+            free_block(block);
+            break;
+        }
+    }
+
+    if (filebno < nblocks) {
+        /* Out of disk: forget the blocks not taken yet and drop the rest */
+        file_trim_blocks(dst, filebno);
+        pure_file_set_size(dst, 0);
+        return -E_NO_DISK;
+    }
+
+    file_flush_mapping(dst);
+    flush_block(dst);
+    return 0;
+}
+
+static int
+create_and_share(struct File **dstfile, struct File **srcfile) {
+
+    printf_debug("Start CAS for file %s\n", (*srcfile)->f_name);
+
+    int file_create_result, share_result;
+
+    char *current_snapshot_name = to_file(current_snapshot_file)->f_name;
+
+    snapshoted_file_name(snapshoted_file_name, (*srcfile)->f_name, sh_file_ref(*srcfile), current_snapshot_name);
+
+    if ((file_create_result = pure_file_create(snapshoted_file_name, dstfile)) < 0) {
+        printf_debug("File for snapshoted file %s cannot be created: error code %d\n", snapshoted_file_name, file_create_result);
+        return file_create_result;
+    }
+
+    if ((share_result = file_share_blocks(*dstfile, *srcfile)) < 0) {
+        printf_debug("Blocks of file %s cannot be shared: error code %d\n", (*srcfile)->f_name, share_result);
+        return share_result;
+    }
+
+    printf_debug("CAS for file %s ends, file with name %s shares its blocks\n", (*srcfile)->f_name, (*dstfile)->f_name);
+
+    return (*dstfile)->f_size;
+}
+
+int 
+create_and_copy(struct File **dstfile, struct File **srcfile) {
+
+    if (SNAPSHOT_COW) {
+        return create_and_share(dstfile, srcfile);
+    }
+
+    printf_debug("Start CAC for file %s\n", (*srcfile)->f_name);
+
+    off_t offset = 0;
+    off_t cac_range = (*srcfile)->f_size; 
+
+    uint32_t bn;
+
+    off_t position_in_file;
+
+    int file_create_result, src_get_block_result, dst_get_block_result, file_set_size_result;
+
+    char *src_file_block, *dst_file_block;
+
+    char *current_snapshot_name = to_file(current_snapshot_file)->f_name;
+
+    snapshoted_file_name(snapshoted_file_name, (*srcfile)->f_name, sh_file_ref(*srcfile), current_snapshot_name);
+    
+    file_create_result = pure_file_create(snapshoted_file_name, dstfile);
+
+    if (file_create_result == -E_FILE_EXISTS) {
+        printf_debug("File for snapshoted file %s already exist\n", snapshoted_file_name);
+        return file_create_result;
+    } else if(file_create_result == -E_NOT_FOUND) {
+        printf_debug("Directory for snapshoted file %s not found\n", snapshoted_file_name);
+        return file_create_result;
+    } else if(file_create_result < 0) {
+        printf_debug("File for snapshoted file %s cannot be created: error code %d\n", snapshoted_file_name, file_create_result);
+        return file_create_result;
+    }
+
+    if ((*srcfile)->f_size > (*dstfile)->f_size) {
+        if ((file_set_size_result = pure_file_set_size(*dstfile, (*srcfile)->f_size)) < 0) {
+            printf_debug("Cannot set new size for file %s in CAC from file %s\n", (*dstfile)->f_name, (*srcfile)->f_name);
+            return file_set_size_result;
+        }
+    }
+
+    for (position_in_file = offset; position_in_file < cac_range;) {
+
+        // Читаем нужный блок для копированния
+        if ((src_get_block_result = file_get_block(*srcfile, position_in_file / BLKSIZE, &src_file_block)) < 0) {
+            printf_debug("Cannot get block for file %s at pos %d with block number %lld\n", (*srcfile)->f_name, position_in_file, position_in_file / BLKSIZE);
+            return src_get_block_result;
+        }
+
+        // Читаем новый блок для записи
+        if ((dst_get_block_result = file_get_block(*dstfile, position_in_file / BLKSIZE, &dst_file_block)) < 0) {
+            printf_debug("Cannot get block for file %s at pos %d with block number %lld\n", (*dstfile)->f_name, position_in_file, position_in_file / BLKSIZE);
+            return src_get_block_result;
+        }
+
+        bn = MIN(BLKSIZE - position_in_file % BLKSIZE, (*srcfile)->f_size - position_in_file);
+
+        memmove(dst_file_block + position_in_file % BLKSIZE , src_file_block + position_in_file % BLKSIZE, bn);
+        position_in_file += bn;
+    }
+
+    printf_debug("CAC for file %s ends, file with name %s created and filed\n", (*srcfile)->f_name, (*dstfile)->f_name);
+
+    return cac_range - offset;
+}
+
+/********************** utils end   ******************************************************************/
+
+/********************** logic start ******************************************************************/
+
+
+
+/********************** logic end   ******************************************************************/
+
+/************************ functions start ************************************************************/
+// Создаёт файл снапшота с заголовком header и привязывает его к
+// предыдущему снапшоту prev_snapshot_file
+static int
+sh_snapshot_create(const char *name, struct File *prev_snapshot_file, struct Snapshot_header *header, struct File **psnapshot_file) {
+    printf_debug("Start creating snapshot file %s\n", name);
+
+    struct File *snapshot_file;
+
+    struct Snapshot_header prev_snapshot_header;
+
+    int file_create_result, header_write_result, header_read_result, alloc_block_result;
+
+    char * addr;
+
+    snapshot_name(snap_name, name);
+
+    file_create_result = pure_file_create(snap_name, &snapshot_file);
+
+    if (file_create_result == -E_FILE_EXISTS) {
+        printf_debug("File for snapshot %s already exist\n", name);
+        return file_create_result;
+    } else if(file_create_result == -E_NOT_FOUND) {
+        printf_debug("Directory for file for snapshot not found\n");
+        return file_create_result;
+    } else if(file_create_result < 0) {
+        printf_debug("File for snapshot %s cannot be created: error code %d\n", name, file_create_result);
+        return file_create_result;
+    }
+
+    printf_debug("Snapshot file created\n");
+
+    if ((header_read_result = pure_file_read(prev_snapshot_file, &prev_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Previous snapshot header cannot be readed: error code %d\n", header_read_result);
+        return header_read_result;
+    } else {
+        printf_debug("Previous snapshot header readed\n");
+    }
+
+    header->prev_snapshot = sh_file_ref(prev_snapshot_file);
+    header->entries_size = 0;
+    header->free_entries = 0;
+
+    struct Snapshot_entry child_entry = {
+        .se_type = SH_ENTRY_CHILD,
+        .se_file = sh_file_ref(snapshot_file)};
+
+    if ((header_write_result = sh_entry_add(prev_snapshot_file, &prev_snapshot_header, &child_entry)) != 0) {
+        printf_debug("Snapshot cannot be linked to previous snapshot\n");
+        return header_write_result;
+    }
+
+    if ((header_write_result = pure_file_write(prev_snapshot_file, &prev_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Previous snapshot header cannot be updated\n");
+        return header_write_result;
+    } else {
+        printf_debug("Previous snapshot header updated\n");
+    }
+
+    pure_file_flush(prev_snapshot_file);
+
+    if ((alloc_block_result = alloc_block()) == 0) {
+        panic("Out of memory! Snapshot cannot be created \n");
+    }
+
+    printf_debug("Old bitmap block for snapshot is alloced\n");
+
+    header->old_bitmap = alloc_block_result;
+    addr = diskaddr(alloc_block_result);
+    memcpy(addr, diskaddr(1), BLKSIZE);
+    flush_block(addr);
+
+    printf_debug("Snapshot old bitmap block flushed\n");
+    
+    if ((header_write_result = pure_file_write(snapshot_file, header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Snapshot cannot be inited\n");
+        return header_write_result;
+    } else {
+        printf_debug("Snapshot inited\n");
+    }
+
+    if ((header_write_result = sh_index_init(snapshot_file)) != 0) {
+        printf_debug("Snapshot index cannot be inited\n");
+        return header_write_result;
+    }
+
+    pure_file_flush(snapshot_file);
+
+    sh_node_add(snapshot_file, prev_snapshot_file, false);
+
+    *psnapshot_file = snapshot_file;
+
+    return 0;
+}
+
+int fs_create_tmp_snapshot() {
+    printf_debug("Start creatin temporary snapshot file\n");
+
+    struct File *tmp_snapshot_file = NULL;
+
+    int create_result, cfg_read_result, cfg_write_result;
+
+    struct Snapshot_header tmp_snapshot_header = {
+        .comment = "",
+        .date = 0,
+        .is_deleted = false};
+
+    if ((create_result = sh_snapshot_create(TMPSNAP, to_file(current_snapshot_file), &tmp_snapshot_header, &tmp_snapshot_file)) != 0) {
+        printf_debug("Temporary snapshot cannot be created: error code %d\n", create_result);
+        return create_result;
+    }
+
+    *current_snapshot_file = sh_file_ref(tmp_snapshot_file);
+
+    resolve_cache_invalidate();
+    dentry_cache_invalidate();
+
+    printf_debug("Start snapshot cfg update after temporary snapshot created\n");
+
+    struct Snapshot_config cfg;
+
+    if((cfg_read_result = pure_file_read(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS)) != sizeof(struct Snapshot_config)) {
+        printf_debug("Snapshot config cannot be readed\n");
+        return cfg_read_result;
+    } else {
+        printf_debug("Snapshot config readed\n");
+    }
+
+    strcpy(cfg.current_snapshot_name, tmp_snapshot_file->f_name);
+
+    if((cfg_write_result = pure_file_write(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS)) != sizeof(struct Snapshot_config)) {
+        printf_debug("Snapshot config cannot be updated\n");
+        return cfg_write_result;
+    } else {
+        printf_debug("Snapshot config updated\n");
+    }
+
+    pure_file_flush(to_file(snapshot_config_file));
+
+    printf_debug("Temporary snapshot created\n");
+
+    return 0;
+}
+
+int fs_create_snapshot(const char * comment, const char * name) {
+    
+    printf_debug("Start creating snapshot with name: %s; and comment: %s!\n", name, comment);
+
+    int file_search_result, read_header_result, write_header_result;
+
+    struct Snapshot_header new_snapshot_header;
+
+    struct File *translated_root_snapshot_file,*snapshot_file_for_delete;
+    translated_root_snapshot_file = to_file(root_snapshot_file);
+    snapshot_file_for_delete = translated_root_snapshot_file;
+    
+    // проверить а нет ли уже снапшотов с таким именем
+    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_delete)) != -E_NOT_FOUND) {
+        printf_debug("Cannot create snapshot with name %s because it's already exist\n", name);
+        cprintf("Snapshot with name %s already exist\n", name);
+        return file_search_result;
+    }
+
+    struct File *new_snapshot_file = to_file(current_snapshot_file);
+
+    strcpy(new_snapshot_file->f_name, name);
+    sh_file_renamed(new_snapshot_file);
+
+    printf_debug("New snapshot file name updated, now is %s\n", new_snapshot_file->f_name);
+
+    resolve_cache_invalidate();
+    dentry_cache_invalidate();
+
+    if((read_header_result = pure_file_read(new_snapshot_file, &new_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot create new snapshot, because current snapshot header cannot be readed\n");
+        return read_header_result;
+    }
+
+    printf_debug("New snapshot file header readed\n");
+
+    strcpy(new_snapshot_header.comment, comment);
+
+    new_snapshot_header.date = sys_gettime();
+
+    if((write_header_result = pure_file_write(new_snapshot_file, &new_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot create new snapshot, because current snapshot header cannot be updated\n");
+        return write_header_result;
+    }
+
+    printf_debug("New snapshot file header was written\n");
+
+    // rename files for tmp snapshots
+
+    printf_debug("Start renaming files from deleted snapshot\n");
+    
+    struct Snapshot_entry entry;
+    struct File *buffer_snapshoted_file;
+    for (uint32_t n = 0; n < new_snapshot_header.entries_size; ++n) {
+        if (sh_entry_read(new_snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+        if (entry.se_type != SH_ENTRY_MODIFIED) {
+            continue;
+        }
+    
+        buffer_snapshoted_file = sh_ref_file(entry.se_file);
+
+        printf_debug("Updating file name for %s\n", buffer_snapshoted_file->f_name);
+
+        // переименновываем файлы временного снэпшота в постоянный
+        char *pseparator = strfind(strfind(buffer_snapshoted_file->f_name, SNAPIDSEP[0]), SNAPFILESEP[0]);
+        ++pseparator;
+        *pseparator = '\0';
+
+        strcat(buffer_snapshoted_file->f_name, new_snapshot_file->f_name);
+        sh_file_renamed(buffer_snapshoted_file);
+
+        printf_debug("Updated file name for %s\n", buffer_snapshoted_file->f_name);
+    }
+    
+    printf_debug("Deleted snapshot file name updated: %s\n", snapshot_file_for_delete->f_name);
+
+    file_flush(new_snapshot_file);
+
+    fs_create_tmp_snapshot();
+
+    return 0;
+}
+
+int
+fs_accept_snapshot(const char *name) {
+
+    printf_debug("Try to accept snapshot with name %s\n", name);
+
+    int file_search_result;//, header_read_result, header_write_result;
+    
+    struct File *translated_root_snapshot_file,*snapshot_file_for_accept;
+
+    // here we should find snapshot by name
+
+    translated_root_snapshot_file = to_file(root_snapshot_file);
+
+    snapshot_file_for_accept = translated_root_snapshot_file;
+
+    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_accept)) == -E_NOT_FOUND) {
+        cprintf("Snapshot with name %s does not exist\n", name);
+        return file_search_result;
+    } else if(file_search_result != 0) {
+        cprintf("Unknown error during seraching snapshot with name %s\n", name);
+        return file_search_result;
+    }
+
+    printf_debug("Found snapshot with name %s\n", snapshot_file_for_accept->f_name);
+
+    resolve_cache_invalidate();
+    dentry_cache_invalidate();
+
+    // delete tmp snapshot (and all files)
+
+    if ((file_search_result = delete_tmp_snapshot()) != 0) {
+        cprintf("Cannot delete temporary snapshot before accepting %s\n", name);
+        return file_search_result;
+    }
+
+    // откатываем и накатываем только путь между текущим и принимаемым
+    // снапшотами через их ближайшего общего предка
+
+    struct File *last_snapshot_file = to_file(current_snapshot_file);
+
+    struct File *common_ancestor = sh_common_ancestor(last_snapshot_file, snapshot_file_for_accept);
+
+    printf_debug("Common ancestor of %s and %s is %s\n", last_snapshot_file->f_name, snapshot_file_for_accept->f_name, common_ancestor->f_name);
+
+    if (last_snapshot_file != common_ancestor) {
+        delete_created_files_to_ancestor(last_snapshot_file, common_ancestor, snapshot_file_for_accept);
+    } else {
+        printf_debug("Created files are must not be deleted because snapshot %s is current and accepted is %s\n",last_snapshot_file->f_name, snapshot_file_for_accept->f_name);
+    }
+
+    if (snapshot_file_for_accept != common_ancestor) {
+        restore_files_from_snapshot(snapshot_file_for_accept, common_ancestor, last_snapshot_file);
+    }
+
+    *current_snapshot_file = sh_file_ref(snapshot_file_for_accept);
+
+    // create tmp snapshot
+
+    fs_create_tmp_snapshot();
+
+    // все изменённые файлы уже сброшены, осталось освобождённое в bitmap
+    // и ссылка на текущий снапшот
+
+    flush_bitmap();
+
+    flush_block(super);
+
+    return 0;
+}
+
+// Проверяет, создан ли файл name в каком-либо снапшоте ветки от
+// snapshot_file до ancestor. После сборки снапшота с несколькими
+// потомками одна запись о создании лежит в каждой из веток
+static bool
+sh_branch_created(struct File *snapshot_file, struct File *ancestor, const char *name) {
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+
+    for (struct File *snap = snapshot_file; snap != NULL && snap != ancestor; snap = sh_prev_snapshot(snap)) {
+        if (pure_file_read(snap, &header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
+            continue;
+        }
+
+        for (uint32_t n = 0; n < header.entries_size; ++n) {
+            if (sh_entry_read(snap, n, &entry) == 0 &&
+                    entry.se_type == SH_ENTRY_CREATED && strcmp(entry.se_name, name) == 0) {
+                return true;
+            }
+        }
     }
 
-    if (new_nblocks <= NDIRECT && f->f_indirect) {
-        free_block(f->f_indirect);
-        f->f_indirect = 0;
-    }
-}
+    return false;
+}
+
+// Удаляет файлы, созданные на пути от snapshot_file до ancestor.
+// Файлы, созданные и в ветке target, остаются: они есть в обеих ветках
+int
+delete_created_files_to_ancestor(struct File *snapshot_file, struct File *ancestor, struct File *target) {
+    printf_debug("Start deleting files that was created in snapshot %s\n", snapshot_file->f_name);
+
+    int read_header_result;
 
-/* Set the size of file f, truncating or extending as necessary. */
+    struct File *real_file; 
 
-int
-file_set_size(struct File *f, off_t newsize) {
-    printf_debug("Try to set new size %d for file %s\n", (int)newsize, f->f_name);
+    struct Snapshot_header snapshot_header;
 
-    // find file in snapshot
-    // if deleting -> delete real file
-    // if not found create copy
-    // then modify original and copy
+    if((read_header_result = pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of temporary snapshot\n");
+        return read_header_result;
+    }
 
-    struct File *tmp_file;
+    struct Snapshot_entry entry;
+    for (uint32_t n = 0; n < snapshot_header.entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+        // принятые из потока файлы создаются только при восстановлении
+        if (entry.se_type != SH_ENTRY_CREATED || !entry.se_file) {
+            continue;
+        }
 
-    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+        if (sh_branch_created(target, ancestor, entry.se_name)) {
+            printf_debug("File %s is also created in snapshot %s branch, kept\n", entry.se_name, target->f_name);
+            continue;
+        }
 
-    tmp_file = f;
+        real_file = sh_ref_file(entry.se_file);
 
-    if(resolve_file_for_write(&tmp_file, tmp_snapshot_file) != 0) {
-        return -E_INVAL;
+        printf_debug("File %s was deleted\n", real_file->f_name);
+
+        file_release(real_file);
     }
 
-    // todo remove from test set size
-    // if (tmp_file != f) {
-    //     f->f_size = newsize;
-    // }
+    if (sh_ref_file(snapshot_header.prev_snapshot) != ancestor) {
+        return delete_created_files_to_ancestor(sh_ref_file(snapshot_header.prev_snapshot), ancestor, target);
+    }
     
-    return pure_file_set_size(tmp_file, newsize);
+    return 0;
 }
 
 int
-pure_file_set_size(struct File *f, off_t newsize) {
-    printf_debug("Setting new size %d old size is %d, for file %s\n",(int)newsize, (int)f->f_size, f->f_name);
+delete_tmp_snapshot() {
+    // here tmp snapshot should be deleted (really deleted, not just flag update)
+    printf_debug("Start deleting temporary snapshot\n");
 
-    if (f->f_size > newsize)
-        file_truncate_blocks(f, newsize);
-    f->f_size = newsize;
-    flush_block(f);
-    return 0;
-}
+    int read_header_result, write_header_result;
 
-// int
-// file_set_size(struct File *f, off_t newsize) {
-//     if (f->f_size > newsize)
-//         file_truncate_blocks(f, newsize);
-//     f->f_size = newsize;
-//     flush_block(f);
-//     return 0;
-// }
+    struct File *snapshoted_file, *real_file, *prev_snapshot_file; 
 
-/* Flush the contents and metadata of file f out to disk.
- * Loop over all the blocks in file.
- * Translate the file block number into a disk block number
- * and then check whether that disk block is dirty.  If so, write it out. */
+    struct Snapshot_header tmp_snapshot_header, prev_snapshot_header;
 
-void
-file_flush(struct File *f) {
-    printf_debug("Start flushing file %s\n", f->f_name);
+    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
 
-    struct File *tmp_file;
+    if((read_header_result = pure_file_read(tmp_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of temporary snapshot\n");
+        return read_header_result;
+    }
 
-    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+    // удаляем все снэпшотированные и созданные файлы
+    struct Snapshot_entry entry;
+    for (uint32_t n = 0; n < tmp_snapshot_header.entries_size; ++n) {
+        if (sh_entry_read(tmp_snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
 
-    tmp_file = f;
+        if (entry.se_type == SH_ENTRY_MODIFIED) {
+            snapshoted_file = sh_ref_file(entry.se_file);
 
-    if(resolve_file_for_read(&tmp_file, tmp_snapshot_file) != 0) {
-        printf_debug("File %s cannot be flushed, because nothing was writen to it\n", f->f_name);
+            file_release(snapshoted_file);
+        } else if (entry.se_type == SH_ENTRY_CREATED) {
+            real_file = sh_ref_file(entry.se_file);
+
+            file_release(real_file);
+        }
     }
 
-    pure_file_flush(tmp_file);
-}
+    // удаляем ссылку в предыдущем снапшоте
+    prev_snapshot_file = sh_ref_file(tmp_snapshot_header.prev_snapshot);
 
-void
-pure_file_flush(struct File *f) {
-    blockno_t *pdiskbno;
+    if((read_header_result = pure_file_read(prev_snapshot_file, &prev_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of previous snapshot\n");
+        return read_header_result;
+    }
 
-    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
-        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-            pdiskbno == NULL || *pdiskbno == 0)
-            continue;
-        flush_block(diskaddr(*pdiskbno));
+    uint32_t child_entry;
+
+    if (sh_entry_find(prev_snapshot_file, &prev_snapshot_header, SH_ENTRY_CHILD, tmp_snapshot_file, &child_entry) != 0 ||
+            sh_entry_free(prev_snapshot_file, &prev_snapshot_header, child_entry) != 0) {
+        printf_debug("Cannot unlink temporary snapshot from previous snapshot\n");
+        return -E_INVAL;
     }
-    if (f->f_indirect)
-        flush_block(diskaddr(f->f_indirect));
-    flush_block(f);
-}
 
-/* Sync the entire file system.  A big hammer. */
-void
-fs_sync(void) {
-    for (int i = 1; i < super->s_nblocks; i++) {
-        flush_block(diskaddr(i));
+    if((write_header_result = pure_file_write(prev_snapshot_file, &prev_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot update header of previous snapshot\n");
+        return write_header_result;
     }
-}
 
+    pure_file_flush(prev_snapshot_file);
 
+    *current_snapshot_file = sh_file_ref(prev_snapshot_file);
 
-/********************** snapshot start ***************************************************************/
+    sh_node_remove(tmp_snapshot_file);
 
-/********************** utils start ******************************************************************/
+    file_release(tmp_snapshot_file);
 
-// выбирает правильный файл для чтения снапшотированных данных
-int
-resolve_file_for_read(struct File **pfile, struct File *snapshot_file) {
-    printf_debug("Resolving real file for read for %s with current snapshot %s\n", (*pfile)->f_name, snapshot_file->f_name);
+    return 0;
+}
 
-    struct File *file, *tmp_file;
-    struct Snapshot_header snapshot_header;
-    int counter;
+// Последний элемент пути
+static const char *
+sh_path_name(const char *path) {
+    const char *name = path;
 
-    file = *pfile;
+    for (; *path; ++path) {
+        if (*path == '/') {
+            name = path + 1;
+        }
+    }
 
-    if(pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
-        printf_debug("Header for snapshot %s cannot be readed\n", snapshot_file->f_name);
-        return -E_INVAL;
+    return name;
+}
+
+// Переносит копии файла, найденные по ссылке old (или, для принятых
+// копий без оригинала, по имени name), на ссылку new во всех снапшотах
+// поддерева snapshot_file. Нужно, когда файл воссоздан в другом слоте
+static int
+sh_rekey_copies(struct File *snapshot_file, fileref_t old, fileref_t new, const char *name) {
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+    bool changed = false;
+    int res;
+
+    if ((res = pure_file_read(snapshot_file, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        return res < 0 ? res : -E_INVAL;
     }
 
-    counter = 0;
-    tmp_file = (struct File *) snapshot_header.modified_files[counter];
+    for (uint32_t n = 0; n < header.entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
 
-    while(tmp_file != 0) {
-        printf_debug("Checking file %s from snapshot %s\n", tmp_file->f_name, snapshot_file->f_name);
+        if (entry.se_type == SH_ENTRY_CHILD) {
+            if ((res = sh_rekey_copies(sh_ref_file(entry.se_file), old, new, name)) != 0) {
+                return res;
+            }
+            continue;
+        }
 
-        if (strcmp_snapshoted(tmp_file->f_name, file->f_name) == 0) {
-            printf_debug("File for read %s founded in snapshot %s and have name %s\n", file->f_name, snapshot_file->f_name, tmp_file->f_name);
+        if (entry.se_type != SH_ENTRY_MODIFIED || entry.se_orig != old ||
+                (old == 0 && strcmp(entry.se_name, name) != 0)) {
+            continue;
+        }
 
-            *pfile = tmp_file;
-            
-            return 0;
+        // запись освобождается и сразу занимает то же место в другой цепочке
+        if ((res = sh_entry_free(snapshot_file, &header, n)) != 0) {
+            return res;
         }
 
-        ++counter;
-        tmp_file = (struct File *) snapshot_header.modified_files[counter];
+        entry.se_orig = new;
+        entry.se_hash = sh_ref_hash(new);
+
+        if ((res = sh_entry_add(snapshot_file, &header, &entry)) != 0) {
+            return res;
+        }
+        changed = true;
     }
 
-    if (snapshot_header.prev_snapshot != 0) {
-        return resolve_file_for_read(pfile, (struct File *)snapshot_header.prev_snapshot);
-    } else {
-        printf_debug("File %s for read not founded in current snapshot\n", file->f_name);
-        return 0;
+    if (changed && (res = pure_file_write(snapshot_file, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        return res < 0 ? res : -E_INVAL;
     }
+
+    return 0;
 }
 
+// Воссоздаёт файлы, созданные на пути от snapshot_file до ancestor.
+// Файлы, оставленные при удалении ветки source, не пересоздаются
 int
-resolve_file_for_write(struct File **pfile, struct File *snapshot_file) {
-    printf_debug("Resolving real file for wtite for %s with current snapshot %s\n", (*pfile)->f_name, snapshot_file->f_name);
+restore_files_from_snapshot(struct File *snapshot_file, struct File *ancestor, struct File *source) {
+    printf_debug("Start restoring files from snapshot %s\n", snapshot_file->f_name);
 
-    struct File *file, *tmp_file;
-    struct Snapshot_header snapshot_header;
-    int counter, res;
+    int read_header_result, write_entry_result, restore_files_from_snapshot_result, pure_file_create_result;
 
-    file = *pfile;
+    struct File *real_file; 
 
-    if(pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
-        printf_debug("Cannot read header for snapshot %s to resolve file %s for write\n", snapshot_file->f_name, (*pfile)->f_name);
-        return -E_INVAL;
-    }
+    struct Snapshot_header snapshot_header;
 
-    counter = 0;
-    tmp_file = (struct File *) snapshot_header.modified_files[counter];
+    if((read_header_result = pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", snapshot_file->f_name);
+        return read_header_result;
+    }
 
-    while(tmp_file != 0) {
-        printf_debug("Checking file %s from snapshot %s\n", tmp_file->f_name, snapshot_file->f_name);
+    if (sh_ref_file(snapshot_header.prev_snapshot) != ancestor) {
+    
+        restore_files_from_snapshot_result = restore_files_from_snapshot(sh_ref_file(snapshot_header.prev_snapshot), ancestor, source);
 
-        if (strcmp_snapshoted(tmp_file->f_name, file->f_name) == 0) {
-            printf_debug("File for write %s founded in snapshot %s and have name %s\n", file->f_name, snapshot_file->f_name, tmp_file->f_name);
+        if (restore_files_from_snapshot_result != 0) {
+            printf_debug("Cannot restore files from snapshot %s\n", sh_ref_file(snapshot_header.prev_snapshot)->f_name);
+            return restore_files_from_snapshot_result;
+        }
+    }
 
-            *pfile = tmp_file;
-            
-            return 0;
+    struct Snapshot_entry entry;
+    for (uint32_t n = 0; n < snapshot_header.entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+        if (entry.se_type != SH_ENTRY_CREATED) {
+            continue;
         }
 
-        ++counter;
-        tmp_file = (struct File *) snapshot_header.modified_files[counter];
-    }
-    
-    printf_debug("File %s not founded in current snapshot, it must be created\n", file->f_name);
+        if (sh_branch_created(source, ancestor, entry.se_name) && file_open(entry.se_name, &real_file) == 0) {
+            printf_debug("File %s from snapshot %s kept from snapshot %s\n", entry.se_name, snapshot_file->f_name, source->f_name);
+            pure_file_create_result = 0;
+        } else {
+            pure_file_create_result = pure_file_create_at(entry.se_name, entry.se_file, &real_file);
+        }
 
-    if((res = resolve_file_for_read(pfile, snapshot_file)) < 0) {
-        printf_debug("File for write %s cannot be resolved because file for read %s cannot be found in %s\n",file->f_name, file->f_name, snapshot_file->f_name);
-        return res;
-    }
+        if (pure_file_create_result == 0)  {
+            printf_debug("File %s from snapshot %s restored\n", entry.se_name, snapshot_file->f_name);
+        } else if (pure_file_create_result == -E_FILE_EXISTS){
+            printf_debug("File %s from snapshot %s already exist, should not happen\n", entry.se_name, snapshot_file->f_name);
+            return pure_file_create_result;
+        } else {
+            printf_debug("File %s from snapshot %s cannot be created\n", entry.se_name, snapshot_file->f_name);
+            return pure_file_create_result;
+        }
 
-    struct File *pfile_for_write;
+        // копии файла в снапшотах ниже ищутся по прежней ссылке
+        if (entry.se_file != sh_file_ref(real_file) &&
+                (write_entry_result = sh_rekey_copies(snapshot_file, entry.se_file, sh_file_ref(real_file), sh_path_name(entry.se_name))) != 0) {
+            printf_debug("Cannot move copies of file %s in snapshot %s\n", entry.se_name, snapshot_file->f_name);
+            return write_entry_result;
+        }
 
-    if((res = create_and_copy(&pfile_for_write, pfile)) != (*pfile)->f_size) {
-        printf_debug("File %s for write cannot be CAC: error code %d\n", file->f_name, res);
-        return res;
-    }
+        // тип сохранён в записи: без него каталог вернулся бы обычным файлом
+        real_file->f_type = entry.se_ftype;
+        flush_block(real_file);
 
-    *pfile = pfile_for_write;
+        entry.se_file = sh_file_ref(real_file);
 
-    snapshot_header.modified_files[counter] = (uint64_t) pfile_for_write;
+        if ((write_entry_result = sh_entry_write(snapshot_file, n, &entry)) != 0) {
+            printf_debug("Cannot update entry of snapshot %s\n", snapshot_file->f_name);
+            return write_entry_result;
+        }
 
-    if(pure_file_write(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
-        printf_debug("Cannot write header for snapshot %s after resolving file %s for write\n", snapshot_file->f_name, file->f_name);
-        return -E_INVAL;
+        printf_debug("File %s was restored\n", real_file->f_name);
     }
 
     pure_file_flush(snapshot_file);
@@ -981,632 +3376,856 @@ resolve_file_for_write(struct File **pfile, struct File *snapshot_file) {
     return 0;
 }
 
-static int
-strcmp_snapshoted(char *sfile_name, char *file_name) {
-    char *pseparator = strfind(sfile_name + 1, SNAPFILESEP[0]);
-
-    int separator_position = pseparator - sfile_name;
-
-    return strncmp(sfile_name, file_name, separator_position);
-}
-
-
-
-int 
-create_and_copy(struct File **dstfile, struct File **srcfile) {
-
-    printf_debug("Start CAC for file %s\n", (*srcfile)->f_name);
+//Удаляет снимок по имени.
+int
+fs_delete_snapshot(const char *name) {
 
-    off_t offset = 0;
-    off_t cac_range = (*srcfile)->f_size; 
+    printf_debug("Start deleting snapshot with name %s\n", name);
 
-    uint32_t bn;
+    int file_search_result, header_read_result, header_write_result;
+    
+    struct File *translated_root_snapshot_file,*snapshot_file_for_delete;
 
-    off_t position_in_file;
+    translated_root_snapshot_file = to_file(root_snapshot_file);
 
-    int file_create_result, src_get_block_result, dst_get_block_result, file_set_size_result;
+    snapshot_file_for_delete = translated_root_snapshot_file;
 
-    char *src_file_block, *dst_file_block;
+    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_delete)) == -E_NOT_FOUND) {
+        cprintf("Snapshot with name %s does not exist\n", name);
+        return file_search_result;
+    } else if(file_search_result != 0) {
+        cprintf("Unknown error during seraching snapshot with name %s\n", name);
+        return file_search_result;
+    }
 
-    char *current_snapshot_name = to_file(current_snapshot_file)->f_name;
+    printf_debug("Found snapshot with name %s\n", snapshot_file_for_delete->f_name);
 
-    snapshoted_file_name(snapshoted_file_name, (*srcfile)->f_name, current_snapshot_name);
-    
-    file_create_result = pure_file_create(snapshoted_file_name, dstfile);
+    resolve_cache_invalidate();
+    dentry_cache_invalidate();
 
-    if (file_create_result == -E_FILE_EXISTS) {
-        printf_debug("File for snapshoted file %s already exist\n", snapshoted_file_name);
-        return file_create_result;
-    } else if(file_create_result == -E_NOT_FOUND) {
-        printf_debug("Directory for snapshoted file %s not found\n", snapshoted_file_name);
-        return file_create_result;
-    } else if(file_create_result < 0) {
-        printf_debug("File for snapshoted file %s cannot be created: error code %d\n", snapshoted_file_name, file_create_result);
-        return file_create_result;
-    }
+    struct Snapshot_header header_for_delete;
 
-    if ((*srcfile)->f_size > (*dstfile)->f_size) {
-        if ((file_set_size_result = pure_file_set_size(*dstfile, (*srcfile)->f_size)) < 0) {
-            printf_debug("Cannot set new size for file %s in CAC from file %s\n", (*dstfile)->f_name, (*srcfile)->f_name);
-            return file_set_size_result;
-        }
+    if((header_read_result = pure_file_read(snapshot_file_for_delete, &header_for_delete, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Snapshot's %s header that must be deleted cannot be readed\n", snapshot_file_for_delete->f_name);
+        return header_read_result;
     }
 
-    for (position_in_file = offset; position_in_file < cac_range;) {
+    header_for_delete.is_deleted = true;
 
-        // Читаем нужный блок для копированния
-        if ((src_get_block_result = file_get_block(*srcfile, position_in_file / BLKSIZE, &src_file_block)) < 0) {
-            printf_debug("Cannot get block for file %s at pos %d with block number %lld\n", (*srcfile)->f_name, position_in_file, position_in_file / BLKSIZE);
-            return src_get_block_result;
-        }
+    if ((header_write_result = pure_file_write(snapshot_file_for_delete, &header_for_delete, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Snapshot's %s header that must be deleted cannot be updated\n", snapshot_file_for_delete->f_name);
+        return header_write_result;
+    }
 
-        // Читаем новый блок для записи
-        if ((dst_get_block_result = file_get_block(*dstfile, position_in_file / BLKSIZE, &dst_file_block)) < 0) {
-            printf_debug("Cannot get block for file %s at pos %d with block number %lld\n", (*dstfile)->f_name, position_in_file, position_in_file / BLKSIZE);
-            return src_get_block_result;
-        }
+    printf_debug("Deleted snapshot %s header updated\n", snapshot_file_for_delete->f_name);
 
-        bn = MIN(BLKSIZE - position_in_file % BLKSIZE, (*srcfile)->f_size - position_in_file);
+    struct Snapshot_node *node = sh_node_find(snapshot_file_for_delete);
+    if (node != NULL) {
+        node->sn_deleted = true;
+    }
 
-        memmove(dst_file_block + position_in_file % BLKSIZE , src_file_block + position_in_file % BLKSIZE, bn);
-        position_in_file += bn;
+    char time_stamp_int_string[MAXNAMELEN];
+    
+    if (itoa(header_for_delete.date, time_stamp_int_string, MAXNAMELEN, 10) != 0) {
+        printf_debug("Cannot convert timestamp to string: %d\n", header_for_delete.date);
+        return -E_INVAL;
     }
 
-    printf_debug("CAC for file %s ends, file with name %s created and filed\n", (*srcfile)->f_name, (*dstfile)->f_name);
+    strcat(snapshot_file_for_delete->f_name, time_stamp_int_string);
+    sh_file_renamed(snapshot_file_for_delete);
 
-    return cac_range - offset;
-}
+    printf_debug("Start renaming files from deleted snapshot\n");
 
-/********************** utils end   ******************************************************************/
+    struct Snapshot_entry entry;
+    struct File *buffer_snapshoted_file;
+    for (uint32_t n = 0; n < header_for_delete.entries_size; ++n) {
+        if (sh_entry_read(snapshot_file_for_delete, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+        if (entry.se_type != SH_ENTRY_MODIFIED) {
+            continue;
+        }
+    
+        buffer_snapshoted_file = sh_ref_file(entry.se_file);
 
-/********************** logic start ******************************************************************/
+        printf_debug("Updating file name for %s\n", buffer_snapshoted_file->f_name);
 
+        strcat(buffer_snapshoted_file->f_name, time_stamp_int_string);
+        sh_file_renamed(buffer_snapshoted_file);
 
+        printf_debug("Updated file name for %s\n", buffer_snapshoted_file->f_name);
+    }
+    
+    printf_debug("Deleted snapshot file name updated: %s\n", snapshot_file_for_delete->f_name);
 
-/********************** logic end   ******************************************************************/
+    pure_file_flush(snapshot_file_for_delete);
+    
+    return 0;
+}
 
-/************************ functions start ************************************************************/
-int fs_create_tmp_snapshot() {
-    printf_debug("Start creatin temporary snapshot file\n");
+int
+find_snapshot_file_by_name(const char *name, struct File *root_snapshot_file, struct File **psnapshot_file) {
 
-    struct File *tmp_snapshot_file, *actual_snapshot_file; //*buffer_snapshot_file;
+    struct File *buffer_snapshot_file;
+    struct Snapshot_header snapshot_header, buffer_snapshot_header;
 
-    struct Snapshot_header actual_snapshot_header;// buffer_snapshot_header;
+    int header_read_result, internal_search_result;
 
-    int file_create_result, header_write_result, header_read_result, alloc_block_result, cfg_read_result, cfg_write_result;
+    // дерево в памяти: ищем среди потомков без чтения заголовков
+    if (sh_node_find(root_snapshot_file) != NULL) {
+        for (int i = 0; i < sh_nodes_count; ++i) {
+            buffer_snapshot_file = sh_nodes[i].sn_file;
 
-    char * addr;
+            if (sh_nodes[i].sn_deleted ||
+                    buffer_snapshot_file == to_file(current_snapshot_file) ||
+                    strcmp(buffer_snapshot_file->f_name, name) != 0) {
+                continue;
+            }
 
-    snapshot_name(tmp_snap_name, TMPSNAP);
+            for (struct File *parent = sh_nodes[i].sn_parent; parent != NULL; parent = sh_prev_snapshot(parent)) {
+                if (parent == root_snapshot_file) {
+                    *psnapshot_file = buffer_snapshot_file;
+                    return 0;
+                }
+            }
+        }
 
-    file_create_result = pure_file_create(tmp_snap_name, &tmp_snapshot_file);
+        return -E_NOT_FOUND;
+    }
 
-    if (file_create_result == -E_FILE_EXISTS) {
-        printf_debug("File for temporary snapshot already exist\n");
-        return file_create_result;
-    } else if(file_create_result == -E_NOT_FOUND) {
-        printf_debug("Directory for file for snapshot not found\n");
-        return file_create_result;
-    } else if(file_create_result < 0) {
-        printf_debug("Temporary file for snapshot cannot be created: error code %d\n", file_create_result);
-        return file_create_result;
+    if((header_read_result = pure_file_read(root_snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot find snapshot by name, because cannot read header for snapshot %s\n", root_snapshot_file->f_name);
+        return header_read_result;
     }
 
-    printf_debug("Temporary snapshot file created\n");
+    struct Snapshot_entry entry;
 
-    actual_snapshot_file = to_file(current_snapshot_file);
+    for (uint32_t n = 0; n < snapshot_header.entries_size; ++n) {
+        if (sh_entry_read(root_snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+        if (entry.se_type != SH_ENTRY_CHILD) {
+            continue;
+        }
 
-    if ((header_read_result = pure_file_read(actual_snapshot_file, &actual_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Current snapshot header cannot be readed: error code %d\n", header_read_result);
-        return header_read_result;
-    } else {
-        printf_debug("Current snapshot header readed\n");
-    }
+        buffer_snapshot_file = sh_ref_file(entry.se_file);
 
-    struct Snapshot_header tmp_snapshot_header = {
-        .comment = "",
-        .date = 0,
-        .is_deleted = false,
-        .prev_snapshot = (uint64_t)actual_snapshot_file};
+        if((header_read_result = pure_file_read(buffer_snapshot_file, &buffer_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+            printf_debug("Cannot find snapshot by name, because cannot read header for snapshot %s\n", buffer_snapshot_file->f_name);
+            return header_read_result;
+        }
 
-    // А надо ли это делать???
-    int counter = 0;
-    while(actual_snapshot_header.next_snapshot[counter] != 0) {
+        if (!buffer_snapshot_header.is_deleted && 
+                strcmp(buffer_snapshot_file->f_name, name) == 0 && 
+                buffer_snapshot_file != to_file(current_snapshot_file)) {
 
-        // buffer_snapshot_file = (struct File *) actual_snapshot_header.next_snapshot[counter];
+                    *psnapshot_file = buffer_snapshot_file;
 
-        // tmp_snapshot_header.next_snapshot[counter] = actual_snapshot_header.next_snapshot[counter];
+                    return 0;
+        } else if ((internal_search_result = find_snapshot_file_by_name(name, buffer_snapshot_file, psnapshot_file)) == 0){
+            return 0;
+        }
+    }
 
-        // if ((header_read_result = pure_file_read(buffer_snapshot_file, &buffer_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        //     printf_debug("Next snapshot header cannot be readed: error code %d\n", header_read_result);
-        //     return header_read_result;
-        // } else {
-        //     printf_debug("Next snapshot header readed\n");
-        // }        
+    return -E_NOT_FOUND;
+}
 
-        // buffer_snapshot_header.prev_snapshot = (uint64_t) tmp_snapshot_file;
 
-        // if ((header_write_result = pure_file_write(tmp_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        //     printf_debug("Next snapshot header cannot be updated\n");
-        //     return header_write_result;
-        // } else {
-        //     printf_debug("Next snapshot header updated\n");
-        // }
+// Освобождает копию файла из удаляемого снапшота. Блоки, на которые
+// ещё ссылаются копии у потомков, остаются за ними
+static void
+sh_gc_release_copy(struct File *copy) {
+    file_release(copy);
+}
 
-        // pure_file_flush(buffer_snapshot_file);
+// Удаляет файл снапшота и отвязывает его от предыдущего
+static int
+sh_gc_remove_snapshot_file(struct File *snapshot_file, struct Snapshot_header *header) {
+    struct File *prev_snapshot_file = sh_ref_file(header->prev_snapshot);
+    struct Snapshot_header prev_header;
+    uint32_t child_entry;
+    int res;
 
-        ++counter;
+    if ((res = pure_file_read(prev_snapshot_file, &prev_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", prev_snapshot_file->f_name);
+        return res < 0 ? res : -E_INVAL;
     }
 
-    actual_snapshot_header.next_snapshot[counter] = (uint64_t) tmp_snapshot_file;
+    if ((res = sh_entry_find(prev_snapshot_file, &prev_header, SH_ENTRY_CHILD, snapshot_file, &child_entry)) != 0 ||
+            (res = sh_entry_free(prev_snapshot_file, &prev_header, child_entry)) != 0) {
+        printf_debug("Cannot unlink snapshot %s from %s\n", snapshot_file->f_name, prev_snapshot_file->f_name);
+        return res;
+    }
 
-    if ((header_write_result = pure_file_write(actual_snapshot_file, &actual_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Current snapshot header cannot be updated\n");
-        return header_write_result;
-    } else {
-        printf_debug("Current snapshot header updated\n");
+    if ((res = pure_file_write(prev_snapshot_file, &prev_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        return res < 0 ? res : -E_INVAL;
     }
 
-    pure_file_flush(actual_snapshot_file);
+    pure_file_flush(prev_snapshot_file);
 
-    if ((alloc_block_result = alloc_block()) == 0) {
-        panic("Out of memory! Temporary snapshot cannot be created \n");
+    sh_node_remove(snapshot_file);
+
+    if (header->old_bitmap) {
+        free_block(header->old_bitmap);
     }
 
-    printf_debug("Old bitmap block for temporary snapshot is alloced\n");
+    file_release(snapshot_file);
 
-    tmp_snapshot_header.old_bitmap = alloc_block_result;
-    addr = diskaddr(alloc_block_result);
-    memcpy(addr, diskaddr(1), BLKSIZE);
-    flush_block(addr);
+    return 0;
+}
 
-    printf_debug("Temporary snapshot old bitmap block flushed\n");
-    
-    if ((header_write_result = pure_file_write(tmp_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Temporary snapshot cannot be inited\n");
-        return header_write_result;
-    } else {
-        printf_debug("Temporary snapshot inited\n");
+// Переносит данные удалённого снапшота в его потомка и привязывает
+// потомка к предыдущему снапшоту. Копии, которых у потомка нет,
+// клонируются: клон ссылается на те же блоки
+static int
+sh_gc_merge_into_child(struct File *snapshot_file, struct Snapshot_header *header, struct File *child) {
+    struct Snapshot_header child_header, prev_header;
+    struct Snapshot_entry entry;
+    struct File *copy, *child_copy, *prev_snapshot_file;
+    int res;
+
+    printf_debug("Merging deleted snapshot %s into %s\n", snapshot_file->f_name, child->f_name);
+
+    if ((res = pure_file_read(child, &child_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", child->f_name);
+        return res < 0 ? res : -E_INVAL;
     }
 
-    pure_file_flush(tmp_snapshot_file);
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
 
-    *current_snapshot_file = (uint64_t) tmp_snapshot_file;
+        if (entry.se_type == SH_ENTRY_MODIFIED) {
+            copy = sh_ref_file(entry.se_file);
 
-    printf_debug("Start snapshot cfg update after temporary snapshot created\n");
+            if (sh_index_lookup(child, entry.se_orig, entry.se_name, &child_copy) == 0) {
+                // у потомка своя версия файла
+                continue;
+            }
 
-    struct Snapshot_config cfg;
+            snapshoted_file_name(clone_name, entry.se_name, entry.se_orig, child->f_name);
 
-    if((cfg_read_result = pure_file_read(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS)) != sizeof(struct Snapshot_config)) {
-        printf_debug("Snapshot config cannot be readed\n");
-        return cfg_read_result;
-    } else {
-        printf_debug("Snapshot config readed\n");
-    }
+            if ((res = pure_file_create(clone_name, &child_copy)) < 0) {
+                printf_debug("Copy %s cannot be created: error code %d\n", clone_name, res);
+                return res;
+            }
 
-    strcpy(cfg.current_snapshot_name, tmp_snapshot_file->f_name);
+            if ((res = file_share_blocks(child_copy, copy)) < 0) {
+                file_release(child_copy);
+                return res;
+            }
 
-    if((cfg_write_result = pure_file_write(to_file(snapshot_config_file), &cfg, sizeof(struct Snapshot_config), HEADERPOS)) != sizeof(struct Snapshot_config)) {
-        printf_debug("Snapshot config cannot be updated\n");
-        return cfg_write_result;
-    } else {
-        printf_debug("Snapshot config updated\n");
+            entry.se_file = sh_file_ref(child_copy);
+        } else if (entry.se_type != SH_ENTRY_CREATED) {
+            continue;
+        }
+
+        if ((res = sh_entry_add(child, &child_header, &entry)) != 0) {
+            printf_debug("Cannot move entry of snapshot %s to %s\n", snapshot_file->f_name, child->f_name);
+            return res;
+        }
     }
 
-    pure_file_flush(to_file(snapshot_config_file));
+    child_header.prev_snapshot = header->prev_snapshot;
 
-    printf_debug("Temporary snapshot created\n");
+    if ((res = pure_file_write(child, &child_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot update header of snapshot %s\n", child->f_name);
+        return res < 0 ? res : -E_INVAL;
+    }
 
-    return 0;
-}
+    pure_file_flush(child);
 
-int fs_create_snapshot(const char * comment, const char * name) {
-    
-    printf_debug("Start creating snapshot with name: %s; and comment: %s!\n", name, comment);
+    // привязываем потомка к предыдущему снапшоту
+    prev_snapshot_file = sh_ref_file(header->prev_snapshot);
 
-    int file_search_result, read_header_result, write_header_result;
+    if ((res = pure_file_read(prev_snapshot_file, &prev_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", prev_snapshot_file->f_name);
+        return res < 0 ? res : -E_INVAL;
+    }
 
-    struct Snapshot_header new_snapshot_header;
+    struct Snapshot_entry child_entry = {
+        .se_type = SH_ENTRY_CHILD,
+        .se_file = sh_file_ref(child)};
 
-    struct File *translated_root_snapshot_file,*snapshot_file_for_delete;
-    translated_root_snapshot_file = to_file(root_snapshot_file);
-    snapshot_file_for_delete = translated_root_snapshot_file;
-    
-    // проверить а нет ли уже снапшотов с таким именем
-    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_delete)) != -E_NOT_FOUND) {
-        printf_debug("Cannot create snapshot with name %s because it's already exist\n", name);
-        cprintf("Snapshot with name %s already exist\n", name);
-        return file_search_result;
+    if ((res = sh_entry_add(prev_snapshot_file, &prev_header, &child_entry)) != 0) {
+        printf_debug("Snapshot %s cannot be linked to %s\n", child->f_name, prev_snapshot_file->f_name);
+        return res;
     }
 
-    struct File *new_snapshot_file = to_file(current_snapshot_file);
-
-    strcpy(new_snapshot_file->f_name, name);
+    if ((res = pure_file_write(prev_snapshot_file, &prev_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        return res < 0 ? res : -E_INVAL;
+    }
 
-    printf_debug("New snapshot file name updated, now is %s\n", new_snapshot_file->f_name);
+    pure_file_flush(prev_snapshot_file);
 
-    if((read_header_result = pure_file_read(new_snapshot_file, &new_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot create new snapshot, because current snapshot header cannot be readed\n");
-        return read_header_result;
+    struct Snapshot_node *node = sh_node_find(child);
+    if (node != NULL) {
+        node->sn_parent = prev_snapshot_file;
     }
 
-    printf_debug("New snapshot file header readed\n");
+    return 0;
+}
 
-    strcpy(new_snapshot_header.comment, comment);
+// Собирает удалённый снапшот: его данные переходят к потомкам,
+// после чего сам снапшот и его копии освобождаются
+static int
+sh_gc_collect_snapshot(struct File *snapshot_file, struct Snapshot_header *header) {
+    struct Snapshot_entry entry;
+    int res;
 
-    new_snapshot_header.date = sys_gettime();
+    printf_debug("Collecting deleted snapshot %s\n", snapshot_file->f_name);
 
-    if((write_header_result = pure_file_write(new_snapshot_file, &new_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot create new snapshot, because current snapshot header cannot be updated\n");
-        return write_header_result;
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+
+        if (entry.se_type == SH_ENTRY_CHILD &&
+                (res = sh_gc_merge_into_child(snapshot_file, header, sh_ref_file(entry.se_file))) != 0) {
+            return res;
+        }
     }
 
-    printf_debug("New snapshot file header was written\n");
+    // созданные в снапшоте файлы остаются: они либо перешли к потомкам,
+    // либо уже удалены при переключении на другую ветку
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
 
-    // rename files for tmp snapshots
+        if (entry.se_type == SH_ENTRY_MODIFIED) {
+            sh_gc_release_copy(sh_ref_file(entry.se_file));
+        }
+    }
 
-    printf_debug("Start renaming files from deleted snapshot\n");
-    
-    int counter = 0;
-    struct File *buffer_snapshoted_file;
-    while(new_snapshot_header.modified_files[counter] != 0) {
-    
-        buffer_snapshoted_file = (struct File *) new_snapshot_header.modified_files[counter];
+    return sh_gc_remove_snapshot_file(snapshot_file, header);
+}
 
-        printf_debug("Updating file name for %s\n", buffer_snapshoted_file->f_name);
+// Обходит дерево снизу вверх и собирает удалённые снапшоты
+static int
+sh_gc_walk(struct File *snapshot_file) {
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+    int res;
 
-        // переименновываем файлы временного снэпшота в постоянный
-        char *pseparator = strfind(buffer_snapshoted_file->f_name, SNAPFILESEP[0]);
-        ++pseparator;
-        *pseparator = '\0';
+    for (uint32_t n = 0;; ++n) {
+        // заголовок перечитывается: сборка потомка меняет наши записи
+        if ((res = pure_file_read(snapshot_file, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+            printf_debug("Cannot read header of snapshot %s\n", snapshot_file->f_name);
+            return res < 0 ? res : -E_INVAL;
+        }
 
-        strcat(buffer_snapshoted_file->f_name, new_snapshot_file->f_name);
+        if (n >= header.entries_size) {
+            break;
+        }
 
-        printf_debug("Updated file name for %s\n", buffer_snapshoted_file->f_name);
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
 
-        ++counter;
+        if (entry.se_type == SH_ENTRY_CHILD && (res = sh_gc_walk(sh_ref_file(entry.se_file))) != 0) {
+            return res;
+        }
     }
-    
-    printf_debug("Deleted snapshot file name updated: %s\n", snapshot_file_for_delete->f_name);
-
-    file_flush(new_snapshot_file);
 
-    fs_create_tmp_snapshot();
+    if (!header.is_deleted || snapshot_file == to_file(root_snapshot_file) || snapshot_file == to_file(current_snapshot_file)) {
+        return 0;
+    }
 
-    return 0;
+    return sh_gc_collect_snapshot(snapshot_file, &header);
 }
 
+// Собирает удалённые снапшоты и возвращает число освобождённых байт
 int
-fs_accept_snapshot(const char *name) {
+fs_gc_snapshots() {
+    printf_debug("Start snapshot garbage collection\n");
 
-    printf_debug("Try to accept snapshot with name %s\n", name);
+    int free_blocks_before = df_count_free_blocks();
+    int res;
 
-    int file_search_result;//, header_read_result, header_write_result;
-    
-    struct File *translated_root_snapshot_file,*snapshot_file_for_accept;
+    resolve_cache_invalidate();
+    dentry_cache_invalidate();
 
-    // here we should find snapshot by name
+    res = sh_gc_walk(to_file(root_snapshot_file));
 
-    translated_root_snapshot_file = to_file(root_snapshot_file);
+    flush_bitmap();
 
-    snapshot_file_for_accept = translated_root_snapshot_file;
+    if (res != 0) {
+        printf_debug("Snapshot garbage collection failed: error code %d\n", res);
+        return res;
+    }
 
-    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_accept)) == -E_NOT_FOUND) {
-        cprintf("Snapshot with name %s does not exist\n", name);
-        return file_search_result;
-    } else if(file_search_result != 0) {
-        cprintf("Unknown error during seraching snapshot with name %s\n", name);
-        return file_search_result;
+    return (df_count_free_blocks() - free_blocks_before) * BLKSIZE;
+}
+
+// Ищет версию файла orig с именем name, видимую в снапшоте: ближайшую
+// копию по цепочке предыдущих снапшотов, иначе сам файл. *pbelow
+// выставляется, если копия лежит ниже снапшота ancestor
+static struct File *
+sh_diff_version(struct File *snapshot_file, struct File *ancestor, fileref_t orig, const char *name, bool *pbelow) {
+    struct File *found;
+    bool below = true;
+
+    for (struct File *snap = snapshot_file; snap != NULL; snap = sh_prev_snapshot(snap)) {
+        if (snap == ancestor) {
+            below = false;
+        }
+
+        if (sh_index_lookup(snap, orig, name, &found) == 0) {
+            *pbelow = below;
+            return found;
+        }
     }
 
-    printf_debug("Found snapshot with name %s\n", snapshot_file_for_accept->f_name);
+    *pbelow = false;
 
-    // delete tmp snapshot (and all files)
+    if (orig == 0) {
+        return file_open(name, &found) == 0 ? found : NULL;
+    }
 
-    delete_tmp_snapshot();
+    // оригинал мог быть удалён при переключении на другую ветку
+    found = sh_ref_file(orig);
 
-    // if exist must make it current (create all files that should be create, delete all that should not be created)
-    // deleting files should be done by undo all creation too root 
+    return found != NULL && strcmp(found->f_name, name) == 0 ? found : NULL;
+}
 
-    struct File *last_snapshot_file = to_file(current_snapshot_file);
+// Номер блока файла или 0, если блока нет
+static blockno_t
+sh_diff_block(struct File *file, blockno_t filebno) {
+    blockno_t diskbno;
 
-    if (last_snapshot_file != snapshot_file_for_accept && last_snapshot_file != to_file(root_snapshot_file)) {
-        delete_created_files_to_root(last_snapshot_file);
-    } else {
-        printf_debug("Created files are must not be deleted because snapshot %s is current and accepted is %s\n",last_snapshot_file->f_name, snapshot_file_for_accept->f_name);
+    if (file == NULL || filebno >= CEILDIV(file->f_size, BLKSIZE) ||
+            file_map_block(file, filebno, &diskbno) < 0) {
+        return 0;
     }
 
-    // creation should be done by creation all files from root to new current snapshot
+    return diskbno;
+}
 
+// Сравнивает снапшоты from и to по метаданным: обходятся только снапшоты
+// между ними и их общим предком, а версии файлов сравниваются по номерам
+// блоков, общие блоки не читаются. Записывает не более max_records записей
+// и продвигает курсор; возвращает число записей
+int
+fs_diff_snapshots(const char *from, const char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records, int max_records) {
+    printf_debug("Diff of snapshots %s and %s\n", from, to);
+
+    struct File *from_snapshot, *to_snapshot, *ancestor, *snap, *copy, *from_version, *to_version;
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+    bool to_side, from_below, to_below;
+    int count = 0, res;
+
+    if ((res = find_snapshot_file_by_name(from, to_file(root_snapshot_file), &from_snapshot)) != 0 ||
+            (res = find_snapshot_file_by_name(to, to_file(root_snapshot_file), &to_snapshot)) != 0) {
+        printf_debug("Snapshot for diff not found\n");
+        return res;
+    }
 
-    if (last_snapshot_file != snapshot_file_for_accept) {
-        restore_files_from_snapshot(snapshot_file_for_accept);
+    if (cursor->dc_done) {
+        return 0;
     }
 
-    *current_snapshot_file = (uint64_t) snapshot_file_for_accept;
+    ancestor = sh_common_ancestor(from_snapshot, to_snapshot);
 
-    // create tmp snapshot
+    // сначала обходится путь от to до предка, затем от from
+    to_side = true;
+    snap = to_snapshot;
 
-    fs_create_tmp_snapshot();
+    if (cursor->dc_snapshot) {
+        snap = sh_ref_file(cursor->dc_snapshot);
 
-    // sync fs
+        to_side = false;
+        for (struct File *s = to_snapshot; s != ancestor && s != NULL; s = sh_prev_snapshot(s)) {
+            if (s == snap) {
+                to_side = true;
+            }
+        }
+    }
 
-    fs_sync();
+    for (;;) {
+        if (snap == ancestor && to_side) {
+            to_side = false;
+            snap = from_snapshot;
+            cursor->dc_entry = cursor->dc_block = 0;
+        }
 
-    return 1;
-}
+        if (snap == ancestor || snap == NULL) {
+            cursor->dc_done = true;
+            return count;
+        }
 
-int
-delete_created_files_to_root(struct File *snapshot_file) {
-    printf_debug("Start deleting files that was created in snapshot %s\n", snapshot_file->f_name);
+        cursor->dc_snapshot = sh_file_ref(snap);
 
-    int read_header_result;
+        if ((res = pure_file_read(snap, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+            printf_debug("Cannot read header of snapshot %s\n", snap->f_name);
+            return res < 0 ? res : -E_INVAL;
+        }
+
+        for (; cursor->dc_entry < header.entries_size; ++cursor->dc_entry, cursor->dc_block = 0) {
+            if (sh_entry_read(snap, cursor->dc_entry, &entry) != 0) {
+                return -E_INVAL;
+            }
 
-    struct File *real_file; 
+            if (entry.se_type == SH_ENTRY_CREATED) {
+                if (count == max_records) {
+                    return count;
+                }
+
+                strcpy(records[count].dr_name, entry.se_name);
+                records[count].dr_file = entry.se_file;
+                records[count].dr_type = to_side ? SH_DIFF_CREATED : SH_DIFF_REMOVED;
+                records[count].dr_start = records[count].dr_end = 0;
+                records[count].dr_size = 0;
+                ++count;
+                continue;
+            }
 
-    struct Snapshot_header snapshot_header;
+            if (entry.se_type != SH_ENTRY_MODIFIED) {
+                continue;
+            }
 
-    if((read_header_result = pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot read header of temporary snapshot\n");
-        return read_header_result;
-    }
+            copy = sh_ref_file(entry.se_file);
 
-    int counter = 0;
-    while(snapshot_header.created_files[counter] != 0) {
-        real_file = (struct File *) snapshot_header.created_files[counter];
+            from_version = sh_diff_version(from_snapshot, ancestor, entry.se_orig, entry.se_name, &from_below);
+            to_version = sh_diff_version(to_snapshot, ancestor, entry.se_orig, entry.se_name, &to_below);
 
-        printf_debug("File %s was deleted\n", real_file->f_name);
+            // файл сравнивается один раз: по ближайшей к to копии,
+            // а если на пути к to копий нет, то по ближайшей к from
+            if (to_side ? to_version != copy : (from_version != copy || to_below)) {
+                continue;
+            }
 
-        pure_file_set_size(real_file, 0);
-        memset(real_file, 0, sizeof(struct File));
+            off_t from_size = from_version ? from_version->f_size : 0;
+            off_t to_size = to_version ? to_version->f_size : 0;
+            blockno_t nblocks = MAX(CEILDIV(from_size, BLKSIZE), CEILDIV(to_size, BLKSIZE));
+            bool reported = cursor->dc_block != 0;
+
+            for (blockno_t filebno = cursor->dc_block; filebno < nblocks;) {
+                if (sh_diff_block(from_version, filebno) == sh_diff_block(to_version, filebno)) {
+                    ++filebno;
+                    continue;
+                }
+
+                blockno_t start = filebno;
+                while (filebno < nblocks && sh_diff_block(from_version, filebno) != sh_diff_block(to_version, filebno)) {
+                    ++filebno;
+                }
+
+                if (count == max_records) {
+                    cursor->dc_block = start;
+                    return count;
+                }
+
+                strcpy(records[count].dr_name, entry.se_name);
+                records[count].dr_file = entry.se_orig;
+                records[count].dr_type = SH_DIFF_CHANGED;
+                records[count].dr_start = start;
+                records[count].dr_end = filebno;
+                records[count].dr_size = to_size;
+                ++count;
+                reported = true;
+            }
 
-        ++counter;
-    }
+            // размер изменился без замены блоков
+            if (!reported && from_size != to_size) {
+                if (count == max_records) {
+                    return count;
+                }
+
+                strcpy(records[count].dr_name, entry.se_name);
+                records[count].dr_file = entry.se_orig;
+                records[count].dr_type = SH_DIFF_CHANGED;
+                records[count].dr_start = records[count].dr_end = nblocks;
+                records[count].dr_size = to_size;
+                ++count;
+            }
+        }
 
-    if (((struct File *) snapshot_header.prev_snapshot) != to_file(root_snapshot_file)) {
-        return delete_created_files_to_root((struct File *) snapshot_header.prev_snapshot);
+        cursor->dc_entry = cursor->dc_block = 0;
+        snap = sh_prev_snapshot(snap);
     }
-    
-    return 0;
 }
 
-int
-delete_tmp_snapshot() {
-    // here tmp snapshot should be deleted (really deleted, not just flag update)
-    printf_debug("Start deleting temporary snapshot\n");
+/************************ snapshot stream **********************************************************/
 
-    int read_header_result, write_header_result;
-
-    struct File *snapshoted_file, *real_file, *prev_snapshot_file; 
+static struct Sh_diff_record sh_stream_records[SH_DIFF_RECORDS];
 
-    struct Snapshot_header tmp_snapshot_header;
+static char sh_stream_zero_block[BLKSIZE];
 
-    struct File *tmp_snapshot_file = to_file(current_snapshot_file);
+// Число блоков записи, содержимое которых лежит в потоке
+static blockno_t
+sh_stream_payload_blocks(struct Sh_diff_record *record) {
+    blockno_t end = MIN(record->dr_end, CEILDIV(record->dr_size, BLKSIZE));
 
-    if((read_header_result = pure_file_read(tmp_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot read header of temporary snapshot\n");
-        return read_header_result;
+    if (record->dr_type != SH_DIFF_CHANGED || record->dr_start >= end) {
+        return 0;
     }
 
-    // удаляем все снэпшотированные файлы
-    int counter = 0;
-    while(tmp_snapshot_header.modified_files[counter] != 0) {
-        snapshoted_file = (struct File *) tmp_snapshot_header.modified_files[counter];
+    return end - record->dr_start;
+}
 
-        pure_file_set_size(snapshoted_file, 0);
-        memset(snapshoted_file, 0, sizeof(struct File));
+// Записывает в файл path поток изменений снапшота name относительно его
+// предка parent: заголовок и записи сравнения снапшотов, за каждой
+// записью SH_DIFF_CHANGED следуют изменённые блоки файла. Возвращает
+// размер потока
+int
+fs_send_snapshot(const char *parent, const char *name, const char *path) {
+    printf_debug("Sending snapshot %s relative to %s into %s\n", name, parent, path);
+
+    struct File *parent_snapshot, *snapshot, *stream, *version;
+    struct Snapshot_header header;
+    struct Sh_stream_header stream_header;
+    struct Sh_diff_cursor cursor = {0};
+    bool below;
+    off_t pos;
+    int count, res;
 
-        ++counter;
+    if ((res = find_snapshot_file_by_name(parent, to_file(root_snapshot_file), &parent_snapshot)) != 0 ||
+            (res = find_snapshot_file_by_name(name, to_file(root_snapshot_file), &snapshot)) != 0) {
+        printf_debug("Snapshot for send not found\n");
+        return res;
     }
 
-    counter = 0;
-    while(tmp_snapshot_header.created_files[counter] != 0) {
-        real_file = (struct File *) tmp_snapshot_header.created_files[counter];
-
-        pure_file_set_size(real_file, 0);
-        memset(real_file, 0, sizeof(struct File));
-
-        ++counter;
+    // поток накатывается поверх parent, поэтому удалений в нём нет
+    if (snapshot == parent_snapshot || sh_common_ancestor(parent_snapshot, snapshot) != parent_snapshot) {
+        printf_debug("Snapshot %s is not a descendant of %s\n", name, parent);
+        return -E_INVAL;
     }
 
-    // удаляем ссылку в предыдущем снапшоте
-    prev_snapshot_file = (struct File *)tmp_snapshot_header.prev_snapshot;
-
-    if((read_header_result = pure_file_read(prev_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot read header of previous snapshot\n");
-        return read_header_result;
+    if ((res = pure_file_read(snapshot, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", name);
+        return res < 0 ? res : -E_INVAL;
     }
 
-    counter = 0;
-    while(tmp_snapshot_header.next_snapshot[counter] != (uint64_t) tmp_snapshot_file) {
-        ++counter;
+    if ((res = file_create(path, &stream)) == -E_FILE_EXISTS) {
+        res = file_open(path, &stream);
     }
 
-    tmp_snapshot_header.next_snapshot[counter] = 0;
-
-    if((write_header_result = pure_file_write(prev_snapshot_file, &tmp_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot update header of previous snapshot\n");
-        return write_header_result;
+    if (res < 0 || (res = file_set_size(stream, 0)) < 0) {
+        printf_debug("Stream file %s cannot be created: error code %d\n", path, res);
+        return res;
     }
 
+    memset(&stream_header, 0, sizeof(stream_header));
+    stream_header.ss_magic = SH_STREAM_MAGIC;
+    stream_header.ss_version = SH_STREAM_VERSION;
+    strcpy(stream_header.ss_parent, parent);
+    strcpy(stream_header.ss_name, name);
+    strcpy(stream_header.ss_comment, header.comment);
+    stream_header.ss_date = header.date;
 
-    // todo DO NOT REUSE HEADERS
-    *current_snapshot_file = (uint64_t) prev_snapshot_file;
-
-    pure_file_set_size(tmp_snapshot_file, 0);
-    memset(tmp_snapshot_file, 0, sizeof(struct File));
+    pos = sizeof(stream_header);
 
-    return 0;
-}
+    while ((count = fs_diff_snapshots(parent, name, &cursor, sh_stream_records, SH_DIFF_RECORDS)) > 0) {
+        for (int i = 0; i < count; ++i) {
+            struct Sh_diff_record *record = &sh_stream_records[i];
+            blockno_t nblocks = sh_stream_payload_blocks(record);
 
-int
-restore_files_from_snapshot(struct File *snapshot_file) {
-    printf_debug("Start restoring files from snapshot %s\n", snapshot_file->f_name);
+            if ((res = file_write(stream, record, sizeof(*record), pos)) != sizeof(*record)) {
+                return res < 0 ? res : -E_INVAL;
+            }
+            pos += sizeof(*record);
+            ++stream_header.ss_nrecords;
 
-    int read_header_result, write_header_result, restore_files_from_snapshot_result, pure_file_create_result;
+            if (!nblocks) {
+                continue;
+            }
 
-    struct File *real_file; 
+            version = sh_diff_version(snapshot, parent_snapshot, record->dr_file, record->dr_name, &below);
 
-    struct Snapshot_header snapshot_header;
+            // блоки пишутся прямо из кэша, дыры дополняются нулями
+            for (blockno_t filebno = record->dr_start; filebno < record->dr_start + nblocks; ++filebno) {
+                blockno_t diskbno = sh_diff_block(version, filebno);
 
-    if((read_header_result = pure_file_read(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot read header of snapshot %s\n", snapshot_file->f_name);
-        return read_header_result;
+                if ((res = file_write(stream, diskbno ? diskaddr(diskbno) : sh_stream_zero_block, BLKSIZE, pos)) != BLKSIZE) {
+                    return res < 0 ? res : -E_NO_DISK;
+                }
+                pos += BLKSIZE;
+            }
+        }
     }
 
-    if (((struct File *) snapshot_header.prev_snapshot) != to_file(root_snapshot_file)) {
-    
-        restore_files_from_snapshot_result = restore_files_from_snapshot((struct File *) snapshot_header.prev_snapshot);
-
-        if (restore_files_from_snapshot_result != 0) {
-            printf_debug("Cannot restore files from snapshot %s\n", ((struct File *) snapshot_header.prev_snapshot)->f_name);
-            return restore_files_from_snapshot_result;
-        }
+    if (count < 0) {
+        printf_debug("Cannot diff snapshots %s and %s: error code %d\n", parent, name, count);
+        return count;
     }
 
-    int counter = 0;
-    while(snapshot_header.created_files[counter] != 0) {
+    if ((res = file_write(stream, &stream_header, sizeof(stream_header), 0)) != sizeof(stream_header)) {
+        return res < 0 ? res : -E_INVAL;
+    }
 
-        pure_file_create_result = pure_file_create(snapshot_header.created_files_names[counter], &real_file);
+    file_flush(stream);
 
-        if (pure_file_create_result == 0)  {
-            printf_debug("File %s from snapshot %s restored\n", snapshot_header.created_files_names[counter], snapshot_file->f_name);
-        } else if (pure_file_create_result == -E_FILE_EXISTS){
-            printf_debug("File %s from snapshot %s already exist, should not happen\n", snapshot_header.created_files_names[counter], snapshot_file->f_name);
-            return pure_file_create_result;
-        } else {
-            printf_debug("File %s from snapshot %s cannot be created\n", snapshot_header.created_files_names[counter], snapshot_file->f_name);
-            return pure_file_create_result;
-        }
+    printf_debug("Snapshot %s sent, %u records, %d bytes\n", name, stream_header.ss_nrecords, (int)pos);
 
-        snapshot_header.created_files[counter] = (uint64_t) real_file;
+    return pos;
+}
 
-        printf_debug("File %s was restored\n", real_file->f_name);
+// Добавляет запись в принимаемый снапшот и сохраняет его заголовок
+static int
+sh_stream_add_entry(struct File *snapshot_file, struct Snapshot_header *header, struct Snapshot_entry *entry) {
+    int res;
 
-        ++counter;
+    if ((res = sh_entry_add(snapshot_file, header, entry)) != 0) {
+        return res;
     }
 
-    if((write_header_result = pure_file_write(snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot update header of snapshot %s\n", snapshot_file->f_name);
-        return read_header_result;
+    if ((res = pure_file_write(snapshot_file, header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        return res < 0 ? res : -E_INVAL;
     }
 
     return 0;
 }
 
-//Удаляет снимок по имени.
-int
-fs_delete_snapshot(const char *name) {
+// Копия файла name в принимаемом снапшоте. Новая копия разделяет блоки
+// с версией файла в родительском снапшоте. Ссылки из потока относятся
+// к отправившей файловой системе, поэтому оригинал ищется по имени
+static int
+sh_stream_copy(struct File *snapshot_file, struct Snapshot_header *header, const char *name, struct File **pcopy) {
+    struct File *version, *orig_file;
+    fileref_t orig;
+    bool below;
+    int res;
 
-    printf_debug("Start deleting snapshot with name %s\n", name);
+    orig = file_open(name, &orig_file) == 0 ? sh_file_ref(orig_file) : 0;
 
-    int file_search_result, header_read_result, header_write_result;
-    
-    struct File *translated_root_snapshot_file,*snapshot_file_for_delete;
+    if ((res = sh_index_lookup(snapshot_file, orig, name, pcopy)) != -E_NOT_FOUND) {
+        return res;
+    }
 
-    translated_root_snapshot_file = to_file(root_snapshot_file);
+    snapshoted_file_name(copy_name, name, orig, snapshot_file->f_name);
 
-    snapshot_file_for_delete = translated_root_snapshot_file;
+    if ((res = pure_file_create(copy_name, pcopy)) < 0) {
+        printf_debug("Copy %s cannot be created: error code %d\n", copy_name, res);
+        return res;
+    }
 
-    if ((file_search_result = find_snapshot_file_by_name(name, translated_root_snapshot_file, &snapshot_file_for_delete)) == -E_NOT_FOUND) {
-        cprintf("Snapshot with name %s does not exist\n", name);
-        return file_search_result;
-    } else if(file_search_result != 0) {
-        cprintf("Unknown error during seraching snapshot with name %s\n", name);
-        return file_search_result;
+    version = sh_diff_version(sh_prev_snapshot(snapshot_file), NULL, orig, name, &below);
+
+    if (version != NULL && (res = file_share_blocks(*pcopy, version)) < 0) {
+        file_release(*pcopy);
+        return res;
     }
 
-    printf_debug("Found snapshot with name %s\n", snapshot_file_for_delete->f_name);
+    struct Snapshot_entry modified_entry = {
+        .se_type = SH_ENTRY_MODIFIED,
+        .se_hash = sh_ref_hash(orig),
+        .se_file = sh_file_ref(*pcopy),
+        .se_orig = orig};
+    strncpy(modified_entry.se_name, name, MAXNAMELEN - 1);
 
-    struct Snapshot_header header_for_delete;
+    return sh_stream_add_entry(snapshot_file, header, &modified_entry);
+}
 
-    if((header_read_result = pure_file_read(snapshot_file_for_delete, &header_for_delete, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Snapshot's %s header that must be deleted cannot be readed\n", snapshot_file_for_delete->f_name);
-        return header_read_result;
-    }
+// Принимает поток из файла path: создаёт снапшот с именем из потока
+// потомком того же снапшота, относительно которого поток был записан.
+// Созданные в снапшоте файлы появятся при его принятии
+int
+fs_receive_snapshot(const char *path) {
+    printf_debug("Receiving snapshot from %s\n", path);
 
-    header_for_delete.is_deleted = true;
+    struct File *stream, *parent_snapshot, *snapshot, *copy;
+    struct Snapshot_header header;
+    struct Sh_stream_header stream_header;
+    struct Sh_diff_record record;
+    off_t pos;
+    char *blk;
+    int res;
 
-    if ((header_write_result = pure_file_write(snapshot_file_for_delete, &header_for_delete, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Snapshot's %s header that must be deleted cannot be updated\n", snapshot_file_for_delete->f_name);
-        return header_write_result;
+    if ((res = file_open(path, &stream)) < 0) {
+        printf_debug("Stream file %s not found\n", path);
+        return res;
     }
 
-    printf_debug("Deleted snapshot %s header updated\n", snapshot_file_for_delete->f_name);
-
-    char time_stamp_int_string[MAXNAMELEN];
-    
-    if (itoa(header_for_delete.date, time_stamp_int_string, MAXNAMELEN, 10) != 0) {
-        printf_debug("Cannot convert timestamp to string: %d\n", header_for_delete.date);
+    if (file_read(stream, &stream_header, sizeof(stream_header), 0) != sizeof(stream_header) ||
+            stream_header.ss_magic != SH_STREAM_MAGIC ||
+            stream_header.ss_version != SH_STREAM_VERSION) {
+        printf_debug("File %s is not a snapshot stream\n", path);
         return -E_INVAL;
     }
 
-    strcat(snapshot_file_for_delete->f_name, time_stamp_int_string);
-
-    printf_debug("Start renaming files from deleted snapshot\n");
-
-    int counter = 0;
-    struct File *buffer_snapshoted_file;
-    while(header_for_delete.modified_files[counter] != 0) {
-    
-        buffer_snapshoted_file = (struct File *) header_for_delete.modified_files[counter];
+    stream_header.ss_parent[MAXNAMELEN - 1] = '\0';
+    stream_header.ss_name[MAXNAMELEN - 1] = '\0';
+    stream_header.ss_comment[sizeof(stream_header.ss_comment) - 1] = '\0';
 
-        printf_debug("Updating file name for %s\n", buffer_snapshoted_file->f_name);
+    if ((res = find_snapshot_file_by_name(stream_header.ss_parent, to_file(root_snapshot_file), &parent_snapshot)) != 0) {
+        printf_debug("Parent snapshot %s for stream not found\n", stream_header.ss_parent);
+        return res;
+    }
 
-        strcat(buffer_snapshoted_file->f_name, time_stamp_int_string);
+    if (find_snapshot_file_by_name(stream_header.ss_name, to_file(root_snapshot_file), &snapshot) != -E_NOT_FOUND) {
+        printf_debug("Snapshot with name %s already exist\n", stream_header.ss_name);
+        return -E_FILE_EXISTS;
+    }
 
-        printf_debug("Updated file name for %s\n", buffer_snapshoted_file->f_name);
+    memset(&header, 0, sizeof(header));
+    strcpy(header.comment, stream_header.ss_comment);
+    header.date = stream_header.ss_date;
+    header.is_deleted = false;
 
-        ++counter;
+    if ((res = sh_snapshot_create(stream_header.ss_name, parent_snapshot, &header, &snapshot)) != 0) {
+        return res;
     }
-    
-    printf_debug("Deleted snapshot file name updated: %s\n", snapshot_file_for_delete->f_name);
 
-    pure_file_flush(snapshot_file_for_delete);
-    
-    return 0;
-}
+    pos = sizeof(stream_header);
 
-int
-find_snapshot_file_by_name(const char *name, struct File *root_snapshot_file, struct File **psnapshot_file) {
+    for (uint32_t n = 0; n < stream_header.ss_nrecords; ++n) {
+        if (file_read(stream, &record, sizeof(record), pos) != sizeof(record)) {
+            printf_debug("Stream %s is truncated\n", path);
+            return -E_INVAL;
+        }
+        pos += sizeof(record);
+        record.dr_name[MAXNAMELEN - 1] = '\0';
 
-    struct File *buffer_snapshot_file;
-    struct Snapshot_header snapshot_header, buffer_snapshot_header;
+        if (record.dr_type == SH_DIFF_CREATED) {
+            struct Snapshot_entry created_entry = {
+                .se_type = SH_ENTRY_CREATED,
+                .se_file = 0};
+            strcpy(created_entry.se_name, record.dr_name);
 
-    int header_read_result, internal_search_result;
+            if ((res = sh_stream_add_entry(snapshot, &header, &created_entry)) != 0) {
+                return res;
+            }
+            continue;
+        } else if (record.dr_type != SH_DIFF_CHANGED) {
+            printf_debug("Unexpected record of type %u in stream %s\n", record.dr_type, path);
+            return -E_INVAL;
+        }
 
-    if((header_read_result = pure_file_read(root_snapshot_file, &snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-        printf_debug("Cannot find snapshot by name, because cannot read header for snapshot %s\n", root_snapshot_file->f_name);
-        return header_read_result;
-    }
+        if ((res = sh_stream_copy(snapshot, &header, record.dr_name, &copy)) != 0 ||
+                (res = pure_file_set_size(copy, record.dr_size)) != 0) {
+            printf_debug("Copy of %s cannot be prepared: error code %d\n", record.dr_name, res);
+            return res;
+        }
 
-    int counter = 0;
+        // блоки потока читаются прямо в блоки копии
+        blockno_t nblocks = sh_stream_payload_blocks(&record);
 
-    while(snapshot_header.next_snapshot[counter] != 0) {
-        buffer_snapshot_file = (struct File *) snapshot_header.next_snapshot[counter];
+        for (blockno_t filebno = record.dr_start; filebno < record.dr_start + nblocks; ++filebno) {
+            if ((res = file_get_writable_block(copy, filebno, &blk)) < 0) {
+                return res;
+            }
 
-        if((header_read_result = pure_file_read(buffer_snapshot_file, &buffer_snapshot_header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
-            printf_debug("Cannot find snapshot by name, because cannot read header for snapshot %s\n", buffer_snapshot_file->f_name);
-            return header_read_result;
+            if (file_read(stream, blk, BLKSIZE, pos) != BLKSIZE) {
+                printf_debug("Stream %s is truncated\n", path);
+                return -E_INVAL;
+            }
+            pos += BLKSIZE;
         }
 
-        if (!buffer_snapshot_header.is_deleted && 
-                strcmp(buffer_snapshot_file->f_name, name) == 0 && 
-                buffer_snapshot_file != to_file(current_snapshot_file)) {
+        pure_file_flush(copy);
+    }
 
-                    *psnapshot_file = buffer_snapshot_file;
+    pure_file_flush(snapshot);
 
-                    return 0;
-        } else if ((internal_search_result = find_snapshot_file_by_name(name, buffer_snapshot_file, psnapshot_file)) == 0){
-            return 0;
-        }
-        
-        ++counter;
-    }
+    flush_bitmap();
 
-    return -E_NOT_FOUND;
-}
+    printf_debug("Snapshot %s received\n", stream_header.ss_name);
 
+    return 0;
+}
 
 //Список снимков
 int
@@ -1637,7 +4256,7 @@ internal_print_snapshot_list(struct File *snap, struct Snapshot_header header) {
 
     bool is_any_snapshots_printed = false;
 
-    int counter;
+    struct Snapshot_entry entry;
 
     struct Snapshot_header next_snapshot_header;
 
@@ -1655,35 +4274,20 @@ internal_print_snapshot_list(struct File *snap, struct Snapshot_header header) {
         cprintf("       Comment: %s\n", header.comment);
         cprintf("          Time: %d/%d/%d %d:%d:%d\n", time.tm_mday, time.tm_mon+1, time.tm_year+1900, (time.tm_hour+3)%24, time.tm_min-2, time.tm_sec);
 
-        // cprintf("          Prev: %s\n", ((struct File *)header.prev_snapshot)->f_name);
+        // cprintf("          Prev: %s\n", sh_ref_file(header.prev_snapshot)->f_name);
         cprintf("          Prev: ");
-        internal_print_previous((struct File *)header.prev_snapshot);
+        internal_print_previous(sh_ref_file(header.prev_snapshot));
         cprintf("\n");
         cprintf("Modified files: [");
-        counter = 0;
-        while(header.modified_files[counter] != 0) {
-
-            char file_name[MAXNAMELEN];
-            file_name[0] = '\0';
-            char *pseparator = strfind(((struct File *)header.modified_files[counter])->f_name, SNAPFILESEP[0]);
-            int separator_position = pseparator - ((struct File *)header.modified_files[counter])->f_name;
-            strncpy(file_name, ((struct File *)header.modified_files[counter])->f_name, separator_position);
-
-            cprintf(" %s;", file_name);
-            ++counter;
-        }
-        if((struct File *)header.prev_snapshot != to_file(root_snapshot_file)) {
-            internal_print_deleted_snapshot_modified_file_list((struct File *)header.prev_snapshot);
+        internal_print_entries(snap, &header, SH_ENTRY_MODIFIED);
+        if(sh_ref_file(header.prev_snapshot) != to_file(root_snapshot_file)) {
+            internal_print_deleted_snapshot_modified_file_list(sh_ref_file(header.prev_snapshot));
         }
         cprintf(" ]\n");
         cprintf(" Created files: [");
-        counter = 0;
-        while(header.created_files[counter] != 0) {
-            cprintf(" %s;", header.created_files_names[counter]);
-            ++counter;
-        }
-        if((struct File *)header.prev_snapshot != to_file(root_snapshot_file)) {
-            internal_print_deleted_snapshot_created_file_list((struct File *)header.prev_snapshot);
+        internal_print_entries(snap, &header, SH_ENTRY_CREATED);
+        if(sh_ref_file(header.prev_snapshot) != to_file(root_snapshot_file)) {
+            internal_print_deleted_snapshot_created_file_list(sh_ref_file(header.prev_snapshot));
         }
         cprintf(" ]\n");
 
@@ -1691,9 +4295,9 @@ internal_print_snapshot_list(struct File *snap, struct Snapshot_header header) {
         cprintf("\n\n\n");
     }
 
-    for(int next_snap_index = 0; next_snap_index < MAXBRANCHES; ++next_snap_index) {
-        if (header.next_snapshot[next_snap_index] != 0) {
-            next_snapshot_file = (struct File *)(header.next_snapshot[next_snap_index]);
+    for (uint32_t n = 0; n < header.entries_size; ++n) {
+        if (sh_entry_read(snap, n, &entry) == 0 && entry.se_type == SH_ENTRY_CHILD) {
+            next_snapshot_file = sh_ref_file(entry.se_file);
             if(pure_file_read(next_snapshot_file, &next_snapshot_header, HEADERSIZE, HEADERPOS) != HEADERSIZE) {
                 printf_debug("Snapshot header for %s cannot be readed\n", next_snapshot_file->f_name)
             } else {
@@ -1719,31 +4323,10 @@ internal_print_deleted_snapshot_modified_file_list(struct File *snapshot_file) {
 
     if (snapshot_header.is_deleted) {
         
-        int counter = 0;
-        while(snapshot_header.modified_files[counter] != 0) {
-            char file_name[MAXNAMELEN];
-            file_name[0] = '\0';
-            char *pseparator = strfind(((struct File *)snapshot_header.modified_files[counter])->f_name, SNAPFILESEP[0]);
-            int separator_position = pseparator - ((struct File *)snapshot_header.modified_files[counter])->f_name;
-            strncpy(file_name, ((struct File *)snapshot_header.modified_files[counter])->f_name, separator_position);
-            // todo construct name without file extrnsion
-            // static int
-            // strcmp_snapshoted(char *sfile_name, char *file_name) {
-            // char *pseparator = strfind(sfile_name + 1, SNAPFILESEP[0]);
-
-            // int separator_position = pseparator - sfile_name;
-
-            // return strncmp(sfile_name, file_name, separator_position);
-            // }
-
-
-            // cprintf(" %s;", ((struct File *)snapshot_header.modified_files[counter])->f_name);
-            cprintf(" %s;",file_name);
-            ++counter;
-        }
+        internal_print_entries(snapshot_file, &snapshot_header, SH_ENTRY_MODIFIED);
 
-        if((struct File *)snapshot_header.prev_snapshot != to_file(root_snapshot_file)) {
-            internal_print_deleted_snapshot_modified_file_list((struct File *)snapshot_header.prev_snapshot);
+        if(sh_ref_file(snapshot_header.prev_snapshot) != to_file(root_snapshot_file)) {
+            internal_print_deleted_snapshot_modified_file_list(sh_ref_file(snapshot_header.prev_snapshot));
         }
 
         return true;
@@ -1766,14 +4349,10 @@ internal_print_deleted_snapshot_created_file_list(struct File *snapshot_file) {
 
     if (snapshot_header.is_deleted) {
         
-        int counter = 0;
-        while(snapshot_header.created_files[counter] != 0) {
-            cprintf(" %s;", snapshot_header.created_files_names[counter]);
-            ++counter;
-        }
+        internal_print_entries(snapshot_file, &snapshot_header, SH_ENTRY_CREATED);
 
-        if((struct File *)snapshot_header.prev_snapshot != to_file(root_snapshot_file)) {
-            internal_print_deleted_snapshot_created_file_list((struct File *)snapshot_header.prev_snapshot);
+        if(sh_ref_file(snapshot_header.prev_snapshot) != to_file(root_snapshot_file)) {
+            internal_print_deleted_snapshot_created_file_list(sh_ref_file(snapshot_header.prev_snapshot));
         }
 
         return true;
@@ -1794,10 +4373,10 @@ internal_print_previous(struct File *snapshot_file) {
     }
 
     if (snapshot_header.is_deleted) {
-        if((struct File *)snapshot_header.prev_snapshot != to_file(root_snapshot_file)) {
-            internal_print_previous((struct File *)snapshot_header.prev_snapshot);
+        if(sh_ref_file(snapshot_header.prev_snapshot) != to_file(root_snapshot_file)) {
+            internal_print_previous(sh_ref_file(snapshot_header.prev_snapshot));
         } else {
-            cprintf("%s", ((struct File *)snapshot_header.prev_snapshot)->f_name);
+            cprintf("%s", sh_ref_file(snapshot_header.prev_snapshot)->f_name);
         }
     } else {
         cprintf("%s", snapshot_file->f_name);
@@ -1806,6 +4385,20 @@ internal_print_previous(struct File *snapshot_file) {
     return true;
 }
 
+// Печатает имена модифицированных или созданных в снапшоте файлов
+static void
+internal_print_entries(struct File *snapshot_file, struct Snapshot_header *header, uint32_t type) {
+    struct Snapshot_entry entry;
+
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0 || entry.se_type != type) {
+            continue;
+        }
+
+        cprintf(" %s;", entry.se_name);
+    }
+}
+
 /************************ functions end ************************************************************/
 
 /********************** snapshot end ***************************************************************/
@@ -1819,28 +4412,15 @@ internal_print_previous(struct File *snapshot_file) {
 
 int 
 df_count_free_blocks() {
-    int free_blocks = 0;
-
-    for (blockno_t blockno = 1; blockno < super->s_nblocks; blockno++) {
-        if (block_is_free(blockno)) {
-            free_blocks++;
-        }
-    }
+    printf_debug("Total amount of blocks in super %d; amount of free blocks: %d\n", super->s_nblocks, super->s_nfree);
 
-    printf_debug("Total amount of blocks in super %d; amount of free blocks: %d\n", super->s_nblocks, free_blocks);
-
-    return free_blocks;
+    return super->s_nfree;
 }
 
 int 
 df_count_busy_blocks() {
-    int busy_blocks = 0;
-
-    for (blockno_t blockno = 1; blockno < super->s_nblocks; blockno++) {
-        if (!block_is_free(blockno)) {
-            busy_blocks++;
-        }
-    }
+    // блок 0 не считается ни свободным, ни занятым
+    int busy_blocks = super->s_nblocks - 1 - super->s_nfree;
 
     printf_debug("Total amount of blocks in super %d; amount of busy blocks: %d\n", super->s_nblocks, busy_blocks);
 
@@ -1868,4 +4448,103 @@ df_busy_bytes() {
 
     return busy_blocks * BLKSIZE;
 }
+
+// Учитывает блоки файла: блоки с одной ссылкой принадлежат только ему
+static void
+df_file_usage(struct File *file, struct Df_snapshot *usage) {
+    blockno_t diskbno;
+
+    for (blockno_t filebno = 0; filebno < CEILDIV(file->f_size, BLKSIZE); ++filebno) {
+        if (file_map_block(file, filebno, &diskbno) < 0 || !diskbno) {
+            continue;
+        }
+
+        if (block_refs(diskbno) > 1) {
+            usage->ds_shared += BLKSIZE;
+        } else {
+            usage->ds_exclusive += BLKSIZE;
+        }
+    }
+
+    usage->ds_exclusive += file_mapping_blocks(file) * BLKSIZE;
+}
+
+// Место, занятое снапшотом: его файл, копия bitmap и копии файлов
+static int
+df_snapshot_usage(struct File *snapshot_file, struct Snapshot_header *header, struct Df_snapshot *usage) {
+    struct Snapshot_entry entry;
+
+    memset(usage, 0, sizeof(*usage));
+    strcpy(usage->ds_name, snapshot_file->f_name);
+    usage->ds_deleted = header->is_deleted;
+
+    df_file_usage(snapshot_file, usage);
+
+    if (header->old_bitmap) {
+        usage->ds_exclusive += BLKSIZE;
+    }
+
+    for (uint32_t n = 0; n < header->entries_size; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+
+        if (entry.se_type == SH_ENTRY_MODIFIED) {
+            df_file_usage(sh_ref_file(entry.se_file), usage);
+        }
+    }
+
+    return 0;
+}
+
+// Обходит дерево снапшотов, пропуская первые start, и заполняет не
+// более max_records записей; *pos считает пройденные снапшоты
+static int
+df_snapshot_walk(struct File *snapshot_file, int *pos, int start, struct Df_snapshot *records, int max_records) {
+    struct Snapshot_header header;
+    struct Snapshot_entry entry;
+    int count = 0, res;
+
+    if ((res = pure_file_read(snapshot_file, &header, HEADERSIZE, HEADERPOS)) != HEADERSIZE) {
+        printf_debug("Cannot read header of snapshot %s\n", snapshot_file->f_name);
+        return res < 0 ? res : -E_INVAL;
+    }
+
+    if ((*pos)++ >= start) {
+        if ((res = df_snapshot_usage(snapshot_file, &header, &records[count])) != 0) {
+            return res;
+        }
+        ++count;
+    }
+
+    for (uint32_t n = 0; n < header.entries_size && count < max_records; ++n) {
+        if (sh_entry_read(snapshot_file, n, &entry) != 0) {
+            return -E_INVAL;
+        }
+
+        if (entry.se_type != SH_ENTRY_CHILD) {
+            continue;
+        }
+
+        if ((res = df_snapshot_walk(sh_ref_file(entry.se_file), pos, start, records + count, max_records - count)) < 0) {
+            return res;
+        }
+        count += res;
+    }
+
+    return count;
+}
+
+// Место по снапшотам начиная со start-го в порядке обхода дерева.
+// Возвращает число записей
+int
+df_snapshots(int start, struct Df_snapshot *records, int max_records) {
+    int pos = 0;
+
+    if (max_records <= 0) {
+        return 0;
+    }
+
+    return df_snapshot_walk(to_file(root_snapshot_file), &pos, start, records, max_records);
+}
 /********************** df end *********************************************************************/
\ No newline at end of file
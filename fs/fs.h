@@ -11,8 +11,39 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE 0xC0000000
 
+/* The virtio-blk queue and request headers live here */
+#define VIRTIO_MAP 0x0F000000
+
+/* Blocks returned by a bulk read are gathered here */
+#define BULKMAP 0x0E000000
+
+/* Block cache budget: blocks kept in memory besides the pinned
+ * superblock and bitmap */
+#ifndef BC_NBLOCKS
+#define BC_NBLOCKS 2048
+#endif
+
+/* Largest disk command in blocks, what a single ide_read
+ * of 256 sectors can fill, and requests the bio queue holds */
+#define BIO_MAX_BLOCKS (256 / BLKSECTS)
+#define BIO_QUEUE_SIZE 256
+
+/* Readahead: sequential streams tracked and the largest window */
+#define BC_RA_STREAMS 4
+#define BC_RA_MAX     BIO_MAX_BLOCKS
+
+/* Seconds a block may stay dirty before the server writes it back */
+#define BC_WRITEBACK_INTERVAL 5
+
+/* Maximum number of bitmap blocks */
+#define MAXBITBLOCKS ((DISKSIZE / BLKSIZE + BLKBITSIZE - 1) / BLKBITSIZE)
+
+/* Directories this large get a hash index */
+#define DIRINDEX_MIN_BLOCKS 4
+
 #define SNAPDIR ".snapshots/"
 #define SNAPFILESEP "."
+#define SNAPIDSEP "#"
 
 #define SNAPCFG ".snapshots/cfg"
 #define ROOTSNAP "root_snapshot"
@@ -25,28 +56,100 @@
 
 #define HEADERSIZE sizeof(struct Snapshot_header)
 
+/* Snapshot file layout: header, index buckets, index entries */
+#define INDEXPOS BLKSIZE
+#define INDEXBUCKETS (BLKSIZE / sizeof(uint32_t))
+#define ENTRIESPOS (2 * BLKSIZE)
+#define ENTRYSIZE sizeof(struct Snapshot_entry)
+
+/* In-memory cache of resolved snapshot files */
+#define RESOLVE_CACHE_SIZE 64
+
+/* In-memory cache of path components looked up in directories */
+#define DENTRY_CACHE_SIZE 256
+
+/* In-memory free slot hints of directories */
+#define DIRHINT_CACHE_SIZE 16
+
+/* Block reference counts: in-memory delta log size and counter limit */
+#define REFCOUNT_LOG_SIZE 32
+#define REFCOUNT_MAX 0xFF
+
+/* In-memory copy of the snapshot tree, built at sh_init */
+#define SH_NODE_CACHE_SIZE 128
+
 extern struct Super *super; /* superblock */
 extern uint32_t *bitmap;    /* bitmap blocks mapped in memory */
 
+/* Block device backend.  Transfers are started by bd_submit, which
+ * returns a tag, and finished by bd_wait on that tag.  Backends with
+ * a queue keep several transfers in flight; bd_submit returns
+ * -E_NO_MEM when it is full.  Synchronous ones leave both NULL. */
+struct Blockdev {
+    const char *bd_name;
+    int (*bd_read)(uint32_t secno, void *dst, size_t nsecs);
+    int (*bd_write)(uint32_t secno, const void *src, size_t nsecs);
+    int (*bd_submit)(uint32_t secno, void *buf, size_t nsecs, bool write);
+    int (*bd_wait)(int tag);
+};
+
+/* disk.c */
+void disk_init(void);
+int disk_read(uint32_t secno, void *dst, size_t nsecs);
+int disk_write(uint32_t secno, const void *src, size_t nsecs);
+int disk_submit(uint32_t secno, void *buf, size_t nsecs, bool write);
+int disk_wait(int tag);
+
+#define PCI_TAG_STEP (1 << 8)
+#define PCI_NTAGS    (1 << 16)
+uint32_t pci_conf_read(uint32_t tag, uint32_t off);
+void pci_conf_write(uint32_t tag, uint32_t off, uint32_t val);
+
+/* bio.c: a queued block I/O request, 'bio_done' is called with
+ * the result once the blocks are on disk or in memory */
+struct Bio {
+    blockno_t bio_blockno;
+    uint32_t bio_count;
+    bool bio_write;
+    void (*bio_done)(struct Bio *bio, int res);
+    uint64_t bio_queued; /* read_tsc() at bio_queue */
+};
+
+void bio_queue(blockno_t blockno, uint32_t count, bool write, void (*done)(struct Bio *bio, int res));
+void bio_run(void);
+void bio_print_stats(void);
+
 /* ide.c */
+extern struct Blockdev ide_blockdev;
 bool ide_probe_disk1(void);
 void ide_set_disk(int diskno);
+void ide_init(void);
 void ide_set_partition(uint32_t first_sect, uint32_t nsect);
 int ide_read(uint32_t secno, void *dst, size_t nsecs);
 int ide_write(uint32_t secno, const void *src, size_t nsecs);
 
+/* virtio.c */
+extern struct Blockdev virtio_blockdev;
+bool virtio_blk_init(void);
+
 /* bc.c */
 void *diskaddr(uint32_t blockno);
 void flush_block(void *addr);
+void bc_sync(void);
+bool bc_dirty(void);
 void bc_init(void);
 
 /* fs.c */
 void fs_init(void);
 int file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
 int file_create(const char *path, struct File **f);
+int file_mkdir(const char *path, struct File **f);
 int file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc);
+int file_map_block(struct File *f, uint32_t filebno, blockno_t *pdiskbno);
+int file_set_block(struct File *f, uint32_t filebno, blockno_t diskbno);
 int file_open(const char *path, struct File **f);
 ssize_t file_read(struct File *f, void *buf, size_t count, off_t offset);
+ssize_t file_map_read(struct File *f, void *dst, size_t count, off_t offset);
 ssize_t file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int file_set_size(struct File *f, off_t newsize);
 void file_flush(struct File *f);
@@ -56,6 +159,13 @@ void fs_sync(void);
 /* int  map_block(uint32_t); */
 bool block_is_free(uint32_t blockno);
 blockno_t alloc_block(void);
+void free_block(uint32_t blockno);
+blockno_t alloc_extent(blockno_t hint, uint32_t min, uint32_t max, uint32_t *pcount);
+void flush_bitmap(void);
+void refcount_init(void);
+void refcount_flush(void);
+int block_refs(blockno_t blockno);
+int block_share(blockno_t blockno);
 
 /* test.c */
 void fs_test(void);
@@ -66,6 +176,7 @@ int resolve_file_for_write(struct File **pfile, struct File *snapshot_file);
 int create_and_copy(struct File **dstfile, struct File **srcfile);
 
 int pure_file_create(const char *path, struct File **f);
+int pure_file_create_at(const char *path, fileref_t place, struct File **f);
 ssize_t pure_file_read(struct File *f, void *buf, size_t count, off_t offset);
 ssize_t pure_file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int pure_file_set_size(struct File *f, off_t newsize);
@@ -74,16 +185,21 @@ void pure_file_flush(struct File *f);
 int find_snapshot_file_by_name(const char *name, struct File *root_snapshot_file, struct File **psnapshot_file);
 int fs_create_tmp_snapshot();
 int delete_tmp_snapshot();
-int delete_created_files_to_root(struct File *snapshot_file);
-int restore_files_from_snapshot(struct File *snapshot_file);
+int delete_created_files_to_ancestor(struct File *snapshot_file, struct File *ancestor, struct File *target);
+int restore_files_from_snapshot(struct File *snapshot_file, struct File *ancestor, struct File *source);
 
 int fs_print_snapshot_list();
 int fs_create_snapshot(const char * comment, const char * name);
 int fs_accept_snapshot(const char *name);
 int fs_delete_snapshot(const char *name);
+int fs_gc_snapshots();
+int fs_diff_snapshots(const char *from, const char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records, int max_records);
+int fs_send_snapshot(const char *parent, const char *name, const char *path);
+int fs_receive_snapshot(const char *path);
 
 /* df */
 int df_count_free_blocks();
 int df_count_busy_blocks();
 int df_free_bytes();
 int df_busy_bytes();
+int df_snapshots(int start, struct Df_snapshot *records, int max_records);
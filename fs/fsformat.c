@@ -104,6 +104,7 @@ opendisk(const char *name) {
     super = alloc(BLKSIZE);
     super->s_magic = FS_MAGIC;
     super->s_nblocks = nblocks;
+    super->s_version = FS_VERSION_SUPER;
     super->s_root.f_type = FTYPE_DIR;
     strcpy(super->s_root.f_name, "/");
 
@@ -119,29 +120,30 @@ finishdisk(void) {
     for (i = 0; i < blockof(diskpos); ++i)
         bitmap[i / 32] &= ~(1U << (i % 32));
 
+    super->s_nfree = nblocks - blockof(diskpos);
+
     if (msync(diskmap, nblocks * BLKSIZE, MS_SYNC) < 0)
         panic("msync: %s", strerror(errno));
 }
 
 void
 finishfile(struct File *f, uint32_t start, uint32_t len) {
-    int i;
     f->f_size = len;
+    f->f_flags = FILE_EXTENTS;
     len = ROUNDUP(len, BLKSIZE);
-    for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
-        f->f_direct[i] = start + i;
-    if (i == NDIRECT) {
-        uint32_t *ind = alloc(BLKSIZE);
-        f->f_indirect = blockof(ind);
-        for (; i < len / BLKSIZE; ++i)
-            ind[i - NDIRECT] = start + i;
+    /* Files are laid out contiguously: a single extent maps them */
+    if (len) {
+        f->f_extents[0].e_fileblk = 0;
+        f->f_extents[0].e_len = len / BLKSIZE;
+        f->f_extents[0].e_diskblk = start;
+        f->f_nextents = 1;
     }
 }
 
 void
 startdir(struct File *f, struct Dir *dout) {
     dout->f = f;
-    dout->ents = malloc(MAX_DIR_ENTS * sizeof *dout->ents);
+    dout->ents = calloc(MAX_DIR_ENTS, sizeof *dout->ents);
     dout->n = 0;
 }
 
@@ -179,7 +181,8 @@ writefile(struct Dir *dir, const char *name) {
         panic("stat %s: %s", name, strerror(errno));
     if (!S_ISREG(st.st_mode))
         panic("%s is not a regular file", name);
-    if (st.st_size >= MAXFILESIZE)
+    /* f_size is a 32 bit off_t */
+    if (st.st_size > INT32_MAX)
         panic("%s too large", name);
 
     last = strrchr(name, '/');
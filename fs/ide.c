@@ -1,5 +1,9 @@
 /*
- * Minimal PIO-based (non-interrupt-driven) IDE driver code.
+ * IDE driver code.  Whole pages are moved by the PIIX bus master
+ * straight to and from their physical memory (DMA); anything else
+ * uses PIO, several sectors per interrupt (READ/WRITE MULTIPLE).
+ * While the drive is busy the file system server sleeps on IRQ 14
+ * instead of spinning.
  * For information about what all this IDE/ATA magic means,
  * see the materials available on the class references page.
  */
@@ -14,6 +18,40 @@
 
 static int diskno = 1;
 
+/* Sectors per DRQ block, set by SET MULTIPLE in ide_init */
+static size_t ide_multiple = 1;
+/* Drive supports 48-bit LBA commands */
+static bool ide_lba48 = 0;
+/* Cleared if the kernel refuses to let us sleep on IRQ 14 */
+static bool ide_irq_sleep = 1;
+
+/* Bus master registers, relative to BAR4 of the PCI IDE function */
+#define BMIDE_CMD    0
+#define BMIDE_STATUS 2
+#define BMIDE_PRDT   4
+
+#define BMIDE_CMD_START  0x01
+#define BMIDE_CMD_READ   0x08 /* device to memory */
+#define BMIDE_STATUS_ERR 0x02
+#define BMIDE_STATUS_IRQ 0x04
+#define BMIDE_STATUS_DMA(d) (0x20 << (d)) /* drive d is set up for DMA */
+
+/* Physical Region Descriptor: one physically contiguous piece
+ * of a transfer, which may not cross a 64K boundary */
+struct Ide_prd {
+    uint32_t addr;
+    uint16_t size;
+    uint16_t flags;
+} __attribute__((packed));
+
+#define PRD_EOT 0x8000 /* last descriptor of the table */
+#define NPRD    (PAGE_SIZE / sizeof(struct Ide_prd))
+
+static struct Ide_prd ide_prd[NPRD] __attribute__((aligned(PAGE_SIZE)));
+static physaddr_t ide_prd_pa;
+/* Primary channel bus master I/O base, 0 without DMA */
+static uint16_t ide_bmide = 0;
+
 static int
 ide_wait_ready(bool check_error) {
     int r;
@@ -25,6 +63,56 @@ ide_wait_ready(bool check_error) {
     return 0;
 }
 
+/* Wait for a command the drive is executing to raise its interrupt.
+ * The interrupt count is sampled before the status register, so an
+ * interrupt arriving between the two only makes sys_irq_wait return
+ * at once rather than being slept through. */
+static int
+ide_wait_irq(bool check_error) {
+    int r, seen;
+
+    for (;;) {
+        seen = vsys_irqs(IRQ_IDE);
+        if (((r = inb(0x1F7)) & (IDE_BSY | IDE_DRDY)) == IDE_DRDY) break;
+        if (ide_irq_sleep && sys_irq_wait(IRQ_IDE, seen) < 0) ide_irq_sleep = 0;
+    }
+
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+    return 0;
+}
+
+/* Status is not valid until 400ns after a command is written;
+ * four reads of the alternate status register take that long */
+static void
+ide_delay(void) {
+    for (int i = 0; i < 4; i++) inb(0x3F6);
+}
+
+static void
+ide_command(uint32_t secno, size_t nsecs, uint8_t cmd28, uint8_t cmd48) {
+    if (ide_lba48 && (nsecs > 256 || secno >= (1 << 28))) {
+        /* High order bytes go first, the FIFO registers keep both */
+        outb(0x1F6, 0x40 | ((diskno & 1) << 4));
+        outb(0x1F2, (nsecs >> 8) & 0xFF);
+        outb(0x1F3, (secno >> 24) & 0xFF);
+        outb(0x1F4, 0);
+        outb(0x1F5, 0);
+        outb(0x1F2, nsecs & 0xFF);
+        outb(0x1F3, secno & 0xFF);
+        outb(0x1F4, (secno >> 8) & 0xFF);
+        outb(0x1F5, (secno >> 16) & 0xFF);
+        outb(0x1F7, cmd48);
+    } else {
+        outb(0x1F2, nsecs & 0xFF);
+        outb(0x1F3, secno & 0xFF);
+        outb(0x1F4, (secno >> 8) & 0xFF);
+        outb(0x1F5, (secno >> 16) & 0xFF);
+        outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+        outb(0x1F7, cmd28);
+    }
+    ide_delay();
+}
+
 bool
 ide_probe_disk1(void) {
     int x;
@@ -53,24 +141,76 @@ ide_set_disk(int d) {
     diskno = d;
 }
 
+/* Describe the pages of 'buf' in the PRD table.  Fails, leaving the
+ * transfer to PIO, unless 'buf' is whole pages below 4G. */
+static bool
+ide_dma_setup(const void *buf, size_t nsecs, bool to_memory) {
+    size_t npages = nsecs * SECTSIZE / PAGE_SIZE;
+
+    if (!ide_bmide || !npages || npages > NPRD) return 0;
+    if ((uintptr_t)buf % PAGE_SIZE || nsecs * SECTSIZE % PAGE_SIZE) return 0;
+
+    for (size_t i = 0; i < npages; i++) {
+        int64_t pa = sys_region_phys(buf + i * PAGE_SIZE, to_memory);
+        if (pa < 0 || pa + PAGE_SIZE > 0x100000000LL) return 0;
+
+        ide_prd[i].addr = pa;
+        ide_prd[i].size = PAGE_SIZE;
+        ide_prd[i].flags = 0;
+    }
+    ide_prd[npages - 1].flags = PRD_EOT;
+
+    return 1;
+}
+
+static int
+ide_dma(uint32_t secno, size_t nsecs, bool to_memory) {
+    uint8_t dir = to_memory ? BMIDE_CMD_READ : 0;
+    int r;
+
+    ide_wait_ready(0);
+
+    outl(ide_bmide + BMIDE_PRDT, ide_prd_pa);
+    outb(ide_bmide + BMIDE_CMD, dir);
+    outb(ide_bmide + BMIDE_STATUS, inb(ide_bmide + BMIDE_STATUS) | BMIDE_STATUS_ERR | BMIDE_STATUS_IRQ);
+
+    if (to_memory)
+        ide_command(secno, nsecs, 0xC8, 0x25); /* READ DMA (EXT) */
+    else
+        ide_command(secno, nsecs, 0xCA, 0x35); /* WRITE DMA (EXT) */
+    outb(ide_bmide + BMIDE_CMD, dir | BMIDE_CMD_START);
+
+    r = ide_wait_irq(1);
+
+    uint8_t status = inb(ide_bmide + BMIDE_STATUS);
+    outb(ide_bmide + BMIDE_CMD, 0);
+    outb(ide_bmide + BMIDE_STATUS, status | BMIDE_STATUS_ERR | BMIDE_STATUS_IRQ);
+
+    if (r < 0 || status & BMIDE_STATUS_ERR) return -1;
+    return 0;
+}
+
 int
 ide_read(uint32_t secno, void *dst, size_t nsecs) {
     int r;
 
-    assert(nsecs <= 256);
+    assert(nsecs <= (ide_lba48 ? 65536 : 256));
+
+    if (ide_dma_setup(dst, nsecs, 1)) return ide_dma(secno, nsecs, 1);
 
     ide_wait_ready(0);
 
-    outb(0x1F2, nsecs);
-    outb(0x1F3, secno & 0xFF);
-    outb(0x1F4, (secno >> 8) & 0xFF);
-    outb(0x1F5, (secno >> 16) & 0xFF);
-    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-    outb(0x1F7, 0x20); /* CMD 0x20 means read sector */
+    if (ide_multiple > 1)
+        ide_command(secno, nsecs, 0xC4, 0x29); /* READ MULTIPLE (EXT) */
+    else
+        ide_command(secno, nsecs, 0x20, 0x24); /* READ SECTORS (EXT) */
 
-    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
-        if ((r = ide_wait_ready(1)) < 0) return r;
-        insl(0x1F0, dst, SECTSIZE / 4);
+    while (nsecs > 0) {
+        size_t n = MIN(nsecs, ide_multiple);
+        if ((r = ide_wait_irq(1)) < 0) return r;
+        insl(0x1F0, dst, n * SECTSIZE / 4);
+        dst += n * SECTSIZE;
+        nsecs -= n;
     }
 
     return 0;
@@ -80,21 +220,95 @@ int
 ide_write(uint32_t secno, const void *src, size_t nsecs) {
     int r;
 
-    assert(nsecs <= 256);
+    assert(nsecs <= (ide_lba48 ? 65536 : 256));
+
+    if (ide_dma_setup(src, nsecs, 0)) return ide_dma(secno, nsecs, 0);
 
     ide_wait_ready(0);
 
-    outb(0x1F2, nsecs);
-    outb(0x1F3, secno & 0xFF);
-    outb(0x1F4, (secno >> 8) & 0xFF);
-    outb(0x1F5, (secno >> 16) & 0xFF);
-    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-    outb(0x1F7, 0x30); /* CMD 0x30 means write sector */
+    if (ide_multiple > 1)
+        ide_command(secno, nsecs, 0xC5, 0x39); /* WRITE MULTIPLE (EXT) */
+    else
+        ide_command(secno, nsecs, 0x30, 0x34); /* WRITE SECTORS (EXT) */
 
-    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
-        if ((r = ide_wait_ready(1)) < 0) return r;
-        outsl(0x1F0, src, SECTSIZE / 4);
+    /* The first block is requested without an interrupt,
+     * each later one and the final completion raise one */
+    if ((r = ide_wait_ready(1)) < 0) return r;
+    while (nsecs > 0) {
+        size_t n = MIN(nsecs, ide_multiple);
+        outsl(0x1F0, src, n * SECTSIZE / 4);
+        src += n * SECTSIZE;
+        nsecs -= n;
+        if ((r = ide_wait_irq(1)) < 0) return r;
     }
 
     return 0;
 }
+
+/* Find the bus master registers of the PCI IDE controller
+ * on bus 0 and let it master the bus */
+static void
+ide_dma_init(void) {
+    for (uint32_t tag = 0; tag < PCI_NTAGS; tag += PCI_TAG_STEP) {
+        if (pci_conf_read(tag, 0x00) == 0xFFFFFFFF) continue;
+
+        /* Mass storage, IDE, bus master capable */
+        uint32_t class = pci_conf_read(tag, 0x08);
+        if ((class >> 16) != 0x0101 || !(class & (0x80 << 8))) continue;
+
+        uint32_t bar4 = pci_conf_read(tag, 0x20);
+        if (!(bar4 & 1)) continue;
+
+        /* I/O space and bus master enable */
+        pci_conf_write(tag, 0x04, (pci_conf_read(tag, 0x04) & 0xFFFF) | 0x5);
+
+        int64_t pa = sys_region_phys(ide_prd, 1);
+        if (pa < 0 || pa + sizeof(ide_prd) > 0x100000000LL) return;
+
+        ide_prd_pa = pa;
+        ide_bmide = bar4 & 0xFFFC;
+        outb(ide_bmide + BMIDE_STATUS, inb(ide_bmide + BMIDE_STATUS) | BMIDE_STATUS_DMA(diskno & 1));
+        return;
+    }
+}
+
+struct Blockdev ide_blockdev = {
+        .bd_name = "ide",
+        .bd_read = ide_read,
+        .bd_write = ide_write,
+};
+
+/* Enable the drive interrupt and switch to the fastest
+ * transfer modes the drive supports */
+void
+ide_init(void) {
+    static uint16_t id[256];
+
+    ide_wait_ready(0);
+    outb(0x3F6, 0); /* clear nIEN */
+
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4));
+    outb(0x1F7, 0xEC); /* IDENTIFY DEVICE */
+    ide_delay();
+    if (ide_wait_irq(1) < 0) {
+        cprintf("IDE: IDENTIFY failed, single sector transfers\n");
+        return;
+    }
+    insl(0x1F0, id, sizeof(id) / 4);
+
+    ide_lba48 = (id[83] & (1 << 10)) != 0;
+
+    if ((id[47] & 0xFF) >= BLKSECTS) {
+        outb(0x1F2, BLKSECTS);
+        outb(0x1F6, 0xE0 | ((diskno & 1) << 4));
+        outb(0x1F7, 0xC6); /* SET MULTIPLE MODE */
+        ide_delay();
+        if (ide_wait_irq(1) == 0) ide_multiple = BLKSECTS;
+    }
+
+    /* Capabilities: DMA supported */
+    if (id[49] & (1 << 8)) ide_dma_init();
+
+    cprintf("IDE: %d sectors per interrupt%s%s\n", (int)ide_multiple,
+            ide_lba48 ? ", LBA48" : "", ide_bmide ? ", DMA" : "");
+}
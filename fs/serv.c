@@ -111,7 +111,7 @@ serve_open(envid_t envid, struct Fsreq_open *req,
 
     /* Open the file */
     if (req->req_omode & O_CREAT) {
-        if ((res = file_create(path, &f)) < 0) {
+        if ((res = (req->req_omode & O_MKDIR ? file_mkdir : file_create)(path, &f)) < 0) {
             if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
                 goto try_open;
             if (debug) cprintf("file_create failed: %i", res);
@@ -209,6 +209,39 @@ serve_read(envid_t envid, union Fsipc *ipc) {
     return read;
 }
 
+/* Map up to req->req_n bytes of req_fileid from the current seek
+ * position, which must be block aligned, read-only at BULKMAP and
+ * return that region in *pg_store, *size_store and *perm_store.
+ * Update the seek position and return the number of bytes mapped,
+ * or < 0 on error. */
+int
+serve_read_bulk(envid_t envid, union Fsipc *ipc,
+                void **pg_store, size_t *size_store, int *perm_store) {
+    struct Fsreq_read *req = &ipc->read;
+
+    if (debug) {
+        cprintf("serve_read_bulk %08x %08x %08x\n",
+                envid, req->req_fileid, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) {
+        return res;
+    }
+    ssize_t read = file_map_read(o->o_file, (void *)BULKMAP, MIN(req->req_n, FSREQ_BULK_MAX), o->o_fd->fd_offset);
+    if (read <= 0) {
+        sys_unmap_region(CURENVID, (void *)BULKMAP, FSREQ_BULK_MAX);
+        return read;
+    }
+    o->o_fd->fd_offset += read;
+
+    *pg_store = (void *)BULKMAP;
+    *size_store = read;
+    *perm_store = PROT_R | PROT_LAZY;
+    return read;
+}
+
 /* Write req->req_n bytes from req->req_buf to req_fileid, starting at
  * the current seek position, and update the seek position
  * accordingly.  Extend the file if necessary.  Returns the number of
@@ -269,6 +302,7 @@ serve_flush(envid_t envid, union Fsipc *ipc) {
 int
 serve_sync(envid_t envid, union Fsipc *req) {
     fs_sync();
+    if (debug) bio_print_stats();
     return 0;
 }
 
@@ -294,6 +328,56 @@ snapshot_delete(envid_t envid, union Fsipc *req) {
     return fs_delete_snapshot(req->snapshot_delete.name);
 }
 
+int
+snapshot_gc(envid_t envid, union Fsipc *req) {
+    return fs_gc_snapshots();
+}
+
+int
+snapshot_diff(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_sh_diff *req = &ipc->snapshot_diff;
+    struct Fsret_sh_diff *ret = &ipc->snapshot_diffRet;
+
+    /* The reply overwrites the request */
+    char from[MAX_SH_LENGTH], to[MAX_SH_LENGTH];
+    struct Sh_diff_cursor cursor = req->cursor;
+    strncpy(from, req->from, MAX_SH_LENGTH - 1);
+    from[MAX_SH_LENGTH - 1] = 0;
+    strncpy(to, req->to, MAX_SH_LENGTH - 1);
+    to[MAX_SH_LENGTH - 1] = 0;
+
+    int res = fs_diff_snapshots(from, to, &cursor, ret->ret_records, SH_DIFF_RECORDS);
+    if (res < 0) return res;
+
+    ret->ret_cursor = cursor;
+    ret->ret_count = res;
+    return 0;
+}
+
+int
+snapshot_send(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_sh_send *req = &ipc->snapshot_send;
+
+    char from[MAX_SH_LENGTH], name[MAX_SH_LENGTH], path[MAXPATHLEN];
+    strncpy(from, req->from, MAX_SH_LENGTH - 1);
+    from[MAX_SH_LENGTH - 1] = 0;
+    strncpy(name, req->name, MAX_SH_LENGTH - 1);
+    name[MAX_SH_LENGTH - 1] = 0;
+    strncpy(path, req->path, MAXPATHLEN - 1);
+    path[MAXPATHLEN - 1] = 0;
+
+    return fs_send_snapshot(from, name, path);
+}
+
+int
+snapshot_recv(envid_t envid, union Fsipc *ipc) {
+    char path[MAXPATHLEN];
+    strncpy(path, ipc->snapshot_recv.path, MAXPATHLEN - 1);
+    path[MAXPATHLEN - 1] = 0;
+
+    return fs_receive_snapshot(path);
+}
+
 /************************************************** snapshot end *****************************************/
 
 /************************************************** df start *********************************************/
@@ -308,12 +392,24 @@ diskfree_busy() {
     return df_busy_bytes();
 }
 
+int
+diskfree_snapshots(envid_t envid, union Fsipc *ipc) {
+    /* The reply overwrites the request */
+    int start = ipc->df_snapshots.req_start;
+
+    int res = df_snapshots(start, ipc->df_snapshotsRet.ret_snapshots, DF_SNAPSHOTS);
+    if (res < 0) return res;
+
+    ipc->df_snapshotsRet.ret_count = res;
+    return 0;
+}
+
 /************************************************** df end ***********************************************/
 
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-        /* Open is handled specially because it passes pages */
+        /* Open and bulk read are handled specially because they pass pages */
         //[FSREQ_OPEN] =   (fshandler)serve_open,
         [FSREQ_READ] = serve_read,
         [FSREQ_STAT] = serve_stat,
@@ -326,9 +422,14 @@ fshandler handlers[] = {
         [FSREQ_SH_PRINT] = snapshot_print,
         [FSREQ_SH_ACCEPT] = snapshot_accept,
         [FSREQ_SH_DELETE] = snapshot_delete,
+        [FSREQ_SH_GC] = snapshot_gc,
+        [FSREQ_SH_DIFF] = snapshot_diff,
+        [FSREQ_SH_SEND] = snapshot_send,
+        [FSREQ_SH_RECV] = snapshot_recv,
         /* df */
         [FSREQ_DF_FREE] = diskfree_free,
-        [FSREQ_DF_BUSY] = diskfree_busy};
+        [FSREQ_DF_BUSY] = diskfree_busy,
+        [FSREQ_DF_SNAPSHOTS] = diskfree_snapshots};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
 void
@@ -336,11 +437,21 @@ serve(void) {
     uint32_t req, whom;
     int perm, res;
     void *pg;
+    /* When blocks left dirty are due to be written back, 0 if none are */
+    int writeback = 0;
 
     while (1) {
         perm = 0;
         size_t sz = PAGE_SIZE;
-        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+        /* Dirty blocks are written back BC_WRITEBACK_INTERVAL seconds
+         * after they are first seen, even if no request comes by then */
+        if (!writeback && bc_dirty()) writeback = vsys_gettime() + BC_WRITEBACK_INTERVAL;
+        req = ipc_recv_timed((int32_t *)&whom, fsreq, &sz, &perm, writeback);
+        if ((int32_t)req == -E_TIMEOUT) {
+            bc_sync();
+            writeback = 0;
+            continue;
+        }
         if (debug) {
             cprintf("fs req %d from %08x [page %08lx: %s]\n",
                     req, whom, (unsigned long)get_uvpt_entry(fsreq),
@@ -354,16 +465,28 @@ serve(void) {
         }
 
         pg = NULL;
+        sz = PAGE_SIZE;
         if (req == FSREQ_OPEN) {
             res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+        } else if (req == FSREQ_READ_BULK) {
+            res = serve_read_bulk(whom, fsreq, &pg, &sz, &perm);
         } else if (req < NHANDLERS && handlers[req]) {
             res = handlers[req](whom, fsreq);
         } else {
             cprintf("Invalid request code %d from %08x\n", req, whom);
             res = -E_INVAL;
         }
-        ipc_send(whom, res, pg, PAGE_SIZE, perm);
+        /* Blocks allocated by the request reach the disk together,
+         * with everything else it flushed, in one elevator sweep */
+        flush_bitmap();
+        bio_run();
+        if (writeback && vsys_gettime() >= writeback) {
+            bc_sync();
+            writeback = 0;
+        }
+        ipc_send(whom, res, pg, sz, perm);
         sys_unmap_region(0, fsreq, PAGE_SIZE);
+        if (pg == (void *)BULKMAP) sys_unmap_region(0, pg, sz);
     }
 }
 
@@ -14,19 +14,19 @@ check_consistency(void) {
 
 void
 check_dir(struct File *dir) {
-    uint32_t *blk;
+    blockno_t blk;
     struct File *files;
 
     blockno_t nblock = dir->f_size / BLKSIZE;
     for (blockno_t i = 0; i < nblock; ++i) {
-        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+        if (file_map_block(dir, i, &blk) < 0 || blk == 0) continue;
 
-        files = (struct File *)diskaddr(*blk);
+        files = (struct File *)diskaddr(blk);
 
         for (blockno_t j = 0; j < BLKFILES; ++j) {
             struct File *f = &(files[j]);
             if (strcmp(f->f_name, "\0") != 0) {
-                blockno_t *pdiskbno = NULL;
+                blockno_t diskbno;
 
                 cprintf("checking consistency of %s\n", f->f_name);
 
@@ -34,16 +34,741 @@ check_dir(struct File *dir) {
                     if (f->f_type == FTYPE_DIR) {
                         check_dir(f);
                     }
-                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                    if (file_map_block(f, k, &diskbno) < 0 || diskbno == 0) {
                         continue;
                     }
-                    assert(!block_is_free(*pdiskbno));
+                    assert(!block_is_free(diskbno));
                 }
             }
         }
     }
 }
 
+/* A file outside any directory, kept in a block of its own,
+ * for tests that look at its block mapping directly */
+static struct File *
+scratch_file(uint32_t flags) {
+    blockno_t blockno = alloc_block();
+    if (!blockno) panic("scratch_file: %i", -E_NO_DISK);
+
+    struct File *f = diskaddr(blockno);
+    memset(f, 0, BLKSIZE);
+    strcpy(f->f_name, "scratch");
+    f->f_flags = flags;
+    return f;
+}
+
+static void
+scratch_release(struct File *f) {
+    pure_file_set_size(f, 0);
+    free_block(((uintptr_t)f - DISKMAP) / BLKSIZE);
+}
+
+/* Number of extents of a file with an extent index */
+static uint32_t
+extent_count(struct File *f) {
+    struct Extent_index *index = diskaddr(f->f_extmap);
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < index->ei_count; i++) {
+        count += ((struct Extent_leaf *)diskaddr(index->ei_entries[i].ei_leaf))->el_count;
+    }
+    return count;
+}
+
+/* Map every other block of a file to a run of disk blocks, so that
+ * each block is an extent of its own, until the extents leave the
+ * File and then split their first leaf.  Then fill the holes, which
+ * merges the extents, punch one back and truncate the file. */
+static void
+check_extents(void) {
+    const uint32_t nextents = NEXTENT_LEAF + 40, nblocks = 2 * nextents;
+    blockno_t diskbno, run, leaves[2];
+    uint32_t count, nfree = super->s_nfree;
+    int r;
+
+    struct File *f = scratch_file(FILE_EXTENTS);
+    if (!(run = alloc_extent(0, nblocks, nblocks, &count)))
+        panic("alloc_extent: %i", -E_NO_DISK);
+    f->f_size = nblocks * BLKSIZE;
+
+    for (uint32_t i = 0; i < nblocks; i += 2) {
+        if ((r = file_set_block(f, i, run + i)) < 0)
+            panic("file_set_block %u: %i", i, r);
+        if (i / 2 < NEXTENT_INLINE) {
+            assert(!f->f_extmap && f->f_nextents == i / 2 + 1);
+        } else {
+            assert(f->f_extmap && extent_count(f) == i / 2 + 1);
+        }
+    }
+    struct Extent_index *index = diskaddr(f->f_extmap);
+    assert(index->ei_count == 2);
+    leaves[0] = index->ei_entries[0].ei_leaf;
+    leaves[1] = index->ei_entries[1].ei_leaf;
+
+    for (uint32_t i = 0; i < nblocks; i++) {
+        assert(file_map_block(f, i, &diskbno) == 0);
+        assert(diskbno == (i % 2 ? 0 : run + i));
+    }
+
+    /* Every hole joins the extents on both sides of it */
+    for (uint32_t i = 1; i < nblocks; i += 2) {
+        if ((r = file_set_block(f, i, run + i)) < 0)
+            panic("file_set_block %u: %i", i, r);
+    }
+    assert(index->ei_count == 2 && extent_count(f) == 2);
+
+    /* A hole in the middle splits an extent, filling it merges it back */
+    blockno_t middle = index->ei_entries[1].ei_fileblk / 2;
+    assert(file_set_block(f, middle, 0) == 0 && extent_count(f) == 3);
+    assert(file_map_block(f, middle, &diskbno) == 0 && !diskbno);
+    assert(file_map_block(f, middle - 1, &diskbno) == 0 && diskbno == run + middle - 1);
+    assert(file_map_block(f, middle + 1, &diskbno) == 0 && diskbno == run + middle + 1);
+    assert(file_set_block(f, middle, run + middle) == 0 && extent_count(f) == 2);
+    cprintf("extent split and merge is good\n");
+
+    /* Truncating to a few blocks moves the extents back into the File */
+    blockno_t index_block = f->f_extmap;
+    pure_file_set_size(f, 3 * BLKSIZE);
+    assert(!f->f_extmap && f->f_nextents == 1);
+    assert(block_is_free(index_block) && block_is_free(leaves[0]) && block_is_free(leaves[1]));
+    for (uint32_t i = 0; i < nblocks; i++) {
+        assert(block_is_free(run + i) == (i >= 3));
+    }
+
+    scratch_release(f);
+    assert(super->s_nfree == nfree);
+    check_consistency();
+    cprintf("extent truncate is good\n");
+}
+
+/* Grow an old format file past its single indirect block and map
+ * one block under each of the second double indirect table and the
+ * triple indirect block.  Truncating into the double indirect range
+ * has to free whole subtrees past the new end and keep the rest. */
+static void
+check_indirect(void) {
+    const blockno_t dind = NDIRECT + NINDIRECT, tind = dind + NINDIRECT * NINDIRECT;
+    blockno_t diskbno, far, deep, tables[2], ttables[3];
+    uint32_t nfree = super->s_nfree;
+    char *blk;
+    int r;
+
+    struct File *f = scratch_file(0);
+    if ((r = pure_file_set_size(f, (dind + 4) * BLKSIZE)) < 0)
+        panic("pure_file_set_size: %i", r);
+    for (blockno_t i = 0; i < dind + 4; i++) {
+        assert(file_map_block(f, i, &diskbno) == 0 && diskbno);
+    }
+    if ((r = file_get_block(f, dind + 3, &blk)) < 0)
+        panic("file_get_block: %i", r);
+    strcpy(blk, msg);
+
+    if (!(far = alloc_block()) || !(deep = alloc_block()))
+        panic("alloc_block: %i", -E_NO_DISK);
+    if ((r = file_set_block(f, dind + NINDIRECT + 1, far)) < 0 ||
+        (r = file_set_block(f, tind, deep)) < 0)
+        panic("file_set_block: %i", r);
+    f->f_size = (dind + 2 * NINDIRECT) * BLKSIZE;
+
+    assert(f->f_indirect && f->f_dindirect && f->f_tindirect);
+    memmove(tables, diskaddr(f->f_dindirect), sizeof(tables));
+    ttables[0] = f->f_tindirect;
+    ttables[1] = ((blockno_t *)diskaddr(ttables[0]))[0];
+    ttables[2] = ((blockno_t *)diskaddr(ttables[1]))[0];
+    assert(tables[0] && tables[1] && ttables[1] && ttables[2]);
+    assert(file_map_block(f, dind + 3, &diskbno) == 0 && !strcmp(diskaddr(diskbno), msg));
+    assert(file_map_block(f, dind + NINDIRECT + 1, &diskbno) == 0 && diskbno == far);
+    assert(file_map_block(f, tind, &diskbno) == 0 && diskbno == deep);
+    cprintf("double and triple indirect blocks are good\n");
+
+    /* Halfway into the first double indirect table: the second table
+     * and the triple indirect tree go, the first table stays */
+    pure_file_set_size(f, (dind + NINDIRECT / 2) * BLKSIZE);
+    assert(block_is_free(far) && block_is_free(tables[1]) && block_is_free(deep));
+    for (int i = 0; i < 3; i++) assert(block_is_free(ttables[i]));
+    assert(!f->f_tindirect && ((blockno_t *)diskaddr(f->f_dindirect))[1] == 0);
+    assert(!block_is_free(f->f_dindirect) && !block_is_free(tables[0]));
+    assert(file_map_block(f, dind + 3, &diskbno) == 0 && !block_is_free(diskbno));
+
+    /* Back into the direct blocks: the whole double indirect tree goes */
+    blockno_t dindirect = f->f_dindirect, indirect = f->f_indirect;
+    pure_file_set_size(f, (NDIRECT + 2) * BLKSIZE);
+    assert(!f->f_dindirect && block_is_free(dindirect) && block_is_free(tables[0]));
+    assert(f->f_indirect == indirect && !block_is_free(indirect));
+    assert(((blockno_t *)diskaddr(indirect))[2] == 0);
+
+    scratch_release(f);
+    assert(block_is_free(indirect));
+    assert(super->s_nfree == nfree);
+    check_consistency();
+    cprintf("indirect truncate is good\n");
+}
+
+/* Extra references to a block keep it allocated until the last one
+ * is dropped, survive a flush of the delta log and do not count as
+ * free or allocated blocks */
+static void
+check_refcount(void) {
+    uint32_t nfree = super->s_nfree;
+    int r;
+
+    blockno_t blockno = alloc_block();
+    if (!blockno) panic("alloc_block: %i", -E_NO_DISK);
+    assert(block_refs(blockno) == 1 && super->s_nfree == nfree - 1);
+
+    if ((r = block_share(blockno)) < 0 || (r = block_share(blockno)) < 0)
+        panic("block_share: %i", r);
+    assert(block_refs(blockno) == 3);
+    refcount_flush();
+    assert(block_refs(blockno) == 3);
+
+    free_block(blockno);
+    assert(block_refs(blockno) == 2 && !block_is_free(blockno));
+    refcount_flush();
+    free_block(blockno);
+    assert(block_refs(blockno) == 1 && super->s_nfree == nfree - 1);
+    free_block(blockno);
+    assert(block_is_free(blockno) && block_refs(blockno) == 0);
+    assert(super->s_nfree == nfree);
+    cprintf("block reference counts are good\n");
+}
+
+/* A dirty block the CLOCK hand passes is written back before it
+ * leaves memory, so it reads back its data once evicted */
+static void
+check_bc_evict(void) {
+    blockno_t blockno = alloc_block();
+    if (!blockno) panic("alloc_block: %i", -E_NO_DISK);
+
+    char *blk = diskaddr(blockno);
+    memset(blk, 0x5a, BLKSIZE);
+    assert(is_page_dirty(blk));
+
+    /* Fault other blocks in until the dirty one is evicted */
+    for (blockno_t i = 1; is_page_present(blk) && i < super->s_nblocks; i++) {
+        if (i != blockno) (void)*(volatile char *)diskaddr(i);
+    }
+    if (is_page_present(blk)) {
+        cprintf("block cache eviction not checked: the disk fits in the cache\n");
+    } else {
+        for (size_t i = 0; i < BLKSIZE; i++) assert(blk[i] == 0x5a);
+        cprintf("block cache eviction is good\n");
+    }
+    free_block(blockno);
+}
+
+static blockno_t bio_order[8];
+static uint32_t bio_ndone;
+
+static void
+bio_record(struct Bio *bio, int res) {
+    if (res < 0) panic("bio of block %u: %i", bio->bio_blockno, res);
+    if (bio_ndone < sizeof(bio_order) / sizeof(bio_order[0])) bio_order[bio_ndone] = bio->bio_blockno;
+    bio_ndone++;
+}
+
+/* Sequential faults read ahead a doubling window, and queued writes go
+ * out in one sweep from the elevator position, adjacent ones merged
+ * into one command that still puts every block in its place */
+static void
+check_readahead(void) {
+    uint32_t count;
+    blockno_t run = alloc_extent(0, 8, 8, &count);
+    if (!run) panic("alloc_extent: %i", -E_NO_DISK);
+
+    /* Free blocks, whatever they hold need not be written */
+    sys_unmap_region(0, diskaddr(run), 8 * BLKSIZE);
+
+    (void)*(volatile char *)diskaddr(run);
+    assert(!is_page_present(diskaddr(run + 1)));
+    (void)*(volatile char *)diskaddr(run + 1);
+    assert(is_page_present(diskaddr(run + 2)) && !is_page_present(diskaddr(run + 3)));
+    (void)*(volatile char *)diskaddr(run + 3);
+    for (blockno_t i = 4; i < 7; i++) {
+        assert(is_page_present(diskaddr(run + i)));
+    }
+    assert(!is_page_present(diskaddr(run + 7)));
+    cprintf("block readahead is good\n");
+
+    for (blockno_t i = 0; i < 6; i++) {
+        memset(diskaddr(run + i), 'a' + i, BLKSIZE);
+    }
+
+    /* Put the elevator past run + 3, then queue around it */
+    bio_queue(run + 3, 1, 1, bio_record);
+    bio_run();
+    bio_ndone = 0;
+    bio_queue(run + 1, 1, 1, bio_record);
+    bio_queue(run + 5, 1, 1, bio_record);
+    bio_queue(run + 4, 1, 1, bio_record);
+    bio_queue(run + 5, 1, 1, bio_record);
+    bio_queue(run, 1, 1, bio_record);
+    bio_run();
+    assert(bio_ndone == 4);
+    assert(bio_order[0] == run + 4 && bio_order[1] == run + 5);
+    assert(bio_order[2] == run && bio_order[3] == run + 1);
+
+    sys_unmap_region(0, diskaddr(run), 6 * BLKSIZE);
+    for (blockno_t i = 0; i < 6; i++) {
+        if (i == 2) continue;
+        char *blk = diskaddr(run + i);
+        assert(blk[0] == 'a' + i && blk[BLKSIZE - 1] == 'a' + i);
+    }
+    cprintf("bio sweep order is good\n");
+
+    for (blockno_t i = 0; i < 8; i++) {
+        free_block(run + i);
+    }
+}
+
+#ifdef CONFIG_FS_TESTS
+static void
+write_file(const char *path, const char *data) {
+    struct File *f;
+    int r;
+
+    if ((r = file_open(path, &f)) < 0)
+        panic("file_open %s: %i", path, r);
+    if ((r = file_write(f, data, strlen(data), 0)) != strlen(data))
+        panic("file_write %s: %i", path, r);
+    file_flush(f);
+}
+
+static void
+expect_file(const char *path, const char *data) {
+    static char buf[64];
+    struct File *f;
+    int r;
+
+    if ((r = file_open(path, &f)) < 0)
+        panic("file_open %s: %i", path, r);
+    memset(buf, 0, sizeof(buf));
+    if ((r = file_read(f, buf, sizeof(buf) - 1, 0)) != strlen(data) || strcmp(buf, data))
+        panic("%s holds '%s' instead of '%s'", path, buf, data);
+}
+
+/* Copies of two files with the same name in different directories
+ * are indexed by the original file, not by the name */
+static void
+check_snapshot_index(void) {
+    struct Sh_diff_record records[4];
+    struct Sh_diff_cursor cursor = {0};
+    struct File *f;
+    int r;
+
+    if ((r = fs_create_snapshot("index test", "idx_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_mkdir("/idx-a", &f)) < 0 || (r = file_mkdir("/idx-b", &f)) < 0 ||
+        (r = file_create("/idx-a/same", &f)) < 0 || (r = file_create("/idx-b/same", &f)) < 0)
+        panic("file_create: %i", r);
+    write_file("/idx-a/same", "first a");
+    write_file("/idx-b/same", "first b");
+    expect_file("/idx-a/same", "first a");
+    expect_file("/idx-b/same", "first b");
+
+    if ((r = fs_create_snapshot("index test", "idx_one")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    write_file("/idx-a/same", "second a");
+    write_file("/idx-b/same", "second b");
+    if ((r = fs_create_snapshot("index test", "idx_two")) < 0)
+        panic("fs_create_snapshot: %i", r);
+
+    if ((r = fs_accept_snapshot("idx_one")) != 0)
+        panic("fs_accept_snapshot: %i", r);
+    expect_file("/idx-a/same", "first a");
+    expect_file("/idx-b/same", "first b");
+    if ((r = fs_accept_snapshot("idx_two")) != 0)
+        panic("fs_accept_snapshot: %i", r);
+    expect_file("/idx-a/same", "second a");
+    expect_file("/idx-b/same", "second b");
+
+    /* One change for each of the two files */
+    r = fs_diff_snapshots("idx_one", "idx_two", &cursor, records, 4);
+    assert(r == 2 && records[0].dr_file != records[1].dr_file);
+    assert(!strcmp(records[0].dr_name, "same") && !strcmp(records[1].dr_name, "same"));
+    cprintf("snapshot index of same named files is good\n");
+
+    if ((r = fs_accept_snapshot("idx_base")) != 0 ||
+        (r = fs_delete_snapshot("idx_one")) < 0 ||
+        (r = fs_delete_snapshot("idx_two")) < 0 ||
+        (r = fs_delete_snapshot("idx_base")) < 0 ||
+        (r = fs_gc_snapshots()) < 0)
+        panic("snapshot cleanup: %i", r);
+    check_consistency();
+}
+
+/* Create a directory with a file in a snapshot with two children and
+ * collect that snapshot, so that each child holds the creations.
+ * Switching between the children must keep what both of them contain,
+ * and a directory leaving and coming back must stay a directory. */
+static void
+check_gc_created(void) {
+    static char buf[64];
+    struct File *f;
+    int r;
+
+    if ((r = fs_create_snapshot("gc test", "gc_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_mkdir("/gc-dir", &f)) < 0)
+        panic("file_mkdir /gc-dir: %i", r);
+    if ((r = file_create("/gc-dir/created", &f)) < 0)
+        panic("file_create /gc-dir/created: %i", r);
+    if ((r = file_write(f, msg, strlen(msg), 0)) != strlen(msg))
+        panic("file_write: %i", r);
+    file_flush(f);
+
+    if ((r = fs_create_snapshot("gc test", "gc_parent")) < 0 ||
+        (r = fs_create_snapshot("gc test", "gc_first")) < 0 ||
+        (r = fs_accept_snapshot("gc_parent")) != 0 ||
+        (r = fs_create_snapshot("gc test", "gc_second")) < 0)
+        panic("snapshot tree: %i", r);
+    if ((r = fs_delete_snapshot("gc_parent")) < 0 || (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+
+    const char *names[] = {"gc_first", "gc_second", "gc_first"};
+    for (int i = 0; i < 3; i++) {
+        if ((r = fs_accept_snapshot(names[i])) != 0)
+            panic("fs_accept_snapshot %s: %i", names[i], r);
+        if ((r = file_open("/gc-dir/created", &f)) < 0)
+            panic("file_open /gc-dir/created in %s: %i", names[i], r);
+        memset(buf, 0, sizeof(buf));
+        assert(file_read(f, buf, sizeof(buf), 0) == strlen(msg) && !strcmp(buf, msg));
+        check_consistency();
+    }
+    cprintf("collected snapshot creations are good\n");
+
+    /* The base snapshot has neither, the collected creations come back */
+    if ((r = fs_accept_snapshot("gc_base")) != 0)
+        panic("fs_accept_snapshot gc_base: %i", r);
+    assert(file_open("/gc-dir", &f) == -E_NOT_FOUND);
+    if ((r = fs_accept_snapshot("gc_second")) != 0)
+        panic("fs_accept_snapshot gc_second: %i", r);
+    if ((r = file_open("/gc-dir", &f)) < 0 || f->f_type != FTYPE_DIR)
+        panic("/gc-dir is not a directory after accept: %i", r);
+    if ((r = file_open("/gc-dir/created", &f)) < 0)
+        panic("file_open /gc-dir/created: %i", r);
+    cprintf("restored snapshot creations are good\n");
+
+    /* Put the tree back as it was */
+    if ((r = fs_accept_snapshot("gc_base")) != 0)
+        panic("fs_accept_snapshot gc_base: %i", r);
+    if ((r = fs_delete_snapshot("gc_first")) < 0 ||
+        (r = fs_delete_snapshot("gc_second")) < 0 ||
+        (r = fs_delete_snapshot("gc_base")) < 0 ||
+        (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    check_consistency();
+}
+
+/* The version of 'path' the current snapshot reads */
+static struct File *
+current_version(const char *path) {
+    fileref_t ref = super->s_current_snapshot;
+    struct File *f;
+    int r;
+
+    if ((r = file_open(path, &f)) < 0)
+        panic("file_open %s: %i", path, r);
+    if ((r = resolve_file_for_read(&f, (struct File *)diskaddr(FILEREF_BLOCK(ref)) + FILEREF_SLOT(ref))) < 0)
+        panic("resolve_file_for_read %s: %i", path, r);
+    return f;
+}
+
+static blockno_t
+file_block(struct File *f, uint32_t filebno) {
+    blockno_t diskbno;
+    int r;
+
+    if ((r = file_map_block(f, filebno, &diskbno)) < 0 || !diskbno)
+        panic("file_map_block %s %u: %i", f->f_name, filebno, r);
+    return diskbno;
+}
+
+static void
+write_byte(const char *path, off_t offset, char c) {
+    struct File *f;
+    int r;
+
+    if ((r = file_open(path, &f)) < 0)
+        panic("file_open %s: %i", path, r);
+    if ((r = file_write(f, &c, 1, offset)) != 1)
+        panic("file_write %s: %i", path, r);
+    file_flush(f);
+}
+
+/* Snapshot copies share the blocks nobody wrote: a write unshares only
+ * the block written, and collecting a snapshot drops the references
+ * of its copies */
+static void
+check_refcount_snapshots(void) {
+    static char buf[2 * BLKSIZE];
+    struct File *f;
+    int r;
+
+    if ((r = fs_create_snapshot("refcount test", "rc_start")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_create("/rc-file", &f)) < 0)
+        panic("file_create /rc-file: %i", r);
+    memset(buf, 'a', sizeof(buf));
+    if ((r = file_write(f, buf, sizeof(buf), 0)) != sizeof(buf))
+        panic("file_write /rc-file: %i", r);
+    file_flush(f);
+
+    struct File *base = current_version("/rc-file");
+    blockno_t a0 = file_block(base, 0), a1 = file_block(base, 1);
+    assert(block_refs(a0) == 1 && block_refs(a1) == 1);
+
+    /* A copy in the new snapshot, its first block written */
+    if ((r = fs_create_snapshot("refcount test", "rc_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    write_byte("/rc-file", 0, 'b');
+    struct File *one = current_version("/rc-file");
+    blockno_t c0 = file_block(one, 0);
+    assert(one != base && c0 != a0 && file_block(one, 1) == a1);
+    assert(block_refs(a0) == 1 && block_refs(a1) == 2 && block_refs(c0) == 1);
+
+    /* A copy of the copy, its second block written */
+    if ((r = fs_create_snapshot("refcount test", "rc_one")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    write_byte("/rc-file", BLKSIZE, 'c');
+    struct File *two = current_version("/rc-file");
+    blockno_t c1 = file_block(two, 1);
+    assert(two != one && file_block(two, 0) == c0 && c1 != a1);
+    assert(block_refs(c0) == 2 && block_refs(a1) == 2 && block_refs(c1) == 1);
+    cprintf("shared snapshot blocks are good\n");
+
+    /* Collecting rc_one releases its copy, the newer one keeps its blocks */
+    if ((r = fs_delete_snapshot("rc_one")) < 0 || (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    assert(current_version("/rc-file") == two);
+    assert(block_refs(a0) == 1 && block_refs(a1) == 1);
+    assert(block_refs(c0) == 1 && block_refs(c1) == 1);
+    memset(buf, 0, sizeof(buf));
+    if ((r = file_read(two, buf, sizeof(buf), 0)) != sizeof(buf) ||
+        buf[0] != 'b' || buf[1] != 'a' || buf[BLKSIZE] != 'c' || buf[BLKSIZE + 1] != 'a')
+        panic("/rc-file changed by gc: %i", r);
+
+    /* Going back drops the current copy with the blocks only it had */
+    if ((r = fs_accept_snapshot("rc_base")) != 0)
+        panic("fs_accept_snapshot rc_base: %i", r);
+    assert(current_version("/rc-file") == base);
+    assert(block_is_free(c0) && block_is_free(c1));
+    assert(block_refs(a0) == 1 && block_refs(a1) == 1);
+    cprintf("collected snapshot blocks are good\n");
+
+    if ((r = fs_accept_snapshot("rc_start")) != 0)
+        panic("fs_accept_snapshot rc_start: %i", r);
+    assert(file_open("/rc-file", &f) == -E_NOT_FOUND);
+    assert(block_refs(a0) == 1 && block_refs(a1) == 1);
+    if ((r = fs_delete_snapshot("rc_base")) < 0 ||
+        (r = fs_delete_snapshot("rc_start")) < 0 ||
+        (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    assert(block_is_free(a0) && block_is_free(a1));
+    check_consistency();
+}
+
+/* The diff of a snapshot with a changed and a created file, in both
+ * directions, with a cursor that takes one record at a time */
+static void
+check_snapshot_diff(void) {
+    struct Sh_diff_record records[4];
+    struct Sh_diff_cursor cursor = {0};
+    struct File *f;
+    int r, n;
+
+    if ((r = fs_create_snapshot("diff test", "df_start")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_create("/df-old", &f)) < 0)
+        panic("file_create /df-old: %i", r);
+    write_file("/df-old", "old data");
+    if ((r = fs_create_snapshot("diff test", "df_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    write_file("/df-old", "new data!");
+    if ((r = file_create("/df-new", &f)) < 0)
+        panic("file_create /df-new: %i", r);
+    write_file("/df-new", "new file");
+    if ((r = fs_create_snapshot("diff test", "df_one")) < 0)
+        panic("fs_create_snapshot: %i", r);
+
+    for (n = 0; (r = fs_diff_snapshots("df_base", "df_one", &cursor, records + n, 1)) > 0; n += r)
+        assert(n < 3);
+    if (r < 0)
+        panic("fs_diff_snapshots df_base df_one: %i", r);
+    assert(n == 3 && cursor.dc_done);
+    assert(records[0].dr_type == SH_DIFF_CHANGED && !strcmp(records[0].dr_name, "df-old"));
+    assert(records[0].dr_start == 0 && records[0].dr_end == 1 && records[0].dr_size == 9);
+    assert(records[1].dr_type == SH_DIFF_CREATED && !strcmp(records[1].dr_name, "/df-new"));
+    assert(records[2].dr_type == SH_DIFF_CHANGED && !strcmp(records[2].dr_name, "df-new"));
+    assert(records[2].dr_start == 0 && records[2].dr_end == 1 && records[2].dr_size == 8);
+
+    /* Backwards the new file goes away and the old one shrinks back */
+    memset(&cursor, 0, sizeof(cursor));
+    for (n = 0; (r = fs_diff_snapshots("df_one", "df_base", &cursor, records + n, 1)) > 0; n += r)
+        assert(n < 3);
+    if (r < 0)
+        panic("fs_diff_snapshots df_one df_base: %i", r);
+    assert(n == 3 && cursor.dc_done);
+    assert(records[0].dr_type == SH_DIFF_CHANGED && !strcmp(records[0].dr_name, "df-old"));
+    assert(records[0].dr_start == 0 && records[0].dr_end == 1 && records[0].dr_size == 8);
+    assert(records[1].dr_type == SH_DIFF_REMOVED && !strcmp(records[1].dr_name, "/df-new"));
+    assert(records[2].dr_type == SH_DIFF_CHANGED && !strcmp(records[2].dr_name, "df-new"));
+    assert(records[2].dr_size == 0);
+    cprintf("snapshot diff is good\n");
+
+    if ((r = fs_accept_snapshot("df_start")) != 0)
+        panic("fs_accept_snapshot df_start: %i", r);
+    if ((r = fs_delete_snapshot("df_one")) < 0 ||
+        (r = fs_delete_snapshot("df_base")) < 0 ||
+        (r = fs_delete_snapshot("df_start")) < 0 ||
+        (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    check_consistency();
+}
+
+/* A snapshot sent as a stream, collected and received back brings
+ * the same files when it is accepted */
+static void
+check_snapshot_stream(void) {
+    struct File *f;
+    int r;
+
+    if ((r = fs_create_snapshot("stream test", "st_start")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_create("/st-old", &f)) < 0)
+        panic("file_create /st-old: %i", r);
+    write_file("/st-old", "old data");
+    if ((r = fs_create_snapshot("stream test", "st_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    write_file("/st-old", "new data!");
+    if ((r = file_create("/st-new", &f)) < 0)
+        panic("file_create /st-new: %i", r);
+    write_file("/st-new", "new file");
+    if ((r = fs_create_snapshot("stream test", "st_one")) < 0)
+        panic("fs_create_snapshot: %i", r);
+
+    /* The stream lives on top of st_base, where it is received */
+    if ((r = fs_accept_snapshot("st_base")) != 0)
+        panic("fs_accept_snapshot st_base: %i", r);
+    if ((r = fs_send_snapshot("st_base", "st_one", "/st-stream")) <= 0)
+        panic("fs_send_snapshot: %i", r);
+    assert(fs_receive_snapshot("/st-stream") == -E_FILE_EXISTS);
+    if ((r = fs_delete_snapshot("st_one")) < 0 || (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    expect_file("/st-old", "old data");
+    assert(file_open("/st-new", &f) == -E_NOT_FOUND);
+
+    if ((r = fs_receive_snapshot("/st-stream")) != 0)
+        panic("fs_receive_snapshot: %i", r);
+    if ((r = fs_accept_snapshot("st_one")) != 0)
+        panic("fs_accept_snapshot st_one: %i", r);
+    expect_file("/st-old", "new data!");
+    expect_file("/st-new", "new file");
+    assert(file_open("/st-stream", &f) == -E_NOT_FOUND);
+    cprintf("snapshot stream is good\n");
+
+    if ((r = fs_accept_snapshot("st_start")) != 0)
+        panic("fs_accept_snapshot st_start: %i", r);
+    if ((r = fs_delete_snapshot("st_one")) < 0 ||
+        (r = fs_delete_snapshot("st_base")) < 0 ||
+        (r = fs_delete_snapshot("st_start")) < 0 ||
+        (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    check_consistency();
+}
+
+/* Cached lookups follow creations, and a file renamed or cleared in
+ * place is no longer found by its old name */
+static void
+check_dentry_cache(void) {
+    struct File *dir, *f, *found;
+    int r;
+
+    if ((r = fs_create_snapshot("dentry test", "dc_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_mkdir("/dc-dir", &dir)) < 0)
+        panic("file_mkdir /dc-dir: %i", r);
+
+    assert(file_open("/dc-dir/dc-file", &found) == -E_NOT_FOUND);
+    if ((r = file_create("/dc-dir/dc-file", &f)) < 0)
+        panic("file_create /dc-dir/dc-file: %i", r);
+    if ((r = file_open("/dc-dir/dc-file", &found)) < 0 || found != f)
+        panic("created /dc-dir/dc-file not found: %i", r);
+
+    /* Renamed in place, like the copies of a new snapshot */
+    strcpy(f->f_name, "dc-renamed");
+    flush_block(f);
+    assert(file_open("/dc-dir/dc-file", &found) == -E_NOT_FOUND);
+    if ((r = file_open("/dc-dir/dc-renamed", &found)) < 0 || found != f)
+        panic("renamed /dc-dir/dc-renamed not found: %i", r);
+
+    /* Cleared in place, like a released file */
+    if ((r = file_create("/dc-dir/dc-gone", &f)) < 0)
+        panic("file_create /dc-dir/dc-gone: %i", r);
+    if ((r = file_open("/dc-dir/dc-gone", &found)) < 0 || found != f)
+        panic("created /dc-dir/dc-gone not found: %i", r);
+    memset(f, 0, sizeof(struct File));
+    flush_block(f);
+    assert(file_open("/dc-dir/dc-gone", &found) == -E_NOT_FOUND);
+    cprintf("dentry cache is good\n");
+
+    if ((r = fs_accept_snapshot("dc_base")) != 0)
+        panic("fs_accept_snapshot dc_base: %i", r);
+    assert(file_open("/dc-dir", &found) == -E_NOT_FOUND);
+    if ((r = fs_delete_snapshot("dc_base")) < 0 || (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    check_consistency();
+}
+
+/* A directory growing to DIRINDEX_MIN_BLOCKS gets its index from the
+ * creation, and lookups in a directory without one scan it */
+static void
+check_dir_index(void) {
+    char path[MAXPATHLEN];
+    struct File *dir, *f;
+    int r;
+
+    if ((r = fs_create_snapshot("dir index test", "dir_index_base")) < 0)
+        panic("fs_create_snapshot: %i", r);
+    if ((r = file_mkdir("/dir-index", &dir)) < 0)
+        panic("file_mkdir /dir-index: %i", r);
+
+    uint32_t nfiles = DIRINDEX_MIN_BLOCKS * BLKFILES;
+    for (uint32_t i = 0; i < nfiles; i++) {
+        snprintf(path, sizeof(path), "/dir-index/f%u", i);
+        if ((r = file_create(path, &f)) < 0)
+            panic("file_create %s: %i", path, r);
+        assert(!dir->f_dirindex == (dir->f_size < DIRINDEX_MIN_BLOCKS * BLKSIZE));
+    }
+    for (uint32_t i = 0; i < nfiles; i++) {
+        snprintf(path, sizeof(path), "/dir-index/f%u", i);
+        if ((r = file_open(path, &f)) < 0 || strcmp(f->f_name, path + strlen("/dir-index/")))
+            panic("file_open %s: %i", path, r);
+    }
+    assert(file_open("/dir-index/missing", &f) == -E_NOT_FOUND);
+    cprintf("directory index is good\n");
+
+    /* As on an image written before directories were indexed */
+    blockno_t index = dir->f_dirindex;
+    dir->f_dirindex = 0;
+    if ((r = file_open("/dir-index/f7", &f)) < 0)
+        panic("file_open /dir-index/f7: %i", r);
+    assert(file_open("/dir-index/absent", &f) == -E_NOT_FOUND);
+    assert(!dir->f_dirindex);
+    dir->f_dirindex = index;
+    flush_block(dir);
+    cprintf("unindexed directory lookup is good\n");
+
+    if ((r = fs_accept_snapshot("dir_index_base")) != 0)
+        panic("fs_accept_snapshot dir_index_base: %i", r);
+    assert(file_open("/dir-index", &f) == -E_NOT_FOUND);
+    if ((r = fs_delete_snapshot("dir_index_base")) < 0 || (r = fs_gc_snapshots()) < 0)
+        panic("snapshot gc: %i", r);
+    check_consistency();
+}
+#endif
+
 void
 fs_test(void) {
     struct File *f;
@@ -84,6 +809,7 @@ fs_test(void) {
     *(volatile char *)blk = *(volatile char *)blk;
     assert(is_page_dirty(blk));
     file_flush(f);
+    bio_run();
     assert(!is_page_dirty(blk));
     cprintf("file_flush is good\n");
 
@@ -101,7 +827,25 @@ fs_test(void) {
     strcpy(blk, msg);
     assert(is_page_dirty(blk));
     file_flush(f);
+    bio_run();
     assert(!is_page_dirty(blk));
     assert(!is_page_dirty(f));
     cprintf("file rewrite is good\n");
+
+    check_extents();
+    check_indirect();
+    check_refcount();
+    check_bc_evict();
+    check_readahead();
+#ifdef CONFIG_FS_TESTS
+    /* These change the snapshot tree and collect every deleted
+     * snapshot, so they only run on a throwaway image */
+    check_snapshot_index();
+    check_gc_created();
+    check_dir_index();
+    check_refcount_snapshots();
+    check_snapshot_diff();
+    check_snapshot_stream();
+    check_dentry_cache();
+#endif
 }
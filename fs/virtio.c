@@ -0,0 +1,315 @@
+/*
+ * Legacy virtio-blk driver (virtio 0.9.5 over a PCI I/O BAR).
+ * One virtqueue keeps up to VBLK_NREQ requests on the device at
+ * once; they complete by interrupt in whatever order the device
+ * finishes them.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define VIRTIO_VENDOR  0x1AF4
+#define VIRTIO_DEV_BLK 0x1001
+
+/* Legacy registers, relative to BAR0 */
+#define VIRTIO_HOST_FEATURES  0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN      0x08
+#define VIRTIO_QUEUE_SIZE     0x0C
+#define VIRTIO_QUEUE_SEL      0x0E
+#define VIRTIO_QUEUE_NOTIFY   0x10
+#define VIRTIO_STATUS         0x12
+#define VIRTIO_ISR            0x13
+#define VIRTIO_BLK_CAPACITY   0x14 /* 64 bit, in sectors */
+
+#define VIRTIO_STATUS_ACK       0x01
+#define VIRTIO_STATUS_DRIVER    0x02
+#define VIRTIO_STATUS_DRIVER_OK 0x04
+#define VIRTIO_STATUS_FAILED    0x80
+
+struct Vring_desc {
+    uint64_t addr;
+    uint32_t len;
+    uint16_t flags;
+    uint16_t next;
+};
+
+#define VRING_DESC_F_NEXT  1
+#define VRING_DESC_F_WRITE 2 /* device writes the buffer */
+
+struct Vring_avail {
+    uint16_t flags;
+    uint16_t idx;
+    uint16_t ring[];
+};
+
+struct Vring_used_elem {
+    uint32_t id;
+    uint32_t len;
+};
+
+struct Vring_used {
+    uint16_t flags;
+    uint16_t idx;
+    struct Vring_used_elem ring[];
+};
+
+struct Virtio_blk_hdr {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t sector;
+};
+
+#define VIRTIO_BLK_T_IN  0
+#define VIRTIO_BLK_T_OUT 1
+
+/* Largest queue we drive, and the contiguous memory its ring takes
+ * (descriptors and available ring, then the used ring on a new page) */
+#define VQ_MAX   1024
+#define VQ_BYTES (8 * PAGE_SIZE)
+
+/* Smallest queue that fits the largest transfer of the cache */
+#define VQ_MIN (2 + BIO_MAX_BLOCKS + 1)
+
+/* Requests on the device at once */
+#define VBLK_NREQ 32
+
+/* Header and status byte the device reads and writes for a request */
+struct Vblk_req {
+    struct Virtio_blk_hdr hdr;
+    uint8_t status;
+};
+
+enum {
+    VBLK_FREE,
+    VBLK_BUSY, /* on the device */
+    VBLK_DONE, /* completed, waiting for virtio_blk_wait */
+};
+
+static uint16_t vblk_io;
+static uint8_t vblk_irq;
+/* Cleared if the kernel refuses to let us sleep on the line */
+static bool vblk_irq_sleep = 1;
+
+static uint16_t vq_size;
+static volatile struct Vring_desc *vq_desc;
+static volatile struct Vring_avail *vq_avail;
+static volatile struct Vring_used *vq_used;
+static uint16_t vq_last_used;
+
+/* Free descriptors are chained through their next fields */
+static uint16_t vq_free_head, vq_nfree;
+/* Request slot of the chain starting at each descriptor */
+static uint8_t vq_slot[VQ_MAX];
+
+static struct Vblk_req *vblk_req = (struct Vblk_req *)(VIRTIO_MAP + VQ_BYTES);
+static physaddr_t vblk_req_pa;
+static uint8_t vblk_state[VBLK_NREQ];
+
+/* Take finished chains off the used ring */
+static void
+virtio_blk_reap(void) {
+    while (vq_last_used != vq_used->idx) {
+        __sync_synchronize();
+        uint16_t head = vq_used->ring[vq_last_used % vq_size].id;
+        uint16_t last = head, n = 1;
+
+        while (vq_desc[last].flags & VRING_DESC_F_NEXT) {
+            last = vq_desc[last].next;
+            n++;
+        }
+        vq_desc[last].next = vq_free_head;
+        vq_free_head = head;
+        vq_nfree += n;
+
+        vblk_state[vq_slot[head]] = VBLK_DONE;
+        vq_last_used++;
+    }
+}
+
+/* Wait until the device has finished some request.  The interrupt
+ * count is sampled before the used ring is looked at, so a completion
+ * in between makes sys_irq_wait return at once. */
+static void
+virtio_blk_sleep(void) {
+    for (;;) {
+        int seen = vsys_irqs(vblk_irq);
+
+        /* Reading ISR acknowledges the interrupt and lowers the line */
+        inb(vblk_io + VIRTIO_ISR);
+        if (vq_last_used != vq_used->idx) break;
+
+        if (vblk_irq_sleep && sys_irq_wait(vblk_irq, seen) < 0) vblk_irq_sleep = 0;
+    }
+    virtio_blk_reap();
+}
+
+static int
+virtio_blk_submit(uint32_t secno, void *buf, size_t nsecs, bool write) {
+    size_t len = nsecs * SECTSIZE;
+    size_t npages = (ROUNDUP((uintptr_t)buf + len, PAGE_SIZE) - ROUNDDOWN((uintptr_t)buf, PAGE_SIZE)) / PAGE_SIZE;
+    size_t ndesc = 2 + npages;
+    int slot;
+
+    assert(ndesc <= vq_size);
+
+    for (slot = 0; slot < VBLK_NREQ && vblk_state[slot] != VBLK_FREE; slot++) /* nothing */
+        ;
+    if (slot == VBLK_NREQ) return -E_NO_MEM;
+
+    /* Only requests on the device hold descriptors */
+    while (vq_nfree < ndesc) virtio_blk_sleep();
+
+    struct Vblk_req *req = &vblk_req[slot];
+    physaddr_t req_pa = vblk_req_pa + slot * sizeof(*req);
+    req->hdr.type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    req->hdr.reserved = 0;
+    req->hdr.sector = secno;
+    req->status = 0xFF;
+
+    /* Fill the chain along the free list, which is only
+     * cut off behind it once nothing can fail any more */
+    uint16_t head = vq_free_head, d = head;
+
+    vq_desc[d].addr = req_pa + offsetof(struct Vblk_req, hdr);
+    vq_desc[d].len = sizeof(req->hdr);
+    vq_desc[d].flags = VRING_DESC_F_NEXT;
+    d = vq_desc[d].next;
+
+    for (size_t off = 0; off < len;) {
+        size_t n = MIN(len - off, PAGE_SIZE - ((uintptr_t)buf + off) % PAGE_SIZE);
+        int64_t pa = sys_region_phys(buf + off, !write);
+        if (pa < 0) return pa;
+
+        vq_desc[d].addr = pa;
+        vq_desc[d].len = n;
+        vq_desc[d].flags = VRING_DESC_F_NEXT | (write ? 0 : VRING_DESC_F_WRITE);
+        d = vq_desc[d].next;
+        off += n;
+    }
+
+    vq_desc[d].addr = req_pa + offsetof(struct Vblk_req, status);
+    vq_desc[d].len = 1;
+    vq_desc[d].flags = VRING_DESC_F_WRITE;
+
+    vq_free_head = vq_desc[d].next;
+    vq_nfree -= ndesc;
+    vq_slot[head] = slot;
+    vblk_state[slot] = VBLK_BUSY;
+
+    vq_avail->ring[vq_avail->idx % vq_size] = head;
+    __sync_synchronize();
+    vq_avail->idx++;
+    __sync_synchronize();
+    outw(vblk_io + VIRTIO_QUEUE_NOTIFY, 0);
+
+    return slot;
+}
+
+static int
+virtio_blk_wait(int tag) {
+    assert(tag >= 0 && tag < VBLK_NREQ && vblk_state[tag] != VBLK_FREE);
+
+    while (vblk_state[tag] == VBLK_BUSY) virtio_blk_sleep();
+
+    vblk_state[tag] = VBLK_FREE;
+    return vblk_req[tag].status ? -1 : 0;
+}
+
+static int
+virtio_blk_read(uint32_t secno, void *dst, size_t nsecs) {
+    int tag = virtio_blk_submit(secno, dst, nsecs, 0);
+    return tag < 0 ? tag : virtio_blk_wait(tag);
+}
+
+static int
+virtio_blk_write(uint32_t secno, const void *src, size_t nsecs) {
+    int tag = virtio_blk_submit(secno, (void *)src, nsecs, 1);
+    return tag < 0 ? tag : virtio_blk_wait(tag);
+}
+
+struct Blockdev virtio_blockdev = {
+        .bd_name = "virtio-blk",
+        .bd_read = virtio_blk_read,
+        .bd_write = virtio_blk_write,
+        .bd_submit = virtio_blk_submit,
+        .bd_wait = virtio_blk_wait,
+};
+
+/* Set up the queue memory.  The ring has to be physically
+ * contiguous, so it and the request headers after it take one
+ * DMA allocation.  The device is told the ring's page number
+ * in 32 bits. */
+static bool
+virtio_blk_alloc(void) {
+    int64_t pa = sys_alloc_dma((void *)VIRTIO_MAP, VQ_BYTES + PAGE_SIZE, PROT_RW | PROT_SHARE);
+    if (pa < 0) return 0;
+    if (pa / PAGE_SIZE > UINT32_MAX) {
+        sys_unmap_region(CURENVID, (void *)VIRTIO_MAP, VQ_BYTES + PAGE_SIZE);
+        return 0;
+    }
+
+    vblk_req_pa = pa + VQ_BYTES;
+
+    outl(vblk_io + VIRTIO_QUEUE_PFN, pa / PAGE_SIZE);
+    return 1;
+}
+
+/* Find a virtio-blk device on PCI bus 0 and bring it up.
+ * Returns 0 if there is none, the caller falls back to IDE. */
+bool
+virtio_blk_init(void) {
+    uint32_t tag;
+
+    for (tag = 0; tag < PCI_NTAGS; tag += PCI_TAG_STEP) {
+        uint32_t id = pci_conf_read(tag, 0x00);
+        if ((id & 0xFFFF) == VIRTIO_VENDOR && (id >> 16) == VIRTIO_DEV_BLK) break;
+    }
+    if (tag == PCI_NTAGS) return 0;
+
+    uint32_t bar0 = pci_conf_read(tag, 0x10);
+    if (!(bar0 & 1)) return 0;
+    vblk_io = bar0 & 0xFFFC;
+    vblk_irq = pci_conf_read(tag, 0x3C) & 0xFF;
+
+    /* I/O space and bus master enable */
+    pci_conf_write(tag, 0x04, (pci_conf_read(tag, 0x04) & 0xFFFF) | 0x5);
+
+    outb(vblk_io + VIRTIO_STATUS, 0);
+    outb(vblk_io + VIRTIO_STATUS, VIRTIO_STATUS_ACK);
+    outb(vblk_io + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER);
+
+    /* None of the optional features are used */
+    inl(vblk_io + VIRTIO_HOST_FEATURES);
+    outl(vblk_io + VIRTIO_GUEST_FEATURES, 0);
+
+    outw(vblk_io + VIRTIO_QUEUE_SEL, 0);
+    vq_size = inw(vblk_io + VIRTIO_QUEUE_SIZE);
+    if (vq_size < VQ_MIN || vq_size > VQ_MAX) goto fail;
+
+    size_t avail_off = vq_size * sizeof(struct Vring_desc);
+    size_t used_off = ROUNDUP(avail_off + sizeof(struct Vring_avail) + (vq_size + 1) * sizeof(uint16_t), PAGE_SIZE);
+    size_t ring_bytes = used_off + sizeof(struct Vring_used) + vq_size * sizeof(struct Vring_used_elem) + sizeof(uint16_t);
+    if (ring_bytes > VQ_BYTES || !virtio_blk_alloc()) goto fail;
+
+    vq_desc = (struct Vring_desc *)VIRTIO_MAP;
+    vq_avail = (struct Vring_avail *)(VIRTIO_MAP + avail_off);
+    vq_used = (struct Vring_used *)(VIRTIO_MAP + used_off);
+
+    for (uint16_t i = 0; i < vq_size; i++) vq_desc[i].next = i + 1;
+    vq_free_head = 0;
+    vq_nfree = vq_size;
+
+    outb(vblk_io + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
+
+    uint64_t capacity = inl(vblk_io + VIRTIO_BLK_CAPACITY) |
+                        (uint64_t)inl(vblk_io + VIRTIO_BLK_CAPACITY + 4) << 32;
+    cprintf("virtio-blk: %lu sectors, queue of %d, irq %d\n",
+            (unsigned long)capacity, vq_size, vblk_irq);
+    return 1;
+
+fail:
+    outb(vblk_io + VIRTIO_STATUS, VIRTIO_STATUS_FAILED);
+    cprintf("virtio-blk: cannot set up the queue\n");
+    return 0;
+}
@@ -82,6 +82,7 @@ struct Env {
     uint32_t env_ipc_value;  /* Data value sent to us */
     envid_t env_ipc_from;    /* envid of the sender */
     int env_ipc_perm;        /* Perm of page mapping received */
+    int env_ipc_deadline;    /* gettime() at which receiving times out, 0 if never */
 };
 
 #endif /* !JOS_INC_ENV_H */
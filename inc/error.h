@@ -27,6 +27,7 @@ enum {
     E_FILE_EXISTS = 17, /* File already exists */
     E_NOT_EXEC = 18,    /* File not a valid executable */
     E_NOT_SUPP = 19,    /* Operation not supported */
+    E_TIMEOUT = 20,     /* Timed out waiting */
     MAXERROR
 };
 
@@ -17,6 +17,7 @@ struct Dev {
     int dev_id;
     const char *dev_name;
     ssize_t (*dev_read)(struct Fd *fd, void *buf, size_t len);
+    ssize_t (*dev_readmap)(struct Fd *fd, void *buf, size_t len);
     ssize_t (*dev_write)(struct Fd *fd, const void *buf, size_t len);
     int (*dev_close)(struct Fd *fd);
     int (*dev_stat)(struct Fd *fd, struct Stat *stat);
@@ -26,9 +27,14 @@ struct Dev {
     int (*dev_sh_print)();
     int (*dev_sh_accept)(char *name);
     int (*dev_sh_delete)(char *name);
+    int (*dev_sh_gc)();
+    int (*dev_sh_diff)(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records);
+    int (*dev_sh_send)(char *from, char *name, char *path);
+    int (*dev_sh_recv)(char *path);
     /**************** df *****************************************************/
     int (*dev_df_free)();
     int (*dev_df_busy)();
+    int (*dev_df_snapshots)(int start, struct Df_snapshot *records);
 };
 
 struct FdFile {
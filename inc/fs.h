@@ -26,7 +26,10 @@ typedef uint32_t blockno_t;
 /* Number of direct block pointers in an indirect block */
 #define NINDIRECT (BLKSIZE / 4)
 
-#define MAXFILESIZE ((NDIRECT + NINDIRECT) * BLKSIZE)
+/* Maximum number of blocks of a file mapped by direct and
+ * single, double and triple indirect blocks */
+#define MAXFILEBLOCKS (NDIRECT + NINDIRECT + NINDIRECT * NINDIRECT + \
+                       NINDIRECT * NINDIRECT * NINDIRECT)
 
 #define SETBIT(v, n) ((v)[(n / 32)] |= 1U << ((n) % 32))
 #define CLRBIT(v, n) ((v)[(n / 32)] &= ~(1U << ((n) % 32)))
@@ -37,11 +40,39 @@ typedef uint32_t blockno_t;
 #define SNAP_BUF_SIZE 100
 #define MAX_SH_LENGTH 256
 
-#define MAXBRANCHES 10
-#define MAXFILESSNAP 10
+/* Types of snapshot entries */
+#define SH_ENTRY_FREE     0 /* Unused, linked into the free list */
+#define SH_ENTRY_MODIFIED 1 /* Copy of a file modified in the snapshot */
+#define SH_ENTRY_CREATED  2 /* File created in the snapshot */
+#define SH_ENTRY_CHILD    3 /* Next snapshot */
+
+/* Stable on-disk reference to a struct File: number of the block that
+ * holds it and its slot within the block.  Zero is the null reference.
+ * The root directory lives in the superblock and has a slot of its own. */
+typedef uint64_t fileref_t;
+
+#define FILEREF(blockno, slot) (((uint64_t)(blockno) << 32) | (uint32_t)(slot))
+#define FILEREF_BLOCK(ref)     ((blockno_t)((ref) >> 32))
+#define FILEREF_SLOT(ref)      ((uint32_t)(ref))
+#define FILEREF_ROOT_SLOT      0xFFFFFFFFU
+
+/* Types of snapshot diff records */
+#define SH_DIFF_CHANGED 1 /* Blocks [dr_start, dr_end) of the file differ */
+#define SH_DIFF_CREATED 2 /* File exists only in the second snapshot */
+#define SH_DIFF_REMOVED 3 /* File exists only in the first snapshot */
 
 /***************************** snaphot defines end  ******************************/
 
+/* Run of e_len blocks of a file starting at e_fileblk,
+ * stored on disk contiguously from e_diskblk */
+struct File_extent {
+    uint32_t e_fileblk;
+    uint32_t e_len;
+    blockno_t e_diskblk;
+} __attribute__((packed));
+
+#define NEXTENT_INLINE 8
+
 struct File {
     char f_name[MAXNAMELEN]; /* filename */
     off_t f_size;            /* file size in bytes */
@@ -49,17 +80,70 @@ struct File {
 
     /* Block pointers. */
     /* A block is allocated iff its value is != 0. */
-    blockno_t f_direct[NDIRECT]; /* direct blocks */
-    blockno_t f_indirect;        /* indirect block */
+    union {
+        /* Old format: direct and single indirect blocks */
+        struct {
+            blockno_t f_direct[NDIRECT]; /* direct blocks */
+            blockno_t f_indirect;        /* indirect block */
+            blockno_t f_dindirect;       /* double indirect block */
+            blockno_t f_tindirect;       /* triple indirect block */
+        } __attribute__((packed));
+        /* FILE_EXTENTS: runs of contiguous blocks */
+        struct {
+            struct File_extent f_extents[NEXTENT_INLINE]; /* inline extents */
+            blockno_t f_extmap;                           /* Extent_index block */
+        } __attribute__((packed));
+    };
+    uint32_t f_nextents; /* number of inline extents in use */
+    uint32_t f_flags;    /* FILE_* flags */
+    blockno_t f_dirindex; /* Dir_index block of a directory, or 0 */
 
     /* Pad out to 256 bytes; must do arithmetic in case we're compiling
      * fsformat on a 64-bit machine. */
-    uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 * NDIRECT - 4];
+    uint8_t f_pad[256 - MAXNAMELEN - 8 - 12 * NEXTENT_INLINE - 4 - 12];
 } __attribute__((packed)); /* required only on some 64-bit machines */
 
+/* File flags */
+#define FILE_EXTENTS 1 /* Blocks are mapped by extents */
+
+/* Extent map of a file whose extents do not fit inline: one index block
+ * pointing to leaf blocks sorted by the first file block they map. */
+#define NEXTENT_LEAVES ((BLKSIZE - 4) / 8)
+#define NEXTENT_LEAF   ((BLKSIZE - 4) / sizeof(struct File_extent))
+
+struct Extent_index {
+    uint32_t ei_count;
+    struct {
+        uint32_t ei_fileblk; /* first file block mapped by the leaf */
+        blockno_t ei_leaf;   /* leaf block */
+    } __attribute__((packed)) ei_entries[NEXTENT_LEAVES];
+} __attribute__((packed));
+
+struct Extent_leaf {
+    uint32_t el_count;
+    struct File_extent el_extents[NEXTENT_LEAF];
+} __attribute__((packed));
+
 /* An inode block contains exactly BLKFILES 'struct File's */
 #define BLKFILES (BLKSIZE / sizeof(struct File))
 
+/* Hash index of a directory: an open addressing table of Dir_entry
+ * spread over the blocks listed in the Dir_index block.  de_file is
+ * the place of the File on disk, block * BLKFILES + slot, 0 if unused. */
+struct Dir_entry {
+    uint32_t de_hash;
+    uint32_t de_file;
+};
+
+#define DIRINDEX_ENTRIES (BLKSIZE / sizeof(struct Dir_entry))
+#define DIRINDEX_NBLOCKS 512 /* power of two */
+
+struct Dir_index {
+    uint32_t di_nblocks; /* table blocks, a power of two */
+    uint32_t di_nused;   /* entries in use, stale ones included */
+    blockno_t di_blocks[DIRINDEX_NBLOCKS];
+};
+
 /* File types */
 #define FTYPE_REG 0 /* Regular file */
 #define FTYPE_DIR 1 /* Directory */
@@ -72,8 +156,21 @@ struct Super {
     uint32_t s_magic;    /* Magic number: FS_MAGIC */
     blockno_t s_nblocks; /* Total number of blocks on disk */
     struct File s_root;  /* Root directory node */
+    /* Snapshot files, where images older than FS_VERSION_SUPER
+     * kept them as pointers into the block cache */
+    fileref_t s_root_snapshot;    /* Root of the snapshot tree */
+    fileref_t s_snapshot_dir;     /* SNAPDIR */
+    fileref_t s_snapshot_config;  /* SNAPCFG */
+    fileref_t s_current_snapshot; /* Snapshot receiving changes */
+    blockno_t s_refmap;  /* Block listing the reference count table blocks */
+    uint32_t s_nfree;    /* Number of free blocks */
+    uint32_t s_version;  /* On-disk format version */
 };
 
+/* Format versions */
+#define FS_VERSION_EXTENTS 1 /* New files are mapped by extents */
+#define FS_VERSION_SUPER   2 /* Fields after s_root are valid */
+
 /* Definitions for requests from clients to file system */
 enum {
     FSREQ_OPEN = 1,
@@ -90,12 +187,72 @@ enum {
     FSREQ_SH_PRINT,
     FSREQ_SH_ACCEPT,
     FSREQ_SH_DELETE,
+    FSREQ_SH_GC,
+    /* Snapshot diff returns a Fsret_sh_diff on the request page */
+    FSREQ_SH_DIFF,
+    FSREQ_SH_SEND,
+    FSREQ_SH_RECV,
     /* df requests */
     FSREQ_DF_FREE,
     FSREQ_DF_BUSY,
-    FSREQ_SYNC
+    /* Snapshot space returns a Fsret_df_snapshots on the request page */
+    FSREQ_DF_SNAPSHOTS,
+    FSREQ_SYNC,
+    /* Bulk read takes a Fsreq_read and returns the file's blocks
+     * as a read-only region instead of on the request page */
+    FSREQ_READ_BULK
 };
 
+/* Largest region one FSREQ_READ_BULK returns */
+#define FSREQ_BULK_MAX (256 * PAGE_SIZE)
+
+/* Position in a snapshot diff, passed back by the client to get the
+ * next part of the diff.  A zeroed cursor starts from the beginning. */
+struct Sh_diff_cursor {
+    fileref_t dc_snapshot; /* snapshot being walked */
+    uint32_t dc_entry;     /* entry of the snapshot */
+    uint32_t dc_block;     /* first block of the entry's file not reported yet */
+    bool dc_done;
+};
+
+struct Sh_diff_record {
+    char dr_name[MAXNAMELEN];
+    fileref_t dr_file;  /* original file, only valid on this file system */
+    uint32_t dr_type;   /* SH_DIFF_* */
+    blockno_t dr_start; /* changed block range, SH_DIFF_CHANGED only */
+    blockno_t dr_end;
+    off_t dr_size;      /* file size in the second snapshot */
+};
+
+#define SH_DIFF_RECORDS ((PAGE_SIZE - sizeof(struct Sh_diff_cursor) - sizeof(int)) / sizeof(struct Sh_diff_record))
+
+/* Snapshot stream: a header followed by ss_nrecords diff records.
+ * Every SH_DIFF_CHANGED record is followed by the contents of its
+ * blocks [dr_start, dr_end) that lie within dr_size, BLKSIZE each. */
+#define SH_STREAM_MAGIC   0x5348534D /* 'SHSM' */
+#define SH_STREAM_VERSION 2
+
+struct Sh_stream_header {
+    uint32_t ss_magic;   /* SH_STREAM_MAGIC */
+    uint32_t ss_version; /* SH_STREAM_VERSION */
+    char ss_parent[MAXNAMELEN]; /* snapshot the stream applies to */
+    char ss_name[MAXNAMELEN];
+    char ss_comment[100];
+    int ss_date;
+    uint32_t ss_nrecords;
+};
+
+/* Space used by a snapshot: exclusive blocks are freed together with
+ * the snapshot, shared ones are also referenced by other files */
+struct Df_snapshot {
+    char ds_name[MAXNAMELEN];
+    off_t ds_exclusive;
+    off_t ds_shared;
+    bool ds_deleted;
+};
+
+#define DF_SNAPSHOTS ((PAGE_SIZE - sizeof(int)) / sizeof(struct Df_snapshot))
+
 union Fsipc {
     struct Fsreq_open {
         char req_path[MAXPATHLEN];
@@ -141,6 +298,31 @@ union Fsipc {
     struct Fsreq_sh_delete {
         char name[MAX_SH_LENGTH];
     } snapshot_delete;
+    struct Fsreq_sh_diff {
+        char from[MAX_SH_LENGTH];
+        char to[MAX_SH_LENGTH];
+        struct Sh_diff_cursor cursor;
+    } snapshot_diff;
+    struct Fsret_sh_diff {
+        struct Sh_diff_cursor ret_cursor;
+        int ret_count;
+        struct Sh_diff_record ret_records[SH_DIFF_RECORDS];
+    } snapshot_diffRet;
+    struct Fsreq_sh_send {
+        char from[MAX_SH_LENGTH];
+        char name[MAX_SH_LENGTH];
+        char path[MAXPATHLEN];
+    } snapshot_send;
+    struct Fsreq_sh_recv {
+        char path[MAXPATHLEN];
+    } snapshot_recv;
+    struct Fsreq_df_snapshots {
+        int req_start;
+    } df_snapshots;
+    struct Fsret_df_snapshots {
+        int ret_count;
+        struct Df_snapshot ret_snapshots[DF_SNAPSHOTS];
+    } df_snapshotsRet;
     /* Ensure Fsipc is one page */
     char _pad[PAGE_SIZE];
 };
@@ -154,13 +336,27 @@ struct Snapshot_header
   bool is_deleted;
 
   uint32_t old_bitmap;
-  uint64_t prev_snapshot;
-  uint64_t next_snapshot[MAXBRANCHES];
+  fileref_t prev_snapshot;
 
-  uint64_t modified_files[MAXFILESSNAP];
+  uint32_t entries_size;  /* number of entries, including free ones */
+  uint32_t free_entries;  /* head of the free list (entry number + 1) */
+};
 
-  uint64_t created_files[MAXFILESSNAP];
-  char created_files_names[MAXFILESSNAP][MAXNAMELEN];
+/* Variable-length list of snapshot entries stored after the header.
+ * Modified files are also indexed by the hash of the reference to the
+ * original file: entries with the same bucket are chained through
+ * se_next (entry number + 1, 0 terminates the chain).  Free entries are
+ * chained the same way starting from free_entries. */
+struct Snapshot_entry
+{
+  uint32_t se_type;
+  uint32_t se_hash;
+  uint32_t se_next;
+  fileref_t se_file;
+  fileref_t se_orig;        /* original of a modified file's copy, 0 if
+                               received for a file that does not exist */
+  uint32_t se_ftype;        /* type of a created file */
+  char se_name[MAXNAMELEN]; /* path of a created file, name of a modified one */
 };
 
 struct Snapshot_config 
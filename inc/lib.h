@@ -93,9 +93,14 @@ int sys_map_region(envid_t src_env, void *src_pg,
 int sys_unmap_region(envid_t env, void *pg, size_t size);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
+int sys_ipc_recv_timed(void *rcv_pg, size_t size, int deadline);
 int sys_gettime(void);
+int sys_irq_wait(uint8_t irq, int seen);
+int64_t sys_region_phys(const void *va, bool write);
+int64_t sys_alloc_dma(void *va, size_t size, int perm);
 
 int vsys_gettime(void);
+int vsys_irqs(uint8_t irq);
 
 /* This must be inlined. Exercise for reader: why? */
 static inline envid_t __attribute__((always_inline))
@@ -110,6 +115,7 @@ sys_exofork(void) {
 /* ipc.c */
 void ipc_send(envid_t to_env, uint32_t value, void *pg, size_t size, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
+int32_t ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store, int deadline);
 envid_t ipc_find_env(enum EnvType type);
 
 /* fork.c */
@@ -121,11 +127,13 @@ int foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *a
 pte_t get_uvpt_entry(void *addr);
 int get_prot(void *va);
 bool is_page_dirty(void *va);
+bool is_page_accessed(void *va);
 bool is_page_present(void *va);
 
 /* fd.c */
 int close(int fd);
 ssize_t read(int fd, void *buf, size_t nbytes);
+ssize_t readmap(int fd, void *buf, size_t nbytes);
 ssize_t write(int fd, const void *buf, size_t nbytes);
 int seek(int fd, off_t offset);
 void close_all(void);
@@ -139,10 +147,15 @@ int create_snapshot(char *comment, char *name);
 int print_snapshot_list();
 int accept_snapshot(char *name);
 int delete_snapshot(char *name);
+int gc_snapshots();
+int diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records);
+int send_snapshot(char *from, char *name, char *path);
+int receive_snapshot(char *path);
 
 // df
 int free_space_bytes();
 int busy_space_bytes();
+int snapshots_space(int start, struct Df_snapshot *records);
 
 /* file.c */
 int open(const char *path, int mode);
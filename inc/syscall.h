@@ -19,6 +19,9 @@ enum {
     SYS_ipc_try_send,
     SYS_ipc_recv,
     SYS_gettime,
+    SYS_irq_wait,
+    SYS_region_phys,
+    SYS_alloc_dma,
     NSYSCALLS
 };
 
@@ -4,7 +4,8 @@
 /* system call numbers */
 enum {
     VSYS_gettime,
-    NVSYSCALLS
+    VSYS_irqs, /* interrupts received so far, one counter per IRQ line */
+    NVSYSCALLS = VSYS_irqs + 16
 };
 
 #endif /* !JOS_INC_VSYSCALL_H */
@@ -370,6 +370,8 @@ env_free(struct Env *env) {
     release_address_space(&env->address_space);
 #endif
 
+    irq_sleep_cancel(env);
+
     /* Return the environment to the free list */
     env->env_status = ENV_FREE;
     env->env_link = env_free_list;
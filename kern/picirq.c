@@ -92,6 +92,20 @@ pic_irq_unmask(uint8_t irq) {
     }
 }
 
+/* Same as pic_irq_mask/pic_irq_unmask without the report,
+ * for device lines held masked while their driver runs */
+void
+pic_irq_mute(uint8_t irq) {
+    irq_mask_8259A |= (1 << irq);
+    if (pic_initilalized) set_irq_mask(irq_mask_8259A);
+}
+
+void
+pic_irq_unmute(uint8_t irq) {
+    irq_mask_8259A &= ~(1 << irq);
+    if (pic_initilalized) set_irq_mask(irq_mask_8259A);
+}
+
 void
 pic_send_eoi(uint8_t irq) {
     if (irq > 7) outb(IO_PIC2_CMND, PIC_EOI);
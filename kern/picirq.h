@@ -71,6 +71,8 @@ void pic_init(void);
 void pic_send_eoi(uint8_t irq);
 void pic_irq_mask(uint8_t mask);
 void pic_irq_unmask(uint8_t mask);
+void pic_irq_mute(uint8_t irq);
+void pic_irq_unmute(uint8_t irq);
 
 #endif /* !__ASSEMBLER__ */
 
@@ -1158,6 +1158,21 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     return res;
 }
 
+/* Find the physical address backing 'addr'.  With 'write' set the
+ * page is made private first and has to be writable, so that a device
+ * filling it is not seen through copy-on-write sharers. */
+int
+region_phys(struct AddressSpace *spc, uintptr_t addr, bool write, physaddr_t *pa) {
+    if (write) force_alloc_page(spc, addr, 0);
+
+    struct Page *page = page_lookup_virtual(spc->root, addr, 0, LOOKUP_PRESERVE);
+    if (!page || !page->phy) return -E_FAULT;
+    if (write && (page->state & (PROT_W | PROT_LAZY)) != PROT_W) return -E_FAULT;
+
+    *pa = page2pa(page->phy) + (addr & CLASS_MASK(page->phy->class));
+    return 0;
+}
+
 inline static int
 addr_common_class(uintptr_t addr1, uintptr_t addr2) {
     assert(!((addr1 | addr2) & CLASS_MASK(0)));
@@ -1212,6 +1227,36 @@ map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t pstart
     return 0;
 }
 
+/* Allocate one physically contiguous page of 'class' for memory a device
+ * reaches by DMA, zero it and map it at 'addr' right away, never lazily.
+ * Its physical address is stored in *pa. */
+int
+alloc_dma_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags, physaddr_t *pa) {
+    assert(!(addr & CLASS_MASK(class)));
+    assert(!(flags & PROT_LAZY));
+
+    struct Page *page = alloc_page(class, 0);
+    if (!page) return -E_NO_MEM;
+
+    int res = map_page(spc, addr, page, flags & PROT_ALL & ~PROT_COMBINE);
+    if (res < 0) {
+        /* map_page took its reference before failing, dropping it
+         * returns the page to the free lists */
+        if (page->refc) page_unref(page);
+        return res;
+    }
+
+    assert(current_space);
+    struct AddressSpace *old = switch_address_space(spc);
+    set_wp(0);
+    nosan_memset((void *)addr, 0, CLASS_SIZE(class));
+    set_wp(1);
+    switch_address_space(old);
+
+    *pa = page2pa(page);
+    return 0;
+}
+
 /* Allocate page (possibly physically discontiguous) and map it to address space */
 int
 alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags) {
@@ -110,6 +110,8 @@ struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
+int region_phys(struct AddressSpace *spc, uintptr_t addr, bool write, physaddr_t *pa);
+int alloc_dma_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags, physaddr_t *pa);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
@@ -2,6 +2,7 @@
 #include <inc/x86.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/trap.h>
 
 
 struct Taskstate cpu_ts;
@@ -58,8 +59,12 @@ sched_halt(void) {
     int i;
     for (i = 0; i < NENV; i++)
         if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    if (i == NENV) {
+            envs[i].env_status == ENV_RUNNING ||
+            (envs[i].env_status == ENV_NOT_RUNNABLE &&
+             envs[i].env_ipc_recving && envs[i].env_ipc_deadline)) break;
+    /* An environment sleeping on a device interrupt or in a timed
+     * receive will be woken */
+    if (i == NENV && !irq_sleeping()) {
         cprintf("No runnable environments in the system!\n");
         for (;;) monitor(NULL);
     }
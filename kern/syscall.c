@@ -4,15 +4,18 @@
 #include <inc/error.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/vsyscall.h>
 
 #include <kern/console.h>
 #include <kern/env.h>
 #include <kern/kclock.h>
+#include <kern/picirq.h>
 #include <kern/pmap.h>
 #include <kern/sched.h>
 #include <kern/syscall.h>
 #include <kern/trap.h>
 #include <kern/traceopt.h>
+#include <kern/vsyscall.h>
 
 /* Print a string to the system console.
  * The string is exactly 'len' characters long.
@@ -306,6 +309,8 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
  *  -E_IPC_NOT_RECV if envid is not currently blocked in sys_ipc_recv,
  *      or another environment managed to send first.
  *  -E_INVAL if srcva < MAX_USER_ADDRESS but srcva is not page-aligned.
+ *  -E_INVAL if the region to send does not fit below MAX_USER_ADDRESS
+ *      in either address space.
  *  -E_INVAL if srcva < MAX_USER_ADDRESS and perm is inappropriate
  *      (see sys_page_alloc).
  *  -E_INVAL if srcva < MAX_USER_ADDRESS but srcva is not mapped in the caller's
@@ -328,7 +333,15 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
         if (PAGE_OFFSET(srcva) || PAGE_OFFSET(to_env->env_ipc_dstva)) {
             return -E_INVAL;
         }
-        if (map_region(&to_env->address_space, to_env->env_ipc_dstva, &curenv->address_space, srcva, PAGE_SIZE, perm | PROT_USER_) < 0) {
+        size_t mapsz = size ? ROUNDUP(size, PAGE_SIZE) : PAGE_SIZE;
+        if (!mapsz) {
+            return -E_INVAL;
+        }
+        mapsz = MIN(mapsz, to_env->env_ipc_maxsz);
+        if (mapsz > MAX_USER_ADDRESS - srcva || mapsz > MAX_USER_ADDRESS - to_env->env_ipc_dstva) {
+            return -E_INVAL;
+        }
+        if (map_region(&to_env->address_space, to_env->env_ipc_dstva, &curenv->address_space, srcva, mapsz, perm | PROT_USER_) < 0) {
             return -1;
         }
         to_env->env_ipc_maxsz = MIN(size, to_env->env_ipc_maxsz);
@@ -351,6 +364,9 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
  * If 'dstva' is < MAX_USER_ADDRESS, then you are willing to receive a page of data.
  * 'dstva' is the virtual address at which the sent page should be mapped.
  *
+ * If 'deadline' is not 0, the wait ends at that gettime() second
+ * and the system call returns -E_TIMEOUT.
+ *
  * This function only returns on error, but the system call will eventually
  * return 0 on success.
  * Return < 0 on error.  Errors are:
@@ -359,7 +375,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
  *  -E_INVAL if maxsize is not page aligned.
  */
 static int
-sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
+sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize, int deadline) {
     // LAB 9: Your code here
     if (dstva < MAX_USER_ADDRESS && PAGE_OFFSET(dstva)) {
         return -E_INVAL;
@@ -371,6 +387,7 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
         return -E_INVAL;
     }
     curenv->env_ipc_recving = 1;
+    curenv->env_ipc_deadline = deadline;
     curenv->env_status = ENV_NOT_RUNNABLE;
     if (dstva < MAX_USER_ADDRESS) {
         curenv->env_ipc_dstva = dstva;
@@ -434,6 +451,63 @@ sys_region_refs(uintptr_t addr, size_t size, uintptr_t addr2, uintptr_t size2) {
     return region_maxref(current_space, addr, size) - region_maxref(current_space, addr2, size2);
 }
 
+/* Sleep until hardware interrupt 'irq' has been counted in the vsys
+ * page past 'seen', the count the caller read before checking the
+ * device.  Returns at once if the interrupt already came.
+ * The line is masked by each interrupt and unmasked here.
+ * Only the file system server may wait, and only for IRQ_DEVICES. */
+static int
+sys_irq_wait(uint8_t irq, int seen) {
+    if (irq >= 16 || !(IRQ_DEVICES & (1 << irq))) return -E_INVAL;
+    if (curenv->env_type != ENV_TYPE_FS) return -E_INVAL;
+
+    pic_irq_unmute(irq);
+    if (vsys[VSYS_irqs + irq] != seen) return 0;
+
+    irq_sleep(curenv, irq);
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    sched_yield();
+}
+
+/* Return the physical address of the caller's page at 'va', for the
+ * FS server to program bus-master DMA with.  If the device is going
+ * to write the page ('write' set) it is made private first. */
+static intptr_t
+sys_region_phys(uintptr_t va, bool write) {
+    physaddr_t pa;
+
+    if (curenv->env_type != ENV_TYPE_FS) return -E_INVAL;
+    if (va >= MAX_USER_ADDRESS) return -E_INVAL;
+
+    int res = region_phys(current_space, va, write, &pa);
+    if (res < 0) return res;
+
+    return pa;
+}
+
+/* Allocate at least 'size' bytes of physically contiguous memory at 'va'
+ * in the FS server, for rings and headers a device reaches by DMA.
+ * The memory is one page of the smallest class that holds 'size', so
+ * 'va' has to be aligned to that class.  It is mapped eagerly, never
+ * lazily.  Returns its physical address, < 0 on error. */
+static intptr_t
+sys_alloc_dma(uintptr_t va, size_t size, int perm) {
+    physaddr_t pa;
+    int class = 0;
+
+    if (curenv->env_type != ENV_TYPE_FS) return -E_INVAL;
+    if (!size || (perm & ~(PROT_R | PROT_W | PROT_SHARE))) return -E_INVAL;
+
+    while (class < MAX_ALLOCATION_CLASS && CLASS_SIZE(class) < size) class++;
+    if (CLASS_SIZE(class) < size || (va & CLASS_MASK(class))) return -E_INVAL;
+    if (va >= MAX_USER_ADDRESS || CLASS_SIZE(class) > MAX_USER_ADDRESS - va) return -E_INVAL;
+
+    int res = alloc_dma_page(current_space, va, class, perm | PROT_USER_, &pa);
+    if (res < 0) return res;
+
+    return pa;
+}
+
 /* Dispatches to the correct kernel function, passing the arguments. */
 uintptr_t
 syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
@@ -472,11 +546,17 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
     } else if (syscallno == SYS_ipc_try_send) {
         return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, a3,(size_t)a4,(int)a5);
     } else if (syscallno == SYS_ipc_recv) {
-        return sys_ipc_recv(a1, a2);
+        return sys_ipc_recv(a1, a2, (int)a3);
     } else if (syscallno == SYS_env_set_trapframe) {
         return sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
     } else if (syscallno == SYS_gettime) {
         return sys_gettime();
+    } else if (syscallno == SYS_irq_wait) {
+        return sys_irq_wait((uint8_t)a1, (int)a2);
+    } else if (syscallno == SYS_region_phys) {
+        return sys_region_phys(a1, (bool)a2);
+    } else if (syscallno == SYS_alloc_dma) {
+        return sys_alloc_dma(a1, (size_t)a2, (int)a3);
     }
     return -E_NO_SYS;
 }
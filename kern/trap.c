@@ -2,6 +2,7 @@
 #include <inc/x86.h>
 #include <inc/assert.h>
 #include <inc/string.h>
+#include <inc/error.h>
 #include <inc/vsyscall.h>
 
 #include <kern/pmap.h>
@@ -99,6 +100,60 @@ trapname(int trapno) {
     return "(unknown trap)";
 }
 
+/* Environments sleeping in sys_irq_wait, by IRQ */
+static envid_t irq_sleepers[16];
+
+void
+irq_sleep(struct Env *env, uint8_t irq) {
+    irq_sleepers[irq] = env->env_id;
+    env->env_status = ENV_NOT_RUNNABLE;
+}
+
+/* Forget the waits of an environment being freed, so that its id
+ * does not keep sched_halt from halting */
+void
+irq_sleep_cancel(struct Env *env) {
+    for (int i = 0; i < 16; i++)
+        if (irq_sleepers[i] == env->env_id) irq_sleepers[i] = 0;
+}
+
+static void
+irq_wakeup(uint8_t irq) {
+    struct Env *env;
+
+    if (irq_sleepers[irq] && envid2env(irq_sleepers[irq], &env, 0) == 0 &&
+        env->env_status == ENV_NOT_RUNNABLE) {
+        env->env_status = ENV_RUNNABLE;
+    }
+    irq_sleepers[irq] = 0;
+}
+
+/* End the receive of environments whose deadline has come */
+static void
+ipc_expire(int now) {
+    static int last;
+
+    if (now == last) return;
+    last = now;
+
+    for (size_t i = 0; i < NENV; i++) {
+        struct Env *env = &envs[i];
+        if (env->env_status == ENV_NOT_RUNNABLE && env->env_ipc_recving &&
+            env->env_ipc_deadline && env->env_ipc_deadline <= now) {
+            env->env_ipc_recving = 0;
+            env->env_tf.tf_regs.reg_rax = -E_TIMEOUT;
+            env->env_status = ENV_RUNNABLE;
+        }
+    }
+}
+
+bool
+irq_sleeping(void) {
+    for (int i = 0; i < 16; i++)
+        if (irq_sleepers[i]) return 1;
+    return 0;
+}
+
 void
 trap_init(void) {
     // LAB 4: Your code here
@@ -152,6 +207,15 @@ trap_init(void) {
     idt[IRQ_OFFSET + IRQ_KBD] = GATE(0, GD_KT, (uintptr_t)(&kbd_thdlr), 3);
     extern void (*serial_thdlr)(void);
     idt[IRQ_OFFSET + IRQ_SERIAL] = GATE(0, GD_KT, (uintptr_t)(&serial_thdlr), 3);
+    /* Device lines stay masked until a driver sleeps on them */
+    extern void (*ide_thdlr)(void);
+    idt[IRQ_OFFSET + IRQ_IDE] = GATE(0, GD_KT, (uintptr_t)(&ide_thdlr), 0);
+    extern void (*irq9_thdlr)(void);
+    idt[IRQ_OFFSET + 9] = GATE(0, GD_KT, (uintptr_t)(&irq9_thdlr), 0);
+    extern void (*irq10_thdlr)(void);
+    idt[IRQ_OFFSET + 10] = GATE(0, GD_KT, (uintptr_t)(&irq10_thdlr), 0);
+    extern void (*irq11_thdlr)(void);
+    idt[IRQ_OFFSET + 11] = GATE(0, GD_KT, (uintptr_t)(&irq11_thdlr), 0);
 
     /* Setup #PF handler dedicated stack
      * It should be switched on #PF because
@@ -299,6 +363,7 @@ trap_dispatch(struct Trapframe *tf) {
             // LAB 5: Your code here
             // LAB 4: Your code here
             vsys[VSYS_gettime] = gettime();
+            ipc_expire(vsys[VSYS_gettime]);
             timer_for_schedule->handle_interrupts();
             rtc_check_status();
             pic_send_eoi(IRQ_CLOCK);
@@ -316,6 +381,20 @@ trap_dispatch(struct Trapframe *tf) {
             pic_send_eoi(IRQ_SERIAL);
             sched_yield();
             return;
+        case IRQ_OFFSET + IRQ_IDE:
+        case IRQ_OFFSET + 9:
+        case IRQ_OFFSET + 10:
+        case IRQ_OFFSET + 11: {
+            /* PCI lines are level triggered: keep the line masked
+             * until the driver has quieted the device and waits again */
+            uint8_t irq = tf->tf_trapno - IRQ_OFFSET;
+            pic_irq_mute(irq);
+            vsys[VSYS_irqs + irq]++;
+            irq_wakeup(irq);
+            pic_send_eoi(irq);
+            sched_yield();
+            return;
+        }
         default:
             print_trapframe(tf);
             if (!(tf->tf_cs & 3))
@@ -15,10 +15,19 @@ extern struct Pseudodesc idt_pd;
 
 extern bool in_page_fault;
 
+struct Env;
+
 void clock_idt_init(void);
 void trap_init(void);
 void trap_init_percpu(void);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
+/* Lines the file system server may sleep on: IDE and those
+ * the firmware hands out to PCI devices */
+#define IRQ_DEVICES ((1 << IRQ_IDE) | (1 << 9) | (1 << 10) | (1 << 11))
+
+void irq_sleep(struct Env *env, uint8_t irq);
+void irq_sleep_cancel(struct Env *env);
+bool irq_sleeping(void);
 
 #endif /* JOS_KERN_TRAP_H */
@@ -192,6 +192,29 @@ read(int fdnum, void *buf, size_t n) {
     return (*dev->dev_read)(fd, buf, n);
 }
 
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+
+    return (*dev->dev_readmap)(fd, buf, n);
+}
+
 ssize_t
 readn(int fdnum, void *buf, size_t n) {
     int inc = 1, res = 0;
@@ -375,6 +398,78 @@ delete_snapshot(char *name) {
     return 0;
 }
 
+int
+gc_snapshots() {
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+
+    if (!dev->dev_sh_gc) {
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+
+    return res;
+}
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+
+    if (!dev->dev_sh_diff) {
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+
+    return res;
+}
+
+int
+send_snapshot(char *from, char *name, char *path) {
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+
+    if (!dev->dev_sh_send) {
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+
+    return res;
+}
+
+int
+receive_snapshot(char *path) {
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+
+    if (!dev->dev_sh_recv) {
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+
+    return res;
+}
+
 /******************* snapshot end ****************************************/
 
 /******************* df start ********************************************/
@@ -415,4 +510,22 @@ busy_space_bytes() {
     return res;
 }
 
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+
+    if (!dev->dev_df_snapshots) {
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+    
+    return res;
+}
+
 /******************* df end **********************************************/
\ No newline at end of file
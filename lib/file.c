@@ -8,10 +8,11 @@ union Fsipc fsipcbuf __attribute__((aligned(PAGE_SIZE)));
  * a reply.  The request body should be in fsipcbuf, and parts of the
  * response may be written back to fsipcbuf.
  * type: request code, passed as the simple integer IPC value.
- * dstva: virtual address at which to receive reply page, 0 if none.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
  * Returns result from the file server. */
 static int
-fsipc(unsigned type, void *dstva) {
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
     static envid_t fsenv;
 
     if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
@@ -24,12 +25,19 @@ fsipc(unsigned type, void *dstva) {
     }
 
     ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+}
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
     size_t maxsz = PAGE_SIZE;
-    return ipc_recv(NULL, dstva, &maxsz, NULL);
+    return fsipc_region(type, dstva, &maxsz);
 }
 
 static int devfile_flush(struct Fd *fd);
 static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
+static ssize_t devfile_readmap(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
 static int devfile_trunc(struct Fd *fd, off_t newsize);
@@ -38,14 +46,20 @@ static int devfile_create_snapshot(char *comment, char *name);
 static int devfile_print_snapshot_list();
 static int devfile_accept_snapshot(char *name);
 static int devfile_delete_snapshot(char *name);
+static int devfile_gc_snapshots();
+static int devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records);
+static int devfile_send_snapshot(char *from, char *name, char *path);
+static int devfile_receive_snapshot(char *path);
 
 static int devfile_df_free();
 static int devfile_df_busy();
+static int devfile_df_snapshots(int start, struct Df_snapshot *records);
 
 struct Dev devfile = {
         .dev_id = 'f',
         .dev_name = "file",
         .dev_read = devfile_read,
+        .dev_readmap = devfile_readmap,
         .dev_close = devfile_flush,
         .dev_stat = devfile_stat,
         .dev_write = devfile_write,
@@ -54,8 +68,13 @@ struct Dev devfile = {
         .dev_sh_print = devfile_print_snapshot_list,
         .dev_sh_accept = devfile_accept_snapshot,
         .dev_sh_delete = devfile_delete_snapshot,
+        .dev_sh_gc = devfile_gc_snapshots,
+        .dev_sh_diff = devfile_diff_snapshots,
+        .dev_sh_send = devfile_send_snapshot,
+        .dev_sh_recv = devfile_receive_snapshot,
         .dev_df_free = devfile_df_free,
-        .dev_df_busy = devfile_df_busy};
+        .dev_df_busy = devfile_df_busy,
+        .dev_df_snapshots = devfile_df_snapshots};
 
 
 
@@ -156,6 +175,50 @@ devfile_read(struct Fd *fd, void *buf, size_t n) {
   return totalRead;
 }
 
+/* Whether readmap may replace the pages of [buf, buf + n): memory
+ * shared with another environment must keep its mapping */
+static bool
+devfile_mappable(void *buf, size_t n) {
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+    }
+    return true;
+}
+
+/* Read at most 'n' bytes from 'fd' at the current position into 'buf'
+ * like devfile_read, except that whole blocks from a block aligned
+ * position into a page aligned buffer come as read-only mappings of
+ * the server's block cache, replacing whatever was mapped at buf.
+ *
+ * Returns:
+ *  The number of bytes successfully read.
+ *  < 0 on error. */
+static ssize_t
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+    size_t totalRead = 0;
+
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+        if (!devfile_mappable(buf, size)) break;
+
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+        fsipcbuf.read.req_n      = size;
+
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+        if (read <= 0 || size < (size_t)read) break;
+
+        buf += read;
+        n -= read;
+        totalRead += read;
+    }
+
+    if (!n) return totalRead;
+
+    ssize_t read = devfile_read(fd, buf, n);
+    if (read < 0) return totalRead ? totalRead : read;
+    return totalRead + read;
+}
+
 /* Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
  *
  * Returns:
@@ -284,6 +347,72 @@ devfile_delete_snapshot(char *name) {
     return 0;
 }
 
+static int
+devfile_gc_snapshots() {
+    int res = fsipc(FSREQ_SH_GC, NULL);
+
+    return res;
+}
+
+/* Get the next part of the diff of two snapshots.
+ * Fills at most SH_DIFF_RECORDS records, advances the cursor
+ * and returns the number of records. */
+static int
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+    if (!from || !to || !cursor || !records) {
+        return -E_INVAL;
+    }
+
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+        return -E_INVAL;
+    }
+
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+    if (res < 0) return res;
+
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+
+    return fsipcbuf.snapshot_diffRet.ret_count;
+}
+
+/* Write the changes of snapshot 'name' relative to its ancestor 'from'
+ * into the stream file 'path'.  Returns the size of the stream. */
+static int
+devfile_send_snapshot(char *from, char *name, char *path) {
+    if (!from || !name || !path) {
+        return -E_INVAL;
+    }
+
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+        return -E_INVAL;
+    }
+
+    strcpy(fsipcbuf.snapshot_send.from, from);
+    strcpy(fsipcbuf.snapshot_send.name, name);
+    strcpy(fsipcbuf.snapshot_send.path, path);
+
+    return fsipc(FSREQ_SH_SEND, NULL);
+}
+
+static int
+devfile_receive_snapshot(char *path) {
+    if (!path || strlen(path) >= MAXPATHLEN) {
+        return -E_INVAL;
+    }
+
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+    if (res < 0) return res;
+
+    return 0;
+}
+
 static int
 devfile_df_free() {
     int res = fsipc(FSREQ_DF_FREE, NULL);
@@ -298,6 +427,24 @@ devfile_df_busy() {
     return res;
 }
 
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+    if (res < 0) return res;
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+}
+
 /* Synchronize disk with buffer cache */
 int
 sync(void) {
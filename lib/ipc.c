@@ -5,6 +5,9 @@
 /* Receive a value via IPC and return it.
  * If 'pg' is nonnull, then any page sent by the sender will be mapped at
  *    that address.
+ * If 'size' is nonnull, then up to *size bytes (a multiple of PAGE_SIZE,
+ *    one page if 'size' is null) are accepted at 'pg', and *size is set
+ *    to the size of the region the sender transferred, 0 if none.
  * If 'from_env_store' is nonnull, then store the IPC sender's envid in
  *    *from_env_store.
  * If 'perm_store' is nonnull, then store the IPC sender's page permission
@@ -21,11 +24,18 @@
  *   a perfectly valid place to map a page.) */
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
     // LAB 9: Your code here:
     if (pg == NULL) {
         pg = (void *)MAX_USER_ADDRESS;
     }
-    int res = sys_ipc_recv(pg, PAGE_SIZE);
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
     if (res < 0) {
         if (from_env_store != NULL) {
             *from_env_store = 0;
@@ -33,6 +43,9 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
         if (perm_store != NULL) {
             *perm_store = 0;
         }
+        if (size != NULL) {
+            *size = 0;
+        }
         return res;
     } else {
         if (from_env_store != NULL) {
@@ -41,6 +54,9 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
         if (perm_store != NULL) {
             *perm_store = thisenv->env_ipc_perm;
         }
+        if (size != NULL) {
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+        }
         return thisenv->env_ipc_value;
     }
     return -1;
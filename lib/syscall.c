@@ -136,7 +136,12 @@ sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int p
 
 int
 sys_ipc_recv(void *dstva, size_t size) {
-    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
 #endif
@@ -147,3 +152,18 @@ int
 sys_gettime(void) {
     return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
 }
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+}
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+}
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+}
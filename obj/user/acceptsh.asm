@@ -0,0 +1,6997 @@
+
+obj/user/acceptsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 08 01 00 00       	call   80012b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	49 89 f5             	mov    %rsi,%r13
+
+    if (argc < 2) { 
+  80003c:	83 ff 01             	cmp    $0x1,%edi
+  80003f:	7e 2c                	jle    80006d <umain+0x48>
+        cprintf("Not enough arguments for accepting snapshot\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    } else if (argc > 2) {
+  800041:	83 ff 02             	cmp    $0x2,%edi
+  800044:	7f 6e                	jg     8000b4 <umain+0x8f>
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    int res = accept_snapshot(argv[1]);
+  800046:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80004a:	48 b8 91 1e 80 00 00 	movabs $0x801e91,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+
+    if (res < 0) {
+  800056:	85 c0                	test   %eax,%eax
+  800058:	0f 88 ad 00 00 00    	js     80010b <umain+0xe6>
+        cprintf("Snapshot is not accepted\n");
+    }
+    
+
+    return;
+  80005e:	48 83 c4 08          	add    $0x8,%rsp
+  800062:	5b                   	pop    %rbx
+  800063:	41 5c                	pop    %r12
+  800065:	41 5d                	pop    %r13
+  800067:	41 5e                	pop    %r14
+  800069:	41 5f                	pop    %r15
+  80006b:	5d                   	pop    %rbp
+  80006c:	c3                   	ret
+        cprintf("Not enough arguments for accepting snapshot\n");
+  80006d:	48 bf 78 37 80 00 00 	movabs $0x803778,%rdi
+  800074:	00 00 00 
+  800077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007c:	48 ba a9 02 80 00 00 	movabs $0x8002a9,%rdx
+  800083:	00 00 00 
+  800086:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  800088:	41 83 fc 01          	cmp    $0x1,%r12d
+  80008c:	75 d0                	jne    80005e <umain+0x39>
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  80008e:	49 8b 55 00          	mov    0x0(%r13),%rdx
+  800092:	be 00 00 00 00       	mov    $0x0,%esi
+  800097:	48 bf d8 37 80 00 00 	movabs $0x8037d8,%rdi
+  80009e:	00 00 00 
+  8000a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a6:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  8000ad:	00 00 00 
+  8000b0:	ff d1                	call   *%rcx
+        for(int i = 0; i < argc; ++i) {
+  8000b2:	eb aa                	jmp    80005e <umain+0x39>
+        cprintf("Too much arguments for accepting snapshot\n");
+  8000b4:	48 bf a8 37 80 00 00 	movabs $0x8037a8,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 ba a9 02 80 00 00 	movabs $0x8002a9,%rdx
+  8000ca:	00 00 00 
+  8000cd:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  8000cf:	4d 63 e4             	movslq %r12d,%r12
+        cprintf("Too much arguments for accepting snapshot\n");
+  8000d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  8000d7:	49 bf d8 37 80 00 00 	movabs $0x8037d8,%r15
+  8000de:	00 00 00 
+  8000e1:	49 be a9 02 80 00 00 	movabs $0x8002a9,%r14
+  8000e8:	00 00 00 
+  8000eb:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ff             	mov    %r15,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d6             	call   *%r14
+        for(int i = 0; i < argc; ++i) {
+  8000fd:	48 83 c3 01          	add    $0x1,%rbx
+  800101:	49 39 dc             	cmp    %rbx,%r12
+  800104:	75 e5                	jne    8000eb <umain+0xc6>
+  800106:	e9 53 ff ff ff       	jmp    80005e <umain+0x39>
+        cprintf("Snapshot is not accepted\n");
+  80010b:	48 bf fc 37 80 00 00 	movabs $0x8037fc,%rdi
+  800112:	00 00 00 
+  800115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011a:	48 ba a9 02 80 00 00 	movabs $0x8002a9,%rdx
+  800121:	00 00 00 
+  800124:	ff d2                	call   *%rdx
+  800126:	e9 33 ff ff ff       	jmp    80005e <umain+0x39>
+
+000000000080012b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012b:	55                   	push   %rbp
+  80012c:	48 89 e5             	mov    %rsp,%rbp
+  80012f:	41 56                	push   %r14
+  800131:	41 55                	push   %r13
+  800133:	41 54                	push   %r12
+  800135:	53                   	push   %rbx
+  800136:	41 89 fd             	mov    %edi,%r13d
+  800139:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013c:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800143:	00 00 00 
+  800146:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80014d:	00 00 00 
+  800150:	48 39 c2             	cmp    %rax,%rdx
+  800153:	73 17                	jae    80016c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800155:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800158:	49 89 c4             	mov    %rax,%r12
+  80015b:	48 83 c3 08          	add    $0x8,%rbx
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	ff 53 f8             	call   *-0x8(%rbx)
+  800167:	4c 39 e3             	cmp    %r12,%rbx
+  80016a:	72 ef                	jb     80015b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80016c:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  800173:	00 00 00 
+  800176:	ff d0                	call   *%rax
+  800178:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80017d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800181:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800185:	48 c1 e0 04          	shl    $0x4,%rax
+  800189:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800190:	00 00 00 
+  800193:	48 01 d0             	add    %rdx,%rax
+  800196:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80019d:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a0:	45 85 ed             	test   %r13d,%r13d
+  8001a3:	7e 0d                	jle    8001b2 <libmain+0x87>
+  8001a5:	49 8b 06             	mov    (%r14),%rax
+  8001a8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001af:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b2:	4c 89 f6             	mov    %r14,%rsi
+  8001b5:	44 89 ef             	mov    %r13d,%edi
+  8001b8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c4:	48 b8 d9 01 80 00 00 	movabs $0x8001d9,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+#endif
+}
+  8001d0:	5b                   	pop    %rbx
+  8001d1:	41 5c                	pop    %r12
+  8001d3:	41 5d                	pop    %r13
+  8001d5:	41 5e                	pop    %r14
+  8001d7:	5d                   	pop    %rbp
+  8001d8:	c3                   	ret
+
+00000000008001d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001dd:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  8001e4:	00 00 00 
+  8001e7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ee:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  8001f5:	00 00 00 
+  8001f8:	ff d0                	call   *%rax
+}
+  8001fa:	5d                   	pop    %rbp
+  8001fb:	c3                   	ret
+
+00000000008001fc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001fc:	55                   	push   %rbp
+  8001fd:	48 89 e5             	mov    %rsp,%rbp
+  800200:	53                   	push   %rbx
+  800201:	48 83 ec 08          	sub    $0x8,%rsp
+  800205:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800208:	8b 06                	mov    (%rsi),%eax
+  80020a:	8d 50 01             	lea    0x1(%rax),%edx
+  80020d:	89 16                	mov    %edx,(%rsi)
+  80020f:	48 98                	cltq
+  800211:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800216:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80021c:	74 0a                	je     800228 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80021e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800228:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80022c:	be ff 00 00 00       	mov    $0xff,%esi
+  800231:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80023d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800243:	eb d9                	jmp    80021e <putch+0x22>
+
+0000000000800245 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800245:	55                   	push   %rbp
+  800246:	48 89 e5             	mov    %rsp,%rbp
+  800249:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800250:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800253:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80025a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80025f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800264:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800267:	48 89 f1             	mov    %rsi,%rcx
+  80026a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800271:	48 bf fc 01 80 00 00 	movabs $0x8001fc,%rdi
+  800278:	00 00 00 
+  80027b:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  800282:	00 00 00 
+  800285:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800287:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80028e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800295:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002a1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002a7:	c9                   	leave
+  8002a8:	c3                   	ret
+
+00000000008002a9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002a9:	55                   	push   %rbp
+  8002aa:	48 89 e5             	mov    %rsp,%rbp
+  8002ad:	48 83 ec 50          	sub    $0x50,%rsp
+  8002b1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002b5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002b9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002bd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002c1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002c5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002cc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002d4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002dc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e0:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  8002e7:	00 00 00 
+  8002ea:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002ec:	c9                   	leave
+  8002ed:	c3                   	ret
+
+00000000008002ee <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002ee:	55                   	push   %rbp
+  8002ef:	48 89 e5             	mov    %rsp,%rbp
+  8002f2:	41 57                	push   %r15
+  8002f4:	41 56                	push   %r14
+  8002f6:	41 55                	push   %r13
+  8002f8:	41 54                	push   %r12
+  8002fa:	53                   	push   %rbx
+  8002fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ff:	49 89 fc             	mov    %rdi,%r12
+  800302:	49 89 f5             	mov    %rsi,%r13
+  800305:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800309:	8b 45 10             	mov    0x10(%rbp),%eax
+  80030c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80030f:	41 89 cf             	mov    %ecx,%r15d
+  800312:	4c 39 fa             	cmp    %r15,%rdx
+  800315:	73 5b                	jae    800372 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800317:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80031b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80031f:	85 db                	test   %ebx,%ebx
+  800321:	7e 0e                	jle    800331 <print_num+0x43>
+            putch(padc, put_arg);
+  800323:	4c 89 ee             	mov    %r13,%rsi
+  800326:	44 89 f7             	mov    %r14d,%edi
+  800329:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80032c:	83 eb 01             	sub    $0x1,%ebx
+  80032f:	75 f2                	jne    800323 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800331:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800335:	48 b9 31 38 80 00 00 	movabs $0x803831,%rcx
+  80033c:	00 00 00 
+  80033f:	48 b8 20 38 80 00 00 	movabs $0x803820,%rax
+  800346:	00 00 00 
+  800349:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80034d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800351:	ba 00 00 00 00       	mov    $0x0,%edx
+  800356:	49 f7 f7             	div    %r15
+  800359:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80035d:	4c 89 ee             	mov    %r13,%rsi
+  800360:	41 ff d4             	call   *%r12
+}
+  800363:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800367:	5b                   	pop    %rbx
+  800368:	41 5c                	pop    %r12
+  80036a:	41 5d                	pop    %r13
+  80036c:	41 5e                	pop    %r14
+  80036e:	41 5f                	pop    %r15
+  800370:	5d                   	pop    %rbp
+  800371:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800372:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037b:	49 f7 f7             	div    %r15
+  80037e:	48 83 ec 08          	sub    $0x8,%rsp
+  800382:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800386:	52                   	push   %rdx
+  800387:	45 0f be c9          	movsbl %r9b,%r9d
+  80038b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80038f:	48 89 c2             	mov    %rax,%rdx
+  800392:	48 b8 ee 02 80 00 00 	movabs $0x8002ee,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+  80039e:	48 83 c4 10          	add    $0x10,%rsp
+  8003a2:	eb 8d                	jmp    800331 <print_num+0x43>
+
+00000000008003a4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003a4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003a8:	48 8b 06             	mov    (%rsi),%rax
+  8003ab:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003af:	73 0a                	jae    8003bb <sprintputch+0x17>
+        *state->start++ = ch;
+  8003b1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003b5:	48 89 16             	mov    %rdx,(%rsi)
+  8003b8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003bb:	c3                   	ret
+
+00000000008003bc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003cc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003d0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003df:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003e7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003eb:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  8003f2:	00 00 00 
+  8003f5:	ff d0                	call   *%rax
+}
+  8003f7:	c9                   	leave
+  8003f8:	c3                   	ret
+
+00000000008003f9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	41 57                	push   %r15
+  8003ff:	41 56                	push   %r14
+  800401:	41 55                	push   %r13
+  800403:	41 54                	push   %r12
+  800405:	53                   	push   %rbx
+  800406:	48 83 ec 38          	sub    $0x38,%rsp
+  80040a:	49 89 fe             	mov    %rdi,%r14
+  80040d:	49 89 f5             	mov    %rsi,%r13
+  800410:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800413:	48 8b 01             	mov    (%rcx),%rax
+  800416:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80041a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80041e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800422:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800426:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80042a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80042e:	0f b6 3b             	movzbl (%rbx),%edi
+  800431:	40 80 ff 25          	cmp    $0x25,%dil
+  800435:	74 18                	je     80044f <vprintfmt+0x56>
+            if (!ch) return;
+  800437:	40 84 ff             	test   %dil,%dil
+  80043a:	0f 84 b1 06 00 00    	je     800af1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800440:	40 0f b6 ff          	movzbl %dil,%edi
+  800444:	4c 89 ee             	mov    %r13,%rsi
+  800447:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80044a:	4c 89 e3             	mov    %r12,%rbx
+  80044d:	eb db                	jmp    80042a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80044f:	be 00 00 00 00       	mov    $0x0,%esi
+  800454:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800458:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80045d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800463:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80046a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80046e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800473:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800478:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80047b:	83 e8 23             	sub    $0x23,%eax
+  80047e:	3c 57                	cmp    $0x57,%al
+  800480:	0f 87 51 06 00 00    	ja     800ad7 <vprintfmt+0x6de>
+  800486:	0f b6 c0             	movzbl %al,%eax
+  800489:	48 b9 c0 39 80 00 00 	movabs $0x8039c0,%rcx
+  800490:	00 00 00 
+  800493:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800496:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800499:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80049d:	eb cf                	jmp    80046e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80049f:	49 89 dc             	mov    %rbx,%r12
+  8004a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8004a7:	eb c5                	jmp    80046e <vprintfmt+0x75>
+            padc = ch;
+  8004a9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004ad:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b3:	eb b9                	jmp    80046e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bb:	77 24                	ja     8004e1 <vprintfmt+0xe8>
+  8004bd:	89 c1                	mov    %eax,%ecx
+  8004bf:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004c3:	83 c0 08             	add    $0x8,%eax
+  8004c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004cc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004cf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004d3:	79 99                	jns    80046e <vprintfmt+0x75>
+                width = precision;
+  8004d5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004d9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004df:	eb 8d                	jmp    80046e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004e1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004e5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ed:	eb da                	jmp    8004c9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004ef:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004f4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004f8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004fe:	3c 39                	cmp    $0x39,%al
+  800500:	77 1c                	ja     80051e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800502:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800506:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80050a:	0f b6 c0             	movzbl %al,%eax
+  80050d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800512:	0f b6 03             	movzbl (%rbx),%eax
+  800515:	3c 39                	cmp    $0x39,%al
+  800517:	76 e9                	jbe    800502 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800519:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80051c:	eb b1                	jmp    8004cf <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80051e:	49 89 dc             	mov    %rbx,%r12
+  800521:	eb ac                	jmp    8004cf <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800523:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800526:	85 c9                	test   %ecx,%ecx
+  800528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052d:	0f 49 c1             	cmovns %ecx,%eax
+  800530:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800533:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800536:	e9 33 ff ff ff       	jmp    80046e <vprintfmt+0x75>
+            lflag++;
+  80053b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80053e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800541:	e9 28 ff ff ff       	jmp    80046e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800546:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800549:	83 f8 2f             	cmp    $0x2f,%eax
+  80054c:	77 19                	ja     800567 <vprintfmt+0x16e>
+  80054e:	89 c2                	mov    %eax,%edx
+  800550:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800554:	83 c0 08             	add    $0x8,%eax
+  800557:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80055a:	8b 3a                	mov    (%rdx),%edi
+  80055c:	4c 89 ee             	mov    %r13,%rsi
+  80055f:	41 ff d6             	call   *%r14
+            break;
+  800562:	e9 c3 fe ff ff       	jmp    80042a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800567:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80056b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80056f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800573:	eb e5                	jmp    80055a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800575:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800578:	83 f8 2f             	cmp    $0x2f,%eax
+  80057b:	77 5a                	ja     8005d7 <vprintfmt+0x1de>
+  80057d:	89 c2                	mov    %eax,%edx
+  80057f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800583:	83 c0 08             	add    $0x8,%eax
+  800586:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800589:	8b 02                	mov    (%rdx),%eax
+  80058b:	89 c1                	mov    %eax,%ecx
+  80058d:	f7 d9                	neg    %ecx
+  80058f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800592:	83 f9 14             	cmp    $0x14,%ecx
+  800595:	7f 4e                	jg     8005e5 <vprintfmt+0x1ec>
+  800597:	48 63 c1             	movslq %ecx,%rax
+  80059a:	48 ba 80 3c 80 00 00 	movabs $0x803c80,%rdx
+  8005a1:	00 00 00 
+  8005a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005a8:	48 85 c0             	test   %rax,%rax
+  8005ab:	74 38                	je     8005e5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005ad:	48 89 c1             	mov    %rax,%rcx
+  8005b0:	48 ba 59 3e 80 00 00 	movabs $0x803e59,%rdx
+  8005b7:	00 00 00 
+  8005ba:	4c 89 ee             	mov    %r13,%rsi
+  8005bd:	4c 89 f7             	mov    %r14,%rdi
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  8005cc:	00 00 00 
+  8005cf:	41 ff d0             	call   *%r8
+  8005d2:	e9 53 fe ff ff       	jmp    80042a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e3:	eb a4                	jmp    800589 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005e5:	48 ba 49 38 80 00 00 	movabs $0x803849,%rdx
+  8005ec:	00 00 00 
+  8005ef:	4c 89 ee             	mov    %r13,%rsi
+  8005f2:	4c 89 f7             	mov    %r14,%rdi
+  8005f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fa:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  800601:	00 00 00 
+  800604:	41 ff d0             	call   *%r8
+  800607:	e9 1e fe ff ff       	jmp    80042a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80060c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80060f:	83 f8 2f             	cmp    $0x2f,%eax
+  800612:	77 6c                	ja     800680 <vprintfmt+0x287>
+  800614:	89 c2                	mov    %eax,%edx
+  800616:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061a:	83 c0 08             	add    $0x8,%eax
+  80061d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800620:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800623:	48 85 d2             	test   %rdx,%rdx
+  800626:	48 b8 42 38 80 00 00 	movabs $0x803842,%rax
+  80062d:	00 00 00 
+  800630:	48 0f 45 c2          	cmovne %rdx,%rax
+  800634:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800638:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80063c:	7e 06                	jle    800644 <vprintfmt+0x24b>
+  80063e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800642:	75 4a                	jne    80068e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800644:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800648:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80064c:	0f b6 00             	movzbl (%rax),%eax
+  80064f:	84 c0                	test   %al,%al
+  800651:	0f 85 9a 00 00 00    	jne    8006f1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800657:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80065e:	85 c0                	test   %eax,%eax
+  800660:	0f 8e c4 fd ff ff    	jle    80042a <vprintfmt+0x31>
+  800666:	4c 89 ee             	mov    %r13,%rsi
+  800669:	bf 20 00 00 00       	mov    $0x20,%edi
+  80066e:	41 ff d6             	call   *%r14
+  800671:	41 83 ec 01          	sub    $0x1,%r12d
+  800675:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800679:	75 eb                	jne    800666 <vprintfmt+0x26d>
+  80067b:	e9 aa fd ff ff       	jmp    80042a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800680:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800684:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800688:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068c:	eb 92                	jmp    800620 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80068e:	49 63 f7             	movslq %r15d,%rsi
+  800691:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800695:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  80069c:	00 00 00 
+  80069f:	ff d0                	call   *%rax
+  8006a1:	48 89 c2             	mov    %rax,%rdx
+  8006a4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006a9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006ac:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006af:	85 c0                	test   %eax,%eax
+  8006b1:	7e 91                	jle    800644 <vprintfmt+0x24b>
+  8006b3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	44 89 e7             	mov    %r12d,%edi
+  8006be:	41 ff d6             	call   *%r14
+  8006c1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006c5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006cb:	75 eb                	jne    8006b8 <vprintfmt+0x2bf>
+  8006cd:	e9 72 ff ff ff       	jmp    800644 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d2:	0f b6 f8             	movzbl %al,%edi
+  8006d5:	4c 89 ee             	mov    %r13,%rsi
+  8006d8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006db:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006df:	49 83 c4 01          	add    $0x1,%r12
+  8006e3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006e9:	84 c0                	test   %al,%al
+  8006eb:	0f 84 66 ff ff ff    	je     800657 <vprintfmt+0x25e>
+  8006f1:	45 85 ff             	test   %r15d,%r15d
+  8006f4:	78 0a                	js     800700 <vprintfmt+0x307>
+  8006f6:	41 83 ef 01          	sub    $0x1,%r15d
+  8006fa:	0f 88 57 ff ff ff    	js     800657 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800700:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800704:	74 cc                	je     8006d2 <vprintfmt+0x2d9>
+  800706:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800709:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80070e:	80 fa 5e             	cmp    $0x5e,%dl
+  800711:	77 c2                	ja     8006d5 <vprintfmt+0x2dc>
+  800713:	eb bd                	jmp    8006d2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800715:	40 84 f6             	test   %sil,%sil
+  800718:	75 26                	jne    800740 <vprintfmt+0x347>
+    switch (lflag) {
+  80071a:	85 d2                	test   %edx,%edx
+  80071c:	74 59                	je     800777 <vprintfmt+0x37e>
+  80071e:	83 fa 01             	cmp    $0x1,%edx
+  800721:	74 7b                	je     80079e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800726:	83 f8 2f             	cmp    $0x2f,%eax
+  800729:	0f 87 96 00 00 00    	ja     8007c5 <vprintfmt+0x3cc>
+  80072f:	89 c2                	mov    %eax,%edx
+  800731:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800735:	83 c0 08             	add    $0x8,%eax
+  800738:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073b:	4c 8b 22             	mov    (%rdx),%r12
+  80073e:	eb 17                	jmp    800757 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	77 21                	ja     800769 <vprintfmt+0x370>
+  800748:	89 c2                	mov    %eax,%edx
+  80074a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074e:	83 c0 08             	add    $0x8,%eax
+  800751:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800754:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800757:	4d 85 e4             	test   %r12,%r12
+  80075a:	78 7a                	js     8007d6 <vprintfmt+0x3dd>
+            num = i;
+  80075c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80075f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800764:	e9 50 02 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800769:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800771:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800775:	eb dd                	jmp    800754 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800777:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077a:	83 f8 2f             	cmp    $0x2f,%eax
+  80077d:	77 11                	ja     800790 <vprintfmt+0x397>
+  80077f:	89 c2                	mov    %eax,%edx
+  800781:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800785:	83 c0 08             	add    $0x8,%eax
+  800788:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078b:	4c 63 22             	movslq (%rdx),%r12
+  80078e:	eb c7                	jmp    800757 <vprintfmt+0x35e>
+  800790:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800794:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800798:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079c:	eb ed                	jmp    80078b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80079e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a4:	77 11                	ja     8007b7 <vprintfmt+0x3be>
+  8007a6:	89 c2                	mov    %eax,%edx
+  8007a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ac:	83 c0 08             	add    $0x8,%eax
+  8007af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b2:	4c 8b 22             	mov    (%rdx),%r12
+  8007b5:	eb a0                	jmp    800757 <vprintfmt+0x35e>
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb ed                	jmp    8007b2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d1:	e9 65 ff ff ff       	jmp    80073b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007d6:	4c 89 ee             	mov    %r13,%rsi
+  8007d9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007de:	41 ff d6             	call   *%r14
+                i = -i;
+  8007e1:	49 f7 dc             	neg    %r12
+  8007e4:	e9 73 ff ff ff       	jmp    80075c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e9:	40 84 f6             	test   %sil,%sil
+  8007ec:	75 32                	jne    800820 <vprintfmt+0x427>
+    switch (lflag) {
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	74 5d                	je     80084f <vprintfmt+0x456>
+  8007f2:	83 fa 01             	cmp    $0x1,%edx
+  8007f5:	0f 84 82 00 00 00    	je     80087d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800801:	0f 87 a5 00 00 00    	ja     8008ac <vprintfmt+0x4b3>
+  800807:	89 c2                	mov    %eax,%edx
+  800809:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080d:	83 c0 08             	add    $0x8,%eax
+  800810:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800813:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80081b:	e9 99 01 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 19                	ja     800841 <vprintfmt+0x448>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800837:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80083c:	e9 78 01 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb e5                	jmp    800834 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80084f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800852:	83 f8 2f             	cmp    $0x2f,%eax
+  800855:	77 18                	ja     80086f <vprintfmt+0x476>
+  800857:	89 c2                	mov    %eax,%edx
+  800859:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085d:	83 c0 08             	add    $0x8,%eax
+  800860:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800863:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800865:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80086a:	e9 4a 01 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb e6                	jmp    800863 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80087d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800880:	83 f8 2f             	cmp    $0x2f,%eax
+  800883:	77 19                	ja     80089e <vprintfmt+0x4a5>
+  800885:	89 c2                	mov    %eax,%edx
+  800887:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088b:	83 c0 08             	add    $0x8,%eax
+  80088e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800891:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800894:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800899:	e9 1b 01 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+  80089e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008aa:	eb e5                	jmp    800891 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b8:	e9 56 ff ff ff       	jmp    800813 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008bd:	40 84 f6             	test   %sil,%sil
+  8008c0:	75 2e                	jne    8008f0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008c2:	85 d2                	test   %edx,%edx
+  8008c4:	74 59                	je     80091f <vprintfmt+0x526>
+  8008c6:	83 fa 01             	cmp    $0x1,%edx
+  8008c9:	74 7f                	je     80094a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	0f 87 9f 00 00 00    	ja     800976 <vprintfmt+0x57d>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008e6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008eb:	e9 c9 00 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f6:	77 19                	ja     800911 <vprintfmt+0x518>
+  8008f8:	89 c2                	mov    %eax,%edx
+  8008fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fe:	83 c0 08             	add    $0x8,%eax
+  800901:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800904:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800907:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	e9 a8 00 00 00       	jmp    8009b9 <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e5                	jmp    800904 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 15                	ja     80093c <vprintfmt+0x543>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800935:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80093a:	eb 7d                	jmp    8009b9 <vprintfmt+0x5c0>
+  80093c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800940:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800944:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800948:	eb e9                	jmp    800933 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80094a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094d:	83 f8 2f             	cmp    $0x2f,%eax
+  800950:	77 16                	ja     800968 <vprintfmt+0x56f>
+  800952:	89 c2                	mov    %eax,%edx
+  800954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800958:	83 c0 08             	add    $0x8,%eax
+  80095b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800961:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800966:	eb 51                	jmp    8009b9 <vprintfmt+0x5c0>
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb e8                	jmp    80095e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800982:	e9 5c ff ff ff       	jmp    8008e3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800987:	4c 89 ee             	mov    %r13,%rsi
+  80098a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80098f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800992:	4c 89 ee             	mov    %r13,%rsi
+  800995:	bf 78 00 00 00       	mov    $0x78,%edi
+  80099a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80099d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 47                	ja     8009ec <vprintfmt+0x5f3>
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ab:	83 c0 08             	add    $0x8,%eax
+  8009ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009bd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009c1:	0f 94 c0             	sete   %al
+  8009c4:	0f b6 c0             	movzbl %al,%eax
+  8009c7:	50                   	push   %rax
+  8009c8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009cd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009d1:	4c 89 ee             	mov    %r13,%rsi
+  8009d4:	4c 89 f7             	mov    %r14,%rdi
+  8009d7:	48 b8 ee 02 80 00 00 	movabs $0x8002ee,%rax
+  8009de:	00 00 00 
+  8009e1:	ff d0                	call   *%rax
+            break;
+  8009e3:	48 83 c4 10          	add    $0x10,%rsp
+  8009e7:	e9 3e fa ff ff       	jmp    80042a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f8:	eb b7                	jmp    8009b1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fa:	40 84 f6             	test   %sil,%sil
+  8009fd:	75 2b                	jne    800a2a <vprintfmt+0x631>
+    switch (lflag) {
+  8009ff:	85 d2                	test   %edx,%edx
+  800a01:	74 56                	je     800a59 <vprintfmt+0x660>
+  800a03:	83 fa 01             	cmp    $0x1,%edx
+  800a06:	74 7f                	je     800a87 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	0f 87 a2 00 00 00    	ja     800ab6 <vprintfmt+0x6bd>
+  800a14:	89 c2                	mov    %eax,%edx
+  800a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1a:	83 c0 08             	add    $0x8,%eax
+  800a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a28:	eb 8f                	jmp    8009b9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	77 19                	ja     800a4b <vprintfmt+0x652>
+  800a32:	89 c2                	mov    %eax,%edx
+  800a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a38:	83 c0 08             	add    $0x8,%eax
+  800a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a41:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a46:	e9 6e ff ff ff       	jmp    8009b9 <vprintfmt+0x5c0>
+  800a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a57:	eb e5                	jmp    800a3e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 18                	ja     800a79 <vprintfmt+0x680>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a74:	e9 40 ff ff ff       	jmp    8009b9 <vprintfmt+0x5c0>
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	eb e6                	jmp    800a6d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8d:	77 19                	ja     800aa8 <vprintfmt+0x6af>
+  800a8f:	89 c2                	mov    %eax,%edx
+  800a91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a95:	83 c0 08             	add    $0x8,%eax
+  800a98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa3:	e9 11 ff ff ff       	jmp    8009b9 <vprintfmt+0x5c0>
+  800aa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab4:	eb e5                	jmp    800a9b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ab6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac2:	e9 59 ff ff ff       	jmp    800a20 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ac7:	4c 89 ee             	mov    %r13,%rsi
+  800aca:	bf 25 00 00 00       	mov    $0x25,%edi
+  800acf:	41 ff d6             	call   *%r14
+            break;
+  800ad2:	e9 53 f9 ff ff       	jmp    80042a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ad7:	4c 89 ee             	mov    %r13,%rsi
+  800ada:	bf 25 00 00 00       	mov    $0x25,%edi
+  800adf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ae2:	48 83 eb 01          	sub    $0x1,%rbx
+  800ae6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aea:	75 f6                	jne    800ae2 <vprintfmt+0x6e9>
+  800aec:	e9 39 f9 ff ff       	jmp    80042a <vprintfmt+0x31>
+}
+  800af1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800af5:	5b                   	pop    %rbx
+  800af6:	41 5c                	pop    %r12
+  800af8:	41 5d                	pop    %r13
+  800afa:	41 5e                	pop    %r14
+  800afc:	41 5f                	pop    %r15
+  800afe:	5d                   	pop    %rbp
+  800aff:	c3                   	ret
+
+0000000000800b00 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b00:	55                   	push   %rbp
+  800b01:	48 89 e5             	mov    %rsp,%rbp
+  800b04:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b0c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b11:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b15:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b1c:	48 85 ff             	test   %rdi,%rdi
+  800b1f:	74 2b                	je     800b4c <vsnprintf+0x4c>
+  800b21:	48 85 f6             	test   %rsi,%rsi
+  800b24:	74 26                	je     800b4c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b26:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b2a:	48 bf a4 03 80 00 00 	movabs $0x8003a4,%rdi
+  800b31:	00 00 00 
+  800b34:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b44:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b4a:	c9                   	leave
+  800b4b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b51:	eb f7                	jmp    800b4a <vsnprintf+0x4a>
+
+0000000000800b53 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b53:	55                   	push   %rbp
+  800b54:	48 89 e5             	mov    %rsp,%rbp
+  800b57:	48 83 ec 50          	sub    $0x50,%rsp
+  800b5b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b5f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b63:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b67:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b76:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b7a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b7e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b82:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  800b89:	00 00 00 
+  800b8c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b8e:	c9                   	leave
+  800b8f:	c3                   	ret
+
+0000000000800b90 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b90:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b93:	74 10                	je     800ba5 <strlen+0x15>
+    size_t n = 0;
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b9a:	48 83 c0 01          	add    $0x1,%rax
+  800b9e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ba2:	75 f6                	jne    800b9a <strlen+0xa>
+  800ba4:	c3                   	ret
+    size_t n = 0;
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800baa:	c3                   	ret
+
+0000000000800bab <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bab:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bae:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bb3:	48 85 f6             	test   %rsi,%rsi
+  800bb6:	74 11                	je     800bc9 <strnlen+0x1e>
+  800bb8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bbc:	74 0c                	je     800bca <strnlen+0x1f>
+  800bbe:	48 83 c2 01          	add    $0x1,%rdx
+  800bc2:	48 39 d0             	cmp    %rdx,%rax
+  800bc5:	75 f1                	jne    800bb8 <strnlen+0xd>
+  800bc7:	eb 04                	jmp    800bcd <strnlen+0x22>
+  800bc9:	c3                   	ret
+  800bca:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bcd:	c3                   	ret
+
+0000000000800bce <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bce:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bda:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bdd:	48 83 c2 01          	add    $0x1,%rdx
+  800be1:	84 c9                	test   %cl,%cl
+  800be3:	75 f1                	jne    800bd6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800be5:	c3                   	ret
+
+0000000000800be6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800be6:	55                   	push   %rbp
+  800be7:	48 89 e5             	mov    %rsp,%rbp
+  800bea:	41 54                	push   %r12
+  800bec:	53                   	push   %rbx
+  800bed:	48 89 fb             	mov    %rdi,%rbx
+  800bf0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bf3:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  800bfa:	00 00 00 
+  800bfd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bff:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c03:	4c 89 e6             	mov    %r12,%rsi
+  800c06:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  800c0d:	00 00 00 
+  800c10:	ff d0                	call   *%rax
+    return dst;
+}
+  800c12:	48 89 d8             	mov    %rbx,%rax
+  800c15:	5b                   	pop    %rbx
+  800c16:	41 5c                	pop    %r12
+  800c18:	5d                   	pop    %rbp
+  800c19:	c3                   	ret
+
+0000000000800c1a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c1d:	48 85 d2             	test   %rdx,%rdx
+  800c20:	74 1f                	je     800c41 <strncpy+0x27>
+  800c22:	48 01 fa             	add    %rdi,%rdx
+  800c25:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c28:	48 83 c1 01          	add    $0x1,%rcx
+  800c2c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c30:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c34:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c38:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c3c:	48 39 ca             	cmp    %rcx,%rdx
+  800c3f:	75 e7                	jne    800c28 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c41:	c3                   	ret
+
+0000000000800c42 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c42:	48 89 f8             	mov    %rdi,%rax
+  800c45:	48 85 d2             	test   %rdx,%rdx
+  800c48:	74 24                	je     800c6e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c4a:	48 83 ea 01          	sub    $0x1,%rdx
+  800c4e:	74 1b                	je     800c6b <strlcpy+0x29>
+  800c50:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c54:	0f b6 16             	movzbl (%rsi),%edx
+  800c57:	84 d2                	test   %dl,%dl
+  800c59:	74 10                	je     800c6b <strlcpy+0x29>
+            *dst++ = *src++;
+  800c5b:	48 83 c6 01          	add    $0x1,%rsi
+  800c5f:	48 83 c0 01          	add    $0x1,%rax
+  800c63:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c66:	48 39 c8             	cmp    %rcx,%rax
+  800c69:	75 e9                	jne    800c54 <strlcpy+0x12>
+        *dst = '\0';
+  800c6b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c6e:	48 29 f8             	sub    %rdi,%rax
+}
+  800c71:	c3                   	ret
+
+0000000000800c72 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c72:	0f b6 07             	movzbl (%rdi),%eax
+  800c75:	84 c0                	test   %al,%al
+  800c77:	74 13                	je     800c8c <strcmp+0x1a>
+  800c79:	38 06                	cmp    %al,(%rsi)
+  800c7b:	75 0f                	jne    800c8c <strcmp+0x1a>
+  800c7d:	48 83 c7 01          	add    $0x1,%rdi
+  800c81:	48 83 c6 01          	add    $0x1,%rsi
+  800c85:	0f b6 07             	movzbl (%rdi),%eax
+  800c88:	84 c0                	test   %al,%al
+  800c8a:	75 ed                	jne    800c79 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c8c:	0f b6 c0             	movzbl %al,%eax
+  800c8f:	0f b6 16             	movzbl (%rsi),%edx
+  800c92:	29 d0                	sub    %edx,%eax
+}
+  800c94:	c3                   	ret
+
+0000000000800c95 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c95:	48 85 d2             	test   %rdx,%rdx
+  800c98:	74 1f                	je     800cb9 <strncmp+0x24>
+  800c9a:	0f b6 07             	movzbl (%rdi),%eax
+  800c9d:	84 c0                	test   %al,%al
+  800c9f:	74 1e                	je     800cbf <strncmp+0x2a>
+  800ca1:	3a 06                	cmp    (%rsi),%al
+  800ca3:	75 1a                	jne    800cbf <strncmp+0x2a>
+  800ca5:	48 83 c7 01          	add    $0x1,%rdi
+  800ca9:	48 83 c6 01          	add    $0x1,%rsi
+  800cad:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb1:	75 e7                	jne    800c9a <strncmp+0x5>
+
+    if (!n) return 0;
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb8:	c3                   	ret
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	c3                   	ret
+  800cbf:	48 85 d2             	test   %rdx,%rdx
+  800cc2:	74 09                	je     800ccd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc4:	0f b6 07             	movzbl (%rdi),%eax
+  800cc7:	0f b6 16             	movzbl (%rsi),%edx
+  800cca:	29 d0                	sub    %edx,%eax
+  800ccc:	c3                   	ret
+    if (!n) return 0;
+  800ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd2:	c3                   	ret
+
+0000000000800cd3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cd3:	0f b6 17             	movzbl (%rdi),%edx
+  800cd6:	84 d2                	test   %dl,%dl
+  800cd8:	74 18                	je     800cf2 <strchr+0x1f>
+        if (*str == c) {
+  800cda:	0f be d2             	movsbl %dl,%edx
+  800cdd:	39 f2                	cmp    %esi,%edx
+  800cdf:	74 17                	je     800cf8 <strchr+0x25>
+    for (; *str; str++) {
+  800ce1:	48 83 c7 01          	add    $0x1,%rdi
+  800ce5:	0f b6 17             	movzbl (%rdi),%edx
+  800ce8:	84 d2                	test   %dl,%dl
+  800cea:	75 ee                	jne    800cda <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	c3                   	ret
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf7:	c3                   	ret
+  800cf8:	48 89 f8             	mov    %rdi,%rax
+}
+  800cfb:	c3                   	ret
+
+0000000000800cfc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cfc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cff:	0f b6 17             	movzbl (%rdi),%edx
+  800d02:	84 d2                	test   %dl,%dl
+  800d04:	74 13                	je     800d19 <strfind+0x1d>
+  800d06:	0f be d2             	movsbl %dl,%edx
+  800d09:	39 f2                	cmp    %esi,%edx
+  800d0b:	74 0b                	je     800d18 <strfind+0x1c>
+  800d0d:	48 83 c0 01          	add    $0x1,%rax
+  800d11:	0f b6 10             	movzbl (%rax),%edx
+  800d14:	84 d2                	test   %dl,%dl
+  800d16:	75 ee                	jne    800d06 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d18:	c3                   	ret
+  800d19:	c3                   	ret
+
+0000000000800d1a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d1a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d1d:	48 89 f8             	mov    %rdi,%rax
+  800d20:	48 f7 d8             	neg    %rax
+  800d23:	83 e0 07             	and    $0x7,%eax
+  800d26:	49 89 d1             	mov    %rdx,%r9
+  800d29:	49 29 c1             	sub    %rax,%r9
+  800d2c:	78 36                	js     800d64 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d2e:	40 0f b6 c6          	movzbl %sil,%eax
+  800d32:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d39:	01 01 01 
+  800d3c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d40:	40 f6 c7 07          	test   $0x7,%dil
+  800d44:	75 38                	jne    800d7e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d46:	4c 89 c9             	mov    %r9,%rcx
+  800d49:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d4d:	74 0c                	je     800d5b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d4f:	fc                   	cld
+  800d50:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d53:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d57:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d5b:	4d 85 c9             	test   %r9,%r9
+  800d5e:	75 45                	jne    800da5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d60:	4c 89 c0             	mov    %r8,%rax
+  800d63:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d64:	48 85 d2             	test   %rdx,%rdx
+  800d67:	74 f7                	je     800d60 <memset+0x46>
+  800d69:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d6c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d6f:	48 83 c0 01          	add    $0x1,%rax
+  800d73:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d77:	48 39 c2             	cmp    %rax,%rdx
+  800d7a:	75 f3                	jne    800d6f <memset+0x55>
+  800d7c:	eb e2                	jmp    800d60 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d7e:	40 f6 c7 01          	test   $0x1,%dil
+  800d82:	74 06                	je     800d8a <memset+0x70>
+  800d84:	88 07                	mov    %al,(%rdi)
+  800d86:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d8a:	40 f6 c7 02          	test   $0x2,%dil
+  800d8e:	74 07                	je     800d97 <memset+0x7d>
+  800d90:	66 89 07             	mov    %ax,(%rdi)
+  800d93:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d97:	40 f6 c7 04          	test   $0x4,%dil
+  800d9b:	74 a9                	je     800d46 <memset+0x2c>
+  800d9d:	89 07                	mov    %eax,(%rdi)
+  800d9f:	48 83 c7 04          	add    $0x4,%rdi
+  800da3:	eb a1                	jmp    800d46 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da5:	41 f6 c1 04          	test   $0x4,%r9b
+  800da9:	74 06                	je     800db1 <memset+0x97>
+  800dab:	89 07                	mov    %eax,(%rdi)
+  800dad:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800db1:	41 f6 c1 02          	test   $0x2,%r9b
+  800db5:	74 07                	je     800dbe <memset+0xa4>
+  800db7:	66 89 07             	mov    %ax,(%rdi)
+  800dba:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dbe:	41 f6 c1 01          	test   $0x1,%r9b
+  800dc2:	74 9c                	je     800d60 <memset+0x46>
+  800dc4:	88 07                	mov    %al,(%rdi)
+  800dc6:	eb 98                	jmp    800d60 <memset+0x46>
+
+0000000000800dc8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dc8:	48 89 f8             	mov    %rdi,%rax
+  800dcb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dce:	48 39 fe             	cmp    %rdi,%rsi
+  800dd1:	73 3b                	jae    800e0e <memmove+0x46>
+  800dd3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dd7:	48 39 d7             	cmp    %rdx,%rdi
+  800dda:	73 32                	jae    800e0e <memmove+0x46>
+        s += n;
+        d += n;
+  800ddc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de0:	48 89 d6             	mov    %rdx,%rsi
+  800de3:	48 09 fe             	or     %rdi,%rsi
+  800de6:	48 09 ce             	or     %rcx,%rsi
+  800de9:	40 f6 c6 07          	test   $0x7,%sil
+  800ded:	75 12                	jne    800e01 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800def:	48 83 ef 08          	sub    $0x8,%rdi
+  800df3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800df7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dfb:	fd                   	std
+  800dfc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dff:	fc                   	cld
+  800e00:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e01:	48 83 ef 01          	sub    $0x1,%rdi
+  800e05:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e09:	fd                   	std
+  800e0a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e0c:	eb f1                	jmp    800dff <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e0e:	48 89 f2             	mov    %rsi,%rdx
+  800e11:	48 09 c2             	or     %rax,%rdx
+  800e14:	48 09 ca             	or     %rcx,%rdx
+  800e17:	f6 c2 07             	test   $0x7,%dl
+  800e1a:	75 0c                	jne    800e28 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e1c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e20:	48 89 c7             	mov    %rax,%rdi
+  800e23:	fc                   	cld
+  800e24:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e27:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e28:	48 89 c7             	mov    %rax,%rdi
+  800e2b:	fc                   	cld
+  800e2c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e2e:	c3                   	ret
+
+0000000000800e2f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e2f:	55                   	push   %rbp
+  800e30:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e33:	48 b8 c8 0d 80 00 00 	movabs $0x800dc8,%rax
+  800e3a:	00 00 00 
+  800e3d:	ff d0                	call   *%rax
+}
+  800e3f:	5d                   	pop    %rbp
+  800e40:	c3                   	ret
+
+0000000000800e41 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e41:	55                   	push   %rbp
+  800e42:	48 89 e5             	mov    %rsp,%rbp
+  800e45:	41 57                	push   %r15
+  800e47:	41 56                	push   %r14
+  800e49:	41 55                	push   %r13
+  800e4b:	41 54                	push   %r12
+  800e4d:	53                   	push   %rbx
+  800e4e:	48 83 ec 08          	sub    $0x8,%rsp
+  800e52:	49 89 fe             	mov    %rdi,%r14
+  800e55:	49 89 f7             	mov    %rsi,%r15
+  800e58:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e5b:	48 89 f7             	mov    %rsi,%rdi
+  800e5e:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  800e65:	00 00 00 
+  800e68:	ff d0                	call   *%rax
+  800e6a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e6d:	48 89 de             	mov    %rbx,%rsi
+  800e70:	4c 89 f7             	mov    %r14,%rdi
+  800e73:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  800e7a:	00 00 00 
+  800e7d:	ff d0                	call   *%rax
+  800e7f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e82:	48 39 c3             	cmp    %rax,%rbx
+  800e85:	74 36                	je     800ebd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e87:	48 89 d8             	mov    %rbx,%rax
+  800e8a:	4c 29 e8             	sub    %r13,%rax
+  800e8d:	49 39 c4             	cmp    %rax,%r12
+  800e90:	73 31                	jae    800ec3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e92:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e97:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e9b:	4c 89 fe             	mov    %r15,%rsi
+  800e9e:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800ea5:	00 00 00 
+  800ea8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eaa:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eae:	48 83 c4 08          	add    $0x8,%rsp
+  800eb2:	5b                   	pop    %rbx
+  800eb3:	41 5c                	pop    %r12
+  800eb5:	41 5d                	pop    %r13
+  800eb7:	41 5e                	pop    %r14
+  800eb9:	41 5f                	pop    %r15
+  800ebb:	5d                   	pop    %rbp
+  800ebc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ebd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec1:	eb eb                	jmp    800eae <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ec3:	48 83 eb 01          	sub    $0x1,%rbx
+  800ec7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ecb:	48 89 da             	mov    %rbx,%rdx
+  800ece:	4c 89 fe             	mov    %r15,%rsi
+  800ed1:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800ed8:	00 00 00 
+  800edb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800edd:	49 01 de             	add    %rbx,%r14
+  800ee0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ee5:	eb c3                	jmp    800eaa <strlcat+0x69>
+
+0000000000800ee7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ee7:	48 85 d2             	test   %rdx,%rdx
+  800eea:	74 2d                	je     800f19 <memcmp+0x32>
+  800eec:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ef1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ef5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800efa:	44 38 c1             	cmp    %r8b,%cl
+  800efd:	75 0f                	jne    800f0e <memcmp+0x27>
+    while (n-- > 0) {
+  800eff:	48 83 c0 01          	add    $0x1,%rax
+  800f03:	48 39 c2             	cmp    %rax,%rdx
+  800f06:	75 e9                	jne    800ef1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f0e:	0f b6 c1             	movzbl %cl,%eax
+  800f11:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f15:	44 29 c0             	sub    %r8d,%eax
+  800f18:	c3                   	ret
+    return 0;
+  800f19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f1e:	c3                   	ret
+
+0000000000800f1f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f1f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f23:	48 39 c7             	cmp    %rax,%rdi
+  800f26:	73 0f                	jae    800f37 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f28:	40 38 37             	cmp    %sil,(%rdi)
+  800f2b:	74 0e                	je     800f3b <memfind+0x1c>
+    for (; src < end; src++) {
+  800f2d:	48 83 c7 01          	add    $0x1,%rdi
+  800f31:	48 39 f8             	cmp    %rdi,%rax
+  800f34:	75 f2                	jne    800f28 <memfind+0x9>
+  800f36:	c3                   	ret
+  800f37:	48 89 f8             	mov    %rdi,%rax
+  800f3a:	c3                   	ret
+  800f3b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f3e:	c3                   	ret
+
+0000000000800f3f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f3f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f42:	0f b6 37             	movzbl (%rdi),%esi
+  800f45:	40 80 fe 20          	cmp    $0x20,%sil
+  800f49:	74 06                	je     800f51 <strtol+0x12>
+  800f4b:	40 80 fe 09          	cmp    $0x9,%sil
+  800f4f:	75 13                	jne    800f64 <strtol+0x25>
+  800f51:	48 83 c7 01          	add    $0x1,%rdi
+  800f55:	0f b6 37             	movzbl (%rdi),%esi
+  800f58:	40 80 fe 20          	cmp    $0x20,%sil
+  800f5c:	74 f3                	je     800f51 <strtol+0x12>
+  800f5e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f62:	74 ed                	je     800f51 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f64:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f67:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f6a:	3c 01                	cmp    $0x1,%al
+  800f6c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f70:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f76:	75 0f                	jne    800f87 <strtol+0x48>
+  800f78:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f7b:	74 14                	je     800f91 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f7d:	85 d2                	test   %edx,%edx
+  800f7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f84:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f8c:	4c 63 ca             	movslq %edx,%r9
+  800f8f:	eb 36                	jmp    800fc7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f91:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f95:	74 0f                	je     800fa6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f97:	85 d2                	test   %edx,%edx
+  800f99:	75 ec                	jne    800f87 <strtol+0x48>
+        s++;
+  800f9b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f9f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fa4:	eb e1                	jmp    800f87 <strtol+0x48>
+        s += 2;
+  800fa6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800faa:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800faf:	eb d6                	jmp    800f87 <strtol+0x48>
+            dig -= '0';
+  800fb1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fb4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fb8:	41 39 d0             	cmp    %edx,%r8d
+  800fbb:	7d 21                	jge    800fde <strtol+0x9f>
+        val = val * base + dig;
+  800fbd:	49 0f af c1          	imul   %r9,%rax
+  800fc1:	0f b6 c9             	movzbl %cl,%ecx
+  800fc4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fc7:	48 83 c7 01          	add    $0x1,%rdi
+  800fcb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fcf:	80 f9 39             	cmp    $0x39,%cl
+  800fd2:	76 dd                	jbe    800fb1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fd4:	80 f9 7b             	cmp    $0x7b,%cl
+  800fd7:	77 05                	ja     800fde <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fd9:	83 e9 57             	sub    $0x57,%ecx
+  800fdc:	eb d6                	jmp    800fb4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fde:	4d 85 d2             	test   %r10,%r10
+  800fe1:	74 03                	je     800fe6 <strtol+0xa7>
+  800fe3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fe6:	48 89 c2             	mov    %rax,%rdx
+  800fe9:	48 f7 da             	neg    %rdx
+  800fec:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800ff0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800ff4:	c3                   	ret
+
+0000000000800ff5 <strrev>:
+
+void
+strrev(char *str)
+{
+  800ff5:	55                   	push   %rbp
+  800ff6:	48 89 e5             	mov    %rsp,%rbp
+  800ff9:	53                   	push   %rbx
+  800ffa:	48 83 ec 08          	sub    $0x8,%rsp
+  800ffe:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801001:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  801008:	00 00 00 
+  80100b:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80100d:	83 e8 01             	sub    $0x1,%eax
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7e 22                	jle    801036 <strrev+0x41>
+  801014:	48 98                	cltq
+  801016:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80101b:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80101f:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801023:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801027:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80102a:	48 83 c2 01          	add    $0x1,%rdx
+  80102e:	48 83 e8 01          	sub    $0x1,%rax
+  801032:	39 c2                	cmp    %eax,%edx
+  801034:	7c e5                	jl     80101b <strrev+0x26>
+	}
+}
+  801036:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103a:	c9                   	leave
+  80103b:	c3                   	ret
+
+000000000080103c <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80103c:	85 d2                	test   %edx,%edx
+  80103e:	0f 84 80 00 00 00    	je     8010c4 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801044:	55                   	push   %rbp
+  801045:	48 89 e5             	mov    %rsp,%rbp
+  801048:	53                   	push   %rbx
+  801049:	48 83 ec 08          	sub    $0x8,%rsp
+  80104d:	49 89 f2             	mov    %rsi,%r10
+  801050:	41 89 d3             	mov    %edx,%r11d
+  801053:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801056:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80105b:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80105e:	eb 20                	jmp    801080 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801060:	41 89 f1             	mov    %esi,%r9d
+  801063:	83 c2 30             	add    $0x30,%edx
+  801066:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801069:	89 f8                	mov    %edi,%eax
+  80106b:	99                   	cltd
+  80106c:	f7 f9                	idiv   %ecx
+  80106e:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801070:	85 c0                	test   %eax,%eax
+  801072:	74 2e                	je     8010a2 <itoa+0x66>
+  801074:	83 c6 01             	add    $0x1,%esi
+  801077:	49 83 c0 01          	add    $0x1,%r8
+  80107b:	44 39 cb             	cmp    %r9d,%ebx
+  80107e:	7e 15                	jle    801095 <itoa+0x59>
+		digit = sum % base;
+  801080:	89 f8                	mov    %edi,%eax
+  801082:	99                   	cltd
+  801083:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801085:	83 fa 09             	cmp    $0x9,%edx
+  801088:	7e d6                	jle    801060 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80108a:	41 89 f1             	mov    %esi,%r9d
+  80108d:	83 c2 37             	add    $0x37,%edx
+  801090:	41 88 10             	mov    %dl,(%r8)
+  801093:	eb d4                	jmp    801069 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801095:	41 83 eb 01          	sub    $0x1,%r11d
+  801099:	45 39 cb             	cmp    %r9d,%r11d
+  80109c:	75 04                	jne    8010a2 <itoa+0x66>
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	75 28                	jne    8010ca <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8010a2:	4d 63 c9             	movslq %r9d,%r9
+  8010a5:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8010aa:	4c 89 d7             	mov    %r10,%rdi
+  8010ad:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  8010b4:	00 00 00 
+  8010b7:	ff d0                	call   *%rax
+	return 0;
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c2:	c9                   	leave
+  8010c3:	c3                   	ret
+		return -1;
+  8010c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010c9:	c3                   	ret
+		return -1;
+  8010ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010cf:	eb ed                	jmp    8010be <itoa+0x82>
+
+00000000008010d1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010d1:	55                   	push   %rbp
+  8010d2:	48 89 e5             	mov    %rsp,%rbp
+  8010d5:	53                   	push   %rbx
+  8010d6:	48 89 fa             	mov    %rdi,%rdx
+  8010d9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010dc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fc:	c9                   	leave
+  8010fd:	c3                   	ret
+
+00000000008010fe <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010fe:	55                   	push   %rbp
+  8010ff:	48 89 e5             	mov    %rsp,%rbp
+  801102:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801103:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801117:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111c:	be 00 00 00 00       	mov    $0x0,%esi
+  801121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801127:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112d:	c9                   	leave
+  80112e:	c3                   	ret
+
+000000000080112f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80112f:	55                   	push   %rbp
+  801130:	48 89 e5             	mov    %rsp,%rbp
+  801133:	53                   	push   %rbx
+  801134:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801138:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80113b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801140:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80114f:	be 00 00 00 00       	mov    $0x0,%esi
+  801154:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80115c:	48 85 c0             	test   %rax,%rax
+  80115f:	7f 06                	jg     801167 <sys_env_destroy+0x38>
+}
+  801161:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801165:	c9                   	leave
+  801166:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801167:	49 89 c0             	mov    %rax,%r8
+  80116a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80116f:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  801176:	00 00 00 
+  801179:	be 26 00 00 00       	mov    $0x26,%esi
+  80117e:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  801185:	00 00 00 
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118d:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  801194:	00 00 00 
+  801197:	41 ff d1             	call   *%r9
+
+000000000080119a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80119a:	55                   	push   %rbp
+  80119b:	48 89 e5             	mov    %rsp,%rbp
+  80119e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80119f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c9:	c9                   	leave
+  8011ca:	c3                   	ret
+
+00000000008011cb <sys_yield>:
+
+void
+sys_yield(void) {
+  8011cb:	55                   	push   %rbp
+  8011cc:	48 89 e5             	mov    %rsp,%rbp
+  8011cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fa:	c9                   	leave
+  8011fb:	c3                   	ret
+
+00000000008011fc <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011fc:	55                   	push   %rbp
+  8011fd:	48 89 e5             	mov    %rsp,%rbp
+  801200:	53                   	push   %rbx
+  801201:	48 89 fa             	mov    %rdi,%rdx
+  801204:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801207:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801213:	00 00 00 
+  801216:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801226:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+000000000080122e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80122e:	55                   	push   %rbp
+  80122f:	48 89 e5             	mov    %rsp,%rbp
+  801232:	53                   	push   %rbx
+  801233:	49 89 f8             	mov    %rdi,%r8
+  801236:	48 89 d3             	mov    %rdx,%rbx
+  801239:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80123c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801241:	4c 89 c2             	mov    %r8,%rdx
+  801244:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801247:	be 00 00 00 00       	mov    $0x0,%esi
+  80124c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801252:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+
+000000000080125a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80125a:	55                   	push   %rbp
+  80125b:	48 89 e5             	mov    %rsp,%rbp
+  80125e:	53                   	push   %rbx
+  80125f:	48 83 ec 08          	sub    $0x8,%rsp
+  801263:	89 f8                	mov    %edi,%eax
+  801265:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801268:	48 63 f9             	movslq %ecx,%rdi
+  80126b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80126e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801273:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801276:	be 00 00 00 00       	mov    $0x0,%esi
+  80127b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801281:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801283:	48 85 c0             	test   %rax,%rax
+  801286:	7f 06                	jg     80128e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801288:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128c:	c9                   	leave
+  80128d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80128e:	49 89 c0             	mov    %rax,%r8
+  801291:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801296:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  80129d:	00 00 00 
+  8012a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a5:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  8012ac:	00 00 00 
+  8012af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b4:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  8012bb:	00 00 00 
+  8012be:	41 ff d1             	call   *%r9
+
+00000000008012c1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+  8012c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ca:	89 f8                	mov    %edi,%eax
+  8012cc:	49 89 f2             	mov    %rsi,%r10
+  8012cf:	48 89 cf             	mov    %rcx,%rdi
+  8012d2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012d5:	48 63 da             	movslq %edx,%rbx
+  8012d8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012db:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e8:	48 85 c0             	test   %rax,%rax
+  8012eb:	7f 06                	jg     8012f3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f1:	c9                   	leave
+  8012f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f3:	49 89 c0             	mov    %rax,%r8
+  8012f6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012fb:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  801302:	00 00 00 
+  801305:	be 26 00 00 00       	mov    $0x26,%esi
+  80130a:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  801311:	00 00 00 
+  801314:	b8 00 00 00 00       	mov    $0x0,%eax
+  801319:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  801320:	00 00 00 
+  801323:	41 ff d1             	call   *%r9
+
+0000000000801326 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+  80132a:	53                   	push   %rbx
+  80132b:	48 83 ec 08          	sub    $0x8,%rsp
+  80132f:	48 89 f1             	mov    %rsi,%rcx
+  801332:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801335:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801338:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80133d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801342:	be 00 00 00 00       	mov    $0x0,%esi
+  801347:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134f:	48 85 c0             	test   %rax,%rax
+  801352:	7f 06                	jg     80135a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801354:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801358:	c9                   	leave
+  801359:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135a:	49 89 c0             	mov    %rax,%r8
+  80135d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801362:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  801369:	00 00 00 
+  80136c:	be 26 00 00 00       	mov    $0x26,%esi
+  801371:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  801378:	00 00 00 
+  80137b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801380:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  801387:	00 00 00 
+  80138a:	41 ff d1             	call   *%r9
+
+000000000080138d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80138d:	55                   	push   %rbp
+  80138e:	48 89 e5             	mov    %rsp,%rbp
+  801391:	53                   	push   %rbx
+  801392:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801396:	48 63 ce             	movslq %esi,%rcx
+  801399:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80139c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b8:	48 85 c0             	test   %rax,%rax
+  8013bb:	7f 06                	jg     8013c3 <sys_env_set_status+0x36>
+}
+  8013bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c1:	c9                   	leave
+  8013c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c3:	49 89 c0             	mov    %rax,%r8
+  8013c6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013cb:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  8013d2:	00 00 00 
+  8013d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8013da:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  8013e1:	00 00 00 
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e9:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  8013f0:	00 00 00 
+  8013f3:	41 ff d1             	call   *%r9
+
+00000000008013f6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013f6:	55                   	push   %rbp
+  8013f7:	48 89 e5             	mov    %rsp,%rbp
+  8013fa:	53                   	push   %rbx
+  8013fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ff:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801402:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801414:	be 00 00 00 00       	mov    $0x0,%esi
+  801419:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801421:	48 85 c0             	test   %rax,%rax
+  801424:	7f 06                	jg     80142c <sys_env_set_trapframe+0x36>
+}
+  801426:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142c:	49 89 c0             	mov    %rax,%r8
+  80142f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801434:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  80143b:	00 00 00 
+  80143e:	be 26 00 00 00       	mov    $0x26,%esi
+  801443:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  80144a:	00 00 00 
+  80144d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801452:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  801459:	00 00 00 
+  80145c:	41 ff d1             	call   *%r9
+
+000000000080145f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	53                   	push   %rbx
+  801464:	48 83 ec 08          	sub    $0x8,%rsp
+  801468:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80146b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801478:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147d:	be 00 00 00 00       	mov    $0x0,%esi
+  801482:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801488:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148a:	48 85 c0             	test   %rax,%rax
+  80148d:	7f 06                	jg     801495 <sys_env_set_pgfault_upcall+0x36>
+}
+  80148f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801493:	c9                   	leave
+  801494:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801495:	49 89 c0             	mov    %rax,%r8
+  801498:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80149d:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  8014a4:	00 00 00 
+  8014a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ac:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  8014b3:	00 00 00 
+  8014b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bb:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  8014c2:	00 00 00 
+  8014c5:	41 ff d1             	call   *%r9
+
+00000000008014c8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	53                   	push   %rbx
+  8014cd:	89 f8                	mov    %edi,%eax
+  8014cf:	49 89 f1             	mov    %rsi,%r9
+  8014d2:	48 89 d3             	mov    %rdx,%rbx
+  8014d5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014d8:	49 63 f0             	movslq %r8d,%rsi
+  8014db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014de:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ec:	cd 30                	int    $0x30
+}
+  8014ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+
+00000000008014f4 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014f4:	55                   	push   %rbp
+  8014f5:	48 89 e5             	mov    %rsp,%rbp
+  8014f8:	53                   	push   %rbx
+  8014f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fd:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801500:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801503:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801508:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801510:	be 00 00 00 00       	mov    $0x0,%esi
+  801515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151d:	48 85 c0             	test   %rax,%rax
+  801520:	7f 06                	jg     801528 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801522:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801528:	49 89 c0             	mov    %rax,%r8
+  80152b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801530:	48 ba 48 3d 80 00 00 	movabs $0x803d48,%rdx
+  801537:	00 00 00 
+  80153a:	be 26 00 00 00       	mov    $0x26,%esi
+  80153f:	48 bf 67 3d 80 00 00 	movabs $0x803d67,%rdi
+  801546:	00 00 00 
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154e:	49 b9 bb 34 80 00 00 	movabs $0x8034bb,%r9
+  801555:	00 00 00 
+  801558:	41 ff d1             	call   *%r9
+
+000000000080155b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80155b:	55                   	push   %rbp
+  80155c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80155f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801564:	48 b8 f4 14 80 00 00 	movabs $0x8014f4,%rax
+  80156b:	00 00 00 
+  80156e:	ff d0                	call   *%rax
+}
+  801570:	5d                   	pop    %rbp
+  801571:	c3                   	ret
+
+0000000000801572 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801577:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80157c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801581:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801586:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801590:	be 00 00 00 00       	mov    $0x0,%esi
+  801595:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80159d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+
+00000000008015a3 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8015a3:	55                   	push   %rbp
+  8015a4:	48 89 e5             	mov    %rsp,%rbp
+  8015a7:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8015a8:	48 63 ce             	movslq %esi,%rcx
+  8015ab:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8015af:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015be:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c9:	cd 30                	int    $0x30
+}
+  8015cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+
+00000000008015d1 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015d1:	55                   	push   %rbp
+  8015d2:	48 89 e5             	mov    %rsp,%rbp
+  8015d5:	53                   	push   %rbx
+  8015d6:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015d9:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f7:	cd 30                	int    $0x30
+}
+  8015f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+
+00000000008015ff <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015ff:	55                   	push   %rbp
+  801600:	48 89 e5             	mov    %rsp,%rbp
+  801603:	53                   	push   %rbx
+  801604:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801607:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80160a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80160f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801612:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801617:	be 00 00 00 00       	mov    $0x0,%esi
+  80161c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801622:	cd 30                	int    $0x30
+}
+  801624:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801628:	c9                   	leave
+  801629:	c3                   	ret
+
+000000000080162a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80162a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801631:	ff ff ff 
+  801634:	48 01 f8             	add    %rdi,%rax
+  801637:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80163b:	c3                   	ret
+
+000000000080163c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80163c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801643:	ff ff ff 
+  801646:	48 01 f8             	add    %rdi,%rax
+  801649:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80164d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801653:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801657:	c3                   	ret
+
+0000000000801658 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801658:	55                   	push   %rbp
+  801659:	48 89 e5             	mov    %rsp,%rbp
+  80165c:	41 57                	push   %r15
+  80165e:	41 56                	push   %r14
+  801660:	41 55                	push   %r13
+  801662:	41 54                	push   %r12
+  801664:	53                   	push   %rbx
+  801665:	48 83 ec 08          	sub    $0x8,%rsp
+  801669:	49 89 ff             	mov    %rdi,%r15
+  80166c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801671:	49 bd 77 31 80 00 00 	movabs $0x803177,%r13
+  801678:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80167b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801681:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801684:	48 89 df             	mov    %rbx,%rdi
+  801687:	41 ff d5             	call   *%r13
+  80168a:	83 e0 04             	and    $0x4,%eax
+  80168d:	74 17                	je     8016a6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80168f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801696:	4c 39 f3             	cmp    %r14,%rbx
+  801699:	75 e6                	jne    801681 <fd_alloc+0x29>
+  80169b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016a1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016a6:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016a9:	48 83 c4 08          	add    $0x8,%rsp
+  8016ad:	5b                   	pop    %rbx
+  8016ae:	41 5c                	pop    %r12
+  8016b0:	41 5d                	pop    %r13
+  8016b2:	41 5e                	pop    %r14
+  8016b4:	41 5f                	pop    %r15
+  8016b6:	5d                   	pop    %rbp
+  8016b7:	c3                   	ret
+
+00000000008016b8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016b8:	83 ff 1f             	cmp    $0x1f,%edi
+  8016bb:	77 39                	ja     8016f6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	41 54                	push   %r12
+  8016c3:	53                   	push   %rbx
+  8016c4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016c7:	48 63 df             	movslq %edi,%rbx
+  8016ca:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016d1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016d5:	48 89 df             	mov    %rbx,%rdi
+  8016d8:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  8016df:	00 00 00 
+  8016e2:	ff d0                	call   *%rax
+  8016e4:	a8 04                	test   $0x4,%al
+  8016e6:	74 14                	je     8016fc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016e8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f1:	5b                   	pop    %rbx
+  8016f2:	41 5c                	pop    %r12
+  8016f4:	5d                   	pop    %rbp
+  8016f5:	c3                   	ret
+        return -E_INVAL;
+  8016f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016fb:	c3                   	ret
+        return -E_INVAL;
+  8016fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801701:	eb ee                	jmp    8016f1 <fd_lookup+0x39>
+
+0000000000801703 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801703:	55                   	push   %rbp
+  801704:	48 89 e5             	mov    %rsp,%rbp
+  801707:	41 54                	push   %r12
+  801709:	53                   	push   %rbx
+  80170a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80170d:	48 b8 20 3e 80 00 00 	movabs $0x803e20,%rax
+  801714:	00 00 00 
+  801717:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80171e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801721:	39 3b                	cmp    %edi,(%rbx)
+  801723:	74 47                	je     80176c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801725:	48 83 c0 08          	add    $0x8,%rax
+  801729:	48 8b 18             	mov    (%rax),%rbx
+  80172c:	48 85 db             	test   %rbx,%rbx
+  80172f:	75 f0                	jne    801721 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801731:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801738:	00 00 00 
+  80173b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801741:	89 fa                	mov    %edi,%edx
+  801743:	48 bf 78 3d 80 00 00 	movabs $0x803d78,%rdi
+  80174a:	00 00 00 
+  80174d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801752:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  801759:	00 00 00 
+  80175c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80175e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801763:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801767:	5b                   	pop    %rbx
+  801768:	41 5c                	pop    %r12
+  80176a:	5d                   	pop    %rbp
+  80176b:	c3                   	ret
+            return 0;
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	eb f0                	jmp    801763 <dev_lookup+0x60>
+
+0000000000801773 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+  801777:	41 55                	push   %r13
+  801779:	41 54                	push   %r12
+  80177b:	53                   	push   %rbx
+  80177c:	48 83 ec 18          	sub    $0x18,%rsp
+  801780:	48 89 fb             	mov    %rdi,%rbx
+  801783:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801786:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80178d:	ff ff ff 
+  801790:	48 01 df             	add    %rbx,%rdi
+  801793:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801797:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80179b:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+  8017a7:	41 89 c5             	mov    %eax,%r13d
+  8017aa:	85 c0                	test   %eax,%eax
+  8017ac:	78 06                	js     8017b4 <fd_close+0x41>
+  8017ae:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017b2:	74 1a                	je     8017ce <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017b4:	45 84 e4             	test   %r12b,%r12b
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bc:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017c0:	44 89 e8             	mov    %r13d,%eax
+  8017c3:	48 83 c4 18          	add    $0x18,%rsp
+  8017c7:	5b                   	pop    %rbx
+  8017c8:	41 5c                	pop    %r12
+  8017ca:	41 5d                	pop    %r13
+  8017cc:	5d                   	pop    %rbp
+  8017cd:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017ce:	8b 3b                	mov    (%rbx),%edi
+  8017d0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017d4:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  8017db:	00 00 00 
+  8017de:	ff d0                	call   *%rax
+  8017e0:	41 89 c5             	mov    %eax,%r13d
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 1b                	js     801802 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017eb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8017ef:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017f5:	48 85 c0             	test   %rax,%rax
+  8017f8:	74 08                	je     801802 <fd_close+0x8f>
+  8017fa:	48 89 df             	mov    %rbx,%rdi
+  8017fd:	ff d0                	call   *%rax
+  8017ff:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801802:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801807:	48 89 de             	mov    %rbx,%rsi
+  80180a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80180f:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  801816:	00 00 00 
+  801819:	ff d0                	call   *%rax
+    return res;
+  80181b:	eb a3                	jmp    8017c0 <fd_close+0x4d>
+
+000000000080181d <close>:
+
+int
+close(int fdnum) {
+  80181d:	55                   	push   %rbp
+  80181e:	48 89 e5             	mov    %rsp,%rbp
+  801821:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801825:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801829:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801830:	00 00 00 
+  801833:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 15                	js     80184e <close+0x31>
+
+    return fd_close(fd, 1);
+  801839:	be 01 00 00 00       	mov    $0x1,%esi
+  80183e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801842:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  801849:	00 00 00 
+  80184c:	ff d0                	call   *%rax
+}
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+
+0000000000801850 <close_all>:
+
+void
+close_all(void) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+  801854:	41 54                	push   %r12
+  801856:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801857:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185c:	49 bc 1d 18 80 00 00 	movabs $0x80181d,%r12
+  801863:	00 00 00 
+  801866:	89 df                	mov    %ebx,%edi
+  801868:	41 ff d4             	call   *%r12
+  80186b:	83 c3 01             	add    $0x1,%ebx
+  80186e:	83 fb 20             	cmp    $0x20,%ebx
+  801871:	75 f3                	jne    801866 <close_all+0x16>
+}
+  801873:	5b                   	pop    %rbx
+  801874:	41 5c                	pop    %r12
+  801876:	5d                   	pop    %rbp
+  801877:	c3                   	ret
+
+0000000000801878 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801878:	55                   	push   %rbp
+  801879:	48 89 e5             	mov    %rsp,%rbp
+  80187c:	41 57                	push   %r15
+  80187e:	41 56                	push   %r14
+  801880:	41 55                	push   %r13
+  801882:	41 54                	push   %r12
+  801884:	53                   	push   %rbx
+  801885:	48 83 ec 18          	sub    $0x18,%rsp
+  801889:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80188c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801890:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801897:	00 00 00 
+  80189a:	ff d0                	call   *%rax
+  80189c:	89 c3                	mov    %eax,%ebx
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	0f 88 b8 00 00 00    	js     80195e <dup+0xe6>
+    close(newfdnum);
+  8018a6:	44 89 e7             	mov    %r12d,%edi
+  8018a9:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  8018b0:	00 00 00 
+  8018b3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018b5:	4d 63 ec             	movslq %r12d,%r13
+  8018b8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018bf:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018c3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018c7:	4c 89 ff             	mov    %r15,%rdi
+  8018ca:	49 be 3c 16 80 00 00 	movabs $0x80163c,%r14
+  8018d1:	00 00 00 
+  8018d4:	41 ff d6             	call   *%r14
+  8018d7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018da:	4c 89 ef             	mov    %r13,%rdi
+  8018dd:	41 ff d6             	call   *%r14
+  8018e0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018e3:	48 89 df             	mov    %rbx,%rdi
+  8018e6:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  8018ed:	00 00 00 
+  8018f0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018f2:	a8 04                	test   $0x4,%al
+  8018f4:	74 2b                	je     801921 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018f6:	41 89 c1             	mov    %eax,%r9d
+  8018f9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018ff:	4c 89 f1             	mov    %r14,%rcx
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	48 89 de             	mov    %rbx,%rsi
+  80190a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80190f:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+  80191b:	89 c3                	mov    %eax,%ebx
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	78 4e                	js     80196f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801921:	4c 89 ff             	mov    %r15,%rdi
+  801924:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  80192b:	00 00 00 
+  80192e:	ff d0                	call   *%rax
+  801930:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801933:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801939:	4c 89 e9             	mov    %r13,%rcx
+  80193c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801941:	4c 89 fe             	mov    %r15,%rsi
+  801944:	bf 00 00 00 00       	mov    $0x0,%edi
+  801949:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  801950:	00 00 00 
+  801953:	ff d0                	call   *%rax
+  801955:	89 c3                	mov    %eax,%ebx
+  801957:	85 c0                	test   %eax,%eax
+  801959:	78 14                	js     80196f <dup+0xf7>
+
+    return newfdnum;
+  80195b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80195e:	89 d8                	mov    %ebx,%eax
+  801960:	48 83 c4 18          	add    $0x18,%rsp
+  801964:	5b                   	pop    %rbx
+  801965:	41 5c                	pop    %r12
+  801967:	41 5d                	pop    %r13
+  801969:	41 5e                	pop    %r14
+  80196b:	41 5f                	pop    %r15
+  80196d:	5d                   	pop    %rbp
+  80196e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80196f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801974:	4c 89 ee             	mov    %r13,%rsi
+  801977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80197c:	49 bc 26 13 80 00 00 	movabs $0x801326,%r12
+  801983:	00 00 00 
+  801986:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801989:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80198e:	4c 89 f6             	mov    %r14,%rsi
+  801991:	bf 00 00 00 00       	mov    $0x0,%edi
+  801996:	41 ff d4             	call   *%r12
+    return res;
+  801999:	eb c3                	jmp    80195e <dup+0xe6>
+
+000000000080199b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	41 56                	push   %r14
+  8019a1:	41 55                	push   %r13
+  8019a3:	41 54                	push   %r12
+  8019a5:	53                   	push   %rbx
+  8019a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8019aa:	89 fb                	mov    %edi,%ebx
+  8019ac:	49 89 f4             	mov    %rsi,%r12
+  8019af:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019b2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019b6:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  8019bd:	00 00 00 
+  8019c0:	ff d0                	call   *%rax
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 4c                	js     801a12 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019c6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019ca:	41 8b 3e             	mov    (%r14),%edi
+  8019cd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019d1:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  8019d8:	00 00 00 
+  8019db:	ff d0                	call   *%rax
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	78 35                	js     801a16 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019e1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019e5:	83 e0 03             	and    $0x3,%eax
+  8019e8:	83 f8 01             	cmp    $0x1,%eax
+  8019eb:	74 2d                	je     801a1a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019f5:	48 85 c0             	test   %rax,%rax
+  8019f8:	74 56                	je     801a50 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019fa:	4c 89 ea             	mov    %r13,%rdx
+  8019fd:	4c 89 e6             	mov    %r12,%rsi
+  801a00:	4c 89 f7             	mov    %r14,%rdi
+  801a03:	ff d0                	call   *%rax
+}
+  801a05:	48 83 c4 10          	add    $0x10,%rsp
+  801a09:	5b                   	pop    %rbx
+  801a0a:	41 5c                	pop    %r12
+  801a0c:	41 5d                	pop    %r13
+  801a0e:	41 5e                	pop    %r14
+  801a10:	5d                   	pop    %rbp
+  801a11:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a12:	48 98                	cltq
+  801a14:	eb ef                	jmp    801a05 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a16:	48 98                	cltq
+  801a18:	eb eb                	jmp    801a05 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a1a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a21:	00 00 00 
+  801a24:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a2a:	89 da                	mov    %ebx,%edx
+  801a2c:	48 bf d9 3d 80 00 00 	movabs $0x803dd9,%rdi
+  801a33:	00 00 00 
+  801a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3b:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  801a42:	00 00 00 
+  801a45:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a47:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a4e:	eb b5                	jmp    801a05 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a50:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a57:	eb ac                	jmp    801a05 <read+0x6a>
+
+0000000000801a59 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a59:	55                   	push   %rbp
+  801a5a:	48 89 e5             	mov    %rsp,%rbp
+  801a5d:	41 56                	push   %r14
+  801a5f:	41 55                	push   %r13
+  801a61:	41 54                	push   %r12
+  801a63:	53                   	push   %rbx
+  801a64:	48 83 ec 10          	sub    $0x10,%rsp
+  801a68:	89 fb                	mov    %edi,%ebx
+  801a6a:	49 89 f4             	mov    %rsi,%r12
+  801a6d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a70:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a74:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801a7b:	00 00 00 
+  801a7e:	ff d0                	call   *%rax
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	78 41                	js     801ac5 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a84:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a88:	41 8b 3e             	mov    (%r14),%edi
+  801a8b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a8f:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 35                	js     801ad4 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a9f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801aa3:	83 e0 03             	and    $0x3,%eax
+  801aa6:	83 f8 01             	cmp    $0x1,%eax
+  801aa9:	74 2d                	je     801ad8 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801aab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aaf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ab3:	48 85 c0             	test   %rax,%rax
+  801ab6:	74 56                	je     801b0e <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801ab8:	4c 89 ea             	mov    %r13,%rdx
+  801abb:	4c 89 e6             	mov    %r12,%rsi
+  801abe:	4c 89 f7             	mov    %r14,%rdi
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	eb 02                	jmp    801ac7 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ac5:	48 98                	cltq
+}
+  801ac7:	48 83 c4 10          	add    $0x10,%rsp
+  801acb:	5b                   	pop    %rbx
+  801acc:	41 5c                	pop    %r12
+  801ace:	41 5d                	pop    %r13
+  801ad0:	41 5e                	pop    %r14
+  801ad2:	5d                   	pop    %rbp
+  801ad3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ad4:	48 98                	cltq
+  801ad6:	eb ef                	jmp    801ac7 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ad8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801adf:	00 00 00 
+  801ae2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ae8:	89 da                	mov    %ebx,%edx
+  801aea:	48 bf 98 3d 80 00 00 	movabs $0x803d98,%rdi
+  801af1:	00 00 00 
+  801af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af9:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  801b00:	00 00 00 
+  801b03:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b05:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b0c:	eb b9                	jmp    801ac7 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b0e:	4c 89 ea             	mov    %r13,%rdx
+  801b11:	4c 89 e6             	mov    %r12,%rsi
+  801b14:	89 df                	mov    %ebx,%edi
+  801b16:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+  801b22:	eb a3                	jmp    801ac7 <readmap+0x6e>
+
+0000000000801b24 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	41 57                	push   %r15
+  801b2a:	41 56                	push   %r14
+  801b2c:	41 55                	push   %r13
+  801b2e:	41 54                	push   %r12
+  801b30:	53                   	push   %rbx
+  801b31:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b35:	48 85 d2             	test   %rdx,%rdx
+  801b38:	74 54                	je     801b8e <readn+0x6a>
+  801b3a:	41 89 fd             	mov    %edi,%r13d
+  801b3d:	49 89 f6             	mov    %rsi,%r14
+  801b40:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b43:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b48:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b4d:	49 bf 9b 19 80 00 00 	movabs $0x80199b,%r15
+  801b54:	00 00 00 
+  801b57:	4c 89 e2             	mov    %r12,%rdx
+  801b5a:	48 29 f2             	sub    %rsi,%rdx
+  801b5d:	4c 01 f6             	add    %r14,%rsi
+  801b60:	44 89 ef             	mov    %r13d,%edi
+  801b63:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	78 20                	js     801b8a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b6a:	01 c3                	add    %eax,%ebx
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	74 08                	je     801b78 <readn+0x54>
+  801b70:	48 63 f3             	movslq %ebx,%rsi
+  801b73:	4c 39 e6             	cmp    %r12,%rsi
+  801b76:	72 df                	jb     801b57 <readn+0x33>
+    }
+    return res;
+  801b78:	48 63 c3             	movslq %ebx,%rax
+}
+  801b7b:	48 83 c4 08          	add    $0x8,%rsp
+  801b7f:	5b                   	pop    %rbx
+  801b80:	41 5c                	pop    %r12
+  801b82:	41 5d                	pop    %r13
+  801b84:	41 5e                	pop    %r14
+  801b86:	41 5f                	pop    %r15
+  801b88:	5d                   	pop    %rbp
+  801b89:	c3                   	ret
+        if (inc < 0) return inc;
+  801b8a:	48 98                	cltq
+  801b8c:	eb ed                	jmp    801b7b <readn+0x57>
+    int inc = 1, res = 0;
+  801b8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b93:	eb e3                	jmp    801b78 <readn+0x54>
+
+0000000000801b95 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b95:	55                   	push   %rbp
+  801b96:	48 89 e5             	mov    %rsp,%rbp
+  801b99:	41 56                	push   %r14
+  801b9b:	41 55                	push   %r13
+  801b9d:	41 54                	push   %r12
+  801b9f:	53                   	push   %rbx
+  801ba0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ba4:	89 fb                	mov    %edi,%ebx
+  801ba6:	49 89 f4             	mov    %rsi,%r12
+  801ba9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb0:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 47                	js     801c07 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bc0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bc4:	41 8b 3e             	mov    (%r14),%edi
+  801bc7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bcb:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801bd2:	00 00 00 
+  801bd5:	ff d0                	call   *%rax
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 30                	js     801c0b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bdb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801be0:	74 2d                	je     801c0f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801be2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801be6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bea:	48 85 c0             	test   %rax,%rax
+  801bed:	74 56                	je     801c45 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bef:	4c 89 ea             	mov    %r13,%rdx
+  801bf2:	4c 89 e6             	mov    %r12,%rsi
+  801bf5:	4c 89 f7             	mov    %r14,%rdi
+  801bf8:	ff d0                	call   *%rax
+}
+  801bfa:	48 83 c4 10          	add    $0x10,%rsp
+  801bfe:	5b                   	pop    %rbx
+  801bff:	41 5c                	pop    %r12
+  801c01:	41 5d                	pop    %r13
+  801c03:	41 5e                	pop    %r14
+  801c05:	5d                   	pop    %rbp
+  801c06:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c07:	48 98                	cltq
+  801c09:	eb ef                	jmp    801bfa <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c0b:	48 98                	cltq
+  801c0d:	eb eb                	jmp    801bfa <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c16:	00 00 00 
+  801c19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c1f:	89 da                	mov    %ebx,%edx
+  801c21:	48 bf f5 3d 80 00 00 	movabs $0x803df5,%rdi
+  801c28:	00 00 00 
+  801c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c30:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  801c37:	00 00 00 
+  801c3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c3c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c43:	eb b5                	jmp    801bfa <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c45:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c4c:	eb ac                	jmp    801bfa <write+0x65>
+
+0000000000801c4e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	53                   	push   %rbx
+  801c53:	48 83 ec 18          	sub    $0x18,%rsp
+  801c57:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c59:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c5d:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801c64:	00 00 00 
+  801c67:	ff d0                	call   *%rax
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 0c                	js     801c79 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c71:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c7d:	c9                   	leave
+  801c7e:	c3                   	ret
+
+0000000000801c7f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c7f:	55                   	push   %rbp
+  801c80:	48 89 e5             	mov    %rsp,%rbp
+  801c83:	41 55                	push   %r13
+  801c85:	41 54                	push   %r12
+  801c87:	53                   	push   %rbx
+  801c88:	48 83 ec 18          	sub    $0x18,%rsp
+  801c8c:	89 fb                	mov    %edi,%ebx
+  801c8e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c95:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 38                	js     801cdd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ca5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ca9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cb1:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	78 1c                	js     801cdd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cc6:	74 20                	je     801ce8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cc8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ccc:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801cd0:	48 85 c0             	test   %rax,%rax
+  801cd3:	74 47                	je     801d1c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cd5:	44 89 e6             	mov    %r12d,%esi
+  801cd8:	4c 89 ef             	mov    %r13,%rdi
+  801cdb:	ff d0                	call   *%rax
+}
+  801cdd:	48 83 c4 18          	add    $0x18,%rsp
+  801ce1:	5b                   	pop    %rbx
+  801ce2:	41 5c                	pop    %r12
+  801ce4:	41 5d                	pop    %r13
+  801ce6:	5d                   	pop    %rbp
+  801ce7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ce8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cef:	00 00 00 
+  801cf2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cf8:	89 da                	mov    %ebx,%edx
+  801cfa:	48 bf b8 3d 80 00 00 	movabs $0x803db8,%rdi
+  801d01:	00 00 00 
+  801d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d09:	48 b9 a9 02 80 00 00 	movabs $0x8002a9,%rcx
+  801d10:	00 00 00 
+  801d13:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1a:	eb c1                	jmp    801cdd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d1c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d21:	eb ba                	jmp    801cdd <ftruncate+0x5e>
+
+0000000000801d23 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d23:	55                   	push   %rbp
+  801d24:	48 89 e5             	mov    %rsp,%rbp
+  801d27:	41 54                	push   %r12
+  801d29:	53                   	push   %rbx
+  801d2a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d2e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d35:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 4e                	js     801d93 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d45:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d49:	41 8b 3c 24          	mov    (%r12),%edi
+  801d4d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d51:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 32                	js     801d93 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d65:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d6a:	74 30                	je     801d9c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d6c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d6f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d76:	00 00 00 
+    stat->st_isdir = 0;
+  801d79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d80:	00 00 00 
+    stat->st_dev = dev;
+  801d83:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d8a:	48 89 de             	mov    %rbx,%rsi
+  801d8d:	4c 89 e7             	mov    %r12,%rdi
+  801d90:	ff 50 30             	call   *0x30(%rax)
+}
+  801d93:	48 83 c4 10          	add    $0x10,%rsp
+  801d97:	5b                   	pop    %rbx
+  801d98:	41 5c                	pop    %r12
+  801d9a:	5d                   	pop    %rbp
+  801d9b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d9c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801da1:	eb f0                	jmp    801d93 <fstat+0x70>
+
+0000000000801da3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801da3:	55                   	push   %rbp
+  801da4:	48 89 e5             	mov    %rsp,%rbp
+  801da7:	41 54                	push   %r12
+  801da9:	53                   	push   %rbx
+  801daa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dad:	be 00 00 00 00       	mov    $0x0,%esi
+  801db2:	48 b8 fa 2a 80 00 00 	movabs $0x802afa,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+  801dbe:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	78 25                	js     801de9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dc4:	4c 89 e6             	mov    %r12,%rsi
+  801dc7:	89 c7                	mov    %eax,%edi
+  801dc9:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dd8:	89 df                	mov    %ebx,%edi
+  801dda:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  801de1:	00 00 00 
+  801de4:	ff d0                	call   *%rax
+
+    return res;
+  801de6:	44 89 e3             	mov    %r12d,%ebx
+}
+  801de9:	89 d8                	mov    %ebx,%eax
+  801deb:	5b                   	pop    %rbx
+  801dec:	41 5c                	pop    %r12
+  801dee:	5d                   	pop    %rbp
+  801def:	c3                   	ret
+
+0000000000801df0 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+  801df7:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfb:	48 89 fb             	mov    %rdi,%rbx
+  801dfe:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e01:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e05:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e0a:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 1f                	js     801e39 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801e1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e1e:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801e22:	48 85 c0             	test   %rax,%rax
+  801e25:	74 1b                	je     801e42 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801e27:	4c 89 e6             	mov    %r12,%rsi
+  801e2a:	48 89 df             	mov    %rbx,%rdi
+  801e2d:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e36:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e39:	48 83 c4 10          	add    $0x10,%rsp
+  801e3d:	5b                   	pop    %rbx
+  801e3e:	41 5c                	pop    %r12
+  801e40:	5d                   	pop    %rbp
+  801e41:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e47:	eb f0                	jmp    801e39 <create_snapshot+0x49>
+
+0000000000801e49 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+  801e4d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e51:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e55:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e5a:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 1e                	js     801e88 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e6e:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e72:	48 85 d2             	test   %rdx,%rdx
+  801e75:	74 13                	je     801e8a <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7c:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e85:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e8a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e8f:	eb f7                	jmp    801e88 <print_snapshot_list+0x3f>
+
+0000000000801e91 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801e91:	55                   	push   %rbp
+  801e92:	48 89 e5             	mov    %rsp,%rbp
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea1:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ea6:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 1c                	js     801ed2 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801eb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eba:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801ebe:	48 85 c0             	test   %rax,%rax
+  801ec1:	74 15                	je     801ed8 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801ec3:	48 89 df             	mov    %rbx,%rdi
+  801ec6:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ec8:	85 c0                	test   %eax,%eax
+  801eca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecf:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ed2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed6:	c9                   	leave
+  801ed7:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ed8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801edd:	eb f3                	jmp    801ed2 <accept_snapshot+0x41>
+
+0000000000801edf <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801edf:	55                   	push   %rbp
+  801ee0:	48 89 e5             	mov    %rsp,%rbp
+  801ee3:	53                   	push   %rbx
+  801ee4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee8:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801eeb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eef:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ef4:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801efb:	00 00 00 
+  801efe:	ff d0                	call   *%rax
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	78 1c                	js     801f20 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801f04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f08:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801f0c:	48 85 c0             	test   %rax,%rax
+  801f0f:	74 15                	je     801f26 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801f11:	48 89 df             	mov    %rbx,%rdi
+  801f14:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f24:	c9                   	leave
+  801f25:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f26:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f2b:	eb f3                	jmp    801f20 <delete_snapshot+0x41>
+
+0000000000801f2d <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f35:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f39:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f3e:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 14                	js     801f62 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f52:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f56:	48 85 d2             	test   %rdx,%rdx
+  801f59:	74 09                	je     801f64 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f60:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f62:	c9                   	leave
+  801f63:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f64:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f69:	eb f7                	jmp    801f62 <gc_snapshots+0x35>
+
+0000000000801f6b <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f6b:	55                   	push   %rbp
+  801f6c:	48 89 e5             	mov    %rsp,%rbp
+  801f6f:	41 56                	push   %r14
+  801f71:	41 55                	push   %r13
+  801f73:	41 54                	push   %r12
+  801f75:	53                   	push   %rbx
+  801f76:	48 83 ec 10          	sub    $0x10,%rsp
+  801f7a:	48 89 fb             	mov    %rdi,%rbx
+  801f7d:	49 89 f4             	mov    %rsi,%r12
+  801f80:	49 89 d5             	mov    %rdx,%r13
+  801f83:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f86:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f8a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f8f:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801f96:	00 00 00 
+  801f99:	ff d0                	call   *%rax
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 1b                	js     801fba <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801f9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa3:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801fa7:	48 85 c0             	test   %rax,%rax
+  801faa:	74 1b                	je     801fc7 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801fac:	4c 89 f1             	mov    %r14,%rcx
+  801faf:	4c 89 ea             	mov    %r13,%rdx
+  801fb2:	4c 89 e6             	mov    %r12,%rsi
+  801fb5:	48 89 df             	mov    %rbx,%rdi
+  801fb8:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fba:	48 83 c4 10          	add    $0x10,%rsp
+  801fbe:	5b                   	pop    %rbx
+  801fbf:	41 5c                	pop    %r12
+  801fc1:	41 5d                	pop    %r13
+  801fc3:	41 5e                	pop    %r14
+  801fc5:	5d                   	pop    %rbp
+  801fc6:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fc7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fcc:	eb ec                	jmp    801fba <diff_snapshots+0x4f>
+
+0000000000801fce <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801fce:	55                   	push   %rbp
+  801fcf:	48 89 e5             	mov    %rsp,%rbp
+  801fd2:	41 55                	push   %r13
+  801fd4:	41 54                	push   %r12
+  801fd6:	53                   	push   %rbx
+  801fd7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fdb:	48 89 fb             	mov    %rdi,%rbx
+  801fde:	49 89 f4             	mov    %rsi,%r12
+  801fe1:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fe4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe8:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fed:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 18                	js     802015 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801ffd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802001:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802005:	48 85 c0             	test   %rax,%rax
+  802008:	74 16                	je     802020 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80200a:	4c 89 ea             	mov    %r13,%rdx
+  80200d:	4c 89 e6             	mov    %r12,%rsi
+  802010:	48 89 df             	mov    %rbx,%rdi
+  802013:	ff d0                	call   *%rax
+
+    return res;
+}
+  802015:	48 83 c4 18          	add    $0x18,%rsp
+  802019:	5b                   	pop    %rbx
+  80201a:	41 5c                	pop    %r12
+  80201c:	41 5d                	pop    %r13
+  80201e:	5d                   	pop    %rbp
+  80201f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802020:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802025:	eb ee                	jmp    802015 <send_snapshot+0x47>
+
+0000000000802027 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802027:	55                   	push   %rbp
+  802028:	48 89 e5             	mov    %rsp,%rbp
+  80202b:	53                   	push   %rbx
+  80202c:	48 83 ec 18          	sub    $0x18,%rsp
+  802030:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802033:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802037:	bf 66 00 00 00       	mov    $0x66,%edi
+  80203c:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	78 12                	js     80205e <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80204c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802050:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802054:	48 85 c0             	test   %rax,%rax
+  802057:	74 0b                	je     802064 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802059:	48 89 df             	mov    %rbx,%rdi
+  80205c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80205e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802062:	c9                   	leave
+  802063:	c3                   	ret
+        return -E_NOT_SUPP;
+  802064:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802069:	eb f3                	jmp    80205e <receive_snapshot+0x37>
+
+000000000080206b <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+  80206f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802073:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802077:	bf 66 00 00 00       	mov    $0x66,%edi
+  80207c:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	78 17                	js     8020a3 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80208c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802090:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802097:	48 85 d2             	test   %rdx,%rdx
+  80209a:	74 09                	je     8020a5 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80209c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a1:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020a5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020aa:	eb f7                	jmp    8020a3 <free_space_bytes+0x38>
+
+00000000008020ac <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8020ac:	55                   	push   %rbp
+  8020ad:	48 89 e5             	mov    %rsp,%rbp
+  8020b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020b8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020bd:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	78 17                	js     8020e4 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8020cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020d1:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8020d8:	48 85 d2             	test   %rdx,%rdx
+  8020db:	74 09                	je     8020e6 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8020dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020eb:	eb f7                	jmp    8020e4 <busy_space_bytes+0x38>
+
+00000000008020ed <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8020ed:	55                   	push   %rbp
+  8020ee:	48 89 e5             	mov    %rsp,%rbp
+  8020f1:	41 54                	push   %r12
+  8020f3:	53                   	push   %rbx
+  8020f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f8:	89 fb                	mov    %edi,%ebx
+  8020fa:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802101:	bf 66 00 00 00       	mov    $0x66,%edi
+  802106:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  80210d:	00 00 00 
+  802110:	ff d0                	call   *%rax
+  802112:	85 c0                	test   %eax,%eax
+  802114:	78 17                	js     80212d <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80211a:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802121:	48 85 c0             	test   %rax,%rax
+  802124:	74 10                	je     802136 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802126:	4c 89 e6             	mov    %r12,%rsi
+  802129:	89 df                	mov    %ebx,%edi
+  80212b:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80212d:	48 83 c4 10          	add    $0x10,%rsp
+  802131:	5b                   	pop    %rbx
+  802132:	41 5c                	pop    %r12
+  802134:	5d                   	pop    %rbp
+  802135:	c3                   	ret
+        return -E_NOT_SUPP;
+  802136:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80213b:	eb f0                	jmp    80212d <snapshots_space+0x40>
+
+000000000080213d <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80213d:	55                   	push   %rbp
+  80213e:	48 89 e5             	mov    %rsp,%rbp
+  802141:	41 55                	push   %r13
+  802143:	41 54                	push   %r12
+  802145:	53                   	push   %rbx
+  802146:	48 83 ec 08          	sub    $0x8,%rsp
+  80214a:	41 89 fd             	mov    %edi,%r13d
+  80214d:	48 89 f3             	mov    %rsi,%rbx
+  802150:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802153:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80215a:	00 00 00 
+  80215d:	83 38 00             	cmpl   $0x0,(%rax)
+  802160:	74 57                	je     8021b9 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802162:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802168:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80216d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802174:	00 00 00 
+  802177:	44 89 ee             	mov    %r13d,%esi
+  80217a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802181:	00 00 00 
+  802184:	8b 38                	mov    (%rax),%edi
+  802186:	48 b8 5d 36 80 00 00 	movabs $0x80365d,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802192:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802197:	4c 89 e2             	mov    %r12,%rdx
+  80219a:	48 89 de             	mov    %rbx,%rsi
+  80219d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021a2:	48 b8 45 36 80 00 00 	movabs $0x803645,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+}
+  8021ae:	48 83 c4 08          	add    $0x8,%rsp
+  8021b2:	5b                   	pop    %rbx
+  8021b3:	41 5c                	pop    %r12
+  8021b5:	41 5d                	pop    %r13
+  8021b7:	5d                   	pop    %rbp
+  8021b8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021be:	48 b8 1b 37 80 00 00 	movabs $0x80371b,%rax
+  8021c5:	00 00 00 
+  8021c8:	ff d0                	call   *%rax
+  8021ca:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021d1:	00 00 
+  8021d3:	eb 8d                	jmp    802162 <fsipc_region+0x25>
+
+00000000008021d5 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8021dd:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8021e4:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8021e5:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8021e9:	48 b8 3d 21 80 00 00 	movabs $0x80213d,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+}
+  8021f5:	c9                   	leave
+  8021f6:	c3                   	ret
+
+00000000008021f7 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8021f7:	85 ff                	test   %edi,%edi
+  8021f9:	78 6d                	js     802268 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8021fb:	55                   	push   %rbp
+  8021fc:	48 89 e5             	mov    %rsp,%rbp
+  8021ff:	41 54                	push   %r12
+  802201:	53                   	push   %rbx
+  802202:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802205:	48 85 f6             	test   %rsi,%rsi
+  802208:	74 57                	je     802261 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80220a:	89 f8                	mov    %edi,%eax
+  80220c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802213:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802215:	be 00 00 00 00       	mov    $0x0,%esi
+  80221a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80221f:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 2d                	js     80225c <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80222f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802236:	00 00 00 
+  802239:	49 63 14 24          	movslq (%r12),%rdx
+  80223d:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802244:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802249:	48 89 df             	mov    %rbx,%rdi
+  80224c:	48 b8 c8 0d 80 00 00 	movabs $0x800dc8,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802258:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80225c:	5b                   	pop    %rbx
+  80225d:	41 5c                	pop    %r12
+  80225f:	5d                   	pop    %rbp
+  802260:	c3                   	ret
+        return -E_INVAL;
+  802261:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802266:	eb f4                	jmp    80225c <devfile_df_snapshots+0x65>
+  802268:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80226d:	c3                   	ret
+
+000000000080226e <devfile_df_busy>:
+devfile_df_busy() {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802272:	be 00 00 00 00       	mov    $0x0,%esi
+  802277:	bf 11 00 00 00       	mov    $0x11,%edi
+  80227c:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+}
+  802288:	5d                   	pop    %rbp
+  802289:	c3                   	ret
+
+000000000080228a <devfile_df_free>:
+devfile_df_free() {
+  80228a:	55                   	push   %rbp
+  80228b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80228e:	be 00 00 00 00       	mov    $0x0,%esi
+  802293:	bf 10 00 00 00       	mov    $0x10,%edi
+  802298:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80229f:	00 00 00 
+  8022a2:	ff d0                	call   *%rax
+}
+  8022a4:	5d                   	pop    %rbp
+  8022a5:	c3                   	ret
+
+00000000008022a6 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8022aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8022af:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022b4:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8022bb:	00 00 00 
+  8022be:	ff d0                	call   *%rax
+}
+  8022c0:	5d                   	pop    %rbp
+  8022c1:	c3                   	ret
+
+00000000008022c2 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8022c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cb:	bf 09 00 00 00       	mov    $0x9,%edi
+  8022d0:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8022e6:	5d                   	pop    %rbp
+  8022e7:	c3                   	ret
+
+00000000008022e8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022e8:	55                   	push   %rbp
+  8022e9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022ec:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022f3:	00 00 00 
+  8022f6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022f9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022fb:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802303:	bf 02 00 00 00       	mov    $0x2,%edi
+  802308:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+}
+  802314:	5d                   	pop    %rbp
+  802315:	c3                   	ret
+
+0000000000802316 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802316:	55                   	push   %rbp
+  802317:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80231a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80231d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802324:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802326:	be 00 00 00 00       	mov    $0x0,%esi
+  80232b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802330:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802337:	00 00 00 
+  80233a:	ff d0                	call   *%rax
+}
+  80233c:	5d                   	pop    %rbp
+  80233d:	c3                   	ret
+
+000000000080233e <devfile_write>:
+    if (!fd || !buf) {
+  80233e:	48 85 ff             	test   %rdi,%rdi
+  802341:	0f 84 c1 00 00 00    	je     802408 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	41 57                	push   %r15
+  80234d:	41 56                	push   %r14
+  80234f:	41 55                	push   %r13
+  802351:	41 54                	push   %r12
+  802353:	53                   	push   %rbx
+  802354:	48 83 ec 18          	sub    $0x18,%rsp
+  802358:	49 89 ff             	mov    %rdi,%r15
+  80235b:	49 89 f5             	mov    %rsi,%r13
+  80235e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802361:	48 85 f6             	test   %rsi,%rsi
+  802364:	0f 84 95 00 00 00    	je     8023ff <devfile_write+0xc1>
+    while (n) {
+  80236a:	48 85 d2             	test   %rdx,%rdx
+  80236d:	0f 84 83 00 00 00    	je     8023f6 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802373:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80237a:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802381:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802384:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802389:	49 39 dc             	cmp    %rbx,%r12
+  80238c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802390:	48 89 da             	mov    %rbx,%rdx
+  802393:	4c 89 ee             	mov    %r13,%rsi
+  802396:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80239d:	00 00 00 
+  8023a0:	48 b8 c8 0d 80 00 00 	movabs $0x800dc8,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023ac:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8023b0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8023b3:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8023b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023bc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023c1:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8023c8:	00 00 00 
+  8023cb:	ff d0                	call   *%rax
+        if (write < 0) {
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	78 21                	js     8023f2 <devfile_write+0xb4>
+        buf += write;
+  8023d1:	48 63 d0             	movslq %eax,%rdx
+  8023d4:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8023d7:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8023da:	49 29 d4             	sub    %rdx,%r12
+  8023dd:	75 a5                	jne    802384 <devfile_write+0x46>
+    return totalWrite;
+  8023df:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8023e3:	48 83 c4 18          	add    $0x18,%rsp
+  8023e7:	5b                   	pop    %rbx
+  8023e8:	41 5c                	pop    %r12
+  8023ea:	41 5d                	pop    %r13
+  8023ec:	41 5e                	pop    %r14
+  8023ee:	41 5f                	pop    %r15
+  8023f0:	5d                   	pop    %rbp
+  8023f1:	c3                   	ret
+            return write;
+  8023f2:	48 98                	cltq
+  8023f4:	eb ed                	jmp    8023e3 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8023f6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8023fd:	eb e0                	jmp    8023df <devfile_write+0xa1>
+        return -E_INVAL;
+  8023ff:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802406:	eb db                	jmp    8023e3 <devfile_write+0xa5>
+  802408:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80240f:	c3                   	ret
+
+0000000000802410 <devfile_read>:
+    if (!fd || !buf) {
+  802410:	48 85 ff             	test   %rdi,%rdi
+  802413:	0f 84 c0 00 00 00    	je     8024d9 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  80241d:	41 57                	push   %r15
+  80241f:	41 56                	push   %r14
+  802421:	41 55                	push   %r13
+  802423:	41 54                	push   %r12
+  802425:	53                   	push   %rbx
+  802426:	48 83 ec 18          	sub    $0x18,%rsp
+  80242a:	49 89 ff             	mov    %rdi,%r15
+  80242d:	49 89 f5             	mov    %rsi,%r13
+  802430:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802433:	48 85 f6             	test   %rsi,%rsi
+  802436:	0f 84 96 00 00 00    	je     8024d2 <devfile_read+0xc2>
+    while (n) {
+  80243c:	48 85 d2             	test   %rdx,%rdx
+  80243f:	0f 84 87 00 00 00    	je     8024cc <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802445:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80244c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80244d:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802454:	00 00 00 
+  802457:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80245b:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80245e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802463:	49 39 c4             	cmp    %rax,%r12
+  802466:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80246a:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80246e:	be 00 00 00 00       	mov    $0x0,%esi
+  802473:	bf 03 00 00 00       	mov    $0x3,%edi
+  802478:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802484:	85 c0                	test   %eax,%eax
+  802486:	7e 37                	jle    8024bf <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802488:	48 63 d8             	movslq %eax,%rbx
+  80248b:	48 89 da             	mov    %rbx,%rdx
+  80248e:	4c 89 f6             	mov    %r14,%rsi
+  802491:	4c 89 ef             	mov    %r13,%rdi
+  802494:	48 b8 c8 0d 80 00 00 	movabs $0x800dc8,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+        buf += read;
+  8024a0:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8024a3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8024a7:	49 29 dc             	sub    %rbx,%r12
+  8024aa:	75 ab                	jne    802457 <devfile_read+0x47>
+  return totalRead;
+  8024ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024b0:	48 83 c4 18          	add    $0x18,%rsp
+  8024b4:	5b                   	pop    %rbx
+  8024b5:	41 5c                	pop    %r12
+  8024b7:	41 5d                	pop    %r13
+  8024b9:	41 5e                	pop    %r14
+  8024bb:	41 5f                	pop    %r15
+  8024bd:	5d                   	pop    %rbp
+  8024be:	c3                   	ret
+            return read ? read : totalRead;
+  8024bf:	48 63 d0             	movslq %eax,%rdx
+  8024c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024c6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8024ca:	eb e4                	jmp    8024b0 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8024cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8024d0:	eb da                	jmp    8024ac <devfile_read+0x9c>
+        return E_INVAL;
+  8024d2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024d7:	eb d7                	jmp    8024b0 <devfile_read+0xa0>
+  8024d9:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8024de:	c3                   	ret
+
+00000000008024df <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024df:	48 85 ff             	test   %rdi,%rdi
+  8024e2:	74 5f                	je     802543 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+  8024e8:	53                   	push   %rbx
+  8024e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ed:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024f0:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+  8024fc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802502:	77 45                	ja     802549 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802504:	48 89 de             	mov    %rbx,%rsi
+  802507:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80250e:	00 00 00 
+  802511:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80251d:	be 00 00 00 00       	mov    $0x0,%esi
+  802522:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802527:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802533:	85 c0                	test   %eax,%eax
+  802535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80253d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802541:	c9                   	leave
+  802542:	c3                   	ret
+        return -E_INVAL;
+  802543:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802548:	c3                   	ret
+        return -E_INVAL;
+  802549:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254e:	eb ed                	jmp    80253d <devfile_receive_snapshot+0x5e>
+
+0000000000802550 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802550:	55                   	push   %rbp
+  802551:	48 89 e5             	mov    %rsp,%rbp
+  802554:	41 55                	push   %r13
+  802556:	41 54                	push   %r12
+  802558:	53                   	push   %rbx
+  802559:	48 83 ec 08          	sub    $0x8,%rsp
+  80255d:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802560:	48 85 f6             	test   %rsi,%rsi
+  802563:	0f 94 c0             	sete   %al
+  802566:	48 85 d2             	test   %rdx,%rdx
+  802569:	0f 94 c2             	sete   %dl
+  80256c:	08 d0                	or     %dl,%al
+  80256e:	0f 85 ad 00 00 00    	jne    802621 <devfile_send_snapshot+0xd1>
+  802574:	48 89 fb             	mov    %rdi,%rbx
+  802577:	49 89 f4             	mov    %rsi,%r12
+  80257a:	48 85 ff             	test   %rdi,%rdi
+  80257d:	0f 84 9e 00 00 00    	je     802621 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802583:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+  80258f:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802595:	0f 87 8d 00 00 00    	ja     802628 <devfile_send_snapshot+0xd8>
+  80259b:	4c 89 e7             	mov    %r12,%rdi
+  80259e:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8025a5:	00 00 00 
+  8025a8:	ff d0                	call   *%rax
+  8025aa:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025b0:	77 7d                	ja     80262f <devfile_send_snapshot+0xdf>
+  8025b2:	4c 89 ef             	mov    %r13,%rdi
+  8025b5:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8025bc:	00 00 00 
+  8025bf:	ff d0                	call   *%rax
+  8025c1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025c7:	77 6d                	ja     802636 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8025c9:	48 89 de             	mov    %rbx,%rsi
+  8025cc:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8025d3:	00 00 00 
+  8025d6:	48 bb ce 0b 80 00 00 	movabs $0x800bce,%rbx
+  8025dd:	00 00 00 
+  8025e0:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8025e2:	4c 89 e6             	mov    %r12,%rsi
+  8025e5:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8025ec:	00 00 00 
+  8025ef:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8025f1:	4c 89 ee             	mov    %r13,%rsi
+  8025f4:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8025fb:	00 00 00 
+  8025fe:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802600:	be 00 00 00 00       	mov    $0x0,%esi
+  802605:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80260a:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802611:	00 00 00 
+  802614:	ff d0                	call   *%rax
+}
+  802616:	48 83 c4 08          	add    $0x8,%rsp
+  80261a:	5b                   	pop    %rbx
+  80261b:	41 5c                	pop    %r12
+  80261d:	41 5d                	pop    %r13
+  80261f:	5d                   	pop    %rbp
+  802620:	c3                   	ret
+        return -E_INVAL;
+  802621:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802626:	eb ee                	jmp    802616 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802628:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80262d:	eb e7                	jmp    802616 <devfile_send_snapshot+0xc6>
+  80262f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802634:	eb e0                	jmp    802616 <devfile_send_snapshot+0xc6>
+  802636:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80263b:	eb d9                	jmp    802616 <devfile_send_snapshot+0xc6>
+
+000000000080263d <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80263d:	48 85 ff             	test   %rdi,%rdi
+  802640:	0f 84 41 01 00 00    	je     802787 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802646:	55                   	push   %rbp
+  802647:	48 89 e5             	mov    %rsp,%rbp
+  80264a:	41 57                	push   %r15
+  80264c:	41 56                	push   %r14
+  80264e:	41 55                	push   %r13
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+  802653:	48 83 ec 08          	sub    $0x8,%rsp
+  802657:	49 89 fc             	mov    %rdi,%r12
+  80265a:	49 89 f5             	mov    %rsi,%r13
+  80265d:	48 89 d3             	mov    %rdx,%rbx
+  802660:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802663:	48 85 f6             	test   %rsi,%rsi
+  802666:	0f 84 ff 00 00 00    	je     80276b <devfile_diff_snapshots+0x12e>
+  80266c:	48 85 d2             	test   %rdx,%rdx
+  80266f:	0f 84 fd 00 00 00    	je     802772 <devfile_diff_snapshots+0x135>
+  802675:	48 85 c9             	test   %rcx,%rcx
+  802678:	0f 84 f4 00 00 00    	je     802772 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80267e:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802690:	0f 87 e3 00 00 00    	ja     802779 <devfile_diff_snapshots+0x13c>
+  802696:	4c 89 ef             	mov    %r13,%rdi
+  802699:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026ab:	0f 87 cf 00 00 00    	ja     802780 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8026b1:	4c 89 e6             	mov    %r12,%rsi
+  8026b4:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8026bb:	00 00 00 
+  8026be:	4c 89 e7             	mov    %r12,%rdi
+  8026c1:	49 bf ce 0b 80 00 00 	movabs $0x800bce,%r15
+  8026c8:	00 00 00 
+  8026cb:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8026ce:	4c 89 ee             	mov    %r13,%rsi
+  8026d1:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8026d8:	00 
+  8026d9:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8026dc:	48 8b 03             	mov    (%rbx),%rax
+  8026df:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8026e6:	00 
+  8026e7:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8026eb:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8026f2:	00 
+  8026f3:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8026f7:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8026fe:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8026ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802704:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802709:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802715:	85 c0                	test   %eax,%eax
+  802717:	78 43                	js     80275c <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802719:	49 8b 04 24          	mov    (%r12),%rax
+  80271d:	48 89 03             	mov    %rax,(%rbx)
+  802720:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802725:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802729:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80272e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802732:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802737:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80273b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80273f:	48 c1 e2 03          	shl    $0x3,%rdx
+  802743:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802748:	4c 89 f7             	mov    %r14,%rdi
+  80274b:	48 b8 c8 0d 80 00 00 	movabs $0x800dc8,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802757:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80275c:	48 83 c4 08          	add    $0x8,%rsp
+  802760:	5b                   	pop    %rbx
+  802761:	41 5c                	pop    %r12
+  802763:	41 5d                	pop    %r13
+  802765:	41 5e                	pop    %r14
+  802767:	41 5f                	pop    %r15
+  802769:	5d                   	pop    %rbp
+  80276a:	c3                   	ret
+        return -E_INVAL;
+  80276b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802770:	eb ea                	jmp    80275c <devfile_diff_snapshots+0x11f>
+  802772:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802777:	eb e3                	jmp    80275c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802779:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80277e:	eb dc                	jmp    80275c <devfile_diff_snapshots+0x11f>
+  802780:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802785:	eb d5                	jmp    80275c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802787:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80278c:	c3                   	ret
+
+000000000080278d <devfile_delete_snapshot>:
+    if (!name) {
+  80278d:	48 85 ff             	test   %rdi,%rdi
+  802790:	74 5f                	je     8027f1 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  802796:	53                   	push   %rbx
+  802797:	48 83 ec 08          	sub    $0x8,%rsp
+  80279b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80279e:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8027a5:	00 00 00 
+  8027a8:	ff d0                	call   *%rax
+  8027aa:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027b0:	77 45                	ja     8027f7 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8027b2:	48 89 de             	mov    %rbx,%rsi
+  8027b5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027bc:	00 00 00 
+  8027bf:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  8027c6:	00 00 00 
+  8027c9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8027cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027d5:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8027dc:	00 00 00 
+  8027df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027e1:	85 c0                	test   %eax,%eax
+  8027e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ef:	c9                   	leave
+  8027f0:	c3                   	ret
+        return -E_INVAL;
+  8027f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027f6:	c3                   	ret
+        return -E_INVAL;
+  8027f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027fc:	eb ed                	jmp    8027eb <devfile_delete_snapshot+0x5e>
+
+00000000008027fe <devfile_accept_snapshot>:
+    if (!name) {
+  8027fe:	48 85 ff             	test   %rdi,%rdi
+  802801:	74 5f                	je     802862 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+  802807:	53                   	push   %rbx
+  802808:	48 83 ec 08          	sub    $0x8,%rsp
+  80280c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80280f:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802821:	77 45                	ja     802868 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802823:	48 89 de             	mov    %rbx,%rsi
+  802826:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80282d:	00 00 00 
+  802830:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  802837:	00 00 00 
+  80283a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80283c:	be 00 00 00 00       	mov    $0x0,%esi
+  802841:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802846:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802852:	85 c0                	test   %eax,%eax
+  802854:	ba 00 00 00 00       	mov    $0x0,%edx
+  802859:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80285c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802860:	c9                   	leave
+  802861:	c3                   	ret
+        return -E_INVAL;
+  802862:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802867:	c3                   	ret
+        return -E_INVAL;
+  802868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80286d:	eb ed                	jmp    80285c <devfile_accept_snapshot+0x5e>
+
+000000000080286f <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80286f:	48 85 ff             	test   %rdi,%rdi
+  802872:	0f 84 9f 00 00 00    	je     802917 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802878:	55                   	push   %rbp
+  802879:	48 89 e5             	mov    %rsp,%rbp
+  80287c:	41 54                	push   %r12
+  80287e:	53                   	push   %rbx
+  80287f:	48 89 fb             	mov    %rdi,%rbx
+  802882:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802885:	48 85 f6             	test   %rsi,%rsi
+  802888:	74 78                	je     802902 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  80288a:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+  802896:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80289c:	77 6b                	ja     802909 <devfile_create_snapshot+0x9a>
+  80289e:	4c 89 e7             	mov    %r12,%rdi
+  8028a1:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  8028a8:	00 00 00 
+  8028ab:	ff d0                	call   *%rax
+  8028ad:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028b3:	77 5b                	ja     802910 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8028b5:	48 89 de             	mov    %rbx,%rsi
+  8028b8:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8028bf:	00 00 00 
+  8028c2:	48 bb ce 0b 80 00 00 	movabs $0x800bce,%rbx
+  8028c9:	00 00 00 
+  8028cc:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8028ce:	4c 89 e6             	mov    %r12,%rsi
+  8028d1:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8028d8:	00 00 00 
+  8028db:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8028dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028e7:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fa:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028fd:	5b                   	pop    %rbx
+  8028fe:	41 5c                	pop    %r12
+  802900:	5d                   	pop    %rbp
+  802901:	c3                   	ret
+        return -E_INVAL;
+  802902:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802907:	eb f4                	jmp    8028fd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802909:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80290e:	eb ed                	jmp    8028fd <devfile_create_snapshot+0x8e>
+  802910:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802915:	eb e6                	jmp    8028fd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802917:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80291c:	c3                   	ret
+
+000000000080291d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80291d:	55                   	push   %rbp
+  80291e:	48 89 e5             	mov    %rsp,%rbp
+  802921:	41 54                	push   %r12
+  802923:	53                   	push   %rbx
+  802924:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802927:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80292a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802931:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802933:	be 00 00 00 00       	mov    $0x0,%esi
+  802938:	bf 05 00 00 00       	mov    $0x5,%edi
+  80293d:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802944:	00 00 00 
+  802947:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802949:	85 c0                	test   %eax,%eax
+  80294b:	78 3d                	js     80298a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80294d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802954:	00 00 00 
+  802957:	4c 89 e6             	mov    %r12,%rsi
+  80295a:	48 89 df             	mov    %rbx,%rdi
+  80295d:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802969:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802970:	00 
+  802971:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802977:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80297e:	00 
+  80297f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298a:	5b                   	pop    %rbx
+  80298b:	41 5c                	pop    %r12
+  80298d:	5d                   	pop    %rbp
+  80298e:	c3                   	ret
+
+000000000080298f <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	41 57                	push   %r15
+  802995:	41 56                	push   %r14
+  802997:	41 55                	push   %r13
+  802999:	41 54                	push   %r12
+  80299b:	53                   	push   %rbx
+  80299c:	48 83 ec 38          	sub    $0x38,%rsp
+  8029a0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8029a4:	49 89 f5             	mov    %rsi,%r13
+  8029a7:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029aa:	48 89 f0             	mov    %rsi,%rax
+  8029ad:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8029b2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8029b6:	75 4f                	jne    802a07 <devfile_readmap+0x78>
+  8029b8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029bc:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8029c2:	75 1f                	jne    8029e3 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8029c4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029c8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029cc:	49 be 77 31 80 00 00 	movabs $0x803177,%r14
+  8029d3:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029d6:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8029dd:	0f 87 9d 00 00 00    	ja     802a80 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8029e3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029e7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8029eb:	4d 85 ff             	test   %r15,%r15
+  8029ee:	0f 85 cf 00 00 00    	jne    802ac3 <devfile_readmap+0x134>
+  8029f4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8029f8:	48 83 c4 38          	add    $0x38,%rsp
+  8029fc:	5b                   	pop    %rbx
+  8029fd:	41 5c                	pop    %r12
+  8029ff:	41 5d                	pop    %r13
+  802a01:	41 5e                	pop    %r14
+  802a03:	41 5f                	pop    %r15
+  802a05:	5d                   	pop    %rbp
+  802a06:	c3                   	ret
+    size_t totalRead = 0;
+  802a07:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802a0e:	00 
+  802a0f:	eb da                	jmp    8029eb <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a11:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a15:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a18:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802a1f:	00 00 00 
+  802a22:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802a24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a28:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802a2c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a30:	4c 89 ee             	mov    %r13,%rsi
+  802a33:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a38:	48 b8 3d 21 80 00 00 	movabs $0x80213d,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	7e a3                	jle    8029eb <devfile_readmap+0x5c>
+  802a48:	48 98                	cltq
+  802a4a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a4e:	72 9b                	jb     8029eb <devfile_readmap+0x5c>
+        buf += read;
+  802a50:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a53:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a56:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a5a:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a61:	75 88                	jne    8029eb <devfile_readmap+0x5c>
+  802a63:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a67:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a6d:	0f 85 78 ff ff ff    	jne    8029eb <devfile_readmap+0x5c>
+  802a73:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a7a:	0f 86 6b ff ff ff    	jbe    8029eb <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802a80:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802a86:	4d 39 e7             	cmp    %r12,%r15
+  802a89:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802a8d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802a94:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a98:	0f 84 73 ff ff ff    	je     802a11 <devfile_readmap+0x82>
+  802a9e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802aa2:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802aa7:	41 ff d6             	call   *%r14
+  802aaa:	a8 40                	test   $0x40,%al
+  802aac:	0f 85 39 ff ff ff    	jne    8029eb <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ab2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ab9:	4c 39 e3             	cmp    %r12,%rbx
+  802abc:	72 e4                	jb     802aa2 <devfile_readmap+0x113>
+  802abe:	e9 4e ff ff ff       	jmp    802a11 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ac3:	4c 89 fa             	mov    %r15,%rdx
+  802ac6:	4c 89 ee             	mov    %r13,%rsi
+  802ac9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802acd:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  802ad4:	00 00 00 
+  802ad7:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802ad9:	48 85 c0             	test   %rax,%rax
+  802adc:	78 0c                	js     802aea <devfile_readmap+0x15b>
+    return totalRead + read;
+  802ade:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ae2:	48 01 f0             	add    %rsi,%rax
+  802ae5:	e9 0e ff ff ff       	jmp    8029f8 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802aea:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aee:	48 85 f6             	test   %rsi,%rsi
+  802af1:	48 0f 45 c6          	cmovne %rsi,%rax
+  802af5:	e9 fe fe ff ff       	jmp    8029f8 <devfile_readmap+0x69>
+
+0000000000802afa <open>:
+open(const char *path, int mode) {
+  802afa:	55                   	push   %rbp
+  802afb:	48 89 e5             	mov    %rsp,%rbp
+  802afe:	41 55                	push   %r13
+  802b00:	41 54                	push   %r12
+  802b02:	53                   	push   %rbx
+  802b03:	48 83 ec 18          	sub    $0x18,%rsp
+  802b07:	49 89 fc             	mov    %rdi,%r12
+  802b0a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b0d:	48 b8 90 0b 80 00 00 	movabs $0x800b90,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  802b19:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b1f:	0f 87 8a 00 00 00    	ja     802baf <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b25:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b29:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  802b30:	00 00 00 
+  802b33:	ff d0                	call   *%rax
+  802b35:	89 c3                	mov    %eax,%ebx
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	78 50                	js     802b8b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b3b:	4c 89 e6             	mov    %r12,%rsi
+  802b3e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802b45:	00 00 00 
+  802b48:	48 89 df             	mov    %rbx,%rdi
+  802b4b:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  802b52:	00 00 00 
+  802b55:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b57:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b5e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b62:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b67:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802b6e:	00 00 00 
+  802b71:	ff d0                	call   *%rax
+  802b73:	89 c3                	mov    %eax,%ebx
+  802b75:	85 c0                	test   %eax,%eax
+  802b77:	78 1f                	js     802b98 <open+0x9e>
+    return fd2num(fd);
+  802b79:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b7d:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+  802b89:	89 c3                	mov    %eax,%ebx
+}
+  802b8b:	89 d8                	mov    %ebx,%eax
+  802b8d:	48 83 c4 18          	add    $0x18,%rsp
+  802b91:	5b                   	pop    %rbx
+  802b92:	41 5c                	pop    %r12
+  802b94:	41 5d                	pop    %r13
+  802b96:	5d                   	pop    %rbp
+  802b97:	c3                   	ret
+        fd_close(fd, 0);
+  802b98:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ba1:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+        return res;
+  802bad:	eb dc                	jmp    802b8b <open+0x91>
+        return -E_BAD_PATH;
+  802baf:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bb4:	eb d5                	jmp    802b8b <open+0x91>
+
+0000000000802bb6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802bb6:	55                   	push   %rbp
+  802bb7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802bba:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbf:	bf 13 00 00 00       	mov    $0x13,%edi
+  802bc4:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+}
+  802bd0:	5d                   	pop    %rbp
+  802bd1:	c3                   	ret
+
+0000000000802bd2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802bd2:	55                   	push   %rbp
+  802bd3:	48 89 e5             	mov    %rsp,%rbp
+  802bd6:	41 54                	push   %r12
+  802bd8:	53                   	push   %rbx
+  802bd9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bdc:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+  802be8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802beb:	48 be 40 3e 80 00 00 	movabs $0x803e40,%rsi
+  802bf2:	00 00 00 
+  802bf5:	48 89 df             	mov    %rbx,%rdi
+  802bf8:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  802bff:	00 00 00 
+  802c02:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802c04:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c09:	41 2b 04 24          	sub    (%r12),%eax
+  802c0d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802c13:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802c1a:	00 00 00 
+    stat->st_dev = &devpipe;
+  802c1d:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802c24:	00 00 00 
+  802c27:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c33:	5b                   	pop    %rbx
+  802c34:	41 5c                	pop    %r12
+  802c36:	5d                   	pop    %rbp
+  802c37:	c3                   	ret
+
+0000000000802c38 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802c38:	55                   	push   %rbp
+  802c39:	48 89 e5             	mov    %rsp,%rbp
+  802c3c:	41 54                	push   %r12
+  802c3e:	53                   	push   %rbx
+  802c3f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c47:	48 89 fe             	mov    %rdi,%rsi
+  802c4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4f:	49 bc 26 13 80 00 00 	movabs $0x801326,%r12
+  802c56:	00 00 00 
+  802c59:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c5c:	48 89 df             	mov    %rbx,%rdi
+  802c5f:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802c66:	00 00 00 
+  802c69:	ff d0                	call   *%rax
+  802c6b:	48 89 c6             	mov    %rax,%rsi
+  802c6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c78:	41 ff d4             	call   *%r12
+}
+  802c7b:	5b                   	pop    %rbx
+  802c7c:	41 5c                	pop    %r12
+  802c7e:	5d                   	pop    %rbp
+  802c7f:	c3                   	ret
+
+0000000000802c80 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c80:	55                   	push   %rbp
+  802c81:	48 89 e5             	mov    %rsp,%rbp
+  802c84:	41 57                	push   %r15
+  802c86:	41 56                	push   %r14
+  802c88:	41 55                	push   %r13
+  802c8a:	41 54                	push   %r12
+  802c8c:	53                   	push   %rbx
+  802c8d:	48 83 ec 18          	sub    $0x18,%rsp
+  802c91:	49 89 fc             	mov    %rdi,%r12
+  802c94:	49 89 f5             	mov    %rsi,%r13
+  802c97:	49 89 d7             	mov    %rdx,%r15
+  802c9a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c9e:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802caa:	4d 85 ff             	test   %r15,%r15
+  802cad:	0f 84 af 00 00 00    	je     802d62 <devpipe_write+0xe2>
+  802cb3:	48 89 c3             	mov    %rax,%rbx
+  802cb6:	4c 89 f8             	mov    %r15,%rax
+  802cb9:	4d 89 ef             	mov    %r13,%r15
+  802cbc:	4c 01 e8             	add    %r13,%rax
+  802cbf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cc3:	49 bd 2e 12 80 00 00 	movabs $0x80122e,%r13
+  802cca:	00 00 00 
+            sys_yield();
+  802ccd:	49 be cb 11 80 00 00 	movabs $0x8011cb,%r14
+  802cd4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cd7:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cda:	48 63 ce             	movslq %esi,%rcx
+  802cdd:	48 63 03             	movslq (%rbx),%rax
+  802ce0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ce6:	48 39 c1             	cmp    %rax,%rcx
+  802ce9:	72 2e                	jb     802d19 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ceb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cf0:	48 89 da             	mov    %rbx,%rdx
+  802cf3:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cf8:	4c 89 e7             	mov    %r12,%rdi
+  802cfb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	74 66                	je     802d68 <devpipe_write+0xe8>
+            sys_yield();
+  802d02:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802d05:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d08:	48 63 ce             	movslq %esi,%rcx
+  802d0b:	48 63 03             	movslq (%rbx),%rax
+  802d0e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802d14:	48 39 c1             	cmp    %rax,%rcx
+  802d17:	73 d2                	jae    802ceb <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d19:	41 0f b6 3f          	movzbl (%r15),%edi
+  802d1d:	48 89 ca             	mov    %rcx,%rdx
+  802d20:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d24:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802d2b:	08 10 20 
+  802d2e:	48 f7 e2             	mul    %rdx
+  802d31:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d35:	48 89 d0             	mov    %rdx,%rax
+  802d38:	48 c1 e0 09          	shl    $0x9,%rax
+  802d3c:	48 29 d0             	sub    %rdx,%rax
+  802d3f:	48 c1 e0 03          	shl    $0x3,%rax
+  802d43:	48 29 c1             	sub    %rax,%rcx
+  802d46:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802d4b:	83 c6 01             	add    $0x1,%esi
+  802d4e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d51:	49 83 c7 01          	add    $0x1,%r15
+  802d55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d59:	49 39 c7             	cmp    %rax,%r15
+  802d5c:	0f 85 75 ff ff ff    	jne    802cd7 <devpipe_write+0x57>
+    return n;
+  802d62:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d66:	eb 05                	jmp    802d6d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d6d:	48 83 c4 18          	add    $0x18,%rsp
+  802d71:	5b                   	pop    %rbx
+  802d72:	41 5c                	pop    %r12
+  802d74:	41 5d                	pop    %r13
+  802d76:	41 5e                	pop    %r14
+  802d78:	41 5f                	pop    %r15
+  802d7a:	5d                   	pop    %rbp
+  802d7b:	c3                   	ret
+
+0000000000802d7c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d7c:	55                   	push   %rbp
+  802d7d:	48 89 e5             	mov    %rsp,%rbp
+  802d80:	41 57                	push   %r15
+  802d82:	41 56                	push   %r14
+  802d84:	41 55                	push   %r13
+  802d86:	41 54                	push   %r12
+  802d88:	53                   	push   %rbx
+  802d89:	48 83 ec 18          	sub    $0x18,%rsp
+  802d8d:	49 89 fc             	mov    %rdi,%r12
+  802d90:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d94:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d98:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+  802da4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802da7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dad:	49 bd 2e 12 80 00 00 	movabs $0x80122e,%r13
+  802db4:	00 00 00 
+            sys_yield();
+  802db7:	49 be cb 11 80 00 00 	movabs $0x8011cb,%r14
+  802dbe:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802dc1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dc6:	74 7d                	je     802e45 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dc8:	8b 03                	mov    (%rbx),%eax
+  802dca:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802dcd:	75 26                	jne    802df5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802dcf:	4d 85 ff             	test   %r15,%r15
+  802dd2:	75 77                	jne    802e4b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dd4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802dd9:	48 89 da             	mov    %rbx,%rdx
+  802ddc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802de1:	4c 89 e7             	mov    %r12,%rdi
+  802de4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802de7:	85 c0                	test   %eax,%eax
+  802de9:	74 72                	je     802e5d <devpipe_read+0xe1>
+            sys_yield();
+  802deb:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dee:	8b 03                	mov    (%rbx),%eax
+  802df0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802df3:	74 df                	je     802dd4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802df5:	48 63 c8             	movslq %eax,%rcx
+  802df8:	48 89 ca             	mov    %rcx,%rdx
+  802dfb:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dff:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802e06:	08 10 20 
+  802e09:	48 89 d0             	mov    %rdx,%rax
+  802e0c:	48 f7 e6             	mul    %rsi
+  802e0f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e13:	48 89 d0             	mov    %rdx,%rax
+  802e16:	48 c1 e0 09          	shl    $0x9,%rax
+  802e1a:	48 29 d0             	sub    %rdx,%rax
+  802e1d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802e24:	00 
+  802e25:	48 89 c8             	mov    %rcx,%rax
+  802e28:	48 29 d0             	sub    %rdx,%rax
+  802e2b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802e30:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e34:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802e38:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e3b:	49 83 c7 01          	add    $0x1,%r15
+  802e3f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802e43:	75 83                	jne    802dc8 <devpipe_read+0x4c>
+    return n;
+  802e45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e49:	eb 03                	jmp    802e4e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802e4b:	4c 89 f8             	mov    %r15,%rax
+}
+  802e4e:	48 83 c4 18          	add    $0x18,%rsp
+  802e52:	5b                   	pop    %rbx
+  802e53:	41 5c                	pop    %r12
+  802e55:	41 5d                	pop    %r13
+  802e57:	41 5e                	pop    %r14
+  802e59:	41 5f                	pop    %r15
+  802e5b:	5d                   	pop    %rbp
+  802e5c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e62:	eb ea                	jmp    802e4e <devpipe_read+0xd2>
+
+0000000000802e64 <pipe>:
+pipe(int pfd[2]) {
+  802e64:	55                   	push   %rbp
+  802e65:	48 89 e5             	mov    %rsp,%rbp
+  802e68:	41 55                	push   %r13
+  802e6a:	41 54                	push   %r12
+  802e6c:	53                   	push   %rbx
+  802e6d:	48 83 ec 18          	sub    $0x18,%rsp
+  802e71:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e74:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e78:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  802e7f:	00 00 00 
+  802e82:	ff d0                	call   *%rax
+  802e84:	89 c3                	mov    %eax,%ebx
+  802e86:	85 c0                	test   %eax,%eax
+  802e88:	0f 88 a0 01 00 00    	js     80302e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e8e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e98:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea1:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802ea8:	00 00 00 
+  802eab:	ff d0                	call   *%rax
+  802ead:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802eaf:	85 c0                	test   %eax,%eax
+  802eb1:	0f 88 77 01 00 00    	js     80302e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802eb7:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ebb:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  802ec2:	00 00 00 
+  802ec5:	ff d0                	call   *%rax
+  802ec7:	89 c3                	mov    %eax,%ebx
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 88 43 01 00 00    	js     803014 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802ed1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ed6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802edf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee4:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ef2:	85 c0                	test   %eax,%eax
+  802ef4:	0f 88 1a 01 00 00    	js     803014 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802efa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802efe:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802f05:	00 00 00 
+  802f08:	ff d0                	call   *%rax
+  802f0a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802f0d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f17:	48 89 c6             	mov    %rax,%rsi
+  802f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1f:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+  802f2b:	89 c3                	mov    %eax,%ebx
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	0f 88 c5 00 00 00    	js     802ffa <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802f35:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f39:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+  802f45:	48 89 c1             	mov    %rax,%rcx
+  802f48:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802f4e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f59:	4c 89 ee             	mov    %r13,%rsi
+  802f5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f61:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  802f68:	00 00 00 
+  802f6b:	ff d0                	call   *%rax
+  802f6d:	89 c3                	mov    %eax,%ebx
+  802f6f:	85 c0                	test   %eax,%eax
+  802f71:	78 6e                	js     802fe1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f73:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f78:	4c 89 ef             	mov    %r13,%rdi
+  802f7b:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+  802f87:	83 f8 02             	cmp    $0x2,%eax
+  802f8a:	0f 85 ab 00 00 00    	jne    80303b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f90:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802f97:	00 00 
+  802f99:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f9d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f9f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fa3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802faa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fae:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802fb0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fb4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802fbb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fbf:	48 bb 2a 16 80 00 00 	movabs $0x80162a,%rbx
+  802fc6:	00 00 00 
+  802fc9:	ff d3                	call   *%rbx
+  802fcb:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802fcf:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802fd3:	ff d3                	call   *%rbx
+  802fd5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fdf:	eb 4d                	jmp    80302e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802fe1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe6:	4c 89 ee             	mov    %r13,%rsi
+  802fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fee:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  802ff5:	00 00 00 
+  802ff8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802ffa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fff:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803003:	bf 00 00 00 00       	mov    $0x0,%edi
+  803008:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  80300f:	00 00 00 
+  803012:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803014:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803019:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80301d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803022:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+}
+  80302e:	89 d8                	mov    %ebx,%eax
+  803030:	48 83 c4 18          	add    $0x18,%rsp
+  803034:	5b                   	pop    %rbx
+  803035:	41 5c                	pop    %r12
+  803037:	41 5d                	pop    %r13
+  803039:	5d                   	pop    %rbp
+  80303a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80303b:	48 b9 70 3e 80 00 00 	movabs $0x803e70,%rcx
+  803042:	00 00 00 
+  803045:	48 ba 47 3e 80 00 00 	movabs $0x803e47,%rdx
+  80304c:	00 00 00 
+  80304f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803054:	48 bf 5c 3e 80 00 00 	movabs $0x803e5c,%rdi
+  80305b:	00 00 00 
+  80305e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803063:	49 b8 bb 34 80 00 00 	movabs $0x8034bb,%r8
+  80306a:	00 00 00 
+  80306d:	41 ff d0             	call   *%r8
+
+0000000000803070 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803070:	55                   	push   %rbp
+  803071:	48 89 e5             	mov    %rsp,%rbp
+  803074:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803078:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80307c:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803083:	00 00 00 
+  803086:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803088:	85 c0                	test   %eax,%eax
+  80308a:	78 35                	js     8030c1 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80308c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803090:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  803097:	00 00 00 
+  80309a:	ff d0                	call   *%rax
+  80309c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80309f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030a9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8030ad:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	0f 94 c0             	sete   %al
+  8030be:	0f b6 c0             	movzbl %al,%eax
+}
+  8030c1:	c9                   	leave
+  8030c2:	c3                   	ret
+
+00000000008030c3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8030c3:	48 89 f8             	mov    %rdi,%rax
+  8030c6:	48 c1 e8 27          	shr    $0x27,%rax
+  8030ca:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8030d1:	01 00 00 
+  8030d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030d8:	f6 c2 01             	test   $0x1,%dl
+  8030db:	74 6d                	je     80314a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8030dd:	48 89 f8             	mov    %rdi,%rax
+  8030e0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030e4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030eb:	01 00 00 
+  8030ee:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030f2:	f6 c2 01             	test   $0x1,%dl
+  8030f5:	74 62                	je     803159 <get_uvpt_entry+0x96>
+  8030f7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030fe:	01 00 00 
+  803101:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803105:	f6 c2 80             	test   $0x80,%dl
+  803108:	75 4f                	jne    803159 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80310a:	48 89 f8             	mov    %rdi,%rax
+  80310d:	48 c1 e8 15          	shr    $0x15,%rax
+  803111:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803118:	01 00 00 
+  80311b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80311f:	f6 c2 01             	test   $0x1,%dl
+  803122:	74 44                	je     803168 <get_uvpt_entry+0xa5>
+  803124:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80312b:	01 00 00 
+  80312e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803132:	f6 c2 80             	test   $0x80,%dl
+  803135:	75 31                	jne    803168 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803137:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80313b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803142:	01 00 00 
+  803145:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803149:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80314a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803151:	01 00 00 
+  803154:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803158:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803159:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803160:	01 00 00 
+  803163:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803167:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803168:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80316f:	01 00 00 
+  803172:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803176:	c3                   	ret
+
+0000000000803177 <get_prot>:
+
+int
+get_prot(void *va) {
+  803177:	55                   	push   %rbp
+  803178:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80317b:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  803182:	00 00 00 
+  803185:	ff d0                	call   *%rax
+  803187:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80318a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80318f:	89 c1                	mov    %eax,%ecx
+  803191:	83 c9 04             	or     $0x4,%ecx
+  803194:	f6 c2 01             	test   $0x1,%dl
+  803197:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80319a:	89 c1                	mov    %eax,%ecx
+  80319c:	83 c9 02             	or     $0x2,%ecx
+  80319f:	f6 c2 02             	test   $0x2,%dl
+  8031a2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8031a5:	89 c1                	mov    %eax,%ecx
+  8031a7:	83 c9 01             	or     $0x1,%ecx
+  8031aa:	48 85 d2             	test   %rdx,%rdx
+  8031ad:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8031b0:	89 c1                	mov    %eax,%ecx
+  8031b2:	83 c9 40             	or     $0x40,%ecx
+  8031b5:	f6 c6 04             	test   $0x4,%dh
+  8031b8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8031bb:	5d                   	pop    %rbp
+  8031bc:	c3                   	ret
+
+00000000008031bd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8031bd:	55                   	push   %rbp
+  8031be:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8031c1:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8031cd:	48 c1 e8 06          	shr    $0x6,%rax
+  8031d1:	83 e0 01             	and    $0x1,%eax
+}
+  8031d4:	5d                   	pop    %rbp
+  8031d5:	c3                   	ret
+
+00000000008031d6 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8031d6:	55                   	push   %rbp
+  8031d7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8031da:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8031e1:	00 00 00 
+  8031e4:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8031e6:	48 c1 e8 05          	shr    $0x5,%rax
+  8031ea:	83 e0 01             	and    $0x1,%eax
+}
+  8031ed:	5d                   	pop    %rbp
+  8031ee:	c3                   	ret
+
+00000000008031ef <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8031f3:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	83 e0 01             	and    $0x1,%eax
+}
+  803202:	5d                   	pop    %rbp
+  803203:	c3                   	ret
+
+0000000000803204 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+  803208:	41 57                	push   %r15
+  80320a:	41 56                	push   %r14
+  80320c:	41 55                	push   %r13
+  80320e:	41 54                	push   %r12
+  803210:	53                   	push   %rbx
+  803211:	48 83 ec 18          	sub    $0x18,%rsp
+  803215:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803219:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80321d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803222:	49 bd ef 31 80 00 00 	movabs $0x8031ef,%r13
+  803229:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80322c:	49 bf 77 31 80 00 00 	movabs $0x803177,%r15
+  803233:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803236:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80323d:	00 00 00 
+  803240:	eb 0c                	jmp    80324e <foreach_shared_region+0x4a>
+  803242:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803249:	4c 39 f3             	cmp    %r14,%rbx
+  80324c:	74 2e                	je     80327c <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80324e:	48 89 df             	mov    %rbx,%rdi
+  803251:	41 ff d5             	call   *%r13
+  803254:	84 c0                	test   %al,%al
+  803256:	74 ea                	je     803242 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803258:	48 89 df             	mov    %rbx,%rdi
+  80325b:	41 ff d7             	call   *%r15
+  80325e:	a8 40                	test   $0x40,%al
+  803260:	74 e0                	je     803242 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803262:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803269:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80326d:	48 89 df             	mov    %rbx,%rdi
+  803270:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803274:	ff d0                	call   *%rax
+				if (res < 0) {
+  803276:	85 c0                	test   %eax,%eax
+  803278:	79 c8                	jns    803242 <foreach_shared_region+0x3e>
+  80327a:	eb 05                	jmp    803281 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80327c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803281:	48 83 c4 18          	add    $0x18,%rsp
+  803285:	5b                   	pop    %rbx
+  803286:	41 5c                	pop    %r12
+  803288:	41 5d                	pop    %r13
+  80328a:	41 5e                	pop    %r14
+  80328c:	41 5f                	pop    %r15
+  80328e:	5d                   	pop    %rbp
+  80328f:	c3                   	ret
+
+0000000000803290 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803290:	b8 00 00 00 00       	mov    $0x0,%eax
+  803295:	c3                   	ret
+
+0000000000803296 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803296:	55                   	push   %rbp
+  803297:	48 89 e5             	mov    %rsp,%rbp
+  80329a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80329d:	48 be 94 3e 80 00 00 	movabs $0x803e94,%rsi
+  8032a4:	00 00 00 
+  8032a7:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  8032ae:	00 00 00 
+  8032b1:	ff d0                	call   *%rax
+    return 0;
+}
+  8032b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b8:	5d                   	pop    %rbp
+  8032b9:	c3                   	ret
+
+00000000008032ba <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8032ba:	55                   	push   %rbp
+  8032bb:	48 89 e5             	mov    %rsp,%rbp
+  8032be:	41 57                	push   %r15
+  8032c0:	41 56                	push   %r14
+  8032c2:	41 55                	push   %r13
+  8032c4:	41 54                	push   %r12
+  8032c6:	53                   	push   %rbx
+  8032c7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8032ce:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8032d5:	48 85 d2             	test   %rdx,%rdx
+  8032d8:	74 7a                	je     803354 <devcons_write+0x9a>
+  8032da:	49 89 d6             	mov    %rdx,%r14
+  8032dd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032e3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8032e8:	49 bf c8 0d 80 00 00 	movabs $0x800dc8,%r15
+  8032ef:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032f2:	4c 89 f3             	mov    %r14,%rbx
+  8032f5:	48 29 f3             	sub    %rsi,%rbx
+  8032f8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032fd:	48 39 c3             	cmp    %rax,%rbx
+  803300:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803304:	4c 63 eb             	movslq %ebx,%r13
+  803307:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80330e:	48 01 c6             	add    %rax,%rsi
+  803311:	4c 89 ea             	mov    %r13,%rdx
+  803314:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80331b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80331e:	4c 89 ee             	mov    %r13,%rsi
+  803321:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803328:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  80332f:	00 00 00 
+  803332:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803334:	41 01 dc             	add    %ebx,%r12d
+  803337:	49 63 f4             	movslq %r12d,%rsi
+  80333a:	4c 39 f6             	cmp    %r14,%rsi
+  80333d:	72 b3                	jb     8032f2 <devcons_write+0x38>
+    return res;
+  80333f:	49 63 c4             	movslq %r12d,%rax
+}
+  803342:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803349:	5b                   	pop    %rbx
+  80334a:	41 5c                	pop    %r12
+  80334c:	41 5d                	pop    %r13
+  80334e:	41 5e                	pop    %r14
+  803350:	41 5f                	pop    %r15
+  803352:	5d                   	pop    %rbp
+  803353:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803354:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80335a:	eb e3                	jmp    80333f <devcons_write+0x85>
+
+000000000080335c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80335c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80335f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803364:	48 85 c0             	test   %rax,%rax
+  803367:	74 55                	je     8033be <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803369:	55                   	push   %rbp
+  80336a:	48 89 e5             	mov    %rsp,%rbp
+  80336d:	41 55                	push   %r13
+  80336f:	41 54                	push   %r12
+  803371:	53                   	push   %rbx
+  803372:	48 83 ec 08          	sub    $0x8,%rsp
+  803376:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803379:	48 bb fe 10 80 00 00 	movabs $0x8010fe,%rbx
+  803380:	00 00 00 
+  803383:	49 bc cb 11 80 00 00 	movabs $0x8011cb,%r12
+  80338a:	00 00 00 
+  80338d:	eb 03                	jmp    803392 <devcons_read+0x36>
+  80338f:	41 ff d4             	call   *%r12
+  803392:	ff d3                	call   *%rbx
+  803394:	85 c0                	test   %eax,%eax
+  803396:	74 f7                	je     80338f <devcons_read+0x33>
+    if (c < 0) return c;
+  803398:	48 63 d0             	movslq %eax,%rdx
+  80339b:	78 13                	js     8033b0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80339d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a2:	83 f8 04             	cmp    $0x4,%eax
+  8033a5:	74 09                	je     8033b0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8033a7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8033ab:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8033b0:	48 89 d0             	mov    %rdx,%rax
+  8033b3:	48 83 c4 08          	add    $0x8,%rsp
+  8033b7:	5b                   	pop    %rbx
+  8033b8:	41 5c                	pop    %r12
+  8033ba:	41 5d                	pop    %r13
+  8033bc:	5d                   	pop    %rbp
+  8033bd:	c3                   	ret
+  8033be:	48 89 d0             	mov    %rdx,%rax
+  8033c1:	c3                   	ret
+
+00000000008033c2 <cputchar>:
+cputchar(int ch) {
+  8033c2:	55                   	push   %rbp
+  8033c3:	48 89 e5             	mov    %rsp,%rbp
+  8033c6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8033ca:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8033ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8033d3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8033d7:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  8033de:	00 00 00 
+  8033e1:	ff d0                	call   *%rax
+}
+  8033e3:	c9                   	leave
+  8033e4:	c3                   	ret
+
+00000000008033e5 <getchar>:
+getchar(void) {
+  8033e5:	55                   	push   %rbp
+  8033e6:	48 89 e5             	mov    %rsp,%rbp
+  8033e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8033ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033f2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fb:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  803402:	00 00 00 
+  803405:	ff d0                	call   *%rax
+  803407:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 06                	js     803413 <getchar+0x2e>
+  80340d:	74 08                	je     803417 <getchar+0x32>
+  80340f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803413:	89 d0                	mov    %edx,%eax
+  803415:	c9                   	leave
+  803416:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803417:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80341c:	eb f5                	jmp    803413 <getchar+0x2e>
+
+000000000080341e <iscons>:
+iscons(int fdnum) {
+  80341e:	55                   	push   %rbp
+  80341f:	48 89 e5             	mov    %rsp,%rbp
+  803422:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803426:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80342a:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803436:	85 c0                	test   %eax,%eax
+  803438:	78 18                	js     803452 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80343a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80343e:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803445:	00 00 00 
+  803448:	8b 00                	mov    (%rax),%eax
+  80344a:	39 02                	cmp    %eax,(%rdx)
+  80344c:	0f 94 c0             	sete   %al
+  80344f:	0f b6 c0             	movzbl %al,%eax
+}
+  803452:	c9                   	leave
+  803453:	c3                   	ret
+
+0000000000803454 <opencons>:
+opencons(void) {
+  803454:	55                   	push   %rbp
+  803455:	48 89 e5             	mov    %rsp,%rbp
+  803458:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80345c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803460:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  803467:	00 00 00 
+  80346a:	ff d0                	call   *%rax
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	78 49                	js     8034b9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803470:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803475:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80347a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80347e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803483:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  80348a:	00 00 00 
+  80348d:	ff d0                	call   *%rax
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	78 26                	js     8034b9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803493:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803497:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80349e:	00 00 
+  8034a0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8034a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034a6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8034ad:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+}
+  8034b9:	c9                   	leave
+  8034ba:	c3                   	ret
+
+00000000008034bb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8034bb:	55                   	push   %rbp
+  8034bc:	48 89 e5             	mov    %rsp,%rbp
+  8034bf:	41 56                	push   %r14
+  8034c1:	41 55                	push   %r13
+  8034c3:	41 54                	push   %r12
+  8034c5:	53                   	push   %rbx
+  8034c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8034ca:	49 89 fc             	mov    %rdi,%r12
+  8034cd:	41 89 f5             	mov    %esi,%r13d
+  8034d0:	48 89 d3             	mov    %rdx,%rbx
+  8034d3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8034d7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8034db:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8034df:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8034e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034ea:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8034ee:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8034f2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034f6:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8034fd:	00 00 00 
+  803500:	4c 8b 30             	mov    (%rax),%r14
+  803503:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	89 c6                	mov    %eax,%esi
+  803511:	45 89 e8             	mov    %r13d,%r8d
+  803514:	4c 89 e1             	mov    %r12,%rcx
+  803517:	4c 89 f2             	mov    %r14,%rdx
+  80351a:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  803521:	00 00 00 
+  803524:	b8 00 00 00 00       	mov    $0x0,%eax
+  803529:	49 bc a9 02 80 00 00 	movabs $0x8002a9,%r12
+  803530:	00 00 00 
+  803533:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803536:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80353a:	48 89 df             	mov    %rbx,%rdi
+  80353d:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+    cprintf("\n");
+  803549:	48 bf 14 38 80 00 00 	movabs $0x803814,%rdi
+  803550:	00 00 00 
+  803553:	b8 00 00 00 00       	mov    $0x0,%eax
+  803558:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80355b:	cc                   	int3
+  80355c:	eb fd                	jmp    80355b <_panic+0xa0>
+
+000000000080355e <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80355e:	55                   	push   %rbp
+  80355f:	48 89 e5             	mov    %rsp,%rbp
+  803562:	41 55                	push   %r13
+  803564:	41 54                	push   %r12
+  803566:	53                   	push   %rbx
+  803567:	48 83 ec 08          	sub    $0x8,%rsp
+  80356b:	49 89 fc             	mov    %rdi,%r12
+  80356e:	48 89 f7             	mov    %rsi,%rdi
+  803571:	48 89 d3             	mov    %rdx,%rbx
+  803574:	49 89 cd             	mov    %rcx,%r13
+  803577:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80357a:	48 85 f6             	test   %rsi,%rsi
+  80357d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803584:	00 00 00 
+  803587:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80358b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803590:	48 85 db             	test   %rbx,%rbx
+  803593:	74 03                	je     803598 <ipc_recv_timed+0x3a>
+  803595:	48 8b 33             	mov    (%rbx),%rsi
+  803598:	48 b8 f4 14 80 00 00 	movabs $0x8014f4,%rax
+  80359f:	00 00 00 
+  8035a2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	78 75                	js     80361d <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8035a8:	4d 85 e4             	test   %r12,%r12
+  8035ab:	74 14                	je     8035c1 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8035ad:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035b4:	00 00 00 
+  8035b7:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8035bd:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8035c1:	4d 85 ed             	test   %r13,%r13
+  8035c4:	74 14                	je     8035da <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8035c6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035cd:	00 00 00 
+  8035d0:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8035d6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8035da:	48 85 db             	test   %rbx,%rbx
+  8035dd:	74 23                	je     803602 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8035df:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035e6:	00 00 00 
+  8035e9:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8035ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f4:	85 c9                	test   %ecx,%ecx
+  8035f6:	74 07                	je     8035ff <ipc_recv_timed+0xa1>
+  8035f8:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035ff:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803602:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803609:	00 00 00 
+  80360c:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803612:	48 83 c4 08          	add    $0x8,%rsp
+  803616:	5b                   	pop    %rbx
+  803617:	41 5c                	pop    %r12
+  803619:	41 5d                	pop    %r13
+  80361b:	5d                   	pop    %rbp
+  80361c:	c3                   	ret
+        if (from_env_store != NULL) {
+  80361d:	4d 85 e4             	test   %r12,%r12
+  803620:	74 08                	je     80362a <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803622:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803629:	00 
+        if (perm_store != NULL) {
+  80362a:	4d 85 ed             	test   %r13,%r13
+  80362d:	74 08                	je     803637 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80362f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803636:	00 
+        if (size != NULL) {
+  803637:	48 85 db             	test   %rbx,%rbx
+  80363a:	74 d6                	je     803612 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80363c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803643:	eb cd                	jmp    803612 <ipc_recv_timed+0xb4>
+
+0000000000803645 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803649:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80364f:	48 b8 5e 35 80 00 00 	movabs $0x80355e,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+}
+  80365b:	5d                   	pop    %rbp
+  80365c:	c3                   	ret
+
+000000000080365d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80365d:	55                   	push   %rbp
+  80365e:	48 89 e5             	mov    %rsp,%rbp
+  803661:	41 57                	push   %r15
+  803663:	41 56                	push   %r14
+  803665:	41 55                	push   %r13
+  803667:	41 54                	push   %r12
+  803669:	53                   	push   %rbx
+  80366a:	48 83 ec 18          	sub    $0x18,%rsp
+  80366e:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803671:	48 89 d3             	mov    %rdx,%rbx
+  803674:	49 89 cc             	mov    %rcx,%r12
+  803677:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80367a:	48 85 d2             	test   %rdx,%rdx
+  80367d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803684:	00 00 00 
+  803687:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80368b:	89 f0                	mov    %esi,%eax
+  80368d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803691:	48 89 da             	mov    %rbx,%rdx
+  803694:	48 89 c6             	mov    %rax,%rsi
+  803697:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  80369e:	00 00 00 
+  8036a1:	ff d0                	call   *%rax
+    while (res < 0) {
+  8036a3:	85 c0                	test   %eax,%eax
+  8036a5:	79 65                	jns    80370c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036a7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036aa:	75 33                	jne    8036df <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8036ac:	49 bf cb 11 80 00 00 	movabs $0x8011cb,%r15
+  8036b3:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036b6:	49 be c8 14 80 00 00 	movabs $0x8014c8,%r14
+  8036bd:	00 00 00 
+        sys_yield();
+  8036c0:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036c3:	45 89 e8             	mov    %r13d,%r8d
+  8036c6:	4c 89 e1             	mov    %r12,%rcx
+  8036c9:	48 89 da             	mov    %rbx,%rdx
+  8036cc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036d0:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8036d3:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	79 32                	jns    80370c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036da:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036dd:	74 e1                	je     8036c0 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8036df:	89 c1                	mov    %eax,%ecx
+  8036e1:	48 ba c3 3e 80 00 00 	movabs $0x803ec3,%rdx
+  8036e8:	00 00 00 
+  8036eb:	be 52 00 00 00       	mov    $0x52,%esi
+  8036f0:	48 bf d7 3e 80 00 00 	movabs $0x803ed7,%rdi
+  8036f7:	00 00 00 
+  8036fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ff:	49 b8 bb 34 80 00 00 	movabs $0x8034bb,%r8
+  803706:	00 00 00 
+  803709:	41 ff d0             	call   *%r8
+    }
+}
+  80370c:	48 83 c4 18          	add    $0x18,%rsp
+  803710:	5b                   	pop    %rbx
+  803711:	41 5c                	pop    %r12
+  803713:	41 5d                	pop    %r13
+  803715:	41 5e                	pop    %r14
+  803717:	41 5f                	pop    %r15
+  803719:	5d                   	pop    %rbp
+  80371a:	c3                   	ret
+
+000000000080371b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80371b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803720:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803727:	00 00 00 
+  80372a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80372e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803732:	48 c1 e2 04          	shl    $0x4,%rdx
+  803736:	48 01 ca             	add    %rcx,%rdx
+  803739:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80373f:	39 fa                	cmp    %edi,%edx
+  803741:	74 12                	je     803755 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803743:	48 83 c0 01          	add    $0x1,%rax
+  803747:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80374d:	75 db                	jne    80372a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80374f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803754:	c3                   	ret
+            return envs[i].env_id;
+  803755:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803759:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80375d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803761:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803768:	00 00 00 
+  80376b:	48 01 d0             	add    %rdx,%rax
+  80376e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803774:	c3                   	ret
+  803775:	0f 1f 00             	nopl   (%rax)
+
+0000000000803778 <__rodata_start>:
+  803778:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  80377a:	74 20                	je     80379c <__rodata_start+0x24>
+  80377c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80377e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80377f:	75 67                	jne    8037e8 <__rodata_start+0x70>
+  803781:	68 20 61 72 67       	push   $0x67726120
+  803786:	75 6d                	jne    8037f5 <__rodata_start+0x7d>
+  803788:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80378a:	74 73                	je     8037ff <__rodata_start+0x87>
+  80378c:	20 66 6f             	and    %ah,0x6f(%rsi)
+  80378f:	72 20                	jb     8037b1 <__rodata_start+0x39>
+  803791:	61                   	(bad)
+  803792:	63 63 65             	movsxd 0x65(%rbx),%esp
+  803795:	70 74                	jo     80380b <__rodata_start+0x93>
+  803797:	69 6e 67 20 73 6e 61 	imul   $0x616e7320,0x67(%rsi),%ebp
+  80379e:	70 73                	jo     803813 <__rodata_start+0x9b>
+  8037a0:	68 6f 74 0a 00       	push   $0xa746f
+  8037a5:	00 00                	add    %al,(%rax)
+  8037a7:	00 54 6f 6f          	add    %dl,0x6f(%rdi,%rbp,2)
+  8037ab:	20 6d 75             	and    %ch,0x75(%rbp)
+  8037ae:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8037b1:	61                   	(bad)
+  8037b2:	72 67                	jb     80381b <__rodata_start+0xa3>
+  8037b4:	75 6d                	jne    803823 <__rodata_start+0xab>
+  8037b6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037b8:	74 73                	je     80382d <__rodata_start+0xb5>
+  8037ba:	20 66 6f             	and    %ah,0x6f(%rsi)
+  8037bd:	72 20                	jb     8037df <__rodata_start+0x67>
+  8037bf:	61                   	(bad)
+  8037c0:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8037c3:	70 74                	jo     803839 <__rodata_start+0xc1>
+  8037c5:	69 6e 67 20 73 6e 61 	imul   $0x616e7320,0x67(%rsi),%ebp
+  8037cc:	70 73                	jo     803841 <__rodata_start+0xc9>
+  8037ce:	68 6f 74 0a 00       	push   $0xa746f
+  8037d3:	00 00                	add    %al,(%rax)
+  8037d5:	00 00                	add    %al,(%rax)
+  8037d7:	00 20                	add    %ah,(%rax)
+  8037d9:	20 20                	and    %ah,(%rax)
+  8037db:	20 20                	and    %ah,(%rax)
+  8037dd:	20 20                	and    %ah,(%rax)
+  8037df:	61                   	(bad)
+  8037e0:	72 67                	jb     803849 <__rodata_start+0xd1>
+  8037e2:	20 70 6f             	and    %dh,0x6f(%rax)
+  8037e5:	73 69                	jae    803850 <__rodata_start+0xd8>
+  8037e7:	74 69                	je     803852 <__rodata_start+0xda>
+  8037e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037eb:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e15855 <__bss_end+0x7260d855>
+  8037f1:	67 75 6d             	addr32 jne 803861 <__rodata_start+0xe9>
+  8037f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037f6:	74 3a                	je     803832 <__rodata_start+0xba>
+  8037f8:	25 73 0a 00 53       	and    $0x53000a73,%eax
+  8037fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037fe:	61                   	(bad)
+  8037ff:	70 73                	jo     803874 <__rodata_start+0xfc>
+  803801:	68 6f 74 20 69       	push   $0x6920746f
+  803806:	73 20                	jae    803828 <__rodata_start+0xb0>
+  803808:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803809:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80380a:	74 20                	je     80382c <__rodata_start+0xb4>
+  80380c:	61                   	(bad)
+  80380d:	63 63 65             	movsxd 0x65(%rbx),%esp
+  803810:	70 74                	jo     803886 <__rodata_start+0x10e>
+  803812:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  803816:	3c 75                	cmp    $0x75,%al
+  803818:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803819:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80381d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80381e:	3e 00 30             	ds add %dh,(%rax)
+  803821:	31 32                	xor    %esi,(%rdx)
+  803823:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80382a:	41                   	rex.B
+  80382b:	42                   	rex.X
+  80382c:	43                   	rex.XB
+  80382d:	44                   	rex.R
+  80382e:	45                   	rex.RB
+  80382f:	46 00 30             	rex.RX add %r14b,(%rax)
+  803832:	31 32                	xor    %esi,(%rdx)
+  803834:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80383b:	61                   	(bad)
+  80383c:	62 63 64 65 66       	(bad)
+  803841:	00 28                	add    %ch,(%rax)
+  803843:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803844:	75 6c                	jne    8038b2 <__rodata_start+0x13a>
+  803846:	6c                   	insb   (%dx),%es:(%rdi)
+  803847:	29 00                	sub    %eax,(%rax)
+  803849:	65 72 72             	gs jb  8038be <__rodata_start+0x146>
+  80384c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80384d:	72 20                	jb     80386f <__rodata_start+0xf7>
+  80384f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803854:	73 70                	jae    8038c6 <__rodata_start+0x14e>
+  803856:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80385a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803861:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803862:	72 00                	jb     803864 <__rodata_start+0xec>
+  803864:	62 61 64 20 65       	(bad)
+  803869:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80386a:	76 69                	jbe    8038d5 <__rodata_start+0x15d>
+  80386c:	72 6f                	jb     8038dd <__rodata_start+0x165>
+  80386e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80386f:	6d                   	insl   (%dx),%es:(%rdi)
+  803870:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803872:	74 00                	je     803874 <__rodata_start+0xfc>
+  803874:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80387b:	20 70 61             	and    %dh,0x61(%rax)
+  80387e:	72 61                	jb     8038e1 <__rodata_start+0x169>
+  803880:	6d                   	insl   (%dx),%es:(%rdi)
+  803881:	65 74 65             	gs je  8038e9 <__rodata_start+0x171>
+  803884:	72 00                	jb     803886 <__rodata_start+0x10e>
+  803886:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803887:	75 74                	jne    8038fd <__rodata_start+0x185>
+  803889:	20 6f 66             	and    %ch,0x66(%rdi)
+  80388c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80388f:	6d                   	insl   (%dx),%es:(%rdi)
+  803890:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803891:	72 79                	jb     80390c <__rodata_start+0x194>
+  803893:	00 6f 75             	add    %ch,0x75(%rdi)
+  803896:	74 20                	je     8038b8 <__rodata_start+0x140>
+  803898:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803899:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80389d:	76 69                	jbe    803908 <__rodata_start+0x190>
+  80389f:	72 6f                	jb     803910 <__rodata_start+0x198>
+  8038a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8038a3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038a5:	74 73                	je     80391a <__rodata_start+0x1a2>
+  8038a7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8038aa:	72 72                	jb     80391e <__rodata_start+0x1a6>
+  8038ac:	75 70                	jne    80391e <__rodata_start+0x1a6>
+  8038ae:	74 65                	je     803915 <__rodata_start+0x19d>
+  8038b0:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8038b5:	75 67                	jne    80391e <__rodata_start+0x1a6>
+  8038b7:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8038ba:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038bc:	00 73 65             	add    %dh,0x65(%rbx)
+  8038bf:	67 6d                	insl   (%dx),%es:(%edi)
+  8038c1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038c3:	74 61                	je     803926 <__rodata_start+0x1ae>
+  8038c5:	74 69                	je     803930 <__rodata_start+0x1b8>
+  8038c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c9:	20 66 61             	and    %ah,0x61(%rsi)
+  8038cc:	75 6c                	jne    80393a <__rodata_start+0x1c2>
+  8038ce:	74 00                	je     8038d0 <__rodata_start+0x158>
+  8038d0:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038d7:	20 45 4c             	and    %al,0x4c(%rbp)
+  8038da:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8038de:	61                   	(bad)
+  8038df:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8038e4:	20 73 75             	and    %dh,0x75(%rbx)
+  8038e7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8038ea:	73 79                	jae    803965 <__rodata_start+0x1ed>
+  8038ec:	73 74                	jae    803962 <__rodata_start+0x1ea>
+  8038ee:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8038f0:	20 63 61             	and    %ah,0x61(%rbx)
+  8038f3:	6c                   	insb   (%dx),%es:(%rdi)
+  8038f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8038f5:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8038f8:	74 72                	je     80396c <__rodata_start+0x1f4>
+  8038fa:	79 20                	jns    80391c <__rodata_start+0x1a4>
+  8038fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038fd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fe:	74 20                	je     803920 <__rodata_start+0x1a8>
+  803900:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803902:	75 6e                	jne    803972 <__rodata_start+0x1fa>
+  803904:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803908:	76 20                	jbe    80392a <__rodata_start+0x1b2>
+  80390a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803911:	72 65                	jb     803978 <__rodata_start+0x200>
+  803913:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803916:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803917:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80391b:	65 78 70             	gs js  80398e <__rodata_start+0x216>
+  80391e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803923:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803926:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80392a:	20 66 69             	and    %ah,0x69(%rsi)
+  80392d:	6c                   	insb   (%dx),%es:(%rdi)
+  80392e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803932:	20 66 72             	and    %ah,0x72(%rsi)
+  803935:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80393a:	61                   	(bad)
+  80393b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80393e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803940:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803944:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803947:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803948:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803949:	20 6d 61             	and    %ch,0x61(%rbp)
+  80394c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80394d:	79 20                	jns    80396f <__rodata_start+0x1f7>
+  80394f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803956:	72 65                	jb     8039bd <__rodata_start+0x245>
+  803958:	20 6f 70             	and    %ch,0x70(%rdi)
+  80395b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80395d:	00 66 69             	add    %ah,0x69(%rsi)
+  803960:	6c                   	insb   (%dx),%es:(%rdi)
+  803961:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803965:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803968:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803969:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80396c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80396d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80396e:	74 20                	je     803990 <__rodata_start+0x218>
+  803970:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803972:	75 6e                	jne    8039e2 <__rodata_start+0x26a>
+  803974:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803978:	76 61                	jbe    8039db <__rodata_start+0x263>
+  80397a:	6c                   	insb   (%dx),%es:(%rdi)
+  80397b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803982:	00 
+  803983:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80398a:	72 65                	jb     8039f1 <__rodata_start+0x279>
+  80398c:	61                   	(bad)
+  80398d:	64 79 20             	fs jns 8039b0 <__rodata_start+0x238>
+  803990:	65 78 69             	gs js  8039fc <__rodata_start+0x284>
+  803993:	73 74                	jae    803a09 <__rodata_start+0x291>
+  803995:	73 00                	jae    803997 <__rodata_start+0x21f>
+  803997:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803998:	70 65                	jo     8039ff <__rodata_start+0x287>
+  80399a:	72 61                	jb     8039fd <__rodata_start+0x285>
+  80399c:	74 69                	je     803a07 <__rodata_start+0x28f>
+  80399e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80399f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039a0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8039a3:	74 20                	je     8039c5 <__rodata_start+0x24d>
+  8039a5:	73 75                	jae    803a1c <__rodata_start+0x2a4>
+  8039a7:	70 70                	jo     803a19 <__rodata_start+0x2a1>
+  8039a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039aa:	72 74                	jb     803a20 <__rodata_start+0x2a8>
+  8039ac:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  8039b2:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  8039b7:	74 00                	je     8039b9 <__rodata_start+0x241>
+  8039b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  8039c0:	96                   	xchg   %eax,%esi
+  8039c1:	04 80                	add    $0x80,%al
+  8039c3:	00 00                	add    %al,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 d7                	add    %dl,%bh
+  8039c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039cf:	00 c7                	add    %al,%bh
+  8039d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039d7:	00 d7                	add    %dl,%bh
+  8039d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039df:	00 d7                	add    %dl,%bh
+  8039e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039e7:	00 d7                	add    %dl,%bh
+  8039e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039ef:	00 d7                	add    %dl,%bh
+  8039f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039f7:	00 b5 04 80 00 00    	add    %dh,0x8004(%rbp)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 d7                	add    %dl,%bh
+  803a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a07:	00 d7                	add    %dl,%bh
+  803a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a0f:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 23                	add    %ah,(%rbx)
+  803a19:	05 80 00 00 00       	add    $0x80,%eax
+  803a1e:	00 00                	add    %al,(%rax)
+  803a20:	d7                   	xlat   %ds:(%rbx)
+  803a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a27:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 ef                	add    %ch,%bh
+  803a31:	04 80                	add    $0x80,%al
+  803a33:	00 00                	add    %al,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 ef                	add    %ch,%bh
+  803a39:	04 80                	add    $0x80,%al
+  803a3b:	00 00                	add    %al,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 ef                	add    %ch,%bh
+  803a41:	04 80                	add    $0x80,%al
+  803a43:	00 00                	add    %al,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 ef                	add    %ch,%bh
+  803a49:	04 80                	add    $0x80,%al
+  803a4b:	00 00                	add    %al,(%rax)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 ef                	add    %ch,%bh
+  803a51:	04 80                	add    $0x80,%al
+  803a53:	00 00                	add    %al,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 ef                	add    %ch,%bh
+  803a59:	04 80                	add    $0x80,%al
+  803a5b:	00 00                	add    %al,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 ef                	add    %ch,%bh
+  803a61:	04 80                	add    $0x80,%al
+  803a63:	00 00                	add    %al,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 ef                	add    %ch,%bh
+  803a69:	04 80                	add    $0x80,%al
+  803a6b:	00 00                	add    %al,(%rax)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 ef                	add    %ch,%bh
+  803a71:	04 80                	add    $0x80,%al
+  803a73:	00 00                	add    %al,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 d7                	add    %dl,%bh
+  803a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a7f:	00 d7                	add    %dl,%bh
+  803a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a87:	00 d7                	add    %dl,%bh
+  803a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a8f:	00 d7                	add    %dl,%bh
+  803a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a97:	00 d7                	add    %dl,%bh
+  803a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a9f:	00 d7                	add    %dl,%bh
+  803aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aa7:	00 d7                	add    %dl,%bh
+  803aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aaf:	00 d7                	add    %dl,%bh
+  803ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ab7:	00 d7                	add    %dl,%bh
+  803ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803abf:	00 d7                	add    %dl,%bh
+  803ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ac7:	00 d7                	add    %dl,%bh
+  803ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803acf:	00 d7                	add    %dl,%bh
+  803ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ad7:	00 d7                	add    %dl,%bh
+  803ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803adf:	00 d7                	add    %dl,%bh
+  803ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ae7:	00 d7                	add    %dl,%bh
+  803ae9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aef:	00 d7                	add    %dl,%bh
+  803af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803af7:	00 d7                	add    %dl,%bh
+  803af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aff:	00 d7                	add    %dl,%bh
+  803b01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b07:	00 d7                	add    %dl,%bh
+  803b09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b0f:	00 d7                	add    %dl,%bh
+  803b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b17:	00 d7                	add    %dl,%bh
+  803b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b1f:	00 d7                	add    %dl,%bh
+  803b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b27:	00 d7                	add    %dl,%bh
+  803b29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b2f:	00 d7                	add    %dl,%bh
+  803b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b37:	00 d7                	add    %dl,%bh
+  803b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b3f:	00 d7                	add    %dl,%bh
+  803b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b47:	00 d7                	add    %dl,%bh
+  803b49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b4f:	00 d7                	add    %dl,%bh
+  803b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b57:	00 d7                	add    %dl,%bh
+  803b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b5f:	00 d7                	add    %dl,%bh
+  803b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b67:	00 fa                	add    %bh,%dl
+  803b69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b6f:	00 d7                	add    %dl,%bh
+  803b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b77:	00 d7                	add    %dl,%bh
+  803b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b7f:	00 d7                	add    %dl,%bh
+  803b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b87:	00 d7                	add    %dl,%bh
+  803b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b8f:	00 d7                	add    %dl,%bh
+  803b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b97:	00 d7                	add    %dl,%bh
+  803b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b9f:	00 d7                	add    %dl,%bh
+  803ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ba7:	00 d7                	add    %dl,%bh
+  803ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803baf:	00 d7                	add    %dl,%bh
+  803bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bb7:	00 d7                	add    %dl,%bh
+  803bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bbf:	00 46 05             	add    %al,0x5(%rsi)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 15 07 80 00 00    	add    %dl,0x8007(%rip)        # 80bbd4 <__bss_end+0x3bd4>
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 d7                	add    %dl,%bh
+  803bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bd7:	00 d7                	add    %dl,%bh
+  803bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bdf:	00 d7                	add    %dl,%bh
+  803be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803be7:	00 d7                	add    %dl,%bh
+  803be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bef:	00 75 05             	add    %dh,0x5(%rbp)
+  803bf2:	80 00 00             	addb   $0x0,(%rax)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 d7                	add    %dl,%bh
+  803bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bff:	00 d7                	add    %dl,%bh
+  803c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c07:	00 3b                	add    %bh,(%rbx)
+  803c09:	05 80 00 00 00       	add    $0x80,%eax
+  803c0e:	00 00                	add    %al,(%rax)
+  803c10:	d7                   	xlat   %ds:(%rbx)
+  803c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c17:	00 d7                	add    %dl,%bh
+  803c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c1f:	00 bd 08 80 00 00    	add    %bh,0x8008(%rbp)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 87 09 80 00 00    	add    %al,0x8009(%rdi)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 d7                	add    %dl,%bh
+  803c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c37:	00 d7                	add    %dl,%bh
+  803c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c3f:	00 0c 06             	add    %cl,(%rsi,%rax,1)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 d7                	add    %dl,%bh
+  803c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c4f:	00 e9                	add    %ch,%cl
+  803c51:	07                   	(bad)
+  803c52:	80 00 00             	addb   $0x0,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 d7                	add    %dl,%bh
+  803c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c5f:	00 d7                	add    %dl,%bh
+  803c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c67:	00 fa                	add    %bh,%dl
+  803c69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803c6f:	00 d7                	add    %dl,%bh
+  803c71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c77:	00 9f 04 80 00 00    	add    %bl,0x8004(%rdi)
+  803c7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803c80 <error_string>:
+	...
+  803c88:	52 38 80 00 00 00 00 00 64 38 80 00 00 00 00 00     R8......d8......
+  803c98:	74 38 80 00 00 00 00 00 86 38 80 00 00 00 00 00     t8.......8......
+  803ca8:	94 38 80 00 00 00 00 00 a8 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	bd 38 80 00 00 00 00 00 d0 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	e2 38 80 00 00 00 00 00 f6 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	06 39 80 00 00 00 00 00 19 39 80 00 00 00 00 00     .9.......9......
+  803ce8:	30 39 80 00 00 00 00 00 46 39 80 00 00 00 00 00     09......F9......
+  803cf8:	5e 39 80 00 00 00 00 00 76 39 80 00 00 00 00 00     ^9......v9......
+  803d08:	83 39 80 00 00 00 00 00 28 3d 80 00 00 00 00 00     .9......(=......
+  803d18:	97 39 80 00 00 00 00 00 af 39 80 00 00 00 00 00     .9.......9......
+  803d28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803d48:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803d58:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803d68:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803d78:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d88:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d98:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803da8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803db8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803dc8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803dd8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803de8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803df8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803e08:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803e18:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803e20 <devtab>:
+  803e20:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803e30:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803e40:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803e50:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803e60:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803e70:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e80:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e90:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803ea0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803eb0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803ec0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803ed0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
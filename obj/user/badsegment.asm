@@ -0,0 +1,6617 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80003d:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800044:	00 00 00 
+  800047:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80004e:	00 00 00 
+  800051:	48 39 c2             	cmp    %rax,%rdx
+  800054:	73 17                	jae    80006d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800056:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800059:	49 89 c4             	mov    %rax,%r12
+  80005c:	48 83 c3 08          	add    $0x8,%rbx
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	ff 53 f8             	call   *-0x8(%rbx)
+  800068:	4c 39 e3             	cmp    %r12,%rbx
+  80006b:	72 ef                	jb     80005c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80006d:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+  800079:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800082:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800086:	48 c1 e0 04          	shl    $0x4,%rax
+  80008a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800091:	00 00 00 
+  800094:	48 01 d0             	add    %rdx,%rax
+  800097:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80009e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a1:	45 85 ed             	test   %r13d,%r13d
+  8000a4:	7e 0d                	jle    8000b3 <libmain+0x87>
+  8000a6:	49 8b 06             	mov    (%r14),%rax
+  8000a9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000b0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b3:	4c 89 f6             	mov    %r14,%rsi
+  8000b6:	44 89 ef             	mov    %r13d,%edi
+  8000b9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c5:	48 b8 da 00 80 00 00 	movabs $0x8000da,%rax
+  8000cc:	00 00 00 
+  8000cf:	ff d0                	call   *%rax
+#endif
+}
+  8000d1:	5b                   	pop    %rbx
+  8000d2:	41 5c                	pop    %r12
+  8000d4:	41 5d                	pop    %r13
+  8000d6:	41 5e                	pop    %r14
+  8000d8:	5d                   	pop    %rbp
+  8000d9:	c3                   	ret
+
+00000000008000da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000da:	55                   	push   %rbp
+  8000db:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000de:	48 b8 7c 08 80 00 00 	movabs $0x80087c,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ef:	48 b8 5b 01 80 00 00 	movabs $0x80015b,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+}
+  8000fb:	5d                   	pop    %rbp
+  8000fc:	c3                   	ret
+
+00000000008000fd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000fd:	55                   	push   %rbp
+  8000fe:	48 89 e5             	mov    %rsp,%rbp
+  800101:	53                   	push   %rbx
+  800102:	48 89 fa             	mov    %rdi,%rdx
+  800105:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800108:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80010d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800112:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800117:	be 00 00 00 00       	mov    $0x0,%esi
+  80011c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800122:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800124:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800128:	c9                   	leave
+  800129:	c3                   	ret
+
+000000000080012a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012a:	55                   	push   %rbp
+  80012b:	48 89 e5             	mov    %rsp,%rbp
+  80012e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800134:	ba 00 00 00 00       	mov    $0x0,%edx
+  800139:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80013e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800143:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800148:	be 00 00 00 00       	mov    $0x0,%esi
+  80014d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800153:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800155:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800159:	c9                   	leave
+  80015a:	c3                   	ret
+
+000000000080015b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80015b:	55                   	push   %rbp
+  80015c:	48 89 e5             	mov    %rsp,%rbp
+  80015f:	53                   	push   %rbx
+  800160:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800164:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800167:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800176:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017b:	be 00 00 00 00       	mov    $0x0,%esi
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800186:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800188:	48 85 c0             	test   %rax,%rax
+  80018b:	7f 06                	jg     800193 <sys_env_destroy+0x38>
+}
+  80018d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800191:	c9                   	leave
+  800192:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800193:	49 89 c0             	mov    %rax,%r8
+  800196:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019b:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8001a2:	00 00 00 
+  8001a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8001aa:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8001b1:	00 00 00 
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  8001c0:	00 00 00 
+  8001c3:	41 ff d1             	call   *%r9
+
+00000000008001c6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+  8001ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ef:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+00000000008001f7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f7:	55                   	push   %rbp
+  8001f8:	48 89 e5             	mov    %rsp,%rbp
+  8001fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800201:	ba 00 00 00 00       	mov    $0x0,%edx
+  800206:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80020b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800210:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800215:	be 00 00 00 00       	mov    $0x0,%esi
+  80021a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800220:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+0000000000800228 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800228:	55                   	push   %rbp
+  800229:	48 89 e5             	mov    %rsp,%rbp
+  80022c:	53                   	push   %rbx
+  80022d:	48 89 fa             	mov    %rdi,%rdx
+  800230:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800233:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800238:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023f:	00 00 00 
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800247:	be 00 00 00 00       	mov    $0x0,%esi
+  80024c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800252:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+000000000080025a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025a:	55                   	push   %rbp
+  80025b:	48 89 e5             	mov    %rsp,%rbp
+  80025e:	53                   	push   %rbx
+  80025f:	49 89 f8             	mov    %rdi,%r8
+  800262:	48 89 d3             	mov    %rdx,%rbx
+  800265:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800268:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80026d:	4c 89 c2             	mov    %r8,%rdx
+  800270:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800273:	be 00 00 00 00       	mov    $0x0,%esi
+  800278:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800280:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+0000000000800286 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800286:	55                   	push   %rbp
+  800287:	48 89 e5             	mov    %rsp,%rbp
+  80028a:	53                   	push   %rbx
+  80028b:	48 83 ec 08          	sub    $0x8,%rsp
+  80028f:	89 f8                	mov    %edi,%eax
+  800291:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800294:	48 63 f9             	movslq %ecx,%rdi
+  800297:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002af:	48 85 c0             	test   %rax,%rax
+  8002b2:	7f 06                	jg     8002ba <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ba:	49 89 c0             	mov    %rax,%r8
+  8002bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c2:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8002d1:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  8002e7:	00 00 00 
+  8002ea:	41 ff d1             	call   *%r9
+
+00000000008002ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ed:	55                   	push   %rbp
+  8002ee:	48 89 e5             	mov    %rsp,%rbp
+  8002f1:	53                   	push   %rbx
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f6:	89 f8                	mov    %edi,%eax
+  8002f8:	49 89 f2             	mov    %rsi,%r10
+  8002fb:	48 89 cf             	mov    %rcx,%rdi
+  8002fe:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800301:	48 63 da             	movslq %edx,%rbx
+  800304:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800307:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80030c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800312:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800314:	48 85 c0             	test   %rax,%rax
+  800317:	7f 06                	jg     80031f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031f:	49 89 c0             	mov    %rax,%r8
+  800322:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800327:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80032e:	00 00 00 
+  800331:	be 26 00 00 00       	mov    $0x26,%esi
+  800336:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  80033d:	00 00 00 
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  80034c:	00 00 00 
+  80034f:	41 ff d1             	call   *%r9
+
+0000000000800352 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800352:	55                   	push   %rbp
+  800353:	48 89 e5             	mov    %rsp,%rbp
+  800356:	53                   	push   %rbx
+  800357:	48 83 ec 08          	sub    $0x8,%rsp
+  80035b:	48 89 f1             	mov    %rsi,%rcx
+  80035e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800361:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800364:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800369:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036e:	be 00 00 00 00       	mov    $0x0,%esi
+  800373:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800379:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80037b:	48 85 c0             	test   %rax,%rax
+  80037e:	7f 06                	jg     800386 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800380:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800386:	49 89 c0             	mov    %rax,%r8
+  800389:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038e:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800395:	00 00 00 
+  800398:	be 26 00 00 00       	mov    $0x26,%esi
+  80039d:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8003a4:	00 00 00 
+  8003a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ac:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  8003b3:	00 00 00 
+  8003b6:	41 ff d1             	call   *%r9
+
+00000000008003b9 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	53                   	push   %rbx
+  8003be:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003c2:	48 63 ce             	movslq %esi,%rcx
+  8003c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c8:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e4:	48 85 c0             	test   %rax,%rax
+  8003e7:	7f 06                	jg     8003ef <sys_env_set_status+0x36>
+}
+  8003e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ef:	49 89 c0             	mov    %rax,%r8
+  8003f2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8003f7:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8003fe:	00 00 00 
+  800401:	be 26 00 00 00       	mov    $0x26,%esi
+  800406:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  80040d:	00 00 00 
+  800410:	b8 00 00 00 00       	mov    $0x0,%eax
+  800415:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  80041c:	00 00 00 
+  80041f:	41 ff d1             	call   *%r9
+
+0000000000800422 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800422:	55                   	push   %rbp
+  800423:	48 89 e5             	mov    %rsp,%rbp
+  800426:	53                   	push   %rbx
+  800427:	48 83 ec 08          	sub    $0x8,%rsp
+  80042b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80042e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800431:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80044b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80044d:	48 85 c0             	test   %rax,%rax
+  800450:	7f 06                	jg     800458 <sys_env_set_trapframe+0x36>
+}
+  800452:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800456:	c9                   	leave
+  800457:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800458:	49 89 c0             	mov    %rax,%r8
+  80045b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800460:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800467:	00 00 00 
+  80046a:	be 26 00 00 00       	mov    $0x26,%esi
+  80046f:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800476:	00 00 00 
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  800485:	00 00 00 
+  800488:	41 ff d1             	call   *%r9
+
+000000000080048b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80048b:	55                   	push   %rbp
+  80048c:	48 89 e5             	mov    %rsp,%rbp
+  80048f:	53                   	push   %rbx
+  800490:	48 83 ec 08          	sub    $0x8,%rsp
+  800494:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800497:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b6:	48 85 c0             	test   %rax,%rax
+  8004b9:	7f 06                	jg     8004c1 <sys_env_set_pgfault_upcall+0x36>
+}
+  8004bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c1:	49 89 c0             	mov    %rax,%r8
+  8004c4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004c9:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8004d0:	00 00 00 
+  8004d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d8:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8004df:	00 00 00 
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  8004ee:	00 00 00 
+  8004f1:	41 ff d1             	call   *%r9
+
+00000000008004f4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004f4:	55                   	push   %rbp
+  8004f5:	48 89 e5             	mov    %rsp,%rbp
+  8004f8:	53                   	push   %rbx
+  8004f9:	89 f8                	mov    %edi,%eax
+  8004fb:	49 89 f1             	mov    %rsi,%r9
+  8004fe:	48 89 d3             	mov    %rdx,%rbx
+  800501:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800504:	49 63 f0             	movslq %r8d,%rsi
+  800507:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80050a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80050f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800512:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800518:	cd 30                	int    $0x30
+}
+  80051a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051e:	c9                   	leave
+  80051f:	c3                   	ret
+
+0000000000800520 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800520:	55                   	push   %rbp
+  800521:	48 89 e5             	mov    %rsp,%rbp
+  800524:	53                   	push   %rbx
+  800525:	48 83 ec 08          	sub    $0x8,%rsp
+  800529:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80052c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80052f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800534:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800537:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80053c:	be 00 00 00 00       	mov    $0x0,%esi
+  800541:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800547:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800549:	48 85 c0             	test   %rax,%rax
+  80054c:	7f 06                	jg     800554 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80054e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800552:	c9                   	leave
+  800553:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800554:	49 89 c0             	mov    %rax,%r8
+  800557:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80055c:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800563:	00 00 00 
+  800566:	be 26 00 00 00       	mov    $0x26,%esi
+  80056b:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800572:	00 00 00 
+  800575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057a:	49 b9 e7 24 80 00 00 	movabs $0x8024e7,%r9
+  800581:	00 00 00 
+  800584:	41 ff d1             	call   *%r9
+
+0000000000800587 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800587:	55                   	push   %rbp
+  800588:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80058b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800590:	48 b8 20 05 80 00 00 	movabs $0x800520,%rax
+  800597:	00 00 00 
+  80059a:	ff d0                	call   *%rax
+}
+  80059c:	5d                   	pop    %rbp
+  80059d:	c3                   	ret
+
+000000000080059e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80059e:	55                   	push   %rbp
+  80059f:	48 89 e5             	mov    %rsp,%rbp
+  8005a2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+
+00000000008005cf <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005cf:	55                   	push   %rbp
+  8005d0:	48 89 e5             	mov    %rsp,%rbp
+  8005d3:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005d4:	48 63 ce             	movslq %esi,%rcx
+  8005d7:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005db:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f5:	cd 30                	int    $0x30
+}
+  8005f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005fb:	c9                   	leave
+  8005fc:	c3                   	ret
+
+00000000008005fd <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8005fd:	55                   	push   %rbp
+  8005fe:	48 89 e5             	mov    %rsp,%rbp
+  800601:	53                   	push   %rbx
+  800602:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800605:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800609:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80060e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800613:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800618:	be 00 00 00 00       	mov    $0x0,%esi
+  80061d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800623:	cd 30                	int    $0x30
+}
+  800625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800629:	c9                   	leave
+  80062a:	c3                   	ret
+
+000000000080062b <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80062b:	55                   	push   %rbp
+  80062c:	48 89 e5             	mov    %rsp,%rbp
+  80062f:	53                   	push   %rbx
+  800630:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800633:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800636:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80063b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80063e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800643:	be 00 00 00 00       	mov    $0x0,%esi
+  800648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80064e:	cd 30                	int    $0x30
+}
+  800650:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800654:	c9                   	leave
+  800655:	c3                   	ret
+
+0000000000800656 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800656:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80065d:	ff ff ff 
+  800660:	48 01 f8             	add    %rdi,%rax
+  800663:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800667:	c3                   	ret
+
+0000000000800668 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800668:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80066f:	ff ff ff 
+  800672:	48 01 f8             	add    %rdi,%rax
+  800675:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800679:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80067f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800683:	c3                   	ret
+
+0000000000800684 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800684:	55                   	push   %rbp
+  800685:	48 89 e5             	mov    %rsp,%rbp
+  800688:	41 57                	push   %r15
+  80068a:	41 56                	push   %r14
+  80068c:	41 55                	push   %r13
+  80068e:	41 54                	push   %r12
+  800690:	53                   	push   %rbx
+  800691:	48 83 ec 08          	sub    $0x8,%rsp
+  800695:	49 89 ff             	mov    %rdi,%r15
+  800698:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80069d:	49 bd a3 21 80 00 00 	movabs $0x8021a3,%r13
+  8006a4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006a7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006ad:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b0:	48 89 df             	mov    %rbx,%rdi
+  8006b3:	41 ff d5             	call   *%r13
+  8006b6:	83 e0 04             	and    $0x4,%eax
+  8006b9:	74 17                	je     8006d2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006c2:	4c 39 f3             	cmp    %r14,%rbx
+  8006c5:	75 e6                	jne    8006ad <fd_alloc+0x29>
+  8006c7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006cd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006d2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006d5:	48 83 c4 08          	add    $0x8,%rsp
+  8006d9:	5b                   	pop    %rbx
+  8006da:	41 5c                	pop    %r12
+  8006dc:	41 5d                	pop    %r13
+  8006de:	41 5e                	pop    %r14
+  8006e0:	41 5f                	pop    %r15
+  8006e2:	5d                   	pop    %rbp
+  8006e3:	c3                   	ret
+
+00000000008006e4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e4:	83 ff 1f             	cmp    $0x1f,%edi
+  8006e7:	77 39                	ja     800722 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006e9:	55                   	push   %rbp
+  8006ea:	48 89 e5             	mov    %rsp,%rbp
+  8006ed:	41 54                	push   %r12
+  8006ef:	53                   	push   %rbx
+  8006f0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8006f3:	48 63 df             	movslq %edi,%rbx
+  8006f6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8006fd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800701:	48 89 df             	mov    %rbx,%rdi
+  800704:	48 b8 a3 21 80 00 00 	movabs $0x8021a3,%rax
+  80070b:	00 00 00 
+  80070e:	ff d0                	call   *%rax
+  800710:	a8 04                	test   $0x4,%al
+  800712:	74 14                	je     800728 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800714:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800718:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80071d:	5b                   	pop    %rbx
+  80071e:	41 5c                	pop    %r12
+  800720:	5d                   	pop    %rbp
+  800721:	c3                   	ret
+        return -E_INVAL;
+  800722:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800727:	c3                   	ret
+        return -E_INVAL;
+  800728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80072d:	eb ee                	jmp    80071d <fd_lookup+0x39>
+
+000000000080072f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80072f:	55                   	push   %rbp
+  800730:	48 89 e5             	mov    %rsp,%rbp
+  800733:	41 54                	push   %r12
+  800735:	53                   	push   %rbx
+  800736:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800739:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  800740:	00 00 00 
+  800743:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80074a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80074d:	39 3b                	cmp    %edi,(%rbx)
+  80074f:	74 47                	je     800798 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800751:	48 83 c0 08          	add    $0x8,%rax
+  800755:	48 8b 18             	mov    (%rax),%rbx
+  800758:	48 85 db             	test   %rbx,%rbx
+  80075b:	75 f0                	jne    80074d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80075d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800764:	00 00 00 
+  800767:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80076d:	89 fa                	mov    %edi,%edx
+  80076f:	48 bf b8 36 80 00 00 	movabs $0x8036b8,%rdi
+  800776:	00 00 00 
+  800779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077e:	48 b9 37 26 80 00 00 	movabs $0x802637,%rcx
+  800785:	00 00 00 
+  800788:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80078a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80078f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800793:	5b                   	pop    %rbx
+  800794:	41 5c                	pop    %r12
+  800796:	5d                   	pop    %rbp
+  800797:	c3                   	ret
+            return 0;
+  800798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079d:	eb f0                	jmp    80078f <dev_lookup+0x60>
+
+000000000080079f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80079f:	55                   	push   %rbp
+  8007a0:	48 89 e5             	mov    %rsp,%rbp
+  8007a3:	41 55                	push   %r13
+  8007a5:	41 54                	push   %r12
+  8007a7:	53                   	push   %rbx
+  8007a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8007ac:	48 89 fb             	mov    %rdi,%rbx
+  8007af:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007b2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007b9:	ff ff ff 
+  8007bc:	48 01 df             	add    %rbx,%rdi
+  8007bf:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007c3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007c7:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  8007ce:	00 00 00 
+  8007d1:	ff d0                	call   *%rax
+  8007d3:	41 89 c5             	mov    %eax,%r13d
+  8007d6:	85 c0                	test   %eax,%eax
+  8007d8:	78 06                	js     8007e0 <fd_close+0x41>
+  8007da:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007de:	74 1a                	je     8007fa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007e0:	45 84 e4             	test   %r12b,%r12b
+  8007e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007ec:	44 89 e8             	mov    %r13d,%eax
+  8007ef:	48 83 c4 18          	add    $0x18,%rsp
+  8007f3:	5b                   	pop    %rbx
+  8007f4:	41 5c                	pop    %r12
+  8007f6:	41 5d                	pop    %r13
+  8007f8:	5d                   	pop    %rbp
+  8007f9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007fa:	8b 3b                	mov    (%rbx),%edi
+  8007fc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800800:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800807:	00 00 00 
+  80080a:	ff d0                	call   *%rax
+  80080c:	41 89 c5             	mov    %eax,%r13d
+  80080f:	85 c0                	test   %eax,%eax
+  800811:	78 1b                	js     80082e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800813:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800817:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80081b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800821:	48 85 c0             	test   %rax,%rax
+  800824:	74 08                	je     80082e <fd_close+0x8f>
+  800826:	48 89 df             	mov    %rbx,%rdi
+  800829:	ff d0                	call   *%rax
+  80082b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80082e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800833:	48 89 de             	mov    %rbx,%rsi
+  800836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80083b:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  800842:	00 00 00 
+  800845:	ff d0                	call   *%rax
+    return res;
+  800847:	eb a3                	jmp    8007ec <fd_close+0x4d>
+
+0000000000800849 <close>:
+
+int
+close(int fdnum) {
+  800849:	55                   	push   %rbp
+  80084a:	48 89 e5             	mov    %rsp,%rbp
+  80084d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800851:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800855:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  80085c:	00 00 00 
+  80085f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800861:	85 c0                	test   %eax,%eax
+  800863:	78 15                	js     80087a <close+0x31>
+
+    return fd_close(fd, 1);
+  800865:	be 01 00 00 00       	mov    $0x1,%esi
+  80086a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80086e:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800875:	00 00 00 
+  800878:	ff d0                	call   *%rax
+}
+  80087a:	c9                   	leave
+  80087b:	c3                   	ret
+
+000000000080087c <close_all>:
+
+void
+close_all(void) {
+  80087c:	55                   	push   %rbp
+  80087d:	48 89 e5             	mov    %rsp,%rbp
+  800880:	41 54                	push   %r12
+  800882:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800883:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800888:	49 bc 49 08 80 00 00 	movabs $0x800849,%r12
+  80088f:	00 00 00 
+  800892:	89 df                	mov    %ebx,%edi
+  800894:	41 ff d4             	call   *%r12
+  800897:	83 c3 01             	add    $0x1,%ebx
+  80089a:	83 fb 20             	cmp    $0x20,%ebx
+  80089d:	75 f3                	jne    800892 <close_all+0x16>
+}
+  80089f:	5b                   	pop    %rbx
+  8008a0:	41 5c                	pop    %r12
+  8008a2:	5d                   	pop    %rbp
+  8008a3:	c3                   	ret
+
+00000000008008a4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008a4:	55                   	push   %rbp
+  8008a5:	48 89 e5             	mov    %rsp,%rbp
+  8008a8:	41 57                	push   %r15
+  8008aa:	41 56                	push   %r14
+  8008ac:	41 55                	push   %r13
+  8008ae:	41 54                	push   %r12
+  8008b0:	53                   	push   %rbx
+  8008b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8008b5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008b8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008bc:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  8008c3:	00 00 00 
+  8008c6:	ff d0                	call   *%rax
+  8008c8:	89 c3                	mov    %eax,%ebx
+  8008ca:	85 c0                	test   %eax,%eax
+  8008cc:	0f 88 b8 00 00 00    	js     80098a <dup+0xe6>
+    close(newfdnum);
+  8008d2:	44 89 e7             	mov    %r12d,%edi
+  8008d5:	48 b8 49 08 80 00 00 	movabs $0x800849,%rax
+  8008dc:	00 00 00 
+  8008df:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008e1:	4d 63 ec             	movslq %r12d,%r13
+  8008e4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008eb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8008ef:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8008f3:	4c 89 ff             	mov    %r15,%rdi
+  8008f6:	49 be 68 06 80 00 00 	movabs $0x800668,%r14
+  8008fd:	00 00 00 
+  800900:	41 ff d6             	call   *%r14
+  800903:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800906:	4c 89 ef             	mov    %r13,%rdi
+  800909:	41 ff d6             	call   *%r14
+  80090c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80090f:	48 89 df             	mov    %rbx,%rdi
+  800912:	48 b8 a3 21 80 00 00 	movabs $0x8021a3,%rax
+  800919:	00 00 00 
+  80091c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80091e:	a8 04                	test   $0x4,%al
+  800920:	74 2b                	je     80094d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800922:	41 89 c1             	mov    %eax,%r9d
+  800925:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80092b:	4c 89 f1             	mov    %r14,%rcx
+  80092e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800933:	48 89 de             	mov    %rbx,%rsi
+  800936:	bf 00 00 00 00       	mov    $0x0,%edi
+  80093b:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  800942:	00 00 00 
+  800945:	ff d0                	call   *%rax
+  800947:	89 c3                	mov    %eax,%ebx
+  800949:	85 c0                	test   %eax,%eax
+  80094b:	78 4e                	js     80099b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80094d:	4c 89 ff             	mov    %r15,%rdi
+  800950:	48 b8 a3 21 80 00 00 	movabs $0x8021a3,%rax
+  800957:	00 00 00 
+  80095a:	ff d0                	call   *%rax
+  80095c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80095f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800965:	4c 89 e9             	mov    %r13,%rcx
+  800968:	ba 00 00 00 00       	mov    $0x0,%edx
+  80096d:	4c 89 fe             	mov    %r15,%rsi
+  800970:	bf 00 00 00 00       	mov    $0x0,%edi
+  800975:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  80097c:	00 00 00 
+  80097f:	ff d0                	call   *%rax
+  800981:	89 c3                	mov    %eax,%ebx
+  800983:	85 c0                	test   %eax,%eax
+  800985:	78 14                	js     80099b <dup+0xf7>
+
+    return newfdnum;
+  800987:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80098a:	89 d8                	mov    %ebx,%eax
+  80098c:	48 83 c4 18          	add    $0x18,%rsp
+  800990:	5b                   	pop    %rbx
+  800991:	41 5c                	pop    %r12
+  800993:	41 5d                	pop    %r13
+  800995:	41 5e                	pop    %r14
+  800997:	41 5f                	pop    %r15
+  800999:	5d                   	pop    %rbp
+  80099a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80099b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009a0:	4c 89 ee             	mov    %r13,%rsi
+  8009a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a8:	49 bc 52 03 80 00 00 	movabs $0x800352,%r12
+  8009af:	00 00 00 
+  8009b2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009ba:	4c 89 f6             	mov    %r14,%rsi
+  8009bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c2:	41 ff d4             	call   *%r12
+    return res;
+  8009c5:	eb c3                	jmp    80098a <dup+0xe6>
+
+00000000008009c7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009c7:	55                   	push   %rbp
+  8009c8:	48 89 e5             	mov    %rsp,%rbp
+  8009cb:	41 56                	push   %r14
+  8009cd:	41 55                	push   %r13
+  8009cf:	41 54                	push   %r12
+  8009d1:	53                   	push   %rbx
+  8009d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8009d6:	89 fb                	mov    %edi,%ebx
+  8009d8:	49 89 f4             	mov    %rsi,%r12
+  8009db:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009de:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009e2:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  8009e9:	00 00 00 
+  8009ec:	ff d0                	call   *%rax
+  8009ee:	85 c0                	test   %eax,%eax
+  8009f0:	78 4c                	js     800a3e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8009f2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8009f6:	41 8b 3e             	mov    (%r14),%edi
+  8009f9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009fd:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800a04:	00 00 00 
+  800a07:	ff d0                	call   *%rax
+  800a09:	85 c0                	test   %eax,%eax
+  800a0b:	78 35                	js     800a42 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a0d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a11:	83 e0 03             	and    $0x3,%eax
+  800a14:	83 f8 01             	cmp    $0x1,%eax
+  800a17:	74 2d                	je     800a46 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a1d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a21:	48 85 c0             	test   %rax,%rax
+  800a24:	74 56                	je     800a7c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a26:	4c 89 ea             	mov    %r13,%rdx
+  800a29:	4c 89 e6             	mov    %r12,%rsi
+  800a2c:	4c 89 f7             	mov    %r14,%rdi
+  800a2f:	ff d0                	call   *%rax
+}
+  800a31:	48 83 c4 10          	add    $0x10,%rsp
+  800a35:	5b                   	pop    %rbx
+  800a36:	41 5c                	pop    %r12
+  800a38:	41 5d                	pop    %r13
+  800a3a:	41 5e                	pop    %r14
+  800a3c:	5d                   	pop    %rbp
+  800a3d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a3e:	48 98                	cltq
+  800a40:	eb ef                	jmp    800a31 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a42:	48 98                	cltq
+  800a44:	eb eb                	jmp    800a31 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a46:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a4d:	00 00 00 
+  800a50:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a56:	89 da                	mov    %ebx,%edx
+  800a58:	48 bf 19 37 80 00 00 	movabs $0x803719,%rdi
+  800a5f:	00 00 00 
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	48 b9 37 26 80 00 00 	movabs $0x802637,%rcx
+  800a6e:	00 00 00 
+  800a71:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a73:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a7a:	eb b5                	jmp    800a31 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a7c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a83:	eb ac                	jmp    800a31 <read+0x6a>
+
+0000000000800a85 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a85:	55                   	push   %rbp
+  800a86:	48 89 e5             	mov    %rsp,%rbp
+  800a89:	41 56                	push   %r14
+  800a8b:	41 55                	push   %r13
+  800a8d:	41 54                	push   %r12
+  800a8f:	53                   	push   %rbx
+  800a90:	48 83 ec 10          	sub    $0x10,%rsp
+  800a94:	89 fb                	mov    %edi,%ebx
+  800a96:	49 89 f4             	mov    %rsi,%r12
+  800a99:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a9c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800aa0:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  800aa7:	00 00 00 
+  800aaa:	ff d0                	call   *%rax
+  800aac:	85 c0                	test   %eax,%eax
+  800aae:	78 41                	js     800af1 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ab0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ab4:	41 8b 3e             	mov    (%r14),%edi
+  800ab7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800abb:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800ac2:	00 00 00 
+  800ac5:	ff d0                	call   *%rax
+  800ac7:	85 c0                	test   %eax,%eax
+  800ac9:	78 35                	js     800b00 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800acb:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800acf:	83 e0 03             	and    $0x3,%eax
+  800ad2:	83 f8 01             	cmp    $0x1,%eax
+  800ad5:	74 2d                	je     800b04 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800ad7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800adb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800adf:	48 85 c0             	test   %rax,%rax
+  800ae2:	74 56                	je     800b3a <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800ae4:	4c 89 ea             	mov    %r13,%rdx
+  800ae7:	4c 89 e6             	mov    %r12,%rsi
+  800aea:	4c 89 f7             	mov    %r14,%rdi
+  800aed:	ff d0                	call   *%rax
+  800aef:	eb 02                	jmp    800af3 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800af1:	48 98                	cltq
+}
+  800af3:	48 83 c4 10          	add    $0x10,%rsp
+  800af7:	5b                   	pop    %rbx
+  800af8:	41 5c                	pop    %r12
+  800afa:	41 5d                	pop    %r13
+  800afc:	41 5e                	pop    %r14
+  800afe:	5d                   	pop    %rbp
+  800aff:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b00:	48 98                	cltq
+  800b02:	eb ef                	jmp    800af3 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b04:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b0b:	00 00 00 
+  800b0e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b14:	89 da                	mov    %ebx,%edx
+  800b16:	48 bf d8 36 80 00 00 	movabs $0x8036d8,%rdi
+  800b1d:	00 00 00 
+  800b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b25:	48 b9 37 26 80 00 00 	movabs $0x802637,%rcx
+  800b2c:	00 00 00 
+  800b2f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b31:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b38:	eb b9                	jmp    800af3 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b3a:	4c 89 ea             	mov    %r13,%rdx
+  800b3d:	4c 89 e6             	mov    %r12,%rsi
+  800b40:	89 df                	mov    %ebx,%edi
+  800b42:	48 b8 c7 09 80 00 00 	movabs $0x8009c7,%rax
+  800b49:	00 00 00 
+  800b4c:	ff d0                	call   *%rax
+  800b4e:	eb a3                	jmp    800af3 <readmap+0x6e>
+
+0000000000800b50 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b50:	55                   	push   %rbp
+  800b51:	48 89 e5             	mov    %rsp,%rbp
+  800b54:	41 57                	push   %r15
+  800b56:	41 56                	push   %r14
+  800b58:	41 55                	push   %r13
+  800b5a:	41 54                	push   %r12
+  800b5c:	53                   	push   %rbx
+  800b5d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b61:	48 85 d2             	test   %rdx,%rdx
+  800b64:	74 54                	je     800bba <readn+0x6a>
+  800b66:	41 89 fd             	mov    %edi,%r13d
+  800b69:	49 89 f6             	mov    %rsi,%r14
+  800b6c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b74:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b79:	49 bf c7 09 80 00 00 	movabs $0x8009c7,%r15
+  800b80:	00 00 00 
+  800b83:	4c 89 e2             	mov    %r12,%rdx
+  800b86:	48 29 f2             	sub    %rsi,%rdx
+  800b89:	4c 01 f6             	add    %r14,%rsi
+  800b8c:	44 89 ef             	mov    %r13d,%edi
+  800b8f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b92:	85 c0                	test   %eax,%eax
+  800b94:	78 20                	js     800bb6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b96:	01 c3                	add    %eax,%ebx
+  800b98:	85 c0                	test   %eax,%eax
+  800b9a:	74 08                	je     800ba4 <readn+0x54>
+  800b9c:	48 63 f3             	movslq %ebx,%rsi
+  800b9f:	4c 39 e6             	cmp    %r12,%rsi
+  800ba2:	72 df                	jb     800b83 <readn+0x33>
+    }
+    return res;
+  800ba4:	48 63 c3             	movslq %ebx,%rax
+}
+  800ba7:	48 83 c4 08          	add    $0x8,%rsp
+  800bab:	5b                   	pop    %rbx
+  800bac:	41 5c                	pop    %r12
+  800bae:	41 5d                	pop    %r13
+  800bb0:	41 5e                	pop    %r14
+  800bb2:	41 5f                	pop    %r15
+  800bb4:	5d                   	pop    %rbp
+  800bb5:	c3                   	ret
+        if (inc < 0) return inc;
+  800bb6:	48 98                	cltq
+  800bb8:	eb ed                	jmp    800ba7 <readn+0x57>
+    int inc = 1, res = 0;
+  800bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bbf:	eb e3                	jmp    800ba4 <readn+0x54>
+
+0000000000800bc1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bc1:	55                   	push   %rbp
+  800bc2:	48 89 e5             	mov    %rsp,%rbp
+  800bc5:	41 56                	push   %r14
+  800bc7:	41 55                	push   %r13
+  800bc9:	41 54                	push   %r12
+  800bcb:	53                   	push   %rbx
+  800bcc:	48 83 ec 10          	sub    $0x10,%rsp
+  800bd0:	89 fb                	mov    %edi,%ebx
+  800bd2:	49 89 f4             	mov    %rsi,%r12
+  800bd5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bd8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bdc:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  800be3:	00 00 00 
+  800be6:	ff d0                	call   *%rax
+  800be8:	85 c0                	test   %eax,%eax
+  800bea:	78 47                	js     800c33 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bec:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bf0:	41 8b 3e             	mov    (%r14),%edi
+  800bf3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bf7:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800bfe:	00 00 00 
+  800c01:	ff d0                	call   *%rax
+  800c03:	85 c0                	test   %eax,%eax
+  800c05:	78 30                	js     800c37 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c07:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c0c:	74 2d                	je     800c3b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c12:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c16:	48 85 c0             	test   %rax,%rax
+  800c19:	74 56                	je     800c71 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c1b:	4c 89 ea             	mov    %r13,%rdx
+  800c1e:	4c 89 e6             	mov    %r12,%rsi
+  800c21:	4c 89 f7             	mov    %r14,%rdi
+  800c24:	ff d0                	call   *%rax
+}
+  800c26:	48 83 c4 10          	add    $0x10,%rsp
+  800c2a:	5b                   	pop    %rbx
+  800c2b:	41 5c                	pop    %r12
+  800c2d:	41 5d                	pop    %r13
+  800c2f:	41 5e                	pop    %r14
+  800c31:	5d                   	pop    %rbp
+  800c32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c33:	48 98                	cltq
+  800c35:	eb ef                	jmp    800c26 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c37:	48 98                	cltq
+  800c39:	eb eb                	jmp    800c26 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c42:	00 00 00 
+  800c45:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c4b:	89 da                	mov    %ebx,%edx
+  800c4d:	48 bf 35 37 80 00 00 	movabs $0x803735,%rdi
+  800c54:	00 00 00 
+  800c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5c:	48 b9 37 26 80 00 00 	movabs $0x802637,%rcx
+  800c63:	00 00 00 
+  800c66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c6f:	eb b5                	jmp    800c26 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c78:	eb ac                	jmp    800c26 <write+0x65>
+
+0000000000800c7a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c7a:	55                   	push   %rbp
+  800c7b:	48 89 e5             	mov    %rsp,%rbp
+  800c7e:	53                   	push   %rbx
+  800c7f:	48 83 ec 18          	sub    $0x18,%rsp
+  800c83:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c85:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c89:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  800c90:	00 00 00 
+  800c93:	ff d0                	call   *%rax
+  800c95:	85 c0                	test   %eax,%eax
+  800c97:	78 0c                	js     800ca5 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c9d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+0000000000800cab <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cab:	55                   	push   %rbp
+  800cac:	48 89 e5             	mov    %rsp,%rbp
+  800caf:	41 55                	push   %r13
+  800cb1:	41 54                	push   %r12
+  800cb3:	53                   	push   %rbx
+  800cb4:	48 83 ec 18          	sub    $0x18,%rsp
+  800cb8:	89 fb                	mov    %edi,%ebx
+  800cba:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cbd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cc1:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  800cc8:	00 00 00 
+  800ccb:	ff d0                	call   *%rax
+  800ccd:	85 c0                	test   %eax,%eax
+  800ccf:	78 38                	js     800d09 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cd1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cd5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cd9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cdd:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800ce4:	00 00 00 
+  800ce7:	ff d0                	call   *%rax
+  800ce9:	85 c0                	test   %eax,%eax
+  800ceb:	78 1c                	js     800d09 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ced:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cf2:	74 20                	je     800d14 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cf4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cf8:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800cfc:	48 85 c0             	test   %rax,%rax
+  800cff:	74 47                	je     800d48 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d01:	44 89 e6             	mov    %r12d,%esi
+  800d04:	4c 89 ef             	mov    %r13,%rdi
+  800d07:	ff d0                	call   *%rax
+}
+  800d09:	48 83 c4 18          	add    $0x18,%rsp
+  800d0d:	5b                   	pop    %rbx
+  800d0e:	41 5c                	pop    %r12
+  800d10:	41 5d                	pop    %r13
+  800d12:	5d                   	pop    %rbp
+  800d13:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d14:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d1b:	00 00 00 
+  800d1e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d24:	89 da                	mov    %ebx,%edx
+  800d26:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  800d2d:	00 00 00 
+  800d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d35:	48 b9 37 26 80 00 00 	movabs $0x802637,%rcx
+  800d3c:	00 00 00 
+  800d3f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d46:	eb c1                	jmp    800d09 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d4d:	eb ba                	jmp    800d09 <ftruncate+0x5e>
+
+0000000000800d4f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d4f:	55                   	push   %rbp
+  800d50:	48 89 e5             	mov    %rsp,%rbp
+  800d53:	41 54                	push   %r12
+  800d55:	53                   	push   %rbx
+  800d56:	48 83 ec 10          	sub    $0x10,%rsp
+  800d5a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d5d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d61:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  800d68:	00 00 00 
+  800d6b:	ff d0                	call   *%rax
+  800d6d:	85 c0                	test   %eax,%eax
+  800d6f:	78 4e                	js     800dbf <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d71:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d75:	41 8b 3c 24          	mov    (%r12),%edi
+  800d79:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d7d:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800d84:	00 00 00 
+  800d87:	ff d0                	call   *%rax
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	78 32                	js     800dbf <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d91:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800d96:	74 30                	je     800dc8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d98:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d9b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800da2:	00 00 00 
+    stat->st_isdir = 0;
+  800da5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dac:	00 00 00 
+    stat->st_dev = dev;
+  800daf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800db6:	48 89 de             	mov    %rbx,%rsi
+  800db9:	4c 89 e7             	mov    %r12,%rdi
+  800dbc:	ff 50 30             	call   *0x30(%rax)
+}
+  800dbf:	48 83 c4 10          	add    $0x10,%rsp
+  800dc3:	5b                   	pop    %rbx
+  800dc4:	41 5c                	pop    %r12
+  800dc6:	5d                   	pop    %rbp
+  800dc7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dc8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dcd:	eb f0                	jmp    800dbf <fstat+0x70>
+
+0000000000800dcf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dcf:	55                   	push   %rbp
+  800dd0:	48 89 e5             	mov    %rsp,%rbp
+  800dd3:	41 54                	push   %r12
+  800dd5:	53                   	push   %rbx
+  800dd6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dde:	48 b8 26 1b 80 00 00 	movabs $0x801b26,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+  800dea:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dec:	85 c0                	test   %eax,%eax
+  800dee:	78 25                	js     800e15 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800df0:	4c 89 e6             	mov    %r12,%rsi
+  800df3:	89 c7                	mov    %eax,%edi
+  800df5:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800dfc:	00 00 00 
+  800dff:	ff d0                	call   *%rax
+  800e01:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e04:	89 df                	mov    %ebx,%edi
+  800e06:	48 b8 49 08 80 00 00 	movabs $0x800849,%rax
+  800e0d:	00 00 00 
+  800e10:	ff d0                	call   *%rax
+
+    return res;
+  800e12:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e15:	89 d8                	mov    %ebx,%eax
+  800e17:	5b                   	pop    %rbx
+  800e18:	41 5c                	pop    %r12
+  800e1a:	5d                   	pop    %rbp
+  800e1b:	c3                   	ret
+
+0000000000800e1c <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e1c:	55                   	push   %rbp
+  800e1d:	48 89 e5             	mov    %rsp,%rbp
+  800e20:	41 54                	push   %r12
+  800e22:	53                   	push   %rbx
+  800e23:	48 83 ec 10          	sub    $0x10,%rsp
+  800e27:	48 89 fb             	mov    %rdi,%rbx
+  800e2a:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e2d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e31:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e36:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	78 1f                	js     800e65 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e4a:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e4e:	48 85 c0             	test   %rax,%rax
+  800e51:	74 1b                	je     800e6e <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e53:	4c 89 e6             	mov    %r12,%rsi
+  800e56:	48 89 df             	mov    %rbx,%rdi
+  800e59:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e5b:	85 c0                	test   %eax,%eax
+  800e5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e62:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e65:	48 83 c4 10          	add    $0x10,%rsp
+  800e69:	5b                   	pop    %rbx
+  800e6a:	41 5c                	pop    %r12
+  800e6c:	5d                   	pop    %rbp
+  800e6d:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e6e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e73:	eb f0                	jmp    800e65 <create_snapshot+0x49>
+
+0000000000800e75 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e75:	55                   	push   %rbp
+  800e76:	48 89 e5             	mov    %rsp,%rbp
+  800e79:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e7d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e81:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e86:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	78 1e                	js     800eb4 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800e96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e9a:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800e9e:	48 85 d2             	test   %rdx,%rdx
+  800ea1:	74 13                	je     800eb6 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea8:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800eb4:	c9                   	leave
+  800eb5:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eb6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ebb:	eb f7                	jmp    800eb4 <print_snapshot_list+0x3f>
+
+0000000000800ebd <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ebd:	55                   	push   %rbp
+  800ebe:	48 89 e5             	mov    %rsp,%rbp
+  800ec1:	53                   	push   %rbx
+  800ec2:	48 83 ec 18          	sub    $0x18,%rsp
+  800ec6:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ec9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ecd:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ed2:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800ed9:	00 00 00 
+  800edc:	ff d0                	call   *%rax
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	78 1c                	js     800efe <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800ee2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ee6:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800eea:	48 85 c0             	test   %rax,%rax
+  800eed:	74 15                	je     800f04 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800eef:	48 89 df             	mov    %rbx,%rdi
+  800ef2:	ff d0                	call   *%rax
+    if (res < 0) {
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800efe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f02:	c9                   	leave
+  800f03:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f04:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f09:	eb f3                	jmp    800efe <accept_snapshot+0x41>
+
+0000000000800f0b <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f0b:	55                   	push   %rbp
+  800f0c:	48 89 e5             	mov    %rsp,%rbp
+  800f0f:	53                   	push   %rbx
+  800f10:	48 83 ec 18          	sub    $0x18,%rsp
+  800f14:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f17:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f1b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f20:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+  800f2c:	85 c0                	test   %eax,%eax
+  800f2e:	78 1c                	js     800f4c <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f34:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f38:	48 85 c0             	test   %rax,%rax
+  800f3b:	74 15                	je     800f52 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f3d:	48 89 df             	mov    %rbx,%rdi
+  800f40:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f42:	85 c0                	test   %eax,%eax
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f50:	c9                   	leave
+  800f51:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f52:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f57:	eb f3                	jmp    800f4c <delete_snapshot+0x41>
+
+0000000000800f59 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f59:	55                   	push   %rbp
+  800f5a:	48 89 e5             	mov    %rsp,%rbp
+  800f5d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f61:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f65:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f6a:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800f71:	00 00 00 
+  800f74:	ff d0                	call   *%rax
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	78 14                	js     800f8e <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f7e:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f82:	48 85 d2             	test   %rdx,%rdx
+  800f85:	74 09                	je     800f90 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800f8e:	c9                   	leave
+  800f8f:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f90:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f95:	eb f7                	jmp    800f8e <gc_snapshots+0x35>
+
+0000000000800f97 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800f97:	55                   	push   %rbp
+  800f98:	48 89 e5             	mov    %rsp,%rbp
+  800f9b:	41 56                	push   %r14
+  800f9d:	41 55                	push   %r13
+  800f9f:	41 54                	push   %r12
+  800fa1:	53                   	push   %rbx
+  800fa2:	48 83 ec 10          	sub    $0x10,%rsp
+  800fa6:	48 89 fb             	mov    %rdi,%rbx
+  800fa9:	49 89 f4             	mov    %rsi,%r12
+  800fac:	49 89 d5             	mov    %rdx,%r13
+  800faf:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fb2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fb6:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fbb:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+  800fc7:	85 c0                	test   %eax,%eax
+  800fc9:	78 1b                	js     800fe6 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fcf:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fd3:	48 85 c0             	test   %rax,%rax
+  800fd6:	74 1b                	je     800ff3 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fd8:	4c 89 f1             	mov    %r14,%rcx
+  800fdb:	4c 89 ea             	mov    %r13,%rdx
+  800fde:	4c 89 e6             	mov    %r12,%rsi
+  800fe1:	48 89 df             	mov    %rbx,%rdi
+  800fe4:	ff d0                	call   *%rax
+
+    return res;
+}
+  800fe6:	48 83 c4 10          	add    $0x10,%rsp
+  800fea:	5b                   	pop    %rbx
+  800feb:	41 5c                	pop    %r12
+  800fed:	41 5d                	pop    %r13
+  800fef:	41 5e                	pop    %r14
+  800ff1:	5d                   	pop    %rbp
+  800ff2:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ff3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ff8:	eb ec                	jmp    800fe6 <diff_snapshots+0x4f>
+
+0000000000800ffa <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  800ffa:	55                   	push   %rbp
+  800ffb:	48 89 e5             	mov    %rsp,%rbp
+  800ffe:	41 55                	push   %r13
+  801000:	41 54                	push   %r12
+  801002:	53                   	push   %rbx
+  801003:	48 83 ec 18          	sub    $0x18,%rsp
+  801007:	48 89 fb             	mov    %rdi,%rbx
+  80100a:	49 89 f4             	mov    %rsi,%r12
+  80100d:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801010:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801014:	bf 66 00 00 00       	mov    $0x66,%edi
+  801019:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  801020:	00 00 00 
+  801023:	ff d0                	call   *%rax
+  801025:	85 c0                	test   %eax,%eax
+  801027:	78 18                	js     801041 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801029:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80102d:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801031:	48 85 c0             	test   %rax,%rax
+  801034:	74 16                	je     80104c <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801036:	4c 89 ea             	mov    %r13,%rdx
+  801039:	4c 89 e6             	mov    %r12,%rsi
+  80103c:	48 89 df             	mov    %rbx,%rdi
+  80103f:	ff d0                	call   *%rax
+
+    return res;
+}
+  801041:	48 83 c4 18          	add    $0x18,%rsp
+  801045:	5b                   	pop    %rbx
+  801046:	41 5c                	pop    %r12
+  801048:	41 5d                	pop    %r13
+  80104a:	5d                   	pop    %rbp
+  80104b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80104c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801051:	eb ee                	jmp    801041 <send_snapshot+0x47>
+
+0000000000801053 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801053:	55                   	push   %rbp
+  801054:	48 89 e5             	mov    %rsp,%rbp
+  801057:	53                   	push   %rbx
+  801058:	48 83 ec 18          	sub    $0x18,%rsp
+  80105c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80105f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801063:	bf 66 00 00 00       	mov    $0x66,%edi
+  801068:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  80106f:	00 00 00 
+  801072:	ff d0                	call   *%rax
+  801074:	85 c0                	test   %eax,%eax
+  801076:	78 12                	js     80108a <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801078:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80107c:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801080:	48 85 c0             	test   %rax,%rax
+  801083:	74 0b                	je     801090 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801085:	48 89 df             	mov    %rbx,%rdi
+  801088:	ff d0                	call   *%rax
+
+    return res;
+}
+  80108a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108e:	c9                   	leave
+  80108f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801090:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801095:	eb f3                	jmp    80108a <receive_snapshot+0x37>
+
+0000000000801097 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+  80109b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80109f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010a3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010a8:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  8010af:	00 00 00 
+  8010b2:	ff d0                	call   *%rax
+  8010b4:	85 c0                	test   %eax,%eax
+  8010b6:	78 17                	js     8010cf <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010bc:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010c3:	48 85 d2             	test   %rdx,%rdx
+  8010c6:	74 09                	je     8010d1 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cd:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010cf:	c9                   	leave
+  8010d0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010d1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010d6:	eb f7                	jmp    8010cf <free_space_bytes+0x38>
+
+00000000008010d8 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010d8:	55                   	push   %rbp
+  8010d9:	48 89 e5             	mov    %rsp,%rbp
+  8010dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010e4:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010e9:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  8010f0:	00 00 00 
+  8010f3:	ff d0                	call   *%rax
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	78 17                	js     801110 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8010f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010fd:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801104:	48 85 d2             	test   %rdx,%rdx
+  801107:	74 09                	je     801112 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110e:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801110:	c9                   	leave
+  801111:	c3                   	ret
+        return -E_NOT_SUPP;
+  801112:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801117:	eb f7                	jmp    801110 <busy_space_bytes+0x38>
+
+0000000000801119 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+  80111d:	41 54                	push   %r12
+  80111f:	53                   	push   %rbx
+  801120:	48 83 ec 10          	sub    $0x10,%rsp
+  801124:	89 fb                	mov    %edi,%ebx
+  801126:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801129:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80112d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801132:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+  80113e:	85 c0                	test   %eax,%eax
+  801140:	78 17                	js     801159 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  801142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801146:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80114d:	48 85 c0             	test   %rax,%rax
+  801150:	74 10                	je     801162 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  801152:	4c 89 e6             	mov    %r12,%rsi
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801159:	48 83 c4 10          	add    $0x10,%rsp
+  80115d:	5b                   	pop    %rbx
+  80115e:	41 5c                	pop    %r12
+  801160:	5d                   	pop    %rbp
+  801161:	c3                   	ret
+        return -E_NOT_SUPP;
+  801162:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801167:	eb f0                	jmp    801159 <snapshots_space+0x40>
+
+0000000000801169 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801169:	55                   	push   %rbp
+  80116a:	48 89 e5             	mov    %rsp,%rbp
+  80116d:	41 55                	push   %r13
+  80116f:	41 54                	push   %r12
+  801171:	53                   	push   %rbx
+  801172:	48 83 ec 08          	sub    $0x8,%rsp
+  801176:	41 89 fd             	mov    %edi,%r13d
+  801179:	48 89 f3             	mov    %rsi,%rbx
+  80117c:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80117f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801186:	00 00 00 
+  801189:	83 38 00             	cmpl   $0x0,(%rax)
+  80118c:	74 57                	je     8011e5 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80118e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801194:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801199:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011a0:	00 00 00 
+  8011a3:	44 89 ee             	mov    %r13d,%esi
+  8011a6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011ad:	00 00 00 
+  8011b0:	8b 38                	mov    (%rax),%edi
+  8011b2:	48 b8 5e 35 80 00 00 	movabs $0x80355e,%rax
+  8011b9:	00 00 00 
+  8011bc:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c3:	4c 89 e2             	mov    %r12,%rdx
+  8011c6:	48 89 de             	mov    %rbx,%rsi
+  8011c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011ce:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  8011d5:	00 00 00 
+  8011d8:	ff d0                	call   *%rax
+}
+  8011da:	48 83 c4 08          	add    $0x8,%rsp
+  8011de:	5b                   	pop    %rbx
+  8011df:	41 5c                	pop    %r12
+  8011e1:	41 5d                	pop    %r13
+  8011e3:	5d                   	pop    %rbp
+  8011e4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011ea:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  8011f1:	00 00 00 
+  8011f4:	ff d0                	call   *%rax
+  8011f6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8011fd:	00 00 
+  8011ff:	eb 8d                	jmp    80118e <fsipc_region+0x25>
+
+0000000000801201 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801209:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801210:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801211:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801215:	48 b8 69 11 80 00 00 	movabs $0x801169,%rax
+  80121c:	00 00 00 
+  80121f:	ff d0                	call   *%rax
+}
+  801221:	c9                   	leave
+  801222:	c3                   	ret
+
+0000000000801223 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801223:	85 ff                	test   %edi,%edi
+  801225:	78 6d                	js     801294 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801227:	55                   	push   %rbp
+  801228:	48 89 e5             	mov    %rsp,%rbp
+  80122b:	41 54                	push   %r12
+  80122d:	53                   	push   %rbx
+  80122e:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801231:	48 85 f6             	test   %rsi,%rsi
+  801234:	74 57                	je     80128d <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801236:	89 f8                	mov    %edi,%eax
+  801238:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80123f:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801241:	be 00 00 00 00       	mov    $0x0,%esi
+  801246:	bf 12 00 00 00       	mov    $0x12,%edi
+  80124b:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801252:	00 00 00 
+  801255:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801257:	85 c0                	test   %eax,%eax
+  801259:	78 2d                	js     801288 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80125b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801262:	00 00 00 
+  801265:	49 63 14 24          	movslq (%r12),%rdx
+  801269:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  801270:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  801275:	48 89 df             	mov    %rbx,%rdi
+  801278:	48 b8 56 31 80 00 00 	movabs $0x803156,%rax
+  80127f:	00 00 00 
+  801282:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  801284:	41 8b 04 24          	mov    (%r12),%eax
+}
+  801288:	5b                   	pop    %rbx
+  801289:	41 5c                	pop    %r12
+  80128b:	5d                   	pop    %rbp
+  80128c:	c3                   	ret
+        return -E_INVAL;
+  80128d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801292:	eb f4                	jmp    801288 <devfile_df_snapshots+0x65>
+  801294:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801299:	c3                   	ret
+
+000000000080129a <devfile_df_busy>:
+devfile_df_busy() {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012a8:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+}
+  8012b4:	5d                   	pop    %rbp
+  8012b5:	c3                   	ret
+
+00000000008012b6 <devfile_df_free>:
+devfile_df_free() {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012c4:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8012cb:	00 00 00 
+  8012ce:	ff d0                	call   *%rax
+}
+  8012d0:	5d                   	pop    %rbp
+  8012d1:	c3                   	ret
+
+00000000008012d2 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012e0:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8012e7:	00 00 00 
+  8012ea:	ff d0                	call   *%rax
+}
+  8012ec:	5d                   	pop    %rbp
+  8012ed:	c3                   	ret
+
+00000000008012ee <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8012ee:	55                   	push   %rbp
+  8012ef:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8012f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8012fc:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801303:	00 00 00 
+  801306:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801312:	5d                   	pop    %rbp
+  801313:	c3                   	ret
+
+0000000000801314 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801314:	55                   	push   %rbp
+  801315:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801318:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80131f:	00 00 00 
+  801322:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801325:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801327:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+  80132f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801334:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80133b:	00 00 00 
+  80133e:	ff d0                	call   *%rax
+}
+  801340:	5d                   	pop    %rbp
+  801341:	c3                   	ret
+
+0000000000801342 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801342:	55                   	push   %rbp
+  801343:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801346:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801349:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801350:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801352:	be 00 00 00 00       	mov    $0x0,%esi
+  801357:	bf 06 00 00 00       	mov    $0x6,%edi
+  80135c:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801363:	00 00 00 
+  801366:	ff d0                	call   *%rax
+}
+  801368:	5d                   	pop    %rbp
+  801369:	c3                   	ret
+
+000000000080136a <devfile_write>:
+    if (!fd || !buf) {
+  80136a:	48 85 ff             	test   %rdi,%rdi
+  80136d:	0f 84 c1 00 00 00    	je     801434 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801373:	55                   	push   %rbp
+  801374:	48 89 e5             	mov    %rsp,%rbp
+  801377:	41 57                	push   %r15
+  801379:	41 56                	push   %r14
+  80137b:	41 55                	push   %r13
+  80137d:	41 54                	push   %r12
+  80137f:	53                   	push   %rbx
+  801380:	48 83 ec 18          	sub    $0x18,%rsp
+  801384:	49 89 ff             	mov    %rdi,%r15
+  801387:	49 89 f5             	mov    %rsi,%r13
+  80138a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80138d:	48 85 f6             	test   %rsi,%rsi
+  801390:	0f 84 95 00 00 00    	je     80142b <devfile_write+0xc1>
+    while (n) {
+  801396:	48 85 d2             	test   %rdx,%rdx
+  801399:	0f 84 83 00 00 00    	je     801422 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80139f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013a6:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013ad:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013b0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013b5:	49 39 dc             	cmp    %rbx,%r12
+  8013b8:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013bc:	48 89 da             	mov    %rbx,%rdx
+  8013bf:	4c 89 ee             	mov    %r13,%rsi
+  8013c2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013c9:	00 00 00 
+  8013cc:	48 b8 56 31 80 00 00 	movabs $0x803156,%rax
+  8013d3:	00 00 00 
+  8013d6:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013d8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013dc:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013df:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013ed:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8013f4:	00 00 00 
+  8013f7:	ff d0                	call   *%rax
+        if (write < 0) {
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	78 21                	js     80141e <devfile_write+0xb4>
+        buf += write;
+  8013fd:	48 63 d0             	movslq %eax,%rdx
+  801400:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801403:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801406:	49 29 d4             	sub    %rdx,%r12
+  801409:	75 a5                	jne    8013b0 <devfile_write+0x46>
+    return totalWrite;
+  80140b:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80140f:	48 83 c4 18          	add    $0x18,%rsp
+  801413:	5b                   	pop    %rbx
+  801414:	41 5c                	pop    %r12
+  801416:	41 5d                	pop    %r13
+  801418:	41 5e                	pop    %r14
+  80141a:	41 5f                	pop    %r15
+  80141c:	5d                   	pop    %rbp
+  80141d:	c3                   	ret
+            return write;
+  80141e:	48 98                	cltq
+  801420:	eb ed                	jmp    80140f <devfile_write+0xa5>
+    int totalWrite = 0;
+  801422:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801429:	eb e0                	jmp    80140b <devfile_write+0xa1>
+        return -E_INVAL;
+  80142b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801432:	eb db                	jmp    80140f <devfile_write+0xa5>
+  801434:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80143b:	c3                   	ret
+
+000000000080143c <devfile_read>:
+    if (!fd || !buf) {
+  80143c:	48 85 ff             	test   %rdi,%rdi
+  80143f:	0f 84 c0 00 00 00    	je     801505 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801445:	55                   	push   %rbp
+  801446:	48 89 e5             	mov    %rsp,%rbp
+  801449:	41 57                	push   %r15
+  80144b:	41 56                	push   %r14
+  80144d:	41 55                	push   %r13
+  80144f:	41 54                	push   %r12
+  801451:	53                   	push   %rbx
+  801452:	48 83 ec 18          	sub    $0x18,%rsp
+  801456:	49 89 ff             	mov    %rdi,%r15
+  801459:	49 89 f5             	mov    %rsi,%r13
+  80145c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80145f:	48 85 f6             	test   %rsi,%rsi
+  801462:	0f 84 96 00 00 00    	je     8014fe <devfile_read+0xc2>
+    while (n) {
+  801468:	48 85 d2             	test   %rdx,%rdx
+  80146b:	0f 84 87 00 00 00    	je     8014f8 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  801471:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801478:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801479:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801480:	00 00 00 
+  801483:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801487:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80148a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80148f:	49 39 c4             	cmp    %rax,%r12
+  801492:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  801496:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80149a:	be 00 00 00 00       	mov    $0x0,%esi
+  80149f:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014a4:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8014ab:	00 00 00 
+  8014ae:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	7e 37                	jle    8014eb <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014b4:	48 63 d8             	movslq %eax,%rbx
+  8014b7:	48 89 da             	mov    %rbx,%rdx
+  8014ba:	4c 89 f6             	mov    %r14,%rsi
+  8014bd:	4c 89 ef             	mov    %r13,%rdi
+  8014c0:	48 b8 56 31 80 00 00 	movabs $0x803156,%rax
+  8014c7:	00 00 00 
+  8014ca:	ff d0                	call   *%rax
+        buf += read;
+  8014cc:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014cf:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014d3:	49 29 dc             	sub    %rbx,%r12
+  8014d6:	75 ab                	jne    801483 <devfile_read+0x47>
+  return totalRead;
+  8014d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014dc:	48 83 c4 18          	add    $0x18,%rsp
+  8014e0:	5b                   	pop    %rbx
+  8014e1:	41 5c                	pop    %r12
+  8014e3:	41 5d                	pop    %r13
+  8014e5:	41 5e                	pop    %r14
+  8014e7:	41 5f                	pop    %r15
+  8014e9:	5d                   	pop    %rbp
+  8014ea:	c3                   	ret
+            return read ? read : totalRead;
+  8014eb:	48 63 d0             	movslq %eax,%rdx
+  8014ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014f2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8014f6:	eb e4                	jmp    8014dc <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8014f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8014fc:	eb da                	jmp    8014d8 <devfile_read+0x9c>
+        return E_INVAL;
+  8014fe:	b8 03 00 00 00       	mov    $0x3,%eax
+  801503:	eb d7                	jmp    8014dc <devfile_read+0xa0>
+  801505:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80150a:	c3                   	ret
+
+000000000080150b <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80150b:	48 85 ff             	test   %rdi,%rdi
+  80150e:	74 5f                	je     80156f <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801510:	55                   	push   %rbp
+  801511:	48 89 e5             	mov    %rsp,%rbp
+  801514:	53                   	push   %rbx
+  801515:	48 83 ec 08          	sub    $0x8,%rsp
+  801519:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80151c:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  801523:	00 00 00 
+  801526:	ff d0                	call   *%rax
+  801528:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80152e:	77 45                	ja     801575 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801530:	48 89 de             	mov    %rbx,%rsi
+  801533:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80153a:	00 00 00 
+  80153d:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  801544:	00 00 00 
+  801547:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801553:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80155a:	00 00 00 
+  80155d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	ba 00 00 00 00       	mov    $0x0,%edx
+  801566:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156d:	c9                   	leave
+  80156e:	c3                   	ret
+        return -E_INVAL;
+  80156f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801574:	c3                   	ret
+        return -E_INVAL;
+  801575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157a:	eb ed                	jmp    801569 <devfile_receive_snapshot+0x5e>
+
+000000000080157c <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	41 55                	push   %r13
+  801582:	41 54                	push   %r12
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+  801589:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80158c:	48 85 f6             	test   %rsi,%rsi
+  80158f:	0f 94 c0             	sete   %al
+  801592:	48 85 d2             	test   %rdx,%rdx
+  801595:	0f 94 c2             	sete   %dl
+  801598:	08 d0                	or     %dl,%al
+  80159a:	0f 85 ad 00 00 00    	jne    80164d <devfile_send_snapshot+0xd1>
+  8015a0:	48 89 fb             	mov    %rdi,%rbx
+  8015a3:	49 89 f4             	mov    %rsi,%r12
+  8015a6:	48 85 ff             	test   %rdi,%rdi
+  8015a9:	0f 84 9e 00 00 00    	je     80164d <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015af:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8015b6:	00 00 00 
+  8015b9:	ff d0                	call   *%rax
+  8015bb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015c1:	0f 87 8d 00 00 00    	ja     801654 <devfile_send_snapshot+0xd8>
+  8015c7:	4c 89 e7             	mov    %r12,%rdi
+  8015ca:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8015d1:	00 00 00 
+  8015d4:	ff d0                	call   *%rax
+  8015d6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015dc:	77 7d                	ja     80165b <devfile_send_snapshot+0xdf>
+  8015de:	4c 89 ef             	mov    %r13,%rdi
+  8015e1:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+  8015ed:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8015f3:	77 6d                	ja     801662 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8015f5:	48 89 de             	mov    %rbx,%rsi
+  8015f8:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8015ff:	00 00 00 
+  801602:	48 bb 5c 2f 80 00 00 	movabs $0x802f5c,%rbx
+  801609:	00 00 00 
+  80160c:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80160e:	4c 89 e6             	mov    %r12,%rsi
+  801611:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801618:	00 00 00 
+  80161b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80161d:	4c 89 ee             	mov    %r13,%rsi
+  801620:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801627:	00 00 00 
+  80162a:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  80162c:	be 00 00 00 00       	mov    $0x0,%esi
+  801631:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801636:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80163d:	00 00 00 
+  801640:	ff d0                	call   *%rax
+}
+  801642:	48 83 c4 08          	add    $0x8,%rsp
+  801646:	5b                   	pop    %rbx
+  801647:	41 5c                	pop    %r12
+  801649:	41 5d                	pop    %r13
+  80164b:	5d                   	pop    %rbp
+  80164c:	c3                   	ret
+        return -E_INVAL;
+  80164d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801652:	eb ee                	jmp    801642 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801654:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801659:	eb e7                	jmp    801642 <devfile_send_snapshot+0xc6>
+  80165b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801660:	eb e0                	jmp    801642 <devfile_send_snapshot+0xc6>
+  801662:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801667:	eb d9                	jmp    801642 <devfile_send_snapshot+0xc6>
+
+0000000000801669 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801669:	48 85 ff             	test   %rdi,%rdi
+  80166c:	0f 84 41 01 00 00    	je     8017b3 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+  801676:	41 57                	push   %r15
+  801678:	41 56                	push   %r14
+  80167a:	41 55                	push   %r13
+  80167c:	41 54                	push   %r12
+  80167e:	53                   	push   %rbx
+  80167f:	48 83 ec 08          	sub    $0x8,%rsp
+  801683:	49 89 fc             	mov    %rdi,%r12
+  801686:	49 89 f5             	mov    %rsi,%r13
+  801689:	48 89 d3             	mov    %rdx,%rbx
+  80168c:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80168f:	48 85 f6             	test   %rsi,%rsi
+  801692:	0f 84 ff 00 00 00    	je     801797 <devfile_diff_snapshots+0x12e>
+  801698:	48 85 d2             	test   %rdx,%rdx
+  80169b:	0f 84 fd 00 00 00    	je     80179e <devfile_diff_snapshots+0x135>
+  8016a1:	48 85 c9             	test   %rcx,%rcx
+  8016a4:	0f 84 f4 00 00 00    	je     80179e <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016aa:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8016b1:	00 00 00 
+  8016b4:	ff d0                	call   *%rax
+  8016b6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016bc:	0f 87 e3 00 00 00    	ja     8017a5 <devfile_diff_snapshots+0x13c>
+  8016c2:	4c 89 ef             	mov    %r13,%rdi
+  8016c5:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8016cc:	00 00 00 
+  8016cf:	ff d0                	call   *%rax
+  8016d1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d7:	0f 87 cf 00 00 00    	ja     8017ac <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016dd:	4c 89 e6             	mov    %r12,%rsi
+  8016e0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016e7:	00 00 00 
+  8016ea:	4c 89 e7             	mov    %r12,%rdi
+  8016ed:	49 bf 5c 2f 80 00 00 	movabs $0x802f5c,%r15
+  8016f4:	00 00 00 
+  8016f7:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8016fa:	4c 89 ee             	mov    %r13,%rsi
+  8016fd:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801704:	00 
+  801705:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801708:	48 8b 03             	mov    (%rbx),%rax
+  80170b:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801712:	00 
+  801713:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801717:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80171e:	00 
+  80171f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801723:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80172a:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801735:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 43                	js     801788 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801745:	49 8b 04 24          	mov    (%r12),%rax
+  801749:	48 89 03             	mov    %rax,(%rbx)
+  80174c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801751:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801755:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80175a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80175e:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801763:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801767:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80176b:	48 c1 e2 03          	shl    $0x3,%rdx
+  80176f:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801774:	4c 89 f7             	mov    %r14,%rdi
+  801777:	48 b8 56 31 80 00 00 	movabs $0x803156,%rax
+  80177e:	00 00 00 
+  801781:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  801783:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  801788:	48 83 c4 08          	add    $0x8,%rsp
+  80178c:	5b                   	pop    %rbx
+  80178d:	41 5c                	pop    %r12
+  80178f:	41 5d                	pop    %r13
+  801791:	41 5e                	pop    %r14
+  801793:	41 5f                	pop    %r15
+  801795:	5d                   	pop    %rbp
+  801796:	c3                   	ret
+        return -E_INVAL;
+  801797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179c:	eb ea                	jmp    801788 <devfile_diff_snapshots+0x11f>
+  80179e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a3:	eb e3                	jmp    801788 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017aa:	eb dc                	jmp    801788 <devfile_diff_snapshots+0x11f>
+  8017ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b1:	eb d5                	jmp    801788 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017b8:	c3                   	ret
+
+00000000008017b9 <devfile_delete_snapshot>:
+    if (!name) {
+  8017b9:	48 85 ff             	test   %rdi,%rdi
+  8017bc:	74 5f                	je     80181d <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017be:	55                   	push   %rbp
+  8017bf:	48 89 e5             	mov    %rsp,%rbp
+  8017c2:	53                   	push   %rbx
+  8017c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017ca:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8017d1:	00 00 00 
+  8017d4:	ff d0                	call   *%rax
+  8017d6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017dc:	77 45                	ja     801823 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017de:	48 89 de             	mov    %rbx,%rsi
+  8017e1:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017e8:	00 00 00 
+  8017eb:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  8017f2:	00 00 00 
+  8017f5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8017f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017fc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801801:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801814:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801817:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+        return -E_INVAL;
+  80181d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801822:	c3                   	ret
+        return -E_INVAL;
+  801823:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801828:	eb ed                	jmp    801817 <devfile_delete_snapshot+0x5e>
+
+000000000080182a <devfile_accept_snapshot>:
+    if (!name) {
+  80182a:	48 85 ff             	test   %rdi,%rdi
+  80182d:	74 5f                	je     80188e <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	53                   	push   %rbx
+  801834:	48 83 ec 08          	sub    $0x8,%rsp
+  801838:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80183b:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  801842:	00 00 00 
+  801845:	ff d0                	call   *%rax
+  801847:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80184d:	77 45                	ja     801894 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80184f:	48 89 de             	mov    %rbx,%rsi
+  801852:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801859:	00 00 00 
+  80185c:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  801863:	00 00 00 
+  801866:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801868:	be 00 00 00 00       	mov    $0x0,%esi
+  80186d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801872:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801879:	00 00 00 
+  80187c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	ba 00 00 00 00       	mov    $0x0,%edx
+  801885:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801888:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188c:	c9                   	leave
+  80188d:	c3                   	ret
+        return -E_INVAL;
+  80188e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801893:	c3                   	ret
+        return -E_INVAL;
+  801894:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801899:	eb ed                	jmp    801888 <devfile_accept_snapshot+0x5e>
+
+000000000080189b <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80189b:	48 85 ff             	test   %rdi,%rdi
+  80189e:	0f 84 9f 00 00 00    	je     801943 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018a4:	55                   	push   %rbp
+  8018a5:	48 89 e5             	mov    %rsp,%rbp
+  8018a8:	41 54                	push   %r12
+  8018aa:	53                   	push   %rbx
+  8018ab:	48 89 fb             	mov    %rdi,%rbx
+  8018ae:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018b1:	48 85 f6             	test   %rsi,%rsi
+  8018b4:	74 78                	je     80192e <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018b6:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+  8018c2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018c8:	77 6b                	ja     801935 <devfile_create_snapshot+0x9a>
+  8018ca:	4c 89 e7             	mov    %r12,%rdi
+  8018cd:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+  8018d9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018df:	77 5b                	ja     80193c <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018e1:	48 89 de             	mov    %rbx,%rsi
+  8018e4:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018eb:	00 00 00 
+  8018ee:	48 bb 5c 2f 80 00 00 	movabs $0x802f5c,%rbx
+  8018f5:	00 00 00 
+  8018f8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8018fa:	4c 89 e6             	mov    %r12,%rsi
+  8018fd:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801904:	00 00 00 
+  801907:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801909:	be 00 00 00 00       	mov    $0x0,%esi
+  80190e:	bf 08 00 00 00       	mov    $0x8,%edi
+  801913:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80191a:	00 00 00 
+  80191d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	ba 00 00 00 00       	mov    $0x0,%edx
+  801926:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801929:	5b                   	pop    %rbx
+  80192a:	41 5c                	pop    %r12
+  80192c:	5d                   	pop    %rbp
+  80192d:	c3                   	ret
+        return -E_INVAL;
+  80192e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801933:	eb f4                	jmp    801929 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801935:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193a:	eb ed                	jmp    801929 <devfile_create_snapshot+0x8e>
+  80193c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801941:	eb e6                	jmp    801929 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801943:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801948:	c3                   	ret
+
+0000000000801949 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801949:	55                   	push   %rbp
+  80194a:	48 89 e5             	mov    %rsp,%rbp
+  80194d:	41 54                	push   %r12
+  80194f:	53                   	push   %rbx
+  801950:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801953:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801956:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80195d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80195f:	be 00 00 00 00       	mov    $0x0,%esi
+  801964:	bf 05 00 00 00       	mov    $0x5,%edi
+  801969:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801970:	00 00 00 
+  801973:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801975:	85 c0                	test   %eax,%eax
+  801977:	78 3d                	js     8019b6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801979:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801980:	00 00 00 
+  801983:	4c 89 e6             	mov    %r12,%rsi
+  801986:	48 89 df             	mov    %rbx,%rdi
+  801989:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  801990:	00 00 00 
+  801993:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801995:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80199c:	00 
+  80199d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019a3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019aa:	00 
+  8019ab:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	5d                   	pop    %rbp
+  8019ba:	c3                   	ret
+
+00000000008019bb <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+  8019bf:	41 57                	push   %r15
+  8019c1:	41 56                	push   %r14
+  8019c3:	41 55                	push   %r13
+  8019c5:	41 54                	push   %r12
+  8019c7:	53                   	push   %rbx
+  8019c8:	48 83 ec 38          	sub    $0x38,%rsp
+  8019cc:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019d0:	49 89 f5             	mov    %rsi,%r13
+  8019d3:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019d6:	48 89 f0             	mov    %rsi,%rax
+  8019d9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019de:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019e2:	75 4f                	jne    801a33 <devfile_readmap+0x78>
+  8019e4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019e8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8019ee:	75 1f                	jne    801a0f <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8019f0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019f4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8019f8:	49 be a3 21 80 00 00 	movabs $0x8021a3,%r14
+  8019ff:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a02:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a09:	0f 87 9d 00 00 00    	ja     801aac <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a0f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a13:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a17:	4d 85 ff             	test   %r15,%r15
+  801a1a:	0f 85 cf 00 00 00    	jne    801aef <devfile_readmap+0x134>
+  801a20:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a24:	48 83 c4 38          	add    $0x38,%rsp
+  801a28:	5b                   	pop    %rbx
+  801a29:	41 5c                	pop    %r12
+  801a2b:	41 5d                	pop    %r13
+  801a2d:	41 5e                	pop    %r14
+  801a2f:	41 5f                	pop    %r15
+  801a31:	5d                   	pop    %rbp
+  801a32:	c3                   	ret
+    size_t totalRead = 0;
+  801a33:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a3a:	00 
+  801a3b:	eb da                	jmp    801a17 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a3d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a41:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a44:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a4b:	00 00 00 
+  801a4e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a54:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a58:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a5c:	4c 89 ee             	mov    %r13,%rsi
+  801a5f:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a64:	48 b8 69 11 80 00 00 	movabs $0x801169,%rax
+  801a6b:	00 00 00 
+  801a6e:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	7e a3                	jle    801a17 <devfile_readmap+0x5c>
+  801a74:	48 98                	cltq
+  801a76:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a7a:	72 9b                	jb     801a17 <devfile_readmap+0x5c>
+        buf += read;
+  801a7c:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a7f:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a82:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a86:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801a8d:	75 88                	jne    801a17 <devfile_readmap+0x5c>
+  801a8f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a93:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a99:	0f 85 78 ff ff ff    	jne    801a17 <devfile_readmap+0x5c>
+  801a9f:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aa6:	0f 86 6b ff ff ff    	jbe    801a17 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801aac:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801ab2:	4d 39 e7             	cmp    %r12,%r15
+  801ab5:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ab9:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801ac0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ac4:	0f 84 73 ff ff ff    	je     801a3d <devfile_readmap+0x82>
+  801aca:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ace:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801ad3:	41 ff d6             	call   *%r14
+  801ad6:	a8 40                	test   $0x40,%al
+  801ad8:	0f 85 39 ff ff ff    	jne    801a17 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ade:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ae5:	4c 39 e3             	cmp    %r12,%rbx
+  801ae8:	72 e4                	jb     801ace <devfile_readmap+0x113>
+  801aea:	e9 4e ff ff ff       	jmp    801a3d <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801aef:	4c 89 fa             	mov    %r15,%rdx
+  801af2:	4c 89 ee             	mov    %r13,%rsi
+  801af5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801af9:	48 b8 3c 14 80 00 00 	movabs $0x80143c,%rax
+  801b00:	00 00 00 
+  801b03:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b05:	48 85 c0             	test   %rax,%rax
+  801b08:	78 0c                	js     801b16 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b0a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b0e:	48 01 f0             	add    %rsi,%rax
+  801b11:	e9 0e ff ff ff       	jmp    801a24 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b16:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b1a:	48 85 f6             	test   %rsi,%rsi
+  801b1d:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b21:	e9 fe fe ff ff       	jmp    801a24 <devfile_readmap+0x69>
+
+0000000000801b26 <open>:
+open(const char *path, int mode) {
+  801b26:	55                   	push   %rbp
+  801b27:	48 89 e5             	mov    %rsp,%rbp
+  801b2a:	41 55                	push   %r13
+  801b2c:	41 54                	push   %r12
+  801b2e:	53                   	push   %rbx
+  801b2f:	48 83 ec 18          	sub    $0x18,%rsp
+  801b33:	49 89 fc             	mov    %rdi,%r12
+  801b36:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b39:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  801b40:	00 00 00 
+  801b43:	ff d0                	call   *%rax
+  801b45:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b4b:	0f 87 8a 00 00 00    	ja     801bdb <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b51:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b55:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+  801b61:	89 c3                	mov    %eax,%ebx
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	78 50                	js     801bb7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b67:	4c 89 e6             	mov    %r12,%rsi
+  801b6a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b71:	00 00 00 
+  801b74:	48 89 df             	mov    %rbx,%rdi
+  801b77:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b83:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b8a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801b8e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b93:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801b9a:	00 00 00 
+  801b9d:	ff d0                	call   *%rax
+  801b9f:	89 c3                	mov    %eax,%ebx
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 1f                	js     801bc4 <open+0x9e>
+    return fd2num(fd);
+  801ba5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ba9:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	89 c3                	mov    %eax,%ebx
+}
+  801bb7:	89 d8                	mov    %ebx,%eax
+  801bb9:	48 83 c4 18          	add    $0x18,%rsp
+  801bbd:	5b                   	pop    %rbx
+  801bbe:	41 5c                	pop    %r12
+  801bc0:	41 5d                	pop    %r13
+  801bc2:	5d                   	pop    %rbp
+  801bc3:	c3                   	ret
+        fd_close(fd, 0);
+  801bc4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bcd:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+        return res;
+  801bd9:	eb dc                	jmp    801bb7 <open+0x91>
+        return -E_BAD_PATH;
+  801bdb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801be0:	eb d5                	jmp    801bb7 <open+0x91>
+
+0000000000801be2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801be2:	55                   	push   %rbp
+  801be3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801be6:	be 00 00 00 00       	mov    $0x0,%esi
+  801beb:	bf 13 00 00 00       	mov    $0x13,%edi
+  801bf0:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801bf7:	00 00 00 
+  801bfa:	ff d0                	call   *%rax
+}
+  801bfc:	5d                   	pop    %rbp
+  801bfd:	c3                   	ret
+
+0000000000801bfe <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801bfe:	55                   	push   %rbp
+  801bff:	48 89 e5             	mov    %rsp,%rbp
+  801c02:	41 54                	push   %r12
+  801c04:	53                   	push   %rbx
+  801c05:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c08:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801c0f:	00 00 00 
+  801c12:	ff d0                	call   *%rax
+  801c14:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c17:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  801c1e:	00 00 00 
+  801c21:	48 89 df             	mov    %rbx,%rdi
+  801c24:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  801c2b:	00 00 00 
+  801c2e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c30:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c35:	41 2b 04 24          	sub    (%r12),%eax
+  801c39:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c3f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c46:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c49:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c50:	00 00 00 
+  801c53:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5f:	5b                   	pop    %rbx
+  801c60:	41 5c                	pop    %r12
+  801c62:	5d                   	pop    %rbp
+  801c63:	c3                   	ret
+
+0000000000801c64 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c64:	55                   	push   %rbp
+  801c65:	48 89 e5             	mov    %rsp,%rbp
+  801c68:	41 54                	push   %r12
+  801c6a:	53                   	push   %rbx
+  801c6b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c73:	48 89 fe             	mov    %rdi,%rsi
+  801c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7b:	49 bc 52 03 80 00 00 	movabs $0x800352,%r12
+  801c82:	00 00 00 
+  801c85:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c88:	48 89 df             	mov    %rbx,%rdi
+  801c8b:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	48 89 c6             	mov    %rax,%rsi
+  801c9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca4:	41 ff d4             	call   *%r12
+}
+  801ca7:	5b                   	pop    %rbx
+  801ca8:	41 5c                	pop    %r12
+  801caa:	5d                   	pop    %rbp
+  801cab:	c3                   	ret
+
+0000000000801cac <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	41 57                	push   %r15
+  801cb2:	41 56                	push   %r14
+  801cb4:	41 55                	push   %r13
+  801cb6:	41 54                	push   %r12
+  801cb8:	53                   	push   %rbx
+  801cb9:	48 83 ec 18          	sub    $0x18,%rsp
+  801cbd:	49 89 fc             	mov    %rdi,%r12
+  801cc0:	49 89 f5             	mov    %rsi,%r13
+  801cc3:	49 89 d7             	mov    %rdx,%r15
+  801cc6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cca:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cd6:	4d 85 ff             	test   %r15,%r15
+  801cd9:	0f 84 af 00 00 00    	je     801d8e <devpipe_write+0xe2>
+  801cdf:	48 89 c3             	mov    %rax,%rbx
+  801ce2:	4c 89 f8             	mov    %r15,%rax
+  801ce5:	4d 89 ef             	mov    %r13,%r15
+  801ce8:	4c 01 e8             	add    %r13,%rax
+  801ceb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801cef:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  801cf6:	00 00 00 
+            sys_yield();
+  801cf9:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  801d00:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d03:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d06:	48 63 ce             	movslq %esi,%rcx
+  801d09:	48 63 03             	movslq (%rbx),%rax
+  801d0c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d12:	48 39 c1             	cmp    %rax,%rcx
+  801d15:	72 2e                	jb     801d45 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d17:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d1c:	48 89 da             	mov    %rbx,%rdx
+  801d1f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d24:	4c 89 e7             	mov    %r12,%rdi
+  801d27:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	74 66                	je     801d94 <devpipe_write+0xe8>
+            sys_yield();
+  801d2e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d31:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d34:	48 63 ce             	movslq %esi,%rcx
+  801d37:	48 63 03             	movslq (%rbx),%rax
+  801d3a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d40:	48 39 c1             	cmp    %rax,%rcx
+  801d43:	73 d2                	jae    801d17 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d45:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d49:	48 89 ca             	mov    %rcx,%rdx
+  801d4c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d50:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d57:	08 10 20 
+  801d5a:	48 f7 e2             	mul    %rdx
+  801d5d:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d61:	48 89 d0             	mov    %rdx,%rax
+  801d64:	48 c1 e0 09          	shl    $0x9,%rax
+  801d68:	48 29 d0             	sub    %rdx,%rax
+  801d6b:	48 c1 e0 03          	shl    $0x3,%rax
+  801d6f:	48 29 c1             	sub    %rax,%rcx
+  801d72:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d77:	83 c6 01             	add    $0x1,%esi
+  801d7a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d7d:	49 83 c7 01          	add    $0x1,%r15
+  801d81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d85:	49 39 c7             	cmp    %rax,%r15
+  801d88:	0f 85 75 ff ff ff    	jne    801d03 <devpipe_write+0x57>
+    return n;
+  801d8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d92:	eb 05                	jmp    801d99 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801d94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d99:	48 83 c4 18          	add    $0x18,%rsp
+  801d9d:	5b                   	pop    %rbx
+  801d9e:	41 5c                	pop    %r12
+  801da0:	41 5d                	pop    %r13
+  801da2:	41 5e                	pop    %r14
+  801da4:	41 5f                	pop    %r15
+  801da6:	5d                   	pop    %rbp
+  801da7:	c3                   	ret
+
+0000000000801da8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801da8:	55                   	push   %rbp
+  801da9:	48 89 e5             	mov    %rsp,%rbp
+  801dac:	41 57                	push   %r15
+  801dae:	41 56                	push   %r14
+  801db0:	41 55                	push   %r13
+  801db2:	41 54                	push   %r12
+  801db4:	53                   	push   %rbx
+  801db5:	48 83 ec 18          	sub    $0x18,%rsp
+  801db9:	49 89 fc             	mov    %rdi,%r12
+  801dbc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dc0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dc4:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  801dd0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801dd3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dd9:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  801de0:	00 00 00 
+            sys_yield();
+  801de3:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  801dea:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801ded:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801df2:	74 7d                	je     801e71 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801df4:	8b 03                	mov    (%rbx),%eax
+  801df6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801df9:	75 26                	jne    801e21 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801dfb:	4d 85 ff             	test   %r15,%r15
+  801dfe:	75 77                	jne    801e77 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e00:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e05:	48 89 da             	mov    %rbx,%rdx
+  801e08:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e0d:	4c 89 e7             	mov    %r12,%rdi
+  801e10:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e13:	85 c0                	test   %eax,%eax
+  801e15:	74 72                	je     801e89 <devpipe_read+0xe1>
+            sys_yield();
+  801e17:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e1a:	8b 03                	mov    (%rbx),%eax
+  801e1c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e1f:	74 df                	je     801e00 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e21:	48 63 c8             	movslq %eax,%rcx
+  801e24:	48 89 ca             	mov    %rcx,%rdx
+  801e27:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e2b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e32:	08 10 20 
+  801e35:	48 89 d0             	mov    %rdx,%rax
+  801e38:	48 f7 e6             	mul    %rsi
+  801e3b:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e3f:	48 89 d0             	mov    %rdx,%rax
+  801e42:	48 c1 e0 09          	shl    $0x9,%rax
+  801e46:	48 29 d0             	sub    %rdx,%rax
+  801e49:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e50:	00 
+  801e51:	48 89 c8             	mov    %rcx,%rax
+  801e54:	48 29 d0             	sub    %rdx,%rax
+  801e57:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e5c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e60:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e64:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e67:	49 83 c7 01          	add    $0x1,%r15
+  801e6b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e6f:	75 83                	jne    801df4 <devpipe_read+0x4c>
+    return n;
+  801e71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e75:	eb 03                	jmp    801e7a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e77:	4c 89 f8             	mov    %r15,%rax
+}
+  801e7a:	48 83 c4 18          	add    $0x18,%rsp
+  801e7e:	5b                   	pop    %rbx
+  801e7f:	41 5c                	pop    %r12
+  801e81:	41 5d                	pop    %r13
+  801e83:	41 5e                	pop    %r14
+  801e85:	41 5f                	pop    %r15
+  801e87:	5d                   	pop    %rbp
+  801e88:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8e:	eb ea                	jmp    801e7a <devpipe_read+0xd2>
+
+0000000000801e90 <pipe>:
+pipe(int pfd[2]) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+  801e94:	41 55                	push   %r13
+  801e96:	41 54                	push   %r12
+  801e98:	53                   	push   %rbx
+  801e99:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ea0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ea4:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+  801eb0:	89 c3                	mov    %eax,%ebx
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	0f 88 a0 01 00 00    	js     80205a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801eba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ebf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ec4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ec8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ecd:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+  801ed9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	0f 88 77 01 00 00    	js     80205a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801ee3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801ee7:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	89 c3                	mov    %eax,%ebx
+  801ef5:	85 c0                	test   %eax,%eax
+  801ef7:	0f 88 43 01 00 00    	js     802040 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801efd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f07:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f10:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	0f 88 1a 01 00 00    	js     802040 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f26:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f2a:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f39:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f43:	48 89 c6             	mov    %rax,%rsi
+  801f46:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4b:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  801f52:	00 00 00 
+  801f55:	ff d0                	call   *%rax
+  801f57:	89 c3                	mov    %eax,%ebx
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	0f 88 c5 00 00 00    	js     802026 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f61:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f65:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	48 89 c1             	mov    %rax,%rcx
+  801f74:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f7a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f85:	4c 89 ee             	mov    %r13,%rsi
+  801f88:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f8d:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+  801f99:	89 c3                	mov    %eax,%ebx
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 6e                	js     80200d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801f9f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fa4:	4c 89 ef             	mov    %r13,%rdi
+  801fa7:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	83 f8 02             	cmp    $0x2,%eax
+  801fb6:	0f 85 ab 00 00 00    	jne    802067 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fbc:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fc3:	00 00 
+  801fc5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fc9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fcb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fcf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801fd6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fda:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801fdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801fe7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801feb:	48 bb 56 06 80 00 00 	movabs $0x800656,%rbx
+  801ff2:	00 00 00 
+  801ff5:	ff d3                	call   *%rbx
+  801ff7:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801ffb:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801fff:	ff d3                	call   *%rbx
+  802001:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80200b:	eb 4d                	jmp    80205a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80200d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802012:	4c 89 ee             	mov    %r13,%rsi
+  802015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201a:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802026:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80202b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80202f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802034:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802040:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802045:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80204e:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+}
+  80205a:	89 d8                	mov    %ebx,%eax
+  80205c:	48 83 c4 18          	add    $0x18,%rsp
+  802060:	5b                   	pop    %rbx
+  802061:	41 5c                	pop    %r12
+  802063:	41 5d                	pop    %r13
+  802065:	5d                   	pop    %rbp
+  802066:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802067:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  80206e:	00 00 00 
+  802071:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  802078:	00 00 00 
+  80207b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802080:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  802087:	00 00 00 
+  80208a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208f:	49 b8 e7 24 80 00 00 	movabs $0x8024e7,%r8
+  802096:	00 00 00 
+  802099:	41 ff d0             	call   *%r8
+
+000000000080209c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80209c:	55                   	push   %rbp
+  80209d:	48 89 e5             	mov    %rsp,%rbp
+  8020a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020a8:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 35                	js     8020ed <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020b8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020bc:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  8020c3:	00 00 00 
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020cb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020d5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d9:	48 b8 5a 02 80 00 00 	movabs $0x80025a,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	0f 94 c0             	sete   %al
+  8020ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+
+00000000008020ef <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8020ef:	48 89 f8             	mov    %rdi,%rax
+  8020f2:	48 c1 e8 27          	shr    $0x27,%rax
+  8020f6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8020fd:	01 00 00 
+  802100:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802104:	f6 c2 01             	test   $0x1,%dl
+  802107:	74 6d                	je     802176 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802109:	48 89 f8             	mov    %rdi,%rax
+  80210c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802110:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802117:	01 00 00 
+  80211a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80211e:	f6 c2 01             	test   $0x1,%dl
+  802121:	74 62                	je     802185 <get_uvpt_entry+0x96>
+  802123:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80212a:	01 00 00 
+  80212d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802131:	f6 c2 80             	test   $0x80,%dl
+  802134:	75 4f                	jne    802185 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802136:	48 89 f8             	mov    %rdi,%rax
+  802139:	48 c1 e8 15          	shr    $0x15,%rax
+  80213d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802144:	01 00 00 
+  802147:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80214b:	f6 c2 01             	test   $0x1,%dl
+  80214e:	74 44                	je     802194 <get_uvpt_entry+0xa5>
+  802150:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802157:	01 00 00 
+  80215a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80215e:	f6 c2 80             	test   $0x80,%dl
+  802161:	75 31                	jne    802194 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802163:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802167:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80216e:	01 00 00 
+  802171:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802175:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802176:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80217d:	01 00 00 
+  802180:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802184:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802185:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80218c:	01 00 00 
+  80218f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802193:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802194:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80219b:	01 00 00 
+  80219e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a2:	c3                   	ret
+
+00000000008021a3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021a7:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021b6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021bb:	89 c1                	mov    %eax,%ecx
+  8021bd:	83 c9 04             	or     $0x4,%ecx
+  8021c0:	f6 c2 01             	test   $0x1,%dl
+  8021c3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021c6:	89 c1                	mov    %eax,%ecx
+  8021c8:	83 c9 02             	or     $0x2,%ecx
+  8021cb:	f6 c2 02             	test   $0x2,%dl
+  8021ce:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021d1:	89 c1                	mov    %eax,%ecx
+  8021d3:	83 c9 01             	or     $0x1,%ecx
+  8021d6:	48 85 d2             	test   %rdx,%rdx
+  8021d9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021dc:	89 c1                	mov    %eax,%ecx
+  8021de:	83 c9 40             	or     $0x40,%ecx
+  8021e1:	f6 c6 04             	test   $0x4,%dh
+  8021e4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021e7:	5d                   	pop    %rbp
+  8021e8:	c3                   	ret
+
+00000000008021e9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021e9:	55                   	push   %rbp
+  8021ea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021ed:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8021f9:	48 c1 e8 06          	shr    $0x6,%rax
+  8021fd:	83 e0 01             	and    $0x1,%eax
+}
+  802200:	5d                   	pop    %rbp
+  802201:	c3                   	ret
+
+0000000000802202 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802202:	55                   	push   %rbp
+  802203:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802206:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  80220d:	00 00 00 
+  802210:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802212:	48 c1 e8 05          	shr    $0x5,%rax
+  802216:	83 e0 01             	and    $0x1,%eax
+}
+  802219:	5d                   	pop    %rbp
+  80221a:	c3                   	ret
+
+000000000080221b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80221b:	55                   	push   %rbp
+  80221c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80221f:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	83 e0 01             	and    $0x1,%eax
+}
+  80222e:	5d                   	pop    %rbp
+  80222f:	c3                   	ret
+
+0000000000802230 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	41 57                	push   %r15
+  802236:	41 56                	push   %r14
+  802238:	41 55                	push   %r13
+  80223a:	41 54                	push   %r12
+  80223c:	53                   	push   %rbx
+  80223d:	48 83 ec 18          	sub    $0x18,%rsp
+  802241:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802245:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802249:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80224e:	49 bd 1b 22 80 00 00 	movabs $0x80221b,%r13
+  802255:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802258:	49 bf a3 21 80 00 00 	movabs $0x8021a3,%r15
+  80225f:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802262:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802269:	00 00 00 
+  80226c:	eb 0c                	jmp    80227a <foreach_shared_region+0x4a>
+  80226e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802275:	4c 39 f3             	cmp    %r14,%rbx
+  802278:	74 2e                	je     8022a8 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80227a:	48 89 df             	mov    %rbx,%rdi
+  80227d:	41 ff d5             	call   *%r13
+  802280:	84 c0                	test   %al,%al
+  802282:	74 ea                	je     80226e <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802284:	48 89 df             	mov    %rbx,%rdi
+  802287:	41 ff d7             	call   *%r15
+  80228a:	a8 40                	test   $0x40,%al
+  80228c:	74 e0                	je     80226e <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80228e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802295:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802299:	48 89 df             	mov    %rbx,%rdi
+  80229c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022a0:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	79 c8                	jns    80226e <foreach_shared_region+0x3e>
+  8022a6:	eb 05                	jmp    8022ad <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ad:	48 83 c4 18          	add    $0x18,%rsp
+  8022b1:	5b                   	pop    %rbx
+  8022b2:	41 5c                	pop    %r12
+  8022b4:	41 5d                	pop    %r13
+  8022b6:	41 5e                	pop    %r14
+  8022b8:	41 5f                	pop    %r15
+  8022ba:	5d                   	pop    %rbp
+  8022bb:	c3                   	ret
+
+00000000008022bc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c1:	c3                   	ret
+
+00000000008022c2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+  8022c6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022c9:	48 be d4 37 80 00 00 	movabs $0x8037d4,%rsi
+  8022d0:	00 00 00 
+  8022d3:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+    return 0;
+}
+  8022df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e4:	5d                   	pop    %rbp
+  8022e5:	c3                   	ret
+
+00000000008022e6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022e6:	55                   	push   %rbp
+  8022e7:	48 89 e5             	mov    %rsp,%rbp
+  8022ea:	41 57                	push   %r15
+  8022ec:	41 56                	push   %r14
+  8022ee:	41 55                	push   %r13
+  8022f0:	41 54                	push   %r12
+  8022f2:	53                   	push   %rbx
+  8022f3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8022fa:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802301:	48 85 d2             	test   %rdx,%rdx
+  802304:	74 7a                	je     802380 <devcons_write+0x9a>
+  802306:	49 89 d6             	mov    %rdx,%r14
+  802309:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80230f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802314:	49 bf 56 31 80 00 00 	movabs $0x803156,%r15
+  80231b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80231e:	4c 89 f3             	mov    %r14,%rbx
+  802321:	48 29 f3             	sub    %rsi,%rbx
+  802324:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802329:	48 39 c3             	cmp    %rax,%rbx
+  80232c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802330:	4c 63 eb             	movslq %ebx,%r13
+  802333:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80233a:	48 01 c6             	add    %rax,%rsi
+  80233d:	4c 89 ea             	mov    %r13,%rdx
+  802340:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802347:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80234a:	4c 89 ee             	mov    %r13,%rsi
+  80234d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802354:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802360:	41 01 dc             	add    %ebx,%r12d
+  802363:	49 63 f4             	movslq %r12d,%rsi
+  802366:	4c 39 f6             	cmp    %r14,%rsi
+  802369:	72 b3                	jb     80231e <devcons_write+0x38>
+    return res;
+  80236b:	49 63 c4             	movslq %r12d,%rax
+}
+  80236e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802375:	5b                   	pop    %rbx
+  802376:	41 5c                	pop    %r12
+  802378:	41 5d                	pop    %r13
+  80237a:	41 5e                	pop    %r14
+  80237c:	41 5f                	pop    %r15
+  80237e:	5d                   	pop    %rbp
+  80237f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802380:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802386:	eb e3                	jmp    80236b <devcons_write+0x85>
+
+0000000000802388 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802388:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80238b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802390:	48 85 c0             	test   %rax,%rax
+  802393:	74 55                	je     8023ea <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	41 55                	push   %r13
+  80239b:	41 54                	push   %r12
+  80239d:	53                   	push   %rbx
+  80239e:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023a5:	48 bb 2a 01 80 00 00 	movabs $0x80012a,%rbx
+  8023ac:	00 00 00 
+  8023af:	49 bc f7 01 80 00 00 	movabs $0x8001f7,%r12
+  8023b6:	00 00 00 
+  8023b9:	eb 03                	jmp    8023be <devcons_read+0x36>
+  8023bb:	41 ff d4             	call   *%r12
+  8023be:	ff d3                	call   *%rbx
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	74 f7                	je     8023bb <devcons_read+0x33>
+    if (c < 0) return c;
+  8023c4:	48 63 d0             	movslq %eax,%rdx
+  8023c7:	78 13                	js     8023dc <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ce:	83 f8 04             	cmp    $0x4,%eax
+  8023d1:	74 09                	je     8023dc <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023d3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023d7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023dc:	48 89 d0             	mov    %rdx,%rax
+  8023df:	48 83 c4 08          	add    $0x8,%rsp
+  8023e3:	5b                   	pop    %rbx
+  8023e4:	41 5c                	pop    %r12
+  8023e6:	41 5d                	pop    %r13
+  8023e8:	5d                   	pop    %rbp
+  8023e9:	c3                   	ret
+  8023ea:	48 89 d0             	mov    %rdx,%rax
+  8023ed:	c3                   	ret
+
+00000000008023ee <cputchar>:
+cputchar(int ch) {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+  8023f2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8023f6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8023fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ff:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802403:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+}
+  80240f:	c9                   	leave
+  802410:	c3                   	ret
+
+0000000000802411 <getchar>:
+getchar(void) {
+  802411:	55                   	push   %rbp
+  802412:	48 89 e5             	mov    %rsp,%rbp
+  802415:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802419:	ba 01 00 00 00       	mov    $0x1,%edx
+  80241e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802422:	bf 00 00 00 00       	mov    $0x0,%edi
+  802427:	48 b8 c7 09 80 00 00 	movabs $0x8009c7,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802435:	85 c0                	test   %eax,%eax
+  802437:	78 06                	js     80243f <getchar+0x2e>
+  802439:	74 08                	je     802443 <getchar+0x32>
+  80243b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80243f:	89 d0                	mov    %edx,%eax
+  802441:	c9                   	leave
+  802442:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802443:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802448:	eb f5                	jmp    80243f <getchar+0x2e>
+
+000000000080244a <iscons>:
+iscons(int fdnum) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802452:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802456:	48 b8 e4 06 80 00 00 	movabs $0x8006e4,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 18                	js     80247e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802466:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80246a:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802471:	00 00 00 
+  802474:	8b 00                	mov    (%rax),%eax
+  802476:	39 02                	cmp    %eax,(%rdx)
+  802478:	0f 94 c0             	sete   %al
+  80247b:	0f b6 c0             	movzbl %al,%eax
+}
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+0000000000802480 <opencons>:
+opencons(void) {
+  802480:	55                   	push   %rbp
+  802481:	48 89 e5             	mov    %rsp,%rbp
+  802484:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802488:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80248c:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	78 49                	js     8024e5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80249c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024af:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  8024b6:	00 00 00 
+  8024b9:	ff d0                	call   *%rax
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	78 26                	js     8024e5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024c3:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024ca:	00 00 
+  8024cc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024d9:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+}
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+00000000008024e7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024e7:	55                   	push   %rbp
+  8024e8:	48 89 e5             	mov    %rsp,%rbp
+  8024eb:	41 56                	push   %r14
+  8024ed:	41 55                	push   %r13
+  8024ef:	41 54                	push   %r12
+  8024f1:	53                   	push   %rbx
+  8024f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f6:	49 89 fc             	mov    %rdi,%r12
+  8024f9:	41 89 f5             	mov    %esi,%r13d
+  8024fc:	48 89 d3             	mov    %rdx,%rbx
+  8024ff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802503:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802507:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80250b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802512:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802516:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80251a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80251e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802522:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802529:	00 00 00 
+  80252c:	4c 8b 30             	mov    (%rax),%r14
+  80252f:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+  80253b:	89 c6                	mov    %eax,%esi
+  80253d:	45 89 e8             	mov    %r13d,%r8d
+  802540:	4c 89 e1             	mov    %r12,%rcx
+  802543:	4c 89 f2             	mov    %r14,%rdx
+  802546:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  80254d:	00 00 00 
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+  802555:	49 bc 37 26 80 00 00 	movabs $0x802637,%r12
+  80255c:	00 00 00 
+  80255f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802562:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802566:	48 89 df             	mov    %rbx,%rdi
+  802569:	48 b8 d3 25 80 00 00 	movabs $0x8025d3,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+    cprintf("\n");
+  802575:	48 bf 33 37 80 00 00 	movabs $0x803733,%rdi
+  80257c:	00 00 00 
+  80257f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802584:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802587:	cc                   	int3
+  802588:	eb fd                	jmp    802587 <_panic+0xa0>
+
+000000000080258a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80258a:	55                   	push   %rbp
+  80258b:	48 89 e5             	mov    %rsp,%rbp
+  80258e:	53                   	push   %rbx
+  80258f:	48 83 ec 08          	sub    $0x8,%rsp
+  802593:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802596:	8b 06                	mov    (%rsi),%eax
+  802598:	8d 50 01             	lea    0x1(%rax),%edx
+  80259b:	89 16                	mov    %edx,(%rsi)
+  80259d:	48 98                	cltq
+  80259f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025a4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025aa:	74 0a                	je     8025b6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025ac:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025b6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025ba:	be ff 00 00 00       	mov    $0xff,%esi
+  8025bf:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  8025c6:	00 00 00 
+  8025c9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025cb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025d1:	eb d9                	jmp    8025ac <putch+0x22>
+
+00000000008025d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025d3:	55                   	push   %rbp
+  8025d4:	48 89 e5             	mov    %rsp,%rbp
+  8025d7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025de:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025e1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025e8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8025f5:	48 89 f1             	mov    %rsi,%rcx
+  8025f8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8025ff:	48 bf 8a 25 80 00 00 	movabs $0x80258a,%rdi
+  802606:	00 00 00 
+  802609:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802615:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80261c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802623:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80262f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+0000000000802637 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802637:	55                   	push   %rbp
+  802638:	48 89 e5             	mov    %rsp,%rbp
+  80263b:	48 83 ec 50          	sub    $0x50,%rsp
+  80263f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802643:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802647:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80264b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80264f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802653:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80265a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80265e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802662:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802666:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80266a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80266e:	48 b8 d3 25 80 00 00 	movabs $0x8025d3,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	41 57                	push   %r15
+  802682:	41 56                	push   %r14
+  802684:	41 55                	push   %r13
+  802686:	41 54                	push   %r12
+  802688:	53                   	push   %rbx
+  802689:	48 83 ec 18          	sub    $0x18,%rsp
+  80268d:	49 89 fc             	mov    %rdi,%r12
+  802690:	49 89 f5             	mov    %rsi,%r13
+  802693:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802697:	8b 45 10             	mov    0x10(%rbp),%eax
+  80269a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80269d:	41 89 cf             	mov    %ecx,%r15d
+  8026a0:	4c 39 fa             	cmp    %r15,%rdx
+  8026a3:	73 5b                	jae    802700 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026a5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026a9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026ad:	85 db                	test   %ebx,%ebx
+  8026af:	7e 0e                	jle    8026bf <print_num+0x43>
+            putch(padc, put_arg);
+  8026b1:	4c 89 ee             	mov    %r13,%rsi
+  8026b4:	44 89 f7             	mov    %r14d,%edi
+  8026b7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026ba:	83 eb 01             	sub    $0x1,%ebx
+  8026bd:	75 f2                	jne    8026b1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026bf:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026c3:	48 b9 14 38 80 00 00 	movabs $0x803814,%rcx
+  8026ca:	00 00 00 
+  8026cd:	48 b8 03 38 80 00 00 	movabs $0x803803,%rax
+  8026d4:	00 00 00 
+  8026d7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e4:	49 f7 f7             	div    %r15
+  8026e7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8026eb:	4c 89 ee             	mov    %r13,%rsi
+  8026ee:	41 ff d4             	call   *%r12
+}
+  8026f1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8026f5:	5b                   	pop    %rbx
+  8026f6:	41 5c                	pop    %r12
+  8026f8:	41 5d                	pop    %r13
+  8026fa:	41 5e                	pop    %r14
+  8026fc:	41 5f                	pop    %r15
+  8026fe:	5d                   	pop    %rbp
+  8026ff:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802700:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802704:	ba 00 00 00 00       	mov    $0x0,%edx
+  802709:	49 f7 f7             	div    %r15
+  80270c:	48 83 ec 08          	sub    $0x8,%rsp
+  802710:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802714:	52                   	push   %rdx
+  802715:	45 0f be c9          	movsbl %r9b,%r9d
+  802719:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80271d:	48 89 c2             	mov    %rax,%rdx
+  802720:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  802727:	00 00 00 
+  80272a:	ff d0                	call   *%rax
+  80272c:	48 83 c4 10          	add    $0x10,%rsp
+  802730:	eb 8d                	jmp    8026bf <print_num+0x43>
+
+0000000000802732 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802732:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802736:	48 8b 06             	mov    (%rsi),%rax
+  802739:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80273d:	73 0a                	jae    802749 <sprintputch+0x17>
+        *state->start++ = ch;
+  80273f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802743:	48 89 16             	mov    %rdx,(%rsi)
+  802746:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802749:	c3                   	ret
+
+000000000080274a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80274a:	55                   	push   %rbp
+  80274b:	48 89 e5             	mov    %rsp,%rbp
+  80274e:	48 83 ec 50          	sub    $0x50,%rsp
+  802752:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802756:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80275a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80275e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802765:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80276d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802771:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802775:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802779:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+}
+  802785:	c9                   	leave
+  802786:	c3                   	ret
+
+0000000000802787 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+  80278b:	41 57                	push   %r15
+  80278d:	41 56                	push   %r14
+  80278f:	41 55                	push   %r13
+  802791:	41 54                	push   %r12
+  802793:	53                   	push   %rbx
+  802794:	48 83 ec 38          	sub    $0x38,%rsp
+  802798:	49 89 fe             	mov    %rdi,%r14
+  80279b:	49 89 f5             	mov    %rsi,%r13
+  80279e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027a1:	48 8b 01             	mov    (%rcx),%rax
+  8027a4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027a8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027b8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027bc:	0f b6 3b             	movzbl (%rbx),%edi
+  8027bf:	40 80 ff 25          	cmp    $0x25,%dil
+  8027c3:	74 18                	je     8027dd <vprintfmt+0x56>
+            if (!ch) return;
+  8027c5:	40 84 ff             	test   %dil,%dil
+  8027c8:	0f 84 b1 06 00 00    	je     802e7f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027ce:	40 0f b6 ff          	movzbl %dil,%edi
+  8027d2:	4c 89 ee             	mov    %r13,%rsi
+  8027d5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027d8:	4c 89 e3             	mov    %r12,%rbx
+  8027db:	eb db                	jmp    8027b8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027e6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8027eb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027f1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8027f8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8027fc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802801:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802806:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802809:	83 e8 23             	sub    $0x23,%eax
+  80280c:	3c 57                	cmp    $0x57,%al
+  80280e:	0f 87 51 06 00 00    	ja     802e65 <vprintfmt+0x6de>
+  802814:	0f b6 c0             	movzbl %al,%eax
+  802817:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  80281e:	00 00 00 
+  802821:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802824:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802827:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80282b:	eb cf                	jmp    8027fc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80282d:	49 89 dc             	mov    %rbx,%r12
+  802830:	be 01 00 00 00       	mov    $0x1,%esi
+  802835:	eb c5                	jmp    8027fc <vprintfmt+0x75>
+            padc = ch;
+  802837:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80283b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80283e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802841:	eb b9                	jmp    8027fc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802843:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802846:	83 f8 2f             	cmp    $0x2f,%eax
+  802849:	77 24                	ja     80286f <vprintfmt+0xe8>
+  80284b:	89 c1                	mov    %eax,%ecx
+  80284d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802851:	83 c0 08             	add    $0x8,%eax
+  802854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802857:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80285a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80285d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802861:	79 99                	jns    8027fc <vprintfmt+0x75>
+                width = precision;
+  802863:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802867:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80286d:	eb 8d                	jmp    8027fc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80286f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802873:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80287b:	eb da                	jmp    802857 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80287d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802882:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802886:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80288c:	3c 39                	cmp    $0x39,%al
+  80288e:	77 1c                	ja     8028ac <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802890:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802894:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802898:	0f b6 c0             	movzbl %al,%eax
+  80289b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028a0:	0f b6 03             	movzbl (%rbx),%eax
+  8028a3:	3c 39                	cmp    $0x39,%al
+  8028a5:	76 e9                	jbe    802890 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028a7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028aa:	eb b1                	jmp    80285d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028ac:	49 89 dc             	mov    %rbx,%r12
+  8028af:	eb ac                	jmp    80285d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028b1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028b4:	85 c9                	test   %ecx,%ecx
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bb:	0f 49 c1             	cmovns %ecx,%eax
+  8028be:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028c1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028c4:	e9 33 ff ff ff       	jmp    8027fc <vprintfmt+0x75>
+            lflag++;
+  8028c9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028cc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028cf:	e9 28 ff ff ff       	jmp    8027fc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8028da:	77 19                	ja     8028f5 <vprintfmt+0x16e>
+  8028dc:	89 c2                	mov    %eax,%edx
+  8028de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028e2:	83 c0 08             	add    $0x8,%eax
+  8028e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028e8:	8b 3a                	mov    (%rdx),%edi
+  8028ea:	4c 89 ee             	mov    %r13,%rsi
+  8028ed:	41 ff d6             	call   *%r14
+            break;
+  8028f0:	e9 c3 fe ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8028f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802901:	eb e5                	jmp    8028e8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802903:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802906:	83 f8 2f             	cmp    $0x2f,%eax
+  802909:	77 5a                	ja     802965 <vprintfmt+0x1de>
+  80290b:	89 c2                	mov    %eax,%edx
+  80290d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802911:	83 c0 08             	add    $0x8,%eax
+  802914:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802917:	8b 02                	mov    (%rdx),%eax
+  802919:	89 c1                	mov    %eax,%ecx
+  80291b:	f7 d9                	neg    %ecx
+  80291d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802920:	83 f9 14             	cmp    $0x14,%ecx
+  802923:	7f 4e                	jg     802973 <vprintfmt+0x1ec>
+  802925:	48 63 c1             	movslq %ecx,%rax
+  802928:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  80292f:	00 00 00 
+  802932:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802936:	48 85 c0             	test   %rax,%rax
+  802939:	74 38                	je     802973 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80293b:	48 89 c1             	mov    %rax,%rcx
+  80293e:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  802945:	00 00 00 
+  802948:	4c 89 ee             	mov    %r13,%rsi
+  80294b:	4c 89 f7             	mov    %r14,%rdi
+  80294e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802953:	49 b8 4a 27 80 00 00 	movabs $0x80274a,%r8
+  80295a:	00 00 00 
+  80295d:	41 ff d0             	call   *%r8
+  802960:	e9 53 fe ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80296d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802971:	eb a4                	jmp    802917 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802973:	48 ba 2c 38 80 00 00 	movabs $0x80382c,%rdx
+  80297a:	00 00 00 
+  80297d:	4c 89 ee             	mov    %r13,%rsi
+  802980:	4c 89 f7             	mov    %r14,%rdi
+  802983:	b8 00 00 00 00       	mov    $0x0,%eax
+  802988:	49 b8 4a 27 80 00 00 	movabs $0x80274a,%r8
+  80298f:	00 00 00 
+  802992:	41 ff d0             	call   *%r8
+  802995:	e9 1e fe ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80299a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80299d:	83 f8 2f             	cmp    $0x2f,%eax
+  8029a0:	77 6c                	ja     802a0e <vprintfmt+0x287>
+  8029a2:	89 c2                	mov    %eax,%edx
+  8029a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029a8:	83 c0 08             	add    $0x8,%eax
+  8029ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029ae:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029b1:	48 85 d2             	test   %rdx,%rdx
+  8029b4:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8029bb:	00 00 00 
+  8029be:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029c6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029ca:	7e 06                	jle    8029d2 <vprintfmt+0x24b>
+  8029cc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029d0:	75 4a                	jne    802a1c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029d2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029d6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029da:	0f b6 00             	movzbl (%rax),%eax
+  8029dd:	84 c0                	test   %al,%al
+  8029df:	0f 85 9a 00 00 00    	jne    802a7f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029e5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029e8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	0f 8e c4 fd ff ff    	jle    8027b8 <vprintfmt+0x31>
+  8029f4:	4c 89 ee             	mov    %r13,%rsi
+  8029f7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8029fc:	41 ff d6             	call   *%r14
+  8029ff:	41 83 ec 01          	sub    $0x1,%r12d
+  802a03:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a07:	75 eb                	jne    8029f4 <vprintfmt+0x26d>
+  802a09:	e9 aa fd ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a1a:	eb 92                	jmp    8029ae <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a1c:	49 63 f7             	movslq %r15d,%rsi
+  802a1f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a23:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  802a2a:	00 00 00 
+  802a2d:	ff d0                	call   *%rax
+  802a2f:	48 89 c2             	mov    %rax,%rdx
+  802a32:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a35:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a37:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a3a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	7e 91                	jle    8029d2 <vprintfmt+0x24b>
+  802a41:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a46:	4c 89 ee             	mov    %r13,%rsi
+  802a49:	44 89 e7             	mov    %r12d,%edi
+  802a4c:	41 ff d6             	call   *%r14
+  802a4f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a53:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a56:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a59:	75 eb                	jne    802a46 <vprintfmt+0x2bf>
+  802a5b:	e9 72 ff ff ff       	jmp    8029d2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a60:	0f b6 f8             	movzbl %al,%edi
+  802a63:	4c 89 ee             	mov    %r13,%rsi
+  802a66:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a69:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a6d:	49 83 c4 01          	add    $0x1,%r12
+  802a71:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a77:	84 c0                	test   %al,%al
+  802a79:	0f 84 66 ff ff ff    	je     8029e5 <vprintfmt+0x25e>
+  802a7f:	45 85 ff             	test   %r15d,%r15d
+  802a82:	78 0a                	js     802a8e <vprintfmt+0x307>
+  802a84:	41 83 ef 01          	sub    $0x1,%r15d
+  802a88:	0f 88 57 ff ff ff    	js     8029e5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a8e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802a92:	74 cc                	je     802a60 <vprintfmt+0x2d9>
+  802a94:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802a97:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802a9c:	80 fa 5e             	cmp    $0x5e,%dl
+  802a9f:	77 c2                	ja     802a63 <vprintfmt+0x2dc>
+  802aa1:	eb bd                	jmp    802a60 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802aa3:	40 84 f6             	test   %sil,%sil
+  802aa6:	75 26                	jne    802ace <vprintfmt+0x347>
+    switch (lflag) {
+  802aa8:	85 d2                	test   %edx,%edx
+  802aaa:	74 59                	je     802b05 <vprintfmt+0x37e>
+  802aac:	83 fa 01             	cmp    $0x1,%edx
+  802aaf:	74 7b                	je     802b2c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802ab1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ab4:	83 f8 2f             	cmp    $0x2f,%eax
+  802ab7:	0f 87 96 00 00 00    	ja     802b53 <vprintfmt+0x3cc>
+  802abd:	89 c2                	mov    %eax,%edx
+  802abf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ac3:	83 c0 08             	add    $0x8,%eax
+  802ac6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ac9:	4c 8b 22             	mov    (%rdx),%r12
+  802acc:	eb 17                	jmp    802ae5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ace:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ad1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad4:	77 21                	ja     802af7 <vprintfmt+0x370>
+  802ad6:	89 c2                	mov    %eax,%edx
+  802ad8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802adc:	83 c0 08             	add    $0x8,%eax
+  802adf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ae2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802ae5:	4d 85 e4             	test   %r12,%r12
+  802ae8:	78 7a                	js     802b64 <vprintfmt+0x3dd>
+            num = i;
+  802aea:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802aed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802af2:	e9 50 02 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802af7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802afb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b03:	eb dd                	jmp    802ae2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b08:	83 f8 2f             	cmp    $0x2f,%eax
+  802b0b:	77 11                	ja     802b1e <vprintfmt+0x397>
+  802b0d:	89 c2                	mov    %eax,%edx
+  802b0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b13:	83 c0 08             	add    $0x8,%eax
+  802b16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b19:	4c 63 22             	movslq (%rdx),%r12
+  802b1c:	eb c7                	jmp    802ae5 <vprintfmt+0x35e>
+  802b1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b2a:	eb ed                	jmp    802b19 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  802b32:	77 11                	ja     802b45 <vprintfmt+0x3be>
+  802b34:	89 c2                	mov    %eax,%edx
+  802b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b3a:	83 c0 08             	add    $0x8,%eax
+  802b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b40:	4c 8b 22             	mov    (%rdx),%r12
+  802b43:	eb a0                	jmp    802ae5 <vprintfmt+0x35e>
+  802b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b51:	eb ed                	jmp    802b40 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b5f:	e9 65 ff ff ff       	jmp    802ac9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b64:	4c 89 ee             	mov    %r13,%rsi
+  802b67:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b6c:	41 ff d6             	call   *%r14
+                i = -i;
+  802b6f:	49 f7 dc             	neg    %r12
+  802b72:	e9 73 ff ff ff       	jmp    802aea <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b77:	40 84 f6             	test   %sil,%sil
+  802b7a:	75 32                	jne    802bae <vprintfmt+0x427>
+    switch (lflag) {
+  802b7c:	85 d2                	test   %edx,%edx
+  802b7e:	74 5d                	je     802bdd <vprintfmt+0x456>
+  802b80:	83 fa 01             	cmp    $0x1,%edx
+  802b83:	0f 84 82 00 00 00    	je     802c0b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  802b8f:	0f 87 a5 00 00 00    	ja     802c3a <vprintfmt+0x4b3>
+  802b95:	89 c2                	mov    %eax,%edx
+  802b97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b9b:	83 c0 08             	add    $0x8,%eax
+  802b9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ba1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802ba4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802ba9:	e9 99 01 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bb1:	83 f8 2f             	cmp    $0x2f,%eax
+  802bb4:	77 19                	ja     802bcf <vprintfmt+0x448>
+  802bb6:	89 c2                	mov    %eax,%edx
+  802bb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bbc:	83 c0 08             	add    $0x8,%eax
+  802bbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bc2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bc5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bca:	e9 78 01 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+  802bcf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bdb:	eb e5                	jmp    802bc2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802be0:	83 f8 2f             	cmp    $0x2f,%eax
+  802be3:	77 18                	ja     802bfd <vprintfmt+0x476>
+  802be5:	89 c2                	mov    %eax,%edx
+  802be7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802beb:	83 c0 08             	add    $0x8,%eax
+  802bee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bf1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802bf3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802bf8:	e9 4a 01 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+  802bfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c09:	eb e6                	jmp    802bf1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c0e:	83 f8 2f             	cmp    $0x2f,%eax
+  802c11:	77 19                	ja     802c2c <vprintfmt+0x4a5>
+  802c13:	89 c2                	mov    %eax,%edx
+  802c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c19:	83 c0 08             	add    $0x8,%eax
+  802c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c1f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c22:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c27:	e9 1b 01 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+  802c2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c38:	eb e5                	jmp    802c1f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c46:	e9 56 ff ff ff       	jmp    802ba1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c4b:	40 84 f6             	test   %sil,%sil
+  802c4e:	75 2e                	jne    802c7e <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c50:	85 d2                	test   %edx,%edx
+  802c52:	74 59                	je     802cad <vprintfmt+0x526>
+  802c54:	83 fa 01             	cmp    $0x1,%edx
+  802c57:	74 7f                	je     802cd8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c5c:	83 f8 2f             	cmp    $0x2f,%eax
+  802c5f:	0f 87 9f 00 00 00    	ja     802d04 <vprintfmt+0x57d>
+  802c65:	89 c2                	mov    %eax,%edx
+  802c67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c6b:	83 c0 08             	add    $0x8,%eax
+  802c6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c74:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c79:	e9 c9 00 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c81:	83 f8 2f             	cmp    $0x2f,%eax
+  802c84:	77 19                	ja     802c9f <vprintfmt+0x518>
+  802c86:	89 c2                	mov    %eax,%edx
+  802c88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c8c:	83 c0 08             	add    $0x8,%eax
+  802c8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c92:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c95:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c9a:	e9 a8 00 00 00       	jmp    802d47 <vprintfmt+0x5c0>
+  802c9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ca3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ca7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cab:	eb e5                	jmp    802c92 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  802cb3:	77 15                	ja     802cca <vprintfmt+0x543>
+  802cb5:	89 c2                	mov    %eax,%edx
+  802cb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cbb:	83 c0 08             	add    $0x8,%eax
+  802cbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cc1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cc3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cc8:	eb 7d                	jmp    802d47 <vprintfmt+0x5c0>
+  802cca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cd6:	eb e9                	jmp    802cc1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cdb:	83 f8 2f             	cmp    $0x2f,%eax
+  802cde:	77 16                	ja     802cf6 <vprintfmt+0x56f>
+  802ce0:	89 c2                	mov    %eax,%edx
+  802ce2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ce6:	83 c0 08             	add    $0x8,%eax
+  802ce9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802cf4:	eb 51                	jmp    802d47 <vprintfmt+0x5c0>
+  802cf6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d02:	eb e8                	jmp    802cec <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d10:	e9 5c ff ff ff       	jmp    802c71 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d15:	4c 89 ee             	mov    %r13,%rsi
+  802d18:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d1d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d20:	4c 89 ee             	mov    %r13,%rsi
+  802d23:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d28:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d2e:	83 f8 2f             	cmp    $0x2f,%eax
+  802d31:	77 47                	ja     802d7a <vprintfmt+0x5f3>
+  802d33:	89 c2                	mov    %eax,%edx
+  802d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d39:	83 c0 08             	add    $0x8,%eax
+  802d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d3f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d42:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d47:	48 83 ec 08          	sub    $0x8,%rsp
+  802d4b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d4f:	0f 94 c0             	sete   %al
+  802d52:	0f b6 c0             	movzbl %al,%eax
+  802d55:	50                   	push   %rax
+  802d56:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d5b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d5f:	4c 89 ee             	mov    %r13,%rsi
+  802d62:	4c 89 f7             	mov    %r14,%rdi
+  802d65:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  802d6c:	00 00 00 
+  802d6f:	ff d0                	call   *%rax
+            break;
+  802d71:	48 83 c4 10          	add    $0x10,%rsp
+  802d75:	e9 3e fa ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d86:	eb b7                	jmp    802d3f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d88:	40 84 f6             	test   %sil,%sil
+  802d8b:	75 2b                	jne    802db8 <vprintfmt+0x631>
+    switch (lflag) {
+  802d8d:	85 d2                	test   %edx,%edx
+  802d8f:	74 56                	je     802de7 <vprintfmt+0x660>
+  802d91:	83 fa 01             	cmp    $0x1,%edx
+  802d94:	74 7f                	je     802e15 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802d96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d99:	83 f8 2f             	cmp    $0x2f,%eax
+  802d9c:	0f 87 a2 00 00 00    	ja     802e44 <vprintfmt+0x6bd>
+  802da2:	89 c2                	mov    %eax,%edx
+  802da4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802da8:	83 c0 08             	add    $0x8,%eax
+  802dab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802db1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802db6:	eb 8f                	jmp    802d47 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802db8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dbb:	83 f8 2f             	cmp    $0x2f,%eax
+  802dbe:	77 19                	ja     802dd9 <vprintfmt+0x652>
+  802dc0:	89 c2                	mov    %eax,%edx
+  802dc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dc6:	83 c0 08             	add    $0x8,%eax
+  802dc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dcc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dcf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dd4:	e9 6e ff ff ff       	jmp    802d47 <vprintfmt+0x5c0>
+  802dd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ddd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802de5:	eb e5                	jmp    802dcc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802de7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dea:	83 f8 2f             	cmp    $0x2f,%eax
+  802ded:	77 18                	ja     802e07 <vprintfmt+0x680>
+  802def:	89 c2                	mov    %eax,%edx
+  802df1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802df5:	83 c0 08             	add    $0x8,%eax
+  802df8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dfb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802dfd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e02:	e9 40 ff ff ff       	jmp    802d47 <vprintfmt+0x5c0>
+  802e07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e13:	eb e6                	jmp    802dfb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e18:	83 f8 2f             	cmp    $0x2f,%eax
+  802e1b:	77 19                	ja     802e36 <vprintfmt+0x6af>
+  802e1d:	89 c2                	mov    %eax,%edx
+  802e1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e23:	83 c0 08             	add    $0x8,%eax
+  802e26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e31:	e9 11 ff ff ff       	jmp    802d47 <vprintfmt+0x5c0>
+  802e36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e42:	eb e5                	jmp    802e29 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e50:	e9 59 ff ff ff       	jmp    802dae <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e55:	4c 89 ee             	mov    %r13,%rsi
+  802e58:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e5d:	41 ff d6             	call   *%r14
+            break;
+  802e60:	e9 53 f9 ff ff       	jmp    8027b8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e65:	4c 89 ee             	mov    %r13,%rsi
+  802e68:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e6d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e70:	48 83 eb 01          	sub    $0x1,%rbx
+  802e74:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e78:	75 f6                	jne    802e70 <vprintfmt+0x6e9>
+  802e7a:	e9 39 f9 ff ff       	jmp    8027b8 <vprintfmt+0x31>
+}
+  802e7f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e83:	5b                   	pop    %rbx
+  802e84:	41 5c                	pop    %r12
+  802e86:	41 5d                	pop    %r13
+  802e88:	41 5e                	pop    %r14
+  802e8a:	41 5f                	pop    %r15
+  802e8c:	5d                   	pop    %rbp
+  802e8d:	c3                   	ret
+
+0000000000802e8e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802e8e:	55                   	push   %rbp
+  802e8f:	48 89 e5             	mov    %rsp,%rbp
+  802e92:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802e96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e9a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802e9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ea3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802eaa:	48 85 ff             	test   %rdi,%rdi
+  802ead:	74 2b                	je     802eda <vsnprintf+0x4c>
+  802eaf:	48 85 f6             	test   %rsi,%rsi
+  802eb2:	74 26                	je     802eda <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802eb4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802eb8:	48 bf 32 27 80 00 00 	movabs $0x802732,%rdi
+  802ebf:	00 00 00 
+  802ec2:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  802ec9:	00 00 00 
+  802ecc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ece:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802ed5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ed8:	c9                   	leave
+  802ed9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802eda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802edf:	eb f7                	jmp    802ed8 <vsnprintf+0x4a>
+
+0000000000802ee1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802ee1:	55                   	push   %rbp
+  802ee2:	48 89 e5             	mov    %rsp,%rbp
+  802ee5:	48 83 ec 50          	sub    $0x50,%rsp
+  802ee9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802eed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ef1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ef5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802efc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f04:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f0c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f10:	48 b8 8e 2e 80 00 00 	movabs $0x802e8e,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f1c:	c9                   	leave
+  802f1d:	c3                   	ret
+
+0000000000802f1e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f1e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f21:	74 10                	je     802f33 <strlen+0x15>
+    size_t n = 0;
+  802f23:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f28:	48 83 c0 01          	add    $0x1,%rax
+  802f2c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f30:	75 f6                	jne    802f28 <strlen+0xa>
+  802f32:	c3                   	ret
+    size_t n = 0;
+  802f33:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f38:	c3                   	ret
+
+0000000000802f39 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f39:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f3c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f41:	48 85 f6             	test   %rsi,%rsi
+  802f44:	74 11                	je     802f57 <strnlen+0x1e>
+  802f46:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f4a:	74 0c                	je     802f58 <strnlen+0x1f>
+  802f4c:	48 83 c2 01          	add    $0x1,%rdx
+  802f50:	48 39 d0             	cmp    %rdx,%rax
+  802f53:	75 f1                	jne    802f46 <strnlen+0xd>
+  802f55:	eb 04                	jmp    802f5b <strnlen+0x22>
+  802f57:	c3                   	ret
+  802f58:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f5b:	c3                   	ret
+
+0000000000802f5c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f5c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f64:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f68:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f6b:	48 83 c2 01          	add    $0x1,%rdx
+  802f6f:	84 c9                	test   %cl,%cl
+  802f71:	75 f1                	jne    802f64 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f73:	c3                   	ret
+
+0000000000802f74 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f74:	55                   	push   %rbp
+  802f75:	48 89 e5             	mov    %rsp,%rbp
+  802f78:	41 54                	push   %r12
+  802f7a:	53                   	push   %rbx
+  802f7b:	48 89 fb             	mov    %rdi,%rbx
+  802f7e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f81:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802f8d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802f91:	4c 89 e6             	mov    %r12,%rsi
+  802f94:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  802f9b:	00 00 00 
+  802f9e:	ff d0                	call   *%rax
+    return dst;
+}
+  802fa0:	48 89 d8             	mov    %rbx,%rax
+  802fa3:	5b                   	pop    %rbx
+  802fa4:	41 5c                	pop    %r12
+  802fa6:	5d                   	pop    %rbp
+  802fa7:	c3                   	ret
+
+0000000000802fa8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fa8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fab:	48 85 d2             	test   %rdx,%rdx
+  802fae:	74 1f                	je     802fcf <strncpy+0x27>
+  802fb0:	48 01 fa             	add    %rdi,%rdx
+  802fb3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fb6:	48 83 c1 01          	add    $0x1,%rcx
+  802fba:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fbe:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fc2:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fc6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fca:	48 39 ca             	cmp    %rcx,%rdx
+  802fcd:	75 e7                	jne    802fb6 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fcf:	c3                   	ret
+
+0000000000802fd0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fd0:	48 89 f8             	mov    %rdi,%rax
+  802fd3:	48 85 d2             	test   %rdx,%rdx
+  802fd6:	74 24                	je     802ffc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fd8:	48 83 ea 01          	sub    $0x1,%rdx
+  802fdc:	74 1b                	je     802ff9 <strlcpy+0x29>
+  802fde:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fe2:	0f b6 16             	movzbl (%rsi),%edx
+  802fe5:	84 d2                	test   %dl,%dl
+  802fe7:	74 10                	je     802ff9 <strlcpy+0x29>
+            *dst++ = *src++;
+  802fe9:	48 83 c6 01          	add    $0x1,%rsi
+  802fed:	48 83 c0 01          	add    $0x1,%rax
+  802ff1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802ff4:	48 39 c8             	cmp    %rcx,%rax
+  802ff7:	75 e9                	jne    802fe2 <strlcpy+0x12>
+        *dst = '\0';
+  802ff9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802ffc:	48 29 f8             	sub    %rdi,%rax
+}
+  802fff:	c3                   	ret
+
+0000000000803000 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803000:	0f b6 07             	movzbl (%rdi),%eax
+  803003:	84 c0                	test   %al,%al
+  803005:	74 13                	je     80301a <strcmp+0x1a>
+  803007:	38 06                	cmp    %al,(%rsi)
+  803009:	75 0f                	jne    80301a <strcmp+0x1a>
+  80300b:	48 83 c7 01          	add    $0x1,%rdi
+  80300f:	48 83 c6 01          	add    $0x1,%rsi
+  803013:	0f b6 07             	movzbl (%rdi),%eax
+  803016:	84 c0                	test   %al,%al
+  803018:	75 ed                	jne    803007 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80301a:	0f b6 c0             	movzbl %al,%eax
+  80301d:	0f b6 16             	movzbl (%rsi),%edx
+  803020:	29 d0                	sub    %edx,%eax
+}
+  803022:	c3                   	ret
+
+0000000000803023 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803023:	48 85 d2             	test   %rdx,%rdx
+  803026:	74 1f                	je     803047 <strncmp+0x24>
+  803028:	0f b6 07             	movzbl (%rdi),%eax
+  80302b:	84 c0                	test   %al,%al
+  80302d:	74 1e                	je     80304d <strncmp+0x2a>
+  80302f:	3a 06                	cmp    (%rsi),%al
+  803031:	75 1a                	jne    80304d <strncmp+0x2a>
+  803033:	48 83 c7 01          	add    $0x1,%rdi
+  803037:	48 83 c6 01          	add    $0x1,%rsi
+  80303b:	48 83 ea 01          	sub    $0x1,%rdx
+  80303f:	75 e7                	jne    803028 <strncmp+0x5>
+
+    if (!n) return 0;
+  803041:	b8 00 00 00 00       	mov    $0x0,%eax
+  803046:	c3                   	ret
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	c3                   	ret
+  80304d:	48 85 d2             	test   %rdx,%rdx
+  803050:	74 09                	je     80305b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803052:	0f b6 07             	movzbl (%rdi),%eax
+  803055:	0f b6 16             	movzbl (%rsi),%edx
+  803058:	29 d0                	sub    %edx,%eax
+  80305a:	c3                   	ret
+    if (!n) return 0;
+  80305b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803060:	c3                   	ret
+
+0000000000803061 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803061:	0f b6 17             	movzbl (%rdi),%edx
+  803064:	84 d2                	test   %dl,%dl
+  803066:	74 18                	je     803080 <strchr+0x1f>
+        if (*str == c) {
+  803068:	0f be d2             	movsbl %dl,%edx
+  80306b:	39 f2                	cmp    %esi,%edx
+  80306d:	74 17                	je     803086 <strchr+0x25>
+    for (; *str; str++) {
+  80306f:	48 83 c7 01          	add    $0x1,%rdi
+  803073:	0f b6 17             	movzbl (%rdi),%edx
+  803076:	84 d2                	test   %dl,%dl
+  803078:	75 ee                	jne    803068 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80307a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307f:	c3                   	ret
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+  803085:	c3                   	ret
+  803086:	48 89 f8             	mov    %rdi,%rax
+}
+  803089:	c3                   	ret
+
+000000000080308a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80308a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80308d:	0f b6 17             	movzbl (%rdi),%edx
+  803090:	84 d2                	test   %dl,%dl
+  803092:	74 13                	je     8030a7 <strfind+0x1d>
+  803094:	0f be d2             	movsbl %dl,%edx
+  803097:	39 f2                	cmp    %esi,%edx
+  803099:	74 0b                	je     8030a6 <strfind+0x1c>
+  80309b:	48 83 c0 01          	add    $0x1,%rax
+  80309f:	0f b6 10             	movzbl (%rax),%edx
+  8030a2:	84 d2                	test   %dl,%dl
+  8030a4:	75 ee                	jne    803094 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030a6:	c3                   	ret
+  8030a7:	c3                   	ret
+
+00000000008030a8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030a8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030ab:	48 89 f8             	mov    %rdi,%rax
+  8030ae:	48 f7 d8             	neg    %rax
+  8030b1:	83 e0 07             	and    $0x7,%eax
+  8030b4:	49 89 d1             	mov    %rdx,%r9
+  8030b7:	49 29 c1             	sub    %rax,%r9
+  8030ba:	78 36                	js     8030f2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030bc:	40 0f b6 c6          	movzbl %sil,%eax
+  8030c0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030c7:	01 01 01 
+  8030ca:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030ce:	40 f6 c7 07          	test   $0x7,%dil
+  8030d2:	75 38                	jne    80310c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030d4:	4c 89 c9             	mov    %r9,%rcx
+  8030d7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030db:	74 0c                	je     8030e9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030dd:	fc                   	cld
+  8030de:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030e1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030e5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030e9:	4d 85 c9             	test   %r9,%r9
+  8030ec:	75 45                	jne    803133 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8030ee:	4c 89 c0             	mov    %r8,%rax
+  8030f1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8030f2:	48 85 d2             	test   %rdx,%rdx
+  8030f5:	74 f7                	je     8030ee <memset+0x46>
+  8030f7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8030fa:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8030fd:	48 83 c0 01          	add    $0x1,%rax
+  803101:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803105:	48 39 c2             	cmp    %rax,%rdx
+  803108:	75 f3                	jne    8030fd <memset+0x55>
+  80310a:	eb e2                	jmp    8030ee <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80310c:	40 f6 c7 01          	test   $0x1,%dil
+  803110:	74 06                	je     803118 <memset+0x70>
+  803112:	88 07                	mov    %al,(%rdi)
+  803114:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803118:	40 f6 c7 02          	test   $0x2,%dil
+  80311c:	74 07                	je     803125 <memset+0x7d>
+  80311e:	66 89 07             	mov    %ax,(%rdi)
+  803121:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803125:	40 f6 c7 04          	test   $0x4,%dil
+  803129:	74 a9                	je     8030d4 <memset+0x2c>
+  80312b:	89 07                	mov    %eax,(%rdi)
+  80312d:	48 83 c7 04          	add    $0x4,%rdi
+  803131:	eb a1                	jmp    8030d4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803133:	41 f6 c1 04          	test   $0x4,%r9b
+  803137:	74 06                	je     80313f <memset+0x97>
+  803139:	89 07                	mov    %eax,(%rdi)
+  80313b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80313f:	41 f6 c1 02          	test   $0x2,%r9b
+  803143:	74 07                	je     80314c <memset+0xa4>
+  803145:	66 89 07             	mov    %ax,(%rdi)
+  803148:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80314c:	41 f6 c1 01          	test   $0x1,%r9b
+  803150:	74 9c                	je     8030ee <memset+0x46>
+  803152:	88 07                	mov    %al,(%rdi)
+  803154:	eb 98                	jmp    8030ee <memset+0x46>
+
+0000000000803156 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803156:	48 89 f8             	mov    %rdi,%rax
+  803159:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80315c:	48 39 fe             	cmp    %rdi,%rsi
+  80315f:	73 3b                	jae    80319c <memmove+0x46>
+  803161:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803165:	48 39 d7             	cmp    %rdx,%rdi
+  803168:	73 32                	jae    80319c <memmove+0x46>
+        s += n;
+        d += n;
+  80316a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80316e:	48 89 d6             	mov    %rdx,%rsi
+  803171:	48 09 fe             	or     %rdi,%rsi
+  803174:	48 09 ce             	or     %rcx,%rsi
+  803177:	40 f6 c6 07          	test   $0x7,%sil
+  80317b:	75 12                	jne    80318f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80317d:	48 83 ef 08          	sub    $0x8,%rdi
+  803181:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803185:	48 c1 e9 03          	shr    $0x3,%rcx
+  803189:	fd                   	std
+  80318a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80318d:	fc                   	cld
+  80318e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80318f:	48 83 ef 01          	sub    $0x1,%rdi
+  803193:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803197:	fd                   	std
+  803198:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80319a:	eb f1                	jmp    80318d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80319c:	48 89 f2             	mov    %rsi,%rdx
+  80319f:	48 09 c2             	or     %rax,%rdx
+  8031a2:	48 09 ca             	or     %rcx,%rdx
+  8031a5:	f6 c2 07             	test   $0x7,%dl
+  8031a8:	75 0c                	jne    8031b6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031aa:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031ae:	48 89 c7             	mov    %rax,%rdi
+  8031b1:	fc                   	cld
+  8031b2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031b5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031b6:	48 89 c7             	mov    %rax,%rdi
+  8031b9:	fc                   	cld
+  8031ba:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031bc:	c3                   	ret
+
+00000000008031bd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031bd:	55                   	push   %rbp
+  8031be:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031c1:	48 b8 56 31 80 00 00 	movabs $0x803156,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+}
+  8031cd:	5d                   	pop    %rbp
+  8031ce:	c3                   	ret
+
+00000000008031cf <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031cf:	55                   	push   %rbp
+  8031d0:	48 89 e5             	mov    %rsp,%rbp
+  8031d3:	41 57                	push   %r15
+  8031d5:	41 56                	push   %r14
+  8031d7:	41 55                	push   %r13
+  8031d9:	41 54                	push   %r12
+  8031db:	53                   	push   %rbx
+  8031dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e0:	49 89 fe             	mov    %rdi,%r14
+  8031e3:	49 89 f7             	mov    %rsi,%r15
+  8031e6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031e9:	48 89 f7             	mov    %rsi,%rdi
+  8031ec:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  8031f3:	00 00 00 
+  8031f6:	ff d0                	call   *%rax
+  8031f8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8031fb:	48 89 de             	mov    %rbx,%rsi
+  8031fe:	4c 89 f7             	mov    %r14,%rdi
+  803201:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  803208:	00 00 00 
+  80320b:	ff d0                	call   *%rax
+  80320d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803210:	48 39 c3             	cmp    %rax,%rbx
+  803213:	74 36                	je     80324b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803215:	48 89 d8             	mov    %rbx,%rax
+  803218:	4c 29 e8             	sub    %r13,%rax
+  80321b:	49 39 c4             	cmp    %rax,%r12
+  80321e:	73 31                	jae    803251 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803220:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803225:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803229:	4c 89 fe             	mov    %r15,%rsi
+  80322c:	48 b8 bd 31 80 00 00 	movabs $0x8031bd,%rax
+  803233:	00 00 00 
+  803236:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803238:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80323c:	48 83 c4 08          	add    $0x8,%rsp
+  803240:	5b                   	pop    %rbx
+  803241:	41 5c                	pop    %r12
+  803243:	41 5d                	pop    %r13
+  803245:	41 5e                	pop    %r14
+  803247:	41 5f                	pop    %r15
+  803249:	5d                   	pop    %rbp
+  80324a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80324b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80324f:	eb eb                	jmp    80323c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803251:	48 83 eb 01          	sub    $0x1,%rbx
+  803255:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803259:	48 89 da             	mov    %rbx,%rdx
+  80325c:	4c 89 fe             	mov    %r15,%rsi
+  80325f:	48 b8 bd 31 80 00 00 	movabs $0x8031bd,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80326b:	49 01 de             	add    %rbx,%r14
+  80326e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803273:	eb c3                	jmp    803238 <strlcat+0x69>
+
+0000000000803275 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803275:	48 85 d2             	test   %rdx,%rdx
+  803278:	74 2d                	je     8032a7 <memcmp+0x32>
+  80327a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80327f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803283:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803288:	44 38 c1             	cmp    %r8b,%cl
+  80328b:	75 0f                	jne    80329c <memcmp+0x27>
+    while (n-- > 0) {
+  80328d:	48 83 c0 01          	add    $0x1,%rax
+  803291:	48 39 c2             	cmp    %rax,%rdx
+  803294:	75 e9                	jne    80327f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80329c:	0f b6 c1             	movzbl %cl,%eax
+  80329f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032a3:	44 29 c0             	sub    %r8d,%eax
+  8032a6:	c3                   	ret
+    return 0;
+  8032a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ac:	c3                   	ret
+
+00000000008032ad <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032ad:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032b1:	48 39 c7             	cmp    %rax,%rdi
+  8032b4:	73 0f                	jae    8032c5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032b6:	40 38 37             	cmp    %sil,(%rdi)
+  8032b9:	74 0e                	je     8032c9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032bb:	48 83 c7 01          	add    $0x1,%rdi
+  8032bf:	48 39 f8             	cmp    %rdi,%rax
+  8032c2:	75 f2                	jne    8032b6 <memfind+0x9>
+  8032c4:	c3                   	ret
+  8032c5:	48 89 f8             	mov    %rdi,%rax
+  8032c8:	c3                   	ret
+  8032c9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032cc:	c3                   	ret
+
+00000000008032cd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032cd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032d0:	0f b6 37             	movzbl (%rdi),%esi
+  8032d3:	40 80 fe 20          	cmp    $0x20,%sil
+  8032d7:	74 06                	je     8032df <strtol+0x12>
+  8032d9:	40 80 fe 09          	cmp    $0x9,%sil
+  8032dd:	75 13                	jne    8032f2 <strtol+0x25>
+  8032df:	48 83 c7 01          	add    $0x1,%rdi
+  8032e3:	0f b6 37             	movzbl (%rdi),%esi
+  8032e6:	40 80 fe 20          	cmp    $0x20,%sil
+  8032ea:	74 f3                	je     8032df <strtol+0x12>
+  8032ec:	40 80 fe 09          	cmp    $0x9,%sil
+  8032f0:	74 ed                	je     8032df <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8032f2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8032f5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032f8:	3c 01                	cmp    $0x1,%al
+  8032fa:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8032fe:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803304:	75 0f                	jne    803315 <strtol+0x48>
+  803306:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803309:	74 14                	je     80331f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80330b:	85 d2                	test   %edx,%edx
+  80330d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803312:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803315:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80331a:	4c 63 ca             	movslq %edx,%r9
+  80331d:	eb 36                	jmp    803355 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80331f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803323:	74 0f                	je     803334 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803325:	85 d2                	test   %edx,%edx
+  803327:	75 ec                	jne    803315 <strtol+0x48>
+        s++;
+  803329:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80332d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803332:	eb e1                	jmp    803315 <strtol+0x48>
+        s += 2;
+  803334:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803338:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80333d:	eb d6                	jmp    803315 <strtol+0x48>
+            dig -= '0';
+  80333f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803342:	44 0f b6 c1          	movzbl %cl,%r8d
+  803346:	41 39 d0             	cmp    %edx,%r8d
+  803349:	7d 21                	jge    80336c <strtol+0x9f>
+        val = val * base + dig;
+  80334b:	49 0f af c1          	imul   %r9,%rax
+  80334f:	0f b6 c9             	movzbl %cl,%ecx
+  803352:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803355:	48 83 c7 01          	add    $0x1,%rdi
+  803359:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80335d:	80 f9 39             	cmp    $0x39,%cl
+  803360:	76 dd                	jbe    80333f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803362:	80 f9 7b             	cmp    $0x7b,%cl
+  803365:	77 05                	ja     80336c <strtol+0x9f>
+            dig -= 'a' - 10;
+  803367:	83 e9 57             	sub    $0x57,%ecx
+  80336a:	eb d6                	jmp    803342 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80336c:	4d 85 d2             	test   %r10,%r10
+  80336f:	74 03                	je     803374 <strtol+0xa7>
+  803371:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803374:	48 89 c2             	mov    %rax,%rdx
+  803377:	48 f7 da             	neg    %rdx
+  80337a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80337e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803382:	c3                   	ret
+
+0000000000803383 <strrev>:
+
+void
+strrev(char *str)
+{
+  803383:	55                   	push   %rbp
+  803384:	48 89 e5             	mov    %rsp,%rbp
+  803387:	53                   	push   %rbx
+  803388:	48 83 ec 08          	sub    $0x8,%rsp
+  80338c:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80338f:	48 b8 1e 2f 80 00 00 	movabs $0x802f1e,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80339b:	83 e8 01             	sub    $0x1,%eax
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	7e 22                	jle    8033c4 <strrev+0x41>
+  8033a2:	48 98                	cltq
+  8033a4:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033a9:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033ad:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033b1:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033b5:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b8:	48 83 c2 01          	add    $0x1,%rdx
+  8033bc:	48 83 e8 01          	sub    $0x1,%rax
+  8033c0:	39 c2                	cmp    %eax,%edx
+  8033c2:	7c e5                	jl     8033a9 <strrev+0x26>
+	}
+}
+  8033c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+00000000008033ca <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033ca:	85 d2                	test   %edx,%edx
+  8033cc:	0f 84 80 00 00 00    	je     803452 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033d2:	55                   	push   %rbp
+  8033d3:	48 89 e5             	mov    %rsp,%rbp
+  8033d6:	53                   	push   %rbx
+  8033d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8033db:	49 89 f2             	mov    %rsi,%r10
+  8033de:	41 89 d3             	mov    %edx,%r11d
+  8033e1:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033e4:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033e9:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8033ec:	eb 20                	jmp    80340e <itoa+0x44>
+			str[i++] = '0' + digit;
+  8033ee:	41 89 f1             	mov    %esi,%r9d
+  8033f1:	83 c2 30             	add    $0x30,%edx
+  8033f4:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8033f7:	89 f8                	mov    %edi,%eax
+  8033f9:	99                   	cltd
+  8033fa:	f7 f9                	idiv   %ecx
+  8033fc:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	74 2e                	je     803430 <itoa+0x66>
+  803402:	83 c6 01             	add    $0x1,%esi
+  803405:	49 83 c0 01          	add    $0x1,%r8
+  803409:	44 39 cb             	cmp    %r9d,%ebx
+  80340c:	7e 15                	jle    803423 <itoa+0x59>
+		digit = sum % base;
+  80340e:	89 f8                	mov    %edi,%eax
+  803410:	99                   	cltd
+  803411:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803413:	83 fa 09             	cmp    $0x9,%edx
+  803416:	7e d6                	jle    8033ee <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803418:	41 89 f1             	mov    %esi,%r9d
+  80341b:	83 c2 37             	add    $0x37,%edx
+  80341e:	41 88 10             	mov    %dl,(%r8)
+  803421:	eb d4                	jmp    8033f7 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803423:	41 83 eb 01          	sub    $0x1,%r11d
+  803427:	45 39 cb             	cmp    %r9d,%r11d
+  80342a:	75 04                	jne    803430 <itoa+0x66>
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	75 28                	jne    803458 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  803430:	4d 63 c9             	movslq %r9d,%r9
+  803433:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803438:	4c 89 d7             	mov    %r10,%rdi
+  80343b:	48 b8 83 33 80 00 00 	movabs $0x803383,%rax
+  803442:	00 00 00 
+  803445:	ff d0                	call   *%rax
+	return 0;
+  803447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803450:	c9                   	leave
+  803451:	c3                   	ret
+		return -1;
+  803452:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803457:	c3                   	ret
+		return -1;
+  803458:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80345d:	eb ed                	jmp    80344c <itoa+0x82>
+
+000000000080345f <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+  803463:	41 55                	push   %r13
+  803465:	41 54                	push   %r12
+  803467:	53                   	push   %rbx
+  803468:	48 83 ec 08          	sub    $0x8,%rsp
+  80346c:	49 89 fc             	mov    %rdi,%r12
+  80346f:	48 89 f7             	mov    %rsi,%rdi
+  803472:	48 89 d3             	mov    %rdx,%rbx
+  803475:	49 89 cd             	mov    %rcx,%r13
+  803478:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80347b:	48 85 f6             	test   %rsi,%rsi
+  80347e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803485:	00 00 00 
+  803488:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80348c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803491:	48 85 db             	test   %rbx,%rbx
+  803494:	74 03                	je     803499 <ipc_recv_timed+0x3a>
+  803496:	48 8b 33             	mov    (%rbx),%rsi
+  803499:	48 b8 20 05 80 00 00 	movabs $0x800520,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034a5:	85 c0                	test   %eax,%eax
+  8034a7:	78 75                	js     80351e <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034a9:	4d 85 e4             	test   %r12,%r12
+  8034ac:	74 14                	je     8034c2 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034ae:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034b5:	00 00 00 
+  8034b8:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034be:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034c2:	4d 85 ed             	test   %r13,%r13
+  8034c5:	74 14                	je     8034db <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034c7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ce:	00 00 00 
+  8034d1:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034d7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034db:	48 85 db             	test   %rbx,%rbx
+  8034de:	74 23                	je     803503 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034e0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e7:	00 00 00 
+  8034ea:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8034f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f5:	85 c9                	test   %ecx,%ecx
+  8034f7:	74 07                	je     803500 <ipc_recv_timed+0xa1>
+  8034f9:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803500:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803503:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80350a:	00 00 00 
+  80350d:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803513:	48 83 c4 08          	add    $0x8,%rsp
+  803517:	5b                   	pop    %rbx
+  803518:	41 5c                	pop    %r12
+  80351a:	41 5d                	pop    %r13
+  80351c:	5d                   	pop    %rbp
+  80351d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80351e:	4d 85 e4             	test   %r12,%r12
+  803521:	74 08                	je     80352b <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803523:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80352a:	00 
+        if (perm_store != NULL) {
+  80352b:	4d 85 ed             	test   %r13,%r13
+  80352e:	74 08                	je     803538 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803530:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803537:	00 
+        if (size != NULL) {
+  803538:	48 85 db             	test   %rbx,%rbx
+  80353b:	74 d6                	je     803513 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80353d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803544:	eb cd                	jmp    803513 <ipc_recv_timed+0xb4>
+
+0000000000803546 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80354a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803550:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+}
+  80355c:	5d                   	pop    %rbp
+  80355d:	c3                   	ret
+
+000000000080355e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80355e:	55                   	push   %rbp
+  80355f:	48 89 e5             	mov    %rsp,%rbp
+  803562:	41 57                	push   %r15
+  803564:	41 56                	push   %r14
+  803566:	41 55                	push   %r13
+  803568:	41 54                	push   %r12
+  80356a:	53                   	push   %rbx
+  80356b:	48 83 ec 18          	sub    $0x18,%rsp
+  80356f:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803572:	48 89 d3             	mov    %rdx,%rbx
+  803575:	49 89 cc             	mov    %rcx,%r12
+  803578:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80357b:	48 85 d2             	test   %rdx,%rdx
+  80357e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803585:	00 00 00 
+  803588:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80358c:	89 f0                	mov    %esi,%eax
+  80358e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803592:	48 89 da             	mov    %rbx,%rdx
+  803595:	48 89 c6             	mov    %rax,%rsi
+  803598:	48 b8 f4 04 80 00 00 	movabs $0x8004f4,%rax
+  80359f:	00 00 00 
+  8035a2:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	79 65                	jns    80360d <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035a8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035ab:	75 33                	jne    8035e0 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035ad:	49 bf f7 01 80 00 00 	movabs $0x8001f7,%r15
+  8035b4:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035b7:	49 be f4 04 80 00 00 	movabs $0x8004f4,%r14
+  8035be:	00 00 00 
+        sys_yield();
+  8035c1:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035c4:	45 89 e8             	mov    %r13d,%r8d
+  8035c7:	4c 89 e1             	mov    %r12,%rcx
+  8035ca:	48 89 da             	mov    %rbx,%rdx
+  8035cd:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035d1:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035d4:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	79 32                	jns    80360d <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035db:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035de:	74 e1                	je     8035c1 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035e0:	89 c1                	mov    %eax,%ecx
+  8035e2:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  8035e9:	00 00 00 
+  8035ec:	be 52 00 00 00       	mov    $0x52,%esi
+  8035f1:	48 bf 3b 3d 80 00 00 	movabs $0x803d3b,%rdi
+  8035f8:	00 00 00 
+  8035fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803600:	49 b8 e7 24 80 00 00 	movabs $0x8024e7,%r8
+  803607:	00 00 00 
+  80360a:	41 ff d0             	call   *%r8
+    }
+}
+  80360d:	48 83 c4 18          	add    $0x18,%rsp
+  803611:	5b                   	pop    %rbx
+  803612:	41 5c                	pop    %r12
+  803614:	41 5d                	pop    %r13
+  803616:	41 5e                	pop    %r14
+  803618:	41 5f                	pop    %r15
+  80361a:	5d                   	pop    %rbp
+  80361b:	c3                   	ret
+
+000000000080361c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80361c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803621:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803628:	00 00 00 
+  80362b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80362f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803633:	48 c1 e2 04          	shl    $0x4,%rdx
+  803637:	48 01 ca             	add    %rcx,%rdx
+  80363a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803640:	39 fa                	cmp    %edi,%edx
+  803642:	74 12                	je     803656 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803644:	48 83 c0 01          	add    $0x1,%rax
+  803648:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80364e:	75 db                	jne    80362b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803655:	c3                   	ret
+            return envs[i].env_id;
+  803656:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80365a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80365e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803662:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803669:	00 00 00 
+  80366c:	48 01 d0             	add    %rdx,%rax
+  80366f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803675:	c3                   	ret
+  803676:	66 90                	xchg   %ax,%ax
+
+0000000000803678 <__rodata_start>:
+  803678:	3c 75                	cmp    $0x75,%al
+  80367a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80367b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80367f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803680:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803684:	1f                   	(bad)
+  803685:	44 00 00             	add    %r8b,(%rax)
+  803688:	73 79                	jae    803703 <__rodata_start+0x8b>
+  80368a:	73 63                	jae    8036ef <__rodata_start+0x77>
+  80368c:	61                   	(bad)
+  80368d:	6c                   	insb   (%dx),%es:(%rdi)
+  80368e:	6c                   	insb   (%dx),%es:(%rdi)
+  80368f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b0f <__bss_end+0x72201b0f>
+  803695:	65 74 75             	gs je  80370d <__rodata_start+0x95>
+  803698:	72 6e                	jb     803708 <__rodata_start+0x90>
+  80369a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b1c <__bss_end+0x28201b1c>
+  8036a1:	28 
+  8036a2:	3e 20 30             	ds and %dh,(%rax)
+  8036a5:	29 00                	sub    %eax,(%rax)
+  8036a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036af:	61                   	(bad)
+  8036b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b2:	2e 63 00             	cs movsxd (%rax),%eax
+  8036b5:	0f 1f 00             	nopl   (%rax)
+  8036b8:	5b                   	pop    %rbx
+  8036b9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036be:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036c1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036ca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036d1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80413c <devpipe+0x7c>
+  8036d8:	5b                   	pop    %rbx
+  8036d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036de:	20 72 65             	and    %dh,0x65(%rdx)
+  8036e1:	61                   	(bad)
+  8036e2:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036e4:	61                   	(bad)
+  8036e5:	70 20                	jo     803707 <__rodata_start+0x8f>
+  8036e7:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8036ec:	20 62 61             	and    %ah,0x61(%rdx)
+  8036ef:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8036f3:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8036f7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8036fa:	30 38                	xor    %bh,(%rax)
+  8036fc:	78 5d                	js     80375b <__rodata_start+0xe3>
+  8036fe:	20 66 74             	and    %ah,0x74(%rsi)
+  803701:	72 75                	jb     803778 <devtab+0x18>
+  803703:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803704:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803707:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad5772 <__bss_end+0x2d2cd772>
+  80370e:	20 62 61             	and    %ah,0x61(%rdx)
+  803711:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803715:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803719:	5b                   	pop    %rbx
+  80371a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80371f:	20 72 65             	and    %dh,0x65(%rdx)
+  803722:	61                   	(bad)
+  803723:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad578e <__bss_end+0x2d2cd78e>
+  80372a:	20 62 61             	and    %ah,0x61(%rdx)
+  80372d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803731:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803735:	5b                   	pop    %rbx
+  803736:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80373b:	20 77 72             	and    %dh,0x72(%rdi)
+  80373e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  803745:	2d 
+  803746:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80374b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80374e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803759:	00 00 00 
+  80375c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803770:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8037e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8037f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8038e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8038f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803990:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039a0:	24 28 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     $(......e.......
+  8039b0:	55 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     U.......e.......
+  8039c0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  8039d0:	65 2e 80 00 00 00 00 00 43 28 80 00 00 00 00 00     e.......C(......
+  8039e0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  8039f0:	37 28 80 00 00 00 00 00 b1 28 80 00 00 00 00 00     7(.......(......
+  803a00:	65 2e 80 00 00 00 00 00 37 28 80 00 00 00 00 00     e.......7(......
+  803a10:	7d 28 80 00 00 00 00 00 7d 28 80 00 00 00 00 00     }(......}(......
+  803a20:	7d 28 80 00 00 00 00 00 7d 28 80 00 00 00 00 00     }(......}(......
+  803a30:	7d 28 80 00 00 00 00 00 7d 28 80 00 00 00 00 00     }(......}(......
+  803a40:	7d 28 80 00 00 00 00 00 7d 28 80 00 00 00 00 00     }(......}(......
+  803a50:	7d 28 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     }(......e.......
+  803a60:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803a70:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803a80:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803a90:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803aa0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803ab0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803ac0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803ad0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803ae0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803af0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b00:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b10:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b20:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b30:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b40:	65 2e 80 00 00 00 00 00 88 2d 80 00 00 00 00 00     e........-......
+  803b50:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b60:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b70:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b80:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803b90:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803ba0:	d4 28 80 00 00 00 00 00 a3 2a 80 00 00 00 00 00     .(.......*......
+  803bb0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803bc0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803bd0:	03 29 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     .)......e.......
+  803be0:	65 2e 80 00 00 00 00 00 c9 28 80 00 00 00 00 00     e........(......
+  803bf0:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803c00:	4b 2c 80 00 00 00 00 00 15 2d 80 00 00 00 00 00     K,.......-......
+  803c10:	65 2e 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     e.......e.......
+  803c20:	9a 29 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     .)......e.......
+  803c30:	77 2b 80 00 00 00 00 00 65 2e 80 00 00 00 00 00     w+......e.......
+  803c40:	65 2e 80 00 00 00 00 00 88 2d 80 00 00 00 00 00     e........-......
+  803c50:	65 2e 80 00 00 00 00 00 2d 28 80 00 00 00 00 00     e.......-(......
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	35 38 80 00 00 00 00 00 47 38 80 00 00 00 00 00     58......G8......
+  803c78:	57 38 80 00 00 00 00 00 69 38 80 00 00 00 00 00     W8......i8......
+  803c88:	77 38 80 00 00 00 00 00 8b 38 80 00 00 00 00 00     w8.......8......
+  803c98:	a0 38 80 00 00 00 00 00 b3 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	c5 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	e9 38 80 00 00 00 00 00 fc 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	13 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803cd8:	41 39 80 00 00 00 00 00 59 39 80 00 00 00 00 00     A9......Y9......
+  803ce8:	66 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     f9.......=......
+  803cf8:	7a 39 80 00 00 00 00 00 92 39 80 00 00 00 00 00     z9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d28:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d38:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
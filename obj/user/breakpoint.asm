@@ -0,0 +1,6616 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	41 89 fd             	mov    %edi,%r13d
+  800035:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800038:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80003f:	00 00 00 
+  800042:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800049:	00 00 00 
+  80004c:	48 39 c2             	cmp    %rax,%rdx
+  80004f:	73 17                	jae    800068 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800051:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800054:	49 89 c4             	mov    %rax,%r12
+  800057:	48 83 c3 08          	add    $0x8,%rbx
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	ff 53 f8             	call   *-0x8(%rbx)
+  800063:	4c 39 e3             	cmp    %r12,%rbx
+  800066:	72 ef                	jb     800057 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800068:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800079:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80007d:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800081:	48 c1 e0 04          	shl    $0x4,%rax
+  800085:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008c:	00 00 00 
+  80008f:	48 01 d0             	add    %rdx,%rax
+  800092:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800099:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009c:	45 85 ed             	test   %r13d,%r13d
+  80009f:	7e 0d                	jle    8000ae <libmain+0x87>
+  8000a1:	49 8b 06             	mov    (%r14),%rax
+  8000a4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ae:	4c 89 f6             	mov    %r14,%rsi
+  8000b1:	44 89 ef             	mov    %r13d,%edi
+  8000b4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c0:	48 b8 d5 00 80 00 00 	movabs $0x8000d5,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+#endif
+}
+  8000cc:	5b                   	pop    %rbx
+  8000cd:	41 5c                	pop    %r12
+  8000cf:	41 5d                	pop    %r13
+  8000d1:	41 5e                	pop    %r14
+  8000d3:	5d                   	pop    %rbp
+  8000d4:	c3                   	ret
+
+00000000008000d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d5:	55                   	push   %rbp
+  8000d6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d9:	48 b8 77 08 80 00 00 	movabs $0x800877,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ea:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+}
+  8000f6:	5d                   	pop    %rbp
+  8000f7:	c3                   	ret
+
+00000000008000f8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+  8000fc:	53                   	push   %rbx
+  8000fd:	48 89 fa             	mov    %rdi,%rdx
+  800100:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80010d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800112:	be 00 00 00 00       	mov    $0x0,%esi
+  800117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80011d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+
+0000000000800125 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800125:	55                   	push   %rbp
+  800126:	48 89 e5             	mov    %rsp,%rbp
+  800129:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800143:	be 00 00 00 00       	mov    $0x0,%esi
+  800148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+0000000000800156 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	53                   	push   %rbx
+  80015b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800162:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800167:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800171:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800176:	be 00 00 00 00       	mov    $0x0,%esi
+  80017b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800181:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800183:	48 85 c0             	test   %rax,%rax
+  800186:	7f 06                	jg     80018e <sys_env_destroy+0x38>
+}
+  800188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018e:	49 89 c0             	mov    %rax,%r8
+  800191:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800196:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80019d:	00 00 00 
+  8001a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a5:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8001ac:	00 00 00 
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  8001bb:	00 00 00 
+  8001be:	41 ff d1             	call   *%r9
+
+00000000008001c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c1:	55                   	push   %rbp
+  8001c2:	48 89 e5             	mov    %rsp,%rbp
+  8001c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001df:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+00000000008001f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f2:	55                   	push   %rbp
+  8001f3:	48 89 e5             	mov    %rsp,%rbp
+  8001f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800201:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800210:	be 00 00 00 00       	mov    $0x0,%esi
+  800215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80021b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	53                   	push   %rbx
+  800228:	48 89 fa             	mov    %rdi,%rdx
+  80022b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800233:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023a:	00 00 00 
+  80023d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800242:	be 00 00 00 00       	mov    $0x0,%esi
+  800247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+
+0000000000800255 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	53                   	push   %rbx
+  80025a:	49 89 f8             	mov    %rdi,%r8
+  80025d:	48 89 d3             	mov    %rdx,%rbx
+  800260:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800263:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800268:	4c 89 c2             	mov    %r8,%rdx
+  80026b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026e:	be 00 00 00 00       	mov    $0x0,%esi
+  800273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800279:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+0000000000800281 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	53                   	push   %rbx
+  800286:	48 83 ec 08          	sub    $0x8,%rsp
+  80028a:	89 f8                	mov    %edi,%eax
+  80028c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028f:	48 63 f9             	movslq %ecx,%rdi
+  800292:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800295:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029d:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002aa:	48 85 c0             	test   %rax,%rax
+  8002ad:	7f 06                	jg     8002b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b3:	c9                   	leave
+  8002b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b5:	49 89 c0             	mov    %rax,%r8
+  8002b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002bd:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8002c4:	00 00 00 
+  8002c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8002cc:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8002d3:	00 00 00 
+  8002d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002db:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  8002e2:	00 00 00 
+  8002e5:	41 ff d1             	call   *%r9
+
+00000000008002e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e8:	55                   	push   %rbp
+  8002e9:	48 89 e5             	mov    %rsp,%rbp
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f1:	89 f8                	mov    %edi,%eax
+  8002f3:	49 89 f2             	mov    %rsi,%r10
+  8002f6:	48 89 cf             	mov    %rcx,%rdi
+  8002f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002fc:	48 63 da             	movslq %edx,%rbx
+  8002ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800302:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800307:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80030d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030f:	48 85 c0             	test   %rax,%rax
+  800312:	7f 06                	jg     80031a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031a:	49 89 c0             	mov    %rax,%r8
+  80031d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800322:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800329:	00 00 00 
+  80032c:	be 26 00 00 00       	mov    $0x26,%esi
+  800331:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800338:	00 00 00 
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  800347:	00 00 00 
+  80034a:	41 ff d1             	call   *%r9
+
+000000000080034d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80034d:	55                   	push   %rbp
+  80034e:	48 89 e5             	mov    %rsp,%rbp
+  800351:	53                   	push   %rbx
+  800352:	48 83 ec 08          	sub    $0x8,%rsp
+  800356:	48 89 f1             	mov    %rsi,%rcx
+  800359:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80035c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800364:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800369:	be 00 00 00 00       	mov    $0x0,%esi
+  80036e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800374:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800376:	48 85 c0             	test   %rax,%rax
+  800379:	7f 06                	jg     800381 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80037b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037f:	c9                   	leave
+  800380:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800381:	49 89 c0             	mov    %rax,%r8
+  800384:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800389:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800390:	00 00 00 
+  800393:	be 26 00 00 00       	mov    $0x26,%esi
+  800398:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  80039f:	00 00 00 
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  8003ae:	00 00 00 
+  8003b1:	41 ff d1             	call   *%r9
+
+00000000008003b4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003b4:	55                   	push   %rbp
+  8003b5:	48 89 e5             	mov    %rsp,%rbp
+  8003b8:	53                   	push   %rbx
+  8003b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003bd:	48 63 ce             	movslq %esi,%rcx
+  8003c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	7f 06                	jg     8003ea <sys_env_set_status+0x36>
+}
+  8003e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ea:	49 89 c0             	mov    %rax,%r8
+  8003ed:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8003f2:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8003f9:	00 00 00 
+  8003fc:	be 26 00 00 00       	mov    $0x26,%esi
+  800401:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800408:	00 00 00 
+  80040b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800410:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  800417:	00 00 00 
+  80041a:	41 ff d1             	call   *%r9
+
+000000000080041d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 08          	sub    $0x8,%rsp
+  800426:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800429:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800436:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043b:	be 00 00 00 00       	mov    $0x0,%esi
+  800440:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800446:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800448:	48 85 c0             	test   %rax,%rax
+  80044b:	7f 06                	jg     800453 <sys_env_set_trapframe+0x36>
+}
+  80044d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800451:	c9                   	leave
+  800452:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800453:	49 89 c0             	mov    %rax,%r8
+  800456:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80045b:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800462:	00 00 00 
+  800465:	be 26 00 00 00       	mov    $0x26,%esi
+  80046a:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800471:	00 00 00 
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  800480:	00 00 00 
+  800483:	41 ff d1             	call   *%r9
+
+0000000000800486 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800486:	55                   	push   %rbp
+  800487:	48 89 e5             	mov    %rsp,%rbp
+  80048a:	53                   	push   %rbx
+  80048b:	48 83 ec 08          	sub    $0x8,%rsp
+  80048f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800492:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800495:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b1:	48 85 c0             	test   %rax,%rax
+  8004b4:	7f 06                	jg     8004bc <sys_env_set_pgfault_upcall+0x36>
+}
+  8004b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004ba:	c9                   	leave
+  8004bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004bc:	49 89 c0             	mov    %rax,%r8
+  8004bf:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004c4:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8004cb:	00 00 00 
+  8004ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d3:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8004da:	00 00 00 
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  8004e9:	00 00 00 
+  8004ec:	41 ff d1             	call   *%r9
+
+00000000008004ef <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004ef:	55                   	push   %rbp
+  8004f0:	48 89 e5             	mov    %rsp,%rbp
+  8004f3:	53                   	push   %rbx
+  8004f4:	89 f8                	mov    %edi,%eax
+  8004f6:	49 89 f1             	mov    %rsi,%r9
+  8004f9:	48 89 d3             	mov    %rdx,%rbx
+  8004fc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8004ff:	49 63 f0             	movslq %r8d,%rsi
+  800502:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800505:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80050a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800513:	cd 30                	int    $0x30
+}
+  800515:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800519:	c9                   	leave
+  80051a:	c3                   	ret
+
+000000000080051b <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80051b:	55                   	push   %rbp
+  80051c:	48 89 e5             	mov    %rsp,%rbp
+  80051f:	53                   	push   %rbx
+  800520:	48 83 ec 08          	sub    $0x8,%rsp
+  800524:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800527:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80052a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80052f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800532:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800537:	be 00 00 00 00       	mov    $0x0,%esi
+  80053c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800542:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800544:	48 85 c0             	test   %rax,%rax
+  800547:	7f 06                	jg     80054f <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80054d:	c9                   	leave
+  80054e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80054f:	49 89 c0             	mov    %rax,%r8
+  800552:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800557:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80055e:	00 00 00 
+  800561:	be 26 00 00 00       	mov    $0x26,%esi
+  800566:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  80056d:	00 00 00 
+  800570:	b8 00 00 00 00       	mov    $0x0,%eax
+  800575:	49 b9 e2 24 80 00 00 	movabs $0x8024e2,%r9
+  80057c:	00 00 00 
+  80057f:	41 ff d1             	call   *%r9
+
+0000000000800582 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800582:	55                   	push   %rbp
+  800583:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  800586:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058b:	48 b8 1b 05 80 00 00 	movabs $0x80051b,%rax
+  800592:	00 00 00 
+  800595:	ff d0                	call   *%rax
+}
+  800597:	5d                   	pop    %rbp
+  800598:	c3                   	ret
+
+0000000000800599 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800599:	55                   	push   %rbp
+  80059a:	48 89 e5             	mov    %rsp,%rbp
+  80059d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80059e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005c8:	c9                   	leave
+  8005c9:	c3                   	ret
+
+00000000008005ca <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005ca:	55                   	push   %rbp
+  8005cb:	48 89 e5             	mov    %rsp,%rbp
+  8005ce:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005cf:	48 63 ce             	movslq %esi,%rcx
+  8005d2:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f0:	cd 30                	int    $0x30
+}
+  8005f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f6:	c9                   	leave
+  8005f7:	c3                   	ret
+
+00000000008005f8 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8005f8:	55                   	push   %rbp
+  8005f9:	48 89 e5             	mov    %rsp,%rbp
+  8005fc:	53                   	push   %rbx
+  8005fd:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800600:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800604:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800613:	be 00 00 00 00       	mov    $0x0,%esi
+  800618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80061e:	cd 30                	int    $0x30
+}
+  800620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800624:	c9                   	leave
+  800625:	c3                   	ret
+
+0000000000800626 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800626:	55                   	push   %rbp
+  800627:	48 89 e5             	mov    %rsp,%rbp
+  80062a:	53                   	push   %rbx
+  80062b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80062e:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800631:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800636:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800639:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063e:	be 00 00 00 00       	mov    $0x0,%esi
+  800643:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800649:	cd 30                	int    $0x30
+}
+  80064b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+0000000000800651 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800651:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800658:	ff ff ff 
+  80065b:	48 01 f8             	add    %rdi,%rax
+  80065e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800662:	c3                   	ret
+
+0000000000800663 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800663:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80066a:	ff ff ff 
+  80066d:	48 01 f8             	add    %rdi,%rax
+  800670:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800674:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80067a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80067e:	c3                   	ret
+
+000000000080067f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80067f:	55                   	push   %rbp
+  800680:	48 89 e5             	mov    %rsp,%rbp
+  800683:	41 57                	push   %r15
+  800685:	41 56                	push   %r14
+  800687:	41 55                	push   %r13
+  800689:	41 54                	push   %r12
+  80068b:	53                   	push   %rbx
+  80068c:	48 83 ec 08          	sub    $0x8,%rsp
+  800690:	49 89 ff             	mov    %rdi,%r15
+  800693:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800698:	49 bd 9e 21 80 00 00 	movabs $0x80219e,%r13
+  80069f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006a2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006a8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ab:	48 89 df             	mov    %rbx,%rdi
+  8006ae:	41 ff d5             	call   *%r13
+  8006b1:	83 e0 04             	and    $0x4,%eax
+  8006b4:	74 17                	je     8006cd <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006b6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006bd:	4c 39 f3             	cmp    %r14,%rbx
+  8006c0:	75 e6                	jne    8006a8 <fd_alloc+0x29>
+  8006c2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006c8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006cd:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006d0:	48 83 c4 08          	add    $0x8,%rsp
+  8006d4:	5b                   	pop    %rbx
+  8006d5:	41 5c                	pop    %r12
+  8006d7:	41 5d                	pop    %r13
+  8006d9:	41 5e                	pop    %r14
+  8006db:	41 5f                	pop    %r15
+  8006dd:	5d                   	pop    %rbp
+  8006de:	c3                   	ret
+
+00000000008006df <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006df:	83 ff 1f             	cmp    $0x1f,%edi
+  8006e2:	77 39                	ja     80071d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006e4:	55                   	push   %rbp
+  8006e5:	48 89 e5             	mov    %rsp,%rbp
+  8006e8:	41 54                	push   %r12
+  8006ea:	53                   	push   %rbx
+  8006eb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8006ee:	48 63 df             	movslq %edi,%rbx
+  8006f1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8006f8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8006fc:	48 89 df             	mov    %rbx,%rdi
+  8006ff:	48 b8 9e 21 80 00 00 	movabs $0x80219e,%rax
+  800706:	00 00 00 
+  800709:	ff d0                	call   *%rax
+  80070b:	a8 04                	test   $0x4,%al
+  80070d:	74 14                	je     800723 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80070f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800718:	5b                   	pop    %rbx
+  800719:	41 5c                	pop    %r12
+  80071b:	5d                   	pop    %rbp
+  80071c:	c3                   	ret
+        return -E_INVAL;
+  80071d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800722:	c3                   	ret
+        return -E_INVAL;
+  800723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800728:	eb ee                	jmp    800718 <fd_lookup+0x39>
+
+000000000080072a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+  80072e:	41 54                	push   %r12
+  800730:	53                   	push   %rbx
+  800731:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800734:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  80073b:	00 00 00 
+  80073e:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800745:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800748:	39 3b                	cmp    %edi,(%rbx)
+  80074a:	74 47                	je     800793 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80074c:	48 83 c0 08          	add    $0x8,%rax
+  800750:	48 8b 18             	mov    (%rax),%rbx
+  800753:	48 85 db             	test   %rbx,%rbx
+  800756:	75 f0                	jne    800748 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800758:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80075f:	00 00 00 
+  800762:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800768:	89 fa                	mov    %edi,%edx
+  80076a:	48 bf b8 36 80 00 00 	movabs $0x8036b8,%rdi
+  800771:	00 00 00 
+  800774:	b8 00 00 00 00       	mov    $0x0,%eax
+  800779:	48 b9 32 26 80 00 00 	movabs $0x802632,%rcx
+  800780:	00 00 00 
+  800783:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80078a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80078e:	5b                   	pop    %rbx
+  80078f:	41 5c                	pop    %r12
+  800791:	5d                   	pop    %rbp
+  800792:	c3                   	ret
+            return 0;
+  800793:	b8 00 00 00 00       	mov    $0x0,%eax
+  800798:	eb f0                	jmp    80078a <dev_lookup+0x60>
+
+000000000080079a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80079a:	55                   	push   %rbp
+  80079b:	48 89 e5             	mov    %rsp,%rbp
+  80079e:	41 55                	push   %r13
+  8007a0:	41 54                	push   %r12
+  8007a2:	53                   	push   %rbx
+  8007a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8007a7:	48 89 fb             	mov    %rdi,%rbx
+  8007aa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007ad:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007b4:	ff ff ff 
+  8007b7:	48 01 df             	add    %rbx,%rdi
+  8007ba:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007c2:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  8007c9:	00 00 00 
+  8007cc:	ff d0                	call   *%rax
+  8007ce:	41 89 c5             	mov    %eax,%r13d
+  8007d1:	85 c0                	test   %eax,%eax
+  8007d3:	78 06                	js     8007db <fd_close+0x41>
+  8007d5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007d9:	74 1a                	je     8007f5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007db:	45 84 e4             	test   %r12b,%r12b
+  8007de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007e7:	44 89 e8             	mov    %r13d,%eax
+  8007ea:	48 83 c4 18          	add    $0x18,%rsp
+  8007ee:	5b                   	pop    %rbx
+  8007ef:	41 5c                	pop    %r12
+  8007f1:	41 5d                	pop    %r13
+  8007f3:	5d                   	pop    %rbp
+  8007f4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007f5:	8b 3b                	mov    (%rbx),%edi
+  8007f7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8007fb:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800802:	00 00 00 
+  800805:	ff d0                	call   *%rax
+  800807:	41 89 c5             	mov    %eax,%r13d
+  80080a:	85 c0                	test   %eax,%eax
+  80080c:	78 1b                	js     800829 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80080e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800812:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800816:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80081c:	48 85 c0             	test   %rax,%rax
+  80081f:	74 08                	je     800829 <fd_close+0x8f>
+  800821:	48 89 df             	mov    %rbx,%rdi
+  800824:	ff d0                	call   *%rax
+  800826:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800829:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80082e:	48 89 de             	mov    %rbx,%rsi
+  800831:	bf 00 00 00 00       	mov    $0x0,%edi
+  800836:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  80083d:	00 00 00 
+  800840:	ff d0                	call   *%rax
+    return res;
+  800842:	eb a3                	jmp    8007e7 <fd_close+0x4d>
+
+0000000000800844 <close>:
+
+int
+close(int fdnum) {
+  800844:	55                   	push   %rbp
+  800845:	48 89 e5             	mov    %rsp,%rbp
+  800848:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80084c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800850:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800857:	00 00 00 
+  80085a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80085c:	85 c0                	test   %eax,%eax
+  80085e:	78 15                	js     800875 <close+0x31>
+
+    return fd_close(fd, 1);
+  800860:	be 01 00 00 00       	mov    $0x1,%esi
+  800865:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800869:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800870:	00 00 00 
+  800873:	ff d0                	call   *%rax
+}
+  800875:	c9                   	leave
+  800876:	c3                   	ret
+
+0000000000800877 <close_all>:
+
+void
+close_all(void) {
+  800877:	55                   	push   %rbp
+  800878:	48 89 e5             	mov    %rsp,%rbp
+  80087b:	41 54                	push   %r12
+  80087d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80087e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800883:	49 bc 44 08 80 00 00 	movabs $0x800844,%r12
+  80088a:	00 00 00 
+  80088d:	89 df                	mov    %ebx,%edi
+  80088f:	41 ff d4             	call   *%r12
+  800892:	83 c3 01             	add    $0x1,%ebx
+  800895:	83 fb 20             	cmp    $0x20,%ebx
+  800898:	75 f3                	jne    80088d <close_all+0x16>
+}
+  80089a:	5b                   	pop    %rbx
+  80089b:	41 5c                	pop    %r12
+  80089d:	5d                   	pop    %rbp
+  80089e:	c3                   	ret
+
+000000000080089f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	41 57                	push   %r15
+  8008a5:	41 56                	push   %r14
+  8008a7:	41 55                	push   %r13
+  8008a9:	41 54                	push   %r12
+  8008ab:	53                   	push   %rbx
+  8008ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8008b0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008b3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008b7:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  8008be:	00 00 00 
+  8008c1:	ff d0                	call   *%rax
+  8008c3:	89 c3                	mov    %eax,%ebx
+  8008c5:	85 c0                	test   %eax,%eax
+  8008c7:	0f 88 b8 00 00 00    	js     800985 <dup+0xe6>
+    close(newfdnum);
+  8008cd:	44 89 e7             	mov    %r12d,%edi
+  8008d0:	48 b8 44 08 80 00 00 	movabs $0x800844,%rax
+  8008d7:	00 00 00 
+  8008da:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008dc:	4d 63 ec             	movslq %r12d,%r13
+  8008df:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008e6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8008ea:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8008ee:	4c 89 ff             	mov    %r15,%rdi
+  8008f1:	49 be 63 06 80 00 00 	movabs $0x800663,%r14
+  8008f8:	00 00 00 
+  8008fb:	41 ff d6             	call   *%r14
+  8008fe:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800901:	4c 89 ef             	mov    %r13,%rdi
+  800904:	41 ff d6             	call   *%r14
+  800907:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80090a:	48 89 df             	mov    %rbx,%rdi
+  80090d:	48 b8 9e 21 80 00 00 	movabs $0x80219e,%rax
+  800914:	00 00 00 
+  800917:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800919:	a8 04                	test   $0x4,%al
+  80091b:	74 2b                	je     800948 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80091d:	41 89 c1             	mov    %eax,%r9d
+  800920:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800926:	4c 89 f1             	mov    %r14,%rcx
+  800929:	ba 00 00 00 00       	mov    $0x0,%edx
+  80092e:	48 89 de             	mov    %rbx,%rsi
+  800931:	bf 00 00 00 00       	mov    $0x0,%edi
+  800936:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  80093d:	00 00 00 
+  800940:	ff d0                	call   *%rax
+  800942:	89 c3                	mov    %eax,%ebx
+  800944:	85 c0                	test   %eax,%eax
+  800946:	78 4e                	js     800996 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800948:	4c 89 ff             	mov    %r15,%rdi
+  80094b:	48 b8 9e 21 80 00 00 	movabs $0x80219e,%rax
+  800952:	00 00 00 
+  800955:	ff d0                	call   *%rax
+  800957:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80095a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800960:	4c 89 e9             	mov    %r13,%rcx
+  800963:	ba 00 00 00 00       	mov    $0x0,%edx
+  800968:	4c 89 fe             	mov    %r15,%rsi
+  80096b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800970:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  800977:	00 00 00 
+  80097a:	ff d0                	call   *%rax
+  80097c:	89 c3                	mov    %eax,%ebx
+  80097e:	85 c0                	test   %eax,%eax
+  800980:	78 14                	js     800996 <dup+0xf7>
+
+    return newfdnum;
+  800982:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800985:	89 d8                	mov    %ebx,%eax
+  800987:	48 83 c4 18          	add    $0x18,%rsp
+  80098b:	5b                   	pop    %rbx
+  80098c:	41 5c                	pop    %r12
+  80098e:	41 5d                	pop    %r13
+  800990:	41 5e                	pop    %r14
+  800992:	41 5f                	pop    %r15
+  800994:	5d                   	pop    %rbp
+  800995:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800996:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80099b:	4c 89 ee             	mov    %r13,%rsi
+  80099e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a3:	49 bc 4d 03 80 00 00 	movabs $0x80034d,%r12
+  8009aa:	00 00 00 
+  8009ad:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b5:	4c 89 f6             	mov    %r14,%rsi
+  8009b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009bd:	41 ff d4             	call   *%r12
+    return res;
+  8009c0:	eb c3                	jmp    800985 <dup+0xe6>
+
+00000000008009c2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009c2:	55                   	push   %rbp
+  8009c3:	48 89 e5             	mov    %rsp,%rbp
+  8009c6:	41 56                	push   %r14
+  8009c8:	41 55                	push   %r13
+  8009ca:	41 54                	push   %r12
+  8009cc:	53                   	push   %rbx
+  8009cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8009d1:	89 fb                	mov    %edi,%ebx
+  8009d3:	49 89 f4             	mov    %rsi,%r12
+  8009d6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009d9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009dd:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  8009e4:	00 00 00 
+  8009e7:	ff d0                	call   *%rax
+  8009e9:	85 c0                	test   %eax,%eax
+  8009eb:	78 4c                	js     800a39 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8009ed:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8009f1:	41 8b 3e             	mov    (%r14),%edi
+  8009f4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009f8:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  8009ff:	00 00 00 
+  800a02:	ff d0                	call   *%rax
+  800a04:	85 c0                	test   %eax,%eax
+  800a06:	78 35                	js     800a3d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a08:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a0c:	83 e0 03             	and    $0x3,%eax
+  800a0f:	83 f8 01             	cmp    $0x1,%eax
+  800a12:	74 2d                	je     800a41 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a18:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a1c:	48 85 c0             	test   %rax,%rax
+  800a1f:	74 56                	je     800a77 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a21:	4c 89 ea             	mov    %r13,%rdx
+  800a24:	4c 89 e6             	mov    %r12,%rsi
+  800a27:	4c 89 f7             	mov    %r14,%rdi
+  800a2a:	ff d0                	call   *%rax
+}
+  800a2c:	48 83 c4 10          	add    $0x10,%rsp
+  800a30:	5b                   	pop    %rbx
+  800a31:	41 5c                	pop    %r12
+  800a33:	41 5d                	pop    %r13
+  800a35:	41 5e                	pop    %r14
+  800a37:	5d                   	pop    %rbp
+  800a38:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a39:	48 98                	cltq
+  800a3b:	eb ef                	jmp    800a2c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a3d:	48 98                	cltq
+  800a3f:	eb eb                	jmp    800a2c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a41:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a48:	00 00 00 
+  800a4b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a51:	89 da                	mov    %ebx,%edx
+  800a53:	48 bf 19 37 80 00 00 	movabs $0x803719,%rdi
+  800a5a:	00 00 00 
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	48 b9 32 26 80 00 00 	movabs $0x802632,%rcx
+  800a69:	00 00 00 
+  800a6c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a6e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a75:	eb b5                	jmp    800a2c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a77:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a7e:	eb ac                	jmp    800a2c <read+0x6a>
+
+0000000000800a80 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	41 56                	push   %r14
+  800a86:	41 55                	push   %r13
+  800a88:	41 54                	push   %r12
+  800a8a:	53                   	push   %rbx
+  800a8b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a8f:	89 fb                	mov    %edi,%ebx
+  800a91:	49 89 f4             	mov    %rsi,%r12
+  800a94:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a97:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a9b:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800aa2:	00 00 00 
+  800aa5:	ff d0                	call   *%rax
+  800aa7:	85 c0                	test   %eax,%eax
+  800aa9:	78 41                	js     800aec <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aab:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800aaf:	41 8b 3e             	mov    (%r14),%edi
+  800ab2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ab6:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800abd:	00 00 00 
+  800ac0:	ff d0                	call   *%rax
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	78 35                	js     800afb <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ac6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aca:	83 e0 03             	and    $0x3,%eax
+  800acd:	83 f8 01             	cmp    $0x1,%eax
+  800ad0:	74 2d                	je     800aff <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800ad2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ad6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800ada:	48 85 c0             	test   %rax,%rax
+  800add:	74 56                	je     800b35 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800adf:	4c 89 ea             	mov    %r13,%rdx
+  800ae2:	4c 89 e6             	mov    %r12,%rsi
+  800ae5:	4c 89 f7             	mov    %r14,%rdi
+  800ae8:	ff d0                	call   *%rax
+  800aea:	eb 02                	jmp    800aee <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aec:	48 98                	cltq
+}
+  800aee:	48 83 c4 10          	add    $0x10,%rsp
+  800af2:	5b                   	pop    %rbx
+  800af3:	41 5c                	pop    %r12
+  800af5:	41 5d                	pop    %r13
+  800af7:	41 5e                	pop    %r14
+  800af9:	5d                   	pop    %rbp
+  800afa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800afb:	48 98                	cltq
+  800afd:	eb ef                	jmp    800aee <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b06:	00 00 00 
+  800b09:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b0f:	89 da                	mov    %ebx,%edx
+  800b11:	48 bf d8 36 80 00 00 	movabs $0x8036d8,%rdi
+  800b18:	00 00 00 
+  800b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b20:	48 b9 32 26 80 00 00 	movabs $0x802632,%rcx
+  800b27:	00 00 00 
+  800b2a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b2c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b33:	eb b9                	jmp    800aee <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b35:	4c 89 ea             	mov    %r13,%rdx
+  800b38:	4c 89 e6             	mov    %r12,%rsi
+  800b3b:	89 df                	mov    %ebx,%edi
+  800b3d:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  800b44:	00 00 00 
+  800b47:	ff d0                	call   *%rax
+  800b49:	eb a3                	jmp    800aee <readmap+0x6e>
+
+0000000000800b4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b4b:	55                   	push   %rbp
+  800b4c:	48 89 e5             	mov    %rsp,%rbp
+  800b4f:	41 57                	push   %r15
+  800b51:	41 56                	push   %r14
+  800b53:	41 55                	push   %r13
+  800b55:	41 54                	push   %r12
+  800b57:	53                   	push   %rbx
+  800b58:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b5c:	48 85 d2             	test   %rdx,%rdx
+  800b5f:	74 54                	je     800bb5 <readn+0x6a>
+  800b61:	41 89 fd             	mov    %edi,%r13d
+  800b64:	49 89 f6             	mov    %rsi,%r14
+  800b67:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b6f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b74:	49 bf c2 09 80 00 00 	movabs $0x8009c2,%r15
+  800b7b:	00 00 00 
+  800b7e:	4c 89 e2             	mov    %r12,%rdx
+  800b81:	48 29 f2             	sub    %rsi,%rdx
+  800b84:	4c 01 f6             	add    %r14,%rsi
+  800b87:	44 89 ef             	mov    %r13d,%edi
+  800b8a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b8d:	85 c0                	test   %eax,%eax
+  800b8f:	78 20                	js     800bb1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b91:	01 c3                	add    %eax,%ebx
+  800b93:	85 c0                	test   %eax,%eax
+  800b95:	74 08                	je     800b9f <readn+0x54>
+  800b97:	48 63 f3             	movslq %ebx,%rsi
+  800b9a:	4c 39 e6             	cmp    %r12,%rsi
+  800b9d:	72 df                	jb     800b7e <readn+0x33>
+    }
+    return res;
+  800b9f:	48 63 c3             	movslq %ebx,%rax
+}
+  800ba2:	48 83 c4 08          	add    $0x8,%rsp
+  800ba6:	5b                   	pop    %rbx
+  800ba7:	41 5c                	pop    %r12
+  800ba9:	41 5d                	pop    %r13
+  800bab:	41 5e                	pop    %r14
+  800bad:	41 5f                	pop    %r15
+  800baf:	5d                   	pop    %rbp
+  800bb0:	c3                   	ret
+        if (inc < 0) return inc;
+  800bb1:	48 98                	cltq
+  800bb3:	eb ed                	jmp    800ba2 <readn+0x57>
+    int inc = 1, res = 0;
+  800bb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bba:	eb e3                	jmp    800b9f <readn+0x54>
+
+0000000000800bbc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bbc:	55                   	push   %rbp
+  800bbd:	48 89 e5             	mov    %rsp,%rbp
+  800bc0:	41 56                	push   %r14
+  800bc2:	41 55                	push   %r13
+  800bc4:	41 54                	push   %r12
+  800bc6:	53                   	push   %rbx
+  800bc7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bcb:	89 fb                	mov    %edi,%ebx
+  800bcd:	49 89 f4             	mov    %rsi,%r12
+  800bd0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bd3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bd7:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800bde:	00 00 00 
+  800be1:	ff d0                	call   *%rax
+  800be3:	85 c0                	test   %eax,%eax
+  800be5:	78 47                	js     800c2e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800beb:	41 8b 3e             	mov    (%r14),%edi
+  800bee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bf2:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800bf9:	00 00 00 
+  800bfc:	ff d0                	call   *%rax
+  800bfe:	85 c0                	test   %eax,%eax
+  800c00:	78 30                	js     800c32 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c02:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c07:	74 2d                	je     800c36 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c0d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c11:	48 85 c0             	test   %rax,%rax
+  800c14:	74 56                	je     800c6c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c16:	4c 89 ea             	mov    %r13,%rdx
+  800c19:	4c 89 e6             	mov    %r12,%rsi
+  800c1c:	4c 89 f7             	mov    %r14,%rdi
+  800c1f:	ff d0                	call   *%rax
+}
+  800c21:	48 83 c4 10          	add    $0x10,%rsp
+  800c25:	5b                   	pop    %rbx
+  800c26:	41 5c                	pop    %r12
+  800c28:	41 5d                	pop    %r13
+  800c2a:	41 5e                	pop    %r14
+  800c2c:	5d                   	pop    %rbp
+  800c2d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c2e:	48 98                	cltq
+  800c30:	eb ef                	jmp    800c21 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c32:	48 98                	cltq
+  800c34:	eb eb                	jmp    800c21 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c36:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c3d:	00 00 00 
+  800c40:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c46:	89 da                	mov    %ebx,%edx
+  800c48:	48 bf 35 37 80 00 00 	movabs $0x803735,%rdi
+  800c4f:	00 00 00 
+  800c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c57:	48 b9 32 26 80 00 00 	movabs $0x802632,%rcx
+  800c5e:	00 00 00 
+  800c61:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c6a:	eb b5                	jmp    800c21 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c6c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c73:	eb ac                	jmp    800c21 <write+0x65>
+
+0000000000800c75 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c75:	55                   	push   %rbp
+  800c76:	48 89 e5             	mov    %rsp,%rbp
+  800c79:	53                   	push   %rbx
+  800c7a:	48 83 ec 18          	sub    $0x18,%rsp
+  800c7e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c84:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+  800c90:	85 c0                	test   %eax,%eax
+  800c92:	78 0c                	js     800ca0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c98:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ca4:	c9                   	leave
+  800ca5:	c3                   	ret
+
+0000000000800ca6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800ca6:	55                   	push   %rbp
+  800ca7:	48 89 e5             	mov    %rsp,%rbp
+  800caa:	41 55                	push   %r13
+  800cac:	41 54                	push   %r12
+  800cae:	53                   	push   %rbx
+  800caf:	48 83 ec 18          	sub    $0x18,%rsp
+  800cb3:	89 fb                	mov    %edi,%ebx
+  800cb5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cb8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cbc:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800cc3:	00 00 00 
+  800cc6:	ff d0                	call   *%rax
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	78 38                	js     800d04 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ccc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cd0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cd4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cd8:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800cdf:	00 00 00 
+  800ce2:	ff d0                	call   *%rax
+  800ce4:	85 c0                	test   %eax,%eax
+  800ce6:	78 1c                	js     800d04 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ce8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800ced:	74 20                	je     800d0f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cf3:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800cf7:	48 85 c0             	test   %rax,%rax
+  800cfa:	74 47                	je     800d43 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cfc:	44 89 e6             	mov    %r12d,%esi
+  800cff:	4c 89 ef             	mov    %r13,%rdi
+  800d02:	ff d0                	call   *%rax
+}
+  800d04:	48 83 c4 18          	add    $0x18,%rsp
+  800d08:	5b                   	pop    %rbx
+  800d09:	41 5c                	pop    %r12
+  800d0b:	41 5d                	pop    %r13
+  800d0d:	5d                   	pop    %rbp
+  800d0e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d16:	00 00 00 
+  800d19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d1f:	89 da                	mov    %ebx,%edx
+  800d21:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  800d28:	00 00 00 
+  800d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d30:	48 b9 32 26 80 00 00 	movabs $0x802632,%rcx
+  800d37:	00 00 00 
+  800d3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d41:	eb c1                	jmp    800d04 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d43:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d48:	eb ba                	jmp    800d04 <ftruncate+0x5e>
+
+0000000000800d4a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d4a:	55                   	push   %rbp
+  800d4b:	48 89 e5             	mov    %rsp,%rbp
+  800d4e:	41 54                	push   %r12
+  800d50:	53                   	push   %rbx
+  800d51:	48 83 ec 10          	sub    $0x10,%rsp
+  800d55:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d5c:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800d63:	00 00 00 
+  800d66:	ff d0                	call   *%rax
+  800d68:	85 c0                	test   %eax,%eax
+  800d6a:	78 4e                	js     800dba <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d6c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d70:	41 8b 3c 24          	mov    (%r12),%edi
+  800d74:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d78:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800d7f:	00 00 00 
+  800d82:	ff d0                	call   *%rax
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	78 32                	js     800dba <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d8c:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800d91:	74 30                	je     800dc3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d93:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d96:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d9d:	00 00 00 
+    stat->st_isdir = 0;
+  800da0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800da7:	00 00 00 
+    stat->st_dev = dev;
+  800daa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800db1:	48 89 de             	mov    %rbx,%rsi
+  800db4:	4c 89 e7             	mov    %r12,%rdi
+  800db7:	ff 50 30             	call   *0x30(%rax)
+}
+  800dba:	48 83 c4 10          	add    $0x10,%rsp
+  800dbe:	5b                   	pop    %rbx
+  800dbf:	41 5c                	pop    %r12
+  800dc1:	5d                   	pop    %rbp
+  800dc2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dc3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dc8:	eb f0                	jmp    800dba <fstat+0x70>
+
+0000000000800dca <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dca:	55                   	push   %rbp
+  800dcb:	48 89 e5             	mov    %rsp,%rbp
+  800dce:	41 54                	push   %r12
+  800dd0:	53                   	push   %rbx
+  800dd1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd9:	48 b8 21 1b 80 00 00 	movabs $0x801b21,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+  800de5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	78 25                	js     800e10 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800deb:	4c 89 e6             	mov    %r12,%rsi
+  800dee:	89 c7                	mov    %eax,%edi
+  800df0:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  800df7:	00 00 00 
+  800dfa:	ff d0                	call   *%rax
+  800dfc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dff:	89 df                	mov    %ebx,%edi
+  800e01:	48 b8 44 08 80 00 00 	movabs $0x800844,%rax
+  800e08:	00 00 00 
+  800e0b:	ff d0                	call   *%rax
+
+    return res;
+  800e0d:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e10:	89 d8                	mov    %ebx,%eax
+  800e12:	5b                   	pop    %rbx
+  800e13:	41 5c                	pop    %r12
+  800e15:	5d                   	pop    %rbp
+  800e16:	c3                   	ret
+
+0000000000800e17 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e17:	55                   	push   %rbp
+  800e18:	48 89 e5             	mov    %rsp,%rbp
+  800e1b:	41 54                	push   %r12
+  800e1d:	53                   	push   %rbx
+  800e1e:	48 83 ec 10          	sub    $0x10,%rsp
+  800e22:	48 89 fb             	mov    %rdi,%rbx
+  800e25:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e2c:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e31:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800e38:	00 00 00 
+  800e3b:	ff d0                	call   *%rax
+  800e3d:	85 c0                	test   %eax,%eax
+  800e3f:	78 1f                	js     800e60 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e45:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e49:	48 85 c0             	test   %rax,%rax
+  800e4c:	74 1b                	je     800e69 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e4e:	4c 89 e6             	mov    %r12,%rsi
+  800e51:	48 89 df             	mov    %rbx,%rdi
+  800e54:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e56:	85 c0                	test   %eax,%eax
+  800e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e60:	48 83 c4 10          	add    $0x10,%rsp
+  800e64:	5b                   	pop    %rbx
+  800e65:	41 5c                	pop    %r12
+  800e67:	5d                   	pop    %rbp
+  800e68:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e69:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e6e:	eb f0                	jmp    800e60 <create_snapshot+0x49>
+
+0000000000800e70 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e70:	55                   	push   %rbp
+  800e71:	48 89 e5             	mov    %rsp,%rbp
+  800e74:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e78:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e7c:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e81:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800e88:	00 00 00 
+  800e8b:	ff d0                	call   *%rax
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	78 1e                	js     800eaf <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800e91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e95:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800e99:	48 85 d2             	test   %rdx,%rdx
+  800e9c:	74 13                	je     800eb1 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea3:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eac:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800eaf:	c9                   	leave
+  800eb0:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eb1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800eb6:	eb f7                	jmp    800eaf <print_snapshot_list+0x3f>
+
+0000000000800eb8 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800eb8:	55                   	push   %rbp
+  800eb9:	48 89 e5             	mov    %rsp,%rbp
+  800ebc:	53                   	push   %rbx
+  800ebd:	48 83 ec 18          	sub    $0x18,%rsp
+  800ec1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ec4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ec8:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ecd:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+  800ed9:	85 c0                	test   %eax,%eax
+  800edb:	78 1c                	js     800ef9 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800edd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ee1:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800ee5:	48 85 c0             	test   %rax,%rax
+  800ee8:	74 15                	je     800eff <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800eea:	48 89 df             	mov    %rbx,%rdi
+  800eed:	ff d0                	call   *%rax
+    if (res < 0) {
+  800eef:	85 c0                	test   %eax,%eax
+  800ef1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ef9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800efd:	c9                   	leave
+  800efe:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eff:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f04:	eb f3                	jmp    800ef9 <accept_snapshot+0x41>
+
+0000000000800f06 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f06:	55                   	push   %rbp
+  800f07:	48 89 e5             	mov    %rsp,%rbp
+  800f0a:	53                   	push   %rbx
+  800f0b:	48 83 ec 18          	sub    $0x18,%rsp
+  800f0f:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f12:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f16:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f1b:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800f22:	00 00 00 
+  800f25:	ff d0                	call   *%rax
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	78 1c                	js     800f47 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f2f:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f33:	48 85 c0             	test   %rax,%rax
+  800f36:	74 15                	je     800f4d <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f38:	48 89 df             	mov    %rbx,%rdi
+  800f3b:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f3d:	85 c0                	test   %eax,%eax
+  800f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f44:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f4b:	c9                   	leave
+  800f4c:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f4d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f52:	eb f3                	jmp    800f47 <delete_snapshot+0x41>
+
+0000000000800f54 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f54:	55                   	push   %rbp
+  800f55:	48 89 e5             	mov    %rsp,%rbp
+  800f58:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f5c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f60:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f65:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800f6c:	00 00 00 
+  800f6f:	ff d0                	call   *%rax
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	78 14                	js     800f89 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f79:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f7d:	48 85 d2             	test   %rdx,%rdx
+  800f80:	74 09                	je     800f8b <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f87:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800f89:	c9                   	leave
+  800f8a:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f8b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f90:	eb f7                	jmp    800f89 <gc_snapshots+0x35>
+
+0000000000800f92 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800f92:	55                   	push   %rbp
+  800f93:	48 89 e5             	mov    %rsp,%rbp
+  800f96:	41 56                	push   %r14
+  800f98:	41 55                	push   %r13
+  800f9a:	41 54                	push   %r12
+  800f9c:	53                   	push   %rbx
+  800f9d:	48 83 ec 10          	sub    $0x10,%rsp
+  800fa1:	48 89 fb             	mov    %rdi,%rbx
+  800fa4:	49 89 f4             	mov    %rsi,%r12
+  800fa7:	49 89 d5             	mov    %rdx,%r13
+  800faa:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fb1:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fb6:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+  800fc2:	85 c0                	test   %eax,%eax
+  800fc4:	78 1b                	js     800fe1 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fca:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fce:	48 85 c0             	test   %rax,%rax
+  800fd1:	74 1b                	je     800fee <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fd3:	4c 89 f1             	mov    %r14,%rcx
+  800fd6:	4c 89 ea             	mov    %r13,%rdx
+  800fd9:	4c 89 e6             	mov    %r12,%rsi
+  800fdc:	48 89 df             	mov    %rbx,%rdi
+  800fdf:	ff d0                	call   *%rax
+
+    return res;
+}
+  800fe1:	48 83 c4 10          	add    $0x10,%rsp
+  800fe5:	5b                   	pop    %rbx
+  800fe6:	41 5c                	pop    %r12
+  800fe8:	41 5d                	pop    %r13
+  800fea:	41 5e                	pop    %r14
+  800fec:	5d                   	pop    %rbp
+  800fed:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ff3:	eb ec                	jmp    800fe1 <diff_snapshots+0x4f>
+
+0000000000800ff5 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  800ff5:	55                   	push   %rbp
+  800ff6:	48 89 e5             	mov    %rsp,%rbp
+  800ff9:	41 55                	push   %r13
+  800ffb:	41 54                	push   %r12
+  800ffd:	53                   	push   %rbx
+  800ffe:	48 83 ec 18          	sub    $0x18,%rsp
+  801002:	48 89 fb             	mov    %rdi,%rbx
+  801005:	49 89 f4             	mov    %rsi,%r12
+  801008:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80100b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80100f:	bf 66 00 00 00       	mov    $0x66,%edi
+  801014:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  80101b:	00 00 00 
+  80101e:	ff d0                	call   *%rax
+  801020:	85 c0                	test   %eax,%eax
+  801022:	78 18                	js     80103c <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801024:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801028:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80102c:	48 85 c0             	test   %rax,%rax
+  80102f:	74 16                	je     801047 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801031:	4c 89 ea             	mov    %r13,%rdx
+  801034:	4c 89 e6             	mov    %r12,%rsi
+  801037:	48 89 df             	mov    %rbx,%rdi
+  80103a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80103c:	48 83 c4 18          	add    $0x18,%rsp
+  801040:	5b                   	pop    %rbx
+  801041:	41 5c                	pop    %r12
+  801043:	41 5d                	pop    %r13
+  801045:	5d                   	pop    %rbp
+  801046:	c3                   	ret
+        return -E_NOT_SUPP;
+  801047:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80104c:	eb ee                	jmp    80103c <send_snapshot+0x47>
+
+000000000080104e <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80104e:	55                   	push   %rbp
+  80104f:	48 89 e5             	mov    %rsp,%rbp
+  801052:	53                   	push   %rbx
+  801053:	48 83 ec 18          	sub    $0x18,%rsp
+  801057:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80105a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80105e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801063:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  80106a:	00 00 00 
+  80106d:	ff d0                	call   *%rax
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	78 12                	js     801085 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801077:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80107b:	48 85 c0             	test   %rax,%rax
+  80107e:	74 0b                	je     80108b <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801080:	48 89 df             	mov    %rbx,%rdi
+  801083:	ff d0                	call   *%rax
+
+    return res;
+}
+  801085:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801089:	c9                   	leave
+  80108a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80108b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801090:	eb f3                	jmp    801085 <receive_snapshot+0x37>
+
+0000000000801092 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801092:	55                   	push   %rbp
+  801093:	48 89 e5             	mov    %rsp,%rbp
+  801096:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80109a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80109e:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010a3:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+  8010af:	85 c0                	test   %eax,%eax
+  8010b1:	78 17                	js     8010ca <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010b7:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010be:	48 85 d2             	test   %rdx,%rdx
+  8010c1:	74 09                	je     8010cc <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c8:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010ca:	c9                   	leave
+  8010cb:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010cc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010d1:	eb f7                	jmp    8010ca <free_space_bytes+0x38>
+
+00000000008010d3 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+  8010d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010df:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010e4:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  8010eb:	00 00 00 
+  8010ee:	ff d0                	call   *%rax
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	78 17                	js     80110b <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8010f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010f8:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8010ff:	48 85 d2             	test   %rdx,%rdx
+  801102:	74 09                	je     80110d <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801104:	b8 00 00 00 00       	mov    $0x0,%eax
+  801109:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80110d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801112:	eb f7                	jmp    80110b <busy_space_bytes+0x38>
+
+0000000000801114 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	41 54                	push   %r12
+  80111a:	53                   	push   %rbx
+  80111b:	48 83 ec 10          	sub    $0x10,%rsp
+  80111f:	89 fb                	mov    %edi,%ebx
+  801121:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801124:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801128:	bf 66 00 00 00       	mov    $0x66,%edi
+  80112d:	48 b8 2a 07 80 00 00 	movabs $0x80072a,%rax
+  801134:	00 00 00 
+  801137:	ff d0                	call   *%rax
+  801139:	85 c0                	test   %eax,%eax
+  80113b:	78 17                	js     801154 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80113d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801141:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801148:	48 85 c0             	test   %rax,%rax
+  80114b:	74 10                	je     80115d <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80114d:	4c 89 e6             	mov    %r12,%rsi
+  801150:	89 df                	mov    %ebx,%edi
+  801152:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801154:	48 83 c4 10          	add    $0x10,%rsp
+  801158:	5b                   	pop    %rbx
+  801159:	41 5c                	pop    %r12
+  80115b:	5d                   	pop    %rbp
+  80115c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80115d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801162:	eb f0                	jmp    801154 <snapshots_space+0x40>
+
+0000000000801164 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+  801168:	41 55                	push   %r13
+  80116a:	41 54                	push   %r12
+  80116c:	53                   	push   %rbx
+  80116d:	48 83 ec 08          	sub    $0x8,%rsp
+  801171:	41 89 fd             	mov    %edi,%r13d
+  801174:	48 89 f3             	mov    %rsi,%rbx
+  801177:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80117a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801181:	00 00 00 
+  801184:	83 38 00             	cmpl   $0x0,(%rax)
+  801187:	74 57                	je     8011e0 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801189:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80118f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801194:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80119b:	00 00 00 
+  80119e:	44 89 ee             	mov    %r13d,%esi
+  8011a1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011a8:	00 00 00 
+  8011ab:	8b 38                	mov    (%rax),%edi
+  8011ad:	48 b8 59 35 80 00 00 	movabs $0x803559,%rax
+  8011b4:	00 00 00 
+  8011b7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011be:	4c 89 e2             	mov    %r12,%rdx
+  8011c1:	48 89 de             	mov    %rbx,%rsi
+  8011c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011c9:	48 b8 41 35 80 00 00 	movabs $0x803541,%rax
+  8011d0:	00 00 00 
+  8011d3:	ff d0                	call   *%rax
+}
+  8011d5:	48 83 c4 08          	add    $0x8,%rsp
+  8011d9:	5b                   	pop    %rbx
+  8011da:	41 5c                	pop    %r12
+  8011dc:	41 5d                	pop    %r13
+  8011de:	5d                   	pop    %rbp
+  8011df:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011e5:	48 b8 17 36 80 00 00 	movabs $0x803617,%rax
+  8011ec:	00 00 00 
+  8011ef:	ff d0                	call   *%rax
+  8011f1:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8011f8:	00 00 
+  8011fa:	eb 8d                	jmp    801189 <fsipc_region+0x25>
+
+00000000008011fc <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8011fc:	55                   	push   %rbp
+  8011fd:	48 89 e5             	mov    %rsp,%rbp
+  801200:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801204:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80120b:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80120c:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801210:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  801217:	00 00 00 
+  80121a:	ff d0                	call   *%rax
+}
+  80121c:	c9                   	leave
+  80121d:	c3                   	ret
+
+000000000080121e <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80121e:	85 ff                	test   %edi,%edi
+  801220:	78 6d                	js     80128f <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801222:	55                   	push   %rbp
+  801223:	48 89 e5             	mov    %rsp,%rbp
+  801226:	41 54                	push   %r12
+  801228:	53                   	push   %rbx
+  801229:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80122c:	48 85 f6             	test   %rsi,%rsi
+  80122f:	74 57                	je     801288 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801231:	89 f8                	mov    %edi,%eax
+  801233:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80123a:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+  801241:	bf 12 00 00 00       	mov    $0x12,%edi
+  801246:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  80124d:	00 00 00 
+  801250:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801252:	85 c0                	test   %eax,%eax
+  801254:	78 2d                	js     801283 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801256:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80125d:	00 00 00 
+  801260:	49 63 14 24          	movslq (%r12),%rdx
+  801264:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80126b:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  801270:	48 89 df             	mov    %rbx,%rdi
+  801273:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  80127a:	00 00 00 
+  80127d:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80127f:	41 8b 04 24          	mov    (%r12),%eax
+}
+  801283:	5b                   	pop    %rbx
+  801284:	41 5c                	pop    %r12
+  801286:	5d                   	pop    %rbp
+  801287:	c3                   	ret
+        return -E_INVAL;
+  801288:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128d:	eb f4                	jmp    801283 <devfile_df_snapshots+0x65>
+  80128f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801294:	c3                   	ret
+
+0000000000801295 <devfile_df_busy>:
+devfile_df_busy() {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  801299:	be 00 00 00 00       	mov    $0x0,%esi
+  80129e:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012a3:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8012aa:	00 00 00 
+  8012ad:	ff d0                	call   *%rax
+}
+  8012af:	5d                   	pop    %rbp
+  8012b0:	c3                   	ret
+
+00000000008012b1 <devfile_df_free>:
+devfile_df_free() {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ba:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012bf:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8012c6:	00 00 00 
+  8012c9:	ff d0                	call   *%rax
+}
+  8012cb:	5d                   	pop    %rbp
+  8012cc:	c3                   	ret
+
+00000000008012cd <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012cd:	55                   	push   %rbp
+  8012ce:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012db:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8012e2:	00 00 00 
+  8012e5:	ff d0                	call   *%rax
+}
+  8012e7:	5d                   	pop    %rbp
+  8012e8:	c3                   	ret
+
+00000000008012e9 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8012e9:	55                   	push   %rbp
+  8012ea:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	bf 09 00 00 00       	mov    $0x9,%edi
+  8012f7:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8012fe:	00 00 00 
+  801301:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801303:	85 c0                	test   %eax,%eax
+  801305:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80130d:	5d                   	pop    %rbp
+  80130e:	c3                   	ret
+
+000000000080130f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801313:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80131a:	00 00 00 
+  80131d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801320:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801322:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801325:	be 00 00 00 00       	mov    $0x0,%esi
+  80132a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80132f:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801336:	00 00 00 
+  801339:	ff d0                	call   *%rax
+}
+  80133b:	5d                   	pop    %rbp
+  80133c:	c3                   	ret
+
+000000000080133d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80133d:	55                   	push   %rbp
+  80133e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801341:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801344:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80134b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	bf 06 00 00 00       	mov    $0x6,%edi
+  801357:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  80135e:	00 00 00 
+  801361:	ff d0                	call   *%rax
+}
+  801363:	5d                   	pop    %rbp
+  801364:	c3                   	ret
+
+0000000000801365 <devfile_write>:
+    if (!fd || !buf) {
+  801365:	48 85 ff             	test   %rdi,%rdi
+  801368:	0f 84 c1 00 00 00    	je     80142f <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80136e:	55                   	push   %rbp
+  80136f:	48 89 e5             	mov    %rsp,%rbp
+  801372:	41 57                	push   %r15
+  801374:	41 56                	push   %r14
+  801376:	41 55                	push   %r13
+  801378:	41 54                	push   %r12
+  80137a:	53                   	push   %rbx
+  80137b:	48 83 ec 18          	sub    $0x18,%rsp
+  80137f:	49 89 ff             	mov    %rdi,%r15
+  801382:	49 89 f5             	mov    %rsi,%r13
+  801385:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801388:	48 85 f6             	test   %rsi,%rsi
+  80138b:	0f 84 95 00 00 00    	je     801426 <devfile_write+0xc1>
+    while (n) {
+  801391:	48 85 d2             	test   %rdx,%rdx
+  801394:	0f 84 83 00 00 00    	je     80141d <devfile_write+0xb8>
+    int totalWrite = 0;
+  80139a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013a1:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013a8:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013ab:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013b0:	49 39 dc             	cmp    %rbx,%r12
+  8013b3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013b7:	48 89 da             	mov    %rbx,%rdx
+  8013ba:	4c 89 ee             	mov    %r13,%rsi
+  8013bd:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013c4:	00 00 00 
+  8013c7:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  8013ce:	00 00 00 
+  8013d1:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013d3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013d7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013da:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013de:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013e8:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8013ef:	00 00 00 
+  8013f2:	ff d0                	call   *%rax
+        if (write < 0) {
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 21                	js     801419 <devfile_write+0xb4>
+        buf += write;
+  8013f8:	48 63 d0             	movslq %eax,%rdx
+  8013fb:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8013fe:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801401:	49 29 d4             	sub    %rdx,%r12
+  801404:	75 a5                	jne    8013ab <devfile_write+0x46>
+    return totalWrite;
+  801406:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80140a:	48 83 c4 18          	add    $0x18,%rsp
+  80140e:	5b                   	pop    %rbx
+  80140f:	41 5c                	pop    %r12
+  801411:	41 5d                	pop    %r13
+  801413:	41 5e                	pop    %r14
+  801415:	41 5f                	pop    %r15
+  801417:	5d                   	pop    %rbp
+  801418:	c3                   	ret
+            return write;
+  801419:	48 98                	cltq
+  80141b:	eb ed                	jmp    80140a <devfile_write+0xa5>
+    int totalWrite = 0;
+  80141d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801424:	eb e0                	jmp    801406 <devfile_write+0xa1>
+        return -E_INVAL;
+  801426:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80142d:	eb db                	jmp    80140a <devfile_write+0xa5>
+  80142f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801436:	c3                   	ret
+
+0000000000801437 <devfile_read>:
+    if (!fd || !buf) {
+  801437:	48 85 ff             	test   %rdi,%rdi
+  80143a:	0f 84 c0 00 00 00    	je     801500 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801440:	55                   	push   %rbp
+  801441:	48 89 e5             	mov    %rsp,%rbp
+  801444:	41 57                	push   %r15
+  801446:	41 56                	push   %r14
+  801448:	41 55                	push   %r13
+  80144a:	41 54                	push   %r12
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 18          	sub    $0x18,%rsp
+  801451:	49 89 ff             	mov    %rdi,%r15
+  801454:	49 89 f5             	mov    %rsi,%r13
+  801457:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80145a:	48 85 f6             	test   %rsi,%rsi
+  80145d:	0f 84 96 00 00 00    	je     8014f9 <devfile_read+0xc2>
+    while (n) {
+  801463:	48 85 d2             	test   %rdx,%rdx
+  801466:	0f 84 87 00 00 00    	je     8014f3 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80146c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801473:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801474:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80147b:	00 00 00 
+  80147e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801482:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  801485:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80148a:	49 39 c4             	cmp    %rax,%r12
+  80148d:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  801491:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  801495:	be 00 00 00 00       	mov    $0x0,%esi
+  80149a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80149f:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8014a6:	00 00 00 
+  8014a9:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	7e 37                	jle    8014e6 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014af:	48 63 d8             	movslq %eax,%rbx
+  8014b2:	48 89 da             	mov    %rbx,%rdx
+  8014b5:	4c 89 f6             	mov    %r14,%rsi
+  8014b8:	4c 89 ef             	mov    %r13,%rdi
+  8014bb:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  8014c2:	00 00 00 
+  8014c5:	ff d0                	call   *%rax
+        buf += read;
+  8014c7:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014ca:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014ce:	49 29 dc             	sub    %rbx,%r12
+  8014d1:	75 ab                	jne    80147e <devfile_read+0x47>
+  return totalRead;
+  8014d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014d7:	48 83 c4 18          	add    $0x18,%rsp
+  8014db:	5b                   	pop    %rbx
+  8014dc:	41 5c                	pop    %r12
+  8014de:	41 5d                	pop    %r13
+  8014e0:	41 5e                	pop    %r14
+  8014e2:	41 5f                	pop    %r15
+  8014e4:	5d                   	pop    %rbp
+  8014e5:	c3                   	ret
+            return read ? read : totalRead;
+  8014e6:	48 63 d0             	movslq %eax,%rdx
+  8014e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ed:	48 0f 45 c2          	cmovne %rdx,%rax
+  8014f1:	eb e4                	jmp    8014d7 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8014f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8014f7:	eb da                	jmp    8014d3 <devfile_read+0x9c>
+        return E_INVAL;
+  8014f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014fe:	eb d7                	jmp    8014d7 <devfile_read+0xa0>
+  801500:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801505:	c3                   	ret
+
+0000000000801506 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801506:	48 85 ff             	test   %rdi,%rdi
+  801509:	74 5f                	je     80156a <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	53                   	push   %rbx
+  801510:	48 83 ec 08          	sub    $0x8,%rsp
+  801514:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801517:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+  801523:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801529:	77 45                	ja     801570 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80152b:	48 89 de             	mov    %rbx,%rsi
+  80152e:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801535:	00 00 00 
+  801538:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801544:	be 00 00 00 00       	mov    $0x0,%esi
+  801549:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80154e:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801555:	00 00 00 
+  801558:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801561:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801564:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801568:	c9                   	leave
+  801569:	c3                   	ret
+        return -E_INVAL;
+  80156a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80156f:	c3                   	ret
+        return -E_INVAL;
+  801570:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801575:	eb ed                	jmp    801564 <devfile_receive_snapshot+0x5e>
+
+0000000000801577 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801577:	55                   	push   %rbp
+  801578:	48 89 e5             	mov    %rsp,%rbp
+  80157b:	41 55                	push   %r13
+  80157d:	41 54                	push   %r12
+  80157f:	53                   	push   %rbx
+  801580:	48 83 ec 08          	sub    $0x8,%rsp
+  801584:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  801587:	48 85 f6             	test   %rsi,%rsi
+  80158a:	0f 94 c0             	sete   %al
+  80158d:	48 85 d2             	test   %rdx,%rdx
+  801590:	0f 94 c2             	sete   %dl
+  801593:	08 d0                	or     %dl,%al
+  801595:	0f 85 ad 00 00 00    	jne    801648 <devfile_send_snapshot+0xd1>
+  80159b:	48 89 fb             	mov    %rdi,%rbx
+  80159e:	49 89 f4             	mov    %rsi,%r12
+  8015a1:	48 85 ff             	test   %rdi,%rdi
+  8015a4:	0f 84 9e 00 00 00    	je     801648 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015aa:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8015b1:	00 00 00 
+  8015b4:	ff d0                	call   *%rax
+  8015b6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015bc:	0f 87 8d 00 00 00    	ja     80164f <devfile_send_snapshot+0xd8>
+  8015c2:	4c 89 e7             	mov    %r12,%rdi
+  8015c5:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015d7:	77 7d                	ja     801656 <devfile_send_snapshot+0xdf>
+  8015d9:	4c 89 ef             	mov    %r13,%rdi
+  8015dc:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8015e3:	00 00 00 
+  8015e6:	ff d0                	call   *%rax
+  8015e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8015ee:	77 6d                	ja     80165d <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8015f0:	48 89 de             	mov    %rbx,%rsi
+  8015f3:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8015fa:	00 00 00 
+  8015fd:	48 bb 57 2f 80 00 00 	movabs $0x802f57,%rbx
+  801604:	00 00 00 
+  801607:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801609:	4c 89 e6             	mov    %r12,%rsi
+  80160c:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801613:	00 00 00 
+  801616:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801618:	4c 89 ee             	mov    %r13,%rsi
+  80161b:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801622:	00 00 00 
+  801625:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801627:	be 00 00 00 00       	mov    $0x0,%esi
+  80162c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801631:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801638:	00 00 00 
+  80163b:	ff d0                	call   *%rax
+}
+  80163d:	48 83 c4 08          	add    $0x8,%rsp
+  801641:	5b                   	pop    %rbx
+  801642:	41 5c                	pop    %r12
+  801644:	41 5d                	pop    %r13
+  801646:	5d                   	pop    %rbp
+  801647:	c3                   	ret
+        return -E_INVAL;
+  801648:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164d:	eb ee                	jmp    80163d <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80164f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801654:	eb e7                	jmp    80163d <devfile_send_snapshot+0xc6>
+  801656:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165b:	eb e0                	jmp    80163d <devfile_send_snapshot+0xc6>
+  80165d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801662:	eb d9                	jmp    80163d <devfile_send_snapshot+0xc6>
+
+0000000000801664 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801664:	48 85 ff             	test   %rdi,%rdi
+  801667:	0f 84 41 01 00 00    	je     8017ae <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80166d:	55                   	push   %rbp
+  80166e:	48 89 e5             	mov    %rsp,%rbp
+  801671:	41 57                	push   %r15
+  801673:	41 56                	push   %r14
+  801675:	41 55                	push   %r13
+  801677:	41 54                	push   %r12
+  801679:	53                   	push   %rbx
+  80167a:	48 83 ec 08          	sub    $0x8,%rsp
+  80167e:	49 89 fc             	mov    %rdi,%r12
+  801681:	49 89 f5             	mov    %rsi,%r13
+  801684:	48 89 d3             	mov    %rdx,%rbx
+  801687:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80168a:	48 85 f6             	test   %rsi,%rsi
+  80168d:	0f 84 ff 00 00 00    	je     801792 <devfile_diff_snapshots+0x12e>
+  801693:	48 85 d2             	test   %rdx,%rdx
+  801696:	0f 84 fd 00 00 00    	je     801799 <devfile_diff_snapshots+0x135>
+  80169c:	48 85 c9             	test   %rcx,%rcx
+  80169f:	0f 84 f4 00 00 00    	je     801799 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016a5:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8016ac:	00 00 00 
+  8016af:	ff d0                	call   *%rax
+  8016b1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016b7:	0f 87 e3 00 00 00    	ja     8017a0 <devfile_diff_snapshots+0x13c>
+  8016bd:	4c 89 ef             	mov    %r13,%rdi
+  8016c0:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8016c7:	00 00 00 
+  8016ca:	ff d0                	call   *%rax
+  8016cc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d2:	0f 87 cf 00 00 00    	ja     8017a7 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016d8:	4c 89 e6             	mov    %r12,%rsi
+  8016db:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016e2:	00 00 00 
+  8016e5:	4c 89 e7             	mov    %r12,%rdi
+  8016e8:	49 bf 57 2f 80 00 00 	movabs $0x802f57,%r15
+  8016ef:	00 00 00 
+  8016f2:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8016f5:	4c 89 ee             	mov    %r13,%rsi
+  8016f8:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8016ff:	00 
+  801700:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801703:	48 8b 03             	mov    (%rbx),%rax
+  801706:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80170d:	00 
+  80170e:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801712:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801719:	00 
+  80171a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80171e:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801725:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801726:	be 00 00 00 00       	mov    $0x0,%esi
+  80172b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801730:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801737:	00 00 00 
+  80173a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 43                	js     801783 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801740:	49 8b 04 24          	mov    (%r12),%rax
+  801744:	48 89 03             	mov    %rax,(%rbx)
+  801747:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80174c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801750:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801755:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801759:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80175e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801762:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801766:	48 c1 e2 03          	shl    $0x3,%rdx
+  80176a:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80176f:	4c 89 f7             	mov    %r14,%rdi
+  801772:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  801779:	00 00 00 
+  80177c:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80177e:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  801783:	48 83 c4 08          	add    $0x8,%rsp
+  801787:	5b                   	pop    %rbx
+  801788:	41 5c                	pop    %r12
+  80178a:	41 5d                	pop    %r13
+  80178c:	41 5e                	pop    %r14
+  80178e:	41 5f                	pop    %r15
+  801790:	5d                   	pop    %rbp
+  801791:	c3                   	ret
+        return -E_INVAL;
+  801792:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801797:	eb ea                	jmp    801783 <devfile_diff_snapshots+0x11f>
+  801799:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179e:	eb e3                	jmp    801783 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a5:	eb dc                	jmp    801783 <devfile_diff_snapshots+0x11f>
+  8017a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ac:	eb d5                	jmp    801783 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017b3:	c3                   	ret
+
+00000000008017b4 <devfile_delete_snapshot>:
+    if (!name) {
+  8017b4:	48 85 ff             	test   %rdi,%rdi
+  8017b7:	74 5f                	je     801818 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	53                   	push   %rbx
+  8017be:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017c5:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+  8017d1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017d7:	77 45                	ja     80181e <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017d9:	48 89 de             	mov    %rbx,%rsi
+  8017dc:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017e3:	00 00 00 
+  8017e6:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  8017ed:	00 00 00 
+  8017f0:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8017f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8017fc:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801803:	00 00 00 
+  801806:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801812:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801816:	c9                   	leave
+  801817:	c3                   	ret
+        return -E_INVAL;
+  801818:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80181d:	c3                   	ret
+        return -E_INVAL;
+  80181e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801823:	eb ed                	jmp    801812 <devfile_delete_snapshot+0x5e>
+
+0000000000801825 <devfile_accept_snapshot>:
+    if (!name) {
+  801825:	48 85 ff             	test   %rdi,%rdi
+  801828:	74 5f                	je     801889 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80182a:	55                   	push   %rbp
+  80182b:	48 89 e5             	mov    %rsp,%rbp
+  80182e:	53                   	push   %rbx
+  80182f:	48 83 ec 08          	sub    $0x8,%rsp
+  801833:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801836:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  80183d:	00 00 00 
+  801840:	ff d0                	call   *%rax
+  801842:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801848:	77 45                	ja     80188f <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80184a:	48 89 de             	mov    %rbx,%rsi
+  80184d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801854:	00 00 00 
+  801857:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  80185e:	00 00 00 
+  801861:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80186d:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801874:	00 00 00 
+  801877:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801880:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801883:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+        return -E_INVAL;
+  801889:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80188e:	c3                   	ret
+        return -E_INVAL;
+  80188f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801894:	eb ed                	jmp    801883 <devfile_accept_snapshot+0x5e>
+
+0000000000801896 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  801896:	48 85 ff             	test   %rdi,%rdi
+  801899:	0f 84 9f 00 00 00    	je     80193e <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80189f:	55                   	push   %rbp
+  8018a0:	48 89 e5             	mov    %rsp,%rbp
+  8018a3:	41 54                	push   %r12
+  8018a5:	53                   	push   %rbx
+  8018a6:	48 89 fb             	mov    %rdi,%rbx
+  8018a9:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018ac:	48 85 f6             	test   %rsi,%rsi
+  8018af:	74 78                	je     801929 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018b1:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8018b8:	00 00 00 
+  8018bb:	ff d0                	call   *%rax
+  8018bd:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018c3:	77 6b                	ja     801930 <devfile_create_snapshot+0x9a>
+  8018c5:	4c 89 e7             	mov    %r12,%rdi
+  8018c8:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8018cf:	00 00 00 
+  8018d2:	ff d0                	call   *%rax
+  8018d4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018da:	77 5b                	ja     801937 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018dc:	48 89 de             	mov    %rbx,%rsi
+  8018df:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018e6:	00 00 00 
+  8018e9:	48 bb 57 2f 80 00 00 	movabs $0x802f57,%rbx
+  8018f0:	00 00 00 
+  8018f3:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8018f5:	4c 89 e6             	mov    %r12,%rsi
+  8018f8:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8018ff:	00 00 00 
+  801902:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801904:	be 00 00 00 00       	mov    $0x0,%esi
+  801909:	bf 08 00 00 00       	mov    $0x8,%edi
+  80190e:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801915:	00 00 00 
+  801918:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801921:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801924:	5b                   	pop    %rbx
+  801925:	41 5c                	pop    %r12
+  801927:	5d                   	pop    %rbp
+  801928:	c3                   	ret
+        return -E_INVAL;
+  801929:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192e:	eb f4                	jmp    801924 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801930:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801935:	eb ed                	jmp    801924 <devfile_create_snapshot+0x8e>
+  801937:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193c:	eb e6                	jmp    801924 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80193e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801943:	c3                   	ret
+
+0000000000801944 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	41 54                	push   %r12
+  80194a:	53                   	push   %rbx
+  80194b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80194e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801951:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801958:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80195a:	be 00 00 00 00       	mov    $0x0,%esi
+  80195f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801964:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 3d                	js     8019b1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801974:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80197b:	00 00 00 
+  80197e:	4c 89 e6             	mov    %r12,%rsi
+  801981:	48 89 df             	mov    %rbx,%rdi
+  801984:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801990:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801997:	00 
+  801998:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80199e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019a5:	00 
+  8019a6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b1:	5b                   	pop    %rbx
+  8019b2:	41 5c                	pop    %r12
+  8019b4:	5d                   	pop    %rbp
+  8019b5:	c3                   	ret
+
+00000000008019b6 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019b6:	55                   	push   %rbp
+  8019b7:	48 89 e5             	mov    %rsp,%rbp
+  8019ba:	41 57                	push   %r15
+  8019bc:	41 56                	push   %r14
+  8019be:	41 55                	push   %r13
+  8019c0:	41 54                	push   %r12
+  8019c2:	53                   	push   %rbx
+  8019c3:	48 83 ec 38          	sub    $0x38,%rsp
+  8019c7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019cb:	49 89 f5             	mov    %rsi,%r13
+  8019ce:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019d1:	48 89 f0             	mov    %rsi,%rax
+  8019d4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019d9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019dd:	75 4f                	jne    801a2e <devfile_readmap+0x78>
+  8019df:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019e3:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8019e9:	75 1f                	jne    801a0a <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8019eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019ef:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8019f3:	49 be 9e 21 80 00 00 	movabs $0x80219e,%r14
+  8019fa:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019fd:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a04:	0f 87 9d 00 00 00    	ja     801aa7 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a0a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a0e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a12:	4d 85 ff             	test   %r15,%r15
+  801a15:	0f 85 cf 00 00 00    	jne    801aea <devfile_readmap+0x134>
+  801a1b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a1f:	48 83 c4 38          	add    $0x38,%rsp
+  801a23:	5b                   	pop    %rbx
+  801a24:	41 5c                	pop    %r12
+  801a26:	41 5d                	pop    %r13
+  801a28:	41 5e                	pop    %r14
+  801a2a:	41 5f                	pop    %r15
+  801a2c:	5d                   	pop    %rbp
+  801a2d:	c3                   	ret
+    size_t totalRead = 0;
+  801a2e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a35:	00 
+  801a36:	eb da                	jmp    801a12 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a38:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a3c:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a3f:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a46:	00 00 00 
+  801a49:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a4f:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a53:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a57:	4c 89 ee             	mov    %r13,%rsi
+  801a5a:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a5f:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  801a66:	00 00 00 
+  801a69:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	7e a3                	jle    801a12 <devfile_readmap+0x5c>
+  801a6f:	48 98                	cltq
+  801a71:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a75:	72 9b                	jb     801a12 <devfile_readmap+0x5c>
+        buf += read;
+  801a77:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a7a:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a7d:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a81:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801a88:	75 88                	jne    801a12 <devfile_readmap+0x5c>
+  801a8a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a8e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a94:	0f 85 78 ff ff ff    	jne    801a12 <devfile_readmap+0x5c>
+  801a9a:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aa1:	0f 86 6b ff ff ff    	jbe    801a12 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801aa7:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801aad:	4d 39 e7             	cmp    %r12,%r15
+  801ab0:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ab4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801abb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801abf:	0f 84 73 ff ff ff    	je     801a38 <devfile_readmap+0x82>
+  801ac5:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ac9:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801ace:	41 ff d6             	call   *%r14
+  801ad1:	a8 40                	test   $0x40,%al
+  801ad3:	0f 85 39 ff ff ff    	jne    801a12 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ad9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ae0:	4c 39 e3             	cmp    %r12,%rbx
+  801ae3:	72 e4                	jb     801ac9 <devfile_readmap+0x113>
+  801ae5:	e9 4e ff ff ff       	jmp    801a38 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801aea:	4c 89 fa             	mov    %r15,%rdx
+  801aed:	4c 89 ee             	mov    %r13,%rsi
+  801af0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801af4:	48 b8 37 14 80 00 00 	movabs $0x801437,%rax
+  801afb:	00 00 00 
+  801afe:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b00:	48 85 c0             	test   %rax,%rax
+  801b03:	78 0c                	js     801b11 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b05:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b09:	48 01 f0             	add    %rsi,%rax
+  801b0c:	e9 0e ff ff ff       	jmp    801a1f <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b11:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b15:	48 85 f6             	test   %rsi,%rsi
+  801b18:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b1c:	e9 fe fe ff ff       	jmp    801a1f <devfile_readmap+0x69>
+
+0000000000801b21 <open>:
+open(const char *path, int mode) {
+  801b21:	55                   	push   %rbp
+  801b22:	48 89 e5             	mov    %rsp,%rbp
+  801b25:	41 55                	push   %r13
+  801b27:	41 54                	push   %r12
+  801b29:	53                   	push   %rbx
+  801b2a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b2e:	49 89 fc             	mov    %rdi,%r12
+  801b31:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b34:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+  801b40:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b46:	0f 87 8a 00 00 00    	ja     801bd6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b4c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b50:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+  801b5c:	89 c3                	mov    %eax,%ebx
+  801b5e:	85 c0                	test   %eax,%eax
+  801b60:	78 50                	js     801bb2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b62:	4c 89 e6             	mov    %r12,%rsi
+  801b65:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b6c:	00 00 00 
+  801b6f:	48 89 df             	mov    %rbx,%rdi
+  801b72:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b7e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b85:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801b89:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b8e:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	89 c3                	mov    %eax,%ebx
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 1f                	js     801bbf <open+0x9e>
+    return fd2num(fd);
+  801ba0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ba4:	48 b8 51 06 80 00 00 	movabs $0x800651,%rax
+  801bab:	00 00 00 
+  801bae:	ff d0                	call   *%rax
+  801bb0:	89 c3                	mov    %eax,%ebx
+}
+  801bb2:	89 d8                	mov    %ebx,%eax
+  801bb4:	48 83 c4 18          	add    $0x18,%rsp
+  801bb8:	5b                   	pop    %rbx
+  801bb9:	41 5c                	pop    %r12
+  801bbb:	41 5d                	pop    %r13
+  801bbd:	5d                   	pop    %rbp
+  801bbe:	c3                   	ret
+        fd_close(fd, 0);
+  801bbf:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bc8:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+        return res;
+  801bd4:	eb dc                	jmp    801bb2 <open+0x91>
+        return -E_BAD_PATH;
+  801bd6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bdb:	eb d5                	jmp    801bb2 <open+0x91>
+
+0000000000801bdd <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bdd:	55                   	push   %rbp
+  801bde:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801be1:	be 00 00 00 00       	mov    $0x0,%esi
+  801be6:	bf 13 00 00 00       	mov    $0x13,%edi
+  801beb:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+}
+  801bf7:	5d                   	pop    %rbp
+  801bf8:	c3                   	ret
+
+0000000000801bf9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801bf9:	55                   	push   %rbp
+  801bfa:	48 89 e5             	mov    %rsp,%rbp
+  801bfd:	41 54                	push   %r12
+  801bff:	53                   	push   %rbx
+  801c00:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c03:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c12:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  801c19:	00 00 00 
+  801c1c:	48 89 df             	mov    %rbx,%rdi
+  801c1f:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  801c26:	00 00 00 
+  801c29:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c2b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c30:	41 2b 04 24          	sub    (%r12),%eax
+  801c34:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c41:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c44:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c4b:	00 00 00 
+  801c4e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5a:	5b                   	pop    %rbx
+  801c5b:	41 5c                	pop    %r12
+  801c5d:	5d                   	pop    %rbp
+  801c5e:	c3                   	ret
+
+0000000000801c5f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	41 54                	push   %r12
+  801c65:	53                   	push   %rbx
+  801c66:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c6e:	48 89 fe             	mov    %rdi,%rsi
+  801c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c76:	49 bc 4d 03 80 00 00 	movabs $0x80034d,%r12
+  801c7d:	00 00 00 
+  801c80:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c83:	48 89 df             	mov    %rbx,%rdi
+  801c86:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801c8d:	00 00 00 
+  801c90:	ff d0                	call   *%rax
+  801c92:	48 89 c6             	mov    %rax,%rsi
+  801c95:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9f:	41 ff d4             	call   *%r12
+}
+  801ca2:	5b                   	pop    %rbx
+  801ca3:	41 5c                	pop    %r12
+  801ca5:	5d                   	pop    %rbp
+  801ca6:	c3                   	ret
+
+0000000000801ca7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ca7:	55                   	push   %rbp
+  801ca8:	48 89 e5             	mov    %rsp,%rbp
+  801cab:	41 57                	push   %r15
+  801cad:	41 56                	push   %r14
+  801caf:	41 55                	push   %r13
+  801cb1:	41 54                	push   %r12
+  801cb3:	53                   	push   %rbx
+  801cb4:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb8:	49 89 fc             	mov    %rdi,%r12
+  801cbb:	49 89 f5             	mov    %rsi,%r13
+  801cbe:	49 89 d7             	mov    %rdx,%r15
+  801cc1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cc5:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801ccc:	00 00 00 
+  801ccf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cd1:	4d 85 ff             	test   %r15,%r15
+  801cd4:	0f 84 af 00 00 00    	je     801d89 <devpipe_write+0xe2>
+  801cda:	48 89 c3             	mov    %rax,%rbx
+  801cdd:	4c 89 f8             	mov    %r15,%rax
+  801ce0:	4d 89 ef             	mov    %r13,%r15
+  801ce3:	4c 01 e8             	add    %r13,%rax
+  801ce6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801cea:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  801cf1:	00 00 00 
+            sys_yield();
+  801cf4:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  801cfb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801cfe:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d01:	48 63 ce             	movslq %esi,%rcx
+  801d04:	48 63 03             	movslq (%rbx),%rax
+  801d07:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d0d:	48 39 c1             	cmp    %rax,%rcx
+  801d10:	72 2e                	jb     801d40 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d12:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d17:	48 89 da             	mov    %rbx,%rdx
+  801d1a:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d1f:	4c 89 e7             	mov    %r12,%rdi
+  801d22:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	74 66                	je     801d8f <devpipe_write+0xe8>
+            sys_yield();
+  801d29:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d2c:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d2f:	48 63 ce             	movslq %esi,%rcx
+  801d32:	48 63 03             	movslq (%rbx),%rax
+  801d35:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d3b:	48 39 c1             	cmp    %rax,%rcx
+  801d3e:	73 d2                	jae    801d12 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d40:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d44:	48 89 ca             	mov    %rcx,%rdx
+  801d47:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d4b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d52:	08 10 20 
+  801d55:	48 f7 e2             	mul    %rdx
+  801d58:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d5c:	48 89 d0             	mov    %rdx,%rax
+  801d5f:	48 c1 e0 09          	shl    $0x9,%rax
+  801d63:	48 29 d0             	sub    %rdx,%rax
+  801d66:	48 c1 e0 03          	shl    $0x3,%rax
+  801d6a:	48 29 c1             	sub    %rax,%rcx
+  801d6d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d72:	83 c6 01             	add    $0x1,%esi
+  801d75:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d78:	49 83 c7 01          	add    $0x1,%r15
+  801d7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d80:	49 39 c7             	cmp    %rax,%r15
+  801d83:	0f 85 75 ff ff ff    	jne    801cfe <devpipe_write+0x57>
+    return n;
+  801d89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d8d:	eb 05                	jmp    801d94 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d94:	48 83 c4 18          	add    $0x18,%rsp
+  801d98:	5b                   	pop    %rbx
+  801d99:	41 5c                	pop    %r12
+  801d9b:	41 5d                	pop    %r13
+  801d9d:	41 5e                	pop    %r14
+  801d9f:	41 5f                	pop    %r15
+  801da1:	5d                   	pop    %rbp
+  801da2:	c3                   	ret
+
+0000000000801da3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801da3:	55                   	push   %rbp
+  801da4:	48 89 e5             	mov    %rsp,%rbp
+  801da7:	41 57                	push   %r15
+  801da9:	41 56                	push   %r14
+  801dab:	41 55                	push   %r13
+  801dad:	41 54                	push   %r12
+  801daf:	53                   	push   %rbx
+  801db0:	48 83 ec 18          	sub    $0x18,%rsp
+  801db4:	49 89 fc             	mov    %rdi,%r12
+  801db7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dbf:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801dce:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dd4:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  801ddb:	00 00 00 
+            sys_yield();
+  801dde:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  801de5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801de8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ded:	74 7d                	je     801e6c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801def:	8b 03                	mov    (%rbx),%eax
+  801df1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801df4:	75 26                	jne    801e1c <devpipe_read+0x79>
+            if (i > 0) return i;
+  801df6:	4d 85 ff             	test   %r15,%r15
+  801df9:	75 77                	jne    801e72 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dfb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e00:	48 89 da             	mov    %rbx,%rdx
+  801e03:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e08:	4c 89 e7             	mov    %r12,%rdi
+  801e0b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	74 72                	je     801e84 <devpipe_read+0xe1>
+            sys_yield();
+  801e12:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e15:	8b 03                	mov    (%rbx),%eax
+  801e17:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e1a:	74 df                	je     801dfb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e1c:	48 63 c8             	movslq %eax,%rcx
+  801e1f:	48 89 ca             	mov    %rcx,%rdx
+  801e22:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e26:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e2d:	08 10 20 
+  801e30:	48 89 d0             	mov    %rdx,%rax
+  801e33:	48 f7 e6             	mul    %rsi
+  801e36:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e3a:	48 89 d0             	mov    %rdx,%rax
+  801e3d:	48 c1 e0 09          	shl    $0x9,%rax
+  801e41:	48 29 d0             	sub    %rdx,%rax
+  801e44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e4b:	00 
+  801e4c:	48 89 c8             	mov    %rcx,%rax
+  801e4f:	48 29 d0             	sub    %rdx,%rax
+  801e52:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e57:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e5b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e5f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e62:	49 83 c7 01          	add    $0x1,%r15
+  801e66:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e6a:	75 83                	jne    801def <devpipe_read+0x4c>
+    return n;
+  801e6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e70:	eb 03                	jmp    801e75 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e72:	4c 89 f8             	mov    %r15,%rax
+}
+  801e75:	48 83 c4 18          	add    $0x18,%rsp
+  801e79:	5b                   	pop    %rbx
+  801e7a:	41 5c                	pop    %r12
+  801e7c:	41 5d                	pop    %r13
+  801e7e:	41 5e                	pop    %r14
+  801e80:	41 5f                	pop    %r15
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e89:	eb ea                	jmp    801e75 <devpipe_read+0xd2>
+
+0000000000801e8b <pipe>:
+pipe(int pfd[2]) {
+  801e8b:	55                   	push   %rbp
+  801e8c:	48 89 e5             	mov    %rsp,%rbp
+  801e8f:	41 55                	push   %r13
+  801e91:	41 54                	push   %r12
+  801e93:	53                   	push   %rbx
+  801e94:	48 83 ec 18          	sub    $0x18,%rsp
+  801e98:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801e9b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801e9f:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+  801eab:	89 c3                	mov    %eax,%ebx
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	0f 88 a0 01 00 00    	js     802055 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801eb5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ebf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec8:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	0f 88 77 01 00 00    	js     802055 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801ede:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801ee2:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+  801eee:	89 c3                	mov    %eax,%ebx
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	0f 88 43 01 00 00    	js     80203b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801ef8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801efd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f02:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0b:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  801f12:	00 00 00 
+  801f15:	ff d0                	call   *%rax
+  801f17:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	0f 88 1a 01 00 00    	js     80203b <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f21:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f25:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+  801f31:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f34:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f3e:	48 89 c6             	mov    %rax,%rsi
+  801f41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f46:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	89 c3                	mov    %eax,%ebx
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	0f 88 c5 00 00 00    	js     802021 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f5c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f60:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	48 89 c1             	mov    %rax,%rcx
+  801f6f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f75:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f80:	4c 89 ee             	mov    %r13,%rsi
+  801f83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f88:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+  801f94:	89 c3                	mov    %eax,%ebx
+  801f96:	85 c0                	test   %eax,%eax
+  801f98:	78 6e                	js     802008 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801f9a:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f9f:	4c 89 ef             	mov    %r13,%rdi
+  801fa2:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	83 f8 02             	cmp    $0x2,%eax
+  801fb1:	0f 85 ab 00 00 00    	jne    802062 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fb7:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fbe:	00 00 
+  801fc0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fc4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fc6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fca:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801fd1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fd5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801fd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801fe2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fe6:	48 bb 51 06 80 00 00 	movabs $0x800651,%rbx
+  801fed:	00 00 00 
+  801ff0:	ff d3                	call   *%rbx
+  801ff2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801ff6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801ffa:	ff d3                	call   *%rbx
+  801ffc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802006:	eb 4d                	jmp    802055 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802008:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80200d:	4c 89 ee             	mov    %r13,%rsi
+  802010:	bf 00 00 00 00       	mov    $0x0,%edi
+  802015:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  80201c:	00 00 00 
+  80201f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802021:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802026:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80202a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80202f:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80203b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802040:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802044:	bf 00 00 00 00       	mov    $0x0,%edi
+  802049:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+}
+  802055:	89 d8                	mov    %ebx,%eax
+  802057:	48 83 c4 18          	add    $0x18,%rsp
+  80205b:	5b                   	pop    %rbx
+  80205c:	41 5c                	pop    %r12
+  80205e:	41 5d                	pop    %r13
+  802060:	5d                   	pop    %rbp
+  802061:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802062:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  802069:	00 00 00 
+  80206c:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  802073:	00 00 00 
+  802076:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80207b:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  802082:	00 00 00 
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208a:	49 b8 e2 24 80 00 00 	movabs $0x8024e2,%r8
+  802091:	00 00 00 
+  802094:	41 ff d0             	call   *%r8
+
+0000000000802097 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80209f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020a3:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 35                	js     8020e8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020b3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020b7:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+  8020c3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020d0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d4:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	0f 94 c0             	sete   %al
+  8020e5:	0f b6 c0             	movzbl %al,%eax
+}
+  8020e8:	c9                   	leave
+  8020e9:	c3                   	ret
+
+00000000008020ea <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8020ea:	48 89 f8             	mov    %rdi,%rax
+  8020ed:	48 c1 e8 27          	shr    $0x27,%rax
+  8020f1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8020f8:	01 00 00 
+  8020fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8020ff:	f6 c2 01             	test   $0x1,%dl
+  802102:	74 6d                	je     802171 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802104:	48 89 f8             	mov    %rdi,%rax
+  802107:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80210b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802112:	01 00 00 
+  802115:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802119:	f6 c2 01             	test   $0x1,%dl
+  80211c:	74 62                	je     802180 <get_uvpt_entry+0x96>
+  80211e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802125:	01 00 00 
+  802128:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80212c:	f6 c2 80             	test   $0x80,%dl
+  80212f:	75 4f                	jne    802180 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802131:	48 89 f8             	mov    %rdi,%rax
+  802134:	48 c1 e8 15          	shr    $0x15,%rax
+  802138:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80213f:	01 00 00 
+  802142:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802146:	f6 c2 01             	test   $0x1,%dl
+  802149:	74 44                	je     80218f <get_uvpt_entry+0xa5>
+  80214b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802152:	01 00 00 
+  802155:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802159:	f6 c2 80             	test   $0x80,%dl
+  80215c:	75 31                	jne    80218f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80215e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802162:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802169:	01 00 00 
+  80216c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802170:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802171:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802178:	01 00 00 
+  80217b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80217f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802180:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802187:	01 00 00 
+  80218a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80218e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80218f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802196:	01 00 00 
+  802199:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80219d:	c3                   	ret
+
+000000000080219e <get_prot>:
+
+int
+get_prot(void *va) {
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021a2:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+  8021ae:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021b1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021b6:	89 c1                	mov    %eax,%ecx
+  8021b8:	83 c9 04             	or     $0x4,%ecx
+  8021bb:	f6 c2 01             	test   $0x1,%dl
+  8021be:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021c1:	89 c1                	mov    %eax,%ecx
+  8021c3:	83 c9 02             	or     $0x2,%ecx
+  8021c6:	f6 c2 02             	test   $0x2,%dl
+  8021c9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021cc:	89 c1                	mov    %eax,%ecx
+  8021ce:	83 c9 01             	or     $0x1,%ecx
+  8021d1:	48 85 d2             	test   %rdx,%rdx
+  8021d4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021d7:	89 c1                	mov    %eax,%ecx
+  8021d9:	83 c9 40             	or     $0x40,%ecx
+  8021dc:	f6 c6 04             	test   $0x4,%dh
+  8021df:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021e2:	5d                   	pop    %rbp
+  8021e3:	c3                   	ret
+
+00000000008021e4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021e4:	55                   	push   %rbp
+  8021e5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021e8:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8021f4:	48 c1 e8 06          	shr    $0x6,%rax
+  8021f8:	83 e0 01             	and    $0x1,%eax
+}
+  8021fb:	5d                   	pop    %rbp
+  8021fc:	c3                   	ret
+
+00000000008021fd <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8021fd:	55                   	push   %rbp
+  8021fe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802201:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80220d:	48 c1 e8 05          	shr    $0x5,%rax
+  802211:	83 e0 01             	and    $0x1,%eax
+}
+  802214:	5d                   	pop    %rbp
+  802215:	c3                   	ret
+
+0000000000802216 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80221a:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	83 e0 01             	and    $0x1,%eax
+}
+  802229:	5d                   	pop    %rbp
+  80222a:	c3                   	ret
+
+000000000080222b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	41 57                	push   %r15
+  802231:	41 56                	push   %r14
+  802233:	41 55                	push   %r13
+  802235:	41 54                	push   %r12
+  802237:	53                   	push   %rbx
+  802238:	48 83 ec 18          	sub    $0x18,%rsp
+  80223c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802240:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802244:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802249:	49 bd 16 22 80 00 00 	movabs $0x802216,%r13
+  802250:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802253:	49 bf 9e 21 80 00 00 	movabs $0x80219e,%r15
+  80225a:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80225d:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802264:	00 00 00 
+  802267:	eb 0c                	jmp    802275 <foreach_shared_region+0x4a>
+  802269:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802270:	4c 39 f3             	cmp    %r14,%rbx
+  802273:	74 2e                	je     8022a3 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  802275:	48 89 df             	mov    %rbx,%rdi
+  802278:	41 ff d5             	call   *%r13
+  80227b:	84 c0                	test   %al,%al
+  80227d:	74 ea                	je     802269 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80227f:	48 89 df             	mov    %rbx,%rdi
+  802282:	41 ff d7             	call   *%r15
+  802285:	a8 40                	test   $0x40,%al
+  802287:	74 e0                	je     802269 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  802289:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802290:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802294:	48 89 df             	mov    %rbx,%rdi
+  802297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80229b:	ff d0                	call   *%rax
+				if (res < 0) {
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	79 c8                	jns    802269 <foreach_shared_region+0x3e>
+  8022a1:	eb 05                	jmp    8022a8 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a8:	48 83 c4 18          	add    $0x18,%rsp
+  8022ac:	5b                   	pop    %rbx
+  8022ad:	41 5c                	pop    %r12
+  8022af:	41 5d                	pop    %r13
+  8022b1:	41 5e                	pop    %r14
+  8022b3:	41 5f                	pop    %r15
+  8022b5:	5d                   	pop    %rbp
+  8022b6:	c3                   	ret
+
+00000000008022b7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bc:	c3                   	ret
+
+00000000008022bd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+  8022c1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022c4:	48 be d4 37 80 00 00 	movabs $0x8037d4,%rsi
+  8022cb:	00 00 00 
+  8022ce:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  8022d5:	00 00 00 
+  8022d8:	ff d0                	call   *%rax
+    return 0;
+}
+  8022da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022df:	5d                   	pop    %rbp
+  8022e0:	c3                   	ret
+
+00000000008022e1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022e1:	55                   	push   %rbp
+  8022e2:	48 89 e5             	mov    %rsp,%rbp
+  8022e5:	41 57                	push   %r15
+  8022e7:	41 56                	push   %r14
+  8022e9:	41 55                	push   %r13
+  8022eb:	41 54                	push   %r12
+  8022ed:	53                   	push   %rbx
+  8022ee:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8022f5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8022fc:	48 85 d2             	test   %rdx,%rdx
+  8022ff:	74 7a                	je     80237b <devcons_write+0x9a>
+  802301:	49 89 d6             	mov    %rdx,%r14
+  802304:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80230a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80230f:	49 bf 51 31 80 00 00 	movabs $0x803151,%r15
+  802316:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802319:	4c 89 f3             	mov    %r14,%rbx
+  80231c:	48 29 f3             	sub    %rsi,%rbx
+  80231f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802324:	48 39 c3             	cmp    %rax,%rbx
+  802327:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80232b:	4c 63 eb             	movslq %ebx,%r13
+  80232e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802335:	48 01 c6             	add    %rax,%rsi
+  802338:	4c 89 ea             	mov    %r13,%rdx
+  80233b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802342:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802345:	4c 89 ee             	mov    %r13,%rsi
+  802348:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80234f:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80235b:	41 01 dc             	add    %ebx,%r12d
+  80235e:	49 63 f4             	movslq %r12d,%rsi
+  802361:	4c 39 f6             	cmp    %r14,%rsi
+  802364:	72 b3                	jb     802319 <devcons_write+0x38>
+    return res;
+  802366:	49 63 c4             	movslq %r12d,%rax
+}
+  802369:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802370:	5b                   	pop    %rbx
+  802371:	41 5c                	pop    %r12
+  802373:	41 5d                	pop    %r13
+  802375:	41 5e                	pop    %r14
+  802377:	41 5f                	pop    %r15
+  802379:	5d                   	pop    %rbp
+  80237a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80237b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802381:	eb e3                	jmp    802366 <devcons_write+0x85>
+
+0000000000802383 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802383:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238b:	48 85 c0             	test   %rax,%rax
+  80238e:	74 55                	je     8023e5 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+  802394:	41 55                	push   %r13
+  802396:	41 54                	push   %r12
+  802398:	53                   	push   %rbx
+  802399:	48 83 ec 08          	sub    $0x8,%rsp
+  80239d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023a0:	48 bb 25 01 80 00 00 	movabs $0x800125,%rbx
+  8023a7:	00 00 00 
+  8023aa:	49 bc f2 01 80 00 00 	movabs $0x8001f2,%r12
+  8023b1:	00 00 00 
+  8023b4:	eb 03                	jmp    8023b9 <devcons_read+0x36>
+  8023b6:	41 ff d4             	call   *%r12
+  8023b9:	ff d3                	call   *%rbx
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	74 f7                	je     8023b6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023bf:	48 63 d0             	movslq %eax,%rdx
+  8023c2:	78 13                	js     8023d7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c9:	83 f8 04             	cmp    $0x4,%eax
+  8023cc:	74 09                	je     8023d7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023ce:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023d2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023d7:	48 89 d0             	mov    %rdx,%rax
+  8023da:	48 83 c4 08          	add    $0x8,%rsp
+  8023de:	5b                   	pop    %rbx
+  8023df:	41 5c                	pop    %r12
+  8023e1:	41 5d                	pop    %r13
+  8023e3:	5d                   	pop    %rbp
+  8023e4:	c3                   	ret
+  8023e5:	48 89 d0             	mov    %rdx,%rax
+  8023e8:	c3                   	ret
+
+00000000008023e9 <cputchar>:
+cputchar(int ch) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8023f1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8023f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8023fa:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8023fe:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802405:	00 00 00 
+  802408:	ff d0                	call   *%rax
+}
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+000000000080240c <getchar>:
+getchar(void) {
+  80240c:	55                   	push   %rbp
+  80240d:	48 89 e5             	mov    %rsp,%rbp
+  802410:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802414:	ba 01 00 00 00       	mov    $0x1,%edx
+  802419:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80241d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802422:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+  80242e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 06                	js     80243a <getchar+0x2e>
+  802434:	74 08                	je     80243e <getchar+0x32>
+  802436:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80243a:	89 d0                	mov    %edx,%eax
+  80243c:	c9                   	leave
+  80243d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80243e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802443:	eb f5                	jmp    80243a <getchar+0x2e>
+
+0000000000802445 <iscons>:
+iscons(int fdnum) {
+  802445:	55                   	push   %rbp
+  802446:	48 89 e5             	mov    %rsp,%rbp
+  802449:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80244d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802451:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 18                	js     802479 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802461:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802465:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80246c:	00 00 00 
+  80246f:	8b 00                	mov    (%rax),%eax
+  802471:	39 02                	cmp    %eax,(%rdx)
+  802473:	0f 94 c0             	sete   %al
+  802476:	0f b6 c0             	movzbl %al,%eax
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+000000000080247b <opencons>:
+opencons(void) {
+  80247b:	55                   	push   %rbp
+  80247c:	48 89 e5             	mov    %rsp,%rbp
+  80247f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802483:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802487:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	85 c0                	test   %eax,%eax
+  802495:	78 49                	js     8024e0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802497:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80249c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024aa:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  8024b1:	00 00 00 
+  8024b4:	ff d0                	call   *%rax
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	78 26                	js     8024e0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024be:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024c5:	00 00 
+  8024c7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024cd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024d4:	48 b8 51 06 80 00 00 	movabs $0x800651,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+
+00000000008024e2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	41 56                	push   %r14
+  8024e8:	41 55                	push   %r13
+  8024ea:	41 54                	push   %r12
+  8024ec:	53                   	push   %rbx
+  8024ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f1:	49 89 fc             	mov    %rdi,%r12
+  8024f4:	41 89 f5             	mov    %esi,%r13d
+  8024f7:	48 89 d3             	mov    %rdx,%rbx
+  8024fa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8024fe:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802502:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802506:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80250d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802511:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802515:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802519:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80251d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802524:	00 00 00 
+  802527:	4c 8b 30             	mov    (%rax),%r14
+  80252a:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	89 c6                	mov    %eax,%esi
+  802538:	45 89 e8             	mov    %r13d,%r8d
+  80253b:	4c 89 e1             	mov    %r12,%rcx
+  80253e:	4c 89 f2             	mov    %r14,%rdx
+  802541:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  802548:	00 00 00 
+  80254b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802550:	49 bc 32 26 80 00 00 	movabs $0x802632,%r12
+  802557:	00 00 00 
+  80255a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80255d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802561:	48 89 df             	mov    %rbx,%rdi
+  802564:	48 b8 ce 25 80 00 00 	movabs $0x8025ce,%rax
+  80256b:	00 00 00 
+  80256e:	ff d0                	call   *%rax
+    cprintf("\n");
+  802570:	48 bf 33 37 80 00 00 	movabs $0x803733,%rdi
+  802577:	00 00 00 
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802582:	cc                   	int3
+  802583:	eb fd                	jmp    802582 <_panic+0xa0>
+
+0000000000802585 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	53                   	push   %rbx
+  80258a:	48 83 ec 08          	sub    $0x8,%rsp
+  80258e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802591:	8b 06                	mov    (%rsi),%eax
+  802593:	8d 50 01             	lea    0x1(%rax),%edx
+  802596:	89 16                	mov    %edx,(%rsi)
+  802598:	48 98                	cltq
+  80259a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80259f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025a5:	74 0a                	je     8025b1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025a7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025af:	c9                   	leave
+  8025b0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025b1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025b5:	be ff 00 00 00       	mov    $0xff,%esi
+  8025ba:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  8025c1:	00 00 00 
+  8025c4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025c6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025cc:	eb d9                	jmp    8025a7 <putch+0x22>
+
+00000000008025ce <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+  8025d2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025d9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025dc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025e3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8025e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ed:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8025f0:	48 89 f1             	mov    %rsi,%rcx
+  8025f3:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8025fa:	48 bf 85 25 80 00 00 	movabs $0x802585,%rdi
+  802601:	00 00 00 
+  802604:	48 b8 82 27 80 00 00 	movabs $0x802782,%rax
+  80260b:	00 00 00 
+  80260e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802610:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802617:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80261e:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80262a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802630:	c9                   	leave
+  802631:	c3                   	ret
+
+0000000000802632 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802632:	55                   	push   %rbp
+  802633:	48 89 e5             	mov    %rsp,%rbp
+  802636:	48 83 ec 50          	sub    $0x50,%rsp
+  80263a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80263e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802642:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802646:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80264a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80264e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802655:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802659:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80265d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802661:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802665:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802669:	48 b8 ce 25 80 00 00 	movabs $0x8025ce,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+
+0000000000802677 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802677:	55                   	push   %rbp
+  802678:	48 89 e5             	mov    %rsp,%rbp
+  80267b:	41 57                	push   %r15
+  80267d:	41 56                	push   %r14
+  80267f:	41 55                	push   %r13
+  802681:	41 54                	push   %r12
+  802683:	53                   	push   %rbx
+  802684:	48 83 ec 18          	sub    $0x18,%rsp
+  802688:	49 89 fc             	mov    %rdi,%r12
+  80268b:	49 89 f5             	mov    %rsi,%r13
+  80268e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802692:	8b 45 10             	mov    0x10(%rbp),%eax
+  802695:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802698:	41 89 cf             	mov    %ecx,%r15d
+  80269b:	4c 39 fa             	cmp    %r15,%rdx
+  80269e:	73 5b                	jae    8026fb <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026a0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026a4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026a8:	85 db                	test   %ebx,%ebx
+  8026aa:	7e 0e                	jle    8026ba <print_num+0x43>
+            putch(padc, put_arg);
+  8026ac:	4c 89 ee             	mov    %r13,%rsi
+  8026af:	44 89 f7             	mov    %r14d,%edi
+  8026b2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026b5:	83 eb 01             	sub    $0x1,%ebx
+  8026b8:	75 f2                	jne    8026ac <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026ba:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026be:	48 b9 14 38 80 00 00 	movabs $0x803814,%rcx
+  8026c5:	00 00 00 
+  8026c8:	48 b8 03 38 80 00 00 	movabs $0x803803,%rax
+  8026cf:	00 00 00 
+  8026d2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026df:	49 f7 f7             	div    %r15
+  8026e2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8026e6:	4c 89 ee             	mov    %r13,%rsi
+  8026e9:	41 ff d4             	call   *%r12
+}
+  8026ec:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8026f0:	5b                   	pop    %rbx
+  8026f1:	41 5c                	pop    %r12
+  8026f3:	41 5d                	pop    %r13
+  8026f5:	41 5e                	pop    %r14
+  8026f7:	41 5f                	pop    %r15
+  8026f9:	5d                   	pop    %rbp
+  8026fa:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8026fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802704:	49 f7 f7             	div    %r15
+  802707:	48 83 ec 08          	sub    $0x8,%rsp
+  80270b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80270f:	52                   	push   %rdx
+  802710:	45 0f be c9          	movsbl %r9b,%r9d
+  802714:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802718:	48 89 c2             	mov    %rax,%rdx
+  80271b:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  802722:	00 00 00 
+  802725:	ff d0                	call   *%rax
+  802727:	48 83 c4 10          	add    $0x10,%rsp
+  80272b:	eb 8d                	jmp    8026ba <print_num+0x43>
+
+000000000080272d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80272d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802731:	48 8b 06             	mov    (%rsi),%rax
+  802734:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802738:	73 0a                	jae    802744 <sprintputch+0x17>
+        *state->start++ = ch;
+  80273a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80273e:	48 89 16             	mov    %rdx,(%rsi)
+  802741:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802744:	c3                   	ret
+
+0000000000802745 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802745:	55                   	push   %rbp
+  802746:	48 89 e5             	mov    %rsp,%rbp
+  802749:	48 83 ec 50          	sub    $0x50,%rsp
+  80274d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802751:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802755:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802759:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802760:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802768:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80276c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802770:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802774:	48 b8 82 27 80 00 00 	movabs $0x802782,%rax
+  80277b:	00 00 00 
+  80277e:	ff d0                	call   *%rax
+}
+  802780:	c9                   	leave
+  802781:	c3                   	ret
+
+0000000000802782 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802782:	55                   	push   %rbp
+  802783:	48 89 e5             	mov    %rsp,%rbp
+  802786:	41 57                	push   %r15
+  802788:	41 56                	push   %r14
+  80278a:	41 55                	push   %r13
+  80278c:	41 54                	push   %r12
+  80278e:	53                   	push   %rbx
+  80278f:	48 83 ec 38          	sub    $0x38,%rsp
+  802793:	49 89 fe             	mov    %rdi,%r14
+  802796:	49 89 f5             	mov    %rsi,%r13
+  802799:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80279c:	48 8b 01             	mov    (%rcx),%rax
+  80279f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027a3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ab:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027b3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027b7:	0f b6 3b             	movzbl (%rbx),%edi
+  8027ba:	40 80 ff 25          	cmp    $0x25,%dil
+  8027be:	74 18                	je     8027d8 <vprintfmt+0x56>
+            if (!ch) return;
+  8027c0:	40 84 ff             	test   %dil,%dil
+  8027c3:	0f 84 b1 06 00 00    	je     802e7a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027c9:	40 0f b6 ff          	movzbl %dil,%edi
+  8027cd:	4c 89 ee             	mov    %r13,%rsi
+  8027d0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027d3:	4c 89 e3             	mov    %r12,%rbx
+  8027d6:	eb db                	jmp    8027b3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027dd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027e1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8027e6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027ec:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8027f3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8027f7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8027fc:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802801:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802804:	83 e8 23             	sub    $0x23,%eax
+  802807:	3c 57                	cmp    $0x57,%al
+  802809:	0f 87 51 06 00 00    	ja     802e60 <vprintfmt+0x6de>
+  80280f:	0f b6 c0             	movzbl %al,%eax
+  802812:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  802819:	00 00 00 
+  80281c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80281f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802822:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802826:	eb cf                	jmp    8027f7 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802828:	49 89 dc             	mov    %rbx,%r12
+  80282b:	be 01 00 00 00       	mov    $0x1,%esi
+  802830:	eb c5                	jmp    8027f7 <vprintfmt+0x75>
+            padc = ch;
+  802832:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802836:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802839:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80283c:	eb b9                	jmp    8027f7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80283e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802841:	83 f8 2f             	cmp    $0x2f,%eax
+  802844:	77 24                	ja     80286a <vprintfmt+0xe8>
+  802846:	89 c1                	mov    %eax,%ecx
+  802848:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80284c:	83 c0 08             	add    $0x8,%eax
+  80284f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802852:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802855:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802858:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80285c:	79 99                	jns    8027f7 <vprintfmt+0x75>
+                width = precision;
+  80285e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802862:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802868:	eb 8d                	jmp    8027f7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80286a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80286e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802876:	eb da                	jmp    802852 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802878:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80287d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802881:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802887:	3c 39                	cmp    $0x39,%al
+  802889:	77 1c                	ja     8028a7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80288b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80288f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802893:	0f b6 c0             	movzbl %al,%eax
+  802896:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80289b:	0f b6 03             	movzbl (%rbx),%eax
+  80289e:	3c 39                	cmp    $0x39,%al
+  8028a0:	76 e9                	jbe    80288b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028a2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028a5:	eb b1                	jmp    802858 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028a7:	49 89 dc             	mov    %rbx,%r12
+  8028aa:	eb ac                	jmp    802858 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028ac:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028af:	85 c9                	test   %ecx,%ecx
+  8028b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b6:	0f 49 c1             	cmovns %ecx,%eax
+  8028b9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028bc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028bf:	e9 33 ff ff ff       	jmp    8027f7 <vprintfmt+0x75>
+            lflag++;
+  8028c4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028c7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028ca:	e9 28 ff ff ff       	jmp    8027f7 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8028d5:	77 19                	ja     8028f0 <vprintfmt+0x16e>
+  8028d7:	89 c2                	mov    %eax,%edx
+  8028d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028dd:	83 c0 08             	add    $0x8,%eax
+  8028e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028e3:	8b 3a                	mov    (%rdx),%edi
+  8028e5:	4c 89 ee             	mov    %r13,%rsi
+  8028e8:	41 ff d6             	call   *%r14
+            break;
+  8028eb:	e9 c3 fe ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8028f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028fc:	eb e5                	jmp    8028e3 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8028fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802901:	83 f8 2f             	cmp    $0x2f,%eax
+  802904:	77 5a                	ja     802960 <vprintfmt+0x1de>
+  802906:	89 c2                	mov    %eax,%edx
+  802908:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80290c:	83 c0 08             	add    $0x8,%eax
+  80290f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802912:	8b 02                	mov    (%rdx),%eax
+  802914:	89 c1                	mov    %eax,%ecx
+  802916:	f7 d9                	neg    %ecx
+  802918:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80291b:	83 f9 14             	cmp    $0x14,%ecx
+  80291e:	7f 4e                	jg     80296e <vprintfmt+0x1ec>
+  802920:	48 63 c1             	movslq %ecx,%rax
+  802923:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  80292a:	00 00 00 
+  80292d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802931:	48 85 c0             	test   %rax,%rax
+  802934:	74 38                	je     80296e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802936:	48 89 c1             	mov    %rax,%rcx
+  802939:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  802940:	00 00 00 
+  802943:	4c 89 ee             	mov    %r13,%rsi
+  802946:	4c 89 f7             	mov    %r14,%rdi
+  802949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294e:	49 b8 45 27 80 00 00 	movabs $0x802745,%r8
+  802955:	00 00 00 
+  802958:	41 ff d0             	call   *%r8
+  80295b:	e9 53 fe ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802960:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802964:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802968:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80296c:	eb a4                	jmp    802912 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80296e:	48 ba 2c 38 80 00 00 	movabs $0x80382c,%rdx
+  802975:	00 00 00 
+  802978:	4c 89 ee             	mov    %r13,%rsi
+  80297b:	4c 89 f7             	mov    %r14,%rdi
+  80297e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802983:	49 b8 45 27 80 00 00 	movabs $0x802745,%r8
+  80298a:	00 00 00 
+  80298d:	41 ff d0             	call   *%r8
+  802990:	e9 1e fe ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802998:	83 f8 2f             	cmp    $0x2f,%eax
+  80299b:	77 6c                	ja     802a09 <vprintfmt+0x287>
+  80299d:	89 c2                	mov    %eax,%edx
+  80299f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029a3:	83 c0 08             	add    $0x8,%eax
+  8029a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029a9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029ac:	48 85 d2             	test   %rdx,%rdx
+  8029af:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8029b6:	00 00 00 
+  8029b9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029bd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029c5:	7e 06                	jle    8029cd <vprintfmt+0x24b>
+  8029c7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029cb:	75 4a                	jne    802a17 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029cd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029d1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029d5:	0f b6 00             	movzbl (%rax),%eax
+  8029d8:	84 c0                	test   %al,%al
+  8029da:	0f 85 9a 00 00 00    	jne    802a7a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029e0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029e3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	0f 8e c4 fd ff ff    	jle    8027b3 <vprintfmt+0x31>
+  8029ef:	4c 89 ee             	mov    %r13,%rsi
+  8029f2:	bf 20 00 00 00       	mov    $0x20,%edi
+  8029f7:	41 ff d6             	call   *%r14
+  8029fa:	41 83 ec 01          	sub    $0x1,%r12d
+  8029fe:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a02:	75 eb                	jne    8029ef <vprintfmt+0x26d>
+  802a04:	e9 aa fd ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a15:	eb 92                	jmp    8029a9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a17:	49 63 f7             	movslq %r15d,%rsi
+  802a1a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a1e:	48 b8 34 2f 80 00 00 	movabs $0x802f34,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	48 89 c2             	mov    %rax,%rdx
+  802a2d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a30:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a32:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a35:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	7e 91                	jle    8029cd <vprintfmt+0x24b>
+  802a3c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a41:	4c 89 ee             	mov    %r13,%rsi
+  802a44:	44 89 e7             	mov    %r12d,%edi
+  802a47:	41 ff d6             	call   *%r14
+  802a4a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a4e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a51:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a54:	75 eb                	jne    802a41 <vprintfmt+0x2bf>
+  802a56:	e9 72 ff ff ff       	jmp    8029cd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a5b:	0f b6 f8             	movzbl %al,%edi
+  802a5e:	4c 89 ee             	mov    %r13,%rsi
+  802a61:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a64:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a68:	49 83 c4 01          	add    $0x1,%r12
+  802a6c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a72:	84 c0                	test   %al,%al
+  802a74:	0f 84 66 ff ff ff    	je     8029e0 <vprintfmt+0x25e>
+  802a7a:	45 85 ff             	test   %r15d,%r15d
+  802a7d:	78 0a                	js     802a89 <vprintfmt+0x307>
+  802a7f:	41 83 ef 01          	sub    $0x1,%r15d
+  802a83:	0f 88 57 ff ff ff    	js     8029e0 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a89:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802a8d:	74 cc                	je     802a5b <vprintfmt+0x2d9>
+  802a8f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802a92:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802a97:	80 fa 5e             	cmp    $0x5e,%dl
+  802a9a:	77 c2                	ja     802a5e <vprintfmt+0x2dc>
+  802a9c:	eb bd                	jmp    802a5b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802a9e:	40 84 f6             	test   %sil,%sil
+  802aa1:	75 26                	jne    802ac9 <vprintfmt+0x347>
+    switch (lflag) {
+  802aa3:	85 d2                	test   %edx,%edx
+  802aa5:	74 59                	je     802b00 <vprintfmt+0x37e>
+  802aa7:	83 fa 01             	cmp    $0x1,%edx
+  802aaa:	74 7b                	je     802b27 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  802ab2:	0f 87 96 00 00 00    	ja     802b4e <vprintfmt+0x3cc>
+  802ab8:	89 c2                	mov    %eax,%edx
+  802aba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802abe:	83 c0 08             	add    $0x8,%eax
+  802ac1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ac4:	4c 8b 22             	mov    (%rdx),%r12
+  802ac7:	eb 17                	jmp    802ae0 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ac9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802acc:	83 f8 2f             	cmp    $0x2f,%eax
+  802acf:	77 21                	ja     802af2 <vprintfmt+0x370>
+  802ad1:	89 c2                	mov    %eax,%edx
+  802ad3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ad7:	83 c0 08             	add    $0x8,%eax
+  802ada:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802add:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802ae0:	4d 85 e4             	test   %r12,%r12
+  802ae3:	78 7a                	js     802b5f <vprintfmt+0x3dd>
+            num = i;
+  802ae5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802ae8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802aed:	e9 50 02 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802afe:	eb dd                	jmp    802add <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b03:	83 f8 2f             	cmp    $0x2f,%eax
+  802b06:	77 11                	ja     802b19 <vprintfmt+0x397>
+  802b08:	89 c2                	mov    %eax,%edx
+  802b0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b0e:	83 c0 08             	add    $0x8,%eax
+  802b11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b14:	4c 63 22             	movslq (%rdx),%r12
+  802b17:	eb c7                	jmp    802ae0 <vprintfmt+0x35e>
+  802b19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b25:	eb ed                	jmp    802b14 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  802b2d:	77 11                	ja     802b40 <vprintfmt+0x3be>
+  802b2f:	89 c2                	mov    %eax,%edx
+  802b31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b35:	83 c0 08             	add    $0x8,%eax
+  802b38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b3b:	4c 8b 22             	mov    (%rdx),%r12
+  802b3e:	eb a0                	jmp    802ae0 <vprintfmt+0x35e>
+  802b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b4c:	eb ed                	jmp    802b3b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b5a:	e9 65 ff ff ff       	jmp    802ac4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b5f:	4c 89 ee             	mov    %r13,%rsi
+  802b62:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b67:	41 ff d6             	call   *%r14
+                i = -i;
+  802b6a:	49 f7 dc             	neg    %r12
+  802b6d:	e9 73 ff ff ff       	jmp    802ae5 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b72:	40 84 f6             	test   %sil,%sil
+  802b75:	75 32                	jne    802ba9 <vprintfmt+0x427>
+    switch (lflag) {
+  802b77:	85 d2                	test   %edx,%edx
+  802b79:	74 5d                	je     802bd8 <vprintfmt+0x456>
+  802b7b:	83 fa 01             	cmp    $0x1,%edx
+  802b7e:	0f 84 82 00 00 00    	je     802c06 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b87:	83 f8 2f             	cmp    $0x2f,%eax
+  802b8a:	0f 87 a5 00 00 00    	ja     802c35 <vprintfmt+0x4b3>
+  802b90:	89 c2                	mov    %eax,%edx
+  802b92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b96:	83 c0 08             	add    $0x8,%eax
+  802b99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b9c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802b9f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802ba4:	e9 99 01 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802ba9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bac:	83 f8 2f             	cmp    $0x2f,%eax
+  802baf:	77 19                	ja     802bca <vprintfmt+0x448>
+  802bb1:	89 c2                	mov    %eax,%edx
+  802bb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb7:	83 c0 08             	add    $0x8,%eax
+  802bba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bbd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bc0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bc5:	e9 78 01 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+  802bca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bd6:	eb e5                	jmp    802bbd <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bdb:	83 f8 2f             	cmp    $0x2f,%eax
+  802bde:	77 18                	ja     802bf8 <vprintfmt+0x476>
+  802be0:	89 c2                	mov    %eax,%edx
+  802be2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802be6:	83 c0 08             	add    $0x8,%eax
+  802be9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bec:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802bee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802bf3:	e9 4a 01 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+  802bf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c04:	eb e6                	jmp    802bec <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c09:	83 f8 2f             	cmp    $0x2f,%eax
+  802c0c:	77 19                	ja     802c27 <vprintfmt+0x4a5>
+  802c0e:	89 c2                	mov    %eax,%edx
+  802c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c14:	83 c0 08             	add    $0x8,%eax
+  802c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c1a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c22:	e9 1b 01 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+  802c27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c33:	eb e5                	jmp    802c1a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c41:	e9 56 ff ff ff       	jmp    802b9c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c46:	40 84 f6             	test   %sil,%sil
+  802c49:	75 2e                	jne    802c79 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c4b:	85 d2                	test   %edx,%edx
+  802c4d:	74 59                	je     802ca8 <vprintfmt+0x526>
+  802c4f:	83 fa 01             	cmp    $0x1,%edx
+  802c52:	74 7f                	je     802cd3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c57:	83 f8 2f             	cmp    $0x2f,%eax
+  802c5a:	0f 87 9f 00 00 00    	ja     802cff <vprintfmt+0x57d>
+  802c60:	89 c2                	mov    %eax,%edx
+  802c62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c66:	83 c0 08             	add    $0x8,%eax
+  802c69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c6f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c74:	e9 c9 00 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c7c:	83 f8 2f             	cmp    $0x2f,%eax
+  802c7f:	77 19                	ja     802c9a <vprintfmt+0x518>
+  802c81:	89 c2                	mov    %eax,%edx
+  802c83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c87:	83 c0 08             	add    $0x8,%eax
+  802c8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c90:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c95:	e9 a8 00 00 00       	jmp    802d42 <vprintfmt+0x5c0>
+  802c9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ca6:	eb e5                	jmp    802c8d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802ca8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cab:	83 f8 2f             	cmp    $0x2f,%eax
+  802cae:	77 15                	ja     802cc5 <vprintfmt+0x543>
+  802cb0:	89 c2                	mov    %eax,%edx
+  802cb2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cb6:	83 c0 08             	add    $0x8,%eax
+  802cb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cbc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cbe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cc3:	eb 7d                	jmp    802d42 <vprintfmt+0x5c0>
+  802cc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ccd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cd1:	eb e9                	jmp    802cbc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cd6:	83 f8 2f             	cmp    $0x2f,%eax
+  802cd9:	77 16                	ja     802cf1 <vprintfmt+0x56f>
+  802cdb:	89 c2                	mov    %eax,%edx
+  802cdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ce1:	83 c0 08             	add    $0x8,%eax
+  802ce4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ce7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802cef:	eb 51                	jmp    802d42 <vprintfmt+0x5c0>
+  802cf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cfd:	eb e8                	jmp    802ce7 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802cff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d0b:	e9 5c ff ff ff       	jmp    802c6c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d10:	4c 89 ee             	mov    %r13,%rsi
+  802d13:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d18:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d1b:	4c 89 ee             	mov    %r13,%rsi
+  802d1e:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d23:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d29:	83 f8 2f             	cmp    $0x2f,%eax
+  802d2c:	77 47                	ja     802d75 <vprintfmt+0x5f3>
+  802d2e:	89 c2                	mov    %eax,%edx
+  802d30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d34:	83 c0 08             	add    $0x8,%eax
+  802d37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d3d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d42:	48 83 ec 08          	sub    $0x8,%rsp
+  802d46:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d4a:	0f 94 c0             	sete   %al
+  802d4d:	0f b6 c0             	movzbl %al,%eax
+  802d50:	50                   	push   %rax
+  802d51:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d56:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d5a:	4c 89 ee             	mov    %r13,%rsi
+  802d5d:	4c 89 f7             	mov    %r14,%rdi
+  802d60:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  802d67:	00 00 00 
+  802d6a:	ff d0                	call   *%rax
+            break;
+  802d6c:	48 83 c4 10          	add    $0x10,%rsp
+  802d70:	e9 3e fa ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d81:	eb b7                	jmp    802d3a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d83:	40 84 f6             	test   %sil,%sil
+  802d86:	75 2b                	jne    802db3 <vprintfmt+0x631>
+    switch (lflag) {
+  802d88:	85 d2                	test   %edx,%edx
+  802d8a:	74 56                	je     802de2 <vprintfmt+0x660>
+  802d8c:	83 fa 01             	cmp    $0x1,%edx
+  802d8f:	74 7f                	je     802e10 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802d91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d94:	83 f8 2f             	cmp    $0x2f,%eax
+  802d97:	0f 87 a2 00 00 00    	ja     802e3f <vprintfmt+0x6bd>
+  802d9d:	89 c2                	mov    %eax,%edx
+  802d9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802da3:	83 c0 08             	add    $0x8,%eax
+  802da6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802da9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dac:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802db1:	eb 8f                	jmp    802d42 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802db3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802db6:	83 f8 2f             	cmp    $0x2f,%eax
+  802db9:	77 19                	ja     802dd4 <vprintfmt+0x652>
+  802dbb:	89 c2                	mov    %eax,%edx
+  802dbd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dc1:	83 c0 08             	add    $0x8,%eax
+  802dc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dc7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dca:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dcf:	e9 6e ff ff ff       	jmp    802d42 <vprintfmt+0x5c0>
+  802dd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ddc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802de0:	eb e5                	jmp    802dc7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802de2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802de5:	83 f8 2f             	cmp    $0x2f,%eax
+  802de8:	77 18                	ja     802e02 <vprintfmt+0x680>
+  802dea:	89 c2                	mov    %eax,%edx
+  802dec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802df0:	83 c0 08             	add    $0x8,%eax
+  802df3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802df6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802df8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802dfd:	e9 40 ff ff ff       	jmp    802d42 <vprintfmt+0x5c0>
+  802e02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e0e:	eb e6                	jmp    802df6 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e13:	83 f8 2f             	cmp    $0x2f,%eax
+  802e16:	77 19                	ja     802e31 <vprintfmt+0x6af>
+  802e18:	89 c2                	mov    %eax,%edx
+  802e1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e1e:	83 c0 08             	add    $0x8,%eax
+  802e21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e2c:	e9 11 ff ff ff       	jmp    802d42 <vprintfmt+0x5c0>
+  802e31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e3d:	eb e5                	jmp    802e24 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e4b:	e9 59 ff ff ff       	jmp    802da9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e50:	4c 89 ee             	mov    %r13,%rsi
+  802e53:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e58:	41 ff d6             	call   *%r14
+            break;
+  802e5b:	e9 53 f9 ff ff       	jmp    8027b3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e60:	4c 89 ee             	mov    %r13,%rsi
+  802e63:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e68:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e6b:	48 83 eb 01          	sub    $0x1,%rbx
+  802e6f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e73:	75 f6                	jne    802e6b <vprintfmt+0x6e9>
+  802e75:	e9 39 f9 ff ff       	jmp    8027b3 <vprintfmt+0x31>
+}
+  802e7a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e7e:	5b                   	pop    %rbx
+  802e7f:	41 5c                	pop    %r12
+  802e81:	41 5d                	pop    %r13
+  802e83:	41 5e                	pop    %r14
+  802e85:	41 5f                	pop    %r15
+  802e87:	5d                   	pop    %rbp
+  802e88:	c3                   	ret
+
+0000000000802e89 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802e89:	55                   	push   %rbp
+  802e8a:	48 89 e5             	mov    %rsp,%rbp
+  802e8d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802e91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e95:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802e9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802e9e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ea5:	48 85 ff             	test   %rdi,%rdi
+  802ea8:	74 2b                	je     802ed5 <vsnprintf+0x4c>
+  802eaa:	48 85 f6             	test   %rsi,%rsi
+  802ead:	74 26                	je     802ed5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802eaf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802eb3:	48 bf 2d 27 80 00 00 	movabs $0x80272d,%rdi
+  802eba:	00 00 00 
+  802ebd:	48 b8 82 27 80 00 00 	movabs $0x802782,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ec9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ecd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802ed0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802ed5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eda:	eb f7                	jmp    802ed3 <vsnprintf+0x4a>
+
+0000000000802edc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802edc:	55                   	push   %rbp
+  802edd:	48 89 e5             	mov    %rsp,%rbp
+  802ee0:	48 83 ec 50          	sub    $0x50,%rsp
+  802ee4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ee8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802eec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ef0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802ef7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802efb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f03:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f07:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f0b:	48 b8 89 2e 80 00 00 	movabs $0x802e89,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f17:	c9                   	leave
+  802f18:	c3                   	ret
+
+0000000000802f19 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f19:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f1c:	74 10                	je     802f2e <strlen+0x15>
+    size_t n = 0;
+  802f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f23:	48 83 c0 01          	add    $0x1,%rax
+  802f27:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f2b:	75 f6                	jne    802f23 <strlen+0xa>
+  802f2d:	c3                   	ret
+    size_t n = 0;
+  802f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f33:	c3                   	ret
+
+0000000000802f34 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f34:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f37:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f3c:	48 85 f6             	test   %rsi,%rsi
+  802f3f:	74 11                	je     802f52 <strnlen+0x1e>
+  802f41:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f45:	74 0c                	je     802f53 <strnlen+0x1f>
+  802f47:	48 83 c2 01          	add    $0x1,%rdx
+  802f4b:	48 39 d0             	cmp    %rdx,%rax
+  802f4e:	75 f1                	jne    802f41 <strnlen+0xd>
+  802f50:	eb 04                	jmp    802f56 <strnlen+0x22>
+  802f52:	c3                   	ret
+  802f53:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f56:	c3                   	ret
+
+0000000000802f57 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f57:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f5f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f63:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f66:	48 83 c2 01          	add    $0x1,%rdx
+  802f6a:	84 c9                	test   %cl,%cl
+  802f6c:	75 f1                	jne    802f5f <strcpy+0x8>
+        ;
+    return res;
+}
+  802f6e:	c3                   	ret
+
+0000000000802f6f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f6f:	55                   	push   %rbp
+  802f70:	48 89 e5             	mov    %rsp,%rbp
+  802f73:	41 54                	push   %r12
+  802f75:	53                   	push   %rbx
+  802f76:	48 89 fb             	mov    %rdi,%rbx
+  802f79:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f7c:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  802f83:	00 00 00 
+  802f86:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802f88:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802f8c:	4c 89 e6             	mov    %r12,%rsi
+  802f8f:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+    return dst;
+}
+  802f9b:	48 89 d8             	mov    %rbx,%rax
+  802f9e:	5b                   	pop    %rbx
+  802f9f:	41 5c                	pop    %r12
+  802fa1:	5d                   	pop    %rbp
+  802fa2:	c3                   	ret
+
+0000000000802fa3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fa3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fa6:	48 85 d2             	test   %rdx,%rdx
+  802fa9:	74 1f                	je     802fca <strncpy+0x27>
+  802fab:	48 01 fa             	add    %rdi,%rdx
+  802fae:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fb1:	48 83 c1 01          	add    $0x1,%rcx
+  802fb5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fb9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fbd:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fc1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fc5:	48 39 ca             	cmp    %rcx,%rdx
+  802fc8:	75 e7                	jne    802fb1 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fca:	c3                   	ret
+
+0000000000802fcb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fcb:	48 89 f8             	mov    %rdi,%rax
+  802fce:	48 85 d2             	test   %rdx,%rdx
+  802fd1:	74 24                	je     802ff7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fd3:	48 83 ea 01          	sub    $0x1,%rdx
+  802fd7:	74 1b                	je     802ff4 <strlcpy+0x29>
+  802fd9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fdd:	0f b6 16             	movzbl (%rsi),%edx
+  802fe0:	84 d2                	test   %dl,%dl
+  802fe2:	74 10                	je     802ff4 <strlcpy+0x29>
+            *dst++ = *src++;
+  802fe4:	48 83 c6 01          	add    $0x1,%rsi
+  802fe8:	48 83 c0 01          	add    $0x1,%rax
+  802fec:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802fef:	48 39 c8             	cmp    %rcx,%rax
+  802ff2:	75 e9                	jne    802fdd <strlcpy+0x12>
+        *dst = '\0';
+  802ff4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802ff7:	48 29 f8             	sub    %rdi,%rax
+}
+  802ffa:	c3                   	ret
+
+0000000000802ffb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802ffb:	0f b6 07             	movzbl (%rdi),%eax
+  802ffe:	84 c0                	test   %al,%al
+  803000:	74 13                	je     803015 <strcmp+0x1a>
+  803002:	38 06                	cmp    %al,(%rsi)
+  803004:	75 0f                	jne    803015 <strcmp+0x1a>
+  803006:	48 83 c7 01          	add    $0x1,%rdi
+  80300a:	48 83 c6 01          	add    $0x1,%rsi
+  80300e:	0f b6 07             	movzbl (%rdi),%eax
+  803011:	84 c0                	test   %al,%al
+  803013:	75 ed                	jne    803002 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803015:	0f b6 c0             	movzbl %al,%eax
+  803018:	0f b6 16             	movzbl (%rsi),%edx
+  80301b:	29 d0                	sub    %edx,%eax
+}
+  80301d:	c3                   	ret
+
+000000000080301e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80301e:	48 85 d2             	test   %rdx,%rdx
+  803021:	74 1f                	je     803042 <strncmp+0x24>
+  803023:	0f b6 07             	movzbl (%rdi),%eax
+  803026:	84 c0                	test   %al,%al
+  803028:	74 1e                	je     803048 <strncmp+0x2a>
+  80302a:	3a 06                	cmp    (%rsi),%al
+  80302c:	75 1a                	jne    803048 <strncmp+0x2a>
+  80302e:	48 83 c7 01          	add    $0x1,%rdi
+  803032:	48 83 c6 01          	add    $0x1,%rsi
+  803036:	48 83 ea 01          	sub    $0x1,%rdx
+  80303a:	75 e7                	jne    803023 <strncmp+0x5>
+
+    if (!n) return 0;
+  80303c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803041:	c3                   	ret
+  803042:	b8 00 00 00 00       	mov    $0x0,%eax
+  803047:	c3                   	ret
+  803048:	48 85 d2             	test   %rdx,%rdx
+  80304b:	74 09                	je     803056 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80304d:	0f b6 07             	movzbl (%rdi),%eax
+  803050:	0f b6 16             	movzbl (%rsi),%edx
+  803053:	29 d0                	sub    %edx,%eax
+  803055:	c3                   	ret
+    if (!n) return 0;
+  803056:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80305b:	c3                   	ret
+
+000000000080305c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80305c:	0f b6 17             	movzbl (%rdi),%edx
+  80305f:	84 d2                	test   %dl,%dl
+  803061:	74 18                	je     80307b <strchr+0x1f>
+        if (*str == c) {
+  803063:	0f be d2             	movsbl %dl,%edx
+  803066:	39 f2                	cmp    %esi,%edx
+  803068:	74 17                	je     803081 <strchr+0x25>
+    for (; *str; str++) {
+  80306a:	48 83 c7 01          	add    $0x1,%rdi
+  80306e:	0f b6 17             	movzbl (%rdi),%edx
+  803071:	84 d2                	test   %dl,%dl
+  803073:	75 ee                	jne    803063 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307a:	c3                   	ret
+  80307b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803080:	c3                   	ret
+  803081:	48 89 f8             	mov    %rdi,%rax
+}
+  803084:	c3                   	ret
+
+0000000000803085 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803085:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803088:	0f b6 17             	movzbl (%rdi),%edx
+  80308b:	84 d2                	test   %dl,%dl
+  80308d:	74 13                	je     8030a2 <strfind+0x1d>
+  80308f:	0f be d2             	movsbl %dl,%edx
+  803092:	39 f2                	cmp    %esi,%edx
+  803094:	74 0b                	je     8030a1 <strfind+0x1c>
+  803096:	48 83 c0 01          	add    $0x1,%rax
+  80309a:	0f b6 10             	movzbl (%rax),%edx
+  80309d:	84 d2                	test   %dl,%dl
+  80309f:	75 ee                	jne    80308f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030a1:	c3                   	ret
+  8030a2:	c3                   	ret
+
+00000000008030a3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030a3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030a6:	48 89 f8             	mov    %rdi,%rax
+  8030a9:	48 f7 d8             	neg    %rax
+  8030ac:	83 e0 07             	and    $0x7,%eax
+  8030af:	49 89 d1             	mov    %rdx,%r9
+  8030b2:	49 29 c1             	sub    %rax,%r9
+  8030b5:	78 36                	js     8030ed <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030b7:	40 0f b6 c6          	movzbl %sil,%eax
+  8030bb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030c2:	01 01 01 
+  8030c5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030c9:	40 f6 c7 07          	test   $0x7,%dil
+  8030cd:	75 38                	jne    803107 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030cf:	4c 89 c9             	mov    %r9,%rcx
+  8030d2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030d6:	74 0c                	je     8030e4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030d8:	fc                   	cld
+  8030d9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030dc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030e0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030e4:	4d 85 c9             	test   %r9,%r9
+  8030e7:	75 45                	jne    80312e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8030e9:	4c 89 c0             	mov    %r8,%rax
+  8030ec:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8030ed:	48 85 d2             	test   %rdx,%rdx
+  8030f0:	74 f7                	je     8030e9 <memset+0x46>
+  8030f2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8030f5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8030f8:	48 83 c0 01          	add    $0x1,%rax
+  8030fc:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803100:	48 39 c2             	cmp    %rax,%rdx
+  803103:	75 f3                	jne    8030f8 <memset+0x55>
+  803105:	eb e2                	jmp    8030e9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803107:	40 f6 c7 01          	test   $0x1,%dil
+  80310b:	74 06                	je     803113 <memset+0x70>
+  80310d:	88 07                	mov    %al,(%rdi)
+  80310f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803113:	40 f6 c7 02          	test   $0x2,%dil
+  803117:	74 07                	je     803120 <memset+0x7d>
+  803119:	66 89 07             	mov    %ax,(%rdi)
+  80311c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803120:	40 f6 c7 04          	test   $0x4,%dil
+  803124:	74 a9                	je     8030cf <memset+0x2c>
+  803126:	89 07                	mov    %eax,(%rdi)
+  803128:	48 83 c7 04          	add    $0x4,%rdi
+  80312c:	eb a1                	jmp    8030cf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80312e:	41 f6 c1 04          	test   $0x4,%r9b
+  803132:	74 06                	je     80313a <memset+0x97>
+  803134:	89 07                	mov    %eax,(%rdi)
+  803136:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80313a:	41 f6 c1 02          	test   $0x2,%r9b
+  80313e:	74 07                	je     803147 <memset+0xa4>
+  803140:	66 89 07             	mov    %ax,(%rdi)
+  803143:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803147:	41 f6 c1 01          	test   $0x1,%r9b
+  80314b:	74 9c                	je     8030e9 <memset+0x46>
+  80314d:	88 07                	mov    %al,(%rdi)
+  80314f:	eb 98                	jmp    8030e9 <memset+0x46>
+
+0000000000803151 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803151:	48 89 f8             	mov    %rdi,%rax
+  803154:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803157:	48 39 fe             	cmp    %rdi,%rsi
+  80315a:	73 3b                	jae    803197 <memmove+0x46>
+  80315c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803160:	48 39 d7             	cmp    %rdx,%rdi
+  803163:	73 32                	jae    803197 <memmove+0x46>
+        s += n;
+        d += n;
+  803165:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803169:	48 89 d6             	mov    %rdx,%rsi
+  80316c:	48 09 fe             	or     %rdi,%rsi
+  80316f:	48 09 ce             	or     %rcx,%rsi
+  803172:	40 f6 c6 07          	test   $0x7,%sil
+  803176:	75 12                	jne    80318a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803178:	48 83 ef 08          	sub    $0x8,%rdi
+  80317c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803180:	48 c1 e9 03          	shr    $0x3,%rcx
+  803184:	fd                   	std
+  803185:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803188:	fc                   	cld
+  803189:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80318a:	48 83 ef 01          	sub    $0x1,%rdi
+  80318e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803192:	fd                   	std
+  803193:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803195:	eb f1                	jmp    803188 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803197:	48 89 f2             	mov    %rsi,%rdx
+  80319a:	48 09 c2             	or     %rax,%rdx
+  80319d:	48 09 ca             	or     %rcx,%rdx
+  8031a0:	f6 c2 07             	test   $0x7,%dl
+  8031a3:	75 0c                	jne    8031b1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031a5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031a9:	48 89 c7             	mov    %rax,%rdi
+  8031ac:	fc                   	cld
+  8031ad:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031b0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031b1:	48 89 c7             	mov    %rax,%rdi
+  8031b4:	fc                   	cld
+  8031b5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031b7:	c3                   	ret
+
+00000000008031b8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031b8:	55                   	push   %rbp
+  8031b9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031bc:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+}
+  8031c8:	5d                   	pop    %rbp
+  8031c9:	c3                   	ret
+
+00000000008031ca <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031ca:	55                   	push   %rbp
+  8031cb:	48 89 e5             	mov    %rsp,%rbp
+  8031ce:	41 57                	push   %r15
+  8031d0:	41 56                	push   %r14
+  8031d2:	41 55                	push   %r13
+  8031d4:	41 54                	push   %r12
+  8031d6:	53                   	push   %rbx
+  8031d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8031db:	49 89 fe             	mov    %rdi,%r14
+  8031de:	49 89 f7             	mov    %rsi,%r15
+  8031e1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031e4:	48 89 f7             	mov    %rsi,%rdi
+  8031e7:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8031f6:	48 89 de             	mov    %rbx,%rsi
+  8031f9:	4c 89 f7             	mov    %r14,%rdi
+  8031fc:	48 b8 34 2f 80 00 00 	movabs $0x802f34,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+  803208:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80320b:	48 39 c3             	cmp    %rax,%rbx
+  80320e:	74 36                	je     803246 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803210:	48 89 d8             	mov    %rbx,%rax
+  803213:	4c 29 e8             	sub    %r13,%rax
+  803216:	49 39 c4             	cmp    %rax,%r12
+  803219:	73 31                	jae    80324c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80321b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803220:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803224:	4c 89 fe             	mov    %r15,%rsi
+  803227:	48 b8 b8 31 80 00 00 	movabs $0x8031b8,%rax
+  80322e:	00 00 00 
+  803231:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803233:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803237:	48 83 c4 08          	add    $0x8,%rsp
+  80323b:	5b                   	pop    %rbx
+  80323c:	41 5c                	pop    %r12
+  80323e:	41 5d                	pop    %r13
+  803240:	41 5e                	pop    %r14
+  803242:	41 5f                	pop    %r15
+  803244:	5d                   	pop    %rbp
+  803245:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803246:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80324a:	eb eb                	jmp    803237 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80324c:	48 83 eb 01          	sub    $0x1,%rbx
+  803250:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803254:	48 89 da             	mov    %rbx,%rdx
+  803257:	4c 89 fe             	mov    %r15,%rsi
+  80325a:	48 b8 b8 31 80 00 00 	movabs $0x8031b8,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803266:	49 01 de             	add    %rbx,%r14
+  803269:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80326e:	eb c3                	jmp    803233 <strlcat+0x69>
+
+0000000000803270 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803270:	48 85 d2             	test   %rdx,%rdx
+  803273:	74 2d                	je     8032a2 <memcmp+0x32>
+  803275:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80327a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80327e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803283:	44 38 c1             	cmp    %r8b,%cl
+  803286:	75 0f                	jne    803297 <memcmp+0x27>
+    while (n-- > 0) {
+  803288:	48 83 c0 01          	add    $0x1,%rax
+  80328c:	48 39 c2             	cmp    %rax,%rdx
+  80328f:	75 e9                	jne    80327a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803291:	b8 00 00 00 00       	mov    $0x0,%eax
+  803296:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803297:	0f b6 c1             	movzbl %cl,%eax
+  80329a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80329e:	44 29 c0             	sub    %r8d,%eax
+  8032a1:	c3                   	ret
+    return 0;
+  8032a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a7:	c3                   	ret
+
+00000000008032a8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032a8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032ac:	48 39 c7             	cmp    %rax,%rdi
+  8032af:	73 0f                	jae    8032c0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032b1:	40 38 37             	cmp    %sil,(%rdi)
+  8032b4:	74 0e                	je     8032c4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032b6:	48 83 c7 01          	add    $0x1,%rdi
+  8032ba:	48 39 f8             	cmp    %rdi,%rax
+  8032bd:	75 f2                	jne    8032b1 <memfind+0x9>
+  8032bf:	c3                   	ret
+  8032c0:	48 89 f8             	mov    %rdi,%rax
+  8032c3:	c3                   	ret
+  8032c4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032c7:	c3                   	ret
+
+00000000008032c8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032c8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032cb:	0f b6 37             	movzbl (%rdi),%esi
+  8032ce:	40 80 fe 20          	cmp    $0x20,%sil
+  8032d2:	74 06                	je     8032da <strtol+0x12>
+  8032d4:	40 80 fe 09          	cmp    $0x9,%sil
+  8032d8:	75 13                	jne    8032ed <strtol+0x25>
+  8032da:	48 83 c7 01          	add    $0x1,%rdi
+  8032de:	0f b6 37             	movzbl (%rdi),%esi
+  8032e1:	40 80 fe 20          	cmp    $0x20,%sil
+  8032e5:	74 f3                	je     8032da <strtol+0x12>
+  8032e7:	40 80 fe 09          	cmp    $0x9,%sil
+  8032eb:	74 ed                	je     8032da <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8032ed:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8032f0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032f3:	3c 01                	cmp    $0x1,%al
+  8032f5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8032f9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8032ff:	75 0f                	jne    803310 <strtol+0x48>
+  803301:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803304:	74 14                	je     80331a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803306:	85 d2                	test   %edx,%edx
+  803308:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80330d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803310:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803315:	4c 63 ca             	movslq %edx,%r9
+  803318:	eb 36                	jmp    803350 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80331a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80331e:	74 0f                	je     80332f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803320:	85 d2                	test   %edx,%edx
+  803322:	75 ec                	jne    803310 <strtol+0x48>
+        s++;
+  803324:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803328:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80332d:	eb e1                	jmp    803310 <strtol+0x48>
+        s += 2;
+  80332f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803333:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803338:	eb d6                	jmp    803310 <strtol+0x48>
+            dig -= '0';
+  80333a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80333d:	44 0f b6 c1          	movzbl %cl,%r8d
+  803341:	41 39 d0             	cmp    %edx,%r8d
+  803344:	7d 21                	jge    803367 <strtol+0x9f>
+        val = val * base + dig;
+  803346:	49 0f af c1          	imul   %r9,%rax
+  80334a:	0f b6 c9             	movzbl %cl,%ecx
+  80334d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803350:	48 83 c7 01          	add    $0x1,%rdi
+  803354:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803358:	80 f9 39             	cmp    $0x39,%cl
+  80335b:	76 dd                	jbe    80333a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80335d:	80 f9 7b             	cmp    $0x7b,%cl
+  803360:	77 05                	ja     803367 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803362:	83 e9 57             	sub    $0x57,%ecx
+  803365:	eb d6                	jmp    80333d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803367:	4d 85 d2             	test   %r10,%r10
+  80336a:	74 03                	je     80336f <strtol+0xa7>
+  80336c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80336f:	48 89 c2             	mov    %rax,%rdx
+  803372:	48 f7 da             	neg    %rdx
+  803375:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803379:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80337d:	c3                   	ret
+
+000000000080337e <strrev>:
+
+void
+strrev(char *str)
+{
+  80337e:	55                   	push   %rbp
+  80337f:	48 89 e5             	mov    %rsp,%rbp
+  803382:	53                   	push   %rbx
+  803383:	48 83 ec 08          	sub    $0x8,%rsp
+  803387:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80338a:	48 b8 19 2f 80 00 00 	movabs $0x802f19,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  803396:	83 e8 01             	sub    $0x1,%eax
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	7e 22                	jle    8033bf <strrev+0x41>
+  80339d:	48 98                	cltq
+  80339f:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033a4:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033a8:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033ac:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033b0:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b3:	48 83 c2 01          	add    $0x1,%rdx
+  8033b7:	48 83 e8 01          	sub    $0x1,%rax
+  8033bb:	39 c2                	cmp    %eax,%edx
+  8033bd:	7c e5                	jl     8033a4 <strrev+0x26>
+	}
+}
+  8033bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c3:	c9                   	leave
+  8033c4:	c3                   	ret
+
+00000000008033c5 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033c5:	85 d2                	test   %edx,%edx
+  8033c7:	0f 84 80 00 00 00    	je     80344d <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033cd:	55                   	push   %rbp
+  8033ce:	48 89 e5             	mov    %rsp,%rbp
+  8033d1:	53                   	push   %rbx
+  8033d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8033d6:	49 89 f2             	mov    %rsi,%r10
+  8033d9:	41 89 d3             	mov    %edx,%r11d
+  8033dc:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033df:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033e4:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8033e7:	eb 20                	jmp    803409 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8033e9:	41 89 f1             	mov    %esi,%r9d
+  8033ec:	83 c2 30             	add    $0x30,%edx
+  8033ef:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8033f2:	89 f8                	mov    %edi,%eax
+  8033f4:	99                   	cltd
+  8033f5:	f7 f9                	idiv   %ecx
+  8033f7:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8033f9:	85 c0                	test   %eax,%eax
+  8033fb:	74 2e                	je     80342b <itoa+0x66>
+  8033fd:	83 c6 01             	add    $0x1,%esi
+  803400:	49 83 c0 01          	add    $0x1,%r8
+  803404:	44 39 cb             	cmp    %r9d,%ebx
+  803407:	7e 15                	jle    80341e <itoa+0x59>
+		digit = sum % base;
+  803409:	89 f8                	mov    %edi,%eax
+  80340b:	99                   	cltd
+  80340c:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80340e:	83 fa 09             	cmp    $0x9,%edx
+  803411:	7e d6                	jle    8033e9 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803413:	41 89 f1             	mov    %esi,%r9d
+  803416:	83 c2 37             	add    $0x37,%edx
+  803419:	41 88 10             	mov    %dl,(%r8)
+  80341c:	eb d4                	jmp    8033f2 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80341e:	41 83 eb 01          	sub    $0x1,%r11d
+  803422:	45 39 cb             	cmp    %r9d,%r11d
+  803425:	75 04                	jne    80342b <itoa+0x66>
+  803427:	85 c0                	test   %eax,%eax
+  803429:	75 28                	jne    803453 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80342b:	4d 63 c9             	movslq %r9d,%r9
+  80342e:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803433:	4c 89 d7             	mov    %r10,%rdi
+  803436:	48 b8 7e 33 80 00 00 	movabs $0x80337e,%rax
+  80343d:	00 00 00 
+  803440:	ff d0                	call   *%rax
+	return 0;
+  803442:	b8 00 00 00 00       	mov    $0x0,%eax
+  803447:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80344b:	c9                   	leave
+  80344c:	c3                   	ret
+		return -1;
+  80344d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803452:	c3                   	ret
+		return -1;
+  803453:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803458:	eb ed                	jmp    803447 <itoa+0x82>
+
+000000000080345a <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80345a:	55                   	push   %rbp
+  80345b:	48 89 e5             	mov    %rsp,%rbp
+  80345e:	41 55                	push   %r13
+  803460:	41 54                	push   %r12
+  803462:	53                   	push   %rbx
+  803463:	48 83 ec 08          	sub    $0x8,%rsp
+  803467:	49 89 fc             	mov    %rdi,%r12
+  80346a:	48 89 f7             	mov    %rsi,%rdi
+  80346d:	48 89 d3             	mov    %rdx,%rbx
+  803470:	49 89 cd             	mov    %rcx,%r13
+  803473:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803476:	48 85 f6             	test   %rsi,%rsi
+  803479:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803480:	00 00 00 
+  803483:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803487:	be 00 10 00 00       	mov    $0x1000,%esi
+  80348c:	48 85 db             	test   %rbx,%rbx
+  80348f:	74 03                	je     803494 <ipc_recv_timed+0x3a>
+  803491:	48 8b 33             	mov    (%rbx),%rsi
+  803494:	48 b8 1b 05 80 00 00 	movabs $0x80051b,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034a0:	85 c0                	test   %eax,%eax
+  8034a2:	78 75                	js     803519 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034a4:	4d 85 e4             	test   %r12,%r12
+  8034a7:	74 14                	je     8034bd <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034a9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034b0:	00 00 00 
+  8034b3:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034b9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034bd:	4d 85 ed             	test   %r13,%r13
+  8034c0:	74 14                	je     8034d6 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034c2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034c9:	00 00 00 
+  8034cc:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034d2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034d6:	48 85 db             	test   %rbx,%rbx
+  8034d9:	74 23                	je     8034fe <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034db:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e2:	00 00 00 
+  8034e5:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8034eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f0:	85 c9                	test   %ecx,%ecx
+  8034f2:	74 07                	je     8034fb <ipc_recv_timed+0xa1>
+  8034f4:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8034fb:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8034fe:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803505:	00 00 00 
+  803508:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80350e:	48 83 c4 08          	add    $0x8,%rsp
+  803512:	5b                   	pop    %rbx
+  803513:	41 5c                	pop    %r12
+  803515:	41 5d                	pop    %r13
+  803517:	5d                   	pop    %rbp
+  803518:	c3                   	ret
+        if (from_env_store != NULL) {
+  803519:	4d 85 e4             	test   %r12,%r12
+  80351c:	74 08                	je     803526 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80351e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803525:	00 
+        if (perm_store != NULL) {
+  803526:	4d 85 ed             	test   %r13,%r13
+  803529:	74 08                	je     803533 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80352b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803532:	00 
+        if (size != NULL) {
+  803533:	48 85 db             	test   %rbx,%rbx
+  803536:	74 d6                	je     80350e <ipc_recv_timed+0xb4>
+            *size = 0;
+  803538:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80353f:	eb cd                	jmp    80350e <ipc_recv_timed+0xb4>
+
+0000000000803541 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803541:	55                   	push   %rbp
+  803542:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803545:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80354b:	48 b8 5a 34 80 00 00 	movabs $0x80345a,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+}
+  803557:	5d                   	pop    %rbp
+  803558:	c3                   	ret
+
+0000000000803559 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803559:	55                   	push   %rbp
+  80355a:	48 89 e5             	mov    %rsp,%rbp
+  80355d:	41 57                	push   %r15
+  80355f:	41 56                	push   %r14
+  803561:	41 55                	push   %r13
+  803563:	41 54                	push   %r12
+  803565:	53                   	push   %rbx
+  803566:	48 83 ec 18          	sub    $0x18,%rsp
+  80356a:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80356d:	48 89 d3             	mov    %rdx,%rbx
+  803570:	49 89 cc             	mov    %rcx,%r12
+  803573:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803576:	48 85 d2             	test   %rdx,%rdx
+  803579:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803580:	00 00 00 
+  803583:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803587:	89 f0                	mov    %esi,%eax
+  803589:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80358d:	48 89 da             	mov    %rbx,%rdx
+  803590:	48 89 c6             	mov    %rax,%rsi
+  803593:	48 b8 ef 04 80 00 00 	movabs $0x8004ef,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+    while (res < 0) {
+  80359f:	85 c0                	test   %eax,%eax
+  8035a1:	79 65                	jns    803608 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035a3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035a6:	75 33                	jne    8035db <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035a8:	49 bf f2 01 80 00 00 	movabs $0x8001f2,%r15
+  8035af:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035b2:	49 be ef 04 80 00 00 	movabs $0x8004ef,%r14
+  8035b9:	00 00 00 
+        sys_yield();
+  8035bc:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035bf:	45 89 e8             	mov    %r13d,%r8d
+  8035c2:	4c 89 e1             	mov    %r12,%rcx
+  8035c5:	48 89 da             	mov    %rbx,%rdx
+  8035c8:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035cc:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035cf:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035d2:	85 c0                	test   %eax,%eax
+  8035d4:	79 32                	jns    803608 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035d6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035d9:	74 e1                	je     8035bc <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035db:	89 c1                	mov    %eax,%ecx
+  8035dd:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  8035e4:	00 00 00 
+  8035e7:	be 52 00 00 00       	mov    $0x52,%esi
+  8035ec:	48 bf 3b 3d 80 00 00 	movabs $0x803d3b,%rdi
+  8035f3:	00 00 00 
+  8035f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035fb:	49 b8 e2 24 80 00 00 	movabs $0x8024e2,%r8
+  803602:	00 00 00 
+  803605:	41 ff d0             	call   *%r8
+    }
+}
+  803608:	48 83 c4 18          	add    $0x18,%rsp
+  80360c:	5b                   	pop    %rbx
+  80360d:	41 5c                	pop    %r12
+  80360f:	41 5d                	pop    %r13
+  803611:	41 5e                	pop    %r14
+  803613:	41 5f                	pop    %r15
+  803615:	5d                   	pop    %rbp
+  803616:	c3                   	ret
+
+0000000000803617 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803617:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80361c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803623:	00 00 00 
+  803626:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80362a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80362e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803632:	48 01 ca             	add    %rcx,%rdx
+  803635:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80363b:	39 fa                	cmp    %edi,%edx
+  80363d:	74 12                	je     803651 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80363f:	48 83 c0 01          	add    $0x1,%rax
+  803643:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803649:	75 db                	jne    803626 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80364b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803650:	c3                   	ret
+            return envs[i].env_id;
+  803651:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803655:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803659:	48 c1 e2 04          	shl    $0x4,%rdx
+  80365d:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803664:	00 00 00 
+  803667:	48 01 d0             	add    %rdx,%rax
+  80366a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803670:	c3                   	ret
+  803671:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803678 <__rodata_start>:
+  803678:	3c 75                	cmp    $0x75,%al
+  80367a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80367b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80367f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803680:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803684:	1f                   	(bad)
+  803685:	44 00 00             	add    %r8b,(%rax)
+  803688:	73 79                	jae    803703 <__rodata_start+0x8b>
+  80368a:	73 63                	jae    8036ef <__rodata_start+0x77>
+  80368c:	61                   	(bad)
+  80368d:	6c                   	insb   (%dx),%es:(%rdi)
+  80368e:	6c                   	insb   (%dx),%es:(%rdi)
+  80368f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b0f <__bss_end+0x72201b0f>
+  803695:	65 74 75             	gs je  80370d <__rodata_start+0x95>
+  803698:	72 6e                	jb     803708 <__rodata_start+0x90>
+  80369a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b1c <__bss_end+0x28201b1c>
+  8036a1:	28 
+  8036a2:	3e 20 30             	ds and %dh,(%rax)
+  8036a5:	29 00                	sub    %eax,(%rax)
+  8036a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036af:	61                   	(bad)
+  8036b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b2:	2e 63 00             	cs movsxd (%rax),%eax
+  8036b5:	0f 1f 00             	nopl   (%rax)
+  8036b8:	5b                   	pop    %rbx
+  8036b9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036be:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036c1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036ca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036d1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80413c <devpipe+0x7c>
+  8036d8:	5b                   	pop    %rbx
+  8036d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036de:	20 72 65             	and    %dh,0x65(%rdx)
+  8036e1:	61                   	(bad)
+  8036e2:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036e4:	61                   	(bad)
+  8036e5:	70 20                	jo     803707 <__rodata_start+0x8f>
+  8036e7:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8036ec:	20 62 61             	and    %ah,0x61(%rdx)
+  8036ef:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8036f3:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8036f7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8036fa:	30 38                	xor    %bh,(%rax)
+  8036fc:	78 5d                	js     80375b <__rodata_start+0xe3>
+  8036fe:	20 66 74             	and    %ah,0x74(%rsi)
+  803701:	72 75                	jb     803778 <devtab+0x18>
+  803703:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803704:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803707:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad5772 <__bss_end+0x2d2cd772>
+  80370e:	20 62 61             	and    %ah,0x61(%rdx)
+  803711:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803715:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803719:	5b                   	pop    %rbx
+  80371a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80371f:	20 72 65             	and    %dh,0x65(%rdx)
+  803722:	61                   	(bad)
+  803723:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad578e <__bss_end+0x2d2cd78e>
+  80372a:	20 62 61             	and    %ah,0x61(%rdx)
+  80372d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803731:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803735:	5b                   	pop    %rbx
+  803736:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80373b:	20 77 72             	and    %dh,0x72(%rdi)
+  80373e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  803745:	2d 
+  803746:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80374b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80374e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803759:	00 00 00 
+  80375c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803770:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8037e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8037f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8038e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8038f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803990:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039a0:	1f 28 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     .(......`.......
+  8039b0:	50 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     P.......`.......
+  8039c0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  8039d0:	60 2e 80 00 00 00 00 00 3e 28 80 00 00 00 00 00     `.......>(......
+  8039e0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  8039f0:	32 28 80 00 00 00 00 00 ac 28 80 00 00 00 00 00     2(.......(......
+  803a00:	60 2e 80 00 00 00 00 00 32 28 80 00 00 00 00 00     `.......2(......
+  803a10:	78 28 80 00 00 00 00 00 78 28 80 00 00 00 00 00     x(......x(......
+  803a20:	78 28 80 00 00 00 00 00 78 28 80 00 00 00 00 00     x(......x(......
+  803a30:	78 28 80 00 00 00 00 00 78 28 80 00 00 00 00 00     x(......x(......
+  803a40:	78 28 80 00 00 00 00 00 78 28 80 00 00 00 00 00     x(......x(......
+  803a50:	78 28 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     x(......`.......
+  803a60:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803a70:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803a80:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803a90:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803aa0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803ab0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803ac0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803ad0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803ae0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803af0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b00:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b10:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b20:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b30:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b40:	60 2e 80 00 00 00 00 00 83 2d 80 00 00 00 00 00     `........-......
+  803b50:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b60:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b70:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b80:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803b90:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803ba0:	cf 28 80 00 00 00 00 00 9e 2a 80 00 00 00 00 00     .(.......*......
+  803bb0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803bc0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803bd0:	fe 28 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     .(......`.......
+  803be0:	60 2e 80 00 00 00 00 00 c4 28 80 00 00 00 00 00     `........(......
+  803bf0:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803c00:	46 2c 80 00 00 00 00 00 10 2d 80 00 00 00 00 00     F,.......-......
+  803c10:	60 2e 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     `.......`.......
+  803c20:	95 29 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     .)......`.......
+  803c30:	72 2b 80 00 00 00 00 00 60 2e 80 00 00 00 00 00     r+......`.......
+  803c40:	60 2e 80 00 00 00 00 00 83 2d 80 00 00 00 00 00     `........-......
+  803c50:	60 2e 80 00 00 00 00 00 28 28 80 00 00 00 00 00     `.......((......
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	35 38 80 00 00 00 00 00 47 38 80 00 00 00 00 00     58......G8......
+  803c78:	57 38 80 00 00 00 00 00 69 38 80 00 00 00 00 00     W8......i8......
+  803c88:	77 38 80 00 00 00 00 00 8b 38 80 00 00 00 00 00     w8.......8......
+  803c98:	a0 38 80 00 00 00 00 00 b3 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	c5 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	e9 38 80 00 00 00 00 00 fc 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	13 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803cd8:	41 39 80 00 00 00 00 00 59 39 80 00 00 00 00 00     A9......Y9......
+  803ce8:	66 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     f9.......=......
+  803cf8:	7a 39 80 00 00 00 00 00 92 39 80 00 00 00 00 00     z9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d28:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d38:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,6624 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	41 89 fd             	mov    %edi,%r13d
+  80004f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800052:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800059:	00 00 00 
+  80005c:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800063:	00 00 00 
+  800066:	48 39 c2             	cmp    %rax,%rdx
+  800069:	73 17                	jae    800082 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80006b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	49 89 c4             	mov    %rax,%r12
+  800071:	48 83 c3 08          	add    $0x8,%rbx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff 53 f8             	call   *-0x8(%rbx)
+  80007d:	4c 39 e3             	cmp    %r12,%rbx
+  800080:	72 ef                	jb     800071 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800082:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+  80008e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800093:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800097:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80009b:	48 c1 e0 04          	shl    $0x4,%rax
+  80009f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a6:	00 00 00 
+  8000a9:	48 01 d0             	add    %rdx,%rax
+  8000ac:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b6:	45 85 ed             	test   %r13d,%r13d
+  8000b9:	7e 0d                	jle    8000c8 <libmain+0x87>
+  8000bb:	49 8b 06             	mov    (%r14),%rax
+  8000be:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c8:	4c 89 f6             	mov    %r14,%rsi
+  8000cb:	44 89 ef             	mov    %r13d,%edi
+  8000ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000da:	48 b8 ef 00 80 00 00 	movabs $0x8000ef,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+#endif
+}
+  8000e6:	5b                   	pop    %rbx
+  8000e7:	41 5c                	pop    %r12
+  8000e9:	41 5d                	pop    %r13
+  8000eb:	41 5e                	pop    %r14
+  8000ed:	5d                   	pop    %rbp
+  8000ee:	c3                   	ret
+
+00000000008000ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ef:	55                   	push   %rbp
+  8000f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f3:	48 b8 91 08 80 00 00 	movabs $0x800891,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800104:	48 b8 70 01 80 00 00 	movabs $0x800170,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+}
+  800110:	5d                   	pop    %rbp
+  800111:	c3                   	ret
+
+0000000000800112 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	53                   	push   %rbx
+  800117:	48 89 fa             	mov    %rdi,%rdx
+  80011a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800127:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012c:	be 00 00 00 00       	mov    $0x0,%esi
+  800131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800137:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+000000000080013f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013f:	55                   	push   %rbp
+  800140:	48 89 e5             	mov    %rsp,%rbp
+  800143:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800144:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800158:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015d:	be 00 00 00 00       	mov    $0x0,%esi
+  800162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800168:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+0000000000800170 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800170:	55                   	push   %rbp
+  800171:	48 89 e5             	mov    %rsp,%rbp
+  800174:	53                   	push   %rbx
+  800175:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800179:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800181:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800190:	be 00 00 00 00       	mov    $0x0,%esi
+  800195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80019d:	48 85 c0             	test   %rax,%rax
+  8001a0:	7f 06                	jg     8001a8 <sys_env_destroy+0x38>
+}
+  8001a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a6:	c9                   	leave
+  8001a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a8:	49 89 c0             	mov    %rax,%r8
+  8001ab:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b0:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8001b7:	00 00 00 
+  8001ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8001bf:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8001c6:	00 00 00 
+  8001c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ce:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  8001d5:	00 00 00 
+  8001d8:	41 ff d1             	call   *%r9
+
+00000000008001db <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001db:	55                   	push   %rbp
+  8001dc:	48 89 e5             	mov    %rsp,%rbp
+  8001df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800204:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800206:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+000000000080020c <sys_yield>:
+
+void
+sys_yield(void) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800211:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800225:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022a:	be 00 00 00 00       	mov    $0x0,%esi
+  80022f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800235:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+000000000080023d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80023d:	55                   	push   %rbp
+  80023e:	48 89 e5             	mov    %rsp,%rbp
+  800241:	53                   	push   %rbx
+  800242:	48 89 fa             	mov    %rdi,%rdx
+  800245:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800248:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800254:	00 00 00 
+  800257:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025c:	be 00 00 00 00       	mov    $0x0,%esi
+  800261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800267:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+000000000080026f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026f:	55                   	push   %rbp
+  800270:	48 89 e5             	mov    %rsp,%rbp
+  800273:	53                   	push   %rbx
+  800274:	49 89 f8             	mov    %rdi,%r8
+  800277:	48 89 d3             	mov    %rdx,%rbx
+  80027a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80027d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800282:	4c 89 c2             	mov    %r8,%rdx
+  800285:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800288:	be 00 00 00 00       	mov    $0x0,%esi
+  80028d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800293:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	53                   	push   %rbx
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	89 f8                	mov    %edi,%eax
+  8002a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a9:	48 63 f9             	movslq %ecx,%rdi
+  8002ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002af:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c4:	48 85 c0             	test   %rax,%rax
+  8002c7:	7f 06                	jg     8002cf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002cf:	49 89 c0             	mov    %rax,%r8
+  8002d2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d7:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8002de:	00 00 00 
+  8002e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e6:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8002ed:	00 00 00 
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f5:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  8002fc:	00 00 00 
+  8002ff:	41 ff d1             	call   *%r9
+
+0000000000800302 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	53                   	push   %rbx
+  800307:	48 83 ec 08          	sub    $0x8,%rsp
+  80030b:	89 f8                	mov    %edi,%eax
+  80030d:	49 89 f2             	mov    %rsi,%r10
+  800310:	48 89 cf             	mov    %rcx,%rdi
+  800313:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800316:	48 63 da             	movslq %edx,%rbx
+  800319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800321:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800324:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800327:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800329:	48 85 c0             	test   %rax,%rax
+  80032c:	7f 06                	jg     800334 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80032e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800334:	49 89 c0             	mov    %rax,%r8
+  800337:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033c:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800343:	00 00 00 
+  800346:	be 26 00 00 00       	mov    $0x26,%esi
+  80034b:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800352:	00 00 00 
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  800361:	00 00 00 
+  800364:	41 ff d1             	call   *%r9
+
+0000000000800367 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800367:	55                   	push   %rbp
+  800368:	48 89 e5             	mov    %rsp,%rbp
+  80036b:	53                   	push   %rbx
+  80036c:	48 83 ec 08          	sub    $0x8,%rsp
+  800370:	48 89 f1             	mov    %rsi,%rcx
+  800373:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800376:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800379:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80037e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800383:	be 00 00 00 00       	mov    $0x0,%esi
+  800388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800390:	48 85 c0             	test   %rax,%rax
+  800393:	7f 06                	jg     80039b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800395:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800399:	c9                   	leave
+  80039a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039b:	49 89 c0             	mov    %rax,%r8
+  80039e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a3:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8003aa:	00 00 00 
+  8003ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b2:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8003b9:	00 00 00 
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  8003c8:	00 00 00 
+  8003cb:	41 ff d1             	call   *%r9
+
+00000000008003ce <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003ce:	55                   	push   %rbp
+  8003cf:	48 89 e5             	mov    %rsp,%rbp
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003d7:	48 63 ce             	movslq %esi,%rcx
+  8003da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003dd:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f9:	48 85 c0             	test   %rax,%rax
+  8003fc:	7f 06                	jg     800404 <sys_env_set_status+0x36>
+}
+  8003fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800404:	49 89 c0             	mov    %rax,%r8
+  800407:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80040c:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800413:	00 00 00 
+  800416:	be 26 00 00 00       	mov    $0x26,%esi
+  80041b:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800422:	00 00 00 
+  800425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042a:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  800431:	00 00 00 
+  800434:	41 ff d1             	call   *%r9
+
+0000000000800437 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800437:	55                   	push   %rbp
+  800438:	48 89 e5             	mov    %rsp,%rbp
+  80043b:	53                   	push   %rbx
+  80043c:	48 83 ec 08          	sub    $0x8,%rsp
+  800440:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800443:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800446:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80044b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800450:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800455:	be 00 00 00 00       	mov    $0x0,%esi
+  80045a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800460:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800462:	48 85 c0             	test   %rax,%rax
+  800465:	7f 06                	jg     80046d <sys_env_set_trapframe+0x36>
+}
+  800467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046b:	c9                   	leave
+  80046c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80046d:	49 89 c0             	mov    %rax,%r8
+  800470:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800475:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  80047c:	00 00 00 
+  80047f:	be 26 00 00 00       	mov    $0x26,%esi
+  800484:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  80048b:	00 00 00 
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  80049a:	00 00 00 
+  80049d:	41 ff d1             	call   *%r9
+
+00000000008004a0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004af:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004be:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004cb:	48 85 c0             	test   %rax,%rax
+  8004ce:	7f 06                	jg     8004d6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8004d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d4:	c9                   	leave
+  8004d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d6:	49 89 c0             	mov    %rax,%r8
+  8004d9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004de:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8004e5:	00 00 00 
+  8004e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ed:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8004f4:	00 00 00 
+  8004f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fc:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  800503:	00 00 00 
+  800506:	41 ff d1             	call   *%r9
+
+0000000000800509 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800509:	55                   	push   %rbp
+  80050a:	48 89 e5             	mov    %rsp,%rbp
+  80050d:	53                   	push   %rbx
+  80050e:	89 f8                	mov    %edi,%eax
+  800510:	49 89 f1             	mov    %rsi,%r9
+  800513:	48 89 d3             	mov    %rdx,%rbx
+  800516:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800519:	49 63 f0             	movslq %r8d,%rsi
+  80051c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800524:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052d:	cd 30                	int    $0x30
+}
+  80052f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800533:	c9                   	leave
+  800534:	c3                   	ret
+
+0000000000800535 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	53                   	push   %rbx
+  80053a:	48 83 ec 08          	sub    $0x8,%rsp
+  80053e:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800541:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800544:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800549:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80054c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800551:	be 00 00 00 00       	mov    $0x0,%esi
+  800556:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80055c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80055e:	48 85 c0             	test   %rax,%rax
+  800561:	7f 06                	jg     800569 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800567:	c9                   	leave
+  800568:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800569:	49 89 c0             	mov    %rax,%r8
+  80056c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800571:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800578:	00 00 00 
+  80057b:	be 26 00 00 00       	mov    $0x26,%esi
+  800580:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800587:	00 00 00 
+  80058a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058f:	49 b9 fc 24 80 00 00 	movabs $0x8024fc,%r9
+  800596:	00 00 00 
+  800599:	41 ff d1             	call   *%r9
+
+000000000080059c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80059c:	55                   	push   %rbp
+  80059d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a5:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  8005ac:	00 00 00 
+  8005af:	ff d0                	call   *%rax
+}
+  8005b1:	5d                   	pop    %rbp
+  8005b2:	c3                   	ret
+
+00000000008005b3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005b3:	55                   	push   %rbp
+  8005b4:	48 89 e5             	mov    %rsp,%rbp
+  8005b7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005dc:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e2:	c9                   	leave
+  8005e3:	c3                   	ret
+
+00000000008005e4 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005e4:	55                   	push   %rbp
+  8005e5:	48 89 e5             	mov    %rsp,%rbp
+  8005e8:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005e9:	48 63 ce             	movslq %esi,%rcx
+  8005ec:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800604:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060a:	cd 30                	int    $0x30
+}
+  80060c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800610:	c9                   	leave
+  800611:	c3                   	ret
+
+0000000000800612 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800612:	55                   	push   %rbp
+  800613:	48 89 e5             	mov    %rsp,%rbp
+  800616:	53                   	push   %rbx
+  800617:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80061a:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80061e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800628:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062d:	be 00 00 00 00       	mov    $0x0,%esi
+  800632:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800638:	cd 30                	int    $0x30
+}
+  80063a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80063e:	c9                   	leave
+  80063f:	c3                   	ret
+
+0000000000800640 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800640:	55                   	push   %rbp
+  800641:	48 89 e5             	mov    %rsp,%rbp
+  800644:	53                   	push   %rbx
+  800645:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800648:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80064b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800650:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800653:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800658:	be 00 00 00 00       	mov    $0x0,%esi
+  80065d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800663:	cd 30                	int    $0x30
+}
+  800665:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800669:	c9                   	leave
+  80066a:	c3                   	ret
+
+000000000080066b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80066b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800672:	ff ff ff 
+  800675:	48 01 f8             	add    %rdi,%rax
+  800678:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80067c:	c3                   	ret
+
+000000000080067d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80067d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800684:	ff ff ff 
+  800687:	48 01 f8             	add    %rdi,%rax
+  80068a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80068e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800694:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800698:	c3                   	ret
+
+0000000000800699 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800699:	55                   	push   %rbp
+  80069a:	48 89 e5             	mov    %rsp,%rbp
+  80069d:	41 57                	push   %r15
+  80069f:	41 56                	push   %r14
+  8006a1:	41 55                	push   %r13
+  8006a3:	41 54                	push   %r12
+  8006a5:	53                   	push   %rbx
+  8006a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8006aa:	49 89 ff             	mov    %rdi,%r15
+  8006ad:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b2:	49 bd b8 21 80 00 00 	movabs $0x8021b8,%r13
+  8006b9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006bc:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006c2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c5:	48 89 df             	mov    %rbx,%rdi
+  8006c8:	41 ff d5             	call   *%r13
+  8006cb:	83 e0 04             	and    $0x4,%eax
+  8006ce:	74 17                	je     8006e7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006d0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006d7:	4c 39 f3             	cmp    %r14,%rbx
+  8006da:	75 e6                	jne    8006c2 <fd_alloc+0x29>
+  8006dc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006e2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006e7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006ea:	48 83 c4 08          	add    $0x8,%rsp
+  8006ee:	5b                   	pop    %rbx
+  8006ef:	41 5c                	pop    %r12
+  8006f1:	41 5d                	pop    %r13
+  8006f3:	41 5e                	pop    %r14
+  8006f5:	41 5f                	pop    %r15
+  8006f7:	5d                   	pop    %rbp
+  8006f8:	c3                   	ret
+
+00000000008006f9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006f9:	83 ff 1f             	cmp    $0x1f,%edi
+  8006fc:	77 39                	ja     800737 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	41 54                	push   %r12
+  800704:	53                   	push   %rbx
+  800705:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800708:	48 63 df             	movslq %edi,%rbx
+  80070b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800712:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800716:	48 89 df             	mov    %rbx,%rdi
+  800719:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  800720:	00 00 00 
+  800723:	ff d0                	call   *%rax
+  800725:	a8 04                	test   $0x4,%al
+  800727:	74 14                	je     80073d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800729:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80072d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800732:	5b                   	pop    %rbx
+  800733:	41 5c                	pop    %r12
+  800735:	5d                   	pop    %rbp
+  800736:	c3                   	ret
+        return -E_INVAL;
+  800737:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80073c:	c3                   	ret
+        return -E_INVAL;
+  80073d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800742:	eb ee                	jmp    800732 <fd_lookup+0x39>
+
+0000000000800744 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800744:	55                   	push   %rbp
+  800745:	48 89 e5             	mov    %rsp,%rbp
+  800748:	41 54                	push   %r12
+  80074a:	53                   	push   %rbx
+  80074b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80074e:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  800755:	00 00 00 
+  800758:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80075f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800762:	39 3b                	cmp    %edi,(%rbx)
+  800764:	74 47                	je     8007ad <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800766:	48 83 c0 08          	add    $0x8,%rax
+  80076a:	48 8b 18             	mov    (%rax),%rbx
+  80076d:	48 85 db             	test   %rbx,%rbx
+  800770:	75 f0                	jne    800762 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800772:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800779:	00 00 00 
+  80077c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800782:	89 fa                	mov    %edi,%edx
+  800784:	48 bf d0 36 80 00 00 	movabs $0x8036d0,%rdi
+  80078b:	00 00 00 
+  80078e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800793:	48 b9 4c 26 80 00 00 	movabs $0x80264c,%rcx
+  80079a:	00 00 00 
+  80079d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80079f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007a4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007a8:	5b                   	pop    %rbx
+  8007a9:	41 5c                	pop    %r12
+  8007ab:	5d                   	pop    %rbp
+  8007ac:	c3                   	ret
+            return 0;
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	eb f0                	jmp    8007a4 <dev_lookup+0x60>
+
+00000000008007b4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007b4:	55                   	push   %rbp
+  8007b5:	48 89 e5             	mov    %rsp,%rbp
+  8007b8:	41 55                	push   %r13
+  8007ba:	41 54                	push   %r12
+  8007bc:	53                   	push   %rbx
+  8007bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8007c1:	48 89 fb             	mov    %rdi,%rbx
+  8007c4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007c7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007ce:	ff ff ff 
+  8007d1:	48 01 df             	add    %rbx,%rdi
+  8007d4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007d8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007dc:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8007e3:	00 00 00 
+  8007e6:	ff d0                	call   *%rax
+  8007e8:	41 89 c5             	mov    %eax,%r13d
+  8007eb:	85 c0                	test   %eax,%eax
+  8007ed:	78 06                	js     8007f5 <fd_close+0x41>
+  8007ef:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007f3:	74 1a                	je     80080f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007f5:	45 84 e4             	test   %r12b,%r12b
+  8007f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800801:	44 89 e8             	mov    %r13d,%eax
+  800804:	48 83 c4 18          	add    $0x18,%rsp
+  800808:	5b                   	pop    %rbx
+  800809:	41 5c                	pop    %r12
+  80080b:	41 5d                	pop    %r13
+  80080d:	5d                   	pop    %rbp
+  80080e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80080f:	8b 3b                	mov    (%rbx),%edi
+  800811:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800815:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  80081c:	00 00 00 
+  80081f:	ff d0                	call   *%rax
+  800821:	41 89 c5             	mov    %eax,%r13d
+  800824:	85 c0                	test   %eax,%eax
+  800826:	78 1b                	js     800843 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800828:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80082c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800830:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800836:	48 85 c0             	test   %rax,%rax
+  800839:	74 08                	je     800843 <fd_close+0x8f>
+  80083b:	48 89 df             	mov    %rbx,%rdi
+  80083e:	ff d0                	call   *%rax
+  800840:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800843:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800848:	48 89 de             	mov    %rbx,%rsi
+  80084b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800850:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  800857:	00 00 00 
+  80085a:	ff d0                	call   *%rax
+    return res;
+  80085c:	eb a3                	jmp    800801 <fd_close+0x4d>
+
+000000000080085e <close>:
+
+int
+close(int fdnum) {
+  80085e:	55                   	push   %rbp
+  80085f:	48 89 e5             	mov    %rsp,%rbp
+  800862:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800866:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80086a:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800871:	00 00 00 
+  800874:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800876:	85 c0                	test   %eax,%eax
+  800878:	78 15                	js     80088f <close+0x31>
+
+    return fd_close(fd, 1);
+  80087a:	be 01 00 00 00       	mov    $0x1,%esi
+  80087f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800883:	48 b8 b4 07 80 00 00 	movabs $0x8007b4,%rax
+  80088a:	00 00 00 
+  80088d:	ff d0                	call   *%rax
+}
+  80088f:	c9                   	leave
+  800890:	c3                   	ret
+
+0000000000800891 <close_all>:
+
+void
+close_all(void) {
+  800891:	55                   	push   %rbp
+  800892:	48 89 e5             	mov    %rsp,%rbp
+  800895:	41 54                	push   %r12
+  800897:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800898:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80089d:	49 bc 5e 08 80 00 00 	movabs $0x80085e,%r12
+  8008a4:	00 00 00 
+  8008a7:	89 df                	mov    %ebx,%edi
+  8008a9:	41 ff d4             	call   *%r12
+  8008ac:	83 c3 01             	add    $0x1,%ebx
+  8008af:	83 fb 20             	cmp    $0x20,%ebx
+  8008b2:	75 f3                	jne    8008a7 <close_all+0x16>
+}
+  8008b4:	5b                   	pop    %rbx
+  8008b5:	41 5c                	pop    %r12
+  8008b7:	5d                   	pop    %rbp
+  8008b8:	c3                   	ret
+
+00000000008008b9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008b9:	55                   	push   %rbp
+  8008ba:	48 89 e5             	mov    %rsp,%rbp
+  8008bd:	41 57                	push   %r15
+  8008bf:	41 56                	push   %r14
+  8008c1:	41 55                	push   %r13
+  8008c3:	41 54                	push   %r12
+  8008c5:	53                   	push   %rbx
+  8008c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8008ca:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008cd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008d1:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8008d8:	00 00 00 
+  8008db:	ff d0                	call   *%rax
+  8008dd:	89 c3                	mov    %eax,%ebx
+  8008df:	85 c0                	test   %eax,%eax
+  8008e1:	0f 88 b8 00 00 00    	js     80099f <dup+0xe6>
+    close(newfdnum);
+  8008e7:	44 89 e7             	mov    %r12d,%edi
+  8008ea:	48 b8 5e 08 80 00 00 	movabs $0x80085e,%rax
+  8008f1:	00 00 00 
+  8008f4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008f6:	4d 63 ec             	movslq %r12d,%r13
+  8008f9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800900:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800904:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800908:	4c 89 ff             	mov    %r15,%rdi
+  80090b:	49 be 7d 06 80 00 00 	movabs $0x80067d,%r14
+  800912:	00 00 00 
+  800915:	41 ff d6             	call   *%r14
+  800918:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80091b:	4c 89 ef             	mov    %r13,%rdi
+  80091e:	41 ff d6             	call   *%r14
+  800921:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800924:	48 89 df             	mov    %rbx,%rdi
+  800927:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  80092e:	00 00 00 
+  800931:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800933:	a8 04                	test   $0x4,%al
+  800935:	74 2b                	je     800962 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800937:	41 89 c1             	mov    %eax,%r9d
+  80093a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800940:	4c 89 f1             	mov    %r14,%rcx
+  800943:	ba 00 00 00 00       	mov    $0x0,%edx
+  800948:	48 89 de             	mov    %rbx,%rsi
+  80094b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800950:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  800957:	00 00 00 
+  80095a:	ff d0                	call   *%rax
+  80095c:	89 c3                	mov    %eax,%ebx
+  80095e:	85 c0                	test   %eax,%eax
+  800960:	78 4e                	js     8009b0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800962:	4c 89 ff             	mov    %r15,%rdi
+  800965:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  80096c:	00 00 00 
+  80096f:	ff d0                	call   *%rax
+  800971:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800974:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80097a:	4c 89 e9             	mov    %r13,%rcx
+  80097d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800982:	4c 89 fe             	mov    %r15,%rsi
+  800985:	bf 00 00 00 00       	mov    $0x0,%edi
+  80098a:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  800991:	00 00 00 
+  800994:	ff d0                	call   *%rax
+  800996:	89 c3                	mov    %eax,%ebx
+  800998:	85 c0                	test   %eax,%eax
+  80099a:	78 14                	js     8009b0 <dup+0xf7>
+
+    return newfdnum;
+  80099c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80099f:	89 d8                	mov    %ebx,%eax
+  8009a1:	48 83 c4 18          	add    $0x18,%rsp
+  8009a5:	5b                   	pop    %rbx
+  8009a6:	41 5c                	pop    %r12
+  8009a8:	41 5d                	pop    %r13
+  8009aa:	41 5e                	pop    %r14
+  8009ac:	41 5f                	pop    %r15
+  8009ae:	5d                   	pop    %rbp
+  8009af:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b5:	4c 89 ee             	mov    %r13,%rsi
+  8009b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009bd:	49 bc 67 03 80 00 00 	movabs $0x800367,%r12
+  8009c4:	00 00 00 
+  8009c7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009cf:	4c 89 f6             	mov    %r14,%rsi
+  8009d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d7:	41 ff d4             	call   *%r12
+    return res;
+  8009da:	eb c3                	jmp    80099f <dup+0xe6>
+
+00000000008009dc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009dc:	55                   	push   %rbp
+  8009dd:	48 89 e5             	mov    %rsp,%rbp
+  8009e0:	41 56                	push   %r14
+  8009e2:	41 55                	push   %r13
+  8009e4:	41 54                	push   %r12
+  8009e6:	53                   	push   %rbx
+  8009e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8009eb:	89 fb                	mov    %edi,%ebx
+  8009ed:	49 89 f4             	mov    %rsi,%r12
+  8009f0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009f3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009f7:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8009fe:	00 00 00 
+  800a01:	ff d0                	call   *%rax
+  800a03:	85 c0                	test   %eax,%eax
+  800a05:	78 4c                	js     800a53 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a07:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a0b:	41 8b 3e             	mov    (%r14),%edi
+  800a0e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a12:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800a19:	00 00 00 
+  800a1c:	ff d0                	call   *%rax
+  800a1e:	85 c0                	test   %eax,%eax
+  800a20:	78 35                	js     800a57 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a22:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a26:	83 e0 03             	and    $0x3,%eax
+  800a29:	83 f8 01             	cmp    $0x1,%eax
+  800a2c:	74 2d                	je     800a5b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a36:	48 85 c0             	test   %rax,%rax
+  800a39:	74 56                	je     800a91 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a3b:	4c 89 ea             	mov    %r13,%rdx
+  800a3e:	4c 89 e6             	mov    %r12,%rsi
+  800a41:	4c 89 f7             	mov    %r14,%rdi
+  800a44:	ff d0                	call   *%rax
+}
+  800a46:	48 83 c4 10          	add    $0x10,%rsp
+  800a4a:	5b                   	pop    %rbx
+  800a4b:	41 5c                	pop    %r12
+  800a4d:	41 5d                	pop    %r13
+  800a4f:	41 5e                	pop    %r14
+  800a51:	5d                   	pop    %rbp
+  800a52:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a53:	48 98                	cltq
+  800a55:	eb ef                	jmp    800a46 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a57:	48 98                	cltq
+  800a59:	eb eb                	jmp    800a46 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a5b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a62:	00 00 00 
+  800a65:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a6b:	89 da                	mov    %ebx,%edx
+  800a6d:	48 bf 31 37 80 00 00 	movabs $0x803731,%rdi
+  800a74:	00 00 00 
+  800a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7c:	48 b9 4c 26 80 00 00 	movabs $0x80264c,%rcx
+  800a83:	00 00 00 
+  800a86:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a88:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a8f:	eb b5                	jmp    800a46 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a91:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a98:	eb ac                	jmp    800a46 <read+0x6a>
+
+0000000000800a9a <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a9a:	55                   	push   %rbp
+  800a9b:	48 89 e5             	mov    %rsp,%rbp
+  800a9e:	41 56                	push   %r14
+  800aa0:	41 55                	push   %r13
+  800aa2:	41 54                	push   %r12
+  800aa4:	53                   	push   %rbx
+  800aa5:	48 83 ec 10          	sub    $0x10,%rsp
+  800aa9:	89 fb                	mov    %edi,%ebx
+  800aab:	49 89 f4             	mov    %rsi,%r12
+  800aae:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ab1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ab5:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800abc:	00 00 00 
+  800abf:	ff d0                	call   *%rax
+  800ac1:	85 c0                	test   %eax,%eax
+  800ac3:	78 41                	js     800b06 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ac5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ac9:	41 8b 3e             	mov    (%r14),%edi
+  800acc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ad0:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800ad7:	00 00 00 
+  800ada:	ff d0                	call   *%rax
+  800adc:	85 c0                	test   %eax,%eax
+  800ade:	78 35                	js     800b15 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ae0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ae4:	83 e0 03             	and    $0x3,%eax
+  800ae7:	83 f8 01             	cmp    $0x1,%eax
+  800aea:	74 2d                	je     800b19 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800aec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800af0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800af4:	48 85 c0             	test   %rax,%rax
+  800af7:	74 56                	je     800b4f <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800af9:	4c 89 ea             	mov    %r13,%rdx
+  800afc:	4c 89 e6             	mov    %r12,%rsi
+  800aff:	4c 89 f7             	mov    %r14,%rdi
+  800b02:	ff d0                	call   *%rax
+  800b04:	eb 02                	jmp    800b08 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b06:	48 98                	cltq
+}
+  800b08:	48 83 c4 10          	add    $0x10,%rsp
+  800b0c:	5b                   	pop    %rbx
+  800b0d:	41 5c                	pop    %r12
+  800b0f:	41 5d                	pop    %r13
+  800b11:	41 5e                	pop    %r14
+  800b13:	5d                   	pop    %rbp
+  800b14:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b15:	48 98                	cltq
+  800b17:	eb ef                	jmp    800b08 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b19:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b20:	00 00 00 
+  800b23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b29:	89 da                	mov    %ebx,%edx
+  800b2b:	48 bf f0 36 80 00 00 	movabs $0x8036f0,%rdi
+  800b32:	00 00 00 
+  800b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3a:	48 b9 4c 26 80 00 00 	movabs $0x80264c,%rcx
+  800b41:	00 00 00 
+  800b44:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b46:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b4d:	eb b9                	jmp    800b08 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b4f:	4c 89 ea             	mov    %r13,%rdx
+  800b52:	4c 89 e6             	mov    %r12,%rsi
+  800b55:	89 df                	mov    %ebx,%edi
+  800b57:	48 b8 dc 09 80 00 00 	movabs $0x8009dc,%rax
+  800b5e:	00 00 00 
+  800b61:	ff d0                	call   *%rax
+  800b63:	eb a3                	jmp    800b08 <readmap+0x6e>
+
+0000000000800b65 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b65:	55                   	push   %rbp
+  800b66:	48 89 e5             	mov    %rsp,%rbp
+  800b69:	41 57                	push   %r15
+  800b6b:	41 56                	push   %r14
+  800b6d:	41 55                	push   %r13
+  800b6f:	41 54                	push   %r12
+  800b71:	53                   	push   %rbx
+  800b72:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b76:	48 85 d2             	test   %rdx,%rdx
+  800b79:	74 54                	je     800bcf <readn+0x6a>
+  800b7b:	41 89 fd             	mov    %edi,%r13d
+  800b7e:	49 89 f6             	mov    %rsi,%r14
+  800b81:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b89:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b8e:	49 bf dc 09 80 00 00 	movabs $0x8009dc,%r15
+  800b95:	00 00 00 
+  800b98:	4c 89 e2             	mov    %r12,%rdx
+  800b9b:	48 29 f2             	sub    %rsi,%rdx
+  800b9e:	4c 01 f6             	add    %r14,%rsi
+  800ba1:	44 89 ef             	mov    %r13d,%edi
+  800ba4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ba7:	85 c0                	test   %eax,%eax
+  800ba9:	78 20                	js     800bcb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bab:	01 c3                	add    %eax,%ebx
+  800bad:	85 c0                	test   %eax,%eax
+  800baf:	74 08                	je     800bb9 <readn+0x54>
+  800bb1:	48 63 f3             	movslq %ebx,%rsi
+  800bb4:	4c 39 e6             	cmp    %r12,%rsi
+  800bb7:	72 df                	jb     800b98 <readn+0x33>
+    }
+    return res;
+  800bb9:	48 63 c3             	movslq %ebx,%rax
+}
+  800bbc:	48 83 c4 08          	add    $0x8,%rsp
+  800bc0:	5b                   	pop    %rbx
+  800bc1:	41 5c                	pop    %r12
+  800bc3:	41 5d                	pop    %r13
+  800bc5:	41 5e                	pop    %r14
+  800bc7:	41 5f                	pop    %r15
+  800bc9:	5d                   	pop    %rbp
+  800bca:	c3                   	ret
+        if (inc < 0) return inc;
+  800bcb:	48 98                	cltq
+  800bcd:	eb ed                	jmp    800bbc <readn+0x57>
+    int inc = 1, res = 0;
+  800bcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd4:	eb e3                	jmp    800bb9 <readn+0x54>
+
+0000000000800bd6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bd6:	55                   	push   %rbp
+  800bd7:	48 89 e5             	mov    %rsp,%rbp
+  800bda:	41 56                	push   %r14
+  800bdc:	41 55                	push   %r13
+  800bde:	41 54                	push   %r12
+  800be0:	53                   	push   %rbx
+  800be1:	48 83 ec 10          	sub    $0x10,%rsp
+  800be5:	89 fb                	mov    %edi,%ebx
+  800be7:	49 89 f4             	mov    %rsi,%r12
+  800bea:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bed:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bf1:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800bf8:	00 00 00 
+  800bfb:	ff d0                	call   *%rax
+  800bfd:	85 c0                	test   %eax,%eax
+  800bff:	78 47                	js     800c48 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c01:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c05:	41 8b 3e             	mov    (%r14),%edi
+  800c08:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c0c:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800c13:	00 00 00 
+  800c16:	ff d0                	call   *%rax
+  800c18:	85 c0                	test   %eax,%eax
+  800c1a:	78 30                	js     800c4c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c1c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c21:	74 2d                	je     800c50 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c27:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c2b:	48 85 c0             	test   %rax,%rax
+  800c2e:	74 56                	je     800c86 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c30:	4c 89 ea             	mov    %r13,%rdx
+  800c33:	4c 89 e6             	mov    %r12,%rsi
+  800c36:	4c 89 f7             	mov    %r14,%rdi
+  800c39:	ff d0                	call   *%rax
+}
+  800c3b:	48 83 c4 10          	add    $0x10,%rsp
+  800c3f:	5b                   	pop    %rbx
+  800c40:	41 5c                	pop    %r12
+  800c42:	41 5d                	pop    %r13
+  800c44:	41 5e                	pop    %r14
+  800c46:	5d                   	pop    %rbp
+  800c47:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c48:	48 98                	cltq
+  800c4a:	eb ef                	jmp    800c3b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c4c:	48 98                	cltq
+  800c4e:	eb eb                	jmp    800c3b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c50:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c57:	00 00 00 
+  800c5a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c60:	89 da                	mov    %ebx,%edx
+  800c62:	48 bf 4d 37 80 00 00 	movabs $0x80374d,%rdi
+  800c69:	00 00 00 
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c71:	48 b9 4c 26 80 00 00 	movabs $0x80264c,%rcx
+  800c78:	00 00 00 
+  800c7b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c7d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c84:	eb b5                	jmp    800c3b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c86:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c8d:	eb ac                	jmp    800c3b <write+0x65>
+
+0000000000800c8f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c8f:	55                   	push   %rbp
+  800c90:	48 89 e5             	mov    %rsp,%rbp
+  800c93:	53                   	push   %rbx
+  800c94:	48 83 ec 18          	sub    $0x18,%rsp
+  800c98:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c9e:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800ca5:	00 00 00 
+  800ca8:	ff d0                	call   *%rax
+  800caa:	85 c0                	test   %eax,%eax
+  800cac:	78 0c                	js     800cba <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+
+0000000000800cc0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cc0:	55                   	push   %rbp
+  800cc1:	48 89 e5             	mov    %rsp,%rbp
+  800cc4:	41 55                	push   %r13
+  800cc6:	41 54                	push   %r12
+  800cc8:	53                   	push   %rbx
+  800cc9:	48 83 ec 18          	sub    $0x18,%rsp
+  800ccd:	89 fb                	mov    %edi,%ebx
+  800ccf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cd6:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+  800ce2:	85 c0                	test   %eax,%eax
+  800ce4:	78 38                	js     800d1e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ce6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cea:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf2:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800cf9:	00 00 00 
+  800cfc:	ff d0                	call   *%rax
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	78 1c                	js     800d1e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d02:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d07:	74 20                	je     800d29 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0d:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d11:	48 85 c0             	test   %rax,%rax
+  800d14:	74 47                	je     800d5d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d16:	44 89 e6             	mov    %r12d,%esi
+  800d19:	4c 89 ef             	mov    %r13,%rdi
+  800d1c:	ff d0                	call   *%rax
+}
+  800d1e:	48 83 c4 18          	add    $0x18,%rsp
+  800d22:	5b                   	pop    %rbx
+  800d23:	41 5c                	pop    %r12
+  800d25:	41 5d                	pop    %r13
+  800d27:	5d                   	pop    %rbp
+  800d28:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d29:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d30:	00 00 00 
+  800d33:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d39:	89 da                	mov    %ebx,%edx
+  800d3b:	48 bf 10 37 80 00 00 	movabs $0x803710,%rdi
+  800d42:	00 00 00 
+  800d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4a:	48 b9 4c 26 80 00 00 	movabs $0x80264c,%rcx
+  800d51:	00 00 00 
+  800d54:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d5b:	eb c1                	jmp    800d1e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d5d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d62:	eb ba                	jmp    800d1e <ftruncate+0x5e>
+
+0000000000800d64 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d64:	55                   	push   %rbp
+  800d65:	48 89 e5             	mov    %rsp,%rbp
+  800d68:	41 54                	push   %r12
+  800d6a:	53                   	push   %rbx
+  800d6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800d6f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d72:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d76:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  800d7d:	00 00 00 
+  800d80:	ff d0                	call   *%rax
+  800d82:	85 c0                	test   %eax,%eax
+  800d84:	78 4e                	js     800dd4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d86:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d8a:	41 8b 3c 24          	mov    (%r12),%edi
+  800d8e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d92:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800d99:	00 00 00 
+  800d9c:	ff d0                	call   *%rax
+  800d9e:	85 c0                	test   %eax,%eax
+  800da0:	78 32                	js     800dd4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800da2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800da6:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800dab:	74 30                	je     800ddd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800dad:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800db0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800db7:	00 00 00 
+    stat->st_isdir = 0;
+  800dba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dc1:	00 00 00 
+    stat->st_dev = dev;
+  800dc4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dcb:	48 89 de             	mov    %rbx,%rsi
+  800dce:	4c 89 e7             	mov    %r12,%rdi
+  800dd1:	ff 50 30             	call   *0x30(%rax)
+}
+  800dd4:	48 83 c4 10          	add    $0x10,%rsp
+  800dd8:	5b                   	pop    %rbx
+  800dd9:	41 5c                	pop    %r12
+  800ddb:	5d                   	pop    %rbp
+  800ddc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ddd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800de2:	eb f0                	jmp    800dd4 <fstat+0x70>
+
+0000000000800de4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800de4:	55                   	push   %rbp
+  800de5:	48 89 e5             	mov    %rsp,%rbp
+  800de8:	41 54                	push   %r12
+  800dea:	53                   	push   %rbx
+  800deb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dee:	be 00 00 00 00       	mov    $0x0,%esi
+  800df3:	48 b8 3b 1b 80 00 00 	movabs $0x801b3b,%rax
+  800dfa:	00 00 00 
+  800dfd:	ff d0                	call   *%rax
+  800dff:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	78 25                	js     800e2a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e05:	4c 89 e6             	mov    %r12,%rsi
+  800e08:	89 c7                	mov    %eax,%edi
+  800e0a:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  800e11:	00 00 00 
+  800e14:	ff d0                	call   *%rax
+  800e16:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e19:	89 df                	mov    %ebx,%edi
+  800e1b:	48 b8 5e 08 80 00 00 	movabs $0x80085e,%rax
+  800e22:	00 00 00 
+  800e25:	ff d0                	call   *%rax
+
+    return res;
+  800e27:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e2a:	89 d8                	mov    %ebx,%eax
+  800e2c:	5b                   	pop    %rbx
+  800e2d:	41 5c                	pop    %r12
+  800e2f:	5d                   	pop    %rbp
+  800e30:	c3                   	ret
+
+0000000000800e31 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e31:	55                   	push   %rbp
+  800e32:	48 89 e5             	mov    %rsp,%rbp
+  800e35:	41 54                	push   %r12
+  800e37:	53                   	push   %rbx
+  800e38:	48 83 ec 10          	sub    $0x10,%rsp
+  800e3c:	48 89 fb             	mov    %rdi,%rbx
+  800e3f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e42:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e46:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e4b:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	78 1f                	js     800e7a <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e5f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e63:	48 85 c0             	test   %rax,%rax
+  800e66:	74 1b                	je     800e83 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e68:	4c 89 e6             	mov    %r12,%rsi
+  800e6b:	48 89 df             	mov    %rbx,%rdi
+  800e6e:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e77:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e7a:	48 83 c4 10          	add    $0x10,%rsp
+  800e7e:	5b                   	pop    %rbx
+  800e7f:	41 5c                	pop    %r12
+  800e81:	5d                   	pop    %rbp
+  800e82:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e83:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e88:	eb f0                	jmp    800e7a <create_snapshot+0x49>
+
+0000000000800e8a <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e8a:	55                   	push   %rbp
+  800e8b:	48 89 e5             	mov    %rsp,%rbp
+  800e8e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e92:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e96:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e9b:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800ea2:	00 00 00 
+  800ea5:	ff d0                	call   *%rax
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	78 1e                	js     800ec9 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800eab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800eaf:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800eb3:	48 85 d2             	test   %rdx,%rdx
+  800eb6:	74 13                	je     800ecb <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebd:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ec9:	c9                   	leave
+  800eca:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ecb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ed0:	eb f7                	jmp    800ec9 <print_snapshot_list+0x3f>
+
+0000000000800ed2 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ed2:	55                   	push   %rbp
+  800ed3:	48 89 e5             	mov    %rsp,%rbp
+  800ed6:	53                   	push   %rbx
+  800ed7:	48 83 ec 18          	sub    $0x18,%rsp
+  800edb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ede:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ee2:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ee7:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800eee:	00 00 00 
+  800ef1:	ff d0                	call   *%rax
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	78 1c                	js     800f13 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800ef7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800efb:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800eff:	48 85 c0             	test   %rax,%rax
+  800f02:	74 15                	je     800f19 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f04:	48 89 df             	mov    %rbx,%rdi
+  800f07:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f10:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f17:	c9                   	leave
+  800f18:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f19:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f1e:	eb f3                	jmp    800f13 <accept_snapshot+0x41>
+
+0000000000800f20 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f20:	55                   	push   %rbp
+  800f21:	48 89 e5             	mov    %rsp,%rbp
+  800f24:	53                   	push   %rbx
+  800f25:	48 83 ec 18          	sub    $0x18,%rsp
+  800f29:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f2c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f30:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f35:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800f3c:	00 00 00 
+  800f3f:	ff d0                	call   *%rax
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	78 1c                	js     800f61 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f49:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f4d:	48 85 c0             	test   %rax,%rax
+  800f50:	74 15                	je     800f67 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f52:	48 89 df             	mov    %rbx,%rdi
+  800f55:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f65:	c9                   	leave
+  800f66:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f67:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f6c:	eb f3                	jmp    800f61 <delete_snapshot+0x41>
+
+0000000000800f6e <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+  800f72:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f76:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f7a:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f7f:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800f86:	00 00 00 
+  800f89:	ff d0                	call   *%rax
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	78 14                	js     800fa3 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f93:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f97:	48 85 d2             	test   %rdx,%rdx
+  800f9a:	74 09                	je     800fa5 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa1:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800fa3:	c9                   	leave
+  800fa4:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fa5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800faa:	eb f7                	jmp    800fa3 <gc_snapshots+0x35>
+
+0000000000800fac <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fac:	55                   	push   %rbp
+  800fad:	48 89 e5             	mov    %rsp,%rbp
+  800fb0:	41 56                	push   %r14
+  800fb2:	41 55                	push   %r13
+  800fb4:	41 54                	push   %r12
+  800fb6:	53                   	push   %rbx
+  800fb7:	48 83 ec 10          	sub    $0x10,%rsp
+  800fbb:	48 89 fb             	mov    %rdi,%rbx
+  800fbe:	49 89 f4             	mov    %rsi,%r12
+  800fc1:	49 89 d5             	mov    %rdx,%r13
+  800fc4:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fcb:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fd0:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  800fd7:	00 00 00 
+  800fda:	ff d0                	call   *%rax
+  800fdc:	85 c0                	test   %eax,%eax
+  800fde:	78 1b                	js     800ffb <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fe0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe4:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fe8:	48 85 c0             	test   %rax,%rax
+  800feb:	74 1b                	je     801008 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fed:	4c 89 f1             	mov    %r14,%rcx
+  800ff0:	4c 89 ea             	mov    %r13,%rdx
+  800ff3:	4c 89 e6             	mov    %r12,%rsi
+  800ff6:	48 89 df             	mov    %rbx,%rdi
+  800ff9:	ff d0                	call   *%rax
+
+    return res;
+}
+  800ffb:	48 83 c4 10          	add    $0x10,%rsp
+  800fff:	5b                   	pop    %rbx
+  801000:	41 5c                	pop    %r12
+  801002:	41 5d                	pop    %r13
+  801004:	41 5e                	pop    %r14
+  801006:	5d                   	pop    %rbp
+  801007:	c3                   	ret
+        return -E_NOT_SUPP;
+  801008:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80100d:	eb ec                	jmp    800ffb <diff_snapshots+0x4f>
+
+000000000080100f <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80100f:	55                   	push   %rbp
+  801010:	48 89 e5             	mov    %rsp,%rbp
+  801013:	41 55                	push   %r13
+  801015:	41 54                	push   %r12
+  801017:	53                   	push   %rbx
+  801018:	48 83 ec 18          	sub    $0x18,%rsp
+  80101c:	48 89 fb             	mov    %rdi,%rbx
+  80101f:	49 89 f4             	mov    %rsi,%r12
+  801022:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801025:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801029:	bf 66 00 00 00       	mov    $0x66,%edi
+  80102e:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	78 18                	js     801056 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80103e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801042:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801046:	48 85 c0             	test   %rax,%rax
+  801049:	74 16                	je     801061 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80104b:	4c 89 ea             	mov    %r13,%rdx
+  80104e:	4c 89 e6             	mov    %r12,%rsi
+  801051:	48 89 df             	mov    %rbx,%rdi
+  801054:	ff d0                	call   *%rax
+
+    return res;
+}
+  801056:	48 83 c4 18          	add    $0x18,%rsp
+  80105a:	5b                   	pop    %rbx
+  80105b:	41 5c                	pop    %r12
+  80105d:	41 5d                	pop    %r13
+  80105f:	5d                   	pop    %rbp
+  801060:	c3                   	ret
+        return -E_NOT_SUPP;
+  801061:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801066:	eb ee                	jmp    801056 <send_snapshot+0x47>
+
+0000000000801068 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801068:	55                   	push   %rbp
+  801069:	48 89 e5             	mov    %rsp,%rbp
+  80106c:	53                   	push   %rbx
+  80106d:	48 83 ec 18          	sub    $0x18,%rsp
+  801071:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801074:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801078:	bf 66 00 00 00       	mov    $0x66,%edi
+  80107d:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  801084:	00 00 00 
+  801087:	ff d0                	call   *%rax
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	78 12                	js     80109f <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80108d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801091:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801095:	48 85 c0             	test   %rax,%rax
+  801098:	74 0b                	je     8010a5 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80109a:	48 89 df             	mov    %rbx,%rdi
+  80109d:	ff d0                	call   *%rax
+
+    return res;
+}
+  80109f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a3:	c9                   	leave
+  8010a4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010a5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010aa:	eb f3                	jmp    80109f <receive_snapshot+0x37>
+
+00000000008010ac <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010ac:	55                   	push   %rbp
+  8010ad:	48 89 e5             	mov    %rsp,%rbp
+  8010b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010b8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010bd:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  8010c4:	00 00 00 
+  8010c7:	ff d0                	call   *%rax
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	78 17                	js     8010e4 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010d1:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010d8:	48 85 d2             	test   %rdx,%rdx
+  8010db:	74 09                	je     8010e6 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010e4:	c9                   	leave
+  8010e5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010e6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010eb:	eb f7                	jmp    8010e4 <free_space_bytes+0x38>
+
+00000000008010ed <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010f5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010f9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010fe:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  801105:	00 00 00 
+  801108:	ff d0                	call   *%rax
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	78 17                	js     801125 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80110e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801112:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801119:	48 85 d2             	test   %rdx,%rdx
+  80111c:	74 09                	je     801127 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80111e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801123:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801125:	c9                   	leave
+  801126:	c3                   	ret
+        return -E_NOT_SUPP;
+  801127:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80112c:	eb f7                	jmp    801125 <busy_space_bytes+0x38>
+
+000000000080112e <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80112e:	55                   	push   %rbp
+  80112f:	48 89 e5             	mov    %rsp,%rbp
+  801132:	41 54                	push   %r12
+  801134:	53                   	push   %rbx
+  801135:	48 83 ec 10          	sub    $0x10,%rsp
+  801139:	89 fb                	mov    %edi,%ebx
+  80113b:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80113e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801142:	bf 66 00 00 00       	mov    $0x66,%edi
+  801147:	48 b8 44 07 80 00 00 	movabs $0x800744,%rax
+  80114e:	00 00 00 
+  801151:	ff d0                	call   *%rax
+  801153:	85 c0                	test   %eax,%eax
+  801155:	78 17                	js     80116e <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  801157:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80115b:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801162:	48 85 c0             	test   %rax,%rax
+  801165:	74 10                	je     801177 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  801167:	4c 89 e6             	mov    %r12,%rsi
+  80116a:	89 df                	mov    %ebx,%edi
+  80116c:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80116e:	48 83 c4 10          	add    $0x10,%rsp
+  801172:	5b                   	pop    %rbx
+  801173:	41 5c                	pop    %r12
+  801175:	5d                   	pop    %rbp
+  801176:	c3                   	ret
+        return -E_NOT_SUPP;
+  801177:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80117c:	eb f0                	jmp    80116e <snapshots_space+0x40>
+
+000000000080117e <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80117e:	55                   	push   %rbp
+  80117f:	48 89 e5             	mov    %rsp,%rbp
+  801182:	41 55                	push   %r13
+  801184:	41 54                	push   %r12
+  801186:	53                   	push   %rbx
+  801187:	48 83 ec 08          	sub    $0x8,%rsp
+  80118b:	41 89 fd             	mov    %edi,%r13d
+  80118e:	48 89 f3             	mov    %rsi,%rbx
+  801191:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801194:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80119b:	00 00 00 
+  80119e:	83 38 00             	cmpl   $0x0,(%rax)
+  8011a1:	74 57                	je     8011fa <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011a3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8011a9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011ae:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011b5:	00 00 00 
+  8011b8:	44 89 ee             	mov    %r13d,%esi
+  8011bb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011c2:	00 00 00 
+  8011c5:	8b 38                	mov    (%rax),%edi
+  8011c7:	48 b8 73 35 80 00 00 	movabs $0x803573,%rax
+  8011ce:	00 00 00 
+  8011d1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d8:	4c 89 e2             	mov    %r12,%rdx
+  8011db:	48 89 de             	mov    %rbx,%rsi
+  8011de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011e3:	48 b8 5b 35 80 00 00 	movabs $0x80355b,%rax
+  8011ea:	00 00 00 
+  8011ed:	ff d0                	call   *%rax
+}
+  8011ef:	48 83 c4 08          	add    $0x8,%rsp
+  8011f3:	5b                   	pop    %rbx
+  8011f4:	41 5c                	pop    %r12
+  8011f6:	41 5d                	pop    %r13
+  8011f8:	5d                   	pop    %rbp
+  8011f9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011fa:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011ff:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  801206:	00 00 00 
+  801209:	ff d0                	call   *%rax
+  80120b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801212:	00 00 
+  801214:	eb 8d                	jmp    8011a3 <fsipc_region+0x25>
+
+0000000000801216 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80121e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801225:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801226:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80122a:	48 b8 7e 11 80 00 00 	movabs $0x80117e,%rax
+  801231:	00 00 00 
+  801234:	ff d0                	call   *%rax
+}
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+
+0000000000801238 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801238:	85 ff                	test   %edi,%edi
+  80123a:	78 6d                	js     8012a9 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+  801240:	41 54                	push   %r12
+  801242:	53                   	push   %rbx
+  801243:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801246:	48 85 f6             	test   %rsi,%rsi
+  801249:	74 57                	je     8012a2 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80124b:	89 f8                	mov    %edi,%eax
+  80124d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801254:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	bf 12 00 00 00       	mov    $0x12,%edi
+  801260:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801267:	00 00 00 
+  80126a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	78 2d                	js     80129d <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801270:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801277:	00 00 00 
+  80127a:	49 63 14 24          	movslq (%r12),%rdx
+  80127e:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  801285:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80128a:	48 89 df             	mov    %rbx,%rdi
+  80128d:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  801294:	00 00 00 
+  801297:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  801299:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80129d:	5b                   	pop    %rbx
+  80129e:	41 5c                	pop    %r12
+  8012a0:	5d                   	pop    %rbp
+  8012a1:	c3                   	ret
+        return -E_INVAL;
+  8012a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a7:	eb f4                	jmp    80129d <devfile_df_snapshots+0x65>
+  8012a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012ae:	c3                   	ret
+
+00000000008012af <devfile_df_busy>:
+devfile_df_busy() {
+  8012af:	55                   	push   %rbp
+  8012b0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012bd:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  8012c4:	00 00 00 
+  8012c7:	ff d0                	call   *%rax
+}
+  8012c9:	5d                   	pop    %rbp
+  8012ca:	c3                   	ret
+
+00000000008012cb <devfile_df_free>:
+devfile_df_free() {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012d9:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+}
+  8012e5:	5d                   	pop    %rbp
+  8012e6:	c3                   	ret
+
+00000000008012e7 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012e7:	55                   	push   %rbp
+  8012e8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012f5:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  8012fc:	00 00 00 
+  8012ff:	ff d0                	call   *%rax
+}
+  801301:	5d                   	pop    %rbp
+  801302:	c3                   	ret
+
+0000000000801303 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  801307:	be 00 00 00 00       	mov    $0x0,%esi
+  80130c:	bf 09 00 00 00       	mov    $0x9,%edi
+  801311:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801318:	00 00 00 
+  80131b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801324:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801327:	5d                   	pop    %rbp
+  801328:	c3                   	ret
+
+0000000000801329 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80132d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801334:	00 00 00 
+  801337:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80133a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80133c:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	bf 02 00 00 00       	mov    $0x2,%edi
+  801349:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801350:	00 00 00 
+  801353:	ff d0                	call   *%rax
+}
+  801355:	5d                   	pop    %rbp
+  801356:	c3                   	ret
+
+0000000000801357 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801357:	55                   	push   %rbp
+  801358:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80135b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80135e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801365:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801367:	be 00 00 00 00       	mov    $0x0,%esi
+  80136c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801371:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801378:	00 00 00 
+  80137b:	ff d0                	call   *%rax
+}
+  80137d:	5d                   	pop    %rbp
+  80137e:	c3                   	ret
+
+000000000080137f <devfile_write>:
+    if (!fd || !buf) {
+  80137f:	48 85 ff             	test   %rdi,%rdi
+  801382:	0f 84 c1 00 00 00    	je     801449 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801388:	55                   	push   %rbp
+  801389:	48 89 e5             	mov    %rsp,%rbp
+  80138c:	41 57                	push   %r15
+  80138e:	41 56                	push   %r14
+  801390:	41 55                	push   %r13
+  801392:	41 54                	push   %r12
+  801394:	53                   	push   %rbx
+  801395:	48 83 ec 18          	sub    $0x18,%rsp
+  801399:	49 89 ff             	mov    %rdi,%r15
+  80139c:	49 89 f5             	mov    %rsi,%r13
+  80139f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013a2:	48 85 f6             	test   %rsi,%rsi
+  8013a5:	0f 84 95 00 00 00    	je     801440 <devfile_write+0xc1>
+    while (n) {
+  8013ab:	48 85 d2             	test   %rdx,%rdx
+  8013ae:	0f 84 83 00 00 00    	je     801437 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013bb:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013c2:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013c5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013ca:	49 39 dc             	cmp    %rbx,%r12
+  8013cd:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013d1:	48 89 da             	mov    %rbx,%rdx
+  8013d4:	4c 89 ee             	mov    %r13,%rsi
+  8013d7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013de:	00 00 00 
+  8013e1:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8013e8:	00 00 00 
+  8013eb:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013ed:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013f1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013f4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fd:	bf 04 00 00 00       	mov    $0x4,%edi
+  801402:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801409:	00 00 00 
+  80140c:	ff d0                	call   *%rax
+        if (write < 0) {
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	78 21                	js     801433 <devfile_write+0xb4>
+        buf += write;
+  801412:	48 63 d0             	movslq %eax,%rdx
+  801415:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801418:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80141b:	49 29 d4             	sub    %rdx,%r12
+  80141e:	75 a5                	jne    8013c5 <devfile_write+0x46>
+    return totalWrite;
+  801420:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801424:	48 83 c4 18          	add    $0x18,%rsp
+  801428:	5b                   	pop    %rbx
+  801429:	41 5c                	pop    %r12
+  80142b:	41 5d                	pop    %r13
+  80142d:	41 5e                	pop    %r14
+  80142f:	41 5f                	pop    %r15
+  801431:	5d                   	pop    %rbp
+  801432:	c3                   	ret
+            return write;
+  801433:	48 98                	cltq
+  801435:	eb ed                	jmp    801424 <devfile_write+0xa5>
+    int totalWrite = 0;
+  801437:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80143e:	eb e0                	jmp    801420 <devfile_write+0xa1>
+        return -E_INVAL;
+  801440:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801447:	eb db                	jmp    801424 <devfile_write+0xa5>
+  801449:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801450:	c3                   	ret
+
+0000000000801451 <devfile_read>:
+    if (!fd || !buf) {
+  801451:	48 85 ff             	test   %rdi,%rdi
+  801454:	0f 84 c0 00 00 00    	je     80151a <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80145a:	55                   	push   %rbp
+  80145b:	48 89 e5             	mov    %rsp,%rbp
+  80145e:	41 57                	push   %r15
+  801460:	41 56                	push   %r14
+  801462:	41 55                	push   %r13
+  801464:	41 54                	push   %r12
+  801466:	53                   	push   %rbx
+  801467:	48 83 ec 18          	sub    $0x18,%rsp
+  80146b:	49 89 ff             	mov    %rdi,%r15
+  80146e:	49 89 f5             	mov    %rsi,%r13
+  801471:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801474:	48 85 f6             	test   %rsi,%rsi
+  801477:	0f 84 96 00 00 00    	je     801513 <devfile_read+0xc2>
+    while (n) {
+  80147d:	48 85 d2             	test   %rdx,%rdx
+  801480:	0f 84 87 00 00 00    	je     80150d <devfile_read+0xbc>
+    size_t totalRead = 0;
+  801486:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80148d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80148e:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801495:	00 00 00 
+  801498:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80149c:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80149f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014a4:	49 39 c4             	cmp    %rax,%r12
+  8014a7:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014ab:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014af:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014b9:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  8014c0:	00 00 00 
+  8014c3:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014c5:	85 c0                	test   %eax,%eax
+  8014c7:	7e 37                	jle    801500 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014c9:	48 63 d8             	movslq %eax,%rbx
+  8014cc:	48 89 da             	mov    %rbx,%rdx
+  8014cf:	4c 89 f6             	mov    %r14,%rsi
+  8014d2:	4c 89 ef             	mov    %r13,%rdi
+  8014d5:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8014dc:	00 00 00 
+  8014df:	ff d0                	call   *%rax
+        buf += read;
+  8014e1:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014e4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014e8:	49 29 dc             	sub    %rbx,%r12
+  8014eb:	75 ab                	jne    801498 <devfile_read+0x47>
+  return totalRead;
+  8014ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014f1:	48 83 c4 18          	add    $0x18,%rsp
+  8014f5:	5b                   	pop    %rbx
+  8014f6:	41 5c                	pop    %r12
+  8014f8:	41 5d                	pop    %r13
+  8014fa:	41 5e                	pop    %r14
+  8014fc:	41 5f                	pop    %r15
+  8014fe:	5d                   	pop    %rbp
+  8014ff:	c3                   	ret
+            return read ? read : totalRead;
+  801500:	48 63 d0             	movslq %eax,%rdx
+  801503:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801507:	48 0f 45 c2          	cmovne %rdx,%rax
+  80150b:	eb e4                	jmp    8014f1 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80150d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801511:	eb da                	jmp    8014ed <devfile_read+0x9c>
+        return E_INVAL;
+  801513:	b8 03 00 00 00       	mov    $0x3,%eax
+  801518:	eb d7                	jmp    8014f1 <devfile_read+0xa0>
+  80151a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80151f:	c3                   	ret
+
+0000000000801520 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801520:	48 85 ff             	test   %rdi,%rdi
+  801523:	74 5f                	je     801584 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801525:	55                   	push   %rbp
+  801526:	48 89 e5             	mov    %rsp,%rbp
+  801529:	53                   	push   %rbx
+  80152a:	48 83 ec 08          	sub    $0x8,%rsp
+  80152e:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801531:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  801538:	00 00 00 
+  80153b:	ff d0                	call   *%rax
+  80153d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801543:	77 45                	ja     80158a <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801545:	48 89 de             	mov    %rbx,%rsi
+  801548:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80154f:	00 00 00 
+  801552:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  801559:	00 00 00 
+  80155c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80155e:	be 00 00 00 00       	mov    $0x0,%esi
+  801563:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801568:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  80156f:	00 00 00 
+  801572:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801574:	85 c0                	test   %eax,%eax
+  801576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80157e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+        return -E_INVAL;
+  801584:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801589:	c3                   	ret
+        return -E_INVAL;
+  80158a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80158f:	eb ed                	jmp    80157e <devfile_receive_snapshot+0x5e>
+
+0000000000801591 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801591:	55                   	push   %rbp
+  801592:	48 89 e5             	mov    %rsp,%rbp
+  801595:	41 55                	push   %r13
+  801597:	41 54                	push   %r12
+  801599:	53                   	push   %rbx
+  80159a:	48 83 ec 08          	sub    $0x8,%rsp
+  80159e:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015a1:	48 85 f6             	test   %rsi,%rsi
+  8015a4:	0f 94 c0             	sete   %al
+  8015a7:	48 85 d2             	test   %rdx,%rdx
+  8015aa:	0f 94 c2             	sete   %dl
+  8015ad:	08 d0                	or     %dl,%al
+  8015af:	0f 85 ad 00 00 00    	jne    801662 <devfile_send_snapshot+0xd1>
+  8015b5:	48 89 fb             	mov    %rdi,%rbx
+  8015b8:	49 89 f4             	mov    %rsi,%r12
+  8015bb:	48 85 ff             	test   %rdi,%rdi
+  8015be:	0f 84 9e 00 00 00    	je     801662 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015c4:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8015cb:	00 00 00 
+  8015ce:	ff d0                	call   *%rax
+  8015d0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015d6:	0f 87 8d 00 00 00    	ja     801669 <devfile_send_snapshot+0xd8>
+  8015dc:	4c 89 e7             	mov    %r12,%rdi
+  8015df:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8015e6:	00 00 00 
+  8015e9:	ff d0                	call   *%rax
+  8015eb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015f1:	77 7d                	ja     801670 <devfile_send_snapshot+0xdf>
+  8015f3:	4c 89 ef             	mov    %r13,%rdi
+  8015f6:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8015fd:	00 00 00 
+  801600:	ff d0                	call   *%rax
+  801602:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801608:	77 6d                	ja     801677 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80160a:	48 89 de             	mov    %rbx,%rsi
+  80160d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801614:	00 00 00 
+  801617:	48 bb 71 2f 80 00 00 	movabs $0x802f71,%rbx
+  80161e:	00 00 00 
+  801621:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801623:	4c 89 e6             	mov    %r12,%rsi
+  801626:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80162d:	00 00 00 
+  801630:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801632:	4c 89 ee             	mov    %r13,%rsi
+  801635:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80163c:	00 00 00 
+  80163f:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801641:	be 00 00 00 00       	mov    $0x0,%esi
+  801646:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80164b:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801652:	00 00 00 
+  801655:	ff d0                	call   *%rax
+}
+  801657:	48 83 c4 08          	add    $0x8,%rsp
+  80165b:	5b                   	pop    %rbx
+  80165c:	41 5c                	pop    %r12
+  80165e:	41 5d                	pop    %r13
+  801660:	5d                   	pop    %rbp
+  801661:	c3                   	ret
+        return -E_INVAL;
+  801662:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801667:	eb ee                	jmp    801657 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801669:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166e:	eb e7                	jmp    801657 <devfile_send_snapshot+0xc6>
+  801670:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801675:	eb e0                	jmp    801657 <devfile_send_snapshot+0xc6>
+  801677:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167c:	eb d9                	jmp    801657 <devfile_send_snapshot+0xc6>
+
+000000000080167e <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80167e:	48 85 ff             	test   %rdi,%rdi
+  801681:	0f 84 41 01 00 00    	je     8017c8 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801687:	55                   	push   %rbp
+  801688:	48 89 e5             	mov    %rsp,%rbp
+  80168b:	41 57                	push   %r15
+  80168d:	41 56                	push   %r14
+  80168f:	41 55                	push   %r13
+  801691:	41 54                	push   %r12
+  801693:	53                   	push   %rbx
+  801694:	48 83 ec 08          	sub    $0x8,%rsp
+  801698:	49 89 fc             	mov    %rdi,%r12
+  80169b:	49 89 f5             	mov    %rsi,%r13
+  80169e:	48 89 d3             	mov    %rdx,%rbx
+  8016a1:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016a4:	48 85 f6             	test   %rsi,%rsi
+  8016a7:	0f 84 ff 00 00 00    	je     8017ac <devfile_diff_snapshots+0x12e>
+  8016ad:	48 85 d2             	test   %rdx,%rdx
+  8016b0:	0f 84 fd 00 00 00    	je     8017b3 <devfile_diff_snapshots+0x135>
+  8016b6:	48 85 c9             	test   %rcx,%rcx
+  8016b9:	0f 84 f4 00 00 00    	je     8017b3 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016bf:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8016c6:	00 00 00 
+  8016c9:	ff d0                	call   *%rax
+  8016cb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d1:	0f 87 e3 00 00 00    	ja     8017ba <devfile_diff_snapshots+0x13c>
+  8016d7:	4c 89 ef             	mov    %r13,%rdi
+  8016da:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8016e1:	00 00 00 
+  8016e4:	ff d0                	call   *%rax
+  8016e6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016ec:	0f 87 cf 00 00 00    	ja     8017c1 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016f2:	4c 89 e6             	mov    %r12,%rsi
+  8016f5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016fc:	00 00 00 
+  8016ff:	4c 89 e7             	mov    %r12,%rdi
+  801702:	49 bf 71 2f 80 00 00 	movabs $0x802f71,%r15
+  801709:	00 00 00 
+  80170c:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80170f:	4c 89 ee             	mov    %r13,%rsi
+  801712:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801719:	00 
+  80171a:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80171d:	48 8b 03             	mov    (%rbx),%rax
+  801720:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801727:	00 
+  801728:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80172c:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801733:	00 
+  801734:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801738:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80173f:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801740:	be 00 00 00 00       	mov    $0x0,%esi
+  801745:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80174a:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801751:	00 00 00 
+  801754:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801756:	85 c0                	test   %eax,%eax
+  801758:	78 43                	js     80179d <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80175a:	49 8b 04 24          	mov    (%r12),%rax
+  80175e:	48 89 03             	mov    %rax,(%rbx)
+  801761:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801766:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80176a:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80176f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801773:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801778:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80177c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801780:	48 c1 e2 03          	shl    $0x3,%rdx
+  801784:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801789:	4c 89 f7             	mov    %r14,%rdi
+  80178c:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  801793:	00 00 00 
+  801796:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  801798:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80179d:	48 83 c4 08          	add    $0x8,%rsp
+  8017a1:	5b                   	pop    %rbx
+  8017a2:	41 5c                	pop    %r12
+  8017a4:	41 5d                	pop    %r13
+  8017a6:	41 5e                	pop    %r14
+  8017a8:	41 5f                	pop    %r15
+  8017aa:	5d                   	pop    %rbp
+  8017ab:	c3                   	ret
+        return -E_INVAL;
+  8017ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b1:	eb ea                	jmp    80179d <devfile_diff_snapshots+0x11f>
+  8017b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b8:	eb e3                	jmp    80179d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bf:	eb dc                	jmp    80179d <devfile_diff_snapshots+0x11f>
+  8017c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c6:	eb d5                	jmp    80179d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017cd:	c3                   	ret
+
+00000000008017ce <devfile_delete_snapshot>:
+    if (!name) {
+  8017ce:	48 85 ff             	test   %rdi,%rdi
+  8017d1:	74 5f                	je     801832 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017d3:	55                   	push   %rbp
+  8017d4:	48 89 e5             	mov    %rsp,%rbp
+  8017d7:	53                   	push   %rbx
+  8017d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017dc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017df:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8017e6:	00 00 00 
+  8017e9:	ff d0                	call   *%rax
+  8017eb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017f1:	77 45                	ja     801838 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017f3:	48 89 de             	mov    %rbx,%rsi
+  8017f6:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017fd:	00 00 00 
+  801800:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  801807:	00 00 00 
+  80180a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80180c:	be 00 00 00 00       	mov    $0x0,%esi
+  801811:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801816:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801822:	85 c0                	test   %eax,%eax
+  801824:	ba 00 00 00 00       	mov    $0x0,%edx
+  801829:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80182c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+        return -E_INVAL;
+  801832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801837:	c3                   	ret
+        return -E_INVAL;
+  801838:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80183d:	eb ed                	jmp    80182c <devfile_delete_snapshot+0x5e>
+
+000000000080183f <devfile_accept_snapshot>:
+    if (!name) {
+  80183f:	48 85 ff             	test   %rdi,%rdi
+  801842:	74 5f                	je     8018a3 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	53                   	push   %rbx
+  801849:	48 83 ec 08          	sub    $0x8,%rsp
+  80184d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801850:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  801857:	00 00 00 
+  80185a:	ff d0                	call   *%rax
+  80185c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801862:	77 45                	ja     8018a9 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801864:	48 89 de             	mov    %rbx,%rsi
+  801867:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80186e:	00 00 00 
+  801871:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  801878:	00 00 00 
+  80187b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80187d:	be 00 00 00 00       	mov    $0x0,%esi
+  801882:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801887:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801893:	85 c0                	test   %eax,%eax
+  801895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80189d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a1:	c9                   	leave
+  8018a2:	c3                   	ret
+        return -E_INVAL;
+  8018a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018a8:	c3                   	ret
+        return -E_INVAL;
+  8018a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ae:	eb ed                	jmp    80189d <devfile_accept_snapshot+0x5e>
+
+00000000008018b0 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018b0:	48 85 ff             	test   %rdi,%rdi
+  8018b3:	0f 84 9f 00 00 00    	je     801958 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018b9:	55                   	push   %rbp
+  8018ba:	48 89 e5             	mov    %rsp,%rbp
+  8018bd:	41 54                	push   %r12
+  8018bf:	53                   	push   %rbx
+  8018c0:	48 89 fb             	mov    %rdi,%rbx
+  8018c3:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018c6:	48 85 f6             	test   %rsi,%rsi
+  8018c9:	74 78                	je     801943 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018cb:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8018d2:	00 00 00 
+  8018d5:	ff d0                	call   *%rax
+  8018d7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018dd:	77 6b                	ja     80194a <devfile_create_snapshot+0x9a>
+  8018df:	4c 89 e7             	mov    %r12,%rdi
+  8018e2:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018f4:	77 5b                	ja     801951 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018f6:	48 89 de             	mov    %rbx,%rsi
+  8018f9:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801900:	00 00 00 
+  801903:	48 bb 71 2f 80 00 00 	movabs $0x802f71,%rbx
+  80190a:	00 00 00 
+  80190d:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80190f:	4c 89 e6             	mov    %r12,%rsi
+  801912:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801919:	00 00 00 
+  80191c:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80191e:	be 00 00 00 00       	mov    $0x0,%esi
+  801923:	bf 08 00 00 00       	mov    $0x8,%edi
+  801928:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  80192f:	00 00 00 
+  801932:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801934:	85 c0                	test   %eax,%eax
+  801936:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80193e:	5b                   	pop    %rbx
+  80193f:	41 5c                	pop    %r12
+  801941:	5d                   	pop    %rbp
+  801942:	c3                   	ret
+        return -E_INVAL;
+  801943:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801948:	eb f4                	jmp    80193e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80194a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194f:	eb ed                	jmp    80193e <devfile_create_snapshot+0x8e>
+  801951:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801956:	eb e6                	jmp    80193e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801958:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80195d:	c3                   	ret
+
+000000000080195e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80195e:	55                   	push   %rbp
+  80195f:	48 89 e5             	mov    %rsp,%rbp
+  801962:	41 54                	push   %r12
+  801964:	53                   	push   %rbx
+  801965:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801968:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80196b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801972:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801974:	be 00 00 00 00       	mov    $0x0,%esi
+  801979:	bf 05 00 00 00       	mov    $0x5,%edi
+  80197e:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801985:	00 00 00 
+  801988:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	78 3d                	js     8019cb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80198e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801995:	00 00 00 
+  801998:	4c 89 e6             	mov    %r12,%rsi
+  80199b:	48 89 df             	mov    %rbx,%rdi
+  80199e:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8019aa:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019b1:	00 
+  8019b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019b8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019bf:	00 
+  8019c0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019cb:	5b                   	pop    %rbx
+  8019cc:	41 5c                	pop    %r12
+  8019ce:	5d                   	pop    %rbp
+  8019cf:	c3                   	ret
+
+00000000008019d0 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	41 57                	push   %r15
+  8019d6:	41 56                	push   %r14
+  8019d8:	41 55                	push   %r13
+  8019da:	41 54                	push   %r12
+  8019dc:	53                   	push   %rbx
+  8019dd:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019e5:	49 89 f5             	mov    %rsi,%r13
+  8019e8:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019eb:	48 89 f0             	mov    %rsi,%rax
+  8019ee:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019f3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019f7:	75 4f                	jne    801a48 <devfile_readmap+0x78>
+  8019f9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019fd:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a03:	75 1f                	jne    801a24 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a09:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a0d:	49 be b8 21 80 00 00 	movabs $0x8021b8,%r14
+  801a14:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a17:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a1e:	0f 87 9d 00 00 00    	ja     801ac1 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a24:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a28:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a2c:	4d 85 ff             	test   %r15,%r15
+  801a2f:	0f 85 cf 00 00 00    	jne    801b04 <devfile_readmap+0x134>
+  801a35:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a39:	48 83 c4 38          	add    $0x38,%rsp
+  801a3d:	5b                   	pop    %rbx
+  801a3e:	41 5c                	pop    %r12
+  801a40:	41 5d                	pop    %r13
+  801a42:	41 5e                	pop    %r14
+  801a44:	41 5f                	pop    %r15
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+    size_t totalRead = 0;
+  801a48:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a4f:	00 
+  801a50:	eb da                	jmp    801a2c <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a52:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a56:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a59:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a60:	00 00 00 
+  801a63:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a69:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a6d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a71:	4c 89 ee             	mov    %r13,%rsi
+  801a74:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a79:	48 b8 7e 11 80 00 00 	movabs $0x80117e,%rax
+  801a80:	00 00 00 
+  801a83:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	7e a3                	jle    801a2c <devfile_readmap+0x5c>
+  801a89:	48 98                	cltq
+  801a8b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a8f:	72 9b                	jb     801a2c <devfile_readmap+0x5c>
+        buf += read;
+  801a91:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a94:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a97:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a9b:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801aa2:	75 88                	jne    801a2c <devfile_readmap+0x5c>
+  801aa4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801aa8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801aae:	0f 85 78 ff ff ff    	jne    801a2c <devfile_readmap+0x5c>
+  801ab4:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801abb:	0f 86 6b ff ff ff    	jbe    801a2c <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ac1:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801ac7:	4d 39 e7             	cmp    %r12,%r15
+  801aca:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ace:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801ad5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ad9:	0f 84 73 ff ff ff    	je     801a52 <devfile_readmap+0x82>
+  801adf:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ae3:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801ae8:	41 ff d6             	call   *%r14
+  801aeb:	a8 40                	test   $0x40,%al
+  801aed:	0f 85 39 ff ff ff    	jne    801a2c <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801af3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801afa:	4c 39 e3             	cmp    %r12,%rbx
+  801afd:	72 e4                	jb     801ae3 <devfile_readmap+0x113>
+  801aff:	e9 4e ff ff ff       	jmp    801a52 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b04:	4c 89 fa             	mov    %r15,%rdx
+  801b07:	4c 89 ee             	mov    %r13,%rsi
+  801b0a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b0e:	48 b8 51 14 80 00 00 	movabs $0x801451,%rax
+  801b15:	00 00 00 
+  801b18:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b1a:	48 85 c0             	test   %rax,%rax
+  801b1d:	78 0c                	js     801b2b <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b1f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b23:	48 01 f0             	add    %rsi,%rax
+  801b26:	e9 0e ff ff ff       	jmp    801a39 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b2b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b2f:	48 85 f6             	test   %rsi,%rsi
+  801b32:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b36:	e9 fe fe ff ff       	jmp    801a39 <devfile_readmap+0x69>
+
+0000000000801b3b <open>:
+open(const char *path, int mode) {
+  801b3b:	55                   	push   %rbp
+  801b3c:	48 89 e5             	mov    %rsp,%rbp
+  801b3f:	41 55                	push   %r13
+  801b41:	41 54                	push   %r12
+  801b43:	53                   	push   %rbx
+  801b44:	48 83 ec 18          	sub    $0x18,%rsp
+  801b48:	49 89 fc             	mov    %rdi,%r12
+  801b4b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b4e:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+  801b5a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b60:	0f 87 8a 00 00 00    	ja     801bf0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b66:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b6a:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  801b71:	00 00 00 
+  801b74:	ff d0                	call   *%rax
+  801b76:	89 c3                	mov    %eax,%ebx
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	78 50                	js     801bcc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b7c:	4c 89 e6             	mov    %r12,%rsi
+  801b7f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b86:	00 00 00 
+  801b89:	48 89 df             	mov    %rbx,%rdi
+  801b8c:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  801b93:	00 00 00 
+  801b96:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b98:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b9f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ba3:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ba8:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801baf:	00 00 00 
+  801bb2:	ff d0                	call   *%rax
+  801bb4:	89 c3                	mov    %eax,%ebx
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 1f                	js     801bd9 <open+0x9e>
+    return fd2num(fd);
+  801bba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bbe:	48 b8 6b 06 80 00 00 	movabs $0x80066b,%rax
+  801bc5:	00 00 00 
+  801bc8:	ff d0                	call   *%rax
+  801bca:	89 c3                	mov    %eax,%ebx
+}
+  801bcc:	89 d8                	mov    %ebx,%eax
+  801bce:	48 83 c4 18          	add    $0x18,%rsp
+  801bd2:	5b                   	pop    %rbx
+  801bd3:	41 5c                	pop    %r12
+  801bd5:	41 5d                	pop    %r13
+  801bd7:	5d                   	pop    %rbp
+  801bd8:	c3                   	ret
+        fd_close(fd, 0);
+  801bd9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bde:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801be2:	48 b8 b4 07 80 00 00 	movabs $0x8007b4,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+        return res;
+  801bee:	eb dc                	jmp    801bcc <open+0x91>
+        return -E_BAD_PATH;
+  801bf0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bf5:	eb d5                	jmp    801bcc <open+0x91>
+
+0000000000801bf7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bf7:	55                   	push   %rbp
+  801bf8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801bfb:	be 00 00 00 00       	mov    $0x0,%esi
+  801c00:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c05:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801c0c:	00 00 00 
+  801c0f:	ff d0                	call   *%rax
+}
+  801c11:	5d                   	pop    %rbp
+  801c12:	c3                   	ret
+
+0000000000801c13 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c13:	55                   	push   %rbp
+  801c14:	48 89 e5             	mov    %rsp,%rbp
+  801c17:	41 54                	push   %r12
+  801c19:	53                   	push   %rbx
+  801c1a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c1d:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+  801c29:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c2c:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  801c33:	00 00 00 
+  801c36:	48 89 df             	mov    %rbx,%rdi
+  801c39:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  801c40:	00 00 00 
+  801c43:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c45:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c4a:	41 2b 04 24          	sub    (%r12),%eax
+  801c4e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c54:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c5b:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c5e:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c65:	00 00 00 
+  801c68:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c74:	5b                   	pop    %rbx
+  801c75:	41 5c                	pop    %r12
+  801c77:	5d                   	pop    %rbp
+  801c78:	c3                   	ret
+
+0000000000801c79 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 54                	push   %r12
+  801c7f:	53                   	push   %rbx
+  801c80:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c88:	48 89 fe             	mov    %rdi,%rsi
+  801c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c90:	49 bc 67 03 80 00 00 	movabs $0x800367,%r12
+  801c97:	00 00 00 
+  801c9a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c9d:	48 89 df             	mov    %rbx,%rdi
+  801ca0:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+  801cac:	48 89 c6             	mov    %rax,%rsi
+  801caf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb9:	41 ff d4             	call   *%r12
+}
+  801cbc:	5b                   	pop    %rbx
+  801cbd:	41 5c                	pop    %r12
+  801cbf:	5d                   	pop    %rbp
+  801cc0:	c3                   	ret
+
+0000000000801cc1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cc1:	55                   	push   %rbp
+  801cc2:	48 89 e5             	mov    %rsp,%rbp
+  801cc5:	41 57                	push   %r15
+  801cc7:	41 56                	push   %r14
+  801cc9:	41 55                	push   %r13
+  801ccb:	41 54                	push   %r12
+  801ccd:	53                   	push   %rbx
+  801cce:	48 83 ec 18          	sub    $0x18,%rsp
+  801cd2:	49 89 fc             	mov    %rdi,%r12
+  801cd5:	49 89 f5             	mov    %rsi,%r13
+  801cd8:	49 89 d7             	mov    %rdx,%r15
+  801cdb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cdf:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801ce6:	00 00 00 
+  801ce9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801ceb:	4d 85 ff             	test   %r15,%r15
+  801cee:	0f 84 af 00 00 00    	je     801da3 <devpipe_write+0xe2>
+  801cf4:	48 89 c3             	mov    %rax,%rbx
+  801cf7:	4c 89 f8             	mov    %r15,%rax
+  801cfa:	4d 89 ef             	mov    %r13,%r15
+  801cfd:	4c 01 e8             	add    %r13,%rax
+  801d00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d04:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  801d0b:	00 00 00 
+            sys_yield();
+  801d0e:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  801d15:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d18:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d1b:	48 63 ce             	movslq %esi,%rcx
+  801d1e:	48 63 03             	movslq (%rbx),%rax
+  801d21:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d27:	48 39 c1             	cmp    %rax,%rcx
+  801d2a:	72 2e                	jb     801d5a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d2c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d31:	48 89 da             	mov    %rbx,%rdx
+  801d34:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d39:	4c 89 e7             	mov    %r12,%rdi
+  801d3c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	74 66                	je     801da9 <devpipe_write+0xe8>
+            sys_yield();
+  801d43:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d46:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d49:	48 63 ce             	movslq %esi,%rcx
+  801d4c:	48 63 03             	movslq (%rbx),%rax
+  801d4f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d55:	48 39 c1             	cmp    %rax,%rcx
+  801d58:	73 d2                	jae    801d2c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d5a:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d5e:	48 89 ca             	mov    %rcx,%rdx
+  801d61:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d65:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d6c:	08 10 20 
+  801d6f:	48 f7 e2             	mul    %rdx
+  801d72:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d76:	48 89 d0             	mov    %rdx,%rax
+  801d79:	48 c1 e0 09          	shl    $0x9,%rax
+  801d7d:	48 29 d0             	sub    %rdx,%rax
+  801d80:	48 c1 e0 03          	shl    $0x3,%rax
+  801d84:	48 29 c1             	sub    %rax,%rcx
+  801d87:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d8c:	83 c6 01             	add    $0x1,%esi
+  801d8f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d92:	49 83 c7 01          	add    $0x1,%r15
+  801d96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d9a:	49 39 c7             	cmp    %rax,%r15
+  801d9d:	0f 85 75 ff ff ff    	jne    801d18 <devpipe_write+0x57>
+    return n;
+  801da3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801da7:	eb 05                	jmp    801dae <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dae:	48 83 c4 18          	add    $0x18,%rsp
+  801db2:	5b                   	pop    %rbx
+  801db3:	41 5c                	pop    %r12
+  801db5:	41 5d                	pop    %r13
+  801db7:	41 5e                	pop    %r14
+  801db9:	41 5f                	pop    %r15
+  801dbb:	5d                   	pop    %rbp
+  801dbc:	c3                   	ret
+
+0000000000801dbd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801dbd:	55                   	push   %rbp
+  801dbe:	48 89 e5             	mov    %rsp,%rbp
+  801dc1:	41 57                	push   %r15
+  801dc3:	41 56                	push   %r14
+  801dc5:	41 55                	push   %r13
+  801dc7:	41 54                	push   %r12
+  801dc9:	53                   	push   %rbx
+  801dca:	48 83 ec 18          	sub    $0x18,%rsp
+  801dce:	49 89 fc             	mov    %rdi,%r12
+  801dd1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dd5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dd9:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801de8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dee:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  801df5:	00 00 00 
+            sys_yield();
+  801df8:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  801dff:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e02:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e07:	74 7d                	je     801e86 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e09:	8b 03                	mov    (%rbx),%eax
+  801e0b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e0e:	75 26                	jne    801e36 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e10:	4d 85 ff             	test   %r15,%r15
+  801e13:	75 77                	jne    801e8c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e15:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e1a:	48 89 da             	mov    %rbx,%rdx
+  801e1d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e22:	4c 89 e7             	mov    %r12,%rdi
+  801e25:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	74 72                	je     801e9e <devpipe_read+0xe1>
+            sys_yield();
+  801e2c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e2f:	8b 03                	mov    (%rbx),%eax
+  801e31:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e34:	74 df                	je     801e15 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e36:	48 63 c8             	movslq %eax,%rcx
+  801e39:	48 89 ca             	mov    %rcx,%rdx
+  801e3c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e40:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e47:	08 10 20 
+  801e4a:	48 89 d0             	mov    %rdx,%rax
+  801e4d:	48 f7 e6             	mul    %rsi
+  801e50:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e54:	48 89 d0             	mov    %rdx,%rax
+  801e57:	48 c1 e0 09          	shl    $0x9,%rax
+  801e5b:	48 29 d0             	sub    %rdx,%rax
+  801e5e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e65:	00 
+  801e66:	48 89 c8             	mov    %rcx,%rax
+  801e69:	48 29 d0             	sub    %rdx,%rax
+  801e6c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e71:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e75:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e79:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e7c:	49 83 c7 01          	add    $0x1,%r15
+  801e80:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e84:	75 83                	jne    801e09 <devpipe_read+0x4c>
+    return n;
+  801e86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e8a:	eb 03                	jmp    801e8f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e8c:	4c 89 f8             	mov    %r15,%rax
+}
+  801e8f:	48 83 c4 18          	add    $0x18,%rsp
+  801e93:	5b                   	pop    %rbx
+  801e94:	41 5c                	pop    %r12
+  801e96:	41 5d                	pop    %r13
+  801e98:	41 5e                	pop    %r14
+  801e9a:	41 5f                	pop    %r15
+  801e9c:	5d                   	pop    %rbp
+  801e9d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea3:	eb ea                	jmp    801e8f <devpipe_read+0xd2>
+
+0000000000801ea5 <pipe>:
+pipe(int pfd[2]) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801eb5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801eb9:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+  801ec5:	89 c3                	mov    %eax,%ebx
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	0f 88 a0 01 00 00    	js     80206f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ecf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ed4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ed9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801edd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee2:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+  801eee:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	0f 88 77 01 00 00    	js     80206f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801ef8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801efc:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  801f03:	00 00 00 
+  801f06:	ff d0                	call   *%rax
+  801f08:	89 c3                	mov    %eax,%ebx
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	0f 88 43 01 00 00    	js     802055 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f12:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f1c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f25:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+  801f31:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	0f 88 1a 01 00 00    	js     802055 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f3b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f3f:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f4e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f58:	48 89 c6             	mov    %rax,%rsi
+  801f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f60:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	89 c3                	mov    %eax,%ebx
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	0f 88 c5 00 00 00    	js     80203b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f76:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f7a:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	48 89 c1             	mov    %rax,%rcx
+  801f89:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f8f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9a:	4c 89 ee             	mov    %r13,%rsi
+  801f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa2:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	89 c3                	mov    %eax,%ebx
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	78 6e                	js     802022 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fb4:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fb9:	4c 89 ef             	mov    %r13,%rdi
+  801fbc:	48 b8 3d 02 80 00 00 	movabs $0x80023d,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	83 f8 02             	cmp    $0x2,%eax
+  801fcb:	0f 85 ab 00 00 00    	jne    80207c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fd1:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fd8:	00 00 
+  801fda:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fde:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fe0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fe4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801feb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fef:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801ff1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ff5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801ffc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802000:	48 bb 6b 06 80 00 00 	movabs $0x80066b,%rbx
+  802007:	00 00 00 
+  80200a:	ff d3                	call   *%rbx
+  80200c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802010:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802014:	ff d3                	call   *%rbx
+  802016:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80201b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802020:	eb 4d                	jmp    80206f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802022:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802027:	4c 89 ee             	mov    %r13,%rsi
+  80202a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80202f:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80203b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802040:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802044:	bf 00 00 00 00       	mov    $0x0,%edi
+  802049:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802055:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80205a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80205e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802063:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+}
+  80206f:	89 d8                	mov    %ebx,%eax
+  802071:	48 83 c4 18          	add    $0x18,%rsp
+  802075:	5b                   	pop    %rbx
+  802076:	41 5c                	pop    %r12
+  802078:	41 5d                	pop    %r13
+  80207a:	5d                   	pop    %rbp
+  80207b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80207c:	48 b9 d0 37 80 00 00 	movabs $0x8037d0,%rcx
+  802083:	00 00 00 
+  802086:	48 ba a7 37 80 00 00 	movabs $0x8037a7,%rdx
+  80208d:	00 00 00 
+  802090:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802095:	48 bf bc 37 80 00 00 	movabs $0x8037bc,%rdi
+  80209c:	00 00 00 
+  80209f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a4:	49 b8 fc 24 80 00 00 	movabs $0x8024fc,%r8
+  8020ab:	00 00 00 
+  8020ae:	41 ff d0             	call   *%r8
+
+00000000008020b1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020b1:	55                   	push   %rbp
+  8020b2:	48 89 e5             	mov    %rsp,%rbp
+  8020b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020bd:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	78 35                	js     802102 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020cd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d1:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  8020d8:	00 00 00 
+  8020db:	ff d0                	call   *%rax
+  8020dd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020e0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020ee:	48 b8 6f 02 80 00 00 	movabs $0x80026f,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	0f 94 c0             	sete   %al
+  8020ff:	0f b6 c0             	movzbl %al,%eax
+}
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+0000000000802104 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802104:	48 89 f8             	mov    %rdi,%rax
+  802107:	48 c1 e8 27          	shr    $0x27,%rax
+  80210b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802112:	01 00 00 
+  802115:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802119:	f6 c2 01             	test   $0x1,%dl
+  80211c:	74 6d                	je     80218b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80211e:	48 89 f8             	mov    %rdi,%rax
+  802121:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802125:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80212c:	01 00 00 
+  80212f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802133:	f6 c2 01             	test   $0x1,%dl
+  802136:	74 62                	je     80219a <get_uvpt_entry+0x96>
+  802138:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80213f:	01 00 00 
+  802142:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802146:	f6 c2 80             	test   $0x80,%dl
+  802149:	75 4f                	jne    80219a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80214b:	48 89 f8             	mov    %rdi,%rax
+  80214e:	48 c1 e8 15          	shr    $0x15,%rax
+  802152:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802159:	01 00 00 
+  80215c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802160:	f6 c2 01             	test   $0x1,%dl
+  802163:	74 44                	je     8021a9 <get_uvpt_entry+0xa5>
+  802165:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80216c:	01 00 00 
+  80216f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802173:	f6 c2 80             	test   $0x80,%dl
+  802176:	75 31                	jne    8021a9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802178:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80217c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802183:	01 00 00 
+  802186:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80218a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80218b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802192:	01 00 00 
+  802195:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802199:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80219a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021a1:	01 00 00 
+  8021a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021a9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021b0:	01 00 00 
+  8021b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021b7:	c3                   	ret
+
+00000000008021b8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021b8:	55                   	push   %rbp
+  8021b9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021bc:	48 b8 04 21 80 00 00 	movabs $0x802104,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+  8021c8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021cb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021d0:	89 c1                	mov    %eax,%ecx
+  8021d2:	83 c9 04             	or     $0x4,%ecx
+  8021d5:	f6 c2 01             	test   $0x1,%dl
+  8021d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021db:	89 c1                	mov    %eax,%ecx
+  8021dd:	83 c9 02             	or     $0x2,%ecx
+  8021e0:	f6 c2 02             	test   $0x2,%dl
+  8021e3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021e6:	89 c1                	mov    %eax,%ecx
+  8021e8:	83 c9 01             	or     $0x1,%ecx
+  8021eb:	48 85 d2             	test   %rdx,%rdx
+  8021ee:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021f1:	89 c1                	mov    %eax,%ecx
+  8021f3:	83 c9 40             	or     $0x40,%ecx
+  8021f6:	f6 c6 04             	test   $0x4,%dh
+  8021f9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+
+00000000008021fe <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021fe:	55                   	push   %rbp
+  8021ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802202:	48 b8 04 21 80 00 00 	movabs $0x802104,%rax
+  802209:	00 00 00 
+  80220c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80220e:	48 c1 e8 06          	shr    $0x6,%rax
+  802212:	83 e0 01             	and    $0x1,%eax
+}
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+
+0000000000802217 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80221b:	48 b8 04 21 80 00 00 	movabs $0x802104,%rax
+  802222:	00 00 00 
+  802225:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802227:	48 c1 e8 05          	shr    $0x5,%rax
+  80222b:	83 e0 01             	and    $0x1,%eax
+}
+  80222e:	5d                   	pop    %rbp
+  80222f:	c3                   	ret
+
+0000000000802230 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802234:	48 b8 04 21 80 00 00 	movabs $0x802104,%rax
+  80223b:	00 00 00 
+  80223e:	ff d0                	call   *%rax
+  802240:	83 e0 01             	and    $0x1,%eax
+}
+  802243:	5d                   	pop    %rbp
+  802244:	c3                   	ret
+
+0000000000802245 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802245:	55                   	push   %rbp
+  802246:	48 89 e5             	mov    %rsp,%rbp
+  802249:	41 57                	push   %r15
+  80224b:	41 56                	push   %r14
+  80224d:	41 55                	push   %r13
+  80224f:	41 54                	push   %r12
+  802251:	53                   	push   %rbx
+  802252:	48 83 ec 18          	sub    $0x18,%rsp
+  802256:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80225a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80225e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802263:	49 bd 30 22 80 00 00 	movabs $0x802230,%r13
+  80226a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80226d:	49 bf b8 21 80 00 00 	movabs $0x8021b8,%r15
+  802274:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802277:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80227e:	00 00 00 
+  802281:	eb 0c                	jmp    80228f <foreach_shared_region+0x4a>
+  802283:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80228a:	4c 39 f3             	cmp    %r14,%rbx
+  80228d:	74 2e                	je     8022bd <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80228f:	48 89 df             	mov    %rbx,%rdi
+  802292:	41 ff d5             	call   *%r13
+  802295:	84 c0                	test   %al,%al
+  802297:	74 ea                	je     802283 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802299:	48 89 df             	mov    %rbx,%rdi
+  80229c:	41 ff d7             	call   *%r15
+  80229f:	a8 40                	test   $0x40,%al
+  8022a1:	74 e0                	je     802283 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022a3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8022aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ae:	48 89 df             	mov    %rbx,%rdi
+  8022b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022b5:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022b7:	85 c0                	test   %eax,%eax
+  8022b9:	79 c8                	jns    802283 <foreach_shared_region+0x3e>
+  8022bb:	eb 05                	jmp    8022c2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c2:	48 83 c4 18          	add    $0x18,%rsp
+  8022c6:	5b                   	pop    %rbx
+  8022c7:	41 5c                	pop    %r12
+  8022c9:	41 5d                	pop    %r13
+  8022cb:	41 5e                	pop    %r14
+  8022cd:	41 5f                	pop    %r15
+  8022cf:	5d                   	pop    %rbp
+  8022d0:	c3                   	ret
+
+00000000008022d1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d6:	c3                   	ret
+
+00000000008022d7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022d7:	55                   	push   %rbp
+  8022d8:	48 89 e5             	mov    %rsp,%rbp
+  8022db:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022de:	48 be f4 37 80 00 00 	movabs $0x8037f4,%rsi
+  8022e5:	00 00 00 
+  8022e8:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+    return 0;
+}
+  8022f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f9:	5d                   	pop    %rbp
+  8022fa:	c3                   	ret
+
+00000000008022fb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022fb:	55                   	push   %rbp
+  8022fc:	48 89 e5             	mov    %rsp,%rbp
+  8022ff:	41 57                	push   %r15
+  802301:	41 56                	push   %r14
+  802303:	41 55                	push   %r13
+  802305:	41 54                	push   %r12
+  802307:	53                   	push   %rbx
+  802308:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80230f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802316:	48 85 d2             	test   %rdx,%rdx
+  802319:	74 7a                	je     802395 <devcons_write+0x9a>
+  80231b:	49 89 d6             	mov    %rdx,%r14
+  80231e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802324:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802329:	49 bf 6b 31 80 00 00 	movabs $0x80316b,%r15
+  802330:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802333:	4c 89 f3             	mov    %r14,%rbx
+  802336:	48 29 f3             	sub    %rsi,%rbx
+  802339:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80233e:	48 39 c3             	cmp    %rax,%rbx
+  802341:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802345:	4c 63 eb             	movslq %ebx,%r13
+  802348:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80234f:	48 01 c6             	add    %rax,%rsi
+  802352:	4c 89 ea             	mov    %r13,%rdx
+  802355:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80235c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80235f:	4c 89 ee             	mov    %r13,%rsi
+  802362:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802369:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802375:	41 01 dc             	add    %ebx,%r12d
+  802378:	49 63 f4             	movslq %r12d,%rsi
+  80237b:	4c 39 f6             	cmp    %r14,%rsi
+  80237e:	72 b3                	jb     802333 <devcons_write+0x38>
+    return res;
+  802380:	49 63 c4             	movslq %r12d,%rax
+}
+  802383:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80238a:	5b                   	pop    %rbx
+  80238b:	41 5c                	pop    %r12
+  80238d:	41 5d                	pop    %r13
+  80238f:	41 5e                	pop    %r14
+  802391:	41 5f                	pop    %r15
+  802393:	5d                   	pop    %rbp
+  802394:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802395:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80239b:	eb e3                	jmp    802380 <devcons_write+0x85>
+
+000000000080239d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80239d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a5:	48 85 c0             	test   %rax,%rax
+  8023a8:	74 55                	je     8023ff <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023aa:	55                   	push   %rbp
+  8023ab:	48 89 e5             	mov    %rsp,%rbp
+  8023ae:	41 55                	push   %r13
+  8023b0:	41 54                	push   %r12
+  8023b2:	53                   	push   %rbx
+  8023b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023ba:	48 bb 3f 01 80 00 00 	movabs $0x80013f,%rbx
+  8023c1:	00 00 00 
+  8023c4:	49 bc 0c 02 80 00 00 	movabs $0x80020c,%r12
+  8023cb:	00 00 00 
+  8023ce:	eb 03                	jmp    8023d3 <devcons_read+0x36>
+  8023d0:	41 ff d4             	call   *%r12
+  8023d3:	ff d3                	call   *%rbx
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	74 f7                	je     8023d0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023d9:	48 63 d0             	movslq %eax,%rdx
+  8023dc:	78 13                	js     8023f1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	83 f8 04             	cmp    $0x4,%eax
+  8023e6:	74 09                	je     8023f1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023e8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023ec:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023f1:	48 89 d0             	mov    %rdx,%rax
+  8023f4:	48 83 c4 08          	add    $0x8,%rsp
+  8023f8:	5b                   	pop    %rbx
+  8023f9:	41 5c                	pop    %r12
+  8023fb:	41 5d                	pop    %r13
+  8023fd:	5d                   	pop    %rbp
+  8023fe:	c3                   	ret
+  8023ff:	48 89 d0             	mov    %rdx,%rax
+  802402:	c3                   	ret
+
+0000000000802403 <cputchar>:
+cputchar(int ch) {
+  802403:	55                   	push   %rbp
+  802404:	48 89 e5             	mov    %rsp,%rbp
+  802407:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80240b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80240f:	be 01 00 00 00       	mov    $0x1,%esi
+  802414:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802418:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+}
+  802424:	c9                   	leave
+  802425:	c3                   	ret
+
+0000000000802426 <getchar>:
+getchar(void) {
+  802426:	55                   	push   %rbp
+  802427:	48 89 e5             	mov    %rsp,%rbp
+  80242a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80242e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802433:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802437:	bf 00 00 00 00       	mov    $0x0,%edi
+  80243c:	48 b8 dc 09 80 00 00 	movabs $0x8009dc,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+  802448:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80244a:	85 c0                	test   %eax,%eax
+  80244c:	78 06                	js     802454 <getchar+0x2e>
+  80244e:	74 08                	je     802458 <getchar+0x32>
+  802450:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802454:	89 d0                	mov    %edx,%eax
+  802456:	c9                   	leave
+  802457:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802458:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80245d:	eb f5                	jmp    802454 <getchar+0x2e>
+
+000000000080245f <iscons>:
+iscons(int fdnum) {
+  80245f:	55                   	push   %rbp
+  802460:	48 89 e5             	mov    %rsp,%rbp
+  802463:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802467:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80246b:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802477:	85 c0                	test   %eax,%eax
+  802479:	78 18                	js     802493 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80247b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80247f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802486:	00 00 00 
+  802489:	8b 00                	mov    (%rax),%eax
+  80248b:	39 02                	cmp    %eax,(%rdx)
+  80248d:	0f 94 c0             	sete   %al
+  802490:	0f b6 c0             	movzbl %al,%eax
+}
+  802493:	c9                   	leave
+  802494:	c3                   	ret
+
+0000000000802495 <opencons>:
+opencons(void) {
+  802495:	55                   	push   %rbp
+  802496:	48 89 e5             	mov    %rsp,%rbp
+  802499:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80249d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024a1:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  8024a8:	00 00 00 
+  8024ab:	ff d0                	call   *%rax
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	78 49                	js     8024fa <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024b1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024bb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c4:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8024cb:	00 00 00 
+  8024ce:	ff d0                	call   *%rax
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 26                	js     8024fa <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024d8:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024df:	00 00 
+  8024e1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024e3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024e7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024ee:	48 b8 6b 06 80 00 00 	movabs $0x80066b,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+
+00000000008024fc <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024fc:	55                   	push   %rbp
+  8024fd:	48 89 e5             	mov    %rsp,%rbp
+  802500:	41 56                	push   %r14
+  802502:	41 55                	push   %r13
+  802504:	41 54                	push   %r12
+  802506:	53                   	push   %rbx
+  802507:	48 83 ec 50          	sub    $0x50,%rsp
+  80250b:	49 89 fc             	mov    %rdi,%r12
+  80250e:	41 89 f5             	mov    %esi,%r13d
+  802511:	48 89 d3             	mov    %rdx,%rbx
+  802514:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802518:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80251c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802520:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802527:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80252b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80252f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802533:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802537:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80253e:	00 00 00 
+  802541:	4c 8b 30             	mov    (%rax),%r14
+  802544:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	89 c6                	mov    %eax,%esi
+  802552:	45 89 e8             	mov    %r13d,%r8d
+  802555:	4c 89 e1             	mov    %r12,%rcx
+  802558:	4c 89 f2             	mov    %r14,%rdx
+  80255b:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  802562:	00 00 00 
+  802565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256a:	49 bc 4c 26 80 00 00 	movabs $0x80264c,%r12
+  802571:	00 00 00 
+  802574:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802577:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80257b:	48 89 df             	mov    %rbx,%rdi
+  80257e:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+    cprintf("\n");
+  80258a:	48 bf 4b 37 80 00 00 	movabs $0x80374b,%rdi
+  802591:	00 00 00 
+  802594:	b8 00 00 00 00       	mov    $0x0,%eax
+  802599:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80259c:	cc                   	int3
+  80259d:	eb fd                	jmp    80259c <_panic+0xa0>
+
+000000000080259f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	53                   	push   %rbx
+  8025a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025ab:	8b 06                	mov    (%rsi),%eax
+  8025ad:	8d 50 01             	lea    0x1(%rax),%edx
+  8025b0:	89 16                	mov    %edx,(%rsi)
+  8025b2:	48 98                	cltq
+  8025b4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025b9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025bf:	74 0a                	je     8025cb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025c1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025c9:	c9                   	leave
+  8025ca:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025cb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025cf:	be ff 00 00 00       	mov    $0xff,%esi
+  8025d4:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  8025db:	00 00 00 
+  8025de:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025e0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025e6:	eb d9                	jmp    8025c1 <putch+0x22>
+
+00000000008025e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025e8:	55                   	push   %rbp
+  8025e9:	48 89 e5             	mov    %rsp,%rbp
+  8025ec:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025f3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025f6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025fd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802602:	b8 00 00 00 00       	mov    $0x0,%eax
+  802607:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80260a:	48 89 f1             	mov    %rsi,%rcx
+  80260d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802614:	48 bf 9f 25 80 00 00 	movabs $0x80259f,%rdi
+  80261b:	00 00 00 
+  80261e:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80262a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802631:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802638:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802644:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80264a:	c9                   	leave
+  80264b:	c3                   	ret
+
+000000000080264c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80264c:	55                   	push   %rbp
+  80264d:	48 89 e5             	mov    %rsp,%rbp
+  802650:	48 83 ec 50          	sub    $0x50,%rsp
+  802654:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802658:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80265c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802660:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802664:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802668:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80266f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802673:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802677:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80267b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80267f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802683:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  80268a:	00 00 00 
+  80268d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80268f:	c9                   	leave
+  802690:	c3                   	ret
+
+0000000000802691 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802691:	55                   	push   %rbp
+  802692:	48 89 e5             	mov    %rsp,%rbp
+  802695:	41 57                	push   %r15
+  802697:	41 56                	push   %r14
+  802699:	41 55                	push   %r13
+  80269b:	41 54                	push   %r12
+  80269d:	53                   	push   %rbx
+  80269e:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a2:	49 89 fc             	mov    %rdi,%r12
+  8026a5:	49 89 f5             	mov    %rsi,%r13
+  8026a8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026ac:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026af:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026b2:	41 89 cf             	mov    %ecx,%r15d
+  8026b5:	4c 39 fa             	cmp    %r15,%rdx
+  8026b8:	73 5b                	jae    802715 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026ba:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026be:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026c2:	85 db                	test   %ebx,%ebx
+  8026c4:	7e 0e                	jle    8026d4 <print_num+0x43>
+            putch(padc, put_arg);
+  8026c6:	4c 89 ee             	mov    %r13,%rsi
+  8026c9:	44 89 f7             	mov    %r14d,%edi
+  8026cc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026cf:	83 eb 01             	sub    $0x1,%ebx
+  8026d2:	75 f2                	jne    8026c6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026d4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026d8:	48 b9 34 38 80 00 00 	movabs $0x803834,%rcx
+  8026df:	00 00 00 
+  8026e2:	48 b8 23 38 80 00 00 	movabs $0x803823,%rax
+  8026e9:	00 00 00 
+  8026ec:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f9:	49 f7 f7             	div    %r15
+  8026fc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802700:	4c 89 ee             	mov    %r13,%rsi
+  802703:	41 ff d4             	call   *%r12
+}
+  802706:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80270a:	5b                   	pop    %rbx
+  80270b:	41 5c                	pop    %r12
+  80270d:	41 5d                	pop    %r13
+  80270f:	41 5e                	pop    %r14
+  802711:	41 5f                	pop    %r15
+  802713:	5d                   	pop    %rbp
+  802714:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802715:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271e:	49 f7 f7             	div    %r15
+  802721:	48 83 ec 08          	sub    $0x8,%rsp
+  802725:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802729:	52                   	push   %rdx
+  80272a:	45 0f be c9          	movsbl %r9b,%r9d
+  80272e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802732:	48 89 c2             	mov    %rax,%rdx
+  802735:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  80273c:	00 00 00 
+  80273f:	ff d0                	call   *%rax
+  802741:	48 83 c4 10          	add    $0x10,%rsp
+  802745:	eb 8d                	jmp    8026d4 <print_num+0x43>
+
+0000000000802747 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802747:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80274b:	48 8b 06             	mov    (%rsi),%rax
+  80274e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802752:	73 0a                	jae    80275e <sprintputch+0x17>
+        *state->start++ = ch;
+  802754:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802758:	48 89 16             	mov    %rdx,(%rsi)
+  80275b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80275e:	c3                   	ret
+
+000000000080275f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80275f:	55                   	push   %rbp
+  802760:	48 89 e5             	mov    %rsp,%rbp
+  802763:	48 83 ec 50          	sub    $0x50,%rsp
+  802767:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80276b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80276f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802773:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80277a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80277e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802782:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802786:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80278a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80278e:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802795:	00 00 00 
+  802798:	ff d0                	call   *%rax
+}
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+000000000080279c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+  8027a0:	41 57                	push   %r15
+  8027a2:	41 56                	push   %r14
+  8027a4:	41 55                	push   %r13
+  8027a6:	41 54                	push   %r12
+  8027a8:	53                   	push   %rbx
+  8027a9:	48 83 ec 38          	sub    $0x38,%rsp
+  8027ad:	49 89 fe             	mov    %rdi,%r14
+  8027b0:	49 89 f5             	mov    %rsi,%r13
+  8027b3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027b6:	48 8b 01             	mov    (%rcx),%rax
+  8027b9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027bd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027c5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027cd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027d1:	0f b6 3b             	movzbl (%rbx),%edi
+  8027d4:	40 80 ff 25          	cmp    $0x25,%dil
+  8027d8:	74 18                	je     8027f2 <vprintfmt+0x56>
+            if (!ch) return;
+  8027da:	40 84 ff             	test   %dil,%dil
+  8027dd:	0f 84 b1 06 00 00    	je     802e94 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027e3:	40 0f b6 ff          	movzbl %dil,%edi
+  8027e7:	4c 89 ee             	mov    %r13,%rsi
+  8027ea:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027ed:	4c 89 e3             	mov    %r12,%rbx
+  8027f0:	eb db                	jmp    8027cd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027fb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802800:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802806:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80280d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802811:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802816:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80281b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80281e:	83 e8 23             	sub    $0x23,%eax
+  802821:	3c 57                	cmp    $0x57,%al
+  802823:	0f 87 51 06 00 00    	ja     802e7a <vprintfmt+0x6de>
+  802829:	0f b6 c0             	movzbl %al,%eax
+  80282c:	48 b9 c0 39 80 00 00 	movabs $0x8039c0,%rcx
+  802833:	00 00 00 
+  802836:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802839:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80283c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802840:	eb cf                	jmp    802811 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802842:	49 89 dc             	mov    %rbx,%r12
+  802845:	be 01 00 00 00       	mov    $0x1,%esi
+  80284a:	eb c5                	jmp    802811 <vprintfmt+0x75>
+            padc = ch;
+  80284c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802850:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802853:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802856:	eb b9                	jmp    802811 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802858:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80285b:	83 f8 2f             	cmp    $0x2f,%eax
+  80285e:	77 24                	ja     802884 <vprintfmt+0xe8>
+  802860:	89 c1                	mov    %eax,%ecx
+  802862:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802866:	83 c0 08             	add    $0x8,%eax
+  802869:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80286c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80286f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802872:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802876:	79 99                	jns    802811 <vprintfmt+0x75>
+                width = precision;
+  802878:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80287c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802882:	eb 8d                	jmp    802811 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802884:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802888:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80288c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802890:	eb da                	jmp    80286c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802892:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802897:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80289b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028a1:	3c 39                	cmp    $0x39,%al
+  8028a3:	77 1c                	ja     8028c1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8028a5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8028a9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028ad:	0f b6 c0             	movzbl %al,%eax
+  8028b0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028b5:	0f b6 03             	movzbl (%rbx),%eax
+  8028b8:	3c 39                	cmp    $0x39,%al
+  8028ba:	76 e9                	jbe    8028a5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028bc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028bf:	eb b1                	jmp    802872 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028c1:	49 89 dc             	mov    %rbx,%r12
+  8028c4:	eb ac                	jmp    802872 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028c6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028c9:	85 c9                	test   %ecx,%ecx
+  8028cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d0:	0f 49 c1             	cmovns %ecx,%eax
+  8028d3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028d6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028d9:	e9 33 ff ff ff       	jmp    802811 <vprintfmt+0x75>
+            lflag++;
+  8028de:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028e1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028e4:	e9 28 ff ff ff       	jmp    802811 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8028ef:	77 19                	ja     80290a <vprintfmt+0x16e>
+  8028f1:	89 c2                	mov    %eax,%edx
+  8028f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028f7:	83 c0 08             	add    $0x8,%eax
+  8028fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028fd:	8b 3a                	mov    (%rdx),%edi
+  8028ff:	4c 89 ee             	mov    %r13,%rsi
+  802902:	41 ff d6             	call   *%r14
+            break;
+  802905:	e9 c3 fe ff ff       	jmp    8027cd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80290a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80290e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802912:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802916:	eb e5                	jmp    8028fd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80291b:	83 f8 2f             	cmp    $0x2f,%eax
+  80291e:	77 5a                	ja     80297a <vprintfmt+0x1de>
+  802920:	89 c2                	mov    %eax,%edx
+  802922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802926:	83 c0 08             	add    $0x8,%eax
+  802929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80292c:	8b 02                	mov    (%rdx),%eax
+  80292e:	89 c1                	mov    %eax,%ecx
+  802930:	f7 d9                	neg    %ecx
+  802932:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802935:	83 f9 14             	cmp    $0x14,%ecx
+  802938:	7f 4e                	jg     802988 <vprintfmt+0x1ec>
+  80293a:	48 63 c1             	movslq %ecx,%rax
+  80293d:	48 ba 80 3c 80 00 00 	movabs $0x803c80,%rdx
+  802944:	00 00 00 
+  802947:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80294b:	48 85 c0             	test   %rax,%rax
+  80294e:	74 38                	je     802988 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802950:	48 89 c1             	mov    %rax,%rcx
+  802953:	48 ba b9 37 80 00 00 	movabs $0x8037b9,%rdx
+  80295a:	00 00 00 
+  80295d:	4c 89 ee             	mov    %r13,%rsi
+  802960:	4c 89 f7             	mov    %r14,%rdi
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+  802968:	49 b8 5f 27 80 00 00 	movabs $0x80275f,%r8
+  80296f:	00 00 00 
+  802972:	41 ff d0             	call   *%r8
+  802975:	e9 53 fe ff ff       	jmp    8027cd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80297a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80297e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802986:	eb a4                	jmp    80292c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802988:	48 ba 4c 38 80 00 00 	movabs $0x80384c,%rdx
+  80298f:	00 00 00 
+  802992:	4c 89 ee             	mov    %r13,%rsi
+  802995:	4c 89 f7             	mov    %r14,%rdi
+  802998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299d:	49 b8 5f 27 80 00 00 	movabs $0x80275f,%r8
+  8029a4:	00 00 00 
+  8029a7:	41 ff d0             	call   *%r8
+  8029aa:	e9 1e fe ff ff       	jmp    8027cd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8029b5:	77 6c                	ja     802a23 <vprintfmt+0x287>
+  8029b7:	89 c2                	mov    %eax,%edx
+  8029b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029bd:	83 c0 08             	add    $0x8,%eax
+  8029c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029c3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029c6:	48 85 d2             	test   %rdx,%rdx
+  8029c9:	48 b8 45 38 80 00 00 	movabs $0x803845,%rax
+  8029d0:	00 00 00 
+  8029d3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029d7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029db:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029df:	7e 06                	jle    8029e7 <vprintfmt+0x24b>
+  8029e1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029e5:	75 4a                	jne    802a31 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029e7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029eb:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029ef:	0f b6 00             	movzbl (%rax),%eax
+  8029f2:	84 c0                	test   %al,%al
+  8029f4:	0f 85 9a 00 00 00    	jne    802a94 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029fa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029fd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a01:	85 c0                	test   %eax,%eax
+  802a03:	0f 8e c4 fd ff ff    	jle    8027cd <vprintfmt+0x31>
+  802a09:	4c 89 ee             	mov    %r13,%rsi
+  802a0c:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a11:	41 ff d6             	call   *%r14
+  802a14:	41 83 ec 01          	sub    $0x1,%r12d
+  802a18:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a1c:	75 eb                	jne    802a09 <vprintfmt+0x26d>
+  802a1e:	e9 aa fd ff ff       	jmp    8027cd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a2f:	eb 92                	jmp    8029c3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a31:	49 63 f7             	movslq %r15d,%rsi
+  802a34:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a38:	48 b8 4e 2f 80 00 00 	movabs $0x802f4e,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	48 89 c2             	mov    %rax,%rdx
+  802a47:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a4a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a4c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a4f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	7e 91                	jle    8029e7 <vprintfmt+0x24b>
+  802a56:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a5b:	4c 89 ee             	mov    %r13,%rsi
+  802a5e:	44 89 e7             	mov    %r12d,%edi
+  802a61:	41 ff d6             	call   *%r14
+  802a64:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a68:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a6b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a6e:	75 eb                	jne    802a5b <vprintfmt+0x2bf>
+  802a70:	e9 72 ff ff ff       	jmp    8029e7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a75:	0f b6 f8             	movzbl %al,%edi
+  802a78:	4c 89 ee             	mov    %r13,%rsi
+  802a7b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a7e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a82:	49 83 c4 01          	add    $0x1,%r12
+  802a86:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a8c:	84 c0                	test   %al,%al
+  802a8e:	0f 84 66 ff ff ff    	je     8029fa <vprintfmt+0x25e>
+  802a94:	45 85 ff             	test   %r15d,%r15d
+  802a97:	78 0a                	js     802aa3 <vprintfmt+0x307>
+  802a99:	41 83 ef 01          	sub    $0x1,%r15d
+  802a9d:	0f 88 57 ff ff ff    	js     8029fa <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802aa3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802aa7:	74 cc                	je     802a75 <vprintfmt+0x2d9>
+  802aa9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802aac:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ab1:	80 fa 5e             	cmp    $0x5e,%dl
+  802ab4:	77 c2                	ja     802a78 <vprintfmt+0x2dc>
+  802ab6:	eb bd                	jmp    802a75 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802ab8:	40 84 f6             	test   %sil,%sil
+  802abb:	75 26                	jne    802ae3 <vprintfmt+0x347>
+    switch (lflag) {
+  802abd:	85 d2                	test   %edx,%edx
+  802abf:	74 59                	je     802b1a <vprintfmt+0x37e>
+  802ac1:	83 fa 01             	cmp    $0x1,%edx
+  802ac4:	74 7b                	je     802b41 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802ac6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ac9:	83 f8 2f             	cmp    $0x2f,%eax
+  802acc:	0f 87 96 00 00 00    	ja     802b68 <vprintfmt+0x3cc>
+  802ad2:	89 c2                	mov    %eax,%edx
+  802ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ad8:	83 c0 08             	add    $0x8,%eax
+  802adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ade:	4c 8b 22             	mov    (%rdx),%r12
+  802ae1:	eb 17                	jmp    802afa <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  802ae9:	77 21                	ja     802b0c <vprintfmt+0x370>
+  802aeb:	89 c2                	mov    %eax,%edx
+  802aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802af1:	83 c0 08             	add    $0x8,%eax
+  802af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802af7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802afa:	4d 85 e4             	test   %r12,%r12
+  802afd:	78 7a                	js     802b79 <vprintfmt+0x3dd>
+            num = i;
+  802aff:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b07:	e9 50 02 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b18:	eb dd                	jmp    802af7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b1d:	83 f8 2f             	cmp    $0x2f,%eax
+  802b20:	77 11                	ja     802b33 <vprintfmt+0x397>
+  802b22:	89 c2                	mov    %eax,%edx
+  802b24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b28:	83 c0 08             	add    $0x8,%eax
+  802b2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b2e:	4c 63 22             	movslq (%rdx),%r12
+  802b31:	eb c7                	jmp    802afa <vprintfmt+0x35e>
+  802b33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b3f:	eb ed                	jmp    802b2e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b44:	83 f8 2f             	cmp    $0x2f,%eax
+  802b47:	77 11                	ja     802b5a <vprintfmt+0x3be>
+  802b49:	89 c2                	mov    %eax,%edx
+  802b4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b4f:	83 c0 08             	add    $0x8,%eax
+  802b52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b55:	4c 8b 22             	mov    (%rdx),%r12
+  802b58:	eb a0                	jmp    802afa <vprintfmt+0x35e>
+  802b5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b66:	eb ed                	jmp    802b55 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b74:	e9 65 ff ff ff       	jmp    802ade <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b79:	4c 89 ee             	mov    %r13,%rsi
+  802b7c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b81:	41 ff d6             	call   *%r14
+                i = -i;
+  802b84:	49 f7 dc             	neg    %r12
+  802b87:	e9 73 ff ff ff       	jmp    802aff <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b8c:	40 84 f6             	test   %sil,%sil
+  802b8f:	75 32                	jne    802bc3 <vprintfmt+0x427>
+    switch (lflag) {
+  802b91:	85 d2                	test   %edx,%edx
+  802b93:	74 5d                	je     802bf2 <vprintfmt+0x456>
+  802b95:	83 fa 01             	cmp    $0x1,%edx
+  802b98:	0f 84 82 00 00 00    	je     802c20 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ba1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ba4:	0f 87 a5 00 00 00    	ja     802c4f <vprintfmt+0x4b3>
+  802baa:	89 c2                	mov    %eax,%edx
+  802bac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb0:	83 c0 08             	add    $0x8,%eax
+  802bb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bb6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bb9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bbe:	e9 99 01 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  802bc9:	77 19                	ja     802be4 <vprintfmt+0x448>
+  802bcb:	89 c2                	mov    %eax,%edx
+  802bcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bd1:	83 c0 08             	add    $0x8,%eax
+  802bd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bd7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bda:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bdf:	e9 78 01 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+  802be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf0:	eb e5                	jmp    802bd7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bf5:	83 f8 2f             	cmp    $0x2f,%eax
+  802bf8:	77 18                	ja     802c12 <vprintfmt+0x476>
+  802bfa:	89 c2                	mov    %eax,%edx
+  802bfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c00:	83 c0 08             	add    $0x8,%eax
+  802c03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c06:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c0d:	e9 4a 01 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+  802c12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c1e:	eb e6                	jmp    802c06 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c23:	83 f8 2f             	cmp    $0x2f,%eax
+  802c26:	77 19                	ja     802c41 <vprintfmt+0x4a5>
+  802c28:	89 c2                	mov    %eax,%edx
+  802c2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c2e:	83 c0 08             	add    $0x8,%eax
+  802c31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c34:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c3c:	e9 1b 01 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+  802c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c4d:	eb e5                	jmp    802c34 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c5b:	e9 56 ff ff ff       	jmp    802bb6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c60:	40 84 f6             	test   %sil,%sil
+  802c63:	75 2e                	jne    802c93 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c65:	85 d2                	test   %edx,%edx
+  802c67:	74 59                	je     802cc2 <vprintfmt+0x526>
+  802c69:	83 fa 01             	cmp    $0x1,%edx
+  802c6c:	74 7f                	je     802ced <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c71:	83 f8 2f             	cmp    $0x2f,%eax
+  802c74:	0f 87 9f 00 00 00    	ja     802d19 <vprintfmt+0x57d>
+  802c7a:	89 c2                	mov    %eax,%edx
+  802c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c80:	83 c0 08             	add    $0x8,%eax
+  802c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c89:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c8e:	e9 c9 00 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c96:	83 f8 2f             	cmp    $0x2f,%eax
+  802c99:	77 19                	ja     802cb4 <vprintfmt+0x518>
+  802c9b:	89 c2                	mov    %eax,%edx
+  802c9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ca1:	83 c0 08             	add    $0x8,%eax
+  802ca4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ca7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802caa:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802caf:	e9 a8 00 00 00       	jmp    802d5c <vprintfmt+0x5c0>
+  802cb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc0:	eb e5                	jmp    802ca7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cc5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cc8:	77 15                	ja     802cdf <vprintfmt+0x543>
+  802cca:	89 c2                	mov    %eax,%edx
+  802ccc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd0:	83 c0 08             	add    $0x8,%eax
+  802cd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cd6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cdd:	eb 7d                	jmp    802d5c <vprintfmt+0x5c0>
+  802cdf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ce3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ce7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ceb:	eb e9                	jmp    802cd6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802ced:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf0:	83 f8 2f             	cmp    $0x2f,%eax
+  802cf3:	77 16                	ja     802d0b <vprintfmt+0x56f>
+  802cf5:	89 c2                	mov    %eax,%edx
+  802cf7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cfb:	83 c0 08             	add    $0x8,%eax
+  802cfe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d04:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d09:	eb 51                	jmp    802d5c <vprintfmt+0x5c0>
+  802d0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d17:	eb e8                	jmp    802d01 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d25:	e9 5c ff ff ff       	jmp    802c86 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d2a:	4c 89 ee             	mov    %r13,%rsi
+  802d2d:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d32:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d35:	4c 89 ee             	mov    %r13,%rsi
+  802d38:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d3d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d43:	83 f8 2f             	cmp    $0x2f,%eax
+  802d46:	77 47                	ja     802d8f <vprintfmt+0x5f3>
+  802d48:	89 c2                	mov    %eax,%edx
+  802d4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d4e:	83 c0 08             	add    $0x8,%eax
+  802d51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d57:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d5c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d60:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d64:	0f 94 c0             	sete   %al
+  802d67:	0f b6 c0             	movzbl %al,%eax
+  802d6a:	50                   	push   %rax
+  802d6b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d70:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d74:	4c 89 ee             	mov    %r13,%rsi
+  802d77:	4c 89 f7             	mov    %r14,%rdi
+  802d7a:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+            break;
+  802d86:	48 83 c4 10          	add    $0x10,%rsp
+  802d8a:	e9 3e fa ff ff       	jmp    8027cd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d9b:	eb b7                	jmp    802d54 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d9d:	40 84 f6             	test   %sil,%sil
+  802da0:	75 2b                	jne    802dcd <vprintfmt+0x631>
+    switch (lflag) {
+  802da2:	85 d2                	test   %edx,%edx
+  802da4:	74 56                	je     802dfc <vprintfmt+0x660>
+  802da6:	83 fa 01             	cmp    $0x1,%edx
+  802da9:	74 7f                	je     802e2a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802dab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dae:	83 f8 2f             	cmp    $0x2f,%eax
+  802db1:	0f 87 a2 00 00 00    	ja     802e59 <vprintfmt+0x6bd>
+  802db7:	89 c2                	mov    %eax,%edx
+  802db9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dbd:	83 c0 08             	add    $0x8,%eax
+  802dc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dcb:	eb 8f                	jmp    802d5c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dd0:	83 f8 2f             	cmp    $0x2f,%eax
+  802dd3:	77 19                	ja     802dee <vprintfmt+0x652>
+  802dd5:	89 c2                	mov    %eax,%edx
+  802dd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ddb:	83 c0 08             	add    $0x8,%eax
+  802dde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802de1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802de4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802de9:	e9 6e ff ff ff       	jmp    802d5c <vprintfmt+0x5c0>
+  802dee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802df2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802df6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dfa:	eb e5                	jmp    802de1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dff:	83 f8 2f             	cmp    $0x2f,%eax
+  802e02:	77 18                	ja     802e1c <vprintfmt+0x680>
+  802e04:	89 c2                	mov    %eax,%edx
+  802e06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e0a:	83 c0 08             	add    $0x8,%eax
+  802e0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e10:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e17:	e9 40 ff ff ff       	jmp    802d5c <vprintfmt+0x5c0>
+  802e1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e28:	eb e6                	jmp    802e10 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e2d:	83 f8 2f             	cmp    $0x2f,%eax
+  802e30:	77 19                	ja     802e4b <vprintfmt+0x6af>
+  802e32:	89 c2                	mov    %eax,%edx
+  802e34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e38:	83 c0 08             	add    $0x8,%eax
+  802e3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e41:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e46:	e9 11 ff ff ff       	jmp    802d5c <vprintfmt+0x5c0>
+  802e4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e57:	eb e5                	jmp    802e3e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e65:	e9 59 ff ff ff       	jmp    802dc3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e6a:	4c 89 ee             	mov    %r13,%rsi
+  802e6d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e72:	41 ff d6             	call   *%r14
+            break;
+  802e75:	e9 53 f9 ff ff       	jmp    8027cd <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e7a:	4c 89 ee             	mov    %r13,%rsi
+  802e7d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e82:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e85:	48 83 eb 01          	sub    $0x1,%rbx
+  802e89:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e8d:	75 f6                	jne    802e85 <vprintfmt+0x6e9>
+  802e8f:	e9 39 f9 ff ff       	jmp    8027cd <vprintfmt+0x31>
+}
+  802e94:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e98:	5b                   	pop    %rbx
+  802e99:	41 5c                	pop    %r12
+  802e9b:	41 5d                	pop    %r13
+  802e9d:	41 5e                	pop    %r14
+  802e9f:	41 5f                	pop    %r15
+  802ea1:	5d                   	pop    %rbp
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+  802ea7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802eab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eaf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802eb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802eb8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ebf:	48 85 ff             	test   %rdi,%rdi
+  802ec2:	74 2b                	je     802eef <vsnprintf+0x4c>
+  802ec4:	48 85 f6             	test   %rsi,%rsi
+  802ec7:	74 26                	je     802eef <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ec9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ecd:	48 bf 47 27 80 00 00 	movabs $0x802747,%rdi
+  802ed4:	00 00 00 
+  802ed7:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802ede:	00 00 00 
+  802ee1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ee7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802eea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802eed:	c9                   	leave
+  802eee:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802eef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef4:	eb f7                	jmp    802eed <vsnprintf+0x4a>
+
+0000000000802ef6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802ef6:	55                   	push   %rbp
+  802ef7:	48 89 e5             	mov    %rsp,%rbp
+  802efa:	48 83 ec 50          	sub    $0x50,%rsp
+  802efe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f02:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f06:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f0a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f11:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f19:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f1d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f21:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f25:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+0000000000802f33 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f33:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f36:	74 10                	je     802f48 <strlen+0x15>
+    size_t n = 0;
+  802f38:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f3d:	48 83 c0 01          	add    $0x1,%rax
+  802f41:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f45:	75 f6                	jne    802f3d <strlen+0xa>
+  802f47:	c3                   	ret
+    size_t n = 0;
+  802f48:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f4d:	c3                   	ret
+
+0000000000802f4e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f4e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f51:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f56:	48 85 f6             	test   %rsi,%rsi
+  802f59:	74 11                	je     802f6c <strnlen+0x1e>
+  802f5b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f5f:	74 0c                	je     802f6d <strnlen+0x1f>
+  802f61:	48 83 c2 01          	add    $0x1,%rdx
+  802f65:	48 39 d0             	cmp    %rdx,%rax
+  802f68:	75 f1                	jne    802f5b <strnlen+0xd>
+  802f6a:	eb 04                	jmp    802f70 <strnlen+0x22>
+  802f6c:	c3                   	ret
+  802f6d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f70:	c3                   	ret
+
+0000000000802f71 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f71:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f79:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f7d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f80:	48 83 c2 01          	add    $0x1,%rdx
+  802f84:	84 c9                	test   %cl,%cl
+  802f86:	75 f1                	jne    802f79 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f88:	c3                   	ret
+
+0000000000802f89 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f89:	55                   	push   %rbp
+  802f8a:	48 89 e5             	mov    %rsp,%rbp
+  802f8d:	41 54                	push   %r12
+  802f8f:	53                   	push   %rbx
+  802f90:	48 89 fb             	mov    %rdi,%rbx
+  802f93:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f96:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  802f9d:	00 00 00 
+  802fa0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802fa2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802fa6:	4c 89 e6             	mov    %r12,%rsi
+  802fa9:	48 b8 71 2f 80 00 00 	movabs $0x802f71,%rax
+  802fb0:	00 00 00 
+  802fb3:	ff d0                	call   *%rax
+    return dst;
+}
+  802fb5:	48 89 d8             	mov    %rbx,%rax
+  802fb8:	5b                   	pop    %rbx
+  802fb9:	41 5c                	pop    %r12
+  802fbb:	5d                   	pop    %rbp
+  802fbc:	c3                   	ret
+
+0000000000802fbd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fbd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fc0:	48 85 d2             	test   %rdx,%rdx
+  802fc3:	74 1f                	je     802fe4 <strncpy+0x27>
+  802fc5:	48 01 fa             	add    %rdi,%rdx
+  802fc8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fcb:	48 83 c1 01          	add    $0x1,%rcx
+  802fcf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fd3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fd7:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fdb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fdf:	48 39 ca             	cmp    %rcx,%rdx
+  802fe2:	75 e7                	jne    802fcb <strncpy+0xe>
+    }
+    return ret;
+}
+  802fe4:	c3                   	ret
+
+0000000000802fe5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fe5:	48 89 f8             	mov    %rdi,%rax
+  802fe8:	48 85 d2             	test   %rdx,%rdx
+  802feb:	74 24                	je     803011 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fed:	48 83 ea 01          	sub    $0x1,%rdx
+  802ff1:	74 1b                	je     80300e <strlcpy+0x29>
+  802ff3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802ff7:	0f b6 16             	movzbl (%rsi),%edx
+  802ffa:	84 d2                	test   %dl,%dl
+  802ffc:	74 10                	je     80300e <strlcpy+0x29>
+            *dst++ = *src++;
+  802ffe:	48 83 c6 01          	add    $0x1,%rsi
+  803002:	48 83 c0 01          	add    $0x1,%rax
+  803006:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803009:	48 39 c8             	cmp    %rcx,%rax
+  80300c:	75 e9                	jne    802ff7 <strlcpy+0x12>
+        *dst = '\0';
+  80300e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803011:	48 29 f8             	sub    %rdi,%rax
+}
+  803014:	c3                   	ret
+
+0000000000803015 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803015:	0f b6 07             	movzbl (%rdi),%eax
+  803018:	84 c0                	test   %al,%al
+  80301a:	74 13                	je     80302f <strcmp+0x1a>
+  80301c:	38 06                	cmp    %al,(%rsi)
+  80301e:	75 0f                	jne    80302f <strcmp+0x1a>
+  803020:	48 83 c7 01          	add    $0x1,%rdi
+  803024:	48 83 c6 01          	add    $0x1,%rsi
+  803028:	0f b6 07             	movzbl (%rdi),%eax
+  80302b:	84 c0                	test   %al,%al
+  80302d:	75 ed                	jne    80301c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80302f:	0f b6 c0             	movzbl %al,%eax
+  803032:	0f b6 16             	movzbl (%rsi),%edx
+  803035:	29 d0                	sub    %edx,%eax
+}
+  803037:	c3                   	ret
+
+0000000000803038 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803038:	48 85 d2             	test   %rdx,%rdx
+  80303b:	74 1f                	je     80305c <strncmp+0x24>
+  80303d:	0f b6 07             	movzbl (%rdi),%eax
+  803040:	84 c0                	test   %al,%al
+  803042:	74 1e                	je     803062 <strncmp+0x2a>
+  803044:	3a 06                	cmp    (%rsi),%al
+  803046:	75 1a                	jne    803062 <strncmp+0x2a>
+  803048:	48 83 c7 01          	add    $0x1,%rdi
+  80304c:	48 83 c6 01          	add    $0x1,%rsi
+  803050:	48 83 ea 01          	sub    $0x1,%rdx
+  803054:	75 e7                	jne    80303d <strncmp+0x5>
+
+    if (!n) return 0;
+  803056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305b:	c3                   	ret
+  80305c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803061:	c3                   	ret
+  803062:	48 85 d2             	test   %rdx,%rdx
+  803065:	74 09                	je     803070 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803067:	0f b6 07             	movzbl (%rdi),%eax
+  80306a:	0f b6 16             	movzbl (%rsi),%edx
+  80306d:	29 d0                	sub    %edx,%eax
+  80306f:	c3                   	ret
+    if (!n) return 0;
+  803070:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803075:	c3                   	ret
+
+0000000000803076 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803076:	0f b6 17             	movzbl (%rdi),%edx
+  803079:	84 d2                	test   %dl,%dl
+  80307b:	74 18                	je     803095 <strchr+0x1f>
+        if (*str == c) {
+  80307d:	0f be d2             	movsbl %dl,%edx
+  803080:	39 f2                	cmp    %esi,%edx
+  803082:	74 17                	je     80309b <strchr+0x25>
+    for (; *str; str++) {
+  803084:	48 83 c7 01          	add    $0x1,%rdi
+  803088:	0f b6 17             	movzbl (%rdi),%edx
+  80308b:	84 d2                	test   %dl,%dl
+  80308d:	75 ee                	jne    80307d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80308f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803094:	c3                   	ret
+  803095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309a:	c3                   	ret
+  80309b:	48 89 f8             	mov    %rdi,%rax
+}
+  80309e:	c3                   	ret
+
+000000000080309f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80309f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030a2:	0f b6 17             	movzbl (%rdi),%edx
+  8030a5:	84 d2                	test   %dl,%dl
+  8030a7:	74 13                	je     8030bc <strfind+0x1d>
+  8030a9:	0f be d2             	movsbl %dl,%edx
+  8030ac:	39 f2                	cmp    %esi,%edx
+  8030ae:	74 0b                	je     8030bb <strfind+0x1c>
+  8030b0:	48 83 c0 01          	add    $0x1,%rax
+  8030b4:	0f b6 10             	movzbl (%rax),%edx
+  8030b7:	84 d2                	test   %dl,%dl
+  8030b9:	75 ee                	jne    8030a9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030bb:	c3                   	ret
+  8030bc:	c3                   	ret
+
+00000000008030bd <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030bd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030c0:	48 89 f8             	mov    %rdi,%rax
+  8030c3:	48 f7 d8             	neg    %rax
+  8030c6:	83 e0 07             	and    $0x7,%eax
+  8030c9:	49 89 d1             	mov    %rdx,%r9
+  8030cc:	49 29 c1             	sub    %rax,%r9
+  8030cf:	78 36                	js     803107 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030d1:	40 0f b6 c6          	movzbl %sil,%eax
+  8030d5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030dc:	01 01 01 
+  8030df:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030e3:	40 f6 c7 07          	test   $0x7,%dil
+  8030e7:	75 38                	jne    803121 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030e9:	4c 89 c9             	mov    %r9,%rcx
+  8030ec:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030f0:	74 0c                	je     8030fe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030f2:	fc                   	cld
+  8030f3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030f6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030fa:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030fe:	4d 85 c9             	test   %r9,%r9
+  803101:	75 45                	jne    803148 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803103:	4c 89 c0             	mov    %r8,%rax
+  803106:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803107:	48 85 d2             	test   %rdx,%rdx
+  80310a:	74 f7                	je     803103 <memset+0x46>
+  80310c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80310f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803112:	48 83 c0 01          	add    $0x1,%rax
+  803116:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80311a:	48 39 c2             	cmp    %rax,%rdx
+  80311d:	75 f3                	jne    803112 <memset+0x55>
+  80311f:	eb e2                	jmp    803103 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803121:	40 f6 c7 01          	test   $0x1,%dil
+  803125:	74 06                	je     80312d <memset+0x70>
+  803127:	88 07                	mov    %al,(%rdi)
+  803129:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80312d:	40 f6 c7 02          	test   $0x2,%dil
+  803131:	74 07                	je     80313a <memset+0x7d>
+  803133:	66 89 07             	mov    %ax,(%rdi)
+  803136:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80313a:	40 f6 c7 04          	test   $0x4,%dil
+  80313e:	74 a9                	je     8030e9 <memset+0x2c>
+  803140:	89 07                	mov    %eax,(%rdi)
+  803142:	48 83 c7 04          	add    $0x4,%rdi
+  803146:	eb a1                	jmp    8030e9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803148:	41 f6 c1 04          	test   $0x4,%r9b
+  80314c:	74 06                	je     803154 <memset+0x97>
+  80314e:	89 07                	mov    %eax,(%rdi)
+  803150:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803154:	41 f6 c1 02          	test   $0x2,%r9b
+  803158:	74 07                	je     803161 <memset+0xa4>
+  80315a:	66 89 07             	mov    %ax,(%rdi)
+  80315d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803161:	41 f6 c1 01          	test   $0x1,%r9b
+  803165:	74 9c                	je     803103 <memset+0x46>
+  803167:	88 07                	mov    %al,(%rdi)
+  803169:	eb 98                	jmp    803103 <memset+0x46>
+
+000000000080316b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80316b:	48 89 f8             	mov    %rdi,%rax
+  80316e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803171:	48 39 fe             	cmp    %rdi,%rsi
+  803174:	73 3b                	jae    8031b1 <memmove+0x46>
+  803176:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80317a:	48 39 d7             	cmp    %rdx,%rdi
+  80317d:	73 32                	jae    8031b1 <memmove+0x46>
+        s += n;
+        d += n;
+  80317f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803183:	48 89 d6             	mov    %rdx,%rsi
+  803186:	48 09 fe             	or     %rdi,%rsi
+  803189:	48 09 ce             	or     %rcx,%rsi
+  80318c:	40 f6 c6 07          	test   $0x7,%sil
+  803190:	75 12                	jne    8031a4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803192:	48 83 ef 08          	sub    $0x8,%rdi
+  803196:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80319a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80319e:	fd                   	std
+  80319f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031a2:	fc                   	cld
+  8031a3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031a4:	48 83 ef 01          	sub    $0x1,%rdi
+  8031a8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031ac:	fd                   	std
+  8031ad:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031af:	eb f1                	jmp    8031a2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031b1:	48 89 f2             	mov    %rsi,%rdx
+  8031b4:	48 09 c2             	or     %rax,%rdx
+  8031b7:	48 09 ca             	or     %rcx,%rdx
+  8031ba:	f6 c2 07             	test   $0x7,%dl
+  8031bd:	75 0c                	jne    8031cb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031bf:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031c3:	48 89 c7             	mov    %rax,%rdi
+  8031c6:	fc                   	cld
+  8031c7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031ca:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031cb:	48 89 c7             	mov    %rax,%rdi
+  8031ce:	fc                   	cld
+  8031cf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031d1:	c3                   	ret
+
+00000000008031d2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031d2:	55                   	push   %rbp
+  8031d3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031d6:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8031dd:	00 00 00 
+  8031e0:	ff d0                	call   *%rax
+}
+  8031e2:	5d                   	pop    %rbp
+  8031e3:	c3                   	ret
+
+00000000008031e4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031e4:	55                   	push   %rbp
+  8031e5:	48 89 e5             	mov    %rsp,%rbp
+  8031e8:	41 57                	push   %r15
+  8031ea:	41 56                	push   %r14
+  8031ec:	41 55                	push   %r13
+  8031ee:	41 54                	push   %r12
+  8031f0:	53                   	push   %rbx
+  8031f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f5:	49 89 fe             	mov    %rdi,%r14
+  8031f8:	49 89 f7             	mov    %rsi,%r15
+  8031fb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031fe:	48 89 f7             	mov    %rsi,%rdi
+  803201:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  803208:	00 00 00 
+  80320b:	ff d0                	call   *%rax
+  80320d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803210:	48 89 de             	mov    %rbx,%rsi
+  803213:	4c 89 f7             	mov    %r14,%rdi
+  803216:	48 b8 4e 2f 80 00 00 	movabs $0x802f4e,%rax
+  80321d:	00 00 00 
+  803220:	ff d0                	call   *%rax
+  803222:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803225:	48 39 c3             	cmp    %rax,%rbx
+  803228:	74 36                	je     803260 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80322a:	48 89 d8             	mov    %rbx,%rax
+  80322d:	4c 29 e8             	sub    %r13,%rax
+  803230:	49 39 c4             	cmp    %rax,%r12
+  803233:	73 31                	jae    803266 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803235:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80323a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80323e:	4c 89 fe             	mov    %r15,%rsi
+  803241:	48 b8 d2 31 80 00 00 	movabs $0x8031d2,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80324d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803251:	48 83 c4 08          	add    $0x8,%rsp
+  803255:	5b                   	pop    %rbx
+  803256:	41 5c                	pop    %r12
+  803258:	41 5d                	pop    %r13
+  80325a:	41 5e                	pop    %r14
+  80325c:	41 5f                	pop    %r15
+  80325e:	5d                   	pop    %rbp
+  80325f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803260:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803264:	eb eb                	jmp    803251 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803266:	48 83 eb 01          	sub    $0x1,%rbx
+  80326a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80326e:	48 89 da             	mov    %rbx,%rdx
+  803271:	4c 89 fe             	mov    %r15,%rsi
+  803274:	48 b8 d2 31 80 00 00 	movabs $0x8031d2,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803280:	49 01 de             	add    %rbx,%r14
+  803283:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803288:	eb c3                	jmp    80324d <strlcat+0x69>
+
+000000000080328a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80328a:	48 85 d2             	test   %rdx,%rdx
+  80328d:	74 2d                	je     8032bc <memcmp+0x32>
+  80328f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803294:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803298:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80329d:	44 38 c1             	cmp    %r8b,%cl
+  8032a0:	75 0f                	jne    8032b1 <memcmp+0x27>
+    while (n-- > 0) {
+  8032a2:	48 83 c0 01          	add    $0x1,%rax
+  8032a6:	48 39 c2             	cmp    %rax,%rdx
+  8032a9:	75 e9                	jne    803294 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032b1:	0f b6 c1             	movzbl %cl,%eax
+  8032b4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032b8:	44 29 c0             	sub    %r8d,%eax
+  8032bb:	c3                   	ret
+    return 0;
+  8032bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c1:	c3                   	ret
+
+00000000008032c2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032c2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032c6:	48 39 c7             	cmp    %rax,%rdi
+  8032c9:	73 0f                	jae    8032da <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032cb:	40 38 37             	cmp    %sil,(%rdi)
+  8032ce:	74 0e                	je     8032de <memfind+0x1c>
+    for (; src < end; src++) {
+  8032d0:	48 83 c7 01          	add    $0x1,%rdi
+  8032d4:	48 39 f8             	cmp    %rdi,%rax
+  8032d7:	75 f2                	jne    8032cb <memfind+0x9>
+  8032d9:	c3                   	ret
+  8032da:	48 89 f8             	mov    %rdi,%rax
+  8032dd:	c3                   	ret
+  8032de:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032e1:	c3                   	ret
+
+00000000008032e2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032e2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032e5:	0f b6 37             	movzbl (%rdi),%esi
+  8032e8:	40 80 fe 20          	cmp    $0x20,%sil
+  8032ec:	74 06                	je     8032f4 <strtol+0x12>
+  8032ee:	40 80 fe 09          	cmp    $0x9,%sil
+  8032f2:	75 13                	jne    803307 <strtol+0x25>
+  8032f4:	48 83 c7 01          	add    $0x1,%rdi
+  8032f8:	0f b6 37             	movzbl (%rdi),%esi
+  8032fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8032ff:	74 f3                	je     8032f4 <strtol+0x12>
+  803301:	40 80 fe 09          	cmp    $0x9,%sil
+  803305:	74 ed                	je     8032f4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803307:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80330a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80330d:	3c 01                	cmp    $0x1,%al
+  80330f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803313:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803319:	75 0f                	jne    80332a <strtol+0x48>
+  80331b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80331e:	74 14                	je     803334 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803320:	85 d2                	test   %edx,%edx
+  803322:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803327:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80332a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80332f:	4c 63 ca             	movslq %edx,%r9
+  803332:	eb 36                	jmp    80336a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803334:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803338:	74 0f                	je     803349 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80333a:	85 d2                	test   %edx,%edx
+  80333c:	75 ec                	jne    80332a <strtol+0x48>
+        s++;
+  80333e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803342:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803347:	eb e1                	jmp    80332a <strtol+0x48>
+        s += 2;
+  803349:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80334d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803352:	eb d6                	jmp    80332a <strtol+0x48>
+            dig -= '0';
+  803354:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803357:	44 0f b6 c1          	movzbl %cl,%r8d
+  80335b:	41 39 d0             	cmp    %edx,%r8d
+  80335e:	7d 21                	jge    803381 <strtol+0x9f>
+        val = val * base + dig;
+  803360:	49 0f af c1          	imul   %r9,%rax
+  803364:	0f b6 c9             	movzbl %cl,%ecx
+  803367:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80336a:	48 83 c7 01          	add    $0x1,%rdi
+  80336e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803372:	80 f9 39             	cmp    $0x39,%cl
+  803375:	76 dd                	jbe    803354 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803377:	80 f9 7b             	cmp    $0x7b,%cl
+  80337a:	77 05                	ja     803381 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80337c:	83 e9 57             	sub    $0x57,%ecx
+  80337f:	eb d6                	jmp    803357 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803381:	4d 85 d2             	test   %r10,%r10
+  803384:	74 03                	je     803389 <strtol+0xa7>
+  803386:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803389:	48 89 c2             	mov    %rax,%rdx
+  80338c:	48 f7 da             	neg    %rdx
+  80338f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803393:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803397:	c3                   	ret
+
+0000000000803398 <strrev>:
+
+void
+strrev(char *str)
+{
+  803398:	55                   	push   %rbp
+  803399:	48 89 e5             	mov    %rsp,%rbp
+  80339c:	53                   	push   %rbx
+  80339d:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a1:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033a4:	48 b8 33 2f 80 00 00 	movabs $0x802f33,%rax
+  8033ab:	00 00 00 
+  8033ae:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b0:	83 e8 01             	sub    $0x1,%eax
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	7e 22                	jle    8033d9 <strrev+0x41>
+  8033b7:	48 98                	cltq
+  8033b9:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033be:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033c2:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033c6:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033ca:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033cd:	48 83 c2 01          	add    $0x1,%rdx
+  8033d1:	48 83 e8 01          	sub    $0x1,%rax
+  8033d5:	39 c2                	cmp    %eax,%edx
+  8033d7:	7c e5                	jl     8033be <strrev+0x26>
+	}
+}
+  8033d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033dd:	c9                   	leave
+  8033de:	c3                   	ret
+
+00000000008033df <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033df:	85 d2                	test   %edx,%edx
+  8033e1:	0f 84 80 00 00 00    	je     803467 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033e7:	55                   	push   %rbp
+  8033e8:	48 89 e5             	mov    %rsp,%rbp
+  8033eb:	53                   	push   %rbx
+  8033ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f0:	49 89 f2             	mov    %rsi,%r10
+  8033f3:	41 89 d3             	mov    %edx,%r11d
+  8033f6:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033f9:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033fe:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  803401:	eb 20                	jmp    803423 <itoa+0x44>
+			str[i++] = '0' + digit;
+  803403:	41 89 f1             	mov    %esi,%r9d
+  803406:	83 c2 30             	add    $0x30,%edx
+  803409:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80340c:	89 f8                	mov    %edi,%eax
+  80340e:	99                   	cltd
+  80340f:	f7 f9                	idiv   %ecx
+  803411:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803413:	85 c0                	test   %eax,%eax
+  803415:	74 2e                	je     803445 <itoa+0x66>
+  803417:	83 c6 01             	add    $0x1,%esi
+  80341a:	49 83 c0 01          	add    $0x1,%r8
+  80341e:	44 39 cb             	cmp    %r9d,%ebx
+  803421:	7e 15                	jle    803438 <itoa+0x59>
+		digit = sum % base;
+  803423:	89 f8                	mov    %edi,%eax
+  803425:	99                   	cltd
+  803426:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803428:	83 fa 09             	cmp    $0x9,%edx
+  80342b:	7e d6                	jle    803403 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80342d:	41 89 f1             	mov    %esi,%r9d
+  803430:	83 c2 37             	add    $0x37,%edx
+  803433:	41 88 10             	mov    %dl,(%r8)
+  803436:	eb d4                	jmp    80340c <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803438:	41 83 eb 01          	sub    $0x1,%r11d
+  80343c:	45 39 cb             	cmp    %r9d,%r11d
+  80343f:	75 04                	jne    803445 <itoa+0x66>
+  803441:	85 c0                	test   %eax,%eax
+  803443:	75 28                	jne    80346d <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  803445:	4d 63 c9             	movslq %r9d,%r9
+  803448:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80344d:	4c 89 d7             	mov    %r10,%rdi
+  803450:	48 b8 98 33 80 00 00 	movabs $0x803398,%rax
+  803457:	00 00 00 
+  80345a:	ff d0                	call   *%rax
+	return 0;
+  80345c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803461:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803465:	c9                   	leave
+  803466:	c3                   	ret
+		return -1;
+  803467:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80346c:	c3                   	ret
+		return -1;
+  80346d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803472:	eb ed                	jmp    803461 <itoa+0x82>
+
+0000000000803474 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803474:	55                   	push   %rbp
+  803475:	48 89 e5             	mov    %rsp,%rbp
+  803478:	41 55                	push   %r13
+  80347a:	41 54                	push   %r12
+  80347c:	53                   	push   %rbx
+  80347d:	48 83 ec 08          	sub    $0x8,%rsp
+  803481:	49 89 fc             	mov    %rdi,%r12
+  803484:	48 89 f7             	mov    %rsi,%rdi
+  803487:	48 89 d3             	mov    %rdx,%rbx
+  80348a:	49 89 cd             	mov    %rcx,%r13
+  80348d:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803490:	48 85 f6             	test   %rsi,%rsi
+  803493:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80349a:	00 00 00 
+  80349d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034a1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034a6:	48 85 db             	test   %rbx,%rbx
+  8034a9:	74 03                	je     8034ae <ipc_recv_timed+0x3a>
+  8034ab:	48 8b 33             	mov    (%rbx),%rsi
+  8034ae:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  8034b5:	00 00 00 
+  8034b8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	78 75                	js     803533 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034be:	4d 85 e4             	test   %r12,%r12
+  8034c1:	74 14                	je     8034d7 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034c3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ca:	00 00 00 
+  8034cd:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034d3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034d7:	4d 85 ed             	test   %r13,%r13
+  8034da:	74 14                	je     8034f0 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034dc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e3:	00 00 00 
+  8034e6:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034ec:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034f0:	48 85 db             	test   %rbx,%rbx
+  8034f3:	74 23                	je     803518 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034f5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034fc:	00 00 00 
+  8034ff:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80350a:	85 c9                	test   %ecx,%ecx
+  80350c:	74 07                	je     803515 <ipc_recv_timed+0xa1>
+  80350e:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803515:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803518:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80351f:	00 00 00 
+  803522:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803528:	48 83 c4 08          	add    $0x8,%rsp
+  80352c:	5b                   	pop    %rbx
+  80352d:	41 5c                	pop    %r12
+  80352f:	41 5d                	pop    %r13
+  803531:	5d                   	pop    %rbp
+  803532:	c3                   	ret
+        if (from_env_store != NULL) {
+  803533:	4d 85 e4             	test   %r12,%r12
+  803536:	74 08                	je     803540 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803538:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80353f:	00 
+        if (perm_store != NULL) {
+  803540:	4d 85 ed             	test   %r13,%r13
+  803543:	74 08                	je     80354d <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803545:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80354c:	00 
+        if (size != NULL) {
+  80354d:	48 85 db             	test   %rbx,%rbx
+  803550:	74 d6                	je     803528 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803552:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803559:	eb cd                	jmp    803528 <ipc_recv_timed+0xb4>
+
+000000000080355b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80355b:	55                   	push   %rbp
+  80355c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80355f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803565:	48 b8 74 34 80 00 00 	movabs $0x803474,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+}
+  803571:	5d                   	pop    %rbp
+  803572:	c3                   	ret
+
+0000000000803573 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+  803577:	41 57                	push   %r15
+  803579:	41 56                	push   %r14
+  80357b:	41 55                	push   %r13
+  80357d:	41 54                	push   %r12
+  80357f:	53                   	push   %rbx
+  803580:	48 83 ec 18          	sub    $0x18,%rsp
+  803584:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803587:	48 89 d3             	mov    %rdx,%rbx
+  80358a:	49 89 cc             	mov    %rcx,%r12
+  80358d:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803590:	48 85 d2             	test   %rdx,%rdx
+  803593:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80359a:	00 00 00 
+  80359d:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035a1:	89 f0                	mov    %esi,%eax
+  8035a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035a7:	48 89 da             	mov    %rbx,%rdx
+  8035aa:	48 89 c6             	mov    %rax,%rsi
+  8035ad:	48 b8 09 05 80 00 00 	movabs $0x800509,%rax
+  8035b4:	00 00 00 
+  8035b7:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	79 65                	jns    803622 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035bd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035c0:	75 33                	jne    8035f5 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035c2:	49 bf 0c 02 80 00 00 	movabs $0x80020c,%r15
+  8035c9:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035cc:	49 be 09 05 80 00 00 	movabs $0x800509,%r14
+  8035d3:	00 00 00 
+        sys_yield();
+  8035d6:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d9:	45 89 e8             	mov    %r13d,%r8d
+  8035dc:	4c 89 e1             	mov    %r12,%rcx
+  8035df:	48 89 da             	mov    %rbx,%rdx
+  8035e2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035e6:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035e9:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035ec:	85 c0                	test   %eax,%eax
+  8035ee:	79 32                	jns    803622 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035f0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035f3:	74 e1                	je     8035d6 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035f5:	89 c1                	mov    %eax,%ecx
+  8035f7:	48 ba 47 3d 80 00 00 	movabs $0x803d47,%rdx
+  8035fe:	00 00 00 
+  803601:	be 52 00 00 00       	mov    $0x52,%esi
+  803606:	48 bf 5b 3d 80 00 00 	movabs $0x803d5b,%rdi
+  80360d:	00 00 00 
+  803610:	b8 00 00 00 00       	mov    $0x0,%eax
+  803615:	49 b8 fc 24 80 00 00 	movabs $0x8024fc,%r8
+  80361c:	00 00 00 
+  80361f:	41 ff d0             	call   *%r8
+    }
+}
+  803622:	48 83 c4 18          	add    $0x18,%rsp
+  803626:	5b                   	pop    %rbx
+  803627:	41 5c                	pop    %r12
+  803629:	41 5d                	pop    %r13
+  80362b:	41 5e                	pop    %r14
+  80362d:	41 5f                	pop    %r15
+  80362f:	5d                   	pop    %rbp
+  803630:	c3                   	ret
+
+0000000000803631 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803631:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803636:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80363d:	00 00 00 
+  803640:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803644:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803648:	48 c1 e2 04          	shl    $0x4,%rdx
+  80364c:	48 01 ca             	add    %rcx,%rdx
+  80364f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803655:	39 fa                	cmp    %edi,%edx
+  803657:	74 12                	je     80366b <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803659:	48 83 c0 01          	add    $0x1,%rax
+  80365d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803663:	75 db                	jne    803640 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803665:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366a:	c3                   	ret
+            return envs[i].env_id;
+  80366b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80366f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803673:	48 c1 e2 04          	shl    $0x4,%rdx
+  803677:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80367e:	00 00 00 
+  803681:	48 01 d0             	add    %rdx,%rax
+  803684:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80368a:	c3                   	ret
+  80368b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803690 <__rodata_start>:
+  803690:	3c 75                	cmp    $0x75,%al
+  803692:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803693:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803697:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803698:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  80369c:	1f                   	(bad)
+  80369d:	44 00 00             	add    %r8b,(%rax)
+  8036a0:	73 79                	jae    80371b <__rodata_start+0x8b>
+  8036a2:	73 63                	jae    803707 <__rodata_start+0x77>
+  8036a4:	61                   	(bad)
+  8036a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b27 <__bss_end+0x72201b27>
+  8036ad:	65 74 75             	gs je  803725 <__rodata_start+0x95>
+  8036b0:	72 6e                	jb     803720 <__rodata_start+0x90>
+  8036b2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b34 <__bss_end+0x28201b34>
+  8036b9:	28 
+  8036ba:	3e 20 30             	ds and %dh,(%rax)
+  8036bd:	29 00                	sub    %eax,(%rax)
+  8036bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036c7:	61                   	(bad)
+  8036c8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ca:	2e 63 00             	cs movsxd (%rax),%eax
+  8036cd:	0f 1f 00             	nopl   (%rax)
+  8036d0:	5b                   	pop    %rbx
+  8036d1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036d6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036d9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036de:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036e2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036e9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804154 <devpipe+0x94>
+  8036f0:	5b                   	pop    %rbx
+  8036f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036f6:	20 72 65             	and    %dh,0x65(%rdx)
+  8036f9:	61                   	(bad)
+  8036fa:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036fc:	61                   	(bad)
+  8036fd:	70 20                	jo     80371f <__rodata_start+0x8f>
+  8036ff:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  803704:	20 62 61             	and    %ah,0x61(%rdx)
+  803707:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80370b:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80370f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803712:	30 38                	xor    %bh,(%rax)
+  803714:	78 5d                	js     803773 <__rodata_start+0xe3>
+  803716:	20 66 74             	and    %ah,0x74(%rsi)
+  803719:	72 75                	jb     803790 <devtab+0x10>
+  80371b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80371f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad578a <__bss_end+0x2d2cd78a>
+  803726:	20 62 61             	and    %ah,0x61(%rdx)
+  803729:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80372d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803731:	5b                   	pop    %rbx
+  803732:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803737:	20 72 65             	and    %dh,0x65(%rdx)
+  80373a:	61                   	(bad)
+  80373b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad57a6 <__bss_end+0x2d2cd7a6>
+  803742:	20 62 61             	and    %ah,0x61(%rdx)
+  803745:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803749:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80374d:	5b                   	pop    %rbx
+  80374e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803753:	20 77 72             	and    %dh,0x72(%rdi)
+  803756:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80375d:	2d 
+  80375e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803763:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803766:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80376a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803771:	00 00 00 
+  803774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80377b:	00 00 00 
+  80377e:	66 90                	xchg   %ax,%ax
+
+0000000000803780 <devtab>:
+  803780:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803790:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  8037a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8038a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8038b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8039a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8039b0:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039c0:	39 28 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     9(......z.......
+  8039d0:	6a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     j.......z.......
+  8039e0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  8039f0:	7a 2e 80 00 00 00 00 00 58 28 80 00 00 00 00 00     z.......X(......
+  803a00:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803a10:	4c 28 80 00 00 00 00 00 c6 28 80 00 00 00 00 00     L(.......(......
+  803a20:	7a 2e 80 00 00 00 00 00 4c 28 80 00 00 00 00 00     z.......L(......
+  803a30:	92 28 80 00 00 00 00 00 92 28 80 00 00 00 00 00     .(.......(......
+  803a40:	92 28 80 00 00 00 00 00 92 28 80 00 00 00 00 00     .(.......(......
+  803a50:	92 28 80 00 00 00 00 00 92 28 80 00 00 00 00 00     .(.......(......
+  803a60:	92 28 80 00 00 00 00 00 92 28 80 00 00 00 00 00     .(.......(......
+  803a70:	92 28 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     .(......z.......
+  803a80:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803a90:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803aa0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803ab0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803ac0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803ad0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803ae0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803af0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b00:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b10:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b20:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b30:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b40:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b50:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b60:	7a 2e 80 00 00 00 00 00 9d 2d 80 00 00 00 00 00     z........-......
+  803b70:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b80:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803b90:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803ba0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803bb0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803bc0:	e9 28 80 00 00 00 00 00 b8 2a 80 00 00 00 00 00     .(.......*......
+  803bd0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803be0:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803bf0:	18 29 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     .)......z.......
+  803c00:	7a 2e 80 00 00 00 00 00 de 28 80 00 00 00 00 00     z........(......
+  803c10:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803c20:	60 2c 80 00 00 00 00 00 2a 2d 80 00 00 00 00 00     `,......*-......
+  803c30:	7a 2e 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     z.......z.......
+  803c40:	af 29 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     .)......z.......
+  803c50:	8c 2b 80 00 00 00 00 00 7a 2e 80 00 00 00 00 00     .+......z.......
+  803c60:	7a 2e 80 00 00 00 00 00 9d 2d 80 00 00 00 00 00     z........-......
+  803c70:	7a 2e 80 00 00 00 00 00 42 28 80 00 00 00 00 00     z.......B(......
+
+0000000000803c80 <error_string>:
+	...
+  803c88:	55 38 80 00 00 00 00 00 67 38 80 00 00 00 00 00     U8......g8......
+  803c98:	77 38 80 00 00 00 00 00 89 38 80 00 00 00 00 00     w8.......8......
+  803ca8:	97 38 80 00 00 00 00 00 ab 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	c0 38 80 00 00 00 00 00 d3 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	e5 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	09 39 80 00 00 00 00 00 1c 39 80 00 00 00 00 00     .9.......9......
+  803ce8:	33 39 80 00 00 00 00 00 49 39 80 00 00 00 00 00     39......I9......
+  803cf8:	61 39 80 00 00 00 00 00 79 39 80 00 00 00 00 00     a9......y9......
+  803d08:	86 39 80 00 00 00 00 00 28 3d 80 00 00 00 00 00     .9......(=......
+  803d18:	9a 39 80 00 00 00 00 00 b2 39 80 00 00 00 00 00     .9.......9......
+  803d28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d48:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d58:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff8:	00 0f 1f 80 00 00 00 00                             ........
@@ -0,0 +1,6624 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	41 89 fd             	mov    %edi,%r13d
+  800057:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005a:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800061:	00 00 00 
+  800064:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80006b:	00 00 00 
+  80006e:	48 39 c2             	cmp    %rax,%rdx
+  800071:	73 17                	jae    80008a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800073:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	49 89 c4             	mov    %rax,%r12
+  800079:	48 83 c3 08          	add    $0x8,%rbx
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	ff 53 f8             	call   *-0x8(%rbx)
+  800085:	4c 39 e3             	cmp    %r12,%rbx
+  800088:	72 ef                	jb     800079 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008a:	48 b8 e3 01 80 00 00 	movabs $0x8001e3,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+  800096:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80009f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000a3:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ae:	00 00 00 
+  8000b1:	48 01 d0             	add    %rdx,%rax
+  8000b4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000be:	45 85 ed             	test   %r13d,%r13d
+  8000c1:	7e 0d                	jle    8000d0 <libmain+0x87>
+  8000c3:	49 8b 06             	mov    (%r14),%rax
+  8000c6:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  8000cd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d0:	4c 89 f6             	mov    %r14,%rsi
+  8000d3:	44 89 ef             	mov    %r13d,%edi
+  8000d6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e2:	48 b8 f7 00 80 00 00 	movabs $0x8000f7,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+#endif
+}
+  8000ee:	5b                   	pop    %rbx
+  8000ef:	41 5c                	pop    %r12
+  8000f1:	41 5d                	pop    %r13
+  8000f3:	41 5e                	pop    %r14
+  8000f5:	5d                   	pop    %rbp
+  8000f6:	c3                   	ret
+
+00000000008000f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f7:	55                   	push   %rbp
+  8000f8:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fb:	48 b8 99 08 80 00 00 	movabs $0x800899,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010c:	48 b8 78 01 80 00 00 	movabs $0x800178,%rax
+  800113:	00 00 00 
+  800116:	ff d0                	call   *%rax
+}
+  800118:	5d                   	pop    %rbp
+  800119:	c3                   	ret
+
+000000000080011a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011a:	55                   	push   %rbp
+  80011b:	48 89 e5             	mov    %rsp,%rbp
+  80011e:	53                   	push   %rbx
+  80011f:	48 89 fa             	mov    %rdi,%rdx
+  800122:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800125:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80012f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800134:	be 00 00 00 00       	mov    $0x0,%esi
+  800139:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80013f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800141:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+0000000000800147 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800147:	55                   	push   %rbp
+  800148:	48 89 e5             	mov    %rsp,%rbp
+  80014b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800151:	ba 00 00 00 00       	mov    $0x0,%edx
+  800156:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800160:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800165:	be 00 00 00 00       	mov    $0x0,%esi
+  80016a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800170:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800172:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+
+0000000000800178 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800178:	55                   	push   %rbp
+  800179:	48 89 e5             	mov    %rsp,%rbp
+  80017c:	53                   	push   %rbx
+  80017d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800181:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800184:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800189:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80018e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800193:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a5:	48 85 c0             	test   %rax,%rax
+  8001a8:	7f 06                	jg     8001b0 <sys_env_destroy+0x38>
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b0:	49 89 c0             	mov    %rax,%r8
+  8001b3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b8:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8001bf:	00 00 00 
+  8001c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c7:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8001ce:	00 00 00 
+  8001d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d6:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  8001dd:	00 00 00 
+  8001e0:	41 ff d1             	call   *%r9
+
+00000000008001e3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e3:	55                   	push   %rbp
+  8001e4:	48 89 e5             	mov    %rsp,%rbp
+  8001e7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800201:	be 00 00 00 00       	mov    $0x0,%esi
+  800206:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80020e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800212:	c9                   	leave
+  800213:	c3                   	ret
+
+0000000000800214 <sys_yield>:
+
+void
+sys_yield(void) {
+  800214:	55                   	push   %rbp
+  800215:	48 89 e5             	mov    %rsp,%rbp
+  800218:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800219:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80021e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800223:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800232:	be 00 00 00 00       	mov    $0x0,%esi
+  800237:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+
+0000000000800245 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800245:	55                   	push   %rbp
+  800246:	48 89 e5             	mov    %rsp,%rbp
+  800249:	53                   	push   %rbx
+  80024a:	48 89 fa             	mov    %rdi,%rdx
+  80024d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800250:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800255:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025c:	00 00 00 
+  80025f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800264:	be 00 00 00 00       	mov    $0x0,%esi
+  800269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800275:	c9                   	leave
+  800276:	c3                   	ret
+
+0000000000800277 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	53                   	push   %rbx
+  80027c:	49 89 f8             	mov    %rdi,%r8
+  80027f:	48 89 d3             	mov    %rdx,%rbx
+  800282:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800285:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028a:	4c 89 c2             	mov    %r8,%rdx
+  80028d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800290:	be 00 00 00 00       	mov    $0x0,%esi
+  800295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+
+00000000008002a3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	53                   	push   %rbx
+  8002a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ac:	89 f8                	mov    %edi,%eax
+  8002ae:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b1:	48 63 f9             	movslq %ecx,%rdi
+  8002b4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002bc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002cc:	48 85 c0             	test   %rax,%rax
+  8002cf:	7f 06                	jg     8002d7 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d5:	c9                   	leave
+  8002d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d7:	49 89 c0             	mov    %rax,%r8
+  8002da:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002df:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8002e6:	00 00 00 
+  8002e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8002ee:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8002f5:	00 00 00 
+  8002f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fd:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  800304:	00 00 00 
+  800307:	41 ff d1             	call   *%r9
+
+000000000080030a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030a:	55                   	push   %rbp
+  80030b:	48 89 e5             	mov    %rsp,%rbp
+  80030e:	53                   	push   %rbx
+  80030f:	48 83 ec 08          	sub    $0x8,%rsp
+  800313:	89 f8                	mov    %edi,%eax
+  800315:	49 89 f2             	mov    %rsi,%r10
+  800318:	48 89 cf             	mov    %rcx,%rdi
+  80031b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80031e:	48 63 da             	movslq %edx,%rbx
+  800321:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800324:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800329:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80032f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800331:	48 85 c0             	test   %rax,%rax
+  800334:	7f 06                	jg     80033c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033a:	c9                   	leave
+  80033b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033c:	49 89 c0             	mov    %rax,%r8
+  80033f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800344:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80034b:	00 00 00 
+  80034e:	be 26 00 00 00       	mov    $0x26,%esi
+  800353:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80035a:	00 00 00 
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  800369:	00 00 00 
+  80036c:	41 ff d1             	call   *%r9
+
+000000000080036f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80036f:	55                   	push   %rbp
+  800370:	48 89 e5             	mov    %rsp,%rbp
+  800373:	53                   	push   %rbx
+  800374:	48 83 ec 08          	sub    $0x8,%rsp
+  800378:	48 89 f1             	mov    %rsi,%rcx
+  80037b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80037e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800381:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800386:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038b:	be 00 00 00 00       	mov    $0x0,%esi
+  800390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800396:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800398:	48 85 c0             	test   %rax,%rax
+  80039b:	7f 06                	jg     8003a3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80039d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a3:	49 89 c0             	mov    %rax,%r8
+  8003a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ab:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8003b2:	00 00 00 
+  8003b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8003ba:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8003c1:	00 00 00 
+  8003c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c9:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  8003d0:	00 00 00 
+  8003d3:	41 ff d1             	call   *%r9
+
+00000000008003d6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003d6:	55                   	push   %rbp
+  8003d7:	48 89 e5             	mov    %rsp,%rbp
+  8003da:	53                   	push   %rbx
+  8003db:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003df:	48 63 ce             	movslq %esi,%rcx
+  8003e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800401:	48 85 c0             	test   %rax,%rax
+  800404:	7f 06                	jg     80040c <sys_env_set_status+0x36>
+}
+  800406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040a:	c9                   	leave
+  80040b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040c:	49 89 c0             	mov    %rax,%r8
+  80040f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800414:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80041b:	00 00 00 
+  80041e:	be 26 00 00 00       	mov    $0x26,%esi
+  800423:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80042a:	00 00 00 
+  80042d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800432:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  800439:	00 00 00 
+  80043c:	41 ff d1             	call   *%r9
+
+000000000080043f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80043f:	55                   	push   %rbp
+  800440:	48 89 e5             	mov    %rsp,%rbp
+  800443:	53                   	push   %rbx
+  800444:	48 83 ec 08          	sub    $0x8,%rsp
+  800448:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80044b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80044e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800453:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800458:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045d:	be 00 00 00 00       	mov    $0x0,%esi
+  800462:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800468:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80046a:	48 85 c0             	test   %rax,%rax
+  80046d:	7f 06                	jg     800475 <sys_env_set_trapframe+0x36>
+}
+  80046f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800473:	c9                   	leave
+  800474:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800475:	49 89 c0             	mov    %rax,%r8
+  800478:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80047d:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  800484:	00 00 00 
+  800487:	be 26 00 00 00       	mov    $0x26,%esi
+  80048c:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  800493:	00 00 00 
+  800496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049b:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  8004a2:	00 00 00 
+  8004a5:	41 ff d1             	call   *%r9
+
+00000000008004a8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	53                   	push   %rbx
+  8004ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004b4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d3:	48 85 c0             	test   %rax,%rax
+  8004d6:	7f 06                	jg     8004de <sys_env_set_pgfault_upcall+0x36>
+}
+  8004d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004dc:	c9                   	leave
+  8004dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004de:	49 89 c0             	mov    %rax,%r8
+  8004e1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004e6:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8004ed:	00 00 00 
+  8004f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f5:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8004fc:	00 00 00 
+  8004ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800504:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  80050b:	00 00 00 
+  80050e:	41 ff d1             	call   *%r9
+
+0000000000800511 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800511:	55                   	push   %rbp
+  800512:	48 89 e5             	mov    %rsp,%rbp
+  800515:	53                   	push   %rbx
+  800516:	89 f8                	mov    %edi,%eax
+  800518:	49 89 f1             	mov    %rsi,%r9
+  80051b:	48 89 d3             	mov    %rdx,%rbx
+  80051e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800521:	49 63 f0             	movslq %r8d,%rsi
+  800524:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800527:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80052c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800535:	cd 30                	int    $0x30
+}
+  800537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80053b:	c9                   	leave
+  80053c:	c3                   	ret
+
+000000000080053d <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80053d:	55                   	push   %rbp
+  80053e:	48 89 e5             	mov    %rsp,%rbp
+  800541:	53                   	push   %rbx
+  800542:	48 83 ec 08          	sub    $0x8,%rsp
+  800546:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800549:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80054c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800551:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800554:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800559:	be 00 00 00 00       	mov    $0x0,%esi
+  80055e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800564:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800566:	48 85 c0             	test   %rax,%rax
+  800569:	7f 06                	jg     800571 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80056b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80056f:	c9                   	leave
+  800570:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800571:	49 89 c0             	mov    %rax,%r8
+  800574:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800579:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  800580:	00 00 00 
+  800583:	be 26 00 00 00       	mov    $0x26,%esi
+  800588:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80058f:	00 00 00 
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	49 b9 04 25 80 00 00 	movabs $0x802504,%r9
+  80059e:	00 00 00 
+  8005a1:	41 ff d1             	call   *%r9
+
+00000000008005a4 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8005a4:	55                   	push   %rbp
+  8005a5:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  8005b4:	00 00 00 
+  8005b7:	ff d0                	call   *%rax
+}
+  8005b9:	5d                   	pop    %rbp
+  8005ba:	c3                   	ret
+
+00000000008005bb <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005bb:	55                   	push   %rbp
+  8005bc:	48 89 e5             	mov    %rsp,%rbp
+  8005bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8005de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ea:	c9                   	leave
+  8005eb:	c3                   	ret
+
+00000000008005ec <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005ec:	55                   	push   %rbp
+  8005ed:	48 89 e5             	mov    %rsp,%rbp
+  8005f0:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005f1:	48 63 ce             	movslq %esi,%rcx
+  8005f4:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800602:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800607:	be 00 00 00 00       	mov    $0x0,%esi
+  80060c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800612:	cd 30                	int    $0x30
+}
+  800614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800618:	c9                   	leave
+  800619:	c3                   	ret
+
+000000000080061a <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80061a:	55                   	push   %rbp
+  80061b:	48 89 e5             	mov    %rsp,%rbp
+  80061e:	53                   	push   %rbx
+  80061f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800622:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800626:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80062b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800630:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800635:	be 00 00 00 00       	mov    $0x0,%esi
+  80063a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800640:	cd 30                	int    $0x30
+}
+  800642:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800646:	c9                   	leave
+  800647:	c3                   	ret
+
+0000000000800648 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800648:	55                   	push   %rbp
+  800649:	48 89 e5             	mov    %rsp,%rbp
+  80064c:	53                   	push   %rbx
+  80064d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800650:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800653:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800658:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80065b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800660:	be 00 00 00 00       	mov    $0x0,%esi
+  800665:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80066b:	cd 30                	int    $0x30
+}
+  80066d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800671:	c9                   	leave
+  800672:	c3                   	ret
+
+0000000000800673 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800673:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80067a:	ff ff ff 
+  80067d:	48 01 f8             	add    %rdi,%rax
+  800680:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800684:	c3                   	ret
+
+0000000000800685 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800685:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80068c:	ff ff ff 
+  80068f:	48 01 f8             	add    %rdi,%rax
+  800692:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800696:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80069c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006a0:	c3                   	ret
+
+00000000008006a1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	41 57                	push   %r15
+  8006a7:	41 56                	push   %r14
+  8006a9:	41 55                	push   %r13
+  8006ab:	41 54                	push   %r12
+  8006ad:	53                   	push   %rbx
+  8006ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b2:	49 89 ff             	mov    %rdi,%r15
+  8006b5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ba:	49 bd c0 21 80 00 00 	movabs $0x8021c0,%r13
+  8006c1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006c4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006ca:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006cd:	48 89 df             	mov    %rbx,%rdi
+  8006d0:	41 ff d5             	call   *%r13
+  8006d3:	83 e0 04             	and    $0x4,%eax
+  8006d6:	74 17                	je     8006ef <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006d8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006df:	4c 39 f3             	cmp    %r14,%rbx
+  8006e2:	75 e6                	jne    8006ca <fd_alloc+0x29>
+  8006e4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006ea:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006ef:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006f2:	48 83 c4 08          	add    $0x8,%rsp
+  8006f6:	5b                   	pop    %rbx
+  8006f7:	41 5c                	pop    %r12
+  8006f9:	41 5d                	pop    %r13
+  8006fb:	41 5e                	pop    %r14
+  8006fd:	41 5f                	pop    %r15
+  8006ff:	5d                   	pop    %rbp
+  800700:	c3                   	ret
+
+0000000000800701 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800701:	83 ff 1f             	cmp    $0x1f,%edi
+  800704:	77 39                	ja     80073f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800706:	55                   	push   %rbp
+  800707:	48 89 e5             	mov    %rsp,%rbp
+  80070a:	41 54                	push   %r12
+  80070c:	53                   	push   %rbx
+  80070d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800710:	48 63 df             	movslq %edi,%rbx
+  800713:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80071a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80071e:	48 89 df             	mov    %rbx,%rdi
+  800721:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  800728:	00 00 00 
+  80072b:	ff d0                	call   *%rax
+  80072d:	a8 04                	test   $0x4,%al
+  80072f:	74 14                	je     800745 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800731:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800735:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80073a:	5b                   	pop    %rbx
+  80073b:	41 5c                	pop    %r12
+  80073d:	5d                   	pop    %rbp
+  80073e:	c3                   	ret
+        return -E_INVAL;
+  80073f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800744:	c3                   	ret
+        return -E_INVAL;
+  800745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074a:	eb ee                	jmp    80073a <fd_lookup+0x39>
+
+000000000080074c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80074c:	55                   	push   %rbp
+  80074d:	48 89 e5             	mov    %rsp,%rbp
+  800750:	41 54                	push   %r12
+  800752:	53                   	push   %rbx
+  800753:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800756:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  80075d:	00 00 00 
+  800760:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800767:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80076a:	39 3b                	cmp    %edi,(%rbx)
+  80076c:	74 47                	je     8007b5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80076e:	48 83 c0 08          	add    $0x8,%rax
+  800772:	48 8b 18             	mov    (%rax),%rbx
+  800775:	48 85 db             	test   %rbx,%rbx
+  800778:	75 f0                	jne    80076a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80077a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800781:	00 00 00 
+  800784:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80078a:	89 fa                	mov    %edi,%edx
+  80078c:	48 bf e0 36 80 00 00 	movabs $0x8036e0,%rdi
+  800793:	00 00 00 
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	48 b9 54 26 80 00 00 	movabs $0x802654,%rcx
+  8007a2:	00 00 00 
+  8007a5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007ac:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007b0:	5b                   	pop    %rbx
+  8007b1:	41 5c                	pop    %r12
+  8007b3:	5d                   	pop    %rbp
+  8007b4:	c3                   	ret
+            return 0;
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	eb f0                	jmp    8007ac <dev_lookup+0x60>
+
+00000000008007bc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007bc:	55                   	push   %rbp
+  8007bd:	48 89 e5             	mov    %rsp,%rbp
+  8007c0:	41 55                	push   %r13
+  8007c2:	41 54                	push   %r12
+  8007c4:	53                   	push   %rbx
+  8007c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8007c9:	48 89 fb             	mov    %rdi,%rbx
+  8007cc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007cf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007d6:	ff ff ff 
+  8007d9:	48 01 df             	add    %rbx,%rdi
+  8007dc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007e0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007e4:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  8007eb:	00 00 00 
+  8007ee:	ff d0                	call   *%rax
+  8007f0:	41 89 c5             	mov    %eax,%r13d
+  8007f3:	85 c0                	test   %eax,%eax
+  8007f5:	78 06                	js     8007fd <fd_close+0x41>
+  8007f7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007fb:	74 1a                	je     800817 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007fd:	45 84 e4             	test   %r12b,%r12b
+  800800:	b8 00 00 00 00       	mov    $0x0,%eax
+  800805:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800809:	44 89 e8             	mov    %r13d,%eax
+  80080c:	48 83 c4 18          	add    $0x18,%rsp
+  800810:	5b                   	pop    %rbx
+  800811:	41 5c                	pop    %r12
+  800813:	41 5d                	pop    %r13
+  800815:	5d                   	pop    %rbp
+  800816:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800817:	8b 3b                	mov    (%rbx),%edi
+  800819:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80081d:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800824:	00 00 00 
+  800827:	ff d0                	call   *%rax
+  800829:	41 89 c5             	mov    %eax,%r13d
+  80082c:	85 c0                	test   %eax,%eax
+  80082e:	78 1b                	js     80084b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800830:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800834:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800838:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80083e:	48 85 c0             	test   %rax,%rax
+  800841:	74 08                	je     80084b <fd_close+0x8f>
+  800843:	48 89 df             	mov    %rbx,%rdi
+  800846:	ff d0                	call   *%rax
+  800848:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80084b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800850:	48 89 de             	mov    %rbx,%rsi
+  800853:	bf 00 00 00 00       	mov    $0x0,%edi
+  800858:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  80085f:	00 00 00 
+  800862:	ff d0                	call   *%rax
+    return res;
+  800864:	eb a3                	jmp    800809 <fd_close+0x4d>
+
+0000000000800866 <close>:
+
+int
+close(int fdnum) {
+  800866:	55                   	push   %rbp
+  800867:	48 89 e5             	mov    %rsp,%rbp
+  80086a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80086e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800872:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800879:	00 00 00 
+  80087c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80087e:	85 c0                	test   %eax,%eax
+  800880:	78 15                	js     800897 <close+0x31>
+
+    return fd_close(fd, 1);
+  800882:	be 01 00 00 00       	mov    $0x1,%esi
+  800887:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80088b:	48 b8 bc 07 80 00 00 	movabs $0x8007bc,%rax
+  800892:	00 00 00 
+  800895:	ff d0                	call   *%rax
+}
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+
+0000000000800899 <close_all>:
+
+void
+close_all(void) {
+  800899:	55                   	push   %rbp
+  80089a:	48 89 e5             	mov    %rsp,%rbp
+  80089d:	41 54                	push   %r12
+  80089f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a5:	49 bc 66 08 80 00 00 	movabs $0x800866,%r12
+  8008ac:	00 00 00 
+  8008af:	89 df                	mov    %ebx,%edi
+  8008b1:	41 ff d4             	call   *%r12
+  8008b4:	83 c3 01             	add    $0x1,%ebx
+  8008b7:	83 fb 20             	cmp    $0x20,%ebx
+  8008ba:	75 f3                	jne    8008af <close_all+0x16>
+}
+  8008bc:	5b                   	pop    %rbx
+  8008bd:	41 5c                	pop    %r12
+  8008bf:	5d                   	pop    %rbp
+  8008c0:	c3                   	ret
+
+00000000008008c1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008c1:	55                   	push   %rbp
+  8008c2:	48 89 e5             	mov    %rsp,%rbp
+  8008c5:	41 57                	push   %r15
+  8008c7:	41 56                	push   %r14
+  8008c9:	41 55                	push   %r13
+  8008cb:	41 54                	push   %r12
+  8008cd:	53                   	push   %rbx
+  8008ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8008d2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008d5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008d9:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  8008e0:	00 00 00 
+  8008e3:	ff d0                	call   *%rax
+  8008e5:	89 c3                	mov    %eax,%ebx
+  8008e7:	85 c0                	test   %eax,%eax
+  8008e9:	0f 88 b8 00 00 00    	js     8009a7 <dup+0xe6>
+    close(newfdnum);
+  8008ef:	44 89 e7             	mov    %r12d,%edi
+  8008f2:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008fe:	4d 63 ec             	movslq %r12d,%r13
+  800901:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800908:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80090c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800910:	4c 89 ff             	mov    %r15,%rdi
+  800913:	49 be 85 06 80 00 00 	movabs $0x800685,%r14
+  80091a:	00 00 00 
+  80091d:	41 ff d6             	call   *%r14
+  800920:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800923:	4c 89 ef             	mov    %r13,%rdi
+  800926:	41 ff d6             	call   *%r14
+  800929:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80092c:	48 89 df             	mov    %rbx,%rdi
+  80092f:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  800936:	00 00 00 
+  800939:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80093b:	a8 04                	test   $0x4,%al
+  80093d:	74 2b                	je     80096a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80093f:	41 89 c1             	mov    %eax,%r9d
+  800942:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800948:	4c 89 f1             	mov    %r14,%rcx
+  80094b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800950:	48 89 de             	mov    %rbx,%rsi
+  800953:	bf 00 00 00 00       	mov    $0x0,%edi
+  800958:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  80095f:	00 00 00 
+  800962:	ff d0                	call   *%rax
+  800964:	89 c3                	mov    %eax,%ebx
+  800966:	85 c0                	test   %eax,%eax
+  800968:	78 4e                	js     8009b8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80096a:	4c 89 ff             	mov    %r15,%rdi
+  80096d:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  800974:	00 00 00 
+  800977:	ff d0                	call   *%rax
+  800979:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80097c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800982:	4c 89 e9             	mov    %r13,%rcx
+  800985:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098a:	4c 89 fe             	mov    %r15,%rsi
+  80098d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800992:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  800999:	00 00 00 
+  80099c:	ff d0                	call   *%rax
+  80099e:	89 c3                	mov    %eax,%ebx
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	78 14                	js     8009b8 <dup+0xf7>
+
+    return newfdnum;
+  8009a4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009a7:	89 d8                	mov    %ebx,%eax
+  8009a9:	48 83 c4 18          	add    $0x18,%rsp
+  8009ad:	5b                   	pop    %rbx
+  8009ae:	41 5c                	pop    %r12
+  8009b0:	41 5d                	pop    %r13
+  8009b2:	41 5e                	pop    %r14
+  8009b4:	41 5f                	pop    %r15
+  8009b6:	5d                   	pop    %rbp
+  8009b7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009bd:	4c 89 ee             	mov    %r13,%rsi
+  8009c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c5:	49 bc 6f 03 80 00 00 	movabs $0x80036f,%r12
+  8009cc:	00 00 00 
+  8009cf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d7:	4c 89 f6             	mov    %r14,%rsi
+  8009da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009df:	41 ff d4             	call   *%r12
+    return res;
+  8009e2:	eb c3                	jmp    8009a7 <dup+0xe6>
+
+00000000008009e4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009e4:	55                   	push   %rbp
+  8009e5:	48 89 e5             	mov    %rsp,%rbp
+  8009e8:	41 56                	push   %r14
+  8009ea:	41 55                	push   %r13
+  8009ec:	41 54                	push   %r12
+  8009ee:	53                   	push   %rbx
+  8009ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8009f3:	89 fb                	mov    %edi,%ebx
+  8009f5:	49 89 f4             	mov    %rsi,%r12
+  8009f8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009fb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009ff:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800a06:	00 00 00 
+  800a09:	ff d0                	call   *%rax
+  800a0b:	85 c0                	test   %eax,%eax
+  800a0d:	78 4c                	js     800a5b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a0f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a13:	41 8b 3e             	mov    (%r14),%edi
+  800a16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a1a:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800a21:	00 00 00 
+  800a24:	ff d0                	call   *%rax
+  800a26:	85 c0                	test   %eax,%eax
+  800a28:	78 35                	js     800a5f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a2a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a2e:	83 e0 03             	and    $0x3,%eax
+  800a31:	83 f8 01             	cmp    $0x1,%eax
+  800a34:	74 2d                	je     800a63 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a3a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a3e:	48 85 c0             	test   %rax,%rax
+  800a41:	74 56                	je     800a99 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a43:	4c 89 ea             	mov    %r13,%rdx
+  800a46:	4c 89 e6             	mov    %r12,%rsi
+  800a49:	4c 89 f7             	mov    %r14,%rdi
+  800a4c:	ff d0                	call   *%rax
+}
+  800a4e:	48 83 c4 10          	add    $0x10,%rsp
+  800a52:	5b                   	pop    %rbx
+  800a53:	41 5c                	pop    %r12
+  800a55:	41 5d                	pop    %r13
+  800a57:	41 5e                	pop    %r14
+  800a59:	5d                   	pop    %rbp
+  800a5a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a5b:	48 98                	cltq
+  800a5d:	eb ef                	jmp    800a4e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a5f:	48 98                	cltq
+  800a61:	eb eb                	jmp    800a4e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a63:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a6a:	00 00 00 
+  800a6d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a73:	89 da                	mov    %ebx,%edx
+  800a75:	48 bf 41 37 80 00 00 	movabs $0x803741,%rdi
+  800a7c:	00 00 00 
+  800a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a84:	48 b9 54 26 80 00 00 	movabs $0x802654,%rcx
+  800a8b:	00 00 00 
+  800a8e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a90:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a97:	eb b5                	jmp    800a4e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a99:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800aa0:	eb ac                	jmp    800a4e <read+0x6a>
+
+0000000000800aa2 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800aa2:	55                   	push   %rbp
+  800aa3:	48 89 e5             	mov    %rsp,%rbp
+  800aa6:	41 56                	push   %r14
+  800aa8:	41 55                	push   %r13
+  800aaa:	41 54                	push   %r12
+  800aac:	53                   	push   %rbx
+  800aad:	48 83 ec 10          	sub    $0x10,%rsp
+  800ab1:	89 fb                	mov    %edi,%ebx
+  800ab3:	49 89 f4             	mov    %rsi,%r12
+  800ab6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ab9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800abd:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800ac4:	00 00 00 
+  800ac7:	ff d0                	call   *%rax
+  800ac9:	85 c0                	test   %eax,%eax
+  800acb:	78 41                	js     800b0e <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800acd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ad1:	41 8b 3e             	mov    (%r14),%edi
+  800ad4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ad8:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800adf:	00 00 00 
+  800ae2:	ff d0                	call   *%rax
+  800ae4:	85 c0                	test   %eax,%eax
+  800ae6:	78 35                	js     800b1d <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ae8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aec:	83 e0 03             	and    $0x3,%eax
+  800aef:	83 f8 01             	cmp    $0x1,%eax
+  800af2:	74 2d                	je     800b21 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800af4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800af8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800afc:	48 85 c0             	test   %rax,%rax
+  800aff:	74 56                	je     800b57 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800b01:	4c 89 ea             	mov    %r13,%rdx
+  800b04:	4c 89 e6             	mov    %r12,%rsi
+  800b07:	4c 89 f7             	mov    %r14,%rdi
+  800b0a:	ff d0                	call   *%rax
+  800b0c:	eb 02                	jmp    800b10 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b0e:	48 98                	cltq
+}
+  800b10:	48 83 c4 10          	add    $0x10,%rsp
+  800b14:	5b                   	pop    %rbx
+  800b15:	41 5c                	pop    %r12
+  800b17:	41 5d                	pop    %r13
+  800b19:	41 5e                	pop    %r14
+  800b1b:	5d                   	pop    %rbp
+  800b1c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b1d:	48 98                	cltq
+  800b1f:	eb ef                	jmp    800b10 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b21:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b28:	00 00 00 
+  800b2b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b31:	89 da                	mov    %ebx,%edx
+  800b33:	48 bf 00 37 80 00 00 	movabs $0x803700,%rdi
+  800b3a:	00 00 00 
+  800b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b42:	48 b9 54 26 80 00 00 	movabs $0x802654,%rcx
+  800b49:	00 00 00 
+  800b4c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b4e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b55:	eb b9                	jmp    800b10 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b57:	4c 89 ea             	mov    %r13,%rdx
+  800b5a:	4c 89 e6             	mov    %r12,%rsi
+  800b5d:	89 df                	mov    %ebx,%edi
+  800b5f:	48 b8 e4 09 80 00 00 	movabs $0x8009e4,%rax
+  800b66:	00 00 00 
+  800b69:	ff d0                	call   *%rax
+  800b6b:	eb a3                	jmp    800b10 <readmap+0x6e>
+
+0000000000800b6d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b6d:	55                   	push   %rbp
+  800b6e:	48 89 e5             	mov    %rsp,%rbp
+  800b71:	41 57                	push   %r15
+  800b73:	41 56                	push   %r14
+  800b75:	41 55                	push   %r13
+  800b77:	41 54                	push   %r12
+  800b79:	53                   	push   %rbx
+  800b7a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b7e:	48 85 d2             	test   %rdx,%rdx
+  800b81:	74 54                	je     800bd7 <readn+0x6a>
+  800b83:	41 89 fd             	mov    %edi,%r13d
+  800b86:	49 89 f6             	mov    %rsi,%r14
+  800b89:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b91:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b96:	49 bf e4 09 80 00 00 	movabs $0x8009e4,%r15
+  800b9d:	00 00 00 
+  800ba0:	4c 89 e2             	mov    %r12,%rdx
+  800ba3:	48 29 f2             	sub    %rsi,%rdx
+  800ba6:	4c 01 f6             	add    %r14,%rsi
+  800ba9:	44 89 ef             	mov    %r13d,%edi
+  800bac:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800baf:	85 c0                	test   %eax,%eax
+  800bb1:	78 20                	js     800bd3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bb3:	01 c3                	add    %eax,%ebx
+  800bb5:	85 c0                	test   %eax,%eax
+  800bb7:	74 08                	je     800bc1 <readn+0x54>
+  800bb9:	48 63 f3             	movslq %ebx,%rsi
+  800bbc:	4c 39 e6             	cmp    %r12,%rsi
+  800bbf:	72 df                	jb     800ba0 <readn+0x33>
+    }
+    return res;
+  800bc1:	48 63 c3             	movslq %ebx,%rax
+}
+  800bc4:	48 83 c4 08          	add    $0x8,%rsp
+  800bc8:	5b                   	pop    %rbx
+  800bc9:	41 5c                	pop    %r12
+  800bcb:	41 5d                	pop    %r13
+  800bcd:	41 5e                	pop    %r14
+  800bcf:	41 5f                	pop    %r15
+  800bd1:	5d                   	pop    %rbp
+  800bd2:	c3                   	ret
+        if (inc < 0) return inc;
+  800bd3:	48 98                	cltq
+  800bd5:	eb ed                	jmp    800bc4 <readn+0x57>
+    int inc = 1, res = 0;
+  800bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdc:	eb e3                	jmp    800bc1 <readn+0x54>
+
+0000000000800bde <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bde:	55                   	push   %rbp
+  800bdf:	48 89 e5             	mov    %rsp,%rbp
+  800be2:	41 56                	push   %r14
+  800be4:	41 55                	push   %r13
+  800be6:	41 54                	push   %r12
+  800be8:	53                   	push   %rbx
+  800be9:	48 83 ec 10          	sub    $0x10,%rsp
+  800bed:	89 fb                	mov    %edi,%ebx
+  800bef:	49 89 f4             	mov    %rsi,%r12
+  800bf2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bf9:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800c00:	00 00 00 
+  800c03:	ff d0                	call   *%rax
+  800c05:	85 c0                	test   %eax,%eax
+  800c07:	78 47                	js     800c50 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c0d:	41 8b 3e             	mov    (%r14),%edi
+  800c10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c14:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800c1b:	00 00 00 
+  800c1e:	ff d0                	call   *%rax
+  800c20:	85 c0                	test   %eax,%eax
+  800c22:	78 30                	js     800c54 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c24:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c29:	74 2d                	je     800c58 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c2f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c33:	48 85 c0             	test   %rax,%rax
+  800c36:	74 56                	je     800c8e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c38:	4c 89 ea             	mov    %r13,%rdx
+  800c3b:	4c 89 e6             	mov    %r12,%rsi
+  800c3e:	4c 89 f7             	mov    %r14,%rdi
+  800c41:	ff d0                	call   *%rax
+}
+  800c43:	48 83 c4 10          	add    $0x10,%rsp
+  800c47:	5b                   	pop    %rbx
+  800c48:	41 5c                	pop    %r12
+  800c4a:	41 5d                	pop    %r13
+  800c4c:	41 5e                	pop    %r14
+  800c4e:	5d                   	pop    %rbp
+  800c4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c50:	48 98                	cltq
+  800c52:	eb ef                	jmp    800c43 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c54:	48 98                	cltq
+  800c56:	eb eb                	jmp    800c43 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c58:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c5f:	00 00 00 
+  800c62:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c68:	89 da                	mov    %ebx,%edx
+  800c6a:	48 bf 5d 37 80 00 00 	movabs $0x80375d,%rdi
+  800c71:	00 00 00 
+  800c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c79:	48 b9 54 26 80 00 00 	movabs $0x802654,%rcx
+  800c80:	00 00 00 
+  800c83:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c85:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c8c:	eb b5                	jmp    800c43 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c8e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c95:	eb ac                	jmp    800c43 <write+0x65>
+
+0000000000800c97 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c97:	55                   	push   %rbp
+  800c98:	48 89 e5             	mov    %rsp,%rbp
+  800c9b:	53                   	push   %rbx
+  800c9c:	48 83 ec 18          	sub    $0x18,%rsp
+  800ca0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ca6:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	78 0c                	js     800cc2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cba:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cc6:	c9                   	leave
+  800cc7:	c3                   	ret
+
+0000000000800cc8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cc8:	55                   	push   %rbp
+  800cc9:	48 89 e5             	mov    %rsp,%rbp
+  800ccc:	41 55                	push   %r13
+  800cce:	41 54                	push   %r12
+  800cd0:	53                   	push   %rbx
+  800cd1:	48 83 ec 18          	sub    $0x18,%rsp
+  800cd5:	89 fb                	mov    %edi,%ebx
+  800cd7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cda:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cde:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800ce5:	00 00 00 
+  800ce8:	ff d0                	call   *%rax
+  800cea:	85 c0                	test   %eax,%eax
+  800cec:	78 38                	js     800d26 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cee:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cf2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cf6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cfa:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800d01:	00 00 00 
+  800d04:	ff d0                	call   *%rax
+  800d06:	85 c0                	test   %eax,%eax
+  800d08:	78 1c                	js     800d26 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d0a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d0f:	74 20                	je     800d31 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d15:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d19:	48 85 c0             	test   %rax,%rax
+  800d1c:	74 47                	je     800d65 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d1e:	44 89 e6             	mov    %r12d,%esi
+  800d21:	4c 89 ef             	mov    %r13,%rdi
+  800d24:	ff d0                	call   *%rax
+}
+  800d26:	48 83 c4 18          	add    $0x18,%rsp
+  800d2a:	5b                   	pop    %rbx
+  800d2b:	41 5c                	pop    %r12
+  800d2d:	41 5d                	pop    %r13
+  800d2f:	5d                   	pop    %rbp
+  800d30:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d31:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d38:	00 00 00 
+  800d3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d41:	89 da                	mov    %ebx,%edx
+  800d43:	48 bf 20 37 80 00 00 	movabs $0x803720,%rdi
+  800d4a:	00 00 00 
+  800d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d52:	48 b9 54 26 80 00 00 	movabs $0x802654,%rcx
+  800d59:	00 00 00 
+  800d5c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d63:	eb c1                	jmp    800d26 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d6a:	eb ba                	jmp    800d26 <ftruncate+0x5e>
+
+0000000000800d6c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d6c:	55                   	push   %rbp
+  800d6d:	48 89 e5             	mov    %rsp,%rbp
+  800d70:	41 54                	push   %r12
+  800d72:	53                   	push   %rbx
+  800d73:	48 83 ec 10          	sub    $0x10,%rsp
+  800d77:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d7a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d7e:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  800d85:	00 00 00 
+  800d88:	ff d0                	call   *%rax
+  800d8a:	85 c0                	test   %eax,%eax
+  800d8c:	78 4e                	js     800ddc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d8e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d92:	41 8b 3c 24          	mov    (%r12),%edi
+  800d96:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d9a:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800da1:	00 00 00 
+  800da4:	ff d0                	call   *%rax
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	78 32                	js     800ddc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800daa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dae:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800db3:	74 30                	je     800de5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800db5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800db8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800dbf:	00 00 00 
+    stat->st_isdir = 0;
+  800dc2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dc9:	00 00 00 
+    stat->st_dev = dev;
+  800dcc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dd3:	48 89 de             	mov    %rbx,%rsi
+  800dd6:	4c 89 e7             	mov    %r12,%rdi
+  800dd9:	ff 50 30             	call   *0x30(%rax)
+}
+  800ddc:	48 83 c4 10          	add    $0x10,%rsp
+  800de0:	5b                   	pop    %rbx
+  800de1:	41 5c                	pop    %r12
+  800de3:	5d                   	pop    %rbp
+  800de4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800de5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dea:	eb f0                	jmp    800ddc <fstat+0x70>
+
+0000000000800dec <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dec:	55                   	push   %rbp
+  800ded:	48 89 e5             	mov    %rsp,%rbp
+  800df0:	41 54                	push   %r12
+  800df2:	53                   	push   %rbx
+  800df3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800df6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfb:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  800e02:	00 00 00 
+  800e05:	ff d0                	call   *%rax
+  800e07:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e09:	85 c0                	test   %eax,%eax
+  800e0b:	78 25                	js     800e32 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e0d:	4c 89 e6             	mov    %r12,%rsi
+  800e10:	89 c7                	mov    %eax,%edi
+  800e12:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  800e19:	00 00 00 
+  800e1c:	ff d0                	call   *%rax
+  800e1e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e21:	89 df                	mov    %ebx,%edi
+  800e23:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+
+    return res;
+  800e2f:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e32:	89 d8                	mov    %ebx,%eax
+  800e34:	5b                   	pop    %rbx
+  800e35:	41 5c                	pop    %r12
+  800e37:	5d                   	pop    %rbp
+  800e38:	c3                   	ret
+
+0000000000800e39 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e39:	55                   	push   %rbp
+  800e3a:	48 89 e5             	mov    %rsp,%rbp
+  800e3d:	41 54                	push   %r12
+  800e3f:	53                   	push   %rbx
+  800e40:	48 83 ec 10          	sub    $0x10,%rsp
+  800e44:	48 89 fb             	mov    %rdi,%rbx
+  800e47:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e4a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e4e:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e53:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	78 1f                	js     800e82 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e67:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e6b:	48 85 c0             	test   %rax,%rax
+  800e6e:	74 1b                	je     800e8b <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e70:	4c 89 e6             	mov    %r12,%rsi
+  800e73:	48 89 df             	mov    %rbx,%rdi
+  800e76:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e78:	85 c0                	test   %eax,%eax
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e82:	48 83 c4 10          	add    $0x10,%rsp
+  800e86:	5b                   	pop    %rbx
+  800e87:	41 5c                	pop    %r12
+  800e89:	5d                   	pop    %rbp
+  800e8a:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e8b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e90:	eb f0                	jmp    800e82 <create_snapshot+0x49>
+
+0000000000800e92 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e92:	55                   	push   %rbp
+  800e93:	48 89 e5             	mov    %rsp,%rbp
+  800e96:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e9e:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ea3:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800eaa:	00 00 00 
+  800ead:	ff d0                	call   *%rax
+  800eaf:	85 c0                	test   %eax,%eax
+  800eb1:	78 1e                	js     800ed1 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800eb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800eb7:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800ebb:	48 85 d2             	test   %rdx,%rdx
+  800ebe:	74 13                	je     800ed3 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec5:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ece:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ed1:	c9                   	leave
+  800ed2:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ed3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ed8:	eb f7                	jmp    800ed1 <print_snapshot_list+0x3f>
+
+0000000000800eda <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800eda:	55                   	push   %rbp
+  800edb:	48 89 e5             	mov    %rsp,%rbp
+  800ede:	53                   	push   %rbx
+  800edf:	48 83 ec 18          	sub    $0x18,%rsp
+  800ee3:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ee6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800eea:	bf 66 00 00 00       	mov    $0x66,%edi
+  800eef:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800ef6:	00 00 00 
+  800ef9:	ff d0                	call   *%rax
+  800efb:	85 c0                	test   %eax,%eax
+  800efd:	78 1c                	js     800f1b <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800eff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f03:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800f07:	48 85 c0             	test   %rax,%rax
+  800f0a:	74 15                	je     800f21 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f0c:	48 89 df             	mov    %rbx,%rdi
+  800f0f:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f11:	85 c0                	test   %eax,%eax
+  800f13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f18:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f1f:	c9                   	leave
+  800f20:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f21:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f26:	eb f3                	jmp    800f1b <accept_snapshot+0x41>
+
+0000000000800f28 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f28:	55                   	push   %rbp
+  800f29:	48 89 e5             	mov    %rsp,%rbp
+  800f2c:	53                   	push   %rbx
+  800f2d:	48 83 ec 18          	sub    $0x18,%rsp
+  800f31:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f34:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f38:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f3d:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	78 1c                	js     800f69 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f51:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f55:	48 85 c0             	test   %rax,%rax
+  800f58:	74 15                	je     800f6f <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f5a:	48 89 df             	mov    %rbx,%rdi
+  800f5d:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f5f:	85 c0                	test   %eax,%eax
+  800f61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f66:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6d:	c9                   	leave
+  800f6e:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f6f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f74:	eb f3                	jmp    800f69 <delete_snapshot+0x41>
+
+0000000000800f76 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f76:	55                   	push   %rbp
+  800f77:	48 89 e5             	mov    %rsp,%rbp
+  800f7a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f82:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f87:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800f8e:	00 00 00 
+  800f91:	ff d0                	call   *%rax
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	78 14                	js     800fab <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f9b:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f9f:	48 85 d2             	test   %rdx,%rdx
+  800fa2:	74 09                	je     800fad <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa9:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800fab:	c9                   	leave
+  800fac:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800fb2:	eb f7                	jmp    800fab <gc_snapshots+0x35>
+
+0000000000800fb4 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fb4:	55                   	push   %rbp
+  800fb5:	48 89 e5             	mov    %rsp,%rbp
+  800fb8:	41 56                	push   %r14
+  800fba:	41 55                	push   %r13
+  800fbc:	41 54                	push   %r12
+  800fbe:	53                   	push   %rbx
+  800fbf:	48 83 ec 10          	sub    $0x10,%rsp
+  800fc3:	48 89 fb             	mov    %rdi,%rbx
+  800fc6:	49 89 f4             	mov    %rsi,%r12
+  800fc9:	49 89 d5             	mov    %rdx,%r13
+  800fcc:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fcf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fd3:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fd8:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  800fdf:	00 00 00 
+  800fe2:	ff d0                	call   *%rax
+  800fe4:	85 c0                	test   %eax,%eax
+  800fe6:	78 1b                	js     801003 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fe8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fec:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800ff0:	48 85 c0             	test   %rax,%rax
+  800ff3:	74 1b                	je     801010 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800ff5:	4c 89 f1             	mov    %r14,%rcx
+  800ff8:	4c 89 ea             	mov    %r13,%rdx
+  800ffb:	4c 89 e6             	mov    %r12,%rsi
+  800ffe:	48 89 df             	mov    %rbx,%rdi
+  801001:	ff d0                	call   *%rax
+
+    return res;
+}
+  801003:	48 83 c4 10          	add    $0x10,%rsp
+  801007:	5b                   	pop    %rbx
+  801008:	41 5c                	pop    %r12
+  80100a:	41 5d                	pop    %r13
+  80100c:	41 5e                	pop    %r14
+  80100e:	5d                   	pop    %rbp
+  80100f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801010:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801015:	eb ec                	jmp    801003 <diff_snapshots+0x4f>
+
+0000000000801017 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+  80101b:	41 55                	push   %r13
+  80101d:	41 54                	push   %r12
+  80101f:	53                   	push   %rbx
+  801020:	48 83 ec 18          	sub    $0x18,%rsp
+  801024:	48 89 fb             	mov    %rdi,%rbx
+  801027:	49 89 f4             	mov    %rsi,%r12
+  80102a:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80102d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801031:	bf 66 00 00 00       	mov    $0x66,%edi
+  801036:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  80103d:	00 00 00 
+  801040:	ff d0                	call   *%rax
+  801042:	85 c0                	test   %eax,%eax
+  801044:	78 18                	js     80105e <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801046:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80104a:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80104e:	48 85 c0             	test   %rax,%rax
+  801051:	74 16                	je     801069 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801053:	4c 89 ea             	mov    %r13,%rdx
+  801056:	4c 89 e6             	mov    %r12,%rsi
+  801059:	48 89 df             	mov    %rbx,%rdi
+  80105c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80105e:	48 83 c4 18          	add    $0x18,%rsp
+  801062:	5b                   	pop    %rbx
+  801063:	41 5c                	pop    %r12
+  801065:	41 5d                	pop    %r13
+  801067:	5d                   	pop    %rbp
+  801068:	c3                   	ret
+        return -E_NOT_SUPP;
+  801069:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80106e:	eb ee                	jmp    80105e <send_snapshot+0x47>
+
+0000000000801070 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801070:	55                   	push   %rbp
+  801071:	48 89 e5             	mov    %rsp,%rbp
+  801074:	53                   	push   %rbx
+  801075:	48 83 ec 18          	sub    $0x18,%rsp
+  801079:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80107c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801080:	bf 66 00 00 00       	mov    $0x66,%edi
+  801085:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+  801091:	85 c0                	test   %eax,%eax
+  801093:	78 12                	js     8010a7 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801095:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801099:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80109d:	48 85 c0             	test   %rax,%rax
+  8010a0:	74 0b                	je     8010ad <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8010a2:	48 89 df             	mov    %rbx,%rdi
+  8010a5:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ab:	c9                   	leave
+  8010ac:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010ad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010b2:	eb f3                	jmp    8010a7 <receive_snapshot+0x37>
+
+00000000008010b4 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010b4:	55                   	push   %rbp
+  8010b5:	48 89 e5             	mov    %rsp,%rbp
+  8010b8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010bc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010c0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010c5:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  8010cc:	00 00 00 
+  8010cf:	ff d0                	call   *%rax
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	78 17                	js     8010ec <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010d9:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010e0:	48 85 d2             	test   %rdx,%rdx
+  8010e3:	74 09                	je     8010ee <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ea:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010ec:	c9                   	leave
+  8010ed:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010ee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010f3:	eb f7                	jmp    8010ec <free_space_bytes+0x38>
+
+00000000008010f5 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+  8010f9:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010fd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801101:	bf 66 00 00 00       	mov    $0x66,%edi
+  801106:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  80110d:	00 00 00 
+  801110:	ff d0                	call   *%rax
+  801112:	85 c0                	test   %eax,%eax
+  801114:	78 17                	js     80112d <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801116:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80111a:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801121:	48 85 d2             	test   %rdx,%rdx
+  801124:	74 09                	je     80112f <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112b:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80112d:	c9                   	leave
+  80112e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80112f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801134:	eb f7                	jmp    80112d <busy_space_bytes+0x38>
+
+0000000000801136 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801136:	55                   	push   %rbp
+  801137:	48 89 e5             	mov    %rsp,%rbp
+  80113a:	41 54                	push   %r12
+  80113c:	53                   	push   %rbx
+  80113d:	48 83 ec 10          	sub    $0x10,%rsp
+  801141:	89 fb                	mov    %edi,%ebx
+  801143:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801146:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80114a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80114f:	48 b8 4c 07 80 00 00 	movabs $0x80074c,%rax
+  801156:	00 00 00 
+  801159:	ff d0                	call   *%rax
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	78 17                	js     801176 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80115f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801163:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80116a:	48 85 c0             	test   %rax,%rax
+  80116d:	74 10                	je     80117f <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80116f:	4c 89 e6             	mov    %r12,%rsi
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801176:	48 83 c4 10          	add    $0x10,%rsp
+  80117a:	5b                   	pop    %rbx
+  80117b:	41 5c                	pop    %r12
+  80117d:	5d                   	pop    %rbp
+  80117e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80117f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801184:	eb f0                	jmp    801176 <snapshots_space+0x40>
+
+0000000000801186 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801186:	55                   	push   %rbp
+  801187:	48 89 e5             	mov    %rsp,%rbp
+  80118a:	41 55                	push   %r13
+  80118c:	41 54                	push   %r12
+  80118e:	53                   	push   %rbx
+  80118f:	48 83 ec 08          	sub    $0x8,%rsp
+  801193:	41 89 fd             	mov    %edi,%r13d
+  801196:	48 89 f3             	mov    %rsi,%rbx
+  801199:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80119c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011a3:	00 00 00 
+  8011a6:	83 38 00             	cmpl   $0x0,(%rax)
+  8011a9:	74 57                	je     801202 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011ab:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8011b1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011b6:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011bd:	00 00 00 
+  8011c0:	44 89 ee             	mov    %r13d,%esi
+  8011c3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011ca:	00 00 00 
+  8011cd:	8b 38                	mov    (%rax),%edi
+  8011cf:	48 b8 7b 35 80 00 00 	movabs $0x80357b,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e0:	4c 89 e2             	mov    %r12,%rdx
+  8011e3:	48 89 de             	mov    %rbx,%rsi
+  8011e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011eb:	48 b8 63 35 80 00 00 	movabs $0x803563,%rax
+  8011f2:	00 00 00 
+  8011f5:	ff d0                	call   *%rax
+}
+  8011f7:	48 83 c4 08          	add    $0x8,%rsp
+  8011fb:	5b                   	pop    %rbx
+  8011fc:	41 5c                	pop    %r12
+  8011fe:	41 5d                	pop    %r13
+  801200:	5d                   	pop    %rbp
+  801201:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801202:	bf 03 00 00 00       	mov    $0x3,%edi
+  801207:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  80120e:	00 00 00 
+  801211:	ff d0                	call   *%rax
+  801213:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80121a:	00 00 
+  80121c:	eb 8d                	jmp    8011ab <fsipc_region+0x25>
+
+000000000080121e <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801226:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80122d:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80122e:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801232:	48 b8 86 11 80 00 00 	movabs $0x801186,%rax
+  801239:	00 00 00 
+  80123c:	ff d0                	call   *%rax
+}
+  80123e:	c9                   	leave
+  80123f:	c3                   	ret
+
+0000000000801240 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801240:	85 ff                	test   %edi,%edi
+  801242:	78 6d                	js     8012b1 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801244:	55                   	push   %rbp
+  801245:	48 89 e5             	mov    %rsp,%rbp
+  801248:	41 54                	push   %r12
+  80124a:	53                   	push   %rbx
+  80124b:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80124e:	48 85 f6             	test   %rsi,%rsi
+  801251:	74 57                	je     8012aa <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801253:	89 f8                	mov    %edi,%eax
+  801255:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80125c:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80125e:	be 00 00 00 00       	mov    $0x0,%esi
+  801263:	bf 12 00 00 00       	mov    $0x12,%edi
+  801268:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80126f:	00 00 00 
+  801272:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801274:	85 c0                	test   %eax,%eax
+  801276:	78 2d                	js     8012a5 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801278:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80127f:	00 00 00 
+  801282:	49 63 14 24          	movslq (%r12),%rdx
+  801286:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80128d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  801292:	48 89 df             	mov    %rbx,%rdi
+  801295:	48 b8 73 31 80 00 00 	movabs $0x803173,%rax
+  80129c:	00 00 00 
+  80129f:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8012a1:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8012a5:	5b                   	pop    %rbx
+  8012a6:	41 5c                	pop    %r12
+  8012a8:	5d                   	pop    %rbp
+  8012a9:	c3                   	ret
+        return -E_INVAL;
+  8012aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012af:	eb f4                	jmp    8012a5 <devfile_df_snapshots+0x65>
+  8012b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012b6:	c3                   	ret
+
+00000000008012b7 <devfile_df_busy>:
+devfile_df_busy() {
+  8012b7:	55                   	push   %rbp
+  8012b8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c0:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012c5:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8012cc:	00 00 00 
+  8012cf:	ff d0                	call   *%rax
+}
+  8012d1:	5d                   	pop    %rbp
+  8012d2:	c3                   	ret
+
+00000000008012d3 <devfile_df_free>:
+devfile_df_free() {
+  8012d3:	55                   	push   %rbp
+  8012d4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012dc:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012e1:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8012e8:	00 00 00 
+  8012eb:	ff d0                	call   *%rax
+}
+  8012ed:	5d                   	pop    %rbp
+  8012ee:	c3                   	ret
+
+00000000008012ef <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012ef:	55                   	push   %rbp
+  8012f0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012fd:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801304:	00 00 00 
+  801307:	ff d0                	call   *%rax
+}
+  801309:	5d                   	pop    %rbp
+  80130a:	c3                   	ret
+
+000000000080130b <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80130b:	55                   	push   %rbp
+  80130c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80130f:	be 00 00 00 00       	mov    $0x0,%esi
+  801314:	bf 09 00 00 00       	mov    $0x9,%edi
+  801319:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801320:	00 00 00 
+  801323:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801325:	85 c0                	test   %eax,%eax
+  801327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80132f:	5d                   	pop    %rbp
+  801330:	c3                   	ret
+
+0000000000801331 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801331:	55                   	push   %rbp
+  801332:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801335:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80133c:	00 00 00 
+  80133f:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801342:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801344:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801347:	be 00 00 00 00       	mov    $0x0,%esi
+  80134c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801351:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801358:	00 00 00 
+  80135b:	ff d0                	call   *%rax
+}
+  80135d:	5d                   	pop    %rbp
+  80135e:	c3                   	ret
+
+000000000080135f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80135f:	55                   	push   %rbp
+  801360:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801363:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801366:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80136d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80136f:	be 00 00 00 00       	mov    $0x0,%esi
+  801374:	bf 06 00 00 00       	mov    $0x6,%edi
+  801379:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801380:	00 00 00 
+  801383:	ff d0                	call   *%rax
+}
+  801385:	5d                   	pop    %rbp
+  801386:	c3                   	ret
+
+0000000000801387 <devfile_write>:
+    if (!fd || !buf) {
+  801387:	48 85 ff             	test   %rdi,%rdi
+  80138a:	0f 84 c1 00 00 00    	je     801451 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+  801394:	41 57                	push   %r15
+  801396:	41 56                	push   %r14
+  801398:	41 55                	push   %r13
+  80139a:	41 54                	push   %r12
+  80139c:	53                   	push   %rbx
+  80139d:	48 83 ec 18          	sub    $0x18,%rsp
+  8013a1:	49 89 ff             	mov    %rdi,%r15
+  8013a4:	49 89 f5             	mov    %rsi,%r13
+  8013a7:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013aa:	48 85 f6             	test   %rsi,%rsi
+  8013ad:	0f 84 95 00 00 00    	je     801448 <devfile_write+0xc1>
+    while (n) {
+  8013b3:	48 85 d2             	test   %rdx,%rdx
+  8013b6:	0f 84 83 00 00 00    	je     80143f <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013bc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013c3:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013ca:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013cd:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013d2:	49 39 dc             	cmp    %rbx,%r12
+  8013d5:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013d9:	48 89 da             	mov    %rbx,%rdx
+  8013dc:	4c 89 ee             	mov    %r13,%rsi
+  8013df:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013e6:	00 00 00 
+  8013e9:	48 b8 73 31 80 00 00 	movabs $0x803173,%rax
+  8013f0:	00 00 00 
+  8013f3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013f5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013f9:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013fc:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	bf 04 00 00 00       	mov    $0x4,%edi
+  80140a:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801411:	00 00 00 
+  801414:	ff d0                	call   *%rax
+        if (write < 0) {
+  801416:	85 c0                	test   %eax,%eax
+  801418:	78 21                	js     80143b <devfile_write+0xb4>
+        buf += write;
+  80141a:	48 63 d0             	movslq %eax,%rdx
+  80141d:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801420:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801423:	49 29 d4             	sub    %rdx,%r12
+  801426:	75 a5                	jne    8013cd <devfile_write+0x46>
+    return totalWrite;
+  801428:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80142c:	48 83 c4 18          	add    $0x18,%rsp
+  801430:	5b                   	pop    %rbx
+  801431:	41 5c                	pop    %r12
+  801433:	41 5d                	pop    %r13
+  801435:	41 5e                	pop    %r14
+  801437:	41 5f                	pop    %r15
+  801439:	5d                   	pop    %rbp
+  80143a:	c3                   	ret
+            return write;
+  80143b:	48 98                	cltq
+  80143d:	eb ed                	jmp    80142c <devfile_write+0xa5>
+    int totalWrite = 0;
+  80143f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801446:	eb e0                	jmp    801428 <devfile_write+0xa1>
+        return -E_INVAL;
+  801448:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80144f:	eb db                	jmp    80142c <devfile_write+0xa5>
+  801451:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801458:	c3                   	ret
+
+0000000000801459 <devfile_read>:
+    if (!fd || !buf) {
+  801459:	48 85 ff             	test   %rdi,%rdi
+  80145c:	0f 84 c0 00 00 00    	je     801522 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801462:	55                   	push   %rbp
+  801463:	48 89 e5             	mov    %rsp,%rbp
+  801466:	41 57                	push   %r15
+  801468:	41 56                	push   %r14
+  80146a:	41 55                	push   %r13
+  80146c:	41 54                	push   %r12
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 18          	sub    $0x18,%rsp
+  801473:	49 89 ff             	mov    %rdi,%r15
+  801476:	49 89 f5             	mov    %rsi,%r13
+  801479:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80147c:	48 85 f6             	test   %rsi,%rsi
+  80147f:	0f 84 96 00 00 00    	je     80151b <devfile_read+0xc2>
+    while (n) {
+  801485:	48 85 d2             	test   %rdx,%rdx
+  801488:	0f 84 87 00 00 00    	je     801515 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80148e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801495:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801496:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80149d:	00 00 00 
+  8014a0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014a4:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8014a7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014ac:	49 39 c4             	cmp    %rax,%r12
+  8014af:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014b3:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014c1:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8014c8:	00 00 00 
+  8014cb:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014cd:	85 c0                	test   %eax,%eax
+  8014cf:	7e 37                	jle    801508 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014d1:	48 63 d8             	movslq %eax,%rbx
+  8014d4:	48 89 da             	mov    %rbx,%rdx
+  8014d7:	4c 89 f6             	mov    %r14,%rsi
+  8014da:	4c 89 ef             	mov    %r13,%rdi
+  8014dd:	48 b8 73 31 80 00 00 	movabs $0x803173,%rax
+  8014e4:	00 00 00 
+  8014e7:	ff d0                	call   *%rax
+        buf += read;
+  8014e9:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014ec:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014f0:	49 29 dc             	sub    %rbx,%r12
+  8014f3:	75 ab                	jne    8014a0 <devfile_read+0x47>
+  return totalRead;
+  8014f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014f9:	48 83 c4 18          	add    $0x18,%rsp
+  8014fd:	5b                   	pop    %rbx
+  8014fe:	41 5c                	pop    %r12
+  801500:	41 5d                	pop    %r13
+  801502:	41 5e                	pop    %r14
+  801504:	41 5f                	pop    %r15
+  801506:	5d                   	pop    %rbp
+  801507:	c3                   	ret
+            return read ? read : totalRead;
+  801508:	48 63 d0             	movslq %eax,%rdx
+  80150b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80150f:	48 0f 45 c2          	cmovne %rdx,%rax
+  801513:	eb e4                	jmp    8014f9 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  801515:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801519:	eb da                	jmp    8014f5 <devfile_read+0x9c>
+        return E_INVAL;
+  80151b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801520:	eb d7                	jmp    8014f9 <devfile_read+0xa0>
+  801522:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801527:	c3                   	ret
+
+0000000000801528 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801528:	48 85 ff             	test   %rdi,%rdi
+  80152b:	74 5f                	je     80158c <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	53                   	push   %rbx
+  801532:	48 83 ec 08          	sub    $0x8,%rsp
+  801536:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801539:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  801540:	00 00 00 
+  801543:	ff d0                	call   *%rax
+  801545:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80154b:	77 45                	ja     801592 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80154d:	48 89 de             	mov    %rbx,%rsi
+  801550:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801557:	00 00 00 
+  80155a:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  801561:	00 00 00 
+  801564:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801566:	be 00 00 00 00       	mov    $0x0,%esi
+  80156b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801570:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801577:	00 00 00 
+  80157a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801583:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801586:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158a:	c9                   	leave
+  80158b:	c3                   	ret
+        return -E_INVAL;
+  80158c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801591:	c3                   	ret
+        return -E_INVAL;
+  801592:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801597:	eb ed                	jmp    801586 <devfile_receive_snapshot+0x5e>
+
+0000000000801599 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	41 55                	push   %r13
+  80159f:	41 54                	push   %r12
+  8015a1:	53                   	push   %rbx
+  8015a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a6:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015a9:	48 85 f6             	test   %rsi,%rsi
+  8015ac:	0f 94 c0             	sete   %al
+  8015af:	48 85 d2             	test   %rdx,%rdx
+  8015b2:	0f 94 c2             	sete   %dl
+  8015b5:	08 d0                	or     %dl,%al
+  8015b7:	0f 85 ad 00 00 00    	jne    80166a <devfile_send_snapshot+0xd1>
+  8015bd:	48 89 fb             	mov    %rdi,%rbx
+  8015c0:	49 89 f4             	mov    %rsi,%r12
+  8015c3:	48 85 ff             	test   %rdi,%rdi
+  8015c6:	0f 84 9e 00 00 00    	je     80166a <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015cc:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8015d3:	00 00 00 
+  8015d6:	ff d0                	call   *%rax
+  8015d8:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015de:	0f 87 8d 00 00 00    	ja     801671 <devfile_send_snapshot+0xd8>
+  8015e4:	4c 89 e7             	mov    %r12,%rdi
+  8015e7:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8015ee:	00 00 00 
+  8015f1:	ff d0                	call   *%rax
+  8015f3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015f9:	77 7d                	ja     801678 <devfile_send_snapshot+0xdf>
+  8015fb:	4c 89 ef             	mov    %r13,%rdi
+  8015fe:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  801605:	00 00 00 
+  801608:	ff d0                	call   *%rax
+  80160a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801610:	77 6d                	ja     80167f <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  801612:	48 89 de             	mov    %rbx,%rsi
+  801615:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80161c:	00 00 00 
+  80161f:	48 bb 79 2f 80 00 00 	movabs $0x802f79,%rbx
+  801626:	00 00 00 
+  801629:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80162b:	4c 89 e6             	mov    %r12,%rsi
+  80162e:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801635:	00 00 00 
+  801638:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80163a:	4c 89 ee             	mov    %r13,%rsi
+  80163d:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801644:	00 00 00 
+  801647:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801649:	be 00 00 00 00       	mov    $0x0,%esi
+  80164e:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801653:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+}
+  80165f:	48 83 c4 08          	add    $0x8,%rsp
+  801663:	5b                   	pop    %rbx
+  801664:	41 5c                	pop    %r12
+  801666:	41 5d                	pop    %r13
+  801668:	5d                   	pop    %rbp
+  801669:	c3                   	ret
+        return -E_INVAL;
+  80166a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166f:	eb ee                	jmp    80165f <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801671:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801676:	eb e7                	jmp    80165f <devfile_send_snapshot+0xc6>
+  801678:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167d:	eb e0                	jmp    80165f <devfile_send_snapshot+0xc6>
+  80167f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801684:	eb d9                	jmp    80165f <devfile_send_snapshot+0xc6>
+
+0000000000801686 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801686:	48 85 ff             	test   %rdi,%rdi
+  801689:	0f 84 41 01 00 00    	je     8017d0 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80168f:	55                   	push   %rbp
+  801690:	48 89 e5             	mov    %rsp,%rbp
+  801693:	41 57                	push   %r15
+  801695:	41 56                	push   %r14
+  801697:	41 55                	push   %r13
+  801699:	41 54                	push   %r12
+  80169b:	53                   	push   %rbx
+  80169c:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a0:	49 89 fc             	mov    %rdi,%r12
+  8016a3:	49 89 f5             	mov    %rsi,%r13
+  8016a6:	48 89 d3             	mov    %rdx,%rbx
+  8016a9:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016ac:	48 85 f6             	test   %rsi,%rsi
+  8016af:	0f 84 ff 00 00 00    	je     8017b4 <devfile_diff_snapshots+0x12e>
+  8016b5:	48 85 d2             	test   %rdx,%rdx
+  8016b8:	0f 84 fd 00 00 00    	je     8017bb <devfile_diff_snapshots+0x135>
+  8016be:	48 85 c9             	test   %rcx,%rcx
+  8016c1:	0f 84 f4 00 00 00    	je     8017bb <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016c7:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8016ce:	00 00 00 
+  8016d1:	ff d0                	call   *%rax
+  8016d3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d9:	0f 87 e3 00 00 00    	ja     8017c2 <devfile_diff_snapshots+0x13c>
+  8016df:	4c 89 ef             	mov    %r13,%rdi
+  8016e2:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8016e9:	00 00 00 
+  8016ec:	ff d0                	call   *%rax
+  8016ee:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016f4:	0f 87 cf 00 00 00    	ja     8017c9 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016fa:	4c 89 e6             	mov    %r12,%rsi
+  8016fd:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801704:	00 00 00 
+  801707:	4c 89 e7             	mov    %r12,%rdi
+  80170a:	49 bf 79 2f 80 00 00 	movabs $0x802f79,%r15
+  801711:	00 00 00 
+  801714:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  801717:	4c 89 ee             	mov    %r13,%rsi
+  80171a:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801721:	00 
+  801722:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801725:	48 8b 03             	mov    (%rbx),%rax
+  801728:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80172f:	00 
+  801730:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801734:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80173b:	00 
+  80173c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801740:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801747:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801748:	be 00 00 00 00       	mov    $0x0,%esi
+  80174d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801752:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801759:	00 00 00 
+  80175c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	78 43                	js     8017a5 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801762:	49 8b 04 24          	mov    (%r12),%rax
+  801766:	48 89 03             	mov    %rax,(%rbx)
+  801769:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80176e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801772:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801777:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80177b:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801780:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801784:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801788:	48 c1 e2 03          	shl    $0x3,%rdx
+  80178c:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801791:	4c 89 f7             	mov    %r14,%rdi
+  801794:	48 b8 73 31 80 00 00 	movabs $0x803173,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8017a0:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8017a5:	48 83 c4 08          	add    $0x8,%rsp
+  8017a9:	5b                   	pop    %rbx
+  8017aa:	41 5c                	pop    %r12
+  8017ac:	41 5d                	pop    %r13
+  8017ae:	41 5e                	pop    %r14
+  8017b0:	41 5f                	pop    %r15
+  8017b2:	5d                   	pop    %rbp
+  8017b3:	c3                   	ret
+        return -E_INVAL;
+  8017b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b9:	eb ea                	jmp    8017a5 <devfile_diff_snapshots+0x11f>
+  8017bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c0:	eb e3                	jmp    8017a5 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c7:	eb dc                	jmp    8017a5 <devfile_diff_snapshots+0x11f>
+  8017c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ce:	eb d5                	jmp    8017a5 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017d5:	c3                   	ret
+
+00000000008017d6 <devfile_delete_snapshot>:
+    if (!name) {
+  8017d6:	48 85 ff             	test   %rdi,%rdi
+  8017d9:	74 5f                	je     80183a <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017db:	55                   	push   %rbp
+  8017dc:	48 89 e5             	mov    %rsp,%rbp
+  8017df:	53                   	push   %rbx
+  8017e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017e7:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+  8017f3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017f9:	77 45                	ja     801840 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017fb:	48 89 de             	mov    %rbx,%rsi
+  8017fe:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801805:	00 00 00 
+  801808:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  801814:	be 00 00 00 00       	mov    $0x0,%esi
+  801819:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80181e:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801831:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801834:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+        return -E_INVAL;
+  80183a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80183f:	c3                   	ret
+        return -E_INVAL;
+  801840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801845:	eb ed                	jmp    801834 <devfile_delete_snapshot+0x5e>
+
+0000000000801847 <devfile_accept_snapshot>:
+    if (!name) {
+  801847:	48 85 ff             	test   %rdi,%rdi
+  80184a:	74 5f                	je     8018ab <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 08          	sub    $0x8,%rsp
+  801855:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801858:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+  801864:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80186a:	77 45                	ja     8018b1 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80186c:	48 89 de             	mov    %rbx,%rsi
+  80186f:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801876:	00 00 00 
+  801879:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  801880:	00 00 00 
+  801883:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801885:	be 00 00 00 00       	mov    $0x0,%esi
+  80188a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80188f:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801896:	00 00 00 
+  801899:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a9:	c9                   	leave
+  8018aa:	c3                   	ret
+        return -E_INVAL;
+  8018ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018b0:	c3                   	ret
+        return -E_INVAL;
+  8018b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b6:	eb ed                	jmp    8018a5 <devfile_accept_snapshot+0x5e>
+
+00000000008018b8 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018b8:	48 85 ff             	test   %rdi,%rdi
+  8018bb:	0f 84 9f 00 00 00    	je     801960 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018c1:	55                   	push   %rbp
+  8018c2:	48 89 e5             	mov    %rsp,%rbp
+  8018c5:	41 54                	push   %r12
+  8018c7:	53                   	push   %rbx
+  8018c8:	48 89 fb             	mov    %rdi,%rbx
+  8018cb:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018ce:	48 85 f6             	test   %rsi,%rsi
+  8018d1:	74 78                	je     80194b <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018d3:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+  8018df:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018e5:	77 6b                	ja     801952 <devfile_create_snapshot+0x9a>
+  8018e7:	4c 89 e7             	mov    %r12,%rdi
+  8018ea:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8018f1:	00 00 00 
+  8018f4:	ff d0                	call   *%rax
+  8018f6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018fc:	77 5b                	ja     801959 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018fe:	48 89 de             	mov    %rbx,%rsi
+  801901:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801908:	00 00 00 
+  80190b:	48 bb 79 2f 80 00 00 	movabs $0x802f79,%rbx
+  801912:	00 00 00 
+  801915:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  801917:	4c 89 e6             	mov    %r12,%rsi
+  80191a:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801921:	00 00 00 
+  801924:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801926:	be 00 00 00 00       	mov    $0x0,%esi
+  80192b:	bf 08 00 00 00       	mov    $0x8,%edi
+  801930:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801937:	00 00 00 
+  80193a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801943:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801946:	5b                   	pop    %rbx
+  801947:	41 5c                	pop    %r12
+  801949:	5d                   	pop    %rbp
+  80194a:	c3                   	ret
+        return -E_INVAL;
+  80194b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801950:	eb f4                	jmp    801946 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801952:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801957:	eb ed                	jmp    801946 <devfile_create_snapshot+0x8e>
+  801959:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195e:	eb e6                	jmp    801946 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801960:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801965:	c3                   	ret
+
+0000000000801966 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801966:	55                   	push   %rbp
+  801967:	48 89 e5             	mov    %rsp,%rbp
+  80196a:	41 54                	push   %r12
+  80196c:	53                   	push   %rbx
+  80196d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801970:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801973:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80197a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80197c:	be 00 00 00 00       	mov    $0x0,%esi
+  801981:	bf 05 00 00 00       	mov    $0x5,%edi
+  801986:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 3d                	js     8019d3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801996:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80199d:	00 00 00 
+  8019a0:	4c 89 e6             	mov    %r12,%rsi
+  8019a3:	48 89 df             	mov    %rbx,%rdi
+  8019a6:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8019b2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019b9:	00 
+  8019ba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019c0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019c7:	00 
+  8019c8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d3:	5b                   	pop    %rbx
+  8019d4:	41 5c                	pop    %r12
+  8019d6:	5d                   	pop    %rbp
+  8019d7:	c3                   	ret
+
+00000000008019d8 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019d8:	55                   	push   %rbp
+  8019d9:	48 89 e5             	mov    %rsp,%rbp
+  8019dc:	41 57                	push   %r15
+  8019de:	41 56                	push   %r14
+  8019e0:	41 55                	push   %r13
+  8019e2:	41 54                	push   %r12
+  8019e4:	53                   	push   %rbx
+  8019e5:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019ed:	49 89 f5             	mov    %rsi,%r13
+  8019f0:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019f3:	48 89 f0             	mov    %rsi,%rax
+  8019f6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019fb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019ff:	75 4f                	jne    801a50 <devfile_readmap+0x78>
+  801a01:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a05:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a0b:	75 1f                	jne    801a2c <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a0d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a11:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a15:	49 be c0 21 80 00 00 	movabs $0x8021c0,%r14
+  801a1c:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a1f:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a26:	0f 87 9d 00 00 00    	ja     801ac9 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a2c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a30:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a34:	4d 85 ff             	test   %r15,%r15
+  801a37:	0f 85 cf 00 00 00    	jne    801b0c <devfile_readmap+0x134>
+  801a3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a41:	48 83 c4 38          	add    $0x38,%rsp
+  801a45:	5b                   	pop    %rbx
+  801a46:	41 5c                	pop    %r12
+  801a48:	41 5d                	pop    %r13
+  801a4a:	41 5e                	pop    %r14
+  801a4c:	41 5f                	pop    %r15
+  801a4e:	5d                   	pop    %rbp
+  801a4f:	c3                   	ret
+    size_t totalRead = 0;
+  801a50:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a57:	00 
+  801a58:	eb da                	jmp    801a34 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a5a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a5e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a61:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a68:	00 00 00 
+  801a6b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a71:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a75:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a79:	4c 89 ee             	mov    %r13,%rsi
+  801a7c:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a81:	48 b8 86 11 80 00 00 	movabs $0x801186,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	7e a3                	jle    801a34 <devfile_readmap+0x5c>
+  801a91:	48 98                	cltq
+  801a93:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a97:	72 9b                	jb     801a34 <devfile_readmap+0x5c>
+        buf += read;
+  801a99:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a9c:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a9f:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801aa3:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801aaa:	75 88                	jne    801a34 <devfile_readmap+0x5c>
+  801aac:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ab0:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801ab6:	0f 85 78 ff ff ff    	jne    801a34 <devfile_readmap+0x5c>
+  801abc:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801ac3:	0f 86 6b ff ff ff    	jbe    801a34 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ac9:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801acf:	4d 39 e7             	cmp    %r12,%r15
+  801ad2:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ad6:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801add:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ae1:	0f 84 73 ff ff ff    	je     801a5a <devfile_readmap+0x82>
+  801ae7:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801aeb:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801af0:	41 ff d6             	call   *%r14
+  801af3:	a8 40                	test   $0x40,%al
+  801af5:	0f 85 39 ff ff ff    	jne    801a34 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801afb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b02:	4c 39 e3             	cmp    %r12,%rbx
+  801b05:	72 e4                	jb     801aeb <devfile_readmap+0x113>
+  801b07:	e9 4e ff ff ff       	jmp    801a5a <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b0c:	4c 89 fa             	mov    %r15,%rdx
+  801b0f:	4c 89 ee             	mov    %r13,%rsi
+  801b12:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b16:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b22:	48 85 c0             	test   %rax,%rax
+  801b25:	78 0c                	js     801b33 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b27:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b2b:	48 01 f0             	add    %rsi,%rax
+  801b2e:	e9 0e ff ff ff       	jmp    801a41 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b33:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b37:	48 85 f6             	test   %rsi,%rsi
+  801b3a:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b3e:	e9 fe fe ff ff       	jmp    801a41 <devfile_readmap+0x69>
+
+0000000000801b43 <open>:
+open(const char *path, int mode) {
+  801b43:	55                   	push   %rbp
+  801b44:	48 89 e5             	mov    %rsp,%rbp
+  801b47:	41 55                	push   %r13
+  801b49:	41 54                	push   %r12
+  801b4b:	53                   	push   %rbx
+  801b4c:	48 83 ec 18          	sub    $0x18,%rsp
+  801b50:	49 89 fc             	mov    %rdi,%r12
+  801b53:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b56:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+  801b62:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b68:	0f 87 8a 00 00 00    	ja     801bf8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b6e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b72:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+  801b7e:	89 c3                	mov    %eax,%ebx
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 50                	js     801bd4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b84:	4c 89 e6             	mov    %r12,%rsi
+  801b87:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b8e:	00 00 00 
+  801b91:	48 89 df             	mov    %rbx,%rdi
+  801b94:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801ba0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ba7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801bab:	bf 01 00 00 00       	mov    $0x1,%edi
+  801bb0:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	89 c3                	mov    %eax,%ebx
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	78 1f                	js     801be1 <open+0x9e>
+    return fd2num(fd);
+  801bc2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bc6:	48 b8 73 06 80 00 00 	movabs $0x800673,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+  801bd2:	89 c3                	mov    %eax,%ebx
+}
+  801bd4:	89 d8                	mov    %ebx,%eax
+  801bd6:	48 83 c4 18          	add    $0x18,%rsp
+  801bda:	5b                   	pop    %rbx
+  801bdb:	41 5c                	pop    %r12
+  801bdd:	41 5d                	pop    %r13
+  801bdf:	5d                   	pop    %rbp
+  801be0:	c3                   	ret
+        fd_close(fd, 0);
+  801be1:	be 00 00 00 00       	mov    $0x0,%esi
+  801be6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bea:	48 b8 bc 07 80 00 00 	movabs $0x8007bc,%rax
+  801bf1:	00 00 00 
+  801bf4:	ff d0                	call   *%rax
+        return res;
+  801bf6:	eb dc                	jmp    801bd4 <open+0x91>
+        return -E_BAD_PATH;
+  801bf8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bfd:	eb d5                	jmp    801bd4 <open+0x91>
+
+0000000000801bff <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bff:	55                   	push   %rbp
+  801c00:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801c03:	be 00 00 00 00       	mov    $0x0,%esi
+  801c08:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c0d:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+}
+  801c19:	5d                   	pop    %rbp
+  801c1a:	c3                   	ret
+
+0000000000801c1b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c1b:	55                   	push   %rbp
+  801c1c:	48 89 e5             	mov    %rsp,%rbp
+  801c1f:	41 54                	push   %r12
+  801c21:	53                   	push   %rbx
+  801c22:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c25:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+  801c31:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c34:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  801c3b:	00 00 00 
+  801c3e:	48 89 df             	mov    %rbx,%rdi
+  801c41:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  801c48:	00 00 00 
+  801c4b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c4d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c52:	41 2b 04 24          	sub    (%r12),%eax
+  801c56:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c5c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c63:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c66:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c6d:	00 00 00 
+  801c70:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	5b                   	pop    %rbx
+  801c7d:	41 5c                	pop    %r12
+  801c7f:	5d                   	pop    %rbp
+  801c80:	c3                   	ret
+
+0000000000801c81 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c81:	55                   	push   %rbp
+  801c82:	48 89 e5             	mov    %rsp,%rbp
+  801c85:	41 54                	push   %r12
+  801c87:	53                   	push   %rbx
+  801c88:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c90:	48 89 fe             	mov    %rdi,%rsi
+  801c93:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c98:	49 bc 6f 03 80 00 00 	movabs $0x80036f,%r12
+  801c9f:	00 00 00 
+  801ca2:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801ca5:	48 89 df             	mov    %rbx,%rdi
+  801ca8:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801caf:	00 00 00 
+  801cb2:	ff d0                	call   *%rax
+  801cb4:	48 89 c6             	mov    %rax,%rsi
+  801cb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc1:	41 ff d4             	call   *%r12
+}
+  801cc4:	5b                   	pop    %rbx
+  801cc5:	41 5c                	pop    %r12
+  801cc7:	5d                   	pop    %rbp
+  801cc8:	c3                   	ret
+
+0000000000801cc9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cc9:	55                   	push   %rbp
+  801cca:	48 89 e5             	mov    %rsp,%rbp
+  801ccd:	41 57                	push   %r15
+  801ccf:	41 56                	push   %r14
+  801cd1:	41 55                	push   %r13
+  801cd3:	41 54                	push   %r12
+  801cd5:	53                   	push   %rbx
+  801cd6:	48 83 ec 18          	sub    $0x18,%rsp
+  801cda:	49 89 fc             	mov    %rdi,%r12
+  801cdd:	49 89 f5             	mov    %rsi,%r13
+  801ce0:	49 89 d7             	mov    %rdx,%r15
+  801ce3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ce7:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cf3:	4d 85 ff             	test   %r15,%r15
+  801cf6:	0f 84 af 00 00 00    	je     801dab <devpipe_write+0xe2>
+  801cfc:	48 89 c3             	mov    %rax,%rbx
+  801cff:	4c 89 f8             	mov    %r15,%rax
+  801d02:	4d 89 ef             	mov    %r13,%r15
+  801d05:	4c 01 e8             	add    %r13,%rax
+  801d08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d0c:	49 bd 77 02 80 00 00 	movabs $0x800277,%r13
+  801d13:	00 00 00 
+            sys_yield();
+  801d16:	49 be 14 02 80 00 00 	movabs $0x800214,%r14
+  801d1d:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d20:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d23:	48 63 ce             	movslq %esi,%rcx
+  801d26:	48 63 03             	movslq (%rbx),%rax
+  801d29:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d2f:	48 39 c1             	cmp    %rax,%rcx
+  801d32:	72 2e                	jb     801d62 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d34:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d39:	48 89 da             	mov    %rbx,%rdx
+  801d3c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d41:	4c 89 e7             	mov    %r12,%rdi
+  801d44:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	74 66                	je     801db1 <devpipe_write+0xe8>
+            sys_yield();
+  801d4b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d4e:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d51:	48 63 ce             	movslq %esi,%rcx
+  801d54:	48 63 03             	movslq (%rbx),%rax
+  801d57:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d5d:	48 39 c1             	cmp    %rax,%rcx
+  801d60:	73 d2                	jae    801d34 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d62:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d66:	48 89 ca             	mov    %rcx,%rdx
+  801d69:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d6d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d74:	08 10 20 
+  801d77:	48 f7 e2             	mul    %rdx
+  801d7a:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d7e:	48 89 d0             	mov    %rdx,%rax
+  801d81:	48 c1 e0 09          	shl    $0x9,%rax
+  801d85:	48 29 d0             	sub    %rdx,%rax
+  801d88:	48 c1 e0 03          	shl    $0x3,%rax
+  801d8c:	48 29 c1             	sub    %rax,%rcx
+  801d8f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d94:	83 c6 01             	add    $0x1,%esi
+  801d97:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d9a:	49 83 c7 01          	add    $0x1,%r15
+  801d9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da2:	49 39 c7             	cmp    %rax,%r15
+  801da5:	0f 85 75 ff ff ff    	jne    801d20 <devpipe_write+0x57>
+    return n;
+  801dab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801daf:	eb 05                	jmp    801db6 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db6:	48 83 c4 18          	add    $0x18,%rsp
+  801dba:	5b                   	pop    %rbx
+  801dbb:	41 5c                	pop    %r12
+  801dbd:	41 5d                	pop    %r13
+  801dbf:	41 5e                	pop    %r14
+  801dc1:	41 5f                	pop    %r15
+  801dc3:	5d                   	pop    %rbp
+  801dc4:	c3                   	ret
+
+0000000000801dc5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801dc5:	55                   	push   %rbp
+  801dc6:	48 89 e5             	mov    %rsp,%rbp
+  801dc9:	41 57                	push   %r15
+  801dcb:	41 56                	push   %r14
+  801dcd:	41 55                	push   %r13
+  801dcf:	41 54                	push   %r12
+  801dd1:	53                   	push   %rbx
+  801dd2:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd6:	49 89 fc             	mov    %rdi,%r12
+  801dd9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801ddd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801de1:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801de8:	00 00 00 
+  801deb:	ff d0                	call   *%rax
+  801ded:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801df0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801df6:	49 bd 77 02 80 00 00 	movabs $0x800277,%r13
+  801dfd:	00 00 00 
+            sys_yield();
+  801e00:	49 be 14 02 80 00 00 	movabs $0x800214,%r14
+  801e07:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e0a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e0f:	74 7d                	je     801e8e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e11:	8b 03                	mov    (%rbx),%eax
+  801e13:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e16:	75 26                	jne    801e3e <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e18:	4d 85 ff             	test   %r15,%r15
+  801e1b:	75 77                	jne    801e94 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e1d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e22:	48 89 da             	mov    %rbx,%rdx
+  801e25:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e2a:	4c 89 e7             	mov    %r12,%rdi
+  801e2d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	74 72                	je     801ea6 <devpipe_read+0xe1>
+            sys_yield();
+  801e34:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e37:	8b 03                	mov    (%rbx),%eax
+  801e39:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e3c:	74 df                	je     801e1d <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e3e:	48 63 c8             	movslq %eax,%rcx
+  801e41:	48 89 ca             	mov    %rcx,%rdx
+  801e44:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e48:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e4f:	08 10 20 
+  801e52:	48 89 d0             	mov    %rdx,%rax
+  801e55:	48 f7 e6             	mul    %rsi
+  801e58:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e5c:	48 89 d0             	mov    %rdx,%rax
+  801e5f:	48 c1 e0 09          	shl    $0x9,%rax
+  801e63:	48 29 d0             	sub    %rdx,%rax
+  801e66:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e6d:	00 
+  801e6e:	48 89 c8             	mov    %rcx,%rax
+  801e71:	48 29 d0             	sub    %rdx,%rax
+  801e74:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e79:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e7d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e81:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e84:	49 83 c7 01          	add    $0x1,%r15
+  801e88:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e8c:	75 83                	jne    801e11 <devpipe_read+0x4c>
+    return n;
+  801e8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e92:	eb 03                	jmp    801e97 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e94:	4c 89 f8             	mov    %r15,%rax
+}
+  801e97:	48 83 c4 18          	add    $0x18,%rsp
+  801e9b:	5b                   	pop    %rbx
+  801e9c:	41 5c                	pop    %r12
+  801e9e:	41 5d                	pop    %r13
+  801ea0:	41 5e                	pop    %r14
+  801ea2:	41 5f                	pop    %r15
+  801ea4:	5d                   	pop    %rbp
+  801ea5:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eab:	eb ea                	jmp    801e97 <devpipe_read+0xd2>
+
+0000000000801ead <pipe>:
+pipe(int pfd[2]) {
+  801ead:	55                   	push   %rbp
+  801eae:	48 89 e5             	mov    %rsp,%rbp
+  801eb1:	41 55                	push   %r13
+  801eb3:	41 54                	push   %r12
+  801eb5:	53                   	push   %rbx
+  801eb6:	48 83 ec 18          	sub    $0x18,%rsp
+  801eba:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ebd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ec1:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+  801ecd:	89 c3                	mov    %eax,%ebx
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	0f 88 a0 01 00 00    	js     802077 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ed7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801edc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ee1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eea:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+  801ef6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	0f 88 77 01 00 00    	js     802077 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f00:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801f04:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  801f0b:	00 00 00 
+  801f0e:	ff d0                	call   *%rax
+  801f10:	89 c3                	mov    %eax,%ebx
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	0f 88 43 01 00 00    	js     80205d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f1a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f24:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2d:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+  801f39:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	0f 88 1a 01 00 00    	js     80205d <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f43:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f47:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f56:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f60:	48 89 c6             	mov    %rax,%rsi
+  801f63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f68:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+  801f74:	89 c3                	mov    %eax,%ebx
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	0f 88 c5 00 00 00    	js     802043 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f7e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f82:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	48 89 c1             	mov    %rax,%rcx
+  801f91:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f97:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa2:	4c 89 ee             	mov    %r13,%rsi
+  801fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801faa:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  801fb1:	00 00 00 
+  801fb4:	ff d0                	call   *%rax
+  801fb6:	89 c3                	mov    %eax,%ebx
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 6e                	js     80202a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fbc:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fc1:	4c 89 ef             	mov    %r13,%rdi
+  801fc4:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	83 f8 02             	cmp    $0x2,%eax
+  801fd3:	0f 85 ab 00 00 00    	jne    802084 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fd9:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fe0:	00 00 
+  801fe2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fe6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fe8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801ff3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801ff7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801ff9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ffd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802004:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802008:	48 bb 73 06 80 00 00 	movabs $0x800673,%rbx
+  80200f:	00 00 00 
+  802012:	ff d3                	call   *%rbx
+  802014:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802018:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80201c:	ff d3                	call   *%rbx
+  80201e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802028:	eb 4d                	jmp    802077 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80202a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80202f:	4c 89 ee             	mov    %r13,%rsi
+  802032:	bf 00 00 00 00       	mov    $0x0,%edi
+  802037:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  80203e:	00 00 00 
+  802041:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802043:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802048:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80204c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802051:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  802058:	00 00 00 
+  80205b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80205d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802062:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206b:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+}
+  802077:	89 d8                	mov    %ebx,%eax
+  802079:	48 83 c4 18          	add    $0x18,%rsp
+  80207d:	5b                   	pop    %rbx
+  80207e:	41 5c                	pop    %r12
+  802080:	41 5d                	pop    %r13
+  802082:	5d                   	pop    %rbp
+  802083:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802084:	48 b9 d0 37 80 00 00 	movabs $0x8037d0,%rcx
+  80208b:	00 00 00 
+  80208e:	48 ba a7 37 80 00 00 	movabs $0x8037a7,%rdx
+  802095:	00 00 00 
+  802098:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80209d:	48 bf bc 37 80 00 00 	movabs $0x8037bc,%rdi
+  8020a4:	00 00 00 
+  8020a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ac:	49 b8 04 25 80 00 00 	movabs $0x802504,%r8
+  8020b3:	00 00 00 
+  8020b6:	41 ff d0             	call   *%r8
+
+00000000008020b9 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020c5:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020d1:	85 c0                	test   %eax,%eax
+  8020d3:	78 35                	js     80210a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020d5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d9:	48 b8 85 06 80 00 00 	movabs $0x800685,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020e8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020f2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020f6:	48 b8 77 02 80 00 00 	movabs $0x800277,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+  802102:	85 c0                	test   %eax,%eax
+  802104:	0f 94 c0             	sete   %al
+  802107:	0f b6 c0             	movzbl %al,%eax
+}
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+
+000000000080210c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80210c:	48 89 f8             	mov    %rdi,%rax
+  80210f:	48 c1 e8 27          	shr    $0x27,%rax
+  802113:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80211a:	01 00 00 
+  80211d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802121:	f6 c2 01             	test   $0x1,%dl
+  802124:	74 6d                	je     802193 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802126:	48 89 f8             	mov    %rdi,%rax
+  802129:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80212d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802134:	01 00 00 
+  802137:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80213b:	f6 c2 01             	test   $0x1,%dl
+  80213e:	74 62                	je     8021a2 <get_uvpt_entry+0x96>
+  802140:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802147:	01 00 00 
+  80214a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80214e:	f6 c2 80             	test   $0x80,%dl
+  802151:	75 4f                	jne    8021a2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802153:	48 89 f8             	mov    %rdi,%rax
+  802156:	48 c1 e8 15          	shr    $0x15,%rax
+  80215a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802161:	01 00 00 
+  802164:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802168:	f6 c2 01             	test   $0x1,%dl
+  80216b:	74 44                	je     8021b1 <get_uvpt_entry+0xa5>
+  80216d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802174:	01 00 00 
+  802177:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80217b:	f6 c2 80             	test   $0x80,%dl
+  80217e:	75 31                	jne    8021b1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802180:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802184:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80218b:	01 00 00 
+  80218e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802192:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802193:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80219a:	01 00 00 
+  80219d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8021a2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021a9:	01 00 00 
+  8021ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021b0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021b1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021b8:	01 00 00 
+  8021bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021bf:	c3                   	ret
+
+00000000008021c0 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021c0:	55                   	push   %rbp
+  8021c1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021c4:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021d3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021d8:	89 c1                	mov    %eax,%ecx
+  8021da:	83 c9 04             	or     $0x4,%ecx
+  8021dd:	f6 c2 01             	test   $0x1,%dl
+  8021e0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021e3:	89 c1                	mov    %eax,%ecx
+  8021e5:	83 c9 02             	or     $0x2,%ecx
+  8021e8:	f6 c2 02             	test   $0x2,%dl
+  8021eb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021ee:	89 c1                	mov    %eax,%ecx
+  8021f0:	83 c9 01             	or     $0x1,%ecx
+  8021f3:	48 85 d2             	test   %rdx,%rdx
+  8021f6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021f9:	89 c1                	mov    %eax,%ecx
+  8021fb:	83 c9 40             	or     $0x40,%ecx
+  8021fe:	f6 c6 04             	test   $0x4,%dh
+  802201:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802204:	5d                   	pop    %rbp
+  802205:	c3                   	ret
+
+0000000000802206 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80220a:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802216:	48 c1 e8 06          	shr    $0x6,%rax
+  80221a:	83 e0 01             	and    $0x1,%eax
+}
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+
+000000000080221f <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802223:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  80222a:	00 00 00 
+  80222d:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80222f:	48 c1 e8 05          	shr    $0x5,%rax
+  802233:	83 e0 01             	and    $0x1,%eax
+}
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+
+0000000000802238 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80223c:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  802243:	00 00 00 
+  802246:	ff d0                	call   *%rax
+  802248:	83 e0 01             	and    $0x1,%eax
+}
+  80224b:	5d                   	pop    %rbp
+  80224c:	c3                   	ret
+
+000000000080224d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80224d:	55                   	push   %rbp
+  80224e:	48 89 e5             	mov    %rsp,%rbp
+  802251:	41 57                	push   %r15
+  802253:	41 56                	push   %r14
+  802255:	41 55                	push   %r13
+  802257:	41 54                	push   %r12
+  802259:	53                   	push   %rbx
+  80225a:	48 83 ec 18          	sub    $0x18,%rsp
+  80225e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802262:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802266:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80226b:	49 bd 38 22 80 00 00 	movabs $0x802238,%r13
+  802272:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802275:	49 bf c0 21 80 00 00 	movabs $0x8021c0,%r15
+  80227c:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80227f:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802286:	00 00 00 
+  802289:	eb 0c                	jmp    802297 <foreach_shared_region+0x4a>
+  80228b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802292:	4c 39 f3             	cmp    %r14,%rbx
+  802295:	74 2e                	je     8022c5 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  802297:	48 89 df             	mov    %rbx,%rdi
+  80229a:	41 ff d5             	call   *%r13
+  80229d:	84 c0                	test   %al,%al
+  80229f:	74 ea                	je     80228b <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8022a1:	48 89 df             	mov    %rbx,%rdi
+  8022a4:	41 ff d7             	call   *%r15
+  8022a7:	a8 40                	test   $0x40,%al
+  8022a9:	74 e0                	je     80228b <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022ab:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8022b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022b6:	48 89 df             	mov    %rbx,%rdi
+  8022b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022bd:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022bf:	85 c0                	test   %eax,%eax
+  8022c1:	79 c8                	jns    80228b <foreach_shared_region+0x3e>
+  8022c3:	eb 05                	jmp    8022ca <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ca:	48 83 c4 18          	add    $0x18,%rsp
+  8022ce:	5b                   	pop    %rbx
+  8022cf:	41 5c                	pop    %r12
+  8022d1:	41 5d                	pop    %r13
+  8022d3:	41 5e                	pop    %r14
+  8022d5:	41 5f                	pop    %r15
+  8022d7:	5d                   	pop    %rbp
+  8022d8:	c3                   	ret
+
+00000000008022d9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022de:	c3                   	ret
+
+00000000008022df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022e6:	48 be f4 37 80 00 00 	movabs $0x8037f4,%rsi
+  8022ed:	00 00 00 
+  8022f0:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+    return 0;
+}
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802301:	5d                   	pop    %rbp
+  802302:	c3                   	ret
+
+0000000000802303 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802303:	55                   	push   %rbp
+  802304:	48 89 e5             	mov    %rsp,%rbp
+  802307:	41 57                	push   %r15
+  802309:	41 56                	push   %r14
+  80230b:	41 55                	push   %r13
+  80230d:	41 54                	push   %r12
+  80230f:	53                   	push   %rbx
+  802310:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802317:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80231e:	48 85 d2             	test   %rdx,%rdx
+  802321:	74 7a                	je     80239d <devcons_write+0x9a>
+  802323:	49 89 d6             	mov    %rdx,%r14
+  802326:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80232c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802331:	49 bf 73 31 80 00 00 	movabs $0x803173,%r15
+  802338:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80233b:	4c 89 f3             	mov    %r14,%rbx
+  80233e:	48 29 f3             	sub    %rsi,%rbx
+  802341:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802346:	48 39 c3             	cmp    %rax,%rbx
+  802349:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80234d:	4c 63 eb             	movslq %ebx,%r13
+  802350:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802357:	48 01 c6             	add    %rax,%rsi
+  80235a:	4c 89 ea             	mov    %r13,%rdx
+  80235d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802364:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802367:	4c 89 ee             	mov    %r13,%rsi
+  80236a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802371:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  802378:	00 00 00 
+  80237b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80237d:	41 01 dc             	add    %ebx,%r12d
+  802380:	49 63 f4             	movslq %r12d,%rsi
+  802383:	4c 39 f6             	cmp    %r14,%rsi
+  802386:	72 b3                	jb     80233b <devcons_write+0x38>
+    return res;
+  802388:	49 63 c4             	movslq %r12d,%rax
+}
+  80238b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802392:	5b                   	pop    %rbx
+  802393:	41 5c                	pop    %r12
+  802395:	41 5d                	pop    %r13
+  802397:	41 5e                	pop    %r14
+  802399:	41 5f                	pop    %r15
+  80239b:	5d                   	pop    %rbp
+  80239c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80239d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023a3:	eb e3                	jmp    802388 <devcons_write+0x85>
+
+00000000008023a5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023a5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ad:	48 85 c0             	test   %rax,%rax
+  8023b0:	74 55                	je     802407 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 55                	push   %r13
+  8023b8:	41 54                	push   %r12
+  8023ba:	53                   	push   %rbx
+  8023bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8023bf:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023c2:	48 bb 47 01 80 00 00 	movabs $0x800147,%rbx
+  8023c9:	00 00 00 
+  8023cc:	49 bc 14 02 80 00 00 	movabs $0x800214,%r12
+  8023d3:	00 00 00 
+  8023d6:	eb 03                	jmp    8023db <devcons_read+0x36>
+  8023d8:	41 ff d4             	call   *%r12
+  8023db:	ff d3                	call   *%rbx
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	74 f7                	je     8023d8 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023e1:	48 63 d0             	movslq %eax,%rdx
+  8023e4:	78 13                	js     8023f9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023eb:	83 f8 04             	cmp    $0x4,%eax
+  8023ee:	74 09                	je     8023f9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023f0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023f4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023f9:	48 89 d0             	mov    %rdx,%rax
+  8023fc:	48 83 c4 08          	add    $0x8,%rsp
+  802400:	5b                   	pop    %rbx
+  802401:	41 5c                	pop    %r12
+  802403:	41 5d                	pop    %r13
+  802405:	5d                   	pop    %rbp
+  802406:	c3                   	ret
+  802407:	48 89 d0             	mov    %rdx,%rax
+  80240a:	c3                   	ret
+
+000000000080240b <cputchar>:
+cputchar(int ch) {
+  80240b:	55                   	push   %rbp
+  80240c:	48 89 e5             	mov    %rsp,%rbp
+  80240f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802413:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802417:	be 01 00 00 00       	mov    $0x1,%esi
+  80241c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802420:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+}
+  80242c:	c9                   	leave
+  80242d:	c3                   	ret
+
+000000000080242e <getchar>:
+getchar(void) {
+  80242e:	55                   	push   %rbp
+  80242f:	48 89 e5             	mov    %rsp,%rbp
+  802432:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802436:	ba 01 00 00 00       	mov    $0x1,%edx
+  80243b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80243f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802444:	48 b8 e4 09 80 00 00 	movabs $0x8009e4,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+  802450:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802452:	85 c0                	test   %eax,%eax
+  802454:	78 06                	js     80245c <getchar+0x2e>
+  802456:	74 08                	je     802460 <getchar+0x32>
+  802458:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80245c:	89 d0                	mov    %edx,%eax
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802460:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802465:	eb f5                	jmp    80245c <getchar+0x2e>
+
+0000000000802467 <iscons>:
+iscons(int fdnum) {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80246f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802473:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 18                	js     80249b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802483:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802487:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80248e:	00 00 00 
+  802491:	8b 00                	mov    (%rax),%eax
+  802493:	39 02                	cmp    %eax,(%rdx)
+  802495:	0f 94 c0             	sete   %al
+  802498:	0f b6 c0             	movzbl %al,%eax
+}
+  80249b:	c9                   	leave
+  80249c:	c3                   	ret
+
+000000000080249d <opencons>:
+opencons(void) {
+  80249d:	55                   	push   %rbp
+  80249e:	48 89 e5             	mov    %rsp,%rbp
+  8024a1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024a5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024a9:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	78 49                	js     802502 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024b9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024c3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024cc:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 26                	js     802502 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024e0:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024e7:	00 00 
+  8024e9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024eb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024ef:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024f6:	48 b8 73 06 80 00 00 	movabs $0x800673,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+}
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+
+0000000000802504 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	41 56                	push   %r14
+  80250a:	41 55                	push   %r13
+  80250c:	41 54                	push   %r12
+  80250e:	53                   	push   %rbx
+  80250f:	48 83 ec 50          	sub    $0x50,%rsp
+  802513:	49 89 fc             	mov    %rdi,%r12
+  802516:	41 89 f5             	mov    %esi,%r13d
+  802519:	48 89 d3             	mov    %rdx,%rbx
+  80251c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802520:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802524:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802528:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80252f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802533:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802537:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80253b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80253f:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802546:	00 00 00 
+  802549:	4c 8b 30             	mov    (%rax),%r14
+  80254c:	48 b8 e3 01 80 00 00 	movabs $0x8001e3,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+  802558:	89 c6                	mov    %eax,%esi
+  80255a:	45 89 e8             	mov    %r13d,%r8d
+  80255d:	4c 89 e1             	mov    %r12,%rcx
+  802560:	4c 89 f2             	mov    %r14,%rdx
+  802563:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  80256a:	00 00 00 
+  80256d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802572:	49 bc 54 26 80 00 00 	movabs $0x802654,%r12
+  802579:	00 00 00 
+  80257c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80257f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802583:	48 89 df             	mov    %rbx,%rdi
+  802586:	48 b8 f0 25 80 00 00 	movabs $0x8025f0,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+    cprintf("\n");
+  802592:	48 bf a4 36 80 00 00 	movabs $0x8036a4,%rdi
+  802599:	00 00 00 
+  80259c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8025a4:	cc                   	int3
+  8025a5:	eb fd                	jmp    8025a4 <_panic+0xa0>
+
+00000000008025a7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8025a7:	55                   	push   %rbp
+  8025a8:	48 89 e5             	mov    %rsp,%rbp
+  8025ab:	53                   	push   %rbx
+  8025ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025b3:	8b 06                	mov    (%rsi),%eax
+  8025b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8025b8:	89 16                	mov    %edx,(%rsi)
+  8025ba:	48 98                	cltq
+  8025bc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025c1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025c7:	74 0a                	je     8025d3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025c9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d1:	c9                   	leave
+  8025d2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025d3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025d7:	be ff 00 00 00       	mov    $0xff,%esi
+  8025dc:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025e8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025ee:	eb d9                	jmp    8025c9 <putch+0x22>
+
+00000000008025f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025f0:	55                   	push   %rbp
+  8025f1:	48 89 e5             	mov    %rsp,%rbp
+  8025f4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025fb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025fe:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802605:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80260a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802612:	48 89 f1             	mov    %rsi,%rcx
+  802615:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80261c:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  802623:	00 00 00 
+  802626:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802632:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802639:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802640:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80264c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802652:	c9                   	leave
+  802653:	c3                   	ret
+
+0000000000802654 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802654:	55                   	push   %rbp
+  802655:	48 89 e5             	mov    %rsp,%rbp
+  802658:	48 83 ec 50          	sub    $0x50,%rsp
+  80265c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802660:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802664:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802668:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80266c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802670:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802677:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80267b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80267f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802683:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802687:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80268b:	48 b8 f0 25 80 00 00 	movabs $0x8025f0,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802697:	c9                   	leave
+  802698:	c3                   	ret
+
+0000000000802699 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	41 57                	push   %r15
+  80269f:	41 56                	push   %r14
+  8026a1:	41 55                	push   %r13
+  8026a3:	41 54                	push   %r12
+  8026a5:	53                   	push   %rbx
+  8026a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8026aa:	49 89 fc             	mov    %rdi,%r12
+  8026ad:	49 89 f5             	mov    %rsi,%r13
+  8026b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026b4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026b7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026ba:	41 89 cf             	mov    %ecx,%r15d
+  8026bd:	4c 39 fa             	cmp    %r15,%rdx
+  8026c0:	73 5b                	jae    80271d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026c2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026c6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026ca:	85 db                	test   %ebx,%ebx
+  8026cc:	7e 0e                	jle    8026dc <print_num+0x43>
+            putch(padc, put_arg);
+  8026ce:	4c 89 ee             	mov    %r13,%rsi
+  8026d1:	44 89 f7             	mov    %r14d,%edi
+  8026d4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026d7:	83 eb 01             	sub    $0x1,%ebx
+  8026da:	75 f2                	jne    8026ce <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026dc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026e0:	48 b9 34 38 80 00 00 	movabs $0x803834,%rcx
+  8026e7:	00 00 00 
+  8026ea:	48 b8 23 38 80 00 00 	movabs $0x803823,%rax
+  8026f1:	00 00 00 
+  8026f4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802701:	49 f7 f7             	div    %r15
+  802704:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802708:	4c 89 ee             	mov    %r13,%rsi
+  80270b:	41 ff d4             	call   *%r12
+}
+  80270e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802712:	5b                   	pop    %rbx
+  802713:	41 5c                	pop    %r12
+  802715:	41 5d                	pop    %r13
+  802717:	41 5e                	pop    %r14
+  802719:	41 5f                	pop    %r15
+  80271b:	5d                   	pop    %rbp
+  80271c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80271d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802721:	ba 00 00 00 00       	mov    $0x0,%edx
+  802726:	49 f7 f7             	div    %r15
+  802729:	48 83 ec 08          	sub    $0x8,%rsp
+  80272d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802731:	52                   	push   %rdx
+  802732:	45 0f be c9          	movsbl %r9b,%r9d
+  802736:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80273a:	48 89 c2             	mov    %rax,%rdx
+  80273d:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  802744:	00 00 00 
+  802747:	ff d0                	call   *%rax
+  802749:	48 83 c4 10          	add    $0x10,%rsp
+  80274d:	eb 8d                	jmp    8026dc <print_num+0x43>
+
+000000000080274f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80274f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802753:	48 8b 06             	mov    (%rsi),%rax
+  802756:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80275a:	73 0a                	jae    802766 <sprintputch+0x17>
+        *state->start++ = ch;
+  80275c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802760:	48 89 16             	mov    %rdx,(%rsi)
+  802763:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802766:	c3                   	ret
+
+0000000000802767 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	48 83 ec 50          	sub    $0x50,%rsp
+  80276f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802773:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802777:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80277b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802782:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802786:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80278a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80278e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802792:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802796:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+}
+  8027a2:	c9                   	leave
+  8027a3:	c3                   	ret
+
+00000000008027a4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8027a4:	55                   	push   %rbp
+  8027a5:	48 89 e5             	mov    %rsp,%rbp
+  8027a8:	41 57                	push   %r15
+  8027aa:	41 56                	push   %r14
+  8027ac:	41 55                	push   %r13
+  8027ae:	41 54                	push   %r12
+  8027b0:	53                   	push   %rbx
+  8027b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8027b5:	49 89 fe             	mov    %rdi,%r14
+  8027b8:	49 89 f5             	mov    %rsi,%r13
+  8027bb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027be:	48 8b 01             	mov    (%rcx),%rax
+  8027c1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027c5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027cd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027d5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027d9:	0f b6 3b             	movzbl (%rbx),%edi
+  8027dc:	40 80 ff 25          	cmp    $0x25,%dil
+  8027e0:	74 18                	je     8027fa <vprintfmt+0x56>
+            if (!ch) return;
+  8027e2:	40 84 ff             	test   %dil,%dil
+  8027e5:	0f 84 b1 06 00 00    	je     802e9c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027eb:	40 0f b6 ff          	movzbl %dil,%edi
+  8027ef:	4c 89 ee             	mov    %r13,%rsi
+  8027f2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027f5:	4c 89 e3             	mov    %r12,%rbx
+  8027f8:	eb db                	jmp    8027d5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ff:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802803:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802808:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80280e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802815:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802819:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80281e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802823:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802826:	83 e8 23             	sub    $0x23,%eax
+  802829:	3c 57                	cmp    $0x57,%al
+  80282b:	0f 87 51 06 00 00    	ja     802e82 <vprintfmt+0x6de>
+  802831:	0f b6 c0             	movzbl %al,%eax
+  802834:	48 b9 c0 39 80 00 00 	movabs $0x8039c0,%rcx
+  80283b:	00 00 00 
+  80283e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802841:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802844:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802848:	eb cf                	jmp    802819 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80284a:	49 89 dc             	mov    %rbx,%r12
+  80284d:	be 01 00 00 00       	mov    $0x1,%esi
+  802852:	eb c5                	jmp    802819 <vprintfmt+0x75>
+            padc = ch;
+  802854:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802858:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80285b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80285e:	eb b9                	jmp    802819 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802860:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802863:	83 f8 2f             	cmp    $0x2f,%eax
+  802866:	77 24                	ja     80288c <vprintfmt+0xe8>
+  802868:	89 c1                	mov    %eax,%ecx
+  80286a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80286e:	83 c0 08             	add    $0x8,%eax
+  802871:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802874:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802877:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80287a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80287e:	79 99                	jns    802819 <vprintfmt+0x75>
+                width = precision;
+  802880:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802884:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80288a:	eb 8d                	jmp    802819 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80288c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802890:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802898:	eb da                	jmp    802874 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80289a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80289f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028a3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028a9:	3c 39                	cmp    $0x39,%al
+  8028ab:	77 1c                	ja     8028c9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8028ad:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8028b1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028b5:	0f b6 c0             	movzbl %al,%eax
+  8028b8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028bd:	0f b6 03             	movzbl (%rbx),%eax
+  8028c0:	3c 39                	cmp    $0x39,%al
+  8028c2:	76 e9                	jbe    8028ad <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028c4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028c7:	eb b1                	jmp    80287a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028c9:	49 89 dc             	mov    %rbx,%r12
+  8028cc:	eb ac                	jmp    80287a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028ce:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028d1:	85 c9                	test   %ecx,%ecx
+  8028d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d8:	0f 49 c1             	cmovns %ecx,%eax
+  8028db:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028e1:	e9 33 ff ff ff       	jmp    802819 <vprintfmt+0x75>
+            lflag++;
+  8028e6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028e9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028ec:	e9 28 ff ff ff       	jmp    802819 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8028f7:	77 19                	ja     802912 <vprintfmt+0x16e>
+  8028f9:	89 c2                	mov    %eax,%edx
+  8028fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028ff:	83 c0 08             	add    $0x8,%eax
+  802902:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802905:	8b 3a                	mov    (%rdx),%edi
+  802907:	4c 89 ee             	mov    %r13,%rsi
+  80290a:	41 ff d6             	call   *%r14
+            break;
+  80290d:	e9 c3 fe ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802912:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802916:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80291a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80291e:	eb e5                	jmp    802905 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802923:	83 f8 2f             	cmp    $0x2f,%eax
+  802926:	77 5a                	ja     802982 <vprintfmt+0x1de>
+  802928:	89 c2                	mov    %eax,%edx
+  80292a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80292e:	83 c0 08             	add    $0x8,%eax
+  802931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802934:	8b 02                	mov    (%rdx),%eax
+  802936:	89 c1                	mov    %eax,%ecx
+  802938:	f7 d9                	neg    %ecx
+  80293a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80293d:	83 f9 14             	cmp    $0x14,%ecx
+  802940:	7f 4e                	jg     802990 <vprintfmt+0x1ec>
+  802942:	48 63 c1             	movslq %ecx,%rax
+  802945:	48 ba 80 3c 80 00 00 	movabs $0x803c80,%rdx
+  80294c:	00 00 00 
+  80294f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802953:	48 85 c0             	test   %rax,%rax
+  802956:	74 38                	je     802990 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802958:	48 89 c1             	mov    %rax,%rcx
+  80295b:	48 ba b9 37 80 00 00 	movabs $0x8037b9,%rdx
+  802962:	00 00 00 
+  802965:	4c 89 ee             	mov    %r13,%rsi
+  802968:	4c 89 f7             	mov    %r14,%rdi
+  80296b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802970:	49 b8 67 27 80 00 00 	movabs $0x802767,%r8
+  802977:	00 00 00 
+  80297a:	41 ff d0             	call   *%r8
+  80297d:	e9 53 fe ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80298a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80298e:	eb a4                	jmp    802934 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802990:	48 ba 4c 38 80 00 00 	movabs $0x80384c,%rdx
+  802997:	00 00 00 
+  80299a:	4c 89 ee             	mov    %r13,%rsi
+  80299d:	4c 89 f7             	mov    %r14,%rdi
+  8029a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a5:	49 b8 67 27 80 00 00 	movabs $0x802767,%r8
+  8029ac:	00 00 00 
+  8029af:	41 ff d0             	call   *%r8
+  8029b2:	e9 1e fe ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8029bd:	77 6c                	ja     802a2b <vprintfmt+0x287>
+  8029bf:	89 c2                	mov    %eax,%edx
+  8029c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029c5:	83 c0 08             	add    $0x8,%eax
+  8029c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029cb:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029ce:	48 85 d2             	test   %rdx,%rdx
+  8029d1:	48 b8 45 38 80 00 00 	movabs $0x803845,%rax
+  8029d8:	00 00 00 
+  8029db:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029df:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029e3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029e7:	7e 06                	jle    8029ef <vprintfmt+0x24b>
+  8029e9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029ed:	75 4a                	jne    802a39 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029ef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029f3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029f7:	0f b6 00             	movzbl (%rax),%eax
+  8029fa:	84 c0                	test   %al,%al
+  8029fc:	0f 85 9a 00 00 00    	jne    802a9c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802a02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a05:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	0f 8e c4 fd ff ff    	jle    8027d5 <vprintfmt+0x31>
+  802a11:	4c 89 ee             	mov    %r13,%rsi
+  802a14:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a19:	41 ff d6             	call   *%r14
+  802a1c:	41 83 ec 01          	sub    $0x1,%r12d
+  802a20:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a24:	75 eb                	jne    802a11 <vprintfmt+0x26d>
+  802a26:	e9 aa fd ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a37:	eb 92                	jmp    8029cb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a39:	49 63 f7             	movslq %r15d,%rsi
+  802a3c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a40:	48 b8 56 2f 80 00 00 	movabs $0x802f56,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+  802a4c:	48 89 c2             	mov    %rax,%rdx
+  802a4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a52:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a54:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a57:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a5a:	85 c0                	test   %eax,%eax
+  802a5c:	7e 91                	jle    8029ef <vprintfmt+0x24b>
+  802a5e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a63:	4c 89 ee             	mov    %r13,%rsi
+  802a66:	44 89 e7             	mov    %r12d,%edi
+  802a69:	41 ff d6             	call   *%r14
+  802a6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a73:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a76:	75 eb                	jne    802a63 <vprintfmt+0x2bf>
+  802a78:	e9 72 ff ff ff       	jmp    8029ef <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a7d:	0f b6 f8             	movzbl %al,%edi
+  802a80:	4c 89 ee             	mov    %r13,%rsi
+  802a83:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a86:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a8a:	49 83 c4 01          	add    $0x1,%r12
+  802a8e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a94:	84 c0                	test   %al,%al
+  802a96:	0f 84 66 ff ff ff    	je     802a02 <vprintfmt+0x25e>
+  802a9c:	45 85 ff             	test   %r15d,%r15d
+  802a9f:	78 0a                	js     802aab <vprintfmt+0x307>
+  802aa1:	41 83 ef 01          	sub    $0x1,%r15d
+  802aa5:	0f 88 57 ff ff ff    	js     802a02 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802aab:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802aaf:	74 cc                	je     802a7d <vprintfmt+0x2d9>
+  802ab1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802ab4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ab9:	80 fa 5e             	cmp    $0x5e,%dl
+  802abc:	77 c2                	ja     802a80 <vprintfmt+0x2dc>
+  802abe:	eb bd                	jmp    802a7d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802ac0:	40 84 f6             	test   %sil,%sil
+  802ac3:	75 26                	jne    802aeb <vprintfmt+0x347>
+    switch (lflag) {
+  802ac5:	85 d2                	test   %edx,%edx
+  802ac7:	74 59                	je     802b22 <vprintfmt+0x37e>
+  802ac9:	83 fa 01             	cmp    $0x1,%edx
+  802acc:	74 7b                	je     802b49 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802ace:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ad1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad4:	0f 87 96 00 00 00    	ja     802b70 <vprintfmt+0x3cc>
+  802ada:	89 c2                	mov    %eax,%edx
+  802adc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ae0:	83 c0 08             	add    $0x8,%eax
+  802ae3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ae6:	4c 8b 22             	mov    (%rdx),%r12
+  802ae9:	eb 17                	jmp    802b02 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802aee:	83 f8 2f             	cmp    $0x2f,%eax
+  802af1:	77 21                	ja     802b14 <vprintfmt+0x370>
+  802af3:	89 c2                	mov    %eax,%edx
+  802af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802af9:	83 c0 08             	add    $0x8,%eax
+  802afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802aff:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802b02:	4d 85 e4             	test   %r12,%r12
+  802b05:	78 7a                	js     802b81 <vprintfmt+0x3dd>
+            num = i;
+  802b07:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b0f:	e9 50 02 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b20:	eb dd                	jmp    802aff <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b25:	83 f8 2f             	cmp    $0x2f,%eax
+  802b28:	77 11                	ja     802b3b <vprintfmt+0x397>
+  802b2a:	89 c2                	mov    %eax,%edx
+  802b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b30:	83 c0 08             	add    $0x8,%eax
+  802b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b36:	4c 63 22             	movslq (%rdx),%r12
+  802b39:	eb c7                	jmp    802b02 <vprintfmt+0x35e>
+  802b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b47:	eb ed                	jmp    802b36 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b4c:	83 f8 2f             	cmp    $0x2f,%eax
+  802b4f:	77 11                	ja     802b62 <vprintfmt+0x3be>
+  802b51:	89 c2                	mov    %eax,%edx
+  802b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b57:	83 c0 08             	add    $0x8,%eax
+  802b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b5d:	4c 8b 22             	mov    (%rdx),%r12
+  802b60:	eb a0                	jmp    802b02 <vprintfmt+0x35e>
+  802b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b6e:	eb ed                	jmp    802b5d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b7c:	e9 65 ff ff ff       	jmp    802ae6 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b81:	4c 89 ee             	mov    %r13,%rsi
+  802b84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b89:	41 ff d6             	call   *%r14
+                i = -i;
+  802b8c:	49 f7 dc             	neg    %r12
+  802b8f:	e9 73 ff ff ff       	jmp    802b07 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b94:	40 84 f6             	test   %sil,%sil
+  802b97:	75 32                	jne    802bcb <vprintfmt+0x427>
+    switch (lflag) {
+  802b99:	85 d2                	test   %edx,%edx
+  802b9b:	74 5d                	je     802bfa <vprintfmt+0x456>
+  802b9d:	83 fa 01             	cmp    $0x1,%edx
+  802ba0:	0f 84 82 00 00 00    	je     802c28 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  802bac:	0f 87 a5 00 00 00    	ja     802c57 <vprintfmt+0x4b3>
+  802bb2:	89 c2                	mov    %eax,%edx
+  802bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb8:	83 c0 08             	add    $0x8,%eax
+  802bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bbe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bc6:	e9 99 01 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bce:	83 f8 2f             	cmp    $0x2f,%eax
+  802bd1:	77 19                	ja     802bec <vprintfmt+0x448>
+  802bd3:	89 c2                	mov    %eax,%edx
+  802bd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bd9:	83 c0 08             	add    $0x8,%eax
+  802bdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bdf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802be2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802be7:	e9 78 01 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+  802bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf8:	eb e5                	jmp    802bdf <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  802c00:	77 18                	ja     802c1a <vprintfmt+0x476>
+  802c02:	89 c2                	mov    %eax,%edx
+  802c04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c08:	83 c0 08             	add    $0x8,%eax
+  802c0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c0e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c15:	e9 4a 01 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+  802c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c26:	eb e6                	jmp    802c0e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c2b:	83 f8 2f             	cmp    $0x2f,%eax
+  802c2e:	77 19                	ja     802c49 <vprintfmt+0x4a5>
+  802c30:	89 c2                	mov    %eax,%edx
+  802c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c36:	83 c0 08             	add    $0x8,%eax
+  802c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c3c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c3f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c44:	e9 1b 01 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+  802c49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c55:	eb e5                	jmp    802c3c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c63:	e9 56 ff ff ff       	jmp    802bbe <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c68:	40 84 f6             	test   %sil,%sil
+  802c6b:	75 2e                	jne    802c9b <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c6d:	85 d2                	test   %edx,%edx
+  802c6f:	74 59                	je     802cca <vprintfmt+0x526>
+  802c71:	83 fa 01             	cmp    $0x1,%edx
+  802c74:	74 7f                	je     802cf5 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c79:	83 f8 2f             	cmp    $0x2f,%eax
+  802c7c:	0f 87 9f 00 00 00    	ja     802d21 <vprintfmt+0x57d>
+  802c82:	89 c2                	mov    %eax,%edx
+  802c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c88:	83 c0 08             	add    $0x8,%eax
+  802c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c91:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c96:	e9 c9 00 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c9e:	83 f8 2f             	cmp    $0x2f,%eax
+  802ca1:	77 19                	ja     802cbc <vprintfmt+0x518>
+  802ca3:	89 c2                	mov    %eax,%edx
+  802ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ca9:	83 c0 08             	add    $0x8,%eax
+  802cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802caf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cb2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802cb7:	e9 a8 00 00 00       	jmp    802d64 <vprintfmt+0x5c0>
+  802cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc8:	eb e5                	jmp    802caf <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  802cd0:	77 15                	ja     802ce7 <vprintfmt+0x543>
+  802cd2:	89 c2                	mov    %eax,%edx
+  802cd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd8:	83 c0 08             	add    $0x8,%eax
+  802cdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cde:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802ce0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802ce5:	eb 7d                	jmp    802d64 <vprintfmt+0x5c0>
+  802ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cf3:	eb e9                	jmp    802cde <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  802cfb:	77 16                	ja     802d13 <vprintfmt+0x56f>
+  802cfd:	89 c2                	mov    %eax,%edx
+  802cff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d03:	83 c0 08             	add    $0x8,%eax
+  802d06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d0c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d11:	eb 51                	jmp    802d64 <vprintfmt+0x5c0>
+  802d13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d1f:	eb e8                	jmp    802d09 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d2d:	e9 5c ff ff ff       	jmp    802c8e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d32:	4c 89 ee             	mov    %r13,%rsi
+  802d35:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d3a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d3d:	4c 89 ee             	mov    %r13,%rsi
+  802d40:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d45:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  802d4e:	77 47                	ja     802d97 <vprintfmt+0x5f3>
+  802d50:	89 c2                	mov    %eax,%edx
+  802d52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d56:	83 c0 08             	add    $0x8,%eax
+  802d59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d64:	48 83 ec 08          	sub    $0x8,%rsp
+  802d68:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d6c:	0f 94 c0             	sete   %al
+  802d6f:	0f b6 c0             	movzbl %al,%eax
+  802d72:	50                   	push   %rax
+  802d73:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d78:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d7c:	4c 89 ee             	mov    %r13,%rsi
+  802d7f:	4c 89 f7             	mov    %r14,%rdi
+  802d82:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+            break;
+  802d8e:	48 83 c4 10          	add    $0x10,%rsp
+  802d92:	e9 3e fa ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802da3:	eb b7                	jmp    802d5c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802da5:	40 84 f6             	test   %sil,%sil
+  802da8:	75 2b                	jne    802dd5 <vprintfmt+0x631>
+    switch (lflag) {
+  802daa:	85 d2                	test   %edx,%edx
+  802dac:	74 56                	je     802e04 <vprintfmt+0x660>
+  802dae:	83 fa 01             	cmp    $0x1,%edx
+  802db1:	74 7f                	je     802e32 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802db3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802db6:	83 f8 2f             	cmp    $0x2f,%eax
+  802db9:	0f 87 a2 00 00 00    	ja     802e61 <vprintfmt+0x6bd>
+  802dbf:	89 c2                	mov    %eax,%edx
+  802dc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dc5:	83 c0 08             	add    $0x8,%eax
+  802dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dcb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dd3:	eb 8f                	jmp    802d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dd5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dd8:	83 f8 2f             	cmp    $0x2f,%eax
+  802ddb:	77 19                	ja     802df6 <vprintfmt+0x652>
+  802ddd:	89 c2                	mov    %eax,%edx
+  802ddf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802de3:	83 c0 08             	add    $0x8,%eax
+  802de6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802de9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dec:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802df1:	e9 6e ff ff ff       	jmp    802d64 <vprintfmt+0x5c0>
+  802df6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e02:	eb e5                	jmp    802de9 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802e04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e07:	83 f8 2f             	cmp    $0x2f,%eax
+  802e0a:	77 18                	ja     802e24 <vprintfmt+0x680>
+  802e0c:	89 c2                	mov    %eax,%edx
+  802e0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e12:	83 c0 08             	add    $0x8,%eax
+  802e15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e18:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e1a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e1f:	e9 40 ff ff ff       	jmp    802d64 <vprintfmt+0x5c0>
+  802e24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e30:	eb e6                	jmp    802e18 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e35:	83 f8 2f             	cmp    $0x2f,%eax
+  802e38:	77 19                	ja     802e53 <vprintfmt+0x6af>
+  802e3a:	89 c2                	mov    %eax,%edx
+  802e3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e40:	83 c0 08             	add    $0x8,%eax
+  802e43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e49:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e4e:	e9 11 ff ff ff       	jmp    802d64 <vprintfmt+0x5c0>
+  802e53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e5f:	eb e5                	jmp    802e46 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6d:	e9 59 ff ff ff       	jmp    802dcb <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e72:	4c 89 ee             	mov    %r13,%rsi
+  802e75:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e7a:	41 ff d6             	call   *%r14
+            break;
+  802e7d:	e9 53 f9 ff ff       	jmp    8027d5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e82:	4c 89 ee             	mov    %r13,%rsi
+  802e85:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e8a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e8d:	48 83 eb 01          	sub    $0x1,%rbx
+  802e91:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e95:	75 f6                	jne    802e8d <vprintfmt+0x6e9>
+  802e97:	e9 39 f9 ff ff       	jmp    8027d5 <vprintfmt+0x31>
+}
+  802e9c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802ea0:	5b                   	pop    %rbx
+  802ea1:	41 5c                	pop    %r12
+  802ea3:	41 5d                	pop    %r13
+  802ea5:	41 5e                	pop    %r14
+  802ea7:	41 5f                	pop    %r15
+  802ea9:	5d                   	pop    %rbp
+  802eaa:	c3                   	ret
+
+0000000000802eab <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802eab:	55                   	push   %rbp
+  802eac:	48 89 e5             	mov    %rsp,%rbp
+  802eaf:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802eb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eb7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ebc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ec0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ec7:	48 85 ff             	test   %rdi,%rdi
+  802eca:	74 2b                	je     802ef7 <vsnprintf+0x4c>
+  802ecc:	48 85 f6             	test   %rsi,%rsi
+  802ecf:	74 26                	je     802ef7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ed1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ed5:	48 bf 4f 27 80 00 00 	movabs $0x80274f,%rdi
+  802edc:	00 00 00 
+  802edf:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  802ee6:	00 00 00 
+  802ee9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eef:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802ef2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ef5:	c9                   	leave
+  802ef6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802ef7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802efc:	eb f7                	jmp    802ef5 <vsnprintf+0x4a>
+
+0000000000802efe <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	48 83 ec 50          	sub    $0x50,%rsp
+  802f06:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f0a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f0e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f12:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f19:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f21:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f29:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f2d:	48 b8 ab 2e 80 00 00 	movabs $0x802eab,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f39:	c9                   	leave
+  802f3a:	c3                   	ret
+
+0000000000802f3b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f3b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f3e:	74 10                	je     802f50 <strlen+0x15>
+    size_t n = 0;
+  802f40:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f45:	48 83 c0 01          	add    $0x1,%rax
+  802f49:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f4d:	75 f6                	jne    802f45 <strlen+0xa>
+  802f4f:	c3                   	ret
+    size_t n = 0;
+  802f50:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f55:	c3                   	ret
+
+0000000000802f56 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f56:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f59:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f5e:	48 85 f6             	test   %rsi,%rsi
+  802f61:	74 11                	je     802f74 <strnlen+0x1e>
+  802f63:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f67:	74 0c                	je     802f75 <strnlen+0x1f>
+  802f69:	48 83 c2 01          	add    $0x1,%rdx
+  802f6d:	48 39 d0             	cmp    %rdx,%rax
+  802f70:	75 f1                	jne    802f63 <strnlen+0xd>
+  802f72:	eb 04                	jmp    802f78 <strnlen+0x22>
+  802f74:	c3                   	ret
+  802f75:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f78:	c3                   	ret
+
+0000000000802f79 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f79:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f81:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f85:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f88:	48 83 c2 01          	add    $0x1,%rdx
+  802f8c:	84 c9                	test   %cl,%cl
+  802f8e:	75 f1                	jne    802f81 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f90:	c3                   	ret
+
+0000000000802f91 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f91:	55                   	push   %rbp
+  802f92:	48 89 e5             	mov    %rsp,%rbp
+  802f95:	41 54                	push   %r12
+  802f97:	53                   	push   %rbx
+  802f98:	48 89 fb             	mov    %rdi,%rbx
+  802f9b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f9e:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802faa:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802fae:	4c 89 e6             	mov    %r12,%rsi
+  802fb1:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+    return dst;
+}
+  802fbd:	48 89 d8             	mov    %rbx,%rax
+  802fc0:	5b                   	pop    %rbx
+  802fc1:	41 5c                	pop    %r12
+  802fc3:	5d                   	pop    %rbp
+  802fc4:	c3                   	ret
+
+0000000000802fc5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fc5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fc8:	48 85 d2             	test   %rdx,%rdx
+  802fcb:	74 1f                	je     802fec <strncpy+0x27>
+  802fcd:	48 01 fa             	add    %rdi,%rdx
+  802fd0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fd3:	48 83 c1 01          	add    $0x1,%rcx
+  802fd7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fdb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fdf:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fe3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fe7:	48 39 ca             	cmp    %rcx,%rdx
+  802fea:	75 e7                	jne    802fd3 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fec:	c3                   	ret
+
+0000000000802fed <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fed:	48 89 f8             	mov    %rdi,%rax
+  802ff0:	48 85 d2             	test   %rdx,%rdx
+  802ff3:	74 24                	je     803019 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802ff5:	48 83 ea 01          	sub    $0x1,%rdx
+  802ff9:	74 1b                	je     803016 <strlcpy+0x29>
+  802ffb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fff:	0f b6 16             	movzbl (%rsi),%edx
+  803002:	84 d2                	test   %dl,%dl
+  803004:	74 10                	je     803016 <strlcpy+0x29>
+            *dst++ = *src++;
+  803006:	48 83 c6 01          	add    $0x1,%rsi
+  80300a:	48 83 c0 01          	add    $0x1,%rax
+  80300e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803011:	48 39 c8             	cmp    %rcx,%rax
+  803014:	75 e9                	jne    802fff <strlcpy+0x12>
+        *dst = '\0';
+  803016:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803019:	48 29 f8             	sub    %rdi,%rax
+}
+  80301c:	c3                   	ret
+
+000000000080301d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80301d:	0f b6 07             	movzbl (%rdi),%eax
+  803020:	84 c0                	test   %al,%al
+  803022:	74 13                	je     803037 <strcmp+0x1a>
+  803024:	38 06                	cmp    %al,(%rsi)
+  803026:	75 0f                	jne    803037 <strcmp+0x1a>
+  803028:	48 83 c7 01          	add    $0x1,%rdi
+  80302c:	48 83 c6 01          	add    $0x1,%rsi
+  803030:	0f b6 07             	movzbl (%rdi),%eax
+  803033:	84 c0                	test   %al,%al
+  803035:	75 ed                	jne    803024 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803037:	0f b6 c0             	movzbl %al,%eax
+  80303a:	0f b6 16             	movzbl (%rsi),%edx
+  80303d:	29 d0                	sub    %edx,%eax
+}
+  80303f:	c3                   	ret
+
+0000000000803040 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803040:	48 85 d2             	test   %rdx,%rdx
+  803043:	74 1f                	je     803064 <strncmp+0x24>
+  803045:	0f b6 07             	movzbl (%rdi),%eax
+  803048:	84 c0                	test   %al,%al
+  80304a:	74 1e                	je     80306a <strncmp+0x2a>
+  80304c:	3a 06                	cmp    (%rsi),%al
+  80304e:	75 1a                	jne    80306a <strncmp+0x2a>
+  803050:	48 83 c7 01          	add    $0x1,%rdi
+  803054:	48 83 c6 01          	add    $0x1,%rsi
+  803058:	48 83 ea 01          	sub    $0x1,%rdx
+  80305c:	75 e7                	jne    803045 <strncmp+0x5>
+
+    if (!n) return 0;
+  80305e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803063:	c3                   	ret
+  803064:	b8 00 00 00 00       	mov    $0x0,%eax
+  803069:	c3                   	ret
+  80306a:	48 85 d2             	test   %rdx,%rdx
+  80306d:	74 09                	je     803078 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80306f:	0f b6 07             	movzbl (%rdi),%eax
+  803072:	0f b6 16             	movzbl (%rsi),%edx
+  803075:	29 d0                	sub    %edx,%eax
+  803077:	c3                   	ret
+    if (!n) return 0;
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307d:	c3                   	ret
+
+000000000080307e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80307e:	0f b6 17             	movzbl (%rdi),%edx
+  803081:	84 d2                	test   %dl,%dl
+  803083:	74 18                	je     80309d <strchr+0x1f>
+        if (*str == c) {
+  803085:	0f be d2             	movsbl %dl,%edx
+  803088:	39 f2                	cmp    %esi,%edx
+  80308a:	74 17                	je     8030a3 <strchr+0x25>
+    for (; *str; str++) {
+  80308c:	48 83 c7 01          	add    $0x1,%rdi
+  803090:	0f b6 17             	movzbl (%rdi),%edx
+  803093:	84 d2                	test   %dl,%dl
+  803095:	75 ee                	jne    803085 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309c:	c3                   	ret
+  80309d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a2:	c3                   	ret
+  8030a3:	48 89 f8             	mov    %rdi,%rax
+}
+  8030a6:	c3                   	ret
+
+00000000008030a7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8030a7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030aa:	0f b6 17             	movzbl (%rdi),%edx
+  8030ad:	84 d2                	test   %dl,%dl
+  8030af:	74 13                	je     8030c4 <strfind+0x1d>
+  8030b1:	0f be d2             	movsbl %dl,%edx
+  8030b4:	39 f2                	cmp    %esi,%edx
+  8030b6:	74 0b                	je     8030c3 <strfind+0x1c>
+  8030b8:	48 83 c0 01          	add    $0x1,%rax
+  8030bc:	0f b6 10             	movzbl (%rax),%edx
+  8030bf:	84 d2                	test   %dl,%dl
+  8030c1:	75 ee                	jne    8030b1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030c3:	c3                   	ret
+  8030c4:	c3                   	ret
+
+00000000008030c5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030c5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030c8:	48 89 f8             	mov    %rdi,%rax
+  8030cb:	48 f7 d8             	neg    %rax
+  8030ce:	83 e0 07             	and    $0x7,%eax
+  8030d1:	49 89 d1             	mov    %rdx,%r9
+  8030d4:	49 29 c1             	sub    %rax,%r9
+  8030d7:	78 36                	js     80310f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030d9:	40 0f b6 c6          	movzbl %sil,%eax
+  8030dd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030e4:	01 01 01 
+  8030e7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030eb:	40 f6 c7 07          	test   $0x7,%dil
+  8030ef:	75 38                	jne    803129 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030f1:	4c 89 c9             	mov    %r9,%rcx
+  8030f4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030f8:	74 0c                	je     803106 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030fa:	fc                   	cld
+  8030fb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030fe:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803102:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803106:	4d 85 c9             	test   %r9,%r9
+  803109:	75 45                	jne    803150 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80310b:	4c 89 c0             	mov    %r8,%rax
+  80310e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80310f:	48 85 d2             	test   %rdx,%rdx
+  803112:	74 f7                	je     80310b <memset+0x46>
+  803114:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803117:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80311a:	48 83 c0 01          	add    $0x1,%rax
+  80311e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803122:	48 39 c2             	cmp    %rax,%rdx
+  803125:	75 f3                	jne    80311a <memset+0x55>
+  803127:	eb e2                	jmp    80310b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803129:	40 f6 c7 01          	test   $0x1,%dil
+  80312d:	74 06                	je     803135 <memset+0x70>
+  80312f:	88 07                	mov    %al,(%rdi)
+  803131:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803135:	40 f6 c7 02          	test   $0x2,%dil
+  803139:	74 07                	je     803142 <memset+0x7d>
+  80313b:	66 89 07             	mov    %ax,(%rdi)
+  80313e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803142:	40 f6 c7 04          	test   $0x4,%dil
+  803146:	74 a9                	je     8030f1 <memset+0x2c>
+  803148:	89 07                	mov    %eax,(%rdi)
+  80314a:	48 83 c7 04          	add    $0x4,%rdi
+  80314e:	eb a1                	jmp    8030f1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803150:	41 f6 c1 04          	test   $0x4,%r9b
+  803154:	74 06                	je     80315c <memset+0x97>
+  803156:	89 07                	mov    %eax,(%rdi)
+  803158:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80315c:	41 f6 c1 02          	test   $0x2,%r9b
+  803160:	74 07                	je     803169 <memset+0xa4>
+  803162:	66 89 07             	mov    %ax,(%rdi)
+  803165:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803169:	41 f6 c1 01          	test   $0x1,%r9b
+  80316d:	74 9c                	je     80310b <memset+0x46>
+  80316f:	88 07                	mov    %al,(%rdi)
+  803171:	eb 98                	jmp    80310b <memset+0x46>
+
+0000000000803173 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803173:	48 89 f8             	mov    %rdi,%rax
+  803176:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803179:	48 39 fe             	cmp    %rdi,%rsi
+  80317c:	73 3b                	jae    8031b9 <memmove+0x46>
+  80317e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803182:	48 39 d7             	cmp    %rdx,%rdi
+  803185:	73 32                	jae    8031b9 <memmove+0x46>
+        s += n;
+        d += n;
+  803187:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80318b:	48 89 d6             	mov    %rdx,%rsi
+  80318e:	48 09 fe             	or     %rdi,%rsi
+  803191:	48 09 ce             	or     %rcx,%rsi
+  803194:	40 f6 c6 07          	test   $0x7,%sil
+  803198:	75 12                	jne    8031ac <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80319a:	48 83 ef 08          	sub    $0x8,%rdi
+  80319e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8031a2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031a6:	fd                   	std
+  8031a7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031aa:	fc                   	cld
+  8031ab:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031ac:	48 83 ef 01          	sub    $0x1,%rdi
+  8031b0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031b4:	fd                   	std
+  8031b5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031b7:	eb f1                	jmp    8031aa <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031b9:	48 89 f2             	mov    %rsi,%rdx
+  8031bc:	48 09 c2             	or     %rax,%rdx
+  8031bf:	48 09 ca             	or     %rcx,%rdx
+  8031c2:	f6 c2 07             	test   $0x7,%dl
+  8031c5:	75 0c                	jne    8031d3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031c7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031cb:	48 89 c7             	mov    %rax,%rdi
+  8031ce:	fc                   	cld
+  8031cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031d2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031d3:	48 89 c7             	mov    %rax,%rdi
+  8031d6:	fc                   	cld
+  8031d7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031d9:	c3                   	ret
+
+00000000008031da <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031da:	55                   	push   %rbp
+  8031db:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031de:	48 b8 73 31 80 00 00 	movabs $0x803173,%rax
+  8031e5:	00 00 00 
+  8031e8:	ff d0                	call   *%rax
+}
+  8031ea:	5d                   	pop    %rbp
+  8031eb:	c3                   	ret
+
+00000000008031ec <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031ec:	55                   	push   %rbp
+  8031ed:	48 89 e5             	mov    %rsp,%rbp
+  8031f0:	41 57                	push   %r15
+  8031f2:	41 56                	push   %r14
+  8031f4:	41 55                	push   %r13
+  8031f6:	41 54                	push   %r12
+  8031f8:	53                   	push   %rbx
+  8031f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031fd:	49 89 fe             	mov    %rdi,%r14
+  803200:	49 89 f7             	mov    %rsi,%r15
+  803203:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803206:	48 89 f7             	mov    %rsi,%rdi
+  803209:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  803210:	00 00 00 
+  803213:	ff d0                	call   *%rax
+  803215:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803218:	48 89 de             	mov    %rbx,%rsi
+  80321b:	4c 89 f7             	mov    %r14,%rdi
+  80321e:	48 b8 56 2f 80 00 00 	movabs $0x802f56,%rax
+  803225:	00 00 00 
+  803228:	ff d0                	call   *%rax
+  80322a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80322d:	48 39 c3             	cmp    %rax,%rbx
+  803230:	74 36                	je     803268 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803232:	48 89 d8             	mov    %rbx,%rax
+  803235:	4c 29 e8             	sub    %r13,%rax
+  803238:	49 39 c4             	cmp    %rax,%r12
+  80323b:	73 31                	jae    80326e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80323d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803242:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803246:	4c 89 fe             	mov    %r15,%rsi
+  803249:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803255:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803259:	48 83 c4 08          	add    $0x8,%rsp
+  80325d:	5b                   	pop    %rbx
+  80325e:	41 5c                	pop    %r12
+  803260:	41 5d                	pop    %r13
+  803262:	41 5e                	pop    %r14
+  803264:	41 5f                	pop    %r15
+  803266:	5d                   	pop    %rbp
+  803267:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803268:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80326c:	eb eb                	jmp    803259 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80326e:	48 83 eb 01          	sub    $0x1,%rbx
+  803272:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803276:	48 89 da             	mov    %rbx,%rdx
+  803279:	4c 89 fe             	mov    %r15,%rsi
+  80327c:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  803283:	00 00 00 
+  803286:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803288:	49 01 de             	add    %rbx,%r14
+  80328b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803290:	eb c3                	jmp    803255 <strlcat+0x69>
+
+0000000000803292 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803292:	48 85 d2             	test   %rdx,%rdx
+  803295:	74 2d                	je     8032c4 <memcmp+0x32>
+  803297:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80329c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8032a0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8032a5:	44 38 c1             	cmp    %r8b,%cl
+  8032a8:	75 0f                	jne    8032b9 <memcmp+0x27>
+    while (n-- > 0) {
+  8032aa:	48 83 c0 01          	add    $0x1,%rax
+  8032ae:	48 39 c2             	cmp    %rax,%rdx
+  8032b1:	75 e9                	jne    80329c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032b9:	0f b6 c1             	movzbl %cl,%eax
+  8032bc:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032c0:	44 29 c0             	sub    %r8d,%eax
+  8032c3:	c3                   	ret
+    return 0;
+  8032c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c9:	c3                   	ret
+
+00000000008032ca <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032ca:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032ce:	48 39 c7             	cmp    %rax,%rdi
+  8032d1:	73 0f                	jae    8032e2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032d3:	40 38 37             	cmp    %sil,(%rdi)
+  8032d6:	74 0e                	je     8032e6 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032d8:	48 83 c7 01          	add    $0x1,%rdi
+  8032dc:	48 39 f8             	cmp    %rdi,%rax
+  8032df:	75 f2                	jne    8032d3 <memfind+0x9>
+  8032e1:	c3                   	ret
+  8032e2:	48 89 f8             	mov    %rdi,%rax
+  8032e5:	c3                   	ret
+  8032e6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032e9:	c3                   	ret
+
+00000000008032ea <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032ea:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032ed:	0f b6 37             	movzbl (%rdi),%esi
+  8032f0:	40 80 fe 20          	cmp    $0x20,%sil
+  8032f4:	74 06                	je     8032fc <strtol+0x12>
+  8032f6:	40 80 fe 09          	cmp    $0x9,%sil
+  8032fa:	75 13                	jne    80330f <strtol+0x25>
+  8032fc:	48 83 c7 01          	add    $0x1,%rdi
+  803300:	0f b6 37             	movzbl (%rdi),%esi
+  803303:	40 80 fe 20          	cmp    $0x20,%sil
+  803307:	74 f3                	je     8032fc <strtol+0x12>
+  803309:	40 80 fe 09          	cmp    $0x9,%sil
+  80330d:	74 ed                	je     8032fc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80330f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803312:	83 e0 fd             	and    $0xfffffffd,%eax
+  803315:	3c 01                	cmp    $0x1,%al
+  803317:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80331b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803321:	75 0f                	jne    803332 <strtol+0x48>
+  803323:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803326:	74 14                	je     80333c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803328:	85 d2                	test   %edx,%edx
+  80332a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80332f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803332:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803337:	4c 63 ca             	movslq %edx,%r9
+  80333a:	eb 36                	jmp    803372 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80333c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803340:	74 0f                	je     803351 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803342:	85 d2                	test   %edx,%edx
+  803344:	75 ec                	jne    803332 <strtol+0x48>
+        s++;
+  803346:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80334a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80334f:	eb e1                	jmp    803332 <strtol+0x48>
+        s += 2;
+  803351:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803355:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80335a:	eb d6                	jmp    803332 <strtol+0x48>
+            dig -= '0';
+  80335c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80335f:	44 0f b6 c1          	movzbl %cl,%r8d
+  803363:	41 39 d0             	cmp    %edx,%r8d
+  803366:	7d 21                	jge    803389 <strtol+0x9f>
+        val = val * base + dig;
+  803368:	49 0f af c1          	imul   %r9,%rax
+  80336c:	0f b6 c9             	movzbl %cl,%ecx
+  80336f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803372:	48 83 c7 01          	add    $0x1,%rdi
+  803376:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80337a:	80 f9 39             	cmp    $0x39,%cl
+  80337d:	76 dd                	jbe    80335c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80337f:	80 f9 7b             	cmp    $0x7b,%cl
+  803382:	77 05                	ja     803389 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803384:	83 e9 57             	sub    $0x57,%ecx
+  803387:	eb d6                	jmp    80335f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803389:	4d 85 d2             	test   %r10,%r10
+  80338c:	74 03                	je     803391 <strtol+0xa7>
+  80338e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803391:	48 89 c2             	mov    %rax,%rdx
+  803394:	48 f7 da             	neg    %rdx
+  803397:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80339b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80339f:	c3                   	ret
+
+00000000008033a0 <strrev>:
+
+void
+strrev(char *str)
+{
+  8033a0:	55                   	push   %rbp
+  8033a1:	48 89 e5             	mov    %rsp,%rbp
+  8033a4:	53                   	push   %rbx
+  8033a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a9:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033ac:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8033b3:	00 00 00 
+  8033b6:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b8:	83 e8 01             	sub    $0x1,%eax
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	7e 22                	jle    8033e1 <strrev+0x41>
+  8033bf:	48 98                	cltq
+  8033c1:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033c6:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033ca:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033ce:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033d2:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033d5:	48 83 c2 01          	add    $0x1,%rdx
+  8033d9:	48 83 e8 01          	sub    $0x1,%rax
+  8033dd:	39 c2                	cmp    %eax,%edx
+  8033df:	7c e5                	jl     8033c6 <strrev+0x26>
+	}
+}
+  8033e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033e5:	c9                   	leave
+  8033e6:	c3                   	ret
+
+00000000008033e7 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033e7:	85 d2                	test   %edx,%edx
+  8033e9:	0f 84 80 00 00 00    	je     80346f <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033ef:	55                   	push   %rbp
+  8033f0:	48 89 e5             	mov    %rsp,%rbp
+  8033f3:	53                   	push   %rbx
+  8033f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f8:	49 89 f2             	mov    %rsi,%r10
+  8033fb:	41 89 d3             	mov    %edx,%r11d
+  8033fe:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  803401:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  803406:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  803409:	eb 20                	jmp    80342b <itoa+0x44>
+			str[i++] = '0' + digit;
+  80340b:	41 89 f1             	mov    %esi,%r9d
+  80340e:	83 c2 30             	add    $0x30,%edx
+  803411:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  803414:	89 f8                	mov    %edi,%eax
+  803416:	99                   	cltd
+  803417:	f7 f9                	idiv   %ecx
+  803419:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80341b:	85 c0                	test   %eax,%eax
+  80341d:	74 2e                	je     80344d <itoa+0x66>
+  80341f:	83 c6 01             	add    $0x1,%esi
+  803422:	49 83 c0 01          	add    $0x1,%r8
+  803426:	44 39 cb             	cmp    %r9d,%ebx
+  803429:	7e 15                	jle    803440 <itoa+0x59>
+		digit = sum % base;
+  80342b:	89 f8                	mov    %edi,%eax
+  80342d:	99                   	cltd
+  80342e:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803430:	83 fa 09             	cmp    $0x9,%edx
+  803433:	7e d6                	jle    80340b <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803435:	41 89 f1             	mov    %esi,%r9d
+  803438:	83 c2 37             	add    $0x37,%edx
+  80343b:	41 88 10             	mov    %dl,(%r8)
+  80343e:	eb d4                	jmp    803414 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803440:	41 83 eb 01          	sub    $0x1,%r11d
+  803444:	45 39 cb             	cmp    %r9d,%r11d
+  803447:	75 04                	jne    80344d <itoa+0x66>
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	75 28                	jne    803475 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80344d:	4d 63 c9             	movslq %r9d,%r9
+  803450:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803455:	4c 89 d7             	mov    %r10,%rdi
+  803458:	48 b8 a0 33 80 00 00 	movabs $0x8033a0,%rax
+  80345f:	00 00 00 
+  803462:	ff d0                	call   *%rax
+	return 0;
+  803464:	b8 00 00 00 00       	mov    $0x0,%eax
+  803469:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80346d:	c9                   	leave
+  80346e:	c3                   	ret
+		return -1;
+  80346f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803474:	c3                   	ret
+		return -1;
+  803475:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80347a:	eb ed                	jmp    803469 <itoa+0x82>
+
+000000000080347c <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80347c:	55                   	push   %rbp
+  80347d:	48 89 e5             	mov    %rsp,%rbp
+  803480:	41 55                	push   %r13
+  803482:	41 54                	push   %r12
+  803484:	53                   	push   %rbx
+  803485:	48 83 ec 08          	sub    $0x8,%rsp
+  803489:	49 89 fc             	mov    %rdi,%r12
+  80348c:	48 89 f7             	mov    %rsi,%rdi
+  80348f:	48 89 d3             	mov    %rdx,%rbx
+  803492:	49 89 cd             	mov    %rcx,%r13
+  803495:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803498:	48 85 f6             	test   %rsi,%rsi
+  80349b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034a2:	00 00 00 
+  8034a5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034a9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034ae:	48 85 db             	test   %rbx,%rbx
+  8034b1:	74 03                	je     8034b6 <ipc_recv_timed+0x3a>
+  8034b3:	48 8b 33             	mov    (%rbx),%rsi
+  8034b6:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	78 75                	js     80353b <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034c6:	4d 85 e4             	test   %r12,%r12
+  8034c9:	74 14                	je     8034df <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034cb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d2:	00 00 00 
+  8034d5:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034db:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034df:	4d 85 ed             	test   %r13,%r13
+  8034e2:	74 14                	je     8034f8 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034e4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034eb:	00 00 00 
+  8034ee:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034f4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034f8:	48 85 db             	test   %rbx,%rbx
+  8034fb:	74 23                	je     803520 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034fd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803504:	00 00 00 
+  803507:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80350d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803512:	85 c9                	test   %ecx,%ecx
+  803514:	74 07                	je     80351d <ipc_recv_timed+0xa1>
+  803516:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80351d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803520:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803527:	00 00 00 
+  80352a:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803530:	48 83 c4 08          	add    $0x8,%rsp
+  803534:	5b                   	pop    %rbx
+  803535:	41 5c                	pop    %r12
+  803537:	41 5d                	pop    %r13
+  803539:	5d                   	pop    %rbp
+  80353a:	c3                   	ret
+        if (from_env_store != NULL) {
+  80353b:	4d 85 e4             	test   %r12,%r12
+  80353e:	74 08                	je     803548 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803540:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803547:	00 
+        if (perm_store != NULL) {
+  803548:	4d 85 ed             	test   %r13,%r13
+  80354b:	74 08                	je     803555 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80354d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803554:	00 
+        if (size != NULL) {
+  803555:	48 85 db             	test   %rbx,%rbx
+  803558:	74 d6                	je     803530 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80355a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803561:	eb cd                	jmp    803530 <ipc_recv_timed+0xb4>
+
+0000000000803563 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80356d:	48 b8 7c 34 80 00 00 	movabs $0x80347c,%rax
+  803574:	00 00 00 
+  803577:	ff d0                	call   *%rax
+}
+  803579:	5d                   	pop    %rbp
+  80357a:	c3                   	ret
+
+000000000080357b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80357b:	55                   	push   %rbp
+  80357c:	48 89 e5             	mov    %rsp,%rbp
+  80357f:	41 57                	push   %r15
+  803581:	41 56                	push   %r14
+  803583:	41 55                	push   %r13
+  803585:	41 54                	push   %r12
+  803587:	53                   	push   %rbx
+  803588:	48 83 ec 18          	sub    $0x18,%rsp
+  80358c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80358f:	48 89 d3             	mov    %rdx,%rbx
+  803592:	49 89 cc             	mov    %rcx,%r12
+  803595:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803598:	48 85 d2             	test   %rdx,%rdx
+  80359b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035a2:	00 00 00 
+  8035a5:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035a9:	89 f0                	mov    %esi,%eax
+  8035ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035af:	48 89 da             	mov    %rbx,%rdx
+  8035b2:	48 89 c6             	mov    %rax,%rsi
+  8035b5:	48 b8 11 05 80 00 00 	movabs $0x800511,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035c1:	85 c0                	test   %eax,%eax
+  8035c3:	79 65                	jns    80362a <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035c5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035c8:	75 33                	jne    8035fd <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035ca:	49 bf 14 02 80 00 00 	movabs $0x800214,%r15
+  8035d1:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d4:	49 be 11 05 80 00 00 	movabs $0x800511,%r14
+  8035db:	00 00 00 
+        sys_yield();
+  8035de:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035e1:	45 89 e8             	mov    %r13d,%r8d
+  8035e4:	4c 89 e1             	mov    %r12,%rcx
+  8035e7:	48 89 da             	mov    %rbx,%rdx
+  8035ea:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035ee:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035f1:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035f4:	85 c0                	test   %eax,%eax
+  8035f6:	79 32                	jns    80362a <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035f8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035fb:	74 e1                	je     8035de <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035fd:	89 c1                	mov    %eax,%ecx
+  8035ff:	48 ba 47 3d 80 00 00 	movabs $0x803d47,%rdx
+  803606:	00 00 00 
+  803609:	be 52 00 00 00       	mov    $0x52,%esi
+  80360e:	48 bf 5b 3d 80 00 00 	movabs $0x803d5b,%rdi
+  803615:	00 00 00 
+  803618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361d:	49 b8 04 25 80 00 00 	movabs $0x802504,%r8
+  803624:	00 00 00 
+  803627:	41 ff d0             	call   *%r8
+    }
+}
+  80362a:	48 83 c4 18          	add    $0x18,%rsp
+  80362e:	5b                   	pop    %rbx
+  80362f:	41 5c                	pop    %r12
+  803631:	41 5d                	pop    %r13
+  803633:	41 5e                	pop    %r14
+  803635:	41 5f                	pop    %r15
+  803637:	5d                   	pop    %rbp
+  803638:	c3                   	ret
+
+0000000000803639 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80363e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803645:	00 00 00 
+  803648:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80364c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803650:	48 c1 e2 04          	shl    $0x4,%rdx
+  803654:	48 01 ca             	add    %rcx,%rdx
+  803657:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80365d:	39 fa                	cmp    %edi,%edx
+  80365f:	74 12                	je     803673 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803661:	48 83 c0 01          	add    $0x1,%rax
+  803665:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80366b:	75 db                	jne    803648 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80366d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803672:	c3                   	ret
+            return envs[i].env_id;
+  803673:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803677:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80367b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80367f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803686:	00 00 00 
+  803689:	48 01 d0             	add    %rdx,%rax
+  80368c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803692:	c3                   	ret
+  803693:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803698 <__rodata_start>:
+  803698:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  80369d:	2c 20                	sub    $0x20,%al
+  80369f:	77 6f                	ja     803710 <__rodata_start+0x78>
+  8036a1:	72 6c                	jb     80370f <__rodata_start+0x77>
+  8036a3:	64 0a 00             	or     %fs:(%rax),%al
+  8036a6:	3c 75                	cmp    $0x75,%al
+  8036a8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036a9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036ad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ae:	3e 00 73 79          	ds add %dh,0x79(%rbx)
+  8036b2:	73 63                	jae    803717 <__rodata_start+0x7f>
+  8036b4:	61                   	(bad)
+  8036b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b37 <__bss_end+0x72201b37>
+  8036bd:	65 74 75             	gs je  803735 <__rodata_start+0x9d>
+  8036c0:	72 6e                	jb     803730 <__rodata_start+0x98>
+  8036c2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b44 <__bss_end+0x28201b44>
+  8036c9:	28 
+  8036ca:	3e 20 30             	ds and %dh,(%rax)
+  8036cd:	29 00                	sub    %eax,(%rax)
+  8036cf:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036d7:	61                   	(bad)
+  8036d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036da:	2e 63 00             	cs movsxd (%rax),%eax
+  8036dd:	0f 1f 00             	nopl   (%rax)
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036e6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036e9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ee:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036f2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036f9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804164 <devcons+0x4>
+  803700:	5b                   	pop    %rbx
+  803701:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803706:	20 72 65             	and    %dh,0x65(%rdx)
+  803709:	61                   	(bad)
+  80370a:	64 6d                	fs insl (%dx),%es:(%rdi)
+  80370c:	61                   	(bad)
+  80370d:	70 20                	jo     80372f <__rodata_start+0x97>
+  80370f:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  803714:	20 62 61             	and    %ah,0x61(%rdx)
+  803717:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80371b:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80371f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803722:	30 38                	xor    %bh,(%rax)
+  803724:	78 5d                	js     803783 <devtab+0x3>
+  803726:	20 66 74             	and    %ah,0x74(%rsi)
+  803729:	72 75                	jb     8037a0 <devtab+0x20>
+  80372b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80372c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80372f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad579a <__bss_end+0x2d2cd79a>
+  803736:	20 62 61             	and    %ah,0x61(%rdx)
+  803739:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80373d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803741:	5b                   	pop    %rbx
+  803742:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803747:	20 72 65             	and    %dh,0x65(%rdx)
+  80374a:	61                   	(bad)
+  80374b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad57b6 <__bss_end+0x2d2cd7b6>
+  803752:	20 62 61             	and    %ah,0x61(%rdx)
+  803755:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803759:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80375d:	5b                   	pop    %rbx
+  80375e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803763:	20 77 72             	and    %dh,0x72(%rdi)
+  803766:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80376d:	2d 
+  80376e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803773:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803776:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80377a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803780 <devtab>:
+  803780:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803790:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  8037a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8038a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8038b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8039a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8039b0:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039c0:	41 28 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     A(..............
+  8039d0:	72 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     r...............
+  8039e0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  8039f0:	82 2e 80 00 00 00 00 00 60 28 80 00 00 00 00 00     ........`(......
+  803a00:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803a10:	54 28 80 00 00 00 00 00 ce 28 80 00 00 00 00 00     T(.......(......
+  803a20:	82 2e 80 00 00 00 00 00 54 28 80 00 00 00 00 00     ........T(......
+  803a30:	9a 28 80 00 00 00 00 00 9a 28 80 00 00 00 00 00     .(.......(......
+  803a40:	9a 28 80 00 00 00 00 00 9a 28 80 00 00 00 00 00     .(.......(......
+  803a50:	9a 28 80 00 00 00 00 00 9a 28 80 00 00 00 00 00     .(.......(......
+  803a60:	9a 28 80 00 00 00 00 00 9a 28 80 00 00 00 00 00     .(.......(......
+  803a70:	9a 28 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     .(..............
+  803a80:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803a90:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803aa0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803ab0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803ac0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803ad0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803ae0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803af0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b00:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b10:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b20:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b30:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b40:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b50:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b60:	82 2e 80 00 00 00 00 00 a5 2d 80 00 00 00 00 00     .........-......
+  803b70:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b80:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803b90:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803ba0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803bb0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803bc0:	f1 28 80 00 00 00 00 00 c0 2a 80 00 00 00 00 00     .(.......*......
+  803bd0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803be0:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803bf0:	20 29 80 00 00 00 00 00 82 2e 80 00 00 00 00 00      )..............
+  803c00:	82 2e 80 00 00 00 00 00 e6 28 80 00 00 00 00 00     .........(......
+  803c10:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803c20:	68 2c 80 00 00 00 00 00 32 2d 80 00 00 00 00 00     h,......2-......
+  803c30:	82 2e 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     ................
+  803c40:	b7 29 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     .)..............
+  803c50:	94 2b 80 00 00 00 00 00 82 2e 80 00 00 00 00 00     .+..............
+  803c60:	82 2e 80 00 00 00 00 00 a5 2d 80 00 00 00 00 00     .........-......
+  803c70:	82 2e 80 00 00 00 00 00 4a 28 80 00 00 00 00 00     ........J(......
+
+0000000000803c80 <error_string>:
+	...
+  803c88:	55 38 80 00 00 00 00 00 67 38 80 00 00 00 00 00     U8......g8......
+  803c98:	77 38 80 00 00 00 00 00 89 38 80 00 00 00 00 00     w8.......8......
+  803ca8:	97 38 80 00 00 00 00 00 ab 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	c0 38 80 00 00 00 00 00 d3 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	e5 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	09 39 80 00 00 00 00 00 1c 39 80 00 00 00 00 00     .9.......9......
+  803ce8:	33 39 80 00 00 00 00 00 49 39 80 00 00 00 00 00     39......I9......
+  803cf8:	61 39 80 00 00 00 00 00 79 39 80 00 00 00 00 00     a9......y9......
+  803d08:	86 39 80 00 00 00 00 00 28 3d 80 00 00 00 00 00     .9......(=......
+  803d18:	9a 39 80 00 00 00 00 00 b2 39 80 00 00 00 00 00     .9.......9......
+  803d28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d48:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d58:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff8:	00 0f 1f 80 00 00 00 00                             ........
@@ -0,0 +1,7574 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a9 01 00 00       	call   8001cc <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800044:	00 00 00 
+  800047:	49 be df 1a 80 00 00 	movabs $0x801adf,%r14
+  80004e:	00 00 00 
+        if ((r = write(1, buf, n)) != n)
+  800051:	49 bf d9 1c 80 00 00 	movabs $0x801cd9,%r15
+  800058:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80005b:	ba 00 20 00 00       	mov    $0x2000,%edx
+  800060:	4c 89 e6             	mov    %r12,%rsi
+  800063:	44 89 ef             	mov    %r13d,%edi
+  800066:	41 ff d6             	call   *%r14
+  800069:	48 89 c3             	mov    %rax,%rbx
+  80006c:	48 85 c0             	test   %rax,%rax
+  80006f:	7e 4b                	jle    8000bc <cat+0x97>
+        if ((r = write(1, buf, n)) != n)
+  800071:	48 89 da             	mov    %rbx,%rdx
+  800074:	4c 89 e6             	mov    %r12,%rsi
+  800077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007c:	41 ff d7             	call   *%r15
+  80007f:	48 63 d0             	movslq %eax,%rdx
+  800082:	48 39 da             	cmp    %rbx,%rdx
+  800085:	74 d4                	je     80005b <cat+0x36>
+            panic("write error copying %s: %i n is %li", s, r, n);
+  800087:	49 89 d9             	mov    %rbx,%r9
+  80008a:	41 89 c0             	mov    %eax,%r8d
+  80008d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800091:	48 ba c0 39 80 00 00 	movabs $0x8039c0,%rdx
+  800098:	00 00 00 
+  80009b:	be 0c 00 00 00       	mov    $0xc,%esi
+  8000a0:	48 bf e4 39 80 00 00 	movabs $0x8039e4,%rdi
+  8000a7:	00 00 00 
+  8000aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000af:	49 ba 9d 02 80 00 00 	movabs $0x80029d,%r10
+  8000b6:	00 00 00 
+  8000b9:	41 ff d2             	call   *%r10
+    if (n < 0)
+  8000bc:	78 0f                	js     8000cd <cat+0xa8>
+        panic("error reading %s: %i", s, (int)n);
+}
+  8000be:	48 83 c4 18          	add    $0x18,%rsp
+  8000c2:	5b                   	pop    %rbx
+  8000c3:	41 5c                	pop    %r12
+  8000c5:	41 5d                	pop    %r13
+  8000c7:	41 5e                	pop    %r14
+  8000c9:	41 5f                	pop    %r15
+  8000cb:	5d                   	pop    %rbp
+  8000cc:	c3                   	ret
+        panic("error reading %s: %i", s, (int)n);
+  8000cd:	41 89 c0             	mov    %eax,%r8d
+  8000d0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8000d4:	48 ba ef 39 80 00 00 	movabs $0x8039ef,%rdx
+  8000db:	00 00 00 
+  8000de:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000e3:	48 bf e4 39 80 00 00 	movabs $0x8039e4,%rdi
+  8000ea:	00 00 00 
+  8000ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f2:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  8000f9:	00 00 00 
+  8000fc:	41 ff d1             	call   *%r9
+
+00000000008000ff <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 57                	push   %r15
+  800105:	41 56                	push   %r14
+  800107:	41 55                	push   %r13
+  800109:	41 54                	push   %r12
+  80010b:	53                   	push   %rbx
+  80010c:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  800110:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  800117:	00 00 00 
+  80011a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800121:	00 00 00 
+    if (argc == 1)
+  800124:	83 ff 01             	cmp    $0x1,%edi
+  800127:	74 24                	je     80014d <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  800129:	7e 3d                	jle    800168 <umain+0x69>
+  80012b:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  80012f:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800132:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  800137:	49 bd 3e 2c 80 00 00 	movabs $0x802c3e,%r13
+  80013e:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  800141:	49 bf 25 00 80 00 00 	movabs $0x800025,%r15
+  800148:	00 00 00 
+  80014b:	eb 54                	jmp    8001a1 <umain+0xa2>
+        cat(0, "<stdin>");
+  80014d:	48 be 08 3a 80 00 00 	movabs $0x803a08,%rsi
+  800154:	00 00 00 
+  800157:	bf 00 00 00 00       	mov    $0x0,%edi
+  80015c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800163:	00 00 00 
+  800166:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  800168:	48 83 c4 08          	add    $0x8,%rsp
+  80016c:	5b                   	pop    %rbx
+  80016d:	41 5c                	pop    %r12
+  80016f:	41 5d                	pop    %r13
+  800171:	41 5e                	pop    %r14
+  800173:	41 5f                	pop    %r15
+  800175:	5d                   	pop    %rbp
+  800176:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  800177:	49 8b 34 24          	mov    (%r12),%rsi
+  80017b:	89 c2                	mov    %eax,%edx
+  80017d:	48 bf 10 3a 80 00 00 	movabs $0x803a10,%rdi
+  800184:	00 00 00 
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	48 b9 6d 2e 80 00 00 	movabs $0x802e6d,%rcx
+  800193:	00 00 00 
+  800196:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  800198:	49 83 c4 08          	add    $0x8,%r12
+  80019c:	4d 39 f4             	cmp    %r14,%r12
+  80019f:	74 c7                	je     800168 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  8001a1:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001aa:	41 ff d5             	call   *%r13
+  8001ad:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001af:	85 c0                	test   %eax,%eax
+  8001b1:	78 c4                	js     800177 <umain+0x78>
+                cat(f, argv[i]);
+  8001b3:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b7:	89 c7                	mov    %eax,%edi
+  8001b9:	41 ff d7             	call   *%r15
+                close(f);
+  8001bc:	89 df                	mov    %ebx,%edi
+  8001be:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+  8001ca:	eb cc                	jmp    800198 <umain+0x99>
+
+00000000008001cc <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001cc:	55                   	push   %rbp
+  8001cd:	48 89 e5             	mov    %rsp,%rbp
+  8001d0:	41 56                	push   %r14
+  8001d2:	41 55                	push   %r13
+  8001d4:	41 54                	push   %r12
+  8001d6:	53                   	push   %rbx
+  8001d7:	41 89 fd             	mov    %edi,%r13d
+  8001da:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001dd:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8001e4:	00 00 00 
+  8001e7:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8001ee:	00 00 00 
+  8001f1:	48 39 c2             	cmp    %rax,%rdx
+  8001f4:	73 17                	jae    80020d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001f6:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f9:	49 89 c4             	mov    %rax,%r12
+  8001fc:	48 83 c3 08          	add    $0x8,%rbx
+  800200:	b8 00 00 00 00       	mov    $0x0,%eax
+  800205:	ff 53 f8             	call   *-0x8(%rbx)
+  800208:	4c 39 e3             	cmp    %r12,%rbx
+  80020b:	72 ef                	jb     8001fc <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80020d:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  800214:	00 00 00 
+  800217:	ff d0                	call   *%rax
+  800219:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800222:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800226:	48 c1 e0 04          	shl    $0x4,%rax
+  80022a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800231:	00 00 00 
+  800234:	48 01 d0             	add    %rdx,%rax
+  800237:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  80023e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800241:	45 85 ed             	test   %r13d,%r13d
+  800244:	7e 0d                	jle    800253 <libmain+0x87>
+  800246:	49 8b 06             	mov    (%r14),%rax
+  800249:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800250:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800253:	4c 89 f6             	mov    %r14,%rsi
+  800256:	44 89 ef             	mov    %r13d,%edi
+  800259:	48 b8 ff 00 80 00 00 	movabs $0x8000ff,%rax
+  800260:	00 00 00 
+  800263:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800265:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  80026c:	00 00 00 
+  80026f:	ff d0                	call   *%rax
+#endif
+}
+  800271:	5b                   	pop    %rbx
+  800272:	41 5c                	pop    %r12
+  800274:	41 5d                	pop    %r13
+  800276:	41 5e                	pop    %r14
+  800278:	5d                   	pop    %rbp
+  800279:	c3                   	ret
+
+000000000080027a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80027e:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80028a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80028f:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 56                	push   %r14
+  8002a3:	41 55                	push   %r13
+  8002a5:	41 54                	push   %r12
+  8002a7:	53                   	push   %rbx
+  8002a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ac:	49 89 fc             	mov    %rdi,%r12
+  8002af:	41 89 f5             	mov    %esi,%r13d
+  8002b2:	48 89 d3             	mov    %rdx,%rbx
+  8002b5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002b9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002bd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002c1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002cc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002d0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002d4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002d8:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8002df:	00 00 00 
+  8002e2:	4c 8b 30             	mov    (%rax),%r14
+  8002e5:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  8002ec:	00 00 00 
+  8002ef:	ff d0                	call   *%rax
+  8002f1:	89 c6                	mov    %eax,%esi
+  8002f3:	45 89 e8             	mov    %r13d,%r8d
+  8002f6:	4c 89 e1             	mov    %r12,%rcx
+  8002f9:	4c 89 f2             	mov    %r14,%rdx
+  8002fc:	48 bf 30 3a 80 00 00 	movabs $0x803a30,%rdi
+  800303:	00 00 00 
+  800306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030b:	49 bc ed 03 80 00 00 	movabs $0x8003ed,%r12
+  800312:	00 00 00 
+  800315:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800318:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80031c:	48 89 df             	mov    %rbx,%rdi
+  80031f:	48 b8 89 03 80 00 00 	movabs $0x800389,%rax
+  800326:	00 00 00 
+  800329:	ff d0                	call   *%rax
+    cprintf("\n");
+  80032b:	48 bf 33 40 80 00 00 	movabs $0x804033,%rdi
+  800332:	00 00 00 
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80033d:	cc                   	int3
+  80033e:	eb fd                	jmp    80033d <_panic+0xa0>
+
+0000000000800340 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	53                   	push   %rbx
+  800345:	48 83 ec 08          	sub    $0x8,%rsp
+  800349:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80034c:	8b 06                	mov    (%rsi),%eax
+  80034e:	8d 50 01             	lea    0x1(%rax),%edx
+  800351:	89 16                	mov    %edx,(%rsi)
+  800353:	48 98                	cltq
+  800355:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80035a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800360:	74 0a                	je     80036c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800362:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800366:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80036c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800370:	be ff 00 00 00       	mov    $0xff,%esi
+  800375:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800381:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800387:	eb d9                	jmp    800362 <putch+0x22>
+
+0000000000800389 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800389:	55                   	push   %rbp
+  80038a:	48 89 e5             	mov    %rsp,%rbp
+  80038d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800394:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800397:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80039e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003ab:	48 89 f1             	mov    %rsi,%rcx
+  8003ae:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003b5:	48 bf 40 03 80 00 00 	movabs $0x800340,%rdi
+  8003bc:	00 00 00 
+  8003bf:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003cb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003d2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003d9:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8003e0:	00 00 00 
+  8003e3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003e5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003eb:	c9                   	leave
+  8003ec:	c3                   	ret
+
+00000000008003ed <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003ed:	55                   	push   %rbp
+  8003ee:	48 89 e5             	mov    %rsp,%rbp
+  8003f1:	48 83 ec 50          	sub    $0x50,%rsp
+  8003f5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003f9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800401:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800405:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800409:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800410:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800414:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800418:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80041c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800420:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800424:	48 b8 89 03 80 00 00 	movabs $0x800389,%rax
+  80042b:	00 00 00 
+  80042e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800430:	c9                   	leave
+  800431:	c3                   	ret
+
+0000000000800432 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800432:	55                   	push   %rbp
+  800433:	48 89 e5             	mov    %rsp,%rbp
+  800436:	41 57                	push   %r15
+  800438:	41 56                	push   %r14
+  80043a:	41 55                	push   %r13
+  80043c:	41 54                	push   %r12
+  80043e:	53                   	push   %rbx
+  80043f:	48 83 ec 18          	sub    $0x18,%rsp
+  800443:	49 89 fc             	mov    %rdi,%r12
+  800446:	49 89 f5             	mov    %rsi,%r13
+  800449:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80044d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800450:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800453:	41 89 cf             	mov    %ecx,%r15d
+  800456:	4c 39 fa             	cmp    %r15,%rdx
+  800459:	73 5b                	jae    8004b6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80045b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80045f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800463:	85 db                	test   %ebx,%ebx
+  800465:	7e 0e                	jle    800475 <print_num+0x43>
+            putch(padc, put_arg);
+  800467:	4c 89 ee             	mov    %r13,%rsi
+  80046a:	44 89 f7             	mov    %r14d,%edi
+  80046d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800470:	83 eb 01             	sub    $0x1,%ebx
+  800473:	75 f2                	jne    800467 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800475:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800479:	48 b9 64 3a 80 00 00 	movabs $0x803a64,%rcx
+  800480:	00 00 00 
+  800483:	48 b8 53 3a 80 00 00 	movabs $0x803a53,%rax
+  80048a:	00 00 00 
+  80048d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800491:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049a:	49 f7 f7             	div    %r15
+  80049d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004a1:	4c 89 ee             	mov    %r13,%rsi
+  8004a4:	41 ff d4             	call   *%r12
+}
+  8004a7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004ab:	5b                   	pop    %rbx
+  8004ac:	41 5c                	pop    %r12
+  8004ae:	41 5d                	pop    %r13
+  8004b0:	41 5e                	pop    %r14
+  8004b2:	41 5f                	pop    %r15
+  8004b4:	5d                   	pop    %rbp
+  8004b5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bf:	49 f7 f7             	div    %r15
+  8004c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004ca:	52                   	push   %rdx
+  8004cb:	45 0f be c9          	movsbl %r9b,%r9d
+  8004cf:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004d3:	48 89 c2             	mov    %rax,%rdx
+  8004d6:	48 b8 32 04 80 00 00 	movabs $0x800432,%rax
+  8004dd:	00 00 00 
+  8004e0:	ff d0                	call   *%rax
+  8004e2:	48 83 c4 10          	add    $0x10,%rsp
+  8004e6:	eb 8d                	jmp    800475 <print_num+0x43>
+
+00000000008004e8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004e8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004ec:	48 8b 06             	mov    (%rsi),%rax
+  8004ef:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004f3:	73 0a                	jae    8004ff <sprintputch+0x17>
+        *state->start++ = ch;
+  8004f5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004f9:	48 89 16             	mov    %rdx,(%rsi)
+  8004fc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004ff:	c3                   	ret
+
+0000000000800500 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+  800504:	48 83 ec 50          	sub    $0x50,%rsp
+  800508:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80050c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800510:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800514:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80051b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80051f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800523:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800527:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80052b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80052f:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  800536:	00 00 00 
+  800539:	ff d0                	call   *%rax
+}
+  80053b:	c9                   	leave
+  80053c:	c3                   	ret
+
+000000000080053d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80053d:	55                   	push   %rbp
+  80053e:	48 89 e5             	mov    %rsp,%rbp
+  800541:	41 57                	push   %r15
+  800543:	41 56                	push   %r14
+  800545:	41 55                	push   %r13
+  800547:	41 54                	push   %r12
+  800549:	53                   	push   %rbx
+  80054a:	48 83 ec 38          	sub    $0x38,%rsp
+  80054e:	49 89 fe             	mov    %rdi,%r14
+  800551:	49 89 f5             	mov    %rsi,%r13
+  800554:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800557:	48 8b 01             	mov    (%rcx),%rax
+  80055a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80055e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800562:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800566:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80056a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80056e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800572:	0f b6 3b             	movzbl (%rbx),%edi
+  800575:	40 80 ff 25          	cmp    $0x25,%dil
+  800579:	74 18                	je     800593 <vprintfmt+0x56>
+            if (!ch) return;
+  80057b:	40 84 ff             	test   %dil,%dil
+  80057e:	0f 84 b1 06 00 00    	je     800c35 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800584:	40 0f b6 ff          	movzbl %dil,%edi
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80058e:	4c 89 e3             	mov    %r12,%rbx
+  800591:	eb db                	jmp    80056e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800593:	be 00 00 00 00       	mov    $0x0,%esi
+  800598:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80059c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005a1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005a7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ae:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005b7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005bc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005bf:	83 e8 23             	sub    $0x23,%eax
+  8005c2:	3c 57                	cmp    $0x57,%al
+  8005c4:	0f 87 51 06 00 00    	ja     800c1b <vprintfmt+0x6de>
+  8005ca:	0f b6 c0             	movzbl %al,%eax
+  8005cd:	48 b9 00 3c 80 00 00 	movabs $0x803c00,%rcx
+  8005d4:	00 00 00 
+  8005d7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005da:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005dd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005e1:	eb cf                	jmp    8005b2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005e3:	49 89 dc             	mov    %rbx,%r12
+  8005e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8005eb:	eb c5                	jmp    8005b2 <vprintfmt+0x75>
+            padc = ch;
+  8005ed:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005f1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005f4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005f7:	eb b9                	jmp    8005b2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ff:	77 24                	ja     800625 <vprintfmt+0xe8>
+  800601:	89 c1                	mov    %eax,%ecx
+  800603:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800607:	83 c0 08             	add    $0x8,%eax
+  80060a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80060d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800610:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800613:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800617:	79 99                	jns    8005b2 <vprintfmt+0x75>
+                width = precision;
+  800619:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80061d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800623:	eb 8d                	jmp    8005b2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800625:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800629:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80062d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800631:	eb da                	jmp    80060d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800633:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800638:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80063c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800642:	3c 39                	cmp    $0x39,%al
+  800644:	77 1c                	ja     800662 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800646:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80064a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80064e:	0f b6 c0             	movzbl %al,%eax
+  800651:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800656:	0f b6 03             	movzbl (%rbx),%eax
+  800659:	3c 39                	cmp    $0x39,%al
+  80065b:	76 e9                	jbe    800646 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80065d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800660:	eb b1                	jmp    800613 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800662:	49 89 dc             	mov    %rbx,%r12
+  800665:	eb ac                	jmp    800613 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800667:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80066a:	85 c9                	test   %ecx,%ecx
+  80066c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800671:	0f 49 c1             	cmovns %ecx,%eax
+  800674:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800677:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80067a:	e9 33 ff ff ff       	jmp    8005b2 <vprintfmt+0x75>
+            lflag++;
+  80067f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800682:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800685:	e9 28 ff ff ff       	jmp    8005b2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80068a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068d:	83 f8 2f             	cmp    $0x2f,%eax
+  800690:	77 19                	ja     8006ab <vprintfmt+0x16e>
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800698:	83 c0 08             	add    $0x8,%eax
+  80069b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069e:	8b 3a                	mov    (%rdx),%edi
+  8006a0:	4c 89 ee             	mov    %r13,%rsi
+  8006a3:	41 ff d6             	call   *%r14
+            break;
+  8006a6:	e9 c3 fe ff ff       	jmp    80056e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b7:	eb e5                	jmp    80069e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bf:	77 5a                	ja     80071b <vprintfmt+0x1de>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c7:	83 c0 08             	add    $0x8,%eax
+  8006ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006cd:	8b 02                	mov    (%rdx),%eax
+  8006cf:	89 c1                	mov    %eax,%ecx
+  8006d1:	f7 d9                	neg    %ecx
+  8006d3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006d6:	83 f9 14             	cmp    $0x14,%ecx
+  8006d9:	7f 4e                	jg     800729 <vprintfmt+0x1ec>
+  8006db:	48 63 c1             	movslq %ecx,%rax
+  8006de:	48 ba c0 3e 80 00 00 	movabs $0x803ec0,%rdx
+  8006e5:	00 00 00 
+  8006e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006ec:	48 85 c0             	test   %rax,%rax
+  8006ef:	74 38                	je     800729 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006f1:	48 89 c1             	mov    %rax,%rcx
+  8006f4:	48 ba 99 40 80 00 00 	movabs $0x804099,%rdx
+  8006fb:	00 00 00 
+  8006fe:	4c 89 ee             	mov    %r13,%rsi
+  800701:	4c 89 f7             	mov    %r14,%rdi
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	49 b8 00 05 80 00 00 	movabs $0x800500,%r8
+  800710:	00 00 00 
+  800713:	41 ff d0             	call   *%r8
+  800716:	e9 53 fe ff ff       	jmp    80056e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80071b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800723:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800727:	eb a4                	jmp    8006cd <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800729:	48 ba 7c 3a 80 00 00 	movabs $0x803a7c,%rdx
+  800730:	00 00 00 
+  800733:	4c 89 ee             	mov    %r13,%rsi
+  800736:	4c 89 f7             	mov    %r14,%rdi
+  800739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073e:	49 b8 00 05 80 00 00 	movabs $0x800500,%r8
+  800745:	00 00 00 
+  800748:	41 ff d0             	call   *%r8
+  80074b:	e9 1e fe ff ff       	jmp    80056e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800753:	83 f8 2f             	cmp    $0x2f,%eax
+  800756:	77 6c                	ja     8007c4 <vprintfmt+0x287>
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075e:	83 c0 08             	add    $0x8,%eax
+  800761:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800764:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800767:	48 85 d2             	test   %rdx,%rdx
+  80076a:	48 b8 75 3a 80 00 00 	movabs $0x803a75,%rax
+  800771:	00 00 00 
+  800774:	48 0f 45 c2          	cmovne %rdx,%rax
+  800778:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80077c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800780:	7e 06                	jle    800788 <vprintfmt+0x24b>
+  800782:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800786:	75 4a                	jne    8007d2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800788:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80078c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800790:	0f b6 00             	movzbl (%rax),%eax
+  800793:	84 c0                	test   %al,%al
+  800795:	0f 85 9a 00 00 00    	jne    800835 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80079b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80079e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007a2:	85 c0                	test   %eax,%eax
+  8007a4:	0f 8e c4 fd ff ff    	jle    80056e <vprintfmt+0x31>
+  8007aa:	4c 89 ee             	mov    %r13,%rsi
+  8007ad:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007b2:	41 ff d6             	call   *%r14
+  8007b5:	41 83 ec 01          	sub    $0x1,%r12d
+  8007b9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007bd:	75 eb                	jne    8007aa <vprintfmt+0x26d>
+  8007bf:	e9 aa fd ff ff       	jmp    80056e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d0:	eb 92                	jmp    800764 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007d2:	49 63 f7             	movslq %r15d,%rsi
+  8007d5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007d9:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8007e0:	00 00 00 
+  8007e3:	ff d0                	call   *%rax
+  8007e5:	48 89 c2             	mov    %rax,%rdx
+  8007e8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007eb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007ed:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007f0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007f3:	85 c0                	test   %eax,%eax
+  8007f5:	7e 91                	jle    800788 <vprintfmt+0x24b>
+  8007f7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007fc:	4c 89 ee             	mov    %r13,%rsi
+  8007ff:	44 89 e7             	mov    %r12d,%edi
+  800802:	41 ff d6             	call   *%r14
+  800805:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800809:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80080f:	75 eb                	jne    8007fc <vprintfmt+0x2bf>
+  800811:	e9 72 ff ff ff       	jmp    800788 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800816:	0f b6 f8             	movzbl %al,%edi
+  800819:	4c 89 ee             	mov    %r13,%rsi
+  80081c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80081f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800823:	49 83 c4 01          	add    $0x1,%r12
+  800827:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80082d:	84 c0                	test   %al,%al
+  80082f:	0f 84 66 ff ff ff    	je     80079b <vprintfmt+0x25e>
+  800835:	45 85 ff             	test   %r15d,%r15d
+  800838:	78 0a                	js     800844 <vprintfmt+0x307>
+  80083a:	41 83 ef 01          	sub    $0x1,%r15d
+  80083e:	0f 88 57 ff ff ff    	js     80079b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800844:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800848:	74 cc                	je     800816 <vprintfmt+0x2d9>
+  80084a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80084d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800852:	80 fa 5e             	cmp    $0x5e,%dl
+  800855:	77 c2                	ja     800819 <vprintfmt+0x2dc>
+  800857:	eb bd                	jmp    800816 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800859:	40 84 f6             	test   %sil,%sil
+  80085c:	75 26                	jne    800884 <vprintfmt+0x347>
+    switch (lflag) {
+  80085e:	85 d2                	test   %edx,%edx
+  800860:	74 59                	je     8008bb <vprintfmt+0x37e>
+  800862:	83 fa 01             	cmp    $0x1,%edx
+  800865:	74 7b                	je     8008e2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086a:	83 f8 2f             	cmp    $0x2f,%eax
+  80086d:	0f 87 96 00 00 00    	ja     800909 <vprintfmt+0x3cc>
+  800873:	89 c2                	mov    %eax,%edx
+  800875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800879:	83 c0 08             	add    $0x8,%eax
+  80087c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087f:	4c 8b 22             	mov    (%rdx),%r12
+  800882:	eb 17                	jmp    80089b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	77 21                	ja     8008ad <vprintfmt+0x370>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80089b:	4d 85 e4             	test   %r12,%r12
+  80089e:	78 7a                	js     80091a <vprintfmt+0x3dd>
+            num = i;
+  8008a0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008a8:	e9 50 02 00 00       	jmp    800afd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	eb dd                	jmp    800898 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008be:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c1:	77 11                	ja     8008d4 <vprintfmt+0x397>
+  8008c3:	89 c2                	mov    %eax,%edx
+  8008c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c9:	83 c0 08             	add    $0x8,%eax
+  8008cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cf:	4c 63 22             	movslq (%rdx),%r12
+  8008d2:	eb c7                	jmp    80089b <vprintfmt+0x35e>
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	eb ed                	jmp    8008cf <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 11                	ja     8008fb <vprintfmt+0x3be>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	4c 8b 22             	mov    (%rdx),%r12
+  8008f9:	eb a0                	jmp    80089b <vprintfmt+0x35e>
+  8008fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800903:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800907:	eb ed                	jmp    8008f6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800909:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800911:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800915:	e9 65 ff ff ff       	jmp    80087f <vprintfmt+0x342>
+                putch('-', put_arg);
+  80091a:	4c 89 ee             	mov    %r13,%rsi
+  80091d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800922:	41 ff d6             	call   *%r14
+                i = -i;
+  800925:	49 f7 dc             	neg    %r12
+  800928:	e9 73 ff ff ff       	jmp    8008a0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80092d:	40 84 f6             	test   %sil,%sil
+  800930:	75 32                	jne    800964 <vprintfmt+0x427>
+    switch (lflag) {
+  800932:	85 d2                	test   %edx,%edx
+  800934:	74 5d                	je     800993 <vprintfmt+0x456>
+  800936:	83 fa 01             	cmp    $0x1,%edx
+  800939:	0f 84 82 00 00 00    	je     8009c1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80093f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800942:	83 f8 2f             	cmp    $0x2f,%eax
+  800945:	0f 87 a5 00 00 00    	ja     8009f0 <vprintfmt+0x4b3>
+  80094b:	89 c2                	mov    %eax,%edx
+  80094d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800951:	83 c0 08             	add    $0x8,%eax
+  800954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800957:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80095a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80095f:	e9 99 01 00 00       	jmp    800afd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800964:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800967:	83 f8 2f             	cmp    $0x2f,%eax
+  80096a:	77 19                	ja     800985 <vprintfmt+0x448>
+  80096c:	89 c2                	mov    %eax,%edx
+  80096e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800972:	83 c0 08             	add    $0x8,%eax
+  800975:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800978:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80097b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800980:	e9 78 01 00 00       	jmp    800afd <vprintfmt+0x5c0>
+  800985:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800989:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800991:	eb e5                	jmp    800978 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800993:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800996:	83 f8 2f             	cmp    $0x2f,%eax
+  800999:	77 18                	ja     8009b3 <vprintfmt+0x476>
+  80099b:	89 c2                	mov    %eax,%edx
+  80099d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a1:	83 c0 08             	add    $0x8,%eax
+  8009a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009a9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ae:	e9 4a 01 00 00       	jmp    800afd <vprintfmt+0x5c0>
+  8009b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bf:	eb e6                	jmp    8009a7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c7:	77 19                	ja     8009e2 <vprintfmt+0x4a5>
+  8009c9:	89 c2                	mov    %eax,%edx
+  8009cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cf:	83 c0 08             	add    $0x8,%eax
+  8009d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009d8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009dd:	e9 1b 01 00 00       	jmp    800afd <vprintfmt+0x5c0>
+  8009e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ee:	eb e5                	jmp    8009d5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	e9 56 ff ff ff       	jmp    800957 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a01:	40 84 f6             	test   %sil,%sil
+  800a04:	75 2e                	jne    800a34 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a06:	85 d2                	test   %edx,%edx
+  800a08:	74 59                	je     800a63 <vprintfmt+0x526>
+  800a0a:	83 fa 01             	cmp    $0x1,%edx
+  800a0d:	74 7f                	je     800a8e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a12:	83 f8 2f             	cmp    $0x2f,%eax
+  800a15:	0f 87 9f 00 00 00    	ja     800aba <vprintfmt+0x57d>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2f:	e9 c9 00 00 00       	jmp    800afd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a37:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3a:	77 19                	ja     800a55 <vprintfmt+0x518>
+  800a3c:	89 c2                	mov    %eax,%edx
+  800a3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a42:	83 c0 08             	add    $0x8,%eax
+  800a45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a50:	e9 a8 00 00 00       	jmp    800afd <vprintfmt+0x5c0>
+  800a55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a61:	eb e5                	jmp    800a48 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a66:	83 f8 2f             	cmp    $0x2f,%eax
+  800a69:	77 15                	ja     800a80 <vprintfmt+0x543>
+  800a6b:	89 c2                	mov    %eax,%edx
+  800a6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a71:	83 c0 08             	add    $0x8,%eax
+  800a74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a77:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a79:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a7e:	eb 7d                	jmp    800afd <vprintfmt+0x5c0>
+  800a80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8c:	eb e9                	jmp    800a77 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a91:	83 f8 2f             	cmp    $0x2f,%eax
+  800a94:	77 16                	ja     800aac <vprintfmt+0x56f>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aa5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800aaa:	eb 51                	jmp    800afd <vprintfmt+0x5c0>
+  800aac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab8:	eb e8                	jmp    800aa2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	e9 5c ff ff ff       	jmp    800a27 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800acb:	4c 89 ee             	mov    %r13,%rsi
+  800ace:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ad3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ad6:	4c 89 ee             	mov    %r13,%rsi
+  800ad9:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ade:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ae1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae7:	77 47                	ja     800b30 <vprintfmt+0x5f3>
+  800ae9:	89 c2                	mov    %eax,%edx
+  800aeb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aef:	83 c0 08             	add    $0x8,%eax
+  800af2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800afd:	48 83 ec 08          	sub    $0x8,%rsp
+  800b01:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b05:	0f 94 c0             	sete   %al
+  800b08:	0f b6 c0             	movzbl %al,%eax
+  800b0b:	50                   	push   %rax
+  800b0c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b11:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b15:	4c 89 ee             	mov    %r13,%rsi
+  800b18:	4c 89 f7             	mov    %r14,%rdi
+  800b1b:	48 b8 32 04 80 00 00 	movabs $0x800432,%rax
+  800b22:	00 00 00 
+  800b25:	ff d0                	call   *%rax
+            break;
+  800b27:	48 83 c4 10          	add    $0x10,%rsp
+  800b2b:	e9 3e fa ff ff       	jmp    80056e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3c:	eb b7                	jmp    800af5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3e:	40 84 f6             	test   %sil,%sil
+  800b41:	75 2b                	jne    800b6e <vprintfmt+0x631>
+    switch (lflag) {
+  800b43:	85 d2                	test   %edx,%edx
+  800b45:	74 56                	je     800b9d <vprintfmt+0x660>
+  800b47:	83 fa 01             	cmp    $0x1,%edx
+  800b4a:	74 7f                	je     800bcb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b52:	0f 87 a2 00 00 00    	ja     800bfa <vprintfmt+0x6bd>
+  800b58:	89 c2                	mov    %eax,%edx
+  800b5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5e:	83 c0 08             	add    $0x8,%eax
+  800b61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b67:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b6c:	eb 8f                	jmp    800afd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b71:	83 f8 2f             	cmp    $0x2f,%eax
+  800b74:	77 19                	ja     800b8f <vprintfmt+0x652>
+  800b76:	89 c2                	mov    %eax,%edx
+  800b78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7c:	83 c0 08             	add    $0x8,%eax
+  800b7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b85:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b8a:	e9 6e ff ff ff       	jmp    800afd <vprintfmt+0x5c0>
+  800b8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9b:	eb e5                	jmp    800b82 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba3:	77 18                	ja     800bbd <vprintfmt+0x680>
+  800ba5:	89 c2                	mov    %eax,%edx
+  800ba7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bab:	83 c0 08             	add    $0x8,%eax
+  800bae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bb3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bb8:	e9 40 ff ff ff       	jmp    800afd <vprintfmt+0x5c0>
+  800bbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc9:	eb e6                	jmp    800bb1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bce:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd1:	77 19                	ja     800bec <vprintfmt+0x6af>
+  800bd3:	89 c2                	mov    %eax,%edx
+  800bd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd9:	83 c0 08             	add    $0x8,%eax
+  800bdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800be2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800be7:	e9 11 ff ff ff       	jmp    800afd <vprintfmt+0x5c0>
+  800bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	eb e5                	jmp    800bdf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c06:	e9 59 ff ff ff       	jmp    800b64 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c0b:	4c 89 ee             	mov    %r13,%rsi
+  800c0e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c13:	41 ff d6             	call   *%r14
+            break;
+  800c16:	e9 53 f9 ff ff       	jmp    80056e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c1b:	4c 89 ee             	mov    %r13,%rsi
+  800c1e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c23:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c26:	48 83 eb 01          	sub    $0x1,%rbx
+  800c2a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c2e:	75 f6                	jne    800c26 <vprintfmt+0x6e9>
+  800c30:	e9 39 f9 ff ff       	jmp    80056e <vprintfmt+0x31>
+}
+  800c35:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c39:	5b                   	pop    %rbx
+  800c3a:	41 5c                	pop    %r12
+  800c3c:	41 5d                	pop    %r13
+  800c3e:	41 5e                	pop    %r14
+  800c40:	41 5f                	pop    %r15
+  800c42:	5d                   	pop    %rbp
+  800c43:	c3                   	ret
+
+0000000000800c44 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c44:	55                   	push   %rbp
+  800c45:	48 89 e5             	mov    %rsp,%rbp
+  800c48:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c50:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c55:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c59:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c60:	48 85 ff             	test   %rdi,%rdi
+  800c63:	74 2b                	je     800c90 <vsnprintf+0x4c>
+  800c65:	48 85 f6             	test   %rsi,%rsi
+  800c68:	74 26                	je     800c90 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c6a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c6e:	48 bf e8 04 80 00 00 	movabs $0x8004e8,%rdi
+  800c75:	00 00 00 
+  800c78:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  800c7f:	00 00 00 
+  800c82:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c88:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c8b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c8e:	c9                   	leave
+  800c8f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c95:	eb f7                	jmp    800c8e <vsnprintf+0x4a>
+
+0000000000800c97 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c97:	55                   	push   %rbp
+  800c98:	48 89 e5             	mov    %rsp,%rbp
+  800c9b:	48 83 ec 50          	sub    $0x50,%rsp
+  800c9f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ca3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ca7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cab:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cb2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cbe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cc2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cc6:	48 b8 44 0c 80 00 00 	movabs $0x800c44,%rax
+  800ccd:	00 00 00 
+  800cd0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+
+0000000000800cd4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cd4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cd7:	74 10                	je     800ce9 <strlen+0x15>
+    size_t n = 0;
+  800cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cde:	48 83 c0 01          	add    $0x1,%rax
+  800ce2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ce6:	75 f6                	jne    800cde <strlen+0xa>
+  800ce8:	c3                   	ret
+    size_t n = 0;
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cee:	c3                   	ret
+
+0000000000800cef <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cef:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cf7:	48 85 f6             	test   %rsi,%rsi
+  800cfa:	74 11                	je     800d0d <strnlen+0x1e>
+  800cfc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d00:	74 0c                	je     800d0e <strnlen+0x1f>
+  800d02:	48 83 c2 01          	add    $0x1,%rdx
+  800d06:	48 39 d0             	cmp    %rdx,%rax
+  800d09:	75 f1                	jne    800cfc <strnlen+0xd>
+  800d0b:	eb 04                	jmp    800d11 <strnlen+0x22>
+  800d0d:	c3                   	ret
+  800d0e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d11:	c3                   	ret
+
+0000000000800d12 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d12:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d1e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d21:	48 83 c2 01          	add    $0x1,%rdx
+  800d25:	84 c9                	test   %cl,%cl
+  800d27:	75 f1                	jne    800d1a <strcpy+0x8>
+        ;
+    return res;
+}
+  800d29:	c3                   	ret
+
+0000000000800d2a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d2a:	55                   	push   %rbp
+  800d2b:	48 89 e5             	mov    %rsp,%rbp
+  800d2e:	41 54                	push   %r12
+  800d30:	53                   	push   %rbx
+  800d31:	48 89 fb             	mov    %rdi,%rbx
+  800d34:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d37:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  800d3e:	00 00 00 
+  800d41:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d43:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d47:	4c 89 e6             	mov    %r12,%rsi
+  800d4a:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  800d51:	00 00 00 
+  800d54:	ff d0                	call   *%rax
+    return dst;
+}
+  800d56:	48 89 d8             	mov    %rbx,%rax
+  800d59:	5b                   	pop    %rbx
+  800d5a:	41 5c                	pop    %r12
+  800d5c:	5d                   	pop    %rbp
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d5e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d61:	48 85 d2             	test   %rdx,%rdx
+  800d64:	74 1f                	je     800d85 <strncpy+0x27>
+  800d66:	48 01 fa             	add    %rdi,%rdx
+  800d69:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d6c:	48 83 c1 01          	add    $0x1,%rcx
+  800d70:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d74:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d78:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d7c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d80:	48 39 ca             	cmp    %rcx,%rdx
+  800d83:	75 e7                	jne    800d6c <strncpy+0xe>
+    }
+    return ret;
+}
+  800d85:	c3                   	ret
+
+0000000000800d86 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d86:	48 89 f8             	mov    %rdi,%rax
+  800d89:	48 85 d2             	test   %rdx,%rdx
+  800d8c:	74 24                	je     800db2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d8e:	48 83 ea 01          	sub    $0x1,%rdx
+  800d92:	74 1b                	je     800daf <strlcpy+0x29>
+  800d94:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d98:	0f b6 16             	movzbl (%rsi),%edx
+  800d9b:	84 d2                	test   %dl,%dl
+  800d9d:	74 10                	je     800daf <strlcpy+0x29>
+            *dst++ = *src++;
+  800d9f:	48 83 c6 01          	add    $0x1,%rsi
+  800da3:	48 83 c0 01          	add    $0x1,%rax
+  800da7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800daa:	48 39 c8             	cmp    %rcx,%rax
+  800dad:	75 e9                	jne    800d98 <strlcpy+0x12>
+        *dst = '\0';
+  800daf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800db2:	48 29 f8             	sub    %rdi,%rax
+}
+  800db5:	c3                   	ret
+
+0000000000800db6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800db6:	0f b6 07             	movzbl (%rdi),%eax
+  800db9:	84 c0                	test   %al,%al
+  800dbb:	74 13                	je     800dd0 <strcmp+0x1a>
+  800dbd:	38 06                	cmp    %al,(%rsi)
+  800dbf:	75 0f                	jne    800dd0 <strcmp+0x1a>
+  800dc1:	48 83 c7 01          	add    $0x1,%rdi
+  800dc5:	48 83 c6 01          	add    $0x1,%rsi
+  800dc9:	0f b6 07             	movzbl (%rdi),%eax
+  800dcc:	84 c0                	test   %al,%al
+  800dce:	75 ed                	jne    800dbd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd0:	0f b6 c0             	movzbl %al,%eax
+  800dd3:	0f b6 16             	movzbl (%rsi),%edx
+  800dd6:	29 d0                	sub    %edx,%eax
+}
+  800dd8:	c3                   	ret
+
+0000000000800dd9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dd9:	48 85 d2             	test   %rdx,%rdx
+  800ddc:	74 1f                	je     800dfd <strncmp+0x24>
+  800dde:	0f b6 07             	movzbl (%rdi),%eax
+  800de1:	84 c0                	test   %al,%al
+  800de3:	74 1e                	je     800e03 <strncmp+0x2a>
+  800de5:	3a 06                	cmp    (%rsi),%al
+  800de7:	75 1a                	jne    800e03 <strncmp+0x2a>
+  800de9:	48 83 c7 01          	add    $0x1,%rdi
+  800ded:	48 83 c6 01          	add    $0x1,%rsi
+  800df1:	48 83 ea 01          	sub    $0x1,%rdx
+  800df5:	75 e7                	jne    800dde <strncmp+0x5>
+
+    if (!n) return 0;
+  800df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfc:	c3                   	ret
+  800dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e02:	c3                   	ret
+  800e03:	48 85 d2             	test   %rdx,%rdx
+  800e06:	74 09                	je     800e11 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e08:	0f b6 07             	movzbl (%rdi),%eax
+  800e0b:	0f b6 16             	movzbl (%rsi),%edx
+  800e0e:	29 d0                	sub    %edx,%eax
+  800e10:	c3                   	ret
+    if (!n) return 0;
+  800e11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e16:	c3                   	ret
+
+0000000000800e17 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e17:	0f b6 17             	movzbl (%rdi),%edx
+  800e1a:	84 d2                	test   %dl,%dl
+  800e1c:	74 18                	je     800e36 <strchr+0x1f>
+        if (*str == c) {
+  800e1e:	0f be d2             	movsbl %dl,%edx
+  800e21:	39 f2                	cmp    %esi,%edx
+  800e23:	74 17                	je     800e3c <strchr+0x25>
+    for (; *str; str++) {
+  800e25:	48 83 c7 01          	add    $0x1,%rdi
+  800e29:	0f b6 17             	movzbl (%rdi),%edx
+  800e2c:	84 d2                	test   %dl,%dl
+  800e2e:	75 ee                	jne    800e1e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e35:	c3                   	ret
+  800e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3b:	c3                   	ret
+  800e3c:	48 89 f8             	mov    %rdi,%rax
+}
+  800e3f:	c3                   	ret
+
+0000000000800e40 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e40:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e43:	0f b6 17             	movzbl (%rdi),%edx
+  800e46:	84 d2                	test   %dl,%dl
+  800e48:	74 13                	je     800e5d <strfind+0x1d>
+  800e4a:	0f be d2             	movsbl %dl,%edx
+  800e4d:	39 f2                	cmp    %esi,%edx
+  800e4f:	74 0b                	je     800e5c <strfind+0x1c>
+  800e51:	48 83 c0 01          	add    $0x1,%rax
+  800e55:	0f b6 10             	movzbl (%rax),%edx
+  800e58:	84 d2                	test   %dl,%dl
+  800e5a:	75 ee                	jne    800e4a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e5c:	c3                   	ret
+  800e5d:	c3                   	ret
+
+0000000000800e5e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e5e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e61:	48 89 f8             	mov    %rdi,%rax
+  800e64:	48 f7 d8             	neg    %rax
+  800e67:	83 e0 07             	and    $0x7,%eax
+  800e6a:	49 89 d1             	mov    %rdx,%r9
+  800e6d:	49 29 c1             	sub    %rax,%r9
+  800e70:	78 36                	js     800ea8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e72:	40 0f b6 c6          	movzbl %sil,%eax
+  800e76:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e7d:	01 01 01 
+  800e80:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e84:	40 f6 c7 07          	test   $0x7,%dil
+  800e88:	75 38                	jne    800ec2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e8a:	4c 89 c9             	mov    %r9,%rcx
+  800e8d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e91:	74 0c                	je     800e9f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e93:	fc                   	cld
+  800e94:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e97:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e9b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e9f:	4d 85 c9             	test   %r9,%r9
+  800ea2:	75 45                	jne    800ee9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ea4:	4c 89 c0             	mov    %r8,%rax
+  800ea7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ea8:	48 85 d2             	test   %rdx,%rdx
+  800eab:	74 f7                	je     800ea4 <memset+0x46>
+  800ead:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eb0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800eb3:	48 83 c0 01          	add    $0x1,%rax
+  800eb7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ebb:	48 39 c2             	cmp    %rax,%rdx
+  800ebe:	75 f3                	jne    800eb3 <memset+0x55>
+  800ec0:	eb e2                	jmp    800ea4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ec2:	40 f6 c7 01          	test   $0x1,%dil
+  800ec6:	74 06                	je     800ece <memset+0x70>
+  800ec8:	88 07                	mov    %al,(%rdi)
+  800eca:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ece:	40 f6 c7 02          	test   $0x2,%dil
+  800ed2:	74 07                	je     800edb <memset+0x7d>
+  800ed4:	66 89 07             	mov    %ax,(%rdi)
+  800ed7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800edb:	40 f6 c7 04          	test   $0x4,%dil
+  800edf:	74 a9                	je     800e8a <memset+0x2c>
+  800ee1:	89 07                	mov    %eax,(%rdi)
+  800ee3:	48 83 c7 04          	add    $0x4,%rdi
+  800ee7:	eb a1                	jmp    800e8a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ee9:	41 f6 c1 04          	test   $0x4,%r9b
+  800eed:	74 06                	je     800ef5 <memset+0x97>
+  800eef:	89 07                	mov    %eax,(%rdi)
+  800ef1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ef5:	41 f6 c1 02          	test   $0x2,%r9b
+  800ef9:	74 07                	je     800f02 <memset+0xa4>
+  800efb:	66 89 07             	mov    %ax,(%rdi)
+  800efe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f02:	41 f6 c1 01          	test   $0x1,%r9b
+  800f06:	74 9c                	je     800ea4 <memset+0x46>
+  800f08:	88 07                	mov    %al,(%rdi)
+  800f0a:	eb 98                	jmp    800ea4 <memset+0x46>
+
+0000000000800f0c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f0c:	48 89 f8             	mov    %rdi,%rax
+  800f0f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f12:	48 39 fe             	cmp    %rdi,%rsi
+  800f15:	73 3b                	jae    800f52 <memmove+0x46>
+  800f17:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f1b:	48 39 d7             	cmp    %rdx,%rdi
+  800f1e:	73 32                	jae    800f52 <memmove+0x46>
+        s += n;
+        d += n;
+  800f20:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f24:	48 89 d6             	mov    %rdx,%rsi
+  800f27:	48 09 fe             	or     %rdi,%rsi
+  800f2a:	48 09 ce             	or     %rcx,%rsi
+  800f2d:	40 f6 c6 07          	test   $0x7,%sil
+  800f31:	75 12                	jne    800f45 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f33:	48 83 ef 08          	sub    $0x8,%rdi
+  800f37:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f3b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f3f:	fd                   	std
+  800f40:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f43:	fc                   	cld
+  800f44:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f45:	48 83 ef 01          	sub    $0x1,%rdi
+  800f49:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f4d:	fd                   	std
+  800f4e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f50:	eb f1                	jmp    800f43 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f52:	48 89 f2             	mov    %rsi,%rdx
+  800f55:	48 09 c2             	or     %rax,%rdx
+  800f58:	48 09 ca             	or     %rcx,%rdx
+  800f5b:	f6 c2 07             	test   $0x7,%dl
+  800f5e:	75 0c                	jne    800f6c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f60:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f64:	48 89 c7             	mov    %rax,%rdi
+  800f67:	fc                   	cld
+  800f68:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f6b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f6c:	48 89 c7             	mov    %rax,%rdi
+  800f6f:	fc                   	cld
+  800f70:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f72:	c3                   	ret
+
+0000000000800f73 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f77:	48 b8 0c 0f 80 00 00 	movabs $0x800f0c,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+}
+  800f83:	5d                   	pop    %rbp
+  800f84:	c3                   	ret
+
+0000000000800f85 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f85:	55                   	push   %rbp
+  800f86:	48 89 e5             	mov    %rsp,%rbp
+  800f89:	41 57                	push   %r15
+  800f8b:	41 56                	push   %r14
+  800f8d:	41 55                	push   %r13
+  800f8f:	41 54                	push   %r12
+  800f91:	53                   	push   %rbx
+  800f92:	48 83 ec 08          	sub    $0x8,%rsp
+  800f96:	49 89 fe             	mov    %rdi,%r14
+  800f99:	49 89 f7             	mov    %rsi,%r15
+  800f9c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f9f:	48 89 f7             	mov    %rsi,%rdi
+  800fa2:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+  800fae:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fb1:	48 89 de             	mov    %rbx,%rsi
+  800fb4:	4c 89 f7             	mov    %r14,%rdi
+  800fb7:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800fbe:	00 00 00 
+  800fc1:	ff d0                	call   *%rax
+  800fc3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc6:	48 39 c3             	cmp    %rax,%rbx
+  800fc9:	74 36                	je     801001 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fcb:	48 89 d8             	mov    %rbx,%rax
+  800fce:	4c 29 e8             	sub    %r13,%rax
+  800fd1:	49 39 c4             	cmp    %rax,%r12
+  800fd4:	73 31                	jae    801007 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fd6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fdb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fdf:	4c 89 fe             	mov    %r15,%rsi
+  800fe2:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fee:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ff2:	48 83 c4 08          	add    $0x8,%rsp
+  800ff6:	5b                   	pop    %rbx
+  800ff7:	41 5c                	pop    %r12
+  800ff9:	41 5d                	pop    %r13
+  800ffb:	41 5e                	pop    %r14
+  800ffd:	41 5f                	pop    %r15
+  800fff:	5d                   	pop    %rbp
+  801000:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801001:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801005:	eb eb                	jmp    800ff2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801007:	48 83 eb 01          	sub    $0x1,%rbx
+  80100b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80100f:	48 89 da             	mov    %rbx,%rdx
+  801012:	4c 89 fe             	mov    %r15,%rsi
+  801015:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  80101c:	00 00 00 
+  80101f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801021:	49 01 de             	add    %rbx,%r14
+  801024:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801029:	eb c3                	jmp    800fee <strlcat+0x69>
+
+000000000080102b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80102b:	48 85 d2             	test   %rdx,%rdx
+  80102e:	74 2d                	je     80105d <memcmp+0x32>
+  801030:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801035:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801039:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80103e:	44 38 c1             	cmp    %r8b,%cl
+  801041:	75 0f                	jne    801052 <memcmp+0x27>
+    while (n-- > 0) {
+  801043:	48 83 c0 01          	add    $0x1,%rax
+  801047:	48 39 c2             	cmp    %rax,%rdx
+  80104a:	75 e9                	jne    801035 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80104c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801051:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801052:	0f b6 c1             	movzbl %cl,%eax
+  801055:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801059:	44 29 c0             	sub    %r8d,%eax
+  80105c:	c3                   	ret
+    return 0;
+  80105d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801062:	c3                   	ret
+
+0000000000801063 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801063:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801067:	48 39 c7             	cmp    %rax,%rdi
+  80106a:	73 0f                	jae    80107b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80106c:	40 38 37             	cmp    %sil,(%rdi)
+  80106f:	74 0e                	je     80107f <memfind+0x1c>
+    for (; src < end; src++) {
+  801071:	48 83 c7 01          	add    $0x1,%rdi
+  801075:	48 39 f8             	cmp    %rdi,%rax
+  801078:	75 f2                	jne    80106c <memfind+0x9>
+  80107a:	c3                   	ret
+  80107b:	48 89 f8             	mov    %rdi,%rax
+  80107e:	c3                   	ret
+  80107f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801082:	c3                   	ret
+
+0000000000801083 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801083:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801086:	0f b6 37             	movzbl (%rdi),%esi
+  801089:	40 80 fe 20          	cmp    $0x20,%sil
+  80108d:	74 06                	je     801095 <strtol+0x12>
+  80108f:	40 80 fe 09          	cmp    $0x9,%sil
+  801093:	75 13                	jne    8010a8 <strtol+0x25>
+  801095:	48 83 c7 01          	add    $0x1,%rdi
+  801099:	0f b6 37             	movzbl (%rdi),%esi
+  80109c:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a0:	74 f3                	je     801095 <strtol+0x12>
+  8010a2:	40 80 fe 09          	cmp    $0x9,%sil
+  8010a6:	74 ed                	je     801095 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010a8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010ab:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ae:	3c 01                	cmp    $0x1,%al
+  8010b0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010b4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010ba:	75 0f                	jne    8010cb <strtol+0x48>
+  8010bc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010bf:	74 14                	je     8010d5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010c1:	85 d2                	test   %edx,%edx
+  8010c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010cb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010d0:	4c 63 ca             	movslq %edx,%r9
+  8010d3:	eb 36                	jmp    80110b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010d9:	74 0f                	je     8010ea <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010db:	85 d2                	test   %edx,%edx
+  8010dd:	75 ec                	jne    8010cb <strtol+0x48>
+        s++;
+  8010df:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010e3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010e8:	eb e1                	jmp    8010cb <strtol+0x48>
+        s += 2;
+  8010ea:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010ee:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010f3:	eb d6                	jmp    8010cb <strtol+0x48>
+            dig -= '0';
+  8010f5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010f8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010fc:	41 39 d0             	cmp    %edx,%r8d
+  8010ff:	7d 21                	jge    801122 <strtol+0x9f>
+        val = val * base + dig;
+  801101:	49 0f af c1          	imul   %r9,%rax
+  801105:	0f b6 c9             	movzbl %cl,%ecx
+  801108:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80110b:	48 83 c7 01          	add    $0x1,%rdi
+  80110f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801113:	80 f9 39             	cmp    $0x39,%cl
+  801116:	76 dd                	jbe    8010f5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801118:	80 f9 7b             	cmp    $0x7b,%cl
+  80111b:	77 05                	ja     801122 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80111d:	83 e9 57             	sub    $0x57,%ecx
+  801120:	eb d6                	jmp    8010f8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801122:	4d 85 d2             	test   %r10,%r10
+  801125:	74 03                	je     80112a <strtol+0xa7>
+  801127:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80112a:	48 89 c2             	mov    %rax,%rdx
+  80112d:	48 f7 da             	neg    %rdx
+  801130:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801134:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801138:	c3                   	ret
+
+0000000000801139 <strrev>:
+
+void
+strrev(char *str)
+{
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+  80113d:	53                   	push   %rbx
+  80113e:	48 83 ec 08          	sub    $0x8,%rsp
+  801142:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801145:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  80114c:	00 00 00 
+  80114f:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801151:	83 e8 01             	sub    $0x1,%eax
+  801154:	85 c0                	test   %eax,%eax
+  801156:	7e 22                	jle    80117a <strrev+0x41>
+  801158:	48 98                	cltq
+  80115a:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80115f:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801163:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801167:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80116b:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80116e:	48 83 c2 01          	add    $0x1,%rdx
+  801172:	48 83 e8 01          	sub    $0x1,%rax
+  801176:	39 c2                	cmp    %eax,%edx
+  801178:	7c e5                	jl     80115f <strrev+0x26>
+	}
+}
+  80117a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117e:	c9                   	leave
+  80117f:	c3                   	ret
+
+0000000000801180 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801180:	85 d2                	test   %edx,%edx
+  801182:	0f 84 80 00 00 00    	je     801208 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801188:	55                   	push   %rbp
+  801189:	48 89 e5             	mov    %rsp,%rbp
+  80118c:	53                   	push   %rbx
+  80118d:	48 83 ec 08          	sub    $0x8,%rsp
+  801191:	49 89 f2             	mov    %rsi,%r10
+  801194:	41 89 d3             	mov    %edx,%r11d
+  801197:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  80119a:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80119f:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8011a2:	eb 20                	jmp    8011c4 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8011a4:	41 89 f1             	mov    %esi,%r9d
+  8011a7:	83 c2 30             	add    $0x30,%edx
+  8011aa:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8011ad:	89 f8                	mov    %edi,%eax
+  8011af:	99                   	cltd
+  8011b0:	f7 f9                	idiv   %ecx
+  8011b2:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	74 2e                	je     8011e6 <itoa+0x66>
+  8011b8:	83 c6 01             	add    $0x1,%esi
+  8011bb:	49 83 c0 01          	add    $0x1,%r8
+  8011bf:	44 39 cb             	cmp    %r9d,%ebx
+  8011c2:	7e 15                	jle    8011d9 <itoa+0x59>
+		digit = sum % base;
+  8011c4:	89 f8                	mov    %edi,%eax
+  8011c6:	99                   	cltd
+  8011c7:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8011c9:	83 fa 09             	cmp    $0x9,%edx
+  8011cc:	7e d6                	jle    8011a4 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8011ce:	41 89 f1             	mov    %esi,%r9d
+  8011d1:	83 c2 37             	add    $0x37,%edx
+  8011d4:	41 88 10             	mov    %dl,(%r8)
+  8011d7:	eb d4                	jmp    8011ad <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8011d9:	41 83 eb 01          	sub    $0x1,%r11d
+  8011dd:	45 39 cb             	cmp    %r9d,%r11d
+  8011e0:	75 04                	jne    8011e6 <itoa+0x66>
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	75 28                	jne    80120e <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8011e6:	4d 63 c9             	movslq %r9d,%r9
+  8011e9:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8011ee:	4c 89 d7             	mov    %r10,%rdi
+  8011f1:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  8011f8:	00 00 00 
+  8011fb:	ff d0                	call   *%rax
+	return 0;
+  8011fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801202:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801206:	c9                   	leave
+  801207:	c3                   	ret
+		return -1;
+  801208:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80120d:	c3                   	ret
+		return -1;
+  80120e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801213:	eb ed                	jmp    801202 <itoa+0x82>
+
+0000000000801215 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	53                   	push   %rbx
+  80121a:	48 89 fa             	mov    %rdi,%rdx
+  80121d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80123c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+0000000000801242 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801256:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801260:	be 00 00 00 00       	mov    $0x0,%esi
+  801265:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80126d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+
+0000000000801273 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801273:	55                   	push   %rbp
+  801274:	48 89 e5             	mov    %rsp,%rbp
+  801277:	53                   	push   %rbx
+  801278:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80127c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801284:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801293:	be 00 00 00 00       	mov    $0x0,%esi
+  801298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a0:	48 85 c0             	test   %rax,%rax
+  8012a3:	7f 06                	jg     8012ab <sys_env_destroy+0x38>
+}
+  8012a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a9:	c9                   	leave
+  8012aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ab:	49 89 c0             	mov    %rax,%r8
+  8012ae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012b3:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  8012ba:	00 00 00 
+  8012bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c2:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  8012c9:	00 00 00 
+  8012cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d1:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  8012d8:	00 00 00 
+  8012db:	41 ff d1             	call   *%r9
+
+00000000008012de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012de:	55                   	push   %rbp
+  8012df:	48 89 e5             	mov    %rsp,%rbp
+  8012e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801307:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <sys_yield>:
+
+void
+sys_yield(void) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801314:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801319:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801328:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132d:	be 00 00 00 00       	mov    $0x0,%esi
+  801332:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801338:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80133a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+
+0000000000801340 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+  801344:	53                   	push   %rbx
+  801345:	48 89 fa             	mov    %rdi,%rdx
+  801348:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80134b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801350:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801357:	00 00 00 
+  80135a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135f:	be 00 00 00 00       	mov    $0x0,%esi
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80136c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+
+0000000000801372 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	53                   	push   %rbx
+  801377:	49 89 f8             	mov    %rdi,%r8
+  80137a:	48 89 d3             	mov    %rdx,%rbx
+  80137d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801380:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801385:	4c 89 c2             	mov    %r8,%rdx
+  801388:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138b:	be 00 00 00 00       	mov    $0x0,%esi
+  801390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801396:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801398:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139c:	c9                   	leave
+  80139d:	c3                   	ret
+
+000000000080139e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80139e:	55                   	push   %rbp
+  80139f:	48 89 e5             	mov    %rsp,%rbp
+  8013a2:	53                   	push   %rbx
+  8013a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a7:	89 f8                	mov    %edi,%eax
+  8013a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ac:	48 63 f9             	movslq %ecx,%rdi
+  8013af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c7:	48 85 c0             	test   %rax,%rax
+  8013ca:	7f 06                	jg     8013d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d2:	49 89 c0             	mov    %rax,%r8
+  8013d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013da:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  8013e1:	00 00 00 
+  8013e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e9:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  8013f0:	00 00 00 
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  8013ff:	00 00 00 
+  801402:	41 ff d1             	call   *%r9
+
+0000000000801405 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	53                   	push   %rbx
+  80140a:	48 83 ec 08          	sub    $0x8,%rsp
+  80140e:	89 f8                	mov    %edi,%eax
+  801410:	49 89 f2             	mov    %rsi,%r10
+  801413:	48 89 cf             	mov    %rcx,%rdi
+  801416:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801419:	48 63 da             	movslq %edx,%rbx
+  80141c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801424:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801427:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142c:	48 85 c0             	test   %rax,%rax
+  80142f:	7f 06                	jg     801437 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801437:	49 89 c0             	mov    %rax,%r8
+  80143a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80143f:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  801446:	00 00 00 
+  801449:	be 26 00 00 00       	mov    $0x26,%esi
+  80144e:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  801455:	00 00 00 
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  801464:	00 00 00 
+  801467:	41 ff d1             	call   *%r9
+
+000000000080146a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 08          	sub    $0x8,%rsp
+  801473:	48 89 f1             	mov    %rsi,%rcx
+  801476:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801479:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801481:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801486:	be 00 00 00 00       	mov    $0x0,%esi
+  80148b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801491:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801493:	48 85 c0             	test   %rax,%rax
+  801496:	7f 06                	jg     80149e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801498:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149c:	c9                   	leave
+  80149d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149e:	49 89 c0             	mov    %rax,%r8
+  8014a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014a6:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  8014ad:	00 00 00 
+  8014b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b5:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  8014bc:	00 00 00 
+  8014bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c4:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  8014cb:	00 00 00 
+  8014ce:	41 ff d1             	call   *%r9
+
+00000000008014d1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014d1:	55                   	push   %rbp
+  8014d2:	48 89 e5             	mov    %rsp,%rbp
+  8014d5:	53                   	push   %rbx
+  8014d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014da:	48 63 ce             	movslq %esi,%rcx
+  8014dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014fc:	48 85 c0             	test   %rax,%rax
+  8014ff:	7f 06                	jg     801507 <sys_env_set_status+0x36>
+}
+  801501:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801505:	c9                   	leave
+  801506:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801507:	49 89 c0             	mov    %rax,%r8
+  80150a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80150f:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  801516:	00 00 00 
+  801519:	be 26 00 00 00       	mov    $0x26,%esi
+  80151e:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  801525:	00 00 00 
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  801534:	00 00 00 
+  801537:	41 ff d1             	call   *%r9
+
+000000000080153a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80153a:	55                   	push   %rbp
+  80153b:	48 89 e5             	mov    %rsp,%rbp
+  80153e:	53                   	push   %rbx
+  80153f:	48 83 ec 08          	sub    $0x8,%rsp
+  801543:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801546:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801549:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801553:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801558:	be 00 00 00 00       	mov    $0x0,%esi
+  80155d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801563:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801565:	48 85 c0             	test   %rax,%rax
+  801568:	7f 06                	jg     801570 <sys_env_set_trapframe+0x36>
+}
+  80156a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156e:	c9                   	leave
+  80156f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801570:	49 89 c0             	mov    %rax,%r8
+  801573:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801578:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  80157f:	00 00 00 
+  801582:	be 26 00 00 00       	mov    $0x26,%esi
+  801587:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  80158e:	00 00 00 
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+  801596:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  80159d:	00 00 00 
+  8015a0:	41 ff d1             	call   *%r9
+
+00000000008015a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015a3:	55                   	push   %rbp
+  8015a4:	48 89 e5             	mov    %rsp,%rbp
+  8015a7:	53                   	push   %rbx
+  8015a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ce:	48 85 c0             	test   %rax,%rax
+  8015d1:	7f 06                	jg     8015d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d7:	c9                   	leave
+  8015d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d9:	49 89 c0             	mov    %rax,%r8
+  8015dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015e1:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  8015e8:	00 00 00 
+  8015eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f0:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  8015f7:	00 00 00 
+  8015fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ff:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  801606:	00 00 00 
+  801609:	41 ff d1             	call   *%r9
+
+000000000080160c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80160c:	55                   	push   %rbp
+  80160d:	48 89 e5             	mov    %rsp,%rbp
+  801610:	53                   	push   %rbx
+  801611:	89 f8                	mov    %edi,%eax
+  801613:	49 89 f1             	mov    %rsi,%r9
+  801616:	48 89 d3             	mov    %rdx,%rbx
+  801619:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80161c:	49 63 f0             	movslq %r8d,%rsi
+  80161f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801622:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801627:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801630:	cd 30                	int    $0x30
+}
+  801632:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801636:	c9                   	leave
+  801637:	c3                   	ret
+
+0000000000801638 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801638:	55                   	push   %rbp
+  801639:	48 89 e5             	mov    %rsp,%rbp
+  80163c:	53                   	push   %rbx
+  80163d:	48 83 ec 08          	sub    $0x8,%rsp
+  801641:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801644:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164c:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801654:	be 00 00 00 00       	mov    $0x0,%esi
+  801659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	7f 06                	jg     80166c <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166c:	49 89 c0             	mov    %rax,%r8
+  80166f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801674:	48 ba 88 3f 80 00 00 	movabs $0x803f88,%rdx
+  80167b:	00 00 00 
+  80167e:	be 26 00 00 00       	mov    $0x26,%esi
+  801683:	48 bf a7 3f 80 00 00 	movabs $0x803fa7,%rdi
+  80168a:	00 00 00 
+  80168d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801692:	49 b9 9d 02 80 00 00 	movabs $0x80029d,%r9
+  801699:	00 00 00 
+  80169c:	41 ff d1             	call   *%r9
+
+000000000080169f <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8016a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a8:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  8016af:	00 00 00 
+  8016b2:	ff d0                	call   *%rax
+}
+  8016b4:	5d                   	pop    %rbp
+  8016b5:	c3                   	ret
+
+00000000008016b6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016df:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+
+00000000008016e7 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8016e7:	55                   	push   %rbp
+  8016e8:	48 89 e5             	mov    %rsp,%rbp
+  8016eb:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8016ec:	48 63 ce             	movslq %esi,%rcx
+  8016ef:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801702:	be 00 00 00 00       	mov    $0x0,%esi
+  801707:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170d:	cd 30                	int    $0x30
+}
+  80170f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801713:	c9                   	leave
+  801714:	c3                   	ret
+
+0000000000801715 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+  801719:	53                   	push   %rbx
+  80171a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80171d:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801721:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801730:	be 00 00 00 00       	mov    $0x0,%esi
+  801735:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173b:	cd 30                	int    $0x30
+}
+  80173d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801741:	c9                   	leave
+  801742:	c3                   	ret
+
+0000000000801743 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801743:	55                   	push   %rbp
+  801744:	48 89 e5             	mov    %rsp,%rbp
+  801747:	53                   	push   %rbx
+  801748:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80174b:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80174e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801753:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801756:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175b:	be 00 00 00 00       	mov    $0x0,%esi
+  801760:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801766:	cd 30                	int    $0x30
+}
+  801768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+
+000000000080176e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80176e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801775:	ff ff ff 
+  801778:	48 01 f8             	add    %rdi,%rax
+  80177b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80177f:	c3                   	ret
+
+0000000000801780 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801780:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801787:	ff ff ff 
+  80178a:	48 01 f8             	add    %rdi,%rax
+  80178d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801791:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801797:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80179b:	c3                   	ret
+
+000000000080179c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	41 57                	push   %r15
+  8017a2:	41 56                	push   %r14
+  8017a4:	41 55                	push   %r13
+  8017a6:	41 54                	push   %r12
+  8017a8:	53                   	push   %rbx
+  8017a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ad:	49 89 ff             	mov    %rdi,%r15
+  8017b0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017b5:	49 bd 5f 34 80 00 00 	movabs $0x80345f,%r13
+  8017bc:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8017bf:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8017c5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8017c8:	48 89 df             	mov    %rbx,%rdi
+  8017cb:	41 ff d5             	call   *%r13
+  8017ce:	83 e0 04             	and    $0x4,%eax
+  8017d1:	74 17                	je     8017ea <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8017d3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017da:	4c 39 f3             	cmp    %r14,%rbx
+  8017dd:	75 e6                	jne    8017c5 <fd_alloc+0x29>
+  8017df:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017e5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017ea:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017ed:	48 83 c4 08          	add    $0x8,%rsp
+  8017f1:	5b                   	pop    %rbx
+  8017f2:	41 5c                	pop    %r12
+  8017f4:	41 5d                	pop    %r13
+  8017f6:	41 5e                	pop    %r14
+  8017f8:	41 5f                	pop    %r15
+  8017fa:	5d                   	pop    %rbp
+  8017fb:	c3                   	ret
+
+00000000008017fc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017fc:	83 ff 1f             	cmp    $0x1f,%edi
+  8017ff:	77 39                	ja     80183a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	41 54                	push   %r12
+  801807:	53                   	push   %rbx
+  801808:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80180b:	48 63 df             	movslq %edi,%rbx
+  80180e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801815:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801819:	48 89 df             	mov    %rbx,%rdi
+  80181c:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  801823:	00 00 00 
+  801826:	ff d0                	call   *%rax
+  801828:	a8 04                	test   $0x4,%al
+  80182a:	74 14                	je     801840 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80182c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801830:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801835:	5b                   	pop    %rbx
+  801836:	41 5c                	pop    %r12
+  801838:	5d                   	pop    %rbp
+  801839:	c3                   	ret
+        return -E_INVAL;
+  80183a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80183f:	c3                   	ret
+        return -E_INVAL;
+  801840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801845:	eb ee                	jmp    801835 <fd_lookup+0x39>
+
+0000000000801847 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801847:	55                   	push   %rbp
+  801848:	48 89 e5             	mov    %rsp,%rbp
+  80184b:	41 54                	push   %r12
+  80184d:	53                   	push   %rbx
+  80184e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801851:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801858:	00 00 00 
+  80185b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801862:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801865:	39 3b                	cmp    %edi,(%rbx)
+  801867:	74 47                	je     8018b0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801869:	48 83 c0 08          	add    $0x8,%rax
+  80186d:	48 8b 18             	mov    (%rax),%rbx
+  801870:	48 85 db             	test   %rbx,%rbx
+  801873:	75 f0                	jne    801865 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801875:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80187c:	00 00 00 
+  80187f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801885:	89 fa                	mov    %edi,%edx
+  801887:	48 bf b8 3f 80 00 00 	movabs $0x803fb8,%rdi
+  80188e:	00 00 00 
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  80189d:	00 00 00 
+  8018a0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018a7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018ab:	5b                   	pop    %rbx
+  8018ac:	41 5c                	pop    %r12
+  8018ae:	5d                   	pop    %rbp
+  8018af:	c3                   	ret
+            return 0;
+  8018b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b5:	eb f0                	jmp    8018a7 <dev_lookup+0x60>
+
+00000000008018b7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8018b7:	55                   	push   %rbp
+  8018b8:	48 89 e5             	mov    %rsp,%rbp
+  8018bb:	41 55                	push   %r13
+  8018bd:	41 54                	push   %r12
+  8018bf:	53                   	push   %rbx
+  8018c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8018c4:	48 89 fb             	mov    %rdi,%rbx
+  8018c7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ca:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018d1:	ff ff ff 
+  8018d4:	48 01 df             	add    %rbx,%rdi
+  8018d7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018db:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018df:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+  8018eb:	41 89 c5             	mov    %eax,%r13d
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 06                	js     8018f8 <fd_close+0x41>
+  8018f2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018f6:	74 1a                	je     801912 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018f8:	45 84 e4             	test   %r12b,%r12b
+  8018fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801900:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801904:	44 89 e8             	mov    %r13d,%eax
+  801907:	48 83 c4 18          	add    $0x18,%rsp
+  80190b:	5b                   	pop    %rbx
+  80190c:	41 5c                	pop    %r12
+  80190e:	41 5d                	pop    %r13
+  801910:	5d                   	pop    %rbp
+  801911:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801912:	8b 3b                	mov    (%rbx),%edi
+  801914:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801918:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+  801924:	41 89 c5             	mov    %eax,%r13d
+  801927:	85 c0                	test   %eax,%eax
+  801929:	78 1b                	js     801946 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80192b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80192f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801933:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801939:	48 85 c0             	test   %rax,%rax
+  80193c:	74 08                	je     801946 <fd_close+0x8f>
+  80193e:	48 89 df             	mov    %rbx,%rdi
+  801941:	ff d0                	call   *%rax
+  801943:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801946:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80194b:	48 89 de             	mov    %rbx,%rsi
+  80194e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801953:	48 b8 6a 14 80 00 00 	movabs $0x80146a,%rax
+  80195a:	00 00 00 
+  80195d:	ff d0                	call   *%rax
+    return res;
+  80195f:	eb a3                	jmp    801904 <fd_close+0x4d>
+
+0000000000801961 <close>:
+
+int
+close(int fdnum) {
+  801961:	55                   	push   %rbp
+  801962:	48 89 e5             	mov    %rsp,%rbp
+  801965:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801969:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80196d:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801974:	00 00 00 
+  801977:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 15                	js     801992 <close+0x31>
+
+    return fd_close(fd, 1);
+  80197d:	be 01 00 00 00       	mov    $0x1,%esi
+  801982:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801986:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+}
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+
+0000000000801994 <close_all>:
+
+void
+close_all(void) {
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+  801998:	41 54                	push   %r12
+  80199a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80199b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a0:	49 bc 61 19 80 00 00 	movabs $0x801961,%r12
+  8019a7:	00 00 00 
+  8019aa:	89 df                	mov    %ebx,%edi
+  8019ac:	41 ff d4             	call   *%r12
+  8019af:	83 c3 01             	add    $0x1,%ebx
+  8019b2:	83 fb 20             	cmp    $0x20,%ebx
+  8019b5:	75 f3                	jne    8019aa <close_all+0x16>
+}
+  8019b7:	5b                   	pop    %rbx
+  8019b8:	41 5c                	pop    %r12
+  8019ba:	5d                   	pop    %rbp
+  8019bb:	c3                   	ret
+
+00000000008019bc <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	41 57                	push   %r15
+  8019c2:	41 56                	push   %r14
+  8019c4:	41 55                	push   %r13
+  8019c6:	41 54                	push   %r12
+  8019c8:	53                   	push   %rbx
+  8019c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8019cd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019d0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019d4:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+  8019e0:	89 c3                	mov    %eax,%ebx
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	0f 88 b8 00 00 00    	js     801aa2 <dup+0xe6>
+    close(newfdnum);
+  8019ea:	44 89 e7             	mov    %r12d,%edi
+  8019ed:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  8019f4:	00 00 00 
+  8019f7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019f9:	4d 63 ec             	movslq %r12d,%r13
+  8019fc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a03:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a07:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a0b:	4c 89 ff             	mov    %r15,%rdi
+  801a0e:	49 be 80 17 80 00 00 	movabs $0x801780,%r14
+  801a15:	00 00 00 
+  801a18:	41 ff d6             	call   *%r14
+  801a1b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a1e:	4c 89 ef             	mov    %r13,%rdi
+  801a21:	41 ff d6             	call   *%r14
+  801a24:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a27:	48 89 df             	mov    %rbx,%rdi
+  801a2a:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a36:	a8 04                	test   $0x4,%al
+  801a38:	74 2b                	je     801a65 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a3a:	41 89 c1             	mov    %eax,%r9d
+  801a3d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a43:	4c 89 f1             	mov    %r14,%rcx
+  801a46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a4b:	48 89 de             	mov    %rbx,%rsi
+  801a4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a53:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  801a5a:	00 00 00 
+  801a5d:	ff d0                	call   *%rax
+  801a5f:	89 c3                	mov    %eax,%ebx
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	78 4e                	js     801ab3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a65:	4c 89 ff             	mov    %r15,%rdi
+  801a68:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  801a6f:	00 00 00 
+  801a72:	ff d0                	call   *%rax
+  801a74:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a77:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a7d:	4c 89 e9             	mov    %r13,%rcx
+  801a80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a85:	4c 89 fe             	mov    %r15,%rsi
+  801a88:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a8d:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+  801a99:	89 c3                	mov    %eax,%ebx
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 14                	js     801ab3 <dup+0xf7>
+
+    return newfdnum;
+  801a9f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801aa2:	89 d8                	mov    %ebx,%eax
+  801aa4:	48 83 c4 18          	add    $0x18,%rsp
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	41 5e                	pop    %r14
+  801aaf:	41 5f                	pop    %r15
+  801ab1:	5d                   	pop    %rbp
+  801ab2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ab3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab8:	4c 89 ee             	mov    %r13,%rsi
+  801abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac0:	49 bc 6a 14 80 00 00 	movabs $0x80146a,%r12
+  801ac7:	00 00 00 
+  801aca:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801acd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ad2:	4c 89 f6             	mov    %r14,%rsi
+  801ad5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ada:	41 ff d4             	call   *%r12
+    return res;
+  801add:	eb c3                	jmp    801aa2 <dup+0xe6>
+
+0000000000801adf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801adf:	55                   	push   %rbp
+  801ae0:	48 89 e5             	mov    %rsp,%rbp
+  801ae3:	41 56                	push   %r14
+  801ae5:	41 55                	push   %r13
+  801ae7:	41 54                	push   %r12
+  801ae9:	53                   	push   %rbx
+  801aea:	48 83 ec 10          	sub    $0x10,%rsp
+  801aee:	89 fb                	mov    %edi,%ebx
+  801af0:	49 89 f4             	mov    %rsi,%r12
+  801af3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801afa:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801b01:	00 00 00 
+  801b04:	ff d0                	call   *%rax
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 4c                	js     801b56 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b0e:	41 8b 3e             	mov    (%r14),%edi
+  801b11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b15:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801b1c:	00 00 00 
+  801b1f:	ff d0                	call   *%rax
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	78 35                	js     801b5a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b25:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b29:	83 e0 03             	and    $0x3,%eax
+  801b2c:	83 f8 01             	cmp    $0x1,%eax
+  801b2f:	74 2d                	je     801b5e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b35:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b39:	48 85 c0             	test   %rax,%rax
+  801b3c:	74 56                	je     801b94 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b3e:	4c 89 ea             	mov    %r13,%rdx
+  801b41:	4c 89 e6             	mov    %r12,%rsi
+  801b44:	4c 89 f7             	mov    %r14,%rdi
+  801b47:	ff d0                	call   *%rax
+}
+  801b49:	48 83 c4 10          	add    $0x10,%rsp
+  801b4d:	5b                   	pop    %rbx
+  801b4e:	41 5c                	pop    %r12
+  801b50:	41 5d                	pop    %r13
+  801b52:	41 5e                	pop    %r14
+  801b54:	5d                   	pop    %rbp
+  801b55:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b56:	48 98                	cltq
+  801b58:	eb ef                	jmp    801b49 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b5a:	48 98                	cltq
+  801b5c:	eb eb                	jmp    801b49 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b5e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  801b65:	00 00 00 
+  801b68:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b6e:	89 da                	mov    %ebx,%edx
+  801b70:	48 bf 19 40 80 00 00 	movabs $0x804019,%rdi
+  801b77:	00 00 00 
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  801b86:	00 00 00 
+  801b89:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b8b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b92:	eb b5                	jmp    801b49 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b94:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b9b:	eb ac                	jmp    801b49 <read+0x6a>
+
+0000000000801b9d <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801b9d:	55                   	push   %rbp
+  801b9e:	48 89 e5             	mov    %rsp,%rbp
+  801ba1:	41 56                	push   %r14
+  801ba3:	41 55                	push   %r13
+  801ba5:	41 54                	push   %r12
+  801ba7:	53                   	push   %rbx
+  801ba8:	48 83 ec 10          	sub    $0x10,%rsp
+  801bac:	89 fb                	mov    %edi,%ebx
+  801bae:	49 89 f4             	mov    %rsi,%r12
+  801bb1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb8:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801bbf:	00 00 00 
+  801bc2:	ff d0                	call   *%rax
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 41                	js     801c09 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bc8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bcc:	41 8b 3e             	mov    (%r14),%edi
+  801bcf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd3:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 35                	js     801c18 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801be3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801be7:	83 e0 03             	and    $0x3,%eax
+  801bea:	83 f8 01             	cmp    $0x1,%eax
+  801bed:	74 2d                	je     801c1c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801bef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bf7:	48 85 c0             	test   %rax,%rax
+  801bfa:	74 56                	je     801c52 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801bfc:	4c 89 ea             	mov    %r13,%rdx
+  801bff:	4c 89 e6             	mov    %r12,%rsi
+  801c02:	4c 89 f7             	mov    %r14,%rdi
+  801c05:	ff d0                	call   *%rax
+  801c07:	eb 02                	jmp    801c0b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c09:	48 98                	cltq
+}
+  801c0b:	48 83 c4 10          	add    $0x10,%rsp
+  801c0f:	5b                   	pop    %rbx
+  801c10:	41 5c                	pop    %r12
+  801c12:	41 5d                	pop    %r13
+  801c14:	41 5e                	pop    %r14
+  801c16:	5d                   	pop    %rbp
+  801c17:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c18:	48 98                	cltq
+  801c1a:	eb ef                	jmp    801c0b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1c:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  801c23:	00 00 00 
+  801c26:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c2c:	89 da                	mov    %ebx,%edx
+  801c2e:	48 bf d8 3f 80 00 00 	movabs $0x803fd8,%rdi
+  801c35:	00 00 00 
+  801c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3d:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  801c44:	00 00 00 
+  801c47:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c49:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c50:	eb b9                	jmp    801c0b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c52:	4c 89 ea             	mov    %r13,%rdx
+  801c55:	4c 89 e6             	mov    %r12,%rsi
+  801c58:	89 df                	mov    %ebx,%edi
+  801c5a:	48 b8 df 1a 80 00 00 	movabs $0x801adf,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	eb a3                	jmp    801c0b <readmap+0x6e>
+
+0000000000801c68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c68:	55                   	push   %rbp
+  801c69:	48 89 e5             	mov    %rsp,%rbp
+  801c6c:	41 57                	push   %r15
+  801c6e:	41 56                	push   %r14
+  801c70:	41 55                	push   %r13
+  801c72:	41 54                	push   %r12
+  801c74:	53                   	push   %rbx
+  801c75:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c79:	48 85 d2             	test   %rdx,%rdx
+  801c7c:	74 54                	je     801cd2 <readn+0x6a>
+  801c7e:	41 89 fd             	mov    %edi,%r13d
+  801c81:	49 89 f6             	mov    %rsi,%r14
+  801c84:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c87:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c8c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c91:	49 bf df 1a 80 00 00 	movabs $0x801adf,%r15
+  801c98:	00 00 00 
+  801c9b:	4c 89 e2             	mov    %r12,%rdx
+  801c9e:	48 29 f2             	sub    %rsi,%rdx
+  801ca1:	4c 01 f6             	add    %r14,%rsi
+  801ca4:	44 89 ef             	mov    %r13d,%edi
+  801ca7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 20                	js     801cce <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cae:	01 c3                	add    %eax,%ebx
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	74 08                	je     801cbc <readn+0x54>
+  801cb4:	48 63 f3             	movslq %ebx,%rsi
+  801cb7:	4c 39 e6             	cmp    %r12,%rsi
+  801cba:	72 df                	jb     801c9b <readn+0x33>
+    }
+    return res;
+  801cbc:	48 63 c3             	movslq %ebx,%rax
+}
+  801cbf:	48 83 c4 08          	add    $0x8,%rsp
+  801cc3:	5b                   	pop    %rbx
+  801cc4:	41 5c                	pop    %r12
+  801cc6:	41 5d                	pop    %r13
+  801cc8:	41 5e                	pop    %r14
+  801cca:	41 5f                	pop    %r15
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+        if (inc < 0) return inc;
+  801cce:	48 98                	cltq
+  801cd0:	eb ed                	jmp    801cbf <readn+0x57>
+    int inc = 1, res = 0;
+  801cd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd7:	eb e3                	jmp    801cbc <readn+0x54>
+
+0000000000801cd9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cd9:	55                   	push   %rbp
+  801cda:	48 89 e5             	mov    %rsp,%rbp
+  801cdd:	41 56                	push   %r14
+  801cdf:	41 55                	push   %r13
+  801ce1:	41 54                	push   %r12
+  801ce3:	53                   	push   %rbx
+  801ce4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ce8:	89 fb                	mov    %edi,%ebx
+  801cea:	49 89 f4             	mov    %rsi,%r12
+  801ced:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cf4:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801cfb:	00 00 00 
+  801cfe:	ff d0                	call   *%rax
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	78 47                	js     801d4b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d04:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d08:	41 8b 3e             	mov    (%r14),%edi
+  801d0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d0f:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 30                	js     801d4f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d1f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d24:	74 2d                	je     801d53 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d2a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d2e:	48 85 c0             	test   %rax,%rax
+  801d31:	74 56                	je     801d89 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d33:	4c 89 ea             	mov    %r13,%rdx
+  801d36:	4c 89 e6             	mov    %r12,%rsi
+  801d39:	4c 89 f7             	mov    %r14,%rdi
+  801d3c:	ff d0                	call   *%rax
+}
+  801d3e:	48 83 c4 10          	add    $0x10,%rsp
+  801d42:	5b                   	pop    %rbx
+  801d43:	41 5c                	pop    %r12
+  801d45:	41 5d                	pop    %r13
+  801d47:	41 5e                	pop    %r14
+  801d49:	5d                   	pop    %rbp
+  801d4a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d4b:	48 98                	cltq
+  801d4d:	eb ef                	jmp    801d3e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d4f:	48 98                	cltq
+  801d51:	eb eb                	jmp    801d3e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d53:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  801d5a:	00 00 00 
+  801d5d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d63:	89 da                	mov    %ebx,%edx
+  801d65:	48 bf 35 40 80 00 00 	movabs $0x804035,%rdi
+  801d6c:	00 00 00 
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d74:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  801d7b:	00 00 00 
+  801d7e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d87:	eb b5                	jmp    801d3e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d89:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d90:	eb ac                	jmp    801d3e <write+0x65>
+
+0000000000801d92 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d92:	55                   	push   %rbp
+  801d93:	48 89 e5             	mov    %rsp,%rbp
+  801d96:	53                   	push   %rbx
+  801d97:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801da1:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801da8:	00 00 00 
+  801dab:	ff d0                	call   *%rax
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	78 0c                	js     801dbd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801db1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801db5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc1:	c9                   	leave
+  801dc2:	c3                   	ret
+
+0000000000801dc3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dc3:	55                   	push   %rbp
+  801dc4:	48 89 e5             	mov    %rsp,%rbp
+  801dc7:	41 55                	push   %r13
+  801dc9:	41 54                	push   %r12
+  801dcb:	53                   	push   %rbx
+  801dcc:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd0:	89 fb                	mov    %edi,%ebx
+  801dd2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd9:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 38                	js     801e21 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ded:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801df1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801df5:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 1c                	js     801e21 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e05:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e0a:	74 20                	je     801e2c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e10:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e14:	48 85 c0             	test   %rax,%rax
+  801e17:	74 47                	je     801e60 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e19:	44 89 e6             	mov    %r12d,%esi
+  801e1c:	4c 89 ef             	mov    %r13,%rdi
+  801e1f:	ff d0                	call   *%rax
+}
+  801e21:	48 83 c4 18          	add    $0x18,%rsp
+  801e25:	5b                   	pop    %rbx
+  801e26:	41 5c                	pop    %r12
+  801e28:	41 5d                	pop    %r13
+  801e2a:	5d                   	pop    %rbp
+  801e2b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e2c:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  801e33:	00 00 00 
+  801e36:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e3c:	89 da                	mov    %ebx,%edx
+  801e3e:	48 bf f8 3f 80 00 00 	movabs $0x803ff8,%rdi
+  801e45:	00 00 00 
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  801e54:	00 00 00 
+  801e57:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e5e:	eb c1                	jmp    801e21 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e60:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e65:	eb ba                	jmp    801e21 <ftruncate+0x5e>
+
+0000000000801e67 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e67:	55                   	push   %rbp
+  801e68:	48 89 e5             	mov    %rsp,%rbp
+  801e6b:	41 54                	push   %r12
+  801e6d:	53                   	push   %rbx
+  801e6e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e72:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e75:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e79:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801e80:	00 00 00 
+  801e83:	ff d0                	call   *%rax
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 4e                	js     801ed7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e89:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e8d:	41 8b 3c 24          	mov    (%r12),%edi
+  801e91:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e95:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801e9c:	00 00 00 
+  801e9f:	ff d0                	call   *%rax
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 32                	js     801ed7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ea5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ea9:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801eae:	74 30                	je     801ee0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801eb0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801eb3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801eba:	00 00 00 
+    stat->st_isdir = 0;
+  801ebd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ec4:	00 00 00 
+    stat->st_dev = dev;
+  801ec7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ece:	48 89 de             	mov    %rbx,%rsi
+  801ed1:	4c 89 e7             	mov    %r12,%rdi
+  801ed4:	ff 50 30             	call   *0x30(%rax)
+}
+  801ed7:	48 83 c4 10          	add    $0x10,%rsp
+  801edb:	5b                   	pop    %rbx
+  801edc:	41 5c                	pop    %r12
+  801ede:	5d                   	pop    %rbp
+  801edf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ee0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ee5:	eb f0                	jmp    801ed7 <fstat+0x70>
+
+0000000000801ee7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ee7:	55                   	push   %rbp
+  801ee8:	48 89 e5             	mov    %rsp,%rbp
+  801eeb:	41 54                	push   %r12
+  801eed:	53                   	push   %rbx
+  801eee:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef6:	48 b8 3e 2c 80 00 00 	movabs $0x802c3e,%rax
+  801efd:	00 00 00 
+  801f00:	ff d0                	call   *%rax
+  801f02:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 25                	js     801f2d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f08:	4c 89 e6             	mov    %r12,%rsi
+  801f0b:	89 c7                	mov    %eax,%edi
+  801f0d:	48 b8 67 1e 80 00 00 	movabs $0x801e67,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f1c:	89 df                	mov    %ebx,%edi
+  801f1e:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+
+    return res;
+  801f2a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f2d:	89 d8                	mov    %ebx,%eax
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+
+0000000000801f34 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	41 54                	push   %r12
+  801f3a:	53                   	push   %rbx
+  801f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3f:	48 89 fb             	mov    %rdi,%rbx
+  801f42:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f49:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f4e:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 1f                	js     801f7d <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801f5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f62:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801f66:	48 85 c0             	test   %rax,%rax
+  801f69:	74 1b                	je     801f86 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801f6b:	4c 89 e6             	mov    %r12,%rsi
+  801f6e:	48 89 df             	mov    %rbx,%rdi
+  801f71:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f7d:	48 83 c4 10          	add    $0x10,%rsp
+  801f81:	5b                   	pop    %rbx
+  801f82:	41 5c                	pop    %r12
+  801f84:	5d                   	pop    %rbp
+  801f85:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f8b:	eb f0                	jmp    801f7d <create_snapshot+0x49>
+
+0000000000801f8d <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f99:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f9e:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 1e                	js     801fcc <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801fae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb2:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801fb6:	48 85 d2             	test   %rdx,%rdx
+  801fb9:	74 13                	je     801fce <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc0:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fce:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd3:	eb f7                	jmp    801fcc <print_snapshot_list+0x3f>
+
+0000000000801fd5 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801fd5:	55                   	push   %rbp
+  801fd6:	48 89 e5             	mov    %rsp,%rbp
+  801fd9:	53                   	push   %rbx
+  801fda:	48 83 ec 18          	sub    $0x18,%rsp
+  801fde:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fe1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe5:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fea:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	85 c0                	test   %eax,%eax
+  801ff8:	78 1c                	js     802016 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801ffa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ffe:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802002:	48 85 c0             	test   %rax,%rax
+  802005:	74 15                	je     80201c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802007:	48 89 df             	mov    %rbx,%rdi
+  80200a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802013:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802016:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80201a:	c9                   	leave
+  80201b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80201c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802021:	eb f3                	jmp    802016 <accept_snapshot+0x41>
+
+0000000000802023 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+  802027:	53                   	push   %rbx
+  802028:	48 83 ec 18          	sub    $0x18,%rsp
+  80202c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80202f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802033:	bf 66 00 00 00       	mov    $0x66,%edi
+  802038:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 1c                	js     802064 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204c:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802050:	48 85 c0             	test   %rax,%rax
+  802053:	74 15                	je     80206a <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802055:	48 89 df             	mov    %rbx,%rdi
+  802058:	ff d0                	call   *%rax
+    if (res < 0) {
+  80205a:	85 c0                	test   %eax,%eax
+  80205c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802061:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802064:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+        return -E_NOT_SUPP;
+  80206a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206f:	eb f3                	jmp    802064 <delete_snapshot+0x41>
+
+0000000000802071 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802071:	55                   	push   %rbp
+  802072:	48 89 e5             	mov    %rsp,%rbp
+  802075:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802079:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80207d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802082:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 14                	js     8020a6 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802092:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802096:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80209a:	48 85 d2             	test   %rdx,%rdx
+  80209d:	74 09                	je     8020a8 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80209f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a4:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8020a6:	c9                   	leave
+  8020a7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020a8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ad:	eb f7                	jmp    8020a6 <gc_snapshots+0x35>
+
+00000000008020af <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	41 56                	push   %r14
+  8020b5:	41 55                	push   %r13
+  8020b7:	41 54                	push   %r12
+  8020b9:	53                   	push   %rbx
+  8020ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8020be:	48 89 fb             	mov    %rdi,%rbx
+  8020c1:	49 89 f4             	mov    %rsi,%r12
+  8020c4:	49 89 d5             	mov    %rdx,%r13
+  8020c7:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020ce:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020d3:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	78 1b                	js     8020fe <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8020e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e7:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8020eb:	48 85 c0             	test   %rax,%rax
+  8020ee:	74 1b                	je     80210b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8020f0:	4c 89 f1             	mov    %r14,%rcx
+  8020f3:	4c 89 ea             	mov    %r13,%rdx
+  8020f6:	4c 89 e6             	mov    %r12,%rsi
+  8020f9:	48 89 df             	mov    %rbx,%rdi
+  8020fc:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020fe:	48 83 c4 10          	add    $0x10,%rsp
+  802102:	5b                   	pop    %rbx
+  802103:	41 5c                	pop    %r12
+  802105:	41 5d                	pop    %r13
+  802107:	41 5e                	pop    %r14
+  802109:	5d                   	pop    %rbp
+  80210a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80210b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802110:	eb ec                	jmp    8020fe <diff_snapshots+0x4f>
+
+0000000000802112 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 55                	push   %r13
+  802118:	41 54                	push   %r12
+  80211a:	53                   	push   %rbx
+  80211b:	48 83 ec 18          	sub    $0x18,%rsp
+  80211f:	48 89 fb             	mov    %rdi,%rbx
+  802122:	49 89 f4             	mov    %rsi,%r12
+  802125:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802128:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80212c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802131:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 18                	js     802159 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802145:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802149:	48 85 c0             	test   %rax,%rax
+  80214c:	74 16                	je     802164 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80214e:	4c 89 ea             	mov    %r13,%rdx
+  802151:	4c 89 e6             	mov    %r12,%rsi
+  802154:	48 89 df             	mov    %rbx,%rdi
+  802157:	ff d0                	call   *%rax
+
+    return res;
+}
+  802159:	48 83 c4 18          	add    $0x18,%rsp
+  80215d:	5b                   	pop    %rbx
+  80215e:	41 5c                	pop    %r12
+  802160:	41 5d                	pop    %r13
+  802162:	5d                   	pop    %rbp
+  802163:	c3                   	ret
+        return -E_NOT_SUPP;
+  802164:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802169:	eb ee                	jmp    802159 <send_snapshot+0x47>
+
+000000000080216b <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80216b:	55                   	push   %rbp
+  80216c:	48 89 e5             	mov    %rsp,%rbp
+  80216f:	53                   	push   %rbx
+  802170:	48 83 ec 18          	sub    $0x18,%rsp
+  802174:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802177:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80217b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802180:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	78 12                	js     8021a2 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802190:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802194:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802198:	48 85 c0             	test   %rax,%rax
+  80219b:	74 0b                	je     8021a8 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80219d:	48 89 df             	mov    %rbx,%rdi
+  8021a0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021a8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021ad:	eb f3                	jmp    8021a2 <receive_snapshot+0x37>
+
+00000000008021af <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8021af:	55                   	push   %rbp
+  8021b0:	48 89 e5             	mov    %rsp,%rbp
+  8021b3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021b7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021bb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021c0:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  8021c7:	00 00 00 
+  8021ca:	ff d0                	call   *%rax
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	78 17                	js     8021e7 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8021d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d4:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8021db:	48 85 d2             	test   %rdx,%rdx
+  8021de:	74 09                	je     8021e9 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8021e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e5:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021e7:	c9                   	leave
+  8021e8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021e9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021ee:	eb f7                	jmp    8021e7 <free_space_bytes+0x38>
+
+00000000008021f0 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021fc:	bf 66 00 00 00       	mov    $0x66,%edi
+  802201:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 17                	js     802228 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802215:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80221c:	48 85 d2             	test   %rdx,%rdx
+  80221f:	74 09                	je     80222a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+  802226:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+        return -E_NOT_SUPP;
+  80222a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80222f:	eb f7                	jmp    802228 <busy_space_bytes+0x38>
+
+0000000000802231 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	41 54                	push   %r12
+  802237:	53                   	push   %rbx
+  802238:	48 83 ec 10          	sub    $0x10,%rsp
+  80223c:	89 fb                	mov    %edi,%ebx
+  80223e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802241:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802245:	bf 66 00 00 00       	mov    $0x66,%edi
+  80224a:	48 b8 47 18 80 00 00 	movabs $0x801847,%rax
+  802251:	00 00 00 
+  802254:	ff d0                	call   *%rax
+  802256:	85 c0                	test   %eax,%eax
+  802258:	78 17                	js     802271 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80225a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80225e:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802265:	48 85 c0             	test   %rax,%rax
+  802268:	74 10                	je     80227a <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80226a:	4c 89 e6             	mov    %r12,%rsi
+  80226d:	89 df                	mov    %ebx,%edi
+  80226f:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802271:	48 83 c4 10          	add    $0x10,%rsp
+  802275:	5b                   	pop    %rbx
+  802276:	41 5c                	pop    %r12
+  802278:	5d                   	pop    %rbp
+  802279:	c3                   	ret
+        return -E_NOT_SUPP;
+  80227a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80227f:	eb f0                	jmp    802271 <snapshots_space+0x40>
+
+0000000000802281 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802281:	55                   	push   %rbp
+  802282:	48 89 e5             	mov    %rsp,%rbp
+  802285:	41 55                	push   %r13
+  802287:	41 54                	push   %r12
+  802289:	53                   	push   %rbx
+  80228a:	48 83 ec 08          	sub    $0x8,%rsp
+  80228e:	41 89 fd             	mov    %edi,%r13d
+  802291:	48 89 f3             	mov    %rsi,%rbx
+  802294:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802297:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80229e:	00 00 00 
+  8022a1:	83 38 00             	cmpl   $0x0,(%rax)
+  8022a4:	74 57                	je     8022fd <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8022a6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022ac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022b1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8022b8:	00 00 00 
+  8022bb:	44 89 ee             	mov    %r13d,%esi
+  8022be:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8022c5:	00 00 00 
+  8022c8:	8b 38                	mov    (%rax),%edi
+  8022ca:	48 b8 a2 38 80 00 00 	movabs $0x8038a2,%rax
+  8022d1:	00 00 00 
+  8022d4:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8022d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022db:	4c 89 e2             	mov    %r12,%rdx
+  8022de:	48 89 de             	mov    %rbx,%rsi
+  8022e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e6:	48 b8 8a 38 80 00 00 	movabs $0x80388a,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+}
+  8022f2:	48 83 c4 08          	add    $0x8,%rsp
+  8022f6:	5b                   	pop    %rbx
+  8022f7:	41 5c                	pop    %r12
+  8022f9:	41 5d                	pop    %r13
+  8022fb:	5d                   	pop    %rbp
+  8022fc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022fd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802302:	48 b8 60 39 80 00 00 	movabs $0x803960,%rax
+  802309:	00 00 00 
+  80230c:	ff d0                	call   *%rax
+  80230e:	a3 00 a0 80 00 00 00 	movabs %eax,0x80a000
+  802315:	00 00 
+  802317:	eb 8d                	jmp    8022a6 <fsipc_region+0x25>
+
+0000000000802319 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802319:	55                   	push   %rbp
+  80231a:	48 89 e5             	mov    %rsp,%rbp
+  80231d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802321:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802328:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802329:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80232d:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+}
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+000000000080233b <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80233b:	85 ff                	test   %edi,%edi
+  80233d:	78 6d                	js     8023ac <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80233f:	55                   	push   %rbp
+  802340:	48 89 e5             	mov    %rsp,%rbp
+  802343:	41 54                	push   %r12
+  802345:	53                   	push   %rbx
+  802346:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802349:	48 85 f6             	test   %rsi,%rsi
+  80234c:	74 57                	je     8023a5 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80234e:	89 f8                	mov    %edi,%eax
+  802350:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802357:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802359:	be 00 00 00 00       	mov    $0x0,%esi
+  80235e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802363:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  80236a:	00 00 00 
+  80236d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 2d                	js     8023a0 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802373:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  80237a:	00 00 00 
+  80237d:	49 63 14 24          	movslq (%r12),%rdx
+  802381:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802388:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80238d:	48 89 df             	mov    %rbx,%rdi
+  802390:	48 b8 0c 0f 80 00 00 	movabs $0x800f0c,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80239c:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8023a0:	5b                   	pop    %rbx
+  8023a1:	41 5c                	pop    %r12
+  8023a3:	5d                   	pop    %rbp
+  8023a4:	c3                   	ret
+        return -E_INVAL;
+  8023a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023aa:	eb f4                	jmp    8023a0 <devfile_df_snapshots+0x65>
+  8023ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8023b1:	c3                   	ret
+
+00000000008023b2 <devfile_df_busy>:
+devfile_df_busy() {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8023b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023bb:	bf 11 00 00 00       	mov    $0x11,%edi
+  8023c0:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+}
+  8023cc:	5d                   	pop    %rbp
+  8023cd:	c3                   	ret
+
+00000000008023ce <devfile_df_free>:
+devfile_df_free() {
+  8023ce:	55                   	push   %rbp
+  8023cf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8023d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8023dc:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+}
+  8023e8:	5d                   	pop    %rbp
+  8023e9:	c3                   	ret
+
+00000000008023ea <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8023ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023f8:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  8023ff:	00 00 00 
+  802402:	ff d0                	call   *%rax
+}
+  802404:	5d                   	pop    %rbp
+  802405:	c3                   	ret
+
+0000000000802406 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802406:	55                   	push   %rbp
+  802407:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80240a:	be 00 00 00 00       	mov    $0x0,%esi
+  80240f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802414:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802420:	85 c0                	test   %eax,%eax
+  802422:	ba 00 00 00 00       	mov    $0x0,%edx
+  802427:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80242a:	5d                   	pop    %rbp
+  80242b:	c3                   	ret
+
+000000000080242c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802430:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802437:	00 00 00 
+  80243a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80243d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80243f:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802442:	be 00 00 00 00       	mov    $0x0,%esi
+  802447:	bf 02 00 00 00       	mov    $0x2,%edi
+  80244c:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+}
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+
+000000000080245a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80245a:	55                   	push   %rbp
+  80245b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80245e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802461:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802468:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80246a:	be 00 00 00 00       	mov    $0x0,%esi
+  80246f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802474:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  80247b:	00 00 00 
+  80247e:	ff d0                	call   *%rax
+}
+  802480:	5d                   	pop    %rbp
+  802481:	c3                   	ret
+
+0000000000802482 <devfile_write>:
+    if (!fd || !buf) {
+  802482:	48 85 ff             	test   %rdi,%rdi
+  802485:	0f 84 c1 00 00 00    	je     80254c <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80248b:	55                   	push   %rbp
+  80248c:	48 89 e5             	mov    %rsp,%rbp
+  80248f:	41 57                	push   %r15
+  802491:	41 56                	push   %r14
+  802493:	41 55                	push   %r13
+  802495:	41 54                	push   %r12
+  802497:	53                   	push   %rbx
+  802498:	48 83 ec 18          	sub    $0x18,%rsp
+  80249c:	49 89 ff             	mov    %rdi,%r15
+  80249f:	49 89 f5             	mov    %rsi,%r13
+  8024a2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8024a5:	48 85 f6             	test   %rsi,%rsi
+  8024a8:	0f 84 95 00 00 00    	je     802543 <devfile_write+0xc1>
+    while (n) {
+  8024ae:	48 85 d2             	test   %rdx,%rdx
+  8024b1:	0f 84 83 00 00 00    	je     80253a <devfile_write+0xb8>
+    int totalWrite = 0;
+  8024b7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024be:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  8024c5:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024c8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8024cd:	49 39 dc             	cmp    %rbx,%r12
+  8024d0:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8024d4:	48 89 da             	mov    %rbx,%rdx
+  8024d7:	4c 89 ee             	mov    %r13,%rsi
+  8024da:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  8024e1:	00 00 00 
+  8024e4:	48 b8 0c 0f 80 00 00 	movabs $0x800f0c,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024f0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024f4:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8024f7:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8024fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802500:	bf 04 00 00 00       	mov    $0x4,%edi
+  802505:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  80250c:	00 00 00 
+  80250f:	ff d0                	call   *%rax
+        if (write < 0) {
+  802511:	85 c0                	test   %eax,%eax
+  802513:	78 21                	js     802536 <devfile_write+0xb4>
+        buf += write;
+  802515:	48 63 d0             	movslq %eax,%rdx
+  802518:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80251b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80251e:	49 29 d4             	sub    %rdx,%r12
+  802521:	75 a5                	jne    8024c8 <devfile_write+0x46>
+    return totalWrite;
+  802523:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802527:	48 83 c4 18          	add    $0x18,%rsp
+  80252b:	5b                   	pop    %rbx
+  80252c:	41 5c                	pop    %r12
+  80252e:	41 5d                	pop    %r13
+  802530:	41 5e                	pop    %r14
+  802532:	41 5f                	pop    %r15
+  802534:	5d                   	pop    %rbp
+  802535:	c3                   	ret
+            return write;
+  802536:	48 98                	cltq
+  802538:	eb ed                	jmp    802527 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80253a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802541:	eb e0                	jmp    802523 <devfile_write+0xa1>
+        return -E_INVAL;
+  802543:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80254a:	eb db                	jmp    802527 <devfile_write+0xa5>
+  80254c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802553:	c3                   	ret
+
+0000000000802554 <devfile_read>:
+    if (!fd || !buf) {
+  802554:	48 85 ff             	test   %rdi,%rdi
+  802557:	0f 84 c0 00 00 00    	je     80261d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80255d:	55                   	push   %rbp
+  80255e:	48 89 e5             	mov    %rsp,%rbp
+  802561:	41 57                	push   %r15
+  802563:	41 56                	push   %r14
+  802565:	41 55                	push   %r13
+  802567:	41 54                	push   %r12
+  802569:	53                   	push   %rbx
+  80256a:	48 83 ec 18          	sub    $0x18,%rsp
+  80256e:	49 89 ff             	mov    %rdi,%r15
+  802571:	49 89 f5             	mov    %rsi,%r13
+  802574:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802577:	48 85 f6             	test   %rsi,%rsi
+  80257a:	0f 84 96 00 00 00    	je     802616 <devfile_read+0xc2>
+    while (n) {
+  802580:	48 85 d2             	test   %rdx,%rdx
+  802583:	0f 84 87 00 00 00    	je     802610 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802589:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802590:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802591:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802598:	00 00 00 
+  80259b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80259f:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8025a2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025a7:	49 39 c4             	cmp    %rax,%r12
+  8025aa:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8025ae:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8025b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025bc:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  8025c3:	00 00 00 
+  8025c6:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8025c8:	85 c0                	test   %eax,%eax
+  8025ca:	7e 37                	jle    802603 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8025cc:	48 63 d8             	movslq %eax,%rbx
+  8025cf:	48 89 da             	mov    %rbx,%rdx
+  8025d2:	4c 89 f6             	mov    %r14,%rsi
+  8025d5:	4c 89 ef             	mov    %r13,%rdi
+  8025d8:	48 b8 0c 0f 80 00 00 	movabs $0x800f0c,%rax
+  8025df:	00 00 00 
+  8025e2:	ff d0                	call   *%rax
+        buf += read;
+  8025e4:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8025e7:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8025eb:	49 29 dc             	sub    %rbx,%r12
+  8025ee:	75 ab                	jne    80259b <devfile_read+0x47>
+  return totalRead;
+  8025f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8025f4:	48 83 c4 18          	add    $0x18,%rsp
+  8025f8:	5b                   	pop    %rbx
+  8025f9:	41 5c                	pop    %r12
+  8025fb:	41 5d                	pop    %r13
+  8025fd:	41 5e                	pop    %r14
+  8025ff:	41 5f                	pop    %r15
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+            return read ? read : totalRead;
+  802603:	48 63 d0             	movslq %eax,%rdx
+  802606:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80260a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80260e:	eb e4                	jmp    8025f4 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802610:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802614:	eb da                	jmp    8025f0 <devfile_read+0x9c>
+        return E_INVAL;
+  802616:	b8 03 00 00 00       	mov    $0x3,%eax
+  80261b:	eb d7                	jmp    8025f4 <devfile_read+0xa0>
+  80261d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802622:	c3                   	ret
+
+0000000000802623 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802623:	48 85 ff             	test   %rdi,%rdi
+  802626:	74 5f                	je     802687 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802628:	55                   	push   %rbp
+  802629:	48 89 e5             	mov    %rsp,%rbp
+  80262c:	53                   	push   %rbx
+  80262d:	48 83 ec 08          	sub    $0x8,%rsp
+  802631:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802634:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  80263b:	00 00 00 
+  80263e:	ff d0                	call   *%rax
+  802640:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802646:	77 45                	ja     80268d <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802648:	48 89 de             	mov    %rbx,%rsi
+  80264b:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802652:	00 00 00 
+  802655:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802661:	be 00 00 00 00       	mov    $0x0,%esi
+  802666:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80266b:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802672:	00 00 00 
+  802675:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802677:	85 c0                	test   %eax,%eax
+  802679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802681:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802685:	c9                   	leave
+  802686:	c3                   	ret
+        return -E_INVAL;
+  802687:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80268c:	c3                   	ret
+        return -E_INVAL;
+  80268d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802692:	eb ed                	jmp    802681 <devfile_receive_snapshot+0x5e>
+
+0000000000802694 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802694:	55                   	push   %rbp
+  802695:	48 89 e5             	mov    %rsp,%rbp
+  802698:	41 55                	push   %r13
+  80269a:	41 54                	push   %r12
+  80269c:	53                   	push   %rbx
+  80269d:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a1:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8026a4:	48 85 f6             	test   %rsi,%rsi
+  8026a7:	0f 94 c0             	sete   %al
+  8026aa:	48 85 d2             	test   %rdx,%rdx
+  8026ad:	0f 94 c2             	sete   %dl
+  8026b0:	08 d0                	or     %dl,%al
+  8026b2:	0f 85 ad 00 00 00    	jne    802765 <devfile_send_snapshot+0xd1>
+  8026b8:	48 89 fb             	mov    %rdi,%rbx
+  8026bb:	49 89 f4             	mov    %rsi,%r12
+  8026be:	48 85 ff             	test   %rdi,%rdi
+  8026c1:	0f 84 9e 00 00 00    	je     802765 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8026c7:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026d9:	0f 87 8d 00 00 00    	ja     80276c <devfile_send_snapshot+0xd8>
+  8026df:	4c 89 e7             	mov    %r12,%rdi
+  8026e2:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8026e9:	00 00 00 
+  8026ec:	ff d0                	call   *%rax
+  8026ee:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026f4:	77 7d                	ja     802773 <devfile_send_snapshot+0xdf>
+  8026f6:	4c 89 ef             	mov    %r13,%rdi
+  8026f9:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  802700:	00 00 00 
+  802703:	ff d0                	call   *%rax
+  802705:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80270b:	77 6d                	ja     80277a <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80270d:	48 89 de             	mov    %rbx,%rsi
+  802710:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802717:	00 00 00 
+  80271a:	48 bb 12 0d 80 00 00 	movabs $0x800d12,%rbx
+  802721:	00 00 00 
+  802724:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802726:	4c 89 e6             	mov    %r12,%rsi
+  802729:	48 bf 00 91 80 00 00 	movabs $0x809100,%rdi
+  802730:	00 00 00 
+  802733:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802735:	4c 89 ee             	mov    %r13,%rsi
+  802738:	48 bf 00 92 80 00 00 	movabs $0x809200,%rdi
+  80273f:	00 00 00 
+  802742:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802744:	be 00 00 00 00       	mov    $0x0,%esi
+  802749:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80274e:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802755:	00 00 00 
+  802758:	ff d0                	call   *%rax
+}
+  80275a:	48 83 c4 08          	add    $0x8,%rsp
+  80275e:	5b                   	pop    %rbx
+  80275f:	41 5c                	pop    %r12
+  802761:	41 5d                	pop    %r13
+  802763:	5d                   	pop    %rbp
+  802764:	c3                   	ret
+        return -E_INVAL;
+  802765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80276a:	eb ee                	jmp    80275a <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80276c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802771:	eb e7                	jmp    80275a <devfile_send_snapshot+0xc6>
+  802773:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802778:	eb e0                	jmp    80275a <devfile_send_snapshot+0xc6>
+  80277a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80277f:	eb d9                	jmp    80275a <devfile_send_snapshot+0xc6>
+
+0000000000802781 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802781:	48 85 ff             	test   %rdi,%rdi
+  802784:	0f 84 41 01 00 00    	je     8028cb <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80278a:	55                   	push   %rbp
+  80278b:	48 89 e5             	mov    %rsp,%rbp
+  80278e:	41 57                	push   %r15
+  802790:	41 56                	push   %r14
+  802792:	41 55                	push   %r13
+  802794:	41 54                	push   %r12
+  802796:	53                   	push   %rbx
+  802797:	48 83 ec 08          	sub    $0x8,%rsp
+  80279b:	49 89 fc             	mov    %rdi,%r12
+  80279e:	49 89 f5             	mov    %rsi,%r13
+  8027a1:	48 89 d3             	mov    %rdx,%rbx
+  8027a4:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8027a7:	48 85 f6             	test   %rsi,%rsi
+  8027aa:	0f 84 ff 00 00 00    	je     8028af <devfile_diff_snapshots+0x12e>
+  8027b0:	48 85 d2             	test   %rdx,%rdx
+  8027b3:	0f 84 fd 00 00 00    	je     8028b6 <devfile_diff_snapshots+0x135>
+  8027b9:	48 85 c9             	test   %rcx,%rcx
+  8027bc:	0f 84 f4 00 00 00    	je     8028b6 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8027c2:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8027c9:	00 00 00 
+  8027cc:	ff d0                	call   *%rax
+  8027ce:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027d4:	0f 87 e3 00 00 00    	ja     8028bd <devfile_diff_snapshots+0x13c>
+  8027da:	4c 89 ef             	mov    %r13,%rdi
+  8027dd:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027ef:	0f 87 cf 00 00 00    	ja     8028c4 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8027f5:	4c 89 e6             	mov    %r12,%rsi
+  8027f8:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  8027ff:	00 00 00 
+  802802:	4c 89 e7             	mov    %r12,%rdi
+  802805:	49 bf 12 0d 80 00 00 	movabs $0x800d12,%r15
+  80280c:	00 00 00 
+  80280f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802812:	4c 89 ee             	mov    %r13,%rsi
+  802815:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80281c:	00 
+  80281d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802820:	48 8b 03             	mov    (%rbx),%rax
+  802823:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80282a:	00 
+  80282b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80282f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802836:	00 
+  802837:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80283b:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802842:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802843:	be 00 00 00 00       	mov    $0x0,%esi
+  802848:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80284d:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	78 43                	js     8028a0 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80285d:	49 8b 04 24          	mov    (%r12),%rax
+  802861:	48 89 03             	mov    %rax,(%rbx)
+  802864:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802869:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80286d:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802872:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802876:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80287b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80287f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802883:	48 c1 e2 03          	shl    $0x3,%rdx
+  802887:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80288c:	4c 89 f7             	mov    %r14,%rdi
+  80288f:	48 b8 0c 0f 80 00 00 	movabs $0x800f0c,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80289b:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8028a0:	48 83 c4 08          	add    $0x8,%rsp
+  8028a4:	5b                   	pop    %rbx
+  8028a5:	41 5c                	pop    %r12
+  8028a7:	41 5d                	pop    %r13
+  8028a9:	41 5e                	pop    %r14
+  8028ab:	41 5f                	pop    %r15
+  8028ad:	5d                   	pop    %rbp
+  8028ae:	c3                   	ret
+        return -E_INVAL;
+  8028af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b4:	eb ea                	jmp    8028a0 <devfile_diff_snapshots+0x11f>
+  8028b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028bb:	eb e3                	jmp    8028a0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8028bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c2:	eb dc                	jmp    8028a0 <devfile_diff_snapshots+0x11f>
+  8028c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c9:	eb d5                	jmp    8028a0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8028cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028d0:	c3                   	ret
+
+00000000008028d1 <devfile_delete_snapshot>:
+    if (!name) {
+  8028d1:	48 85 ff             	test   %rdi,%rdi
+  8028d4:	74 5f                	je     802935 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8028d6:	55                   	push   %rbp
+  8028d7:	48 89 e5             	mov    %rsp,%rbp
+  8028da:	53                   	push   %rbx
+  8028db:	48 83 ec 08          	sub    $0x8,%rsp
+  8028df:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8028e2:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028f4:	77 45                	ja     80293b <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8028f6:	48 89 de             	mov    %rbx,%rsi
+  8028f9:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802900:	00 00 00 
+  802903:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80290f:	be 00 00 00 00       	mov    $0x0,%esi
+  802914:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802919:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802925:	85 c0                	test   %eax,%eax
+  802927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80292f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802933:	c9                   	leave
+  802934:	c3                   	ret
+        return -E_INVAL;
+  802935:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80293a:	c3                   	ret
+        return -E_INVAL;
+  80293b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802940:	eb ed                	jmp    80292f <devfile_delete_snapshot+0x5e>
+
+0000000000802942 <devfile_accept_snapshot>:
+    if (!name) {
+  802942:	48 85 ff             	test   %rdi,%rdi
+  802945:	74 5f                	je     8029a6 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802947:	55                   	push   %rbp
+  802948:	48 89 e5             	mov    %rsp,%rbp
+  80294b:	53                   	push   %rbx
+  80294c:	48 83 ec 08          	sub    $0x8,%rsp
+  802950:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802953:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+  80295f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802965:	77 45                	ja     8029ac <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802967:	48 89 de             	mov    %rbx,%rsi
+  80296a:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802971:	00 00 00 
+  802974:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  80297b:	00 00 00 
+  80297e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802980:	be 00 00 00 00       	mov    $0x0,%esi
+  802985:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80298a:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802996:	85 c0                	test   %eax,%eax
+  802998:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+        return -E_INVAL;
+  8029a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029ab:	c3                   	ret
+        return -E_INVAL;
+  8029ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b1:	eb ed                	jmp    8029a0 <devfile_accept_snapshot+0x5e>
+
+00000000008029b3 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8029b3:	48 85 ff             	test   %rdi,%rdi
+  8029b6:	0f 84 9f 00 00 00    	je     802a5b <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8029bc:	55                   	push   %rbp
+  8029bd:	48 89 e5             	mov    %rsp,%rbp
+  8029c0:	41 54                	push   %r12
+  8029c2:	53                   	push   %rbx
+  8029c3:	48 89 fb             	mov    %rdi,%rbx
+  8029c6:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8029c9:	48 85 f6             	test   %rsi,%rsi
+  8029cc:	74 78                	je     802a46 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8029ce:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8029d5:	00 00 00 
+  8029d8:	ff d0                	call   *%rax
+  8029da:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029e0:	77 6b                	ja     802a4d <devfile_create_snapshot+0x9a>
+  8029e2:	4c 89 e7             	mov    %r12,%rdi
+  8029e5:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  8029ec:	00 00 00 
+  8029ef:	ff d0                	call   *%rax
+  8029f1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029f7:	77 5b                	ja     802a54 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8029f9:	48 89 de             	mov    %rbx,%rsi
+  8029fc:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802a03:	00 00 00 
+  802a06:	48 bb 12 0d 80 00 00 	movabs $0x800d12,%rbx
+  802a0d:	00 00 00 
+  802a10:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802a12:	4c 89 e6             	mov    %r12,%rsi
+  802a15:	48 bf 00 91 80 00 00 	movabs $0x809100,%rdi
+  802a1c:	00 00 00 
+  802a1f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802a21:	be 00 00 00 00       	mov    $0x0,%esi
+  802a26:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a2b:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802a32:	00 00 00 
+  802a35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a41:	5b                   	pop    %rbx
+  802a42:	41 5c                	pop    %r12
+  802a44:	5d                   	pop    %rbp
+  802a45:	c3                   	ret
+        return -E_INVAL;
+  802a46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a4b:	eb f4                	jmp    802a41 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a52:	eb ed                	jmp    802a41 <devfile_create_snapshot+0x8e>
+  802a54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a59:	eb e6                	jmp    802a41 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a60:	c3                   	ret
+
+0000000000802a61 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a61:	55                   	push   %rbp
+  802a62:	48 89 e5             	mov    %rsp,%rbp
+  802a65:	41 54                	push   %r12
+  802a67:	53                   	push   %rbx
+  802a68:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a6b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a6e:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802a75:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a77:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a81:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802a88:	00 00 00 
+  802a8b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	78 3d                	js     802ace <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a91:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802a98:	00 00 00 
+  802a9b:	4c 89 e6             	mov    %r12,%rsi
+  802a9e:	48 89 df             	mov    %rbx,%rdi
+  802aa1:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802aad:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ab4:	00 
+  802ab5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802abb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ac2:	00 
+  802ac3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ace:	5b                   	pop    %rbx
+  802acf:	41 5c                	pop    %r12
+  802ad1:	5d                   	pop    %rbp
+  802ad2:	c3                   	ret
+
+0000000000802ad3 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802ad3:	55                   	push   %rbp
+  802ad4:	48 89 e5             	mov    %rsp,%rbp
+  802ad7:	41 57                	push   %r15
+  802ad9:	41 56                	push   %r14
+  802adb:	41 55                	push   %r13
+  802add:	41 54                	push   %r12
+  802adf:	53                   	push   %rbx
+  802ae0:	48 83 ec 38          	sub    $0x38,%rsp
+  802ae4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802ae8:	49 89 f5             	mov    %rsi,%r13
+  802aeb:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802aee:	48 89 f0             	mov    %rsi,%rax
+  802af1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802af6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802afa:	75 4f                	jne    802b4b <devfile_readmap+0x78>
+  802afc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b00:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b06:	75 1f                	jne    802b27 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802b08:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b0c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b10:	49 be 5f 34 80 00 00 	movabs $0x80345f,%r14
+  802b17:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b1a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802b21:	0f 87 9d 00 00 00    	ja     802bc4 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802b27:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b2b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802b2f:	4d 85 ff             	test   %r15,%r15
+  802b32:	0f 85 cf 00 00 00    	jne    802c07 <devfile_readmap+0x134>
+  802b38:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802b3c:	48 83 c4 38          	add    $0x38,%rsp
+  802b40:	5b                   	pop    %rbx
+  802b41:	41 5c                	pop    %r12
+  802b43:	41 5d                	pop    %r13
+  802b45:	41 5e                	pop    %r14
+  802b47:	41 5f                	pop    %r15
+  802b49:	5d                   	pop    %rbp
+  802b4a:	c3                   	ret
+    size_t totalRead = 0;
+  802b4b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802b52:	00 
+  802b53:	eb da                	jmp    802b2f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b55:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b59:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b5c:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  802b63:	00 00 00 
+  802b66:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802b68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b6c:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802b70:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b74:	4c 89 ee             	mov    %r13,%rsi
+  802b77:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b7c:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	7e a3                	jle    802b2f <devfile_readmap+0x5c>
+  802b8c:	48 98                	cltq
+  802b8e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b92:	72 9b                	jb     802b2f <devfile_readmap+0x5c>
+        buf += read;
+  802b94:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802b97:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802b9a:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b9e:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802ba5:	75 88                	jne    802b2f <devfile_readmap+0x5c>
+  802ba7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bab:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802bb1:	0f 85 78 ff ff ff    	jne    802b2f <devfile_readmap+0x5c>
+  802bb7:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802bbe:	0f 86 6b ff ff ff    	jbe    802b2f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802bc4:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802bca:	4d 39 e7             	cmp    %r12,%r15
+  802bcd:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802bd1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802bd8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bdc:	0f 84 73 ff ff ff    	je     802b55 <devfile_readmap+0x82>
+  802be2:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802be6:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802beb:	41 ff d6             	call   *%r14
+  802bee:	a8 40                	test   $0x40,%al
+  802bf0:	0f 85 39 ff ff ff    	jne    802b2f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bf6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bfd:	4c 39 e3             	cmp    %r12,%rbx
+  802c00:	72 e4                	jb     802be6 <devfile_readmap+0x113>
+  802c02:	e9 4e ff ff ff       	jmp    802b55 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802c07:	4c 89 fa             	mov    %r15,%rdx
+  802c0a:	4c 89 ee             	mov    %r13,%rsi
+  802c0d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c11:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802c1d:	48 85 c0             	test   %rax,%rax
+  802c20:	78 0c                	js     802c2e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802c22:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c26:	48 01 f0             	add    %rsi,%rax
+  802c29:	e9 0e ff ff ff       	jmp    802b3c <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802c2e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c32:	48 85 f6             	test   %rsi,%rsi
+  802c35:	48 0f 45 c6          	cmovne %rsi,%rax
+  802c39:	e9 fe fe ff ff       	jmp    802b3c <devfile_readmap+0x69>
+
+0000000000802c3e <open>:
+open(const char *path, int mode) {
+  802c3e:	55                   	push   %rbp
+  802c3f:	48 89 e5             	mov    %rsp,%rbp
+  802c42:	41 55                	push   %r13
+  802c44:	41 54                	push   %r12
+  802c46:	53                   	push   %rbx
+  802c47:	48 83 ec 18          	sub    $0x18,%rsp
+  802c4b:	49 89 fc             	mov    %rdi,%r12
+  802c4e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c51:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c63:	0f 87 8a 00 00 00    	ja     802cf3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c69:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c6d:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  802c74:	00 00 00 
+  802c77:	ff d0                	call   *%rax
+  802c79:	89 c3                	mov    %eax,%ebx
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	78 50                	js     802ccf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c7f:	4c 89 e6             	mov    %r12,%rsi
+  802c82:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  802c89:	00 00 00 
+  802c8c:	48 89 df             	mov    %rbx,%rdi
+  802c8f:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  802c96:	00 00 00 
+  802c99:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c9b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ca2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ca6:	bf 01 00 00 00       	mov    $0x1,%edi
+  802cab:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802cb2:	00 00 00 
+  802cb5:	ff d0                	call   *%rax
+  802cb7:	89 c3                	mov    %eax,%ebx
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 1f                	js     802cdc <open+0x9e>
+    return fd2num(fd);
+  802cbd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802cc1:	48 b8 6e 17 80 00 00 	movabs $0x80176e,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  802ccd:	89 c3                	mov    %eax,%ebx
+}
+  802ccf:	89 d8                	mov    %ebx,%eax
+  802cd1:	48 83 c4 18          	add    $0x18,%rsp
+  802cd5:	5b                   	pop    %rbx
+  802cd6:	41 5c                	pop    %r12
+  802cd8:	41 5d                	pop    %r13
+  802cda:	5d                   	pop    %rbp
+  802cdb:	c3                   	ret
+        fd_close(fd, 0);
+  802cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ce5:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+        return res;
+  802cf1:	eb dc                	jmp    802ccf <open+0x91>
+        return -E_BAD_PATH;
+  802cf3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802cf8:	eb d5                	jmp    802ccf <open+0x91>
+
+0000000000802cfa <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802cfa:	55                   	push   %rbp
+  802cfb:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802cfe:	be 00 00 00 00       	mov    $0x0,%esi
+  802d03:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d08:	48 b8 19 23 80 00 00 	movabs $0x802319,%rax
+  802d0f:	00 00 00 
+  802d12:	ff d0                	call   *%rax
+}
+  802d14:	5d                   	pop    %rbp
+  802d15:	c3                   	ret
+
+0000000000802d16 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802d16:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802d1a:	7f 01                	jg     802d1d <writebuf+0x7>
+  802d1c:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	53                   	push   %rbx
+  802d22:	48 83 ec 08          	sub    $0x8,%rsp
+  802d26:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802d29:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802d2d:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802d31:	8b 3f                	mov    (%rdi),%edi
+  802d33:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802d3f:	48 85 c0             	test   %rax,%rax
+  802d42:	7e 04                	jle    802d48 <writebuf+0x32>
+  802d44:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802d48:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802d4c:	48 39 c2             	cmp    %rax,%rdx
+  802d4f:	74 0f                	je     802d60 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802d51:	48 85 c0             	test   %rax,%rax
+  802d54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d59:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802d5d:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802d60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d64:	c9                   	leave
+  802d65:	c3                   	ret
+
+0000000000802d66 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802d66:	8b 46 04             	mov    0x4(%rsi),%eax
+  802d69:	8d 50 01             	lea    0x1(%rax),%edx
+  802d6c:	89 56 04             	mov    %edx,0x4(%rsi)
+  802d6f:	48 98                	cltq
+  802d71:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802d76:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802d7c:	74 01                	je     802d7f <putch+0x19>
+  802d7e:	c3                   	ret
+putch(int ch, void *arg) {
+  802d7f:	55                   	push   %rbp
+  802d80:	48 89 e5             	mov    %rsp,%rbp
+  802d83:	53                   	push   %rbx
+  802d84:	48 83 ec 08          	sub    $0x8,%rsp
+  802d88:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802d8b:	48 89 f7             	mov    %rsi,%rdi
+  802d8e:	48 b8 16 2d 80 00 00 	movabs $0x802d16,%rax
+  802d95:	00 00 00 
+  802d98:	ff d0                	call   *%rax
+        state->offset = 0;
+  802d9a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802da1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da5:	c9                   	leave
+  802da6:	c3                   	ret
+
+0000000000802da7 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802da7:	55                   	push   %rbp
+  802da8:	48 89 e5             	mov    %rsp,%rbp
+  802dab:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802db2:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802db5:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802dbb:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802dc2:	00 00 00 
+    state.result = 0;
+  802dc5:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802dcc:	00 00 00 00 
+    state.error = 1;
+  802dd0:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802dd7:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802dda:	48 89 f2             	mov    %rsi,%rdx
+  802ddd:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802de4:	48 bf 66 2d 80 00 00 	movabs $0x802d66,%rdi
+  802deb:	00 00 00 
+  802dee:	48 b8 3d 05 80 00 00 	movabs $0x80053d,%rax
+  802df5:	00 00 00 
+  802df8:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802dfa:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802e01:	7f 14                	jg     802e17 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802e03:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802e0a:	48 85 c0             	test   %rax,%rax
+  802e0d:	75 06                	jne    802e15 <vfprintf+0x6e>
+  802e0f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802e17:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802e1e:	48 b8 16 2d 80 00 00 	movabs $0x802d16,%rax
+  802e25:	00 00 00 
+  802e28:	ff d0                	call   *%rax
+  802e2a:	eb d7                	jmp    802e03 <vfprintf+0x5c>
+
+0000000000802e2c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802e2c:	55                   	push   %rbp
+  802e2d:	48 89 e5             	mov    %rsp,%rbp
+  802e30:	48 83 ec 50          	sub    $0x50,%rsp
+  802e34:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802e38:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e3c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e40:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802e44:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802e4b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e53:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e57:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802e5b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802e5f:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802e6b:	c9                   	leave
+  802e6c:	c3                   	ret
+
+0000000000802e6d <printf>:
+
+int
+printf(const char *fmt, ...) {
+  802e6d:	55                   	push   %rbp
+  802e6e:	48 89 e5             	mov    %rsp,%rbp
+  802e71:	48 83 ec 50          	sub    $0x50,%rsp
+  802e75:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802e79:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802e7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802e89:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802e90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802ea0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802ea4:	48 89 fe             	mov    %rdi,%rsi
+  802ea7:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eac:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+0000000000802eba <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	41 54                	push   %r12
+  802ec0:	53                   	push   %rbx
+  802ec1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ec4:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+  802ed0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ed3:	48 be 80 40 80 00 00 	movabs $0x804080,%rsi
+  802eda:	00 00 00 
+  802edd:	48 89 df             	mov    %rbx,%rdi
+  802ee0:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  802ee7:	00 00 00 
+  802eea:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802eec:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802ef1:	41 2b 04 24          	sub    (%r12),%eax
+  802ef5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802efb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f02:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f05:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f0c:	00 00 00 
+  802f0f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1b:	5b                   	pop    %rbx
+  802f1c:	41 5c                	pop    %r12
+  802f1e:	5d                   	pop    %rbp
+  802f1f:	c3                   	ret
+
+0000000000802f20 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	41 54                	push   %r12
+  802f26:	53                   	push   %rbx
+  802f27:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f2f:	48 89 fe             	mov    %rdi,%rsi
+  802f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f37:	49 bc 6a 14 80 00 00 	movabs $0x80146a,%r12
+  802f3e:	00 00 00 
+  802f41:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802f44:	48 89 df             	mov    %rbx,%rdi
+  802f47:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	48 89 c6             	mov    %rax,%rsi
+  802f56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f60:	41 ff d4             	call   *%r12
+}
+  802f63:	5b                   	pop    %rbx
+  802f64:	41 5c                	pop    %r12
+  802f66:	5d                   	pop    %rbp
+  802f67:	c3                   	ret
+
+0000000000802f68 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802f68:	55                   	push   %rbp
+  802f69:	48 89 e5             	mov    %rsp,%rbp
+  802f6c:	41 57                	push   %r15
+  802f6e:	41 56                	push   %r14
+  802f70:	41 55                	push   %r13
+  802f72:	41 54                	push   %r12
+  802f74:	53                   	push   %rbx
+  802f75:	48 83 ec 18          	sub    $0x18,%rsp
+  802f79:	49 89 fc             	mov    %rdi,%r12
+  802f7c:	49 89 f5             	mov    %rsi,%r13
+  802f7f:	49 89 d7             	mov    %rdx,%r15
+  802f82:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f86:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802f92:	4d 85 ff             	test   %r15,%r15
+  802f95:	0f 84 af 00 00 00    	je     80304a <devpipe_write+0xe2>
+  802f9b:	48 89 c3             	mov    %rax,%rbx
+  802f9e:	4c 89 f8             	mov    %r15,%rax
+  802fa1:	4d 89 ef             	mov    %r13,%r15
+  802fa4:	4c 01 e8             	add    %r13,%rax
+  802fa7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fab:	49 bd 72 13 80 00 00 	movabs $0x801372,%r13
+  802fb2:	00 00 00 
+            sys_yield();
+  802fb5:	49 be 0f 13 80 00 00 	movabs $0x80130f,%r14
+  802fbc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fbf:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fc2:	48 63 ce             	movslq %esi,%rcx
+  802fc5:	48 63 03             	movslq (%rbx),%rax
+  802fc8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802fce:	48 39 c1             	cmp    %rax,%rcx
+  802fd1:	72 2e                	jb     803001 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fd3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fd8:	48 89 da             	mov    %rbx,%rdx
+  802fdb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fe0:	4c 89 e7             	mov    %r12,%rdi
+  802fe3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	74 66                	je     803050 <devpipe_write+0xe8>
+            sys_yield();
+  802fea:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fed:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ff0:	48 63 ce             	movslq %esi,%rcx
+  802ff3:	48 63 03             	movslq (%rbx),%rax
+  802ff6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ffc:	48 39 c1             	cmp    %rax,%rcx
+  802fff:	73 d2                	jae    802fd3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803001:	41 0f b6 3f          	movzbl (%r15),%edi
+  803005:	48 89 ca             	mov    %rcx,%rdx
+  803008:	48 c1 ea 03          	shr    $0x3,%rdx
+  80300c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803013:	08 10 20 
+  803016:	48 f7 e2             	mul    %rdx
+  803019:	48 c1 ea 06          	shr    $0x6,%rdx
+  80301d:	48 89 d0             	mov    %rdx,%rax
+  803020:	48 c1 e0 09          	shl    $0x9,%rax
+  803024:	48 29 d0             	sub    %rdx,%rax
+  803027:	48 c1 e0 03          	shl    $0x3,%rax
+  80302b:	48 29 c1             	sub    %rax,%rcx
+  80302e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803033:	83 c6 01             	add    $0x1,%esi
+  803036:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803039:	49 83 c7 01          	add    $0x1,%r15
+  80303d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803041:	49 39 c7             	cmp    %rax,%r15
+  803044:	0f 85 75 ff ff ff    	jne    802fbf <devpipe_write+0x57>
+    return n;
+  80304a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80304e:	eb 05                	jmp    803055 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803050:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803055:	48 83 c4 18          	add    $0x18,%rsp
+  803059:	5b                   	pop    %rbx
+  80305a:	41 5c                	pop    %r12
+  80305c:	41 5d                	pop    %r13
+  80305e:	41 5e                	pop    %r14
+  803060:	41 5f                	pop    %r15
+  803062:	5d                   	pop    %rbp
+  803063:	c3                   	ret
+
+0000000000803064 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803064:	55                   	push   %rbp
+  803065:	48 89 e5             	mov    %rsp,%rbp
+  803068:	41 57                	push   %r15
+  80306a:	41 56                	push   %r14
+  80306c:	41 55                	push   %r13
+  80306e:	41 54                	push   %r12
+  803070:	53                   	push   %rbx
+  803071:	48 83 ec 18          	sub    $0x18,%rsp
+  803075:	49 89 fc             	mov    %rdi,%r12
+  803078:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80307c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803080:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  803087:	00 00 00 
+  80308a:	ff d0                	call   *%rax
+  80308c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80308f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803095:	49 bd 72 13 80 00 00 	movabs $0x801372,%r13
+  80309c:	00 00 00 
+            sys_yield();
+  80309f:	49 be 0f 13 80 00 00 	movabs $0x80130f,%r14
+  8030a6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8030a9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030ae:	74 7d                	je     80312d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030b0:	8b 03                	mov    (%rbx),%eax
+  8030b2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030b5:	75 26                	jne    8030dd <devpipe_read+0x79>
+            if (i > 0) return i;
+  8030b7:	4d 85 ff             	test   %r15,%r15
+  8030ba:	75 77                	jne    803133 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030c1:	48 89 da             	mov    %rbx,%rdx
+  8030c4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030c9:	4c 89 e7             	mov    %r12,%rdi
+  8030cc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	74 72                	je     803145 <devpipe_read+0xe1>
+            sys_yield();
+  8030d3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030d6:	8b 03                	mov    (%rbx),%eax
+  8030d8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030db:	74 df                	je     8030bc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030dd:	48 63 c8             	movslq %eax,%rcx
+  8030e0:	48 89 ca             	mov    %rcx,%rdx
+  8030e3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8030e7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8030ee:	08 10 20 
+  8030f1:	48 89 d0             	mov    %rdx,%rax
+  8030f4:	48 f7 e6             	mul    %rsi
+  8030f7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030fb:	48 89 d0             	mov    %rdx,%rax
+  8030fe:	48 c1 e0 09          	shl    $0x9,%rax
+  803102:	48 29 d0             	sub    %rdx,%rax
+  803105:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80310c:	00 
+  80310d:	48 89 c8             	mov    %rcx,%rax
+  803110:	48 29 d0             	sub    %rdx,%rax
+  803113:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803118:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80311c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803120:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803123:	49 83 c7 01          	add    $0x1,%r15
+  803127:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80312b:	75 83                	jne    8030b0 <devpipe_read+0x4c>
+    return n;
+  80312d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803131:	eb 03                	jmp    803136 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803133:	4c 89 f8             	mov    %r15,%rax
+}
+  803136:	48 83 c4 18          	add    $0x18,%rsp
+  80313a:	5b                   	pop    %rbx
+  80313b:	41 5c                	pop    %r12
+  80313d:	41 5d                	pop    %r13
+  80313f:	41 5e                	pop    %r14
+  803141:	41 5f                	pop    %r15
+  803143:	5d                   	pop    %rbp
+  803144:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314a:	eb ea                	jmp    803136 <devpipe_read+0xd2>
+
+000000000080314c <pipe>:
+pipe(int pfd[2]) {
+  80314c:	55                   	push   %rbp
+  80314d:	48 89 e5             	mov    %rsp,%rbp
+  803150:	41 55                	push   %r13
+  803152:	41 54                	push   %r12
+  803154:	53                   	push   %rbx
+  803155:	48 83 ec 18          	sub    $0x18,%rsp
+  803159:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80315c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803160:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  803167:	00 00 00 
+  80316a:	ff d0                	call   *%rax
+  80316c:	89 c3                	mov    %eax,%ebx
+  80316e:	85 c0                	test   %eax,%eax
+  803170:	0f 88 a0 01 00 00    	js     803316 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803176:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80317b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803180:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803184:	bf 00 00 00 00       	mov    $0x0,%edi
+  803189:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  803195:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803197:	85 c0                	test   %eax,%eax
+  803199:	0f 88 77 01 00 00    	js     803316 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80319f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8031a3:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  8031aa:	00 00 00 
+  8031ad:	ff d0                	call   *%rax
+  8031af:	89 c3                	mov    %eax,%ebx
+  8031b1:	85 c0                	test   %eax,%eax
+  8031b3:	0f 88 43 01 00 00    	js     8032fc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8031b9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8031c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cc:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8031d3:	00 00 00 
+  8031d6:	ff d0                	call   *%rax
+  8031d8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 1a 01 00 00    	js     8032fc <pipe+0x1b0>
+    va = fd2data(fd0);
+  8031e2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031e6:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+  8031f2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8031f5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ff:	48 89 c6             	mov    %rax,%rsi
+  803202:	bf 00 00 00 00       	mov    $0x0,%edi
+  803207:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  80320e:	00 00 00 
+  803211:	ff d0                	call   *%rax
+  803213:	89 c3                	mov    %eax,%ebx
+  803215:	85 c0                	test   %eax,%eax
+  803217:	0f 88 c5 00 00 00    	js     8032e2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80321d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803221:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  803228:	00 00 00 
+  80322b:	ff d0                	call   *%rax
+  80322d:	48 89 c1             	mov    %rax,%rcx
+  803230:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803236:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80323c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803241:	4c 89 ee             	mov    %r13,%rsi
+  803244:	bf 00 00 00 00       	mov    $0x0,%edi
+  803249:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+  803255:	89 c3                	mov    %eax,%ebx
+  803257:	85 c0                	test   %eax,%eax
+  803259:	78 6e                	js     8032c9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80325b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803260:	4c 89 ef             	mov    %r13,%rdi
+  803263:	48 b8 40 13 80 00 00 	movabs $0x801340,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+  80326f:	83 f8 02             	cmp    $0x2,%eax
+  803272:	0f 85 ab 00 00 00    	jne    803323 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803278:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  80327f:	00 00 
+  803281:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803285:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803287:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80328b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803292:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803296:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803298:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80329c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8032a3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032a7:	48 bb 6e 17 80 00 00 	movabs $0x80176e,%rbx
+  8032ae:	00 00 00 
+  8032b1:	ff d3                	call   *%rbx
+  8032b3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8032b7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032bb:	ff d3                	call   *%rbx
+  8032bd:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8032c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c7:	eb 4d                	jmp    803316 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8032c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ce:	4c 89 ee             	mov    %r13,%rsi
+  8032d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d6:	48 b8 6a 14 80 00 00 	movabs $0x80146a,%rax
+  8032dd:	00 00 00 
+  8032e0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8032e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032e7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8032eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f0:	48 b8 6a 14 80 00 00 	movabs $0x80146a,%rax
+  8032f7:	00 00 00 
+  8032fa:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8032fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803301:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803305:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330a:	48 b8 6a 14 80 00 00 	movabs $0x80146a,%rax
+  803311:	00 00 00 
+  803314:	ff d0                	call   *%rax
+}
+  803316:	89 d8                	mov    %ebx,%eax
+  803318:	48 83 c4 18          	add    $0x18,%rsp
+  80331c:	5b                   	pop    %rbx
+  80331d:	41 5c                	pop    %r12
+  80331f:	41 5d                	pop    %r13
+  803321:	5d                   	pop    %rbp
+  803322:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803323:	48 b9 b0 40 80 00 00 	movabs $0x8040b0,%rcx
+  80332a:	00 00 00 
+  80332d:	48 ba 87 40 80 00 00 	movabs $0x804087,%rdx
+  803334:	00 00 00 
+  803337:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80333c:	48 bf 9c 40 80 00 00 	movabs $0x80409c,%rdi
+  803343:	00 00 00 
+  803346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334b:	49 b8 9d 02 80 00 00 	movabs $0x80029d,%r8
+  803352:	00 00 00 
+  803355:	41 ff d0             	call   *%r8
+
+0000000000803358 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803358:	55                   	push   %rbp
+  803359:	48 89 e5             	mov    %rsp,%rbp
+  80335c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803360:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803364:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803370:	85 c0                	test   %eax,%eax
+  803372:	78 35                	js     8033a9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803374:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803378:	48 b8 80 17 80 00 00 	movabs $0x801780,%rax
+  80337f:	00 00 00 
+  803382:	ff d0                	call   *%rax
+  803384:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803387:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80338c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803391:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803395:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	0f 94 c0             	sete   %al
+  8033a6:	0f b6 c0             	movzbl %al,%eax
+}
+  8033a9:	c9                   	leave
+  8033aa:	c3                   	ret
+
+00000000008033ab <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033ab:	48 89 f8             	mov    %rdi,%rax
+  8033ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8033b2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8033b9:	01 00 00 
+  8033bc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033c0:	f6 c2 01             	test   $0x1,%dl
+  8033c3:	74 6d                	je     803432 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033c5:	48 89 f8             	mov    %rdi,%rax
+  8033c8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033cc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8033d3:	01 00 00 
+  8033d6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033da:	f6 c2 01             	test   $0x1,%dl
+  8033dd:	74 62                	je     803441 <get_uvpt_entry+0x96>
+  8033df:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8033e6:	01 00 00 
+  8033e9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033ed:	f6 c2 80             	test   $0x80,%dl
+  8033f0:	75 4f                	jne    803441 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033f2:	48 89 f8             	mov    %rdi,%rax
+  8033f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8033f9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803400:	01 00 00 
+  803403:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803407:	f6 c2 01             	test   $0x1,%dl
+  80340a:	74 44                	je     803450 <get_uvpt_entry+0xa5>
+  80340c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803413:	01 00 00 
+  803416:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80341a:	f6 c2 80             	test   $0x80,%dl
+  80341d:	75 31                	jne    803450 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80341f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803423:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80342a:	01 00 00 
+  80342d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803431:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803432:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803439:	01 00 00 
+  80343c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803440:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803441:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803448:	01 00 00 
+  80344b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80344f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803450:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803457:	01 00 00 
+  80345a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80345e:	c3                   	ret
+
+000000000080345f <get_prot>:
+
+int
+get_prot(void *va) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803463:	48 b8 ab 33 80 00 00 	movabs $0x8033ab,%rax
+  80346a:	00 00 00 
+  80346d:	ff d0                	call   *%rax
+  80346f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803472:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803477:	89 c1                	mov    %eax,%ecx
+  803479:	83 c9 04             	or     $0x4,%ecx
+  80347c:	f6 c2 01             	test   $0x1,%dl
+  80347f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803482:	89 c1                	mov    %eax,%ecx
+  803484:	83 c9 02             	or     $0x2,%ecx
+  803487:	f6 c2 02             	test   $0x2,%dl
+  80348a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80348d:	89 c1                	mov    %eax,%ecx
+  80348f:	83 c9 01             	or     $0x1,%ecx
+  803492:	48 85 d2             	test   %rdx,%rdx
+  803495:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803498:	89 c1                	mov    %eax,%ecx
+  80349a:	83 c9 40             	or     $0x40,%ecx
+  80349d:	f6 c6 04             	test   $0x4,%dh
+  8034a0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8034a3:	5d                   	pop    %rbp
+  8034a4:	c3                   	ret
+
+00000000008034a5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8034a5:	55                   	push   %rbp
+  8034a6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034a9:	48 b8 ab 33 80 00 00 	movabs $0x8033ab,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8034b5:	48 c1 e8 06          	shr    $0x6,%rax
+  8034b9:	83 e0 01             	and    $0x1,%eax
+}
+  8034bc:	5d                   	pop    %rbp
+  8034bd:	c3                   	ret
+
+00000000008034be <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8034be:	55                   	push   %rbp
+  8034bf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034c2:	48 b8 ab 33 80 00 00 	movabs $0x8033ab,%rax
+  8034c9:	00 00 00 
+  8034cc:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8034ce:	48 c1 e8 05          	shr    $0x5,%rax
+  8034d2:	83 e0 01             	and    $0x1,%eax
+}
+  8034d5:	5d                   	pop    %rbp
+  8034d6:	c3                   	ret
+
+00000000008034d7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8034d7:	55                   	push   %rbp
+  8034d8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8034db:	48 b8 ab 33 80 00 00 	movabs $0x8033ab,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	83 e0 01             	and    $0x1,%eax
+}
+  8034ea:	5d                   	pop    %rbp
+  8034eb:	c3                   	ret
+
+00000000008034ec <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8034ec:	55                   	push   %rbp
+  8034ed:	48 89 e5             	mov    %rsp,%rbp
+  8034f0:	41 57                	push   %r15
+  8034f2:	41 56                	push   %r14
+  8034f4:	41 55                	push   %r13
+  8034f6:	41 54                	push   %r12
+  8034f8:	53                   	push   %rbx
+  8034f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8034fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803501:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803505:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80350a:	49 bd d7 34 80 00 00 	movabs $0x8034d7,%r13
+  803511:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803514:	49 bf 5f 34 80 00 00 	movabs $0x80345f,%r15
+  80351b:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80351e:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803525:	00 00 00 
+  803528:	eb 0c                	jmp    803536 <foreach_shared_region+0x4a>
+  80352a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803531:	4c 39 f3             	cmp    %r14,%rbx
+  803534:	74 2e                	je     803564 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803536:	48 89 df             	mov    %rbx,%rdi
+  803539:	41 ff d5             	call   *%r13
+  80353c:	84 c0                	test   %al,%al
+  80353e:	74 ea                	je     80352a <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803540:	48 89 df             	mov    %rbx,%rdi
+  803543:	41 ff d7             	call   *%r15
+  803546:	a8 40                	test   $0x40,%al
+  803548:	74 e0                	je     80352a <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80354a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803551:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803555:	48 89 df             	mov    %rbx,%rdi
+  803558:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80355c:	ff d0                	call   *%rax
+				if (res < 0) {
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	79 c8                	jns    80352a <foreach_shared_region+0x3e>
+  803562:	eb 05                	jmp    803569 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803564:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803569:	48 83 c4 18          	add    $0x18,%rsp
+  80356d:	5b                   	pop    %rbx
+  80356e:	41 5c                	pop    %r12
+  803570:	41 5d                	pop    %r13
+  803572:	41 5e                	pop    %r14
+  803574:	41 5f                	pop    %r15
+  803576:	5d                   	pop    %rbp
+  803577:	c3                   	ret
+
+0000000000803578 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357d:	c3                   	ret
+
+000000000080357e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803585:	48 be d4 40 80 00 00 	movabs $0x8040d4,%rsi
+  80358c:	00 00 00 
+  80358f:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+    return 0;
+}
+  80359b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a0:	5d                   	pop    %rbp
+  8035a1:	c3                   	ret
+
+00000000008035a2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035a2:	55                   	push   %rbp
+  8035a3:	48 89 e5             	mov    %rsp,%rbp
+  8035a6:	41 57                	push   %r15
+  8035a8:	41 56                	push   %r14
+  8035aa:	41 55                	push   %r13
+  8035ac:	41 54                	push   %r12
+  8035ae:	53                   	push   %rbx
+  8035af:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8035b6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8035bd:	48 85 d2             	test   %rdx,%rdx
+  8035c0:	74 7a                	je     80363c <devcons_write+0x9a>
+  8035c2:	49 89 d6             	mov    %rdx,%r14
+  8035c5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035cb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8035d0:	49 bf 0c 0f 80 00 00 	movabs $0x800f0c,%r15
+  8035d7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8035da:	4c 89 f3             	mov    %r14,%rbx
+  8035dd:	48 29 f3             	sub    %rsi,%rbx
+  8035e0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8035e5:	48 39 c3             	cmp    %rax,%rbx
+  8035e8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8035ec:	4c 63 eb             	movslq %ebx,%r13
+  8035ef:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8035f6:	48 01 c6             	add    %rax,%rsi
+  8035f9:	4c 89 ea             	mov    %r13,%rdx
+  8035fc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803603:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803606:	4c 89 ee             	mov    %r13,%rsi
+  803609:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803610:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  803617:	00 00 00 
+  80361a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80361c:	41 01 dc             	add    %ebx,%r12d
+  80361f:	49 63 f4             	movslq %r12d,%rsi
+  803622:	4c 39 f6             	cmp    %r14,%rsi
+  803625:	72 b3                	jb     8035da <devcons_write+0x38>
+    return res;
+  803627:	49 63 c4             	movslq %r12d,%rax
+}
+  80362a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803631:	5b                   	pop    %rbx
+  803632:	41 5c                	pop    %r12
+  803634:	41 5d                	pop    %r13
+  803636:	41 5e                	pop    %r14
+  803638:	41 5f                	pop    %r15
+  80363a:	5d                   	pop    %rbp
+  80363b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80363c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803642:	eb e3                	jmp    803627 <devcons_write+0x85>
+
+0000000000803644 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803644:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803647:	ba 00 00 00 00       	mov    $0x0,%edx
+  80364c:	48 85 c0             	test   %rax,%rax
+  80364f:	74 55                	je     8036a6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803651:	55                   	push   %rbp
+  803652:	48 89 e5             	mov    %rsp,%rbp
+  803655:	41 55                	push   %r13
+  803657:	41 54                	push   %r12
+  803659:	53                   	push   %rbx
+  80365a:	48 83 ec 08          	sub    $0x8,%rsp
+  80365e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803661:	48 bb 42 12 80 00 00 	movabs $0x801242,%rbx
+  803668:	00 00 00 
+  80366b:	49 bc 0f 13 80 00 00 	movabs $0x80130f,%r12
+  803672:	00 00 00 
+  803675:	eb 03                	jmp    80367a <devcons_read+0x36>
+  803677:	41 ff d4             	call   *%r12
+  80367a:	ff d3                	call   *%rbx
+  80367c:	85 c0                	test   %eax,%eax
+  80367e:	74 f7                	je     803677 <devcons_read+0x33>
+    if (c < 0) return c;
+  803680:	48 63 d0             	movslq %eax,%rdx
+  803683:	78 13                	js     803698 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80368a:	83 f8 04             	cmp    $0x4,%eax
+  80368d:	74 09                	je     803698 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80368f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803693:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803698:	48 89 d0             	mov    %rdx,%rax
+  80369b:	48 83 c4 08          	add    $0x8,%rsp
+  80369f:	5b                   	pop    %rbx
+  8036a0:	41 5c                	pop    %r12
+  8036a2:	41 5d                	pop    %r13
+  8036a4:	5d                   	pop    %rbp
+  8036a5:	c3                   	ret
+  8036a6:	48 89 d0             	mov    %rdx,%rax
+  8036a9:	c3                   	ret
+
+00000000008036aa <cputchar>:
+cputchar(int ch) {
+  8036aa:	55                   	push   %rbp
+  8036ab:	48 89 e5             	mov    %rsp,%rbp
+  8036ae:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8036b2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8036b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8036bb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8036bf:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8036c6:	00 00 00 
+  8036c9:	ff d0                	call   *%rax
+}
+  8036cb:	c9                   	leave
+  8036cc:	c3                   	ret
+
+00000000008036cd <getchar>:
+getchar(void) {
+  8036cd:	55                   	push   %rbp
+  8036ce:	48 89 e5             	mov    %rsp,%rbp
+  8036d1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8036d5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036da:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8036de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e3:	48 b8 df 1a 80 00 00 	movabs $0x801adf,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+  8036ef:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	78 06                	js     8036fb <getchar+0x2e>
+  8036f5:	74 08                	je     8036ff <getchar+0x32>
+  8036f7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8036fb:	89 d0                	mov    %edx,%eax
+  8036fd:	c9                   	leave
+  8036fe:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8036ff:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803704:	eb f5                	jmp    8036fb <getchar+0x2e>
+
+0000000000803706 <iscons>:
+iscons(int fdnum) {
+  803706:	55                   	push   %rbp
+  803707:	48 89 e5             	mov    %rsp,%rbp
+  80370a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80370e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803712:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80371e:	85 c0                	test   %eax,%eax
+  803720:	78 18                	js     80373a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803722:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803726:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80372d:	00 00 00 
+  803730:	8b 00                	mov    (%rax),%eax
+  803732:	39 02                	cmp    %eax,(%rdx)
+  803734:	0f 94 c0             	sete   %al
+  803737:	0f b6 c0             	movzbl %al,%eax
+}
+  80373a:	c9                   	leave
+  80373b:	c3                   	ret
+
+000000000080373c <opencons>:
+opencons(void) {
+  80373c:	55                   	push   %rbp
+  80373d:	48 89 e5             	mov    %rsp,%rbp
+  803740:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803744:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803748:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  80374f:	00 00 00 
+  803752:	ff d0                	call   *%rax
+  803754:	85 c0                	test   %eax,%eax
+  803756:	78 49                	js     8037a1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803758:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80375d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803762:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803766:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376b:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  803772:	00 00 00 
+  803775:	ff d0                	call   *%rax
+  803777:	85 c0                	test   %eax,%eax
+  803779:	78 26                	js     8037a1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80377b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80377f:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803786:	00 00 
+  803788:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80378a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80378e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803795:	48 b8 6e 17 80 00 00 	movabs $0x80176e,%rax
+  80379c:	00 00 00 
+  80379f:	ff d0                	call   *%rax
+}
+  8037a1:	c9                   	leave
+  8037a2:	c3                   	ret
+
+00000000008037a3 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8037a3:	55                   	push   %rbp
+  8037a4:	48 89 e5             	mov    %rsp,%rbp
+  8037a7:	41 55                	push   %r13
+  8037a9:	41 54                	push   %r12
+  8037ab:	53                   	push   %rbx
+  8037ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b0:	49 89 fc             	mov    %rdi,%r12
+  8037b3:	48 89 f7             	mov    %rsi,%rdi
+  8037b6:	48 89 d3             	mov    %rdx,%rbx
+  8037b9:	49 89 cd             	mov    %rcx,%r13
+  8037bc:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8037bf:	48 85 f6             	test   %rsi,%rsi
+  8037c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037c9:	00 00 00 
+  8037cc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8037d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037d5:	48 85 db             	test   %rbx,%rbx
+  8037d8:	74 03                	je     8037dd <ipc_recv_timed+0x3a>
+  8037da:	48 8b 33             	mov    (%rbx),%rsi
+  8037dd:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8037e9:	85 c0                	test   %eax,%eax
+  8037eb:	78 75                	js     803862 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8037ed:	4d 85 e4             	test   %r12,%r12
+  8037f0:	74 14                	je     803806 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8037f2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8037f9:	00 00 00 
+  8037fc:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803802:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803806:	4d 85 ed             	test   %r13,%r13
+  803809:	74 14                	je     80381f <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80380b:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  803812:	00 00 00 
+  803815:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80381b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80381f:	48 85 db             	test   %rbx,%rbx
+  803822:	74 23                	je     803847 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803824:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80382b:	00 00 00 
+  80382e:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803834:	ba 00 00 00 00       	mov    $0x0,%edx
+  803839:	85 c9                	test   %ecx,%ecx
+  80383b:	74 07                	je     803844 <ipc_recv_timed+0xa1>
+  80383d:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803844:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803847:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80384e:	00 00 00 
+  803851:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803857:	48 83 c4 08          	add    $0x8,%rsp
+  80385b:	5b                   	pop    %rbx
+  80385c:	41 5c                	pop    %r12
+  80385e:	41 5d                	pop    %r13
+  803860:	5d                   	pop    %rbp
+  803861:	c3                   	ret
+        if (from_env_store != NULL) {
+  803862:	4d 85 e4             	test   %r12,%r12
+  803865:	74 08                	je     80386f <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803867:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80386e:	00 
+        if (perm_store != NULL) {
+  80386f:	4d 85 ed             	test   %r13,%r13
+  803872:	74 08                	je     80387c <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803874:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80387b:	00 
+        if (size != NULL) {
+  80387c:	48 85 db             	test   %rbx,%rbx
+  80387f:	74 d6                	je     803857 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803881:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803888:	eb cd                	jmp    803857 <ipc_recv_timed+0xb4>
+
+000000000080388a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80388a:	55                   	push   %rbp
+  80388b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80388e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803894:	48 b8 a3 37 80 00 00 	movabs $0x8037a3,%rax
+  80389b:	00 00 00 
+  80389e:	ff d0                	call   *%rax
+}
+  8038a0:	5d                   	pop    %rbp
+  8038a1:	c3                   	ret
+
+00000000008038a2 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8038a2:	55                   	push   %rbp
+  8038a3:	48 89 e5             	mov    %rsp,%rbp
+  8038a6:	41 57                	push   %r15
+  8038a8:	41 56                	push   %r14
+  8038aa:	41 55                	push   %r13
+  8038ac:	41 54                	push   %r12
+  8038ae:	53                   	push   %rbx
+  8038af:	48 83 ec 18          	sub    $0x18,%rsp
+  8038b3:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8038b6:	48 89 d3             	mov    %rdx,%rbx
+  8038b9:	49 89 cc             	mov    %rcx,%r12
+  8038bc:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038bf:	48 85 d2             	test   %rdx,%rdx
+  8038c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038c9:	00 00 00 
+  8038cc:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038d0:	89 f0                	mov    %esi,%eax
+  8038d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038d6:	48 89 da             	mov    %rbx,%rdx
+  8038d9:	48 89 c6             	mov    %rax,%rsi
+  8038dc:	48 b8 0c 16 80 00 00 	movabs $0x80160c,%rax
+  8038e3:	00 00 00 
+  8038e6:	ff d0                	call   *%rax
+    while (res < 0) {
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	79 65                	jns    803951 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8038ec:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038ef:	75 33                	jne    803924 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8038f1:	49 bf 0f 13 80 00 00 	movabs $0x80130f,%r15
+  8038f8:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038fb:	49 be 0c 16 80 00 00 	movabs $0x80160c,%r14
+  803902:	00 00 00 
+        sys_yield();
+  803905:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803908:	45 89 e8             	mov    %r13d,%r8d
+  80390b:	4c 89 e1             	mov    %r12,%rcx
+  80390e:	48 89 da             	mov    %rbx,%rdx
+  803911:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803915:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803918:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80391b:	85 c0                	test   %eax,%eax
+  80391d:	79 32                	jns    803951 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80391f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803922:	74 e1                	je     803905 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803924:	89 c1                	mov    %eax,%ecx
+  803926:	48 ba e0 40 80 00 00 	movabs $0x8040e0,%rdx
+  80392d:	00 00 00 
+  803930:	be 52 00 00 00       	mov    $0x52,%esi
+  803935:	48 bf f4 40 80 00 00 	movabs $0x8040f4,%rdi
+  80393c:	00 00 00 
+  80393f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803944:	49 b8 9d 02 80 00 00 	movabs $0x80029d,%r8
+  80394b:	00 00 00 
+  80394e:	41 ff d0             	call   *%r8
+    }
+}
+  803951:	48 83 c4 18          	add    $0x18,%rsp
+  803955:	5b                   	pop    %rbx
+  803956:	41 5c                	pop    %r12
+  803958:	41 5d                	pop    %r13
+  80395a:	41 5e                	pop    %r14
+  80395c:	41 5f                	pop    %r15
+  80395e:	5d                   	pop    %rbp
+  80395f:	c3                   	ret
+
+0000000000803960 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803960:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803965:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80396c:	00 00 00 
+  80396f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803973:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803977:	48 c1 e2 04          	shl    $0x4,%rdx
+  80397b:	48 01 ca             	add    %rcx,%rdx
+  80397e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803984:	39 fa                	cmp    %edi,%edx
+  803986:	74 12                	je     80399a <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803988:	48 83 c0 01          	add    $0x1,%rax
+  80398c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803992:	75 db                	jne    80396f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803999:	c3                   	ret
+            return envs[i].env_id;
+  80399a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80399e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039a2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039a6:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8039ad:	00 00 00 
+  8039b0:	48 01 d0             	add    %rdx,%rax
+  8039b3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8039b9:	c3                   	ret
+  8039ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008039c0 <__rodata_start>:
+  8039c0:	77 72                	ja     803a34 <__rodata_start+0x74>
+  8039c2:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  8039c9:	6f 
+  8039ca:	72 20                	jb     8039ec <__rodata_start+0x2c>
+  8039cc:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  8039cf:	79 69                	jns    803a3a <__rodata_start+0x7a>
+  8039d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039d2:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a0744c <__bss_end+0x251fc44c>
+  8039d9:	69 20 6e 20 69 73    	imul   $0x7369206e,(%rax),%esp
+  8039df:	20 25 6c 69 00 75    	and    %ah,0x7500696c(%rip)        # 7580a351 <__bss_end+0x74fff351>
+  8039e5:	73 65                	jae    803a4c <__rodata_start+0x8c>
+  8039e7:	72 2f                	jb     803a18 <__rodata_start+0x58>
+  8039e9:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8039ec:	2e 63 00             	cs movsxd (%rax),%eax
+  8039ef:	65 72 72             	gs jb  803a64 <__rodata_start+0xa4>
+  8039f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039f3:	72 20                	jb     803a15 <__rodata_start+0x55>
+  8039f5:	72 65                	jb     803a5c <__rodata_start+0x9c>
+  8039f7:	61                   	(bad)
+  8039f8:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  8039ff:	3a 
+  803a00:	20 25 69 00 63 61    	and    %ah,0x61630069(%rip)        # 61e33a6f <__bss_end+0x61628a6f>
+  803a06:	74 00                	je     803a08 <__rodata_start+0x48>
+  803a08:	3c 73                	cmp    $0x73,%al
+  803a0a:	74 64                	je     803a70 <__rodata_start+0xb0>
+  803a0c:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  803a13:	27                   	(bad)
+  803a14:	74 20                	je     803a36 <__rodata_start+0x76>
+  803a16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a17:	70 65                	jo     803a7e <__rodata_start+0xbe>
+  803a19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a1a:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a07493 <__bss_end+0x251fc493>
+  803a20:	69 0a 00 3c 75 6e    	imul   $0x6e753c00,(%rdx),%ecx
+  803a26:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803a2a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2b:	3e 00 0f             	ds add %cl,(%rdi)
+  803a2e:	1f                   	(bad)
+  803a2f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803a32:	30 38                	xor    %bh,(%rax)
+  803a34:	78 5d                	js     803a93 <__rodata_start+0xd3>
+  803a36:	20 75 73             	and    %dh,0x73(%rbp)
+  803a39:	65 72 20             	gs jb  803a5c <__rodata_start+0x9c>
+  803a3c:	70 61                	jo     803a9f <__rodata_start+0xdf>
+  803a3e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a3f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803a46:	73 20                	jae    803a68 <__rodata_start+0xa8>
+  803a48:	61                   	(bad)
+  803a49:	74 20                	je     803a6b <__rodata_start+0xab>
+  803a4b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803a50:	3a 20                	cmp    (%rax),%ah
+  803a52:	00 30                	add    %dh,(%rax)
+  803a54:	31 32                	xor    %esi,(%rdx)
+  803a56:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a5d:	41                   	rex.B
+  803a5e:	42                   	rex.X
+  803a5f:	43                   	rex.XB
+  803a60:	44                   	rex.R
+  803a61:	45                   	rex.RB
+  803a62:	46 00 30             	rex.RX add %r14b,(%rax)
+  803a65:	31 32                	xor    %esi,(%rdx)
+  803a67:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a6e:	61                   	(bad)
+  803a6f:	62 63 64 65 66       	(bad)
+  803a74:	00 28                	add    %ch,(%rax)
+  803a76:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a77:	75 6c                	jne    803ae5 <__rodata_start+0x125>
+  803a79:	6c                   	insb   (%dx),%es:(%rdi)
+  803a7a:	29 00                	sub    %eax,(%rax)
+  803a7c:	65 72 72             	gs jb  803af1 <__rodata_start+0x131>
+  803a7f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a80:	72 20                	jb     803aa2 <__rodata_start+0xe2>
+  803a82:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803a87:	73 70                	jae    803af9 <__rodata_start+0x139>
+  803a89:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803a8d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803a94:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a95:	72 00                	jb     803a97 <__rodata_start+0xd7>
+  803a97:	62 61 64 20 65       	(bad)
+  803a9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a9d:	76 69                	jbe    803b08 <__rodata_start+0x148>
+  803a9f:	72 6f                	jb     803b10 <__rodata_start+0x150>
+  803aa1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aa2:	6d                   	insl   (%dx),%es:(%rdi)
+  803aa3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803aa5:	74 00                	je     803aa7 <__rodata_start+0xe7>
+  803aa7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803aae:	20 70 61             	and    %dh,0x61(%rax)
+  803ab1:	72 61                	jb     803b14 <__rodata_start+0x154>
+  803ab3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ab4:	65 74 65             	gs je  803b1c <__rodata_start+0x15c>
+  803ab7:	72 00                	jb     803ab9 <__rodata_start+0xf9>
+  803ab9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aba:	75 74                	jne    803b30 <__rodata_start+0x170>
+  803abc:	20 6f 66             	and    %ch,0x66(%rdi)
+  803abf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803ac2:	6d                   	insl   (%dx),%es:(%rdi)
+  803ac3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ac4:	72 79                	jb     803b3f <__rodata_start+0x17f>
+  803ac6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803ac9:	74 20                	je     803aeb <__rodata_start+0x12b>
+  803acb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803ad0:	76 69                	jbe    803b3b <__rodata_start+0x17b>
+  803ad2:	72 6f                	jb     803b43 <__rodata_start+0x183>
+  803ad4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ad5:	6d                   	insl   (%dx),%es:(%rdi)
+  803ad6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ad8:	74 73                	je     803b4d <__rodata_start+0x18d>
+  803ada:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803add:	72 72                	jb     803b51 <__rodata_start+0x191>
+  803adf:	75 70                	jne    803b51 <__rodata_start+0x191>
+  803ae1:	74 65                	je     803b48 <__rodata_start+0x188>
+  803ae3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803ae8:	75 67                	jne    803b51 <__rodata_start+0x191>
+  803aea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803aed:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803aef:	00 73 65             	add    %dh,0x65(%rbx)
+  803af2:	67 6d                	insl   (%dx),%es:(%edi)
+  803af4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803af6:	74 61                	je     803b59 <__rodata_start+0x199>
+  803af8:	74 69                	je     803b63 <__rodata_start+0x1a3>
+  803afa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803afb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803afc:	20 66 61             	and    %ah,0x61(%rsi)
+  803aff:	75 6c                	jne    803b6d <__rodata_start+0x1ad>
+  803b01:	74 00                	je     803b03 <__rodata_start+0x143>
+  803b03:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b0a:	20 45 4c             	and    %al,0x4c(%rbp)
+  803b0d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803b11:	61                   	(bad)
+  803b12:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803b17:	20 73 75             	and    %dh,0x75(%rbx)
+  803b1a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803b1d:	73 79                	jae    803b98 <__rodata_start+0x1d8>
+  803b1f:	73 74                	jae    803b95 <__rodata_start+0x1d5>
+  803b21:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b23:	20 63 61             	and    %ah,0x61(%rbx)
+  803b26:	6c                   	insb   (%dx),%es:(%rdi)
+  803b27:	6c                   	insb   (%dx),%es:(%rdi)
+  803b28:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803b2b:	74 72                	je     803b9f <__rodata_start+0x1df>
+  803b2d:	79 20                	jns    803b4f <__rodata_start+0x18f>
+  803b2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b31:	74 20                	je     803b53 <__rodata_start+0x193>
+  803b33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b35:	75 6e                	jne    803ba5 <__rodata_start+0x1e5>
+  803b37:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803b3b:	76 20                	jbe    803b5d <__rodata_start+0x19d>
+  803b3d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803b44:	72 65                	jb     803bab <__rodata_start+0x1eb>
+  803b46:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803b49:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b4a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803b4e:	65 78 70             	gs js  803bc1 <__rodata_start+0x201>
+  803b51:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803b56:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803b59:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803b5d:	20 66 69             	and    %ah,0x69(%rsi)
+  803b60:	6c                   	insb   (%dx),%es:(%rdi)
+  803b61:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803b65:	20 66 72             	and    %ah,0x72(%rsi)
+  803b68:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803b6d:	61                   	(bad)
+  803b6e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b73:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b77:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803b7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b7c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803b7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b80:	79 20                	jns    803ba2 <__rodata_start+0x1e2>
+  803b82:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803b89:	72 65                	jb     803bf0 <__rodata_start+0x230>
+  803b8b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803b8e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b90:	00 66 69             	add    %ah,0x69(%rsi)
+  803b93:	6c                   	insb   (%dx),%es:(%rdi)
+  803b94:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803b98:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803b9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b9c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803b9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ba1:	74 20                	je     803bc3 <__rodata_start+0x203>
+  803ba3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ba5:	75 6e                	jne    803c15 <__rodata_start+0x255>
+  803ba7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803bab:	76 61                	jbe    803c0e <__rodata_start+0x24e>
+  803bad:	6c                   	insb   (%dx),%es:(%rdi)
+  803bae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803bb5:	00 
+  803bb6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803bbd:	72 65                	jb     803c24 <__rodata_start+0x264>
+  803bbf:	61                   	(bad)
+  803bc0:	64 79 20             	fs jns 803be3 <__rodata_start+0x223>
+  803bc3:	65 78 69             	gs js  803c2f <__rodata_start+0x26f>
+  803bc6:	73 74                	jae    803c3c <__rodata_start+0x27c>
+  803bc8:	73 00                	jae    803bca <__rodata_start+0x20a>
+  803bca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bcb:	70 65                	jo     803c32 <__rodata_start+0x272>
+  803bcd:	72 61                	jb     803c30 <__rodata_start+0x270>
+  803bcf:	74 69                	je     803c3a <__rodata_start+0x27a>
+  803bd1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bd2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bd3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803bd6:	74 20                	je     803bf8 <__rodata_start+0x238>
+  803bd8:	73 75                	jae    803c4f <__rodata_start+0x28f>
+  803bda:	70 70                	jo     803c4c <__rodata_start+0x28c>
+  803bdc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bdd:	72 74                	jb     803c53 <__rodata_start+0x293>
+  803bdf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803be5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803bea:	74 00                	je     803bec <__rodata_start+0x22c>
+  803bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803bf3:	00 00 00 
+  803bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803bfd:	00 00 00 
+  803c00:	da 05 80 00 00 00    	fiaddl 0x80(%rip)        # 803c86 <__rodata_start+0x2c6>
+  803c06:	00 00                	add    %al,(%rax)
+  803c08:	1b 0c 80             	sbb    (%rax,%rax,4),%ecx
+  803c0b:	00 00                	add    %al,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 0b                	add    %cl,(%rbx)
+  803c11:	0c 80                	or     $0x80,%al
+  803c13:	00 00                	add    %al,(%rax)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 1b                	add    %bl,(%rbx)
+  803c19:	0c 80                	or     $0x80,%al
+  803c1b:	00 00                	add    %al,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 1b                	add    %bl,(%rbx)
+  803c21:	0c 80                	or     $0x80,%al
+  803c23:	00 00                	add    %al,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 1b                	add    %bl,(%rbx)
+  803c29:	0c 80                	or     $0x80,%al
+  803c2b:	00 00                	add    %al,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 1b                	add    %bl,(%rbx)
+  803c31:	0c 80                	or     $0x80,%al
+  803c33:	00 00                	add    %al,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 f9                	add    %bh,%cl
+  803c39:	05 80 00 00 00       	add    $0x80,%eax
+  803c3e:	00 00                	add    %al,(%rax)
+  803c40:	1b 0c 80             	sbb    (%rax,%rax,4),%ecx
+  803c43:	00 00                	add    %al,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 1b                	add    %bl,(%rbx)
+  803c49:	0c 80                	or     $0x80,%al
+  803c4b:	00 00                	add    %al,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 ed                	add    %ch,%ch
+  803c51:	05 80 00 00 00       	add    $0x80,%eax
+  803c56:	00 00                	add    %al,(%rax)
+  803c58:	67 06                	addr32 (bad)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 1b                	add    %bl,(%rbx)
+  803c61:	0c 80                	or     $0x80,%al
+  803c63:	00 00                	add    %al,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 ed                	add    %ch,%ch
+  803c69:	05 80 00 00 00       	add    $0x80,%eax
+  803c6e:	00 00                	add    %al,(%rax)
+  803c70:	33 06                	xor    (%rsi),%eax
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 33                	add    %dh,(%rbx)
+  803c79:	06                   	(bad)
+  803c7a:	80 00 00             	addb   $0x0,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 33                	add    %dh,(%rbx)
+  803c81:	06                   	(bad)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 33                	add    %dh,(%rbx)
+  803c89:	06                   	(bad)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 33                	add    %dh,(%rbx)
+  803c91:	06                   	(bad)
+  803c92:	80 00 00             	addb   $0x0,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 33                	add    %dh,(%rbx)
+  803c99:	06                   	(bad)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 33                	add    %dh,(%rbx)
+  803ca1:	06                   	(bad)
+  803ca2:	80 00 00             	addb   $0x0,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 33                	add    %dh,(%rbx)
+  803ca9:	06                   	(bad)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 33                	add    %dh,(%rbx)
+  803cb1:	06                   	(bad)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 1b                	add    %bl,(%rbx)
+  803cb9:	0c 80                	or     $0x80,%al
+  803cbb:	00 00                	add    %al,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 1b                	add    %bl,(%rbx)
+  803cc1:	0c 80                	or     $0x80,%al
+  803cc3:	00 00                	add    %al,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 1b                	add    %bl,(%rbx)
+  803cc9:	0c 80                	or     $0x80,%al
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 1b                	add    %bl,(%rbx)
+  803cd1:	0c 80                	or     $0x80,%al
+  803cd3:	00 00                	add    %al,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 1b                	add    %bl,(%rbx)
+  803cd9:	0c 80                	or     $0x80,%al
+  803cdb:	00 00                	add    %al,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 1b                	add    %bl,(%rbx)
+  803ce1:	0c 80                	or     $0x80,%al
+  803ce3:	00 00                	add    %al,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 1b                	add    %bl,(%rbx)
+  803ce9:	0c 80                	or     $0x80,%al
+  803ceb:	00 00                	add    %al,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 1b                	add    %bl,(%rbx)
+  803cf1:	0c 80                	or     $0x80,%al
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 1b                	add    %bl,(%rbx)
+  803cf9:	0c 80                	or     $0x80,%al
+  803cfb:	00 00                	add    %al,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 1b                	add    %bl,(%rbx)
+  803d01:	0c 80                	or     $0x80,%al
+  803d03:	00 00                	add    %al,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 1b                	add    %bl,(%rbx)
+  803d09:	0c 80                	or     $0x80,%al
+  803d0b:	00 00                	add    %al,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 1b                	add    %bl,(%rbx)
+  803d11:	0c 80                	or     $0x80,%al
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 1b                	add    %bl,(%rbx)
+  803d19:	0c 80                	or     $0x80,%al
+  803d1b:	00 00                	add    %al,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 1b                	add    %bl,(%rbx)
+  803d21:	0c 80                	or     $0x80,%al
+  803d23:	00 00                	add    %al,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 1b                	add    %bl,(%rbx)
+  803d29:	0c 80                	or     $0x80,%al
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 1b                	add    %bl,(%rbx)
+  803d31:	0c 80                	or     $0x80,%al
+  803d33:	00 00                	add    %al,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 1b                	add    %bl,(%rbx)
+  803d39:	0c 80                	or     $0x80,%al
+  803d3b:	00 00                	add    %al,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 1b                	add    %bl,(%rbx)
+  803d41:	0c 80                	or     $0x80,%al
+  803d43:	00 00                	add    %al,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 1b                	add    %bl,(%rbx)
+  803d49:	0c 80                	or     $0x80,%al
+  803d4b:	00 00                	add    %al,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 1b                	add    %bl,(%rbx)
+  803d51:	0c 80                	or     $0x80,%al
+  803d53:	00 00                	add    %al,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 1b                	add    %bl,(%rbx)
+  803d59:	0c 80                	or     $0x80,%al
+  803d5b:	00 00                	add    %al,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 1b                	add    %bl,(%rbx)
+  803d61:	0c 80                	or     $0x80,%al
+  803d63:	00 00                	add    %al,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 1b                	add    %bl,(%rbx)
+  803d69:	0c 80                	or     $0x80,%al
+  803d6b:	00 00                	add    %al,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 1b                	add    %bl,(%rbx)
+  803d71:	0c 80                	or     $0x80,%al
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 1b                	add    %bl,(%rbx)
+  803d79:	0c 80                	or     $0x80,%al
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 1b                	add    %bl,(%rbx)
+  803d81:	0c 80                	or     $0x80,%al
+  803d83:	00 00                	add    %al,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 1b                	add    %bl,(%rbx)
+  803d89:	0c 80                	or     $0x80,%al
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 1b                	add    %bl,(%rbx)
+  803d91:	0c 80                	or     $0x80,%al
+  803d93:	00 00                	add    %al,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 1b                	add    %bl,(%rbx)
+  803d99:	0c 80                	or     $0x80,%al
+  803d9b:	00 00                	add    %al,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 1b                	add    %bl,(%rbx)
+  803da1:	0c 80                	or     $0x80,%al
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 3e                	add    %bh,(%rsi)
+  803da9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803daf:	00 1b                	add    %bl,(%rbx)
+  803db1:	0c 80                	or     $0x80,%al
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 1b                	add    %bl,(%rbx)
+  803db9:	0c 80                	or     $0x80,%al
+  803dbb:	00 00                	add    %al,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 1b                	add    %bl,(%rbx)
+  803dc1:	0c 80                	or     $0x80,%al
+  803dc3:	00 00                	add    %al,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 1b                	add    %bl,(%rbx)
+  803dc9:	0c 80                	or     $0x80,%al
+  803dcb:	00 00                	add    %al,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 1b                	add    %bl,(%rbx)
+  803dd1:	0c 80                	or     $0x80,%al
+  803dd3:	00 00                	add    %al,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 1b                	add    %bl,(%rbx)
+  803dd9:	0c 80                	or     $0x80,%al
+  803ddb:	00 00                	add    %al,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 1b                	add    %bl,(%rbx)
+  803de1:	0c 80                	or     $0x80,%al
+  803de3:	00 00                	add    %al,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 1b                	add    %bl,(%rbx)
+  803de9:	0c 80                	or     $0x80,%al
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 1b                	add    %bl,(%rbx)
+  803df1:	0c 80                	or     $0x80,%al
+  803df3:	00 00                	add    %al,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 1b                	add    %bl,(%rbx)
+  803df9:	0c 80                	or     $0x80,%al
+  803dfb:	00 00                	add    %al,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 8a 06 80 00 00    	add    %cl,0x8006(%rdx)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 59 08             	add    %bl,0x8(%rcx)
+  803e0a:	80 00 00             	addb   $0x0,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 1b                	add    %bl,(%rbx)
+  803e11:	0c 80                	or     $0x80,%al
+  803e13:	00 00                	add    %al,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 1b                	add    %bl,(%rbx)
+  803e19:	0c 80                	or     $0x80,%al
+  803e1b:	00 00                	add    %al,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 1b                	add    %bl,(%rbx)
+  803e21:	0c 80                	or     $0x80,%al
+  803e23:	00 00                	add    %al,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 1b                	add    %bl,(%rbx)
+  803e29:	0c 80                	or     $0x80,%al
+  803e2b:	00 00                	add    %al,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 b9 06 80 00 00    	add    %bh,0x8006(%rcx)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 1b                	add    %bl,(%rbx)
+  803e39:	0c 80                	or     $0x80,%al
+  803e3b:	00 00                	add    %al,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 1b                	add    %bl,(%rbx)
+  803e41:	0c 80                	or     $0x80,%al
+  803e43:	00 00                	add    %al,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 7f 06             	add    %bh,0x6(%rdi)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 1b                	add    %bl,(%rbx)
+  803e51:	0c 80                	or     $0x80,%al
+  803e53:	00 00                	add    %al,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 1b                	add    %bl,(%rbx)
+  803e59:	0c 80                	or     $0x80,%al
+  803e5b:	00 00                	add    %al,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 01                	add    %al,(%rcx)
+  803e61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803e67:	00 cb                	add    %cl,%bl
+  803e69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803e6f:	00 1b                	add    %bl,(%rbx)
+  803e71:	0c 80                	or     $0x80,%al
+  803e73:	00 00                	add    %al,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 1b                	add    %bl,(%rbx)
+  803e79:	0c 80                	or     $0x80,%al
+  803e7b:	00 00                	add    %al,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 50 07             	add    %dl,0x7(%rax)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 1b                	add    %bl,(%rbx)
+  803e89:	0c 80                	or     $0x80,%al
+  803e8b:	00 00                	add    %al,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 2d 09 80 00 00    	add    %ch,0x8009(%rip)        # 80be9e <__bss_end+0xe9e>
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 1b                	add    %bl,(%rbx)
+  803e99:	0c 80                	or     $0x80,%al
+  803e9b:	00 00                	add    %al,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 1b                	add    %bl,(%rbx)
+  803ea1:	0c 80                	or     $0x80,%al
+  803ea3:	00 00                	add    %al,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 3e                	add    %bh,(%rsi)
+  803ea9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eaf:	00 1b                	add    %bl,(%rbx)
+  803eb1:	0c 80                	or     $0x80,%al
+  803eb3:	00 00                	add    %al,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 e3                	add    %ah,%bl
+  803eb9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803ec0 <error_string>:
+	...
+  803ec8:	85 3a 80 00 00 00 00 00 97 3a 80 00 00 00 00 00     .:.......:......
+  803ed8:	a7 3a 80 00 00 00 00 00 b9 3a 80 00 00 00 00 00     .:.......:......
+  803ee8:	c7 3a 80 00 00 00 00 00 db 3a 80 00 00 00 00 00     .:.......:......
+  803ef8:	f0 3a 80 00 00 00 00 00 03 3b 80 00 00 00 00 00     .:.......;......
+  803f08:	15 3b 80 00 00 00 00 00 29 3b 80 00 00 00 00 00     .;......);......
+  803f18:	39 3b 80 00 00 00 00 00 4c 3b 80 00 00 00 00 00     9;......L;......
+  803f28:	63 3b 80 00 00 00 00 00 79 3b 80 00 00 00 00 00     c;......y;......
+  803f38:	91 3b 80 00 00 00 00 00 a9 3b 80 00 00 00 00 00     .;.......;......
+  803f48:	b6 3b 80 00 00 00 00 00 68 3f 80 00 00 00 00 00     .;......h?......
+  803f58:	ca 3b 80 00 00 00 00 00 e2 3b 80 00 00 00 00 00     .;.......;......
+  803f68:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803f78:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803f88:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803f98:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803fa8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803fb8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803fc8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803fd8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803fe8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803ff8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804008:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804018:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804028:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804038:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804048:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804058:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804060 <devtab>:
+  804060:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804070:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804080:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804090:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8040a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8040b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8040c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8040d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8040e0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8040f0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804100:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804110:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804120:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804130:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804140:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804150:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8041d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,7497 @@
+
+obj/user/createsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b6 01 00 00       	call   8001d9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 30          	sub    $0x30,%rsp
+  800034:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800037:	49 89 f4             	mov    %rsi,%r12
+
+    if (argc < 3) { 
+  80003a:	83 ff 02             	cmp    $0x2,%edi
+  80003d:	7e 7b                	jle    8000ba <umain+0x95>
+        cprintf("Not enough arguments for creating snapshot\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    } else if (argc > 3) {
+  80003f:	83 ff 03             	cmp    $0x3,%edi
+  800042:	0f 8f c8 00 00 00    	jg     800110 <umain+0xeb>
+    struct Argstate args;
+
+    char *comment = NULL;
+    char *name = NULL;
+
+    argstart(&argc, argv, &args);
+  800048:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  80004c:	48 8d 7d bc          	lea    -0x44(%rbp),%rdi
+  800050:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  800057:	00 00 00 
+  80005a:	ff d0                	call   *%rax
+    char *name = NULL;
+  80005c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    char *comment = NULL;
+  800062:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  800068:	48 bb 05 17 80 00 00 	movabs $0x801705,%rbx
+  80006f:	00 00 00 
+  800072:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  800076:	ff d3                	call   *%rbx
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 1f 01 00 00    	js     80019f <umain+0x17a>
+        switch (i) {
+  800080:	83 f8 63             	cmp    $0x63,%eax
+  800083:	0f 84 e4 00 00 00    	je     80016d <umain+0x148>
+  800089:	83 f8 6e             	cmp    $0x6e,%eax
+  80008c:	0f 84 f4 00 00 00    	je     800186 <umain+0x161>
+        case 'n':
+            name = argnextvalue(&args);
+            name++;
+            break;
+        default:
+            cprintf("Invalid arguments for creating snapshot\n");
+  800092:	48 bf 28 3a 80 00 00 	movabs $0x803a28,%rdi
+  800099:	00 00 00 
+  80009c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a1:	48 ba 57 03 80 00 00 	movabs $0x800357,%rdx
+  8000a8:	00 00 00 
+  8000ab:	ff d2                	call   *%rdx
+        cprintf("Snapshot is not created\n");
+    }
+    
+
+    return;
+  8000ad:	48 83 c4 30          	add    $0x30,%rsp
+  8000b1:	5b                   	pop    %rbx
+  8000b2:	41 5c                	pop    %r12
+  8000b4:	41 5d                	pop    %r13
+  8000b6:	41 5e                	pop    %r14
+  8000b8:	5d                   	pop    %rbp
+  8000b9:	c3                   	ret
+        cprintf("Not enough arguments for creating snapshot\n");
+  8000ba:	48 bf a0 39 80 00 00 	movabs $0x8039a0,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	48 ba 57 03 80 00 00 	movabs $0x800357,%rdx
+  8000d0:	00 00 00 
+  8000d3:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  8000d5:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  8000d9:	7e d2                	jle    8000ad <umain+0x88>
+  8000db:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  8000e0:	49 be d0 39 80 00 00 	movabs $0x8039d0,%r14
+  8000e7:	00 00 00 
+  8000ea:	49 bd 57 03 80 00 00 	movabs $0x800357,%r13
+  8000f1:	00 00 00 
+  8000f4:	49 8b 14 dc          	mov    (%r12,%rbx,8),%rdx
+  8000f8:	89 de                	mov    %ebx,%esi
+  8000fa:	4c 89 f7             	mov    %r14,%rdi
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	41 ff d5             	call   *%r13
+        for(int i = 0; i < argc; ++i) {
+  800105:	48 83 c3 01          	add    $0x1,%rbx
+  800109:	39 5d bc             	cmp    %ebx,-0x44(%rbp)
+  80010c:	7f e6                	jg     8000f4 <umain+0xcf>
+  80010e:	eb 9d                	jmp    8000ad <umain+0x88>
+        cprintf("Too much arguments for creating snapshot\n");
+  800110:	48 bf f8 39 80 00 00 	movabs $0x8039f8,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	48 ba 57 03 80 00 00 	movabs $0x800357,%rdx
+  800126:	00 00 00 
+  800129:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  80012b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  80012f:	0f 8e 78 ff ff ff    	jle    8000ad <umain+0x88>
+  800135:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  80013a:	49 be d0 39 80 00 00 	movabs $0x8039d0,%r14
+  800141:	00 00 00 
+  800144:	49 bd 57 03 80 00 00 	movabs $0x800357,%r13
+  80014b:	00 00 00 
+  80014e:	49 8b 14 dc          	mov    (%r12,%rbx,8),%rdx
+  800152:	89 de                	mov    %ebx,%esi
+  800154:	4c 89 f7             	mov    %r14,%rdi
+  800157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015c:	41 ff d5             	call   *%r13
+        for(int i = 0; i < argc; ++i) {
+  80015f:	48 83 c3 01          	add    $0x1,%rbx
+  800163:	39 5d bc             	cmp    %ebx,-0x44(%rbp)
+  800166:	7f e6                	jg     80014e <umain+0x129>
+  800168:	e9 40 ff ff ff       	jmp    8000ad <umain+0x88>
+            comment = argnextvalue(&args);
+  80016d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  800171:	48 b8 b1 17 80 00 00 	movabs $0x8017b1,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+            comment++;
+  80017d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+            break;
+  800181:	e9 ec fe ff ff       	jmp    800072 <umain+0x4d>
+            name = argnextvalue(&args);
+  800186:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80018a:	48 b8 b1 17 80 00 00 	movabs $0x8017b1,%rax
+  800191:	00 00 00 
+  800194:	ff d0                	call   *%rax
+            name++;
+  800196:	4c 8d 68 01          	lea    0x1(%rax),%r13
+            break;
+  80019a:	e9 d3 fe ff ff       	jmp    800072 <umain+0x4d>
+    int res = create_snapshot(comment, name);
+  80019f:	4c 89 ee             	mov    %r13,%rsi
+  8001a2:	4c 89 e7             	mov    %r12,%rdi
+  8001a5:	48 b8 18 20 80 00 00 	movabs $0x802018,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+    if (res < 0) {
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	0f 89 f4 fe ff ff    	jns    8000ad <umain+0x88>
+        cprintf("Snapshot is not created\n");
+  8001b9:	48 bf 51 3a 80 00 00 	movabs $0x803a51,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba 57 03 80 00 00 	movabs $0x800357,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	e9 d4 fe ff ff       	jmp    8000ad <umain+0x88>
+
+00000000008001d9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	41 56                	push   %r14
+  8001df:	41 55                	push   %r13
+  8001e1:	41 54                	push   %r12
+  8001e3:	53                   	push   %rbx
+  8001e4:	41 89 fd             	mov    %edi,%r13d
+  8001e7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001ea:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8001f1:	00 00 00 
+  8001f4:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8001fb:	00 00 00 
+  8001fe:	48 39 c2             	cmp    %rax,%rdx
+  800201:	73 17                	jae    80021a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800203:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800206:	49 89 c4             	mov    %rax,%r12
+  800209:	48 83 c3 08          	add    $0x8,%rbx
+  80020d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800212:	ff 53 f8             	call   *-0x8(%rbx)
+  800215:	4c 39 e3             	cmp    %r12,%rbx
+  800218:	72 ef                	jb     800209 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80021a:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+  800226:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80022b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80022f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800233:	48 c1 e0 04          	shl    $0x4,%rax
+  800237:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80023e:	00 00 00 
+  800241:	48 01 d0             	add    %rdx,%rax
+  800244:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80024b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80024e:	45 85 ed             	test   %r13d,%r13d
+  800251:	7e 0d                	jle    800260 <libmain+0x87>
+  800253:	49 8b 06             	mov    (%r14),%rax
+  800256:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80025d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800260:	4c 89 f6             	mov    %r14,%rsi
+  800263:	44 89 ef             	mov    %r13d,%edi
+  800266:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80026d:	00 00 00 
+  800270:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800272:	48 b8 87 02 80 00 00 	movabs $0x800287,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+#endif
+}
+  80027e:	5b                   	pop    %rbx
+  80027f:	41 5c                	pop    %r12
+  800281:	41 5d                	pop    %r13
+  800283:	41 5e                	pop    %r14
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+
+0000000000800287 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80028b:	48 b8 78 1a 80 00 00 	movabs $0x801a78,%rax
+  800292:	00 00 00 
+  800295:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80029c:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  8002a3:	00 00 00 
+  8002a6:	ff d0                	call   *%rax
+}
+  8002a8:	5d                   	pop    %rbp
+  8002a9:	c3                   	ret
+
+00000000008002aa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002aa:	55                   	push   %rbp
+  8002ab:	48 89 e5             	mov    %rsp,%rbp
+  8002ae:	53                   	push   %rbx
+  8002af:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002b6:	8b 06                	mov    (%rsi),%eax
+  8002b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8002bb:	89 16                	mov    %edx,(%rsi)
+  8002bd:	48 98                	cltq
+  8002bf:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002c4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002ca:	74 0a                	je     8002d6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002cc:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d4:	c9                   	leave
+  8002d5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002d6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002da:	be ff 00 00 00       	mov    $0xff,%esi
+  8002df:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8002e6:	00 00 00 
+  8002e9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002eb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002f1:	eb d9                	jmp    8002cc <putch+0x22>
+
+00000000008002f3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002f3:	55                   	push   %rbp
+  8002f4:	48 89 e5             	mov    %rsp,%rbp
+  8002f7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002fe:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800301:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800308:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800315:	48 89 f1             	mov    %rsi,%rcx
+  800318:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80031f:	48 bf aa 02 80 00 00 	movabs $0x8002aa,%rdi
+  800326:	00 00 00 
+  800329:	48 b8 a7 04 80 00 00 	movabs $0x8004a7,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800335:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80033c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800343:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80034f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800355:	c9                   	leave
+  800356:	c3                   	ret
+
+0000000000800357 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800357:	55                   	push   %rbp
+  800358:	48 89 e5             	mov    %rsp,%rbp
+  80035b:	48 83 ec 50          	sub    $0x50,%rsp
+  80035f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800363:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800367:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80036b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80036f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800373:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80037a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80037e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800382:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800386:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80038a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80038e:	48 b8 f3 02 80 00 00 	movabs $0x8002f3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+
+000000000080039c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80039c:	55                   	push   %rbp
+  80039d:	48 89 e5             	mov    %rsp,%rbp
+  8003a0:	41 57                	push   %r15
+  8003a2:	41 56                	push   %r14
+  8003a4:	41 55                	push   %r13
+  8003a6:	41 54                	push   %r12
+  8003a8:	53                   	push   %rbx
+  8003a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ad:	49 89 fc             	mov    %rdi,%r12
+  8003b0:	49 89 f5             	mov    %rsi,%r13
+  8003b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003b7:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003ba:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003bd:	41 89 cf             	mov    %ecx,%r15d
+  8003c0:	4c 39 fa             	cmp    %r15,%rdx
+  8003c3:	73 5b                	jae    800420 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003c5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003c9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003cd:	85 db                	test   %ebx,%ebx
+  8003cf:	7e 0e                	jle    8003df <print_num+0x43>
+            putch(padc, put_arg);
+  8003d1:	4c 89 ee             	mov    %r13,%rsi
+  8003d4:	44 89 f7             	mov    %r14d,%edi
+  8003d7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003da:	83 eb 01             	sub    $0x1,%ebx
+  8003dd:	75 f2                	jne    8003d1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003df:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003e3:	48 b9 85 3a 80 00 00 	movabs $0x803a85,%rcx
+  8003ea:	00 00 00 
+  8003ed:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  8003f4:	00 00 00 
+  8003f7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800404:	49 f7 f7             	div    %r15
+  800407:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80040b:	4c 89 ee             	mov    %r13,%rsi
+  80040e:	41 ff d4             	call   *%r12
+}
+  800411:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800415:	5b                   	pop    %rbx
+  800416:	41 5c                	pop    %r12
+  800418:	41 5d                	pop    %r13
+  80041a:	41 5e                	pop    %r14
+  80041c:	41 5f                	pop    %r15
+  80041e:	5d                   	pop    %rbp
+  80041f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800420:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800424:	ba 00 00 00 00       	mov    $0x0,%edx
+  800429:	49 f7 f7             	div    %r15
+  80042c:	48 83 ec 08          	sub    $0x8,%rsp
+  800430:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800434:	52                   	push   %rdx
+  800435:	45 0f be c9          	movsbl %r9b,%r9d
+  800439:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80043d:	48 89 c2             	mov    %rax,%rdx
+  800440:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+  80044c:	48 83 c4 10          	add    $0x10,%rsp
+  800450:	eb 8d                	jmp    8003df <print_num+0x43>
+
+0000000000800452 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800452:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800456:	48 8b 06             	mov    (%rsi),%rax
+  800459:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80045d:	73 0a                	jae    800469 <sprintputch+0x17>
+        *state->start++ = ch;
+  80045f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800463:	48 89 16             	mov    %rdx,(%rsi)
+  800466:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800469:	c3                   	ret
+
+000000000080046a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	48 83 ec 50          	sub    $0x50,%rsp
+  800472:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800476:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80047a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80047e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800485:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800489:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800491:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800495:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800499:	48 b8 a7 04 80 00 00 	movabs $0x8004a7,%rax
+  8004a0:	00 00 00 
+  8004a3:	ff d0                	call   *%rax
+}
+  8004a5:	c9                   	leave
+  8004a6:	c3                   	ret
+
+00000000008004a7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004a7:	55                   	push   %rbp
+  8004a8:	48 89 e5             	mov    %rsp,%rbp
+  8004ab:	41 57                	push   %r15
+  8004ad:	41 56                	push   %r14
+  8004af:	41 55                	push   %r13
+  8004b1:	41 54                	push   %r12
+  8004b3:	53                   	push   %rbx
+  8004b4:	48 83 ec 38          	sub    $0x38,%rsp
+  8004b8:	49 89 fe             	mov    %rdi,%r14
+  8004bb:	49 89 f5             	mov    %rsi,%r13
+  8004be:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004c1:	48 8b 01             	mov    (%rcx),%rax
+  8004c4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004c8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004d8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004dc:	0f b6 3b             	movzbl (%rbx),%edi
+  8004df:	40 80 ff 25          	cmp    $0x25,%dil
+  8004e3:	74 18                	je     8004fd <vprintfmt+0x56>
+            if (!ch) return;
+  8004e5:	40 84 ff             	test   %dil,%dil
+  8004e8:	0f 84 b1 06 00 00    	je     800b9f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004ee:	40 0f b6 ff          	movzbl %dil,%edi
+  8004f2:	4c 89 ee             	mov    %r13,%rsi
+  8004f5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004f8:	4c 89 e3             	mov    %r12,%rbx
+  8004fb:	eb db                	jmp    8004d8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004fd:	be 00 00 00 00       	mov    $0x0,%esi
+  800502:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80050b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800511:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800518:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80051c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800521:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800526:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800529:	83 e8 23             	sub    $0x23,%eax
+  80052c:	3c 57                	cmp    $0x57,%al
+  80052e:	0f 87 51 06 00 00    	ja     800b85 <vprintfmt+0x6de>
+  800534:	0f b6 c0             	movzbl %al,%eax
+  800537:	48 b9 20 3c 80 00 00 	movabs $0x803c20,%rcx
+  80053e:	00 00 00 
+  800541:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800544:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800547:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80054b:	eb cf                	jmp    80051c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80054d:	49 89 dc             	mov    %rbx,%r12
+  800550:	be 01 00 00 00       	mov    $0x1,%esi
+  800555:	eb c5                	jmp    80051c <vprintfmt+0x75>
+            padc = ch;
+  800557:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80055b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80055e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800561:	eb b9                	jmp    80051c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800563:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800566:	83 f8 2f             	cmp    $0x2f,%eax
+  800569:	77 24                	ja     80058f <vprintfmt+0xe8>
+  80056b:	89 c1                	mov    %eax,%ecx
+  80056d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800571:	83 c0 08             	add    $0x8,%eax
+  800574:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800577:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80057a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80057d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800581:	79 99                	jns    80051c <vprintfmt+0x75>
+                width = precision;
+  800583:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800587:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80058d:	eb 8d                	jmp    80051c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80058f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800593:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800597:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059b:	eb da                	jmp    800577 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80059d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005a2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005a6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005ac:	3c 39                	cmp    $0x39,%al
+  8005ae:	77 1c                	ja     8005cc <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005b0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005b4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005b8:	0f b6 c0             	movzbl %al,%eax
+  8005bb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c0:	0f b6 03             	movzbl (%rbx),%eax
+  8005c3:	3c 39                	cmp    $0x39,%al
+  8005c5:	76 e9                	jbe    8005b0 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005c7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005ca:	eb b1                	jmp    80057d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005cc:	49 89 dc             	mov    %rbx,%r12
+  8005cf:	eb ac                	jmp    80057d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005d1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005d4:	85 c9                	test   %ecx,%ecx
+  8005d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005db:	0f 49 c1             	cmovns %ecx,%eax
+  8005de:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005e1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e4:	e9 33 ff ff ff       	jmp    80051c <vprintfmt+0x75>
+            lflag++;
+  8005e9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ef:	e9 28 ff ff ff       	jmp    80051c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fa:	77 19                	ja     800615 <vprintfmt+0x16e>
+  8005fc:	89 c2                	mov    %eax,%edx
+  8005fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800602:	83 c0 08             	add    $0x8,%eax
+  800605:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800608:	8b 3a                	mov    (%rdx),%edi
+  80060a:	4c 89 ee             	mov    %r13,%rsi
+  80060d:	41 ff d6             	call   *%r14
+            break;
+  800610:	e9 c3 fe ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800615:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800619:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80061d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800621:	eb e5                	jmp    800608 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800623:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800626:	83 f8 2f             	cmp    $0x2f,%eax
+  800629:	77 5a                	ja     800685 <vprintfmt+0x1de>
+  80062b:	89 c2                	mov    %eax,%edx
+  80062d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800631:	83 c0 08             	add    $0x8,%eax
+  800634:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800637:	8b 02                	mov    (%rdx),%eax
+  800639:	89 c1                	mov    %eax,%ecx
+  80063b:	f7 d9                	neg    %ecx
+  80063d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800640:	83 f9 14             	cmp    $0x14,%ecx
+  800643:	7f 4e                	jg     800693 <vprintfmt+0x1ec>
+  800645:	48 63 c1             	movslq %ecx,%rax
+  800648:	48 ba e0 3e 80 00 00 	movabs $0x803ee0,%rdx
+  80064f:	00 00 00 
+  800652:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800656:	48 85 c0             	test   %rax,%rax
+  800659:	74 38                	je     800693 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80065b:	48 89 c1             	mov    %rax,%rcx
+  80065e:	48 ba b9 40 80 00 00 	movabs $0x8040b9,%rdx
+  800665:	00 00 00 
+  800668:	4c 89 ee             	mov    %r13,%rsi
+  80066b:	4c 89 f7             	mov    %r14,%rdi
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  80067a:	00 00 00 
+  80067d:	41 ff d0             	call   *%r8
+  800680:	e9 53 fe ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800685:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800689:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800691:	eb a4                	jmp    800637 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800693:	48 ba 9d 3a 80 00 00 	movabs $0x803a9d,%rdx
+  80069a:	00 00 00 
+  80069d:	4c 89 ee             	mov    %r13,%rsi
+  8006a0:	4c 89 f7             	mov    %r14,%rdi
+  8006a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a8:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8006af:	00 00 00 
+  8006b2:	41 ff d0             	call   *%r8
+  8006b5:	e9 1e fe ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c0:	77 6c                	ja     80072e <vprintfmt+0x287>
+  8006c2:	89 c2                	mov    %eax,%edx
+  8006c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c8:	83 c0 08             	add    $0x8,%eax
+  8006cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ce:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006d1:	48 85 d2             	test   %rdx,%rdx
+  8006d4:	48 b8 96 3a 80 00 00 	movabs $0x803a96,%rax
+  8006db:	00 00 00 
+  8006de:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006e2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006e6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006ea:	7e 06                	jle    8006f2 <vprintfmt+0x24b>
+  8006ec:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006f0:	75 4a                	jne    80073c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006f2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006f6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006fa:	0f b6 00             	movzbl (%rax),%eax
+  8006fd:	84 c0                	test   %al,%al
+  8006ff:	0f 85 9a 00 00 00    	jne    80079f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800705:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800708:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80070c:	85 c0                	test   %eax,%eax
+  80070e:	0f 8e c4 fd ff ff    	jle    8004d8 <vprintfmt+0x31>
+  800714:	4c 89 ee             	mov    %r13,%rsi
+  800717:	bf 20 00 00 00       	mov    $0x20,%edi
+  80071c:	41 ff d6             	call   *%r14
+  80071f:	41 83 ec 01          	sub    $0x1,%r12d
+  800723:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800727:	75 eb                	jne    800714 <vprintfmt+0x26d>
+  800729:	e9 aa fd ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80072e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800732:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800736:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073a:	eb 92                	jmp    8006ce <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80073c:	49 63 f7             	movslq %r15d,%rsi
+  80073f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800743:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  80074a:	00 00 00 
+  80074d:	ff d0                	call   *%rax
+  80074f:	48 89 c2             	mov    %rax,%rdx
+  800752:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800755:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800757:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80075a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80075d:	85 c0                	test   %eax,%eax
+  80075f:	7e 91                	jle    8006f2 <vprintfmt+0x24b>
+  800761:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800766:	4c 89 ee             	mov    %r13,%rsi
+  800769:	44 89 e7             	mov    %r12d,%edi
+  80076c:	41 ff d6             	call   *%r14
+  80076f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800773:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800776:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800779:	75 eb                	jne    800766 <vprintfmt+0x2bf>
+  80077b:	e9 72 ff ff ff       	jmp    8006f2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800780:	0f b6 f8             	movzbl %al,%edi
+  800783:	4c 89 ee             	mov    %r13,%rsi
+  800786:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800789:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80078d:	49 83 c4 01          	add    $0x1,%r12
+  800791:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800797:	84 c0                	test   %al,%al
+  800799:	0f 84 66 ff ff ff    	je     800705 <vprintfmt+0x25e>
+  80079f:	45 85 ff             	test   %r15d,%r15d
+  8007a2:	78 0a                	js     8007ae <vprintfmt+0x307>
+  8007a4:	41 83 ef 01          	sub    $0x1,%r15d
+  8007a8:	0f 88 57 ff ff ff    	js     800705 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007ae:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007b2:	74 cc                	je     800780 <vprintfmt+0x2d9>
+  8007b4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007b7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007bc:	80 fa 5e             	cmp    $0x5e,%dl
+  8007bf:	77 c2                	ja     800783 <vprintfmt+0x2dc>
+  8007c1:	eb bd                	jmp    800780 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c3:	40 84 f6             	test   %sil,%sil
+  8007c6:	75 26                	jne    8007ee <vprintfmt+0x347>
+    switch (lflag) {
+  8007c8:	85 d2                	test   %edx,%edx
+  8007ca:	74 59                	je     800825 <vprintfmt+0x37e>
+  8007cc:	83 fa 01             	cmp    $0x1,%edx
+  8007cf:	74 7b                	je     80084c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d7:	0f 87 96 00 00 00    	ja     800873 <vprintfmt+0x3cc>
+  8007dd:	89 c2                	mov    %eax,%edx
+  8007df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e3:	83 c0 08             	add    $0x8,%eax
+  8007e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e9:	4c 8b 22             	mov    (%rdx),%r12
+  8007ec:	eb 17                	jmp    800805 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f4:	77 21                	ja     800817 <vprintfmt+0x370>
+  8007f6:	89 c2                	mov    %eax,%edx
+  8007f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fc:	83 c0 08             	add    $0x8,%eax
+  8007ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800802:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800805:	4d 85 e4             	test   %r12,%r12
+  800808:	78 7a                	js     800884 <vprintfmt+0x3dd>
+            num = i;
+  80080a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80080d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800812:	e9 50 02 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800817:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800823:	eb dd                	jmp    800802 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800825:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800828:	83 f8 2f             	cmp    $0x2f,%eax
+  80082b:	77 11                	ja     80083e <vprintfmt+0x397>
+  80082d:	89 c2                	mov    %eax,%edx
+  80082f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800833:	83 c0 08             	add    $0x8,%eax
+  800836:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800839:	4c 63 22             	movslq (%rdx),%r12
+  80083c:	eb c7                	jmp    800805 <vprintfmt+0x35e>
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	eb ed                	jmp    800839 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80084c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 11                	ja     800865 <vprintfmt+0x3be>
+  800854:	89 c2                	mov    %eax,%edx
+  800856:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085a:	83 c0 08             	add    $0x8,%eax
+  80085d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800860:	4c 8b 22             	mov    (%rdx),%r12
+  800863:	eb a0                	jmp    800805 <vprintfmt+0x35e>
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	eb ed                	jmp    800860 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	e9 65 ff ff ff       	jmp    8007e9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800884:	4c 89 ee             	mov    %r13,%rsi
+  800887:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80088c:	41 ff d6             	call   *%r14
+                i = -i;
+  80088f:	49 f7 dc             	neg    %r12
+  800892:	e9 73 ff ff ff       	jmp    80080a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800897:	40 84 f6             	test   %sil,%sil
+  80089a:	75 32                	jne    8008ce <vprintfmt+0x427>
+    switch (lflag) {
+  80089c:	85 d2                	test   %edx,%edx
+  80089e:	74 5d                	je     8008fd <vprintfmt+0x456>
+  8008a0:	83 fa 01             	cmp    $0x1,%edx
+  8008a3:	0f 84 82 00 00 00    	je     80092b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	0f 87 a5 00 00 00    	ja     80095a <vprintfmt+0x4b3>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c9:	e9 99 01 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d4:	77 19                	ja     8008ef <vprintfmt+0x448>
+  8008d6:	89 c2                	mov    %eax,%edx
+  8008d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dc:	83 c0 08             	add    $0x8,%eax
+  8008df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008ea:	e9 78 01 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb e5                	jmp    8008e2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 18                	ja     80091d <vprintfmt+0x476>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800913:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800918:	e9 4a 01 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+  80091d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800921:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800925:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800929:	eb e6                	jmp    800911 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80092b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092e:	83 f8 2f             	cmp    $0x2f,%eax
+  800931:	77 19                	ja     80094c <vprintfmt+0x4a5>
+  800933:	89 c2                	mov    %eax,%edx
+  800935:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800939:	83 c0 08             	add    $0x8,%eax
+  80093c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800942:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800947:	e9 1b 01 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	eb e5                	jmp    80093f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80095a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800966:	e9 56 ff ff ff       	jmp    8008c1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80096b:	40 84 f6             	test   %sil,%sil
+  80096e:	75 2e                	jne    80099e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 59                	je     8009cd <vprintfmt+0x526>
+  800974:	83 fa 01             	cmp    $0x1,%edx
+  800977:	74 7f                	je     8009f8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	0f 87 9f 00 00 00    	ja     800a24 <vprintfmt+0x57d>
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098b:	83 c0 08             	add    $0x8,%eax
+  80098e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800991:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800994:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800999:	e9 c9 00 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 19                	ja     8009bf <vprintfmt+0x518>
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ac:	83 c0 08             	add    $0x8,%eax
+  8009af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ba:	e9 a8 00 00 00       	jmp    800a67 <vprintfmt+0x5c0>
+  8009bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cb:	eb e5                	jmp    8009b2 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d3:	77 15                	ja     8009ea <vprintfmt+0x543>
+  8009d5:	89 c2                	mov    %eax,%edx
+  8009d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009db:	83 c0 08             	add    $0x8,%eax
+  8009de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009e3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e8:	eb 7d                	jmp    800a67 <vprintfmt+0x5c0>
+  8009ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f6:	eb e9                	jmp    8009e1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 16                	ja     800a16 <vprintfmt+0x56f>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a0f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a14:	eb 51                	jmp    800a67 <vprintfmt+0x5c0>
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	eb e8                	jmp    800a0c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a30:	e9 5c ff ff ff       	jmp    800991 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a35:	4c 89 ee             	mov    %r13,%rsi
+  800a38:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a3d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a40:	4c 89 ee             	mov    %r13,%rsi
+  800a43:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a48:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	77 47                	ja     800a9a <vprintfmt+0x5f3>
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a59:	83 c0 08             	add    $0x8,%eax
+  800a5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a62:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a67:	48 83 ec 08          	sub    $0x8,%rsp
+  800a6b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a6f:	0f 94 c0             	sete   %al
+  800a72:	0f b6 c0             	movzbl %al,%eax
+  800a75:	50                   	push   %rax
+  800a76:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a7b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a7f:	4c 89 ee             	mov    %r13,%rsi
+  800a82:	4c 89 f7             	mov    %r14,%rdi
+  800a85:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  800a8c:	00 00 00 
+  800a8f:	ff d0                	call   *%rax
+            break;
+  800a91:	48 83 c4 10          	add    $0x10,%rsp
+  800a95:	e9 3e fa ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa6:	eb b7                	jmp    800a5f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa8:	40 84 f6             	test   %sil,%sil
+  800aab:	75 2b                	jne    800ad8 <vprintfmt+0x631>
+    switch (lflag) {
+  800aad:	85 d2                	test   %edx,%edx
+  800aaf:	74 56                	je     800b07 <vprintfmt+0x660>
+  800ab1:	83 fa 01             	cmp    $0x1,%edx
+  800ab4:	74 7f                	je     800b35 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ab6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab9:	83 f8 2f             	cmp    $0x2f,%eax
+  800abc:	0f 87 a2 00 00 00    	ja     800b64 <vprintfmt+0x6bd>
+  800ac2:	89 c2                	mov    %eax,%edx
+  800ac4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac8:	83 c0 08             	add    $0x8,%eax
+  800acb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ace:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad6:	eb 8f                	jmp    800a67 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	77 19                	ja     800af9 <vprintfmt+0x652>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae6:	83 c0 08             	add    $0x8,%eax
+  800ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aef:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af4:	e9 6e ff ff ff       	jmp    800a67 <vprintfmt+0x5c0>
+  800af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b05:	eb e5                	jmp    800aec <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	77 18                	ja     800b27 <vprintfmt+0x680>
+  800b0f:	89 c2                	mov    %eax,%edx
+  800b11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b15:	83 c0 08             	add    $0x8,%eax
+  800b18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b22:	e9 40 ff ff ff       	jmp    800a67 <vprintfmt+0x5c0>
+  800b27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b33:	eb e6                	jmp    800b1b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b38:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3b:	77 19                	ja     800b56 <vprintfmt+0x6af>
+  800b3d:	89 c2                	mov    %eax,%edx
+  800b3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b43:	83 c0 08             	add    $0x8,%eax
+  800b46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b49:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b51:	e9 11 ff ff ff       	jmp    800a67 <vprintfmt+0x5c0>
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	eb e5                	jmp    800b49 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b70:	e9 59 ff ff ff       	jmp    800ace <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b75:	4c 89 ee             	mov    %r13,%rsi
+  800b78:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b7d:	41 ff d6             	call   *%r14
+            break;
+  800b80:	e9 53 f9 ff ff       	jmp    8004d8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b85:	4c 89 ee             	mov    %r13,%rsi
+  800b88:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b8d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b90:	48 83 eb 01          	sub    $0x1,%rbx
+  800b94:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b98:	75 f6                	jne    800b90 <vprintfmt+0x6e9>
+  800b9a:	e9 39 f9 ff ff       	jmp    8004d8 <vprintfmt+0x31>
+}
+  800b9f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ba3:	5b                   	pop    %rbx
+  800ba4:	41 5c                	pop    %r12
+  800ba6:	41 5d                	pop    %r13
+  800ba8:	41 5e                	pop    %r14
+  800baa:	41 5f                	pop    %r15
+  800bac:	5d                   	pop    %rbp
+  800bad:	c3                   	ret
+
+0000000000800bae <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bae:	55                   	push   %rbp
+  800baf:	48 89 e5             	mov    %rsp,%rbp
+  800bb2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bb6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bba:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bbf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bc3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bca:	48 85 ff             	test   %rdi,%rdi
+  800bcd:	74 2b                	je     800bfa <vsnprintf+0x4c>
+  800bcf:	48 85 f6             	test   %rsi,%rsi
+  800bd2:	74 26                	je     800bfa <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bd4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd8:	48 bf 52 04 80 00 00 	movabs $0x800452,%rdi
+  800bdf:	00 00 00 
+  800be2:	48 b8 a7 04 80 00 00 	movabs $0x8004a7,%rax
+  800be9:	00 00 00 
+  800bec:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bf5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bff:	eb f7                	jmp    800bf8 <vsnprintf+0x4a>
+
+0000000000800c01 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c01:	55                   	push   %rbp
+  800c02:	48 89 e5             	mov    %rsp,%rbp
+  800c05:	48 83 ec 50          	sub    $0x50,%rsp
+  800c09:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c0d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c11:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c15:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c24:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c28:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c2c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c30:	48 b8 ae 0b 80 00 00 	movabs $0x800bae,%rax
+  800c37:	00 00 00 
+  800c3a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c3c:	c9                   	leave
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c3e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c41:	74 10                	je     800c53 <strlen+0x15>
+    size_t n = 0;
+  800c43:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c48:	48 83 c0 01          	add    $0x1,%rax
+  800c4c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c50:	75 f6                	jne    800c48 <strlen+0xa>
+  800c52:	c3                   	ret
+    size_t n = 0;
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c58:	c3                   	ret
+
+0000000000800c59 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c59:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c61:	48 85 f6             	test   %rsi,%rsi
+  800c64:	74 11                	je     800c77 <strnlen+0x1e>
+  800c66:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c6a:	74 0c                	je     800c78 <strnlen+0x1f>
+  800c6c:	48 83 c2 01          	add    $0x1,%rdx
+  800c70:	48 39 d0             	cmp    %rdx,%rax
+  800c73:	75 f1                	jne    800c66 <strnlen+0xd>
+  800c75:	eb 04                	jmp    800c7b <strnlen+0x22>
+  800c77:	c3                   	ret
+  800c78:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c7b:	c3                   	ret
+
+0000000000800c7c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c7c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c84:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c88:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c8b:	48 83 c2 01          	add    $0x1,%rdx
+  800c8f:	84 c9                	test   %cl,%cl
+  800c91:	75 f1                	jne    800c84 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c93:	c3                   	ret
+
+0000000000800c94 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c94:	55                   	push   %rbp
+  800c95:	48 89 e5             	mov    %rsp,%rbp
+  800c98:	41 54                	push   %r12
+  800c9a:	53                   	push   %rbx
+  800c9b:	48 89 fb             	mov    %rdi,%rbx
+  800c9e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ca1:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  800ca8:	00 00 00 
+  800cab:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cad:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cb1:	4c 89 e6             	mov    %r12,%rsi
+  800cb4:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  800cbb:	00 00 00 
+  800cbe:	ff d0                	call   *%rax
+    return dst;
+}
+  800cc0:	48 89 d8             	mov    %rbx,%rax
+  800cc3:	5b                   	pop    %rbx
+  800cc4:	41 5c                	pop    %r12
+  800cc6:	5d                   	pop    %rbp
+  800cc7:	c3                   	ret
+
+0000000000800cc8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cc8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ccb:	48 85 d2             	test   %rdx,%rdx
+  800cce:	74 1f                	je     800cef <strncpy+0x27>
+  800cd0:	48 01 fa             	add    %rdi,%rdx
+  800cd3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cd6:	48 83 c1 01          	add    $0x1,%rcx
+  800cda:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cde:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ce2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ce6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cea:	48 39 ca             	cmp    %rcx,%rdx
+  800ced:	75 e7                	jne    800cd6 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cef:	c3                   	ret
+
+0000000000800cf0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cf0:	48 89 f8             	mov    %rdi,%rax
+  800cf3:	48 85 d2             	test   %rdx,%rdx
+  800cf6:	74 24                	je     800d1c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cf8:	48 83 ea 01          	sub    $0x1,%rdx
+  800cfc:	74 1b                	je     800d19 <strlcpy+0x29>
+  800cfe:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d02:	0f b6 16             	movzbl (%rsi),%edx
+  800d05:	84 d2                	test   %dl,%dl
+  800d07:	74 10                	je     800d19 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d09:	48 83 c6 01          	add    $0x1,%rsi
+  800d0d:	48 83 c0 01          	add    $0x1,%rax
+  800d11:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d14:	48 39 c8             	cmp    %rcx,%rax
+  800d17:	75 e9                	jne    800d02 <strlcpy+0x12>
+        *dst = '\0';
+  800d19:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d1c:	48 29 f8             	sub    %rdi,%rax
+}
+  800d1f:	c3                   	ret
+
+0000000000800d20 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d20:	0f b6 07             	movzbl (%rdi),%eax
+  800d23:	84 c0                	test   %al,%al
+  800d25:	74 13                	je     800d3a <strcmp+0x1a>
+  800d27:	38 06                	cmp    %al,(%rsi)
+  800d29:	75 0f                	jne    800d3a <strcmp+0x1a>
+  800d2b:	48 83 c7 01          	add    $0x1,%rdi
+  800d2f:	48 83 c6 01          	add    $0x1,%rsi
+  800d33:	0f b6 07             	movzbl (%rdi),%eax
+  800d36:	84 c0                	test   %al,%al
+  800d38:	75 ed                	jne    800d27 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d3a:	0f b6 c0             	movzbl %al,%eax
+  800d3d:	0f b6 16             	movzbl (%rsi),%edx
+  800d40:	29 d0                	sub    %edx,%eax
+}
+  800d42:	c3                   	ret
+
+0000000000800d43 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d43:	48 85 d2             	test   %rdx,%rdx
+  800d46:	74 1f                	je     800d67 <strncmp+0x24>
+  800d48:	0f b6 07             	movzbl (%rdi),%eax
+  800d4b:	84 c0                	test   %al,%al
+  800d4d:	74 1e                	je     800d6d <strncmp+0x2a>
+  800d4f:	3a 06                	cmp    (%rsi),%al
+  800d51:	75 1a                	jne    800d6d <strncmp+0x2a>
+  800d53:	48 83 c7 01          	add    $0x1,%rdi
+  800d57:	48 83 c6 01          	add    $0x1,%rsi
+  800d5b:	48 83 ea 01          	sub    $0x1,%rdx
+  800d5f:	75 e7                	jne    800d48 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d66:	c3                   	ret
+  800d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6c:	c3                   	ret
+  800d6d:	48 85 d2             	test   %rdx,%rdx
+  800d70:	74 09                	je     800d7b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d72:	0f b6 07             	movzbl (%rdi),%eax
+  800d75:	0f b6 16             	movzbl (%rsi),%edx
+  800d78:	29 d0                	sub    %edx,%eax
+  800d7a:	c3                   	ret
+    if (!n) return 0;
+  800d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d80:	c3                   	ret
+
+0000000000800d81 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d81:	0f b6 17             	movzbl (%rdi),%edx
+  800d84:	84 d2                	test   %dl,%dl
+  800d86:	74 18                	je     800da0 <strchr+0x1f>
+        if (*str == c) {
+  800d88:	0f be d2             	movsbl %dl,%edx
+  800d8b:	39 f2                	cmp    %esi,%edx
+  800d8d:	74 17                	je     800da6 <strchr+0x25>
+    for (; *str; str++) {
+  800d8f:	48 83 c7 01          	add    $0x1,%rdi
+  800d93:	0f b6 17             	movzbl (%rdi),%edx
+  800d96:	84 d2                	test   %dl,%dl
+  800d98:	75 ee                	jne    800d88 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9f:	c3                   	ret
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da5:	c3                   	ret
+  800da6:	48 89 f8             	mov    %rdi,%rax
+}
+  800da9:	c3                   	ret
+
+0000000000800daa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800daa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dad:	0f b6 17             	movzbl (%rdi),%edx
+  800db0:	84 d2                	test   %dl,%dl
+  800db2:	74 13                	je     800dc7 <strfind+0x1d>
+  800db4:	0f be d2             	movsbl %dl,%edx
+  800db7:	39 f2                	cmp    %esi,%edx
+  800db9:	74 0b                	je     800dc6 <strfind+0x1c>
+  800dbb:	48 83 c0 01          	add    $0x1,%rax
+  800dbf:	0f b6 10             	movzbl (%rax),%edx
+  800dc2:	84 d2                	test   %dl,%dl
+  800dc4:	75 ee                	jne    800db4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dc6:	c3                   	ret
+  800dc7:	c3                   	ret
+
+0000000000800dc8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dc8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dcb:	48 89 f8             	mov    %rdi,%rax
+  800dce:	48 f7 d8             	neg    %rax
+  800dd1:	83 e0 07             	and    $0x7,%eax
+  800dd4:	49 89 d1             	mov    %rdx,%r9
+  800dd7:	49 29 c1             	sub    %rax,%r9
+  800dda:	78 36                	js     800e12 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ddc:	40 0f b6 c6          	movzbl %sil,%eax
+  800de0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800de7:	01 01 01 
+  800dea:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dee:	40 f6 c7 07          	test   $0x7,%dil
+  800df2:	75 38                	jne    800e2c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800df4:	4c 89 c9             	mov    %r9,%rcx
+  800df7:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dfb:	74 0c                	je     800e09 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dfd:	fc                   	cld
+  800dfe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e01:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e05:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e09:	4d 85 c9             	test   %r9,%r9
+  800e0c:	75 45                	jne    800e53 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e0e:	4c 89 c0             	mov    %r8,%rax
+  800e11:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e12:	48 85 d2             	test   %rdx,%rdx
+  800e15:	74 f7                	je     800e0e <memset+0x46>
+  800e17:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e1a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e1d:	48 83 c0 01          	add    $0x1,%rax
+  800e21:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e25:	48 39 c2             	cmp    %rax,%rdx
+  800e28:	75 f3                	jne    800e1d <memset+0x55>
+  800e2a:	eb e2                	jmp    800e0e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e2c:	40 f6 c7 01          	test   $0x1,%dil
+  800e30:	74 06                	je     800e38 <memset+0x70>
+  800e32:	88 07                	mov    %al,(%rdi)
+  800e34:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e38:	40 f6 c7 02          	test   $0x2,%dil
+  800e3c:	74 07                	je     800e45 <memset+0x7d>
+  800e3e:	66 89 07             	mov    %ax,(%rdi)
+  800e41:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e45:	40 f6 c7 04          	test   $0x4,%dil
+  800e49:	74 a9                	je     800df4 <memset+0x2c>
+  800e4b:	89 07                	mov    %eax,(%rdi)
+  800e4d:	48 83 c7 04          	add    $0x4,%rdi
+  800e51:	eb a1                	jmp    800df4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e53:	41 f6 c1 04          	test   $0x4,%r9b
+  800e57:	74 06                	je     800e5f <memset+0x97>
+  800e59:	89 07                	mov    %eax,(%rdi)
+  800e5b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5f:	41 f6 c1 02          	test   $0x2,%r9b
+  800e63:	74 07                	je     800e6c <memset+0xa4>
+  800e65:	66 89 07             	mov    %ax,(%rdi)
+  800e68:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e6c:	41 f6 c1 01          	test   $0x1,%r9b
+  800e70:	74 9c                	je     800e0e <memset+0x46>
+  800e72:	88 07                	mov    %al,(%rdi)
+  800e74:	eb 98                	jmp    800e0e <memset+0x46>
+
+0000000000800e76 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e76:	48 89 f8             	mov    %rdi,%rax
+  800e79:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e7c:	48 39 fe             	cmp    %rdi,%rsi
+  800e7f:	73 3b                	jae    800ebc <memmove+0x46>
+  800e81:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e85:	48 39 d7             	cmp    %rdx,%rdi
+  800e88:	73 32                	jae    800ebc <memmove+0x46>
+        s += n;
+        d += n;
+  800e8a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e8e:	48 89 d6             	mov    %rdx,%rsi
+  800e91:	48 09 fe             	or     %rdi,%rsi
+  800e94:	48 09 ce             	or     %rcx,%rsi
+  800e97:	40 f6 c6 07          	test   $0x7,%sil
+  800e9b:	75 12                	jne    800eaf <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e9d:	48 83 ef 08          	sub    $0x8,%rdi
+  800ea1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ea5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea9:	fd                   	std
+  800eaa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ead:	fc                   	cld
+  800eae:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800eaf:	48 83 ef 01          	sub    $0x1,%rdi
+  800eb3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800eb7:	fd                   	std
+  800eb8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eba:	eb f1                	jmp    800ead <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ebc:	48 89 f2             	mov    %rsi,%rdx
+  800ebf:	48 09 c2             	or     %rax,%rdx
+  800ec2:	48 09 ca             	or     %rcx,%rdx
+  800ec5:	f6 c2 07             	test   $0x7,%dl
+  800ec8:	75 0c                	jne    800ed6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800eca:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ece:	48 89 c7             	mov    %rax,%rdi
+  800ed1:	fc                   	cld
+  800ed2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ed5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ed6:	48 89 c7             	mov    %rax,%rdi
+  800ed9:	fc                   	cld
+  800eda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800edc:	c3                   	ret
+
+0000000000800edd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800edd:	55                   	push   %rbp
+  800ede:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ee1:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  800ee8:	00 00 00 
+  800eeb:	ff d0                	call   *%rax
+}
+  800eed:	5d                   	pop    %rbp
+  800eee:	c3                   	ret
+
+0000000000800eef <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+  800ef3:	41 57                	push   %r15
+  800ef5:	41 56                	push   %r14
+  800ef7:	41 55                	push   %r13
+  800ef9:	41 54                	push   %r12
+  800efb:	53                   	push   %rbx
+  800efc:	48 83 ec 08          	sub    $0x8,%rsp
+  800f00:	49 89 fe             	mov    %rdi,%r14
+  800f03:	49 89 f7             	mov    %rsi,%r15
+  800f06:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f09:	48 89 f7             	mov    %rsi,%rdi
+  800f0c:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  800f13:	00 00 00 
+  800f16:	ff d0                	call   *%rax
+  800f18:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f1b:	48 89 de             	mov    %rbx,%rsi
+  800f1e:	4c 89 f7             	mov    %r14,%rdi
+  800f21:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  800f28:	00 00 00 
+  800f2b:	ff d0                	call   *%rax
+  800f2d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f30:	48 39 c3             	cmp    %rax,%rbx
+  800f33:	74 36                	je     800f6b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f35:	48 89 d8             	mov    %rbx,%rax
+  800f38:	4c 29 e8             	sub    %r13,%rax
+  800f3b:	49 39 c4             	cmp    %rax,%r12
+  800f3e:	73 31                	jae    800f71 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f40:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f45:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f49:	4c 89 fe             	mov    %r15,%rsi
+  800f4c:	48 b8 dd 0e 80 00 00 	movabs $0x800edd,%rax
+  800f53:	00 00 00 
+  800f56:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f58:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f5c:	48 83 c4 08          	add    $0x8,%rsp
+  800f60:	5b                   	pop    %rbx
+  800f61:	41 5c                	pop    %r12
+  800f63:	41 5d                	pop    %r13
+  800f65:	41 5e                	pop    %r14
+  800f67:	41 5f                	pop    %r15
+  800f69:	5d                   	pop    %rbp
+  800f6a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f6b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f6f:	eb eb                	jmp    800f5c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f71:	48 83 eb 01          	sub    $0x1,%rbx
+  800f75:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f79:	48 89 da             	mov    %rbx,%rdx
+  800f7c:	4c 89 fe             	mov    %r15,%rsi
+  800f7f:	48 b8 dd 0e 80 00 00 	movabs $0x800edd,%rax
+  800f86:	00 00 00 
+  800f89:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f8b:	49 01 de             	add    %rbx,%r14
+  800f8e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f93:	eb c3                	jmp    800f58 <strlcat+0x69>
+
+0000000000800f95 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f95:	48 85 d2             	test   %rdx,%rdx
+  800f98:	74 2d                	je     800fc7 <memcmp+0x32>
+  800f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f9f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fa3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fa8:	44 38 c1             	cmp    %r8b,%cl
+  800fab:	75 0f                	jne    800fbc <memcmp+0x27>
+    while (n-- > 0) {
+  800fad:	48 83 c0 01          	add    $0x1,%rax
+  800fb1:	48 39 c2             	cmp    %rax,%rdx
+  800fb4:	75 e9                	jne    800f9f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fbc:	0f b6 c1             	movzbl %cl,%eax
+  800fbf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fc3:	44 29 c0             	sub    %r8d,%eax
+  800fc6:	c3                   	ret
+    return 0;
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fcc:	c3                   	ret
+
+0000000000800fcd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fcd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fd1:	48 39 c7             	cmp    %rax,%rdi
+  800fd4:	73 0f                	jae    800fe5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fd6:	40 38 37             	cmp    %sil,(%rdi)
+  800fd9:	74 0e                	je     800fe9 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fdb:	48 83 c7 01          	add    $0x1,%rdi
+  800fdf:	48 39 f8             	cmp    %rdi,%rax
+  800fe2:	75 f2                	jne    800fd6 <memfind+0x9>
+  800fe4:	c3                   	ret
+  800fe5:	48 89 f8             	mov    %rdi,%rax
+  800fe8:	c3                   	ret
+  800fe9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fec:	c3                   	ret
+
+0000000000800fed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fed:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ff0:	0f b6 37             	movzbl (%rdi),%esi
+  800ff3:	40 80 fe 20          	cmp    $0x20,%sil
+  800ff7:	74 06                	je     800fff <strtol+0x12>
+  800ff9:	40 80 fe 09          	cmp    $0x9,%sil
+  800ffd:	75 13                	jne    801012 <strtol+0x25>
+  800fff:	48 83 c7 01          	add    $0x1,%rdi
+  801003:	0f b6 37             	movzbl (%rdi),%esi
+  801006:	40 80 fe 20          	cmp    $0x20,%sil
+  80100a:	74 f3                	je     800fff <strtol+0x12>
+  80100c:	40 80 fe 09          	cmp    $0x9,%sil
+  801010:	74 ed                	je     800fff <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801012:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801015:	83 e0 fd             	and    $0xfffffffd,%eax
+  801018:	3c 01                	cmp    $0x1,%al
+  80101a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80101e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801024:	75 0f                	jne    801035 <strtol+0x48>
+  801026:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801029:	74 14                	je     80103f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80102b:	85 d2                	test   %edx,%edx
+  80102d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801032:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80103a:	4c 63 ca             	movslq %edx,%r9
+  80103d:	eb 36                	jmp    801075 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80103f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801043:	74 0f                	je     801054 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801045:	85 d2                	test   %edx,%edx
+  801047:	75 ec                	jne    801035 <strtol+0x48>
+        s++;
+  801049:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80104d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801052:	eb e1                	jmp    801035 <strtol+0x48>
+        s += 2;
+  801054:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801058:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80105d:	eb d6                	jmp    801035 <strtol+0x48>
+            dig -= '0';
+  80105f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801062:	44 0f b6 c1          	movzbl %cl,%r8d
+  801066:	41 39 d0             	cmp    %edx,%r8d
+  801069:	7d 21                	jge    80108c <strtol+0x9f>
+        val = val * base + dig;
+  80106b:	49 0f af c1          	imul   %r9,%rax
+  80106f:	0f b6 c9             	movzbl %cl,%ecx
+  801072:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801075:	48 83 c7 01          	add    $0x1,%rdi
+  801079:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80107d:	80 f9 39             	cmp    $0x39,%cl
+  801080:	76 dd                	jbe    80105f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801082:	80 f9 7b             	cmp    $0x7b,%cl
+  801085:	77 05                	ja     80108c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801087:	83 e9 57             	sub    $0x57,%ecx
+  80108a:	eb d6                	jmp    801062 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80108c:	4d 85 d2             	test   %r10,%r10
+  80108f:	74 03                	je     801094 <strtol+0xa7>
+  801091:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801094:	48 89 c2             	mov    %rax,%rdx
+  801097:	48 f7 da             	neg    %rdx
+  80109a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80109e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010a2:	c3                   	ret
+
+00000000008010a3 <strrev>:
+
+void
+strrev(char *str)
+{
+  8010a3:	55                   	push   %rbp
+  8010a4:	48 89 e5             	mov    %rsp,%rbp
+  8010a7:	53                   	push   %rbx
+  8010a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ac:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8010af:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8010b6:	00 00 00 
+  8010b9:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010bb:	83 e8 01             	sub    $0x1,%eax
+  8010be:	85 c0                	test   %eax,%eax
+  8010c0:	7e 22                	jle    8010e4 <strrev+0x41>
+  8010c2:	48 98                	cltq
+  8010c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010c9:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010cd:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010d1:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010d5:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010d8:	48 83 c2 01          	add    $0x1,%rdx
+  8010dc:	48 83 e8 01          	sub    $0x1,%rax
+  8010e0:	39 c2                	cmp    %eax,%edx
+  8010e2:	7c e5                	jl     8010c9 <strrev+0x26>
+	}
+}
+  8010e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e8:	c9                   	leave
+  8010e9:	c3                   	ret
+
+00000000008010ea <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8010ea:	85 d2                	test   %edx,%edx
+  8010ec:	0f 84 80 00 00 00    	je     801172 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	53                   	push   %rbx
+  8010f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8010fb:	49 89 f2             	mov    %rsi,%r10
+  8010fe:	41 89 d3             	mov    %edx,%r11d
+  801101:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801104:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801109:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80110c:	eb 20                	jmp    80112e <itoa+0x44>
+			str[i++] = '0' + digit;
+  80110e:	41 89 f1             	mov    %esi,%r9d
+  801111:	83 c2 30             	add    $0x30,%edx
+  801114:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801117:	89 f8                	mov    %edi,%eax
+  801119:	99                   	cltd
+  80111a:	f7 f9                	idiv   %ecx
+  80111c:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	74 2e                	je     801150 <itoa+0x66>
+  801122:	83 c6 01             	add    $0x1,%esi
+  801125:	49 83 c0 01          	add    $0x1,%r8
+  801129:	44 39 cb             	cmp    %r9d,%ebx
+  80112c:	7e 15                	jle    801143 <itoa+0x59>
+		digit = sum % base;
+  80112e:	89 f8                	mov    %edi,%eax
+  801130:	99                   	cltd
+  801131:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801133:	83 fa 09             	cmp    $0x9,%edx
+  801136:	7e d6                	jle    80110e <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801138:	41 89 f1             	mov    %esi,%r9d
+  80113b:	83 c2 37             	add    $0x37,%edx
+  80113e:	41 88 10             	mov    %dl,(%r8)
+  801141:	eb d4                	jmp    801117 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801143:	41 83 eb 01          	sub    $0x1,%r11d
+  801147:	45 39 cb             	cmp    %r9d,%r11d
+  80114a:	75 04                	jne    801150 <itoa+0x66>
+  80114c:	85 c0                	test   %eax,%eax
+  80114e:	75 28                	jne    801178 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801150:	4d 63 c9             	movslq %r9d,%r9
+  801153:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801158:	4c 89 d7             	mov    %r10,%rdi
+  80115b:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  801162:	00 00 00 
+  801165:	ff d0                	call   *%rax
+	return 0;
+  801167:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801170:	c9                   	leave
+  801171:	c3                   	ret
+		return -1;
+  801172:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801177:	c3                   	ret
+		return -1;
+  801178:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80117d:	eb ed                	jmp    80116c <itoa+0x82>
+
+000000000080117f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80117f:	55                   	push   %rbp
+  801180:	48 89 e5             	mov    %rsp,%rbp
+  801183:	53                   	push   %rbx
+  801184:	48 89 fa             	mov    %rdi,%rdx
+  801187:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80118a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801199:	be 00 00 00 00       	mov    $0x0,%esi
+  80119e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011aa:	c9                   	leave
+  8011ab:	c3                   	ret
+
+00000000008011ac <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011ac:	55                   	push   %rbp
+  8011ad:	48 89 e5             	mov    %rsp,%rbp
+  8011b0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d5:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011db:	c9                   	leave
+  8011dc:	c3                   	ret
+
+00000000008011dd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011dd:	55                   	push   %rbp
+  8011de:	48 89 e5             	mov    %rsp,%rbp
+  8011e1:	53                   	push   %rbx
+  8011e2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011e6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e9:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801208:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120a:	48 85 c0             	test   %rax,%rax
+  80120d:	7f 06                	jg     801215 <sys_env_destroy+0x38>
+}
+  80120f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801215:	49 89 c0             	mov    %rax,%r8
+  801218:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80121d:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  801224:	00 00 00 
+  801227:	be 26 00 00 00       	mov    $0x26,%esi
+  80122c:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  801233:	00 00 00 
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123b:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801242:	00 00 00 
+  801245:	41 ff d1             	call   *%r9
+
+0000000000801248 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801248:	55                   	push   %rbp
+  801249:	48 89 e5             	mov    %rsp,%rbp
+  80124c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80124d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801252:	ba 00 00 00 00       	mov    $0x0,%edx
+  801257:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801266:	be 00 00 00 00       	mov    $0x0,%esi
+  80126b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801271:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801273:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801277:	c9                   	leave
+  801278:	c3                   	ret
+
+0000000000801279 <sys_yield>:
+
+void
+sys_yield(void) {
+  801279:	55                   	push   %rbp
+  80127a:	48 89 e5             	mov    %rsp,%rbp
+  80127d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80127e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801283:	ba 00 00 00 00       	mov    $0x0,%edx
+  801288:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801292:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a2:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+
+00000000008012aa <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012aa:	55                   	push   %rbp
+  8012ab:	48 89 e5             	mov    %rsp,%rbp
+  8012ae:	53                   	push   %rbx
+  8012af:	48 89 fa             	mov    %rdi,%rdx
+  8012b2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ba:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012c1:	00 00 00 
+  8012c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+
+00000000008012dc <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+  8012e0:	53                   	push   %rbx
+  8012e1:	49 89 f8             	mov    %rdi,%r8
+  8012e4:	48 89 d3             	mov    %rdx,%rbx
+  8012e7:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ea:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ef:	4c 89 c2             	mov    %r8,%rdx
+  8012f2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801300:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+0000000000801308 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	48 83 ec 08          	sub    $0x8,%rsp
+  801311:	89 f8                	mov    %edi,%eax
+  801313:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801316:	48 63 f9             	movslq %ecx,%rdi
+  801319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801321:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801331:	48 85 c0             	test   %rax,%rax
+  801334:	7f 06                	jg     80133c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133c:	49 89 c0             	mov    %rax,%r8
+  80133f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801344:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  80134b:	00 00 00 
+  80134e:	be 26 00 00 00       	mov    $0x26,%esi
+  801353:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  80135a:	00 00 00 
+  80135d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801362:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801369:	00 00 00 
+  80136c:	41 ff d1             	call   *%r9
+
+000000000080136f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80136f:	55                   	push   %rbp
+  801370:	48 89 e5             	mov    %rsp,%rbp
+  801373:	53                   	push   %rbx
+  801374:	48 83 ec 08          	sub    $0x8,%rsp
+  801378:	89 f8                	mov    %edi,%eax
+  80137a:	49 89 f2             	mov    %rsi,%r10
+  80137d:	48 89 cf             	mov    %rcx,%rdi
+  801380:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801383:	48 63 da             	movslq %edx,%rbx
+  801386:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801389:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801391:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801394:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801396:	48 85 c0             	test   %rax,%rax
+  801399:	7f 06                	jg     8013a1 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80139b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139f:	c9                   	leave
+  8013a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a1:	49 89 c0             	mov    %rax,%r8
+  8013a4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013a9:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  8013b0:	00 00 00 
+  8013b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b8:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  8013bf:	00 00 00 
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c7:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  8013ce:	00 00 00 
+  8013d1:	41 ff d1             	call   *%r9
+
+00000000008013d4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013d4:	55                   	push   %rbp
+  8013d5:	48 89 e5             	mov    %rsp,%rbp
+  8013d8:	53                   	push   %rbx
+  8013d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013dd:	48 89 f1             	mov    %rsi,%rcx
+  8013e0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013fd:	48 85 c0             	test   %rax,%rax
+  801400:	7f 06                	jg     801408 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801402:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801408:	49 89 c0             	mov    %rax,%r8
+  80140b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801410:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  801417:	00 00 00 
+  80141a:	be 26 00 00 00       	mov    $0x26,%esi
+  80141f:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  801426:	00 00 00 
+  801429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142e:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801435:	00 00 00 
+  801438:	41 ff d1             	call   *%r9
+
+000000000080143b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80143b:	55                   	push   %rbp
+  80143c:	48 89 e5             	mov    %rsp,%rbp
+  80143f:	53                   	push   %rbx
+  801440:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801444:	48 63 ce             	movslq %esi,%rcx
+  801447:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801459:	be 00 00 00 00       	mov    $0x0,%esi
+  80145e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801464:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801466:	48 85 c0             	test   %rax,%rax
+  801469:	7f 06                	jg     801471 <sys_env_set_status+0x36>
+}
+  80146b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801471:	49 89 c0             	mov    %rax,%r8
+  801474:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801479:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  801480:	00 00 00 
+  801483:	be 26 00 00 00       	mov    $0x26,%esi
+  801488:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  80148f:	00 00 00 
+  801492:	b8 00 00 00 00       	mov    $0x0,%eax
+  801497:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  80149e:	00 00 00 
+  8014a1:	41 ff d1             	call   *%r9
+
+00000000008014a4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+  8014a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cf:	48 85 c0             	test   %rax,%rax
+  8014d2:	7f 06                	jg     8014da <sys_env_set_trapframe+0x36>
+}
+  8014d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d8:	c9                   	leave
+  8014d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014da:	49 89 c0             	mov    %rax,%r8
+  8014dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014e2:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  8014e9:	00 00 00 
+  8014ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f1:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  8014f8:	00 00 00 
+  8014fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801500:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801507:	00 00 00 
+  80150a:	41 ff d1             	call   *%r9
+
+000000000080150d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	53                   	push   %rbx
+  801512:	48 83 ec 08          	sub    $0x8,%rsp
+  801516:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801519:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80151c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152b:	be 00 00 00 00       	mov    $0x0,%esi
+  801530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801536:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801538:	48 85 c0             	test   %rax,%rax
+  80153b:	7f 06                	jg     801543 <sys_env_set_pgfault_upcall+0x36>
+}
+  80153d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801543:	49 89 c0             	mov    %rax,%r8
+  801546:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80154b:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  801552:	00 00 00 
+  801555:	be 26 00 00 00       	mov    $0x26,%esi
+  80155a:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  801561:	00 00 00 
+  801564:	b8 00 00 00 00       	mov    $0x0,%eax
+  801569:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801570:	00 00 00 
+  801573:	41 ff d1             	call   *%r9
+
+0000000000801576 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801576:	55                   	push   %rbp
+  801577:	48 89 e5             	mov    %rsp,%rbp
+  80157a:	53                   	push   %rbx
+  80157b:	89 f8                	mov    %edi,%eax
+  80157d:	49 89 f1             	mov    %rsi,%r9
+  801580:	48 89 d3             	mov    %rdx,%rbx
+  801583:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801586:	49 63 f0             	movslq %r8d,%rsi
+  801589:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801591:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159a:	cd 30                	int    $0x30
+}
+  80159c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+
+00000000008015a2 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8015a2:	55                   	push   %rbp
+  8015a3:	48 89 e5             	mov    %rsp,%rbp
+  8015a6:	53                   	push   %rbx
+  8015a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ab:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8015ae:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b6:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015be:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015cb:	48 85 c0             	test   %rax,%rax
+  8015ce:	7f 06                	jg     8015d6 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d6:	49 89 c0             	mov    %rax,%r8
+  8015d9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015de:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  8015e5:	00 00 00 
+  8015e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ed:	48 bf c7 3f 80 00 00 	movabs $0x803fc7,%rdi
+  8015f4:	00 00 00 
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	49 b9 e3 36 80 00 00 	movabs $0x8036e3,%r9
+  801603:	00 00 00 
+  801606:	41 ff d1             	call   *%r9
+
+0000000000801609 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801609:	55                   	push   %rbp
+  80160a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80160d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801612:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+}
+  80161e:	5d                   	pop    %rbp
+  80161f:	c3                   	ret
+
+0000000000801620 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801620:	55                   	push   %rbp
+  801621:	48 89 e5             	mov    %rsp,%rbp
+  801624:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80162a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801634:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801639:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163e:	be 00 00 00 00       	mov    $0x0,%esi
+  801643:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801649:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80164b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164f:	c9                   	leave
+  801650:	c3                   	ret
+
+0000000000801651 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801651:	55                   	push   %rbp
+  801652:	48 89 e5             	mov    %rsp,%rbp
+  801655:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801656:	48 63 ce             	movslq %esi,%rcx
+  801659:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+}
+  801679:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+
+000000000080167f <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80167f:	55                   	push   %rbp
+  801680:	48 89 e5             	mov    %rsp,%rbp
+  801683:	53                   	push   %rbx
+  801684:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801687:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80168b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801690:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801695:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169a:	be 00 00 00 00       	mov    $0x0,%esi
+  80169f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a5:	cd 30                	int    $0x30
+}
+  8016a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+00000000008016ad <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8016ad:	55                   	push   %rbp
+  8016ae:	48 89 e5             	mov    %rsp,%rbp
+  8016b1:	53                   	push   %rbx
+  8016b2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8016b5:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016bd:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d0:	cd 30                	int    $0x30
+}
+  8016d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d6:	c9                   	leave
+  8016d7:	c3                   	ret
+
+00000000008016d8 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  8016d8:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  8016db:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  8016df:	83 3f 01             	cmpl   $0x1,(%rdi)
+  8016e2:	7e 0f                	jle    8016f3 <argstart+0x1b>
+  8016e4:	48 b8 69 3a 80 00 00 	movabs $0x803a69,%rax
+  8016eb:	00 00 00 
+  8016ee:	48 85 f6             	test   %rsi,%rsi
+  8016f1:	75 05                	jne    8016f8 <argstart+0x20>
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  8016fc:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801703:	00 
+}
+  801704:	c3                   	ret
+
+0000000000801705 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801705:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  80170c:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  80170d:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801711:	48 85 c0             	test   %rax,%rax
+  801714:	0f 84 8f 00 00 00    	je     8017a9 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+  80171e:	53                   	push   %rbx
+  80171f:	48 83 ec 08          	sub    $0x8,%rsp
+  801723:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801726:	80 38 00             	cmpb   $0x0,(%rax)
+  801729:	75 52                	jne    80177d <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  80172b:	48 8b 17             	mov    (%rdi),%rdx
+  80172e:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801731:	74 67                	je     80179a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801733:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801737:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80173b:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80173e:	75 5a                	jne    80179a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801740:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801744:	74 54                	je     80179a <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801746:	48 83 c0 01          	add    $0x1,%rax
+  80174a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80174e:	8b 12                	mov    (%rdx),%edx
+  801750:	83 ea 01             	sub    $0x1,%edx
+  801753:	48 63 d2             	movslq %edx,%rdx
+  801756:	48 c1 e2 03          	shl    $0x3,%rdx
+  80175a:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80175e:	48 83 c7 08          	add    $0x8,%rdi
+  801762:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  801769:	00 00 00 
+  80176c:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80176e:	48 8b 03             	mov    (%rbx),%rax
+  801771:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801774:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801778:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80177b:	74 17                	je     801794 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80177d:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801781:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801784:	48 83 c0 01          	add    $0x1,%rax
+  801788:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80178c:	89 d0                	mov    %edx,%eax
+  80178e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801794:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801798:	75 e3                	jne    80177d <argnext+0x78>
+    args->curarg = 0;
+  80179a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8017a1:	00 
+    return -1;
+  8017a2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8017a7:	eb e3                	jmp    80178c <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  8017a9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  8017ae:	89 d0                	mov    %edx,%eax
+  8017b0:	c3                   	ret
+
+00000000008017b1 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  8017b1:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8017b5:	48 85 c0             	test   %rax,%rax
+  8017b8:	74 7b                	je     801835 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  8017ba:	55                   	push   %rbp
+  8017bb:	48 89 e5             	mov    %rsp,%rbp
+  8017be:	53                   	push   %rbx
+  8017bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c3:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  8017c6:	80 38 00             	cmpb   $0x0,(%rax)
+  8017c9:	74 1c                	je     8017e7 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  8017cb:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  8017cf:	48 b8 69 3a 80 00 00 	movabs $0x803a69,%rax
+  8017d6:	00 00 00 
+  8017d9:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  8017dd:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8017e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8017e7:	48 8b 07             	mov    (%rdi),%rax
+  8017ea:	83 38 01             	cmpl   $0x1,(%rax)
+  8017ed:	7f 12                	jg     801801 <argnextvalue+0x50>
+        args->argvalue = 0;
+  8017ef:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8017f6:	00 
+        args->curarg = 0;
+  8017f7:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8017fe:	00 
+  8017ff:	eb dc                	jmp    8017dd <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801801:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801805:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801809:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80180d:	8b 10                	mov    (%rax),%edx
+  80180f:	83 ea 01             	sub    $0x1,%edx
+  801812:	48 63 d2             	movslq %edx,%rdx
+  801815:	48 c1 e2 03          	shl    $0x3,%rdx
+  801819:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80181d:	48 83 c7 08          	add    $0x8,%rdi
+  801821:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  801828:	00 00 00 
+  80182b:	ff d0                	call   *%rax
+        (*args->argc)--;
+  80182d:	48 8b 03             	mov    (%rbx),%rax
+  801830:	83 28 01             	subl   $0x1,(%rax)
+  801833:	eb a8                	jmp    8017dd <argnextvalue+0x2c>
+}
+  801835:	c3                   	ret
+
+0000000000801836 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801836:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80183a:	48 85 c0             	test   %rax,%rax
+  80183d:	74 01                	je     801840 <argvalue+0xa>
+}
+  80183f:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801844:	48 b8 b1 17 80 00 00 	movabs $0x8017b1,%rax
+  80184b:	00 00 00 
+  80184e:	ff d0                	call   *%rax
+}
+  801850:	5d                   	pop    %rbp
+  801851:	c3                   	ret
+
+0000000000801852 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801852:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801859:	ff ff ff 
+  80185c:	48 01 f8             	add    %rdi,%rax
+  80185f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801863:	c3                   	ret
+
+0000000000801864 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801864:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80186b:	ff ff ff 
+  80186e:	48 01 f8             	add    %rdi,%rax
+  801871:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801875:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80187b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80187f:	c3                   	ret
+
+0000000000801880 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801880:	55                   	push   %rbp
+  801881:	48 89 e5             	mov    %rsp,%rbp
+  801884:	41 57                	push   %r15
+  801886:	41 56                	push   %r14
+  801888:	41 55                	push   %r13
+  80188a:	41 54                	push   %r12
+  80188c:	53                   	push   %rbx
+  80188d:	48 83 ec 08          	sub    $0x8,%rsp
+  801891:	49 89 ff             	mov    %rdi,%r15
+  801894:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801899:	49 bd 9f 33 80 00 00 	movabs $0x80339f,%r13
+  8018a0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018a3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018a9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018ac:	48 89 df             	mov    %rbx,%rdi
+  8018af:	41 ff d5             	call   *%r13
+  8018b2:	83 e0 04             	and    $0x4,%eax
+  8018b5:	74 17                	je     8018ce <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018be:	4c 39 f3             	cmp    %r14,%rbx
+  8018c1:	75 e6                	jne    8018a9 <fd_alloc+0x29>
+  8018c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018c9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018ce:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018d1:	48 83 c4 08          	add    $0x8,%rsp
+  8018d5:	5b                   	pop    %rbx
+  8018d6:	41 5c                	pop    %r12
+  8018d8:	41 5d                	pop    %r13
+  8018da:	41 5e                	pop    %r14
+  8018dc:	41 5f                	pop    %r15
+  8018de:	5d                   	pop    %rbp
+  8018df:	c3                   	ret
+
+00000000008018e0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018e0:	83 ff 1f             	cmp    $0x1f,%edi
+  8018e3:	77 39                	ja     80191e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	41 54                	push   %r12
+  8018eb:	53                   	push   %rbx
+  8018ec:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018ef:	48 63 df             	movslq %edi,%rbx
+  8018f2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018f9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018fd:	48 89 df             	mov    %rbx,%rdi
+  801900:	48 b8 9f 33 80 00 00 	movabs $0x80339f,%rax
+  801907:	00 00 00 
+  80190a:	ff d0                	call   *%rax
+  80190c:	a8 04                	test   $0x4,%al
+  80190e:	74 14                	je     801924 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801910:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801914:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801919:	5b                   	pop    %rbx
+  80191a:	41 5c                	pop    %r12
+  80191c:	5d                   	pop    %rbp
+  80191d:	c3                   	ret
+        return -E_INVAL;
+  80191e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801923:	c3                   	ret
+        return -E_INVAL;
+  801924:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801929:	eb ee                	jmp    801919 <fd_lookup+0x39>
+
+000000000080192b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80192b:	55                   	push   %rbp
+  80192c:	48 89 e5             	mov    %rsp,%rbp
+  80192f:	41 54                	push   %r12
+  801931:	53                   	push   %rbx
+  801932:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801935:	48 b8 80 40 80 00 00 	movabs $0x804080,%rax
+  80193c:	00 00 00 
+  80193f:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801946:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801949:	39 3b                	cmp    %edi,(%rbx)
+  80194b:	74 47                	je     801994 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80194d:	48 83 c0 08          	add    $0x8,%rax
+  801951:	48 8b 18             	mov    (%rax),%rbx
+  801954:	48 85 db             	test   %rbx,%rbx
+  801957:	75 f0                	jne    801949 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801959:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801960:	00 00 00 
+  801963:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801969:	89 fa                	mov    %edi,%edx
+  80196b:	48 bf d8 3f 80 00 00 	movabs $0x803fd8,%rdi
+  801972:	00 00 00 
+  801975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197a:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  801981:	00 00 00 
+  801984:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801986:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80198b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80198f:	5b                   	pop    %rbx
+  801990:	41 5c                	pop    %r12
+  801992:	5d                   	pop    %rbp
+  801993:	c3                   	ret
+            return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+  801999:	eb f0                	jmp    80198b <dev_lookup+0x60>
+
+000000000080199b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	41 55                	push   %r13
+  8019a1:	41 54                	push   %r12
+  8019a3:	53                   	push   %rbx
+  8019a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8019a8:	48 89 fb             	mov    %rdi,%rbx
+  8019ab:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019ae:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019b5:	ff ff ff 
+  8019b8:	48 01 df             	add    %rbx,%rdi
+  8019bb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019bf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c3:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+  8019cf:	41 89 c5             	mov    %eax,%r13d
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	78 06                	js     8019dc <fd_close+0x41>
+  8019d6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019da:	74 1a                	je     8019f6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019dc:	45 84 e4             	test   %r12b,%r12b
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019e8:	44 89 e8             	mov    %r13d,%eax
+  8019eb:	48 83 c4 18          	add    $0x18,%rsp
+  8019ef:	5b                   	pop    %rbx
+  8019f0:	41 5c                	pop    %r12
+  8019f2:	41 5d                	pop    %r13
+  8019f4:	5d                   	pop    %rbp
+  8019f5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019f6:	8b 3b                	mov    (%rbx),%edi
+  8019f8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019fc:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801a03:	00 00 00 
+  801a06:	ff d0                	call   *%rax
+  801a08:	41 89 c5             	mov    %eax,%r13d
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	78 1b                	js     801a2a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a13:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801a17:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a1d:	48 85 c0             	test   %rax,%rax
+  801a20:	74 08                	je     801a2a <fd_close+0x8f>
+  801a22:	48 89 df             	mov    %rbx,%rdi
+  801a25:	ff d0                	call   *%rax
+  801a27:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a2f:	48 89 de             	mov    %rbx,%rsi
+  801a32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a37:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  801a3e:	00 00 00 
+  801a41:	ff d0                	call   *%rax
+    return res;
+  801a43:	eb a3                	jmp    8019e8 <fd_close+0x4d>
+
+0000000000801a45 <close>:
+
+int
+close(int fdnum) {
+  801a45:	55                   	push   %rbp
+  801a46:	48 89 e5             	mov    %rsp,%rbp
+  801a49:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a4d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a51:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	78 15                	js     801a76 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a61:	be 01 00 00 00       	mov    $0x1,%esi
+  801a66:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a6a:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  801a71:	00 00 00 
+  801a74:	ff d0                	call   *%rax
+}
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+0000000000801a78 <close_all>:
+
+void
+close_all(void) {
+  801a78:	55                   	push   %rbp
+  801a79:	48 89 e5             	mov    %rsp,%rbp
+  801a7c:	41 54                	push   %r12
+  801a7e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a84:	49 bc 45 1a 80 00 00 	movabs $0x801a45,%r12
+  801a8b:	00 00 00 
+  801a8e:	89 df                	mov    %ebx,%edi
+  801a90:	41 ff d4             	call   *%r12
+  801a93:	83 c3 01             	add    $0x1,%ebx
+  801a96:	83 fb 20             	cmp    $0x20,%ebx
+  801a99:	75 f3                	jne    801a8e <close_all+0x16>
+}
+  801a9b:	5b                   	pop    %rbx
+  801a9c:	41 5c                	pop    %r12
+  801a9e:	5d                   	pop    %rbp
+  801a9f:	c3                   	ret
+
+0000000000801aa0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801aa0:	55                   	push   %rbp
+  801aa1:	48 89 e5             	mov    %rsp,%rbp
+  801aa4:	41 57                	push   %r15
+  801aa6:	41 56                	push   %r14
+  801aa8:	41 55                	push   %r13
+  801aaa:	41 54                	push   %r12
+  801aac:	53                   	push   %rbx
+  801aad:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ab4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ab8:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	89 c3                	mov    %eax,%ebx
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	0f 88 b8 00 00 00    	js     801b86 <dup+0xe6>
+    close(newfdnum);
+  801ace:	44 89 e7             	mov    %r12d,%edi
+  801ad1:	48 b8 45 1a 80 00 00 	movabs $0x801a45,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801add:	4d 63 ec             	movslq %r12d,%r13
+  801ae0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ae7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801aeb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801aef:	4c 89 ff             	mov    %r15,%rdi
+  801af2:	49 be 64 18 80 00 00 	movabs $0x801864,%r14
+  801af9:	00 00 00 
+  801afc:	41 ff d6             	call   *%r14
+  801aff:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b02:	4c 89 ef             	mov    %r13,%rdi
+  801b05:	41 ff d6             	call   *%r14
+  801b08:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b0b:	48 89 df             	mov    %rbx,%rdi
+  801b0e:	48 b8 9f 33 80 00 00 	movabs $0x80339f,%rax
+  801b15:	00 00 00 
+  801b18:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b1a:	a8 04                	test   $0x4,%al
+  801b1c:	74 2b                	je     801b49 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b1e:	41 89 c1             	mov    %eax,%r9d
+  801b21:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b27:	4c 89 f1             	mov    %r14,%rcx
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	48 89 de             	mov    %rbx,%rsi
+  801b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b37:	48 b8 6f 13 80 00 00 	movabs $0x80136f,%rax
+  801b3e:	00 00 00 
+  801b41:	ff d0                	call   *%rax
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 4e                	js     801b97 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b49:	4c 89 ff             	mov    %r15,%rdi
+  801b4c:	48 b8 9f 33 80 00 00 	movabs $0x80339f,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b5b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b61:	4c 89 e9             	mov    %r13,%rcx
+  801b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b69:	4c 89 fe             	mov    %r15,%rsi
+  801b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b71:	48 b8 6f 13 80 00 00 	movabs $0x80136f,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	89 c3                	mov    %eax,%ebx
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 14                	js     801b97 <dup+0xf7>
+
+    return newfdnum;
+  801b83:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b86:	89 d8                	mov    %ebx,%eax
+  801b88:	48 83 c4 18          	add    $0x18,%rsp
+  801b8c:	5b                   	pop    %rbx
+  801b8d:	41 5c                	pop    %r12
+  801b8f:	41 5d                	pop    %r13
+  801b91:	41 5e                	pop    %r14
+  801b93:	41 5f                	pop    %r15
+  801b95:	5d                   	pop    %rbp
+  801b96:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b9c:	4c 89 ee             	mov    %r13,%rsi
+  801b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba4:	49 bc d4 13 80 00 00 	movabs $0x8013d4,%r12
+  801bab:	00 00 00 
+  801bae:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bb1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bb6:	4c 89 f6             	mov    %r14,%rsi
+  801bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbe:	41 ff d4             	call   *%r12
+    return res;
+  801bc1:	eb c3                	jmp    801b86 <dup+0xe6>
+
+0000000000801bc3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	41 56                	push   %r14
+  801bc9:	41 55                	push   %r13
+  801bcb:	41 54                	push   %r12
+  801bcd:	53                   	push   %rbx
+  801bce:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd2:	89 fb                	mov    %edi,%ebx
+  801bd4:	49 89 f4             	mov    %rsi,%r12
+  801bd7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bda:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bde:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 4c                	js     801c3a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bee:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bf2:	41 8b 3e             	mov    (%r14),%edi
+  801bf5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf9:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801c00:	00 00 00 
+  801c03:	ff d0                	call   *%rax
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 35                	js     801c3e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c09:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c0d:	83 e0 03             	and    $0x3,%eax
+  801c10:	83 f8 01             	cmp    $0x1,%eax
+  801c13:	74 2d                	je     801c42 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c19:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c1d:	48 85 c0             	test   %rax,%rax
+  801c20:	74 56                	je     801c78 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c22:	4c 89 ea             	mov    %r13,%rdx
+  801c25:	4c 89 e6             	mov    %r12,%rsi
+  801c28:	4c 89 f7             	mov    %r14,%rdi
+  801c2b:	ff d0                	call   *%rax
+}
+  801c2d:	48 83 c4 10          	add    $0x10,%rsp
+  801c31:	5b                   	pop    %rbx
+  801c32:	41 5c                	pop    %r12
+  801c34:	41 5d                	pop    %r13
+  801c36:	41 5e                	pop    %r14
+  801c38:	5d                   	pop    %rbp
+  801c39:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c3a:	48 98                	cltq
+  801c3c:	eb ef                	jmp    801c2d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c3e:	48 98                	cltq
+  801c40:	eb eb                	jmp    801c2d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c42:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c49:	00 00 00 
+  801c4c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c52:	89 da                	mov    %ebx,%edx
+  801c54:	48 bf 39 40 80 00 00 	movabs $0x804039,%rdi
+  801c5b:	00 00 00 
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c63:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  801c6a:	00 00 00 
+  801c6d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c6f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c76:	eb b5                	jmp    801c2d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c78:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c7f:	eb ac                	jmp    801c2d <read+0x6a>
+
+0000000000801c81 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c81:	55                   	push   %rbp
+  801c82:	48 89 e5             	mov    %rsp,%rbp
+  801c85:	41 56                	push   %r14
+  801c87:	41 55                	push   %r13
+  801c89:	41 54                	push   %r12
+  801c8b:	53                   	push   %rbx
+  801c8c:	48 83 ec 10          	sub    $0x10,%rsp
+  801c90:	89 fb                	mov    %edi,%ebx
+  801c92:	49 89 f4             	mov    %rsi,%r12
+  801c95:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c98:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c9c:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 41                	js     801ced <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cac:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cb0:	41 8b 3e             	mov    (%r14),%edi
+  801cb3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cb7:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 35                	js     801cfc <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cc7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ccb:	83 e0 03             	and    $0x3,%eax
+  801cce:	83 f8 01             	cmp    $0x1,%eax
+  801cd1:	74 2d                	je     801d00 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801cd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cdb:	48 85 c0             	test   %rax,%rax
+  801cde:	74 56                	je     801d36 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801ce0:	4c 89 ea             	mov    %r13,%rdx
+  801ce3:	4c 89 e6             	mov    %r12,%rsi
+  801ce6:	4c 89 f7             	mov    %r14,%rdi
+  801ce9:	ff d0                	call   *%rax
+  801ceb:	eb 02                	jmp    801cef <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ced:	48 98                	cltq
+}
+  801cef:	48 83 c4 10          	add    $0x10,%rsp
+  801cf3:	5b                   	pop    %rbx
+  801cf4:	41 5c                	pop    %r12
+  801cf6:	41 5d                	pop    %r13
+  801cf8:	41 5e                	pop    %r14
+  801cfa:	5d                   	pop    %rbp
+  801cfb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cfc:	48 98                	cltq
+  801cfe:	eb ef                	jmp    801cef <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d00:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d07:	00 00 00 
+  801d0a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d10:	89 da                	mov    %ebx,%edx
+  801d12:	48 bf f8 3f 80 00 00 	movabs $0x803ff8,%rdi
+  801d19:	00 00 00 
+  801d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d21:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  801d28:	00 00 00 
+  801d2b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d2d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d34:	eb b9                	jmp    801cef <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801d36:	4c 89 ea             	mov    %r13,%rdx
+  801d39:	4c 89 e6             	mov    %r12,%rsi
+  801d3c:	89 df                	mov    %ebx,%edi
+  801d3e:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+  801d4a:	eb a3                	jmp    801cef <readmap+0x6e>
+
+0000000000801d4c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	41 57                	push   %r15
+  801d52:	41 56                	push   %r14
+  801d54:	41 55                	push   %r13
+  801d56:	41 54                	push   %r12
+  801d58:	53                   	push   %rbx
+  801d59:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d5d:	48 85 d2             	test   %rdx,%rdx
+  801d60:	74 54                	je     801db6 <readn+0x6a>
+  801d62:	41 89 fd             	mov    %edi,%r13d
+  801d65:	49 89 f6             	mov    %rsi,%r14
+  801d68:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d70:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d75:	49 bf c3 1b 80 00 00 	movabs $0x801bc3,%r15
+  801d7c:	00 00 00 
+  801d7f:	4c 89 e2             	mov    %r12,%rdx
+  801d82:	48 29 f2             	sub    %rsi,%rdx
+  801d85:	4c 01 f6             	add    %r14,%rsi
+  801d88:	44 89 ef             	mov    %r13d,%edi
+  801d8b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	78 20                	js     801db2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d92:	01 c3                	add    %eax,%ebx
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	74 08                	je     801da0 <readn+0x54>
+  801d98:	48 63 f3             	movslq %ebx,%rsi
+  801d9b:	4c 39 e6             	cmp    %r12,%rsi
+  801d9e:	72 df                	jb     801d7f <readn+0x33>
+    }
+    return res;
+  801da0:	48 63 c3             	movslq %ebx,%rax
+}
+  801da3:	48 83 c4 08          	add    $0x8,%rsp
+  801da7:	5b                   	pop    %rbx
+  801da8:	41 5c                	pop    %r12
+  801daa:	41 5d                	pop    %r13
+  801dac:	41 5e                	pop    %r14
+  801dae:	41 5f                	pop    %r15
+  801db0:	5d                   	pop    %rbp
+  801db1:	c3                   	ret
+        if (inc < 0) return inc;
+  801db2:	48 98                	cltq
+  801db4:	eb ed                	jmp    801da3 <readn+0x57>
+    int inc = 1, res = 0;
+  801db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbb:	eb e3                	jmp    801da0 <readn+0x54>
+
+0000000000801dbd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dbd:	55                   	push   %rbp
+  801dbe:	48 89 e5             	mov    %rsp,%rbp
+  801dc1:	41 56                	push   %r14
+  801dc3:	41 55                	push   %r13
+  801dc5:	41 54                	push   %r12
+  801dc7:	53                   	push   %rbx
+  801dc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801dcc:	89 fb                	mov    %edi,%ebx
+  801dce:	49 89 f4             	mov    %rsi,%r12
+  801dd1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd8:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 47                	js     801e2f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dec:	41 8b 3e             	mov    (%r14),%edi
+  801def:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801df3:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801dfa:	00 00 00 
+  801dfd:	ff d0                	call   *%rax
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 30                	js     801e33 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e03:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e08:	74 2d                	je     801e37 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e0e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e12:	48 85 c0             	test   %rax,%rax
+  801e15:	74 56                	je     801e6d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e17:	4c 89 ea             	mov    %r13,%rdx
+  801e1a:	4c 89 e6             	mov    %r12,%rsi
+  801e1d:	4c 89 f7             	mov    %r14,%rdi
+  801e20:	ff d0                	call   *%rax
+}
+  801e22:	48 83 c4 10          	add    $0x10,%rsp
+  801e26:	5b                   	pop    %rbx
+  801e27:	41 5c                	pop    %r12
+  801e29:	41 5d                	pop    %r13
+  801e2b:	41 5e                	pop    %r14
+  801e2d:	5d                   	pop    %rbp
+  801e2e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2f:	48 98                	cltq
+  801e31:	eb ef                	jmp    801e22 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e33:	48 98                	cltq
+  801e35:	eb eb                	jmp    801e22 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e37:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e3e:	00 00 00 
+  801e41:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e47:	89 da                	mov    %ebx,%edx
+  801e49:	48 bf 55 40 80 00 00 	movabs $0x804055,%rdi
+  801e50:	00 00 00 
+  801e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e58:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  801e5f:	00 00 00 
+  801e62:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e64:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e6b:	eb b5                	jmp    801e22 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e6d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e74:	eb ac                	jmp    801e22 <write+0x65>
+
+0000000000801e76 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e76:	55                   	push   %rbp
+  801e77:	48 89 e5             	mov    %rsp,%rbp
+  801e7a:	53                   	push   %rbx
+  801e7b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e7f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e85:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801e8c:	00 00 00 
+  801e8f:	ff d0                	call   *%rax
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 0c                	js     801ea1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e99:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea5:	c9                   	leave
+  801ea6:	c3                   	ret
+
+0000000000801ea7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ea7:	55                   	push   %rbp
+  801ea8:	48 89 e5             	mov    %rsp,%rbp
+  801eab:	41 55                	push   %r13
+  801ead:	41 54                	push   %r12
+  801eaf:	53                   	push   %rbx
+  801eb0:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb4:	89 fb                	mov    %edi,%ebx
+  801eb6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebd:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 38                	js     801f05 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecd:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ed1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ed5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed9:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	78 1c                	js     801f05 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801eee:	74 20                	je     801f10 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ef0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef4:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801ef8:	48 85 c0             	test   %rax,%rax
+  801efb:	74 47                	je     801f44 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801efd:	44 89 e6             	mov    %r12d,%esi
+  801f00:	4c 89 ef             	mov    %r13,%rdi
+  801f03:	ff d0                	call   *%rax
+}
+  801f05:	48 83 c4 18          	add    $0x18,%rsp
+  801f09:	5b                   	pop    %rbx
+  801f0a:	41 5c                	pop    %r12
+  801f0c:	41 5d                	pop    %r13
+  801f0e:	5d                   	pop    %rbp
+  801f0f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f10:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f17:	00 00 00 
+  801f1a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f20:	89 da                	mov    %ebx,%edx
+  801f22:	48 bf 18 40 80 00 00 	movabs $0x804018,%rdi
+  801f29:	00 00 00 
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f31:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  801f38:	00 00 00 
+  801f3b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f42:	eb c1                	jmp    801f05 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f44:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f49:	eb ba                	jmp    801f05 <ftruncate+0x5e>
+
+0000000000801f4b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f4b:	55                   	push   %rbp
+  801f4c:	48 89 e5             	mov    %rsp,%rbp
+  801f4f:	41 54                	push   %r12
+  801f51:	53                   	push   %rbx
+  801f52:	48 83 ec 10          	sub    $0x10,%rsp
+  801f56:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f59:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f5d:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801f64:	00 00 00 
+  801f67:	ff d0                	call   *%rax
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	78 4e                	js     801fbb <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f71:	41 8b 3c 24          	mov    (%r12),%edi
+  801f75:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f79:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  801f80:	00 00 00 
+  801f83:	ff d0                	call   *%rax
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	78 32                	js     801fbb <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f8d:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801f92:	74 30                	je     801fc4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f94:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f97:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f9e:	00 00 00 
+    stat->st_isdir = 0;
+  801fa1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fa8:	00 00 00 
+    stat->st_dev = dev;
+  801fab:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fb2:	48 89 de             	mov    %rbx,%rsi
+  801fb5:	4c 89 e7             	mov    %r12,%rdi
+  801fb8:	ff 50 30             	call   *0x30(%rax)
+}
+  801fbb:	48 83 c4 10          	add    $0x10,%rsp
+  801fbf:	5b                   	pop    %rbx
+  801fc0:	41 5c                	pop    %r12
+  801fc2:	5d                   	pop    %rbp
+  801fc3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fc4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc9:	eb f0                	jmp    801fbb <fstat+0x70>
+
+0000000000801fcb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fcb:	55                   	push   %rbp
+  801fcc:	48 89 e5             	mov    %rsp,%rbp
+  801fcf:	41 54                	push   %r12
+  801fd1:	53                   	push   %rbx
+  801fd2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fda:	48 b8 22 2d 80 00 00 	movabs $0x802d22,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+  801fe6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 25                	js     802011 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fec:	4c 89 e6             	mov    %r12,%rsi
+  801fef:	89 c7                	mov    %eax,%edi
+  801ff1:	48 b8 4b 1f 80 00 00 	movabs $0x801f4b,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+  801ffd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802000:	89 df                	mov    %ebx,%edi
+  802002:	48 b8 45 1a 80 00 00 	movabs $0x801a45,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+
+    return res;
+  80200e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802011:	89 d8                	mov    %ebx,%eax
+  802013:	5b                   	pop    %rbx
+  802014:	41 5c                	pop    %r12
+  802016:	5d                   	pop    %rbp
+  802017:	c3                   	ret
+
+0000000000802018 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802018:	55                   	push   %rbp
+  802019:	48 89 e5             	mov    %rsp,%rbp
+  80201c:	41 54                	push   %r12
+  80201e:	53                   	push   %rbx
+  80201f:	48 83 ec 10          	sub    $0x10,%rsp
+  802023:	48 89 fb             	mov    %rdi,%rbx
+  802026:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802029:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80202d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802032:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  802039:	00 00 00 
+  80203c:	ff d0                	call   *%rax
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 1f                	js     802061 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802042:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802046:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80204a:	48 85 c0             	test   %rax,%rax
+  80204d:	74 1b                	je     80206a <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80204f:	4c 89 e6             	mov    %r12,%rsi
+  802052:	48 89 df             	mov    %rbx,%rdi
+  802055:	ff d0                	call   *%rax
+    if (res < 0) {
+  802057:	85 c0                	test   %eax,%eax
+  802059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802061:	48 83 c4 10          	add    $0x10,%rsp
+  802065:	5b                   	pop    %rbx
+  802066:	41 5c                	pop    %r12
+  802068:	5d                   	pop    %rbp
+  802069:	c3                   	ret
+        return -E_NOT_SUPP;
+  80206a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206f:	eb f0                	jmp    802061 <create_snapshot+0x49>
+
+0000000000802071 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802071:	55                   	push   %rbp
+  802072:	48 89 e5             	mov    %rsp,%rbp
+  802075:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802079:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80207d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802082:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 1e                	js     8020b0 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802092:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802096:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80209a:	48 85 d2             	test   %rdx,%rdx
+  80209d:	74 13                	je     8020b2 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  80209f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a4:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ad:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020b0:	c9                   	leave
+  8020b1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b7:	eb f7                	jmp    8020b0 <print_snapshot_list+0x3f>
+
+00000000008020b9 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	53                   	push   %rbx
+  8020be:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c2:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020c5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020ce:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 1c                	js     8020fa <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8020de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e2:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8020e6:	48 85 c0             	test   %rax,%rax
+  8020e9:	74 15                	je     802100 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8020eb:	48 89 df             	mov    %rbx,%rdi
+  8020ee:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+        return -E_NOT_SUPP;
+  802100:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802105:	eb f3                	jmp    8020fa <accept_snapshot+0x41>
+
+0000000000802107 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802107:	55                   	push   %rbp
+  802108:	48 89 e5             	mov    %rsp,%rbp
+  80210b:	53                   	push   %rbx
+  80210c:	48 83 ec 18          	sub    $0x18,%rsp
+  802110:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802113:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802117:	bf 66 00 00 00       	mov    $0x66,%edi
+  80211c:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 1c                	js     802148 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80212c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802130:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802134:	48 85 c0             	test   %rax,%rax
+  802137:	74 15                	je     80214e <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802139:	48 89 df             	mov    %rbx,%rdi
+  80213c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	ba 00 00 00 00       	mov    $0x0,%edx
+  802145:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80214c:	c9                   	leave
+  80214d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80214e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802153:	eb f3                	jmp    802148 <delete_snapshot+0x41>
+
+0000000000802155 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802155:	55                   	push   %rbp
+  802156:	48 89 e5             	mov    %rsp,%rbp
+  802159:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80215d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802161:	bf 66 00 00 00       	mov    $0x66,%edi
+  802166:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 14                	js     80218a <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802176:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80217a:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80217e:	48 85 d2             	test   %rdx,%rdx
+  802181:	74 09                	je     80218c <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+  802188:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80218a:	c9                   	leave
+  80218b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80218c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802191:	eb f7                	jmp    80218a <gc_snapshots+0x35>
+
+0000000000802193 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802193:	55                   	push   %rbp
+  802194:	48 89 e5             	mov    %rsp,%rbp
+  802197:	41 56                	push   %r14
+  802199:	41 55                	push   %r13
+  80219b:	41 54                	push   %r12
+  80219d:	53                   	push   %rbx
+  80219e:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a2:	48 89 fb             	mov    %rdi,%rbx
+  8021a5:	49 89 f4             	mov    %rsi,%r12
+  8021a8:	49 89 d5             	mov    %rdx,%r13
+  8021ab:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021ae:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021b2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021b7:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  8021be:	00 00 00 
+  8021c1:	ff d0                	call   *%rax
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 1b                	js     8021e2 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8021c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021cb:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8021cf:	48 85 c0             	test   %rax,%rax
+  8021d2:	74 1b                	je     8021ef <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8021d4:	4c 89 f1             	mov    %r14,%rcx
+  8021d7:	4c 89 ea             	mov    %r13,%rdx
+  8021da:	4c 89 e6             	mov    %r12,%rsi
+  8021dd:	48 89 df             	mov    %rbx,%rdi
+  8021e0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021e2:	48 83 c4 10          	add    $0x10,%rsp
+  8021e6:	5b                   	pop    %rbx
+  8021e7:	41 5c                	pop    %r12
+  8021e9:	41 5d                	pop    %r13
+  8021eb:	41 5e                	pop    %r14
+  8021ed:	5d                   	pop    %rbp
+  8021ee:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021f4:	eb ec                	jmp    8021e2 <diff_snapshots+0x4f>
+
+00000000008021f6 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8021f6:	55                   	push   %rbp
+  8021f7:	48 89 e5             	mov    %rsp,%rbp
+  8021fa:	41 55                	push   %r13
+  8021fc:	41 54                	push   %r12
+  8021fe:	53                   	push   %rbx
+  8021ff:	48 83 ec 18          	sub    $0x18,%rsp
+  802203:	48 89 fb             	mov    %rdi,%rbx
+  802206:	49 89 f4             	mov    %rsi,%r12
+  802209:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80220c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802210:	bf 66 00 00 00       	mov    $0x66,%edi
+  802215:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 18                	js     80223d <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802225:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802229:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80222d:	48 85 c0             	test   %rax,%rax
+  802230:	74 16                	je     802248 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802232:	4c 89 ea             	mov    %r13,%rdx
+  802235:	4c 89 e6             	mov    %r12,%rsi
+  802238:	48 89 df             	mov    %rbx,%rdi
+  80223b:	ff d0                	call   *%rax
+
+    return res;
+}
+  80223d:	48 83 c4 18          	add    $0x18,%rsp
+  802241:	5b                   	pop    %rbx
+  802242:	41 5c                	pop    %r12
+  802244:	41 5d                	pop    %r13
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+        return -E_NOT_SUPP;
+  802248:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80224d:	eb ee                	jmp    80223d <send_snapshot+0x47>
+
+000000000080224f <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80224f:	55                   	push   %rbp
+  802250:	48 89 e5             	mov    %rsp,%rbp
+  802253:	53                   	push   %rbx
+  802254:	48 83 ec 18          	sub    $0x18,%rsp
+  802258:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80225b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80225f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802264:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 12                	js     802286 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802274:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802278:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80227c:	48 85 c0             	test   %rax,%rax
+  80227f:	74 0b                	je     80228c <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802281:	48 89 df             	mov    %rbx,%rdi
+  802284:	ff d0                	call   *%rax
+
+    return res;
+}
+  802286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80228a:	c9                   	leave
+  80228b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80228c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802291:	eb f3                	jmp    802286 <receive_snapshot+0x37>
+
+0000000000802293 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802293:	55                   	push   %rbp
+  802294:	48 89 e5             	mov    %rsp,%rbp
+  802297:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80229b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80229f:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022a4:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	85 c0                	test   %eax,%eax
+  8022b2:	78 17                	js     8022cb <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8022b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022b8:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8022bf:	48 85 d2             	test   %rdx,%rdx
+  8022c2:	74 09                	je     8022cd <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8022c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c9:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022cb:	c9                   	leave
+  8022cc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022d2:	eb f7                	jmp    8022cb <free_space_bytes+0x38>
+
+00000000008022d4 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022e0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022e5:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	78 17                	js     80230c <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8022f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022f9:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802300:	48 85 d2             	test   %rdx,%rdx
+  802303:	74 09                	je     80230e <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80230e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802313:	eb f7                	jmp    80230c <busy_space_bytes+0x38>
+
+0000000000802315 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802315:	55                   	push   %rbp
+  802316:	48 89 e5             	mov    %rsp,%rbp
+  802319:	41 54                	push   %r12
+  80231b:	53                   	push   %rbx
+  80231c:	48 83 ec 10          	sub    $0x10,%rsp
+  802320:	89 fb                	mov    %edi,%ebx
+  802322:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802325:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802329:	bf 66 00 00 00       	mov    $0x66,%edi
+  80232e:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+  80233a:	85 c0                	test   %eax,%eax
+  80233c:	78 17                	js     802355 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80233e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802342:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802349:	48 85 c0             	test   %rax,%rax
+  80234c:	74 10                	je     80235e <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80234e:	4c 89 e6             	mov    %r12,%rsi
+  802351:	89 df                	mov    %ebx,%edi
+  802353:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802355:	48 83 c4 10          	add    $0x10,%rsp
+  802359:	5b                   	pop    %rbx
+  80235a:	41 5c                	pop    %r12
+  80235c:	5d                   	pop    %rbp
+  80235d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80235e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802363:	eb f0                	jmp    802355 <snapshots_space+0x40>
+
+0000000000802365 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802365:	55                   	push   %rbp
+  802366:	48 89 e5             	mov    %rsp,%rbp
+  802369:	41 55                	push   %r13
+  80236b:	41 54                	push   %r12
+  80236d:	53                   	push   %rbx
+  80236e:	48 83 ec 08          	sub    $0x8,%rsp
+  802372:	41 89 fd             	mov    %edi,%r13d
+  802375:	48 89 f3             	mov    %rsi,%rbx
+  802378:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80237b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802382:	00 00 00 
+  802385:	83 38 00             	cmpl   $0x0,(%rax)
+  802388:	74 57                	je     8023e1 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80238a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802390:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802395:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80239c:	00 00 00 
+  80239f:	44 89 ee             	mov    %r13d,%esi
+  8023a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023a9:	00 00 00 
+  8023ac:	8b 38                	mov    (%rax),%edi
+  8023ae:	48 b8 85 38 80 00 00 	movabs $0x803885,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8023ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023bf:	4c 89 e2             	mov    %r12,%rdx
+  8023c2:	48 89 de             	mov    %rbx,%rsi
+  8023c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ca:	48 b8 6d 38 80 00 00 	movabs $0x80386d,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+}
+  8023d6:	48 83 c4 08          	add    $0x8,%rsp
+  8023da:	5b                   	pop    %rbx
+  8023db:	41 5c                	pop    %r12
+  8023dd:	41 5d                	pop    %r13
+  8023df:	5d                   	pop    %rbp
+  8023e0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023e1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023e6:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  8023ed:	00 00 00 
+  8023f0:	ff d0                	call   *%rax
+  8023f2:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8023f9:	00 00 
+  8023fb:	eb 8d                	jmp    80238a <fsipc_region+0x25>
+
+00000000008023fd <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8023fd:	55                   	push   %rbp
+  8023fe:	48 89 e5             	mov    %rsp,%rbp
+  802401:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802405:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80240c:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80240d:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802411:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+}
+  80241d:	c9                   	leave
+  80241e:	c3                   	ret
+
+000000000080241f <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80241f:	85 ff                	test   %edi,%edi
+  802421:	78 6d                	js     802490 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 54                	push   %r12
+  802429:	53                   	push   %rbx
+  80242a:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80242d:	48 85 f6             	test   %rsi,%rsi
+  802430:	74 57                	je     802489 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802432:	89 f8                	mov    %edi,%eax
+  802434:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80243b:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80243d:	be 00 00 00 00       	mov    $0x0,%esi
+  802442:	bf 12 00 00 00       	mov    $0x12,%edi
+  802447:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802453:	85 c0                	test   %eax,%eax
+  802455:	78 2d                	js     802484 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802457:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80245e:	00 00 00 
+  802461:	49 63 14 24          	movslq (%r12),%rdx
+  802465:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80246c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802471:	48 89 df             	mov    %rbx,%rdi
+  802474:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  80247b:	00 00 00 
+  80247e:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802480:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802484:	5b                   	pop    %rbx
+  802485:	41 5c                	pop    %r12
+  802487:	5d                   	pop    %rbp
+  802488:	c3                   	ret
+        return -E_INVAL;
+  802489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80248e:	eb f4                	jmp    802484 <devfile_df_snapshots+0x65>
+  802490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802495:	c3                   	ret
+
+0000000000802496 <devfile_df_busy>:
+devfile_df_busy() {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80249a:	be 00 00 00 00       	mov    $0x0,%esi
+  80249f:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024a4:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+}
+  8024b0:	5d                   	pop    %rbp
+  8024b1:	c3                   	ret
+
+00000000008024b2 <devfile_df_free>:
+devfile_df_free() {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8024b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8024bb:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024c0:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+}
+  8024cc:	5d                   	pop    %rbp
+  8024cd:	c3                   	ret
+
+00000000008024ce <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8024ce:	55                   	push   %rbp
+  8024cf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8024d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8024dc:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+}
+  8024e8:	5d                   	pop    %rbp
+  8024e9:	c3                   	ret
+
+00000000008024ea <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8024ea:	55                   	push   %rbp
+  8024eb:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8024ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024f8:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802504:	85 c0                	test   %eax,%eax
+  802506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80250e:	5d                   	pop    %rbp
+  80250f:	c3                   	ret
+
+0000000000802510 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802510:	55                   	push   %rbp
+  802511:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802514:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80251b:	00 00 00 
+  80251e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802521:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802523:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802526:	be 00 00 00 00       	mov    $0x0,%esi
+  80252b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802530:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+}
+  80253c:	5d                   	pop    %rbp
+  80253d:	c3                   	ret
+
+000000000080253e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80253e:	55                   	push   %rbp
+  80253f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802542:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802545:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80254c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80254e:	be 00 00 00 00       	mov    $0x0,%esi
+  802553:	bf 06 00 00 00       	mov    $0x6,%edi
+  802558:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80255f:	00 00 00 
+  802562:	ff d0                	call   *%rax
+}
+  802564:	5d                   	pop    %rbp
+  802565:	c3                   	ret
+
+0000000000802566 <devfile_write>:
+    if (!fd || !buf) {
+  802566:	48 85 ff             	test   %rdi,%rdi
+  802569:	0f 84 c1 00 00 00    	je     802630 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80256f:	55                   	push   %rbp
+  802570:	48 89 e5             	mov    %rsp,%rbp
+  802573:	41 57                	push   %r15
+  802575:	41 56                	push   %r14
+  802577:	41 55                	push   %r13
+  802579:	41 54                	push   %r12
+  80257b:	53                   	push   %rbx
+  80257c:	48 83 ec 18          	sub    $0x18,%rsp
+  802580:	49 89 ff             	mov    %rdi,%r15
+  802583:	49 89 f5             	mov    %rsi,%r13
+  802586:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802589:	48 85 f6             	test   %rsi,%rsi
+  80258c:	0f 84 95 00 00 00    	je     802627 <devfile_write+0xc1>
+    while (n) {
+  802592:	48 85 d2             	test   %rdx,%rdx
+  802595:	0f 84 83 00 00 00    	je     80261e <devfile_write+0xb8>
+    int totalWrite = 0;
+  80259b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025a2:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025a9:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025ac:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025b1:	49 39 dc             	cmp    %rbx,%r12
+  8025b4:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8025b8:	48 89 da             	mov    %rbx,%rdx
+  8025bb:	4c 89 ee             	mov    %r13,%rsi
+  8025be:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8025c5:	00 00 00 
+  8025c8:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025d4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025d8:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8025db:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8025df:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8025e9:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+        if (write < 0) {
+  8025f5:	85 c0                	test   %eax,%eax
+  8025f7:	78 21                	js     80261a <devfile_write+0xb4>
+        buf += write;
+  8025f9:	48 63 d0             	movslq %eax,%rdx
+  8025fc:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8025ff:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802602:	49 29 d4             	sub    %rdx,%r12
+  802605:	75 a5                	jne    8025ac <devfile_write+0x46>
+    return totalWrite;
+  802607:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80260b:	48 83 c4 18          	add    $0x18,%rsp
+  80260f:	5b                   	pop    %rbx
+  802610:	41 5c                	pop    %r12
+  802612:	41 5d                	pop    %r13
+  802614:	41 5e                	pop    %r14
+  802616:	41 5f                	pop    %r15
+  802618:	5d                   	pop    %rbp
+  802619:	c3                   	ret
+            return write;
+  80261a:	48 98                	cltq
+  80261c:	eb ed                	jmp    80260b <devfile_write+0xa5>
+    int totalWrite = 0;
+  80261e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802625:	eb e0                	jmp    802607 <devfile_write+0xa1>
+        return -E_INVAL;
+  802627:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80262e:	eb db                	jmp    80260b <devfile_write+0xa5>
+  802630:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802637:	c3                   	ret
+
+0000000000802638 <devfile_read>:
+    if (!fd || !buf) {
+  802638:	48 85 ff             	test   %rdi,%rdi
+  80263b:	0f 84 c0 00 00 00    	je     802701 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	41 57                	push   %r15
+  802647:	41 56                	push   %r14
+  802649:	41 55                	push   %r13
+  80264b:	41 54                	push   %r12
+  80264d:	53                   	push   %rbx
+  80264e:	48 83 ec 18          	sub    $0x18,%rsp
+  802652:	49 89 ff             	mov    %rdi,%r15
+  802655:	49 89 f5             	mov    %rsi,%r13
+  802658:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80265b:	48 85 f6             	test   %rsi,%rsi
+  80265e:	0f 84 96 00 00 00    	je     8026fa <devfile_read+0xc2>
+    while (n) {
+  802664:	48 85 d2             	test   %rdx,%rdx
+  802667:	0f 84 87 00 00 00    	je     8026f4 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80266d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802674:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802675:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80267c:	00 00 00 
+  80267f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802683:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802686:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80268b:	49 39 c4             	cmp    %rax,%r12
+  80268e:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802692:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802696:	be 00 00 00 00       	mov    $0x0,%esi
+  80269b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026a0:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8026ac:	85 c0                	test   %eax,%eax
+  8026ae:	7e 37                	jle    8026e7 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8026b0:	48 63 d8             	movslq %eax,%rbx
+  8026b3:	48 89 da             	mov    %rbx,%rdx
+  8026b6:	4c 89 f6             	mov    %r14,%rsi
+  8026b9:	4c 89 ef             	mov    %r13,%rdi
+  8026bc:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+        buf += read;
+  8026c8:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8026cb:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8026cf:	49 29 dc             	sub    %rbx,%r12
+  8026d2:	75 ab                	jne    80267f <devfile_read+0x47>
+  return totalRead;
+  8026d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8026d8:	48 83 c4 18          	add    $0x18,%rsp
+  8026dc:	5b                   	pop    %rbx
+  8026dd:	41 5c                	pop    %r12
+  8026df:	41 5d                	pop    %r13
+  8026e1:	41 5e                	pop    %r14
+  8026e3:	41 5f                	pop    %r15
+  8026e5:	5d                   	pop    %rbp
+  8026e6:	c3                   	ret
+            return read ? read : totalRead;
+  8026e7:	48 63 d0             	movslq %eax,%rdx
+  8026ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026ee:	48 0f 45 c2          	cmovne %rdx,%rax
+  8026f2:	eb e4                	jmp    8026d8 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8026f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026f8:	eb da                	jmp    8026d4 <devfile_read+0x9c>
+        return E_INVAL;
+  8026fa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026ff:	eb d7                	jmp    8026d8 <devfile_read+0xa0>
+  802701:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802706:	c3                   	ret
+
+0000000000802707 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802707:	48 85 ff             	test   %rdi,%rdi
+  80270a:	74 5f                	je     80276b <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80270c:	55                   	push   %rbp
+  80270d:	48 89 e5             	mov    %rsp,%rbp
+  802710:	53                   	push   %rbx
+  802711:	48 83 ec 08          	sub    $0x8,%rsp
+  802715:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802718:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+  802724:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80272a:	77 45                	ja     802771 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80272c:	48 89 de             	mov    %rbx,%rsi
+  80272f:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802736:	00 00 00 
+  802739:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  802740:	00 00 00 
+  802743:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802745:	be 00 00 00 00       	mov    $0x0,%esi
+  80274a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80274f:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802756:	00 00 00 
+  802759:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802762:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802765:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+        return -E_INVAL;
+  80276b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802770:	c3                   	ret
+        return -E_INVAL;
+  802771:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802776:	eb ed                	jmp    802765 <devfile_receive_snapshot+0x5e>
+
+0000000000802778 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802778:	55                   	push   %rbp
+  802779:	48 89 e5             	mov    %rsp,%rbp
+  80277c:	41 55                	push   %r13
+  80277e:	41 54                	push   %r12
+  802780:	53                   	push   %rbx
+  802781:	48 83 ec 08          	sub    $0x8,%rsp
+  802785:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802788:	48 85 f6             	test   %rsi,%rsi
+  80278b:	0f 94 c0             	sete   %al
+  80278e:	48 85 d2             	test   %rdx,%rdx
+  802791:	0f 94 c2             	sete   %dl
+  802794:	08 d0                	or     %dl,%al
+  802796:	0f 85 ad 00 00 00    	jne    802849 <devfile_send_snapshot+0xd1>
+  80279c:	48 89 fb             	mov    %rdi,%rbx
+  80279f:	49 89 f4             	mov    %rsi,%r12
+  8027a2:	48 85 ff             	test   %rdi,%rdi
+  8027a5:	0f 84 9e 00 00 00    	je     802849 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8027ab:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8027b2:	00 00 00 
+  8027b5:	ff d0                	call   *%rax
+  8027b7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027bd:	0f 87 8d 00 00 00    	ja     802850 <devfile_send_snapshot+0xd8>
+  8027c3:	4c 89 e7             	mov    %r12,%rdi
+  8027c6:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+  8027d2:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027d8:	77 7d                	ja     802857 <devfile_send_snapshot+0xdf>
+  8027da:	4c 89 ef             	mov    %r13,%rdi
+  8027dd:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027ef:	77 6d                	ja     80285e <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8027f1:	48 89 de             	mov    %rbx,%rsi
+  8027f4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8027fb:	00 00 00 
+  8027fe:	48 bb 7c 0c 80 00 00 	movabs $0x800c7c,%rbx
+  802805:	00 00 00 
+  802808:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80280a:	4c 89 e6             	mov    %r12,%rsi
+  80280d:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802814:	00 00 00 
+  802817:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802819:	4c 89 ee             	mov    %r13,%rsi
+  80281c:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802823:	00 00 00 
+  802826:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802828:	be 00 00 00 00       	mov    $0x0,%esi
+  80282d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802832:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+}
+  80283e:	48 83 c4 08          	add    $0x8,%rsp
+  802842:	5b                   	pop    %rbx
+  802843:	41 5c                	pop    %r12
+  802845:	41 5d                	pop    %r13
+  802847:	5d                   	pop    %rbp
+  802848:	c3                   	ret
+        return -E_INVAL;
+  802849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284e:	eb ee                	jmp    80283e <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802850:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802855:	eb e7                	jmp    80283e <devfile_send_snapshot+0xc6>
+  802857:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80285c:	eb e0                	jmp    80283e <devfile_send_snapshot+0xc6>
+  80285e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802863:	eb d9                	jmp    80283e <devfile_send_snapshot+0xc6>
+
+0000000000802865 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802865:	48 85 ff             	test   %rdi,%rdi
+  802868:	0f 84 41 01 00 00    	je     8029af <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80286e:	55                   	push   %rbp
+  80286f:	48 89 e5             	mov    %rsp,%rbp
+  802872:	41 57                	push   %r15
+  802874:	41 56                	push   %r14
+  802876:	41 55                	push   %r13
+  802878:	41 54                	push   %r12
+  80287a:	53                   	push   %rbx
+  80287b:	48 83 ec 08          	sub    $0x8,%rsp
+  80287f:	49 89 fc             	mov    %rdi,%r12
+  802882:	49 89 f5             	mov    %rsi,%r13
+  802885:	48 89 d3             	mov    %rdx,%rbx
+  802888:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80288b:	48 85 f6             	test   %rsi,%rsi
+  80288e:	0f 84 ff 00 00 00    	je     802993 <devfile_diff_snapshots+0x12e>
+  802894:	48 85 d2             	test   %rdx,%rdx
+  802897:	0f 84 fd 00 00 00    	je     80299a <devfile_diff_snapshots+0x135>
+  80289d:	48 85 c9             	test   %rcx,%rcx
+  8028a0:	0f 84 f4 00 00 00    	je     80299a <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8028a6:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8028ad:	00 00 00 
+  8028b0:	ff d0                	call   *%rax
+  8028b2:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028b8:	0f 87 e3 00 00 00    	ja     8029a1 <devfile_diff_snapshots+0x13c>
+  8028be:	4c 89 ef             	mov    %r13,%rdi
+  8028c1:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8028c8:	00 00 00 
+  8028cb:	ff d0                	call   *%rax
+  8028cd:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028d3:	0f 87 cf 00 00 00    	ja     8029a8 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8028d9:	4c 89 e6             	mov    %r12,%rsi
+  8028dc:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8028e3:	00 00 00 
+  8028e6:	4c 89 e7             	mov    %r12,%rdi
+  8028e9:	49 bf 7c 0c 80 00 00 	movabs $0x800c7c,%r15
+  8028f0:	00 00 00 
+  8028f3:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8028f6:	4c 89 ee             	mov    %r13,%rsi
+  8028f9:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802900:	00 
+  802901:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802904:	48 8b 03             	mov    (%rbx),%rax
+  802907:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80290e:	00 
+  80290f:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802913:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80291a:	00 
+  80291b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80291f:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802926:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802927:	be 00 00 00 00       	mov    $0x0,%esi
+  80292c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802931:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	78 43                	js     802984 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802941:	49 8b 04 24          	mov    (%r12),%rax
+  802945:	48 89 03             	mov    %rax,(%rbx)
+  802948:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80294d:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802951:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802956:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80295a:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80295f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802963:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802967:	48 c1 e2 03          	shl    $0x3,%rdx
+  80296b:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802970:	4c 89 f7             	mov    %r14,%rdi
+  802973:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80297f:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802984:	48 83 c4 08          	add    $0x8,%rsp
+  802988:	5b                   	pop    %rbx
+  802989:	41 5c                	pop    %r12
+  80298b:	41 5d                	pop    %r13
+  80298d:	41 5e                	pop    %r14
+  80298f:	41 5f                	pop    %r15
+  802991:	5d                   	pop    %rbp
+  802992:	c3                   	ret
+        return -E_INVAL;
+  802993:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802998:	eb ea                	jmp    802984 <devfile_diff_snapshots+0x11f>
+  80299a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299f:	eb e3                	jmp    802984 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a6:	eb dc                	jmp    802984 <devfile_diff_snapshots+0x11f>
+  8029a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ad:	eb d5                	jmp    802984 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029b4:	c3                   	ret
+
+00000000008029b5 <devfile_delete_snapshot>:
+    if (!name) {
+  8029b5:	48 85 ff             	test   %rdi,%rdi
+  8029b8:	74 5f                	je     802a19 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8029ba:	55                   	push   %rbp
+  8029bb:	48 89 e5             	mov    %rsp,%rbp
+  8029be:	53                   	push   %rbx
+  8029bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029c6:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8029cd:	00 00 00 
+  8029d0:	ff d0                	call   *%rax
+  8029d2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029d8:	77 45                	ja     802a1f <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8029da:	48 89 de             	mov    %rbx,%rsi
+  8029dd:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029e4:	00 00 00 
+  8029e7:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  8029ee:	00 00 00 
+  8029f1:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8029f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8029fd:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a10:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+        return -E_INVAL;
+  802a19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a1e:	c3                   	ret
+        return -E_INVAL;
+  802a1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a24:	eb ed                	jmp    802a13 <devfile_delete_snapshot+0x5e>
+
+0000000000802a26 <devfile_accept_snapshot>:
+    if (!name) {
+  802a26:	48 85 ff             	test   %rdi,%rdi
+  802a29:	74 5f                	je     802a8a <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802a2b:	55                   	push   %rbp
+  802a2c:	48 89 e5             	mov    %rsp,%rbp
+  802a2f:	53                   	push   %rbx
+  802a30:	48 83 ec 08          	sub    $0x8,%rsp
+  802a34:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802a37:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  802a3e:	00 00 00 
+  802a41:	ff d0                	call   *%rax
+  802a43:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a49:	77 45                	ja     802a90 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802a4b:	48 89 de             	mov    %rbx,%rsi
+  802a4e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a55:	00 00 00 
+  802a58:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  802a5f:	00 00 00 
+  802a62:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802a64:	be 00 00 00 00       	mov    $0x0,%esi
+  802a69:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a6e:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802a75:	00 00 00 
+  802a78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a81:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a88:	c9                   	leave
+  802a89:	c3                   	ret
+        return -E_INVAL;
+  802a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a8f:	c3                   	ret
+        return -E_INVAL;
+  802a90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a95:	eb ed                	jmp    802a84 <devfile_accept_snapshot+0x5e>
+
+0000000000802a97 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802a97:	48 85 ff             	test   %rdi,%rdi
+  802a9a:	0f 84 9f 00 00 00    	je     802b3f <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802aa0:	55                   	push   %rbp
+  802aa1:	48 89 e5             	mov    %rsp,%rbp
+  802aa4:	41 54                	push   %r12
+  802aa6:	53                   	push   %rbx
+  802aa7:	48 89 fb             	mov    %rdi,%rbx
+  802aaa:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802aad:	48 85 f6             	test   %rsi,%rsi
+  802ab0:	74 78                	je     802b2a <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802ab2:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ac4:	77 6b                	ja     802b31 <devfile_create_snapshot+0x9a>
+  802ac6:	4c 89 e7             	mov    %r12,%rdi
+  802ac9:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+  802ad5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802adb:	77 5b                	ja     802b38 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802add:	48 89 de             	mov    %rbx,%rsi
+  802ae0:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ae7:	00 00 00 
+  802aea:	48 bb 7c 0c 80 00 00 	movabs $0x800c7c,%rbx
+  802af1:	00 00 00 
+  802af4:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802af6:	4c 89 e6             	mov    %r12,%rsi
+  802af9:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802b00:	00 00 00 
+  802b03:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802b05:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0a:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b0f:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b1b:	85 c0                	test   %eax,%eax
+  802b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b22:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b25:	5b                   	pop    %rbx
+  802b26:	41 5c                	pop    %r12
+  802b28:	5d                   	pop    %rbp
+  802b29:	c3                   	ret
+        return -E_INVAL;
+  802b2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b2f:	eb f4                	jmp    802b25 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b36:	eb ed                	jmp    802b25 <devfile_create_snapshot+0x8e>
+  802b38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b3d:	eb e6                	jmp    802b25 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b44:	c3                   	ret
+
+0000000000802b45 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  802b49:	41 54                	push   %r12
+  802b4b:	53                   	push   %rbx
+  802b4c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b4f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b52:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802b59:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b60:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b65:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 3d                	js     802bb2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b75:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802b7c:	00 00 00 
+  802b7f:	4c 89 e6             	mov    %r12,%rsi
+  802b82:	48 89 df             	mov    %rbx,%rdi
+  802b85:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  802b8c:	00 00 00 
+  802b8f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b91:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b98:	00 
+  802b99:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b9f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ba6:	00 
+  802ba7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb2:	5b                   	pop    %rbx
+  802bb3:	41 5c                	pop    %r12
+  802bb5:	5d                   	pop    %rbp
+  802bb6:	c3                   	ret
+
+0000000000802bb7 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802bb7:	55                   	push   %rbp
+  802bb8:	48 89 e5             	mov    %rsp,%rbp
+  802bbb:	41 57                	push   %r15
+  802bbd:	41 56                	push   %r14
+  802bbf:	41 55                	push   %r13
+  802bc1:	41 54                	push   %r12
+  802bc3:	53                   	push   %rbx
+  802bc4:	48 83 ec 38          	sub    $0x38,%rsp
+  802bc8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802bcc:	49 89 f5             	mov    %rsi,%r13
+  802bcf:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802bd2:	48 89 f0             	mov    %rsi,%rax
+  802bd5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802bda:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802bde:	75 4f                	jne    802c2f <devfile_readmap+0x78>
+  802be0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802be4:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802bea:	75 1f                	jne    802c0b <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802bec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bf0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802bf4:	49 be 9f 33 80 00 00 	movabs $0x80339f,%r14
+  802bfb:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802bfe:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802c05:	0f 87 9d 00 00 00    	ja     802ca8 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802c0b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c0f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802c13:	4d 85 ff             	test   %r15,%r15
+  802c16:	0f 85 cf 00 00 00    	jne    802ceb <devfile_readmap+0x134>
+  802c1c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802c20:	48 83 c4 38          	add    $0x38,%rsp
+  802c24:	5b                   	pop    %rbx
+  802c25:	41 5c                	pop    %r12
+  802c27:	41 5d                	pop    %r13
+  802c29:	41 5e                	pop    %r14
+  802c2b:	41 5f                	pop    %r15
+  802c2d:	5d                   	pop    %rbp
+  802c2e:	c3                   	ret
+    size_t totalRead = 0;
+  802c2f:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802c36:	00 
+  802c37:	eb da                	jmp    802c13 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c39:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c40:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802c47:	00 00 00 
+  802c4a:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802c4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c50:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802c54:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c58:	4c 89 ee             	mov    %r13,%rsi
+  802c5b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c60:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	7e a3                	jle    802c13 <devfile_readmap+0x5c>
+  802c70:	48 98                	cltq
+  802c72:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c76:	72 9b                	jb     802c13 <devfile_readmap+0x5c>
+        buf += read;
+  802c78:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c7b:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c7e:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c82:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c89:	75 88                	jne    802c13 <devfile_readmap+0x5c>
+  802c8b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c8f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c95:	0f 85 78 ff ff ff    	jne    802c13 <devfile_readmap+0x5c>
+  802c9b:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802ca2:	0f 86 6b ff ff ff    	jbe    802c13 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802ca8:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802cae:	4d 39 e7             	cmp    %r12,%r15
+  802cb1:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802cb5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802cbc:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802cc0:	0f 84 73 ff ff ff    	je     802c39 <devfile_readmap+0x82>
+  802cc6:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cca:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802ccf:	41 ff d6             	call   *%r14
+  802cd2:	a8 40                	test   $0x40,%al
+  802cd4:	0f 85 39 ff ff ff    	jne    802c13 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802cda:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ce1:	4c 39 e3             	cmp    %r12,%rbx
+  802ce4:	72 e4                	jb     802cca <devfile_readmap+0x113>
+  802ce6:	e9 4e ff ff ff       	jmp    802c39 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ceb:	4c 89 fa             	mov    %r15,%rdx
+  802cee:	4c 89 ee             	mov    %r13,%rsi
+  802cf1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802cf5:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802cfc:	00 00 00 
+  802cff:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802d01:	48 85 c0             	test   %rax,%rax
+  802d04:	78 0c                	js     802d12 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802d06:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d0a:	48 01 f0             	add    %rsi,%rax
+  802d0d:	e9 0e ff ff ff       	jmp    802c20 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802d12:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d16:	48 85 f6             	test   %rsi,%rsi
+  802d19:	48 0f 45 c6          	cmovne %rsi,%rax
+  802d1d:	e9 fe fe ff ff       	jmp    802c20 <devfile_readmap+0x69>
+
+0000000000802d22 <open>:
+open(const char *path, int mode) {
+  802d22:	55                   	push   %rbp
+  802d23:	48 89 e5             	mov    %rsp,%rbp
+  802d26:	41 55                	push   %r13
+  802d28:	41 54                	push   %r12
+  802d2a:	53                   	push   %rbx
+  802d2b:	48 83 ec 18          	sub    $0x18,%rsp
+  802d2f:	49 89 fc             	mov    %rdi,%r12
+  802d32:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d35:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  802d3c:	00 00 00 
+  802d3f:	ff d0                	call   *%rax
+  802d41:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d47:	0f 87 8a 00 00 00    	ja     802dd7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d4d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d51:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	89 c3                	mov    %eax,%ebx
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	78 50                	js     802db3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d63:	4c 89 e6             	mov    %r12,%rsi
+  802d66:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802d6d:	00 00 00 
+  802d70:	48 89 df             	mov    %rbx,%rdi
+  802d73:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  802d7a:	00 00 00 
+  802d7d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d7f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d86:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d8a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d8f:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802d96:	00 00 00 
+  802d99:	ff d0                	call   *%rax
+  802d9b:	89 c3                	mov    %eax,%ebx
+  802d9d:	85 c0                	test   %eax,%eax
+  802d9f:	78 1f                	js     802dc0 <open+0x9e>
+    return fd2num(fd);
+  802da1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802da5:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  802dac:	00 00 00 
+  802daf:	ff d0                	call   *%rax
+  802db1:	89 c3                	mov    %eax,%ebx
+}
+  802db3:	89 d8                	mov    %ebx,%eax
+  802db5:	48 83 c4 18          	add    $0x18,%rsp
+  802db9:	5b                   	pop    %rbx
+  802dba:	41 5c                	pop    %r12
+  802dbc:	41 5d                	pop    %r13
+  802dbe:	5d                   	pop    %rbp
+  802dbf:	c3                   	ret
+        fd_close(fd, 0);
+  802dc0:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dc9:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+        return res;
+  802dd5:	eb dc                	jmp    802db3 <open+0x91>
+        return -E_BAD_PATH;
+  802dd7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ddc:	eb d5                	jmp    802db3 <open+0x91>
+
+0000000000802dde <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802dde:	55                   	push   %rbp
+  802ddf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802de2:	be 00 00 00 00       	mov    $0x0,%esi
+  802de7:	bf 13 00 00 00       	mov    $0x13,%edi
+  802dec:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802df3:	00 00 00 
+  802df6:	ff d0                	call   *%rax
+}
+  802df8:	5d                   	pop    %rbp
+  802df9:	c3                   	ret
+
+0000000000802dfa <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802dfa:	55                   	push   %rbp
+  802dfb:	48 89 e5             	mov    %rsp,%rbp
+  802dfe:	41 54                	push   %r12
+  802e00:	53                   	push   %rbx
+  802e01:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e04:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+  802e10:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e13:	48 be a0 40 80 00 00 	movabs $0x8040a0,%rsi
+  802e1a:	00 00 00 
+  802e1d:	48 89 df             	mov    %rbx,%rdi
+  802e20:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e2c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e31:	41 2b 04 24          	sub    (%r12),%eax
+  802e35:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e3b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e42:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e45:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802e4c:	00 00 00 
+  802e4f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5b:	5b                   	pop    %rbx
+  802e5c:	41 5c                	pop    %r12
+  802e5e:	5d                   	pop    %rbp
+  802e5f:	c3                   	ret
+
+0000000000802e60 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802e60:	55                   	push   %rbp
+  802e61:	48 89 e5             	mov    %rsp,%rbp
+  802e64:	41 54                	push   %r12
+  802e66:	53                   	push   %rbx
+  802e67:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e6f:	48 89 fe             	mov    %rdi,%rsi
+  802e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e77:	49 bc d4 13 80 00 00 	movabs $0x8013d4,%r12
+  802e7e:	00 00 00 
+  802e81:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802e84:	48 89 df             	mov    %rbx,%rdi
+  802e87:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+  802e93:	48 89 c6             	mov    %rax,%rsi
+  802e96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea0:	41 ff d4             	call   *%r12
+}
+  802ea3:	5b                   	pop    %rbx
+  802ea4:	41 5c                	pop    %r12
+  802ea6:	5d                   	pop    %rbp
+  802ea7:	c3                   	ret
+
+0000000000802ea8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ea8:	55                   	push   %rbp
+  802ea9:	48 89 e5             	mov    %rsp,%rbp
+  802eac:	41 57                	push   %r15
+  802eae:	41 56                	push   %r14
+  802eb0:	41 55                	push   %r13
+  802eb2:	41 54                	push   %r12
+  802eb4:	53                   	push   %rbx
+  802eb5:	48 83 ec 18          	sub    $0x18,%rsp
+  802eb9:	49 89 fc             	mov    %rdi,%r12
+  802ebc:	49 89 f5             	mov    %rsi,%r13
+  802ebf:	49 89 d7             	mov    %rdx,%r15
+  802ec2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ec6:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  802ecd:	00 00 00 
+  802ed0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802ed2:	4d 85 ff             	test   %r15,%r15
+  802ed5:	0f 84 af 00 00 00    	je     802f8a <devpipe_write+0xe2>
+  802edb:	48 89 c3             	mov    %rax,%rbx
+  802ede:	4c 89 f8             	mov    %r15,%rax
+  802ee1:	4d 89 ef             	mov    %r13,%r15
+  802ee4:	4c 01 e8             	add    %r13,%rax
+  802ee7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802eeb:	49 bd dc 12 80 00 00 	movabs $0x8012dc,%r13
+  802ef2:	00 00 00 
+            sys_yield();
+  802ef5:	49 be 79 12 80 00 00 	movabs $0x801279,%r14
+  802efc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802eff:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f02:	48 63 ce             	movslq %esi,%rcx
+  802f05:	48 63 03             	movslq (%rbx),%rax
+  802f08:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f0e:	48 39 c1             	cmp    %rax,%rcx
+  802f11:	72 2e                	jb     802f41 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f13:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f18:	48 89 da             	mov    %rbx,%rdx
+  802f1b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f20:	4c 89 e7             	mov    %r12,%rdi
+  802f23:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f26:	85 c0                	test   %eax,%eax
+  802f28:	74 66                	je     802f90 <devpipe_write+0xe8>
+            sys_yield();
+  802f2a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f2d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f30:	48 63 ce             	movslq %esi,%rcx
+  802f33:	48 63 03             	movslq (%rbx),%rax
+  802f36:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f3c:	48 39 c1             	cmp    %rax,%rcx
+  802f3f:	73 d2                	jae    802f13 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f41:	41 0f b6 3f          	movzbl (%r15),%edi
+  802f45:	48 89 ca             	mov    %rcx,%rdx
+  802f48:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f4c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f53:	08 10 20 
+  802f56:	48 f7 e2             	mul    %rdx
+  802f59:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f5d:	48 89 d0             	mov    %rdx,%rax
+  802f60:	48 c1 e0 09          	shl    $0x9,%rax
+  802f64:	48 29 d0             	sub    %rdx,%rax
+  802f67:	48 c1 e0 03          	shl    $0x3,%rax
+  802f6b:	48 29 c1             	sub    %rax,%rcx
+  802f6e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802f73:	83 c6 01             	add    $0x1,%esi
+  802f76:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f79:	49 83 c7 01          	add    $0x1,%r15
+  802f7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f81:	49 39 c7             	cmp    %rax,%r15
+  802f84:	0f 85 75 ff ff ff    	jne    802eff <devpipe_write+0x57>
+    return n;
+  802f8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f8e:	eb 05                	jmp    802f95 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f95:	48 83 c4 18          	add    $0x18,%rsp
+  802f99:	5b                   	pop    %rbx
+  802f9a:	41 5c                	pop    %r12
+  802f9c:	41 5d                	pop    %r13
+  802f9e:	41 5e                	pop    %r14
+  802fa0:	41 5f                	pop    %r15
+  802fa2:	5d                   	pop    %rbp
+  802fa3:	c3                   	ret
+
+0000000000802fa4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fa4:	55                   	push   %rbp
+  802fa5:	48 89 e5             	mov    %rsp,%rbp
+  802fa8:	41 57                	push   %r15
+  802faa:	41 56                	push   %r14
+  802fac:	41 55                	push   %r13
+  802fae:	41 54                	push   %r12
+  802fb0:	53                   	push   %rbx
+  802fb1:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb5:	49 89 fc             	mov    %rdi,%r12
+  802fb8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fbc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fc0:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802fcf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fd5:	49 bd dc 12 80 00 00 	movabs $0x8012dc,%r13
+  802fdc:	00 00 00 
+            sys_yield();
+  802fdf:	49 be 79 12 80 00 00 	movabs $0x801279,%r14
+  802fe6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802fe9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fee:	74 7d                	je     80306d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ff0:	8b 03                	mov    (%rbx),%eax
+  802ff2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ff5:	75 26                	jne    80301d <devpipe_read+0x79>
+            if (i > 0) return i;
+  802ff7:	4d 85 ff             	test   %r15,%r15
+  802ffa:	75 77                	jne    803073 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ffc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803001:	48 89 da             	mov    %rbx,%rdx
+  803004:	be 00 10 00 00       	mov    $0x1000,%esi
+  803009:	4c 89 e7             	mov    %r12,%rdi
+  80300c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80300f:	85 c0                	test   %eax,%eax
+  803011:	74 72                	je     803085 <devpipe_read+0xe1>
+            sys_yield();
+  803013:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803016:	8b 03                	mov    (%rbx),%eax
+  803018:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80301b:	74 df                	je     802ffc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80301d:	48 63 c8             	movslq %eax,%rcx
+  803020:	48 89 ca             	mov    %rcx,%rdx
+  803023:	48 c1 ea 03          	shr    $0x3,%rdx
+  803027:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80302e:	08 10 20 
+  803031:	48 89 d0             	mov    %rdx,%rax
+  803034:	48 f7 e6             	mul    %rsi
+  803037:	48 c1 ea 06          	shr    $0x6,%rdx
+  80303b:	48 89 d0             	mov    %rdx,%rax
+  80303e:	48 c1 e0 09          	shl    $0x9,%rax
+  803042:	48 29 d0             	sub    %rdx,%rax
+  803045:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80304c:	00 
+  80304d:	48 89 c8             	mov    %rcx,%rax
+  803050:	48 29 d0             	sub    %rdx,%rax
+  803053:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803058:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80305c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803060:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803063:	49 83 c7 01          	add    $0x1,%r15
+  803067:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80306b:	75 83                	jne    802ff0 <devpipe_read+0x4c>
+    return n;
+  80306d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803071:	eb 03                	jmp    803076 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803073:	4c 89 f8             	mov    %r15,%rax
+}
+  803076:	48 83 c4 18          	add    $0x18,%rsp
+  80307a:	5b                   	pop    %rbx
+  80307b:	41 5c                	pop    %r12
+  80307d:	41 5d                	pop    %r13
+  80307f:	41 5e                	pop    %r14
+  803081:	41 5f                	pop    %r15
+  803083:	5d                   	pop    %rbp
+  803084:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308a:	eb ea                	jmp    803076 <devpipe_read+0xd2>
+
+000000000080308c <pipe>:
+pipe(int pfd[2]) {
+  80308c:	55                   	push   %rbp
+  80308d:	48 89 e5             	mov    %rsp,%rbp
+  803090:	41 55                	push   %r13
+  803092:	41 54                	push   %r12
+  803094:	53                   	push   %rbx
+  803095:	48 83 ec 18          	sub    $0x18,%rsp
+  803099:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80309c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030a0:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+  8030ac:	89 c3                	mov    %eax,%ebx
+  8030ae:	85 c0                	test   %eax,%eax
+  8030b0:	0f 88 a0 01 00 00    	js     803256 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030b6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c9:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  8030d0:	00 00 00 
+  8030d3:	ff d0                	call   *%rax
+  8030d5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030d7:	85 c0                	test   %eax,%eax
+  8030d9:	0f 88 77 01 00 00    	js     803256 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030df:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8030e3:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  8030ea:	00 00 00 
+  8030ed:	ff d0                	call   *%rax
+  8030ef:	89 c3                	mov    %eax,%ebx
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	0f 88 43 01 00 00    	js     80323c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803103:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310c:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	0f 88 1a 01 00 00    	js     80323c <pipe+0x1b0>
+    va = fd2data(fd0);
+  803122:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803126:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  80312d:	00 00 00 
+  803130:	ff d0                	call   *%rax
+  803132:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803135:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80313a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80313f:	48 89 c6             	mov    %rax,%rsi
+  803142:	bf 00 00 00 00       	mov    $0x0,%edi
+  803147:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	89 c3                	mov    %eax,%ebx
+  803155:	85 c0                	test   %eax,%eax
+  803157:	0f 88 c5 00 00 00    	js     803222 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80315d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803161:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+  80316d:	48 89 c1             	mov    %rax,%rcx
+  803170:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803176:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80317c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803181:	4c 89 ee             	mov    %r13,%rsi
+  803184:	bf 00 00 00 00       	mov    $0x0,%edi
+  803189:	48 b8 6f 13 80 00 00 	movabs $0x80136f,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  803195:	89 c3                	mov    %eax,%ebx
+  803197:	85 c0                	test   %eax,%eax
+  803199:	78 6e                	js     803209 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80319b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031a0:	4c 89 ef             	mov    %r13,%rdi
+  8031a3:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  8031aa:	00 00 00 
+  8031ad:	ff d0                	call   *%rax
+  8031af:	83 f8 02             	cmp    $0x2,%eax
+  8031b2:	0f 85 ab 00 00 00    	jne    803263 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031b8:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8031bf:	00 00 
+  8031c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031c5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031c7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031cb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031d2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031d6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031dc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031e3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031e7:	48 bb 52 18 80 00 00 	movabs $0x801852,%rbx
+  8031ee:	00 00 00 
+  8031f1:	ff d3                	call   *%rbx
+  8031f3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8031f7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8031fb:	ff d3                	call   *%rbx
+  8031fd:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803207:	eb 4d                	jmp    803256 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803209:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80320e:	4c 89 ee             	mov    %r13,%rsi
+  803211:	bf 00 00 00 00       	mov    $0x0,%edi
+  803216:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  80321d:	00 00 00 
+  803220:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803222:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803227:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80322b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803230:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  803237:	00 00 00 
+  80323a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80323c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803241:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803245:	bf 00 00 00 00       	mov    $0x0,%edi
+  80324a:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+}
+  803256:	89 d8                	mov    %ebx,%eax
+  803258:	48 83 c4 18          	add    $0x18,%rsp
+  80325c:	5b                   	pop    %rbx
+  80325d:	41 5c                	pop    %r12
+  80325f:	41 5d                	pop    %r13
+  803261:	5d                   	pop    %rbp
+  803262:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803263:	48 b9 d0 40 80 00 00 	movabs $0x8040d0,%rcx
+  80326a:	00 00 00 
+  80326d:	48 ba a7 40 80 00 00 	movabs $0x8040a7,%rdx
+  803274:	00 00 00 
+  803277:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80327c:	48 bf bc 40 80 00 00 	movabs $0x8040bc,%rdi
+  803283:	00 00 00 
+  803286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328b:	49 b8 e3 36 80 00 00 	movabs $0x8036e3,%r8
+  803292:	00 00 00 
+  803295:	41 ff d0             	call   *%r8
+
+0000000000803298 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803298:	55                   	push   %rbp
+  803299:	48 89 e5             	mov    %rsp,%rbp
+  80329c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032a0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032a4:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  8032ab:	00 00 00 
+  8032ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 35                	js     8032e9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032b4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032b8:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  8032bf:	00 00 00 
+  8032c2:	ff d0                	call   *%rax
+  8032c4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032d5:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	85 c0                	test   %eax,%eax
+  8032e3:	0f 94 c0             	sete   %al
+  8032e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8032e9:	c9                   	leave
+  8032ea:	c3                   	ret
+
+00000000008032eb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032eb:	48 89 f8             	mov    %rdi,%rax
+  8032ee:	48 c1 e8 27          	shr    $0x27,%rax
+  8032f2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032f9:	01 00 00 
+  8032fc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803300:	f6 c2 01             	test   $0x1,%dl
+  803303:	74 6d                	je     803372 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803305:	48 89 f8             	mov    %rdi,%rax
+  803308:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80330c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803313:	01 00 00 
+  803316:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80331a:	f6 c2 01             	test   $0x1,%dl
+  80331d:	74 62                	je     803381 <get_uvpt_entry+0x96>
+  80331f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803326:	01 00 00 
+  803329:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80332d:	f6 c2 80             	test   $0x80,%dl
+  803330:	75 4f                	jne    803381 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803332:	48 89 f8             	mov    %rdi,%rax
+  803335:	48 c1 e8 15          	shr    $0x15,%rax
+  803339:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803340:	01 00 00 
+  803343:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803347:	f6 c2 01             	test   $0x1,%dl
+  80334a:	74 44                	je     803390 <get_uvpt_entry+0xa5>
+  80334c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803353:	01 00 00 
+  803356:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80335a:	f6 c2 80             	test   $0x80,%dl
+  80335d:	75 31                	jne    803390 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80335f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803363:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80336a:	01 00 00 
+  80336d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803371:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803372:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803379:	01 00 00 
+  80337c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803380:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803381:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803388:	01 00 00 
+  80338b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80338f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803390:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803397:	01 00 00 
+  80339a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80339e:	c3                   	ret
+
+000000000080339f <get_prot>:
+
+int
+get_prot(void *va) {
+  80339f:	55                   	push   %rbp
+  8033a0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033a3:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+  8033af:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8033b2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8033b7:	89 c1                	mov    %eax,%ecx
+  8033b9:	83 c9 04             	or     $0x4,%ecx
+  8033bc:	f6 c2 01             	test   $0x1,%dl
+  8033bf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8033c2:	89 c1                	mov    %eax,%ecx
+  8033c4:	83 c9 02             	or     $0x2,%ecx
+  8033c7:	f6 c2 02             	test   $0x2,%dl
+  8033ca:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8033cd:	89 c1                	mov    %eax,%ecx
+  8033cf:	83 c9 01             	or     $0x1,%ecx
+  8033d2:	48 85 d2             	test   %rdx,%rdx
+  8033d5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8033d8:	89 c1                	mov    %eax,%ecx
+  8033da:	83 c9 40             	or     $0x40,%ecx
+  8033dd:	f6 c6 04             	test   $0x4,%dh
+  8033e0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8033e3:	5d                   	pop    %rbp
+  8033e4:	c3                   	ret
+
+00000000008033e5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8033e5:	55                   	push   %rbp
+  8033e6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033e9:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8033f5:	48 c1 e8 06          	shr    $0x6,%rax
+  8033f9:	83 e0 01             	and    $0x1,%eax
+}
+  8033fc:	5d                   	pop    %rbp
+  8033fd:	c3                   	ret
+
+00000000008033fe <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8033fe:	55                   	push   %rbp
+  8033ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803402:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80340e:	48 c1 e8 05          	shr    $0x5,%rax
+  803412:	83 e0 01             	and    $0x1,%eax
+}
+  803415:	5d                   	pop    %rbp
+  803416:	c3                   	ret
+
+0000000000803417 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803417:	55                   	push   %rbp
+  803418:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80341b:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+  803427:	83 e0 01             	and    $0x1,%eax
+}
+  80342a:	5d                   	pop    %rbp
+  80342b:	c3                   	ret
+
+000000000080342c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80342c:	55                   	push   %rbp
+  80342d:	48 89 e5             	mov    %rsp,%rbp
+  803430:	41 57                	push   %r15
+  803432:	41 56                	push   %r14
+  803434:	41 55                	push   %r13
+  803436:	41 54                	push   %r12
+  803438:	53                   	push   %rbx
+  803439:	48 83 ec 18          	sub    $0x18,%rsp
+  80343d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803441:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803445:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80344a:	49 bd 17 34 80 00 00 	movabs $0x803417,%r13
+  803451:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803454:	49 bf 9f 33 80 00 00 	movabs $0x80339f,%r15
+  80345b:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80345e:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803465:	00 00 00 
+  803468:	eb 0c                	jmp    803476 <foreach_shared_region+0x4a>
+  80346a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803471:	4c 39 f3             	cmp    %r14,%rbx
+  803474:	74 2e                	je     8034a4 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803476:	48 89 df             	mov    %rbx,%rdi
+  803479:	41 ff d5             	call   *%r13
+  80347c:	84 c0                	test   %al,%al
+  80347e:	74 ea                	je     80346a <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803480:	48 89 df             	mov    %rbx,%rdi
+  803483:	41 ff d7             	call   *%r15
+  803486:	a8 40                	test   $0x40,%al
+  803488:	74 e0                	je     80346a <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80348a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803491:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803495:	48 89 df             	mov    %rbx,%rdi
+  803498:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80349c:	ff d0                	call   *%rax
+				if (res < 0) {
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	79 c8                	jns    80346a <foreach_shared_region+0x3e>
+  8034a2:	eb 05                	jmp    8034a9 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8034a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034a9:	48 83 c4 18          	add    $0x18,%rsp
+  8034ad:	5b                   	pop    %rbx
+  8034ae:	41 5c                	pop    %r12
+  8034b0:	41 5d                	pop    %r13
+  8034b2:	41 5e                	pop    %r14
+  8034b4:	41 5f                	pop    %r15
+  8034b6:	5d                   	pop    %rbp
+  8034b7:	c3                   	ret
+
+00000000008034b8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8034b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034bd:	c3                   	ret
+
+00000000008034be <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8034be:	55                   	push   %rbp
+  8034bf:	48 89 e5             	mov    %rsp,%rbp
+  8034c2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8034c5:	48 be f4 40 80 00 00 	movabs $0x8040f4,%rsi
+  8034cc:	00 00 00 
+  8034cf:	48 b8 7c 0c 80 00 00 	movabs $0x800c7c,%rax
+  8034d6:	00 00 00 
+  8034d9:	ff d0                	call   *%rax
+    return 0;
+}
+  8034db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e0:	5d                   	pop    %rbp
+  8034e1:	c3                   	ret
+
+00000000008034e2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034e2:	55                   	push   %rbp
+  8034e3:	48 89 e5             	mov    %rsp,%rbp
+  8034e6:	41 57                	push   %r15
+  8034e8:	41 56                	push   %r14
+  8034ea:	41 55                	push   %r13
+  8034ec:	41 54                	push   %r12
+  8034ee:	53                   	push   %rbx
+  8034ef:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8034f6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8034fd:	48 85 d2             	test   %rdx,%rdx
+  803500:	74 7a                	je     80357c <devcons_write+0x9a>
+  803502:	49 89 d6             	mov    %rdx,%r14
+  803505:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80350b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803510:	49 bf 76 0e 80 00 00 	movabs $0x800e76,%r15
+  803517:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80351a:	4c 89 f3             	mov    %r14,%rbx
+  80351d:	48 29 f3             	sub    %rsi,%rbx
+  803520:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803525:	48 39 c3             	cmp    %rax,%rbx
+  803528:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80352c:	4c 63 eb             	movslq %ebx,%r13
+  80352f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803536:	48 01 c6             	add    %rax,%rsi
+  803539:	4c 89 ea             	mov    %r13,%rdx
+  80353c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803543:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803546:	4c 89 ee             	mov    %r13,%rsi
+  803549:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803550:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80355c:	41 01 dc             	add    %ebx,%r12d
+  80355f:	49 63 f4             	movslq %r12d,%rsi
+  803562:	4c 39 f6             	cmp    %r14,%rsi
+  803565:	72 b3                	jb     80351a <devcons_write+0x38>
+    return res;
+  803567:	49 63 c4             	movslq %r12d,%rax
+}
+  80356a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803571:	5b                   	pop    %rbx
+  803572:	41 5c                	pop    %r12
+  803574:	41 5d                	pop    %r13
+  803576:	41 5e                	pop    %r14
+  803578:	41 5f                	pop    %r15
+  80357a:	5d                   	pop    %rbp
+  80357b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80357c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803582:	eb e3                	jmp    803567 <devcons_write+0x85>
+
+0000000000803584 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803584:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80358c:	48 85 c0             	test   %rax,%rax
+  80358f:	74 55                	je     8035e6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803591:	55                   	push   %rbp
+  803592:	48 89 e5             	mov    %rsp,%rbp
+  803595:	41 55                	push   %r13
+  803597:	41 54                	push   %r12
+  803599:	53                   	push   %rbx
+  80359a:	48 83 ec 08          	sub    $0x8,%rsp
+  80359e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8035a1:	48 bb ac 11 80 00 00 	movabs $0x8011ac,%rbx
+  8035a8:	00 00 00 
+  8035ab:	49 bc 79 12 80 00 00 	movabs $0x801279,%r12
+  8035b2:	00 00 00 
+  8035b5:	eb 03                	jmp    8035ba <devcons_read+0x36>
+  8035b7:	41 ff d4             	call   *%r12
+  8035ba:	ff d3                	call   *%rbx
+  8035bc:	85 c0                	test   %eax,%eax
+  8035be:	74 f7                	je     8035b7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8035c0:	48 63 d0             	movslq %eax,%rdx
+  8035c3:	78 13                	js     8035d8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8035c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ca:	83 f8 04             	cmp    $0x4,%eax
+  8035cd:	74 09                	je     8035d8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8035cf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8035d3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8035d8:	48 89 d0             	mov    %rdx,%rax
+  8035db:	48 83 c4 08          	add    $0x8,%rsp
+  8035df:	5b                   	pop    %rbx
+  8035e0:	41 5c                	pop    %r12
+  8035e2:	41 5d                	pop    %r13
+  8035e4:	5d                   	pop    %rbp
+  8035e5:	c3                   	ret
+  8035e6:	48 89 d0             	mov    %rdx,%rax
+  8035e9:	c3                   	ret
+
+00000000008035ea <cputchar>:
+cputchar(int ch) {
+  8035ea:	55                   	push   %rbp
+  8035eb:	48 89 e5             	mov    %rsp,%rbp
+  8035ee:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8035f2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8035f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8035fb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8035ff:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+}
+  80360b:	c9                   	leave
+  80360c:	c3                   	ret
+
+000000000080360d <getchar>:
+getchar(void) {
+  80360d:	55                   	push   %rbp
+  80360e:	48 89 e5             	mov    %rsp,%rbp
+  803611:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803615:	ba 01 00 00 00       	mov    $0x1,%edx
+  80361a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80361e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803623:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803631:	85 c0                	test   %eax,%eax
+  803633:	78 06                	js     80363b <getchar+0x2e>
+  803635:	74 08                	je     80363f <getchar+0x32>
+  803637:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80363b:	89 d0                	mov    %edx,%eax
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80363f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803644:	eb f5                	jmp    80363b <getchar+0x2e>
+
+0000000000803646 <iscons>:
+iscons(int fdnum) {
+  803646:	55                   	push   %rbp
+  803647:	48 89 e5             	mov    %rsp,%rbp
+  80364a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80364e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803652:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  803659:	00 00 00 
+  80365c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	78 18                	js     80367a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803662:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803666:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80366d:	00 00 00 
+  803670:	8b 00                	mov    (%rax),%eax
+  803672:	39 02                	cmp    %eax,(%rdx)
+  803674:	0f 94 c0             	sete   %al
+  803677:	0f b6 c0             	movzbl %al,%eax
+}
+  80367a:	c9                   	leave
+  80367b:	c3                   	ret
+
+000000000080367c <opencons>:
+opencons(void) {
+  80367c:	55                   	push   %rbp
+  80367d:	48 89 e5             	mov    %rsp,%rbp
+  803680:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803684:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803688:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  80368f:	00 00 00 
+  803692:	ff d0                	call   *%rax
+  803694:	85 c0                	test   %eax,%eax
+  803696:	78 49                	js     8036e1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803698:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80369d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8036a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ab:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+  8036b7:	85 c0                	test   %eax,%eax
+  8036b9:	78 26                	js     8036e1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8036bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036bf:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8036c6:	00 00 
+  8036c8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8036ca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036ce:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8036d5:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+}
+  8036e1:	c9                   	leave
+  8036e2:	c3                   	ret
+
+00000000008036e3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8036e3:	55                   	push   %rbp
+  8036e4:	48 89 e5             	mov    %rsp,%rbp
+  8036e7:	41 56                	push   %r14
+  8036e9:	41 55                	push   %r13
+  8036eb:	41 54                	push   %r12
+  8036ed:	53                   	push   %rbx
+  8036ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8036f2:	49 89 fc             	mov    %rdi,%r12
+  8036f5:	41 89 f5             	mov    %esi,%r13d
+  8036f8:	48 89 d3             	mov    %rdx,%rbx
+  8036fb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8036ff:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803703:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803707:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80370e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803712:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803716:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80371a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80371e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803725:	00 00 00 
+  803728:	4c 8b 30             	mov    (%rax),%r14
+  80372b:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  803732:	00 00 00 
+  803735:	ff d0                	call   *%rax
+  803737:	89 c6                	mov    %eax,%esi
+  803739:	45 89 e8             	mov    %r13d,%r8d
+  80373c:	4c 89 e1             	mov    %r12,%rcx
+  80373f:	4c 89 f2             	mov    %r14,%rdx
+  803742:	48 bf 00 41 80 00 00 	movabs $0x804100,%rdi
+  803749:	00 00 00 
+  80374c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803751:	49 bc 57 03 80 00 00 	movabs $0x800357,%r12
+  803758:	00 00 00 
+  80375b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80375e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803762:	48 89 df             	mov    %rbx,%rdi
+  803765:	48 b8 f3 02 80 00 00 	movabs $0x8002f3,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+    cprintf("\n");
+  803771:	48 bf 68 3a 80 00 00 	movabs $0x803a68,%rdi
+  803778:	00 00 00 
+  80377b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803780:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803783:	cc                   	int3
+  803784:	eb fd                	jmp    803783 <_panic+0xa0>
+
+0000000000803786 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803786:	55                   	push   %rbp
+  803787:	48 89 e5             	mov    %rsp,%rbp
+  80378a:	41 55                	push   %r13
+  80378c:	41 54                	push   %r12
+  80378e:	53                   	push   %rbx
+  80378f:	48 83 ec 08          	sub    $0x8,%rsp
+  803793:	49 89 fc             	mov    %rdi,%r12
+  803796:	48 89 f7             	mov    %rsi,%rdi
+  803799:	48 89 d3             	mov    %rdx,%rbx
+  80379c:	49 89 cd             	mov    %rcx,%r13
+  80379f:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8037a2:	48 85 f6             	test   %rsi,%rsi
+  8037a5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037ac:	00 00 00 
+  8037af:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8037b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037b8:	48 85 db             	test   %rbx,%rbx
+  8037bb:	74 03                	je     8037c0 <ipc_recv_timed+0x3a>
+  8037bd:	48 8b 33             	mov    (%rbx),%rsi
+  8037c0:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  8037c7:	00 00 00 
+  8037ca:	ff d0                	call   *%rax
+    if (res < 0) {
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	78 75                	js     803845 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8037d0:	4d 85 e4             	test   %r12,%r12
+  8037d3:	74 14                	je     8037e9 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8037d5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037dc:	00 00 00 
+  8037df:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8037e5:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8037e9:	4d 85 ed             	test   %r13,%r13
+  8037ec:	74 14                	je     803802 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8037ee:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037f5:	00 00 00 
+  8037f8:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8037fe:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803802:	48 85 db             	test   %rbx,%rbx
+  803805:	74 23                	je     80382a <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803807:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80380e:	00 00 00 
+  803811:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80381c:	85 c9                	test   %ecx,%ecx
+  80381e:	74 07                	je     803827 <ipc_recv_timed+0xa1>
+  803820:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803827:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80382a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803831:	00 00 00 
+  803834:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80383a:	48 83 c4 08          	add    $0x8,%rsp
+  80383e:	5b                   	pop    %rbx
+  80383f:	41 5c                	pop    %r12
+  803841:	41 5d                	pop    %r13
+  803843:	5d                   	pop    %rbp
+  803844:	c3                   	ret
+        if (from_env_store != NULL) {
+  803845:	4d 85 e4             	test   %r12,%r12
+  803848:	74 08                	je     803852 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80384a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803851:	00 
+        if (perm_store != NULL) {
+  803852:	4d 85 ed             	test   %r13,%r13
+  803855:	74 08                	je     80385f <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803857:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80385e:	00 
+        if (size != NULL) {
+  80385f:	48 85 db             	test   %rbx,%rbx
+  803862:	74 d6                	je     80383a <ipc_recv_timed+0xb4>
+            *size = 0;
+  803864:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80386b:	eb cd                	jmp    80383a <ipc_recv_timed+0xb4>
+
+000000000080386d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80386d:	55                   	push   %rbp
+  80386e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803871:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803877:	48 b8 86 37 80 00 00 	movabs $0x803786,%rax
+  80387e:	00 00 00 
+  803881:	ff d0                	call   *%rax
+}
+  803883:	5d                   	pop    %rbp
+  803884:	c3                   	ret
+
+0000000000803885 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803885:	55                   	push   %rbp
+  803886:	48 89 e5             	mov    %rsp,%rbp
+  803889:	41 57                	push   %r15
+  80388b:	41 56                	push   %r14
+  80388d:	41 55                	push   %r13
+  80388f:	41 54                	push   %r12
+  803891:	53                   	push   %rbx
+  803892:	48 83 ec 18          	sub    $0x18,%rsp
+  803896:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803899:	48 89 d3             	mov    %rdx,%rbx
+  80389c:	49 89 cc             	mov    %rcx,%r12
+  80389f:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038a2:	48 85 d2             	test   %rdx,%rdx
+  8038a5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038ac:	00 00 00 
+  8038af:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038b3:	89 f0                	mov    %esi,%eax
+  8038b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038b9:	48 89 da             	mov    %rbx,%rdx
+  8038bc:	48 89 c6             	mov    %rax,%rsi
+  8038bf:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+    while (res < 0) {
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	79 65                	jns    803934 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8038cf:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038d2:	75 33                	jne    803907 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8038d4:	49 bf 79 12 80 00 00 	movabs $0x801279,%r15
+  8038db:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038de:	49 be 76 15 80 00 00 	movabs $0x801576,%r14
+  8038e5:	00 00 00 
+        sys_yield();
+  8038e8:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038eb:	45 89 e8             	mov    %r13d,%r8d
+  8038ee:	4c 89 e1             	mov    %r12,%rcx
+  8038f1:	48 89 da             	mov    %rbx,%rdx
+  8038f4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8038f8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8038fb:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8038fe:	85 c0                	test   %eax,%eax
+  803900:	79 32                	jns    803934 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803902:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803905:	74 e1                	je     8038e8 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803907:	89 c1                	mov    %eax,%ecx
+  803909:	48 ba 23 41 80 00 00 	movabs $0x804123,%rdx
+  803910:	00 00 00 
+  803913:	be 52 00 00 00       	mov    $0x52,%esi
+  803918:	48 bf 37 41 80 00 00 	movabs $0x804137,%rdi
+  80391f:	00 00 00 
+  803922:	b8 00 00 00 00       	mov    $0x0,%eax
+  803927:	49 b8 e3 36 80 00 00 	movabs $0x8036e3,%r8
+  80392e:	00 00 00 
+  803931:	41 ff d0             	call   *%r8
+    }
+}
+  803934:	48 83 c4 18          	add    $0x18,%rsp
+  803938:	5b                   	pop    %rbx
+  803939:	41 5c                	pop    %r12
+  80393b:	41 5d                	pop    %r13
+  80393d:	41 5e                	pop    %r14
+  80393f:	41 5f                	pop    %r15
+  803941:	5d                   	pop    %rbp
+  803942:	c3                   	ret
+
+0000000000803943 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803943:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803948:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80394f:	00 00 00 
+  803952:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803956:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80395a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80395e:	48 01 ca             	add    %rcx,%rdx
+  803961:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803967:	39 fa                	cmp    %edi,%edx
+  803969:	74 12                	je     80397d <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80396b:	48 83 c0 01          	add    $0x1,%rax
+  80396f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803975:	75 db                	jne    803952 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397c:	c3                   	ret
+            return envs[i].env_id;
+  80397d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803981:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803985:	48 c1 e2 04          	shl    $0x4,%rdx
+  803989:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803990:	00 00 00 
+  803993:	48 01 d0             	add    %rdx,%rax
+  803996:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80399c:	c3                   	ret
+  80399d:	0f 1f 00             	nopl   (%rax)
+
+00000000008039a0 <__rodata_start>:
+  8039a0:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  8039a2:	74 20                	je     8039c4 <__rodata_start+0x24>
+  8039a4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039a6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039a7:	75 67                	jne    803a10 <__rodata_start+0x70>
+  8039a9:	68 20 61 72 67       	push   $0x67726120
+  8039ae:	75 6d                	jne    803a1d <__rodata_start+0x7d>
+  8039b0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039b2:	74 73                	je     803a27 <__rodata_start+0x87>
+  8039b4:	20 66 6f             	and    %ah,0x6f(%rsi)
+  8039b7:	72 20                	jb     8039d9 <__rodata_start+0x39>
+  8039b9:	63 72 65             	movsxd 0x65(%rdx),%esi
+  8039bc:	61                   	(bad)
+  8039bd:	74 69                	je     803a28 <__rodata_start+0x88>
+  8039bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c0:	67 20 73 6e          	and    %dh,0x6e(%ebx)
+  8039c4:	61                   	(bad)
+  8039c5:	70 73                	jo     803a3a <__rodata_start+0x9a>
+  8039c7:	68 6f 74 0a 00       	push   $0xa746f
+  8039cc:	00 00                	add    %al,(%rax)
+  8039ce:	00 00                	add    %al,(%rax)
+  8039d0:	20 20                	and    %ah,(%rax)
+  8039d2:	20 20                	and    %ah,(%rax)
+  8039d4:	20 20                	and    %ah,(%rax)
+  8039d6:	20 61 72             	and    %ah,0x72(%rcx)
+  8039d9:	67 20 70 6f          	and    %dh,0x6f(%eax)
+  8039dd:	73 69                	jae    803a48 <__rodata_start+0xa8>
+  8039df:	74 69                	je     803a4a <__rodata_start+0xaa>
+  8039e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039e3:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e15a4d <__bss_end+0x7260ca4d>
+  8039e9:	67 75 6d             	addr32 jne 803a59 <__rodata_start+0xb9>
+  8039ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039ee:	74 3a                	je     803a2a <__rodata_start+0x8a>
+  8039f0:	25 73 0a 00 00       	and    $0xa73,%eax
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 54 6f 6f          	add    %dl,0x6f(%rdi,%rbp,2)
+  8039fb:	20 6d 75             	and    %ch,0x75(%rbp)
+  8039fe:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803a01:	61                   	(bad)
+  803a02:	72 67                	jb     803a6b <__rodata_start+0xcb>
+  803a04:	75 6d                	jne    803a73 <__rodata_start+0xd3>
+  803a06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a08:	74 73                	je     803a7d <__rodata_start+0xdd>
+  803a0a:	20 66 6f             	and    %ah,0x6f(%rsi)
+  803a0d:	72 20                	jb     803a2f <__rodata_start+0x8f>
+  803a0f:	63 72 65             	movsxd 0x65(%rdx),%esi
+  803a12:	61                   	(bad)
+  803a13:	74 69                	je     803a7e <__rodata_start+0xde>
+  803a15:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a16:	67 20 73 6e          	and    %dh,0x6e(%ebx)
+  803a1a:	61                   	(bad)
+  803a1b:	70 73                	jo     803a90 <__rodata_start+0xf0>
+  803a1d:	68 6f 74 0a 00       	push   $0xa746f
+  803a22:	00 00                	add    %al,(%rax)
+  803a24:	00 00                	add    %al,(%rax)
+  803a26:	00 00                	add    %al,(%rax)
+  803a28:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  803a2a:	76 61                	jbe    803a8d <__rodata_start+0xed>
+  803a2c:	6c                   	insb   (%dx),%es:(%rdi)
+  803a2d:	69 64 20 61 72 67 75 	imul   $0x6d756772,0x61(%rax,%riz,1),%esp
+  803a34:	6d 
+  803a35:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a37:	74 73                	je     803aac <__rodata_start+0x10c>
+  803a39:	20 66 6f             	and    %ah,0x6f(%rsi)
+  803a3c:	72 20                	jb     803a5e <__rodata_start+0xbe>
+  803a3e:	63 72 65             	movsxd 0x65(%rdx),%esi
+  803a41:	61                   	(bad)
+  803a42:	74 69                	je     803aad <__rodata_start+0x10d>
+  803a44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a45:	67 20 73 6e          	and    %dh,0x6e(%ebx)
+  803a49:	61                   	(bad)
+  803a4a:	70 73                	jo     803abf <__rodata_start+0x11f>
+  803a4c:	68 6f 74 0a 00       	push   $0xa746f
+  803a51:	53                   	push   %rbx
+  803a52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a53:	61                   	(bad)
+  803a54:	70 73                	jo     803ac9 <__rodata_start+0x129>
+  803a56:	68 6f 74 20 69       	push   $0x6920746f
+  803a5b:	73 20                	jae    803a7d <__rodata_start+0xdd>
+  803a5d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a5e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a5f:	74 20                	je     803a81 <__rodata_start+0xe1>
+  803a61:	63 72 65             	movsxd 0x65(%rdx),%esi
+  803a64:	61                   	(bad)
+  803a65:	74 65                	je     803acc <__rodata_start+0x12c>
+  803a67:	64 0a 00             	or     %fs:(%rax),%al
+  803a6a:	3c 75                	cmp    $0x75,%al
+  803a6c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a6d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803a71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a72:	3e 00 30             	ds add %dh,(%rax)
+  803a75:	31 32                	xor    %esi,(%rdx)
+  803a77:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a7e:	41                   	rex.B
+  803a7f:	42                   	rex.X
+  803a80:	43                   	rex.XB
+  803a81:	44                   	rex.R
+  803a82:	45                   	rex.RB
+  803a83:	46 00 30             	rex.RX add %r14b,(%rax)
+  803a86:	31 32                	xor    %esi,(%rdx)
+  803a88:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a8f:	61                   	(bad)
+  803a90:	62 63 64 65 66       	(bad)
+  803a95:	00 28                	add    %ch,(%rax)
+  803a97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a98:	75 6c                	jne    803b06 <__rodata_start+0x166>
+  803a9a:	6c                   	insb   (%dx),%es:(%rdi)
+  803a9b:	29 00                	sub    %eax,(%rax)
+  803a9d:	65 72 72             	gs jb  803b12 <__rodata_start+0x172>
+  803aa0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aa1:	72 20                	jb     803ac3 <__rodata_start+0x123>
+  803aa3:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803aa8:	73 70                	jae    803b1a <__rodata_start+0x17a>
+  803aaa:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803aae:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803ab5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ab6:	72 00                	jb     803ab8 <__rodata_start+0x118>
+  803ab8:	62 61 64 20 65       	(bad)
+  803abd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803abe:	76 69                	jbe    803b29 <__rodata_start+0x189>
+  803ac0:	72 6f                	jb     803b31 <__rodata_start+0x191>
+  803ac2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ac3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ac4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ac6:	74 00                	je     803ac8 <__rodata_start+0x128>
+  803ac8:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803acf:	20 70 61             	and    %dh,0x61(%rax)
+  803ad2:	72 61                	jb     803b35 <__rodata_start+0x195>
+  803ad4:	6d                   	insl   (%dx),%es:(%rdi)
+  803ad5:	65 74 65             	gs je  803b3d <__rodata_start+0x19d>
+  803ad8:	72 00                	jb     803ada <__rodata_start+0x13a>
+  803ada:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803adb:	75 74                	jne    803b51 <__rodata_start+0x1b1>
+  803add:	20 6f 66             	and    %ch,0x66(%rdi)
+  803ae0:	20 6d 65             	and    %ch,0x65(%rbp)
+  803ae3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ae4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ae5:	72 79                	jb     803b60 <__rodata_start+0x1c0>
+  803ae7:	00 6f 75             	add    %ch,0x75(%rdi)
+  803aea:	74 20                	je     803b0c <__rodata_start+0x16c>
+  803aec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aed:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803af1:	76 69                	jbe    803b5c <__rodata_start+0x1bc>
+  803af3:	72 6f                	jb     803b64 <__rodata_start+0x1c4>
+  803af5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803af6:	6d                   	insl   (%dx),%es:(%rdi)
+  803af7:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803af9:	74 73                	je     803b6e <__rodata_start+0x1ce>
+  803afb:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803afe:	72 72                	jb     803b72 <__rodata_start+0x1d2>
+  803b00:	75 70                	jne    803b72 <__rodata_start+0x1d2>
+  803b02:	74 65                	je     803b69 <__rodata_start+0x1c9>
+  803b04:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b09:	75 67                	jne    803b72 <__rodata_start+0x1d2>
+  803b0b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b0e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b10:	00 73 65             	add    %dh,0x65(%rbx)
+  803b13:	67 6d                	insl   (%dx),%es:(%edi)
+  803b15:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b17:	74 61                	je     803b7a <__rodata_start+0x1da>
+  803b19:	74 69                	je     803b84 <__rodata_start+0x1e4>
+  803b1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b1c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1d:	20 66 61             	and    %ah,0x61(%rsi)
+  803b20:	75 6c                	jne    803b8e <__rodata_start+0x1ee>
+  803b22:	74 00                	je     803b24 <__rodata_start+0x184>
+  803b24:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b2b:	20 45 4c             	and    %al,0x4c(%rbp)
+  803b2e:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803b32:	61                   	(bad)
+  803b33:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803b38:	20 73 75             	and    %dh,0x75(%rbx)
+  803b3b:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803b3e:	73 79                	jae    803bb9 <__rodata_start+0x219>
+  803b40:	73 74                	jae    803bb6 <__rodata_start+0x216>
+  803b42:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b44:	20 63 61             	and    %ah,0x61(%rbx)
+  803b47:	6c                   	insb   (%dx),%es:(%rdi)
+  803b48:	6c                   	insb   (%dx),%es:(%rdi)
+  803b49:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803b4c:	74 72                	je     803bc0 <__rodata_start+0x220>
+  803b4e:	79 20                	jns    803b70 <__rodata_start+0x1d0>
+  803b50:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b52:	74 20                	je     803b74 <__rodata_start+0x1d4>
+  803b54:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b56:	75 6e                	jne    803bc6 <__rodata_start+0x226>
+  803b58:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803b5c:	76 20                	jbe    803b7e <__rodata_start+0x1de>
+  803b5e:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803b65:	72 65                	jb     803bcc <__rodata_start+0x22c>
+  803b67:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803b6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b6b:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803b6f:	65 78 70             	gs js  803be2 <__rodata_start+0x242>
+  803b72:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803b77:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803b7a:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803b7e:	20 66 69             	and    %ah,0x69(%rsi)
+  803b81:	6c                   	insb   (%dx),%es:(%rdi)
+  803b82:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803b86:	20 66 72             	and    %ah,0x72(%rsi)
+  803b89:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803b8e:	61                   	(bad)
+  803b8f:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b93:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b94:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b98:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803b9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b9d:	20 6d 61             	and    %ch,0x61(%rbp)
+  803ba0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba1:	79 20                	jns    803bc3 <__rodata_start+0x223>
+  803ba3:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803baa:	72 65                	jb     803c11 <__rodata_start+0x271>
+  803bac:	20 6f 70             	and    %ch,0x70(%rdi)
+  803baf:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bb1:	00 66 69             	add    %ah,0x69(%rsi)
+  803bb4:	6c                   	insb   (%dx),%es:(%rdi)
+  803bb5:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803bb9:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803bbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbd:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803bc0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bc2:	74 20                	je     803be4 <__rodata_start+0x244>
+  803bc4:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bc6:	75 6e                	jne    803c36 <__rodata_start+0x296>
+  803bc8:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803bcc:	76 61                	jbe    803c2f <__rodata_start+0x28f>
+  803bce:	6c                   	insb   (%dx),%es:(%rdi)
+  803bcf:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803bd6:	00 
+  803bd7:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803bde:	72 65                	jb     803c45 <__rodata_start+0x2a5>
+  803be0:	61                   	(bad)
+  803be1:	64 79 20             	fs jns 803c04 <__rodata_start+0x264>
+  803be4:	65 78 69             	gs js  803c50 <__rodata_start+0x2b0>
+  803be7:	73 74                	jae    803c5d <__rodata_start+0x2bd>
+  803be9:	73 00                	jae    803beb <__rodata_start+0x24b>
+  803beb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bec:	70 65                	jo     803c53 <__rodata_start+0x2b3>
+  803bee:	72 61                	jb     803c51 <__rodata_start+0x2b1>
+  803bf0:	74 69                	je     803c5b <__rodata_start+0x2bb>
+  803bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf4:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803bf7:	74 20                	je     803c19 <__rodata_start+0x279>
+  803bf9:	73 75                	jae    803c70 <__rodata_start+0x2d0>
+  803bfb:	70 70                	jo     803c6d <__rodata_start+0x2cd>
+  803bfd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bfe:	72 74                	jb     803c74 <__rodata_start+0x2d4>
+  803c00:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803c06:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803c0b:	74 00                	je     803c0d <__rodata_start+0x26d>
+  803c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c14:	00 00 00 
+  803c17:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  803c1e:	00 00 
+  803c20:	44 05 80 00 00 00    	rex.R add $0x80,%eax
+  803c26:	00 00                	add    %al,(%rax)
+  803c28:	85 0b                	test   %ecx,(%rbx)
+  803c2a:	80 00 00             	addb   $0x0,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 75 0b             	add    %dh,0xb(%rbp)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 63 05             	add    %ah,0x5(%rbx)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 57 05             	add    %dl,0x5(%rdi)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 d1                	add    %dl,%cl
+  803c79:	05 80 00 00 00       	add    $0x80,%eax
+  803c7e:	00 00                	add    %al,(%rax)
+  803c80:	85 0b                	test   %ecx,(%rbx)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 57 05             	add    %dl,0x5(%rdi)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 f4                	add    %dh,%ah
+  803e21:	05 80 00 00 00       	add    $0x80,%eax
+  803e26:	00 00                	add    %al,(%rax)
+  803e28:	c3                   	ret
+  803e29:	07                   	(bad)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 23                	add    %ah,(%rbx)
+  803e51:	06                   	(bad)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 e9                	add    %ch,%cl
+  803e69:	05 80 00 00 00       	add    $0x80,%eax
+  803e6e:	00 00                	add    %al,(%rax)
+  803e70:	85 0b                	test   %ecx,(%rbx)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 6b 09             	add    %ch,0x9(%rbx)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 35 0a 80 00 00    	add    %dh,0x800a(%rip)        # 80be97 <__bss_end+0x2e97>
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 ba 06 80 00 00    	add    %bh,0x8006(%rdx)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 97 08 80 00 00    	add    %dl,0x8008(%rdi)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 4d 05             	add    %cl,0x5(%rbp)
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803ee0 <error_string>:
+	...
+  803ee8:	a6 3a 80 00 00 00 00 00 b8 3a 80 00 00 00 00 00     .:.......:......
+  803ef8:	c8 3a 80 00 00 00 00 00 da 3a 80 00 00 00 00 00     .:.......:......
+  803f08:	e8 3a 80 00 00 00 00 00 fc 3a 80 00 00 00 00 00     .:.......:......
+  803f18:	11 3b 80 00 00 00 00 00 24 3b 80 00 00 00 00 00     .;......$;......
+  803f28:	36 3b 80 00 00 00 00 00 4a 3b 80 00 00 00 00 00     6;......J;......
+  803f38:	5a 3b 80 00 00 00 00 00 6d 3b 80 00 00 00 00 00     Z;......m;......
+  803f48:	84 3b 80 00 00 00 00 00 9a 3b 80 00 00 00 00 00     .;.......;......
+  803f58:	b2 3b 80 00 00 00 00 00 ca 3b 80 00 00 00 00 00     .;.......;......
+  803f68:	d7 3b 80 00 00 00 00 00 88 3f 80 00 00 00 00 00     .;.......?......
+  803f78:	eb 3b 80 00 00 00 00 00 03 3c 80 00 00 00 00 00     .;.......<......
+  803f88:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803f98:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803fa8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803fb8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803fc8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803fd8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803fe8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803ff8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804008:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804018:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804028:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804038:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804048:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804058:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804068:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804078:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804080 <devtab>:
+  804080:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804090:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8040a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8040b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8040c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8040d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8040e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8040f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804100:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804110:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804120:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  804130:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804140:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804150:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804160:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804170:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804180:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804190:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804200:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804210:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804220:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804230:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804240:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804250:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804260:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804270:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804280:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804290:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804300:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804310:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804320:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804330:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804340:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804350:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804360:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804370:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804380:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804390:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804400:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804410:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804420:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804430:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804440:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
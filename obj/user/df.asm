@@ -0,0 +1,7689 @@
+
+obj/user/df:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 77 02 00 00       	call   80029a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <print_free>:
+#include <inc/lib.h>
+
+void
+print_free() {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int res = free_space_bytes();
+  800029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80002e:	48 ba 54 23 80 00 00 	movabs $0x802354,%rdx
+  800035:	00 00 00 
+  800038:	ff d2                	call   *%rdx
+
+    if (res < 0) {
+  80003a:	85 c0                	test   %eax,%eax
+  80003c:	78 1a                	js     800058 <print_free+0x33>
+        cprintf("[Errorr] Incorrect free space size!\n");
+    } else if (res == 0) {
+  80003e:	75 35                	jne    800075 <print_free+0x50>
+        cprintf("No free space on disk\n");
+  800040:	48 bf 34 3b 80 00 00 	movabs $0x803b34,%rdi
+  800047:	00 00 00 
+  80004a:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  800051:	00 00 00 
+  800054:	ff d2                	call   *%rdx
+    } else {
+        cprintf("free %d bytes on disk\n", res);
+    }
+}
+  800056:	5d                   	pop    %rbp
+  800057:	c3                   	ret
+        cprintf("[Errorr] Incorrect free space size!\n");
+  800058:	48 bf 60 3a 80 00 00 	movabs $0x803a60,%rdi
+  80005f:	00 00 00 
+  800062:	b8 00 00 00 00       	mov    $0x0,%eax
+  800067:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  80006e:	00 00 00 
+  800071:	ff d2                	call   *%rdx
+  800073:	eb e1                	jmp    800056 <print_free+0x31>
+        cprintf("free %d bytes on disk\n", res);
+  800075:	89 c6                	mov    %eax,%esi
+  800077:	48 bf 4b 3b 80 00 00 	movabs $0x803b4b,%rdi
+  80007e:	00 00 00 
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  80008d:	00 00 00 
+  800090:	ff d2                	call   *%rdx
+}
+  800092:	eb c2                	jmp    800056 <print_free+0x31>
+
+0000000000800094 <print_busy>:
+
+void 
+print_busy() {
+  800094:	55                   	push   %rbp
+  800095:	48 89 e5             	mov    %rsp,%rbp
+    int res = busy_space_bytes();
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 ba 95 23 80 00 00 	movabs $0x802395,%rdx
+  8000a4:	00 00 00 
+  8000a7:	ff d2                	call   *%rdx
+
+    if (res < 0) {
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	78 1a                	js     8000c7 <print_busy+0x33>
+        cprintf("[Errorr] Incorrect busy space size!\n");
+    } else if (res == 0) {
+  8000ad:	75 35                	jne    8000e4 <print_busy+0x50>
+        cprintf("No data on disk\n");
+  8000af:	48 bf 62 3b 80 00 00 	movabs $0x803b62,%rdi
+  8000b6:	00 00 00 
+  8000b9:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  8000c0:	00 00 00 
+  8000c3:	ff d2                	call   *%rdx
+    } else {
+        cprintf("busy %d bytes on disk\n", res);
+    }
+}
+  8000c5:	5d                   	pop    %rbp
+  8000c6:	c3                   	ret
+        cprintf("[Errorr] Incorrect busy space size!\n");
+  8000c7:	48 bf 88 3a 80 00 00 	movabs $0x803a88,%rdi
+  8000ce:	00 00 00 
+  8000d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d6:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  8000dd:	00 00 00 
+  8000e0:	ff d2                	call   *%rdx
+  8000e2:	eb e1                	jmp    8000c5 <print_busy+0x31>
+        cprintf("busy %d bytes on disk\n", res);
+  8000e4:	89 c6                	mov    %eax,%esi
+  8000e6:	48 bf 73 3b 80 00 00 	movabs $0x803b73,%rdi
+  8000ed:	00 00 00 
+  8000f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f5:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  8000fc:	00 00 00 
+  8000ff:	ff d2                	call   *%rdx
+}
+  800101:	eb c2                	jmp    8000c5 <print_busy+0x31>
+
+0000000000800103 <print_snapshots>:
+
+static struct Df_snapshot snapshots[DF_SNAPSHOTS];
+
+void
+print_snapshots() {
+  800103:	55                   	push   %rbp
+  800104:	48 89 e5             	mov    %rsp,%rbp
+  800107:	41 57                	push   %r15
+  800109:	41 56                	push   %r14
+  80010b:	41 55                	push   %r13
+  80010d:	41 54                	push   %r12
+  80010f:	53                   	push   %rbx
+  800110:	48 83 ec 18          	sub    $0x18,%rsp
+    for (int start = 0;;) {
+  800114:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        } else if (res == 0) {
+            return;
+        }
+
+        for (int i = 0; i < res; ++i) {
+            cprintf("%s%s: exclusive %d bytes, shared %d bytes\n", snapshots[i].ds_name,
+  80011b:	49 bf b0 3b 80 00 00 	movabs $0x803bb0,%r15
+  800122:	00 00 00 
+  800125:	eb 30                	jmp    800157 <print_snapshots+0x54>
+            cprintf("[Errorr] Snapshot space cannot be counted: %i\n", res);
+  800127:	89 c6                	mov    %eax,%esi
+  800129:	48 bf b0 3a 80 00 00 	movabs $0x803ab0,%rdi
+  800130:	00 00 00 
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  80013f:	00 00 00 
+  800142:	ff d2                	call   *%rdx
+                    snapshots[i].ds_deleted ? " (deleted)" : "", snapshots[i].ds_exclusive, snapshots[i].ds_shared);
+        }
+
+        start += res;
+    }
+}
+  800144:	48 83 c4 18          	add    $0x18,%rsp
+  800148:	5b                   	pop    %rbx
+  800149:	41 5c                	pop    %r12
+  80014b:	41 5d                	pop    %r13
+  80014d:	41 5e                	pop    %r14
+  80014f:	41 5f                	pop    %r15
+  800151:	5d                   	pop    %rbp
+  800152:	c3                   	ret
+        start += res;
+  800153:	44 01 75 cc          	add    %r14d,-0x34(%rbp)
+        int res = snapshots_space(start, snapshots);
+  800157:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80015e:	00 00 00 
+  800161:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800164:	48 b8 d6 23 80 00 00 	movabs $0x8023d6,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+  800170:	41 89 c6             	mov    %eax,%r14d
+        if (res < 0) {
+  800173:	85 c0                	test   %eax,%eax
+  800175:	78 b0                	js     800127 <print_snapshots+0x24>
+        } else if (res == 0) {
+  800177:	74 cb                	je     800144 <print_snapshots+0x41>
+  800179:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  800180:	00 00 00 
+        for (int i = 0; i < res; ++i) {
+  800183:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            cprintf("%s%s: exclusive %d bytes, shared %d bytes\n", snapshots[i].ds_name,
+  800189:	49 bd 18 04 80 00 00 	movabs $0x800418,%r13
+  800190:	00 00 00 
+  800193:	48 89 de             	mov    %rbx,%rsi
+  800196:	8b 8b 80 00 00 00    	mov    0x80(%rbx),%ecx
+  80019c:	80 bb 88 00 00 00 00 	cmpb   $0x0,0x88(%rbx)
+  8001a3:	48 ba 8a 3b 80 00 00 	movabs $0x803b8a,%rdx
+  8001aa:	00 00 00 
+  8001ad:	49 0f 44 d7          	cmove  %r15,%rdx
+  8001b1:	44 8b 83 84 00 00 00 	mov    0x84(%rbx),%r8d
+  8001b8:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  8001bf:	00 00 00 
+  8001c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c7:	41 ff d5             	call   *%r13
+        for (int i = 0; i < res; ++i) {
+  8001ca:	41 83 c4 01          	add    $0x1,%r12d
+  8001ce:	48 81 c3 8c 00 00 00 	add    $0x8c,%rbx
+  8001d5:	45 39 e6             	cmp    %r12d,%r14d
+  8001d8:	7f b9                	jg     800193 <print_snapshots+0x90>
+  8001da:	e9 74 ff ff ff       	jmp    800153 <print_snapshots+0x50>
+
+00000000008001df <umain>:
+
+void
+umain(int argc, char **argv) {
+  8001df:	55                   	push   %rbp
+  8001e0:	48 89 e5             	mov    %rsp,%rbp
+  8001e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8001e7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+
+    if (argc != 2) {
+  8001ea:	83 ff 02             	cmp    $0x2,%edi
+  8001ed:	74 1d                	je     80020c <umain+0x2d>
+        cprintf("Invalid amount of arguments for df\n");
+  8001ef:	48 bf 10 3b 80 00 00 	movabs $0x803b10,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  800205:	00 00 00 
+  800208:	ff d2                	call   *%rdx
+    } else {
+        cprintf("Incorrect flag for df:'%c'\n", arg);
+    }
+    
+    return;
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+    argstart(&argc, argv, &args);
+  80020c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800210:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800214:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+    int arg = argnext(&args);
+  800220:	48 8d 7d e0          	lea    -0x20(%rbp),%rdi
+  800224:	48 b8 c6 17 80 00 00 	movabs $0x8017c6,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+    if (arg == 'f') {
+  800230:	83 f8 66             	cmp    $0x66,%eax
+  800233:	74 29                	je     80025e <umain+0x7f>
+    } else if (arg == 'b') {
+  800235:	83 f8 62             	cmp    $0x62,%eax
+  800238:	74 37                	je     800271 <umain+0x92>
+    } else if (arg == 's') {
+  80023a:	83 f8 73             	cmp    $0x73,%eax
+  80023d:	74 45                	je     800284 <umain+0xa5>
+        cprintf("Incorrect flag for df:'%c'\n", arg);
+  80023f:	89 c6                	mov    %eax,%esi
+  800241:	48 bf 95 3b 80 00 00 	movabs $0x803b95,%rdi
+  800248:	00 00 00 
+  80024b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800250:	48 ba 18 04 80 00 00 	movabs $0x800418,%rdx
+  800257:	00 00 00 
+  80025a:	ff d2                	call   *%rdx
+  80025c:	eb ac                	jmp    80020a <umain+0x2b>
+        print_free();
+  80025e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800263:	48 ba 25 00 80 00 00 	movabs $0x800025,%rdx
+  80026a:	00 00 00 
+  80026d:	ff d2                	call   *%rdx
+  80026f:	eb 99                	jmp    80020a <umain+0x2b>
+        print_busy();
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+  800276:	48 ba 94 00 80 00 00 	movabs $0x800094,%rdx
+  80027d:	00 00 00 
+  800280:	ff d2                	call   *%rdx
+  800282:	eb 86                	jmp    80020a <umain+0x2b>
+        print_snapshots();
+  800284:	b8 00 00 00 00       	mov    $0x0,%eax
+  800289:	48 ba 03 01 80 00 00 	movabs $0x800103,%rdx
+  800290:	00 00 00 
+  800293:	ff d2                	call   *%rdx
+  800295:	e9 70 ff ff ff       	jmp    80020a <umain+0x2b>
+
+000000000080029a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+  80029e:	41 56                	push   %r14
+  8002a0:	41 55                	push   %r13
+  8002a2:	41 54                	push   %r12
+  8002a4:	53                   	push   %rbx
+  8002a5:	41 89 fd             	mov    %edi,%r13d
+  8002a8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002ab:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8002b2:	00 00 00 
+  8002b5:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8002bc:	00 00 00 
+  8002bf:	48 39 c2             	cmp    %rax,%rdx
+  8002c2:	73 17                	jae    8002db <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002c4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002c7:	49 89 c4             	mov    %rax,%r12
+  8002ca:	48 83 c3 08          	add    $0x8,%rbx
+  8002ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d3:	ff 53 f8             	call   *-0x8(%rbx)
+  8002d6:	4c 39 e3             	cmp    %r12,%rbx
+  8002d9:	72 ef                	jb     8002ca <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8002db:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+  8002e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002ec:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8002f0:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8002f4:	48 c1 e0 04          	shl    $0x4,%rax
+  8002f8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002ff:	00 00 00 
+  800302:	48 01 d0             	add    %rdx,%rax
+  800305:	48 a3 e0 6f 80 00 00 	movabs %rax,0x806fe0
+  80030c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80030f:	45 85 ed             	test   %r13d,%r13d
+  800312:	7e 0d                	jle    800321 <libmain+0x87>
+  800314:	49 8b 06             	mov    (%r14),%rax
+  800317:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80031e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800321:	4c 89 f6             	mov    %r14,%rsi
+  800324:	44 89 ef             	mov    %r13d,%edi
+  800327:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  80032e:	00 00 00 
+  800331:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800333:	48 b8 48 03 80 00 00 	movabs $0x800348,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+#endif
+}
+  80033f:	5b                   	pop    %rbx
+  800340:	41 5c                	pop    %r12
+  800342:	41 5d                	pop    %r13
+  800344:	41 5e                	pop    %r14
+  800346:	5d                   	pop    %rbp
+  800347:	c3                   	ret
+
+0000000000800348 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80034c:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  800353:	00 00 00 
+  800356:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800358:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035d:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  800364:	00 00 00 
+  800367:	ff d0                	call   *%rax
+}
+  800369:	5d                   	pop    %rbp
+  80036a:	c3                   	ret
+
+000000000080036b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80036b:	55                   	push   %rbp
+  80036c:	48 89 e5             	mov    %rsp,%rbp
+  80036f:	53                   	push   %rbx
+  800370:	48 83 ec 08          	sub    $0x8,%rsp
+  800374:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800377:	8b 06                	mov    (%rsi),%eax
+  800379:	8d 50 01             	lea    0x1(%rax),%edx
+  80037c:	89 16                	mov    %edx,(%rsi)
+  80037e:	48 98                	cltq
+  800380:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800385:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80038b:	74 0a                	je     800397 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80038d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800395:	c9                   	leave
+  800396:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800397:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80039b:	be ff 00 00 00       	mov    $0xff,%esi
+  8003a0:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003ac:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003b2:	eb d9                	jmp    80038d <putch+0x22>
+
+00000000008003b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003b4:	55                   	push   %rbp
+  8003b5:	48 89 e5             	mov    %rsp,%rbp
+  8003b8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003bf:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003c2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003c9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003d6:	48 89 f1             	mov    %rsi,%rcx
+  8003d9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003e0:	48 bf 6b 03 80 00 00 	movabs $0x80036b,%rdi
+  8003e7:	00 00 00 
+  8003ea:	48 b8 68 05 80 00 00 	movabs $0x800568,%rax
+  8003f1:	00 00 00 
+  8003f4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003f6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003fd:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800404:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  80040b:	00 00 00 
+  80040e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800410:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800416:	c9                   	leave
+  800417:	c3                   	ret
+
+0000000000800418 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800418:	55                   	push   %rbp
+  800419:	48 89 e5             	mov    %rsp,%rbp
+  80041c:	48 83 ec 50          	sub    $0x50,%rsp
+  800420:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800424:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800428:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800430:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800434:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80043b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800443:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800447:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80044b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80044f:	48 b8 b4 03 80 00 00 	movabs $0x8003b4,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+000000000080045d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80045d:	55                   	push   %rbp
+  80045e:	48 89 e5             	mov    %rsp,%rbp
+  800461:	41 57                	push   %r15
+  800463:	41 56                	push   %r14
+  800465:	41 55                	push   %r13
+  800467:	41 54                	push   %r12
+  800469:	53                   	push   %rbx
+  80046a:	48 83 ec 18          	sub    $0x18,%rsp
+  80046e:	49 89 fc             	mov    %rdi,%r12
+  800471:	49 89 f5             	mov    %rsi,%r13
+  800474:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800478:	8b 45 10             	mov    0x10(%rbp),%eax
+  80047b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80047e:	41 89 cf             	mov    %ecx,%r15d
+  800481:	4c 39 fa             	cmp    %r15,%rdx
+  800484:	73 5b                	jae    8004e1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800486:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80048a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80048e:	85 db                	test   %ebx,%ebx
+  800490:	7e 0e                	jle    8004a0 <print_num+0x43>
+            putch(padc, put_arg);
+  800492:	4c 89 ee             	mov    %r13,%rsi
+  800495:	44 89 f7             	mov    %r14d,%edi
+  800498:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80049b:	83 eb 01             	sub    $0x1,%ebx
+  80049e:	75 f2                	jne    800492 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004a0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004a4:	48 b9 cc 3b 80 00 00 	movabs $0x803bcc,%rcx
+  8004ab:	00 00 00 
+  8004ae:	48 b8 bb 3b 80 00 00 	movabs $0x803bbb,%rax
+  8004b5:	00 00 00 
+  8004b8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c5:	49 f7 f7             	div    %r15
+  8004c8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004cc:	4c 89 ee             	mov    %r13,%rsi
+  8004cf:	41 ff d4             	call   *%r12
+}
+  8004d2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004d6:	5b                   	pop    %rbx
+  8004d7:	41 5c                	pop    %r12
+  8004d9:	41 5d                	pop    %r13
+  8004db:	41 5e                	pop    %r14
+  8004dd:	41 5f                	pop    %r15
+  8004df:	5d                   	pop    %rbp
+  8004e0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ea:	49 f7 f7             	div    %r15
+  8004ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004f5:	52                   	push   %rdx
+  8004f6:	45 0f be c9          	movsbl %r9b,%r9d
+  8004fa:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004fe:	48 89 c2             	mov    %rax,%rdx
+  800501:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800508:	00 00 00 
+  80050b:	ff d0                	call   *%rax
+  80050d:	48 83 c4 10          	add    $0x10,%rsp
+  800511:	eb 8d                	jmp    8004a0 <print_num+0x43>
+
+0000000000800513 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800513:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800517:	48 8b 06             	mov    (%rsi),%rax
+  80051a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80051e:	73 0a                	jae    80052a <sprintputch+0x17>
+        *state->start++ = ch;
+  800520:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800524:	48 89 16             	mov    %rdx,(%rsi)
+  800527:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80052a:	c3                   	ret
+
+000000000080052b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80052b:	55                   	push   %rbp
+  80052c:	48 89 e5             	mov    %rsp,%rbp
+  80052f:	48 83 ec 50          	sub    $0x50,%rsp
+  800533:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800537:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80053f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800546:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800552:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800556:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80055a:	48 b8 68 05 80 00 00 	movabs $0x800568,%rax
+  800561:	00 00 00 
+  800564:	ff d0                	call   *%rax
+}
+  800566:	c9                   	leave
+  800567:	c3                   	ret
+
+0000000000800568 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800568:	55                   	push   %rbp
+  800569:	48 89 e5             	mov    %rsp,%rbp
+  80056c:	41 57                	push   %r15
+  80056e:	41 56                	push   %r14
+  800570:	41 55                	push   %r13
+  800572:	41 54                	push   %r12
+  800574:	53                   	push   %rbx
+  800575:	48 83 ec 38          	sub    $0x38,%rsp
+  800579:	49 89 fe             	mov    %rdi,%r14
+  80057c:	49 89 f5             	mov    %rsi,%r13
+  80057f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800582:	48 8b 01             	mov    (%rcx),%rax
+  800585:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800589:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80058d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800591:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800595:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800599:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80059d:	0f b6 3b             	movzbl (%rbx),%edi
+  8005a0:	40 80 ff 25          	cmp    $0x25,%dil
+  8005a4:	74 18                	je     8005be <vprintfmt+0x56>
+            if (!ch) return;
+  8005a6:	40 84 ff             	test   %dil,%dil
+  8005a9:	0f 84 b1 06 00 00    	je     800c60 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005af:	40 0f b6 ff          	movzbl %dil,%edi
+  8005b3:	4c 89 ee             	mov    %r13,%rsi
+  8005b6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005b9:	4c 89 e3             	mov    %r12,%rbx
+  8005bc:	eb db                	jmp    800599 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005be:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005c7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005d2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005d9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005dd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005e2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005e7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005ea:	83 e8 23             	sub    $0x23,%eax
+  8005ed:	3c 57                	cmp    $0x57,%al
+  8005ef:	0f 87 51 06 00 00    	ja     800c46 <vprintfmt+0x6de>
+  8005f5:	0f b6 c0             	movzbl %al,%eax
+  8005f8:	48 b9 60 3d 80 00 00 	movabs $0x803d60,%rcx
+  8005ff:	00 00 00 
+  800602:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800605:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800608:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80060c:	eb cf                	jmp    8005dd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+  800611:	be 01 00 00 00       	mov    $0x1,%esi
+  800616:	eb c5                	jmp    8005dd <vprintfmt+0x75>
+            padc = ch;
+  800618:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80061c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80061f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800622:	eb b9                	jmp    8005dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800624:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800627:	83 f8 2f             	cmp    $0x2f,%eax
+  80062a:	77 24                	ja     800650 <vprintfmt+0xe8>
+  80062c:	89 c1                	mov    %eax,%ecx
+  80062e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800632:	83 c0 08             	add    $0x8,%eax
+  800635:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800638:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80063b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80063e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800642:	79 99                	jns    8005dd <vprintfmt+0x75>
+                width = precision;
+  800644:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800648:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064e:	eb 8d                	jmp    8005dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800650:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800654:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800658:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80065c:	eb da                	jmp    800638 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80065e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800663:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800667:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80066d:	3c 39                	cmp    $0x39,%al
+  80066f:	77 1c                	ja     80068d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800671:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800675:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800679:	0f b6 c0             	movzbl %al,%eax
+  80067c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800681:	0f b6 03             	movzbl (%rbx),%eax
+  800684:	3c 39                	cmp    $0x39,%al
+  800686:	76 e9                	jbe    800671 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800688:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80068b:	eb b1                	jmp    80063e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80068d:	49 89 dc             	mov    %rbx,%r12
+  800690:	eb ac                	jmp    80063e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800692:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800695:	85 c9                	test   %ecx,%ecx
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069c:	0f 49 c1             	cmovns %ecx,%eax
+  80069f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a5:	e9 33 ff ff ff       	jmp    8005dd <vprintfmt+0x75>
+            lflag++;
+  8006aa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006b0:	e9 28 ff ff ff       	jmp    8005dd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bb:	77 19                	ja     8006d6 <vprintfmt+0x16e>
+  8006bd:	89 c2                	mov    %eax,%edx
+  8006bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c3:	83 c0 08             	add    $0x8,%eax
+  8006c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c9:	8b 3a                	mov    (%rdx),%edi
+  8006cb:	4c 89 ee             	mov    %r13,%rsi
+  8006ce:	41 ff d6             	call   *%r14
+            break;
+  8006d1:	e9 c3 fe ff ff       	jmp    800599 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e2:	eb e5                	jmp    8006c9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ea:	77 5a                	ja     800746 <vprintfmt+0x1de>
+  8006ec:	89 c2                	mov    %eax,%edx
+  8006ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f2:	83 c0 08             	add    $0x8,%eax
+  8006f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006f8:	8b 02                	mov    (%rdx),%eax
+  8006fa:	89 c1                	mov    %eax,%ecx
+  8006fc:	f7 d9                	neg    %ecx
+  8006fe:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800701:	83 f9 14             	cmp    $0x14,%ecx
+  800704:	7f 4e                	jg     800754 <vprintfmt+0x1ec>
+  800706:	48 63 c1             	movslq %ecx,%rax
+  800709:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  800710:	00 00 00 
+  800713:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800717:	48 85 c0             	test   %rax,%rax
+  80071a:	74 38                	je     800754 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80071c:	48 89 c1             	mov    %rax,%rcx
+  80071f:	48 ba f9 41 80 00 00 	movabs $0x8041f9,%rdx
+  800726:	00 00 00 
+  800729:	4c 89 ee             	mov    %r13,%rsi
+  80072c:	4c 89 f7             	mov    %r14,%rdi
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800734:	49 b8 2b 05 80 00 00 	movabs $0x80052b,%r8
+  80073b:	00 00 00 
+  80073e:	41 ff d0             	call   *%r8
+  800741:	e9 53 fe ff ff       	jmp    800599 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800746:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800752:	eb a4                	jmp    8006f8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800754:	48 ba e4 3b 80 00 00 	movabs $0x803be4,%rdx
+  80075b:	00 00 00 
+  80075e:	4c 89 ee             	mov    %r13,%rsi
+  800761:	4c 89 f7             	mov    %r14,%rdi
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	49 b8 2b 05 80 00 00 	movabs $0x80052b,%r8
+  800770:	00 00 00 
+  800773:	41 ff d0             	call   *%r8
+  800776:	e9 1e fe ff ff       	jmp    800599 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80077b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077e:	83 f8 2f             	cmp    $0x2f,%eax
+  800781:	77 6c                	ja     8007ef <vprintfmt+0x287>
+  800783:	89 c2                	mov    %eax,%edx
+  800785:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800789:	83 c0 08             	add    $0x8,%eax
+  80078c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800792:	48 85 d2             	test   %rdx,%rdx
+  800795:	48 b8 dd 3b 80 00 00 	movabs $0x803bdd,%rax
+  80079c:	00 00 00 
+  80079f:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007ab:	7e 06                	jle    8007b3 <vprintfmt+0x24b>
+  8007ad:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007b1:	75 4a                	jne    8007fd <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007b7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007bb:	0f b6 00             	movzbl (%rax),%eax
+  8007be:	84 c0                	test   %al,%al
+  8007c0:	0f 85 9a 00 00 00    	jne    800860 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007cd:	85 c0                	test   %eax,%eax
+  8007cf:	0f 8e c4 fd ff ff    	jle    800599 <vprintfmt+0x31>
+  8007d5:	4c 89 ee             	mov    %r13,%rsi
+  8007d8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007dd:	41 ff d6             	call   *%r14
+  8007e0:	41 83 ec 01          	sub    $0x1,%r12d
+  8007e4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007e8:	75 eb                	jne    8007d5 <vprintfmt+0x26d>
+  8007ea:	e9 aa fd ff ff       	jmp    800599 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fb:	eb 92                	jmp    80078f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007fd:	49 63 f7             	movslq %r15d,%rsi
+  800800:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800804:	48 b8 1a 0d 80 00 00 	movabs $0x800d1a,%rax
+  80080b:	00 00 00 
+  80080e:	ff d0                	call   *%rax
+  800810:	48 89 c2             	mov    %rax,%rdx
+  800813:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800816:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800818:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80081b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80081e:	85 c0                	test   %eax,%eax
+  800820:	7e 91                	jle    8007b3 <vprintfmt+0x24b>
+  800822:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800827:	4c 89 ee             	mov    %r13,%rsi
+  80082a:	44 89 e7             	mov    %r12d,%edi
+  80082d:	41 ff d6             	call   *%r14
+  800830:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800834:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800837:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80083a:	75 eb                	jne    800827 <vprintfmt+0x2bf>
+  80083c:	e9 72 ff ff ff       	jmp    8007b3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800841:	0f b6 f8             	movzbl %al,%edi
+  800844:	4c 89 ee             	mov    %r13,%rsi
+  800847:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80084a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80084e:	49 83 c4 01          	add    $0x1,%r12
+  800852:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800858:	84 c0                	test   %al,%al
+  80085a:	0f 84 66 ff ff ff    	je     8007c6 <vprintfmt+0x25e>
+  800860:	45 85 ff             	test   %r15d,%r15d
+  800863:	78 0a                	js     80086f <vprintfmt+0x307>
+  800865:	41 83 ef 01          	sub    $0x1,%r15d
+  800869:	0f 88 57 ff ff ff    	js     8007c6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80086f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800873:	74 cc                	je     800841 <vprintfmt+0x2d9>
+  800875:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800878:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80087d:	80 fa 5e             	cmp    $0x5e,%dl
+  800880:	77 c2                	ja     800844 <vprintfmt+0x2dc>
+  800882:	eb bd                	jmp    800841 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800884:	40 84 f6             	test   %sil,%sil
+  800887:	75 26                	jne    8008af <vprintfmt+0x347>
+    switch (lflag) {
+  800889:	85 d2                	test   %edx,%edx
+  80088b:	74 59                	je     8008e6 <vprintfmt+0x37e>
+  80088d:	83 fa 01             	cmp    $0x1,%edx
+  800890:	74 7b                	je     80090d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800892:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800895:	83 f8 2f             	cmp    $0x2f,%eax
+  800898:	0f 87 96 00 00 00    	ja     800934 <vprintfmt+0x3cc>
+  80089e:	89 c2                	mov    %eax,%edx
+  8008a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a4:	83 c0 08             	add    $0x8,%eax
+  8008a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008aa:	4c 8b 22             	mov    (%rdx),%r12
+  8008ad:	eb 17                	jmp    8008c6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b5:	77 21                	ja     8008d8 <vprintfmt+0x370>
+  8008b7:	89 c2                	mov    %eax,%edx
+  8008b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bd:	83 c0 08             	add    $0x8,%eax
+  8008c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008c6:	4d 85 e4             	test   %r12,%r12
+  8008c9:	78 7a                	js     800945 <vprintfmt+0x3dd>
+            num = i;
+  8008cb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008d3:	e9 50 02 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e4:	eb dd                	jmp    8008c3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ec:	77 11                	ja     8008ff <vprintfmt+0x397>
+  8008ee:	89 c2                	mov    %eax,%edx
+  8008f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f4:	83 c0 08             	add    $0x8,%eax
+  8008f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fa:	4c 63 22             	movslq (%rdx),%r12
+  8008fd:	eb c7                	jmp    8008c6 <vprintfmt+0x35e>
+  8008ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800903:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090b:	eb ed                	jmp    8008fa <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	77 11                	ja     800926 <vprintfmt+0x3be>
+  800915:	89 c2                	mov    %eax,%edx
+  800917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091b:	83 c0 08             	add    $0x8,%eax
+  80091e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800921:	4c 8b 22             	mov    (%rdx),%r12
+  800924:	eb a0                	jmp    8008c6 <vprintfmt+0x35e>
+  800926:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800932:	eb ed                	jmp    800921 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	e9 65 ff ff ff       	jmp    8008aa <vprintfmt+0x342>
+                putch('-', put_arg);
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80094d:	41 ff d6             	call   *%r14
+                i = -i;
+  800950:	49 f7 dc             	neg    %r12
+  800953:	e9 73 ff ff ff       	jmp    8008cb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800958:	40 84 f6             	test   %sil,%sil
+  80095b:	75 32                	jne    80098f <vprintfmt+0x427>
+    switch (lflag) {
+  80095d:	85 d2                	test   %edx,%edx
+  80095f:	74 5d                	je     8009be <vprintfmt+0x456>
+  800961:	83 fa 01             	cmp    $0x1,%edx
+  800964:	0f 84 82 00 00 00    	je     8009ec <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	0f 87 a5 00 00 00    	ja     800a1b <vprintfmt+0x4b3>
+  800976:	89 c2                	mov    %eax,%edx
+  800978:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097c:	83 c0 08             	add    $0x8,%eax
+  80097f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800982:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800985:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098a:	e9 99 01 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80098f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800992:	83 f8 2f             	cmp    $0x2f,%eax
+  800995:	77 19                	ja     8009b0 <vprintfmt+0x448>
+  800997:	89 c2                	mov    %eax,%edx
+  800999:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099d:	83 c0 08             	add    $0x8,%eax
+  8009a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ab:	e9 78 01 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb e5                	jmp    8009a3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 18                	ja     8009de <vprintfmt+0x476>
+  8009c6:	89 c2                	mov    %eax,%edx
+  8009c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cc:	83 c0 08             	add    $0x8,%eax
+  8009cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d9:	e9 4a 01 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb e6                	jmp    8009d2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 19                	ja     800a0d <vprintfmt+0x4a5>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a03:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a08:	e9 1b 01 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+  800a0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a19:	eb e5                	jmp    800a00 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a27:	e9 56 ff ff ff       	jmp    800982 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2c:	40 84 f6             	test   %sil,%sil
+  800a2f:	75 2e                	jne    800a5f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a31:	85 d2                	test   %edx,%edx
+  800a33:	74 59                	je     800a8e <vprintfmt+0x526>
+  800a35:	83 fa 01             	cmp    $0x1,%edx
+  800a38:	74 7f                	je     800ab9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a40:	0f 87 9f 00 00 00    	ja     800ae5 <vprintfmt+0x57d>
+  800a46:	89 c2                	mov    %eax,%edx
+  800a48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4c:	83 c0 08             	add    $0x8,%eax
+  800a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a5a:	e9 c9 00 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 19                	ja     800a80 <vprintfmt+0x518>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a76:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a7b:	e9 a8 00 00 00       	jmp    800b28 <vprintfmt+0x5c0>
+  800a80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8c:	eb e5                	jmp    800a73 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a91:	83 f8 2f             	cmp    $0x2f,%eax
+  800a94:	77 15                	ja     800aab <vprintfmt+0x543>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800aa4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aa9:	eb 7d                	jmp    800b28 <vprintfmt+0x5c0>
+  800aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab7:	eb e9                	jmp    800aa2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ab9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abc:	83 f8 2f             	cmp    $0x2f,%eax
+  800abf:	77 16                	ja     800ad7 <vprintfmt+0x56f>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ad5:	eb 51                	jmp    800b28 <vprintfmt+0x5c0>
+  800ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae3:	eb e8                	jmp    800acd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ae5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af1:	e9 5c ff ff ff       	jmp    800a52 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800af6:	4c 89 ee             	mov    %r13,%rsi
+  800af9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800afe:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b01:	4c 89 ee             	mov    %r13,%rsi
+  800b04:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b09:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	77 47                	ja     800b5b <vprintfmt+0x5f3>
+  800b14:	89 c2                	mov    %eax,%edx
+  800b16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1a:	83 c0 08             	add    $0x8,%eax
+  800b1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b23:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b28:	48 83 ec 08          	sub    $0x8,%rsp
+  800b2c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b30:	0f 94 c0             	sete   %al
+  800b33:	0f b6 c0             	movzbl %al,%eax
+  800b36:	50                   	push   %rax
+  800b37:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b3c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b40:	4c 89 ee             	mov    %r13,%rsi
+  800b43:	4c 89 f7             	mov    %r14,%rdi
+  800b46:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800b4d:	00 00 00 
+  800b50:	ff d0                	call   *%rax
+            break;
+  800b52:	48 83 c4 10          	add    $0x10,%rsp
+  800b56:	e9 3e fa ff ff       	jmp    800599 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b67:	eb b7                	jmp    800b20 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b69:	40 84 f6             	test   %sil,%sil
+  800b6c:	75 2b                	jne    800b99 <vprintfmt+0x631>
+    switch (lflag) {
+  800b6e:	85 d2                	test   %edx,%edx
+  800b70:	74 56                	je     800bc8 <vprintfmt+0x660>
+  800b72:	83 fa 01             	cmp    $0x1,%edx
+  800b75:	74 7f                	je     800bf6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7d:	0f 87 a2 00 00 00    	ja     800c25 <vprintfmt+0x6bd>
+  800b83:	89 c2                	mov    %eax,%edx
+  800b85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b89:	83 c0 08             	add    $0x8,%eax
+  800b8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b92:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b97:	eb 8f                	jmp    800b28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9f:	77 19                	ja     800bba <vprintfmt+0x652>
+  800ba1:	89 c2                	mov    %eax,%edx
+  800ba3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba7:	83 c0 08             	add    $0x8,%eax
+  800baa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bb5:	e9 6e ff ff ff       	jmp    800b28 <vprintfmt+0x5c0>
+  800bba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc6:	eb e5                	jmp    800bad <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bce:	77 18                	ja     800be8 <vprintfmt+0x680>
+  800bd0:	89 c2                	mov    %eax,%edx
+  800bd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd6:	83 c0 08             	add    $0x8,%eax
+  800bd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bde:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800be3:	e9 40 ff ff ff       	jmp    800b28 <vprintfmt+0x5c0>
+  800be8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf4:	eb e6                	jmp    800bdc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfc:	77 19                	ja     800c17 <vprintfmt+0x6af>
+  800bfe:	89 c2                	mov    %eax,%edx
+  800c00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c04:	83 c0 08             	add    $0x8,%eax
+  800c07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c12:	e9 11 ff ff ff       	jmp    800b28 <vprintfmt+0x5c0>
+  800c17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c23:	eb e5                	jmp    800c0a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c31:	e9 59 ff ff ff       	jmp    800b8f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c36:	4c 89 ee             	mov    %r13,%rsi
+  800c39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3e:	41 ff d6             	call   *%r14
+            break;
+  800c41:	e9 53 f9 ff ff       	jmp    800599 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c46:	4c 89 ee             	mov    %r13,%rsi
+  800c49:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c4e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c51:	48 83 eb 01          	sub    $0x1,%rbx
+  800c55:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c59:	75 f6                	jne    800c51 <vprintfmt+0x6e9>
+  800c5b:	e9 39 f9 ff ff       	jmp    800599 <vprintfmt+0x31>
+}
+  800c60:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c64:	5b                   	pop    %rbx
+  800c65:	41 5c                	pop    %r12
+  800c67:	41 5d                	pop    %r13
+  800c69:	41 5e                	pop    %r14
+  800c6b:	41 5f                	pop    %r15
+  800c6d:	5d                   	pop    %rbp
+  800c6e:	c3                   	ret
+
+0000000000800c6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c6f:	55                   	push   %rbp
+  800c70:	48 89 e5             	mov    %rsp,%rbp
+  800c73:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c7b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c84:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c8b:	48 85 ff             	test   %rdi,%rdi
+  800c8e:	74 2b                	je     800cbb <vsnprintf+0x4c>
+  800c90:	48 85 f6             	test   %rsi,%rsi
+  800c93:	74 26                	je     800cbb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c99:	48 bf 13 05 80 00 00 	movabs $0x800513,%rdi
+  800ca0:	00 00 00 
+  800ca3:	48 b8 68 05 80 00 00 	movabs $0x800568,%rax
+  800caa:	00 00 00 
+  800cad:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800caf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cb6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cb9:	c9                   	leave
+  800cba:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc0:	eb f7                	jmp    800cb9 <vsnprintf+0x4a>
+
+0000000000800cc2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cc2:	55                   	push   %rbp
+  800cc3:	48 89 e5             	mov    %rsp,%rbp
+  800cc6:	48 83 ec 50          	sub    $0x50,%rsp
+  800cca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cd2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cd6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cdd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ce1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ce9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ced:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cf1:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  800cf8:	00 00 00 
+  800cfb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cfd:	c9                   	leave
+  800cfe:	c3                   	ret
+
+0000000000800cff <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cff:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d02:	74 10                	je     800d14 <strlen+0x15>
+    size_t n = 0;
+  800d04:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d09:	48 83 c0 01          	add    $0x1,%rax
+  800d0d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d11:	75 f6                	jne    800d09 <strlen+0xa>
+  800d13:	c3                   	ret
+    size_t n = 0;
+  800d14:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d19:	c3                   	ret
+
+0000000000800d1a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d1a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d22:	48 85 f6             	test   %rsi,%rsi
+  800d25:	74 11                	je     800d38 <strnlen+0x1e>
+  800d27:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d2b:	74 0c                	je     800d39 <strnlen+0x1f>
+  800d2d:	48 83 c2 01          	add    $0x1,%rdx
+  800d31:	48 39 d0             	cmp    %rdx,%rax
+  800d34:	75 f1                	jne    800d27 <strnlen+0xd>
+  800d36:	eb 04                	jmp    800d3c <strnlen+0x22>
+  800d38:	c3                   	ret
+  800d39:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d3c:	c3                   	ret
+
+0000000000800d3d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d3d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d45:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d49:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d4c:	48 83 c2 01          	add    $0x1,%rdx
+  800d50:	84 c9                	test   %cl,%cl
+  800d52:	75 f1                	jne    800d45 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d54:	c3                   	ret
+
+0000000000800d55 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d55:	55                   	push   %rbp
+  800d56:	48 89 e5             	mov    %rsp,%rbp
+  800d59:	41 54                	push   %r12
+  800d5b:	53                   	push   %rbx
+  800d5c:	48 89 fb             	mov    %rdi,%rbx
+  800d5f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d62:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  800d69:	00 00 00 
+  800d6c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d6e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d72:	4c 89 e6             	mov    %r12,%rsi
+  800d75:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  800d7c:	00 00 00 
+  800d7f:	ff d0                	call   *%rax
+    return dst;
+}
+  800d81:	48 89 d8             	mov    %rbx,%rax
+  800d84:	5b                   	pop    %rbx
+  800d85:	41 5c                	pop    %r12
+  800d87:	5d                   	pop    %rbp
+  800d88:	c3                   	ret
+
+0000000000800d89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d89:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d8c:	48 85 d2             	test   %rdx,%rdx
+  800d8f:	74 1f                	je     800db0 <strncpy+0x27>
+  800d91:	48 01 fa             	add    %rdi,%rdx
+  800d94:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d97:	48 83 c1 01          	add    $0x1,%rcx
+  800d9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800da3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800da7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dab:	48 39 ca             	cmp    %rcx,%rdx
+  800dae:	75 e7                	jne    800d97 <strncpy+0xe>
+    }
+    return ret;
+}
+  800db0:	c3                   	ret
+
+0000000000800db1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800db1:	48 89 f8             	mov    %rdi,%rax
+  800db4:	48 85 d2             	test   %rdx,%rdx
+  800db7:	74 24                	je     800ddd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800db9:	48 83 ea 01          	sub    $0x1,%rdx
+  800dbd:	74 1b                	je     800dda <strlcpy+0x29>
+  800dbf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dc3:	0f b6 16             	movzbl (%rsi),%edx
+  800dc6:	84 d2                	test   %dl,%dl
+  800dc8:	74 10                	je     800dda <strlcpy+0x29>
+            *dst++ = *src++;
+  800dca:	48 83 c6 01          	add    $0x1,%rsi
+  800dce:	48 83 c0 01          	add    $0x1,%rax
+  800dd2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dd5:	48 39 c8             	cmp    %rcx,%rax
+  800dd8:	75 e9                	jne    800dc3 <strlcpy+0x12>
+        *dst = '\0';
+  800dda:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ddd:	48 29 f8             	sub    %rdi,%rax
+}
+  800de0:	c3                   	ret
+
+0000000000800de1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800de1:	0f b6 07             	movzbl (%rdi),%eax
+  800de4:	84 c0                	test   %al,%al
+  800de6:	74 13                	je     800dfb <strcmp+0x1a>
+  800de8:	38 06                	cmp    %al,(%rsi)
+  800dea:	75 0f                	jne    800dfb <strcmp+0x1a>
+  800dec:	48 83 c7 01          	add    $0x1,%rdi
+  800df0:	48 83 c6 01          	add    $0x1,%rsi
+  800df4:	0f b6 07             	movzbl (%rdi),%eax
+  800df7:	84 c0                	test   %al,%al
+  800df9:	75 ed                	jne    800de8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dfb:	0f b6 c0             	movzbl %al,%eax
+  800dfe:	0f b6 16             	movzbl (%rsi),%edx
+  800e01:	29 d0                	sub    %edx,%eax
+}
+  800e03:	c3                   	ret
+
+0000000000800e04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e04:	48 85 d2             	test   %rdx,%rdx
+  800e07:	74 1f                	je     800e28 <strncmp+0x24>
+  800e09:	0f b6 07             	movzbl (%rdi),%eax
+  800e0c:	84 c0                	test   %al,%al
+  800e0e:	74 1e                	je     800e2e <strncmp+0x2a>
+  800e10:	3a 06                	cmp    (%rsi),%al
+  800e12:	75 1a                	jne    800e2e <strncmp+0x2a>
+  800e14:	48 83 c7 01          	add    $0x1,%rdi
+  800e18:	48 83 c6 01          	add    $0x1,%rsi
+  800e1c:	48 83 ea 01          	sub    $0x1,%rdx
+  800e20:	75 e7                	jne    800e09 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e27:	c3                   	ret
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	c3                   	ret
+  800e2e:	48 85 d2             	test   %rdx,%rdx
+  800e31:	74 09                	je     800e3c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e33:	0f b6 07             	movzbl (%rdi),%eax
+  800e36:	0f b6 16             	movzbl (%rsi),%edx
+  800e39:	29 d0                	sub    %edx,%eax
+  800e3b:	c3                   	ret
+    if (!n) return 0;
+  800e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e42:	0f b6 17             	movzbl (%rdi),%edx
+  800e45:	84 d2                	test   %dl,%dl
+  800e47:	74 18                	je     800e61 <strchr+0x1f>
+        if (*str == c) {
+  800e49:	0f be d2             	movsbl %dl,%edx
+  800e4c:	39 f2                	cmp    %esi,%edx
+  800e4e:	74 17                	je     800e67 <strchr+0x25>
+    for (; *str; str++) {
+  800e50:	48 83 c7 01          	add    $0x1,%rdi
+  800e54:	0f b6 17             	movzbl (%rdi),%edx
+  800e57:	84 d2                	test   %dl,%dl
+  800e59:	75 ee                	jne    800e49 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e60:	c3                   	ret
+  800e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e66:	c3                   	ret
+  800e67:	48 89 f8             	mov    %rdi,%rax
+}
+  800e6a:	c3                   	ret
+
+0000000000800e6b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e6b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e6e:	0f b6 17             	movzbl (%rdi),%edx
+  800e71:	84 d2                	test   %dl,%dl
+  800e73:	74 13                	je     800e88 <strfind+0x1d>
+  800e75:	0f be d2             	movsbl %dl,%edx
+  800e78:	39 f2                	cmp    %esi,%edx
+  800e7a:	74 0b                	je     800e87 <strfind+0x1c>
+  800e7c:	48 83 c0 01          	add    $0x1,%rax
+  800e80:	0f b6 10             	movzbl (%rax),%edx
+  800e83:	84 d2                	test   %dl,%dl
+  800e85:	75 ee                	jne    800e75 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e87:	c3                   	ret
+  800e88:	c3                   	ret
+
+0000000000800e89 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e89:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e8c:	48 89 f8             	mov    %rdi,%rax
+  800e8f:	48 f7 d8             	neg    %rax
+  800e92:	83 e0 07             	and    $0x7,%eax
+  800e95:	49 89 d1             	mov    %rdx,%r9
+  800e98:	49 29 c1             	sub    %rax,%r9
+  800e9b:	78 36                	js     800ed3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e9d:	40 0f b6 c6          	movzbl %sil,%eax
+  800ea1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ea8:	01 01 01 
+  800eab:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800eaf:	40 f6 c7 07          	test   $0x7,%dil
+  800eb3:	75 38                	jne    800eed <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800eb5:	4c 89 c9             	mov    %r9,%rcx
+  800eb8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ebc:	74 0c                	je     800eca <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ebe:	fc                   	cld
+  800ebf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ec2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ec6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800eca:	4d 85 c9             	test   %r9,%r9
+  800ecd:	75 45                	jne    800f14 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ecf:	4c 89 c0             	mov    %r8,%rax
+  800ed2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ed3:	48 85 d2             	test   %rdx,%rdx
+  800ed6:	74 f7                	je     800ecf <memset+0x46>
+  800ed8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800edb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ede:	48 83 c0 01          	add    $0x1,%rax
+  800ee2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ee6:	48 39 c2             	cmp    %rax,%rdx
+  800ee9:	75 f3                	jne    800ede <memset+0x55>
+  800eeb:	eb e2                	jmp    800ecf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800eed:	40 f6 c7 01          	test   $0x1,%dil
+  800ef1:	74 06                	je     800ef9 <memset+0x70>
+  800ef3:	88 07                	mov    %al,(%rdi)
+  800ef5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ef9:	40 f6 c7 02          	test   $0x2,%dil
+  800efd:	74 07                	je     800f06 <memset+0x7d>
+  800eff:	66 89 07             	mov    %ax,(%rdi)
+  800f02:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f06:	40 f6 c7 04          	test   $0x4,%dil
+  800f0a:	74 a9                	je     800eb5 <memset+0x2c>
+  800f0c:	89 07                	mov    %eax,(%rdi)
+  800f0e:	48 83 c7 04          	add    $0x4,%rdi
+  800f12:	eb a1                	jmp    800eb5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f14:	41 f6 c1 04          	test   $0x4,%r9b
+  800f18:	74 06                	je     800f20 <memset+0x97>
+  800f1a:	89 07                	mov    %eax,(%rdi)
+  800f1c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f20:	41 f6 c1 02          	test   $0x2,%r9b
+  800f24:	74 07                	je     800f2d <memset+0xa4>
+  800f26:	66 89 07             	mov    %ax,(%rdi)
+  800f29:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f2d:	41 f6 c1 01          	test   $0x1,%r9b
+  800f31:	74 9c                	je     800ecf <memset+0x46>
+  800f33:	88 07                	mov    %al,(%rdi)
+  800f35:	eb 98                	jmp    800ecf <memset+0x46>
+
+0000000000800f37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f37:	48 89 f8             	mov    %rdi,%rax
+  800f3a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f3d:	48 39 fe             	cmp    %rdi,%rsi
+  800f40:	73 3b                	jae    800f7d <memmove+0x46>
+  800f42:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f46:	48 39 d7             	cmp    %rdx,%rdi
+  800f49:	73 32                	jae    800f7d <memmove+0x46>
+        s += n;
+        d += n;
+  800f4b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f4f:	48 89 d6             	mov    %rdx,%rsi
+  800f52:	48 09 fe             	or     %rdi,%rsi
+  800f55:	48 09 ce             	or     %rcx,%rsi
+  800f58:	40 f6 c6 07          	test   $0x7,%sil
+  800f5c:	75 12                	jne    800f70 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f5e:	48 83 ef 08          	sub    $0x8,%rdi
+  800f62:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f66:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f6a:	fd                   	std
+  800f6b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f6e:	fc                   	cld
+  800f6f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f70:	48 83 ef 01          	sub    $0x1,%rdi
+  800f74:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f78:	fd                   	std
+  800f79:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f7b:	eb f1                	jmp    800f6e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f7d:	48 89 f2             	mov    %rsi,%rdx
+  800f80:	48 09 c2             	or     %rax,%rdx
+  800f83:	48 09 ca             	or     %rcx,%rdx
+  800f86:	f6 c2 07             	test   $0x7,%dl
+  800f89:	75 0c                	jne    800f97 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f8b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f8f:	48 89 c7             	mov    %rax,%rdi
+  800f92:	fc                   	cld
+  800f93:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f96:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f97:	48 89 c7             	mov    %rax,%rdi
+  800f9a:	fc                   	cld
+  800f9b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f9d:	c3                   	ret
+
+0000000000800f9e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f9e:	55                   	push   %rbp
+  800f9f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fa2:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+}
+  800fae:	5d                   	pop    %rbp
+  800faf:	c3                   	ret
+
+0000000000800fb0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fb0:	55                   	push   %rbp
+  800fb1:	48 89 e5             	mov    %rsp,%rbp
+  800fb4:	41 57                	push   %r15
+  800fb6:	41 56                	push   %r14
+  800fb8:	41 55                	push   %r13
+  800fba:	41 54                	push   %r12
+  800fbc:	53                   	push   %rbx
+  800fbd:	48 83 ec 08          	sub    $0x8,%rsp
+  800fc1:	49 89 fe             	mov    %rdi,%r14
+  800fc4:	49 89 f7             	mov    %rsi,%r15
+  800fc7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fca:	48 89 f7             	mov    %rsi,%rdi
+  800fcd:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  800fd4:	00 00 00 
+  800fd7:	ff d0                	call   *%rax
+  800fd9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fdc:	48 89 de             	mov    %rbx,%rsi
+  800fdf:	4c 89 f7             	mov    %r14,%rdi
+  800fe2:	48 b8 1a 0d 80 00 00 	movabs $0x800d1a,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+  800fee:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ff1:	48 39 c3             	cmp    %rax,%rbx
+  800ff4:	74 36                	je     80102c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ff6:	48 89 d8             	mov    %rbx,%rax
+  800ff9:	4c 29 e8             	sub    %r13,%rax
+  800ffc:	49 39 c4             	cmp    %rax,%r12
+  800fff:	73 31                	jae    801032 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801001:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801006:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80100a:	4c 89 fe             	mov    %r15,%rsi
+  80100d:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  801014:	00 00 00 
+  801017:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801019:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80101d:	48 83 c4 08          	add    $0x8,%rsp
+  801021:	5b                   	pop    %rbx
+  801022:	41 5c                	pop    %r12
+  801024:	41 5d                	pop    %r13
+  801026:	41 5e                	pop    %r14
+  801028:	41 5f                	pop    %r15
+  80102a:	5d                   	pop    %rbp
+  80102b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80102c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801030:	eb eb                	jmp    80101d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801032:	48 83 eb 01          	sub    $0x1,%rbx
+  801036:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80103a:	48 89 da             	mov    %rbx,%rdx
+  80103d:	4c 89 fe             	mov    %r15,%rsi
+  801040:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  801047:	00 00 00 
+  80104a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80104c:	49 01 de             	add    %rbx,%r14
+  80104f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801054:	eb c3                	jmp    801019 <strlcat+0x69>
+
+0000000000801056 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801056:	48 85 d2             	test   %rdx,%rdx
+  801059:	74 2d                	je     801088 <memcmp+0x32>
+  80105b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801060:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801064:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801069:	44 38 c1             	cmp    %r8b,%cl
+  80106c:	75 0f                	jne    80107d <memcmp+0x27>
+    while (n-- > 0) {
+  80106e:	48 83 c0 01          	add    $0x1,%rax
+  801072:	48 39 c2             	cmp    %rax,%rdx
+  801075:	75 e9                	jne    801060 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80107d:	0f b6 c1             	movzbl %cl,%eax
+  801080:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801084:	44 29 c0             	sub    %r8d,%eax
+  801087:	c3                   	ret
+    return 0;
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80108d:	c3                   	ret
+
+000000000080108e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80108e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801092:	48 39 c7             	cmp    %rax,%rdi
+  801095:	73 0f                	jae    8010a6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801097:	40 38 37             	cmp    %sil,(%rdi)
+  80109a:	74 0e                	je     8010aa <memfind+0x1c>
+    for (; src < end; src++) {
+  80109c:	48 83 c7 01          	add    $0x1,%rdi
+  8010a0:	48 39 f8             	cmp    %rdi,%rax
+  8010a3:	75 f2                	jne    801097 <memfind+0x9>
+  8010a5:	c3                   	ret
+  8010a6:	48 89 f8             	mov    %rdi,%rax
+  8010a9:	c3                   	ret
+  8010aa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010ad:	c3                   	ret
+
+00000000008010ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010ae:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010b1:	0f b6 37             	movzbl (%rdi),%esi
+  8010b4:	40 80 fe 20          	cmp    $0x20,%sil
+  8010b8:	74 06                	je     8010c0 <strtol+0x12>
+  8010ba:	40 80 fe 09          	cmp    $0x9,%sil
+  8010be:	75 13                	jne    8010d3 <strtol+0x25>
+  8010c0:	48 83 c7 01          	add    $0x1,%rdi
+  8010c4:	0f b6 37             	movzbl (%rdi),%esi
+  8010c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8010cb:	74 f3                	je     8010c0 <strtol+0x12>
+  8010cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8010d1:	74 ed                	je     8010c0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010d3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010d6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010d9:	3c 01                	cmp    $0x1,%al
+  8010db:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010df:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010e5:	75 0f                	jne    8010f6 <strtol+0x48>
+  8010e7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010ea:	74 14                	je     801100 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010ec:	85 d2                	test   %edx,%edx
+  8010ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010f3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010f6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010fb:	4c 63 ca             	movslq %edx,%r9
+  8010fe:	eb 36                	jmp    801136 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801100:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801104:	74 0f                	je     801115 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801106:	85 d2                	test   %edx,%edx
+  801108:	75 ec                	jne    8010f6 <strtol+0x48>
+        s++;
+  80110a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80110e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801113:	eb e1                	jmp    8010f6 <strtol+0x48>
+        s += 2;
+  801115:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801119:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80111e:	eb d6                	jmp    8010f6 <strtol+0x48>
+            dig -= '0';
+  801120:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801123:	44 0f b6 c1          	movzbl %cl,%r8d
+  801127:	41 39 d0             	cmp    %edx,%r8d
+  80112a:	7d 21                	jge    80114d <strtol+0x9f>
+        val = val * base + dig;
+  80112c:	49 0f af c1          	imul   %r9,%rax
+  801130:	0f b6 c9             	movzbl %cl,%ecx
+  801133:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801136:	48 83 c7 01          	add    $0x1,%rdi
+  80113a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80113e:	80 f9 39             	cmp    $0x39,%cl
+  801141:	76 dd                	jbe    801120 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801143:	80 f9 7b             	cmp    $0x7b,%cl
+  801146:	77 05                	ja     80114d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801148:	83 e9 57             	sub    $0x57,%ecx
+  80114b:	eb d6                	jmp    801123 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80114d:	4d 85 d2             	test   %r10,%r10
+  801150:	74 03                	je     801155 <strtol+0xa7>
+  801152:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801155:	48 89 c2             	mov    %rax,%rdx
+  801158:	48 f7 da             	neg    %rdx
+  80115b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80115f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801163:	c3                   	ret
+
+0000000000801164 <strrev>:
+
+void
+strrev(char *str)
+{
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+  801168:	53                   	push   %rbx
+  801169:	48 83 ec 08          	sub    $0x8,%rsp
+  80116d:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801170:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  801177:	00 00 00 
+  80117a:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80117c:	83 e8 01             	sub    $0x1,%eax
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	7e 22                	jle    8011a5 <strrev+0x41>
+  801183:	48 98                	cltq
+  801185:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80118a:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80118e:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801192:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801196:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801199:	48 83 c2 01          	add    $0x1,%rdx
+  80119d:	48 83 e8 01          	sub    $0x1,%rax
+  8011a1:	39 c2                	cmp    %eax,%edx
+  8011a3:	7c e5                	jl     80118a <strrev+0x26>
+	}
+}
+  8011a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a9:	c9                   	leave
+  8011aa:	c3                   	ret
+
+00000000008011ab <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8011ab:	85 d2                	test   %edx,%edx
+  8011ad:	0f 84 80 00 00 00    	je     801233 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+  8011b7:	53                   	push   %rbx
+  8011b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bc:	49 89 f2             	mov    %rsi,%r10
+  8011bf:	41 89 d3             	mov    %edx,%r11d
+  8011c2:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8011c5:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8011ca:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8011cd:	eb 20                	jmp    8011ef <itoa+0x44>
+			str[i++] = '0' + digit;
+  8011cf:	41 89 f1             	mov    %esi,%r9d
+  8011d2:	83 c2 30             	add    $0x30,%edx
+  8011d5:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8011d8:	89 f8                	mov    %edi,%eax
+  8011da:	99                   	cltd
+  8011db:	f7 f9                	idiv   %ecx
+  8011dd:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8011df:	85 c0                	test   %eax,%eax
+  8011e1:	74 2e                	je     801211 <itoa+0x66>
+  8011e3:	83 c6 01             	add    $0x1,%esi
+  8011e6:	49 83 c0 01          	add    $0x1,%r8
+  8011ea:	44 39 cb             	cmp    %r9d,%ebx
+  8011ed:	7e 15                	jle    801204 <itoa+0x59>
+		digit = sum % base;
+  8011ef:	89 f8                	mov    %edi,%eax
+  8011f1:	99                   	cltd
+  8011f2:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8011f4:	83 fa 09             	cmp    $0x9,%edx
+  8011f7:	7e d6                	jle    8011cf <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8011f9:	41 89 f1             	mov    %esi,%r9d
+  8011fc:	83 c2 37             	add    $0x37,%edx
+  8011ff:	41 88 10             	mov    %dl,(%r8)
+  801202:	eb d4                	jmp    8011d8 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801204:	41 83 eb 01          	sub    $0x1,%r11d
+  801208:	45 39 cb             	cmp    %r9d,%r11d
+  80120b:	75 04                	jne    801211 <itoa+0x66>
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	75 28                	jne    801239 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801211:	4d 63 c9             	movslq %r9d,%r9
+  801214:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801219:	4c 89 d7             	mov    %r10,%rdi
+  80121c:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  801223:	00 00 00 
+  801226:	ff d0                	call   *%rax
+	return 0;
+  801228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+		return -1;
+  801233:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801238:	c3                   	ret
+		return -1;
+  801239:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80123e:	eb ed                	jmp    80122d <itoa+0x82>
+
+0000000000801240 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801240:	55                   	push   %rbp
+  801241:	48 89 e5             	mov    %rsp,%rbp
+  801244:	53                   	push   %rbx
+  801245:	48 89 fa             	mov    %rdi,%rdx
+  801248:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801255:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125a:	be 00 00 00 00       	mov    $0x0,%esi
+  80125f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801265:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+
+000000000080126d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80126d:	55                   	push   %rbp
+  80126e:	48 89 e5             	mov    %rsp,%rbp
+  801271:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801272:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801277:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128b:	be 00 00 00 00       	mov    $0x0,%esi
+  801290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801296:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129c:	c9                   	leave
+  80129d:	c3                   	ret
+
+000000000080129e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012aa:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012be:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012cb:	48 85 c0             	test   %rax,%rax
+  8012ce:	7f 06                	jg     8012d6 <sys_env_destroy+0x38>
+}
+  8012d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d6:	49 89 c0             	mov    %rax,%r8
+  8012d9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012de:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  8012e5:	00 00 00 
+  8012e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ed:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  8012f4:	00 00 00 
+  8012f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fc:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  801303:	00 00 00 
+  801306:	41 ff d1             	call   *%r9
+
+0000000000801309 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801309:	55                   	push   %rbp
+  80130a:	48 89 e5             	mov    %rsp,%rbp
+  80130d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80130e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801313:	ba 00 00 00 00       	mov    $0x0,%edx
+  801318:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+000000000080133a <sys_yield>:
+
+void
+sys_yield(void) {
+  80133a:	55                   	push   %rbp
+  80133b:	48 89 e5             	mov    %rsp,%rbp
+  80133e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801344:	ba 00 00 00 00       	mov    $0x0,%edx
+  801349:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801358:	be 00 00 00 00       	mov    $0x0,%esi
+  80135d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801363:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801365:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+
+000000000080136b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80136b:	55                   	push   %rbp
+  80136c:	48 89 e5             	mov    %rsp,%rbp
+  80136f:	53                   	push   %rbx
+  801370:	48 89 fa             	mov    %rdi,%rdx
+  801373:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801382:	00 00 00 
+  801385:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138a:	be 00 00 00 00       	mov    $0x0,%esi
+  80138f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801395:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+000000000080139d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	53                   	push   %rbx
+  8013a2:	49 89 f8             	mov    %rdi,%r8
+  8013a5:	48 89 d3             	mov    %rdx,%rbx
+  8013a8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b0:	4c 89 c2             	mov    %r8,%rdx
+  8013b3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+
+00000000008013c9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013c9:	55                   	push   %rbp
+  8013ca:	48 89 e5             	mov    %rsp,%rbp
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d2:	89 f8                	mov    %edi,%eax
+  8013d4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013d7:	48 63 f9             	movslq %ecx,%rdi
+  8013da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dd:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f2:	48 85 c0             	test   %rax,%rax
+  8013f5:	7f 06                	jg     8013fd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fd:	49 89 c0             	mov    %rax,%r8
+  801400:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801405:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  80140c:	00 00 00 
+  80140f:	be 26 00 00 00       	mov    $0x26,%esi
+  801414:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  80141b:	00 00 00 
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801423:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  80142a:	00 00 00 
+  80142d:	41 ff d1             	call   *%r9
+
+0000000000801430 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	53                   	push   %rbx
+  801435:	48 83 ec 08          	sub    $0x8,%rsp
+  801439:	89 f8                	mov    %edi,%eax
+  80143b:	49 89 f2             	mov    %rsi,%r10
+  80143e:	48 89 cf             	mov    %rcx,%rdi
+  801441:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801444:	48 63 da             	movslq %edx,%rbx
+  801447:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801452:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801455:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801457:	48 85 c0             	test   %rax,%rax
+  80145a:	7f 06                	jg     801462 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80145c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801460:	c9                   	leave
+  801461:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801462:	49 89 c0             	mov    %rax,%r8
+  801465:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80146a:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  801471:	00 00 00 
+  801474:	be 26 00 00 00       	mov    $0x26,%esi
+  801479:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  801480:	00 00 00 
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+  801488:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  80148f:	00 00 00 
+  801492:	41 ff d1             	call   *%r9
+
+0000000000801495 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801495:	55                   	push   %rbp
+  801496:	48 89 e5             	mov    %rsp,%rbp
+  801499:	53                   	push   %rbx
+  80149a:	48 83 ec 08          	sub    $0x8,%rsp
+  80149e:	48 89 f1             	mov    %rsi,%rcx
+  8014a1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014be:	48 85 c0             	test   %rax,%rax
+  8014c1:	7f 06                	jg     8014c9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c7:	c9                   	leave
+  8014c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c9:	49 89 c0             	mov    %rax,%r8
+  8014cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014d1:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  8014d8:	00 00 00 
+  8014db:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e0:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  8014e7:	00 00 00 
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  8014f6:	00 00 00 
+  8014f9:	41 ff d1             	call   *%r9
+
+00000000008014fc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014fc:	55                   	push   %rbp
+  8014fd:	48 89 e5             	mov    %rsp,%rbp
+  801500:	53                   	push   %rbx
+  801501:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801505:	48 63 ce             	movslq %esi,%rcx
+  801508:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801510:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801515:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151a:	be 00 00 00 00       	mov    $0x0,%esi
+  80151f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801525:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801527:	48 85 c0             	test   %rax,%rax
+  80152a:	7f 06                	jg     801532 <sys_env_set_status+0x36>
+}
+  80152c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801530:	c9                   	leave
+  801531:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801532:	49 89 c0             	mov    %rax,%r8
+  801535:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80153a:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  801541:	00 00 00 
+  801544:	be 26 00 00 00       	mov    $0x26,%esi
+  801549:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  801550:	00 00 00 
+  801553:	b8 00 00 00 00       	mov    $0x0,%eax
+  801558:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  80155f:	00 00 00 
+  801562:	41 ff d1             	call   *%r9
+
+0000000000801565 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801565:	55                   	push   %rbp
+  801566:	48 89 e5             	mov    %rsp,%rbp
+  801569:	53                   	push   %rbx
+  80156a:	48 83 ec 08          	sub    $0x8,%rsp
+  80156e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801571:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801579:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801583:	be 00 00 00 00       	mov    $0x0,%esi
+  801588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801590:	48 85 c0             	test   %rax,%rax
+  801593:	7f 06                	jg     80159b <sys_env_set_trapframe+0x36>
+}
+  801595:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159b:	49 89 c0             	mov    %rax,%r8
+  80159e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015a3:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  8015aa:	00 00 00 
+  8015ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b2:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  8015b9:	00 00 00 
+  8015bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c1:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  8015c8:	00 00 00 
+  8015cb:	41 ff d1             	call   *%r9
+
+00000000008015ce <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015ce:	55                   	push   %rbp
+  8015cf:	48 89 e5             	mov    %rsp,%rbp
+  8015d2:	53                   	push   %rbx
+  8015d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dd:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f9:	48 85 c0             	test   %rax,%rax
+  8015fc:	7f 06                	jg     801604 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801602:	c9                   	leave
+  801603:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801604:	49 89 c0             	mov    %rax,%r8
+  801607:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80160c:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  801613:	00 00 00 
+  801616:	be 26 00 00 00       	mov    $0x26,%esi
+  80161b:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  801622:	00 00 00 
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  801631:	00 00 00 
+  801634:	41 ff d1             	call   *%r9
+
+0000000000801637 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801637:	55                   	push   %rbp
+  801638:	48 89 e5             	mov    %rsp,%rbp
+  80163b:	53                   	push   %rbx
+  80163c:	89 f8                	mov    %edi,%eax
+  80163e:	49 89 f1             	mov    %rsi,%r9
+  801641:	48 89 d3             	mov    %rdx,%rbx
+  801644:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801647:	49 63 f0             	movslq %r8d,%rsi
+  80164a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801652:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801655:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165b:	cd 30                	int    $0x30
+}
+  80165d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801661:	c9                   	leave
+  801662:	c3                   	ret
+
+0000000000801663 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801663:	55                   	push   %rbp
+  801664:	48 89 e5             	mov    %rsp,%rbp
+  801667:	53                   	push   %rbx
+  801668:	48 83 ec 08          	sub    $0x8,%rsp
+  80166c:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80166f:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801672:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801677:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167f:	be 00 00 00 00       	mov    $0x0,%esi
+  801684:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168c:	48 85 c0             	test   %rax,%rax
+  80168f:	7f 06                	jg     801697 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801691:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801695:	c9                   	leave
+  801696:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801697:	49 89 c0             	mov    %rax,%r8
+  80169a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80169f:	48 ba e8 40 80 00 00 	movabs $0x8040e8,%rdx
+  8016a6:	00 00 00 
+  8016a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ae:	48 bf 07 41 80 00 00 	movabs $0x804107,%rdi
+  8016b5:	00 00 00 
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bd:	49 b9 a4 37 80 00 00 	movabs $0x8037a4,%r9
+  8016c4:	00 00 00 
+  8016c7:	41 ff d1             	call   *%r9
+
+00000000008016ca <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8016ca:	55                   	push   %rbp
+  8016cb:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8016ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d3:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  8016da:	00 00 00 
+  8016dd:	ff d0                	call   *%rax
+}
+  8016df:	5d                   	pop    %rbp
+  8016e0:	c3                   	ret
+
+00000000008016e1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016e1:	55                   	push   %rbp
+  8016e2:	48 89 e5             	mov    %rsp,%rbp
+  8016e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80170c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801710:	c9                   	leave
+  801711:	c3                   	ret
+
+0000000000801712 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801712:	55                   	push   %rbp
+  801713:	48 89 e5             	mov    %rsp,%rbp
+  801716:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801717:	48 63 ce             	movslq %esi,%rcx
+  80171a:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80171e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172d:	be 00 00 00 00       	mov    $0x0,%esi
+  801732:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801738:	cd 30                	int    $0x30
+}
+  80173a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173e:	c9                   	leave
+  80173f:	c3                   	ret
+
+0000000000801740 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801740:	55                   	push   %rbp
+  801741:	48 89 e5             	mov    %rsp,%rbp
+  801744:	53                   	push   %rbx
+  801745:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801748:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80174c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801751:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801756:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175b:	be 00 00 00 00       	mov    $0x0,%esi
+  801760:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801766:	cd 30                	int    $0x30
+}
+  801768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+
+000000000080176e <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80176e:	55                   	push   %rbp
+  80176f:	48 89 e5             	mov    %rsp,%rbp
+  801772:	53                   	push   %rbx
+  801773:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801776:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801779:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80177e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801781:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801786:	be 00 00 00 00       	mov    $0x0,%esi
+  80178b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801791:	cd 30                	int    $0x30
+}
+  801793:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801797:	c9                   	leave
+  801798:	c3                   	ret
+
+0000000000801799 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801799:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  80179c:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  8017a0:	83 3f 01             	cmpl   $0x1,(%rdi)
+  8017a3:	7e 0f                	jle    8017b4 <argstart+0x1b>
+  8017a5:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  8017ac:	00 00 00 
+  8017af:	48 85 f6             	test   %rsi,%rsi
+  8017b2:	75 05                	jne    8017b9 <argstart+0x20>
+  8017b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b9:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  8017bd:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  8017c4:	00 
+}
+  8017c5:	c3                   	ret
+
+00000000008017c6 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  8017c6:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8017cd:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8017ce:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8017d2:	48 85 c0             	test   %rax,%rax
+  8017d5:	0f 84 8f 00 00 00    	je     80186a <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8017db:	55                   	push   %rbp
+  8017dc:	48 89 e5             	mov    %rsp,%rbp
+  8017df:	53                   	push   %rbx
+  8017e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e4:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8017e7:	80 38 00             	cmpb   $0x0,(%rax)
+  8017ea:	75 52                	jne    80183e <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8017ec:	48 8b 17             	mov    (%rdi),%rdx
+  8017ef:	83 3a 01             	cmpl   $0x1,(%rdx)
+  8017f2:	74 67                	je     80185b <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8017f4:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8017f8:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8017fc:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8017ff:	75 5a                	jne    80185b <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801801:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801805:	74 54                	je     80185b <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801807:	48 83 c0 01          	add    $0x1,%rax
+  80180b:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80180f:	8b 12                	mov    (%rdx),%edx
+  801811:	83 ea 01             	sub    $0x1,%edx
+  801814:	48 63 d2             	movslq %edx,%rdx
+  801817:	48 c1 e2 03          	shl    $0x3,%rdx
+  80181b:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80181f:	48 83 c7 08          	add    $0x8,%rdi
+  801823:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80182f:	48 8b 03             	mov    (%rbx),%rax
+  801832:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801835:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801839:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80183c:	74 17                	je     801855 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80183e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801842:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801845:	48 83 c0 01          	add    $0x1,%rax
+  801849:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80184d:	89 d0                	mov    %edx,%eax
+  80184f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801853:	c9                   	leave
+  801854:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801855:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801859:	75 e3                	jne    80183e <argnext+0x78>
+    args->curarg = 0;
+  80185b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801862:	00 
+    return -1;
+  801863:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801868:	eb e3                	jmp    80184d <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  80186a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80186f:	89 d0                	mov    %edx,%eax
+  801871:	c3                   	ret
+
+0000000000801872 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801872:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801876:	48 85 c0             	test   %rax,%rax
+  801879:	74 7b                	je     8018f6 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80187b:	55                   	push   %rbp
+  80187c:	48 89 e5             	mov    %rsp,%rbp
+  80187f:	53                   	push   %rbx
+  801880:	48 83 ec 08          	sub    $0x8,%rsp
+  801884:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801887:	80 38 00             	cmpb   $0x0,(%rax)
+  80188a:	74 1c                	je     8018a8 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80188c:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801890:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  801897:	00 00 00 
+  80189a:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  80189e:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8018a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8018a8:	48 8b 07             	mov    (%rdi),%rax
+  8018ab:	83 38 01             	cmpl   $0x1,(%rax)
+  8018ae:	7f 12                	jg     8018c2 <argnextvalue+0x50>
+        args->argvalue = 0;
+  8018b0:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8018b7:	00 
+        args->curarg = 0;
+  8018b8:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8018bf:	00 
+  8018c0:	eb dc                	jmp    80189e <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8018c2:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8018c6:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8018ca:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8018ce:	8b 10                	mov    (%rax),%edx
+  8018d0:	83 ea 01             	sub    $0x1,%edx
+  8018d3:	48 63 d2             	movslq %edx,%rdx
+  8018d6:	48 c1 e2 03          	shl    $0x3,%rdx
+  8018da:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8018de:	48 83 c7 08          	add    $0x8,%rdi
+  8018e2:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8018ee:	48 8b 03             	mov    (%rbx),%rax
+  8018f1:	83 28 01             	subl   $0x1,(%rax)
+  8018f4:	eb a8                	jmp    80189e <argnextvalue+0x2c>
+}
+  8018f6:	c3                   	ret
+
+00000000008018f7 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8018f7:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8018fb:	48 85 c0             	test   %rax,%rax
+  8018fe:	74 01                	je     801901 <argvalue+0xa>
+}
+  801900:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801901:	55                   	push   %rbp
+  801902:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801905:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+}
+  801911:	5d                   	pop    %rbp
+  801912:	c3                   	ret
+
+0000000000801913 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801913:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80191a:	ff ff ff 
+  80191d:	48 01 f8             	add    %rdi,%rax
+  801920:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801924:	c3                   	ret
+
+0000000000801925 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801925:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80192c:	ff ff ff 
+  80192f:	48 01 f8             	add    %rdi,%rax
+  801932:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801936:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80193c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801940:	c3                   	ret
+
+0000000000801941 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801941:	55                   	push   %rbp
+  801942:	48 89 e5             	mov    %rsp,%rbp
+  801945:	41 57                	push   %r15
+  801947:	41 56                	push   %r14
+  801949:	41 55                	push   %r13
+  80194b:	41 54                	push   %r12
+  80194d:	53                   	push   %rbx
+  80194e:	48 83 ec 08          	sub    $0x8,%rsp
+  801952:	49 89 ff             	mov    %rdi,%r15
+  801955:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80195a:	49 bd 60 34 80 00 00 	movabs $0x803460,%r13
+  801961:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801964:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80196a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80196d:	48 89 df             	mov    %rbx,%rdi
+  801970:	41 ff d5             	call   *%r13
+  801973:	83 e0 04             	and    $0x4,%eax
+  801976:	74 17                	je     80198f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801978:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80197f:	4c 39 f3             	cmp    %r14,%rbx
+  801982:	75 e6                	jne    80196a <fd_alloc+0x29>
+  801984:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80198a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80198f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801992:	48 83 c4 08          	add    $0x8,%rsp
+  801996:	5b                   	pop    %rbx
+  801997:	41 5c                	pop    %r12
+  801999:	41 5d                	pop    %r13
+  80199b:	41 5e                	pop    %r14
+  80199d:	41 5f                	pop    %r15
+  80199f:	5d                   	pop    %rbp
+  8019a0:	c3                   	ret
+
+00000000008019a1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019a1:	83 ff 1f             	cmp    $0x1f,%edi
+  8019a4:	77 39                	ja     8019df <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+  8019aa:	41 54                	push   %r12
+  8019ac:	53                   	push   %rbx
+  8019ad:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019b0:	48 63 df             	movslq %edi,%rbx
+  8019b3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019ba:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019be:	48 89 df             	mov    %rbx,%rdi
+  8019c1:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+  8019cd:	a8 04                	test   $0x4,%al
+  8019cf:	74 14                	je     8019e5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019d1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019da:	5b                   	pop    %rbx
+  8019db:	41 5c                	pop    %r12
+  8019dd:	5d                   	pop    %rbp
+  8019de:	c3                   	ret
+        return -E_INVAL;
+  8019df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019e4:	c3                   	ret
+        return -E_INVAL;
+  8019e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ea:	eb ee                	jmp    8019da <fd_lookup+0x39>
+
+00000000008019ec <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019ec:	55                   	push   %rbp
+  8019ed:	48 89 e5             	mov    %rsp,%rbp
+  8019f0:	41 54                	push   %r12
+  8019f2:	53                   	push   %rbx
+  8019f3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019f6:	48 b8 c0 41 80 00 00 	movabs $0x8041c0,%rax
+  8019fd:	00 00 00 
+  801a00:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a07:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a0a:	39 3b                	cmp    %edi,(%rbx)
+  801a0c:	74 47                	je     801a55 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a0e:	48 83 c0 08          	add    $0x8,%rax
+  801a12:	48 8b 18             	mov    (%rax),%rbx
+  801a15:	48 85 db             	test   %rbx,%rbx
+  801a18:	75 f0                	jne    801a0a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a1a:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  801a21:	00 00 00 
+  801a24:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a2a:	89 fa                	mov    %edi,%edx
+  801a2c:	48 bf 18 41 80 00 00 	movabs $0x804118,%rdi
+  801a33:	00 00 00 
+  801a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3b:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801a42:	00 00 00 
+  801a45:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a4c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a50:	5b                   	pop    %rbx
+  801a51:	41 5c                	pop    %r12
+  801a53:	5d                   	pop    %rbp
+  801a54:	c3                   	ret
+            return 0;
+  801a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5a:	eb f0                	jmp    801a4c <dev_lookup+0x60>
+
+0000000000801a5c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a5c:	55                   	push   %rbp
+  801a5d:	48 89 e5             	mov    %rsp,%rbp
+  801a60:	41 55                	push   %r13
+  801a62:	41 54                	push   %r12
+  801a64:	53                   	push   %rbx
+  801a65:	48 83 ec 18          	sub    $0x18,%rsp
+  801a69:	48 89 fb             	mov    %rdi,%rbx
+  801a6c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a6f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a76:	ff ff ff 
+  801a79:	48 01 df             	add    %rbx,%rdi
+  801a7c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a80:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a84:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801a8b:	00 00 00 
+  801a8e:	ff d0                	call   *%rax
+  801a90:	41 89 c5             	mov    %eax,%r13d
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	78 06                	js     801a9d <fd_close+0x41>
+  801a97:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a9b:	74 1a                	je     801ab7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a9d:	45 84 e4             	test   %r12b,%r12b
+  801aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801aa9:	44 89 e8             	mov    %r13d,%eax
+  801aac:	48 83 c4 18          	add    $0x18,%rsp
+  801ab0:	5b                   	pop    %rbx
+  801ab1:	41 5c                	pop    %r12
+  801ab3:	41 5d                	pop    %r13
+  801ab5:	5d                   	pop    %rbp
+  801ab6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ab7:	8b 3b                	mov    (%rbx),%edi
+  801ab9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801abd:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801ac4:	00 00 00 
+  801ac7:	ff d0                	call   *%rax
+  801ac9:	41 89 c5             	mov    %eax,%r13d
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	78 1b                	js     801aeb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ad0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ad4:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ad8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ade:	48 85 c0             	test   %rax,%rax
+  801ae1:	74 08                	je     801aeb <fd_close+0x8f>
+  801ae3:	48 89 df             	mov    %rbx,%rdi
+  801ae6:	ff d0                	call   *%rax
+  801ae8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801aeb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801af0:	48 89 de             	mov    %rbx,%rsi
+  801af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af8:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+    return res;
+  801b04:	eb a3                	jmp    801aa9 <fd_close+0x4d>
+
+0000000000801b06 <close>:
+
+int
+close(int fdnum) {
+  801b06:	55                   	push   %rbp
+  801b07:	48 89 e5             	mov    %rsp,%rbp
+  801b0a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b0e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b12:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801b19:	00 00 00 
+  801b1c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 15                	js     801b37 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b22:	be 01 00 00 00       	mov    $0x1,%esi
+  801b27:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b2b:	48 b8 5c 1a 80 00 00 	movabs $0x801a5c,%rax
+  801b32:	00 00 00 
+  801b35:	ff d0                	call   *%rax
+}
+  801b37:	c9                   	leave
+  801b38:	c3                   	ret
+
+0000000000801b39 <close_all>:
+
+void
+close_all(void) {
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 54                	push   %r12
+  801b3f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b45:	49 bc 06 1b 80 00 00 	movabs $0x801b06,%r12
+  801b4c:	00 00 00 
+  801b4f:	89 df                	mov    %ebx,%edi
+  801b51:	41 ff d4             	call   *%r12
+  801b54:	83 c3 01             	add    $0x1,%ebx
+  801b57:	83 fb 20             	cmp    $0x20,%ebx
+  801b5a:	75 f3                	jne    801b4f <close_all+0x16>
+}
+  801b5c:	5b                   	pop    %rbx
+  801b5d:	41 5c                	pop    %r12
+  801b5f:	5d                   	pop    %rbp
+  801b60:	c3                   	ret
+
+0000000000801b61 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b61:	55                   	push   %rbp
+  801b62:	48 89 e5             	mov    %rsp,%rbp
+  801b65:	41 57                	push   %r15
+  801b67:	41 56                	push   %r14
+  801b69:	41 55                	push   %r13
+  801b6b:	41 54                	push   %r12
+  801b6d:	53                   	push   %rbx
+  801b6e:	48 83 ec 18          	sub    $0x18,%rsp
+  801b72:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b75:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b79:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	89 c3                	mov    %eax,%ebx
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	0f 88 b8 00 00 00    	js     801c47 <dup+0xe6>
+    close(newfdnum);
+  801b8f:	44 89 e7             	mov    %r12d,%edi
+  801b92:	48 b8 06 1b 80 00 00 	movabs $0x801b06,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b9e:	4d 63 ec             	movslq %r12d,%r13
+  801ba1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ba8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bac:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bb0:	4c 89 ff             	mov    %r15,%rdi
+  801bb3:	49 be 25 19 80 00 00 	movabs $0x801925,%r14
+  801bba:	00 00 00 
+  801bbd:	41 ff d6             	call   *%r14
+  801bc0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bc3:	4c 89 ef             	mov    %r13,%rdi
+  801bc6:	41 ff d6             	call   *%r14
+  801bc9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bcc:	48 89 df             	mov    %rbx,%rdi
+  801bcf:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  801bd6:	00 00 00 
+  801bd9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bdb:	a8 04                	test   $0x4,%al
+  801bdd:	74 2b                	je     801c0a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bdf:	41 89 c1             	mov    %eax,%r9d
+  801be2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be8:	4c 89 f1             	mov    %r14,%rcx
+  801beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf0:	48 89 de             	mov    %rbx,%rsi
+  801bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf8:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801bff:	00 00 00 
+  801c02:	ff d0                	call   *%rax
+  801c04:	89 c3                	mov    %eax,%ebx
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	78 4e                	js     801c58 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c0a:	4c 89 ff             	mov    %r15,%rdi
+  801c0d:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c1c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c22:	4c 89 e9             	mov    %r13,%rcx
+  801c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2a:	4c 89 fe             	mov    %r15,%rsi
+  801c2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c32:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+  801c3e:	89 c3                	mov    %eax,%ebx
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	78 14                	js     801c58 <dup+0xf7>
+
+    return newfdnum;
+  801c44:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c47:	89 d8                	mov    %ebx,%eax
+  801c49:	48 83 c4 18          	add    $0x18,%rsp
+  801c4d:	5b                   	pop    %rbx
+  801c4e:	41 5c                	pop    %r12
+  801c50:	41 5d                	pop    %r13
+  801c52:	41 5e                	pop    %r14
+  801c54:	41 5f                	pop    %r15
+  801c56:	5d                   	pop    %rbp
+  801c57:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c5d:	4c 89 ee             	mov    %r13,%rsi
+  801c60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c65:	49 bc 95 14 80 00 00 	movabs $0x801495,%r12
+  801c6c:	00 00 00 
+  801c6f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c77:	4c 89 f6             	mov    %r14,%rsi
+  801c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7f:	41 ff d4             	call   *%r12
+    return res;
+  801c82:	eb c3                	jmp    801c47 <dup+0xe6>
+
+0000000000801c84 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c84:	55                   	push   %rbp
+  801c85:	48 89 e5             	mov    %rsp,%rbp
+  801c88:	41 56                	push   %r14
+  801c8a:	41 55                	push   %r13
+  801c8c:	41 54                	push   %r12
+  801c8e:	53                   	push   %rbx
+  801c8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c93:	89 fb                	mov    %edi,%ebx
+  801c95:	49 89 f4             	mov    %rsi,%r12
+  801c98:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c9f:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	78 4c                	js     801cfb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801caf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cb3:	41 8b 3e             	mov    (%r14),%edi
+  801cb6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cba:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	78 35                	js     801cff <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cca:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cce:	83 e0 03             	and    $0x3,%eax
+  801cd1:	83 f8 01             	cmp    $0x1,%eax
+  801cd4:	74 2d                	je     801d03 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cda:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cde:	48 85 c0             	test   %rax,%rax
+  801ce1:	74 56                	je     801d39 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ce3:	4c 89 ea             	mov    %r13,%rdx
+  801ce6:	4c 89 e6             	mov    %r12,%rsi
+  801ce9:	4c 89 f7             	mov    %r14,%rdi
+  801cec:	ff d0                	call   *%rax
+}
+  801cee:	48 83 c4 10          	add    $0x10,%rsp
+  801cf2:	5b                   	pop    %rbx
+  801cf3:	41 5c                	pop    %r12
+  801cf5:	41 5d                	pop    %r13
+  801cf7:	41 5e                	pop    %r14
+  801cf9:	5d                   	pop    %rbp
+  801cfa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfb:	48 98                	cltq
+  801cfd:	eb ef                	jmp    801cee <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cff:	48 98                	cltq
+  801d01:	eb eb                	jmp    801cee <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d03:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  801d0a:	00 00 00 
+  801d0d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d13:	89 da                	mov    %ebx,%edx
+  801d15:	48 bf 79 41 80 00 00 	movabs $0x804179,%rdi
+  801d1c:	00 00 00 
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d24:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801d2b:	00 00 00 
+  801d2e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d30:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d37:	eb b5                	jmp    801cee <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d39:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d40:	eb ac                	jmp    801cee <read+0x6a>
+
+0000000000801d42 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801d42:	55                   	push   %rbp
+  801d43:	48 89 e5             	mov    %rsp,%rbp
+  801d46:	41 56                	push   %r14
+  801d48:	41 55                	push   %r13
+  801d4a:	41 54                	push   %r12
+  801d4c:	53                   	push   %rbx
+  801d4d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d51:	89 fb                	mov    %edi,%ebx
+  801d53:	49 89 f4             	mov    %rsi,%r12
+  801d56:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d59:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d5d:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 41                	js     801dae <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d6d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d71:	41 8b 3e             	mov    (%r14),%edi
+  801d74:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d78:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 35                	js     801dbd <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d88:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d8c:	83 e0 03             	and    $0x3,%eax
+  801d8f:	83 f8 01             	cmp    $0x1,%eax
+  801d92:	74 2d                	je     801dc1 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d98:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d9c:	48 85 c0             	test   %rax,%rax
+  801d9f:	74 56                	je     801df7 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801da1:	4c 89 ea             	mov    %r13,%rdx
+  801da4:	4c 89 e6             	mov    %r12,%rsi
+  801da7:	4c 89 f7             	mov    %r14,%rdi
+  801daa:	ff d0                	call   *%rax
+  801dac:	eb 02                	jmp    801db0 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dae:	48 98                	cltq
+}
+  801db0:	48 83 c4 10          	add    $0x10,%rsp
+  801db4:	5b                   	pop    %rbx
+  801db5:	41 5c                	pop    %r12
+  801db7:	41 5d                	pop    %r13
+  801db9:	41 5e                	pop    %r14
+  801dbb:	5d                   	pop    %rbp
+  801dbc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dbd:	48 98                	cltq
+  801dbf:	eb ef                	jmp    801db0 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dc1:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  801dc8:	00 00 00 
+  801dcb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dd1:	89 da                	mov    %ebx,%edx
+  801dd3:	48 bf 38 41 80 00 00 	movabs $0x804138,%rdi
+  801dda:	00 00 00 
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801de9:	00 00 00 
+  801dec:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801df5:	eb b9                	jmp    801db0 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801df7:	4c 89 ea             	mov    %r13,%rdx
+  801dfa:	4c 89 e6             	mov    %r12,%rsi
+  801dfd:	89 df                	mov    %ebx,%edi
+  801dff:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801e06:	00 00 00 
+  801e09:	ff d0                	call   *%rax
+  801e0b:	eb a3                	jmp    801db0 <readmap+0x6e>
+
+0000000000801e0d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e0d:	55                   	push   %rbp
+  801e0e:	48 89 e5             	mov    %rsp,%rbp
+  801e11:	41 57                	push   %r15
+  801e13:	41 56                	push   %r14
+  801e15:	41 55                	push   %r13
+  801e17:	41 54                	push   %r12
+  801e19:	53                   	push   %rbx
+  801e1a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e1e:	48 85 d2             	test   %rdx,%rdx
+  801e21:	74 54                	je     801e77 <readn+0x6a>
+  801e23:	41 89 fd             	mov    %edi,%r13d
+  801e26:	49 89 f6             	mov    %rsi,%r14
+  801e29:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e31:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e36:	49 bf 84 1c 80 00 00 	movabs $0x801c84,%r15
+  801e3d:	00 00 00 
+  801e40:	4c 89 e2             	mov    %r12,%rdx
+  801e43:	48 29 f2             	sub    %rsi,%rdx
+  801e46:	4c 01 f6             	add    %r14,%rsi
+  801e49:	44 89 ef             	mov    %r13d,%edi
+  801e4c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 20                	js     801e73 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e53:	01 c3                	add    %eax,%ebx
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	74 08                	je     801e61 <readn+0x54>
+  801e59:	48 63 f3             	movslq %ebx,%rsi
+  801e5c:	4c 39 e6             	cmp    %r12,%rsi
+  801e5f:	72 df                	jb     801e40 <readn+0x33>
+    }
+    return res;
+  801e61:	48 63 c3             	movslq %ebx,%rax
+}
+  801e64:	48 83 c4 08          	add    $0x8,%rsp
+  801e68:	5b                   	pop    %rbx
+  801e69:	41 5c                	pop    %r12
+  801e6b:	41 5d                	pop    %r13
+  801e6d:	41 5e                	pop    %r14
+  801e6f:	41 5f                	pop    %r15
+  801e71:	5d                   	pop    %rbp
+  801e72:	c3                   	ret
+        if (inc < 0) return inc;
+  801e73:	48 98                	cltq
+  801e75:	eb ed                	jmp    801e64 <readn+0x57>
+    int inc = 1, res = 0;
+  801e77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e7c:	eb e3                	jmp    801e61 <readn+0x54>
+
+0000000000801e7e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	41 56                	push   %r14
+  801e84:	41 55                	push   %r13
+  801e86:	41 54                	push   %r12
+  801e88:	53                   	push   %rbx
+  801e89:	48 83 ec 10          	sub    $0x10,%rsp
+  801e8d:	89 fb                	mov    %edi,%ebx
+  801e8f:	49 89 f4             	mov    %rsi,%r12
+  801e92:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e95:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e99:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+  801ea5:	85 c0                	test   %eax,%eax
+  801ea7:	78 47                	js     801ef0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ea9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ead:	41 8b 3e             	mov    (%r14),%edi
+  801eb0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eb4:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 30                	js     801ef4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ec4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ec9:	74 2d                	je     801ef8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ecb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ecf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ed3:	48 85 c0             	test   %rax,%rax
+  801ed6:	74 56                	je     801f2e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ed8:	4c 89 ea             	mov    %r13,%rdx
+  801edb:	4c 89 e6             	mov    %r12,%rsi
+  801ede:	4c 89 f7             	mov    %r14,%rdi
+  801ee1:	ff d0                	call   *%rax
+}
+  801ee3:	48 83 c4 10          	add    $0x10,%rsp
+  801ee7:	5b                   	pop    %rbx
+  801ee8:	41 5c                	pop    %r12
+  801eea:	41 5d                	pop    %r13
+  801eec:	41 5e                	pop    %r14
+  801eee:	5d                   	pop    %rbp
+  801eef:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef0:	48 98                	cltq
+  801ef2:	eb ef                	jmp    801ee3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef4:	48 98                	cltq
+  801ef6:	eb eb                	jmp    801ee3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ef8:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  801eff:	00 00 00 
+  801f02:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f08:	89 da                	mov    %ebx,%edx
+  801f0a:	48 bf 95 41 80 00 00 	movabs $0x804195,%rdi
+  801f11:	00 00 00 
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801f20:	00 00 00 
+  801f23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f25:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f2c:	eb b5                	jmp    801ee3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f2e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f35:	eb ac                	jmp    801ee3 <write+0x65>
+
+0000000000801f37 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f37:	55                   	push   %rbp
+  801f38:	48 89 e5             	mov    %rsp,%rbp
+  801f3b:	53                   	push   %rbx
+  801f3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f40:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f42:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f46:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	78 0c                	js     801f62 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f5a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f66:	c9                   	leave
+  801f67:	c3                   	ret
+
+0000000000801f68 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+  801f6c:	41 55                	push   %r13
+  801f6e:	41 54                	push   %r12
+  801f70:	53                   	push   %rbx
+  801f71:	48 83 ec 18          	sub    $0x18,%rsp
+  801f75:	89 fb                	mov    %edi,%ebx
+  801f77:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f7e:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  801f85:	00 00 00 
+  801f88:	ff d0                	call   *%rax
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 38                	js     801fc6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f8e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f92:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f96:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f9a:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801fa1:	00 00 00 
+  801fa4:	ff d0                	call   *%rax
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	78 1c                	js     801fc6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801faa:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801faf:	74 20                	je     801fd1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fb5:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801fb9:	48 85 c0             	test   %rax,%rax
+  801fbc:	74 47                	je     802005 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fbe:	44 89 e6             	mov    %r12d,%esi
+  801fc1:	4c 89 ef             	mov    %r13,%rdi
+  801fc4:	ff d0                	call   *%rax
+}
+  801fc6:	48 83 c4 18          	add    $0x18,%rsp
+  801fca:	5b                   	pop    %rbx
+  801fcb:	41 5c                	pop    %r12
+  801fcd:	41 5d                	pop    %r13
+  801fcf:	5d                   	pop    %rbp
+  801fd0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801fd1:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  801fd8:	00 00 00 
+  801fdb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fe1:	89 da                	mov    %ebx,%edx
+  801fe3:	48 bf 58 41 80 00 00 	movabs $0x804158,%rdi
+  801fea:	00 00 00 
+  801fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff2:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801ff9:	00 00 00 
+  801ffc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ffe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802003:	eb c1                	jmp    801fc6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802005:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80200a:	eb ba                	jmp    801fc6 <ftruncate+0x5e>
+
+000000000080200c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+  802010:	41 54                	push   %r12
+  802012:	53                   	push   %rbx
+  802013:	48 83 ec 10          	sub    $0x10,%rsp
+  802017:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80201a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80201e:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	78 4e                	js     80207c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80202e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802032:	41 8b 3c 24          	mov    (%r12),%edi
+  802036:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80203a:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 32                	js     80207c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80204a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80204e:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802053:	74 30                	je     802085 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802055:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802058:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80205f:	00 00 00 
+    stat->st_isdir = 0;
+  802062:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802069:	00 00 00 
+    stat->st_dev = dev;
+  80206c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802073:	48 89 de             	mov    %rbx,%rsi
+  802076:	4c 89 e7             	mov    %r12,%rdi
+  802079:	ff 50 30             	call   *0x30(%rax)
+}
+  80207c:	48 83 c4 10          	add    $0x10,%rsp
+  802080:	5b                   	pop    %rbx
+  802081:	41 5c                	pop    %r12
+  802083:	5d                   	pop    %rbp
+  802084:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802085:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80208a:	eb f0                	jmp    80207c <fstat+0x70>
+
+000000000080208c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80208c:	55                   	push   %rbp
+  80208d:	48 89 e5             	mov    %rsp,%rbp
+  802090:	41 54                	push   %r12
+  802092:	53                   	push   %rbx
+  802093:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802096:	be 00 00 00 00       	mov    $0x0,%esi
+  80209b:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020a9:	85 c0                	test   %eax,%eax
+  8020ab:	78 25                	js     8020d2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020ad:	4c 89 e6             	mov    %r12,%rsi
+  8020b0:	89 c7                	mov    %eax,%edi
+  8020b2:	48 b8 0c 20 80 00 00 	movabs $0x80200c,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+  8020be:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020c1:	89 df                	mov    %ebx,%edi
+  8020c3:	48 b8 06 1b 80 00 00 	movabs $0x801b06,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+
+    return res;
+  8020cf:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020d2:	89 d8                	mov    %ebx,%eax
+  8020d4:	5b                   	pop    %rbx
+  8020d5:	41 5c                	pop    %r12
+  8020d7:	5d                   	pop    %rbp
+  8020d8:	c3                   	ret
+
+00000000008020d9 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	41 54                	push   %r12
+  8020df:	53                   	push   %rbx
+  8020e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e4:	48 89 fb             	mov    %rdi,%rbx
+  8020e7:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ea:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020ee:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020f3:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8020fa:	00 00 00 
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 1f                	js     802122 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802107:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80210b:	48 85 c0             	test   %rax,%rax
+  80210e:	74 1b                	je     80212b <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802110:	4c 89 e6             	mov    %r12,%rsi
+  802113:	48 89 df             	mov    %rbx,%rdi
+  802116:	ff d0                	call   *%rax
+    if (res < 0) {
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802122:	48 83 c4 10          	add    $0x10,%rsp
+  802126:	5b                   	pop    %rbx
+  802127:	41 5c                	pop    %r12
+  802129:	5d                   	pop    %rbp
+  80212a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80212b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802130:	eb f0                	jmp    802122 <create_snapshot+0x49>
+
+0000000000802132 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802132:	55                   	push   %rbp
+  802133:	48 89 e5             	mov    %rsp,%rbp
+  802136:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80213a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80213e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802143:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+  80214f:	85 c0                	test   %eax,%eax
+  802151:	78 1e                	js     802171 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802153:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802157:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80215b:	48 85 d2             	test   %rdx,%rdx
+  80215e:	74 13                	je     802173 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802160:	b8 00 00 00 00       	mov    $0x0,%eax
+  802165:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802167:	85 c0                	test   %eax,%eax
+  802169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+        return -E_NOT_SUPP;
+  802173:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802178:	eb f7                	jmp    802171 <print_snapshot_list+0x3f>
+
+000000000080217a <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80217a:	55                   	push   %rbp
+  80217b:	48 89 e5             	mov    %rsp,%rbp
+  80217e:	53                   	push   %rbx
+  80217f:	48 83 ec 18          	sub    $0x18,%rsp
+  802183:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802186:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80218a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80218f:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 1c                	js     8021bb <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80219f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a3:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8021a7:	48 85 c0             	test   %rax,%rax
+  8021aa:	74 15                	je     8021c1 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8021ac:	48 89 df             	mov    %rbx,%rdi
+  8021af:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b8:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021bf:	c9                   	leave
+  8021c0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c6:	eb f3                	jmp    8021bb <accept_snapshot+0x41>
+
+00000000008021c8 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8021c8:	55                   	push   %rbp
+  8021c9:	48 89 e5             	mov    %rsp,%rbp
+  8021cc:	53                   	push   %rbx
+  8021cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8021d1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021d4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021d8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021dd:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 1c                	js     802209 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8021ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021f1:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8021f5:	48 85 c0             	test   %rax,%rax
+  8021f8:	74 15                	je     80220f <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8021fa:	48 89 df             	mov    %rbx,%rdi
+  8021fd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021ff:	85 c0                	test   %eax,%eax
+  802201:	ba 00 00 00 00       	mov    $0x0,%edx
+  802206:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802209:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80220d:	c9                   	leave
+  80220e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80220f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802214:	eb f3                	jmp    802209 <delete_snapshot+0x41>
+
+0000000000802216 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80221e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802222:	bf 66 00 00 00       	mov    $0x66,%edi
+  802227:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 14                	js     80224b <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802237:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80223b:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80223f:	48 85 d2             	test   %rdx,%rdx
+  802242:	74 09                	je     80224d <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802244:	b8 00 00 00 00       	mov    $0x0,%eax
+  802249:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80224d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802252:	eb f7                	jmp    80224b <gc_snapshots+0x35>
+
+0000000000802254 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	41 56                	push   %r14
+  80225a:	41 55                	push   %r13
+  80225c:	41 54                	push   %r12
+  80225e:	53                   	push   %rbx
+  80225f:	48 83 ec 10          	sub    $0x10,%rsp
+  802263:	48 89 fb             	mov    %rdi,%rbx
+  802266:	49 89 f4             	mov    %rsi,%r12
+  802269:	49 89 d5             	mov    %rdx,%r13
+  80226c:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80226f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802273:	bf 66 00 00 00       	mov    $0x66,%edi
+  802278:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80227f:	00 00 00 
+  802282:	ff d0                	call   *%rax
+  802284:	85 c0                	test   %eax,%eax
+  802286:	78 1b                	js     8022a3 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802288:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80228c:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802290:	48 85 c0             	test   %rax,%rax
+  802293:	74 1b                	je     8022b0 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802295:	4c 89 f1             	mov    %r14,%rcx
+  802298:	4c 89 ea             	mov    %r13,%rdx
+  80229b:	4c 89 e6             	mov    %r12,%rsi
+  80229e:	48 89 df             	mov    %rbx,%rdi
+  8022a1:	ff d0                	call   *%rax
+
+    return res;
+}
+  8022a3:	48 83 c4 10          	add    $0x10,%rsp
+  8022a7:	5b                   	pop    %rbx
+  8022a8:	41 5c                	pop    %r12
+  8022aa:	41 5d                	pop    %r13
+  8022ac:	41 5e                	pop    %r14
+  8022ae:	5d                   	pop    %rbp
+  8022af:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022b0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022b5:	eb ec                	jmp    8022a3 <diff_snapshots+0x4f>
+
+00000000008022b7 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8022b7:	55                   	push   %rbp
+  8022b8:	48 89 e5             	mov    %rsp,%rbp
+  8022bb:	41 55                	push   %r13
+  8022bd:	41 54                	push   %r12
+  8022bf:	53                   	push   %rbx
+  8022c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c4:	48 89 fb             	mov    %rdi,%rbx
+  8022c7:	49 89 f4             	mov    %rsi,%r12
+  8022ca:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022cd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022d1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022d6:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8022dd:	00 00 00 
+  8022e0:	ff d0                	call   *%rax
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 18                	js     8022fe <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8022e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022ea:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8022ee:	48 85 c0             	test   %rax,%rax
+  8022f1:	74 16                	je     802309 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8022f3:	4c 89 ea             	mov    %r13,%rdx
+  8022f6:	4c 89 e6             	mov    %r12,%rsi
+  8022f9:	48 89 df             	mov    %rbx,%rdi
+  8022fc:	ff d0                	call   *%rax
+
+    return res;
+}
+  8022fe:	48 83 c4 18          	add    $0x18,%rsp
+  802302:	5b                   	pop    %rbx
+  802303:	41 5c                	pop    %r12
+  802305:	41 5d                	pop    %r13
+  802307:	5d                   	pop    %rbp
+  802308:	c3                   	ret
+        return -E_NOT_SUPP;
+  802309:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80230e:	eb ee                	jmp    8022fe <send_snapshot+0x47>
+
+0000000000802310 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802310:	55                   	push   %rbp
+  802311:	48 89 e5             	mov    %rsp,%rbp
+  802314:	53                   	push   %rbx
+  802315:	48 83 ec 18          	sub    $0x18,%rsp
+  802319:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80231c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802320:	bf 66 00 00 00       	mov    $0x66,%edi
+  802325:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 12                	js     802347 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802335:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802339:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80233d:	48 85 c0             	test   %rax,%rax
+  802340:	74 0b                	je     80234d <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802342:	48 89 df             	mov    %rbx,%rdi
+  802345:	ff d0                	call   *%rax
+
+    return res;
+}
+  802347:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80234d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802352:	eb f3                	jmp    802347 <receive_snapshot+0x37>
+
+0000000000802354 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80235c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802360:	bf 66 00 00 00       	mov    $0x66,%edi
+  802365:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80236c:	00 00 00 
+  80236f:	ff d0                	call   *%rax
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 17                	js     80238c <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802375:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802379:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802380:	48 85 d2             	test   %rdx,%rdx
+  802383:	74 09                	je     80238e <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80238c:	c9                   	leave
+  80238d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80238e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802393:	eb f7                	jmp    80238c <free_space_bytes+0x38>
+
+0000000000802395 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80239d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023a1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023a6:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 17                	js     8023cd <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8023b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ba:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8023c1:	48 85 d2             	test   %rdx,%rdx
+  8023c4:	74 09                	je     8023cf <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8023c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cb:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8023cd:	c9                   	leave
+  8023ce:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023cf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023d4:	eb f7                	jmp    8023cd <busy_space_bytes+0x38>
+
+00000000008023d6 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8023d6:	55                   	push   %rbp
+  8023d7:	48 89 e5             	mov    %rsp,%rbp
+  8023da:	41 54                	push   %r12
+  8023dc:	53                   	push   %rbx
+  8023dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e1:	89 fb                	mov    %edi,%ebx
+  8023e3:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023e6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ea:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023ef:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8023f6:	00 00 00 
+  8023f9:	ff d0                	call   *%rax
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 17                	js     802416 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8023ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802403:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80240a:	48 85 c0             	test   %rax,%rax
+  80240d:	74 10                	je     80241f <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80240f:	4c 89 e6             	mov    %r12,%rsi
+  802412:	89 df                	mov    %ebx,%edi
+  802414:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802416:	48 83 c4 10          	add    $0x10,%rsp
+  80241a:	5b                   	pop    %rbx
+  80241b:	41 5c                	pop    %r12
+  80241d:	5d                   	pop    %rbp
+  80241e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80241f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802424:	eb f0                	jmp    802416 <snapshots_space+0x40>
+
+0000000000802426 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802426:	55                   	push   %rbp
+  802427:	48 89 e5             	mov    %rsp,%rbp
+  80242a:	41 55                	push   %r13
+  80242c:	41 54                	push   %r12
+  80242e:	53                   	push   %rbx
+  80242f:	48 83 ec 08          	sub    $0x8,%rsp
+  802433:	41 89 fd             	mov    %edi,%r13d
+  802436:	48 89 f3             	mov    %rsi,%rbx
+  802439:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80243c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802443:	00 00 00 
+  802446:	83 38 00             	cmpl   $0x0,(%rax)
+  802449:	74 57                	je     8024a2 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80244b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802451:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802456:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80245d:	00 00 00 
+  802460:	44 89 ee             	mov    %r13d,%esi
+  802463:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80246a:	00 00 00 
+  80246d:	8b 38                	mov    (%rax),%edi
+  80246f:	48 b8 46 39 80 00 00 	movabs $0x803946,%rax
+  802476:	00 00 00 
+  802479:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80247b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802480:	4c 89 e2             	mov    %r12,%rdx
+  802483:	48 89 de             	mov    %rbx,%rsi
+  802486:	bf 00 00 00 00       	mov    $0x0,%edi
+  80248b:	48 b8 2e 39 80 00 00 	movabs $0x80392e,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+}
+  802497:	48 83 c4 08          	add    $0x8,%rsp
+  80249b:	5b                   	pop    %rbx
+  80249c:	41 5c                	pop    %r12
+  80249e:	41 5d                	pop    %r13
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024a2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024a7:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8024ba:	00 00 
+  8024bc:	eb 8d                	jmp    80244b <fsipc_region+0x25>
+
+00000000008024be <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8024be:	55                   	push   %rbp
+  8024bf:	48 89 e5             	mov    %rsp,%rbp
+  8024c2:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8024c6:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8024cd:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8024ce:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8024d2:	48 b8 26 24 80 00 00 	movabs $0x802426,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+}
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+00000000008024e0 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8024e0:	85 ff                	test   %edi,%edi
+  8024e2:	78 6d                	js     802551 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+  8024e8:	41 54                	push   %r12
+  8024ea:	53                   	push   %rbx
+  8024eb:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8024ee:	48 85 f6             	test   %rsi,%rsi
+  8024f1:	74 57                	je     80254a <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8024f3:	89 f8                	mov    %edi,%eax
+  8024f5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8024fc:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8024fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802503:	bf 12 00 00 00       	mov    $0x12,%edi
+  802508:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802514:	85 c0                	test   %eax,%eax
+  802516:	78 2d                	js     802545 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802518:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80251f:	00 00 00 
+  802522:	49 63 14 24          	movslq (%r12),%rdx
+  802526:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80252d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802532:	48 89 df             	mov    %rbx,%rdi
+  802535:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  80253c:	00 00 00 
+  80253f:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802541:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802545:	5b                   	pop    %rbx
+  802546:	41 5c                	pop    %r12
+  802548:	5d                   	pop    %rbp
+  802549:	c3                   	ret
+        return -E_INVAL;
+  80254a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254f:	eb f4                	jmp    802545 <devfile_df_snapshots+0x65>
+  802551:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802556:	c3                   	ret
+
+0000000000802557 <devfile_df_busy>:
+devfile_df_busy() {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80255b:	be 00 00 00 00       	mov    $0x0,%esi
+  802560:	bf 11 00 00 00       	mov    $0x11,%edi
+  802565:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+}
+  802571:	5d                   	pop    %rbp
+  802572:	c3                   	ret
+
+0000000000802573 <devfile_df_free>:
+devfile_df_free() {
+  802573:	55                   	push   %rbp
+  802574:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802577:	be 00 00 00 00       	mov    $0x0,%esi
+  80257c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802581:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+}
+  80258d:	5d                   	pop    %rbp
+  80258e:	c3                   	ret
+
+000000000080258f <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802593:	be 00 00 00 00       	mov    $0x0,%esi
+  802598:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80259d:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8025a4:	00 00 00 
+  8025a7:	ff d0                	call   *%rax
+}
+  8025a9:	5d                   	pop    %rbp
+  8025aa:	c3                   	ret
+
+00000000008025ab <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8025af:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8025b9:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cc:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8025cf:	5d                   	pop    %rbp
+  8025d0:	c3                   	ret
+
+00000000008025d1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8025d5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8025dc:	00 00 00 
+  8025df:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8025e2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8025e4:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8025e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ec:	bf 02 00 00 00       	mov    $0x2,%edi
+  8025f1:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8025f8:	00 00 00 
+  8025fb:	ff d0                	call   *%rax
+}
+  8025fd:	5d                   	pop    %rbp
+  8025fe:	c3                   	ret
+
+00000000008025ff <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8025ff:	55                   	push   %rbp
+  802600:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802603:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802606:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80260d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80260f:	be 00 00 00 00       	mov    $0x0,%esi
+  802614:	bf 06 00 00 00       	mov    $0x6,%edi
+  802619:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802620:	00 00 00 
+  802623:	ff d0                	call   *%rax
+}
+  802625:	5d                   	pop    %rbp
+  802626:	c3                   	ret
+
+0000000000802627 <devfile_write>:
+    if (!fd || !buf) {
+  802627:	48 85 ff             	test   %rdi,%rdi
+  80262a:	0f 84 c1 00 00 00    	je     8026f1 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+  802634:	41 57                	push   %r15
+  802636:	41 56                	push   %r14
+  802638:	41 55                	push   %r13
+  80263a:	41 54                	push   %r12
+  80263c:	53                   	push   %rbx
+  80263d:	48 83 ec 18          	sub    $0x18,%rsp
+  802641:	49 89 ff             	mov    %rdi,%r15
+  802644:	49 89 f5             	mov    %rsi,%r13
+  802647:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80264a:	48 85 f6             	test   %rsi,%rsi
+  80264d:	0f 84 95 00 00 00    	je     8026e8 <devfile_write+0xc1>
+    while (n) {
+  802653:	48 85 d2             	test   %rdx,%rdx
+  802656:	0f 84 83 00 00 00    	je     8026df <devfile_write+0xb8>
+    int totalWrite = 0;
+  80265c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802663:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80266a:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80266d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802672:	49 39 dc             	cmp    %rbx,%r12
+  802675:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802679:	48 89 da             	mov    %rbx,%rdx
+  80267c:	4c 89 ee             	mov    %r13,%rsi
+  80267f:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802686:	00 00 00 
+  802689:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802695:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802699:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80269c:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8026a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026aa:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+        if (write < 0) {
+  8026b6:	85 c0                	test   %eax,%eax
+  8026b8:	78 21                	js     8026db <devfile_write+0xb4>
+        buf += write;
+  8026ba:	48 63 d0             	movslq %eax,%rdx
+  8026bd:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8026c0:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8026c3:	49 29 d4             	sub    %rdx,%r12
+  8026c6:	75 a5                	jne    80266d <devfile_write+0x46>
+    return totalWrite;
+  8026c8:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8026cc:	48 83 c4 18          	add    $0x18,%rsp
+  8026d0:	5b                   	pop    %rbx
+  8026d1:	41 5c                	pop    %r12
+  8026d3:	41 5d                	pop    %r13
+  8026d5:	41 5e                	pop    %r14
+  8026d7:	41 5f                	pop    %r15
+  8026d9:	5d                   	pop    %rbp
+  8026da:	c3                   	ret
+            return write;
+  8026db:	48 98                	cltq
+  8026dd:	eb ed                	jmp    8026cc <devfile_write+0xa5>
+    int totalWrite = 0;
+  8026df:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8026e6:	eb e0                	jmp    8026c8 <devfile_write+0xa1>
+        return -E_INVAL;
+  8026e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026ef:	eb db                	jmp    8026cc <devfile_write+0xa5>
+  8026f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026f8:	c3                   	ret
+
+00000000008026f9 <devfile_read>:
+    if (!fd || !buf) {
+  8026f9:	48 85 ff             	test   %rdi,%rdi
+  8026fc:	0f 84 c0 00 00 00    	je     8027c2 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802702:	55                   	push   %rbp
+  802703:	48 89 e5             	mov    %rsp,%rbp
+  802706:	41 57                	push   %r15
+  802708:	41 56                	push   %r14
+  80270a:	41 55                	push   %r13
+  80270c:	41 54                	push   %r12
+  80270e:	53                   	push   %rbx
+  80270f:	48 83 ec 18          	sub    $0x18,%rsp
+  802713:	49 89 ff             	mov    %rdi,%r15
+  802716:	49 89 f5             	mov    %rsi,%r13
+  802719:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80271c:	48 85 f6             	test   %rsi,%rsi
+  80271f:	0f 84 96 00 00 00    	je     8027bb <devfile_read+0xc2>
+    while (n) {
+  802725:	48 85 d2             	test   %rdx,%rdx
+  802728:	0f 84 87 00 00 00    	je     8027b5 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80272e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802735:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802736:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80273d:	00 00 00 
+  802740:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802744:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802747:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80274c:	49 39 c4             	cmp    %rax,%r12
+  80274f:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802753:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802757:	be 00 00 00 00       	mov    $0x0,%esi
+  80275c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802761:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	7e 37                	jle    8027a8 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802771:	48 63 d8             	movslq %eax,%rbx
+  802774:	48 89 da             	mov    %rbx,%rdx
+  802777:	4c 89 f6             	mov    %r14,%rsi
+  80277a:	4c 89 ef             	mov    %r13,%rdi
+  80277d:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+        buf += read;
+  802789:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80278c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802790:	49 29 dc             	sub    %rbx,%r12
+  802793:	75 ab                	jne    802740 <devfile_read+0x47>
+  return totalRead;
+  802795:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802799:	48 83 c4 18          	add    $0x18,%rsp
+  80279d:	5b                   	pop    %rbx
+  80279e:	41 5c                	pop    %r12
+  8027a0:	41 5d                	pop    %r13
+  8027a2:	41 5e                	pop    %r14
+  8027a4:	41 5f                	pop    %r15
+  8027a6:	5d                   	pop    %rbp
+  8027a7:	c3                   	ret
+            return read ? read : totalRead;
+  8027a8:	48 63 d0             	movslq %eax,%rdx
+  8027ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027af:	48 0f 45 c2          	cmovne %rdx,%rax
+  8027b3:	eb e4                	jmp    802799 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8027b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027b9:	eb da                	jmp    802795 <devfile_read+0x9c>
+        return E_INVAL;
+  8027bb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027c0:	eb d7                	jmp    802799 <devfile_read+0xa0>
+  8027c2:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8027c7:	c3                   	ret
+
+00000000008027c8 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8027c8:	48 85 ff             	test   %rdi,%rdi
+  8027cb:	74 5f                	je     80282c <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8027cd:	55                   	push   %rbp
+  8027ce:	48 89 e5             	mov    %rsp,%rbp
+  8027d1:	53                   	push   %rbx
+  8027d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d6:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8027d9:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  8027e0:	00 00 00 
+  8027e3:	ff d0                	call   *%rax
+  8027e5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027eb:	77 45                	ja     802832 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8027ed:	48 89 de             	mov    %rbx,%rsi
+  8027f0:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8027f7:	00 00 00 
+  8027fa:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802801:	00 00 00 
+  802804:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802806:	be 00 00 00 00       	mov    $0x0,%esi
+  80280b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802810:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802817:	00 00 00 
+  80281a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80281c:	85 c0                	test   %eax,%eax
+  80281e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802823:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802826:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282a:	c9                   	leave
+  80282b:	c3                   	ret
+        return -E_INVAL;
+  80282c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802831:	c3                   	ret
+        return -E_INVAL;
+  802832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802837:	eb ed                	jmp    802826 <devfile_receive_snapshot+0x5e>
+
+0000000000802839 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802839:	55                   	push   %rbp
+  80283a:	48 89 e5             	mov    %rsp,%rbp
+  80283d:	41 55                	push   %r13
+  80283f:	41 54                	push   %r12
+  802841:	53                   	push   %rbx
+  802842:	48 83 ec 08          	sub    $0x8,%rsp
+  802846:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802849:	48 85 f6             	test   %rsi,%rsi
+  80284c:	0f 94 c0             	sete   %al
+  80284f:	48 85 d2             	test   %rdx,%rdx
+  802852:	0f 94 c2             	sete   %dl
+  802855:	08 d0                	or     %dl,%al
+  802857:	0f 85 ad 00 00 00    	jne    80290a <devfile_send_snapshot+0xd1>
+  80285d:	48 89 fb             	mov    %rdi,%rbx
+  802860:	49 89 f4             	mov    %rsi,%r12
+  802863:	48 85 ff             	test   %rdi,%rdi
+  802866:	0f 84 9e 00 00 00    	je     80290a <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80286c:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+  802878:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80287e:	0f 87 8d 00 00 00    	ja     802911 <devfile_send_snapshot+0xd8>
+  802884:	4c 89 e7             	mov    %r12,%rdi
+  802887:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  80288e:	00 00 00 
+  802891:	ff d0                	call   *%rax
+  802893:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802899:	77 7d                	ja     802918 <devfile_send_snapshot+0xdf>
+  80289b:	4c 89 ef             	mov    %r13,%rdi
+  80289e:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+  8028aa:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028b0:	77 6d                	ja     80291f <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8028b2:	48 89 de             	mov    %rbx,%rsi
+  8028b5:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8028bc:	00 00 00 
+  8028bf:	48 bb 3d 0d 80 00 00 	movabs $0x800d3d,%rbx
+  8028c6:	00 00 00 
+  8028c9:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8028cb:	4c 89 e6             	mov    %r12,%rsi
+  8028ce:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8028d5:	00 00 00 
+  8028d8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8028da:	4c 89 ee             	mov    %r13,%rsi
+  8028dd:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8028e4:	00 00 00 
+  8028e7:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8028e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ee:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8028f3:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+}
+  8028ff:	48 83 c4 08          	add    $0x8,%rsp
+  802903:	5b                   	pop    %rbx
+  802904:	41 5c                	pop    %r12
+  802906:	41 5d                	pop    %r13
+  802908:	5d                   	pop    %rbp
+  802909:	c3                   	ret
+        return -E_INVAL;
+  80290a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80290f:	eb ee                	jmp    8028ff <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802911:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802916:	eb e7                	jmp    8028ff <devfile_send_snapshot+0xc6>
+  802918:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80291d:	eb e0                	jmp    8028ff <devfile_send_snapshot+0xc6>
+  80291f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802924:	eb d9                	jmp    8028ff <devfile_send_snapshot+0xc6>
+
+0000000000802926 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802926:	48 85 ff             	test   %rdi,%rdi
+  802929:	0f 84 41 01 00 00    	je     802a70 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80292f:	55                   	push   %rbp
+  802930:	48 89 e5             	mov    %rsp,%rbp
+  802933:	41 57                	push   %r15
+  802935:	41 56                	push   %r14
+  802937:	41 55                	push   %r13
+  802939:	41 54                	push   %r12
+  80293b:	53                   	push   %rbx
+  80293c:	48 83 ec 08          	sub    $0x8,%rsp
+  802940:	49 89 fc             	mov    %rdi,%r12
+  802943:	49 89 f5             	mov    %rsi,%r13
+  802946:	48 89 d3             	mov    %rdx,%rbx
+  802949:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80294c:	48 85 f6             	test   %rsi,%rsi
+  80294f:	0f 84 ff 00 00 00    	je     802a54 <devfile_diff_snapshots+0x12e>
+  802955:	48 85 d2             	test   %rdx,%rdx
+  802958:	0f 84 fd 00 00 00    	je     802a5b <devfile_diff_snapshots+0x135>
+  80295e:	48 85 c9             	test   %rcx,%rcx
+  802961:	0f 84 f4 00 00 00    	je     802a5b <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802967:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+  802973:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802979:	0f 87 e3 00 00 00    	ja     802a62 <devfile_diff_snapshots+0x13c>
+  80297f:	4c 89 ef             	mov    %r13,%rdi
+  802982:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+  80298e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802994:	0f 87 cf 00 00 00    	ja     802a69 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80299a:	4c 89 e6             	mov    %r12,%rsi
+  80299d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8029a4:	00 00 00 
+  8029a7:	4c 89 e7             	mov    %r12,%rdi
+  8029aa:	49 bf 3d 0d 80 00 00 	movabs $0x800d3d,%r15
+  8029b1:	00 00 00 
+  8029b4:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8029b7:	4c 89 ee             	mov    %r13,%rsi
+  8029ba:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8029c1:	00 
+  8029c2:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8029c5:	48 8b 03             	mov    (%rbx),%rax
+  8029c8:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8029cf:	00 
+  8029d0:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8029d4:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8029db:	00 
+  8029dc:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8029e0:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8029e7:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8029e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ed:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8029f2:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 43                	js     802a45 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a02:	49 8b 04 24          	mov    (%r12),%rax
+  802a06:	48 89 03             	mov    %rax,(%rbx)
+  802a09:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a0e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a12:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802a17:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802a1b:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802a20:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802a24:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802a28:	48 c1 e2 03          	shl    $0x3,%rdx
+  802a2c:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802a31:	4c 89 f7             	mov    %r14,%rdi
+  802a34:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802a40:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802a45:	48 83 c4 08          	add    $0x8,%rsp
+  802a49:	5b                   	pop    %rbx
+  802a4a:	41 5c                	pop    %r12
+  802a4c:	41 5d                	pop    %r13
+  802a4e:	41 5e                	pop    %r14
+  802a50:	41 5f                	pop    %r15
+  802a52:	5d                   	pop    %rbp
+  802a53:	c3                   	ret
+        return -E_INVAL;
+  802a54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a59:	eb ea                	jmp    802a45 <devfile_diff_snapshots+0x11f>
+  802a5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a60:	eb e3                	jmp    802a45 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802a62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a67:	eb dc                	jmp    802a45 <devfile_diff_snapshots+0x11f>
+  802a69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6e:	eb d5                	jmp    802a45 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802a70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a75:	c3                   	ret
+
+0000000000802a76 <devfile_delete_snapshot>:
+    if (!name) {
+  802a76:	48 85 ff             	test   %rdi,%rdi
+  802a79:	74 5f                	je     802ada <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+  802a7f:	53                   	push   %rbx
+  802a80:	48 83 ec 08          	sub    $0x8,%rsp
+  802a84:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802a87:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+  802a93:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a99:	77 45                	ja     802ae0 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802a9b:	48 89 de             	mov    %rbx,%rsi
+  802a9e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802aa5:	00 00 00 
+  802aa8:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802abe:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ad4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+        return -E_INVAL;
+  802ada:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802adf:	c3                   	ret
+        return -E_INVAL;
+  802ae0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae5:	eb ed                	jmp    802ad4 <devfile_delete_snapshot+0x5e>
+
+0000000000802ae7 <devfile_accept_snapshot>:
+    if (!name) {
+  802ae7:	48 85 ff             	test   %rdi,%rdi
+  802aea:	74 5f                	je     802b4b <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802aec:	55                   	push   %rbp
+  802aed:	48 89 e5             	mov    %rsp,%rbp
+  802af0:	53                   	push   %rbx
+  802af1:	48 83 ec 08          	sub    $0x8,%rsp
+  802af5:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802af8:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  802b04:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b0a:	77 45                	ja     802b51 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b0c:	48 89 de             	mov    %rbx,%rsi
+  802b0f:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b16:	00 00 00 
+  802b19:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802b25:	be 00 00 00 00       	mov    $0x0,%esi
+  802b2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b2f:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b42:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+        return -E_INVAL;
+  802b4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b50:	c3                   	ret
+        return -E_INVAL;
+  802b51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b56:	eb ed                	jmp    802b45 <devfile_accept_snapshot+0x5e>
+
+0000000000802b58 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802b58:	48 85 ff             	test   %rdi,%rdi
+  802b5b:	0f 84 9f 00 00 00    	je     802c00 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802b61:	55                   	push   %rbp
+  802b62:	48 89 e5             	mov    %rsp,%rbp
+  802b65:	41 54                	push   %r12
+  802b67:	53                   	push   %rbx
+  802b68:	48 89 fb             	mov    %rdi,%rbx
+  802b6b:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802b6e:	48 85 f6             	test   %rsi,%rsi
+  802b71:	74 78                	je     802beb <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802b73:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802b7a:	00 00 00 
+  802b7d:	ff d0                	call   *%rax
+  802b7f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b85:	77 6b                	ja     802bf2 <devfile_create_snapshot+0x9a>
+  802b87:	4c 89 e7             	mov    %r12,%rdi
+  802b8a:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+  802b96:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b9c:	77 5b                	ja     802bf9 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802b9e:	48 89 de             	mov    %rbx,%rsi
+  802ba1:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ba8:	00 00 00 
+  802bab:	48 bb 3d 0d 80 00 00 	movabs $0x800d3d,%rbx
+  802bb2:	00 00 00 
+  802bb5:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802bb7:	4c 89 e6             	mov    %r12,%rsi
+  802bba:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802bc1:	00 00 00 
+  802bc4:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802bc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bcb:	bf 08 00 00 00       	mov    $0x8,%edi
+  802bd0:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802be6:	5b                   	pop    %rbx
+  802be7:	41 5c                	pop    %r12
+  802be9:	5d                   	pop    %rbp
+  802bea:	c3                   	ret
+        return -E_INVAL;
+  802beb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf0:	eb f4                	jmp    802be6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802bf2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf7:	eb ed                	jmp    802be6 <devfile_create_snapshot+0x8e>
+  802bf9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bfe:	eb e6                	jmp    802be6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c05:	c3                   	ret
+
+0000000000802c06 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c06:	55                   	push   %rbp
+  802c07:	48 89 e5             	mov    %rsp,%rbp
+  802c0a:	41 54                	push   %r12
+  802c0c:	53                   	push   %rbx
+  802c0d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c10:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c13:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c1a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c21:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c26:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802c2d:	00 00 00 
+  802c30:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c32:	85 c0                	test   %eax,%eax
+  802c34:	78 3d                	js     802c73 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c36:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c3d:	00 00 00 
+  802c40:	4c 89 e6             	mov    %r12,%rsi
+  802c43:	48 89 df             	mov    %rbx,%rdi
+  802c46:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c52:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c59:	00 
+  802c5a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c60:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c67:	00 
+  802c68:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c73:	5b                   	pop    %rbx
+  802c74:	41 5c                	pop    %r12
+  802c76:	5d                   	pop    %rbp
+  802c77:	c3                   	ret
+
+0000000000802c78 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802c78:	55                   	push   %rbp
+  802c79:	48 89 e5             	mov    %rsp,%rbp
+  802c7c:	41 57                	push   %r15
+  802c7e:	41 56                	push   %r14
+  802c80:	41 55                	push   %r13
+  802c82:	41 54                	push   %r12
+  802c84:	53                   	push   %rbx
+  802c85:	48 83 ec 38          	sub    $0x38,%rsp
+  802c89:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802c8d:	49 89 f5             	mov    %rsi,%r13
+  802c90:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c93:	48 89 f0             	mov    %rsi,%rax
+  802c96:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c9b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802c9f:	75 4f                	jne    802cf0 <devfile_readmap+0x78>
+  802ca1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ca5:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cab:	75 1f                	jne    802ccc <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802cad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cb1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cb5:	49 be 60 34 80 00 00 	movabs $0x803460,%r14
+  802cbc:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802cbf:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802cc6:	0f 87 9d 00 00 00    	ja     802d69 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ccc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cd0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802cd4:	4d 85 ff             	test   %r15,%r15
+  802cd7:	0f 85 cf 00 00 00    	jne    802dac <devfile_readmap+0x134>
+  802cdd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802ce1:	48 83 c4 38          	add    $0x38,%rsp
+  802ce5:	5b                   	pop    %rbx
+  802ce6:	41 5c                	pop    %r12
+  802ce8:	41 5d                	pop    %r13
+  802cea:	41 5e                	pop    %r14
+  802cec:	41 5f                	pop    %r15
+  802cee:	5d                   	pop    %rbp
+  802cef:	c3                   	ret
+    size_t totalRead = 0;
+  802cf0:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802cf7:	00 
+  802cf8:	eb da                	jmp    802cd4 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cfa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802cfe:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d01:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d08:	00 00 00 
+  802d0b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d11:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802d15:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d19:	4c 89 ee             	mov    %r13,%rsi
+  802d1c:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d21:	48 b8 26 24 80 00 00 	movabs $0x802426,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	7e a3                	jle    802cd4 <devfile_readmap+0x5c>
+  802d31:	48 98                	cltq
+  802d33:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802d37:	72 9b                	jb     802cd4 <devfile_readmap+0x5c>
+        buf += read;
+  802d39:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802d3c:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802d3f:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d43:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802d4a:	75 88                	jne    802cd4 <devfile_readmap+0x5c>
+  802d4c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d50:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d56:	0f 85 78 ff ff ff    	jne    802cd4 <devfile_readmap+0x5c>
+  802d5c:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802d63:	0f 86 6b ff ff ff    	jbe    802cd4 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802d69:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802d6f:	4d 39 e7             	cmp    %r12,%r15
+  802d72:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802d76:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802d7d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802d81:	0f 84 73 ff ff ff    	je     802cfa <devfile_readmap+0x82>
+  802d87:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d8b:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802d90:	41 ff d6             	call   *%r14
+  802d93:	a8 40                	test   $0x40,%al
+  802d95:	0f 85 39 ff ff ff    	jne    802cd4 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802d9b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802da2:	4c 39 e3             	cmp    %r12,%rbx
+  802da5:	72 e4                	jb     802d8b <devfile_readmap+0x113>
+  802da7:	e9 4e ff ff ff       	jmp    802cfa <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802dac:	4c 89 fa             	mov    %r15,%rdx
+  802daf:	4c 89 ee             	mov    %r13,%rsi
+  802db2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802db6:	48 b8 f9 26 80 00 00 	movabs $0x8026f9,%rax
+  802dbd:	00 00 00 
+  802dc0:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802dc2:	48 85 c0             	test   %rax,%rax
+  802dc5:	78 0c                	js     802dd3 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802dc7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dcb:	48 01 f0             	add    %rsi,%rax
+  802dce:	e9 0e ff ff ff       	jmp    802ce1 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802dd3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dd7:	48 85 f6             	test   %rsi,%rsi
+  802dda:	48 0f 45 c6          	cmovne %rsi,%rax
+  802dde:	e9 fe fe ff ff       	jmp    802ce1 <devfile_readmap+0x69>
+
+0000000000802de3 <open>:
+open(const char *path, int mode) {
+  802de3:	55                   	push   %rbp
+  802de4:	48 89 e5             	mov    %rsp,%rbp
+  802de7:	41 55                	push   %r13
+  802de9:	41 54                	push   %r12
+  802deb:	53                   	push   %rbx
+  802dec:	48 83 ec 18          	sub    $0x18,%rsp
+  802df0:	49 89 fc             	mov    %rdi,%r12
+  802df3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802df6:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  802dfd:	00 00 00 
+  802e00:	ff d0                	call   *%rax
+  802e02:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e08:	0f 87 8a 00 00 00    	ja     802e98 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e0e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e12:	48 b8 41 19 80 00 00 	movabs $0x801941,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+  802e1e:	89 c3                	mov    %eax,%ebx
+  802e20:	85 c0                	test   %eax,%eax
+  802e22:	78 50                	js     802e74 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e24:	4c 89 e6             	mov    %r12,%rsi
+  802e27:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802e2e:	00 00 00 
+  802e31:	48 89 df             	mov    %rbx,%rdi
+  802e34:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e40:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802e47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e4b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e50:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+  802e5c:	89 c3                	mov    %eax,%ebx
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	78 1f                	js     802e81 <open+0x9e>
+    return fd2num(fd);
+  802e62:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e66:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+  802e72:	89 c3                	mov    %eax,%ebx
+}
+  802e74:	89 d8                	mov    %ebx,%eax
+  802e76:	48 83 c4 18          	add    $0x18,%rsp
+  802e7a:	5b                   	pop    %rbx
+  802e7b:	41 5c                	pop    %r12
+  802e7d:	41 5d                	pop    %r13
+  802e7f:	5d                   	pop    %rbp
+  802e80:	c3                   	ret
+        fd_close(fd, 0);
+  802e81:	be 00 00 00 00       	mov    $0x0,%esi
+  802e86:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e8a:	48 b8 5c 1a 80 00 00 	movabs $0x801a5c,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+        return res;
+  802e96:	eb dc                	jmp    802e74 <open+0x91>
+        return -E_BAD_PATH;
+  802e98:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e9d:	eb d5                	jmp    802e74 <open+0x91>
+
+0000000000802e9f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802e9f:	55                   	push   %rbp
+  802ea0:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802ea3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea8:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ead:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+}
+  802eb9:	5d                   	pop    %rbp
+  802eba:	c3                   	ret
+
+0000000000802ebb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ebb:	55                   	push   %rbp
+  802ebc:	48 89 e5             	mov    %rsp,%rbp
+  802ebf:	41 54                	push   %r12
+  802ec1:	53                   	push   %rbx
+  802ec2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ec5:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  802ecc:	00 00 00 
+  802ecf:	ff d0                	call   *%rax
+  802ed1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ed4:	48 be e0 41 80 00 00 	movabs $0x8041e0,%rsi
+  802edb:	00 00 00 
+  802ede:	48 89 df             	mov    %rbx,%rdi
+  802ee1:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802eed:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802ef2:	41 2b 04 24          	sub    (%r12),%eax
+  802ef6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802efc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f03:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f06:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f0d:	00 00 00 
+  802f10:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1c:	5b                   	pop    %rbx
+  802f1d:	41 5c                	pop    %r12
+  802f1f:	5d                   	pop    %rbp
+  802f20:	c3                   	ret
+
+0000000000802f21 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f21:	55                   	push   %rbp
+  802f22:	48 89 e5             	mov    %rsp,%rbp
+  802f25:	41 54                	push   %r12
+  802f27:	53                   	push   %rbx
+  802f28:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f2b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f30:	48 89 fe             	mov    %rdi,%rsi
+  802f33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f38:	49 bc 95 14 80 00 00 	movabs $0x801495,%r12
+  802f3f:	00 00 00 
+  802f42:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802f45:	48 89 df             	mov    %rbx,%rdi
+  802f48:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	48 89 c6             	mov    %rax,%rsi
+  802f57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f61:	41 ff d4             	call   *%r12
+}
+  802f64:	5b                   	pop    %rbx
+  802f65:	41 5c                	pop    %r12
+  802f67:	5d                   	pop    %rbp
+  802f68:	c3                   	ret
+
+0000000000802f69 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802f69:	55                   	push   %rbp
+  802f6a:	48 89 e5             	mov    %rsp,%rbp
+  802f6d:	41 57                	push   %r15
+  802f6f:	41 56                	push   %r14
+  802f71:	41 55                	push   %r13
+  802f73:	41 54                	push   %r12
+  802f75:	53                   	push   %rbx
+  802f76:	48 83 ec 18          	sub    $0x18,%rsp
+  802f7a:	49 89 fc             	mov    %rdi,%r12
+  802f7d:	49 89 f5             	mov    %rsi,%r13
+  802f80:	49 89 d7             	mov    %rdx,%r15
+  802f83:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f87:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802f93:	4d 85 ff             	test   %r15,%r15
+  802f96:	0f 84 af 00 00 00    	je     80304b <devpipe_write+0xe2>
+  802f9c:	48 89 c3             	mov    %rax,%rbx
+  802f9f:	4c 89 f8             	mov    %r15,%rax
+  802fa2:	4d 89 ef             	mov    %r13,%r15
+  802fa5:	4c 01 e8             	add    %r13,%rax
+  802fa8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fac:	49 bd 9d 13 80 00 00 	movabs $0x80139d,%r13
+  802fb3:	00 00 00 
+            sys_yield();
+  802fb6:	49 be 3a 13 80 00 00 	movabs $0x80133a,%r14
+  802fbd:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fc0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fc3:	48 63 ce             	movslq %esi,%rcx
+  802fc6:	48 63 03             	movslq (%rbx),%rax
+  802fc9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802fcf:	48 39 c1             	cmp    %rax,%rcx
+  802fd2:	72 2e                	jb     803002 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fd4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fd9:	48 89 da             	mov    %rbx,%rdx
+  802fdc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fe1:	4c 89 e7             	mov    %r12,%rdi
+  802fe4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802fe7:	85 c0                	test   %eax,%eax
+  802fe9:	74 66                	je     803051 <devpipe_write+0xe8>
+            sys_yield();
+  802feb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fee:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ff1:	48 63 ce             	movslq %esi,%rcx
+  802ff4:	48 63 03             	movslq (%rbx),%rax
+  802ff7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ffd:	48 39 c1             	cmp    %rax,%rcx
+  803000:	73 d2                	jae    802fd4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803002:	41 0f b6 3f          	movzbl (%r15),%edi
+  803006:	48 89 ca             	mov    %rcx,%rdx
+  803009:	48 c1 ea 03          	shr    $0x3,%rdx
+  80300d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803014:	08 10 20 
+  803017:	48 f7 e2             	mul    %rdx
+  80301a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80301e:	48 89 d0             	mov    %rdx,%rax
+  803021:	48 c1 e0 09          	shl    $0x9,%rax
+  803025:	48 29 d0             	sub    %rdx,%rax
+  803028:	48 c1 e0 03          	shl    $0x3,%rax
+  80302c:	48 29 c1             	sub    %rax,%rcx
+  80302f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803034:	83 c6 01             	add    $0x1,%esi
+  803037:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80303a:	49 83 c7 01          	add    $0x1,%r15
+  80303e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803042:	49 39 c7             	cmp    %rax,%r15
+  803045:	0f 85 75 ff ff ff    	jne    802fc0 <devpipe_write+0x57>
+    return n;
+  80304b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80304f:	eb 05                	jmp    803056 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803056:	48 83 c4 18          	add    $0x18,%rsp
+  80305a:	5b                   	pop    %rbx
+  80305b:	41 5c                	pop    %r12
+  80305d:	41 5d                	pop    %r13
+  80305f:	41 5e                	pop    %r14
+  803061:	41 5f                	pop    %r15
+  803063:	5d                   	pop    %rbp
+  803064:	c3                   	ret
+
+0000000000803065 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803065:	55                   	push   %rbp
+  803066:	48 89 e5             	mov    %rsp,%rbp
+  803069:	41 57                	push   %r15
+  80306b:	41 56                	push   %r14
+  80306d:	41 55                	push   %r13
+  80306f:	41 54                	push   %r12
+  803071:	53                   	push   %rbx
+  803072:	48 83 ec 18          	sub    $0x18,%rsp
+  803076:	49 89 fc             	mov    %rdi,%r12
+  803079:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80307d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803081:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803090:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803096:	49 bd 9d 13 80 00 00 	movabs $0x80139d,%r13
+  80309d:	00 00 00 
+            sys_yield();
+  8030a0:	49 be 3a 13 80 00 00 	movabs $0x80133a,%r14
+  8030a7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8030aa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030af:	74 7d                	je     80312e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030b1:	8b 03                	mov    (%rbx),%eax
+  8030b3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030b6:	75 26                	jne    8030de <devpipe_read+0x79>
+            if (i > 0) return i;
+  8030b8:	4d 85 ff             	test   %r15,%r15
+  8030bb:	75 77                	jne    803134 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030bd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030c2:	48 89 da             	mov    %rbx,%rdx
+  8030c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030ca:	4c 89 e7             	mov    %r12,%rdi
+  8030cd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	74 72                	je     803146 <devpipe_read+0xe1>
+            sys_yield();
+  8030d4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030d7:	8b 03                	mov    (%rbx),%eax
+  8030d9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030dc:	74 df                	je     8030bd <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030de:	48 63 c8             	movslq %eax,%rcx
+  8030e1:	48 89 ca             	mov    %rcx,%rdx
+  8030e4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8030e8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8030ef:	08 10 20 
+  8030f2:	48 89 d0             	mov    %rdx,%rax
+  8030f5:	48 f7 e6             	mul    %rsi
+  8030f8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030fc:	48 89 d0             	mov    %rdx,%rax
+  8030ff:	48 c1 e0 09          	shl    $0x9,%rax
+  803103:	48 29 d0             	sub    %rdx,%rax
+  803106:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80310d:	00 
+  80310e:	48 89 c8             	mov    %rcx,%rax
+  803111:	48 29 d0             	sub    %rdx,%rax
+  803114:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803119:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80311d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803121:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803124:	49 83 c7 01          	add    $0x1,%r15
+  803128:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80312c:	75 83                	jne    8030b1 <devpipe_read+0x4c>
+    return n;
+  80312e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803132:	eb 03                	jmp    803137 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803134:	4c 89 f8             	mov    %r15,%rax
+}
+  803137:	48 83 c4 18          	add    $0x18,%rsp
+  80313b:	5b                   	pop    %rbx
+  80313c:	41 5c                	pop    %r12
+  80313e:	41 5d                	pop    %r13
+  803140:	41 5e                	pop    %r14
+  803142:	41 5f                	pop    %r15
+  803144:	5d                   	pop    %rbp
+  803145:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314b:	eb ea                	jmp    803137 <devpipe_read+0xd2>
+
+000000000080314d <pipe>:
+pipe(int pfd[2]) {
+  80314d:	55                   	push   %rbp
+  80314e:	48 89 e5             	mov    %rsp,%rbp
+  803151:	41 55                	push   %r13
+  803153:	41 54                	push   %r12
+  803155:	53                   	push   %rbx
+  803156:	48 83 ec 18          	sub    $0x18,%rsp
+  80315a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80315d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803161:	48 b8 41 19 80 00 00 	movabs $0x801941,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+  80316d:	89 c3                	mov    %eax,%ebx
+  80316f:	85 c0                	test   %eax,%eax
+  803171:	0f 88 a0 01 00 00    	js     803317 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803177:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80317c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803181:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803185:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318a:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  803191:	00 00 00 
+  803194:	ff d0                	call   *%rax
+  803196:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	0f 88 77 01 00 00    	js     803317 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8031a0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8031a4:	48 b8 41 19 80 00 00 	movabs $0x801941,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	89 c3                	mov    %eax,%ebx
+  8031b2:	85 c0                	test   %eax,%eax
+  8031b4:	0f 88 43 01 00 00    	js     8032fd <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8031ba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8031c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cd:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  8031d4:	00 00 00 
+  8031d7:	ff d0                	call   *%rax
+  8031d9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8031db:	85 c0                	test   %eax,%eax
+  8031dd:	0f 88 1a 01 00 00    	js     8032fd <pipe+0x1b0>
+    va = fd2data(fd0);
+  8031e3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031e7:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8031f6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803200:	48 89 c6             	mov    %rax,%rsi
+  803203:	bf 00 00 00 00       	mov    $0x0,%edi
+  803208:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  80320f:	00 00 00 
+  803212:	ff d0                	call   *%rax
+  803214:	89 c3                	mov    %eax,%ebx
+  803216:	85 c0                	test   %eax,%eax
+  803218:	0f 88 c5 00 00 00    	js     8032e3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80321e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803222:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+  80322e:	48 89 c1             	mov    %rax,%rcx
+  803231:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803237:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80323d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803242:	4c 89 ee             	mov    %r13,%rsi
+  803245:	bf 00 00 00 00       	mov    $0x0,%edi
+  80324a:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+  803256:	89 c3                	mov    %eax,%ebx
+  803258:	85 c0                	test   %eax,%eax
+  80325a:	78 6e                	js     8032ca <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80325c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803261:	4c 89 ef             	mov    %r13,%rdi
+  803264:	48 b8 6b 13 80 00 00 	movabs $0x80136b,%rax
+  80326b:	00 00 00 
+  80326e:	ff d0                	call   *%rax
+  803270:	83 f8 02             	cmp    $0x2,%eax
+  803273:	0f 85 ab 00 00 00    	jne    803324 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803279:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803280:	00 00 
+  803282:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803286:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803288:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80328c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803293:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803297:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803299:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80329d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8032a4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032a8:	48 bb 13 19 80 00 00 	movabs $0x801913,%rbx
+  8032af:	00 00 00 
+  8032b2:	ff d3                	call   *%rbx
+  8032b4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8032b8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032bc:	ff d3                	call   *%rbx
+  8032be:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8032c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c8:	eb 4d                	jmp    803317 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8032ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032cf:	4c 89 ee             	mov    %r13,%rsi
+  8032d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d7:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8032e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032e8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8032ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f1:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  8032f8:	00 00 00 
+  8032fb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8032fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803302:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803306:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330b:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  803312:	00 00 00 
+  803315:	ff d0                	call   *%rax
+}
+  803317:	89 d8                	mov    %ebx,%eax
+  803319:	48 83 c4 18          	add    $0x18,%rsp
+  80331d:	5b                   	pop    %rbx
+  80331e:	41 5c                	pop    %r12
+  803320:	41 5d                	pop    %r13
+  803322:	5d                   	pop    %rbp
+  803323:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803324:	48 b9 10 42 80 00 00 	movabs $0x804210,%rcx
+  80332b:	00 00 00 
+  80332e:	48 ba e7 41 80 00 00 	movabs $0x8041e7,%rdx
+  803335:	00 00 00 
+  803338:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80333d:	48 bf fc 41 80 00 00 	movabs $0x8041fc,%rdi
+  803344:	00 00 00 
+  803347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334c:	49 b8 a4 37 80 00 00 	movabs $0x8037a4,%r8
+  803353:	00 00 00 
+  803356:	41 ff d0             	call   *%r8
+
+0000000000803359 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803359:	55                   	push   %rbp
+  80335a:	48 89 e5             	mov    %rsp,%rbp
+  80335d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803361:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803365:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803371:	85 c0                	test   %eax,%eax
+  803373:	78 35                	js     8033aa <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803375:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803379:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803380:	00 00 00 
+  803383:	ff d0                	call   *%rax
+  803385:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803388:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80338d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803392:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803396:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  80339d:	00 00 00 
+  8033a0:	ff d0                	call   *%rax
+  8033a2:	85 c0                	test   %eax,%eax
+  8033a4:	0f 94 c0             	sete   %al
+  8033a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8033aa:	c9                   	leave
+  8033ab:	c3                   	ret
+
+00000000008033ac <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033ac:	48 89 f8             	mov    %rdi,%rax
+  8033af:	48 c1 e8 27          	shr    $0x27,%rax
+  8033b3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8033ba:	01 00 00 
+  8033bd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033c1:	f6 c2 01             	test   $0x1,%dl
+  8033c4:	74 6d                	je     803433 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033c6:	48 89 f8             	mov    %rdi,%rax
+  8033c9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033cd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8033d4:	01 00 00 
+  8033d7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033db:	f6 c2 01             	test   $0x1,%dl
+  8033de:	74 62                	je     803442 <get_uvpt_entry+0x96>
+  8033e0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8033e7:	01 00 00 
+  8033ea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033ee:	f6 c2 80             	test   $0x80,%dl
+  8033f1:	75 4f                	jne    803442 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033f3:	48 89 f8             	mov    %rdi,%rax
+  8033f6:	48 c1 e8 15          	shr    $0x15,%rax
+  8033fa:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803401:	01 00 00 
+  803404:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803408:	f6 c2 01             	test   $0x1,%dl
+  80340b:	74 44                	je     803451 <get_uvpt_entry+0xa5>
+  80340d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803414:	01 00 00 
+  803417:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80341b:	f6 c2 80             	test   $0x80,%dl
+  80341e:	75 31                	jne    803451 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803420:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803424:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80342b:	01 00 00 
+  80342e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803432:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803433:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80343a:	01 00 00 
+  80343d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803441:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803442:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803449:	01 00 00 
+  80344c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803450:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803451:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803458:	01 00 00 
+  80345b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80345f:	c3                   	ret
+
+0000000000803460 <get_prot>:
+
+int
+get_prot(void *va) {
+  803460:	55                   	push   %rbp
+  803461:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803464:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+  803470:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803473:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803478:	89 c1                	mov    %eax,%ecx
+  80347a:	83 c9 04             	or     $0x4,%ecx
+  80347d:	f6 c2 01             	test   $0x1,%dl
+  803480:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803483:	89 c1                	mov    %eax,%ecx
+  803485:	83 c9 02             	or     $0x2,%ecx
+  803488:	f6 c2 02             	test   $0x2,%dl
+  80348b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80348e:	89 c1                	mov    %eax,%ecx
+  803490:	83 c9 01             	or     $0x1,%ecx
+  803493:	48 85 d2             	test   %rdx,%rdx
+  803496:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803499:	89 c1                	mov    %eax,%ecx
+  80349b:	83 c9 40             	or     $0x40,%ecx
+  80349e:	f6 c6 04             	test   $0x4,%dh
+  8034a1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8034a4:	5d                   	pop    %rbp
+  8034a5:	c3                   	ret
+
+00000000008034a6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8034a6:	55                   	push   %rbp
+  8034a7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034aa:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8034b6:	48 c1 e8 06          	shr    $0x6,%rax
+  8034ba:	83 e0 01             	and    $0x1,%eax
+}
+  8034bd:	5d                   	pop    %rbp
+  8034be:	c3                   	ret
+
+00000000008034bf <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8034bf:	55                   	push   %rbp
+  8034c0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034c3:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8034cf:	48 c1 e8 05          	shr    $0x5,%rax
+  8034d3:	83 e0 01             	and    $0x1,%eax
+}
+  8034d6:	5d                   	pop    %rbp
+  8034d7:	c3                   	ret
+
+00000000008034d8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8034d8:	55                   	push   %rbp
+  8034d9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8034dc:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	83 e0 01             	and    $0x1,%eax
+}
+  8034eb:	5d                   	pop    %rbp
+  8034ec:	c3                   	ret
+
+00000000008034ed <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+  8034f1:	41 57                	push   %r15
+  8034f3:	41 56                	push   %r14
+  8034f5:	41 55                	push   %r13
+  8034f7:	41 54                	push   %r12
+  8034f9:	53                   	push   %rbx
+  8034fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8034fe:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803502:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803506:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80350b:	49 bd d8 34 80 00 00 	movabs $0x8034d8,%r13
+  803512:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803515:	49 bf 60 34 80 00 00 	movabs $0x803460,%r15
+  80351c:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80351f:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803526:	00 00 00 
+  803529:	eb 0c                	jmp    803537 <foreach_shared_region+0x4a>
+  80352b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803532:	4c 39 f3             	cmp    %r14,%rbx
+  803535:	74 2e                	je     803565 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803537:	48 89 df             	mov    %rbx,%rdi
+  80353a:	41 ff d5             	call   *%r13
+  80353d:	84 c0                	test   %al,%al
+  80353f:	74 ea                	je     80352b <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803541:	48 89 df             	mov    %rbx,%rdi
+  803544:	41 ff d7             	call   *%r15
+  803547:	a8 40                	test   $0x40,%al
+  803549:	74 e0                	je     80352b <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80354b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803552:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803556:	48 89 df             	mov    %rbx,%rdi
+  803559:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80355d:	ff d0                	call   *%rax
+				if (res < 0) {
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	79 c8                	jns    80352b <foreach_shared_region+0x3e>
+  803563:	eb 05                	jmp    80356a <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803565:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356a:	48 83 c4 18          	add    $0x18,%rsp
+  80356e:	5b                   	pop    %rbx
+  80356f:	41 5c                	pop    %r12
+  803571:	41 5d                	pop    %r13
+  803573:	41 5e                	pop    %r14
+  803575:	41 5f                	pop    %r15
+  803577:	5d                   	pop    %rbp
+  803578:	c3                   	ret
+
+0000000000803579 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357e:	c3                   	ret
+
+000000000080357f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803586:	48 be 34 42 80 00 00 	movabs $0x804234,%rsi
+  80358d:	00 00 00 
+  803590:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+    return 0;
+}
+  80359c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a1:	5d                   	pop    %rbp
+  8035a2:	c3                   	ret
+
+00000000008035a3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035a3:	55                   	push   %rbp
+  8035a4:	48 89 e5             	mov    %rsp,%rbp
+  8035a7:	41 57                	push   %r15
+  8035a9:	41 56                	push   %r14
+  8035ab:	41 55                	push   %r13
+  8035ad:	41 54                	push   %r12
+  8035af:	53                   	push   %rbx
+  8035b0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8035b7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8035be:	48 85 d2             	test   %rdx,%rdx
+  8035c1:	74 7a                	je     80363d <devcons_write+0x9a>
+  8035c3:	49 89 d6             	mov    %rdx,%r14
+  8035c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035cc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8035d1:	49 bf 37 0f 80 00 00 	movabs $0x800f37,%r15
+  8035d8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8035db:	4c 89 f3             	mov    %r14,%rbx
+  8035de:	48 29 f3             	sub    %rsi,%rbx
+  8035e1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8035e6:	48 39 c3             	cmp    %rax,%rbx
+  8035e9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8035ed:	4c 63 eb             	movslq %ebx,%r13
+  8035f0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8035f7:	48 01 c6             	add    %rax,%rsi
+  8035fa:	4c 89 ea             	mov    %r13,%rdx
+  8035fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803604:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803607:	4c 89 ee             	mov    %r13,%rsi
+  80360a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803611:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  803618:	00 00 00 
+  80361b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80361d:	41 01 dc             	add    %ebx,%r12d
+  803620:	49 63 f4             	movslq %r12d,%rsi
+  803623:	4c 39 f6             	cmp    %r14,%rsi
+  803626:	72 b3                	jb     8035db <devcons_write+0x38>
+    return res;
+  803628:	49 63 c4             	movslq %r12d,%rax
+}
+  80362b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803632:	5b                   	pop    %rbx
+  803633:	41 5c                	pop    %r12
+  803635:	41 5d                	pop    %r13
+  803637:	41 5e                	pop    %r14
+  803639:	41 5f                	pop    %r15
+  80363b:	5d                   	pop    %rbp
+  80363c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80363d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803643:	eb e3                	jmp    803628 <devcons_write+0x85>
+
+0000000000803645 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803645:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803648:	ba 00 00 00 00       	mov    $0x0,%edx
+  80364d:	48 85 c0             	test   %rax,%rax
+  803650:	74 55                	je     8036a7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803652:	55                   	push   %rbp
+  803653:	48 89 e5             	mov    %rsp,%rbp
+  803656:	41 55                	push   %r13
+  803658:	41 54                	push   %r12
+  80365a:	53                   	push   %rbx
+  80365b:	48 83 ec 08          	sub    $0x8,%rsp
+  80365f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803662:	48 bb 6d 12 80 00 00 	movabs $0x80126d,%rbx
+  803669:	00 00 00 
+  80366c:	49 bc 3a 13 80 00 00 	movabs $0x80133a,%r12
+  803673:	00 00 00 
+  803676:	eb 03                	jmp    80367b <devcons_read+0x36>
+  803678:	41 ff d4             	call   *%r12
+  80367b:	ff d3                	call   *%rbx
+  80367d:	85 c0                	test   %eax,%eax
+  80367f:	74 f7                	je     803678 <devcons_read+0x33>
+    if (c < 0) return c;
+  803681:	48 63 d0             	movslq %eax,%rdx
+  803684:	78 13                	js     803699 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80368b:	83 f8 04             	cmp    $0x4,%eax
+  80368e:	74 09                	je     803699 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803690:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803694:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803699:	48 89 d0             	mov    %rdx,%rax
+  80369c:	48 83 c4 08          	add    $0x8,%rsp
+  8036a0:	5b                   	pop    %rbx
+  8036a1:	41 5c                	pop    %r12
+  8036a3:	41 5d                	pop    %r13
+  8036a5:	5d                   	pop    %rbp
+  8036a6:	c3                   	ret
+  8036a7:	48 89 d0             	mov    %rdx,%rax
+  8036aa:	c3                   	ret
+
+00000000008036ab <cputchar>:
+cputchar(int ch) {
+  8036ab:	55                   	push   %rbp
+  8036ac:	48 89 e5             	mov    %rsp,%rbp
+  8036af:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8036b3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8036b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8036bc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8036c0:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+}
+  8036cc:	c9                   	leave
+  8036cd:	c3                   	ret
+
+00000000008036ce <getchar>:
+getchar(void) {
+  8036ce:	55                   	push   %rbp
+  8036cf:	48 89 e5             	mov    %rsp,%rbp
+  8036d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8036d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036db:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8036df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e4:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  8036eb:	00 00 00 
+  8036ee:	ff d0                	call   *%rax
+  8036f0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8036f2:	85 c0                	test   %eax,%eax
+  8036f4:	78 06                	js     8036fc <getchar+0x2e>
+  8036f6:	74 08                	je     803700 <getchar+0x32>
+  8036f8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8036fc:	89 d0                	mov    %edx,%eax
+  8036fe:	c9                   	leave
+  8036ff:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803700:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803705:	eb f5                	jmp    8036fc <getchar+0x2e>
+
+0000000000803707 <iscons>:
+iscons(int fdnum) {
+  803707:	55                   	push   %rbp
+  803708:	48 89 e5             	mov    %rsp,%rbp
+  80370b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80370f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803713:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	78 18                	js     80373b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803723:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803727:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80372e:	00 00 00 
+  803731:	8b 00                	mov    (%rax),%eax
+  803733:	39 02                	cmp    %eax,(%rdx)
+  803735:	0f 94 c0             	sete   %al
+  803738:	0f b6 c0             	movzbl %al,%eax
+}
+  80373b:	c9                   	leave
+  80373c:	c3                   	ret
+
+000000000080373d <opencons>:
+opencons(void) {
+  80373d:	55                   	push   %rbp
+  80373e:	48 89 e5             	mov    %rsp,%rbp
+  803741:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803745:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803749:	48 b8 41 19 80 00 00 	movabs $0x801941,%rax
+  803750:	00 00 00 
+  803753:	ff d0                	call   *%rax
+  803755:	85 c0                	test   %eax,%eax
+  803757:	78 49                	js     8037a2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803759:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80375e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803763:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376c:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  803773:	00 00 00 
+  803776:	ff d0                	call   *%rax
+  803778:	85 c0                	test   %eax,%eax
+  80377a:	78 26                	js     8037a2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80377c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803780:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803787:	00 00 
+  803789:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80378b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80378f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803796:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  80379d:	00 00 00 
+  8037a0:	ff d0                	call   *%rax
+}
+  8037a2:	c9                   	leave
+  8037a3:	c3                   	ret
+
+00000000008037a4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8037a4:	55                   	push   %rbp
+  8037a5:	48 89 e5             	mov    %rsp,%rbp
+  8037a8:	41 56                	push   %r14
+  8037aa:	41 55                	push   %r13
+  8037ac:	41 54                	push   %r12
+  8037ae:	53                   	push   %rbx
+  8037af:	48 83 ec 50          	sub    $0x50,%rsp
+  8037b3:	49 89 fc             	mov    %rdi,%r12
+  8037b6:	41 89 f5             	mov    %esi,%r13d
+  8037b9:	48 89 d3             	mov    %rdx,%rbx
+  8037bc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037c0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8037c4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8037c8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8037cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8037d3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8037d7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8037db:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8037df:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8037e6:	00 00 00 
+  8037e9:	4c 8b 30             	mov    (%rax),%r14
+  8037ec:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+  8037f8:	89 c6                	mov    %eax,%esi
+  8037fa:	45 89 e8             	mov    %r13d,%r8d
+  8037fd:	4c 89 e1             	mov    %r12,%rcx
+  803800:	4c 89 f2             	mov    %r14,%rdx
+  803803:	48 bf 40 42 80 00 00 	movabs $0x804240,%rdi
+  80380a:	00 00 00 
+  80380d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803812:	49 bc 18 04 80 00 00 	movabs $0x800418,%r12
+  803819:	00 00 00 
+  80381c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80381f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803823:	48 89 df             	mov    %rbx,%rdi
+  803826:	48 b8 b4 03 80 00 00 	movabs $0x8003b4,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+    cprintf("\n");
+  803832:	48 bf af 3b 80 00 00 	movabs $0x803baf,%rdi
+  803839:	00 00 00 
+  80383c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803841:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803844:	cc                   	int3
+  803845:	eb fd                	jmp    803844 <_panic+0xa0>
+
+0000000000803847 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	41 55                	push   %r13
+  80384d:	41 54                	push   %r12
+  80384f:	53                   	push   %rbx
+  803850:	48 83 ec 08          	sub    $0x8,%rsp
+  803854:	49 89 fc             	mov    %rdi,%r12
+  803857:	48 89 f7             	mov    %rsi,%rdi
+  80385a:	48 89 d3             	mov    %rdx,%rbx
+  80385d:	49 89 cd             	mov    %rcx,%r13
+  803860:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803863:	48 85 f6             	test   %rsi,%rsi
+  803866:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80386d:	00 00 00 
+  803870:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803874:	be 00 10 00 00       	mov    $0x1000,%esi
+  803879:	48 85 db             	test   %rbx,%rbx
+  80387c:	74 03                	je     803881 <ipc_recv_timed+0x3a>
+  80387e:	48 8b 33             	mov    (%rbx),%rsi
+  803881:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  803888:	00 00 00 
+  80388b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80388d:	85 c0                	test   %eax,%eax
+  80388f:	78 75                	js     803906 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803891:	4d 85 e4             	test   %r12,%r12
+  803894:	74 14                	je     8038aa <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803896:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  80389d:	00 00 00 
+  8038a0:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8038a6:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8038aa:	4d 85 ed             	test   %r13,%r13
+  8038ad:	74 14                	je     8038c3 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8038af:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  8038b6:	00 00 00 
+  8038b9:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8038bf:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8038c3:	48 85 db             	test   %rbx,%rbx
+  8038c6:	74 23                	je     8038eb <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8038c8:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  8038cf:	00 00 00 
+  8038d2:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8038d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038dd:	85 c9                	test   %ecx,%ecx
+  8038df:	74 07                	je     8038e8 <ipc_recv_timed+0xa1>
+  8038e1:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8038e8:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8038eb:	48 a1 e0 6f 80 00 00 	movabs 0x806fe0,%rax
+  8038f2:	00 00 00 
+  8038f5:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8038fb:	48 83 c4 08          	add    $0x8,%rsp
+  8038ff:	5b                   	pop    %rbx
+  803900:	41 5c                	pop    %r12
+  803902:	41 5d                	pop    %r13
+  803904:	5d                   	pop    %rbp
+  803905:	c3                   	ret
+        if (from_env_store != NULL) {
+  803906:	4d 85 e4             	test   %r12,%r12
+  803909:	74 08                	je     803913 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80390b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803912:	00 
+        if (perm_store != NULL) {
+  803913:	4d 85 ed             	test   %r13,%r13
+  803916:	74 08                	je     803920 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803918:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80391f:	00 
+        if (size != NULL) {
+  803920:	48 85 db             	test   %rbx,%rbx
+  803923:	74 d6                	je     8038fb <ipc_recv_timed+0xb4>
+            *size = 0;
+  803925:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80392c:	eb cd                	jmp    8038fb <ipc_recv_timed+0xb4>
+
+000000000080392e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80392e:	55                   	push   %rbp
+  80392f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803932:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803938:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  80393f:	00 00 00 
+  803942:	ff d0                	call   *%rax
+}
+  803944:	5d                   	pop    %rbp
+  803945:	c3                   	ret
+
+0000000000803946 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803946:	55                   	push   %rbp
+  803947:	48 89 e5             	mov    %rsp,%rbp
+  80394a:	41 57                	push   %r15
+  80394c:	41 56                	push   %r14
+  80394e:	41 55                	push   %r13
+  803950:	41 54                	push   %r12
+  803952:	53                   	push   %rbx
+  803953:	48 83 ec 18          	sub    $0x18,%rsp
+  803957:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80395a:	48 89 d3             	mov    %rdx,%rbx
+  80395d:	49 89 cc             	mov    %rcx,%r12
+  803960:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803963:	48 85 d2             	test   %rdx,%rdx
+  803966:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80396d:	00 00 00 
+  803970:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803974:	89 f0                	mov    %esi,%eax
+  803976:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80397a:	48 89 da             	mov    %rbx,%rdx
+  80397d:	48 89 c6             	mov    %rax,%rsi
+  803980:	48 b8 37 16 80 00 00 	movabs $0x801637,%rax
+  803987:	00 00 00 
+  80398a:	ff d0                	call   *%rax
+    while (res < 0) {
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	79 65                	jns    8039f5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803990:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803993:	75 33                	jne    8039c8 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803995:	49 bf 3a 13 80 00 00 	movabs $0x80133a,%r15
+  80399c:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80399f:	49 be 37 16 80 00 00 	movabs $0x801637,%r14
+  8039a6:	00 00 00 
+        sys_yield();
+  8039a9:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039ac:	45 89 e8             	mov    %r13d,%r8d
+  8039af:	4c 89 e1             	mov    %r12,%rcx
+  8039b2:	48 89 da             	mov    %rbx,%rdx
+  8039b5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8039b9:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8039bc:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8039bf:	85 c0                	test   %eax,%eax
+  8039c1:	79 32                	jns    8039f5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8039c3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8039c6:	74 e1                	je     8039a9 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8039c8:	89 c1                	mov    %eax,%ecx
+  8039ca:	48 ba 63 42 80 00 00 	movabs $0x804263,%rdx
+  8039d1:	00 00 00 
+  8039d4:	be 52 00 00 00       	mov    $0x52,%esi
+  8039d9:	48 bf 77 42 80 00 00 	movabs $0x804277,%rdi
+  8039e0:	00 00 00 
+  8039e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e8:	49 b8 a4 37 80 00 00 	movabs $0x8037a4,%r8
+  8039ef:	00 00 00 
+  8039f2:	41 ff d0             	call   *%r8
+    }
+}
+  8039f5:	48 83 c4 18          	add    $0x18,%rsp
+  8039f9:	5b                   	pop    %rbx
+  8039fa:	41 5c                	pop    %r12
+  8039fc:	41 5d                	pop    %r13
+  8039fe:	41 5e                	pop    %r14
+  803a00:	41 5f                	pop    %r15
+  803a02:	5d                   	pop    %rbp
+  803a03:	c3                   	ret
+
+0000000000803a04 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803a09:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803a10:	00 00 00 
+  803a13:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a17:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a1b:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a1f:	48 01 ca             	add    %rcx,%rdx
+  803a22:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a28:	39 fa                	cmp    %edi,%edx
+  803a2a:	74 12                	je     803a3e <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a2c:	48 83 c0 01          	add    $0x1,%rax
+  803a30:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a36:	75 db                	jne    803a13 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a3d:	c3                   	ret
+            return envs[i].env_id;
+  803a3e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a42:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a46:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a4a:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a51:	00 00 00 
+  803a54:	48 01 d0             	add    %rdx,%rax
+  803a57:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a5d:	c3                   	ret
+  803a5e:	66 90                	xchg   %ax,%ax
+
+0000000000803a60 <__rodata_start>:
+  803a60:	5b                   	pop    %rbx
+  803a61:	45 72 72             	rex.RB jb 803ad6 <__rodata_start+0x76>
+  803a64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a65:	72 72                	jb     803ad9 <__rodata_start+0x79>
+  803a67:	5d                   	pop    %rbp
+  803a68:	20 49 6e             	and    %cl,0x6e(%rcx)
+  803a6b:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  803a6e:	72 65                	jb     803ad5 <__rodata_start+0x75>
+  803a70:	63 74 20 66          	movsxd 0x66(%rax,%riz,1),%esi
+  803a74:	72 65                	jb     803adb <__rodata_start+0x7b>
+  803a76:	65 20 73 70          	and    %dh,%gs:0x70(%rbx)
+  803a7a:	61                   	(bad)
+  803a7b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803a7e:	73 69                	jae    803ae9 <__rodata_start+0x89>
+  803a80:	7a 65                	jp     803ae7 <__rodata_start+0x87>
+  803a82:	21 0a                	and    %ecx,(%rdx)
+  803a84:	00 00                	add    %al,(%rax)
+  803a86:	00 00                	add    %al,(%rax)
+  803a88:	5b                   	pop    %rbx
+  803a89:	45 72 72             	rex.RB jb 803afe <__rodata_start+0x9e>
+  803a8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a8d:	72 72                	jb     803b01 <__rodata_start+0xa1>
+  803a8f:	5d                   	pop    %rbp
+  803a90:	20 49 6e             	and    %cl,0x6e(%rcx)
+  803a93:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  803a96:	72 65                	jb     803afd <__rodata_start+0x9d>
+  803a98:	63 74 20 62          	movsxd 0x62(%rax,%riz,1),%esi
+  803a9c:	75 73                	jne    803b11 <__rodata_start+0xb1>
+  803a9e:	79 20                	jns    803ac0 <__rodata_start+0x60>
+  803aa0:	73 70                	jae    803b12 <__rodata_start+0xb2>
+  803aa2:	61                   	(bad)
+  803aa3:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803aa6:	73 69                	jae    803b11 <__rodata_start+0xb1>
+  803aa8:	7a 65                	jp     803b0f <__rodata_start+0xaf>
+  803aaa:	21 0a                	and    %ecx,(%rdx)
+  803aac:	00 00                	add    %al,(%rax)
+  803aae:	00 00                	add    %al,(%rax)
+  803ab0:	5b                   	pop    %rbx
+  803ab1:	45 72 72             	rex.RB jb 803b26 <__rodata_start+0xc6>
+  803ab4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ab5:	72 72                	jb     803b29 <__rodata_start+0xc9>
+  803ab7:	5d                   	pop    %rbp
+  803ab8:	20 53 6e             	and    %dl,0x6e(%rbx)
+  803abb:	61                   	(bad)
+  803abc:	70 73                	jo     803b31 <__rodata_start+0xd1>
+  803abe:	68 6f 74 20 73       	push   $0x7320746f
+  803ac3:	70 61                	jo     803b26 <__rodata_start+0xc6>
+  803ac5:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803ac8:	63 61 6e             	movsxd 0x6e(%rcx),%esp
+  803acb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803acc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acd:	74 20                	je     803aef <__rodata_start+0x8f>
+  803acf:	62 65                	(bad)
+  803ad1:	20 63 6f             	and    %ah,0x6f(%rbx)
+  803ad4:	75 6e                	jne    803b44 <__rodata_start+0xe4>
+  803ad6:	74 65                	je     803b3d <__rodata_start+0xdd>
+  803ad8:	64 3a 20             	cmp    %fs:(%rax),%ah
+  803adb:	25 69 0a 00 00       	and    $0xa69,%eax
+  803ae0:	25 73 25 73 3a       	and    $0x3a732573,%eax
+  803ae5:	20 65 78             	and    %ah,0x78(%rbp)
+  803ae8:	63 6c 75 73          	movsxd 0x73(%rbp,%rsi,2),%ebp
+  803aec:	69 76 65 20 25 64 20 	imul   $0x20642520,0x65(%rsi),%esi
+  803af3:	62                   	(bad)
+  803af4:	79 74                	jns    803b6a <__rodata_start+0x10a>
+  803af6:	65 73 2c             	gs jae 803b25 <__rodata_start+0xc5>
+  803af9:	20 73 68             	and    %dh,0x68(%rbx)
+  803afc:	61                   	(bad)
+  803afd:	72 65                	jb     803b64 <__rodata_start+0x104>
+  803aff:	64 20 25 64 20 62 79 	and    %ah,%fs:0x79622064(%rip)        # 79e25b6a <__bss_end+0x7961cb6a>
+  803b06:	74 65                	je     803b6d <__rodata_start+0x10d>
+  803b08:	73 0a                	jae    803b14 <__rodata_start+0xb4>
+  803b0a:	00 00                	add    %al,(%rax)
+  803b0c:	00 00                	add    %al,(%rax)
+  803b0e:	00 00                	add    %al,(%rax)
+  803b10:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  803b12:	76 61                	jbe    803b75 <__rodata_start+0x115>
+  803b14:	6c                   	insb   (%dx),%es:(%rdi)
+  803b15:	69 64 20 61 6d 6f 75 	imul   $0x6e756f6d,0x61(%rax,%riz,1),%esp
+  803b1c:	6e 
+  803b1d:	74 20                	je     803b3f <__rodata_start+0xdf>
+  803b1f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b20:	66 20 61 72          	data16 and %ah,0x72(%rcx)
+  803b24:	67 75 6d             	addr32 jne 803b94 <__rodata_start+0x134>
+  803b27:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b29:	74 73                	je     803b9e <__rodata_start+0x13e>
+  803b2b:	20 66 6f             	and    %ah,0x6f(%rsi)
+  803b2e:	72 20                	jb     803b50 <__rodata_start+0xf0>
+  803b30:	64 66 0a 00          	data16 or %fs:(%rax),%al
+  803b34:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  803b36:	20 66 72             	and    %ah,0x72(%rsi)
+  803b39:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803b3e:	61                   	(bad)
+  803b3f:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b44:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b48:	6b 0a 00             	imul   $0x0,(%rdx),%ecx
+  803b4b:	66 72 65             	data16 jb 803bb3 <__rodata_start+0x153>
+  803b4e:	65 20 25 64 20 62 79 	and    %ah,%gs:0x79622064(%rip)        # 79e25bb9 <__bss_end+0x7961cbb9>
+  803b55:	74 65                	je     803bbc <__rodata_start+0x15c>
+  803b57:	73 20                	jae    803b79 <__rodata_start+0x119>
+  803b59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b5b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b5f:	6b 0a 00             	imul   $0x0,(%rdx),%ecx
+  803b62:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  803b64:	20 64 61 74          	and    %ah,0x74(%rcx,%riz,2)
+  803b68:	61                   	(bad)
+  803b69:	20 6f 6e             	and    %ch,0x6e(%rdi)
+  803b6c:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b70:	6b 0a 00             	imul   $0x0,(%rdx),%ecx
+  803b73:	62 75                	(bad)
+  803b75:	73 79                	jae    803bf0 <__rodata_start+0x190>
+  803b77:	20 25 64 20 62 79    	and    %ah,0x79622064(%rip)        # 79e25be1 <__bss_end+0x7961cbe1>
+  803b7d:	74 65                	je     803be4 <__rodata_start+0x184>
+  803b7f:	73 20                	jae    803ba1 <__rodata_start+0x141>
+  803b81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b83:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b87:	6b 0a 00             	imul   $0x0,(%rdx),%ecx
+  803b8a:	20 28                	and    %ch,(%rax)
+  803b8c:	64 65 6c             	fs gs insb (%dx),%es:(%rdi)
+  803b8f:	65 74 65             	gs je  803bf7 <__rodata_start+0x197>
+  803b92:	64 29 00             	sub    %eax,%fs:(%rax)
+  803b95:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  803b97:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  803b9a:	72 65                	jb     803c01 <__rodata_start+0x1a1>
+  803b9c:	63 74 20 66          	movsxd 0x66(%rax,%riz,1),%esi
+  803ba0:	6c                   	insb   (%dx),%es:(%rdi)
+  803ba1:	61                   	(bad)
+  803ba2:	67 20 66 6f          	and    %ah,0x6f(%esi)
+  803ba6:	72 20                	jb     803bc8 <__rodata_start+0x168>
+  803ba8:	64 66 3a 27          	data16 cmp %fs:(%rdi),%ah
+  803bac:	25 63 27 0a 00       	and    $0xa2763,%eax
+  803bb1:	3c 75                	cmp    $0x75,%al
+  803bb3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb4:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803bb8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb9:	3e 00 30             	ds add %dh,(%rax)
+  803bbc:	31 32                	xor    %esi,(%rdx)
+  803bbe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803bc5:	41                   	rex.B
+  803bc6:	42                   	rex.X
+  803bc7:	43                   	rex.XB
+  803bc8:	44                   	rex.R
+  803bc9:	45                   	rex.RB
+  803bca:	46 00 30             	rex.RX add %r14b,(%rax)
+  803bcd:	31 32                	xor    %esi,(%rdx)
+  803bcf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803bd6:	61                   	(bad)
+  803bd7:	62 63 64 65 66       	(bad)
+  803bdc:	00 28                	add    %ch,(%rax)
+  803bde:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bdf:	75 6c                	jne    803c4d <__rodata_start+0x1ed>
+  803be1:	6c                   	insb   (%dx),%es:(%rdi)
+  803be2:	29 00                	sub    %eax,(%rax)
+  803be4:	65 72 72             	gs jb  803c59 <__rodata_start+0x1f9>
+  803be7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be8:	72 20                	jb     803c0a <__rodata_start+0x1aa>
+  803bea:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803bef:	73 70                	jae    803c61 <__rodata_start+0x201>
+  803bf1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803bf5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803bfc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bfd:	72 00                	jb     803bff <__rodata_start+0x19f>
+  803bff:	62 61 64 20 65       	(bad)
+  803c04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c05:	76 69                	jbe    803c70 <__rodata_start+0x210>
+  803c07:	72 6f                	jb     803c78 <__rodata_start+0x218>
+  803c09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c0a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c0b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c0d:	74 00                	je     803c0f <__rodata_start+0x1af>
+  803c0f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c16:	20 70 61             	and    %dh,0x61(%rax)
+  803c19:	72 61                	jb     803c7c <__rodata_start+0x21c>
+  803c1b:	6d                   	insl   (%dx),%es:(%rdi)
+  803c1c:	65 74 65             	gs je  803c84 <__rodata_start+0x224>
+  803c1f:	72 00                	jb     803c21 <__rodata_start+0x1c1>
+  803c21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c22:	75 74                	jne    803c98 <__rodata_start+0x238>
+  803c24:	20 6f 66             	and    %ch,0x66(%rdi)
+  803c27:	20 6d 65             	and    %ch,0x65(%rbp)
+  803c2a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c2c:	72 79                	jb     803ca7 <__rodata_start+0x247>
+  803c2e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803c31:	74 20                	je     803c53 <__rodata_start+0x1f3>
+  803c33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c34:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803c38:	76 69                	jbe    803ca3 <__rodata_start+0x243>
+  803c3a:	72 6f                	jb     803cab <__rodata_start+0x24b>
+  803c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c3d:	6d                   	insl   (%dx),%es:(%rdi)
+  803c3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c40:	74 73                	je     803cb5 <__rodata_start+0x255>
+  803c42:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803c45:	72 72                	jb     803cb9 <__rodata_start+0x259>
+  803c47:	75 70                	jne    803cb9 <__rodata_start+0x259>
+  803c49:	74 65                	je     803cb0 <__rodata_start+0x250>
+  803c4b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803c50:	75 67                	jne    803cb9 <__rodata_start+0x259>
+  803c52:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c55:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c57:	00 73 65             	add    %dh,0x65(%rbx)
+  803c5a:	67 6d                	insl   (%dx),%es:(%edi)
+  803c5c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c5e:	74 61                	je     803cc1 <__rodata_start+0x261>
+  803c60:	74 69                	je     803ccb <__rodata_start+0x26b>
+  803c62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c64:	20 66 61             	and    %ah,0x61(%rsi)
+  803c67:	75 6c                	jne    803cd5 <__rodata_start+0x275>
+  803c69:	74 00                	je     803c6b <__rodata_start+0x20b>
+  803c6b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c72:	20 45 4c             	and    %al,0x4c(%rbp)
+  803c75:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c79:	61                   	(bad)
+  803c7a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c7f:	20 73 75             	and    %dh,0x75(%rbx)
+  803c82:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c85:	73 79                	jae    803d00 <__rodata_start+0x2a0>
+  803c87:	73 74                	jae    803cfd <__rodata_start+0x29d>
+  803c89:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c8b:	20 63 61             	and    %ah,0x61(%rbx)
+  803c8e:	6c                   	insb   (%dx),%es:(%rdi)
+  803c8f:	6c                   	insb   (%dx),%es:(%rdi)
+  803c90:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803c93:	74 72                	je     803d07 <__rodata_start+0x2a7>
+  803c95:	79 20                	jns    803cb7 <__rodata_start+0x257>
+  803c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c99:	74 20                	je     803cbb <__rodata_start+0x25b>
+  803c9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c9d:	75 6e                	jne    803d0d <__rodata_start+0x2ad>
+  803c9f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803ca3:	76 20                	jbe    803cc5 <__rodata_start+0x265>
+  803ca5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803cac:	72 65                	jb     803d13 <__rodata_start+0x2b3>
+  803cae:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803cb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cb2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803cb6:	65 78 70             	gs js  803d29 <__rodata_start+0x2c9>
+  803cb9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803cbe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803cc1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803cc5:	20 66 69             	and    %ah,0x69(%rsi)
+  803cc8:	6c                   	insb   (%dx),%es:(%rdi)
+  803cc9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803ccd:	20 66 72             	and    %ah,0x72(%rsi)
+  803cd0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803cd5:	61                   	(bad)
+  803cd6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803cd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cdb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803cdf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803ce2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ce3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ce4:	20 6d 61             	and    %ch,0x61(%rbp)
+  803ce7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ce8:	79 20                	jns    803d0a <__rodata_start+0x2aa>
+  803cea:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803cf1:	72 65                	jb     803d58 <__rodata_start+0x2f8>
+  803cf3:	20 6f 70             	and    %ch,0x70(%rdi)
+  803cf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cf8:	00 66 69             	add    %ah,0x69(%rsi)
+  803cfb:	6c                   	insb   (%dx),%es:(%rdi)
+  803cfc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803d00:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803d03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d04:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803d07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d09:	74 20                	je     803d2b <__rodata_start+0x2cb>
+  803d0b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d0d:	75 6e                	jne    803d7d <__rodata_start+0x31d>
+  803d0f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803d13:	76 61                	jbe    803d76 <__rodata_start+0x316>
+  803d15:	6c                   	insb   (%dx),%es:(%rdi)
+  803d16:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803d1d:	00 
+  803d1e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803d25:	72 65                	jb     803d8c <__rodata_start+0x32c>
+  803d27:	61                   	(bad)
+  803d28:	64 79 20             	fs jns 803d4b <__rodata_start+0x2eb>
+  803d2b:	65 78 69             	gs js  803d97 <__rodata_start+0x337>
+  803d2e:	73 74                	jae    803da4 <__rodata_start+0x344>
+  803d30:	73 00                	jae    803d32 <__rodata_start+0x2d2>
+  803d32:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d33:	70 65                	jo     803d9a <__rodata_start+0x33a>
+  803d35:	72 61                	jb     803d98 <__rodata_start+0x338>
+  803d37:	74 69                	je     803da2 <__rodata_start+0x342>
+  803d39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d3b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803d3e:	74 20                	je     803d60 <__rodata_start+0x300>
+  803d40:	73 75                	jae    803db7 <__rodata_start+0x357>
+  803d42:	70 70                	jo     803db4 <__rodata_start+0x354>
+  803d44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d45:	72 74                	jb     803dbb <__rodata_start+0x35b>
+  803d47:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803d4d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803d52:	74 00                	je     803d54 <__rodata_start+0x2f4>
+  803d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803d5b:	00 00 00 
+  803d5e:	66 90                	xchg   %ax,%ax
+  803d60:	05 06 80 00 00       	add    $0x8006,%eax
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 46 0c             	add    %al,0xc(%rsi)
+  803d6a:	80 00 00             	addb   $0x0,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 36                	add    %dh,(%rsi)
+  803d71:	0c 80                	or     $0x80,%al
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 46 0c             	add    %al,0xc(%rsi)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 46 0c             	add    %al,0xc(%rsi)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 46 0c             	add    %al,0xc(%rsi)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 46 0c             	add    %al,0xc(%rsi)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 24 06             	add    %ah,(%rsi,%rax,1)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 46 0c             	add    %al,0xc(%rsi)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 46 0c             	add    %al,0xc(%rsi)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 18                	add    %bl,(%rax)
+  803db1:	06                   	(bad)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 92 06 80 00 00    	add    %dl,0x8006(%rdx)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 46 0c             	add    %al,0xc(%rsi)
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 18                	add    %bl,(%rax)
+  803dc9:	06                   	(bad)
+  803dca:	80 00 00             	addb   $0x0,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 5e 06             	add    %bl,0x6(%rsi)
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 5e 06             	add    %bl,0x6(%rsi)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 5e 06             	add    %bl,0x6(%rsi)
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 5e 06             	add    %bl,0x6(%rsi)
+  803dea:	80 00 00             	addb   $0x0,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 5e 06             	add    %bl,0x6(%rsi)
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 5e 06             	add    %bl,0x6(%rsi)
+  803dfa:	80 00 00             	addb   $0x0,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 5e 06             	add    %bl,0x6(%rsi)
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 5e 06             	add    %bl,0x6(%rsi)
+  803e0a:	80 00 00             	addb   $0x0,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 5e 06             	add    %bl,0x6(%rsi)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 46 0c             	add    %al,0xc(%rsi)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 46 0c             	add    %al,0xc(%rsi)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 46 0c             	add    %al,0xc(%rsi)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 46 0c             	add    %al,0xc(%rsi)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 46 0c             	add    %al,0xc(%rsi)
+  803e5a:	80 00 00             	addb   $0x0,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 46 0c             	add    %al,0xc(%rsi)
+  803e6a:	80 00 00             	addb   $0x0,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 46 0c             	add    %al,0xc(%rsi)
+  803e7a:	80 00 00             	addb   $0x0,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 46 0c             	add    %al,0xc(%rsi)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 46 0c             	add    %al,0xc(%rsi)
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 46 0c             	add    %al,0xc(%rsi)
+  803e9a:	80 00 00             	addb   $0x0,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 46 0c             	add    %al,0xc(%rsi)
+  803ea2:	80 00 00             	addb   $0x0,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 46 0c             	add    %al,0xc(%rsi)
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 46 0c             	add    %al,0xc(%rsi)
+  803eb2:	80 00 00             	addb   $0x0,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 46 0c             	add    %al,0xc(%rsi)
+  803eba:	80 00 00             	addb   $0x0,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 46 0c             	add    %al,0xc(%rsi)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 46 0c             	add    %al,0xc(%rsi)
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 46 0c             	add    %al,0xc(%rsi)
+  803ed2:	80 00 00             	addb   $0x0,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 46 0c             	add    %al,0xc(%rsi)
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 46 0c             	add    %al,0xc(%rsi)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 46 0c             	add    %al,0xc(%rsi)
+  803eea:	80 00 00             	addb   $0x0,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 46 0c             	add    %al,0xc(%rsi)
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 46 0c             	add    %al,0xc(%rsi)
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 46 0c             	add    %al,0xc(%rsi)
+  803f02:	80 00 00             	addb   $0x0,(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 69 0b             	add    %ch,0xb(%rcx)
+  803f0a:	80 00 00             	addb   $0x0,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 46 0c             	add    %al,0xc(%rsi)
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f22:	80 00 00             	addb   $0x0,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 46 0c             	add    %al,0xc(%rsi)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f32:	80 00 00             	addb   $0x0,(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 46 0c             	add    %al,0xc(%rsi)
+  803f3a:	80 00 00             	addb   $0x0,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 46 0c             	add    %al,0xc(%rsi)
+  803f4a:	80 00 00             	addb   $0x0,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f52:	80 00 00             	addb   $0x0,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 46 0c             	add    %al,0xc(%rsi)
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 b5 06 80 00 00    	add    %dh,0x8006(%rbp)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 84 08 80 00 00 00 	add    %al,0x80(%rax,%rcx,1)
+  803f6e:	00 00                	add    %al,(%rax)
+  803f70:	46 0c 80             	rex.RX or $0x80,%al
+  803f73:	00 00                	add    %al,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 46 0c             	add    %al,0xc(%rsi)
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 46 0c             	add    %al,0xc(%rsi)
+  803f82:	80 00 00             	addb   $0x0,(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 46 0c             	add    %al,0xc(%rsi)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 e4                	add    %ah,%ah
+  803f91:	06                   	(bad)
+  803f92:	80 00 00             	addb   $0x0,(%rax)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 46 0c             	add    %al,0xc(%rsi)
+  803f9a:	80 00 00             	addb   $0x0,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 46 0c             	add    %al,0xc(%rsi)
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 aa 06 80 00 00    	add    %ch,0x8006(%rdx)
+  803fad:	00 00                	add    %al,(%rax)
+  803faf:	00 46 0c             	add    %al,0xc(%rsi)
+  803fb2:	80 00 00             	addb   $0x0,(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 46 0c             	add    %al,0xc(%rsi)
+  803fba:	80 00 00             	addb   $0x0,(%rax)
+  803fbd:	00 00                	add    %al,(%rax)
+  803fbf:	00 2c 0a             	add    %ch,(%rdx,%rcx,1)
+  803fc2:	80 00 00             	addb   $0x0,(%rax)
+  803fc5:	00 00                	add    %al,(%rax)
+  803fc7:	00 f6                	add    %dh,%dh
+  803fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803fcf:	00 46 0c             	add    %al,0xc(%rsi)
+  803fd2:	80 00 00             	addb   $0x0,(%rax)
+  803fd5:	00 00                	add    %al,(%rax)
+  803fd7:	00 46 0c             	add    %al,0xc(%rsi)
+  803fda:	80 00 00             	addb   $0x0,(%rax)
+  803fdd:	00 00                	add    %al,(%rax)
+  803fdf:	00 7b 07             	add    %bh,0x7(%rbx)
+  803fe2:	80 00 00             	addb   $0x0,(%rax)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 46 0c             	add    %al,0xc(%rsi)
+  803fea:	80 00 00             	addb   $0x0,(%rax)
+  803fed:	00 00                	add    %al,(%rax)
+  803fef:	00 58 09             	add    %bl,0x9(%rax)
+  803ff2:	80 00 00             	addb   $0x0,(%rax)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 46 0c             	add    %al,0xc(%rsi)
+  803ffa:	80 00 00             	addb   $0x0,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 46 0c             	add    %al,0xc(%rsi)
+  804002:	80 00 00             	addb   $0x0,(%rax)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 69 0b             	add    %ch,0xb(%rcx)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 46 0c             	add    %al,0xc(%rsi)
+  804012:	80 00 00             	addb   $0x0,(%rax)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 0e                	add    %cl,(%rsi)
+  804019:	06                   	(bad)
+  80401a:	80 00 00             	addb   $0x0,(%rax)
+  80401d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804020 <error_string>:
+	...
+  804028:	ed 3b 80 00 00 00 00 00 ff 3b 80 00 00 00 00 00     .;.......;......
+  804038:	0f 3c 80 00 00 00 00 00 21 3c 80 00 00 00 00 00     .<......!<......
+  804048:	2f 3c 80 00 00 00 00 00 43 3c 80 00 00 00 00 00     /<......C<......
+  804058:	58 3c 80 00 00 00 00 00 6b 3c 80 00 00 00 00 00     X<......k<......
+  804068:	7d 3c 80 00 00 00 00 00 91 3c 80 00 00 00 00 00     }<.......<......
+  804078:	a1 3c 80 00 00 00 00 00 b4 3c 80 00 00 00 00 00     .<.......<......
+  804088:	cb 3c 80 00 00 00 00 00 e1 3c 80 00 00 00 00 00     .<.......<......
+  804098:	f9 3c 80 00 00 00 00 00 11 3d 80 00 00 00 00 00     .<.......=......
+  8040a8:	1e 3d 80 00 00 00 00 00 c8 40 80 00 00 00 00 00     .=.......@......
+  8040b8:	32 3d 80 00 00 00 00 00 4a 3d 80 00 00 00 00 00     2=......J=......
+  8040c8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8040d8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8040e8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8040f8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804108:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804118:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804128:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804138:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804148:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804158:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804168:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804178:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804188:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804198:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8041a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8041b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008041c0 <devtab>:
+  8041c0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  8041d0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8041e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8041f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804200:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804210:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804220:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804230:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804240:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804250:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804260:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  804270:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804280:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804290:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804300:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804310:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804320:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804330:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804340:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804350:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804360:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804370:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804380:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804390:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804400:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804410:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804420:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804430:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804440:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
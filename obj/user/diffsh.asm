@@ -0,0 +1,7064 @@
+
+obj/user/diffsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 93 01 00 00       	call   8001b6 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+static struct Sh_diff_record records[SH_DIFF_RECORDS];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	49 89 f6             	mov    %rsi,%r14
+
+    if (argc != 3) {
+  800039:	83 ff 03             	cmp    $0x3,%edi
+  80003c:	74 68                	je     8000a6 <umain+0x81>
+  80003e:	41 89 fc             	mov    %edi,%r12d
+        cprintf("Usage: diffsh <from snapshot> <to snapshot>\n");
+  800041:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  800048:	00 00 00 
+  80004b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800050:	48 ba 34 03 80 00 00 	movabs $0x800334,%rdx
+  800057:	00 00 00 
+  80005a:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  80005c:	45 85 e4             	test   %r12d,%r12d
+  80005f:	7e 36                	jle    800097 <umain+0x72>
+  800061:	4d 63 e4             	movslq %r12d,%r12
+  800064:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  800069:	49 bf 30 38 80 00 00 	movabs $0x803830,%r15
+  800070:	00 00 00 
+  800073:	49 bd 34 03 80 00 00 	movabs $0x800334,%r13
+  80007a:	00 00 00 
+  80007d:	49 8b 14 de          	mov    (%r14,%rbx,8),%rdx
+  800081:	89 de                	mov    %ebx,%esi
+  800083:	4c 89 ff             	mov    %r15,%rdi
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	41 ff d5             	call   *%r13
+        for(int i = 0; i < argc; ++i) {
+  80008e:	48 83 c3 01          	add    $0x1,%rbx
+  800092:	4c 39 e3             	cmp    %r12,%rbx
+  800095:	75 e6                	jne    80007d <umain+0x58>
+            }
+        }
+    }
+
+    return;
+}
+  800097:	48 83 c4 28          	add    $0x28,%rsp
+  80009b:	5b                   	pop    %rbx
+  80009c:	41 5c                	pop    %r12
+  80009e:	41 5d                	pop    %r13
+  8000a0:	41 5e                	pop    %r14
+  8000a2:	41 5f                	pop    %r15
+  8000a4:	5d                   	pop    %rbp
+  8000a5:	c3                   	ret
+    memset(&cursor, 0, sizeof(cursor));
+  8000a6:	ba 18 00 00 00       	mov    $0x18,%edx
+  8000ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b0:	48 8d 7d b8          	lea    -0x48(%rbp),%rdi
+  8000b4:	48 b8 a5 0d 80 00 00 	movabs $0x800da5,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+    while (!cursor.dc_done) {
+  8000c0:	80 7d c8 00          	cmpb   $0x0,-0x38(%rbp)
+  8000c4:	75 d1                	jne    800097 <umain+0x72>
+                cprintf("M %s blocks [%u, %u) size %d\n", record->dr_name, record->dr_start, record->dr_end, record->dr_size);
+  8000c6:	49 bf 86 38 80 00 00 	movabs $0x803886,%r15
+  8000cd:	00 00 00 
+  8000d0:	e9 8e 00 00 00       	jmp    800163 <umain+0x13e>
+            cprintf("Snapshots cannot be compared: %i\n", res);
+  8000d5:	89 c6                	mov    %eax,%esi
+  8000d7:	48 bf 58 38 80 00 00 	movabs $0x803858,%rdi
+  8000de:	00 00 00 
+  8000e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e6:	48 ba 34 03 80 00 00 	movabs $0x800334,%rdx
+  8000ed:	00 00 00 
+  8000f0:	ff d2                	call   *%rdx
+            return;
+  8000f2:	eb a3                	jmp    800097 <umain+0x72>
+                cprintf("+ %s\n", record->dr_name);
+  8000f4:	48 bf 7a 38 80 00 00 	movabs $0x80387a,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d5             	call   *%r13
+  800106:	eb 12                	jmp    80011a <umain+0xf5>
+                cprintf("- %s\n", record->dr_name);
+  800108:	48 bf 80 38 80 00 00 	movabs $0x803880,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	41 ff d5             	call   *%r13
+        for (int i = 0; i < res; ++i) {
+  80011a:	48 81 c3 98 00 00 00 	add    $0x98,%rbx
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	74 33                	je     800159 <umain+0x134>
+            if (record->dr_type == SH_DIFF_CREATED) {
+  800126:	48 89 de             	mov    %rbx,%rsi
+  800129:	8b 83 88 00 00 00    	mov    0x88(%rbx),%eax
+  80012f:	83 f8 02             	cmp    $0x2,%eax
+  800132:	74 c0                	je     8000f4 <umain+0xcf>
+            } else if (record->dr_type == SH_DIFF_REMOVED) {
+  800134:	83 f8 03             	cmp    $0x3,%eax
+  800137:	74 cf                	je     800108 <umain+0xe3>
+                cprintf("M %s blocks [%u, %u) size %d\n", record->dr_name, record->dr_start, record->dr_end, record->dr_size);
+  800139:	8b 8b 90 00 00 00    	mov    0x90(%rbx),%ecx
+  80013f:	8b 93 8c 00 00 00    	mov    0x8c(%rbx),%edx
+  800145:	44 8b 83 94 00 00 00 	mov    0x94(%rbx),%r8d
+  80014c:	4c 89 ff             	mov    %r15,%rdi
+  80014f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800154:	41 ff d5             	call   *%r13
+  800157:	eb c1                	jmp    80011a <umain+0xf5>
+    while (!cursor.dc_done) {
+  800159:	80 7d c8 00          	cmpb   $0x0,-0x38(%rbp)
+  80015d:	0f 85 34 ff ff ff    	jne    800097 <umain+0x72>
+        int res = diff_snapshots(argv[1], argv[2], &cursor, records);
+  800163:	49 8b 76 10          	mov    0x10(%r14),%rsi
+  800167:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  80016b:	48 b9 00 50 80 00 00 	movabs $0x805000,%rcx
+  800172:	00 00 00 
+  800175:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  800179:	48 b8 f6 1f 80 00 00 	movabs $0x801ff6,%rax
+  800180:	00 00 00 
+  800183:	ff d0                	call   *%rax
+        if (res < 0) {
+  800185:	85 c0                	test   %eax,%eax
+  800187:	0f 88 48 ff ff ff    	js     8000d5 <umain+0xb0>
+        for (int i = 0; i < res; ++i) {
+  80018d:	7e ca                	jle    800159 <umain+0x134>
+  80018f:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  800196:	00 00 00 
+  800199:	48 98                	cltq
+  80019b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80019f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001a3:	4c 8d 24 c3          	lea    (%rbx,%rax,8),%r12
+                cprintf("M %s blocks [%u, %u) size %d\n", record->dr_name, record->dr_start, record->dr_end, record->dr_size);
+  8001a7:	49 bd 34 03 80 00 00 	movabs $0x800334,%r13
+  8001ae:	00 00 00 
+  8001b1:	e9 70 ff ff ff       	jmp    800126 <umain+0x101>
+
+00000000008001b6 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001b6:	55                   	push   %rbp
+  8001b7:	48 89 e5             	mov    %rsp,%rbp
+  8001ba:	41 56                	push   %r14
+  8001bc:	41 55                	push   %r13
+  8001be:	41 54                	push   %r12
+  8001c0:	53                   	push   %rbx
+  8001c1:	41 89 fd             	mov    %edi,%r13d
+  8001c4:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001c7:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  8001ce:	00 00 00 
+  8001d1:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  8001d8:	00 00 00 
+  8001db:	48 39 c2             	cmp    %rax,%rdx
+  8001de:	73 17                	jae    8001f7 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001e0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001e3:	49 89 c4             	mov    %rax,%r12
+  8001e6:	48 83 c3 08          	add    $0x8,%rbx
+  8001ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ef:	ff 53 f8             	call   *-0x8(%rbx)
+  8001f2:	4c 39 e3             	cmp    %r12,%rbx
+  8001f5:	72 ef                	jb     8001e6 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001f7:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8001fe:	00 00 00 
+  800201:	ff d0                	call   *%rax
+  800203:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800208:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80020c:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800210:	48 c1 e0 04          	shl    $0x4,%rax
+  800214:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80021b:	00 00 00 
+  80021e:	48 01 d0             	add    %rdx,%rax
+  800221:	48 a3 70 5f 80 00 00 	movabs %rax,0x805f70
+  800228:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80022b:	45 85 ed             	test   %r13d,%r13d
+  80022e:	7e 0d                	jle    80023d <libmain+0x87>
+  800230:	49 8b 06             	mov    (%r14),%rax
+  800233:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80023a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80023d:	4c 89 f6             	mov    %r14,%rsi
+  800240:	44 89 ef             	mov    %r13d,%edi
+  800243:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80024f:	48 b8 64 02 80 00 00 	movabs $0x800264,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+#endif
+}
+  80025b:	5b                   	pop    %rbx
+  80025c:	41 5c                	pop    %r12
+  80025e:	41 5d                	pop    %r13
+  800260:	41 5e                	pop    %r14
+  800262:	5d                   	pop    %rbp
+  800263:	c3                   	ret
+
+0000000000800264 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800264:	55                   	push   %rbp
+  800265:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800268:	48 b8 db 18 80 00 00 	movabs $0x8018db,%rax
+  80026f:	00 00 00 
+  800272:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800274:	bf 00 00 00 00       	mov    $0x0,%edi
+  800279:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+
+0000000000800287 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+  80028b:	53                   	push   %rbx
+  80028c:	48 83 ec 08          	sub    $0x8,%rsp
+  800290:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800293:	8b 06                	mov    (%rsi),%eax
+  800295:	8d 50 01             	lea    0x1(%rax),%edx
+  800298:	89 16                	mov    %edx,(%rsi)
+  80029a:	48 98                	cltq
+  80029c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002a1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002a7:	74 0a                	je     8002b3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002a9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002b3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002b7:	be ff 00 00 00       	mov    $0xff,%esi
+  8002bc:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002c8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002ce:	eb d9                	jmp    8002a9 <putch+0x22>
+
+00000000008002d0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002d0:	55                   	push   %rbp
+  8002d1:	48 89 e5             	mov    %rsp,%rbp
+  8002d4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002db:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002de:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002e5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ef:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002f2:	48 89 f1             	mov    %rsi,%rcx
+  8002f5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002fc:	48 bf 87 02 80 00 00 	movabs $0x800287,%rdi
+  800303:	00 00 00 
+  800306:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800312:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800319:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800320:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  800327:	00 00 00 
+  80032a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80032c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+
+0000000000800334 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800334:	55                   	push   %rbp
+  800335:	48 89 e5             	mov    %rsp,%rbp
+  800338:	48 83 ec 50          	sub    $0x50,%rsp
+  80033c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800340:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800344:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800348:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80034c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800350:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800357:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80035b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80035f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800363:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800367:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80036b:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800377:	c9                   	leave
+  800378:	c3                   	ret
+
+0000000000800379 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	41 57                	push   %r15
+  80037f:	41 56                	push   %r14
+  800381:	41 55                	push   %r13
+  800383:	41 54                	push   %r12
+  800385:	53                   	push   %rbx
+  800386:	48 83 ec 18          	sub    $0x18,%rsp
+  80038a:	49 89 fc             	mov    %rdi,%r12
+  80038d:	49 89 f5             	mov    %rsi,%r13
+  800390:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800394:	8b 45 10             	mov    0x10(%rbp),%eax
+  800397:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80039a:	41 89 cf             	mov    %ecx,%r15d
+  80039d:	4c 39 fa             	cmp    %r15,%rdx
+  8003a0:	73 5b                	jae    8003fd <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003a2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003a6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003aa:	85 db                	test   %ebx,%ebx
+  8003ac:	7e 0e                	jle    8003bc <print_num+0x43>
+            putch(padc, put_arg);
+  8003ae:	4c 89 ee             	mov    %r13,%rsi
+  8003b1:	44 89 f7             	mov    %r14d,%edi
+  8003b4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003b7:	83 eb 01             	sub    $0x1,%ebx
+  8003ba:	75 f2                	jne    8003ae <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003bc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003c0:	48 b9 bf 38 80 00 00 	movabs $0x8038bf,%rcx
+  8003c7:	00 00 00 
+  8003ca:	48 b8 ae 38 80 00 00 	movabs $0x8038ae,%rax
+  8003d1:	00 00 00 
+  8003d4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e1:	49 f7 f7             	div    %r15
+  8003e4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003e8:	4c 89 ee             	mov    %r13,%rsi
+  8003eb:	41 ff d4             	call   *%r12
+}
+  8003ee:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003f2:	5b                   	pop    %rbx
+  8003f3:	41 5c                	pop    %r12
+  8003f5:	41 5d                	pop    %r13
+  8003f7:	41 5e                	pop    %r14
+  8003f9:	41 5f                	pop    %r15
+  8003fb:	5d                   	pop    %rbp
+  8003fc:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800401:	ba 00 00 00 00       	mov    $0x0,%edx
+  800406:	49 f7 f7             	div    %r15
+  800409:	48 83 ec 08          	sub    $0x8,%rsp
+  80040d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800411:	52                   	push   %rdx
+  800412:	45 0f be c9          	movsbl %r9b,%r9d
+  800416:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80041a:	48 89 c2             	mov    %rax,%rdx
+  80041d:	48 b8 79 03 80 00 00 	movabs $0x800379,%rax
+  800424:	00 00 00 
+  800427:	ff d0                	call   *%rax
+  800429:	48 83 c4 10          	add    $0x10,%rsp
+  80042d:	eb 8d                	jmp    8003bc <print_num+0x43>
+
+000000000080042f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80042f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800433:	48 8b 06             	mov    (%rsi),%rax
+  800436:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80043a:	73 0a                	jae    800446 <sprintputch+0x17>
+        *state->start++ = ch;
+  80043c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800440:	48 89 16             	mov    %rdx,(%rsi)
+  800443:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800446:	c3                   	ret
+
+0000000000800447 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	48 83 ec 50          	sub    $0x50,%rsp
+  80044f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800453:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800457:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80045b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800462:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800466:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80046a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80046e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800472:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800476:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  80047d:	00 00 00 
+  800480:	ff d0                	call   *%rax
+}
+  800482:	c9                   	leave
+  800483:	c3                   	ret
+
+0000000000800484 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800484:	55                   	push   %rbp
+  800485:	48 89 e5             	mov    %rsp,%rbp
+  800488:	41 57                	push   %r15
+  80048a:	41 56                	push   %r14
+  80048c:	41 55                	push   %r13
+  80048e:	41 54                	push   %r12
+  800490:	53                   	push   %rbx
+  800491:	48 83 ec 38          	sub    $0x38,%rsp
+  800495:	49 89 fe             	mov    %rdi,%r14
+  800498:	49 89 f5             	mov    %rsi,%r13
+  80049b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80049e:	48 8b 01             	mov    (%rcx),%rax
+  8004a1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004a5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ad:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004b5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004b9:	0f b6 3b             	movzbl (%rbx),%edi
+  8004bc:	40 80 ff 25          	cmp    $0x25,%dil
+  8004c0:	74 18                	je     8004da <vprintfmt+0x56>
+            if (!ch) return;
+  8004c2:	40 84 ff             	test   %dil,%dil
+  8004c5:	0f 84 b1 06 00 00    	je     800b7c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004cb:	40 0f b6 ff          	movzbl %dil,%edi
+  8004cf:	4c 89 ee             	mov    %r13,%rsi
+  8004d2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004d5:	4c 89 e3             	mov    %r12,%rbx
+  8004d8:	eb db                	jmp    8004b5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004da:	be 00 00 00 00       	mov    $0x0,%esi
+  8004df:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004e3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004e8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ee:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004f5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004fe:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800503:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800506:	83 e8 23             	sub    $0x23,%eax
+  800509:	3c 57                	cmp    $0x57,%al
+  80050b:	0f 87 51 06 00 00    	ja     800b62 <vprintfmt+0x6de>
+  800511:	0f b6 c0             	movzbl %al,%eax
+  800514:	48 b9 60 3a 80 00 00 	movabs $0x803a60,%rcx
+  80051b:	00 00 00 
+  80051e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800521:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800524:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800528:	eb cf                	jmp    8004f9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80052a:	49 89 dc             	mov    %rbx,%r12
+  80052d:	be 01 00 00 00       	mov    $0x1,%esi
+  800532:	eb c5                	jmp    8004f9 <vprintfmt+0x75>
+            padc = ch;
+  800534:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800538:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053e:	eb b9                	jmp    8004f9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800540:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800543:	83 f8 2f             	cmp    $0x2f,%eax
+  800546:	77 24                	ja     80056c <vprintfmt+0xe8>
+  800548:	89 c1                	mov    %eax,%ecx
+  80054a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80054e:	83 c0 08             	add    $0x8,%eax
+  800551:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800554:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800557:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80055a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055e:	79 99                	jns    8004f9 <vprintfmt+0x75>
+                width = precision;
+  800560:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800564:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80056a:	eb 8d                	jmp    8004f9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80056c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800570:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800574:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800578:	eb da                	jmp    800554 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80057a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80057f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800583:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800589:	3c 39                	cmp    $0x39,%al
+  80058b:	77 1c                	ja     8005a9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80058d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800591:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800595:	0f b6 c0             	movzbl %al,%eax
+  800598:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80059d:	0f b6 03             	movzbl (%rbx),%eax
+  8005a0:	3c 39                	cmp    $0x39,%al
+  8005a2:	76 e9                	jbe    80058d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005a4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005a7:	eb b1                	jmp    80055a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005a9:	49 89 dc             	mov    %rbx,%r12
+  8005ac:	eb ac                	jmp    80055a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ae:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	0f 49 c1             	cmovns %ecx,%eax
+  8005bb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005be:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c1:	e9 33 ff ff ff       	jmp    8004f9 <vprintfmt+0x75>
+            lflag++;
+  8005c6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005c9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005cc:	e9 28 ff ff ff       	jmp    8004f9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d7:	77 19                	ja     8005f2 <vprintfmt+0x16e>
+  8005d9:	89 c2                	mov    %eax,%edx
+  8005db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005df:	83 c0 08             	add    $0x8,%eax
+  8005e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e5:	8b 3a                	mov    (%rdx),%edi
+  8005e7:	4c 89 ee             	mov    %r13,%rsi
+  8005ea:	41 ff d6             	call   *%r14
+            break;
+  8005ed:	e9 c3 fe ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fe:	eb e5                	jmp    8005e5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800600:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800603:	83 f8 2f             	cmp    $0x2f,%eax
+  800606:	77 5a                	ja     800662 <vprintfmt+0x1de>
+  800608:	89 c2                	mov    %eax,%edx
+  80060a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060e:	83 c0 08             	add    $0x8,%eax
+  800611:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800614:	8b 02                	mov    (%rdx),%eax
+  800616:	89 c1                	mov    %eax,%ecx
+  800618:	f7 d9                	neg    %ecx
+  80061a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80061d:	83 f9 14             	cmp    $0x14,%ecx
+  800620:	7f 4e                	jg     800670 <vprintfmt+0x1ec>
+  800622:	48 63 c1             	movslq %ecx,%rax
+  800625:	48 ba 20 3d 80 00 00 	movabs $0x803d20,%rdx
+  80062c:	00 00 00 
+  80062f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800633:	48 85 c0             	test   %rax,%rax
+  800636:	74 38                	je     800670 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800638:	48 89 c1             	mov    %rax,%rcx
+  80063b:	48 ba f9 3e 80 00 00 	movabs $0x803ef9,%rdx
+  800642:	00 00 00 
+  800645:	4c 89 ee             	mov    %r13,%rsi
+  800648:	4c 89 f7             	mov    %r14,%rdi
+  80064b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800650:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  800657:	00 00 00 
+  80065a:	41 ff d0             	call   *%r8
+  80065d:	e9 53 fe ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800662:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800666:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066e:	eb a4                	jmp    800614 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800670:	48 ba d7 38 80 00 00 	movabs $0x8038d7,%rdx
+  800677:	00 00 00 
+  80067a:	4c 89 ee             	mov    %r13,%rsi
+  80067d:	4c 89 f7             	mov    %r14,%rdi
+  800680:	b8 00 00 00 00       	mov    $0x0,%eax
+  800685:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  80068c:	00 00 00 
+  80068f:	41 ff d0             	call   *%r8
+  800692:	e9 1e fe ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800697:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069a:	83 f8 2f             	cmp    $0x2f,%eax
+  80069d:	77 6c                	ja     80070b <vprintfmt+0x287>
+  80069f:	89 c2                	mov    %eax,%edx
+  8006a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a5:	83 c0 08             	add    $0x8,%eax
+  8006a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ab:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006ae:	48 85 d2             	test   %rdx,%rdx
+  8006b1:	48 b8 d0 38 80 00 00 	movabs $0x8038d0,%rax
+  8006b8:	00 00 00 
+  8006bb:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006bf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006c3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c7:	7e 06                	jle    8006cf <vprintfmt+0x24b>
+  8006c9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006cd:	75 4a                	jne    800719 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006cf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006d3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006d7:	0f b6 00             	movzbl (%rax),%eax
+  8006da:	84 c0                	test   %al,%al
+  8006dc:	0f 85 9a 00 00 00    	jne    80077c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006e2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006e9:	85 c0                	test   %eax,%eax
+  8006eb:	0f 8e c4 fd ff ff    	jle    8004b5 <vprintfmt+0x31>
+  8006f1:	4c 89 ee             	mov    %r13,%rsi
+  8006f4:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006f9:	41 ff d6             	call   *%r14
+  8006fc:	41 83 ec 01          	sub    $0x1,%r12d
+  800700:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800704:	75 eb                	jne    8006f1 <vprintfmt+0x26d>
+  800706:	e9 aa fd ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80070b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80070f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800713:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800717:	eb 92                	jmp    8006ab <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800719:	49 63 f7             	movslq %r15d,%rsi
+  80071c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800720:	48 b8 36 0c 80 00 00 	movabs $0x800c36,%rax
+  800727:	00 00 00 
+  80072a:	ff d0                	call   *%rax
+  80072c:	48 89 c2             	mov    %rax,%rdx
+  80072f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800732:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800734:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800737:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80073a:	85 c0                	test   %eax,%eax
+  80073c:	7e 91                	jle    8006cf <vprintfmt+0x24b>
+  80073e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800743:	4c 89 ee             	mov    %r13,%rsi
+  800746:	44 89 e7             	mov    %r12d,%edi
+  800749:	41 ff d6             	call   *%r14
+  80074c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800750:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800753:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800756:	75 eb                	jne    800743 <vprintfmt+0x2bf>
+  800758:	e9 72 ff ff ff       	jmp    8006cf <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80075d:	0f b6 f8             	movzbl %al,%edi
+  800760:	4c 89 ee             	mov    %r13,%rsi
+  800763:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800766:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80076a:	49 83 c4 01          	add    $0x1,%r12
+  80076e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800774:	84 c0                	test   %al,%al
+  800776:	0f 84 66 ff ff ff    	je     8006e2 <vprintfmt+0x25e>
+  80077c:	45 85 ff             	test   %r15d,%r15d
+  80077f:	78 0a                	js     80078b <vprintfmt+0x307>
+  800781:	41 83 ef 01          	sub    $0x1,%r15d
+  800785:	0f 88 57 ff ff ff    	js     8006e2 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80078b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80078f:	74 cc                	je     80075d <vprintfmt+0x2d9>
+  800791:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800794:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800799:	80 fa 5e             	cmp    $0x5e,%dl
+  80079c:	77 c2                	ja     800760 <vprintfmt+0x2dc>
+  80079e:	eb bd                	jmp    80075d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a0:	40 84 f6             	test   %sil,%sil
+  8007a3:	75 26                	jne    8007cb <vprintfmt+0x347>
+    switch (lflag) {
+  8007a5:	85 d2                	test   %edx,%edx
+  8007a7:	74 59                	je     800802 <vprintfmt+0x37e>
+  8007a9:	83 fa 01             	cmp    $0x1,%edx
+  8007ac:	74 7b                	je     800829 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b4:	0f 87 96 00 00 00    	ja     800850 <vprintfmt+0x3cc>
+  8007ba:	89 c2                	mov    %eax,%edx
+  8007bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c0:	83 c0 08             	add    $0x8,%eax
+  8007c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c6:	4c 8b 22             	mov    (%rdx),%r12
+  8007c9:	eb 17                	jmp    8007e2 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d1:	77 21                	ja     8007f4 <vprintfmt+0x370>
+  8007d3:	89 c2                	mov    %eax,%edx
+  8007d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d9:	83 c0 08             	add    $0x8,%eax
+  8007dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007df:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007e2:	4d 85 e4             	test   %r12,%r12
+  8007e5:	78 7a                	js     800861 <vprintfmt+0x3dd>
+            num = i;
+  8007e7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007ef:	e9 50 02 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800800:	eb dd                	jmp    8007df <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	77 11                	ja     80081b <vprintfmt+0x397>
+  80080a:	89 c2                	mov    %eax,%edx
+  80080c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800810:	83 c0 08             	add    $0x8,%eax
+  800813:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800816:	4c 63 22             	movslq (%rdx),%r12
+  800819:	eb c7                	jmp    8007e2 <vprintfmt+0x35e>
+  80081b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800827:	eb ed                	jmp    800816 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800829:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082c:	83 f8 2f             	cmp    $0x2f,%eax
+  80082f:	77 11                	ja     800842 <vprintfmt+0x3be>
+  800831:	89 c2                	mov    %eax,%edx
+  800833:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800837:	83 c0 08             	add    $0x8,%eax
+  80083a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083d:	4c 8b 22             	mov    (%rdx),%r12
+  800840:	eb a0                	jmp    8007e2 <vprintfmt+0x35e>
+  800842:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800846:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084e:	eb ed                	jmp    80083d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800850:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800854:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800858:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085c:	e9 65 ff ff ff       	jmp    8007c6 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800861:	4c 89 ee             	mov    %r13,%rsi
+  800864:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800869:	41 ff d6             	call   *%r14
+                i = -i;
+  80086c:	49 f7 dc             	neg    %r12
+  80086f:	e9 73 ff ff ff       	jmp    8007e7 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800874:	40 84 f6             	test   %sil,%sil
+  800877:	75 32                	jne    8008ab <vprintfmt+0x427>
+    switch (lflag) {
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 5d                	je     8008da <vprintfmt+0x456>
+  80087d:	83 fa 01             	cmp    $0x1,%edx
+  800880:	0f 84 82 00 00 00    	je     800908 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	0f 87 a5 00 00 00    	ja     800937 <vprintfmt+0x4b3>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a6:	e9 99 01 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b1:	77 19                	ja     8008cc <vprintfmt+0x448>
+  8008b3:	89 c2                	mov    %eax,%edx
+  8008b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b9:	83 c0 08             	add    $0x8,%eax
+  8008bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c7:	e9 78 01 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+  8008cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d8:	eb e5                	jmp    8008bf <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e0:	77 18                	ja     8008fa <vprintfmt+0x476>
+  8008e2:	89 c2                	mov    %eax,%edx
+  8008e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e8:	83 c0 08             	add    $0x8,%eax
+  8008eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ee:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f5:	e9 4a 01 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+  8008fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	eb e6                	jmp    8008ee <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090b:	83 f8 2f             	cmp    $0x2f,%eax
+  80090e:	77 19                	ja     800929 <vprintfmt+0x4a5>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800924:	e9 1b 01 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+  800929:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800931:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800935:	eb e5                	jmp    80091c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800937:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800943:	e9 56 ff ff ff       	jmp    80089e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800948:	40 84 f6             	test   %sil,%sil
+  80094b:	75 2e                	jne    80097b <vprintfmt+0x4f7>
+    switch (lflag) {
+  80094d:	85 d2                	test   %edx,%edx
+  80094f:	74 59                	je     8009aa <vprintfmt+0x526>
+  800951:	83 fa 01             	cmp    $0x1,%edx
+  800954:	74 7f                	je     8009d5 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800956:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800959:	83 f8 2f             	cmp    $0x2f,%eax
+  80095c:	0f 87 9f 00 00 00    	ja     800a01 <vprintfmt+0x57d>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800971:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800976:	e9 c9 00 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80097b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097e:	83 f8 2f             	cmp    $0x2f,%eax
+  800981:	77 19                	ja     80099c <vprintfmt+0x518>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800992:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800997:	e9 a8 00 00 00       	jmp    800a44 <vprintfmt+0x5c0>
+  80099c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a8:	eb e5                	jmp    80098f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	77 15                	ja     8009c7 <vprintfmt+0x543>
+  8009b2:	89 c2                	mov    %eax,%edx
+  8009b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b8:	83 c0 08             	add    $0x8,%eax
+  8009bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009be:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009c5:	eb 7d                	jmp    800a44 <vprintfmt+0x5c0>
+  8009c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d3:	eb e9                	jmp    8009be <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009db:	77 16                	ja     8009f3 <vprintfmt+0x56f>
+  8009dd:	89 c2                	mov    %eax,%edx
+  8009df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e3:	83 c0 08             	add    $0x8,%eax
+  8009e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009ec:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f1:	eb 51                	jmp    800a44 <vprintfmt+0x5c0>
+  8009f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ff:	eb e8                	jmp    8009e9 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0d:	e9 5c ff ff ff       	jmp    80096e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a12:	4c 89 ee             	mov    %r13,%rsi
+  800a15:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a1a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a1d:	4c 89 ee             	mov    %r13,%rsi
+  800a20:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a25:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	77 47                	ja     800a77 <vprintfmt+0x5f3>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a44:	48 83 ec 08          	sub    $0x8,%rsp
+  800a48:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a4c:	0f 94 c0             	sete   %al
+  800a4f:	0f b6 c0             	movzbl %al,%eax
+  800a52:	50                   	push   %rax
+  800a53:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a58:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a5c:	4c 89 ee             	mov    %r13,%rsi
+  800a5f:	4c 89 f7             	mov    %r14,%rdi
+  800a62:	48 b8 79 03 80 00 00 	movabs $0x800379,%rax
+  800a69:	00 00 00 
+  800a6c:	ff d0                	call   *%rax
+            break;
+  800a6e:	48 83 c4 10          	add    $0x10,%rsp
+  800a72:	e9 3e fa ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a83:	eb b7                	jmp    800a3c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a85:	40 84 f6             	test   %sil,%sil
+  800a88:	75 2b                	jne    800ab5 <vprintfmt+0x631>
+    switch (lflag) {
+  800a8a:	85 d2                	test   %edx,%edx
+  800a8c:	74 56                	je     800ae4 <vprintfmt+0x660>
+  800a8e:	83 fa 01             	cmp    $0x1,%edx
+  800a91:	74 7f                	je     800b12 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a96:	83 f8 2f             	cmp    $0x2f,%eax
+  800a99:	0f 87 a2 00 00 00    	ja     800b41 <vprintfmt+0x6bd>
+  800a9f:	89 c2                	mov    %eax,%edx
+  800aa1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa5:	83 c0 08             	add    $0x8,%eax
+  800aa8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ab3:	eb 8f                	jmp    800a44 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab8:	83 f8 2f             	cmp    $0x2f,%eax
+  800abb:	77 19                	ja     800ad6 <vprintfmt+0x652>
+  800abd:	89 c2                	mov    %eax,%edx
+  800abf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac3:	83 c0 08             	add    $0x8,%eax
+  800ac6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800acc:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ad1:	e9 6e ff ff ff       	jmp    800a44 <vprintfmt+0x5c0>
+  800ad6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ada:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ade:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae2:	eb e5                	jmp    800ac9 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aea:	77 18                	ja     800b04 <vprintfmt+0x680>
+  800aec:	89 c2                	mov    %eax,%edx
+  800aee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af2:	83 c0 08             	add    $0x8,%eax
+  800af5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800afa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800aff:	e9 40 ff ff ff       	jmp    800a44 <vprintfmt+0x5c0>
+  800b04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b10:	eb e6                	jmp    800af8 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 19                	ja     800b33 <vprintfmt+0x6af>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b29:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b2e:	e9 11 ff ff ff       	jmp    800a44 <vprintfmt+0x5c0>
+  800b33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3f:	eb e5                	jmp    800b26 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4d:	e9 59 ff ff ff       	jmp    800aab <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b52:	4c 89 ee             	mov    %r13,%rsi
+  800b55:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b5a:	41 ff d6             	call   *%r14
+            break;
+  800b5d:	e9 53 f9 ff ff       	jmp    8004b5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b62:	4c 89 ee             	mov    %r13,%rsi
+  800b65:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b6a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b6d:	48 83 eb 01          	sub    $0x1,%rbx
+  800b71:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b75:	75 f6                	jne    800b6d <vprintfmt+0x6e9>
+  800b77:	e9 39 f9 ff ff       	jmp    8004b5 <vprintfmt+0x31>
+}
+  800b7c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b80:	5b                   	pop    %rbx
+  800b81:	41 5c                	pop    %r12
+  800b83:	41 5d                	pop    %r13
+  800b85:	41 5e                	pop    %r14
+  800b87:	41 5f                	pop    %r15
+  800b89:	5d                   	pop    %rbp
+  800b8a:	c3                   	ret
+
+0000000000800b8b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b8b:	55                   	push   %rbp
+  800b8c:	48 89 e5             	mov    %rsp,%rbp
+  800b8f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b93:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b97:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ba0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ba7:	48 85 ff             	test   %rdi,%rdi
+  800baa:	74 2b                	je     800bd7 <vsnprintf+0x4c>
+  800bac:	48 85 f6             	test   %rsi,%rsi
+  800baf:	74 26                	je     800bd7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bb1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bb5:	48 bf 2f 04 80 00 00 	movabs $0x80042f,%rdi
+  800bbc:	00 00 00 
+  800bbf:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bcf:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bd2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bd5:	c9                   	leave
+  800bd6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bdc:	eb f7                	jmp    800bd5 <vsnprintf+0x4a>
+
+0000000000800bde <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bde:	55                   	push   %rbp
+  800bdf:	48 89 e5             	mov    %rsp,%rbp
+  800be2:	48 83 ec 50          	sub    $0x50,%rsp
+  800be6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bf2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bf9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c01:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c05:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c09:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c0d:	48 b8 8b 0b 80 00 00 	movabs $0x800b8b,%rax
+  800c14:	00 00 00 
+  800c17:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+
+0000000000800c1b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c1b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c1e:	74 10                	je     800c30 <strlen+0x15>
+    size_t n = 0;
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c25:	48 83 c0 01          	add    $0x1,%rax
+  800c29:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c2d:	75 f6                	jne    800c25 <strlen+0xa>
+  800c2f:	c3                   	ret
+    size_t n = 0;
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c35:	c3                   	ret
+
+0000000000800c36 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c36:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c39:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c3e:	48 85 f6             	test   %rsi,%rsi
+  800c41:	74 11                	je     800c54 <strnlen+0x1e>
+  800c43:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c47:	74 0c                	je     800c55 <strnlen+0x1f>
+  800c49:	48 83 c2 01          	add    $0x1,%rdx
+  800c4d:	48 39 d0             	cmp    %rdx,%rax
+  800c50:	75 f1                	jne    800c43 <strnlen+0xd>
+  800c52:	eb 04                	jmp    800c58 <strnlen+0x22>
+  800c54:	c3                   	ret
+  800c55:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c58:	c3                   	ret
+
+0000000000800c59 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c59:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c61:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c65:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c68:	48 83 c2 01          	add    $0x1,%rdx
+  800c6c:	84 c9                	test   %cl,%cl
+  800c6e:	75 f1                	jne    800c61 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c70:	c3                   	ret
+
+0000000000800c71 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c71:	55                   	push   %rbp
+  800c72:	48 89 e5             	mov    %rsp,%rbp
+  800c75:	41 54                	push   %r12
+  800c77:	53                   	push   %rbx
+  800c78:	48 89 fb             	mov    %rdi,%rbx
+  800c7b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c7e:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  800c85:	00 00 00 
+  800c88:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c8a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c8e:	4c 89 e6             	mov    %r12,%rsi
+  800c91:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  800c98:	00 00 00 
+  800c9b:	ff d0                	call   *%rax
+    return dst;
+}
+  800c9d:	48 89 d8             	mov    %rbx,%rax
+  800ca0:	5b                   	pop    %rbx
+  800ca1:	41 5c                	pop    %r12
+  800ca3:	5d                   	pop    %rbp
+  800ca4:	c3                   	ret
+
+0000000000800ca5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ca5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ca8:	48 85 d2             	test   %rdx,%rdx
+  800cab:	74 1f                	je     800ccc <strncpy+0x27>
+  800cad:	48 01 fa             	add    %rdi,%rdx
+  800cb0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cb3:	48 83 c1 01          	add    $0x1,%rcx
+  800cb7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cbb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cbf:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cc3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cc7:	48 39 ca             	cmp    %rcx,%rdx
+  800cca:	75 e7                	jne    800cb3 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ccc:	c3                   	ret
+
+0000000000800ccd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ccd:	48 89 f8             	mov    %rdi,%rax
+  800cd0:	48 85 d2             	test   %rdx,%rdx
+  800cd3:	74 24                	je     800cf9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cd5:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd9:	74 1b                	je     800cf6 <strlcpy+0x29>
+  800cdb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cdf:	0f b6 16             	movzbl (%rsi),%edx
+  800ce2:	84 d2                	test   %dl,%dl
+  800ce4:	74 10                	je     800cf6 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ce6:	48 83 c6 01          	add    $0x1,%rsi
+  800cea:	48 83 c0 01          	add    $0x1,%rax
+  800cee:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cf1:	48 39 c8             	cmp    %rcx,%rax
+  800cf4:	75 e9                	jne    800cdf <strlcpy+0x12>
+        *dst = '\0';
+  800cf6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cf9:	48 29 f8             	sub    %rdi,%rax
+}
+  800cfc:	c3                   	ret
+
+0000000000800cfd <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cfd:	0f b6 07             	movzbl (%rdi),%eax
+  800d00:	84 c0                	test   %al,%al
+  800d02:	74 13                	je     800d17 <strcmp+0x1a>
+  800d04:	38 06                	cmp    %al,(%rsi)
+  800d06:	75 0f                	jne    800d17 <strcmp+0x1a>
+  800d08:	48 83 c7 01          	add    $0x1,%rdi
+  800d0c:	48 83 c6 01          	add    $0x1,%rsi
+  800d10:	0f b6 07             	movzbl (%rdi),%eax
+  800d13:	84 c0                	test   %al,%al
+  800d15:	75 ed                	jne    800d04 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d17:	0f b6 c0             	movzbl %al,%eax
+  800d1a:	0f b6 16             	movzbl (%rsi),%edx
+  800d1d:	29 d0                	sub    %edx,%eax
+}
+  800d1f:	c3                   	ret
+
+0000000000800d20 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d20:	48 85 d2             	test   %rdx,%rdx
+  800d23:	74 1f                	je     800d44 <strncmp+0x24>
+  800d25:	0f b6 07             	movzbl (%rdi),%eax
+  800d28:	84 c0                	test   %al,%al
+  800d2a:	74 1e                	je     800d4a <strncmp+0x2a>
+  800d2c:	3a 06                	cmp    (%rsi),%al
+  800d2e:	75 1a                	jne    800d4a <strncmp+0x2a>
+  800d30:	48 83 c7 01          	add    $0x1,%rdi
+  800d34:	48 83 c6 01          	add    $0x1,%rsi
+  800d38:	48 83 ea 01          	sub    $0x1,%rdx
+  800d3c:	75 e7                	jne    800d25 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d43:	c3                   	ret
+  800d44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d49:	c3                   	ret
+  800d4a:	48 85 d2             	test   %rdx,%rdx
+  800d4d:	74 09                	je     800d58 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d4f:	0f b6 07             	movzbl (%rdi),%eax
+  800d52:	0f b6 16             	movzbl (%rsi),%edx
+  800d55:	29 d0                	sub    %edx,%eax
+  800d57:	c3                   	ret
+    if (!n) return 0;
+  800d58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d5e:	0f b6 17             	movzbl (%rdi),%edx
+  800d61:	84 d2                	test   %dl,%dl
+  800d63:	74 18                	je     800d7d <strchr+0x1f>
+        if (*str == c) {
+  800d65:	0f be d2             	movsbl %dl,%edx
+  800d68:	39 f2                	cmp    %esi,%edx
+  800d6a:	74 17                	je     800d83 <strchr+0x25>
+    for (; *str; str++) {
+  800d6c:	48 83 c7 01          	add    $0x1,%rdi
+  800d70:	0f b6 17             	movzbl (%rdi),%edx
+  800d73:	84 d2                	test   %dl,%dl
+  800d75:	75 ee                	jne    800d65 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7c:	c3                   	ret
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d82:	c3                   	ret
+  800d83:	48 89 f8             	mov    %rdi,%rax
+}
+  800d86:	c3                   	ret
+
+0000000000800d87 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d87:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d8a:	0f b6 17             	movzbl (%rdi),%edx
+  800d8d:	84 d2                	test   %dl,%dl
+  800d8f:	74 13                	je     800da4 <strfind+0x1d>
+  800d91:	0f be d2             	movsbl %dl,%edx
+  800d94:	39 f2                	cmp    %esi,%edx
+  800d96:	74 0b                	je     800da3 <strfind+0x1c>
+  800d98:	48 83 c0 01          	add    $0x1,%rax
+  800d9c:	0f b6 10             	movzbl (%rax),%edx
+  800d9f:	84 d2                	test   %dl,%dl
+  800da1:	75 ee                	jne    800d91 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800da3:	c3                   	ret
+  800da4:	c3                   	ret
+
+0000000000800da5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800da5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800da8:	48 89 f8             	mov    %rdi,%rax
+  800dab:	48 f7 d8             	neg    %rax
+  800dae:	83 e0 07             	and    $0x7,%eax
+  800db1:	49 89 d1             	mov    %rdx,%r9
+  800db4:	49 29 c1             	sub    %rax,%r9
+  800db7:	78 36                	js     800def <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800db9:	40 0f b6 c6          	movzbl %sil,%eax
+  800dbd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dc4:	01 01 01 
+  800dc7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dcb:	40 f6 c7 07          	test   $0x7,%dil
+  800dcf:	75 38                	jne    800e09 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dd1:	4c 89 c9             	mov    %r9,%rcx
+  800dd4:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dd8:	74 0c                	je     800de6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dda:	fc                   	cld
+  800ddb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dde:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800de2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800de6:	4d 85 c9             	test   %r9,%r9
+  800de9:	75 45                	jne    800e30 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800deb:	4c 89 c0             	mov    %r8,%rax
+  800dee:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800def:	48 85 d2             	test   %rdx,%rdx
+  800df2:	74 f7                	je     800deb <memset+0x46>
+  800df4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800df7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dfa:	48 83 c0 01          	add    $0x1,%rax
+  800dfe:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e02:	48 39 c2             	cmp    %rax,%rdx
+  800e05:	75 f3                	jne    800dfa <memset+0x55>
+  800e07:	eb e2                	jmp    800deb <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e09:	40 f6 c7 01          	test   $0x1,%dil
+  800e0d:	74 06                	je     800e15 <memset+0x70>
+  800e0f:	88 07                	mov    %al,(%rdi)
+  800e11:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e15:	40 f6 c7 02          	test   $0x2,%dil
+  800e19:	74 07                	je     800e22 <memset+0x7d>
+  800e1b:	66 89 07             	mov    %ax,(%rdi)
+  800e1e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e22:	40 f6 c7 04          	test   $0x4,%dil
+  800e26:	74 a9                	je     800dd1 <memset+0x2c>
+  800e28:	89 07                	mov    %eax,(%rdi)
+  800e2a:	48 83 c7 04          	add    $0x4,%rdi
+  800e2e:	eb a1                	jmp    800dd1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e30:	41 f6 c1 04          	test   $0x4,%r9b
+  800e34:	74 06                	je     800e3c <memset+0x97>
+  800e36:	89 07                	mov    %eax,(%rdi)
+  800e38:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e3c:	41 f6 c1 02          	test   $0x2,%r9b
+  800e40:	74 07                	je     800e49 <memset+0xa4>
+  800e42:	66 89 07             	mov    %ax,(%rdi)
+  800e45:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e49:	41 f6 c1 01          	test   $0x1,%r9b
+  800e4d:	74 9c                	je     800deb <memset+0x46>
+  800e4f:	88 07                	mov    %al,(%rdi)
+  800e51:	eb 98                	jmp    800deb <memset+0x46>
+
+0000000000800e53 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e53:	48 89 f8             	mov    %rdi,%rax
+  800e56:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e59:	48 39 fe             	cmp    %rdi,%rsi
+  800e5c:	73 3b                	jae    800e99 <memmove+0x46>
+  800e5e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e62:	48 39 d7             	cmp    %rdx,%rdi
+  800e65:	73 32                	jae    800e99 <memmove+0x46>
+        s += n;
+        d += n;
+  800e67:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e6b:	48 89 d6             	mov    %rdx,%rsi
+  800e6e:	48 09 fe             	or     %rdi,%rsi
+  800e71:	48 09 ce             	or     %rcx,%rsi
+  800e74:	40 f6 c6 07          	test   $0x7,%sil
+  800e78:	75 12                	jne    800e8c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e7a:	48 83 ef 08          	sub    $0x8,%rdi
+  800e7e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e82:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e86:	fd                   	std
+  800e87:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e8a:	fc                   	cld
+  800e8b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e8c:	48 83 ef 01          	sub    $0x1,%rdi
+  800e90:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e94:	fd                   	std
+  800e95:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e97:	eb f1                	jmp    800e8a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e99:	48 89 f2             	mov    %rsi,%rdx
+  800e9c:	48 09 c2             	or     %rax,%rdx
+  800e9f:	48 09 ca             	or     %rcx,%rdx
+  800ea2:	f6 c2 07             	test   $0x7,%dl
+  800ea5:	75 0c                	jne    800eb3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ea7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eab:	48 89 c7             	mov    %rax,%rdi
+  800eae:	fc                   	cld
+  800eaf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800eb2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800eb3:	48 89 c7             	mov    %rax,%rdi
+  800eb6:	fc                   	cld
+  800eb7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eb9:	c3                   	ret
+
+0000000000800eba <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eba:	55                   	push   %rbp
+  800ebb:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ebe:	48 b8 53 0e 80 00 00 	movabs $0x800e53,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+}
+  800eca:	5d                   	pop    %rbp
+  800ecb:	c3                   	ret
+
+0000000000800ecc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+  800ed0:	41 57                	push   %r15
+  800ed2:	41 56                	push   %r14
+  800ed4:	41 55                	push   %r13
+  800ed6:	41 54                	push   %r12
+  800ed8:	53                   	push   %rbx
+  800ed9:	48 83 ec 08          	sub    $0x8,%rsp
+  800edd:	49 89 fe             	mov    %rdi,%r14
+  800ee0:	49 89 f7             	mov    %rsi,%r15
+  800ee3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ee6:	48 89 f7             	mov    %rsi,%rdi
+  800ee9:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  800ef0:	00 00 00 
+  800ef3:	ff d0                	call   *%rax
+  800ef5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ef8:	48 89 de             	mov    %rbx,%rsi
+  800efb:	4c 89 f7             	mov    %r14,%rdi
+  800efe:	48 b8 36 0c 80 00 00 	movabs $0x800c36,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+  800f0a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f0d:	48 39 c3             	cmp    %rax,%rbx
+  800f10:	74 36                	je     800f48 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f12:	48 89 d8             	mov    %rbx,%rax
+  800f15:	4c 29 e8             	sub    %r13,%rax
+  800f18:	49 39 c4             	cmp    %rax,%r12
+  800f1b:	73 31                	jae    800f4e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f1d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f22:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f26:	4c 89 fe             	mov    %r15,%rsi
+  800f29:	48 b8 ba 0e 80 00 00 	movabs $0x800eba,%rax
+  800f30:	00 00 00 
+  800f33:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f35:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f39:	48 83 c4 08          	add    $0x8,%rsp
+  800f3d:	5b                   	pop    %rbx
+  800f3e:	41 5c                	pop    %r12
+  800f40:	41 5d                	pop    %r13
+  800f42:	41 5e                	pop    %r14
+  800f44:	41 5f                	pop    %r15
+  800f46:	5d                   	pop    %rbp
+  800f47:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f48:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f4c:	eb eb                	jmp    800f39 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f4e:	48 83 eb 01          	sub    $0x1,%rbx
+  800f52:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f56:	48 89 da             	mov    %rbx,%rdx
+  800f59:	4c 89 fe             	mov    %r15,%rsi
+  800f5c:	48 b8 ba 0e 80 00 00 	movabs $0x800eba,%rax
+  800f63:	00 00 00 
+  800f66:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f68:	49 01 de             	add    %rbx,%r14
+  800f6b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f70:	eb c3                	jmp    800f35 <strlcat+0x69>
+
+0000000000800f72 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f72:	48 85 d2             	test   %rdx,%rdx
+  800f75:	74 2d                	je     800fa4 <memcmp+0x32>
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f7c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f80:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f85:	44 38 c1             	cmp    %r8b,%cl
+  800f88:	75 0f                	jne    800f99 <memcmp+0x27>
+    while (n-- > 0) {
+  800f8a:	48 83 c0 01          	add    $0x1,%rax
+  800f8e:	48 39 c2             	cmp    %rax,%rdx
+  800f91:	75 e9                	jne    800f7c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f98:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f99:	0f b6 c1             	movzbl %cl,%eax
+  800f9c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fa0:	44 29 c0             	sub    %r8d,%eax
+  800fa3:	c3                   	ret
+    return 0;
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa9:	c3                   	ret
+
+0000000000800faa <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800faa:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fae:	48 39 c7             	cmp    %rax,%rdi
+  800fb1:	73 0f                	jae    800fc2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fb3:	40 38 37             	cmp    %sil,(%rdi)
+  800fb6:	74 0e                	je     800fc6 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fb8:	48 83 c7 01          	add    $0x1,%rdi
+  800fbc:	48 39 f8             	cmp    %rdi,%rax
+  800fbf:	75 f2                	jne    800fb3 <memfind+0x9>
+  800fc1:	c3                   	ret
+  800fc2:	48 89 f8             	mov    %rdi,%rax
+  800fc5:	c3                   	ret
+  800fc6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fc9:	c3                   	ret
+
+0000000000800fca <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fca:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fcd:	0f b6 37             	movzbl (%rdi),%esi
+  800fd0:	40 80 fe 20          	cmp    $0x20,%sil
+  800fd4:	74 06                	je     800fdc <strtol+0x12>
+  800fd6:	40 80 fe 09          	cmp    $0x9,%sil
+  800fda:	75 13                	jne    800fef <strtol+0x25>
+  800fdc:	48 83 c7 01          	add    $0x1,%rdi
+  800fe0:	0f b6 37             	movzbl (%rdi),%esi
+  800fe3:	40 80 fe 20          	cmp    $0x20,%sil
+  800fe7:	74 f3                	je     800fdc <strtol+0x12>
+  800fe9:	40 80 fe 09          	cmp    $0x9,%sil
+  800fed:	74 ed                	je     800fdc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fef:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ff2:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ff5:	3c 01                	cmp    $0x1,%al
+  800ff7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ffb:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801001:	75 0f                	jne    801012 <strtol+0x48>
+  801003:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801006:	74 14                	je     80101c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801008:	85 d2                	test   %edx,%edx
+  80100a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801012:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801017:	4c 63 ca             	movslq %edx,%r9
+  80101a:	eb 36                	jmp    801052 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80101c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801020:	74 0f                	je     801031 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801022:	85 d2                	test   %edx,%edx
+  801024:	75 ec                	jne    801012 <strtol+0x48>
+        s++;
+  801026:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80102a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80102f:	eb e1                	jmp    801012 <strtol+0x48>
+        s += 2;
+  801031:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801035:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80103a:	eb d6                	jmp    801012 <strtol+0x48>
+            dig -= '0';
+  80103c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80103f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801043:	41 39 d0             	cmp    %edx,%r8d
+  801046:	7d 21                	jge    801069 <strtol+0x9f>
+        val = val * base + dig;
+  801048:	49 0f af c1          	imul   %r9,%rax
+  80104c:	0f b6 c9             	movzbl %cl,%ecx
+  80104f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801052:	48 83 c7 01          	add    $0x1,%rdi
+  801056:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80105a:	80 f9 39             	cmp    $0x39,%cl
+  80105d:	76 dd                	jbe    80103c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80105f:	80 f9 7b             	cmp    $0x7b,%cl
+  801062:	77 05                	ja     801069 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801064:	83 e9 57             	sub    $0x57,%ecx
+  801067:	eb d6                	jmp    80103f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801069:	4d 85 d2             	test   %r10,%r10
+  80106c:	74 03                	je     801071 <strtol+0xa7>
+  80106e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801071:	48 89 c2             	mov    %rax,%rdx
+  801074:	48 f7 da             	neg    %rdx
+  801077:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80107b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80107f:	c3                   	ret
+
+0000000000801080 <strrev>:
+
+void
+strrev(char *str)
+{
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+  801084:	53                   	push   %rbx
+  801085:	48 83 ec 08          	sub    $0x8,%rsp
+  801089:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80108c:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  801093:	00 00 00 
+  801096:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801098:	83 e8 01             	sub    $0x1,%eax
+  80109b:	85 c0                	test   %eax,%eax
+  80109d:	7e 22                	jle    8010c1 <strrev+0x41>
+  80109f:	48 98                	cltq
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010a6:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010aa:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010ae:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010b2:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010b5:	48 83 c2 01          	add    $0x1,%rdx
+  8010b9:	48 83 e8 01          	sub    $0x1,%rax
+  8010bd:	39 c2                	cmp    %eax,%edx
+  8010bf:	7c e5                	jl     8010a6 <strrev+0x26>
+	}
+}
+  8010c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c5:	c9                   	leave
+  8010c6:	c3                   	ret
+
+00000000008010c7 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8010c7:	85 d2                	test   %edx,%edx
+  8010c9:	0f 84 80 00 00 00    	je     80114f <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8010cf:	55                   	push   %rbp
+  8010d0:	48 89 e5             	mov    %rsp,%rbp
+  8010d3:	53                   	push   %rbx
+  8010d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8010d8:	49 89 f2             	mov    %rsi,%r10
+  8010db:	41 89 d3             	mov    %edx,%r11d
+  8010de:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8010e1:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8010e6:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8010e9:	eb 20                	jmp    80110b <itoa+0x44>
+			str[i++] = '0' + digit;
+  8010eb:	41 89 f1             	mov    %esi,%r9d
+  8010ee:	83 c2 30             	add    $0x30,%edx
+  8010f1:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8010f4:	89 f8                	mov    %edi,%eax
+  8010f6:	99                   	cltd
+  8010f7:	f7 f9                	idiv   %ecx
+  8010f9:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	74 2e                	je     80112d <itoa+0x66>
+  8010ff:	83 c6 01             	add    $0x1,%esi
+  801102:	49 83 c0 01          	add    $0x1,%r8
+  801106:	44 39 cb             	cmp    %r9d,%ebx
+  801109:	7e 15                	jle    801120 <itoa+0x59>
+		digit = sum % base;
+  80110b:	89 f8                	mov    %edi,%eax
+  80110d:	99                   	cltd
+  80110e:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801110:	83 fa 09             	cmp    $0x9,%edx
+  801113:	7e d6                	jle    8010eb <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801115:	41 89 f1             	mov    %esi,%r9d
+  801118:	83 c2 37             	add    $0x37,%edx
+  80111b:	41 88 10             	mov    %dl,(%r8)
+  80111e:	eb d4                	jmp    8010f4 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801120:	41 83 eb 01          	sub    $0x1,%r11d
+  801124:	45 39 cb             	cmp    %r9d,%r11d
+  801127:	75 04                	jne    80112d <itoa+0x66>
+  801129:	85 c0                	test   %eax,%eax
+  80112b:	75 28                	jne    801155 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80112d:	4d 63 c9             	movslq %r9d,%r9
+  801130:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801135:	4c 89 d7             	mov    %r10,%rdi
+  801138:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+	return 0;
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+  801149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+		return -1;
+  80114f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801154:	c3                   	ret
+		return -1;
+  801155:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80115a:	eb ed                	jmp    801149 <itoa+0x82>
+
+000000000080115c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+  801160:	53                   	push   %rbx
+  801161:	48 89 fa             	mov    %rdi,%rdx
+  801164:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801167:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80116c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801171:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801176:	be 00 00 00 00       	mov    $0x0,%esi
+  80117b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801181:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+
+0000000000801189 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b8:	c9                   	leave
+  8011b9:	c3                   	ret
+
+00000000008011ba <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	53                   	push   %rbx
+  8011bf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011da:	be 00 00 00 00       	mov    $0x0,%esi
+  8011df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e7:	48 85 c0             	test   %rax,%rax
+  8011ea:	7f 06                	jg     8011f2 <sys_env_destroy+0x38>
+}
+  8011ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f0:	c9                   	leave
+  8011f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f2:	49 89 c0             	mov    %rax,%r8
+  8011f5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011fa:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801201:	00 00 00 
+  801204:	be 26 00 00 00       	mov    $0x26,%esi
+  801209:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801210:	00 00 00 
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+  801218:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  80121f:	00 00 00 
+  801222:	41 ff d1             	call   *%r9
+
+0000000000801225 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80122a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80122f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801234:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801239:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801243:	be 00 00 00 00       	mov    $0x0,%esi
+  801248:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801250:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801254:	c9                   	leave
+  801255:	c3                   	ret
+
+0000000000801256 <sys_yield>:
+
+void
+sys_yield(void) {
+  801256:	55                   	push   %rbp
+  801257:	48 89 e5             	mov    %rsp,%rbp
+  80125a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801260:	ba 00 00 00 00       	mov    $0x0,%edx
+  801265:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801281:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801285:	c9                   	leave
+  801286:	c3                   	ret
+
+0000000000801287 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801287:	55                   	push   %rbp
+  801288:	48 89 e5             	mov    %rsp,%rbp
+  80128b:	53                   	push   %rbx
+  80128c:	48 89 fa             	mov    %rdi,%rdx
+  80128f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801292:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801297:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80129e:	00 00 00 
+  8012a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+
+00000000008012b9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012b9:	55                   	push   %rbp
+  8012ba:	48 89 e5             	mov    %rsp,%rbp
+  8012bd:	53                   	push   %rbx
+  8012be:	49 89 f8             	mov    %rdi,%r8
+  8012c1:	48 89 d3             	mov    %rdx,%rbx
+  8012c4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012c7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cc:	4c 89 c2             	mov    %r8,%rdx
+  8012cf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012dd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+
+00000000008012e5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012e5:	55                   	push   %rbp
+  8012e6:	48 89 e5             	mov    %rsp,%rbp
+  8012e9:	53                   	push   %rbx
+  8012ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ee:	89 f8                	mov    %edi,%eax
+  8012f0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012f3:	48 63 f9             	movslq %ecx,%rdi
+  8012f6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012fe:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801301:	be 00 00 00 00       	mov    $0x0,%esi
+  801306:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130e:	48 85 c0             	test   %rax,%rax
+  801311:	7f 06                	jg     801319 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801313:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801319:	49 89 c0             	mov    %rax,%r8
+  80131c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801321:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801328:	00 00 00 
+  80132b:	be 26 00 00 00       	mov    $0x26,%esi
+  801330:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801337:	00 00 00 
+  80133a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133f:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  801346:	00 00 00 
+  801349:	41 ff d1             	call   *%r9
+
+000000000080134c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80134c:	55                   	push   %rbp
+  80134d:	48 89 e5             	mov    %rsp,%rbp
+  801350:	53                   	push   %rbx
+  801351:	48 83 ec 08          	sub    $0x8,%rsp
+  801355:	89 f8                	mov    %edi,%eax
+  801357:	49 89 f2             	mov    %rsi,%r10
+  80135a:	48 89 cf             	mov    %rcx,%rdi
+  80135d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801360:	48 63 da             	movslq %edx,%rbx
+  801363:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801366:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801371:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801373:	48 85 c0             	test   %rax,%rax
+  801376:	7f 06                	jg     80137e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137e:	49 89 c0             	mov    %rax,%r8
+  801381:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801386:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  80138d:	00 00 00 
+  801390:	be 26 00 00 00       	mov    $0x26,%esi
+  801395:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  80139c:	00 00 00 
+  80139f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a4:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  8013ab:	00 00 00 
+  8013ae:	41 ff d1             	call   *%r9
+
+00000000008013b1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013b1:	55                   	push   %rbp
+  8013b2:	48 89 e5             	mov    %rsp,%rbp
+  8013b5:	53                   	push   %rbx
+  8013b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ba:	48 89 f1             	mov    %rsi,%rcx
+  8013bd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013da:	48 85 c0             	test   %rax,%rax
+  8013dd:	7f 06                	jg     8013e5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e5:	49 89 c0             	mov    %rax,%r8
+  8013e8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ed:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8013f4:	00 00 00 
+  8013f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013fc:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801403:	00 00 00 
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  801412:	00 00 00 
+  801415:	41 ff d1             	call   *%r9
+
+0000000000801418 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801418:	55                   	push   %rbp
+  801419:	48 89 e5             	mov    %rsp,%rbp
+  80141c:	53                   	push   %rbx
+  80141d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801421:	48 63 ce             	movslq %esi,%rcx
+  801424:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801427:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801431:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801436:	be 00 00 00 00       	mov    $0x0,%esi
+  80143b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801441:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801443:	48 85 c0             	test   %rax,%rax
+  801446:	7f 06                	jg     80144e <sys_env_set_status+0x36>
+}
+  801448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144c:	c9                   	leave
+  80144d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144e:	49 89 c0             	mov    %rax,%r8
+  801451:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801456:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  80145d:	00 00 00 
+  801460:	be 26 00 00 00       	mov    $0x26,%esi
+  801465:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  80146c:	00 00 00 
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  80147b:	00 00 00 
+  80147e:	41 ff d1             	call   *%r9
+
+0000000000801481 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801481:	55                   	push   %rbp
+  801482:	48 89 e5             	mov    %rsp,%rbp
+  801485:	53                   	push   %rbx
+  801486:	48 83 ec 08          	sub    $0x8,%rsp
+  80148a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80148d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801490:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ac:	48 85 c0             	test   %rax,%rax
+  8014af:	7f 06                	jg     8014b7 <sys_env_set_trapframe+0x36>
+}
+  8014b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b5:	c9                   	leave
+  8014b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b7:	49 89 c0             	mov    %rax,%r8
+  8014ba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014bf:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8014c6:	00 00 00 
+  8014c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ce:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  8014d5:	00 00 00 
+  8014d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dd:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  8014e4:	00 00 00 
+  8014e7:	41 ff d1             	call   *%r9
+
+00000000008014ea <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014ea:	55                   	push   %rbp
+  8014eb:	48 89 e5             	mov    %rsp,%rbp
+  8014ee:	53                   	push   %rbx
+  8014ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014f6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f9:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801503:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801508:	be 00 00 00 00       	mov    $0x0,%esi
+  80150d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801513:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801515:	48 85 c0             	test   %rax,%rax
+  801518:	7f 06                	jg     801520 <sys_env_set_pgfault_upcall+0x36>
+}
+  80151a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151e:	c9                   	leave
+  80151f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801520:	49 89 c0             	mov    %rax,%r8
+  801523:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801528:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  80152f:	00 00 00 
+  801532:	be 26 00 00 00       	mov    $0x26,%esi
+  801537:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  80153e:	00 00 00 
+  801541:	b8 00 00 00 00       	mov    $0x0,%eax
+  801546:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  80154d:	00 00 00 
+  801550:	41 ff d1             	call   *%r9
+
+0000000000801553 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801553:	55                   	push   %rbp
+  801554:	48 89 e5             	mov    %rsp,%rbp
+  801557:	53                   	push   %rbx
+  801558:	89 f8                	mov    %edi,%eax
+  80155a:	49 89 f1             	mov    %rsi,%r9
+  80155d:	48 89 d3             	mov    %rdx,%rbx
+  801560:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801563:	49 63 f0             	movslq %r8d,%rsi
+  801566:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801569:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801571:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801577:	cd 30                	int    $0x30
+}
+  801579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157d:	c9                   	leave
+  80157e:	c3                   	ret
+
+000000000080157f <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80157f:	55                   	push   %rbp
+  801580:	48 89 e5             	mov    %rsp,%rbp
+  801583:	53                   	push   %rbx
+  801584:	48 83 ec 08          	sub    $0x8,%rsp
+  801588:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80158b:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80158e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801593:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801596:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159b:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a8:	48 85 c0             	test   %rax,%rax
+  8015ab:	7f 06                	jg     8015b3 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b1:	c9                   	leave
+  8015b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b3:	49 89 c0             	mov    %rax,%r8
+  8015b6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015bb:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8015c2:	00 00 00 
+  8015c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ca:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  8015d1:	00 00 00 
+  8015d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d9:	49 b9 46 35 80 00 00 	movabs $0x803546,%r9
+  8015e0:	00 00 00 
+  8015e3:	41 ff d1             	call   *%r9
+
+00000000008015e6 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8015e6:	55                   	push   %rbp
+  8015e7:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  8015f6:	00 00 00 
+  8015f9:	ff d0                	call   *%rax
+}
+  8015fb:	5d                   	pop    %rbp
+  8015fc:	c3                   	ret
+
+00000000008015fd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015fd:	55                   	push   %rbp
+  8015fe:	48 89 e5             	mov    %rsp,%rbp
+  801601:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801602:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801611:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801616:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161b:	be 00 00 00 00       	mov    $0x0,%esi
+  801620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801626:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801628:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162c:	c9                   	leave
+  80162d:	c3                   	ret
+
+000000000080162e <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80162e:	55                   	push   %rbp
+  80162f:	48 89 e5             	mov    %rsp,%rbp
+  801632:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801633:	48 63 ce             	movslq %esi,%rcx
+  801636:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80163a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80163f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801644:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801649:	be 00 00 00 00       	mov    $0x0,%esi
+  80164e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801654:	cd 30                	int    $0x30
+}
+  801656:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165a:	c9                   	leave
+  80165b:	c3                   	ret
+
+000000000080165c <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80165c:	55                   	push   %rbp
+  80165d:	48 89 e5             	mov    %rsp,%rbp
+  801660:	53                   	push   %rbx
+  801661:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801664:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801668:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801672:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801677:	be 00 00 00 00       	mov    $0x0,%esi
+  80167c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801682:	cd 30                	int    $0x30
+}
+  801684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801688:	c9                   	leave
+  801689:	c3                   	ret
+
+000000000080168a <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80168a:	55                   	push   %rbp
+  80168b:	48 89 e5             	mov    %rsp,%rbp
+  80168e:	53                   	push   %rbx
+  80168f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801692:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801695:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ad:	cd 30                	int    $0x30
+}
+  8016af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b3:	c9                   	leave
+  8016b4:	c3                   	ret
+
+00000000008016b5 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016b5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016bc:	ff ff ff 
+  8016bf:	48 01 f8             	add    %rdi,%rax
+  8016c2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016c6:	c3                   	ret
+
+00000000008016c7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016c7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016ce:	ff ff ff 
+  8016d1:	48 01 f8             	add    %rdi,%rax
+  8016d4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016d8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016de:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016e2:	c3                   	ret
+
+00000000008016e3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	41 57                	push   %r15
+  8016e9:	41 56                	push   %r14
+  8016eb:	41 55                	push   %r13
+  8016ed:	41 54                	push   %r12
+  8016ef:	53                   	push   %rbx
+  8016f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f4:	49 89 ff             	mov    %rdi,%r15
+  8016f7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016fc:	49 bd 02 32 80 00 00 	movabs $0x803202,%r13
+  801703:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801706:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80170c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80170f:	48 89 df             	mov    %rbx,%rdi
+  801712:	41 ff d5             	call   *%r13
+  801715:	83 e0 04             	and    $0x4,%eax
+  801718:	74 17                	je     801731 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80171a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801721:	4c 39 f3             	cmp    %r14,%rbx
+  801724:	75 e6                	jne    80170c <fd_alloc+0x29>
+  801726:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80172c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801731:	4d 89 27             	mov    %r12,(%r15)
+}
+  801734:	48 83 c4 08          	add    $0x8,%rsp
+  801738:	5b                   	pop    %rbx
+  801739:	41 5c                	pop    %r12
+  80173b:	41 5d                	pop    %r13
+  80173d:	41 5e                	pop    %r14
+  80173f:	41 5f                	pop    %r15
+  801741:	5d                   	pop    %rbp
+  801742:	c3                   	ret
+
+0000000000801743 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801743:	83 ff 1f             	cmp    $0x1f,%edi
+  801746:	77 39                	ja     801781 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801748:	55                   	push   %rbp
+  801749:	48 89 e5             	mov    %rsp,%rbp
+  80174c:	41 54                	push   %r12
+  80174e:	53                   	push   %rbx
+  80174f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801752:	48 63 df             	movslq %edi,%rbx
+  801755:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80175c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801760:	48 89 df             	mov    %rbx,%rdi
+  801763:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  80176a:	00 00 00 
+  80176d:	ff d0                	call   *%rax
+  80176f:	a8 04                	test   $0x4,%al
+  801771:	74 14                	je     801787 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801773:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177c:	5b                   	pop    %rbx
+  80177d:	41 5c                	pop    %r12
+  80177f:	5d                   	pop    %rbp
+  801780:	c3                   	ret
+        return -E_INVAL;
+  801781:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801786:	c3                   	ret
+        return -E_INVAL;
+  801787:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178c:	eb ee                	jmp    80177c <fd_lookup+0x39>
+
+000000000080178e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80178e:	55                   	push   %rbp
+  80178f:	48 89 e5             	mov    %rsp,%rbp
+  801792:	41 54                	push   %r12
+  801794:	53                   	push   %rbx
+  801795:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801798:	48 b8 c0 3e 80 00 00 	movabs $0x803ec0,%rax
+  80179f:	00 00 00 
+  8017a2:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017a9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017ac:	39 3b                	cmp    %edi,(%rbx)
+  8017ae:	74 47                	je     8017f7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017b0:	48 83 c0 08          	add    $0x8,%rax
+  8017b4:	48 8b 18             	mov    (%rax),%rbx
+  8017b7:	48 85 db             	test   %rbx,%rbx
+  8017ba:	75 f0                	jne    8017ac <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017bc:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  8017c3:	00 00 00 
+  8017c6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017cc:	89 fa                	mov    %edi,%edx
+  8017ce:	48 bf 18 3e 80 00 00 	movabs $0x803e18,%rdi
+  8017d5:	00 00 00 
+  8017d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dd:	48 b9 34 03 80 00 00 	movabs $0x800334,%rcx
+  8017e4:	00 00 00 
+  8017e7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8017ee:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8017f2:	5b                   	pop    %rbx
+  8017f3:	41 5c                	pop    %r12
+  8017f5:	5d                   	pop    %rbp
+  8017f6:	c3                   	ret
+            return 0;
+  8017f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fc:	eb f0                	jmp    8017ee <dev_lookup+0x60>
+
+00000000008017fe <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8017fe:	55                   	push   %rbp
+  8017ff:	48 89 e5             	mov    %rsp,%rbp
+  801802:	41 55                	push   %r13
+  801804:	41 54                	push   %r12
+  801806:	53                   	push   %rbx
+  801807:	48 83 ec 18          	sub    $0x18,%rsp
+  80180b:	48 89 fb             	mov    %rdi,%rbx
+  80180e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801811:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801818:	ff ff ff 
+  80181b:	48 01 df             	add    %rbx,%rdi
+  80181e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801822:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801826:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+  801832:	41 89 c5             	mov    %eax,%r13d
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 06                	js     80183f <fd_close+0x41>
+  801839:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80183d:	74 1a                	je     801859 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80183f:	45 84 e4             	test   %r12b,%r12b
+  801842:	b8 00 00 00 00       	mov    $0x0,%eax
+  801847:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80184b:	44 89 e8             	mov    %r13d,%eax
+  80184e:	48 83 c4 18          	add    $0x18,%rsp
+  801852:	5b                   	pop    %rbx
+  801853:	41 5c                	pop    %r12
+  801855:	41 5d                	pop    %r13
+  801857:	5d                   	pop    %rbp
+  801858:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801859:	8b 3b                	mov    (%rbx),%edi
+  80185b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80185f:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801866:	00 00 00 
+  801869:	ff d0                	call   *%rax
+  80186b:	41 89 c5             	mov    %eax,%r13d
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	78 1b                	js     80188d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801872:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801876:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80187a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801880:	48 85 c0             	test   %rax,%rax
+  801883:	74 08                	je     80188d <fd_close+0x8f>
+  801885:	48 89 df             	mov    %rbx,%rdi
+  801888:	ff d0                	call   *%rax
+  80188a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80188d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801892:	48 89 de             	mov    %rbx,%rsi
+  801895:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189a:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+    return res;
+  8018a6:	eb a3                	jmp    80184b <fd_close+0x4d>
+
+00000000008018a8 <close>:
+
+int
+close(int fdnum) {
+  8018a8:	55                   	push   %rbp
+  8018a9:	48 89 e5             	mov    %rsp,%rbp
+  8018ac:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018b0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018b4:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  8018bb:	00 00 00 
+  8018be:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	78 15                	js     8018d9 <close+0x31>
+
+    return fd_close(fd, 1);
+  8018c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8018c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018cd:	48 b8 fe 17 80 00 00 	movabs $0x8017fe,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+}
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+00000000008018db <close_all>:
+
+void
+close_all(void) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+  8018df:	41 54                	push   %r12
+  8018e1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e7:	49 bc a8 18 80 00 00 	movabs $0x8018a8,%r12
+  8018ee:	00 00 00 
+  8018f1:	89 df                	mov    %ebx,%edi
+  8018f3:	41 ff d4             	call   *%r12
+  8018f6:	83 c3 01             	add    $0x1,%ebx
+  8018f9:	83 fb 20             	cmp    $0x20,%ebx
+  8018fc:	75 f3                	jne    8018f1 <close_all+0x16>
+}
+  8018fe:	5b                   	pop    %rbx
+  8018ff:	41 5c                	pop    %r12
+  801901:	5d                   	pop    %rbp
+  801902:	c3                   	ret
+
+0000000000801903 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801903:	55                   	push   %rbp
+  801904:	48 89 e5             	mov    %rsp,%rbp
+  801907:	41 57                	push   %r15
+  801909:	41 56                	push   %r14
+  80190b:	41 55                	push   %r13
+  80190d:	41 54                	push   %r12
+  80190f:	53                   	push   %rbx
+  801910:	48 83 ec 18          	sub    $0x18,%rsp
+  801914:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801917:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80191b:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+  801927:	89 c3                	mov    %eax,%ebx
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	0f 88 b8 00 00 00    	js     8019e9 <dup+0xe6>
+    close(newfdnum);
+  801931:	44 89 e7             	mov    %r12d,%edi
+  801934:	48 b8 a8 18 80 00 00 	movabs $0x8018a8,%rax
+  80193b:	00 00 00 
+  80193e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801940:	4d 63 ec             	movslq %r12d,%r13
+  801943:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80194a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80194e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801952:	4c 89 ff             	mov    %r15,%rdi
+  801955:	49 be c7 16 80 00 00 	movabs $0x8016c7,%r14
+  80195c:	00 00 00 
+  80195f:	41 ff d6             	call   *%r14
+  801962:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801965:	4c 89 ef             	mov    %r13,%rdi
+  801968:	41 ff d6             	call   *%r14
+  80196b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80196e:	48 89 df             	mov    %rbx,%rdi
+  801971:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  801978:	00 00 00 
+  80197b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80197d:	a8 04                	test   $0x4,%al
+  80197f:	74 2b                	je     8019ac <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801981:	41 89 c1             	mov    %eax,%r9d
+  801984:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80198a:	4c 89 f1             	mov    %r14,%rcx
+  80198d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801992:	48 89 de             	mov    %rbx,%rsi
+  801995:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199a:	48 b8 4c 13 80 00 00 	movabs $0x80134c,%rax
+  8019a1:	00 00 00 
+  8019a4:	ff d0                	call   *%rax
+  8019a6:	89 c3                	mov    %eax,%ebx
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 4e                	js     8019fa <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019ac:	4c 89 ff             	mov    %r15,%rdi
+  8019af:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+  8019bb:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019be:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019c4:	4c 89 e9             	mov    %r13,%rcx
+  8019c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019cc:	4c 89 fe             	mov    %r15,%rsi
+  8019cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d4:	48 b8 4c 13 80 00 00 	movabs $0x80134c,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+  8019e0:	89 c3                	mov    %eax,%ebx
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	78 14                	js     8019fa <dup+0xf7>
+
+    return newfdnum;
+  8019e6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019e9:	89 d8                	mov    %ebx,%eax
+  8019eb:	48 83 c4 18          	add    $0x18,%rsp
+  8019ef:	5b                   	pop    %rbx
+  8019f0:	41 5c                	pop    %r12
+  8019f2:	41 5d                	pop    %r13
+  8019f4:	41 5e                	pop    %r14
+  8019f6:	41 5f                	pop    %r15
+  8019f8:	5d                   	pop    %rbp
+  8019f9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019ff:	4c 89 ee             	mov    %r13,%rsi
+  801a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a07:	49 bc b1 13 80 00 00 	movabs $0x8013b1,%r12
+  801a0e:	00 00 00 
+  801a11:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a19:	4c 89 f6             	mov    %r14,%rsi
+  801a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a21:	41 ff d4             	call   *%r12
+    return res;
+  801a24:	eb c3                	jmp    8019e9 <dup+0xe6>
+
+0000000000801a26 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a26:	55                   	push   %rbp
+  801a27:	48 89 e5             	mov    %rsp,%rbp
+  801a2a:	41 56                	push   %r14
+  801a2c:	41 55                	push   %r13
+  801a2e:	41 54                	push   %r12
+  801a30:	53                   	push   %rbx
+  801a31:	48 83 ec 10          	sub    $0x10,%rsp
+  801a35:	89 fb                	mov    %edi,%ebx
+  801a37:	49 89 f4             	mov    %rsi,%r12
+  801a3a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a3d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a41:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 4c                	js     801a9d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a51:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a55:	41 8b 3e             	mov    (%r14),%edi
+  801a58:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5c:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801a63:	00 00 00 
+  801a66:	ff d0                	call   *%rax
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 35                	js     801aa1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a6c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a70:	83 e0 03             	and    $0x3,%eax
+  801a73:	83 f8 01             	cmp    $0x1,%eax
+  801a76:	74 2d                	je     801aa5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a7c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a80:	48 85 c0             	test   %rax,%rax
+  801a83:	74 56                	je     801adb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a85:	4c 89 ea             	mov    %r13,%rdx
+  801a88:	4c 89 e6             	mov    %r12,%rsi
+  801a8b:	4c 89 f7             	mov    %r14,%rdi
+  801a8e:	ff d0                	call   *%rax
+}
+  801a90:	48 83 c4 10          	add    $0x10,%rsp
+  801a94:	5b                   	pop    %rbx
+  801a95:	41 5c                	pop    %r12
+  801a97:	41 5d                	pop    %r13
+  801a99:	41 5e                	pop    %r14
+  801a9b:	5d                   	pop    %rbp
+  801a9c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a9d:	48 98                	cltq
+  801a9f:	eb ef                	jmp    801a90 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aa1:	48 98                	cltq
+  801aa3:	eb eb                	jmp    801a90 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aa5:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  801aac:	00 00 00 
+  801aaf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ab5:	89 da                	mov    %ebx,%edx
+  801ab7:	48 bf 79 3e 80 00 00 	movabs $0x803e79,%rdi
+  801abe:	00 00 00 
+  801ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac6:	48 b9 34 03 80 00 00 	movabs $0x800334,%rcx
+  801acd:	00 00 00 
+  801ad0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ad2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ad9:	eb b5                	jmp    801a90 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801adb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ae2:	eb ac                	jmp    801a90 <read+0x6a>
+
+0000000000801ae4 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801ae4:	55                   	push   %rbp
+  801ae5:	48 89 e5             	mov    %rsp,%rbp
+  801ae8:	41 56                	push   %r14
+  801aea:	41 55                	push   %r13
+  801aec:	41 54                	push   %r12
+  801aee:	53                   	push   %rbx
+  801aef:	48 83 ec 10          	sub    $0x10,%rsp
+  801af3:	89 fb                	mov    %edi,%ebx
+  801af5:	49 89 f4             	mov    %rsi,%r12
+  801af8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801afb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aff:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 41                	js     801b50 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b13:	41 8b 3e             	mov    (%r14),%edi
+  801b16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b1a:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 35                	js     801b5f <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b2a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b2e:	83 e0 03             	and    $0x3,%eax
+  801b31:	83 f8 01             	cmp    $0x1,%eax
+  801b34:	74 2d                	je     801b63 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b3e:	48 85 c0             	test   %rax,%rax
+  801b41:	74 56                	je     801b99 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801b43:	4c 89 ea             	mov    %r13,%rdx
+  801b46:	4c 89 e6             	mov    %r12,%rsi
+  801b49:	4c 89 f7             	mov    %r14,%rdi
+  801b4c:	ff d0                	call   *%rax
+  801b4e:	eb 02                	jmp    801b52 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b50:	48 98                	cltq
+}
+  801b52:	48 83 c4 10          	add    $0x10,%rsp
+  801b56:	5b                   	pop    %rbx
+  801b57:	41 5c                	pop    %r12
+  801b59:	41 5d                	pop    %r13
+  801b5b:	41 5e                	pop    %r14
+  801b5d:	5d                   	pop    %rbp
+  801b5e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b5f:	48 98                	cltq
+  801b61:	eb ef                	jmp    801b52 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b63:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  801b6a:	00 00 00 
+  801b6d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b73:	89 da                	mov    %ebx,%edx
+  801b75:	48 bf 38 3e 80 00 00 	movabs $0x803e38,%rdi
+  801b7c:	00 00 00 
+  801b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b84:	48 b9 34 03 80 00 00 	movabs $0x800334,%rcx
+  801b8b:	00 00 00 
+  801b8e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b90:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b97:	eb b9                	jmp    801b52 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b99:	4c 89 ea             	mov    %r13,%rdx
+  801b9c:	4c 89 e6             	mov    %r12,%rsi
+  801b9f:	89 df                	mov    %ebx,%edi
+  801ba1:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	eb a3                	jmp    801b52 <readmap+0x6e>
+
+0000000000801baf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801baf:	55                   	push   %rbp
+  801bb0:	48 89 e5             	mov    %rsp,%rbp
+  801bb3:	41 57                	push   %r15
+  801bb5:	41 56                	push   %r14
+  801bb7:	41 55                	push   %r13
+  801bb9:	41 54                	push   %r12
+  801bbb:	53                   	push   %rbx
+  801bbc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bc0:	48 85 d2             	test   %rdx,%rdx
+  801bc3:	74 54                	je     801c19 <readn+0x6a>
+  801bc5:	41 89 fd             	mov    %edi,%r13d
+  801bc8:	49 89 f6             	mov    %rsi,%r14
+  801bcb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801bce:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801bd3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801bd8:	49 bf 26 1a 80 00 00 	movabs $0x801a26,%r15
+  801bdf:	00 00 00 
+  801be2:	4c 89 e2             	mov    %r12,%rdx
+  801be5:	48 29 f2             	sub    %rsi,%rdx
+  801be8:	4c 01 f6             	add    %r14,%rsi
+  801beb:	44 89 ef             	mov    %r13d,%edi
+  801bee:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 20                	js     801c15 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bf5:	01 c3                	add    %eax,%ebx
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	74 08                	je     801c03 <readn+0x54>
+  801bfb:	48 63 f3             	movslq %ebx,%rsi
+  801bfe:	4c 39 e6             	cmp    %r12,%rsi
+  801c01:	72 df                	jb     801be2 <readn+0x33>
+    }
+    return res;
+  801c03:	48 63 c3             	movslq %ebx,%rax
+}
+  801c06:	48 83 c4 08          	add    $0x8,%rsp
+  801c0a:	5b                   	pop    %rbx
+  801c0b:	41 5c                	pop    %r12
+  801c0d:	41 5d                	pop    %r13
+  801c0f:	41 5e                	pop    %r14
+  801c11:	41 5f                	pop    %r15
+  801c13:	5d                   	pop    %rbp
+  801c14:	c3                   	ret
+        if (inc < 0) return inc;
+  801c15:	48 98                	cltq
+  801c17:	eb ed                	jmp    801c06 <readn+0x57>
+    int inc = 1, res = 0;
+  801c19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1e:	eb e3                	jmp    801c03 <readn+0x54>
+
+0000000000801c20 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c20:	55                   	push   %rbp
+  801c21:	48 89 e5             	mov    %rsp,%rbp
+  801c24:	41 56                	push   %r14
+  801c26:	41 55                	push   %r13
+  801c28:	41 54                	push   %r12
+  801c2a:	53                   	push   %rbx
+  801c2b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c2f:	89 fb                	mov    %edi,%ebx
+  801c31:	49 89 f4             	mov    %rsi,%r12
+  801c34:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c37:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c3b:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801c42:	00 00 00 
+  801c45:	ff d0                	call   *%rax
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 47                	js     801c92 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c4f:	41 8b 3e             	mov    (%r14),%edi
+  801c52:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c56:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801c5d:	00 00 00 
+  801c60:	ff d0                	call   *%rax
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	78 30                	js     801c96 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c66:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c6b:	74 2d                	je     801c9a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c71:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c75:	48 85 c0             	test   %rax,%rax
+  801c78:	74 56                	je     801cd0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c7a:	4c 89 ea             	mov    %r13,%rdx
+  801c7d:	4c 89 e6             	mov    %r12,%rsi
+  801c80:	4c 89 f7             	mov    %r14,%rdi
+  801c83:	ff d0                	call   *%rax
+}
+  801c85:	48 83 c4 10          	add    $0x10,%rsp
+  801c89:	5b                   	pop    %rbx
+  801c8a:	41 5c                	pop    %r12
+  801c8c:	41 5d                	pop    %r13
+  801c8e:	41 5e                	pop    %r14
+  801c90:	5d                   	pop    %rbp
+  801c91:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c92:	48 98                	cltq
+  801c94:	eb ef                	jmp    801c85 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c96:	48 98                	cltq
+  801c98:	eb eb                	jmp    801c85 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c9a:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  801ca1:	00 00 00 
+  801ca4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801caa:	89 da                	mov    %ebx,%edx
+  801cac:	48 bf 95 3e 80 00 00 	movabs $0x803e95,%rdi
+  801cb3:	00 00 00 
+  801cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbb:	48 b9 34 03 80 00 00 	movabs $0x800334,%rcx
+  801cc2:	00 00 00 
+  801cc5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cc7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cce:	eb b5                	jmp    801c85 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cd0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cd7:	eb ac                	jmp    801c85 <write+0x65>
+
+0000000000801cd9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801cd9:	55                   	push   %rbp
+  801cda:	48 89 e5             	mov    %rsp,%rbp
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ce8:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	78 0c                	js     801d04 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801cf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cfc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d08:	c9                   	leave
+  801d09:	c3                   	ret
+
+0000000000801d0a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d0a:	55                   	push   %rbp
+  801d0b:	48 89 e5             	mov    %rsp,%rbp
+  801d0e:	41 55                	push   %r13
+  801d10:	41 54                	push   %r12
+  801d12:	53                   	push   %rbx
+  801d13:	48 83 ec 18          	sub    $0x18,%rsp
+  801d17:	89 fb                	mov    %edi,%ebx
+  801d19:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d20:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 38                	js     801d68 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d30:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d34:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3c:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 1c                	js     801d68 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d4c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d51:	74 20                	je     801d73 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d57:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801d5b:	48 85 c0             	test   %rax,%rax
+  801d5e:	74 47                	je     801da7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d60:	44 89 e6             	mov    %r12d,%esi
+  801d63:	4c 89 ef             	mov    %r13,%rdi
+  801d66:	ff d0                	call   *%rax
+}
+  801d68:	48 83 c4 18          	add    $0x18,%rsp
+  801d6c:	5b                   	pop    %rbx
+  801d6d:	41 5c                	pop    %r12
+  801d6f:	41 5d                	pop    %r13
+  801d71:	5d                   	pop    %rbp
+  801d72:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d73:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  801d7a:	00 00 00 
+  801d7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d83:	89 da                	mov    %ebx,%edx
+  801d85:	48 bf 58 3e 80 00 00 	movabs $0x803e58,%rdi
+  801d8c:	00 00 00 
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d94:	48 b9 34 03 80 00 00 	movabs $0x800334,%rcx
+  801d9b:	00 00 00 
+  801d9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801da5:	eb c1                	jmp    801d68 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801da7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dac:	eb ba                	jmp    801d68 <ftruncate+0x5e>
+
+0000000000801dae <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	41 54                	push   %r12
+  801db4:	53                   	push   %rbx
+  801db5:	48 83 ec 10          	sub    $0x10,%rsp
+  801db9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc0:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	78 4e                	js     801e1e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801dd4:	41 8b 3c 24          	mov    (%r12),%edi
+  801dd8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ddc:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 32                	js     801e1e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df0:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801df5:	74 30                	je     801e27 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801df7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dfa:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e01:	00 00 00 
+    stat->st_isdir = 0;
+  801e04:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e0b:	00 00 00 
+    stat->st_dev = dev;
+  801e0e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e15:	48 89 de             	mov    %rbx,%rsi
+  801e18:	4c 89 e7             	mov    %r12,%rdi
+  801e1b:	ff 50 30             	call   *0x30(%rax)
+}
+  801e1e:	48 83 c4 10          	add    $0x10,%rsp
+  801e22:	5b                   	pop    %rbx
+  801e23:	41 5c                	pop    %r12
+  801e25:	5d                   	pop    %rbp
+  801e26:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e27:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e2c:	eb f0                	jmp    801e1e <fstat+0x70>
+
+0000000000801e2e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e2e:	55                   	push   %rbp
+  801e2f:	48 89 e5             	mov    %rsp,%rbp
+  801e32:	41 54                	push   %r12
+  801e34:	53                   	push   %rbx
+  801e35:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e38:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3d:	48 b8 85 2b 80 00 00 	movabs $0x802b85,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+  801e49:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 25                	js     801e74 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e4f:	4c 89 e6             	mov    %r12,%rsi
+  801e52:	89 c7                	mov    %eax,%edi
+  801e54:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+  801e60:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e63:	89 df                	mov    %ebx,%edi
+  801e65:	48 b8 a8 18 80 00 00 	movabs $0x8018a8,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+
+    return res;
+  801e71:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e74:	89 d8                	mov    %ebx,%eax
+  801e76:	5b                   	pop    %rbx
+  801e77:	41 5c                	pop    %r12
+  801e79:	5d                   	pop    %rbp
+  801e7a:	c3                   	ret
+
+0000000000801e7b <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801e7b:	55                   	push   %rbp
+  801e7c:	48 89 e5             	mov    %rsp,%rbp
+  801e7f:	41 54                	push   %r12
+  801e81:	53                   	push   %rbx
+  801e82:	48 83 ec 10          	sub    $0x10,%rsp
+  801e86:	48 89 fb             	mov    %rdi,%rbx
+  801e89:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e8c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e90:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e95:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801e9c:	00 00 00 
+  801e9f:	ff d0                	call   *%rax
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 1f                	js     801ec4 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801ea5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea9:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801ead:	48 85 c0             	test   %rax,%rax
+  801eb0:	74 1b                	je     801ecd <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801eb2:	4c 89 e6             	mov    %r12,%rsi
+  801eb5:	48 89 df             	mov    %rbx,%rdi
+  801eb8:	ff d0                	call   *%rax
+    if (res < 0) {
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ec4:	48 83 c4 10          	add    $0x10,%rsp
+  801ec8:	5b                   	pop    %rbx
+  801ec9:	41 5c                	pop    %r12
+  801ecb:	5d                   	pop    %rbp
+  801ecc:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ecd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ed2:	eb f0                	jmp    801ec4 <create_snapshot+0x49>
+
+0000000000801ed4 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801ed4:	55                   	push   %rbp
+  801ed5:	48 89 e5             	mov    %rsp,%rbp
+  801ed8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801edc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ee0:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ee5:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 1e                	js     801f13 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801ef5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef9:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801efd:	48 85 d2             	test   %rdx,%rdx
+  801f00:	74 13                	je     801f15 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f07:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f10:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f15:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f1a:	eb f7                	jmp    801f13 <print_snapshot_list+0x3f>
+
+0000000000801f1c <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801f1c:	55                   	push   %rbp
+  801f1d:	48 89 e5             	mov    %rsp,%rbp
+  801f20:	53                   	push   %rbx
+  801f21:	48 83 ec 18          	sub    $0x18,%rsp
+  801f25:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f2c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f31:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801f38:	00 00 00 
+  801f3b:	ff d0                	call   *%rax
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 1c                	js     801f5d <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f45:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801f49:	48 85 c0             	test   %rax,%rax
+  801f4c:	74 15                	je     801f63 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801f4e:	48 89 df             	mov    %rbx,%rdi
+  801f51:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f63:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f68:	eb f3                	jmp    801f5d <accept_snapshot+0x41>
+
+0000000000801f6a <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	53                   	push   %rbx
+  801f6f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f73:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f76:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f7f:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+  801f8b:	85 c0                	test   %eax,%eax
+  801f8d:	78 1c                	js     801fab <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801f8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f93:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801f97:	48 85 c0             	test   %rax,%rax
+  801f9a:	74 15                	je     801fb1 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801f9c:	48 89 df             	mov    %rbx,%rdi
+  801f9f:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa8:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801faf:	c9                   	leave
+  801fb0:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fb1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb6:	eb f3                	jmp    801fab <delete_snapshot+0x41>
+
+0000000000801fb8 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801fb8:	55                   	push   %rbp
+  801fb9:	48 89 e5             	mov    %rsp,%rbp
+  801fbc:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fc0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fc4:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc9:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 14                	js     801fed <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801fd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fdd:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801fe1:	48 85 d2             	test   %rdx,%rdx
+  801fe4:	74 09                	je     801fef <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff4:	eb f7                	jmp    801fed <gc_snapshots+0x35>
+
+0000000000801ff6 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  801ffa:	41 56                	push   %r14
+  801ffc:	41 55                	push   %r13
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	48 83 ec 10          	sub    $0x10,%rsp
+  802005:	48 89 fb             	mov    %rdi,%rbx
+  802008:	49 89 f4             	mov    %rsi,%r12
+  80200b:	49 89 d5             	mov    %rdx,%r13
+  80200e:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802011:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802015:	bf 66 00 00 00       	mov    $0x66,%edi
+  80201a:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 1b                	js     802045 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80202a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80202e:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802032:	48 85 c0             	test   %rax,%rax
+  802035:	74 1b                	je     802052 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802037:	4c 89 f1             	mov    %r14,%rcx
+  80203a:	4c 89 ea             	mov    %r13,%rdx
+  80203d:	4c 89 e6             	mov    %r12,%rsi
+  802040:	48 89 df             	mov    %rbx,%rdi
+  802043:	ff d0                	call   *%rax
+
+    return res;
+}
+  802045:	48 83 c4 10          	add    $0x10,%rsp
+  802049:	5b                   	pop    %rbx
+  80204a:	41 5c                	pop    %r12
+  80204c:	41 5d                	pop    %r13
+  80204e:	41 5e                	pop    %r14
+  802050:	5d                   	pop    %rbp
+  802051:	c3                   	ret
+        return -E_NOT_SUPP;
+  802052:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802057:	eb ec                	jmp    802045 <diff_snapshots+0x4f>
+
+0000000000802059 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802059:	55                   	push   %rbp
+  80205a:	48 89 e5             	mov    %rsp,%rbp
+  80205d:	41 55                	push   %r13
+  80205f:	41 54                	push   %r12
+  802061:	53                   	push   %rbx
+  802062:	48 83 ec 18          	sub    $0x18,%rsp
+  802066:	48 89 fb             	mov    %rdi,%rbx
+  802069:	49 89 f4             	mov    %rsi,%r12
+  80206c:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80206f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802073:	bf 66 00 00 00       	mov    $0x66,%edi
+  802078:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 18                	js     8020a0 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802088:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208c:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802090:	48 85 c0             	test   %rax,%rax
+  802093:	74 16                	je     8020ab <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802095:	4c 89 ea             	mov    %r13,%rdx
+  802098:	4c 89 e6             	mov    %r12,%rsi
+  80209b:	48 89 df             	mov    %rbx,%rdi
+  80209e:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020a0:	48 83 c4 18          	add    $0x18,%rsp
+  8020a4:	5b                   	pop    %rbx
+  8020a5:	41 5c                	pop    %r12
+  8020a7:	41 5d                	pop    %r13
+  8020a9:	5d                   	pop    %rbp
+  8020aa:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020ab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b0:	eb ee                	jmp    8020a0 <send_snapshot+0x47>
+
+00000000008020b2 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8020b2:	55                   	push   %rbp
+  8020b3:	48 89 e5             	mov    %rsp,%rbp
+  8020b6:	53                   	push   %rbx
+  8020b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8020bb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020be:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020c7:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 12                	js     8020e9 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8020d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020db:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8020df:	48 85 c0             	test   %rax,%rax
+  8020e2:	74 0b                	je     8020ef <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8020e4:	48 89 df             	mov    %rbx,%rdi
+  8020e7:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f4:	eb f3                	jmp    8020e9 <receive_snapshot+0x37>
+
+00000000008020f6 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8020f6:	55                   	push   %rbp
+  8020f7:	48 89 e5             	mov    %rsp,%rbp
+  8020fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802102:	bf 66 00 00 00       	mov    $0x66,%edi
+  802107:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 17                	js     80212e <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80211b:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802122:	48 85 d2             	test   %rdx,%rdx
+  802125:	74 09                	je     802130 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212c:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80212e:	c9                   	leave
+  80212f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802130:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802135:	eb f7                	jmp    80212e <free_space_bytes+0x38>
+
+0000000000802137 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802137:	55                   	push   %rbp
+  802138:	48 89 e5             	mov    %rsp,%rbp
+  80213b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80213f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802143:	bf 66 00 00 00       	mov    $0x66,%edi
+  802148:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+  802154:	85 c0                	test   %eax,%eax
+  802156:	78 17                	js     80216f <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802158:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80215c:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802163:	48 85 d2             	test   %rdx,%rdx
+  802166:	74 09                	je     802171 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+        return -E_NOT_SUPP;
+  802171:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802176:	eb f7                	jmp    80216f <busy_space_bytes+0x38>
+
+0000000000802178 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802178:	55                   	push   %rbp
+  802179:	48 89 e5             	mov    %rsp,%rbp
+  80217c:	41 54                	push   %r12
+  80217e:	53                   	push   %rbx
+  80217f:	48 83 ec 10          	sub    $0x10,%rsp
+  802183:	89 fb                	mov    %edi,%ebx
+  802185:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802188:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80218c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802191:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+  80219d:	85 c0                	test   %eax,%eax
+  80219f:	78 17                	js     8021b8 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8021a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a5:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8021ac:	48 85 c0             	test   %rax,%rax
+  8021af:	74 10                	je     8021c1 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8021b1:	4c 89 e6             	mov    %r12,%rsi
+  8021b4:	89 df                	mov    %ebx,%edi
+  8021b6:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8021b8:	48 83 c4 10          	add    $0x10,%rsp
+  8021bc:	5b                   	pop    %rbx
+  8021bd:	41 5c                	pop    %r12
+  8021bf:	5d                   	pop    %rbp
+  8021c0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c6:	eb f0                	jmp    8021b8 <snapshots_space+0x40>
+
+00000000008021c8 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8021c8:	55                   	push   %rbp
+  8021c9:	48 89 e5             	mov    %rsp,%rbp
+  8021cc:	41 55                	push   %r13
+  8021ce:	41 54                	push   %r12
+  8021d0:	53                   	push   %rbx
+  8021d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d5:	41 89 fd             	mov    %edi,%r13d
+  8021d8:	48 89 f3             	mov    %rsi,%rbx
+  8021db:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021de:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021e5:	00 00 00 
+  8021e8:	83 38 00             	cmpl   $0x0,(%rax)
+  8021eb:	74 57                	je     802244 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8021ed:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021f3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021f8:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8021ff:	00 00 00 
+  802202:	44 89 ee             	mov    %r13d,%esi
+  802205:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80220c:	00 00 00 
+  80220f:	8b 38                	mov    (%rax),%edi
+  802211:	48 b8 e8 36 80 00 00 	movabs $0x8036e8,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80221d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802222:	4c 89 e2             	mov    %r12,%rdx
+  802225:	48 89 de             	mov    %rbx,%rsi
+  802228:	bf 00 00 00 00       	mov    $0x0,%edi
+  80222d:	48 b8 d0 36 80 00 00 	movabs $0x8036d0,%rax
+  802234:	00 00 00 
+  802237:	ff d0                	call   *%rax
+}
+  802239:	48 83 c4 08          	add    $0x8,%rsp
+  80223d:	5b                   	pop    %rbx
+  80223e:	41 5c                	pop    %r12
+  802240:	41 5d                	pop    %r13
+  802242:	5d                   	pop    %rbp
+  802243:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802244:	bf 03 00 00 00       	mov    $0x3,%edi
+  802249:	48 b8 a6 37 80 00 00 	movabs $0x8037a6,%rax
+  802250:	00 00 00 
+  802253:	ff d0                	call   *%rax
+  802255:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80225c:	00 00 
+  80225e:	eb 8d                	jmp    8021ed <fsipc_region+0x25>
+
+0000000000802260 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802260:	55                   	push   %rbp
+  802261:	48 89 e5             	mov    %rsp,%rbp
+  802264:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802268:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80226f:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802270:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802274:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80227b:	00 00 00 
+  80227e:	ff d0                	call   *%rax
+}
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+0000000000802282 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802282:	85 ff                	test   %edi,%edi
+  802284:	78 6d                	js     8022f3 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  80228a:	41 54                	push   %r12
+  80228c:	53                   	push   %rbx
+  80228d:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802290:	48 85 f6             	test   %rsi,%rsi
+  802293:	74 57                	je     8022ec <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802295:	89 f8                	mov    %edi,%eax
+  802297:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80229e:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8022a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a5:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022aa:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  8022b1:	00 00 00 
+  8022b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	78 2d                	js     8022e7 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8022ba:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8022c1:	00 00 00 
+  8022c4:	49 63 14 24          	movslq (%r12),%rdx
+  8022c8:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8022cf:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8022d4:	48 89 df             	mov    %rbx,%rdi
+  8022d7:	48 b8 53 0e 80 00 00 	movabs $0x800e53,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8022e3:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8022e7:	5b                   	pop    %rbx
+  8022e8:	41 5c                	pop    %r12
+  8022ea:	5d                   	pop    %rbp
+  8022eb:	c3                   	ret
+        return -E_INVAL;
+  8022ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022f1:	eb f4                	jmp    8022e7 <devfile_df_snapshots+0x65>
+  8022f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022f8:	c3                   	ret
+
+00000000008022f9 <devfile_df_busy>:
+devfile_df_busy() {
+  8022f9:	55                   	push   %rbp
+  8022fa:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8022fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802302:	bf 11 00 00 00       	mov    $0x11,%edi
+  802307:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+}
+  802313:	5d                   	pop    %rbp
+  802314:	c3                   	ret
+
+0000000000802315 <devfile_df_free>:
+devfile_df_free() {
+  802315:	55                   	push   %rbp
+  802316:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802319:	be 00 00 00 00       	mov    $0x0,%esi
+  80231e:	bf 10 00 00 00       	mov    $0x10,%edi
+  802323:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80232a:	00 00 00 
+  80232d:	ff d0                	call   *%rax
+}
+  80232f:	5d                   	pop    %rbp
+  802330:	c3                   	ret
+
+0000000000802331 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802331:	55                   	push   %rbp
+  802332:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802335:	be 00 00 00 00       	mov    $0x0,%esi
+  80233a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80233f:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+}
+  80234b:	5d                   	pop    %rbp
+  80234c:	c3                   	ret
+
+000000000080234d <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802351:	be 00 00 00 00       	mov    $0x0,%esi
+  802356:	bf 09 00 00 00       	mov    $0x9,%edi
+  80235b:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802367:	85 c0                	test   %eax,%eax
+  802369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802371:	5d                   	pop    %rbp
+  802372:	c3                   	ret
+
+0000000000802373 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802373:	55                   	push   %rbp
+  802374:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802377:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80237e:	00 00 00 
+  802381:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802384:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802386:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802389:	be 00 00 00 00       	mov    $0x0,%esi
+  80238e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802393:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80239a:	00 00 00 
+  80239d:	ff d0                	call   *%rax
+}
+  80239f:	5d                   	pop    %rbp
+  8023a0:	c3                   	ret
+
+00000000008023a1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023a1:	55                   	push   %rbp
+  8023a2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023a5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023a8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023af:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023bb:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+}
+  8023c7:	5d                   	pop    %rbp
+  8023c8:	c3                   	ret
+
+00000000008023c9 <devfile_write>:
+    if (!fd || !buf) {
+  8023c9:	48 85 ff             	test   %rdi,%rdi
+  8023cc:	0f 84 c1 00 00 00    	je     802493 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023d2:	55                   	push   %rbp
+  8023d3:	48 89 e5             	mov    %rsp,%rbp
+  8023d6:	41 57                	push   %r15
+  8023d8:	41 56                	push   %r14
+  8023da:	41 55                	push   %r13
+  8023dc:	41 54                	push   %r12
+  8023de:	53                   	push   %rbx
+  8023df:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e3:	49 89 ff             	mov    %rdi,%r15
+  8023e6:	49 89 f5             	mov    %rsi,%r13
+  8023e9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023ec:	48 85 f6             	test   %rsi,%rsi
+  8023ef:	0f 84 95 00 00 00    	je     80248a <devfile_write+0xc1>
+    while (n) {
+  8023f5:	48 85 d2             	test   %rdx,%rdx
+  8023f8:	0f 84 83 00 00 00    	je     802481 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8023fe:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802405:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80240c:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80240f:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802414:	49 39 dc             	cmp    %rbx,%r12
+  802417:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80241b:	48 89 da             	mov    %rbx,%rdx
+  80241e:	4c 89 ee             	mov    %r13,%rsi
+  802421:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802428:	00 00 00 
+  80242b:	48 b8 53 0e 80 00 00 	movabs $0x800e53,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802437:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80243b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80243e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802442:	be 00 00 00 00       	mov    $0x0,%esi
+  802447:	bf 04 00 00 00       	mov    $0x4,%edi
+  80244c:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+        if (write < 0) {
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	78 21                	js     80247d <devfile_write+0xb4>
+        buf += write;
+  80245c:	48 63 d0             	movslq %eax,%rdx
+  80245f:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802462:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802465:	49 29 d4             	sub    %rdx,%r12
+  802468:	75 a5                	jne    80240f <devfile_write+0x46>
+    return totalWrite;
+  80246a:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80246e:	48 83 c4 18          	add    $0x18,%rsp
+  802472:	5b                   	pop    %rbx
+  802473:	41 5c                	pop    %r12
+  802475:	41 5d                	pop    %r13
+  802477:	41 5e                	pop    %r14
+  802479:	41 5f                	pop    %r15
+  80247b:	5d                   	pop    %rbp
+  80247c:	c3                   	ret
+            return write;
+  80247d:	48 98                	cltq
+  80247f:	eb ed                	jmp    80246e <devfile_write+0xa5>
+    int totalWrite = 0;
+  802481:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802488:	eb e0                	jmp    80246a <devfile_write+0xa1>
+        return -E_INVAL;
+  80248a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802491:	eb db                	jmp    80246e <devfile_write+0xa5>
+  802493:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80249a:	c3                   	ret
+
+000000000080249b <devfile_read>:
+    if (!fd || !buf) {
+  80249b:	48 85 ff             	test   %rdi,%rdi
+  80249e:	0f 84 c0 00 00 00    	je     802564 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+  8024a8:	41 57                	push   %r15
+  8024aa:	41 56                	push   %r14
+  8024ac:	41 55                	push   %r13
+  8024ae:	41 54                	push   %r12
+  8024b0:	53                   	push   %rbx
+  8024b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b5:	49 89 ff             	mov    %rdi,%r15
+  8024b8:	49 89 f5             	mov    %rsi,%r13
+  8024bb:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8024be:	48 85 f6             	test   %rsi,%rsi
+  8024c1:	0f 84 96 00 00 00    	je     80255d <devfile_read+0xc2>
+    while (n) {
+  8024c7:	48 85 d2             	test   %rdx,%rdx
+  8024ca:	0f 84 87 00 00 00    	je     802557 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8024d0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8024d7:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024d8:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8024df:	00 00 00 
+  8024e2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024e6:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8024e9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024ee:	49 39 c4             	cmp    %rax,%r12
+  8024f1:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8024f5:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8024f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802503:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80250a:	00 00 00 
+  80250d:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80250f:	85 c0                	test   %eax,%eax
+  802511:	7e 37                	jle    80254a <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802513:	48 63 d8             	movslq %eax,%rbx
+  802516:	48 89 da             	mov    %rbx,%rdx
+  802519:	4c 89 f6             	mov    %r14,%rsi
+  80251c:	4c 89 ef             	mov    %r13,%rdi
+  80251f:	48 b8 53 0e 80 00 00 	movabs $0x800e53,%rax
+  802526:	00 00 00 
+  802529:	ff d0                	call   *%rax
+        buf += read;
+  80252b:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80252e:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802532:	49 29 dc             	sub    %rbx,%r12
+  802535:	75 ab                	jne    8024e2 <devfile_read+0x47>
+  return totalRead;
+  802537:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80253b:	48 83 c4 18          	add    $0x18,%rsp
+  80253f:	5b                   	pop    %rbx
+  802540:	41 5c                	pop    %r12
+  802542:	41 5d                	pop    %r13
+  802544:	41 5e                	pop    %r14
+  802546:	41 5f                	pop    %r15
+  802548:	5d                   	pop    %rbp
+  802549:	c3                   	ret
+            return read ? read : totalRead;
+  80254a:	48 63 d0             	movslq %eax,%rdx
+  80254d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802551:	48 0f 45 c2          	cmovne %rdx,%rax
+  802555:	eb e4                	jmp    80253b <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802557:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80255b:	eb da                	jmp    802537 <devfile_read+0x9c>
+        return E_INVAL;
+  80255d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802562:	eb d7                	jmp    80253b <devfile_read+0xa0>
+  802564:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802569:	c3                   	ret
+
+000000000080256a <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80256a:	48 85 ff             	test   %rdi,%rdi
+  80256d:	74 5f                	je     8025ce <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80256f:	55                   	push   %rbp
+  802570:	48 89 e5             	mov    %rsp,%rbp
+  802573:	53                   	push   %rbx
+  802574:	48 83 ec 08          	sub    $0x8,%rsp
+  802578:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80257b:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+  802587:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80258d:	77 45                	ja     8025d4 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80258f:	48 89 de             	mov    %rbx,%rsi
+  802592:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802599:	00 00 00 
+  80259c:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8025a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ad:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025b2:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8025c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025cc:	c9                   	leave
+  8025cd:	c3                   	ret
+        return -E_INVAL;
+  8025ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025d3:	c3                   	ret
+        return -E_INVAL;
+  8025d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025d9:	eb ed                	jmp    8025c8 <devfile_receive_snapshot+0x5e>
+
+00000000008025db <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8025db:	55                   	push   %rbp
+  8025dc:	48 89 e5             	mov    %rsp,%rbp
+  8025df:	41 55                	push   %r13
+  8025e1:	41 54                	push   %r12
+  8025e3:	53                   	push   %rbx
+  8025e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e8:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8025eb:	48 85 f6             	test   %rsi,%rsi
+  8025ee:	0f 94 c0             	sete   %al
+  8025f1:	48 85 d2             	test   %rdx,%rdx
+  8025f4:	0f 94 c2             	sete   %dl
+  8025f7:	08 d0                	or     %dl,%al
+  8025f9:	0f 85 ad 00 00 00    	jne    8026ac <devfile_send_snapshot+0xd1>
+  8025ff:	48 89 fb             	mov    %rdi,%rbx
+  802602:	49 89 f4             	mov    %rsi,%r12
+  802605:	48 85 ff             	test   %rdi,%rdi
+  802608:	0f 84 9e 00 00 00    	je     8026ac <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80260e:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802615:	00 00 00 
+  802618:	ff d0                	call   *%rax
+  80261a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802620:	0f 87 8d 00 00 00    	ja     8026b3 <devfile_send_snapshot+0xd8>
+  802626:	4c 89 e7             	mov    %r12,%rdi
+  802629:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+  802635:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80263b:	77 7d                	ja     8026ba <devfile_send_snapshot+0xdf>
+  80263d:	4c 89 ef             	mov    %r13,%rdi
+  802640:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+  80264c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802652:	77 6d                	ja     8026c1 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802654:	48 89 de             	mov    %rbx,%rsi
+  802657:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80265e:	00 00 00 
+  802661:	48 bb 59 0c 80 00 00 	movabs $0x800c59,%rbx
+  802668:	00 00 00 
+  80266b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80266d:	4c 89 e6             	mov    %r12,%rsi
+  802670:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802677:	00 00 00 
+  80267a:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80267c:	4c 89 ee             	mov    %r13,%rsi
+  80267f:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802686:	00 00 00 
+  802689:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  80268b:	be 00 00 00 00       	mov    $0x0,%esi
+  802690:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802695:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+}
+  8026a1:	48 83 c4 08          	add    $0x8,%rsp
+  8026a5:	5b                   	pop    %rbx
+  8026a6:	41 5c                	pop    %r12
+  8026a8:	41 5d                	pop    %r13
+  8026aa:	5d                   	pop    %rbp
+  8026ab:	c3                   	ret
+        return -E_INVAL;
+  8026ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b1:	eb ee                	jmp    8026a1 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8026b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b8:	eb e7                	jmp    8026a1 <devfile_send_snapshot+0xc6>
+  8026ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026bf:	eb e0                	jmp    8026a1 <devfile_send_snapshot+0xc6>
+  8026c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c6:	eb d9                	jmp    8026a1 <devfile_send_snapshot+0xc6>
+
+00000000008026c8 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8026c8:	48 85 ff             	test   %rdi,%rdi
+  8026cb:	0f 84 41 01 00 00    	je     802812 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8026d1:	55                   	push   %rbp
+  8026d2:	48 89 e5             	mov    %rsp,%rbp
+  8026d5:	41 57                	push   %r15
+  8026d7:	41 56                	push   %r14
+  8026d9:	41 55                	push   %r13
+  8026db:	41 54                	push   %r12
+  8026dd:	53                   	push   %rbx
+  8026de:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e2:	49 89 fc             	mov    %rdi,%r12
+  8026e5:	49 89 f5             	mov    %rsi,%r13
+  8026e8:	48 89 d3             	mov    %rdx,%rbx
+  8026eb:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8026ee:	48 85 f6             	test   %rsi,%rsi
+  8026f1:	0f 84 ff 00 00 00    	je     8027f6 <devfile_diff_snapshots+0x12e>
+  8026f7:	48 85 d2             	test   %rdx,%rdx
+  8026fa:	0f 84 fd 00 00 00    	je     8027fd <devfile_diff_snapshots+0x135>
+  802700:	48 85 c9             	test   %rcx,%rcx
+  802703:	0f 84 f4 00 00 00    	je     8027fd <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802709:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80271b:	0f 87 e3 00 00 00    	ja     802804 <devfile_diff_snapshots+0x13c>
+  802721:	4c 89 ef             	mov    %r13,%rdi
+  802724:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802736:	0f 87 cf 00 00 00    	ja     80280b <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80273c:	4c 89 e6             	mov    %r12,%rsi
+  80273f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802746:	00 00 00 
+  802749:	4c 89 e7             	mov    %r12,%rdi
+  80274c:	49 bf 59 0c 80 00 00 	movabs $0x800c59,%r15
+  802753:	00 00 00 
+  802756:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802759:	4c 89 ee             	mov    %r13,%rsi
+  80275c:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802763:	00 
+  802764:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802767:	48 8b 03             	mov    (%rbx),%rax
+  80276a:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802771:	00 
+  802772:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802776:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80277d:	00 
+  80277e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802782:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802789:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  80278a:	be 00 00 00 00       	mov    $0x0,%esi
+  80278f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802794:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	78 43                	js     8027e7 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8027a4:	49 8b 04 24          	mov    (%r12),%rax
+  8027a8:	48 89 03             	mov    %rax,(%rbx)
+  8027ab:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8027b0:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8027b4:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8027b9:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8027bd:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8027c2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8027c6:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8027ca:	48 c1 e2 03          	shl    $0x3,%rdx
+  8027ce:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8027d3:	4c 89 f7             	mov    %r14,%rdi
+  8027d6:	48 b8 53 0e 80 00 00 	movabs $0x800e53,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8027e2:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8027e7:	48 83 c4 08          	add    $0x8,%rsp
+  8027eb:	5b                   	pop    %rbx
+  8027ec:	41 5c                	pop    %r12
+  8027ee:	41 5d                	pop    %r13
+  8027f0:	41 5e                	pop    %r14
+  8027f2:	41 5f                	pop    %r15
+  8027f4:	5d                   	pop    %rbp
+  8027f5:	c3                   	ret
+        return -E_INVAL;
+  8027f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027fb:	eb ea                	jmp    8027e7 <devfile_diff_snapshots+0x11f>
+  8027fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802802:	eb e3                	jmp    8027e7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802804:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802809:	eb dc                	jmp    8027e7 <devfile_diff_snapshots+0x11f>
+  80280b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802810:	eb d5                	jmp    8027e7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802812:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802817:	c3                   	ret
+
+0000000000802818 <devfile_delete_snapshot>:
+    if (!name) {
+  802818:	48 85 ff             	test   %rdi,%rdi
+  80281b:	74 5f                	je     80287c <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80281d:	55                   	push   %rbp
+  80281e:	48 89 e5             	mov    %rsp,%rbp
+  802821:	53                   	push   %rbx
+  802822:	48 83 ec 08          	sub    $0x8,%rsp
+  802826:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802829:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+  802835:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80283b:	77 45                	ja     802882 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80283d:	48 89 de             	mov    %rbx,%rsi
+  802840:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802847:	00 00 00 
+  80284a:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802856:	be 00 00 00 00       	mov    $0x0,%esi
+  80285b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802860:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802867:	00 00 00 
+  80286a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802873:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802876:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+        return -E_INVAL;
+  80287c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802881:	c3                   	ret
+        return -E_INVAL;
+  802882:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802887:	eb ed                	jmp    802876 <devfile_delete_snapshot+0x5e>
+
+0000000000802889 <devfile_accept_snapshot>:
+    if (!name) {
+  802889:	48 85 ff             	test   %rdi,%rdi
+  80288c:	74 5f                	je     8028ed <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80288e:	55                   	push   %rbp
+  80288f:	48 89 e5             	mov    %rsp,%rbp
+  802892:	53                   	push   %rbx
+  802893:	48 83 ec 08          	sub    $0x8,%rsp
+  802897:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80289a:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028ac:	77 45                	ja     8028f3 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8028ae:	48 89 de             	mov    %rbx,%rsi
+  8028b1:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8028b8:	00 00 00 
+  8028bb:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8028c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8028d1:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+        return -E_INVAL;
+  8028ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028f2:	c3                   	ret
+        return -E_INVAL;
+  8028f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028f8:	eb ed                	jmp    8028e7 <devfile_accept_snapshot+0x5e>
+
+00000000008028fa <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8028fa:	48 85 ff             	test   %rdi,%rdi
+  8028fd:	0f 84 9f 00 00 00    	je     8029a2 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802903:	55                   	push   %rbp
+  802904:	48 89 e5             	mov    %rsp,%rbp
+  802907:	41 54                	push   %r12
+  802909:	53                   	push   %rbx
+  80290a:	48 89 fb             	mov    %rdi,%rbx
+  80290d:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802910:	48 85 f6             	test   %rsi,%rsi
+  802913:	74 78                	je     80298d <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802915:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  80291c:	00 00 00 
+  80291f:	ff d0                	call   *%rax
+  802921:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802927:	77 6b                	ja     802994 <devfile_create_snapshot+0x9a>
+  802929:	4c 89 e7             	mov    %r12,%rdi
+  80292c:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802933:	00 00 00 
+  802936:	ff d0                	call   *%rax
+  802938:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80293e:	77 5b                	ja     80299b <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802940:	48 89 de             	mov    %rbx,%rsi
+  802943:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80294a:	00 00 00 
+  80294d:	48 bb 59 0c 80 00 00 	movabs $0x800c59,%rbx
+  802954:	00 00 00 
+  802957:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802959:	4c 89 e6             	mov    %r12,%rsi
+  80295c:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802963:	00 00 00 
+  802966:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802968:	be 00 00 00 00       	mov    $0x0,%esi
+  80296d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802972:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80297e:	85 c0                	test   %eax,%eax
+  802980:	ba 00 00 00 00       	mov    $0x0,%edx
+  802985:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802988:	5b                   	pop    %rbx
+  802989:	41 5c                	pop    %r12
+  80298b:	5d                   	pop    %rbp
+  80298c:	c3                   	ret
+        return -E_INVAL;
+  80298d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802992:	eb f4                	jmp    802988 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802994:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802999:	eb ed                	jmp    802988 <devfile_create_snapshot+0x8e>
+  80299b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a0:	eb e6                	jmp    802988 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8029a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029a7:	c3                   	ret
+
+00000000008029a8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	41 54                	push   %r12
+  8029ae:	53                   	push   %rbx
+  8029af:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029b2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8029b5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8029bc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8029be:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8029c8:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  8029cf:	00 00 00 
+  8029d2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 3d                	js     802a15 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8029d8:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8029df:	00 00 00 
+  8029e2:	4c 89 e6             	mov    %r12,%rsi
+  8029e5:	48 89 df             	mov    %rbx,%rdi
+  8029e8:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8029f4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8029fb:	00 
+  8029fc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a02:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a09:	00 
+  802a0a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a15:	5b                   	pop    %rbx
+  802a16:	41 5c                	pop    %r12
+  802a18:	5d                   	pop    %rbp
+  802a19:	c3                   	ret
+
+0000000000802a1a <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	41 57                	push   %r15
+  802a20:	41 56                	push   %r14
+  802a22:	41 55                	push   %r13
+  802a24:	41 54                	push   %r12
+  802a26:	53                   	push   %rbx
+  802a27:	48 83 ec 38          	sub    $0x38,%rsp
+  802a2b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802a2f:	49 89 f5             	mov    %rsi,%r13
+  802a32:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a35:	48 89 f0             	mov    %rsi,%rax
+  802a38:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a3d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a41:	75 4f                	jne    802a92 <devfile_readmap+0x78>
+  802a43:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a47:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a4d:	75 1f                	jne    802a6e <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802a4f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a53:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a57:	49 be 02 32 80 00 00 	movabs $0x803202,%r14
+  802a5e:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a61:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802a68:	0f 87 9d 00 00 00    	ja     802b0b <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802a6e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a72:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802a76:	4d 85 ff             	test   %r15,%r15
+  802a79:	0f 85 cf 00 00 00    	jne    802b4e <devfile_readmap+0x134>
+  802a7f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802a83:	48 83 c4 38          	add    $0x38,%rsp
+  802a87:	5b                   	pop    %rbx
+  802a88:	41 5c                	pop    %r12
+  802a8a:	41 5d                	pop    %r13
+  802a8c:	41 5e                	pop    %r14
+  802a8e:	41 5f                	pop    %r15
+  802a90:	5d                   	pop    %rbp
+  802a91:	c3                   	ret
+    size_t totalRead = 0;
+  802a92:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802a99:	00 
+  802a9a:	eb da                	jmp    802a76 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a9c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802aa0:	8b 40 0c             	mov    0xc(%rax),%eax
+  802aa3:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802aaa:	00 00 00 
+  802aad:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802aaf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab3:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802ab7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802abb:	4c 89 ee             	mov    %r13,%rsi
+  802abe:	bf 14 00 00 00       	mov    $0x14,%edi
+  802ac3:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802aca:	00 00 00 
+  802acd:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	7e a3                	jle    802a76 <devfile_readmap+0x5c>
+  802ad3:	48 98                	cltq
+  802ad5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802ad9:	72 9b                	jb     802a76 <devfile_readmap+0x5c>
+        buf += read;
+  802adb:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802ade:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802ae1:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ae5:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802aec:	75 88                	jne    802a76 <devfile_readmap+0x5c>
+  802aee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802af2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802af8:	0f 85 78 ff ff ff    	jne    802a76 <devfile_readmap+0x5c>
+  802afe:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802b05:	0f 86 6b ff ff ff    	jbe    802a76 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802b0b:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802b11:	4d 39 e7             	cmp    %r12,%r15
+  802b14:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802b18:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802b1f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b23:	0f 84 73 ff ff ff    	je     802a9c <devfile_readmap+0x82>
+  802b29:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b2d:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802b32:	41 ff d6             	call   *%r14
+  802b35:	a8 40                	test   $0x40,%al
+  802b37:	0f 85 39 ff ff ff    	jne    802a76 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b3d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b44:	4c 39 e3             	cmp    %r12,%rbx
+  802b47:	72 e4                	jb     802b2d <devfile_readmap+0x113>
+  802b49:	e9 4e ff ff ff       	jmp    802a9c <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802b4e:	4c 89 fa             	mov    %r15,%rdx
+  802b51:	4c 89 ee             	mov    %r13,%rsi
+  802b54:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b58:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802b5f:	00 00 00 
+  802b62:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802b64:	48 85 c0             	test   %rax,%rax
+  802b67:	78 0c                	js     802b75 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802b69:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b6d:	48 01 f0             	add    %rsi,%rax
+  802b70:	e9 0e ff ff ff       	jmp    802a83 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802b75:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b79:	48 85 f6             	test   %rsi,%rsi
+  802b7c:	48 0f 45 c6          	cmovne %rsi,%rax
+  802b80:	e9 fe fe ff ff       	jmp    802a83 <devfile_readmap+0x69>
+
+0000000000802b85 <open>:
+open(const char *path, int mode) {
+  802b85:	55                   	push   %rbp
+  802b86:	48 89 e5             	mov    %rsp,%rbp
+  802b89:	41 55                	push   %r13
+  802b8b:	41 54                	push   %r12
+  802b8d:	53                   	push   %rbx
+  802b8e:	48 83 ec 18          	sub    $0x18,%rsp
+  802b92:	49 89 fc             	mov    %rdi,%r12
+  802b95:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b98:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  802b9f:	00 00 00 
+  802ba2:	ff d0                	call   *%rax
+  802ba4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802baa:	0f 87 8a 00 00 00    	ja     802c3a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bb0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bb4:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+  802bc0:	89 c3                	mov    %eax,%ebx
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 50                	js     802c16 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802bc6:	4c 89 e6             	mov    %r12,%rsi
+  802bc9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802bd0:	00 00 00 
+  802bd3:	48 89 df             	mov    %rbx,%rdi
+  802bd6:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802be2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802be9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802bed:	bf 01 00 00 00       	mov    $0x1,%edi
+  802bf2:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+  802bfe:	89 c3                	mov    %eax,%ebx
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 1f                	js     802c23 <open+0x9e>
+    return fd2num(fd);
+  802c04:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c08:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	89 c3                	mov    %eax,%ebx
+}
+  802c16:	89 d8                	mov    %ebx,%eax
+  802c18:	48 83 c4 18          	add    $0x18,%rsp
+  802c1c:	5b                   	pop    %rbx
+  802c1d:	41 5c                	pop    %r12
+  802c1f:	41 5d                	pop    %r13
+  802c21:	5d                   	pop    %rbp
+  802c22:	c3                   	ret
+        fd_close(fd, 0);
+  802c23:	be 00 00 00 00       	mov    $0x0,%esi
+  802c28:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c2c:	48 b8 fe 17 80 00 00 	movabs $0x8017fe,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+        return res;
+  802c38:	eb dc                	jmp    802c16 <open+0x91>
+        return -E_BAD_PATH;
+  802c3a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802c3f:	eb d5                	jmp    802c16 <open+0x91>
+
+0000000000802c41 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802c41:	55                   	push   %rbp
+  802c42:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802c45:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4a:	bf 13 00 00 00       	mov    $0x13,%edi
+  802c4f:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802c56:	00 00 00 
+  802c59:	ff d0                	call   *%rax
+}
+  802c5b:	5d                   	pop    %rbp
+  802c5c:	c3                   	ret
+
+0000000000802c5d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c5d:	55                   	push   %rbp
+  802c5e:	48 89 e5             	mov    %rsp,%rbp
+  802c61:	41 54                	push   %r12
+  802c63:	53                   	push   %rbx
+  802c64:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c67:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802c6e:	00 00 00 
+  802c71:	ff d0                	call   *%rax
+  802c73:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802c76:	48 be e0 3e 80 00 00 	movabs $0x803ee0,%rsi
+  802c7d:	00 00 00 
+  802c80:	48 89 df             	mov    %rbx,%rdi
+  802c83:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  802c8a:	00 00 00 
+  802c8d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802c8f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c94:	41 2b 04 24          	sub    (%r12),%eax
+  802c98:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802c9e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ca5:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ca8:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802caf:	00 00 00 
+  802cb2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	5b                   	pop    %rbx
+  802cbf:	41 5c                	pop    %r12
+  802cc1:	5d                   	pop    %rbp
+  802cc2:	c3                   	ret
+
+0000000000802cc3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802cc3:	55                   	push   %rbp
+  802cc4:	48 89 e5             	mov    %rsp,%rbp
+  802cc7:	41 54                	push   %r12
+  802cc9:	53                   	push   %rbx
+  802cca:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802ccd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cd2:	48 89 fe             	mov    %rdi,%rsi
+  802cd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cda:	49 bc b1 13 80 00 00 	movabs $0x8013b1,%r12
+  802ce1:	00 00 00 
+  802ce4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802ce7:	48 89 df             	mov    %rbx,%rdi
+  802cea:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+  802cf6:	48 89 c6             	mov    %rax,%rsi
+  802cf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d03:	41 ff d4             	call   *%r12
+}
+  802d06:	5b                   	pop    %rbx
+  802d07:	41 5c                	pop    %r12
+  802d09:	5d                   	pop    %rbp
+  802d0a:	c3                   	ret
+
+0000000000802d0b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	41 57                	push   %r15
+  802d11:	41 56                	push   %r14
+  802d13:	41 55                	push   %r13
+  802d15:	41 54                	push   %r12
+  802d17:	53                   	push   %rbx
+  802d18:	48 83 ec 18          	sub    $0x18,%rsp
+  802d1c:	49 89 fc             	mov    %rdi,%r12
+  802d1f:	49 89 f5             	mov    %rsi,%r13
+  802d22:	49 89 d7             	mov    %rdx,%r15
+  802d25:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d29:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802d30:	00 00 00 
+  802d33:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802d35:	4d 85 ff             	test   %r15,%r15
+  802d38:	0f 84 af 00 00 00    	je     802ded <devpipe_write+0xe2>
+  802d3e:	48 89 c3             	mov    %rax,%rbx
+  802d41:	4c 89 f8             	mov    %r15,%rax
+  802d44:	4d 89 ef             	mov    %r13,%r15
+  802d47:	4c 01 e8             	add    %r13,%rax
+  802d4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d4e:	49 bd b9 12 80 00 00 	movabs $0x8012b9,%r13
+  802d55:	00 00 00 
+            sys_yield();
+  802d58:	49 be 56 12 80 00 00 	movabs $0x801256,%r14
+  802d5f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802d62:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d65:	48 63 ce             	movslq %esi,%rcx
+  802d68:	48 63 03             	movslq (%rbx),%rax
+  802d6b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802d71:	48 39 c1             	cmp    %rax,%rcx
+  802d74:	72 2e                	jb     802da4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d76:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d7b:	48 89 da             	mov    %rbx,%rdx
+  802d7e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d83:	4c 89 e7             	mov    %r12,%rdi
+  802d86:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d89:	85 c0                	test   %eax,%eax
+  802d8b:	74 66                	je     802df3 <devpipe_write+0xe8>
+            sys_yield();
+  802d8d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802d90:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d93:	48 63 ce             	movslq %esi,%rcx
+  802d96:	48 63 03             	movslq (%rbx),%rax
+  802d99:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802d9f:	48 39 c1             	cmp    %rax,%rcx
+  802da2:	73 d2                	jae    802d76 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802da4:	41 0f b6 3f          	movzbl (%r15),%edi
+  802da8:	48 89 ca             	mov    %rcx,%rdx
+  802dab:	48 c1 ea 03          	shr    $0x3,%rdx
+  802daf:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802db6:	08 10 20 
+  802db9:	48 f7 e2             	mul    %rdx
+  802dbc:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dc0:	48 89 d0             	mov    %rdx,%rax
+  802dc3:	48 c1 e0 09          	shl    $0x9,%rax
+  802dc7:	48 29 d0             	sub    %rdx,%rax
+  802dca:	48 c1 e0 03          	shl    $0x3,%rax
+  802dce:	48 29 c1             	sub    %rax,%rcx
+  802dd1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802dd6:	83 c6 01             	add    $0x1,%esi
+  802dd9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ddc:	49 83 c7 01          	add    $0x1,%r15
+  802de0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802de4:	49 39 c7             	cmp    %rax,%r15
+  802de7:	0f 85 75 ff ff ff    	jne    802d62 <devpipe_write+0x57>
+    return n;
+  802ded:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802df1:	eb 05                	jmp    802df8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802df3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802df8:	48 83 c4 18          	add    $0x18,%rsp
+  802dfc:	5b                   	pop    %rbx
+  802dfd:	41 5c                	pop    %r12
+  802dff:	41 5d                	pop    %r13
+  802e01:	41 5e                	pop    %r14
+  802e03:	41 5f                	pop    %r15
+  802e05:	5d                   	pop    %rbp
+  802e06:	c3                   	ret
+
+0000000000802e07 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e07:	55                   	push   %rbp
+  802e08:	48 89 e5             	mov    %rsp,%rbp
+  802e0b:	41 57                	push   %r15
+  802e0d:	41 56                	push   %r14
+  802e0f:	41 55                	push   %r13
+  802e11:	41 54                	push   %r12
+  802e13:	53                   	push   %rbx
+  802e14:	48 83 ec 18          	sub    $0x18,%rsp
+  802e18:	49 89 fc             	mov    %rdi,%r12
+  802e1b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e1f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e23:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802e2a:	00 00 00 
+  802e2d:	ff d0                	call   *%rax
+  802e2f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e32:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e38:	49 bd b9 12 80 00 00 	movabs $0x8012b9,%r13
+  802e3f:	00 00 00 
+            sys_yield();
+  802e42:	49 be 56 12 80 00 00 	movabs $0x801256,%r14
+  802e49:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802e4c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802e51:	74 7d                	je     802ed0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e53:	8b 03                	mov    (%rbx),%eax
+  802e55:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e58:	75 26                	jne    802e80 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802e5a:	4d 85 ff             	test   %r15,%r15
+  802e5d:	75 77                	jne    802ed6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e5f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e64:	48 89 da             	mov    %rbx,%rdx
+  802e67:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e6c:	4c 89 e7             	mov    %r12,%rdi
+  802e6f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	74 72                	je     802ee8 <devpipe_read+0xe1>
+            sys_yield();
+  802e76:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e79:	8b 03                	mov    (%rbx),%eax
+  802e7b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e7e:	74 df                	je     802e5f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e80:	48 63 c8             	movslq %eax,%rcx
+  802e83:	48 89 ca             	mov    %rcx,%rdx
+  802e86:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e8a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802e91:	08 10 20 
+  802e94:	48 89 d0             	mov    %rdx,%rax
+  802e97:	48 f7 e6             	mul    %rsi
+  802e9a:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e9e:	48 89 d0             	mov    %rdx,%rax
+  802ea1:	48 c1 e0 09          	shl    $0x9,%rax
+  802ea5:	48 29 d0             	sub    %rdx,%rax
+  802ea8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802eaf:	00 
+  802eb0:	48 89 c8             	mov    %rcx,%rax
+  802eb3:	48 29 d0             	sub    %rdx,%rax
+  802eb6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802ebb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ebf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802ec3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ec6:	49 83 c7 01          	add    $0x1,%r15
+  802eca:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802ece:	75 83                	jne    802e53 <devpipe_read+0x4c>
+    return n;
+  802ed0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed4:	eb 03                	jmp    802ed9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802ed6:	4c 89 f8             	mov    %r15,%rax
+}
+  802ed9:	48 83 c4 18          	add    $0x18,%rsp
+  802edd:	5b                   	pop    %rbx
+  802ede:	41 5c                	pop    %r12
+  802ee0:	41 5d                	pop    %r13
+  802ee2:	41 5e                	pop    %r14
+  802ee4:	41 5f                	pop    %r15
+  802ee6:	5d                   	pop    %rbp
+  802ee7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eed:	eb ea                	jmp    802ed9 <devpipe_read+0xd2>
+
+0000000000802eef <pipe>:
+pipe(int pfd[2]) {
+  802eef:	55                   	push   %rbp
+  802ef0:	48 89 e5             	mov    %rsp,%rbp
+  802ef3:	41 55                	push   %r13
+  802ef5:	41 54                	push   %r12
+  802ef7:	53                   	push   %rbx
+  802ef8:	48 83 ec 18          	sub    $0x18,%rsp
+  802efc:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802eff:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f03:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+  802f0f:	89 c3                	mov    %eax,%ebx
+  802f11:	85 c0                	test   %eax,%eax
+  802f13:	0f 88 a0 01 00 00    	js     8030b9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f19:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f23:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2c:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+  802f38:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f3a:	85 c0                	test   %eax,%eax
+  802f3c:	0f 88 77 01 00 00    	js     8030b9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f42:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802f46:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  802f4d:	00 00 00 
+  802f50:	ff d0                	call   *%rax
+  802f52:	89 c3                	mov    %eax,%ebx
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	0f 88 43 01 00 00    	js     80309f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802f5c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f66:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6f:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  802f76:	00 00 00 
+  802f79:	ff d0                	call   *%rax
+  802f7b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	0f 88 1a 01 00 00    	js     80309f <pipe+0x1b0>
+    va = fd2data(fd0);
+  802f85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f89:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802f90:	00 00 00 
+  802f93:	ff d0                	call   *%rax
+  802f95:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802f98:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa2:	48 89 c6             	mov    %rax,%rsi
+  802fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802faa:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  802fb1:	00 00 00 
+  802fb4:	ff d0                	call   *%rax
+  802fb6:	89 c3                	mov    %eax,%ebx
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	0f 88 c5 00 00 00    	js     803085 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802fc0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802fc4:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802fcb:	00 00 00 
+  802fce:	ff d0                	call   *%rax
+  802fd0:	48 89 c1             	mov    %rax,%rcx
+  802fd3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802fd9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe4:	4c 89 ee             	mov    %r13,%rsi
+  802fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fec:	48 b8 4c 13 80 00 00 	movabs $0x80134c,%rax
+  802ff3:	00 00 00 
+  802ff6:	ff d0                	call   *%rax
+  802ff8:	89 c3                	mov    %eax,%ebx
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	78 6e                	js     80306c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ffe:	be 00 10 00 00       	mov    $0x1000,%esi
+  803003:	4c 89 ef             	mov    %r13,%rdi
+  803006:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+  803012:	83 f8 02             	cmp    $0x2,%eax
+  803015:	0f 85 ab 00 00 00    	jne    8030c6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80301b:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  803022:	00 00 
+  803024:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803028:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80302a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80302e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803035:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803039:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80303b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80303f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803046:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80304a:	48 bb b5 16 80 00 00 	movabs $0x8016b5,%rbx
+  803051:	00 00 00 
+  803054:	ff d3                	call   *%rbx
+  803056:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80305a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80305e:	ff d3                	call   *%rbx
+  803060:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306a:	eb 4d                	jmp    8030b9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80306c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803071:	4c 89 ee             	mov    %r13,%rsi
+  803074:	bf 00 00 00 00       	mov    $0x0,%edi
+  803079:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  803080:	00 00 00 
+  803083:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803085:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80308a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80308e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803093:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  80309a:	00 00 00 
+  80309d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80309f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030a4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ad:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+}
+  8030b9:	89 d8                	mov    %ebx,%eax
+  8030bb:	48 83 c4 18          	add    $0x18,%rsp
+  8030bf:	5b                   	pop    %rbx
+  8030c0:	41 5c                	pop    %r12
+  8030c2:	41 5d                	pop    %r13
+  8030c4:	5d                   	pop    %rbp
+  8030c5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8030c6:	48 b9 10 3f 80 00 00 	movabs $0x803f10,%rcx
+  8030cd:	00 00 00 
+  8030d0:	48 ba e7 3e 80 00 00 	movabs $0x803ee7,%rdx
+  8030d7:	00 00 00 
+  8030da:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8030df:	48 bf fc 3e 80 00 00 	movabs $0x803efc,%rdi
+  8030e6:	00 00 00 
+  8030e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ee:	49 b8 46 35 80 00 00 	movabs $0x803546,%r8
+  8030f5:	00 00 00 
+  8030f8:	41 ff d0             	call   *%r8
+
+00000000008030fb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8030fb:	55                   	push   %rbp
+  8030fc:	48 89 e5             	mov    %rsp,%rbp
+  8030ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803103:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803107:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803113:	85 c0                	test   %eax,%eax
+  803115:	78 35                	js     80314c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803117:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80311b:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+  803127:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80312a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80312f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803134:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803138:	48 b8 b9 12 80 00 00 	movabs $0x8012b9,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+  803144:	85 c0                	test   %eax,%eax
+  803146:	0f 94 c0             	sete   %al
+  803149:	0f b6 c0             	movzbl %al,%eax
+}
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+
+000000000080314e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80314e:	48 89 f8             	mov    %rdi,%rax
+  803151:	48 c1 e8 27          	shr    $0x27,%rax
+  803155:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80315c:	01 00 00 
+  80315f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803163:	f6 c2 01             	test   $0x1,%dl
+  803166:	74 6d                	je     8031d5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803168:	48 89 f8             	mov    %rdi,%rax
+  80316b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80316f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803176:	01 00 00 
+  803179:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80317d:	f6 c2 01             	test   $0x1,%dl
+  803180:	74 62                	je     8031e4 <get_uvpt_entry+0x96>
+  803182:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803189:	01 00 00 
+  80318c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803190:	f6 c2 80             	test   $0x80,%dl
+  803193:	75 4f                	jne    8031e4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803195:	48 89 f8             	mov    %rdi,%rax
+  803198:	48 c1 e8 15          	shr    $0x15,%rax
+  80319c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031a3:	01 00 00 
+  8031a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031aa:	f6 c2 01             	test   $0x1,%dl
+  8031ad:	74 44                	je     8031f3 <get_uvpt_entry+0xa5>
+  8031af:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031b6:	01 00 00 
+  8031b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031bd:	f6 c2 80             	test   $0x80,%dl
+  8031c0:	75 31                	jne    8031f3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8031c2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8031c6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8031cd:	01 00 00 
+  8031d0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8031d4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031d5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031dc:	01 00 00 
+  8031df:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031e3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031e4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031eb:	01 00 00 
+  8031ee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031f2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8031f3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031fa:	01 00 00 
+  8031fd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803201:	c3                   	ret
+
+0000000000803202 <get_prot>:
+
+int
+get_prot(void *va) {
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803206:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+  803212:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803215:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80321a:	89 c1                	mov    %eax,%ecx
+  80321c:	83 c9 04             	or     $0x4,%ecx
+  80321f:	f6 c2 01             	test   $0x1,%dl
+  803222:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803225:	89 c1                	mov    %eax,%ecx
+  803227:	83 c9 02             	or     $0x2,%ecx
+  80322a:	f6 c2 02             	test   $0x2,%dl
+  80322d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803230:	89 c1                	mov    %eax,%ecx
+  803232:	83 c9 01             	or     $0x1,%ecx
+  803235:	48 85 d2             	test   %rdx,%rdx
+  803238:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80323b:	89 c1                	mov    %eax,%ecx
+  80323d:	83 c9 40             	or     $0x40,%ecx
+  803240:	f6 c6 04             	test   $0x4,%dh
+  803243:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803246:	5d                   	pop    %rbp
+  803247:	c3                   	ret
+
+0000000000803248 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803248:	55                   	push   %rbp
+  803249:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80324c:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  803253:	00 00 00 
+  803256:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803258:	48 c1 e8 06          	shr    $0x6,%rax
+  80325c:	83 e0 01             	and    $0x1,%eax
+}
+  80325f:	5d                   	pop    %rbp
+  803260:	c3                   	ret
+
+0000000000803261 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803261:	55                   	push   %rbp
+  803262:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803265:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803271:	48 c1 e8 05          	shr    $0x5,%rax
+  803275:	83 e0 01             	and    $0x1,%eax
+}
+  803278:	5d                   	pop    %rbp
+  803279:	c3                   	ret
+
+000000000080327a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80327a:	55                   	push   %rbp
+  80327b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80327e:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+  80328a:	83 e0 01             	and    $0x1,%eax
+}
+  80328d:	5d                   	pop    %rbp
+  80328e:	c3                   	ret
+
+000000000080328f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80328f:	55                   	push   %rbp
+  803290:	48 89 e5             	mov    %rsp,%rbp
+  803293:	41 57                	push   %r15
+  803295:	41 56                	push   %r14
+  803297:	41 55                	push   %r13
+  803299:	41 54                	push   %r12
+  80329b:	53                   	push   %rbx
+  80329c:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032a4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8032a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8032ad:	49 bd 7a 32 80 00 00 	movabs $0x80327a,%r13
+  8032b4:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8032b7:	49 bf 02 32 80 00 00 	movabs $0x803202,%r15
+  8032be:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8032c1:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8032c8:	00 00 00 
+  8032cb:	eb 0c                	jmp    8032d9 <foreach_shared_region+0x4a>
+  8032cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8032d4:	4c 39 f3             	cmp    %r14,%rbx
+  8032d7:	74 2e                	je     803307 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8032d9:	48 89 df             	mov    %rbx,%rdi
+  8032dc:	41 ff d5             	call   *%r13
+  8032df:	84 c0                	test   %al,%al
+  8032e1:	74 ea                	je     8032cd <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8032e3:	48 89 df             	mov    %rbx,%rdi
+  8032e6:	41 ff d7             	call   *%r15
+  8032e9:	a8 40                	test   $0x40,%al
+  8032eb:	74 e0                	je     8032cd <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8032ed:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8032f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032f8:	48 89 df             	mov    %rbx,%rdi
+  8032fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032ff:	ff d0                	call   *%rax
+				if (res < 0) {
+  803301:	85 c0                	test   %eax,%eax
+  803303:	79 c8                	jns    8032cd <foreach_shared_region+0x3e>
+  803305:	eb 05                	jmp    80330c <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803307:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80330c:	48 83 c4 18          	add    $0x18,%rsp
+  803310:	5b                   	pop    %rbx
+  803311:	41 5c                	pop    %r12
+  803313:	41 5d                	pop    %r13
+  803315:	41 5e                	pop    %r14
+  803317:	41 5f                	pop    %r15
+  803319:	5d                   	pop    %rbp
+  80331a:	c3                   	ret
+
+000000000080331b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80331b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803320:	c3                   	ret
+
+0000000000803321 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803321:	55                   	push   %rbp
+  803322:	48 89 e5             	mov    %rsp,%rbp
+  803325:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803328:	48 be 34 3f 80 00 00 	movabs $0x803f34,%rsi
+  80332f:	00 00 00 
+  803332:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  803339:	00 00 00 
+  80333c:	ff d0                	call   *%rax
+    return 0;
+}
+  80333e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803343:	5d                   	pop    %rbp
+  803344:	c3                   	ret
+
+0000000000803345 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803345:	55                   	push   %rbp
+  803346:	48 89 e5             	mov    %rsp,%rbp
+  803349:	41 57                	push   %r15
+  80334b:	41 56                	push   %r14
+  80334d:	41 55                	push   %r13
+  80334f:	41 54                	push   %r12
+  803351:	53                   	push   %rbx
+  803352:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803359:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803360:	48 85 d2             	test   %rdx,%rdx
+  803363:	74 7a                	je     8033df <devcons_write+0x9a>
+  803365:	49 89 d6             	mov    %rdx,%r14
+  803368:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80336e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803373:	49 bf 53 0e 80 00 00 	movabs $0x800e53,%r15
+  80337a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80337d:	4c 89 f3             	mov    %r14,%rbx
+  803380:	48 29 f3             	sub    %rsi,%rbx
+  803383:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803388:	48 39 c3             	cmp    %rax,%rbx
+  80338b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80338f:	4c 63 eb             	movslq %ebx,%r13
+  803392:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803399:	48 01 c6             	add    %rax,%rsi
+  80339c:	4c 89 ea             	mov    %r13,%rdx
+  80339f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033a6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8033a9:	4c 89 ee             	mov    %r13,%rsi
+  8033ac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033b3:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8033ba:	00 00 00 
+  8033bd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8033bf:	41 01 dc             	add    %ebx,%r12d
+  8033c2:	49 63 f4             	movslq %r12d,%rsi
+  8033c5:	4c 39 f6             	cmp    %r14,%rsi
+  8033c8:	72 b3                	jb     80337d <devcons_write+0x38>
+    return res;
+  8033ca:	49 63 c4             	movslq %r12d,%rax
+}
+  8033cd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8033d4:	5b                   	pop    %rbx
+  8033d5:	41 5c                	pop    %r12
+  8033d7:	41 5d                	pop    %r13
+  8033d9:	41 5e                	pop    %r14
+  8033db:	41 5f                	pop    %r15
+  8033dd:	5d                   	pop    %rbp
+  8033de:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8033df:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033e5:	eb e3                	jmp    8033ca <devcons_write+0x85>
+
+00000000008033e7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033e7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8033ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ef:	48 85 c0             	test   %rax,%rax
+  8033f2:	74 55                	je     803449 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033f4:	55                   	push   %rbp
+  8033f5:	48 89 e5             	mov    %rsp,%rbp
+  8033f8:	41 55                	push   %r13
+  8033fa:	41 54                	push   %r12
+  8033fc:	53                   	push   %rbx
+  8033fd:	48 83 ec 08          	sub    $0x8,%rsp
+  803401:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803404:	48 bb 89 11 80 00 00 	movabs $0x801189,%rbx
+  80340b:	00 00 00 
+  80340e:	49 bc 56 12 80 00 00 	movabs $0x801256,%r12
+  803415:	00 00 00 
+  803418:	eb 03                	jmp    80341d <devcons_read+0x36>
+  80341a:	41 ff d4             	call   *%r12
+  80341d:	ff d3                	call   *%rbx
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	74 f7                	je     80341a <devcons_read+0x33>
+    if (c < 0) return c;
+  803423:	48 63 d0             	movslq %eax,%rdx
+  803426:	78 13                	js     80343b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803428:	ba 00 00 00 00       	mov    $0x0,%edx
+  80342d:	83 f8 04             	cmp    $0x4,%eax
+  803430:	74 09                	je     80343b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803432:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803436:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80343b:	48 89 d0             	mov    %rdx,%rax
+  80343e:	48 83 c4 08          	add    $0x8,%rsp
+  803442:	5b                   	pop    %rbx
+  803443:	41 5c                	pop    %r12
+  803445:	41 5d                	pop    %r13
+  803447:	5d                   	pop    %rbp
+  803448:	c3                   	ret
+  803449:	48 89 d0             	mov    %rdx,%rax
+  80344c:	c3                   	ret
+
+000000000080344d <cputchar>:
+cputchar(int ch) {
+  80344d:	55                   	push   %rbp
+  80344e:	48 89 e5             	mov    %rsp,%rbp
+  803451:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803455:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803459:	be 01 00 00 00       	mov    $0x1,%esi
+  80345e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803462:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  803469:	00 00 00 
+  80346c:	ff d0                	call   *%rax
+}
+  80346e:	c9                   	leave
+  80346f:	c3                   	ret
+
+0000000000803470 <getchar>:
+getchar(void) {
+  803470:	55                   	push   %rbp
+  803471:	48 89 e5             	mov    %rsp,%rbp
+  803474:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803478:	ba 01 00 00 00       	mov    $0x1,%edx
+  80347d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803481:	bf 00 00 00 00       	mov    $0x0,%edi
+  803486:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  80348d:	00 00 00 
+  803490:	ff d0                	call   *%rax
+  803492:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803494:	85 c0                	test   %eax,%eax
+  803496:	78 06                	js     80349e <getchar+0x2e>
+  803498:	74 08                	je     8034a2 <getchar+0x32>
+  80349a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80349e:	89 d0                	mov    %edx,%eax
+  8034a0:	c9                   	leave
+  8034a1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8034a2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8034a7:	eb f5                	jmp    80349e <getchar+0x2e>
+
+00000000008034a9 <iscons>:
+iscons(int fdnum) {
+  8034a9:	55                   	push   %rbp
+  8034aa:	48 89 e5             	mov    %rsp,%rbp
+  8034ad:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034b1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034b5:	48 b8 43 17 80 00 00 	movabs $0x801743,%rax
+  8034bc:	00 00 00 
+  8034bf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034c1:	85 c0                	test   %eax,%eax
+  8034c3:	78 18                	js     8034dd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8034c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034c9:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  8034d0:	00 00 00 
+  8034d3:	8b 00                	mov    (%rax),%eax
+  8034d5:	39 02                	cmp    %eax,(%rdx)
+  8034d7:	0f 94 c0             	sete   %al
+  8034da:	0f b6 c0             	movzbl %al,%eax
+}
+  8034dd:	c9                   	leave
+  8034de:	c3                   	ret
+
+00000000008034df <opencons>:
+opencons(void) {
+  8034df:	55                   	push   %rbp
+  8034e0:	48 89 e5             	mov    %rsp,%rbp
+  8034e3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034e7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8034eb:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  8034f2:	00 00 00 
+  8034f5:	ff d0                	call   *%rax
+  8034f7:	85 c0                	test   %eax,%eax
+  8034f9:	78 49                	js     803544 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8034fb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803500:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803505:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350e:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  803515:	00 00 00 
+  803518:	ff d0                	call   *%rax
+  80351a:	85 c0                	test   %eax,%eax
+  80351c:	78 26                	js     803544 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80351e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803522:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  803529:	00 00 
+  80352b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80352d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803531:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803538:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+}
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+0000000000803546 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	41 56                	push   %r14
+  80354c:	41 55                	push   %r13
+  80354e:	41 54                	push   %r12
+  803550:	53                   	push   %rbx
+  803551:	48 83 ec 50          	sub    $0x50,%rsp
+  803555:	49 89 fc             	mov    %rdi,%r12
+  803558:	41 89 f5             	mov    %esi,%r13d
+  80355b:	48 89 d3             	mov    %rdx,%rbx
+  80355e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803562:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803566:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80356a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803571:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803575:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803579:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80357d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803581:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  803588:	00 00 00 
+  80358b:	4c 8b 30             	mov    (%rax),%r14
+  80358e:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  803595:	00 00 00 
+  803598:	ff d0                	call   *%rax
+  80359a:	89 c6                	mov    %eax,%esi
+  80359c:	45 89 e8             	mov    %r13d,%r8d
+  80359f:	4c 89 e1             	mov    %r12,%rcx
+  8035a2:	4c 89 f2             	mov    %r14,%rdx
+  8035a5:	48 bf 40 3f 80 00 00 	movabs $0x803f40,%rdi
+  8035ac:	00 00 00 
+  8035af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b4:	49 bc 34 03 80 00 00 	movabs $0x800334,%r12
+  8035bb:	00 00 00 
+  8035be:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8035c1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8035c5:	48 89 df             	mov    %rbx,%rdi
+  8035c8:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  8035cf:	00 00 00 
+  8035d2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8035d4:	48 bf a2 38 80 00 00 	movabs $0x8038a2,%rdi
+  8035db:	00 00 00 
+  8035de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8035e6:	cc                   	int3
+  8035e7:	eb fd                	jmp    8035e6 <_panic+0xa0>
+
+00000000008035e9 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	41 55                	push   %r13
+  8035ef:	41 54                	push   %r12
+  8035f1:	53                   	push   %rbx
+  8035f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8035f6:	49 89 fc             	mov    %rdi,%r12
+  8035f9:	48 89 f7             	mov    %rsi,%rdi
+  8035fc:	48 89 d3             	mov    %rdx,%rbx
+  8035ff:	49 89 cd             	mov    %rcx,%r13
+  803602:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803605:	48 85 f6             	test   %rsi,%rsi
+  803608:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80360f:	00 00 00 
+  803612:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803616:	be 00 10 00 00       	mov    $0x1000,%esi
+  80361b:	48 85 db             	test   %rbx,%rbx
+  80361e:	74 03                	je     803623 <ipc_recv_timed+0x3a>
+  803620:	48 8b 33             	mov    (%rbx),%rsi
+  803623:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 75                	js     8036a8 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803633:	4d 85 e4             	test   %r12,%r12
+  803636:	74 14                	je     80364c <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803638:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  80363f:	00 00 00 
+  803642:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803648:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80364c:	4d 85 ed             	test   %r13,%r13
+  80364f:	74 14                	je     803665 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803651:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  803658:	00 00 00 
+  80365b:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803661:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803665:	48 85 db             	test   %rbx,%rbx
+  803668:	74 23                	je     80368d <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80366a:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  803671:	00 00 00 
+  803674:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80367a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80367f:	85 c9                	test   %ecx,%ecx
+  803681:	74 07                	je     80368a <ipc_recv_timed+0xa1>
+  803683:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80368a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80368d:	48 a1 70 5f 80 00 00 	movabs 0x805f70,%rax
+  803694:	00 00 00 
+  803697:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80369d:	48 83 c4 08          	add    $0x8,%rsp
+  8036a1:	5b                   	pop    %rbx
+  8036a2:	41 5c                	pop    %r12
+  8036a4:	41 5d                	pop    %r13
+  8036a6:	5d                   	pop    %rbp
+  8036a7:	c3                   	ret
+        if (from_env_store != NULL) {
+  8036a8:	4d 85 e4             	test   %r12,%r12
+  8036ab:	74 08                	je     8036b5 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8036ad:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8036b4:	00 
+        if (perm_store != NULL) {
+  8036b5:	4d 85 ed             	test   %r13,%r13
+  8036b8:	74 08                	je     8036c2 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8036ba:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8036c1:	00 
+        if (size != NULL) {
+  8036c2:	48 85 db             	test   %rbx,%rbx
+  8036c5:	74 d6                	je     80369d <ipc_recv_timed+0xb4>
+            *size = 0;
+  8036c7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8036ce:	eb cd                	jmp    80369d <ipc_recv_timed+0xb4>
+
+00000000008036d0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8036d0:	55                   	push   %rbp
+  8036d1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8036d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8036da:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8036e1:	00 00 00 
+  8036e4:	ff d0                	call   *%rax
+}
+  8036e6:	5d                   	pop    %rbp
+  8036e7:	c3                   	ret
+
+00000000008036e8 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8036e8:	55                   	push   %rbp
+  8036e9:	48 89 e5             	mov    %rsp,%rbp
+  8036ec:	41 57                	push   %r15
+  8036ee:	41 56                	push   %r14
+  8036f0:	41 55                	push   %r13
+  8036f2:	41 54                	push   %r12
+  8036f4:	53                   	push   %rbx
+  8036f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8036f9:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8036fc:	48 89 d3             	mov    %rdx,%rbx
+  8036ff:	49 89 cc             	mov    %rcx,%r12
+  803702:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803705:	48 85 d2             	test   %rdx,%rdx
+  803708:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80370f:	00 00 00 
+  803712:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803716:	89 f0                	mov    %esi,%eax
+  803718:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80371c:	48 89 da             	mov    %rbx,%rdx
+  80371f:	48 89 c6             	mov    %rax,%rsi
+  803722:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  803729:	00 00 00 
+  80372c:	ff d0                	call   *%rax
+    while (res < 0) {
+  80372e:	85 c0                	test   %eax,%eax
+  803730:	79 65                	jns    803797 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803732:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803735:	75 33                	jne    80376a <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803737:	49 bf 56 12 80 00 00 	movabs $0x801256,%r15
+  80373e:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803741:	49 be 53 15 80 00 00 	movabs $0x801553,%r14
+  803748:	00 00 00 
+        sys_yield();
+  80374b:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80374e:	45 89 e8             	mov    %r13d,%r8d
+  803751:	4c 89 e1             	mov    %r12,%rcx
+  803754:	48 89 da             	mov    %rbx,%rdx
+  803757:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80375b:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80375e:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803761:	85 c0                	test   %eax,%eax
+  803763:	79 32                	jns    803797 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803765:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803768:	74 e1                	je     80374b <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80376a:	89 c1                	mov    %eax,%ecx
+  80376c:	48 ba 63 3f 80 00 00 	movabs $0x803f63,%rdx
+  803773:	00 00 00 
+  803776:	be 52 00 00 00       	mov    $0x52,%esi
+  80377b:	48 bf 77 3f 80 00 00 	movabs $0x803f77,%rdi
+  803782:	00 00 00 
+  803785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378a:	49 b8 46 35 80 00 00 	movabs $0x803546,%r8
+  803791:	00 00 00 
+  803794:	41 ff d0             	call   *%r8
+    }
+}
+  803797:	48 83 c4 18          	add    $0x18,%rsp
+  80379b:	5b                   	pop    %rbx
+  80379c:	41 5c                	pop    %r12
+  80379e:	41 5d                	pop    %r13
+  8037a0:	41 5e                	pop    %r14
+  8037a2:	41 5f                	pop    %r15
+  8037a4:	5d                   	pop    %rbp
+  8037a5:	c3                   	ret
+
+00000000008037a6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8037a6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8037ab:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8037b2:	00 00 00 
+  8037b5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8037b9:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8037bd:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037c1:	48 01 ca             	add    %rcx,%rdx
+  8037c4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8037ca:	39 fa                	cmp    %edi,%edx
+  8037cc:	74 12                	je     8037e0 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8037ce:	48 83 c0 01          	add    $0x1,%rax
+  8037d2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8037d8:	75 db                	jne    8037b5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8037da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037df:	c3                   	ret
+            return envs[i].env_id;
+  8037e0:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8037e4:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8037e8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037ec:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8037f3:	00 00 00 
+  8037f6:	48 01 d0             	add    %rdx,%rax
+  8037f9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8037ff:	c3                   	ret
+
+0000000000803800 <__rodata_start>:
+  803800:	55                   	push   %rbp
+  803801:	73 61                	jae    803864 <__rodata_start+0x64>
+  803803:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  803807:	64 69 66 66 73 68 20 	imul   $0x3c206873,%fs:0x66(%rsi),%esp
+  80380e:	3c 
+  80380f:	66 72 6f             	data16 jb 803881 <__rodata_start+0x81>
+  803812:	6d                   	insl   (%dx),%es:(%rdi)
+  803813:	20 73 6e             	and    %dh,0x6e(%rbx)
+  803816:	61                   	(bad)
+  803817:	70 73                	jo     80388c <__rodata_start+0x8c>
+  803819:	68 6f 74 3e 20       	push   $0x203e746f
+  80381e:	3c 74                	cmp    $0x74,%al
+  803820:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803821:	20 73 6e             	and    %dh,0x6e(%rbx)
+  803824:	61                   	(bad)
+  803825:	70 73                	jo     80389a <__rodata_start+0x9a>
+  803827:	68 6f 74 3e 0a       	push   $0xa3e746f
+  80382c:	00 00                	add    %al,(%rax)
+  80382e:	00 00                	add    %al,(%rax)
+  803830:	20 20                	and    %ah,(%rax)
+  803832:	20 20                	and    %ah,(%rax)
+  803834:	20 20                	and    %ah,(%rax)
+  803836:	20 61 72             	and    %ah,0x72(%rcx)
+  803839:	67 20 70 6f          	and    %dh,0x6f(%eax)
+  80383d:	73 69                	jae    8038a8 <__rodata_start+0xa8>
+  80383f:	74 69                	je     8038aa <__rodata_start+0xaa>
+  803841:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803842:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803843:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e158ad <__bss_end+0x7260d8ad>
+  803849:	67 75 6d             	addr32 jne 8038b9 <__rodata_start+0xb9>
+  80384c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80384e:	74 3a                	je     80388a <__rodata_start+0x8a>
+  803850:	25 73 0a 00 00       	and    $0xa73,%eax
+  803855:	00 00                	add    %al,(%rax)
+  803857:	00 53 6e             	add    %dl,0x6e(%rbx)
+  80385a:	61                   	(bad)
+  80385b:	70 73                	jo     8038d0 <__rodata_start+0xd0>
+  80385d:	68 6f 74 73 20       	push   $0x2073746f
+  803862:	63 61 6e             	movsxd 0x6e(%rcx),%esp
+  803865:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803866:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803867:	74 20                	je     803889 <__rodata_start+0x89>
+  803869:	62 65                	(bad)
+  80386b:	20 63 6f             	and    %ah,0x6f(%rbx)
+  80386e:	6d                   	insl   (%dx),%es:(%rdi)
+  80386f:	70 61                	jo     8038d2 <__rodata_start+0xd2>
+  803871:	72 65                	jb     8038d8 <__rodata_start+0xd8>
+  803873:	64 3a 20             	cmp    %fs:(%rax),%ah
+  803876:	25 69 0a 00 2b       	and    $0x2b000a69,%eax
+  80387b:	20 25 73 0a 00 2d    	and    %ah,0x2d000a73(%rip)        # 2d8042f4 <__bss_end+0x2cffc2f4>
+  803881:	20 25 73 0a 00 4d    	and    %ah,0x4d000a73(%rip)        # 4d8042fa <__bss_end+0x4cffc2fa>
+  803887:	20 25 73 20 62 6c    	and    %ah,0x6c622073(%rip)        # 6ce25900 <__bss_end+0x6c61d900>
+  80388d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80388e:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  803891:	20 5b 25             	and    %bl,0x25(%rbx)
+  803894:	75 2c                	jne    8038c2 <__rodata_start+0xc2>
+  803896:	20 25 75 29 20 73    	and    %ah,0x73202975(%rip)        # 73a06211 <__bss_end+0x731fe211>
+  80389c:	69 7a 65 20 25 64 0a 	imul   $0xa642520,0x65(%rdx),%edi
+  8038a3:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8038aa:	77 6e                	ja     80391a <__rodata_start+0x11a>
+  8038ac:	3e 00 30             	ds add %dh,(%rax)
+  8038af:	31 32                	xor    %esi,(%rdx)
+  8038b1:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038b8:	41                   	rex.B
+  8038b9:	42                   	rex.X
+  8038ba:	43                   	rex.XB
+  8038bb:	44                   	rex.R
+  8038bc:	45                   	rex.RB
+  8038bd:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038c0:	31 32                	xor    %esi,(%rdx)
+  8038c2:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038c9:	61                   	(bad)
+  8038ca:	62 63 64 65 66       	(bad)
+  8038cf:	00 28                	add    %ch,(%rax)
+  8038d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d2:	75 6c                	jne    803940 <__rodata_start+0x140>
+  8038d4:	6c                   	insb   (%dx),%es:(%rdi)
+  8038d5:	29 00                	sub    %eax,(%rax)
+  8038d7:	65 72 72             	gs jb  80394c <__rodata_start+0x14c>
+  8038da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038db:	72 20                	jb     8038fd <__rodata_start+0xfd>
+  8038dd:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038e2:	73 70                	jae    803954 <__rodata_start+0x154>
+  8038e4:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038e8:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8038ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038f0:	72 00                	jb     8038f2 <__rodata_start+0xf2>
+  8038f2:	62 61 64 20 65       	(bad)
+  8038f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038f8:	76 69                	jbe    803963 <__rodata_start+0x163>
+  8038fa:	72 6f                	jb     80396b <__rodata_start+0x16b>
+  8038fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038fd:	6d                   	insl   (%dx),%es:(%rdi)
+  8038fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803900:	74 00                	je     803902 <__rodata_start+0x102>
+  803902:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803909:	20 70 61             	and    %dh,0x61(%rax)
+  80390c:	72 61                	jb     80396f <__rodata_start+0x16f>
+  80390e:	6d                   	insl   (%dx),%es:(%rdi)
+  80390f:	65 74 65             	gs je  803977 <__rodata_start+0x177>
+  803912:	72 00                	jb     803914 <__rodata_start+0x114>
+  803914:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803915:	75 74                	jne    80398b <__rodata_start+0x18b>
+  803917:	20 6f 66             	and    %ch,0x66(%rdi)
+  80391a:	20 6d 65             	and    %ch,0x65(%rbp)
+  80391d:	6d                   	insl   (%dx),%es:(%rdi)
+  80391e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80391f:	72 79                	jb     80399a <__rodata_start+0x19a>
+  803921:	00 6f 75             	add    %ch,0x75(%rdi)
+  803924:	74 20                	je     803946 <__rodata_start+0x146>
+  803926:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803927:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80392b:	76 69                	jbe    803996 <__rodata_start+0x196>
+  80392d:	72 6f                	jb     80399e <__rodata_start+0x19e>
+  80392f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803930:	6d                   	insl   (%dx),%es:(%rdi)
+  803931:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803933:	74 73                	je     8039a8 <__rodata_start+0x1a8>
+  803935:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803938:	72 72                	jb     8039ac <__rodata_start+0x1ac>
+  80393a:	75 70                	jne    8039ac <__rodata_start+0x1ac>
+  80393c:	74 65                	je     8039a3 <__rodata_start+0x1a3>
+  80393e:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803943:	75 67                	jne    8039ac <__rodata_start+0x1ac>
+  803945:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803948:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80394a:	00 73 65             	add    %dh,0x65(%rbx)
+  80394d:	67 6d                	insl   (%dx),%es:(%edi)
+  80394f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803951:	74 61                	je     8039b4 <__rodata_start+0x1b4>
+  803953:	74 69                	je     8039be <__rodata_start+0x1be>
+  803955:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803956:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803957:	20 66 61             	and    %ah,0x61(%rsi)
+  80395a:	75 6c                	jne    8039c8 <__rodata_start+0x1c8>
+  80395c:	74 00                	je     80395e <__rodata_start+0x15e>
+  80395e:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803965:	20 45 4c             	and    %al,0x4c(%rbp)
+  803968:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80396c:	61                   	(bad)
+  80396d:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803972:	20 73 75             	and    %dh,0x75(%rbx)
+  803975:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803978:	73 79                	jae    8039f3 <__rodata_start+0x1f3>
+  80397a:	73 74                	jae    8039f0 <__rodata_start+0x1f0>
+  80397c:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80397e:	20 63 61             	and    %ah,0x61(%rbx)
+  803981:	6c                   	insb   (%dx),%es:(%rdi)
+  803982:	6c                   	insb   (%dx),%es:(%rdi)
+  803983:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803986:	74 72                	je     8039fa <__rodata_start+0x1fa>
+  803988:	79 20                	jns    8039aa <__rodata_start+0x1aa>
+  80398a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80398b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80398c:	74 20                	je     8039ae <__rodata_start+0x1ae>
+  80398e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803990:	75 6e                	jne    803a00 <__rodata_start+0x200>
+  803992:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803996:	76 20                	jbe    8039b8 <__rodata_start+0x1b8>
+  803998:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80399f:	72 65                	jb     803a06 <__rodata_start+0x206>
+  8039a1:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8039a4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039a5:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8039a9:	65 78 70             	gs js  803a1c <__rodata_start+0x21c>
+  8039ac:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8039b1:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8039b4:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8039b8:	20 66 69             	and    %ah,0x69(%rsi)
+  8039bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8039bc:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039c0:	20 66 72             	and    %ah,0x72(%rsi)
+  8039c3:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039c8:	61                   	(bad)
+  8039c9:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039cd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ce:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8039d2:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039d5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039d6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039d7:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039db:	79 20                	jns    8039fd <__rodata_start+0x1fd>
+  8039dd:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039e4:	72 65                	jb     803a4b <__rodata_start+0x24b>
+  8039e6:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039e9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039eb:	00 66 69             	add    %ah,0x69(%rsi)
+  8039ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ef:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8039f3:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8039f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039f7:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8039fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039fc:	74 20                	je     803a1e <__rodata_start+0x21e>
+  8039fe:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a00:	75 6e                	jne    803a70 <__rodata_start+0x270>
+  803a02:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a06:	76 61                	jbe    803a69 <__rodata_start+0x269>
+  803a08:	6c                   	insb   (%dx),%es:(%rdi)
+  803a09:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a10:	00 
+  803a11:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a18:	72 65                	jb     803a7f <__rodata_start+0x27f>
+  803a1a:	61                   	(bad)
+  803a1b:	64 79 20             	fs jns 803a3e <__rodata_start+0x23e>
+  803a1e:	65 78 69             	gs js  803a8a <__rodata_start+0x28a>
+  803a21:	73 74                	jae    803a97 <__rodata_start+0x297>
+  803a23:	73 00                	jae    803a25 <__rodata_start+0x225>
+  803a25:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a26:	70 65                	jo     803a8d <__rodata_start+0x28d>
+  803a28:	72 61                	jb     803a8b <__rodata_start+0x28b>
+  803a2a:	74 69                	je     803a95 <__rodata_start+0x295>
+  803a2c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a2d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2e:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a31:	74 20                	je     803a53 <__rodata_start+0x253>
+  803a33:	73 75                	jae    803aaa <__rodata_start+0x2aa>
+  803a35:	70 70                	jo     803aa7 <__rodata_start+0x2a7>
+  803a37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a38:	72 74                	jb     803aae <__rodata_start+0x2ae>
+  803a3a:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a40:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a45:	74 00                	je     803a47 <__rodata_start+0x247>
+  803a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a4e:	00 00 00 
+  803a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a58:	00 00 00 
+  803a5b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803a60:	21 05 80 00 00 00    	and    %eax,0x80(%rip)        # 803ae6 <__rodata_start+0x2e6>
+  803a66:	00 00                	add    %al,(%rax)
+  803a68:	62                   	(bad)
+  803a69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a6f:	00 52 0b             	add    %dl,0xb(%rdx)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 62 0b             	add    %ah,0xb(%rdx)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 62 0b             	add    %ah,0xb(%rdx)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 40 05             	add    %al,0x5(%rax)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 34 05 80 00 00 00 	add    %dh,0x80(,%rax,1)
+  803ab6:	00 00                	add    %al,(%rax)
+  803ab8:	ae                   	scas   %es:(%rdi),%al
+  803ab9:	05 80 00 00 00       	add    $0x80,%eax
+  803abe:	00 00                	add    %al,(%rax)
+  803ac0:	62                   	(bad)
+  803ac1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ac7:	00 34 05 80 00 00 00 	add    %dh,0x80(,%rax,1)
+  803ace:	00 00                	add    %al,(%rax)
+  803ad0:	7a 05                	jp     803ad7 <__rodata_start+0x2d7>
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 7a 05             	add    %bh,0x5(%rdx)
+  803ada:	80 00 00             	addb   $0x0,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 7a 05             	add    %bh,0x5(%rdx)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 7a 05             	add    %bh,0x5(%rdx)
+  803aea:	80 00 00             	addb   $0x0,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 7a 05             	add    %bh,0x5(%rdx)
+  803af2:	80 00 00             	addb   $0x0,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 7a 05             	add    %bh,0x5(%rdx)
+  803afa:	80 00 00             	addb   $0x0,(%rax)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 7a 05             	add    %bh,0x5(%rdx)
+  803b02:	80 00 00             	addb   $0x0,(%rax)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 7a 05             	add    %bh,0x5(%rdx)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 7a 05             	add    %bh,0x5(%rdx)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b1a:	80 00 00             	addb   $0x0,(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b22:	80 00 00             	addb   $0x0,(%rax)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b2a:	80 00 00             	addb   $0x0,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b32:	80 00 00             	addb   $0x0,(%rax)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b3a:	80 00 00             	addb   $0x0,(%rax)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b42:	80 00 00             	addb   $0x0,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b4a:	80 00 00             	addb   $0x0,(%rax)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b52:	80 00 00             	addb   $0x0,(%rax)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b5a:	80 00 00             	addb   $0x0,(%rax)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b62:	80 00 00             	addb   $0x0,(%rax)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b6a:	80 00 00             	addb   $0x0,(%rax)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b72:	80 00 00             	addb   $0x0,(%rax)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b7a:	80 00 00             	addb   $0x0,(%rax)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b82:	80 00 00             	addb   $0x0,(%rax)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b8a:	80 00 00             	addb   $0x0,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b92:	80 00 00             	addb   $0x0,(%rax)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 62 0b             	add    %ah,0xb(%rdx)
+  803b9a:	80 00 00             	addb   $0x0,(%rax)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803ba2:	80 00 00             	addb   $0x0,(%rax)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803baa:	80 00 00             	addb   $0x0,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bb2:	80 00 00             	addb   $0x0,(%rax)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bba:	80 00 00             	addb   $0x0,(%rax)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bca:	80 00 00             	addb   $0x0,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bd2:	80 00 00             	addb   $0x0,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bda:	80 00 00             	addb   $0x0,(%rax)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 62 0b             	add    %ah,0xb(%rdx)
+  803be2:	80 00 00             	addb   $0x0,(%rax)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bea:	80 00 00             	addb   $0x0,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bf2:	80 00 00             	addb   $0x0,(%rax)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803bfa:	80 00 00             	addb   $0x0,(%rax)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c02:	80 00 00             	addb   $0x0,(%rax)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 85 0a 80 00 00    	add    %al,0x800a(%rbp)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c12:	80 00 00             	addb   $0x0,(%rax)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c1a:	80 00 00             	addb   $0x0,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c22:	80 00 00             	addb   $0x0,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c2a:	80 00 00             	addb   $0x0,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c3a:	80 00 00             	addb   $0x0,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c52:	80 00 00             	addb   $0x0,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 d1                	add    %dl,%cl
+  803c61:	05 80 00 00 00       	add    $0x80,%eax
+  803c66:	00 00                	add    %al,(%rax)
+  803c68:	a0 07 80 00 00 00 00 	movabs 0x6200000000008007,%al
+  803c6f:	00 62 
+  803c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c77:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c7a:	80 00 00             	addb   $0x0,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 00                	add    %al,(%rax)
+  803c91:	06                   	(bad)
+  803c92:	80 00 00             	addb   $0x0,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 62 0b             	add    %ah,0xb(%rdx)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803ca2:	80 00 00             	addb   $0x0,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 c6                	add    %al,%dh
+  803ca9:	05 80 00 00 00       	add    $0x80,%eax
+  803cae:	00 00                	add    %al,(%rax)
+  803cb0:	62                   	(bad)
+  803cb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cb7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 48 09             	add    %cl,0x9(%rax)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 12                	add    %dl,(%rdx)
+  803cc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ccf:	00 62 0b             	add    %ah,0xb(%rdx)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803cda:	80 00 00             	addb   $0x0,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 97 06 80 00 00    	add    %dl,0x8006(%rdi)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 74 08 80          	add    %dh,-0x80(%rax,%rcx,1)
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 62 0b             	add    %ah,0xb(%rdx)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 62 0b             	add    %ah,0xb(%rdx)
+  803d02:	80 00 00             	addb   $0x0,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 85 0a 80 00 00    	add    %al,0x800a(%rbp)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 62 0b             	add    %ah,0xb(%rdx)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 2a                	add    %ch,(%rdx)
+  803d19:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803d20 <error_string>:
+	...
+  803d28:	e0 38 80 00 00 00 00 00 f2 38 80 00 00 00 00 00     .8.......8......
+  803d38:	02 39 80 00 00 00 00 00 14 39 80 00 00 00 00 00     .9.......9......
+  803d48:	22 39 80 00 00 00 00 00 36 39 80 00 00 00 00 00     "9......69......
+  803d58:	4b 39 80 00 00 00 00 00 5e 39 80 00 00 00 00 00     K9......^9......
+  803d68:	70 39 80 00 00 00 00 00 84 39 80 00 00 00 00 00     p9.......9......
+  803d78:	94 39 80 00 00 00 00 00 a7 39 80 00 00 00 00 00     .9.......9......
+  803d88:	be 39 80 00 00 00 00 00 d4 39 80 00 00 00 00 00     .9.......9......
+  803d98:	ec 39 80 00 00 00 00 00 04 3a 80 00 00 00 00 00     .9.......:......
+  803da8:	11 3a 80 00 00 00 00 00 c8 3d 80 00 00 00 00 00     .:.......=......
+  803db8:	25 3a 80 00 00 00 00 00 3d 3a 80 00 00 00 00 00     %:......=:......
+  803dc8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803dd8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803de8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803df8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803e08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803e18:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803e28:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803e38:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803e48:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803e58:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803e68:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803e78:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803e88:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803e98:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803ea8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803eb8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ec0 <devtab>:
+  803ec0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803ed0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803ee0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803ef0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803f00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803f10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803f20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803f30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803f50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803f60:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803f70:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
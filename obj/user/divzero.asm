@@ -0,0 +1,6932 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf b0 36 80 00 00 	movabs $0x8036b0,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba de 01 80 00 00 	movabs $0x8001de,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	41 89 fd             	mov    %edi,%r13d
+  80006e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800071:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800078:	00 00 00 
+  80007b:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800082:	00 00 00 
+  800085:	48 39 c2             	cmp    %rax,%rdx
+  800088:	73 17                	jae    8000a1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80008a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008d:	49 89 c4             	mov    %rax,%r12
+  800090:	48 83 c3 08          	add    $0x8,%rbx
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	ff 53 f8             	call   *-0x8(%rbx)
+  80009c:	4c 39 e3             	cmp    %r12,%rbx
+  80009f:	72 ef                	jb     800090 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000a1:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000b6:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000ba:	48 c1 e0 04          	shl    $0x4,%rax
+  8000be:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000c5:	00 00 00 
+  8000c8:	48 01 d0             	add    %rdx,%rax
+  8000cb:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8000d2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d5:	45 85 ed             	test   %r13d,%r13d
+  8000d8:	7e 0d                	jle    8000e7 <libmain+0x87>
+  8000da:	49 8b 06             	mov    (%r14),%rax
+  8000dd:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000e4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e7:	4c 89 f6             	mov    %r14,%rsi
+  8000ea:	44 89 ef             	mov    %r13d,%edi
+  8000ed:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f4:	00 00 00 
+  8000f7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f9:	48 b8 0e 01 80 00 00 	movabs $0x80010e,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+#endif
+}
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	5d                   	pop    %rbp
+  80010d:	c3                   	ret
+
+000000000080010e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80010e:	55                   	push   %rbp
+  80010f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800112:	48 b8 85 17 80 00 00 	movabs $0x801785,%rax
+  800119:	00 00 00 
+  80011c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80011e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800123:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+}
+  80012f:	5d                   	pop    %rbp
+  800130:	c3                   	ret
+
+0000000000800131 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800131:	55                   	push   %rbp
+  800132:	48 89 e5             	mov    %rsp,%rbp
+  800135:	53                   	push   %rbx
+  800136:	48 83 ec 08          	sub    $0x8,%rsp
+  80013a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80013d:	8b 06                	mov    (%rsi),%eax
+  80013f:	8d 50 01             	lea    0x1(%rax),%edx
+  800142:	89 16                	mov    %edx,(%rsi)
+  800144:	48 98                	cltq
+  800146:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80014b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800151:	74 0a                	je     80015d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800153:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800157:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015b:	c9                   	leave
+  80015c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80015d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800161:	be ff 00 00 00       	mov    $0xff,%esi
+  800166:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  80016d:	00 00 00 
+  800170:	ff d0                	call   *%rax
+        state->offset = 0;
+  800172:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800178:	eb d9                	jmp    800153 <putch+0x22>
+
+000000000080017a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80017a:	55                   	push   %rbp
+  80017b:	48 89 e5             	mov    %rsp,%rbp
+  80017e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800185:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800188:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80018f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80019c:	48 89 f1             	mov    %rsi,%rcx
+  80019f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001a6:	48 bf 31 01 80 00 00 	movabs $0x800131,%rdi
+  8001ad:	00 00 00 
+  8001b0:	48 b8 2e 03 80 00 00 	movabs $0x80032e,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001bc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001c3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001ca:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001d6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+
+00000000008001de <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001de:	55                   	push   %rbp
+  8001df:	48 89 e5             	mov    %rsp,%rbp
+  8001e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001ea:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001ee:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001f2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001f6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001fa:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800201:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800205:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800209:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80020d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800211:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800215:	48 b8 7a 01 80 00 00 	movabs $0x80017a,%rax
+  80021c:	00 00 00 
+  80021f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	41 57                	push   %r15
+  800229:	41 56                	push   %r14
+  80022b:	41 55                	push   %r13
+  80022d:	41 54                	push   %r12
+  80022f:	53                   	push   %rbx
+  800230:	48 83 ec 18          	sub    $0x18,%rsp
+  800234:	49 89 fc             	mov    %rdi,%r12
+  800237:	49 89 f5             	mov    %rsi,%r13
+  80023a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80023e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800241:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800244:	41 89 cf             	mov    %ecx,%r15d
+  800247:	4c 39 fa             	cmp    %r15,%rdx
+  80024a:	73 5b                	jae    8002a7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80024c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800250:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800254:	85 db                	test   %ebx,%ebx
+  800256:	7e 0e                	jle    800266 <print_num+0x43>
+            putch(padc, put_arg);
+  800258:	4c 89 ee             	mov    %r13,%rsi
+  80025b:	44 89 f7             	mov    %r14d,%edi
+  80025e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	75 f2                	jne    800258 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800266:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80026a:	48 b9 dc 36 80 00 00 	movabs $0x8036dc,%rcx
+  800271:	00 00 00 
+  800274:	48 b8 cb 36 80 00 00 	movabs $0x8036cb,%rax
+  80027b:	00 00 00 
+  80027e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800282:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028b:	49 f7 f7             	div    %r15
+  80028e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800292:	4c 89 ee             	mov    %r13,%rsi
+  800295:	41 ff d4             	call   *%r12
+}
+  800298:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80029c:	5b                   	pop    %rbx
+  80029d:	41 5c                	pop    %r12
+  80029f:	41 5d                	pop    %r13
+  8002a1:	41 5e                	pop    %r14
+  8002a3:	41 5f                	pop    %r15
+  8002a5:	5d                   	pop    %rbp
+  8002a6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b0:	49 f7 f7             	div    %r15
+  8002b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002bb:	52                   	push   %rdx
+  8002bc:	45 0f be c9          	movsbl %r9b,%r9d
+  8002c0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002c4:	48 89 c2             	mov    %rax,%rdx
+  8002c7:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+  8002d3:	48 83 c4 10          	add    $0x10,%rsp
+  8002d7:	eb 8d                	jmp    800266 <print_num+0x43>
+
+00000000008002d9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002dd:	48 8b 06             	mov    (%rsi),%rax
+  8002e0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002e4:	73 0a                	jae    8002f0 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002e6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ea:	48 89 16             	mov    %rdx,(%rsi)
+  8002ed:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002f0:	c3                   	ret
+
+00000000008002f1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002f1:	55                   	push   %rbp
+  8002f2:	48 89 e5             	mov    %rsp,%rbp
+  8002f5:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002fd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800301:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800305:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80030c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800310:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800314:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800318:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80031c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800320:	48 b8 2e 03 80 00 00 	movabs $0x80032e,%rax
+  800327:	00 00 00 
+  80032a:	ff d0                	call   *%rax
+}
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+
+000000000080032e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80032e:	55                   	push   %rbp
+  80032f:	48 89 e5             	mov    %rsp,%rbp
+  800332:	41 57                	push   %r15
+  800334:	41 56                	push   %r14
+  800336:	41 55                	push   %r13
+  800338:	41 54                	push   %r12
+  80033a:	53                   	push   %rbx
+  80033b:	48 83 ec 38          	sub    $0x38,%rsp
+  80033f:	49 89 fe             	mov    %rdi,%r14
+  800342:	49 89 f5             	mov    %rsi,%r13
+  800345:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800348:	48 8b 01             	mov    (%rcx),%rax
+  80034b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80034f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800353:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800357:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80035b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80035f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800363:	0f b6 3b             	movzbl (%rbx),%edi
+  800366:	40 80 ff 25          	cmp    $0x25,%dil
+  80036a:	74 18                	je     800384 <vprintfmt+0x56>
+            if (!ch) return;
+  80036c:	40 84 ff             	test   %dil,%dil
+  80036f:	0f 84 b1 06 00 00    	je     800a26 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800375:	40 0f b6 ff          	movzbl %dil,%edi
+  800379:	4c 89 ee             	mov    %r13,%rsi
+  80037c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80037f:	4c 89 e3             	mov    %r12,%rbx
+  800382:	eb db                	jmp    80035f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800384:	be 00 00 00 00       	mov    $0x0,%esi
+  800389:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80038d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800392:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800398:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80039f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003a3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003ad:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003b0:	83 e8 23             	sub    $0x23,%eax
+  8003b3:	3c 57                	cmp    $0x57,%al
+  8003b5:	0f 87 51 06 00 00    	ja     800a0c <vprintfmt+0x6de>
+  8003bb:	0f b6 c0             	movzbl %al,%eax
+  8003be:	48 b9 80 38 80 00 00 	movabs $0x803880,%rcx
+  8003c5:	00 00 00 
+  8003c8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003cb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003ce:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003d2:	eb cf                	jmp    8003a3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003d4:	49 89 dc             	mov    %rbx,%r12
+  8003d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8003dc:	eb c5                	jmp    8003a3 <vprintfmt+0x75>
+            padc = ch;
+  8003de:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003e2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e8:	eb b9                	jmp    8003a3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f0:	77 24                	ja     800416 <vprintfmt+0xe8>
+  8003f2:	89 c1                	mov    %eax,%ecx
+  8003f4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f8:	83 c0 08             	add    $0x8,%eax
+  8003fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003fe:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800401:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800404:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800408:	79 99                	jns    8003a3 <vprintfmt+0x75>
+                width = precision;
+  80040a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80040e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800414:	eb 8d                	jmp    8003a3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800416:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80041a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80041e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800422:	eb da                	jmp    8003fe <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800424:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800429:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800433:	3c 39                	cmp    $0x39,%al
+  800435:	77 1c                	ja     800453 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800437:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80043b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80043f:	0f b6 c0             	movzbl %al,%eax
+  800442:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800447:	0f b6 03             	movzbl (%rbx),%eax
+  80044a:	3c 39                	cmp    $0x39,%al
+  80044c:	76 e9                	jbe    800437 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800451:	eb b1                	jmp    800404 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800453:	49 89 dc             	mov    %rbx,%r12
+  800456:	eb ac                	jmp    800404 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800458:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80045b:	85 c9                	test   %ecx,%ecx
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	0f 49 c1             	cmovns %ecx,%eax
+  800465:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800468:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046b:	e9 33 ff ff ff       	jmp    8003a3 <vprintfmt+0x75>
+            lflag++;
+  800470:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800473:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800476:	e9 28 ff ff ff       	jmp    8003a3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80047b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80047e:	83 f8 2f             	cmp    $0x2f,%eax
+  800481:	77 19                	ja     80049c <vprintfmt+0x16e>
+  800483:	89 c2                	mov    %eax,%edx
+  800485:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800489:	83 c0 08             	add    $0x8,%eax
+  80048c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80048f:	8b 3a                	mov    (%rdx),%edi
+  800491:	4c 89 ee             	mov    %r13,%rsi
+  800494:	41 ff d6             	call   *%r14
+            break;
+  800497:	e9 c3 fe ff ff       	jmp    80035f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80049c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a8:	eb e5                	jmp    80048f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b0:	77 5a                	ja     80050c <vprintfmt+0x1de>
+  8004b2:	89 c2                	mov    %eax,%edx
+  8004b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b8:	83 c0 08             	add    $0x8,%eax
+  8004bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004be:	8b 02                	mov    (%rdx),%eax
+  8004c0:	89 c1                	mov    %eax,%ecx
+  8004c2:	f7 d9                	neg    %ecx
+  8004c4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c7:	83 f9 14             	cmp    $0x14,%ecx
+  8004ca:	7f 4e                	jg     80051a <vprintfmt+0x1ec>
+  8004cc:	48 63 c1             	movslq %ecx,%rax
+  8004cf:	48 ba 40 3b 80 00 00 	movabs $0x803b40,%rdx
+  8004d6:	00 00 00 
+  8004d9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004dd:	48 85 c0             	test   %rax,%rax
+  8004e0:	74 38                	je     80051a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004e2:	48 89 c1             	mov    %rax,%rcx
+  8004e5:	48 ba 19 3d 80 00 00 	movabs $0x803d19,%rdx
+  8004ec:	00 00 00 
+  8004ef:	4c 89 ee             	mov    %r13,%rsi
+  8004f2:	4c 89 f7             	mov    %r14,%rdi
+  8004f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fa:	49 b8 f1 02 80 00 00 	movabs $0x8002f1,%r8
+  800501:	00 00 00 
+  800504:	41 ff d0             	call   *%r8
+  800507:	e9 53 fe ff ff       	jmp    80035f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80050c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800510:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800514:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800518:	eb a4                	jmp    8004be <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80051a:	48 ba f4 36 80 00 00 	movabs $0x8036f4,%rdx
+  800521:	00 00 00 
+  800524:	4c 89 ee             	mov    %r13,%rsi
+  800527:	4c 89 f7             	mov    %r14,%rdi
+  80052a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052f:	49 b8 f1 02 80 00 00 	movabs $0x8002f1,%r8
+  800536:	00 00 00 
+  800539:	41 ff d0             	call   *%r8
+  80053c:	e9 1e fe ff ff       	jmp    80035f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800541:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800544:	83 f8 2f             	cmp    $0x2f,%eax
+  800547:	77 6c                	ja     8005b5 <vprintfmt+0x287>
+  800549:	89 c2                	mov    %eax,%edx
+  80054b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054f:	83 c0 08             	add    $0x8,%eax
+  800552:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800555:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800558:	48 85 d2             	test   %rdx,%rdx
+  80055b:	48 b8 ed 36 80 00 00 	movabs $0x8036ed,%rax
+  800562:	00 00 00 
+  800565:	48 0f 45 c2          	cmovne %rdx,%rax
+  800569:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80056d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800571:	7e 06                	jle    800579 <vprintfmt+0x24b>
+  800573:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800577:	75 4a                	jne    8005c3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800579:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80057d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800581:	0f b6 00             	movzbl (%rax),%eax
+  800584:	84 c0                	test   %al,%al
+  800586:	0f 85 9a 00 00 00    	jne    800626 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80058c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80058f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800593:	85 c0                	test   %eax,%eax
+  800595:	0f 8e c4 fd ff ff    	jle    80035f <vprintfmt+0x31>
+  80059b:	4c 89 ee             	mov    %r13,%rsi
+  80059e:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005a3:	41 ff d6             	call   *%r14
+  8005a6:	41 83 ec 01          	sub    $0x1,%r12d
+  8005aa:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005ae:	75 eb                	jne    80059b <vprintfmt+0x26d>
+  8005b0:	e9 aa fd ff ff       	jmp    80035f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c1:	eb 92                	jmp    800555 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005c3:	49 63 f7             	movslq %r15d,%rsi
+  8005c6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005ca:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  8005d1:	00 00 00 
+  8005d4:	ff d0                	call   *%rax
+  8005d6:	48 89 c2             	mov    %rax,%rdx
+  8005d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005dc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005de:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005e1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005e4:	85 c0                	test   %eax,%eax
+  8005e6:	7e 91                	jle    800579 <vprintfmt+0x24b>
+  8005e8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005ed:	4c 89 ee             	mov    %r13,%rsi
+  8005f0:	44 89 e7             	mov    %r12d,%edi
+  8005f3:	41 ff d6             	call   *%r14
+  8005f6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005fa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005fd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800600:	75 eb                	jne    8005ed <vprintfmt+0x2bf>
+  800602:	e9 72 ff ff ff       	jmp    800579 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800607:	0f b6 f8             	movzbl %al,%edi
+  80060a:	4c 89 ee             	mov    %r13,%rsi
+  80060d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800610:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800614:	49 83 c4 01          	add    $0x1,%r12
+  800618:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80061e:	84 c0                	test   %al,%al
+  800620:	0f 84 66 ff ff ff    	je     80058c <vprintfmt+0x25e>
+  800626:	45 85 ff             	test   %r15d,%r15d
+  800629:	78 0a                	js     800635 <vprintfmt+0x307>
+  80062b:	41 83 ef 01          	sub    $0x1,%r15d
+  80062f:	0f 88 57 ff ff ff    	js     80058c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800635:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800639:	74 cc                	je     800607 <vprintfmt+0x2d9>
+  80063b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80063e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800643:	80 fa 5e             	cmp    $0x5e,%dl
+  800646:	77 c2                	ja     80060a <vprintfmt+0x2dc>
+  800648:	eb bd                	jmp    800607 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80064a:	40 84 f6             	test   %sil,%sil
+  80064d:	75 26                	jne    800675 <vprintfmt+0x347>
+    switch (lflag) {
+  80064f:	85 d2                	test   %edx,%edx
+  800651:	74 59                	je     8006ac <vprintfmt+0x37e>
+  800653:	83 fa 01             	cmp    $0x1,%edx
+  800656:	74 7b                	je     8006d3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800658:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065b:	83 f8 2f             	cmp    $0x2f,%eax
+  80065e:	0f 87 96 00 00 00    	ja     8006fa <vprintfmt+0x3cc>
+  800664:	89 c2                	mov    %eax,%edx
+  800666:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066a:	83 c0 08             	add    $0x8,%eax
+  80066d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800670:	4c 8b 22             	mov    (%rdx),%r12
+  800673:	eb 17                	jmp    80068c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800675:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800678:	83 f8 2f             	cmp    $0x2f,%eax
+  80067b:	77 21                	ja     80069e <vprintfmt+0x370>
+  80067d:	89 c2                	mov    %eax,%edx
+  80067f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800683:	83 c0 08             	add    $0x8,%eax
+  800686:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800689:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80068c:	4d 85 e4             	test   %r12,%r12
+  80068f:	78 7a                	js     80070b <vprintfmt+0x3dd>
+            num = i;
+  800691:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800694:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800699:	e9 50 02 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80069e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006aa:	eb dd                	jmp    800689 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006af:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b2:	77 11                	ja     8006c5 <vprintfmt+0x397>
+  8006b4:	89 c2                	mov    %eax,%edx
+  8006b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ba:	83 c0 08             	add    $0x8,%eax
+  8006bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c0:	4c 63 22             	movslq (%rdx),%r12
+  8006c3:	eb c7                	jmp    80068c <vprintfmt+0x35e>
+  8006c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d1:	eb ed                	jmp    8006c0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d9:	77 11                	ja     8006ec <vprintfmt+0x3be>
+  8006db:	89 c2                	mov    %eax,%edx
+  8006dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e1:	83 c0 08             	add    $0x8,%eax
+  8006e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e7:	4c 8b 22             	mov    (%rdx),%r12
+  8006ea:	eb a0                	jmp    80068c <vprintfmt+0x35e>
+  8006ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	eb ed                	jmp    8006e7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800702:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800706:	e9 65 ff ff ff       	jmp    800670 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80070b:	4c 89 ee             	mov    %r13,%rsi
+  80070e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800713:	41 ff d6             	call   *%r14
+                i = -i;
+  800716:	49 f7 dc             	neg    %r12
+  800719:	e9 73 ff ff ff       	jmp    800691 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80071e:	40 84 f6             	test   %sil,%sil
+  800721:	75 32                	jne    800755 <vprintfmt+0x427>
+    switch (lflag) {
+  800723:	85 d2                	test   %edx,%edx
+  800725:	74 5d                	je     800784 <vprintfmt+0x456>
+  800727:	83 fa 01             	cmp    $0x1,%edx
+  80072a:	0f 84 82 00 00 00    	je     8007b2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	0f 87 a5 00 00 00    	ja     8007e1 <vprintfmt+0x4b3>
+  80073c:	89 c2                	mov    %eax,%edx
+  80073e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800742:	83 c0 08             	add    $0x8,%eax
+  800745:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800748:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80074b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800750:	e9 99 01 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800755:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800758:	83 f8 2f             	cmp    $0x2f,%eax
+  80075b:	77 19                	ja     800776 <vprintfmt+0x448>
+  80075d:	89 c2                	mov    %eax,%edx
+  80075f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800763:	83 c0 08             	add    $0x8,%eax
+  800766:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800769:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80076c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800771:	e9 78 01 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+  800776:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800782:	eb e5                	jmp    800769 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800784:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800787:	83 f8 2f             	cmp    $0x2f,%eax
+  80078a:	77 18                	ja     8007a4 <vprintfmt+0x476>
+  80078c:	89 c2                	mov    %eax,%edx
+  80078e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800792:	83 c0 08             	add    $0x8,%eax
+  800795:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800798:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80079a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80079f:	e9 4a 01 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+  8007a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b0:	eb e6                	jmp    800798 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b8:	77 19                	ja     8007d3 <vprintfmt+0x4a5>
+  8007ba:	89 c2                	mov    %eax,%edx
+  8007bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c0:	83 c0 08             	add    $0x8,%eax
+  8007c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007ce:	e9 1b 01 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb e5                	jmp    8007c6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ed:	e9 56 ff ff ff       	jmp    800748 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f2:	40 84 f6             	test   %sil,%sil
+  8007f5:	75 2e                	jne    800825 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007f7:	85 d2                	test   %edx,%edx
+  8007f9:	74 59                	je     800854 <vprintfmt+0x526>
+  8007fb:	83 fa 01             	cmp    $0x1,%edx
+  8007fe:	74 7f                	je     80087f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	0f 87 9f 00 00 00    	ja     8008ab <vprintfmt+0x57d>
+  80080c:	89 c2                	mov    %eax,%edx
+  80080e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800812:	83 c0 08             	add    $0x8,%eax
+  800815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800818:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80081b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800820:	e9 c9 00 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800825:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800828:	83 f8 2f             	cmp    $0x2f,%eax
+  80082b:	77 19                	ja     800846 <vprintfmt+0x518>
+  80082d:	89 c2                	mov    %eax,%edx
+  80082f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800833:	83 c0 08             	add    $0x8,%eax
+  800836:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800839:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80083c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800841:	e9 a8 00 00 00       	jmp    8008ee <vprintfmt+0x5c0>
+  800846:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800852:	eb e5                	jmp    800839 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800854:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800857:	83 f8 2f             	cmp    $0x2f,%eax
+  80085a:	77 15                	ja     800871 <vprintfmt+0x543>
+  80085c:	89 c2                	mov    %eax,%edx
+  80085e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800862:	83 c0 08             	add    $0x8,%eax
+  800865:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800868:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80086a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80086f:	eb 7d                	jmp    8008ee <vprintfmt+0x5c0>
+  800871:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800875:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800879:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087d:	eb e9                	jmp    800868 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80087f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800882:	83 f8 2f             	cmp    $0x2f,%eax
+  800885:	77 16                	ja     80089d <vprintfmt+0x56f>
+  800887:	89 c2                	mov    %eax,%edx
+  800889:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088d:	83 c0 08             	add    $0x8,%eax
+  800890:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800893:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800896:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80089b:	eb 51                	jmp    8008ee <vprintfmt+0x5c0>
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	eb e8                	jmp    800893 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	e9 5c ff ff ff       	jmp    800818 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008bc:	4c 89 ee             	mov    %r13,%rsi
+  8008bf:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008c4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008c7:	4c 89 ee             	mov    %r13,%rsi
+  8008ca:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008cf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d8:	77 47                	ja     800921 <vprintfmt+0x5f3>
+  8008da:	89 c2                	mov    %eax,%edx
+  8008dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e0:	83 c0 08             	add    $0x8,%eax
+  8008e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8008f2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008f6:	0f 94 c0             	sete   %al
+  8008f9:	0f b6 c0             	movzbl %al,%eax
+  8008fc:	50                   	push   %rax
+  8008fd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800902:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800906:	4c 89 ee             	mov    %r13,%rsi
+  800909:	4c 89 f7             	mov    %r14,%rdi
+  80090c:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  800913:	00 00 00 
+  800916:	ff d0                	call   *%rax
+            break;
+  800918:	48 83 c4 10          	add    $0x10,%rsp
+  80091c:	e9 3e fa ff ff       	jmp    80035f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800921:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800925:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800929:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092d:	eb b7                	jmp    8008e6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80092f:	40 84 f6             	test   %sil,%sil
+  800932:	75 2b                	jne    80095f <vprintfmt+0x631>
+    switch (lflag) {
+  800934:	85 d2                	test   %edx,%edx
+  800936:	74 56                	je     80098e <vprintfmt+0x660>
+  800938:	83 fa 01             	cmp    $0x1,%edx
+  80093b:	74 7f                	je     8009bc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80093d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800940:	83 f8 2f             	cmp    $0x2f,%eax
+  800943:	0f 87 a2 00 00 00    	ja     8009eb <vprintfmt+0x6bd>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800958:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80095d:	eb 8f                	jmp    8008ee <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 19                	ja     800980 <vprintfmt+0x652>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800976:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80097b:	e9 6e ff ff ff       	jmp    8008ee <vprintfmt+0x5c0>
+  800980:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800984:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800988:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098c:	eb e5                	jmp    800973 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80098e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800991:	83 f8 2f             	cmp    $0x2f,%eax
+  800994:	77 18                	ja     8009ae <vprintfmt+0x680>
+  800996:	89 c2                	mov    %eax,%edx
+  800998:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099c:	83 c0 08             	add    $0x8,%eax
+  80099f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009a4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a9:	e9 40 ff ff ff       	jmp    8008ee <vprintfmt+0x5c0>
+  8009ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ba:	eb e6                	jmp    8009a2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c2:	77 19                	ja     8009dd <vprintfmt+0x6af>
+  8009c4:	89 c2                	mov    %eax,%edx
+  8009c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ca:	83 c0 08             	add    $0x8,%eax
+  8009cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d8:	e9 11 ff ff ff       	jmp    8008ee <vprintfmt+0x5c0>
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	eb e5                	jmp    8009d0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f7:	e9 59 ff ff ff       	jmp    800955 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009fc:	4c 89 ee             	mov    %r13,%rsi
+  8009ff:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a04:	41 ff d6             	call   *%r14
+            break;
+  800a07:	e9 53 f9 ff ff       	jmp    80035f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a0c:	4c 89 ee             	mov    %r13,%rsi
+  800a0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a14:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a17:	48 83 eb 01          	sub    $0x1,%rbx
+  800a1b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a1f:	75 f6                	jne    800a17 <vprintfmt+0x6e9>
+  800a21:	e9 39 f9 ff ff       	jmp    80035f <vprintfmt+0x31>
+}
+  800a26:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a2a:	5b                   	pop    %rbx
+  800a2b:	41 5c                	pop    %r12
+  800a2d:	41 5d                	pop    %r13
+  800a2f:	41 5e                	pop    %r14
+  800a31:	41 5f                	pop    %r15
+  800a33:	5d                   	pop    %rbp
+  800a34:	c3                   	ret
+
+0000000000800a35 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a35:	55                   	push   %rbp
+  800a36:	48 89 e5             	mov    %rsp,%rbp
+  800a39:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a41:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a46:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a4a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a51:	48 85 ff             	test   %rdi,%rdi
+  800a54:	74 2b                	je     800a81 <vsnprintf+0x4c>
+  800a56:	48 85 f6             	test   %rsi,%rsi
+  800a59:	74 26                	je     800a81 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a5b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a5f:	48 bf d9 02 80 00 00 	movabs $0x8002d9,%rdi
+  800a66:	00 00 00 
+  800a69:	48 b8 2e 03 80 00 00 	movabs $0x80032e,%rax
+  800a70:	00 00 00 
+  800a73:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a79:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a7c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a7f:	c9                   	leave
+  800a80:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a86:	eb f7                	jmp    800a7f <vsnprintf+0x4a>
+
+0000000000800a88 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a88:	55                   	push   %rbp
+  800a89:	48 89 e5             	mov    %rsp,%rbp
+  800a8c:	48 83 ec 50          	sub    $0x50,%rsp
+  800a90:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a94:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a98:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a9c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aaf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ab3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab7:	48 b8 35 0a 80 00 00 	movabs $0x800a35,%rax
+  800abe:	00 00 00 
+  800ac1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+
+0000000000800ac5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ac5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ac8:	74 10                	je     800ada <strlen+0x15>
+    size_t n = 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800acf:	48 83 c0 01          	add    $0x1,%rax
+  800ad3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad7:	75 f6                	jne    800acf <strlen+0xa>
+  800ad9:	c3                   	ret
+    size_t n = 0;
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800adf:	c3                   	ret
+
+0000000000800ae0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ae0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ae8:	48 85 f6             	test   %rsi,%rsi
+  800aeb:	74 11                	je     800afe <strnlen+0x1e>
+  800aed:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800af1:	74 0c                	je     800aff <strnlen+0x1f>
+  800af3:	48 83 c2 01          	add    $0x1,%rdx
+  800af7:	48 39 d0             	cmp    %rdx,%rax
+  800afa:	75 f1                	jne    800aed <strnlen+0xd>
+  800afc:	eb 04                	jmp    800b02 <strnlen+0x22>
+  800afe:	c3                   	ret
+  800aff:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b02:	c3                   	ret
+
+0000000000800b03 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b03:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b0f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b12:	48 83 c2 01          	add    $0x1,%rdx
+  800b16:	84 c9                	test   %cl,%cl
+  800b18:	75 f1                	jne    800b0b <strcpy+0x8>
+        ;
+    return res;
+}
+  800b1a:	c3                   	ret
+
+0000000000800b1b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b1b:	55                   	push   %rbp
+  800b1c:	48 89 e5             	mov    %rsp,%rbp
+  800b1f:	41 54                	push   %r12
+  800b21:	53                   	push   %rbx
+  800b22:	48 89 fb             	mov    %rdi,%rbx
+  800b25:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b28:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b34:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b38:	4c 89 e6             	mov    %r12,%rsi
+  800b3b:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  800b42:	00 00 00 
+  800b45:	ff d0                	call   *%rax
+    return dst;
+}
+  800b47:	48 89 d8             	mov    %rbx,%rax
+  800b4a:	5b                   	pop    %rbx
+  800b4b:	41 5c                	pop    %r12
+  800b4d:	5d                   	pop    %rbp
+  800b4e:	c3                   	ret
+
+0000000000800b4f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b4f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b52:	48 85 d2             	test   %rdx,%rdx
+  800b55:	74 1f                	je     800b76 <strncpy+0x27>
+  800b57:	48 01 fa             	add    %rdi,%rdx
+  800b5a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b5d:	48 83 c1 01          	add    $0x1,%rcx
+  800b61:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b65:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b69:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b6d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b71:	48 39 ca             	cmp    %rcx,%rdx
+  800b74:	75 e7                	jne    800b5d <strncpy+0xe>
+    }
+    return ret;
+}
+  800b76:	c3                   	ret
+
+0000000000800b77 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b77:	48 89 f8             	mov    %rdi,%rax
+  800b7a:	48 85 d2             	test   %rdx,%rdx
+  800b7d:	74 24                	je     800ba3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b7f:	48 83 ea 01          	sub    $0x1,%rdx
+  800b83:	74 1b                	je     800ba0 <strlcpy+0x29>
+  800b85:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b89:	0f b6 16             	movzbl (%rsi),%edx
+  800b8c:	84 d2                	test   %dl,%dl
+  800b8e:	74 10                	je     800ba0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b90:	48 83 c6 01          	add    $0x1,%rsi
+  800b94:	48 83 c0 01          	add    $0x1,%rax
+  800b98:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b9b:	48 39 c8             	cmp    %rcx,%rax
+  800b9e:	75 e9                	jne    800b89 <strlcpy+0x12>
+        *dst = '\0';
+  800ba0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ba3:	48 29 f8             	sub    %rdi,%rax
+}
+  800ba6:	c3                   	ret
+
+0000000000800ba7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ba7:	0f b6 07             	movzbl (%rdi),%eax
+  800baa:	84 c0                	test   %al,%al
+  800bac:	74 13                	je     800bc1 <strcmp+0x1a>
+  800bae:	38 06                	cmp    %al,(%rsi)
+  800bb0:	75 0f                	jne    800bc1 <strcmp+0x1a>
+  800bb2:	48 83 c7 01          	add    $0x1,%rdi
+  800bb6:	48 83 c6 01          	add    $0x1,%rsi
+  800bba:	0f b6 07             	movzbl (%rdi),%eax
+  800bbd:	84 c0                	test   %al,%al
+  800bbf:	75 ed                	jne    800bae <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bc1:	0f b6 c0             	movzbl %al,%eax
+  800bc4:	0f b6 16             	movzbl (%rsi),%edx
+  800bc7:	29 d0                	sub    %edx,%eax
+}
+  800bc9:	c3                   	ret
+
+0000000000800bca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bca:	48 85 d2             	test   %rdx,%rdx
+  800bcd:	74 1f                	je     800bee <strncmp+0x24>
+  800bcf:	0f b6 07             	movzbl (%rdi),%eax
+  800bd2:	84 c0                	test   %al,%al
+  800bd4:	74 1e                	je     800bf4 <strncmp+0x2a>
+  800bd6:	3a 06                	cmp    (%rsi),%al
+  800bd8:	75 1a                	jne    800bf4 <strncmp+0x2a>
+  800bda:	48 83 c7 01          	add    $0x1,%rdi
+  800bde:	48 83 c6 01          	add    $0x1,%rsi
+  800be2:	48 83 ea 01          	sub    $0x1,%rdx
+  800be6:	75 e7                	jne    800bcf <strncmp+0x5>
+
+    if (!n) return 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bed:	c3                   	ret
+  800bee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf3:	c3                   	ret
+  800bf4:	48 85 d2             	test   %rdx,%rdx
+  800bf7:	74 09                	je     800c02 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf9:	0f b6 07             	movzbl (%rdi),%eax
+  800bfc:	0f b6 16             	movzbl (%rsi),%edx
+  800bff:	29 d0                	sub    %edx,%eax
+  800c01:	c3                   	ret
+    if (!n) return 0;
+  800c02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c07:	c3                   	ret
+
+0000000000800c08 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c08:	0f b6 17             	movzbl (%rdi),%edx
+  800c0b:	84 d2                	test   %dl,%dl
+  800c0d:	74 18                	je     800c27 <strchr+0x1f>
+        if (*str == c) {
+  800c0f:	0f be d2             	movsbl %dl,%edx
+  800c12:	39 f2                	cmp    %esi,%edx
+  800c14:	74 17                	je     800c2d <strchr+0x25>
+    for (; *str; str++) {
+  800c16:	48 83 c7 01          	add    $0x1,%rdi
+  800c1a:	0f b6 17             	movzbl (%rdi),%edx
+  800c1d:	84 d2                	test   %dl,%dl
+  800c1f:	75 ee                	jne    800c0f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	c3                   	ret
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	c3                   	ret
+  800c2d:	48 89 f8             	mov    %rdi,%rax
+}
+  800c30:	c3                   	ret
+
+0000000000800c31 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c31:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c34:	0f b6 17             	movzbl (%rdi),%edx
+  800c37:	84 d2                	test   %dl,%dl
+  800c39:	74 13                	je     800c4e <strfind+0x1d>
+  800c3b:	0f be d2             	movsbl %dl,%edx
+  800c3e:	39 f2                	cmp    %esi,%edx
+  800c40:	74 0b                	je     800c4d <strfind+0x1c>
+  800c42:	48 83 c0 01          	add    $0x1,%rax
+  800c46:	0f b6 10             	movzbl (%rax),%edx
+  800c49:	84 d2                	test   %dl,%dl
+  800c4b:	75 ee                	jne    800c3b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c4d:	c3                   	ret
+  800c4e:	c3                   	ret
+
+0000000000800c4f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c4f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c52:	48 89 f8             	mov    %rdi,%rax
+  800c55:	48 f7 d8             	neg    %rax
+  800c58:	83 e0 07             	and    $0x7,%eax
+  800c5b:	49 89 d1             	mov    %rdx,%r9
+  800c5e:	49 29 c1             	sub    %rax,%r9
+  800c61:	78 36                	js     800c99 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c63:	40 0f b6 c6          	movzbl %sil,%eax
+  800c67:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c6e:	01 01 01 
+  800c71:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c75:	40 f6 c7 07          	test   $0x7,%dil
+  800c79:	75 38                	jne    800cb3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c7b:	4c 89 c9             	mov    %r9,%rcx
+  800c7e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c82:	74 0c                	je     800c90 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c84:	fc                   	cld
+  800c85:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c88:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c8c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c90:	4d 85 c9             	test   %r9,%r9
+  800c93:	75 45                	jne    800cda <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c95:	4c 89 c0             	mov    %r8,%rax
+  800c98:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c99:	48 85 d2             	test   %rdx,%rdx
+  800c9c:	74 f7                	je     800c95 <memset+0x46>
+  800c9e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ca1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ca4:	48 83 c0 01          	add    $0x1,%rax
+  800ca8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cac:	48 39 c2             	cmp    %rax,%rdx
+  800caf:	75 f3                	jne    800ca4 <memset+0x55>
+  800cb1:	eb e2                	jmp    800c95 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cb3:	40 f6 c7 01          	test   $0x1,%dil
+  800cb7:	74 06                	je     800cbf <memset+0x70>
+  800cb9:	88 07                	mov    %al,(%rdi)
+  800cbb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cbf:	40 f6 c7 02          	test   $0x2,%dil
+  800cc3:	74 07                	je     800ccc <memset+0x7d>
+  800cc5:	66 89 07             	mov    %ax,(%rdi)
+  800cc8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ccc:	40 f6 c7 04          	test   $0x4,%dil
+  800cd0:	74 a9                	je     800c7b <memset+0x2c>
+  800cd2:	89 07                	mov    %eax,(%rdi)
+  800cd4:	48 83 c7 04          	add    $0x4,%rdi
+  800cd8:	eb a1                	jmp    800c7b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cda:	41 f6 c1 04          	test   $0x4,%r9b
+  800cde:	74 06                	je     800ce6 <memset+0x97>
+  800ce0:	89 07                	mov    %eax,(%rdi)
+  800ce2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ce6:	41 f6 c1 02          	test   $0x2,%r9b
+  800cea:	74 07                	je     800cf3 <memset+0xa4>
+  800cec:	66 89 07             	mov    %ax,(%rdi)
+  800cef:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cf3:	41 f6 c1 01          	test   $0x1,%r9b
+  800cf7:	74 9c                	je     800c95 <memset+0x46>
+  800cf9:	88 07                	mov    %al,(%rdi)
+  800cfb:	eb 98                	jmp    800c95 <memset+0x46>
+
+0000000000800cfd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cfd:	48 89 f8             	mov    %rdi,%rax
+  800d00:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d03:	48 39 fe             	cmp    %rdi,%rsi
+  800d06:	73 3b                	jae    800d43 <memmove+0x46>
+  800d08:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d0c:	48 39 d7             	cmp    %rdx,%rdi
+  800d0f:	73 32                	jae    800d43 <memmove+0x46>
+        s += n;
+        d += n;
+  800d11:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d15:	48 89 d6             	mov    %rdx,%rsi
+  800d18:	48 09 fe             	or     %rdi,%rsi
+  800d1b:	48 09 ce             	or     %rcx,%rsi
+  800d1e:	40 f6 c6 07          	test   $0x7,%sil
+  800d22:	75 12                	jne    800d36 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d24:	48 83 ef 08          	sub    $0x8,%rdi
+  800d28:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d2c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d30:	fd                   	std
+  800d31:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d34:	fc                   	cld
+  800d35:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d36:	48 83 ef 01          	sub    $0x1,%rdi
+  800d3a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d3e:	fd                   	std
+  800d3f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d41:	eb f1                	jmp    800d34 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d43:	48 89 f2             	mov    %rsi,%rdx
+  800d46:	48 09 c2             	or     %rax,%rdx
+  800d49:	48 09 ca             	or     %rcx,%rdx
+  800d4c:	f6 c2 07             	test   $0x7,%dl
+  800d4f:	75 0c                	jne    800d5d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d51:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d55:	48 89 c7             	mov    %rax,%rdi
+  800d58:	fc                   	cld
+  800d59:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d5c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d5d:	48 89 c7             	mov    %rax,%rdi
+  800d60:	fc                   	cld
+  800d61:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d63:	c3                   	ret
+
+0000000000800d64 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d64:	55                   	push   %rbp
+  800d65:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d68:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+}
+  800d74:	5d                   	pop    %rbp
+  800d75:	c3                   	ret
+
+0000000000800d76 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d76:	55                   	push   %rbp
+  800d77:	48 89 e5             	mov    %rsp,%rbp
+  800d7a:	41 57                	push   %r15
+  800d7c:	41 56                	push   %r14
+  800d7e:	41 55                	push   %r13
+  800d80:	41 54                	push   %r12
+  800d82:	53                   	push   %rbx
+  800d83:	48 83 ec 08          	sub    $0x8,%rsp
+  800d87:	49 89 fe             	mov    %rdi,%r14
+  800d8a:	49 89 f7             	mov    %rsi,%r15
+  800d8d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d90:	48 89 f7             	mov    %rsi,%rdi
+  800d93:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+  800d9f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800da2:	48 89 de             	mov    %rbx,%rsi
+  800da5:	4c 89 f7             	mov    %r14,%rdi
+  800da8:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+  800db4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800db7:	48 39 c3             	cmp    %rax,%rbx
+  800dba:	74 36                	je     800df2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dbc:	48 89 d8             	mov    %rbx,%rax
+  800dbf:	4c 29 e8             	sub    %r13,%rax
+  800dc2:	49 39 c4             	cmp    %rax,%r12
+  800dc5:	73 31                	jae    800df8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dc7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dcc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dd0:	4c 89 fe             	mov    %r15,%rsi
+  800dd3:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  800dda:	00 00 00 
+  800ddd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ddf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800de3:	48 83 c4 08          	add    $0x8,%rsp
+  800de7:	5b                   	pop    %rbx
+  800de8:	41 5c                	pop    %r12
+  800dea:	41 5d                	pop    %r13
+  800dec:	41 5e                	pop    %r14
+  800dee:	41 5f                	pop    %r15
+  800df0:	5d                   	pop    %rbp
+  800df1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800df6:	eb eb                	jmp    800de3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800df8:	48 83 eb 01          	sub    $0x1,%rbx
+  800dfc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e00:	48 89 da             	mov    %rbx,%rdx
+  800e03:	4c 89 fe             	mov    %r15,%rsi
+  800e06:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  800e0d:	00 00 00 
+  800e10:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e12:	49 01 de             	add    %rbx,%r14
+  800e15:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e1a:	eb c3                	jmp    800ddf <strlcat+0x69>
+
+0000000000800e1c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e1c:	48 85 d2             	test   %rdx,%rdx
+  800e1f:	74 2d                	je     800e4e <memcmp+0x32>
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e26:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e2a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e2f:	44 38 c1             	cmp    %r8b,%cl
+  800e32:	75 0f                	jne    800e43 <memcmp+0x27>
+    while (n-- > 0) {
+  800e34:	48 83 c0 01          	add    $0x1,%rax
+  800e38:	48 39 c2             	cmp    %rax,%rdx
+  800e3b:	75 e9                	jne    800e26 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e42:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e43:	0f b6 c1             	movzbl %cl,%eax
+  800e46:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e4a:	44 29 c0             	sub    %r8d,%eax
+  800e4d:	c3                   	ret
+    return 0;
+  800e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e53:	c3                   	ret
+
+0000000000800e54 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e54:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e58:	48 39 c7             	cmp    %rax,%rdi
+  800e5b:	73 0f                	jae    800e6c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e5d:	40 38 37             	cmp    %sil,(%rdi)
+  800e60:	74 0e                	je     800e70 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e62:	48 83 c7 01          	add    $0x1,%rdi
+  800e66:	48 39 f8             	cmp    %rdi,%rax
+  800e69:	75 f2                	jne    800e5d <memfind+0x9>
+  800e6b:	c3                   	ret
+  800e6c:	48 89 f8             	mov    %rdi,%rax
+  800e6f:	c3                   	ret
+  800e70:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e73:	c3                   	ret
+
+0000000000800e74 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e74:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e77:	0f b6 37             	movzbl (%rdi),%esi
+  800e7a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7e:	74 06                	je     800e86 <strtol+0x12>
+  800e80:	40 80 fe 09          	cmp    $0x9,%sil
+  800e84:	75 13                	jne    800e99 <strtol+0x25>
+  800e86:	48 83 c7 01          	add    $0x1,%rdi
+  800e8a:	0f b6 37             	movzbl (%rdi),%esi
+  800e8d:	40 80 fe 20          	cmp    $0x20,%sil
+  800e91:	74 f3                	je     800e86 <strtol+0x12>
+  800e93:	40 80 fe 09          	cmp    $0x9,%sil
+  800e97:	74 ed                	je     800e86 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e99:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e9c:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e9f:	3c 01                	cmp    $0x1,%al
+  800ea1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ea5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800eab:	75 0f                	jne    800ebc <strtol+0x48>
+  800ead:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eb0:	74 14                	je     800ec6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eb2:	85 d2                	test   %edx,%edx
+  800eb4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ec1:	4c 63 ca             	movslq %edx,%r9
+  800ec4:	eb 36                	jmp    800efc <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ec6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eca:	74 0f                	je     800edb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ecc:	85 d2                	test   %edx,%edx
+  800ece:	75 ec                	jne    800ebc <strtol+0x48>
+        s++;
+  800ed0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ed4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed9:	eb e1                	jmp    800ebc <strtol+0x48>
+        s += 2;
+  800edb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800edf:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ee4:	eb d6                	jmp    800ebc <strtol+0x48>
+            dig -= '0';
+  800ee6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee9:	44 0f b6 c1          	movzbl %cl,%r8d
+  800eed:	41 39 d0             	cmp    %edx,%r8d
+  800ef0:	7d 21                	jge    800f13 <strtol+0x9f>
+        val = val * base + dig;
+  800ef2:	49 0f af c1          	imul   %r9,%rax
+  800ef6:	0f b6 c9             	movzbl %cl,%ecx
+  800ef9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800efc:	48 83 c7 01          	add    $0x1,%rdi
+  800f00:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f04:	80 f9 39             	cmp    $0x39,%cl
+  800f07:	76 dd                	jbe    800ee6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f09:	80 f9 7b             	cmp    $0x7b,%cl
+  800f0c:	77 05                	ja     800f13 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f0e:	83 e9 57             	sub    $0x57,%ecx
+  800f11:	eb d6                	jmp    800ee9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f13:	4d 85 d2             	test   %r10,%r10
+  800f16:	74 03                	je     800f1b <strtol+0xa7>
+  800f18:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f1b:	48 89 c2             	mov    %rax,%rdx
+  800f1e:	48 f7 da             	neg    %rdx
+  800f21:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f25:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strrev>:
+
+void
+strrev(char *str)
+{
+  800f2a:	55                   	push   %rbp
+  800f2b:	48 89 e5             	mov    %rsp,%rbp
+  800f2e:	53                   	push   %rbx
+  800f2f:	48 83 ec 08          	sub    $0x8,%rsp
+  800f33:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f36:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  800f3d:	00 00 00 
+  800f40:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f42:	83 e8 01             	sub    $0x1,%eax
+  800f45:	85 c0                	test   %eax,%eax
+  800f47:	7e 22                	jle    800f6b <strrev+0x41>
+  800f49:	48 98                	cltq
+  800f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f50:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f54:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f58:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f5c:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f5f:	48 83 c2 01          	add    $0x1,%rdx
+  800f63:	48 83 e8 01          	sub    $0x1,%rax
+  800f67:	39 c2                	cmp    %eax,%edx
+  800f69:	7c e5                	jl     800f50 <strrev+0x26>
+	}
+}
+  800f6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6f:	c9                   	leave
+  800f70:	c3                   	ret
+
+0000000000800f71 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f71:	85 d2                	test   %edx,%edx
+  800f73:	0f 84 80 00 00 00    	je     800ff9 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f79:	55                   	push   %rbp
+  800f7a:	48 89 e5             	mov    %rsp,%rbp
+  800f7d:	53                   	push   %rbx
+  800f7e:	48 83 ec 08          	sub    $0x8,%rsp
+  800f82:	49 89 f2             	mov    %rsi,%r10
+  800f85:	41 89 d3             	mov    %edx,%r11d
+  800f88:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f8b:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800f90:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800f93:	eb 20                	jmp    800fb5 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800f95:	41 89 f1             	mov    %esi,%r9d
+  800f98:	83 c2 30             	add    $0x30,%edx
+  800f9b:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800f9e:	89 f8                	mov    %edi,%eax
+  800fa0:	99                   	cltd
+  800fa1:	f7 f9                	idiv   %ecx
+  800fa3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	74 2e                	je     800fd7 <itoa+0x66>
+  800fa9:	83 c6 01             	add    $0x1,%esi
+  800fac:	49 83 c0 01          	add    $0x1,%r8
+  800fb0:	44 39 cb             	cmp    %r9d,%ebx
+  800fb3:	7e 15                	jle    800fca <itoa+0x59>
+		digit = sum % base;
+  800fb5:	89 f8                	mov    %edi,%eax
+  800fb7:	99                   	cltd
+  800fb8:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fba:	83 fa 09             	cmp    $0x9,%edx
+  800fbd:	7e d6                	jle    800f95 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800fbf:	41 89 f1             	mov    %esi,%r9d
+  800fc2:	83 c2 37             	add    $0x37,%edx
+  800fc5:	41 88 10             	mov    %dl,(%r8)
+  800fc8:	eb d4                	jmp    800f9e <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fca:	41 83 eb 01          	sub    $0x1,%r11d
+  800fce:	45 39 cb             	cmp    %r9d,%r11d
+  800fd1:	75 04                	jne    800fd7 <itoa+0x66>
+  800fd3:	85 c0                	test   %eax,%eax
+  800fd5:	75 28                	jne    800fff <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fd7:	4d 63 c9             	movslq %r9d,%r9
+  800fda:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fdf:	4c 89 d7             	mov    %r10,%rdi
+  800fe2:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+	return 0;
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff7:	c9                   	leave
+  800ff8:	c3                   	ret
+		return -1;
+  800ff9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800ffe:	c3                   	ret
+		return -1;
+  800fff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801004:	eb ed                	jmp    800ff3 <itoa+0x82>
+
+0000000000801006 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801006:	55                   	push   %rbp
+  801007:	48 89 e5             	mov    %rsp,%rbp
+  80100a:	53                   	push   %rbx
+  80100b:	48 89 fa             	mov    %rdi,%rdx
+  80100e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80102b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80102d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801031:	c9                   	leave
+  801032:	c3                   	ret
+
+0000000000801033 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801033:	55                   	push   %rbp
+  801034:	48 89 e5             	mov    %rsp,%rbp
+  801037:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801038:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80103d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801042:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801047:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801051:	be 00 00 00 00       	mov    $0x0,%esi
+  801056:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80105c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80105e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801062:	c9                   	leave
+  801063:	c3                   	ret
+
+0000000000801064 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801064:	55                   	push   %rbp
+  801065:	48 89 e5             	mov    %rsp,%rbp
+  801068:	53                   	push   %rbx
+  801069:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80106d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801070:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801075:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80107a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801084:	be 00 00 00 00       	mov    $0x0,%esi
+  801089:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80108f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801091:	48 85 c0             	test   %rax,%rax
+  801094:	7f 06                	jg     80109c <sys_env_destroy+0x38>
+}
+  801096:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109a:	c9                   	leave
+  80109b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80109c:	49 89 c0             	mov    %rax,%r8
+  80109f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010a4:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8010ab:	00 00 00 
+  8010ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8010b3:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8010ba:	00 00 00 
+  8010bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c2:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  8010c9:	00 00 00 
+  8010cc:	41 ff d1             	call   *%r9
+
+00000000008010cf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010cf:	55                   	push   %rbp
+  8010d0:	48 89 e5             	mov    %rsp,%rbp
+  8010d3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010de:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fe:	c9                   	leave
+  8010ff:	c3                   	ret
+
+0000000000801100 <sys_yield>:
+
+void
+sys_yield(void) {
+  801100:	55                   	push   %rbp
+  801101:	48 89 e5             	mov    %rsp,%rbp
+  801104:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801105:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801114:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801119:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801129:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80112b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+0000000000801131 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801131:	55                   	push   %rbp
+  801132:	48 89 e5             	mov    %rsp,%rbp
+  801135:	53                   	push   %rbx
+  801136:	48 89 fa             	mov    %rdi,%rdx
+  801139:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80113c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801141:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801148:	00 00 00 
+  80114b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801150:	be 00 00 00 00       	mov    $0x0,%esi
+  801155:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80115d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801161:	c9                   	leave
+  801162:	c3                   	ret
+
+0000000000801163 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801163:	55                   	push   %rbp
+  801164:	48 89 e5             	mov    %rsp,%rbp
+  801167:	53                   	push   %rbx
+  801168:	49 89 f8             	mov    %rdi,%r8
+  80116b:	48 89 d3             	mov    %rdx,%rbx
+  80116e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801171:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801176:	4c 89 c2             	mov    %r8,%rdx
+  801179:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117c:	be 00 00 00 00       	mov    $0x0,%esi
+  801181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801187:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118d:	c9                   	leave
+  80118e:	c3                   	ret
+
+000000000080118f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80118f:	55                   	push   %rbp
+  801190:	48 89 e5             	mov    %rsp,%rbp
+  801193:	53                   	push   %rbx
+  801194:	48 83 ec 08          	sub    $0x8,%rsp
+  801198:	89 f8                	mov    %edi,%eax
+  80119a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80119d:	48 63 f9             	movslq %ecx,%rdi
+  8011a0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b8:	48 85 c0             	test   %rax,%rax
+  8011bb:	7f 06                	jg     8011c3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c1:	c9                   	leave
+  8011c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c3:	49 89 c0             	mov    %rax,%r8
+  8011c6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011cb:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8011d2:	00 00 00 
+  8011d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8011da:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8011e1:	00 00 00 
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e9:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  8011f0:	00 00 00 
+  8011f3:	41 ff d1             	call   *%r9
+
+00000000008011f6 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011f6:	55                   	push   %rbp
+  8011f7:	48 89 e5             	mov    %rsp,%rbp
+  8011fa:	53                   	push   %rbx
+  8011fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ff:	89 f8                	mov    %edi,%eax
+  801201:	49 89 f2             	mov    %rsi,%r10
+  801204:	48 89 cf             	mov    %rcx,%rdi
+  801207:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80120a:	48 63 da             	movslq %edx,%rbx
+  80120d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801210:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801215:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801218:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80121b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80121d:	48 85 c0             	test   %rax,%rax
+  801220:	7f 06                	jg     801228 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801228:	49 89 c0             	mov    %rax,%r8
+  80122b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801230:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801237:	00 00 00 
+  80123a:	be 26 00 00 00       	mov    $0x26,%esi
+  80123f:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801246:	00 00 00 
+  801249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124e:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  801255:	00 00 00 
+  801258:	41 ff d1             	call   *%r9
+
+000000000080125b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	53                   	push   %rbx
+  801260:	48 83 ec 08          	sub    $0x8,%rsp
+  801264:	48 89 f1             	mov    %rsi,%rcx
+  801267:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80126a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80126d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801272:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801277:	be 00 00 00 00       	mov    $0x0,%esi
+  80127c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801282:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801284:	48 85 c0             	test   %rax,%rax
+  801287:	7f 06                	jg     80128f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801289:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128d:	c9                   	leave
+  80128e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80128f:	49 89 c0             	mov    %rax,%r8
+  801292:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801297:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80129e:	00 00 00 
+  8012a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a6:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8012ad:	00 00 00 
+  8012b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b5:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  8012bc:	00 00 00 
+  8012bf:	41 ff d1             	call   *%r9
+
+00000000008012c2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012c2:	55                   	push   %rbp
+  8012c3:	48 89 e5             	mov    %rsp,%rbp
+  8012c6:	53                   	push   %rbx
+  8012c7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012cb:	48 63 ce             	movslq %esi,%rcx
+  8012ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ed:	48 85 c0             	test   %rax,%rax
+  8012f0:	7f 06                	jg     8012f8 <sys_env_set_status+0x36>
+}
+  8012f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f8:	49 89 c0             	mov    %rax,%r8
+  8012fb:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801300:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801307:	00 00 00 
+  80130a:	be 26 00 00 00       	mov    $0x26,%esi
+  80130f:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801316:	00 00 00 
+  801319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131e:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  801325:	00 00 00 
+  801328:	41 ff d1             	call   *%r9
+
+000000000080132b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+  80132f:	53                   	push   %rbx
+  801330:	48 83 ec 08          	sub    $0x8,%rsp
+  801334:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801337:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80133f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801344:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801349:	be 00 00 00 00       	mov    $0x0,%esi
+  80134e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801354:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801356:	48 85 c0             	test   %rax,%rax
+  801359:	7f 06                	jg     801361 <sys_env_set_trapframe+0x36>
+}
+  80135b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801361:	49 89 c0             	mov    %rax,%r8
+  801364:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801369:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801370:	00 00 00 
+  801373:	be 26 00 00 00       	mov    $0x26,%esi
+  801378:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  80137f:	00 00 00 
+  801382:	b8 00 00 00 00       	mov    $0x0,%eax
+  801387:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  80138e:	00 00 00 
+  801391:	41 ff d1             	call   *%r9
+
+0000000000801394 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801394:	55                   	push   %rbp
+  801395:	48 89 e5             	mov    %rsp,%rbp
+  801398:	53                   	push   %rbx
+  801399:	48 83 ec 08          	sub    $0x8,%rsp
+  80139d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013bf:	48 85 c0             	test   %rax,%rax
+  8013c2:	7f 06                	jg     8013ca <sys_env_set_pgfault_upcall+0x36>
+}
+  8013c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ca:	49 89 c0             	mov    %rax,%r8
+  8013cd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013d2:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8013d9:	00 00 00 
+  8013dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e1:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8013e8:	00 00 00 
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f0:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  8013f7:	00 00 00 
+  8013fa:	41 ff d1             	call   *%r9
+
+00000000008013fd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	53                   	push   %rbx
+  801402:	89 f8                	mov    %edi,%eax
+  801404:	49 89 f1             	mov    %rsi,%r9
+  801407:	48 89 d3             	mov    %rdx,%rbx
+  80140a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80140d:	49 63 f0             	movslq %r8d,%rsi
+  801410:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801413:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801418:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801421:	cd 30                	int    $0x30
+}
+  801423:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801427:	c9                   	leave
+  801428:	c3                   	ret
+
+0000000000801429 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801429:	55                   	push   %rbp
+  80142a:	48 89 e5             	mov    %rsp,%rbp
+  80142d:	53                   	push   %rbx
+  80142e:	48 83 ec 08          	sub    $0x8,%rsp
+  801432:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801435:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801438:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801445:	be 00 00 00 00       	mov    $0x0,%esi
+  80144a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801450:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801452:	48 85 c0             	test   %rax,%rax
+  801455:	7f 06                	jg     80145d <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145b:	c9                   	leave
+  80145c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145d:	49 89 c0             	mov    %rax,%r8
+  801460:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801465:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80146c:	00 00 00 
+  80146f:	be 26 00 00 00       	mov    $0x26,%esi
+  801474:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  80147b:	00 00 00 
+  80147e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801483:	49 b9 f0 33 80 00 00 	movabs $0x8033f0,%r9
+  80148a:	00 00 00 
+  80148d:	41 ff d1             	call   *%r9
+
+0000000000801490 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801490:	55                   	push   %rbp
+  801491:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801494:	ba 00 00 00 00       	mov    $0x0,%edx
+  801499:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  8014a0:	00 00 00 
+  8014a3:	ff d0                	call   *%rax
+}
+  8014a5:	5d                   	pop    %rbp
+  8014a6:	c3                   	ret
+
+00000000008014a7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8014a7:	55                   	push   %rbp
+  8014a8:	48 89 e5             	mov    %rsp,%rbp
+  8014ab:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+
+00000000008014d8 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014dd:	48 63 ce             	movslq %esi,%rcx
+  8014e0:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fe:	cd 30                	int    $0x30
+}
+  801500:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+0000000000801506 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	53                   	push   %rbx
+  80150b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80150e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801521:	be 00 00 00 00       	mov    $0x0,%esi
+  801526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152c:	cd 30                	int    $0x30
+}
+  80152e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+
+0000000000801534 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	53                   	push   %rbx
+  801539:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80153c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80153f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801544:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+}
+  801559:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155d:	c9                   	leave
+  80155e:	c3                   	ret
+
+000000000080155f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80155f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801566:	ff ff ff 
+  801569:	48 01 f8             	add    %rdi,%rax
+  80156c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801570:	c3                   	ret
+
+0000000000801571 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801571:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801578:	ff ff ff 
+  80157b:	48 01 f8             	add    %rdi,%rax
+  80157e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801582:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801588:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80158c:	c3                   	ret
+
+000000000080158d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	41 57                	push   %r15
+  801593:	41 56                	push   %r14
+  801595:	41 55                	push   %r13
+  801597:	41 54                	push   %r12
+  801599:	53                   	push   %rbx
+  80159a:	48 83 ec 08          	sub    $0x8,%rsp
+  80159e:	49 89 ff             	mov    %rdi,%r15
+  8015a1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8015a6:	49 bd ac 30 80 00 00 	movabs $0x8030ac,%r13
+  8015ad:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8015b0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015b6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015b9:	48 89 df             	mov    %rbx,%rdi
+  8015bc:	41 ff d5             	call   *%r13
+  8015bf:	83 e0 04             	and    $0x4,%eax
+  8015c2:	74 17                	je     8015db <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015c4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015cb:	4c 39 f3             	cmp    %r14,%rbx
+  8015ce:	75 e6                	jne    8015b6 <fd_alloc+0x29>
+  8015d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015d6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015db:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015de:	48 83 c4 08          	add    $0x8,%rsp
+  8015e2:	5b                   	pop    %rbx
+  8015e3:	41 5c                	pop    %r12
+  8015e5:	41 5d                	pop    %r13
+  8015e7:	41 5e                	pop    %r14
+  8015e9:	41 5f                	pop    %r15
+  8015eb:	5d                   	pop    %rbp
+  8015ec:	c3                   	ret
+
+00000000008015ed <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015ed:	83 ff 1f             	cmp    $0x1f,%edi
+  8015f0:	77 39                	ja     80162b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015f2:	55                   	push   %rbp
+  8015f3:	48 89 e5             	mov    %rsp,%rbp
+  8015f6:	41 54                	push   %r12
+  8015f8:	53                   	push   %rbx
+  8015f9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015fc:	48 63 df             	movslq %edi,%rbx
+  8015ff:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801606:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80160a:	48 89 df             	mov    %rbx,%rdi
+  80160d:	48 b8 ac 30 80 00 00 	movabs $0x8030ac,%rax
+  801614:	00 00 00 
+  801617:	ff d0                	call   *%rax
+  801619:	a8 04                	test   $0x4,%al
+  80161b:	74 14                	je     801631 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80161d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801621:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801626:	5b                   	pop    %rbx
+  801627:	41 5c                	pop    %r12
+  801629:	5d                   	pop    %rbp
+  80162a:	c3                   	ret
+        return -E_INVAL;
+  80162b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801630:	c3                   	ret
+        return -E_INVAL;
+  801631:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801636:	eb ee                	jmp    801626 <fd_lookup+0x39>
+
+0000000000801638 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801638:	55                   	push   %rbp
+  801639:	48 89 e5             	mov    %rsp,%rbp
+  80163c:	41 54                	push   %r12
+  80163e:	53                   	push   %rbx
+  80163f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801642:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  801649:	00 00 00 
+  80164c:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801653:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801656:	39 3b                	cmp    %edi,(%rbx)
+  801658:	74 47                	je     8016a1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80165a:	48 83 c0 08          	add    $0x8,%rax
+  80165e:	48 8b 18             	mov    (%rax),%rbx
+  801661:	48 85 db             	test   %rbx,%rbx
+  801664:	75 f0                	jne    801656 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801666:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80166d:	00 00 00 
+  801670:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801676:	89 fa                	mov    %edi,%edx
+  801678:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  80167f:	00 00 00 
+  801682:	b8 00 00 00 00       	mov    $0x0,%eax
+  801687:	48 b9 de 01 80 00 00 	movabs $0x8001de,%rcx
+  80168e:	00 00 00 
+  801691:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801698:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80169c:	5b                   	pop    %rbx
+  80169d:	41 5c                	pop    %r12
+  80169f:	5d                   	pop    %rbp
+  8016a0:	c3                   	ret
+            return 0;
+  8016a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a6:	eb f0                	jmp    801698 <dev_lookup+0x60>
+
+00000000008016a8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	41 55                	push   %r13
+  8016ae:	41 54                	push   %r12
+  8016b0:	53                   	push   %rbx
+  8016b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8016b5:	48 89 fb             	mov    %rdi,%rbx
+  8016b8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016bb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016c2:	ff ff ff 
+  8016c5:	48 01 df             	add    %rbx,%rdi
+  8016c8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016cc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016d0:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+  8016dc:	41 89 c5             	mov    %eax,%r13d
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 06                	js     8016e9 <fd_close+0x41>
+  8016e3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016e7:	74 1a                	je     801703 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016e9:	45 84 e4             	test   %r12b,%r12b
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016f5:	44 89 e8             	mov    %r13d,%eax
+  8016f8:	48 83 c4 18          	add    $0x18,%rsp
+  8016fc:	5b                   	pop    %rbx
+  8016fd:	41 5c                	pop    %r12
+  8016ff:	41 5d                	pop    %r13
+  801701:	5d                   	pop    %rbp
+  801702:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801703:	8b 3b                	mov    (%rbx),%edi
+  801705:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801709:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+  801715:	41 89 c5             	mov    %eax,%r13d
+  801718:	85 c0                	test   %eax,%eax
+  80171a:	78 1b                	js     801737 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80171c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801720:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801724:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80172a:	48 85 c0             	test   %rax,%rax
+  80172d:	74 08                	je     801737 <fd_close+0x8f>
+  80172f:	48 89 df             	mov    %rbx,%rdi
+  801732:	ff d0                	call   *%rax
+  801734:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801737:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80173c:	48 89 de             	mov    %rbx,%rsi
+  80173f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801744:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  80174b:	00 00 00 
+  80174e:	ff d0                	call   *%rax
+    return res;
+  801750:	eb a3                	jmp    8016f5 <fd_close+0x4d>
+
+0000000000801752 <close>:
+
+int
+close(int fdnum) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80175a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80175e:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801765:	00 00 00 
+  801768:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 15                	js     801783 <close+0x31>
+
+    return fd_close(fd, 1);
+  80176e:	be 01 00 00 00       	mov    $0x1,%esi
+  801773:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801777:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  80177e:	00 00 00 
+  801781:	ff d0                	call   *%rax
+}
+  801783:	c9                   	leave
+  801784:	c3                   	ret
+
+0000000000801785 <close_all>:
+
+void
+close_all(void) {
+  801785:	55                   	push   %rbp
+  801786:	48 89 e5             	mov    %rsp,%rbp
+  801789:	41 54                	push   %r12
+  80178b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80178c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801791:	49 bc 52 17 80 00 00 	movabs $0x801752,%r12
+  801798:	00 00 00 
+  80179b:	89 df                	mov    %ebx,%edi
+  80179d:	41 ff d4             	call   *%r12
+  8017a0:	83 c3 01             	add    $0x1,%ebx
+  8017a3:	83 fb 20             	cmp    $0x20,%ebx
+  8017a6:	75 f3                	jne    80179b <close_all+0x16>
+}
+  8017a8:	5b                   	pop    %rbx
+  8017a9:	41 5c                	pop    %r12
+  8017ab:	5d                   	pop    %rbp
+  8017ac:	c3                   	ret
+
+00000000008017ad <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	41 57                	push   %r15
+  8017b3:	41 56                	push   %r14
+  8017b5:	41 55                	push   %r13
+  8017b7:	41 54                	push   %r12
+  8017b9:	53                   	push   %rbx
+  8017ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8017be:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017c1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017c5:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+  8017d1:	89 c3                	mov    %eax,%ebx
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	0f 88 b8 00 00 00    	js     801893 <dup+0xe6>
+    close(newfdnum);
+  8017db:	44 89 e7             	mov    %r12d,%edi
+  8017de:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  8017e5:	00 00 00 
+  8017e8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017ea:	4d 63 ec             	movslq %r12d,%r13
+  8017ed:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017f4:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017f8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017fc:	4c 89 ff             	mov    %r15,%rdi
+  8017ff:	49 be 71 15 80 00 00 	movabs $0x801571,%r14
+  801806:	00 00 00 
+  801809:	41 ff d6             	call   *%r14
+  80180c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80180f:	4c 89 ef             	mov    %r13,%rdi
+  801812:	41 ff d6             	call   *%r14
+  801815:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801818:	48 89 df             	mov    %rbx,%rdi
+  80181b:	48 b8 ac 30 80 00 00 	movabs $0x8030ac,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801827:	a8 04                	test   $0x4,%al
+  801829:	74 2b                	je     801856 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80182b:	41 89 c1             	mov    %eax,%r9d
+  80182e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801834:	4c 89 f1             	mov    %r14,%rcx
+  801837:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183c:	48 89 de             	mov    %rbx,%rsi
+  80183f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801844:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  80184b:	00 00 00 
+  80184e:	ff d0                	call   *%rax
+  801850:	89 c3                	mov    %eax,%ebx
+  801852:	85 c0                	test   %eax,%eax
+  801854:	78 4e                	js     8018a4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801856:	4c 89 ff             	mov    %r15,%rdi
+  801859:	48 b8 ac 30 80 00 00 	movabs $0x8030ac,%rax
+  801860:	00 00 00 
+  801863:	ff d0                	call   *%rax
+  801865:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801868:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80186e:	4c 89 e9             	mov    %r13,%rcx
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	4c 89 fe             	mov    %r15,%rsi
+  801879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80187e:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	89 c3                	mov    %eax,%ebx
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	78 14                	js     8018a4 <dup+0xf7>
+
+    return newfdnum;
+  801890:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801893:	89 d8                	mov    %ebx,%eax
+  801895:	48 83 c4 18          	add    $0x18,%rsp
+  801899:	5b                   	pop    %rbx
+  80189a:	41 5c                	pop    %r12
+  80189c:	41 5d                	pop    %r13
+  80189e:	41 5e                	pop    %r14
+  8018a0:	41 5f                	pop    %r15
+  8018a2:	5d                   	pop    %rbp
+  8018a3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8018a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018a9:	4c 89 ee             	mov    %r13,%rsi
+  8018ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b1:	49 bc 5b 12 80 00 00 	movabs $0x80125b,%r12
+  8018b8:	00 00 00 
+  8018bb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018c3:	4c 89 f6             	mov    %r14,%rsi
+  8018c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018cb:	41 ff d4             	call   *%r12
+    return res;
+  8018ce:	eb c3                	jmp    801893 <dup+0xe6>
+
+00000000008018d0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	41 56                	push   %r14
+  8018d6:	41 55                	push   %r13
+  8018d8:	41 54                	push   %r12
+  8018da:	53                   	push   %rbx
+  8018db:	48 83 ec 10          	sub    $0x10,%rsp
+  8018df:	89 fb                	mov    %edi,%ebx
+  8018e1:	49 89 f4             	mov    %rsi,%r12
+  8018e4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018e7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018eb:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  8018f2:	00 00 00 
+  8018f5:	ff d0                	call   *%rax
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	78 4c                	js     801947 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018fb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018ff:	41 8b 3e             	mov    (%r14),%edi
+  801902:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801906:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  80190d:	00 00 00 
+  801910:	ff d0                	call   *%rax
+  801912:	85 c0                	test   %eax,%eax
+  801914:	78 35                	js     80194b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801916:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80191a:	83 e0 03             	and    $0x3,%eax
+  80191d:	83 f8 01             	cmp    $0x1,%eax
+  801920:	74 2d                	je     80194f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801922:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801926:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80192a:	48 85 c0             	test   %rax,%rax
+  80192d:	74 56                	je     801985 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80192f:	4c 89 ea             	mov    %r13,%rdx
+  801932:	4c 89 e6             	mov    %r12,%rsi
+  801935:	4c 89 f7             	mov    %r14,%rdi
+  801938:	ff d0                	call   *%rax
+}
+  80193a:	48 83 c4 10          	add    $0x10,%rsp
+  80193e:	5b                   	pop    %rbx
+  80193f:	41 5c                	pop    %r12
+  801941:	41 5d                	pop    %r13
+  801943:	41 5e                	pop    %r14
+  801945:	5d                   	pop    %rbp
+  801946:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801947:	48 98                	cltq
+  801949:	eb ef                	jmp    80193a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80194b:	48 98                	cltq
+  80194d:	eb eb                	jmp    80193a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80194f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801956:	00 00 00 
+  801959:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80195f:	89 da                	mov    %ebx,%edx
+  801961:	48 bf 99 3c 80 00 00 	movabs $0x803c99,%rdi
+  801968:	00 00 00 
+  80196b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801970:	48 b9 de 01 80 00 00 	movabs $0x8001de,%rcx
+  801977:	00 00 00 
+  80197a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80197c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801983:	eb b5                	jmp    80193a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801985:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80198c:	eb ac                	jmp    80193a <read+0x6a>
+
+000000000080198e <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  80198e:	55                   	push   %rbp
+  80198f:	48 89 e5             	mov    %rsp,%rbp
+  801992:	41 56                	push   %r14
+  801994:	41 55                	push   %r13
+  801996:	41 54                	push   %r12
+  801998:	53                   	push   %rbx
+  801999:	48 83 ec 10          	sub    $0x10,%rsp
+  80199d:	89 fb                	mov    %edi,%ebx
+  80199f:	49 89 f4             	mov    %rsi,%r12
+  8019a2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a9:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 41                	js     8019fa <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019b9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019bd:	41 8b 3e             	mov    (%r14),%edi
+  8019c0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019c4:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 35                	js     801a09 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019d4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019d8:	83 e0 03             	and    $0x3,%eax
+  8019db:	83 f8 01             	cmp    $0x1,%eax
+  8019de:	74 2d                	je     801a0d <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019e8:	48 85 c0             	test   %rax,%rax
+  8019eb:	74 56                	je     801a43 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019ed:	4c 89 ea             	mov    %r13,%rdx
+  8019f0:	4c 89 e6             	mov    %r12,%rsi
+  8019f3:	4c 89 f7             	mov    %r14,%rdi
+  8019f6:	ff d0                	call   *%rax
+  8019f8:	eb 02                	jmp    8019fc <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019fa:	48 98                	cltq
+}
+  8019fc:	48 83 c4 10          	add    $0x10,%rsp
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	41 5d                	pop    %r13
+  801a05:	41 5e                	pop    %r14
+  801a07:	5d                   	pop    %rbp
+  801a08:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a09:	48 98                	cltq
+  801a0b:	eb ef                	jmp    8019fc <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a0d:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801a14:	00 00 00 
+  801a17:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a1d:	89 da                	mov    %ebx,%edx
+  801a1f:	48 bf 58 3c 80 00 00 	movabs $0x803c58,%rdi
+  801a26:	00 00 00 
+  801a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2e:	48 b9 de 01 80 00 00 	movabs $0x8001de,%rcx
+  801a35:	00 00 00 
+  801a38:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a41:	eb b9                	jmp    8019fc <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a43:	4c 89 ea             	mov    %r13,%rdx
+  801a46:	4c 89 e6             	mov    %r12,%rsi
+  801a49:	89 df                	mov    %ebx,%edi
+  801a4b:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  801a52:	00 00 00 
+  801a55:	ff d0                	call   *%rax
+  801a57:	eb a3                	jmp    8019fc <readmap+0x6e>
+
+0000000000801a59 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a59:	55                   	push   %rbp
+  801a5a:	48 89 e5             	mov    %rsp,%rbp
+  801a5d:	41 57                	push   %r15
+  801a5f:	41 56                	push   %r14
+  801a61:	41 55                	push   %r13
+  801a63:	41 54                	push   %r12
+  801a65:	53                   	push   %rbx
+  801a66:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a6a:	48 85 d2             	test   %rdx,%rdx
+  801a6d:	74 54                	je     801ac3 <readn+0x6a>
+  801a6f:	41 89 fd             	mov    %edi,%r13d
+  801a72:	49 89 f6             	mov    %rsi,%r14
+  801a75:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a7d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a82:	49 bf d0 18 80 00 00 	movabs $0x8018d0,%r15
+  801a89:	00 00 00 
+  801a8c:	4c 89 e2             	mov    %r12,%rdx
+  801a8f:	48 29 f2             	sub    %rsi,%rdx
+  801a92:	4c 01 f6             	add    %r14,%rsi
+  801a95:	44 89 ef             	mov    %r13d,%edi
+  801a98:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 20                	js     801abf <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a9f:	01 c3                	add    %eax,%ebx
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	74 08                	je     801aad <readn+0x54>
+  801aa5:	48 63 f3             	movslq %ebx,%rsi
+  801aa8:	4c 39 e6             	cmp    %r12,%rsi
+  801aab:	72 df                	jb     801a8c <readn+0x33>
+    }
+    return res;
+  801aad:	48 63 c3             	movslq %ebx,%rax
+}
+  801ab0:	48 83 c4 08          	add    $0x8,%rsp
+  801ab4:	5b                   	pop    %rbx
+  801ab5:	41 5c                	pop    %r12
+  801ab7:	41 5d                	pop    %r13
+  801ab9:	41 5e                	pop    %r14
+  801abb:	41 5f                	pop    %r15
+  801abd:	5d                   	pop    %rbp
+  801abe:	c3                   	ret
+        if (inc < 0) return inc;
+  801abf:	48 98                	cltq
+  801ac1:	eb ed                	jmp    801ab0 <readn+0x57>
+    int inc = 1, res = 0;
+  801ac3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac8:	eb e3                	jmp    801aad <readn+0x54>
+
+0000000000801aca <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801aca:	55                   	push   %rbp
+  801acb:	48 89 e5             	mov    %rsp,%rbp
+  801ace:	41 56                	push   %r14
+  801ad0:	41 55                	push   %r13
+  801ad2:	41 54                	push   %r12
+  801ad4:	53                   	push   %rbx
+  801ad5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ad9:	89 fb                	mov    %edi,%ebx
+  801adb:	49 89 f4             	mov    %rsi,%r12
+  801ade:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ae1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae5:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 47                	js     801b3c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801af5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801af9:	41 8b 3e             	mov    (%r14),%edi
+  801afc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b00:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+  801b0c:	85 c0                	test   %eax,%eax
+  801b0e:	78 30                	js     801b40 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b10:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b15:	74 2d                	je     801b44 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b1b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b1f:	48 85 c0             	test   %rax,%rax
+  801b22:	74 56                	je     801b7a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b24:	4c 89 ea             	mov    %r13,%rdx
+  801b27:	4c 89 e6             	mov    %r12,%rsi
+  801b2a:	4c 89 f7             	mov    %r14,%rdi
+  801b2d:	ff d0                	call   *%rax
+}
+  801b2f:	48 83 c4 10          	add    $0x10,%rsp
+  801b33:	5b                   	pop    %rbx
+  801b34:	41 5c                	pop    %r12
+  801b36:	41 5d                	pop    %r13
+  801b38:	41 5e                	pop    %r14
+  801b3a:	5d                   	pop    %rbp
+  801b3b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b3c:	48 98                	cltq
+  801b3e:	eb ef                	jmp    801b2f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b40:	48 98                	cltq
+  801b42:	eb eb                	jmp    801b2f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b44:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801b4b:	00 00 00 
+  801b4e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b54:	89 da                	mov    %ebx,%edx
+  801b56:	48 bf b5 3c 80 00 00 	movabs $0x803cb5,%rdi
+  801b5d:	00 00 00 
+  801b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b65:	48 b9 de 01 80 00 00 	movabs $0x8001de,%rcx
+  801b6c:	00 00 00 
+  801b6f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b71:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b78:	eb b5                	jmp    801b2f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b7a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b81:	eb ac                	jmp    801b2f <write+0x65>
+
+0000000000801b83 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b83:	55                   	push   %rbp
+  801b84:	48 89 e5             	mov    %rsp,%rbp
+  801b87:	53                   	push   %rbx
+  801b88:	48 83 ec 18          	sub    $0x18,%rsp
+  801b8c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b8e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b92:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 0c                	js     801bae <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ba6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb2:	c9                   	leave
+  801bb3:	c3                   	ret
+
+0000000000801bb4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bb4:	55                   	push   %rbp
+  801bb5:	48 89 e5             	mov    %rsp,%rbp
+  801bb8:	41 55                	push   %r13
+  801bba:	41 54                	push   %r12
+  801bbc:	53                   	push   %rbx
+  801bbd:	48 83 ec 18          	sub    $0x18,%rsp
+  801bc1:	89 fb                	mov    %edi,%ebx
+  801bc3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bca:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801bd1:	00 00 00 
+  801bd4:	ff d0                	call   *%rax
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 38                	js     801c12 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bda:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bde:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801be2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801be6:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 1c                	js     801c12 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bf6:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801bfb:	74 20                	je     801c1d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bfd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c01:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c05:	48 85 c0             	test   %rax,%rax
+  801c08:	74 47                	je     801c51 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c0a:	44 89 e6             	mov    %r12d,%esi
+  801c0d:	4c 89 ef             	mov    %r13,%rdi
+  801c10:	ff d0                	call   *%rax
+}
+  801c12:	48 83 c4 18          	add    $0x18,%rsp
+  801c16:	5b                   	pop    %rbx
+  801c17:	41 5c                	pop    %r12
+  801c19:	41 5d                	pop    %r13
+  801c1b:	5d                   	pop    %rbp
+  801c1c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c1d:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801c24:	00 00 00 
+  801c27:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c2d:	89 da                	mov    %ebx,%edx
+  801c2f:	48 bf 78 3c 80 00 00 	movabs $0x803c78,%rdi
+  801c36:	00 00 00 
+  801c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3e:	48 b9 de 01 80 00 00 	movabs $0x8001de,%rcx
+  801c45:	00 00 00 
+  801c48:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4f:	eb c1                	jmp    801c12 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c51:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c56:	eb ba                	jmp    801c12 <ftruncate+0x5e>
+
+0000000000801c58 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c58:	55                   	push   %rbp
+  801c59:	48 89 e5             	mov    %rsp,%rbp
+  801c5c:	41 54                	push   %r12
+  801c5e:	53                   	push   %rbx
+  801c5f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c63:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c6a:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	78 4e                	js     801cc8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c7a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c7e:	41 8b 3c 24          	mov    (%r12),%edi
+  801c82:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c86:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801c8d:	00 00 00 
+  801c90:	ff d0                	call   *%rax
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 32                	js     801cc8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c9a:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801c9f:	74 30                	je     801cd1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ca1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ca4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cab:	00 00 00 
+    stat->st_isdir = 0;
+  801cae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cb5:	00 00 00 
+    stat->st_dev = dev;
+  801cb8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cbf:	48 89 de             	mov    %rbx,%rsi
+  801cc2:	4c 89 e7             	mov    %r12,%rdi
+  801cc5:	ff 50 30             	call   *0x30(%rax)
+}
+  801cc8:	48 83 c4 10          	add    $0x10,%rsp
+  801ccc:	5b                   	pop    %rbx
+  801ccd:	41 5c                	pop    %r12
+  801ccf:	5d                   	pop    %rbp
+  801cd0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cd1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cd6:	eb f0                	jmp    801cc8 <fstat+0x70>
+
+0000000000801cd8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cd8:	55                   	push   %rbp
+  801cd9:	48 89 e5             	mov    %rsp,%rbp
+  801cdc:	41 54                	push   %r12
+  801cde:	53                   	push   %rbx
+  801cdf:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ce2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce7:	48 b8 2f 2a 80 00 00 	movabs $0x802a2f,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+  801cf3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 25                	js     801d1e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801cf9:	4c 89 e6             	mov    %r12,%rsi
+  801cfc:	89 c7                	mov    %eax,%edi
+  801cfe:	48 b8 58 1c 80 00 00 	movabs $0x801c58,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+  801d0a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d0d:	89 df                	mov    %ebx,%edi
+  801d0f:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+
+    return res;
+  801d1b:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d1e:	89 d8                	mov    %ebx,%eax
+  801d20:	5b                   	pop    %rbx
+  801d21:	41 5c                	pop    %r12
+  801d23:	5d                   	pop    %rbp
+  801d24:	c3                   	ret
+
+0000000000801d25 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d25:	55                   	push   %rbp
+  801d26:	48 89 e5             	mov    %rsp,%rbp
+  801d29:	41 54                	push   %r12
+  801d2b:	53                   	push   %rbx
+  801d2c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d30:	48 89 fb             	mov    %rdi,%rbx
+  801d33:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d36:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d3a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d3f:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 1f                	js     801d6e <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d53:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d57:	48 85 c0             	test   %rax,%rax
+  801d5a:	74 1b                	je     801d77 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d5c:	4c 89 e6             	mov    %r12,%rsi
+  801d5f:	48 89 df             	mov    %rbx,%rdi
+  801d62:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d6e:	48 83 c4 10          	add    $0x10,%rsp
+  801d72:	5b                   	pop    %rbx
+  801d73:	41 5c                	pop    %r12
+  801d75:	5d                   	pop    %rbp
+  801d76:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d77:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d7c:	eb f0                	jmp    801d6e <create_snapshot+0x49>
+
+0000000000801d7e <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d86:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d8a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d8f:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801d96:	00 00 00 
+  801d99:	ff d0                	call   *%rax
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 1e                	js     801dbd <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801d9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da3:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801da7:	48 85 d2             	test   %rdx,%rdx
+  801daa:	74 13                	je     801dbf <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db1:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dba:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dbf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dc4:	eb f7                	jmp    801dbd <print_snapshot_list+0x3f>
+
+0000000000801dc6 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	53                   	push   %rbx
+  801dcb:	48 83 ec 18          	sub    $0x18,%rsp
+  801dcf:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dd2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dd6:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ddb:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 1c                	js     801e07 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801def:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801df3:	48 85 c0             	test   %rax,%rax
+  801df6:	74 15                	je     801e0d <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801df8:	48 89 df             	mov    %rbx,%rdi
+  801dfb:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e04:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e0d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e12:	eb f3                	jmp    801e07 <accept_snapshot+0x41>
+
+0000000000801e14 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e14:	55                   	push   %rbp
+  801e15:	48 89 e5             	mov    %rsp,%rbp
+  801e18:	53                   	push   %rbx
+  801e19:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1d:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e20:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e24:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e29:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	78 1c                	js     801e55 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e3d:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e41:	48 85 c0             	test   %rax,%rax
+  801e44:	74 15                	je     801e5b <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e46:	48 89 df             	mov    %rbx,%rdi
+  801e49:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e52:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e59:	c9                   	leave
+  801e5a:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e5b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e60:	eb f3                	jmp    801e55 <delete_snapshot+0x41>
+
+0000000000801e62 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e62:	55                   	push   %rbp
+  801e63:	48 89 e5             	mov    %rsp,%rbp
+  801e66:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e6a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e6e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e73:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 14                	js     801e97 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e87:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e8b:	48 85 d2             	test   %rdx,%rdx
+  801e8e:	74 09                	je     801e99 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e95:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e99:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9e:	eb f7                	jmp    801e97 <gc_snapshots+0x35>
+
+0000000000801ea0 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	41 56                	push   %r14
+  801ea6:	41 55                	push   %r13
+  801ea8:	41 54                	push   %r12
+  801eaa:	53                   	push   %rbx
+  801eab:	48 83 ec 10          	sub    $0x10,%rsp
+  801eaf:	48 89 fb             	mov    %rdi,%rbx
+  801eb2:	49 89 f4             	mov    %rsi,%r12
+  801eb5:	49 89 d5             	mov    %rdx,%r13
+  801eb8:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ebb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebf:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ec4:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 1b                	js     801eef <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ed4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed8:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801edc:	48 85 c0             	test   %rax,%rax
+  801edf:	74 1b                	je     801efc <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ee1:	4c 89 f1             	mov    %r14,%rcx
+  801ee4:	4c 89 ea             	mov    %r13,%rdx
+  801ee7:	4c 89 e6             	mov    %r12,%rsi
+  801eea:	48 89 df             	mov    %rbx,%rdi
+  801eed:	ff d0                	call   *%rax
+
+    return res;
+}
+  801eef:	48 83 c4 10          	add    $0x10,%rsp
+  801ef3:	5b                   	pop    %rbx
+  801ef4:	41 5c                	pop    %r12
+  801ef6:	41 5d                	pop    %r13
+  801ef8:	41 5e                	pop    %r14
+  801efa:	5d                   	pop    %rbp
+  801efb:	c3                   	ret
+        return -E_NOT_SUPP;
+  801efc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f01:	eb ec                	jmp    801eef <diff_snapshots+0x4f>
+
+0000000000801f03 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f03:	55                   	push   %rbp
+  801f04:	48 89 e5             	mov    %rsp,%rbp
+  801f07:	41 55                	push   %r13
+  801f09:	41 54                	push   %r12
+  801f0b:	53                   	push   %rbx
+  801f0c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f10:	48 89 fb             	mov    %rdi,%rbx
+  801f13:	49 89 f4             	mov    %rsi,%r12
+  801f16:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f1d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f22:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801f29:	00 00 00 
+  801f2c:	ff d0                	call   *%rax
+  801f2e:	85 c0                	test   %eax,%eax
+  801f30:	78 18                	js     801f4a <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f36:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f3a:	48 85 c0             	test   %rax,%rax
+  801f3d:	74 16                	je     801f55 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f3f:	4c 89 ea             	mov    %r13,%rdx
+  801f42:	4c 89 e6             	mov    %r12,%rsi
+  801f45:	48 89 df             	mov    %rbx,%rdi
+  801f48:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f4a:	48 83 c4 18          	add    $0x18,%rsp
+  801f4e:	5b                   	pop    %rbx
+  801f4f:	41 5c                	pop    %r12
+  801f51:	41 5d                	pop    %r13
+  801f53:	5d                   	pop    %rbp
+  801f54:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f55:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f5a:	eb ee                	jmp    801f4a <send_snapshot+0x47>
+
+0000000000801f5c <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	53                   	push   %rbx
+  801f61:	48 83 ec 18          	sub    $0x18,%rsp
+  801f65:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f71:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 12                	js     801f93 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f85:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f89:	48 85 c0             	test   %rax,%rax
+  801f8c:	74 0b                	je     801f99 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f8e:	48 89 df             	mov    %rbx,%rdi
+  801f91:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f99:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f9e:	eb f3                	jmp    801f93 <receive_snapshot+0x37>
+
+0000000000801fa0 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801fa0:	55                   	push   %rbp
+  801fa1:	48 89 e5             	mov    %rsp,%rbp
+  801fa4:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fa8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fac:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fb1:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 17                	js     801fd8 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc5:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fcc:	48 85 d2             	test   %rdx,%rdx
+  801fcf:	74 09                	je     801fda <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd6:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fda:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fdf:	eb f7                	jmp    801fd8 <free_space_bytes+0x38>
+
+0000000000801fe1 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801fe1:	55                   	push   %rbp
+  801fe2:	48 89 e5             	mov    %rsp,%rbp
+  801fe5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fe9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fed:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ff2:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	78 17                	js     802019 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802002:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802006:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80200d:	48 85 d2             	test   %rdx,%rdx
+  802010:	74 09                	je     80201b <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802012:	b8 00 00 00 00       	mov    $0x0,%eax
+  802017:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80201b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802020:	eb f7                	jmp    802019 <busy_space_bytes+0x38>
+
+0000000000802022 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802022:	55                   	push   %rbp
+  802023:	48 89 e5             	mov    %rsp,%rbp
+  802026:	41 54                	push   %r12
+  802028:	53                   	push   %rbx
+  802029:	48 83 ec 10          	sub    $0x10,%rsp
+  80202d:	89 fb                	mov    %edi,%ebx
+  80202f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802032:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802036:	bf 66 00 00 00       	mov    $0x66,%edi
+  80203b:	48 b8 38 16 80 00 00 	movabs $0x801638,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 17                	js     802062 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80204b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204f:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802056:	48 85 c0             	test   %rax,%rax
+  802059:	74 10                	je     80206b <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80205b:	4c 89 e6             	mov    %r12,%rsi
+  80205e:	89 df                	mov    %ebx,%edi
+  802060:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802062:	48 83 c4 10          	add    $0x10,%rsp
+  802066:	5b                   	pop    %rbx
+  802067:	41 5c                	pop    %r12
+  802069:	5d                   	pop    %rbp
+  80206a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80206b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802070:	eb f0                	jmp    802062 <snapshots_space+0x40>
+
+0000000000802072 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802072:	55                   	push   %rbp
+  802073:	48 89 e5             	mov    %rsp,%rbp
+  802076:	41 55                	push   %r13
+  802078:	41 54                	push   %r12
+  80207a:	53                   	push   %rbx
+  80207b:	48 83 ec 08          	sub    $0x8,%rsp
+  80207f:	41 89 fd             	mov    %edi,%r13d
+  802082:	48 89 f3             	mov    %rsi,%rbx
+  802085:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802088:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80208f:	00 00 00 
+  802092:	83 38 00             	cmpl   $0x0,(%rax)
+  802095:	74 57                	je     8020ee <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802097:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80209d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020a2:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020a9:	00 00 00 
+  8020ac:	44 89 ee             	mov    %r13d,%esi
+  8020af:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020b6:	00 00 00 
+  8020b9:	8b 38                	mov    (%rax),%edi
+  8020bb:	48 b8 92 35 80 00 00 	movabs $0x803592,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020cc:	4c 89 e2             	mov    %r12,%rdx
+  8020cf:	48 89 de             	mov    %rbx,%rsi
+  8020d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d7:	48 b8 7a 35 80 00 00 	movabs $0x80357a,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+}
+  8020e3:	48 83 c4 08          	add    $0x8,%rsp
+  8020e7:	5b                   	pop    %rbx
+  8020e8:	41 5c                	pop    %r12
+  8020ea:	41 5d                	pop    %r13
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020f3:	48 b8 50 36 80 00 00 	movabs $0x803650,%rax
+  8020fa:	00 00 00 
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802106:	00 00 
+  802108:	eb 8d                	jmp    802097 <fsipc_region+0x25>
+
+000000000080210a <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80210a:	55                   	push   %rbp
+  80210b:	48 89 e5             	mov    %rsp,%rbp
+  80210e:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802112:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802119:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80211a:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80211e:	48 b8 72 20 80 00 00 	movabs $0x802072,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+}
+  80212a:	c9                   	leave
+  80212b:	c3                   	ret
+
+000000000080212c <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80212c:	85 ff                	test   %edi,%edi
+  80212e:	78 6d                	js     80219d <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+  802134:	41 54                	push   %r12
+  802136:	53                   	push   %rbx
+  802137:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80213a:	48 85 f6             	test   %rsi,%rsi
+  80213d:	74 57                	je     802196 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80213f:	89 f8                	mov    %edi,%eax
+  802141:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802148:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80214a:	be 00 00 00 00       	mov    $0x0,%esi
+  80214f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802154:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 2d                	js     802191 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802164:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80216b:	00 00 00 
+  80216e:	49 63 14 24          	movslq (%r12),%rdx
+  802172:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802179:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80217e:	48 89 df             	mov    %rbx,%rdi
+  802181:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80218d:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802191:	5b                   	pop    %rbx
+  802192:	41 5c                	pop    %r12
+  802194:	5d                   	pop    %rbp
+  802195:	c3                   	ret
+        return -E_INVAL;
+  802196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219b:	eb f4                	jmp    802191 <devfile_df_snapshots+0x65>
+  80219d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021a2:	c3                   	ret
+
+00000000008021a3 <devfile_df_busy>:
+devfile_df_busy() {
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8021a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ac:	bf 11 00 00 00       	mov    $0x11,%edi
+  8021b1:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8021b8:	00 00 00 
+  8021bb:	ff d0                	call   *%rax
+}
+  8021bd:	5d                   	pop    %rbp
+  8021be:	c3                   	ret
+
+00000000008021bf <devfile_df_free>:
+devfile_df_free() {
+  8021bf:	55                   	push   %rbp
+  8021c0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c8:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021cd:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+}
+  8021d9:	5d                   	pop    %rbp
+  8021da:	c3                   	ret
+
+00000000008021db <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021db:	55                   	push   %rbp
+  8021dc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021df:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021e9:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+}
+  8021f5:	5d                   	pop    %rbp
+  8021f6:	c3                   	ret
+
+00000000008021f7 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8021f7:	55                   	push   %rbp
+  8021f8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8021fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802200:	bf 09 00 00 00       	mov    $0x9,%edi
+  802205:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80220c:	00 00 00 
+  80220f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802211:	85 c0                	test   %eax,%eax
+  802213:	ba 00 00 00 00       	mov    $0x0,%edx
+  802218:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80221b:	5d                   	pop    %rbp
+  80221c:	c3                   	ret
+
+000000000080221d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802221:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802228:	00 00 00 
+  80222b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80222e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802230:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802233:	be 00 00 00 00       	mov    $0x0,%esi
+  802238:	bf 02 00 00 00       	mov    $0x2,%edi
+  80223d:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+}
+  802249:	5d                   	pop    %rbp
+  80224a:	c3                   	ret
+
+000000000080224b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80224b:	55                   	push   %rbp
+  80224c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80224f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802252:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802259:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80225b:	be 00 00 00 00       	mov    $0x0,%esi
+  802260:	bf 06 00 00 00       	mov    $0x6,%edi
+  802265:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+}
+  802271:	5d                   	pop    %rbp
+  802272:	c3                   	ret
+
+0000000000802273 <devfile_write>:
+    if (!fd || !buf) {
+  802273:	48 85 ff             	test   %rdi,%rdi
+  802276:	0f 84 c1 00 00 00    	je     80233d <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80227c:	55                   	push   %rbp
+  80227d:	48 89 e5             	mov    %rsp,%rbp
+  802280:	41 57                	push   %r15
+  802282:	41 56                	push   %r14
+  802284:	41 55                	push   %r13
+  802286:	41 54                	push   %r12
+  802288:	53                   	push   %rbx
+  802289:	48 83 ec 18          	sub    $0x18,%rsp
+  80228d:	49 89 ff             	mov    %rdi,%r15
+  802290:	49 89 f5             	mov    %rsi,%r13
+  802293:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802296:	48 85 f6             	test   %rsi,%rsi
+  802299:	0f 84 95 00 00 00    	je     802334 <devfile_write+0xc1>
+    while (n) {
+  80229f:	48 85 d2             	test   %rdx,%rdx
+  8022a2:	0f 84 83 00 00 00    	je     80232b <devfile_write+0xb8>
+    int totalWrite = 0;
+  8022a8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022af:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022b6:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022b9:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022be:	49 39 dc             	cmp    %rbx,%r12
+  8022c1:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022c5:	48 89 da             	mov    %rbx,%rdx
+  8022c8:	4c 89 ee             	mov    %r13,%rsi
+  8022cb:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022d2:	00 00 00 
+  8022d5:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022e1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022e5:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022e8:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022f6:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8022fd:	00 00 00 
+  802300:	ff d0                	call   *%rax
+        if (write < 0) {
+  802302:	85 c0                	test   %eax,%eax
+  802304:	78 21                	js     802327 <devfile_write+0xb4>
+        buf += write;
+  802306:	48 63 d0             	movslq %eax,%rdx
+  802309:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80230c:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80230f:	49 29 d4             	sub    %rdx,%r12
+  802312:	75 a5                	jne    8022b9 <devfile_write+0x46>
+    return totalWrite;
+  802314:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802318:	48 83 c4 18          	add    $0x18,%rsp
+  80231c:	5b                   	pop    %rbx
+  80231d:	41 5c                	pop    %r12
+  80231f:	41 5d                	pop    %r13
+  802321:	41 5e                	pop    %r14
+  802323:	41 5f                	pop    %r15
+  802325:	5d                   	pop    %rbp
+  802326:	c3                   	ret
+            return write;
+  802327:	48 98                	cltq
+  802329:	eb ed                	jmp    802318 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80232b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802332:	eb e0                	jmp    802314 <devfile_write+0xa1>
+        return -E_INVAL;
+  802334:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80233b:	eb db                	jmp    802318 <devfile_write+0xa5>
+  80233d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802344:	c3                   	ret
+
+0000000000802345 <devfile_read>:
+    if (!fd || !buf) {
+  802345:	48 85 ff             	test   %rdi,%rdi
+  802348:	0f 84 c0 00 00 00    	je     80240e <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	41 57                	push   %r15
+  802354:	41 56                	push   %r14
+  802356:	41 55                	push   %r13
+  802358:	41 54                	push   %r12
+  80235a:	53                   	push   %rbx
+  80235b:	48 83 ec 18          	sub    $0x18,%rsp
+  80235f:	49 89 ff             	mov    %rdi,%r15
+  802362:	49 89 f5             	mov    %rsi,%r13
+  802365:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802368:	48 85 f6             	test   %rsi,%rsi
+  80236b:	0f 84 96 00 00 00    	je     802407 <devfile_read+0xc2>
+    while (n) {
+  802371:	48 85 d2             	test   %rdx,%rdx
+  802374:	0f 84 87 00 00 00    	je     802401 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80237a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802381:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802382:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802389:	00 00 00 
+  80238c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802390:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802393:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802398:	49 39 c4             	cmp    %rax,%r12
+  80239b:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80239f:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8023a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023ad:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	7e 37                	jle    8023f4 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023bd:	48 63 d8             	movslq %eax,%rbx
+  8023c0:	48 89 da             	mov    %rbx,%rdx
+  8023c3:	4c 89 f6             	mov    %r14,%rsi
+  8023c6:	4c 89 ef             	mov    %r13,%rdi
+  8023c9:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+        buf += read;
+  8023d5:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023d8:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023dc:	49 29 dc             	sub    %rbx,%r12
+  8023df:	75 ab                	jne    80238c <devfile_read+0x47>
+  return totalRead;
+  8023e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023e5:	48 83 c4 18          	add    $0x18,%rsp
+  8023e9:	5b                   	pop    %rbx
+  8023ea:	41 5c                	pop    %r12
+  8023ec:	41 5d                	pop    %r13
+  8023ee:	41 5e                	pop    %r14
+  8023f0:	41 5f                	pop    %r15
+  8023f2:	5d                   	pop    %rbp
+  8023f3:	c3                   	ret
+            return read ? read : totalRead;
+  8023f4:	48 63 d0             	movslq %eax,%rdx
+  8023f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023fb:	48 0f 45 c2          	cmovne %rdx,%rax
+  8023ff:	eb e4                	jmp    8023e5 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802401:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802405:	eb da                	jmp    8023e1 <devfile_read+0x9c>
+        return E_INVAL;
+  802407:	b8 03 00 00 00       	mov    $0x3,%eax
+  80240c:	eb d7                	jmp    8023e5 <devfile_read+0xa0>
+  80240e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802413:	c3                   	ret
+
+0000000000802414 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802414:	48 85 ff             	test   %rdi,%rdi
+  802417:	74 5f                	je     802478 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  80241d:	53                   	push   %rbx
+  80241e:	48 83 ec 08          	sub    $0x8,%rsp
+  802422:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802425:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+  802431:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802437:	77 45                	ja     80247e <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802439:	48 89 de             	mov    %rbx,%rsi
+  80243c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802443:	00 00 00 
+  802446:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  80244d:	00 00 00 
+  802450:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802452:	be 00 00 00 00       	mov    $0x0,%esi
+  802457:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80245c:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802472:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+        return -E_INVAL;
+  802478:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80247d:	c3                   	ret
+        return -E_INVAL;
+  80247e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802483:	eb ed                	jmp    802472 <devfile_receive_snapshot+0x5e>
+
+0000000000802485 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802485:	55                   	push   %rbp
+  802486:	48 89 e5             	mov    %rsp,%rbp
+  802489:	41 55                	push   %r13
+  80248b:	41 54                	push   %r12
+  80248d:	53                   	push   %rbx
+  80248e:	48 83 ec 08          	sub    $0x8,%rsp
+  802492:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802495:	48 85 f6             	test   %rsi,%rsi
+  802498:	0f 94 c0             	sete   %al
+  80249b:	48 85 d2             	test   %rdx,%rdx
+  80249e:	0f 94 c2             	sete   %dl
+  8024a1:	08 d0                	or     %dl,%al
+  8024a3:	0f 85 ad 00 00 00    	jne    802556 <devfile_send_snapshot+0xd1>
+  8024a9:	48 89 fb             	mov    %rdi,%rbx
+  8024ac:	49 89 f4             	mov    %rsi,%r12
+  8024af:	48 85 ff             	test   %rdi,%rdi
+  8024b2:	0f 84 9e 00 00 00    	je     802556 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024b8:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+  8024c4:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024ca:	0f 87 8d 00 00 00    	ja     80255d <devfile_send_snapshot+0xd8>
+  8024d0:	4c 89 e7             	mov    %r12,%rdi
+  8024d3:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+  8024df:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024e5:	77 7d                	ja     802564 <devfile_send_snapshot+0xdf>
+  8024e7:	4c 89 ef             	mov    %r13,%rdi
+  8024ea:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8024f1:	00 00 00 
+  8024f4:	ff d0                	call   *%rax
+  8024f6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024fc:	77 6d                	ja     80256b <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8024fe:	48 89 de             	mov    %rbx,%rsi
+  802501:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802508:	00 00 00 
+  80250b:	48 bb 03 0b 80 00 00 	movabs $0x800b03,%rbx
+  802512:	00 00 00 
+  802515:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802517:	4c 89 e6             	mov    %r12,%rsi
+  80251a:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802521:	00 00 00 
+  802524:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802526:	4c 89 ee             	mov    %r13,%rsi
+  802529:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802530:	00 00 00 
+  802533:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802535:	be 00 00 00 00       	mov    $0x0,%esi
+  80253a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80253f:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+}
+  80254b:	48 83 c4 08          	add    $0x8,%rsp
+  80254f:	5b                   	pop    %rbx
+  802550:	41 5c                	pop    %r12
+  802552:	41 5d                	pop    %r13
+  802554:	5d                   	pop    %rbp
+  802555:	c3                   	ret
+        return -E_INVAL;
+  802556:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255b:	eb ee                	jmp    80254b <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80255d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802562:	eb e7                	jmp    80254b <devfile_send_snapshot+0xc6>
+  802564:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802569:	eb e0                	jmp    80254b <devfile_send_snapshot+0xc6>
+  80256b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802570:	eb d9                	jmp    80254b <devfile_send_snapshot+0xc6>
+
+0000000000802572 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802572:	48 85 ff             	test   %rdi,%rdi
+  802575:	0f 84 41 01 00 00    	je     8026bc <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80257b:	55                   	push   %rbp
+  80257c:	48 89 e5             	mov    %rsp,%rbp
+  80257f:	41 57                	push   %r15
+  802581:	41 56                	push   %r14
+  802583:	41 55                	push   %r13
+  802585:	41 54                	push   %r12
+  802587:	53                   	push   %rbx
+  802588:	48 83 ec 08          	sub    $0x8,%rsp
+  80258c:	49 89 fc             	mov    %rdi,%r12
+  80258f:	49 89 f5             	mov    %rsi,%r13
+  802592:	48 89 d3             	mov    %rdx,%rbx
+  802595:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802598:	48 85 f6             	test   %rsi,%rsi
+  80259b:	0f 84 ff 00 00 00    	je     8026a0 <devfile_diff_snapshots+0x12e>
+  8025a1:	48 85 d2             	test   %rdx,%rdx
+  8025a4:	0f 84 fd 00 00 00    	je     8026a7 <devfile_diff_snapshots+0x135>
+  8025aa:	48 85 c9             	test   %rcx,%rcx
+  8025ad:	0f 84 f4 00 00 00    	je     8026a7 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8025b3:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8025ba:	00 00 00 
+  8025bd:	ff d0                	call   *%rax
+  8025bf:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025c5:	0f 87 e3 00 00 00    	ja     8026ae <devfile_diff_snapshots+0x13c>
+  8025cb:	4c 89 ef             	mov    %r13,%rdi
+  8025ce:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025e0:	0f 87 cf 00 00 00    	ja     8026b5 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025e6:	4c 89 e6             	mov    %r12,%rsi
+  8025e9:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8025f0:	00 00 00 
+  8025f3:	4c 89 e7             	mov    %r12,%rdi
+  8025f6:	49 bf 03 0b 80 00 00 	movabs $0x800b03,%r15
+  8025fd:	00 00 00 
+  802600:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802603:	4c 89 ee             	mov    %r13,%rsi
+  802606:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80260d:	00 
+  80260e:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802611:	48 8b 03             	mov    (%rbx),%rax
+  802614:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80261b:	00 
+  80261c:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802620:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802627:	00 
+  802628:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80262c:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802633:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802634:	be 00 00 00 00       	mov    $0x0,%esi
+  802639:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80263e:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802645:	00 00 00 
+  802648:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80264a:	85 c0                	test   %eax,%eax
+  80264c:	78 43                	js     802691 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80264e:	49 8b 04 24          	mov    (%r12),%rax
+  802652:	48 89 03             	mov    %rax,(%rbx)
+  802655:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80265a:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80265e:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802663:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802667:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80266c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802670:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802674:	48 c1 e2 03          	shl    $0x3,%rdx
+  802678:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80267d:	4c 89 f7             	mov    %r14,%rdi
+  802680:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80268c:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802691:	48 83 c4 08          	add    $0x8,%rsp
+  802695:	5b                   	pop    %rbx
+  802696:	41 5c                	pop    %r12
+  802698:	41 5d                	pop    %r13
+  80269a:	41 5e                	pop    %r14
+  80269c:	41 5f                	pop    %r15
+  80269e:	5d                   	pop    %rbp
+  80269f:	c3                   	ret
+        return -E_INVAL;
+  8026a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a5:	eb ea                	jmp    802691 <devfile_diff_snapshots+0x11f>
+  8026a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ac:	eb e3                	jmp    802691 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b3:	eb dc                	jmp    802691 <devfile_diff_snapshots+0x11f>
+  8026b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ba:	eb d5                	jmp    802691 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026c1:	c3                   	ret
+
+00000000008026c2 <devfile_delete_snapshot>:
+    if (!name) {
+  8026c2:	48 85 ff             	test   %rdi,%rdi
+  8026c5:	74 5f                	je     802726 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026c7:	55                   	push   %rbp
+  8026c8:	48 89 e5             	mov    %rsp,%rbp
+  8026cb:	53                   	push   %rbx
+  8026cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d0:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026d3:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8026da:	00 00 00 
+  8026dd:	ff d0                	call   *%rax
+  8026df:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026e5:	77 45                	ja     80272c <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026e7:	48 89 de             	mov    %rbx,%rsi
+  8026ea:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026f1:	00 00 00 
+  8026f4:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802700:	be 00 00 00 00       	mov    $0x0,%esi
+  802705:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80270a:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802716:	85 c0                	test   %eax,%eax
+  802718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802720:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802724:	c9                   	leave
+  802725:	c3                   	ret
+        return -E_INVAL;
+  802726:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80272b:	c3                   	ret
+        return -E_INVAL;
+  80272c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802731:	eb ed                	jmp    802720 <devfile_delete_snapshot+0x5e>
+
+0000000000802733 <devfile_accept_snapshot>:
+    if (!name) {
+  802733:	48 85 ff             	test   %rdi,%rdi
+  802736:	74 5f                	je     802797 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802738:	55                   	push   %rbp
+  802739:	48 89 e5             	mov    %rsp,%rbp
+  80273c:	53                   	push   %rbx
+  80273d:	48 83 ec 08          	sub    $0x8,%rsp
+  802741:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802744:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+  802750:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802756:	77 45                	ja     80279d <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802758:	48 89 de             	mov    %rbx,%rsi
+  80275b:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802762:	00 00 00 
+  802765:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  80276c:	00 00 00 
+  80276f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802771:	be 00 00 00 00       	mov    $0x0,%esi
+  802776:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80277b:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802787:	85 c0                	test   %eax,%eax
+  802789:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802791:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+        return -E_INVAL;
+  802797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80279c:	c3                   	ret
+        return -E_INVAL;
+  80279d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027a2:	eb ed                	jmp    802791 <devfile_accept_snapshot+0x5e>
+
+00000000008027a4 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8027a4:	48 85 ff             	test   %rdi,%rdi
+  8027a7:	0f 84 9f 00 00 00    	je     80284c <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8027ad:	55                   	push   %rbp
+  8027ae:	48 89 e5             	mov    %rsp,%rbp
+  8027b1:	41 54                	push   %r12
+  8027b3:	53                   	push   %rbx
+  8027b4:	48 89 fb             	mov    %rdi,%rbx
+  8027b7:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027ba:	48 85 f6             	test   %rsi,%rsi
+  8027bd:	74 78                	je     802837 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027bf:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8027c6:	00 00 00 
+  8027c9:	ff d0                	call   *%rax
+  8027cb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027d1:	77 6b                	ja     80283e <devfile_create_snapshot+0x9a>
+  8027d3:	4c 89 e7             	mov    %r12,%rdi
+  8027d6:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027e8:	77 5b                	ja     802845 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027ea:	48 89 de             	mov    %rbx,%rsi
+  8027ed:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027f4:	00 00 00 
+  8027f7:	48 bb 03 0b 80 00 00 	movabs $0x800b03,%rbx
+  8027fe:	00 00 00 
+  802801:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802803:	4c 89 e6             	mov    %r12,%rsi
+  802806:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80280d:	00 00 00 
+  802810:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802812:	be 00 00 00 00       	mov    $0x0,%esi
+  802817:	bf 08 00 00 00       	mov    $0x8,%edi
+  80281c:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802832:	5b                   	pop    %rbx
+  802833:	41 5c                	pop    %r12
+  802835:	5d                   	pop    %rbp
+  802836:	c3                   	ret
+        return -E_INVAL;
+  802837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80283c:	eb f4                	jmp    802832 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80283e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802843:	eb ed                	jmp    802832 <devfile_create_snapshot+0x8e>
+  802845:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284a:	eb e6                	jmp    802832 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80284c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802851:	c3                   	ret
+
+0000000000802852 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802852:	55                   	push   %rbp
+  802853:	48 89 e5             	mov    %rsp,%rbp
+  802856:	41 54                	push   %r12
+  802858:	53                   	push   %rbx
+  802859:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80285c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80285f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802866:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802868:	be 00 00 00 00       	mov    $0x0,%esi
+  80286d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802872:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802879:	00 00 00 
+  80287c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80287e:	85 c0                	test   %eax,%eax
+  802880:	78 3d                	js     8028bf <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802882:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802889:	00 00 00 
+  80288c:	4c 89 e6             	mov    %r12,%rsi
+  80288f:	48 89 df             	mov    %rbx,%rdi
+  802892:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80289e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8028a5:	00 
+  8028a6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028ac:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8028b3:	00 
+  8028b4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028bf:	5b                   	pop    %rbx
+  8028c0:	41 5c                	pop    %r12
+  8028c2:	5d                   	pop    %rbp
+  8028c3:	c3                   	ret
+
+00000000008028c4 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 57                	push   %r15
+  8028ca:	41 56                	push   %r14
+  8028cc:	41 55                	push   %r13
+  8028ce:	41 54                	push   %r12
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 38          	sub    $0x38,%rsp
+  8028d5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028d9:	49 89 f5             	mov    %rsi,%r13
+  8028dc:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028df:	48 89 f0             	mov    %rsi,%rax
+  8028e2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028e7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028eb:	75 4f                	jne    80293c <devfile_readmap+0x78>
+  8028ed:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028f1:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028f7:	75 1f                	jne    802918 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8028f9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028fd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802901:	49 be ac 30 80 00 00 	movabs $0x8030ac,%r14
+  802908:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80290b:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802912:	0f 87 9d 00 00 00    	ja     8029b5 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802918:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80291c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802920:	4d 85 ff             	test   %r15,%r15
+  802923:	0f 85 cf 00 00 00    	jne    8029f8 <devfile_readmap+0x134>
+  802929:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80292d:	48 83 c4 38          	add    $0x38,%rsp
+  802931:	5b                   	pop    %rbx
+  802932:	41 5c                	pop    %r12
+  802934:	41 5d                	pop    %r13
+  802936:	41 5e                	pop    %r14
+  802938:	41 5f                	pop    %r15
+  80293a:	5d                   	pop    %rbp
+  80293b:	c3                   	ret
+    size_t totalRead = 0;
+  80293c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802943:	00 
+  802944:	eb da                	jmp    802920 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802946:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80294a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80294d:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802954:	00 00 00 
+  802957:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802959:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80295d:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802961:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802965:	4c 89 ee             	mov    %r13,%rsi
+  802968:	bf 14 00 00 00       	mov    $0x14,%edi
+  80296d:	48 b8 72 20 80 00 00 	movabs $0x802072,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	7e a3                	jle    802920 <devfile_readmap+0x5c>
+  80297d:	48 98                	cltq
+  80297f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802983:	72 9b                	jb     802920 <devfile_readmap+0x5c>
+        buf += read;
+  802985:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802988:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  80298b:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80298f:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802996:	75 88                	jne    802920 <devfile_readmap+0x5c>
+  802998:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80299c:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8029a2:	0f 85 78 ff ff ff    	jne    802920 <devfile_readmap+0x5c>
+  8029a8:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  8029af:	0f 86 6b ff ff ff    	jbe    802920 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029b5:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029bb:	4d 39 e7             	cmp    %r12,%r15
+  8029be:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029c2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029c9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029cd:	0f 84 73 ff ff ff    	je     802946 <devfile_readmap+0x82>
+  8029d3:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029d7:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029dc:	41 ff d6             	call   *%r14
+  8029df:	a8 40                	test   $0x40,%al
+  8029e1:	0f 85 39 ff ff ff    	jne    802920 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029e7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029ee:	4c 39 e3             	cmp    %r12,%rbx
+  8029f1:	72 e4                	jb     8029d7 <devfile_readmap+0x113>
+  8029f3:	e9 4e ff ff ff       	jmp    802946 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8029f8:	4c 89 fa             	mov    %r15,%rdx
+  8029fb:	4c 89 ee             	mov    %r13,%rsi
+  8029fe:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a02:	48 b8 45 23 80 00 00 	movabs $0x802345,%rax
+  802a09:	00 00 00 
+  802a0c:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a0e:	48 85 c0             	test   %rax,%rax
+  802a11:	78 0c                	js     802a1f <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a13:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a17:	48 01 f0             	add    %rsi,%rax
+  802a1a:	e9 0e ff ff ff       	jmp    80292d <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a1f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a23:	48 85 f6             	test   %rsi,%rsi
+  802a26:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a2a:	e9 fe fe ff ff       	jmp    80292d <devfile_readmap+0x69>
+
+0000000000802a2f <open>:
+open(const char *path, int mode) {
+  802a2f:	55                   	push   %rbp
+  802a30:	48 89 e5             	mov    %rsp,%rbp
+  802a33:	41 55                	push   %r13
+  802a35:	41 54                	push   %r12
+  802a37:	53                   	push   %rbx
+  802a38:	48 83 ec 18          	sub    $0x18,%rsp
+  802a3c:	49 89 fc             	mov    %rdi,%r12
+  802a3f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a42:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  802a49:	00 00 00 
+  802a4c:	ff d0                	call   *%rax
+  802a4e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a54:	0f 87 8a 00 00 00    	ja     802ae4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a5a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a5e:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+  802a6a:	89 c3                	mov    %eax,%ebx
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	78 50                	js     802ac0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a70:	4c 89 e6             	mov    %r12,%rsi
+  802a73:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a7a:	00 00 00 
+  802a7d:	48 89 df             	mov    %rbx,%rdi
+  802a80:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a8c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a93:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a97:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a9c:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802aa3:	00 00 00 
+  802aa6:	ff d0                	call   *%rax
+  802aa8:	89 c3                	mov    %eax,%ebx
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	78 1f                	js     802acd <open+0x9e>
+    return fd2num(fd);
+  802aae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ab2:	48 b8 5f 15 80 00 00 	movabs $0x80155f,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	89 c3                	mov    %eax,%ebx
+}
+  802ac0:	89 d8                	mov    %ebx,%eax
+  802ac2:	48 83 c4 18          	add    $0x18,%rsp
+  802ac6:	5b                   	pop    %rbx
+  802ac7:	41 5c                	pop    %r12
+  802ac9:	41 5d                	pop    %r13
+  802acb:	5d                   	pop    %rbp
+  802acc:	c3                   	ret
+        fd_close(fd, 0);
+  802acd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ad6:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+        return res;
+  802ae2:	eb dc                	jmp    802ac0 <open+0x91>
+        return -E_BAD_PATH;
+  802ae4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ae9:	eb d5                	jmp    802ac0 <open+0x91>
+
+0000000000802aeb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802aeb:	55                   	push   %rbp
+  802aec:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802aef:	be 00 00 00 00       	mov    $0x0,%esi
+  802af4:	bf 13 00 00 00       	mov    $0x13,%edi
+  802af9:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802b00:	00 00 00 
+  802b03:	ff d0                	call   *%rax
+}
+  802b05:	5d                   	pop    %rbp
+  802b06:	c3                   	ret
+
+0000000000802b07 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	41 54                	push   %r12
+  802b0d:	53                   	push   %rbx
+  802b0e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b11:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+  802b1d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b20:	48 be 00 3d 80 00 00 	movabs $0x803d00,%rsi
+  802b27:	00 00 00 
+  802b2a:	48 89 df             	mov    %rbx,%rdi
+  802b2d:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b39:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b3e:	41 2b 04 24          	sub    (%r12),%eax
+  802b42:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b4f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b52:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b59:	00 00 00 
+  802b5c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b68:	5b                   	pop    %rbx
+  802b69:	41 5c                	pop    %r12
+  802b6b:	5d                   	pop    %rbp
+  802b6c:	c3                   	ret
+
+0000000000802b6d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b6d:	55                   	push   %rbp
+  802b6e:	48 89 e5             	mov    %rsp,%rbp
+  802b71:	41 54                	push   %r12
+  802b73:	53                   	push   %rbx
+  802b74:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b7c:	48 89 fe             	mov    %rdi,%rsi
+  802b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b84:	49 bc 5b 12 80 00 00 	movabs $0x80125b,%r12
+  802b8b:	00 00 00 
+  802b8e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b91:	48 89 df             	mov    %rbx,%rdi
+  802b94:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+  802ba0:	48 89 c6             	mov    %rax,%rsi
+  802ba3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bad:	41 ff d4             	call   *%r12
+}
+  802bb0:	5b                   	pop    %rbx
+  802bb1:	41 5c                	pop    %r12
+  802bb3:	5d                   	pop    %rbp
+  802bb4:	c3                   	ret
+
+0000000000802bb5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802bb5:	55                   	push   %rbp
+  802bb6:	48 89 e5             	mov    %rsp,%rbp
+  802bb9:	41 57                	push   %r15
+  802bbb:	41 56                	push   %r14
+  802bbd:	41 55                	push   %r13
+  802bbf:	41 54                	push   %r12
+  802bc1:	53                   	push   %rbx
+  802bc2:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc6:	49 89 fc             	mov    %rdi,%r12
+  802bc9:	49 89 f5             	mov    %rsi,%r13
+  802bcc:	49 89 d7             	mov    %rdx,%r15
+  802bcf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bd3:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bdf:	4d 85 ff             	test   %r15,%r15
+  802be2:	0f 84 af 00 00 00    	je     802c97 <devpipe_write+0xe2>
+  802be8:	48 89 c3             	mov    %rax,%rbx
+  802beb:	4c 89 f8             	mov    %r15,%rax
+  802bee:	4d 89 ef             	mov    %r13,%r15
+  802bf1:	4c 01 e8             	add    %r13,%rax
+  802bf4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bf8:	49 bd 63 11 80 00 00 	movabs $0x801163,%r13
+  802bff:	00 00 00 
+            sys_yield();
+  802c02:	49 be 00 11 80 00 00 	movabs $0x801100,%r14
+  802c09:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c0c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c0f:	48 63 ce             	movslq %esi,%rcx
+  802c12:	48 63 03             	movslq (%rbx),%rax
+  802c15:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c1b:	48 39 c1             	cmp    %rax,%rcx
+  802c1e:	72 2e                	jb     802c4e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c20:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c25:	48 89 da             	mov    %rbx,%rdx
+  802c28:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c2d:	4c 89 e7             	mov    %r12,%rdi
+  802c30:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	74 66                	je     802c9d <devpipe_write+0xe8>
+            sys_yield();
+  802c37:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c3a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c3d:	48 63 ce             	movslq %esi,%rcx
+  802c40:	48 63 03             	movslq (%rbx),%rax
+  802c43:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c49:	48 39 c1             	cmp    %rax,%rcx
+  802c4c:	73 d2                	jae    802c20 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c4e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c52:	48 89 ca             	mov    %rcx,%rdx
+  802c55:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c59:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c60:	08 10 20 
+  802c63:	48 f7 e2             	mul    %rdx
+  802c66:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c6a:	48 89 d0             	mov    %rdx,%rax
+  802c6d:	48 c1 e0 09          	shl    $0x9,%rax
+  802c71:	48 29 d0             	sub    %rdx,%rax
+  802c74:	48 c1 e0 03          	shl    $0x3,%rax
+  802c78:	48 29 c1             	sub    %rax,%rcx
+  802c7b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c80:	83 c6 01             	add    $0x1,%esi
+  802c83:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c86:	49 83 c7 01          	add    $0x1,%r15
+  802c8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8e:	49 39 c7             	cmp    %rax,%r15
+  802c91:	0f 85 75 ff ff ff    	jne    802c0c <devpipe_write+0x57>
+    return n;
+  802c97:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c9b:	eb 05                	jmp    802ca2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca2:	48 83 c4 18          	add    $0x18,%rsp
+  802ca6:	5b                   	pop    %rbx
+  802ca7:	41 5c                	pop    %r12
+  802ca9:	41 5d                	pop    %r13
+  802cab:	41 5e                	pop    %r14
+  802cad:	41 5f                	pop    %r15
+  802caf:	5d                   	pop    %rbp
+  802cb0:	c3                   	ret
+
+0000000000802cb1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cb1:	55                   	push   %rbp
+  802cb2:	48 89 e5             	mov    %rsp,%rbp
+  802cb5:	41 57                	push   %r15
+  802cb7:	41 56                	push   %r14
+  802cb9:	41 55                	push   %r13
+  802cbb:	41 54                	push   %r12
+  802cbd:	53                   	push   %rbx
+  802cbe:	48 83 ec 18          	sub    $0x18,%rsp
+  802cc2:	49 89 fc             	mov    %rdi,%r12
+  802cc5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cc9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ccd:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+  802cd9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cdc:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ce2:	49 bd 63 11 80 00 00 	movabs $0x801163,%r13
+  802ce9:	00 00 00 
+            sys_yield();
+  802cec:	49 be 00 11 80 00 00 	movabs $0x801100,%r14
+  802cf3:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802cf6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802cfb:	74 7d                	je     802d7a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802cfd:	8b 03                	mov    (%rbx),%eax
+  802cff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d02:	75 26                	jne    802d2a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d04:	4d 85 ff             	test   %r15,%r15
+  802d07:	75 77                	jne    802d80 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d09:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d0e:	48 89 da             	mov    %rbx,%rdx
+  802d11:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d16:	4c 89 e7             	mov    %r12,%rdi
+  802d19:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d1c:	85 c0                	test   %eax,%eax
+  802d1e:	74 72                	je     802d92 <devpipe_read+0xe1>
+            sys_yield();
+  802d20:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d23:	8b 03                	mov    (%rbx),%eax
+  802d25:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d28:	74 df                	je     802d09 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d2a:	48 63 c8             	movslq %eax,%rcx
+  802d2d:	48 89 ca             	mov    %rcx,%rdx
+  802d30:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d34:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d3b:	08 10 20 
+  802d3e:	48 89 d0             	mov    %rdx,%rax
+  802d41:	48 f7 e6             	mul    %rsi
+  802d44:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d48:	48 89 d0             	mov    %rdx,%rax
+  802d4b:	48 c1 e0 09          	shl    $0x9,%rax
+  802d4f:	48 29 d0             	sub    %rdx,%rax
+  802d52:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d59:	00 
+  802d5a:	48 89 c8             	mov    %rcx,%rax
+  802d5d:	48 29 d0             	sub    %rdx,%rax
+  802d60:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d65:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d69:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d6d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d70:	49 83 c7 01          	add    $0x1,%r15
+  802d74:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d78:	75 83                	jne    802cfd <devpipe_read+0x4c>
+    return n;
+  802d7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d7e:	eb 03                	jmp    802d83 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d80:	4c 89 f8             	mov    %r15,%rax
+}
+  802d83:	48 83 c4 18          	add    $0x18,%rsp
+  802d87:	5b                   	pop    %rbx
+  802d88:	41 5c                	pop    %r12
+  802d8a:	41 5d                	pop    %r13
+  802d8c:	41 5e                	pop    %r14
+  802d8e:	41 5f                	pop    %r15
+  802d90:	5d                   	pop    %rbp
+  802d91:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d97:	eb ea                	jmp    802d83 <devpipe_read+0xd2>
+
+0000000000802d99 <pipe>:
+pipe(int pfd[2]) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	41 55                	push   %r13
+  802d9f:	41 54                	push   %r12
+  802da1:	53                   	push   %rbx
+  802da2:	48 83 ec 18          	sub    $0x18,%rsp
+  802da6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802da9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802dad:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+  802db9:	89 c3                	mov    %eax,%ebx
+  802dbb:	85 c0                	test   %eax,%eax
+  802dbd:	0f 88 a0 01 00 00    	js     802f63 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802dc3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dcd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd6:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+  802de2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	0f 88 77 01 00 00    	js     802f63 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dec:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802df0:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802df7:	00 00 00 
+  802dfa:	ff d0                	call   *%rax
+  802dfc:	89 c3                	mov    %eax,%ebx
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	0f 88 43 01 00 00    	js     802f49 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e06:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e10:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e19:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+  802e25:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	0f 88 1a 01 00 00    	js     802f49 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e2f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e33:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e42:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e4c:	48 89 c6             	mov    %rax,%rsi
+  802e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e54:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	89 c3                	mov    %eax,%ebx
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	0f 88 c5 00 00 00    	js     802f2f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e6a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e6e:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+  802e7a:	48 89 c1             	mov    %rax,%rcx
+  802e7d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8e:	4c 89 ee             	mov    %r13,%rsi
+  802e91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e96:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  802e9d:	00 00 00 
+  802ea0:	ff d0                	call   *%rax
+  802ea2:	89 c3                	mov    %eax,%ebx
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	78 6e                	js     802f16 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ea8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ead:	4c 89 ef             	mov    %r13,%rdi
+  802eb0:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	83 f8 02             	cmp    $0x2,%eax
+  802ebf:	0f 85 ab 00 00 00    	jne    802f70 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802ec5:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802ecc:	00 00 
+  802ece:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ed2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ed4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ed8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802edf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ee3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ee5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ee9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802ef0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef4:	48 bb 5f 15 80 00 00 	movabs $0x80155f,%rbx
+  802efb:	00 00 00 
+  802efe:	ff d3                	call   *%rbx
+  802f00:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f04:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f08:	ff d3                	call   *%rbx
+  802f0a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f14:	eb 4d                	jmp    802f63 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f1b:	4c 89 ee             	mov    %r13,%rsi
+  802f1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f23:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f34:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3d:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f4e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f57:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f5e:	00 00 00 
+  802f61:	ff d0                	call   *%rax
+}
+  802f63:	89 d8                	mov    %ebx,%eax
+  802f65:	48 83 c4 18          	add    $0x18,%rsp
+  802f69:	5b                   	pop    %rbx
+  802f6a:	41 5c                	pop    %r12
+  802f6c:	41 5d                	pop    %r13
+  802f6e:	5d                   	pop    %rbp
+  802f6f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f70:	48 b9 30 3d 80 00 00 	movabs $0x803d30,%rcx
+  802f77:	00 00 00 
+  802f7a:	48 ba 07 3d 80 00 00 	movabs $0x803d07,%rdx
+  802f81:	00 00 00 
+  802f84:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f89:	48 bf 1c 3d 80 00 00 	movabs $0x803d1c,%rdi
+  802f90:	00 00 00 
+  802f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f98:	49 b8 f0 33 80 00 00 	movabs $0x8033f0,%r8
+  802f9f:	00 00 00 
+  802fa2:	41 ff d0             	call   *%r8
+
+0000000000802fa5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802fa5:	55                   	push   %rbp
+  802fa6:	48 89 e5             	mov    %rsp,%rbp
+  802fa9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802fad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fb1:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fbd:	85 c0                	test   %eax,%eax
+  802fbf:	78 35                	js     802ff6 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fc1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fc5:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fd4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fd9:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fde:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fe2:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  802fe9:	00 00 00 
+  802fec:	ff d0                	call   *%rax
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	0f 94 c0             	sete   %al
+  802ff3:	0f b6 c0             	movzbl %al,%eax
+}
+  802ff6:	c9                   	leave
+  802ff7:	c3                   	ret
+
+0000000000802ff8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ff8:	48 89 f8             	mov    %rdi,%rax
+  802ffb:	48 c1 e8 27          	shr    $0x27,%rax
+  802fff:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803006:	01 00 00 
+  803009:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80300d:	f6 c2 01             	test   $0x1,%dl
+  803010:	74 6d                	je     80307f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803012:	48 89 f8             	mov    %rdi,%rax
+  803015:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803019:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803020:	01 00 00 
+  803023:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803027:	f6 c2 01             	test   $0x1,%dl
+  80302a:	74 62                	je     80308e <get_uvpt_entry+0x96>
+  80302c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803033:	01 00 00 
+  803036:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80303a:	f6 c2 80             	test   $0x80,%dl
+  80303d:	75 4f                	jne    80308e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80303f:	48 89 f8             	mov    %rdi,%rax
+  803042:	48 c1 e8 15          	shr    $0x15,%rax
+  803046:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80304d:	01 00 00 
+  803050:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803054:	f6 c2 01             	test   $0x1,%dl
+  803057:	74 44                	je     80309d <get_uvpt_entry+0xa5>
+  803059:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803060:	01 00 00 
+  803063:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803067:	f6 c2 80             	test   $0x80,%dl
+  80306a:	75 31                	jne    80309d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80306c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803070:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803077:	01 00 00 
+  80307a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80307e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80307f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803086:	01 00 00 
+  803089:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80308d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80308e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803095:	01 00 00 
+  803098:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80309c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80309d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030a4:	01 00 00 
+  8030a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030ab:	c3                   	ret
+
+00000000008030ac <get_prot>:
+
+int
+get_prot(void *va) {
+  8030ac:	55                   	push   %rbp
+  8030ad:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030b0:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  8030b7:	00 00 00 
+  8030ba:	ff d0                	call   *%rax
+  8030bc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030bf:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030c4:	89 c1                	mov    %eax,%ecx
+  8030c6:	83 c9 04             	or     $0x4,%ecx
+  8030c9:	f6 c2 01             	test   $0x1,%dl
+  8030cc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030cf:	89 c1                	mov    %eax,%ecx
+  8030d1:	83 c9 02             	or     $0x2,%ecx
+  8030d4:	f6 c2 02             	test   $0x2,%dl
+  8030d7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030da:	89 c1                	mov    %eax,%ecx
+  8030dc:	83 c9 01             	or     $0x1,%ecx
+  8030df:	48 85 d2             	test   %rdx,%rdx
+  8030e2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030e5:	89 c1                	mov    %eax,%ecx
+  8030e7:	83 c9 40             	or     $0x40,%ecx
+  8030ea:	f6 c6 04             	test   $0x4,%dh
+  8030ed:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030f0:	5d                   	pop    %rbp
+  8030f1:	c3                   	ret
+
+00000000008030f2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030f2:	55                   	push   %rbp
+  8030f3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030f6:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803102:	48 c1 e8 06          	shr    $0x6,%rax
+  803106:	83 e0 01             	and    $0x1,%eax
+}
+  803109:	5d                   	pop    %rbp
+  80310a:	c3                   	ret
+
+000000000080310b <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80310b:	55                   	push   %rbp
+  80310c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80310f:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80311b:	48 c1 e8 05          	shr    $0x5,%rax
+  80311f:	83 e0 01             	and    $0x1,%eax
+}
+  803122:	5d                   	pop    %rbp
+  803123:	c3                   	ret
+
+0000000000803124 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803128:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+  803134:	83 e0 01             	and    $0x1,%eax
+}
+  803137:	5d                   	pop    %rbp
+  803138:	c3                   	ret
+
+0000000000803139 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803139:	55                   	push   %rbp
+  80313a:	48 89 e5             	mov    %rsp,%rbp
+  80313d:	41 57                	push   %r15
+  80313f:	41 56                	push   %r14
+  803141:	41 55                	push   %r13
+  803143:	41 54                	push   %r12
+  803145:	53                   	push   %rbx
+  803146:	48 83 ec 18          	sub    $0x18,%rsp
+  80314a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80314e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803152:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803157:	49 bd 24 31 80 00 00 	movabs $0x803124,%r13
+  80315e:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803161:	49 bf ac 30 80 00 00 	movabs $0x8030ac,%r15
+  803168:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80316b:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803172:	00 00 00 
+  803175:	eb 0c                	jmp    803183 <foreach_shared_region+0x4a>
+  803177:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80317e:	4c 39 f3             	cmp    %r14,%rbx
+  803181:	74 2e                	je     8031b1 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803183:	48 89 df             	mov    %rbx,%rdi
+  803186:	41 ff d5             	call   *%r13
+  803189:	84 c0                	test   %al,%al
+  80318b:	74 ea                	je     803177 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80318d:	48 89 df             	mov    %rbx,%rdi
+  803190:	41 ff d7             	call   *%r15
+  803193:	a8 40                	test   $0x40,%al
+  803195:	74 e0                	je     803177 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803197:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80319e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031a2:	48 89 df             	mov    %rbx,%rdi
+  8031a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031a9:	ff d0                	call   *%rax
+				if (res < 0) {
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	79 c8                	jns    803177 <foreach_shared_region+0x3e>
+  8031af:	eb 05                	jmp    8031b6 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8031b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b6:	48 83 c4 18          	add    $0x18,%rsp
+  8031ba:	5b                   	pop    %rbx
+  8031bb:	41 5c                	pop    %r12
+  8031bd:	41 5d                	pop    %r13
+  8031bf:	41 5e                	pop    %r14
+  8031c1:	41 5f                	pop    %r15
+  8031c3:	5d                   	pop    %rbp
+  8031c4:	c3                   	ret
+
+00000000008031c5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ca:	c3                   	ret
+
+00000000008031cb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031d2:	48 be 54 3d 80 00 00 	movabs $0x803d54,%rsi
+  8031d9:	00 00 00 
+  8031dc:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  8031e3:	00 00 00 
+  8031e6:	ff d0                	call   *%rax
+    return 0;
+}
+  8031e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ed:	5d                   	pop    %rbp
+  8031ee:	c3                   	ret
+
+00000000008031ef <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+  8031f3:	41 57                	push   %r15
+  8031f5:	41 56                	push   %r14
+  8031f7:	41 55                	push   %r13
+  8031f9:	41 54                	push   %r12
+  8031fb:	53                   	push   %rbx
+  8031fc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803203:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80320a:	48 85 d2             	test   %rdx,%rdx
+  80320d:	74 7a                	je     803289 <devcons_write+0x9a>
+  80320f:	49 89 d6             	mov    %rdx,%r14
+  803212:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803218:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80321d:	49 bf fd 0c 80 00 00 	movabs $0x800cfd,%r15
+  803224:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803227:	4c 89 f3             	mov    %r14,%rbx
+  80322a:	48 29 f3             	sub    %rsi,%rbx
+  80322d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803232:	48 39 c3             	cmp    %rax,%rbx
+  803235:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803239:	4c 63 eb             	movslq %ebx,%r13
+  80323c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803243:	48 01 c6             	add    %rax,%rsi
+  803246:	4c 89 ea             	mov    %r13,%rdx
+  803249:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803250:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803253:	4c 89 ee             	mov    %r13,%rsi
+  803256:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80325d:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  803264:	00 00 00 
+  803267:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803269:	41 01 dc             	add    %ebx,%r12d
+  80326c:	49 63 f4             	movslq %r12d,%rsi
+  80326f:	4c 39 f6             	cmp    %r14,%rsi
+  803272:	72 b3                	jb     803227 <devcons_write+0x38>
+    return res;
+  803274:	49 63 c4             	movslq %r12d,%rax
+}
+  803277:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80327e:	5b                   	pop    %rbx
+  80327f:	41 5c                	pop    %r12
+  803281:	41 5d                	pop    %r13
+  803283:	41 5e                	pop    %r14
+  803285:	41 5f                	pop    %r15
+  803287:	5d                   	pop    %rbp
+  803288:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803289:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80328f:	eb e3                	jmp    803274 <devcons_write+0x85>
+
+0000000000803291 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803291:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803294:	ba 00 00 00 00       	mov    $0x0,%edx
+  803299:	48 85 c0             	test   %rax,%rax
+  80329c:	74 55                	je     8032f3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80329e:	55                   	push   %rbp
+  80329f:	48 89 e5             	mov    %rsp,%rbp
+  8032a2:	41 55                	push   %r13
+  8032a4:	41 54                	push   %r12
+  8032a6:	53                   	push   %rbx
+  8032a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8032ab:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8032ae:	48 bb 33 10 80 00 00 	movabs $0x801033,%rbx
+  8032b5:	00 00 00 
+  8032b8:	49 bc 00 11 80 00 00 	movabs $0x801100,%r12
+  8032bf:	00 00 00 
+  8032c2:	eb 03                	jmp    8032c7 <devcons_read+0x36>
+  8032c4:	41 ff d4             	call   *%r12
+  8032c7:	ff d3                	call   *%rbx
+  8032c9:	85 c0                	test   %eax,%eax
+  8032cb:	74 f7                	je     8032c4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8032cd:	48 63 d0             	movslq %eax,%rdx
+  8032d0:	78 13                	js     8032e5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d7:	83 f8 04             	cmp    $0x4,%eax
+  8032da:	74 09                	je     8032e5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032dc:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032e0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032e5:	48 89 d0             	mov    %rdx,%rax
+  8032e8:	48 83 c4 08          	add    $0x8,%rsp
+  8032ec:	5b                   	pop    %rbx
+  8032ed:	41 5c                	pop    %r12
+  8032ef:	41 5d                	pop    %r13
+  8032f1:	5d                   	pop    %rbp
+  8032f2:	c3                   	ret
+  8032f3:	48 89 d0             	mov    %rdx,%rax
+  8032f6:	c3                   	ret
+
+00000000008032f7 <cputchar>:
+cputchar(int ch) {
+  8032f7:	55                   	push   %rbp
+  8032f8:	48 89 e5             	mov    %rsp,%rbp
+  8032fb:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032ff:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803303:	be 01 00 00 00       	mov    $0x1,%esi
+  803308:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80330c:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+}
+  803318:	c9                   	leave
+  803319:	c3                   	ret
+
+000000000080331a <getchar>:
+getchar(void) {
+  80331a:	55                   	push   %rbp
+  80331b:	48 89 e5             	mov    %rsp,%rbp
+  80331e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803322:	ba 01 00 00 00       	mov    $0x1,%edx
+  803327:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80332b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803330:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  803337:	00 00 00 
+  80333a:	ff d0                	call   *%rax
+  80333c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80333e:	85 c0                	test   %eax,%eax
+  803340:	78 06                	js     803348 <getchar+0x2e>
+  803342:	74 08                	je     80334c <getchar+0x32>
+  803344:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803348:	89 d0                	mov    %edx,%eax
+  80334a:	c9                   	leave
+  80334b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80334c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803351:	eb f5                	jmp    803348 <getchar+0x2e>
+
+0000000000803353 <iscons>:
+iscons(int fdnum) {
+  803353:	55                   	push   %rbp
+  803354:	48 89 e5             	mov    %rsp,%rbp
+  803357:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80335b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80335f:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  803366:	00 00 00 
+  803369:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80336b:	85 c0                	test   %eax,%eax
+  80336d:	78 18                	js     803387 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80336f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803373:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80337a:	00 00 00 
+  80337d:	8b 00                	mov    (%rax),%eax
+  80337f:	39 02                	cmp    %eax,(%rdx)
+  803381:	0f 94 c0             	sete   %al
+  803384:	0f b6 c0             	movzbl %al,%eax
+}
+  803387:	c9                   	leave
+  803388:	c3                   	ret
+
+0000000000803389 <opencons>:
+opencons(void) {
+  803389:	55                   	push   %rbp
+  80338a:	48 89 e5             	mov    %rsp,%rbp
+  80338d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803391:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803395:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	78 49                	js     8033ee <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8033a5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033af:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8033b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b8:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 26                	js     8033ee <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033cc:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033d3:	00 00 
+  8033d5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033d7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033db:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033e2:	48 b8 5f 15 80 00 00 	movabs $0x80155f,%rax
+  8033e9:	00 00 00 
+  8033ec:	ff d0                	call   *%rax
+}
+  8033ee:	c9                   	leave
+  8033ef:	c3                   	ret
+
+00000000008033f0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033f0:	55                   	push   %rbp
+  8033f1:	48 89 e5             	mov    %rsp,%rbp
+  8033f4:	41 56                	push   %r14
+  8033f6:	41 55                	push   %r13
+  8033f8:	41 54                	push   %r12
+  8033fa:	53                   	push   %rbx
+  8033fb:	48 83 ec 50          	sub    $0x50,%rsp
+  8033ff:	49 89 fc             	mov    %rdi,%r12
+  803402:	41 89 f5             	mov    %esi,%r13d
+  803405:	48 89 d3             	mov    %rdx,%rbx
+  803408:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80340c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803410:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803414:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80341b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80341f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803423:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803427:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80342b:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  803432:	00 00 00 
+  803435:	4c 8b 30             	mov    (%rax),%r14
+  803438:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+  803444:	89 c6                	mov    %eax,%esi
+  803446:	45 89 e8             	mov    %r13d,%r8d
+  803449:	4c 89 e1             	mov    %r12,%rcx
+  80344c:	4c 89 f2             	mov    %r14,%rdx
+  80344f:	48 bf 60 3d 80 00 00 	movabs $0x803d60,%rdi
+  803456:	00 00 00 
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	49 bc de 01 80 00 00 	movabs $0x8001de,%r12
+  803465:	00 00 00 
+  803468:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80346b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80346f:	48 89 df             	mov    %rbx,%rdi
+  803472:	48 b8 7a 01 80 00 00 	movabs $0x80017a,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80347e:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  803485:	00 00 00 
+  803488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803490:	cc                   	int3
+  803491:	eb fd                	jmp    803490 <_panic+0xa0>
+
+0000000000803493 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803493:	55                   	push   %rbp
+  803494:	48 89 e5             	mov    %rsp,%rbp
+  803497:	41 55                	push   %r13
+  803499:	41 54                	push   %r12
+  80349b:	53                   	push   %rbx
+  80349c:	48 83 ec 08          	sub    $0x8,%rsp
+  8034a0:	49 89 fc             	mov    %rdi,%r12
+  8034a3:	48 89 f7             	mov    %rsi,%rdi
+  8034a6:	48 89 d3             	mov    %rdx,%rbx
+  8034a9:	49 89 cd             	mov    %rcx,%r13
+  8034ac:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8034af:	48 85 f6             	test   %rsi,%rsi
+  8034b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034b9:	00 00 00 
+  8034bc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034c5:	48 85 db             	test   %rbx,%rbx
+  8034c8:	74 03                	je     8034cd <ipc_recv_timed+0x3a>
+  8034ca:	48 8b 33             	mov    (%rbx),%rsi
+  8034cd:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 75                	js     803552 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034dd:	4d 85 e4             	test   %r12,%r12
+  8034e0:	74 14                	je     8034f6 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034e2:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8034e9:	00 00 00 
+  8034ec:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034f2:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034f6:	4d 85 ed             	test   %r13,%r13
+  8034f9:	74 14                	je     80350f <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034fb:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  803502:	00 00 00 
+  803505:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80350b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80350f:	48 85 db             	test   %rbx,%rbx
+  803512:	74 23                	je     803537 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803514:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80351b:	00 00 00 
+  80351e:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803524:	ba 00 00 00 00       	mov    $0x0,%edx
+  803529:	85 c9                	test   %ecx,%ecx
+  80352b:	74 07                	je     803534 <ipc_recv_timed+0xa1>
+  80352d:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803534:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803537:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80353e:	00 00 00 
+  803541:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803547:	48 83 c4 08          	add    $0x8,%rsp
+  80354b:	5b                   	pop    %rbx
+  80354c:	41 5c                	pop    %r12
+  80354e:	41 5d                	pop    %r13
+  803550:	5d                   	pop    %rbp
+  803551:	c3                   	ret
+        if (from_env_store != NULL) {
+  803552:	4d 85 e4             	test   %r12,%r12
+  803555:	74 08                	je     80355f <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803557:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80355e:	00 
+        if (perm_store != NULL) {
+  80355f:	4d 85 ed             	test   %r13,%r13
+  803562:	74 08                	je     80356c <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803564:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80356b:	00 
+        if (size != NULL) {
+  80356c:	48 85 db             	test   %rbx,%rbx
+  80356f:	74 d6                	je     803547 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803571:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803578:	eb cd                	jmp    803547 <ipc_recv_timed+0xb4>
+
+000000000080357a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80357a:	55                   	push   %rbp
+  80357b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80357e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803584:	48 b8 93 34 80 00 00 	movabs $0x803493,%rax
+  80358b:	00 00 00 
+  80358e:	ff d0                	call   *%rax
+}
+  803590:	5d                   	pop    %rbp
+  803591:	c3                   	ret
+
+0000000000803592 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803592:	55                   	push   %rbp
+  803593:	48 89 e5             	mov    %rsp,%rbp
+  803596:	41 57                	push   %r15
+  803598:	41 56                	push   %r14
+  80359a:	41 55                	push   %r13
+  80359c:	41 54                	push   %r12
+  80359e:	53                   	push   %rbx
+  80359f:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a3:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8035a6:	48 89 d3             	mov    %rdx,%rbx
+  8035a9:	49 89 cc             	mov    %rcx,%r12
+  8035ac:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035af:	48 85 d2             	test   %rdx,%rdx
+  8035b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035b9:	00 00 00 
+  8035bc:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035c0:	89 f0                	mov    %esi,%eax
+  8035c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035c6:	48 89 da             	mov    %rbx,%rdx
+  8035c9:	48 89 c6             	mov    %rax,%rsi
+  8035cc:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	79 65                	jns    803641 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035dc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035df:	75 33                	jne    803614 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035e1:	49 bf 00 11 80 00 00 	movabs $0x801100,%r15
+  8035e8:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035eb:	49 be fd 13 80 00 00 	movabs $0x8013fd,%r14
+  8035f2:	00 00 00 
+        sys_yield();
+  8035f5:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035f8:	45 89 e8             	mov    %r13d,%r8d
+  8035fb:	4c 89 e1             	mov    %r12,%rcx
+  8035fe:	48 89 da             	mov    %rbx,%rdx
+  803601:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803605:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803608:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80360b:	85 c0                	test   %eax,%eax
+  80360d:	79 32                	jns    803641 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80360f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803612:	74 e1                	je     8035f5 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803614:	89 c1                	mov    %eax,%ecx
+  803616:	48 ba 83 3d 80 00 00 	movabs $0x803d83,%rdx
+  80361d:	00 00 00 
+  803620:	be 52 00 00 00       	mov    $0x52,%esi
+  803625:	48 bf 97 3d 80 00 00 	movabs $0x803d97,%rdi
+  80362c:	00 00 00 
+  80362f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803634:	49 b8 f0 33 80 00 00 	movabs $0x8033f0,%r8
+  80363b:	00 00 00 
+  80363e:	41 ff d0             	call   *%r8
+    }
+}
+  803641:	48 83 c4 18          	add    $0x18,%rsp
+  803645:	5b                   	pop    %rbx
+  803646:	41 5c                	pop    %r12
+  803648:	41 5d                	pop    %r13
+  80364a:	41 5e                	pop    %r14
+  80364c:	41 5f                	pop    %r15
+  80364e:	5d                   	pop    %rbp
+  80364f:	c3                   	ret
+
+0000000000803650 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803650:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803655:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80365c:	00 00 00 
+  80365f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803663:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803667:	48 c1 e2 04          	shl    $0x4,%rdx
+  80366b:	48 01 ca             	add    %rcx,%rdx
+  80366e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803674:	39 fa                	cmp    %edi,%edx
+  803676:	74 12                	je     80368a <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803678:	48 83 c0 01          	add    $0x1,%rax
+  80367c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803682:	75 db                	jne    80365f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803684:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803689:	c3                   	ret
+            return envs[i].env_id;
+  80368a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80368e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803692:	48 c1 e2 04          	shl    $0x4,%rdx
+  803696:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80369d:	00 00 00 
+  8036a0:	48 01 d0             	add    %rdx,%rax
+  8036a3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036a9:	c3                   	ret
+  8036aa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008036b0 <__rodata_start>:
+  8036b0:	31 33                	xor    %esi,(%rbx)
+  8036b2:	33 37                	xor    (%rdi),%esi
+  8036b4:	2f                   	(bad)
+  8036b5:	30 20                	xor    %ah,(%rax)
+  8036b7:	69 73 20 25 30 38 78 	imul   $0x78383025,0x20(%rbx),%esi
+  8036be:	21 0a                	and    %ecx,(%rdx)
+  8036c0:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8036c7:	77 6e                	ja     803737 <__rodata_start+0x87>
+  8036c9:	3e 00 30             	ds add %dh,(%rax)
+  8036cc:	31 32                	xor    %esi,(%rdx)
+  8036ce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036d5:	41                   	rex.B
+  8036d6:	42                   	rex.X
+  8036d7:	43                   	rex.XB
+  8036d8:	44                   	rex.R
+  8036d9:	45                   	rex.RB
+  8036da:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036dd:	31 32                	xor    %esi,(%rdx)
+  8036df:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036e6:	61                   	(bad)
+  8036e7:	62 63 64 65 66       	(bad)
+  8036ec:	00 28                	add    %ch,(%rax)
+  8036ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ef:	75 6c                	jne    80375d <__rodata_start+0xad>
+  8036f1:	6c                   	insb   (%dx),%es:(%rdi)
+  8036f2:	29 00                	sub    %eax,(%rax)
+  8036f4:	65 72 72             	gs jb  803769 <__rodata_start+0xb9>
+  8036f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036f8:	72 20                	jb     80371a <__rodata_start+0x6a>
+  8036fa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8036ff:	73 70                	jae    803771 <__rodata_start+0xc1>
+  803701:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803705:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80370c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80370d:	72 00                	jb     80370f <__rodata_start+0x5f>
+  80370f:	62 61 64 20 65       	(bad)
+  803714:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803715:	76 69                	jbe    803780 <__rodata_start+0xd0>
+  803717:	72 6f                	jb     803788 <__rodata_start+0xd8>
+  803719:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371a:	6d                   	insl   (%dx),%es:(%rdi)
+  80371b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80371d:	74 00                	je     80371f <__rodata_start+0x6f>
+  80371f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803726:	20 70 61             	and    %dh,0x61(%rax)
+  803729:	72 61                	jb     80378c <__rodata_start+0xdc>
+  80372b:	6d                   	insl   (%dx),%es:(%rdi)
+  80372c:	65 74 65             	gs je  803794 <__rodata_start+0xe4>
+  80372f:	72 00                	jb     803731 <__rodata_start+0x81>
+  803731:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803732:	75 74                	jne    8037a8 <__rodata_start+0xf8>
+  803734:	20 6f 66             	and    %ch,0x66(%rdi)
+  803737:	20 6d 65             	and    %ch,0x65(%rbp)
+  80373a:	6d                   	insl   (%dx),%es:(%rdi)
+  80373b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373c:	72 79                	jb     8037b7 <__rodata_start+0x107>
+  80373e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803741:	74 20                	je     803763 <__rodata_start+0xb3>
+  803743:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803744:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803748:	76 69                	jbe    8037b3 <__rodata_start+0x103>
+  80374a:	72 6f                	jb     8037bb <__rodata_start+0x10b>
+  80374c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80374d:	6d                   	insl   (%dx),%es:(%rdi)
+  80374e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803750:	74 73                	je     8037c5 <__rodata_start+0x115>
+  803752:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803755:	72 72                	jb     8037c9 <__rodata_start+0x119>
+  803757:	75 70                	jne    8037c9 <__rodata_start+0x119>
+  803759:	74 65                	je     8037c0 <__rodata_start+0x110>
+  80375b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803760:	75 67                	jne    8037c9 <__rodata_start+0x119>
+  803762:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803765:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803767:	00 73 65             	add    %dh,0x65(%rbx)
+  80376a:	67 6d                	insl   (%dx),%es:(%edi)
+  80376c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80376e:	74 61                	je     8037d1 <__rodata_start+0x121>
+  803770:	74 69                	je     8037db <__rodata_start+0x12b>
+  803772:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803773:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803774:	20 66 61             	and    %ah,0x61(%rsi)
+  803777:	75 6c                	jne    8037e5 <__rodata_start+0x135>
+  803779:	74 00                	je     80377b <__rodata_start+0xcb>
+  80377b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803782:	20 45 4c             	and    %al,0x4c(%rbp)
+  803785:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803789:	61                   	(bad)
+  80378a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80378f:	20 73 75             	and    %dh,0x75(%rbx)
+  803792:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803795:	73 79                	jae    803810 <__rodata_start+0x160>
+  803797:	73 74                	jae    80380d <__rodata_start+0x15d>
+  803799:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80379b:	20 63 61             	and    %ah,0x61(%rbx)
+  80379e:	6c                   	insb   (%dx),%es:(%rdi)
+  80379f:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8037a3:	74 72                	je     803817 <__rodata_start+0x167>
+  8037a5:	79 20                	jns    8037c7 <__rodata_start+0x117>
+  8037a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037a9:	74 20                	je     8037cb <__rodata_start+0x11b>
+  8037ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037ad:	75 6e                	jne    80381d <__rodata_start+0x16d>
+  8037af:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8037b3:	76 20                	jbe    8037d5 <__rodata_start+0x125>
+  8037b5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8037bc:	72 65                	jb     803823 <__rodata_start+0x173>
+  8037be:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8037c1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037c6:	65 78 70             	gs js  803839 <__rodata_start+0x189>
+  8037c9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037ce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037d1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037d5:	20 66 69             	and    %ah,0x69(%rsi)
+  8037d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8037d9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037dd:	20 66 72             	and    %ah,0x72(%rsi)
+  8037e0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037e5:	61                   	(bad)
+  8037e6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037eb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037ef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f8:	79 20                	jns    80381a <__rodata_start+0x16a>
+  8037fa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803801:	72 65                	jb     803868 <__rodata_start+0x1b8>
+  803803:	20 6f 70             	and    %ch,0x70(%rdi)
+  803806:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803808:	00 66 69             	add    %ah,0x69(%rsi)
+  80380b:	6c                   	insb   (%dx),%es:(%rdi)
+  80380c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803810:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803813:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803814:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803817:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803818:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803819:	74 20                	je     80383b <__rodata_start+0x18b>
+  80381b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80381d:	75 6e                	jne    80388d <__rodata_start+0x1dd>
+  80381f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803823:	76 61                	jbe    803886 <__rodata_start+0x1d6>
+  803825:	6c                   	insb   (%dx),%es:(%rdi)
+  803826:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80382d:	00 
+  80382e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803835:	72 65                	jb     80389c <__rodata_start+0x1ec>
+  803837:	61                   	(bad)
+  803838:	64 79 20             	fs jns 80385b <__rodata_start+0x1ab>
+  80383b:	65 78 69             	gs js  8038a7 <__rodata_start+0x1f7>
+  80383e:	73 74                	jae    8038b4 <__rodata_start+0x204>
+  803840:	73 00                	jae    803842 <__rodata_start+0x192>
+  803842:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803843:	70 65                	jo     8038aa <__rodata_start+0x1fa>
+  803845:	72 61                	jb     8038a8 <__rodata_start+0x1f8>
+  803847:	74 69                	je     8038b2 <__rodata_start+0x202>
+  803849:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80384a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80384b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80384e:	74 20                	je     803870 <__rodata_start+0x1c0>
+  803850:	73 75                	jae    8038c7 <__rodata_start+0x217>
+  803852:	70 70                	jo     8038c4 <__rodata_start+0x214>
+  803854:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803855:	72 74                	jb     8038cb <__rodata_start+0x21b>
+  803857:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80385d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803862:	74 00                	je     803864 <__rodata_start+0x1b4>
+  803864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80386b:	00 00 00 
+  80386e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803875:	00 00 00 
+  803878:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80387f:	00 
+  803880:	cb                   	lret
+  803881:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  803887:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80388a:	80 00 00             	addb   $0x0,(%rax)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 fc                	add    %bh,%ah
+  803891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803897:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80389a:	80 00 00             	addb   $0x0,(%rax)
+  80389d:	00 00                	add    %al,(%rax)
+  80389f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038aa:	80 00 00             	addb   $0x0,(%rax)
+  8038ad:	00 00                	add    %al,(%rax)
+  8038af:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038b2:	80 00 00             	addb   $0x0,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 ea                	add    %ch,%dl
+  8038b9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038bf:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038c2:	80 00 00             	addb   $0x0,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038ca:	80 00 00             	addb   $0x0,(%rax)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 de                	add    %bl,%dh
+  8038d1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038d7:	00 58 04             	add    %bl,0x4(%rax)
+  8038da:	80 00 00             	addb   $0x0,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038e2:	80 00 00             	addb   $0x0,(%rax)
+  8038e5:	00 00                	add    %al,(%rax)
+  8038e7:	00 de                	add    %bl,%dh
+  8038e9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038ef:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  8038f2:	80 00 00             	addb   $0x0,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  8038fa:	80 00 00             	addb   $0x0,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  803902:	80 00 00             	addb   $0x0,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  80390a:	80 00 00             	addb   $0x0,(%rax)
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  803912:	80 00 00             	addb   $0x0,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  80391a:	80 00 00             	addb   $0x0,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  803922:	80 00 00             	addb   $0x0,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  80392a:	80 00 00             	addb   $0x0,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  803932:	80 00 00             	addb   $0x0,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80393a:	80 00 00             	addb   $0x0,(%rax)
+  80393d:	00 00                	add    %al,(%rax)
+  80393f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803942:	80 00 00             	addb   $0x0,(%rax)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80394a:	80 00 00             	addb   $0x0,(%rax)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803952:	80 00 00             	addb   $0x0,(%rax)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80395a:	80 00 00             	addb   $0x0,(%rax)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803962:	80 00 00             	addb   $0x0,(%rax)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80396a:	80 00 00             	addb   $0x0,(%rax)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803972:	80 00 00             	addb   $0x0,(%rax)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80397a:	80 00 00             	addb   $0x0,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803982:	80 00 00             	addb   $0x0,(%rax)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80398a:	80 00 00             	addb   $0x0,(%rax)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803992:	80 00 00             	addb   $0x0,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039a2:	80 00 00             	addb   $0x0,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039aa:	80 00 00             	addb   $0x0,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039b2:	80 00 00             	addb   $0x0,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039ba:	80 00 00             	addb   $0x0,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039c2:	80 00 00             	addb   $0x0,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039d2:	80 00 00             	addb   $0x0,(%rax)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039da:	80 00 00             	addb   $0x0,(%rax)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039e2:	80 00 00             	addb   $0x0,(%rax)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039ea:	80 00 00             	addb   $0x0,(%rax)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039f2:	80 00 00             	addb   $0x0,(%rax)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8039fa:	80 00 00             	addb   $0x0,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a02:	80 00 00             	addb   $0x0,(%rax)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a12:	80 00 00             	addb   $0x0,(%rax)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a1a:	80 00 00             	addb   $0x0,(%rax)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a22:	80 00 00             	addb   $0x0,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 2f                	add    %ch,(%rdi)
+  803a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a2f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a32:	80 00 00             	addb   $0x0,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a3a:	80 00 00             	addb   $0x0,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a42:	80 00 00             	addb   $0x0,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a4a:	80 00 00             	addb   $0x0,(%rax)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a52:	80 00 00             	addb   $0x0,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a5a:	80 00 00             	addb   $0x0,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a62:	80 00 00             	addb   $0x0,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a6a:	80 00 00             	addb   $0x0,(%rax)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 7b 04             	add    %bh,0x4(%rbx)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 4a 06             	add    %cl,0x6(%rdx)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 aa 04 80 00 00    	add    %ch,0x8004(%rdx)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803ac2:	80 00 00             	addb   $0x0,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 70 04             	add    %dh,0x4(%rax)
+  803aca:	80 00 00             	addb   $0x0,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803ada:	80 00 00             	addb   $0x0,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 f2                	add    %dh,%dl
+  803ae1:	07                   	(bad)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 bc 08 80 00 00 00 	add    %bh,0x80(%rax,%rcx,1)
+  803aee:	00 00                	add    %al,(%rax)
+  803af0:	0c 0a                	or     $0xa,%al
+  803af2:	80 00 00             	addb   $0x0,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803afa:	80 00 00             	addb   $0x0,(%rax)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 41 05             	add    %al,0x5(%rcx)
+  803b02:	80 00 00             	addb   $0x0,(%rax)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 1e                	add    %bl,(%rsi)
+  803b11:	07                   	(bad)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803b1a:	80 00 00             	addb   $0x0,(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803b22:	80 00 00             	addb   $0x0,(%rax)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 2f                	add    %ch,(%rdi)
+  803b29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b2f:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803b32:	80 00 00             	addb   $0x0,(%rax)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 d4                	add    %dl,%ah
+  803b39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803b40 <error_string>:
+	...
+  803b48:	fd 36 80 00 00 00 00 00 0f 37 80 00 00 00 00 00     .6.......7......
+  803b58:	1f 37 80 00 00 00 00 00 31 37 80 00 00 00 00 00     .7......17......
+  803b68:	3f 37 80 00 00 00 00 00 53 37 80 00 00 00 00 00     ?7......S7......
+  803b78:	68 37 80 00 00 00 00 00 7b 37 80 00 00 00 00 00     h7......{7......
+  803b88:	8d 37 80 00 00 00 00 00 a1 37 80 00 00 00 00 00     .7.......7......
+  803b98:	b1 37 80 00 00 00 00 00 c4 37 80 00 00 00 00 00     .7.......7......
+  803ba8:	db 37 80 00 00 00 00 00 f1 37 80 00 00 00 00 00     .7.......7......
+  803bb8:	09 38 80 00 00 00 00 00 21 38 80 00 00 00 00 00     .8......!8......
+  803bc8:	2e 38 80 00 00 00 00 00 e8 3b 80 00 00 00 00 00     .8.......;......
+  803bd8:	42 38 80 00 00 00 00 00 5a 38 80 00 00 00 00 00     B8......Z8......
+  803be8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803bf8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803c08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803c18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803c28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803c38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c58:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c68:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c78:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c88:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c98:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803ca8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803cb8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803cc8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cd8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ce0 <devtab>:
+  803ce0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803cf0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803d00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803d10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803d20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803d30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803d80:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803d90:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
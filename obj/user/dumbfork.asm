@@ -0,0 +1,7021 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 86 01 00 00       	call   8001a9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80002e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800033:	cd 30                	int    $0x30
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 6b                	js     8000ec <dumbfork+0xc7>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba f8 37 80 00 00 	movabs $0x8037f8,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf 08 38 80 00 00 	movabs $0x803808,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 7a 02 80 00 00 	movabs $0x80027a,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 bb 12 80 00 00 	movabs $0x8012bb,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000cb:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000cf:	48 c1 e0 04          	shl    $0x4,%rax
+  8000d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000da:	00 00 00 
+  8000dd:	48 01 d0             	add    %rdx,%rax
+  8000e0:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e7:	00 00 00 
+        return 0;
+  8000ea:	eb 95                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000ec:	89 c1                	mov    %eax,%ecx
+  8000ee:	48 ba 18 38 80 00 00 	movabs $0x803818,%rdx
+  8000f5:	00 00 00 
+  8000f8:	be 33 00 00 00       	mov    $0x33,%esi
+  8000fd:	48 bf 08 38 80 00 00 	movabs $0x803808,%rdi
+  800104:	00 00 00 
+  800107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010c:	49 b8 7a 02 80 00 00 	movabs $0x80027a,%r8
+  800113:	00 00 00 
+  800116:	41 ff d0             	call   *%r8
+
+0000000000800119 <umain>:
+umain(int argc, char **argv) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+  80011d:	41 57                	push   %r15
+  80011f:	41 56                	push   %r14
+  800121:	41 55                	push   %r13
+  800123:	41 54                	push   %r12
+  800125:	53                   	push   %rbx
+  800126:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  80012a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+  800136:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800139:	85 c0                	test   %eax,%eax
+  80013b:	49 bd 2f 38 80 00 00 	movabs $0x80382f,%r13
+  800142:	00 00 00 
+  800145:	48 b8 36 38 80 00 00 	movabs $0x803836,%rax
+  80014c:	00 00 00 
+  80014f:	4c 0f 44 e8          	cmove  %rax,%r13
+  800153:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800158:	49 bf ca 03 80 00 00 	movabs $0x8003ca,%r15
+  80015f:	00 00 00 
+        sys_yield();
+  800162:	49 be ec 12 80 00 00 	movabs $0x8012ec,%r14
+  800169:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  80016c:	eb 22                	jmp    800190 <umain+0x77>
+  80016e:	83 fb 13             	cmp    $0x13,%ebx
+  800171:	7f 27                	jg     80019a <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800173:	4c 89 ea             	mov    %r13,%rdx
+  800176:	89 de                	mov    %ebx,%esi
+  800178:	48 bf 3c 38 80 00 00 	movabs $0x80383c,%rdi
+  80017f:	00 00 00 
+  800182:	b8 00 00 00 00       	mov    $0x0,%eax
+  800187:	41 ff d7             	call   *%r15
+        sys_yield();
+  80018a:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  80018d:	83 c3 01             	add    $0x1,%ebx
+  800190:	45 85 e4             	test   %r12d,%r12d
+  800193:	74 d9                	je     80016e <umain+0x55>
+  800195:	83 fb 09             	cmp    $0x9,%ebx
+  800198:	7e d9                	jle    800173 <umain+0x5a>
+}
+  80019a:	48 83 c4 08          	add    $0x8,%rsp
+  80019e:	5b                   	pop    %rbx
+  80019f:	41 5c                	pop    %r12
+  8001a1:	41 5d                	pop    %r13
+  8001a3:	41 5e                	pop    %r14
+  8001a5:	41 5f                	pop    %r15
+  8001a7:	5d                   	pop    %rbp
+  8001a8:	c3                   	ret
+
+00000000008001a9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a9:	55                   	push   %rbp
+  8001aa:	48 89 e5             	mov    %rsp,%rbp
+  8001ad:	41 56                	push   %r14
+  8001af:	41 55                	push   %r13
+  8001b1:	41 54                	push   %r12
+  8001b3:	53                   	push   %rbx
+  8001b4:	41 89 fd             	mov    %edi,%r13d
+  8001b7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001ba:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  8001c1:	00 00 00 
+  8001c4:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  8001cb:	00 00 00 
+  8001ce:	48 39 c2             	cmp    %rax,%rdx
+  8001d1:	73 17                	jae    8001ea <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001d3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d6:	49 89 c4             	mov    %rax,%r12
+  8001d9:	48 83 c3 08          	add    $0x8,%rbx
+  8001dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e2:	ff 53 f8             	call   *-0x8(%rbx)
+  8001e5:	4c 39 e3             	cmp    %r12,%rbx
+  8001e8:	72 ef                	jb     8001d9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001ea:	48 b8 bb 12 80 00 00 	movabs $0x8012bb,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+  8001f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001fb:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001ff:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800203:	48 c1 e0 04          	shl    $0x4,%rax
+  800207:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80020e:	00 00 00 
+  800211:	48 01 d0             	add    %rdx,%rax
+  800214:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80021b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80021e:	45 85 ed             	test   %r13d,%r13d
+  800221:	7e 0d                	jle    800230 <libmain+0x87>
+  800223:	49 8b 06             	mov    (%r14),%rax
+  800226:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80022d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800230:	4c 89 f6             	mov    %r14,%rsi
+  800233:	44 89 ef             	mov    %r13d,%edi
+  800236:	48 b8 19 01 80 00 00 	movabs $0x800119,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800242:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+#endif
+}
+  80024e:	5b                   	pop    %rbx
+  80024f:	41 5c                	pop    %r12
+  800251:	41 5d                	pop    %r13
+  800253:	41 5e                	pop    %r14
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80025b:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800267:	bf 00 00 00 00       	mov    $0x0,%edi
+  80026c:	48 b8 50 12 80 00 00 	movabs $0x801250,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+}
+  800278:	5d                   	pop    %rbp
+  800279:	c3                   	ret
+
+000000000080027a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	41 56                	push   %r14
+  800280:	41 55                	push   %r13
+  800282:	41 54                	push   %r12
+  800284:	53                   	push   %rbx
+  800285:	48 83 ec 50          	sub    $0x50,%rsp
+  800289:	49 89 fc             	mov    %rdi,%r12
+  80028c:	41 89 f5             	mov    %esi,%r13d
+  80028f:	48 89 d3             	mov    %rdx,%rbx
+  800292:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800296:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80029a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80029e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002ad:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002b5:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002bc:	00 00 00 
+  8002bf:	4c 8b 30             	mov    (%rax),%r14
+  8002c2:	48 b8 bb 12 80 00 00 	movabs $0x8012bb,%rax
+  8002c9:	00 00 00 
+  8002cc:	ff d0                	call   *%rax
+  8002ce:	89 c6                	mov    %eax,%esi
+  8002d0:	45 89 e8             	mov    %r13d,%r8d
+  8002d3:	4c 89 e1             	mov    %r12,%rcx
+  8002d6:	4c 89 f2             	mov    %r14,%rdx
+  8002d9:	48 bf 58 38 80 00 00 	movabs $0x803858,%rdi
+  8002e0:	00 00 00 
+  8002e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e8:	49 bc ca 03 80 00 00 	movabs $0x8003ca,%r12
+  8002ef:	00 00 00 
+  8002f2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002f5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002f9:	48 89 df             	mov    %rbx,%rdi
+  8002fc:	48 b8 66 03 80 00 00 	movabs $0x800366,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+    cprintf("\n");
+  800308:	48 bf 4c 38 80 00 00 	movabs $0x80384c,%rdi
+  80030f:	00 00 00 
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80031a:	cc                   	int3
+  80031b:	eb fd                	jmp    80031a <_panic+0xa0>
+
+000000000080031d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80031d:	55                   	push   %rbp
+  80031e:	48 89 e5             	mov    %rsp,%rbp
+  800321:	53                   	push   %rbx
+  800322:	48 83 ec 08          	sub    $0x8,%rsp
+  800326:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800329:	8b 06                	mov    (%rsi),%eax
+  80032b:	8d 50 01             	lea    0x1(%rax),%edx
+  80032e:	89 16                	mov    %edx,(%rsi)
+  800330:	48 98                	cltq
+  800332:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800337:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80033d:	74 0a                	je     800349 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80033f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800343:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800347:	c9                   	leave
+  800348:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800349:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80034d:	be ff 00 00 00       	mov    $0xff,%esi
+  800352:	48 b8 f2 11 80 00 00 	movabs $0x8011f2,%rax
+  800359:	00 00 00 
+  80035c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80035e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800364:	eb d9                	jmp    80033f <putch+0x22>
+
+0000000000800366 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800366:	55                   	push   %rbp
+  800367:	48 89 e5             	mov    %rsp,%rbp
+  80036a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800371:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800374:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80037b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800388:	48 89 f1             	mov    %rsi,%rcx
+  80038b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800392:	48 bf 1d 03 80 00 00 	movabs $0x80031d,%rdi
+  800399:	00 00 00 
+  80039c:	48 b8 1a 05 80 00 00 	movabs $0x80051a,%rax
+  8003a3:	00 00 00 
+  8003a6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003a8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003af:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003b6:	48 b8 f2 11 80 00 00 	movabs $0x8011f2,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003c2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003c8:	c9                   	leave
+  8003c9:	c3                   	ret
+
+00000000008003ca <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003ca:	55                   	push   %rbp
+  8003cb:	48 89 e5             	mov    %rsp,%rbp
+  8003ce:	48 83 ec 50          	sub    $0x50,%rsp
+  8003d2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003d6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003de:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003e2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003e6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003f5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003fd:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800401:	48 b8 66 03 80 00 00 	movabs $0x800366,%rax
+  800408:	00 00 00 
+  80040b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80040d:	c9                   	leave
+  80040e:	c3                   	ret
+
+000000000080040f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80040f:	55                   	push   %rbp
+  800410:	48 89 e5             	mov    %rsp,%rbp
+  800413:	41 57                	push   %r15
+  800415:	41 56                	push   %r14
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 18          	sub    $0x18,%rsp
+  800420:	49 89 fc             	mov    %rdi,%r12
+  800423:	49 89 f5             	mov    %rsi,%r13
+  800426:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80042a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80042d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800430:	41 89 cf             	mov    %ecx,%r15d
+  800433:	4c 39 fa             	cmp    %r15,%rdx
+  800436:	73 5b                	jae    800493 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800438:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80043c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800440:	85 db                	test   %ebx,%ebx
+  800442:	7e 0e                	jle    800452 <print_num+0x43>
+            putch(padc, put_arg);
+  800444:	4c 89 ee             	mov    %r13,%rsi
+  800447:	44 89 f7             	mov    %r14d,%edi
+  80044a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80044d:	83 eb 01             	sub    $0x1,%ebx
+  800450:	75 f2                	jne    800444 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800452:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800456:	48 b9 8c 38 80 00 00 	movabs $0x80388c,%rcx
+  80045d:	00 00 00 
+  800460:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  800467:	00 00 00 
+  80046a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80046e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800472:	ba 00 00 00 00       	mov    $0x0,%edx
+  800477:	49 f7 f7             	div    %r15
+  80047a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80047e:	4c 89 ee             	mov    %r13,%rsi
+  800481:	41 ff d4             	call   *%r12
+}
+  800484:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800488:	5b                   	pop    %rbx
+  800489:	41 5c                	pop    %r12
+  80048b:	41 5d                	pop    %r13
+  80048d:	41 5e                	pop    %r14
+  80048f:	41 5f                	pop    %r15
+  800491:	5d                   	pop    %rbp
+  800492:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049c:	49 f7 f7             	div    %r15
+  80049f:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004a7:	52                   	push   %rdx
+  8004a8:	45 0f be c9          	movsbl %r9b,%r9d
+  8004ac:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004b0:	48 89 c2             	mov    %rax,%rdx
+  8004b3:	48 b8 0f 04 80 00 00 	movabs $0x80040f,%rax
+  8004ba:	00 00 00 
+  8004bd:	ff d0                	call   *%rax
+  8004bf:	48 83 c4 10          	add    $0x10,%rsp
+  8004c3:	eb 8d                	jmp    800452 <print_num+0x43>
+
+00000000008004c5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004c5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004c9:	48 8b 06             	mov    (%rsi),%rax
+  8004cc:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004d0:	73 0a                	jae    8004dc <sprintputch+0x17>
+        *state->start++ = ch;
+  8004d2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004d6:	48 89 16             	mov    %rdx,(%rsi)
+  8004d9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004dc:	c3                   	ret
+
+00000000008004dd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004dd:	55                   	push   %rbp
+  8004de:	48 89 e5             	mov    %rsp,%rbp
+  8004e1:	48 83 ec 50          	sub    $0x50,%rsp
+  8004e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004f1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800500:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800504:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800508:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80050c:	48 b8 1a 05 80 00 00 	movabs $0x80051a,%rax
+  800513:	00 00 00 
+  800516:	ff d0                	call   *%rax
+}
+  800518:	c9                   	leave
+  800519:	c3                   	ret
+
+000000000080051a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80051a:	55                   	push   %rbp
+  80051b:	48 89 e5             	mov    %rsp,%rbp
+  80051e:	41 57                	push   %r15
+  800520:	41 56                	push   %r14
+  800522:	41 55                	push   %r13
+  800524:	41 54                	push   %r12
+  800526:	53                   	push   %rbx
+  800527:	48 83 ec 38          	sub    $0x38,%rsp
+  80052b:	49 89 fe             	mov    %rdi,%r14
+  80052e:	49 89 f5             	mov    %rsi,%r13
+  800531:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800534:	48 8b 01             	mov    (%rcx),%rax
+  800537:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80053b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80053f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800543:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800547:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80054b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80054f:	0f b6 3b             	movzbl (%rbx),%edi
+  800552:	40 80 ff 25          	cmp    $0x25,%dil
+  800556:	74 18                	je     800570 <vprintfmt+0x56>
+            if (!ch) return;
+  800558:	40 84 ff             	test   %dil,%dil
+  80055b:	0f 84 b1 06 00 00    	je     800c12 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800561:	40 0f b6 ff          	movzbl %dil,%edi
+  800565:	4c 89 ee             	mov    %r13,%rsi
+  800568:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80056b:	4c 89 e3             	mov    %r12,%rbx
+  80056e:	eb db                	jmp    80054b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800570:	be 00 00 00 00       	mov    $0x0,%esi
+  800575:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800579:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80057e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800584:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80058b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80058f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800594:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800599:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80059c:	83 e8 23             	sub    $0x23,%eax
+  80059f:	3c 57                	cmp    $0x57,%al
+  8005a1:	0f 87 51 06 00 00    	ja     800bf8 <vprintfmt+0x6de>
+  8005a7:	0f b6 c0             	movzbl %al,%eax
+  8005aa:	48 b9 20 3a 80 00 00 	movabs $0x803a20,%rcx
+  8005b1:	00 00 00 
+  8005b4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005b7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005ba:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005be:	eb cf                	jmp    80058f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005c0:	49 89 dc             	mov    %rbx,%r12
+  8005c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8005c8:	eb c5                	jmp    80058f <vprintfmt+0x75>
+            padc = ch;
+  8005ca:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005ce:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005d1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005d4:	eb b9                	jmp    80058f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005dc:	77 24                	ja     800602 <vprintfmt+0xe8>
+  8005de:	89 c1                	mov    %eax,%ecx
+  8005e0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005e4:	83 c0 08             	add    $0x8,%eax
+  8005e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ea:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005ed:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005f0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f4:	79 99                	jns    80058f <vprintfmt+0x75>
+                width = precision;
+  8005f6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005fa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800600:	eb 8d                	jmp    80058f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800602:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800606:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80060a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060e:	eb da                	jmp    8005ea <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800610:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800615:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800619:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80061f:	3c 39                	cmp    $0x39,%al
+  800621:	77 1c                	ja     80063f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800623:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800627:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80062b:	0f b6 c0             	movzbl %al,%eax
+  80062e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800633:	0f b6 03             	movzbl (%rbx),%eax
+  800636:	3c 39                	cmp    $0x39,%al
+  800638:	76 e9                	jbe    800623 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80063a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80063d:	eb b1                	jmp    8005f0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80063f:	49 89 dc             	mov    %rbx,%r12
+  800642:	eb ac                	jmp    8005f0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800644:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800647:	85 c9                	test   %ecx,%ecx
+  800649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064e:	0f 49 c1             	cmovns %ecx,%eax
+  800651:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800654:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800657:	e9 33 ff ff ff       	jmp    80058f <vprintfmt+0x75>
+            lflag++;
+  80065c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80065f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800662:	e9 28 ff ff ff       	jmp    80058f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800667:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066a:	83 f8 2f             	cmp    $0x2f,%eax
+  80066d:	77 19                	ja     800688 <vprintfmt+0x16e>
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800675:	83 c0 08             	add    $0x8,%eax
+  800678:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067b:	8b 3a                	mov    (%rdx),%edi
+  80067d:	4c 89 ee             	mov    %r13,%rsi
+  800680:	41 ff d6             	call   *%r14
+            break;
+  800683:	e9 c3 fe ff ff       	jmp    80054b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800688:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800690:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800694:	eb e5                	jmp    80067b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800696:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800699:	83 f8 2f             	cmp    $0x2f,%eax
+  80069c:	77 5a                	ja     8006f8 <vprintfmt+0x1de>
+  80069e:	89 c2                	mov    %eax,%edx
+  8006a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a4:	83 c0 08             	add    $0x8,%eax
+  8006a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006aa:	8b 02                	mov    (%rdx),%eax
+  8006ac:	89 c1                	mov    %eax,%ecx
+  8006ae:	f7 d9                	neg    %ecx
+  8006b0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006b3:	83 f9 14             	cmp    $0x14,%ecx
+  8006b6:	7f 4e                	jg     800706 <vprintfmt+0x1ec>
+  8006b8:	48 63 c1             	movslq %ecx,%rax
+  8006bb:	48 ba e0 3c 80 00 00 	movabs $0x803ce0,%rdx
+  8006c2:	00 00 00 
+  8006c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006c9:	48 85 c0             	test   %rax,%rax
+  8006cc:	74 38                	je     800706 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006ce:	48 89 c1             	mov    %rax,%rcx
+  8006d1:	48 ba b9 3e 80 00 00 	movabs $0x803eb9,%rdx
+  8006d8:	00 00 00 
+  8006db:	4c 89 ee             	mov    %r13,%rsi
+  8006de:	4c 89 f7             	mov    %r14,%rdi
+  8006e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e6:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  8006ed:	00 00 00 
+  8006f0:	41 ff d0             	call   *%r8
+  8006f3:	e9 53 fe ff ff       	jmp    80054b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800700:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800704:	eb a4                	jmp    8006aa <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800706:	48 ba a4 38 80 00 00 	movabs $0x8038a4,%rdx
+  80070d:	00 00 00 
+  800710:	4c 89 ee             	mov    %r13,%rsi
+  800713:	4c 89 f7             	mov    %r14,%rdi
+  800716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071b:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  800722:	00 00 00 
+  800725:	41 ff d0             	call   *%r8
+  800728:	e9 1e fe ff ff       	jmp    80054b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80072d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800730:	83 f8 2f             	cmp    $0x2f,%eax
+  800733:	77 6c                	ja     8007a1 <vprintfmt+0x287>
+  800735:	89 c2                	mov    %eax,%edx
+  800737:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073b:	83 c0 08             	add    $0x8,%eax
+  80073e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800741:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800744:	48 85 d2             	test   %rdx,%rdx
+  800747:	48 b8 9d 38 80 00 00 	movabs $0x80389d,%rax
+  80074e:	00 00 00 
+  800751:	48 0f 45 c2          	cmovne %rdx,%rax
+  800755:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800759:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80075d:	7e 06                	jle    800765 <vprintfmt+0x24b>
+  80075f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800763:	75 4a                	jne    8007af <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800765:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800769:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80076d:	0f b6 00             	movzbl (%rax),%eax
+  800770:	84 c0                	test   %al,%al
+  800772:	0f 85 9a 00 00 00    	jne    800812 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800778:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80077b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	0f 8e c4 fd ff ff    	jle    80054b <vprintfmt+0x31>
+  800787:	4c 89 ee             	mov    %r13,%rsi
+  80078a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80078f:	41 ff d6             	call   *%r14
+  800792:	41 83 ec 01          	sub    $0x1,%r12d
+  800796:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80079a:	75 eb                	jne    800787 <vprintfmt+0x26d>
+  80079c:	e9 aa fd ff ff       	jmp    80054b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ad:	eb 92                	jmp    800741 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007af:	49 63 f7             	movslq %r15d,%rsi
+  8007b2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007b6:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  8007bd:	00 00 00 
+  8007c0:	ff d0                	call   *%rax
+  8007c2:	48 89 c2             	mov    %rax,%rdx
+  8007c5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007ca:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007cd:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007d0:	85 c0                	test   %eax,%eax
+  8007d2:	7e 91                	jle    800765 <vprintfmt+0x24b>
+  8007d4:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007d9:	4c 89 ee             	mov    %r13,%rsi
+  8007dc:	44 89 e7             	mov    %r12d,%edi
+  8007df:	41 ff d6             	call   *%r14
+  8007e2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007e6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007ec:	75 eb                	jne    8007d9 <vprintfmt+0x2bf>
+  8007ee:	e9 72 ff ff ff       	jmp    800765 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007f3:	0f b6 f8             	movzbl %al,%edi
+  8007f6:	4c 89 ee             	mov    %r13,%rsi
+  8007f9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007fc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800800:	49 83 c4 01          	add    $0x1,%r12
+  800804:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80080a:	84 c0                	test   %al,%al
+  80080c:	0f 84 66 ff ff ff    	je     800778 <vprintfmt+0x25e>
+  800812:	45 85 ff             	test   %r15d,%r15d
+  800815:	78 0a                	js     800821 <vprintfmt+0x307>
+  800817:	41 83 ef 01          	sub    $0x1,%r15d
+  80081b:	0f 88 57 ff ff ff    	js     800778 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800821:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800825:	74 cc                	je     8007f3 <vprintfmt+0x2d9>
+  800827:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80082a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80082f:	80 fa 5e             	cmp    $0x5e,%dl
+  800832:	77 c2                	ja     8007f6 <vprintfmt+0x2dc>
+  800834:	eb bd                	jmp    8007f3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800836:	40 84 f6             	test   %sil,%sil
+  800839:	75 26                	jne    800861 <vprintfmt+0x347>
+    switch (lflag) {
+  80083b:	85 d2                	test   %edx,%edx
+  80083d:	74 59                	je     800898 <vprintfmt+0x37e>
+  80083f:	83 fa 01             	cmp    $0x1,%edx
+  800842:	74 7b                	je     8008bf <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800844:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800847:	83 f8 2f             	cmp    $0x2f,%eax
+  80084a:	0f 87 96 00 00 00    	ja     8008e6 <vprintfmt+0x3cc>
+  800850:	89 c2                	mov    %eax,%edx
+  800852:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800856:	83 c0 08             	add    $0x8,%eax
+  800859:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085c:	4c 8b 22             	mov    (%rdx),%r12
+  80085f:	eb 17                	jmp    800878 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800861:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800864:	83 f8 2f             	cmp    $0x2f,%eax
+  800867:	77 21                	ja     80088a <vprintfmt+0x370>
+  800869:	89 c2                	mov    %eax,%edx
+  80086b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086f:	83 c0 08             	add    $0x8,%eax
+  800872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800875:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800878:	4d 85 e4             	test   %r12,%r12
+  80087b:	78 7a                	js     8008f7 <vprintfmt+0x3dd>
+            num = i;
+  80087d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800880:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800885:	e9 50 02 00 00       	jmp    800ada <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800896:	eb dd                	jmp    800875 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	77 11                	ja     8008b1 <vprintfmt+0x397>
+  8008a0:	89 c2                	mov    %eax,%edx
+  8008a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a6:	83 c0 08             	add    $0x8,%eax
+  8008a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ac:	4c 63 22             	movslq (%rdx),%r12
+  8008af:	eb c7                	jmp    800878 <vprintfmt+0x35e>
+  8008b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bd:	eb ed                	jmp    8008ac <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c5:	77 11                	ja     8008d8 <vprintfmt+0x3be>
+  8008c7:	89 c2                	mov    %eax,%edx
+  8008c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cd:	83 c0 08             	add    $0x8,%eax
+  8008d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d3:	4c 8b 22             	mov    (%rdx),%r12
+  8008d6:	eb a0                	jmp    800878 <vprintfmt+0x35e>
+  8008d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e4:	eb ed                	jmp    8008d3 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f2:	e9 65 ff ff ff       	jmp    80085c <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008f7:	4c 89 ee             	mov    %r13,%rsi
+  8008fa:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ff:	41 ff d6             	call   *%r14
+                i = -i;
+  800902:	49 f7 dc             	neg    %r12
+  800905:	e9 73 ff ff ff       	jmp    80087d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80090a:	40 84 f6             	test   %sil,%sil
+  80090d:	75 32                	jne    800941 <vprintfmt+0x427>
+    switch (lflag) {
+  80090f:	85 d2                	test   %edx,%edx
+  800911:	74 5d                	je     800970 <vprintfmt+0x456>
+  800913:	83 fa 01             	cmp    $0x1,%edx
+  800916:	0f 84 82 00 00 00    	je     80099e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	0f 87 a5 00 00 00    	ja     8009cd <vprintfmt+0x4b3>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800934:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800937:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80093c:	e9 99 01 00 00       	jmp    800ada <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	77 19                	ja     800962 <vprintfmt+0x448>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800958:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80095d:	e9 78 01 00 00       	jmp    800ada <vprintfmt+0x5c0>
+  800962:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800966:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096e:	eb e5                	jmp    800955 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800970:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800973:	83 f8 2f             	cmp    $0x2f,%eax
+  800976:	77 18                	ja     800990 <vprintfmt+0x476>
+  800978:	89 c2                	mov    %eax,%edx
+  80097a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097e:	83 c0 08             	add    $0x8,%eax
+  800981:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800984:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80098b:	e9 4a 01 00 00       	jmp    800ada <vprintfmt+0x5c0>
+  800990:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800994:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800998:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099c:	eb e6                	jmp    800984 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 19                	ja     8009bf <vprintfmt+0x4a5>
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ac:	83 c0 08             	add    $0x8,%eax
+  8009af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ba:	e9 1b 01 00 00       	jmp    800ada <vprintfmt+0x5c0>
+  8009bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cb:	eb e5                	jmp    8009b2 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	e9 56 ff ff ff       	jmp    800934 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009de:	40 84 f6             	test   %sil,%sil
+  8009e1:	75 2e                	jne    800a11 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009e3:	85 d2                	test   %edx,%edx
+  8009e5:	74 59                	je     800a40 <vprintfmt+0x526>
+  8009e7:	83 fa 01             	cmp    $0x1,%edx
+  8009ea:	74 7f                	je     800a6b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	0f 87 9f 00 00 00    	ja     800a97 <vprintfmt+0x57d>
+  8009f8:	89 c2                	mov    %eax,%edx
+  8009fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fe:	83 c0 08             	add    $0x8,%eax
+  800a01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a04:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a07:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a0c:	e9 c9 00 00 00       	jmp    800ada <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a14:	83 f8 2f             	cmp    $0x2f,%eax
+  800a17:	77 19                	ja     800a32 <vprintfmt+0x518>
+  800a19:	89 c2                	mov    %eax,%edx
+  800a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1f:	83 c0 08             	add    $0x8,%eax
+  800a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a28:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a2d:	e9 a8 00 00 00       	jmp    800ada <vprintfmt+0x5c0>
+  800a32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3e:	eb e5                	jmp    800a25 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	77 15                	ja     800a5d <vprintfmt+0x543>
+  800a48:	89 c2                	mov    %eax,%edx
+  800a4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4e:	83 c0 08             	add    $0x8,%eax
+  800a51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a54:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a56:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a5b:	eb 7d                	jmp    800ada <vprintfmt+0x5c0>
+  800a5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a69:	eb e9                	jmp    800a54 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a71:	77 16                	ja     800a89 <vprintfmt+0x56f>
+  800a73:	89 c2                	mov    %eax,%edx
+  800a75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a79:	83 c0 08             	add    $0x8,%eax
+  800a7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a82:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a87:	eb 51                	jmp    800ada <vprintfmt+0x5c0>
+  800a89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a95:	eb e8                	jmp    800a7f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa3:	e9 5c ff ff ff       	jmp    800a04 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800aa8:	4c 89 ee             	mov    %r13,%rsi
+  800aab:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ab0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ab3:	4c 89 ee             	mov    %r13,%rsi
+  800ab6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800abb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	77 47                	ja     800b0d <vprintfmt+0x5f3>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ada:	48 83 ec 08          	sub    $0x8,%rsp
+  800ade:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ae2:	0f 94 c0             	sete   %al
+  800ae5:	0f b6 c0             	movzbl %al,%eax
+  800ae8:	50                   	push   %rax
+  800ae9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aee:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800af2:	4c 89 ee             	mov    %r13,%rsi
+  800af5:	4c 89 f7             	mov    %r14,%rdi
+  800af8:	48 b8 0f 04 80 00 00 	movabs $0x80040f,%rax
+  800aff:	00 00 00 
+  800b02:	ff d0                	call   *%rax
+            break;
+  800b04:	48 83 c4 10          	add    $0x10,%rsp
+  800b08:	e9 3e fa ff ff       	jmp    80054b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b19:	eb b7                	jmp    800ad2 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1b:	40 84 f6             	test   %sil,%sil
+  800b1e:	75 2b                	jne    800b4b <vprintfmt+0x631>
+    switch (lflag) {
+  800b20:	85 d2                	test   %edx,%edx
+  800b22:	74 56                	je     800b7a <vprintfmt+0x660>
+  800b24:	83 fa 01             	cmp    $0x1,%edx
+  800b27:	74 7f                	je     800ba8 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	0f 87 a2 00 00 00    	ja     800bd7 <vprintfmt+0x6bd>
+  800b35:	89 c2                	mov    %eax,%edx
+  800b37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3b:	83 c0 08             	add    $0x8,%eax
+  800b3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b44:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b49:	eb 8f                	jmp    800ada <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b51:	77 19                	ja     800b6c <vprintfmt+0x652>
+  800b53:	89 c2                	mov    %eax,%edx
+  800b55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b59:	83 c0 08             	add    $0x8,%eax
+  800b5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b62:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b67:	e9 6e ff ff ff       	jmp    800ada <vprintfmt+0x5c0>
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb e5                	jmp    800b5f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b80:	77 18                	ja     800b9a <vprintfmt+0x680>
+  800b82:	89 c2                	mov    %eax,%edx
+  800b84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b88:	83 c0 08             	add    $0x8,%eax
+  800b8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b90:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b95:	e9 40 ff ff ff       	jmp    800ada <vprintfmt+0x5c0>
+  800b9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba6:	eb e6                	jmp    800b8e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ba8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bab:	83 f8 2f             	cmp    $0x2f,%eax
+  800bae:	77 19                	ja     800bc9 <vprintfmt+0x6af>
+  800bb0:	89 c2                	mov    %eax,%edx
+  800bb2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb6:	83 c0 08             	add    $0x8,%eax
+  800bb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bbf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc4:	e9 11 ff ff ff       	jmp    800ada <vprintfmt+0x5c0>
+  800bc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd5:	eb e5                	jmp    800bbc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be3:	e9 59 ff ff ff       	jmp    800b41 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800be8:	4c 89 ee             	mov    %r13,%rsi
+  800beb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bf0:	41 ff d6             	call   *%r14
+            break;
+  800bf3:	e9 53 f9 ff ff       	jmp    80054b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bf8:	4c 89 ee             	mov    %r13,%rsi
+  800bfb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c00:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c03:	48 83 eb 01          	sub    $0x1,%rbx
+  800c07:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c0b:	75 f6                	jne    800c03 <vprintfmt+0x6e9>
+  800c0d:	e9 39 f9 ff ff       	jmp    80054b <vprintfmt+0x31>
+}
+  800c12:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c16:	5b                   	pop    %rbx
+  800c17:	41 5c                	pop    %r12
+  800c19:	41 5d                	pop    %r13
+  800c1b:	41 5e                	pop    %r14
+  800c1d:	41 5f                	pop    %r15
+  800c1f:	5d                   	pop    %rbp
+  800c20:	c3                   	ret
+
+0000000000800c21 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c21:	55                   	push   %rbp
+  800c22:	48 89 e5             	mov    %rsp,%rbp
+  800c25:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c2d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c36:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c3d:	48 85 ff             	test   %rdi,%rdi
+  800c40:	74 2b                	je     800c6d <vsnprintf+0x4c>
+  800c42:	48 85 f6             	test   %rsi,%rsi
+  800c45:	74 26                	je     800c6d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c47:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c4b:	48 bf c5 04 80 00 00 	movabs $0x8004c5,%rdi
+  800c52:	00 00 00 
+  800c55:	48 b8 1a 05 80 00 00 	movabs $0x80051a,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c65:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c68:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c6b:	c9                   	leave
+  800c6c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c72:	eb f7                	jmp    800c6b <vsnprintf+0x4a>
+
+0000000000800c74 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c74:	55                   	push   %rbp
+  800c75:	48 89 e5             	mov    %rsp,%rbp
+  800c78:	48 83 ec 50          	sub    $0x50,%rsp
+  800c7c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c80:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c84:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c88:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c8f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c97:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c9b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c9f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ca3:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  800caa:	00 00 00 
+  800cad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800caf:	c9                   	leave
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cb1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cb4:	74 10                	je     800cc6 <strlen+0x15>
+    size_t n = 0;
+  800cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cbb:	48 83 c0 01          	add    $0x1,%rax
+  800cbf:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cc3:	75 f6                	jne    800cbb <strlen+0xa>
+  800cc5:	c3                   	ret
+    size_t n = 0;
+  800cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ccb:	c3                   	ret
+
+0000000000800ccc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ccc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cd4:	48 85 f6             	test   %rsi,%rsi
+  800cd7:	74 11                	je     800cea <strnlen+0x1e>
+  800cd9:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cdd:	74 0c                	je     800ceb <strnlen+0x1f>
+  800cdf:	48 83 c2 01          	add    $0x1,%rdx
+  800ce3:	48 39 d0             	cmp    %rdx,%rax
+  800ce6:	75 f1                	jne    800cd9 <strnlen+0xd>
+  800ce8:	eb 04                	jmp    800cee <strnlen+0x22>
+  800cea:	c3                   	ret
+  800ceb:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cee:	c3                   	ret
+
+0000000000800cef <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cef:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cfb:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cfe:	48 83 c2 01          	add    $0x1,%rdx
+  800d02:	84 c9                	test   %cl,%cl
+  800d04:	75 f1                	jne    800cf7 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d06:	c3                   	ret
+
+0000000000800d07 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d07:	55                   	push   %rbp
+  800d08:	48 89 e5             	mov    %rsp,%rbp
+  800d0b:	41 54                	push   %r12
+  800d0d:	53                   	push   %rbx
+  800d0e:	48 89 fb             	mov    %rdi,%rbx
+  800d11:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d14:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  800d1b:	00 00 00 
+  800d1e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d20:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d24:	4c 89 e6             	mov    %r12,%rsi
+  800d27:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d2e:	00 00 00 
+  800d31:	ff d0                	call   *%rax
+    return dst;
+}
+  800d33:	48 89 d8             	mov    %rbx,%rax
+  800d36:	5b                   	pop    %rbx
+  800d37:	41 5c                	pop    %r12
+  800d39:	5d                   	pop    %rbp
+  800d3a:	c3                   	ret
+
+0000000000800d3b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d3b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d3e:	48 85 d2             	test   %rdx,%rdx
+  800d41:	74 1f                	je     800d62 <strncpy+0x27>
+  800d43:	48 01 fa             	add    %rdi,%rdx
+  800d46:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d49:	48 83 c1 01          	add    $0x1,%rcx
+  800d4d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d51:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d55:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d59:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d5d:	48 39 ca             	cmp    %rcx,%rdx
+  800d60:	75 e7                	jne    800d49 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d62:	c3                   	ret
+
+0000000000800d63 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d63:	48 89 f8             	mov    %rdi,%rax
+  800d66:	48 85 d2             	test   %rdx,%rdx
+  800d69:	74 24                	je     800d8f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d6b:	48 83 ea 01          	sub    $0x1,%rdx
+  800d6f:	74 1b                	je     800d8c <strlcpy+0x29>
+  800d71:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d75:	0f b6 16             	movzbl (%rsi),%edx
+  800d78:	84 d2                	test   %dl,%dl
+  800d7a:	74 10                	je     800d8c <strlcpy+0x29>
+            *dst++ = *src++;
+  800d7c:	48 83 c6 01          	add    $0x1,%rsi
+  800d80:	48 83 c0 01          	add    $0x1,%rax
+  800d84:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d87:	48 39 c8             	cmp    %rcx,%rax
+  800d8a:	75 e9                	jne    800d75 <strlcpy+0x12>
+        *dst = '\0';
+  800d8c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d8f:	48 29 f8             	sub    %rdi,%rax
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d93:	0f b6 07             	movzbl (%rdi),%eax
+  800d96:	84 c0                	test   %al,%al
+  800d98:	74 13                	je     800dad <strcmp+0x1a>
+  800d9a:	38 06                	cmp    %al,(%rsi)
+  800d9c:	75 0f                	jne    800dad <strcmp+0x1a>
+  800d9e:	48 83 c7 01          	add    $0x1,%rdi
+  800da2:	48 83 c6 01          	add    $0x1,%rsi
+  800da6:	0f b6 07             	movzbl (%rdi),%eax
+  800da9:	84 c0                	test   %al,%al
+  800dab:	75 ed                	jne    800d9a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dad:	0f b6 c0             	movzbl %al,%eax
+  800db0:	0f b6 16             	movzbl (%rsi),%edx
+  800db3:	29 d0                	sub    %edx,%eax
+}
+  800db5:	c3                   	ret
+
+0000000000800db6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800db6:	48 85 d2             	test   %rdx,%rdx
+  800db9:	74 1f                	je     800dda <strncmp+0x24>
+  800dbb:	0f b6 07             	movzbl (%rdi),%eax
+  800dbe:	84 c0                	test   %al,%al
+  800dc0:	74 1e                	je     800de0 <strncmp+0x2a>
+  800dc2:	3a 06                	cmp    (%rsi),%al
+  800dc4:	75 1a                	jne    800de0 <strncmp+0x2a>
+  800dc6:	48 83 c7 01          	add    $0x1,%rdi
+  800dca:	48 83 c6 01          	add    $0x1,%rsi
+  800dce:	48 83 ea 01          	sub    $0x1,%rdx
+  800dd2:	75 e7                	jne    800dbb <strncmp+0x5>
+
+    if (!n) return 0;
+  800dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd9:	c3                   	ret
+  800dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddf:	c3                   	ret
+  800de0:	48 85 d2             	test   %rdx,%rdx
+  800de3:	74 09                	je     800dee <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800de5:	0f b6 07             	movzbl (%rdi),%eax
+  800de8:	0f b6 16             	movzbl (%rsi),%edx
+  800deb:	29 d0                	sub    %edx,%eax
+  800ded:	c3                   	ret
+    if (!n) return 0;
+  800dee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df3:	c3                   	ret
+
+0000000000800df4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800df4:	0f b6 17             	movzbl (%rdi),%edx
+  800df7:	84 d2                	test   %dl,%dl
+  800df9:	74 18                	je     800e13 <strchr+0x1f>
+        if (*str == c) {
+  800dfb:	0f be d2             	movsbl %dl,%edx
+  800dfe:	39 f2                	cmp    %esi,%edx
+  800e00:	74 17                	je     800e19 <strchr+0x25>
+    for (; *str; str++) {
+  800e02:	48 83 c7 01          	add    $0x1,%rdi
+  800e06:	0f b6 17             	movzbl (%rdi),%edx
+  800e09:	84 d2                	test   %dl,%dl
+  800e0b:	75 ee                	jne    800dfb <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e12:	c3                   	ret
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e18:	c3                   	ret
+  800e19:	48 89 f8             	mov    %rdi,%rax
+}
+  800e1c:	c3                   	ret
+
+0000000000800e1d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e1d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e20:	0f b6 17             	movzbl (%rdi),%edx
+  800e23:	84 d2                	test   %dl,%dl
+  800e25:	74 13                	je     800e3a <strfind+0x1d>
+  800e27:	0f be d2             	movsbl %dl,%edx
+  800e2a:	39 f2                	cmp    %esi,%edx
+  800e2c:	74 0b                	je     800e39 <strfind+0x1c>
+  800e2e:	48 83 c0 01          	add    $0x1,%rax
+  800e32:	0f b6 10             	movzbl (%rax),%edx
+  800e35:	84 d2                	test   %dl,%dl
+  800e37:	75 ee                	jne    800e27 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e39:	c3                   	ret
+  800e3a:	c3                   	ret
+
+0000000000800e3b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e3b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e3e:	48 89 f8             	mov    %rdi,%rax
+  800e41:	48 f7 d8             	neg    %rax
+  800e44:	83 e0 07             	and    $0x7,%eax
+  800e47:	49 89 d1             	mov    %rdx,%r9
+  800e4a:	49 29 c1             	sub    %rax,%r9
+  800e4d:	78 36                	js     800e85 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e4f:	40 0f b6 c6          	movzbl %sil,%eax
+  800e53:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e5a:	01 01 01 
+  800e5d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e61:	40 f6 c7 07          	test   $0x7,%dil
+  800e65:	75 38                	jne    800e9f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e67:	4c 89 c9             	mov    %r9,%rcx
+  800e6a:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e6e:	74 0c                	je     800e7c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e70:	fc                   	cld
+  800e71:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e74:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e78:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e7c:	4d 85 c9             	test   %r9,%r9
+  800e7f:	75 45                	jne    800ec6 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e81:	4c 89 c0             	mov    %r8,%rax
+  800e84:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e85:	48 85 d2             	test   %rdx,%rdx
+  800e88:	74 f7                	je     800e81 <memset+0x46>
+  800e8a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e8d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e90:	48 83 c0 01          	add    $0x1,%rax
+  800e94:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e98:	48 39 c2             	cmp    %rax,%rdx
+  800e9b:	75 f3                	jne    800e90 <memset+0x55>
+  800e9d:	eb e2                	jmp    800e81 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e9f:	40 f6 c7 01          	test   $0x1,%dil
+  800ea3:	74 06                	je     800eab <memset+0x70>
+  800ea5:	88 07                	mov    %al,(%rdi)
+  800ea7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eab:	40 f6 c7 02          	test   $0x2,%dil
+  800eaf:	74 07                	je     800eb8 <memset+0x7d>
+  800eb1:	66 89 07             	mov    %ax,(%rdi)
+  800eb4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eb8:	40 f6 c7 04          	test   $0x4,%dil
+  800ebc:	74 a9                	je     800e67 <memset+0x2c>
+  800ebe:	89 07                	mov    %eax,(%rdi)
+  800ec0:	48 83 c7 04          	add    $0x4,%rdi
+  800ec4:	eb a1                	jmp    800e67 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ec6:	41 f6 c1 04          	test   $0x4,%r9b
+  800eca:	74 06                	je     800ed2 <memset+0x97>
+  800ecc:	89 07                	mov    %eax,(%rdi)
+  800ece:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ed2:	41 f6 c1 02          	test   $0x2,%r9b
+  800ed6:	74 07                	je     800edf <memset+0xa4>
+  800ed8:	66 89 07             	mov    %ax,(%rdi)
+  800edb:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800edf:	41 f6 c1 01          	test   $0x1,%r9b
+  800ee3:	74 9c                	je     800e81 <memset+0x46>
+  800ee5:	88 07                	mov    %al,(%rdi)
+  800ee7:	eb 98                	jmp    800e81 <memset+0x46>
+
+0000000000800ee9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ee9:	48 89 f8             	mov    %rdi,%rax
+  800eec:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800eef:	48 39 fe             	cmp    %rdi,%rsi
+  800ef2:	73 3b                	jae    800f2f <memmove+0x46>
+  800ef4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ef8:	48 39 d7             	cmp    %rdx,%rdi
+  800efb:	73 32                	jae    800f2f <memmove+0x46>
+        s += n;
+        d += n;
+  800efd:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f01:	48 89 d6             	mov    %rdx,%rsi
+  800f04:	48 09 fe             	or     %rdi,%rsi
+  800f07:	48 09 ce             	or     %rcx,%rsi
+  800f0a:	40 f6 c6 07          	test   $0x7,%sil
+  800f0e:	75 12                	jne    800f22 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f10:	48 83 ef 08          	sub    $0x8,%rdi
+  800f14:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f18:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f1c:	fd                   	std
+  800f1d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f20:	fc                   	cld
+  800f21:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f22:	48 83 ef 01          	sub    $0x1,%rdi
+  800f26:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f2a:	fd                   	std
+  800f2b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f2d:	eb f1                	jmp    800f20 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f2f:	48 89 f2             	mov    %rsi,%rdx
+  800f32:	48 09 c2             	or     %rax,%rdx
+  800f35:	48 09 ca             	or     %rcx,%rdx
+  800f38:	f6 c2 07             	test   $0x7,%dl
+  800f3b:	75 0c                	jne    800f49 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f3d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f41:	48 89 c7             	mov    %rax,%rdi
+  800f44:	fc                   	cld
+  800f45:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f48:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f49:	48 89 c7             	mov    %rax,%rdi
+  800f4c:	fc                   	cld
+  800f4d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f4f:	c3                   	ret
+
+0000000000800f50 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f50:	55                   	push   %rbp
+  800f51:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f54:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  800f5b:	00 00 00 
+  800f5e:	ff d0                	call   *%rax
+}
+  800f60:	5d                   	pop    %rbp
+  800f61:	c3                   	ret
+
+0000000000800f62 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f62:	55                   	push   %rbp
+  800f63:	48 89 e5             	mov    %rsp,%rbp
+  800f66:	41 57                	push   %r15
+  800f68:	41 56                	push   %r14
+  800f6a:	41 55                	push   %r13
+  800f6c:	41 54                	push   %r12
+  800f6e:	53                   	push   %rbx
+  800f6f:	48 83 ec 08          	sub    $0x8,%rsp
+  800f73:	49 89 fe             	mov    %rdi,%r14
+  800f76:	49 89 f7             	mov    %rsi,%r15
+  800f79:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f7c:	48 89 f7             	mov    %rsi,%rdi
+  800f7f:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  800f86:	00 00 00 
+  800f89:	ff d0                	call   *%rax
+  800f8b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f8e:	48 89 de             	mov    %rbx,%rsi
+  800f91:	4c 89 f7             	mov    %r14,%rdi
+  800f94:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  800f9b:	00 00 00 
+  800f9e:	ff d0                	call   *%rax
+  800fa0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fa3:	48 39 c3             	cmp    %rax,%rbx
+  800fa6:	74 36                	je     800fde <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fa8:	48 89 d8             	mov    %rbx,%rax
+  800fab:	4c 29 e8             	sub    %r13,%rax
+  800fae:	49 39 c4             	cmp    %rax,%r12
+  800fb1:	73 31                	jae    800fe4 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fb3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fb8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fbc:	4c 89 fe             	mov    %r15,%rsi
+  800fbf:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fcb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fcf:	48 83 c4 08          	add    $0x8,%rsp
+  800fd3:	5b                   	pop    %rbx
+  800fd4:	41 5c                	pop    %r12
+  800fd6:	41 5d                	pop    %r13
+  800fd8:	41 5e                	pop    %r14
+  800fda:	41 5f                	pop    %r15
+  800fdc:	5d                   	pop    %rbp
+  800fdd:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fde:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fe2:	eb eb                	jmp    800fcf <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fe4:	48 83 eb 01          	sub    $0x1,%rbx
+  800fe8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fec:	48 89 da             	mov    %rbx,%rdx
+  800fef:	4c 89 fe             	mov    %r15,%rsi
+  800ff2:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  800ff9:	00 00 00 
+  800ffc:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ffe:	49 01 de             	add    %rbx,%r14
+  801001:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801006:	eb c3                	jmp    800fcb <strlcat+0x69>
+
+0000000000801008 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801008:	48 85 d2             	test   %rdx,%rdx
+  80100b:	74 2d                	je     80103a <memcmp+0x32>
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801012:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801016:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80101b:	44 38 c1             	cmp    %r8b,%cl
+  80101e:	75 0f                	jne    80102f <memcmp+0x27>
+    while (n-- > 0) {
+  801020:	48 83 c0 01          	add    $0x1,%rax
+  801024:	48 39 c2             	cmp    %rax,%rdx
+  801027:	75 e9                	jne    801012 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80102e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80102f:	0f b6 c1             	movzbl %cl,%eax
+  801032:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801036:	44 29 c0             	sub    %r8d,%eax
+  801039:	c3                   	ret
+    return 0;
+  80103a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80103f:	c3                   	ret
+
+0000000000801040 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801040:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801044:	48 39 c7             	cmp    %rax,%rdi
+  801047:	73 0f                	jae    801058 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801049:	40 38 37             	cmp    %sil,(%rdi)
+  80104c:	74 0e                	je     80105c <memfind+0x1c>
+    for (; src < end; src++) {
+  80104e:	48 83 c7 01          	add    $0x1,%rdi
+  801052:	48 39 f8             	cmp    %rdi,%rax
+  801055:	75 f2                	jne    801049 <memfind+0x9>
+  801057:	c3                   	ret
+  801058:	48 89 f8             	mov    %rdi,%rax
+  80105b:	c3                   	ret
+  80105c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80105f:	c3                   	ret
+
+0000000000801060 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801060:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801063:	0f b6 37             	movzbl (%rdi),%esi
+  801066:	40 80 fe 20          	cmp    $0x20,%sil
+  80106a:	74 06                	je     801072 <strtol+0x12>
+  80106c:	40 80 fe 09          	cmp    $0x9,%sil
+  801070:	75 13                	jne    801085 <strtol+0x25>
+  801072:	48 83 c7 01          	add    $0x1,%rdi
+  801076:	0f b6 37             	movzbl (%rdi),%esi
+  801079:	40 80 fe 20          	cmp    $0x20,%sil
+  80107d:	74 f3                	je     801072 <strtol+0x12>
+  80107f:	40 80 fe 09          	cmp    $0x9,%sil
+  801083:	74 ed                	je     801072 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801085:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801088:	83 e0 fd             	and    $0xfffffffd,%eax
+  80108b:	3c 01                	cmp    $0x1,%al
+  80108d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801091:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801097:	75 0f                	jne    8010a8 <strtol+0x48>
+  801099:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80109c:	74 14                	je     8010b2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80109e:	85 d2                	test   %edx,%edx
+  8010a0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010a5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010ad:	4c 63 ca             	movslq %edx,%r9
+  8010b0:	eb 36                	jmp    8010e8 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010b2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010b6:	74 0f                	je     8010c7 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010b8:	85 d2                	test   %edx,%edx
+  8010ba:	75 ec                	jne    8010a8 <strtol+0x48>
+        s++;
+  8010bc:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010c0:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010c5:	eb e1                	jmp    8010a8 <strtol+0x48>
+        s += 2;
+  8010c7:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010cb:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010d0:	eb d6                	jmp    8010a8 <strtol+0x48>
+            dig -= '0';
+  8010d2:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010d5:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010d9:	41 39 d0             	cmp    %edx,%r8d
+  8010dc:	7d 21                	jge    8010ff <strtol+0x9f>
+        val = val * base + dig;
+  8010de:	49 0f af c1          	imul   %r9,%rax
+  8010e2:	0f b6 c9             	movzbl %cl,%ecx
+  8010e5:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010e8:	48 83 c7 01          	add    $0x1,%rdi
+  8010ec:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010f0:	80 f9 39             	cmp    $0x39,%cl
+  8010f3:	76 dd                	jbe    8010d2 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010f5:	80 f9 7b             	cmp    $0x7b,%cl
+  8010f8:	77 05                	ja     8010ff <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010fa:	83 e9 57             	sub    $0x57,%ecx
+  8010fd:	eb d6                	jmp    8010d5 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ff:	4d 85 d2             	test   %r10,%r10
+  801102:	74 03                	je     801107 <strtol+0xa7>
+  801104:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801107:	48 89 c2             	mov    %rax,%rdx
+  80110a:	48 f7 da             	neg    %rdx
+  80110d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801111:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801115:	c3                   	ret
+
+0000000000801116 <strrev>:
+
+void
+strrev(char *str)
+{
+  801116:	55                   	push   %rbp
+  801117:	48 89 e5             	mov    %rsp,%rbp
+  80111a:	53                   	push   %rbx
+  80111b:	48 83 ec 08          	sub    $0x8,%rsp
+  80111f:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801122:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  801129:	00 00 00 
+  80112c:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80112e:	83 e8 01             	sub    $0x1,%eax
+  801131:	85 c0                	test   %eax,%eax
+  801133:	7e 22                	jle    801157 <strrev+0x41>
+  801135:	48 98                	cltq
+  801137:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80113c:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801140:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801144:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801148:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80114b:	48 83 c2 01          	add    $0x1,%rdx
+  80114f:	48 83 e8 01          	sub    $0x1,%rax
+  801153:	39 c2                	cmp    %eax,%edx
+  801155:	7c e5                	jl     80113c <strrev+0x26>
+	}
+}
+  801157:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115b:	c9                   	leave
+  80115c:	c3                   	ret
+
+000000000080115d <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80115d:	85 d2                	test   %edx,%edx
+  80115f:	0f 84 80 00 00 00    	je     8011e5 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	53                   	push   %rbx
+  80116a:	48 83 ec 08          	sub    $0x8,%rsp
+  80116e:	49 89 f2             	mov    %rsi,%r10
+  801171:	41 89 d3             	mov    %edx,%r11d
+  801174:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801177:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80117c:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80117f:	eb 20                	jmp    8011a1 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801181:	41 89 f1             	mov    %esi,%r9d
+  801184:	83 c2 30             	add    $0x30,%edx
+  801187:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	99                   	cltd
+  80118d:	f7 f9                	idiv   %ecx
+  80118f:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801191:	85 c0                	test   %eax,%eax
+  801193:	74 2e                	je     8011c3 <itoa+0x66>
+  801195:	83 c6 01             	add    $0x1,%esi
+  801198:	49 83 c0 01          	add    $0x1,%r8
+  80119c:	44 39 cb             	cmp    %r9d,%ebx
+  80119f:	7e 15                	jle    8011b6 <itoa+0x59>
+		digit = sum % base;
+  8011a1:	89 f8                	mov    %edi,%eax
+  8011a3:	99                   	cltd
+  8011a4:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8011a6:	83 fa 09             	cmp    $0x9,%edx
+  8011a9:	7e d6                	jle    801181 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8011ab:	41 89 f1             	mov    %esi,%r9d
+  8011ae:	83 c2 37             	add    $0x37,%edx
+  8011b1:	41 88 10             	mov    %dl,(%r8)
+  8011b4:	eb d4                	jmp    80118a <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8011b6:	41 83 eb 01          	sub    $0x1,%r11d
+  8011ba:	45 39 cb             	cmp    %r9d,%r11d
+  8011bd:	75 04                	jne    8011c3 <itoa+0x66>
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	75 28                	jne    8011eb <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8011c3:	4d 63 c9             	movslq %r9d,%r9
+  8011c6:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8011cb:	4c 89 d7             	mov    %r10,%rdi
+  8011ce:	48 b8 16 11 80 00 00 	movabs $0x801116,%rax
+  8011d5:	00 00 00 
+  8011d8:	ff d0                	call   *%rax
+	return 0;
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e3:	c9                   	leave
+  8011e4:	c3                   	ret
+		return -1;
+  8011e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8011ea:	c3                   	ret
+		return -1;
+  8011eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8011f0:	eb ed                	jmp    8011df <itoa+0x82>
+
+00000000008011f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011f2:	55                   	push   %rbp
+  8011f3:	48 89 e5             	mov    %rsp,%rbp
+  8011f6:	53                   	push   %rbx
+  8011f7:	48 89 fa             	mov    %rdi,%rdx
+  8011fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801207:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120c:	be 00 00 00 00       	mov    $0x0,%esi
+  801211:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801217:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+
+000000000080121f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80121f:	55                   	push   %rbp
+  801220:	48 89 e5             	mov    %rsp,%rbp
+  801223:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801224:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801259:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801261:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801270:	be 00 00 00 00       	mov    $0x0,%esi
+  801275:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80127d:	48 85 c0             	test   %rax,%rax
+  801280:	7f 06                	jg     801288 <sys_env_destroy+0x38>
+}
+  801282:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801286:	c9                   	leave
+  801287:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801288:	49 89 c0             	mov    %rax,%r8
+  80128b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801290:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  801297:	00 00 00 
+  80129a:	be 26 00 00 00       	mov    $0x26,%esi
+  80129f:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  8012a6:	00 00 00 
+  8012a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ae:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  8012b5:	00 00 00 
+  8012b8:	41 ff d1             	call   *%r9
+
+00000000008012bb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012bb:	55                   	push   %rbp
+  8012bc:	48 89 e5             	mov    %rsp,%rbp
+  8012bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ea:	c9                   	leave
+  8012eb:	c3                   	ret
+
+00000000008012ec <sys_yield>:
+
+void
+sys_yield(void) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+  8012f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801305:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+  80130f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801315:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+
+000000000080131d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	53                   	push   %rbx
+  801322:	48 89 fa             	mov    %rdi,%rdx
+  801325:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801334:	00 00 00 
+  801337:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133c:	be 00 00 00 00       	mov    $0x0,%esi
+  801341:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801347:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+
+000000000080134f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+  801353:	53                   	push   %rbx
+  801354:	49 89 f8             	mov    %rdi,%r8
+  801357:	48 89 d3             	mov    %rdx,%rbx
+  80135a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80135d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801362:	4c 89 c2             	mov    %r8,%rdx
+  801365:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801368:	be 00 00 00 00       	mov    $0x0,%esi
+  80136d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801373:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801375:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801379:	c9                   	leave
+  80137a:	c3                   	ret
+
+000000000080137b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80137b:	55                   	push   %rbp
+  80137c:	48 89 e5             	mov    %rsp,%rbp
+  80137f:	53                   	push   %rbx
+  801380:	48 83 ec 08          	sub    $0x8,%rsp
+  801384:	89 f8                	mov    %edi,%eax
+  801386:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801389:	48 63 f9             	movslq %ecx,%rdi
+  80138c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801394:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801397:	be 00 00 00 00       	mov    $0x0,%esi
+  80139c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a4:	48 85 c0             	test   %rax,%rax
+  8013a7:	7f 06                	jg     8013af <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ad:	c9                   	leave
+  8013ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013af:	49 89 c0             	mov    %rax,%r8
+  8013b2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013b7:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  8013be:	00 00 00 
+  8013c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c6:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  8013cd:	00 00 00 
+  8013d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d5:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  8013dc:	00 00 00 
+  8013df:	41 ff d1             	call   *%r9
+
+00000000008013e2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+  8013e6:	53                   	push   %rbx
+  8013e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013eb:	89 f8                	mov    %edi,%eax
+  8013ed:	49 89 f2             	mov    %rsi,%r10
+  8013f0:	48 89 cf             	mov    %rcx,%rdi
+  8013f3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013f6:	48 63 da             	movslq %edx,%rbx
+  8013f9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801401:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801404:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801407:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801409:	48 85 c0             	test   %rax,%rax
+  80140c:	7f 06                	jg     801414 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80140e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801414:	49 89 c0             	mov    %rax,%r8
+  801417:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80141c:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  801423:	00 00 00 
+  801426:	be 26 00 00 00       	mov    $0x26,%esi
+  80142b:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  801432:	00 00 00 
+  801435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143a:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  801441:	00 00 00 
+  801444:	41 ff d1             	call   *%r9
+
+0000000000801447 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801447:	55                   	push   %rbp
+  801448:	48 89 e5             	mov    %rsp,%rbp
+  80144b:	53                   	push   %rbx
+  80144c:	48 83 ec 08          	sub    $0x8,%rsp
+  801450:	48 89 f1             	mov    %rsi,%rcx
+  801453:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801456:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801459:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801463:	be 00 00 00 00       	mov    $0x0,%esi
+  801468:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801470:	48 85 c0             	test   %rax,%rax
+  801473:	7f 06                	jg     80147b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801475:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801479:	c9                   	leave
+  80147a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147b:	49 89 c0             	mov    %rax,%r8
+  80147e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801483:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  80148a:	00 00 00 
+  80148d:	be 26 00 00 00       	mov    $0x26,%esi
+  801492:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  801499:	00 00 00 
+  80149c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a1:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  8014a8:	00 00 00 
+  8014ab:	41 ff d1             	call   *%r9
+
+00000000008014ae <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014ae:	55                   	push   %rbp
+  8014af:	48 89 e5             	mov    %rsp,%rbp
+  8014b2:	53                   	push   %rbx
+  8014b3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014b7:	48 63 ce             	movslq %esi,%rcx
+  8014ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bd:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d9:	48 85 c0             	test   %rax,%rax
+  8014dc:	7f 06                	jg     8014e4 <sys_env_set_status+0x36>
+}
+  8014de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e4:	49 89 c0             	mov    %rax,%r8
+  8014e7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014ec:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  8014f3:	00 00 00 
+  8014f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fb:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  801502:	00 00 00 
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150a:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  801511:	00 00 00 
+  801514:	41 ff d1             	call   *%r9
+
+0000000000801517 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	53                   	push   %rbx
+  80151c:	48 83 ec 08          	sub    $0x8,%rsp
+  801520:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801523:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801540:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 06                	jg     80154d <sys_env_set_trapframe+0x36>
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801555:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  80155c:	00 00 00 
+  80155f:	be 26 00 00 00       	mov    $0x26,%esi
+  801564:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+  801589:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80158c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159e:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ab:	48 85 c0             	test   %rax,%rax
+  8015ae:	7f 06                	jg     8015b6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b4:	c9                   	leave
+  8015b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b6:	49 89 c0             	mov    %rax,%r8
+  8015b9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015be:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  8015c5:	00 00 00 
+  8015c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015cd:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  8015d4:	00 00 00 
+  8015d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dc:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  8015e3:	00 00 00 
+  8015e6:	41 ff d1             	call   *%r9
+
+00000000008015e9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	53                   	push   %rbx
+  8015ee:	89 f8                	mov    %edi,%eax
+  8015f0:	49 89 f1             	mov    %rsi,%r9
+  8015f3:	48 89 d3             	mov    %rdx,%rbx
+  8015f6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015f9:	49 63 f0             	movslq %r8d,%rsi
+  8015fc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801604:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+}
+  80160f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+
+0000000000801615 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801615:	55                   	push   %rbp
+  801616:	48 89 e5             	mov    %rsp,%rbp
+  801619:	53                   	push   %rbx
+  80161a:	48 83 ec 08          	sub    $0x8,%rsp
+  80161e:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801621:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801624:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801629:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80163e:	48 85 c0             	test   %rax,%rax
+  801641:	7f 06                	jg     801649 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801643:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801649:	49 89 c0             	mov    %rax,%r8
+  80164c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801651:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  801658:	00 00 00 
+  80165b:	be 26 00 00 00       	mov    $0x26,%esi
+  801660:	48 bf c7 3d 80 00 00 	movabs $0x803dc7,%rdi
+  801667:	00 00 00 
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	49 b9 7a 02 80 00 00 	movabs $0x80027a,%r9
+  801676:	00 00 00 
+  801679:	41 ff d1             	call   *%r9
+
+000000000080167c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801680:	ba 00 00 00 00       	mov    $0x0,%edx
+  801685:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80168c:	00 00 00 
+  80168f:	ff d0                	call   *%rax
+}
+  801691:	5d                   	pop    %rbp
+  801692:	c3                   	ret
+
+0000000000801693 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801693:	55                   	push   %rbp
+  801694:	48 89 e5             	mov    %rsp,%rbp
+  801697:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801698:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bc:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c2:	c9                   	leave
+  8016c3:	c3                   	ret
+
+00000000008016c4 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8016c4:	55                   	push   %rbp
+  8016c5:	48 89 e5             	mov    %rsp,%rbp
+  8016c8:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8016c9:	48 63 ce             	movslq %esi,%rcx
+  8016cc:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016df:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ea:	cd 30                	int    $0x30
+}
+  8016ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f0:	c9                   	leave
+  8016f1:	c3                   	ret
+
+00000000008016f2 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8016f2:	55                   	push   %rbp
+  8016f3:	48 89 e5             	mov    %rsp,%rbp
+  8016f6:	53                   	push   %rbx
+  8016f7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8016fa:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8016fe:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801703:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801708:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170d:	be 00 00 00 00       	mov    $0x0,%esi
+  801712:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801718:	cd 30                	int    $0x30
+}
+  80171a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171e:	c9                   	leave
+  80171f:	c3                   	ret
+
+0000000000801720 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801728:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801730:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801733:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801738:	be 00 00 00 00       	mov    $0x0,%esi
+  80173d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801743:	cd 30                	int    $0x30
+}
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+000000000080174b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80174b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801752:	ff ff ff 
+  801755:	48 01 f8             	add    %rdi,%rax
+  801758:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80175c:	c3                   	ret
+
+000000000080175d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80175d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801764:	ff ff ff 
+  801767:	48 01 f8             	add    %rdi,%rax
+  80176a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80176e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801774:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801778:	c3                   	ret
+
+0000000000801779 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801779:	55                   	push   %rbp
+  80177a:	48 89 e5             	mov    %rsp,%rbp
+  80177d:	41 57                	push   %r15
+  80177f:	41 56                	push   %r14
+  801781:	41 55                	push   %r13
+  801783:	41 54                	push   %r12
+  801785:	53                   	push   %rbx
+  801786:	48 83 ec 08          	sub    $0x8,%rsp
+  80178a:	49 89 ff             	mov    %rdi,%r15
+  80178d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801792:	49 bd 98 32 80 00 00 	movabs $0x803298,%r13
+  801799:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80179c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8017a2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8017a5:	48 89 df             	mov    %rbx,%rdi
+  8017a8:	41 ff d5             	call   *%r13
+  8017ab:	83 e0 04             	and    $0x4,%eax
+  8017ae:	74 17                	je     8017c7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8017b0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017b7:	4c 39 f3             	cmp    %r14,%rbx
+  8017ba:	75 e6                	jne    8017a2 <fd_alloc+0x29>
+  8017bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017c2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017c7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017ca:	48 83 c4 08          	add    $0x8,%rsp
+  8017ce:	5b                   	pop    %rbx
+  8017cf:	41 5c                	pop    %r12
+  8017d1:	41 5d                	pop    %r13
+  8017d3:	41 5e                	pop    %r14
+  8017d5:	41 5f                	pop    %r15
+  8017d7:	5d                   	pop    %rbp
+  8017d8:	c3                   	ret
+
+00000000008017d9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017d9:	83 ff 1f             	cmp    $0x1f,%edi
+  8017dc:	77 39                	ja     801817 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	41 54                	push   %r12
+  8017e4:	53                   	push   %rbx
+  8017e5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017e8:	48 63 df             	movslq %edi,%rbx
+  8017eb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017f2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017f6:	48 89 df             	mov    %rbx,%rdi
+  8017f9:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+  801805:	a8 04                	test   $0x4,%al
+  801807:	74 14                	je     80181d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801809:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801812:	5b                   	pop    %rbx
+  801813:	41 5c                	pop    %r12
+  801815:	5d                   	pop    %rbp
+  801816:	c3                   	ret
+        return -E_INVAL;
+  801817:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80181c:	c3                   	ret
+        return -E_INVAL;
+  80181d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801822:	eb ee                	jmp    801812 <fd_lookup+0x39>
+
+0000000000801824 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	41 54                	push   %r12
+  80182a:	53                   	push   %rbx
+  80182b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80182e:	48 b8 80 3e 80 00 00 	movabs $0x803e80,%rax
+  801835:	00 00 00 
+  801838:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80183f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801842:	39 3b                	cmp    %edi,(%rbx)
+  801844:	74 47                	je     80188d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801846:	48 83 c0 08          	add    $0x8,%rax
+  80184a:	48 8b 18             	mov    (%rax),%rbx
+  80184d:	48 85 db             	test   %rbx,%rbx
+  801850:	75 f0                	jne    801842 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801852:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801859:	00 00 00 
+  80185c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801862:	89 fa                	mov    %edi,%edx
+  801864:	48 bf d8 3d 80 00 00 	movabs $0x803dd8,%rdi
+  80186b:	00 00 00 
+  80186e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801873:	48 b9 ca 03 80 00 00 	movabs $0x8003ca,%rcx
+  80187a:	00 00 00 
+  80187d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80187f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801884:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801888:	5b                   	pop    %rbx
+  801889:	41 5c                	pop    %r12
+  80188b:	5d                   	pop    %rbp
+  80188c:	c3                   	ret
+            return 0;
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801892:	eb f0                	jmp    801884 <dev_lookup+0x60>
+
+0000000000801894 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801894:	55                   	push   %rbp
+  801895:	48 89 e5             	mov    %rsp,%rbp
+  801898:	41 55                	push   %r13
+  80189a:	41 54                	push   %r12
+  80189c:	53                   	push   %rbx
+  80189d:	48 83 ec 18          	sub    $0x18,%rsp
+  8018a1:	48 89 fb             	mov    %rdi,%rbx
+  8018a4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018a7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018ae:	ff ff ff 
+  8018b1:	48 01 df             	add    %rbx,%rdi
+  8018b4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018b8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018bc:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8018c3:	00 00 00 
+  8018c6:	ff d0                	call   *%rax
+  8018c8:	41 89 c5             	mov    %eax,%r13d
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 06                	js     8018d5 <fd_close+0x41>
+  8018cf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018d3:	74 1a                	je     8018ef <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018d5:	45 84 e4             	test   %r12b,%r12b
+  8018d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018dd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018e1:	44 89 e8             	mov    %r13d,%eax
+  8018e4:	48 83 c4 18          	add    $0x18,%rsp
+  8018e8:	5b                   	pop    %rbx
+  8018e9:	41 5c                	pop    %r12
+  8018eb:	41 5d                	pop    %r13
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018ef:	8b 3b                	mov    (%rbx),%edi
+  8018f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018f5:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+  801901:	41 89 c5             	mov    %eax,%r13d
+  801904:	85 c0                	test   %eax,%eax
+  801906:	78 1b                	js     801923 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801908:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80190c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801910:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801916:	48 85 c0             	test   %rax,%rax
+  801919:	74 08                	je     801923 <fd_close+0x8f>
+  80191b:	48 89 df             	mov    %rbx,%rdi
+  80191e:	ff d0                	call   *%rax
+  801920:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801923:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801928:	48 89 de             	mov    %rbx,%rsi
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801930:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  801937:	00 00 00 
+  80193a:	ff d0                	call   *%rax
+    return res;
+  80193c:	eb a3                	jmp    8018e1 <fd_close+0x4d>
+
+000000000080193e <close>:
+
+int
+close(int fdnum) {
+  80193e:	55                   	push   %rbp
+  80193f:	48 89 e5             	mov    %rsp,%rbp
+  801942:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801946:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80194a:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801951:	00 00 00 
+  801954:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 15                	js     80196f <close+0x31>
+
+    return fd_close(fd, 1);
+  80195a:	be 01 00 00 00       	mov    $0x1,%esi
+  80195f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801963:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+0000000000801971 <close_all>:
+
+void
+close_all(void) {
+  801971:	55                   	push   %rbp
+  801972:	48 89 e5             	mov    %rsp,%rbp
+  801975:	41 54                	push   %r12
+  801977:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801978:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197d:	49 bc 3e 19 80 00 00 	movabs $0x80193e,%r12
+  801984:	00 00 00 
+  801987:	89 df                	mov    %ebx,%edi
+  801989:	41 ff d4             	call   *%r12
+  80198c:	83 c3 01             	add    $0x1,%ebx
+  80198f:	83 fb 20             	cmp    $0x20,%ebx
+  801992:	75 f3                	jne    801987 <close_all+0x16>
+}
+  801994:	5b                   	pop    %rbx
+  801995:	41 5c                	pop    %r12
+  801997:	5d                   	pop    %rbp
+  801998:	c3                   	ret
+
+0000000000801999 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	41 57                	push   %r15
+  80199f:	41 56                	push   %r14
+  8019a1:	41 55                	push   %r13
+  8019a3:	41 54                	push   %r12
+  8019a5:	53                   	push   %rbx
+  8019a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8019aa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019ad:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019b1:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	89 c3                	mov    %eax,%ebx
+  8019bf:	85 c0                	test   %eax,%eax
+  8019c1:	0f 88 b8 00 00 00    	js     801a7f <dup+0xe6>
+    close(newfdnum);
+  8019c7:	44 89 e7             	mov    %r12d,%edi
+  8019ca:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  8019d1:	00 00 00 
+  8019d4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019d6:	4d 63 ec             	movslq %r12d,%r13
+  8019d9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019e0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019e4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019e8:	4c 89 ff             	mov    %r15,%rdi
+  8019eb:	49 be 5d 17 80 00 00 	movabs $0x80175d,%r14
+  8019f2:	00 00 00 
+  8019f5:	41 ff d6             	call   *%r14
+  8019f8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019fb:	4c 89 ef             	mov    %r13,%rdi
+  8019fe:	41 ff d6             	call   *%r14
+  801a01:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a04:	48 89 df             	mov    %rbx,%rdi
+  801a07:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a13:	a8 04                	test   $0x4,%al
+  801a15:	74 2b                	je     801a42 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a17:	41 89 c1             	mov    %eax,%r9d
+  801a1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a20:	4c 89 f1             	mov    %r14,%rcx
+  801a23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a28:	48 89 de             	mov    %rbx,%rsi
+  801a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a30:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	89 c3                	mov    %eax,%ebx
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 4e                	js     801a90 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a42:	4c 89 ff             	mov    %r15,%rdi
+  801a45:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  801a4c:	00 00 00 
+  801a4f:	ff d0                	call   *%rax
+  801a51:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a5a:	4c 89 e9             	mov    %r13,%rcx
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	4c 89 fe             	mov    %r15,%rsi
+  801a65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6a:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  801a71:	00 00 00 
+  801a74:	ff d0                	call   *%rax
+  801a76:	89 c3                	mov    %eax,%ebx
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 14                	js     801a90 <dup+0xf7>
+
+    return newfdnum;
+  801a7c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a7f:	89 d8                	mov    %ebx,%eax
+  801a81:	48 83 c4 18          	add    $0x18,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	41 5e                	pop    %r14
+  801a8c:	41 5f                	pop    %r15
+  801a8e:	5d                   	pop    %rbp
+  801a8f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a95:	4c 89 ee             	mov    %r13,%rsi
+  801a98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9d:	49 bc 47 14 80 00 00 	movabs $0x801447,%r12
+  801aa4:	00 00 00 
+  801aa7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aaf:	4c 89 f6             	mov    %r14,%rsi
+  801ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab7:	41 ff d4             	call   *%r12
+    return res;
+  801aba:	eb c3                	jmp    801a7f <dup+0xe6>
+
+0000000000801abc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	41 56                	push   %r14
+  801ac2:	41 55                	push   %r13
+  801ac4:	41 54                	push   %r12
+  801ac6:	53                   	push   %rbx
+  801ac7:	48 83 ec 10          	sub    $0x10,%rsp
+  801acb:	89 fb                	mov    %edi,%ebx
+  801acd:	49 89 f4             	mov    %rsi,%r12
+  801ad0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ad3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad7:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	78 4c                	js     801b33 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aeb:	41 8b 3e             	mov    (%r14),%edi
+  801aee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af2:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 35                	js     801b37 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b02:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b06:	83 e0 03             	and    $0x3,%eax
+  801b09:	83 f8 01             	cmp    $0x1,%eax
+  801b0c:	74 2d                	je     801b3b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b16:	48 85 c0             	test   %rax,%rax
+  801b19:	74 56                	je     801b71 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b1b:	4c 89 ea             	mov    %r13,%rdx
+  801b1e:	4c 89 e6             	mov    %r12,%rsi
+  801b21:	4c 89 f7             	mov    %r14,%rdi
+  801b24:	ff d0                	call   *%rax
+}
+  801b26:	48 83 c4 10          	add    $0x10,%rsp
+  801b2a:	5b                   	pop    %rbx
+  801b2b:	41 5c                	pop    %r12
+  801b2d:	41 5d                	pop    %r13
+  801b2f:	41 5e                	pop    %r14
+  801b31:	5d                   	pop    %rbp
+  801b32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b33:	48 98                	cltq
+  801b35:	eb ef                	jmp    801b26 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b37:	48 98                	cltq
+  801b39:	eb eb                	jmp    801b26 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b42:	00 00 00 
+  801b45:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b4b:	89 da                	mov    %ebx,%edx
+  801b4d:	48 bf 39 3e 80 00 00 	movabs $0x803e39,%rdi
+  801b54:	00 00 00 
+  801b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5c:	48 b9 ca 03 80 00 00 	movabs $0x8003ca,%rcx
+  801b63:	00 00 00 
+  801b66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b6f:	eb b5                	jmp    801b26 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b78:	eb ac                	jmp    801b26 <read+0x6a>
+
+0000000000801b7a <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+  801b7e:	41 56                	push   %r14
+  801b80:	41 55                	push   %r13
+  801b82:	41 54                	push   %r12
+  801b84:	53                   	push   %rbx
+  801b85:	48 83 ec 10          	sub    $0x10,%rsp
+  801b89:	89 fb                	mov    %edi,%ebx
+  801b8b:	49 89 f4             	mov    %rsi,%r12
+  801b8e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b95:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 41                	js     801be6 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ba9:	41 8b 3e             	mov    (%r14),%edi
+  801bac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb0:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 35                	js     801bf5 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bc0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bc4:	83 e0 03             	and    $0x3,%eax
+  801bc7:	83 f8 01             	cmp    $0x1,%eax
+  801bca:	74 2d                	je     801bf9 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801bcc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bd4:	48 85 c0             	test   %rax,%rax
+  801bd7:	74 56                	je     801c2f <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801bd9:	4c 89 ea             	mov    %r13,%rdx
+  801bdc:	4c 89 e6             	mov    %r12,%rsi
+  801bdf:	4c 89 f7             	mov    %r14,%rdi
+  801be2:	ff d0                	call   *%rax
+  801be4:	eb 02                	jmp    801be8 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be6:	48 98                	cltq
+}
+  801be8:	48 83 c4 10          	add    $0x10,%rsp
+  801bec:	5b                   	pop    %rbx
+  801bed:	41 5c                	pop    %r12
+  801bef:	41 5d                	pop    %r13
+  801bf1:	41 5e                	pop    %r14
+  801bf3:	5d                   	pop    %rbp
+  801bf4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf5:	48 98                	cltq
+  801bf7:	eb ef                	jmp    801be8 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c00:	00 00 00 
+  801c03:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c09:	89 da                	mov    %ebx,%edx
+  801c0b:	48 bf f8 3d 80 00 00 	movabs $0x803df8,%rdi
+  801c12:	00 00 00 
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	48 b9 ca 03 80 00 00 	movabs $0x8003ca,%rcx
+  801c21:	00 00 00 
+  801c24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c2d:	eb b9                	jmp    801be8 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c2f:	4c 89 ea             	mov    %r13,%rdx
+  801c32:	4c 89 e6             	mov    %r12,%rsi
+  801c35:	89 df                	mov    %ebx,%edi
+  801c37:	48 b8 bc 1a 80 00 00 	movabs $0x801abc,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+  801c43:	eb a3                	jmp    801be8 <readmap+0x6e>
+
+0000000000801c45 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c45:	55                   	push   %rbp
+  801c46:	48 89 e5             	mov    %rsp,%rbp
+  801c49:	41 57                	push   %r15
+  801c4b:	41 56                	push   %r14
+  801c4d:	41 55                	push   %r13
+  801c4f:	41 54                	push   %r12
+  801c51:	53                   	push   %rbx
+  801c52:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c56:	48 85 d2             	test   %rdx,%rdx
+  801c59:	74 54                	je     801caf <readn+0x6a>
+  801c5b:	41 89 fd             	mov    %edi,%r13d
+  801c5e:	49 89 f6             	mov    %rsi,%r14
+  801c61:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c69:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c6e:	49 bf bc 1a 80 00 00 	movabs $0x801abc,%r15
+  801c75:	00 00 00 
+  801c78:	4c 89 e2             	mov    %r12,%rdx
+  801c7b:	48 29 f2             	sub    %rsi,%rdx
+  801c7e:	4c 01 f6             	add    %r14,%rsi
+  801c81:	44 89 ef             	mov    %r13d,%edi
+  801c84:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 20                	js     801cab <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c8b:	01 c3                	add    %eax,%ebx
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	74 08                	je     801c99 <readn+0x54>
+  801c91:	48 63 f3             	movslq %ebx,%rsi
+  801c94:	4c 39 e6             	cmp    %r12,%rsi
+  801c97:	72 df                	jb     801c78 <readn+0x33>
+    }
+    return res;
+  801c99:	48 63 c3             	movslq %ebx,%rax
+}
+  801c9c:	48 83 c4 08          	add    $0x8,%rsp
+  801ca0:	5b                   	pop    %rbx
+  801ca1:	41 5c                	pop    %r12
+  801ca3:	41 5d                	pop    %r13
+  801ca5:	41 5e                	pop    %r14
+  801ca7:	41 5f                	pop    %r15
+  801ca9:	5d                   	pop    %rbp
+  801caa:	c3                   	ret
+        if (inc < 0) return inc;
+  801cab:	48 98                	cltq
+  801cad:	eb ed                	jmp    801c9c <readn+0x57>
+    int inc = 1, res = 0;
+  801caf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb4:	eb e3                	jmp    801c99 <readn+0x54>
+
+0000000000801cb6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cb6:	55                   	push   %rbp
+  801cb7:	48 89 e5             	mov    %rsp,%rbp
+  801cba:	41 56                	push   %r14
+  801cbc:	41 55                	push   %r13
+  801cbe:	41 54                	push   %r12
+  801cc0:	53                   	push   %rbx
+  801cc1:	48 83 ec 10          	sub    $0x10,%rsp
+  801cc5:	89 fb                	mov    %edi,%ebx
+  801cc7:	49 89 f4             	mov    %rsi,%r12
+  801cca:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ccd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cd1:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801cd8:	00 00 00 
+  801cdb:	ff d0                	call   *%rax
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 47                	js     801d28 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ce1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ce5:	41 8b 3e             	mov    (%r14),%edi
+  801ce8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cec:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801cf3:	00 00 00 
+  801cf6:	ff d0                	call   *%rax
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	78 30                	js     801d2c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cfc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d01:	74 2d                	je     801d30 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d07:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d0b:	48 85 c0             	test   %rax,%rax
+  801d0e:	74 56                	je     801d66 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d10:	4c 89 ea             	mov    %r13,%rdx
+  801d13:	4c 89 e6             	mov    %r12,%rsi
+  801d16:	4c 89 f7             	mov    %r14,%rdi
+  801d19:	ff d0                	call   *%rax
+}
+  801d1b:	48 83 c4 10          	add    $0x10,%rsp
+  801d1f:	5b                   	pop    %rbx
+  801d20:	41 5c                	pop    %r12
+  801d22:	41 5d                	pop    %r13
+  801d24:	41 5e                	pop    %r14
+  801d26:	5d                   	pop    %rbp
+  801d27:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d28:	48 98                	cltq
+  801d2a:	eb ef                	jmp    801d1b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2c:	48 98                	cltq
+  801d2e:	eb eb                	jmp    801d1b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d37:	00 00 00 
+  801d3a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d40:	89 da                	mov    %ebx,%edx
+  801d42:	48 bf 55 3e 80 00 00 	movabs $0x803e55,%rdi
+  801d49:	00 00 00 
+  801d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d51:	48 b9 ca 03 80 00 00 	movabs $0x8003ca,%rcx
+  801d58:	00 00 00 
+  801d5b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d5d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d64:	eb b5                	jmp    801d1b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d66:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d6d:	eb ac                	jmp    801d1b <write+0x65>
+
+0000000000801d6f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+  801d73:	53                   	push   %rbx
+  801d74:	48 83 ec 18          	sub    $0x18,%rsp
+  801d78:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d7a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d7e:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801d85:	00 00 00 
+  801d88:	ff d0                	call   *%rax
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 0c                	js     801d9a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d92:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d9e:	c9                   	leave
+  801d9f:	c3                   	ret
+
+0000000000801da0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801da0:	55                   	push   %rbp
+  801da1:	48 89 e5             	mov    %rsp,%rbp
+  801da4:	41 55                	push   %r13
+  801da6:	41 54                	push   %r12
+  801da8:	53                   	push   %rbx
+  801da9:	48 83 ec 18          	sub    $0x18,%rsp
+  801dad:	89 fb                	mov    %edi,%ebx
+  801daf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801db2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801db6:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 38                	js     801dfe <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801dca:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801dce:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dd2:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801dd9:	00 00 00 
+  801ddc:	ff d0                	call   *%rax
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	78 1c                	js     801dfe <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801de2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801de7:	74 20                	je     801e09 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801de9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ded:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801df1:	48 85 c0             	test   %rax,%rax
+  801df4:	74 47                	je     801e3d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801df6:	44 89 e6             	mov    %r12d,%esi
+  801df9:	4c 89 ef             	mov    %r13,%rdi
+  801dfc:	ff d0                	call   *%rax
+}
+  801dfe:	48 83 c4 18          	add    $0x18,%rsp
+  801e02:	5b                   	pop    %rbx
+  801e03:	41 5c                	pop    %r12
+  801e05:	41 5d                	pop    %r13
+  801e07:	5d                   	pop    %rbp
+  801e08:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e09:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e10:	00 00 00 
+  801e13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e19:	89 da                	mov    %ebx,%edx
+  801e1b:	48 bf 18 3e 80 00 00 	movabs $0x803e18,%rdi
+  801e22:	00 00 00 
+  801e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2a:	48 b9 ca 03 80 00 00 	movabs $0x8003ca,%rcx
+  801e31:	00 00 00 
+  801e34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e3b:	eb c1                	jmp    801dfe <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e3d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e42:	eb ba                	jmp    801dfe <ftruncate+0x5e>
+
+0000000000801e44 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e44:	55                   	push   %rbp
+  801e45:	48 89 e5             	mov    %rsp,%rbp
+  801e48:	41 54                	push   %r12
+  801e4a:	53                   	push   %rbx
+  801e4b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e4f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e52:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e56:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 4e                	js     801eb4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e66:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e6a:	41 8b 3c 24          	mov    (%r12),%edi
+  801e6e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e72:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801e79:	00 00 00 
+  801e7c:	ff d0                	call   *%rax
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	78 32                	js     801eb4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e86:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801e8b:	74 30                	je     801ebd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e8d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e90:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e97:	00 00 00 
+    stat->st_isdir = 0;
+  801e9a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ea1:	00 00 00 
+    stat->st_dev = dev;
+  801ea4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801eab:	48 89 de             	mov    %rbx,%rsi
+  801eae:	4c 89 e7             	mov    %r12,%rdi
+  801eb1:	ff 50 30             	call   *0x30(%rax)
+}
+  801eb4:	48 83 c4 10          	add    $0x10,%rsp
+  801eb8:	5b                   	pop    %rbx
+  801eb9:	41 5c                	pop    %r12
+  801ebb:	5d                   	pop    %rbp
+  801ebc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ebd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ec2:	eb f0                	jmp    801eb4 <fstat+0x70>
+
+0000000000801ec4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	41 54                	push   %r12
+  801eca:	53                   	push   %rbx
+  801ecb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ece:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed3:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+  801edf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ee1:	85 c0                	test   %eax,%eax
+  801ee3:	78 25                	js     801f0a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ee5:	4c 89 e6             	mov    %r12,%rsi
+  801ee8:	89 c7                	mov    %eax,%edi
+  801eea:	48 b8 44 1e 80 00 00 	movabs $0x801e44,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+  801ef6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ef9:	89 df                	mov    %ebx,%edi
+  801efb:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801f02:	00 00 00 
+  801f05:	ff d0                	call   *%rax
+
+    return res;
+  801f07:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f0a:	89 d8                	mov    %ebx,%eax
+  801f0c:	5b                   	pop    %rbx
+  801f0d:	41 5c                	pop    %r12
+  801f0f:	5d                   	pop    %rbp
+  801f10:	c3                   	ret
+
+0000000000801f11 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801f11:	55                   	push   %rbp
+  801f12:	48 89 e5             	mov    %rsp,%rbp
+  801f15:	41 54                	push   %r12
+  801f17:	53                   	push   %rbx
+  801f18:	48 83 ec 10          	sub    $0x10,%rsp
+  801f1c:	48 89 fb             	mov    %rdi,%rbx
+  801f1f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f26:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f2b:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801f32:	00 00 00 
+  801f35:	ff d0                	call   *%rax
+  801f37:	85 c0                	test   %eax,%eax
+  801f39:	78 1f                	js     801f5a <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801f3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f3f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801f43:	48 85 c0             	test   %rax,%rax
+  801f46:	74 1b                	je     801f63 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801f48:	4c 89 e6             	mov    %r12,%rsi
+  801f4b:	48 89 df             	mov    %rbx,%rdi
+  801f4e:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f57:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f5a:	48 83 c4 10          	add    $0x10,%rsp
+  801f5e:	5b                   	pop    %rbx
+  801f5f:	41 5c                	pop    %r12
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f63:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f68:	eb f0                	jmp    801f5a <create_snapshot+0x49>
+
+0000000000801f6a <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f72:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f76:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f7b:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 1e                	js     801fa9 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801f8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f8f:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801f93:	48 85 d2             	test   %rdx,%rdx
+  801f96:	74 13                	je     801fab <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb0:	eb f7                	jmp    801fa9 <print_snapshot_list+0x3f>
+
+0000000000801fb2 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801fb2:	55                   	push   %rbp
+  801fb3:	48 89 e5             	mov    %rsp,%rbp
+  801fb6:	53                   	push   %rbx
+  801fb7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fbb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fbe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc2:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc7:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	78 1c                	js     801ff3 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fdb:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801fdf:	48 85 c0             	test   %rax,%rax
+  801fe2:	74 15                	je     801ff9 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801fe4:	48 89 df             	mov    %rbx,%rdi
+  801fe7:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff0:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff7:	c9                   	leave
+  801ff8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ff9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ffe:	eb f3                	jmp    801ff3 <accept_snapshot+0x41>
+
+0000000000802000 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802000:	55                   	push   %rbp
+  802001:	48 89 e5             	mov    %rsp,%rbp
+  802004:	53                   	push   %rbx
+  802005:	48 83 ec 18          	sub    $0x18,%rsp
+  802009:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80200c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802010:	bf 66 00 00 00       	mov    $0x66,%edi
+  802015:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  80201c:	00 00 00 
+  80201f:	ff d0                	call   *%rax
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 1c                	js     802041 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802025:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802029:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80202d:	48 85 c0             	test   %rax,%rax
+  802030:	74 15                	je     802047 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802032:	48 89 df             	mov    %rbx,%rdi
+  802035:	ff d0                	call   *%rax
+    if (res < 0) {
+  802037:	85 c0                	test   %eax,%eax
+  802039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802041:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802045:	c9                   	leave
+  802046:	c3                   	ret
+        return -E_NOT_SUPP;
+  802047:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80204c:	eb f3                	jmp    802041 <delete_snapshot+0x41>
+
+000000000080204e <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80204e:	55                   	push   %rbp
+  80204f:	48 89 e5             	mov    %rsp,%rbp
+  802052:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802056:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80205a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80205f:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 14                	js     802083 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80206f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802073:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802077:	48 85 d2             	test   %rdx,%rdx
+  80207a:	74 09                	je     802085 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80207c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802081:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+        return -E_NOT_SUPP;
+  802085:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80208a:	eb f7                	jmp    802083 <gc_snapshots+0x35>
+
+000000000080208c <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80208c:	55                   	push   %rbp
+  80208d:	48 89 e5             	mov    %rsp,%rbp
+  802090:	41 56                	push   %r14
+  802092:	41 55                	push   %r13
+  802094:	41 54                	push   %r12
+  802096:	53                   	push   %rbx
+  802097:	48 83 ec 10          	sub    $0x10,%rsp
+  80209b:	48 89 fb             	mov    %rdi,%rbx
+  80209e:	49 89 f4             	mov    %rsi,%r12
+  8020a1:	49 89 d5             	mov    %rdx,%r13
+  8020a4:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020a7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020ab:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020b0:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 1b                	js     8020db <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8020c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020c4:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8020c8:	48 85 c0             	test   %rax,%rax
+  8020cb:	74 1b                	je     8020e8 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8020cd:	4c 89 f1             	mov    %r14,%rcx
+  8020d0:	4c 89 ea             	mov    %r13,%rdx
+  8020d3:	4c 89 e6             	mov    %r12,%rsi
+  8020d6:	48 89 df             	mov    %rbx,%rdi
+  8020d9:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020db:	48 83 c4 10          	add    $0x10,%rsp
+  8020df:	5b                   	pop    %rbx
+  8020e0:	41 5c                	pop    %r12
+  8020e2:	41 5d                	pop    %r13
+  8020e4:	41 5e                	pop    %r14
+  8020e6:	5d                   	pop    %rbp
+  8020e7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ed:	eb ec                	jmp    8020db <diff_snapshots+0x4f>
+
+00000000008020ef <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8020ef:	55                   	push   %rbp
+  8020f0:	48 89 e5             	mov    %rsp,%rbp
+  8020f3:	41 55                	push   %r13
+  8020f5:	41 54                	push   %r12
+  8020f7:	53                   	push   %rbx
+  8020f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8020fc:	48 89 fb             	mov    %rdi,%rbx
+  8020ff:	49 89 f4             	mov    %rsi,%r12
+  802102:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802105:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802109:	bf 66 00 00 00       	mov    $0x66,%edi
+  80210e:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+  80211a:	85 c0                	test   %eax,%eax
+  80211c:	78 18                	js     802136 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80211e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802122:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802126:	48 85 c0             	test   %rax,%rax
+  802129:	74 16                	je     802141 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80212b:	4c 89 ea             	mov    %r13,%rdx
+  80212e:	4c 89 e6             	mov    %r12,%rsi
+  802131:	48 89 df             	mov    %rbx,%rdi
+  802134:	ff d0                	call   *%rax
+
+    return res;
+}
+  802136:	48 83 c4 18          	add    $0x18,%rsp
+  80213a:	5b                   	pop    %rbx
+  80213b:	41 5c                	pop    %r12
+  80213d:	41 5d                	pop    %r13
+  80213f:	5d                   	pop    %rbp
+  802140:	c3                   	ret
+        return -E_NOT_SUPP;
+  802141:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802146:	eb ee                	jmp    802136 <send_snapshot+0x47>
+
+0000000000802148 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	53                   	push   %rbx
+  80214d:	48 83 ec 18          	sub    $0x18,%rsp
+  802151:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802154:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802158:	bf 66 00 00 00       	mov    $0x66,%edi
+  80215d:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  802164:	00 00 00 
+  802167:	ff d0                	call   *%rax
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	78 12                	js     80217f <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80216d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802171:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802175:	48 85 c0             	test   %rax,%rax
+  802178:	74 0b                	je     802185 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80217a:	48 89 df             	mov    %rbx,%rdi
+  80217d:	ff d0                	call   *%rax
+
+    return res;
+}
+  80217f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+        return -E_NOT_SUPP;
+  802185:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80218a:	eb f3                	jmp    80217f <receive_snapshot+0x37>
+
+000000000080218c <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80218c:	55                   	push   %rbp
+  80218d:	48 89 e5             	mov    %rsp,%rbp
+  802190:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802194:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802198:	bf 66 00 00 00       	mov    $0x66,%edi
+  80219d:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8021a4:	00 00 00 
+  8021a7:	ff d0                	call   *%rax
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	78 17                	js     8021c4 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8021ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b1:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8021b8:	48 85 d2             	test   %rdx,%rdx
+  8021bb:	74 09                	je     8021c6 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8021bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021c6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021cb:	eb f7                	jmp    8021c4 <free_space_bytes+0x38>
+
+00000000008021cd <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021d9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021de:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8021e5:	00 00 00 
+  8021e8:	ff d0                	call   *%rax
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 17                	js     802205 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8021ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021f2:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8021f9:	48 85 d2             	test   %rdx,%rdx
+  8021fc:	74 09                	je     802207 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8021fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802203:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+        return -E_NOT_SUPP;
+  802207:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80220c:	eb f7                	jmp    802205 <busy_space_bytes+0x38>
+
+000000000080220e <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	41 54                	push   %r12
+  802214:	53                   	push   %rbx
+  802215:	48 83 ec 10          	sub    $0x10,%rsp
+  802219:	89 fb                	mov    %edi,%ebx
+  80221b:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80221e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802222:	bf 66 00 00 00       	mov    $0x66,%edi
+  802227:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 17                	js     80224e <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80223b:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802242:	48 85 c0             	test   %rax,%rax
+  802245:	74 10                	je     802257 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802247:	4c 89 e6             	mov    %r12,%rsi
+  80224a:	89 df                	mov    %ebx,%edi
+  80224c:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80224e:	48 83 c4 10          	add    $0x10,%rsp
+  802252:	5b                   	pop    %rbx
+  802253:	41 5c                	pop    %r12
+  802255:	5d                   	pop    %rbp
+  802256:	c3                   	ret
+        return -E_NOT_SUPP;
+  802257:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80225c:	eb f0                	jmp    80224e <snapshots_space+0x40>
+
+000000000080225e <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80225e:	55                   	push   %rbp
+  80225f:	48 89 e5             	mov    %rsp,%rbp
+  802262:	41 55                	push   %r13
+  802264:	41 54                	push   %r12
+  802266:	53                   	push   %rbx
+  802267:	48 83 ec 08          	sub    $0x8,%rsp
+  80226b:	41 89 fd             	mov    %edi,%r13d
+  80226e:	48 89 f3             	mov    %rsi,%rbx
+  802271:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802274:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80227b:	00 00 00 
+  80227e:	83 38 00             	cmpl   $0x0,(%rax)
+  802281:	74 57                	je     8022da <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802283:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802289:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80228e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802295:	00 00 00 
+  802298:	44 89 ee             	mov    %r13d,%esi
+  80229b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022a2:	00 00 00 
+  8022a5:	8b 38                	mov    (%rax),%edi
+  8022a7:	48 b8 db 36 80 00 00 	movabs $0x8036db,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8022b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022b8:	4c 89 e2             	mov    %r12,%rdx
+  8022bb:	48 89 de             	mov    %rbx,%rsi
+  8022be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c3:	48 b8 c3 36 80 00 00 	movabs $0x8036c3,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+}
+  8022cf:	48 83 c4 08          	add    $0x8,%rsp
+  8022d3:	5b                   	pop    %rbx
+  8022d4:	41 5c                	pop    %r12
+  8022d6:	41 5d                	pop    %r13
+  8022d8:	5d                   	pop    %rbp
+  8022d9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022da:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022df:	48 b8 99 37 80 00 00 	movabs $0x803799,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+  8022eb:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022f2:	00 00 
+  8022f4:	eb 8d                	jmp    802283 <fsipc_region+0x25>
+
+00000000008022f6 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8022fe:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802305:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802306:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80230a:	48 b8 5e 22 80 00 00 	movabs $0x80225e,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+}
+  802316:	c9                   	leave
+  802317:	c3                   	ret
+
+0000000000802318 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802318:	85 ff                	test   %edi,%edi
+  80231a:	78 6d                	js     802389 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80231c:	55                   	push   %rbp
+  80231d:	48 89 e5             	mov    %rsp,%rbp
+  802320:	41 54                	push   %r12
+  802322:	53                   	push   %rbx
+  802323:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802326:	48 85 f6             	test   %rsi,%rsi
+  802329:	74 57                	je     802382 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80232b:	89 f8                	mov    %edi,%eax
+  80232d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802334:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802336:	be 00 00 00 00       	mov    $0x0,%esi
+  80233b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802340:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	78 2d                	js     80237d <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802350:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802357:	00 00 00 
+  80235a:	49 63 14 24          	movslq (%r12),%rdx
+  80235e:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802365:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80236a:	48 89 df             	mov    %rbx,%rdi
+  80236d:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802379:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80237d:	5b                   	pop    %rbx
+  80237e:	41 5c                	pop    %r12
+  802380:	5d                   	pop    %rbp
+  802381:	c3                   	ret
+        return -E_INVAL;
+  802382:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802387:	eb f4                	jmp    80237d <devfile_df_snapshots+0x65>
+  802389:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80238e:	c3                   	ret
+
+000000000080238f <devfile_df_busy>:
+devfile_df_busy() {
+  80238f:	55                   	push   %rbp
+  802390:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802393:	be 00 00 00 00       	mov    $0x0,%esi
+  802398:	bf 11 00 00 00       	mov    $0x11,%edi
+  80239d:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+}
+  8023a9:	5d                   	pop    %rbp
+  8023aa:	c3                   	ret
+
+00000000008023ab <devfile_df_free>:
+devfile_df_free() {
+  8023ab:	55                   	push   %rbp
+  8023ac:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8023af:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8023b9:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+}
+  8023c5:	5d                   	pop    %rbp
+  8023c6:	c3                   	ret
+
+00000000008023c7 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8023c7:	55                   	push   %rbp
+  8023c8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8023cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023d5:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8023dc:	00 00 00 
+  8023df:	ff d0                	call   *%rax
+}
+  8023e1:	5d                   	pop    %rbp
+  8023e2:	c3                   	ret
+
+00000000008023e3 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8023e3:	55                   	push   %rbp
+  8023e4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8023e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ec:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023f1:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8023f8:	00 00 00 
+  8023fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802404:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802407:	5d                   	pop    %rbp
+  802408:	c3                   	ret
+
+0000000000802409 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80240d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802414:	00 00 00 
+  802417:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80241a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80241c:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80241f:	be 00 00 00 00       	mov    $0x0,%esi
+  802424:	bf 02 00 00 00       	mov    $0x2,%edi
+  802429:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+}
+  802435:	5d                   	pop    %rbp
+  802436:	c3                   	ret
+
+0000000000802437 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802437:	55                   	push   %rbp
+  802438:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80243b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80243e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802445:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802447:	be 00 00 00 00       	mov    $0x0,%esi
+  80244c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802451:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+}
+  80245d:	5d                   	pop    %rbp
+  80245e:	c3                   	ret
+
+000000000080245f <devfile_write>:
+    if (!fd || !buf) {
+  80245f:	48 85 ff             	test   %rdi,%rdi
+  802462:	0f 84 c1 00 00 00    	je     802529 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+  80246c:	41 57                	push   %r15
+  80246e:	41 56                	push   %r14
+  802470:	41 55                	push   %r13
+  802472:	41 54                	push   %r12
+  802474:	53                   	push   %rbx
+  802475:	48 83 ec 18          	sub    $0x18,%rsp
+  802479:	49 89 ff             	mov    %rdi,%r15
+  80247c:	49 89 f5             	mov    %rsi,%r13
+  80247f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802482:	48 85 f6             	test   %rsi,%rsi
+  802485:	0f 84 95 00 00 00    	je     802520 <devfile_write+0xc1>
+    while (n) {
+  80248b:	48 85 d2             	test   %rdx,%rdx
+  80248e:	0f 84 83 00 00 00    	je     802517 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802494:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80249b:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8024a2:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024a5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8024aa:	49 39 dc             	cmp    %rbx,%r12
+  8024ad:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8024b1:	48 89 da             	mov    %rbx,%rdx
+  8024b4:	4c 89 ee             	mov    %r13,%rsi
+  8024b7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024be:	00 00 00 
+  8024c1:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  8024c8:	00 00 00 
+  8024cb:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024cd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024d1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8024d4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8024d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024dd:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024e2:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+        if (write < 0) {
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 21                	js     802513 <devfile_write+0xb4>
+        buf += write;
+  8024f2:	48 63 d0             	movslq %eax,%rdx
+  8024f5:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8024f8:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8024fb:	49 29 d4             	sub    %rdx,%r12
+  8024fe:	75 a5                	jne    8024a5 <devfile_write+0x46>
+    return totalWrite;
+  802500:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802504:	48 83 c4 18          	add    $0x18,%rsp
+  802508:	5b                   	pop    %rbx
+  802509:	41 5c                	pop    %r12
+  80250b:	41 5d                	pop    %r13
+  80250d:	41 5e                	pop    %r14
+  80250f:	41 5f                	pop    %r15
+  802511:	5d                   	pop    %rbp
+  802512:	c3                   	ret
+            return write;
+  802513:	48 98                	cltq
+  802515:	eb ed                	jmp    802504 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802517:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80251e:	eb e0                	jmp    802500 <devfile_write+0xa1>
+        return -E_INVAL;
+  802520:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802527:	eb db                	jmp    802504 <devfile_write+0xa5>
+  802529:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802530:	c3                   	ret
+
+0000000000802531 <devfile_read>:
+    if (!fd || !buf) {
+  802531:	48 85 ff             	test   %rdi,%rdi
+  802534:	0f 84 c0 00 00 00    	je     8025fa <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80253a:	55                   	push   %rbp
+  80253b:	48 89 e5             	mov    %rsp,%rbp
+  80253e:	41 57                	push   %r15
+  802540:	41 56                	push   %r14
+  802542:	41 55                	push   %r13
+  802544:	41 54                	push   %r12
+  802546:	53                   	push   %rbx
+  802547:	48 83 ec 18          	sub    $0x18,%rsp
+  80254b:	49 89 ff             	mov    %rdi,%r15
+  80254e:	49 89 f5             	mov    %rsi,%r13
+  802551:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802554:	48 85 f6             	test   %rsi,%rsi
+  802557:	0f 84 96 00 00 00    	je     8025f3 <devfile_read+0xc2>
+    while (n) {
+  80255d:	48 85 d2             	test   %rdx,%rdx
+  802560:	0f 84 87 00 00 00    	je     8025ed <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802566:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80256d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80256e:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802575:	00 00 00 
+  802578:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80257c:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80257f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802584:	49 39 c4             	cmp    %rax,%r12
+  802587:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80258b:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80258f:	be 00 00 00 00       	mov    $0x0,%esi
+  802594:	bf 03 00 00 00       	mov    $0x3,%edi
+  802599:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	7e 37                	jle    8025e0 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8025a9:	48 63 d8             	movslq %eax,%rbx
+  8025ac:	48 89 da             	mov    %rbx,%rdx
+  8025af:	4c 89 f6             	mov    %r14,%rsi
+  8025b2:	4c 89 ef             	mov    %r13,%rdi
+  8025b5:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  8025bc:	00 00 00 
+  8025bf:	ff d0                	call   *%rax
+        buf += read;
+  8025c1:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8025c4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8025c8:	49 29 dc             	sub    %rbx,%r12
+  8025cb:	75 ab                	jne    802578 <devfile_read+0x47>
+  return totalRead;
+  8025cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8025d1:	48 83 c4 18          	add    $0x18,%rsp
+  8025d5:	5b                   	pop    %rbx
+  8025d6:	41 5c                	pop    %r12
+  8025d8:	41 5d                	pop    %r13
+  8025da:	41 5e                	pop    %r14
+  8025dc:	41 5f                	pop    %r15
+  8025de:	5d                   	pop    %rbp
+  8025df:	c3                   	ret
+            return read ? read : totalRead;
+  8025e0:	48 63 d0             	movslq %eax,%rdx
+  8025e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025e7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8025eb:	eb e4                	jmp    8025d1 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8025ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8025f1:	eb da                	jmp    8025cd <devfile_read+0x9c>
+        return E_INVAL;
+  8025f3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025f8:	eb d7                	jmp    8025d1 <devfile_read+0xa0>
+  8025fa:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8025ff:	c3                   	ret
+
+0000000000802600 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802600:	48 85 ff             	test   %rdi,%rdi
+  802603:	74 5f                	je     802664 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802605:	55                   	push   %rbp
+  802606:	48 89 e5             	mov    %rsp,%rbp
+  802609:	53                   	push   %rbx
+  80260a:	48 83 ec 08          	sub    $0x8,%rsp
+  80260e:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802611:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  802618:	00 00 00 
+  80261b:	ff d0                	call   *%rax
+  80261d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802623:	77 45                	ja     80266a <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802625:	48 89 de             	mov    %rbx,%rsi
+  802628:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80262f:	00 00 00 
+  802632:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80263e:	be 00 00 00 00       	mov    $0x0,%esi
+  802643:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802648:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802654:	85 c0                	test   %eax,%eax
+  802656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80265e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+        return -E_INVAL;
+  802664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802669:	c3                   	ret
+        return -E_INVAL;
+  80266a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80266f:	eb ed                	jmp    80265e <devfile_receive_snapshot+0x5e>
+
+0000000000802671 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802671:	55                   	push   %rbp
+  802672:	48 89 e5             	mov    %rsp,%rbp
+  802675:	41 55                	push   %r13
+  802677:	41 54                	push   %r12
+  802679:	53                   	push   %rbx
+  80267a:	48 83 ec 08          	sub    $0x8,%rsp
+  80267e:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802681:	48 85 f6             	test   %rsi,%rsi
+  802684:	0f 94 c0             	sete   %al
+  802687:	48 85 d2             	test   %rdx,%rdx
+  80268a:	0f 94 c2             	sete   %dl
+  80268d:	08 d0                	or     %dl,%al
+  80268f:	0f 85 ad 00 00 00    	jne    802742 <devfile_send_snapshot+0xd1>
+  802695:	48 89 fb             	mov    %rdi,%rbx
+  802698:	49 89 f4             	mov    %rsi,%r12
+  80269b:	48 85 ff             	test   %rdi,%rdi
+  80269e:	0f 84 9e 00 00 00    	je     802742 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8026a4:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+  8026b0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026b6:	0f 87 8d 00 00 00    	ja     802749 <devfile_send_snapshot+0xd8>
+  8026bc:	4c 89 e7             	mov    %r12,%rdi
+  8026bf:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+  8026cb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026d1:	77 7d                	ja     802750 <devfile_send_snapshot+0xdf>
+  8026d3:	4c 89 ef             	mov    %r13,%rdi
+  8026d6:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026e8:	77 6d                	ja     802757 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8026ea:	48 89 de             	mov    %rbx,%rsi
+  8026ed:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026f4:	00 00 00 
+  8026f7:	48 bb ef 0c 80 00 00 	movabs $0x800cef,%rbx
+  8026fe:	00 00 00 
+  802701:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802703:	4c 89 e6             	mov    %r12,%rsi
+  802706:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80270d:	00 00 00 
+  802710:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802712:	4c 89 ee             	mov    %r13,%rsi
+  802715:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80271c:	00 00 00 
+  80271f:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802721:	be 00 00 00 00       	mov    $0x0,%esi
+  802726:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80272b:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+}
+  802737:	48 83 c4 08          	add    $0x8,%rsp
+  80273b:	5b                   	pop    %rbx
+  80273c:	41 5c                	pop    %r12
+  80273e:	41 5d                	pop    %r13
+  802740:	5d                   	pop    %rbp
+  802741:	c3                   	ret
+        return -E_INVAL;
+  802742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802747:	eb ee                	jmp    802737 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802749:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80274e:	eb e7                	jmp    802737 <devfile_send_snapshot+0xc6>
+  802750:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802755:	eb e0                	jmp    802737 <devfile_send_snapshot+0xc6>
+  802757:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80275c:	eb d9                	jmp    802737 <devfile_send_snapshot+0xc6>
+
+000000000080275e <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80275e:	48 85 ff             	test   %rdi,%rdi
+  802761:	0f 84 41 01 00 00    	je     8028a8 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	41 57                	push   %r15
+  80276d:	41 56                	push   %r14
+  80276f:	41 55                	push   %r13
+  802771:	41 54                	push   %r12
+  802773:	53                   	push   %rbx
+  802774:	48 83 ec 08          	sub    $0x8,%rsp
+  802778:	49 89 fc             	mov    %rdi,%r12
+  80277b:	49 89 f5             	mov    %rsi,%r13
+  80277e:	48 89 d3             	mov    %rdx,%rbx
+  802781:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802784:	48 85 f6             	test   %rsi,%rsi
+  802787:	0f 84 ff 00 00 00    	je     80288c <devfile_diff_snapshots+0x12e>
+  80278d:	48 85 d2             	test   %rdx,%rdx
+  802790:	0f 84 fd 00 00 00    	je     802893 <devfile_diff_snapshots+0x135>
+  802796:	48 85 c9             	test   %rcx,%rcx
+  802799:	0f 84 f4 00 00 00    	je     802893 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80279f:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027b1:	0f 87 e3 00 00 00    	ja     80289a <devfile_diff_snapshots+0x13c>
+  8027b7:	4c 89 ef             	mov    %r13,%rdi
+  8027ba:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+  8027c6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027cc:	0f 87 cf 00 00 00    	ja     8028a1 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8027d2:	4c 89 e6             	mov    %r12,%rsi
+  8027d5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8027dc:	00 00 00 
+  8027df:	4c 89 e7             	mov    %r12,%rdi
+  8027e2:	49 bf ef 0c 80 00 00 	movabs $0x800cef,%r15
+  8027e9:	00 00 00 
+  8027ec:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8027ef:	4c 89 ee             	mov    %r13,%rsi
+  8027f2:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8027f9:	00 
+  8027fa:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8027fd:	48 8b 03             	mov    (%rbx),%rax
+  802800:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802807:	00 
+  802808:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80280c:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802813:	00 
+  802814:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802818:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80281f:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802820:	be 00 00 00 00       	mov    $0x0,%esi
+  802825:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80282a:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802836:	85 c0                	test   %eax,%eax
+  802838:	78 43                	js     80287d <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80283a:	49 8b 04 24          	mov    (%r12),%rax
+  80283e:	48 89 03             	mov    %rax,(%rbx)
+  802841:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802846:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80284a:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80284f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802853:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802858:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80285c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802860:	48 c1 e2 03          	shl    $0x3,%rdx
+  802864:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802869:	4c 89 f7             	mov    %r14,%rdi
+  80286c:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802878:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80287d:	48 83 c4 08          	add    $0x8,%rsp
+  802881:	5b                   	pop    %rbx
+  802882:	41 5c                	pop    %r12
+  802884:	41 5d                	pop    %r13
+  802886:	41 5e                	pop    %r14
+  802888:	41 5f                	pop    %r15
+  80288a:	5d                   	pop    %rbp
+  80288b:	c3                   	ret
+        return -E_INVAL;
+  80288c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802891:	eb ea                	jmp    80287d <devfile_diff_snapshots+0x11f>
+  802893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802898:	eb e3                	jmp    80287d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80289a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80289f:	eb dc                	jmp    80287d <devfile_diff_snapshots+0x11f>
+  8028a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a6:	eb d5                	jmp    80287d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8028a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028ad:	c3                   	ret
+
+00000000008028ae <devfile_delete_snapshot>:
+    if (!name) {
+  8028ae:	48 85 ff             	test   %rdi,%rdi
+  8028b1:	74 5f                	je     802912 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8028b3:	55                   	push   %rbp
+  8028b4:	48 89 e5             	mov    %rsp,%rbp
+  8028b7:	53                   	push   %rbx
+  8028b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028bc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8028bf:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8028c6:	00 00 00 
+  8028c9:	ff d0                	call   *%rax
+  8028cb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028d1:	77 45                	ja     802918 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8028d3:	48 89 de             	mov    %rbx,%rsi
+  8028d6:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8028dd:	00 00 00 
+  8028e0:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8028ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8028f6:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8028fd:	00 00 00 
+  802900:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802902:	85 c0                	test   %eax,%eax
+  802904:	ba 00 00 00 00       	mov    $0x0,%edx
+  802909:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80290c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+        return -E_INVAL;
+  802912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802917:	c3                   	ret
+        return -E_INVAL;
+  802918:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80291d:	eb ed                	jmp    80290c <devfile_delete_snapshot+0x5e>
+
+000000000080291f <devfile_accept_snapshot>:
+    if (!name) {
+  80291f:	48 85 ff             	test   %rdi,%rdi
+  802922:	74 5f                	je     802983 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802924:	55                   	push   %rbp
+  802925:	48 89 e5             	mov    %rsp,%rbp
+  802928:	53                   	push   %rbx
+  802929:	48 83 ec 08          	sub    $0x8,%rsp
+  80292d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802930:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802942:	77 45                	ja     802989 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802944:	48 89 de             	mov    %rbx,%rsi
+  802947:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80294e:	00 00 00 
+  802951:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80295d:	be 00 00 00 00       	mov    $0x0,%esi
+  802962:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802967:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802973:	85 c0                	test   %eax,%eax
+  802975:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80297d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+        return -E_INVAL;
+  802983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802988:	c3                   	ret
+        return -E_INVAL;
+  802989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80298e:	eb ed                	jmp    80297d <devfile_accept_snapshot+0x5e>
+
+0000000000802990 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802990:	48 85 ff             	test   %rdi,%rdi
+  802993:	0f 84 9f 00 00 00    	je     802a38 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802999:	55                   	push   %rbp
+  80299a:	48 89 e5             	mov    %rsp,%rbp
+  80299d:	41 54                	push   %r12
+  80299f:	53                   	push   %rbx
+  8029a0:	48 89 fb             	mov    %rdi,%rbx
+  8029a3:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8029a6:	48 85 f6             	test   %rsi,%rsi
+  8029a9:	74 78                	je     802a23 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8029ab:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+  8029b7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029bd:	77 6b                	ja     802a2a <devfile_create_snapshot+0x9a>
+  8029bf:	4c 89 e7             	mov    %r12,%rdi
+  8029c2:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+  8029ce:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029d4:	77 5b                	ja     802a31 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8029d6:	48 89 de             	mov    %rbx,%rsi
+  8029d9:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8029e0:	00 00 00 
+  8029e3:	48 bb ef 0c 80 00 00 	movabs $0x800cef,%rbx
+  8029ea:	00 00 00 
+  8029ed:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8029ef:	4c 89 e6             	mov    %r12,%rsi
+  8029f2:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8029f9:	00 00 00 
+  8029fc:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8029fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802a03:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a08:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a1e:	5b                   	pop    %rbx
+  802a1f:	41 5c                	pop    %r12
+  802a21:	5d                   	pop    %rbp
+  802a22:	c3                   	ret
+        return -E_INVAL;
+  802a23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a28:	eb f4                	jmp    802a1e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a2f:	eb ed                	jmp    802a1e <devfile_create_snapshot+0x8e>
+  802a31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a36:	eb e6                	jmp    802a1e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a3d:	c3                   	ret
+
+0000000000802a3e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a3e:	55                   	push   %rbp
+  802a3f:	48 89 e5             	mov    %rsp,%rbp
+  802a42:	41 54                	push   %r12
+  802a44:	53                   	push   %rbx
+  802a45:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a48:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a4b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802a52:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a54:	be 00 00 00 00       	mov    $0x0,%esi
+  802a59:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a5e:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	78 3d                	js     802aab <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a6e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802a75:	00 00 00 
+  802a78:	4c 89 e6             	mov    %r12,%rsi
+  802a7b:	48 89 df             	mov    %rbx,%rdi
+  802a7e:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802a85:	00 00 00 
+  802a88:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a8a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a91:	00 
+  802a92:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a98:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a9f:	00 
+  802aa0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aab:	5b                   	pop    %rbx
+  802aac:	41 5c                	pop    %r12
+  802aae:	5d                   	pop    %rbp
+  802aaf:	c3                   	ret
+
+0000000000802ab0 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802ab0:	55                   	push   %rbp
+  802ab1:	48 89 e5             	mov    %rsp,%rbp
+  802ab4:	41 57                	push   %r15
+  802ab6:	41 56                	push   %r14
+  802ab8:	41 55                	push   %r13
+  802aba:	41 54                	push   %r12
+  802abc:	53                   	push   %rbx
+  802abd:	48 83 ec 38          	sub    $0x38,%rsp
+  802ac1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802ac5:	49 89 f5             	mov    %rsi,%r13
+  802ac8:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802acb:	48 89 f0             	mov    %rsi,%rax
+  802ace:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ad3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ad7:	75 4f                	jne    802b28 <devfile_readmap+0x78>
+  802ad9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802add:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ae3:	75 1f                	jne    802b04 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802ae5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ae9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802aed:	49 be 98 32 80 00 00 	movabs $0x803298,%r14
+  802af4:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802af7:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802afe:	0f 87 9d 00 00 00    	ja     802ba1 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802b04:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b08:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802b0c:	4d 85 ff             	test   %r15,%r15
+  802b0f:	0f 85 cf 00 00 00    	jne    802be4 <devfile_readmap+0x134>
+  802b15:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802b19:	48 83 c4 38          	add    $0x38,%rsp
+  802b1d:	5b                   	pop    %rbx
+  802b1e:	41 5c                	pop    %r12
+  802b20:	41 5d                	pop    %r13
+  802b22:	41 5e                	pop    %r14
+  802b24:	41 5f                	pop    %r15
+  802b26:	5d                   	pop    %rbp
+  802b27:	c3                   	ret
+    size_t totalRead = 0;
+  802b28:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802b2f:	00 
+  802b30:	eb da                	jmp    802b0c <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b32:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b36:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b39:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802b40:	00 00 00 
+  802b43:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802b45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b49:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802b4d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b51:	4c 89 ee             	mov    %r13,%rsi
+  802b54:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b59:	48 b8 5e 22 80 00 00 	movabs $0x80225e,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	7e a3                	jle    802b0c <devfile_readmap+0x5c>
+  802b69:	48 98                	cltq
+  802b6b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b6f:	72 9b                	jb     802b0c <devfile_readmap+0x5c>
+        buf += read;
+  802b71:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802b74:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802b77:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b7b:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802b82:	75 88                	jne    802b0c <devfile_readmap+0x5c>
+  802b84:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b88:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b8e:	0f 85 78 ff ff ff    	jne    802b0c <devfile_readmap+0x5c>
+  802b94:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802b9b:	0f 86 6b ff ff ff    	jbe    802b0c <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802ba1:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802ba7:	4d 39 e7             	cmp    %r12,%r15
+  802baa:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802bae:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802bb5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bb9:	0f 84 73 ff ff ff    	je     802b32 <devfile_readmap+0x82>
+  802bbf:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802bc3:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802bc8:	41 ff d6             	call   *%r14
+  802bcb:	a8 40                	test   $0x40,%al
+  802bcd:	0f 85 39 ff ff ff    	jne    802b0c <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bd3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bda:	4c 39 e3             	cmp    %r12,%rbx
+  802bdd:	72 e4                	jb     802bc3 <devfile_readmap+0x113>
+  802bdf:	e9 4e ff ff ff       	jmp    802b32 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802be4:	4c 89 fa             	mov    %r15,%rdx
+  802be7:	4c 89 ee             	mov    %r13,%rsi
+  802bea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802bee:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802bfa:	48 85 c0             	test   %rax,%rax
+  802bfd:	78 0c                	js     802c0b <devfile_readmap+0x15b>
+    return totalRead + read;
+  802bff:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c03:	48 01 f0             	add    %rsi,%rax
+  802c06:	e9 0e ff ff ff       	jmp    802b19 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802c0b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c0f:	48 85 f6             	test   %rsi,%rsi
+  802c12:	48 0f 45 c6          	cmovne %rsi,%rax
+  802c16:	e9 fe fe ff ff       	jmp    802b19 <devfile_readmap+0x69>
+
+0000000000802c1b <open>:
+open(const char *path, int mode) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 55                	push   %r13
+  802c21:	41 54                	push   %r12
+  802c23:	53                   	push   %rbx
+  802c24:	48 83 ec 18          	sub    $0x18,%rsp
+  802c28:	49 89 fc             	mov    %rdi,%r12
+  802c2b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c2e:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+  802c3a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c40:	0f 87 8a 00 00 00    	ja     802cd0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c46:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c4a:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+  802c56:	89 c3                	mov    %eax,%ebx
+  802c58:	85 c0                	test   %eax,%eax
+  802c5a:	78 50                	js     802cac <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c5c:	4c 89 e6             	mov    %r12,%rsi
+  802c5f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802c66:	00 00 00 
+  802c69:	48 89 df             	mov    %rbx,%rdi
+  802c6c:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c78:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c7f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c83:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c88:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802c8f:	00 00 00 
+  802c92:	ff d0                	call   *%rax
+  802c94:	89 c3                	mov    %eax,%ebx
+  802c96:	85 c0                	test   %eax,%eax
+  802c98:	78 1f                	js     802cb9 <open+0x9e>
+    return fd2num(fd);
+  802c9a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c9e:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	89 c3                	mov    %eax,%ebx
+}
+  802cac:	89 d8                	mov    %ebx,%eax
+  802cae:	48 83 c4 18          	add    $0x18,%rsp
+  802cb2:	5b                   	pop    %rbx
+  802cb3:	41 5c                	pop    %r12
+  802cb5:	41 5d                	pop    %r13
+  802cb7:	5d                   	pop    %rbp
+  802cb8:	c3                   	ret
+        fd_close(fd, 0);
+  802cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cbe:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802cc2:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+        return res;
+  802cce:	eb dc                	jmp    802cac <open+0x91>
+        return -E_BAD_PATH;
+  802cd0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802cd5:	eb d5                	jmp    802cac <open+0x91>
+
+0000000000802cd7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce0:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ce5:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+}
+  802cf1:	5d                   	pop    %rbp
+  802cf2:	c3                   	ret
+
+0000000000802cf3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cf3:	55                   	push   %rbp
+  802cf4:	48 89 e5             	mov    %rsp,%rbp
+  802cf7:	41 54                	push   %r12
+  802cf9:	53                   	push   %rbx
+  802cfa:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cfd:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+  802d09:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802d0c:	48 be a0 3e 80 00 00 	movabs $0x803ea0,%rsi
+  802d13:	00 00 00 
+  802d16:	48 89 df             	mov    %rbx,%rdi
+  802d19:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802d25:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d2a:	41 2b 04 24          	sub    (%r12),%eax
+  802d2e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d34:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d3b:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d3e:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802d45:	00 00 00 
+  802d48:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d54:	5b                   	pop    %rbx
+  802d55:	41 5c                	pop    %r12
+  802d57:	5d                   	pop    %rbp
+  802d58:	c3                   	ret
+
+0000000000802d59 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d59:	55                   	push   %rbp
+  802d5a:	48 89 e5             	mov    %rsp,%rbp
+  802d5d:	41 54                	push   %r12
+  802d5f:	53                   	push   %rbx
+  802d60:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d68:	48 89 fe             	mov    %rdi,%rsi
+  802d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d70:	49 bc 47 14 80 00 00 	movabs $0x801447,%r12
+  802d77:	00 00 00 
+  802d7a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d7d:	48 89 df             	mov    %rbx,%rdi
+  802d80:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  802d87:	00 00 00 
+  802d8a:	ff d0                	call   *%rax
+  802d8c:	48 89 c6             	mov    %rax,%rsi
+  802d8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d99:	41 ff d4             	call   *%r12
+}
+  802d9c:	5b                   	pop    %rbx
+  802d9d:	41 5c                	pop    %r12
+  802d9f:	5d                   	pop    %rbp
+  802da0:	c3                   	ret
+
+0000000000802da1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802da1:	55                   	push   %rbp
+  802da2:	48 89 e5             	mov    %rsp,%rbp
+  802da5:	41 57                	push   %r15
+  802da7:	41 56                	push   %r14
+  802da9:	41 55                	push   %r13
+  802dab:	41 54                	push   %r12
+  802dad:	53                   	push   %rbx
+  802dae:	48 83 ec 18          	sub    $0x18,%rsp
+  802db2:	49 89 fc             	mov    %rdi,%r12
+  802db5:	49 89 f5             	mov    %rsi,%r13
+  802db8:	49 89 d7             	mov    %rdx,%r15
+  802dbb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802dbf:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802dcb:	4d 85 ff             	test   %r15,%r15
+  802dce:	0f 84 af 00 00 00    	je     802e83 <devpipe_write+0xe2>
+  802dd4:	48 89 c3             	mov    %rax,%rbx
+  802dd7:	4c 89 f8             	mov    %r15,%rax
+  802dda:	4d 89 ef             	mov    %r13,%r15
+  802ddd:	4c 01 e8             	add    %r13,%rax
+  802de0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802de4:	49 bd 4f 13 80 00 00 	movabs $0x80134f,%r13
+  802deb:	00 00 00 
+            sys_yield();
+  802dee:	49 be ec 12 80 00 00 	movabs $0x8012ec,%r14
+  802df5:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802df8:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dfb:	48 63 ce             	movslq %esi,%rcx
+  802dfe:	48 63 03             	movslq (%rbx),%rax
+  802e01:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e07:	48 39 c1             	cmp    %rax,%rcx
+  802e0a:	72 2e                	jb     802e3a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e0c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e11:	48 89 da             	mov    %rbx,%rdx
+  802e14:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e19:	4c 89 e7             	mov    %r12,%rdi
+  802e1c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	74 66                	je     802e89 <devpipe_write+0xe8>
+            sys_yield();
+  802e23:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e26:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e29:	48 63 ce             	movslq %esi,%rcx
+  802e2c:	48 63 03             	movslq (%rbx),%rax
+  802e2f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e35:	48 39 c1             	cmp    %rax,%rcx
+  802e38:	73 d2                	jae    802e0c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e3a:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e3e:	48 89 ca             	mov    %rcx,%rdx
+  802e41:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e45:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e4c:	08 10 20 
+  802e4f:	48 f7 e2             	mul    %rdx
+  802e52:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e56:	48 89 d0             	mov    %rdx,%rax
+  802e59:	48 c1 e0 09          	shl    $0x9,%rax
+  802e5d:	48 29 d0             	sub    %rdx,%rax
+  802e60:	48 c1 e0 03          	shl    $0x3,%rax
+  802e64:	48 29 c1             	sub    %rax,%rcx
+  802e67:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e6c:	83 c6 01             	add    $0x1,%esi
+  802e6f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e72:	49 83 c7 01          	add    $0x1,%r15
+  802e76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e7a:	49 39 c7             	cmp    %rax,%r15
+  802e7d:	0f 85 75 ff ff ff    	jne    802df8 <devpipe_write+0x57>
+    return n;
+  802e83:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e87:	eb 05                	jmp    802e8e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e8e:	48 83 c4 18          	add    $0x18,%rsp
+  802e92:	5b                   	pop    %rbx
+  802e93:	41 5c                	pop    %r12
+  802e95:	41 5d                	pop    %r13
+  802e97:	41 5e                	pop    %r14
+  802e99:	41 5f                	pop    %r15
+  802e9b:	5d                   	pop    %rbp
+  802e9c:	c3                   	ret
+
+0000000000802e9d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e9d:	55                   	push   %rbp
+  802e9e:	48 89 e5             	mov    %rsp,%rbp
+  802ea1:	41 57                	push   %r15
+  802ea3:	41 56                	push   %r14
+  802ea5:	41 55                	push   %r13
+  802ea7:	41 54                	push   %r12
+  802ea9:	53                   	push   %rbx
+  802eaa:	48 83 ec 18          	sub    $0x18,%rsp
+  802eae:	49 89 fc             	mov    %rdi,%r12
+  802eb1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802eb5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802eb9:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802ec8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ece:	49 bd 4f 13 80 00 00 	movabs $0x80134f,%r13
+  802ed5:	00 00 00 
+            sys_yield();
+  802ed8:	49 be ec 12 80 00 00 	movabs $0x8012ec,%r14
+  802edf:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ee2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ee7:	74 7d                	je     802f66 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ee9:	8b 03                	mov    (%rbx),%eax
+  802eeb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802eee:	75 26                	jne    802f16 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802ef0:	4d 85 ff             	test   %r15,%r15
+  802ef3:	75 77                	jne    802f6c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ef5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802efa:	48 89 da             	mov    %rbx,%rdx
+  802efd:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f02:	4c 89 e7             	mov    %r12,%rdi
+  802f05:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	74 72                	je     802f7e <devpipe_read+0xe1>
+            sys_yield();
+  802f0c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f0f:	8b 03                	mov    (%rbx),%eax
+  802f11:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f14:	74 df                	je     802ef5 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f16:	48 63 c8             	movslq %eax,%rcx
+  802f19:	48 89 ca             	mov    %rcx,%rdx
+  802f1c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f20:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802f27:	08 10 20 
+  802f2a:	48 89 d0             	mov    %rdx,%rax
+  802f2d:	48 f7 e6             	mul    %rsi
+  802f30:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f34:	48 89 d0             	mov    %rdx,%rax
+  802f37:	48 c1 e0 09          	shl    $0x9,%rax
+  802f3b:	48 29 d0             	sub    %rdx,%rax
+  802f3e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f45:	00 
+  802f46:	48 89 c8             	mov    %rcx,%rax
+  802f49:	48 29 d0             	sub    %rdx,%rax
+  802f4c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f51:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f55:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f59:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f5c:	49 83 c7 01          	add    $0x1,%r15
+  802f60:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f64:	75 83                	jne    802ee9 <devpipe_read+0x4c>
+    return n;
+  802f66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f6a:	eb 03                	jmp    802f6f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f6c:	4c 89 f8             	mov    %r15,%rax
+}
+  802f6f:	48 83 c4 18          	add    $0x18,%rsp
+  802f73:	5b                   	pop    %rbx
+  802f74:	41 5c                	pop    %r12
+  802f76:	41 5d                	pop    %r13
+  802f78:	41 5e                	pop    %r14
+  802f7a:	41 5f                	pop    %r15
+  802f7c:	5d                   	pop    %rbp
+  802f7d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f83:	eb ea                	jmp    802f6f <devpipe_read+0xd2>
+
+0000000000802f85 <pipe>:
+pipe(int pfd[2]) {
+  802f85:	55                   	push   %rbp
+  802f86:	48 89 e5             	mov    %rsp,%rbp
+  802f89:	41 55                	push   %r13
+  802f8b:	41 54                	push   %r12
+  802f8d:	53                   	push   %rbx
+  802f8e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f92:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f95:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f99:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+  802fa5:	89 c3                	mov    %eax,%ebx
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	0f 88 a0 01 00 00    	js     80314f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802faf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fb9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc2:	48 b8 7b 13 80 00 00 	movabs $0x80137b,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+  802fce:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	0f 88 77 01 00 00    	js     80314f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802fd8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802fdc:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  802fe3:	00 00 00 
+  802fe6:	ff d0                	call   *%rax
+  802fe8:	89 c3                	mov    %eax,%ebx
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	0f 88 43 01 00 00    	js     803135 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802ff2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ff7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ffc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803000:	bf 00 00 00 00       	mov    $0x0,%edi
+  803005:	48 b8 7b 13 80 00 00 	movabs $0x80137b,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+  803011:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803013:	85 c0                	test   %eax,%eax
+  803015:	0f 88 1a 01 00 00    	js     803135 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80301b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80301f:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  803026:	00 00 00 
+  803029:	ff d0                	call   *%rax
+  80302b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80302e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803033:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803038:	48 89 c6             	mov    %rax,%rsi
+  80303b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803040:	48 b8 7b 13 80 00 00 	movabs $0x80137b,%rax
+  803047:	00 00 00 
+  80304a:	ff d0                	call   *%rax
+  80304c:	89 c3                	mov    %eax,%ebx
+  80304e:	85 c0                	test   %eax,%eax
+  803050:	0f 88 c5 00 00 00    	js     80311b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803056:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80305a:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  803066:	48 89 c1             	mov    %rax,%rcx
+  803069:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80306f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307a:	4c 89 ee             	mov    %r13,%rsi
+  80307d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803082:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+  80308e:	89 c3                	mov    %eax,%ebx
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 6e                	js     803102 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803094:	be 00 10 00 00       	mov    $0x1000,%esi
+  803099:	4c 89 ef             	mov    %r13,%rdi
+  80309c:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+  8030a8:	83 f8 02             	cmp    $0x2,%eax
+  8030ab:	0f 85 ab 00 00 00    	jne    80315c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8030b1:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  8030b8:	00 00 
+  8030ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030be:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8030c0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030c4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8030cb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030cf:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8030d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030d5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8030dc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030e0:	48 bb 4b 17 80 00 00 	movabs $0x80174b,%rbx
+  8030e7:	00 00 00 
+  8030ea:	ff d3                	call   *%rbx
+  8030ec:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8030f0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8030f4:	ff d3                	call   *%rbx
+  8030f6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803100:	eb 4d                	jmp    80314f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803102:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803107:	4c 89 ee             	mov    %r13,%rsi
+  80310a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310f:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80311b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803120:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803124:	bf 00 00 00 00       	mov    $0x0,%edi
+  803129:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  803130:	00 00 00 
+  803133:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803135:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80313a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80313e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803143:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+}
+  80314f:	89 d8                	mov    %ebx,%eax
+  803151:	48 83 c4 18          	add    $0x18,%rsp
+  803155:	5b                   	pop    %rbx
+  803156:	41 5c                	pop    %r12
+  803158:	41 5d                	pop    %r13
+  80315a:	5d                   	pop    %rbp
+  80315b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80315c:	48 b9 d0 3e 80 00 00 	movabs $0x803ed0,%rcx
+  803163:	00 00 00 
+  803166:	48 ba a7 3e 80 00 00 	movabs $0x803ea7,%rdx
+  80316d:	00 00 00 
+  803170:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803175:	48 bf bc 3e 80 00 00 	movabs $0x803ebc,%rdi
+  80317c:	00 00 00 
+  80317f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803184:	49 b8 7a 02 80 00 00 	movabs $0x80027a,%r8
+  80318b:	00 00 00 
+  80318e:	41 ff d0             	call   *%r8
+
+0000000000803191 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803191:	55                   	push   %rbp
+  803192:	48 89 e5             	mov    %rsp,%rbp
+  803195:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803199:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80319d:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8031a4:	00 00 00 
+  8031a7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031a9:	85 c0                	test   %eax,%eax
+  8031ab:	78 35                	js     8031e2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8031ad:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031b1:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  8031b8:	00 00 00 
+  8031bb:	ff d0                	call   *%rax
+  8031bd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031c0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031ca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031ce:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  8031d5:	00 00 00 
+  8031d8:	ff d0                	call   *%rax
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 94 c0             	sete   %al
+  8031df:	0f b6 c0             	movzbl %al,%eax
+}
+  8031e2:	c9                   	leave
+  8031e3:	c3                   	ret
+
+00000000008031e4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031e4:	48 89 f8             	mov    %rdi,%rax
+  8031e7:	48 c1 e8 27          	shr    $0x27,%rax
+  8031eb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031f2:	01 00 00 
+  8031f5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031f9:	f6 c2 01             	test   $0x1,%dl
+  8031fc:	74 6d                	je     80326b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031fe:	48 89 f8             	mov    %rdi,%rax
+  803201:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803205:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80320c:	01 00 00 
+  80320f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803213:	f6 c2 01             	test   $0x1,%dl
+  803216:	74 62                	je     80327a <get_uvpt_entry+0x96>
+  803218:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80321f:	01 00 00 
+  803222:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803226:	f6 c2 80             	test   $0x80,%dl
+  803229:	75 4f                	jne    80327a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80322b:	48 89 f8             	mov    %rdi,%rax
+  80322e:	48 c1 e8 15          	shr    $0x15,%rax
+  803232:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803239:	01 00 00 
+  80323c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803240:	f6 c2 01             	test   $0x1,%dl
+  803243:	74 44                	je     803289 <get_uvpt_entry+0xa5>
+  803245:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80324c:	01 00 00 
+  80324f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803253:	f6 c2 80             	test   $0x80,%dl
+  803256:	75 31                	jne    803289 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803258:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80325c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803263:	01 00 00 
+  803266:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80326a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80326b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803272:	01 00 00 
+  803275:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803279:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80327a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803281:	01 00 00 
+  803284:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803288:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803289:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803290:	01 00 00 
+  803293:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803297:	c3                   	ret
+
+0000000000803298 <get_prot>:
+
+int
+get_prot(void *va) {
+  803298:	55                   	push   %rbp
+  803299:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80329c:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  8032a3:	00 00 00 
+  8032a6:	ff d0                	call   *%rax
+  8032a8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8032ab:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8032b0:	89 c1                	mov    %eax,%ecx
+  8032b2:	83 c9 04             	or     $0x4,%ecx
+  8032b5:	f6 c2 01             	test   $0x1,%dl
+  8032b8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8032bb:	89 c1                	mov    %eax,%ecx
+  8032bd:	83 c9 02             	or     $0x2,%ecx
+  8032c0:	f6 c2 02             	test   $0x2,%dl
+  8032c3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8032c6:	89 c1                	mov    %eax,%ecx
+  8032c8:	83 c9 01             	or     $0x1,%ecx
+  8032cb:	48 85 d2             	test   %rdx,%rdx
+  8032ce:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8032d1:	89 c1                	mov    %eax,%ecx
+  8032d3:	83 c9 40             	or     $0x40,%ecx
+  8032d6:	f6 c6 04             	test   $0x4,%dh
+  8032d9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032dc:	5d                   	pop    %rbp
+  8032dd:	c3                   	ret
+
+00000000008032de <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032de:	55                   	push   %rbp
+  8032df:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032e2:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8032ee:	48 c1 e8 06          	shr    $0x6,%rax
+  8032f2:	83 e0 01             	and    $0x1,%eax
+}
+  8032f5:	5d                   	pop    %rbp
+  8032f6:	c3                   	ret
+
+00000000008032f7 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8032f7:	55                   	push   %rbp
+  8032f8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032fb:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  803302:	00 00 00 
+  803305:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803307:	48 c1 e8 05          	shr    $0x5,%rax
+  80330b:	83 e0 01             	and    $0x1,%eax
+}
+  80330e:	5d                   	pop    %rbp
+  80330f:	c3                   	ret
+
+0000000000803310 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803310:	55                   	push   %rbp
+  803311:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803314:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  80331b:	00 00 00 
+  80331e:	ff d0                	call   *%rax
+  803320:	83 e0 01             	and    $0x1,%eax
+}
+  803323:	5d                   	pop    %rbp
+  803324:	c3                   	ret
+
+0000000000803325 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803325:	55                   	push   %rbp
+  803326:	48 89 e5             	mov    %rsp,%rbp
+  803329:	41 57                	push   %r15
+  80332b:	41 56                	push   %r14
+  80332d:	41 55                	push   %r13
+  80332f:	41 54                	push   %r12
+  803331:	53                   	push   %rbx
+  803332:	48 83 ec 18          	sub    $0x18,%rsp
+  803336:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80333a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80333e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803343:	49 bd 10 33 80 00 00 	movabs $0x803310,%r13
+  80334a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80334d:	49 bf 98 32 80 00 00 	movabs $0x803298,%r15
+  803354:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803357:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80335e:	00 00 00 
+  803361:	eb 0c                	jmp    80336f <foreach_shared_region+0x4a>
+  803363:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80336a:	4c 39 f3             	cmp    %r14,%rbx
+  80336d:	74 2e                	je     80339d <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80336f:	48 89 df             	mov    %rbx,%rdi
+  803372:	41 ff d5             	call   *%r13
+  803375:	84 c0                	test   %al,%al
+  803377:	74 ea                	je     803363 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803379:	48 89 df             	mov    %rbx,%rdi
+  80337c:	41 ff d7             	call   *%r15
+  80337f:	a8 40                	test   $0x40,%al
+  803381:	74 e0                	je     803363 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803383:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80338a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80338e:	48 89 df             	mov    %rbx,%rdi
+  803391:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803395:	ff d0                	call   *%rax
+				if (res < 0) {
+  803397:	85 c0                	test   %eax,%eax
+  803399:	79 c8                	jns    803363 <foreach_shared_region+0x3e>
+  80339b:	eb 05                	jmp    8033a2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80339d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a2:	48 83 c4 18          	add    $0x18,%rsp
+  8033a6:	5b                   	pop    %rbx
+  8033a7:	41 5c                	pop    %r12
+  8033a9:	41 5d                	pop    %r13
+  8033ab:	41 5e                	pop    %r14
+  8033ad:	41 5f                	pop    %r15
+  8033af:	5d                   	pop    %rbp
+  8033b0:	c3                   	ret
+
+00000000008033b1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8033b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b6:	c3                   	ret
+
+00000000008033b7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8033b7:	55                   	push   %rbp
+  8033b8:	48 89 e5             	mov    %rsp,%rbp
+  8033bb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8033be:	48 be f4 3e 80 00 00 	movabs $0x803ef4,%rsi
+  8033c5:	00 00 00 
+  8033c8:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8033cf:	00 00 00 
+  8033d2:	ff d0                	call   *%rax
+    return 0;
+}
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d9:	5d                   	pop    %rbp
+  8033da:	c3                   	ret
+
+00000000008033db <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8033db:	55                   	push   %rbp
+  8033dc:	48 89 e5             	mov    %rsp,%rbp
+  8033df:	41 57                	push   %r15
+  8033e1:	41 56                	push   %r14
+  8033e3:	41 55                	push   %r13
+  8033e5:	41 54                	push   %r12
+  8033e7:	53                   	push   %rbx
+  8033e8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8033ef:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8033f6:	48 85 d2             	test   %rdx,%rdx
+  8033f9:	74 7a                	je     803475 <devcons_write+0x9a>
+  8033fb:	49 89 d6             	mov    %rdx,%r14
+  8033fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803404:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803409:	49 bf e9 0e 80 00 00 	movabs $0x800ee9,%r15
+  803410:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803413:	4c 89 f3             	mov    %r14,%rbx
+  803416:	48 29 f3             	sub    %rsi,%rbx
+  803419:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80341e:	48 39 c3             	cmp    %rax,%rbx
+  803421:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803425:	4c 63 eb             	movslq %ebx,%r13
+  803428:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80342f:	48 01 c6             	add    %rax,%rsi
+  803432:	4c 89 ea             	mov    %r13,%rdx
+  803435:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80343c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80343f:	4c 89 ee             	mov    %r13,%rsi
+  803442:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803449:	48 b8 f2 11 80 00 00 	movabs $0x8011f2,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803455:	41 01 dc             	add    %ebx,%r12d
+  803458:	49 63 f4             	movslq %r12d,%rsi
+  80345b:	4c 39 f6             	cmp    %r14,%rsi
+  80345e:	72 b3                	jb     803413 <devcons_write+0x38>
+    return res;
+  803460:	49 63 c4             	movslq %r12d,%rax
+}
+  803463:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80346a:	5b                   	pop    %rbx
+  80346b:	41 5c                	pop    %r12
+  80346d:	41 5d                	pop    %r13
+  80346f:	41 5e                	pop    %r14
+  803471:	41 5f                	pop    %r15
+  803473:	5d                   	pop    %rbp
+  803474:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803475:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80347b:	eb e3                	jmp    803460 <devcons_write+0x85>
+
+000000000080347d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80347d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803480:	ba 00 00 00 00       	mov    $0x0,%edx
+  803485:	48 85 c0             	test   %rax,%rax
+  803488:	74 55                	je     8034df <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80348a:	55                   	push   %rbp
+  80348b:	48 89 e5             	mov    %rsp,%rbp
+  80348e:	41 55                	push   %r13
+  803490:	41 54                	push   %r12
+  803492:	53                   	push   %rbx
+  803493:	48 83 ec 08          	sub    $0x8,%rsp
+  803497:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80349a:	48 bb 1f 12 80 00 00 	movabs $0x80121f,%rbx
+  8034a1:	00 00 00 
+  8034a4:	49 bc ec 12 80 00 00 	movabs $0x8012ec,%r12
+  8034ab:	00 00 00 
+  8034ae:	eb 03                	jmp    8034b3 <devcons_read+0x36>
+  8034b0:	41 ff d4             	call   *%r12
+  8034b3:	ff d3                	call   *%rbx
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	74 f7                	je     8034b0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8034b9:	48 63 d0             	movslq %eax,%rdx
+  8034bc:	78 13                	js     8034d1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8034be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c3:	83 f8 04             	cmp    $0x4,%eax
+  8034c6:	74 09                	je     8034d1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8034c8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8034cc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8034d1:	48 89 d0             	mov    %rdx,%rax
+  8034d4:	48 83 c4 08          	add    $0x8,%rsp
+  8034d8:	5b                   	pop    %rbx
+  8034d9:	41 5c                	pop    %r12
+  8034db:	41 5d                	pop    %r13
+  8034dd:	5d                   	pop    %rbp
+  8034de:	c3                   	ret
+  8034df:	48 89 d0             	mov    %rdx,%rax
+  8034e2:	c3                   	ret
+
+00000000008034e3 <cputchar>:
+cputchar(int ch) {
+  8034e3:	55                   	push   %rbp
+  8034e4:	48 89 e5             	mov    %rsp,%rbp
+  8034e7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8034eb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8034ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8034f4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034f8:	48 b8 f2 11 80 00 00 	movabs $0x8011f2,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+}
+  803504:	c9                   	leave
+  803505:	c3                   	ret
+
+0000000000803506 <getchar>:
+getchar(void) {
+  803506:	55                   	push   %rbp
+  803507:	48 89 e5             	mov    %rsp,%rbp
+  80350a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80350e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803513:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351c:	48 b8 bc 1a 80 00 00 	movabs $0x801abc,%rax
+  803523:	00 00 00 
+  803526:	ff d0                	call   *%rax
+  803528:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80352a:	85 c0                	test   %eax,%eax
+  80352c:	78 06                	js     803534 <getchar+0x2e>
+  80352e:	74 08                	je     803538 <getchar+0x32>
+  803530:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803534:	89 d0                	mov    %edx,%eax
+  803536:	c9                   	leave
+  803537:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803538:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80353d:	eb f5                	jmp    803534 <getchar+0x2e>
+
+000000000080353f <iscons>:
+iscons(int fdnum) {
+  80353f:	55                   	push   %rbp
+  803540:	48 89 e5             	mov    %rsp,%rbp
+  803543:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803547:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80354b:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803557:	85 c0                	test   %eax,%eax
+  803559:	78 18                	js     803573 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80355b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80355f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803566:	00 00 00 
+  803569:	8b 00                	mov    (%rax),%eax
+  80356b:	39 02                	cmp    %eax,(%rdx)
+  80356d:	0f 94 c0             	sete   %al
+  803570:	0f b6 c0             	movzbl %al,%eax
+}
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+
+0000000000803575 <opencons>:
+opencons(void) {
+  803575:	55                   	push   %rbp
+  803576:	48 89 e5             	mov    %rsp,%rbp
+  803579:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80357d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803581:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+  80358d:	85 c0                	test   %eax,%eax
+  80358f:	78 49                	js     8035da <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803591:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803596:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80359b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80359f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035a4:	48 b8 7b 13 80 00 00 	movabs $0x80137b,%rax
+  8035ab:	00 00 00 
+  8035ae:	ff d0                	call   *%rax
+  8035b0:	85 c0                	test   %eax,%eax
+  8035b2:	78 26                	js     8035da <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8035b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035b8:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8035bf:	00 00 
+  8035c1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8035c3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035c7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8035ce:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  8035d5:	00 00 00 
+  8035d8:	ff d0                	call   *%rax
+}
+  8035da:	c9                   	leave
+  8035db:	c3                   	ret
+
+00000000008035dc <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8035dc:	55                   	push   %rbp
+  8035dd:	48 89 e5             	mov    %rsp,%rbp
+  8035e0:	41 55                	push   %r13
+  8035e2:	41 54                	push   %r12
+  8035e4:	53                   	push   %rbx
+  8035e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035e9:	49 89 fc             	mov    %rdi,%r12
+  8035ec:	48 89 f7             	mov    %rsi,%rdi
+  8035ef:	48 89 d3             	mov    %rdx,%rbx
+  8035f2:	49 89 cd             	mov    %rcx,%r13
+  8035f5:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035f8:	48 85 f6             	test   %rsi,%rsi
+  8035fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803602:	00 00 00 
+  803605:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803609:	be 00 10 00 00       	mov    $0x1000,%esi
+  80360e:	48 85 db             	test   %rbx,%rbx
+  803611:	74 03                	je     803616 <ipc_recv_timed+0x3a>
+  803613:	48 8b 33             	mov    (%rbx),%rsi
+  803616:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80361d:	00 00 00 
+  803620:	ff d0                	call   *%rax
+    if (res < 0) {
+  803622:	85 c0                	test   %eax,%eax
+  803624:	78 75                	js     80369b <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803626:	4d 85 e4             	test   %r12,%r12
+  803629:	74 14                	je     80363f <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80362b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803632:	00 00 00 
+  803635:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80363b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80363f:	4d 85 ed             	test   %r13,%r13
+  803642:	74 14                	je     803658 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803644:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80364b:	00 00 00 
+  80364e:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803654:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803658:	48 85 db             	test   %rbx,%rbx
+  80365b:	74 23                	je     803680 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80365d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803664:	00 00 00 
+  803667:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80366d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803672:	85 c9                	test   %ecx,%ecx
+  803674:	74 07                	je     80367d <ipc_recv_timed+0xa1>
+  803676:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80367d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803680:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803687:	00 00 00 
+  80368a:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803690:	48 83 c4 08          	add    $0x8,%rsp
+  803694:	5b                   	pop    %rbx
+  803695:	41 5c                	pop    %r12
+  803697:	41 5d                	pop    %r13
+  803699:	5d                   	pop    %rbp
+  80369a:	c3                   	ret
+        if (from_env_store != NULL) {
+  80369b:	4d 85 e4             	test   %r12,%r12
+  80369e:	74 08                	je     8036a8 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8036a0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8036a7:	00 
+        if (perm_store != NULL) {
+  8036a8:	4d 85 ed             	test   %r13,%r13
+  8036ab:	74 08                	je     8036b5 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8036ad:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8036b4:	00 
+        if (size != NULL) {
+  8036b5:	48 85 db             	test   %rbx,%rbx
+  8036b8:	74 d6                	je     803690 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8036ba:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8036c1:	eb cd                	jmp    803690 <ipc_recv_timed+0xb4>
+
+00000000008036c3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8036c3:	55                   	push   %rbp
+  8036c4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8036c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8036cd:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  8036d4:	00 00 00 
+  8036d7:	ff d0                	call   *%rax
+}
+  8036d9:	5d                   	pop    %rbp
+  8036da:	c3                   	ret
+
+00000000008036db <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8036db:	55                   	push   %rbp
+  8036dc:	48 89 e5             	mov    %rsp,%rbp
+  8036df:	41 57                	push   %r15
+  8036e1:	41 56                	push   %r14
+  8036e3:	41 55                	push   %r13
+  8036e5:	41 54                	push   %r12
+  8036e7:	53                   	push   %rbx
+  8036e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8036ec:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8036ef:	48 89 d3             	mov    %rdx,%rbx
+  8036f2:	49 89 cc             	mov    %rcx,%r12
+  8036f5:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8036f8:	48 85 d2             	test   %rdx,%rdx
+  8036fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803702:	00 00 00 
+  803705:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803709:	89 f0                	mov    %esi,%eax
+  80370b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80370f:	48 89 da             	mov    %rbx,%rdx
+  803712:	48 89 c6             	mov    %rax,%rsi
+  803715:	48 b8 e9 15 80 00 00 	movabs $0x8015e9,%rax
+  80371c:	00 00 00 
+  80371f:	ff d0                	call   *%rax
+    while (res < 0) {
+  803721:	85 c0                	test   %eax,%eax
+  803723:	79 65                	jns    80378a <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803725:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803728:	75 33                	jne    80375d <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80372a:	49 bf ec 12 80 00 00 	movabs $0x8012ec,%r15
+  803731:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803734:	49 be e9 15 80 00 00 	movabs $0x8015e9,%r14
+  80373b:	00 00 00 
+        sys_yield();
+  80373e:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803741:	45 89 e8             	mov    %r13d,%r8d
+  803744:	4c 89 e1             	mov    %r12,%rcx
+  803747:	48 89 da             	mov    %rbx,%rdx
+  80374a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80374e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803751:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803754:	85 c0                	test   %eax,%eax
+  803756:	79 32                	jns    80378a <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803758:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80375b:	74 e1                	je     80373e <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80375d:	89 c1                	mov    %eax,%ecx
+  80375f:	48 ba 00 3f 80 00 00 	movabs $0x803f00,%rdx
+  803766:	00 00 00 
+  803769:	be 52 00 00 00       	mov    $0x52,%esi
+  80376e:	48 bf 14 3f 80 00 00 	movabs $0x803f14,%rdi
+  803775:	00 00 00 
+  803778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377d:	49 b8 7a 02 80 00 00 	movabs $0x80027a,%r8
+  803784:	00 00 00 
+  803787:	41 ff d0             	call   *%r8
+    }
+}
+  80378a:	48 83 c4 18          	add    $0x18,%rsp
+  80378e:	5b                   	pop    %rbx
+  80378f:	41 5c                	pop    %r12
+  803791:	41 5d                	pop    %r13
+  803793:	41 5e                	pop    %r14
+  803795:	41 5f                	pop    %r15
+  803797:	5d                   	pop    %rbp
+  803798:	c3                   	ret
+
+0000000000803799 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803799:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80379e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8037a5:	00 00 00 
+  8037a8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8037ac:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8037b0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037b4:	48 01 ca             	add    %rcx,%rdx
+  8037b7:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8037bd:	39 fa                	cmp    %edi,%edx
+  8037bf:	74 12                	je     8037d3 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8037c1:	48 83 c0 01          	add    $0x1,%rax
+  8037c5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8037cb:	75 db                	jne    8037a8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8037cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037d2:	c3                   	ret
+            return envs[i].env_id;
+  8037d3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8037d7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8037db:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037df:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8037e6:	00 00 00 
+  8037e9:	48 01 d0             	add    %rdx,%rax
+  8037ec:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8037f2:	c3                   	ret
+  8037f3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008037f8 <__rodata_start>:
+  8037f8:	73 79                	jae    803873 <__rodata_start+0x7b>
+  8037fa:	73 5f                	jae    80385b <__rodata_start+0x63>
+  8037fc:	65 78 6f             	gs js  80386e <__rodata_start+0x76>
+  8037ff:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803801:	72 6b                	jb     80386e <__rodata_start+0x76>
+  803803:	3a 20                	cmp    (%rax),%ah
+  803805:	25 69 00 75 73       	and    $0x73750069,%eax
+  80380a:	65 72 2f             	gs jb  80383c <__rodata_start+0x44>
+  80380d:	64 75 6d             	fs jne 80387d <__rodata_start+0x85>
+  803810:	62 66 6f 72 6b       	(bad)
+  803815:	2e 63 00             	cs movsxd (%rax),%eax
+  803818:	73 79                	jae    803893 <__rodata_start+0x9b>
+  80381a:	73 5f                	jae    80387b <__rodata_start+0x83>
+  80381c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80381e:	76 5f                	jbe    80387f <__rodata_start+0x87>
+  803820:	73 65                	jae    803887 <__rodata_start+0x8f>
+  803822:	74 5f                	je     803883 <__rodata_start+0x8b>
+  803824:	73 74                	jae    80389a <__rodata_start+0xa2>
+  803826:	61                   	(bad)
+  803827:	74 75                	je     80389e <__rodata_start+0xa6>
+  803829:	73 3a                	jae    803865 <__rodata_start+0x6d>
+  80382b:	20 25 69 00 70 61    	and    %ah,0x61700069(%rip)        # 61f0389a <__bss_end+0x616fb89a>
+  803831:	72 65                	jb     803898 <__rodata_start+0xa0>
+  803833:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803834:	74 00                	je     803836 <__rodata_start+0x3e>
+  803836:	63 68 69             	movsxd 0x69(%rax),%ebp
+  803839:	6c                   	insb   (%dx),%es:(%rdi)
+  80383a:	64 00 25 64 3a 20 49 	add    %ah,%fs:0x49203a64(%rip)        # 49a072a5 <__bss_end+0x491ff2a5>
+  803841:	20 61 6d             	and    %ah,0x6d(%rcx)
+  803844:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803848:	20 25 73 21 0a 00    	and    %ah,0xa2173(%rip)        # 8a59c1 <__bss_end+0x9d9c1>
+  80384e:	3c 75                	cmp    $0x75,%al
+  803850:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803851:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803855:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803856:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  80385a:	30 38                	xor    %bh,(%rax)
+  80385c:	78 5d                	js     8038bb <__rodata_start+0xc3>
+  80385e:	20 75 73             	and    %dh,0x73(%rbp)
+  803861:	65 72 20             	gs jb  803884 <__rodata_start+0x8c>
+  803864:	70 61                	jo     8038c7 <__rodata_start+0xcf>
+  803866:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803867:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80386e:	73 20                	jae    803890 <__rodata_start+0x98>
+  803870:	61                   	(bad)
+  803871:	74 20                	je     803893 <__rodata_start+0x9b>
+  803873:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803878:	3a 20                	cmp    (%rax),%ah
+  80387a:	00 30                	add    %dh,(%rax)
+  80387c:	31 32                	xor    %esi,(%rdx)
+  80387e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803885:	41                   	rex.B
+  803886:	42                   	rex.X
+  803887:	43                   	rex.XB
+  803888:	44                   	rex.R
+  803889:	45                   	rex.RB
+  80388a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80388d:	31 32                	xor    %esi,(%rdx)
+  80388f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803896:	61                   	(bad)
+  803897:	62 63 64 65 66       	(bad)
+  80389c:	00 28                	add    %ch,(%rax)
+  80389e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80389f:	75 6c                	jne    80390d <__rodata_start+0x115>
+  8038a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8038a2:	29 00                	sub    %eax,(%rax)
+  8038a4:	65 72 72             	gs jb  803919 <__rodata_start+0x121>
+  8038a7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038a8:	72 20                	jb     8038ca <__rodata_start+0xd2>
+  8038aa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038af:	73 70                	jae    803921 <__rodata_start+0x129>
+  8038b1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038b5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8038bc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038bd:	72 00                	jb     8038bf <__rodata_start+0xc7>
+  8038bf:	62 61 64 20 65       	(bad)
+  8038c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c5:	76 69                	jbe    803930 <__rodata_start+0x138>
+  8038c7:	72 6f                	jb     803938 <__rodata_start+0x140>
+  8038c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038ca:	6d                   	insl   (%dx),%es:(%rdi)
+  8038cb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038cd:	74 00                	je     8038cf <__rodata_start+0xd7>
+  8038cf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038d6:	20 70 61             	and    %dh,0x61(%rax)
+  8038d9:	72 61                	jb     80393c <__rodata_start+0x144>
+  8038db:	6d                   	insl   (%dx),%es:(%rdi)
+  8038dc:	65 74 65             	gs je  803944 <__rodata_start+0x14c>
+  8038df:	72 00                	jb     8038e1 <__rodata_start+0xe9>
+  8038e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038e2:	75 74                	jne    803958 <__rodata_start+0x160>
+  8038e4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8038e7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8038ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8038eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ec:	72 79                	jb     803967 <__rodata_start+0x16f>
+  8038ee:	00 6f 75             	add    %ch,0x75(%rdi)
+  8038f1:	74 20                	je     803913 <__rodata_start+0x11b>
+  8038f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038f4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8038f8:	76 69                	jbe    803963 <__rodata_start+0x16b>
+  8038fa:	72 6f                	jb     80396b <__rodata_start+0x173>
+  8038fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038fd:	6d                   	insl   (%dx),%es:(%rdi)
+  8038fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803900:	74 73                	je     803975 <__rodata_start+0x17d>
+  803902:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803905:	72 72                	jb     803979 <__rodata_start+0x181>
+  803907:	75 70                	jne    803979 <__rodata_start+0x181>
+  803909:	74 65                	je     803970 <__rodata_start+0x178>
+  80390b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803910:	75 67                	jne    803979 <__rodata_start+0x181>
+  803912:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803915:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803917:	00 73 65             	add    %dh,0x65(%rbx)
+  80391a:	67 6d                	insl   (%dx),%es:(%edi)
+  80391c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80391e:	74 61                	je     803981 <__rodata_start+0x189>
+  803920:	74 69                	je     80398b <__rodata_start+0x193>
+  803922:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803923:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803924:	20 66 61             	and    %ah,0x61(%rsi)
+  803927:	75 6c                	jne    803995 <__rodata_start+0x19d>
+  803929:	74 00                	je     80392b <__rodata_start+0x133>
+  80392b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803932:	20 45 4c             	and    %al,0x4c(%rbp)
+  803935:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803939:	61                   	(bad)
+  80393a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80393f:	20 73 75             	and    %dh,0x75(%rbx)
+  803942:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803945:	73 79                	jae    8039c0 <__rodata_start+0x1c8>
+  803947:	73 74                	jae    8039bd <__rodata_start+0x1c5>
+  803949:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80394b:	20 63 61             	and    %ah,0x61(%rbx)
+  80394e:	6c                   	insb   (%dx),%es:(%rdi)
+  80394f:	6c                   	insb   (%dx),%es:(%rdi)
+  803950:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803953:	74 72                	je     8039c7 <__rodata_start+0x1cf>
+  803955:	79 20                	jns    803977 <__rodata_start+0x17f>
+  803957:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803958:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803959:	74 20                	je     80397b <__rodata_start+0x183>
+  80395b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80395d:	75 6e                	jne    8039cd <__rodata_start+0x1d5>
+  80395f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803963:	76 20                	jbe    803985 <__rodata_start+0x18d>
+  803965:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80396c:	72 65                	jb     8039d3 <__rodata_start+0x1db>
+  80396e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803971:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803972:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803976:	65 78 70             	gs js  8039e9 <__rodata_start+0x1f1>
+  803979:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80397e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803981:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803985:	20 66 69             	and    %ah,0x69(%rsi)
+  803988:	6c                   	insb   (%dx),%es:(%rdi)
+  803989:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80398d:	20 66 72             	and    %ah,0x72(%rsi)
+  803990:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803995:	61                   	(bad)
+  803996:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803999:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80399a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80399b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80399f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039a4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039a8:	79 20                	jns    8039ca <__rodata_start+0x1d2>
+  8039aa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039b1:	72 65                	jb     803a18 <__rodata_start+0x220>
+  8039b3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039b6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039b8:	00 66 69             	add    %ah,0x69(%rsi)
+  8039bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8039bc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8039c0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8039c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8039c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c9:	74 20                	je     8039eb <__rodata_start+0x1f3>
+  8039cb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039cd:	75 6e                	jne    803a3d <__rodata_start+0x245>
+  8039cf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8039d3:	76 61                	jbe    803a36 <__rodata_start+0x23e>
+  8039d5:	6c                   	insb   (%dx),%es:(%rdi)
+  8039d6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8039dd:	00 
+  8039de:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8039e5:	72 65                	jb     803a4c <__rodata_start+0x254>
+  8039e7:	61                   	(bad)
+  8039e8:	64 79 20             	fs jns 803a0b <__rodata_start+0x213>
+  8039eb:	65 78 69             	gs js  803a57 <__rodata_start+0x25f>
+  8039ee:	73 74                	jae    803a64 <__rodata_start+0x26c>
+  8039f0:	73 00                	jae    8039f2 <__rodata_start+0x1fa>
+  8039f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039f3:	70 65                	jo     803a5a <__rodata_start+0x262>
+  8039f5:	72 61                	jb     803a58 <__rodata_start+0x260>
+  8039f7:	74 69                	je     803a62 <__rodata_start+0x26a>
+  8039f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039fb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8039fe:	74 20                	je     803a20 <__rodata_start+0x228>
+  803a00:	73 75                	jae    803a77 <__rodata_start+0x27f>
+  803a02:	70 70                	jo     803a74 <__rodata_start+0x27c>
+  803a04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a05:	72 74                	jb     803a7b <__rodata_start+0x283>
+  803a07:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a0d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a12:	74 00                	je     803a14 <__rodata_start+0x21c>
+  803a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a1b:	00 00 00 
+  803a1e:	66 90                	xchg   %ax,%ax
+  803a20:	b7 05                	mov    $0x5,%bh
+  803a22:	80 00 00             	addb   $0x0,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 f8                	add    %bh,%al
+  803a29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a2f:	00 e8                	add    %ch,%al
+  803a31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a37:	00 f8                	add    %bh,%al
+  803a39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a3f:	00 f8                	add    %bh,%al
+  803a41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a47:	00 f8                	add    %bh,%al
+  803a49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a4f:	00 f8                	add    %bh,%al
+  803a51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a57:	00 d6                	add    %dl,%dh
+  803a59:	05 80 00 00 00       	add    $0x80,%eax
+  803a5e:	00 00                	add    %al,(%rax)
+  803a60:	f8                   	clc
+  803a61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a67:	00 f8                	add    %bh,%al
+  803a69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a6f:	00 ca                	add    %cl,%dl
+  803a71:	05 80 00 00 00       	add    $0x80,%eax
+  803a76:	00 00                	add    %al,(%rax)
+  803a78:	44 06                	rex.R (bad)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 f8                	add    %bh,%al
+  803a81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a87:	00 ca                	add    %cl,%dl
+  803a89:	05 80 00 00 00       	add    $0x80,%eax
+  803a8e:	00 00                	add    %al,(%rax)
+  803a90:	10 06                	adc    %al,(%rsi)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 10                	add    %dl,(%rax)
+  803a99:	06                   	(bad)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 10                	add    %dl,(%rax)
+  803aa1:	06                   	(bad)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 10                	add    %dl,(%rax)
+  803aa9:	06                   	(bad)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 10                	add    %dl,(%rax)
+  803ab1:	06                   	(bad)
+  803ab2:	80 00 00             	addb   $0x0,(%rax)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 10                	add    %dl,(%rax)
+  803ab9:	06                   	(bad)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 10                	add    %dl,(%rax)
+  803ac1:	06                   	(bad)
+  803ac2:	80 00 00             	addb   $0x0,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 10                	add    %dl,(%rax)
+  803ac9:	06                   	(bad)
+  803aca:	80 00 00             	addb   $0x0,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 10                	add    %dl,(%rax)
+  803ad1:	06                   	(bad)
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 f8                	add    %bh,%al
+  803ad9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803adf:	00 f8                	add    %bh,%al
+  803ae1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ae7:	00 f8                	add    %bh,%al
+  803ae9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803aef:	00 f8                	add    %bh,%al
+  803af1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803af7:	00 f8                	add    %bh,%al
+  803af9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803aff:	00 f8                	add    %bh,%al
+  803b01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b07:	00 f8                	add    %bh,%al
+  803b09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b0f:	00 f8                	add    %bh,%al
+  803b11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b17:	00 f8                	add    %bh,%al
+  803b19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b1f:	00 f8                	add    %bh,%al
+  803b21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b27:	00 f8                	add    %bh,%al
+  803b29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b2f:	00 f8                	add    %bh,%al
+  803b31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b37:	00 f8                	add    %bh,%al
+  803b39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b3f:	00 f8                	add    %bh,%al
+  803b41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b47:	00 f8                	add    %bh,%al
+  803b49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b4f:	00 f8                	add    %bh,%al
+  803b51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b57:	00 f8                	add    %bh,%al
+  803b59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b5f:	00 f8                	add    %bh,%al
+  803b61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b67:	00 f8                	add    %bh,%al
+  803b69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b6f:	00 f8                	add    %bh,%al
+  803b71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b77:	00 f8                	add    %bh,%al
+  803b79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b7f:	00 f8                	add    %bh,%al
+  803b81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b87:	00 f8                	add    %bh,%al
+  803b89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b8f:	00 f8                	add    %bh,%al
+  803b91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b97:	00 f8                	add    %bh,%al
+  803b99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b9f:	00 f8                	add    %bh,%al
+  803ba1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ba7:	00 f8                	add    %bh,%al
+  803ba9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803baf:	00 f8                	add    %bh,%al
+  803bb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bb7:	00 f8                	add    %bh,%al
+  803bb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bbf:	00 f8                	add    %bh,%al
+  803bc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bc7:	00 1b                	add    %bl,(%rbx)
+  803bc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bcf:	00 f8                	add    %bh,%al
+  803bd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bd7:	00 f8                	add    %bh,%al
+  803bd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bdf:	00 f8                	add    %bh,%al
+  803be1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803be7:	00 f8                	add    %bh,%al
+  803be9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bef:	00 f8                	add    %bh,%al
+  803bf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bf7:	00 f8                	add    %bh,%al
+  803bf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bff:	00 f8                	add    %bh,%al
+  803c01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c07:	00 f8                	add    %bh,%al
+  803c09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c0f:	00 f8                	add    %bh,%al
+  803c11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c17:	00 f8                	add    %bh,%al
+  803c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c1f:	00 67 06             	add    %ah,0x6(%rdi)
+  803c22:	80 00 00             	addb   $0x0,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 36                	add    %dh,(%rsi)
+  803c29:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803c2f:	00 f8                	add    %bh,%al
+  803c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c37:	00 f8                	add    %bh,%al
+  803c39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c3f:	00 f8                	add    %bh,%al
+  803c41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c47:	00 f8                	add    %bh,%al
+  803c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c4f:	00 96 06 80 00 00    	add    %dl,0x8006(%rsi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 f8                	add    %bh,%al
+  803c59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c5f:	00 f8                	add    %bh,%al
+  803c61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c67:	00 5c 06 80          	add    %bl,-0x80(%rsi,%rax,1)
+  803c6b:	00 00                	add    %al,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 f8                	add    %bh,%al
+  803c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c77:	00 f8                	add    %bh,%al
+  803c79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c7f:	00 de                	add    %bl,%dh
+  803c81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803c87:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 f8                	add    %bh,%al
+  803c91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c97:	00 f8                	add    %bh,%al
+  803c99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c9f:	00 2d 07 80 00 00    	add    %ch,0x8007(%rip)        # 80bcac <__bss_end+0x3cac>
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 f8                	add    %bh,%al
+  803ca9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803caf:	00 0a                	add    %cl,(%rdx)
+  803cb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803cb7:	00 f8                	add    %bh,%al
+  803cb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cbf:	00 f8                	add    %bh,%al
+  803cc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cc7:	00 1b                	add    %bl,(%rbx)
+  803cc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ccf:	00 f8                	add    %bh,%al
+  803cd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cd7:	00 c0                	add    %al,%al
+  803cd9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803ce0 <error_string>:
+	...
+  803ce8:	ad 38 80 00 00 00 00 00 bf 38 80 00 00 00 00 00     .8.......8......
+  803cf8:	cf 38 80 00 00 00 00 00 e1 38 80 00 00 00 00 00     .8.......8......
+  803d08:	ef 38 80 00 00 00 00 00 03 39 80 00 00 00 00 00     .8.......9......
+  803d18:	18 39 80 00 00 00 00 00 2b 39 80 00 00 00 00 00     .9......+9......
+  803d28:	3d 39 80 00 00 00 00 00 51 39 80 00 00 00 00 00     =9......Q9......
+  803d38:	61 39 80 00 00 00 00 00 74 39 80 00 00 00 00 00     a9......t9......
+  803d48:	8b 39 80 00 00 00 00 00 a1 39 80 00 00 00 00 00     .9.......9......
+  803d58:	b9 39 80 00 00 00 00 00 d1 39 80 00 00 00 00 00     .9.......9......
+  803d68:	de 39 80 00 00 00 00 00 88 3d 80 00 00 00 00 00     .9.......=......
+  803d78:	f2 39 80 00 00 00 00 00 0a 3a 80 00 00 00 00 00     .9.......:......
+  803d88:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d98:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803da8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803db8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803dc8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803dd8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803de8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803df8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803e08:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803e18:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803e28:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803e38:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803e48:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803e58:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803e68:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803e78:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803e80 <devtab>:
+  803e80:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803e90:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803ea0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803eb0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803ec0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803ed0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803ee0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803ef0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f00:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  803f10:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
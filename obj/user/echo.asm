@@ -0,0 +1,6685 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f0 00 00 00       	call   800113 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 25                	jg     800060 <umain+0x3b>
+        if (i > 1)
+            write(1, " ", 1);
+        write(1, argv[i], strlen(argv[i]));
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  80003b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800040:	48 be 1b 38 80 00 00 	movabs $0x80381b,%rsi
+  800047:	00 00 00 
+  80004a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004f:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+}
+  80005b:	e9 a4 00 00 00       	jmp    800104 <umain+0xdf>
+  800060:	41 89 fe             	mov    %edi,%r14d
+  800063:	49 89 f4             	mov    %rsi,%r12
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800066:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80006a:	48 be 60 37 80 00 00 	movabs $0x803760,%rsi
+  800071:	00 00 00 
+  800074:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+  800080:	85 c0                	test   %eax,%eax
+  800082:	75 30                	jne    8000b4 <umain+0x8f>
+        argc--;
+  800084:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  800088:	49 83 c4 08          	add    $0x8,%r12
+    for (i = 1; i < argc; i++) {
+  80008c:	41 83 fe 01          	cmp    $0x1,%r14d
+  800090:	7e 72                	jle    800104 <umain+0xdf>
+        nflag = 1;
+  800092:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  800099:	bb 01 00 00 00       	mov    $0x1,%ebx
+            write(1, " ", 1);
+  80009e:	49 bd e9 11 80 00 00 	movabs $0x8011e9,%r13
+  8000a5:	00 00 00 
+        write(1, argv[i], strlen(argv[i]));
+  8000a8:	49 bf e4 01 80 00 00 	movabs $0x8001e4,%r15
+  8000af:	00 00 00 
+  8000b2:	eb 28                	jmp    8000dc <umain+0xb7>
+    nflag = 0;
+  8000b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8000bb:	eb dc                	jmp    800099 <umain+0x74>
+        write(1, argv[i], strlen(argv[i]));
+  8000bd:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8000c1:	41 ff d7             	call   *%r15
+  8000c4:	48 89 c2             	mov    %rax,%rdx
+  8000c7:	49 8b 34 dc          	mov    (%r12,%rbx,8),%rsi
+  8000cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000d0:	41 ff d5             	call   *%r13
+    for (i = 1; i < argc; i++) {
+  8000d3:	48 83 c3 01          	add    $0x1,%rbx
+  8000d7:	41 39 de             	cmp    %ebx,%r14d
+  8000da:	7e 1e                	jle    8000fa <umain+0xd5>
+        if (i > 1)
+  8000dc:	83 fb 01             	cmp    $0x1,%ebx
+  8000df:	7e dc                	jle    8000bd <umain+0x98>
+            write(1, " ", 1);
+  8000e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000e6:	48 be 63 37 80 00 00 	movabs $0x803763,%rsi
+  8000ed:	00 00 00 
+  8000f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000f5:	41 ff d5             	call   *%r13
+  8000f8:	eb c3                	jmp    8000bd <umain+0x98>
+    if (!nflag)
+  8000fa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8000fe:	0f 84 37 ff ff ff    	je     80003b <umain+0x16>
+}
+  800104:	48 83 c4 18          	add    $0x18,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	41 5e                	pop    %r14
+  80010f:	41 5f                	pop    %r15
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+  800117:	41 56                	push   %r14
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	41 89 fd             	mov    %edi,%r13d
+  800121:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800124:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80012b:	00 00 00 
+  80012e:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800135:	00 00 00 
+  800138:	48 39 c2             	cmp    %rax,%rdx
+  80013b:	73 17                	jae    800154 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80013d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	49 89 c4             	mov    %rax,%r12
+  800143:	48 83 c3 08          	add    $0x8,%rbx
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	ff 53 f8             	call   *-0x8(%rbx)
+  80014f:	4c 39 e3             	cmp    %r12,%rbx
+  800152:	72 ef                	jb     800143 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800154:	48 b8 ee 07 80 00 00 	movabs $0x8007ee,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+  800160:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800165:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800169:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80016d:	48 c1 e0 04          	shl    $0x4,%rax
+  800171:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800178:	00 00 00 
+  80017b:	48 01 d0             	add    %rdx,%rax
+  80017e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800185:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800188:	45 85 ed             	test   %r13d,%r13d
+  80018b:	7e 0d                	jle    80019a <libmain+0x87>
+  80018d:	49 8b 06             	mov    (%r14),%rax
+  800190:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800197:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80019a:	4c 89 f6             	mov    %r14,%rsi
+  80019d:	44 89 ef             	mov    %r13d,%edi
+  8001a0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ac:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  8001b3:	00 00 00 
+  8001b6:	ff d0                	call   *%rax
+#endif
+}
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	41 5e                	pop    %r14
+  8001bf:	5d                   	pop    %rbp
+  8001c0:	c3                   	ret
+
+00000000008001c1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c1:	55                   	push   %rbp
+  8001c2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001c5:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d6:	48 b8 83 07 80 00 00 	movabs $0x800783,%rax
+  8001dd:	00 00 00 
+  8001e0:	ff d0                	call   *%rax
+}
+  8001e2:	5d                   	pop    %rbp
+  8001e3:	c3                   	ret
+
+00000000008001e4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8001e4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8001e7:	74 10                	je     8001f9 <strlen+0x15>
+    size_t n = 0;
+  8001e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8001ee:	48 83 c0 01          	add    $0x1,%rax
+  8001f2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8001f6:	75 f6                	jne    8001ee <strlen+0xa>
+  8001f8:	c3                   	ret
+    size_t n = 0;
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8001fe:	c3                   	ret
+
+00000000008001ff <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8001ff:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800202:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800207:	48 85 f6             	test   %rsi,%rsi
+  80020a:	74 11                	je     80021d <strnlen+0x1e>
+  80020c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800210:	74 0c                	je     80021e <strnlen+0x1f>
+  800212:	48 83 c2 01          	add    $0x1,%rdx
+  800216:	48 39 d0             	cmp    %rdx,%rax
+  800219:	75 f1                	jne    80020c <strnlen+0xd>
+  80021b:	eb 04                	jmp    800221 <strnlen+0x22>
+  80021d:	c3                   	ret
+  80021e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800221:	c3                   	ret
+
+0000000000800222 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800222:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80022e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800231:	48 83 c2 01          	add    $0x1,%rdx
+  800235:	84 c9                	test   %cl,%cl
+  800237:	75 f1                	jne    80022a <strcpy+0x8>
+        ;
+    return res;
+}
+  800239:	c3                   	ret
+
+000000000080023a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80023a:	55                   	push   %rbp
+  80023b:	48 89 e5             	mov    %rsp,%rbp
+  80023e:	41 54                	push   %r12
+  800240:	53                   	push   %rbx
+  800241:	48 89 fb             	mov    %rdi,%rbx
+  800244:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800247:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800253:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800257:	4c 89 e6             	mov    %r12,%rsi
+  80025a:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+    return dst;
+}
+  800266:	48 89 d8             	mov    %rbx,%rax
+  800269:	5b                   	pop    %rbx
+  80026a:	41 5c                	pop    %r12
+  80026c:	5d                   	pop    %rbp
+  80026d:	c3                   	ret
+
+000000000080026e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80026e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800271:	48 85 d2             	test   %rdx,%rdx
+  800274:	74 1f                	je     800295 <strncpy+0x27>
+  800276:	48 01 fa             	add    %rdi,%rdx
+  800279:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80027c:	48 83 c1 01          	add    $0x1,%rcx
+  800280:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800284:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800288:	41 80 f8 01          	cmp    $0x1,%r8b
+  80028c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800290:	48 39 ca             	cmp    %rcx,%rdx
+  800293:	75 e7                	jne    80027c <strncpy+0xe>
+    }
+    return ret;
+}
+  800295:	c3                   	ret
+
+0000000000800296 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800296:	48 89 f8             	mov    %rdi,%rax
+  800299:	48 85 d2             	test   %rdx,%rdx
+  80029c:	74 24                	je     8002c2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80029e:	48 83 ea 01          	sub    $0x1,%rdx
+  8002a2:	74 1b                	je     8002bf <strlcpy+0x29>
+  8002a4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8002a8:	0f b6 16             	movzbl (%rsi),%edx
+  8002ab:	84 d2                	test   %dl,%dl
+  8002ad:	74 10                	je     8002bf <strlcpy+0x29>
+            *dst++ = *src++;
+  8002af:	48 83 c6 01          	add    $0x1,%rsi
+  8002b3:	48 83 c0 01          	add    $0x1,%rax
+  8002b7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8002ba:	48 39 c8             	cmp    %rcx,%rax
+  8002bd:	75 e9                	jne    8002a8 <strlcpy+0x12>
+        *dst = '\0';
+  8002bf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8002c2:	48 29 f8             	sub    %rdi,%rax
+}
+  8002c5:	c3                   	ret
+
+00000000008002c6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8002c6:	0f b6 07             	movzbl (%rdi),%eax
+  8002c9:	84 c0                	test   %al,%al
+  8002cb:	74 13                	je     8002e0 <strcmp+0x1a>
+  8002cd:	38 06                	cmp    %al,(%rsi)
+  8002cf:	75 0f                	jne    8002e0 <strcmp+0x1a>
+  8002d1:	48 83 c7 01          	add    $0x1,%rdi
+  8002d5:	48 83 c6 01          	add    $0x1,%rsi
+  8002d9:	0f b6 07             	movzbl (%rdi),%eax
+  8002dc:	84 c0                	test   %al,%al
+  8002de:	75 ed                	jne    8002cd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8002e0:	0f b6 c0             	movzbl %al,%eax
+  8002e3:	0f b6 16             	movzbl (%rsi),%edx
+  8002e6:	29 d0                	sub    %edx,%eax
+}
+  8002e8:	c3                   	ret
+
+00000000008002e9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8002e9:	48 85 d2             	test   %rdx,%rdx
+  8002ec:	74 1f                	je     80030d <strncmp+0x24>
+  8002ee:	0f b6 07             	movzbl (%rdi),%eax
+  8002f1:	84 c0                	test   %al,%al
+  8002f3:	74 1e                	je     800313 <strncmp+0x2a>
+  8002f5:	3a 06                	cmp    (%rsi),%al
+  8002f7:	75 1a                	jne    800313 <strncmp+0x2a>
+  8002f9:	48 83 c7 01          	add    $0x1,%rdi
+  8002fd:	48 83 c6 01          	add    $0x1,%rsi
+  800301:	48 83 ea 01          	sub    $0x1,%rdx
+  800305:	75 e7                	jne    8002ee <strncmp+0x5>
+
+    if (!n) return 0;
+  800307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030c:	c3                   	ret
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	c3                   	ret
+  800313:	48 85 d2             	test   %rdx,%rdx
+  800316:	74 09                	je     800321 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800318:	0f b6 07             	movzbl (%rdi),%eax
+  80031b:	0f b6 16             	movzbl (%rsi),%edx
+  80031e:	29 d0                	sub    %edx,%eax
+  800320:	c3                   	ret
+    if (!n) return 0;
+  800321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800326:	c3                   	ret
+
+0000000000800327 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800327:	0f b6 17             	movzbl (%rdi),%edx
+  80032a:	84 d2                	test   %dl,%dl
+  80032c:	74 18                	je     800346 <strchr+0x1f>
+        if (*str == c) {
+  80032e:	0f be d2             	movsbl %dl,%edx
+  800331:	39 f2                	cmp    %esi,%edx
+  800333:	74 17                	je     80034c <strchr+0x25>
+    for (; *str; str++) {
+  800335:	48 83 c7 01          	add    $0x1,%rdi
+  800339:	0f b6 17             	movzbl (%rdi),%edx
+  80033c:	84 d2                	test   %dl,%dl
+  80033e:	75 ee                	jne    80032e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	c3                   	ret
+  800346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034b:	c3                   	ret
+  80034c:	48 89 f8             	mov    %rdi,%rax
+}
+  80034f:	c3                   	ret
+
+0000000000800350 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800350:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800353:	0f b6 17             	movzbl (%rdi),%edx
+  800356:	84 d2                	test   %dl,%dl
+  800358:	74 13                	je     80036d <strfind+0x1d>
+  80035a:	0f be d2             	movsbl %dl,%edx
+  80035d:	39 f2                	cmp    %esi,%edx
+  80035f:	74 0b                	je     80036c <strfind+0x1c>
+  800361:	48 83 c0 01          	add    $0x1,%rax
+  800365:	0f b6 10             	movzbl (%rax),%edx
+  800368:	84 d2                	test   %dl,%dl
+  80036a:	75 ee                	jne    80035a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80036c:	c3                   	ret
+  80036d:	c3                   	ret
+
+000000000080036e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80036e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800371:	48 89 f8             	mov    %rdi,%rax
+  800374:	48 f7 d8             	neg    %rax
+  800377:	83 e0 07             	and    $0x7,%eax
+  80037a:	49 89 d1             	mov    %rdx,%r9
+  80037d:	49 29 c1             	sub    %rax,%r9
+  800380:	78 36                	js     8003b8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800382:	40 0f b6 c6          	movzbl %sil,%eax
+  800386:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80038d:	01 01 01 
+  800390:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800394:	40 f6 c7 07          	test   $0x7,%dil
+  800398:	75 38                	jne    8003d2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80039a:	4c 89 c9             	mov    %r9,%rcx
+  80039d:	48 c1 f9 03          	sar    $0x3,%rcx
+  8003a1:	74 0c                	je     8003af <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8003a3:	fc                   	cld
+  8003a4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8003a7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8003ab:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8003af:	4d 85 c9             	test   %r9,%r9
+  8003b2:	75 45                	jne    8003f9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8003b4:	4c 89 c0             	mov    %r8,%rax
+  8003b7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8003b8:	48 85 d2             	test   %rdx,%rdx
+  8003bb:	74 f7                	je     8003b4 <memset+0x46>
+  8003bd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8003c0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8003c3:	48 83 c0 01          	add    $0x1,%rax
+  8003c7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8003cb:	48 39 c2             	cmp    %rax,%rdx
+  8003ce:	75 f3                	jne    8003c3 <memset+0x55>
+  8003d0:	eb e2                	jmp    8003b4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8003d2:	40 f6 c7 01          	test   $0x1,%dil
+  8003d6:	74 06                	je     8003de <memset+0x70>
+  8003d8:	88 07                	mov    %al,(%rdi)
+  8003da:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8003de:	40 f6 c7 02          	test   $0x2,%dil
+  8003e2:	74 07                	je     8003eb <memset+0x7d>
+  8003e4:	66 89 07             	mov    %ax,(%rdi)
+  8003e7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003eb:	40 f6 c7 04          	test   $0x4,%dil
+  8003ef:	74 a9                	je     80039a <memset+0x2c>
+  8003f1:	89 07                	mov    %eax,(%rdi)
+  8003f3:	48 83 c7 04          	add    $0x4,%rdi
+  8003f7:	eb a1                	jmp    80039a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003f9:	41 f6 c1 04          	test   $0x4,%r9b
+  8003fd:	74 06                	je     800405 <memset+0x97>
+  8003ff:	89 07                	mov    %eax,(%rdi)
+  800401:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800405:	41 f6 c1 02          	test   $0x2,%r9b
+  800409:	74 07                	je     800412 <memset+0xa4>
+  80040b:	66 89 07             	mov    %ax,(%rdi)
+  80040e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800412:	41 f6 c1 01          	test   $0x1,%r9b
+  800416:	74 9c                	je     8003b4 <memset+0x46>
+  800418:	88 07                	mov    %al,(%rdi)
+  80041a:	eb 98                	jmp    8003b4 <memset+0x46>
+
+000000000080041c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80041c:	48 89 f8             	mov    %rdi,%rax
+  80041f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800422:	48 39 fe             	cmp    %rdi,%rsi
+  800425:	73 3b                	jae    800462 <memmove+0x46>
+  800427:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80042b:	48 39 d7             	cmp    %rdx,%rdi
+  80042e:	73 32                	jae    800462 <memmove+0x46>
+        s += n;
+        d += n;
+  800430:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800434:	48 89 d6             	mov    %rdx,%rsi
+  800437:	48 09 fe             	or     %rdi,%rsi
+  80043a:	48 09 ce             	or     %rcx,%rsi
+  80043d:	40 f6 c6 07          	test   $0x7,%sil
+  800441:	75 12                	jne    800455 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800443:	48 83 ef 08          	sub    $0x8,%rdi
+  800447:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80044b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80044f:	fd                   	std
+  800450:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800453:	fc                   	cld
+  800454:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800455:	48 83 ef 01          	sub    $0x1,%rdi
+  800459:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80045d:	fd                   	std
+  80045e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800460:	eb f1                	jmp    800453 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800462:	48 89 f2             	mov    %rsi,%rdx
+  800465:	48 09 c2             	or     %rax,%rdx
+  800468:	48 09 ca             	or     %rcx,%rdx
+  80046b:	f6 c2 07             	test   $0x7,%dl
+  80046e:	75 0c                	jne    80047c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800470:	48 c1 e9 03          	shr    $0x3,%rcx
+  800474:	48 89 c7             	mov    %rax,%rdi
+  800477:	fc                   	cld
+  800478:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80047b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80047c:	48 89 c7             	mov    %rax,%rdi
+  80047f:	fc                   	cld
+  800480:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800482:	c3                   	ret
+
+0000000000800483 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800483:	55                   	push   %rbp
+  800484:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800487:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  80048e:	00 00 00 
+  800491:	ff d0                	call   *%rax
+}
+  800493:	5d                   	pop    %rbp
+  800494:	c3                   	ret
+
+0000000000800495 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800495:	55                   	push   %rbp
+  800496:	48 89 e5             	mov    %rsp,%rbp
+  800499:	41 57                	push   %r15
+  80049b:	41 56                	push   %r14
+  80049d:	41 55                	push   %r13
+  80049f:	41 54                	push   %r12
+  8004a1:	53                   	push   %rbx
+  8004a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a6:	49 89 fe             	mov    %rdi,%r14
+  8004a9:	49 89 f7             	mov    %rsi,%r15
+  8004ac:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8004af:	48 89 f7             	mov    %rsi,%rdi
+  8004b2:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  8004b9:	00 00 00 
+  8004bc:	ff d0                	call   *%rax
+  8004be:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8004c1:	48 89 de             	mov    %rbx,%rsi
+  8004c4:	4c 89 f7             	mov    %r14,%rdi
+  8004c7:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  8004ce:	00 00 00 
+  8004d1:	ff d0                	call   *%rax
+  8004d3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8004d6:	48 39 c3             	cmp    %rax,%rbx
+  8004d9:	74 36                	je     800511 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8004db:	48 89 d8             	mov    %rbx,%rax
+  8004de:	4c 29 e8             	sub    %r13,%rax
+  8004e1:	49 39 c4             	cmp    %rax,%r12
+  8004e4:	73 31                	jae    800517 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8004e6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8004eb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8004ef:	4c 89 fe             	mov    %r15,%rsi
+  8004f2:	48 b8 83 04 80 00 00 	movabs $0x800483,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8004fe:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800502:	48 83 c4 08          	add    $0x8,%rsp
+  800506:	5b                   	pop    %rbx
+  800507:	41 5c                	pop    %r12
+  800509:	41 5d                	pop    %r13
+  80050b:	41 5e                	pop    %r14
+  80050d:	41 5f                	pop    %r15
+  80050f:	5d                   	pop    %rbp
+  800510:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800511:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800515:	eb eb                	jmp    800502 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800517:	48 83 eb 01          	sub    $0x1,%rbx
+  80051b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80051f:	48 89 da             	mov    %rbx,%rdx
+  800522:	4c 89 fe             	mov    %r15,%rsi
+  800525:	48 b8 83 04 80 00 00 	movabs $0x800483,%rax
+  80052c:	00 00 00 
+  80052f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800531:	49 01 de             	add    %rbx,%r14
+  800534:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800539:	eb c3                	jmp    8004fe <strlcat+0x69>
+
+000000000080053b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80053b:	48 85 d2             	test   %rdx,%rdx
+  80053e:	74 2d                	je     80056d <memcmp+0x32>
+  800540:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800545:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800549:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80054e:	44 38 c1             	cmp    %r8b,%cl
+  800551:	75 0f                	jne    800562 <memcmp+0x27>
+    while (n-- > 0) {
+  800553:	48 83 c0 01          	add    $0x1,%rax
+  800557:	48 39 c2             	cmp    %rax,%rdx
+  80055a:	75 e9                	jne    800545 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80055c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800561:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800562:	0f b6 c1             	movzbl %cl,%eax
+  800565:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800569:	44 29 c0             	sub    %r8d,%eax
+  80056c:	c3                   	ret
+    return 0;
+  80056d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800572:	c3                   	ret
+
+0000000000800573 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800573:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800577:	48 39 c7             	cmp    %rax,%rdi
+  80057a:	73 0f                	jae    80058b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80057c:	40 38 37             	cmp    %sil,(%rdi)
+  80057f:	74 0e                	je     80058f <memfind+0x1c>
+    for (; src < end; src++) {
+  800581:	48 83 c7 01          	add    $0x1,%rdi
+  800585:	48 39 f8             	cmp    %rdi,%rax
+  800588:	75 f2                	jne    80057c <memfind+0x9>
+  80058a:	c3                   	ret
+  80058b:	48 89 f8             	mov    %rdi,%rax
+  80058e:	c3                   	ret
+  80058f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800592:	c3                   	ret
+
+0000000000800593 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800593:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800596:	0f b6 37             	movzbl (%rdi),%esi
+  800599:	40 80 fe 20          	cmp    $0x20,%sil
+  80059d:	74 06                	je     8005a5 <strtol+0x12>
+  80059f:	40 80 fe 09          	cmp    $0x9,%sil
+  8005a3:	75 13                	jne    8005b8 <strtol+0x25>
+  8005a5:	48 83 c7 01          	add    $0x1,%rdi
+  8005a9:	0f b6 37             	movzbl (%rdi),%esi
+  8005ac:	40 80 fe 20          	cmp    $0x20,%sil
+  8005b0:	74 f3                	je     8005a5 <strtol+0x12>
+  8005b2:	40 80 fe 09          	cmp    $0x9,%sil
+  8005b6:	74 ed                	je     8005a5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8005b8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8005bb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8005be:	3c 01                	cmp    $0x1,%al
+  8005c0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005c4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8005ca:	75 0f                	jne    8005db <strtol+0x48>
+  8005cc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8005cf:	74 14                	je     8005e5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8005d1:	85 d2                	test   %edx,%edx
+  8005d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8005d8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8005db:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8005e0:	4c 63 ca             	movslq %edx,%r9
+  8005e3:	eb 36                	jmp    80061b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005e5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8005e9:	74 0f                	je     8005fa <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8005eb:	85 d2                	test   %edx,%edx
+  8005ed:	75 ec                	jne    8005db <strtol+0x48>
+        s++;
+  8005ef:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8005f3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8005f8:	eb e1                	jmp    8005db <strtol+0x48>
+        s += 2;
+  8005fa:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8005fe:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800603:	eb d6                	jmp    8005db <strtol+0x48>
+            dig -= '0';
+  800605:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800608:	44 0f b6 c1          	movzbl %cl,%r8d
+  80060c:	41 39 d0             	cmp    %edx,%r8d
+  80060f:	7d 21                	jge    800632 <strtol+0x9f>
+        val = val * base + dig;
+  800611:	49 0f af c1          	imul   %r9,%rax
+  800615:	0f b6 c9             	movzbl %cl,%ecx
+  800618:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80061b:	48 83 c7 01          	add    $0x1,%rdi
+  80061f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800623:	80 f9 39             	cmp    $0x39,%cl
+  800626:	76 dd                	jbe    800605 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800628:	80 f9 7b             	cmp    $0x7b,%cl
+  80062b:	77 05                	ja     800632 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80062d:	83 e9 57             	sub    $0x57,%ecx
+  800630:	eb d6                	jmp    800608 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800632:	4d 85 d2             	test   %r10,%r10
+  800635:	74 03                	je     80063a <strtol+0xa7>
+  800637:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80063a:	48 89 c2             	mov    %rax,%rdx
+  80063d:	48 f7 da             	neg    %rdx
+  800640:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800644:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800648:	c3                   	ret
+
+0000000000800649 <strrev>:
+
+void
+strrev(char *str)
+{
+  800649:	55                   	push   %rbp
+  80064a:	48 89 e5             	mov    %rsp,%rbp
+  80064d:	53                   	push   %rbx
+  80064e:	48 83 ec 08          	sub    $0x8,%rsp
+  800652:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800655:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  80065c:	00 00 00 
+  80065f:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800661:	83 e8 01             	sub    $0x1,%eax
+  800664:	85 c0                	test   %eax,%eax
+  800666:	7e 22                	jle    80068a <strrev+0x41>
+  800668:	48 98                	cltq
+  80066a:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80066f:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800673:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800677:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80067b:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80067e:	48 83 c2 01          	add    $0x1,%rdx
+  800682:	48 83 e8 01          	sub    $0x1,%rax
+  800686:	39 c2                	cmp    %eax,%edx
+  800688:	7c e5                	jl     80066f <strrev+0x26>
+	}
+}
+  80068a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80068e:	c9                   	leave
+  80068f:	c3                   	ret
+
+0000000000800690 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800690:	85 d2                	test   %edx,%edx
+  800692:	0f 84 80 00 00 00    	je     800718 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800698:	55                   	push   %rbp
+  800699:	48 89 e5             	mov    %rsp,%rbp
+  80069c:	53                   	push   %rbx
+  80069d:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a1:	49 89 f2             	mov    %rsi,%r10
+  8006a4:	41 89 d3             	mov    %edx,%r11d
+  8006a7:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8006aa:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8006af:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8006b2:	eb 20                	jmp    8006d4 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8006b4:	41 89 f1             	mov    %esi,%r9d
+  8006b7:	83 c2 30             	add    $0x30,%edx
+  8006ba:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8006bd:	89 f8                	mov    %edi,%eax
+  8006bf:	99                   	cltd
+  8006c0:	f7 f9                	idiv   %ecx
+  8006c2:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8006c4:	85 c0                	test   %eax,%eax
+  8006c6:	74 2e                	je     8006f6 <itoa+0x66>
+  8006c8:	83 c6 01             	add    $0x1,%esi
+  8006cb:	49 83 c0 01          	add    $0x1,%r8
+  8006cf:	44 39 cb             	cmp    %r9d,%ebx
+  8006d2:	7e 15                	jle    8006e9 <itoa+0x59>
+		digit = sum % base;
+  8006d4:	89 f8                	mov    %edi,%eax
+  8006d6:	99                   	cltd
+  8006d7:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8006d9:	83 fa 09             	cmp    $0x9,%edx
+  8006dc:	7e d6                	jle    8006b4 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8006de:	41 89 f1             	mov    %esi,%r9d
+  8006e1:	83 c2 37             	add    $0x37,%edx
+  8006e4:	41 88 10             	mov    %dl,(%r8)
+  8006e7:	eb d4                	jmp    8006bd <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8006e9:	41 83 eb 01          	sub    $0x1,%r11d
+  8006ed:	45 39 cb             	cmp    %r9d,%r11d
+  8006f0:	75 04                	jne    8006f6 <itoa+0x66>
+  8006f2:	85 c0                	test   %eax,%eax
+  8006f4:	75 28                	jne    80071e <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8006f6:	4d 63 c9             	movslq %r9d,%r9
+  8006f9:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8006fe:	4c 89 d7             	mov    %r10,%rdi
+  800701:	48 b8 49 06 80 00 00 	movabs $0x800649,%rax
+  800708:	00 00 00 
+  80070b:	ff d0                	call   *%rax
+	return 0;
+  80070d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800712:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800716:	c9                   	leave
+  800717:	c3                   	ret
+		return -1;
+  800718:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80071d:	c3                   	ret
+		return -1;
+  80071e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800723:	eb ed                	jmp    800712 <itoa+0x82>
+
+0000000000800725 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800725:	55                   	push   %rbp
+  800726:	48 89 e5             	mov    %rsp,%rbp
+  800729:	53                   	push   %rbx
+  80072a:	48 89 fa             	mov    %rdi,%rdx
+  80072d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800730:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800735:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80073f:	be 00 00 00 00       	mov    $0x0,%esi
+  800744:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80074a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80074c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800750:	c9                   	leave
+  800751:	c3                   	ret
+
+0000000000800752 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800752:	55                   	push   %rbp
+  800753:	48 89 e5             	mov    %rsp,%rbp
+  800756:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800757:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80075c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800761:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80076b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800770:	be 00 00 00 00       	mov    $0x0,%esi
+  800775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80077b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80077d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+0000000000800783 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800783:	55                   	push   %rbp
+  800784:	48 89 e5             	mov    %rsp,%rbp
+  800787:	53                   	push   %rbx
+  800788:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80078c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80078f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800794:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80079e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007b0:	48 85 c0             	test   %rax,%rax
+  8007b3:	7f 06                	jg     8007bb <sys_env_destroy+0x38>
+}
+  8007b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007b9:	c9                   	leave
+  8007ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007bb:	49 89 c0             	mov    %rax,%r8
+  8007be:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8007c3:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8007ca:	00 00 00 
+  8007cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8007d2:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8007d9:	00 00 00 
+  8007dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e1:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  8007e8:	00 00 00 
+  8007eb:	41 ff d1             	call   *%r9
+
+00000000008007ee <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8007ee:	55                   	push   %rbp
+  8007ef:	48 89 e5             	mov    %rsp,%rbp
+  8007f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8007f3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800802:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800807:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80080c:	be 00 00 00 00       	mov    $0x0,%esi
+  800811:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800817:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800819:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80081d:	c9                   	leave
+  80081e:	c3                   	ret
+
+000000000080081f <sys_yield>:
+
+void
+sys_yield(void) {
+  80081f:	55                   	push   %rbp
+  800820:	48 89 e5             	mov    %rsp,%rbp
+  800823:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800824:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80082e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800833:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800838:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80083d:	be 00 00 00 00       	mov    $0x0,%esi
+  800842:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800848:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80084a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80084e:	c9                   	leave
+  80084f:	c3                   	ret
+
+0000000000800850 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800850:	55                   	push   %rbp
+  800851:	48 89 e5             	mov    %rsp,%rbp
+  800854:	53                   	push   %rbx
+  800855:	48 89 fa             	mov    %rdi,%rdx
+  800858:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80085b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800860:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800867:	00 00 00 
+  80086a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80086f:	be 00 00 00 00       	mov    $0x0,%esi
+  800874:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80087a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80087c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+0000000000800882 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800882:	55                   	push   %rbp
+  800883:	48 89 e5             	mov    %rsp,%rbp
+  800886:	53                   	push   %rbx
+  800887:	49 89 f8             	mov    %rdi,%r8
+  80088a:	48 89 d3             	mov    %rdx,%rbx
+  80088d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800890:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800895:	4c 89 c2             	mov    %r8,%rdx
+  800898:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80089b:	be 00 00 00 00       	mov    $0x0,%esi
+  8008a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008a6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8008a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ac:	c9                   	leave
+  8008ad:	c3                   	ret
+
+00000000008008ae <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8008ae:	55                   	push   %rbp
+  8008af:	48 89 e5             	mov    %rsp,%rbp
+  8008b2:	53                   	push   %rbx
+  8008b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b7:	89 f8                	mov    %edi,%eax
+  8008b9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8008bc:	48 63 f9             	movslq %ecx,%rdi
+  8008bf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008c2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8008cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008d7:	48 85 c0             	test   %rax,%rax
+  8008da:	7f 06                	jg     8008e2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8008dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008e0:	c9                   	leave
+  8008e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008e2:	49 89 c0             	mov    %rax,%r8
+  8008e5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8008ea:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8008f1:	00 00 00 
+  8008f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8008f9:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800900:	00 00 00 
+  800903:	b8 00 00 00 00       	mov    $0x0,%eax
+  800908:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  80090f:	00 00 00 
+  800912:	41 ff d1             	call   *%r9
+
+0000000000800915 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800915:	55                   	push   %rbp
+  800916:	48 89 e5             	mov    %rsp,%rbp
+  800919:	53                   	push   %rbx
+  80091a:	48 83 ec 08          	sub    $0x8,%rsp
+  80091e:	89 f8                	mov    %edi,%eax
+  800920:	49 89 f2             	mov    %rsi,%r10
+  800923:	48 89 cf             	mov    %rcx,%rdi
+  800926:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800929:	48 63 da             	movslq %edx,%rbx
+  80092c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80092f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800934:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800937:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80093a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80093c:	48 85 c0             	test   %rax,%rax
+  80093f:	7f 06                	jg     800947 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800941:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800945:	c9                   	leave
+  800946:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800947:	49 89 c0             	mov    %rax,%r8
+  80094a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80094f:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  800956:	00 00 00 
+  800959:	be 26 00 00 00       	mov    $0x26,%esi
+  80095e:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800965:	00 00 00 
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  800974:	00 00 00 
+  800977:	41 ff d1             	call   *%r9
+
+000000000080097a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80097a:	55                   	push   %rbp
+  80097b:	48 89 e5             	mov    %rsp,%rbp
+  80097e:	53                   	push   %rbx
+  80097f:	48 83 ec 08          	sub    $0x8,%rsp
+  800983:	48 89 f1             	mov    %rsi,%rcx
+  800986:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800989:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80098c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800991:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800996:	be 00 00 00 00       	mov    $0x0,%esi
+  80099b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8009a3:	48 85 c0             	test   %rax,%rax
+  8009a6:	7f 06                	jg     8009ae <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8009a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009ac:	c9                   	leave
+  8009ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8009ae:	49 89 c0             	mov    %rax,%r8
+  8009b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8009b6:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8009bd:	00 00 00 
+  8009c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8009c5:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8009cc:	00 00 00 
+  8009cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d4:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  8009db:	00 00 00 
+  8009de:	41 ff d1             	call   *%r9
+
+00000000008009e1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8009e1:	55                   	push   %rbp
+  8009e2:	48 89 e5             	mov    %rsp,%rbp
+  8009e5:	53                   	push   %rbx
+  8009e6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8009ea:	48 63 ce             	movslq %esi,%rcx
+  8009ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8009f0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800a04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a0a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a0c:	48 85 c0             	test   %rax,%rax
+  800a0f:	7f 06                	jg     800a17 <sys_env_set_status+0x36>
+}
+  800a11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a15:	c9                   	leave
+  800a16:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a17:	49 89 c0             	mov    %rax,%r8
+  800a1a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800a1f:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  800a26:	00 00 00 
+  800a29:	be 26 00 00 00       	mov    $0x26,%esi
+  800a2e:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800a35:	00 00 00 
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  800a44:	00 00 00 
+  800a47:	41 ff d1             	call   *%r9
+
+0000000000800a4a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	53                   	push   %rbx
+  800a4f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a53:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800a56:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800a59:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a68:	be 00 00 00 00       	mov    $0x0,%esi
+  800a6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a73:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a75:	48 85 c0             	test   %rax,%rax
+  800a78:	7f 06                	jg     800a80 <sys_env_set_trapframe+0x36>
+}
+  800a7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a80:	49 89 c0             	mov    %rax,%r8
+  800a83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800a88:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  800a8f:	00 00 00 
+  800a92:	be 26 00 00 00       	mov    $0x26,%esi
+  800a97:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800a9e:	00 00 00 
+  800aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa6:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  800aad:	00 00 00 
+  800ab0:	41 ff d1             	call   *%r9
+
+0000000000800ab3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ab3:	55                   	push   %rbp
+  800ab4:	48 89 e5             	mov    %rsp,%rbp
+  800ab7:	53                   	push   %rbx
+  800ab8:	48 83 ec 08          	sub    $0x8,%rsp
+  800abc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800abf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ac2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ac7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800acc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ad1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ad6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800adc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800ade:	48 85 c0             	test   %rax,%rax
+  800ae1:	7f 06                	jg     800ae9 <sys_env_set_pgfault_upcall+0x36>
+}
+  800ae3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ae7:	c9                   	leave
+  800ae8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ae9:	49 89 c0             	mov    %rax,%r8
+  800aec:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800af1:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  800af8:	00 00 00 
+  800afb:	be 26 00 00 00       	mov    $0x26,%esi
+  800b00:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800b07:	00 00 00 
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0f:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  800b16:	00 00 00 
+  800b19:	41 ff d1             	call   *%r9
+
+0000000000800b1c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800b1c:	55                   	push   %rbp
+  800b1d:	48 89 e5             	mov    %rsp,%rbp
+  800b20:	53                   	push   %rbx
+  800b21:	89 f8                	mov    %edi,%eax
+  800b23:	49 89 f1             	mov    %rsi,%r9
+  800b26:	48 89 d3             	mov    %rdx,%rbx
+  800b29:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800b2c:	49 63 f0             	movslq %r8d,%rsi
+  800b2f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b32:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b37:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b40:	cd 30                	int    $0x30
+}
+  800b42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b46:	c9                   	leave
+  800b47:	c3                   	ret
+
+0000000000800b48 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800b48:	55                   	push   %rbp
+  800b49:	48 89 e5             	mov    %rsp,%rbp
+  800b4c:	53                   	push   %rbx
+  800b4d:	48 83 ec 08          	sub    $0x8,%rsp
+  800b51:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800b54:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b57:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b5c:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b5f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b64:	be 00 00 00 00       	mov    $0x0,%esi
+  800b69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b6f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b71:	48 85 c0             	test   %rax,%rax
+  800b74:	7f 06                	jg     800b7c <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b7a:	c9                   	leave
+  800b7b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b7c:	49 89 c0             	mov    %rax,%r8
+  800b7f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800b84:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  800b8b:	00 00 00 
+  800b8e:	be 26 00 00 00       	mov    $0x26,%esi
+  800b93:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  800b9a:	00 00 00 
+  800b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba2:	49 b9 0f 2b 80 00 00 	movabs $0x802b0f,%r9
+  800ba9:	00 00 00 
+  800bac:	41 ff d1             	call   *%r9
+
+0000000000800baf <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800baf:	55                   	push   %rbp
+  800bb0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  800bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb8:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  800bbf:	00 00 00 
+  800bc2:	ff d0                	call   *%rax
+}
+  800bc4:	5d                   	pop    %rbp
+  800bc5:	c3                   	ret
+
+0000000000800bc6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800bc6:	55                   	push   %rbp
+  800bc7:	48 89 e5             	mov    %rsp,%rbp
+  800bca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800bcb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800bda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800be4:	be 00 00 00 00       	mov    $0x0,%esi
+  800be9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bef:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800bf1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bf5:	c9                   	leave
+  800bf6:	c3                   	ret
+
+0000000000800bf7 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  800bf7:	55                   	push   %rbp
+  800bf8:	48 89 e5             	mov    %rsp,%rbp
+  800bfb:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  800bfc:	48 63 ce             	movslq %esi,%rcx
+  800bff:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  800c03:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c12:	be 00 00 00 00       	mov    $0x0,%esi
+  800c17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c1d:	cd 30                	int    $0x30
+}
+  800c1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c23:	c9                   	leave
+  800c24:	c3                   	ret
+
+0000000000800c25 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800c25:	55                   	push   %rbp
+  800c26:	48 89 e5             	mov    %rsp,%rbp
+  800c29:	53                   	push   %rbx
+  800c2a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800c2d:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c31:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c40:	be 00 00 00 00       	mov    $0x0,%esi
+  800c45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c4b:	cd 30                	int    $0x30
+}
+  800c4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c51:	c9                   	leave
+  800c52:	c3                   	ret
+
+0000000000800c53 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800c53:	55                   	push   %rbp
+  800c54:	48 89 e5             	mov    %rsp,%rbp
+  800c57:	53                   	push   %rbx
+  800c58:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800c5b:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c5e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c63:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c66:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c6b:	be 00 00 00 00       	mov    $0x0,%esi
+  800c70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c76:	cd 30                	int    $0x30
+}
+  800c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c7c:	c9                   	leave
+  800c7d:	c3                   	ret
+
+0000000000800c7e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c7e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800c85:	ff ff ff 
+  800c88:	48 01 f8             	add    %rdi,%rax
+  800c8b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800c8f:	c3                   	ret
+
+0000000000800c90 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c90:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800c97:	ff ff ff 
+  800c9a:	48 01 f8             	add    %rdi,%rax
+  800c9d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800ca1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800ca7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cab:	c3                   	ret
+
+0000000000800cac <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cac:	55                   	push   %rbp
+  800cad:	48 89 e5             	mov    %rsp,%rbp
+  800cb0:	41 57                	push   %r15
+  800cb2:	41 56                	push   %r14
+  800cb4:	41 55                	push   %r13
+  800cb6:	41 54                	push   %r12
+  800cb8:	53                   	push   %rbx
+  800cb9:	48 83 ec 08          	sub    $0x8,%rsp
+  800cbd:	49 89 ff             	mov    %rdi,%r15
+  800cc0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cc5:	49 bd cb 27 80 00 00 	movabs $0x8027cb,%r13
+  800ccc:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ccf:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800cd5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800cd8:	48 89 df             	mov    %rbx,%rdi
+  800cdb:	41 ff d5             	call   *%r13
+  800cde:	83 e0 04             	and    $0x4,%eax
+  800ce1:	74 17                	je     800cfa <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800ce3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cea:	4c 39 f3             	cmp    %r14,%rbx
+  800ced:	75 e6                	jne    800cd5 <fd_alloc+0x29>
+  800cef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800cf5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800cfa:	4d 89 27             	mov    %r12,(%r15)
+}
+  800cfd:	48 83 c4 08          	add    $0x8,%rsp
+  800d01:	5b                   	pop    %rbx
+  800d02:	41 5c                	pop    %r12
+  800d04:	41 5d                	pop    %r13
+  800d06:	41 5e                	pop    %r14
+  800d08:	41 5f                	pop    %r15
+  800d0a:	5d                   	pop    %rbp
+  800d0b:	c3                   	ret
+
+0000000000800d0c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d0c:	83 ff 1f             	cmp    $0x1f,%edi
+  800d0f:	77 39                	ja     800d4a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d11:	55                   	push   %rbp
+  800d12:	48 89 e5             	mov    %rsp,%rbp
+  800d15:	41 54                	push   %r12
+  800d17:	53                   	push   %rbx
+  800d18:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d1b:	48 63 df             	movslq %edi,%rbx
+  800d1e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d25:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d29:	48 89 df             	mov    %rbx,%rdi
+  800d2c:	48 b8 cb 27 80 00 00 	movabs $0x8027cb,%rax
+  800d33:	00 00 00 
+  800d36:	ff d0                	call   *%rax
+  800d38:	a8 04                	test   $0x4,%al
+  800d3a:	74 14                	je     800d50 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d3c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d45:	5b                   	pop    %rbx
+  800d46:	41 5c                	pop    %r12
+  800d48:	5d                   	pop    %rbp
+  800d49:	c3                   	ret
+        return -E_INVAL;
+  800d4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d4f:	c3                   	ret
+        return -E_INVAL;
+  800d50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d55:	eb ee                	jmp    800d45 <fd_lookup+0x39>
+
+0000000000800d57 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d57:	55                   	push   %rbp
+  800d58:	48 89 e5             	mov    %rsp,%rbp
+  800d5b:	41 54                	push   %r12
+  800d5d:	53                   	push   %rbx
+  800d5e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d61:	48 b8 40 38 80 00 00 	movabs $0x803840,%rax
+  800d68:	00 00 00 
+  800d6b:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800d72:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d75:	39 3b                	cmp    %edi,(%rbx)
+  800d77:	74 47                	je     800dc0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d79:	48 83 c0 08          	add    $0x8,%rax
+  800d7d:	48 8b 18             	mov    (%rax),%rbx
+  800d80:	48 85 db             	test   %rbx,%rbx
+  800d83:	75 f0                	jne    800d75 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800d85:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d8c:	00 00 00 
+  800d8f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d95:	89 fa                	mov    %edi,%edx
+  800d97:	48 bf a0 37 80 00 00 	movabs $0x8037a0,%rdi
+  800d9e:	00 00 00 
+  800da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da6:	48 b9 5f 2c 80 00 00 	movabs $0x802c5f,%rcx
+  800dad:	00 00 00 
+  800db0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800db2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800db7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dbb:	5b                   	pop    %rbx
+  800dbc:	41 5c                	pop    %r12
+  800dbe:	5d                   	pop    %rbp
+  800dbf:	c3                   	ret
+            return 0;
+  800dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc5:	eb f0                	jmp    800db7 <dev_lookup+0x60>
+
+0000000000800dc7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800dc7:	55                   	push   %rbp
+  800dc8:	48 89 e5             	mov    %rsp,%rbp
+  800dcb:	41 55                	push   %r13
+  800dcd:	41 54                	push   %r12
+  800dcf:	53                   	push   %rbx
+  800dd0:	48 83 ec 18          	sub    $0x18,%rsp
+  800dd4:	48 89 fb             	mov    %rdi,%rbx
+  800dd7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800dda:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800de1:	ff ff ff 
+  800de4:	48 01 df             	add    %rbx,%rdi
+  800de7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800deb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800def:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  800df6:	00 00 00 
+  800df9:	ff d0                	call   *%rax
+  800dfb:	41 89 c5             	mov    %eax,%r13d
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	78 06                	js     800e08 <fd_close+0x41>
+  800e02:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e06:	74 1a                	je     800e22 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e08:	45 84 e4             	test   %r12b,%r12b
+  800e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e10:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e14:	44 89 e8             	mov    %r13d,%eax
+  800e17:	48 83 c4 18          	add    $0x18,%rsp
+  800e1b:	5b                   	pop    %rbx
+  800e1c:	41 5c                	pop    %r12
+  800e1e:	41 5d                	pop    %r13
+  800e20:	5d                   	pop    %rbp
+  800e21:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e22:	8b 3b                	mov    (%rbx),%edi
+  800e24:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e28:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  800e2f:	00 00 00 
+  800e32:	ff d0                	call   *%rax
+  800e34:	41 89 c5             	mov    %eax,%r13d
+  800e37:	85 c0                	test   %eax,%eax
+  800e39:	78 1b                	js     800e56 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e3f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800e43:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e49:	48 85 c0             	test   %rax,%rax
+  800e4c:	74 08                	je     800e56 <fd_close+0x8f>
+  800e4e:	48 89 df             	mov    %rbx,%rdi
+  800e51:	ff d0                	call   *%rax
+  800e53:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e5b:	48 89 de             	mov    %rbx,%rsi
+  800e5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e63:	48 b8 7a 09 80 00 00 	movabs $0x80097a,%rax
+  800e6a:	00 00 00 
+  800e6d:	ff d0                	call   *%rax
+    return res;
+  800e6f:	eb a3                	jmp    800e14 <fd_close+0x4d>
+
+0000000000800e71 <close>:
+
+int
+close(int fdnum) {
+  800e71:	55                   	push   %rbp
+  800e72:	48 89 e5             	mov    %rsp,%rbp
+  800e75:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e79:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e7d:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  800e84:	00 00 00 
+  800e87:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	78 15                	js     800ea2 <close+0x31>
+
+    return fd_close(fd, 1);
+  800e8d:	be 01 00 00 00       	mov    $0x1,%esi
+  800e92:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800e96:	48 b8 c7 0d 80 00 00 	movabs $0x800dc7,%rax
+  800e9d:	00 00 00 
+  800ea0:	ff d0                	call   *%rax
+}
+  800ea2:	c9                   	leave
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <close_all>:
+
+void
+close_all(void) {
+  800ea4:	55                   	push   %rbp
+  800ea5:	48 89 e5             	mov    %rsp,%rbp
+  800ea8:	41 54                	push   %r12
+  800eaa:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb0:	49 bc 71 0e 80 00 00 	movabs $0x800e71,%r12
+  800eb7:	00 00 00 
+  800eba:	89 df                	mov    %ebx,%edi
+  800ebc:	41 ff d4             	call   *%r12
+  800ebf:	83 c3 01             	add    $0x1,%ebx
+  800ec2:	83 fb 20             	cmp    $0x20,%ebx
+  800ec5:	75 f3                	jne    800eba <close_all+0x16>
+}
+  800ec7:	5b                   	pop    %rbx
+  800ec8:	41 5c                	pop    %r12
+  800eca:	5d                   	pop    %rbp
+  800ecb:	c3                   	ret
+
+0000000000800ecc <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+  800ed0:	41 57                	push   %r15
+  800ed2:	41 56                	push   %r14
+  800ed4:	41 55                	push   %r13
+  800ed6:	41 54                	push   %r12
+  800ed8:	53                   	push   %rbx
+  800ed9:	48 83 ec 18          	sub    $0x18,%rsp
+  800edd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800ee0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800ee4:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  800eeb:	00 00 00 
+  800eee:	ff d0                	call   *%rax
+  800ef0:	89 c3                	mov    %eax,%ebx
+  800ef2:	85 c0                	test   %eax,%eax
+  800ef4:	0f 88 b8 00 00 00    	js     800fb2 <dup+0xe6>
+    close(newfdnum);
+  800efa:	44 89 e7             	mov    %r12d,%edi
+  800efd:	48 b8 71 0e 80 00 00 	movabs $0x800e71,%rax
+  800f04:	00 00 00 
+  800f07:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f09:	4d 63 ec             	movslq %r12d,%r13
+  800f0c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f13:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f17:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f1b:	4c 89 ff             	mov    %r15,%rdi
+  800f1e:	49 be 90 0c 80 00 00 	movabs $0x800c90,%r14
+  800f25:	00 00 00 
+  800f28:	41 ff d6             	call   *%r14
+  800f2b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f2e:	4c 89 ef             	mov    %r13,%rdi
+  800f31:	41 ff d6             	call   *%r14
+  800f34:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f37:	48 89 df             	mov    %rbx,%rdi
+  800f3a:	48 b8 cb 27 80 00 00 	movabs $0x8027cb,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f46:	a8 04                	test   $0x4,%al
+  800f48:	74 2b                	je     800f75 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f4a:	41 89 c1             	mov    %eax,%r9d
+  800f4d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f53:	4c 89 f1             	mov    %r14,%rcx
+  800f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5b:	48 89 de             	mov    %rbx,%rsi
+  800f5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f63:	48 b8 15 09 80 00 00 	movabs $0x800915,%rax
+  800f6a:	00 00 00 
+  800f6d:	ff d0                	call   *%rax
+  800f6f:	89 c3                	mov    %eax,%ebx
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	78 4e                	js     800fc3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f75:	4c 89 ff             	mov    %r15,%rdi
+  800f78:	48 b8 cb 27 80 00 00 	movabs $0x8027cb,%rax
+  800f7f:	00 00 00 
+  800f82:	ff d0                	call   *%rax
+  800f84:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800f87:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f8d:	4c 89 e9             	mov    %r13,%rcx
+  800f90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f95:	4c 89 fe             	mov    %r15,%rsi
+  800f98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f9d:	48 b8 15 09 80 00 00 	movabs $0x800915,%rax
+  800fa4:	00 00 00 
+  800fa7:	ff d0                	call   *%rax
+  800fa9:	89 c3                	mov    %eax,%ebx
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	78 14                	js     800fc3 <dup+0xf7>
+
+    return newfdnum;
+  800faf:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fb2:	89 d8                	mov    %ebx,%eax
+  800fb4:	48 83 c4 18          	add    $0x18,%rsp
+  800fb8:	5b                   	pop    %rbx
+  800fb9:	41 5c                	pop    %r12
+  800fbb:	41 5d                	pop    %r13
+  800fbd:	41 5e                	pop    %r14
+  800fbf:	41 5f                	pop    %r15
+  800fc1:	5d                   	pop    %rbp
+  800fc2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fc8:	4c 89 ee             	mov    %r13,%rsi
+  800fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd0:	49 bc 7a 09 80 00 00 	movabs $0x80097a,%r12
+  800fd7:	00 00 00 
+  800fda:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800fdd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fe2:	4c 89 f6             	mov    %r14,%rsi
+  800fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fea:	41 ff d4             	call   *%r12
+    return res;
+  800fed:	eb c3                	jmp    800fb2 <dup+0xe6>
+
+0000000000800fef <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800fef:	55                   	push   %rbp
+  800ff0:	48 89 e5             	mov    %rsp,%rbp
+  800ff3:	41 56                	push   %r14
+  800ff5:	41 55                	push   %r13
+  800ff7:	41 54                	push   %r12
+  800ff9:	53                   	push   %rbx
+  800ffa:	48 83 ec 10          	sub    $0x10,%rsp
+  800ffe:	89 fb                	mov    %edi,%ebx
+  801000:	49 89 f4             	mov    %rsi,%r12
+  801003:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801006:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80100a:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  801011:	00 00 00 
+  801014:	ff d0                	call   *%rax
+  801016:	85 c0                	test   %eax,%eax
+  801018:	78 4c                	js     801066 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80101a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80101e:	41 8b 3e             	mov    (%r14),%edi
+  801021:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801025:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  80102c:	00 00 00 
+  80102f:	ff d0                	call   *%rax
+  801031:	85 c0                	test   %eax,%eax
+  801033:	78 35                	js     80106a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801035:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801039:	83 e0 03             	and    $0x3,%eax
+  80103c:	83 f8 01             	cmp    $0x1,%eax
+  80103f:	74 2d                	je     80106e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801041:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801045:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801049:	48 85 c0             	test   %rax,%rax
+  80104c:	74 56                	je     8010a4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80104e:	4c 89 ea             	mov    %r13,%rdx
+  801051:	4c 89 e6             	mov    %r12,%rsi
+  801054:	4c 89 f7             	mov    %r14,%rdi
+  801057:	ff d0                	call   *%rax
+}
+  801059:	48 83 c4 10          	add    $0x10,%rsp
+  80105d:	5b                   	pop    %rbx
+  80105e:	41 5c                	pop    %r12
+  801060:	41 5d                	pop    %r13
+  801062:	41 5e                	pop    %r14
+  801064:	5d                   	pop    %rbp
+  801065:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801066:	48 98                	cltq
+  801068:	eb ef                	jmp    801059 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80106a:	48 98                	cltq
+  80106c:	eb eb                	jmp    801059 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80106e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801075:	00 00 00 
+  801078:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80107e:	89 da                	mov    %ebx,%edx
+  801080:	48 bf 01 38 80 00 00 	movabs $0x803801,%rdi
+  801087:	00 00 00 
+  80108a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108f:	48 b9 5f 2c 80 00 00 	movabs $0x802c5f,%rcx
+  801096:	00 00 00 
+  801099:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80109b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010a2:	eb b5                	jmp    801059 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010a4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010ab:	eb ac                	jmp    801059 <read+0x6a>
+
+00000000008010ad <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  8010ad:	55                   	push   %rbp
+  8010ae:	48 89 e5             	mov    %rsp,%rbp
+  8010b1:	41 56                	push   %r14
+  8010b3:	41 55                	push   %r13
+  8010b5:	41 54                	push   %r12
+  8010b7:	53                   	push   %rbx
+  8010b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8010bc:	89 fb                	mov    %edi,%ebx
+  8010be:	49 89 f4             	mov    %rsi,%r12
+  8010c1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010c4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8010c8:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  8010cf:	00 00 00 
+  8010d2:	ff d0                	call   *%rax
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	78 41                	js     801119 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010d8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8010dc:	41 8b 3e             	mov    (%r14),%edi
+  8010df:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8010e3:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  8010ea:	00 00 00 
+  8010ed:	ff d0                	call   *%rax
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	78 35                	js     801128 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010f3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8010f7:	83 e0 03             	and    $0x3,%eax
+  8010fa:	83 f8 01             	cmp    $0x1,%eax
+  8010fd:	74 2d                	je     80112c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8010ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801103:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801107:	48 85 c0             	test   %rax,%rax
+  80110a:	74 56                	je     801162 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  80110c:	4c 89 ea             	mov    %r13,%rdx
+  80110f:	4c 89 e6             	mov    %r12,%rsi
+  801112:	4c 89 f7             	mov    %r14,%rdi
+  801115:	ff d0                	call   *%rax
+  801117:	eb 02                	jmp    80111b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801119:	48 98                	cltq
+}
+  80111b:	48 83 c4 10          	add    $0x10,%rsp
+  80111f:	5b                   	pop    %rbx
+  801120:	41 5c                	pop    %r12
+  801122:	41 5d                	pop    %r13
+  801124:	41 5e                	pop    %r14
+  801126:	5d                   	pop    %rbp
+  801127:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801128:	48 98                	cltq
+  80112a:	eb ef                	jmp    80111b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  80112c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801133:	00 00 00 
+  801136:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80113c:	89 da                	mov    %ebx,%edx
+  80113e:	48 bf c0 37 80 00 00 	movabs $0x8037c0,%rdi
+  801145:	00 00 00 
+  801148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114d:	48 b9 5f 2c 80 00 00 	movabs $0x802c5f,%rcx
+  801154:	00 00 00 
+  801157:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801159:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801160:	eb b9                	jmp    80111b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801162:	4c 89 ea             	mov    %r13,%rdx
+  801165:	4c 89 e6             	mov    %r12,%rsi
+  801168:	89 df                	mov    %ebx,%edi
+  80116a:	48 b8 ef 0f 80 00 00 	movabs $0x800fef,%rax
+  801171:	00 00 00 
+  801174:	ff d0                	call   *%rax
+  801176:	eb a3                	jmp    80111b <readmap+0x6e>
+
+0000000000801178 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801178:	55                   	push   %rbp
+  801179:	48 89 e5             	mov    %rsp,%rbp
+  80117c:	41 57                	push   %r15
+  80117e:	41 56                	push   %r14
+  801180:	41 55                	push   %r13
+  801182:	41 54                	push   %r12
+  801184:	53                   	push   %rbx
+  801185:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801189:	48 85 d2             	test   %rdx,%rdx
+  80118c:	74 54                	je     8011e2 <readn+0x6a>
+  80118e:	41 89 fd             	mov    %edi,%r13d
+  801191:	49 89 f6             	mov    %rsi,%r14
+  801194:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801197:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80119c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8011a1:	49 bf ef 0f 80 00 00 	movabs $0x800fef,%r15
+  8011a8:	00 00 00 
+  8011ab:	4c 89 e2             	mov    %r12,%rdx
+  8011ae:	48 29 f2             	sub    %rsi,%rdx
+  8011b1:	4c 01 f6             	add    %r14,%rsi
+  8011b4:	44 89 ef             	mov    %r13d,%edi
+  8011b7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	78 20                	js     8011de <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8011be:	01 c3                	add    %eax,%ebx
+  8011c0:	85 c0                	test   %eax,%eax
+  8011c2:	74 08                	je     8011cc <readn+0x54>
+  8011c4:	48 63 f3             	movslq %ebx,%rsi
+  8011c7:	4c 39 e6             	cmp    %r12,%rsi
+  8011ca:	72 df                	jb     8011ab <readn+0x33>
+    }
+    return res;
+  8011cc:	48 63 c3             	movslq %ebx,%rax
+}
+  8011cf:	48 83 c4 08          	add    $0x8,%rsp
+  8011d3:	5b                   	pop    %rbx
+  8011d4:	41 5c                	pop    %r12
+  8011d6:	41 5d                	pop    %r13
+  8011d8:	41 5e                	pop    %r14
+  8011da:	41 5f                	pop    %r15
+  8011dc:	5d                   	pop    %rbp
+  8011dd:	c3                   	ret
+        if (inc < 0) return inc;
+  8011de:	48 98                	cltq
+  8011e0:	eb ed                	jmp    8011cf <readn+0x57>
+    int inc = 1, res = 0;
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	eb e3                	jmp    8011cc <readn+0x54>
+
+00000000008011e9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8011e9:	55                   	push   %rbp
+  8011ea:	48 89 e5             	mov    %rsp,%rbp
+  8011ed:	41 56                	push   %r14
+  8011ef:	41 55                	push   %r13
+  8011f1:	41 54                	push   %r12
+  8011f3:	53                   	push   %rbx
+  8011f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8011f8:	89 fb                	mov    %edi,%ebx
+  8011fa:	49 89 f4             	mov    %rsi,%r12
+  8011fd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801200:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801204:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+  801210:	85 c0                	test   %eax,%eax
+  801212:	78 47                	js     80125b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801214:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801218:	41 8b 3e             	mov    (%r14),%edi
+  80121b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80121f:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801226:	00 00 00 
+  801229:	ff d0                	call   *%rax
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	78 30                	js     80125f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80122f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801234:	74 2d                	je     801263 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801236:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80123a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80123e:	48 85 c0             	test   %rax,%rax
+  801241:	74 56                	je     801299 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801243:	4c 89 ea             	mov    %r13,%rdx
+  801246:	4c 89 e6             	mov    %r12,%rsi
+  801249:	4c 89 f7             	mov    %r14,%rdi
+  80124c:	ff d0                	call   *%rax
+}
+  80124e:	48 83 c4 10          	add    $0x10,%rsp
+  801252:	5b                   	pop    %rbx
+  801253:	41 5c                	pop    %r12
+  801255:	41 5d                	pop    %r13
+  801257:	41 5e                	pop    %r14
+  801259:	5d                   	pop    %rbp
+  80125a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80125b:	48 98                	cltq
+  80125d:	eb ef                	jmp    80124e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80125f:	48 98                	cltq
+  801261:	eb eb                	jmp    80124e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801263:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80126a:	00 00 00 
+  80126d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801273:	89 da                	mov    %ebx,%edx
+  801275:	48 bf 1d 38 80 00 00 	movabs $0x80381d,%rdi
+  80127c:	00 00 00 
+  80127f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801284:	48 b9 5f 2c 80 00 00 	movabs $0x802c5f,%rcx
+  80128b:	00 00 00 
+  80128e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801290:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801297:	eb b5                	jmp    80124e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801299:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8012a0:	eb ac                	jmp    80124e <write+0x65>
+
+00000000008012a2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8012a2:	55                   	push   %rbp
+  8012a3:	48 89 e5             	mov    %rsp,%rbp
+  8012a6:	53                   	push   %rbx
+  8012a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8012ab:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012ad:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8012b1:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  8012b8:	00 00 00 
+  8012bb:	ff d0                	call   *%rax
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	78 0c                	js     8012cd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8012c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8012c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d1:	c9                   	leave
+  8012d2:	c3                   	ret
+
+00000000008012d3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8012d3:	55                   	push   %rbp
+  8012d4:	48 89 e5             	mov    %rsp,%rbp
+  8012d7:	41 55                	push   %r13
+  8012d9:	41 54                	push   %r12
+  8012db:	53                   	push   %rbx
+  8012dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8012e0:	89 fb                	mov    %edi,%ebx
+  8012e2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012e5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8012e9:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  8012f0:	00 00 00 
+  8012f3:	ff d0                	call   *%rax
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	78 38                	js     801331 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8012f9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8012fd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801301:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801305:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  80130c:	00 00 00 
+  80130f:	ff d0                	call   *%rax
+  801311:	85 c0                	test   %eax,%eax
+  801313:	78 1c                	js     801331 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801315:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80131a:	74 20                	je     80133c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80131c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801320:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801324:	48 85 c0             	test   %rax,%rax
+  801327:	74 47                	je     801370 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801329:	44 89 e6             	mov    %r12d,%esi
+  80132c:	4c 89 ef             	mov    %r13,%rdi
+  80132f:	ff d0                	call   *%rax
+}
+  801331:	48 83 c4 18          	add    $0x18,%rsp
+  801335:	5b                   	pop    %rbx
+  801336:	41 5c                	pop    %r12
+  801338:	41 5d                	pop    %r13
+  80133a:	5d                   	pop    %rbp
+  80133b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80133c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801343:	00 00 00 
+  801346:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80134c:	89 da                	mov    %ebx,%edx
+  80134e:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  801355:	00 00 00 
+  801358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135d:	48 b9 5f 2c 80 00 00 	movabs $0x802c5f,%rcx
+  801364:	00 00 00 
+  801367:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801369:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136e:	eb c1                	jmp    801331 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801370:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801375:	eb ba                	jmp    801331 <ftruncate+0x5e>
+
+0000000000801377 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801377:	55                   	push   %rbp
+  801378:	48 89 e5             	mov    %rsp,%rbp
+  80137b:	41 54                	push   %r12
+  80137d:	53                   	push   %rbx
+  80137e:	48 83 ec 10          	sub    $0x10,%rsp
+  801382:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801385:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801389:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  801390:	00 00 00 
+  801393:	ff d0                	call   *%rax
+  801395:	85 c0                	test   %eax,%eax
+  801397:	78 4e                	js     8013e7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801399:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80139d:	41 8b 3c 24          	mov    (%r12),%edi
+  8013a1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8013a5:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  8013ac:	00 00 00 
+  8013af:	ff d0                	call   *%rax
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	78 32                	js     8013e7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8013b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013b9:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8013be:	74 30                	je     8013f0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8013c0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8013c3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8013ca:	00 00 00 
+    stat->st_isdir = 0;
+  8013cd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8013d4:	00 00 00 
+    stat->st_dev = dev;
+  8013d7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8013de:	48 89 de             	mov    %rbx,%rsi
+  8013e1:	4c 89 e7             	mov    %r12,%rdi
+  8013e4:	ff 50 30             	call   *0x30(%rax)
+}
+  8013e7:	48 83 c4 10          	add    $0x10,%rsp
+  8013eb:	5b                   	pop    %rbx
+  8013ec:	41 5c                	pop    %r12
+  8013ee:	5d                   	pop    %rbp
+  8013ef:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8013f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8013f5:	eb f0                	jmp    8013e7 <fstat+0x70>
+
+00000000008013f7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8013f7:	55                   	push   %rbp
+  8013f8:	48 89 e5             	mov    %rsp,%rbp
+  8013fb:	41 54                	push   %r12
+  8013fd:	53                   	push   %rbx
+  8013fe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801401:	be 00 00 00 00       	mov    $0x0,%esi
+  801406:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  80140d:	00 00 00 
+  801410:	ff d0                	call   *%rax
+  801412:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 25                	js     80143d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801418:	4c 89 e6             	mov    %r12,%rsi
+  80141b:	89 c7                	mov    %eax,%edi
+  80141d:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  801424:	00 00 00 
+  801427:	ff d0                	call   *%rax
+  801429:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80142c:	89 df                	mov    %ebx,%edi
+  80142e:	48 b8 71 0e 80 00 00 	movabs $0x800e71,%rax
+  801435:	00 00 00 
+  801438:	ff d0                	call   *%rax
+
+    return res;
+  80143a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80143d:	89 d8                	mov    %ebx,%eax
+  80143f:	5b                   	pop    %rbx
+  801440:	41 5c                	pop    %r12
+  801442:	5d                   	pop    %rbp
+  801443:	c3                   	ret
+
+0000000000801444 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801444:	55                   	push   %rbp
+  801445:	48 89 e5             	mov    %rsp,%rbp
+  801448:	41 54                	push   %r12
+  80144a:	53                   	push   %rbx
+  80144b:	48 83 ec 10          	sub    $0x10,%rsp
+  80144f:	48 89 fb             	mov    %rdi,%rbx
+  801452:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801455:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801459:	bf 66 00 00 00       	mov    $0x66,%edi
+  80145e:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801465:	00 00 00 
+  801468:	ff d0                	call   *%rax
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 1f                	js     80148d <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80146e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801472:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801476:	48 85 c0             	test   %rax,%rax
+  801479:	74 1b                	je     801496 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80147b:	4c 89 e6             	mov    %r12,%rsi
+  80147e:	48 89 df             	mov    %rbx,%rdi
+  801481:	ff d0                	call   *%rax
+    if (res < 0) {
+  801483:	85 c0                	test   %eax,%eax
+  801485:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80148d:	48 83 c4 10          	add    $0x10,%rsp
+  801491:	5b                   	pop    %rbx
+  801492:	41 5c                	pop    %r12
+  801494:	5d                   	pop    %rbp
+  801495:	c3                   	ret
+        return -E_NOT_SUPP;
+  801496:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80149b:	eb f0                	jmp    80148d <create_snapshot+0x49>
+
+000000000080149d <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+  8014a1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8014a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8014a9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8014ae:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  8014b5:	00 00 00 
+  8014b8:	ff d0                	call   *%rax
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	78 1e                	js     8014dc <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8014be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c2:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8014c6:	48 85 d2             	test   %rdx,%rdx
+  8014c9:	74 13                	je     8014de <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8014cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d0:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8014dc:	c9                   	leave
+  8014dd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8014de:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8014e3:	eb f7                	jmp    8014dc <print_snapshot_list+0x3f>
+
+00000000008014e5 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	53                   	push   %rbx
+  8014ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8014ee:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8014f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8014f5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8014fa:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801501:	00 00 00 
+  801504:	ff d0                	call   *%rax
+  801506:	85 c0                	test   %eax,%eax
+  801508:	78 1c                	js     801526 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80150a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150e:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801512:	48 85 c0             	test   %rax,%rax
+  801515:	74 15                	je     80152c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801517:	48 89 df             	mov    %rbx,%rdi
+  80151a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801523:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801526:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152a:	c9                   	leave
+  80152b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80152c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801531:	eb f3                	jmp    801526 <accept_snapshot+0x41>
+
+0000000000801533 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801533:	55                   	push   %rbp
+  801534:	48 89 e5             	mov    %rsp,%rbp
+  801537:	53                   	push   %rbx
+  801538:	48 83 ec 18          	sub    $0x18,%rsp
+  80153c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80153f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801543:	bf 66 00 00 00       	mov    $0x66,%edi
+  801548:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  80154f:	00 00 00 
+  801552:	ff d0                	call   *%rax
+  801554:	85 c0                	test   %eax,%eax
+  801556:	78 1c                	js     801574 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801558:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155c:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	74 15                	je     80157a <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801565:	48 89 df             	mov    %rbx,%rdi
+  801568:	ff d0                	call   *%rax
+    if (res < 0) {
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801571:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801574:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+        return -E_NOT_SUPP;
+  80157a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80157f:	eb f3                	jmp    801574 <delete_snapshot+0x41>
+
+0000000000801581 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801589:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80158d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801592:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801599:	00 00 00 
+  80159c:	ff d0                	call   *%rax
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	78 14                	js     8015b6 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8015a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a6:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8015aa:	48 85 d2             	test   %rdx,%rdx
+  8015ad:	74 09                	je     8015b8 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8015b6:	c9                   	leave
+  8015b7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8015b8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8015bd:	eb f7                	jmp    8015b6 <gc_snapshots+0x35>
+
+00000000008015bf <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8015bf:	55                   	push   %rbp
+  8015c0:	48 89 e5             	mov    %rsp,%rbp
+  8015c3:	41 56                	push   %r14
+  8015c5:	41 55                	push   %r13
+  8015c7:	41 54                	push   %r12
+  8015c9:	53                   	push   %rbx
+  8015ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8015ce:	48 89 fb             	mov    %rdi,%rbx
+  8015d1:	49 89 f4             	mov    %rsi,%r12
+  8015d4:	49 89 d5             	mov    %rdx,%r13
+  8015d7:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8015da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015de:	bf 66 00 00 00       	mov    $0x66,%edi
+  8015e3:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  8015ea:	00 00 00 
+  8015ed:	ff d0                	call   *%rax
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	78 1b                	js     80160e <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8015f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f7:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8015fb:	48 85 c0             	test   %rax,%rax
+  8015fe:	74 1b                	je     80161b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801600:	4c 89 f1             	mov    %r14,%rcx
+  801603:	4c 89 ea             	mov    %r13,%rdx
+  801606:	4c 89 e6             	mov    %r12,%rsi
+  801609:	48 89 df             	mov    %rbx,%rdi
+  80160c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80160e:	48 83 c4 10          	add    $0x10,%rsp
+  801612:	5b                   	pop    %rbx
+  801613:	41 5c                	pop    %r12
+  801615:	41 5d                	pop    %r13
+  801617:	41 5e                	pop    %r14
+  801619:	5d                   	pop    %rbp
+  80161a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80161b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801620:	eb ec                	jmp    80160e <diff_snapshots+0x4f>
+
+0000000000801622 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	41 55                	push   %r13
+  801628:	41 54                	push   %r12
+  80162a:	53                   	push   %rbx
+  80162b:	48 83 ec 18          	sub    $0x18,%rsp
+  80162f:	48 89 fb             	mov    %rdi,%rbx
+  801632:	49 89 f4             	mov    %rsi,%r12
+  801635:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801638:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80163c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801641:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801648:	00 00 00 
+  80164b:	ff d0                	call   *%rax
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 18                	js     801669 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801651:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801655:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801659:	48 85 c0             	test   %rax,%rax
+  80165c:	74 16                	je     801674 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80165e:	4c 89 ea             	mov    %r13,%rdx
+  801661:	4c 89 e6             	mov    %r12,%rsi
+  801664:	48 89 df             	mov    %rbx,%rdi
+  801667:	ff d0                	call   *%rax
+
+    return res;
+}
+  801669:	48 83 c4 18          	add    $0x18,%rsp
+  80166d:	5b                   	pop    %rbx
+  80166e:	41 5c                	pop    %r12
+  801670:	41 5d                	pop    %r13
+  801672:	5d                   	pop    %rbp
+  801673:	c3                   	ret
+        return -E_NOT_SUPP;
+  801674:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801679:	eb ee                	jmp    801669 <send_snapshot+0x47>
+
+000000000080167b <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80167b:	55                   	push   %rbp
+  80167c:	48 89 e5             	mov    %rsp,%rbp
+  80167f:	53                   	push   %rbx
+  801680:	48 83 ec 18          	sub    $0x18,%rsp
+  801684:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801687:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80168b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801690:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801697:	00 00 00 
+  80169a:	ff d0                	call   *%rax
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	78 12                	js     8016b2 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8016a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a4:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8016a8:	48 85 c0             	test   %rax,%rax
+  8016ab:	74 0b                	je     8016b8 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8016ad:	48 89 df             	mov    %rbx,%rdi
+  8016b0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8016b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b6:	c9                   	leave
+  8016b7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8016b8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8016bd:	eb f3                	jmp    8016b2 <receive_snapshot+0x37>
+
+00000000008016bf <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+  8016c3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8016c7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016cb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8016d0:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 17                	js     8016f7 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8016e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e4:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8016eb:	48 85 d2             	test   %rdx,%rdx
+  8016ee:	74 09                	je     8016f9 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8016f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f5:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8016f7:	c9                   	leave
+  8016f8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8016f9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8016fe:	eb f7                	jmp    8016f7 <free_space_bytes+0x38>
+
+0000000000801700 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801708:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80170c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801711:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801718:	00 00 00 
+  80171b:	ff d0                	call   *%rax
+  80171d:	85 c0                	test   %eax,%eax
+  80171f:	78 17                	js     801738 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801721:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801725:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80172c:	48 85 d2             	test   %rdx,%rdx
+  80172f:	74 09                	je     80173a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801731:	b8 00 00 00 00       	mov    $0x0,%eax
+  801736:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+        return -E_NOT_SUPP;
+  80173a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80173f:	eb f7                	jmp    801738 <busy_space_bytes+0x38>
+
+0000000000801741 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801741:	55                   	push   %rbp
+  801742:	48 89 e5             	mov    %rsp,%rbp
+  801745:	41 54                	push   %r12
+  801747:	53                   	push   %rbx
+  801748:	48 83 ec 10          	sub    $0x10,%rsp
+  80174c:	89 fb                	mov    %edi,%ebx
+  80174e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801751:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801755:	bf 66 00 00 00       	mov    $0x66,%edi
+  80175a:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  801761:	00 00 00 
+  801764:	ff d0                	call   *%rax
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 17                	js     801781 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80176a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80176e:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801775:	48 85 c0             	test   %rax,%rax
+  801778:	74 10                	je     80178a <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80177a:	4c 89 e6             	mov    %r12,%rsi
+  80177d:	89 df                	mov    %ebx,%edi
+  80177f:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801781:	48 83 c4 10          	add    $0x10,%rsp
+  801785:	5b                   	pop    %rbx
+  801786:	41 5c                	pop    %r12
+  801788:	5d                   	pop    %rbp
+  801789:	c3                   	ret
+        return -E_NOT_SUPP;
+  80178a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80178f:	eb f0                	jmp    801781 <snapshots_space+0x40>
+
+0000000000801791 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801791:	55                   	push   %rbp
+  801792:	48 89 e5             	mov    %rsp,%rbp
+  801795:	41 55                	push   %r13
+  801797:	41 54                	push   %r12
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	41 89 fd             	mov    %edi,%r13d
+  8017a1:	48 89 f3             	mov    %rsi,%rbx
+  8017a4:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017a7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8017ae:	00 00 00 
+  8017b1:	83 38 00             	cmpl   $0x0,(%rax)
+  8017b4:	74 57                	je     80180d <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8017b6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8017bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8017c1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8017c8:	00 00 00 
+  8017cb:	44 89 ee             	mov    %r13d,%esi
+  8017ce:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8017d5:	00 00 00 
+  8017d8:	8b 38                	mov    (%rax),%edi
+  8017da:	48 b8 45 36 80 00 00 	movabs $0x803645,%rax
+  8017e1:	00 00 00 
+  8017e4:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8017e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017eb:	4c 89 e2             	mov    %r12,%rdx
+  8017ee:	48 89 de             	mov    %rbx,%rsi
+  8017f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f6:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  8017fd:	00 00 00 
+  801800:	ff d0                	call   *%rax
+}
+  801802:	48 83 c4 08          	add    $0x8,%rsp
+  801806:	5b                   	pop    %rbx
+  801807:	41 5c                	pop    %r12
+  801809:	41 5d                	pop    %r13
+  80180b:	5d                   	pop    %rbp
+  80180c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80180d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801812:	48 b8 03 37 80 00 00 	movabs $0x803703,%rax
+  801819:	00 00 00 
+  80181c:	ff d0                	call   *%rax
+  80181e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801825:	00 00 
+  801827:	eb 8d                	jmp    8017b6 <fsipc_region+0x25>
+
+0000000000801829 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801829:	55                   	push   %rbp
+  80182a:	48 89 e5             	mov    %rsp,%rbp
+  80182d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801831:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801838:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801839:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80183d:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801844:	00 00 00 
+  801847:	ff d0                	call   *%rax
+}
+  801849:	c9                   	leave
+  80184a:	c3                   	ret
+
+000000000080184b <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80184b:	85 ff                	test   %edi,%edi
+  80184d:	78 6d                	js     8018bc <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80184f:	55                   	push   %rbp
+  801850:	48 89 e5             	mov    %rsp,%rbp
+  801853:	41 54                	push   %r12
+  801855:	53                   	push   %rbx
+  801856:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801859:	48 85 f6             	test   %rsi,%rsi
+  80185c:	74 57                	je     8018b5 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80185e:	89 f8                	mov    %edi,%eax
+  801860:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801867:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801869:	be 00 00 00 00       	mov    $0x0,%esi
+  80186e:	bf 12 00 00 00       	mov    $0x12,%edi
+  801873:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 2d                	js     8018b0 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801883:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80188a:	00 00 00 
+  80188d:	49 63 14 24          	movslq (%r12),%rdx
+  801891:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  801898:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80189d:	48 89 df             	mov    %rbx,%rdi
+  8018a0:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  8018a7:	00 00 00 
+  8018aa:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8018ac:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8018b0:	5b                   	pop    %rbx
+  8018b1:	41 5c                	pop    %r12
+  8018b3:	5d                   	pop    %rbp
+  8018b4:	c3                   	ret
+        return -E_INVAL;
+  8018b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ba:	eb f4                	jmp    8018b0 <devfile_df_snapshots+0x65>
+  8018bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018c1:	c3                   	ret
+
+00000000008018c2 <devfile_df_busy>:
+devfile_df_busy() {
+  8018c2:	55                   	push   %rbp
+  8018c3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8018c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cb:	bf 11 00 00 00       	mov    $0x11,%edi
+  8018d0:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  8018d7:	00 00 00 
+  8018da:	ff d0                	call   *%rax
+}
+  8018dc:	5d                   	pop    %rbp
+  8018dd:	c3                   	ret
+
+00000000008018de <devfile_df_free>:
+devfile_df_free() {
+  8018de:	55                   	push   %rbp
+  8018df:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8018e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8018ec:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+}
+  8018f8:	5d                   	pop    %rbp
+  8018f9:	c3                   	ret
+
+00000000008018fa <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8018fa:	55                   	push   %rbp
+  8018fb:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8018fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801903:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801908:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+}
+  801914:	5d                   	pop    %rbp
+  801915:	c3                   	ret
+
+0000000000801916 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	bf 09 00 00 00       	mov    $0x9,%edi
+  801924:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  80192b:	00 00 00 
+  80192e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801930:	85 c0                	test   %eax,%eax
+  801932:	ba 00 00 00 00       	mov    $0x0,%edx
+  801937:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80193a:	5d                   	pop    %rbp
+  80193b:	c3                   	ret
+
+000000000080193c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80193c:	55                   	push   %rbp
+  80193d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801940:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801947:	00 00 00 
+  80194a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80194d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80194f:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801952:	be 00 00 00 00       	mov    $0x0,%esi
+  801957:	bf 02 00 00 00       	mov    $0x2,%edi
+  80195c:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801963:	00 00 00 
+  801966:	ff d0                	call   *%rax
+}
+  801968:	5d                   	pop    %rbp
+  801969:	c3                   	ret
+
+000000000080196a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80196e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801971:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801978:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80197a:	be 00 00 00 00       	mov    $0x0,%esi
+  80197f:	bf 06 00 00 00       	mov    $0x6,%edi
+  801984:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+}
+  801990:	5d                   	pop    %rbp
+  801991:	c3                   	ret
+
+0000000000801992 <devfile_write>:
+    if (!fd || !buf) {
+  801992:	48 85 ff             	test   %rdi,%rdi
+  801995:	0f 84 c1 00 00 00    	je     801a5c <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	41 57                	push   %r15
+  8019a1:	41 56                	push   %r14
+  8019a3:	41 55                	push   %r13
+  8019a5:	41 54                	push   %r12
+  8019a7:	53                   	push   %rbx
+  8019a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ac:	49 89 ff             	mov    %rdi,%r15
+  8019af:	49 89 f5             	mov    %rsi,%r13
+  8019b2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8019b5:	48 85 f6             	test   %rsi,%rsi
+  8019b8:	0f 84 95 00 00 00    	je     801a53 <devfile_write+0xc1>
+    while (n) {
+  8019be:	48 85 d2             	test   %rdx,%rdx
+  8019c1:	0f 84 83 00 00 00    	je     801a4a <devfile_write+0xb8>
+    int totalWrite = 0;
+  8019c7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019ce:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8019d5:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019d8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8019dd:	49 39 dc             	cmp    %rbx,%r12
+  8019e0:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8019e4:	48 89 da             	mov    %rbx,%rdx
+  8019e7:	4c 89 ee             	mov    %r13,%rsi
+  8019ea:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8019f1:	00 00 00 
+  8019f4:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a00:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801a04:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  801a07:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  801a0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a10:	bf 04 00 00 00       	mov    $0x4,%edi
+  801a15:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+        if (write < 0) {
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 21                	js     801a46 <devfile_write+0xb4>
+        buf += write;
+  801a25:	48 63 d0             	movslq %eax,%rdx
+  801a28:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801a2b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801a2e:	49 29 d4             	sub    %rdx,%r12
+  801a31:	75 a5                	jne    8019d8 <devfile_write+0x46>
+    return totalWrite;
+  801a33:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801a37:	48 83 c4 18          	add    $0x18,%rsp
+  801a3b:	5b                   	pop    %rbx
+  801a3c:	41 5c                	pop    %r12
+  801a3e:	41 5d                	pop    %r13
+  801a40:	41 5e                	pop    %r14
+  801a42:	41 5f                	pop    %r15
+  801a44:	5d                   	pop    %rbp
+  801a45:	c3                   	ret
+            return write;
+  801a46:	48 98                	cltq
+  801a48:	eb ed                	jmp    801a37 <devfile_write+0xa5>
+    int totalWrite = 0;
+  801a4a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801a51:	eb e0                	jmp    801a33 <devfile_write+0xa1>
+        return -E_INVAL;
+  801a53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a5a:	eb db                	jmp    801a37 <devfile_write+0xa5>
+  801a5c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801a63:	c3                   	ret
+
+0000000000801a64 <devfile_read>:
+    if (!fd || !buf) {
+  801a64:	48 85 ff             	test   %rdi,%rdi
+  801a67:	0f 84 c0 00 00 00    	je     801b2d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	41 57                	push   %r15
+  801a73:	41 56                	push   %r14
+  801a75:	41 55                	push   %r13
+  801a77:	41 54                	push   %r12
+  801a79:	53                   	push   %rbx
+  801a7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a7e:	49 89 ff             	mov    %rdi,%r15
+  801a81:	49 89 f5             	mov    %rsi,%r13
+  801a84:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801a87:	48 85 f6             	test   %rsi,%rsi
+  801a8a:	0f 84 96 00 00 00    	je     801b26 <devfile_read+0xc2>
+    while (n) {
+  801a90:	48 85 d2             	test   %rdx,%rdx
+  801a93:	0f 84 87 00 00 00    	je     801b20 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  801a99:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801aa0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aa1:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801aa8:	00 00 00 
+  801aab:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801aaf:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  801ab2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ab7:	49 39 c4             	cmp    %rax,%r12
+  801aba:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  801abe:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  801ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac7:	bf 03 00 00 00       	mov    $0x3,%edi
+  801acc:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+        if (read <= 0) {
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	7e 37                	jle    801b13 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  801adc:	48 63 d8             	movslq %eax,%rbx
+  801adf:	48 89 da             	mov    %rbx,%rdx
+  801ae2:	4c 89 f6             	mov    %r14,%rsi
+  801ae5:	4c 89 ef             	mov    %r13,%rdi
+  801ae8:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  801aef:	00 00 00 
+  801af2:	ff d0                	call   *%rax
+        buf += read;
+  801af4:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  801af7:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801afb:	49 29 dc             	sub    %rbx,%r12
+  801afe:	75 ab                	jne    801aab <devfile_read+0x47>
+  return totalRead;
+  801b00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b04:	48 83 c4 18          	add    $0x18,%rsp
+  801b08:	5b                   	pop    %rbx
+  801b09:	41 5c                	pop    %r12
+  801b0b:	41 5d                	pop    %r13
+  801b0d:	41 5e                	pop    %r14
+  801b0f:	41 5f                	pop    %r15
+  801b11:	5d                   	pop    %rbp
+  801b12:	c3                   	ret
+            return read ? read : totalRead;
+  801b13:	48 63 d0             	movslq %eax,%rdx
+  801b16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1a:	48 0f 45 c2          	cmovne %rdx,%rax
+  801b1e:	eb e4                	jmp    801b04 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  801b20:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b24:	eb da                	jmp    801b00 <devfile_read+0x9c>
+        return E_INVAL;
+  801b26:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b2b:	eb d7                	jmp    801b04 <devfile_read+0xa0>
+  801b2d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801b32:	c3                   	ret
+
+0000000000801b33 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801b33:	48 85 ff             	test   %rdi,%rdi
+  801b36:	74 5f                	je     801b97 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801b38:	55                   	push   %rbp
+  801b39:	48 89 e5             	mov    %rsp,%rbp
+  801b3c:	53                   	push   %rbx
+  801b3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b41:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801b44:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801b4b:	00 00 00 
+  801b4e:	ff d0                	call   *%rax
+  801b50:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b56:	77 45                	ja     801b9d <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801b58:	48 89 de             	mov    %rbx,%rsi
+  801b5b:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801b62:	00 00 00 
+  801b65:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801b71:	be 00 00 00 00       	mov    $0x0,%esi
+  801b76:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801b7b:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801b91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b95:	c9                   	leave
+  801b96:	c3                   	ret
+        return -E_INVAL;
+  801b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b9c:	c3                   	ret
+        return -E_INVAL;
+  801b9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba2:	eb ed                	jmp    801b91 <devfile_receive_snapshot+0x5e>
+
+0000000000801ba4 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	41 55                	push   %r13
+  801baa:	41 54                	push   %r12
+  801bac:	53                   	push   %rbx
+  801bad:	48 83 ec 08          	sub    $0x8,%rsp
+  801bb1:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  801bb4:	48 85 f6             	test   %rsi,%rsi
+  801bb7:	0f 94 c0             	sete   %al
+  801bba:	48 85 d2             	test   %rdx,%rdx
+  801bbd:	0f 94 c2             	sete   %dl
+  801bc0:	08 d0                	or     %dl,%al
+  801bc2:	0f 85 ad 00 00 00    	jne    801c75 <devfile_send_snapshot+0xd1>
+  801bc8:	48 89 fb             	mov    %rdi,%rbx
+  801bcb:	49 89 f4             	mov    %rsi,%r12
+  801bce:	48 85 ff             	test   %rdi,%rdi
+  801bd1:	0f 84 9e 00 00 00    	je     801c75 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  801bd7:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801be9:	0f 87 8d 00 00 00    	ja     801c7c <devfile_send_snapshot+0xd8>
+  801bef:	4c 89 e7             	mov    %r12,%rdi
+  801bf2:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801bf9:	00 00 00 
+  801bfc:	ff d0                	call   *%rax
+  801bfe:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801c04:	77 7d                	ja     801c83 <devfile_send_snapshot+0xdf>
+  801c06:	4c 89 ef             	mov    %r13,%rdi
+  801c09:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801c1b:	77 6d                	ja     801c8a <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  801c1d:	48 89 de             	mov    %rbx,%rsi
+  801c20:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801c27:	00 00 00 
+  801c2a:	48 bb 22 02 80 00 00 	movabs $0x800222,%rbx
+  801c31:	00 00 00 
+  801c34:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801c36:	4c 89 e6             	mov    %r12,%rsi
+  801c39:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801c40:	00 00 00 
+  801c43:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801c45:	4c 89 ee             	mov    %r13,%rsi
+  801c48:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801c4f:	00 00 00 
+  801c52:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801c54:	be 00 00 00 00       	mov    $0x0,%esi
+  801c59:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801c5e:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801c65:	00 00 00 
+  801c68:	ff d0                	call   *%rax
+}
+  801c6a:	48 83 c4 08          	add    $0x8,%rsp
+  801c6e:	5b                   	pop    %rbx
+  801c6f:	41 5c                	pop    %r12
+  801c71:	41 5d                	pop    %r13
+  801c73:	5d                   	pop    %rbp
+  801c74:	c3                   	ret
+        return -E_INVAL;
+  801c75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c7a:	eb ee                	jmp    801c6a <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801c7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c81:	eb e7                	jmp    801c6a <devfile_send_snapshot+0xc6>
+  801c83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c88:	eb e0                	jmp    801c6a <devfile_send_snapshot+0xc6>
+  801c8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c8f:	eb d9                	jmp    801c6a <devfile_send_snapshot+0xc6>
+
+0000000000801c91 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801c91:	48 85 ff             	test   %rdi,%rdi
+  801c94:	0f 84 41 01 00 00    	je     801ddb <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801c9a:	55                   	push   %rbp
+  801c9b:	48 89 e5             	mov    %rsp,%rbp
+  801c9e:	41 57                	push   %r15
+  801ca0:	41 56                	push   %r14
+  801ca2:	41 55                	push   %r13
+  801ca4:	41 54                	push   %r12
+  801ca6:	53                   	push   %rbx
+  801ca7:	48 83 ec 08          	sub    $0x8,%rsp
+  801cab:	49 89 fc             	mov    %rdi,%r12
+  801cae:	49 89 f5             	mov    %rsi,%r13
+  801cb1:	48 89 d3             	mov    %rdx,%rbx
+  801cb4:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  801cb7:	48 85 f6             	test   %rsi,%rsi
+  801cba:	0f 84 ff 00 00 00    	je     801dbf <devfile_diff_snapshots+0x12e>
+  801cc0:	48 85 d2             	test   %rdx,%rdx
+  801cc3:	0f 84 fd 00 00 00    	je     801dc6 <devfile_diff_snapshots+0x135>
+  801cc9:	48 85 c9             	test   %rcx,%rcx
+  801ccc:	0f 84 f4 00 00 00    	je     801dc6 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  801cd2:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+  801cde:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801ce4:	0f 87 e3 00 00 00    	ja     801dcd <devfile_diff_snapshots+0x13c>
+  801cea:	4c 89 ef             	mov    %r13,%rdi
+  801ced:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801cf4:	00 00 00 
+  801cf7:	ff d0                	call   *%rax
+  801cf9:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801cff:	0f 87 cf 00 00 00    	ja     801dd4 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  801d05:	4c 89 e6             	mov    %r12,%rsi
+  801d08:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d0f:	00 00 00 
+  801d12:	4c 89 e7             	mov    %r12,%rdi
+  801d15:	49 bf 22 02 80 00 00 	movabs $0x800222,%r15
+  801d1c:	00 00 00 
+  801d1f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  801d22:	4c 89 ee             	mov    %r13,%rsi
+  801d25:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801d2c:	00 
+  801d2d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801d30:	48 8b 03             	mov    (%rbx),%rax
+  801d33:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801d3a:	00 
+  801d3b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801d3f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801d46:	00 
+  801d47:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801d4b:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801d52:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801d53:	be 00 00 00 00       	mov    $0x0,%esi
+  801d58:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801d5d:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 43                	js     801db0 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801d6d:	49 8b 04 24          	mov    (%r12),%rax
+  801d71:	48 89 03             	mov    %rax,(%rbx)
+  801d74:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801d79:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801d7d:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801d82:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801d86:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801d8b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801d8f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801d93:	48 c1 e2 03          	shl    $0x3,%rdx
+  801d97:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801d9c:	4c 89 f7             	mov    %r14,%rdi
+  801d9f:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  801dab:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  801db0:	48 83 c4 08          	add    $0x8,%rsp
+  801db4:	5b                   	pop    %rbx
+  801db5:	41 5c                	pop    %r12
+  801db7:	41 5d                	pop    %r13
+  801db9:	41 5e                	pop    %r14
+  801dbb:	41 5f                	pop    %r15
+  801dbd:	5d                   	pop    %rbp
+  801dbe:	c3                   	ret
+        return -E_INVAL;
+  801dbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc4:	eb ea                	jmp    801db0 <devfile_diff_snapshots+0x11f>
+  801dc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dcb:	eb e3                	jmp    801db0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  801dcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd2:	eb dc                	jmp    801db0 <devfile_diff_snapshots+0x11f>
+  801dd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd9:	eb d5                	jmp    801db0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  801ddb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801de0:	c3                   	ret
+
+0000000000801de1 <devfile_delete_snapshot>:
+    if (!name) {
+  801de1:	48 85 ff             	test   %rdi,%rdi
+  801de4:	74 5f                	je     801e45 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  801de6:	55                   	push   %rbp
+  801de7:	48 89 e5             	mov    %rsp,%rbp
+  801dea:	53                   	push   %rbx
+  801deb:	48 83 ec 08          	sub    $0x8,%rsp
+  801def:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801df2:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801df9:	00 00 00 
+  801dfc:	ff d0                	call   *%rax
+  801dfe:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801e04:	77 45                	ja     801e4b <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  801e06:	48 89 de             	mov    %rbx,%rsi
+  801e09:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801e10:	00 00 00 
+  801e13:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  801e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e24:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801e29:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801e3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+        return -E_INVAL;
+  801e45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e4a:	c3                   	ret
+        return -E_INVAL;
+  801e4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e50:	eb ed                	jmp    801e3f <devfile_delete_snapshot+0x5e>
+
+0000000000801e52 <devfile_accept_snapshot>:
+    if (!name) {
+  801e52:	48 85 ff             	test   %rdi,%rdi
+  801e55:	74 5f                	je     801eb6 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801e57:	55                   	push   %rbp
+  801e58:	48 89 e5             	mov    %rsp,%rbp
+  801e5b:	53                   	push   %rbx
+  801e5c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e60:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801e63:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801e6a:	00 00 00 
+  801e6d:	ff d0                	call   *%rax
+  801e6f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801e75:	77 45                	ja     801ebc <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801e77:	48 89 de             	mov    %rbx,%rsi
+  801e7a:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801e81:	00 00 00 
+  801e84:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  801e8b:	00 00 00 
+  801e8e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801e90:	be 00 00 00 00       	mov    $0x0,%esi
+  801e95:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801e9a:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801ea1:	00 00 00 
+  801ea4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ead:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801eb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+        return -E_INVAL;
+  801eb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ebb:	c3                   	ret
+        return -E_INVAL;
+  801ebc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec1:	eb ed                	jmp    801eb0 <devfile_accept_snapshot+0x5e>
+
+0000000000801ec3 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  801ec3:	48 85 ff             	test   %rdi,%rdi
+  801ec6:	0f 84 9f 00 00 00    	je     801f6b <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  801ecc:	55                   	push   %rbp
+  801ecd:	48 89 e5             	mov    %rsp,%rbp
+  801ed0:	41 54                	push   %r12
+  801ed2:	53                   	push   %rbx
+  801ed3:	48 89 fb             	mov    %rdi,%rbx
+  801ed6:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  801ed9:	48 85 f6             	test   %rsi,%rsi
+  801edc:	74 78                	je     801f56 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  801ede:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801ee5:	00 00 00 
+  801ee8:	ff d0                	call   *%rax
+  801eea:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801ef0:	77 6b                	ja     801f5d <devfile_create_snapshot+0x9a>
+  801ef2:	4c 89 e7             	mov    %r12,%rdi
+  801ef5:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+  801f01:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801f07:	77 5b                	ja     801f64 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  801f09:	48 89 de             	mov    %rbx,%rsi
+  801f0c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801f13:	00 00 00 
+  801f16:	48 bb 22 02 80 00 00 	movabs $0x800222,%rbx
+  801f1d:	00 00 00 
+  801f20:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  801f22:	4c 89 e6             	mov    %r12,%rsi
+  801f25:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801f2c:	00 00 00 
+  801f2f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801f31:	be 00 00 00 00       	mov    $0x0,%esi
+  801f36:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f3b:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801f51:	5b                   	pop    %rbx
+  801f52:	41 5c                	pop    %r12
+  801f54:	5d                   	pop    %rbp
+  801f55:	c3                   	ret
+        return -E_INVAL;
+  801f56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5b:	eb f4                	jmp    801f51 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801f5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f62:	eb ed                	jmp    801f51 <devfile_create_snapshot+0x8e>
+  801f64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f69:	eb e6                	jmp    801f51 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801f6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f70:	c3                   	ret
+
+0000000000801f71 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801f71:	55                   	push   %rbp
+  801f72:	48 89 e5             	mov    %rsp,%rbp
+  801f75:	41 54                	push   %r12
+  801f77:	53                   	push   %rbx
+  801f78:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f7b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f7e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f85:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f87:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8c:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f91:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 3d                	js     801fde <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fa1:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801fa8:	00 00 00 
+  801fab:	4c 89 e6             	mov    %r12,%rsi
+  801fae:	48 89 df             	mov    %rbx,%rdi
+  801fb1:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801fbd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801fc4:	00 
+  801fc5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fcb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801fd2:	00 
+  801fd3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fde:	5b                   	pop    %rbx
+  801fdf:	41 5c                	pop    %r12
+  801fe1:	5d                   	pop    %rbp
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+  801fe7:	41 57                	push   %r15
+  801fe9:	41 56                	push   %r14
+  801feb:	41 55                	push   %r13
+  801fed:	41 54                	push   %r12
+  801fef:	53                   	push   %rbx
+  801ff0:	48 83 ec 38          	sub    $0x38,%rsp
+  801ff4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801ff8:	49 89 f5             	mov    %rsi,%r13
+  801ffb:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801ffe:	48 89 f0             	mov    %rsi,%rax
+  802001:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802006:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80200a:	75 4f                	jne    80205b <devfile_readmap+0x78>
+  80200c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802010:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802016:	75 1f                	jne    802037 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802018:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80201c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802020:	49 be cb 27 80 00 00 	movabs $0x8027cb,%r14
+  802027:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80202a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802031:	0f 87 9d 00 00 00    	ja     8020d4 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802037:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80203b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80203f:	4d 85 ff             	test   %r15,%r15
+  802042:	0f 85 cf 00 00 00    	jne    802117 <devfile_readmap+0x134>
+  802048:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80204c:	48 83 c4 38          	add    $0x38,%rsp
+  802050:	5b                   	pop    %rbx
+  802051:	41 5c                	pop    %r12
+  802053:	41 5d                	pop    %r13
+  802055:	41 5e                	pop    %r14
+  802057:	41 5f                	pop    %r15
+  802059:	5d                   	pop    %rbp
+  80205a:	c3                   	ret
+    size_t totalRead = 0;
+  80205b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802062:	00 
+  802063:	eb da                	jmp    80203f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802065:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802069:	8b 40 0c             	mov    0xc(%rax),%eax
+  80206c:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802073:	00 00 00 
+  802076:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207c:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802080:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802084:	4c 89 ee             	mov    %r13,%rsi
+  802087:	bf 14 00 00 00       	mov    $0x14,%edi
+  80208c:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  802093:	00 00 00 
+  802096:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802098:	85 c0                	test   %eax,%eax
+  80209a:	7e a3                	jle    80203f <devfile_readmap+0x5c>
+  80209c:	48 98                	cltq
+  80209e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8020a2:	72 9b                	jb     80203f <devfile_readmap+0x5c>
+        buf += read;
+  8020a4:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  8020a7:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  8020aa:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8020ae:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  8020b5:	75 88                	jne    80203f <devfile_readmap+0x5c>
+  8020b7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8020bb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8020c1:	0f 85 78 ff ff ff    	jne    80203f <devfile_readmap+0x5c>
+  8020c7:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  8020ce:	0f 86 6b ff ff ff    	jbe    80203f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8020d4:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8020da:	4d 39 e7             	cmp    %r12,%r15
+  8020dd:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8020e1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8020e8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8020ec:	0f 84 73 ff ff ff    	je     802065 <devfile_readmap+0x82>
+  8020f2:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8020f6:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8020fb:	41 ff d6             	call   *%r14
+  8020fe:	a8 40                	test   $0x40,%al
+  802100:	0f 85 39 ff ff ff    	jne    80203f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802106:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80210d:	4c 39 e3             	cmp    %r12,%rbx
+  802110:	72 e4                	jb     8020f6 <devfile_readmap+0x113>
+  802112:	e9 4e ff ff ff       	jmp    802065 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802117:	4c 89 fa             	mov    %r15,%rdx
+  80211a:	4c 89 ee             	mov    %r13,%rsi
+  80211d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802121:	48 b8 64 1a 80 00 00 	movabs $0x801a64,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  80212d:	48 85 c0             	test   %rax,%rax
+  802130:	78 0c                	js     80213e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802132:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802136:	48 01 f0             	add    %rsi,%rax
+  802139:	e9 0e ff ff ff       	jmp    80204c <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  80213e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802142:	48 85 f6             	test   %rsi,%rsi
+  802145:	48 0f 45 c6          	cmovne %rsi,%rax
+  802149:	e9 fe fe ff ff       	jmp    80204c <devfile_readmap+0x69>
+
+000000000080214e <open>:
+open(const char *path, int mode) {
+  80214e:	55                   	push   %rbp
+  80214f:	48 89 e5             	mov    %rsp,%rbp
+  802152:	41 55                	push   %r13
+  802154:	41 54                	push   %r12
+  802156:	53                   	push   %rbx
+  802157:	48 83 ec 18          	sub    $0x18,%rsp
+  80215b:	49 89 fc             	mov    %rdi,%r12
+  80215e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802161:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+  80216d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802173:	0f 87 8a 00 00 00    	ja     802203 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802179:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80217d:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+  802189:	89 c3                	mov    %eax,%ebx
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 50                	js     8021df <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80218f:	4c 89 e6             	mov    %r12,%rsi
+  802192:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802199:	00 00 00 
+  80219c:	48 89 df             	mov    %rbx,%rdi
+  80219f:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021ab:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021b2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021b6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021bb:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  8021c2:	00 00 00 
+  8021c5:	ff d0                	call   *%rax
+  8021c7:	89 c3                	mov    %eax,%ebx
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 1f                	js     8021ec <open+0x9e>
+    return fd2num(fd);
+  8021cd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021d1:	48 b8 7e 0c 80 00 00 	movabs $0x800c7e,%rax
+  8021d8:	00 00 00 
+  8021db:	ff d0                	call   *%rax
+  8021dd:	89 c3                	mov    %eax,%ebx
+}
+  8021df:	89 d8                	mov    %ebx,%eax
+  8021e1:	48 83 c4 18          	add    $0x18,%rsp
+  8021e5:	5b                   	pop    %rbx
+  8021e6:	41 5c                	pop    %r12
+  8021e8:	41 5d                	pop    %r13
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+        fd_close(fd, 0);
+  8021ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021f5:	48 b8 c7 0d 80 00 00 	movabs $0x800dc7,%rax
+  8021fc:	00 00 00 
+  8021ff:	ff d0                	call   *%rax
+        return res;
+  802201:	eb dc                	jmp    8021df <open+0x91>
+        return -E_BAD_PATH;
+  802203:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802208:	eb d5                	jmp    8021df <open+0x91>
+
+000000000080220a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80220a:	55                   	push   %rbp
+  80220b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80220e:	be 00 00 00 00       	mov    $0x0,%esi
+  802213:	bf 13 00 00 00       	mov    $0x13,%edi
+  802218:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+}
+  802224:	5d                   	pop    %rbp
+  802225:	c3                   	ret
+
+0000000000802226 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	41 54                	push   %r12
+  80222c:	53                   	push   %rbx
+  80222d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802230:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80223f:	48 be 60 38 80 00 00 	movabs $0x803860,%rsi
+  802246:	00 00 00 
+  802249:	48 89 df             	mov    %rbx,%rdi
+  80224c:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802258:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80225d:	41 2b 04 24          	sub    (%r12),%eax
+  802261:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802267:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80226e:	00 00 00 
+    stat->st_dev = &devpipe;
+  802271:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802278:	00 00 00 
+  80227b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+  802287:	5b                   	pop    %rbx
+  802288:	41 5c                	pop    %r12
+  80228a:	5d                   	pop    %rbp
+  80228b:	c3                   	ret
+
+000000000080228c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80228c:	55                   	push   %rbp
+  80228d:	48 89 e5             	mov    %rsp,%rbp
+  802290:	41 54                	push   %r12
+  802292:	53                   	push   %rbx
+  802293:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802296:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80229b:	48 89 fe             	mov    %rdi,%rsi
+  80229e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a3:	49 bc 7a 09 80 00 00 	movabs $0x80097a,%r12
+  8022aa:	00 00 00 
+  8022ad:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022b0:	48 89 df             	mov    %rbx,%rdi
+  8022b3:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  8022ba:	00 00 00 
+  8022bd:	ff d0                	call   *%rax
+  8022bf:	48 89 c6             	mov    %rax,%rsi
+  8022c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022cc:	41 ff d4             	call   *%r12
+}
+  8022cf:	5b                   	pop    %rbx
+  8022d0:	41 5c                	pop    %r12
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 57                	push   %r15
+  8022da:	41 56                	push   %r14
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e5:	49 89 fc             	mov    %rdi,%r12
+  8022e8:	49 89 f5             	mov    %rsi,%r13
+  8022eb:	49 89 d7             	mov    %rdx,%r15
+  8022ee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022f2:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8022fe:	4d 85 ff             	test   %r15,%r15
+  802301:	0f 84 af 00 00 00    	je     8023b6 <devpipe_write+0xe2>
+  802307:	48 89 c3             	mov    %rax,%rbx
+  80230a:	4c 89 f8             	mov    %r15,%rax
+  80230d:	4d 89 ef             	mov    %r13,%r15
+  802310:	4c 01 e8             	add    %r13,%rax
+  802313:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802317:	49 bd 82 08 80 00 00 	movabs $0x800882,%r13
+  80231e:	00 00 00 
+            sys_yield();
+  802321:	49 be 1f 08 80 00 00 	movabs $0x80081f,%r14
+  802328:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80232b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80232e:	48 63 ce             	movslq %esi,%rcx
+  802331:	48 63 03             	movslq (%rbx),%rax
+  802334:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80233a:	48 39 c1             	cmp    %rax,%rcx
+  80233d:	72 2e                	jb     80236d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80233f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802344:	48 89 da             	mov    %rbx,%rdx
+  802347:	be 00 10 00 00       	mov    $0x1000,%esi
+  80234c:	4c 89 e7             	mov    %r12,%rdi
+  80234f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802352:	85 c0                	test   %eax,%eax
+  802354:	74 66                	je     8023bc <devpipe_write+0xe8>
+            sys_yield();
+  802356:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802359:	8b 73 04             	mov    0x4(%rbx),%esi
+  80235c:	48 63 ce             	movslq %esi,%rcx
+  80235f:	48 63 03             	movslq (%rbx),%rax
+  802362:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802368:	48 39 c1             	cmp    %rax,%rcx
+  80236b:	73 d2                	jae    80233f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80236d:	41 0f b6 3f          	movzbl (%r15),%edi
+  802371:	48 89 ca             	mov    %rcx,%rdx
+  802374:	48 c1 ea 03          	shr    $0x3,%rdx
+  802378:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80237f:	08 10 20 
+  802382:	48 f7 e2             	mul    %rdx
+  802385:	48 c1 ea 06          	shr    $0x6,%rdx
+  802389:	48 89 d0             	mov    %rdx,%rax
+  80238c:	48 c1 e0 09          	shl    $0x9,%rax
+  802390:	48 29 d0             	sub    %rdx,%rax
+  802393:	48 c1 e0 03          	shl    $0x3,%rax
+  802397:	48 29 c1             	sub    %rax,%rcx
+  80239a:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80239f:	83 c6 01             	add    $0x1,%esi
+  8023a2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023a5:	49 83 c7 01          	add    $0x1,%r15
+  8023a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023ad:	49 39 c7             	cmp    %rax,%r15
+  8023b0:	0f 85 75 ff ff ff    	jne    80232b <devpipe_write+0x57>
+    return n;
+  8023b6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ba:	eb 05                	jmp    8023c1 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8023bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c1:	48 83 c4 18          	add    $0x18,%rsp
+  8023c5:	5b                   	pop    %rbx
+  8023c6:	41 5c                	pop    %r12
+  8023c8:	41 5d                	pop    %r13
+  8023ca:	41 5e                	pop    %r14
+  8023cc:	41 5f                	pop    %r15
+  8023ce:	5d                   	pop    %rbp
+  8023cf:	c3                   	ret
+
+00000000008023d0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023d0:	55                   	push   %rbp
+  8023d1:	48 89 e5             	mov    %rsp,%rbp
+  8023d4:	41 57                	push   %r15
+  8023d6:	41 56                	push   %r14
+  8023d8:	41 55                	push   %r13
+  8023da:	41 54                	push   %r12
+  8023dc:	53                   	push   %rbx
+  8023dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e1:	49 89 fc             	mov    %rdi,%r12
+  8023e4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8023e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023ec:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  8023f3:	00 00 00 
+  8023f6:	ff d0                	call   *%rax
+  8023f8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8023fb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802401:	49 bd 82 08 80 00 00 	movabs $0x800882,%r13
+  802408:	00 00 00 
+            sys_yield();
+  80240b:	49 be 1f 08 80 00 00 	movabs $0x80081f,%r14
+  802412:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802415:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80241a:	74 7d                	je     802499 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80241c:	8b 03                	mov    (%rbx),%eax
+  80241e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802421:	75 26                	jne    802449 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802423:	4d 85 ff             	test   %r15,%r15
+  802426:	75 77                	jne    80249f <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802428:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80242d:	48 89 da             	mov    %rbx,%rdx
+  802430:	be 00 10 00 00       	mov    $0x1000,%esi
+  802435:	4c 89 e7             	mov    %r12,%rdi
+  802438:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	74 72                	je     8024b1 <devpipe_read+0xe1>
+            sys_yield();
+  80243f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802442:	8b 03                	mov    (%rbx),%eax
+  802444:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802447:	74 df                	je     802428 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802449:	48 63 c8             	movslq %eax,%rcx
+  80244c:	48 89 ca             	mov    %rcx,%rdx
+  80244f:	48 c1 ea 03          	shr    $0x3,%rdx
+  802453:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80245a:	08 10 20 
+  80245d:	48 89 d0             	mov    %rdx,%rax
+  802460:	48 f7 e6             	mul    %rsi
+  802463:	48 c1 ea 06          	shr    $0x6,%rdx
+  802467:	48 89 d0             	mov    %rdx,%rax
+  80246a:	48 c1 e0 09          	shl    $0x9,%rax
+  80246e:	48 29 d0             	sub    %rdx,%rax
+  802471:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802478:	00 
+  802479:	48 89 c8             	mov    %rcx,%rax
+  80247c:	48 29 d0             	sub    %rdx,%rax
+  80247f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802484:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802488:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80248c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80248f:	49 83 c7 01          	add    $0x1,%r15
+  802493:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802497:	75 83                	jne    80241c <devpipe_read+0x4c>
+    return n;
+  802499:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80249d:	eb 03                	jmp    8024a2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80249f:	4c 89 f8             	mov    %r15,%rax
+}
+  8024a2:	48 83 c4 18          	add    $0x18,%rsp
+  8024a6:	5b                   	pop    %rbx
+  8024a7:	41 5c                	pop    %r12
+  8024a9:	41 5d                	pop    %r13
+  8024ab:	41 5e                	pop    %r14
+  8024ad:	41 5f                	pop    %r15
+  8024af:	5d                   	pop    %rbp
+  8024b0:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b6:	eb ea                	jmp    8024a2 <devpipe_read+0xd2>
+
+00000000008024b8 <pipe>:
+pipe(int pfd[2]) {
+  8024b8:	55                   	push   %rbp
+  8024b9:	48 89 e5             	mov    %rsp,%rbp
+  8024bc:	41 55                	push   %r13
+  8024be:	41 54                	push   %r12
+  8024c0:	53                   	push   %rbx
+  8024c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024c8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024cc:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	89 c3                	mov    %eax,%ebx
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	0f 88 a0 01 00 00    	js     802682 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8024e2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f5:	48 b8 ae 08 80 00 00 	movabs $0x8008ae,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802503:	85 c0                	test   %eax,%eax
+  802505:	0f 88 77 01 00 00    	js     802682 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80250b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80250f:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  802516:	00 00 00 
+  802519:	ff d0                	call   *%rax
+  80251b:	89 c3                	mov    %eax,%ebx
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	0f 88 43 01 00 00    	js     802668 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802525:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80252a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80252f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802533:	bf 00 00 00 00       	mov    $0x0,%edi
+  802538:	48 b8 ae 08 80 00 00 	movabs $0x8008ae,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802546:	85 c0                	test   %eax,%eax
+  802548:	0f 88 1a 01 00 00    	js     802668 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80254e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802552:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+  80255e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802561:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802566:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80256b:	48 89 c6             	mov    %rax,%rsi
+  80256e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802573:	48 b8 ae 08 80 00 00 	movabs $0x8008ae,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	89 c3                	mov    %eax,%ebx
+  802581:	85 c0                	test   %eax,%eax
+  802583:	0f 88 c5 00 00 00    	js     80264e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802589:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80258d:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+  802599:	48 89 c1             	mov    %rax,%rcx
+  80259c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8025a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ad:	4c 89 ee             	mov    %r13,%rsi
+  8025b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025b5:	48 b8 15 09 80 00 00 	movabs $0x800915,%rax
+  8025bc:	00 00 00 
+  8025bf:	ff d0                	call   *%rax
+  8025c1:	89 c3                	mov    %eax,%ebx
+  8025c3:	85 c0                	test   %eax,%eax
+  8025c5:	78 6e                	js     802635 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8025c7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025cc:	4c 89 ef             	mov    %r13,%rdi
+  8025cf:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  8025d6:	00 00 00 
+  8025d9:	ff d0                	call   *%rax
+  8025db:	83 f8 02             	cmp    $0x2,%eax
+  8025de:	0f 85 ab 00 00 00    	jne    80268f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8025e4:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  8025eb:	00 00 
+  8025ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025f1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8025f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025f7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8025fe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802602:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802604:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802608:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80260f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802613:	48 bb 7e 0c 80 00 00 	movabs $0x800c7e,%rbx
+  80261a:	00 00 00 
+  80261d:	ff d3                	call   *%rbx
+  80261f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802623:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802627:	ff d3                	call   *%rbx
+  802629:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80262e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802633:	eb 4d                	jmp    802682 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802635:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80263a:	4c 89 ee             	mov    %r13,%rsi
+  80263d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802642:	48 b8 7a 09 80 00 00 	movabs $0x80097a,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80264e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802653:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802657:	bf 00 00 00 00       	mov    $0x0,%edi
+  80265c:	48 b8 7a 09 80 00 00 	movabs $0x80097a,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802668:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80266d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802671:	bf 00 00 00 00       	mov    $0x0,%edi
+  802676:	48 b8 7a 09 80 00 00 	movabs $0x80097a,%rax
+  80267d:	00 00 00 
+  802680:	ff d0                	call   *%rax
+}
+  802682:	89 d8                	mov    %ebx,%eax
+  802684:	48 83 c4 18          	add    $0x18,%rsp
+  802688:	5b                   	pop    %rbx
+  802689:	41 5c                	pop    %r12
+  80268b:	41 5d                	pop    %r13
+  80268d:	5d                   	pop    %rbp
+  80268e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80268f:	48 b9 90 38 80 00 00 	movabs $0x803890,%rcx
+  802696:	00 00 00 
+  802699:	48 ba 67 38 80 00 00 	movabs $0x803867,%rdx
+  8026a0:	00 00 00 
+  8026a3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8026a8:	48 bf 7c 38 80 00 00 	movabs $0x80387c,%rdi
+  8026af:	00 00 00 
+  8026b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b7:	49 b8 0f 2b 80 00 00 	movabs $0x802b0f,%r8
+  8026be:	00 00 00 
+  8026c1:	41 ff d0             	call   *%r8
+
+00000000008026c4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8026c4:	55                   	push   %rbp
+  8026c5:	48 89 e5             	mov    %rsp,%rbp
+  8026c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026d0:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	78 35                	js     802715 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026e4:	48 b8 90 0c 80 00 00 	movabs $0x800c90,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026f3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026f8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802701:	48 b8 82 08 80 00 00 	movabs $0x800882,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	0f 94 c0             	sete   %al
+  802712:	0f b6 c0             	movzbl %al,%eax
+}
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+0000000000802717 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802717:	48 89 f8             	mov    %rdi,%rax
+  80271a:	48 c1 e8 27          	shr    $0x27,%rax
+  80271e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802725:	01 00 00 
+  802728:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80272c:	f6 c2 01             	test   $0x1,%dl
+  80272f:	74 6d                	je     80279e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802731:	48 89 f8             	mov    %rdi,%rax
+  802734:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802738:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80273f:	01 00 00 
+  802742:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802746:	f6 c2 01             	test   $0x1,%dl
+  802749:	74 62                	je     8027ad <get_uvpt_entry+0x96>
+  80274b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802752:	01 00 00 
+  802755:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802759:	f6 c2 80             	test   $0x80,%dl
+  80275c:	75 4f                	jne    8027ad <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80275e:	48 89 f8             	mov    %rdi,%rax
+  802761:	48 c1 e8 15          	shr    $0x15,%rax
+  802765:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80276c:	01 00 00 
+  80276f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802773:	f6 c2 01             	test   $0x1,%dl
+  802776:	74 44                	je     8027bc <get_uvpt_entry+0xa5>
+  802778:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80277f:	01 00 00 
+  802782:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802786:	f6 c2 80             	test   $0x80,%dl
+  802789:	75 31                	jne    8027bc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80278b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80278f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802796:	01 00 00 
+  802799:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80279d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80279e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027a5:	01 00 00 
+  8027a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ac:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027ad:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027b4:	01 00 00 
+  8027b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027bb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027bc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027c3:	01 00 00 
+  8027c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ca:	c3                   	ret
+
+00000000008027cb <get_prot>:
+
+int
+get_prot(void *va) {
+  8027cb:	55                   	push   %rbp
+  8027cc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027cf:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8027d6:	00 00 00 
+  8027d9:	ff d0                	call   *%rax
+  8027db:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027de:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027e3:	89 c1                	mov    %eax,%ecx
+  8027e5:	83 c9 04             	or     $0x4,%ecx
+  8027e8:	f6 c2 01             	test   $0x1,%dl
+  8027eb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8027ee:	89 c1                	mov    %eax,%ecx
+  8027f0:	83 c9 02             	or     $0x2,%ecx
+  8027f3:	f6 c2 02             	test   $0x2,%dl
+  8027f6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8027f9:	89 c1                	mov    %eax,%ecx
+  8027fb:	83 c9 01             	or     $0x1,%ecx
+  8027fe:	48 85 d2             	test   %rdx,%rdx
+  802801:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802804:	89 c1                	mov    %eax,%ecx
+  802806:	83 c9 40             	or     $0x40,%ecx
+  802809:	f6 c6 04             	test   $0x4,%dh
+  80280c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80280f:	5d                   	pop    %rbp
+  802810:	c3                   	ret
+
+0000000000802811 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802811:	55                   	push   %rbp
+  802812:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802815:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  80281c:	00 00 00 
+  80281f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802821:	48 c1 e8 06          	shr    $0x6,%rax
+  802825:	83 e0 01             	and    $0x1,%eax
+}
+  802828:	5d                   	pop    %rbp
+  802829:	c3                   	ret
+
+000000000080282a <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80282a:	55                   	push   %rbp
+  80282b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80282e:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  802835:	00 00 00 
+  802838:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80283a:	48 c1 e8 05          	shr    $0x5,%rax
+  80283e:	83 e0 01             	and    $0x1,%eax
+}
+  802841:	5d                   	pop    %rbp
+  802842:	c3                   	ret
+
+0000000000802843 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802843:	55                   	push   %rbp
+  802844:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802847:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+  802853:	83 e0 01             	and    $0x1,%eax
+}
+  802856:	5d                   	pop    %rbp
+  802857:	c3                   	ret
+
+0000000000802858 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802858:	55                   	push   %rbp
+  802859:	48 89 e5             	mov    %rsp,%rbp
+  80285c:	41 57                	push   %r15
+  80285e:	41 56                	push   %r14
+  802860:	41 55                	push   %r13
+  802862:	41 54                	push   %r12
+  802864:	53                   	push   %rbx
+  802865:	48 83 ec 18          	sub    $0x18,%rsp
+  802869:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80286d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802871:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802876:	49 bd 43 28 80 00 00 	movabs $0x802843,%r13
+  80287d:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802880:	49 bf cb 27 80 00 00 	movabs $0x8027cb,%r15
+  802887:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80288a:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802891:	00 00 00 
+  802894:	eb 0c                	jmp    8028a2 <foreach_shared_region+0x4a>
+  802896:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80289d:	4c 39 f3             	cmp    %r14,%rbx
+  8028a0:	74 2e                	je     8028d0 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8028a2:	48 89 df             	mov    %rbx,%rdi
+  8028a5:	41 ff d5             	call   *%r13
+  8028a8:	84 c0                	test   %al,%al
+  8028aa:	74 ea                	je     802896 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8028ac:	48 89 df             	mov    %rbx,%rdi
+  8028af:	41 ff d7             	call   *%r15
+  8028b2:	a8 40                	test   $0x40,%al
+  8028b4:	74 e0                	je     802896 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8028b6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028c1:	48 89 df             	mov    %rbx,%rdi
+  8028c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c8:	ff d0                	call   *%rax
+				if (res < 0) {
+  8028ca:	85 c0                	test   %eax,%eax
+  8028cc:	79 c8                	jns    802896 <foreach_shared_region+0x3e>
+  8028ce:	eb 05                	jmp    8028d5 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8028d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d5:	48 83 c4 18          	add    $0x18,%rsp
+  8028d9:	5b                   	pop    %rbx
+  8028da:	41 5c                	pop    %r12
+  8028dc:	41 5d                	pop    %r13
+  8028de:	41 5e                	pop    %r14
+  8028e0:	41 5f                	pop    %r15
+  8028e2:	5d                   	pop    %rbp
+  8028e3:	c3                   	ret
+
+00000000008028e4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8028e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e9:	c3                   	ret
+
+00000000008028ea <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8028ea:	55                   	push   %rbp
+  8028eb:	48 89 e5             	mov    %rsp,%rbp
+  8028ee:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8028f1:	48 be b4 38 80 00 00 	movabs $0x8038b4,%rsi
+  8028f8:	00 00 00 
+  8028fb:	48 b8 22 02 80 00 00 	movabs $0x800222,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+    return 0;
+}
+  802907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290c:	5d                   	pop    %rbp
+  80290d:	c3                   	ret
+
+000000000080290e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80290e:	55                   	push   %rbp
+  80290f:	48 89 e5             	mov    %rsp,%rbp
+  802912:	41 57                	push   %r15
+  802914:	41 56                	push   %r14
+  802916:	41 55                	push   %r13
+  802918:	41 54                	push   %r12
+  80291a:	53                   	push   %rbx
+  80291b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802922:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802929:	48 85 d2             	test   %rdx,%rdx
+  80292c:	74 7a                	je     8029a8 <devcons_write+0x9a>
+  80292e:	49 89 d6             	mov    %rdx,%r14
+  802931:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802937:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80293c:	49 bf 1c 04 80 00 00 	movabs $0x80041c,%r15
+  802943:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802946:	4c 89 f3             	mov    %r14,%rbx
+  802949:	48 29 f3             	sub    %rsi,%rbx
+  80294c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802951:	48 39 c3             	cmp    %rax,%rbx
+  802954:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802958:	4c 63 eb             	movslq %ebx,%r13
+  80295b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802962:	48 01 c6             	add    %rax,%rsi
+  802965:	4c 89 ea             	mov    %r13,%rdx
+  802968:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80296f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802972:	4c 89 ee             	mov    %r13,%rsi
+  802975:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80297c:	48 b8 25 07 80 00 00 	movabs $0x800725,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802988:	41 01 dc             	add    %ebx,%r12d
+  80298b:	49 63 f4             	movslq %r12d,%rsi
+  80298e:	4c 39 f6             	cmp    %r14,%rsi
+  802991:	72 b3                	jb     802946 <devcons_write+0x38>
+    return res;
+  802993:	49 63 c4             	movslq %r12d,%rax
+}
+  802996:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80299d:	5b                   	pop    %rbx
+  80299e:	41 5c                	pop    %r12
+  8029a0:	41 5d                	pop    %r13
+  8029a2:	41 5e                	pop    %r14
+  8029a4:	41 5f                	pop    %r15
+  8029a6:	5d                   	pop    %rbp
+  8029a7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8029a8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029ae:	eb e3                	jmp    802993 <devcons_write+0x85>
+
+00000000008029b0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029b0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8029b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b8:	48 85 c0             	test   %rax,%rax
+  8029bb:	74 55                	je     802a12 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029bd:	55                   	push   %rbp
+  8029be:	48 89 e5             	mov    %rsp,%rbp
+  8029c1:	41 55                	push   %r13
+  8029c3:	41 54                	push   %r12
+  8029c5:	53                   	push   %rbx
+  8029c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ca:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8029cd:	48 bb 52 07 80 00 00 	movabs $0x800752,%rbx
+  8029d4:	00 00 00 
+  8029d7:	49 bc 1f 08 80 00 00 	movabs $0x80081f,%r12
+  8029de:	00 00 00 
+  8029e1:	eb 03                	jmp    8029e6 <devcons_read+0x36>
+  8029e3:	41 ff d4             	call   *%r12
+  8029e6:	ff d3                	call   *%rbx
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	74 f7                	je     8029e3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8029ec:	48 63 d0             	movslq %eax,%rdx
+  8029ef:	78 13                	js     802a04 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8029f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f6:	83 f8 04             	cmp    $0x4,%eax
+  8029f9:	74 09                	je     802a04 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8029fb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8029ff:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802a04:	48 89 d0             	mov    %rdx,%rax
+  802a07:	48 83 c4 08          	add    $0x8,%rsp
+  802a0b:	5b                   	pop    %rbx
+  802a0c:	41 5c                	pop    %r12
+  802a0e:	41 5d                	pop    %r13
+  802a10:	5d                   	pop    %rbp
+  802a11:	c3                   	ret
+  802a12:	48 89 d0             	mov    %rdx,%rax
+  802a15:	c3                   	ret
+
+0000000000802a16 <cputchar>:
+cputchar(int ch) {
+  802a16:	55                   	push   %rbp
+  802a17:	48 89 e5             	mov    %rsp,%rbp
+  802a1a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802a1e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802a22:	be 01 00 00 00       	mov    $0x1,%esi
+  802a27:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802a2b:	48 b8 25 07 80 00 00 	movabs $0x800725,%rax
+  802a32:	00 00 00 
+  802a35:	ff d0                	call   *%rax
+}
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+0000000000802a39 <getchar>:
+getchar(void) {
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802a41:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a46:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a4f:	48 b8 ef 0f 80 00 00 	movabs $0x800fef,%rax
+  802a56:	00 00 00 
+  802a59:	ff d0                	call   *%rax
+  802a5b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a5d:	85 c0                	test   %eax,%eax
+  802a5f:	78 06                	js     802a67 <getchar+0x2e>
+  802a61:	74 08                	je     802a6b <getchar+0x32>
+  802a63:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a67:	89 d0                	mov    %edx,%eax
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a6b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a70:	eb f5                	jmp    802a67 <getchar+0x2e>
+
+0000000000802a72 <iscons>:
+iscons(int fdnum) {
+  802a72:	55                   	push   %rbp
+  802a73:	48 89 e5             	mov    %rsp,%rbp
+  802a76:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a7e:	48 b8 0c 0d 80 00 00 	movabs $0x800d0c,%rax
+  802a85:	00 00 00 
+  802a88:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	78 18                	js     802aa6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a8e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a92:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802a99:	00 00 00 
+  802a9c:	8b 00                	mov    (%rax),%eax
+  802a9e:	39 02                	cmp    %eax,(%rdx)
+  802aa0:	0f 94 c0             	sete   %al
+  802aa3:	0f b6 c0             	movzbl %al,%eax
+}
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+0000000000802aa8 <opencons>:
+opencons(void) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ab0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ab4:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+  802ac0:	85 c0                	test   %eax,%eax
+  802ac2:	78 49                	js     802b0d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ac4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ac9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ace:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ad2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad7:	48 b8 ae 08 80 00 00 	movabs $0x8008ae,%rax
+  802ade:	00 00 00 
+  802ae1:	ff d0                	call   *%rax
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	78 26                	js     802b0d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ae7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aeb:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  802af2:	00 00 
+  802af4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802af6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802afa:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802b01:	48 b8 7e 0c 80 00 00 	movabs $0x800c7e,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+}
+  802b0d:	c9                   	leave
+  802b0e:	c3                   	ret
+
+0000000000802b0f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802b0f:	55                   	push   %rbp
+  802b10:	48 89 e5             	mov    %rsp,%rbp
+  802b13:	41 56                	push   %r14
+  802b15:	41 55                	push   %r13
+  802b17:	41 54                	push   %r12
+  802b19:	53                   	push   %rbx
+  802b1a:	48 83 ec 50          	sub    $0x50,%rsp
+  802b1e:	49 89 fc             	mov    %rdi,%r12
+  802b21:	41 89 f5             	mov    %esi,%r13d
+  802b24:	48 89 d3             	mov    %rdx,%rbx
+  802b27:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802b2b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802b2f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802b33:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802b3a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b3e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b42:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802b46:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802b4a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802b51:	00 00 00 
+  802b54:	4c 8b 30             	mov    (%rax),%r14
+  802b57:	48 b8 ee 07 80 00 00 	movabs $0x8007ee,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+  802b63:	89 c6                	mov    %eax,%esi
+  802b65:	45 89 e8             	mov    %r13d,%r8d
+  802b68:	4c 89 e1             	mov    %r12,%rcx
+  802b6b:	4c 89 f2             	mov    %r14,%rdx
+  802b6e:	48 bf c0 38 80 00 00 	movabs $0x8038c0,%rdi
+  802b75:	00 00 00 
+  802b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7d:	49 bc 5f 2c 80 00 00 	movabs $0x802c5f,%r12
+  802b84:	00 00 00 
+  802b87:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802b8a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802b8e:	48 89 df             	mov    %rbx,%rdi
+  802b91:	48 b8 fb 2b 80 00 00 	movabs $0x802bfb,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+    cprintf("\n");
+  802b9d:	48 bf 1b 38 80 00 00 	movabs $0x80381b,%rdi
+  802ba4:	00 00 00 
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802baf:	cc                   	int3
+  802bb0:	eb fd                	jmp    802baf <_panic+0xa0>
+
+0000000000802bb2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	53                   	push   %rbx
+  802bb7:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802bbe:	8b 06                	mov    (%rsi),%eax
+  802bc0:	8d 50 01             	lea    0x1(%rax),%edx
+  802bc3:	89 16                	mov    %edx,(%rsi)
+  802bc5:	48 98                	cltq
+  802bc7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802bcc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802bd2:	74 0a                	je     802bde <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802bd4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802bd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdc:	c9                   	leave
+  802bdd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802bde:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802be2:	be ff 00 00 00       	mov    $0xff,%esi
+  802be7:	48 b8 25 07 80 00 00 	movabs $0x800725,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+        state->offset = 0;
+  802bf3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802bf9:	eb d9                	jmp    802bd4 <putch+0x22>
+
+0000000000802bfb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802c06:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802c09:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802c10:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802c1d:	48 89 f1             	mov    %rsi,%rcx
+  802c20:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802c27:	48 bf b2 2b 80 00 00 	movabs $0x802bb2,%rdi
+  802c2e:	00 00 00 
+  802c31:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  802c38:	00 00 00 
+  802c3b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802c3d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802c44:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802c4b:	48 b8 25 07 80 00 00 	movabs $0x800725,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802c57:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802c5d:	c9                   	leave
+  802c5e:	c3                   	ret
+
+0000000000802c5f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802c5f:	55                   	push   %rbp
+  802c60:	48 89 e5             	mov    %rsp,%rbp
+  802c63:	48 83 ec 50          	sub    $0x50,%rsp
+  802c67:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802c6b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802c6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802c73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802c77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802c7b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802c82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c8a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802c8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802c92:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802c96:	48 b8 fb 2b 80 00 00 	movabs $0x802bfb,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802ca2:	c9                   	leave
+  802ca3:	c3                   	ret
+
+0000000000802ca4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802ca4:	55                   	push   %rbp
+  802ca5:	48 89 e5             	mov    %rsp,%rbp
+  802ca8:	41 57                	push   %r15
+  802caa:	41 56                	push   %r14
+  802cac:	41 55                	push   %r13
+  802cae:	41 54                	push   %r12
+  802cb0:	53                   	push   %rbx
+  802cb1:	48 83 ec 18          	sub    $0x18,%rsp
+  802cb5:	49 89 fc             	mov    %rdi,%r12
+  802cb8:	49 89 f5             	mov    %rsi,%r13
+  802cbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802cbf:	8b 45 10             	mov    0x10(%rbp),%eax
+  802cc2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802cc5:	41 89 cf             	mov    %ecx,%r15d
+  802cc8:	4c 39 fa             	cmp    %r15,%rdx
+  802ccb:	73 5b                	jae    802d28 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802ccd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802cd1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802cd5:	85 db                	test   %ebx,%ebx
+  802cd7:	7e 0e                	jle    802ce7 <print_num+0x43>
+            putch(padc, put_arg);
+  802cd9:	4c 89 ee             	mov    %r13,%rsi
+  802cdc:	44 89 f7             	mov    %r14d,%edi
+  802cdf:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802ce2:	83 eb 01             	sub    $0x1,%ebx
+  802ce5:	75 f2                	jne    802cd9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802ce7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802ceb:	48 b9 f4 38 80 00 00 	movabs $0x8038f4,%rcx
+  802cf2:	00 00 00 
+  802cf5:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  802cfc:	00 00 00 
+  802cff:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802d03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0c:	49 f7 f7             	div    %r15
+  802d0f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802d13:	4c 89 ee             	mov    %r13,%rsi
+  802d16:	41 ff d4             	call   *%r12
+}
+  802d19:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d1d:	5b                   	pop    %rbx
+  802d1e:	41 5c                	pop    %r12
+  802d20:	41 5d                	pop    %r13
+  802d22:	41 5e                	pop    %r14
+  802d24:	41 5f                	pop    %r15
+  802d26:	5d                   	pop    %rbp
+  802d27:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802d28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d31:	49 f7 f7             	div    %r15
+  802d34:	48 83 ec 08          	sub    $0x8,%rsp
+  802d38:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802d3c:	52                   	push   %rdx
+  802d3d:	45 0f be c9          	movsbl %r9b,%r9d
+  802d41:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802d45:	48 89 c2             	mov    %rax,%rdx
+  802d48:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+  802d54:	48 83 c4 10          	add    $0x10,%rsp
+  802d58:	eb 8d                	jmp    802ce7 <print_num+0x43>
+
+0000000000802d5a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802d5a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802d5e:	48 8b 06             	mov    (%rsi),%rax
+  802d61:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802d65:	73 0a                	jae    802d71 <sprintputch+0x17>
+        *state->start++ = ch;
+  802d67:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802d6b:	48 89 16             	mov    %rdx,(%rsi)
+  802d6e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802d71:	c3                   	ret
+
+0000000000802d72 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	48 83 ec 50          	sub    $0x50,%rsp
+  802d7a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d7e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d82:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802d86:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802d8d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d95:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d99:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802d9d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802da1:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+}
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+
+0000000000802daf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802daf:	55                   	push   %rbp
+  802db0:	48 89 e5             	mov    %rsp,%rbp
+  802db3:	41 57                	push   %r15
+  802db5:	41 56                	push   %r14
+  802db7:	41 55                	push   %r13
+  802db9:	41 54                	push   %r12
+  802dbb:	53                   	push   %rbx
+  802dbc:	48 83 ec 38          	sub    $0x38,%rsp
+  802dc0:	49 89 fe             	mov    %rdi,%r14
+  802dc3:	49 89 f5             	mov    %rsi,%r13
+  802dc6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802dc9:	48 8b 01             	mov    (%rcx),%rax
+  802dcc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dd0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802dd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dd8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802ddc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802de0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802de4:	0f b6 3b             	movzbl (%rbx),%edi
+  802de7:	40 80 ff 25          	cmp    $0x25,%dil
+  802deb:	74 18                	je     802e05 <vprintfmt+0x56>
+            if (!ch) return;
+  802ded:	40 84 ff             	test   %dil,%dil
+  802df0:	0f 84 b1 06 00 00    	je     8034a7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802df6:	40 0f b6 ff          	movzbl %dil,%edi
+  802dfa:	4c 89 ee             	mov    %r13,%rsi
+  802dfd:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802e00:	4c 89 e3             	mov    %r12,%rbx
+  802e03:	eb db                	jmp    802de0 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802e05:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802e13:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802e19:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802e20:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802e24:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802e29:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802e2e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802e31:	83 e8 23             	sub    $0x23,%eax
+  802e34:	3c 57                	cmp    $0x57,%al
+  802e36:	0f 87 51 06 00 00    	ja     80348d <vprintfmt+0x6de>
+  802e3c:	0f b6 c0             	movzbl %al,%eax
+  802e3f:	48 b9 80 3a 80 00 00 	movabs $0x803a80,%rcx
+  802e46:	00 00 00 
+  802e49:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802e4c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802e4f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802e53:	eb cf                	jmp    802e24 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802e55:	49 89 dc             	mov    %rbx,%r12
+  802e58:	be 01 00 00 00       	mov    $0x1,%esi
+  802e5d:	eb c5                	jmp    802e24 <vprintfmt+0x75>
+            padc = ch;
+  802e5f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802e63:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802e66:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802e69:	eb b9                	jmp    802e24 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802e6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e6e:	83 f8 2f             	cmp    $0x2f,%eax
+  802e71:	77 24                	ja     802e97 <vprintfmt+0xe8>
+  802e73:	89 c1                	mov    %eax,%ecx
+  802e75:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802e79:	83 c0 08             	add    $0x8,%eax
+  802e7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e7f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802e82:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802e85:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802e89:	79 99                	jns    802e24 <vprintfmt+0x75>
+                width = precision;
+  802e8b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802e8f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802e95:	eb 8d                	jmp    802e24 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802e97:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e9b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802e9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea3:	eb da                	jmp    802e7f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802ea5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802eaa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802eae:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802eb4:	3c 39                	cmp    $0x39,%al
+  802eb6:	77 1c                	ja     802ed4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802eb8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802ebc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802ec0:	0f b6 c0             	movzbl %al,%eax
+  802ec3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802ec8:	0f b6 03             	movzbl (%rbx),%eax
+  802ecb:	3c 39                	cmp    $0x39,%al
+  802ecd:	76 e9                	jbe    802eb8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802ecf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802ed2:	eb b1                	jmp    802e85 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802ed4:	49 89 dc             	mov    %rbx,%r12
+  802ed7:	eb ac                	jmp    802e85 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802ed9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802edc:	85 c9                	test   %ecx,%ecx
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee3:	0f 49 c1             	cmovns %ecx,%eax
+  802ee6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802ee9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802eec:	e9 33 ff ff ff       	jmp    802e24 <vprintfmt+0x75>
+            lflag++;
+  802ef1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802ef4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802ef7:	e9 28 ff ff ff       	jmp    802e24 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802efc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802eff:	83 f8 2f             	cmp    $0x2f,%eax
+  802f02:	77 19                	ja     802f1d <vprintfmt+0x16e>
+  802f04:	89 c2                	mov    %eax,%edx
+  802f06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f0a:	83 c0 08             	add    $0x8,%eax
+  802f0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f10:	8b 3a                	mov    (%rdx),%edi
+  802f12:	4c 89 ee             	mov    %r13,%rsi
+  802f15:	41 ff d6             	call   *%r14
+            break;
+  802f18:	e9 c3 fe ff ff       	jmp    802de0 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802f1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802f25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f29:	eb e5                	jmp    802f10 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802f2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f2e:	83 f8 2f             	cmp    $0x2f,%eax
+  802f31:	77 5a                	ja     802f8d <vprintfmt+0x1de>
+  802f33:	89 c2                	mov    %eax,%edx
+  802f35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f39:	83 c0 08             	add    $0x8,%eax
+  802f3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802f3f:	8b 02                	mov    (%rdx),%eax
+  802f41:	89 c1                	mov    %eax,%ecx
+  802f43:	f7 d9                	neg    %ecx
+  802f45:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802f48:	83 f9 14             	cmp    $0x14,%ecx
+  802f4b:	7f 4e                	jg     802f9b <vprintfmt+0x1ec>
+  802f4d:	48 63 c1             	movslq %ecx,%rax
+  802f50:	48 ba 40 3d 80 00 00 	movabs $0x803d40,%rdx
+  802f57:	00 00 00 
+  802f5a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f5e:	48 85 c0             	test   %rax,%rax
+  802f61:	74 38                	je     802f9b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802f63:	48 89 c1             	mov    %rax,%rcx
+  802f66:	48 ba 79 38 80 00 00 	movabs $0x803879,%rdx
+  802f6d:	00 00 00 
+  802f70:	4c 89 ee             	mov    %r13,%rsi
+  802f73:	4c 89 f7             	mov    %r14,%rdi
+  802f76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7b:	49 b8 72 2d 80 00 00 	movabs $0x802d72,%r8
+  802f82:	00 00 00 
+  802f85:	41 ff d0             	call   *%r8
+  802f88:	e9 53 fe ff ff       	jmp    802de0 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802f8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802f95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f99:	eb a4                	jmp    802f3f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802f9b:	48 ba 0c 39 80 00 00 	movabs $0x80390c,%rdx
+  802fa2:	00 00 00 
+  802fa5:	4c 89 ee             	mov    %r13,%rsi
+  802fa8:	4c 89 f7             	mov    %r14,%rdi
+  802fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb0:	49 b8 72 2d 80 00 00 	movabs $0x802d72,%r8
+  802fb7:	00 00 00 
+  802fba:	41 ff d0             	call   *%r8
+  802fbd:	e9 1e fe ff ff       	jmp    802de0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802fc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fc5:	83 f8 2f             	cmp    $0x2f,%eax
+  802fc8:	77 6c                	ja     803036 <vprintfmt+0x287>
+  802fca:	89 c2                	mov    %eax,%edx
+  802fcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fd0:	83 c0 08             	add    $0x8,%eax
+  802fd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fd6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802fd9:	48 85 d2             	test   %rdx,%rdx
+  802fdc:	48 b8 05 39 80 00 00 	movabs $0x803905,%rax
+  802fe3:	00 00 00 
+  802fe6:	48 0f 45 c2          	cmovne %rdx,%rax
+  802fea:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802fee:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802ff2:	7e 06                	jle    802ffa <vprintfmt+0x24b>
+  802ff4:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802ff8:	75 4a                	jne    803044 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802ffa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ffe:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803002:	0f b6 00             	movzbl (%rax),%eax
+  803005:	84 c0                	test   %al,%al
+  803007:	0f 85 9a 00 00 00    	jne    8030a7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80300d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803010:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803014:	85 c0                	test   %eax,%eax
+  803016:	0f 8e c4 fd ff ff    	jle    802de0 <vprintfmt+0x31>
+  80301c:	4c 89 ee             	mov    %r13,%rsi
+  80301f:	bf 20 00 00 00       	mov    $0x20,%edi
+  803024:	41 ff d6             	call   *%r14
+  803027:	41 83 ec 01          	sub    $0x1,%r12d
+  80302b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80302f:	75 eb                	jne    80301c <vprintfmt+0x26d>
+  803031:	e9 aa fd ff ff       	jmp    802de0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803036:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80303a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80303e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803042:	eb 92                	jmp    802fd6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803044:	49 63 f7             	movslq %r15d,%rsi
+  803047:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80304b:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+  803057:	48 89 c2             	mov    %rax,%rdx
+  80305a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80305d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80305f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803062:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803065:	85 c0                	test   %eax,%eax
+  803067:	7e 91                	jle    802ffa <vprintfmt+0x24b>
+  803069:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80306e:	4c 89 ee             	mov    %r13,%rsi
+  803071:	44 89 e7             	mov    %r12d,%edi
+  803074:	41 ff d6             	call   *%r14
+  803077:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80307b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80307e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803081:	75 eb                	jne    80306e <vprintfmt+0x2bf>
+  803083:	e9 72 ff ff ff       	jmp    802ffa <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803088:	0f b6 f8             	movzbl %al,%edi
+  80308b:	4c 89 ee             	mov    %r13,%rsi
+  80308e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803091:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803095:	49 83 c4 01          	add    $0x1,%r12
+  803099:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80309f:	84 c0                	test   %al,%al
+  8030a1:	0f 84 66 ff ff ff    	je     80300d <vprintfmt+0x25e>
+  8030a7:	45 85 ff             	test   %r15d,%r15d
+  8030aa:	78 0a                	js     8030b6 <vprintfmt+0x307>
+  8030ac:	41 83 ef 01          	sub    $0x1,%r15d
+  8030b0:	0f 88 57 ff ff ff    	js     80300d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8030b6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8030ba:	74 cc                	je     803088 <vprintfmt+0x2d9>
+  8030bc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8030bf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8030c4:	80 fa 5e             	cmp    $0x5e,%dl
+  8030c7:	77 c2                	ja     80308b <vprintfmt+0x2dc>
+  8030c9:	eb bd                	jmp    803088 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8030cb:	40 84 f6             	test   %sil,%sil
+  8030ce:	75 26                	jne    8030f6 <vprintfmt+0x347>
+    switch (lflag) {
+  8030d0:	85 d2                	test   %edx,%edx
+  8030d2:	74 59                	je     80312d <vprintfmt+0x37e>
+  8030d4:	83 fa 01             	cmp    $0x1,%edx
+  8030d7:	74 7b                	je     803154 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8030d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8030df:	0f 87 96 00 00 00    	ja     80317b <vprintfmt+0x3cc>
+  8030e5:	89 c2                	mov    %eax,%edx
+  8030e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8030eb:	83 c0 08             	add    $0x8,%eax
+  8030ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8030f1:	4c 8b 22             	mov    (%rdx),%r12
+  8030f4:	eb 17                	jmp    80310d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8030f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8030fc:	77 21                	ja     80311f <vprintfmt+0x370>
+  8030fe:	89 c2                	mov    %eax,%edx
+  803100:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803104:	83 c0 08             	add    $0x8,%eax
+  803107:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80310a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80310d:	4d 85 e4             	test   %r12,%r12
+  803110:	78 7a                	js     80318c <vprintfmt+0x3dd>
+            num = i;
+  803112:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803115:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80311a:	e9 50 02 00 00       	jmp    80336f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80311f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803123:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803127:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80312b:	eb dd                	jmp    80310a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80312d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803130:	83 f8 2f             	cmp    $0x2f,%eax
+  803133:	77 11                	ja     803146 <vprintfmt+0x397>
+  803135:	89 c2                	mov    %eax,%edx
+  803137:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80313b:	83 c0 08             	add    $0x8,%eax
+  80313e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803141:	4c 63 22             	movslq (%rdx),%r12
+  803144:	eb c7                	jmp    80310d <vprintfmt+0x35e>
+  803146:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80314a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80314e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803152:	eb ed                	jmp    803141 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803154:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803157:	83 f8 2f             	cmp    $0x2f,%eax
+  80315a:	77 11                	ja     80316d <vprintfmt+0x3be>
+  80315c:	89 c2                	mov    %eax,%edx
+  80315e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803162:	83 c0 08             	add    $0x8,%eax
+  803165:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803168:	4c 8b 22             	mov    (%rdx),%r12
+  80316b:	eb a0                	jmp    80310d <vprintfmt+0x35e>
+  80316d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803171:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803175:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803179:	eb ed                	jmp    803168 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80317b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80317f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803183:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803187:	e9 65 ff ff ff       	jmp    8030f1 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80318c:	4c 89 ee             	mov    %r13,%rsi
+  80318f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803194:	41 ff d6             	call   *%r14
+                i = -i;
+  803197:	49 f7 dc             	neg    %r12
+  80319a:	e9 73 ff ff ff       	jmp    803112 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80319f:	40 84 f6             	test   %sil,%sil
+  8031a2:	75 32                	jne    8031d6 <vprintfmt+0x427>
+    switch (lflag) {
+  8031a4:	85 d2                	test   %edx,%edx
+  8031a6:	74 5d                	je     803205 <vprintfmt+0x456>
+  8031a8:	83 fa 01             	cmp    $0x1,%edx
+  8031ab:	0f 84 82 00 00 00    	je     803233 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8031b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8031b7:	0f 87 a5 00 00 00    	ja     803262 <vprintfmt+0x4b3>
+  8031bd:	89 c2                	mov    %eax,%edx
+  8031bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031c3:	83 c0 08             	add    $0x8,%eax
+  8031c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031c9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8031cc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8031d1:	e9 99 01 00 00       	jmp    80336f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8031d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8031d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8031dc:	77 19                	ja     8031f7 <vprintfmt+0x448>
+  8031de:	89 c2                	mov    %eax,%edx
+  8031e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8031e4:	83 c0 08             	add    $0x8,%eax
+  8031e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8031ea:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8031ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8031f2:	e9 78 01 00 00       	jmp    80336f <vprintfmt+0x5c0>
+  8031f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8031ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803203:	eb e5                	jmp    8031ea <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803205:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803208:	83 f8 2f             	cmp    $0x2f,%eax
+  80320b:	77 18                	ja     803225 <vprintfmt+0x476>
+  80320d:	89 c2                	mov    %eax,%edx
+  80320f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803213:	83 c0 08             	add    $0x8,%eax
+  803216:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803219:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80321b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803220:	e9 4a 01 00 00       	jmp    80336f <vprintfmt+0x5c0>
+  803225:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803229:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80322d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803231:	eb e6                	jmp    803219 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803233:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803236:	83 f8 2f             	cmp    $0x2f,%eax
+  803239:	77 19                	ja     803254 <vprintfmt+0x4a5>
+  80323b:	89 c2                	mov    %eax,%edx
+  80323d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803241:	83 c0 08             	add    $0x8,%eax
+  803244:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803247:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80324a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80324f:	e9 1b 01 00 00       	jmp    80336f <vprintfmt+0x5c0>
+  803254:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803258:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80325c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803260:	eb e5                	jmp    803247 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803262:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803266:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80326a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80326e:	e9 56 ff ff ff       	jmp    8031c9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803273:	40 84 f6             	test   %sil,%sil
+  803276:	75 2e                	jne    8032a6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803278:	85 d2                	test   %edx,%edx
+  80327a:	74 59                	je     8032d5 <vprintfmt+0x526>
+  80327c:	83 fa 01             	cmp    $0x1,%edx
+  80327f:	74 7f                	je     803300 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803281:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803284:	83 f8 2f             	cmp    $0x2f,%eax
+  803287:	0f 87 9f 00 00 00    	ja     80332c <vprintfmt+0x57d>
+  80328d:	89 c2                	mov    %eax,%edx
+  80328f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803293:	83 c0 08             	add    $0x8,%eax
+  803296:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803299:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80329c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8032a1:	e9 c9 00 00 00       	jmp    80336f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8032a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8032ac:	77 19                	ja     8032c7 <vprintfmt+0x518>
+  8032ae:	89 c2                	mov    %eax,%edx
+  8032b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032b4:	83 c0 08             	add    $0x8,%eax
+  8032b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032ba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8032bd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8032c2:	e9 a8 00 00 00       	jmp    80336f <vprintfmt+0x5c0>
+  8032c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d3:	eb e5                	jmp    8032ba <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8032d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8032db:	77 15                	ja     8032f2 <vprintfmt+0x543>
+  8032dd:	89 c2                	mov    %eax,%edx
+  8032df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8032e3:	83 c0 08             	add    $0x8,%eax
+  8032e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032e9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8032eb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8032f0:	eb 7d                	jmp    80336f <vprintfmt+0x5c0>
+  8032f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8032fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032fe:	eb e9                	jmp    8032e9 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803300:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803303:	83 f8 2f             	cmp    $0x2f,%eax
+  803306:	77 16                	ja     80331e <vprintfmt+0x56f>
+  803308:	89 c2                	mov    %eax,%edx
+  80330a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80330e:	83 c0 08             	add    $0x8,%eax
+  803311:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803314:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803317:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80331c:	eb 51                	jmp    80336f <vprintfmt+0x5c0>
+  80331e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803322:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803326:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80332a:	eb e8                	jmp    803314 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80332c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803330:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803334:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803338:	e9 5c ff ff ff       	jmp    803299 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80333d:	4c 89 ee             	mov    %r13,%rsi
+  803340:	bf 30 00 00 00       	mov    $0x30,%edi
+  803345:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803348:	4c 89 ee             	mov    %r13,%rsi
+  80334b:	bf 78 00 00 00       	mov    $0x78,%edi
+  803350:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803353:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803356:	83 f8 2f             	cmp    $0x2f,%eax
+  803359:	77 47                	ja     8033a2 <vprintfmt+0x5f3>
+  80335b:	89 c2                	mov    %eax,%edx
+  80335d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803361:	83 c0 08             	add    $0x8,%eax
+  803364:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803367:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80336a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80336f:	48 83 ec 08          	sub    $0x8,%rsp
+  803373:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803377:	0f 94 c0             	sete   %al
+  80337a:	0f b6 c0             	movzbl %al,%eax
+  80337d:	50                   	push   %rax
+  80337e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803383:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803387:	4c 89 ee             	mov    %r13,%rsi
+  80338a:	4c 89 f7             	mov    %r14,%rdi
+  80338d:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+            break;
+  803399:	48 83 c4 10          	add    $0x10,%rsp
+  80339d:	e9 3e fa ff ff       	jmp    802de0 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8033a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ae:	eb b7                	jmp    803367 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8033b0:	40 84 f6             	test   %sil,%sil
+  8033b3:	75 2b                	jne    8033e0 <vprintfmt+0x631>
+    switch (lflag) {
+  8033b5:	85 d2                	test   %edx,%edx
+  8033b7:	74 56                	je     80340f <vprintfmt+0x660>
+  8033b9:	83 fa 01             	cmp    $0x1,%edx
+  8033bc:	74 7f                	je     80343d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8033be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033c4:	0f 87 a2 00 00 00    	ja     80346c <vprintfmt+0x6bd>
+  8033ca:	89 c2                	mov    %eax,%edx
+  8033cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033d0:	83 c0 08             	add    $0x8,%eax
+  8033d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033d6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8033d9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8033de:	eb 8f                	jmp    80336f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8033e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e6:	77 19                	ja     803401 <vprintfmt+0x652>
+  8033e8:	89 c2                	mov    %eax,%edx
+  8033ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ee:	83 c0 08             	add    $0x8,%eax
+  8033f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8033f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8033fc:	e9 6e ff ff ff       	jmp    80336f <vprintfmt+0x5c0>
+  803401:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803405:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803409:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80340d:	eb e5                	jmp    8033f4 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80340f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803412:	83 f8 2f             	cmp    $0x2f,%eax
+  803415:	77 18                	ja     80342f <vprintfmt+0x680>
+  803417:	89 c2                	mov    %eax,%edx
+  803419:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80341d:	83 c0 08             	add    $0x8,%eax
+  803420:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803423:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803425:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80342a:	e9 40 ff ff ff       	jmp    80336f <vprintfmt+0x5c0>
+  80342f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803433:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803437:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80343b:	eb e6                	jmp    803423 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80343d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803440:	83 f8 2f             	cmp    $0x2f,%eax
+  803443:	77 19                	ja     80345e <vprintfmt+0x6af>
+  803445:	89 c2                	mov    %eax,%edx
+  803447:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80344b:	83 c0 08             	add    $0x8,%eax
+  80344e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803451:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803454:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803459:	e9 11 ff ff ff       	jmp    80336f <vprintfmt+0x5c0>
+  80345e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803462:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803466:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80346a:	eb e5                	jmp    803451 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80346c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803470:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803474:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803478:	e9 59 ff ff ff       	jmp    8033d6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80347d:	4c 89 ee             	mov    %r13,%rsi
+  803480:	bf 25 00 00 00       	mov    $0x25,%edi
+  803485:	41 ff d6             	call   *%r14
+            break;
+  803488:	e9 53 f9 ff ff       	jmp    802de0 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80348d:	4c 89 ee             	mov    %r13,%rsi
+  803490:	bf 25 00 00 00       	mov    $0x25,%edi
+  803495:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803498:	48 83 eb 01          	sub    $0x1,%rbx
+  80349c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8034a0:	75 f6                	jne    803498 <vprintfmt+0x6e9>
+  8034a2:	e9 39 f9 ff ff       	jmp    802de0 <vprintfmt+0x31>
+}
+  8034a7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8034ab:	5b                   	pop    %rbx
+  8034ac:	41 5c                	pop    %r12
+  8034ae:	41 5d                	pop    %r13
+  8034b0:	41 5e                	pop    %r14
+  8034b2:	41 5f                	pop    %r15
+  8034b4:	5d                   	pop    %rbp
+  8034b5:	c3                   	ret
+
+00000000008034b6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8034b6:	55                   	push   %rbp
+  8034b7:	48 89 e5             	mov    %rsp,%rbp
+  8034ba:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8034be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8034c2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8034c7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8034cb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8034d2:	48 85 ff             	test   %rdi,%rdi
+  8034d5:	74 2b                	je     803502 <vsnprintf+0x4c>
+  8034d7:	48 85 f6             	test   %rsi,%rsi
+  8034da:	74 26                	je     803502 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8034dc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8034e0:	48 bf 5a 2d 80 00 00 	movabs $0x802d5a,%rdi
+  8034e7:	00 00 00 
+  8034ea:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  8034f1:	00 00 00 
+  8034f4:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8034f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034fa:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8034fd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803500:	c9                   	leave
+  803501:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803502:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803507:	eb f7                	jmp    803500 <vsnprintf+0x4a>
+
+0000000000803509 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803509:	55                   	push   %rbp
+  80350a:	48 89 e5             	mov    %rsp,%rbp
+  80350d:	48 83 ec 50          	sub    $0x50,%rsp
+  803511:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803515:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803519:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80351d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803524:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803528:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80352c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803530:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803534:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803538:	48 b8 b6 34 80 00 00 	movabs $0x8034b6,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+0000000000803546 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	41 55                	push   %r13
+  80354c:	41 54                	push   %r12
+  80354e:	53                   	push   %rbx
+  80354f:	48 83 ec 08          	sub    $0x8,%rsp
+  803553:	49 89 fc             	mov    %rdi,%r12
+  803556:	48 89 f7             	mov    %rsi,%rdi
+  803559:	48 89 d3             	mov    %rdx,%rbx
+  80355c:	49 89 cd             	mov    %rcx,%r13
+  80355f:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803562:	48 85 f6             	test   %rsi,%rsi
+  803565:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80356c:	00 00 00 
+  80356f:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803573:	be 00 10 00 00       	mov    $0x1000,%esi
+  803578:	48 85 db             	test   %rbx,%rbx
+  80357b:	74 03                	je     803580 <ipc_recv_timed+0x3a>
+  80357d:	48 8b 33             	mov    (%rbx),%rsi
+  803580:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80358c:	85 c0                	test   %eax,%eax
+  80358e:	78 75                	js     803605 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803590:	4d 85 e4             	test   %r12,%r12
+  803593:	74 14                	je     8035a9 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803595:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80359c:	00 00 00 
+  80359f:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8035a5:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8035a9:	4d 85 ed             	test   %r13,%r13
+  8035ac:	74 14                	je     8035c2 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8035ae:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035b5:	00 00 00 
+  8035b8:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8035be:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8035c2:	48 85 db             	test   %rbx,%rbx
+  8035c5:	74 23                	je     8035ea <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8035c7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035ce:	00 00 00 
+  8035d1:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8035d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035dc:	85 c9                	test   %ecx,%ecx
+  8035de:	74 07                	je     8035e7 <ipc_recv_timed+0xa1>
+  8035e0:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035e7:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8035ea:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035f1:	00 00 00 
+  8035f4:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8035fa:	48 83 c4 08          	add    $0x8,%rsp
+  8035fe:	5b                   	pop    %rbx
+  8035ff:	41 5c                	pop    %r12
+  803601:	41 5d                	pop    %r13
+  803603:	5d                   	pop    %rbp
+  803604:	c3                   	ret
+        if (from_env_store != NULL) {
+  803605:	4d 85 e4             	test   %r12,%r12
+  803608:	74 08                	je     803612 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80360a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803611:	00 
+        if (perm_store != NULL) {
+  803612:	4d 85 ed             	test   %r13,%r13
+  803615:	74 08                	je     80361f <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803617:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80361e:	00 
+        if (size != NULL) {
+  80361f:	48 85 db             	test   %rbx,%rbx
+  803622:	74 d6                	je     8035fa <ipc_recv_timed+0xb4>
+            *size = 0;
+  803624:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80362b:	eb cd                	jmp    8035fa <ipc_recv_timed+0xb4>
+
+000000000080362d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80362d:	55                   	push   %rbp
+  80362e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803637:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  80363e:	00 00 00 
+  803641:	ff d0                	call   *%rax
+}
+  803643:	5d                   	pop    %rbp
+  803644:	c3                   	ret
+
+0000000000803645 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+  803649:	41 57                	push   %r15
+  80364b:	41 56                	push   %r14
+  80364d:	41 55                	push   %r13
+  80364f:	41 54                	push   %r12
+  803651:	53                   	push   %rbx
+  803652:	48 83 ec 18          	sub    $0x18,%rsp
+  803656:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803659:	48 89 d3             	mov    %rdx,%rbx
+  80365c:	49 89 cc             	mov    %rcx,%r12
+  80365f:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803662:	48 85 d2             	test   %rdx,%rdx
+  803665:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80366c:	00 00 00 
+  80366f:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803673:	89 f0                	mov    %esi,%eax
+  803675:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803679:	48 89 da             	mov    %rbx,%rdx
+  80367c:	48 89 c6             	mov    %rax,%rsi
+  80367f:	48 b8 1c 0b 80 00 00 	movabs $0x800b1c,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+    while (res < 0) {
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	79 65                	jns    8036f4 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80368f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803692:	75 33                	jne    8036c7 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803694:	49 bf 1f 08 80 00 00 	movabs $0x80081f,%r15
+  80369b:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80369e:	49 be 1c 0b 80 00 00 	movabs $0x800b1c,%r14
+  8036a5:	00 00 00 
+        sys_yield();
+  8036a8:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036ab:	45 89 e8             	mov    %r13d,%r8d
+  8036ae:	4c 89 e1             	mov    %r12,%rcx
+  8036b1:	48 89 da             	mov    %rbx,%rdx
+  8036b4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036b8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8036bb:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8036be:	85 c0                	test   %eax,%eax
+  8036c0:	79 32                	jns    8036f4 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036c2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036c5:	74 e1                	je     8036a8 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8036c7:	89 c1                	mov    %eax,%ecx
+  8036c9:	48 ba 07 3e 80 00 00 	movabs $0x803e07,%rdx
+  8036d0:	00 00 00 
+  8036d3:	be 52 00 00 00       	mov    $0x52,%esi
+  8036d8:	48 bf 1b 3e 80 00 00 	movabs $0x803e1b,%rdi
+  8036df:	00 00 00 
+  8036e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e7:	49 b8 0f 2b 80 00 00 	movabs $0x802b0f,%r8
+  8036ee:	00 00 00 
+  8036f1:	41 ff d0             	call   *%r8
+    }
+}
+  8036f4:	48 83 c4 18          	add    $0x18,%rsp
+  8036f8:	5b                   	pop    %rbx
+  8036f9:	41 5c                	pop    %r12
+  8036fb:	41 5d                	pop    %r13
+  8036fd:	41 5e                	pop    %r14
+  8036ff:	41 5f                	pop    %r15
+  803701:	5d                   	pop    %rbp
+  803702:	c3                   	ret
+
+0000000000803703 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803703:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803708:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80370f:	00 00 00 
+  803712:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803716:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80371a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80371e:	48 01 ca             	add    %rcx,%rdx
+  803721:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803727:	39 fa                	cmp    %edi,%edx
+  803729:	74 12                	je     80373d <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80372b:	48 83 c0 01          	add    $0x1,%rax
+  80372f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803735:	75 db                	jne    803712 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803737:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373c:	c3                   	ret
+            return envs[i].env_id;
+  80373d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803741:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803745:	48 c1 e2 04          	shl    $0x4,%rdx
+  803749:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803750:	00 00 00 
+  803753:	48 01 d0             	add    %rdx,%rax
+  803756:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80375c:	c3                   	ret
+  80375d:	0f 1f 00             	nopl   (%rax)
+
+0000000000803760 <__rodata_start>:
+  803760:	2d 6e 00 20 00       	sub    $0x20006e,%eax
+  803765:	3c 75                	cmp    $0x75,%al
+  803767:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803768:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80376c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80376d:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  803774:	61                   	(bad)
+  803775:	6c                   	insb   (%dx),%es:(%rdi)
+  803776:	6c                   	insb   (%dx),%es:(%rdi)
+  803777:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09bf7 <__bss_end+0x72201bf7>
+  80377d:	65 74 75             	gs je  8037f5 <__rodata_start+0x95>
+  803780:	72 6e                	jb     8037f0 <__rodata_start+0x90>
+  803782:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09c04 <__bss_end+0x28201c04>
+  803789:	28 
+  80378a:	3e 20 30             	ds and %dh,(%rax)
+  80378d:	29 00                	sub    %eax,(%rax)
+  80378f:	6c                   	insb   (%dx),%es:(%rdi)
+  803790:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  803797:	61                   	(bad)
+  803798:	6c                   	insb   (%dx),%es:(%rdi)
+  803799:	6c                   	insb   (%dx),%es:(%rdi)
+  80379a:	2e 63 00             	cs movsxd (%rax),%eax
+  80379d:	0f 1f 00             	nopl   (%rax)
+  8037a0:	5b                   	pop    %rbx
+  8037a1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8037a6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8037a9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8037ad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ae:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8037b2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8037b9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804224 <__ctors_end+0x2c>
+  8037c0:	5b                   	pop    %rbx
+  8037c1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8037c6:	20 72 65             	and    %dh,0x65(%rdx)
+  8037c9:	61                   	(bad)
+  8037ca:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8037cc:	61                   	(bad)
+  8037cd:	70 20                	jo     8037ef <__rodata_start+0x8f>
+  8037cf:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8037d4:	20 62 61             	and    %ah,0x61(%rdx)
+  8037d7:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8037db:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8037df:	00 5b 25             	add    %bl,0x25(%rbx)
+  8037e2:	30 38                	xor    %bh,(%rax)
+  8037e4:	78 5d                	js     803843 <devtab+0x3>
+  8037e6:	20 66 74             	and    %ah,0x74(%rsi)
+  8037e9:	72 75                	jb     803860 <devtab+0x20>
+  8037eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ec:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8037ef:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad585a <__bss_end+0x2d2cd85a>
+  8037f6:	20 62 61             	and    %ah,0x61(%rdx)
+  8037f9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8037fd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803801:	5b                   	pop    %rbx
+  803802:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803807:	20 72 65             	and    %dh,0x65(%rdx)
+  80380a:	61                   	(bad)
+  80380b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad5876 <__bss_end+0x2d2cd876>
+  803812:	20 62 61             	and    %ah,0x61(%rdx)
+  803815:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803819:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80381d:	5b                   	pop    %rbx
+  80381e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803823:	20 77 72             	and    %dh,0x72(%rdi)
+  803826:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80382d:	2d 
+  80382e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803833:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803836:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80383a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803840 <devtab>:
+  803840:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803850:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803860:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803870:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803880:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803890:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8038a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8038b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8038c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8038d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8038e0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8038f0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803900:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803910:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803920:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803930:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803940:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803950:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803960:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803970:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803980:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  803990:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8039a0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8039b0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8039c0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8039d0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8039e0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8039f0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803a00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803a10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803a20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803a30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803a40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803a50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803a60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803a70:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  803a80:	4c 2e 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     L........4......
+  803a90:	7d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     }4.......4......
+  803aa0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803ab0:	8d 34 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     .4......k.......
+  803ac0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803ad0:	5f 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     _...............
+  803ae0:	8d 34 80 00 00 00 00 00 5f 2e 80 00 00 00 00 00     .4......_.......
+  803af0:	a5 2e 80 00 00 00 00 00 a5 2e 80 00 00 00 00 00     ................
+  803b00:	a5 2e 80 00 00 00 00 00 a5 2e 80 00 00 00 00 00     ................
+  803b10:	a5 2e 80 00 00 00 00 00 a5 2e 80 00 00 00 00 00     ................
+  803b20:	a5 2e 80 00 00 00 00 00 a5 2e 80 00 00 00 00 00     ................
+  803b30:	a5 2e 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .........4......
+  803b40:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803b50:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803b60:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803b70:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803b80:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803b90:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803ba0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803bb0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803bc0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803bd0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803be0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803bf0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c00:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c10:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c20:	8d 34 80 00 00 00 00 00 b0 33 80 00 00 00 00 00     .4.......3......
+  803c30:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c40:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c50:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c60:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c70:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803c80:	fc 2e 80 00 00 00 00 00 cb 30 80 00 00 00 00 00     .........0......
+  803c90:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803ca0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803cb0:	2b 2f 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     +/.......4......
+  803cc0:	8d 34 80 00 00 00 00 00 f1 2e 80 00 00 00 00 00     .4..............
+  803cd0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803ce0:	73 32 80 00 00 00 00 00 3d 33 80 00 00 00 00 00     s2......=3......
+  803cf0:	8d 34 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .4.......4......
+  803d00:	c2 2f 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     ./.......4......
+  803d10:	9f 31 80 00 00 00 00 00 8d 34 80 00 00 00 00 00     .1.......4......
+  803d20:	8d 34 80 00 00 00 00 00 b0 33 80 00 00 00 00 00     .4.......3......
+  803d30:	8d 34 80 00 00 00 00 00 55 2e 80 00 00 00 00 00     .4......U.......
+
+0000000000803d40 <error_string>:
+	...
+  803d48:	15 39 80 00 00 00 00 00 27 39 80 00 00 00 00 00     .9......'9......
+  803d58:	37 39 80 00 00 00 00 00 49 39 80 00 00 00 00 00     79......I9......
+  803d68:	57 39 80 00 00 00 00 00 6b 39 80 00 00 00 00 00     W9......k9......
+  803d78:	80 39 80 00 00 00 00 00 93 39 80 00 00 00 00 00     .9.......9......
+  803d88:	a5 39 80 00 00 00 00 00 b9 39 80 00 00 00 00 00     .9.......9......
+  803d98:	c9 39 80 00 00 00 00 00 dc 39 80 00 00 00 00 00     .9.......9......
+  803da8:	f3 39 80 00 00 00 00 00 09 3a 80 00 00 00 00 00     .9.......:......
+  803db8:	21 3a 80 00 00 00 00 00 39 3a 80 00 00 00 00 00     !:......9:......
+  803dc8:	46 3a 80 00 00 00 00 00 e8 3d 80 00 00 00 00 00     F:.......=......
+  803dd8:	5a 3a 80 00 00 00 00 00 72 3a 80 00 00 00 00 00     Z:......r:......
+  803de8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803df8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803e08:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803e18:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803e28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff8:	00 00 00 0f 1f 44 00 00                             .....D..
@@ -0,0 +1,6625 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	41 89 fd             	mov    %edi,%r13d
+  800054:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800057:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80005e:	00 00 00 
+  800061:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800068:	00 00 00 
+  80006b:	48 39 c2             	cmp    %rax,%rdx
+  80006e:	73 17                	jae    800087 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800070:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800073:	49 89 c4             	mov    %rax,%r12
+  800076:	48 83 c3 08          	add    $0x8,%rbx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff 53 f8             	call   *-0x8(%rbx)
+  800082:	4c 39 e3             	cmp    %r12,%rbx
+  800085:	72 ef                	jb     800076 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800087:	48 b8 e0 01 80 00 00 	movabs $0x8001e0,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+  800093:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800098:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80009c:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000a0:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ab:	00 00 00 
+  8000ae:	48 01 d0             	add    %rdx,%rax
+  8000b1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bb:	45 85 ed             	test   %r13d,%r13d
+  8000be:	7e 0d                	jle    8000cd <libmain+0x87>
+  8000c0:	49 8b 06             	mov    (%r14),%rax
+  8000c3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ca:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cd:	4c 89 f6             	mov    %r14,%rsi
+  8000d0:	44 89 ef             	mov    %r13d,%edi
+  8000d3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000df:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	5b                   	pop    %rbx
+  8000ec:	41 5c                	pop    %r12
+  8000ee:	41 5d                	pop    %r13
+  8000f0:	41 5e                	pop    %r14
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f8:	48 b8 96 08 80 00 00 	movabs $0x800896,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 75 01 80 00 00 	movabs $0x800175,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	53                   	push   %rbx
+  80011c:	48 89 fa             	mov    %rdi,%rdx
+  80011f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800122:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800127:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80012c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800131:	be 00 00 00 00       	mov    $0x0,%esi
+  800136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80013c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800142:	c9                   	leave
+  800143:	c3                   	ret
+
+0000000000800144 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800144:	55                   	push   %rbp
+  800145:	48 89 e5             	mov    %rsp,%rbp
+  800148:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800149:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80014e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800153:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80015d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800162:	be 00 00 00 00       	mov    $0x0,%esi
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80016d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800173:	c9                   	leave
+  800174:	c3                   	ret
+
+0000000000800175 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	53                   	push   %rbx
+  80017a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80017e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800181:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800186:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80018b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800190:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800195:	be 00 00 00 00       	mov    $0x0,%esi
+  80019a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a2:	48 85 c0             	test   %rax,%rax
+  8001a5:	7f 06                	jg     8001ad <sys_env_destroy+0x38>
+}
+  8001a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ad:	49 89 c0             	mov    %rax,%r8
+  8001b0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b5:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8001bc:	00 00 00 
+  8001bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c4:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8001cb:	00 00 00 
+  8001ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d3:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  8001da:	00 00 00 
+  8001dd:	41 ff d1             	call   *%r9
+
+00000000008001e0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e0:	55                   	push   %rbp
+  8001e1:	48 89 e5             	mov    %rsp,%rbp
+  8001e4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001fe:	be 00 00 00 00       	mov    $0x0,%esi
+  800203:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800209:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80020b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020f:	c9                   	leave
+  800210:	c3                   	ret
+
+0000000000800211 <sys_yield>:
+
+void
+sys_yield(void) {
+  800211:	55                   	push   %rbp
+  800212:	48 89 e5             	mov    %rsp,%rbp
+  800215:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800216:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80021b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800220:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022f:	be 00 00 00 00       	mov    $0x0,%esi
+  800234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800240:	c9                   	leave
+  800241:	c3                   	ret
+
+0000000000800242 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	53                   	push   %rbx
+  800247:	48 89 fa             	mov    %rdi,%rdx
+  80024a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80024d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800252:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800259:	00 00 00 
+  80025c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800261:	be 00 00 00 00       	mov    $0x0,%esi
+  800266:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80026e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800272:	c9                   	leave
+  800273:	c3                   	ret
+
+0000000000800274 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800274:	55                   	push   %rbp
+  800275:	48 89 e5             	mov    %rsp,%rbp
+  800278:	53                   	push   %rbx
+  800279:	49 89 f8             	mov    %rdi,%r8
+  80027c:	48 89 d3             	mov    %rdx,%rbx
+  80027f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800282:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800287:	4c 89 c2             	mov    %r8,%rdx
+  80028a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80028d:	be 00 00 00 00       	mov    $0x0,%esi
+  800292:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800298:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029e:	c9                   	leave
+  80029f:	c3                   	ret
+
+00000000008002a0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a0:	55                   	push   %rbp
+  8002a1:	48 89 e5             	mov    %rsp,%rbp
+  8002a4:	53                   	push   %rbx
+  8002a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a9:	89 f8                	mov    %edi,%eax
+  8002ab:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002ae:	48 63 f9             	movslq %ecx,%rdi
+  8002b1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c9:	48 85 c0             	test   %rax,%rax
+  8002cc:	7f 06                	jg     8002d4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d2:	c9                   	leave
+  8002d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d4:	49 89 c0             	mov    %rax,%r8
+  8002d7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002dc:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8002e3:	00 00 00 
+  8002e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8002eb:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8002f2:	00 00 00 
+  8002f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fa:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  800301:	00 00 00 
+  800304:	41 ff d1             	call   *%r9
+
+0000000000800307 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800307:	55                   	push   %rbp
+  800308:	48 89 e5             	mov    %rsp,%rbp
+  80030b:	53                   	push   %rbx
+  80030c:	48 83 ec 08          	sub    $0x8,%rsp
+  800310:	89 f8                	mov    %edi,%eax
+  800312:	49 89 f2             	mov    %rsi,%r10
+  800315:	48 89 cf             	mov    %rcx,%rdi
+  800318:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80031b:	48 63 da             	movslq %edx,%rbx
+  80031e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800321:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800326:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800329:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80032c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80032e:	48 85 c0             	test   %rax,%rax
+  800331:	7f 06                	jg     800339 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800339:	49 89 c0             	mov    %rax,%r8
+  80033c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800341:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800348:	00 00 00 
+  80034b:	be 26 00 00 00       	mov    $0x26,%esi
+  800350:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800357:	00 00 00 
+  80035a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035f:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  800366:	00 00 00 
+  800369:	41 ff d1             	call   *%r9
+
+000000000080036c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80036c:	55                   	push   %rbp
+  80036d:	48 89 e5             	mov    %rsp,%rbp
+  800370:	53                   	push   %rbx
+  800371:	48 83 ec 08          	sub    $0x8,%rsp
+  800375:	48 89 f1             	mov    %rsi,%rcx
+  800378:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80037b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80037e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800383:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800388:	be 00 00 00 00       	mov    $0x0,%esi
+  80038d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800393:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800395:	48 85 c0             	test   %rax,%rax
+  800398:	7f 06                	jg     8003a0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80039a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039e:	c9                   	leave
+  80039f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a0:	49 89 c0             	mov    %rax,%r8
+  8003a3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a8:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8003af:	00 00 00 
+  8003b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b7:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8003be:	00 00 00 
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  8003cd:	00 00 00 
+  8003d0:	41 ff d1             	call   *%r9
+
+00000000008003d3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003d3:	55                   	push   %rbp
+  8003d4:	48 89 e5             	mov    %rsp,%rbp
+  8003d7:	53                   	push   %rbx
+  8003d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003dc:	48 63 ce             	movslq %esi,%rcx
+  8003df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003fe:	48 85 c0             	test   %rax,%rax
+  800401:	7f 06                	jg     800409 <sys_env_set_status+0x36>
+}
+  800403:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800409:	49 89 c0             	mov    %rax,%r8
+  80040c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800411:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800418:	00 00 00 
+  80041b:	be 26 00 00 00       	mov    $0x26,%esi
+  800420:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800427:	00 00 00 
+  80042a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042f:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  800436:	00 00 00 
+  800439:	41 ff d1             	call   *%r9
+
+000000000080043c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+  800440:	53                   	push   %rbx
+  800441:	48 83 ec 08          	sub    $0x8,%rsp
+  800445:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800448:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80044b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800450:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800455:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045a:	be 00 00 00 00       	mov    $0x0,%esi
+  80045f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800465:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800467:	48 85 c0             	test   %rax,%rax
+  80046a:	7f 06                	jg     800472 <sys_env_set_trapframe+0x36>
+}
+  80046c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800472:	49 89 c0             	mov    %rax,%r8
+  800475:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80047a:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800481:	00 00 00 
+  800484:	be 26 00 00 00       	mov    $0x26,%esi
+  800489:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  800490:	00 00 00 
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  80049f:	00 00 00 
+  8004a2:	41 ff d1             	call   *%r9
+
+00000000008004a5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	53                   	push   %rbx
+  8004aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ae:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d0:	48 85 c0             	test   %rax,%rax
+  8004d3:	7f 06                	jg     8004db <sys_env_set_pgfault_upcall+0x36>
+}
+  8004d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d9:	c9                   	leave
+  8004da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004db:	49 89 c0             	mov    %rax,%r8
+  8004de:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004e3:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  8004ea:	00 00 00 
+  8004ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f2:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  8004f9:	00 00 00 
+  8004fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800501:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  800508:	00 00 00 
+  80050b:	41 ff d1             	call   *%r9
+
+000000000080050e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80050e:	55                   	push   %rbp
+  80050f:	48 89 e5             	mov    %rsp,%rbp
+  800512:	53                   	push   %rbx
+  800513:	89 f8                	mov    %edi,%eax
+  800515:	49 89 f1             	mov    %rsi,%r9
+  800518:	48 89 d3             	mov    %rdx,%rbx
+  80051b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80051e:	49 63 f0             	movslq %r8d,%rsi
+  800521:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800524:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800529:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800532:	cd 30                	int    $0x30
+}
+  800534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800538:	c9                   	leave
+  800539:	c3                   	ret
+
+000000000080053a <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80053a:	55                   	push   %rbp
+  80053b:	48 89 e5             	mov    %rsp,%rbp
+  80053e:	53                   	push   %rbx
+  80053f:	48 83 ec 08          	sub    $0x8,%rsp
+  800543:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800546:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800549:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80054e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800551:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800556:	be 00 00 00 00       	mov    $0x0,%esi
+  80055b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800561:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800563:	48 85 c0             	test   %rax,%rax
+  800566:	7f 06                	jg     80056e <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800568:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80056c:	c9                   	leave
+  80056d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80056e:	49 89 c0             	mov    %rax,%r8
+  800571:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800576:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  80057d:	00 00 00 
+  800580:	be 26 00 00 00       	mov    $0x26,%esi
+  800585:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  80058c:	00 00 00 
+  80058f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800594:	49 b9 01 25 80 00 00 	movabs $0x802501,%r9
+  80059b:	00 00 00 
+  80059e:	41 ff d1             	call   *%r9
+
+00000000008005a1 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8005a1:	55                   	push   %rbp
+  8005a2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005aa:	48 b8 3a 05 80 00 00 	movabs $0x80053a,%rax
+  8005b1:	00 00 00 
+  8005b4:	ff d0                	call   *%rax
+}
+  8005b6:	5d                   	pop    %rbp
+  8005b7:	c3                   	ret
+
+00000000008005b8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005b8:	55                   	push   %rbp
+  8005b9:	48 89 e5             	mov    %rsp,%rbp
+  8005bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e1:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e7:	c9                   	leave
+  8005e8:	c3                   	ret
+
+00000000008005e9 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005e9:	55                   	push   %rbp
+  8005ea:	48 89 e5             	mov    %rsp,%rbp
+  8005ed:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005ee:	48 63 ce             	movslq %esi,%rcx
+  8005f1:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800604:	be 00 00 00 00       	mov    $0x0,%esi
+  800609:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060f:	cd 30                	int    $0x30
+}
+  800611:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800615:	c9                   	leave
+  800616:	c3                   	ret
+
+0000000000800617 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800617:	55                   	push   %rbp
+  800618:	48 89 e5             	mov    %rsp,%rbp
+  80061b:	53                   	push   %rbx
+  80061c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80061f:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800623:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800628:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80062d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800632:	be 00 00 00 00       	mov    $0x0,%esi
+  800637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80063d:	cd 30                	int    $0x30
+}
+  80063f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800643:	c9                   	leave
+  800644:	c3                   	ret
+
+0000000000800645 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800645:	55                   	push   %rbp
+  800646:	48 89 e5             	mov    %rsp,%rbp
+  800649:	53                   	push   %rbx
+  80064a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80064d:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800650:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800655:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800658:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065d:	be 00 00 00 00       	mov    $0x0,%esi
+  800662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800668:	cd 30                	int    $0x30
+}
+  80066a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066e:	c9                   	leave
+  80066f:	c3                   	ret
+
+0000000000800670 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800670:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800677:	ff ff ff 
+  80067a:	48 01 f8             	add    %rdi,%rax
+  80067d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800681:	c3                   	ret
+
+0000000000800682 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800682:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800689:	ff ff ff 
+  80068c:	48 01 f8             	add    %rdi,%rax
+  80068f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800693:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800699:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80069d:	c3                   	ret
+
+000000000080069e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80069e:	55                   	push   %rbp
+  80069f:	48 89 e5             	mov    %rsp,%rbp
+  8006a2:	41 57                	push   %r15
+  8006a4:	41 56                	push   %r14
+  8006a6:	41 55                	push   %r13
+  8006a8:	41 54                	push   %r12
+  8006aa:	53                   	push   %rbx
+  8006ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8006af:	49 89 ff             	mov    %rdi,%r15
+  8006b2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b7:	49 bd bd 21 80 00 00 	movabs $0x8021bd,%r13
+  8006be:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006c1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006c7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ca:	48 89 df             	mov    %rbx,%rdi
+  8006cd:	41 ff d5             	call   *%r13
+  8006d0:	83 e0 04             	and    $0x4,%eax
+  8006d3:	74 17                	je     8006ec <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006d5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006dc:	4c 39 f3             	cmp    %r14,%rbx
+  8006df:	75 e6                	jne    8006c7 <fd_alloc+0x29>
+  8006e1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006e7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006ec:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006ef:	48 83 c4 08          	add    $0x8,%rsp
+  8006f3:	5b                   	pop    %rbx
+  8006f4:	41 5c                	pop    %r12
+  8006f6:	41 5d                	pop    %r13
+  8006f8:	41 5e                	pop    %r14
+  8006fa:	41 5f                	pop    %r15
+  8006fc:	5d                   	pop    %rbp
+  8006fd:	c3                   	ret
+
+00000000008006fe <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006fe:	83 ff 1f             	cmp    $0x1f,%edi
+  800701:	77 39                	ja     80073c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800703:	55                   	push   %rbp
+  800704:	48 89 e5             	mov    %rsp,%rbp
+  800707:	41 54                	push   %r12
+  800709:	53                   	push   %rbx
+  80070a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80070d:	48 63 df             	movslq %edi,%rbx
+  800710:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800717:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80071b:	48 89 df             	mov    %rbx,%rdi
+  80071e:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  800725:	00 00 00 
+  800728:	ff d0                	call   *%rax
+  80072a:	a8 04                	test   $0x4,%al
+  80072c:	74 14                	je     800742 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80072e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800737:	5b                   	pop    %rbx
+  800738:	41 5c                	pop    %r12
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+        return -E_INVAL;
+  80073c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800741:	c3                   	ret
+        return -E_INVAL;
+  800742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800747:	eb ee                	jmp    800737 <fd_lookup+0x39>
+
+0000000000800749 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800749:	55                   	push   %rbp
+  80074a:	48 89 e5             	mov    %rsp,%rbp
+  80074d:	41 54                	push   %r12
+  80074f:	53                   	push   %rbx
+  800750:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800753:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  80075a:	00 00 00 
+  80075d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800764:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800767:	39 3b                	cmp    %edi,(%rbx)
+  800769:	74 47                	je     8007b2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80076b:	48 83 c0 08          	add    $0x8,%rax
+  80076f:	48 8b 18             	mov    (%rax),%rbx
+  800772:	48 85 db             	test   %rbx,%rbx
+  800775:	75 f0                	jne    800767 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800777:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80077e:	00 00 00 
+  800781:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800787:	89 fa                	mov    %edi,%edx
+  800789:	48 bf d0 36 80 00 00 	movabs $0x8036d0,%rdi
+  800790:	00 00 00 
+  800793:	b8 00 00 00 00       	mov    $0x0,%eax
+  800798:	48 b9 51 26 80 00 00 	movabs $0x802651,%rcx
+  80079f:	00 00 00 
+  8007a2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007a9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007ad:	5b                   	pop    %rbx
+  8007ae:	41 5c                	pop    %r12
+  8007b0:	5d                   	pop    %rbp
+  8007b1:	c3                   	ret
+            return 0;
+  8007b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b7:	eb f0                	jmp    8007a9 <dev_lookup+0x60>
+
+00000000008007b9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007b9:	55                   	push   %rbp
+  8007ba:	48 89 e5             	mov    %rsp,%rbp
+  8007bd:	41 55                	push   %r13
+  8007bf:	41 54                	push   %r12
+  8007c1:	53                   	push   %rbx
+  8007c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8007c6:	48 89 fb             	mov    %rdi,%rbx
+  8007c9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007cc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007d3:	ff ff ff 
+  8007d6:	48 01 df             	add    %rbx,%rdi
+  8007d9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007dd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007e1:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  8007e8:	00 00 00 
+  8007eb:	ff d0                	call   *%rax
+  8007ed:	41 89 c5             	mov    %eax,%r13d
+  8007f0:	85 c0                	test   %eax,%eax
+  8007f2:	78 06                	js     8007fa <fd_close+0x41>
+  8007f4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007f8:	74 1a                	je     800814 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007fa:	45 84 e4             	test   %r12b,%r12b
+  8007fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800802:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800806:	44 89 e8             	mov    %r13d,%eax
+  800809:	48 83 c4 18          	add    $0x18,%rsp
+  80080d:	5b                   	pop    %rbx
+  80080e:	41 5c                	pop    %r12
+  800810:	41 5d                	pop    %r13
+  800812:	5d                   	pop    %rbp
+  800813:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800814:	8b 3b                	mov    (%rbx),%edi
+  800816:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80081a:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800821:	00 00 00 
+  800824:	ff d0                	call   *%rax
+  800826:	41 89 c5             	mov    %eax,%r13d
+  800829:	85 c0                	test   %eax,%eax
+  80082b:	78 1b                	js     800848 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80082d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800831:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800835:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80083b:	48 85 c0             	test   %rax,%rax
+  80083e:	74 08                	je     800848 <fd_close+0x8f>
+  800840:	48 89 df             	mov    %rbx,%rdi
+  800843:	ff d0                	call   *%rax
+  800845:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800848:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80084d:	48 89 de             	mov    %rbx,%rsi
+  800850:	bf 00 00 00 00       	mov    $0x0,%edi
+  800855:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  80085c:	00 00 00 
+  80085f:	ff d0                	call   *%rax
+    return res;
+  800861:	eb a3                	jmp    800806 <fd_close+0x4d>
+
+0000000000800863 <close>:
+
+int
+close(int fdnum) {
+  800863:	55                   	push   %rbp
+  800864:	48 89 e5             	mov    %rsp,%rbp
+  800867:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80086b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80086f:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800876:	00 00 00 
+  800879:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80087b:	85 c0                	test   %eax,%eax
+  80087d:	78 15                	js     800894 <close+0x31>
+
+    return fd_close(fd, 1);
+  80087f:	be 01 00 00 00       	mov    $0x1,%esi
+  800884:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800888:	48 b8 b9 07 80 00 00 	movabs $0x8007b9,%rax
+  80088f:	00 00 00 
+  800892:	ff d0                	call   *%rax
+}
+  800894:	c9                   	leave
+  800895:	c3                   	ret
+
+0000000000800896 <close_all>:
+
+void
+close_all(void) {
+  800896:	55                   	push   %rbp
+  800897:	48 89 e5             	mov    %rsp,%rbp
+  80089a:	41 54                	push   %r12
+  80089c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80089d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a2:	49 bc 63 08 80 00 00 	movabs $0x800863,%r12
+  8008a9:	00 00 00 
+  8008ac:	89 df                	mov    %ebx,%edi
+  8008ae:	41 ff d4             	call   *%r12
+  8008b1:	83 c3 01             	add    $0x1,%ebx
+  8008b4:	83 fb 20             	cmp    $0x20,%ebx
+  8008b7:	75 f3                	jne    8008ac <close_all+0x16>
+}
+  8008b9:	5b                   	pop    %rbx
+  8008ba:	41 5c                	pop    %r12
+  8008bc:	5d                   	pop    %rbp
+  8008bd:	c3                   	ret
+
+00000000008008be <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008be:	55                   	push   %rbp
+  8008bf:	48 89 e5             	mov    %rsp,%rbp
+  8008c2:	41 57                	push   %r15
+  8008c4:	41 56                	push   %r14
+  8008c6:	41 55                	push   %r13
+  8008c8:	41 54                	push   %r12
+  8008ca:	53                   	push   %rbx
+  8008cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8008cf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008d2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008d6:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  8008dd:	00 00 00 
+  8008e0:	ff d0                	call   *%rax
+  8008e2:	89 c3                	mov    %eax,%ebx
+  8008e4:	85 c0                	test   %eax,%eax
+  8008e6:	0f 88 b8 00 00 00    	js     8009a4 <dup+0xe6>
+    close(newfdnum);
+  8008ec:	44 89 e7             	mov    %r12d,%edi
+  8008ef:	48 b8 63 08 80 00 00 	movabs $0x800863,%rax
+  8008f6:	00 00 00 
+  8008f9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008fb:	4d 63 ec             	movslq %r12d,%r13
+  8008fe:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800905:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800909:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80090d:	4c 89 ff             	mov    %r15,%rdi
+  800910:	49 be 82 06 80 00 00 	movabs $0x800682,%r14
+  800917:	00 00 00 
+  80091a:	41 ff d6             	call   *%r14
+  80091d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800920:	4c 89 ef             	mov    %r13,%rdi
+  800923:	41 ff d6             	call   *%r14
+  800926:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800929:	48 89 df             	mov    %rbx,%rdi
+  80092c:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  800933:	00 00 00 
+  800936:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800938:	a8 04                	test   $0x4,%al
+  80093a:	74 2b                	je     800967 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80093c:	41 89 c1             	mov    %eax,%r9d
+  80093f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800945:	4c 89 f1             	mov    %r14,%rcx
+  800948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80094d:	48 89 de             	mov    %rbx,%rsi
+  800950:	bf 00 00 00 00       	mov    $0x0,%edi
+  800955:	48 b8 07 03 80 00 00 	movabs $0x800307,%rax
+  80095c:	00 00 00 
+  80095f:	ff d0                	call   *%rax
+  800961:	89 c3                	mov    %eax,%ebx
+  800963:	85 c0                	test   %eax,%eax
+  800965:	78 4e                	js     8009b5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800967:	4c 89 ff             	mov    %r15,%rdi
+  80096a:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  800971:	00 00 00 
+  800974:	ff d0                	call   *%rax
+  800976:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800979:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80097f:	4c 89 e9             	mov    %r13,%rcx
+  800982:	ba 00 00 00 00       	mov    $0x0,%edx
+  800987:	4c 89 fe             	mov    %r15,%rsi
+  80098a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80098f:	48 b8 07 03 80 00 00 	movabs $0x800307,%rax
+  800996:	00 00 00 
+  800999:	ff d0                	call   *%rax
+  80099b:	89 c3                	mov    %eax,%ebx
+  80099d:	85 c0                	test   %eax,%eax
+  80099f:	78 14                	js     8009b5 <dup+0xf7>
+
+    return newfdnum;
+  8009a1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009a4:	89 d8                	mov    %ebx,%eax
+  8009a6:	48 83 c4 18          	add    $0x18,%rsp
+  8009aa:	5b                   	pop    %rbx
+  8009ab:	41 5c                	pop    %r12
+  8009ad:	41 5d                	pop    %r13
+  8009af:	41 5e                	pop    %r14
+  8009b1:	41 5f                	pop    %r15
+  8009b3:	5d                   	pop    %rbp
+  8009b4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009ba:	4c 89 ee             	mov    %r13,%rsi
+  8009bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c2:	49 bc 6c 03 80 00 00 	movabs $0x80036c,%r12
+  8009c9:	00 00 00 
+  8009cc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d4:	4c 89 f6             	mov    %r14,%rsi
+  8009d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009dc:	41 ff d4             	call   *%r12
+    return res;
+  8009df:	eb c3                	jmp    8009a4 <dup+0xe6>
+
+00000000008009e1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009e1:	55                   	push   %rbp
+  8009e2:	48 89 e5             	mov    %rsp,%rbp
+  8009e5:	41 56                	push   %r14
+  8009e7:	41 55                	push   %r13
+  8009e9:	41 54                	push   %r12
+  8009eb:	53                   	push   %rbx
+  8009ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8009f0:	89 fb                	mov    %edi,%ebx
+  8009f2:	49 89 f4             	mov    %rsi,%r12
+  8009f5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009f8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009fc:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800a03:	00 00 00 
+  800a06:	ff d0                	call   *%rax
+  800a08:	85 c0                	test   %eax,%eax
+  800a0a:	78 4c                	js     800a58 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a0c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a10:	41 8b 3e             	mov    (%r14),%edi
+  800a13:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a17:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800a1e:	00 00 00 
+  800a21:	ff d0                	call   *%rax
+  800a23:	85 c0                	test   %eax,%eax
+  800a25:	78 35                	js     800a5c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a27:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a2b:	83 e0 03             	and    $0x3,%eax
+  800a2e:	83 f8 01             	cmp    $0x1,%eax
+  800a31:	74 2d                	je     800a60 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a37:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a3b:	48 85 c0             	test   %rax,%rax
+  800a3e:	74 56                	je     800a96 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a40:	4c 89 ea             	mov    %r13,%rdx
+  800a43:	4c 89 e6             	mov    %r12,%rsi
+  800a46:	4c 89 f7             	mov    %r14,%rdi
+  800a49:	ff d0                	call   *%rax
+}
+  800a4b:	48 83 c4 10          	add    $0x10,%rsp
+  800a4f:	5b                   	pop    %rbx
+  800a50:	41 5c                	pop    %r12
+  800a52:	41 5d                	pop    %r13
+  800a54:	41 5e                	pop    %r14
+  800a56:	5d                   	pop    %rbp
+  800a57:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a58:	48 98                	cltq
+  800a5a:	eb ef                	jmp    800a4b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a5c:	48 98                	cltq
+  800a5e:	eb eb                	jmp    800a4b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a60:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a67:	00 00 00 
+  800a6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a70:	89 da                	mov    %ebx,%edx
+  800a72:	48 bf 31 37 80 00 00 	movabs $0x803731,%rdi
+  800a79:	00 00 00 
+  800a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a81:	48 b9 51 26 80 00 00 	movabs $0x802651,%rcx
+  800a88:	00 00 00 
+  800a8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a94:	eb b5                	jmp    800a4b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a96:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a9d:	eb ac                	jmp    800a4b <read+0x6a>
+
+0000000000800a9f <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a9f:	55                   	push   %rbp
+  800aa0:	48 89 e5             	mov    %rsp,%rbp
+  800aa3:	41 56                	push   %r14
+  800aa5:	41 55                	push   %r13
+  800aa7:	41 54                	push   %r12
+  800aa9:	53                   	push   %rbx
+  800aaa:	48 83 ec 10          	sub    $0x10,%rsp
+  800aae:	89 fb                	mov    %edi,%ebx
+  800ab0:	49 89 f4             	mov    %rsi,%r12
+  800ab3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ab6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800aba:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+  800ac6:	85 c0                	test   %eax,%eax
+  800ac8:	78 41                	js     800b0b <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aca:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ace:	41 8b 3e             	mov    (%r14),%edi
+  800ad1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ad5:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800adc:	00 00 00 
+  800adf:	ff d0                	call   *%rax
+  800ae1:	85 c0                	test   %eax,%eax
+  800ae3:	78 35                	js     800b1a <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ae5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ae9:	83 e0 03             	and    $0x3,%eax
+  800aec:	83 f8 01             	cmp    $0x1,%eax
+  800aef:	74 2d                	je     800b1e <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800af1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800af5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800af9:	48 85 c0             	test   %rax,%rax
+  800afc:	74 56                	je     800b54 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800afe:	4c 89 ea             	mov    %r13,%rdx
+  800b01:	4c 89 e6             	mov    %r12,%rsi
+  800b04:	4c 89 f7             	mov    %r14,%rdi
+  800b07:	ff d0                	call   *%rax
+  800b09:	eb 02                	jmp    800b0d <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b0b:	48 98                	cltq
+}
+  800b0d:	48 83 c4 10          	add    $0x10,%rsp
+  800b11:	5b                   	pop    %rbx
+  800b12:	41 5c                	pop    %r12
+  800b14:	41 5d                	pop    %r13
+  800b16:	41 5e                	pop    %r14
+  800b18:	5d                   	pop    %rbp
+  800b19:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b1a:	48 98                	cltq
+  800b1c:	eb ef                	jmp    800b0d <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b25:	00 00 00 
+  800b28:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b2e:	89 da                	mov    %ebx,%edx
+  800b30:	48 bf f0 36 80 00 00 	movabs $0x8036f0,%rdi
+  800b37:	00 00 00 
+  800b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3f:	48 b9 51 26 80 00 00 	movabs $0x802651,%rcx
+  800b46:	00 00 00 
+  800b49:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b4b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b52:	eb b9                	jmp    800b0d <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b54:	4c 89 ea             	mov    %r13,%rdx
+  800b57:	4c 89 e6             	mov    %r12,%rsi
+  800b5a:	89 df                	mov    %ebx,%edi
+  800b5c:	48 b8 e1 09 80 00 00 	movabs $0x8009e1,%rax
+  800b63:	00 00 00 
+  800b66:	ff d0                	call   *%rax
+  800b68:	eb a3                	jmp    800b0d <readmap+0x6e>
+
+0000000000800b6a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b6a:	55                   	push   %rbp
+  800b6b:	48 89 e5             	mov    %rsp,%rbp
+  800b6e:	41 57                	push   %r15
+  800b70:	41 56                	push   %r14
+  800b72:	41 55                	push   %r13
+  800b74:	41 54                	push   %r12
+  800b76:	53                   	push   %rbx
+  800b77:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b7b:	48 85 d2             	test   %rdx,%rdx
+  800b7e:	74 54                	je     800bd4 <readn+0x6a>
+  800b80:	41 89 fd             	mov    %edi,%r13d
+  800b83:	49 89 f6             	mov    %rsi,%r14
+  800b86:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b89:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b8e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b93:	49 bf e1 09 80 00 00 	movabs $0x8009e1,%r15
+  800b9a:	00 00 00 
+  800b9d:	4c 89 e2             	mov    %r12,%rdx
+  800ba0:	48 29 f2             	sub    %rsi,%rdx
+  800ba3:	4c 01 f6             	add    %r14,%rsi
+  800ba6:	44 89 ef             	mov    %r13d,%edi
+  800ba9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800bac:	85 c0                	test   %eax,%eax
+  800bae:	78 20                	js     800bd0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bb0:	01 c3                	add    %eax,%ebx
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	74 08                	je     800bbe <readn+0x54>
+  800bb6:	48 63 f3             	movslq %ebx,%rsi
+  800bb9:	4c 39 e6             	cmp    %r12,%rsi
+  800bbc:	72 df                	jb     800b9d <readn+0x33>
+    }
+    return res;
+  800bbe:	48 63 c3             	movslq %ebx,%rax
+}
+  800bc1:	48 83 c4 08          	add    $0x8,%rsp
+  800bc5:	5b                   	pop    %rbx
+  800bc6:	41 5c                	pop    %r12
+  800bc8:	41 5d                	pop    %r13
+  800bca:	41 5e                	pop    %r14
+  800bcc:	41 5f                	pop    %r15
+  800bce:	5d                   	pop    %rbp
+  800bcf:	c3                   	ret
+        if (inc < 0) return inc;
+  800bd0:	48 98                	cltq
+  800bd2:	eb ed                	jmp    800bc1 <readn+0x57>
+    int inc = 1, res = 0;
+  800bd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd9:	eb e3                	jmp    800bbe <readn+0x54>
+
+0000000000800bdb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bdb:	55                   	push   %rbp
+  800bdc:	48 89 e5             	mov    %rsp,%rbp
+  800bdf:	41 56                	push   %r14
+  800be1:	41 55                	push   %r13
+  800be3:	41 54                	push   %r12
+  800be5:	53                   	push   %rbx
+  800be6:	48 83 ec 10          	sub    $0x10,%rsp
+  800bea:	89 fb                	mov    %edi,%ebx
+  800bec:	49 89 f4             	mov    %rsi,%r12
+  800bef:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bf2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bf6:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+  800c02:	85 c0                	test   %eax,%eax
+  800c04:	78 47                	js     800c4d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c06:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c0a:	41 8b 3e             	mov    (%r14),%edi
+  800c0d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c11:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800c18:	00 00 00 
+  800c1b:	ff d0                	call   *%rax
+  800c1d:	85 c0                	test   %eax,%eax
+  800c1f:	78 30                	js     800c51 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c21:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c26:	74 2d                	je     800c55 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c2c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c30:	48 85 c0             	test   %rax,%rax
+  800c33:	74 56                	je     800c8b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c35:	4c 89 ea             	mov    %r13,%rdx
+  800c38:	4c 89 e6             	mov    %r12,%rsi
+  800c3b:	4c 89 f7             	mov    %r14,%rdi
+  800c3e:	ff d0                	call   *%rax
+}
+  800c40:	48 83 c4 10          	add    $0x10,%rsp
+  800c44:	5b                   	pop    %rbx
+  800c45:	41 5c                	pop    %r12
+  800c47:	41 5d                	pop    %r13
+  800c49:	41 5e                	pop    %r14
+  800c4b:	5d                   	pop    %rbp
+  800c4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c4d:	48 98                	cltq
+  800c4f:	eb ef                	jmp    800c40 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c51:	48 98                	cltq
+  800c53:	eb eb                	jmp    800c40 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c5c:	00 00 00 
+  800c5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c65:	89 da                	mov    %ebx,%edx
+  800c67:	48 bf 4d 37 80 00 00 	movabs $0x80374d,%rdi
+  800c6e:	00 00 00 
+  800c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c76:	48 b9 51 26 80 00 00 	movabs $0x802651,%rcx
+  800c7d:	00 00 00 
+  800c80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c89:	eb b5                	jmp    800c40 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c92:	eb ac                	jmp    800c40 <write+0x65>
+
+0000000000800c94 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c94:	55                   	push   %rbp
+  800c95:	48 89 e5             	mov    %rsp,%rbp
+  800c98:	53                   	push   %rbx
+  800c99:	48 83 ec 18          	sub    $0x18,%rsp
+  800c9d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ca3:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800caa:	00 00 00 
+  800cad:	ff d0                	call   *%rax
+  800caf:	85 c0                	test   %eax,%eax
+  800cb1:	78 0c                	js     800cbf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800cba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cc5:	55                   	push   %rbp
+  800cc6:	48 89 e5             	mov    %rsp,%rbp
+  800cc9:	41 55                	push   %r13
+  800ccb:	41 54                	push   %r12
+  800ccd:	53                   	push   %rbx
+  800cce:	48 83 ec 18          	sub    $0x18,%rsp
+  800cd2:	89 fb                	mov    %edi,%ebx
+  800cd4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cdb:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800ce2:	00 00 00 
+  800ce5:	ff d0                	call   *%rax
+  800ce7:	85 c0                	test   %eax,%eax
+  800ce9:	78 38                	js     800d23 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ceb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cef:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cf3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf7:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	78 1c                	js     800d23 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d07:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d0c:	74 20                	je     800d2e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d12:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d16:	48 85 c0             	test   %rax,%rax
+  800d19:	74 47                	je     800d62 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d1b:	44 89 e6             	mov    %r12d,%esi
+  800d1e:	4c 89 ef             	mov    %r13,%rdi
+  800d21:	ff d0                	call   *%rax
+}
+  800d23:	48 83 c4 18          	add    $0x18,%rsp
+  800d27:	5b                   	pop    %rbx
+  800d28:	41 5c                	pop    %r12
+  800d2a:	41 5d                	pop    %r13
+  800d2c:	5d                   	pop    %rbp
+  800d2d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d2e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d35:	00 00 00 
+  800d38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d3e:	89 da                	mov    %ebx,%edx
+  800d40:	48 bf 10 37 80 00 00 	movabs $0x803710,%rdi
+  800d47:	00 00 00 
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	48 b9 51 26 80 00 00 	movabs $0x802651,%rcx
+  800d56:	00 00 00 
+  800d59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d60:	eb c1                	jmp    800d23 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d67:	eb ba                	jmp    800d23 <ftruncate+0x5e>
+
+0000000000800d69 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+  800d6d:	41 54                	push   %r12
+  800d6f:	53                   	push   %rbx
+  800d70:	48 83 ec 10          	sub    $0x10,%rsp
+  800d74:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d7b:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	78 4e                	js     800dd9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d8b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d8f:	41 8b 3c 24          	mov    (%r12),%edi
+  800d93:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d97:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800d9e:	00 00 00 
+  800da1:	ff d0                	call   *%rax
+  800da3:	85 c0                	test   %eax,%eax
+  800da5:	78 32                	js     800dd9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800da7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dab:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800db0:	74 30                	je     800de2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800db2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800db5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800dbc:	00 00 00 
+    stat->st_isdir = 0;
+  800dbf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dc6:	00 00 00 
+    stat->st_dev = dev;
+  800dc9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dd0:	48 89 de             	mov    %rbx,%rsi
+  800dd3:	4c 89 e7             	mov    %r12,%rdi
+  800dd6:	ff 50 30             	call   *0x30(%rax)
+}
+  800dd9:	48 83 c4 10          	add    $0x10,%rsp
+  800ddd:	5b                   	pop    %rbx
+  800dde:	41 5c                	pop    %r12
+  800de0:	5d                   	pop    %rbp
+  800de1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800de2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800de7:	eb f0                	jmp    800dd9 <fstat+0x70>
+
+0000000000800de9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800de9:	55                   	push   %rbp
+  800dea:	48 89 e5             	mov    %rsp,%rbp
+  800ded:	41 54                	push   %r12
+  800def:	53                   	push   %rbx
+  800df0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800df3:	be 00 00 00 00       	mov    $0x0,%esi
+  800df8:	48 b8 40 1b 80 00 00 	movabs $0x801b40,%rax
+  800dff:	00 00 00 
+  800e02:	ff d0                	call   *%rax
+  800e04:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	78 25                	js     800e2f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e0a:	4c 89 e6             	mov    %r12,%rsi
+  800e0d:	89 c7                	mov    %eax,%edi
+  800e0f:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800e16:	00 00 00 
+  800e19:	ff d0                	call   *%rax
+  800e1b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e1e:	89 df                	mov    %ebx,%edi
+  800e20:	48 b8 63 08 80 00 00 	movabs $0x800863,%rax
+  800e27:	00 00 00 
+  800e2a:	ff d0                	call   *%rax
+
+    return res;
+  800e2c:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e2f:	89 d8                	mov    %ebx,%eax
+  800e31:	5b                   	pop    %rbx
+  800e32:	41 5c                	pop    %r12
+  800e34:	5d                   	pop    %rbp
+  800e35:	c3                   	ret
+
+0000000000800e36 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e36:	55                   	push   %rbp
+  800e37:	48 89 e5             	mov    %rsp,%rbp
+  800e3a:	41 54                	push   %r12
+  800e3c:	53                   	push   %rbx
+  800e3d:	48 83 ec 10          	sub    $0x10,%rsp
+  800e41:	48 89 fb             	mov    %rdi,%rbx
+  800e44:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e47:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e4b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e50:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800e57:	00 00 00 
+  800e5a:	ff d0                	call   *%rax
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	78 1f                	js     800e7f <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e64:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e68:	48 85 c0             	test   %rax,%rax
+  800e6b:	74 1b                	je     800e88 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e6d:	4c 89 e6             	mov    %r12,%rsi
+  800e70:	48 89 df             	mov    %rbx,%rdi
+  800e73:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e75:	85 c0                	test   %eax,%eax
+  800e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e7f:	48 83 c4 10          	add    $0x10,%rsp
+  800e83:	5b                   	pop    %rbx
+  800e84:	41 5c                	pop    %r12
+  800e86:	5d                   	pop    %rbp
+  800e87:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e88:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e8d:	eb f0                	jmp    800e7f <create_snapshot+0x49>
+
+0000000000800e8f <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e8f:	55                   	push   %rbp
+  800e90:	48 89 e5             	mov    %rsp,%rbp
+  800e93:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e9b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ea0:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800ea7:	00 00 00 
+  800eaa:	ff d0                	call   *%rax
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	78 1e                	js     800ece <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800eb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800eb4:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800eb8:	48 85 d2             	test   %rdx,%rdx
+  800ebb:	74 13                	je     800ed0 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec2:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ecb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ece:	c9                   	leave
+  800ecf:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ed0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ed5:	eb f7                	jmp    800ece <print_snapshot_list+0x3f>
+
+0000000000800ed7 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ed7:	55                   	push   %rbp
+  800ed8:	48 89 e5             	mov    %rsp,%rbp
+  800edb:	53                   	push   %rbx
+  800edc:	48 83 ec 18          	sub    $0x18,%rsp
+  800ee0:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ee3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ee7:	bf 66 00 00 00       	mov    $0x66,%edi
+  800eec:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+  800ef8:	85 c0                	test   %eax,%eax
+  800efa:	78 1c                	js     800f18 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800efc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f00:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800f04:	48 85 c0             	test   %rax,%rax
+  800f07:	74 15                	je     800f1e <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f09:	48 89 df             	mov    %rbx,%rdi
+  800f0c:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f0e:	85 c0                	test   %eax,%eax
+  800f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f15:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f1c:	c9                   	leave
+  800f1d:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f1e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f23:	eb f3                	jmp    800f18 <accept_snapshot+0x41>
+
+0000000000800f25 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f25:	55                   	push   %rbp
+  800f26:	48 89 e5             	mov    %rsp,%rbp
+  800f29:	53                   	push   %rbx
+  800f2a:	48 83 ec 18          	sub    $0x18,%rsp
+  800f2e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f35:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f3a:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	78 1c                	js     800f66 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f4e:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f52:	48 85 c0             	test   %rax,%rax
+  800f55:	74 15                	je     800f6c <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f57:	48 89 df             	mov    %rbx,%rdi
+  800f5a:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f63:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6a:	c9                   	leave
+  800f6b:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f6c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f71:	eb f3                	jmp    800f66 <delete_snapshot+0x41>
+
+0000000000800f73 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f7b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f7f:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f84:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800f8b:	00 00 00 
+  800f8e:	ff d0                	call   *%rax
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	78 14                	js     800fa8 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f98:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f9c:	48 85 d2             	test   %rdx,%rdx
+  800f9f:	74 09                	je     800faa <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa6:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800fa8:	c9                   	leave
+  800fa9:	c3                   	ret
+        return -E_NOT_SUPP;
+  800faa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800faf:	eb f7                	jmp    800fa8 <gc_snapshots+0x35>
+
+0000000000800fb1 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fb1:	55                   	push   %rbp
+  800fb2:	48 89 e5             	mov    %rsp,%rbp
+  800fb5:	41 56                	push   %r14
+  800fb7:	41 55                	push   %r13
+  800fb9:	41 54                	push   %r12
+  800fbb:	53                   	push   %rbx
+  800fbc:	48 83 ec 10          	sub    $0x10,%rsp
+  800fc0:	48 89 fb             	mov    %rdi,%rbx
+  800fc3:	49 89 f4             	mov    %rsi,%r12
+  800fc6:	49 89 d5             	mov    %rdx,%r13
+  800fc9:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fcc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fd0:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fd5:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	78 1b                	js     801000 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fe5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe9:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fed:	48 85 c0             	test   %rax,%rax
+  800ff0:	74 1b                	je     80100d <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800ff2:	4c 89 f1             	mov    %r14,%rcx
+  800ff5:	4c 89 ea             	mov    %r13,%rdx
+  800ff8:	4c 89 e6             	mov    %r12,%rsi
+  800ffb:	48 89 df             	mov    %rbx,%rdi
+  800ffe:	ff d0                	call   *%rax
+
+    return res;
+}
+  801000:	48 83 c4 10          	add    $0x10,%rsp
+  801004:	5b                   	pop    %rbx
+  801005:	41 5c                	pop    %r12
+  801007:	41 5d                	pop    %r13
+  801009:	41 5e                	pop    %r14
+  80100b:	5d                   	pop    %rbp
+  80100c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80100d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801012:	eb ec                	jmp    801000 <diff_snapshots+0x4f>
+
+0000000000801014 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801014:	55                   	push   %rbp
+  801015:	48 89 e5             	mov    %rsp,%rbp
+  801018:	41 55                	push   %r13
+  80101a:	41 54                	push   %r12
+  80101c:	53                   	push   %rbx
+  80101d:	48 83 ec 18          	sub    $0x18,%rsp
+  801021:	48 89 fb             	mov    %rdi,%rbx
+  801024:	49 89 f4             	mov    %rsi,%r12
+  801027:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80102a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80102e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801033:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  80103a:	00 00 00 
+  80103d:	ff d0                	call   *%rax
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	78 18                	js     80105b <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801043:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801047:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80104b:	48 85 c0             	test   %rax,%rax
+  80104e:	74 16                	je     801066 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801050:	4c 89 ea             	mov    %r13,%rdx
+  801053:	4c 89 e6             	mov    %r12,%rsi
+  801056:	48 89 df             	mov    %rbx,%rdi
+  801059:	ff d0                	call   *%rax
+
+    return res;
+}
+  80105b:	48 83 c4 18          	add    $0x18,%rsp
+  80105f:	5b                   	pop    %rbx
+  801060:	41 5c                	pop    %r12
+  801062:	41 5d                	pop    %r13
+  801064:	5d                   	pop    %rbp
+  801065:	c3                   	ret
+        return -E_NOT_SUPP;
+  801066:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80106b:	eb ee                	jmp    80105b <send_snapshot+0x47>
+
+000000000080106d <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80106d:	55                   	push   %rbp
+  80106e:	48 89 e5             	mov    %rsp,%rbp
+  801071:	53                   	push   %rbx
+  801072:	48 83 ec 18          	sub    $0x18,%rsp
+  801076:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801079:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80107d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801082:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  801089:	00 00 00 
+  80108c:	ff d0                	call   *%rax
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	78 12                	js     8010a4 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801092:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801096:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80109a:	48 85 c0             	test   %rax,%rax
+  80109d:	74 0b                	je     8010aa <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80109f:	48 89 df             	mov    %rbx,%rdi
+  8010a2:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a8:	c9                   	leave
+  8010a9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010af:	eb f3                	jmp    8010a4 <receive_snapshot+0x37>
+
+00000000008010b1 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010b1:	55                   	push   %rbp
+  8010b2:	48 89 e5             	mov    %rsp,%rbp
+  8010b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010bd:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010c2:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  8010c9:	00 00 00 
+  8010cc:	ff d0                	call   *%rax
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	78 17                	js     8010e9 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010d6:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010dd:	48 85 d2             	test   %rdx,%rdx
+  8010e0:	74 09                	je     8010eb <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e7:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010eb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010f0:	eb f7                	jmp    8010e9 <free_space_bytes+0x38>
+
+00000000008010f2 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010fa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010fe:	bf 66 00 00 00       	mov    $0x66,%edi
+  801103:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  80110a:	00 00 00 
+  80110d:	ff d0                	call   *%rax
+  80110f:	85 c0                	test   %eax,%eax
+  801111:	78 17                	js     80112a <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801113:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801117:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80111e:	48 85 d2             	test   %rdx,%rdx
+  801121:	74 09                	je     80112c <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801123:	b8 00 00 00 00       	mov    $0x0,%eax
+  801128:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80112c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801131:	eb f7                	jmp    80112a <busy_space_bytes+0x38>
+
+0000000000801133 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	41 54                	push   %r12
+  801139:	53                   	push   %rbx
+  80113a:	48 83 ec 10          	sub    $0x10,%rsp
+  80113e:	89 fb                	mov    %edi,%ebx
+  801140:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801143:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801147:	bf 66 00 00 00       	mov    $0x66,%edi
+  80114c:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  801153:	00 00 00 
+  801156:	ff d0                	call   *%rax
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	78 17                	js     801173 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80115c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801160:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801167:	48 85 c0             	test   %rax,%rax
+  80116a:	74 10                	je     80117c <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80116c:	4c 89 e6             	mov    %r12,%rsi
+  80116f:	89 df                	mov    %ebx,%edi
+  801171:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801173:	48 83 c4 10          	add    $0x10,%rsp
+  801177:	5b                   	pop    %rbx
+  801178:	41 5c                	pop    %r12
+  80117a:	5d                   	pop    %rbp
+  80117b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80117c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801181:	eb f0                	jmp    801173 <snapshots_space+0x40>
+
+0000000000801183 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801183:	55                   	push   %rbp
+  801184:	48 89 e5             	mov    %rsp,%rbp
+  801187:	41 55                	push   %r13
+  801189:	41 54                	push   %r12
+  80118b:	53                   	push   %rbx
+  80118c:	48 83 ec 08          	sub    $0x8,%rsp
+  801190:	41 89 fd             	mov    %edi,%r13d
+  801193:	48 89 f3             	mov    %rsi,%rbx
+  801196:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801199:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011a0:	00 00 00 
+  8011a3:	83 38 00             	cmpl   $0x0,(%rax)
+  8011a6:	74 57                	je     8011ff <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011a8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8011ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011b3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011ba:	00 00 00 
+  8011bd:	44 89 ee             	mov    %r13d,%esi
+  8011c0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011c7:	00 00 00 
+  8011ca:	8b 38                	mov    (%rax),%edi
+  8011cc:	48 b8 78 35 80 00 00 	movabs $0x803578,%rax
+  8011d3:	00 00 00 
+  8011d6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011dd:	4c 89 e2             	mov    %r12,%rdx
+  8011e0:	48 89 de             	mov    %rbx,%rsi
+  8011e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011e8:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+}
+  8011f4:	48 83 c4 08          	add    $0x8,%rsp
+  8011f8:	5b                   	pop    %rbx
+  8011f9:	41 5c                	pop    %r12
+  8011fb:	41 5d                	pop    %r13
+  8011fd:	5d                   	pop    %rbp
+  8011fe:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ff:	bf 03 00 00 00       	mov    $0x3,%edi
+  801204:	48 b8 36 36 80 00 00 	movabs $0x803636,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+  801210:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801217:	00 00 
+  801219:	eb 8d                	jmp    8011a8 <fsipc_region+0x25>
+
+000000000080121b <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80121b:	55                   	push   %rbp
+  80121c:	48 89 e5             	mov    %rsp,%rbp
+  80121f:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801223:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80122a:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80122b:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80122f:	48 b8 83 11 80 00 00 	movabs $0x801183,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+}
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+
+000000000080123d <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80123d:	85 ff                	test   %edi,%edi
+  80123f:	78 6d                	js     8012ae <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801241:	55                   	push   %rbp
+  801242:	48 89 e5             	mov    %rsp,%rbp
+  801245:	41 54                	push   %r12
+  801247:	53                   	push   %rbx
+  801248:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80124b:	48 85 f6             	test   %rsi,%rsi
+  80124e:	74 57                	je     8012a7 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801250:	89 f8                	mov    %edi,%eax
+  801252:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801259:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80125b:	be 00 00 00 00       	mov    $0x0,%esi
+  801260:	bf 12 00 00 00       	mov    $0x12,%edi
+  801265:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80126c:	00 00 00 
+  80126f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801271:	85 c0                	test   %eax,%eax
+  801273:	78 2d                	js     8012a2 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801275:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80127c:	00 00 00 
+  80127f:	49 63 14 24          	movslq (%r12),%rdx
+  801283:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80128a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80128f:	48 89 df             	mov    %rbx,%rdi
+  801292:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  801299:	00 00 00 
+  80129c:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80129e:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8012a2:	5b                   	pop    %rbx
+  8012a3:	41 5c                	pop    %r12
+  8012a5:	5d                   	pop    %rbp
+  8012a6:	c3                   	ret
+        return -E_INVAL;
+  8012a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ac:	eb f4                	jmp    8012a2 <devfile_df_snapshots+0x65>
+  8012ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012b3:	c3                   	ret
+
+00000000008012b4 <devfile_df_busy>:
+devfile_df_busy() {
+  8012b4:	55                   	push   %rbp
+  8012b5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012c2:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  8012c9:	00 00 00 
+  8012cc:	ff d0                	call   *%rax
+}
+  8012ce:	5d                   	pop    %rbp
+  8012cf:	c3                   	ret
+
+00000000008012d0 <devfile_df_free>:
+devfile_df_free() {
+  8012d0:	55                   	push   %rbp
+  8012d1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012de:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  8012e5:	00 00 00 
+  8012e8:	ff d0                	call   *%rax
+}
+  8012ea:	5d                   	pop    %rbp
+  8012eb:	c3                   	ret
+
+00000000008012ec <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012fa:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801301:	00 00 00 
+  801304:	ff d0                	call   *%rax
+}
+  801306:	5d                   	pop    %rbp
+  801307:	c3                   	ret
+
+0000000000801308 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80130c:	be 00 00 00 00       	mov    $0x0,%esi
+  801311:	bf 09 00 00 00       	mov    $0x9,%edi
+  801316:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80131d:	00 00 00 
+  801320:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801322:	85 c0                	test   %eax,%eax
+  801324:	ba 00 00 00 00       	mov    $0x0,%edx
+  801329:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80132c:	5d                   	pop    %rbp
+  80132d:	c3                   	ret
+
+000000000080132e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80132e:	55                   	push   %rbp
+  80132f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801332:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801339:	00 00 00 
+  80133c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80133f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801341:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801344:	be 00 00 00 00       	mov    $0x0,%esi
+  801349:	bf 02 00 00 00       	mov    $0x2,%edi
+  80134e:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801355:	00 00 00 
+  801358:	ff d0                	call   *%rax
+}
+  80135a:	5d                   	pop    %rbp
+  80135b:	c3                   	ret
+
+000000000080135c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80135c:	55                   	push   %rbp
+  80135d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801360:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801363:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80136a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	bf 06 00 00 00       	mov    $0x6,%edi
+  801376:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80137d:	00 00 00 
+  801380:	ff d0                	call   *%rax
+}
+  801382:	5d                   	pop    %rbp
+  801383:	c3                   	ret
+
+0000000000801384 <devfile_write>:
+    if (!fd || !buf) {
+  801384:	48 85 ff             	test   %rdi,%rdi
+  801387:	0f 84 c1 00 00 00    	je     80144e <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80138d:	55                   	push   %rbp
+  80138e:	48 89 e5             	mov    %rsp,%rbp
+  801391:	41 57                	push   %r15
+  801393:	41 56                	push   %r14
+  801395:	41 55                	push   %r13
+  801397:	41 54                	push   %r12
+  801399:	53                   	push   %rbx
+  80139a:	48 83 ec 18          	sub    $0x18,%rsp
+  80139e:	49 89 ff             	mov    %rdi,%r15
+  8013a1:	49 89 f5             	mov    %rsi,%r13
+  8013a4:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013a7:	48 85 f6             	test   %rsi,%rsi
+  8013aa:	0f 84 95 00 00 00    	je     801445 <devfile_write+0xc1>
+    while (n) {
+  8013b0:	48 85 d2             	test   %rdx,%rdx
+  8013b3:	0f 84 83 00 00 00    	je     80143c <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013b9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013c0:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013c7:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013ca:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013cf:	49 39 dc             	cmp    %rbx,%r12
+  8013d2:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013d6:	48 89 da             	mov    %rbx,%rdx
+  8013d9:	4c 89 ee             	mov    %r13,%rsi
+  8013dc:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013e3:	00 00 00 
+  8013e6:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  8013ed:	00 00 00 
+  8013f0:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013f2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013f6:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013f9:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	bf 04 00 00 00       	mov    $0x4,%edi
+  801407:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80140e:	00 00 00 
+  801411:	ff d0                	call   *%rax
+        if (write < 0) {
+  801413:	85 c0                	test   %eax,%eax
+  801415:	78 21                	js     801438 <devfile_write+0xb4>
+        buf += write;
+  801417:	48 63 d0             	movslq %eax,%rdx
+  80141a:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80141d:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801420:	49 29 d4             	sub    %rdx,%r12
+  801423:	75 a5                	jne    8013ca <devfile_write+0x46>
+    return totalWrite;
+  801425:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801429:	48 83 c4 18          	add    $0x18,%rsp
+  80142d:	5b                   	pop    %rbx
+  80142e:	41 5c                	pop    %r12
+  801430:	41 5d                	pop    %r13
+  801432:	41 5e                	pop    %r14
+  801434:	41 5f                	pop    %r15
+  801436:	5d                   	pop    %rbp
+  801437:	c3                   	ret
+            return write;
+  801438:	48 98                	cltq
+  80143a:	eb ed                	jmp    801429 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80143c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801443:	eb e0                	jmp    801425 <devfile_write+0xa1>
+        return -E_INVAL;
+  801445:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80144c:	eb db                	jmp    801429 <devfile_write+0xa5>
+  80144e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801455:	c3                   	ret
+
+0000000000801456 <devfile_read>:
+    if (!fd || !buf) {
+  801456:	48 85 ff             	test   %rdi,%rdi
+  801459:	0f 84 c0 00 00 00    	je     80151f <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	41 57                	push   %r15
+  801465:	41 56                	push   %r14
+  801467:	41 55                	push   %r13
+  801469:	41 54                	push   %r12
+  80146b:	53                   	push   %rbx
+  80146c:	48 83 ec 18          	sub    $0x18,%rsp
+  801470:	49 89 ff             	mov    %rdi,%r15
+  801473:	49 89 f5             	mov    %rsi,%r13
+  801476:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801479:	48 85 f6             	test   %rsi,%rsi
+  80147c:	0f 84 96 00 00 00    	je     801518 <devfile_read+0xc2>
+    while (n) {
+  801482:	48 85 d2             	test   %rdx,%rdx
+  801485:	0f 84 87 00 00 00    	je     801512 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80148b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801492:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801493:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80149a:	00 00 00 
+  80149d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014a1:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8014a4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014a9:	49 39 c4             	cmp    %rax,%r12
+  8014ac:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014b0:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014be:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  8014c5:	00 00 00 
+  8014c8:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014ca:	85 c0                	test   %eax,%eax
+  8014cc:	7e 37                	jle    801505 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014ce:	48 63 d8             	movslq %eax,%rbx
+  8014d1:	48 89 da             	mov    %rbx,%rdx
+  8014d4:	4c 89 f6             	mov    %r14,%rsi
+  8014d7:	4c 89 ef             	mov    %r13,%rdi
+  8014da:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  8014e1:	00 00 00 
+  8014e4:	ff d0                	call   *%rax
+        buf += read;
+  8014e6:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014e9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014ed:	49 29 dc             	sub    %rbx,%r12
+  8014f0:	75 ab                	jne    80149d <devfile_read+0x47>
+  return totalRead;
+  8014f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014f6:	48 83 c4 18          	add    $0x18,%rsp
+  8014fa:	5b                   	pop    %rbx
+  8014fb:	41 5c                	pop    %r12
+  8014fd:	41 5d                	pop    %r13
+  8014ff:	41 5e                	pop    %r14
+  801501:	41 5f                	pop    %r15
+  801503:	5d                   	pop    %rbp
+  801504:	c3                   	ret
+            return read ? read : totalRead;
+  801505:	48 63 d0             	movslq %eax,%rdx
+  801508:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80150c:	48 0f 45 c2          	cmovne %rdx,%rax
+  801510:	eb e4                	jmp    8014f6 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  801512:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801516:	eb da                	jmp    8014f2 <devfile_read+0x9c>
+        return E_INVAL;
+  801518:	b8 03 00 00 00       	mov    $0x3,%eax
+  80151d:	eb d7                	jmp    8014f6 <devfile_read+0xa0>
+  80151f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801524:	c3                   	ret
+
+0000000000801525 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801525:	48 85 ff             	test   %rdi,%rdi
+  801528:	74 5f                	je     801589 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80152a:	55                   	push   %rbp
+  80152b:	48 89 e5             	mov    %rsp,%rbp
+  80152e:	53                   	push   %rbx
+  80152f:	48 83 ec 08          	sub    $0x8,%rsp
+  801533:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801536:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  80153d:	00 00 00 
+  801540:	ff d0                	call   *%rax
+  801542:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801548:	77 45                	ja     80158f <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80154a:	48 89 de             	mov    %rbx,%rsi
+  80154d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801554:	00 00 00 
+  801557:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  80155e:	00 00 00 
+  801561:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80156d:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801574:	00 00 00 
+  801577:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801580:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801583:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801587:	c9                   	leave
+  801588:	c3                   	ret
+        return -E_INVAL;
+  801589:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80158e:	c3                   	ret
+        return -E_INVAL;
+  80158f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801594:	eb ed                	jmp    801583 <devfile_receive_snapshot+0x5e>
+
+0000000000801596 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801596:	55                   	push   %rbp
+  801597:	48 89 e5             	mov    %rsp,%rbp
+  80159a:	41 55                	push   %r13
+  80159c:	41 54                	push   %r12
+  80159e:	53                   	push   %rbx
+  80159f:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a3:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015a6:	48 85 f6             	test   %rsi,%rsi
+  8015a9:	0f 94 c0             	sete   %al
+  8015ac:	48 85 d2             	test   %rdx,%rdx
+  8015af:	0f 94 c2             	sete   %dl
+  8015b2:	08 d0                	or     %dl,%al
+  8015b4:	0f 85 ad 00 00 00    	jne    801667 <devfile_send_snapshot+0xd1>
+  8015ba:	48 89 fb             	mov    %rdi,%rbx
+  8015bd:	49 89 f4             	mov    %rsi,%r12
+  8015c0:	48 85 ff             	test   %rdi,%rdi
+  8015c3:	0f 84 9e 00 00 00    	je     801667 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015c9:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8015d0:	00 00 00 
+  8015d3:	ff d0                	call   *%rax
+  8015d5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015db:	0f 87 8d 00 00 00    	ja     80166e <devfile_send_snapshot+0xd8>
+  8015e1:	4c 89 e7             	mov    %r12,%rdi
+  8015e4:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8015eb:	00 00 00 
+  8015ee:	ff d0                	call   *%rax
+  8015f0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015f6:	77 7d                	ja     801675 <devfile_send_snapshot+0xdf>
+  8015f8:	4c 89 ef             	mov    %r13,%rdi
+  8015fb:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  801602:	00 00 00 
+  801605:	ff d0                	call   *%rax
+  801607:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80160d:	77 6d                	ja     80167c <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80160f:	48 89 de             	mov    %rbx,%rsi
+  801612:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801619:	00 00 00 
+  80161c:	48 bb 76 2f 80 00 00 	movabs $0x802f76,%rbx
+  801623:	00 00 00 
+  801626:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801628:	4c 89 e6             	mov    %r12,%rsi
+  80162b:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801632:	00 00 00 
+  801635:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801637:	4c 89 ee             	mov    %r13,%rsi
+  80163a:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801641:	00 00 00 
+  801644:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801646:	be 00 00 00 00       	mov    $0x0,%esi
+  80164b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801650:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801657:	00 00 00 
+  80165a:	ff d0                	call   *%rax
+}
+  80165c:	48 83 c4 08          	add    $0x8,%rsp
+  801660:	5b                   	pop    %rbx
+  801661:	41 5c                	pop    %r12
+  801663:	41 5d                	pop    %r13
+  801665:	5d                   	pop    %rbp
+  801666:	c3                   	ret
+        return -E_INVAL;
+  801667:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166c:	eb ee                	jmp    80165c <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80166e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801673:	eb e7                	jmp    80165c <devfile_send_snapshot+0xc6>
+  801675:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167a:	eb e0                	jmp    80165c <devfile_send_snapshot+0xc6>
+  80167c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801681:	eb d9                	jmp    80165c <devfile_send_snapshot+0xc6>
+
+0000000000801683 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801683:	48 85 ff             	test   %rdi,%rdi
+  801686:	0f 84 41 01 00 00    	je     8017cd <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80168c:	55                   	push   %rbp
+  80168d:	48 89 e5             	mov    %rsp,%rbp
+  801690:	41 57                	push   %r15
+  801692:	41 56                	push   %r14
+  801694:	41 55                	push   %r13
+  801696:	41 54                	push   %r12
+  801698:	53                   	push   %rbx
+  801699:	48 83 ec 08          	sub    $0x8,%rsp
+  80169d:	49 89 fc             	mov    %rdi,%r12
+  8016a0:	49 89 f5             	mov    %rsi,%r13
+  8016a3:	48 89 d3             	mov    %rdx,%rbx
+  8016a6:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016a9:	48 85 f6             	test   %rsi,%rsi
+  8016ac:	0f 84 ff 00 00 00    	je     8017b1 <devfile_diff_snapshots+0x12e>
+  8016b2:	48 85 d2             	test   %rdx,%rdx
+  8016b5:	0f 84 fd 00 00 00    	je     8017b8 <devfile_diff_snapshots+0x135>
+  8016bb:	48 85 c9             	test   %rcx,%rcx
+  8016be:	0f 84 f4 00 00 00    	je     8017b8 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016c4:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8016cb:	00 00 00 
+  8016ce:	ff d0                	call   *%rax
+  8016d0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d6:	0f 87 e3 00 00 00    	ja     8017bf <devfile_diff_snapshots+0x13c>
+  8016dc:	4c 89 ef             	mov    %r13,%rdi
+  8016df:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8016e6:	00 00 00 
+  8016e9:	ff d0                	call   *%rax
+  8016eb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016f1:	0f 87 cf 00 00 00    	ja     8017c6 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016f7:	4c 89 e6             	mov    %r12,%rsi
+  8016fa:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801701:	00 00 00 
+  801704:	4c 89 e7             	mov    %r12,%rdi
+  801707:	49 bf 76 2f 80 00 00 	movabs $0x802f76,%r15
+  80170e:	00 00 00 
+  801711:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  801714:	4c 89 ee             	mov    %r13,%rsi
+  801717:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80171e:	00 
+  80171f:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801722:	48 8b 03             	mov    (%rbx),%rax
+  801725:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80172c:	00 
+  80172d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801731:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801738:	00 
+  801739:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80173d:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801744:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801745:	be 00 00 00 00       	mov    $0x0,%esi
+  80174a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80174f:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801756:	00 00 00 
+  801759:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	78 43                	js     8017a2 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80175f:	49 8b 04 24          	mov    (%r12),%rax
+  801763:	48 89 03             	mov    %rax,(%rbx)
+  801766:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80176b:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80176f:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801774:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801778:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80177d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801781:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801785:	48 c1 e2 03          	shl    $0x3,%rdx
+  801789:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80178e:	4c 89 f7             	mov    %r14,%rdi
+  801791:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80179d:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8017a2:	48 83 c4 08          	add    $0x8,%rsp
+  8017a6:	5b                   	pop    %rbx
+  8017a7:	41 5c                	pop    %r12
+  8017a9:	41 5d                	pop    %r13
+  8017ab:	41 5e                	pop    %r14
+  8017ad:	41 5f                	pop    %r15
+  8017af:	5d                   	pop    %rbp
+  8017b0:	c3                   	ret
+        return -E_INVAL;
+  8017b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b6:	eb ea                	jmp    8017a2 <devfile_diff_snapshots+0x11f>
+  8017b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bd:	eb e3                	jmp    8017a2 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c4:	eb dc                	jmp    8017a2 <devfile_diff_snapshots+0x11f>
+  8017c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017cb:	eb d5                	jmp    8017a2 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017d2:	c3                   	ret
+
+00000000008017d3 <devfile_delete_snapshot>:
+    if (!name) {
+  8017d3:	48 85 ff             	test   %rdi,%rdi
+  8017d6:	74 5f                	je     801837 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+  8017dc:	53                   	push   %rbx
+  8017dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e1:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017e4:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8017eb:	00 00 00 
+  8017ee:	ff d0                	call   *%rax
+  8017f0:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017f6:	77 45                	ja     80183d <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017f8:	48 89 de             	mov    %rbx,%rsi
+  8017fb:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801802:	00 00 00 
+  801805:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  80180c:	00 00 00 
+  80180f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  801811:	be 00 00 00 00       	mov    $0x0,%esi
+  801816:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80181b:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801827:	85 c0                	test   %eax,%eax
+  801829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801831:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801835:	c9                   	leave
+  801836:	c3                   	ret
+        return -E_INVAL;
+  801837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80183c:	c3                   	ret
+        return -E_INVAL;
+  80183d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801842:	eb ed                	jmp    801831 <devfile_delete_snapshot+0x5e>
+
+0000000000801844 <devfile_accept_snapshot>:
+    if (!name) {
+  801844:	48 85 ff             	test   %rdi,%rdi
+  801847:	74 5f                	je     8018a8 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801849:	55                   	push   %rbp
+  80184a:	48 89 e5             	mov    %rsp,%rbp
+  80184d:	53                   	push   %rbx
+  80184e:	48 83 ec 08          	sub    $0x8,%rsp
+  801852:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801855:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  80185c:	00 00 00 
+  80185f:	ff d0                	call   *%rax
+  801861:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801867:	77 45                	ja     8018ae <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801869:	48 89 de             	mov    %rbx,%rsi
+  80186c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801873:	00 00 00 
+  801876:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801882:	be 00 00 00 00       	mov    $0x0,%esi
+  801887:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80188c:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+        return -E_INVAL;
+  8018a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018ad:	c3                   	ret
+        return -E_INVAL;
+  8018ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b3:	eb ed                	jmp    8018a2 <devfile_accept_snapshot+0x5e>
+
+00000000008018b5 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018b5:	48 85 ff             	test   %rdi,%rdi
+  8018b8:	0f 84 9f 00 00 00    	je     80195d <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018be:	55                   	push   %rbp
+  8018bf:	48 89 e5             	mov    %rsp,%rbp
+  8018c2:	41 54                	push   %r12
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 89 fb             	mov    %rdi,%rbx
+  8018c8:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018cb:	48 85 f6             	test   %rsi,%rsi
+  8018ce:	74 78                	je     801948 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018d0:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8018d7:	00 00 00 
+  8018da:	ff d0                	call   *%rax
+  8018dc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018e2:	77 6b                	ja     80194f <devfile_create_snapshot+0x9a>
+  8018e4:	4c 89 e7             	mov    %r12,%rdi
+  8018e7:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8018ee:	00 00 00 
+  8018f1:	ff d0                	call   *%rax
+  8018f3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018f9:	77 5b                	ja     801956 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018fb:	48 89 de             	mov    %rbx,%rsi
+  8018fe:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801905:	00 00 00 
+  801908:	48 bb 76 2f 80 00 00 	movabs $0x802f76,%rbx
+  80190f:	00 00 00 
+  801912:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  801914:	4c 89 e6             	mov    %r12,%rsi
+  801917:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80191e:	00 00 00 
+  801921:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801923:	be 00 00 00 00       	mov    $0x0,%esi
+  801928:	bf 08 00 00 00       	mov    $0x8,%edi
+  80192d:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801934:	00 00 00 
+  801937:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801940:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801943:	5b                   	pop    %rbx
+  801944:	41 5c                	pop    %r12
+  801946:	5d                   	pop    %rbp
+  801947:	c3                   	ret
+        return -E_INVAL;
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194d:	eb f4                	jmp    801943 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80194f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801954:	eb ed                	jmp    801943 <devfile_create_snapshot+0x8e>
+  801956:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195b:	eb e6                	jmp    801943 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80195d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801962:	c3                   	ret
+
+0000000000801963 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801963:	55                   	push   %rbp
+  801964:	48 89 e5             	mov    %rsp,%rbp
+  801967:	41 54                	push   %r12
+  801969:	53                   	push   %rbx
+  80196a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80196d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801970:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801977:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801979:	be 00 00 00 00       	mov    $0x0,%esi
+  80197e:	bf 05 00 00 00       	mov    $0x5,%edi
+  801983:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80198a:	00 00 00 
+  80198d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	78 3d                	js     8019d0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801993:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80199a:	00 00 00 
+  80199d:	4c 89 e6             	mov    %r12,%rsi
+  8019a0:	48 89 df             	mov    %rbx,%rdi
+  8019a3:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  8019aa:	00 00 00 
+  8019ad:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8019af:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019b6:	00 
+  8019b7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019bd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019c4:	00 
+  8019c5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d0:	5b                   	pop    %rbx
+  8019d1:	41 5c                	pop    %r12
+  8019d3:	5d                   	pop    %rbp
+  8019d4:	c3                   	ret
+
+00000000008019d5 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019d5:	55                   	push   %rbp
+  8019d6:	48 89 e5             	mov    %rsp,%rbp
+  8019d9:	41 57                	push   %r15
+  8019db:	41 56                	push   %r14
+  8019dd:	41 55                	push   %r13
+  8019df:	41 54                	push   %r12
+  8019e1:	53                   	push   %rbx
+  8019e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019ea:	49 89 f5             	mov    %rsi,%r13
+  8019ed:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019f0:	48 89 f0             	mov    %rsi,%rax
+  8019f3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019f8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019fc:	75 4f                	jne    801a4d <devfile_readmap+0x78>
+  8019fe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a02:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a08:	75 1f                	jne    801a29 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a0a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a0e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a12:	49 be bd 21 80 00 00 	movabs $0x8021bd,%r14
+  801a19:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a1c:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a23:	0f 87 9d 00 00 00    	ja     801ac6 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a29:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a2d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a31:	4d 85 ff             	test   %r15,%r15
+  801a34:	0f 85 cf 00 00 00    	jne    801b09 <devfile_readmap+0x134>
+  801a3a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a3e:	48 83 c4 38          	add    $0x38,%rsp
+  801a42:	5b                   	pop    %rbx
+  801a43:	41 5c                	pop    %r12
+  801a45:	41 5d                	pop    %r13
+  801a47:	41 5e                	pop    %r14
+  801a49:	41 5f                	pop    %r15
+  801a4b:	5d                   	pop    %rbp
+  801a4c:	c3                   	ret
+    size_t totalRead = 0;
+  801a4d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a54:	00 
+  801a55:	eb da                	jmp    801a31 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a57:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a5b:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a5e:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a65:	00 00 00 
+  801a68:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a6e:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a72:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a76:	4c 89 ee             	mov    %r13,%rsi
+  801a79:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a7e:	48 b8 83 11 80 00 00 	movabs $0x801183,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	7e a3                	jle    801a31 <devfile_readmap+0x5c>
+  801a8e:	48 98                	cltq
+  801a90:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a94:	72 9b                	jb     801a31 <devfile_readmap+0x5c>
+        buf += read;
+  801a96:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a99:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a9c:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801aa0:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801aa7:	75 88                	jne    801a31 <devfile_readmap+0x5c>
+  801aa9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801aad:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801ab3:	0f 85 78 ff ff ff    	jne    801a31 <devfile_readmap+0x5c>
+  801ab9:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801ac0:	0f 86 6b ff ff ff    	jbe    801a31 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ac6:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801acc:	4d 39 e7             	cmp    %r12,%r15
+  801acf:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ad3:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801ada:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ade:	0f 84 73 ff ff ff    	je     801a57 <devfile_readmap+0x82>
+  801ae4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ae8:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801aed:	41 ff d6             	call   *%r14
+  801af0:	a8 40                	test   $0x40,%al
+  801af2:	0f 85 39 ff ff ff    	jne    801a31 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801af8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aff:	4c 39 e3             	cmp    %r12,%rbx
+  801b02:	72 e4                	jb     801ae8 <devfile_readmap+0x113>
+  801b04:	e9 4e ff ff ff       	jmp    801a57 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b09:	4c 89 fa             	mov    %r15,%rdx
+  801b0c:	4c 89 ee             	mov    %r13,%rsi
+  801b0f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b13:	48 b8 56 14 80 00 00 	movabs $0x801456,%rax
+  801b1a:	00 00 00 
+  801b1d:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b1f:	48 85 c0             	test   %rax,%rax
+  801b22:	78 0c                	js     801b30 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b24:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b28:	48 01 f0             	add    %rsi,%rax
+  801b2b:	e9 0e ff ff ff       	jmp    801a3e <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b30:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b34:	48 85 f6             	test   %rsi,%rsi
+  801b37:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b3b:	e9 fe fe ff ff       	jmp    801a3e <devfile_readmap+0x69>
+
+0000000000801b40 <open>:
+open(const char *path, int mode) {
+  801b40:	55                   	push   %rbp
+  801b41:	48 89 e5             	mov    %rsp,%rbp
+  801b44:	41 55                	push   %r13
+  801b46:	41 54                	push   %r12
+  801b48:	53                   	push   %rbx
+  801b49:	48 83 ec 18          	sub    $0x18,%rsp
+  801b4d:	49 89 fc             	mov    %rdi,%r12
+  801b50:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b53:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b65:	0f 87 8a 00 00 00    	ja     801bf5 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b6b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b6f:	48 b8 9e 06 80 00 00 	movabs $0x80069e,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+  801b7b:	89 c3                	mov    %eax,%ebx
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 50                	js     801bd1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b81:	4c 89 e6             	mov    %r12,%rsi
+  801b84:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b8b:	00 00 00 
+  801b8e:	48 89 df             	mov    %rbx,%rdi
+  801b91:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  801b98:	00 00 00 
+  801b9b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b9d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ba4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ba8:	bf 01 00 00 00       	mov    $0x1,%edi
+  801bad:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+  801bb9:	89 c3                	mov    %eax,%ebx
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 1f                	js     801bde <open+0x9e>
+    return fd2num(fd);
+  801bbf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bc3:	48 b8 70 06 80 00 00 	movabs $0x800670,%rax
+  801bca:	00 00 00 
+  801bcd:	ff d0                	call   *%rax
+  801bcf:	89 c3                	mov    %eax,%ebx
+}
+  801bd1:	89 d8                	mov    %ebx,%eax
+  801bd3:	48 83 c4 18          	add    $0x18,%rsp
+  801bd7:	5b                   	pop    %rbx
+  801bd8:	41 5c                	pop    %r12
+  801bda:	41 5d                	pop    %r13
+  801bdc:	5d                   	pop    %rbp
+  801bdd:	c3                   	ret
+        fd_close(fd, 0);
+  801bde:	be 00 00 00 00       	mov    $0x0,%esi
+  801be3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801be7:	48 b8 b9 07 80 00 00 	movabs $0x8007b9,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+        return res;
+  801bf3:	eb dc                	jmp    801bd1 <open+0x91>
+        return -E_BAD_PATH;
+  801bf5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bfa:	eb d5                	jmp    801bd1 <open+0x91>
+
+0000000000801bfc <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bfc:	55                   	push   %rbp
+  801bfd:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801c00:	be 00 00 00 00       	mov    $0x0,%esi
+  801c05:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c0a:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801c11:	00 00 00 
+  801c14:	ff d0                	call   *%rax
+}
+  801c16:	5d                   	pop    %rbp
+  801c17:	c3                   	ret
+
+0000000000801c18 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c18:	55                   	push   %rbp
+  801c19:	48 89 e5             	mov    %rsp,%rbp
+  801c1c:	41 54                	push   %r12
+  801c1e:	53                   	push   %rbx
+  801c1f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c22:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+  801c2e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c31:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  801c38:	00 00 00 
+  801c3b:	48 89 df             	mov    %rbx,%rdi
+  801c3e:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  801c45:	00 00 00 
+  801c48:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c4a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c4f:	41 2b 04 24          	sub    (%r12),%eax
+  801c53:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c59:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c60:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c63:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c6a:	00 00 00 
+  801c6d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c79:	5b                   	pop    %rbx
+  801c7a:	41 5c                	pop    %r12
+  801c7c:	5d                   	pop    %rbp
+  801c7d:	c3                   	ret
+
+0000000000801c7e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c7e:	55                   	push   %rbp
+  801c7f:	48 89 e5             	mov    %rsp,%rbp
+  801c82:	41 54                	push   %r12
+  801c84:	53                   	push   %rbx
+  801c85:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c8d:	48 89 fe             	mov    %rdi,%rsi
+  801c90:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c95:	49 bc 6c 03 80 00 00 	movabs $0x80036c,%r12
+  801c9c:	00 00 00 
+  801c9f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801ca2:	48 89 df             	mov    %rbx,%rdi
+  801ca5:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+  801cb1:	48 89 c6             	mov    %rax,%rsi
+  801cb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cbe:	41 ff d4             	call   *%r12
+}
+  801cc1:	5b                   	pop    %rbx
+  801cc2:	41 5c                	pop    %r12
+  801cc4:	5d                   	pop    %rbp
+  801cc5:	c3                   	ret
+
+0000000000801cc6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cc6:	55                   	push   %rbp
+  801cc7:	48 89 e5             	mov    %rsp,%rbp
+  801cca:	41 57                	push   %r15
+  801ccc:	41 56                	push   %r14
+  801cce:	41 55                	push   %r13
+  801cd0:	41 54                	push   %r12
+  801cd2:	53                   	push   %rbx
+  801cd3:	48 83 ec 18          	sub    $0x18,%rsp
+  801cd7:	49 89 fc             	mov    %rdi,%r12
+  801cda:	49 89 f5             	mov    %rsi,%r13
+  801cdd:	49 89 d7             	mov    %rdx,%r15
+  801ce0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ce4:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cf0:	4d 85 ff             	test   %r15,%r15
+  801cf3:	0f 84 af 00 00 00    	je     801da8 <devpipe_write+0xe2>
+  801cf9:	48 89 c3             	mov    %rax,%rbx
+  801cfc:	4c 89 f8             	mov    %r15,%rax
+  801cff:	4d 89 ef             	mov    %r13,%r15
+  801d02:	4c 01 e8             	add    %r13,%rax
+  801d05:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d09:	49 bd 74 02 80 00 00 	movabs $0x800274,%r13
+  801d10:	00 00 00 
+            sys_yield();
+  801d13:	49 be 11 02 80 00 00 	movabs $0x800211,%r14
+  801d1a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d1d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d20:	48 63 ce             	movslq %esi,%rcx
+  801d23:	48 63 03             	movslq (%rbx),%rax
+  801d26:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d2c:	48 39 c1             	cmp    %rax,%rcx
+  801d2f:	72 2e                	jb     801d5f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d31:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d36:	48 89 da             	mov    %rbx,%rdx
+  801d39:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d3e:	4c 89 e7             	mov    %r12,%rdi
+  801d41:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	74 66                	je     801dae <devpipe_write+0xe8>
+            sys_yield();
+  801d48:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d4b:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d4e:	48 63 ce             	movslq %esi,%rcx
+  801d51:	48 63 03             	movslq (%rbx),%rax
+  801d54:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d5a:	48 39 c1             	cmp    %rax,%rcx
+  801d5d:	73 d2                	jae    801d31 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d5f:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d63:	48 89 ca             	mov    %rcx,%rdx
+  801d66:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d6a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d71:	08 10 20 
+  801d74:	48 f7 e2             	mul    %rdx
+  801d77:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d7b:	48 89 d0             	mov    %rdx,%rax
+  801d7e:	48 c1 e0 09          	shl    $0x9,%rax
+  801d82:	48 29 d0             	sub    %rdx,%rax
+  801d85:	48 c1 e0 03          	shl    $0x3,%rax
+  801d89:	48 29 c1             	sub    %rax,%rcx
+  801d8c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d91:	83 c6 01             	add    $0x1,%esi
+  801d94:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d97:	49 83 c7 01          	add    $0x1,%r15
+  801d9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d9f:	49 39 c7             	cmp    %rax,%r15
+  801da2:	0f 85 75 ff ff ff    	jne    801d1d <devpipe_write+0x57>
+    return n;
+  801da8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801dac:	eb 05                	jmp    801db3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801dae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db3:	48 83 c4 18          	add    $0x18,%rsp
+  801db7:	5b                   	pop    %rbx
+  801db8:	41 5c                	pop    %r12
+  801dba:	41 5d                	pop    %r13
+  801dbc:	41 5e                	pop    %r14
+  801dbe:	41 5f                	pop    %r15
+  801dc0:	5d                   	pop    %rbp
+  801dc1:	c3                   	ret
+
+0000000000801dc2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801dc2:	55                   	push   %rbp
+  801dc3:	48 89 e5             	mov    %rsp,%rbp
+  801dc6:	41 57                	push   %r15
+  801dc8:	41 56                	push   %r14
+  801dca:	41 55                	push   %r13
+  801dcc:	41 54                	push   %r12
+  801dce:	53                   	push   %rbx
+  801dcf:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd3:	49 89 fc             	mov    %rdi,%r12
+  801dd6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dda:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dde:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801de5:	00 00 00 
+  801de8:	ff d0                	call   *%rax
+  801dea:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801ded:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801df3:	49 bd 74 02 80 00 00 	movabs $0x800274,%r13
+  801dfa:	00 00 00 
+            sys_yield();
+  801dfd:	49 be 11 02 80 00 00 	movabs $0x800211,%r14
+  801e04:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e07:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e0c:	74 7d                	je     801e8b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e0e:	8b 03                	mov    (%rbx),%eax
+  801e10:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e13:	75 26                	jne    801e3b <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e15:	4d 85 ff             	test   %r15,%r15
+  801e18:	75 77                	jne    801e91 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e1a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e1f:	48 89 da             	mov    %rbx,%rdx
+  801e22:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e27:	4c 89 e7             	mov    %r12,%rdi
+  801e2a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	74 72                	je     801ea3 <devpipe_read+0xe1>
+            sys_yield();
+  801e31:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e34:	8b 03                	mov    (%rbx),%eax
+  801e36:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e39:	74 df                	je     801e1a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e3b:	48 63 c8             	movslq %eax,%rcx
+  801e3e:	48 89 ca             	mov    %rcx,%rdx
+  801e41:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e45:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e4c:	08 10 20 
+  801e4f:	48 89 d0             	mov    %rdx,%rax
+  801e52:	48 f7 e6             	mul    %rsi
+  801e55:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e59:	48 89 d0             	mov    %rdx,%rax
+  801e5c:	48 c1 e0 09          	shl    $0x9,%rax
+  801e60:	48 29 d0             	sub    %rdx,%rax
+  801e63:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e6a:	00 
+  801e6b:	48 89 c8             	mov    %rcx,%rax
+  801e6e:	48 29 d0             	sub    %rdx,%rax
+  801e71:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e76:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e7a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e7e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e81:	49 83 c7 01          	add    $0x1,%r15
+  801e85:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e89:	75 83                	jne    801e0e <devpipe_read+0x4c>
+    return n;
+  801e8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e8f:	eb 03                	jmp    801e94 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e91:	4c 89 f8             	mov    %r15,%rax
+}
+  801e94:	48 83 c4 18          	add    $0x18,%rsp
+  801e98:	5b                   	pop    %rbx
+  801e99:	41 5c                	pop    %r12
+  801e9b:	41 5d                	pop    %r13
+  801e9d:	41 5e                	pop    %r14
+  801e9f:	41 5f                	pop    %r15
+  801ea1:	5d                   	pop    %rbp
+  801ea2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea8:	eb ea                	jmp    801e94 <devpipe_read+0xd2>
+
+0000000000801eaa <pipe>:
+pipe(int pfd[2]) {
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+  801eae:	41 55                	push   %r13
+  801eb0:	41 54                	push   %r12
+  801eb2:	53                   	push   %rbx
+  801eb3:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801eba:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ebe:	48 b8 9e 06 80 00 00 	movabs $0x80069e,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+  801eca:	89 c3                	mov    %eax,%ebx
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	0f 88 a0 01 00 00    	js     802074 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ed4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ed9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ede:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ee2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee7:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ef5:	85 c0                	test   %eax,%eax
+  801ef7:	0f 88 77 01 00 00    	js     802074 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801efd:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801f01:	48 b8 9e 06 80 00 00 	movabs $0x80069e,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	89 c3                	mov    %eax,%ebx
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	0f 88 43 01 00 00    	js     80205a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f17:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f21:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2a:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	0f 88 1a 01 00 00    	js     80205a <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f40:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f44:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  801f50:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f53:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f5d:	48 89 c6             	mov    %rax,%rsi
+  801f60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f65:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	0f 88 c5 00 00 00    	js     802040 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f7b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f7f:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+  801f8b:	48 89 c1             	mov    %rax,%rcx
+  801f8e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f94:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9f:	4c 89 ee             	mov    %r13,%rsi
+  801fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa7:	48 b8 07 03 80 00 00 	movabs $0x800307,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	89 c3                	mov    %eax,%ebx
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 6e                	js     802027 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fb9:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fbe:	4c 89 ef             	mov    %r13,%rdi
+  801fc1:	48 b8 42 02 80 00 00 	movabs $0x800242,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	83 f8 02             	cmp    $0x2,%eax
+  801fd0:	0f 85 ab 00 00 00    	jne    802081 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fd6:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fdd:	00 00 
+  801fdf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fe3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fe5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fe9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801ff0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801ff4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801ff6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ffa:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802001:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802005:	48 bb 70 06 80 00 00 	movabs $0x800670,%rbx
+  80200c:	00 00 00 
+  80200f:	ff d3                	call   *%rbx
+  802011:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802015:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802019:	ff d3                	call   *%rbx
+  80201b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802025:	eb 4d                	jmp    802074 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802027:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80202c:	4c 89 ee             	mov    %r13,%rsi
+  80202f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802034:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802040:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802045:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80204e:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80205a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80205f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802063:	bf 00 00 00 00       	mov    $0x0,%edi
+  802068:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+}
+  802074:	89 d8                	mov    %ebx,%eax
+  802076:	48 83 c4 18          	add    $0x18,%rsp
+  80207a:	5b                   	pop    %rbx
+  80207b:	41 5c                	pop    %r12
+  80207d:	41 5d                	pop    %r13
+  80207f:	5d                   	pop    %rbp
+  802080:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802081:	48 b9 d0 37 80 00 00 	movabs $0x8037d0,%rcx
+  802088:	00 00 00 
+  80208b:	48 ba a7 37 80 00 00 	movabs $0x8037a7,%rdx
+  802092:	00 00 00 
+  802095:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80209a:	48 bf bc 37 80 00 00 	movabs $0x8037bc,%rdi
+  8020a1:	00 00 00 
+  8020a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a9:	49 b8 01 25 80 00 00 	movabs $0x802501,%r8
+  8020b0:	00 00 00 
+  8020b3:	41 ff d0             	call   *%r8
+
+00000000008020b6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020b6:	55                   	push   %rbp
+  8020b7:	48 89 e5             	mov    %rsp,%rbp
+  8020ba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020be:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020c2:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 35                	js     802107 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d6:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  8020dd:	00 00 00 
+  8020e0:	ff d0                	call   *%rax
+  8020e2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020ea:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020f3:	48 b8 74 02 80 00 00 	movabs $0x800274,%rax
+  8020fa:	00 00 00 
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	0f 94 c0             	sete   %al
+  802104:	0f b6 c0             	movzbl %al,%eax
+}
+  802107:	c9                   	leave
+  802108:	c3                   	ret
+
+0000000000802109 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802109:	48 89 f8             	mov    %rdi,%rax
+  80210c:	48 c1 e8 27          	shr    $0x27,%rax
+  802110:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802117:	01 00 00 
+  80211a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80211e:	f6 c2 01             	test   $0x1,%dl
+  802121:	74 6d                	je     802190 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802123:	48 89 f8             	mov    %rdi,%rax
+  802126:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80212a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802131:	01 00 00 
+  802134:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802138:	f6 c2 01             	test   $0x1,%dl
+  80213b:	74 62                	je     80219f <get_uvpt_entry+0x96>
+  80213d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802144:	01 00 00 
+  802147:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80214b:	f6 c2 80             	test   $0x80,%dl
+  80214e:	75 4f                	jne    80219f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802150:	48 89 f8             	mov    %rdi,%rax
+  802153:	48 c1 e8 15          	shr    $0x15,%rax
+  802157:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80215e:	01 00 00 
+  802161:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802165:	f6 c2 01             	test   $0x1,%dl
+  802168:	74 44                	je     8021ae <get_uvpt_entry+0xa5>
+  80216a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802171:	01 00 00 
+  802174:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802178:	f6 c2 80             	test   $0x80,%dl
+  80217b:	75 31                	jne    8021ae <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80217d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802181:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802188:	01 00 00 
+  80218b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80218f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802190:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802197:	01 00 00 
+  80219a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80219e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80219f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021a6:	01 00 00 
+  8021a9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021ad:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021ae:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021b5:	01 00 00 
+  8021b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021bc:	c3                   	ret
+
+00000000008021bd <get_prot>:
+
+int
+get_prot(void *va) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021c1:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+  8021cd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021d0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021d5:	89 c1                	mov    %eax,%ecx
+  8021d7:	83 c9 04             	or     $0x4,%ecx
+  8021da:	f6 c2 01             	test   $0x1,%dl
+  8021dd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021e0:	89 c1                	mov    %eax,%ecx
+  8021e2:	83 c9 02             	or     $0x2,%ecx
+  8021e5:	f6 c2 02             	test   $0x2,%dl
+  8021e8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021eb:	89 c1                	mov    %eax,%ecx
+  8021ed:	83 c9 01             	or     $0x1,%ecx
+  8021f0:	48 85 d2             	test   %rdx,%rdx
+  8021f3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021f6:	89 c1                	mov    %eax,%ecx
+  8021f8:	83 c9 40             	or     $0x40,%ecx
+  8021fb:	f6 c6 04             	test   $0x4,%dh
+  8021fe:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802201:	5d                   	pop    %rbp
+  802202:	c3                   	ret
+
+0000000000802203 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802203:	55                   	push   %rbp
+  802204:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802207:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  80220e:	00 00 00 
+  802211:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802213:	48 c1 e8 06          	shr    $0x6,%rax
+  802217:	83 e0 01             	and    $0x1,%eax
+}
+  80221a:	5d                   	pop    %rbp
+  80221b:	c3                   	ret
+
+000000000080221c <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802220:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  802227:	00 00 00 
+  80222a:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80222c:	48 c1 e8 05          	shr    $0x5,%rax
+  802230:	83 e0 01             	and    $0x1,%eax
+}
+  802233:	5d                   	pop    %rbp
+  802234:	c3                   	ret
+
+0000000000802235 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802239:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  802240:	00 00 00 
+  802243:	ff d0                	call   *%rax
+  802245:	83 e0 01             	and    $0x1,%eax
+}
+  802248:	5d                   	pop    %rbp
+  802249:	c3                   	ret
+
+000000000080224a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80224a:	55                   	push   %rbp
+  80224b:	48 89 e5             	mov    %rsp,%rbp
+  80224e:	41 57                	push   %r15
+  802250:	41 56                	push   %r14
+  802252:	41 55                	push   %r13
+  802254:	41 54                	push   %r12
+  802256:	53                   	push   %rbx
+  802257:	48 83 ec 18          	sub    $0x18,%rsp
+  80225b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80225f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802263:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802268:	49 bd 35 22 80 00 00 	movabs $0x802235,%r13
+  80226f:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802272:	49 bf bd 21 80 00 00 	movabs $0x8021bd,%r15
+  802279:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80227c:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802283:	00 00 00 
+  802286:	eb 0c                	jmp    802294 <foreach_shared_region+0x4a>
+  802288:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80228f:	4c 39 f3             	cmp    %r14,%rbx
+  802292:	74 2e                	je     8022c2 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  802294:	48 89 df             	mov    %rbx,%rdi
+  802297:	41 ff d5             	call   *%r13
+  80229a:	84 c0                	test   %al,%al
+  80229c:	74 ea                	je     802288 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80229e:	48 89 df             	mov    %rbx,%rdi
+  8022a1:	41 ff d7             	call   *%r15
+  8022a4:	a8 40                	test   $0x40,%al
+  8022a6:	74 e0                	je     802288 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022a8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8022af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022b3:	48 89 df             	mov    %rbx,%rdi
+  8022b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022ba:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	79 c8                	jns    802288 <foreach_shared_region+0x3e>
+  8022c0:	eb 05                	jmp    8022c7 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c7:	48 83 c4 18          	add    $0x18,%rsp
+  8022cb:	5b                   	pop    %rbx
+  8022cc:	41 5c                	pop    %r12
+  8022ce:	41 5d                	pop    %r13
+  8022d0:	41 5e                	pop    %r14
+  8022d2:	41 5f                	pop    %r15
+  8022d4:	5d                   	pop    %rbp
+  8022d5:	c3                   	ret
+
+00000000008022d6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022db:	c3                   	ret
+
+00000000008022dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022dc:	55                   	push   %rbp
+  8022dd:	48 89 e5             	mov    %rsp,%rbp
+  8022e0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022e3:	48 be f4 37 80 00 00 	movabs $0x8037f4,%rsi
+  8022ea:	00 00 00 
+  8022ed:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+    return 0;
+}
+  8022f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fe:	5d                   	pop    %rbp
+  8022ff:	c3                   	ret
+
+0000000000802300 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+  802304:	41 57                	push   %r15
+  802306:	41 56                	push   %r14
+  802308:	41 55                	push   %r13
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802314:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80231b:	48 85 d2             	test   %rdx,%rdx
+  80231e:	74 7a                	je     80239a <devcons_write+0x9a>
+  802320:	49 89 d6             	mov    %rdx,%r14
+  802323:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802329:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80232e:	49 bf 70 31 80 00 00 	movabs $0x803170,%r15
+  802335:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802338:	4c 89 f3             	mov    %r14,%rbx
+  80233b:	48 29 f3             	sub    %rsi,%rbx
+  80233e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802343:	48 39 c3             	cmp    %rax,%rbx
+  802346:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80234a:	4c 63 eb             	movslq %ebx,%r13
+  80234d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802354:	48 01 c6             	add    %rax,%rsi
+  802357:	4c 89 ea             	mov    %r13,%rdx
+  80235a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802361:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802364:	4c 89 ee             	mov    %r13,%rsi
+  802367:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80236e:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80237a:	41 01 dc             	add    %ebx,%r12d
+  80237d:	49 63 f4             	movslq %r12d,%rsi
+  802380:	4c 39 f6             	cmp    %r14,%rsi
+  802383:	72 b3                	jb     802338 <devcons_write+0x38>
+    return res;
+  802385:	49 63 c4             	movslq %r12d,%rax
+}
+  802388:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80238f:	5b                   	pop    %rbx
+  802390:	41 5c                	pop    %r12
+  802392:	41 5d                	pop    %r13
+  802394:	41 5e                	pop    %r14
+  802396:	41 5f                	pop    %r15
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80239a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023a0:	eb e3                	jmp    802385 <devcons_write+0x85>
+
+00000000008023a2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023a2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023aa:	48 85 c0             	test   %rax,%rax
+  8023ad:	74 55                	je     802404 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023af:	55                   	push   %rbp
+  8023b0:	48 89 e5             	mov    %rsp,%rbp
+  8023b3:	41 55                	push   %r13
+  8023b5:	41 54                	push   %r12
+  8023b7:	53                   	push   %rbx
+  8023b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023bc:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023bf:	48 bb 44 01 80 00 00 	movabs $0x800144,%rbx
+  8023c6:	00 00 00 
+  8023c9:	49 bc 11 02 80 00 00 	movabs $0x800211,%r12
+  8023d0:	00 00 00 
+  8023d3:	eb 03                	jmp    8023d8 <devcons_read+0x36>
+  8023d5:	41 ff d4             	call   *%r12
+  8023d8:	ff d3                	call   *%rbx
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	74 f7                	je     8023d5 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023de:	48 63 d0             	movslq %eax,%rdx
+  8023e1:	78 13                	js     8023f6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e8:	83 f8 04             	cmp    $0x4,%eax
+  8023eb:	74 09                	je     8023f6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023ed:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023f1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023f6:	48 89 d0             	mov    %rdx,%rax
+  8023f9:	48 83 c4 08          	add    $0x8,%rsp
+  8023fd:	5b                   	pop    %rbx
+  8023fe:	41 5c                	pop    %r12
+  802400:	41 5d                	pop    %r13
+  802402:	5d                   	pop    %rbp
+  802403:	c3                   	ret
+  802404:	48 89 d0             	mov    %rdx,%rax
+  802407:	c3                   	ret
+
+0000000000802408 <cputchar>:
+cputchar(int ch) {
+  802408:	55                   	push   %rbp
+  802409:	48 89 e5             	mov    %rsp,%rbp
+  80240c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802410:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802414:	be 01 00 00 00       	mov    $0x1,%esi
+  802419:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80241d:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <getchar>:
+getchar(void) {
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+  80242f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802433:	ba 01 00 00 00       	mov    $0x1,%edx
+  802438:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80243c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802441:	48 b8 e1 09 80 00 00 	movabs $0x8009e1,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+  80244d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 06                	js     802459 <getchar+0x2e>
+  802453:	74 08                	je     80245d <getchar+0x32>
+  802455:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802459:	89 d0                	mov    %edx,%eax
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80245d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802462:	eb f5                	jmp    802459 <getchar+0x2e>
+
+0000000000802464 <iscons>:
+iscons(int fdnum) {
+  802464:	55                   	push   %rbp
+  802465:	48 89 e5             	mov    %rsp,%rbp
+  802468:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80246c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802470:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	78 18                	js     802498 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802480:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802484:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80248b:	00 00 00 
+  80248e:	8b 00                	mov    (%rax),%eax
+  802490:	39 02                	cmp    %eax,(%rdx)
+  802492:	0f 94 c0             	sete   %al
+  802495:	0f b6 c0             	movzbl %al,%eax
+}
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+
+000000000080249a <opencons>:
+opencons(void) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024a2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024a6:	48 b8 9e 06 80 00 00 	movabs $0x80069e,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	78 49                	js     8024ff <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024b6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024c0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c9:	48 b8 a0 02 80 00 00 	movabs $0x8002a0,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	78 26                	js     8024ff <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024dd:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024e4:	00 00 
+  8024e6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024e8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024ec:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024f3:	48 b8 70 06 80 00 00 	movabs $0x800670,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+0000000000802501 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+  802505:	41 56                	push   %r14
+  802507:	41 55                	push   %r13
+  802509:	41 54                	push   %r12
+  80250b:	53                   	push   %rbx
+  80250c:	48 83 ec 50          	sub    $0x50,%rsp
+  802510:	49 89 fc             	mov    %rdi,%r12
+  802513:	41 89 f5             	mov    %esi,%r13d
+  802516:	48 89 d3             	mov    %rdx,%rbx
+  802519:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80251d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802521:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802525:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80252c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802530:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802534:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802538:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80253c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802543:	00 00 00 
+  802546:	4c 8b 30             	mov    (%rax),%r14
+  802549:	48 b8 e0 01 80 00 00 	movabs $0x8001e0,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	89 c6                	mov    %eax,%esi
+  802557:	45 89 e8             	mov    %r13d,%r8d
+  80255a:	4c 89 e1             	mov    %r12,%rcx
+  80255d:	4c 89 f2             	mov    %r14,%rdx
+  802560:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  802567:	00 00 00 
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	49 bc 51 26 80 00 00 	movabs $0x802651,%r12
+  802576:	00 00 00 
+  802579:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80257c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802580:	48 89 df             	mov    %rbx,%rdi
+  802583:	48 b8 ed 25 80 00 00 	movabs $0x8025ed,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80258f:	48 bf 4b 37 80 00 00 	movabs $0x80374b,%rdi
+  802596:	00 00 00 
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8025a1:	cc                   	int3
+  8025a2:	eb fd                	jmp    8025a1 <_panic+0xa0>
+
+00000000008025a4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8025a4:	55                   	push   %rbp
+  8025a5:	48 89 e5             	mov    %rsp,%rbp
+  8025a8:	53                   	push   %rbx
+  8025a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ad:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025b0:	8b 06                	mov    (%rsi),%eax
+  8025b2:	8d 50 01             	lea    0x1(%rax),%edx
+  8025b5:	89 16                	mov    %edx,(%rsi)
+  8025b7:	48 98                	cltq
+  8025b9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025be:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025c4:	74 0a                	je     8025d0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025c6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ce:	c9                   	leave
+  8025cf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025d0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025d4:	be ff 00 00 00       	mov    $0xff,%esi
+  8025d9:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025e5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025eb:	eb d9                	jmp    8025c6 <putch+0x22>
+
+00000000008025ed <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025ed:	55                   	push   %rbp
+  8025ee:	48 89 e5             	mov    %rsp,%rbp
+  8025f1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025f8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025fb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802602:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80260f:	48 89 f1             	mov    %rsi,%rcx
+  802612:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802619:	48 bf a4 25 80 00 00 	movabs $0x8025a4,%rdi
+  802620:	00 00 00 
+  802623:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80262f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802636:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80263d:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  802644:	00 00 00 
+  802647:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802649:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80264f:	c9                   	leave
+  802650:	c3                   	ret
+
+0000000000802651 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+  802655:	48 83 ec 50          	sub    $0x50,%rsp
+  802659:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80265d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802661:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802665:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802669:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80266d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802674:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802678:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80267c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802680:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802684:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802688:	48 b8 ed 25 80 00 00 	movabs $0x8025ed,%rax
+  80268f:	00 00 00 
+  802692:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802694:	c9                   	leave
+  802695:	c3                   	ret
+
+0000000000802696 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802696:	55                   	push   %rbp
+  802697:	48 89 e5             	mov    %rsp,%rbp
+  80269a:	41 57                	push   %r15
+  80269c:	41 56                	push   %r14
+  80269e:	41 55                	push   %r13
+  8026a0:	41 54                	push   %r12
+  8026a2:	53                   	push   %rbx
+  8026a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a7:	49 89 fc             	mov    %rdi,%r12
+  8026aa:	49 89 f5             	mov    %rsi,%r13
+  8026ad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026b1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026b4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026b7:	41 89 cf             	mov    %ecx,%r15d
+  8026ba:	4c 39 fa             	cmp    %r15,%rdx
+  8026bd:	73 5b                	jae    80271a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026bf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026c3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026c7:	85 db                	test   %ebx,%ebx
+  8026c9:	7e 0e                	jle    8026d9 <print_num+0x43>
+            putch(padc, put_arg);
+  8026cb:	4c 89 ee             	mov    %r13,%rsi
+  8026ce:	44 89 f7             	mov    %r14d,%edi
+  8026d1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026d4:	83 eb 01             	sub    $0x1,%ebx
+  8026d7:	75 f2                	jne    8026cb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026d9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026dd:	48 b9 34 38 80 00 00 	movabs $0x803834,%rcx
+  8026e4:	00 00 00 
+  8026e7:	48 b8 23 38 80 00 00 	movabs $0x803823,%rax
+  8026ee:	00 00 00 
+  8026f1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fe:	49 f7 f7             	div    %r15
+  802701:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802705:	4c 89 ee             	mov    %r13,%rsi
+  802708:	41 ff d4             	call   *%r12
+}
+  80270b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80270f:	5b                   	pop    %rbx
+  802710:	41 5c                	pop    %r12
+  802712:	41 5d                	pop    %r13
+  802714:	41 5e                	pop    %r14
+  802716:	41 5f                	pop    %r15
+  802718:	5d                   	pop    %rbp
+  802719:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80271a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80271e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802723:	49 f7 f7             	div    %r15
+  802726:	48 83 ec 08          	sub    $0x8,%rsp
+  80272a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80272e:	52                   	push   %rdx
+  80272f:	45 0f be c9          	movsbl %r9b,%r9d
+  802733:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802737:	48 89 c2             	mov    %rax,%rdx
+  80273a:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  802741:	00 00 00 
+  802744:	ff d0                	call   *%rax
+  802746:	48 83 c4 10          	add    $0x10,%rsp
+  80274a:	eb 8d                	jmp    8026d9 <print_num+0x43>
+
+000000000080274c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80274c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802750:	48 8b 06             	mov    (%rsi),%rax
+  802753:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802757:	73 0a                	jae    802763 <sprintputch+0x17>
+        *state->start++ = ch;
+  802759:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80275d:	48 89 16             	mov    %rdx,(%rsi)
+  802760:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802763:	c3                   	ret
+
+0000000000802764 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802764:	55                   	push   %rbp
+  802765:	48 89 e5             	mov    %rsp,%rbp
+  802768:	48 83 ec 50          	sub    $0x50,%rsp
+  80276c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802770:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802774:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802778:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80277f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802783:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802787:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80278b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80278f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802793:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+}
+  80279f:	c9                   	leave
+  8027a0:	c3                   	ret
+
+00000000008027a1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	41 57                	push   %r15
+  8027a7:	41 56                	push   %r14
+  8027a9:	41 55                	push   %r13
+  8027ab:	41 54                	push   %r12
+  8027ad:	53                   	push   %rbx
+  8027ae:	48 83 ec 38          	sub    $0x38,%rsp
+  8027b2:	49 89 fe             	mov    %rdi,%r14
+  8027b5:	49 89 f5             	mov    %rsi,%r13
+  8027b8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027bb:	48 8b 01             	mov    (%rcx),%rax
+  8027be:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027c2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ca:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027d2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027d6:	0f b6 3b             	movzbl (%rbx),%edi
+  8027d9:	40 80 ff 25          	cmp    $0x25,%dil
+  8027dd:	74 18                	je     8027f7 <vprintfmt+0x56>
+            if (!ch) return;
+  8027df:	40 84 ff             	test   %dil,%dil
+  8027e2:	0f 84 b1 06 00 00    	je     802e99 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027e8:	40 0f b6 ff          	movzbl %dil,%edi
+  8027ec:	4c 89 ee             	mov    %r13,%rsi
+  8027ef:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027f2:	4c 89 e3             	mov    %r12,%rbx
+  8027f5:	eb db                	jmp    8027d2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fc:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802800:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802805:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80280b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802812:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802816:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80281b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802820:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802823:	83 e8 23             	sub    $0x23,%eax
+  802826:	3c 57                	cmp    $0x57,%al
+  802828:	0f 87 51 06 00 00    	ja     802e7f <vprintfmt+0x6de>
+  80282e:	0f b6 c0             	movzbl %al,%eax
+  802831:	48 b9 c0 39 80 00 00 	movabs $0x8039c0,%rcx
+  802838:	00 00 00 
+  80283b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80283e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802841:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802845:	eb cf                	jmp    802816 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802847:	49 89 dc             	mov    %rbx,%r12
+  80284a:	be 01 00 00 00       	mov    $0x1,%esi
+  80284f:	eb c5                	jmp    802816 <vprintfmt+0x75>
+            padc = ch;
+  802851:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802855:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802858:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80285b:	eb b9                	jmp    802816 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80285d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802860:	83 f8 2f             	cmp    $0x2f,%eax
+  802863:	77 24                	ja     802889 <vprintfmt+0xe8>
+  802865:	89 c1                	mov    %eax,%ecx
+  802867:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80286b:	83 c0 08             	add    $0x8,%eax
+  80286e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802871:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802874:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802877:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80287b:	79 99                	jns    802816 <vprintfmt+0x75>
+                width = precision;
+  80287d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802881:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802887:	eb 8d                	jmp    802816 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802889:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80288d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802895:	eb da                	jmp    802871 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802897:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80289c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028a0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028a6:	3c 39                	cmp    $0x39,%al
+  8028a8:	77 1c                	ja     8028c6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8028aa:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8028ae:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028b2:	0f b6 c0             	movzbl %al,%eax
+  8028b5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028ba:	0f b6 03             	movzbl (%rbx),%eax
+  8028bd:	3c 39                	cmp    $0x39,%al
+  8028bf:	76 e9                	jbe    8028aa <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028c1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028c4:	eb b1                	jmp    802877 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028c6:	49 89 dc             	mov    %rbx,%r12
+  8028c9:	eb ac                	jmp    802877 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028cb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028ce:	85 c9                	test   %ecx,%ecx
+  8028d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d5:	0f 49 c1             	cmovns %ecx,%eax
+  8028d8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028db:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028de:	e9 33 ff ff ff       	jmp    802816 <vprintfmt+0x75>
+            lflag++;
+  8028e3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028e6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028e9:	e9 28 ff ff ff       	jmp    802816 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8028f4:	77 19                	ja     80290f <vprintfmt+0x16e>
+  8028f6:	89 c2                	mov    %eax,%edx
+  8028f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028fc:	83 c0 08             	add    $0x8,%eax
+  8028ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802902:	8b 3a                	mov    (%rdx),%edi
+  802904:	4c 89 ee             	mov    %r13,%rsi
+  802907:	41 ff d6             	call   *%r14
+            break;
+  80290a:	e9 c3 fe ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80290f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802913:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802917:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80291b:	eb e5                	jmp    802902 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80291d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802920:	83 f8 2f             	cmp    $0x2f,%eax
+  802923:	77 5a                	ja     80297f <vprintfmt+0x1de>
+  802925:	89 c2                	mov    %eax,%edx
+  802927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80292b:	83 c0 08             	add    $0x8,%eax
+  80292e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802931:	8b 02                	mov    (%rdx),%eax
+  802933:	89 c1                	mov    %eax,%ecx
+  802935:	f7 d9                	neg    %ecx
+  802937:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80293a:	83 f9 14             	cmp    $0x14,%ecx
+  80293d:	7f 4e                	jg     80298d <vprintfmt+0x1ec>
+  80293f:	48 63 c1             	movslq %ecx,%rax
+  802942:	48 ba 80 3c 80 00 00 	movabs $0x803c80,%rdx
+  802949:	00 00 00 
+  80294c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802950:	48 85 c0             	test   %rax,%rax
+  802953:	74 38                	je     80298d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802955:	48 89 c1             	mov    %rax,%rcx
+  802958:	48 ba b9 37 80 00 00 	movabs $0x8037b9,%rdx
+  80295f:	00 00 00 
+  802962:	4c 89 ee             	mov    %r13,%rsi
+  802965:	4c 89 f7             	mov    %r14,%rdi
+  802968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296d:	49 b8 64 27 80 00 00 	movabs $0x802764,%r8
+  802974:	00 00 00 
+  802977:	41 ff d0             	call   *%r8
+  80297a:	e9 53 fe ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80297f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80298b:	eb a4                	jmp    802931 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80298d:	48 ba 4c 38 80 00 00 	movabs $0x80384c,%rdx
+  802994:	00 00 00 
+  802997:	4c 89 ee             	mov    %r13,%rsi
+  80299a:	4c 89 f7             	mov    %r14,%rdi
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a2:	49 b8 64 27 80 00 00 	movabs $0x802764,%r8
+  8029a9:	00 00 00 
+  8029ac:	41 ff d0             	call   *%r8
+  8029af:	e9 1e fe ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8029ba:	77 6c                	ja     802a28 <vprintfmt+0x287>
+  8029bc:	89 c2                	mov    %eax,%edx
+  8029be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029c2:	83 c0 08             	add    $0x8,%eax
+  8029c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029c8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029cb:	48 85 d2             	test   %rdx,%rdx
+  8029ce:	48 b8 45 38 80 00 00 	movabs $0x803845,%rax
+  8029d5:	00 00 00 
+  8029d8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029dc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029e0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029e4:	7e 06                	jle    8029ec <vprintfmt+0x24b>
+  8029e6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029ea:	75 4a                	jne    802a36 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029ec:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029f0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029f4:	0f b6 00             	movzbl (%rax),%eax
+  8029f7:	84 c0                	test   %al,%al
+  8029f9:	0f 85 9a 00 00 00    	jne    802a99 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029ff:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a02:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	0f 8e c4 fd ff ff    	jle    8027d2 <vprintfmt+0x31>
+  802a0e:	4c 89 ee             	mov    %r13,%rsi
+  802a11:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a16:	41 ff d6             	call   *%r14
+  802a19:	41 83 ec 01          	sub    $0x1,%r12d
+  802a1d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a21:	75 eb                	jne    802a0e <vprintfmt+0x26d>
+  802a23:	e9 aa fd ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a34:	eb 92                	jmp    8029c8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a36:	49 63 f7             	movslq %r15d,%rsi
+  802a39:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a3d:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+  802a49:	48 89 c2             	mov    %rax,%rdx
+  802a4c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a4f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a51:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a54:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a57:	85 c0                	test   %eax,%eax
+  802a59:	7e 91                	jle    8029ec <vprintfmt+0x24b>
+  802a5b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a60:	4c 89 ee             	mov    %r13,%rsi
+  802a63:	44 89 e7             	mov    %r12d,%edi
+  802a66:	41 ff d6             	call   *%r14
+  802a69:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a6d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a70:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a73:	75 eb                	jne    802a60 <vprintfmt+0x2bf>
+  802a75:	e9 72 ff ff ff       	jmp    8029ec <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a7a:	0f b6 f8             	movzbl %al,%edi
+  802a7d:	4c 89 ee             	mov    %r13,%rsi
+  802a80:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a83:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a87:	49 83 c4 01          	add    $0x1,%r12
+  802a8b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a91:	84 c0                	test   %al,%al
+  802a93:	0f 84 66 ff ff ff    	je     8029ff <vprintfmt+0x25e>
+  802a99:	45 85 ff             	test   %r15d,%r15d
+  802a9c:	78 0a                	js     802aa8 <vprintfmt+0x307>
+  802a9e:	41 83 ef 01          	sub    $0x1,%r15d
+  802aa2:	0f 88 57 ff ff ff    	js     8029ff <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802aa8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802aac:	74 cc                	je     802a7a <vprintfmt+0x2d9>
+  802aae:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802ab1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ab6:	80 fa 5e             	cmp    $0x5e,%dl
+  802ab9:	77 c2                	ja     802a7d <vprintfmt+0x2dc>
+  802abb:	eb bd                	jmp    802a7a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802abd:	40 84 f6             	test   %sil,%sil
+  802ac0:	75 26                	jne    802ae8 <vprintfmt+0x347>
+    switch (lflag) {
+  802ac2:	85 d2                	test   %edx,%edx
+  802ac4:	74 59                	je     802b1f <vprintfmt+0x37e>
+  802ac6:	83 fa 01             	cmp    $0x1,%edx
+  802ac9:	74 7b                	je     802b46 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802acb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ace:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad1:	0f 87 96 00 00 00    	ja     802b6d <vprintfmt+0x3cc>
+  802ad7:	89 c2                	mov    %eax,%edx
+  802ad9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802add:	83 c0 08             	add    $0x8,%eax
+  802ae0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ae3:	4c 8b 22             	mov    (%rdx),%r12
+  802ae6:	eb 17                	jmp    802aff <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ae8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802aeb:	83 f8 2f             	cmp    $0x2f,%eax
+  802aee:	77 21                	ja     802b11 <vprintfmt+0x370>
+  802af0:	89 c2                	mov    %eax,%edx
+  802af2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802af6:	83 c0 08             	add    $0x8,%eax
+  802af9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802afc:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802aff:	4d 85 e4             	test   %r12,%r12
+  802b02:	78 7a                	js     802b7e <vprintfmt+0x3dd>
+            num = i;
+  802b04:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b07:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b0c:	e9 50 02 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b1d:	eb dd                	jmp    802afc <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b22:	83 f8 2f             	cmp    $0x2f,%eax
+  802b25:	77 11                	ja     802b38 <vprintfmt+0x397>
+  802b27:	89 c2                	mov    %eax,%edx
+  802b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b2d:	83 c0 08             	add    $0x8,%eax
+  802b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b33:	4c 63 22             	movslq (%rdx),%r12
+  802b36:	eb c7                	jmp    802aff <vprintfmt+0x35e>
+  802b38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b44:	eb ed                	jmp    802b33 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b49:	83 f8 2f             	cmp    $0x2f,%eax
+  802b4c:	77 11                	ja     802b5f <vprintfmt+0x3be>
+  802b4e:	89 c2                	mov    %eax,%edx
+  802b50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b54:	83 c0 08             	add    $0x8,%eax
+  802b57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b5a:	4c 8b 22             	mov    (%rdx),%r12
+  802b5d:	eb a0                	jmp    802aff <vprintfmt+0x35e>
+  802b5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b6b:	eb ed                	jmp    802b5a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b79:	e9 65 ff ff ff       	jmp    802ae3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b7e:	4c 89 ee             	mov    %r13,%rsi
+  802b81:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b86:	41 ff d6             	call   *%r14
+                i = -i;
+  802b89:	49 f7 dc             	neg    %r12
+  802b8c:	e9 73 ff ff ff       	jmp    802b04 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b91:	40 84 f6             	test   %sil,%sil
+  802b94:	75 32                	jne    802bc8 <vprintfmt+0x427>
+    switch (lflag) {
+  802b96:	85 d2                	test   %edx,%edx
+  802b98:	74 5d                	je     802bf7 <vprintfmt+0x456>
+  802b9a:	83 fa 01             	cmp    $0x1,%edx
+  802b9d:	0f 84 82 00 00 00    	je     802c25 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802ba3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ba6:	83 f8 2f             	cmp    $0x2f,%eax
+  802ba9:	0f 87 a5 00 00 00    	ja     802c54 <vprintfmt+0x4b3>
+  802baf:	89 c2                	mov    %eax,%edx
+  802bb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb5:	83 c0 08             	add    $0x8,%eax
+  802bb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bbb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bbe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bc3:	e9 99 01 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bcb:	83 f8 2f             	cmp    $0x2f,%eax
+  802bce:	77 19                	ja     802be9 <vprintfmt+0x448>
+  802bd0:	89 c2                	mov    %eax,%edx
+  802bd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bd6:	83 c0 08             	add    $0x8,%eax
+  802bd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bdc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bdf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802be4:	e9 78 01 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+  802be9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf5:	eb e5                	jmp    802bdc <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bfa:	83 f8 2f             	cmp    $0x2f,%eax
+  802bfd:	77 18                	ja     802c17 <vprintfmt+0x476>
+  802bff:	89 c2                	mov    %eax,%edx
+  802c01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c05:	83 c0 08             	add    $0x8,%eax
+  802c08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c0b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c12:	e9 4a 01 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+  802c17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c23:	eb e6                	jmp    802c0b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c28:	83 f8 2f             	cmp    $0x2f,%eax
+  802c2b:	77 19                	ja     802c46 <vprintfmt+0x4a5>
+  802c2d:	89 c2                	mov    %eax,%edx
+  802c2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c33:	83 c0 08             	add    $0x8,%eax
+  802c36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c39:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c41:	e9 1b 01 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+  802c46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c52:	eb e5                	jmp    802c39 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c60:	e9 56 ff ff ff       	jmp    802bbb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c65:	40 84 f6             	test   %sil,%sil
+  802c68:	75 2e                	jne    802c98 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c6a:	85 d2                	test   %edx,%edx
+  802c6c:	74 59                	je     802cc7 <vprintfmt+0x526>
+  802c6e:	83 fa 01             	cmp    $0x1,%edx
+  802c71:	74 7f                	je     802cf2 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c76:	83 f8 2f             	cmp    $0x2f,%eax
+  802c79:	0f 87 9f 00 00 00    	ja     802d1e <vprintfmt+0x57d>
+  802c7f:	89 c2                	mov    %eax,%edx
+  802c81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c85:	83 c0 08             	add    $0x8,%eax
+  802c88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c8e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c93:	e9 c9 00 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c9b:	83 f8 2f             	cmp    $0x2f,%eax
+  802c9e:	77 19                	ja     802cb9 <vprintfmt+0x518>
+  802ca0:	89 c2                	mov    %eax,%edx
+  802ca2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ca6:	83 c0 08             	add    $0x8,%eax
+  802ca9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802caf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802cb4:	e9 a8 00 00 00       	jmp    802d61 <vprintfmt+0x5c0>
+  802cb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc5:	eb e5                	jmp    802cac <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cca:	83 f8 2f             	cmp    $0x2f,%eax
+  802ccd:	77 15                	ja     802ce4 <vprintfmt+0x543>
+  802ccf:	89 c2                	mov    %eax,%edx
+  802cd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd5:	83 c0 08             	add    $0x8,%eax
+  802cd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cdb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cdd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802ce2:	eb 7d                	jmp    802d61 <vprintfmt+0x5c0>
+  802ce4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ce8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cf0:	eb e9                	jmp    802cdb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cf8:	77 16                	ja     802d10 <vprintfmt+0x56f>
+  802cfa:	89 c2                	mov    %eax,%edx
+  802cfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d00:	83 c0 08             	add    $0x8,%eax
+  802d03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d09:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d0e:	eb 51                	jmp    802d61 <vprintfmt+0x5c0>
+  802d10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d1c:	eb e8                	jmp    802d06 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d2a:	e9 5c ff ff ff       	jmp    802c8b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d2f:	4c 89 ee             	mov    %r13,%rsi
+  802d32:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d37:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d3a:	4c 89 ee             	mov    %r13,%rsi
+  802d3d:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d42:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d48:	83 f8 2f             	cmp    $0x2f,%eax
+  802d4b:	77 47                	ja     802d94 <vprintfmt+0x5f3>
+  802d4d:	89 c2                	mov    %eax,%edx
+  802d4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d53:	83 c0 08             	add    $0x8,%eax
+  802d56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d61:	48 83 ec 08          	sub    $0x8,%rsp
+  802d65:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d69:	0f 94 c0             	sete   %al
+  802d6c:	0f b6 c0             	movzbl %al,%eax
+  802d6f:	50                   	push   %rax
+  802d70:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d75:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d79:	4c 89 ee             	mov    %r13,%rsi
+  802d7c:	4c 89 f7             	mov    %r14,%rdi
+  802d7f:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+            break;
+  802d8b:	48 83 c4 10          	add    $0x10,%rsp
+  802d8f:	e9 3e fa ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802da0:	eb b7                	jmp    802d59 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802da2:	40 84 f6             	test   %sil,%sil
+  802da5:	75 2b                	jne    802dd2 <vprintfmt+0x631>
+    switch (lflag) {
+  802da7:	85 d2                	test   %edx,%edx
+  802da9:	74 56                	je     802e01 <vprintfmt+0x660>
+  802dab:	83 fa 01             	cmp    $0x1,%edx
+  802dae:	74 7f                	je     802e2f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802db0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802db3:	83 f8 2f             	cmp    $0x2f,%eax
+  802db6:	0f 87 a2 00 00 00    	ja     802e5e <vprintfmt+0x6bd>
+  802dbc:	89 c2                	mov    %eax,%edx
+  802dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dc2:	83 c0 08             	add    $0x8,%eax
+  802dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dc8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dcb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dd0:	eb 8f                	jmp    802d61 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dd5:	83 f8 2f             	cmp    $0x2f,%eax
+  802dd8:	77 19                	ja     802df3 <vprintfmt+0x652>
+  802dda:	89 c2                	mov    %eax,%edx
+  802ddc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802de0:	83 c0 08             	add    $0x8,%eax
+  802de3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802de6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802de9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dee:	e9 6e ff ff ff       	jmp    802d61 <vprintfmt+0x5c0>
+  802df3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802df7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dff:	eb e5                	jmp    802de6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802e01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e04:	83 f8 2f             	cmp    $0x2f,%eax
+  802e07:	77 18                	ja     802e21 <vprintfmt+0x680>
+  802e09:	89 c2                	mov    %eax,%edx
+  802e0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e0f:	83 c0 08             	add    $0x8,%eax
+  802e12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e15:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e17:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e1c:	e9 40 ff ff ff       	jmp    802d61 <vprintfmt+0x5c0>
+  802e21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e2d:	eb e6                	jmp    802e15 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e32:	83 f8 2f             	cmp    $0x2f,%eax
+  802e35:	77 19                	ja     802e50 <vprintfmt+0x6af>
+  802e37:	89 c2                	mov    %eax,%edx
+  802e39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e3d:	83 c0 08             	add    $0x8,%eax
+  802e40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e43:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e46:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e4b:	e9 11 ff ff ff       	jmp    802d61 <vprintfmt+0x5c0>
+  802e50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e5c:	eb e5                	jmp    802e43 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6a:	e9 59 ff ff ff       	jmp    802dc8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e6f:	4c 89 ee             	mov    %r13,%rsi
+  802e72:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e77:	41 ff d6             	call   *%r14
+            break;
+  802e7a:	e9 53 f9 ff ff       	jmp    8027d2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e7f:	4c 89 ee             	mov    %r13,%rsi
+  802e82:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e87:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e8a:	48 83 eb 01          	sub    $0x1,%rbx
+  802e8e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e92:	75 f6                	jne    802e8a <vprintfmt+0x6e9>
+  802e94:	e9 39 f9 ff ff       	jmp    8027d2 <vprintfmt+0x31>
+}
+  802e99:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e9d:	5b                   	pop    %rbx
+  802e9e:	41 5c                	pop    %r12
+  802ea0:	41 5d                	pop    %r13
+  802ea2:	41 5e                	pop    %r14
+  802ea4:	41 5f                	pop    %r15
+  802ea6:	5d                   	pop    %rbp
+  802ea7:	c3                   	ret
+
+0000000000802ea8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802ea8:	55                   	push   %rbp
+  802ea9:	48 89 e5             	mov    %rsp,%rbp
+  802eac:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802eb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eb4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802eb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ebd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ec4:	48 85 ff             	test   %rdi,%rdi
+  802ec7:	74 2b                	je     802ef4 <vsnprintf+0x4c>
+  802ec9:	48 85 f6             	test   %rsi,%rsi
+  802ecc:	74 26                	je     802ef4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ece:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ed2:	48 bf 4c 27 80 00 00 	movabs $0x80274c,%rdi
+  802ed9:	00 00 00 
+  802edc:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ee8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eec:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802eef:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef9:	eb f7                	jmp    802ef2 <vsnprintf+0x4a>
+
+0000000000802efb <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802efb:	55                   	push   %rbp
+  802efc:	48 89 e5             	mov    %rsp,%rbp
+  802eff:	48 83 ec 50          	sub    $0x50,%rsp
+  802f03:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f07:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f0b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f0f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f16:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f1e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f26:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f2a:	48 b8 a8 2e 80 00 00 	movabs $0x802ea8,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f36:	c9                   	leave
+  802f37:	c3                   	ret
+
+0000000000802f38 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f38:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f3b:	74 10                	je     802f4d <strlen+0x15>
+    size_t n = 0;
+  802f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f42:	48 83 c0 01          	add    $0x1,%rax
+  802f46:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f4a:	75 f6                	jne    802f42 <strlen+0xa>
+  802f4c:	c3                   	ret
+    size_t n = 0;
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f52:	c3                   	ret
+
+0000000000802f53 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f53:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f56:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f5b:	48 85 f6             	test   %rsi,%rsi
+  802f5e:	74 11                	je     802f71 <strnlen+0x1e>
+  802f60:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f64:	74 0c                	je     802f72 <strnlen+0x1f>
+  802f66:	48 83 c2 01          	add    $0x1,%rdx
+  802f6a:	48 39 d0             	cmp    %rdx,%rax
+  802f6d:	75 f1                	jne    802f60 <strnlen+0xd>
+  802f6f:	eb 04                	jmp    802f75 <strnlen+0x22>
+  802f71:	c3                   	ret
+  802f72:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f75:	c3                   	ret
+
+0000000000802f76 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f76:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f82:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f85:	48 83 c2 01          	add    $0x1,%rdx
+  802f89:	84 c9                	test   %cl,%cl
+  802f8b:	75 f1                	jne    802f7e <strcpy+0x8>
+        ;
+    return res;
+}
+  802f8d:	c3                   	ret
+
+0000000000802f8e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f8e:	55                   	push   %rbp
+  802f8f:	48 89 e5             	mov    %rsp,%rbp
+  802f92:	41 54                	push   %r12
+  802f94:	53                   	push   %rbx
+  802f95:	48 89 fb             	mov    %rdi,%rbx
+  802f98:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f9b:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802fa7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802fab:	4c 89 e6             	mov    %r12,%rsi
+  802fae:	48 b8 76 2f 80 00 00 	movabs $0x802f76,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+    return dst;
+}
+  802fba:	48 89 d8             	mov    %rbx,%rax
+  802fbd:	5b                   	pop    %rbx
+  802fbe:	41 5c                	pop    %r12
+  802fc0:	5d                   	pop    %rbp
+  802fc1:	c3                   	ret
+
+0000000000802fc2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fc2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fc5:	48 85 d2             	test   %rdx,%rdx
+  802fc8:	74 1f                	je     802fe9 <strncpy+0x27>
+  802fca:	48 01 fa             	add    %rdi,%rdx
+  802fcd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fd0:	48 83 c1 01          	add    $0x1,%rcx
+  802fd4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fd8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fdc:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fe0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fe4:	48 39 ca             	cmp    %rcx,%rdx
+  802fe7:	75 e7                	jne    802fd0 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fe9:	c3                   	ret
+
+0000000000802fea <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fea:	48 89 f8             	mov    %rdi,%rax
+  802fed:	48 85 d2             	test   %rdx,%rdx
+  802ff0:	74 24                	je     803016 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802ff2:	48 83 ea 01          	sub    $0x1,%rdx
+  802ff6:	74 1b                	je     803013 <strlcpy+0x29>
+  802ff8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802ffc:	0f b6 16             	movzbl (%rsi),%edx
+  802fff:	84 d2                	test   %dl,%dl
+  803001:	74 10                	je     803013 <strlcpy+0x29>
+            *dst++ = *src++;
+  803003:	48 83 c6 01          	add    $0x1,%rsi
+  803007:	48 83 c0 01          	add    $0x1,%rax
+  80300b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80300e:	48 39 c8             	cmp    %rcx,%rax
+  803011:	75 e9                	jne    802ffc <strlcpy+0x12>
+        *dst = '\0';
+  803013:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803016:	48 29 f8             	sub    %rdi,%rax
+}
+  803019:	c3                   	ret
+
+000000000080301a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80301a:	0f b6 07             	movzbl (%rdi),%eax
+  80301d:	84 c0                	test   %al,%al
+  80301f:	74 13                	je     803034 <strcmp+0x1a>
+  803021:	38 06                	cmp    %al,(%rsi)
+  803023:	75 0f                	jne    803034 <strcmp+0x1a>
+  803025:	48 83 c7 01          	add    $0x1,%rdi
+  803029:	48 83 c6 01          	add    $0x1,%rsi
+  80302d:	0f b6 07             	movzbl (%rdi),%eax
+  803030:	84 c0                	test   %al,%al
+  803032:	75 ed                	jne    803021 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803034:	0f b6 c0             	movzbl %al,%eax
+  803037:	0f b6 16             	movzbl (%rsi),%edx
+  80303a:	29 d0                	sub    %edx,%eax
+}
+  80303c:	c3                   	ret
+
+000000000080303d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80303d:	48 85 d2             	test   %rdx,%rdx
+  803040:	74 1f                	je     803061 <strncmp+0x24>
+  803042:	0f b6 07             	movzbl (%rdi),%eax
+  803045:	84 c0                	test   %al,%al
+  803047:	74 1e                	je     803067 <strncmp+0x2a>
+  803049:	3a 06                	cmp    (%rsi),%al
+  80304b:	75 1a                	jne    803067 <strncmp+0x2a>
+  80304d:	48 83 c7 01          	add    $0x1,%rdi
+  803051:	48 83 c6 01          	add    $0x1,%rsi
+  803055:	48 83 ea 01          	sub    $0x1,%rdx
+  803059:	75 e7                	jne    803042 <strncmp+0x5>
+
+    if (!n) return 0;
+  80305b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803060:	c3                   	ret
+  803061:	b8 00 00 00 00       	mov    $0x0,%eax
+  803066:	c3                   	ret
+  803067:	48 85 d2             	test   %rdx,%rdx
+  80306a:	74 09                	je     803075 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80306c:	0f b6 07             	movzbl (%rdi),%eax
+  80306f:	0f b6 16             	movzbl (%rsi),%edx
+  803072:	29 d0                	sub    %edx,%eax
+  803074:	c3                   	ret
+    if (!n) return 0;
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307a:	c3                   	ret
+
+000000000080307b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80307b:	0f b6 17             	movzbl (%rdi),%edx
+  80307e:	84 d2                	test   %dl,%dl
+  803080:	74 18                	je     80309a <strchr+0x1f>
+        if (*str == c) {
+  803082:	0f be d2             	movsbl %dl,%edx
+  803085:	39 f2                	cmp    %esi,%edx
+  803087:	74 17                	je     8030a0 <strchr+0x25>
+    for (; *str; str++) {
+  803089:	48 83 c7 01          	add    $0x1,%rdi
+  80308d:	0f b6 17             	movzbl (%rdi),%edx
+  803090:	84 d2                	test   %dl,%dl
+  803092:	75 ee                	jne    803082 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803094:	b8 00 00 00 00       	mov    $0x0,%eax
+  803099:	c3                   	ret
+  80309a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309f:	c3                   	ret
+  8030a0:	48 89 f8             	mov    %rdi,%rax
+}
+  8030a3:	c3                   	ret
+
+00000000008030a4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8030a4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030a7:	0f b6 17             	movzbl (%rdi),%edx
+  8030aa:	84 d2                	test   %dl,%dl
+  8030ac:	74 13                	je     8030c1 <strfind+0x1d>
+  8030ae:	0f be d2             	movsbl %dl,%edx
+  8030b1:	39 f2                	cmp    %esi,%edx
+  8030b3:	74 0b                	je     8030c0 <strfind+0x1c>
+  8030b5:	48 83 c0 01          	add    $0x1,%rax
+  8030b9:	0f b6 10             	movzbl (%rax),%edx
+  8030bc:	84 d2                	test   %dl,%dl
+  8030be:	75 ee                	jne    8030ae <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030c0:	c3                   	ret
+  8030c1:	c3                   	ret
+
+00000000008030c2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030c2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030c5:	48 89 f8             	mov    %rdi,%rax
+  8030c8:	48 f7 d8             	neg    %rax
+  8030cb:	83 e0 07             	and    $0x7,%eax
+  8030ce:	49 89 d1             	mov    %rdx,%r9
+  8030d1:	49 29 c1             	sub    %rax,%r9
+  8030d4:	78 36                	js     80310c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030d6:	40 0f b6 c6          	movzbl %sil,%eax
+  8030da:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030e1:	01 01 01 
+  8030e4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030e8:	40 f6 c7 07          	test   $0x7,%dil
+  8030ec:	75 38                	jne    803126 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030ee:	4c 89 c9             	mov    %r9,%rcx
+  8030f1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030f5:	74 0c                	je     803103 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030f7:	fc                   	cld
+  8030f8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030fb:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030ff:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803103:	4d 85 c9             	test   %r9,%r9
+  803106:	75 45                	jne    80314d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803108:	4c 89 c0             	mov    %r8,%rax
+  80310b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80310c:	48 85 d2             	test   %rdx,%rdx
+  80310f:	74 f7                	je     803108 <memset+0x46>
+  803111:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803114:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803117:	48 83 c0 01          	add    $0x1,%rax
+  80311b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80311f:	48 39 c2             	cmp    %rax,%rdx
+  803122:	75 f3                	jne    803117 <memset+0x55>
+  803124:	eb e2                	jmp    803108 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803126:	40 f6 c7 01          	test   $0x1,%dil
+  80312a:	74 06                	je     803132 <memset+0x70>
+  80312c:	88 07                	mov    %al,(%rdi)
+  80312e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803132:	40 f6 c7 02          	test   $0x2,%dil
+  803136:	74 07                	je     80313f <memset+0x7d>
+  803138:	66 89 07             	mov    %ax,(%rdi)
+  80313b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80313f:	40 f6 c7 04          	test   $0x4,%dil
+  803143:	74 a9                	je     8030ee <memset+0x2c>
+  803145:	89 07                	mov    %eax,(%rdi)
+  803147:	48 83 c7 04          	add    $0x4,%rdi
+  80314b:	eb a1                	jmp    8030ee <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80314d:	41 f6 c1 04          	test   $0x4,%r9b
+  803151:	74 06                	je     803159 <memset+0x97>
+  803153:	89 07                	mov    %eax,(%rdi)
+  803155:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803159:	41 f6 c1 02          	test   $0x2,%r9b
+  80315d:	74 07                	je     803166 <memset+0xa4>
+  80315f:	66 89 07             	mov    %ax,(%rdi)
+  803162:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803166:	41 f6 c1 01          	test   $0x1,%r9b
+  80316a:	74 9c                	je     803108 <memset+0x46>
+  80316c:	88 07                	mov    %al,(%rdi)
+  80316e:	eb 98                	jmp    803108 <memset+0x46>
+
+0000000000803170 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803170:	48 89 f8             	mov    %rdi,%rax
+  803173:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803176:	48 39 fe             	cmp    %rdi,%rsi
+  803179:	73 3b                	jae    8031b6 <memmove+0x46>
+  80317b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80317f:	48 39 d7             	cmp    %rdx,%rdi
+  803182:	73 32                	jae    8031b6 <memmove+0x46>
+        s += n;
+        d += n;
+  803184:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803188:	48 89 d6             	mov    %rdx,%rsi
+  80318b:	48 09 fe             	or     %rdi,%rsi
+  80318e:	48 09 ce             	or     %rcx,%rsi
+  803191:	40 f6 c6 07          	test   $0x7,%sil
+  803195:	75 12                	jne    8031a9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803197:	48 83 ef 08          	sub    $0x8,%rdi
+  80319b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80319f:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031a3:	fd                   	std
+  8031a4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031a7:	fc                   	cld
+  8031a8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031a9:	48 83 ef 01          	sub    $0x1,%rdi
+  8031ad:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031b1:	fd                   	std
+  8031b2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031b4:	eb f1                	jmp    8031a7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031b6:	48 89 f2             	mov    %rsi,%rdx
+  8031b9:	48 09 c2             	or     %rax,%rdx
+  8031bc:	48 09 ca             	or     %rcx,%rdx
+  8031bf:	f6 c2 07             	test   $0x7,%dl
+  8031c2:	75 0c                	jne    8031d0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031c4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031c8:	48 89 c7             	mov    %rax,%rdi
+  8031cb:	fc                   	cld
+  8031cc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031cf:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031d0:	48 89 c7             	mov    %rax,%rdi
+  8031d3:	fc                   	cld
+  8031d4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031d6:	c3                   	ret
+
+00000000008031d7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031d7:	55                   	push   %rbp
+  8031d8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031db:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+}
+  8031e7:	5d                   	pop    %rbp
+  8031e8:	c3                   	ret
+
+00000000008031e9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031e9:	55                   	push   %rbp
+  8031ea:	48 89 e5             	mov    %rsp,%rbp
+  8031ed:	41 57                	push   %r15
+  8031ef:	41 56                	push   %r14
+  8031f1:	41 55                	push   %r13
+  8031f3:	41 54                	push   %r12
+  8031f5:	53                   	push   %rbx
+  8031f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8031fa:	49 89 fe             	mov    %rdi,%r14
+  8031fd:	49 89 f7             	mov    %rsi,%r15
+  803200:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803203:	48 89 f7             	mov    %rsi,%rdi
+  803206:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+  803212:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803215:	48 89 de             	mov    %rbx,%rsi
+  803218:	4c 89 f7             	mov    %r14,%rdi
+  80321b:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  803222:	00 00 00 
+  803225:	ff d0                	call   *%rax
+  803227:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80322a:	48 39 c3             	cmp    %rax,%rbx
+  80322d:	74 36                	je     803265 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80322f:	48 89 d8             	mov    %rbx,%rax
+  803232:	4c 29 e8             	sub    %r13,%rax
+  803235:	49 39 c4             	cmp    %rax,%r12
+  803238:	73 31                	jae    80326b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80323a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80323f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803243:	4c 89 fe             	mov    %r15,%rsi
+  803246:	48 b8 d7 31 80 00 00 	movabs $0x8031d7,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803252:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803256:	48 83 c4 08          	add    $0x8,%rsp
+  80325a:	5b                   	pop    %rbx
+  80325b:	41 5c                	pop    %r12
+  80325d:	41 5d                	pop    %r13
+  80325f:	41 5e                	pop    %r14
+  803261:	41 5f                	pop    %r15
+  803263:	5d                   	pop    %rbp
+  803264:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803265:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803269:	eb eb                	jmp    803256 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80326b:	48 83 eb 01          	sub    $0x1,%rbx
+  80326f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803273:	48 89 da             	mov    %rbx,%rdx
+  803276:	4c 89 fe             	mov    %r15,%rsi
+  803279:	48 b8 d7 31 80 00 00 	movabs $0x8031d7,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803285:	49 01 de             	add    %rbx,%r14
+  803288:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80328d:	eb c3                	jmp    803252 <strlcat+0x69>
+
+000000000080328f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80328f:	48 85 d2             	test   %rdx,%rdx
+  803292:	74 2d                	je     8032c1 <memcmp+0x32>
+  803294:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803299:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80329d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8032a2:	44 38 c1             	cmp    %r8b,%cl
+  8032a5:	75 0f                	jne    8032b6 <memcmp+0x27>
+    while (n-- > 0) {
+  8032a7:	48 83 c0 01          	add    $0x1,%rax
+  8032ab:	48 39 c2             	cmp    %rax,%rdx
+  8032ae:	75 e9                	jne    803299 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032b6:	0f b6 c1             	movzbl %cl,%eax
+  8032b9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032bd:	44 29 c0             	sub    %r8d,%eax
+  8032c0:	c3                   	ret
+    return 0;
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c6:	c3                   	ret
+
+00000000008032c7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032c7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032cb:	48 39 c7             	cmp    %rax,%rdi
+  8032ce:	73 0f                	jae    8032df <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032d0:	40 38 37             	cmp    %sil,(%rdi)
+  8032d3:	74 0e                	je     8032e3 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032d5:	48 83 c7 01          	add    $0x1,%rdi
+  8032d9:	48 39 f8             	cmp    %rdi,%rax
+  8032dc:	75 f2                	jne    8032d0 <memfind+0x9>
+  8032de:	c3                   	ret
+  8032df:	48 89 f8             	mov    %rdi,%rax
+  8032e2:	c3                   	ret
+  8032e3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032e6:	c3                   	ret
+
+00000000008032e7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032e7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032ea:	0f b6 37             	movzbl (%rdi),%esi
+  8032ed:	40 80 fe 20          	cmp    $0x20,%sil
+  8032f1:	74 06                	je     8032f9 <strtol+0x12>
+  8032f3:	40 80 fe 09          	cmp    $0x9,%sil
+  8032f7:	75 13                	jne    80330c <strtol+0x25>
+  8032f9:	48 83 c7 01          	add    $0x1,%rdi
+  8032fd:	0f b6 37             	movzbl (%rdi),%esi
+  803300:	40 80 fe 20          	cmp    $0x20,%sil
+  803304:	74 f3                	je     8032f9 <strtol+0x12>
+  803306:	40 80 fe 09          	cmp    $0x9,%sil
+  80330a:	74 ed                	je     8032f9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80330c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80330f:	83 e0 fd             	and    $0xfffffffd,%eax
+  803312:	3c 01                	cmp    $0x1,%al
+  803314:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803318:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80331e:	75 0f                	jne    80332f <strtol+0x48>
+  803320:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803323:	74 14                	je     803339 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803325:	85 d2                	test   %edx,%edx
+  803327:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80332c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80332f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803334:	4c 63 ca             	movslq %edx,%r9
+  803337:	eb 36                	jmp    80336f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803339:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80333d:	74 0f                	je     80334e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80333f:	85 d2                	test   %edx,%edx
+  803341:	75 ec                	jne    80332f <strtol+0x48>
+        s++;
+  803343:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803347:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80334c:	eb e1                	jmp    80332f <strtol+0x48>
+        s += 2;
+  80334e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803352:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803357:	eb d6                	jmp    80332f <strtol+0x48>
+            dig -= '0';
+  803359:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80335c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803360:	41 39 d0             	cmp    %edx,%r8d
+  803363:	7d 21                	jge    803386 <strtol+0x9f>
+        val = val * base + dig;
+  803365:	49 0f af c1          	imul   %r9,%rax
+  803369:	0f b6 c9             	movzbl %cl,%ecx
+  80336c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80336f:	48 83 c7 01          	add    $0x1,%rdi
+  803373:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803377:	80 f9 39             	cmp    $0x39,%cl
+  80337a:	76 dd                	jbe    803359 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80337c:	80 f9 7b             	cmp    $0x7b,%cl
+  80337f:	77 05                	ja     803386 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803381:	83 e9 57             	sub    $0x57,%ecx
+  803384:	eb d6                	jmp    80335c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803386:	4d 85 d2             	test   %r10,%r10
+  803389:	74 03                	je     80338e <strtol+0xa7>
+  80338b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80338e:	48 89 c2             	mov    %rax,%rdx
+  803391:	48 f7 da             	neg    %rdx
+  803394:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803398:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80339c:	c3                   	ret
+
+000000000080339d <strrev>:
+
+void
+strrev(char *str)
+{
+  80339d:	55                   	push   %rbp
+  80339e:	48 89 e5             	mov    %rsp,%rbp
+  8033a1:	53                   	push   %rbx
+  8033a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a6:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033a9:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8033b0:	00 00 00 
+  8033b3:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b5:	83 e8 01             	sub    $0x1,%eax
+  8033b8:	85 c0                	test   %eax,%eax
+  8033ba:	7e 22                	jle    8033de <strrev+0x41>
+  8033bc:	48 98                	cltq
+  8033be:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033c3:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033c7:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033cb:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033cf:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033d2:	48 83 c2 01          	add    $0x1,%rdx
+  8033d6:	48 83 e8 01          	sub    $0x1,%rax
+  8033da:	39 c2                	cmp    %eax,%edx
+  8033dc:	7c e5                	jl     8033c3 <strrev+0x26>
+	}
+}
+  8033de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033e2:	c9                   	leave
+  8033e3:	c3                   	ret
+
+00000000008033e4 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033e4:	85 d2                	test   %edx,%edx
+  8033e6:	0f 84 80 00 00 00    	je     80346c <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033ec:	55                   	push   %rbp
+  8033ed:	48 89 e5             	mov    %rsp,%rbp
+  8033f0:	53                   	push   %rbx
+  8033f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f5:	49 89 f2             	mov    %rsi,%r10
+  8033f8:	41 89 d3             	mov    %edx,%r11d
+  8033fb:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033fe:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  803403:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  803406:	eb 20                	jmp    803428 <itoa+0x44>
+			str[i++] = '0' + digit;
+  803408:	41 89 f1             	mov    %esi,%r9d
+  80340b:	83 c2 30             	add    $0x30,%edx
+  80340e:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  803411:	89 f8                	mov    %edi,%eax
+  803413:	99                   	cltd
+  803414:	f7 f9                	idiv   %ecx
+  803416:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803418:	85 c0                	test   %eax,%eax
+  80341a:	74 2e                	je     80344a <itoa+0x66>
+  80341c:	83 c6 01             	add    $0x1,%esi
+  80341f:	49 83 c0 01          	add    $0x1,%r8
+  803423:	44 39 cb             	cmp    %r9d,%ebx
+  803426:	7e 15                	jle    80343d <itoa+0x59>
+		digit = sum % base;
+  803428:	89 f8                	mov    %edi,%eax
+  80342a:	99                   	cltd
+  80342b:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80342d:	83 fa 09             	cmp    $0x9,%edx
+  803430:	7e d6                	jle    803408 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803432:	41 89 f1             	mov    %esi,%r9d
+  803435:	83 c2 37             	add    $0x37,%edx
+  803438:	41 88 10             	mov    %dl,(%r8)
+  80343b:	eb d4                	jmp    803411 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80343d:	41 83 eb 01          	sub    $0x1,%r11d
+  803441:	45 39 cb             	cmp    %r9d,%r11d
+  803444:	75 04                	jne    80344a <itoa+0x66>
+  803446:	85 c0                	test   %eax,%eax
+  803448:	75 28                	jne    803472 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80344a:	4d 63 c9             	movslq %r9d,%r9
+  80344d:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803452:	4c 89 d7             	mov    %r10,%rdi
+  803455:	48 b8 9d 33 80 00 00 	movabs $0x80339d,%rax
+  80345c:	00 00 00 
+  80345f:	ff d0                	call   *%rax
+	return 0;
+  803461:	b8 00 00 00 00       	mov    $0x0,%eax
+  803466:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80346a:	c9                   	leave
+  80346b:	c3                   	ret
+		return -1;
+  80346c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803471:	c3                   	ret
+		return -1;
+  803472:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803477:	eb ed                	jmp    803466 <itoa+0x82>
+
+0000000000803479 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803479:	55                   	push   %rbp
+  80347a:	48 89 e5             	mov    %rsp,%rbp
+  80347d:	41 55                	push   %r13
+  80347f:	41 54                	push   %r12
+  803481:	53                   	push   %rbx
+  803482:	48 83 ec 08          	sub    $0x8,%rsp
+  803486:	49 89 fc             	mov    %rdi,%r12
+  803489:	48 89 f7             	mov    %rsi,%rdi
+  80348c:	48 89 d3             	mov    %rdx,%rbx
+  80348f:	49 89 cd             	mov    %rcx,%r13
+  803492:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803495:	48 85 f6             	test   %rsi,%rsi
+  803498:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80349f:	00 00 00 
+  8034a2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034ab:	48 85 db             	test   %rbx,%rbx
+  8034ae:	74 03                	je     8034b3 <ipc_recv_timed+0x3a>
+  8034b0:	48 8b 33             	mov    (%rbx),%rsi
+  8034b3:	48 b8 3a 05 80 00 00 	movabs $0x80053a,%rax
+  8034ba:	00 00 00 
+  8034bd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034bf:	85 c0                	test   %eax,%eax
+  8034c1:	78 75                	js     803538 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034c3:	4d 85 e4             	test   %r12,%r12
+  8034c6:	74 14                	je     8034dc <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034c8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034cf:	00 00 00 
+  8034d2:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034d8:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034dc:	4d 85 ed             	test   %r13,%r13
+  8034df:	74 14                	je     8034f5 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034e1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e8:	00 00 00 
+  8034eb:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034f1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034f5:	48 85 db             	test   %rbx,%rbx
+  8034f8:	74 23                	je     80351d <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034fa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803501:	00 00 00 
+  803504:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80350a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80350f:	85 c9                	test   %ecx,%ecx
+  803511:	74 07                	je     80351a <ipc_recv_timed+0xa1>
+  803513:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80351a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80351d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803524:	00 00 00 
+  803527:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80352d:	48 83 c4 08          	add    $0x8,%rsp
+  803531:	5b                   	pop    %rbx
+  803532:	41 5c                	pop    %r12
+  803534:	41 5d                	pop    %r13
+  803536:	5d                   	pop    %rbp
+  803537:	c3                   	ret
+        if (from_env_store != NULL) {
+  803538:	4d 85 e4             	test   %r12,%r12
+  80353b:	74 08                	je     803545 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80353d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803544:	00 
+        if (perm_store != NULL) {
+  803545:	4d 85 ed             	test   %r13,%r13
+  803548:	74 08                	je     803552 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80354a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803551:	00 
+        if (size != NULL) {
+  803552:	48 85 db             	test   %rbx,%rbx
+  803555:	74 d6                	je     80352d <ipc_recv_timed+0xb4>
+            *size = 0;
+  803557:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80355e:	eb cd                	jmp    80352d <ipc_recv_timed+0xb4>
+
+0000000000803560 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803560:	55                   	push   %rbp
+  803561:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803564:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80356a:	48 b8 79 34 80 00 00 	movabs $0x803479,%rax
+  803571:	00 00 00 
+  803574:	ff d0                	call   *%rax
+}
+  803576:	5d                   	pop    %rbp
+  803577:	c3                   	ret
+
+0000000000803578 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803578:	55                   	push   %rbp
+  803579:	48 89 e5             	mov    %rsp,%rbp
+  80357c:	41 57                	push   %r15
+  80357e:	41 56                	push   %r14
+  803580:	41 55                	push   %r13
+  803582:	41 54                	push   %r12
+  803584:	53                   	push   %rbx
+  803585:	48 83 ec 18          	sub    $0x18,%rsp
+  803589:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80358c:	48 89 d3             	mov    %rdx,%rbx
+  80358f:	49 89 cc             	mov    %rcx,%r12
+  803592:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803595:	48 85 d2             	test   %rdx,%rdx
+  803598:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80359f:	00 00 00 
+  8035a2:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035a6:	89 f0                	mov    %esi,%eax
+  8035a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035ac:	48 89 da             	mov    %rbx,%rdx
+  8035af:	48 89 c6             	mov    %rax,%rsi
+  8035b2:	48 b8 0e 05 80 00 00 	movabs $0x80050e,%rax
+  8035b9:	00 00 00 
+  8035bc:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035be:	85 c0                	test   %eax,%eax
+  8035c0:	79 65                	jns    803627 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035c2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035c5:	75 33                	jne    8035fa <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035c7:	49 bf 11 02 80 00 00 	movabs $0x800211,%r15
+  8035ce:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d1:	49 be 0e 05 80 00 00 	movabs $0x80050e,%r14
+  8035d8:	00 00 00 
+        sys_yield();
+  8035db:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035de:	45 89 e8             	mov    %r13d,%r8d
+  8035e1:	4c 89 e1             	mov    %r12,%rcx
+  8035e4:	48 89 da             	mov    %rbx,%rdx
+  8035e7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035eb:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035ee:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035f1:	85 c0                	test   %eax,%eax
+  8035f3:	79 32                	jns    803627 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035f5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035f8:	74 e1                	je     8035db <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035fa:	89 c1                	mov    %eax,%ecx
+  8035fc:	48 ba 47 3d 80 00 00 	movabs $0x803d47,%rdx
+  803603:	00 00 00 
+  803606:	be 52 00 00 00       	mov    $0x52,%esi
+  80360b:	48 bf 5b 3d 80 00 00 	movabs $0x803d5b,%rdi
+  803612:	00 00 00 
+  803615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361a:	49 b8 01 25 80 00 00 	movabs $0x802501,%r8
+  803621:	00 00 00 
+  803624:	41 ff d0             	call   *%r8
+    }
+}
+  803627:	48 83 c4 18          	add    $0x18,%rsp
+  80362b:	5b                   	pop    %rbx
+  80362c:	41 5c                	pop    %r12
+  80362e:	41 5d                	pop    %r13
+  803630:	41 5e                	pop    %r14
+  803632:	41 5f                	pop    %r15
+  803634:	5d                   	pop    %rbp
+  803635:	c3                   	ret
+
+0000000000803636 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803636:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80363b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803642:	00 00 00 
+  803645:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803649:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80364d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803651:	48 01 ca             	add    %rcx,%rdx
+  803654:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80365a:	39 fa                	cmp    %edi,%edx
+  80365c:	74 12                	je     803670 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80365e:	48 83 c0 01          	add    $0x1,%rax
+  803662:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803668:	75 db                	jne    803645 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80366a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366f:	c3                   	ret
+            return envs[i].env_id;
+  803670:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803674:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803678:	48 c1 e2 04          	shl    $0x4,%rdx
+  80367c:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803683:	00 00 00 
+  803686:	48 01 d0             	add    %rdx,%rax
+  803689:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80368f:	c3                   	ret
+
+0000000000803690 <__rodata_start>:
+  803690:	3c 75                	cmp    $0x75,%al
+  803692:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803693:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803697:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803698:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  80369c:	1f                   	(bad)
+  80369d:	44 00 00             	add    %r8b,(%rax)
+  8036a0:	73 79                	jae    80371b <__rodata_start+0x8b>
+  8036a2:	73 63                	jae    803707 <__rodata_start+0x77>
+  8036a4:	61                   	(bad)
+  8036a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b27 <__bss_end+0x72201b27>
+  8036ad:	65 74 75             	gs je  803725 <__rodata_start+0x95>
+  8036b0:	72 6e                	jb     803720 <__rodata_start+0x90>
+  8036b2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b34 <__bss_end+0x28201b34>
+  8036b9:	28 
+  8036ba:	3e 20 30             	ds and %dh,(%rax)
+  8036bd:	29 00                	sub    %eax,(%rax)
+  8036bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036c7:	61                   	(bad)
+  8036c8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ca:	2e 63 00             	cs movsxd (%rax),%eax
+  8036cd:	0f 1f 00             	nopl   (%rax)
+  8036d0:	5b                   	pop    %rbx
+  8036d1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036d6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036d9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036de:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036e2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036e9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804154 <devpipe+0x94>
+  8036f0:	5b                   	pop    %rbx
+  8036f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036f6:	20 72 65             	and    %dh,0x65(%rdx)
+  8036f9:	61                   	(bad)
+  8036fa:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036fc:	61                   	(bad)
+  8036fd:	70 20                	jo     80371f <__rodata_start+0x8f>
+  8036ff:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  803704:	20 62 61             	and    %ah,0x61(%rdx)
+  803707:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80370b:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80370f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803712:	30 38                	xor    %bh,(%rax)
+  803714:	78 5d                	js     803773 <__rodata_start+0xe3>
+  803716:	20 66 74             	and    %ah,0x74(%rsi)
+  803719:	72 75                	jb     803790 <devtab+0x10>
+  80371b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80371f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad578a <__bss_end+0x2d2cd78a>
+  803726:	20 62 61             	and    %ah,0x61(%rdx)
+  803729:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80372d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803731:	5b                   	pop    %rbx
+  803732:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803737:	20 72 65             	and    %dh,0x65(%rdx)
+  80373a:	61                   	(bad)
+  80373b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad57a6 <__bss_end+0x2d2cd7a6>
+  803742:	20 62 61             	and    %ah,0x61(%rdx)
+  803745:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803749:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80374d:	5b                   	pop    %rbx
+  80374e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803753:	20 77 72             	and    %dh,0x72(%rdi)
+  803756:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80375d:	2d 
+  80375e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803763:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803766:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80376a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803771:	00 00 00 
+  803774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80377b:	00 00 00 
+  80377e:	66 90                	xchg   %ax,%ax
+
+0000000000803780 <devtab>:
+  803780:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803790:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  8037a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8038a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8038b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8039a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8039b0:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039c0:	3e 28 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     >(..............
+  8039d0:	6f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     o...............
+  8039e0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  8039f0:	7f 2e 80 00 00 00 00 00 5d 28 80 00 00 00 00 00     ........](......
+  803a00:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803a10:	51 28 80 00 00 00 00 00 cb 28 80 00 00 00 00 00     Q(.......(......
+  803a20:	7f 2e 80 00 00 00 00 00 51 28 80 00 00 00 00 00     ........Q(......
+  803a30:	97 28 80 00 00 00 00 00 97 28 80 00 00 00 00 00     .(.......(......
+  803a40:	97 28 80 00 00 00 00 00 97 28 80 00 00 00 00 00     .(.......(......
+  803a50:	97 28 80 00 00 00 00 00 97 28 80 00 00 00 00 00     .(.......(......
+  803a60:	97 28 80 00 00 00 00 00 97 28 80 00 00 00 00 00     .(.......(......
+  803a70:	97 28 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     .(..............
+  803a80:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803a90:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803aa0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803ab0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803ac0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803ad0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803ae0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803af0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b00:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b10:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b20:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b30:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b40:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b50:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b60:	7f 2e 80 00 00 00 00 00 a2 2d 80 00 00 00 00 00     .........-......
+  803b70:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b80:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803b90:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803ba0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803bb0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803bc0:	ee 28 80 00 00 00 00 00 bd 2a 80 00 00 00 00 00     .(.......*......
+  803bd0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803be0:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803bf0:	1d 29 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     .)..............
+  803c00:	7f 2e 80 00 00 00 00 00 e3 28 80 00 00 00 00 00     .........(......
+  803c10:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803c20:	65 2c 80 00 00 00 00 00 2f 2d 80 00 00 00 00 00     e,....../-......
+  803c30:	7f 2e 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     ................
+  803c40:	b4 29 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     .)..............
+  803c50:	91 2b 80 00 00 00 00 00 7f 2e 80 00 00 00 00 00     .+..............
+  803c60:	7f 2e 80 00 00 00 00 00 a2 2d 80 00 00 00 00 00     .........-......
+  803c70:	7f 2e 80 00 00 00 00 00 47 28 80 00 00 00 00 00     ........G(......
+
+0000000000803c80 <error_string>:
+	...
+  803c88:	55 38 80 00 00 00 00 00 67 38 80 00 00 00 00 00     U8......g8......
+  803c98:	77 38 80 00 00 00 00 00 89 38 80 00 00 00 00 00     w8.......8......
+  803ca8:	97 38 80 00 00 00 00 00 ab 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	c0 38 80 00 00 00 00 00 d3 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	e5 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	09 39 80 00 00 00 00 00 1c 39 80 00 00 00 00 00     .9.......9......
+  803ce8:	33 39 80 00 00 00 00 00 49 39 80 00 00 00 00 00     39......I9......
+  803cf8:	61 39 80 00 00 00 00 00 79 39 80 00 00 00 00 00     a9......y9......
+  803d08:	86 39 80 00 00 00 00 00 28 3d 80 00 00 00 00 00     .9......(=......
+  803d18:	9a 39 80 00 00 00 00 00 b2 39 80 00 00 00 00 00     .9.......9......
+  803d28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d48:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d58:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff8:	00 0f 1f 80 00 00 00 00                             ........
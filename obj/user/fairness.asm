@@ -0,0 +1,6932 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 dc 00 00 00       	call   8000ff <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  800034:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  800042:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 30 01 c0 1f 80 	movabs $0x801fc00130,%rax
+  800053:	00 00 00 
+  800056:	48 39 02             	cmp    %rax,(%rdx)
+  800059:	74 5e                	je     8000b9 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005b:	48 b8 f8 01 c0 1f 80 	movabs $0x801fc001f8,%rax
+  800062:	00 00 00 
+  800065:	8b 10                	mov    (%rax),%edx
+  800067:	89 de                	mov    %ebx,%esi
+  800069:	48 bf 61 37 80 00 00 	movabs $0x803761,%rdi
+  800070:	00 00 00 
+  800073:	b8 00 00 00 00       	mov    $0x0,%eax
+  800078:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  80007f:	00 00 00 
+  800082:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  800084:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  80008b:	00 00 00 
+  80008e:	48 bb fd 16 80 00 00 	movabs $0x8016fd,%rbx
+  800095:	00 00 00 
+  800098:	41 8b bc 24 f8 01 00 	mov    0x1f8(%r12),%edi
+  80009f:	00 
+  8000a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	ff d3                	call   *%rbx
+        while (1)
+  8000b7:	eb df                	jmp    800098 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000b9:	49 be e5 16 80 00 00 	movabs $0x8016e5,%r14
+  8000c0:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  8000c3:	49 bd 50 37 80 00 00 	movabs $0x803750,%r13
+  8000ca:	00 00 00 
+  8000cd:	49 bc 7d 02 80 00 00 	movabs $0x80027d,%r12
+  8000d4:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ea:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8000ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ef             	mov    %r13,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d4             	call   *%r12
+        while (1) {
+  8000fd:	eb d8                	jmp    8000d7 <umain+0xb2>
+
+00000000008000ff <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 56                	push   %r14
+  800105:	41 55                	push   %r13
+  800107:	41 54                	push   %r12
+  800109:	53                   	push   %rbx
+  80010a:	41 89 fd             	mov    %edi,%r13d
+  80010d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800110:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800117:	00 00 00 
+  80011a:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800121:	00 00 00 
+  800124:	48 39 c2             	cmp    %rax,%rdx
+  800127:	73 17                	jae    800140 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800129:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80012c:	49 89 c4             	mov    %rax,%r12
+  80012f:	48 83 c3 08          	add    $0x8,%rbx
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	ff 53 f8             	call   *-0x8(%rbx)
+  80013b:	4c 39 e3             	cmp    %r12,%rbx
+  80013e:	72 ef                	jb     80012f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800140:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+  80014c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800151:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800155:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800159:	48 c1 e0 04          	shl    $0x4,%rax
+  80015d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800164:	00 00 00 
+  800167:	48 01 d0             	add    %rdx,%rax
+  80016a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800171:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800174:	45 85 ed             	test   %r13d,%r13d
+  800177:	7e 0d                	jle    800186 <libmain+0x87>
+  800179:	49 8b 06             	mov    (%r14),%rax
+  80017c:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800183:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800186:	4c 89 f6             	mov    %r14,%rsi
+  800189:	44 89 ef             	mov    %r13d,%edi
+  80018c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800198:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+#endif
+}
+  8001a4:	5b                   	pop    %rbx
+  8001a5:	41 5c                	pop    %r12
+  8001a7:	41 5d                	pop    %r13
+  8001a9:	41 5e                	pop    %r14
+  8001ab:	5d                   	pop    %rbp
+  8001ac:	c3                   	ret
+
+00000000008001ad <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ad:	55                   	push   %rbp
+  8001ae:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001b1:	48 b8 3b 1a 80 00 00 	movabs $0x801a3b,%rax
+  8001b8:	00 00 00 
+  8001bb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 03 11 80 00 00 	movabs $0x801103,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+}
+  8001ce:	5d                   	pop    %rbp
+  8001cf:	c3                   	ret
+
+00000000008001d0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+  8001d4:	53                   	push   %rbx
+  8001d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8001d9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001dc:	8b 06                	mov    (%rsi),%eax
+  8001de:	8d 50 01             	lea    0x1(%rax),%edx
+  8001e1:	89 16                	mov    %edx,(%rsi)
+  8001e3:	48 98                	cltq
+  8001e5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001ea:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001f0:	74 0a                	je     8001fc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001f2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fa:	c9                   	leave
+  8001fb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001fc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800200:	be ff 00 00 00       	mov    $0xff,%esi
+  800205:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800211:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800217:	eb d9                	jmp    8001f2 <putch+0x22>
+
+0000000000800219 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800219:	55                   	push   %rbp
+  80021a:	48 89 e5             	mov    %rsp,%rbp
+  80021d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800224:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800227:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80022e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800233:	b8 00 00 00 00       	mov    $0x0,%eax
+  800238:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80023b:	48 89 f1             	mov    %rsi,%rcx
+  80023e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800245:	48 bf d0 01 80 00 00 	movabs $0x8001d0,%rdi
+  80024c:	00 00 00 
+  80024f:	48 b8 cd 03 80 00 00 	movabs $0x8003cd,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80025b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800262:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800269:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  800270:	00 00 00 
+  800273:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800275:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+000000000080027d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+  800281:	48 83 ec 50          	sub    $0x50,%rsp
+  800285:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800289:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80028d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800291:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800295:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800299:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002a8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002ac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002b0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002b4:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002c0:	c9                   	leave
+  8002c1:	c3                   	ret
+
+00000000008002c2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002c2:	55                   	push   %rbp
+  8002c3:	48 89 e5             	mov    %rsp,%rbp
+  8002c6:	41 57                	push   %r15
+  8002c8:	41 56                	push   %r14
+  8002ca:	41 55                	push   %r13
+  8002cc:	41 54                	push   %r12
+  8002ce:	53                   	push   %rbx
+  8002cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8002d3:	49 89 fc             	mov    %rdi,%r12
+  8002d6:	49 89 f5             	mov    %rsi,%r13
+  8002d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002dd:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002e0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002e3:	41 89 cf             	mov    %ecx,%r15d
+  8002e6:	4c 39 fa             	cmp    %r15,%rdx
+  8002e9:	73 5b                	jae    800346 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002eb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002ef:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002f3:	85 db                	test   %ebx,%ebx
+  8002f5:	7e 0e                	jle    800305 <print_num+0x43>
+            putch(padc, put_arg);
+  8002f7:	4c 89 ee             	mov    %r13,%rsi
+  8002fa:	44 89 f7             	mov    %r14d,%edi
+  8002fd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800300:	83 eb 01             	sub    $0x1,%ebx
+  800303:	75 f2                	jne    8002f7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800305:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800309:	48 b9 93 37 80 00 00 	movabs $0x803793,%rcx
+  800310:	00 00 00 
+  800313:	48 b8 82 37 80 00 00 	movabs $0x803782,%rax
+  80031a:	00 00 00 
+  80031d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800321:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032a:	49 f7 f7             	div    %r15
+  80032d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800331:	4c 89 ee             	mov    %r13,%rsi
+  800334:	41 ff d4             	call   *%r12
+}
+  800337:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80033b:	5b                   	pop    %rbx
+  80033c:	41 5c                	pop    %r12
+  80033e:	41 5d                	pop    %r13
+  800340:	41 5e                	pop    %r14
+  800342:	41 5f                	pop    %r15
+  800344:	5d                   	pop    %rbp
+  800345:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800346:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80034a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034f:	49 f7 f7             	div    %r15
+  800352:	48 83 ec 08          	sub    $0x8,%rsp
+  800356:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80035a:	52                   	push   %rdx
+  80035b:	45 0f be c9          	movsbl %r9b,%r9d
+  80035f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800363:	48 89 c2             	mov    %rax,%rdx
+  800366:	48 b8 c2 02 80 00 00 	movabs $0x8002c2,%rax
+  80036d:	00 00 00 
+  800370:	ff d0                	call   *%rax
+  800372:	48 83 c4 10          	add    $0x10,%rsp
+  800376:	eb 8d                	jmp    800305 <print_num+0x43>
+
+0000000000800378 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800378:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80037c:	48 8b 06             	mov    (%rsi),%rax
+  80037f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800383:	73 0a                	jae    80038f <sprintputch+0x17>
+        *state->start++ = ch;
+  800385:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800389:	48 89 16             	mov    %rdx,(%rsi)
+  80038c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80038f:	c3                   	ret
+
+0000000000800390 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+  800394:	48 83 ec 50          	sub    $0x50,%rsp
+  800398:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80039c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003a4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003bb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003bf:	48 b8 cd 03 80 00 00 	movabs $0x8003cd,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+}
+  8003cb:	c9                   	leave
+  8003cc:	c3                   	ret
+
+00000000008003cd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003cd:	55                   	push   %rbp
+  8003ce:	48 89 e5             	mov    %rsp,%rbp
+  8003d1:	41 57                	push   %r15
+  8003d3:	41 56                	push   %r14
+  8003d5:	41 55                	push   %r13
+  8003d7:	41 54                	push   %r12
+  8003d9:	53                   	push   %rbx
+  8003da:	48 83 ec 38          	sub    $0x38,%rsp
+  8003de:	49 89 fe             	mov    %rdi,%r14
+  8003e1:	49 89 f5             	mov    %rsi,%r13
+  8003e4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003e7:	48 8b 01             	mov    (%rcx),%rax
+  8003ea:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003ee:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003f6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003fe:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800402:	0f b6 3b             	movzbl (%rbx),%edi
+  800405:	40 80 ff 25          	cmp    $0x25,%dil
+  800409:	74 18                	je     800423 <vprintfmt+0x56>
+            if (!ch) return;
+  80040b:	40 84 ff             	test   %dil,%dil
+  80040e:	0f 84 b1 06 00 00    	je     800ac5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800414:	40 0f b6 ff          	movzbl %dil,%edi
+  800418:	4c 89 ee             	mov    %r13,%rsi
+  80041b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80041e:	4c 89 e3             	mov    %r12,%rbx
+  800421:	eb db                	jmp    8003fe <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800423:	be 00 00 00 00       	mov    $0x0,%esi
+  800428:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80042c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800431:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800437:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80043e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800442:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800447:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80044c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80044f:	83 e8 23             	sub    $0x23,%eax
+  800452:	3c 57                	cmp    $0x57,%al
+  800454:	0f 87 51 06 00 00    	ja     800aab <vprintfmt+0x6de>
+  80045a:	0f b6 c0             	movzbl %al,%eax
+  80045d:	48 b9 20 39 80 00 00 	movabs $0x803920,%rcx
+  800464:	00 00 00 
+  800467:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80046a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80046d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800471:	eb cf                	jmp    800442 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800473:	49 89 dc             	mov    %rbx,%r12
+  800476:	be 01 00 00 00       	mov    $0x1,%esi
+  80047b:	eb c5                	jmp    800442 <vprintfmt+0x75>
+            padc = ch;
+  80047d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800481:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800484:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800487:	eb b9                	jmp    800442 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800489:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80048c:	83 f8 2f             	cmp    $0x2f,%eax
+  80048f:	77 24                	ja     8004b5 <vprintfmt+0xe8>
+  800491:	89 c1                	mov    %eax,%ecx
+  800493:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800497:	83 c0 08             	add    $0x8,%eax
+  80049a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004a0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004a3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004a7:	79 99                	jns    800442 <vprintfmt+0x75>
+                width = precision;
+  8004a9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004ad:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004b3:	eb 8d                	jmp    800442 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004b9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c1:	eb da                	jmp    80049d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004c3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004c8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004cc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004d2:	3c 39                	cmp    $0x39,%al
+  8004d4:	77 1c                	ja     8004f2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004d6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004da:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004de:	0f b6 c0             	movzbl %al,%eax
+  8004e1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004e6:	0f b6 03             	movzbl (%rbx),%eax
+  8004e9:	3c 39                	cmp    $0x39,%al
+  8004eb:	76 e9                	jbe    8004d6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004f0:	eb b1                	jmp    8004a3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004f2:	49 89 dc             	mov    %rbx,%r12
+  8004f5:	eb ac                	jmp    8004a3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004f7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004fa:	85 c9                	test   %ecx,%ecx
+  8004fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800501:	0f 49 c1             	cmovns %ecx,%eax
+  800504:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800507:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80050a:	e9 33 ff ff ff       	jmp    800442 <vprintfmt+0x75>
+            lflag++;
+  80050f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800512:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800515:	e9 28 ff ff ff       	jmp    800442 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80051a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051d:	83 f8 2f             	cmp    $0x2f,%eax
+  800520:	77 19                	ja     80053b <vprintfmt+0x16e>
+  800522:	89 c2                	mov    %eax,%edx
+  800524:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800528:	83 c0 08             	add    $0x8,%eax
+  80052b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052e:	8b 3a                	mov    (%rdx),%edi
+  800530:	4c 89 ee             	mov    %r13,%rsi
+  800533:	41 ff d6             	call   *%r14
+            break;
+  800536:	e9 c3 fe ff ff       	jmp    8003fe <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80053b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800543:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800547:	eb e5                	jmp    80052e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800549:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054c:	83 f8 2f             	cmp    $0x2f,%eax
+  80054f:	77 5a                	ja     8005ab <vprintfmt+0x1de>
+  800551:	89 c2                	mov    %eax,%edx
+  800553:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800557:	83 c0 08             	add    $0x8,%eax
+  80055a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80055d:	8b 02                	mov    (%rdx),%eax
+  80055f:	89 c1                	mov    %eax,%ecx
+  800561:	f7 d9                	neg    %ecx
+  800563:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800566:	83 f9 14             	cmp    $0x14,%ecx
+  800569:	7f 4e                	jg     8005b9 <vprintfmt+0x1ec>
+  80056b:	48 63 c1             	movslq %ecx,%rax
+  80056e:	48 ba e0 3b 80 00 00 	movabs $0x803be0,%rdx
+  800575:	00 00 00 
+  800578:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80057c:	48 85 c0             	test   %rax,%rax
+  80057f:	74 38                	je     8005b9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800581:	48 89 c1             	mov    %rax,%rcx
+  800584:	48 ba d9 3d 80 00 00 	movabs $0x803dd9,%rdx
+  80058b:	00 00 00 
+  80058e:	4c 89 ee             	mov    %r13,%rsi
+  800591:	4c 89 f7             	mov    %r14,%rdi
+  800594:	b8 00 00 00 00       	mov    $0x0,%eax
+  800599:	49 b8 90 03 80 00 00 	movabs $0x800390,%r8
+  8005a0:	00 00 00 
+  8005a3:	41 ff d0             	call   *%r8
+  8005a6:	e9 53 fe ff ff       	jmp    8003fe <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b7:	eb a4                	jmp    80055d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005b9:	48 ba ab 37 80 00 00 	movabs $0x8037ab,%rdx
+  8005c0:	00 00 00 
+  8005c3:	4c 89 ee             	mov    %r13,%rsi
+  8005c6:	4c 89 f7             	mov    %r14,%rdi
+  8005c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ce:	49 b8 90 03 80 00 00 	movabs $0x800390,%r8
+  8005d5:	00 00 00 
+  8005d8:	41 ff d0             	call   *%r8
+  8005db:	e9 1e fe ff ff       	jmp    8003fe <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e6:	77 6c                	ja     800654 <vprintfmt+0x287>
+  8005e8:	89 c2                	mov    %eax,%edx
+  8005ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005ee:	83 c0 08             	add    $0x8,%eax
+  8005f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005f7:	48 85 d2             	test   %rdx,%rdx
+  8005fa:	48 b8 a4 37 80 00 00 	movabs $0x8037a4,%rax
+  800601:	00 00 00 
+  800604:	48 0f 45 c2          	cmovne %rdx,%rax
+  800608:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80060c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800610:	7e 06                	jle    800618 <vprintfmt+0x24b>
+  800612:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800616:	75 4a                	jne    800662 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800618:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80061c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800620:	0f b6 00             	movzbl (%rax),%eax
+  800623:	84 c0                	test   %al,%al
+  800625:	0f 85 9a 00 00 00    	jne    8006c5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80062b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800632:	85 c0                	test   %eax,%eax
+  800634:	0f 8e c4 fd ff ff    	jle    8003fe <vprintfmt+0x31>
+  80063a:	4c 89 ee             	mov    %r13,%rsi
+  80063d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800642:	41 ff d6             	call   *%r14
+  800645:	41 83 ec 01          	sub    $0x1,%r12d
+  800649:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80064d:	75 eb                	jne    80063a <vprintfmt+0x26d>
+  80064f:	e9 aa fd ff ff       	jmp    8003fe <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800654:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800658:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80065c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800660:	eb 92                	jmp    8005f4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800662:	49 63 f7             	movslq %r15d,%rsi
+  800665:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800669:	48 b8 7f 0b 80 00 00 	movabs $0x800b7f,%rax
+  800670:	00 00 00 
+  800673:	ff d0                	call   *%rax
+  800675:	48 89 c2             	mov    %rax,%rdx
+  800678:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80067d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800680:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800683:	85 c0                	test   %eax,%eax
+  800685:	7e 91                	jle    800618 <vprintfmt+0x24b>
+  800687:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80068c:	4c 89 ee             	mov    %r13,%rsi
+  80068f:	44 89 e7             	mov    %r12d,%edi
+  800692:	41 ff d6             	call   *%r14
+  800695:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800699:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80069c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80069f:	75 eb                	jne    80068c <vprintfmt+0x2bf>
+  8006a1:	e9 72 ff ff ff       	jmp    800618 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006a6:	0f b6 f8             	movzbl %al,%edi
+  8006a9:	4c 89 ee             	mov    %r13,%rsi
+  8006ac:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006af:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006b3:	49 83 c4 01          	add    $0x1,%r12
+  8006b7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006bd:	84 c0                	test   %al,%al
+  8006bf:	0f 84 66 ff ff ff    	je     80062b <vprintfmt+0x25e>
+  8006c5:	45 85 ff             	test   %r15d,%r15d
+  8006c8:	78 0a                	js     8006d4 <vprintfmt+0x307>
+  8006ca:	41 83 ef 01          	sub    $0x1,%r15d
+  8006ce:	0f 88 57 ff ff ff    	js     80062b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006d8:	74 cc                	je     8006a6 <vprintfmt+0x2d9>
+  8006da:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006dd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006e2:	80 fa 5e             	cmp    $0x5e,%dl
+  8006e5:	77 c2                	ja     8006a9 <vprintfmt+0x2dc>
+  8006e7:	eb bd                	jmp    8006a6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e9:	40 84 f6             	test   %sil,%sil
+  8006ec:	75 26                	jne    800714 <vprintfmt+0x347>
+    switch (lflag) {
+  8006ee:	85 d2                	test   %edx,%edx
+  8006f0:	74 59                	je     80074b <vprintfmt+0x37e>
+  8006f2:	83 fa 01             	cmp    $0x1,%edx
+  8006f5:	74 7b                	je     800772 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fd:	0f 87 96 00 00 00    	ja     800799 <vprintfmt+0x3cc>
+  800703:	89 c2                	mov    %eax,%edx
+  800705:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800709:	83 c0 08             	add    $0x8,%eax
+  80070c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070f:	4c 8b 22             	mov    (%rdx),%r12
+  800712:	eb 17                	jmp    80072b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800714:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800717:	83 f8 2f             	cmp    $0x2f,%eax
+  80071a:	77 21                	ja     80073d <vprintfmt+0x370>
+  80071c:	89 c2                	mov    %eax,%edx
+  80071e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800722:	83 c0 08             	add    $0x8,%eax
+  800725:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800728:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80072b:	4d 85 e4             	test   %r12,%r12
+  80072e:	78 7a                	js     8007aa <vprintfmt+0x3dd>
+            num = i;
+  800730:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800733:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800738:	e9 50 02 00 00       	jmp    80098d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80073d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800741:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800745:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800749:	eb dd                	jmp    800728 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 11                	ja     800764 <vprintfmt+0x397>
+  800753:	89 c2                	mov    %eax,%edx
+  800755:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075f:	4c 63 22             	movslq (%rdx),%r12
+  800762:	eb c7                	jmp    80072b <vprintfmt+0x35e>
+  800764:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800768:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800770:	eb ed                	jmp    80075f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800772:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800775:	83 f8 2f             	cmp    $0x2f,%eax
+  800778:	77 11                	ja     80078b <vprintfmt+0x3be>
+  80077a:	89 c2                	mov    %eax,%edx
+  80077c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800780:	83 c0 08             	add    $0x8,%eax
+  800783:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800786:	4c 8b 22             	mov    (%rdx),%r12
+  800789:	eb a0                	jmp    80072b <vprintfmt+0x35e>
+  80078b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	eb ed                	jmp    800786 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800799:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a5:	e9 65 ff ff ff       	jmp    80070f <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007aa:	4c 89 ee             	mov    %r13,%rsi
+  8007ad:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007b2:	41 ff d6             	call   *%r14
+                i = -i;
+  8007b5:	49 f7 dc             	neg    %r12
+  8007b8:	e9 73 ff ff ff       	jmp    800730 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007bd:	40 84 f6             	test   %sil,%sil
+  8007c0:	75 32                	jne    8007f4 <vprintfmt+0x427>
+    switch (lflag) {
+  8007c2:	85 d2                	test   %edx,%edx
+  8007c4:	74 5d                	je     800823 <vprintfmt+0x456>
+  8007c6:	83 fa 01             	cmp    $0x1,%edx
+  8007c9:	0f 84 82 00 00 00    	je     800851 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d5:	0f 87 a5 00 00 00    	ja     800880 <vprintfmt+0x4b3>
+  8007db:	89 c2                	mov    %eax,%edx
+  8007dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e1:	83 c0 08             	add    $0x8,%eax
+  8007e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007ef:	e9 99 01 00 00       	jmp    80098d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fa:	77 19                	ja     800815 <vprintfmt+0x448>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800802:	83 c0 08             	add    $0x8,%eax
+  800805:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800808:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80080b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	e9 78 01 00 00       	jmp    80098d <vprintfmt+0x5c0>
+  800815:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800819:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800821:	eb e5                	jmp    800808 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800823:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800826:	83 f8 2f             	cmp    $0x2f,%eax
+  800829:	77 18                	ja     800843 <vprintfmt+0x476>
+  80082b:	89 c2                	mov    %eax,%edx
+  80082d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800831:	83 c0 08             	add    $0x8,%eax
+  800834:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800837:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800839:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80083e:	e9 4a 01 00 00       	jmp    80098d <vprintfmt+0x5c0>
+  800843:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800847:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084f:	eb e6                	jmp    800837 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800851:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 19                	ja     800872 <vprintfmt+0x4a5>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800868:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80086d:	e9 1b 01 00 00       	jmp    80098d <vprintfmt+0x5c0>
+  800872:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800876:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087e:	eb e5                	jmp    800865 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800880:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800884:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800888:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088c:	e9 56 ff ff ff       	jmp    8007e7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800891:	40 84 f6             	test   %sil,%sil
+  800894:	75 2e                	jne    8008c4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800896:	85 d2                	test   %edx,%edx
+  800898:	74 59                	je     8008f3 <vprintfmt+0x526>
+  80089a:	83 fa 01             	cmp    $0x1,%edx
+  80089d:	74 7f                	je     80091e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80089f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a5:	0f 87 9f 00 00 00    	ja     80094a <vprintfmt+0x57d>
+  8008ab:	89 c2                	mov    %eax,%edx
+  8008ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b1:	83 c0 08             	add    $0x8,%eax
+  8008b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ba:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008bf:	e9 c9 00 00 00       	jmp    80098d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	77 19                	ja     8008e5 <vprintfmt+0x518>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008db:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e0:	e9 a8 00 00 00       	jmp    80098d <vprintfmt+0x5c0>
+  8008e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f1:	eb e5                	jmp    8008d8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f9:	77 15                	ja     800910 <vprintfmt+0x543>
+  8008fb:	89 c2                	mov    %eax,%edx
+  8008fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800901:	83 c0 08             	add    $0x8,%eax
+  800904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800907:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800909:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80090e:	eb 7d                	jmp    80098d <vprintfmt+0x5c0>
+  800910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800914:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	eb e9                	jmp    800907 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80091e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800921:	83 f8 2f             	cmp    $0x2f,%eax
+  800924:	77 16                	ja     80093c <vprintfmt+0x56f>
+  800926:	89 c2                	mov    %eax,%edx
+  800928:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092c:	83 c0 08             	add    $0x8,%eax
+  80092f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800932:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800935:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80093a:	eb 51                	jmp    80098d <vprintfmt+0x5c0>
+  80093c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800940:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800944:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800948:	eb e8                	jmp    800932 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80094a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800952:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800956:	e9 5c ff ff ff       	jmp    8008b7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80095b:	4c 89 ee             	mov    %r13,%rsi
+  80095e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800963:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800966:	4c 89 ee             	mov    %r13,%rsi
+  800969:	bf 78 00 00 00       	mov    $0x78,%edi
+  80096e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800971:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800974:	83 f8 2f             	cmp    $0x2f,%eax
+  800977:	77 47                	ja     8009c0 <vprintfmt+0x5f3>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800988:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80098d:	48 83 ec 08          	sub    $0x8,%rsp
+  800991:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800995:	0f 94 c0             	sete   %al
+  800998:	0f b6 c0             	movzbl %al,%eax
+  80099b:	50                   	push   %rax
+  80099c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009a1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009a5:	4c 89 ee             	mov    %r13,%rsi
+  8009a8:	4c 89 f7             	mov    %r14,%rdi
+  8009ab:	48 b8 c2 02 80 00 00 	movabs $0x8002c2,%rax
+  8009b2:	00 00 00 
+  8009b5:	ff d0                	call   *%rax
+            break;
+  8009b7:	48 83 c4 10          	add    $0x10,%rsp
+  8009bb:	e9 3e fa ff ff       	jmp    8003fe <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cc:	eb b7                	jmp    800985 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ce:	40 84 f6             	test   %sil,%sil
+  8009d1:	75 2b                	jne    8009fe <vprintfmt+0x631>
+    switch (lflag) {
+  8009d3:	85 d2                	test   %edx,%edx
+  8009d5:	74 56                	je     800a2d <vprintfmt+0x660>
+  8009d7:	83 fa 01             	cmp    $0x1,%edx
+  8009da:	74 7f                	je     800a5b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	0f 87 a2 00 00 00    	ja     800a8a <vprintfmt+0x6bd>
+  8009e8:	89 c2                	mov    %eax,%edx
+  8009ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ee:	83 c0 08             	add    $0x8,%eax
+  8009f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009fc:	eb 8f                	jmp    80098d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a01:	83 f8 2f             	cmp    $0x2f,%eax
+  800a04:	77 19                	ja     800a1f <vprintfmt+0x652>
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0c:	83 c0 08             	add    $0x8,%eax
+  800a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a15:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	e9 6e ff ff ff       	jmp    80098d <vprintfmt+0x5c0>
+  800a1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2b:	eb e5                	jmp    800a12 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 18                	ja     800a4d <vprintfmt+0x680>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a43:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a48:	e9 40 ff ff ff       	jmp    80098d <vprintfmt+0x5c0>
+  800a4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a59:	eb e6                	jmp    800a41 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a61:	77 19                	ja     800a7c <vprintfmt+0x6af>
+  800a63:	89 c2                	mov    %eax,%edx
+  800a65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a69:	83 c0 08             	add    $0x8,%eax
+  800a6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a72:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a77:	e9 11 ff ff ff       	jmp    80098d <vprintfmt+0x5c0>
+  800a7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a88:	eb e5                	jmp    800a6f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a96:	e9 59 ff ff ff       	jmp    8009f4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a9b:	4c 89 ee             	mov    %r13,%rsi
+  800a9e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aa3:	41 ff d6             	call   *%r14
+            break;
+  800aa6:	e9 53 f9 ff ff       	jmp    8003fe <vprintfmt+0x31>
+            putch('%', put_arg);
+  800aab:	4c 89 ee             	mov    %r13,%rsi
+  800aae:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ab3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ab6:	48 83 eb 01          	sub    $0x1,%rbx
+  800aba:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800abe:	75 f6                	jne    800ab6 <vprintfmt+0x6e9>
+  800ac0:	e9 39 f9 ff ff       	jmp    8003fe <vprintfmt+0x31>
+}
+  800ac5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ac9:	5b                   	pop    %rbx
+  800aca:	41 5c                	pop    %r12
+  800acc:	41 5d                	pop    %r13
+  800ace:	41 5e                	pop    %r14
+  800ad0:	41 5f                	pop    %r15
+  800ad2:	5d                   	pop    %rbp
+  800ad3:	c3                   	ret
+
+0000000000800ad4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ad4:	55                   	push   %rbp
+  800ad5:	48 89 e5             	mov    %rsp,%rbp
+  800ad8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800adc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ae0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ae5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ae9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800af0:	48 85 ff             	test   %rdi,%rdi
+  800af3:	74 2b                	je     800b20 <vsnprintf+0x4c>
+  800af5:	48 85 f6             	test   %rsi,%rsi
+  800af8:	74 26                	je     800b20 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800afa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800afe:	48 bf 78 03 80 00 00 	movabs $0x800378,%rdi
+  800b05:	00 00 00 
+  800b08:	48 b8 cd 03 80 00 00 	movabs $0x8003cd,%rax
+  800b0f:	00 00 00 
+  800b12:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b18:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b1b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b25:	eb f7                	jmp    800b1e <vsnprintf+0x4a>
+
+0000000000800b27 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b27:	55                   	push   %rbp
+  800b28:	48 89 e5             	mov    %rsp,%rbp
+  800b2b:	48 83 ec 50          	sub    $0x50,%rsp
+  800b2f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b33:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b37:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b3b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b42:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b4e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b52:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b56:	48 b8 d4 0a 80 00 00 	movabs $0x800ad4,%rax
+  800b5d:	00 00 00 
+  800b60:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b62:	c9                   	leave
+  800b63:	c3                   	ret
+
+0000000000800b64 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b64:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b67:	74 10                	je     800b79 <strlen+0x15>
+    size_t n = 0;
+  800b69:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b6e:	48 83 c0 01          	add    $0x1,%rax
+  800b72:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b76:	75 f6                	jne    800b6e <strlen+0xa>
+  800b78:	c3                   	ret
+    size_t n = 0;
+  800b79:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b7e:	c3                   	ret
+
+0000000000800b7f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b7f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b82:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b87:	48 85 f6             	test   %rsi,%rsi
+  800b8a:	74 11                	je     800b9d <strnlen+0x1e>
+  800b8c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b90:	74 0c                	je     800b9e <strnlen+0x1f>
+  800b92:	48 83 c2 01          	add    $0x1,%rdx
+  800b96:	48 39 d0             	cmp    %rdx,%rax
+  800b99:	75 f1                	jne    800b8c <strnlen+0xd>
+  800b9b:	eb 04                	jmp    800ba1 <strnlen+0x22>
+  800b9d:	c3                   	ret
+  800b9e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ba1:	c3                   	ret
+
+0000000000800ba2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ba2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800baa:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bae:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bb1:	48 83 c2 01          	add    $0x1,%rdx
+  800bb5:	84 c9                	test   %cl,%cl
+  800bb7:	75 f1                	jne    800baa <strcpy+0x8>
+        ;
+    return res;
+}
+  800bb9:	c3                   	ret
+
+0000000000800bba <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bba:	55                   	push   %rbp
+  800bbb:	48 89 e5             	mov    %rsp,%rbp
+  800bbe:	41 54                	push   %r12
+  800bc0:	53                   	push   %rbx
+  800bc1:	48 89 fb             	mov    %rdi,%rbx
+  800bc4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bc7:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800bce:	00 00 00 
+  800bd1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bd3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bd7:	4c 89 e6             	mov    %r12,%rsi
+  800bda:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  800be1:	00 00 00 
+  800be4:	ff d0                	call   *%rax
+    return dst;
+}
+  800be6:	48 89 d8             	mov    %rbx,%rax
+  800be9:	5b                   	pop    %rbx
+  800bea:	41 5c                	pop    %r12
+  800bec:	5d                   	pop    %rbp
+  800bed:	c3                   	ret
+
+0000000000800bee <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bee:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bf1:	48 85 d2             	test   %rdx,%rdx
+  800bf4:	74 1f                	je     800c15 <strncpy+0x27>
+  800bf6:	48 01 fa             	add    %rdi,%rdx
+  800bf9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bfc:	48 83 c1 01          	add    $0x1,%rcx
+  800c00:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c04:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c08:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c0c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c10:	48 39 ca             	cmp    %rcx,%rdx
+  800c13:	75 e7                	jne    800bfc <strncpy+0xe>
+    }
+    return ret;
+}
+  800c15:	c3                   	ret
+
+0000000000800c16 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c16:	48 89 f8             	mov    %rdi,%rax
+  800c19:	48 85 d2             	test   %rdx,%rdx
+  800c1c:	74 24                	je     800c42 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c1e:	48 83 ea 01          	sub    $0x1,%rdx
+  800c22:	74 1b                	je     800c3f <strlcpy+0x29>
+  800c24:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c28:	0f b6 16             	movzbl (%rsi),%edx
+  800c2b:	84 d2                	test   %dl,%dl
+  800c2d:	74 10                	je     800c3f <strlcpy+0x29>
+            *dst++ = *src++;
+  800c2f:	48 83 c6 01          	add    $0x1,%rsi
+  800c33:	48 83 c0 01          	add    $0x1,%rax
+  800c37:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c3a:	48 39 c8             	cmp    %rcx,%rax
+  800c3d:	75 e9                	jne    800c28 <strlcpy+0x12>
+        *dst = '\0';
+  800c3f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c42:	48 29 f8             	sub    %rdi,%rax
+}
+  800c45:	c3                   	ret
+
+0000000000800c46 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c46:	0f b6 07             	movzbl (%rdi),%eax
+  800c49:	84 c0                	test   %al,%al
+  800c4b:	74 13                	je     800c60 <strcmp+0x1a>
+  800c4d:	38 06                	cmp    %al,(%rsi)
+  800c4f:	75 0f                	jne    800c60 <strcmp+0x1a>
+  800c51:	48 83 c7 01          	add    $0x1,%rdi
+  800c55:	48 83 c6 01          	add    $0x1,%rsi
+  800c59:	0f b6 07             	movzbl (%rdi),%eax
+  800c5c:	84 c0                	test   %al,%al
+  800c5e:	75 ed                	jne    800c4d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c60:	0f b6 c0             	movzbl %al,%eax
+  800c63:	0f b6 16             	movzbl (%rsi),%edx
+  800c66:	29 d0                	sub    %edx,%eax
+}
+  800c68:	c3                   	ret
+
+0000000000800c69 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c69:	48 85 d2             	test   %rdx,%rdx
+  800c6c:	74 1f                	je     800c8d <strncmp+0x24>
+  800c6e:	0f b6 07             	movzbl (%rdi),%eax
+  800c71:	84 c0                	test   %al,%al
+  800c73:	74 1e                	je     800c93 <strncmp+0x2a>
+  800c75:	3a 06                	cmp    (%rsi),%al
+  800c77:	75 1a                	jne    800c93 <strncmp+0x2a>
+  800c79:	48 83 c7 01          	add    $0x1,%rdi
+  800c7d:	48 83 c6 01          	add    $0x1,%rsi
+  800c81:	48 83 ea 01          	sub    $0x1,%rdx
+  800c85:	75 e7                	jne    800c6e <strncmp+0x5>
+
+    if (!n) return 0;
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8c:	c3                   	ret
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c92:	c3                   	ret
+  800c93:	48 85 d2             	test   %rdx,%rdx
+  800c96:	74 09                	je     800ca1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c98:	0f b6 07             	movzbl (%rdi),%eax
+  800c9b:	0f b6 16             	movzbl (%rsi),%edx
+  800c9e:	29 d0                	sub    %edx,%eax
+  800ca0:	c3                   	ret
+    if (!n) return 0;
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca6:	c3                   	ret
+
+0000000000800ca7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ca7:	0f b6 17             	movzbl (%rdi),%edx
+  800caa:	84 d2                	test   %dl,%dl
+  800cac:	74 18                	je     800cc6 <strchr+0x1f>
+        if (*str == c) {
+  800cae:	0f be d2             	movsbl %dl,%edx
+  800cb1:	39 f2                	cmp    %esi,%edx
+  800cb3:	74 17                	je     800ccc <strchr+0x25>
+    for (; *str; str++) {
+  800cb5:	48 83 c7 01          	add    $0x1,%rdi
+  800cb9:	0f b6 17             	movzbl (%rdi),%edx
+  800cbc:	84 d2                	test   %dl,%dl
+  800cbe:	75 ee                	jne    800cae <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc5:	c3                   	ret
+  800cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccb:	c3                   	ret
+  800ccc:	48 89 f8             	mov    %rdi,%rax
+}
+  800ccf:	c3                   	ret
+
+0000000000800cd0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cd0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cd3:	0f b6 17             	movzbl (%rdi),%edx
+  800cd6:	84 d2                	test   %dl,%dl
+  800cd8:	74 13                	je     800ced <strfind+0x1d>
+  800cda:	0f be d2             	movsbl %dl,%edx
+  800cdd:	39 f2                	cmp    %esi,%edx
+  800cdf:	74 0b                	je     800cec <strfind+0x1c>
+  800ce1:	48 83 c0 01          	add    $0x1,%rax
+  800ce5:	0f b6 10             	movzbl (%rax),%edx
+  800ce8:	84 d2                	test   %dl,%dl
+  800cea:	75 ee                	jne    800cda <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cec:	c3                   	ret
+  800ced:	c3                   	ret
+
+0000000000800cee <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cee:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cf1:	48 89 f8             	mov    %rdi,%rax
+  800cf4:	48 f7 d8             	neg    %rax
+  800cf7:	83 e0 07             	and    $0x7,%eax
+  800cfa:	49 89 d1             	mov    %rdx,%r9
+  800cfd:	49 29 c1             	sub    %rax,%r9
+  800d00:	78 36                	js     800d38 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d02:	40 0f b6 c6          	movzbl %sil,%eax
+  800d06:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d0d:	01 01 01 
+  800d10:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d14:	40 f6 c7 07          	test   $0x7,%dil
+  800d18:	75 38                	jne    800d52 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d1a:	4c 89 c9             	mov    %r9,%rcx
+  800d1d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d21:	74 0c                	je     800d2f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d23:	fc                   	cld
+  800d24:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d27:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d2b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d2f:	4d 85 c9             	test   %r9,%r9
+  800d32:	75 45                	jne    800d79 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d34:	4c 89 c0             	mov    %r8,%rax
+  800d37:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d38:	48 85 d2             	test   %rdx,%rdx
+  800d3b:	74 f7                	je     800d34 <memset+0x46>
+  800d3d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d40:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d43:	48 83 c0 01          	add    $0x1,%rax
+  800d47:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d4b:	48 39 c2             	cmp    %rax,%rdx
+  800d4e:	75 f3                	jne    800d43 <memset+0x55>
+  800d50:	eb e2                	jmp    800d34 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d52:	40 f6 c7 01          	test   $0x1,%dil
+  800d56:	74 06                	je     800d5e <memset+0x70>
+  800d58:	88 07                	mov    %al,(%rdi)
+  800d5a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d5e:	40 f6 c7 02          	test   $0x2,%dil
+  800d62:	74 07                	je     800d6b <memset+0x7d>
+  800d64:	66 89 07             	mov    %ax,(%rdi)
+  800d67:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d6b:	40 f6 c7 04          	test   $0x4,%dil
+  800d6f:	74 a9                	je     800d1a <memset+0x2c>
+  800d71:	89 07                	mov    %eax,(%rdi)
+  800d73:	48 83 c7 04          	add    $0x4,%rdi
+  800d77:	eb a1                	jmp    800d1a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d79:	41 f6 c1 04          	test   $0x4,%r9b
+  800d7d:	74 06                	je     800d85 <memset+0x97>
+  800d7f:	89 07                	mov    %eax,(%rdi)
+  800d81:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d85:	41 f6 c1 02          	test   $0x2,%r9b
+  800d89:	74 07                	je     800d92 <memset+0xa4>
+  800d8b:	66 89 07             	mov    %ax,(%rdi)
+  800d8e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d92:	41 f6 c1 01          	test   $0x1,%r9b
+  800d96:	74 9c                	je     800d34 <memset+0x46>
+  800d98:	88 07                	mov    %al,(%rdi)
+  800d9a:	eb 98                	jmp    800d34 <memset+0x46>
+
+0000000000800d9c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d9c:	48 89 f8             	mov    %rdi,%rax
+  800d9f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800da2:	48 39 fe             	cmp    %rdi,%rsi
+  800da5:	73 3b                	jae    800de2 <memmove+0x46>
+  800da7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dab:	48 39 d7             	cmp    %rdx,%rdi
+  800dae:	73 32                	jae    800de2 <memmove+0x46>
+        s += n;
+        d += n;
+  800db0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800db4:	48 89 d6             	mov    %rdx,%rsi
+  800db7:	48 09 fe             	or     %rdi,%rsi
+  800dba:	48 09 ce             	or     %rcx,%rsi
+  800dbd:	40 f6 c6 07          	test   $0x7,%sil
+  800dc1:	75 12                	jne    800dd5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dc3:	48 83 ef 08          	sub    $0x8,%rdi
+  800dc7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dcb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dcf:	fd                   	std
+  800dd0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dd3:	fc                   	cld
+  800dd4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dd5:	48 83 ef 01          	sub    $0x1,%rdi
+  800dd9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ddd:	fd                   	std
+  800dde:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800de0:	eb f1                	jmp    800dd3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de2:	48 89 f2             	mov    %rsi,%rdx
+  800de5:	48 09 c2             	or     %rax,%rdx
+  800de8:	48 09 ca             	or     %rcx,%rdx
+  800deb:	f6 c2 07             	test   $0x7,%dl
+  800dee:	75 0c                	jne    800dfc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800df0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df4:	48 89 c7             	mov    %rax,%rdi
+  800df7:	fc                   	cld
+  800df8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dfb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800dfc:	48 89 c7             	mov    %rax,%rdi
+  800dff:	fc                   	cld
+  800e00:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e02:	c3                   	ret
+
+0000000000800e03 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e03:	55                   	push   %rbp
+  800e04:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e07:	48 b8 9c 0d 80 00 00 	movabs $0x800d9c,%rax
+  800e0e:	00 00 00 
+  800e11:	ff d0                	call   *%rax
+}
+  800e13:	5d                   	pop    %rbp
+  800e14:	c3                   	ret
+
+0000000000800e15 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e15:	55                   	push   %rbp
+  800e16:	48 89 e5             	mov    %rsp,%rbp
+  800e19:	41 57                	push   %r15
+  800e1b:	41 56                	push   %r14
+  800e1d:	41 55                	push   %r13
+  800e1f:	41 54                	push   %r12
+  800e21:	53                   	push   %rbx
+  800e22:	48 83 ec 08          	sub    $0x8,%rsp
+  800e26:	49 89 fe             	mov    %rdi,%r14
+  800e29:	49 89 f7             	mov    %rsi,%r15
+  800e2c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e2f:	48 89 f7             	mov    %rsi,%rdi
+  800e32:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800e39:	00 00 00 
+  800e3c:	ff d0                	call   *%rax
+  800e3e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e41:	48 89 de             	mov    %rbx,%rsi
+  800e44:	4c 89 f7             	mov    %r14,%rdi
+  800e47:	48 b8 7f 0b 80 00 00 	movabs $0x800b7f,%rax
+  800e4e:	00 00 00 
+  800e51:	ff d0                	call   *%rax
+  800e53:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e56:	48 39 c3             	cmp    %rax,%rbx
+  800e59:	74 36                	je     800e91 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e5b:	48 89 d8             	mov    %rbx,%rax
+  800e5e:	4c 29 e8             	sub    %r13,%rax
+  800e61:	49 39 c4             	cmp    %rax,%r12
+  800e64:	73 31                	jae    800e97 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e66:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e6b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e6f:	4c 89 fe             	mov    %r15,%rsi
+  800e72:	48 b8 03 0e 80 00 00 	movabs $0x800e03,%rax
+  800e79:	00 00 00 
+  800e7c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e7e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e82:	48 83 c4 08          	add    $0x8,%rsp
+  800e86:	5b                   	pop    %rbx
+  800e87:	41 5c                	pop    %r12
+  800e89:	41 5d                	pop    %r13
+  800e8b:	41 5e                	pop    %r14
+  800e8d:	41 5f                	pop    %r15
+  800e8f:	5d                   	pop    %rbp
+  800e90:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e91:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e95:	eb eb                	jmp    800e82 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e97:	48 83 eb 01          	sub    $0x1,%rbx
+  800e9b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e9f:	48 89 da             	mov    %rbx,%rdx
+  800ea2:	4c 89 fe             	mov    %r15,%rsi
+  800ea5:	48 b8 03 0e 80 00 00 	movabs $0x800e03,%rax
+  800eac:	00 00 00 
+  800eaf:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eb1:	49 01 de             	add    %rbx,%r14
+  800eb4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800eb9:	eb c3                	jmp    800e7e <strlcat+0x69>
+
+0000000000800ebb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ebb:	48 85 d2             	test   %rdx,%rdx
+  800ebe:	74 2d                	je     800eed <memcmp+0x32>
+  800ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ec5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ec9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ece:	44 38 c1             	cmp    %r8b,%cl
+  800ed1:	75 0f                	jne    800ee2 <memcmp+0x27>
+    while (n-- > 0) {
+  800ed3:	48 83 c0 01          	add    $0x1,%rax
+  800ed7:	48 39 c2             	cmp    %rax,%rdx
+  800eda:	75 e9                	jne    800ec5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ee2:	0f b6 c1             	movzbl %cl,%eax
+  800ee5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ee9:	44 29 c0             	sub    %r8d,%eax
+  800eec:	c3                   	ret
+    return 0;
+  800eed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef2:	c3                   	ret
+
+0000000000800ef3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ef3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ef7:	48 39 c7             	cmp    %rax,%rdi
+  800efa:	73 0f                	jae    800f0b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800efc:	40 38 37             	cmp    %sil,(%rdi)
+  800eff:	74 0e                	je     800f0f <memfind+0x1c>
+    for (; src < end; src++) {
+  800f01:	48 83 c7 01          	add    $0x1,%rdi
+  800f05:	48 39 f8             	cmp    %rdi,%rax
+  800f08:	75 f2                	jne    800efc <memfind+0x9>
+  800f0a:	c3                   	ret
+  800f0b:	48 89 f8             	mov    %rdi,%rax
+  800f0e:	c3                   	ret
+  800f0f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f12:	c3                   	ret
+
+0000000000800f13 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f13:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f16:	0f b6 37             	movzbl (%rdi),%esi
+  800f19:	40 80 fe 20          	cmp    $0x20,%sil
+  800f1d:	74 06                	je     800f25 <strtol+0x12>
+  800f1f:	40 80 fe 09          	cmp    $0x9,%sil
+  800f23:	75 13                	jne    800f38 <strtol+0x25>
+  800f25:	48 83 c7 01          	add    $0x1,%rdi
+  800f29:	0f b6 37             	movzbl (%rdi),%esi
+  800f2c:	40 80 fe 20          	cmp    $0x20,%sil
+  800f30:	74 f3                	je     800f25 <strtol+0x12>
+  800f32:	40 80 fe 09          	cmp    $0x9,%sil
+  800f36:	74 ed                	je     800f25 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f38:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f3b:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f3e:	3c 01                	cmp    $0x1,%al
+  800f40:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f44:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f4a:	75 0f                	jne    800f5b <strtol+0x48>
+  800f4c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f4f:	74 14                	je     800f65 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f51:	85 d2                	test   %edx,%edx
+  800f53:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f58:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f60:	4c 63 ca             	movslq %edx,%r9
+  800f63:	eb 36                	jmp    800f9b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f65:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f69:	74 0f                	je     800f7a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f6b:	85 d2                	test   %edx,%edx
+  800f6d:	75 ec                	jne    800f5b <strtol+0x48>
+        s++;
+  800f6f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f73:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f78:	eb e1                	jmp    800f5b <strtol+0x48>
+        s += 2;
+  800f7a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f7e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f83:	eb d6                	jmp    800f5b <strtol+0x48>
+            dig -= '0';
+  800f85:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f88:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f8c:	41 39 d0             	cmp    %edx,%r8d
+  800f8f:	7d 21                	jge    800fb2 <strtol+0x9f>
+        val = val * base + dig;
+  800f91:	49 0f af c1          	imul   %r9,%rax
+  800f95:	0f b6 c9             	movzbl %cl,%ecx
+  800f98:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f9b:	48 83 c7 01          	add    $0x1,%rdi
+  800f9f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fa3:	80 f9 39             	cmp    $0x39,%cl
+  800fa6:	76 dd                	jbe    800f85 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fa8:	80 f9 7b             	cmp    $0x7b,%cl
+  800fab:	77 05                	ja     800fb2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fad:	83 e9 57             	sub    $0x57,%ecx
+  800fb0:	eb d6                	jmp    800f88 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fb2:	4d 85 d2             	test   %r10,%r10
+  800fb5:	74 03                	je     800fba <strtol+0xa7>
+  800fb7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fba:	48 89 c2             	mov    %rax,%rdx
+  800fbd:	48 f7 da             	neg    %rdx
+  800fc0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fc4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fc8:	c3                   	ret
+
+0000000000800fc9 <strrev>:
+
+void
+strrev(char *str)
+{
+  800fc9:	55                   	push   %rbp
+  800fca:	48 89 e5             	mov    %rsp,%rbp
+  800fcd:	53                   	push   %rbx
+  800fce:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd2:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fd5:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fe1:	83 e8 01             	sub    $0x1,%eax
+  800fe4:	85 c0                	test   %eax,%eax
+  800fe6:	7e 22                	jle    80100a <strrev+0x41>
+  800fe8:	48 98                	cltq
+  800fea:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800fef:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800ff3:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800ff7:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800ffb:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800ffe:	48 83 c2 01          	add    $0x1,%rdx
+  801002:	48 83 e8 01          	sub    $0x1,%rax
+  801006:	39 c2                	cmp    %eax,%edx
+  801008:	7c e5                	jl     800fef <strrev+0x26>
+	}
+}
+  80100a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100e:	c9                   	leave
+  80100f:	c3                   	ret
+
+0000000000801010 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801010:	85 d2                	test   %edx,%edx
+  801012:	0f 84 80 00 00 00    	je     801098 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801018:	55                   	push   %rbp
+  801019:	48 89 e5             	mov    %rsp,%rbp
+  80101c:	53                   	push   %rbx
+  80101d:	48 83 ec 08          	sub    $0x8,%rsp
+  801021:	49 89 f2             	mov    %rsi,%r10
+  801024:	41 89 d3             	mov    %edx,%r11d
+  801027:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  80102a:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80102f:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801032:	eb 20                	jmp    801054 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801034:	41 89 f1             	mov    %esi,%r9d
+  801037:	83 c2 30             	add    $0x30,%edx
+  80103a:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80103d:	89 f8                	mov    %edi,%eax
+  80103f:	99                   	cltd
+  801040:	f7 f9                	idiv   %ecx
+  801042:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801044:	85 c0                	test   %eax,%eax
+  801046:	74 2e                	je     801076 <itoa+0x66>
+  801048:	83 c6 01             	add    $0x1,%esi
+  80104b:	49 83 c0 01          	add    $0x1,%r8
+  80104f:	44 39 cb             	cmp    %r9d,%ebx
+  801052:	7e 15                	jle    801069 <itoa+0x59>
+		digit = sum % base;
+  801054:	89 f8                	mov    %edi,%eax
+  801056:	99                   	cltd
+  801057:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801059:	83 fa 09             	cmp    $0x9,%edx
+  80105c:	7e d6                	jle    801034 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80105e:	41 89 f1             	mov    %esi,%r9d
+  801061:	83 c2 37             	add    $0x37,%edx
+  801064:	41 88 10             	mov    %dl,(%r8)
+  801067:	eb d4                	jmp    80103d <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801069:	41 83 eb 01          	sub    $0x1,%r11d
+  80106d:	45 39 cb             	cmp    %r9d,%r11d
+  801070:	75 04                	jne    801076 <itoa+0x66>
+  801072:	85 c0                	test   %eax,%eax
+  801074:	75 28                	jne    80109e <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801076:	4d 63 c9             	movslq %r9d,%r9
+  801079:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80107e:	4c 89 d7             	mov    %r10,%rdi
+  801081:	48 b8 c9 0f 80 00 00 	movabs $0x800fc9,%rax
+  801088:	00 00 00 
+  80108b:	ff d0                	call   *%rax
+	return 0;
+  80108d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801092:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+		return -1;
+  801098:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80109d:	c3                   	ret
+		return -1;
+  80109e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010a3:	eb ed                	jmp    801092 <itoa+0x82>
+
+00000000008010a5 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010a5:	55                   	push   %rbp
+  8010a6:	48 89 e5             	mov    %rsp,%rbp
+  8010a9:	53                   	push   %rbx
+  8010aa:	48 89 fa             	mov    %rdi,%rdx
+  8010ad:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b0:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ca:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d0:	c9                   	leave
+  8010d1:	c3                   	ret
+
+00000000008010d2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010d2:	55                   	push   %rbp
+  8010d3:	48 89 e5             	mov    %rsp,%rbp
+  8010d6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010fb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801101:	c9                   	leave
+  801102:	c3                   	ret
+
+0000000000801103 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801103:	55                   	push   %rbp
+  801104:	48 89 e5             	mov    %rsp,%rbp
+  801107:	53                   	push   %rbx
+  801108:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80110c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80110f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801114:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801119:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801123:	be 00 00 00 00       	mov    $0x0,%esi
+  801128:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801130:	48 85 c0             	test   %rax,%rax
+  801133:	7f 06                	jg     80113b <sys_env_destroy+0x38>
+}
+  801135:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801139:	c9                   	leave
+  80113a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80113b:	49 89 c0             	mov    %rax,%r8
+  80113e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801143:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  80114a:	00 00 00 
+  80114d:	be 26 00 00 00       	mov    $0x26,%esi
+  801152:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  801159:	00 00 00 
+  80115c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801161:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  801168:	00 00 00 
+  80116b:	41 ff d1             	call   *%r9
+
+000000000080116e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80116e:	55                   	push   %rbp
+  80116f:	48 89 e5             	mov    %rsp,%rbp
+  801172:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801173:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801187:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118c:	be 00 00 00 00       	mov    $0x0,%esi
+  801191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801197:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801199:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119d:	c9                   	leave
+  80119e:	c3                   	ret
+
+000000000080119f <sys_yield>:
+
+void
+sys_yield(void) {
+  80119f:	55                   	push   %rbp
+  8011a0:	48 89 e5             	mov    %rsp,%rbp
+  8011a3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ce:	c9                   	leave
+  8011cf:	c3                   	ret
+
+00000000008011d0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011d0:	55                   	push   %rbp
+  8011d1:	48 89 e5             	mov    %rsp,%rbp
+  8011d4:	53                   	push   %rbx
+  8011d5:	48 89 fa             	mov    %rdi,%rdx
+  8011d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011db:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011e7:	00 00 00 
+  8011ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fa:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801200:	c9                   	leave
+  801201:	c3                   	ret
+
+0000000000801202 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801202:	55                   	push   %rbp
+  801203:	48 89 e5             	mov    %rsp,%rbp
+  801206:	53                   	push   %rbx
+  801207:	49 89 f8             	mov    %rdi,%r8
+  80120a:	48 89 d3             	mov    %rdx,%rbx
+  80120d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801210:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801215:	4c 89 c2             	mov    %r8,%rdx
+  801218:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801226:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+000000000080122e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80122e:	55                   	push   %rbp
+  80122f:	48 89 e5             	mov    %rsp,%rbp
+  801232:	53                   	push   %rbx
+  801233:	48 83 ec 08          	sub    $0x8,%rsp
+  801237:	89 f8                	mov    %edi,%eax
+  801239:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80123c:	48 63 f9             	movslq %ecx,%rdi
+  80123f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801242:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801247:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124a:	be 00 00 00 00       	mov    $0x0,%esi
+  80124f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801255:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801257:	48 85 c0             	test   %rax,%rax
+  80125a:	7f 06                	jg     801262 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80125c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801260:	c9                   	leave
+  801261:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801262:	49 89 c0             	mov    %rax,%r8
+  801265:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80126a:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  801271:	00 00 00 
+  801274:	be 26 00 00 00       	mov    $0x26,%esi
+  801279:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  801280:	00 00 00 
+  801283:	b8 00 00 00 00       	mov    $0x0,%eax
+  801288:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  80128f:	00 00 00 
+  801292:	41 ff d1             	call   *%r9
+
+0000000000801295 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	53                   	push   %rbx
+  80129a:	48 83 ec 08          	sub    $0x8,%rsp
+  80129e:	89 f8                	mov    %edi,%eax
+  8012a0:	49 89 f2             	mov    %rsi,%r10
+  8012a3:	48 89 cf             	mov    %rcx,%rdi
+  8012a6:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012a9:	48 63 da             	movslq %edx,%rbx
+  8012ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012af:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b7:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012bc:	48 85 c0             	test   %rax,%rax
+  8012bf:	7f 06                	jg     8012c7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c7:	49 89 c0             	mov    %rax,%r8
+  8012ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012cf:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  8012d6:	00 00 00 
+  8012d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8012de:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  8012e5:	00 00 00 
+  8012e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ed:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  8012f4:	00 00 00 
+  8012f7:	41 ff d1             	call   *%r9
+
+00000000008012fa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012fa:	55                   	push   %rbp
+  8012fb:	48 89 e5             	mov    %rsp,%rbp
+  8012fe:	53                   	push   %rbx
+  8012ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801303:	48 89 f1             	mov    %rsi,%rcx
+  801306:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801309:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80130c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801311:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801316:	be 00 00 00 00       	mov    $0x0,%esi
+  80131b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801321:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801323:	48 85 c0             	test   %rax,%rax
+  801326:	7f 06                	jg     80132e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801328:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132e:	49 89 c0             	mov    %rax,%r8
+  801331:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801336:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  80133d:	00 00 00 
+  801340:	be 26 00 00 00       	mov    $0x26,%esi
+  801345:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  80134c:	00 00 00 
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801354:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  80135b:	00 00 00 
+  80135e:	41 ff d1             	call   *%r9
+
+0000000000801361 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	53                   	push   %rbx
+  801366:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80136a:	48 63 ce             	movslq %esi,%rcx
+  80136d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801370:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137f:	be 00 00 00 00       	mov    $0x0,%esi
+  801384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138c:	48 85 c0             	test   %rax,%rax
+  80138f:	7f 06                	jg     801397 <sys_env_set_status+0x36>
+}
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801397:	49 89 c0             	mov    %rax,%r8
+  80139a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80139f:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  8013a6:	00 00 00 
+  8013a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ae:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  8013b5:	00 00 00 
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bd:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  8013c4:	00 00 00 
+  8013c7:	41 ff d1             	call   *%r9
+
+00000000008013ca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	53                   	push   %rbx
+  8013cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f5:	48 85 c0             	test   %rax,%rax
+  8013f8:	7f 06                	jg     801400 <sys_env_set_trapframe+0x36>
+}
+  8013fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801400:	49 89 c0             	mov    %rax,%r8
+  801403:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801408:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  80140f:	00 00 00 
+  801412:	be 26 00 00 00       	mov    $0x26,%esi
+  801417:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  80141e:	00 00 00 
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+
+0000000000801433 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801433:	55                   	push   %rbp
+  801434:	48 89 e5             	mov    %rsp,%rbp
+  801437:	53                   	push   %rbx
+  801438:	48 83 ec 08          	sub    $0x8,%rsp
+  80143c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80143f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801442:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801447:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145e:	48 85 c0             	test   %rax,%rax
+  801461:	7f 06                	jg     801469 <sys_env_set_pgfault_upcall+0x36>
+}
+  801463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801467:	c9                   	leave
+  801468:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801469:	49 89 c0             	mov    %rax,%r8
+  80146c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801471:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  801478:	00 00 00 
+  80147b:	be 26 00 00 00       	mov    $0x26,%esi
+  801480:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  801487:	00 00 00 
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  801496:	00 00 00 
+  801499:	41 ff d1             	call   *%r9
+
+000000000080149c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	53                   	push   %rbx
+  8014a1:	89 f8                	mov    %edi,%eax
+  8014a3:	49 89 f1             	mov    %rsi,%r9
+  8014a6:	48 89 d3             	mov    %rdx,%rbx
+  8014a9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014ac:	49 63 f0             	movslq %r8d,%rsi
+  8014af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c0:	cd 30                	int    $0x30
+}
+  8014c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+
+00000000008014c8 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d1:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014d4:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014dc:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f1:	48 85 c0             	test   %rax,%rax
+  8014f4:	7f 06                	jg     8014fc <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fc:	49 89 c0             	mov    %rax,%r8
+  8014ff:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801504:	48 ba a8 3c 80 00 00 	movabs $0x803ca8,%rdx
+  80150b:	00 00 00 
+  80150e:	be 26 00 00 00       	mov    $0x26,%esi
+  801513:	48 bf c7 3c 80 00 00 	movabs $0x803cc7,%rdi
+  80151a:	00 00 00 
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801522:	49 b9 a6 36 80 00 00 	movabs $0x8036a6,%r9
+  801529:	00 00 00 
+  80152c:	41 ff d1             	call   *%r9
+
+000000000080152f <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801533:	ba 00 00 00 00       	mov    $0x0,%edx
+  801538:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+}
+  801544:	5d                   	pop    %rbp
+  801545:	c3                   	ret
+
+0000000000801546 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801546:	55                   	push   %rbp
+  801547:	48 89 e5             	mov    %rsp,%rbp
+  80154a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80154b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801550:	ba 00 00 00 00       	mov    $0x0,%edx
+  801555:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801564:	be 00 00 00 00       	mov    $0x0,%esi
+  801569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801571:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801575:	c9                   	leave
+  801576:	c3                   	ret
+
+0000000000801577 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801577:	55                   	push   %rbp
+  801578:	48 89 e5             	mov    %rsp,%rbp
+  80157b:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80157c:	48 63 ce             	movslq %esi,%rcx
+  80157f:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801583:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801592:	be 00 00 00 00       	mov    $0x0,%esi
+  801597:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159d:	cd 30                	int    $0x30
+}
+  80159f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a3:	c9                   	leave
+  8015a4:	c3                   	ret
+
+00000000008015a5 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015a5:	55                   	push   %rbp
+  8015a6:	48 89 e5             	mov    %rsp,%rbp
+  8015a9:	53                   	push   %rbx
+  8015aa:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015ad:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cb:	cd 30                	int    $0x30
+}
+  8015cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+00000000008015d3 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	53                   	push   %rbx
+  8015d8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015db:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015de:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e3:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f6:	cd 30                	int    $0x30
+}
+  8015f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fc:	c9                   	leave
+  8015fd:	c3                   	ret
+
+00000000008015fe <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	41 55                	push   %r13
+  801604:	41 54                	push   %r12
+  801606:	53                   	push   %rbx
+  801607:	48 83 ec 08          	sub    $0x8,%rsp
+  80160b:	49 89 fc             	mov    %rdi,%r12
+  80160e:	48 89 f7             	mov    %rsi,%rdi
+  801611:	48 89 d3             	mov    %rdx,%rbx
+  801614:	49 89 cd             	mov    %rcx,%r13
+  801617:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80161a:	48 85 f6             	test   %rsi,%rsi
+  80161d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801624:	00 00 00 
+  801627:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80162b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801630:	48 85 db             	test   %rbx,%rbx
+  801633:	74 03                	je     801638 <ipc_recv_timed+0x3a>
+  801635:	48 8b 33             	mov    (%rbx),%rsi
+  801638:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  80163f:	00 00 00 
+  801642:	ff d0                	call   *%rax
+    if (res < 0) {
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 75                	js     8016bd <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  801648:	4d 85 e4             	test   %r12,%r12
+  80164b:	74 14                	je     801661 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80164d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801654:	00 00 00 
+  801657:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80165d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  801661:	4d 85 ed             	test   %r13,%r13
+  801664:	74 14                	je     80167a <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  801666:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80166d:	00 00 00 
+  801670:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  801676:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80167a:	48 85 db             	test   %rbx,%rbx
+  80167d:	74 23                	je     8016a2 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80167f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801686:	00 00 00 
+  801689:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80168f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801694:	85 c9                	test   %ecx,%ecx
+  801696:	74 07                	je     80169f <ipc_recv_timed+0xa1>
+  801698:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80169f:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8016a2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8016a9:	00 00 00 
+  8016ac:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8016b2:	48 83 c4 08          	add    $0x8,%rsp
+  8016b6:	5b                   	pop    %rbx
+  8016b7:	41 5c                	pop    %r12
+  8016b9:	41 5d                	pop    %r13
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+        if (from_env_store != NULL) {
+  8016bd:	4d 85 e4             	test   %r12,%r12
+  8016c0:	74 08                	je     8016ca <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8016c2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8016c9:	00 
+        if (perm_store != NULL) {
+  8016ca:	4d 85 ed             	test   %r13,%r13
+  8016cd:	74 08                	je     8016d7 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8016cf:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8016d6:	00 
+        if (size != NULL) {
+  8016d7:	48 85 db             	test   %rbx,%rbx
+  8016da:	74 d6                	je     8016b2 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8016dc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8016e3:	eb cd                	jmp    8016b2 <ipc_recv_timed+0xb4>
+
+00000000008016e5 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8016e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ef:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+}
+  8016fb:	5d                   	pop    %rbp
+  8016fc:	c3                   	ret
+
+00000000008016fd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8016fd:	55                   	push   %rbp
+  8016fe:	48 89 e5             	mov    %rsp,%rbp
+  801701:	41 57                	push   %r15
+  801703:	41 56                	push   %r14
+  801705:	41 55                	push   %r13
+  801707:	41 54                	push   %r12
+  801709:	53                   	push   %rbx
+  80170a:	48 83 ec 18          	sub    $0x18,%rsp
+  80170e:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  801711:	48 89 d3             	mov    %rdx,%rbx
+  801714:	49 89 cc             	mov    %rcx,%r12
+  801717:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80171a:	48 85 d2             	test   %rdx,%rdx
+  80171d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801724:	00 00 00 
+  801727:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80172b:	89 f0                	mov    %esi,%eax
+  80172d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801731:	48 89 da             	mov    %rbx,%rdx
+  801734:	48 89 c6             	mov    %rax,%rsi
+  801737:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  80173e:	00 00 00 
+  801741:	ff d0                	call   *%rax
+    while (res < 0) {
+  801743:	85 c0                	test   %eax,%eax
+  801745:	79 65                	jns    8017ac <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  801747:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80174a:	75 33                	jne    80177f <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80174c:	49 bf 9f 11 80 00 00 	movabs $0x80119f,%r15
+  801753:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801756:	49 be 9c 14 80 00 00 	movabs $0x80149c,%r14
+  80175d:	00 00 00 
+        sys_yield();
+  801760:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801763:	45 89 e8             	mov    %r13d,%r8d
+  801766:	4c 89 e1             	mov    %r12,%rcx
+  801769:	48 89 da             	mov    %rbx,%rdx
+  80176c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801770:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  801773:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  801776:	85 c0                	test   %eax,%eax
+  801778:	79 32                	jns    8017ac <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80177a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80177d:	74 e1                	je     801760 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80177f:	89 c1                	mov    %eax,%ecx
+  801781:	48 ba d5 3c 80 00 00 	movabs $0x803cd5,%rdx
+  801788:	00 00 00 
+  80178b:	be 52 00 00 00       	mov    $0x52,%esi
+  801790:	48 bf e9 3c 80 00 00 	movabs $0x803ce9,%rdi
+  801797:	00 00 00 
+  80179a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179f:	49 b8 a6 36 80 00 00 	movabs $0x8036a6,%r8
+  8017a6:	00 00 00 
+  8017a9:	41 ff d0             	call   *%r8
+    }
+}
+  8017ac:	48 83 c4 18          	add    $0x18,%rsp
+  8017b0:	5b                   	pop    %rbx
+  8017b1:	41 5c                	pop    %r12
+  8017b3:	41 5d                	pop    %r13
+  8017b5:	41 5e                	pop    %r14
+  8017b7:	41 5f                	pop    %r15
+  8017b9:	5d                   	pop    %rbp
+  8017ba:	c3                   	ret
+
+00000000008017bb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8017c0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8017c7:	00 00 00 
+  8017ca:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017ce:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8017d2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017d6:	48 01 ca             	add    %rcx,%rdx
+  8017d9:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8017df:	39 fa                	cmp    %edi,%edx
+  8017e1:	74 12                	je     8017f5 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8017e3:	48 83 c0 01          	add    $0x1,%rax
+  8017e7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8017ed:	75 db                	jne    8017ca <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8017ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f4:	c3                   	ret
+            return envs[i].env_id;
+  8017f5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017f9:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8017fd:	48 c1 e2 04          	shl    $0x4,%rdx
+  801801:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  801808:	00 00 00 
+  80180b:	48 01 d0             	add    %rdx,%rax
+  80180e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801814:	c3                   	ret
+
+0000000000801815 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801815:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80181c:	ff ff ff 
+  80181f:	48 01 f8             	add    %rdi,%rax
+  801822:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801826:	c3                   	ret
+
+0000000000801827 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801827:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80182e:	ff ff ff 
+  801831:	48 01 f8             	add    %rdi,%rax
+  801834:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801838:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80183e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801842:	c3                   	ret
+
+0000000000801843 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+  801847:	41 57                	push   %r15
+  801849:	41 56                	push   %r14
+  80184b:	41 55                	push   %r13
+  80184d:	41 54                	push   %r12
+  80184f:	53                   	push   %rbx
+  801850:	48 83 ec 08          	sub    $0x8,%rsp
+  801854:	49 89 ff             	mov    %rdi,%r15
+  801857:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80185c:	49 bd 62 33 80 00 00 	movabs $0x803362,%r13
+  801863:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801866:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80186c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80186f:	48 89 df             	mov    %rbx,%rdi
+  801872:	41 ff d5             	call   *%r13
+  801875:	83 e0 04             	and    $0x4,%eax
+  801878:	74 17                	je     801891 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80187a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801881:	4c 39 f3             	cmp    %r14,%rbx
+  801884:	75 e6                	jne    80186c <fd_alloc+0x29>
+  801886:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80188c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801891:	4d 89 27             	mov    %r12,(%r15)
+}
+  801894:	48 83 c4 08          	add    $0x8,%rsp
+  801898:	5b                   	pop    %rbx
+  801899:	41 5c                	pop    %r12
+  80189b:	41 5d                	pop    %r13
+  80189d:	41 5e                	pop    %r14
+  80189f:	41 5f                	pop    %r15
+  8018a1:	5d                   	pop    %rbp
+  8018a2:	c3                   	ret
+
+00000000008018a3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018a3:	83 ff 1f             	cmp    $0x1f,%edi
+  8018a6:	77 39                	ja     8018e1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018a8:	55                   	push   %rbp
+  8018a9:	48 89 e5             	mov    %rsp,%rbp
+  8018ac:	41 54                	push   %r12
+  8018ae:	53                   	push   %rbx
+  8018af:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018b2:	48 63 df             	movslq %edi,%rbx
+  8018b5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018bc:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018c0:	48 89 df             	mov    %rbx,%rdi
+  8018c3:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	a8 04                	test   $0x4,%al
+  8018d1:	74 14                	je     8018e7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018d3:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018dc:	5b                   	pop    %rbx
+  8018dd:	41 5c                	pop    %r12
+  8018df:	5d                   	pop    %rbp
+  8018e0:	c3                   	ret
+        return -E_INVAL;
+  8018e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018e6:	c3                   	ret
+        return -E_INVAL;
+  8018e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ec:	eb ee                	jmp    8018dc <fd_lookup+0x39>
+
+00000000008018ee <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 54                	push   %r12
+  8018f4:	53                   	push   %rbx
+  8018f5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018f8:	48 b8 a0 3d 80 00 00 	movabs $0x803da0,%rax
+  8018ff:	00 00 00 
+  801902:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801909:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80190c:	39 3b                	cmp    %edi,(%rbx)
+  80190e:	74 47                	je     801957 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801910:	48 83 c0 08          	add    $0x8,%rax
+  801914:	48 8b 18             	mov    (%rax),%rbx
+  801917:	48 85 db             	test   %rbx,%rbx
+  80191a:	75 f0                	jne    80190c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80191c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801923:	00 00 00 
+  801926:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80192c:	89 fa                	mov    %edi,%edx
+  80192e:	48 bf f8 3c 80 00 00 	movabs $0x803cf8,%rdi
+  801935:	00 00 00 
+  801938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193d:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  801944:	00 00 00 
+  801947:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80194e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801952:	5b                   	pop    %rbx
+  801953:	41 5c                	pop    %r12
+  801955:	5d                   	pop    %rbp
+  801956:	c3                   	ret
+            return 0;
+  801957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195c:	eb f0                	jmp    80194e <dev_lookup+0x60>
+
+000000000080195e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80195e:	55                   	push   %rbp
+  80195f:	48 89 e5             	mov    %rsp,%rbp
+  801962:	41 55                	push   %r13
+  801964:	41 54                	push   %r12
+  801966:	53                   	push   %rbx
+  801967:	48 83 ec 18          	sub    $0x18,%rsp
+  80196b:	48 89 fb             	mov    %rdi,%rbx
+  80196e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801971:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801978:	ff ff ff 
+  80197b:	48 01 df             	add    %rbx,%rdi
+  80197e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801982:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801986:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+  801992:	41 89 c5             	mov    %eax,%r13d
+  801995:	85 c0                	test   %eax,%eax
+  801997:	78 06                	js     80199f <fd_close+0x41>
+  801999:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80199d:	74 1a                	je     8019b9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80199f:	45 84 e4             	test   %r12b,%r12b
+  8019a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019ab:	44 89 e8             	mov    %r13d,%eax
+  8019ae:	48 83 c4 18          	add    $0x18,%rsp
+  8019b2:	5b                   	pop    %rbx
+  8019b3:	41 5c                	pop    %r12
+  8019b5:	41 5d                	pop    %r13
+  8019b7:	5d                   	pop    %rbp
+  8019b8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019b9:	8b 3b                	mov    (%rbx),%edi
+  8019bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019bf:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+  8019cb:	41 89 c5             	mov    %eax,%r13d
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 1b                	js     8019ed <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019d6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8019da:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019e0:	48 85 c0             	test   %rax,%rax
+  8019e3:	74 08                	je     8019ed <fd_close+0x8f>
+  8019e5:	48 89 df             	mov    %rbx,%rdi
+  8019e8:	ff d0                	call   *%rax
+  8019ea:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019f2:	48 89 de             	mov    %rbx,%rsi
+  8019f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019fa:	48 b8 fa 12 80 00 00 	movabs $0x8012fa,%rax
+  801a01:	00 00 00 
+  801a04:	ff d0                	call   *%rax
+    return res;
+  801a06:	eb a3                	jmp    8019ab <fd_close+0x4d>
+
+0000000000801a08 <close>:
+
+int
+close(int fdnum) {
+  801a08:	55                   	push   %rbp
+  801a09:	48 89 e5             	mov    %rsp,%rbp
+  801a0c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a10:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a14:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801a1b:	00 00 00 
+  801a1e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 15                	js     801a39 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a24:	be 01 00 00 00       	mov    $0x1,%esi
+  801a29:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a2d:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  801a34:	00 00 00 
+  801a37:	ff d0                	call   *%rax
+}
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+0000000000801a3b <close_all>:
+
+void
+close_all(void) {
+  801a3b:	55                   	push   %rbp
+  801a3c:	48 89 e5             	mov    %rsp,%rbp
+  801a3f:	41 54                	push   %r12
+  801a41:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a47:	49 bc 08 1a 80 00 00 	movabs $0x801a08,%r12
+  801a4e:	00 00 00 
+  801a51:	89 df                	mov    %ebx,%edi
+  801a53:	41 ff d4             	call   *%r12
+  801a56:	83 c3 01             	add    $0x1,%ebx
+  801a59:	83 fb 20             	cmp    $0x20,%ebx
+  801a5c:	75 f3                	jne    801a51 <close_all+0x16>
+}
+  801a5e:	5b                   	pop    %rbx
+  801a5f:	41 5c                	pop    %r12
+  801a61:	5d                   	pop    %rbp
+  801a62:	c3                   	ret
+
+0000000000801a63 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	41 57                	push   %r15
+  801a69:	41 56                	push   %r14
+  801a6b:	41 55                	push   %r13
+  801a6d:	41 54                	push   %r12
+  801a6f:	53                   	push   %rbx
+  801a70:	48 83 ec 18          	sub    $0x18,%rsp
+  801a74:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a77:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a7b:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+  801a87:	89 c3                	mov    %eax,%ebx
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	0f 88 b8 00 00 00    	js     801b49 <dup+0xe6>
+    close(newfdnum);
+  801a91:	44 89 e7             	mov    %r12d,%edi
+  801a94:	48 b8 08 1a 80 00 00 	movabs $0x801a08,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aa0:	4d 63 ec             	movslq %r12d,%r13
+  801aa3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801aaa:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801aae:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ab2:	4c 89 ff             	mov    %r15,%rdi
+  801ab5:	49 be 27 18 80 00 00 	movabs $0x801827,%r14
+  801abc:	00 00 00 
+  801abf:	41 ff d6             	call   *%r14
+  801ac2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ac5:	4c 89 ef             	mov    %r13,%rdi
+  801ac8:	41 ff d6             	call   *%r14
+  801acb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ace:	48 89 df             	mov    %rbx,%rdi
+  801ad1:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801add:	a8 04                	test   $0x4,%al
+  801adf:	74 2b                	je     801b0c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ae1:	41 89 c1             	mov    %eax,%r9d
+  801ae4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801aea:	4c 89 f1             	mov    %r14,%rcx
+  801aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af2:	48 89 de             	mov    %rbx,%rsi
+  801af5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afa:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  801b01:	00 00 00 
+  801b04:	ff d0                	call   *%rax
+  801b06:	89 c3                	mov    %eax,%ebx
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 4e                	js     801b5a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b0c:	4c 89 ff             	mov    %r15,%rdi
+  801b0f:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+  801b1b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b1e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b24:	4c 89 e9             	mov    %r13,%rcx
+  801b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2c:	4c 89 fe             	mov    %r15,%rsi
+  801b2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b34:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+  801b40:	89 c3                	mov    %eax,%ebx
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 14                	js     801b5a <dup+0xf7>
+
+    return newfdnum;
+  801b46:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b49:	89 d8                	mov    %ebx,%eax
+  801b4b:	48 83 c4 18          	add    $0x18,%rsp
+  801b4f:	5b                   	pop    %rbx
+  801b50:	41 5c                	pop    %r12
+  801b52:	41 5d                	pop    %r13
+  801b54:	41 5e                	pop    %r14
+  801b56:	41 5f                	pop    %r15
+  801b58:	5d                   	pop    %rbp
+  801b59:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b5f:	4c 89 ee             	mov    %r13,%rsi
+  801b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b67:	49 bc fa 12 80 00 00 	movabs $0x8012fa,%r12
+  801b6e:	00 00 00 
+  801b71:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b79:	4c 89 f6             	mov    %r14,%rsi
+  801b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b81:	41 ff d4             	call   *%r12
+    return res;
+  801b84:	eb c3                	jmp    801b49 <dup+0xe6>
+
+0000000000801b86 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+  801b8a:	41 56                	push   %r14
+  801b8c:	41 55                	push   %r13
+  801b8e:	41 54                	push   %r12
+  801b90:	53                   	push   %rbx
+  801b91:	48 83 ec 10          	sub    $0x10,%rsp
+  801b95:	89 fb                	mov    %edi,%ebx
+  801b97:	49 89 f4             	mov    %rsi,%r12
+  801b9a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ba1:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	85 c0                	test   %eax,%eax
+  801baf:	78 4c                	js     801bfd <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bb1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bb5:	41 8b 3e             	mov    (%r14),%edi
+  801bb8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bbc:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 35                	js     801c01 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bcc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bd0:	83 e0 03             	and    $0x3,%eax
+  801bd3:	83 f8 01             	cmp    $0x1,%eax
+  801bd6:	74 2d                	je     801c05 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bdc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801be0:	48 85 c0             	test   %rax,%rax
+  801be3:	74 56                	je     801c3b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801be5:	4c 89 ea             	mov    %r13,%rdx
+  801be8:	4c 89 e6             	mov    %r12,%rsi
+  801beb:	4c 89 f7             	mov    %r14,%rdi
+  801bee:	ff d0                	call   *%rax
+}
+  801bf0:	48 83 c4 10          	add    $0x10,%rsp
+  801bf4:	5b                   	pop    %rbx
+  801bf5:	41 5c                	pop    %r12
+  801bf7:	41 5d                	pop    %r13
+  801bf9:	41 5e                	pop    %r14
+  801bfb:	5d                   	pop    %rbp
+  801bfc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bfd:	48 98                	cltq
+  801bff:	eb ef                	jmp    801bf0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c01:	48 98                	cltq
+  801c03:	eb eb                	jmp    801bf0 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c05:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c0c:	00 00 00 
+  801c0f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c15:	89 da                	mov    %ebx,%edx
+  801c17:	48 bf 59 3d 80 00 00 	movabs $0x803d59,%rdi
+  801c1e:	00 00 00 
+  801c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c26:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  801c2d:	00 00 00 
+  801c30:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c32:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c39:	eb b5                	jmp    801bf0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c3b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c42:	eb ac                	jmp    801bf0 <read+0x6a>
+
+0000000000801c44 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	41 56                	push   %r14
+  801c4a:	41 55                	push   %r13
+  801c4c:	41 54                	push   %r12
+  801c4e:	53                   	push   %rbx
+  801c4f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c53:	89 fb                	mov    %edi,%ebx
+  801c55:	49 89 f4             	mov    %rsi,%r12
+  801c58:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c5f:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801c66:	00 00 00 
+  801c69:	ff d0                	call   *%rax
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	78 41                	js     801cb0 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c6f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c73:	41 8b 3e             	mov    (%r14),%edi
+  801c76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c7a:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 35                	js     801cbf <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c8a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c8e:	83 e0 03             	and    $0x3,%eax
+  801c91:	83 f8 01             	cmp    $0x1,%eax
+  801c94:	74 2d                	je     801cc3 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c9a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c9e:	48 85 c0             	test   %rax,%rax
+  801ca1:	74 56                	je     801cf9 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801ca3:	4c 89 ea             	mov    %r13,%rdx
+  801ca6:	4c 89 e6             	mov    %r12,%rsi
+  801ca9:	4c 89 f7             	mov    %r14,%rdi
+  801cac:	ff d0                	call   *%rax
+  801cae:	eb 02                	jmp    801cb2 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb0:	48 98                	cltq
+}
+  801cb2:	48 83 c4 10          	add    $0x10,%rsp
+  801cb6:	5b                   	pop    %rbx
+  801cb7:	41 5c                	pop    %r12
+  801cb9:	41 5d                	pop    %r13
+  801cbb:	41 5e                	pop    %r14
+  801cbd:	5d                   	pop    %rbp
+  801cbe:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cbf:	48 98                	cltq
+  801cc1:	eb ef                	jmp    801cb2 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cca:	00 00 00 
+  801ccd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cd3:	89 da                	mov    %ebx,%edx
+  801cd5:	48 bf 18 3d 80 00 00 	movabs $0x803d18,%rdi
+  801cdc:	00 00 00 
+  801cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce4:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  801ceb:	00 00 00 
+  801cee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cf0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cf7:	eb b9                	jmp    801cb2 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801cf9:	4c 89 ea             	mov    %r13,%rdx
+  801cfc:	4c 89 e6             	mov    %r12,%rsi
+  801cff:	89 df                	mov    %ebx,%edi
+  801d01:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+  801d0d:	eb a3                	jmp    801cb2 <readmap+0x6e>
+
+0000000000801d0f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d0f:	55                   	push   %rbp
+  801d10:	48 89 e5             	mov    %rsp,%rbp
+  801d13:	41 57                	push   %r15
+  801d15:	41 56                	push   %r14
+  801d17:	41 55                	push   %r13
+  801d19:	41 54                	push   %r12
+  801d1b:	53                   	push   %rbx
+  801d1c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d20:	48 85 d2             	test   %rdx,%rdx
+  801d23:	74 54                	je     801d79 <readn+0x6a>
+  801d25:	41 89 fd             	mov    %edi,%r13d
+  801d28:	49 89 f6             	mov    %rsi,%r14
+  801d2b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d33:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d38:	49 bf 86 1b 80 00 00 	movabs $0x801b86,%r15
+  801d3f:	00 00 00 
+  801d42:	4c 89 e2             	mov    %r12,%rdx
+  801d45:	48 29 f2             	sub    %rsi,%rdx
+  801d48:	4c 01 f6             	add    %r14,%rsi
+  801d4b:	44 89 ef             	mov    %r13d,%edi
+  801d4e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 20                	js     801d75 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d55:	01 c3                	add    %eax,%ebx
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	74 08                	je     801d63 <readn+0x54>
+  801d5b:	48 63 f3             	movslq %ebx,%rsi
+  801d5e:	4c 39 e6             	cmp    %r12,%rsi
+  801d61:	72 df                	jb     801d42 <readn+0x33>
+    }
+    return res;
+  801d63:	48 63 c3             	movslq %ebx,%rax
+}
+  801d66:	48 83 c4 08          	add    $0x8,%rsp
+  801d6a:	5b                   	pop    %rbx
+  801d6b:	41 5c                	pop    %r12
+  801d6d:	41 5d                	pop    %r13
+  801d6f:	41 5e                	pop    %r14
+  801d71:	41 5f                	pop    %r15
+  801d73:	5d                   	pop    %rbp
+  801d74:	c3                   	ret
+        if (inc < 0) return inc;
+  801d75:	48 98                	cltq
+  801d77:	eb ed                	jmp    801d66 <readn+0x57>
+    int inc = 1, res = 0;
+  801d79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7e:	eb e3                	jmp    801d63 <readn+0x54>
+
+0000000000801d80 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d80:	55                   	push   %rbp
+  801d81:	48 89 e5             	mov    %rsp,%rbp
+  801d84:	41 56                	push   %r14
+  801d86:	41 55                	push   %r13
+  801d88:	41 54                	push   %r12
+  801d8a:	53                   	push   %rbx
+  801d8b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d8f:	89 fb                	mov    %edi,%ebx
+  801d91:	49 89 f4             	mov    %rsi,%r12
+  801d94:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d97:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d9b:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 47                	js     801df2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dab:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801daf:	41 8b 3e             	mov    (%r14),%edi
+  801db2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db6:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 30                	js     801df6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dcb:	74 2d                	je     801dfa <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dcd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dd5:	48 85 c0             	test   %rax,%rax
+  801dd8:	74 56                	je     801e30 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dda:	4c 89 ea             	mov    %r13,%rdx
+  801ddd:	4c 89 e6             	mov    %r12,%rsi
+  801de0:	4c 89 f7             	mov    %r14,%rdi
+  801de3:	ff d0                	call   *%rax
+}
+  801de5:	48 83 c4 10          	add    $0x10,%rsp
+  801de9:	5b                   	pop    %rbx
+  801dea:	41 5c                	pop    %r12
+  801dec:	41 5d                	pop    %r13
+  801dee:	41 5e                	pop    %r14
+  801df0:	5d                   	pop    %rbp
+  801df1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df2:	48 98                	cltq
+  801df4:	eb ef                	jmp    801de5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df6:	48 98                	cltq
+  801df8:	eb eb                	jmp    801de5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dfa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e01:	00 00 00 
+  801e04:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e0a:	89 da                	mov    %ebx,%edx
+  801e0c:	48 bf 75 3d 80 00 00 	movabs $0x803d75,%rdi
+  801e13:	00 00 00 
+  801e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1b:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  801e22:	00 00 00 
+  801e25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e27:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e2e:	eb b5                	jmp    801de5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e30:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e37:	eb ac                	jmp    801de5 <write+0x65>
+
+0000000000801e39 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	53                   	push   %rbx
+  801e3e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e42:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e44:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e48:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 0c                	js     801e64 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e5c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e68:	c9                   	leave
+  801e69:	c3                   	ret
+
+0000000000801e6a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e6a:	55                   	push   %rbp
+  801e6b:	48 89 e5             	mov    %rsp,%rbp
+  801e6e:	41 55                	push   %r13
+  801e70:	41 54                	push   %r12
+  801e72:	53                   	push   %rbx
+  801e73:	48 83 ec 18          	sub    $0x18,%rsp
+  801e77:	89 fb                	mov    %edi,%ebx
+  801e79:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e7c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e80:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801e87:	00 00 00 
+  801e8a:	ff d0                	call   *%rax
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	78 38                	js     801ec8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e90:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e94:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e98:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e9c:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801ea3:	00 00 00 
+  801ea6:	ff d0                	call   *%rax
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	78 1c                	js     801ec8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eac:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801eb1:	74 20                	je     801ed3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801eb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eb7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801ebb:	48 85 c0             	test   %rax,%rax
+  801ebe:	74 47                	je     801f07 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ec0:	44 89 e6             	mov    %r12d,%esi
+  801ec3:	4c 89 ef             	mov    %r13,%rdi
+  801ec6:	ff d0                	call   *%rax
+}
+  801ec8:	48 83 c4 18          	add    $0x18,%rsp
+  801ecc:	5b                   	pop    %rbx
+  801ecd:	41 5c                	pop    %r12
+  801ecf:	41 5d                	pop    %r13
+  801ed1:	5d                   	pop    %rbp
+  801ed2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ed3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801eda:	00 00 00 
+  801edd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ee3:	89 da                	mov    %ebx,%edx
+  801ee5:	48 bf 38 3d 80 00 00 	movabs $0x803d38,%rdi
+  801eec:	00 00 00 
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef4:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  801efb:	00 00 00 
+  801efe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f05:	eb c1                	jmp    801ec8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f07:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f0c:	eb ba                	jmp    801ec8 <ftruncate+0x5e>
+
+0000000000801f0e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	41 54                	push   %r12
+  801f14:	53                   	push   %rbx
+  801f15:	48 83 ec 10          	sub    $0x10,%rsp
+  801f19:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f20:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  801f27:	00 00 00 
+  801f2a:	ff d0                	call   *%rax
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 4e                	js     801f7e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f30:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f34:	41 8b 3c 24          	mov    (%r12),%edi
+  801f38:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f3c:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 32                	js     801f7e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f50:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801f55:	74 30                	je     801f87 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f57:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f5a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f61:	00 00 00 
+    stat->st_isdir = 0;
+  801f64:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f6b:	00 00 00 
+    stat->st_dev = dev;
+  801f6e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f75:	48 89 de             	mov    %rbx,%rsi
+  801f78:	4c 89 e7             	mov    %r12,%rdi
+  801f7b:	ff 50 30             	call   *0x30(%rax)
+}
+  801f7e:	48 83 c4 10          	add    $0x10,%rsp
+  801f82:	5b                   	pop    %rbx
+  801f83:	41 5c                	pop    %r12
+  801f85:	5d                   	pop    %rbp
+  801f86:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f87:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f8c:	eb f0                	jmp    801f7e <fstat+0x70>
+
+0000000000801f8e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f8e:	55                   	push   %rbp
+  801f8f:	48 89 e5             	mov    %rsp,%rbp
+  801f92:	41 54                	push   %r12
+  801f94:	53                   	push   %rbx
+  801f95:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f98:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9d:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  801fa4:	00 00 00 
+  801fa7:	ff d0                	call   *%rax
+  801fa9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	78 25                	js     801fd4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801faf:	4c 89 e6             	mov    %r12,%rsi
+  801fb2:	89 c7                	mov    %eax,%edi
+  801fb4:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  801fbb:	00 00 00 
+  801fbe:	ff d0                	call   *%rax
+  801fc0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fc3:	89 df                	mov    %ebx,%edi
+  801fc5:	48 b8 08 1a 80 00 00 	movabs $0x801a08,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+
+    return res;
+  801fd1:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fd4:	89 d8                	mov    %ebx,%eax
+  801fd6:	5b                   	pop    %rbx
+  801fd7:	41 5c                	pop    %r12
+  801fd9:	5d                   	pop    %rbp
+  801fda:	c3                   	ret
+
+0000000000801fdb <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801fdb:	55                   	push   %rbp
+  801fdc:	48 89 e5             	mov    %rsp,%rbp
+  801fdf:	41 54                	push   %r12
+  801fe1:	53                   	push   %rbx
+  801fe2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe6:	48 89 fb             	mov    %rdi,%rbx
+  801fe9:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fec:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ff0:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ff5:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 1f                	js     802024 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802009:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80200d:	48 85 c0             	test   %rax,%rax
+  802010:	74 1b                	je     80202d <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802012:	4c 89 e6             	mov    %r12,%rsi
+  802015:	48 89 df             	mov    %rbx,%rdi
+  802018:	ff d0                	call   *%rax
+    if (res < 0) {
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802021:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802024:	48 83 c4 10          	add    $0x10,%rsp
+  802028:	5b                   	pop    %rbx
+  802029:	41 5c                	pop    %r12
+  80202b:	5d                   	pop    %rbp
+  80202c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80202d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802032:	eb f0                	jmp    802024 <create_snapshot+0x49>
+
+0000000000802034 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802034:	55                   	push   %rbp
+  802035:	48 89 e5             	mov    %rsp,%rbp
+  802038:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80203c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802040:	bf 66 00 00 00       	mov    $0x66,%edi
+  802045:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 1e                	js     802073 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802055:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802059:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80205d:	48 85 d2             	test   %rdx,%rdx
+  802060:	74 13                	je     802075 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802062:	b8 00 00 00 00       	mov    $0x0,%eax
+  802067:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802070:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802073:	c9                   	leave
+  802074:	c3                   	ret
+        return -E_NOT_SUPP;
+  802075:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80207a:	eb f7                	jmp    802073 <print_snapshot_list+0x3f>
+
+000000000080207c <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80207c:	55                   	push   %rbp
+  80207d:	48 89 e5             	mov    %rsp,%rbp
+  802080:	53                   	push   %rbx
+  802081:	48 83 ec 18          	sub    $0x18,%rsp
+  802085:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802088:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80208c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802091:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 1c                	js     8020bd <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8020a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020a5:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8020a9:	48 85 c0             	test   %rax,%rax
+  8020ac:	74 15                	je     8020c3 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8020ae:	48 89 df             	mov    %rbx,%rdi
+  8020b1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ba:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c1:	c9                   	leave
+  8020c2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020c3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c8:	eb f3                	jmp    8020bd <accept_snapshot+0x41>
+
+00000000008020ca <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8020ca:	55                   	push   %rbp
+  8020cb:	48 89 e5             	mov    %rsp,%rbp
+  8020ce:	53                   	push   %rbx
+  8020cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d3:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020d6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020da:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020df:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 1c                	js     80210b <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8020ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f3:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8020f7:	48 85 c0             	test   %rax,%rax
+  8020fa:	74 15                	je     802111 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8020fc:	48 89 df             	mov    %rbx,%rdi
+  8020ff:	ff d0                	call   *%rax
+    if (res < 0) {
+  802101:	85 c0                	test   %eax,%eax
+  802103:	ba 00 00 00 00       	mov    $0x0,%edx
+  802108:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80210b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+        return -E_NOT_SUPP;
+  802111:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802116:	eb f3                	jmp    80210b <delete_snapshot+0x41>
+
+0000000000802118 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802118:	55                   	push   %rbp
+  802119:	48 89 e5             	mov    %rsp,%rbp
+  80211c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802120:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802124:	bf 66 00 00 00       	mov    $0x66,%edi
+  802129:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  802130:	00 00 00 
+  802133:	ff d0                	call   *%rax
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 14                	js     80214d <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802139:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80213d:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802141:	48 85 d2             	test   %rdx,%rdx
+  802144:	74 09                	je     80214f <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214b:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80214f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802154:	eb f7                	jmp    80214d <gc_snapshots+0x35>
+
+0000000000802156 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802156:	55                   	push   %rbp
+  802157:	48 89 e5             	mov    %rsp,%rbp
+  80215a:	41 56                	push   %r14
+  80215c:	41 55                	push   %r13
+  80215e:	41 54                	push   %r12
+  802160:	53                   	push   %rbx
+  802161:	48 83 ec 10          	sub    $0x10,%rsp
+  802165:	48 89 fb             	mov    %rdi,%rbx
+  802168:	49 89 f4             	mov    %rsi,%r12
+  80216b:	49 89 d5             	mov    %rdx,%r13
+  80216e:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802171:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802175:	bf 66 00 00 00       	mov    $0x66,%edi
+  80217a:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 1b                	js     8021a5 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80218a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218e:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802192:	48 85 c0             	test   %rax,%rax
+  802195:	74 1b                	je     8021b2 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802197:	4c 89 f1             	mov    %r14,%rcx
+  80219a:	4c 89 ea             	mov    %r13,%rdx
+  80219d:	4c 89 e6             	mov    %r12,%rsi
+  8021a0:	48 89 df             	mov    %rbx,%rdi
+  8021a3:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021a5:	48 83 c4 10          	add    $0x10,%rsp
+  8021a9:	5b                   	pop    %rbx
+  8021aa:	41 5c                	pop    %r12
+  8021ac:	41 5d                	pop    %r13
+  8021ae:	41 5e                	pop    %r14
+  8021b0:	5d                   	pop    %rbp
+  8021b1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021b7:	eb ec                	jmp    8021a5 <diff_snapshots+0x4f>
+
+00000000008021b9 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	41 55                	push   %r13
+  8021bf:	41 54                	push   %r12
+  8021c1:	53                   	push   %rbx
+  8021c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021c6:	48 89 fb             	mov    %rdi,%rbx
+  8021c9:	49 89 f4             	mov    %rsi,%r12
+  8021cc:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021cf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021d3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021d8:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 18                	js     802200 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8021e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ec:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8021f0:	48 85 c0             	test   %rax,%rax
+  8021f3:	74 16                	je     80220b <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8021f5:	4c 89 ea             	mov    %r13,%rdx
+  8021f8:	4c 89 e6             	mov    %r12,%rsi
+  8021fb:	48 89 df             	mov    %rbx,%rdi
+  8021fe:	ff d0                	call   *%rax
+
+    return res;
+}
+  802200:	48 83 c4 18          	add    $0x18,%rsp
+  802204:	5b                   	pop    %rbx
+  802205:	41 5c                	pop    %r12
+  802207:	41 5d                	pop    %r13
+  802209:	5d                   	pop    %rbp
+  80220a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80220b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802210:	eb ee                	jmp    802200 <send_snapshot+0x47>
+
+0000000000802212 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	53                   	push   %rbx
+  802217:	48 83 ec 18          	sub    $0x18,%rsp
+  80221b:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80221e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802222:	bf 66 00 00 00       	mov    $0x66,%edi
+  802227:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 12                	js     802249 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80223b:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80223f:	48 85 c0             	test   %rax,%rax
+  802242:	74 0b                	je     80224f <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802244:	48 89 df             	mov    %rbx,%rdi
+  802247:	ff d0                	call   *%rax
+
+    return res;
+}
+  802249:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224d:	c9                   	leave
+  80224e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80224f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802254:	eb f3                	jmp    802249 <receive_snapshot+0x37>
+
+0000000000802256 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80225e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802262:	bf 66 00 00 00       	mov    $0x66,%edi
+  802267:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  80226e:	00 00 00 
+  802271:	ff d0                	call   *%rax
+  802273:	85 c0                	test   %eax,%eax
+  802275:	78 17                	js     80228e <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802277:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80227b:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802282:	48 85 d2             	test   %rdx,%rdx
+  802285:	74 09                	je     802290 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228c:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80228e:	c9                   	leave
+  80228f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802290:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802295:	eb f7                	jmp    80228e <free_space_bytes+0x38>
+
+0000000000802297 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802297:	55                   	push   %rbp
+  802298:	48 89 e5             	mov    %rsp,%rbp
+  80229b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80229f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022a3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022a8:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	78 17                	js     8022cf <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8022b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022bc:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8022c3:	48 85 d2             	test   %rdx,%rdx
+  8022c6:	74 09                	je     8022d1 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8022c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cd:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022d1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022d6:	eb f7                	jmp    8022cf <busy_space_bytes+0x38>
+
+00000000008022d8 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8022d8:	55                   	push   %rbp
+  8022d9:	48 89 e5             	mov    %rsp,%rbp
+  8022dc:	41 54                	push   %r12
+  8022de:	53                   	push   %rbx
+  8022df:	48 83 ec 10          	sub    $0x10,%rsp
+  8022e3:	89 fb                	mov    %edi,%ebx
+  8022e5:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022e8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022ec:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022f1:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	78 17                	js     802318 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802301:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802305:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80230c:	48 85 c0             	test   %rax,%rax
+  80230f:	74 10                	je     802321 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802311:	4c 89 e6             	mov    %r12,%rsi
+  802314:	89 df                	mov    %ebx,%edi
+  802316:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802318:	48 83 c4 10          	add    $0x10,%rsp
+  80231c:	5b                   	pop    %rbx
+  80231d:	41 5c                	pop    %r12
+  80231f:	5d                   	pop    %rbp
+  802320:	c3                   	ret
+        return -E_NOT_SUPP;
+  802321:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802326:	eb f0                	jmp    802318 <snapshots_space+0x40>
+
+0000000000802328 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802328:	55                   	push   %rbp
+  802329:	48 89 e5             	mov    %rsp,%rbp
+  80232c:	41 55                	push   %r13
+  80232e:	41 54                	push   %r12
+  802330:	53                   	push   %rbx
+  802331:	48 83 ec 08          	sub    $0x8,%rsp
+  802335:	41 89 fd             	mov    %edi,%r13d
+  802338:	48 89 f3             	mov    %rsi,%rbx
+  80233b:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802345:	00 00 00 
+  802348:	83 38 00             	cmpl   $0x0,(%rax)
+  80234b:	74 57                	je     8023a4 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80234d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802353:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802358:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80235f:	00 00 00 
+  802362:	44 89 ee             	mov    %r13d,%esi
+  802365:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80236c:	00 00 00 
+  80236f:	8b 38                	mov    (%rax),%edi
+  802371:	48 b8 fd 16 80 00 00 	movabs $0x8016fd,%rax
+  802378:	00 00 00 
+  80237b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80237d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802382:	4c 89 e2             	mov    %r12,%rdx
+  802385:	48 89 de             	mov    %rbx,%rsi
+  802388:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238d:	48 b8 e5 16 80 00 00 	movabs $0x8016e5,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+}
+  802399:	48 83 c4 08          	add    $0x8,%rsp
+  80239d:	5b                   	pop    %rbx
+  80239e:	41 5c                	pop    %r12
+  8023a0:	41 5d                	pop    %r13
+  8023a2:	5d                   	pop    %rbp
+  8023a3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023a4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023a9:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  8023b0:	00 00 00 
+  8023b3:	ff d0                	call   *%rax
+  8023b5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023bc:	00 00 
+  8023be:	eb 8d                	jmp    80234d <fsipc_region+0x25>
+
+00000000008023c0 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8023c0:	55                   	push   %rbp
+  8023c1:	48 89 e5             	mov    %rsp,%rbp
+  8023c4:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8023c8:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8023cf:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8023d0:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8023d4:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  8023db:	00 00 00 
+  8023de:	ff d0                	call   *%rax
+}
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+00000000008023e2 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8023e2:	85 ff                	test   %edi,%edi
+  8023e4:	78 6d                	js     802453 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+  8023ea:	41 54                	push   %r12
+  8023ec:	53                   	push   %rbx
+  8023ed:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8023f0:	48 85 f6             	test   %rsi,%rsi
+  8023f3:	74 57                	je     80244c <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8023f5:	89 f8                	mov    %edi,%eax
+  8023f7:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023fe:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802400:	be 00 00 00 00       	mov    $0x0,%esi
+  802405:	bf 12 00 00 00       	mov    $0x12,%edi
+  80240a:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802416:	85 c0                	test   %eax,%eax
+  802418:	78 2d                	js     802447 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80241a:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802421:	00 00 00 
+  802424:	49 63 14 24          	movslq (%r12),%rdx
+  802428:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80242f:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802434:	48 89 df             	mov    %rbx,%rdi
+  802437:	48 b8 9c 0d 80 00 00 	movabs $0x800d9c,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802443:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802447:	5b                   	pop    %rbx
+  802448:	41 5c                	pop    %r12
+  80244a:	5d                   	pop    %rbp
+  80244b:	c3                   	ret
+        return -E_INVAL;
+  80244c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802451:	eb f4                	jmp    802447 <devfile_df_snapshots+0x65>
+  802453:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802458:	c3                   	ret
+
+0000000000802459 <devfile_df_busy>:
+devfile_df_busy() {
+  802459:	55                   	push   %rbp
+  80245a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80245d:	be 00 00 00 00       	mov    $0x0,%esi
+  802462:	bf 11 00 00 00       	mov    $0x11,%edi
+  802467:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+}
+  802473:	5d                   	pop    %rbp
+  802474:	c3                   	ret
+
+0000000000802475 <devfile_df_free>:
+devfile_df_free() {
+  802475:	55                   	push   %rbp
+  802476:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802479:	be 00 00 00 00       	mov    $0x0,%esi
+  80247e:	bf 10 00 00 00       	mov    $0x10,%edi
+  802483:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+}
+  80248f:	5d                   	pop    %rbp
+  802490:	c3                   	ret
+
+0000000000802491 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802491:	55                   	push   %rbp
+  802492:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802495:	be 00 00 00 00       	mov    $0x0,%esi
+  80249a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80249f:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+}
+  8024ab:	5d                   	pop    %rbp
+  8024ac:	c3                   	ret
+
+00000000008024ad <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8024ad:	55                   	push   %rbp
+  8024ae:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8024b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b6:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024bb:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ce:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+
+00000000008024d3 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8024d7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024de:	00 00 00 
+  8024e1:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8024e4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8024e6:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8024e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ee:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024f3:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+}
+  8024ff:	5d                   	pop    %rbp
+  802500:	c3                   	ret
+
+0000000000802501 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802505:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802508:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80250f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802511:	be 00 00 00 00       	mov    $0x0,%esi
+  802516:	bf 06 00 00 00       	mov    $0x6,%edi
+  80251b:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+}
+  802527:	5d                   	pop    %rbp
+  802528:	c3                   	ret
+
+0000000000802529 <devfile_write>:
+    if (!fd || !buf) {
+  802529:	48 85 ff             	test   %rdi,%rdi
+  80252c:	0f 84 c1 00 00 00    	je     8025f3 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802532:	55                   	push   %rbp
+  802533:	48 89 e5             	mov    %rsp,%rbp
+  802536:	41 57                	push   %r15
+  802538:	41 56                	push   %r14
+  80253a:	41 55                	push   %r13
+  80253c:	41 54                	push   %r12
+  80253e:	53                   	push   %rbx
+  80253f:	48 83 ec 18          	sub    $0x18,%rsp
+  802543:	49 89 ff             	mov    %rdi,%r15
+  802546:	49 89 f5             	mov    %rsi,%r13
+  802549:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80254c:	48 85 f6             	test   %rsi,%rsi
+  80254f:	0f 84 95 00 00 00    	je     8025ea <devfile_write+0xc1>
+    while (n) {
+  802555:	48 85 d2             	test   %rdx,%rdx
+  802558:	0f 84 83 00 00 00    	je     8025e1 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80255e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802565:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80256c:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80256f:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802574:	49 39 dc             	cmp    %rbx,%r12
+  802577:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80257b:	48 89 da             	mov    %rbx,%rdx
+  80257e:	4c 89 ee             	mov    %r13,%rsi
+  802581:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802588:	00 00 00 
+  80258b:	48 b8 9c 0d 80 00 00 	movabs $0x800d9c,%rax
+  802592:	00 00 00 
+  802595:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802597:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80259b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80259e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8025a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8025ac:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+        if (write < 0) {
+  8025b8:	85 c0                	test   %eax,%eax
+  8025ba:	78 21                	js     8025dd <devfile_write+0xb4>
+        buf += write;
+  8025bc:	48 63 d0             	movslq %eax,%rdx
+  8025bf:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8025c2:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8025c5:	49 29 d4             	sub    %rdx,%r12
+  8025c8:	75 a5                	jne    80256f <devfile_write+0x46>
+    return totalWrite;
+  8025ca:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8025ce:	48 83 c4 18          	add    $0x18,%rsp
+  8025d2:	5b                   	pop    %rbx
+  8025d3:	41 5c                	pop    %r12
+  8025d5:	41 5d                	pop    %r13
+  8025d7:	41 5e                	pop    %r14
+  8025d9:	41 5f                	pop    %r15
+  8025db:	5d                   	pop    %rbp
+  8025dc:	c3                   	ret
+            return write;
+  8025dd:	48 98                	cltq
+  8025df:	eb ed                	jmp    8025ce <devfile_write+0xa5>
+    int totalWrite = 0;
+  8025e1:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8025e8:	eb e0                	jmp    8025ca <devfile_write+0xa1>
+        return -E_INVAL;
+  8025ea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025f1:	eb db                	jmp    8025ce <devfile_write+0xa5>
+  8025f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025fa:	c3                   	ret
+
+00000000008025fb <devfile_read>:
+    if (!fd || !buf) {
+  8025fb:	48 85 ff             	test   %rdi,%rdi
+  8025fe:	0f 84 c0 00 00 00    	je     8026c4 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	41 57                	push   %r15
+  80260a:	41 56                	push   %r14
+  80260c:	41 55                	push   %r13
+  80260e:	41 54                	push   %r12
+  802610:	53                   	push   %rbx
+  802611:	48 83 ec 18          	sub    $0x18,%rsp
+  802615:	49 89 ff             	mov    %rdi,%r15
+  802618:	49 89 f5             	mov    %rsi,%r13
+  80261b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80261e:	48 85 f6             	test   %rsi,%rsi
+  802621:	0f 84 96 00 00 00    	je     8026bd <devfile_read+0xc2>
+    while (n) {
+  802627:	48 85 d2             	test   %rdx,%rdx
+  80262a:	0f 84 87 00 00 00    	je     8026b7 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802630:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802637:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802638:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80263f:	00 00 00 
+  802642:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802646:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802649:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80264e:	49 39 c4             	cmp    %rax,%r12
+  802651:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802655:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802659:	be 00 00 00 00       	mov    $0x0,%esi
+  80265e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802663:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80266f:	85 c0                	test   %eax,%eax
+  802671:	7e 37                	jle    8026aa <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802673:	48 63 d8             	movslq %eax,%rbx
+  802676:	48 89 da             	mov    %rbx,%rdx
+  802679:	4c 89 f6             	mov    %r14,%rsi
+  80267c:	4c 89 ef             	mov    %r13,%rdi
+  80267f:	48 b8 9c 0d 80 00 00 	movabs $0x800d9c,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+        buf += read;
+  80268b:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80268e:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802692:	49 29 dc             	sub    %rbx,%r12
+  802695:	75 ab                	jne    802642 <devfile_read+0x47>
+  return totalRead;
+  802697:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80269b:	48 83 c4 18          	add    $0x18,%rsp
+  80269f:	5b                   	pop    %rbx
+  8026a0:	41 5c                	pop    %r12
+  8026a2:	41 5d                	pop    %r13
+  8026a4:	41 5e                	pop    %r14
+  8026a6:	41 5f                	pop    %r15
+  8026a8:	5d                   	pop    %rbp
+  8026a9:	c3                   	ret
+            return read ? read : totalRead;
+  8026aa:	48 63 d0             	movslq %eax,%rdx
+  8026ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026b1:	48 0f 45 c2          	cmovne %rdx,%rax
+  8026b5:	eb e4                	jmp    80269b <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8026b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026bb:	eb da                	jmp    802697 <devfile_read+0x9c>
+        return E_INVAL;
+  8026bd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026c2:	eb d7                	jmp    80269b <devfile_read+0xa0>
+  8026c4:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8026c9:	c3                   	ret
+
+00000000008026ca <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026ca:	48 85 ff             	test   %rdi,%rdi
+  8026cd:	74 5f                	je     80272e <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8026cf:	55                   	push   %rbp
+  8026d0:	48 89 e5             	mov    %rsp,%rbp
+  8026d3:	53                   	push   %rbx
+  8026d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d8:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026db:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+  8026e7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026ed:	77 45                	ja     802734 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8026ef:	48 89 de             	mov    %rbx,%rsi
+  8026f2:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026f9:	00 00 00 
+  8026fc:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802708:	be 00 00 00 00       	mov    $0x0,%esi
+  80270d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802712:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	ba 00 00 00 00       	mov    $0x0,%edx
+  802725:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802728:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+        return -E_INVAL;
+  80272e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802733:	c3                   	ret
+        return -E_INVAL;
+  802734:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802739:	eb ed                	jmp    802728 <devfile_receive_snapshot+0x5e>
+
+000000000080273b <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	41 55                	push   %r13
+  802741:	41 54                	push   %r12
+  802743:	53                   	push   %rbx
+  802744:	48 83 ec 08          	sub    $0x8,%rsp
+  802748:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80274b:	48 85 f6             	test   %rsi,%rsi
+  80274e:	0f 94 c0             	sete   %al
+  802751:	48 85 d2             	test   %rdx,%rdx
+  802754:	0f 94 c2             	sete   %dl
+  802757:	08 d0                	or     %dl,%al
+  802759:	0f 85 ad 00 00 00    	jne    80280c <devfile_send_snapshot+0xd1>
+  80275f:	48 89 fb             	mov    %rdi,%rbx
+  802762:	49 89 f4             	mov    %rsi,%r12
+  802765:	48 85 ff             	test   %rdi,%rdi
+  802768:	0f 84 9e 00 00 00    	je     80280c <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80276e:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802780:	0f 87 8d 00 00 00    	ja     802813 <devfile_send_snapshot+0xd8>
+  802786:	4c 89 e7             	mov    %r12,%rdi
+  802789:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802790:	00 00 00 
+  802793:	ff d0                	call   *%rax
+  802795:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80279b:	77 7d                	ja     80281a <devfile_send_snapshot+0xdf>
+  80279d:	4c 89 ef             	mov    %r13,%rdi
+  8027a0:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027b2:	77 6d                	ja     802821 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8027b4:	48 89 de             	mov    %rbx,%rsi
+  8027b7:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027be:	00 00 00 
+  8027c1:	48 bb a2 0b 80 00 00 	movabs $0x800ba2,%rbx
+  8027c8:	00 00 00 
+  8027cb:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8027cd:	4c 89 e6             	mov    %r12,%rsi
+  8027d0:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8027d7:	00 00 00 
+  8027da:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8027dc:	4c 89 ee             	mov    %r13,%rsi
+  8027df:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8027e6:	00 00 00 
+  8027e9:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8027eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f0:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027f5:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+}
+  802801:	48 83 c4 08          	add    $0x8,%rsp
+  802805:	5b                   	pop    %rbx
+  802806:	41 5c                	pop    %r12
+  802808:	41 5d                	pop    %r13
+  80280a:	5d                   	pop    %rbp
+  80280b:	c3                   	ret
+        return -E_INVAL;
+  80280c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802811:	eb ee                	jmp    802801 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802813:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802818:	eb e7                	jmp    802801 <devfile_send_snapshot+0xc6>
+  80281a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80281f:	eb e0                	jmp    802801 <devfile_send_snapshot+0xc6>
+  802821:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802826:	eb d9                	jmp    802801 <devfile_send_snapshot+0xc6>
+
+0000000000802828 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802828:	48 85 ff             	test   %rdi,%rdi
+  80282b:	0f 84 41 01 00 00    	je     802972 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802831:	55                   	push   %rbp
+  802832:	48 89 e5             	mov    %rsp,%rbp
+  802835:	41 57                	push   %r15
+  802837:	41 56                	push   %r14
+  802839:	41 55                	push   %r13
+  80283b:	41 54                	push   %r12
+  80283d:	53                   	push   %rbx
+  80283e:	48 83 ec 08          	sub    $0x8,%rsp
+  802842:	49 89 fc             	mov    %rdi,%r12
+  802845:	49 89 f5             	mov    %rsi,%r13
+  802848:	48 89 d3             	mov    %rdx,%rbx
+  80284b:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80284e:	48 85 f6             	test   %rsi,%rsi
+  802851:	0f 84 ff 00 00 00    	je     802956 <devfile_diff_snapshots+0x12e>
+  802857:	48 85 d2             	test   %rdx,%rdx
+  80285a:	0f 84 fd 00 00 00    	je     80295d <devfile_diff_snapshots+0x135>
+  802860:	48 85 c9             	test   %rcx,%rcx
+  802863:	0f 84 f4 00 00 00    	je     80295d <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802869:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802870:	00 00 00 
+  802873:	ff d0                	call   *%rax
+  802875:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80287b:	0f 87 e3 00 00 00    	ja     802964 <devfile_diff_snapshots+0x13c>
+  802881:	4c 89 ef             	mov    %r13,%rdi
+  802884:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+  802890:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802896:	0f 87 cf 00 00 00    	ja     80296b <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80289c:	4c 89 e6             	mov    %r12,%rsi
+  80289f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8028a6:	00 00 00 
+  8028a9:	4c 89 e7             	mov    %r12,%rdi
+  8028ac:	49 bf a2 0b 80 00 00 	movabs $0x800ba2,%r15
+  8028b3:	00 00 00 
+  8028b6:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8028b9:	4c 89 ee             	mov    %r13,%rsi
+  8028bc:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8028c3:	00 
+  8028c4:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8028c7:	48 8b 03             	mov    (%rbx),%rax
+  8028ca:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8028d1:	00 
+  8028d2:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8028d6:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8028dd:	00 
+  8028de:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8028e2:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8028e9:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8028ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ef:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028f4:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8028fb:	00 00 00 
+  8028fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802900:	85 c0                	test   %eax,%eax
+  802902:	78 43                	js     802947 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802904:	49 8b 04 24          	mov    (%r12),%rax
+  802908:	48 89 03             	mov    %rax,(%rbx)
+  80290b:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802910:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802914:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802919:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80291d:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802922:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802926:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80292a:	48 c1 e2 03          	shl    $0x3,%rdx
+  80292e:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802933:	4c 89 f7             	mov    %r14,%rdi
+  802936:	48 b8 9c 0d 80 00 00 	movabs $0x800d9c,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802942:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802947:	48 83 c4 08          	add    $0x8,%rsp
+  80294b:	5b                   	pop    %rbx
+  80294c:	41 5c                	pop    %r12
+  80294e:	41 5d                	pop    %r13
+  802950:	41 5e                	pop    %r14
+  802952:	41 5f                	pop    %r15
+  802954:	5d                   	pop    %rbp
+  802955:	c3                   	ret
+        return -E_INVAL;
+  802956:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80295b:	eb ea                	jmp    802947 <devfile_diff_snapshots+0x11f>
+  80295d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802962:	eb e3                	jmp    802947 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802964:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802969:	eb dc                	jmp    802947 <devfile_diff_snapshots+0x11f>
+  80296b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802970:	eb d5                	jmp    802947 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802972:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802977:	c3                   	ret
+
+0000000000802978 <devfile_delete_snapshot>:
+    if (!name) {
+  802978:	48 85 ff             	test   %rdi,%rdi
+  80297b:	74 5f                	je     8029dc <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	53                   	push   %rbx
+  802982:	48 83 ec 08          	sub    $0x8,%rsp
+  802986:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802989:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802990:	00 00 00 
+  802993:	ff d0                	call   *%rax
+  802995:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80299b:	77 45                	ja     8029e2 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80299d:	48 89 de             	mov    %rbx,%rsi
+  8029a0:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8029a7:	00 00 00 
+  8029aa:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8029b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bb:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8029c0:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029da:	c9                   	leave
+  8029db:	c3                   	ret
+        return -E_INVAL;
+  8029dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029e1:	c3                   	ret
+        return -E_INVAL;
+  8029e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029e7:	eb ed                	jmp    8029d6 <devfile_delete_snapshot+0x5e>
+
+00000000008029e9 <devfile_accept_snapshot>:
+    if (!name) {
+  8029e9:	48 85 ff             	test   %rdi,%rdi
+  8029ec:	74 5f                	je     802a4d <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8029ee:	55                   	push   %rbp
+  8029ef:	48 89 e5             	mov    %rsp,%rbp
+  8029f2:	53                   	push   %rbx
+  8029f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029fa:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+  802a06:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a0c:	77 45                	ja     802a53 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802a0e:	48 89 de             	mov    %rbx,%rsi
+  802a11:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802a18:	00 00 00 
+  802a1b:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  802a22:	00 00 00 
+  802a25:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802a27:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a31:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802a38:	00 00 00 
+  802a3b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a44:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+        return -E_INVAL;
+  802a4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a52:	c3                   	ret
+        return -E_INVAL;
+  802a53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a58:	eb ed                	jmp    802a47 <devfile_accept_snapshot+0x5e>
+
+0000000000802a5a <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802a5a:	48 85 ff             	test   %rdi,%rdi
+  802a5d:	0f 84 9f 00 00 00    	je     802b02 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802a63:	55                   	push   %rbp
+  802a64:	48 89 e5             	mov    %rsp,%rbp
+  802a67:	41 54                	push   %r12
+  802a69:	53                   	push   %rbx
+  802a6a:	48 89 fb             	mov    %rdi,%rbx
+  802a6d:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802a70:	48 85 f6             	test   %rsi,%rsi
+  802a73:	74 78                	je     802aed <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802a75:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+  802a81:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a87:	77 6b                	ja     802af4 <devfile_create_snapshot+0x9a>
+  802a89:	4c 89 e7             	mov    %r12,%rdi
+  802a8c:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802a93:	00 00 00 
+  802a96:	ff d0                	call   *%rax
+  802a98:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a9e:	77 5b                	ja     802afb <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802aa0:	48 89 de             	mov    %rbx,%rsi
+  802aa3:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802aaa:	00 00 00 
+  802aad:	48 bb a2 0b 80 00 00 	movabs $0x800ba2,%rbx
+  802ab4:	00 00 00 
+  802ab7:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802ab9:	4c 89 e6             	mov    %r12,%rsi
+  802abc:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802ac3:	00 00 00 
+  802ac6:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802ac8:	be 00 00 00 00       	mov    $0x0,%esi
+  802acd:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ad2:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ade:	85 c0                	test   %eax,%eax
+  802ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ae8:	5b                   	pop    %rbx
+  802ae9:	41 5c                	pop    %r12
+  802aeb:	5d                   	pop    %rbp
+  802aec:	c3                   	ret
+        return -E_INVAL;
+  802aed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af2:	eb f4                	jmp    802ae8 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af9:	eb ed                	jmp    802ae8 <devfile_create_snapshot+0x8e>
+  802afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b00:	eb e6                	jmp    802ae8 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b07:	c3                   	ret
+
+0000000000802b08 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b08:	55                   	push   %rbp
+  802b09:	48 89 e5             	mov    %rsp,%rbp
+  802b0c:	41 54                	push   %r12
+  802b0e:	53                   	push   %rbx
+  802b0f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b12:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b15:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802b1c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802b23:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b28:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802b2f:	00 00 00 
+  802b32:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b34:	85 c0                	test   %eax,%eax
+  802b36:	78 3d                	js     802b75 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b38:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802b3f:	00 00 00 
+  802b42:	4c 89 e6             	mov    %r12,%rsi
+  802b45:	48 89 df             	mov    %rbx,%rdi
+  802b48:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  802b4f:	00 00 00 
+  802b52:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b54:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b5b:	00 
+  802b5c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b62:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b69:	00 
+  802b6a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b75:	5b                   	pop    %rbx
+  802b76:	41 5c                	pop    %r12
+  802b78:	5d                   	pop    %rbp
+  802b79:	c3                   	ret
+
+0000000000802b7a <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802b7a:	55                   	push   %rbp
+  802b7b:	48 89 e5             	mov    %rsp,%rbp
+  802b7e:	41 57                	push   %r15
+  802b80:	41 56                	push   %r14
+  802b82:	41 55                	push   %r13
+  802b84:	41 54                	push   %r12
+  802b86:	53                   	push   %rbx
+  802b87:	48 83 ec 38          	sub    $0x38,%rsp
+  802b8b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802b8f:	49 89 f5             	mov    %rsi,%r13
+  802b92:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b95:	48 89 f0             	mov    %rsi,%rax
+  802b98:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b9d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ba1:	75 4f                	jne    802bf2 <devfile_readmap+0x78>
+  802ba3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ba7:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802bad:	75 1f                	jne    802bce <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802baf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bb3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802bb7:	49 be 62 33 80 00 00 	movabs $0x803362,%r14
+  802bbe:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802bc1:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802bc8:	0f 87 9d 00 00 00    	ja     802c6b <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802bce:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bd2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802bd6:	4d 85 ff             	test   %r15,%r15
+  802bd9:	0f 85 cf 00 00 00    	jne    802cae <devfile_readmap+0x134>
+  802bdf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802be3:	48 83 c4 38          	add    $0x38,%rsp
+  802be7:	5b                   	pop    %rbx
+  802be8:	41 5c                	pop    %r12
+  802bea:	41 5d                	pop    %r13
+  802bec:	41 5e                	pop    %r14
+  802bee:	41 5f                	pop    %r15
+  802bf0:	5d                   	pop    %rbp
+  802bf1:	c3                   	ret
+    size_t totalRead = 0;
+  802bf2:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802bf9:	00 
+  802bfa:	eb da                	jmp    802bd6 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bfc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c00:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c03:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802c0a:	00 00 00 
+  802c0d:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802c0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c13:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802c17:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c1b:	4c 89 ee             	mov    %r13,%rsi
+  802c1e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c23:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  802c2a:	00 00 00 
+  802c2d:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c2f:	85 c0                	test   %eax,%eax
+  802c31:	7e a3                	jle    802bd6 <devfile_readmap+0x5c>
+  802c33:	48 98                	cltq
+  802c35:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c39:	72 9b                	jb     802bd6 <devfile_readmap+0x5c>
+        buf += read;
+  802c3b:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c3e:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c41:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c45:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c4c:	75 88                	jne    802bd6 <devfile_readmap+0x5c>
+  802c4e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c52:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c58:	0f 85 78 ff ff ff    	jne    802bd6 <devfile_readmap+0x5c>
+  802c5e:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802c65:	0f 86 6b ff ff ff    	jbe    802bd6 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802c6b:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802c71:	4d 39 e7             	cmp    %r12,%r15
+  802c74:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802c78:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802c7f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c83:	0f 84 73 ff ff ff    	je     802bfc <devfile_readmap+0x82>
+  802c89:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c8d:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802c92:	41 ff d6             	call   *%r14
+  802c95:	a8 40                	test   $0x40,%al
+  802c97:	0f 85 39 ff ff ff    	jne    802bd6 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c9d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ca4:	4c 39 e3             	cmp    %r12,%rbx
+  802ca7:	72 e4                	jb     802c8d <devfile_readmap+0x113>
+  802ca9:	e9 4e ff ff ff       	jmp    802bfc <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802cae:	4c 89 fa             	mov    %r15,%rdx
+  802cb1:	4c 89 ee             	mov    %r13,%rsi
+  802cb4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802cb8:	48 b8 fb 25 80 00 00 	movabs $0x8025fb,%rax
+  802cbf:	00 00 00 
+  802cc2:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802cc4:	48 85 c0             	test   %rax,%rax
+  802cc7:	78 0c                	js     802cd5 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802cc9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ccd:	48 01 f0             	add    %rsi,%rax
+  802cd0:	e9 0e ff ff ff       	jmp    802be3 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802cd5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cd9:	48 85 f6             	test   %rsi,%rsi
+  802cdc:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ce0:	e9 fe fe ff ff       	jmp    802be3 <devfile_readmap+0x69>
+
+0000000000802ce5 <open>:
+open(const char *path, int mode) {
+  802ce5:	55                   	push   %rbp
+  802ce6:	48 89 e5             	mov    %rsp,%rbp
+  802ce9:	41 55                	push   %r13
+  802ceb:	41 54                	push   %r12
+  802ced:	53                   	push   %rbx
+  802cee:	48 83 ec 18          	sub    $0x18,%rsp
+  802cf2:	49 89 fc             	mov    %rdi,%r12
+  802cf5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cf8:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+  802d04:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d0a:	0f 87 8a 00 00 00    	ja     802d9a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d10:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d14:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  802d1b:	00 00 00 
+  802d1e:	ff d0                	call   *%rax
+  802d20:	89 c3                	mov    %eax,%ebx
+  802d22:	85 c0                	test   %eax,%eax
+  802d24:	78 50                	js     802d76 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d26:	4c 89 e6             	mov    %r12,%rsi
+  802d29:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802d30:	00 00 00 
+  802d33:	48 89 df             	mov    %rbx,%rdi
+  802d36:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d42:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d49:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d4d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d52:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802d59:	00 00 00 
+  802d5c:	ff d0                	call   *%rax
+  802d5e:	89 c3                	mov    %eax,%ebx
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	78 1f                	js     802d83 <open+0x9e>
+    return fd2num(fd);
+  802d64:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d68:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+  802d74:	89 c3                	mov    %eax,%ebx
+}
+  802d76:	89 d8                	mov    %ebx,%eax
+  802d78:	48 83 c4 18          	add    $0x18,%rsp
+  802d7c:	5b                   	pop    %rbx
+  802d7d:	41 5c                	pop    %r12
+  802d7f:	41 5d                	pop    %r13
+  802d81:	5d                   	pop    %rbp
+  802d82:	c3                   	ret
+        fd_close(fd, 0);
+  802d83:	be 00 00 00 00       	mov    $0x0,%esi
+  802d88:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d8c:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+        return res;
+  802d98:	eb dc                	jmp    802d76 <open+0x91>
+        return -E_BAD_PATH;
+  802d9a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d9f:	eb d5                	jmp    802d76 <open+0x91>
+
+0000000000802da1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802da1:	55                   	push   %rbp
+  802da2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802da5:	be 00 00 00 00       	mov    $0x0,%esi
+  802daa:	bf 13 00 00 00       	mov    $0x13,%edi
+  802daf:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802db6:	00 00 00 
+  802db9:	ff d0                	call   *%rax
+}
+  802dbb:	5d                   	pop    %rbp
+  802dbc:	c3                   	ret
+
+0000000000802dbd <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802dbd:	55                   	push   %rbp
+  802dbe:	48 89 e5             	mov    %rsp,%rbp
+  802dc1:	41 54                	push   %r12
+  802dc3:	53                   	push   %rbx
+  802dc4:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802dc7:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  802dce:	00 00 00 
+  802dd1:	ff d0                	call   *%rax
+  802dd3:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802dd6:	48 be c0 3d 80 00 00 	movabs $0x803dc0,%rsi
+  802ddd:	00 00 00 
+  802de0:	48 89 df             	mov    %rbx,%rdi
+  802de3:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  802dea:	00 00 00 
+  802ded:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802def:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802df4:	41 2b 04 24          	sub    (%r12),%eax
+  802df8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802dfe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e05:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e08:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802e0f:	00 00 00 
+  802e12:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1e:	5b                   	pop    %rbx
+  802e1f:	41 5c                	pop    %r12
+  802e21:	5d                   	pop    %rbp
+  802e22:	c3                   	ret
+
+0000000000802e23 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802e23:	55                   	push   %rbp
+  802e24:	48 89 e5             	mov    %rsp,%rbp
+  802e27:	41 54                	push   %r12
+  802e29:	53                   	push   %rbx
+  802e2a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e32:	48 89 fe             	mov    %rdi,%rsi
+  802e35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e3a:	49 bc fa 12 80 00 00 	movabs $0x8012fa,%r12
+  802e41:	00 00 00 
+  802e44:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802e47:	48 89 df             	mov    %rbx,%rdi
+  802e4a:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+  802e56:	48 89 c6             	mov    %rax,%rsi
+  802e59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e63:	41 ff d4             	call   *%r12
+}
+  802e66:	5b                   	pop    %rbx
+  802e67:	41 5c                	pop    %r12
+  802e69:	5d                   	pop    %rbp
+  802e6a:	c3                   	ret
+
+0000000000802e6b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	41 57                	push   %r15
+  802e71:	41 56                	push   %r14
+  802e73:	41 55                	push   %r13
+  802e75:	41 54                	push   %r12
+  802e77:	53                   	push   %rbx
+  802e78:	48 83 ec 18          	sub    $0x18,%rsp
+  802e7c:	49 89 fc             	mov    %rdi,%r12
+  802e7f:	49 89 f5             	mov    %rsi,%r13
+  802e82:	49 89 d7             	mov    %rdx,%r15
+  802e85:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e89:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802e95:	4d 85 ff             	test   %r15,%r15
+  802e98:	0f 84 af 00 00 00    	je     802f4d <devpipe_write+0xe2>
+  802e9e:	48 89 c3             	mov    %rax,%rbx
+  802ea1:	4c 89 f8             	mov    %r15,%rax
+  802ea4:	4d 89 ef             	mov    %r13,%r15
+  802ea7:	4c 01 e8             	add    %r13,%rax
+  802eaa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802eae:	49 bd 02 12 80 00 00 	movabs $0x801202,%r13
+  802eb5:	00 00 00 
+            sys_yield();
+  802eb8:	49 be 9f 11 80 00 00 	movabs $0x80119f,%r14
+  802ebf:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802ec2:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ec5:	48 63 ce             	movslq %esi,%rcx
+  802ec8:	48 63 03             	movslq (%rbx),%rax
+  802ecb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ed1:	48 39 c1             	cmp    %rax,%rcx
+  802ed4:	72 2e                	jb     802f04 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ed6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802edb:	48 89 da             	mov    %rbx,%rdx
+  802ede:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ee3:	4c 89 e7             	mov    %r12,%rdi
+  802ee6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802ee9:	85 c0                	test   %eax,%eax
+  802eeb:	74 66                	je     802f53 <devpipe_write+0xe8>
+            sys_yield();
+  802eed:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802ef0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ef3:	48 63 ce             	movslq %esi,%rcx
+  802ef6:	48 63 03             	movslq (%rbx),%rax
+  802ef9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802eff:	48 39 c1             	cmp    %rax,%rcx
+  802f02:	73 d2                	jae    802ed6 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f04:	41 0f b6 3f          	movzbl (%r15),%edi
+  802f08:	48 89 ca             	mov    %rcx,%rdx
+  802f0b:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f0f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f16:	08 10 20 
+  802f19:	48 f7 e2             	mul    %rdx
+  802f1c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f20:	48 89 d0             	mov    %rdx,%rax
+  802f23:	48 c1 e0 09          	shl    $0x9,%rax
+  802f27:	48 29 d0             	sub    %rdx,%rax
+  802f2a:	48 c1 e0 03          	shl    $0x3,%rax
+  802f2e:	48 29 c1             	sub    %rax,%rcx
+  802f31:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802f36:	83 c6 01             	add    $0x1,%esi
+  802f39:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f3c:	49 83 c7 01          	add    $0x1,%r15
+  802f40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f44:	49 39 c7             	cmp    %rax,%r15
+  802f47:	0f 85 75 ff ff ff    	jne    802ec2 <devpipe_write+0x57>
+    return n;
+  802f4d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f51:	eb 05                	jmp    802f58 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f58:	48 83 c4 18          	add    $0x18,%rsp
+  802f5c:	5b                   	pop    %rbx
+  802f5d:	41 5c                	pop    %r12
+  802f5f:	41 5d                	pop    %r13
+  802f61:	41 5e                	pop    %r14
+  802f63:	41 5f                	pop    %r15
+  802f65:	5d                   	pop    %rbp
+  802f66:	c3                   	ret
+
+0000000000802f67 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f67:	55                   	push   %rbp
+  802f68:	48 89 e5             	mov    %rsp,%rbp
+  802f6b:	41 57                	push   %r15
+  802f6d:	41 56                	push   %r14
+  802f6f:	41 55                	push   %r13
+  802f71:	41 54                	push   %r12
+  802f73:	53                   	push   %rbx
+  802f74:	48 83 ec 18          	sub    $0x18,%rsp
+  802f78:	49 89 fc             	mov    %rdi,%r12
+  802f7b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f7f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f83:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802f92:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f98:	49 bd 02 12 80 00 00 	movabs $0x801202,%r13
+  802f9f:	00 00 00 
+            sys_yield();
+  802fa2:	49 be 9f 11 80 00 00 	movabs $0x80119f,%r14
+  802fa9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802fac:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fb1:	74 7d                	je     803030 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802fb3:	8b 03                	mov    (%rbx),%eax
+  802fb5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802fb8:	75 26                	jne    802fe0 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802fba:	4d 85 ff             	test   %r15,%r15
+  802fbd:	75 77                	jne    803036 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fbf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fc4:	48 89 da             	mov    %rbx,%rdx
+  802fc7:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fcc:	4c 89 e7             	mov    %r12,%rdi
+  802fcf:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802fd2:	85 c0                	test   %eax,%eax
+  802fd4:	74 72                	je     803048 <devpipe_read+0xe1>
+            sys_yield();
+  802fd6:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802fd9:	8b 03                	mov    (%rbx),%eax
+  802fdb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802fde:	74 df                	je     802fbf <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fe0:	48 63 c8             	movslq %eax,%rcx
+  802fe3:	48 89 ca             	mov    %rcx,%rdx
+  802fe6:	48 c1 ea 03          	shr    $0x3,%rdx
+  802fea:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802ff1:	08 10 20 
+  802ff4:	48 89 d0             	mov    %rdx,%rax
+  802ff7:	48 f7 e6             	mul    %rsi
+  802ffa:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ffe:	48 89 d0             	mov    %rdx,%rax
+  803001:	48 c1 e0 09          	shl    $0x9,%rax
+  803005:	48 29 d0             	sub    %rdx,%rax
+  803008:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80300f:	00 
+  803010:	48 89 c8             	mov    %rcx,%rax
+  803013:	48 29 d0             	sub    %rdx,%rax
+  803016:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80301b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80301f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803023:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803026:	49 83 c7 01          	add    $0x1,%r15
+  80302a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80302e:	75 83                	jne    802fb3 <devpipe_read+0x4c>
+    return n;
+  803030:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803034:	eb 03                	jmp    803039 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803036:	4c 89 f8             	mov    %r15,%rax
+}
+  803039:	48 83 c4 18          	add    $0x18,%rsp
+  80303d:	5b                   	pop    %rbx
+  80303e:	41 5c                	pop    %r12
+  803040:	41 5d                	pop    %r13
+  803042:	41 5e                	pop    %r14
+  803044:	41 5f                	pop    %r15
+  803046:	5d                   	pop    %rbp
+  803047:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304d:	eb ea                	jmp    803039 <devpipe_read+0xd2>
+
+000000000080304f <pipe>:
+pipe(int pfd[2]) {
+  80304f:	55                   	push   %rbp
+  803050:	48 89 e5             	mov    %rsp,%rbp
+  803053:	41 55                	push   %r13
+  803055:	41 54                	push   %r12
+  803057:	53                   	push   %rbx
+  803058:	48 83 ec 18          	sub    $0x18,%rsp
+  80305c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80305f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803063:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+  80306f:	89 c3                	mov    %eax,%ebx
+  803071:	85 c0                	test   %eax,%eax
+  803073:	0f 88 a0 01 00 00    	js     803219 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803079:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80307e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803083:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80308c:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  803093:	00 00 00 
+  803096:	ff d0                	call   *%rax
+  803098:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80309a:	85 c0                	test   %eax,%eax
+  80309c:	0f 88 77 01 00 00    	js     803219 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030a2:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8030a6:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+  8030b2:	89 c3                	mov    %eax,%ebx
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	0f 88 43 01 00 00    	js     8031ff <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030bc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030cf:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 88 1a 01 00 00    	js     8031ff <pipe+0x1b0>
+    va = fd2data(fd0);
+  8030e5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030e9:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  8030f0:	00 00 00 
+  8030f3:	ff d0                	call   *%rax
+  8030f5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8030f8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803102:	48 89 c6             	mov    %rax,%rsi
+  803105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310a:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  803111:	00 00 00 
+  803114:	ff d0                	call   *%rax
+  803116:	89 c3                	mov    %eax,%ebx
+  803118:	85 c0                	test   %eax,%eax
+  80311a:	0f 88 c5 00 00 00    	js     8031e5 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803120:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803124:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  80312b:	00 00 00 
+  80312e:	ff d0                	call   *%rax
+  803130:	48 89 c1             	mov    %rax,%rcx
+  803133:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803139:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80313f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803144:	4c 89 ee             	mov    %r13,%rsi
+  803147:	bf 00 00 00 00       	mov    $0x0,%edi
+  80314c:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+  803158:	89 c3                	mov    %eax,%ebx
+  80315a:	85 c0                	test   %eax,%eax
+  80315c:	78 6e                	js     8031cc <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80315e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803163:	4c 89 ef             	mov    %r13,%rdi
+  803166:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  80316d:	00 00 00 
+  803170:	ff d0                	call   *%rax
+  803172:	83 f8 02             	cmp    $0x2,%eax
+  803175:	0f 85 ab 00 00 00    	jne    803226 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80317b:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  803182:	00 00 
+  803184:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803188:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80318a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80318e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803195:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803199:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80319b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80319f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031a6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031aa:	48 bb 15 18 80 00 00 	movabs $0x801815,%rbx
+  8031b1:	00 00 00 
+  8031b4:	ff d3                	call   *%rbx
+  8031b6:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8031ba:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8031be:	ff d3                	call   *%rbx
+  8031c0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8031c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031ca:	eb 4d                	jmp    803219 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8031cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031d1:	4c 89 ee             	mov    %r13,%rsi
+  8031d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d9:	48 b8 fa 12 80 00 00 	movabs $0x8012fa,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8031e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ea:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8031ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f3:	48 b8 fa 12 80 00 00 	movabs $0x8012fa,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8031ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803204:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803208:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320d:	48 b8 fa 12 80 00 00 	movabs $0x8012fa,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+}
+  803219:	89 d8                	mov    %ebx,%eax
+  80321b:	48 83 c4 18          	add    $0x18,%rsp
+  80321f:	5b                   	pop    %rbx
+  803220:	41 5c                	pop    %r12
+  803222:	41 5d                	pop    %r13
+  803224:	5d                   	pop    %rbp
+  803225:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803226:	48 b9 f0 3d 80 00 00 	movabs $0x803df0,%rcx
+  80322d:	00 00 00 
+  803230:	48 ba c7 3d 80 00 00 	movabs $0x803dc7,%rdx
+  803237:	00 00 00 
+  80323a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80323f:	48 bf dc 3d 80 00 00 	movabs $0x803ddc,%rdi
+  803246:	00 00 00 
+  803249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324e:	49 b8 a6 36 80 00 00 	movabs $0x8036a6,%r8
+  803255:	00 00 00 
+  803258:	41 ff d0             	call   *%r8
+
+000000000080325b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803263:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803267:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  80326e:	00 00 00 
+  803271:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803273:	85 c0                	test   %eax,%eax
+  803275:	78 35                	js     8032ac <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803277:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80327b:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80328a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80328f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803294:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803298:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	0f 94 c0             	sete   %al
+  8032a9:	0f b6 c0             	movzbl %al,%eax
+}
+  8032ac:	c9                   	leave
+  8032ad:	c3                   	ret
+
+00000000008032ae <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032ae:	48 89 f8             	mov    %rdi,%rax
+  8032b1:	48 c1 e8 27          	shr    $0x27,%rax
+  8032b5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032bc:	01 00 00 
+  8032bf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032c3:	f6 c2 01             	test   $0x1,%dl
+  8032c6:	74 6d                	je     803335 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8032c8:	48 89 f8             	mov    %rdi,%rax
+  8032cb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032cf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032d6:	01 00 00 
+  8032d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032dd:	f6 c2 01             	test   $0x1,%dl
+  8032e0:	74 62                	je     803344 <get_uvpt_entry+0x96>
+  8032e2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032e9:	01 00 00 
+  8032ec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032f0:	f6 c2 80             	test   $0x80,%dl
+  8032f3:	75 4f                	jne    803344 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8032f5:	48 89 f8             	mov    %rdi,%rax
+  8032f8:	48 c1 e8 15          	shr    $0x15,%rax
+  8032fc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803303:	01 00 00 
+  803306:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80330a:	f6 c2 01             	test   $0x1,%dl
+  80330d:	74 44                	je     803353 <get_uvpt_entry+0xa5>
+  80330f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803316:	01 00 00 
+  803319:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80331d:	f6 c2 80             	test   $0x80,%dl
+  803320:	75 31                	jne    803353 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803322:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803326:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80332d:	01 00 00 
+  803330:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803334:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803335:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80333c:	01 00 00 
+  80333f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803343:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803344:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80334b:	01 00 00 
+  80334e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803352:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803353:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80335a:	01 00 00 
+  80335d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803361:	c3                   	ret
+
+0000000000803362 <get_prot>:
+
+int
+get_prot(void *va) {
+  803362:	55                   	push   %rbp
+  803363:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803366:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+  803372:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803375:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80337a:	89 c1                	mov    %eax,%ecx
+  80337c:	83 c9 04             	or     $0x4,%ecx
+  80337f:	f6 c2 01             	test   $0x1,%dl
+  803382:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803385:	89 c1                	mov    %eax,%ecx
+  803387:	83 c9 02             	or     $0x2,%ecx
+  80338a:	f6 c2 02             	test   $0x2,%dl
+  80338d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803390:	89 c1                	mov    %eax,%ecx
+  803392:	83 c9 01             	or     $0x1,%ecx
+  803395:	48 85 d2             	test   %rdx,%rdx
+  803398:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80339b:	89 c1                	mov    %eax,%ecx
+  80339d:	83 c9 40             	or     $0x40,%ecx
+  8033a0:	f6 c6 04             	test   $0x4,%dh
+  8033a3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8033a6:	5d                   	pop    %rbp
+  8033a7:	c3                   	ret
+
+00000000008033a8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8033a8:	55                   	push   %rbp
+  8033a9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033ac:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  8033b3:	00 00 00 
+  8033b6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8033b8:	48 c1 e8 06          	shr    $0x6,%rax
+  8033bc:	83 e0 01             	and    $0x1,%eax
+}
+  8033bf:	5d                   	pop    %rbp
+  8033c0:	c3                   	ret
+
+00000000008033c1 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8033c1:	55                   	push   %rbp
+  8033c2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033c5:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  8033cc:	00 00 00 
+  8033cf:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8033d1:	48 c1 e8 05          	shr    $0x5,%rax
+  8033d5:	83 e0 01             	and    $0x1,%eax
+}
+  8033d8:	5d                   	pop    %rbp
+  8033d9:	c3                   	ret
+
+00000000008033da <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8033da:	55                   	push   %rbp
+  8033db:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8033de:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	83 e0 01             	and    $0x1,%eax
+}
+  8033ed:	5d                   	pop    %rbp
+  8033ee:	c3                   	ret
+
+00000000008033ef <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8033ef:	55                   	push   %rbp
+  8033f0:	48 89 e5             	mov    %rsp,%rbp
+  8033f3:	41 57                	push   %r15
+  8033f5:	41 56                	push   %r14
+  8033f7:	41 55                	push   %r13
+  8033f9:	41 54                	push   %r12
+  8033fb:	53                   	push   %rbx
+  8033fc:	48 83 ec 18          	sub    $0x18,%rsp
+  803400:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803404:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803408:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80340d:	49 bd da 33 80 00 00 	movabs $0x8033da,%r13
+  803414:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803417:	49 bf 62 33 80 00 00 	movabs $0x803362,%r15
+  80341e:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803421:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803428:	00 00 00 
+  80342b:	eb 0c                	jmp    803439 <foreach_shared_region+0x4a>
+  80342d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803434:	4c 39 f3             	cmp    %r14,%rbx
+  803437:	74 2e                	je     803467 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803439:	48 89 df             	mov    %rbx,%rdi
+  80343c:	41 ff d5             	call   *%r13
+  80343f:	84 c0                	test   %al,%al
+  803441:	74 ea                	je     80342d <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803443:	48 89 df             	mov    %rbx,%rdi
+  803446:	41 ff d7             	call   *%r15
+  803449:	a8 40                	test   $0x40,%al
+  80344b:	74 e0                	je     80342d <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80344d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803454:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803458:	48 89 df             	mov    %rbx,%rdi
+  80345b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80345f:	ff d0                	call   *%rax
+				if (res < 0) {
+  803461:	85 c0                	test   %eax,%eax
+  803463:	79 c8                	jns    80342d <foreach_shared_region+0x3e>
+  803465:	eb 05                	jmp    80346c <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803467:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346c:	48 83 c4 18          	add    $0x18,%rsp
+  803470:	5b                   	pop    %rbx
+  803471:	41 5c                	pop    %r12
+  803473:	41 5d                	pop    %r13
+  803475:	41 5e                	pop    %r14
+  803477:	41 5f                	pop    %r15
+  803479:	5d                   	pop    %rbp
+  80347a:	c3                   	ret
+
+000000000080347b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803480:	c3                   	ret
+
+0000000000803481 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803481:	55                   	push   %rbp
+  803482:	48 89 e5             	mov    %rsp,%rbp
+  803485:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803488:	48 be 14 3e 80 00 00 	movabs $0x803e14,%rsi
+  80348f:	00 00 00 
+  803492:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  803499:	00 00 00 
+  80349c:	ff d0                	call   *%rax
+    return 0;
+}
+  80349e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a3:	5d                   	pop    %rbp
+  8034a4:	c3                   	ret
+
+00000000008034a5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034a5:	55                   	push   %rbp
+  8034a6:	48 89 e5             	mov    %rsp,%rbp
+  8034a9:	41 57                	push   %r15
+  8034ab:	41 56                	push   %r14
+  8034ad:	41 55                	push   %r13
+  8034af:	41 54                	push   %r12
+  8034b1:	53                   	push   %rbx
+  8034b2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8034b9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8034c0:	48 85 d2             	test   %rdx,%rdx
+  8034c3:	74 7a                	je     80353f <devcons_write+0x9a>
+  8034c5:	49 89 d6             	mov    %rdx,%r14
+  8034c8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8034ce:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8034d3:	49 bf 9c 0d 80 00 00 	movabs $0x800d9c,%r15
+  8034da:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8034dd:	4c 89 f3             	mov    %r14,%rbx
+  8034e0:	48 29 f3             	sub    %rsi,%rbx
+  8034e3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034e8:	48 39 c3             	cmp    %rax,%rbx
+  8034eb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8034ef:	4c 63 eb             	movslq %ebx,%r13
+  8034f2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8034f9:	48 01 c6             	add    %rax,%rsi
+  8034fc:	4c 89 ea             	mov    %r13,%rdx
+  8034ff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803506:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803509:	4c 89 ee             	mov    %r13,%rsi
+  80350c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803513:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  80351a:	00 00 00 
+  80351d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80351f:	41 01 dc             	add    %ebx,%r12d
+  803522:	49 63 f4             	movslq %r12d,%rsi
+  803525:	4c 39 f6             	cmp    %r14,%rsi
+  803528:	72 b3                	jb     8034dd <devcons_write+0x38>
+    return res;
+  80352a:	49 63 c4             	movslq %r12d,%rax
+}
+  80352d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803534:	5b                   	pop    %rbx
+  803535:	41 5c                	pop    %r12
+  803537:	41 5d                	pop    %r13
+  803539:	41 5e                	pop    %r14
+  80353b:	41 5f                	pop    %r15
+  80353d:	5d                   	pop    %rbp
+  80353e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80353f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803545:	eb e3                	jmp    80352a <devcons_write+0x85>
+
+0000000000803547 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803547:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80354a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354f:	48 85 c0             	test   %rax,%rax
+  803552:	74 55                	je     8035a9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803554:	55                   	push   %rbp
+  803555:	48 89 e5             	mov    %rsp,%rbp
+  803558:	41 55                	push   %r13
+  80355a:	41 54                	push   %r12
+  80355c:	53                   	push   %rbx
+  80355d:	48 83 ec 08          	sub    $0x8,%rsp
+  803561:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803564:	48 bb d2 10 80 00 00 	movabs $0x8010d2,%rbx
+  80356b:	00 00 00 
+  80356e:	49 bc 9f 11 80 00 00 	movabs $0x80119f,%r12
+  803575:	00 00 00 
+  803578:	eb 03                	jmp    80357d <devcons_read+0x36>
+  80357a:	41 ff d4             	call   *%r12
+  80357d:	ff d3                	call   *%rbx
+  80357f:	85 c0                	test   %eax,%eax
+  803581:	74 f7                	je     80357a <devcons_read+0x33>
+    if (c < 0) return c;
+  803583:	48 63 d0             	movslq %eax,%rdx
+  803586:	78 13                	js     80359b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803588:	ba 00 00 00 00       	mov    $0x0,%edx
+  80358d:	83 f8 04             	cmp    $0x4,%eax
+  803590:	74 09                	je     80359b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803592:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803596:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80359b:	48 89 d0             	mov    %rdx,%rax
+  80359e:	48 83 c4 08          	add    $0x8,%rsp
+  8035a2:	5b                   	pop    %rbx
+  8035a3:	41 5c                	pop    %r12
+  8035a5:	41 5d                	pop    %r13
+  8035a7:	5d                   	pop    %rbp
+  8035a8:	c3                   	ret
+  8035a9:	48 89 d0             	mov    %rdx,%rax
+  8035ac:	c3                   	ret
+
+00000000008035ad <cputchar>:
+cputchar(int ch) {
+  8035ad:	55                   	push   %rbp
+  8035ae:	48 89 e5             	mov    %rsp,%rbp
+  8035b1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8035b5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8035b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8035be:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8035c2:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  8035c9:	00 00 00 
+  8035cc:	ff d0                	call   *%rax
+}
+  8035ce:	c9                   	leave
+  8035cf:	c3                   	ret
+
+00000000008035d0 <getchar>:
+getchar(void) {
+  8035d0:	55                   	push   %rbp
+  8035d1:	48 89 e5             	mov    %rsp,%rbp
+  8035d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8035d8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035dd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8035e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e6:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+  8035f2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8035f4:	85 c0                	test   %eax,%eax
+  8035f6:	78 06                	js     8035fe <getchar+0x2e>
+  8035f8:	74 08                	je     803602 <getchar+0x32>
+  8035fa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8035fe:	89 d0                	mov    %edx,%eax
+  803600:	c9                   	leave
+  803601:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803602:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803607:	eb f5                	jmp    8035fe <getchar+0x2e>
+
+0000000000803609 <iscons>:
+iscons(int fdnum) {
+  803609:	55                   	push   %rbp
+  80360a:	48 89 e5             	mov    %rsp,%rbp
+  80360d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803611:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803615:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  80361c:	00 00 00 
+  80361f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803621:	85 c0                	test   %eax,%eax
+  803623:	78 18                	js     80363d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803625:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803629:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803630:	00 00 00 
+  803633:	8b 00                	mov    (%rax),%eax
+  803635:	39 02                	cmp    %eax,(%rdx)
+  803637:	0f 94 c0             	sete   %al
+  80363a:	0f b6 c0             	movzbl %al,%eax
+}
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+
+000000000080363f <opencons>:
+opencons(void) {
+  80363f:	55                   	push   %rbp
+  803640:	48 89 e5             	mov    %rsp,%rbp
+  803643:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803647:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80364b:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+  803657:	85 c0                	test   %eax,%eax
+  803659:	78 49                	js     8036a4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80365b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803660:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803665:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366e:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  803675:	00 00 00 
+  803678:	ff d0                	call   *%rax
+  80367a:	85 c0                	test   %eax,%eax
+  80367c:	78 26                	js     8036a4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80367e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803682:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  803689:	00 00 
+  80368b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80368d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803691:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803698:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  80369f:	00 00 00 
+  8036a2:	ff d0                	call   *%rax
+}
+  8036a4:	c9                   	leave
+  8036a5:	c3                   	ret
+
+00000000008036a6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8036a6:	55                   	push   %rbp
+  8036a7:	48 89 e5             	mov    %rsp,%rbp
+  8036aa:	41 56                	push   %r14
+  8036ac:	41 55                	push   %r13
+  8036ae:	41 54                	push   %r12
+  8036b0:	53                   	push   %rbx
+  8036b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8036b5:	49 89 fc             	mov    %rdi,%r12
+  8036b8:	41 89 f5             	mov    %esi,%r13d
+  8036bb:	48 89 d3             	mov    %rdx,%rbx
+  8036be:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8036c2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8036c6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8036ca:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8036d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8036d5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8036d9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8036dd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8036e1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8036e8:	00 00 00 
+  8036eb:	4c 8b 30             	mov    (%rax),%r14
+  8036ee:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  8036f5:	00 00 00 
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	89 c6                	mov    %eax,%esi
+  8036fc:	45 89 e8             	mov    %r13d,%r8d
+  8036ff:	4c 89 e1             	mov    %r12,%rcx
+  803702:	4c 89 f2             	mov    %r14,%rdx
+  803705:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  80370c:	00 00 00 
+  80370f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803714:	49 bc 7d 02 80 00 00 	movabs $0x80027d,%r12
+  80371b:	00 00 00 
+  80371e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803721:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803725:	48 89 df             	mov    %rbx,%rdi
+  803728:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  80372f:	00 00 00 
+  803732:	ff d0                	call   *%rax
+    cprintf("\n");
+  803734:	48 bf 73 3d 80 00 00 	movabs $0x803d73,%rdi
+  80373b:	00 00 00 
+  80373e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803743:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803746:	cc                   	int3
+  803747:	eb fd                	jmp    803746 <_panic+0xa0>
+  803749:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803750 <__rodata_start>:
+  803750:	25 78 20 72 65       	and    $0x65722078,%eax
+  803755:	63 76 20             	movsxd 0x20(%rsi),%esi
+  803758:	66 72 6f             	data16 jb 8037ca <__rodata_start+0x7a>
+  80375b:	6d                   	insl   (%dx),%es:(%rdi)
+  80375c:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258041da <__bss_end+0x24ffc1da>
+  803762:	78 20                	js     803784 <__rodata_start+0x34>
+  803764:	6c                   	insb   (%dx),%es:(%rdi)
+  803765:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803766:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803767:	70 20                	jo     803789 <__rodata_start+0x39>
+  803769:	73 65                	jae    8037d0 <__rodata_start+0x80>
+  80376b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80376c:	64 69 6e 67 20 74 6f 	imul   $0x206f7420,%fs:0x67(%rsi),%ebp
+  803773:	20 
+  803774:	25 78 0a 00 3c       	and    $0x3c000a78,%eax
+  803779:	75 6e                	jne    8037e9 <__rodata_start+0x99>
+  80377b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80377f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803780:	3e 00 30             	ds add %dh,(%rax)
+  803783:	31 32                	xor    %esi,(%rdx)
+  803785:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80378c:	41                   	rex.B
+  80378d:	42                   	rex.X
+  80378e:	43                   	rex.XB
+  80378f:	44                   	rex.R
+  803790:	45                   	rex.RB
+  803791:	46 00 30             	rex.RX add %r14b,(%rax)
+  803794:	31 32                	xor    %esi,(%rdx)
+  803796:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80379d:	61                   	(bad)
+  80379e:	62 63 64 65 66       	(bad)
+  8037a3:	00 28                	add    %ch,(%rax)
+  8037a5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a6:	75 6c                	jne    803814 <__rodata_start+0xc4>
+  8037a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a9:	29 00                	sub    %eax,(%rax)
+  8037ab:	65 72 72             	gs jb  803820 <__rodata_start+0xd0>
+  8037ae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037af:	72 20                	jb     8037d1 <__rodata_start+0x81>
+  8037b1:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8037b6:	73 70                	jae    803828 <__rodata_start+0xd8>
+  8037b8:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8037bc:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8037c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c4:	72 00                	jb     8037c6 <__rodata_start+0x76>
+  8037c6:	62 61 64 20 65       	(bad)
+  8037cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037cc:	76 69                	jbe    803837 <__rodata_start+0xe7>
+  8037ce:	72 6f                	jb     80383f <__rodata_start+0xef>
+  8037d0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037d1:	6d                   	insl   (%dx),%es:(%rdi)
+  8037d2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037d4:	74 00                	je     8037d6 <__rodata_start+0x86>
+  8037d6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8037dd:	20 70 61             	and    %dh,0x61(%rax)
+  8037e0:	72 61                	jb     803843 <__rodata_start+0xf3>
+  8037e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8037e3:	65 74 65             	gs je  80384b <__rodata_start+0xfb>
+  8037e6:	72 00                	jb     8037e8 <__rodata_start+0x98>
+  8037e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037e9:	75 74                	jne    80385f <__rodata_start+0x10f>
+  8037eb:	20 6f 66             	and    %ch,0x66(%rdi)
+  8037ee:	20 6d 65             	and    %ch,0x65(%rbp)
+  8037f1:	6d                   	insl   (%dx),%es:(%rdi)
+  8037f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f3:	72 79                	jb     80386e <__rodata_start+0x11e>
+  8037f5:	00 6f 75             	add    %ch,0x75(%rdi)
+  8037f8:	74 20                	je     80381a <__rodata_start+0xca>
+  8037fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fb:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8037ff:	76 69                	jbe    80386a <__rodata_start+0x11a>
+  803801:	72 6f                	jb     803872 <__rodata_start+0x122>
+  803803:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803804:	6d                   	insl   (%dx),%es:(%rdi)
+  803805:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803807:	74 73                	je     80387c <__rodata_start+0x12c>
+  803809:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80380c:	72 72                	jb     803880 <__rodata_start+0x130>
+  80380e:	75 70                	jne    803880 <__rodata_start+0x130>
+  803810:	74 65                	je     803877 <__rodata_start+0x127>
+  803812:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803817:	75 67                	jne    803880 <__rodata_start+0x130>
+  803819:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80381c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80381e:	00 73 65             	add    %dh,0x65(%rbx)
+  803821:	67 6d                	insl   (%dx),%es:(%edi)
+  803823:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803825:	74 61                	je     803888 <__rodata_start+0x138>
+  803827:	74 69                	je     803892 <__rodata_start+0x142>
+  803829:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80382a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80382b:	20 66 61             	and    %ah,0x61(%rsi)
+  80382e:	75 6c                	jne    80389c <__rodata_start+0x14c>
+  803830:	74 00                	je     803832 <__rodata_start+0xe2>
+  803832:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803839:	20 45 4c             	and    %al,0x4c(%rbp)
+  80383c:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803840:	61                   	(bad)
+  803841:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803846:	20 73 75             	and    %dh,0x75(%rbx)
+  803849:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80384c:	73 79                	jae    8038c7 <__rodata_start+0x177>
+  80384e:	73 74                	jae    8038c4 <__rodata_start+0x174>
+  803850:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803852:	20 63 61             	and    %ah,0x61(%rbx)
+  803855:	6c                   	insb   (%dx),%es:(%rdi)
+  803856:	6c                   	insb   (%dx),%es:(%rdi)
+  803857:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80385a:	74 72                	je     8038ce <__rodata_start+0x17e>
+  80385c:	79 20                	jns    80387e <__rodata_start+0x12e>
+  80385e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80385f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803860:	74 20                	je     803882 <__rodata_start+0x132>
+  803862:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803864:	75 6e                	jne    8038d4 <__rodata_start+0x184>
+  803866:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80386a:	76 20                	jbe    80388c <__rodata_start+0x13c>
+  80386c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803873:	72 65                	jb     8038da <__rodata_start+0x18a>
+  803875:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803878:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803879:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80387d:	65 78 70             	gs js  8038f0 <__rodata_start+0x1a0>
+  803880:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803885:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803888:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80388c:	20 66 69             	and    %ah,0x69(%rsi)
+  80388f:	6c                   	insb   (%dx),%es:(%rdi)
+  803890:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803894:	20 66 72             	and    %ah,0x72(%rsi)
+  803897:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80389c:	61                   	(bad)
+  80389d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8038a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038a2:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8038a6:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8038a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ab:	20 6d 61             	and    %ch,0x61(%rbp)
+  8038ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038af:	79 20                	jns    8038d1 <__rodata_start+0x181>
+  8038b1:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8038b8:	72 65                	jb     80391f <__rodata_start+0x1cf>
+  8038ba:	20 6f 70             	and    %ch,0x70(%rdi)
+  8038bd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038bf:	00 66 69             	add    %ah,0x69(%rsi)
+  8038c2:	6c                   	insb   (%dx),%es:(%rdi)
+  8038c3:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8038c7:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8038ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038cb:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8038ce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d0:	74 20                	je     8038f2 <__rodata_start+0x1a2>
+  8038d2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038d4:	75 6e                	jne    803944 <__rodata_start+0x1f4>
+  8038d6:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8038da:	76 61                	jbe    80393d <__rodata_start+0x1ed>
+  8038dc:	6c                   	insb   (%dx),%es:(%rdi)
+  8038dd:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8038e4:	00 
+  8038e5:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8038ec:	72 65                	jb     803953 <__rodata_start+0x203>
+  8038ee:	61                   	(bad)
+  8038ef:	64 79 20             	fs jns 803912 <__rodata_start+0x1c2>
+  8038f2:	65 78 69             	gs js  80395e <__rodata_start+0x20e>
+  8038f5:	73 74                	jae    80396b <__rodata_start+0x21b>
+  8038f7:	73 00                	jae    8038f9 <__rodata_start+0x1a9>
+  8038f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fa:	70 65                	jo     803961 <__rodata_start+0x211>
+  8038fc:	72 61                	jb     80395f <__rodata_start+0x20f>
+  8038fe:	74 69                	je     803969 <__rodata_start+0x219>
+  803900:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803901:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803902:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803905:	74 20                	je     803927 <__rodata_start+0x1d7>
+  803907:	73 75                	jae    80397e <__rodata_start+0x22e>
+  803909:	70 70                	jo     80397b <__rodata_start+0x22b>
+  80390b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390c:	72 74                	jb     803982 <__rodata_start+0x232>
+  80390e:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803914:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803919:	74 00                	je     80391b <__rodata_start+0x1cb>
+  80391b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803920:	6a 04                	push   $0x4
+  803922:	80 00 00             	addb   $0x0,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 9b 0a 80 00 00    	add    %bl,0x800a(%rbx)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  80393d:	00 00                	add    %al,(%rax)
+  80393f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 89 04 80 00 00    	add    %cl,0x8004(%rcx)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 7d 04             	add    %bh,0x4(%rbp)
+  803972:	80 00 00             	addb   $0x0,(%rax)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 f7                	add    %dh,%bh
+  803979:	04 80                	add    $0x80,%al
+  80397b:	00 00                	add    %al,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 7d 04             	add    %bh,0x4(%rbp)
+  80398a:	80 00 00             	addb   $0x0,(%rax)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 c3                	add    %al,%bl
+  803991:	04 80                	add    $0x80,%al
+  803993:	00 00                	add    %al,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 c3                	add    %al,%bl
+  803999:	04 80                	add    $0x80,%al
+  80399b:	00 00                	add    %al,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 c3                	add    %al,%bl
+  8039a1:	04 80                	add    $0x80,%al
+  8039a3:	00 00                	add    %al,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 c3                	add    %al,%bl
+  8039a9:	04 80                	add    $0x80,%al
+  8039ab:	00 00                	add    %al,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 c3                	add    %al,%bl
+  8039b1:	04 80                	add    $0x80,%al
+  8039b3:	00 00                	add    %al,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 c3                	add    %al,%bl
+  8039b9:	04 80                	add    $0x80,%al
+  8039bb:	00 00                	add    %al,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 c3                	add    %al,%bl
+  8039c1:	04 80                	add    $0x80,%al
+  8039c3:	00 00                	add    %al,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 c3                	add    %al,%bl
+  8039c9:	04 80                	add    $0x80,%al
+  8039cb:	00 00                	add    %al,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 c3                	add    %al,%bl
+  8039d1:	04 80                	add    $0x80,%al
+  8039d3:	00 00                	add    %al,(%rax)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 ce                	add    %cl,%dh
+  803ac9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803acf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 1a                	add    %bl,(%rdx)
+  803b21:	05 80 00 00 00       	add    $0x80,%eax
+  803b26:	00 00                	add    %al,(%rax)
+  803b28:	e9 06 80 00 00       	jmp    80bb33 <__bss_end+0x3b33>
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 49 05             	add    %cl,0x5(%rcx)
+  803b52:	80 00 00             	addb   $0x0,(%rax)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 0f                	add    %cl,(%rdi)
+  803b69:	05 80 00 00 00       	add    $0x80,%eax
+  803b6e:	00 00                	add    %al,(%rax)
+  803b70:	ab                   	stos   %eax,%es:(%rdi)
+  803b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b77:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 91 08 80 00 00    	add    %dl,0x8008(%rcx)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 5b 09             	add    %bl,0x9(%rbx)
+  803b8a:	80 00 00             	addb   $0x0,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 e0                	add    %ah,%al
+  803ba1:	05 80 00 00 00       	add    $0x80,%eax
+  803ba6:	00 00                	add    %al,(%rax)
+  803ba8:	ab                   	stos   %eax,%es:(%rdi)
+  803ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803baf:	00 bd 07 80 00 00    	add    %bh,0x8007(%rbp)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 ce                	add    %cl,%dh
+  803bc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803bcf:	00 ab 0a 80 00 00    	add    %ch,0x800a(%rbx)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 73 04             	add    %dh,0x4(%rbx)
+  803bda:	80 00 00             	addb   $0x0,(%rax)
+  803bdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803be0 <error_string>:
+	...
+  803be8:	b4 37 80 00 00 00 00 00 c6 37 80 00 00 00 00 00     .7.......7......
+  803bf8:	d6 37 80 00 00 00 00 00 e8 37 80 00 00 00 00 00     .7.......7......
+  803c08:	f6 37 80 00 00 00 00 00 0a 38 80 00 00 00 00 00     .7.......8......
+  803c18:	1f 38 80 00 00 00 00 00 32 38 80 00 00 00 00 00     .8......28......
+  803c28:	44 38 80 00 00 00 00 00 58 38 80 00 00 00 00 00     D8......X8......
+  803c38:	68 38 80 00 00 00 00 00 7b 38 80 00 00 00 00 00     h8......{8......
+  803c48:	92 38 80 00 00 00 00 00 a8 38 80 00 00 00 00 00     .8.......8......
+  803c58:	c0 38 80 00 00 00 00 00 d8 38 80 00 00 00 00 00     .8.......8......
+  803c68:	e5 38 80 00 00 00 00 00 88 3c 80 00 00 00 00 00     .8.......<......
+  803c78:	f9 38 80 00 00 00 00 00 11 39 80 00 00 00 00 00     .8.......9......
+  803c88:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803c98:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803ca8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803cb8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803cc8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  803cd8:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  803ce8:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  803cf8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d18:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803d28:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803d38:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803d48:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803d58:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803d68:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803d78:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803d88:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803d98:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803da0 <devtab>:
+  803da0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803db0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803dc0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803dd0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803de0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803df0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e00:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e10:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803e20:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803e30:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803e40:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
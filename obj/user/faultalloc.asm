@@ -0,0 +1,7566 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 48 3a 80 00 00 	movabs $0x803a48,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 50 03 80 00 00 	movabs $0x800350,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba a0 3a 80 00 00 	movabs $0x803aa0,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 fa 0b 80 00 00 	movabs $0x800bfa,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 70 3a 80 00 00 	movabs $0x803a70,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 53 3a 80 00 00 	movabs $0x803a53,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 5b 17 80 00 00 	movabs $0x80175b,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc 65 3a 80 00 00 	movabs $0x803a65,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 50 03 80 00 00 	movabs $0x800350,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	41 89 fd             	mov    %edi,%r13d
+  80013d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800147:	00 00 00 
+  80014a:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800151:	00 00 00 
+  800154:	48 39 c2             	cmp    %rax,%rdx
+  800157:	73 17                	jae    800170 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800159:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015c:	49 89 c4             	mov    %rax,%r12
+  80015f:	48 83 c3 08          	add    $0x8,%rbx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff 53 f8             	call   *-0x8(%rbx)
+  80016b:	4c 39 e3             	cmp    %r12,%rbx
+  80016e:	72 ef                	jb     80015f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800170:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800181:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800185:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800189:	48 c1 e0 04          	shl    $0x4,%rax
+  80018d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800194:	00 00 00 
+  800197:	48 01 d0             	add    %rdx,%rax
+  80019a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001a1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a4:	45 85 ed             	test   %r13d,%r13d
+  8001a7:	7e 0d                	jle    8001b6 <libmain+0x87>
+  8001a9:	49 8b 06             	mov    (%r14),%rax
+  8001ac:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001b3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b6:	4c 89 f6             	mov    %r14,%rsi
+  8001b9:	44 89 ef             	mov    %r13d,%edi
+  8001bc:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c8:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+#endif
+}
+  8001d4:	5b                   	pop    %rbx
+  8001d5:	41 5c                	pop    %r12
+  8001d7:	41 5d                	pop    %r13
+  8001d9:	41 5e                	pop    %r14
+  8001db:	5d                   	pop    %rbp
+  8001dc:	c3                   	ret
+
+00000000008001dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001dd:	55                   	push   %rbp
+  8001de:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e1:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  8001e8:	00 00 00 
+  8001eb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f2:	48 b8 d6 11 80 00 00 	movabs $0x8011d6,%rax
+  8001f9:	00 00 00 
+  8001fc:	ff d0                	call   *%rax
+}
+  8001fe:	5d                   	pop    %rbp
+  8001ff:	c3                   	ret
+
+0000000000800200 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800200:	55                   	push   %rbp
+  800201:	48 89 e5             	mov    %rsp,%rbp
+  800204:	41 56                	push   %r14
+  800206:	41 55                	push   %r13
+  800208:	41 54                	push   %r12
+  80020a:	53                   	push   %rbx
+  80020b:	48 83 ec 50          	sub    $0x50,%rsp
+  80020f:	49 89 fc             	mov    %rdi,%r12
+  800212:	41 89 f5             	mov    %esi,%r13d
+  800215:	48 89 d3             	mov    %rdx,%rbx
+  800218:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80021c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800220:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800224:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80022b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80022f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800233:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800237:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023b:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800242:	00 00 00 
+  800245:	4c 8b 30             	mov    (%rax),%r14
+  800248:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+  800254:	89 c6                	mov    %eax,%esi
+  800256:	45 89 e8             	mov    %r13d,%r8d
+  800259:	4c 89 e1             	mov    %r12,%rcx
+  80025c:	4c 89 f2             	mov    %r14,%rdx
+  80025f:	48 bf d0 3a 80 00 00 	movabs $0x803ad0,%rdi
+  800266:	00 00 00 
+  800269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026e:	49 bc 50 03 80 00 00 	movabs $0x800350,%r12
+  800275:	00 00 00 
+  800278:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80027b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80027f:	48 89 df             	mov    %rbx,%rdi
+  800282:	48 b8 ec 02 80 00 00 	movabs $0x8002ec,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80028e:	48 bf 5b 41 80 00 00 	movabs $0x80415b,%rdi
+  800295:	00 00 00 
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002a0:	cc                   	int3
+  8002a1:	eb fd                	jmp    8002a0 <_panic+0xa0>
+
+00000000008002a3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	53                   	push   %rbx
+  8002a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ac:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002af:	8b 06                	mov    (%rsi),%eax
+  8002b1:	8d 50 01             	lea    0x1(%rax),%edx
+  8002b4:	89 16                	mov    %edx,(%rsi)
+  8002b6:	48 98                	cltq
+  8002b8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002bd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002c3:	74 0a                	je     8002cf <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002c5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002cf:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002d3:	be ff 00 00 00       	mov    $0xff,%esi
+  8002d8:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8002df:	00 00 00 
+  8002e2:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002e4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002ea:	eb d9                	jmp    8002c5 <putch+0x22>
+
+00000000008002ec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002ec:	55                   	push   %rbp
+  8002ed:	48 89 e5             	mov    %rsp,%rbp
+  8002f0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002f7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002fa:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800301:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80030e:	48 89 f1             	mov    %rsi,%rcx
+  800311:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800318:	48 bf a3 02 80 00 00 	movabs $0x8002a3,%rdi
+  80031f:	00 00 00 
+  800322:	48 b8 a0 04 80 00 00 	movabs $0x8004a0,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80032e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800335:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80033c:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  800343:	00 00 00 
+  800346:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800348:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80034e:	c9                   	leave
+  80034f:	c3                   	ret
+
+0000000000800350 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	48 83 ec 50          	sub    $0x50,%rsp
+  800358:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80035c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800360:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800364:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800368:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80036c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800373:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800377:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80037b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80037f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800383:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800387:	48 b8 ec 02 80 00 00 	movabs $0x8002ec,%rax
+  80038e:	00 00 00 
+  800391:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800393:	c9                   	leave
+  800394:	c3                   	ret
+
+0000000000800395 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800395:	55                   	push   %rbp
+  800396:	48 89 e5             	mov    %rsp,%rbp
+  800399:	41 57                	push   %r15
+  80039b:	41 56                	push   %r14
+  80039d:	41 55                	push   %r13
+  80039f:	41 54                	push   %r12
+  8003a1:	53                   	push   %rbx
+  8003a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8003a6:	49 89 fc             	mov    %rdi,%r12
+  8003a9:	49 89 f5             	mov    %rsi,%r13
+  8003ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003b0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003b3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003b6:	41 89 cf             	mov    %ecx,%r15d
+  8003b9:	4c 39 fa             	cmp    %r15,%rdx
+  8003bc:	73 5b                	jae    800419 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003be:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003c2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003c6:	85 db                	test   %ebx,%ebx
+  8003c8:	7e 0e                	jle    8003d8 <print_num+0x43>
+            putch(padc, put_arg);
+  8003ca:	4c 89 ee             	mov    %r13,%rsi
+  8003cd:	44 89 f7             	mov    %r14d,%edi
+  8003d0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003d3:	83 eb 01             	sub    $0x1,%ebx
+  8003d6:	75 f2                	jne    8003ca <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003d8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003dc:	48 b9 04 3b 80 00 00 	movabs $0x803b04,%rcx
+  8003e3:	00 00 00 
+  8003e6:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  8003ed:	00 00 00 
+  8003f0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fd:	49 f7 f7             	div    %r15
+  800400:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800404:	4c 89 ee             	mov    %r13,%rsi
+  800407:	41 ff d4             	call   *%r12
+}
+  80040a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80040e:	5b                   	pop    %rbx
+  80040f:	41 5c                	pop    %r12
+  800411:	41 5d                	pop    %r13
+  800413:	41 5e                	pop    %r14
+  800415:	41 5f                	pop    %r15
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800419:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80041d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800422:	49 f7 f7             	div    %r15
+  800425:	48 83 ec 08          	sub    $0x8,%rsp
+  800429:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80042d:	52                   	push   %rdx
+  80042e:	45 0f be c9          	movsbl %r9b,%r9d
+  800432:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800436:	48 89 c2             	mov    %rax,%rdx
+  800439:	48 b8 95 03 80 00 00 	movabs $0x800395,%rax
+  800440:	00 00 00 
+  800443:	ff d0                	call   *%rax
+  800445:	48 83 c4 10          	add    $0x10,%rsp
+  800449:	eb 8d                	jmp    8003d8 <print_num+0x43>
+
+000000000080044b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80044b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80044f:	48 8b 06             	mov    (%rsi),%rax
+  800452:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800456:	73 0a                	jae    800462 <sprintputch+0x17>
+        *state->start++ = ch;
+  800458:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80045c:	48 89 16             	mov    %rdx,(%rsi)
+  80045f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800462:	c3                   	ret
+
+0000000000800463 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+  800467:	48 83 ec 50          	sub    $0x50,%rsp
+  80046b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800473:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800477:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80047e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800482:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800486:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80048a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80048e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800492:	48 b8 a0 04 80 00 00 	movabs $0x8004a0,%rax
+  800499:	00 00 00 
+  80049c:	ff d0                	call   *%rax
+}
+  80049e:	c9                   	leave
+  80049f:	c3                   	ret
+
+00000000008004a0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	41 57                	push   %r15
+  8004a6:	41 56                	push   %r14
+  8004a8:	41 55                	push   %r13
+  8004aa:	41 54                	push   %r12
+  8004ac:	53                   	push   %rbx
+  8004ad:	48 83 ec 38          	sub    $0x38,%rsp
+  8004b1:	49 89 fe             	mov    %rdi,%r14
+  8004b4:	49 89 f5             	mov    %rsi,%r13
+  8004b7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004ba:	48 8b 01             	mov    (%rcx),%rax
+  8004bd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004c1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004d1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004d5:	0f b6 3b             	movzbl (%rbx),%edi
+  8004d8:	40 80 ff 25          	cmp    $0x25,%dil
+  8004dc:	74 18                	je     8004f6 <vprintfmt+0x56>
+            if (!ch) return;
+  8004de:	40 84 ff             	test   %dil,%dil
+  8004e1:	0f 84 b1 06 00 00    	je     800b98 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004e7:	40 0f b6 ff          	movzbl %dil,%edi
+  8004eb:	4c 89 ee             	mov    %r13,%rsi
+  8004ee:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004f1:	4c 89 e3             	mov    %r12,%rbx
+  8004f4:	eb db                	jmp    8004d1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8004fb:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004ff:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800504:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80050a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800511:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800515:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80051a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80051f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800522:	83 e8 23             	sub    $0x23,%eax
+  800525:	3c 57                	cmp    $0x57,%al
+  800527:	0f 87 51 06 00 00    	ja     800b7e <vprintfmt+0x6de>
+  80052d:	0f b6 c0             	movzbl %al,%eax
+  800530:	48 b9 a0 3c 80 00 00 	movabs $0x803ca0,%rcx
+  800537:	00 00 00 
+  80053a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80053d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800540:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800544:	eb cf                	jmp    800515 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800546:	49 89 dc             	mov    %rbx,%r12
+  800549:	be 01 00 00 00       	mov    $0x1,%esi
+  80054e:	eb c5                	jmp    800515 <vprintfmt+0x75>
+            padc = ch;
+  800550:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800554:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800557:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055a:	eb b9                	jmp    800515 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80055c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80055f:	83 f8 2f             	cmp    $0x2f,%eax
+  800562:	77 24                	ja     800588 <vprintfmt+0xe8>
+  800564:	89 c1                	mov    %eax,%ecx
+  800566:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80056a:	83 c0 08             	add    $0x8,%eax
+  80056d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800570:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800573:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800576:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057a:	79 99                	jns    800515 <vprintfmt+0x75>
+                width = precision;
+  80057c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800580:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800586:	eb 8d                	jmp    800515 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800588:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80058c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800590:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800594:	eb da                	jmp    800570 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800596:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80059b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80059f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005a5:	3c 39                	cmp    $0x39,%al
+  8005a7:	77 1c                	ja     8005c5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005a9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005ad:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005b1:	0f b6 c0             	movzbl %al,%eax
+  8005b4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b9:	0f b6 03             	movzbl (%rbx),%eax
+  8005bc:	3c 39                	cmp    $0x39,%al
+  8005be:	76 e9                	jbe    8005a9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005c0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005c3:	eb b1                	jmp    800576 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005c5:	49 89 dc             	mov    %rbx,%r12
+  8005c8:	eb ac                	jmp    800576 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ca:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005cd:	85 c9                	test   %ecx,%ecx
+  8005cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d4:	0f 49 c1             	cmovns %ecx,%eax
+  8005d7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005da:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005dd:	e9 33 ff ff ff       	jmp    800515 <vprintfmt+0x75>
+            lflag++;
+  8005e2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005e5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e8:	e9 28 ff ff ff       	jmp    800515 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f3:	77 19                	ja     80060e <vprintfmt+0x16e>
+  8005f5:	89 c2                	mov    %eax,%edx
+  8005f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005fb:	83 c0 08             	add    $0x8,%eax
+  8005fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800601:	8b 3a                	mov    (%rdx),%edi
+  800603:	4c 89 ee             	mov    %r13,%rsi
+  800606:	41 ff d6             	call   *%r14
+            break;
+  800609:	e9 c3 fe ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80060e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800612:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800616:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80061a:	eb e5                	jmp    800601 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80061c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061f:	83 f8 2f             	cmp    $0x2f,%eax
+  800622:	77 5a                	ja     80067e <vprintfmt+0x1de>
+  800624:	89 c2                	mov    %eax,%edx
+  800626:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80062a:	83 c0 08             	add    $0x8,%eax
+  80062d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800630:	8b 02                	mov    (%rdx),%eax
+  800632:	89 c1                	mov    %eax,%ecx
+  800634:	f7 d9                	neg    %ecx
+  800636:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800639:	83 f9 14             	cmp    $0x14,%ecx
+  80063c:	7f 4e                	jg     80068c <vprintfmt+0x1ec>
+  80063e:	48 63 c1             	movslq %ecx,%rax
+  800641:	48 ba 60 3f 80 00 00 	movabs $0x803f60,%rdx
+  800648:	00 00 00 
+  80064b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80064f:	48 85 c0             	test   %rax,%rax
+  800652:	74 38                	je     80068c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800654:	48 89 c1             	mov    %rax,%rcx
+  800657:	48 ba da 40 80 00 00 	movabs $0x8040da,%rdx
+  80065e:	00 00 00 
+  800661:	4c 89 ee             	mov    %r13,%rsi
+  800664:	4c 89 f7             	mov    %r14,%rdi
+  800667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066c:	49 b8 63 04 80 00 00 	movabs $0x800463,%r8
+  800673:	00 00 00 
+  800676:	41 ff d0             	call   *%r8
+  800679:	e9 53 fe ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80067e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800682:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068a:	eb a4                	jmp    800630 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80068c:	48 ba 1c 3b 80 00 00 	movabs $0x803b1c,%rdx
+  800693:	00 00 00 
+  800696:	4c 89 ee             	mov    %r13,%rsi
+  800699:	4c 89 f7             	mov    %r14,%rdi
+  80069c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a1:	49 b8 63 04 80 00 00 	movabs $0x800463,%r8
+  8006a8:	00 00 00 
+  8006ab:	41 ff d0             	call   *%r8
+  8006ae:	e9 1e fe ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b9:	77 6c                	ja     800727 <vprintfmt+0x287>
+  8006bb:	89 c2                	mov    %eax,%edx
+  8006bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c1:	83 c0 08             	add    $0x8,%eax
+  8006c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006ca:	48 85 d2             	test   %rdx,%rdx
+  8006cd:	48 b8 15 3b 80 00 00 	movabs $0x803b15,%rax
+  8006d4:	00 00 00 
+  8006d7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006db:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006df:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006e3:	7e 06                	jle    8006eb <vprintfmt+0x24b>
+  8006e5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006e9:	75 4a                	jne    800735 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006eb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006ef:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006f3:	0f b6 00             	movzbl (%rax),%eax
+  8006f6:	84 c0                	test   %al,%al
+  8006f8:	0f 85 9a 00 00 00    	jne    800798 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006fe:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800701:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800705:	85 c0                	test   %eax,%eax
+  800707:	0f 8e c4 fd ff ff    	jle    8004d1 <vprintfmt+0x31>
+  80070d:	4c 89 ee             	mov    %r13,%rsi
+  800710:	bf 20 00 00 00       	mov    $0x20,%edi
+  800715:	41 ff d6             	call   *%r14
+  800718:	41 83 ec 01          	sub    $0x1,%r12d
+  80071c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800720:	75 eb                	jne    80070d <vprintfmt+0x26d>
+  800722:	e9 aa fd ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800727:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800733:	eb 92                	jmp    8006c7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800735:	49 63 f7             	movslq %r15d,%rsi
+  800738:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80073c:	48 b8 52 0c 80 00 00 	movabs $0x800c52,%rax
+  800743:	00 00 00 
+  800746:	ff d0                	call   *%rax
+  800748:	48 89 c2             	mov    %rax,%rdx
+  80074b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80074e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800750:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800753:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800756:	85 c0                	test   %eax,%eax
+  800758:	7e 91                	jle    8006eb <vprintfmt+0x24b>
+  80075a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80075f:	4c 89 ee             	mov    %r13,%rsi
+  800762:	44 89 e7             	mov    %r12d,%edi
+  800765:	41 ff d6             	call   *%r14
+  800768:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80076c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80076f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800772:	75 eb                	jne    80075f <vprintfmt+0x2bf>
+  800774:	e9 72 ff ff ff       	jmp    8006eb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800779:	0f b6 f8             	movzbl %al,%edi
+  80077c:	4c 89 ee             	mov    %r13,%rsi
+  80077f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800782:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800786:	49 83 c4 01          	add    $0x1,%r12
+  80078a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800790:	84 c0                	test   %al,%al
+  800792:	0f 84 66 ff ff ff    	je     8006fe <vprintfmt+0x25e>
+  800798:	45 85 ff             	test   %r15d,%r15d
+  80079b:	78 0a                	js     8007a7 <vprintfmt+0x307>
+  80079d:	41 83 ef 01          	sub    $0x1,%r15d
+  8007a1:	0f 88 57 ff ff ff    	js     8006fe <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007ab:	74 cc                	je     800779 <vprintfmt+0x2d9>
+  8007ad:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007b0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007b5:	80 fa 5e             	cmp    $0x5e,%dl
+  8007b8:	77 c2                	ja     80077c <vprintfmt+0x2dc>
+  8007ba:	eb bd                	jmp    800779 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007bc:	40 84 f6             	test   %sil,%sil
+  8007bf:	75 26                	jne    8007e7 <vprintfmt+0x347>
+    switch (lflag) {
+  8007c1:	85 d2                	test   %edx,%edx
+  8007c3:	74 59                	je     80081e <vprintfmt+0x37e>
+  8007c5:	83 fa 01             	cmp    $0x1,%edx
+  8007c8:	74 7b                	je     800845 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	0f 87 96 00 00 00    	ja     80086c <vprintfmt+0x3cc>
+  8007d6:	89 c2                	mov    %eax,%edx
+  8007d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007dc:	83 c0 08             	add    $0x8,%eax
+  8007df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e2:	4c 8b 22             	mov    (%rdx),%r12
+  8007e5:	eb 17                	jmp    8007fe <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ed:	77 21                	ja     800810 <vprintfmt+0x370>
+  8007ef:	89 c2                	mov    %eax,%edx
+  8007f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f5:	83 c0 08             	add    $0x8,%eax
+  8007f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007fe:	4d 85 e4             	test   %r12,%r12
+  800801:	78 7a                	js     80087d <vprintfmt+0x3dd>
+            num = i;
+  800803:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80080b:	e9 50 02 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb dd                	jmp    8007fb <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 11                	ja     800837 <vprintfmt+0x397>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	4c 63 22             	movslq (%rdx),%r12
+  800835:	eb c7                	jmp    8007fe <vprintfmt+0x35e>
+  800837:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800843:	eb ed                	jmp    800832 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800845:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 11                	ja     80085e <vprintfmt+0x3be>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800853:	83 c0 08             	add    $0x8,%eax
+  800856:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800859:	4c 8b 22             	mov    (%rdx),%r12
+  80085c:	eb a0                	jmp    8007fe <vprintfmt+0x35e>
+  80085e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800862:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800866:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086a:	eb ed                	jmp    800859 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	e9 65 ff ff ff       	jmp    8007e2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80087d:	4c 89 ee             	mov    %r13,%rsi
+  800880:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800885:	41 ff d6             	call   *%r14
+                i = -i;
+  800888:	49 f7 dc             	neg    %r12
+  80088b:	e9 73 ff ff ff       	jmp    800803 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800890:	40 84 f6             	test   %sil,%sil
+  800893:	75 32                	jne    8008c7 <vprintfmt+0x427>
+    switch (lflag) {
+  800895:	85 d2                	test   %edx,%edx
+  800897:	74 5d                	je     8008f6 <vprintfmt+0x456>
+  800899:	83 fa 01             	cmp    $0x1,%edx
+  80089c:	0f 84 82 00 00 00    	je     800924 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	0f 87 a5 00 00 00    	ja     800953 <vprintfmt+0x4b3>
+  8008ae:	89 c2                	mov    %eax,%edx
+  8008b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b4:	83 c0 08             	add    $0x8,%eax
+  8008b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c2:	e9 99 01 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cd:	77 19                	ja     8008e8 <vprintfmt+0x448>
+  8008cf:	89 c2                	mov    %eax,%edx
+  8008d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d5:	83 c0 08             	add    $0x8,%eax
+  8008d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e3:	e9 78 01 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+  8008e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f4:	eb e5                	jmp    8008db <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 18                	ja     800916 <vprintfmt+0x476>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80090c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800911:	e9 4a 01 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb e6                	jmp    80090a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 19                	ja     800945 <vprintfmt+0x4a5>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80093b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800940:	e9 1b 01 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+  800945:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800949:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800951:	eb e5                	jmp    800938 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800953:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800957:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095f:	e9 56 ff ff ff       	jmp    8008ba <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800964:	40 84 f6             	test   %sil,%sil
+  800967:	75 2e                	jne    800997 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800969:	85 d2                	test   %edx,%edx
+  80096b:	74 59                	je     8009c6 <vprintfmt+0x526>
+  80096d:	83 fa 01             	cmp    $0x1,%edx
+  800970:	74 7f                	je     8009f1 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800972:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800975:	83 f8 2f             	cmp    $0x2f,%eax
+  800978:	0f 87 9f 00 00 00    	ja     800a1d <vprintfmt+0x57d>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80098d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800992:	e9 c9 00 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	77 19                	ja     8009b8 <vprintfmt+0x518>
+  80099f:	89 c2                	mov    %eax,%edx
+  8009a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a5:	83 c0 08             	add    $0x8,%eax
+  8009a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009ae:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b3:	e9 a8 00 00 00       	jmp    800a60 <vprintfmt+0x5c0>
+  8009b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c4:	eb e5                	jmp    8009ab <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cc:	77 15                	ja     8009e3 <vprintfmt+0x543>
+  8009ce:	89 c2                	mov    %eax,%edx
+  8009d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d4:	83 c0 08             	add    $0x8,%eax
+  8009d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009da:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009dc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e1:	eb 7d                	jmp    800a60 <vprintfmt+0x5c0>
+  8009e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ef:	eb e9                	jmp    8009da <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	77 16                	ja     800a0f <vprintfmt+0x56f>
+  8009f9:	89 c2                	mov    %eax,%edx
+  8009fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ff:	83 c0 08             	add    $0x8,%eax
+  800a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a08:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a0d:	eb 51                	jmp    800a60 <vprintfmt+0x5c0>
+  800a0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1b:	eb e8                	jmp    800a05 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a29:	e9 5c ff ff ff       	jmp    80098a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a2e:	4c 89 ee             	mov    %r13,%rsi
+  800a31:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a36:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a41:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a47:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4a:	77 47                	ja     800a93 <vprintfmt+0x5f3>
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a52:	83 c0 08             	add    $0x8,%eax
+  800a55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a60:	48 83 ec 08          	sub    $0x8,%rsp
+  800a64:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a68:	0f 94 c0             	sete   %al
+  800a6b:	0f b6 c0             	movzbl %al,%eax
+  800a6e:	50                   	push   %rax
+  800a6f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a74:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a78:	4c 89 ee             	mov    %r13,%rsi
+  800a7b:	4c 89 f7             	mov    %r14,%rdi
+  800a7e:	48 b8 95 03 80 00 00 	movabs $0x800395,%rax
+  800a85:	00 00 00 
+  800a88:	ff d0                	call   *%rax
+            break;
+  800a8a:	48 83 c4 10          	add    $0x10,%rsp
+  800a8e:	e9 3e fa ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb b7                	jmp    800a58 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa1:	40 84 f6             	test   %sil,%sil
+  800aa4:	75 2b                	jne    800ad1 <vprintfmt+0x631>
+    switch (lflag) {
+  800aa6:	85 d2                	test   %edx,%edx
+  800aa8:	74 56                	je     800b00 <vprintfmt+0x660>
+  800aaa:	83 fa 01             	cmp    $0x1,%edx
+  800aad:	74 7f                	je     800b2e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	0f 87 a2 00 00 00    	ja     800b5d <vprintfmt+0x6bd>
+  800abb:	89 c2                	mov    %eax,%edx
+  800abd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac1:	83 c0 08             	add    $0x8,%eax
+  800ac4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aca:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800acf:	eb 8f                	jmp    800a60 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	77 19                	ja     800af2 <vprintfmt+0x652>
+  800ad9:	89 c2                	mov    %eax,%edx
+  800adb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adf:	83 c0 08             	add    $0x8,%eax
+  800ae2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aed:	e9 6e ff ff ff       	jmp    800a60 <vprintfmt+0x5c0>
+  800af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afe:	eb e5                	jmp    800ae5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b03:	83 f8 2f             	cmp    $0x2f,%eax
+  800b06:	77 18                	ja     800b20 <vprintfmt+0x680>
+  800b08:	89 c2                	mov    %eax,%edx
+  800b0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0e:	83 c0 08             	add    $0x8,%eax
+  800b11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b14:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b1b:	e9 40 ff ff ff       	jmp    800a60 <vprintfmt+0x5c0>
+  800b20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2c:	eb e6                	jmp    800b14 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	77 19                	ja     800b4f <vprintfmt+0x6af>
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3c:	83 c0 08             	add    $0x8,%eax
+  800b3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b4a:	e9 11 ff ff ff       	jmp    800a60 <vprintfmt+0x5c0>
+  800b4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5b:	eb e5                	jmp    800b42 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b69:	e9 59 ff ff ff       	jmp    800ac7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b6e:	4c 89 ee             	mov    %r13,%rsi
+  800b71:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b76:	41 ff d6             	call   *%r14
+            break;
+  800b79:	e9 53 f9 ff ff       	jmp    8004d1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b7e:	4c 89 ee             	mov    %r13,%rsi
+  800b81:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b86:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b89:	48 83 eb 01          	sub    $0x1,%rbx
+  800b8d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b91:	75 f6                	jne    800b89 <vprintfmt+0x6e9>
+  800b93:	e9 39 f9 ff ff       	jmp    8004d1 <vprintfmt+0x31>
+}
+  800b98:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b9c:	5b                   	pop    %rbx
+  800b9d:	41 5c                	pop    %r12
+  800b9f:	41 5d                	pop    %r13
+  800ba1:	41 5e                	pop    %r14
+  800ba3:	41 5f                	pop    %r15
+  800ba5:	5d                   	pop    %rbp
+  800ba6:	c3                   	ret
+
+0000000000800ba7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ba7:	55                   	push   %rbp
+  800ba8:	48 89 e5             	mov    %rsp,%rbp
+  800bab:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800baf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bb3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bb8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bbc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bc3:	48 85 ff             	test   %rdi,%rdi
+  800bc6:	74 2b                	je     800bf3 <vsnprintf+0x4c>
+  800bc8:	48 85 f6             	test   %rsi,%rsi
+  800bcb:	74 26                	je     800bf3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd1:	48 bf 4b 04 80 00 00 	movabs $0x80044b,%rdi
+  800bd8:	00 00 00 
+  800bdb:	48 b8 a0 04 80 00 00 	movabs $0x8004a0,%rax
+  800be2:	00 00 00 
+  800be5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800be7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800beb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf8:	eb f7                	jmp    800bf1 <vsnprintf+0x4a>
+
+0000000000800bfa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bfa:	55                   	push   %rbp
+  800bfb:	48 89 e5             	mov    %rsp,%rbp
+  800bfe:	48 83 ec 50          	sub    $0x50,%rsp
+  800c02:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c06:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c0a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c0e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c15:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c21:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c25:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c29:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  800c30:	00 00 00 
+  800c33:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c35:	c9                   	leave
+  800c36:	c3                   	ret
+
+0000000000800c37 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c37:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c3a:	74 10                	je     800c4c <strlen+0x15>
+    size_t n = 0;
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c41:	48 83 c0 01          	add    $0x1,%rax
+  800c45:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c49:	75 f6                	jne    800c41 <strlen+0xa>
+  800c4b:	c3                   	ret
+    size_t n = 0;
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c51:	c3                   	ret
+
+0000000000800c52 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c52:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c55:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c5a:	48 85 f6             	test   %rsi,%rsi
+  800c5d:	74 11                	je     800c70 <strnlen+0x1e>
+  800c5f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c63:	74 0c                	je     800c71 <strnlen+0x1f>
+  800c65:	48 83 c2 01          	add    $0x1,%rdx
+  800c69:	48 39 d0             	cmp    %rdx,%rax
+  800c6c:	75 f1                	jne    800c5f <strnlen+0xd>
+  800c6e:	eb 04                	jmp    800c74 <strnlen+0x22>
+  800c70:	c3                   	ret
+  800c71:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c74:	c3                   	ret
+
+0000000000800c75 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c75:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c81:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c84:	48 83 c2 01          	add    $0x1,%rdx
+  800c88:	84 c9                	test   %cl,%cl
+  800c8a:	75 f1                	jne    800c7d <strcpy+0x8>
+        ;
+    return res;
+}
+  800c8c:	c3                   	ret
+
+0000000000800c8d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c8d:	55                   	push   %rbp
+  800c8e:	48 89 e5             	mov    %rsp,%rbp
+  800c91:	41 54                	push   %r12
+  800c93:	53                   	push   %rbx
+  800c94:	48 89 fb             	mov    %rdi,%rbx
+  800c97:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c9a:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  800ca1:	00 00 00 
+  800ca4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ca6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800caa:	4c 89 e6             	mov    %r12,%rsi
+  800cad:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+    return dst;
+}
+  800cb9:	48 89 d8             	mov    %rbx,%rax
+  800cbc:	5b                   	pop    %rbx
+  800cbd:	41 5c                	pop    %r12
+  800cbf:	5d                   	pop    %rbp
+  800cc0:	c3                   	ret
+
+0000000000800cc1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cc1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cc4:	48 85 d2             	test   %rdx,%rdx
+  800cc7:	74 1f                	je     800ce8 <strncpy+0x27>
+  800cc9:	48 01 fa             	add    %rdi,%rdx
+  800ccc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ccf:	48 83 c1 01          	add    $0x1,%rcx
+  800cd3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cd7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cdb:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cdf:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ce3:	48 39 ca             	cmp    %rcx,%rdx
+  800ce6:	75 e7                	jne    800ccf <strncpy+0xe>
+    }
+    return ret;
+}
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ce9:	48 89 f8             	mov    %rdi,%rax
+  800cec:	48 85 d2             	test   %rdx,%rdx
+  800cef:	74 24                	je     800d15 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cf1:	48 83 ea 01          	sub    $0x1,%rdx
+  800cf5:	74 1b                	je     800d12 <strlcpy+0x29>
+  800cf7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cfb:	0f b6 16             	movzbl (%rsi),%edx
+  800cfe:	84 d2                	test   %dl,%dl
+  800d00:	74 10                	je     800d12 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d02:	48 83 c6 01          	add    $0x1,%rsi
+  800d06:	48 83 c0 01          	add    $0x1,%rax
+  800d0a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d0d:	48 39 c8             	cmp    %rcx,%rax
+  800d10:	75 e9                	jne    800cfb <strlcpy+0x12>
+        *dst = '\0';
+  800d12:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d15:	48 29 f8             	sub    %rdi,%rax
+}
+  800d18:	c3                   	ret
+
+0000000000800d19 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d19:	0f b6 07             	movzbl (%rdi),%eax
+  800d1c:	84 c0                	test   %al,%al
+  800d1e:	74 13                	je     800d33 <strcmp+0x1a>
+  800d20:	38 06                	cmp    %al,(%rsi)
+  800d22:	75 0f                	jne    800d33 <strcmp+0x1a>
+  800d24:	48 83 c7 01          	add    $0x1,%rdi
+  800d28:	48 83 c6 01          	add    $0x1,%rsi
+  800d2c:	0f b6 07             	movzbl (%rdi),%eax
+  800d2f:	84 c0                	test   %al,%al
+  800d31:	75 ed                	jne    800d20 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d33:	0f b6 c0             	movzbl %al,%eax
+  800d36:	0f b6 16             	movzbl (%rsi),%edx
+  800d39:	29 d0                	sub    %edx,%eax
+}
+  800d3b:	c3                   	ret
+
+0000000000800d3c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d3c:	48 85 d2             	test   %rdx,%rdx
+  800d3f:	74 1f                	je     800d60 <strncmp+0x24>
+  800d41:	0f b6 07             	movzbl (%rdi),%eax
+  800d44:	84 c0                	test   %al,%al
+  800d46:	74 1e                	je     800d66 <strncmp+0x2a>
+  800d48:	3a 06                	cmp    (%rsi),%al
+  800d4a:	75 1a                	jne    800d66 <strncmp+0x2a>
+  800d4c:	48 83 c7 01          	add    $0x1,%rdi
+  800d50:	48 83 c6 01          	add    $0x1,%rsi
+  800d54:	48 83 ea 01          	sub    $0x1,%rdx
+  800d58:	75 e7                	jne    800d41 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5f:	c3                   	ret
+  800d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d65:	c3                   	ret
+  800d66:	48 85 d2             	test   %rdx,%rdx
+  800d69:	74 09                	je     800d74 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d6b:	0f b6 07             	movzbl (%rdi),%eax
+  800d6e:	0f b6 16             	movzbl (%rsi),%edx
+  800d71:	29 d0                	sub    %edx,%eax
+  800d73:	c3                   	ret
+    if (!n) return 0;
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d79:	c3                   	ret
+
+0000000000800d7a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d7a:	0f b6 17             	movzbl (%rdi),%edx
+  800d7d:	84 d2                	test   %dl,%dl
+  800d7f:	74 18                	je     800d99 <strchr+0x1f>
+        if (*str == c) {
+  800d81:	0f be d2             	movsbl %dl,%edx
+  800d84:	39 f2                	cmp    %esi,%edx
+  800d86:	74 17                	je     800d9f <strchr+0x25>
+    for (; *str; str++) {
+  800d88:	48 83 c7 01          	add    $0x1,%rdi
+  800d8c:	0f b6 17             	movzbl (%rdi),%edx
+  800d8f:	84 d2                	test   %dl,%dl
+  800d91:	75 ee                	jne    800d81 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d98:	c3                   	ret
+  800d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9e:	c3                   	ret
+  800d9f:	48 89 f8             	mov    %rdi,%rax
+}
+  800da2:	c3                   	ret
+
+0000000000800da3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800da3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800da6:	0f b6 17             	movzbl (%rdi),%edx
+  800da9:	84 d2                	test   %dl,%dl
+  800dab:	74 13                	je     800dc0 <strfind+0x1d>
+  800dad:	0f be d2             	movsbl %dl,%edx
+  800db0:	39 f2                	cmp    %esi,%edx
+  800db2:	74 0b                	je     800dbf <strfind+0x1c>
+  800db4:	48 83 c0 01          	add    $0x1,%rax
+  800db8:	0f b6 10             	movzbl (%rax),%edx
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	75 ee                	jne    800dad <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dbf:	c3                   	ret
+  800dc0:	c3                   	ret
+
+0000000000800dc1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dc1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dc4:	48 89 f8             	mov    %rdi,%rax
+  800dc7:	48 f7 d8             	neg    %rax
+  800dca:	83 e0 07             	and    $0x7,%eax
+  800dcd:	49 89 d1             	mov    %rdx,%r9
+  800dd0:	49 29 c1             	sub    %rax,%r9
+  800dd3:	78 36                	js     800e0b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dd5:	40 0f b6 c6          	movzbl %sil,%eax
+  800dd9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800de0:	01 01 01 
+  800de3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800de7:	40 f6 c7 07          	test   $0x7,%dil
+  800deb:	75 38                	jne    800e25 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ded:	4c 89 c9             	mov    %r9,%rcx
+  800df0:	48 c1 f9 03          	sar    $0x3,%rcx
+  800df4:	74 0c                	je     800e02 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800df6:	fc                   	cld
+  800df7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dfa:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dfe:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e02:	4d 85 c9             	test   %r9,%r9
+  800e05:	75 45                	jne    800e4c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e07:	4c 89 c0             	mov    %r8,%rax
+  800e0a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e0b:	48 85 d2             	test   %rdx,%rdx
+  800e0e:	74 f7                	je     800e07 <memset+0x46>
+  800e10:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e13:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e16:	48 83 c0 01          	add    $0x1,%rax
+  800e1a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e1e:	48 39 c2             	cmp    %rax,%rdx
+  800e21:	75 f3                	jne    800e16 <memset+0x55>
+  800e23:	eb e2                	jmp    800e07 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e25:	40 f6 c7 01          	test   $0x1,%dil
+  800e29:	74 06                	je     800e31 <memset+0x70>
+  800e2b:	88 07                	mov    %al,(%rdi)
+  800e2d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e31:	40 f6 c7 02          	test   $0x2,%dil
+  800e35:	74 07                	je     800e3e <memset+0x7d>
+  800e37:	66 89 07             	mov    %ax,(%rdi)
+  800e3a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e3e:	40 f6 c7 04          	test   $0x4,%dil
+  800e42:	74 a9                	je     800ded <memset+0x2c>
+  800e44:	89 07                	mov    %eax,(%rdi)
+  800e46:	48 83 c7 04          	add    $0x4,%rdi
+  800e4a:	eb a1                	jmp    800ded <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e4c:	41 f6 c1 04          	test   $0x4,%r9b
+  800e50:	74 06                	je     800e58 <memset+0x97>
+  800e52:	89 07                	mov    %eax,(%rdi)
+  800e54:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e58:	41 f6 c1 02          	test   $0x2,%r9b
+  800e5c:	74 07                	je     800e65 <memset+0xa4>
+  800e5e:	66 89 07             	mov    %ax,(%rdi)
+  800e61:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e65:	41 f6 c1 01          	test   $0x1,%r9b
+  800e69:	74 9c                	je     800e07 <memset+0x46>
+  800e6b:	88 07                	mov    %al,(%rdi)
+  800e6d:	eb 98                	jmp    800e07 <memset+0x46>
+
+0000000000800e6f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e6f:	48 89 f8             	mov    %rdi,%rax
+  800e72:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e75:	48 39 fe             	cmp    %rdi,%rsi
+  800e78:	73 3b                	jae    800eb5 <memmove+0x46>
+  800e7a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e7e:	48 39 d7             	cmp    %rdx,%rdi
+  800e81:	73 32                	jae    800eb5 <memmove+0x46>
+        s += n;
+        d += n;
+  800e83:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e87:	48 89 d6             	mov    %rdx,%rsi
+  800e8a:	48 09 fe             	or     %rdi,%rsi
+  800e8d:	48 09 ce             	or     %rcx,%rsi
+  800e90:	40 f6 c6 07          	test   $0x7,%sil
+  800e94:	75 12                	jne    800ea8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e96:	48 83 ef 08          	sub    $0x8,%rdi
+  800e9a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e9e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea2:	fd                   	std
+  800ea3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ea6:	fc                   	cld
+  800ea7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ea8:	48 83 ef 01          	sub    $0x1,%rdi
+  800eac:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800eb0:	fd                   	std
+  800eb1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eb3:	eb f1                	jmp    800ea6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb5:	48 89 f2             	mov    %rsi,%rdx
+  800eb8:	48 09 c2             	or     %rax,%rdx
+  800ebb:	48 09 ca             	or     %rcx,%rdx
+  800ebe:	f6 c2 07             	test   $0x7,%dl
+  800ec1:	75 0c                	jne    800ecf <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ec3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ec7:	48 89 c7             	mov    %rax,%rdi
+  800eca:	fc                   	cld
+  800ecb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ece:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ecf:	48 89 c7             	mov    %rax,%rdi
+  800ed2:	fc                   	cld
+  800ed3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ed5:	c3                   	ret
+
+0000000000800ed6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ed6:	55                   	push   %rbp
+  800ed7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eda:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+}
+  800ee6:	5d                   	pop    %rbp
+  800ee7:	c3                   	ret
+
+0000000000800ee8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ee8:	55                   	push   %rbp
+  800ee9:	48 89 e5             	mov    %rsp,%rbp
+  800eec:	41 57                	push   %r15
+  800eee:	41 56                	push   %r14
+  800ef0:	41 55                	push   %r13
+  800ef2:	41 54                	push   %r12
+  800ef4:	53                   	push   %rbx
+  800ef5:	48 83 ec 08          	sub    $0x8,%rsp
+  800ef9:	49 89 fe             	mov    %rdi,%r14
+  800efc:	49 89 f7             	mov    %rsi,%r15
+  800eff:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f02:	48 89 f7             	mov    %rsi,%rdi
+  800f05:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  800f0c:	00 00 00 
+  800f0f:	ff d0                	call   *%rax
+  800f11:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f14:	48 89 de             	mov    %rbx,%rsi
+  800f17:	4c 89 f7             	mov    %r14,%rdi
+  800f1a:	48 b8 52 0c 80 00 00 	movabs $0x800c52,%rax
+  800f21:	00 00 00 
+  800f24:	ff d0                	call   *%rax
+  800f26:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f29:	48 39 c3             	cmp    %rax,%rbx
+  800f2c:	74 36                	je     800f64 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f2e:	48 89 d8             	mov    %rbx,%rax
+  800f31:	4c 29 e8             	sub    %r13,%rax
+  800f34:	49 39 c4             	cmp    %rax,%r12
+  800f37:	73 31                	jae    800f6a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f39:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f3e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f42:	4c 89 fe             	mov    %r15,%rsi
+  800f45:	48 b8 d6 0e 80 00 00 	movabs $0x800ed6,%rax
+  800f4c:	00 00 00 
+  800f4f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f51:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f55:	48 83 c4 08          	add    $0x8,%rsp
+  800f59:	5b                   	pop    %rbx
+  800f5a:	41 5c                	pop    %r12
+  800f5c:	41 5d                	pop    %r13
+  800f5e:	41 5e                	pop    %r14
+  800f60:	41 5f                	pop    %r15
+  800f62:	5d                   	pop    %rbp
+  800f63:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f64:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f68:	eb eb                	jmp    800f55 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f6a:	48 83 eb 01          	sub    $0x1,%rbx
+  800f6e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f72:	48 89 da             	mov    %rbx,%rdx
+  800f75:	4c 89 fe             	mov    %r15,%rsi
+  800f78:	48 b8 d6 0e 80 00 00 	movabs $0x800ed6,%rax
+  800f7f:	00 00 00 
+  800f82:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f84:	49 01 de             	add    %rbx,%r14
+  800f87:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f8c:	eb c3                	jmp    800f51 <strlcat+0x69>
+
+0000000000800f8e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f8e:	48 85 d2             	test   %rdx,%rdx
+  800f91:	74 2d                	je     800fc0 <memcmp+0x32>
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f98:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f9c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fa1:	44 38 c1             	cmp    %r8b,%cl
+  800fa4:	75 0f                	jne    800fb5 <memcmp+0x27>
+    while (n-- > 0) {
+  800fa6:	48 83 c0 01          	add    $0x1,%rax
+  800faa:	48 39 c2             	cmp    %rax,%rdx
+  800fad:	75 e9                	jne    800f98 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fb5:	0f b6 c1             	movzbl %cl,%eax
+  800fb8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fbc:	44 29 c0             	sub    %r8d,%eax
+  800fbf:	c3                   	ret
+    return 0;
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc5:	c3                   	ret
+
+0000000000800fc6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fc6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fca:	48 39 c7             	cmp    %rax,%rdi
+  800fcd:	73 0f                	jae    800fde <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fcf:	40 38 37             	cmp    %sil,(%rdi)
+  800fd2:	74 0e                	je     800fe2 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fd4:	48 83 c7 01          	add    $0x1,%rdi
+  800fd8:	48 39 f8             	cmp    %rdi,%rax
+  800fdb:	75 f2                	jne    800fcf <memfind+0x9>
+  800fdd:	c3                   	ret
+  800fde:	48 89 f8             	mov    %rdi,%rax
+  800fe1:	c3                   	ret
+  800fe2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fe6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fe9:	0f b6 37             	movzbl (%rdi),%esi
+  800fec:	40 80 fe 20          	cmp    $0x20,%sil
+  800ff0:	74 06                	je     800ff8 <strtol+0x12>
+  800ff2:	40 80 fe 09          	cmp    $0x9,%sil
+  800ff6:	75 13                	jne    80100b <strtol+0x25>
+  800ff8:	48 83 c7 01          	add    $0x1,%rdi
+  800ffc:	0f b6 37             	movzbl (%rdi),%esi
+  800fff:	40 80 fe 20          	cmp    $0x20,%sil
+  801003:	74 f3                	je     800ff8 <strtol+0x12>
+  801005:	40 80 fe 09          	cmp    $0x9,%sil
+  801009:	74 ed                	je     800ff8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80100b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80100e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801011:	3c 01                	cmp    $0x1,%al
+  801013:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801017:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80101d:	75 0f                	jne    80102e <strtol+0x48>
+  80101f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801022:	74 14                	je     801038 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801024:	85 d2                	test   %edx,%edx
+  801026:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80102b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80102e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801033:	4c 63 ca             	movslq %edx,%r9
+  801036:	eb 36                	jmp    80106e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801038:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80103c:	74 0f                	je     80104d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80103e:	85 d2                	test   %edx,%edx
+  801040:	75 ec                	jne    80102e <strtol+0x48>
+        s++;
+  801042:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801046:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80104b:	eb e1                	jmp    80102e <strtol+0x48>
+        s += 2;
+  80104d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801051:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801056:	eb d6                	jmp    80102e <strtol+0x48>
+            dig -= '0';
+  801058:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80105b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80105f:	41 39 d0             	cmp    %edx,%r8d
+  801062:	7d 21                	jge    801085 <strtol+0x9f>
+        val = val * base + dig;
+  801064:	49 0f af c1          	imul   %r9,%rax
+  801068:	0f b6 c9             	movzbl %cl,%ecx
+  80106b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80106e:	48 83 c7 01          	add    $0x1,%rdi
+  801072:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801076:	80 f9 39             	cmp    $0x39,%cl
+  801079:	76 dd                	jbe    801058 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80107b:	80 f9 7b             	cmp    $0x7b,%cl
+  80107e:	77 05                	ja     801085 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801080:	83 e9 57             	sub    $0x57,%ecx
+  801083:	eb d6                	jmp    80105b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801085:	4d 85 d2             	test   %r10,%r10
+  801088:	74 03                	je     80108d <strtol+0xa7>
+  80108a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80108d:	48 89 c2             	mov    %rax,%rdx
+  801090:	48 f7 da             	neg    %rdx
+  801093:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801097:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80109b:	c3                   	ret
+
+000000000080109c <strrev>:
+
+void
+strrev(char *str)
+{
+  80109c:	55                   	push   %rbp
+  80109d:	48 89 e5             	mov    %rsp,%rbp
+  8010a0:	53                   	push   %rbx
+  8010a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a5:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8010a8:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  8010af:	00 00 00 
+  8010b2:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010b4:	83 e8 01             	sub    $0x1,%eax
+  8010b7:	85 c0                	test   %eax,%eax
+  8010b9:	7e 22                	jle    8010dd <strrev+0x41>
+  8010bb:	48 98                	cltq
+  8010bd:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010c2:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010c6:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010ca:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010ce:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010d1:	48 83 c2 01          	add    $0x1,%rdx
+  8010d5:	48 83 e8 01          	sub    $0x1,%rax
+  8010d9:	39 c2                	cmp    %eax,%edx
+  8010db:	7c e5                	jl     8010c2 <strrev+0x26>
+	}
+}
+  8010dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+00000000008010e3 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8010e3:	85 d2                	test   %edx,%edx
+  8010e5:	0f 84 80 00 00 00    	je     80116b <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8010eb:	55                   	push   %rbp
+  8010ec:	48 89 e5             	mov    %rsp,%rbp
+  8010ef:	53                   	push   %rbx
+  8010f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8010f4:	49 89 f2             	mov    %rsi,%r10
+  8010f7:	41 89 d3             	mov    %edx,%r11d
+  8010fa:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8010fd:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801102:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801105:	eb 20                	jmp    801127 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801107:	41 89 f1             	mov    %esi,%r9d
+  80110a:	83 c2 30             	add    $0x30,%edx
+  80110d:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801110:	89 f8                	mov    %edi,%eax
+  801112:	99                   	cltd
+  801113:	f7 f9                	idiv   %ecx
+  801115:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801117:	85 c0                	test   %eax,%eax
+  801119:	74 2e                	je     801149 <itoa+0x66>
+  80111b:	83 c6 01             	add    $0x1,%esi
+  80111e:	49 83 c0 01          	add    $0x1,%r8
+  801122:	44 39 cb             	cmp    %r9d,%ebx
+  801125:	7e 15                	jle    80113c <itoa+0x59>
+		digit = sum % base;
+  801127:	89 f8                	mov    %edi,%eax
+  801129:	99                   	cltd
+  80112a:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80112c:	83 fa 09             	cmp    $0x9,%edx
+  80112f:	7e d6                	jle    801107 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801131:	41 89 f1             	mov    %esi,%r9d
+  801134:	83 c2 37             	add    $0x37,%edx
+  801137:	41 88 10             	mov    %dl,(%r8)
+  80113a:	eb d4                	jmp    801110 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80113c:	41 83 eb 01          	sub    $0x1,%r11d
+  801140:	45 39 cb             	cmp    %r9d,%r11d
+  801143:	75 04                	jne    801149 <itoa+0x66>
+  801145:	85 c0                	test   %eax,%eax
+  801147:	75 28                	jne    801171 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801149:	4d 63 c9             	movslq %r9d,%r9
+  80114c:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801151:	4c 89 d7             	mov    %r10,%rdi
+  801154:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  80115b:	00 00 00 
+  80115e:	ff d0                	call   *%rax
+	return 0;
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+  801165:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801169:	c9                   	leave
+  80116a:	c3                   	ret
+		return -1;
+  80116b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801170:	c3                   	ret
+		return -1;
+  801171:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801176:	eb ed                	jmp    801165 <itoa+0x82>
+
+0000000000801178 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801178:	55                   	push   %rbp
+  801179:	48 89 e5             	mov    %rsp,%rbp
+  80117c:	53                   	push   %rbx
+  80117d:	48 89 fa             	mov    %rdi,%rdx
+  801180:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801183:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801192:	be 00 00 00 00       	mov    $0x0,%esi
+  801197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80119f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a3:	c9                   	leave
+  8011a4:	c3                   	ret
+
+00000000008011a5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011a5:	55                   	push   %rbp
+  8011a6:	48 89 e5             	mov    %rsp,%rbp
+  8011a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011aa:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ce:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d4:	c9                   	leave
+  8011d5:	c3                   	ret
+
+00000000008011d6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011d6:	55                   	push   %rbp
+  8011d7:	48 89 e5             	mov    %rsp,%rbp
+  8011da:	53                   	push   %rbx
+  8011db:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801201:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801203:	48 85 c0             	test   %rax,%rax
+  801206:	7f 06                	jg     80120e <sys_env_destroy+0x38>
+}
+  801208:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120c:	c9                   	leave
+  80120d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80120e:	49 89 c0             	mov    %rax,%r8
+  801211:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801216:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  80121d:	00 00 00 
+  801220:	be 26 00 00 00       	mov    $0x26,%esi
+  801225:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  80122c:	00 00 00 
+  80122f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801234:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  80123b:	00 00 00 
+  80123e:	41 ff d1             	call   *%r9
+
+0000000000801241 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801241:	55                   	push   %rbp
+  801242:	48 89 e5             	mov    %rsp,%rbp
+  801245:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801246:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801250:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125f:	be 00 00 00 00       	mov    $0x0,%esi
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80126c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <sys_yield>:
+
+void
+sys_yield(void) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801277:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801281:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801286:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801290:	be 00 00 00 00       	mov    $0x0,%esi
+  801295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a1:	c9                   	leave
+  8012a2:	c3                   	ret
+
+00000000008012a3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	53                   	push   %rbx
+  8012a8:	48 89 fa             	mov    %rdi,%rdx
+  8012ab:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ae:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012ba:	00 00 00 
+  8012bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d3:	c9                   	leave
+  8012d4:	c3                   	ret
+
+00000000008012d5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012d5:	55                   	push   %rbp
+  8012d6:	48 89 e5             	mov    %rsp,%rbp
+  8012d9:	53                   	push   %rbx
+  8012da:	49 89 f8             	mov    %rdi,%r8
+  8012dd:	48 89 d3             	mov    %rdx,%rbx
+  8012e0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e8:	4c 89 c2             	mov    %r8,%rdx
+  8012eb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+
+0000000000801301 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	53                   	push   %rbx
+  801306:	48 83 ec 08          	sub    $0x8,%rsp
+  80130a:	89 f8                	mov    %edi,%eax
+  80130c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80130f:	48 63 f9             	movslq %ecx,%rdi
+  801312:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801315:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131d:	be 00 00 00 00       	mov    $0x0,%esi
+  801322:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801328:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132a:	48 85 c0             	test   %rax,%rax
+  80132d:	7f 06                	jg     801335 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80132f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801333:	c9                   	leave
+  801334:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801335:	49 89 c0             	mov    %rax,%r8
+  801338:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80133d:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  801344:	00 00 00 
+  801347:	be 26 00 00 00       	mov    $0x26,%esi
+  80134c:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  801353:	00 00 00 
+  801356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135b:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  801362:	00 00 00 
+  801365:	41 ff d1             	call   *%r9
+
+0000000000801368 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	53                   	push   %rbx
+  80136d:	48 83 ec 08          	sub    $0x8,%rsp
+  801371:	89 f8                	mov    %edi,%eax
+  801373:	49 89 f2             	mov    %rsi,%r10
+  801376:	48 89 cf             	mov    %rcx,%rdi
+  801379:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80137c:	48 63 da             	movslq %edx,%rbx
+  80137f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801382:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801387:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80138d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138f:	48 85 c0             	test   %rax,%rax
+  801392:	7f 06                	jg     80139a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801394:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801398:	c9                   	leave
+  801399:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139a:	49 89 c0             	mov    %rax,%r8
+  80139d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013a2:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  8013a9:	00 00 00 
+  8013ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b1:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  8013b8:	00 00 00 
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c0:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  8013c7:	00 00 00 
+  8013ca:	41 ff d1             	call   *%r9
+
+00000000008013cd <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	53                   	push   %rbx
+  8013d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d6:	48 89 f1             	mov    %rsi,%rcx
+  8013d9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013df:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f6:	48 85 c0             	test   %rax,%rax
+  8013f9:	7f 06                	jg     801401 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801401:	49 89 c0             	mov    %rax,%r8
+  801404:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801409:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  801410:	00 00 00 
+  801413:	be 26 00 00 00       	mov    $0x26,%esi
+  801418:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  80141f:	00 00 00 
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  80142e:	00 00 00 
+  801431:	41 ff d1             	call   *%r9
+
+0000000000801434 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	53                   	push   %rbx
+  801439:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80143d:	48 63 ce             	movslq %esi,%rcx
+  801440:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801443:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801452:	be 00 00 00 00       	mov    $0x0,%esi
+  801457:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145f:	48 85 c0             	test   %rax,%rax
+  801462:	7f 06                	jg     80146a <sys_env_set_status+0x36>
+}
+  801464:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146a:	49 89 c0             	mov    %rax,%r8
+  80146d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801472:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  801479:	00 00 00 
+  80147c:	be 26 00 00 00       	mov    $0x26,%esi
+  801481:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  801488:	00 00 00 
+  80148b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801490:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  801497:	00 00 00 
+  80149a:	41 ff d1             	call   *%r9
+
+000000000080149d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+  8014a1:	53                   	push   %rbx
+  8014a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c8:	48 85 c0             	test   %rax,%rax
+  8014cb:	7f 06                	jg     8014d3 <sys_env_set_trapframe+0x36>
+}
+  8014cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d1:	c9                   	leave
+  8014d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d3:	49 89 c0             	mov    %rax,%r8
+  8014d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014db:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  8014e2:	00 00 00 
+  8014e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ea:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  8014f1:	00 00 00 
+  8014f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f9:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  801500:	00 00 00 
+  801503:	41 ff d1             	call   *%r9
+
+0000000000801506 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	53                   	push   %rbx
+  80150b:	48 83 ec 08          	sub    $0x8,%rsp
+  80150f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801512:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801515:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801524:	be 00 00 00 00       	mov    $0x0,%esi
+  801529:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801531:	48 85 c0             	test   %rax,%rax
+  801534:	7f 06                	jg     80153c <sys_env_set_pgfault_upcall+0x36>
+}
+  801536:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153a:	c9                   	leave
+  80153b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153c:	49 89 c0             	mov    %rax,%r8
+  80153f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801544:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  80154b:	00 00 00 
+  80154e:	be 26 00 00 00       	mov    $0x26,%esi
+  801553:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  80155a:	00 00 00 
+  80155d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801562:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  801569:	00 00 00 
+  80156c:	41 ff d1             	call   *%r9
+
+000000000080156f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+  801573:	53                   	push   %rbx
+  801574:	89 f8                	mov    %edi,%eax
+  801576:	49 89 f1             	mov    %rsi,%r9
+  801579:	48 89 d3             	mov    %rdx,%rbx
+  80157c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80157f:	49 63 f0             	movslq %r8d,%rsi
+  801582:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801585:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80158a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801593:	cd 30                	int    $0x30
+}
+  801595:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+
+000000000080159b <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80159b:	55                   	push   %rbp
+  80159c:	48 89 e5             	mov    %rsp,%rbp
+  80159f:	53                   	push   %rbx
+  8015a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a4:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8015a7:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015aa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015af:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c4:	48 85 c0             	test   %rax,%rax
+  8015c7:	7f 06                	jg     8015cf <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cf:	49 89 c0             	mov    %rax,%r8
+  8015d2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015d7:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  8015de:	00 00 00 
+  8015e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e6:	48 bf 47 40 80 00 00 	movabs $0x804047,%rdi
+  8015ed:	00 00 00 
+  8015f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f5:	49 b9 00 02 80 00 00 	movabs $0x800200,%r9
+  8015fc:	00 00 00 
+  8015ff:	41 ff d1             	call   *%r9
+
+0000000000801602 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801602:	55                   	push   %rbp
+  801603:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801606:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160b:	48 b8 9b 15 80 00 00 	movabs $0x80159b,%rax
+  801612:	00 00 00 
+  801615:	ff d0                	call   *%rax
+}
+  801617:	5d                   	pop    %rbp
+  801618:	c3                   	ret
+
+0000000000801619 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80161e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801623:	ba 00 00 00 00       	mov    $0x0,%edx
+  801628:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801632:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801637:	be 00 00 00 00       	mov    $0x0,%esi
+  80163c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801642:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801644:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+
+000000000080164a <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80164a:	55                   	push   %rbp
+  80164b:	48 89 e5             	mov    %rsp,%rbp
+  80164e:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80164f:	48 63 ce             	movslq %esi,%rcx
+  801652:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801656:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+}
+  801672:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801676:	c9                   	leave
+  801677:	c3                   	ret
+
+0000000000801678 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801678:	55                   	push   %rbp
+  801679:	48 89 e5             	mov    %rsp,%rbp
+  80167c:	53                   	push   %rbx
+  80167d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801680:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801684:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169e:	cd 30                	int    $0x30
+}
+  8016a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+00000000008016a6 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	53                   	push   %rbx
+  8016ab:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8016ae:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b6:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016be:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c9:	cd 30                	int    $0x30
+}
+  8016cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cf:	c9                   	leave
+  8016d0:	c3                   	ret
+
+00000000008016d1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8016d1:	55                   	push   %rbp
+  8016d2:	48 89 e5             	mov    %rsp,%rbp
+  8016d5:	41 56                	push   %r14
+  8016d7:	41 55                	push   %r13
+  8016d9:	41 54                	push   %r12
+  8016db:	53                   	push   %rbx
+  8016dc:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016df:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  8016e6:	00 00 00 
+  8016e9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8016ed:	74 27                	je     801716 <_handle_vectored_pagefault+0x45>
+  8016ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8016f4:	49 bd 20 60 80 00 00 	movabs $0x806020,%r13
+  8016fb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016fe:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801701:	4c 89 e7             	mov    %r12,%rdi
+  801704:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801709:	84 c0                	test   %al,%al
+  80170b:	75 45                	jne    801752 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80170d:	48 83 c3 01          	add    $0x1,%rbx
+  801711:	49 3b 1e             	cmp    (%r14),%rbx
+  801714:	72 eb                	jb     801701 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801716:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80171d:	00 
+  80171e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801723:	4d 8b 04 24          	mov    (%r12),%r8
+  801727:	48 ba 58 40 80 00 00 	movabs $0x804058,%rdx
+  80172e:	00 00 00 
+  801731:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801736:	48 bf 88 40 80 00 00 	movabs $0x804088,%rdi
+  80173d:	00 00 00 
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	49 ba 00 02 80 00 00 	movabs $0x800200,%r10
+  80174c:	00 00 00 
+  80174f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801752:	5b                   	pop    %rbx
+  801753:	41 5c                	pop    %r12
+  801755:	41 5d                	pop    %r13
+  801757:	41 5e                	pop    %r14
+  801759:	5d                   	pop    %rbp
+  80175a:	c3                   	ret
+
+000000000080175b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80175b:	55                   	push   %rbp
+  80175c:	48 89 e5             	mov    %rsp,%rbp
+  80175f:	53                   	push   %rbx
+  801760:	48 83 ec 08          	sub    $0x8,%rsp
+  801764:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801767:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80176e:	00 00 00 
+  801771:	80 38 00             	cmpb   $0x0,(%rax)
+  801774:	0f 84 84 00 00 00    	je     8017fe <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80177a:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  801781:	00 00 00 
+  801784:	48 8b 10             	mov    (%rax),%rdx
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80178c:	48 b9 20 60 80 00 00 	movabs $0x806020,%rcx
+  801793:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801796:	48 85 d2             	test   %rdx,%rdx
+  801799:	74 19                	je     8017b4 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80179b:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80179f:	0f 84 e8 00 00 00    	je     80188d <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017a5:	48 83 c0 01          	add    $0x1,%rax
+  8017a9:	48 39 d0             	cmp    %rdx,%rax
+  8017ac:	75 ed                	jne    80179b <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8017ae:	48 83 fa 08          	cmp    $0x8,%rdx
+  8017b2:	74 1c                	je     8017d0 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8017b4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017b8:	48 a3 68 60 80 00 00 	movabs %rax,0x806068
+  8017bf:	00 00 00 
+  8017c2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8017c9:	00 00 00 
+  8017cc:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8017d0:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+  8017dc:	89 c7                	mov    %eax,%edi
+  8017de:	48 be 53 19 80 00 00 	movabs $0x801953,%rsi
+  8017e5:	00 00 00 
+  8017e8:	48 b8 06 15 80 00 00 	movabs $0x801506,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	78 68                	js     801860 <add_pgfault_handler+0x105>
+    return res;
+}
+  8017f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8017fe:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+  80180a:	89 c7                	mov    %eax,%edi
+  80180c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801811:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801816:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80181d:	00 00 00 
+  801820:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  801827:	00 00 00 
+  80182a:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80182c:	48 ba 68 60 80 00 00 	movabs $0x806068,%rdx
+  801833:	00 00 00 
+  801836:	48 8b 02             	mov    (%rdx),%rax
+  801839:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80183d:	48 89 0a             	mov    %rcx,(%rdx)
+  801840:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801847:	00 00 00 
+  80184a:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80184e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801855:	00 00 00 
+  801858:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80185b:	e9 70 ff ff ff       	jmp    8017d0 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801860:	89 c1                	mov    %eax,%ecx
+  801862:	48 ba 96 40 80 00 00 	movabs $0x804096,%rdx
+  801869:	00 00 00 
+  80186c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801871:	48 bf 88 40 80 00 00 	movabs $0x804088,%rdi
+  801878:	00 00 00 
+  80187b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801880:	49 b8 00 02 80 00 00 	movabs $0x800200,%r8
+  801887:	00 00 00 
+  80188a:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801892:	e9 61 ff ff ff       	jmp    8017f8 <add_pgfault_handler+0x9d>
+
+0000000000801897 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80189b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8018a2:	00 00 00 
+  8018a5:	80 38 00             	cmpb   $0x0,(%rax)
+  8018a8:	74 33                	je     8018dd <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018aa:	48 a1 68 60 80 00 00 	movabs 0x806068,%rax
+  8018b1:	00 00 00 
+  8018b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8018b9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8018c0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018c3:	48 85 c0             	test   %rax,%rax
+  8018c6:	0f 84 85 00 00 00    	je     801951 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8018cc:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8018d0:	74 40                	je     801912 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018d2:	48 83 c1 01          	add    $0x1,%rcx
+  8018d6:	48 39 c1             	cmp    %rax,%rcx
+  8018d9:	75 f1                	jne    8018cc <remove_pgfault_handler+0x35>
+  8018db:	eb 74                	jmp    801951 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8018dd:	48 b9 ae 40 80 00 00 	movabs $0x8040ae,%rcx
+  8018e4:	00 00 00 
+  8018e7:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  8018ee:	00 00 00 
+  8018f1:	be 43 00 00 00       	mov    $0x43,%esi
+  8018f6:	48 bf 88 40 80 00 00 	movabs $0x804088,%rdi
+  8018fd:	00 00 00 
+  801900:	b8 00 00 00 00       	mov    $0x0,%eax
+  801905:	49 b8 00 02 80 00 00 	movabs $0x800200,%r8
+  80190c:	00 00 00 
+  80190f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801912:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801919:	00 
+  80191a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80191e:	48 29 ca             	sub    %rcx,%rdx
+  801921:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801928:	00 00 00 
+  80192b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80192f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801934:	48 89 ce             	mov    %rcx,%rsi
+  801937:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  80193e:	00 00 00 
+  801941:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801943:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  80194a:	00 00 00 
+  80194d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801951:	5d                   	pop    %rbp
+  801952:	c3                   	ret
+
+0000000000801953 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801953:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801956:	48 b8 d1 16 80 00 00 	movabs $0x8016d1,%rax
+  80195d:	00 00 00 
+    call *%rax
+  801960:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    popq %r15
+  801962:	41 5f                	pop    %r15
+    popq %r15
+  801964:	41 5f                	pop    %r15
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+    popq %r15
+  801966:	41 5f                	pop    %r15
+    popq %r14
+  801968:	41 5e                	pop    %r14
+    popq %r13
+  80196a:	41 5d                	pop    %r13
+    popq %r12
+  80196c:	41 5c                	pop    %r12
+    popq %r11
+  80196e:	41 5b                	pop    %r11
+    popq %r10
+  801970:	41 5a                	pop    %r10
+    popq %r9
+  801972:	41 59                	pop    %r9
+    popq %r8
+  801974:	41 58                	pop    %r8
+    popq %rsi
+  801976:	5e                   	pop    %rsi
+    popq %rdi
+  801977:	5f                   	pop    %rdi
+    popq %rbp
+  801978:	5d                   	pop    %rbp
+    popq %rdx
+  801979:	5a                   	pop    %rdx
+    popq %rcx
+  80197a:	59                   	pop    %rcx
+    movq 32(%rsp), %rbx
+  80197b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801980:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801985:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801989:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80198c:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+    popq %rbx
+  801991:	5b                   	pop    %rbx
+    popq %rax
+  801992:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    pushq 8(%rsp)
+  801993:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801997:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    movq 16(%rsp), %rsp
+  801998:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+  80199d:	c3                   	ret
+
+000000000080199e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80199e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019a5:	ff ff ff 
+  8019a8:	48 01 f8             	add    %rdi,%rax
+  8019ab:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019af:	c3                   	ret
+
+00000000008019b0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019b7:	ff ff ff 
+  8019ba:	48 01 f8             	add    %rdi,%rax
+  8019bd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019c1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019c7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019cb:	c3                   	ret
+
+00000000008019cc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019cc:	55                   	push   %rbp
+  8019cd:	48 89 e5             	mov    %rsp,%rbp
+  8019d0:	41 57                	push   %r15
+  8019d2:	41 56                	push   %r14
+  8019d4:	41 55                	push   %r13
+  8019d6:	41 54                	push   %r12
+  8019d8:	53                   	push   %rbx
+  8019d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019dd:	49 89 ff             	mov    %rdi,%r15
+  8019e0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019e5:	49 bd eb 34 80 00 00 	movabs $0x8034eb,%r13
+  8019ec:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019ef:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019f5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019f8:	48 89 df             	mov    %rbx,%rdi
+  8019fb:	41 ff d5             	call   *%r13
+  8019fe:	83 e0 04             	and    $0x4,%eax
+  801a01:	74 17                	je     801a1a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a03:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a0a:	4c 39 f3             	cmp    %r14,%rbx
+  801a0d:	75 e6                	jne    8019f5 <fd_alloc+0x29>
+  801a0f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a15:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a1a:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a1d:	48 83 c4 08          	add    $0x8,%rsp
+  801a21:	5b                   	pop    %rbx
+  801a22:	41 5c                	pop    %r12
+  801a24:	41 5d                	pop    %r13
+  801a26:	41 5e                	pop    %r14
+  801a28:	41 5f                	pop    %r15
+  801a2a:	5d                   	pop    %rbp
+  801a2b:	c3                   	ret
+
+0000000000801a2c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a2c:	83 ff 1f             	cmp    $0x1f,%edi
+  801a2f:	77 39                	ja     801a6a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a31:	55                   	push   %rbp
+  801a32:	48 89 e5             	mov    %rsp,%rbp
+  801a35:	41 54                	push   %r12
+  801a37:	53                   	push   %rbx
+  801a38:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a3b:	48 63 df             	movslq %edi,%rbx
+  801a3e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a45:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a49:	48 89 df             	mov    %rbx,%rdi
+  801a4c:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+  801a58:	a8 04                	test   $0x4,%al
+  801a5a:	74 14                	je     801a70 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a5c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a65:	5b                   	pop    %rbx
+  801a66:	41 5c                	pop    %r12
+  801a68:	5d                   	pop    %rbp
+  801a69:	c3                   	ret
+        return -E_INVAL;
+  801a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a6f:	c3                   	ret
+        return -E_INVAL;
+  801a70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a75:	eb ee                	jmp    801a65 <fd_lookup+0x39>
+
+0000000000801a77 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a77:	55                   	push   %rbp
+  801a78:	48 89 e5             	mov    %rsp,%rbp
+  801a7b:	41 54                	push   %r12
+  801a7d:	53                   	push   %rbx
+  801a7e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a81:	48 b8 80 41 80 00 00 	movabs $0x804180,%rax
+  801a88:	00 00 00 
+  801a8b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a92:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a95:	39 3b                	cmp    %edi,(%rbx)
+  801a97:	74 47                	je     801ae0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a99:	48 83 c0 08          	add    $0x8,%rax
+  801a9d:	48 8b 18             	mov    (%rax),%rbx
+  801aa0:	48 85 db             	test   %rbx,%rbx
+  801aa3:	75 f0                	jne    801a95 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aa5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801aac:	00 00 00 
+  801aaf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ab5:	89 fa                	mov    %edi,%edx
+  801ab7:	48 bf e0 40 80 00 00 	movabs $0x8040e0,%rdi
+  801abe:	00 00 00 
+  801ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac6:	48 b9 50 03 80 00 00 	movabs $0x800350,%rcx
+  801acd:	00 00 00 
+  801ad0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ad7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801adb:	5b                   	pop    %rbx
+  801adc:	41 5c                	pop    %r12
+  801ade:	5d                   	pop    %rbp
+  801adf:	c3                   	ret
+            return 0;
+  801ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae5:	eb f0                	jmp    801ad7 <dev_lookup+0x60>
+
+0000000000801ae7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ae7:	55                   	push   %rbp
+  801ae8:	48 89 e5             	mov    %rsp,%rbp
+  801aeb:	41 55                	push   %r13
+  801aed:	41 54                	push   %r12
+  801aef:	53                   	push   %rbx
+  801af0:	48 83 ec 18          	sub    $0x18,%rsp
+  801af4:	48 89 fb             	mov    %rdi,%rbx
+  801af7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801afa:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b01:	ff ff ff 
+  801b04:	48 01 df             	add    %rbx,%rdi
+  801b07:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b0b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b0f:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+  801b1b:	41 89 c5             	mov    %eax,%r13d
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 06                	js     801b28 <fd_close+0x41>
+  801b22:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b26:	74 1a                	je     801b42 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b28:	45 84 e4             	test   %r12b,%r12b
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b30:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b34:	44 89 e8             	mov    %r13d,%eax
+  801b37:	48 83 c4 18          	add    $0x18,%rsp
+  801b3b:	5b                   	pop    %rbx
+  801b3c:	41 5c                	pop    %r12
+  801b3e:	41 5d                	pop    %r13
+  801b40:	5d                   	pop    %rbp
+  801b41:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b42:	8b 3b                	mov    (%rbx),%edi
+  801b44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b48:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+  801b54:	41 89 c5             	mov    %eax,%r13d
+  801b57:	85 c0                	test   %eax,%eax
+  801b59:	78 1b                	js     801b76 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b5f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b63:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b69:	48 85 c0             	test   %rax,%rax
+  801b6c:	74 08                	je     801b76 <fd_close+0x8f>
+  801b6e:	48 89 df             	mov    %rbx,%rdi
+  801b71:	ff d0                	call   *%rax
+  801b73:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b7b:	48 89 de             	mov    %rbx,%rsi
+  801b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b83:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801b8a:	00 00 00 
+  801b8d:	ff d0                	call   *%rax
+    return res;
+  801b8f:	eb a3                	jmp    801b34 <fd_close+0x4d>
+
+0000000000801b91 <close>:
+
+int
+close(int fdnum) {
+  801b91:	55                   	push   %rbp
+  801b92:	48 89 e5             	mov    %rsp,%rbp
+  801b95:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b99:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b9d:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	78 15                	js     801bc2 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bad:	be 01 00 00 00       	mov    $0x1,%esi
+  801bb2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bb6:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+}
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <close_all>:
+
+void
+close_all(void) {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	41 54                	push   %r12
+  801bca:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd0:	49 bc 91 1b 80 00 00 	movabs $0x801b91,%r12
+  801bd7:	00 00 00 
+  801bda:	89 df                	mov    %ebx,%edi
+  801bdc:	41 ff d4             	call   *%r12
+  801bdf:	83 c3 01             	add    $0x1,%ebx
+  801be2:	83 fb 20             	cmp    $0x20,%ebx
+  801be5:	75 f3                	jne    801bda <close_all+0x16>
+}
+  801be7:	5b                   	pop    %rbx
+  801be8:	41 5c                	pop    %r12
+  801bea:	5d                   	pop    %rbp
+  801beb:	c3                   	ret
+
+0000000000801bec <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bec:	55                   	push   %rbp
+  801bed:	48 89 e5             	mov    %rsp,%rbp
+  801bf0:	41 57                	push   %r15
+  801bf2:	41 56                	push   %r14
+  801bf4:	41 55                	push   %r13
+  801bf6:	41 54                	push   %r12
+  801bf8:	53                   	push   %rbx
+  801bf9:	48 83 ec 18          	sub    $0x18,%rsp
+  801bfd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c00:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c04:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801c0b:	00 00 00 
+  801c0e:	ff d0                	call   *%rax
+  801c10:	89 c3                	mov    %eax,%ebx
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	0f 88 b8 00 00 00    	js     801cd2 <dup+0xe6>
+    close(newfdnum);
+  801c1a:	44 89 e7             	mov    %r12d,%edi
+  801c1d:	48 b8 91 1b 80 00 00 	movabs $0x801b91,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c29:	4d 63 ec             	movslq %r12d,%r13
+  801c2c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c33:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c37:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c3b:	4c 89 ff             	mov    %r15,%rdi
+  801c3e:	49 be b0 19 80 00 00 	movabs $0x8019b0,%r14
+  801c45:	00 00 00 
+  801c48:	41 ff d6             	call   *%r14
+  801c4b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c4e:	4c 89 ef             	mov    %r13,%rdi
+  801c51:	41 ff d6             	call   *%r14
+  801c54:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c57:	48 89 df             	mov    %rbx,%rdi
+  801c5a:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c66:	a8 04                	test   $0x4,%al
+  801c68:	74 2b                	je     801c95 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c6a:	41 89 c1             	mov    %eax,%r9d
+  801c6d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c73:	4c 89 f1             	mov    %r14,%rcx
+  801c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7b:	48 89 de             	mov    %rbx,%rsi
+  801c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c83:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+  801c8f:	89 c3                	mov    %eax,%ebx
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	78 4e                	js     801ce3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c95:	4c 89 ff             	mov    %r15,%rdi
+  801c98:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+  801ca4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ca7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cad:	4c 89 e9             	mov    %r13,%rcx
+  801cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb5:	4c 89 fe             	mov    %r15,%rsi
+  801cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cbd:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  801cc4:	00 00 00 
+  801cc7:	ff d0                	call   *%rax
+  801cc9:	89 c3                	mov    %eax,%ebx
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 14                	js     801ce3 <dup+0xf7>
+
+    return newfdnum;
+  801ccf:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cd2:	89 d8                	mov    %ebx,%eax
+  801cd4:	48 83 c4 18          	add    $0x18,%rsp
+  801cd8:	5b                   	pop    %rbx
+  801cd9:	41 5c                	pop    %r12
+  801cdb:	41 5d                	pop    %r13
+  801cdd:	41 5e                	pop    %r14
+  801cdf:	41 5f                	pop    %r15
+  801ce1:	5d                   	pop    %rbp
+  801ce2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ce3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce8:	4c 89 ee             	mov    %r13,%rsi
+  801ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf0:	49 bc cd 13 80 00 00 	movabs $0x8013cd,%r12
+  801cf7:	00 00 00 
+  801cfa:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cfd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d02:	4c 89 f6             	mov    %r14,%rsi
+  801d05:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0a:	41 ff d4             	call   *%r12
+    return res;
+  801d0d:	eb c3                	jmp    801cd2 <dup+0xe6>
+
+0000000000801d0f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d0f:	55                   	push   %rbp
+  801d10:	48 89 e5             	mov    %rsp,%rbp
+  801d13:	41 56                	push   %r14
+  801d15:	41 55                	push   %r13
+  801d17:	41 54                	push   %r12
+  801d19:	53                   	push   %rbx
+  801d1a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1e:	89 fb                	mov    %edi,%ebx
+  801d20:	49 89 f4             	mov    %rsi,%r12
+  801d23:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d26:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d2a:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801d31:	00 00 00 
+  801d34:	ff d0                	call   *%rax
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 4c                	js     801d86 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d3e:	41 8b 3e             	mov    (%r14),%edi
+  801d41:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d45:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 35                	js     801d8a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d55:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d59:	83 e0 03             	and    $0x3,%eax
+  801d5c:	83 f8 01             	cmp    $0x1,%eax
+  801d5f:	74 2d                	je     801d8e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d65:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d69:	48 85 c0             	test   %rax,%rax
+  801d6c:	74 56                	je     801dc4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d6e:	4c 89 ea             	mov    %r13,%rdx
+  801d71:	4c 89 e6             	mov    %r12,%rsi
+  801d74:	4c 89 f7             	mov    %r14,%rdi
+  801d77:	ff d0                	call   *%rax
+}
+  801d79:	48 83 c4 10          	add    $0x10,%rsp
+  801d7d:	5b                   	pop    %rbx
+  801d7e:	41 5c                	pop    %r12
+  801d80:	41 5d                	pop    %r13
+  801d82:	41 5e                	pop    %r14
+  801d84:	5d                   	pop    %rbp
+  801d85:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d86:	48 98                	cltq
+  801d88:	eb ef                	jmp    801d79 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d8a:	48 98                	cltq
+  801d8c:	eb eb                	jmp    801d79 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d8e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d95:	00 00 00 
+  801d98:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d9e:	89 da                	mov    %ebx,%edx
+  801da0:	48 bf 41 41 80 00 00 	movabs $0x804141,%rdi
+  801da7:	00 00 00 
+  801daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daf:	48 b9 50 03 80 00 00 	movabs $0x800350,%rcx
+  801db6:	00 00 00 
+  801db9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dbb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dc2:	eb b5                	jmp    801d79 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dcb:	eb ac                	jmp    801d79 <read+0x6a>
+
+0000000000801dcd <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	41 56                	push   %r14
+  801dd3:	41 55                	push   %r13
+  801dd5:	41 54                	push   %r12
+  801dd7:	53                   	push   %rbx
+  801dd8:	48 83 ec 10          	sub    $0x10,%rsp
+  801ddc:	89 fb                	mov    %edi,%ebx
+  801dde:	49 89 f4             	mov    %rsi,%r12
+  801de1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801de8:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+  801df4:	85 c0                	test   %eax,%eax
+  801df6:	78 41                	js     801e39 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dfc:	41 8b 3e             	mov    (%r14),%edi
+  801dff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e03:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  801e0a:	00 00 00 
+  801e0d:	ff d0                	call   *%rax
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 35                	js     801e48 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e13:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e17:	83 e0 03             	and    $0x3,%eax
+  801e1a:	83 f8 01             	cmp    $0x1,%eax
+  801e1d:	74 2d                	je     801e4c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e23:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e27:	48 85 c0             	test   %rax,%rax
+  801e2a:	74 56                	je     801e82 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e2c:	4c 89 ea             	mov    %r13,%rdx
+  801e2f:	4c 89 e6             	mov    %r12,%rsi
+  801e32:	4c 89 f7             	mov    %r14,%rdi
+  801e35:	ff d0                	call   *%rax
+  801e37:	eb 02                	jmp    801e3b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e39:	48 98                	cltq
+}
+  801e3b:	48 83 c4 10          	add    $0x10,%rsp
+  801e3f:	5b                   	pop    %rbx
+  801e40:	41 5c                	pop    %r12
+  801e42:	41 5d                	pop    %r13
+  801e44:	41 5e                	pop    %r14
+  801e46:	5d                   	pop    %rbp
+  801e47:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e48:	48 98                	cltq
+  801e4a:	eb ef                	jmp    801e3b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e4c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e53:	00 00 00 
+  801e56:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e5c:	89 da                	mov    %ebx,%edx
+  801e5e:	48 bf 00 41 80 00 00 	movabs $0x804100,%rdi
+  801e65:	00 00 00 
+  801e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6d:	48 b9 50 03 80 00 00 	movabs $0x800350,%rcx
+  801e74:	00 00 00 
+  801e77:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e79:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e80:	eb b9                	jmp    801e3b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e82:	4c 89 ea             	mov    %r13,%rdx
+  801e85:	4c 89 e6             	mov    %r12,%rsi
+  801e88:	89 df                	mov    %ebx,%edi
+  801e8a:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  801e91:	00 00 00 
+  801e94:	ff d0                	call   *%rax
+  801e96:	eb a3                	jmp    801e3b <readmap+0x6e>
+
+0000000000801e98 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e98:	55                   	push   %rbp
+  801e99:	48 89 e5             	mov    %rsp,%rbp
+  801e9c:	41 57                	push   %r15
+  801e9e:	41 56                	push   %r14
+  801ea0:	41 55                	push   %r13
+  801ea2:	41 54                	push   %r12
+  801ea4:	53                   	push   %rbx
+  801ea5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ea9:	48 85 d2             	test   %rdx,%rdx
+  801eac:	74 54                	je     801f02 <readn+0x6a>
+  801eae:	41 89 fd             	mov    %edi,%r13d
+  801eb1:	49 89 f6             	mov    %rsi,%r14
+  801eb4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ebc:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ec1:	49 bf 0f 1d 80 00 00 	movabs $0x801d0f,%r15
+  801ec8:	00 00 00 
+  801ecb:	4c 89 e2             	mov    %r12,%rdx
+  801ece:	48 29 f2             	sub    %rsi,%rdx
+  801ed1:	4c 01 f6             	add    %r14,%rsi
+  801ed4:	44 89 ef             	mov    %r13d,%edi
+  801ed7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eda:	85 c0                	test   %eax,%eax
+  801edc:	78 20                	js     801efe <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ede:	01 c3                	add    %eax,%ebx
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	74 08                	je     801eec <readn+0x54>
+  801ee4:	48 63 f3             	movslq %ebx,%rsi
+  801ee7:	4c 39 e6             	cmp    %r12,%rsi
+  801eea:	72 df                	jb     801ecb <readn+0x33>
+    }
+    return res;
+  801eec:	48 63 c3             	movslq %ebx,%rax
+}
+  801eef:	48 83 c4 08          	add    $0x8,%rsp
+  801ef3:	5b                   	pop    %rbx
+  801ef4:	41 5c                	pop    %r12
+  801ef6:	41 5d                	pop    %r13
+  801ef8:	41 5e                	pop    %r14
+  801efa:	41 5f                	pop    %r15
+  801efc:	5d                   	pop    %rbp
+  801efd:	c3                   	ret
+        if (inc < 0) return inc;
+  801efe:	48 98                	cltq
+  801f00:	eb ed                	jmp    801eef <readn+0x57>
+    int inc = 1, res = 0;
+  801f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f07:	eb e3                	jmp    801eec <readn+0x54>
+
+0000000000801f09 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f09:	55                   	push   %rbp
+  801f0a:	48 89 e5             	mov    %rsp,%rbp
+  801f0d:	41 56                	push   %r14
+  801f0f:	41 55                	push   %r13
+  801f11:	41 54                	push   %r12
+  801f13:	53                   	push   %rbx
+  801f14:	48 83 ec 10          	sub    $0x10,%rsp
+  801f18:	89 fb                	mov    %edi,%ebx
+  801f1a:	49 89 f4             	mov    %rsi,%r12
+  801f1d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f20:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f24:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801f2b:	00 00 00 
+  801f2e:	ff d0                	call   *%rax
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 47                	js     801f7b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f34:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f38:	41 8b 3e             	mov    (%r14),%edi
+  801f3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f3f:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 30                	js     801f7f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f4f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f54:	74 2d                	je     801f83 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f5a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f5e:	48 85 c0             	test   %rax,%rax
+  801f61:	74 56                	je     801fb9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f63:	4c 89 ea             	mov    %r13,%rdx
+  801f66:	4c 89 e6             	mov    %r12,%rsi
+  801f69:	4c 89 f7             	mov    %r14,%rdi
+  801f6c:	ff d0                	call   *%rax
+}
+  801f6e:	48 83 c4 10          	add    $0x10,%rsp
+  801f72:	5b                   	pop    %rbx
+  801f73:	41 5c                	pop    %r12
+  801f75:	41 5d                	pop    %r13
+  801f77:	41 5e                	pop    %r14
+  801f79:	5d                   	pop    %rbp
+  801f7a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7b:	48 98                	cltq
+  801f7d:	eb ef                	jmp    801f6e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7f:	48 98                	cltq
+  801f81:	eb eb                	jmp    801f6e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f83:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f8a:	00 00 00 
+  801f8d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f93:	89 da                	mov    %ebx,%edx
+  801f95:	48 bf 5d 41 80 00 00 	movabs $0x80415d,%rdi
+  801f9c:	00 00 00 
+  801f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa4:	48 b9 50 03 80 00 00 	movabs $0x800350,%rcx
+  801fab:	00 00 00 
+  801fae:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb7:	eb b5                	jmp    801f6e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fb9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fc0:	eb ac                	jmp    801f6e <write+0x65>
+
+0000000000801fc2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	53                   	push   %rbx
+  801fc7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fcb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd1:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 0c                	js     801fed <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fe1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff1:	c9                   	leave
+  801ff2:	c3                   	ret
+
+0000000000801ff3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ff3:	55                   	push   %rbp
+  801ff4:	48 89 e5             	mov    %rsp,%rbp
+  801ff7:	41 55                	push   %r13
+  801ff9:	41 54                	push   %r12
+  801ffb:	53                   	push   %rbx
+  801ffc:	48 83 ec 18          	sub    $0x18,%rsp
+  802000:	89 fb                	mov    %edi,%ebx
+  802002:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802005:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802009:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  802010:	00 00 00 
+  802013:	ff d0                	call   *%rax
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 38                	js     802051 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802019:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80201d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802021:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802025:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80202c:	00 00 00 
+  80202f:	ff d0                	call   *%rax
+  802031:	85 c0                	test   %eax,%eax
+  802033:	78 1c                	js     802051 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802035:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80203a:	74 20                	je     80205c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80203c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802040:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802044:	48 85 c0             	test   %rax,%rax
+  802047:	74 47                	je     802090 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802049:	44 89 e6             	mov    %r12d,%esi
+  80204c:	4c 89 ef             	mov    %r13,%rdi
+  80204f:	ff d0                	call   *%rax
+}
+  802051:	48 83 c4 18          	add    $0x18,%rsp
+  802055:	5b                   	pop    %rbx
+  802056:	41 5c                	pop    %r12
+  802058:	41 5d                	pop    %r13
+  80205a:	5d                   	pop    %rbp
+  80205b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80205c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802063:	00 00 00 
+  802066:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80206c:	89 da                	mov    %ebx,%edx
+  80206e:	48 bf 20 41 80 00 00 	movabs $0x804120,%rdi
+  802075:	00 00 00 
+  802078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207d:	48 b9 50 03 80 00 00 	movabs $0x800350,%rcx
+  802084:	00 00 00 
+  802087:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802089:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80208e:	eb c1                	jmp    802051 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802090:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802095:	eb ba                	jmp    802051 <ftruncate+0x5e>
+
+0000000000802097 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	41 54                	push   %r12
+  80209d:	53                   	push   %rbx
+  80209e:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020a9:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  8020b0:	00 00 00 
+  8020b3:	ff d0                	call   *%rax
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	78 4e                	js     802107 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020bd:	41 8b 3c 24          	mov    (%r12),%edi
+  8020c1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020c5:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+  8020d1:	85 c0                	test   %eax,%eax
+  8020d3:	78 32                	js     802107 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020d9:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8020de:	74 30                	je     802110 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020e0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020e3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020ea:	00 00 00 
+    stat->st_isdir = 0;
+  8020ed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020f4:	00 00 00 
+    stat->st_dev = dev;
+  8020f7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020fe:	48 89 de             	mov    %rbx,%rsi
+  802101:	4c 89 e7             	mov    %r12,%rdi
+  802104:	ff 50 30             	call   *0x30(%rax)
+}
+  802107:	48 83 c4 10          	add    $0x10,%rsp
+  80210b:	5b                   	pop    %rbx
+  80210c:	41 5c                	pop    %r12
+  80210e:	5d                   	pop    %rbp
+  80210f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802110:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802115:	eb f0                	jmp    802107 <fstat+0x70>
+
+0000000000802117 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802117:	55                   	push   %rbp
+  802118:	48 89 e5             	mov    %rsp,%rbp
+  80211b:	41 54                	push   %r12
+  80211d:	53                   	push   %rbx
+  80211e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802121:	be 00 00 00 00       	mov    $0x0,%esi
+  802126:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+  802132:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 25                	js     80215d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802138:	4c 89 e6             	mov    %r12,%rsi
+  80213b:	89 c7                	mov    %eax,%edi
+  80213d:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802144:	00 00 00 
+  802147:	ff d0                	call   *%rax
+  802149:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80214c:	89 df                	mov    %ebx,%edi
+  80214e:	48 b8 91 1b 80 00 00 	movabs $0x801b91,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+
+    return res;
+  80215a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80215d:	89 d8                	mov    %ebx,%eax
+  80215f:	5b                   	pop    %rbx
+  802160:	41 5c                	pop    %r12
+  802162:	5d                   	pop    %rbp
+  802163:	c3                   	ret
+
+0000000000802164 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	41 54                	push   %r12
+  80216a:	53                   	push   %rbx
+  80216b:	48 83 ec 10          	sub    $0x10,%rsp
+  80216f:	48 89 fb             	mov    %rdi,%rbx
+  802172:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802175:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802179:	bf 66 00 00 00       	mov    $0x66,%edi
+  80217e:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 1f                	js     8021ad <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80218e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802192:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802196:	48 85 c0             	test   %rax,%rax
+  802199:	74 1b                	je     8021b6 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80219b:	4c 89 e6             	mov    %r12,%rsi
+  80219e:	48 89 df             	mov    %rbx,%rdi
+  8021a1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021aa:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021ad:	48 83 c4 10          	add    $0x10,%rsp
+  8021b1:	5b                   	pop    %rbx
+  8021b2:	41 5c                	pop    %r12
+  8021b4:	5d                   	pop    %rbp
+  8021b5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021b6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021bb:	eb f0                	jmp    8021ad <create_snapshot+0x49>
+
+00000000008021bd <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021c9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021ce:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+  8021da:	85 c0                	test   %eax,%eax
+  8021dc:	78 1e                	js     8021fc <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8021de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e2:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021e6:	48 85 d2             	test   %rdx,%rdx
+  8021e9:	74 13                	je     8021fe <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8021eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f0:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802203:	eb f7                	jmp    8021fc <print_snapshot_list+0x3f>
+
+0000000000802205 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	53                   	push   %rbx
+  80220a:	48 83 ec 18          	sub    $0x18,%rsp
+  80220e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802211:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802215:	bf 66 00 00 00       	mov    $0x66,%edi
+  80221a:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 1c                	js     802246 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80222a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80222e:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802232:	48 85 c0             	test   %rax,%rax
+  802235:	74 15                	je     80224c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802237:	48 89 df             	mov    %rbx,%rdi
+  80223a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802243:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80224c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802251:	eb f3                	jmp    802246 <accept_snapshot+0x41>
+
+0000000000802253 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802253:	55                   	push   %rbp
+  802254:	48 89 e5             	mov    %rsp,%rbp
+  802257:	53                   	push   %rbx
+  802258:	48 83 ec 18          	sub    $0x18,%rsp
+  80225c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80225f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802263:	bf 66 00 00 00       	mov    $0x66,%edi
+  802268:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+  802274:	85 c0                	test   %eax,%eax
+  802276:	78 1c                	js     802294 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802278:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80227c:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802280:	48 85 c0             	test   %rax,%rax
+  802283:	74 15                	je     80229a <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802285:	48 89 df             	mov    %rbx,%rdi
+  802288:	ff d0                	call   *%rax
+    if (res < 0) {
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802291:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+        return -E_NOT_SUPP;
+  80229a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80229f:	eb f3                	jmp    802294 <delete_snapshot+0x41>
+
+00000000008022a1 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  8022a1:	55                   	push   %rbp
+  8022a2:	48 89 e5             	mov    %rsp,%rbp
+  8022a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ad:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022b2:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8022b9:	00 00 00 
+  8022bc:	ff d0                	call   *%rax
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	78 14                	js     8022d6 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8022c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c6:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8022ca:	48 85 d2             	test   %rdx,%rdx
+  8022cd:	74 09                	je     8022d8 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8022d6:	c9                   	leave
+  8022d7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022d8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022dd:	eb f7                	jmp    8022d6 <gc_snapshots+0x35>
+
+00000000008022df <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	41 56                	push   %r14
+  8022e5:	41 55                	push   %r13
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ee:	48 89 fb             	mov    %rdi,%rbx
+  8022f1:	49 89 f4             	mov    %rsi,%r12
+  8022f4:	49 89 d5             	mov    %rdx,%r13
+  8022f7:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022fa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022fe:	bf 66 00 00 00       	mov    $0x66,%edi
+  802303:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+  80230f:	85 c0                	test   %eax,%eax
+  802311:	78 1b                	js     80232e <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802313:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802317:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80231b:	48 85 c0             	test   %rax,%rax
+  80231e:	74 1b                	je     80233b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802320:	4c 89 f1             	mov    %r14,%rcx
+  802323:	4c 89 ea             	mov    %r13,%rdx
+  802326:	4c 89 e6             	mov    %r12,%rsi
+  802329:	48 89 df             	mov    %rbx,%rdi
+  80232c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80232e:	48 83 c4 10          	add    $0x10,%rsp
+  802332:	5b                   	pop    %rbx
+  802333:	41 5c                	pop    %r12
+  802335:	41 5d                	pop    %r13
+  802337:	41 5e                	pop    %r14
+  802339:	5d                   	pop    %rbp
+  80233a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80233b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802340:	eb ec                	jmp    80232e <diff_snapshots+0x4f>
+
+0000000000802342 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802342:	55                   	push   %rbp
+  802343:	48 89 e5             	mov    %rsp,%rbp
+  802346:	41 55                	push   %r13
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	48 83 ec 18          	sub    $0x18,%rsp
+  80234f:	48 89 fb             	mov    %rdi,%rbx
+  802352:	49 89 f4             	mov    %rsi,%r12
+  802355:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802358:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80235c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802361:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	78 18                	js     802389 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802371:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802375:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802379:	48 85 c0             	test   %rax,%rax
+  80237c:	74 16                	je     802394 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80237e:	4c 89 ea             	mov    %r13,%rdx
+  802381:	4c 89 e6             	mov    %r12,%rsi
+  802384:	48 89 df             	mov    %rbx,%rdi
+  802387:	ff d0                	call   *%rax
+
+    return res;
+}
+  802389:	48 83 c4 18          	add    $0x18,%rsp
+  80238d:	5b                   	pop    %rbx
+  80238e:	41 5c                	pop    %r12
+  802390:	41 5d                	pop    %r13
+  802392:	5d                   	pop    %rbp
+  802393:	c3                   	ret
+        return -E_NOT_SUPP;
+  802394:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802399:	eb ee                	jmp    802389 <send_snapshot+0x47>
+
+000000000080239b <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80239b:	55                   	push   %rbp
+  80239c:	48 89 e5             	mov    %rsp,%rbp
+  80239f:	53                   	push   %rbx
+  8023a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a4:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ab:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023b0:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 12                	js     8023d2 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8023c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023c4:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8023c8:	48 85 c0             	test   %rax,%rax
+  8023cb:	74 0b                	je     8023d8 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8023cd:	48 89 df             	mov    %rbx,%rdi
+  8023d0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023d6:	c9                   	leave
+  8023d7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023d8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023dd:	eb f3                	jmp    8023d2 <receive_snapshot+0x37>
+
+00000000008023df <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8023df:	55                   	push   %rbp
+  8023e0:	48 89 e5             	mov    %rsp,%rbp
+  8023e3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023e7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023eb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023f0:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 17                	js     802417 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802404:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  80240b:	48 85 d2             	test   %rdx,%rdx
+  80240e:	74 09                	je     802419 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802410:	b8 00 00 00 00       	mov    $0x0,%eax
+  802415:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+        return -E_NOT_SUPP;
+  802419:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80241e:	eb f7                	jmp    802417 <free_space_bytes+0x38>
+
+0000000000802420 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802420:	55                   	push   %rbp
+  802421:	48 89 e5             	mov    %rsp,%rbp
+  802424:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802428:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80242c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802431:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+  80243d:	85 c0                	test   %eax,%eax
+  80243f:	78 17                	js     802458 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802441:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802445:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80244c:	48 85 d2             	test   %rdx,%rdx
+  80244f:	74 09                	je     80245a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802451:	b8 00 00 00 00       	mov    $0x0,%eax
+  802456:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+        return -E_NOT_SUPP;
+  80245a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80245f:	eb f7                	jmp    802458 <busy_space_bytes+0x38>
+
+0000000000802461 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802461:	55                   	push   %rbp
+  802462:	48 89 e5             	mov    %rsp,%rbp
+  802465:	41 54                	push   %r12
+  802467:	53                   	push   %rbx
+  802468:	48 83 ec 10          	sub    $0x10,%rsp
+  80246c:	89 fb                	mov    %edi,%ebx
+  80246e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802471:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802475:	bf 66 00 00 00       	mov    $0x66,%edi
+  80247a:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+  802486:	85 c0                	test   %eax,%eax
+  802488:	78 17                	js     8024a1 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80248a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80248e:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802495:	48 85 c0             	test   %rax,%rax
+  802498:	74 10                	je     8024aa <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80249a:	4c 89 e6             	mov    %r12,%rsi
+  80249d:	89 df                	mov    %ebx,%edi
+  80249f:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8024a1:	48 83 c4 10          	add    $0x10,%rsp
+  8024a5:	5b                   	pop    %rbx
+  8024a6:	41 5c                	pop    %r12
+  8024a8:	5d                   	pop    %rbp
+  8024a9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024af:	eb f0                	jmp    8024a1 <snapshots_space+0x40>
+
+00000000008024b1 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	41 55                	push   %r13
+  8024b7:	41 54                	push   %r12
+  8024b9:	53                   	push   %rbx
+  8024ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8024be:	41 89 fd             	mov    %edi,%r13d
+  8024c1:	48 89 f3             	mov    %rsi,%rbx
+  8024c4:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024c7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024ce:	00 00 00 
+  8024d1:	83 38 00             	cmpl   $0x0,(%rax)
+  8024d4:	74 57                	je     80252d <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024d6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024e1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024e8:	00 00 00 
+  8024eb:	44 89 ee             	mov    %r13d,%esi
+  8024ee:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024f5:	00 00 00 
+  8024f8:	8b 38                	mov    (%rax),%edi
+  8024fa:	48 b8 2e 39 80 00 00 	movabs $0x80392e,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802506:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250b:	4c 89 e2             	mov    %r12,%rdx
+  80250e:	48 89 de             	mov    %rbx,%rsi
+  802511:	bf 00 00 00 00       	mov    $0x0,%edi
+  802516:	48 b8 16 39 80 00 00 	movabs $0x803916,%rax
+  80251d:	00 00 00 
+  802520:	ff d0                	call   *%rax
+}
+  802522:	48 83 c4 08          	add    $0x8,%rsp
+  802526:	5b                   	pop    %rbx
+  802527:	41 5c                	pop    %r12
+  802529:	41 5d                	pop    %r13
+  80252b:	5d                   	pop    %rbp
+  80252c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80252d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802532:	48 b8 ec 39 80 00 00 	movabs $0x8039ec,%rax
+  802539:	00 00 00 
+  80253c:	ff d0                	call   *%rax
+  80253e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802545:	00 00 
+  802547:	eb 8d                	jmp    8024d6 <fsipc_region+0x25>
+
+0000000000802549 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802549:	55                   	push   %rbp
+  80254a:	48 89 e5             	mov    %rsp,%rbp
+  80254d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802551:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802558:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802559:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80255d:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802564:	00 00 00 
+  802567:	ff d0                	call   *%rax
+}
+  802569:	c9                   	leave
+  80256a:	c3                   	ret
+
+000000000080256b <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80256b:	85 ff                	test   %edi,%edi
+  80256d:	78 6d                	js     8025dc <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80256f:	55                   	push   %rbp
+  802570:	48 89 e5             	mov    %rsp,%rbp
+  802573:	41 54                	push   %r12
+  802575:	53                   	push   %rbx
+  802576:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802579:	48 85 f6             	test   %rsi,%rsi
+  80257c:	74 57                	je     8025d5 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80257e:	89 f8                	mov    %edi,%eax
+  802580:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802587:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802589:	be 00 00 00 00       	mov    $0x0,%esi
+  80258e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802593:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  80259a:	00 00 00 
+  80259d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80259f:	85 c0                	test   %eax,%eax
+  8025a1:	78 2d                	js     8025d0 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8025a3:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8025aa:	00 00 00 
+  8025ad:	49 63 14 24          	movslq (%r12),%rdx
+  8025b1:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8025b8:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8025bd:	48 89 df             	mov    %rbx,%rdi
+  8025c0:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8025cc:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8025d0:	5b                   	pop    %rbx
+  8025d1:	41 5c                	pop    %r12
+  8025d3:	5d                   	pop    %rbp
+  8025d4:	c3                   	ret
+        return -E_INVAL;
+  8025d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025da:	eb f4                	jmp    8025d0 <devfile_df_snapshots+0x65>
+  8025dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025e1:	c3                   	ret
+
+00000000008025e2 <devfile_df_busy>:
+devfile_df_busy() {
+  8025e2:	55                   	push   %rbp
+  8025e3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025eb:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025f0:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8025f7:	00 00 00 
+  8025fa:	ff d0                	call   *%rax
+}
+  8025fc:	5d                   	pop    %rbp
+  8025fd:	c3                   	ret
+
+00000000008025fe <devfile_df_free>:
+devfile_df_free() {
+  8025fe:	55                   	push   %rbp
+  8025ff:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802602:	be 00 00 00 00       	mov    $0x0,%esi
+  802607:	bf 10 00 00 00       	mov    $0x10,%edi
+  80260c:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+}
+  802618:	5d                   	pop    %rbp
+  802619:	c3                   	ret
+
+000000000080261a <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80261e:	be 00 00 00 00       	mov    $0x0,%esi
+  802623:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802628:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  80262f:	00 00 00 
+  802632:	ff d0                	call   *%rax
+}
+  802634:	5d                   	pop    %rbp
+  802635:	c3                   	ret
+
+0000000000802636 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802636:	55                   	push   %rbp
+  802637:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80263a:	be 00 00 00 00       	mov    $0x0,%esi
+  80263f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802644:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  80264b:	00 00 00 
+  80264e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802650:	85 c0                	test   %eax,%eax
+  802652:	ba 00 00 00 00       	mov    $0x0,%edx
+  802657:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80265a:	5d                   	pop    %rbp
+  80265b:	c3                   	ret
+
+000000000080265c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80265c:	55                   	push   %rbp
+  80265d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802660:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802667:	00 00 00 
+  80266a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80266d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80266f:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802672:	be 00 00 00 00       	mov    $0x0,%esi
+  802677:	bf 02 00 00 00       	mov    $0x2,%edi
+  80267c:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802683:	00 00 00 
+  802686:	ff d0                	call   *%rax
+}
+  802688:	5d                   	pop    %rbp
+  802689:	c3                   	ret
+
+000000000080268a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80268a:	55                   	push   %rbp
+  80268b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80268e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802691:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802698:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80269a:	be 00 00 00 00       	mov    $0x0,%esi
+  80269f:	bf 06 00 00 00       	mov    $0x6,%edi
+  8026a4:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+}
+  8026b0:	5d                   	pop    %rbp
+  8026b1:	c3                   	ret
+
+00000000008026b2 <devfile_write>:
+    if (!fd || !buf) {
+  8026b2:	48 85 ff             	test   %rdi,%rdi
+  8026b5:	0f 84 c1 00 00 00    	je     80277c <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026bb:	55                   	push   %rbp
+  8026bc:	48 89 e5             	mov    %rsp,%rbp
+  8026bf:	41 57                	push   %r15
+  8026c1:	41 56                	push   %r14
+  8026c3:	41 55                	push   %r13
+  8026c5:	41 54                	push   %r12
+  8026c7:	53                   	push   %rbx
+  8026c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8026cc:	49 89 ff             	mov    %rdi,%r15
+  8026cf:	49 89 f5             	mov    %rsi,%r13
+  8026d2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026d5:	48 85 f6             	test   %rsi,%rsi
+  8026d8:	0f 84 95 00 00 00    	je     802773 <devfile_write+0xc1>
+    while (n) {
+  8026de:	48 85 d2             	test   %rdx,%rdx
+  8026e1:	0f 84 83 00 00 00    	je     80276a <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026e7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026ee:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026f5:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026f8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026fd:	49 39 dc             	cmp    %rbx,%r12
+  802700:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802704:	48 89 da             	mov    %rbx,%rdx
+  802707:	4c 89 ee             	mov    %r13,%rsi
+  80270a:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802711:	00 00 00 
+  802714:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  80271b:	00 00 00 
+  80271e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802720:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802724:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802727:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80272b:	be 00 00 00 00       	mov    $0x0,%esi
+  802730:	bf 04 00 00 00       	mov    $0x4,%edi
+  802735:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  80273c:	00 00 00 
+  80273f:	ff d0                	call   *%rax
+        if (write < 0) {
+  802741:	85 c0                	test   %eax,%eax
+  802743:	78 21                	js     802766 <devfile_write+0xb4>
+        buf += write;
+  802745:	48 63 d0             	movslq %eax,%rdx
+  802748:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80274b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80274e:	49 29 d4             	sub    %rdx,%r12
+  802751:	75 a5                	jne    8026f8 <devfile_write+0x46>
+    return totalWrite;
+  802753:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802757:	48 83 c4 18          	add    $0x18,%rsp
+  80275b:	5b                   	pop    %rbx
+  80275c:	41 5c                	pop    %r12
+  80275e:	41 5d                	pop    %r13
+  802760:	41 5e                	pop    %r14
+  802762:	41 5f                	pop    %r15
+  802764:	5d                   	pop    %rbp
+  802765:	c3                   	ret
+            return write;
+  802766:	48 98                	cltq
+  802768:	eb ed                	jmp    802757 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80276a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802771:	eb e0                	jmp    802753 <devfile_write+0xa1>
+        return -E_INVAL;
+  802773:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80277a:	eb db                	jmp    802757 <devfile_write+0xa5>
+  80277c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802783:	c3                   	ret
+
+0000000000802784 <devfile_read>:
+    if (!fd || !buf) {
+  802784:	48 85 ff             	test   %rdi,%rdi
+  802787:	0f 84 c0 00 00 00    	je     80284d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80278d:	55                   	push   %rbp
+  80278e:	48 89 e5             	mov    %rsp,%rbp
+  802791:	41 57                	push   %r15
+  802793:	41 56                	push   %r14
+  802795:	41 55                	push   %r13
+  802797:	41 54                	push   %r12
+  802799:	53                   	push   %rbx
+  80279a:	48 83 ec 18          	sub    $0x18,%rsp
+  80279e:	49 89 ff             	mov    %rdi,%r15
+  8027a1:	49 89 f5             	mov    %rsi,%r13
+  8027a4:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8027a7:	48 85 f6             	test   %rsi,%rsi
+  8027aa:	0f 84 96 00 00 00    	je     802846 <devfile_read+0xc2>
+    while (n) {
+  8027b0:	48 85 d2             	test   %rdx,%rdx
+  8027b3:	0f 84 87 00 00 00    	je     802840 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8027b9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027c0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027c1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027c8:	00 00 00 
+  8027cb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027cf:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8027d2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027d7:	49 39 c4             	cmp    %rax,%r12
+  8027da:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8027de:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8027e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027ec:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	7e 37                	jle    802833 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8027fc:	48 63 d8             	movslq %eax,%rbx
+  8027ff:	48 89 da             	mov    %rbx,%rdx
+  802802:	4c 89 f6             	mov    %r14,%rsi
+  802805:	4c 89 ef             	mov    %r13,%rdi
+  802808:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+        buf += read;
+  802814:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802817:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80281b:	49 29 dc             	sub    %rbx,%r12
+  80281e:	75 ab                	jne    8027cb <devfile_read+0x47>
+  return totalRead;
+  802820:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802824:	48 83 c4 18          	add    $0x18,%rsp
+  802828:	5b                   	pop    %rbx
+  802829:	41 5c                	pop    %r12
+  80282b:	41 5d                	pop    %r13
+  80282d:	41 5e                	pop    %r14
+  80282f:	41 5f                	pop    %r15
+  802831:	5d                   	pop    %rbp
+  802832:	c3                   	ret
+            return read ? read : totalRead;
+  802833:	48 63 d0             	movslq %eax,%rdx
+  802836:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80283a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80283e:	eb e4                	jmp    802824 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802840:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802844:	eb da                	jmp    802820 <devfile_read+0x9c>
+        return E_INVAL;
+  802846:	b8 03 00 00 00       	mov    $0x3,%eax
+  80284b:	eb d7                	jmp    802824 <devfile_read+0xa0>
+  80284d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802852:	c3                   	ret
+
+0000000000802853 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802853:	48 85 ff             	test   %rdi,%rdi
+  802856:	74 5f                	je     8028b7 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802858:	55                   	push   %rbp
+  802859:	48 89 e5             	mov    %rsp,%rbp
+  80285c:	53                   	push   %rbx
+  80285d:	48 83 ec 08          	sub    $0x8,%rsp
+  802861:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802864:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802876:	77 45                	ja     8028bd <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802878:	48 89 de             	mov    %rbx,%rsi
+  80287b:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802882:	00 00 00 
+  802885:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802891:	be 00 00 00 00       	mov    $0x0,%esi
+  802896:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80289b:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8028a2:	00 00 00 
+  8028a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ae:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b5:	c9                   	leave
+  8028b6:	c3                   	ret
+        return -E_INVAL;
+  8028b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028bc:	c3                   	ret
+        return -E_INVAL;
+  8028bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c2:	eb ed                	jmp    8028b1 <devfile_receive_snapshot+0x5e>
+
+00000000008028c4 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 55                	push   %r13
+  8028ca:	41 54                	push   %r12
+  8028cc:	53                   	push   %rbx
+  8028cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d1:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8028d4:	48 85 f6             	test   %rsi,%rsi
+  8028d7:	0f 94 c0             	sete   %al
+  8028da:	48 85 d2             	test   %rdx,%rdx
+  8028dd:	0f 94 c2             	sete   %dl
+  8028e0:	08 d0                	or     %dl,%al
+  8028e2:	0f 85 ad 00 00 00    	jne    802995 <devfile_send_snapshot+0xd1>
+  8028e8:	48 89 fb             	mov    %rdi,%rbx
+  8028eb:	49 89 f4             	mov    %rsi,%r12
+  8028ee:	48 85 ff             	test   %rdi,%rdi
+  8028f1:	0f 84 9e 00 00 00    	je     802995 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8028f7:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  8028fe:	00 00 00 
+  802901:	ff d0                	call   *%rax
+  802903:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802909:	0f 87 8d 00 00 00    	ja     80299c <devfile_send_snapshot+0xd8>
+  80290f:	4c 89 e7             	mov    %r12,%rdi
+  802912:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+  80291e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802924:	77 7d                	ja     8029a3 <devfile_send_snapshot+0xdf>
+  802926:	4c 89 ef             	mov    %r13,%rdi
+  802929:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+  802935:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80293b:	77 6d                	ja     8029aa <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80293d:	48 89 de             	mov    %rbx,%rsi
+  802940:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802947:	00 00 00 
+  80294a:	48 bb 75 0c 80 00 00 	movabs $0x800c75,%rbx
+  802951:	00 00 00 
+  802954:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802956:	4c 89 e6             	mov    %r12,%rsi
+  802959:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802960:	00 00 00 
+  802963:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802965:	4c 89 ee             	mov    %r13,%rsi
+  802968:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80296f:	00 00 00 
+  802972:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802974:	be 00 00 00 00       	mov    $0x0,%esi
+  802979:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80297e:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+}
+  80298a:	48 83 c4 08          	add    $0x8,%rsp
+  80298e:	5b                   	pop    %rbx
+  80298f:	41 5c                	pop    %r12
+  802991:	41 5d                	pop    %r13
+  802993:	5d                   	pop    %rbp
+  802994:	c3                   	ret
+        return -E_INVAL;
+  802995:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299a:	eb ee                	jmp    80298a <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80299c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a1:	eb e7                	jmp    80298a <devfile_send_snapshot+0xc6>
+  8029a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a8:	eb e0                	jmp    80298a <devfile_send_snapshot+0xc6>
+  8029aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029af:	eb d9                	jmp    80298a <devfile_send_snapshot+0xc6>
+
+00000000008029b1 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8029b1:	48 85 ff             	test   %rdi,%rdi
+  8029b4:	0f 84 41 01 00 00    	je     802afb <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8029ba:	55                   	push   %rbp
+  8029bb:	48 89 e5             	mov    %rsp,%rbp
+  8029be:	41 57                	push   %r15
+  8029c0:	41 56                	push   %r14
+  8029c2:	41 55                	push   %r13
+  8029c4:	41 54                	push   %r12
+  8029c6:	53                   	push   %rbx
+  8029c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029cb:	49 89 fc             	mov    %rdi,%r12
+  8029ce:	49 89 f5             	mov    %rsi,%r13
+  8029d1:	48 89 d3             	mov    %rdx,%rbx
+  8029d4:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8029d7:	48 85 f6             	test   %rsi,%rsi
+  8029da:	0f 84 ff 00 00 00    	je     802adf <devfile_diff_snapshots+0x12e>
+  8029e0:	48 85 d2             	test   %rdx,%rdx
+  8029e3:	0f 84 fd 00 00 00    	je     802ae6 <devfile_diff_snapshots+0x135>
+  8029e9:	48 85 c9             	test   %rcx,%rcx
+  8029ec:	0f 84 f4 00 00 00    	je     802ae6 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8029f2:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+  8029fe:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a04:	0f 87 e3 00 00 00    	ja     802aed <devfile_diff_snapshots+0x13c>
+  802a0a:	4c 89 ef             	mov    %r13,%rdi
+  802a0d:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+  802a19:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a1f:	0f 87 cf 00 00 00    	ja     802af4 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a25:	4c 89 e6             	mov    %r12,%rsi
+  802a28:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a2f:	00 00 00 
+  802a32:	4c 89 e7             	mov    %r12,%rdi
+  802a35:	49 bf 75 0c 80 00 00 	movabs $0x800c75,%r15
+  802a3c:	00 00 00 
+  802a3f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802a42:	4c 89 ee             	mov    %r13,%rsi
+  802a45:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a4c:	00 
+  802a4d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a50:	48 8b 03             	mov    (%rbx),%rax
+  802a53:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a5a:	00 
+  802a5b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a5f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a66:	00 
+  802a67:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a6b:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a72:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a73:	be 00 00 00 00       	mov    $0x0,%esi
+  802a78:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a7d:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	78 43                	js     802ad0 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a8d:	49 8b 04 24          	mov    (%r12),%rax
+  802a91:	48 89 03             	mov    %rax,(%rbx)
+  802a94:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a99:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a9d:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802aa2:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802aa6:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802aab:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802aaf:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802ab3:	48 c1 e2 03          	shl    $0x3,%rdx
+  802ab7:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802abc:	4c 89 f7             	mov    %r14,%rdi
+  802abf:	48 b8 6f 0e 80 00 00 	movabs $0x800e6f,%rax
+  802ac6:	00 00 00 
+  802ac9:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802acb:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802ad0:	48 83 c4 08          	add    $0x8,%rsp
+  802ad4:	5b                   	pop    %rbx
+  802ad5:	41 5c                	pop    %r12
+  802ad7:	41 5d                	pop    %r13
+  802ad9:	41 5e                	pop    %r14
+  802adb:	41 5f                	pop    %r15
+  802add:	5d                   	pop    %rbp
+  802ade:	c3                   	ret
+        return -E_INVAL;
+  802adf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae4:	eb ea                	jmp    802ad0 <devfile_diff_snapshots+0x11f>
+  802ae6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aeb:	eb e3                	jmp    802ad0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802aed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af2:	eb dc                	jmp    802ad0 <devfile_diff_snapshots+0x11f>
+  802af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af9:	eb d5                	jmp    802ad0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b00:	c3                   	ret
+
+0000000000802b01 <devfile_delete_snapshot>:
+    if (!name) {
+  802b01:	48 85 ff             	test   %rdi,%rdi
+  802b04:	74 5f                	je     802b65 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0f:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b12:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b24:	77 45                	ja     802b6b <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b26:	48 89 de             	mov    %rbx,%rsi
+  802b29:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b30:	00 00 00 
+  802b33:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802b3f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b44:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b49:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b5c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+        return -E_INVAL;
+  802b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b6a:	c3                   	ret
+        return -E_INVAL;
+  802b6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b70:	eb ed                	jmp    802b5f <devfile_delete_snapshot+0x5e>
+
+0000000000802b72 <devfile_accept_snapshot>:
+    if (!name) {
+  802b72:	48 85 ff             	test   %rdi,%rdi
+  802b75:	74 5f                	je     802bd6 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b77:	55                   	push   %rbp
+  802b78:	48 89 e5             	mov    %rsp,%rbp
+  802b7b:	53                   	push   %rbx
+  802b7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b80:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b83:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+  802b8f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b95:	77 45                	ja     802bdc <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b97:	48 89 de             	mov    %rbx,%rsi
+  802b9a:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ba1:	00 00 00 
+  802ba4:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802bb0:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bba:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802bc1:	00 00 00 
+  802bc4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bc6:	85 c0                	test   %eax,%eax
+  802bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bcd:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bd4:	c9                   	leave
+  802bd5:	c3                   	ret
+        return -E_INVAL;
+  802bd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bdb:	c3                   	ret
+        return -E_INVAL;
+  802bdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be1:	eb ed                	jmp    802bd0 <devfile_accept_snapshot+0x5e>
+
+0000000000802be3 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802be3:	48 85 ff             	test   %rdi,%rdi
+  802be6:	0f 84 9f 00 00 00    	je     802c8b <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802bec:	55                   	push   %rbp
+  802bed:	48 89 e5             	mov    %rsp,%rbp
+  802bf0:	41 54                	push   %r12
+  802bf2:	53                   	push   %rbx
+  802bf3:	48 89 fb             	mov    %rdi,%rbx
+  802bf6:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802bf9:	48 85 f6             	test   %rsi,%rsi
+  802bfc:	74 78                	je     802c76 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802bfe:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+  802c0a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c10:	77 6b                	ja     802c7d <devfile_create_snapshot+0x9a>
+  802c12:	4c 89 e7             	mov    %r12,%rdi
+  802c15:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+  802c21:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c27:	77 5b                	ja     802c84 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c29:	48 89 de             	mov    %rbx,%rsi
+  802c2c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c33:	00 00 00 
+  802c36:	48 bb 75 0c 80 00 00 	movabs $0x800c75,%rbx
+  802c3d:	00 00 00 
+  802c40:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802c42:	4c 89 e6             	mov    %r12,%rsi
+  802c45:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802c4c:	00 00 00 
+  802c4f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c51:	be 00 00 00 00       	mov    $0x0,%esi
+  802c56:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c5b:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c71:	5b                   	pop    %rbx
+  802c72:	41 5c                	pop    %r12
+  802c74:	5d                   	pop    %rbp
+  802c75:	c3                   	ret
+        return -E_INVAL;
+  802c76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c7b:	eb f4                	jmp    802c71 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c82:	eb ed                	jmp    802c71 <devfile_create_snapshot+0x8e>
+  802c84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c89:	eb e6                	jmp    802c71 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c90:	c3                   	ret
+
+0000000000802c91 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c91:	55                   	push   %rbp
+  802c92:	48 89 e5             	mov    %rsp,%rbp
+  802c95:	41 54                	push   %r12
+  802c97:	53                   	push   %rbx
+  802c98:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c9b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c9e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802ca5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802ca7:	be 00 00 00 00       	mov    $0x0,%esi
+  802cac:	bf 05 00 00 00       	mov    $0x5,%edi
+  802cb1:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	78 3d                	js     802cfe <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802cc1:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802cc8:	00 00 00 
+  802ccb:	4c 89 e6             	mov    %r12,%rsi
+  802cce:	48 89 df             	mov    %rbx,%rdi
+  802cd1:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  802cd8:	00 00 00 
+  802cdb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802cdd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ce4:	00 
+  802ce5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ceb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802cf2:	00 
+  802cf3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cfe:	5b                   	pop    %rbx
+  802cff:	41 5c                	pop    %r12
+  802d01:	5d                   	pop    %rbp
+  802d02:	c3                   	ret
+
+0000000000802d03 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	41 57                	push   %r15
+  802d09:	41 56                	push   %r14
+  802d0b:	41 55                	push   %r13
+  802d0d:	41 54                	push   %r12
+  802d0f:	53                   	push   %rbx
+  802d10:	48 83 ec 38          	sub    $0x38,%rsp
+  802d14:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802d18:	49 89 f5             	mov    %rsi,%r13
+  802d1b:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d1e:	48 89 f0             	mov    %rsi,%rax
+  802d21:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d26:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d2a:	75 4f                	jne    802d7b <devfile_readmap+0x78>
+  802d2c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d30:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d36:	75 1f                	jne    802d57 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802d38:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d3c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d40:	49 be eb 34 80 00 00 	movabs $0x8034eb,%r14
+  802d47:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d4a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d51:	0f 87 9d 00 00 00    	ja     802df4 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d57:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d5b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d5f:	4d 85 ff             	test   %r15,%r15
+  802d62:	0f 85 cf 00 00 00    	jne    802e37 <devfile_readmap+0x134>
+  802d68:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d6c:	48 83 c4 38          	add    $0x38,%rsp
+  802d70:	5b                   	pop    %rbx
+  802d71:	41 5c                	pop    %r12
+  802d73:	41 5d                	pop    %r13
+  802d75:	41 5e                	pop    %r14
+  802d77:	41 5f                	pop    %r15
+  802d79:	5d                   	pop    %rbp
+  802d7a:	c3                   	ret
+    size_t totalRead = 0;
+  802d7b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d82:	00 
+  802d83:	eb da                	jmp    802d5f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d85:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d89:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d8c:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d93:	00 00 00 
+  802d96:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d9c:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802da0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802da4:	4c 89 ee             	mov    %r13,%rsi
+  802da7:	bf 14 00 00 00       	mov    $0x14,%edi
+  802dac:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	7e a3                	jle    802d5f <devfile_readmap+0x5c>
+  802dbc:	48 98                	cltq
+  802dbe:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802dc2:	72 9b                	jb     802d5f <devfile_readmap+0x5c>
+        buf += read;
+  802dc4:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802dc7:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802dca:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dce:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802dd5:	75 88                	jne    802d5f <devfile_readmap+0x5c>
+  802dd7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ddb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802de1:	0f 85 78 ff ff ff    	jne    802d5f <devfile_readmap+0x5c>
+  802de7:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802dee:	0f 86 6b ff ff ff    	jbe    802d5f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802df4:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802dfa:	4d 39 e7             	cmp    %r12,%r15
+  802dfd:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802e01:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802e08:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e0c:	0f 84 73 ff ff ff    	je     802d85 <devfile_readmap+0x82>
+  802e12:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e16:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802e1b:	41 ff d6             	call   *%r14
+  802e1e:	a8 40                	test   $0x40,%al
+  802e20:	0f 85 39 ff ff ff    	jne    802d5f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e26:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e2d:	4c 39 e3             	cmp    %r12,%rbx
+  802e30:	72 e4                	jb     802e16 <devfile_readmap+0x113>
+  802e32:	e9 4e ff ff ff       	jmp    802d85 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802e37:	4c 89 fa             	mov    %r15,%rdx
+  802e3a:	4c 89 ee             	mov    %r13,%rsi
+  802e3d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e41:	48 b8 84 27 80 00 00 	movabs $0x802784,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e4d:	48 85 c0             	test   %rax,%rax
+  802e50:	78 0c                	js     802e5e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e52:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e56:	48 01 f0             	add    %rsi,%rax
+  802e59:	e9 0e ff ff ff       	jmp    802d6c <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e5e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e62:	48 85 f6             	test   %rsi,%rsi
+  802e65:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e69:	e9 fe fe ff ff       	jmp    802d6c <devfile_readmap+0x69>
+
+0000000000802e6e <open>:
+open(const char *path, int mode) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	41 55                	push   %r13
+  802e74:	41 54                	push   %r12
+  802e76:	53                   	push   %rbx
+  802e77:	48 83 ec 18          	sub    $0x18,%rsp
+  802e7b:	49 89 fc             	mov    %rdi,%r12
+  802e7e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e81:	48 b8 37 0c 80 00 00 	movabs $0x800c37,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+  802e8d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e93:	0f 87 8a 00 00 00    	ja     802f23 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e99:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e9d:	48 b8 cc 19 80 00 00 	movabs $0x8019cc,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+  802ea9:	89 c3                	mov    %eax,%ebx
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	78 50                	js     802eff <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802eaf:	4c 89 e6             	mov    %r12,%rsi
+  802eb2:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802eb9:	00 00 00 
+  802ebc:	48 89 df             	mov    %rbx,%rdi
+  802ebf:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ecb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ed2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ed6:	bf 01 00 00 00       	mov    $0x1,%edi
+  802edb:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802ee2:	00 00 00 
+  802ee5:	ff d0                	call   *%rax
+  802ee7:	89 c3                	mov    %eax,%ebx
+  802ee9:	85 c0                	test   %eax,%eax
+  802eeb:	78 1f                	js     802f0c <open+0x9e>
+    return fd2num(fd);
+  802eed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef1:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802ef8:	00 00 00 
+  802efb:	ff d0                	call   *%rax
+  802efd:	89 c3                	mov    %eax,%ebx
+}
+  802eff:	89 d8                	mov    %ebx,%eax
+  802f01:	48 83 c4 18          	add    $0x18,%rsp
+  802f05:	5b                   	pop    %rbx
+  802f06:	41 5c                	pop    %r12
+  802f08:	41 5d                	pop    %r13
+  802f0a:	5d                   	pop    %rbp
+  802f0b:	c3                   	ret
+        fd_close(fd, 0);
+  802f0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f11:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f15:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  802f1c:	00 00 00 
+  802f1f:	ff d0                	call   *%rax
+        return res;
+  802f21:	eb dc                	jmp    802eff <open+0x91>
+        return -E_BAD_PATH;
+  802f23:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f28:	eb d5                	jmp    802eff <open+0x91>
+
+0000000000802f2a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f33:	bf 13 00 00 00       	mov    $0x13,%edi
+  802f38:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802f3f:	00 00 00 
+  802f42:	ff d0                	call   *%rax
+}
+  802f44:	5d                   	pop    %rbp
+  802f45:	c3                   	ret
+
+0000000000802f46 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f46:	55                   	push   %rbp
+  802f47:	48 89 e5             	mov    %rsp,%rbp
+  802f4a:	41 54                	push   %r12
+  802f4c:	53                   	push   %rbx
+  802f4d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f50:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+  802f5c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f5f:	48 be a0 41 80 00 00 	movabs $0x8041a0,%rsi
+  802f66:	00 00 00 
+  802f69:	48 89 df             	mov    %rbx,%rdi
+  802f6c:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f78:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f7d:	41 2b 04 24          	sub    (%r12),%eax
+  802f81:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f87:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f8e:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f91:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f98:	00 00 00 
+  802f9b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa7:	5b                   	pop    %rbx
+  802fa8:	41 5c                	pop    %r12
+  802faa:	5d                   	pop    %rbp
+  802fab:	c3                   	ret
+
+0000000000802fac <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802fac:	55                   	push   %rbp
+  802fad:	48 89 e5             	mov    %rsp,%rbp
+  802fb0:	41 54                	push   %r12
+  802fb2:	53                   	push   %rbx
+  802fb3:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fbb:	48 89 fe             	mov    %rdi,%rsi
+  802fbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc3:	49 bc cd 13 80 00 00 	movabs $0x8013cd,%r12
+  802fca:	00 00 00 
+  802fcd:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fd0:	48 89 df             	mov    %rbx,%rdi
+  802fd3:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  802fda:	00 00 00 
+  802fdd:	ff d0                	call   *%rax
+  802fdf:	48 89 c6             	mov    %rax,%rsi
+  802fe2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fec:	41 ff d4             	call   *%r12
+}
+  802fef:	5b                   	pop    %rbx
+  802ff0:	41 5c                	pop    %r12
+  802ff2:	5d                   	pop    %rbp
+  802ff3:	c3                   	ret
+
+0000000000802ff4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ff4:	55                   	push   %rbp
+  802ff5:	48 89 e5             	mov    %rsp,%rbp
+  802ff8:	41 57                	push   %r15
+  802ffa:	41 56                	push   %r14
+  802ffc:	41 55                	push   %r13
+  802ffe:	41 54                	push   %r12
+  803000:	53                   	push   %rbx
+  803001:	48 83 ec 18          	sub    $0x18,%rsp
+  803005:	49 89 fc             	mov    %rdi,%r12
+  803008:	49 89 f5             	mov    %rsi,%r13
+  80300b:	49 89 d7             	mov    %rdx,%r15
+  80300e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803012:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  803019:	00 00 00 
+  80301c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80301e:	4d 85 ff             	test   %r15,%r15
+  803021:	0f 84 af 00 00 00    	je     8030d6 <devpipe_write+0xe2>
+  803027:	48 89 c3             	mov    %rax,%rbx
+  80302a:	4c 89 f8             	mov    %r15,%rax
+  80302d:	4d 89 ef             	mov    %r13,%r15
+  803030:	4c 01 e8             	add    %r13,%rax
+  803033:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803037:	49 bd d5 12 80 00 00 	movabs $0x8012d5,%r13
+  80303e:	00 00 00 
+            sys_yield();
+  803041:	49 be 72 12 80 00 00 	movabs $0x801272,%r14
+  803048:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80304b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80304e:	48 63 ce             	movslq %esi,%rcx
+  803051:	48 63 03             	movslq (%rbx),%rax
+  803054:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80305a:	48 39 c1             	cmp    %rax,%rcx
+  80305d:	72 2e                	jb     80308d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80305f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803064:	48 89 da             	mov    %rbx,%rdx
+  803067:	be 00 10 00 00       	mov    $0x1000,%esi
+  80306c:	4c 89 e7             	mov    %r12,%rdi
+  80306f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803072:	85 c0                	test   %eax,%eax
+  803074:	74 66                	je     8030dc <devpipe_write+0xe8>
+            sys_yield();
+  803076:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803079:	8b 73 04             	mov    0x4(%rbx),%esi
+  80307c:	48 63 ce             	movslq %esi,%rcx
+  80307f:	48 63 03             	movslq (%rbx),%rax
+  803082:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803088:	48 39 c1             	cmp    %rax,%rcx
+  80308b:	73 d2                	jae    80305f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80308d:	41 0f b6 3f          	movzbl (%r15),%edi
+  803091:	48 89 ca             	mov    %rcx,%rdx
+  803094:	48 c1 ea 03          	shr    $0x3,%rdx
+  803098:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80309f:	08 10 20 
+  8030a2:	48 f7 e2             	mul    %rdx
+  8030a5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030a9:	48 89 d0             	mov    %rdx,%rax
+  8030ac:	48 c1 e0 09          	shl    $0x9,%rax
+  8030b0:	48 29 d0             	sub    %rdx,%rax
+  8030b3:	48 c1 e0 03          	shl    $0x3,%rax
+  8030b7:	48 29 c1             	sub    %rax,%rcx
+  8030ba:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030bf:	83 c6 01             	add    $0x1,%esi
+  8030c2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030c5:	49 83 c7 01          	add    $0x1,%r15
+  8030c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030cd:	49 39 c7             	cmp    %rax,%r15
+  8030d0:	0f 85 75 ff ff ff    	jne    80304b <devpipe_write+0x57>
+    return n;
+  8030d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030da:	eb 05                	jmp    8030e1 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030e1:	48 83 c4 18          	add    $0x18,%rsp
+  8030e5:	5b                   	pop    %rbx
+  8030e6:	41 5c                	pop    %r12
+  8030e8:	41 5d                	pop    %r13
+  8030ea:	41 5e                	pop    %r14
+  8030ec:	41 5f                	pop    %r15
+  8030ee:	5d                   	pop    %rbp
+  8030ef:	c3                   	ret
+
+00000000008030f0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030f0:	55                   	push   %rbp
+  8030f1:	48 89 e5             	mov    %rsp,%rbp
+  8030f4:	41 57                	push   %r15
+  8030f6:	41 56                	push   %r14
+  8030f8:	41 55                	push   %r13
+  8030fa:	41 54                	push   %r12
+  8030fc:	53                   	push   %rbx
+  8030fd:	48 83 ec 18          	sub    $0x18,%rsp
+  803101:	49 89 fc             	mov    %rdi,%r12
+  803104:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803108:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80310c:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80311b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803121:	49 bd d5 12 80 00 00 	movabs $0x8012d5,%r13
+  803128:	00 00 00 
+            sys_yield();
+  80312b:	49 be 72 12 80 00 00 	movabs $0x801272,%r14
+  803132:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803135:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80313a:	74 7d                	je     8031b9 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80313c:	8b 03                	mov    (%rbx),%eax
+  80313e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803141:	75 26                	jne    803169 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803143:	4d 85 ff             	test   %r15,%r15
+  803146:	75 77                	jne    8031bf <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803148:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80314d:	48 89 da             	mov    %rbx,%rdx
+  803150:	be 00 10 00 00       	mov    $0x1000,%esi
+  803155:	4c 89 e7             	mov    %r12,%rdi
+  803158:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	74 72                	je     8031d1 <devpipe_read+0xe1>
+            sys_yield();
+  80315f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803162:	8b 03                	mov    (%rbx),%eax
+  803164:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803167:	74 df                	je     803148 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803169:	48 63 c8             	movslq %eax,%rcx
+  80316c:	48 89 ca             	mov    %rcx,%rdx
+  80316f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803173:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80317a:	08 10 20 
+  80317d:	48 89 d0             	mov    %rdx,%rax
+  803180:	48 f7 e6             	mul    %rsi
+  803183:	48 c1 ea 06          	shr    $0x6,%rdx
+  803187:	48 89 d0             	mov    %rdx,%rax
+  80318a:	48 c1 e0 09          	shl    $0x9,%rax
+  80318e:	48 29 d0             	sub    %rdx,%rax
+  803191:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803198:	00 
+  803199:	48 89 c8             	mov    %rcx,%rax
+  80319c:	48 29 d0             	sub    %rdx,%rax
+  80319f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8031a4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8031a8:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8031ac:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8031af:	49 83 c7 01          	add    $0x1,%r15
+  8031b3:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8031b7:	75 83                	jne    80313c <devpipe_read+0x4c>
+    return n;
+  8031b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031bd:	eb 03                	jmp    8031c2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031bf:	4c 89 f8             	mov    %r15,%rax
+}
+  8031c2:	48 83 c4 18          	add    $0x18,%rsp
+  8031c6:	5b                   	pop    %rbx
+  8031c7:	41 5c                	pop    %r12
+  8031c9:	41 5d                	pop    %r13
+  8031cb:	41 5e                	pop    %r14
+  8031cd:	41 5f                	pop    %r15
+  8031cf:	5d                   	pop    %rbp
+  8031d0:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d6:	eb ea                	jmp    8031c2 <devpipe_read+0xd2>
+
+00000000008031d8 <pipe>:
+pipe(int pfd[2]) {
+  8031d8:	55                   	push   %rbp
+  8031d9:	48 89 e5             	mov    %rsp,%rbp
+  8031dc:	41 55                	push   %r13
+  8031de:	41 54                	push   %r12
+  8031e0:	53                   	push   %rbx
+  8031e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8031e5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031e8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031ec:	48 b8 cc 19 80 00 00 	movabs $0x8019cc,%rax
+  8031f3:	00 00 00 
+  8031f6:	ff d0                	call   *%rax
+  8031f8:	89 c3                	mov    %eax,%ebx
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	0f 88 a0 01 00 00    	js     8033a2 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803202:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803207:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80320c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803210:	bf 00 00 00 00       	mov    $0x0,%edi
+  803215:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  80321c:	00 00 00 
+  80321f:	ff d0                	call   *%rax
+  803221:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803223:	85 c0                	test   %eax,%eax
+  803225:	0f 88 77 01 00 00    	js     8033a2 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80322b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80322f:	48 b8 cc 19 80 00 00 	movabs $0x8019cc,%rax
+  803236:	00 00 00 
+  803239:	ff d0                	call   *%rax
+  80323b:	89 c3                	mov    %eax,%ebx
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	0f 88 43 01 00 00    	js     803388 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803245:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80324a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80324f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803253:	bf 00 00 00 00       	mov    $0x0,%edi
+  803258:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  80325f:	00 00 00 
+  803262:	ff d0                	call   *%rax
+  803264:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803266:	85 c0                	test   %eax,%eax
+  803268:	0f 88 1a 01 00 00    	js     803388 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80326e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803272:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803281:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803286:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80328b:	48 89 c6             	mov    %rax,%rsi
+  80328e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803293:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+  80329f:	89 c3                	mov    %eax,%ebx
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	0f 88 c5 00 00 00    	js     80336e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8032a9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032ad:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+  8032b9:	48 89 c1             	mov    %rax,%rcx
+  8032bc:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032c2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032cd:	4c 89 ee             	mov    %r13,%rsi
+  8032d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d5:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	89 c3                	mov    %eax,%ebx
+  8032e3:	85 c0                	test   %eax,%eax
+  8032e5:	78 6e                	js     803355 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032e7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032ec:	4c 89 ef             	mov    %r13,%rdi
+  8032ef:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	83 f8 02             	cmp    $0x2,%eax
+  8032fe:	0f 85 ab 00 00 00    	jne    8033af <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803304:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  80330b:	00 00 
+  80330d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803311:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803313:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803317:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80331e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803322:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803324:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803328:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80332f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803333:	48 bb 9e 19 80 00 00 	movabs $0x80199e,%rbx
+  80333a:	00 00 00 
+  80333d:	ff d3                	call   *%rbx
+  80333f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803343:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803347:	ff d3                	call   *%rbx
+  803349:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80334e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803353:	eb 4d                	jmp    8033a2 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803355:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80335a:	4c 89 ee             	mov    %r13,%rsi
+  80335d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803362:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  803369:	00 00 00 
+  80336c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80336e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803373:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337c:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  803383:	00 00 00 
+  803386:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803388:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80338d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803391:	bf 00 00 00 00       	mov    $0x0,%edi
+  803396:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  80339d:	00 00 00 
+  8033a0:	ff d0                	call   *%rax
+}
+  8033a2:	89 d8                	mov    %ebx,%eax
+  8033a4:	48 83 c4 18          	add    $0x18,%rsp
+  8033a8:	5b                   	pop    %rbx
+  8033a9:	41 5c                	pop    %r12
+  8033ab:	41 5d                	pop    %r13
+  8033ad:	5d                   	pop    %rbp
+  8033ae:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8033af:	48 b9 b8 41 80 00 00 	movabs $0x8041b8,%rcx
+  8033b6:	00 00 00 
+  8033b9:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  8033c0:	00 00 00 
+  8033c3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033c8:	48 bf a7 41 80 00 00 	movabs $0x8041a7,%rdi
+  8033cf:	00 00 00 
+  8033d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d7:	49 b8 00 02 80 00 00 	movabs $0x800200,%r8
+  8033de:	00 00 00 
+  8033e1:	41 ff d0             	call   *%r8
+
+00000000008033e4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033e4:	55                   	push   %rbp
+  8033e5:	48 89 e5             	mov    %rsp,%rbp
+  8033e8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033f0:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	78 35                	js     803435 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803400:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803404:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+  803410:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803413:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803418:	be 00 10 00 00       	mov    $0x1000,%esi
+  80341d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803421:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  803428:	00 00 00 
+  80342b:	ff d0                	call   *%rax
+  80342d:	85 c0                	test   %eax,%eax
+  80342f:	0f 94 c0             	sete   %al
+  803432:	0f b6 c0             	movzbl %al,%eax
+}
+  803435:	c9                   	leave
+  803436:	c3                   	ret
+
+0000000000803437 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803437:	48 89 f8             	mov    %rdi,%rax
+  80343a:	48 c1 e8 27          	shr    $0x27,%rax
+  80343e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803445:	01 00 00 
+  803448:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80344c:	f6 c2 01             	test   $0x1,%dl
+  80344f:	74 6d                	je     8034be <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803451:	48 89 f8             	mov    %rdi,%rax
+  803454:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803458:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80345f:	01 00 00 
+  803462:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803466:	f6 c2 01             	test   $0x1,%dl
+  803469:	74 62                	je     8034cd <get_uvpt_entry+0x96>
+  80346b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803472:	01 00 00 
+  803475:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803479:	f6 c2 80             	test   $0x80,%dl
+  80347c:	75 4f                	jne    8034cd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80347e:	48 89 f8             	mov    %rdi,%rax
+  803481:	48 c1 e8 15          	shr    $0x15,%rax
+  803485:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80348c:	01 00 00 
+  80348f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803493:	f6 c2 01             	test   $0x1,%dl
+  803496:	74 44                	je     8034dc <get_uvpt_entry+0xa5>
+  803498:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80349f:	01 00 00 
+  8034a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034a6:	f6 c2 80             	test   $0x80,%dl
+  8034a9:	75 31                	jne    8034dc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8034ab:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8034af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034b6:	01 00 00 
+  8034b9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034bd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034be:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034c5:	01 00 00 
+  8034c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034cc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034cd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034d4:	01 00 00 
+  8034d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034db:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034dc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034e3:	01 00 00 
+  8034e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034ea:	c3                   	ret
+
+00000000008034eb <get_prot>:
+
+int
+get_prot(void *va) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034ef:	48 b8 37 34 80 00 00 	movabs $0x803437,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+  8034fb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034fe:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803503:	89 c1                	mov    %eax,%ecx
+  803505:	83 c9 04             	or     $0x4,%ecx
+  803508:	f6 c2 01             	test   $0x1,%dl
+  80350b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80350e:	89 c1                	mov    %eax,%ecx
+  803510:	83 c9 02             	or     $0x2,%ecx
+  803513:	f6 c2 02             	test   $0x2,%dl
+  803516:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803519:	89 c1                	mov    %eax,%ecx
+  80351b:	83 c9 01             	or     $0x1,%ecx
+  80351e:	48 85 d2             	test   %rdx,%rdx
+  803521:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803524:	89 c1                	mov    %eax,%ecx
+  803526:	83 c9 40             	or     $0x40,%ecx
+  803529:	f6 c6 04             	test   $0x4,%dh
+  80352c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80352f:	5d                   	pop    %rbp
+  803530:	c3                   	ret
+
+0000000000803531 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803531:	55                   	push   %rbp
+  803532:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803535:	48 b8 37 34 80 00 00 	movabs $0x803437,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803541:	48 c1 e8 06          	shr    $0x6,%rax
+  803545:	83 e0 01             	and    $0x1,%eax
+}
+  803548:	5d                   	pop    %rbp
+  803549:	c3                   	ret
+
+000000000080354a <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80354a:	55                   	push   %rbp
+  80354b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80354e:	48 b8 37 34 80 00 00 	movabs $0x803437,%rax
+  803555:	00 00 00 
+  803558:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80355a:	48 c1 e8 05          	shr    $0x5,%rax
+  80355e:	83 e0 01             	and    $0x1,%eax
+}
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+
+0000000000803563 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803567:	48 b8 37 34 80 00 00 	movabs $0x803437,%rax
+  80356e:	00 00 00 
+  803571:	ff d0                	call   *%rax
+  803573:	83 e0 01             	and    $0x1,%eax
+}
+  803576:	5d                   	pop    %rbp
+  803577:	c3                   	ret
+
+0000000000803578 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803578:	55                   	push   %rbp
+  803579:	48 89 e5             	mov    %rsp,%rbp
+  80357c:	41 57                	push   %r15
+  80357e:	41 56                	push   %r14
+  803580:	41 55                	push   %r13
+  803582:	41 54                	push   %r12
+  803584:	53                   	push   %rbx
+  803585:	48 83 ec 18          	sub    $0x18,%rsp
+  803589:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80358d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803591:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803596:	49 bd 63 35 80 00 00 	movabs $0x803563,%r13
+  80359d:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035a0:	49 bf eb 34 80 00 00 	movabs $0x8034eb,%r15
+  8035a7:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8035aa:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8035b1:	00 00 00 
+  8035b4:	eb 0c                	jmp    8035c2 <foreach_shared_region+0x4a>
+  8035b6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035bd:	4c 39 f3             	cmp    %r14,%rbx
+  8035c0:	74 2e                	je     8035f0 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035c2:	48 89 df             	mov    %rbx,%rdi
+  8035c5:	41 ff d5             	call   *%r13
+  8035c8:	84 c0                	test   %al,%al
+  8035ca:	74 ea                	je     8035b6 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035cc:	48 89 df             	mov    %rbx,%rdi
+  8035cf:	41 ff d7             	call   *%r15
+  8035d2:	a8 40                	test   $0x40,%al
+  8035d4:	74 e0                	je     8035b6 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035d6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035e1:	48 89 df             	mov    %rbx,%rdi
+  8035e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035e8:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	79 c8                	jns    8035b6 <foreach_shared_region+0x3e>
+  8035ee:	eb 05                	jmp    8035f5 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035f5:	48 83 c4 18          	add    $0x18,%rsp
+  8035f9:	5b                   	pop    %rbx
+  8035fa:	41 5c                	pop    %r12
+  8035fc:	41 5d                	pop    %r13
+  8035fe:	41 5e                	pop    %r14
+  803600:	41 5f                	pop    %r15
+  803602:	5d                   	pop    %rbp
+  803603:	c3                   	ret
+
+0000000000803604 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803604:	b8 00 00 00 00       	mov    $0x0,%eax
+  803609:	c3                   	ret
+
+000000000080360a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80360a:	55                   	push   %rbp
+  80360b:	48 89 e5             	mov    %rsp,%rbp
+  80360e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803611:	48 be dc 41 80 00 00 	movabs $0x8041dc,%rsi
+  803618:	00 00 00 
+  80361b:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+    return 0;
+}
+  803627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362c:	5d                   	pop    %rbp
+  80362d:	c3                   	ret
+
+000000000080362e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80362e:	55                   	push   %rbp
+  80362f:	48 89 e5             	mov    %rsp,%rbp
+  803632:	41 57                	push   %r15
+  803634:	41 56                	push   %r14
+  803636:	41 55                	push   %r13
+  803638:	41 54                	push   %r12
+  80363a:	53                   	push   %rbx
+  80363b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803642:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803649:	48 85 d2             	test   %rdx,%rdx
+  80364c:	74 7a                	je     8036c8 <devcons_write+0x9a>
+  80364e:	49 89 d6             	mov    %rdx,%r14
+  803651:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803657:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80365c:	49 bf 6f 0e 80 00 00 	movabs $0x800e6f,%r15
+  803663:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803666:	4c 89 f3             	mov    %r14,%rbx
+  803669:	48 29 f3             	sub    %rsi,%rbx
+  80366c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803671:	48 39 c3             	cmp    %rax,%rbx
+  803674:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803678:	4c 63 eb             	movslq %ebx,%r13
+  80367b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803682:	48 01 c6             	add    %rax,%rsi
+  803685:	4c 89 ea             	mov    %r13,%rdx
+  803688:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80368f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803692:	4c 89 ee             	mov    %r13,%rsi
+  803695:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80369c:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8036a8:	41 01 dc             	add    %ebx,%r12d
+  8036ab:	49 63 f4             	movslq %r12d,%rsi
+  8036ae:	4c 39 f6             	cmp    %r14,%rsi
+  8036b1:	72 b3                	jb     803666 <devcons_write+0x38>
+    return res;
+  8036b3:	49 63 c4             	movslq %r12d,%rax
+}
+  8036b6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8036bd:	5b                   	pop    %rbx
+  8036be:	41 5c                	pop    %r12
+  8036c0:	41 5d                	pop    %r13
+  8036c2:	41 5e                	pop    %r14
+  8036c4:	41 5f                	pop    %r15
+  8036c6:	5d                   	pop    %rbp
+  8036c7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036c8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036ce:	eb e3                	jmp    8036b3 <devcons_write+0x85>
+
+00000000008036d0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036d0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036d8:	48 85 c0             	test   %rax,%rax
+  8036db:	74 55                	je     803732 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036dd:	55                   	push   %rbp
+  8036de:	48 89 e5             	mov    %rsp,%rbp
+  8036e1:	41 55                	push   %r13
+  8036e3:	41 54                	push   %r12
+  8036e5:	53                   	push   %rbx
+  8036e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8036ea:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036ed:	48 bb a5 11 80 00 00 	movabs $0x8011a5,%rbx
+  8036f4:	00 00 00 
+  8036f7:	49 bc 72 12 80 00 00 	movabs $0x801272,%r12
+  8036fe:	00 00 00 
+  803701:	eb 03                	jmp    803706 <devcons_read+0x36>
+  803703:	41 ff d4             	call   *%r12
+  803706:	ff d3                	call   *%rbx
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	74 f7                	je     803703 <devcons_read+0x33>
+    if (c < 0) return c;
+  80370c:	48 63 d0             	movslq %eax,%rdx
+  80370f:	78 13                	js     803724 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803711:	ba 00 00 00 00       	mov    $0x0,%edx
+  803716:	83 f8 04             	cmp    $0x4,%eax
+  803719:	74 09                	je     803724 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80371b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80371f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803724:	48 89 d0             	mov    %rdx,%rax
+  803727:	48 83 c4 08          	add    $0x8,%rsp
+  80372b:	5b                   	pop    %rbx
+  80372c:	41 5c                	pop    %r12
+  80372e:	41 5d                	pop    %r13
+  803730:	5d                   	pop    %rbp
+  803731:	c3                   	ret
+  803732:	48 89 d0             	mov    %rdx,%rax
+  803735:	c3                   	ret
+
+0000000000803736 <cputchar>:
+cputchar(int ch) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80373e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803742:	be 01 00 00 00       	mov    $0x1,%esi
+  803747:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80374b:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+}
+  803757:	c9                   	leave
+  803758:	c3                   	ret
+
+0000000000803759 <getchar>:
+getchar(void) {
+  803759:	55                   	push   %rbp
+  80375a:	48 89 e5             	mov    %rsp,%rbp
+  80375d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803761:	ba 01 00 00 00       	mov    $0x1,%edx
+  803766:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80376a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376f:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  803776:	00 00 00 
+  803779:	ff d0                	call   *%rax
+  80377b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	78 06                	js     803787 <getchar+0x2e>
+  803781:	74 08                	je     80378b <getchar+0x32>
+  803783:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803787:	89 d0                	mov    %edx,%eax
+  803789:	c9                   	leave
+  80378a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80378b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803790:	eb f5                	jmp    803787 <getchar+0x2e>
+
+0000000000803792 <iscons>:
+iscons(int fdnum) {
+  803792:	55                   	push   %rbp
+  803793:	48 89 e5             	mov    %rsp,%rbp
+  803796:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80379a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80379e:	48 b8 2c 1a 80 00 00 	movabs $0x801a2c,%rax
+  8037a5:	00 00 00 
+  8037a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037aa:	85 c0                	test   %eax,%eax
+  8037ac:	78 18                	js     8037c6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8037ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037b2:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8037b9:	00 00 00 
+  8037bc:	8b 00                	mov    (%rax),%eax
+  8037be:	39 02                	cmp    %eax,(%rdx)
+  8037c0:	0f 94 c0             	sete   %al
+  8037c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8037c6:	c9                   	leave
+  8037c7:	c3                   	ret
+
+00000000008037c8 <opencons>:
+opencons(void) {
+  8037c8:	55                   	push   %rbp
+  8037c9:	48 89 e5             	mov    %rsp,%rbp
+  8037cc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037d0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037d4:	48 b8 cc 19 80 00 00 	movabs $0x8019cc,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+  8037e0:	85 c0                	test   %eax,%eax
+  8037e2:	78 49                	js     80382d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ee:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f7:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+  803803:	85 c0                	test   %eax,%eax
+  803805:	78 26                	js     80382d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803807:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80380b:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803812:	00 00 
+  803814:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803816:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80381a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803821:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+}
+  80382d:	c9                   	leave
+  80382e:	c3                   	ret
+
+000000000080382f <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80382f:	55                   	push   %rbp
+  803830:	48 89 e5             	mov    %rsp,%rbp
+  803833:	41 55                	push   %r13
+  803835:	41 54                	push   %r12
+  803837:	53                   	push   %rbx
+  803838:	48 83 ec 08          	sub    $0x8,%rsp
+  80383c:	49 89 fc             	mov    %rdi,%r12
+  80383f:	48 89 f7             	mov    %rsi,%rdi
+  803842:	48 89 d3             	mov    %rdx,%rbx
+  803845:	49 89 cd             	mov    %rcx,%r13
+  803848:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80384b:	48 85 f6             	test   %rsi,%rsi
+  80384e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803855:	00 00 00 
+  803858:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80385c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803861:	48 85 db             	test   %rbx,%rbx
+  803864:	74 03                	je     803869 <ipc_recv_timed+0x3a>
+  803866:	48 8b 33             	mov    (%rbx),%rsi
+  803869:	48 b8 9b 15 80 00 00 	movabs $0x80159b,%rax
+  803870:	00 00 00 
+  803873:	ff d0                	call   *%rax
+    if (res < 0) {
+  803875:	85 c0                	test   %eax,%eax
+  803877:	78 75                	js     8038ee <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803879:	4d 85 e4             	test   %r12,%r12
+  80387c:	74 14                	je     803892 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80387e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803885:	00 00 00 
+  803888:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80388e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803892:	4d 85 ed             	test   %r13,%r13
+  803895:	74 14                	je     8038ab <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803897:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80389e:	00 00 00 
+  8038a1:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8038a7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8038ab:	48 85 db             	test   %rbx,%rbx
+  8038ae:	74 23                	je     8038d3 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8038b0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038b7:	00 00 00 
+  8038ba:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8038c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038c5:	85 c9                	test   %ecx,%ecx
+  8038c7:	74 07                	je     8038d0 <ipc_recv_timed+0xa1>
+  8038c9:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8038d0:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8038d3:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038da:	00 00 00 
+  8038dd:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8038e3:	48 83 c4 08          	add    $0x8,%rsp
+  8038e7:	5b                   	pop    %rbx
+  8038e8:	41 5c                	pop    %r12
+  8038ea:	41 5d                	pop    %r13
+  8038ec:	5d                   	pop    %rbp
+  8038ed:	c3                   	ret
+        if (from_env_store != NULL) {
+  8038ee:	4d 85 e4             	test   %r12,%r12
+  8038f1:	74 08                	je     8038fb <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8038f3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038fa:	00 
+        if (perm_store != NULL) {
+  8038fb:	4d 85 ed             	test   %r13,%r13
+  8038fe:	74 08                	je     803908 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803900:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803907:	00 
+        if (size != NULL) {
+  803908:	48 85 db             	test   %rbx,%rbx
+  80390b:	74 d6                	je     8038e3 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80390d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803914:	eb cd                	jmp    8038e3 <ipc_recv_timed+0xb4>
+
+0000000000803916 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803916:	55                   	push   %rbp
+  803917:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80391a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803920:	48 b8 2f 38 80 00 00 	movabs $0x80382f,%rax
+  803927:	00 00 00 
+  80392a:	ff d0                	call   *%rax
+}
+  80392c:	5d                   	pop    %rbp
+  80392d:	c3                   	ret
+
+000000000080392e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80392e:	55                   	push   %rbp
+  80392f:	48 89 e5             	mov    %rsp,%rbp
+  803932:	41 57                	push   %r15
+  803934:	41 56                	push   %r14
+  803936:	41 55                	push   %r13
+  803938:	41 54                	push   %r12
+  80393a:	53                   	push   %rbx
+  80393b:	48 83 ec 18          	sub    $0x18,%rsp
+  80393f:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803942:	48 89 d3             	mov    %rdx,%rbx
+  803945:	49 89 cc             	mov    %rcx,%r12
+  803948:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80394b:	48 85 d2             	test   %rdx,%rdx
+  80394e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803955:	00 00 00 
+  803958:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80395c:	89 f0                	mov    %esi,%eax
+  80395e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803962:	48 89 da             	mov    %rbx,%rdx
+  803965:	48 89 c6             	mov    %rax,%rsi
+  803968:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+    while (res < 0) {
+  803974:	85 c0                	test   %eax,%eax
+  803976:	79 65                	jns    8039dd <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803978:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80397b:	75 33                	jne    8039b0 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80397d:	49 bf 72 12 80 00 00 	movabs $0x801272,%r15
+  803984:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803987:	49 be 6f 15 80 00 00 	movabs $0x80156f,%r14
+  80398e:	00 00 00 
+        sys_yield();
+  803991:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803994:	45 89 e8             	mov    %r13d,%r8d
+  803997:	4c 89 e1             	mov    %r12,%rcx
+  80399a:	48 89 da             	mov    %rbx,%rdx
+  80399d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8039a1:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8039a4:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8039a7:	85 c0                	test   %eax,%eax
+  8039a9:	79 32                	jns    8039dd <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8039ab:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8039ae:	74 e1                	je     803991 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8039b0:	89 c1                	mov    %eax,%ecx
+  8039b2:	48 ba e8 41 80 00 00 	movabs $0x8041e8,%rdx
+  8039b9:	00 00 00 
+  8039bc:	be 52 00 00 00       	mov    $0x52,%esi
+  8039c1:	48 bf fc 41 80 00 00 	movabs $0x8041fc,%rdi
+  8039c8:	00 00 00 
+  8039cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d0:	49 b8 00 02 80 00 00 	movabs $0x800200,%r8
+  8039d7:	00 00 00 
+  8039da:	41 ff d0             	call   *%r8
+    }
+}
+  8039dd:	48 83 c4 18          	add    $0x18,%rsp
+  8039e1:	5b                   	pop    %rbx
+  8039e2:	41 5c                	pop    %r12
+  8039e4:	41 5d                	pop    %r13
+  8039e6:	41 5e                	pop    %r14
+  8039e8:	41 5f                	pop    %r15
+  8039ea:	5d                   	pop    %rbp
+  8039eb:	c3                   	ret
+
+00000000008039ec <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8039ec:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8039f1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8039f8:	00 00 00 
+  8039fb:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039ff:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a03:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a07:	48 01 ca             	add    %rcx,%rdx
+  803a0a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a10:	39 fa                	cmp    %edi,%edx
+  803a12:	74 12                	je     803a26 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a14:	48 83 c0 01          	add    $0x1,%rax
+  803a18:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a1e:	75 db                	jne    8039fb <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a25:	c3                   	ret
+            return envs[i].env_id;
+  803a26:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a2a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a2e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a32:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a39:	00 00 00 
+  803a3c:	48 01 d0             	add    %rdx,%rax
+  803a3f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a45:	c3                   	ret
+  803a46:	66 90                	xchg   %ax,%ax
+
+0000000000803a48 <__rodata_start>:
+  803a48:	66 61                	data16 (bad)
+  803a4a:	75 6c                	jne    803ab8 <__rodata_start+0x70>
+  803a4c:	74 20                	je     803a6e <__rodata_start+0x26>
+  803a4e:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  803a53:	75 73                	jne    803ac8 <__rodata_start+0x80>
+  803a55:	65 72 2f             	gs jb  803a87 <__rodata_start+0x3f>
+  803a58:	66 61                	data16 (bad)
+  803a5a:	75 6c                	jne    803ac8 <__rodata_start+0x80>
+  803a5c:	74 61                	je     803abf <__rodata_start+0x77>
+  803a5e:	6c                   	insb   (%dx),%es:(%rdi)
+  803a5f:	6c                   	insb   (%dx),%es:(%rdi)
+  803a60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a61:	63 2e                	movsxd (%rsi),%ebp
+  803a63:	63 00                	movsxd (%rax),%eax
+  803a65:	25 73 0a 00 0f       	and    $0xf000a73,%eax
+  803a6a:	1f                   	(bad)
+  803a6b:	80 00 00             	addb   $0x0,(%rax)
+  803a6e:	00 00                	add    %al,(%rax)
+  803a70:	61                   	(bad)
+  803a71:	6c                   	insb   (%dx),%es:(%rdi)
+  803a72:	6c                   	insb   (%dx),%es:(%rdi)
+  803a73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a74:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803a77:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  803a7e:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  803a83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a84:	20 70 61             	and    %dh,0x61(%rax)
+  803a87:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  803a8c:	75 6c                	jne    803afa <__rodata_start+0xb2>
+  803a8e:	74 20                	je     803ab0 <__rodata_start+0x68>
+  803a90:	68 61 6e 64 6c       	push   $0x6c646e61
+  803a95:	65 72 3a             	gs jb  803ad2 <__rodata_start+0x8a>
+  803a98:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 803b07 <__rodata_start+0xbf>
+  803a9e:	00 00                	add    %al,(%rax)
+  803aa0:	74 68                	je     803b0a <__rodata_start+0xc2>
+  803aa2:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  803aa9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aaa:	67 20 77 61          	and    %dh,0x61(%edi)
+  803aae:	73 20                	jae    803ad0 <__rodata_start+0x88>
+  803ab0:	66 61                	data16 (bad)
+  803ab2:	75 6c                	jne    803b20 <__rodata_start+0xd8>
+  803ab4:	74 65                	je     803b1b <__rodata_start+0xd3>
+  803ab6:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803aba:	20 61 74             	and    %ah,0x74(%rcx)
+  803abd:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80b32f <__bss_end+0x3c00232f>
+  803ac3:	75 6e                	jne    803b33 <__rodata_start+0xeb>
+  803ac5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803ac9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aca:	3e 00 0f             	ds add %cl,(%rdi)
+  803acd:	1f                   	(bad)
+  803ace:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  803ad2:	30 38                	xor    %bh,(%rax)
+  803ad4:	78 5d                	js     803b33 <__rodata_start+0xeb>
+  803ad6:	20 75 73             	and    %dh,0x73(%rbp)
+  803ad9:	65 72 20             	gs jb  803afc <__rodata_start+0xb4>
+  803adc:	70 61                	jo     803b3f <__rodata_start+0xf7>
+  803ade:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803adf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803ae6:	73 20                	jae    803b08 <__rodata_start+0xc0>
+  803ae8:	61                   	(bad)
+  803ae9:	74 20                	je     803b0b <__rodata_start+0xc3>
+  803aeb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803af0:	3a 20                	cmp    (%rax),%ah
+  803af2:	00 30                	add    %dh,(%rax)
+  803af4:	31 32                	xor    %esi,(%rdx)
+  803af6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803afd:	41                   	rex.B
+  803afe:	42                   	rex.X
+  803aff:	43                   	rex.XB
+  803b00:	44                   	rex.R
+  803b01:	45                   	rex.RB
+  803b02:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b05:	31 32                	xor    %esi,(%rdx)
+  803b07:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b0e:	61                   	(bad)
+  803b0f:	62 63 64 65 66       	(bad)
+  803b14:	00 28                	add    %ch,(%rax)
+  803b16:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b17:	75 6c                	jne    803b85 <__rodata_start+0x13d>
+  803b19:	6c                   	insb   (%dx),%es:(%rdi)
+  803b1a:	29 00                	sub    %eax,(%rax)
+  803b1c:	65 72 72             	gs jb  803b91 <__rodata_start+0x149>
+  803b1f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b20:	72 20                	jb     803b42 <__rodata_start+0xfa>
+  803b22:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b27:	73 70                	jae    803b99 <__rodata_start+0x151>
+  803b29:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b2d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b34:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b35:	72 00                	jb     803b37 <__rodata_start+0xef>
+  803b37:	62 61 64 20 65       	(bad)
+  803b3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b3d:	76 69                	jbe    803ba8 <__rodata_start+0x160>
+  803b3f:	72 6f                	jb     803bb0 <__rodata_start+0x168>
+  803b41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b42:	6d                   	insl   (%dx),%es:(%rdi)
+  803b43:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b45:	74 00                	je     803b47 <__rodata_start+0xff>
+  803b47:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b4e:	20 70 61             	and    %dh,0x61(%rax)
+  803b51:	72 61                	jb     803bb4 <__rodata_start+0x16c>
+  803b53:	6d                   	insl   (%dx),%es:(%rdi)
+  803b54:	65 74 65             	gs je  803bbc <__rodata_start+0x174>
+  803b57:	72 00                	jb     803b59 <__rodata_start+0x111>
+  803b59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b5a:	75 74                	jne    803bd0 <__rodata_start+0x188>
+  803b5c:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b5f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b62:	6d                   	insl   (%dx),%es:(%rdi)
+  803b63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b64:	72 79                	jb     803bdf <__rodata_start+0x197>
+  803b66:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b69:	74 20                	je     803b8b <__rodata_start+0x143>
+  803b6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b6c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b70:	76 69                	jbe    803bdb <__rodata_start+0x193>
+  803b72:	72 6f                	jb     803be3 <__rodata_start+0x19b>
+  803b74:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b75:	6d                   	insl   (%dx),%es:(%rdi)
+  803b76:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b78:	74 73                	je     803bed <__rodata_start+0x1a5>
+  803b7a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b7d:	72 72                	jb     803bf1 <__rodata_start+0x1a9>
+  803b7f:	75 70                	jne    803bf1 <__rodata_start+0x1a9>
+  803b81:	74 65                	je     803be8 <__rodata_start+0x1a0>
+  803b83:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b88:	75 67                	jne    803bf1 <__rodata_start+0x1a9>
+  803b8a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b8d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b8f:	00 73 65             	add    %dh,0x65(%rbx)
+  803b92:	67 6d                	insl   (%dx),%es:(%edi)
+  803b94:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b96:	74 61                	je     803bf9 <__rodata_start+0x1b1>
+  803b98:	74 69                	je     803c03 <__rodata_start+0x1bb>
+  803b9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b9c:	20 66 61             	and    %ah,0x61(%rsi)
+  803b9f:	75 6c                	jne    803c0d <__rodata_start+0x1c5>
+  803ba1:	74 00                	je     803ba3 <__rodata_start+0x15b>
+  803ba3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803baa:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bad:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803bb1:	61                   	(bad)
+  803bb2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803bb7:	20 73 75             	and    %dh,0x75(%rbx)
+  803bba:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803bbd:	73 79                	jae    803c38 <__rodata_start+0x1f0>
+  803bbf:	73 74                	jae    803c35 <__rodata_start+0x1ed>
+  803bc1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803bc3:	20 63 61             	and    %ah,0x61(%rbx)
+  803bc6:	6c                   	insb   (%dx),%es:(%rdi)
+  803bc7:	6c                   	insb   (%dx),%es:(%rdi)
+  803bc8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803bcb:	74 72                	je     803c3f <__rodata_start+0x1f7>
+  803bcd:	79 20                	jns    803bef <__rodata_start+0x1a7>
+  803bcf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bd1:	74 20                	je     803bf3 <__rodata_start+0x1ab>
+  803bd3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bd5:	75 6e                	jne    803c45 <__rodata_start+0x1fd>
+  803bd7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803bdb:	76 20                	jbe    803bfd <__rodata_start+0x1b5>
+  803bdd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803be4:	72 65                	jb     803c4b <__rodata_start+0x203>
+  803be6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803be9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bea:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803bee:	65 78 70             	gs js  803c61 <__rodata_start+0x219>
+  803bf1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803bf6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803bf9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803bfd:	20 66 69             	and    %ah,0x69(%rsi)
+  803c00:	6c                   	insb   (%dx),%es:(%rdi)
+  803c01:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c05:	20 66 72             	and    %ah,0x72(%rsi)
+  803c08:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c0d:	61                   	(bad)
+  803c0e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c13:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c17:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c1c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c20:	79 20                	jns    803c42 <__rodata_start+0x1fa>
+  803c22:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c29:	72 65                	jb     803c90 <__rodata_start+0x248>
+  803c2b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c2e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c30:	00 66 69             	add    %ah,0x69(%rsi)
+  803c33:	6c                   	insb   (%dx),%es:(%rdi)
+  803c34:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c38:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c3c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c40:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c41:	74 20                	je     803c63 <__rodata_start+0x21b>
+  803c43:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c45:	75 6e                	jne    803cb5 <__rodata_start+0x26d>
+  803c47:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c4b:	76 61                	jbe    803cae <__rodata_start+0x266>
+  803c4d:	6c                   	insb   (%dx),%es:(%rdi)
+  803c4e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c55:	00 
+  803c56:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c5d:	72 65                	jb     803cc4 <__rodata_start+0x27c>
+  803c5f:	61                   	(bad)
+  803c60:	64 79 20             	fs jns 803c83 <__rodata_start+0x23b>
+  803c63:	65 78 69             	gs js  803ccf <__rodata_start+0x287>
+  803c66:	73 74                	jae    803cdc <__rodata_start+0x294>
+  803c68:	73 00                	jae    803c6a <__rodata_start+0x222>
+  803c6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6b:	70 65                	jo     803cd2 <__rodata_start+0x28a>
+  803c6d:	72 61                	jb     803cd0 <__rodata_start+0x288>
+  803c6f:	74 69                	je     803cda <__rodata_start+0x292>
+  803c71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c73:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c76:	74 20                	je     803c98 <__rodata_start+0x250>
+  803c78:	73 75                	jae    803cef <__rodata_start+0x2a7>
+  803c7a:	70 70                	jo     803cec <__rodata_start+0x2a4>
+  803c7c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c7d:	72 74                	jb     803cf3 <__rodata_start+0x2ab>
+  803c7f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803c85:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803c8a:	74 00                	je     803c8c <__rodata_start+0x244>
+  803c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c93:	00 00 00 
+  803c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c9d:	00 00 00 
+  803ca0:	3d 05 80 00 00       	cmp    $0x8005,%eax
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 6e 0b             	add    %ch,0xb(%rsi)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 5c 05 80          	add    %bl,-0x80(%rbp,%rax,1)
+  803cdb:	00 00                	add    %al,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 50 05             	add    %dl,0x5(%rax)
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 ca                	add    %cl,%dl
+  803cf9:	05 80 00 00 00       	add    $0x80,%eax
+  803cfe:	00 00                	add    %al,(%rax)
+  803d00:	7e 0b                	jle    803d0d <__rodata_start+0x2c5>
+  803d02:	80 00 00             	addb   $0x0,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 50 05             	add    %dl,0x5(%rax)
+  803d0a:	80 00 00             	addb   $0x0,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 96 05 80 00 00    	add    %dl,0x8005(%rsi)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d5a:	80 00 00             	addb   $0x0,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d62:	80 00 00             	addb   $0x0,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d6a:	80 00 00             	addb   $0x0,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d72:	80 00 00             	addb   $0x0,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dba:	80 00 00             	addb   $0x0,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dca:	80 00 00             	addb   $0x0,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dea:	80 00 00             	addb   $0x0,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803dfa:	80 00 00             	addb   $0x0,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e0a:	80 00 00             	addb   $0x0,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 a1 0a 80 00 00    	add    %ah,0x800a(%rcx)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e5a:	80 00 00             	addb   $0x0,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e6a:	80 00 00             	addb   $0x0,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e7a:	80 00 00             	addb   $0x0,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803e9a:	80 00 00             	addb   $0x0,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 ed                	add    %ch,%ch
+  803ea1:	05 80 00 00 00       	add    $0x80,%eax
+  803ea6:	00 00                	add    %al,(%rax)
+  803ea8:	bc 07 80 00 00       	mov    $0x8007,%esp
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803eb2:	80 00 00             	addb   $0x0,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803eba:	80 00 00             	addb   $0x0,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 1c 06             	add    %bl,(%rsi,%rax,1)
+  803ed2:	80 00 00             	addb   $0x0,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 e2                	add    %ah,%dl
+  803ee9:	05 80 00 00 00       	add    $0x80,%eax
+  803eee:	00 00                	add    %al,(%rax)
+  803ef0:	7e 0b                	jle    803efd <__rodata_start+0x4b5>
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 64 09 80          	add    %ah,-0x80(%rcx,%rcx,1)
+  803f03:	00 00                	add    %al,(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 2e                	add    %ch,(%rsi)
+  803f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803f0f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 b3 06 80 00 00    	add    %dh,0x8006(%rbx)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 90 08 80 00 00    	add    %dl,0x8008(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f3a:	80 00 00             	addb   $0x0,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 a1 0a 80 00 00    	add    %ah,0x800a(%rcx)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 7e 0b             	add    %bh,0xb(%rsi)
+  803f52:	80 00 00             	addb   $0x0,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 46 05             	add    %al,0x5(%rsi)
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f60 <error_string>:
+	...
+  803f68:	25 3b 80 00 00 00 00 00 37 3b 80 00 00 00 00 00     %;......7;......
+  803f78:	47 3b 80 00 00 00 00 00 59 3b 80 00 00 00 00 00     G;......Y;......
+  803f88:	67 3b 80 00 00 00 00 00 7b 3b 80 00 00 00 00 00     g;......{;......
+  803f98:	90 3b 80 00 00 00 00 00 a3 3b 80 00 00 00 00 00     .;.......;......
+  803fa8:	b5 3b 80 00 00 00 00 00 c9 3b 80 00 00 00 00 00     .;.......;......
+  803fb8:	d9 3b 80 00 00 00 00 00 ec 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	03 3c 80 00 00 00 00 00 19 3c 80 00 00 00 00 00     .<.......<......
+  803fd8:	31 3c 80 00 00 00 00 00 49 3c 80 00 00 00 00 00     1<......I<......
+  803fe8:	56 3c 80 00 00 00 00 00 08 40 80 00 00 00 00 00     V<.......@......
+  803ff8:	6a 3c 80 00 00 00 00 00 82 3c 80 00 00 00 00 00     j<.......<......
+  804008:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804018:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804028:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804038:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804048:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804058:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804068:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804078:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804088:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804098:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8040a8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8040b8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8040c8:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  8040d8:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  8040e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8040f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804108:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804118:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804128:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804138:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804148:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804158:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804168:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804178:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804180 <devtab>:
+  804180:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804190:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8041a0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8041b0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8041c0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8041d0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8041e0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  8041f0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804200:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,7563 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 28 3a 80 00 00 	movabs $0x803a28,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 2e 03 80 00 00 	movabs $0x80032e,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 78 3a 80 00 00 	movabs $0x803a78,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 d8 0b 80 00 00 	movabs $0x800bd8,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 48 3a 80 00 00 	movabs $0x803a48,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 33 3a 80 00 00 	movabs $0x803a33,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	41 89 fd             	mov    %edi,%r13d
+  80011b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80011e:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800125:	00 00 00 
+  800128:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80012f:	00 00 00 
+  800132:	48 39 c2             	cmp    %rax,%rdx
+  800135:	73 17                	jae    80014e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800137:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013a:	49 89 c4             	mov    %rax,%r12
+  80013d:	48 83 c3 08          	add    $0x8,%rbx
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	ff 53 f8             	call   *-0x8(%rbx)
+  800149:	4c 39 e3             	cmp    %r12,%rbx
+  80014c:	72 ef                	jb     80013d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80014e:	48 b8 1f 12 80 00 00 	movabs $0x80121f,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+  80015a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80015f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800163:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800167:	48 c1 e0 04          	shl    $0x4,%rax
+  80016b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800172:	00 00 00 
+  800175:	48 01 d0             	add    %rdx,%rax
+  800178:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80017f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800182:	45 85 ed             	test   %r13d,%r13d
+  800185:	7e 0d                	jle    800194 <libmain+0x87>
+  800187:	49 8b 06             	mov    (%r14),%rax
+  80018a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800191:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800194:	4c 89 f6             	mov    %r14,%rsi
+  800197:	44 89 ef             	mov    %r13d,%edi
+  80019a:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001a1:	00 00 00 
+  8001a4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001a6:	48 b8 bb 01 80 00 00 	movabs $0x8001bb,%rax
+  8001ad:	00 00 00 
+  8001b0:	ff d0                	call   *%rax
+#endif
+}
+  8001b2:	5b                   	pop    %rbx
+  8001b3:	41 5c                	pop    %r12
+  8001b5:	41 5d                	pop    %r13
+  8001b7:	41 5e                	pop    %r14
+  8001b9:	5d                   	pop    %rbp
+  8001ba:	c3                   	ret
+
+00000000008001bb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001bb:	55                   	push   %rbp
+  8001bc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001bf:	48 b8 a2 1b 80 00 00 	movabs $0x801ba2,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d0:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  8001d7:	00 00 00 
+  8001da:	ff d0                	call   *%rax
+}
+  8001dc:	5d                   	pop    %rbp
+  8001dd:	c3                   	ret
+
+00000000008001de <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001de:	55                   	push   %rbp
+  8001df:	48 89 e5             	mov    %rsp,%rbp
+  8001e2:	41 56                	push   %r14
+  8001e4:	41 55                	push   %r13
+  8001e6:	41 54                	push   %r12
+  8001e8:	53                   	push   %rbx
+  8001e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8001ed:	49 89 fc             	mov    %rdi,%r12
+  8001f0:	41 89 f5             	mov    %esi,%r13d
+  8001f3:	48 89 d3             	mov    %rdx,%rbx
+  8001f6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001fa:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001fe:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800202:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800209:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80020d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800211:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800215:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800219:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800220:	00 00 00 
+  800223:	4c 8b 30             	mov    (%rax),%r14
+  800226:	48 b8 1f 12 80 00 00 	movabs $0x80121f,%rax
+  80022d:	00 00 00 
+  800230:	ff d0                	call   *%rax
+  800232:	89 c6                	mov    %eax,%esi
+  800234:	45 89 e8             	mov    %r13d,%r8d
+  800237:	4c 89 e1             	mov    %r12,%rcx
+  80023a:	4c 89 f2             	mov    %r14,%rdx
+  80023d:	48 bf a8 3a 80 00 00 	movabs $0x803aa8,%rdi
+  800244:	00 00 00 
+  800247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024c:	49 bc 2e 03 80 00 00 	movabs $0x80032e,%r12
+  800253:	00 00 00 
+  800256:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800259:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80025d:	48 89 df             	mov    %rbx,%rdi
+  800260:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  800267:	00 00 00 
+  80026a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80026c:	48 bf 3b 41 80 00 00 	movabs $0x80413b,%rdi
+  800273:	00 00 00 
+  800276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80027e:	cc                   	int3
+  80027f:	eb fd                	jmp    80027e <_panic+0xa0>
+
+0000000000800281 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	53                   	push   %rbx
+  800286:	48 83 ec 08          	sub    $0x8,%rsp
+  80028a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80028d:	8b 06                	mov    (%rsi),%eax
+  80028f:	8d 50 01             	lea    0x1(%rax),%edx
+  800292:	89 16                	mov    %edx,(%rsi)
+  800294:	48 98                	cltq
+  800296:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80029b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002a1:	74 0a                	je     8002ad <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002a3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002ad:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002b1:	be ff 00 00 00       	mov    $0xff,%esi
+  8002b6:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002c8:	eb d9                	jmp    8002a3 <putch+0x22>
+
+00000000008002ca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002ca:	55                   	push   %rbp
+  8002cb:	48 89 e5             	mov    %rsp,%rbp
+  8002ce:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002d5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002d8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002df:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002ec:	48 89 f1             	mov    %rsi,%rcx
+  8002ef:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002f6:	48 bf 81 02 80 00 00 	movabs $0x800281,%rdi
+  8002fd:	00 00 00 
+  800300:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  800307:	00 00 00 
+  80030a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80030c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800313:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80031a:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  800321:	00 00 00 
+  800324:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800326:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+
+000000000080032e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80032e:	55                   	push   %rbp
+  80032f:	48 89 e5             	mov    %rsp,%rbp
+  800332:	48 83 ec 50          	sub    $0x50,%rsp
+  800336:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80033a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80033e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800342:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800346:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80034a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800351:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800355:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800359:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80035d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800361:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800365:	48 b8 ca 02 80 00 00 	movabs $0x8002ca,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800371:	c9                   	leave
+  800372:	c3                   	ret
+
+0000000000800373 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800373:	55                   	push   %rbp
+  800374:	48 89 e5             	mov    %rsp,%rbp
+  800377:	41 57                	push   %r15
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	48 83 ec 18          	sub    $0x18,%rsp
+  800384:	49 89 fc             	mov    %rdi,%r12
+  800387:	49 89 f5             	mov    %rsi,%r13
+  80038a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80038e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800391:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800394:	41 89 cf             	mov    %ecx,%r15d
+  800397:	4c 39 fa             	cmp    %r15,%rdx
+  80039a:	73 5b                	jae    8003f7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80039c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003a0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003a4:	85 db                	test   %ebx,%ebx
+  8003a6:	7e 0e                	jle    8003b6 <print_num+0x43>
+            putch(padc, put_arg);
+  8003a8:	4c 89 ee             	mov    %r13,%rsi
+  8003ab:	44 89 f7             	mov    %r14d,%edi
+  8003ae:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003b1:	83 eb 01             	sub    $0x1,%ebx
+  8003b4:	75 f2                	jne    8003a8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003b6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003ba:	48 b9 dc 3a 80 00 00 	movabs $0x803adc,%rcx
+  8003c1:	00 00 00 
+  8003c4:	48 b8 cb 3a 80 00 00 	movabs $0x803acb,%rax
+  8003cb:	00 00 00 
+  8003ce:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003db:	49 f7 f7             	div    %r15
+  8003de:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003e2:	4c 89 ee             	mov    %r13,%rsi
+  8003e5:	41 ff d4             	call   *%r12
+}
+  8003e8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003ec:	5b                   	pop    %rbx
+  8003ed:	41 5c                	pop    %r12
+  8003ef:	41 5d                	pop    %r13
+  8003f1:	41 5e                	pop    %r14
+  8003f3:	41 5f                	pop    %r15
+  8003f5:	5d                   	pop    %rbp
+  8003f6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800400:	49 f7 f7             	div    %r15
+  800403:	48 83 ec 08          	sub    $0x8,%rsp
+  800407:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80040b:	52                   	push   %rdx
+  80040c:	45 0f be c9          	movsbl %r9b,%r9d
+  800410:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800414:	48 89 c2             	mov    %rax,%rdx
+  800417:	48 b8 73 03 80 00 00 	movabs $0x800373,%rax
+  80041e:	00 00 00 
+  800421:	ff d0                	call   *%rax
+  800423:	48 83 c4 10          	add    $0x10,%rsp
+  800427:	eb 8d                	jmp    8003b6 <print_num+0x43>
+
+0000000000800429 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800429:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80042d:	48 8b 06             	mov    (%rsi),%rax
+  800430:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800434:	73 0a                	jae    800440 <sprintputch+0x17>
+        *state->start++ = ch;
+  800436:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80043a:	48 89 16             	mov    %rdx,(%rsi)
+  80043d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800440:	c3                   	ret
+
+0000000000800441 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	48 83 ec 50          	sub    $0x50,%rsp
+  800449:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80044d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800451:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800455:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80045c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800460:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800464:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800468:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80046c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800470:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  800477:	00 00 00 
+  80047a:	ff d0                	call   *%rax
+}
+  80047c:	c9                   	leave
+  80047d:	c3                   	ret
+
+000000000080047e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80047e:	55                   	push   %rbp
+  80047f:	48 89 e5             	mov    %rsp,%rbp
+  800482:	41 57                	push   %r15
+  800484:	41 56                	push   %r14
+  800486:	41 55                	push   %r13
+  800488:	41 54                	push   %r12
+  80048a:	53                   	push   %rbx
+  80048b:	48 83 ec 38          	sub    $0x38,%rsp
+  80048f:	49 89 fe             	mov    %rdi,%r14
+  800492:	49 89 f5             	mov    %rsi,%r13
+  800495:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800498:	48 8b 01             	mov    (%rcx),%rax
+  80049b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80049f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004af:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004b3:	0f b6 3b             	movzbl (%rbx),%edi
+  8004b6:	40 80 ff 25          	cmp    $0x25,%dil
+  8004ba:	74 18                	je     8004d4 <vprintfmt+0x56>
+            if (!ch) return;
+  8004bc:	40 84 ff             	test   %dil,%dil
+  8004bf:	0f 84 b1 06 00 00    	je     800b76 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004c5:	40 0f b6 ff          	movzbl %dil,%edi
+  8004c9:	4c 89 ee             	mov    %r13,%rsi
+  8004cc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004cf:	4c 89 e3             	mov    %r12,%rbx
+  8004d2:	eb db                	jmp    8004af <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004dd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004e2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ef:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004f8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004fd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800500:	83 e8 23             	sub    $0x23,%eax
+  800503:	3c 57                	cmp    $0x57,%al
+  800505:	0f 87 51 06 00 00    	ja     800b5c <vprintfmt+0x6de>
+  80050b:	0f b6 c0             	movzbl %al,%eax
+  80050e:	48 b9 80 3c 80 00 00 	movabs $0x803c80,%rcx
+  800515:	00 00 00 
+  800518:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80051b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80051e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800522:	eb cf                	jmp    8004f3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800524:	49 89 dc             	mov    %rbx,%r12
+  800527:	be 01 00 00 00       	mov    $0x1,%esi
+  80052c:	eb c5                	jmp    8004f3 <vprintfmt+0x75>
+            padc = ch;
+  80052e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800532:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800535:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800538:	eb b9                	jmp    8004f3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80053a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053d:	83 f8 2f             	cmp    $0x2f,%eax
+  800540:	77 24                	ja     800566 <vprintfmt+0xe8>
+  800542:	89 c1                	mov    %eax,%ecx
+  800544:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800548:	83 c0 08             	add    $0x8,%eax
+  80054b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800551:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800554:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800558:	79 99                	jns    8004f3 <vprintfmt+0x75>
+                width = precision;
+  80055a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80055e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800564:	eb 8d                	jmp    8004f3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800566:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80056a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80056e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800572:	eb da                	jmp    80054e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800574:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800579:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80057d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800583:	3c 39                	cmp    $0x39,%al
+  800585:	77 1c                	ja     8005a3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800587:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80058b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80058f:	0f b6 c0             	movzbl %al,%eax
+  800592:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800597:	0f b6 03             	movzbl (%rbx),%eax
+  80059a:	3c 39                	cmp    $0x39,%al
+  80059c:	76 e9                	jbe    800587 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80059e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005a1:	eb b1                	jmp    800554 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005a3:	49 89 dc             	mov    %rbx,%r12
+  8005a6:	eb ac                	jmp    800554 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005a8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	0f 49 c1             	cmovns %ecx,%eax
+  8005b5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005b8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005bb:	e9 33 ff ff ff       	jmp    8004f3 <vprintfmt+0x75>
+            lflag++;
+  8005c0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005c3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c6:	e9 28 ff ff ff       	jmp    8004f3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d1:	77 19                	ja     8005ec <vprintfmt+0x16e>
+  8005d3:	89 c2                	mov    %eax,%edx
+  8005d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d9:	83 c0 08             	add    $0x8,%eax
+  8005dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005df:	8b 3a                	mov    (%rdx),%edi
+  8005e1:	4c 89 ee             	mov    %r13,%rsi
+  8005e4:	41 ff d6             	call   *%r14
+            break;
+  8005e7:	e9 c3 fe ff ff       	jmp    8004af <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f8:	eb e5                	jmp    8005df <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800600:	77 5a                	ja     80065c <vprintfmt+0x1de>
+  800602:	89 c2                	mov    %eax,%edx
+  800604:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800608:	83 c0 08             	add    $0x8,%eax
+  80060b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80060e:	8b 02                	mov    (%rdx),%eax
+  800610:	89 c1                	mov    %eax,%ecx
+  800612:	f7 d9                	neg    %ecx
+  800614:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800617:	83 f9 14             	cmp    $0x14,%ecx
+  80061a:	7f 4e                	jg     80066a <vprintfmt+0x1ec>
+  80061c:	48 63 c1             	movslq %ecx,%rax
+  80061f:	48 ba 40 3f 80 00 00 	movabs $0x803f40,%rdx
+  800626:	00 00 00 
+  800629:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80062d:	48 85 c0             	test   %rax,%rax
+  800630:	74 38                	je     80066a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800632:	48 89 c1             	mov    %rax,%rcx
+  800635:	48 ba ba 40 80 00 00 	movabs $0x8040ba,%rdx
+  80063c:	00 00 00 
+  80063f:	4c 89 ee             	mov    %r13,%rsi
+  800642:	4c 89 f7             	mov    %r14,%rdi
+  800645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064a:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  800651:	00 00 00 
+  800654:	41 ff d0             	call   *%r8
+  800657:	e9 53 fe ff ff       	jmp    8004af <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80065c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800660:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800664:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800668:	eb a4                	jmp    80060e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80066a:	48 ba f4 3a 80 00 00 	movabs $0x803af4,%rdx
+  800671:	00 00 00 
+  800674:	4c 89 ee             	mov    %r13,%rsi
+  800677:	4c 89 f7             	mov    %r14,%rdi
+  80067a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067f:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  800686:	00 00 00 
+  800689:	41 ff d0             	call   *%r8
+  80068c:	e9 1e fe ff ff       	jmp    8004af <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800691:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800694:	83 f8 2f             	cmp    $0x2f,%eax
+  800697:	77 6c                	ja     800705 <vprintfmt+0x287>
+  800699:	89 c2                	mov    %eax,%edx
+  80069b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069f:	83 c0 08             	add    $0x8,%eax
+  8006a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006a8:	48 85 d2             	test   %rdx,%rdx
+  8006ab:	48 b8 ed 3a 80 00 00 	movabs $0x803aed,%rax
+  8006b2:	00 00 00 
+  8006b5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006b9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006bd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c1:	7e 06                	jle    8006c9 <vprintfmt+0x24b>
+  8006c3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006c7:	75 4a                	jne    800713 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006c9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006cd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006d1:	0f b6 00             	movzbl (%rax),%eax
+  8006d4:	84 c0                	test   %al,%al
+  8006d6:	0f 85 9a 00 00 00    	jne    800776 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006dc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006df:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006e3:	85 c0                	test   %eax,%eax
+  8006e5:	0f 8e c4 fd ff ff    	jle    8004af <vprintfmt+0x31>
+  8006eb:	4c 89 ee             	mov    %r13,%rsi
+  8006ee:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006f3:	41 ff d6             	call   *%r14
+  8006f6:	41 83 ec 01          	sub    $0x1,%r12d
+  8006fa:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006fe:	75 eb                	jne    8006eb <vprintfmt+0x26d>
+  800700:	e9 aa fd ff ff       	jmp    8004af <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800705:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800709:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800711:	eb 92                	jmp    8006a5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800713:	49 63 f7             	movslq %r15d,%rsi
+  800716:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80071a:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  800721:	00 00 00 
+  800724:	ff d0                	call   *%rax
+  800726:	48 89 c2             	mov    %rax,%rdx
+  800729:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80072e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800731:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800734:	85 c0                	test   %eax,%eax
+  800736:	7e 91                	jle    8006c9 <vprintfmt+0x24b>
+  800738:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80073d:	4c 89 ee             	mov    %r13,%rsi
+  800740:	44 89 e7             	mov    %r12d,%edi
+  800743:	41 ff d6             	call   *%r14
+  800746:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80074a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80074d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800750:	75 eb                	jne    80073d <vprintfmt+0x2bf>
+  800752:	e9 72 ff ff ff       	jmp    8006c9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800757:	0f b6 f8             	movzbl %al,%edi
+  80075a:	4c 89 ee             	mov    %r13,%rsi
+  80075d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800760:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800764:	49 83 c4 01          	add    $0x1,%r12
+  800768:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80076e:	84 c0                	test   %al,%al
+  800770:	0f 84 66 ff ff ff    	je     8006dc <vprintfmt+0x25e>
+  800776:	45 85 ff             	test   %r15d,%r15d
+  800779:	78 0a                	js     800785 <vprintfmt+0x307>
+  80077b:	41 83 ef 01          	sub    $0x1,%r15d
+  80077f:	0f 88 57 ff ff ff    	js     8006dc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800785:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800789:	74 cc                	je     800757 <vprintfmt+0x2d9>
+  80078b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80078e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800793:	80 fa 5e             	cmp    $0x5e,%dl
+  800796:	77 c2                	ja     80075a <vprintfmt+0x2dc>
+  800798:	eb bd                	jmp    800757 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80079a:	40 84 f6             	test   %sil,%sil
+  80079d:	75 26                	jne    8007c5 <vprintfmt+0x347>
+    switch (lflag) {
+  80079f:	85 d2                	test   %edx,%edx
+  8007a1:	74 59                	je     8007fc <vprintfmt+0x37e>
+  8007a3:	83 fa 01             	cmp    $0x1,%edx
+  8007a6:	74 7b                	je     800823 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ae:	0f 87 96 00 00 00    	ja     80084a <vprintfmt+0x3cc>
+  8007b4:	89 c2                	mov    %eax,%edx
+  8007b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ba:	83 c0 08             	add    $0x8,%eax
+  8007bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c0:	4c 8b 22             	mov    (%rdx),%r12
+  8007c3:	eb 17                	jmp    8007dc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 21                	ja     8007ee <vprintfmt+0x370>
+  8007cd:	89 c2                	mov    %eax,%edx
+  8007cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007dc:	4d 85 e4             	test   %r12,%r12
+  8007df:	78 7a                	js     80085b <vprintfmt+0x3dd>
+            num = i;
+  8007e1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007e9:	e9 50 02 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fa:	eb dd                	jmp    8007d9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800802:	77 11                	ja     800815 <vprintfmt+0x397>
+  800804:	89 c2                	mov    %eax,%edx
+  800806:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080a:	83 c0 08             	add    $0x8,%eax
+  80080d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800810:	4c 63 22             	movslq (%rdx),%r12
+  800813:	eb c7                	jmp    8007dc <vprintfmt+0x35e>
+  800815:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800819:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800821:	eb ed                	jmp    800810 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800823:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800826:	83 f8 2f             	cmp    $0x2f,%eax
+  800829:	77 11                	ja     80083c <vprintfmt+0x3be>
+  80082b:	89 c2                	mov    %eax,%edx
+  80082d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800831:	83 c0 08             	add    $0x8,%eax
+  800834:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800837:	4c 8b 22             	mov    (%rdx),%r12
+  80083a:	eb a0                	jmp    8007dc <vprintfmt+0x35e>
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb ed                	jmp    800837 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80084a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800852:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800856:	e9 65 ff ff ff       	jmp    8007c0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80085b:	4c 89 ee             	mov    %r13,%rsi
+  80085e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800863:	41 ff d6             	call   *%r14
+                i = -i;
+  800866:	49 f7 dc             	neg    %r12
+  800869:	e9 73 ff ff ff       	jmp    8007e1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80086e:	40 84 f6             	test   %sil,%sil
+  800871:	75 32                	jne    8008a5 <vprintfmt+0x427>
+    switch (lflag) {
+  800873:	85 d2                	test   %edx,%edx
+  800875:	74 5d                	je     8008d4 <vprintfmt+0x456>
+  800877:	83 fa 01             	cmp    $0x1,%edx
+  80087a:	0f 84 82 00 00 00    	je     800902 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	0f 87 a5 00 00 00    	ja     800931 <vprintfmt+0x4b3>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a0:	e9 99 01 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ab:	77 19                	ja     8008c6 <vprintfmt+0x448>
+  8008ad:	89 c2                	mov    %eax,%edx
+  8008af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b3:	83 c0 08             	add    $0x8,%eax
+  8008b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008bc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c1:	e9 78 01 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb e5                	jmp    8008b9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008da:	77 18                	ja     8008f4 <vprintfmt+0x476>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ef:	e9 4a 01 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+  8008f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800900:	eb e6                	jmp    8008e8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800902:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800905:	83 f8 2f             	cmp    $0x2f,%eax
+  800908:	77 19                	ja     800923 <vprintfmt+0x4a5>
+  80090a:	89 c2                	mov    %eax,%edx
+  80090c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800910:	83 c0 08             	add    $0x8,%eax
+  800913:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800916:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800919:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80091e:	e9 1b 01 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+  800923:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800927:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092f:	eb e5                	jmp    800916 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800931:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800935:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800939:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093d:	e9 56 ff ff ff       	jmp    800898 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800942:	40 84 f6             	test   %sil,%sil
+  800945:	75 2e                	jne    800975 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800947:	85 d2                	test   %edx,%edx
+  800949:	74 59                	je     8009a4 <vprintfmt+0x526>
+  80094b:	83 fa 01             	cmp    $0x1,%edx
+  80094e:	74 7f                	je     8009cf <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	0f 87 9f 00 00 00    	ja     8009fb <vprintfmt+0x57d>
+  80095c:	89 c2                	mov    %eax,%edx
+  80095e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800962:	83 c0 08             	add    $0x8,%eax
+  800965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800968:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80096b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800970:	e9 c9 00 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800975:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800978:	83 f8 2f             	cmp    $0x2f,%eax
+  80097b:	77 19                	ja     800996 <vprintfmt+0x518>
+  80097d:	89 c2                	mov    %eax,%edx
+  80097f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800983:	83 c0 08             	add    $0x8,%eax
+  800986:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800989:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80098c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800991:	e9 a8 00 00 00       	jmp    800a3e <vprintfmt+0x5c0>
+  800996:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a2:	eb e5                	jmp    800989 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009aa:	77 15                	ja     8009c1 <vprintfmt+0x543>
+  8009ac:	89 c2                	mov    %eax,%edx
+  8009ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b2:	83 c0 08             	add    $0x8,%eax
+  8009b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009ba:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009bf:	eb 7d                	jmp    800a3e <vprintfmt+0x5c0>
+  8009c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cd:	eb e9                	jmp    8009b8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 16                	ja     8009ed <vprintfmt+0x56f>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009eb:	eb 51                	jmp    800a3e <vprintfmt+0x5c0>
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb e8                	jmp    8009e3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a07:	e9 5c ff ff ff       	jmp    800968 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a0c:	4c 89 ee             	mov    %r13,%rsi
+  800a0f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a14:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a17:	4c 89 ee             	mov    %r13,%rsi
+  800a1a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a1f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a25:	83 f8 2f             	cmp    $0x2f,%eax
+  800a28:	77 47                	ja     800a71 <vprintfmt+0x5f3>
+  800a2a:	89 c2                	mov    %eax,%edx
+  800a2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a30:	83 c0 08             	add    $0x8,%eax
+  800a33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a36:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a39:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a3e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a42:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a46:	0f 94 c0             	sete   %al
+  800a49:	0f b6 c0             	movzbl %al,%eax
+  800a4c:	50                   	push   %rax
+  800a4d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a52:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a56:	4c 89 ee             	mov    %r13,%rsi
+  800a59:	4c 89 f7             	mov    %r14,%rdi
+  800a5c:	48 b8 73 03 80 00 00 	movabs $0x800373,%rax
+  800a63:	00 00 00 
+  800a66:	ff d0                	call   *%rax
+            break;
+  800a68:	48 83 c4 10          	add    $0x10,%rsp
+  800a6c:	e9 3e fa ff ff       	jmp    8004af <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7d:	eb b7                	jmp    800a36 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7f:	40 84 f6             	test   %sil,%sil
+  800a82:	75 2b                	jne    800aaf <vprintfmt+0x631>
+    switch (lflag) {
+  800a84:	85 d2                	test   %edx,%edx
+  800a86:	74 56                	je     800ade <vprintfmt+0x660>
+  800a88:	83 fa 01             	cmp    $0x1,%edx
+  800a8b:	74 7f                	je     800b0c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a90:	83 f8 2f             	cmp    $0x2f,%eax
+  800a93:	0f 87 a2 00 00 00    	ja     800b3b <vprintfmt+0x6bd>
+  800a99:	89 c2                	mov    %eax,%edx
+  800a9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9f:	83 c0 08             	add    $0x8,%eax
+  800aa2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aad:	eb 8f                	jmp    800a3e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	77 19                	ja     800ad0 <vprintfmt+0x652>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800acb:	e9 6e ff ff ff       	jmp    800a3e <vprintfmt+0x5c0>
+  800ad0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adc:	eb e5                	jmp    800ac3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ade:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae4:	77 18                	ja     800afe <vprintfmt+0x680>
+  800ae6:	89 c2                	mov    %eax,%edx
+  800ae8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aec:	83 c0 08             	add    $0x8,%eax
+  800aef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800af4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800af9:	e9 40 ff ff ff       	jmp    800a3e <vprintfmt+0x5c0>
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	eb e6                	jmp    800af2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	77 19                	ja     800b2d <vprintfmt+0x6af>
+  800b14:	89 c2                	mov    %eax,%edx
+  800b16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1a:	83 c0 08             	add    $0x8,%eax
+  800b1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b28:	e9 11 ff ff ff       	jmp    800a3e <vprintfmt+0x5c0>
+  800b2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b39:	eb e5                	jmp    800b20 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b47:	e9 59 ff ff ff       	jmp    800aa5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b4c:	4c 89 ee             	mov    %r13,%rsi
+  800b4f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b54:	41 ff d6             	call   *%r14
+            break;
+  800b57:	e9 53 f9 ff ff       	jmp    8004af <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b5c:	4c 89 ee             	mov    %r13,%rsi
+  800b5f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b64:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b67:	48 83 eb 01          	sub    $0x1,%rbx
+  800b6b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b6f:	75 f6                	jne    800b67 <vprintfmt+0x6e9>
+  800b71:	e9 39 f9 ff ff       	jmp    8004af <vprintfmt+0x31>
+}
+  800b76:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b7a:	5b                   	pop    %rbx
+  800b7b:	41 5c                	pop    %r12
+  800b7d:	41 5d                	pop    %r13
+  800b7f:	41 5e                	pop    %r14
+  800b81:	41 5f                	pop    %r15
+  800b83:	5d                   	pop    %rbp
+  800b84:	c3                   	ret
+
+0000000000800b85 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b85:	55                   	push   %rbp
+  800b86:	48 89 e5             	mov    %rsp,%rbp
+  800b89:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b91:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b96:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b9a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ba1:	48 85 ff             	test   %rdi,%rdi
+  800ba4:	74 2b                	je     800bd1 <vsnprintf+0x4c>
+  800ba6:	48 85 f6             	test   %rsi,%rsi
+  800ba9:	74 26                	je     800bd1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800baf:	48 bf 29 04 80 00 00 	movabs $0x800429,%rdi
+  800bb6:	00 00 00 
+  800bb9:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  800bc0:	00 00 00 
+  800bc3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bcc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bcf:	c9                   	leave
+  800bd0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd6:	eb f7                	jmp    800bcf <vsnprintf+0x4a>
+
+0000000000800bd8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bd8:	55                   	push   %rbp
+  800bd9:	48 89 e5             	mov    %rsp,%rbp
+  800bdc:	48 83 ec 50          	sub    $0x50,%rsp
+  800be0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800be4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800be8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bf3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c03:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c07:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  800c0e:	00 00 00 
+  800c11:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c13:	c9                   	leave
+  800c14:	c3                   	ret
+
+0000000000800c15 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c15:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c18:	74 10                	je     800c2a <strlen+0x15>
+    size_t n = 0;
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c1f:	48 83 c0 01          	add    $0x1,%rax
+  800c23:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c27:	75 f6                	jne    800c1f <strlen+0xa>
+  800c29:	c3                   	ret
+    size_t n = 0;
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c2f:	c3                   	ret
+
+0000000000800c30 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c30:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c33:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c38:	48 85 f6             	test   %rsi,%rsi
+  800c3b:	74 11                	je     800c4e <strnlen+0x1e>
+  800c3d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c41:	74 0c                	je     800c4f <strnlen+0x1f>
+  800c43:	48 83 c2 01          	add    $0x1,%rdx
+  800c47:	48 39 d0             	cmp    %rdx,%rax
+  800c4a:	75 f1                	jne    800c3d <strnlen+0xd>
+  800c4c:	eb 04                	jmp    800c52 <strnlen+0x22>
+  800c4e:	c3                   	ret
+  800c4f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c52:	c3                   	ret
+
+0000000000800c53 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c53:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c5f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c62:	48 83 c2 01          	add    $0x1,%rdx
+  800c66:	84 c9                	test   %cl,%cl
+  800c68:	75 f1                	jne    800c5b <strcpy+0x8>
+        ;
+    return res;
+}
+  800c6a:	c3                   	ret
+
+0000000000800c6b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c6b:	55                   	push   %rbp
+  800c6c:	48 89 e5             	mov    %rsp,%rbp
+  800c6f:	41 54                	push   %r12
+  800c71:	53                   	push   %rbx
+  800c72:	48 89 fb             	mov    %rdi,%rbx
+  800c75:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c78:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  800c7f:	00 00 00 
+  800c82:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c84:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c88:	4c 89 e6             	mov    %r12,%rsi
+  800c8b:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  800c92:	00 00 00 
+  800c95:	ff d0                	call   *%rax
+    return dst;
+}
+  800c97:	48 89 d8             	mov    %rbx,%rax
+  800c9a:	5b                   	pop    %rbx
+  800c9b:	41 5c                	pop    %r12
+  800c9d:	5d                   	pop    %rbp
+  800c9e:	c3                   	ret
+
+0000000000800c9f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c9f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ca2:	48 85 d2             	test   %rdx,%rdx
+  800ca5:	74 1f                	je     800cc6 <strncpy+0x27>
+  800ca7:	48 01 fa             	add    %rdi,%rdx
+  800caa:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cad:	48 83 c1 01          	add    $0x1,%rcx
+  800cb1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cb5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cb9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cbd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cc1:	48 39 ca             	cmp    %rcx,%rdx
+  800cc4:	75 e7                	jne    800cad <strncpy+0xe>
+    }
+    return ret;
+}
+  800cc6:	c3                   	ret
+
+0000000000800cc7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cc7:	48 89 f8             	mov    %rdi,%rax
+  800cca:	48 85 d2             	test   %rdx,%rdx
+  800ccd:	74 24                	je     800cf3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ccf:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd3:	74 1b                	je     800cf0 <strlcpy+0x29>
+  800cd5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cd9:	0f b6 16             	movzbl (%rsi),%edx
+  800cdc:	84 d2                	test   %dl,%dl
+  800cde:	74 10                	je     800cf0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ce0:	48 83 c6 01          	add    $0x1,%rsi
+  800ce4:	48 83 c0 01          	add    $0x1,%rax
+  800ce8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ceb:	48 39 c8             	cmp    %rcx,%rax
+  800cee:	75 e9                	jne    800cd9 <strlcpy+0x12>
+        *dst = '\0';
+  800cf0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cf3:	48 29 f8             	sub    %rdi,%rax
+}
+  800cf6:	c3                   	ret
+
+0000000000800cf7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cf7:	0f b6 07             	movzbl (%rdi),%eax
+  800cfa:	84 c0                	test   %al,%al
+  800cfc:	74 13                	je     800d11 <strcmp+0x1a>
+  800cfe:	38 06                	cmp    %al,(%rsi)
+  800d00:	75 0f                	jne    800d11 <strcmp+0x1a>
+  800d02:	48 83 c7 01          	add    $0x1,%rdi
+  800d06:	48 83 c6 01          	add    $0x1,%rsi
+  800d0a:	0f b6 07             	movzbl (%rdi),%eax
+  800d0d:	84 c0                	test   %al,%al
+  800d0f:	75 ed                	jne    800cfe <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d11:	0f b6 c0             	movzbl %al,%eax
+  800d14:	0f b6 16             	movzbl (%rsi),%edx
+  800d17:	29 d0                	sub    %edx,%eax
+}
+  800d19:	c3                   	ret
+
+0000000000800d1a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d1a:	48 85 d2             	test   %rdx,%rdx
+  800d1d:	74 1f                	je     800d3e <strncmp+0x24>
+  800d1f:	0f b6 07             	movzbl (%rdi),%eax
+  800d22:	84 c0                	test   %al,%al
+  800d24:	74 1e                	je     800d44 <strncmp+0x2a>
+  800d26:	3a 06                	cmp    (%rsi),%al
+  800d28:	75 1a                	jne    800d44 <strncmp+0x2a>
+  800d2a:	48 83 c7 01          	add    $0x1,%rdi
+  800d2e:	48 83 c6 01          	add    $0x1,%rsi
+  800d32:	48 83 ea 01          	sub    $0x1,%rdx
+  800d36:	75 e7                	jne    800d1f <strncmp+0x5>
+
+    if (!n) return 0;
+  800d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3d:	c3                   	ret
+  800d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d43:	c3                   	ret
+  800d44:	48 85 d2             	test   %rdx,%rdx
+  800d47:	74 09                	je     800d52 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d49:	0f b6 07             	movzbl (%rdi),%eax
+  800d4c:	0f b6 16             	movzbl (%rsi),%edx
+  800d4f:	29 d0                	sub    %edx,%eax
+  800d51:	c3                   	ret
+    if (!n) return 0;
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d57:	c3                   	ret
+
+0000000000800d58 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d58:	0f b6 17             	movzbl (%rdi),%edx
+  800d5b:	84 d2                	test   %dl,%dl
+  800d5d:	74 18                	je     800d77 <strchr+0x1f>
+        if (*str == c) {
+  800d5f:	0f be d2             	movsbl %dl,%edx
+  800d62:	39 f2                	cmp    %esi,%edx
+  800d64:	74 17                	je     800d7d <strchr+0x25>
+    for (; *str; str++) {
+  800d66:	48 83 c7 01          	add    $0x1,%rdi
+  800d6a:	0f b6 17             	movzbl (%rdi),%edx
+  800d6d:	84 d2                	test   %dl,%dl
+  800d6f:	75 ee                	jne    800d5f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	c3                   	ret
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7c:	c3                   	ret
+  800d7d:	48 89 f8             	mov    %rdi,%rax
+}
+  800d80:	c3                   	ret
+
+0000000000800d81 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d81:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d84:	0f b6 17             	movzbl (%rdi),%edx
+  800d87:	84 d2                	test   %dl,%dl
+  800d89:	74 13                	je     800d9e <strfind+0x1d>
+  800d8b:	0f be d2             	movsbl %dl,%edx
+  800d8e:	39 f2                	cmp    %esi,%edx
+  800d90:	74 0b                	je     800d9d <strfind+0x1c>
+  800d92:	48 83 c0 01          	add    $0x1,%rax
+  800d96:	0f b6 10             	movzbl (%rax),%edx
+  800d99:	84 d2                	test   %dl,%dl
+  800d9b:	75 ee                	jne    800d8b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d9d:	c3                   	ret
+  800d9e:	c3                   	ret
+
+0000000000800d9f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d9f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800da2:	48 89 f8             	mov    %rdi,%rax
+  800da5:	48 f7 d8             	neg    %rax
+  800da8:	83 e0 07             	and    $0x7,%eax
+  800dab:	49 89 d1             	mov    %rdx,%r9
+  800dae:	49 29 c1             	sub    %rax,%r9
+  800db1:	78 36                	js     800de9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800db3:	40 0f b6 c6          	movzbl %sil,%eax
+  800db7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dbe:	01 01 01 
+  800dc1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dc5:	40 f6 c7 07          	test   $0x7,%dil
+  800dc9:	75 38                	jne    800e03 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dcb:	4c 89 c9             	mov    %r9,%rcx
+  800dce:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dd2:	74 0c                	je     800de0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dd4:	fc                   	cld
+  800dd5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dd8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ddc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800de0:	4d 85 c9             	test   %r9,%r9
+  800de3:	75 45                	jne    800e2a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800de5:	4c 89 c0             	mov    %r8,%rax
+  800de8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800de9:	48 85 d2             	test   %rdx,%rdx
+  800dec:	74 f7                	je     800de5 <memset+0x46>
+  800dee:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800df1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800df4:	48 83 c0 01          	add    $0x1,%rax
+  800df8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dfc:	48 39 c2             	cmp    %rax,%rdx
+  800dff:	75 f3                	jne    800df4 <memset+0x55>
+  800e01:	eb e2                	jmp    800de5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e03:	40 f6 c7 01          	test   $0x1,%dil
+  800e07:	74 06                	je     800e0f <memset+0x70>
+  800e09:	88 07                	mov    %al,(%rdi)
+  800e0b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e0f:	40 f6 c7 02          	test   $0x2,%dil
+  800e13:	74 07                	je     800e1c <memset+0x7d>
+  800e15:	66 89 07             	mov    %ax,(%rdi)
+  800e18:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e1c:	40 f6 c7 04          	test   $0x4,%dil
+  800e20:	74 a9                	je     800dcb <memset+0x2c>
+  800e22:	89 07                	mov    %eax,(%rdi)
+  800e24:	48 83 c7 04          	add    $0x4,%rdi
+  800e28:	eb a1                	jmp    800dcb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e2a:	41 f6 c1 04          	test   $0x4,%r9b
+  800e2e:	74 06                	je     800e36 <memset+0x97>
+  800e30:	89 07                	mov    %eax,(%rdi)
+  800e32:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e36:	41 f6 c1 02          	test   $0x2,%r9b
+  800e3a:	74 07                	je     800e43 <memset+0xa4>
+  800e3c:	66 89 07             	mov    %ax,(%rdi)
+  800e3f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e43:	41 f6 c1 01          	test   $0x1,%r9b
+  800e47:	74 9c                	je     800de5 <memset+0x46>
+  800e49:	88 07                	mov    %al,(%rdi)
+  800e4b:	eb 98                	jmp    800de5 <memset+0x46>
+
+0000000000800e4d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e4d:	48 89 f8             	mov    %rdi,%rax
+  800e50:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e53:	48 39 fe             	cmp    %rdi,%rsi
+  800e56:	73 3b                	jae    800e93 <memmove+0x46>
+  800e58:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e5c:	48 39 d7             	cmp    %rdx,%rdi
+  800e5f:	73 32                	jae    800e93 <memmove+0x46>
+        s += n;
+        d += n;
+  800e61:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e65:	48 89 d6             	mov    %rdx,%rsi
+  800e68:	48 09 fe             	or     %rdi,%rsi
+  800e6b:	48 09 ce             	or     %rcx,%rsi
+  800e6e:	40 f6 c6 07          	test   $0x7,%sil
+  800e72:	75 12                	jne    800e86 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e74:	48 83 ef 08          	sub    $0x8,%rdi
+  800e78:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e7c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e80:	fd                   	std
+  800e81:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e84:	fc                   	cld
+  800e85:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e86:	48 83 ef 01          	sub    $0x1,%rdi
+  800e8a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e8e:	fd                   	std
+  800e8f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e91:	eb f1                	jmp    800e84 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e93:	48 89 f2             	mov    %rsi,%rdx
+  800e96:	48 09 c2             	or     %rax,%rdx
+  800e99:	48 09 ca             	or     %rcx,%rdx
+  800e9c:	f6 c2 07             	test   $0x7,%dl
+  800e9f:	75 0c                	jne    800ead <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ea1:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea5:	48 89 c7             	mov    %rax,%rdi
+  800ea8:	fc                   	cld
+  800ea9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800eac:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ead:	48 89 c7             	mov    %rax,%rdi
+  800eb0:	fc                   	cld
+  800eb1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eb3:	c3                   	ret
+
+0000000000800eb4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eb4:	55                   	push   %rbp
+  800eb5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eb8:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  800ebf:	00 00 00 
+  800ec2:	ff d0                	call   *%rax
+}
+  800ec4:	5d                   	pop    %rbp
+  800ec5:	c3                   	ret
+
+0000000000800ec6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ec6:	55                   	push   %rbp
+  800ec7:	48 89 e5             	mov    %rsp,%rbp
+  800eca:	41 57                	push   %r15
+  800ecc:	41 56                	push   %r14
+  800ece:	41 55                	push   %r13
+  800ed0:	41 54                	push   %r12
+  800ed2:	53                   	push   %rbx
+  800ed3:	48 83 ec 08          	sub    $0x8,%rsp
+  800ed7:	49 89 fe             	mov    %rdi,%r14
+  800eda:	49 89 f7             	mov    %rsi,%r15
+  800edd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ee0:	48 89 f7             	mov    %rsi,%rdi
+  800ee3:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  800eea:	00 00 00 
+  800eed:	ff d0                	call   *%rax
+  800eef:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ef2:	48 89 de             	mov    %rbx,%rsi
+  800ef5:	4c 89 f7             	mov    %r14,%rdi
+  800ef8:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  800f04:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f07:	48 39 c3             	cmp    %rax,%rbx
+  800f0a:	74 36                	je     800f42 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f0c:	48 89 d8             	mov    %rbx,%rax
+  800f0f:	4c 29 e8             	sub    %r13,%rax
+  800f12:	49 39 c4             	cmp    %rax,%r12
+  800f15:	73 31                	jae    800f48 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f17:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f1c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f20:	4c 89 fe             	mov    %r15,%rsi
+  800f23:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f2f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f33:	48 83 c4 08          	add    $0x8,%rsp
+  800f37:	5b                   	pop    %rbx
+  800f38:	41 5c                	pop    %r12
+  800f3a:	41 5d                	pop    %r13
+  800f3c:	41 5e                	pop    %r14
+  800f3e:	41 5f                	pop    %r15
+  800f40:	5d                   	pop    %rbp
+  800f41:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f42:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f46:	eb eb                	jmp    800f33 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f48:	48 83 eb 01          	sub    $0x1,%rbx
+  800f4c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f50:	48 89 da             	mov    %rbx,%rdx
+  800f53:	4c 89 fe             	mov    %r15,%rsi
+  800f56:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  800f5d:	00 00 00 
+  800f60:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f62:	49 01 de             	add    %rbx,%r14
+  800f65:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f6a:	eb c3                	jmp    800f2f <strlcat+0x69>
+
+0000000000800f6c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f6c:	48 85 d2             	test   %rdx,%rdx
+  800f6f:	74 2d                	je     800f9e <memcmp+0x32>
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f76:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f7a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f7f:	44 38 c1             	cmp    %r8b,%cl
+  800f82:	75 0f                	jne    800f93 <memcmp+0x27>
+    while (n-- > 0) {
+  800f84:	48 83 c0 01          	add    $0x1,%rax
+  800f88:	48 39 c2             	cmp    %rax,%rdx
+  800f8b:	75 e9                	jne    800f76 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f92:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f93:	0f b6 c1             	movzbl %cl,%eax
+  800f96:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f9a:	44 29 c0             	sub    %r8d,%eax
+  800f9d:	c3                   	ret
+    return 0;
+  800f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fa4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fa8:	48 39 c7             	cmp    %rax,%rdi
+  800fab:	73 0f                	jae    800fbc <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fad:	40 38 37             	cmp    %sil,(%rdi)
+  800fb0:	74 0e                	je     800fc0 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fb2:	48 83 c7 01          	add    $0x1,%rdi
+  800fb6:	48 39 f8             	cmp    %rdi,%rax
+  800fb9:	75 f2                	jne    800fad <memfind+0x9>
+  800fbb:	c3                   	ret
+  800fbc:	48 89 f8             	mov    %rdi,%rax
+  800fbf:	c3                   	ret
+  800fc0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fc4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fc7:	0f b6 37             	movzbl (%rdi),%esi
+  800fca:	40 80 fe 20          	cmp    $0x20,%sil
+  800fce:	74 06                	je     800fd6 <strtol+0x12>
+  800fd0:	40 80 fe 09          	cmp    $0x9,%sil
+  800fd4:	75 13                	jne    800fe9 <strtol+0x25>
+  800fd6:	48 83 c7 01          	add    $0x1,%rdi
+  800fda:	0f b6 37             	movzbl (%rdi),%esi
+  800fdd:	40 80 fe 20          	cmp    $0x20,%sil
+  800fe1:	74 f3                	je     800fd6 <strtol+0x12>
+  800fe3:	40 80 fe 09          	cmp    $0x9,%sil
+  800fe7:	74 ed                	je     800fd6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fe9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fec:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fef:	3c 01                	cmp    $0x1,%al
+  800ff1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ffb:	75 0f                	jne    80100c <strtol+0x48>
+  800ffd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801000:	74 14                	je     801016 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801002:	85 d2                	test   %edx,%edx
+  801004:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801009:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80100c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801011:	4c 63 ca             	movslq %edx,%r9
+  801014:	eb 36                	jmp    80104c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801016:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80101a:	74 0f                	je     80102b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80101c:	85 d2                	test   %edx,%edx
+  80101e:	75 ec                	jne    80100c <strtol+0x48>
+        s++;
+  801020:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801024:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801029:	eb e1                	jmp    80100c <strtol+0x48>
+        s += 2;
+  80102b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80102f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801034:	eb d6                	jmp    80100c <strtol+0x48>
+            dig -= '0';
+  801036:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801039:	44 0f b6 c1          	movzbl %cl,%r8d
+  80103d:	41 39 d0             	cmp    %edx,%r8d
+  801040:	7d 21                	jge    801063 <strtol+0x9f>
+        val = val * base + dig;
+  801042:	49 0f af c1          	imul   %r9,%rax
+  801046:	0f b6 c9             	movzbl %cl,%ecx
+  801049:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80104c:	48 83 c7 01          	add    $0x1,%rdi
+  801050:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801054:	80 f9 39             	cmp    $0x39,%cl
+  801057:	76 dd                	jbe    801036 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801059:	80 f9 7b             	cmp    $0x7b,%cl
+  80105c:	77 05                	ja     801063 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80105e:	83 e9 57             	sub    $0x57,%ecx
+  801061:	eb d6                	jmp    801039 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801063:	4d 85 d2             	test   %r10,%r10
+  801066:	74 03                	je     80106b <strtol+0xa7>
+  801068:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80106b:	48 89 c2             	mov    %rax,%rdx
+  80106e:	48 f7 da             	neg    %rdx
+  801071:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801075:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801079:	c3                   	ret
+
+000000000080107a <strrev>:
+
+void
+strrev(char *str)
+{
+  80107a:	55                   	push   %rbp
+  80107b:	48 89 e5             	mov    %rsp,%rbp
+  80107e:	53                   	push   %rbx
+  80107f:	48 83 ec 08          	sub    $0x8,%rsp
+  801083:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801086:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  80108d:	00 00 00 
+  801090:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801092:	83 e8 01             	sub    $0x1,%eax
+  801095:	85 c0                	test   %eax,%eax
+  801097:	7e 22                	jle    8010bb <strrev+0x41>
+  801099:	48 98                	cltq
+  80109b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010a0:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010a4:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010a8:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010ac:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010af:	48 83 c2 01          	add    $0x1,%rdx
+  8010b3:	48 83 e8 01          	sub    $0x1,%rax
+  8010b7:	39 c2                	cmp    %eax,%edx
+  8010b9:	7c e5                	jl     8010a0 <strrev+0x26>
+	}
+}
+  8010bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010bf:	c9                   	leave
+  8010c0:	c3                   	ret
+
+00000000008010c1 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8010c1:	85 d2                	test   %edx,%edx
+  8010c3:	0f 84 80 00 00 00    	je     801149 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8010c9:	55                   	push   %rbp
+  8010ca:	48 89 e5             	mov    %rsp,%rbp
+  8010cd:	53                   	push   %rbx
+  8010ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8010d2:	49 89 f2             	mov    %rsi,%r10
+  8010d5:	41 89 d3             	mov    %edx,%r11d
+  8010d8:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8010db:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8010e0:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8010e3:	eb 20                	jmp    801105 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8010e5:	41 89 f1             	mov    %esi,%r9d
+  8010e8:	83 c2 30             	add    $0x30,%edx
+  8010eb:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8010ee:	89 f8                	mov    %edi,%eax
+  8010f0:	99                   	cltd
+  8010f1:	f7 f9                	idiv   %ecx
+  8010f3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	74 2e                	je     801127 <itoa+0x66>
+  8010f9:	83 c6 01             	add    $0x1,%esi
+  8010fc:	49 83 c0 01          	add    $0x1,%r8
+  801100:	44 39 cb             	cmp    %r9d,%ebx
+  801103:	7e 15                	jle    80111a <itoa+0x59>
+		digit = sum % base;
+  801105:	89 f8                	mov    %edi,%eax
+  801107:	99                   	cltd
+  801108:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80110a:	83 fa 09             	cmp    $0x9,%edx
+  80110d:	7e d6                	jle    8010e5 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80110f:	41 89 f1             	mov    %esi,%r9d
+  801112:	83 c2 37             	add    $0x37,%edx
+  801115:	41 88 10             	mov    %dl,(%r8)
+  801118:	eb d4                	jmp    8010ee <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80111a:	41 83 eb 01          	sub    $0x1,%r11d
+  80111e:	45 39 cb             	cmp    %r9d,%r11d
+  801121:	75 04                	jne    801127 <itoa+0x66>
+  801123:	85 c0                	test   %eax,%eax
+  801125:	75 28                	jne    80114f <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801127:	4d 63 c9             	movslq %r9d,%r9
+  80112a:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80112f:	4c 89 d7             	mov    %r10,%rdi
+  801132:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+	return 0;
+  80113e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801143:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801147:	c9                   	leave
+  801148:	c3                   	ret
+		return -1;
+  801149:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80114e:	c3                   	ret
+		return -1;
+  80114f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801154:	eb ed                	jmp    801143 <itoa+0x82>
+
+0000000000801156 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801156:	55                   	push   %rbp
+  801157:	48 89 e5             	mov    %rsp,%rbp
+  80115a:	53                   	push   %rbx
+  80115b:	48 89 fa             	mov    %rdi,%rdx
+  80115e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801161:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+  801175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80117d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801181:	c9                   	leave
+  801182:	c3                   	ret
+
+0000000000801183 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801183:	55                   	push   %rbp
+  801184:	48 89 e5             	mov    %rsp,%rbp
+  801187:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801188:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801192:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ac:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b2:	c9                   	leave
+  8011b3:	c3                   	ret
+
+00000000008011b4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011b4:	55                   	push   %rbp
+  8011b5:	48 89 e5             	mov    %rsp,%rbp
+  8011b8:	53                   	push   %rbx
+  8011b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e1:	48 85 c0             	test   %rax,%rax
+  8011e4:	7f 06                	jg     8011ec <sys_env_destroy+0x38>
+}
+  8011e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ec:	49 89 c0             	mov    %rax,%r8
+  8011ef:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011f4:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  8011fb:	00 00 00 
+  8011fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801203:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  80120a:	00 00 00 
+  80120d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801212:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  801219:	00 00 00 
+  80121c:	41 ff d1             	call   *%r9
+
+000000000080121f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80121f:	55                   	push   %rbp
+  801220:	48 89 e5             	mov    %rsp,%rbp
+  801223:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801224:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_yield>:
+
+void
+sys_yield(void) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801255:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80125a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801269:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126e:	be 00 00 00 00       	mov    $0x0,%esi
+  801273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801279:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80127b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+0000000000801281 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	53                   	push   %rbx
+  801286:	48 89 fa             	mov    %rdi,%rdx
+  801289:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80128c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801291:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801298:	00 00 00 
+  80129b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ab:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b1:	c9                   	leave
+  8012b2:	c3                   	ret
+
+00000000008012b3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012b3:	55                   	push   %rbp
+  8012b4:	48 89 e5             	mov    %rsp,%rbp
+  8012b7:	53                   	push   %rbx
+  8012b8:	49 89 f8             	mov    %rdi,%r8
+  8012bb:	48 89 d3             	mov    %rdx,%rbx
+  8012be:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012c1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c6:	4c 89 c2             	mov    %r8,%rdx
+  8012c9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+
+00000000008012df <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012df:	55                   	push   %rbp
+  8012e0:	48 89 e5             	mov    %rsp,%rbp
+  8012e3:	53                   	push   %rbx
+  8012e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e8:	89 f8                	mov    %edi,%eax
+  8012ea:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ed:	48 63 f9             	movslq %ecx,%rdi
+  8012f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801300:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801306:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801308:	48 85 c0             	test   %rax,%rax
+  80130b:	7f 06                	jg     801313 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80130d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801311:	c9                   	leave
+  801312:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801313:	49 89 c0             	mov    %rax,%r8
+  801316:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80131b:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  801322:	00 00 00 
+  801325:	be 26 00 00 00       	mov    $0x26,%esi
+  80132a:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  801331:	00 00 00 
+  801334:	b8 00 00 00 00       	mov    $0x0,%eax
+  801339:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  801340:	00 00 00 
+  801343:	41 ff d1             	call   *%r9
+
+0000000000801346 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801346:	55                   	push   %rbp
+  801347:	48 89 e5             	mov    %rsp,%rbp
+  80134a:	53                   	push   %rbx
+  80134b:	48 83 ec 08          	sub    $0x8,%rsp
+  80134f:	89 f8                	mov    %edi,%eax
+  801351:	49 89 f2             	mov    %rsi,%r10
+  801354:	48 89 cf             	mov    %rcx,%rdi
+  801357:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80135a:	48 63 da             	movslq %edx,%rbx
+  80135d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801360:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801365:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801368:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80136b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136d:	48 85 c0             	test   %rax,%rax
+  801370:	7f 06                	jg     801378 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801372:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801376:	c9                   	leave
+  801377:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801378:	49 89 c0             	mov    %rax,%r8
+  80137b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801380:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  801387:	00 00 00 
+  80138a:	be 26 00 00 00       	mov    $0x26,%esi
+  80138f:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  801396:	00 00 00 
+  801399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139e:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  8013a5:	00 00 00 
+  8013a8:	41 ff d1             	call   *%r9
+
+00000000008013ab <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013ab:	55                   	push   %rbp
+  8013ac:	48 89 e5             	mov    %rsp,%rbp
+  8013af:	53                   	push   %rbx
+  8013b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b4:	48 89 f1             	mov    %rsi,%rcx
+  8013b7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d4:	48 85 c0             	test   %rax,%rax
+  8013d7:	7f 06                	jg     8013df <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013dd:	c9                   	leave
+  8013de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013df:	49 89 c0             	mov    %rax,%r8
+  8013e2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013e7:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  8013ee:	00 00 00 
+  8013f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f6:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  8013fd:	00 00 00 
+  801400:	b8 00 00 00 00       	mov    $0x0,%eax
+  801405:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  80140c:	00 00 00 
+  80140f:	41 ff d1             	call   *%r9
+
+0000000000801412 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801412:	55                   	push   %rbp
+  801413:	48 89 e5             	mov    %rsp,%rbp
+  801416:	53                   	push   %rbx
+  801417:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80141b:	48 63 ce             	movslq %esi,%rcx
+  80141e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801421:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801426:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143d:	48 85 c0             	test   %rax,%rax
+  801440:	7f 06                	jg     801448 <sys_env_set_status+0x36>
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801448:	49 89 c0             	mov    %rax,%r8
+  80144b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801450:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  801457:	00 00 00 
+  80145a:	be 26 00 00 00       	mov    $0x26,%esi
+  80145f:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  801466:	00 00 00 
+  801469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146e:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  801475:	00 00 00 
+  801478:	41 ff d1             	call   *%r9
+
+000000000080147b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+  80147f:	53                   	push   %rbx
+  801480:	48 83 ec 08          	sub    $0x8,%rsp
+  801484:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801487:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801494:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801499:	be 00 00 00 00       	mov    $0x0,%esi
+  80149e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a6:	48 85 c0             	test   %rax,%rax
+  8014a9:	7f 06                	jg     8014b1 <sys_env_set_trapframe+0x36>
+}
+  8014ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b1:	49 89 c0             	mov    %rax,%r8
+  8014b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014b9:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  8014c0:	00 00 00 
+  8014c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c8:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  8014cf:	00 00 00 
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d7:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  8014de:	00 00 00 
+  8014e1:	41 ff d1             	call   *%r9
+
+00000000008014e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014e4:	55                   	push   %rbp
+  8014e5:	48 89 e5             	mov    %rsp,%rbp
+  8014e8:	53                   	push   %rbx
+  8014e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ed:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801502:	be 00 00 00 00       	mov    $0x0,%esi
+  801507:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150f:	48 85 c0             	test   %rax,%rax
+  801512:	7f 06                	jg     80151a <sys_env_set_pgfault_upcall+0x36>
+}
+  801514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801518:	c9                   	leave
+  801519:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151a:	49 89 c0             	mov    %rax,%r8
+  80151d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801522:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  801529:	00 00 00 
+  80152c:	be 26 00 00 00       	mov    $0x26,%esi
+  801531:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  801538:	00 00 00 
+  80153b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801540:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  801547:	00 00 00 
+  80154a:	41 ff d1             	call   *%r9
+
+000000000080154d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	53                   	push   %rbx
+  801552:	89 f8                	mov    %edi,%eax
+  801554:	49 89 f1             	mov    %rsi,%r9
+  801557:	48 89 d3             	mov    %rdx,%rbx
+  80155a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80155d:	49 63 f0             	movslq %r8d,%rsi
+  801560:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801563:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801568:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801571:	cd 30                	int    $0x30
+}
+  801573:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+
+0000000000801579 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801579:	55                   	push   %rbp
+  80157a:	48 89 e5             	mov    %rsp,%rbp
+  80157d:	53                   	push   %rbx
+  80157e:	48 83 ec 08          	sub    $0x8,%rsp
+  801582:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801585:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801588:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80158d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801590:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801595:	be 00 00 00 00       	mov    $0x0,%esi
+  80159a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a2:	48 85 c0             	test   %rax,%rax
+  8015a5:	7f 06                	jg     8015ad <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ab:	c9                   	leave
+  8015ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ad:	49 89 c0             	mov    %rax,%r8
+  8015b0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015b5:	48 ba 08 40 80 00 00 	movabs $0x804008,%rdx
+  8015bc:	00 00 00 
+  8015bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c4:	48 bf 27 40 80 00 00 	movabs $0x804027,%rdi
+  8015cb:	00 00 00 
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d3:	49 b9 de 01 80 00 00 	movabs $0x8001de,%r9
+  8015da:	00 00 00 
+  8015dd:	41 ff d1             	call   *%r9
+
+00000000008015e0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8015e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e9:	48 b8 79 15 80 00 00 	movabs $0x801579,%rax
+  8015f0:	00 00 00 
+  8015f3:	ff d0                	call   *%rax
+}
+  8015f5:	5d                   	pop    %rbp
+  8015f6:	c3                   	ret
+
+00000000008015f7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801601:	ba 00 00 00 00       	mov    $0x0,%edx
+  801606:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801610:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801615:	be 00 00 00 00       	mov    $0x0,%esi
+  80161a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801620:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801622:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+0000000000801628 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801628:	55                   	push   %rbp
+  801629:	48 89 e5             	mov    %rsp,%rbp
+  80162c:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80162d:	48 63 ce             	movslq %esi,%rcx
+  801630:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801634:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801643:	be 00 00 00 00       	mov    $0x0,%esi
+  801648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164e:	cd 30                	int    $0x30
+}
+  801650:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+
+0000000000801656 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801656:	55                   	push   %rbp
+  801657:	48 89 e5             	mov    %rsp,%rbp
+  80165a:	53                   	push   %rbx
+  80165b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80165e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801662:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801667:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801671:	be 00 00 00 00       	mov    $0x0,%esi
+  801676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167c:	cd 30                	int    $0x30
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+
+0000000000801684 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+  801688:	53                   	push   %rbx
+  801689:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80168c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80168f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801694:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801697:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169c:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a7:	cd 30                	int    $0x30
+}
+  8016a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+
+00000000008016af <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+  8016b3:	41 56                	push   %r14
+  8016b5:	41 55                	push   %r13
+  8016b7:	41 54                	push   %r12
+  8016b9:	53                   	push   %rbx
+  8016ba:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016bd:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  8016c4:	00 00 00 
+  8016c7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8016cb:	74 27                	je     8016f4 <_handle_vectored_pagefault+0x45>
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8016d2:	49 bd 20 60 80 00 00 	movabs $0x806020,%r13
+  8016d9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016dc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8016df:	4c 89 e7             	mov    %r12,%rdi
+  8016e2:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8016e7:	84 c0                	test   %al,%al
+  8016e9:	75 45                	jne    801730 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016eb:	48 83 c3 01          	add    $0x1,%rbx
+  8016ef:	49 3b 1e             	cmp    (%r14),%rbx
+  8016f2:	72 eb                	jb     8016df <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8016f4:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8016fb:	00 
+  8016fc:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801701:	4d 8b 04 24          	mov    (%r12),%r8
+  801705:	48 ba 38 40 80 00 00 	movabs $0x804038,%rdx
+  80170c:	00 00 00 
+  80170f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801714:	48 bf 68 40 80 00 00 	movabs $0x804068,%rdi
+  80171b:	00 00 00 
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	49 ba de 01 80 00 00 	movabs $0x8001de,%r10
+  80172a:	00 00 00 
+  80172d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801730:	5b                   	pop    %rbx
+  801731:	41 5c                	pop    %r12
+  801733:	41 5d                	pop    %r13
+  801735:	41 5e                	pop    %r14
+  801737:	5d                   	pop    %rbp
+  801738:	c3                   	ret
+
+0000000000801739 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	53                   	push   %rbx
+  80173e:	48 83 ec 08          	sub    $0x8,%rsp
+  801742:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801745:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80174c:	00 00 00 
+  80174f:	80 38 00             	cmpb   $0x0,(%rax)
+  801752:	0f 84 84 00 00 00    	je     8017dc <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801758:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  80175f:	00 00 00 
+  801762:	48 8b 10             	mov    (%rax),%rdx
+  801765:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80176a:	48 b9 20 60 80 00 00 	movabs $0x806020,%rcx
+  801771:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801774:	48 85 d2             	test   %rdx,%rdx
+  801777:	74 19                	je     801792 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801779:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80177d:	0f 84 e8 00 00 00    	je     80186b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801783:	48 83 c0 01          	add    $0x1,%rax
+  801787:	48 39 d0             	cmp    %rdx,%rax
+  80178a:	75 ed                	jne    801779 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80178c:	48 83 fa 08          	cmp    $0x8,%rdx
+  801790:	74 1c                	je     8017ae <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801792:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801796:	48 a3 68 60 80 00 00 	movabs %rax,0x806068
+  80179d:	00 00 00 
+  8017a0:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8017a7:	00 00 00 
+  8017aa:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8017ae:	48 b8 1f 12 80 00 00 	movabs $0x80121f,%rax
+  8017b5:	00 00 00 
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	89 c7                	mov    %eax,%edi
+  8017bc:	48 be 31 19 80 00 00 	movabs $0x801931,%rsi
+  8017c3:	00 00 00 
+  8017c6:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8017d2:	85 c0                	test   %eax,%eax
+  8017d4:	78 68                	js     80183e <add_pgfault_handler+0x105>
+    return res;
+}
+  8017d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8017dc:	48 b8 1f 12 80 00 00 	movabs $0x80121f,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+  8017e8:	89 c7                	mov    %eax,%edi
+  8017ea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8017ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017f4:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8017fb:	00 00 00 
+  8017fe:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80180a:	48 ba 68 60 80 00 00 	movabs $0x806068,%rdx
+  801811:	00 00 00 
+  801814:	48 8b 02             	mov    (%rdx),%rax
+  801817:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80181b:	48 89 0a             	mov    %rcx,(%rdx)
+  80181e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801825:	00 00 00 
+  801828:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80182c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801833:	00 00 00 
+  801836:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  801839:	e9 70 ff ff ff       	jmp    8017ae <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80183e:	89 c1                	mov    %eax,%ecx
+  801840:	48 ba 76 40 80 00 00 	movabs $0x804076,%rdx
+  801847:	00 00 00 
+  80184a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80184f:	48 bf 68 40 80 00 00 	movabs $0x804068,%rdi
+  801856:	00 00 00 
+  801859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185e:	49 b8 de 01 80 00 00 	movabs $0x8001de,%r8
+  801865:	00 00 00 
+  801868:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80186b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801870:	e9 61 ff ff ff       	jmp    8017d6 <add_pgfault_handler+0x9d>
+
+0000000000801875 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801875:	55                   	push   %rbp
+  801876:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801879:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801880:	00 00 00 
+  801883:	80 38 00             	cmpb   $0x0,(%rax)
+  801886:	74 33                	je     8018bb <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801888:	48 a1 68 60 80 00 00 	movabs 0x806068,%rax
+  80188f:	00 00 00 
+  801892:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801897:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80189e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018a1:	48 85 c0             	test   %rax,%rax
+  8018a4:	0f 84 85 00 00 00    	je     80192f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8018aa:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8018ae:	74 40                	je     8018f0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018b0:	48 83 c1 01          	add    $0x1,%rcx
+  8018b4:	48 39 c1             	cmp    %rax,%rcx
+  8018b7:	75 f1                	jne    8018aa <remove_pgfault_handler+0x35>
+  8018b9:	eb 74                	jmp    80192f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8018bb:	48 b9 8e 40 80 00 00 	movabs $0x80408e,%rcx
+  8018c2:	00 00 00 
+  8018c5:	48 ba a8 40 80 00 00 	movabs $0x8040a8,%rdx
+  8018cc:	00 00 00 
+  8018cf:	be 43 00 00 00       	mov    $0x43,%esi
+  8018d4:	48 bf 68 40 80 00 00 	movabs $0x804068,%rdi
+  8018db:	00 00 00 
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	49 b8 de 01 80 00 00 	movabs $0x8001de,%r8
+  8018ea:	00 00 00 
+  8018ed:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8018f0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8018f7:	00 
+  8018f8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018fc:	48 29 ca             	sub    %rcx,%rdx
+  8018ff:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801906:	00 00 00 
+  801909:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80190d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801912:	48 89 ce             	mov    %rcx,%rsi
+  801915:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  80191c:	00 00 00 
+  80191f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801921:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  801928:	00 00 00 
+  80192b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80192f:	5d                   	pop    %rbp
+  801930:	c3                   	ret
+
+0000000000801931 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801931:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801934:	48 b8 af 16 80 00 00 	movabs $0x8016af,%rax
+  80193b:	00 00 00 
+    call *%rax
+  80193e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    popq %r15
+  801940:	41 5f                	pop    %r15
+    popq %r15
+  801942:	41 5f                	pop    %r15
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+    popq %r15
+  801944:	41 5f                	pop    %r15
+    popq %r14
+  801946:	41 5e                	pop    %r14
+    popq %r13
+  801948:	41 5d                	pop    %r13
+    popq %r12
+  80194a:	41 5c                	pop    %r12
+    popq %r11
+  80194c:	41 5b                	pop    %r11
+    popq %r10
+  80194e:	41 5a                	pop    %r10
+    popq %r9
+  801950:	41 59                	pop    %r9
+    popq %r8
+  801952:	41 58                	pop    %r8
+    popq %rsi
+  801954:	5e                   	pop    %rsi
+    popq %rdi
+  801955:	5f                   	pop    %rdi
+    popq %rbp
+  801956:	5d                   	pop    %rbp
+    popq %rdx
+  801957:	5a                   	pop    %rdx
+    popq %rcx
+  801958:	59                   	pop    %rcx
+    movq 32(%rsp), %rbx
+  801959:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  80195e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801963:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801967:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80196a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+    popq %rbx
+  80196f:	5b                   	pop    %rbx
+    popq %rax
+  801970:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    pushq 8(%rsp)
+  801971:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801975:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    movq 16(%rsp), %rsp
+  801976:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+  80197b:	c3                   	ret
+
+000000000080197c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80197c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801983:	ff ff ff 
+  801986:	48 01 f8             	add    %rdi,%rax
+  801989:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80198d:	c3                   	ret
+
+000000000080198e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801995:	ff ff ff 
+  801998:	48 01 f8             	add    %rdi,%rax
+  80199b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80199f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019a5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019a9:	c3                   	ret
+
+00000000008019aa <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019aa:	55                   	push   %rbp
+  8019ab:	48 89 e5             	mov    %rsp,%rbp
+  8019ae:	41 57                	push   %r15
+  8019b0:	41 56                	push   %r14
+  8019b2:	41 55                	push   %r13
+  8019b4:	41 54                	push   %r12
+  8019b6:	53                   	push   %rbx
+  8019b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8019bb:	49 89 ff             	mov    %rdi,%r15
+  8019be:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019c3:	49 bd c9 34 80 00 00 	movabs $0x8034c9,%r13
+  8019ca:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019cd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019d3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019d6:	48 89 df             	mov    %rbx,%rdi
+  8019d9:	41 ff d5             	call   *%r13
+  8019dc:	83 e0 04             	and    $0x4,%eax
+  8019df:	74 17                	je     8019f8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019e8:	4c 39 f3             	cmp    %r14,%rbx
+  8019eb:	75 e6                	jne    8019d3 <fd_alloc+0x29>
+  8019ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019f3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019f8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019fb:	48 83 c4 08          	add    $0x8,%rsp
+  8019ff:	5b                   	pop    %rbx
+  801a00:	41 5c                	pop    %r12
+  801a02:	41 5d                	pop    %r13
+  801a04:	41 5e                	pop    %r14
+  801a06:	41 5f                	pop    %r15
+  801a08:	5d                   	pop    %rbp
+  801a09:	c3                   	ret
+
+0000000000801a0a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a0a:	83 ff 1f             	cmp    $0x1f,%edi
+  801a0d:	77 39                	ja     801a48 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a0f:	55                   	push   %rbp
+  801a10:	48 89 e5             	mov    %rsp,%rbp
+  801a13:	41 54                	push   %r12
+  801a15:	53                   	push   %rbx
+  801a16:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a19:	48 63 df             	movslq %edi,%rbx
+  801a1c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a23:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a27:	48 89 df             	mov    %rbx,%rdi
+  801a2a:	48 b8 c9 34 80 00 00 	movabs $0x8034c9,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+  801a36:	a8 04                	test   $0x4,%al
+  801a38:	74 14                	je     801a4e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a3a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a43:	5b                   	pop    %rbx
+  801a44:	41 5c                	pop    %r12
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+        return -E_INVAL;
+  801a48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a4d:	c3                   	ret
+        return -E_INVAL;
+  801a4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a53:	eb ee                	jmp    801a43 <fd_lookup+0x39>
+
+0000000000801a55 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a55:	55                   	push   %rbp
+  801a56:	48 89 e5             	mov    %rsp,%rbp
+  801a59:	41 54                	push   %r12
+  801a5b:	53                   	push   %rbx
+  801a5c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a5f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  801a66:	00 00 00 
+  801a69:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a70:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a73:	39 3b                	cmp    %edi,(%rbx)
+  801a75:	74 47                	je     801abe <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a77:	48 83 c0 08          	add    $0x8,%rax
+  801a7b:	48 8b 18             	mov    (%rax),%rbx
+  801a7e:	48 85 db             	test   %rbx,%rbx
+  801a81:	75 f0                	jne    801a73 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a83:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a8a:	00 00 00 
+  801a8d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a93:	89 fa                	mov    %edi,%edx
+  801a95:	48 bf c0 40 80 00 00 	movabs $0x8040c0,%rdi
+  801a9c:	00 00 00 
+  801a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa4:	48 b9 2e 03 80 00 00 	movabs $0x80032e,%rcx
+  801aab:	00 00 00 
+  801aae:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ab0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ab5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ab9:	5b                   	pop    %rbx
+  801aba:	41 5c                	pop    %r12
+  801abc:	5d                   	pop    %rbp
+  801abd:	c3                   	ret
+            return 0;
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac3:	eb f0                	jmp    801ab5 <dev_lookup+0x60>
+
+0000000000801ac5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	41 55                	push   %r13
+  801acb:	41 54                	push   %r12
+  801acd:	53                   	push   %rbx
+  801ace:	48 83 ec 18          	sub    $0x18,%rsp
+  801ad2:	48 89 fb             	mov    %rdi,%rbx
+  801ad5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ad8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801adf:	ff ff ff 
+  801ae2:	48 01 df             	add    %rbx,%rdi
+  801ae5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ae9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aed:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801af4:	00 00 00 
+  801af7:	ff d0                	call   *%rax
+  801af9:	41 89 c5             	mov    %eax,%r13d
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 06                	js     801b06 <fd_close+0x41>
+  801b00:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b04:	74 1a                	je     801b20 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b06:	45 84 e4             	test   %r12b,%r12b
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b12:	44 89 e8             	mov    %r13d,%eax
+  801b15:	48 83 c4 18          	add    $0x18,%rsp
+  801b19:	5b                   	pop    %rbx
+  801b1a:	41 5c                	pop    %r12
+  801b1c:	41 5d                	pop    %r13
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b20:	8b 3b                	mov    (%rbx),%edi
+  801b22:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b26:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+  801b32:	41 89 c5             	mov    %eax,%r13d
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 1b                	js     801b54 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b41:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b47:	48 85 c0             	test   %rax,%rax
+  801b4a:	74 08                	je     801b54 <fd_close+0x8f>
+  801b4c:	48 89 df             	mov    %rbx,%rdi
+  801b4f:	ff d0                	call   *%rax
+  801b51:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b59:	48 89 de             	mov    %rbx,%rsi
+  801b5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b61:	48 b8 ab 13 80 00 00 	movabs $0x8013ab,%rax
+  801b68:	00 00 00 
+  801b6b:	ff d0                	call   *%rax
+    return res;
+  801b6d:	eb a3                	jmp    801b12 <fd_close+0x4d>
+
+0000000000801b6f <close>:
+
+int
+close(int fdnum) {
+  801b6f:	55                   	push   %rbp
+  801b70:	48 89 e5             	mov    %rsp,%rbp
+  801b73:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b77:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b7b:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 15                	js     801ba0 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b8b:	be 01 00 00 00       	mov    $0x1,%esi
+  801b90:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b94:	48 b8 c5 1a 80 00 00 	movabs $0x801ac5,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+}
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+0000000000801ba2 <close_all>:
+
+void
+close_all(void) {
+  801ba2:	55                   	push   %rbp
+  801ba3:	48 89 e5             	mov    %rsp,%rbp
+  801ba6:	41 54                	push   %r12
+  801ba8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ba9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bae:	49 bc 6f 1b 80 00 00 	movabs $0x801b6f,%r12
+  801bb5:	00 00 00 
+  801bb8:	89 df                	mov    %ebx,%edi
+  801bba:	41 ff d4             	call   *%r12
+  801bbd:	83 c3 01             	add    $0x1,%ebx
+  801bc0:	83 fb 20             	cmp    $0x20,%ebx
+  801bc3:	75 f3                	jne    801bb8 <close_all+0x16>
+}
+  801bc5:	5b                   	pop    %rbx
+  801bc6:	41 5c                	pop    %r12
+  801bc8:	5d                   	pop    %rbp
+  801bc9:	c3                   	ret
+
+0000000000801bca <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+  801bce:	41 57                	push   %r15
+  801bd0:	41 56                	push   %r14
+  801bd2:	41 55                	push   %r13
+  801bd4:	41 54                	push   %r12
+  801bd6:	53                   	push   %rbx
+  801bd7:	48 83 ec 18          	sub    $0x18,%rsp
+  801bdb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bde:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801be2:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+  801bee:	89 c3                	mov    %eax,%ebx
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	0f 88 b8 00 00 00    	js     801cb0 <dup+0xe6>
+    close(newfdnum);
+  801bf8:	44 89 e7             	mov    %r12d,%edi
+  801bfb:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c07:	4d 63 ec             	movslq %r12d,%r13
+  801c0a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c11:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c15:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c19:	4c 89 ff             	mov    %r15,%rdi
+  801c1c:	49 be 8e 19 80 00 00 	movabs $0x80198e,%r14
+  801c23:	00 00 00 
+  801c26:	41 ff d6             	call   *%r14
+  801c29:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c2c:	4c 89 ef             	mov    %r13,%rdi
+  801c2f:	41 ff d6             	call   *%r14
+  801c32:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c35:	48 89 df             	mov    %rbx,%rdi
+  801c38:	48 b8 c9 34 80 00 00 	movabs $0x8034c9,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c44:	a8 04                	test   $0x4,%al
+  801c46:	74 2b                	je     801c73 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c48:	41 89 c1             	mov    %eax,%r9d
+  801c4b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c51:	4c 89 f1             	mov    %r14,%rcx
+  801c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c59:	48 89 de             	mov    %rbx,%rsi
+  801c5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c61:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  801c68:	00 00 00 
+  801c6b:	ff d0                	call   *%rax
+  801c6d:	89 c3                	mov    %eax,%ebx
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 4e                	js     801cc1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c73:	4c 89 ff             	mov    %r15,%rdi
+  801c76:	48 b8 c9 34 80 00 00 	movabs $0x8034c9,%rax
+  801c7d:	00 00 00 
+  801c80:	ff d0                	call   *%rax
+  801c82:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c85:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c8b:	4c 89 e9             	mov    %r13,%rcx
+  801c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c93:	4c 89 fe             	mov    %r15,%rsi
+  801c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9b:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+  801ca7:	89 c3                	mov    %eax,%ebx
+  801ca9:	85 c0                	test   %eax,%eax
+  801cab:	78 14                	js     801cc1 <dup+0xf7>
+
+    return newfdnum;
+  801cad:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cb0:	89 d8                	mov    %ebx,%eax
+  801cb2:	48 83 c4 18          	add    $0x18,%rsp
+  801cb6:	5b                   	pop    %rbx
+  801cb7:	41 5c                	pop    %r12
+  801cb9:	41 5d                	pop    %r13
+  801cbb:	41 5e                	pop    %r14
+  801cbd:	41 5f                	pop    %r15
+  801cbf:	5d                   	pop    %rbp
+  801cc0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cc6:	4c 89 ee             	mov    %r13,%rsi
+  801cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cce:	49 bc ab 13 80 00 00 	movabs $0x8013ab,%r12
+  801cd5:	00 00 00 
+  801cd8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce0:	4c 89 f6             	mov    %r14,%rsi
+  801ce3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce8:	41 ff d4             	call   *%r12
+    return res;
+  801ceb:	eb c3                	jmp    801cb0 <dup+0xe6>
+
+0000000000801ced <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ced:	55                   	push   %rbp
+  801cee:	48 89 e5             	mov    %rsp,%rbp
+  801cf1:	41 56                	push   %r14
+  801cf3:	41 55                	push   %r13
+  801cf5:	41 54                	push   %r12
+  801cf7:	53                   	push   %rbx
+  801cf8:	48 83 ec 10          	sub    $0x10,%rsp
+  801cfc:	89 fb                	mov    %edi,%ebx
+  801cfe:	49 89 f4             	mov    %rsi,%r12
+  801d01:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d08:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801d0f:	00 00 00 
+  801d12:	ff d0                	call   *%rax
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	78 4c                	js     801d64 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d18:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d1c:	41 8b 3e             	mov    (%r14),%edi
+  801d1f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d23:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 35                	js     801d68 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d33:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d37:	83 e0 03             	and    $0x3,%eax
+  801d3a:	83 f8 01             	cmp    $0x1,%eax
+  801d3d:	74 2d                	je     801d6c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d43:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d47:	48 85 c0             	test   %rax,%rax
+  801d4a:	74 56                	je     801da2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d4c:	4c 89 ea             	mov    %r13,%rdx
+  801d4f:	4c 89 e6             	mov    %r12,%rsi
+  801d52:	4c 89 f7             	mov    %r14,%rdi
+  801d55:	ff d0                	call   *%rax
+}
+  801d57:	48 83 c4 10          	add    $0x10,%rsp
+  801d5b:	5b                   	pop    %rbx
+  801d5c:	41 5c                	pop    %r12
+  801d5e:	41 5d                	pop    %r13
+  801d60:	41 5e                	pop    %r14
+  801d62:	5d                   	pop    %rbp
+  801d63:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d64:	48 98                	cltq
+  801d66:	eb ef                	jmp    801d57 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d68:	48 98                	cltq
+  801d6a:	eb eb                	jmp    801d57 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d6c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d73:	00 00 00 
+  801d76:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d7c:	89 da                	mov    %ebx,%edx
+  801d7e:	48 bf 21 41 80 00 00 	movabs $0x804121,%rdi
+  801d85:	00 00 00 
+  801d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8d:	48 b9 2e 03 80 00 00 	movabs $0x80032e,%rcx
+  801d94:	00 00 00 
+  801d97:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d99:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801da0:	eb b5                	jmp    801d57 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801da2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801da9:	eb ac                	jmp    801d57 <read+0x6a>
+
+0000000000801dab <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801dab:	55                   	push   %rbp
+  801dac:	48 89 e5             	mov    %rsp,%rbp
+  801daf:	41 56                	push   %r14
+  801db1:	41 55                	push   %r13
+  801db3:	41 54                	push   %r12
+  801db5:	53                   	push   %rbx
+  801db6:	48 83 ec 10          	sub    $0x10,%rsp
+  801dba:	89 fb                	mov    %edi,%ebx
+  801dbc:	49 89 f4             	mov    %rsi,%r12
+  801dbf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc6:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 41                	js     801e17 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dda:	41 8b 3e             	mov    (%r14),%edi
+  801ddd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801de1:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  801de8:	00 00 00 
+  801deb:	ff d0                	call   *%rax
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	78 35                	js     801e26 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801df1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801df5:	83 e0 03             	and    $0x3,%eax
+  801df8:	83 f8 01             	cmp    $0x1,%eax
+  801dfb:	74 2d                	je     801e2a <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801dfd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e01:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e05:	48 85 c0             	test   %rax,%rax
+  801e08:	74 56                	je     801e60 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e0a:	4c 89 ea             	mov    %r13,%rdx
+  801e0d:	4c 89 e6             	mov    %r12,%rsi
+  801e10:	4c 89 f7             	mov    %r14,%rdi
+  801e13:	ff d0                	call   *%rax
+  801e15:	eb 02                	jmp    801e19 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e17:	48 98                	cltq
+}
+  801e19:	48 83 c4 10          	add    $0x10,%rsp
+  801e1d:	5b                   	pop    %rbx
+  801e1e:	41 5c                	pop    %r12
+  801e20:	41 5d                	pop    %r13
+  801e22:	41 5e                	pop    %r14
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e26:	48 98                	cltq
+  801e28:	eb ef                	jmp    801e19 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e2a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e31:	00 00 00 
+  801e34:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e3a:	89 da                	mov    %ebx,%edx
+  801e3c:	48 bf e0 40 80 00 00 	movabs $0x8040e0,%rdi
+  801e43:	00 00 00 
+  801e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4b:	48 b9 2e 03 80 00 00 	movabs $0x80032e,%rcx
+  801e52:	00 00 00 
+  801e55:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e57:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e5e:	eb b9                	jmp    801e19 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e60:	4c 89 ea             	mov    %r13,%rdx
+  801e63:	4c 89 e6             	mov    %r12,%rsi
+  801e66:	89 df                	mov    %ebx,%edi
+  801e68:	48 b8 ed 1c 80 00 00 	movabs $0x801ced,%rax
+  801e6f:	00 00 00 
+  801e72:	ff d0                	call   *%rax
+  801e74:	eb a3                	jmp    801e19 <readmap+0x6e>
+
+0000000000801e76 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e76:	55                   	push   %rbp
+  801e77:	48 89 e5             	mov    %rsp,%rbp
+  801e7a:	41 57                	push   %r15
+  801e7c:	41 56                	push   %r14
+  801e7e:	41 55                	push   %r13
+  801e80:	41 54                	push   %r12
+  801e82:	53                   	push   %rbx
+  801e83:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e87:	48 85 d2             	test   %rdx,%rdx
+  801e8a:	74 54                	je     801ee0 <readn+0x6a>
+  801e8c:	41 89 fd             	mov    %edi,%r13d
+  801e8f:	49 89 f6             	mov    %rsi,%r14
+  801e92:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e95:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e9a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e9f:	49 bf ed 1c 80 00 00 	movabs $0x801ced,%r15
+  801ea6:	00 00 00 
+  801ea9:	4c 89 e2             	mov    %r12,%rdx
+  801eac:	48 29 f2             	sub    %rsi,%rdx
+  801eaf:	4c 01 f6             	add    %r14,%rsi
+  801eb2:	44 89 ef             	mov    %r13d,%edi
+  801eb5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	78 20                	js     801edc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ebc:	01 c3                	add    %eax,%ebx
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	74 08                	je     801eca <readn+0x54>
+  801ec2:	48 63 f3             	movslq %ebx,%rsi
+  801ec5:	4c 39 e6             	cmp    %r12,%rsi
+  801ec8:	72 df                	jb     801ea9 <readn+0x33>
+    }
+    return res;
+  801eca:	48 63 c3             	movslq %ebx,%rax
+}
+  801ecd:	48 83 c4 08          	add    $0x8,%rsp
+  801ed1:	5b                   	pop    %rbx
+  801ed2:	41 5c                	pop    %r12
+  801ed4:	41 5d                	pop    %r13
+  801ed6:	41 5e                	pop    %r14
+  801ed8:	41 5f                	pop    %r15
+  801eda:	5d                   	pop    %rbp
+  801edb:	c3                   	ret
+        if (inc < 0) return inc;
+  801edc:	48 98                	cltq
+  801ede:	eb ed                	jmp    801ecd <readn+0x57>
+    int inc = 1, res = 0;
+  801ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee5:	eb e3                	jmp    801eca <readn+0x54>
+
+0000000000801ee7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ee7:	55                   	push   %rbp
+  801ee8:	48 89 e5             	mov    %rsp,%rbp
+  801eeb:	41 56                	push   %r14
+  801eed:	41 55                	push   %r13
+  801eef:	41 54                	push   %r12
+  801ef1:	53                   	push   %rbx
+  801ef2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ef6:	89 fb                	mov    %edi,%ebx
+  801ef8:	49 89 f4             	mov    %rsi,%r12
+  801efb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801efe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f02:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	78 47                	js     801f59 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f12:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f16:	41 8b 3e             	mov    (%r14),%edi
+  801f19:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f1d:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 30                	js     801f5d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f2d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f32:	74 2d                	je     801f61 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f38:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f3c:	48 85 c0             	test   %rax,%rax
+  801f3f:	74 56                	je     801f97 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f41:	4c 89 ea             	mov    %r13,%rdx
+  801f44:	4c 89 e6             	mov    %r12,%rsi
+  801f47:	4c 89 f7             	mov    %r14,%rdi
+  801f4a:	ff d0                	call   *%rax
+}
+  801f4c:	48 83 c4 10          	add    $0x10,%rsp
+  801f50:	5b                   	pop    %rbx
+  801f51:	41 5c                	pop    %r12
+  801f53:	41 5d                	pop    %r13
+  801f55:	41 5e                	pop    %r14
+  801f57:	5d                   	pop    %rbp
+  801f58:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f59:	48 98                	cltq
+  801f5b:	eb ef                	jmp    801f4c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f5d:	48 98                	cltq
+  801f5f:	eb eb                	jmp    801f4c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f61:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f68:	00 00 00 
+  801f6b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f71:	89 da                	mov    %ebx,%edx
+  801f73:	48 bf 3d 41 80 00 00 	movabs $0x80413d,%rdi
+  801f7a:	00 00 00 
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f82:	48 b9 2e 03 80 00 00 	movabs $0x80032e,%rcx
+  801f89:	00 00 00 
+  801f8c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f8e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f95:	eb b5                	jmp    801f4c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f97:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f9e:	eb ac                	jmp    801f4c <write+0x65>
+
+0000000000801fa0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fa0:	55                   	push   %rbp
+  801fa1:	48 89 e5             	mov    %rsp,%rbp
+  801fa4:	53                   	push   %rbx
+  801fa5:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801faf:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 0c                	js     801fcb <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fc3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fcf:	c9                   	leave
+  801fd0:	c3                   	ret
+
+0000000000801fd1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fd1:	55                   	push   %rbp
+  801fd2:	48 89 e5             	mov    %rsp,%rbp
+  801fd5:	41 55                	push   %r13
+  801fd7:	41 54                	push   %r12
+  801fd9:	53                   	push   %rbx
+  801fda:	48 83 ec 18          	sub    $0x18,%rsp
+  801fde:	89 fb                	mov    %edi,%ebx
+  801fe0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe7:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	78 38                	js     80202f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ffb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802003:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+  80200f:	85 c0                	test   %eax,%eax
+  802011:	78 1c                	js     80202f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802013:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802018:	74 20                	je     80203a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80201a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80201e:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802022:	48 85 c0             	test   %rax,%rax
+  802025:	74 47                	je     80206e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802027:	44 89 e6             	mov    %r12d,%esi
+  80202a:	4c 89 ef             	mov    %r13,%rdi
+  80202d:	ff d0                	call   *%rax
+}
+  80202f:	48 83 c4 18          	add    $0x18,%rsp
+  802033:	5b                   	pop    %rbx
+  802034:	41 5c                	pop    %r12
+  802036:	41 5d                	pop    %r13
+  802038:	5d                   	pop    %rbp
+  802039:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80203a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802041:	00 00 00 
+  802044:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80204a:	89 da                	mov    %ebx,%edx
+  80204c:	48 bf 00 41 80 00 00 	movabs $0x804100,%rdi
+  802053:	00 00 00 
+  802056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205b:	48 b9 2e 03 80 00 00 	movabs $0x80032e,%rcx
+  802062:	00 00 00 
+  802065:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80206c:	eb c1                	jmp    80202f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80206e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802073:	eb ba                	jmp    80202f <ftruncate+0x5e>
+
+0000000000802075 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802075:	55                   	push   %rbp
+  802076:	48 89 e5             	mov    %rsp,%rbp
+  802079:	41 54                	push   %r12
+  80207b:	53                   	push   %rbx
+  80207c:	48 83 ec 10          	sub    $0x10,%rsp
+  802080:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802083:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802087:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+  802093:	85 c0                	test   %eax,%eax
+  802095:	78 4e                	js     8020e5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802097:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80209b:	41 8b 3c 24          	mov    (%r12),%edi
+  80209f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020a3:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 32                	js     8020e5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020b7:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8020bc:	74 30                	je     8020ee <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020be:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020c1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020c8:	00 00 00 
+    stat->st_isdir = 0;
+  8020cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020d2:	00 00 00 
+    stat->st_dev = dev;
+  8020d5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020dc:	48 89 de             	mov    %rbx,%rsi
+  8020df:	4c 89 e7             	mov    %r12,%rdi
+  8020e2:	ff 50 30             	call   *0x30(%rax)
+}
+  8020e5:	48 83 c4 10          	add    $0x10,%rsp
+  8020e9:	5b                   	pop    %rbx
+  8020ea:	41 5c                	pop    %r12
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020ee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f3:	eb f0                	jmp    8020e5 <fstat+0x70>
+
+00000000008020f5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  8020f9:	41 54                	push   %r12
+  8020fb:	53                   	push   %rbx
+  8020fc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802104:	48 b8 4c 2e 80 00 00 	movabs $0x802e4c,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+  802110:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802112:	85 c0                	test   %eax,%eax
+  802114:	78 25                	js     80213b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802116:	4c 89 e6             	mov    %r12,%rsi
+  802119:	89 c7                	mov    %eax,%edi
+  80211b:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  802122:	00 00 00 
+  802125:	ff d0                	call   *%rax
+  802127:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80212a:	89 df                	mov    %ebx,%edi
+  80212c:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+
+    return res;
+  802138:	44 89 e3             	mov    %r12d,%ebx
+}
+  80213b:	89 d8                	mov    %ebx,%eax
+  80213d:	5b                   	pop    %rbx
+  80213e:	41 5c                	pop    %r12
+  802140:	5d                   	pop    %rbp
+  802141:	c3                   	ret
+
+0000000000802142 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	41 54                	push   %r12
+  802148:	53                   	push   %rbx
+  802149:	48 83 ec 10          	sub    $0x10,%rsp
+  80214d:	48 89 fb             	mov    %rdi,%rbx
+  802150:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802153:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802157:	bf 66 00 00 00       	mov    $0x66,%edi
+  80215c:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	78 1f                	js     80218b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80216c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802170:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802174:	48 85 c0             	test   %rax,%rax
+  802177:	74 1b                	je     802194 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802179:	4c 89 e6             	mov    %r12,%rsi
+  80217c:	48 89 df             	mov    %rbx,%rdi
+  80217f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802181:	85 c0                	test   %eax,%eax
+  802183:	ba 00 00 00 00       	mov    $0x0,%edx
+  802188:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80218b:	48 83 c4 10          	add    $0x10,%rsp
+  80218f:	5b                   	pop    %rbx
+  802190:	41 5c                	pop    %r12
+  802192:	5d                   	pop    %rbp
+  802193:	c3                   	ret
+        return -E_NOT_SUPP;
+  802194:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802199:	eb f0                	jmp    80218b <create_snapshot+0x49>
+
+000000000080219b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  80219b:	55                   	push   %rbp
+  80219c:	48 89 e5             	mov    %rsp,%rbp
+  80219f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021a3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021a7:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021ac:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	78 1e                	js     8021da <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8021bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021c0:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021c4:	48 85 d2             	test   %rdx,%rdx
+  8021c7:	74 13                	je     8021dc <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8021c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ce:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021da:	c9                   	leave
+  8021db:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021dc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021e1:	eb f7                	jmp    8021da <print_snapshot_list+0x3f>
+
+00000000008021e3 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8021e3:	55                   	push   %rbp
+  8021e4:	48 89 e5             	mov    %rsp,%rbp
+  8021e7:	53                   	push   %rbx
+  8021e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ec:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021ef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021f3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021f8:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8021ff:	00 00 00 
+  802202:	ff d0                	call   *%rax
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 1c                	js     802224 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80220c:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802210:	48 85 c0             	test   %rax,%rax
+  802213:	74 15                	je     80222a <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802215:	48 89 df             	mov    %rbx,%rdi
+  802218:	ff d0                	call   *%rax
+    if (res < 0) {
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802221:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802224:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+        return -E_NOT_SUPP;
+  80222a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80222f:	eb f3                	jmp    802224 <accept_snapshot+0x41>
+
+0000000000802231 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	53                   	push   %rbx
+  802236:	48 83 ec 18          	sub    $0x18,%rsp
+  80223a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80223d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802241:	bf 66 00 00 00       	mov    $0x66,%edi
+  802246:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 1c                	js     802272 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802256:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80225a:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80225e:	48 85 c0             	test   %rax,%rax
+  802261:	74 15                	je     802278 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802263:	48 89 df             	mov    %rbx,%rdi
+  802266:	ff d0                	call   *%rax
+    if (res < 0) {
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802272:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+        return -E_NOT_SUPP;
+  802278:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80227d:	eb f3                	jmp    802272 <delete_snapshot+0x41>
+
+000000000080227f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80227f:	55                   	push   %rbp
+  802280:	48 89 e5             	mov    %rsp,%rbp
+  802283:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802287:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80228b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802290:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  802297:	00 00 00 
+  80229a:	ff d0                	call   *%rax
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	78 14                	js     8022b4 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8022a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a4:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8022a8:	48 85 d2             	test   %rdx,%rdx
+  8022ab:	74 09                	je     8022b6 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8022ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b2:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8022b4:	c9                   	leave
+  8022b5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022b6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022bb:	eb f7                	jmp    8022b4 <gc_snapshots+0x35>
+
+00000000008022bd <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+  8022c1:	41 56                	push   %r14
+  8022c3:	41 55                	push   %r13
+  8022c5:	41 54                	push   %r12
+  8022c7:	53                   	push   %rbx
+  8022c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cc:	48 89 fb             	mov    %rdi,%rbx
+  8022cf:	49 89 f4             	mov    %rsi,%r12
+  8022d2:	49 89 d5             	mov    %rdx,%r13
+  8022d5:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022d8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022dc:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022e1:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+  8022ed:	85 c0                	test   %eax,%eax
+  8022ef:	78 1b                	js     80230c <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8022f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022f5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8022f9:	48 85 c0             	test   %rax,%rax
+  8022fc:	74 1b                	je     802319 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8022fe:	4c 89 f1             	mov    %r14,%rcx
+  802301:	4c 89 ea             	mov    %r13,%rdx
+  802304:	4c 89 e6             	mov    %r12,%rsi
+  802307:	48 89 df             	mov    %rbx,%rdi
+  80230a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80230c:	48 83 c4 10          	add    $0x10,%rsp
+  802310:	5b                   	pop    %rbx
+  802311:	41 5c                	pop    %r12
+  802313:	41 5d                	pop    %r13
+  802315:	41 5e                	pop    %r14
+  802317:	5d                   	pop    %rbp
+  802318:	c3                   	ret
+        return -E_NOT_SUPP;
+  802319:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80231e:	eb ec                	jmp    80230c <diff_snapshots+0x4f>
+
+0000000000802320 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802320:	55                   	push   %rbp
+  802321:	48 89 e5             	mov    %rsp,%rbp
+  802324:	41 55                	push   %r13
+  802326:	41 54                	push   %r12
+  802328:	53                   	push   %rbx
+  802329:	48 83 ec 18          	sub    $0x18,%rsp
+  80232d:	48 89 fb             	mov    %rdi,%rbx
+  802330:	49 89 f4             	mov    %rsi,%r12
+  802333:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802336:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80233a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80233f:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 18                	js     802367 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80234f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802353:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802357:	48 85 c0             	test   %rax,%rax
+  80235a:	74 16                	je     802372 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80235c:	4c 89 ea             	mov    %r13,%rdx
+  80235f:	4c 89 e6             	mov    %r12,%rsi
+  802362:	48 89 df             	mov    %rbx,%rdi
+  802365:	ff d0                	call   *%rax
+
+    return res;
+}
+  802367:	48 83 c4 18          	add    $0x18,%rsp
+  80236b:	5b                   	pop    %rbx
+  80236c:	41 5c                	pop    %r12
+  80236e:	41 5d                	pop    %r13
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+        return -E_NOT_SUPP;
+  802372:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802377:	eb ee                	jmp    802367 <send_snapshot+0x47>
+
+0000000000802379 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+  80237d:	53                   	push   %rbx
+  80237e:	48 83 ec 18          	sub    $0x18,%rsp
+  802382:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802385:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802389:	bf 66 00 00 00       	mov    $0x66,%edi
+  80238e:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  802395:	00 00 00 
+  802398:	ff d0                	call   *%rax
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 12                	js     8023b0 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80239e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023a2:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8023a6:	48 85 c0             	test   %rax,%rax
+  8023a9:	74 0b                	je     8023b6 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8023ab:	48 89 df             	mov    %rbx,%rdi
+  8023ae:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023b6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023bb:	eb f3                	jmp    8023b0 <receive_snapshot+0x37>
+
+00000000008023bd <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8023bd:	55                   	push   %rbp
+  8023be:	48 89 e5             	mov    %rsp,%rbp
+  8023c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023c9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023ce:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8023d5:	00 00 00 
+  8023d8:	ff d0                	call   *%rax
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	78 17                	js     8023f5 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8023de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023e2:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8023e9:	48 85 d2             	test   %rdx,%rdx
+  8023ec:	74 09                	je     8023f7 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8023ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f3:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023f7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023fc:	eb f7                	jmp    8023f5 <free_space_bytes+0x38>
+
+00000000008023fe <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8023fe:	55                   	push   %rbp
+  8023ff:	48 89 e5             	mov    %rsp,%rbp
+  802402:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802406:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80240a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80240f:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 17                	js     802436 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80241f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802423:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80242a:	48 85 d2             	test   %rdx,%rdx
+  80242d:	74 09                	je     802438 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80242f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802434:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802436:	c9                   	leave
+  802437:	c3                   	ret
+        return -E_NOT_SUPP;
+  802438:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80243d:	eb f7                	jmp    802436 <busy_space_bytes+0x38>
+
+000000000080243f <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80243f:	55                   	push   %rbp
+  802440:	48 89 e5             	mov    %rsp,%rbp
+  802443:	41 54                	push   %r12
+  802445:	53                   	push   %rbx
+  802446:	48 83 ec 10          	sub    $0x10,%rsp
+  80244a:	89 fb                	mov    %edi,%ebx
+  80244c:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80244f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802453:	bf 66 00 00 00       	mov    $0x66,%edi
+  802458:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+  802464:	85 c0                	test   %eax,%eax
+  802466:	78 17                	js     80247f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802468:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80246c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802473:	48 85 c0             	test   %rax,%rax
+  802476:	74 10                	je     802488 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802478:	4c 89 e6             	mov    %r12,%rsi
+  80247b:	89 df                	mov    %ebx,%edi
+  80247d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80247f:	48 83 c4 10          	add    $0x10,%rsp
+  802483:	5b                   	pop    %rbx
+  802484:	41 5c                	pop    %r12
+  802486:	5d                   	pop    %rbp
+  802487:	c3                   	ret
+        return -E_NOT_SUPP;
+  802488:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80248d:	eb f0                	jmp    80247f <snapshots_space+0x40>
+
+000000000080248f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80248f:	55                   	push   %rbp
+  802490:	48 89 e5             	mov    %rsp,%rbp
+  802493:	41 55                	push   %r13
+  802495:	41 54                	push   %r12
+  802497:	53                   	push   %rbx
+  802498:	48 83 ec 08          	sub    $0x8,%rsp
+  80249c:	41 89 fd             	mov    %edi,%r13d
+  80249f:	48 89 f3             	mov    %rsi,%rbx
+  8024a2:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024a5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024ac:	00 00 00 
+  8024af:	83 38 00             	cmpl   $0x0,(%rax)
+  8024b2:	74 57                	je     80250b <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024b4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024ba:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024bf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024c6:	00 00 00 
+  8024c9:	44 89 ee             	mov    %r13d,%esi
+  8024cc:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024d3:	00 00 00 
+  8024d6:	8b 38                	mov    (%rax),%edi
+  8024d8:	48 b8 0c 39 80 00 00 	movabs $0x80390c,%rax
+  8024df:	00 00 00 
+  8024e2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8024e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e9:	4c 89 e2             	mov    %r12,%rdx
+  8024ec:	48 89 de             	mov    %rbx,%rsi
+  8024ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f4:	48 b8 f4 38 80 00 00 	movabs $0x8038f4,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+}
+  802500:	48 83 c4 08          	add    $0x8,%rsp
+  802504:	5b                   	pop    %rbx
+  802505:	41 5c                	pop    %r12
+  802507:	41 5d                	pop    %r13
+  802509:	5d                   	pop    %rbp
+  80250a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80250b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802510:	48 b8 ca 39 80 00 00 	movabs $0x8039ca,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+  80251c:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802523:	00 00 
+  802525:	eb 8d                	jmp    8024b4 <fsipc_region+0x25>
+
+0000000000802527 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80252f:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802536:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802537:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80253b:	48 b8 8f 24 80 00 00 	movabs $0x80248f,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+}
+  802547:	c9                   	leave
+  802548:	c3                   	ret
+
+0000000000802549 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802549:	85 ff                	test   %edi,%edi
+  80254b:	78 6d                	js     8025ba <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80254d:	55                   	push   %rbp
+  80254e:	48 89 e5             	mov    %rsp,%rbp
+  802551:	41 54                	push   %r12
+  802553:	53                   	push   %rbx
+  802554:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802557:	48 85 f6             	test   %rsi,%rsi
+  80255a:	74 57                	je     8025b3 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80255c:	89 f8                	mov    %edi,%eax
+  80255e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802565:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802567:	be 00 00 00 00       	mov    $0x0,%esi
+  80256c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802571:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80257d:	85 c0                	test   %eax,%eax
+  80257f:	78 2d                	js     8025ae <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802581:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802588:	00 00 00 
+  80258b:	49 63 14 24          	movslq (%r12),%rdx
+  80258f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802596:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80259b:	48 89 df             	mov    %rbx,%rdi
+  80259e:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  8025a5:	00 00 00 
+  8025a8:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8025aa:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8025ae:	5b                   	pop    %rbx
+  8025af:	41 5c                	pop    %r12
+  8025b1:	5d                   	pop    %rbp
+  8025b2:	c3                   	ret
+        return -E_INVAL;
+  8025b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025b8:	eb f4                	jmp    8025ae <devfile_df_snapshots+0x65>
+  8025ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025bf:	c3                   	ret
+
+00000000008025c0 <devfile_df_busy>:
+devfile_df_busy() {
+  8025c0:	55                   	push   %rbp
+  8025c1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c9:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025ce:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+}
+  8025da:	5d                   	pop    %rbp
+  8025db:	c3                   	ret
+
+00000000008025dc <devfile_df_free>:
+devfile_df_free() {
+  8025dc:	55                   	push   %rbp
+  8025dd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8025e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025ea:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  8025f1:	00 00 00 
+  8025f4:	ff d0                	call   *%rax
+}
+  8025f6:	5d                   	pop    %rbp
+  8025f7:	c3                   	ret
+
+00000000008025f8 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8025f8:	55                   	push   %rbp
+  8025f9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8025fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802601:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802606:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  80260d:	00 00 00 
+  802610:	ff d0                	call   *%rax
+}
+  802612:	5d                   	pop    %rbp
+  802613:	c3                   	ret
+
+0000000000802614 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802614:	55                   	push   %rbp
+  802615:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802618:	be 00 00 00 00       	mov    $0x0,%esi
+  80261d:	bf 09 00 00 00       	mov    $0x9,%edi
+  802622:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802629:	00 00 00 
+  80262c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80262e:	85 c0                	test   %eax,%eax
+  802630:	ba 00 00 00 00       	mov    $0x0,%edx
+  802635:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802638:	5d                   	pop    %rbp
+  802639:	c3                   	ret
+
+000000000080263a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80263a:	55                   	push   %rbp
+  80263b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80263e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802645:	00 00 00 
+  802648:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80264b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80264d:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802650:	be 00 00 00 00       	mov    $0x0,%esi
+  802655:	bf 02 00 00 00       	mov    $0x2,%edi
+  80265a:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802661:	00 00 00 
+  802664:	ff d0                	call   *%rax
+}
+  802666:	5d                   	pop    %rbp
+  802667:	c3                   	ret
+
+0000000000802668 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80266c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80266f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802676:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802678:	be 00 00 00 00       	mov    $0x0,%esi
+  80267d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802682:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802689:	00 00 00 
+  80268c:	ff d0                	call   *%rax
+}
+  80268e:	5d                   	pop    %rbp
+  80268f:	c3                   	ret
+
+0000000000802690 <devfile_write>:
+    if (!fd || !buf) {
+  802690:	48 85 ff             	test   %rdi,%rdi
+  802693:	0f 84 c1 00 00 00    	je     80275a <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	41 57                	push   %r15
+  80269f:	41 56                	push   %r14
+  8026a1:	41 55                	push   %r13
+  8026a3:	41 54                	push   %r12
+  8026a5:	53                   	push   %rbx
+  8026a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8026aa:	49 89 ff             	mov    %rdi,%r15
+  8026ad:	49 89 f5             	mov    %rsi,%r13
+  8026b0:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026b3:	48 85 f6             	test   %rsi,%rsi
+  8026b6:	0f 84 95 00 00 00    	je     802751 <devfile_write+0xc1>
+    while (n) {
+  8026bc:	48 85 d2             	test   %rdx,%rdx
+  8026bf:	0f 84 83 00 00 00    	je     802748 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026c5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026cc:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026d3:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026d6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026db:	49 39 dc             	cmp    %rbx,%r12
+  8026de:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8026e2:	48 89 da             	mov    %rbx,%rdx
+  8026e5:	4c 89 ee             	mov    %r13,%rsi
+  8026e8:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8026ef:	00 00 00 
+  8026f2:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026fe:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802702:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802705:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802709:	be 00 00 00 00       	mov    $0x0,%esi
+  80270e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802713:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+        if (write < 0) {
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	78 21                	js     802744 <devfile_write+0xb4>
+        buf += write;
+  802723:	48 63 d0             	movslq %eax,%rdx
+  802726:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802729:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80272c:	49 29 d4             	sub    %rdx,%r12
+  80272f:	75 a5                	jne    8026d6 <devfile_write+0x46>
+    return totalWrite;
+  802731:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802735:	48 83 c4 18          	add    $0x18,%rsp
+  802739:	5b                   	pop    %rbx
+  80273a:	41 5c                	pop    %r12
+  80273c:	41 5d                	pop    %r13
+  80273e:	41 5e                	pop    %r14
+  802740:	41 5f                	pop    %r15
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+            return write;
+  802744:	48 98                	cltq
+  802746:	eb ed                	jmp    802735 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802748:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80274f:	eb e0                	jmp    802731 <devfile_write+0xa1>
+        return -E_INVAL;
+  802751:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802758:	eb db                	jmp    802735 <devfile_write+0xa5>
+  80275a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802761:	c3                   	ret
+
+0000000000802762 <devfile_read>:
+    if (!fd || !buf) {
+  802762:	48 85 ff             	test   %rdi,%rdi
+  802765:	0f 84 c0 00 00 00    	je     80282b <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80276b:	55                   	push   %rbp
+  80276c:	48 89 e5             	mov    %rsp,%rbp
+  80276f:	41 57                	push   %r15
+  802771:	41 56                	push   %r14
+  802773:	41 55                	push   %r13
+  802775:	41 54                	push   %r12
+  802777:	53                   	push   %rbx
+  802778:	48 83 ec 18          	sub    $0x18,%rsp
+  80277c:	49 89 ff             	mov    %rdi,%r15
+  80277f:	49 89 f5             	mov    %rsi,%r13
+  802782:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802785:	48 85 f6             	test   %rsi,%rsi
+  802788:	0f 84 96 00 00 00    	je     802824 <devfile_read+0xc2>
+    while (n) {
+  80278e:	48 85 d2             	test   %rdx,%rdx
+  802791:	0f 84 87 00 00 00    	je     80281e <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802797:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80279e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80279f:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027a6:	00 00 00 
+  8027a9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027ad:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8027b0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027b5:	49 39 c4             	cmp    %rax,%r12
+  8027b8:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8027bc:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8027c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027ca:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  8027d1:	00 00 00 
+  8027d4:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	7e 37                	jle    802811 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8027da:	48 63 d8             	movslq %eax,%rbx
+  8027dd:	48 89 da             	mov    %rbx,%rdx
+  8027e0:	4c 89 f6             	mov    %r14,%rsi
+  8027e3:	4c 89 ef             	mov    %r13,%rdi
+  8027e6:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+        buf += read;
+  8027f2:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8027f5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8027f9:	49 29 dc             	sub    %rbx,%r12
+  8027fc:	75 ab                	jne    8027a9 <devfile_read+0x47>
+  return totalRead;
+  8027fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802802:	48 83 c4 18          	add    $0x18,%rsp
+  802806:	5b                   	pop    %rbx
+  802807:	41 5c                	pop    %r12
+  802809:	41 5d                	pop    %r13
+  80280b:	41 5e                	pop    %r14
+  80280d:	41 5f                	pop    %r15
+  80280f:	5d                   	pop    %rbp
+  802810:	c3                   	ret
+            return read ? read : totalRead;
+  802811:	48 63 d0             	movslq %eax,%rdx
+  802814:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802818:	48 0f 45 c2          	cmovne %rdx,%rax
+  80281c:	eb e4                	jmp    802802 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80281e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802822:	eb da                	jmp    8027fe <devfile_read+0x9c>
+        return E_INVAL;
+  802824:	b8 03 00 00 00       	mov    $0x3,%eax
+  802829:	eb d7                	jmp    802802 <devfile_read+0xa0>
+  80282b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802830:	c3                   	ret
+
+0000000000802831 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802831:	48 85 ff             	test   %rdi,%rdi
+  802834:	74 5f                	je     802895 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802836:	55                   	push   %rbp
+  802837:	48 89 e5             	mov    %rsp,%rbp
+  80283a:	53                   	push   %rbx
+  80283b:	48 83 ec 08          	sub    $0x8,%rsp
+  80283f:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802842:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802854:	77 45                	ja     80289b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802856:	48 89 de             	mov    %rbx,%rsi
+  802859:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802860:	00 00 00 
+  802863:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  80286a:	00 00 00 
+  80286d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80286f:	be 00 00 00 00       	mov    $0x0,%esi
+  802874:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802879:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802885:	85 c0                	test   %eax,%eax
+  802887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80288c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80288f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802893:	c9                   	leave
+  802894:	c3                   	ret
+        return -E_INVAL;
+  802895:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80289a:	c3                   	ret
+        return -E_INVAL;
+  80289b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a0:	eb ed                	jmp    80288f <devfile_receive_snapshot+0x5e>
+
+00000000008028a2 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8028a2:	55                   	push   %rbp
+  8028a3:	48 89 e5             	mov    %rsp,%rbp
+  8028a6:	41 55                	push   %r13
+  8028a8:	41 54                	push   %r12
+  8028aa:	53                   	push   %rbx
+  8028ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8028af:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8028b2:	48 85 f6             	test   %rsi,%rsi
+  8028b5:	0f 94 c0             	sete   %al
+  8028b8:	48 85 d2             	test   %rdx,%rdx
+  8028bb:	0f 94 c2             	sete   %dl
+  8028be:	08 d0                	or     %dl,%al
+  8028c0:	0f 85 ad 00 00 00    	jne    802973 <devfile_send_snapshot+0xd1>
+  8028c6:	48 89 fb             	mov    %rdi,%rbx
+  8028c9:	49 89 f4             	mov    %rsi,%r12
+  8028cc:	48 85 ff             	test   %rdi,%rdi
+  8028cf:	0f 84 9e 00 00 00    	je     802973 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8028d5:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+  8028e1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028e7:	0f 87 8d 00 00 00    	ja     80297a <devfile_send_snapshot+0xd8>
+  8028ed:	4c 89 e7             	mov    %r12,%rdi
+  8028f0:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+  8028fc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802902:	77 7d                	ja     802981 <devfile_send_snapshot+0xdf>
+  802904:	4c 89 ef             	mov    %r13,%rdi
+  802907:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  80290e:	00 00 00 
+  802911:	ff d0                	call   *%rax
+  802913:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802919:	77 6d                	ja     802988 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80291b:	48 89 de             	mov    %rbx,%rsi
+  80291e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802925:	00 00 00 
+  802928:	48 bb 53 0c 80 00 00 	movabs $0x800c53,%rbx
+  80292f:	00 00 00 
+  802932:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802934:	4c 89 e6             	mov    %r12,%rsi
+  802937:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  80293e:	00 00 00 
+  802941:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802943:	4c 89 ee             	mov    %r13,%rsi
+  802946:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80294d:	00 00 00 
+  802950:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802952:	be 00 00 00 00       	mov    $0x0,%esi
+  802957:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80295c:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+}
+  802968:	48 83 c4 08          	add    $0x8,%rsp
+  80296c:	5b                   	pop    %rbx
+  80296d:	41 5c                	pop    %r12
+  80296f:	41 5d                	pop    %r13
+  802971:	5d                   	pop    %rbp
+  802972:	c3                   	ret
+        return -E_INVAL;
+  802973:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802978:	eb ee                	jmp    802968 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80297a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80297f:	eb e7                	jmp    802968 <devfile_send_snapshot+0xc6>
+  802981:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802986:	eb e0                	jmp    802968 <devfile_send_snapshot+0xc6>
+  802988:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80298d:	eb d9                	jmp    802968 <devfile_send_snapshot+0xc6>
+
+000000000080298f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80298f:	48 85 ff             	test   %rdi,%rdi
+  802992:	0f 84 41 01 00 00    	je     802ad9 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802998:	55                   	push   %rbp
+  802999:	48 89 e5             	mov    %rsp,%rbp
+  80299c:	41 57                	push   %r15
+  80299e:	41 56                	push   %r14
+  8029a0:	41 55                	push   %r13
+  8029a2:	41 54                	push   %r12
+  8029a4:	53                   	push   %rbx
+  8029a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a9:	49 89 fc             	mov    %rdi,%r12
+  8029ac:	49 89 f5             	mov    %rsi,%r13
+  8029af:	48 89 d3             	mov    %rdx,%rbx
+  8029b2:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8029b5:	48 85 f6             	test   %rsi,%rsi
+  8029b8:	0f 84 ff 00 00 00    	je     802abd <devfile_diff_snapshots+0x12e>
+  8029be:	48 85 d2             	test   %rdx,%rdx
+  8029c1:	0f 84 fd 00 00 00    	je     802ac4 <devfile_diff_snapshots+0x135>
+  8029c7:	48 85 c9             	test   %rcx,%rcx
+  8029ca:	0f 84 f4 00 00 00    	je     802ac4 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8029d0:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+  8029dc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029e2:	0f 87 e3 00 00 00    	ja     802acb <devfile_diff_snapshots+0x13c>
+  8029e8:	4c 89 ef             	mov    %r13,%rdi
+  8029eb:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  8029f2:	00 00 00 
+  8029f5:	ff d0                	call   *%rax
+  8029f7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029fd:	0f 87 cf 00 00 00    	ja     802ad2 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a03:	4c 89 e6             	mov    %r12,%rsi
+  802a06:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a0d:	00 00 00 
+  802a10:	4c 89 e7             	mov    %r12,%rdi
+  802a13:	49 bf 53 0c 80 00 00 	movabs $0x800c53,%r15
+  802a1a:	00 00 00 
+  802a1d:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802a20:	4c 89 ee             	mov    %r13,%rsi
+  802a23:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a2a:	00 
+  802a2b:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a2e:	48 8b 03             	mov    (%rbx),%rax
+  802a31:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a38:	00 
+  802a39:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a3d:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a44:	00 
+  802a45:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a49:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a50:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a51:	be 00 00 00 00       	mov    $0x0,%esi
+  802a56:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a5b:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 43                	js     802aae <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a6b:	49 8b 04 24          	mov    (%r12),%rax
+  802a6f:	48 89 03             	mov    %rax,(%rbx)
+  802a72:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a77:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a7b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802a80:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802a84:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802a89:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802a8d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802a91:	48 c1 e2 03          	shl    $0x3,%rdx
+  802a95:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802a9a:	4c 89 f7             	mov    %r14,%rdi
+  802a9d:	48 b8 4d 0e 80 00 00 	movabs $0x800e4d,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802aa9:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802aae:	48 83 c4 08          	add    $0x8,%rsp
+  802ab2:	5b                   	pop    %rbx
+  802ab3:	41 5c                	pop    %r12
+  802ab5:	41 5d                	pop    %r13
+  802ab7:	41 5e                	pop    %r14
+  802ab9:	41 5f                	pop    %r15
+  802abb:	5d                   	pop    %rbp
+  802abc:	c3                   	ret
+        return -E_INVAL;
+  802abd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac2:	eb ea                	jmp    802aae <devfile_diff_snapshots+0x11f>
+  802ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac9:	eb e3                	jmp    802aae <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad0:	eb dc                	jmp    802aae <devfile_diff_snapshots+0x11f>
+  802ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad7:	eb d5                	jmp    802aae <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ade:	c3                   	ret
+
+0000000000802adf <devfile_delete_snapshot>:
+    if (!name) {
+  802adf:	48 85 ff             	test   %rdi,%rdi
+  802ae2:	74 5f                	je     802b43 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802ae4:	55                   	push   %rbp
+  802ae5:	48 89 e5             	mov    %rsp,%rbp
+  802ae8:	53                   	push   %rbx
+  802ae9:	48 83 ec 08          	sub    $0x8,%rsp
+  802aed:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802af0:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+  802afc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b02:	77 45                	ja     802b49 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b04:	48 89 de             	mov    %rbx,%rsi
+  802b07:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b0e:	00 00 00 
+  802b11:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b22:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b27:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b3a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+        return -E_INVAL;
+  802b43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b48:	c3                   	ret
+        return -E_INVAL;
+  802b49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b4e:	eb ed                	jmp    802b3d <devfile_delete_snapshot+0x5e>
+
+0000000000802b50 <devfile_accept_snapshot>:
+    if (!name) {
+  802b50:	48 85 ff             	test   %rdi,%rdi
+  802b53:	74 5f                	je     802bb4 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b55:	55                   	push   %rbp
+  802b56:	48 89 e5             	mov    %rsp,%rbp
+  802b59:	53                   	push   %rbx
+  802b5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b5e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b61:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+  802b6d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b73:	77 45                	ja     802bba <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b75:	48 89 de             	mov    %rbx,%rsi
+  802b78:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b7f:	00 00 00 
+  802b82:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802b8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802b93:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b98:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802b9f:	00 00 00 
+  802ba2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ba4:	85 c0                	test   %eax,%eax
+  802ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bab:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb2:	c9                   	leave
+  802bb3:	c3                   	ret
+        return -E_INVAL;
+  802bb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bb9:	c3                   	ret
+        return -E_INVAL;
+  802bba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bbf:	eb ed                	jmp    802bae <devfile_accept_snapshot+0x5e>
+
+0000000000802bc1 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802bc1:	48 85 ff             	test   %rdi,%rdi
+  802bc4:	0f 84 9f 00 00 00    	je     802c69 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802bca:	55                   	push   %rbp
+  802bcb:	48 89 e5             	mov    %rsp,%rbp
+  802bce:	41 54                	push   %r12
+  802bd0:	53                   	push   %rbx
+  802bd1:	48 89 fb             	mov    %rdi,%rbx
+  802bd4:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802bd7:	48 85 f6             	test   %rsi,%rsi
+  802bda:	74 78                	je     802c54 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802bdc:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+  802be8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bee:	77 6b                	ja     802c5b <devfile_create_snapshot+0x9a>
+  802bf0:	4c 89 e7             	mov    %r12,%rdi
+  802bf3:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+  802bff:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c05:	77 5b                	ja     802c62 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c07:	48 89 de             	mov    %rbx,%rsi
+  802c0a:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c11:	00 00 00 
+  802c14:	48 bb 53 0c 80 00 00 	movabs $0x800c53,%rbx
+  802c1b:	00 00 00 
+  802c1e:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802c20:	4c 89 e6             	mov    %r12,%rsi
+  802c23:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802c2a:	00 00 00 
+  802c2d:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c34:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c39:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802c40:	00 00 00 
+  802c43:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c45:	85 c0                	test   %eax,%eax
+  802c47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c4c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c4f:	5b                   	pop    %rbx
+  802c50:	41 5c                	pop    %r12
+  802c52:	5d                   	pop    %rbp
+  802c53:	c3                   	ret
+        return -E_INVAL;
+  802c54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c59:	eb f4                	jmp    802c4f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c60:	eb ed                	jmp    802c4f <devfile_create_snapshot+0x8e>
+  802c62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c67:	eb e6                	jmp    802c4f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c6e:	c3                   	ret
+
+0000000000802c6f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c6f:	55                   	push   %rbp
+  802c70:	48 89 e5             	mov    %rsp,%rbp
+  802c73:	41 54                	push   %r12
+  802c75:	53                   	push   %rbx
+  802c76:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c79:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c7c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c83:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c85:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c8f:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802c96:	00 00 00 
+  802c99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	78 3d                	js     802cdc <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c9f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802ca6:	00 00 00 
+  802ca9:	4c 89 e6             	mov    %r12,%rsi
+  802cac:	48 89 df             	mov    %rbx,%rdi
+  802caf:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802cbb:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802cc2:	00 
+  802cc3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802cc9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802cd0:	00 
+  802cd1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cdc:	5b                   	pop    %rbx
+  802cdd:	41 5c                	pop    %r12
+  802cdf:	5d                   	pop    %rbp
+  802ce0:	c3                   	ret
+
+0000000000802ce1 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802ce1:	55                   	push   %rbp
+  802ce2:	48 89 e5             	mov    %rsp,%rbp
+  802ce5:	41 57                	push   %r15
+  802ce7:	41 56                	push   %r14
+  802ce9:	41 55                	push   %r13
+  802ceb:	41 54                	push   %r12
+  802ced:	53                   	push   %rbx
+  802cee:	48 83 ec 38          	sub    $0x38,%rsp
+  802cf2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802cf6:	49 89 f5             	mov    %rsi,%r13
+  802cf9:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802cfc:	48 89 f0             	mov    %rsi,%rax
+  802cff:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d04:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d08:	75 4f                	jne    802d59 <devfile_readmap+0x78>
+  802d0a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d0e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d14:	75 1f                	jne    802d35 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802d16:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d1a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d1e:	49 be c9 34 80 00 00 	movabs $0x8034c9,%r14
+  802d25:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d28:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d2f:	0f 87 9d 00 00 00    	ja     802dd2 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d35:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d39:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d3d:	4d 85 ff             	test   %r15,%r15
+  802d40:	0f 85 cf 00 00 00    	jne    802e15 <devfile_readmap+0x134>
+  802d46:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d4a:	48 83 c4 38          	add    $0x38,%rsp
+  802d4e:	5b                   	pop    %rbx
+  802d4f:	41 5c                	pop    %r12
+  802d51:	41 5d                	pop    %r13
+  802d53:	41 5e                	pop    %r14
+  802d55:	41 5f                	pop    %r15
+  802d57:	5d                   	pop    %rbp
+  802d58:	c3                   	ret
+    size_t totalRead = 0;
+  802d59:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d60:	00 
+  802d61:	eb da                	jmp    802d3d <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d63:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d67:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d6a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d71:	00 00 00 
+  802d74:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d7a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802d7e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d82:	4c 89 ee             	mov    %r13,%rsi
+  802d85:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d8a:	48 b8 8f 24 80 00 00 	movabs $0x80248f,%rax
+  802d91:	00 00 00 
+  802d94:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802d96:	85 c0                	test   %eax,%eax
+  802d98:	7e a3                	jle    802d3d <devfile_readmap+0x5c>
+  802d9a:	48 98                	cltq
+  802d9c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802da0:	72 9b                	jb     802d3d <devfile_readmap+0x5c>
+        buf += read;
+  802da2:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802da5:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802da8:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dac:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802db3:	75 88                	jne    802d3d <devfile_readmap+0x5c>
+  802db5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802db9:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802dbf:	0f 85 78 ff ff ff    	jne    802d3d <devfile_readmap+0x5c>
+  802dc5:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802dcc:	0f 86 6b ff ff ff    	jbe    802d3d <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802dd2:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802dd8:	4d 39 e7             	cmp    %r12,%r15
+  802ddb:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802ddf:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802de6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802dea:	0f 84 73 ff ff ff    	je     802d63 <devfile_readmap+0x82>
+  802df0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802df4:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802df9:	41 ff d6             	call   *%r14
+  802dfc:	a8 40                	test   $0x40,%al
+  802dfe:	0f 85 39 ff ff ff    	jne    802d3d <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e04:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e0b:	4c 39 e3             	cmp    %r12,%rbx
+  802e0e:	72 e4                	jb     802df4 <devfile_readmap+0x113>
+  802e10:	e9 4e ff ff ff       	jmp    802d63 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802e15:	4c 89 fa             	mov    %r15,%rdx
+  802e18:	4c 89 ee             	mov    %r13,%rsi
+  802e1b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e1f:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e2b:	48 85 c0             	test   %rax,%rax
+  802e2e:	78 0c                	js     802e3c <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e30:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e34:	48 01 f0             	add    %rsi,%rax
+  802e37:	e9 0e ff ff ff       	jmp    802d4a <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e3c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e40:	48 85 f6             	test   %rsi,%rsi
+  802e43:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e47:	e9 fe fe ff ff       	jmp    802d4a <devfile_readmap+0x69>
+
+0000000000802e4c <open>:
+open(const char *path, int mode) {
+  802e4c:	55                   	push   %rbp
+  802e4d:	48 89 e5             	mov    %rsp,%rbp
+  802e50:	41 55                	push   %r13
+  802e52:	41 54                	push   %r12
+  802e54:	53                   	push   %rbx
+  802e55:	48 83 ec 18          	sub    $0x18,%rsp
+  802e59:	49 89 fc             	mov    %rdi,%r12
+  802e5c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e5f:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+  802e6b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e71:	0f 87 8a 00 00 00    	ja     802f01 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e77:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e7b:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  802e82:	00 00 00 
+  802e85:	ff d0                	call   *%rax
+  802e87:	89 c3                	mov    %eax,%ebx
+  802e89:	85 c0                	test   %eax,%eax
+  802e8b:	78 50                	js     802edd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e8d:	4c 89 e6             	mov    %r12,%rsi
+  802e90:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802e97:	00 00 00 
+  802e9a:	48 89 df             	mov    %rbx,%rdi
+  802e9d:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ea9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802eb0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802eb4:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eb9:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	89 c3                	mov    %eax,%ebx
+  802ec7:	85 c0                	test   %eax,%eax
+  802ec9:	78 1f                	js     802eea <open+0x9e>
+    return fd2num(fd);
+  802ecb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ecf:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+  802edb:	89 c3                	mov    %eax,%ebx
+}
+  802edd:	89 d8                	mov    %ebx,%eax
+  802edf:	48 83 c4 18          	add    $0x18,%rsp
+  802ee3:	5b                   	pop    %rbx
+  802ee4:	41 5c                	pop    %r12
+  802ee6:	41 5d                	pop    %r13
+  802ee8:	5d                   	pop    %rbp
+  802ee9:	c3                   	ret
+        fd_close(fd, 0);
+  802eea:	be 00 00 00 00       	mov    $0x0,%esi
+  802eef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef3:	48 b8 c5 1a 80 00 00 	movabs $0x801ac5,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+        return res;
+  802eff:	eb dc                	jmp    802edd <open+0x91>
+        return -E_BAD_PATH;
+  802f01:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f06:	eb d5                	jmp    802edd <open+0x91>
+
+0000000000802f08 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f08:	55                   	push   %rbp
+  802f09:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f11:	bf 13 00 00 00       	mov    $0x13,%edi
+  802f16:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802f1d:	00 00 00 
+  802f20:	ff d0                	call   *%rax
+}
+  802f22:	5d                   	pop    %rbp
+  802f23:	c3                   	ret
+
+0000000000802f24 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f24:	55                   	push   %rbp
+  802f25:	48 89 e5             	mov    %rsp,%rbp
+  802f28:	41 54                	push   %r12
+  802f2a:	53                   	push   %rbx
+  802f2b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f2e:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  802f35:	00 00 00 
+  802f38:	ff d0                	call   *%rax
+  802f3a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f3d:	48 be 80 41 80 00 00 	movabs $0x804180,%rsi
+  802f44:	00 00 00 
+  802f47:	48 89 df             	mov    %rbx,%rdi
+  802f4a:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f56:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f5b:	41 2b 04 24          	sub    (%r12),%eax
+  802f5f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f65:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f6c:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f6f:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f76:	00 00 00 
+  802f79:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	5b                   	pop    %rbx
+  802f86:	41 5c                	pop    %r12
+  802f88:	5d                   	pop    %rbp
+  802f89:	c3                   	ret
+
+0000000000802f8a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f8a:	55                   	push   %rbp
+  802f8b:	48 89 e5             	mov    %rsp,%rbp
+  802f8e:	41 54                	push   %r12
+  802f90:	53                   	push   %rbx
+  802f91:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f99:	48 89 fe             	mov    %rdi,%rsi
+  802f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa1:	49 bc ab 13 80 00 00 	movabs $0x8013ab,%r12
+  802fa8:	00 00 00 
+  802fab:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fae:	48 89 df             	mov    %rbx,%rdi
+  802fb1:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+  802fbd:	48 89 c6             	mov    %rax,%rsi
+  802fc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fca:	41 ff d4             	call   *%r12
+}
+  802fcd:	5b                   	pop    %rbx
+  802fce:	41 5c                	pop    %r12
+  802fd0:	5d                   	pop    %rbp
+  802fd1:	c3                   	ret
+
+0000000000802fd2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fd2:	55                   	push   %rbp
+  802fd3:	48 89 e5             	mov    %rsp,%rbp
+  802fd6:	41 57                	push   %r15
+  802fd8:	41 56                	push   %r14
+  802fda:	41 55                	push   %r13
+  802fdc:	41 54                	push   %r12
+  802fde:	53                   	push   %rbx
+  802fdf:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe3:	49 89 fc             	mov    %rdi,%r12
+  802fe6:	49 89 f5             	mov    %rsi,%r13
+  802fe9:	49 89 d7             	mov    %rdx,%r15
+  802fec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ff0:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802ffc:	4d 85 ff             	test   %r15,%r15
+  802fff:	0f 84 af 00 00 00    	je     8030b4 <devpipe_write+0xe2>
+  803005:	48 89 c3             	mov    %rax,%rbx
+  803008:	4c 89 f8             	mov    %r15,%rax
+  80300b:	4d 89 ef             	mov    %r13,%r15
+  80300e:	4c 01 e8             	add    %r13,%rax
+  803011:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803015:	49 bd b3 12 80 00 00 	movabs $0x8012b3,%r13
+  80301c:	00 00 00 
+            sys_yield();
+  80301f:	49 be 50 12 80 00 00 	movabs $0x801250,%r14
+  803026:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803029:	8b 73 04             	mov    0x4(%rbx),%esi
+  80302c:	48 63 ce             	movslq %esi,%rcx
+  80302f:	48 63 03             	movslq (%rbx),%rax
+  803032:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803038:	48 39 c1             	cmp    %rax,%rcx
+  80303b:	72 2e                	jb     80306b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80303d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803042:	48 89 da             	mov    %rbx,%rdx
+  803045:	be 00 10 00 00       	mov    $0x1000,%esi
+  80304a:	4c 89 e7             	mov    %r12,%rdi
+  80304d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803050:	85 c0                	test   %eax,%eax
+  803052:	74 66                	je     8030ba <devpipe_write+0xe8>
+            sys_yield();
+  803054:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803057:	8b 73 04             	mov    0x4(%rbx),%esi
+  80305a:	48 63 ce             	movslq %esi,%rcx
+  80305d:	48 63 03             	movslq (%rbx),%rax
+  803060:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803066:	48 39 c1             	cmp    %rax,%rcx
+  803069:	73 d2                	jae    80303d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80306b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80306f:	48 89 ca             	mov    %rcx,%rdx
+  803072:	48 c1 ea 03          	shr    $0x3,%rdx
+  803076:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80307d:	08 10 20 
+  803080:	48 f7 e2             	mul    %rdx
+  803083:	48 c1 ea 06          	shr    $0x6,%rdx
+  803087:	48 89 d0             	mov    %rdx,%rax
+  80308a:	48 c1 e0 09          	shl    $0x9,%rax
+  80308e:	48 29 d0             	sub    %rdx,%rax
+  803091:	48 c1 e0 03          	shl    $0x3,%rax
+  803095:	48 29 c1             	sub    %rax,%rcx
+  803098:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80309d:	83 c6 01             	add    $0x1,%esi
+  8030a0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030a3:	49 83 c7 01          	add    $0x1,%r15
+  8030a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030ab:	49 39 c7             	cmp    %rax,%r15
+  8030ae:	0f 85 75 ff ff ff    	jne    803029 <devpipe_write+0x57>
+    return n;
+  8030b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030b8:	eb 05                	jmp    8030bf <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030bf:	48 83 c4 18          	add    $0x18,%rsp
+  8030c3:	5b                   	pop    %rbx
+  8030c4:	41 5c                	pop    %r12
+  8030c6:	41 5d                	pop    %r13
+  8030c8:	41 5e                	pop    %r14
+  8030ca:	41 5f                	pop    %r15
+  8030cc:	5d                   	pop    %rbp
+  8030cd:	c3                   	ret
+
+00000000008030ce <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030ce:	55                   	push   %rbp
+  8030cf:	48 89 e5             	mov    %rsp,%rbp
+  8030d2:	41 57                	push   %r15
+  8030d4:	41 56                	push   %r14
+  8030d6:	41 55                	push   %r13
+  8030d8:	41 54                	push   %r12
+  8030da:	53                   	push   %rbx
+  8030db:	48 83 ec 18          	sub    $0x18,%rsp
+  8030df:	49 89 fc             	mov    %rdi,%r12
+  8030e2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030ea:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+  8030f6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8030f9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030ff:	49 bd b3 12 80 00 00 	movabs $0x8012b3,%r13
+  803106:	00 00 00 
+            sys_yield();
+  803109:	49 be 50 12 80 00 00 	movabs $0x801250,%r14
+  803110:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803113:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803118:	74 7d                	je     803197 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80311a:	8b 03                	mov    (%rbx),%eax
+  80311c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80311f:	75 26                	jne    803147 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803121:	4d 85 ff             	test   %r15,%r15
+  803124:	75 77                	jne    80319d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803126:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80312b:	48 89 da             	mov    %rbx,%rdx
+  80312e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803133:	4c 89 e7             	mov    %r12,%rdi
+  803136:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	74 72                	je     8031af <devpipe_read+0xe1>
+            sys_yield();
+  80313d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803140:	8b 03                	mov    (%rbx),%eax
+  803142:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803145:	74 df                	je     803126 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803147:	48 63 c8             	movslq %eax,%rcx
+  80314a:	48 89 ca             	mov    %rcx,%rdx
+  80314d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803151:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803158:	08 10 20 
+  80315b:	48 89 d0             	mov    %rdx,%rax
+  80315e:	48 f7 e6             	mul    %rsi
+  803161:	48 c1 ea 06          	shr    $0x6,%rdx
+  803165:	48 89 d0             	mov    %rdx,%rax
+  803168:	48 c1 e0 09          	shl    $0x9,%rax
+  80316c:	48 29 d0             	sub    %rdx,%rax
+  80316f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803176:	00 
+  803177:	48 89 c8             	mov    %rcx,%rax
+  80317a:	48 29 d0             	sub    %rdx,%rax
+  80317d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803182:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803186:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80318a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80318d:	49 83 c7 01          	add    $0x1,%r15
+  803191:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803195:	75 83                	jne    80311a <devpipe_read+0x4c>
+    return n;
+  803197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80319b:	eb 03                	jmp    8031a0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80319d:	4c 89 f8             	mov    %r15,%rax
+}
+  8031a0:	48 83 c4 18          	add    $0x18,%rsp
+  8031a4:	5b                   	pop    %rbx
+  8031a5:	41 5c                	pop    %r12
+  8031a7:	41 5d                	pop    %r13
+  8031a9:	41 5e                	pop    %r14
+  8031ab:	41 5f                	pop    %r15
+  8031ad:	5d                   	pop    %rbp
+  8031ae:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b4:	eb ea                	jmp    8031a0 <devpipe_read+0xd2>
+
+00000000008031b6 <pipe>:
+pipe(int pfd[2]) {
+  8031b6:	55                   	push   %rbp
+  8031b7:	48 89 e5             	mov    %rsp,%rbp
+  8031ba:	41 55                	push   %r13
+  8031bc:	41 54                	push   %r12
+  8031be:	53                   	push   %rbx
+  8031bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8031c3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031c6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031ca:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+  8031d6:	89 c3                	mov    %eax,%ebx
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	0f 88 a0 01 00 00    	js     803380 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8031e0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ea:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f3:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803201:	85 c0                	test   %eax,%eax
+  803203:	0f 88 77 01 00 00    	js     803380 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803209:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80320d:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+  803219:	89 c3                	mov    %eax,%ebx
+  80321b:	85 c0                	test   %eax,%eax
+  80321d:	0f 88 43 01 00 00    	js     803366 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803223:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803228:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80322d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803231:	bf 00 00 00 00       	mov    $0x0,%edi
+  803236:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803244:	85 c0                	test   %eax,%eax
+  803246:	0f 88 1a 01 00 00    	js     803366 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80324c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803250:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+  80325c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80325f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803264:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803269:	48 89 c6             	mov    %rax,%rsi
+  80326c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803271:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+  80327d:	89 c3                	mov    %eax,%ebx
+  80327f:	85 c0                	test   %eax,%eax
+  803281:	0f 88 c5 00 00 00    	js     80334c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803287:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80328b:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+  803297:	48 89 c1             	mov    %rax,%rcx
+  80329a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032a0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ab:	4c 89 ee             	mov    %r13,%rsi
+  8032ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b3:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  8032ba:	00 00 00 
+  8032bd:	ff d0                	call   *%rax
+  8032bf:	89 c3                	mov    %eax,%ebx
+  8032c1:	85 c0                	test   %eax,%eax
+  8032c3:	78 6e                	js     803333 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032ca:	4c 89 ef             	mov    %r13,%rdi
+  8032cd:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  8032d4:	00 00 00 
+  8032d7:	ff d0                	call   *%rax
+  8032d9:	83 f8 02             	cmp    $0x2,%eax
+  8032dc:	0f 85 ab 00 00 00    	jne    80338d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8032e2:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8032e9:	00 00 
+  8032eb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032ef:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8032f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032f5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8032fc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803300:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803302:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803306:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80330d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803311:	48 bb 7c 19 80 00 00 	movabs $0x80197c,%rbx
+  803318:	00 00 00 
+  80331b:	ff d3                	call   *%rbx
+  80331d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803321:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803325:	ff d3                	call   *%rbx
+  803327:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80332c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803331:	eb 4d                	jmp    803380 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803333:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803338:	4c 89 ee             	mov    %r13,%rsi
+  80333b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803340:	48 b8 ab 13 80 00 00 	movabs $0x8013ab,%rax
+  803347:	00 00 00 
+  80334a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80334c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803351:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803355:	bf 00 00 00 00       	mov    $0x0,%edi
+  80335a:	48 b8 ab 13 80 00 00 	movabs $0x8013ab,%rax
+  803361:	00 00 00 
+  803364:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803366:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80336b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80336f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803374:	48 b8 ab 13 80 00 00 	movabs $0x8013ab,%rax
+  80337b:	00 00 00 
+  80337e:	ff d0                	call   *%rax
+}
+  803380:	89 d8                	mov    %ebx,%eax
+  803382:	48 83 c4 18          	add    $0x18,%rsp
+  803386:	5b                   	pop    %rbx
+  803387:	41 5c                	pop    %r12
+  803389:	41 5d                	pop    %r13
+  80338b:	5d                   	pop    %rbp
+  80338c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80338d:	48 b9 98 41 80 00 00 	movabs $0x804198,%rcx
+  803394:	00 00 00 
+  803397:	48 ba a8 40 80 00 00 	movabs $0x8040a8,%rdx
+  80339e:	00 00 00 
+  8033a1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033a6:	48 bf 87 41 80 00 00 	movabs $0x804187,%rdi
+  8033ad:	00 00 00 
+  8033b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b5:	49 b8 de 01 80 00 00 	movabs $0x8001de,%r8
+  8033bc:	00 00 00 
+  8033bf:	41 ff d0             	call   *%r8
+
+00000000008033c2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033c2:	55                   	push   %rbp
+  8033c3:	48 89 e5             	mov    %rsp,%rbp
+  8033c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033ce:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  8033d5:	00 00 00 
+  8033d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	78 35                	js     803413 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8033de:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033e2:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  8033e9:	00 00 00 
+  8033ec:	ff d0                	call   *%rax
+  8033ee:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033f1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033fb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033ff:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+  80340b:	85 c0                	test   %eax,%eax
+  80340d:	0f 94 c0             	sete   %al
+  803410:	0f b6 c0             	movzbl %al,%eax
+}
+  803413:	c9                   	leave
+  803414:	c3                   	ret
+
+0000000000803415 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803415:	48 89 f8             	mov    %rdi,%rax
+  803418:	48 c1 e8 27          	shr    $0x27,%rax
+  80341c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803423:	01 00 00 
+  803426:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80342a:	f6 c2 01             	test   $0x1,%dl
+  80342d:	74 6d                	je     80349c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80342f:	48 89 f8             	mov    %rdi,%rax
+  803432:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803436:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80343d:	01 00 00 
+  803440:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803444:	f6 c2 01             	test   $0x1,%dl
+  803447:	74 62                	je     8034ab <get_uvpt_entry+0x96>
+  803449:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803450:	01 00 00 
+  803453:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803457:	f6 c2 80             	test   $0x80,%dl
+  80345a:	75 4f                	jne    8034ab <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80345c:	48 89 f8             	mov    %rdi,%rax
+  80345f:	48 c1 e8 15          	shr    $0x15,%rax
+  803463:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80346a:	01 00 00 
+  80346d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803471:	f6 c2 01             	test   $0x1,%dl
+  803474:	74 44                	je     8034ba <get_uvpt_entry+0xa5>
+  803476:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80347d:	01 00 00 
+  803480:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803484:	f6 c2 80             	test   $0x80,%dl
+  803487:	75 31                	jne    8034ba <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803489:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80348d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803494:	01 00 00 
+  803497:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80349b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80349c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034a3:	01 00 00 
+  8034a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034aa:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034ab:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034b2:	01 00 00 
+  8034b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034b9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034c1:	01 00 00 
+  8034c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034c8:	c3                   	ret
+
+00000000008034c9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8034c9:	55                   	push   %rbp
+  8034ca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034cd:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034dc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034e1:	89 c1                	mov    %eax,%ecx
+  8034e3:	83 c9 04             	or     $0x4,%ecx
+  8034e6:	f6 c2 01             	test   $0x1,%dl
+  8034e9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034ec:	89 c1                	mov    %eax,%ecx
+  8034ee:	83 c9 02             	or     $0x2,%ecx
+  8034f1:	f6 c2 02             	test   $0x2,%dl
+  8034f4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8034f7:	89 c1                	mov    %eax,%ecx
+  8034f9:	83 c9 01             	or     $0x1,%ecx
+  8034fc:	48 85 d2             	test   %rdx,%rdx
+  8034ff:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803502:	89 c1                	mov    %eax,%ecx
+  803504:	83 c9 40             	or     $0x40,%ecx
+  803507:	f6 c6 04             	test   $0x4,%dh
+  80350a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80350d:	5d                   	pop    %rbp
+  80350e:	c3                   	ret
+
+000000000080350f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80350f:	55                   	push   %rbp
+  803510:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803513:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  80351a:	00 00 00 
+  80351d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80351f:	48 c1 e8 06          	shr    $0x6,%rax
+  803523:	83 e0 01             	and    $0x1,%eax
+}
+  803526:	5d                   	pop    %rbp
+  803527:	c3                   	ret
+
+0000000000803528 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803528:	55                   	push   %rbp
+  803529:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80352c:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803538:	48 c1 e8 05          	shr    $0x5,%rax
+  80353c:	83 e0 01             	and    $0x1,%eax
+}
+  80353f:	5d                   	pop    %rbp
+  803540:	c3                   	ret
+
+0000000000803541 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803541:	55                   	push   %rbp
+  803542:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803545:	48 b8 15 34 80 00 00 	movabs $0x803415,%rax
+  80354c:	00 00 00 
+  80354f:	ff d0                	call   *%rax
+  803551:	83 e0 01             	and    $0x1,%eax
+}
+  803554:	5d                   	pop    %rbp
+  803555:	c3                   	ret
+
+0000000000803556 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803556:	55                   	push   %rbp
+  803557:	48 89 e5             	mov    %rsp,%rbp
+  80355a:	41 57                	push   %r15
+  80355c:	41 56                	push   %r14
+  80355e:	41 55                	push   %r13
+  803560:	41 54                	push   %r12
+  803562:	53                   	push   %rbx
+  803563:	48 83 ec 18          	sub    $0x18,%rsp
+  803567:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80356b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80356f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803574:	49 bd 41 35 80 00 00 	movabs $0x803541,%r13
+  80357b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80357e:	49 bf c9 34 80 00 00 	movabs $0x8034c9,%r15
+  803585:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803588:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80358f:	00 00 00 
+  803592:	eb 0c                	jmp    8035a0 <foreach_shared_region+0x4a>
+  803594:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80359b:	4c 39 f3             	cmp    %r14,%rbx
+  80359e:	74 2e                	je     8035ce <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035a0:	48 89 df             	mov    %rbx,%rdi
+  8035a3:	41 ff d5             	call   *%r13
+  8035a6:	84 c0                	test   %al,%al
+  8035a8:	74 ea                	je     803594 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035aa:	48 89 df             	mov    %rbx,%rdi
+  8035ad:	41 ff d7             	call   *%r15
+  8035b0:	a8 40                	test   $0x40,%al
+  8035b2:	74 e0                	je     803594 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035b4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035bf:	48 89 df             	mov    %rbx,%rdi
+  8035c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035c6:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	79 c8                	jns    803594 <foreach_shared_region+0x3e>
+  8035cc:	eb 05                	jmp    8035d3 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035d3:	48 83 c4 18          	add    $0x18,%rsp
+  8035d7:	5b                   	pop    %rbx
+  8035d8:	41 5c                	pop    %r12
+  8035da:	41 5d                	pop    %r13
+  8035dc:	41 5e                	pop    %r14
+  8035de:	41 5f                	pop    %r15
+  8035e0:	5d                   	pop    %rbp
+  8035e1:	c3                   	ret
+
+00000000008035e2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8035e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e7:	c3                   	ret
+
+00000000008035e8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8035e8:	55                   	push   %rbp
+  8035e9:	48 89 e5             	mov    %rsp,%rbp
+  8035ec:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8035ef:	48 be bc 41 80 00 00 	movabs $0x8041bc,%rsi
+  8035f6:	00 00 00 
+  8035f9:	48 b8 53 0c 80 00 00 	movabs $0x800c53,%rax
+  803600:	00 00 00 
+  803603:	ff d0                	call   *%rax
+    return 0;
+}
+  803605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360a:	5d                   	pop    %rbp
+  80360b:	c3                   	ret
+
+000000000080360c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80360c:	55                   	push   %rbp
+  80360d:	48 89 e5             	mov    %rsp,%rbp
+  803610:	41 57                	push   %r15
+  803612:	41 56                	push   %r14
+  803614:	41 55                	push   %r13
+  803616:	41 54                	push   %r12
+  803618:	53                   	push   %rbx
+  803619:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803620:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803627:	48 85 d2             	test   %rdx,%rdx
+  80362a:	74 7a                	je     8036a6 <devcons_write+0x9a>
+  80362c:	49 89 d6             	mov    %rdx,%r14
+  80362f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803635:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80363a:	49 bf 4d 0e 80 00 00 	movabs $0x800e4d,%r15
+  803641:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803644:	4c 89 f3             	mov    %r14,%rbx
+  803647:	48 29 f3             	sub    %rsi,%rbx
+  80364a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80364f:	48 39 c3             	cmp    %rax,%rbx
+  803652:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803656:	4c 63 eb             	movslq %ebx,%r13
+  803659:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803660:	48 01 c6             	add    %rax,%rsi
+  803663:	4c 89 ea             	mov    %r13,%rdx
+  803666:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80366d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803670:	4c 89 ee             	mov    %r13,%rsi
+  803673:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80367a:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  803681:	00 00 00 
+  803684:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803686:	41 01 dc             	add    %ebx,%r12d
+  803689:	49 63 f4             	movslq %r12d,%rsi
+  80368c:	4c 39 f6             	cmp    %r14,%rsi
+  80368f:	72 b3                	jb     803644 <devcons_write+0x38>
+    return res;
+  803691:	49 63 c4             	movslq %r12d,%rax
+}
+  803694:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80369b:	5b                   	pop    %rbx
+  80369c:	41 5c                	pop    %r12
+  80369e:	41 5d                	pop    %r13
+  8036a0:	41 5e                	pop    %r14
+  8036a2:	41 5f                	pop    %r15
+  8036a4:	5d                   	pop    %rbp
+  8036a5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036ac:	eb e3                	jmp    803691 <devcons_write+0x85>
+
+00000000008036ae <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036ae:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036b6:	48 85 c0             	test   %rax,%rax
+  8036b9:	74 55                	je     803710 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036bb:	55                   	push   %rbp
+  8036bc:	48 89 e5             	mov    %rsp,%rbp
+  8036bf:	41 55                	push   %r13
+  8036c1:	41 54                	push   %r12
+  8036c3:	53                   	push   %rbx
+  8036c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036c8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036cb:	48 bb 83 11 80 00 00 	movabs $0x801183,%rbx
+  8036d2:	00 00 00 
+  8036d5:	49 bc 50 12 80 00 00 	movabs $0x801250,%r12
+  8036dc:	00 00 00 
+  8036df:	eb 03                	jmp    8036e4 <devcons_read+0x36>
+  8036e1:	41 ff d4             	call   *%r12
+  8036e4:	ff d3                	call   *%rbx
+  8036e6:	85 c0                	test   %eax,%eax
+  8036e8:	74 f7                	je     8036e1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8036ea:	48 63 d0             	movslq %eax,%rdx
+  8036ed:	78 13                	js     803702 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8036ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036f4:	83 f8 04             	cmp    $0x4,%eax
+  8036f7:	74 09                	je     803702 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8036f9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8036fd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803702:	48 89 d0             	mov    %rdx,%rax
+  803705:	48 83 c4 08          	add    $0x8,%rsp
+  803709:	5b                   	pop    %rbx
+  80370a:	41 5c                	pop    %r12
+  80370c:	41 5d                	pop    %r13
+  80370e:	5d                   	pop    %rbp
+  80370f:	c3                   	ret
+  803710:	48 89 d0             	mov    %rdx,%rax
+  803713:	c3                   	ret
+
+0000000000803714 <cputchar>:
+cputchar(int ch) {
+  803714:	55                   	push   %rbp
+  803715:	48 89 e5             	mov    %rsp,%rbp
+  803718:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80371c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803720:	be 01 00 00 00       	mov    $0x1,%esi
+  803725:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803729:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  803730:	00 00 00 
+  803733:	ff d0                	call   *%rax
+}
+  803735:	c9                   	leave
+  803736:	c3                   	ret
+
+0000000000803737 <getchar>:
+getchar(void) {
+  803737:	55                   	push   %rbp
+  803738:	48 89 e5             	mov    %rsp,%rbp
+  80373b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80373f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803744:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803748:	bf 00 00 00 00       	mov    $0x0,%edi
+  80374d:	48 b8 ed 1c 80 00 00 	movabs $0x801ced,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+  803759:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	78 06                	js     803765 <getchar+0x2e>
+  80375f:	74 08                	je     803769 <getchar+0x32>
+  803761:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803765:	89 d0                	mov    %edx,%eax
+  803767:	c9                   	leave
+  803768:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803769:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80376e:	eb f5                	jmp    803765 <getchar+0x2e>
+
+0000000000803770 <iscons>:
+iscons(int fdnum) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+  803774:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803778:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80377c:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  803783:	00 00 00 
+  803786:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803788:	85 c0                	test   %eax,%eax
+  80378a:	78 18                	js     8037a4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80378c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803790:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803797:	00 00 00 
+  80379a:	8b 00                	mov    (%rax),%eax
+  80379c:	39 02                	cmp    %eax,(%rdx)
+  80379e:	0f 94 c0             	sete   %al
+  8037a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8037a4:	c9                   	leave
+  8037a5:	c3                   	ret
+
+00000000008037a6 <opencons>:
+opencons(void) {
+  8037a6:	55                   	push   %rbp
+  8037a7:	48 89 e5             	mov    %rsp,%rbp
+  8037aa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037ae:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037b2:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  8037b9:	00 00 00 
+  8037bc:	ff d0                	call   *%rax
+  8037be:	85 c0                	test   %eax,%eax
+  8037c0:	78 49                	js     80380b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037c2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037cc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d5:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	78 26                	js     80380b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8037e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037e9:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8037f0:	00 00 
+  8037f2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8037f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037f8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8037ff:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  803806:	00 00 00 
+  803809:	ff d0                	call   *%rax
+}
+  80380b:	c9                   	leave
+  80380c:	c3                   	ret
+
+000000000080380d <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80380d:	55                   	push   %rbp
+  80380e:	48 89 e5             	mov    %rsp,%rbp
+  803811:	41 55                	push   %r13
+  803813:	41 54                	push   %r12
+  803815:	53                   	push   %rbx
+  803816:	48 83 ec 08          	sub    $0x8,%rsp
+  80381a:	49 89 fc             	mov    %rdi,%r12
+  80381d:	48 89 f7             	mov    %rsi,%rdi
+  803820:	48 89 d3             	mov    %rdx,%rbx
+  803823:	49 89 cd             	mov    %rcx,%r13
+  803826:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803829:	48 85 f6             	test   %rsi,%rsi
+  80382c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803833:	00 00 00 
+  803836:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80383a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80383f:	48 85 db             	test   %rbx,%rbx
+  803842:	74 03                	je     803847 <ipc_recv_timed+0x3a>
+  803844:	48 8b 33             	mov    (%rbx),%rsi
+  803847:	48 b8 79 15 80 00 00 	movabs $0x801579,%rax
+  80384e:	00 00 00 
+  803851:	ff d0                	call   *%rax
+    if (res < 0) {
+  803853:	85 c0                	test   %eax,%eax
+  803855:	78 75                	js     8038cc <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803857:	4d 85 e4             	test   %r12,%r12
+  80385a:	74 14                	je     803870 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80385c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803863:	00 00 00 
+  803866:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80386c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803870:	4d 85 ed             	test   %r13,%r13
+  803873:	74 14                	je     803889 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803875:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80387c:	00 00 00 
+  80387f:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803885:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803889:	48 85 db             	test   %rbx,%rbx
+  80388c:	74 23                	je     8038b1 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80388e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803895:	00 00 00 
+  803898:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80389e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a3:	85 c9                	test   %ecx,%ecx
+  8038a5:	74 07                	je     8038ae <ipc_recv_timed+0xa1>
+  8038a7:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8038ae:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8038b1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038b8:	00 00 00 
+  8038bb:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8038c1:	48 83 c4 08          	add    $0x8,%rsp
+  8038c5:	5b                   	pop    %rbx
+  8038c6:	41 5c                	pop    %r12
+  8038c8:	41 5d                	pop    %r13
+  8038ca:	5d                   	pop    %rbp
+  8038cb:	c3                   	ret
+        if (from_env_store != NULL) {
+  8038cc:	4d 85 e4             	test   %r12,%r12
+  8038cf:	74 08                	je     8038d9 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8038d1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038d8:	00 
+        if (perm_store != NULL) {
+  8038d9:	4d 85 ed             	test   %r13,%r13
+  8038dc:	74 08                	je     8038e6 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8038de:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8038e5:	00 
+        if (size != NULL) {
+  8038e6:	48 85 db             	test   %rbx,%rbx
+  8038e9:	74 d6                	je     8038c1 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8038eb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8038f2:	eb cd                	jmp    8038c1 <ipc_recv_timed+0xb4>
+
+00000000008038f4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8038f4:	55                   	push   %rbp
+  8038f5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8038f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8038fe:	48 b8 0d 38 80 00 00 	movabs $0x80380d,%rax
+  803905:	00 00 00 
+  803908:	ff d0                	call   *%rax
+}
+  80390a:	5d                   	pop    %rbp
+  80390b:	c3                   	ret
+
+000000000080390c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	41 57                	push   %r15
+  803912:	41 56                	push   %r14
+  803914:	41 55                	push   %r13
+  803916:	41 54                	push   %r12
+  803918:	53                   	push   %rbx
+  803919:	48 83 ec 18          	sub    $0x18,%rsp
+  80391d:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803920:	48 89 d3             	mov    %rdx,%rbx
+  803923:	49 89 cc             	mov    %rcx,%r12
+  803926:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803929:	48 85 d2             	test   %rdx,%rdx
+  80392c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803933:	00 00 00 
+  803936:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80393a:	89 f0                	mov    %esi,%eax
+  80393c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803940:	48 89 da             	mov    %rbx,%rdx
+  803943:	48 89 c6             	mov    %rax,%rsi
+  803946:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  80394d:	00 00 00 
+  803950:	ff d0                	call   *%rax
+    while (res < 0) {
+  803952:	85 c0                	test   %eax,%eax
+  803954:	79 65                	jns    8039bb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803956:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803959:	75 33                	jne    80398e <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80395b:	49 bf 50 12 80 00 00 	movabs $0x801250,%r15
+  803962:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803965:	49 be 4d 15 80 00 00 	movabs $0x80154d,%r14
+  80396c:	00 00 00 
+        sys_yield();
+  80396f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803972:	45 89 e8             	mov    %r13d,%r8d
+  803975:	4c 89 e1             	mov    %r12,%rcx
+  803978:	48 89 da             	mov    %rbx,%rdx
+  80397b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80397f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803982:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803985:	85 c0                	test   %eax,%eax
+  803987:	79 32                	jns    8039bb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803989:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80398c:	74 e1                	je     80396f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80398e:	89 c1                	mov    %eax,%ecx
+  803990:	48 ba c8 41 80 00 00 	movabs $0x8041c8,%rdx
+  803997:	00 00 00 
+  80399a:	be 52 00 00 00       	mov    $0x52,%esi
+  80399f:	48 bf dc 41 80 00 00 	movabs $0x8041dc,%rdi
+  8039a6:	00 00 00 
+  8039a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ae:	49 b8 de 01 80 00 00 	movabs $0x8001de,%r8
+  8039b5:	00 00 00 
+  8039b8:	41 ff d0             	call   *%r8
+    }
+}
+  8039bb:	48 83 c4 18          	add    $0x18,%rsp
+  8039bf:	5b                   	pop    %rbx
+  8039c0:	41 5c                	pop    %r12
+  8039c2:	41 5d                	pop    %r13
+  8039c4:	41 5e                	pop    %r14
+  8039c6:	41 5f                	pop    %r15
+  8039c8:	5d                   	pop    %rbp
+  8039c9:	c3                   	ret
+
+00000000008039ca <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8039ca:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8039cf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8039d6:	00 00 00 
+  8039d9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039dd:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039e1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039e5:	48 01 ca             	add    %rcx,%rdx
+  8039e8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8039ee:	39 fa                	cmp    %edi,%edx
+  8039f0:	74 12                	je     803a04 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8039f2:	48 83 c0 01          	add    $0x1,%rax
+  8039f6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8039fc:	75 db                	jne    8039d9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8039fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a03:	c3                   	ret
+            return envs[i].env_id;
+  803a04:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a08:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a0c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a10:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a17:	00 00 00 
+  803a1a:	48 01 d0             	add    %rdx,%rax
+  803a1d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a23:	c3                   	ret
+  803a24:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803a28 <__rodata_start>:
+  803a28:	66 61                	data16 (bad)
+  803a2a:	75 6c                	jne    803a98 <__rodata_start+0x70>
+  803a2c:	74 20                	je     803a4e <__rodata_start+0x26>
+  803a2e:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  803a33:	75 73                	jne    803aa8 <__rodata_start+0x80>
+  803a35:	65 72 2f             	gs jb  803a67 <__rodata_start+0x3f>
+  803a38:	66 61                	data16 (bad)
+  803a3a:	75 6c                	jne    803aa8 <__rodata_start+0x80>
+  803a3c:	74 61                	je     803a9f <__rodata_start+0x77>
+  803a3e:	6c                   	insb   (%dx),%es:(%rdi)
+  803a3f:	6c                   	insb   (%dx),%es:(%rdi)
+  803a40:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a41:	63 62 61             	movsxd 0x61(%rdx),%esp
+  803a44:	64 2e 63 00          	fs movsxd %fs:(%rax),%eax
+  803a48:	61                   	(bad)
+  803a49:	6c                   	insb   (%dx),%es:(%rdi)
+  803a4a:	6c                   	insb   (%dx),%es:(%rdi)
+  803a4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a4c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803a4f:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  803a56:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  803a5b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a5c:	20 70 61             	and    %dh,0x61(%rax)
+  803a5f:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  803a64:	75 6c                	jne    803ad2 <__rodata_start+0xaa>
+  803a66:	74 20                	je     803a88 <__rodata_start+0x60>
+  803a68:	68 61 6e 64 6c       	push   $0x6c646e61
+  803a6d:	65 72 3a             	gs jb  803aaa <__rodata_start+0x82>
+  803a70:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 803adf <__rodata_start+0xb7>
+  803a76:	00 00                	add    %al,(%rax)
+  803a78:	74 68                	je     803ae2 <__rodata_start+0xba>
+  803a7a:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  803a81:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a82:	67 20 77 61          	and    %dh,0x61(%edi)
+  803a86:	73 20                	jae    803aa8 <__rodata_start+0x80>
+  803a88:	66 61                	data16 (bad)
+  803a8a:	75 6c                	jne    803af8 <__rodata_start+0xd0>
+  803a8c:	74 65                	je     803af3 <__rodata_start+0xcb>
+  803a8e:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803a92:	20 61 74             	and    %ah,0x74(%rcx)
+  803a95:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80b307 <__bss_end+0x3c002307>
+  803a9b:	75 6e                	jne    803b0b <__rodata_start+0xe3>
+  803a9d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803aa1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aa2:	3e 00 0f             	ds add %cl,(%rdi)
+  803aa5:	1f                   	(bad)
+  803aa6:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  803aaa:	30 38                	xor    %bh,(%rax)
+  803aac:	78 5d                	js     803b0b <__rodata_start+0xe3>
+  803aae:	20 75 73             	and    %dh,0x73(%rbp)
+  803ab1:	65 72 20             	gs jb  803ad4 <__rodata_start+0xac>
+  803ab4:	70 61                	jo     803b17 <__rodata_start+0xef>
+  803ab6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ab7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803abe:	73 20                	jae    803ae0 <__rodata_start+0xb8>
+  803ac0:	61                   	(bad)
+  803ac1:	74 20                	je     803ae3 <__rodata_start+0xbb>
+  803ac3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803ac8:	3a 20                	cmp    (%rax),%ah
+  803aca:	00 30                	add    %dh,(%rax)
+  803acc:	31 32                	xor    %esi,(%rdx)
+  803ace:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ad5:	41                   	rex.B
+  803ad6:	42                   	rex.X
+  803ad7:	43                   	rex.XB
+  803ad8:	44                   	rex.R
+  803ad9:	45                   	rex.RB
+  803ada:	46 00 30             	rex.RX add %r14b,(%rax)
+  803add:	31 32                	xor    %esi,(%rdx)
+  803adf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ae6:	61                   	(bad)
+  803ae7:	62 63 64 65 66       	(bad)
+  803aec:	00 28                	add    %ch,(%rax)
+  803aee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aef:	75 6c                	jne    803b5d <__rodata_start+0x135>
+  803af1:	6c                   	insb   (%dx),%es:(%rdi)
+  803af2:	29 00                	sub    %eax,(%rax)
+  803af4:	65 72 72             	gs jb  803b69 <__rodata_start+0x141>
+  803af7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af8:	72 20                	jb     803b1a <__rodata_start+0xf2>
+  803afa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803aff:	73 70                	jae    803b71 <__rodata_start+0x149>
+  803b01:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b05:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b0d:	72 00                	jb     803b0f <__rodata_start+0xe7>
+  803b0f:	62 61 64 20 65       	(bad)
+  803b14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b15:	76 69                	jbe    803b80 <__rodata_start+0x158>
+  803b17:	72 6f                	jb     803b88 <__rodata_start+0x160>
+  803b19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1a:	6d                   	insl   (%dx),%es:(%rdi)
+  803b1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b1d:	74 00                	je     803b1f <__rodata_start+0xf7>
+  803b1f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b26:	20 70 61             	and    %dh,0x61(%rax)
+  803b29:	72 61                	jb     803b8c <__rodata_start+0x164>
+  803b2b:	6d                   	insl   (%dx),%es:(%rdi)
+  803b2c:	65 74 65             	gs je  803b94 <__rodata_start+0x16c>
+  803b2f:	72 00                	jb     803b31 <__rodata_start+0x109>
+  803b31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b32:	75 74                	jne    803ba8 <__rodata_start+0x180>
+  803b34:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b37:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b3a:	6d                   	insl   (%dx),%es:(%rdi)
+  803b3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b3c:	72 79                	jb     803bb7 <__rodata_start+0x18f>
+  803b3e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b41:	74 20                	je     803b63 <__rodata_start+0x13b>
+  803b43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b44:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b48:	76 69                	jbe    803bb3 <__rodata_start+0x18b>
+  803b4a:	72 6f                	jb     803bbb <__rodata_start+0x193>
+  803b4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b4d:	6d                   	insl   (%dx),%es:(%rdi)
+  803b4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b50:	74 73                	je     803bc5 <__rodata_start+0x19d>
+  803b52:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b55:	72 72                	jb     803bc9 <__rodata_start+0x1a1>
+  803b57:	75 70                	jne    803bc9 <__rodata_start+0x1a1>
+  803b59:	74 65                	je     803bc0 <__rodata_start+0x198>
+  803b5b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b60:	75 67                	jne    803bc9 <__rodata_start+0x1a1>
+  803b62:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b65:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b67:	00 73 65             	add    %dh,0x65(%rbx)
+  803b6a:	67 6d                	insl   (%dx),%es:(%edi)
+  803b6c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b6e:	74 61                	je     803bd1 <__rodata_start+0x1a9>
+  803b70:	74 69                	je     803bdb <__rodata_start+0x1b3>
+  803b72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b73:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b74:	20 66 61             	and    %ah,0x61(%rsi)
+  803b77:	75 6c                	jne    803be5 <__rodata_start+0x1bd>
+  803b79:	74 00                	je     803b7b <__rodata_start+0x153>
+  803b7b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b82:	20 45 4c             	and    %al,0x4c(%rbp)
+  803b85:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803b89:	61                   	(bad)
+  803b8a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803b8f:	20 73 75             	and    %dh,0x75(%rbx)
+  803b92:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803b95:	73 79                	jae    803c10 <__rodata_start+0x1e8>
+  803b97:	73 74                	jae    803c0d <__rodata_start+0x1e5>
+  803b99:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b9b:	20 63 61             	and    %ah,0x61(%rbx)
+  803b9e:	6c                   	insb   (%dx),%es:(%rdi)
+  803b9f:	6c                   	insb   (%dx),%es:(%rdi)
+  803ba0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803ba3:	74 72                	je     803c17 <__rodata_start+0x1ef>
+  803ba5:	79 20                	jns    803bc7 <__rodata_start+0x19f>
+  803ba7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ba9:	74 20                	je     803bcb <__rodata_start+0x1a3>
+  803bab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bad:	75 6e                	jne    803c1d <__rodata_start+0x1f5>
+  803baf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803bb3:	76 20                	jbe    803bd5 <__rodata_start+0x1ad>
+  803bb5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803bbc:	72 65                	jb     803c23 <__rodata_start+0x1fb>
+  803bbe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803bc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bc2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803bc6:	65 78 70             	gs js  803c39 <__rodata_start+0x211>
+  803bc9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803bce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803bd1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803bd5:	20 66 69             	and    %ah,0x69(%rsi)
+  803bd8:	6c                   	insb   (%dx),%es:(%rdi)
+  803bd9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803bdd:	20 66 72             	and    %ah,0x72(%rsi)
+  803be0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803be5:	61                   	(bad)
+  803be6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803be9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803beb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803bef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf4:	20 6d 61             	and    %ch,0x61(%rbp)
+  803bf7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf8:	79 20                	jns    803c1a <__rodata_start+0x1f2>
+  803bfa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c01:	72 65                	jb     803c68 <__rodata_start+0x240>
+  803c03:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c08:	00 66 69             	add    %ah,0x69(%rsi)
+  803c0b:	6c                   	insb   (%dx),%es:(%rdi)
+  803c0c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c10:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c14:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c19:	74 20                	je     803c3b <__rodata_start+0x213>
+  803c1b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c1d:	75 6e                	jne    803c8d <__rodata_start+0x265>
+  803c1f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c23:	76 61                	jbe    803c86 <__rodata_start+0x25e>
+  803c25:	6c                   	insb   (%dx),%es:(%rdi)
+  803c26:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c2d:	00 
+  803c2e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c35:	72 65                	jb     803c9c <__rodata_start+0x274>
+  803c37:	61                   	(bad)
+  803c38:	64 79 20             	fs jns 803c5b <__rodata_start+0x233>
+  803c3b:	65 78 69             	gs js  803ca7 <__rodata_start+0x27f>
+  803c3e:	73 74                	jae    803cb4 <__rodata_start+0x28c>
+  803c40:	73 00                	jae    803c42 <__rodata_start+0x21a>
+  803c42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c43:	70 65                	jo     803caa <__rodata_start+0x282>
+  803c45:	72 61                	jb     803ca8 <__rodata_start+0x280>
+  803c47:	74 69                	je     803cb2 <__rodata_start+0x28a>
+  803c49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c4b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c4e:	74 20                	je     803c70 <__rodata_start+0x248>
+  803c50:	73 75                	jae    803cc7 <__rodata_start+0x29f>
+  803c52:	70 70                	jo     803cc4 <__rodata_start+0x29c>
+  803c54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c55:	72 74                	jb     803ccb <__rodata_start+0x2a3>
+  803c57:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803c5d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803c62:	74 00                	je     803c64 <__rodata_start+0x23c>
+  803c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c6b:	00 00 00 
+  803c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c75:	00 00 00 
+  803c78:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803c7f:	00 
+  803c80:	1b 05 80 00 00 00    	sbb    0x80(%rip),%eax        # 803d06 <__rodata_start+0x2de>
+  803c86:	00 00                	add    %al,(%rax)
+  803c88:	5c                   	pop    %rsp
+  803c89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c8f:	00 4c 0b 80          	add    %cl,-0x80(%rbx,%rcx,1)
+  803c93:	00 00                	add    %al,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803c9b:	00 00                	add    %al,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ca3:	00 00                	add    %al,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803cab:	00 00                	add    %al,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803cb3:	00 00                	add    %al,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 3a                	add    %bh,(%rdx)
+  803cb9:	05 80 00 00 00       	add    $0x80,%eax
+  803cbe:	00 00                	add    %al,(%rax)
+  803cc0:	5c                   	pop    %rsp
+  803cc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cc7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 2e                	add    %ch,(%rsi)
+  803cd1:	05 80 00 00 00       	add    $0x80,%eax
+  803cd6:	00 00                	add    %al,(%rax)
+  803cd8:	a8 05                	test   $0x5,%al
+  803cda:	80 00 00             	addb   $0x0,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ce3:	00 00                	add    %al,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 2e                	add    %ch,(%rsi)
+  803ce9:	05 80 00 00 00       	add    $0x80,%eax
+  803cee:	00 00                	add    %al,(%rax)
+  803cf0:	74 05                	je     803cf7 <__rodata_start+0x2cf>
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803cfb:	00 00                	add    %al,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d03:	00 00                	add    %al,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d0b:	00 00                	add    %al,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d1b:	00 00                	add    %al,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d23:	00 00                	add    %al,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  803d33:	00 00                	add    %al,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d3b:	00 00                	add    %al,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d43:	00 00                	add    %al,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d4b:	00 00                	add    %al,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d53:	00 00                	add    %al,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d5b:	00 00                	add    %al,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d63:	00 00                	add    %al,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d6b:	00 00                	add    %al,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d83:	00 00                	add    %al,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d93:	00 00                	add    %al,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803d9b:	00 00                	add    %al,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dab:	00 00                	add    %al,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dbb:	00 00                	add    %al,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dc3:	00 00                	add    %al,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dcb:	00 00                	add    %al,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dd3:	00 00                	add    %al,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ddb:	00 00                	add    %al,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803de3:	00 00                	add    %al,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803df3:	00 00                	add    %al,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803dfb:	00 00                	add    %al,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e03:	00 00                	add    %al,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e0b:	00 00                	add    %al,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e13:	00 00                	add    %al,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e1b:	00 00                	add    %al,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e23:	00 00                	add    %al,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 7f 0a             	add    %bh,0xa(%rdi)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e33:	00 00                	add    %al,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e3b:	00 00                	add    %al,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e43:	00 00                	add    %al,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e4b:	00 00                	add    %al,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e53:	00 00                	add    %al,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e5b:	00 00                	add    %al,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e63:	00 00                	add    %al,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e6b:	00 00                	add    %al,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e73:	00 00                	add    %al,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e7b:	00 00                	add    %al,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 cb                	add    %cl,%bl
+  803e81:	05 80 00 00 00       	add    $0x80,%eax
+  803e86:	00 00                	add    %al,(%rax)
+  803e88:	9a                   	(bad)
+  803e89:	07                   	(bad)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e93:	00 00                	add    %al,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803e9b:	00 00                	add    %al,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ea3:	00 00                	add    %al,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803eab:	00 00                	add    %al,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 fa                	add    %bh,%dl
+  803eb1:	05 80 00 00 00       	add    $0x80,%eax
+  803eb6:	00 00                	add    %al,(%rax)
+  803eb8:	5c                   	pop    %rsp
+  803eb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ebf:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ec3:	00 00                	add    %al,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 c0                	add    %al,%al
+  803ec9:	05 80 00 00 00       	add    $0x80,%eax
+  803ece:	00 00                	add    %al,(%rax)
+  803ed0:	5c                   	pop    %rsp
+  803ed1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ed7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803edb:	00 00                	add    %al,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 42 09             	add    %al,0x9(%rdx)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  803eea:	80 00 00             	addb   $0x0,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803ef3:	00 00                	add    %al,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803efb:	00 00                	add    %al,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 91 06 80 00 00    	add    %dl,0x8006(%rcx)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803f0b:	00 00                	add    %al,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 6e 08             	add    %ch,0x8(%rsi)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803f1b:	00 00                	add    %al,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803f23:	00 00                	add    %al,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 7f 0a             	add    %bh,0xa(%rdi)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 5c 0b 80          	add    %bl,-0x80(%rbx,%rcx,1)
+  803f33:	00 00                	add    %al,(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 24 05 80 00 00 00 	add    %ah,0x80(,%rax,1)
+	...
+
+0000000000803f40 <error_string>:
+	...
+  803f48:	fd 3a 80 00 00 00 00 00 0f 3b 80 00 00 00 00 00     .:.......;......
+  803f58:	1f 3b 80 00 00 00 00 00 31 3b 80 00 00 00 00 00     .;......1;......
+  803f68:	3f 3b 80 00 00 00 00 00 53 3b 80 00 00 00 00 00     ?;......S;......
+  803f78:	68 3b 80 00 00 00 00 00 7b 3b 80 00 00 00 00 00     h;......{;......
+  803f88:	8d 3b 80 00 00 00 00 00 a1 3b 80 00 00 00 00 00     .;.......;......
+  803f98:	b1 3b 80 00 00 00 00 00 c4 3b 80 00 00 00 00 00     .;.......;......
+  803fa8:	db 3b 80 00 00 00 00 00 f1 3b 80 00 00 00 00 00     .;.......;......
+  803fb8:	09 3c 80 00 00 00 00 00 21 3c 80 00 00 00 00 00     .<......!<......
+  803fc8:	2e 3c 80 00 00 00 00 00 e8 3f 80 00 00 00 00 00     .<.......?......
+  803fd8:	42 3c 80 00 00 00 00 00 5a 3c 80 00 00 00 00 00     B<......Z<......
+  803fe8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803ff8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804008:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804018:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804028:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804038:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804048:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804058:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804068:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804078:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804088:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804098:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8040a8:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  8040b8:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  8040c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8040d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  8040e8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  8040f8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804108:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804118:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804128:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804138:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804148:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804158:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804160 <devtab>:
+  804160:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804170:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804180:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804190:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8041a0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8041b0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8041c0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  8041d0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8041e0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8041f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804200:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804210:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804220:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804230:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804240:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804250:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804260:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804270:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804280:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804290:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
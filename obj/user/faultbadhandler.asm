@@ -0,0 +1,6632 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * we outrun the stack with invocations of the user-level handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xDEADBEEF);
+  80004e:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 d0 04 80 00 00 	movabs $0x8004d0,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	41 89 fd             	mov    %edi,%r13d
+  80007f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800082:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800089:	00 00 00 
+  80008c:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800093:	00 00 00 
+  800096:	48 39 c2             	cmp    %rax,%rdx
+  800099:	73 17                	jae    8000b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	49 89 c4             	mov    %rax,%r12
+  8000a1:	48 83 c3 08          	add    $0x8,%rbx
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ad:	4c 39 e3             	cmp    %r12,%rbx
+  8000b0:	72 ef                	jb     8000a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b2:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+  8000be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000c7:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000cb:	48 c1 e0 04          	shl    $0x4,%rax
+  8000cf:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d6:	00 00 00 
+  8000d9:	48 01 d0             	add    %rdx,%rax
+  8000dc:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e6:	45 85 ed             	test   %r13d,%r13d
+  8000e9:	7e 0d                	jle    8000f8 <libmain+0x87>
+  8000eb:	49 8b 06             	mov    (%r14),%rax
+  8000ee:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000f5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f8:	4c 89 f6             	mov    %r14,%rsi
+  8000fb:	44 89 ef             	mov    %r13d,%edi
+  8000fe:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80010a:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  800111:	00 00 00 
+  800114:	ff d0                	call   *%rax
+#endif
+}
+  800116:	5b                   	pop    %rbx
+  800117:	41 5c                	pop    %r12
+  800119:	41 5d                	pop    %r13
+  80011b:	41 5e                	pop    %r14
+  80011d:	5d                   	pop    %rbp
+  80011e:	c3                   	ret
+
+000000000080011f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80011f:	55                   	push   %rbp
+  800120:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800123:	48 b8 c1 08 80 00 00 	movabs $0x8008c1,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80012f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800134:	48 b8 a0 01 80 00 00 	movabs $0x8001a0,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+}
+  800140:	5d                   	pop    %rbp
+  800141:	c3                   	ret
+
+0000000000800142 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800142:	55                   	push   %rbp
+  800143:	48 89 e5             	mov    %rsp,%rbp
+  800146:	53                   	push   %rbx
+  800147:	48 89 fa             	mov    %rdi,%rdx
+  80014a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80014d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800157:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015c:	be 00 00 00 00       	mov    $0x0,%esi
+  800161:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800167:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800169:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016d:	c9                   	leave
+  80016e:	c3                   	ret
+
+000000000080016f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800174:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800188:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80018d:	be 00 00 00 00       	mov    $0x0,%esi
+  800192:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800198:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80019a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+
+00000000008001a0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8001a0:	55                   	push   %rbp
+  8001a1:	48 89 e5             	mov    %rsp,%rbp
+  8001a4:	53                   	push   %rbx
+  8001a5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ac:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001cd:	48 85 c0             	test   %rax,%rax
+  8001d0:	7f 06                	jg     8001d8 <sys_env_destroy+0x38>
+}
+  8001d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d6:	c9                   	leave
+  8001d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d8:	49 89 c0             	mov    %rax,%r8
+  8001db:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001e0:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ef:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+
+000000000080020b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80020b:	55                   	push   %rbp
+  80020c:	48 89 e5             	mov    %rsp,%rbp
+  80020f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800210:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800215:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800224:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800229:	be 00 00 00 00       	mov    $0x0,%esi
+  80022e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800234:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800236:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+000000000080023c <sys_yield>:
+
+void
+sys_yield(void) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800241:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80024b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800255:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025a:	be 00 00 00 00       	mov    $0x0,%esi
+  80025f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800265:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026b:	c9                   	leave
+  80026c:	c3                   	ret
+
+000000000080026d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80026d:	55                   	push   %rbp
+  80026e:	48 89 e5             	mov    %rsp,%rbp
+  800271:	53                   	push   %rbx
+  800272:	48 89 fa             	mov    %rdi,%rdx
+  800275:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800278:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80027d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800284:	00 00 00 
+  800287:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80028c:	be 00 00 00 00       	mov    $0x0,%esi
+  800291:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800297:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800299:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029d:	c9                   	leave
+  80029e:	c3                   	ret
+
+000000000080029f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80029f:	55                   	push   %rbp
+  8002a0:	48 89 e5             	mov    %rsp,%rbp
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 f8             	mov    %rdi,%r8
+  8002a7:	48 89 d3             	mov    %rdx,%rbx
+  8002aa:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002ad:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b2:	4c 89 c2             	mov    %r8,%rdx
+  8002b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c9:	c9                   	leave
+  8002ca:	c3                   	ret
+
+00000000008002cb <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002cb:	55                   	push   %rbp
+  8002cc:	48 89 e5             	mov    %rsp,%rbp
+  8002cf:	53                   	push   %rbx
+  8002d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d4:	89 f8                	mov    %edi,%eax
+  8002d6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d9:	48 63 f9             	movslq %ecx,%rdi
+  8002dc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002df:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002e4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002f4:	48 85 c0             	test   %rax,%rax
+  8002f7:	7f 06                	jg     8002ff <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ff:	49 89 c0             	mov    %rax,%r8
+  800302:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800307:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80030e:	00 00 00 
+  800311:	be 26 00 00 00       	mov    $0x26,%esi
+  800316:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  80031d:	00 00 00 
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  80032c:	00 00 00 
+  80032f:	41 ff d1             	call   *%r9
+
+0000000000800332 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800332:	55                   	push   %rbp
+  800333:	48 89 e5             	mov    %rsp,%rbp
+  800336:	53                   	push   %rbx
+  800337:	48 83 ec 08          	sub    $0x8,%rsp
+  80033b:	89 f8                	mov    %edi,%eax
+  80033d:	49 89 f2             	mov    %rsi,%r10
+  800340:	48 89 cf             	mov    %rcx,%rdi
+  800343:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800346:	48 63 da             	movslq %edx,%rbx
+  800349:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80034c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800351:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800354:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800357:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800359:	48 85 c0             	test   %rax,%rax
+  80035c:	7f 06                	jg     800364 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80035e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800362:	c9                   	leave
+  800363:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800364:	49 89 c0             	mov    %rax,%r8
+  800367:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80036c:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  800373:	00 00 00 
+  800376:	be 26 00 00 00       	mov    $0x26,%esi
+  80037b:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  800382:	00 00 00 
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  800391:	00 00 00 
+  800394:	41 ff d1             	call   *%r9
+
+0000000000800397 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800397:	55                   	push   %rbp
+  800398:	48 89 e5             	mov    %rsp,%rbp
+  80039b:	53                   	push   %rbx
+  80039c:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a0:	48 89 f1             	mov    %rsi,%rcx
+  8003a3:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8003a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003a9:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003c0:	48 85 c0             	test   %rax,%rax
+  8003c3:	7f 06                	jg     8003cb <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c9:	c9                   	leave
+  8003ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003cb:	49 89 c0             	mov    %rax,%r8
+  8003ce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003d3:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8003da:	00 00 00 
+  8003dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8003e2:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8003e9:	00 00 00 
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  8003f8:	00 00 00 
+  8003fb:	41 ff d1             	call   *%r9
+
+00000000008003fe <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003fe:	55                   	push   %rbp
+  8003ff:	48 89 e5             	mov    %rsp,%rbp
+  800402:	53                   	push   %rbx
+  800403:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800407:	48 63 ce             	movslq %esi,%rcx
+  80040a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80040d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800412:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800417:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80041c:	be 00 00 00 00       	mov    $0x0,%esi
+  800421:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800427:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800429:	48 85 c0             	test   %rax,%rax
+  80042c:	7f 06                	jg     800434 <sys_env_set_status+0x36>
+}
+  80042e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800432:	c9                   	leave
+  800433:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800434:	49 89 c0             	mov    %rax,%r8
+  800437:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80043c:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  800443:	00 00 00 
+  800446:	be 26 00 00 00       	mov    $0x26,%esi
+  80044b:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  800452:	00 00 00 
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  800461:	00 00 00 
+  800464:	41 ff d1             	call   *%r9
+
+0000000000800467 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	53                   	push   %rbx
+  80046c:	48 83 ec 08          	sub    $0x8,%rsp
+  800470:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800473:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800476:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80047b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800480:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800485:	be 00 00 00 00       	mov    $0x0,%esi
+  80048a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800490:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800492:	48 85 c0             	test   %rax,%rax
+  800495:	7f 06                	jg     80049d <sys_env_set_trapframe+0x36>
+}
+  800497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80049b:	c9                   	leave
+  80049c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80049d:	49 89 c0             	mov    %rax,%r8
+  8004a0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8004a5:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8004ac:	00 00 00 
+  8004af:	be 26 00 00 00       	mov    $0x26,%esi
+  8004b4:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8004bb:	00 00 00 
+  8004be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c3:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  8004ca:	00 00 00 
+  8004cd:	41 ff d1             	call   *%r9
+
+00000000008004d0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004d0:	55                   	push   %rbp
+  8004d1:	48 89 e5             	mov    %rsp,%rbp
+  8004d4:	53                   	push   %rbx
+  8004d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004df:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004fb:	48 85 c0             	test   %rax,%rax
+  8004fe:	7f 06                	jg     800506 <sys_env_set_pgfault_upcall+0x36>
+}
+  800500:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800504:	c9                   	leave
+  800505:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800506:	49 89 c0             	mov    %rax,%r8
+  800509:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80050e:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  800515:	00 00 00 
+  800518:	be 26 00 00 00       	mov    $0x26,%esi
+  80051d:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  800524:	00 00 00 
+  800527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052c:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  800533:	00 00 00 
+  800536:	41 ff d1             	call   *%r9
+
+0000000000800539 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800539:	55                   	push   %rbp
+  80053a:	48 89 e5             	mov    %rsp,%rbp
+  80053d:	53                   	push   %rbx
+  80053e:	89 f8                	mov    %edi,%eax
+  800540:	49 89 f1             	mov    %rsi,%r9
+  800543:	48 89 d3             	mov    %rdx,%rbx
+  800546:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800549:	49 63 f0             	movslq %r8d,%rsi
+  80054c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80054f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800554:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800557:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80055d:	cd 30                	int    $0x30
+}
+  80055f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	53                   	push   %rbx
+  80056a:	48 83 ec 08          	sub    $0x8,%rsp
+  80056e:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800571:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800574:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800579:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80057c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800581:	be 00 00 00 00       	mov    $0x0,%esi
+  800586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80058c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80058e:	48 85 c0             	test   %rax,%rax
+  800591:	7f 06                	jg     800599 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800597:	c9                   	leave
+  800598:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800599:	49 89 c0             	mov    %rax,%r8
+  80059c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005a1:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8005a8:	00 00 00 
+  8005ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b0:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8005b7:	00 00 00 
+  8005ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bf:	49 b9 2c 25 80 00 00 	movabs $0x80252c,%r9
+  8005c6:	00 00 00 
+  8005c9:	41 ff d1             	call   *%r9
+
+00000000008005cc <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8005cc:	55                   	push   %rbp
+  8005cd:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d5:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  8005dc:	00 00 00 
+  8005df:	ff d0                	call   *%rax
+}
+  8005e1:	5d                   	pop    %rbp
+  8005e2:	c3                   	ret
+
+00000000008005e3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005e3:	55                   	push   %rbp
+  8005e4:	48 89 e5             	mov    %rsp,%rbp
+  8005e7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800601:	be 00 00 00 00       	mov    $0x0,%esi
+  800606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80060e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800612:	c9                   	leave
+  800613:	c3                   	ret
+
+0000000000800614 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  800614:	55                   	push   %rbp
+  800615:	48 89 e5             	mov    %rsp,%rbp
+  800618:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  800619:	48 63 ce             	movslq %esi,%rcx
+  80061c:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  800620:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800625:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80062a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062f:	be 00 00 00 00       	mov    $0x0,%esi
+  800634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80063a:	cd 30                	int    $0x30
+}
+  80063c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800640:	c9                   	leave
+  800641:	c3                   	ret
+
+0000000000800642 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800642:	55                   	push   %rbp
+  800643:	48 89 e5             	mov    %rsp,%rbp
+  800646:	53                   	push   %rbx
+  800647:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80064a:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80064e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800658:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065d:	be 00 00 00 00       	mov    $0x0,%esi
+  800662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800668:	cd 30                	int    $0x30
+}
+  80066a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066e:	c9                   	leave
+  80066f:	c3                   	ret
+
+0000000000800670 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800670:	55                   	push   %rbp
+  800671:	48 89 e5             	mov    %rsp,%rbp
+  800674:	53                   	push   %rbx
+  800675:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800678:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80067b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800680:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800688:	be 00 00 00 00       	mov    $0x0,%esi
+  80068d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800693:	cd 30                	int    $0x30
+}
+  800695:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800699:	c9                   	leave
+  80069a:	c3                   	ret
+
+000000000080069b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80069b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006a2:	ff ff ff 
+  8006a5:	48 01 f8             	add    %rdi,%rax
+  8006a8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006ac:	c3                   	ret
+
+00000000008006ad <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006ad:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006b4:	ff ff ff 
+  8006b7:	48 01 f8             	add    %rdi,%rax
+  8006ba:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006be:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006c4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006c8:	c3                   	ret
+
+00000000008006c9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006c9:	55                   	push   %rbp
+  8006ca:	48 89 e5             	mov    %rsp,%rbp
+  8006cd:	41 57                	push   %r15
+  8006cf:	41 56                	push   %r14
+  8006d1:	41 55                	push   %r13
+  8006d3:	41 54                	push   %r12
+  8006d5:	53                   	push   %rbx
+  8006d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8006da:	49 89 ff             	mov    %rdi,%r15
+  8006dd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006e2:	49 bd e8 21 80 00 00 	movabs $0x8021e8,%r13
+  8006e9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006ec:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006f2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006f5:	48 89 df             	mov    %rbx,%rdi
+  8006f8:	41 ff d5             	call   *%r13
+  8006fb:	83 e0 04             	and    $0x4,%eax
+  8006fe:	74 17                	je     800717 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800700:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800707:	4c 39 f3             	cmp    %r14,%rbx
+  80070a:	75 e6                	jne    8006f2 <fd_alloc+0x29>
+  80070c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800712:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800717:	4d 89 27             	mov    %r12,(%r15)
+}
+  80071a:	48 83 c4 08          	add    $0x8,%rsp
+  80071e:	5b                   	pop    %rbx
+  80071f:	41 5c                	pop    %r12
+  800721:	41 5d                	pop    %r13
+  800723:	41 5e                	pop    %r14
+  800725:	41 5f                	pop    %r15
+  800727:	5d                   	pop    %rbp
+  800728:	c3                   	ret
+
+0000000000800729 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800729:	83 ff 1f             	cmp    $0x1f,%edi
+  80072c:	77 39                	ja     800767 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80072e:	55                   	push   %rbp
+  80072f:	48 89 e5             	mov    %rsp,%rbp
+  800732:	41 54                	push   %r12
+  800734:	53                   	push   %rbx
+  800735:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800738:	48 63 df             	movslq %edi,%rbx
+  80073b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800742:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800746:	48 89 df             	mov    %rbx,%rdi
+  800749:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	a8 04                	test   $0x4,%al
+  800757:	74 14                	je     80076d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800759:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80075d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800762:	5b                   	pop    %rbx
+  800763:	41 5c                	pop    %r12
+  800765:	5d                   	pop    %rbp
+  800766:	c3                   	ret
+        return -E_INVAL;
+  800767:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80076c:	c3                   	ret
+        return -E_INVAL;
+  80076d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800772:	eb ee                	jmp    800762 <fd_lookup+0x39>
+
+0000000000800774 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800774:	55                   	push   %rbp
+  800775:	48 89 e5             	mov    %rsp,%rbp
+  800778:	41 54                	push   %r12
+  80077a:	53                   	push   %rbx
+  80077b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80077e:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  800785:	00 00 00 
+  800788:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80078f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800792:	39 3b                	cmp    %edi,(%rbx)
+  800794:	74 47                	je     8007dd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800796:	48 83 c0 08          	add    $0x8,%rax
+  80079a:	48 8b 18             	mov    (%rax),%rbx
+  80079d:	48 85 db             	test   %rbx,%rbx
+  8007a0:	75 f0                	jne    800792 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007a2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8007a9:	00 00 00 
+  8007ac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007b2:	89 fa                	mov    %edi,%edx
+  8007b4:	48 bf 00 37 80 00 00 	movabs $0x803700,%rdi
+  8007bb:	00 00 00 
+  8007be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c3:	48 b9 7c 26 80 00 00 	movabs $0x80267c,%rcx
+  8007ca:	00 00 00 
+  8007cd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007d4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007d8:	5b                   	pop    %rbx
+  8007d9:	41 5c                	pop    %r12
+  8007db:	5d                   	pop    %rbp
+  8007dc:	c3                   	ret
+            return 0;
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	eb f0                	jmp    8007d4 <dev_lookup+0x60>
+
+00000000008007e4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007e4:	55                   	push   %rbp
+  8007e5:	48 89 e5             	mov    %rsp,%rbp
+  8007e8:	41 55                	push   %r13
+  8007ea:	41 54                	push   %r12
+  8007ec:	53                   	push   %rbx
+  8007ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8007f1:	48 89 fb             	mov    %rdi,%rbx
+  8007f4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007f7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007fe:	ff ff ff 
+  800801:	48 01 df             	add    %rbx,%rdi
+  800804:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800808:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80080c:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800813:	00 00 00 
+  800816:	ff d0                	call   *%rax
+  800818:	41 89 c5             	mov    %eax,%r13d
+  80081b:	85 c0                	test   %eax,%eax
+  80081d:	78 06                	js     800825 <fd_close+0x41>
+  80081f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800823:	74 1a                	je     80083f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800825:	45 84 e4             	test   %r12b,%r12b
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800831:	44 89 e8             	mov    %r13d,%eax
+  800834:	48 83 c4 18          	add    $0x18,%rsp
+  800838:	5b                   	pop    %rbx
+  800839:	41 5c                	pop    %r12
+  80083b:	41 5d                	pop    %r13
+  80083d:	5d                   	pop    %rbp
+  80083e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80083f:	8b 3b                	mov    (%rbx),%edi
+  800841:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800845:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  80084c:	00 00 00 
+  80084f:	ff d0                	call   *%rax
+  800851:	41 89 c5             	mov    %eax,%r13d
+  800854:	85 c0                	test   %eax,%eax
+  800856:	78 1b                	js     800873 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800858:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80085c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800860:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800866:	48 85 c0             	test   %rax,%rax
+  800869:	74 08                	je     800873 <fd_close+0x8f>
+  80086b:	48 89 df             	mov    %rbx,%rdi
+  80086e:	ff d0                	call   *%rax
+  800870:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800873:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800878:	48 89 de             	mov    %rbx,%rsi
+  80087b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800880:	48 b8 97 03 80 00 00 	movabs $0x800397,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+    return res;
+  80088c:	eb a3                	jmp    800831 <fd_close+0x4d>
+
+000000000080088e <close>:
+
+int
+close(int fdnum) {
+  80088e:	55                   	push   %rbp
+  80088f:	48 89 e5             	mov    %rsp,%rbp
+  800892:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800896:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80089a:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  8008a1:	00 00 00 
+  8008a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008a6:	85 c0                	test   %eax,%eax
+  8008a8:	78 15                	js     8008bf <close+0x31>
+
+    return fd_close(fd, 1);
+  8008aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8008af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008b3:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  8008ba:	00 00 00 
+  8008bd:	ff d0                	call   *%rax
+}
+  8008bf:	c9                   	leave
+  8008c0:	c3                   	ret
+
+00000000008008c1 <close_all>:
+
+void
+close_all(void) {
+  8008c1:	55                   	push   %rbp
+  8008c2:	48 89 e5             	mov    %rsp,%rbp
+  8008c5:	41 54                	push   %r12
+  8008c7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008cd:	49 bc 8e 08 80 00 00 	movabs $0x80088e,%r12
+  8008d4:	00 00 00 
+  8008d7:	89 df                	mov    %ebx,%edi
+  8008d9:	41 ff d4             	call   *%r12
+  8008dc:	83 c3 01             	add    $0x1,%ebx
+  8008df:	83 fb 20             	cmp    $0x20,%ebx
+  8008e2:	75 f3                	jne    8008d7 <close_all+0x16>
+}
+  8008e4:	5b                   	pop    %rbx
+  8008e5:	41 5c                	pop    %r12
+  8008e7:	5d                   	pop    %rbp
+  8008e8:	c3                   	ret
+
+00000000008008e9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008e9:	55                   	push   %rbp
+  8008ea:	48 89 e5             	mov    %rsp,%rbp
+  8008ed:	41 57                	push   %r15
+  8008ef:	41 56                	push   %r14
+  8008f1:	41 55                	push   %r13
+  8008f3:	41 54                	push   %r12
+  8008f5:	53                   	push   %rbx
+  8008f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8008fa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008fd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800901:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800908:	00 00 00 
+  80090b:	ff d0                	call   *%rax
+  80090d:	89 c3                	mov    %eax,%ebx
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	0f 88 b8 00 00 00    	js     8009cf <dup+0xe6>
+    close(newfdnum);
+  800917:	44 89 e7             	mov    %r12d,%edi
+  80091a:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  800921:	00 00 00 
+  800924:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800926:	4d 63 ec             	movslq %r12d,%r13
+  800929:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800930:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800934:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800938:	4c 89 ff             	mov    %r15,%rdi
+  80093b:	49 be ad 06 80 00 00 	movabs $0x8006ad,%r14
+  800942:	00 00 00 
+  800945:	41 ff d6             	call   *%r14
+  800948:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80094b:	4c 89 ef             	mov    %r13,%rdi
+  80094e:	41 ff d6             	call   *%r14
+  800951:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800954:	48 89 df             	mov    %rbx,%rdi
+  800957:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  80095e:	00 00 00 
+  800961:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800963:	a8 04                	test   $0x4,%al
+  800965:	74 2b                	je     800992 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800967:	41 89 c1             	mov    %eax,%r9d
+  80096a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800970:	4c 89 f1             	mov    %r14,%rcx
+  800973:	ba 00 00 00 00       	mov    $0x0,%edx
+  800978:	48 89 de             	mov    %rbx,%rsi
+  80097b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800980:	48 b8 32 03 80 00 00 	movabs $0x800332,%rax
+  800987:	00 00 00 
+  80098a:	ff d0                	call   *%rax
+  80098c:	89 c3                	mov    %eax,%ebx
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	78 4e                	js     8009e0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800992:	4c 89 ff             	mov    %r15,%rdi
+  800995:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  80099c:	00 00 00 
+  80099f:	ff d0                	call   *%rax
+  8009a1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009aa:	4c 89 e9             	mov    %r13,%rcx
+  8009ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b2:	4c 89 fe             	mov    %r15,%rsi
+  8009b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ba:	48 b8 32 03 80 00 00 	movabs $0x800332,%rax
+  8009c1:	00 00 00 
+  8009c4:	ff d0                	call   *%rax
+  8009c6:	89 c3                	mov    %eax,%ebx
+  8009c8:	85 c0                	test   %eax,%eax
+  8009ca:	78 14                	js     8009e0 <dup+0xf7>
+
+    return newfdnum;
+  8009cc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009cf:	89 d8                	mov    %ebx,%eax
+  8009d1:	48 83 c4 18          	add    $0x18,%rsp
+  8009d5:	5b                   	pop    %rbx
+  8009d6:	41 5c                	pop    %r12
+  8009d8:	41 5d                	pop    %r13
+  8009da:	41 5e                	pop    %r14
+  8009dc:	41 5f                	pop    %r15
+  8009de:	5d                   	pop    %rbp
+  8009df:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ed:	49 bc 97 03 80 00 00 	movabs $0x800397,%r12
+  8009f4:	00 00 00 
+  8009f7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009ff:	4c 89 f6             	mov    %r14,%rsi
+  800a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a07:	41 ff d4             	call   *%r12
+    return res;
+  800a0a:	eb c3                	jmp    8009cf <dup+0xe6>
+
+0000000000800a0c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a0c:	55                   	push   %rbp
+  800a0d:	48 89 e5             	mov    %rsp,%rbp
+  800a10:	41 56                	push   %r14
+  800a12:	41 55                	push   %r13
+  800a14:	41 54                	push   %r12
+  800a16:	53                   	push   %rbx
+  800a17:	48 83 ec 10          	sub    $0x10,%rsp
+  800a1b:	89 fb                	mov    %edi,%ebx
+  800a1d:	49 89 f4             	mov    %rsi,%r12
+  800a20:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a23:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a27:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800a2e:	00 00 00 
+  800a31:	ff d0                	call   *%rax
+  800a33:	85 c0                	test   %eax,%eax
+  800a35:	78 4c                	js     800a83 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a37:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a3b:	41 8b 3e             	mov    (%r14),%edi
+  800a3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a42:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800a49:	00 00 00 
+  800a4c:	ff d0                	call   *%rax
+  800a4e:	85 c0                	test   %eax,%eax
+  800a50:	78 35                	js     800a87 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a52:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a56:	83 e0 03             	and    $0x3,%eax
+  800a59:	83 f8 01             	cmp    $0x1,%eax
+  800a5c:	74 2d                	je     800a8b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a62:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a66:	48 85 c0             	test   %rax,%rax
+  800a69:	74 56                	je     800ac1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a6b:	4c 89 ea             	mov    %r13,%rdx
+  800a6e:	4c 89 e6             	mov    %r12,%rsi
+  800a71:	4c 89 f7             	mov    %r14,%rdi
+  800a74:	ff d0                	call   *%rax
+}
+  800a76:	48 83 c4 10          	add    $0x10,%rsp
+  800a7a:	5b                   	pop    %rbx
+  800a7b:	41 5c                	pop    %r12
+  800a7d:	41 5d                	pop    %r13
+  800a7f:	41 5e                	pop    %r14
+  800a81:	5d                   	pop    %rbp
+  800a82:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a83:	48 98                	cltq
+  800a85:	eb ef                	jmp    800a76 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a87:	48 98                	cltq
+  800a89:	eb eb                	jmp    800a76 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a8b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a92:	00 00 00 
+  800a95:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a9b:	89 da                	mov    %ebx,%edx
+  800a9d:	48 bf 61 37 80 00 00 	movabs $0x803761,%rdi
+  800aa4:	00 00 00 
+  800aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aac:	48 b9 7c 26 80 00 00 	movabs $0x80267c,%rcx
+  800ab3:	00 00 00 
+  800ab6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ab8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800abf:	eb b5                	jmp    800a76 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ac1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800ac8:	eb ac                	jmp    800a76 <read+0x6a>
+
+0000000000800aca <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800aca:	55                   	push   %rbp
+  800acb:	48 89 e5             	mov    %rsp,%rbp
+  800ace:	41 56                	push   %r14
+  800ad0:	41 55                	push   %r13
+  800ad2:	41 54                	push   %r12
+  800ad4:	53                   	push   %rbx
+  800ad5:	48 83 ec 10          	sub    $0x10,%rsp
+  800ad9:	89 fb                	mov    %edi,%ebx
+  800adb:	49 89 f4             	mov    %rsi,%r12
+  800ade:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ae1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ae5:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+  800af1:	85 c0                	test   %eax,%eax
+  800af3:	78 41                	js     800b36 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800af5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800af9:	41 8b 3e             	mov    (%r14),%edi
+  800afc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b00:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800b07:	00 00 00 
+  800b0a:	ff d0                	call   *%rax
+  800b0c:	85 c0                	test   %eax,%eax
+  800b0e:	78 35                	js     800b45 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800b10:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800b14:	83 e0 03             	and    $0x3,%eax
+  800b17:	83 f8 01             	cmp    $0x1,%eax
+  800b1a:	74 2d                	je     800b49 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b20:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b24:	48 85 c0             	test   %rax,%rax
+  800b27:	74 56                	je     800b7f <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800b29:	4c 89 ea             	mov    %r13,%rdx
+  800b2c:	4c 89 e6             	mov    %r12,%rsi
+  800b2f:	4c 89 f7             	mov    %r14,%rdi
+  800b32:	ff d0                	call   *%rax
+  800b34:	eb 02                	jmp    800b38 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b36:	48 98                	cltq
+}
+  800b38:	48 83 c4 10          	add    $0x10,%rsp
+  800b3c:	5b                   	pop    %rbx
+  800b3d:	41 5c                	pop    %r12
+  800b3f:	41 5d                	pop    %r13
+  800b41:	41 5e                	pop    %r14
+  800b43:	5d                   	pop    %rbp
+  800b44:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b45:	48 98                	cltq
+  800b47:	eb ef                	jmp    800b38 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b49:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b50:	00 00 00 
+  800b53:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b59:	89 da                	mov    %ebx,%edx
+  800b5b:	48 bf 20 37 80 00 00 	movabs $0x803720,%rdi
+  800b62:	00 00 00 
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6a:	48 b9 7c 26 80 00 00 	movabs $0x80267c,%rcx
+  800b71:	00 00 00 
+  800b74:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b76:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b7d:	eb b9                	jmp    800b38 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b7f:	4c 89 ea             	mov    %r13,%rdx
+  800b82:	4c 89 e6             	mov    %r12,%rsi
+  800b85:	89 df                	mov    %ebx,%edi
+  800b87:	48 b8 0c 0a 80 00 00 	movabs $0x800a0c,%rax
+  800b8e:	00 00 00 
+  800b91:	ff d0                	call   *%rax
+  800b93:	eb a3                	jmp    800b38 <readmap+0x6e>
+
+0000000000800b95 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b95:	55                   	push   %rbp
+  800b96:	48 89 e5             	mov    %rsp,%rbp
+  800b99:	41 57                	push   %r15
+  800b9b:	41 56                	push   %r14
+  800b9d:	41 55                	push   %r13
+  800b9f:	41 54                	push   %r12
+  800ba1:	53                   	push   %rbx
+  800ba2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ba6:	48 85 d2             	test   %rdx,%rdx
+  800ba9:	74 54                	je     800bff <readn+0x6a>
+  800bab:	41 89 fd             	mov    %edi,%r13d
+  800bae:	49 89 f6             	mov    %rsi,%r14
+  800bb1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800bb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800bb9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800bbe:	49 bf 0c 0a 80 00 00 	movabs $0x800a0c,%r15
+  800bc5:	00 00 00 
+  800bc8:	4c 89 e2             	mov    %r12,%rdx
+  800bcb:	48 29 f2             	sub    %rsi,%rdx
+  800bce:	4c 01 f6             	add    %r14,%rsi
+  800bd1:	44 89 ef             	mov    %r13d,%edi
+  800bd4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800bd7:	85 c0                	test   %eax,%eax
+  800bd9:	78 20                	js     800bfb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bdb:	01 c3                	add    %eax,%ebx
+  800bdd:	85 c0                	test   %eax,%eax
+  800bdf:	74 08                	je     800be9 <readn+0x54>
+  800be1:	48 63 f3             	movslq %ebx,%rsi
+  800be4:	4c 39 e6             	cmp    %r12,%rsi
+  800be7:	72 df                	jb     800bc8 <readn+0x33>
+    }
+    return res;
+  800be9:	48 63 c3             	movslq %ebx,%rax
+}
+  800bec:	48 83 c4 08          	add    $0x8,%rsp
+  800bf0:	5b                   	pop    %rbx
+  800bf1:	41 5c                	pop    %r12
+  800bf3:	41 5d                	pop    %r13
+  800bf5:	41 5e                	pop    %r14
+  800bf7:	41 5f                	pop    %r15
+  800bf9:	5d                   	pop    %rbp
+  800bfa:	c3                   	ret
+        if (inc < 0) return inc;
+  800bfb:	48 98                	cltq
+  800bfd:	eb ed                	jmp    800bec <readn+0x57>
+    int inc = 1, res = 0;
+  800bff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c04:	eb e3                	jmp    800be9 <readn+0x54>
+
+0000000000800c06 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800c06:	55                   	push   %rbp
+  800c07:	48 89 e5             	mov    %rsp,%rbp
+  800c0a:	41 56                	push   %r14
+  800c0c:	41 55                	push   %r13
+  800c0e:	41 54                	push   %r12
+  800c10:	53                   	push   %rbx
+  800c11:	48 83 ec 10          	sub    $0x10,%rsp
+  800c15:	89 fb                	mov    %edi,%ebx
+  800c17:	49 89 f4             	mov    %rsi,%r12
+  800c1a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c1d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c21:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800c28:	00 00 00 
+  800c2b:	ff d0                	call   *%rax
+  800c2d:	85 c0                	test   %eax,%eax
+  800c2f:	78 47                	js     800c78 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c31:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c35:	41 8b 3e             	mov    (%r14),%edi
+  800c38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c3c:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+  800c48:	85 c0                	test   %eax,%eax
+  800c4a:	78 30                	js     800c7c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c4c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c51:	74 2d                	je     800c80 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c57:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c5b:	48 85 c0             	test   %rax,%rax
+  800c5e:	74 56                	je     800cb6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c60:	4c 89 ea             	mov    %r13,%rdx
+  800c63:	4c 89 e6             	mov    %r12,%rsi
+  800c66:	4c 89 f7             	mov    %r14,%rdi
+  800c69:	ff d0                	call   *%rax
+}
+  800c6b:	48 83 c4 10          	add    $0x10,%rsp
+  800c6f:	5b                   	pop    %rbx
+  800c70:	41 5c                	pop    %r12
+  800c72:	41 5d                	pop    %r13
+  800c74:	41 5e                	pop    %r14
+  800c76:	5d                   	pop    %rbp
+  800c77:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c78:	48 98                	cltq
+  800c7a:	eb ef                	jmp    800c6b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c7c:	48 98                	cltq
+  800c7e:	eb eb                	jmp    800c6b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c80:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c87:	00 00 00 
+  800c8a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c90:	89 da                	mov    %ebx,%edx
+  800c92:	48 bf 7d 37 80 00 00 	movabs $0x80377d,%rdi
+  800c99:	00 00 00 
+  800c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca1:	48 b9 7c 26 80 00 00 	movabs $0x80267c,%rcx
+  800ca8:	00 00 00 
+  800cab:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cad:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800cb4:	eb b5                	jmp    800c6b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800cb6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800cbd:	eb ac                	jmp    800c6b <write+0x65>
+
+0000000000800cbf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800cbf:	55                   	push   %rbp
+  800cc0:	48 89 e5             	mov    %rsp,%rbp
+  800cc3:	53                   	push   %rbx
+  800cc4:	48 83 ec 18          	sub    $0x18,%rsp
+  800cc8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cce:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800cd5:	00 00 00 
+  800cd8:	ff d0                	call   *%rax
+  800cda:	85 c0                	test   %eax,%eax
+  800cdc:	78 0c                	js     800cea <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+
+0000000000800cf0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cf0:	55                   	push   %rbp
+  800cf1:	48 89 e5             	mov    %rsp,%rbp
+  800cf4:	41 55                	push   %r13
+  800cf6:	41 54                	push   %r12
+  800cf8:	53                   	push   %rbx
+  800cf9:	48 83 ec 18          	sub    $0x18,%rsp
+  800cfd:	89 fb                	mov    %edi,%ebx
+  800cff:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d06:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800d0d:	00 00 00 
+  800d10:	ff d0                	call   *%rax
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	78 38                	js     800d4e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d16:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800d1a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800d1e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d22:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800d29:	00 00 00 
+  800d2c:	ff d0                	call   *%rax
+  800d2e:	85 c0                	test   %eax,%eax
+  800d30:	78 1c                	js     800d4e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d32:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d37:	74 20                	je     800d59 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d3d:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d41:	48 85 c0             	test   %rax,%rax
+  800d44:	74 47                	je     800d8d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d46:	44 89 e6             	mov    %r12d,%esi
+  800d49:	4c 89 ef             	mov    %r13,%rdi
+  800d4c:	ff d0                	call   *%rax
+}
+  800d4e:	48 83 c4 18          	add    $0x18,%rsp
+  800d52:	5b                   	pop    %rbx
+  800d53:	41 5c                	pop    %r12
+  800d55:	41 5d                	pop    %r13
+  800d57:	5d                   	pop    %rbp
+  800d58:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d59:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d60:	00 00 00 
+  800d63:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d69:	89 da                	mov    %ebx,%edx
+  800d6b:	48 bf 40 37 80 00 00 	movabs $0x803740,%rdi
+  800d72:	00 00 00 
+  800d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7a:	48 b9 7c 26 80 00 00 	movabs $0x80267c,%rcx
+  800d81:	00 00 00 
+  800d84:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8b:	eb c1                	jmp    800d4e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d8d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d92:	eb ba                	jmp    800d4e <ftruncate+0x5e>
+
+0000000000800d94 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d94:	55                   	push   %rbp
+  800d95:	48 89 e5             	mov    %rsp,%rbp
+  800d98:	41 54                	push   %r12
+  800d9a:	53                   	push   %rbx
+  800d9b:	48 83 ec 10          	sub    $0x10,%rsp
+  800d9f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800da2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800da6:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	78 4e                	js     800e04 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800db6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800dba:	41 8b 3c 24          	mov    (%r12),%edi
+  800dbe:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800dc2:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800dc9:	00 00 00 
+  800dcc:	ff d0                	call   *%rax
+  800dce:	85 c0                	test   %eax,%eax
+  800dd0:	78 32                	js     800e04 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dd6:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800ddb:	74 30                	je     800e0d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800ddd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800de0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800de7:	00 00 00 
+    stat->st_isdir = 0;
+  800dea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800df1:	00 00 00 
+    stat->st_dev = dev;
+  800df4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dfb:	48 89 de             	mov    %rbx,%rsi
+  800dfe:	4c 89 e7             	mov    %r12,%rdi
+  800e01:	ff 50 30             	call   *0x30(%rax)
+}
+  800e04:	48 83 c4 10          	add    $0x10,%rsp
+  800e08:	5b                   	pop    %rbx
+  800e09:	41 5c                	pop    %r12
+  800e0b:	5d                   	pop    %rbp
+  800e0c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e0d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e12:	eb f0                	jmp    800e04 <fstat+0x70>
+
+0000000000800e14 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800e14:	55                   	push   %rbp
+  800e15:	48 89 e5             	mov    %rsp,%rbp
+  800e18:	41 54                	push   %r12
+  800e1a:	53                   	push   %rbx
+  800e1b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800e1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e23:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+  800e2f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	78 25                	js     800e5a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e35:	4c 89 e6             	mov    %r12,%rsi
+  800e38:	89 c7                	mov    %eax,%edi
+  800e3a:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  800e41:	00 00 00 
+  800e44:	ff d0                	call   *%rax
+  800e46:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e49:	89 df                	mov    %ebx,%edi
+  800e4b:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+
+    return res;
+  800e57:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e5a:	89 d8                	mov    %ebx,%eax
+  800e5c:	5b                   	pop    %rbx
+  800e5d:	41 5c                	pop    %r12
+  800e5f:	5d                   	pop    %rbp
+  800e60:	c3                   	ret
+
+0000000000800e61 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e61:	55                   	push   %rbp
+  800e62:	48 89 e5             	mov    %rsp,%rbp
+  800e65:	41 54                	push   %r12
+  800e67:	53                   	push   %rbx
+  800e68:	48 83 ec 10          	sub    $0x10,%rsp
+  800e6c:	48 89 fb             	mov    %rdi,%rbx
+  800e6f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e72:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e76:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e7b:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800e82:	00 00 00 
+  800e85:	ff d0                	call   *%rax
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	78 1f                	js     800eaa <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e8f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e93:	48 85 c0             	test   %rax,%rax
+  800e96:	74 1b                	je     800eb3 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e98:	4c 89 e6             	mov    %r12,%rsi
+  800e9b:	48 89 df             	mov    %rbx,%rdi
+  800e9e:	ff d0                	call   *%rax
+    if (res < 0) {
+  800ea0:	85 c0                	test   %eax,%eax
+  800ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800eaa:	48 83 c4 10          	add    $0x10,%rsp
+  800eae:	5b                   	pop    %rbx
+  800eaf:	41 5c                	pop    %r12
+  800eb1:	5d                   	pop    %rbp
+  800eb2:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eb3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800eb8:	eb f0                	jmp    800eaa <create_snapshot+0x49>
+
+0000000000800eba <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800eba:	55                   	push   %rbp
+  800ebb:	48 89 e5             	mov    %rsp,%rbp
+  800ebe:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ec2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800ec6:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ecb:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800ed2:	00 00 00 
+  800ed5:	ff d0                	call   *%rax
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	78 1e                	js     800ef9 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800edb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800edf:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800ee3:	48 85 d2             	test   %rdx,%rdx
+  800ee6:	74 13                	je     800efb <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eed:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800eef:	85 c0                	test   %eax,%eax
+  800ef1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ef9:	c9                   	leave
+  800efa:	c3                   	ret
+        return -E_NOT_SUPP;
+  800efb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f00:	eb f7                	jmp    800ef9 <print_snapshot_list+0x3f>
+
+0000000000800f02 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800f02:	55                   	push   %rbp
+  800f03:	48 89 e5             	mov    %rsp,%rbp
+  800f06:	53                   	push   %rbx
+  800f07:	48 83 ec 18          	sub    $0x18,%rsp
+  800f0b:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f12:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f17:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  800f23:	85 c0                	test   %eax,%eax
+  800f25:	78 1c                	js     800f43 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800f27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f2b:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800f2f:	48 85 c0             	test   %rax,%rax
+  800f32:	74 15                	je     800f49 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f34:	48 89 df             	mov    %rbx,%rdi
+  800f37:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f39:	85 c0                	test   %eax,%eax
+  800f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f40:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f47:	c9                   	leave
+  800f48:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f49:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f4e:	eb f3                	jmp    800f43 <accept_snapshot+0x41>
+
+0000000000800f50 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f50:	55                   	push   %rbp
+  800f51:	48 89 e5             	mov    %rsp,%rbp
+  800f54:	53                   	push   %rbx
+  800f55:	48 83 ec 18          	sub    $0x18,%rsp
+  800f59:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f5c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f60:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f65:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800f6c:	00 00 00 
+  800f6f:	ff d0                	call   *%rax
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	78 1c                	js     800f91 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f79:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f7d:	48 85 c0             	test   %rax,%rax
+  800f80:	74 15                	je     800f97 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f82:	48 89 df             	mov    %rbx,%rdi
+  800f85:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f95:	c9                   	leave
+  800f96:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f97:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f9c:	eb f3                	jmp    800f91 <delete_snapshot+0x41>
+
+0000000000800f9e <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f9e:	55                   	push   %rbp
+  800f9f:	48 89 e5             	mov    %rsp,%rbp
+  800fa2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fa6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800faa:	bf 66 00 00 00       	mov    $0x66,%edi
+  800faf:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  800fb6:	00 00 00 
+  800fb9:	ff d0                	call   *%rax
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	78 14                	js     800fd3 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800fbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800fc3:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800fc7:	48 85 d2             	test   %rdx,%rdx
+  800fca:	74 09                	je     800fd5 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd1:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800fd3:	c9                   	leave
+  800fd4:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fd5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800fda:	eb f7                	jmp    800fd3 <gc_snapshots+0x35>
+
+0000000000800fdc <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fdc:	55                   	push   %rbp
+  800fdd:	48 89 e5             	mov    %rsp,%rbp
+  800fe0:	41 56                	push   %r14
+  800fe2:	41 55                	push   %r13
+  800fe4:	41 54                	push   %r12
+  800fe6:	53                   	push   %rbx
+  800fe7:	48 83 ec 10          	sub    $0x10,%rsp
+  800feb:	48 89 fb             	mov    %rdi,%rbx
+  800fee:	49 89 f4             	mov    %rsi,%r12
+  800ff1:	49 89 d5             	mov    %rdx,%r13
+  800ff4:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ff7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ffb:	bf 66 00 00 00       	mov    $0x66,%edi
+  801000:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  801007:	00 00 00 
+  80100a:	ff d0                	call   *%rax
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	78 1b                	js     80102b <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801010:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801014:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801018:	48 85 c0             	test   %rax,%rax
+  80101b:	74 1b                	je     801038 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  80101d:	4c 89 f1             	mov    %r14,%rcx
+  801020:	4c 89 ea             	mov    %r13,%rdx
+  801023:	4c 89 e6             	mov    %r12,%rsi
+  801026:	48 89 df             	mov    %rbx,%rdi
+  801029:	ff d0                	call   *%rax
+
+    return res;
+}
+  80102b:	48 83 c4 10          	add    $0x10,%rsp
+  80102f:	5b                   	pop    %rbx
+  801030:	41 5c                	pop    %r12
+  801032:	41 5d                	pop    %r13
+  801034:	41 5e                	pop    %r14
+  801036:	5d                   	pop    %rbp
+  801037:	c3                   	ret
+        return -E_NOT_SUPP;
+  801038:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80103d:	eb ec                	jmp    80102b <diff_snapshots+0x4f>
+
+000000000080103f <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80103f:	55                   	push   %rbp
+  801040:	48 89 e5             	mov    %rsp,%rbp
+  801043:	41 55                	push   %r13
+  801045:	41 54                	push   %r12
+  801047:	53                   	push   %rbx
+  801048:	48 83 ec 18          	sub    $0x18,%rsp
+  80104c:	48 89 fb             	mov    %rdi,%rbx
+  80104f:	49 89 f4             	mov    %rsi,%r12
+  801052:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801055:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801059:	bf 66 00 00 00       	mov    $0x66,%edi
+  80105e:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  801065:	00 00 00 
+  801068:	ff d0                	call   *%rax
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	78 18                	js     801086 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80106e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801072:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801076:	48 85 c0             	test   %rax,%rax
+  801079:	74 16                	je     801091 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80107b:	4c 89 ea             	mov    %r13,%rdx
+  80107e:	4c 89 e6             	mov    %r12,%rsi
+  801081:	48 89 df             	mov    %rbx,%rdi
+  801084:	ff d0                	call   *%rax
+
+    return res;
+}
+  801086:	48 83 c4 18          	add    $0x18,%rsp
+  80108a:	5b                   	pop    %rbx
+  80108b:	41 5c                	pop    %r12
+  80108d:	41 5d                	pop    %r13
+  80108f:	5d                   	pop    %rbp
+  801090:	c3                   	ret
+        return -E_NOT_SUPP;
+  801091:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801096:	eb ee                	jmp    801086 <send_snapshot+0x47>
+
+0000000000801098 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	53                   	push   %rbx
+  80109d:	48 83 ec 18          	sub    $0x18,%rsp
+  8010a1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010a8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010ad:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  8010b4:	00 00 00 
+  8010b7:	ff d0                	call   *%rax
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	78 12                	js     8010cf <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8010bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c1:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8010c5:	48 85 c0             	test   %rax,%rax
+  8010c8:	74 0b                	je     8010d5 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8010ca:	48 89 df             	mov    %rbx,%rdi
+  8010cd:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010da:	eb f3                	jmp    8010cf <receive_snapshot+0x37>
+
+00000000008010dc <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010dc:	55                   	push   %rbp
+  8010dd:	48 89 e5             	mov    %rsp,%rbp
+  8010e0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010e8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010ed:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  8010f4:	00 00 00 
+  8010f7:	ff d0                	call   *%rax
+  8010f9:	85 c0                	test   %eax,%eax
+  8010fb:	78 17                	js     801114 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801101:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801108:	48 85 d2             	test   %rdx,%rdx
+  80110b:	74 09                	je     801116 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801112:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801114:	c9                   	leave
+  801115:	c3                   	ret
+        return -E_NOT_SUPP;
+  801116:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80111b:	eb f7                	jmp    801114 <free_space_bytes+0x38>
+
+000000000080111d <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80111d:	55                   	push   %rbp
+  80111e:	48 89 e5             	mov    %rsp,%rbp
+  801121:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801125:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801129:	bf 66 00 00 00       	mov    $0x66,%edi
+  80112e:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	78 17                	js     801155 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80113e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801142:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801149:	48 85 d2             	test   %rdx,%rdx
+  80114c:	74 09                	je     801157 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80114e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801153:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801155:	c9                   	leave
+  801156:	c3                   	ret
+        return -E_NOT_SUPP;
+  801157:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80115c:	eb f7                	jmp    801155 <busy_space_bytes+0x38>
+
+000000000080115e <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80115e:	55                   	push   %rbp
+  80115f:	48 89 e5             	mov    %rsp,%rbp
+  801162:	41 54                	push   %r12
+  801164:	53                   	push   %rbx
+  801165:	48 83 ec 10          	sub    $0x10,%rsp
+  801169:	89 fb                	mov    %edi,%ebx
+  80116b:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80116e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801172:	bf 66 00 00 00       	mov    $0x66,%edi
+  801177:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  80117e:	00 00 00 
+  801181:	ff d0                	call   *%rax
+  801183:	85 c0                	test   %eax,%eax
+  801185:	78 17                	js     80119e <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  801187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80118b:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801192:	48 85 c0             	test   %rax,%rax
+  801195:	74 10                	je     8011a7 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  801197:	4c 89 e6             	mov    %r12,%rsi
+  80119a:	89 df                	mov    %ebx,%edi
+  80119c:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80119e:	48 83 c4 10          	add    $0x10,%rsp
+  8011a2:	5b                   	pop    %rbx
+  8011a3:	41 5c                	pop    %r12
+  8011a5:	5d                   	pop    %rbp
+  8011a6:	c3                   	ret
+        return -E_NOT_SUPP;
+  8011a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8011ac:	eb f0                	jmp    80119e <snapshots_space+0x40>
+
+00000000008011ae <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8011ae:	55                   	push   %rbp
+  8011af:	48 89 e5             	mov    %rsp,%rbp
+  8011b2:	41 55                	push   %r13
+  8011b4:	41 54                	push   %r12
+  8011b6:	53                   	push   %rbx
+  8011b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bb:	41 89 fd             	mov    %edi,%r13d
+  8011be:	48 89 f3             	mov    %rsi,%rbx
+  8011c1:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011c4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011cb:	00 00 00 
+  8011ce:	83 38 00             	cmpl   $0x0,(%rax)
+  8011d1:	74 57                	je     80122a <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011d3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8011d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011de:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011e5:	00 00 00 
+  8011e8:	44 89 ee             	mov    %r13d,%esi
+  8011eb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011f2:	00 00 00 
+  8011f5:	8b 38                	mov    (%rax),%edi
+  8011f7:	48 b8 a3 35 80 00 00 	movabs $0x8035a3,%rax
+  8011fe:	00 00 00 
+  801201:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  801203:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801208:	4c 89 e2             	mov    %r12,%rdx
+  80120b:	48 89 de             	mov    %rbx,%rsi
+  80120e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801213:	48 b8 8b 35 80 00 00 	movabs $0x80358b,%rax
+  80121a:	00 00 00 
+  80121d:	ff d0                	call   *%rax
+}
+  80121f:	48 83 c4 08          	add    $0x8,%rsp
+  801223:	5b                   	pop    %rbx
+  801224:	41 5c                	pop    %r12
+  801226:	41 5d                	pop    %r13
+  801228:	5d                   	pop    %rbp
+  801229:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80122a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80122f:	48 b8 61 36 80 00 00 	movabs $0x803661,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+  80123b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801242:	00 00 
+  801244:	eb 8d                	jmp    8011d3 <fsipc_region+0x25>
+
+0000000000801246 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80124e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801255:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801256:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80125a:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801261:	00 00 00 
+  801264:	ff d0                	call   *%rax
+}
+  801266:	c9                   	leave
+  801267:	c3                   	ret
+
+0000000000801268 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801268:	85 ff                	test   %edi,%edi
+  80126a:	78 6d                	js     8012d9 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+  801270:	41 54                	push   %r12
+  801272:	53                   	push   %rbx
+  801273:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801276:	48 85 f6             	test   %rsi,%rsi
+  801279:	74 57                	je     8012d2 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80127b:	89 f8                	mov    %edi,%eax
+  80127d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801284:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801286:	be 00 00 00 00       	mov    $0x0,%esi
+  80128b:	bf 12 00 00 00       	mov    $0x12,%edi
+  801290:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801297:	00 00 00 
+  80129a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	78 2d                	js     8012cd <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8012a0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8012a7:	00 00 00 
+  8012aa:	49 63 14 24          	movslq (%r12),%rdx
+  8012ae:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8012b5:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8012ba:	48 89 df             	mov    %rbx,%rdi
+  8012bd:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  8012c4:	00 00 00 
+  8012c7:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8012c9:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8012cd:	5b                   	pop    %rbx
+  8012ce:	41 5c                	pop    %r12
+  8012d0:	5d                   	pop    %rbp
+  8012d1:	c3                   	ret
+        return -E_INVAL;
+  8012d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d7:	eb f4                	jmp    8012cd <devfile_df_snapshots+0x65>
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012de:	c3                   	ret
+
+00000000008012df <devfile_df_busy>:
+devfile_df_busy() {
+  8012df:	55                   	push   %rbp
+  8012e0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012ed:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8012f4:	00 00 00 
+  8012f7:	ff d0                	call   *%rax
+}
+  8012f9:	5d                   	pop    %rbp
+  8012fa:	c3                   	ret
+
+00000000008012fb <devfile_df_free>:
+devfile_df_free() {
+  8012fb:	55                   	push   %rbp
+  8012fc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801304:	bf 10 00 00 00       	mov    $0x10,%edi
+  801309:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801310:	00 00 00 
+  801313:	ff d0                	call   *%rax
+}
+  801315:	5d                   	pop    %rbp
+  801316:	c3                   	ret
+
+0000000000801317 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  801317:	55                   	push   %rbp
+  801318:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80131b:	be 00 00 00 00       	mov    $0x0,%esi
+  801320:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801325:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+}
+  801331:	5d                   	pop    %rbp
+  801332:	c3                   	ret
+
+0000000000801333 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  801337:	be 00 00 00 00       	mov    $0x0,%esi
+  80133c:	bf 09 00 00 00       	mov    $0x9,%edi
+  801341:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801348:	00 00 00 
+  80134b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80134d:	85 c0                	test   %eax,%eax
+  80134f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801354:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801357:	5d                   	pop    %rbp
+  801358:	c3                   	ret
+
+0000000000801359 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801359:	55                   	push   %rbp
+  80135a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80135d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801364:	00 00 00 
+  801367:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80136a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80136c:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80136f:	be 00 00 00 00       	mov    $0x0,%esi
+  801374:	bf 02 00 00 00       	mov    $0x2,%edi
+  801379:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801380:	00 00 00 
+  801383:	ff d0                	call   *%rax
+}
+  801385:	5d                   	pop    %rbp
+  801386:	c3                   	ret
+
+0000000000801387 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801387:	55                   	push   %rbp
+  801388:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80138b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80138e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801395:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801397:	be 00 00 00 00       	mov    $0x0,%esi
+  80139c:	bf 06 00 00 00       	mov    $0x6,%edi
+  8013a1:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8013a8:	00 00 00 
+  8013ab:	ff d0                	call   *%rax
+}
+  8013ad:	5d                   	pop    %rbp
+  8013ae:	c3                   	ret
+
+00000000008013af <devfile_write>:
+    if (!fd || !buf) {
+  8013af:	48 85 ff             	test   %rdi,%rdi
+  8013b2:	0f 84 c1 00 00 00    	je     801479 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8013b8:	55                   	push   %rbp
+  8013b9:	48 89 e5             	mov    %rsp,%rbp
+  8013bc:	41 57                	push   %r15
+  8013be:	41 56                	push   %r14
+  8013c0:	41 55                	push   %r13
+  8013c2:	41 54                	push   %r12
+  8013c4:	53                   	push   %rbx
+  8013c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8013c9:	49 89 ff             	mov    %rdi,%r15
+  8013cc:	49 89 f5             	mov    %rsi,%r13
+  8013cf:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013d2:	48 85 f6             	test   %rsi,%rsi
+  8013d5:	0f 84 95 00 00 00    	je     801470 <devfile_write+0xc1>
+    while (n) {
+  8013db:	48 85 d2             	test   %rdx,%rdx
+  8013de:	0f 84 83 00 00 00    	je     801467 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013e4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013eb:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013f2:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013f5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013fa:	49 39 dc             	cmp    %rbx,%r12
+  8013fd:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  801401:	48 89 da             	mov    %rbx,%rdx
+  801404:	4c 89 ee             	mov    %r13,%rsi
+  801407:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80140e:	00 00 00 
+  801411:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  801418:	00 00 00 
+  80141b:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80141d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801421:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  801424:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801432:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+        if (write < 0) {
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	78 21                	js     801463 <devfile_write+0xb4>
+        buf += write;
+  801442:	48 63 d0             	movslq %eax,%rdx
+  801445:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801448:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80144b:	49 29 d4             	sub    %rdx,%r12
+  80144e:	75 a5                	jne    8013f5 <devfile_write+0x46>
+    return totalWrite;
+  801450:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801454:	48 83 c4 18          	add    $0x18,%rsp
+  801458:	5b                   	pop    %rbx
+  801459:	41 5c                	pop    %r12
+  80145b:	41 5d                	pop    %r13
+  80145d:	41 5e                	pop    %r14
+  80145f:	41 5f                	pop    %r15
+  801461:	5d                   	pop    %rbp
+  801462:	c3                   	ret
+            return write;
+  801463:	48 98                	cltq
+  801465:	eb ed                	jmp    801454 <devfile_write+0xa5>
+    int totalWrite = 0;
+  801467:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80146e:	eb e0                	jmp    801450 <devfile_write+0xa1>
+        return -E_INVAL;
+  801470:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801477:	eb db                	jmp    801454 <devfile_write+0xa5>
+  801479:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801480:	c3                   	ret
+
+0000000000801481 <devfile_read>:
+    if (!fd || !buf) {
+  801481:	48 85 ff             	test   %rdi,%rdi
+  801484:	0f 84 c0 00 00 00    	je     80154a <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	41 57                	push   %r15
+  801490:	41 56                	push   %r14
+  801492:	41 55                	push   %r13
+  801494:	41 54                	push   %r12
+  801496:	53                   	push   %rbx
+  801497:	48 83 ec 18          	sub    $0x18,%rsp
+  80149b:	49 89 ff             	mov    %rdi,%r15
+  80149e:	49 89 f5             	mov    %rsi,%r13
+  8014a1:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8014a4:	48 85 f6             	test   %rsi,%rsi
+  8014a7:	0f 84 96 00 00 00    	je     801543 <devfile_read+0xc2>
+    while (n) {
+  8014ad:	48 85 d2             	test   %rdx,%rdx
+  8014b0:	0f 84 87 00 00 00    	je     80153d <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8014b6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8014bd:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014be:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8014c5:	00 00 00 
+  8014c8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014cc:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8014cf:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014d4:	49 39 c4             	cmp    %rax,%r12
+  8014d7:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014db:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014df:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014e9:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8014f0:	00 00 00 
+  8014f3:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	7e 37                	jle    801530 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014f9:	48 63 d8             	movslq %eax,%rbx
+  8014fc:	48 89 da             	mov    %rbx,%rdx
+  8014ff:	4c 89 f6             	mov    %r14,%rsi
+  801502:	4c 89 ef             	mov    %r13,%rdi
+  801505:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  80150c:	00 00 00 
+  80150f:	ff d0                	call   *%rax
+        buf += read;
+  801511:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  801514:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801518:	49 29 dc             	sub    %rbx,%r12
+  80151b:	75 ab                	jne    8014c8 <devfile_read+0x47>
+  return totalRead;
+  80151d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801521:	48 83 c4 18          	add    $0x18,%rsp
+  801525:	5b                   	pop    %rbx
+  801526:	41 5c                	pop    %r12
+  801528:	41 5d                	pop    %r13
+  80152a:	41 5e                	pop    %r14
+  80152c:	41 5f                	pop    %r15
+  80152e:	5d                   	pop    %rbp
+  80152f:	c3                   	ret
+            return read ? read : totalRead;
+  801530:	48 63 d0             	movslq %eax,%rdx
+  801533:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801537:	48 0f 45 c2          	cmovne %rdx,%rax
+  80153b:	eb e4                	jmp    801521 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80153d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801541:	eb da                	jmp    80151d <devfile_read+0x9c>
+        return E_INVAL;
+  801543:	b8 03 00 00 00       	mov    $0x3,%eax
+  801548:	eb d7                	jmp    801521 <devfile_read+0xa0>
+  80154a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80154f:	c3                   	ret
+
+0000000000801550 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801550:	48 85 ff             	test   %rdi,%rdi
+  801553:	74 5f                	je     8015b4 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801555:	55                   	push   %rbp
+  801556:	48 89 e5             	mov    %rsp,%rbp
+  801559:	53                   	push   %rbx
+  80155a:	48 83 ec 08          	sub    $0x8,%rsp
+  80155e:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801561:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801568:	00 00 00 
+  80156b:	ff d0                	call   *%rax
+  80156d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801573:	77 45                	ja     8015ba <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801575:	48 89 de             	mov    %rbx,%rsi
+  801578:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80157f:	00 00 00 
+  801582:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  801589:	00 00 00 
+  80158c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801598:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ab:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8015ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+        return -E_INVAL;
+  8015b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015b9:	c3                   	ret
+        return -E_INVAL;
+  8015ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015bf:	eb ed                	jmp    8015ae <devfile_receive_snapshot+0x5e>
+
+00000000008015c1 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	41 55                	push   %r13
+  8015c7:	41 54                	push   %r12
+  8015c9:	53                   	push   %rbx
+  8015ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ce:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015d1:	48 85 f6             	test   %rsi,%rsi
+  8015d4:	0f 94 c0             	sete   %al
+  8015d7:	48 85 d2             	test   %rdx,%rdx
+  8015da:	0f 94 c2             	sete   %dl
+  8015dd:	08 d0                	or     %dl,%al
+  8015df:	0f 85 ad 00 00 00    	jne    801692 <devfile_send_snapshot+0xd1>
+  8015e5:	48 89 fb             	mov    %rdi,%rbx
+  8015e8:	49 89 f4             	mov    %rsi,%r12
+  8015eb:	48 85 ff             	test   %rdi,%rdi
+  8015ee:	0f 84 9e 00 00 00    	je     801692 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015f4:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  8015fb:	00 00 00 
+  8015fe:	ff d0                	call   *%rax
+  801600:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801606:	0f 87 8d 00 00 00    	ja     801699 <devfile_send_snapshot+0xd8>
+  80160c:	4c 89 e7             	mov    %r12,%rdi
+  80160f:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801616:	00 00 00 
+  801619:	ff d0                	call   *%rax
+  80161b:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801621:	77 7d                	ja     8016a0 <devfile_send_snapshot+0xdf>
+  801623:	4c 89 ef             	mov    %r13,%rdi
+  801626:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+  801632:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801638:	77 6d                	ja     8016a7 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80163a:	48 89 de             	mov    %rbx,%rsi
+  80163d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801644:	00 00 00 
+  801647:	48 bb a1 2f 80 00 00 	movabs $0x802fa1,%rbx
+  80164e:	00 00 00 
+  801651:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801653:	4c 89 e6             	mov    %r12,%rsi
+  801656:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80165d:	00 00 00 
+  801660:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801662:	4c 89 ee             	mov    %r13,%rsi
+  801665:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80166c:	00 00 00 
+  80166f:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801671:	be 00 00 00 00       	mov    $0x0,%esi
+  801676:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80167b:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801682:	00 00 00 
+  801685:	ff d0                	call   *%rax
+}
+  801687:	48 83 c4 08          	add    $0x8,%rsp
+  80168b:	5b                   	pop    %rbx
+  80168c:	41 5c                	pop    %r12
+  80168e:	41 5d                	pop    %r13
+  801690:	5d                   	pop    %rbp
+  801691:	c3                   	ret
+        return -E_INVAL;
+  801692:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801697:	eb ee                	jmp    801687 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801699:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169e:	eb e7                	jmp    801687 <devfile_send_snapshot+0xc6>
+  8016a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a5:	eb e0                	jmp    801687 <devfile_send_snapshot+0xc6>
+  8016a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ac:	eb d9                	jmp    801687 <devfile_send_snapshot+0xc6>
+
+00000000008016ae <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8016ae:	48 85 ff             	test   %rdi,%rdi
+  8016b1:	0f 84 41 01 00 00    	je     8017f8 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	41 57                	push   %r15
+  8016bd:	41 56                	push   %r14
+  8016bf:	41 55                	push   %r13
+  8016c1:	41 54                	push   %r12
+  8016c3:	53                   	push   %rbx
+  8016c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c8:	49 89 fc             	mov    %rdi,%r12
+  8016cb:	49 89 f5             	mov    %rsi,%r13
+  8016ce:	48 89 d3             	mov    %rdx,%rbx
+  8016d1:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016d4:	48 85 f6             	test   %rsi,%rsi
+  8016d7:	0f 84 ff 00 00 00    	je     8017dc <devfile_diff_snapshots+0x12e>
+  8016dd:	48 85 d2             	test   %rdx,%rdx
+  8016e0:	0f 84 fd 00 00 00    	je     8017e3 <devfile_diff_snapshots+0x135>
+  8016e6:	48 85 c9             	test   %rcx,%rcx
+  8016e9:	0f 84 f4 00 00 00    	je     8017e3 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016ef:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+  8016fb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801701:	0f 87 e3 00 00 00    	ja     8017ea <devfile_diff_snapshots+0x13c>
+  801707:	4c 89 ef             	mov    %r13,%rdi
+  80170a:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801711:	00 00 00 
+  801714:	ff d0                	call   *%rax
+  801716:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80171c:	0f 87 cf 00 00 00    	ja     8017f1 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  801722:	4c 89 e6             	mov    %r12,%rsi
+  801725:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80172c:	00 00 00 
+  80172f:	4c 89 e7             	mov    %r12,%rdi
+  801732:	49 bf a1 2f 80 00 00 	movabs $0x802fa1,%r15
+  801739:	00 00 00 
+  80173c:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80173f:	4c 89 ee             	mov    %r13,%rsi
+  801742:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801749:	00 
+  80174a:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80174d:	48 8b 03             	mov    (%rbx),%rax
+  801750:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801757:	00 
+  801758:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80175c:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801763:	00 
+  801764:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801768:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80176f:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801770:	be 00 00 00 00       	mov    $0x0,%esi
+  801775:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80177a:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801781:	00 00 00 
+  801784:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801786:	85 c0                	test   %eax,%eax
+  801788:	78 43                	js     8017cd <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80178a:	49 8b 04 24          	mov    (%r12),%rax
+  80178e:	48 89 03             	mov    %rax,(%rbx)
+  801791:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801796:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80179a:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80179f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8017a3:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8017a8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017ac:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8017b0:	48 c1 e2 03          	shl    $0x3,%rdx
+  8017b4:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8017b9:	4c 89 f7             	mov    %r14,%rdi
+  8017bc:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  8017c3:	00 00 00 
+  8017c6:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8017c8:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8017cd:	48 83 c4 08          	add    $0x8,%rsp
+  8017d1:	5b                   	pop    %rbx
+  8017d2:	41 5c                	pop    %r12
+  8017d4:	41 5d                	pop    %r13
+  8017d6:	41 5e                	pop    %r14
+  8017d8:	41 5f                	pop    %r15
+  8017da:	5d                   	pop    %rbp
+  8017db:	c3                   	ret
+        return -E_INVAL;
+  8017dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e1:	eb ea                	jmp    8017cd <devfile_diff_snapshots+0x11f>
+  8017e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e8:	eb e3                	jmp    8017cd <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ef:	eb dc                	jmp    8017cd <devfile_diff_snapshots+0x11f>
+  8017f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f6:	eb d5                	jmp    8017cd <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017fd:	c3                   	ret
+
+00000000008017fe <devfile_delete_snapshot>:
+    if (!name) {
+  8017fe:	48 85 ff             	test   %rdi,%rdi
+  801801:	74 5f                	je     801862 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	53                   	push   %rbx
+  801808:	48 83 ec 08          	sub    $0x8,%rsp
+  80180c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80180f:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801816:	00 00 00 
+  801819:	ff d0                	call   *%rax
+  80181b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801821:	77 45                	ja     801868 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  801823:	48 89 de             	mov    %rbx,%rsi
+  801826:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80182d:	00 00 00 
+  801830:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  801837:	00 00 00 
+  80183a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80183c:	be 00 00 00 00       	mov    $0x0,%esi
+  801841:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801846:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  80184d:	00 00 00 
+  801850:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801852:	85 c0                	test   %eax,%eax
+  801854:	ba 00 00 00 00       	mov    $0x0,%edx
+  801859:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80185c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+        return -E_INVAL;
+  801862:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801867:	c3                   	ret
+        return -E_INVAL;
+  801868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186d:	eb ed                	jmp    80185c <devfile_delete_snapshot+0x5e>
+
+000000000080186f <devfile_accept_snapshot>:
+    if (!name) {
+  80186f:	48 85 ff             	test   %rdi,%rdi
+  801872:	74 5f                	je     8018d3 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801874:	55                   	push   %rbp
+  801875:	48 89 e5             	mov    %rsp,%rbp
+  801878:	53                   	push   %rbx
+  801879:	48 83 ec 08          	sub    $0x8,%rsp
+  80187d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801880:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801887:	00 00 00 
+  80188a:	ff d0                	call   *%rax
+  80188c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801892:	77 45                	ja     8018d9 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801894:	48 89 de             	mov    %rbx,%rsi
+  801897:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80189e:	00 00 00 
+  8018a1:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8018ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8018b7:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8018be:	00 00 00 
+  8018c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ca:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+        return -E_INVAL;
+  8018d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018d8:	c3                   	ret
+        return -E_INVAL;
+  8018d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018de:	eb ed                	jmp    8018cd <devfile_accept_snapshot+0x5e>
+
+00000000008018e0 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018e0:	48 85 ff             	test   %rdi,%rdi
+  8018e3:	0f 84 9f 00 00 00    	je     801988 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018e9:	55                   	push   %rbp
+  8018ea:	48 89 e5             	mov    %rsp,%rbp
+  8018ed:	41 54                	push   %r12
+  8018ef:	53                   	push   %rbx
+  8018f0:	48 89 fb             	mov    %rdi,%rbx
+  8018f3:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018f6:	48 85 f6             	test   %rsi,%rsi
+  8018f9:	74 78                	je     801973 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018fb:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+  801907:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80190d:	77 6b                	ja     80197a <devfile_create_snapshot+0x9a>
+  80190f:	4c 89 e7             	mov    %r12,%rdi
+  801912:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801919:	00 00 00 
+  80191c:	ff d0                	call   *%rax
+  80191e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801924:	77 5b                	ja     801981 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  801926:	48 89 de             	mov    %rbx,%rsi
+  801929:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801930:	00 00 00 
+  801933:	48 bb a1 2f 80 00 00 	movabs $0x802fa1,%rbx
+  80193a:	00 00 00 
+  80193d:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80193f:	4c 89 e6             	mov    %r12,%rsi
+  801942:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801949:	00 00 00 
+  80194c:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80194e:	be 00 00 00 00       	mov    $0x0,%esi
+  801953:	bf 08 00 00 00       	mov    $0x8,%edi
+  801958:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801964:	85 c0                	test   %eax,%eax
+  801966:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80196e:	5b                   	pop    %rbx
+  80196f:	41 5c                	pop    %r12
+  801971:	5d                   	pop    %rbp
+  801972:	c3                   	ret
+        return -E_INVAL;
+  801973:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801978:	eb f4                	jmp    80196e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80197a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197f:	eb ed                	jmp    80196e <devfile_create_snapshot+0x8e>
+  801981:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801986:	eb e6                	jmp    80196e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801988:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80198d:	c3                   	ret
+
+000000000080198e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80198e:	55                   	push   %rbp
+  80198f:	48 89 e5             	mov    %rsp,%rbp
+  801992:	41 54                	push   %r12
+  801994:	53                   	push   %rbx
+  801995:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801998:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80199b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8019a2:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8019a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8019ae:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8019b5:	00 00 00 
+  8019b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	78 3d                	js     8019fb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019be:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8019c5:	00 00 00 
+  8019c8:	4c 89 e6             	mov    %r12,%rsi
+  8019cb:	48 89 df             	mov    %rbx,%rdi
+  8019ce:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8019da:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019e1:	00 
+  8019e2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019e8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019ef:	00 
+  8019f0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019fb:	5b                   	pop    %rbx
+  8019fc:	41 5c                	pop    %r12
+  8019fe:	5d                   	pop    %rbp
+  8019ff:	c3                   	ret
+
+0000000000801a00 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	41 57                	push   %r15
+  801a06:	41 56                	push   %r14
+  801a08:	41 55                	push   %r13
+  801a0a:	41 54                	push   %r12
+  801a0c:	53                   	push   %rbx
+  801a0d:	48 83 ec 38          	sub    $0x38,%rsp
+  801a11:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801a15:	49 89 f5             	mov    %rsi,%r13
+  801a18:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a1b:	48 89 f0             	mov    %rsi,%rax
+  801a1e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a23:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801a27:	75 4f                	jne    801a78 <devfile_readmap+0x78>
+  801a29:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a2d:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a33:	75 1f                	jne    801a54 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a35:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a39:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a3d:	49 be e8 21 80 00 00 	movabs $0x8021e8,%r14
+  801a44:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a47:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a4e:	0f 87 9d 00 00 00    	ja     801af1 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a54:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a58:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a5c:	4d 85 ff             	test   %r15,%r15
+  801a5f:	0f 85 cf 00 00 00    	jne    801b34 <devfile_readmap+0x134>
+  801a65:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a69:	48 83 c4 38          	add    $0x38,%rsp
+  801a6d:	5b                   	pop    %rbx
+  801a6e:	41 5c                	pop    %r12
+  801a70:	41 5d                	pop    %r13
+  801a72:	41 5e                	pop    %r14
+  801a74:	41 5f                	pop    %r15
+  801a76:	5d                   	pop    %rbp
+  801a77:	c3                   	ret
+    size_t totalRead = 0;
+  801a78:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a7f:	00 
+  801a80:	eb da                	jmp    801a5c <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a82:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a86:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a89:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a90:	00 00 00 
+  801a93:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a99:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a9d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801aa1:	4c 89 ee             	mov    %r13,%rsi
+  801aa4:	bf 14 00 00 00       	mov    $0x14,%edi
+  801aa9:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	7e a3                	jle    801a5c <devfile_readmap+0x5c>
+  801ab9:	48 98                	cltq
+  801abb:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801abf:	72 9b                	jb     801a5c <devfile_readmap+0x5c>
+        buf += read;
+  801ac1:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801ac4:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801ac7:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801acb:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801ad2:	75 88                	jne    801a5c <devfile_readmap+0x5c>
+  801ad4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ad8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801ade:	0f 85 78 ff ff ff    	jne    801a5c <devfile_readmap+0x5c>
+  801ae4:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aeb:	0f 86 6b ff ff ff    	jbe    801a5c <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801af1:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801af7:	4d 39 e7             	cmp    %r12,%r15
+  801afa:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801afe:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801b05:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801b09:	0f 84 73 ff ff ff    	je     801a82 <devfile_readmap+0x82>
+  801b0f:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801b13:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801b18:	41 ff d6             	call   *%r14
+  801b1b:	a8 40                	test   $0x40,%al
+  801b1d:	0f 85 39 ff ff ff    	jne    801a5c <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801b23:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b2a:	4c 39 e3             	cmp    %r12,%rbx
+  801b2d:	72 e4                	jb     801b13 <devfile_readmap+0x113>
+  801b2f:	e9 4e ff ff ff       	jmp    801a82 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b34:	4c 89 fa             	mov    %r15,%rdx
+  801b37:	4c 89 ee             	mov    %r13,%rsi
+  801b3a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b3e:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  801b45:	00 00 00 
+  801b48:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b4a:	48 85 c0             	test   %rax,%rax
+  801b4d:	78 0c                	js     801b5b <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b4f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b53:	48 01 f0             	add    %rsi,%rax
+  801b56:	e9 0e ff ff ff       	jmp    801a69 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b5b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b5f:	48 85 f6             	test   %rsi,%rsi
+  801b62:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b66:	e9 fe fe ff ff       	jmp    801a69 <devfile_readmap+0x69>
+
+0000000000801b6b <open>:
+open(const char *path, int mode) {
+  801b6b:	55                   	push   %rbp
+  801b6c:	48 89 e5             	mov    %rsp,%rbp
+  801b6f:	41 55                	push   %r13
+  801b71:	41 54                	push   %r12
+  801b73:	53                   	push   %rbx
+  801b74:	48 83 ec 18          	sub    $0x18,%rsp
+  801b78:	49 89 fc             	mov    %rdi,%r12
+  801b7b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b7e:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  801b85:	00 00 00 
+  801b88:	ff d0                	call   *%rax
+  801b8a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b90:	0f 87 8a 00 00 00    	ja     801c20 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b9a:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+  801ba6:	89 c3                	mov    %eax,%ebx
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 50                	js     801bfc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801bac:	4c 89 e6             	mov    %r12,%rsi
+  801baf:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801bb6:	00 00 00 
+  801bb9:	48 89 df             	mov    %rbx,%rdi
+  801bbc:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801bc8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bcf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801bd3:	bf 01 00 00 00       	mov    $0x1,%edi
+  801bd8:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801bdf:	00 00 00 
+  801be2:	ff d0                	call   *%rax
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 1f                	js     801c09 <open+0x9e>
+    return fd2num(fd);
+  801bea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bee:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+  801bfa:	89 c3                	mov    %eax,%ebx
+}
+  801bfc:	89 d8                	mov    %ebx,%eax
+  801bfe:	48 83 c4 18          	add    $0x18,%rsp
+  801c02:	5b                   	pop    %rbx
+  801c03:	41 5c                	pop    %r12
+  801c05:	41 5d                	pop    %r13
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+        fd_close(fd, 0);
+  801c09:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801c12:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+        return res;
+  801c1e:	eb dc                	jmp    801bfc <open+0x91>
+        return -E_BAD_PATH;
+  801c20:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801c25:	eb d5                	jmp    801bfc <open+0x91>
+
+0000000000801c27 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801c27:	55                   	push   %rbp
+  801c28:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801c2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c30:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c35:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+}
+  801c41:	5d                   	pop    %rbp
+  801c42:	c3                   	ret
+
+0000000000801c43 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	41 54                	push   %r12
+  801c49:	53                   	push   %rbx
+  801c4a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c4d:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+  801c59:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c5c:	48 be c0 37 80 00 00 	movabs $0x8037c0,%rsi
+  801c63:	00 00 00 
+  801c66:	48 89 df             	mov    %rbx,%rdi
+  801c69:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  801c70:	00 00 00 
+  801c73:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c75:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c7a:	41 2b 04 24          	sub    (%r12),%eax
+  801c7e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c84:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c8b:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c8e:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c95:	00 00 00 
+  801c98:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	5b                   	pop    %rbx
+  801ca5:	41 5c                	pop    %r12
+  801ca7:	5d                   	pop    %rbp
+  801ca8:	c3                   	ret
+
+0000000000801ca9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+  801cb0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cb3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cb8:	48 89 fe             	mov    %rdi,%rsi
+  801cbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc0:	49 bc 97 03 80 00 00 	movabs $0x800397,%r12
+  801cc7:	00 00 00 
+  801cca:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801ccd:	48 89 df             	mov    %rbx,%rdi
+  801cd0:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801cd7:	00 00 00 
+  801cda:	ff d0                	call   *%rax
+  801cdc:	48 89 c6             	mov    %rax,%rsi
+  801cdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce9:	41 ff d4             	call   *%r12
+}
+  801cec:	5b                   	pop    %rbx
+  801ced:	41 5c                	pop    %r12
+  801cef:	5d                   	pop    %rbp
+  801cf0:	c3                   	ret
+
+0000000000801cf1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cf1:	55                   	push   %rbp
+  801cf2:	48 89 e5             	mov    %rsp,%rbp
+  801cf5:	41 57                	push   %r15
+  801cf7:	41 56                	push   %r14
+  801cf9:	41 55                	push   %r13
+  801cfb:	41 54                	push   %r12
+  801cfd:	53                   	push   %rbx
+  801cfe:	48 83 ec 18          	sub    $0x18,%rsp
+  801d02:	49 89 fc             	mov    %rdi,%r12
+  801d05:	49 89 f5             	mov    %rsi,%r13
+  801d08:	49 89 d7             	mov    %rdx,%r15
+  801d0b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801d0f:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801d1b:	4d 85 ff             	test   %r15,%r15
+  801d1e:	0f 84 af 00 00 00    	je     801dd3 <devpipe_write+0xe2>
+  801d24:	48 89 c3             	mov    %rax,%rbx
+  801d27:	4c 89 f8             	mov    %r15,%rax
+  801d2a:	4d 89 ef             	mov    %r13,%r15
+  801d2d:	4c 01 e8             	add    %r13,%rax
+  801d30:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d34:	49 bd 9f 02 80 00 00 	movabs $0x80029f,%r13
+  801d3b:	00 00 00 
+            sys_yield();
+  801d3e:	49 be 3c 02 80 00 00 	movabs $0x80023c,%r14
+  801d45:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d48:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d4b:	48 63 ce             	movslq %esi,%rcx
+  801d4e:	48 63 03             	movslq (%rbx),%rax
+  801d51:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d57:	48 39 c1             	cmp    %rax,%rcx
+  801d5a:	72 2e                	jb     801d8a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d61:	48 89 da             	mov    %rbx,%rdx
+  801d64:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d69:	4c 89 e7             	mov    %r12,%rdi
+  801d6c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	74 66                	je     801dd9 <devpipe_write+0xe8>
+            sys_yield();
+  801d73:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d76:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d79:	48 63 ce             	movslq %esi,%rcx
+  801d7c:	48 63 03             	movslq (%rbx),%rax
+  801d7f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d85:	48 39 c1             	cmp    %rax,%rcx
+  801d88:	73 d2                	jae    801d5c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d8a:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d8e:	48 89 ca             	mov    %rcx,%rdx
+  801d91:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d95:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d9c:	08 10 20 
+  801d9f:	48 f7 e2             	mul    %rdx
+  801da2:	48 c1 ea 06          	shr    $0x6,%rdx
+  801da6:	48 89 d0             	mov    %rdx,%rax
+  801da9:	48 c1 e0 09          	shl    $0x9,%rax
+  801dad:	48 29 d0             	sub    %rdx,%rax
+  801db0:	48 c1 e0 03          	shl    $0x3,%rax
+  801db4:	48 29 c1             	sub    %rax,%rcx
+  801db7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801dbc:	83 c6 01             	add    $0x1,%esi
+  801dbf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801dc2:	49 83 c7 01          	add    $0x1,%r15
+  801dc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dca:	49 39 c7             	cmp    %rax,%r15
+  801dcd:	0f 85 75 ff ff ff    	jne    801d48 <devpipe_write+0x57>
+    return n;
+  801dd3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801dd7:	eb 05                	jmp    801dde <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dde:	48 83 c4 18          	add    $0x18,%rsp
+  801de2:	5b                   	pop    %rbx
+  801de3:	41 5c                	pop    %r12
+  801de5:	41 5d                	pop    %r13
+  801de7:	41 5e                	pop    %r14
+  801de9:	41 5f                	pop    %r15
+  801deb:	5d                   	pop    %rbp
+  801dec:	c3                   	ret
+
+0000000000801ded <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ded:	55                   	push   %rbp
+  801dee:	48 89 e5             	mov    %rsp,%rbp
+  801df1:	41 57                	push   %r15
+  801df3:	41 56                	push   %r14
+  801df5:	41 55                	push   %r13
+  801df7:	41 54                	push   %r12
+  801df9:	53                   	push   %rbx
+  801dfa:	48 83 ec 18          	sub    $0x18,%rsp
+  801dfe:	49 89 fc             	mov    %rdi,%r12
+  801e01:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801e05:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e09:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+  801e15:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801e18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e1e:	49 bd 9f 02 80 00 00 	movabs $0x80029f,%r13
+  801e25:	00 00 00 
+            sys_yield();
+  801e28:	49 be 3c 02 80 00 00 	movabs $0x80023c,%r14
+  801e2f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e32:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e37:	74 7d                	je     801eb6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e39:	8b 03                	mov    (%rbx),%eax
+  801e3b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e3e:	75 26                	jne    801e66 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e40:	4d 85 ff             	test   %r15,%r15
+  801e43:	75 77                	jne    801ebc <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e45:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e4a:	48 89 da             	mov    %rbx,%rdx
+  801e4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e52:	4c 89 e7             	mov    %r12,%rdi
+  801e55:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	74 72                	je     801ece <devpipe_read+0xe1>
+            sys_yield();
+  801e5c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e5f:	8b 03                	mov    (%rbx),%eax
+  801e61:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e64:	74 df                	je     801e45 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e66:	48 63 c8             	movslq %eax,%rcx
+  801e69:	48 89 ca             	mov    %rcx,%rdx
+  801e6c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e70:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e77:	08 10 20 
+  801e7a:	48 89 d0             	mov    %rdx,%rax
+  801e7d:	48 f7 e6             	mul    %rsi
+  801e80:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e84:	48 89 d0             	mov    %rdx,%rax
+  801e87:	48 c1 e0 09          	shl    $0x9,%rax
+  801e8b:	48 29 d0             	sub    %rdx,%rax
+  801e8e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e95:	00 
+  801e96:	48 89 c8             	mov    %rcx,%rax
+  801e99:	48 29 d0             	sub    %rdx,%rax
+  801e9c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801ea1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ea5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801ea9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801eac:	49 83 c7 01          	add    $0x1,%r15
+  801eb0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801eb4:	75 83                	jne    801e39 <devpipe_read+0x4c>
+    return n;
+  801eb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eba:	eb 03                	jmp    801ebf <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801ebc:	4c 89 f8             	mov    %r15,%rax
+}
+  801ebf:	48 83 c4 18          	add    $0x18,%rsp
+  801ec3:	5b                   	pop    %rbx
+  801ec4:	41 5c                	pop    %r12
+  801ec6:	41 5d                	pop    %r13
+  801ec8:	41 5e                	pop    %r14
+  801eca:	41 5f                	pop    %r15
+  801ecc:	5d                   	pop    %rbp
+  801ecd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed3:	eb ea                	jmp    801ebf <devpipe_read+0xd2>
+
+0000000000801ed5 <pipe>:
+pipe(int pfd[2]) {
+  801ed5:	55                   	push   %rbp
+  801ed6:	48 89 e5             	mov    %rsp,%rbp
+  801ed9:	41 55                	push   %r13
+  801edb:	41 54                	push   %r12
+  801edd:	53                   	push   %rbx
+  801ede:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ee5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ee9:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+  801ef5:	89 c3                	mov    %eax,%ebx
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	0f 88 a0 01 00 00    	js     80209f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801eff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f09:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f12:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+  801f1e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	0f 88 77 01 00 00    	js     80209f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f28:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801f2c:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801f33:	00 00 00 
+  801f36:	ff d0                	call   *%rax
+  801f38:	89 c3                	mov    %eax,%ebx
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	0f 88 43 01 00 00    	js     802085 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f42:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f4c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f55:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  801f61:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	0f 88 1a 01 00 00    	js     802085 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f6b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f6f:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f7e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f88:	48 89 c6             	mov    %rax,%rsi
+  801f8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f90:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	89 c3                	mov    %eax,%ebx
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	0f 88 c5 00 00 00    	js     80206b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801fa6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801faa:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  801fb1:	00 00 00 
+  801fb4:	ff d0                	call   *%rax
+  801fb6:	48 89 c1             	mov    %rax,%rcx
+  801fb9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801fbf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fca:	4c 89 ee             	mov    %r13,%rsi
+  801fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd2:	48 b8 32 03 80 00 00 	movabs $0x800332,%rax
+  801fd9:	00 00 00 
+  801fdc:	ff d0                	call   *%rax
+  801fde:	89 c3                	mov    %eax,%ebx
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 6e                	js     802052 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fe4:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fe9:	4c 89 ef             	mov    %r13,%rdi
+  801fec:	48 b8 6d 02 80 00 00 	movabs $0x80026d,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+  801ff8:	83 f8 02             	cmp    $0x2,%eax
+  801ffb:	0f 85 ab 00 00 00    	jne    8020ac <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802001:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802008:	00 00 
+  80200a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80200e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802010:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802014:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80201b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80201f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802021:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802025:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80202c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802030:	48 bb 9b 06 80 00 00 	movabs $0x80069b,%rbx
+  802037:	00 00 00 
+  80203a:	ff d3                	call   *%rbx
+  80203c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802040:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802044:	ff d3                	call   *%rbx
+  802046:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80204b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802050:	eb 4d                	jmp    80209f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802052:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802057:	4c 89 ee             	mov    %r13,%rsi
+  80205a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80205f:	48 b8 97 03 80 00 00 	movabs $0x800397,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80206b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802070:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802074:	bf 00 00 00 00       	mov    $0x0,%edi
+  802079:	48 b8 97 03 80 00 00 	movabs $0x800397,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802085:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80208a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80208e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802093:	48 b8 97 03 80 00 00 	movabs $0x800397,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+}
+  80209f:	89 d8                	mov    %ebx,%eax
+  8020a1:	48 83 c4 18          	add    $0x18,%rsp
+  8020a5:	5b                   	pop    %rbx
+  8020a6:	41 5c                	pop    %r12
+  8020a8:	41 5d                	pop    %r13
+  8020aa:	5d                   	pop    %rbp
+  8020ab:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8020ac:	48 b9 f0 37 80 00 00 	movabs $0x8037f0,%rcx
+  8020b3:	00 00 00 
+  8020b6:	48 ba c7 37 80 00 00 	movabs $0x8037c7,%rdx
+  8020bd:	00 00 00 
+  8020c0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8020c5:	48 bf dc 37 80 00 00 	movabs $0x8037dc,%rdi
+  8020cc:	00 00 00 
+  8020cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d4:	49 b8 2c 25 80 00 00 	movabs $0x80252c,%r8
+  8020db:	00 00 00 
+  8020de:	41 ff d0             	call   *%r8
+
+00000000008020e1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020e1:	55                   	push   %rbp
+  8020e2:	48 89 e5             	mov    %rsp,%rbp
+  8020e5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020e9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020ed:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 35                	js     802132 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802101:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+  80210d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802110:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802115:	be 00 10 00 00       	mov    $0x1000,%esi
+  80211a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80211e:	48 b8 9f 02 80 00 00 	movabs $0x80029f,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	0f 94 c0             	sete   %al
+  80212f:	0f b6 c0             	movzbl %al,%eax
+}
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+
+0000000000802134 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802134:	48 89 f8             	mov    %rdi,%rax
+  802137:	48 c1 e8 27          	shr    $0x27,%rax
+  80213b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802142:	01 00 00 
+  802145:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802149:	f6 c2 01             	test   $0x1,%dl
+  80214c:	74 6d                	je     8021bb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80214e:	48 89 f8             	mov    %rdi,%rax
+  802151:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802155:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80215c:	01 00 00 
+  80215f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802163:	f6 c2 01             	test   $0x1,%dl
+  802166:	74 62                	je     8021ca <get_uvpt_entry+0x96>
+  802168:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80216f:	01 00 00 
+  802172:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802176:	f6 c2 80             	test   $0x80,%dl
+  802179:	75 4f                	jne    8021ca <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80217b:	48 89 f8             	mov    %rdi,%rax
+  80217e:	48 c1 e8 15          	shr    $0x15,%rax
+  802182:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802189:	01 00 00 
+  80218c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802190:	f6 c2 01             	test   $0x1,%dl
+  802193:	74 44                	je     8021d9 <get_uvpt_entry+0xa5>
+  802195:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80219c:	01 00 00 
+  80219f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8021a3:	f6 c2 80             	test   $0x80,%dl
+  8021a6:	75 31                	jne    8021d9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8021a8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8021ac:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8021b3:	01 00 00 
+  8021b6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8021ba:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8021bb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8021c2:	01 00 00 
+  8021c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021c9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8021ca:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021d1:	01 00 00 
+  8021d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021d8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021d9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021e0:	01 00 00 
+  8021e3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021e7:	c3                   	ret
+
+00000000008021e8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021e8:	55                   	push   %rbp
+  8021e9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021ec:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8021f3:	00 00 00 
+  8021f6:	ff d0                	call   *%rax
+  8021f8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021fb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802200:	89 c1                	mov    %eax,%ecx
+  802202:	83 c9 04             	or     $0x4,%ecx
+  802205:	f6 c2 01             	test   $0x1,%dl
+  802208:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80220b:	89 c1                	mov    %eax,%ecx
+  80220d:	83 c9 02             	or     $0x2,%ecx
+  802210:	f6 c2 02             	test   $0x2,%dl
+  802213:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802216:	89 c1                	mov    %eax,%ecx
+  802218:	83 c9 01             	or     $0x1,%ecx
+  80221b:	48 85 d2             	test   %rdx,%rdx
+  80221e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802221:	89 c1                	mov    %eax,%ecx
+  802223:	83 c9 40             	or     $0x40,%ecx
+  802226:	f6 c6 04             	test   $0x4,%dh
+  802229:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80222c:	5d                   	pop    %rbp
+  80222d:	c3                   	ret
+
+000000000080222e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80222e:	55                   	push   %rbp
+  80222f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802232:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80223e:	48 c1 e8 06          	shr    $0x6,%rax
+  802242:	83 e0 01             	and    $0x1,%eax
+}
+  802245:	5d                   	pop    %rbp
+  802246:	c3                   	ret
+
+0000000000802247 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802247:	55                   	push   %rbp
+  802248:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80224b:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802257:	48 c1 e8 05          	shr    $0x5,%rax
+  80225b:	83 e0 01             	and    $0x1,%eax
+}
+  80225e:	5d                   	pop    %rbp
+  80225f:	c3                   	ret
+
+0000000000802260 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802260:	55                   	push   %rbp
+  802261:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802264:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	83 e0 01             	and    $0x1,%eax
+}
+  802273:	5d                   	pop    %rbp
+  802274:	c3                   	ret
+
+0000000000802275 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802275:	55                   	push   %rbp
+  802276:	48 89 e5             	mov    %rsp,%rbp
+  802279:	41 57                	push   %r15
+  80227b:	41 56                	push   %r14
+  80227d:	41 55                	push   %r13
+  80227f:	41 54                	push   %r12
+  802281:	53                   	push   %rbx
+  802282:	48 83 ec 18          	sub    $0x18,%rsp
+  802286:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80228a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80228e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802293:	49 bd 60 22 80 00 00 	movabs $0x802260,%r13
+  80229a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80229d:	49 bf e8 21 80 00 00 	movabs $0x8021e8,%r15
+  8022a4:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8022a7:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8022ae:	00 00 00 
+  8022b1:	eb 0c                	jmp    8022bf <foreach_shared_region+0x4a>
+  8022b3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022ba:	4c 39 f3             	cmp    %r14,%rbx
+  8022bd:	74 2e                	je     8022ed <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8022bf:	48 89 df             	mov    %rbx,%rdi
+  8022c2:	41 ff d5             	call   *%r13
+  8022c5:	84 c0                	test   %al,%al
+  8022c7:	74 ea                	je     8022b3 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8022c9:	48 89 df             	mov    %rbx,%rdi
+  8022cc:	41 ff d7             	call   *%r15
+  8022cf:	a8 40                	test   $0x40,%al
+  8022d1:	74 e0                	je     8022b3 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022d3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8022da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022de:	48 89 df             	mov    %rbx,%rdi
+  8022e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e5:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	79 c8                	jns    8022b3 <foreach_shared_region+0x3e>
+  8022eb:	eb 05                	jmp    8022f2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f2:	48 83 c4 18          	add    $0x18,%rsp
+  8022f6:	5b                   	pop    %rbx
+  8022f7:	41 5c                	pop    %r12
+  8022f9:	41 5d                	pop    %r13
+  8022fb:	41 5e                	pop    %r14
+  8022fd:	41 5f                	pop    %r15
+  8022ff:	5d                   	pop    %rbp
+  802300:	c3                   	ret
+
+0000000000802301 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	c3                   	ret
+
+0000000000802307 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80230e:	48 be 14 38 80 00 00 	movabs $0x803814,%rsi
+  802315:	00 00 00 
+  802318:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  80231f:	00 00 00 
+  802322:	ff d0                	call   *%rax
+    return 0;
+}
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+  802329:	5d                   	pop    %rbp
+  80232a:	c3                   	ret
+
+000000000080232b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80232b:	55                   	push   %rbp
+  80232c:	48 89 e5             	mov    %rsp,%rbp
+  80232f:	41 57                	push   %r15
+  802331:	41 56                	push   %r14
+  802333:	41 55                	push   %r13
+  802335:	41 54                	push   %r12
+  802337:	53                   	push   %rbx
+  802338:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80233f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802346:	48 85 d2             	test   %rdx,%rdx
+  802349:	74 7a                	je     8023c5 <devcons_write+0x9a>
+  80234b:	49 89 d6             	mov    %rdx,%r14
+  80234e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802354:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802359:	49 bf 9b 31 80 00 00 	movabs $0x80319b,%r15
+  802360:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802363:	4c 89 f3             	mov    %r14,%rbx
+  802366:	48 29 f3             	sub    %rsi,%rbx
+  802369:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80236e:	48 39 c3             	cmp    %rax,%rbx
+  802371:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802375:	4c 63 eb             	movslq %ebx,%r13
+  802378:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80237f:	48 01 c6             	add    %rax,%rsi
+  802382:	4c 89 ea             	mov    %r13,%rdx
+  802385:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80238c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80238f:	4c 89 ee             	mov    %r13,%rsi
+  802392:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802399:	48 b8 42 01 80 00 00 	movabs $0x800142,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8023a5:	41 01 dc             	add    %ebx,%r12d
+  8023a8:	49 63 f4             	movslq %r12d,%rsi
+  8023ab:	4c 39 f6             	cmp    %r14,%rsi
+  8023ae:	72 b3                	jb     802363 <devcons_write+0x38>
+    return res;
+  8023b0:	49 63 c4             	movslq %r12d,%rax
+}
+  8023b3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8023ba:	5b                   	pop    %rbx
+  8023bb:	41 5c                	pop    %r12
+  8023bd:	41 5d                	pop    %r13
+  8023bf:	41 5e                	pop    %r14
+  8023c1:	41 5f                	pop    %r15
+  8023c3:	5d                   	pop    %rbp
+  8023c4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8023c5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023cb:	eb e3                	jmp    8023b0 <devcons_write+0x85>
+
+00000000008023cd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023cd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d5:	48 85 c0             	test   %rax,%rax
+  8023d8:	74 55                	je     80242f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	41 55                	push   %r13
+  8023e0:	41 54                	push   %r12
+  8023e2:	53                   	push   %rbx
+  8023e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023ea:	48 bb 6f 01 80 00 00 	movabs $0x80016f,%rbx
+  8023f1:	00 00 00 
+  8023f4:	49 bc 3c 02 80 00 00 	movabs $0x80023c,%r12
+  8023fb:	00 00 00 
+  8023fe:	eb 03                	jmp    802403 <devcons_read+0x36>
+  802400:	41 ff d4             	call   *%r12
+  802403:	ff d3                	call   *%rbx
+  802405:	85 c0                	test   %eax,%eax
+  802407:	74 f7                	je     802400 <devcons_read+0x33>
+    if (c < 0) return c;
+  802409:	48 63 d0             	movslq %eax,%rdx
+  80240c:	78 13                	js     802421 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80240e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802413:	83 f8 04             	cmp    $0x4,%eax
+  802416:	74 09                	je     802421 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802418:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80241c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802421:	48 89 d0             	mov    %rdx,%rax
+  802424:	48 83 c4 08          	add    $0x8,%rsp
+  802428:	5b                   	pop    %rbx
+  802429:	41 5c                	pop    %r12
+  80242b:	41 5d                	pop    %r13
+  80242d:	5d                   	pop    %rbp
+  80242e:	c3                   	ret
+  80242f:	48 89 d0             	mov    %rdx,%rax
+  802432:	c3                   	ret
+
+0000000000802433 <cputchar>:
+cputchar(int ch) {
+  802433:	55                   	push   %rbp
+  802434:	48 89 e5             	mov    %rsp,%rbp
+  802437:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80243b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80243f:	be 01 00 00 00       	mov    $0x1,%esi
+  802444:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802448:	48 b8 42 01 80 00 00 	movabs $0x800142,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+}
+  802454:	c9                   	leave
+  802455:	c3                   	ret
+
+0000000000802456 <getchar>:
+getchar(void) {
+  802456:	55                   	push   %rbp
+  802457:	48 89 e5             	mov    %rsp,%rbp
+  80245a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80245e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802463:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802467:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246c:	48 b8 0c 0a 80 00 00 	movabs $0x800a0c,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+  802478:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	78 06                	js     802484 <getchar+0x2e>
+  80247e:	74 08                	je     802488 <getchar+0x32>
+  802480:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802484:	89 d0                	mov    %edx,%eax
+  802486:	c9                   	leave
+  802487:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802488:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80248d:	eb f5                	jmp    802484 <getchar+0x2e>
+
+000000000080248f <iscons>:
+iscons(int fdnum) {
+  80248f:	55                   	push   %rbp
+  802490:	48 89 e5             	mov    %rsp,%rbp
+  802493:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802497:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80249b:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024a7:	85 c0                	test   %eax,%eax
+  8024a9:	78 18                	js     8024c3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8024ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024af:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  8024b6:	00 00 00 
+  8024b9:	8b 00                	mov    (%rax),%eax
+  8024bb:	39 02                	cmp    %eax,(%rdx)
+  8024bd:	0f 94 c0             	sete   %al
+  8024c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+00000000008024c5 <opencons>:
+opencons(void) {
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+  8024c9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024cd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024d1:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+  8024dd:	85 c0                	test   %eax,%eax
+  8024df:	78 49                	js     80252a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024e1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024eb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f4:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	85 c0                	test   %eax,%eax
+  802502:	78 26                	js     80252a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802504:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802508:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80250f:	00 00 
+  802511:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802513:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802517:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80251e:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+}
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+
+000000000080252c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80252c:	55                   	push   %rbp
+  80252d:	48 89 e5             	mov    %rsp,%rbp
+  802530:	41 56                	push   %r14
+  802532:	41 55                	push   %r13
+  802534:	41 54                	push   %r12
+  802536:	53                   	push   %rbx
+  802537:	48 83 ec 50          	sub    $0x50,%rsp
+  80253b:	49 89 fc             	mov    %rdi,%r12
+  80253e:	41 89 f5             	mov    %esi,%r13d
+  802541:	48 89 d3             	mov    %rdx,%rbx
+  802544:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802548:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80254c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802550:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802557:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80255b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80255f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802563:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802567:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80256e:	00 00 00 
+  802571:	4c 8b 30             	mov    (%rax),%r14
+  802574:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  80257b:	00 00 00 
+  80257e:	ff d0                	call   *%rax
+  802580:	89 c6                	mov    %eax,%esi
+  802582:	45 89 e8             	mov    %r13d,%r8d
+  802585:	4c 89 e1             	mov    %r12,%rcx
+  802588:	4c 89 f2             	mov    %r14,%rdx
+  80258b:	48 bf 20 38 80 00 00 	movabs $0x803820,%rdi
+  802592:	00 00 00 
+  802595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259a:	49 bc 7c 26 80 00 00 	movabs $0x80267c,%r12
+  8025a1:	00 00 00 
+  8025a4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8025a7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8025ab:	48 89 df             	mov    %rbx,%rdi
+  8025ae:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8025ba:	48 bf 7b 37 80 00 00 	movabs $0x80377b,%rdi
+  8025c1:	00 00 00 
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8025cc:	cc                   	int3
+  8025cd:	eb fd                	jmp    8025cc <_panic+0xa0>
+
+00000000008025cf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+  8025d3:	53                   	push   %rbx
+  8025d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025db:	8b 06                	mov    (%rsi),%eax
+  8025dd:	8d 50 01             	lea    0x1(%rax),%edx
+  8025e0:	89 16                	mov    %edx,(%rsi)
+  8025e2:	48 98                	cltq
+  8025e4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025e9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025ef:	74 0a                	je     8025fb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025f1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025fb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025ff:	be ff 00 00 00       	mov    $0xff,%esi
+  802604:	48 b8 42 01 80 00 00 	movabs $0x800142,%rax
+  80260b:	00 00 00 
+  80260e:	ff d0                	call   *%rax
+        state->offset = 0;
+  802610:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802616:	eb d9                	jmp    8025f1 <putch+0x22>
+
+0000000000802618 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802623:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802626:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80262d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802632:	b8 00 00 00 00       	mov    $0x0,%eax
+  802637:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80263a:	48 89 f1             	mov    %rsi,%rcx
+  80263d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802644:	48 bf cf 25 80 00 00 	movabs $0x8025cf,%rdi
+  80264b:	00 00 00 
+  80264e:	48 b8 cc 27 80 00 00 	movabs $0x8027cc,%rax
+  802655:	00 00 00 
+  802658:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80265a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802661:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802668:	48 b8 42 01 80 00 00 	movabs $0x800142,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802674:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	48 83 ec 50          	sub    $0x50,%rsp
+  802684:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802688:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80268c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802690:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802694:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802698:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80269f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026a7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8026af:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8026b3:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  8026ba:	00 00 00 
+  8026bd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8026bf:	c9                   	leave
+  8026c0:	c3                   	ret
+
+00000000008026c1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8026c1:	55                   	push   %rbp
+  8026c2:	48 89 e5             	mov    %rsp,%rbp
+  8026c5:	41 57                	push   %r15
+  8026c7:	41 56                	push   %r14
+  8026c9:	41 55                	push   %r13
+  8026cb:	41 54                	push   %r12
+  8026cd:	53                   	push   %rbx
+  8026ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d2:	49 89 fc             	mov    %rdi,%r12
+  8026d5:	49 89 f5             	mov    %rsi,%r13
+  8026d8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026dc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026df:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026e2:	41 89 cf             	mov    %ecx,%r15d
+  8026e5:	4c 39 fa             	cmp    %r15,%rdx
+  8026e8:	73 5b                	jae    802745 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026ea:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026ee:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026f2:	85 db                	test   %ebx,%ebx
+  8026f4:	7e 0e                	jle    802704 <print_num+0x43>
+            putch(padc, put_arg);
+  8026f6:	4c 89 ee             	mov    %r13,%rsi
+  8026f9:	44 89 f7             	mov    %r14d,%edi
+  8026fc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026ff:	83 eb 01             	sub    $0x1,%ebx
+  802702:	75 f2                	jne    8026f6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802704:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802708:	48 b9 54 38 80 00 00 	movabs $0x803854,%rcx
+  80270f:	00 00 00 
+  802712:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  802719:	00 00 00 
+  80271c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802720:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802724:	ba 00 00 00 00       	mov    $0x0,%edx
+  802729:	49 f7 f7             	div    %r15
+  80272c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802730:	4c 89 ee             	mov    %r13,%rsi
+  802733:	41 ff d4             	call   *%r12
+}
+  802736:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80273a:	5b                   	pop    %rbx
+  80273b:	41 5c                	pop    %r12
+  80273d:	41 5d                	pop    %r13
+  80273f:	41 5e                	pop    %r14
+  802741:	41 5f                	pop    %r15
+  802743:	5d                   	pop    %rbp
+  802744:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802745:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274e:	49 f7 f7             	div    %r15
+  802751:	48 83 ec 08          	sub    $0x8,%rsp
+  802755:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802759:	52                   	push   %rdx
+  80275a:	45 0f be c9          	movsbl %r9b,%r9d
+  80275e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802762:	48 89 c2             	mov    %rax,%rdx
+  802765:	48 b8 c1 26 80 00 00 	movabs $0x8026c1,%rax
+  80276c:	00 00 00 
+  80276f:	ff d0                	call   *%rax
+  802771:	48 83 c4 10          	add    $0x10,%rsp
+  802775:	eb 8d                	jmp    802704 <print_num+0x43>
+
+0000000000802777 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802777:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80277b:	48 8b 06             	mov    (%rsi),%rax
+  80277e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802782:	73 0a                	jae    80278e <sprintputch+0x17>
+        *state->start++ = ch;
+  802784:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802788:	48 89 16             	mov    %rdx,(%rsi)
+  80278b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80278e:	c3                   	ret
+
+000000000080278f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	48 83 ec 50          	sub    $0x50,%rsp
+  802797:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80279b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80279f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8027a3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8027aa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8027b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8027ba:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8027be:	48 b8 cc 27 80 00 00 	movabs $0x8027cc,%rax
+  8027c5:	00 00 00 
+  8027c8:	ff d0                	call   *%rax
+}
+  8027ca:	c9                   	leave
+  8027cb:	c3                   	ret
+
+00000000008027cc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8027cc:	55                   	push   %rbp
+  8027cd:	48 89 e5             	mov    %rsp,%rbp
+  8027d0:	41 57                	push   %r15
+  8027d2:	41 56                	push   %r14
+  8027d4:	41 55                	push   %r13
+  8027d6:	41 54                	push   %r12
+  8027d8:	53                   	push   %rbx
+  8027d9:	48 83 ec 38          	sub    $0x38,%rsp
+  8027dd:	49 89 fe             	mov    %rdi,%r14
+  8027e0:	49 89 f5             	mov    %rsi,%r13
+  8027e3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027e6:	48 8b 01             	mov    (%rcx),%rax
+  8027e9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ed:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027f5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027fd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802801:	0f b6 3b             	movzbl (%rbx),%edi
+  802804:	40 80 ff 25          	cmp    $0x25,%dil
+  802808:	74 18                	je     802822 <vprintfmt+0x56>
+            if (!ch) return;
+  80280a:	40 84 ff             	test   %dil,%dil
+  80280d:	0f 84 b1 06 00 00    	je     802ec4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802813:	40 0f b6 ff          	movzbl %dil,%edi
+  802817:	4c 89 ee             	mov    %r13,%rsi
+  80281a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80281d:	4c 89 e3             	mov    %r12,%rbx
+  802820:	eb db                	jmp    8027fd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802822:	be 00 00 00 00       	mov    $0x0,%esi
+  802827:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80282b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802830:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802836:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80283d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802841:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802846:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80284b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80284e:	83 e8 23             	sub    $0x23,%eax
+  802851:	3c 57                	cmp    $0x57,%al
+  802853:	0f 87 51 06 00 00    	ja     802eaa <vprintfmt+0x6de>
+  802859:	0f b6 c0             	movzbl %al,%eax
+  80285c:	48 b9 e0 39 80 00 00 	movabs $0x8039e0,%rcx
+  802863:	00 00 00 
+  802866:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802869:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80286c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802870:	eb cf                	jmp    802841 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802872:	49 89 dc             	mov    %rbx,%r12
+  802875:	be 01 00 00 00       	mov    $0x1,%esi
+  80287a:	eb c5                	jmp    802841 <vprintfmt+0x75>
+            padc = ch;
+  80287c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802880:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802883:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802886:	eb b9                	jmp    802841 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80288b:	83 f8 2f             	cmp    $0x2f,%eax
+  80288e:	77 24                	ja     8028b4 <vprintfmt+0xe8>
+  802890:	89 c1                	mov    %eax,%ecx
+  802892:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802896:	83 c0 08             	add    $0x8,%eax
+  802899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80289c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80289f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8028a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8028a6:	79 99                	jns    802841 <vprintfmt+0x75>
+                width = precision;
+  8028a8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8028ac:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8028b2:	eb 8d                	jmp    802841 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8028b4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8028b8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8028bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028c0:	eb da                	jmp    80289c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8028c2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8028c7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028cb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028d1:	3c 39                	cmp    $0x39,%al
+  8028d3:	77 1c                	ja     8028f1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8028d5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8028d9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028dd:	0f b6 c0             	movzbl %al,%eax
+  8028e0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028e5:	0f b6 03             	movzbl (%rbx),%eax
+  8028e8:	3c 39                	cmp    $0x39,%al
+  8028ea:	76 e9                	jbe    8028d5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028ec:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028ef:	eb b1                	jmp    8028a2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028f1:	49 89 dc             	mov    %rbx,%r12
+  8028f4:	eb ac                	jmp    8028a2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028f6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028f9:	85 c9                	test   %ecx,%ecx
+  8028fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802900:	0f 49 c1             	cmovns %ecx,%eax
+  802903:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802906:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802909:	e9 33 ff ff ff       	jmp    802841 <vprintfmt+0x75>
+            lflag++;
+  80290e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802911:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802914:	e9 28 ff ff ff       	jmp    802841 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802919:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80291c:	83 f8 2f             	cmp    $0x2f,%eax
+  80291f:	77 19                	ja     80293a <vprintfmt+0x16e>
+  802921:	89 c2                	mov    %eax,%edx
+  802923:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802927:	83 c0 08             	add    $0x8,%eax
+  80292a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80292d:	8b 3a                	mov    (%rdx),%edi
+  80292f:	4c 89 ee             	mov    %r13,%rsi
+  802932:	41 ff d6             	call   *%r14
+            break;
+  802935:	e9 c3 fe ff ff       	jmp    8027fd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80293a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80293e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802942:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802946:	eb e5                	jmp    80292d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802948:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80294b:	83 f8 2f             	cmp    $0x2f,%eax
+  80294e:	77 5a                	ja     8029aa <vprintfmt+0x1de>
+  802950:	89 c2                	mov    %eax,%edx
+  802952:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802956:	83 c0 08             	add    $0x8,%eax
+  802959:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80295c:	8b 02                	mov    (%rdx),%eax
+  80295e:	89 c1                	mov    %eax,%ecx
+  802960:	f7 d9                	neg    %ecx
+  802962:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802965:	83 f9 14             	cmp    $0x14,%ecx
+  802968:	7f 4e                	jg     8029b8 <vprintfmt+0x1ec>
+  80296a:	48 63 c1             	movslq %ecx,%rax
+  80296d:	48 ba a0 3c 80 00 00 	movabs $0x803ca0,%rdx
+  802974:	00 00 00 
+  802977:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80297b:	48 85 c0             	test   %rax,%rax
+  80297e:	74 38                	je     8029b8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802980:	48 89 c1             	mov    %rax,%rcx
+  802983:	48 ba d9 37 80 00 00 	movabs $0x8037d9,%rdx
+  80298a:	00 00 00 
+  80298d:	4c 89 ee             	mov    %r13,%rsi
+  802990:	4c 89 f7             	mov    %r14,%rdi
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+  802998:	49 b8 8f 27 80 00 00 	movabs $0x80278f,%r8
+  80299f:	00 00 00 
+  8029a2:	41 ff d0             	call   *%r8
+  8029a5:	e9 53 fe ff ff       	jmp    8027fd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8029aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029b6:	eb a4                	jmp    80295c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8029b8:	48 ba 6c 38 80 00 00 	movabs $0x80386c,%rdx
+  8029bf:	00 00 00 
+  8029c2:	4c 89 ee             	mov    %r13,%rsi
+  8029c5:	4c 89 f7             	mov    %r14,%rdi
+  8029c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cd:	49 b8 8f 27 80 00 00 	movabs $0x80278f,%r8
+  8029d4:	00 00 00 
+  8029d7:	41 ff d0             	call   *%r8
+  8029da:	e9 1e fe ff ff       	jmp    8027fd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8029e5:	77 6c                	ja     802a53 <vprintfmt+0x287>
+  8029e7:	89 c2                	mov    %eax,%edx
+  8029e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029ed:	83 c0 08             	add    $0x8,%eax
+  8029f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029f3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029f6:	48 85 d2             	test   %rdx,%rdx
+  8029f9:	48 b8 65 38 80 00 00 	movabs $0x803865,%rax
+  802a00:	00 00 00 
+  802a03:	48 0f 45 c2          	cmovne %rdx,%rax
+  802a07:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802a0b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802a0f:	7e 06                	jle    802a17 <vprintfmt+0x24b>
+  802a11:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802a15:	75 4a                	jne    802a61 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a17:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802a1b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802a1f:	0f b6 00             	movzbl (%rax),%eax
+  802a22:	84 c0                	test   %al,%al
+  802a24:	0f 85 9a 00 00 00    	jne    802ac4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802a2a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a2d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	0f 8e c4 fd ff ff    	jle    8027fd <vprintfmt+0x31>
+  802a39:	4c 89 ee             	mov    %r13,%rsi
+  802a3c:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a41:	41 ff d6             	call   *%r14
+  802a44:	41 83 ec 01          	sub    $0x1,%r12d
+  802a48:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a4c:	75 eb                	jne    802a39 <vprintfmt+0x26d>
+  802a4e:	e9 aa fd ff ff       	jmp    8027fd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a5f:	eb 92                	jmp    8029f3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a61:	49 63 f7             	movslq %r15d,%rsi
+  802a64:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a68:	48 b8 7e 2f 80 00 00 	movabs $0x802f7e,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+  802a74:	48 89 c2             	mov    %rax,%rdx
+  802a77:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a7a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a7c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a7f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	7e 91                	jle    802a17 <vprintfmt+0x24b>
+  802a86:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a8b:	4c 89 ee             	mov    %r13,%rsi
+  802a8e:	44 89 e7             	mov    %r12d,%edi
+  802a91:	41 ff d6             	call   *%r14
+  802a94:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a98:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a9b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a9e:	75 eb                	jne    802a8b <vprintfmt+0x2bf>
+  802aa0:	e9 72 ff ff ff       	jmp    802a17 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802aa5:	0f b6 f8             	movzbl %al,%edi
+  802aa8:	4c 89 ee             	mov    %r13,%rsi
+  802aab:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802aae:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802ab2:	49 83 c4 01          	add    $0x1,%r12
+  802ab6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802abc:	84 c0                	test   %al,%al
+  802abe:	0f 84 66 ff ff ff    	je     802a2a <vprintfmt+0x25e>
+  802ac4:	45 85 ff             	test   %r15d,%r15d
+  802ac7:	78 0a                	js     802ad3 <vprintfmt+0x307>
+  802ac9:	41 83 ef 01          	sub    $0x1,%r15d
+  802acd:	0f 88 57 ff ff ff    	js     802a2a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802ad3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802ad7:	74 cc                	je     802aa5 <vprintfmt+0x2d9>
+  802ad9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802adc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ae1:	80 fa 5e             	cmp    $0x5e,%dl
+  802ae4:	77 c2                	ja     802aa8 <vprintfmt+0x2dc>
+  802ae6:	eb bd                	jmp    802aa5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802ae8:	40 84 f6             	test   %sil,%sil
+  802aeb:	75 26                	jne    802b13 <vprintfmt+0x347>
+    switch (lflag) {
+  802aed:	85 d2                	test   %edx,%edx
+  802aef:	74 59                	je     802b4a <vprintfmt+0x37e>
+  802af1:	83 fa 01             	cmp    $0x1,%edx
+  802af4:	74 7b                	je     802b71 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802af6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802af9:	83 f8 2f             	cmp    $0x2f,%eax
+  802afc:	0f 87 96 00 00 00    	ja     802b98 <vprintfmt+0x3cc>
+  802b02:	89 c2                	mov    %eax,%edx
+  802b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b08:	83 c0 08             	add    $0x8,%eax
+  802b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b0e:	4c 8b 22             	mov    (%rdx),%r12
+  802b11:	eb 17                	jmp    802b2a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b16:	83 f8 2f             	cmp    $0x2f,%eax
+  802b19:	77 21                	ja     802b3c <vprintfmt+0x370>
+  802b1b:	89 c2                	mov    %eax,%edx
+  802b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b21:	83 c0 08             	add    $0x8,%eax
+  802b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b27:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802b2a:	4d 85 e4             	test   %r12,%r12
+  802b2d:	78 7a                	js     802ba9 <vprintfmt+0x3dd>
+            num = i;
+  802b2f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b37:	e9 50 02 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b48:	eb dd                	jmp    802b27 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b4d:	83 f8 2f             	cmp    $0x2f,%eax
+  802b50:	77 11                	ja     802b63 <vprintfmt+0x397>
+  802b52:	89 c2                	mov    %eax,%edx
+  802b54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b58:	83 c0 08             	add    $0x8,%eax
+  802b5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b5e:	4c 63 22             	movslq (%rdx),%r12
+  802b61:	eb c7                	jmp    802b2a <vprintfmt+0x35e>
+  802b63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b6f:	eb ed                	jmp    802b5e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b74:	83 f8 2f             	cmp    $0x2f,%eax
+  802b77:	77 11                	ja     802b8a <vprintfmt+0x3be>
+  802b79:	89 c2                	mov    %eax,%edx
+  802b7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b7f:	83 c0 08             	add    $0x8,%eax
+  802b82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b85:	4c 8b 22             	mov    (%rdx),%r12
+  802b88:	eb a0                	jmp    802b2a <vprintfmt+0x35e>
+  802b8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b96:	eb ed                	jmp    802b85 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ba0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ba4:	e9 65 ff ff ff       	jmp    802b0e <vprintfmt+0x342>
+                putch('-', put_arg);
+  802ba9:	4c 89 ee             	mov    %r13,%rsi
+  802bac:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802bb1:	41 ff d6             	call   *%r14
+                i = -i;
+  802bb4:	49 f7 dc             	neg    %r12
+  802bb7:	e9 73 ff ff ff       	jmp    802b2f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802bbc:	40 84 f6             	test   %sil,%sil
+  802bbf:	75 32                	jne    802bf3 <vprintfmt+0x427>
+    switch (lflag) {
+  802bc1:	85 d2                	test   %edx,%edx
+  802bc3:	74 5d                	je     802c22 <vprintfmt+0x456>
+  802bc5:	83 fa 01             	cmp    $0x1,%edx
+  802bc8:	0f 84 82 00 00 00    	je     802c50 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  802bd4:	0f 87 a5 00 00 00    	ja     802c7f <vprintfmt+0x4b3>
+  802bda:	89 c2                	mov    %eax,%edx
+  802bdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802be0:	83 c0 08             	add    $0x8,%eax
+  802be3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802be6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802be9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bee:	e9 99 01 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bf3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bf6:	83 f8 2f             	cmp    $0x2f,%eax
+  802bf9:	77 19                	ja     802c14 <vprintfmt+0x448>
+  802bfb:	89 c2                	mov    %eax,%edx
+  802bfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c01:	83 c0 08             	add    $0x8,%eax
+  802c04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c07:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c0f:	e9 78 01 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+  802c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c20:	eb e5                	jmp    802c07 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c25:	83 f8 2f             	cmp    $0x2f,%eax
+  802c28:	77 18                	ja     802c42 <vprintfmt+0x476>
+  802c2a:	89 c2                	mov    %eax,%edx
+  802c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c30:	83 c0 08             	add    $0x8,%eax
+  802c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c36:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c38:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c3d:	e9 4a 01 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+  802c42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c4e:	eb e6                	jmp    802c36 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c53:	83 f8 2f             	cmp    $0x2f,%eax
+  802c56:	77 19                	ja     802c71 <vprintfmt+0x4a5>
+  802c58:	89 c2                	mov    %eax,%edx
+  802c5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c5e:	83 c0 08             	add    $0x8,%eax
+  802c61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c64:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c67:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c6c:	e9 1b 01 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+  802c71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c7d:	eb e5                	jmp    802c64 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c8b:	e9 56 ff ff ff       	jmp    802be6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c90:	40 84 f6             	test   %sil,%sil
+  802c93:	75 2e                	jne    802cc3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c95:	85 d2                	test   %edx,%edx
+  802c97:	74 59                	je     802cf2 <vprintfmt+0x526>
+  802c99:	83 fa 01             	cmp    $0x1,%edx
+  802c9c:	74 7f                	je     802d1d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ca4:	0f 87 9f 00 00 00    	ja     802d49 <vprintfmt+0x57d>
+  802caa:	89 c2                	mov    %eax,%edx
+  802cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cb0:	83 c0 08             	add    $0x8,%eax
+  802cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cb9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802cbe:	e9 c9 00 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802cc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cc6:	83 f8 2f             	cmp    $0x2f,%eax
+  802cc9:	77 19                	ja     802ce4 <vprintfmt+0x518>
+  802ccb:	89 c2                	mov    %eax,%edx
+  802ccd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd1:	83 c0 08             	add    $0x8,%eax
+  802cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cda:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802cdf:	e9 a8 00 00 00       	jmp    802d8c <vprintfmt+0x5c0>
+  802ce4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ce8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cf0:	eb e5                	jmp    802cd7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cf8:	77 15                	ja     802d0f <vprintfmt+0x543>
+  802cfa:	89 c2                	mov    %eax,%edx
+  802cfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d00:	83 c0 08             	add    $0x8,%eax
+  802d03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d06:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802d08:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802d0d:	eb 7d                	jmp    802d8c <vprintfmt+0x5c0>
+  802d0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d1b:	eb e9                	jmp    802d06 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802d1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d20:	83 f8 2f             	cmp    $0x2f,%eax
+  802d23:	77 16                	ja     802d3b <vprintfmt+0x56f>
+  802d25:	89 c2                	mov    %eax,%edx
+  802d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d2b:	83 c0 08             	add    $0x8,%eax
+  802d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d39:	eb 51                	jmp    802d8c <vprintfmt+0x5c0>
+  802d3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d47:	eb e8                	jmp    802d31 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d55:	e9 5c ff ff ff       	jmp    802cb6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d5a:	4c 89 ee             	mov    %r13,%rsi
+  802d5d:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d62:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d65:	4c 89 ee             	mov    %r13,%rsi
+  802d68:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d6d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d73:	83 f8 2f             	cmp    $0x2f,%eax
+  802d76:	77 47                	ja     802dbf <vprintfmt+0x5f3>
+  802d78:	89 c2                	mov    %eax,%edx
+  802d7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d7e:	83 c0 08             	add    $0x8,%eax
+  802d81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d87:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d8c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d90:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d94:	0f 94 c0             	sete   %al
+  802d97:	0f b6 c0             	movzbl %al,%eax
+  802d9a:	50                   	push   %rax
+  802d9b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802da0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802da4:	4c 89 ee             	mov    %r13,%rsi
+  802da7:	4c 89 f7             	mov    %r14,%rdi
+  802daa:	48 b8 c1 26 80 00 00 	movabs $0x8026c1,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+            break;
+  802db6:	48 83 c4 10          	add    $0x10,%rsp
+  802dba:	e9 3e fa ff ff       	jmp    8027fd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802dbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dcb:	eb b7                	jmp    802d84 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802dcd:	40 84 f6             	test   %sil,%sil
+  802dd0:	75 2b                	jne    802dfd <vprintfmt+0x631>
+    switch (lflag) {
+  802dd2:	85 d2                	test   %edx,%edx
+  802dd4:	74 56                	je     802e2c <vprintfmt+0x660>
+  802dd6:	83 fa 01             	cmp    $0x1,%edx
+  802dd9:	74 7f                	je     802e5a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802ddb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dde:	83 f8 2f             	cmp    $0x2f,%eax
+  802de1:	0f 87 a2 00 00 00    	ja     802e89 <vprintfmt+0x6bd>
+  802de7:	89 c2                	mov    %eax,%edx
+  802de9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ded:	83 c0 08             	add    $0x8,%eax
+  802df0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802df3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802df6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dfb:	eb 8f                	jmp    802d8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e00:	83 f8 2f             	cmp    $0x2f,%eax
+  802e03:	77 19                	ja     802e1e <vprintfmt+0x652>
+  802e05:	89 c2                	mov    %eax,%edx
+  802e07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e0b:	83 c0 08             	add    $0x8,%eax
+  802e0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e14:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802e19:	e9 6e ff ff ff       	jmp    802d8c <vprintfmt+0x5c0>
+  802e1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e2a:	eb e5                	jmp    802e11 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802e2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e2f:	83 f8 2f             	cmp    $0x2f,%eax
+  802e32:	77 18                	ja     802e4c <vprintfmt+0x680>
+  802e34:	89 c2                	mov    %eax,%edx
+  802e36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e3a:	83 c0 08             	add    $0x8,%eax
+  802e3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e40:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e42:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e47:	e9 40 ff ff ff       	jmp    802d8c <vprintfmt+0x5c0>
+  802e4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e58:	eb e6                	jmp    802e40 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e5d:	83 f8 2f             	cmp    $0x2f,%eax
+  802e60:	77 19                	ja     802e7b <vprintfmt+0x6af>
+  802e62:	89 c2                	mov    %eax,%edx
+  802e64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e68:	83 c0 08             	add    $0x8,%eax
+  802e6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e6e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e71:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e76:	e9 11 ff ff ff       	jmp    802d8c <vprintfmt+0x5c0>
+  802e7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e87:	eb e5                	jmp    802e6e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e95:	e9 59 ff ff ff       	jmp    802df3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e9a:	4c 89 ee             	mov    %r13,%rsi
+  802e9d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802ea2:	41 ff d6             	call   *%r14
+            break;
+  802ea5:	e9 53 f9 ff ff       	jmp    8027fd <vprintfmt+0x31>
+            putch('%', put_arg);
+  802eaa:	4c 89 ee             	mov    %r13,%rsi
+  802ead:	bf 25 00 00 00       	mov    $0x25,%edi
+  802eb2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802eb5:	48 83 eb 01          	sub    $0x1,%rbx
+  802eb9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802ebd:	75 f6                	jne    802eb5 <vprintfmt+0x6e9>
+  802ebf:	e9 39 f9 ff ff       	jmp    8027fd <vprintfmt+0x31>
+}
+  802ec4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802ec8:	5b                   	pop    %rbx
+  802ec9:	41 5c                	pop    %r12
+  802ecb:	41 5d                	pop    %r13
+  802ecd:	41 5e                	pop    %r14
+  802ecf:	41 5f                	pop    %r15
+  802ed1:	5d                   	pop    %rbp
+  802ed2:	c3                   	ret
+
+0000000000802ed3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802ed3:	55                   	push   %rbp
+  802ed4:	48 89 e5             	mov    %rsp,%rbp
+  802ed7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802edb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802edf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ee4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ee8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802eef:	48 85 ff             	test   %rdi,%rdi
+  802ef2:	74 2b                	je     802f1f <vsnprintf+0x4c>
+  802ef4:	48 85 f6             	test   %rsi,%rsi
+  802ef7:	74 26                	je     802f1f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ef9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802efd:	48 bf 77 27 80 00 00 	movabs $0x802777,%rdi
+  802f04:	00 00 00 
+  802f07:	48 b8 cc 27 80 00 00 	movabs $0x8027cc,%rax
+  802f0e:	00 00 00 
+  802f11:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802f13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f17:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802f1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f1d:	c9                   	leave
+  802f1e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802f1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f24:	eb f7                	jmp    802f1d <vsnprintf+0x4a>
+
+0000000000802f26 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802f26:	55                   	push   %rbp
+  802f27:	48 89 e5             	mov    %rsp,%rbp
+  802f2a:	48 83 ec 50          	sub    $0x50,%rsp
+  802f2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f32:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f36:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f3a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f49:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f51:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f55:	48 b8 d3 2e 80 00 00 	movabs $0x802ed3,%rax
+  802f5c:	00 00 00 
+  802f5f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f61:	c9                   	leave
+  802f62:	c3                   	ret
+
+0000000000802f63 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f63:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f66:	74 10                	je     802f78 <strlen+0x15>
+    size_t n = 0;
+  802f68:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f6d:	48 83 c0 01          	add    $0x1,%rax
+  802f71:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f75:	75 f6                	jne    802f6d <strlen+0xa>
+  802f77:	c3                   	ret
+    size_t n = 0;
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f7d:	c3                   	ret
+
+0000000000802f7e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f7e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f81:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f86:	48 85 f6             	test   %rsi,%rsi
+  802f89:	74 11                	je     802f9c <strnlen+0x1e>
+  802f8b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f8f:	74 0c                	je     802f9d <strnlen+0x1f>
+  802f91:	48 83 c2 01          	add    $0x1,%rdx
+  802f95:	48 39 d0             	cmp    %rdx,%rax
+  802f98:	75 f1                	jne    802f8b <strnlen+0xd>
+  802f9a:	eb 04                	jmp    802fa0 <strnlen+0x22>
+  802f9c:	c3                   	ret
+  802f9d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802fa0:	c3                   	ret
+
+0000000000802fa1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802fa1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802fad:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802fb0:	48 83 c2 01          	add    $0x1,%rdx
+  802fb4:	84 c9                	test   %cl,%cl
+  802fb6:	75 f1                	jne    802fa9 <strcpy+0x8>
+        ;
+    return res;
+}
+  802fb8:	c3                   	ret
+
+0000000000802fb9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802fb9:	55                   	push   %rbp
+  802fba:	48 89 e5             	mov    %rsp,%rbp
+  802fbd:	41 54                	push   %r12
+  802fbf:	53                   	push   %rbx
+  802fc0:	48 89 fb             	mov    %rdi,%rbx
+  802fc3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802fc6:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802fd2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802fd6:	4c 89 e6             	mov    %r12,%rsi
+  802fd9:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  802fe0:	00 00 00 
+  802fe3:	ff d0                	call   *%rax
+    return dst;
+}
+  802fe5:	48 89 d8             	mov    %rbx,%rax
+  802fe8:	5b                   	pop    %rbx
+  802fe9:	41 5c                	pop    %r12
+  802feb:	5d                   	pop    %rbp
+  802fec:	c3                   	ret
+
+0000000000802fed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fed:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802ff0:	48 85 d2             	test   %rdx,%rdx
+  802ff3:	74 1f                	je     803014 <strncpy+0x27>
+  802ff5:	48 01 fa             	add    %rdi,%rdx
+  802ff8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802ffb:	48 83 c1 01          	add    $0x1,%rcx
+  802fff:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803003:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803007:	41 80 f8 01          	cmp    $0x1,%r8b
+  80300b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80300f:	48 39 ca             	cmp    %rcx,%rdx
+  803012:	75 e7                	jne    802ffb <strncpy+0xe>
+    }
+    return ret;
+}
+  803014:	c3                   	ret
+
+0000000000803015 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803015:	48 89 f8             	mov    %rdi,%rax
+  803018:	48 85 d2             	test   %rdx,%rdx
+  80301b:	74 24                	je     803041 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80301d:	48 83 ea 01          	sub    $0x1,%rdx
+  803021:	74 1b                	je     80303e <strlcpy+0x29>
+  803023:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803027:	0f b6 16             	movzbl (%rsi),%edx
+  80302a:	84 d2                	test   %dl,%dl
+  80302c:	74 10                	je     80303e <strlcpy+0x29>
+            *dst++ = *src++;
+  80302e:	48 83 c6 01          	add    $0x1,%rsi
+  803032:	48 83 c0 01          	add    $0x1,%rax
+  803036:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803039:	48 39 c8             	cmp    %rcx,%rax
+  80303c:	75 e9                	jne    803027 <strlcpy+0x12>
+        *dst = '\0';
+  80303e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803041:	48 29 f8             	sub    %rdi,%rax
+}
+  803044:	c3                   	ret
+
+0000000000803045 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803045:	0f b6 07             	movzbl (%rdi),%eax
+  803048:	84 c0                	test   %al,%al
+  80304a:	74 13                	je     80305f <strcmp+0x1a>
+  80304c:	38 06                	cmp    %al,(%rsi)
+  80304e:	75 0f                	jne    80305f <strcmp+0x1a>
+  803050:	48 83 c7 01          	add    $0x1,%rdi
+  803054:	48 83 c6 01          	add    $0x1,%rsi
+  803058:	0f b6 07             	movzbl (%rdi),%eax
+  80305b:	84 c0                	test   %al,%al
+  80305d:	75 ed                	jne    80304c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80305f:	0f b6 c0             	movzbl %al,%eax
+  803062:	0f b6 16             	movzbl (%rsi),%edx
+  803065:	29 d0                	sub    %edx,%eax
+}
+  803067:	c3                   	ret
+
+0000000000803068 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803068:	48 85 d2             	test   %rdx,%rdx
+  80306b:	74 1f                	je     80308c <strncmp+0x24>
+  80306d:	0f b6 07             	movzbl (%rdi),%eax
+  803070:	84 c0                	test   %al,%al
+  803072:	74 1e                	je     803092 <strncmp+0x2a>
+  803074:	3a 06                	cmp    (%rsi),%al
+  803076:	75 1a                	jne    803092 <strncmp+0x2a>
+  803078:	48 83 c7 01          	add    $0x1,%rdi
+  80307c:	48 83 c6 01          	add    $0x1,%rsi
+  803080:	48 83 ea 01          	sub    $0x1,%rdx
+  803084:	75 e7                	jne    80306d <strncmp+0x5>
+
+    if (!n) return 0;
+  803086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308b:	c3                   	ret
+  80308c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803091:	c3                   	ret
+  803092:	48 85 d2             	test   %rdx,%rdx
+  803095:	74 09                	je     8030a0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803097:	0f b6 07             	movzbl (%rdi),%eax
+  80309a:	0f b6 16             	movzbl (%rsi),%edx
+  80309d:	29 d0                	sub    %edx,%eax
+  80309f:	c3                   	ret
+    if (!n) return 0;
+  8030a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a5:	c3                   	ret
+
+00000000008030a6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8030a6:	0f b6 17             	movzbl (%rdi),%edx
+  8030a9:	84 d2                	test   %dl,%dl
+  8030ab:	74 18                	je     8030c5 <strchr+0x1f>
+        if (*str == c) {
+  8030ad:	0f be d2             	movsbl %dl,%edx
+  8030b0:	39 f2                	cmp    %esi,%edx
+  8030b2:	74 17                	je     8030cb <strchr+0x25>
+    for (; *str; str++) {
+  8030b4:	48 83 c7 01          	add    $0x1,%rdi
+  8030b8:	0f b6 17             	movzbl (%rdi),%edx
+  8030bb:	84 d2                	test   %dl,%dl
+  8030bd:	75 ee                	jne    8030ad <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8030bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c4:	c3                   	ret
+  8030c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ca:	c3                   	ret
+  8030cb:	48 89 f8             	mov    %rdi,%rax
+}
+  8030ce:	c3                   	ret
+
+00000000008030cf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8030cf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030d2:	0f b6 17             	movzbl (%rdi),%edx
+  8030d5:	84 d2                	test   %dl,%dl
+  8030d7:	74 13                	je     8030ec <strfind+0x1d>
+  8030d9:	0f be d2             	movsbl %dl,%edx
+  8030dc:	39 f2                	cmp    %esi,%edx
+  8030de:	74 0b                	je     8030eb <strfind+0x1c>
+  8030e0:	48 83 c0 01          	add    $0x1,%rax
+  8030e4:	0f b6 10             	movzbl (%rax),%edx
+  8030e7:	84 d2                	test   %dl,%dl
+  8030e9:	75 ee                	jne    8030d9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030eb:	c3                   	ret
+  8030ec:	c3                   	ret
+
+00000000008030ed <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030ed:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030f0:	48 89 f8             	mov    %rdi,%rax
+  8030f3:	48 f7 d8             	neg    %rax
+  8030f6:	83 e0 07             	and    $0x7,%eax
+  8030f9:	49 89 d1             	mov    %rdx,%r9
+  8030fc:	49 29 c1             	sub    %rax,%r9
+  8030ff:	78 36                	js     803137 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803101:	40 0f b6 c6          	movzbl %sil,%eax
+  803105:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80310c:	01 01 01 
+  80310f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803113:	40 f6 c7 07          	test   $0x7,%dil
+  803117:	75 38                	jne    803151 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803119:	4c 89 c9             	mov    %r9,%rcx
+  80311c:	48 c1 f9 03          	sar    $0x3,%rcx
+  803120:	74 0c                	je     80312e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803122:	fc                   	cld
+  803123:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803126:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80312a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80312e:	4d 85 c9             	test   %r9,%r9
+  803131:	75 45                	jne    803178 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803133:	4c 89 c0             	mov    %r8,%rax
+  803136:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803137:	48 85 d2             	test   %rdx,%rdx
+  80313a:	74 f7                	je     803133 <memset+0x46>
+  80313c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80313f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803142:	48 83 c0 01          	add    $0x1,%rax
+  803146:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80314a:	48 39 c2             	cmp    %rax,%rdx
+  80314d:	75 f3                	jne    803142 <memset+0x55>
+  80314f:	eb e2                	jmp    803133 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803151:	40 f6 c7 01          	test   $0x1,%dil
+  803155:	74 06                	je     80315d <memset+0x70>
+  803157:	88 07                	mov    %al,(%rdi)
+  803159:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80315d:	40 f6 c7 02          	test   $0x2,%dil
+  803161:	74 07                	je     80316a <memset+0x7d>
+  803163:	66 89 07             	mov    %ax,(%rdi)
+  803166:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80316a:	40 f6 c7 04          	test   $0x4,%dil
+  80316e:	74 a9                	je     803119 <memset+0x2c>
+  803170:	89 07                	mov    %eax,(%rdi)
+  803172:	48 83 c7 04          	add    $0x4,%rdi
+  803176:	eb a1                	jmp    803119 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803178:	41 f6 c1 04          	test   $0x4,%r9b
+  80317c:	74 06                	je     803184 <memset+0x97>
+  80317e:	89 07                	mov    %eax,(%rdi)
+  803180:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803184:	41 f6 c1 02          	test   $0x2,%r9b
+  803188:	74 07                	je     803191 <memset+0xa4>
+  80318a:	66 89 07             	mov    %ax,(%rdi)
+  80318d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803191:	41 f6 c1 01          	test   $0x1,%r9b
+  803195:	74 9c                	je     803133 <memset+0x46>
+  803197:	88 07                	mov    %al,(%rdi)
+  803199:	eb 98                	jmp    803133 <memset+0x46>
+
+000000000080319b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80319b:	48 89 f8             	mov    %rdi,%rax
+  80319e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8031a1:	48 39 fe             	cmp    %rdi,%rsi
+  8031a4:	73 3b                	jae    8031e1 <memmove+0x46>
+  8031a6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8031aa:	48 39 d7             	cmp    %rdx,%rdi
+  8031ad:	73 32                	jae    8031e1 <memmove+0x46>
+        s += n;
+        d += n;
+  8031af:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031b3:	48 89 d6             	mov    %rdx,%rsi
+  8031b6:	48 09 fe             	or     %rdi,%rsi
+  8031b9:	48 09 ce             	or     %rcx,%rsi
+  8031bc:	40 f6 c6 07          	test   $0x7,%sil
+  8031c0:	75 12                	jne    8031d4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8031c2:	48 83 ef 08          	sub    $0x8,%rdi
+  8031c6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8031ca:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031ce:	fd                   	std
+  8031cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031d2:	fc                   	cld
+  8031d3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031d4:	48 83 ef 01          	sub    $0x1,%rdi
+  8031d8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031dc:	fd                   	std
+  8031dd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031df:	eb f1                	jmp    8031d2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031e1:	48 89 f2             	mov    %rsi,%rdx
+  8031e4:	48 09 c2             	or     %rax,%rdx
+  8031e7:	48 09 ca             	or     %rcx,%rdx
+  8031ea:	f6 c2 07             	test   $0x7,%dl
+  8031ed:	75 0c                	jne    8031fb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031ef:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031f3:	48 89 c7             	mov    %rax,%rdi
+  8031f6:	fc                   	cld
+  8031f7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031fa:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031fb:	48 89 c7             	mov    %rax,%rdi
+  8031fe:	fc                   	cld
+  8031ff:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803201:	c3                   	ret
+
+0000000000803202 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803206:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+}
+  803212:	5d                   	pop    %rbp
+  803213:	c3                   	ret
+
+0000000000803214 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803214:	55                   	push   %rbp
+  803215:	48 89 e5             	mov    %rsp,%rbp
+  803218:	41 57                	push   %r15
+  80321a:	41 56                	push   %r14
+  80321c:	41 55                	push   %r13
+  80321e:	41 54                	push   %r12
+  803220:	53                   	push   %rbx
+  803221:	48 83 ec 08          	sub    $0x8,%rsp
+  803225:	49 89 fe             	mov    %rdi,%r14
+  803228:	49 89 f7             	mov    %rsi,%r15
+  80322b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80322e:	48 89 f7             	mov    %rsi,%rdi
+  803231:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  803238:	00 00 00 
+  80323b:	ff d0                	call   *%rax
+  80323d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803240:	48 89 de             	mov    %rbx,%rsi
+  803243:	4c 89 f7             	mov    %r14,%rdi
+  803246:	48 b8 7e 2f 80 00 00 	movabs $0x802f7e,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+  803252:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803255:	48 39 c3             	cmp    %rax,%rbx
+  803258:	74 36                	je     803290 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80325a:	48 89 d8             	mov    %rbx,%rax
+  80325d:	4c 29 e8             	sub    %r13,%rax
+  803260:	49 39 c4             	cmp    %rax,%r12
+  803263:	73 31                	jae    803296 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803265:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80326a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80326e:	4c 89 fe             	mov    %r15,%rsi
+  803271:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80327d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803281:	48 83 c4 08          	add    $0x8,%rsp
+  803285:	5b                   	pop    %rbx
+  803286:	41 5c                	pop    %r12
+  803288:	41 5d                	pop    %r13
+  80328a:	41 5e                	pop    %r14
+  80328c:	41 5f                	pop    %r15
+  80328e:	5d                   	pop    %rbp
+  80328f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803290:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803294:	eb eb                	jmp    803281 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803296:	48 83 eb 01          	sub    $0x1,%rbx
+  80329a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80329e:	48 89 da             	mov    %rbx,%rdx
+  8032a1:	4c 89 fe             	mov    %r15,%rsi
+  8032a4:	48 b8 02 32 80 00 00 	movabs $0x803202,%rax
+  8032ab:	00 00 00 
+  8032ae:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8032b0:	49 01 de             	add    %rbx,%r14
+  8032b3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8032b8:	eb c3                	jmp    80327d <strlcat+0x69>
+
+00000000008032ba <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8032ba:	48 85 d2             	test   %rdx,%rdx
+  8032bd:	74 2d                	je     8032ec <memcmp+0x32>
+  8032bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8032c4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8032c8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8032cd:	44 38 c1             	cmp    %r8b,%cl
+  8032d0:	75 0f                	jne    8032e1 <memcmp+0x27>
+    while (n-- > 0) {
+  8032d2:	48 83 c0 01          	add    $0x1,%rax
+  8032d6:	48 39 c2             	cmp    %rax,%rdx
+  8032d9:	75 e9                	jne    8032c4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032e1:	0f b6 c1             	movzbl %cl,%eax
+  8032e4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032e8:	44 29 c0             	sub    %r8d,%eax
+  8032eb:	c3                   	ret
+    return 0;
+  8032ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f1:	c3                   	ret
+
+00000000008032f2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032f2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032f6:	48 39 c7             	cmp    %rax,%rdi
+  8032f9:	73 0f                	jae    80330a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032fb:	40 38 37             	cmp    %sil,(%rdi)
+  8032fe:	74 0e                	je     80330e <memfind+0x1c>
+    for (; src < end; src++) {
+  803300:	48 83 c7 01          	add    $0x1,%rdi
+  803304:	48 39 f8             	cmp    %rdi,%rax
+  803307:	75 f2                	jne    8032fb <memfind+0x9>
+  803309:	c3                   	ret
+  80330a:	48 89 f8             	mov    %rdi,%rax
+  80330d:	c3                   	ret
+  80330e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803311:	c3                   	ret
+
+0000000000803312 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803312:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803315:	0f b6 37             	movzbl (%rdi),%esi
+  803318:	40 80 fe 20          	cmp    $0x20,%sil
+  80331c:	74 06                	je     803324 <strtol+0x12>
+  80331e:	40 80 fe 09          	cmp    $0x9,%sil
+  803322:	75 13                	jne    803337 <strtol+0x25>
+  803324:	48 83 c7 01          	add    $0x1,%rdi
+  803328:	0f b6 37             	movzbl (%rdi),%esi
+  80332b:	40 80 fe 20          	cmp    $0x20,%sil
+  80332f:	74 f3                	je     803324 <strtol+0x12>
+  803331:	40 80 fe 09          	cmp    $0x9,%sil
+  803335:	74 ed                	je     803324 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803337:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80333a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80333d:	3c 01                	cmp    $0x1,%al
+  80333f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803343:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803349:	75 0f                	jne    80335a <strtol+0x48>
+  80334b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80334e:	74 14                	je     803364 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803350:	85 d2                	test   %edx,%edx
+  803352:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803357:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80335a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80335f:	4c 63 ca             	movslq %edx,%r9
+  803362:	eb 36                	jmp    80339a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803364:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803368:	74 0f                	je     803379 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80336a:	85 d2                	test   %edx,%edx
+  80336c:	75 ec                	jne    80335a <strtol+0x48>
+        s++;
+  80336e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803372:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803377:	eb e1                	jmp    80335a <strtol+0x48>
+        s += 2;
+  803379:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80337d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803382:	eb d6                	jmp    80335a <strtol+0x48>
+            dig -= '0';
+  803384:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803387:	44 0f b6 c1          	movzbl %cl,%r8d
+  80338b:	41 39 d0             	cmp    %edx,%r8d
+  80338e:	7d 21                	jge    8033b1 <strtol+0x9f>
+        val = val * base + dig;
+  803390:	49 0f af c1          	imul   %r9,%rax
+  803394:	0f b6 c9             	movzbl %cl,%ecx
+  803397:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80339a:	48 83 c7 01          	add    $0x1,%rdi
+  80339e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8033a2:	80 f9 39             	cmp    $0x39,%cl
+  8033a5:	76 dd                	jbe    803384 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8033a7:	80 f9 7b             	cmp    $0x7b,%cl
+  8033aa:	77 05                	ja     8033b1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8033ac:	83 e9 57             	sub    $0x57,%ecx
+  8033af:	eb d6                	jmp    803387 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8033b1:	4d 85 d2             	test   %r10,%r10
+  8033b4:	74 03                	je     8033b9 <strtol+0xa7>
+  8033b6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8033b9:	48 89 c2             	mov    %rax,%rdx
+  8033bc:	48 f7 da             	neg    %rdx
+  8033bf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8033c3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8033c7:	c3                   	ret
+
+00000000008033c8 <strrev>:
+
+void
+strrev(char *str)
+{
+  8033c8:	55                   	push   %rbp
+  8033c9:	48 89 e5             	mov    %rsp,%rbp
+  8033cc:	53                   	push   %rbx
+  8033cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8033d1:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033d4:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033e0:	83 e8 01             	sub    $0x1,%eax
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	7e 22                	jle    803409 <strrev+0x41>
+  8033e7:	48 98                	cltq
+  8033e9:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033ee:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033f2:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033f6:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033fa:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033fd:	48 83 c2 01          	add    $0x1,%rdx
+  803401:	48 83 e8 01          	sub    $0x1,%rax
+  803405:	39 c2                	cmp    %eax,%edx
+  803407:	7c e5                	jl     8033ee <strrev+0x26>
+	}
+}
+  803409:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80340d:	c9                   	leave
+  80340e:	c3                   	ret
+
+000000000080340f <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80340f:	85 d2                	test   %edx,%edx
+  803411:	0f 84 80 00 00 00    	je     803497 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  803417:	55                   	push   %rbp
+  803418:	48 89 e5             	mov    %rsp,%rbp
+  80341b:	53                   	push   %rbx
+  80341c:	48 83 ec 08          	sub    $0x8,%rsp
+  803420:	49 89 f2             	mov    %rsi,%r10
+  803423:	41 89 d3             	mov    %edx,%r11d
+  803426:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  803429:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80342e:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  803431:	eb 20                	jmp    803453 <itoa+0x44>
+			str[i++] = '0' + digit;
+  803433:	41 89 f1             	mov    %esi,%r9d
+  803436:	83 c2 30             	add    $0x30,%edx
+  803439:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80343c:	89 f8                	mov    %edi,%eax
+  80343e:	99                   	cltd
+  80343f:	f7 f9                	idiv   %ecx
+  803441:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803443:	85 c0                	test   %eax,%eax
+  803445:	74 2e                	je     803475 <itoa+0x66>
+  803447:	83 c6 01             	add    $0x1,%esi
+  80344a:	49 83 c0 01          	add    $0x1,%r8
+  80344e:	44 39 cb             	cmp    %r9d,%ebx
+  803451:	7e 15                	jle    803468 <itoa+0x59>
+		digit = sum % base;
+  803453:	89 f8                	mov    %edi,%eax
+  803455:	99                   	cltd
+  803456:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803458:	83 fa 09             	cmp    $0x9,%edx
+  80345b:	7e d6                	jle    803433 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80345d:	41 89 f1             	mov    %esi,%r9d
+  803460:	83 c2 37             	add    $0x37,%edx
+  803463:	41 88 10             	mov    %dl,(%r8)
+  803466:	eb d4                	jmp    80343c <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803468:	41 83 eb 01          	sub    $0x1,%r11d
+  80346c:	45 39 cb             	cmp    %r9d,%r11d
+  80346f:	75 04                	jne    803475 <itoa+0x66>
+  803471:	85 c0                	test   %eax,%eax
+  803473:	75 28                	jne    80349d <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  803475:	4d 63 c9             	movslq %r9d,%r9
+  803478:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80347d:	4c 89 d7             	mov    %r10,%rdi
+  803480:	48 b8 c8 33 80 00 00 	movabs $0x8033c8,%rax
+  803487:	00 00 00 
+  80348a:	ff d0                	call   *%rax
+	return 0;
+  80348c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803491:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803495:	c9                   	leave
+  803496:	c3                   	ret
+		return -1;
+  803497:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80349c:	c3                   	ret
+		return -1;
+  80349d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8034a2:	eb ed                	jmp    803491 <itoa+0x82>
+
+00000000008034a4 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8034a4:	55                   	push   %rbp
+  8034a5:	48 89 e5             	mov    %rsp,%rbp
+  8034a8:	41 55                	push   %r13
+  8034aa:	41 54                	push   %r12
+  8034ac:	53                   	push   %rbx
+  8034ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8034b1:	49 89 fc             	mov    %rdi,%r12
+  8034b4:	48 89 f7             	mov    %rsi,%rdi
+  8034b7:	48 89 d3             	mov    %rdx,%rbx
+  8034ba:	49 89 cd             	mov    %rcx,%r13
+  8034bd:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8034c0:	48 85 f6             	test   %rsi,%rsi
+  8034c3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034ca:	00 00 00 
+  8034cd:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034d1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034d6:	48 85 db             	test   %rbx,%rbx
+  8034d9:	74 03                	je     8034de <ipc_recv_timed+0x3a>
+  8034db:	48 8b 33             	mov    (%rbx),%rsi
+  8034de:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  8034e5:	00 00 00 
+  8034e8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034ea:	85 c0                	test   %eax,%eax
+  8034ec:	78 75                	js     803563 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034ee:	4d 85 e4             	test   %r12,%r12
+  8034f1:	74 14                	je     803507 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034f3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034fa:	00 00 00 
+  8034fd:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803503:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803507:	4d 85 ed             	test   %r13,%r13
+  80350a:	74 14                	je     803520 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80350c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803513:	00 00 00 
+  803516:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80351c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803520:	48 85 db             	test   %rbx,%rbx
+  803523:	74 23                	je     803548 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803525:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80352c:	00 00 00 
+  80352f:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353a:	85 c9                	test   %ecx,%ecx
+  80353c:	74 07                	je     803545 <ipc_recv_timed+0xa1>
+  80353e:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803545:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803548:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80354f:	00 00 00 
+  803552:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803558:	48 83 c4 08          	add    $0x8,%rsp
+  80355c:	5b                   	pop    %rbx
+  80355d:	41 5c                	pop    %r12
+  80355f:	41 5d                	pop    %r13
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+        if (from_env_store != NULL) {
+  803563:	4d 85 e4             	test   %r12,%r12
+  803566:	74 08                	je     803570 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803568:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80356f:	00 
+        if (perm_store != NULL) {
+  803570:	4d 85 ed             	test   %r13,%r13
+  803573:	74 08                	je     80357d <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803575:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80357c:	00 
+        if (size != NULL) {
+  80357d:	48 85 db             	test   %rbx,%rbx
+  803580:	74 d6                	je     803558 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803582:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803589:	eb cd                	jmp    803558 <ipc_recv_timed+0xb4>
+
+000000000080358b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80358b:	55                   	push   %rbp
+  80358c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80358f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803595:	48 b8 a4 34 80 00 00 	movabs $0x8034a4,%rax
+  80359c:	00 00 00 
+  80359f:	ff d0                	call   *%rax
+}
+  8035a1:	5d                   	pop    %rbp
+  8035a2:	c3                   	ret
+
+00000000008035a3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8035a3:	55                   	push   %rbp
+  8035a4:	48 89 e5             	mov    %rsp,%rbp
+  8035a7:	41 57                	push   %r15
+  8035a9:	41 56                	push   %r14
+  8035ab:	41 55                	push   %r13
+  8035ad:	41 54                	push   %r12
+  8035af:	53                   	push   %rbx
+  8035b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8035b4:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8035b7:	48 89 d3             	mov    %rdx,%rbx
+  8035ba:	49 89 cc             	mov    %rcx,%r12
+  8035bd:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035c0:	48 85 d2             	test   %rdx,%rdx
+  8035c3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035ca:	00 00 00 
+  8035cd:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d1:	89 f0                	mov    %esi,%eax
+  8035d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035d7:	48 89 da             	mov    %rbx,%rdx
+  8035da:	48 89 c6             	mov    %rax,%rsi
+  8035dd:	48 b8 39 05 80 00 00 	movabs $0x800539,%rax
+  8035e4:	00 00 00 
+  8035e7:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	79 65                	jns    803652 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035ed:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035f0:	75 33                	jne    803625 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035f2:	49 bf 3c 02 80 00 00 	movabs $0x80023c,%r15
+  8035f9:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035fc:	49 be 39 05 80 00 00 	movabs $0x800539,%r14
+  803603:	00 00 00 
+        sys_yield();
+  803606:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803609:	45 89 e8             	mov    %r13d,%r8d
+  80360c:	4c 89 e1             	mov    %r12,%rcx
+  80360f:	48 89 da             	mov    %rbx,%rdx
+  803612:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803616:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803619:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80361c:	85 c0                	test   %eax,%eax
+  80361e:	79 32                	jns    803652 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803620:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803623:	74 e1                	je     803606 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803625:	89 c1                	mov    %eax,%ecx
+  803627:	48 ba 67 3d 80 00 00 	movabs $0x803d67,%rdx
+  80362e:	00 00 00 
+  803631:	be 52 00 00 00       	mov    $0x52,%esi
+  803636:	48 bf 7b 3d 80 00 00 	movabs $0x803d7b,%rdi
+  80363d:	00 00 00 
+  803640:	b8 00 00 00 00       	mov    $0x0,%eax
+  803645:	49 b8 2c 25 80 00 00 	movabs $0x80252c,%r8
+  80364c:	00 00 00 
+  80364f:	41 ff d0             	call   *%r8
+    }
+}
+  803652:	48 83 c4 18          	add    $0x18,%rsp
+  803656:	5b                   	pop    %rbx
+  803657:	41 5c                	pop    %r12
+  803659:	41 5d                	pop    %r13
+  80365b:	41 5e                	pop    %r14
+  80365d:	41 5f                	pop    %r15
+  80365f:	5d                   	pop    %rbp
+  803660:	c3                   	ret
+
+0000000000803661 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803661:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803666:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80366d:	00 00 00 
+  803670:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803674:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803678:	48 c1 e2 04          	shl    $0x4,%rdx
+  80367c:	48 01 ca             	add    %rcx,%rdx
+  80367f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803685:	39 fa                	cmp    %edi,%edx
+  803687:	74 12                	je     80369b <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803689:	48 83 c0 01          	add    $0x1,%rax
+  80368d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803693:	75 db                	jne    803670 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803695:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80369a:	c3                   	ret
+            return envs[i].env_id;
+  80369b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80369f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8036a3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036a7:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8036ae:	00 00 00 
+  8036b1:	48 01 d0             	add    %rdx,%rax
+  8036b4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036ba:	c3                   	ret
+  8036bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008036c0 <__rodata_start>:
+  8036c0:	3c 75                	cmp    $0x75,%al
+  8036c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c3:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c8:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8036cc:	1f                   	(bad)
+  8036cd:	44 00 00             	add    %r8b,(%rax)
+  8036d0:	73 79                	jae    80374b <__rodata_start+0x8b>
+  8036d2:	73 63                	jae    803737 <__rodata_start+0x77>
+  8036d4:	61                   	(bad)
+  8036d5:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b57 <__bss_end+0x72201b57>
+  8036dd:	65 74 75             	gs je  803755 <__rodata_start+0x95>
+  8036e0:	72 6e                	jb     803750 <__rodata_start+0x90>
+  8036e2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b64 <__bss_end+0x28201b64>
+  8036e9:	28 
+  8036ea:	3e 20 30             	ds and %dh,(%rax)
+  8036ed:	29 00                	sub    %eax,(%rax)
+  8036ef:	6c                   	insb   (%dx),%es:(%rdi)
+  8036f0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036f7:	61                   	(bad)
+  8036f8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036fa:	2e 63 00             	cs movsxd (%rax),%eax
+  8036fd:	0f 1f 00             	nopl   (%rax)
+  803700:	5b                   	pop    %rbx
+  803701:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803706:	20 75 6e             	and    %dh,0x6e(%rbp)
+  803709:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80370d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  803712:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  803719:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804184 <devcons+0x24>
+  803720:	5b                   	pop    %rbx
+  803721:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803726:	20 72 65             	and    %dh,0x65(%rdx)
+  803729:	61                   	(bad)
+  80372a:	64 6d                	fs insl (%dx),%es:(%rdi)
+  80372c:	61                   	(bad)
+  80372d:	70 20                	jo     80374f <__rodata_start+0x8f>
+  80372f:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  803734:	20 62 61             	and    %ah,0x61(%rdx)
+  803737:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80373b:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80373f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803742:	30 38                	xor    %bh,(%rax)
+  803744:	78 5d                	js     8037a3 <devtab+0x3>
+  803746:	20 66 74             	and    %ah,0x74(%rsi)
+  803749:	72 75                	jb     8037c0 <devtab+0x20>
+  80374b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80374c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80374f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad57ba <__bss_end+0x2d2cd7ba>
+  803756:	20 62 61             	and    %ah,0x61(%rdx)
+  803759:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80375d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803761:	5b                   	pop    %rbx
+  803762:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803767:	20 72 65             	and    %dh,0x65(%rdx)
+  80376a:	61                   	(bad)
+  80376b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad57d6 <__bss_end+0x2d2cd7d6>
+  803772:	20 62 61             	and    %ah,0x61(%rdx)
+  803775:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803779:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80377d:	5b                   	pop    %rbx
+  80377e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803783:	20 77 72             	and    %dh,0x72(%rdi)
+  803786:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80378d:	2d 
+  80378e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803793:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803796:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80379a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008037a0 <devtab>:
+  8037a0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  8037b0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  8037c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803800:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803810:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803820:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803830:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803840:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803850:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803860:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803870:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803880:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803890:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8038a0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8038b0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8038c0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8038d0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038e0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038f0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  803900:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  803910:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803920:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803930:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803940:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803950:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803960:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803970:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803980:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803990:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8039a0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8039b0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8039c0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8039d0:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039e0:	69 28 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     i(..............
+  8039f0:	9a 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803a00:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803a10:	aa 2e 80 00 00 00 00 00 88 28 80 00 00 00 00 00     .........(......
+  803a20:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803a30:	7c 28 80 00 00 00 00 00 f6 28 80 00 00 00 00 00     |(.......(......
+  803a40:	aa 2e 80 00 00 00 00 00 7c 28 80 00 00 00 00 00     ........|(......
+  803a50:	c2 28 80 00 00 00 00 00 c2 28 80 00 00 00 00 00     .(.......(......
+  803a60:	c2 28 80 00 00 00 00 00 c2 28 80 00 00 00 00 00     .(.......(......
+  803a70:	c2 28 80 00 00 00 00 00 c2 28 80 00 00 00 00 00     .(.......(......
+  803a80:	c2 28 80 00 00 00 00 00 c2 28 80 00 00 00 00 00     .(.......(......
+  803a90:	c2 28 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     .(..............
+  803aa0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803ab0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803ac0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803ad0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803ae0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803af0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b00:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b10:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b20:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b30:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b40:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b50:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b60:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b70:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803b80:	aa 2e 80 00 00 00 00 00 cd 2d 80 00 00 00 00 00     .........-......
+  803b90:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803ba0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803bb0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803bc0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803bd0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803be0:	19 29 80 00 00 00 00 00 e8 2a 80 00 00 00 00 00     .).......*......
+  803bf0:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803c00:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803c10:	48 29 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     H)..............
+  803c20:	aa 2e 80 00 00 00 00 00 0e 29 80 00 00 00 00 00     .........)......
+  803c30:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803c40:	90 2c 80 00 00 00 00 00 5a 2d 80 00 00 00 00 00     .,......Z-......
+  803c50:	aa 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  803c60:	df 29 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     .)..............
+  803c70:	bc 2b 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     .+..............
+  803c80:	aa 2e 80 00 00 00 00 00 cd 2d 80 00 00 00 00 00     .........-......
+  803c90:	aa 2e 80 00 00 00 00 00 72 28 80 00 00 00 00 00     ........r(......
+
+0000000000803ca0 <error_string>:
+	...
+  803ca8:	75 38 80 00 00 00 00 00 87 38 80 00 00 00 00 00     u8.......8......
+  803cb8:	97 38 80 00 00 00 00 00 a9 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	b7 38 80 00 00 00 00 00 cb 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	e0 38 80 00 00 00 00 00 f3 38 80 00 00 00 00 00     .8.......8......
+  803ce8:	05 39 80 00 00 00 00 00 19 39 80 00 00 00 00 00     .9.......9......
+  803cf8:	29 39 80 00 00 00 00 00 3c 39 80 00 00 00 00 00     )9......<9......
+  803d08:	53 39 80 00 00 00 00 00 69 39 80 00 00 00 00 00     S9......i9......
+  803d18:	81 39 80 00 00 00 00 00 99 39 80 00 00 00 00 00     .9.......9......
+  803d28:	a6 39 80 00 00 00 00 00 48 3d 80 00 00 00 00 00     .9......H=......
+  803d38:	ba 39 80 00 00 00 00 00 d2 39 80 00 00 00 00 00     .9.......9......
+  803d48:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d58:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d68:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d78:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff8:	00 00 00 0f 1f 44 00 00                             .....D..
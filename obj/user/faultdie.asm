@@ -0,0 +1,7501 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf b0 39 80 00 00 	movabs $0x8039b0,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	41 89 fd             	mov    %edi,%r13d
+  8000a3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a6:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8000b7:	00 00 00 
+  8000ba:	48 39 c2             	cmp    %rax,%rdx
+  8000bd:	73 17                	jae    8000d6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c2:	49 89 c4             	mov    %rax,%r12
+  8000c5:	48 83 c3 08          	add    $0x8,%rbx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d1:	4c 39 e3             	cmp    %r12,%rbx
+  8000d4:	72 ef                	jb     8000c5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000d6:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  8000e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000eb:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000ef:	48 c1 e0 04          	shl    $0x4,%rax
+  8000f3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000fa:	00 00 00 
+  8000fd:	48 01 d0             	add    %rdx,%rax
+  800100:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800107:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80010a:	45 85 ed             	test   %r13d,%r13d
+  80010d:	7e 0d                	jle    80011c <libmain+0x87>
+  80010f:	49 8b 06             	mov    (%r14),%rax
+  800112:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800119:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80011c:	4c 89 f6             	mov    %r14,%rsi
+  80011f:	44 89 ef             	mov    %r13d,%edi
+  800122:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80012e:	48 b8 43 01 80 00 00 	movabs $0x800143,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+#endif
+}
+  80013a:	5b                   	pop    %rbx
+  80013b:	41 5c                	pop    %r12
+  80013d:	41 5d                	pop    %r13
+  80013f:	41 5e                	pop    %r14
+  800141:	5d                   	pop    %rbp
+  800142:	c3                   	ret
+
+0000000000800143 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800143:	55                   	push   %rbp
+  800144:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800147:	48 b8 87 1a 80 00 00 	movabs $0x801a87,%rax
+  80014e:	00 00 00 
+  800151:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800153:	bf 00 00 00 00       	mov    $0x0,%edi
+  800158:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  80015f:	00 00 00 
+  800162:	ff d0                	call   *%rax
+}
+  800164:	5d                   	pop    %rbp
+  800165:	c3                   	ret
+
+0000000000800166 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800166:	55                   	push   %rbp
+  800167:	48 89 e5             	mov    %rsp,%rbp
+  80016a:	53                   	push   %rbx
+  80016b:	48 83 ec 08          	sub    $0x8,%rsp
+  80016f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800172:	8b 06                	mov    (%rsi),%eax
+  800174:	8d 50 01             	lea    0x1(%rax),%edx
+  800177:	89 16                	mov    %edx,(%rsi)
+  800179:	48 98                	cltq
+  80017b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800180:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800186:	74 0a                	je     800192 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800188:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80018c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800192:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800196:	be ff 00 00 00       	mov    $0xff,%esi
+  80019b:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001a7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001ad:	eb d9                	jmp    800188 <putch+0x22>
+
+00000000008001af <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001af:	55                   	push   %rbp
+  8001b0:	48 89 e5             	mov    %rsp,%rbp
+  8001b3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001ba:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001bd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001c4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001d1:	48 89 f1             	mov    %rsi,%rcx
+  8001d4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001db:	48 bf 66 01 80 00 00 	movabs $0x800166,%rdi
+  8001e2:	00 00 00 
+  8001e5:	48 b8 63 03 80 00 00 	movabs $0x800363,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001f1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001f8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001ff:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  800206:	00 00 00 
+  800209:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80020b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+
+0000000000800213 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800213:	55                   	push   %rbp
+  800214:	48 89 e5             	mov    %rsp,%rbp
+  800217:	48 83 ec 50          	sub    $0x50,%rsp
+  80021b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80021f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800223:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800227:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80022b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80022f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800236:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80023a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80023e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800242:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800246:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80024a:	48 b8 af 01 80 00 00 	movabs $0x8001af,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800256:	c9                   	leave
+  800257:	c3                   	ret
+
+0000000000800258 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800258:	55                   	push   %rbp
+  800259:	48 89 e5             	mov    %rsp,%rbp
+  80025c:	41 57                	push   %r15
+  80025e:	41 56                	push   %r14
+  800260:	41 55                	push   %r13
+  800262:	41 54                	push   %r12
+  800264:	53                   	push   %rbx
+  800265:	48 83 ec 18          	sub    $0x18,%rsp
+  800269:	49 89 fc             	mov    %rdi,%r12
+  80026c:	49 89 f5             	mov    %rsi,%r13
+  80026f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800273:	8b 45 10             	mov    0x10(%rbp),%eax
+  800276:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800279:	41 89 cf             	mov    %ecx,%r15d
+  80027c:	4c 39 fa             	cmp    %r15,%rdx
+  80027f:	73 5b                	jae    8002dc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800281:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800285:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800289:	85 db                	test   %ebx,%ebx
+  80028b:	7e 0e                	jle    80029b <print_num+0x43>
+            putch(padc, put_arg);
+  80028d:	4c 89 ee             	mov    %r13,%rsi
+  800290:	44 89 f7             	mov    %r14d,%edi
+  800293:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800296:	83 eb 01             	sub    $0x1,%ebx
+  800299:	75 f2                	jne    80028d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80029b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80029f:	48 b9 e8 39 80 00 00 	movabs $0x8039e8,%rcx
+  8002a6:	00 00 00 
+  8002a9:	48 b8 d7 39 80 00 00 	movabs $0x8039d7,%rax
+  8002b0:	00 00 00 
+  8002b3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c0:	49 f7 f7             	div    %r15
+  8002c3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002c7:	4c 89 ee             	mov    %r13,%rsi
+  8002ca:	41 ff d4             	call   *%r12
+}
+  8002cd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002d1:	5b                   	pop    %rbx
+  8002d2:	41 5c                	pop    %r12
+  8002d4:	41 5d                	pop    %r13
+  8002d6:	41 5e                	pop    %r14
+  8002d8:	41 5f                	pop    %r15
+  8002da:	5d                   	pop    %rbp
+  8002db:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e5:	49 f7 f7             	div    %r15
+  8002e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ec:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002f0:	52                   	push   %rdx
+  8002f1:	45 0f be c9          	movsbl %r9b,%r9d
+  8002f5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f9:	48 89 c2             	mov    %rax,%rdx
+  8002fc:	48 b8 58 02 80 00 00 	movabs $0x800258,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+  800308:	48 83 c4 10          	add    $0x10,%rsp
+  80030c:	eb 8d                	jmp    80029b <print_num+0x43>
+
+000000000080030e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80030e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800312:	48 8b 06             	mov    (%rsi),%rax
+  800315:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800319:	73 0a                	jae    800325 <sprintputch+0x17>
+        *state->start++ = ch;
+  80031b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80031f:	48 89 16             	mov    %rdx,(%rsi)
+  800322:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800325:	c3                   	ret
+
+0000000000800326 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800326:	55                   	push   %rbp
+  800327:	48 89 e5             	mov    %rsp,%rbp
+  80032a:	48 83 ec 50          	sub    $0x50,%rsp
+  80032e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800332:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800336:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80033a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800341:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800345:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800349:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80034d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800351:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800355:	48 b8 63 03 80 00 00 	movabs $0x800363,%rax
+  80035c:	00 00 00 
+  80035f:	ff d0                	call   *%rax
+}
+  800361:	c9                   	leave
+  800362:	c3                   	ret
+
+0000000000800363 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800363:	55                   	push   %rbp
+  800364:	48 89 e5             	mov    %rsp,%rbp
+  800367:	41 57                	push   %r15
+  800369:	41 56                	push   %r14
+  80036b:	41 55                	push   %r13
+  80036d:	41 54                	push   %r12
+  80036f:	53                   	push   %rbx
+  800370:	48 83 ec 38          	sub    $0x38,%rsp
+  800374:	49 89 fe             	mov    %rdi,%r14
+  800377:	49 89 f5             	mov    %rsi,%r13
+  80037a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80037d:	48 8b 01             	mov    (%rcx),%rax
+  800380:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800384:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800388:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80038c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800390:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800394:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800398:	0f b6 3b             	movzbl (%rbx),%edi
+  80039b:	40 80 ff 25          	cmp    $0x25,%dil
+  80039f:	74 18                	je     8003b9 <vprintfmt+0x56>
+            if (!ch) return;
+  8003a1:	40 84 ff             	test   %dil,%dil
+  8003a4:	0f 84 b1 06 00 00    	je     800a5b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003aa:	40 0f b6 ff          	movzbl %dil,%edi
+  8003ae:	4c 89 ee             	mov    %r13,%rsi
+  8003b1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003b4:	4c 89 e3             	mov    %r12,%rbx
+  8003b7:	eb db                	jmp    800394 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003be:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003c2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003c7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003cd:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003d4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003dd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003e2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003e5:	83 e8 23             	sub    $0x23,%eax
+  8003e8:	3c 57                	cmp    $0x57,%al
+  8003ea:	0f 87 51 06 00 00    	ja     800a41 <vprintfmt+0x6de>
+  8003f0:	0f b6 c0             	movzbl %al,%eax
+  8003f3:	48 b9 80 3b 80 00 00 	movabs $0x803b80,%rcx
+  8003fa:	00 00 00 
+  8003fd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800400:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800403:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800407:	eb cf                	jmp    8003d8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800409:	49 89 dc             	mov    %rbx,%r12
+  80040c:	be 01 00 00 00       	mov    $0x1,%esi
+  800411:	eb c5                	jmp    8003d8 <vprintfmt+0x75>
+            padc = ch;
+  800413:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800417:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80041a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80041d:	eb b9                	jmp    8003d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800422:	83 f8 2f             	cmp    $0x2f,%eax
+  800425:	77 24                	ja     80044b <vprintfmt+0xe8>
+  800427:	89 c1                	mov    %eax,%ecx
+  800429:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80042d:	83 c0 08             	add    $0x8,%eax
+  800430:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800433:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800436:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800439:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80043d:	79 99                	jns    8003d8 <vprintfmt+0x75>
+                width = precision;
+  80043f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800443:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800449:	eb 8d                	jmp    8003d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80044b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80044f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800453:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800457:	eb da                	jmp    800433 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800459:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80045e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800462:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800468:	3c 39                	cmp    $0x39,%al
+  80046a:	77 1c                	ja     800488 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80046c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800470:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800474:	0f b6 c0             	movzbl %al,%eax
+  800477:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80047c:	0f b6 03             	movzbl (%rbx),%eax
+  80047f:	3c 39                	cmp    $0x39,%al
+  800481:	76 e9                	jbe    80046c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800483:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800486:	eb b1                	jmp    800439 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800488:	49 89 dc             	mov    %rbx,%r12
+  80048b:	eb ac                	jmp    800439 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80048d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800490:	85 c9                	test   %ecx,%ecx
+  800492:	b8 00 00 00 00       	mov    $0x0,%eax
+  800497:	0f 49 c1             	cmovns %ecx,%eax
+  80049a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80049d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a0:	e9 33 ff ff ff       	jmp    8003d8 <vprintfmt+0x75>
+            lflag++;
+  8004a5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ab:	e9 28 ff ff ff       	jmp    8003d8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b6:	77 19                	ja     8004d1 <vprintfmt+0x16e>
+  8004b8:	89 c2                	mov    %eax,%edx
+  8004ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004be:	83 c0 08             	add    $0x8,%eax
+  8004c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c4:	8b 3a                	mov    (%rdx),%edi
+  8004c6:	4c 89 ee             	mov    %r13,%rsi
+  8004c9:	41 ff d6             	call   *%r14
+            break;
+  8004cc:	e9 c3 fe ff ff       	jmp    800394 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004dd:	eb e5                	jmp    8004c4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e5:	77 5a                	ja     800541 <vprintfmt+0x1de>
+  8004e7:	89 c2                	mov    %eax,%edx
+  8004e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ed:	83 c0 08             	add    $0x8,%eax
+  8004f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004f3:	8b 02                	mov    (%rdx),%eax
+  8004f5:	89 c1                	mov    %eax,%ecx
+  8004f7:	f7 d9                	neg    %ecx
+  8004f9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004fc:	83 f9 14             	cmp    $0x14,%ecx
+  8004ff:	7f 4e                	jg     80054f <vprintfmt+0x1ec>
+  800501:	48 63 c1             	movslq %ecx,%rax
+  800504:	48 ba 40 3e 80 00 00 	movabs $0x803e40,%rdx
+  80050b:	00 00 00 
+  80050e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800512:	48 85 c0             	test   %rax,%rax
+  800515:	74 38                	je     80054f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800517:	48 89 c1             	mov    %rax,%rcx
+  80051a:	48 ba ba 3f 80 00 00 	movabs $0x803fba,%rdx
+  800521:	00 00 00 
+  800524:	4c 89 ee             	mov    %r13,%rsi
+  800527:	4c 89 f7             	mov    %r14,%rdi
+  80052a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052f:	49 b8 26 03 80 00 00 	movabs $0x800326,%r8
+  800536:	00 00 00 
+  800539:	41 ff d0             	call   *%r8
+  80053c:	e9 53 fe ff ff       	jmp    800394 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800541:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800545:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054d:	eb a4                	jmp    8004f3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80054f:	48 ba 00 3a 80 00 00 	movabs $0x803a00,%rdx
+  800556:	00 00 00 
+  800559:	4c 89 ee             	mov    %r13,%rsi
+  80055c:	4c 89 f7             	mov    %r14,%rdi
+  80055f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800564:	49 b8 26 03 80 00 00 	movabs $0x800326,%r8
+  80056b:	00 00 00 
+  80056e:	41 ff d0             	call   *%r8
+  800571:	e9 1e fe ff ff       	jmp    800394 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800576:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800579:	83 f8 2f             	cmp    $0x2f,%eax
+  80057c:	77 6c                	ja     8005ea <vprintfmt+0x287>
+  80057e:	89 c2                	mov    %eax,%edx
+  800580:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800584:	83 c0 08             	add    $0x8,%eax
+  800587:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80058a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80058d:	48 85 d2             	test   %rdx,%rdx
+  800590:	48 b8 f9 39 80 00 00 	movabs $0x8039f9,%rax
+  800597:	00 00 00 
+  80059a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80059e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a6:	7e 06                	jle    8005ae <vprintfmt+0x24b>
+  8005a8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005ac:	75 4a                	jne    8005f8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005ae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005b2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005b6:	0f b6 00             	movzbl (%rax),%eax
+  8005b9:	84 c0                	test   %al,%al
+  8005bb:	0f 85 9a 00 00 00    	jne    80065b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005c8:	85 c0                	test   %eax,%eax
+  8005ca:	0f 8e c4 fd ff ff    	jle    800394 <vprintfmt+0x31>
+  8005d0:	4c 89 ee             	mov    %r13,%rsi
+  8005d3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005d8:	41 ff d6             	call   *%r14
+  8005db:	41 83 ec 01          	sub    $0x1,%r12d
+  8005df:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005e3:	75 eb                	jne    8005d0 <vprintfmt+0x26d>
+  8005e5:	e9 aa fd ff ff       	jmp    800394 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f6:	eb 92                	jmp    80058a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005f8:	49 63 f7             	movslq %r15d,%rsi
+  8005fb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005ff:	48 b8 15 0b 80 00 00 	movabs $0x800b15,%rax
+  800606:	00 00 00 
+  800609:	ff d0                	call   *%rax
+  80060b:	48 89 c2             	mov    %rax,%rdx
+  80060e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800611:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800613:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800616:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800619:	85 c0                	test   %eax,%eax
+  80061b:	7e 91                	jle    8005ae <vprintfmt+0x24b>
+  80061d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800622:	4c 89 ee             	mov    %r13,%rsi
+  800625:	44 89 e7             	mov    %r12d,%edi
+  800628:	41 ff d6             	call   *%r14
+  80062b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80062f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800632:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800635:	75 eb                	jne    800622 <vprintfmt+0x2bf>
+  800637:	e9 72 ff ff ff       	jmp    8005ae <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80063c:	0f b6 f8             	movzbl %al,%edi
+  80063f:	4c 89 ee             	mov    %r13,%rsi
+  800642:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800645:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800649:	49 83 c4 01          	add    $0x1,%r12
+  80064d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800653:	84 c0                	test   %al,%al
+  800655:	0f 84 66 ff ff ff    	je     8005c1 <vprintfmt+0x25e>
+  80065b:	45 85 ff             	test   %r15d,%r15d
+  80065e:	78 0a                	js     80066a <vprintfmt+0x307>
+  800660:	41 83 ef 01          	sub    $0x1,%r15d
+  800664:	0f 88 57 ff ff ff    	js     8005c1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80066a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80066e:	74 cc                	je     80063c <vprintfmt+0x2d9>
+  800670:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800673:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800678:	80 fa 5e             	cmp    $0x5e,%dl
+  80067b:	77 c2                	ja     80063f <vprintfmt+0x2dc>
+  80067d:	eb bd                	jmp    80063c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80067f:	40 84 f6             	test   %sil,%sil
+  800682:	75 26                	jne    8006aa <vprintfmt+0x347>
+    switch (lflag) {
+  800684:	85 d2                	test   %edx,%edx
+  800686:	74 59                	je     8006e1 <vprintfmt+0x37e>
+  800688:	83 fa 01             	cmp    $0x1,%edx
+  80068b:	74 7b                	je     800708 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80068d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800690:	83 f8 2f             	cmp    $0x2f,%eax
+  800693:	0f 87 96 00 00 00    	ja     80072f <vprintfmt+0x3cc>
+  800699:	89 c2                	mov    %eax,%edx
+  80069b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069f:	83 c0 08             	add    $0x8,%eax
+  8006a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a5:	4c 8b 22             	mov    (%rdx),%r12
+  8006a8:	eb 17                	jmp    8006c1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b0:	77 21                	ja     8006d3 <vprintfmt+0x370>
+  8006b2:	89 c2                	mov    %eax,%edx
+  8006b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b8:	83 c0 08             	add    $0x8,%eax
+  8006bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006be:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006c1:	4d 85 e4             	test   %r12,%r12
+  8006c4:	78 7a                	js     800740 <vprintfmt+0x3dd>
+            num = i;
+  8006c6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006ce:	e9 50 02 00 00       	jmp    800923 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006df:	eb dd                	jmp    8006be <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e7:	77 11                	ja     8006fa <vprintfmt+0x397>
+  8006e9:	89 c2                	mov    %eax,%edx
+  8006eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ef:	83 c0 08             	add    $0x8,%eax
+  8006f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f5:	4c 63 22             	movslq (%rdx),%r12
+  8006f8:	eb c7                	jmp    8006c1 <vprintfmt+0x35e>
+  8006fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800702:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800706:	eb ed                	jmp    8006f5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800708:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070b:	83 f8 2f             	cmp    $0x2f,%eax
+  80070e:	77 11                	ja     800721 <vprintfmt+0x3be>
+  800710:	89 c2                	mov    %eax,%edx
+  800712:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800716:	83 c0 08             	add    $0x8,%eax
+  800719:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071c:	4c 8b 22             	mov    (%rdx),%r12
+  80071f:	eb a0                	jmp    8006c1 <vprintfmt+0x35e>
+  800721:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800725:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800729:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072d:	eb ed                	jmp    80071c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80072f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800733:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800737:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073b:	e9 65 ff ff ff       	jmp    8006a5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800740:	4c 89 ee             	mov    %r13,%rsi
+  800743:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800748:	41 ff d6             	call   *%r14
+                i = -i;
+  80074b:	49 f7 dc             	neg    %r12
+  80074e:	e9 73 ff ff ff       	jmp    8006c6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800753:	40 84 f6             	test   %sil,%sil
+  800756:	75 32                	jne    80078a <vprintfmt+0x427>
+    switch (lflag) {
+  800758:	85 d2                	test   %edx,%edx
+  80075a:	74 5d                	je     8007b9 <vprintfmt+0x456>
+  80075c:	83 fa 01             	cmp    $0x1,%edx
+  80075f:	0f 84 82 00 00 00    	je     8007e7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800765:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800768:	83 f8 2f             	cmp    $0x2f,%eax
+  80076b:	0f 87 a5 00 00 00    	ja     800816 <vprintfmt+0x4b3>
+  800771:	89 c2                	mov    %eax,%edx
+  800773:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800777:	83 c0 08             	add    $0x8,%eax
+  80077a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800780:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800785:	e9 99 01 00 00       	jmp    800923 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80078a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078d:	83 f8 2f             	cmp    $0x2f,%eax
+  800790:	77 19                	ja     8007ab <vprintfmt+0x448>
+  800792:	89 c2                	mov    %eax,%edx
+  800794:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800798:	83 c0 08             	add    $0x8,%eax
+  80079b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007a6:	e9 78 01 00 00       	jmp    800923 <vprintfmt+0x5c0>
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb e5                	jmp    80079e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	77 18                	ja     8007d9 <vprintfmt+0x476>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007d4:	e9 4a 01 00 00       	jmp    800923 <vprintfmt+0x5c0>
+  8007d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e5:	eb e6                	jmp    8007cd <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ed:	77 19                	ja     800808 <vprintfmt+0x4a5>
+  8007ef:	89 c2                	mov    %eax,%edx
+  8007f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f5:	83 c0 08             	add    $0x8,%eax
+  8007f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800803:	e9 1b 01 00 00       	jmp    800923 <vprintfmt+0x5c0>
+  800808:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800810:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800814:	eb e5                	jmp    8007fb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800816:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800822:	e9 56 ff ff ff       	jmp    80077d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800827:	40 84 f6             	test   %sil,%sil
+  80082a:	75 2e                	jne    80085a <vprintfmt+0x4f7>
+    switch (lflag) {
+  80082c:	85 d2                	test   %edx,%edx
+  80082e:	74 59                	je     800889 <vprintfmt+0x526>
+  800830:	83 fa 01             	cmp    $0x1,%edx
+  800833:	74 7f                	je     8008b4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800835:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800838:	83 f8 2f             	cmp    $0x2f,%eax
+  80083b:	0f 87 9f 00 00 00    	ja     8008e0 <vprintfmt+0x57d>
+  800841:	89 c2                	mov    %eax,%edx
+  800843:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800847:	83 c0 08             	add    $0x8,%eax
+  80084a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800850:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800855:	e9 c9 00 00 00       	jmp    800923 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80085a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085d:	83 f8 2f             	cmp    $0x2f,%eax
+  800860:	77 19                	ja     80087b <vprintfmt+0x518>
+  800862:	89 c2                	mov    %eax,%edx
+  800864:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800868:	83 c0 08             	add    $0x8,%eax
+  80086b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800871:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800876:	e9 a8 00 00 00       	jmp    800923 <vprintfmt+0x5c0>
+  80087b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800887:	eb e5                	jmp    80086e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800889:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088c:	83 f8 2f             	cmp    $0x2f,%eax
+  80088f:	77 15                	ja     8008a6 <vprintfmt+0x543>
+  800891:	89 c2                	mov    %eax,%edx
+  800893:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800897:	83 c0 08             	add    $0x8,%eax
+  80089a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80089f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008a4:	eb 7d                	jmp    800923 <vprintfmt+0x5c0>
+  8008a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b2:	eb e9                	jmp    80089d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	77 16                	ja     8008d2 <vprintfmt+0x56f>
+  8008bc:	89 c2                	mov    %eax,%edx
+  8008be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c2:	83 c0 08             	add    $0x8,%eax
+  8008c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008cb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008d0:	eb 51                	jmp    800923 <vprintfmt+0x5c0>
+  8008d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008de:	eb e8                	jmp    8008c8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	e9 5c ff ff ff       	jmp    80084d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008f1:	4c 89 ee             	mov    %r13,%rsi
+  8008f4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008f9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008fc:	4c 89 ee             	mov    %r13,%rsi
+  8008ff:	bf 78 00 00 00       	mov    $0x78,%edi
+  800904:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 47                	ja     800956 <vprintfmt+0x5f3>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80091e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800923:	48 83 ec 08          	sub    $0x8,%rsp
+  800927:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80092b:	0f 94 c0             	sete   %al
+  80092e:	0f b6 c0             	movzbl %al,%eax
+  800931:	50                   	push   %rax
+  800932:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800937:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80093b:	4c 89 ee             	mov    %r13,%rsi
+  80093e:	4c 89 f7             	mov    %r14,%rdi
+  800941:	48 b8 58 02 80 00 00 	movabs $0x800258,%rax
+  800948:	00 00 00 
+  80094b:	ff d0                	call   *%rax
+            break;
+  80094d:	48 83 c4 10          	add    $0x10,%rsp
+  800951:	e9 3e fa ff ff       	jmp    800394 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800956:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800962:	eb b7                	jmp    80091b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800964:	40 84 f6             	test   %sil,%sil
+  800967:	75 2b                	jne    800994 <vprintfmt+0x631>
+    switch (lflag) {
+  800969:	85 d2                	test   %edx,%edx
+  80096b:	74 56                	je     8009c3 <vprintfmt+0x660>
+  80096d:	83 fa 01             	cmp    $0x1,%edx
+  800970:	74 7f                	je     8009f1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800972:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800975:	83 f8 2f             	cmp    $0x2f,%eax
+  800978:	0f 87 a2 00 00 00    	ja     800a20 <vprintfmt+0x6bd>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80098d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800992:	eb 8f                	jmp    800923 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800997:	83 f8 2f             	cmp    $0x2f,%eax
+  80099a:	77 19                	ja     8009b5 <vprintfmt+0x652>
+  80099c:	89 c2                	mov    %eax,%edx
+  80099e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a2:	83 c0 08             	add    $0x8,%eax
+  8009a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b0:	e9 6e ff ff ff       	jmp    800923 <vprintfmt+0x5c0>
+  8009b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c1:	eb e5                	jmp    8009a8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c9:	77 18                	ja     8009e3 <vprintfmt+0x680>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009d9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009de:	e9 40 ff ff ff       	jmp    800923 <vprintfmt+0x5c0>
+  8009e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ef:	eb e6                	jmp    8009d7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	77 19                	ja     800a12 <vprintfmt+0x6af>
+  8009f9:	89 c2                	mov    %eax,%edx
+  8009fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ff:	83 c0 08             	add    $0x8,%eax
+  800a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a08:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a0d:	e9 11 ff ff ff       	jmp    800923 <vprintfmt+0x5c0>
+  800a12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1e:	eb e5                	jmp    800a05 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2c:	e9 59 ff ff ff       	jmp    80098a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a31:	4c 89 ee             	mov    %r13,%rsi
+  800a34:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a39:	41 ff d6             	call   *%r14
+            break;
+  800a3c:	e9 53 f9 ff ff       	jmp    800394 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a41:	4c 89 ee             	mov    %r13,%rsi
+  800a44:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a49:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a4c:	48 83 eb 01          	sub    $0x1,%rbx
+  800a50:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a54:	75 f6                	jne    800a4c <vprintfmt+0x6e9>
+  800a56:	e9 39 f9 ff ff       	jmp    800394 <vprintfmt+0x31>
+}
+  800a5b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a5f:	5b                   	pop    %rbx
+  800a60:	41 5c                	pop    %r12
+  800a62:	41 5d                	pop    %r13
+  800a64:	41 5e                	pop    %r14
+  800a66:	41 5f                	pop    %r15
+  800a68:	5d                   	pop    %rbp
+  800a69:	c3                   	ret
+
+0000000000800a6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a6a:	55                   	push   %rbp
+  800a6b:	48 89 e5             	mov    %rsp,%rbp
+  800a6e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a76:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a7b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a86:	48 85 ff             	test   %rdi,%rdi
+  800a89:	74 2b                	je     800ab6 <vsnprintf+0x4c>
+  800a8b:	48 85 f6             	test   %rsi,%rsi
+  800a8e:	74 26                	je     800ab6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a94:	48 bf 0e 03 80 00 00 	movabs $0x80030e,%rdi
+  800a9b:	00 00 00 
+  800a9e:	48 b8 63 03 80 00 00 	movabs $0x800363,%rax
+  800aa5:	00 00 00 
+  800aa8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aaa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aae:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ab1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ab6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abb:	eb f7                	jmp    800ab4 <vsnprintf+0x4a>
+
+0000000000800abd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800abd:	55                   	push   %rbp
+  800abe:	48 89 e5             	mov    %rsp,%rbp
+  800ac1:	48 83 ec 50          	sub    $0x50,%rsp
+  800ac5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800acd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ad1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ad8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800adc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ae4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ae8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aec:	48 b8 6a 0a 80 00 00 	movabs $0x800a6a,%rax
+  800af3:	00 00 00 
+  800af6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800af8:	c9                   	leave
+  800af9:	c3                   	ret
+
+0000000000800afa <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800afa:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800afd:	74 10                	je     800b0f <strlen+0x15>
+    size_t n = 0;
+  800aff:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b04:	48 83 c0 01          	add    $0x1,%rax
+  800b08:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b0c:	75 f6                	jne    800b04 <strlen+0xa>
+  800b0e:	c3                   	ret
+    size_t n = 0;
+  800b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b14:	c3                   	ret
+
+0000000000800b15 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b15:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b18:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b1d:	48 85 f6             	test   %rsi,%rsi
+  800b20:	74 11                	je     800b33 <strnlen+0x1e>
+  800b22:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b26:	74 0c                	je     800b34 <strnlen+0x1f>
+  800b28:	48 83 c2 01          	add    $0x1,%rdx
+  800b2c:	48 39 d0             	cmp    %rdx,%rax
+  800b2f:	75 f1                	jne    800b22 <strnlen+0xd>
+  800b31:	eb 04                	jmp    800b37 <strnlen+0x22>
+  800b33:	c3                   	ret
+  800b34:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b37:	c3                   	ret
+
+0000000000800b38 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b38:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b40:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b44:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b47:	48 83 c2 01          	add    $0x1,%rdx
+  800b4b:	84 c9                	test   %cl,%cl
+  800b4d:	75 f1                	jne    800b40 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b4f:	c3                   	ret
+
+0000000000800b50 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b50:	55                   	push   %rbp
+  800b51:	48 89 e5             	mov    %rsp,%rbp
+  800b54:	41 54                	push   %r12
+  800b56:	53                   	push   %rbx
+  800b57:	48 89 fb             	mov    %rdi,%rbx
+  800b5a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b5d:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800b64:	00 00 00 
+  800b67:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b69:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b6d:	4c 89 e6             	mov    %r12,%rsi
+  800b70:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  800b77:	00 00 00 
+  800b7a:	ff d0                	call   *%rax
+    return dst;
+}
+  800b7c:	48 89 d8             	mov    %rbx,%rax
+  800b7f:	5b                   	pop    %rbx
+  800b80:	41 5c                	pop    %r12
+  800b82:	5d                   	pop    %rbp
+  800b83:	c3                   	ret
+
+0000000000800b84 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b84:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b87:	48 85 d2             	test   %rdx,%rdx
+  800b8a:	74 1f                	je     800bab <strncpy+0x27>
+  800b8c:	48 01 fa             	add    %rdi,%rdx
+  800b8f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b92:	48 83 c1 01          	add    $0x1,%rcx
+  800b96:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b9a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b9e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ba2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ba6:	48 39 ca             	cmp    %rcx,%rdx
+  800ba9:	75 e7                	jne    800b92 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bab:	c3                   	ret
+
+0000000000800bac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bac:	48 89 f8             	mov    %rdi,%rax
+  800baf:	48 85 d2             	test   %rdx,%rdx
+  800bb2:	74 24                	je     800bd8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bb4:	48 83 ea 01          	sub    $0x1,%rdx
+  800bb8:	74 1b                	je     800bd5 <strlcpy+0x29>
+  800bba:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bbe:	0f b6 16             	movzbl (%rsi),%edx
+  800bc1:	84 d2                	test   %dl,%dl
+  800bc3:	74 10                	je     800bd5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800bc5:	48 83 c6 01          	add    $0x1,%rsi
+  800bc9:	48 83 c0 01          	add    $0x1,%rax
+  800bcd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bd0:	48 39 c8             	cmp    %rcx,%rax
+  800bd3:	75 e9                	jne    800bbe <strlcpy+0x12>
+        *dst = '\0';
+  800bd5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bd8:	48 29 f8             	sub    %rdi,%rax
+}
+  800bdb:	c3                   	ret
+
+0000000000800bdc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bdc:	0f b6 07             	movzbl (%rdi),%eax
+  800bdf:	84 c0                	test   %al,%al
+  800be1:	74 13                	je     800bf6 <strcmp+0x1a>
+  800be3:	38 06                	cmp    %al,(%rsi)
+  800be5:	75 0f                	jne    800bf6 <strcmp+0x1a>
+  800be7:	48 83 c7 01          	add    $0x1,%rdi
+  800beb:	48 83 c6 01          	add    $0x1,%rsi
+  800bef:	0f b6 07             	movzbl (%rdi),%eax
+  800bf2:	84 c0                	test   %al,%al
+  800bf4:	75 ed                	jne    800be3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf6:	0f b6 c0             	movzbl %al,%eax
+  800bf9:	0f b6 16             	movzbl (%rsi),%edx
+  800bfc:	29 d0                	sub    %edx,%eax
+}
+  800bfe:	c3                   	ret
+
+0000000000800bff <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bff:	48 85 d2             	test   %rdx,%rdx
+  800c02:	74 1f                	je     800c23 <strncmp+0x24>
+  800c04:	0f b6 07             	movzbl (%rdi),%eax
+  800c07:	84 c0                	test   %al,%al
+  800c09:	74 1e                	je     800c29 <strncmp+0x2a>
+  800c0b:	3a 06                	cmp    (%rsi),%al
+  800c0d:	75 1a                	jne    800c29 <strncmp+0x2a>
+  800c0f:	48 83 c7 01          	add    $0x1,%rdi
+  800c13:	48 83 c6 01          	add    $0x1,%rsi
+  800c17:	48 83 ea 01          	sub    $0x1,%rdx
+  800c1b:	75 e7                	jne    800c04 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c22:	c3                   	ret
+  800c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c28:	c3                   	ret
+  800c29:	48 85 d2             	test   %rdx,%rdx
+  800c2c:	74 09                	je     800c37 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c2e:	0f b6 07             	movzbl (%rdi),%eax
+  800c31:	0f b6 16             	movzbl (%rsi),%edx
+  800c34:	29 d0                	sub    %edx,%eax
+  800c36:	c3                   	ret
+    if (!n) return 0;
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c3c:	c3                   	ret
+
+0000000000800c3d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c3d:	0f b6 17             	movzbl (%rdi),%edx
+  800c40:	84 d2                	test   %dl,%dl
+  800c42:	74 18                	je     800c5c <strchr+0x1f>
+        if (*str == c) {
+  800c44:	0f be d2             	movsbl %dl,%edx
+  800c47:	39 f2                	cmp    %esi,%edx
+  800c49:	74 17                	je     800c62 <strchr+0x25>
+    for (; *str; str++) {
+  800c4b:	48 83 c7 01          	add    $0x1,%rdi
+  800c4f:	0f b6 17             	movzbl (%rdi),%edx
+  800c52:	84 d2                	test   %dl,%dl
+  800c54:	75 ee                	jne    800c44 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5b:	c3                   	ret
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c61:	c3                   	ret
+  800c62:	48 89 f8             	mov    %rdi,%rax
+}
+  800c65:	c3                   	ret
+
+0000000000800c66 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c66:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c69:	0f b6 17             	movzbl (%rdi),%edx
+  800c6c:	84 d2                	test   %dl,%dl
+  800c6e:	74 13                	je     800c83 <strfind+0x1d>
+  800c70:	0f be d2             	movsbl %dl,%edx
+  800c73:	39 f2                	cmp    %esi,%edx
+  800c75:	74 0b                	je     800c82 <strfind+0x1c>
+  800c77:	48 83 c0 01          	add    $0x1,%rax
+  800c7b:	0f b6 10             	movzbl (%rax),%edx
+  800c7e:	84 d2                	test   %dl,%dl
+  800c80:	75 ee                	jne    800c70 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c82:	c3                   	ret
+  800c83:	c3                   	ret
+
+0000000000800c84 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c84:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c87:	48 89 f8             	mov    %rdi,%rax
+  800c8a:	48 f7 d8             	neg    %rax
+  800c8d:	83 e0 07             	and    $0x7,%eax
+  800c90:	49 89 d1             	mov    %rdx,%r9
+  800c93:	49 29 c1             	sub    %rax,%r9
+  800c96:	78 36                	js     800cce <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c98:	40 0f b6 c6          	movzbl %sil,%eax
+  800c9c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ca3:	01 01 01 
+  800ca6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800caa:	40 f6 c7 07          	test   $0x7,%dil
+  800cae:	75 38                	jne    800ce8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cb0:	4c 89 c9             	mov    %r9,%rcx
+  800cb3:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cb7:	74 0c                	je     800cc5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cb9:	fc                   	cld
+  800cba:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cbd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cc1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cc5:	4d 85 c9             	test   %r9,%r9
+  800cc8:	75 45                	jne    800d0f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cca:	4c 89 c0             	mov    %r8,%rax
+  800ccd:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cce:	48 85 d2             	test   %rdx,%rdx
+  800cd1:	74 f7                	je     800cca <memset+0x46>
+  800cd3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cd6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cd9:	48 83 c0 01          	add    $0x1,%rax
+  800cdd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ce1:	48 39 c2             	cmp    %rax,%rdx
+  800ce4:	75 f3                	jne    800cd9 <memset+0x55>
+  800ce6:	eb e2                	jmp    800cca <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ce8:	40 f6 c7 01          	test   $0x1,%dil
+  800cec:	74 06                	je     800cf4 <memset+0x70>
+  800cee:	88 07                	mov    %al,(%rdi)
+  800cf0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cf4:	40 f6 c7 02          	test   $0x2,%dil
+  800cf8:	74 07                	je     800d01 <memset+0x7d>
+  800cfa:	66 89 07             	mov    %ax,(%rdi)
+  800cfd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d01:	40 f6 c7 04          	test   $0x4,%dil
+  800d05:	74 a9                	je     800cb0 <memset+0x2c>
+  800d07:	89 07                	mov    %eax,(%rdi)
+  800d09:	48 83 c7 04          	add    $0x4,%rdi
+  800d0d:	eb a1                	jmp    800cb0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d0f:	41 f6 c1 04          	test   $0x4,%r9b
+  800d13:	74 06                	je     800d1b <memset+0x97>
+  800d15:	89 07                	mov    %eax,(%rdi)
+  800d17:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d1b:	41 f6 c1 02          	test   $0x2,%r9b
+  800d1f:	74 07                	je     800d28 <memset+0xa4>
+  800d21:	66 89 07             	mov    %ax,(%rdi)
+  800d24:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d28:	41 f6 c1 01          	test   $0x1,%r9b
+  800d2c:	74 9c                	je     800cca <memset+0x46>
+  800d2e:	88 07                	mov    %al,(%rdi)
+  800d30:	eb 98                	jmp    800cca <memset+0x46>
+
+0000000000800d32 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d32:	48 89 f8             	mov    %rdi,%rax
+  800d35:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d38:	48 39 fe             	cmp    %rdi,%rsi
+  800d3b:	73 3b                	jae    800d78 <memmove+0x46>
+  800d3d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d41:	48 39 d7             	cmp    %rdx,%rdi
+  800d44:	73 32                	jae    800d78 <memmove+0x46>
+        s += n;
+        d += n;
+  800d46:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d4a:	48 89 d6             	mov    %rdx,%rsi
+  800d4d:	48 09 fe             	or     %rdi,%rsi
+  800d50:	48 09 ce             	or     %rcx,%rsi
+  800d53:	40 f6 c6 07          	test   $0x7,%sil
+  800d57:	75 12                	jne    800d6b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d59:	48 83 ef 08          	sub    $0x8,%rdi
+  800d5d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d61:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d65:	fd                   	std
+  800d66:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d69:	fc                   	cld
+  800d6a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d6b:	48 83 ef 01          	sub    $0x1,%rdi
+  800d6f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d73:	fd                   	std
+  800d74:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d76:	eb f1                	jmp    800d69 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d78:	48 89 f2             	mov    %rsi,%rdx
+  800d7b:	48 09 c2             	or     %rax,%rdx
+  800d7e:	48 09 ca             	or     %rcx,%rdx
+  800d81:	f6 c2 07             	test   $0x7,%dl
+  800d84:	75 0c                	jne    800d92 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d86:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d8a:	48 89 c7             	mov    %rax,%rdi
+  800d8d:	fc                   	cld
+  800d8e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d91:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d92:	48 89 c7             	mov    %rax,%rdi
+  800d95:	fc                   	cld
+  800d96:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d98:	c3                   	ret
+
+0000000000800d99 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d99:	55                   	push   %rbp
+  800d9a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d9d:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  800da4:	00 00 00 
+  800da7:	ff d0                	call   *%rax
+}
+  800da9:	5d                   	pop    %rbp
+  800daa:	c3                   	ret
+
+0000000000800dab <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dab:	55                   	push   %rbp
+  800dac:	48 89 e5             	mov    %rsp,%rbp
+  800daf:	41 57                	push   %r15
+  800db1:	41 56                	push   %r14
+  800db3:	41 55                	push   %r13
+  800db5:	41 54                	push   %r12
+  800db7:	53                   	push   %rbx
+  800db8:	48 83 ec 08          	sub    $0x8,%rsp
+  800dbc:	49 89 fe             	mov    %rdi,%r14
+  800dbf:	49 89 f7             	mov    %rsi,%r15
+  800dc2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dc5:	48 89 f7             	mov    %rsi,%rdi
+  800dc8:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800dcf:	00 00 00 
+  800dd2:	ff d0                	call   *%rax
+  800dd4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dd7:	48 89 de             	mov    %rbx,%rsi
+  800dda:	4c 89 f7             	mov    %r14,%rdi
+  800ddd:	48 b8 15 0b 80 00 00 	movabs $0x800b15,%rax
+  800de4:	00 00 00 
+  800de7:	ff d0                	call   *%rax
+  800de9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dec:	48 39 c3             	cmp    %rax,%rbx
+  800def:	74 36                	je     800e27 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800df1:	48 89 d8             	mov    %rbx,%rax
+  800df4:	4c 29 e8             	sub    %r13,%rax
+  800df7:	49 39 c4             	cmp    %rax,%r12
+  800dfa:	73 31                	jae    800e2d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dfc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e01:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e05:	4c 89 fe             	mov    %r15,%rsi
+  800e08:	48 b8 99 0d 80 00 00 	movabs $0x800d99,%rax
+  800e0f:	00 00 00 
+  800e12:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e14:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e18:	48 83 c4 08          	add    $0x8,%rsp
+  800e1c:	5b                   	pop    %rbx
+  800e1d:	41 5c                	pop    %r12
+  800e1f:	41 5d                	pop    %r13
+  800e21:	41 5e                	pop    %r14
+  800e23:	41 5f                	pop    %r15
+  800e25:	5d                   	pop    %rbp
+  800e26:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e27:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e2b:	eb eb                	jmp    800e18 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e2d:	48 83 eb 01          	sub    $0x1,%rbx
+  800e31:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e35:	48 89 da             	mov    %rbx,%rdx
+  800e38:	4c 89 fe             	mov    %r15,%rsi
+  800e3b:	48 b8 99 0d 80 00 00 	movabs $0x800d99,%rax
+  800e42:	00 00 00 
+  800e45:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e47:	49 01 de             	add    %rbx,%r14
+  800e4a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e4f:	eb c3                	jmp    800e14 <strlcat+0x69>
+
+0000000000800e51 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e51:	48 85 d2             	test   %rdx,%rdx
+  800e54:	74 2d                	je     800e83 <memcmp+0x32>
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e5b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e5f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e64:	44 38 c1             	cmp    %r8b,%cl
+  800e67:	75 0f                	jne    800e78 <memcmp+0x27>
+    while (n-- > 0) {
+  800e69:	48 83 c0 01          	add    $0x1,%rax
+  800e6d:	48 39 c2             	cmp    %rax,%rdx
+  800e70:	75 e9                	jne    800e5b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e77:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e78:	0f b6 c1             	movzbl %cl,%eax
+  800e7b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e7f:	44 29 c0             	sub    %r8d,%eax
+  800e82:	c3                   	ret
+    return 0;
+  800e83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e88:	c3                   	ret
+
+0000000000800e89 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e89:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e8d:	48 39 c7             	cmp    %rax,%rdi
+  800e90:	73 0f                	jae    800ea1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e92:	40 38 37             	cmp    %sil,(%rdi)
+  800e95:	74 0e                	je     800ea5 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e97:	48 83 c7 01          	add    $0x1,%rdi
+  800e9b:	48 39 f8             	cmp    %rdi,%rax
+  800e9e:	75 f2                	jne    800e92 <memfind+0x9>
+  800ea0:	c3                   	ret
+  800ea1:	48 89 f8             	mov    %rdi,%rax
+  800ea4:	c3                   	ret
+  800ea5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ea9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800eac:	0f b6 37             	movzbl (%rdi),%esi
+  800eaf:	40 80 fe 20          	cmp    $0x20,%sil
+  800eb3:	74 06                	je     800ebb <strtol+0x12>
+  800eb5:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb9:	75 13                	jne    800ece <strtol+0x25>
+  800ebb:	48 83 c7 01          	add    $0x1,%rdi
+  800ebf:	0f b6 37             	movzbl (%rdi),%esi
+  800ec2:	40 80 fe 20          	cmp    $0x20,%sil
+  800ec6:	74 f3                	je     800ebb <strtol+0x12>
+  800ec8:	40 80 fe 09          	cmp    $0x9,%sil
+  800ecc:	74 ed                	je     800ebb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ece:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ed1:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ed4:	3c 01                	cmp    $0x1,%al
+  800ed6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eda:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ee0:	75 0f                	jne    800ef1 <strtol+0x48>
+  800ee2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ee5:	74 14                	je     800efb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ee7:	85 d2                	test   %edx,%edx
+  800ee9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eee:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ef6:	4c 63 ca             	movslq %edx,%r9
+  800ef9:	eb 36                	jmp    800f31 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800efb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eff:	74 0f                	je     800f10 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f01:	85 d2                	test   %edx,%edx
+  800f03:	75 ec                	jne    800ef1 <strtol+0x48>
+        s++;
+  800f05:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f09:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f0e:	eb e1                	jmp    800ef1 <strtol+0x48>
+        s += 2;
+  800f10:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f14:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f19:	eb d6                	jmp    800ef1 <strtol+0x48>
+            dig -= '0';
+  800f1b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f1e:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f22:	41 39 d0             	cmp    %edx,%r8d
+  800f25:	7d 21                	jge    800f48 <strtol+0x9f>
+        val = val * base + dig;
+  800f27:	49 0f af c1          	imul   %r9,%rax
+  800f2b:	0f b6 c9             	movzbl %cl,%ecx
+  800f2e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f31:	48 83 c7 01          	add    $0x1,%rdi
+  800f35:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f39:	80 f9 39             	cmp    $0x39,%cl
+  800f3c:	76 dd                	jbe    800f1b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f3e:	80 f9 7b             	cmp    $0x7b,%cl
+  800f41:	77 05                	ja     800f48 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f43:	83 e9 57             	sub    $0x57,%ecx
+  800f46:	eb d6                	jmp    800f1e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f48:	4d 85 d2             	test   %r10,%r10
+  800f4b:	74 03                	je     800f50 <strtol+0xa7>
+  800f4d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f50:	48 89 c2             	mov    %rax,%rdx
+  800f53:	48 f7 da             	neg    %rdx
+  800f56:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f5a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strrev>:
+
+void
+strrev(char *str)
+{
+  800f5f:	55                   	push   %rbp
+  800f60:	48 89 e5             	mov    %rsp,%rbp
+  800f63:	53                   	push   %rbx
+  800f64:	48 83 ec 08          	sub    $0x8,%rsp
+  800f68:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f6b:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800f72:	00 00 00 
+  800f75:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f77:	83 e8 01             	sub    $0x1,%eax
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7e 22                	jle    800fa0 <strrev+0x41>
+  800f7e:	48 98                	cltq
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f85:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f89:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f8d:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f91:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f94:	48 83 c2 01          	add    $0x1,%rdx
+  800f98:	48 83 e8 01          	sub    $0x1,%rax
+  800f9c:	39 c2                	cmp    %eax,%edx
+  800f9e:	7c e5                	jl     800f85 <strrev+0x26>
+	}
+}
+  800fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa4:	c9                   	leave
+  800fa5:	c3                   	ret
+
+0000000000800fa6 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800fa6:	85 d2                	test   %edx,%edx
+  800fa8:	0f 84 80 00 00 00    	je     80102e <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800fae:	55                   	push   %rbp
+  800faf:	48 89 e5             	mov    %rsp,%rbp
+  800fb2:	53                   	push   %rbx
+  800fb3:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb7:	49 89 f2             	mov    %rsi,%r10
+  800fba:	41 89 d3             	mov    %edx,%r11d
+  800fbd:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800fc0:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800fc5:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800fc8:	eb 20                	jmp    800fea <itoa+0x44>
+			str[i++] = '0' + digit;
+  800fca:	41 89 f1             	mov    %esi,%r9d
+  800fcd:	83 c2 30             	add    $0x30,%edx
+  800fd0:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800fd3:	89 f8                	mov    %edi,%eax
+  800fd5:	99                   	cltd
+  800fd6:	f7 f9                	idiv   %ecx
+  800fd8:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800fda:	85 c0                	test   %eax,%eax
+  800fdc:	74 2e                	je     80100c <itoa+0x66>
+  800fde:	83 c6 01             	add    $0x1,%esi
+  800fe1:	49 83 c0 01          	add    $0x1,%r8
+  800fe5:	44 39 cb             	cmp    %r9d,%ebx
+  800fe8:	7e 15                	jle    800fff <itoa+0x59>
+		digit = sum % base;
+  800fea:	89 f8                	mov    %edi,%eax
+  800fec:	99                   	cltd
+  800fed:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fef:	83 fa 09             	cmp    $0x9,%edx
+  800ff2:	7e d6                	jle    800fca <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800ff4:	41 89 f1             	mov    %esi,%r9d
+  800ff7:	83 c2 37             	add    $0x37,%edx
+  800ffa:	41 88 10             	mov    %dl,(%r8)
+  800ffd:	eb d4                	jmp    800fd3 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fff:	41 83 eb 01          	sub    $0x1,%r11d
+  801003:	45 39 cb             	cmp    %r9d,%r11d
+  801006:	75 04                	jne    80100c <itoa+0x66>
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	75 28                	jne    801034 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80100c:	4d 63 c9             	movslq %r9d,%r9
+  80100f:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801014:	4c 89 d7             	mov    %r10,%rdi
+  801017:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  80101e:	00 00 00 
+  801021:	ff d0                	call   *%rax
+	return 0;
+  801023:	b8 00 00 00 00       	mov    $0x0,%eax
+  801028:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80102c:	c9                   	leave
+  80102d:	c3                   	ret
+		return -1;
+  80102e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801033:	c3                   	ret
+		return -1;
+  801034:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801039:	eb ed                	jmp    801028 <itoa+0x82>
+
+000000000080103b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80103b:	55                   	push   %rbp
+  80103c:	48 89 e5             	mov    %rsp,%rbp
+  80103f:	53                   	push   %rbx
+  801040:	48 89 fa             	mov    %rdi,%rdx
+  801043:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801046:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80104b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801050:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801055:	be 00 00 00 00       	mov    $0x0,%esi
+  80105a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801060:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801062:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801066:	c9                   	leave
+  801067:	c3                   	ret
+
+0000000000801068 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801068:	55                   	push   %rbp
+  801069:	48 89 e5             	mov    %rsp,%rbp
+  80106c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80106d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801072:	ba 00 00 00 00       	mov    $0x0,%edx
+  801077:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801091:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801093:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+
+0000000000801099 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801099:	55                   	push   %rbp
+  80109a:	48 89 e5             	mov    %rsp,%rbp
+  80109d:	53                   	push   %rbx
+  80109e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c6:	48 85 c0             	test   %rax,%rax
+  8010c9:	7f 06                	jg     8010d1 <sys_env_destroy+0x38>
+}
+  8010cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cf:	c9                   	leave
+  8010d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010d1:	49 89 c0             	mov    %rax,%r8
+  8010d4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010d9:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  8010e0:	00 00 00 
+  8010e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e8:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  8010ef:	00 00 00 
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f7:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  8010fe:	00 00 00 
+  801101:	41 ff d1             	call   *%r9
+
+0000000000801104 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801104:	55                   	push   %rbp
+  801105:	48 89 e5             	mov    %rsp,%rbp
+  801108:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801109:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801113:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801118:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801122:	be 00 00 00 00       	mov    $0x0,%esi
+  801127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80112f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <sys_yield>:
+
+void
+sys_yield(void) {
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80113a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80113f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801144:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801153:	be 00 00 00 00       	mov    $0x0,%esi
+  801158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801160:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801164:	c9                   	leave
+  801165:	c3                   	ret
+
+0000000000801166 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801166:	55                   	push   %rbp
+  801167:	48 89 e5             	mov    %rsp,%rbp
+  80116a:	53                   	push   %rbx
+  80116b:	48 89 fa             	mov    %rdi,%rdx
+  80116e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801171:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801176:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80117d:	00 00 00 
+  801180:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801185:	be 00 00 00 00       	mov    $0x0,%esi
+  80118a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801190:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801192:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801196:	c9                   	leave
+  801197:	c3                   	ret
+
+0000000000801198 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+  80119c:	53                   	push   %rbx
+  80119d:	49 89 f8             	mov    %rdi,%r8
+  8011a0:	48 89 d3             	mov    %rdx,%rbx
+  8011a3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011a6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ab:	4c 89 c2             	mov    %r8,%rdx
+  8011ae:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011bc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c2:	c9                   	leave
+  8011c3:	c3                   	ret
+
+00000000008011c4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011c4:	55                   	push   %rbp
+  8011c5:	48 89 e5             	mov    %rsp,%rbp
+  8011c8:	53                   	push   %rbx
+  8011c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011cd:	89 f8                	mov    %edi,%eax
+  8011cf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011d2:	48 63 f9             	movslq %ecx,%rdi
+  8011d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011ed:	48 85 c0             	test   %rax,%rax
+  8011f0:	7f 06                	jg     8011f8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f6:	c9                   	leave
+  8011f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f8:	49 89 c0             	mov    %rax,%r8
+  8011fb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801200:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  801207:	00 00 00 
+  80120a:	be 26 00 00 00       	mov    $0x26,%esi
+  80120f:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  801216:	00 00 00 
+  801219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121e:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  801225:	00 00 00 
+  801228:	41 ff d1             	call   *%r9
+
+000000000080122b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80122b:	55                   	push   %rbp
+  80122c:	48 89 e5             	mov    %rsp,%rbp
+  80122f:	53                   	push   %rbx
+  801230:	48 83 ec 08          	sub    $0x8,%rsp
+  801234:	89 f8                	mov    %edi,%eax
+  801236:	49 89 f2             	mov    %rsi,%r10
+  801239:	48 89 cf             	mov    %rcx,%rdi
+  80123c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80123f:	48 63 da             	movslq %edx,%rbx
+  801242:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801245:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801250:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801252:	48 85 c0             	test   %rax,%rax
+  801255:	7f 06                	jg     80125d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801257:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125b:	c9                   	leave
+  80125c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125d:	49 89 c0             	mov    %rax,%r8
+  801260:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801265:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  80126c:	00 00 00 
+  80126f:	be 26 00 00 00       	mov    $0x26,%esi
+  801274:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  80127b:	00 00 00 
+  80127e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801283:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  80128a:	00 00 00 
+  80128d:	41 ff d1             	call   *%r9
+
+0000000000801290 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	53                   	push   %rbx
+  801295:	48 83 ec 08          	sub    $0x8,%rsp
+  801299:	48 89 f1             	mov    %rsi,%rcx
+  80129c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80129f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012b9:	48 85 c0             	test   %rax,%rax
+  8012bc:	7f 06                	jg     8012c4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c2:	c9                   	leave
+  8012c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c4:	49 89 c0             	mov    %rax,%r8
+  8012c7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012cc:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  8012d3:	00 00 00 
+  8012d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8012db:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  8012e2:	00 00 00 
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  8012f1:	00 00 00 
+  8012f4:	41 ff d1             	call   *%r9
+
+00000000008012f7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012f7:	55                   	push   %rbp
+  8012f8:	48 89 e5             	mov    %rsp,%rbp
+  8012fb:	53                   	push   %rbx
+  8012fc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801300:	48 63 ce             	movslq %esi,%rcx
+  801303:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801306:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80130b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801310:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801315:	be 00 00 00 00       	mov    $0x0,%esi
+  80131a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801320:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801322:	48 85 c0             	test   %rax,%rax
+  801325:	7f 06                	jg     80132d <sys_env_set_status+0x36>
+}
+  801327:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132b:	c9                   	leave
+  80132c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132d:	49 89 c0             	mov    %rax,%r8
+  801330:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801335:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  80133c:	00 00 00 
+  80133f:	be 26 00 00 00       	mov    $0x26,%esi
+  801344:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  80134b:	00 00 00 
+  80134e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801353:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  80135a:	00 00 00 
+  80135d:	41 ff d1             	call   *%r9
+
+0000000000801360 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801360:	55                   	push   %rbp
+  801361:	48 89 e5             	mov    %rsp,%rbp
+  801364:	53                   	push   %rbx
+  801365:	48 83 ec 08          	sub    $0x8,%rsp
+  801369:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80136c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80136f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801374:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801379:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137e:	be 00 00 00 00       	mov    $0x0,%esi
+  801383:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801389:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138b:	48 85 c0             	test   %rax,%rax
+  80138e:	7f 06                	jg     801396 <sys_env_set_trapframe+0x36>
+}
+  801390:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801394:	c9                   	leave
+  801395:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801396:	49 89 c0             	mov    %rax,%r8
+  801399:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80139e:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  8013a5:	00 00 00 
+  8013a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ad:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  8013b4:	00 00 00 
+  8013b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bc:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  8013c3:	00 00 00 
+  8013c6:	41 ff d1             	call   *%r9
+
+00000000008013c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013c9:	55                   	push   %rbp
+  8013ca:	48 89 e5             	mov    %rsp,%rbp
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 06                	jg     8013ff <sys_env_set_pgfault_upcall+0x36>
+}
+  8013f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ff:	49 89 c0             	mov    %rax,%r8
+  801402:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801407:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  80140e:	00 00 00 
+  801411:	be 26 00 00 00       	mov    $0x26,%esi
+  801416:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  80141d:	00 00 00 
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  80142c:	00 00 00 
+  80142f:	41 ff d1             	call   *%r9
+
+0000000000801432 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	53                   	push   %rbx
+  801437:	89 f8                	mov    %edi,%eax
+  801439:	49 89 f1             	mov    %rsi,%r9
+  80143c:	48 89 d3             	mov    %rdx,%rbx
+  80143f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801442:	49 63 f0             	movslq %r8d,%rsi
+  801445:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801448:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801450:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801456:	cd 30                	int    $0x30
+}
+  801458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+
+000000000080145e <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	53                   	push   %rbx
+  801463:	48 83 ec 08          	sub    $0x8,%rsp
+  801467:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80146a:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80146d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801472:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801475:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147a:	be 00 00 00 00       	mov    $0x0,%esi
+  80147f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801485:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801487:	48 85 c0             	test   %rax,%rax
+  80148a:	7f 06                	jg     801492 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80148c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80149a:	48 ba 08 3f 80 00 00 	movabs $0x803f08,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a9:	48 bf 27 3f 80 00 00 	movabs $0x803f27,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 f2 36 80 00 00 	movabs $0x8036f2,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8014c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ce:	48 b8 5e 14 80 00 00 	movabs $0x80145e,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	5d                   	pop    %rbp
+  8014db:	c3                   	ret
+
+00000000008014dc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801505:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801507:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150b:	c9                   	leave
+  80150c:	c3                   	ret
+
+000000000080150d <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801512:	48 63 ce             	movslq %esi,%rcx
+  801515:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801519:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801533:	cd 30                	int    $0x30
+}
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+
+000000000080153b <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80153b:	55                   	push   %rbp
+  80153c:	48 89 e5             	mov    %rsp,%rbp
+  80153f:	53                   	push   %rbx
+  801540:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801543:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801547:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801551:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801556:	be 00 00 00 00       	mov    $0x0,%esi
+  80155b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801561:	cd 30                	int    $0x30
+}
+  801563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+
+0000000000801569 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	53                   	push   %rbx
+  80156e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801571:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801579:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801581:	be 00 00 00 00       	mov    $0x0,%esi
+  801586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158c:	cd 30                	int    $0x30
+}
+  80158e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801592:	c9                   	leave
+  801593:	c3                   	ret
+
+0000000000801594 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	41 56                	push   %r14
+  80159a:	41 55                	push   %r13
+  80159c:	41 54                	push   %r12
+  80159e:	53                   	push   %rbx
+  80159f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015a2:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  8015a9:	00 00 00 
+  8015ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8015b0:	74 27                	je     8015d9 <_handle_vectored_pagefault+0x45>
+  8015b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8015b7:	49 bd 20 60 80 00 00 	movabs $0x806020,%r13
+  8015be:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015c1:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8015c4:	4c 89 e7             	mov    %r12,%rdi
+  8015c7:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8015cc:	84 c0                	test   %al,%al
+  8015ce:	75 45                	jne    801615 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015d0:	48 83 c3 01          	add    $0x1,%rbx
+  8015d4:	49 3b 1e             	cmp    (%r14),%rbx
+  8015d7:	72 eb                	jb     8015c4 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8015d9:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8015e0:	00 
+  8015e1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8015e6:	4d 8b 04 24          	mov    (%r12),%r8
+  8015ea:	48 ba 38 3f 80 00 00 	movabs $0x803f38,%rdx
+  8015f1:	00 00 00 
+  8015f4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8015f9:	48 bf 68 3f 80 00 00 	movabs $0x803f68,%rdi
+  801600:	00 00 00 
+  801603:	b8 00 00 00 00       	mov    $0x0,%eax
+  801608:	49 ba f2 36 80 00 00 	movabs $0x8036f2,%r10
+  80160f:	00 00 00 
+  801612:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801615:	5b                   	pop    %rbx
+  801616:	41 5c                	pop    %r12
+  801618:	41 5d                	pop    %r13
+  80161a:	41 5e                	pop    %r14
+  80161c:	5d                   	pop    %rbp
+  80161d:	c3                   	ret
+
+000000000080161e <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	53                   	push   %rbx
+  801623:	48 83 ec 08          	sub    $0x8,%rsp
+  801627:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80162a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801631:	00 00 00 
+  801634:	80 38 00             	cmpb   $0x0,(%rax)
+  801637:	0f 84 84 00 00 00    	je     8016c1 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80163d:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  801644:	00 00 00 
+  801647:	48 8b 10             	mov    (%rax),%rdx
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80164f:	48 b9 20 60 80 00 00 	movabs $0x806020,%rcx
+  801656:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801659:	48 85 d2             	test   %rdx,%rdx
+  80165c:	74 19                	je     801677 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80165e:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801662:	0f 84 e8 00 00 00    	je     801750 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801668:	48 83 c0 01          	add    $0x1,%rax
+  80166c:	48 39 d0             	cmp    %rdx,%rax
+  80166f:	75 ed                	jne    80165e <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801671:	48 83 fa 08          	cmp    $0x8,%rdx
+  801675:	74 1c                	je     801693 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801677:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80167b:	48 a3 68 60 80 00 00 	movabs %rax,0x806068
+  801682:	00 00 00 
+  801685:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80168c:	00 00 00 
+  80168f:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801693:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  80169a:	00 00 00 
+  80169d:	ff d0                	call   *%rax
+  80169f:	89 c7                	mov    %eax,%edi
+  8016a1:	48 be 16 18 80 00 00 	movabs $0x801816,%rsi
+  8016a8:	00 00 00 
+  8016ab:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  8016b2:	00 00 00 
+  8016b5:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	78 68                	js     801723 <add_pgfault_handler+0x105>
+    return res;
+}
+  8016bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8016c1:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+  8016cd:	89 c7                	mov    %eax,%edi
+  8016cf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016d9:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8016e0:	00 00 00 
+  8016e3:	48 b8 c4 11 80 00 00 	movabs $0x8011c4,%rax
+  8016ea:	00 00 00 
+  8016ed:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8016ef:	48 ba 68 60 80 00 00 	movabs $0x806068,%rdx
+  8016f6:	00 00 00 
+  8016f9:	48 8b 02             	mov    (%rdx),%rax
+  8016fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801700:	48 89 0a             	mov    %rcx,(%rdx)
+  801703:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80170a:	00 00 00 
+  80170d:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801711:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801718:	00 00 00 
+  80171b:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80171e:	e9 70 ff ff ff       	jmp    801693 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801723:	89 c1                	mov    %eax,%ecx
+  801725:	48 ba 76 3f 80 00 00 	movabs $0x803f76,%rdx
+  80172c:	00 00 00 
+  80172f:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801734:	48 bf 68 3f 80 00 00 	movabs $0x803f68,%rdi
+  80173b:	00 00 00 
+  80173e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801743:	49 b8 f2 36 80 00 00 	movabs $0x8036f2,%r8
+  80174a:	00 00 00 
+  80174d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801750:	b8 00 00 00 00       	mov    $0x0,%eax
+  801755:	e9 61 ff ff ff       	jmp    8016bb <add_pgfault_handler+0x9d>
+
+000000000080175a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80175a:	55                   	push   %rbp
+  80175b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80175e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801765:	00 00 00 
+  801768:	80 38 00             	cmpb   $0x0,(%rax)
+  80176b:	74 33                	je     8017a0 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80176d:	48 a1 68 60 80 00 00 	movabs 0x806068,%rax
+  801774:	00 00 00 
+  801777:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80177c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801783:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801786:	48 85 c0             	test   %rax,%rax
+  801789:	0f 84 85 00 00 00    	je     801814 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80178f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801793:	74 40                	je     8017d5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801795:	48 83 c1 01          	add    $0x1,%rcx
+  801799:	48 39 c1             	cmp    %rax,%rcx
+  80179c:	75 f1                	jne    80178f <remove_pgfault_handler+0x35>
+  80179e:	eb 74                	jmp    801814 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8017a0:	48 b9 8e 3f 80 00 00 	movabs $0x803f8e,%rcx
+  8017a7:	00 00 00 
+  8017aa:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  8017b1:	00 00 00 
+  8017b4:	be 43 00 00 00       	mov    $0x43,%esi
+  8017b9:	48 bf 68 3f 80 00 00 	movabs $0x803f68,%rdi
+  8017c0:	00 00 00 
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	49 b8 f2 36 80 00 00 	movabs $0x8036f2,%r8
+  8017cf:	00 00 00 
+  8017d2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8017d5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8017dc:	00 
+  8017dd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017e1:	48 29 ca             	sub    %rcx,%rdx
+  8017e4:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8017eb:	00 00 00 
+  8017ee:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8017f2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8017f7:	48 89 ce             	mov    %rcx,%rsi
+  8017fa:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  801801:	00 00 00 
+  801804:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801806:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  80180d:	00 00 00 
+  801810:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801814:	5d                   	pop    %rbp
+  801815:	c3                   	ret
+
+0000000000801816 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801816:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801819:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  801820:	00 00 00 
+    call *%rax
+  801823:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    popq %r15
+  801825:	41 5f                	pop    %r15
+    popq %r15
+  801827:	41 5f                	pop    %r15
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+    popq %r15
+  801829:	41 5f                	pop    %r15
+    popq %r14
+  80182b:	41 5e                	pop    %r14
+    popq %r13
+  80182d:	41 5d                	pop    %r13
+    popq %r12
+  80182f:	41 5c                	pop    %r12
+    popq %r11
+  801831:	41 5b                	pop    %r11
+    popq %r10
+  801833:	41 5a                	pop    %r10
+    popq %r9
+  801835:	41 59                	pop    %r9
+    popq %r8
+  801837:	41 58                	pop    %r8
+    popq %rsi
+  801839:	5e                   	pop    %rsi
+    popq %rdi
+  80183a:	5f                   	pop    %rdi
+    popq %rbp
+  80183b:	5d                   	pop    %rbp
+    popq %rdx
+  80183c:	5a                   	pop    %rdx
+    popq %rcx
+  80183d:	59                   	pop    %rcx
+    movq 32(%rsp), %rbx
+  80183e:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801843:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801848:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  80184c:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80184f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+    popq %rbx
+  801854:	5b                   	pop    %rbx
+    popq %rax
+  801855:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    pushq 8(%rsp)
+  801856:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  80185a:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    movq 16(%rsp), %rsp
+  80185b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+  801860:	c3                   	ret
+
+0000000000801861 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801861:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801868:	ff ff ff 
+  80186b:	48 01 f8             	add    %rdi,%rax
+  80186e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801872:	c3                   	ret
+
+0000000000801873 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801873:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80187a:	ff ff ff 
+  80187d:	48 01 f8             	add    %rdi,%rax
+  801880:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801884:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80188a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80188e:	c3                   	ret
+
+000000000080188f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	41 57                	push   %r15
+  801895:	41 56                	push   %r14
+  801897:	41 55                	push   %r13
+  801899:	41 54                	push   %r12
+  80189b:	53                   	push   %rbx
+  80189c:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a0:	49 89 ff             	mov    %rdi,%r15
+  8018a3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018a8:	49 bd ae 33 80 00 00 	movabs $0x8033ae,%r13
+  8018af:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018b2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018b8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018bb:	48 89 df             	mov    %rbx,%rdi
+  8018be:	41 ff d5             	call   *%r13
+  8018c1:	83 e0 04             	and    $0x4,%eax
+  8018c4:	74 17                	je     8018dd <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018c6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018cd:	4c 39 f3             	cmp    %r14,%rbx
+  8018d0:	75 e6                	jne    8018b8 <fd_alloc+0x29>
+  8018d2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018d8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018dd:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018e0:	48 83 c4 08          	add    $0x8,%rsp
+  8018e4:	5b                   	pop    %rbx
+  8018e5:	41 5c                	pop    %r12
+  8018e7:	41 5d                	pop    %r13
+  8018e9:	41 5e                	pop    %r14
+  8018eb:	41 5f                	pop    %r15
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+
+00000000008018ef <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018ef:	83 ff 1f             	cmp    $0x1f,%edi
+  8018f2:	77 39                	ja     80192d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018f4:	55                   	push   %rbp
+  8018f5:	48 89 e5             	mov    %rsp,%rbp
+  8018f8:	41 54                	push   %r12
+  8018fa:	53                   	push   %rbx
+  8018fb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018fe:	48 63 df             	movslq %edi,%rbx
+  801901:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801908:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80190c:	48 89 df             	mov    %rbx,%rdi
+  80190f:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+  80191b:	a8 04                	test   $0x4,%al
+  80191d:	74 14                	je     801933 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80191f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801928:	5b                   	pop    %rbx
+  801929:	41 5c                	pop    %r12
+  80192b:	5d                   	pop    %rbp
+  80192c:	c3                   	ret
+        return -E_INVAL;
+  80192d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801932:	c3                   	ret
+        return -E_INVAL;
+  801933:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801938:	eb ee                	jmp    801928 <fd_lookup+0x39>
+
+000000000080193a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	41 54                	push   %r12
+  801940:	53                   	push   %rbx
+  801941:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801944:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80194b:	00 00 00 
+  80194e:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801955:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801958:	39 3b                	cmp    %edi,(%rbx)
+  80195a:	74 47                	je     8019a3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80195c:	48 83 c0 08          	add    $0x8,%rax
+  801960:	48 8b 18             	mov    (%rax),%rbx
+  801963:	48 85 db             	test   %rbx,%rbx
+  801966:	75 f0                	jne    801958 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801968:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80196f:	00 00 00 
+  801972:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801978:	89 fa                	mov    %edi,%edx
+  80197a:	48 bf c0 3f 80 00 00 	movabs $0x803fc0,%rdi
+  801981:	00 00 00 
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  801990:	00 00 00 
+  801993:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801995:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80199a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80199e:	5b                   	pop    %rbx
+  80199f:	41 5c                	pop    %r12
+  8019a1:	5d                   	pop    %rbp
+  8019a2:	c3                   	ret
+            return 0;
+  8019a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a8:	eb f0                	jmp    80199a <dev_lookup+0x60>
+
+00000000008019aa <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019aa:	55                   	push   %rbp
+  8019ab:	48 89 e5             	mov    %rsp,%rbp
+  8019ae:	41 55                	push   %r13
+  8019b0:	41 54                	push   %r12
+  8019b2:	53                   	push   %rbx
+  8019b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8019b7:	48 89 fb             	mov    %rdi,%rbx
+  8019ba:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019bd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019c4:	ff ff ff 
+  8019c7:	48 01 df             	add    %rbx,%rdi
+  8019ca:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019ce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d2:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8019d9:	00 00 00 
+  8019dc:	ff d0                	call   *%rax
+  8019de:	41 89 c5             	mov    %eax,%r13d
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	78 06                	js     8019eb <fd_close+0x41>
+  8019e5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019e9:	74 1a                	je     801a05 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019eb:	45 84 e4             	test   %r12b,%r12b
+  8019ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019f7:	44 89 e8             	mov    %r13d,%eax
+  8019fa:	48 83 c4 18          	add    $0x18,%rsp
+  8019fe:	5b                   	pop    %rbx
+  8019ff:	41 5c                	pop    %r12
+  801a01:	41 5d                	pop    %r13
+  801a03:	5d                   	pop    %rbp
+  801a04:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a05:	8b 3b                	mov    (%rbx),%edi
+  801a07:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a0b:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801a12:	00 00 00 
+  801a15:	ff d0                	call   *%rax
+  801a17:	41 89 c5             	mov    %eax,%r13d
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	78 1b                	js     801a39 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a22:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801a26:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a2c:	48 85 c0             	test   %rax,%rax
+  801a2f:	74 08                	je     801a39 <fd_close+0x8f>
+  801a31:	48 89 df             	mov    %rbx,%rdi
+  801a34:	ff d0                	call   *%rax
+  801a36:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a3e:	48 89 de             	mov    %rbx,%rsi
+  801a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a46:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  801a4d:	00 00 00 
+  801a50:	ff d0                	call   *%rax
+    return res;
+  801a52:	eb a3                	jmp    8019f7 <fd_close+0x4d>
+
+0000000000801a54 <close>:
+
+int
+close(int fdnum) {
+  801a54:	55                   	push   %rbp
+  801a55:	48 89 e5             	mov    %rsp,%rbp
+  801a58:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a5c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a60:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 15                	js     801a85 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a70:	be 01 00 00 00       	mov    $0x1,%esi
+  801a75:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a79:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  801a80:	00 00 00 
+  801a83:	ff d0                	call   *%rax
+}
+  801a85:	c9                   	leave
+  801a86:	c3                   	ret
+
+0000000000801a87 <close_all>:
+
+void
+close_all(void) {
+  801a87:	55                   	push   %rbp
+  801a88:	48 89 e5             	mov    %rsp,%rbp
+  801a8b:	41 54                	push   %r12
+  801a8d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a93:	49 bc 54 1a 80 00 00 	movabs $0x801a54,%r12
+  801a9a:	00 00 00 
+  801a9d:	89 df                	mov    %ebx,%edi
+  801a9f:	41 ff d4             	call   *%r12
+  801aa2:	83 c3 01             	add    $0x1,%ebx
+  801aa5:	83 fb 20             	cmp    $0x20,%ebx
+  801aa8:	75 f3                	jne    801a9d <close_all+0x16>
+}
+  801aaa:	5b                   	pop    %rbx
+  801aab:	41 5c                	pop    %r12
+  801aad:	5d                   	pop    %rbp
+  801aae:	c3                   	ret
+
+0000000000801aaf <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801aaf:	55                   	push   %rbp
+  801ab0:	48 89 e5             	mov    %rsp,%rbp
+  801ab3:	41 57                	push   %r15
+  801ab5:	41 56                	push   %r14
+  801ab7:	41 55                	push   %r13
+  801ab9:	41 54                	push   %r12
+  801abb:	53                   	push   %rbx
+  801abc:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ac3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ac7:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801ace:	00 00 00 
+  801ad1:	ff d0                	call   *%rax
+  801ad3:	89 c3                	mov    %eax,%ebx
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	0f 88 b8 00 00 00    	js     801b95 <dup+0xe6>
+    close(newfdnum);
+  801add:	44 89 e7             	mov    %r12d,%edi
+  801ae0:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  801ae7:	00 00 00 
+  801aea:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aec:	4d 63 ec             	movslq %r12d,%r13
+  801aef:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801af6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801afa:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801afe:	4c 89 ff             	mov    %r15,%rdi
+  801b01:	49 be 73 18 80 00 00 	movabs $0x801873,%r14
+  801b08:	00 00 00 
+  801b0b:	41 ff d6             	call   *%r14
+  801b0e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b11:	4c 89 ef             	mov    %r13,%rdi
+  801b14:	41 ff d6             	call   *%r14
+  801b17:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b1a:	48 89 df             	mov    %rbx,%rdi
+  801b1d:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b29:	a8 04                	test   $0x4,%al
+  801b2b:	74 2b                	je     801b58 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b2d:	41 89 c1             	mov    %eax,%r9d
+  801b30:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b36:	4c 89 f1             	mov    %r14,%rcx
+  801b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3e:	48 89 de             	mov    %rbx,%rsi
+  801b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b46:	48 b8 2b 12 80 00 00 	movabs $0x80122b,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+  801b52:	89 c3                	mov    %eax,%ebx
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 4e                	js     801ba6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b58:	4c 89 ff             	mov    %r15,%rdi
+  801b5b:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  801b62:	00 00 00 
+  801b65:	ff d0                	call   *%rax
+  801b67:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b6a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b70:	4c 89 e9             	mov    %r13,%rcx
+  801b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b78:	4c 89 fe             	mov    %r15,%rsi
+  801b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b80:	48 b8 2b 12 80 00 00 	movabs $0x80122b,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+  801b8c:	89 c3                	mov    %eax,%ebx
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 14                	js     801ba6 <dup+0xf7>
+
+    return newfdnum;
+  801b92:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b95:	89 d8                	mov    %ebx,%eax
+  801b97:	48 83 c4 18          	add    $0x18,%rsp
+  801b9b:	5b                   	pop    %rbx
+  801b9c:	41 5c                	pop    %r12
+  801b9e:	41 5d                	pop    %r13
+  801ba0:	41 5e                	pop    %r14
+  801ba2:	41 5f                	pop    %r15
+  801ba4:	5d                   	pop    %rbp
+  801ba5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ba6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bab:	4c 89 ee             	mov    %r13,%rsi
+  801bae:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb3:	49 bc 90 12 80 00 00 	movabs $0x801290,%r12
+  801bba:	00 00 00 
+  801bbd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bc5:	4c 89 f6             	mov    %r14,%rsi
+  801bc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcd:	41 ff d4             	call   *%r12
+    return res;
+  801bd0:	eb c3                	jmp    801b95 <dup+0xe6>
+
+0000000000801bd2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bd2:	55                   	push   %rbp
+  801bd3:	48 89 e5             	mov    %rsp,%rbp
+  801bd6:	41 56                	push   %r14
+  801bd8:	41 55                	push   %r13
+  801bda:	41 54                	push   %r12
+  801bdc:	53                   	push   %rbx
+  801bdd:	48 83 ec 10          	sub    $0x10,%rsp
+  801be1:	89 fb                	mov    %edi,%ebx
+  801be3:	49 89 f4             	mov    %rsi,%r12
+  801be6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bed:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801bf4:	00 00 00 
+  801bf7:	ff d0                	call   *%rax
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 4c                	js     801c49 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bfd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c01:	41 8b 3e             	mov    (%r14),%edi
+  801c04:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c08:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801c0f:	00 00 00 
+  801c12:	ff d0                	call   *%rax
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 35                	js     801c4d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c18:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c1c:	83 e0 03             	and    $0x3,%eax
+  801c1f:	83 f8 01             	cmp    $0x1,%eax
+  801c22:	74 2d                	je     801c51 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c28:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c2c:	48 85 c0             	test   %rax,%rax
+  801c2f:	74 56                	je     801c87 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c31:	4c 89 ea             	mov    %r13,%rdx
+  801c34:	4c 89 e6             	mov    %r12,%rsi
+  801c37:	4c 89 f7             	mov    %r14,%rdi
+  801c3a:	ff d0                	call   *%rax
+}
+  801c3c:	48 83 c4 10          	add    $0x10,%rsp
+  801c40:	5b                   	pop    %rbx
+  801c41:	41 5c                	pop    %r12
+  801c43:	41 5d                	pop    %r13
+  801c45:	41 5e                	pop    %r14
+  801c47:	5d                   	pop    %rbp
+  801c48:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c49:	48 98                	cltq
+  801c4b:	eb ef                	jmp    801c3c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4d:	48 98                	cltq
+  801c4f:	eb eb                	jmp    801c3c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c51:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c58:	00 00 00 
+  801c5b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c61:	89 da                	mov    %ebx,%edx
+  801c63:	48 bf 21 40 80 00 00 	movabs $0x804021,%rdi
+  801c6a:	00 00 00 
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c72:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  801c79:	00 00 00 
+  801c7c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c7e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c85:	eb b5                	jmp    801c3c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c87:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c8e:	eb ac                	jmp    801c3c <read+0x6a>
+
+0000000000801c90 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c90:	55                   	push   %rbp
+  801c91:	48 89 e5             	mov    %rsp,%rbp
+  801c94:	41 56                	push   %r14
+  801c96:	41 55                	push   %r13
+  801c98:	41 54                	push   %r12
+  801c9a:	53                   	push   %rbx
+  801c9b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c9f:	89 fb                	mov    %edi,%ebx
+  801ca1:	49 89 f4             	mov    %rsi,%r12
+  801ca4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cab:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801cb2:	00 00 00 
+  801cb5:	ff d0                	call   *%rax
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 41                	js     801cfc <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cbb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cbf:	41 8b 3e             	mov    (%r14),%edi
+  801cc2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cc6:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	78 35                	js     801d0b <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cd6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cda:	83 e0 03             	and    $0x3,%eax
+  801cdd:	83 f8 01             	cmp    $0x1,%eax
+  801ce0:	74 2d                	je     801d0f <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ce2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ce6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cea:	48 85 c0             	test   %rax,%rax
+  801ced:	74 56                	je     801d45 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801cef:	4c 89 ea             	mov    %r13,%rdx
+  801cf2:	4c 89 e6             	mov    %r12,%rsi
+  801cf5:	4c 89 f7             	mov    %r14,%rdi
+  801cf8:	ff d0                	call   *%rax
+  801cfa:	eb 02                	jmp    801cfe <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfc:	48 98                	cltq
+}
+  801cfe:	48 83 c4 10          	add    $0x10,%rsp
+  801d02:	5b                   	pop    %rbx
+  801d03:	41 5c                	pop    %r12
+  801d05:	41 5d                	pop    %r13
+  801d07:	41 5e                	pop    %r14
+  801d09:	5d                   	pop    %rbp
+  801d0a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d0b:	48 98                	cltq
+  801d0d:	eb ef                	jmp    801cfe <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d16:	00 00 00 
+  801d19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d1f:	89 da                	mov    %ebx,%edx
+  801d21:	48 bf e0 3f 80 00 00 	movabs $0x803fe0,%rdi
+  801d28:	00 00 00 
+  801d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d30:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  801d37:	00 00 00 
+  801d3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d3c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d43:	eb b9                	jmp    801cfe <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801d45:	4c 89 ea             	mov    %r13,%rdx
+  801d48:	4c 89 e6             	mov    %r12,%rsi
+  801d4b:	89 df                	mov    %ebx,%edi
+  801d4d:	48 b8 d2 1b 80 00 00 	movabs $0x801bd2,%rax
+  801d54:	00 00 00 
+  801d57:	ff d0                	call   *%rax
+  801d59:	eb a3                	jmp    801cfe <readmap+0x6e>
+
+0000000000801d5b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d5b:	55                   	push   %rbp
+  801d5c:	48 89 e5             	mov    %rsp,%rbp
+  801d5f:	41 57                	push   %r15
+  801d61:	41 56                	push   %r14
+  801d63:	41 55                	push   %r13
+  801d65:	41 54                	push   %r12
+  801d67:	53                   	push   %rbx
+  801d68:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d6c:	48 85 d2             	test   %rdx,%rdx
+  801d6f:	74 54                	je     801dc5 <readn+0x6a>
+  801d71:	41 89 fd             	mov    %edi,%r13d
+  801d74:	49 89 f6             	mov    %rsi,%r14
+  801d77:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d7f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d84:	49 bf d2 1b 80 00 00 	movabs $0x801bd2,%r15
+  801d8b:	00 00 00 
+  801d8e:	4c 89 e2             	mov    %r12,%rdx
+  801d91:	48 29 f2             	sub    %rsi,%rdx
+  801d94:	4c 01 f6             	add    %r14,%rsi
+  801d97:	44 89 ef             	mov    %r13d,%edi
+  801d9a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	78 20                	js     801dc1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801da1:	01 c3                	add    %eax,%ebx
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	74 08                	je     801daf <readn+0x54>
+  801da7:	48 63 f3             	movslq %ebx,%rsi
+  801daa:	4c 39 e6             	cmp    %r12,%rsi
+  801dad:	72 df                	jb     801d8e <readn+0x33>
+    }
+    return res;
+  801daf:	48 63 c3             	movslq %ebx,%rax
+}
+  801db2:	48 83 c4 08          	add    $0x8,%rsp
+  801db6:	5b                   	pop    %rbx
+  801db7:	41 5c                	pop    %r12
+  801db9:	41 5d                	pop    %r13
+  801dbb:	41 5e                	pop    %r14
+  801dbd:	41 5f                	pop    %r15
+  801dbf:	5d                   	pop    %rbp
+  801dc0:	c3                   	ret
+        if (inc < 0) return inc;
+  801dc1:	48 98                	cltq
+  801dc3:	eb ed                	jmp    801db2 <readn+0x57>
+    int inc = 1, res = 0;
+  801dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dca:	eb e3                	jmp    801daf <readn+0x54>
+
+0000000000801dcc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dcc:	55                   	push   %rbp
+  801dcd:	48 89 e5             	mov    %rsp,%rbp
+  801dd0:	41 56                	push   %r14
+  801dd2:	41 55                	push   %r13
+  801dd4:	41 54                	push   %r12
+  801dd6:	53                   	push   %rbx
+  801dd7:	48 83 ec 10          	sub    $0x10,%rsp
+  801ddb:	89 fb                	mov    %edi,%ebx
+  801ddd:	49 89 f4             	mov    %rsi,%r12
+  801de0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801de7:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801dee:	00 00 00 
+  801df1:	ff d0                	call   *%rax
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 47                	js     801e3e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dfb:	41 8b 3e             	mov    (%r14),%edi
+  801dfe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e02:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801e09:	00 00 00 
+  801e0c:	ff d0                	call   *%rax
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 30                	js     801e42 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e12:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e17:	74 2d                	je     801e46 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e1d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e21:	48 85 c0             	test   %rax,%rax
+  801e24:	74 56                	je     801e7c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e26:	4c 89 ea             	mov    %r13,%rdx
+  801e29:	4c 89 e6             	mov    %r12,%rsi
+  801e2c:	4c 89 f7             	mov    %r14,%rdi
+  801e2f:	ff d0                	call   *%rax
+}
+  801e31:	48 83 c4 10          	add    $0x10,%rsp
+  801e35:	5b                   	pop    %rbx
+  801e36:	41 5c                	pop    %r12
+  801e38:	41 5d                	pop    %r13
+  801e3a:	41 5e                	pop    %r14
+  801e3c:	5d                   	pop    %rbp
+  801e3d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3e:	48 98                	cltq
+  801e40:	eb ef                	jmp    801e31 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e42:	48 98                	cltq
+  801e44:	eb eb                	jmp    801e31 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e46:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e4d:	00 00 00 
+  801e50:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e56:	89 da                	mov    %ebx,%edx
+  801e58:	48 bf 3d 40 80 00 00 	movabs $0x80403d,%rdi
+  801e5f:	00 00 00 
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e67:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  801e6e:	00 00 00 
+  801e71:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e73:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e7a:	eb b5                	jmp    801e31 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e7c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e83:	eb ac                	jmp    801e31 <write+0x65>
+
+0000000000801e85 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e85:	55                   	push   %rbp
+  801e86:	48 89 e5             	mov    %rsp,%rbp
+  801e89:	53                   	push   %rbx
+  801e8a:	48 83 ec 18          	sub    $0x18,%rsp
+  801e8e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e94:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 0c                	js     801eb0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ea4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+
+0000000000801eb6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801eb6:	55                   	push   %rbp
+  801eb7:	48 89 e5             	mov    %rsp,%rbp
+  801eba:	41 55                	push   %r13
+  801ebc:	41 54                	push   %r12
+  801ebe:	53                   	push   %rbx
+  801ebf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec3:	89 fb                	mov    %edi,%ebx
+  801ec5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ecc:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 38                	js     801f14 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801edc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ee0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ee4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee8:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801eef:	00 00 00 
+  801ef2:	ff d0                	call   *%rax
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 1c                	js     801f14 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801efd:	74 20                	je     801f1f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801eff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f03:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801f07:	48 85 c0             	test   %rax,%rax
+  801f0a:	74 47                	je     801f53 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f0c:	44 89 e6             	mov    %r12d,%esi
+  801f0f:	4c 89 ef             	mov    %r13,%rdi
+  801f12:	ff d0                	call   *%rax
+}
+  801f14:	48 83 c4 18          	add    $0x18,%rsp
+  801f18:	5b                   	pop    %rbx
+  801f19:	41 5c                	pop    %r12
+  801f1b:	41 5d                	pop    %r13
+  801f1d:	5d                   	pop    %rbp
+  801f1e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f1f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f26:	00 00 00 
+  801f29:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f2f:	89 da                	mov    %ebx,%edx
+  801f31:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  801f38:	00 00 00 
+  801f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f40:	48 b9 13 02 80 00 00 	movabs $0x800213,%rcx
+  801f47:	00 00 00 
+  801f4a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f51:	eb c1                	jmp    801f14 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f58:	eb ba                	jmp    801f14 <ftruncate+0x5e>
+
+0000000000801f5a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f5a:	55                   	push   %rbp
+  801f5b:	48 89 e5             	mov    %rsp,%rbp
+  801f5e:	41 54                	push   %r12
+  801f60:	53                   	push   %rbx
+  801f61:	48 83 ec 10          	sub    $0x10,%rsp
+  801f65:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6c:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 4e                	js     801fca <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f80:	41 8b 3c 24          	mov    (%r12),%edi
+  801f84:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f88:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 32                	js     801fca <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f9c:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801fa1:	74 30                	je     801fd3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fa3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fa6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fad:	00 00 00 
+    stat->st_isdir = 0;
+  801fb0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fb7:	00 00 00 
+    stat->st_dev = dev;
+  801fba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fc1:	48 89 de             	mov    %rbx,%rsi
+  801fc4:	4c 89 e7             	mov    %r12,%rdi
+  801fc7:	ff 50 30             	call   *0x30(%rax)
+}
+  801fca:	48 83 c4 10          	add    $0x10,%rsp
+  801fce:	5b                   	pop    %rbx
+  801fcf:	41 5c                	pop    %r12
+  801fd1:	5d                   	pop    %rbp
+  801fd2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fd3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd8:	eb f0                	jmp    801fca <fstat+0x70>
+
+0000000000801fda <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	41 54                	push   %r12
+  801fe0:	53                   	push   %rbx
+  801fe1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe9:	48 b8 31 2d 80 00 00 	movabs $0x802d31,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 25                	js     802020 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ffb:	4c 89 e6             	mov    %r12,%rsi
+  801ffe:	89 c7                	mov    %eax,%edi
+  802000:	48 b8 5a 1f 80 00 00 	movabs $0x801f5a,%rax
+  802007:	00 00 00 
+  80200a:	ff d0                	call   *%rax
+  80200c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80200f:	89 df                	mov    %ebx,%edi
+  802011:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+
+    return res;
+  80201d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802020:	89 d8                	mov    %ebx,%eax
+  802022:	5b                   	pop    %rbx
+  802023:	41 5c                	pop    %r12
+  802025:	5d                   	pop    %rbp
+  802026:	c3                   	ret
+
+0000000000802027 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802027:	55                   	push   %rbp
+  802028:	48 89 e5             	mov    %rsp,%rbp
+  80202b:	41 54                	push   %r12
+  80202d:	53                   	push   %rbx
+  80202e:	48 83 ec 10          	sub    $0x10,%rsp
+  802032:	48 89 fb             	mov    %rdi,%rbx
+  802035:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802038:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80203c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802041:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 1f                	js     802070 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802051:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802055:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802059:	48 85 c0             	test   %rax,%rax
+  80205c:	74 1b                	je     802079 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80205e:	4c 89 e6             	mov    %r12,%rsi
+  802061:	48 89 df             	mov    %rbx,%rdi
+  802064:	ff d0                	call   *%rax
+    if (res < 0) {
+  802066:	85 c0                	test   %eax,%eax
+  802068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802070:	48 83 c4 10          	add    $0x10,%rsp
+  802074:	5b                   	pop    %rbx
+  802075:	41 5c                	pop    %r12
+  802077:	5d                   	pop    %rbp
+  802078:	c3                   	ret
+        return -E_NOT_SUPP;
+  802079:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80207e:	eb f0                	jmp    802070 <create_snapshot+0x49>
+
+0000000000802080 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802080:	55                   	push   %rbp
+  802081:	48 89 e5             	mov    %rsp,%rbp
+  802084:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802088:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80208c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802091:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 1e                	js     8020bf <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8020a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020a5:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8020a9:	48 85 d2             	test   %rdx,%rdx
+  8020ac:	74 13                	je     8020c1 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020bc:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020bf:	c9                   	leave
+  8020c0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c6:	eb f7                	jmp    8020bf <print_snapshot_list+0x3f>
+
+00000000008020c8 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	53                   	push   %rbx
+  8020cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020d4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020dd:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 1c                	js     802109 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8020ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f1:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8020f5:	48 85 c0             	test   %rax,%rax
+  8020f8:	74 15                	je     80210f <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8020fa:	48 89 df             	mov    %rbx,%rdi
+  8020fd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	ba 00 00 00 00       	mov    $0x0,%edx
+  802106:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802109:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80210f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802114:	eb f3                	jmp    802109 <accept_snapshot+0x41>
+
+0000000000802116 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802116:	55                   	push   %rbp
+  802117:	48 89 e5             	mov    %rsp,%rbp
+  80211a:	53                   	push   %rbx
+  80211b:	48 83 ec 18          	sub    $0x18,%rsp
+  80211f:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802122:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802126:	bf 66 00 00 00       	mov    $0x66,%edi
+  80212b:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	85 c0                	test   %eax,%eax
+  802139:	78 1c                	js     802157 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80213b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80213f:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802143:	48 85 c0             	test   %rax,%rax
+  802146:	74 15                	je     80215d <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802148:	48 89 df             	mov    %rbx,%rdi
+  80214b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802154:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802157:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80215d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802162:	eb f3                	jmp    802157 <delete_snapshot+0x41>
+
+0000000000802164 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80216c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802170:	bf 66 00 00 00       	mov    $0x66,%edi
+  802175:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  80217c:	00 00 00 
+  80217f:	ff d0                	call   *%rax
+  802181:	85 c0                	test   %eax,%eax
+  802183:	78 14                	js     802199 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802185:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802189:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80218d:	48 85 d2             	test   %rdx,%rdx
+  802190:	74 09                	je     80219b <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802192:	b8 00 00 00 00       	mov    $0x0,%eax
+  802197:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802199:	c9                   	leave
+  80219a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80219b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021a0:	eb f7                	jmp    802199 <gc_snapshots+0x35>
+
+00000000008021a2 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8021a2:	55                   	push   %rbp
+  8021a3:	48 89 e5             	mov    %rsp,%rbp
+  8021a6:	41 56                	push   %r14
+  8021a8:	41 55                	push   %r13
+  8021aa:	41 54                	push   %r12
+  8021ac:	53                   	push   %rbx
+  8021ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8021b1:	48 89 fb             	mov    %rdi,%rbx
+  8021b4:	49 89 f4             	mov    %rsi,%r12
+  8021b7:	49 89 d5             	mov    %rdx,%r13
+  8021ba:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021bd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021c1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021c6:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8021cd:	00 00 00 
+  8021d0:	ff d0                	call   *%rax
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 1b                	js     8021f1 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8021d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021da:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8021de:	48 85 c0             	test   %rax,%rax
+  8021e1:	74 1b                	je     8021fe <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8021e3:	4c 89 f1             	mov    %r14,%rcx
+  8021e6:	4c 89 ea             	mov    %r13,%rdx
+  8021e9:	4c 89 e6             	mov    %r12,%rsi
+  8021ec:	48 89 df             	mov    %rbx,%rdi
+  8021ef:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021f1:	48 83 c4 10          	add    $0x10,%rsp
+  8021f5:	5b                   	pop    %rbx
+  8021f6:	41 5c                	pop    %r12
+  8021f8:	41 5d                	pop    %r13
+  8021fa:	41 5e                	pop    %r14
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802203:	eb ec                	jmp    8021f1 <diff_snapshots+0x4f>
+
+0000000000802205 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	41 55                	push   %r13
+  80220b:	41 54                	push   %r12
+  80220d:	53                   	push   %rbx
+  80220e:	48 83 ec 18          	sub    $0x18,%rsp
+  802212:	48 89 fb             	mov    %rdi,%rbx
+  802215:	49 89 f4             	mov    %rsi,%r12
+  802218:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80221b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80221f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802224:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	85 c0                	test   %eax,%eax
+  802232:	78 18                	js     80224c <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802234:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802238:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80223c:	48 85 c0             	test   %rax,%rax
+  80223f:	74 16                	je     802257 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802241:	4c 89 ea             	mov    %r13,%rdx
+  802244:	4c 89 e6             	mov    %r12,%rsi
+  802247:	48 89 df             	mov    %rbx,%rdi
+  80224a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80224c:	48 83 c4 18          	add    $0x18,%rsp
+  802250:	5b                   	pop    %rbx
+  802251:	41 5c                	pop    %r12
+  802253:	41 5d                	pop    %r13
+  802255:	5d                   	pop    %rbp
+  802256:	c3                   	ret
+        return -E_NOT_SUPP;
+  802257:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80225c:	eb ee                	jmp    80224c <send_snapshot+0x47>
+
+000000000080225e <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80225e:	55                   	push   %rbp
+  80225f:	48 89 e5             	mov    %rsp,%rbp
+  802262:	53                   	push   %rbx
+  802263:	48 83 ec 18          	sub    $0x18,%rsp
+  802267:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80226a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80226e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802273:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  80227a:	00 00 00 
+  80227d:	ff d0                	call   *%rax
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	78 12                	js     802295 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802287:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80228b:	48 85 c0             	test   %rax,%rax
+  80228e:	74 0b                	je     80229b <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802290:	48 89 df             	mov    %rbx,%rdi
+  802293:	ff d0                	call   *%rax
+
+    return res;
+}
+  802295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80229b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022a0:	eb f3                	jmp    802295 <receive_snapshot+0x37>
+
+00000000008022a2 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8022a2:	55                   	push   %rbp
+  8022a3:	48 89 e5             	mov    %rsp,%rbp
+  8022a6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022aa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ae:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022b3:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8022ba:	00 00 00 
+  8022bd:	ff d0                	call   *%rax
+  8022bf:	85 c0                	test   %eax,%eax
+  8022c1:	78 17                	js     8022da <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8022c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c7:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8022ce:	48 85 d2             	test   %rdx,%rdx
+  8022d1:	74 09                	je     8022dc <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8022d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d8:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022da:	c9                   	leave
+  8022db:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022dc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e1:	eb f7                	jmp    8022da <free_space_bytes+0x38>
+
+00000000008022e3 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ef:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022f4:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 17                	js     80231b <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802304:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802308:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80230f:	48 85 d2             	test   %rdx,%rdx
+  802312:	74 09                	je     80231d <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802314:	b8 00 00 00 00       	mov    $0x0,%eax
+  802319:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80231d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802322:	eb f7                	jmp    80231b <busy_space_bytes+0x38>
+
+0000000000802324 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802324:	55                   	push   %rbp
+  802325:	48 89 e5             	mov    %rsp,%rbp
+  802328:	41 54                	push   %r12
+  80232a:	53                   	push   %rbx
+  80232b:	48 83 ec 10          	sub    $0x10,%rsp
+  80232f:	89 fb                	mov    %edi,%ebx
+  802331:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802334:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802338:	bf 66 00 00 00       	mov    $0x66,%edi
+  80233d:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	78 17                	js     802364 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80234d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802351:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802358:	48 85 c0             	test   %rax,%rax
+  80235b:	74 10                	je     80236d <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80235d:	4c 89 e6             	mov    %r12,%rsi
+  802360:	89 df                	mov    %ebx,%edi
+  802362:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802364:	48 83 c4 10          	add    $0x10,%rsp
+  802368:	5b                   	pop    %rbx
+  802369:	41 5c                	pop    %r12
+  80236b:	5d                   	pop    %rbp
+  80236c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80236d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802372:	eb f0                	jmp    802364 <snapshots_space+0x40>
+
+0000000000802374 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+  802378:	41 55                	push   %r13
+  80237a:	41 54                	push   %r12
+  80237c:	53                   	push   %rbx
+  80237d:	48 83 ec 08          	sub    $0x8,%rsp
+  802381:	41 89 fd             	mov    %edi,%r13d
+  802384:	48 89 f3             	mov    %rsi,%rbx
+  802387:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80238a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802391:	00 00 00 
+  802394:	83 38 00             	cmpl   $0x0,(%rax)
+  802397:	74 57                	je     8023f0 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802399:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80239f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023a4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8023ab:	00 00 00 
+  8023ae:	44 89 ee             	mov    %r13d,%esi
+  8023b1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023b8:	00 00 00 
+  8023bb:	8b 38                	mov    (%rax),%edi
+  8023bd:	48 b8 94 38 80 00 00 	movabs $0x803894,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8023c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ce:	4c 89 e2             	mov    %r12,%rdx
+  8023d1:	48 89 de             	mov    %rbx,%rsi
+  8023d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d9:	48 b8 7c 38 80 00 00 	movabs $0x80387c,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+}
+  8023e5:	48 83 c4 08          	add    $0x8,%rsp
+  8023e9:	5b                   	pop    %rbx
+  8023ea:	41 5c                	pop    %r12
+  8023ec:	41 5d                	pop    %r13
+  8023ee:	5d                   	pop    %rbp
+  8023ef:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023f0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023f5:	48 b8 52 39 80 00 00 	movabs $0x803952,%rax
+  8023fc:	00 00 00 
+  8023ff:	ff d0                	call   *%rax
+  802401:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802408:	00 00 
+  80240a:	eb 8d                	jmp    802399 <fsipc_region+0x25>
+
+000000000080240c <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80240c:	55                   	push   %rbp
+  80240d:	48 89 e5             	mov    %rsp,%rbp
+  802410:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802414:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80241b:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80241c:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802420:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+}
+  80242c:	c9                   	leave
+  80242d:	c3                   	ret
+
+000000000080242e <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80242e:	85 ff                	test   %edi,%edi
+  802430:	78 6d                	js     80249f <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802432:	55                   	push   %rbp
+  802433:	48 89 e5             	mov    %rsp,%rbp
+  802436:	41 54                	push   %r12
+  802438:	53                   	push   %rbx
+  802439:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80243c:	48 85 f6             	test   %rsi,%rsi
+  80243f:	74 57                	je     802498 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802441:	89 f8                	mov    %edi,%eax
+  802443:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80244a:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80244c:	be 00 00 00 00       	mov    $0x0,%esi
+  802451:	bf 12 00 00 00       	mov    $0x12,%edi
+  802456:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 2d                	js     802493 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802466:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80246d:	00 00 00 
+  802470:	49 63 14 24          	movslq (%r12),%rdx
+  802474:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80247b:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802480:	48 89 df             	mov    %rbx,%rdi
+  802483:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80248f:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802493:	5b                   	pop    %rbx
+  802494:	41 5c                	pop    %r12
+  802496:	5d                   	pop    %rbp
+  802497:	c3                   	ret
+        return -E_INVAL;
+  802498:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80249d:	eb f4                	jmp    802493 <devfile_df_snapshots+0x65>
+  80249f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024a4:	c3                   	ret
+
+00000000008024a5 <devfile_df_busy>:
+devfile_df_busy() {
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8024a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ae:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024b3:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+}
+  8024bf:	5d                   	pop    %rbp
+  8024c0:	c3                   	ret
+
+00000000008024c1 <devfile_df_free>:
+devfile_df_free() {
+  8024c1:	55                   	push   %rbp
+  8024c2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8024c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ca:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024cf:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+}
+  8024db:	5d                   	pop    %rbp
+  8024dc:	c3                   	ret
+
+00000000008024dd <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8024dd:	55                   	push   %rbp
+  8024de:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8024e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8024eb:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+}
+  8024f7:	5d                   	pop    %rbp
+  8024f8:	c3                   	ret
+
+00000000008024f9 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8024fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802502:	bf 09 00 00 00       	mov    $0x9,%edi
+  802507:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802513:	85 c0                	test   %eax,%eax
+  802515:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80251d:	5d                   	pop    %rbp
+  80251e:	c3                   	ret
+
+000000000080251f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802523:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80252a:	00 00 00 
+  80252d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802530:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802532:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802535:	be 00 00 00 00       	mov    $0x0,%esi
+  80253a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80253f:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+}
+  80254b:	5d                   	pop    %rbp
+  80254c:	c3                   	ret
+
+000000000080254d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80254d:	55                   	push   %rbp
+  80254e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802551:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802554:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80255b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80255d:	be 00 00 00 00       	mov    $0x0,%esi
+  802562:	bf 06 00 00 00       	mov    $0x6,%edi
+  802567:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  80256e:	00 00 00 
+  802571:	ff d0                	call   *%rax
+}
+  802573:	5d                   	pop    %rbp
+  802574:	c3                   	ret
+
+0000000000802575 <devfile_write>:
+    if (!fd || !buf) {
+  802575:	48 85 ff             	test   %rdi,%rdi
+  802578:	0f 84 c1 00 00 00    	je     80263f <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80257e:	55                   	push   %rbp
+  80257f:	48 89 e5             	mov    %rsp,%rbp
+  802582:	41 57                	push   %r15
+  802584:	41 56                	push   %r14
+  802586:	41 55                	push   %r13
+  802588:	41 54                	push   %r12
+  80258a:	53                   	push   %rbx
+  80258b:	48 83 ec 18          	sub    $0x18,%rsp
+  80258f:	49 89 ff             	mov    %rdi,%r15
+  802592:	49 89 f5             	mov    %rsi,%r13
+  802595:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802598:	48 85 f6             	test   %rsi,%rsi
+  80259b:	0f 84 95 00 00 00    	je     802636 <devfile_write+0xc1>
+    while (n) {
+  8025a1:	48 85 d2             	test   %rdx,%rdx
+  8025a4:	0f 84 83 00 00 00    	je     80262d <devfile_write+0xb8>
+    int totalWrite = 0;
+  8025aa:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025b1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025b8:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025bb:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025c0:	49 39 dc             	cmp    %rbx,%r12
+  8025c3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8025c7:	48 89 da             	mov    %rbx,%rdx
+  8025ca:	4c 89 ee             	mov    %r13,%rsi
+  8025cd:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8025d4:	00 00 00 
+  8025d7:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025e3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025e7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8025ea:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8025ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8025f8:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+        if (write < 0) {
+  802604:	85 c0                	test   %eax,%eax
+  802606:	78 21                	js     802629 <devfile_write+0xb4>
+        buf += write;
+  802608:	48 63 d0             	movslq %eax,%rdx
+  80260b:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80260e:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802611:	49 29 d4             	sub    %rdx,%r12
+  802614:	75 a5                	jne    8025bb <devfile_write+0x46>
+    return totalWrite;
+  802616:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80261a:	48 83 c4 18          	add    $0x18,%rsp
+  80261e:	5b                   	pop    %rbx
+  80261f:	41 5c                	pop    %r12
+  802621:	41 5d                	pop    %r13
+  802623:	41 5e                	pop    %r14
+  802625:	41 5f                	pop    %r15
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+            return write;
+  802629:	48 98                	cltq
+  80262b:	eb ed                	jmp    80261a <devfile_write+0xa5>
+    int totalWrite = 0;
+  80262d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802634:	eb e0                	jmp    802616 <devfile_write+0xa1>
+        return -E_INVAL;
+  802636:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80263d:	eb db                	jmp    80261a <devfile_write+0xa5>
+  80263f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802646:	c3                   	ret
+
+0000000000802647 <devfile_read>:
+    if (!fd || !buf) {
+  802647:	48 85 ff             	test   %rdi,%rdi
+  80264a:	0f 84 c0 00 00 00    	je     802710 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802650:	55                   	push   %rbp
+  802651:	48 89 e5             	mov    %rsp,%rbp
+  802654:	41 57                	push   %r15
+  802656:	41 56                	push   %r14
+  802658:	41 55                	push   %r13
+  80265a:	41 54                	push   %r12
+  80265c:	53                   	push   %rbx
+  80265d:	48 83 ec 18          	sub    $0x18,%rsp
+  802661:	49 89 ff             	mov    %rdi,%r15
+  802664:	49 89 f5             	mov    %rsi,%r13
+  802667:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80266a:	48 85 f6             	test   %rsi,%rsi
+  80266d:	0f 84 96 00 00 00    	je     802709 <devfile_read+0xc2>
+    while (n) {
+  802673:	48 85 d2             	test   %rdx,%rdx
+  802676:	0f 84 87 00 00 00    	je     802703 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80267c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802683:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802684:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80268b:	00 00 00 
+  80268e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802692:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802695:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80269a:	49 39 c4             	cmp    %rax,%r12
+  80269d:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8026a1:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8026a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026aa:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026af:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8026b6:	00 00 00 
+  8026b9:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	7e 37                	jle    8026f6 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8026bf:	48 63 d8             	movslq %eax,%rbx
+  8026c2:	48 89 da             	mov    %rbx,%rdx
+  8026c5:	4c 89 f6             	mov    %r14,%rsi
+  8026c8:	4c 89 ef             	mov    %r13,%rdi
+  8026cb:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+        buf += read;
+  8026d7:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8026da:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8026de:	49 29 dc             	sub    %rbx,%r12
+  8026e1:	75 ab                	jne    80268e <devfile_read+0x47>
+  return totalRead;
+  8026e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8026e7:	48 83 c4 18          	add    $0x18,%rsp
+  8026eb:	5b                   	pop    %rbx
+  8026ec:	41 5c                	pop    %r12
+  8026ee:	41 5d                	pop    %r13
+  8026f0:	41 5e                	pop    %r14
+  8026f2:	41 5f                	pop    %r15
+  8026f4:	5d                   	pop    %rbp
+  8026f5:	c3                   	ret
+            return read ? read : totalRead;
+  8026f6:	48 63 d0             	movslq %eax,%rdx
+  8026f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026fd:	48 0f 45 c2          	cmovne %rdx,%rax
+  802701:	eb e4                	jmp    8026e7 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802703:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802707:	eb da                	jmp    8026e3 <devfile_read+0x9c>
+        return E_INVAL;
+  802709:	b8 03 00 00 00       	mov    $0x3,%eax
+  80270e:	eb d7                	jmp    8026e7 <devfile_read+0xa0>
+  802710:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802715:	c3                   	ret
+
+0000000000802716 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802716:	48 85 ff             	test   %rdi,%rdi
+  802719:	74 5f                	je     80277a <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80271b:	55                   	push   %rbp
+  80271c:	48 89 e5             	mov    %rsp,%rbp
+  80271f:	53                   	push   %rbx
+  802720:	48 83 ec 08          	sub    $0x8,%rsp
+  802724:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802727:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  80272e:	00 00 00 
+  802731:	ff d0                	call   *%rax
+  802733:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802739:	77 45                	ja     802780 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80273b:	48 89 de             	mov    %rbx,%rsi
+  80273e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802745:	00 00 00 
+  802748:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  80274f:	00 00 00 
+  802752:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802754:	be 00 00 00 00       	mov    $0x0,%esi
+  802759:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80275e:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802765:	00 00 00 
+  802768:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802771:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802774:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802778:	c9                   	leave
+  802779:	c3                   	ret
+        return -E_INVAL;
+  80277a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80277f:	c3                   	ret
+        return -E_INVAL;
+  802780:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802785:	eb ed                	jmp    802774 <devfile_receive_snapshot+0x5e>
+
+0000000000802787 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+  80278b:	41 55                	push   %r13
+  80278d:	41 54                	push   %r12
+  80278f:	53                   	push   %rbx
+  802790:	48 83 ec 08          	sub    $0x8,%rsp
+  802794:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802797:	48 85 f6             	test   %rsi,%rsi
+  80279a:	0f 94 c0             	sete   %al
+  80279d:	48 85 d2             	test   %rdx,%rdx
+  8027a0:	0f 94 c2             	sete   %dl
+  8027a3:	08 d0                	or     %dl,%al
+  8027a5:	0f 85 ad 00 00 00    	jne    802858 <devfile_send_snapshot+0xd1>
+  8027ab:	48 89 fb             	mov    %rdi,%rbx
+  8027ae:	49 89 f4             	mov    %rsi,%r12
+  8027b1:	48 85 ff             	test   %rdi,%rdi
+  8027b4:	0f 84 9e 00 00 00    	je     802858 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8027ba:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+  8027c6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027cc:	0f 87 8d 00 00 00    	ja     80285f <devfile_send_snapshot+0xd8>
+  8027d2:	4c 89 e7             	mov    %r12,%rdi
+  8027d5:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8027dc:	00 00 00 
+  8027df:	ff d0                	call   *%rax
+  8027e1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027e7:	77 7d                	ja     802866 <devfile_send_snapshot+0xdf>
+  8027e9:	4c 89 ef             	mov    %r13,%rdi
+  8027ec:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+  8027f8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027fe:	77 6d                	ja     80286d <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802800:	48 89 de             	mov    %rbx,%rsi
+  802803:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80280a:	00 00 00 
+  80280d:	48 bb 38 0b 80 00 00 	movabs $0x800b38,%rbx
+  802814:	00 00 00 
+  802817:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802819:	4c 89 e6             	mov    %r12,%rsi
+  80281c:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802823:	00 00 00 
+  802826:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802828:	4c 89 ee             	mov    %r13,%rsi
+  80282b:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802832:	00 00 00 
+  802835:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802837:	be 00 00 00 00       	mov    $0x0,%esi
+  80283c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802841:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802848:	00 00 00 
+  80284b:	ff d0                	call   *%rax
+}
+  80284d:	48 83 c4 08          	add    $0x8,%rsp
+  802851:	5b                   	pop    %rbx
+  802852:	41 5c                	pop    %r12
+  802854:	41 5d                	pop    %r13
+  802856:	5d                   	pop    %rbp
+  802857:	c3                   	ret
+        return -E_INVAL;
+  802858:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80285d:	eb ee                	jmp    80284d <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80285f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802864:	eb e7                	jmp    80284d <devfile_send_snapshot+0xc6>
+  802866:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80286b:	eb e0                	jmp    80284d <devfile_send_snapshot+0xc6>
+  80286d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802872:	eb d9                	jmp    80284d <devfile_send_snapshot+0xc6>
+
+0000000000802874 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802874:	48 85 ff             	test   %rdi,%rdi
+  802877:	0f 84 41 01 00 00    	je     8029be <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80287d:	55                   	push   %rbp
+  80287e:	48 89 e5             	mov    %rsp,%rbp
+  802881:	41 57                	push   %r15
+  802883:	41 56                	push   %r14
+  802885:	41 55                	push   %r13
+  802887:	41 54                	push   %r12
+  802889:	53                   	push   %rbx
+  80288a:	48 83 ec 08          	sub    $0x8,%rsp
+  80288e:	49 89 fc             	mov    %rdi,%r12
+  802891:	49 89 f5             	mov    %rsi,%r13
+  802894:	48 89 d3             	mov    %rdx,%rbx
+  802897:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80289a:	48 85 f6             	test   %rsi,%rsi
+  80289d:	0f 84 ff 00 00 00    	je     8029a2 <devfile_diff_snapshots+0x12e>
+  8028a3:	48 85 d2             	test   %rdx,%rdx
+  8028a6:	0f 84 fd 00 00 00    	je     8029a9 <devfile_diff_snapshots+0x135>
+  8028ac:	48 85 c9             	test   %rcx,%rcx
+  8028af:	0f 84 f4 00 00 00    	je     8029a9 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8028b5:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8028bc:	00 00 00 
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028c7:	0f 87 e3 00 00 00    	ja     8029b0 <devfile_diff_snapshots+0x13c>
+  8028cd:	4c 89 ef             	mov    %r13,%rdi
+  8028d0:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+  8028dc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028e2:	0f 87 cf 00 00 00    	ja     8029b7 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8028e8:	4c 89 e6             	mov    %r12,%rsi
+  8028eb:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8028f2:	00 00 00 
+  8028f5:	4c 89 e7             	mov    %r12,%rdi
+  8028f8:	49 bf 38 0b 80 00 00 	movabs $0x800b38,%r15
+  8028ff:	00 00 00 
+  802902:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802905:	4c 89 ee             	mov    %r13,%rsi
+  802908:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80290f:	00 
+  802910:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802913:	48 8b 03             	mov    (%rbx),%rax
+  802916:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80291d:	00 
+  80291e:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802922:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802929:	00 
+  80292a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80292e:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802935:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802936:	be 00 00 00 00       	mov    $0x0,%esi
+  80293b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802940:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 43                	js     802993 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802950:	49 8b 04 24          	mov    (%r12),%rax
+  802954:	48 89 03             	mov    %rax,(%rbx)
+  802957:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80295c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802960:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802965:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802969:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80296e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802972:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802976:	48 c1 e2 03          	shl    $0x3,%rdx
+  80297a:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80297f:	4c 89 f7             	mov    %r14,%rdi
+  802982:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80298e:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802993:	48 83 c4 08          	add    $0x8,%rsp
+  802997:	5b                   	pop    %rbx
+  802998:	41 5c                	pop    %r12
+  80299a:	41 5d                	pop    %r13
+  80299c:	41 5e                	pop    %r14
+  80299e:	41 5f                	pop    %r15
+  8029a0:	5d                   	pop    %rbp
+  8029a1:	c3                   	ret
+        return -E_INVAL;
+  8029a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a7:	eb ea                	jmp    802993 <devfile_diff_snapshots+0x11f>
+  8029a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ae:	eb e3                	jmp    802993 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b5:	eb dc                	jmp    802993 <devfile_diff_snapshots+0x11f>
+  8029b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029bc:	eb d5                	jmp    802993 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029c3:	c3                   	ret
+
+00000000008029c4 <devfile_delete_snapshot>:
+    if (!name) {
+  8029c4:	48 85 ff             	test   %rdi,%rdi
+  8029c7:	74 5f                	je     802a28 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8029c9:	55                   	push   %rbp
+  8029ca:	48 89 e5             	mov    %rsp,%rbp
+  8029cd:	53                   	push   %rbx
+  8029ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029d5:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029e7:	77 45                	ja     802a2e <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8029e9:	48 89 de             	mov    %rbx,%rsi
+  8029ec:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029f3:	00 00 00 
+  8029f6:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802a02:	be 00 00 00 00       	mov    $0x0,%esi
+  802a07:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a0c:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a18:	85 c0                	test   %eax,%eax
+  802a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a26:	c9                   	leave
+  802a27:	c3                   	ret
+        return -E_INVAL;
+  802a28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a2d:	c3                   	ret
+        return -E_INVAL;
+  802a2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a33:	eb ed                	jmp    802a22 <devfile_delete_snapshot+0x5e>
+
+0000000000802a35 <devfile_accept_snapshot>:
+    if (!name) {
+  802a35:	48 85 ff             	test   %rdi,%rdi
+  802a38:	74 5f                	je     802a99 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	53                   	push   %rbx
+  802a3f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a43:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802a46:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+  802a52:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a58:	77 45                	ja     802a9f <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802a5a:	48 89 de             	mov    %rbx,%rsi
+  802a5d:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a64:	00 00 00 
+  802a67:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  802a6e:	00 00 00 
+  802a71:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802a73:	be 00 00 00 00       	mov    $0x0,%esi
+  802a78:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a7d:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a90:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+        return -E_INVAL;
+  802a99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a9e:	c3                   	ret
+        return -E_INVAL;
+  802a9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aa4:	eb ed                	jmp    802a93 <devfile_accept_snapshot+0x5e>
+
+0000000000802aa6 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802aa6:	48 85 ff             	test   %rdi,%rdi
+  802aa9:	0f 84 9f 00 00 00    	je     802b4e <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802aaf:	55                   	push   %rbp
+  802ab0:	48 89 e5             	mov    %rsp,%rbp
+  802ab3:	41 54                	push   %r12
+  802ab5:	53                   	push   %rbx
+  802ab6:	48 89 fb             	mov    %rdi,%rbx
+  802ab9:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802abc:	48 85 f6             	test   %rsi,%rsi
+  802abf:	74 78                	je     802b39 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802ac1:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+  802acd:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ad3:	77 6b                	ja     802b40 <devfile_create_snapshot+0x9a>
+  802ad5:	4c 89 e7             	mov    %r12,%rdi
+  802ad8:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+  802ae4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802aea:	77 5b                	ja     802b47 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802aec:	48 89 de             	mov    %rbx,%rsi
+  802aef:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802af6:	00 00 00 
+  802af9:	48 bb 38 0b 80 00 00 	movabs $0x800b38,%rbx
+  802b00:	00 00 00 
+  802b03:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802b05:	4c 89 e6             	mov    %r12,%rsi
+  802b08:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802b0f:	00 00 00 
+  802b12:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802b14:	be 00 00 00 00       	mov    $0x0,%esi
+  802b19:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b1e:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802b25:	00 00 00 
+  802b28:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b31:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b34:	5b                   	pop    %rbx
+  802b35:	41 5c                	pop    %r12
+  802b37:	5d                   	pop    %rbp
+  802b38:	c3                   	ret
+        return -E_INVAL;
+  802b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b3e:	eb f4                	jmp    802b34 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b45:	eb ed                	jmp    802b34 <devfile_create_snapshot+0x8e>
+  802b47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b4c:	eb e6                	jmp    802b34 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b53:	c3                   	ret
+
+0000000000802b54 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+  802b58:	41 54                	push   %r12
+  802b5a:	53                   	push   %rbx
+  802b5b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b5e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b61:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802b68:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b6a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b74:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 3d                	js     802bc1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b84:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802b8b:	00 00 00 
+  802b8e:	4c 89 e6             	mov    %r12,%rsi
+  802b91:	48 89 df             	mov    %rbx,%rdi
+  802b94:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ba0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ba7:	00 
+  802ba8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bae:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802bb5:	00 
+  802bb6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bc1:	5b                   	pop    %rbx
+  802bc2:	41 5c                	pop    %r12
+  802bc4:	5d                   	pop    %rbp
+  802bc5:	c3                   	ret
+
+0000000000802bc6 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802bc6:	55                   	push   %rbp
+  802bc7:	48 89 e5             	mov    %rsp,%rbp
+  802bca:	41 57                	push   %r15
+  802bcc:	41 56                	push   %r14
+  802bce:	41 55                	push   %r13
+  802bd0:	41 54                	push   %r12
+  802bd2:	53                   	push   %rbx
+  802bd3:	48 83 ec 38          	sub    $0x38,%rsp
+  802bd7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802bdb:	49 89 f5             	mov    %rsi,%r13
+  802bde:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802be1:	48 89 f0             	mov    %rsi,%rax
+  802be4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802be9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802bed:	75 4f                	jne    802c3e <devfile_readmap+0x78>
+  802bef:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bf3:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802bf9:	75 1f                	jne    802c1a <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802bfb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bff:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c03:	49 be ae 33 80 00 00 	movabs $0x8033ae,%r14
+  802c0a:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c0d:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802c14:	0f 87 9d 00 00 00    	ja     802cb7 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802c1a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c1e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802c22:	4d 85 ff             	test   %r15,%r15
+  802c25:	0f 85 cf 00 00 00    	jne    802cfa <devfile_readmap+0x134>
+  802c2b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802c2f:	48 83 c4 38          	add    $0x38,%rsp
+  802c33:	5b                   	pop    %rbx
+  802c34:	41 5c                	pop    %r12
+  802c36:	41 5d                	pop    %r13
+  802c38:	41 5e                	pop    %r14
+  802c3a:	41 5f                	pop    %r15
+  802c3c:	5d                   	pop    %rbp
+  802c3d:	c3                   	ret
+    size_t totalRead = 0;
+  802c3e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802c45:	00 
+  802c46:	eb da                	jmp    802c22 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c48:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c4f:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802c56:	00 00 00 
+  802c59:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802c5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c5f:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802c63:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c67:	4c 89 ee             	mov    %r13,%rsi
+  802c6a:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c6f:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  802c76:	00 00 00 
+  802c79:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	7e a3                	jle    802c22 <devfile_readmap+0x5c>
+  802c7f:	48 98                	cltq
+  802c81:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c85:	72 9b                	jb     802c22 <devfile_readmap+0x5c>
+        buf += read;
+  802c87:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c8a:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c8d:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c91:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c98:	75 88                	jne    802c22 <devfile_readmap+0x5c>
+  802c9a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c9e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ca4:	0f 85 78 ff ff ff    	jne    802c22 <devfile_readmap+0x5c>
+  802caa:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802cb1:	0f 86 6b ff ff ff    	jbe    802c22 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802cb7:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802cbd:	4d 39 e7             	cmp    %r12,%r15
+  802cc0:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802cc4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802ccb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ccf:	0f 84 73 ff ff ff    	je     802c48 <devfile_readmap+0x82>
+  802cd5:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cd9:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802cde:	41 ff d6             	call   *%r14
+  802ce1:	a8 40                	test   $0x40,%al
+  802ce3:	0f 85 39 ff ff ff    	jne    802c22 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ce9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802cf0:	4c 39 e3             	cmp    %r12,%rbx
+  802cf3:	72 e4                	jb     802cd9 <devfile_readmap+0x113>
+  802cf5:	e9 4e ff ff ff       	jmp    802c48 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802cfa:	4c 89 fa             	mov    %r15,%rdx
+  802cfd:	4c 89 ee             	mov    %r13,%rsi
+  802d00:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802d04:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802d10:	48 85 c0             	test   %rax,%rax
+  802d13:	78 0c                	js     802d21 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802d15:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d19:	48 01 f0             	add    %rsi,%rax
+  802d1c:	e9 0e ff ff ff       	jmp    802c2f <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802d21:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d25:	48 85 f6             	test   %rsi,%rsi
+  802d28:	48 0f 45 c6          	cmovne %rsi,%rax
+  802d2c:	e9 fe fe ff ff       	jmp    802c2f <devfile_readmap+0x69>
+
+0000000000802d31 <open>:
+open(const char *path, int mode) {
+  802d31:	55                   	push   %rbp
+  802d32:	48 89 e5             	mov    %rsp,%rbp
+  802d35:	41 55                	push   %r13
+  802d37:	41 54                	push   %r12
+  802d39:	53                   	push   %rbx
+  802d3a:	48 83 ec 18          	sub    $0x18,%rsp
+  802d3e:	49 89 fc             	mov    %rdi,%r12
+  802d41:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d44:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+  802d50:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d56:	0f 87 8a 00 00 00    	ja     802de6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d5c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d60:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802d67:	00 00 00 
+  802d6a:	ff d0                	call   *%rax
+  802d6c:	89 c3                	mov    %eax,%ebx
+  802d6e:	85 c0                	test   %eax,%eax
+  802d70:	78 50                	js     802dc2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d72:	4c 89 e6             	mov    %r12,%rsi
+  802d75:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802d7c:	00 00 00 
+  802d7f:	48 89 df             	mov    %rbx,%rdi
+  802d82:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d8e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d95:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d99:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d9e:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802da5:	00 00 00 
+  802da8:	ff d0                	call   *%rax
+  802daa:	89 c3                	mov    %eax,%ebx
+  802dac:	85 c0                	test   %eax,%eax
+  802dae:	78 1f                	js     802dcf <open+0x9e>
+    return fd2num(fd);
+  802db0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802db4:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+  802dc0:	89 c3                	mov    %eax,%ebx
+}
+  802dc2:	89 d8                	mov    %ebx,%eax
+  802dc4:	48 83 c4 18          	add    $0x18,%rsp
+  802dc8:	5b                   	pop    %rbx
+  802dc9:	41 5c                	pop    %r12
+  802dcb:	41 5d                	pop    %r13
+  802dcd:	5d                   	pop    %rbp
+  802dce:	c3                   	ret
+        fd_close(fd, 0);
+  802dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dd8:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  802ddf:	00 00 00 
+  802de2:	ff d0                	call   *%rax
+        return res;
+  802de4:	eb dc                	jmp    802dc2 <open+0x91>
+        return -E_BAD_PATH;
+  802de6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802deb:	eb d5                	jmp    802dc2 <open+0x91>
+
+0000000000802ded <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802df1:	be 00 00 00 00       	mov    $0x0,%esi
+  802df6:	bf 13 00 00 00       	mov    $0x13,%edi
+  802dfb:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  802e02:	00 00 00 
+  802e05:	ff d0                	call   *%rax
+}
+  802e07:	5d                   	pop    %rbp
+  802e08:	c3                   	ret
+
+0000000000802e09 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e09:	55                   	push   %rbp
+  802e0a:	48 89 e5             	mov    %rsp,%rbp
+  802e0d:	41 54                	push   %r12
+  802e0f:	53                   	push   %rbx
+  802e10:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e13:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  802e1a:	00 00 00 
+  802e1d:	ff d0                	call   *%rax
+  802e1f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e22:	48 be 80 40 80 00 00 	movabs $0x804080,%rsi
+  802e29:	00 00 00 
+  802e2c:	48 89 df             	mov    %rbx,%rdi
+  802e2f:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e3b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e40:	41 2b 04 24          	sub    (%r12),%eax
+  802e44:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e51:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e54:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802e5b:	00 00 00 
+  802e5e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6a:	5b                   	pop    %rbx
+  802e6b:	41 5c                	pop    %r12
+  802e6d:	5d                   	pop    %rbp
+  802e6e:	c3                   	ret
+
+0000000000802e6f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802e6f:	55                   	push   %rbp
+  802e70:	48 89 e5             	mov    %rsp,%rbp
+  802e73:	41 54                	push   %r12
+  802e75:	53                   	push   %rbx
+  802e76:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e7e:	48 89 fe             	mov    %rdi,%rsi
+  802e81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e86:	49 bc 90 12 80 00 00 	movabs $0x801290,%r12
+  802e8d:	00 00 00 
+  802e90:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802e93:	48 89 df             	mov    %rbx,%rdi
+  802e96:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  802e9d:	00 00 00 
+  802ea0:	ff d0                	call   *%rax
+  802ea2:	48 89 c6             	mov    %rax,%rsi
+  802ea5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eaf:	41 ff d4             	call   *%r12
+}
+  802eb2:	5b                   	pop    %rbx
+  802eb3:	41 5c                	pop    %r12
+  802eb5:	5d                   	pop    %rbp
+  802eb6:	c3                   	ret
+
+0000000000802eb7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802eb7:	55                   	push   %rbp
+  802eb8:	48 89 e5             	mov    %rsp,%rbp
+  802ebb:	41 57                	push   %r15
+  802ebd:	41 56                	push   %r14
+  802ebf:	41 55                	push   %r13
+  802ec1:	41 54                	push   %r12
+  802ec3:	53                   	push   %rbx
+  802ec4:	48 83 ec 18          	sub    $0x18,%rsp
+  802ec8:	49 89 fc             	mov    %rdi,%r12
+  802ecb:	49 89 f5             	mov    %rsi,%r13
+  802ece:	49 89 d7             	mov    %rdx,%r15
+  802ed1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ed5:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802ee1:	4d 85 ff             	test   %r15,%r15
+  802ee4:	0f 84 af 00 00 00    	je     802f99 <devpipe_write+0xe2>
+  802eea:	48 89 c3             	mov    %rax,%rbx
+  802eed:	4c 89 f8             	mov    %r15,%rax
+  802ef0:	4d 89 ef             	mov    %r13,%r15
+  802ef3:	4c 01 e8             	add    %r13,%rax
+  802ef6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802efa:	49 bd 98 11 80 00 00 	movabs $0x801198,%r13
+  802f01:	00 00 00 
+            sys_yield();
+  802f04:	49 be 35 11 80 00 00 	movabs $0x801135,%r14
+  802f0b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f0e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f11:	48 63 ce             	movslq %esi,%rcx
+  802f14:	48 63 03             	movslq (%rbx),%rax
+  802f17:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f1d:	48 39 c1             	cmp    %rax,%rcx
+  802f20:	72 2e                	jb     802f50 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f22:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f27:	48 89 da             	mov    %rbx,%rdx
+  802f2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f2f:	4c 89 e7             	mov    %r12,%rdi
+  802f32:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f35:	85 c0                	test   %eax,%eax
+  802f37:	74 66                	je     802f9f <devpipe_write+0xe8>
+            sys_yield();
+  802f39:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f3c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f3f:	48 63 ce             	movslq %esi,%rcx
+  802f42:	48 63 03             	movslq (%rbx),%rax
+  802f45:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f4b:	48 39 c1             	cmp    %rax,%rcx
+  802f4e:	73 d2                	jae    802f22 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f50:	41 0f b6 3f          	movzbl (%r15),%edi
+  802f54:	48 89 ca             	mov    %rcx,%rdx
+  802f57:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f5b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f62:	08 10 20 
+  802f65:	48 f7 e2             	mul    %rdx
+  802f68:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f6c:	48 89 d0             	mov    %rdx,%rax
+  802f6f:	48 c1 e0 09          	shl    $0x9,%rax
+  802f73:	48 29 d0             	sub    %rdx,%rax
+  802f76:	48 c1 e0 03          	shl    $0x3,%rax
+  802f7a:	48 29 c1             	sub    %rax,%rcx
+  802f7d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802f82:	83 c6 01             	add    $0x1,%esi
+  802f85:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f88:	49 83 c7 01          	add    $0x1,%r15
+  802f8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f90:	49 39 c7             	cmp    %rax,%r15
+  802f93:	0f 85 75 ff ff ff    	jne    802f0e <devpipe_write+0x57>
+    return n;
+  802f99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f9d:	eb 05                	jmp    802fa4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fa4:	48 83 c4 18          	add    $0x18,%rsp
+  802fa8:	5b                   	pop    %rbx
+  802fa9:	41 5c                	pop    %r12
+  802fab:	41 5d                	pop    %r13
+  802fad:	41 5e                	pop    %r14
+  802faf:	41 5f                	pop    %r15
+  802fb1:	5d                   	pop    %rbp
+  802fb2:	c3                   	ret
+
+0000000000802fb3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fb3:	55                   	push   %rbp
+  802fb4:	48 89 e5             	mov    %rsp,%rbp
+  802fb7:	41 57                	push   %r15
+  802fb9:	41 56                	push   %r14
+  802fbb:	41 55                	push   %r13
+  802fbd:	41 54                	push   %r12
+  802fbf:	53                   	push   %rbx
+  802fc0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fc4:	49 89 fc             	mov    %rdi,%r12
+  802fc7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fcf:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  802fd6:	00 00 00 
+  802fd9:	ff d0                	call   *%rax
+  802fdb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802fde:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fe4:	49 bd 98 11 80 00 00 	movabs $0x801198,%r13
+  802feb:	00 00 00 
+            sys_yield();
+  802fee:	49 be 35 11 80 00 00 	movabs $0x801135,%r14
+  802ff5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ff8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ffd:	74 7d                	je     80307c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802fff:	8b 03                	mov    (%rbx),%eax
+  803001:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803004:	75 26                	jne    80302c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803006:	4d 85 ff             	test   %r15,%r15
+  803009:	75 77                	jne    803082 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80300b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803010:	48 89 da             	mov    %rbx,%rdx
+  803013:	be 00 10 00 00       	mov    $0x1000,%esi
+  803018:	4c 89 e7             	mov    %r12,%rdi
+  80301b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80301e:	85 c0                	test   %eax,%eax
+  803020:	74 72                	je     803094 <devpipe_read+0xe1>
+            sys_yield();
+  803022:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803025:	8b 03                	mov    (%rbx),%eax
+  803027:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80302a:	74 df                	je     80300b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80302c:	48 63 c8             	movslq %eax,%rcx
+  80302f:	48 89 ca             	mov    %rcx,%rdx
+  803032:	48 c1 ea 03          	shr    $0x3,%rdx
+  803036:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80303d:	08 10 20 
+  803040:	48 89 d0             	mov    %rdx,%rax
+  803043:	48 f7 e6             	mul    %rsi
+  803046:	48 c1 ea 06          	shr    $0x6,%rdx
+  80304a:	48 89 d0             	mov    %rdx,%rax
+  80304d:	48 c1 e0 09          	shl    $0x9,%rax
+  803051:	48 29 d0             	sub    %rdx,%rax
+  803054:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80305b:	00 
+  80305c:	48 89 c8             	mov    %rcx,%rax
+  80305f:	48 29 d0             	sub    %rdx,%rax
+  803062:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803067:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80306b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80306f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803072:	49 83 c7 01          	add    $0x1,%r15
+  803076:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80307a:	75 83                	jne    802fff <devpipe_read+0x4c>
+    return n;
+  80307c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803080:	eb 03                	jmp    803085 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803082:	4c 89 f8             	mov    %r15,%rax
+}
+  803085:	48 83 c4 18          	add    $0x18,%rsp
+  803089:	5b                   	pop    %rbx
+  80308a:	41 5c                	pop    %r12
+  80308c:	41 5d                	pop    %r13
+  80308e:	41 5e                	pop    %r14
+  803090:	41 5f                	pop    %r15
+  803092:	5d                   	pop    %rbp
+  803093:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803094:	b8 00 00 00 00       	mov    $0x0,%eax
+  803099:	eb ea                	jmp    803085 <devpipe_read+0xd2>
+
+000000000080309b <pipe>:
+pipe(int pfd[2]) {
+  80309b:	55                   	push   %rbp
+  80309c:	48 89 e5             	mov    %rsp,%rbp
+  80309f:	41 55                	push   %r13
+  8030a1:	41 54                	push   %r12
+  8030a3:	53                   	push   %rbx
+  8030a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8030a8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030ab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030af:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8030b6:	00 00 00 
+  8030b9:	ff d0                	call   *%rax
+  8030bb:	89 c3                	mov    %eax,%ebx
+  8030bd:	85 c0                	test   %eax,%eax
+  8030bf:	0f 88 a0 01 00 00    	js     803265 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030c5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030cf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d8:	48 b8 c4 11 80 00 00 	movabs $0x8011c4,%rax
+  8030df:	00 00 00 
+  8030e2:	ff d0                	call   *%rax
+  8030e4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	0f 88 77 01 00 00    	js     803265 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030ee:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8030f2:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+  8030fe:	89 c3                	mov    %eax,%ebx
+  803100:	85 c0                	test   %eax,%eax
+  803102:	0f 88 43 01 00 00    	js     80324b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803108:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80310d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803112:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311b:	48 b8 c4 11 80 00 00 	movabs $0x8011c4,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+  803127:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	0f 88 1a 01 00 00    	js     80324b <pipe+0x1b0>
+    va = fd2data(fd0);
+  803131:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803135:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  80313c:	00 00 00 
+  80313f:	ff d0                	call   *%rax
+  803141:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803144:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803149:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80314e:	48 89 c6             	mov    %rax,%rsi
+  803151:	bf 00 00 00 00       	mov    $0x0,%edi
+  803156:	48 b8 c4 11 80 00 00 	movabs $0x8011c4,%rax
+  80315d:	00 00 00 
+  803160:	ff d0                	call   *%rax
+  803162:	89 c3                	mov    %eax,%ebx
+  803164:	85 c0                	test   %eax,%eax
+  803166:	0f 88 c5 00 00 00    	js     803231 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80316c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803170:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  803177:	00 00 00 
+  80317a:	ff d0                	call   *%rax
+  80317c:	48 89 c1             	mov    %rax,%rcx
+  80317f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803185:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80318b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803190:	4c 89 ee             	mov    %r13,%rsi
+  803193:	bf 00 00 00 00       	mov    $0x0,%edi
+  803198:	48 b8 2b 12 80 00 00 	movabs $0x80122b,%rax
+  80319f:	00 00 00 
+  8031a2:	ff d0                	call   *%rax
+  8031a4:	89 c3                	mov    %eax,%ebx
+  8031a6:	85 c0                	test   %eax,%eax
+  8031a8:	78 6e                	js     803218 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031aa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031af:	4c 89 ef             	mov    %r13,%rdi
+  8031b2:	48 b8 66 11 80 00 00 	movabs $0x801166,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+  8031be:	83 f8 02             	cmp    $0x2,%eax
+  8031c1:	0f 85 ab 00 00 00    	jne    803272 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031c7:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8031ce:	00 00 
+  8031d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031d4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031da:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031e1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031e5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031f2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031f6:	48 bb 61 18 80 00 00 	movabs $0x801861,%rbx
+  8031fd:	00 00 00 
+  803200:	ff d3                	call   *%rbx
+  803202:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803206:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80320a:	ff d3                	call   *%rbx
+  80320c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803216:	eb 4d                	jmp    803265 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803218:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80321d:	4c 89 ee             	mov    %r13,%rsi
+  803220:	bf 00 00 00 00       	mov    $0x0,%edi
+  803225:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803231:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803236:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80323a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323f:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  803246:	00 00 00 
+  803249:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80324b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803250:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803254:	bf 00 00 00 00       	mov    $0x0,%edi
+  803259:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  803260:	00 00 00 
+  803263:	ff d0                	call   *%rax
+}
+  803265:	89 d8                	mov    %ebx,%eax
+  803267:	48 83 c4 18          	add    $0x18,%rsp
+  80326b:	5b                   	pop    %rbx
+  80326c:	41 5c                	pop    %r12
+  80326e:	41 5d                	pop    %r13
+  803270:	5d                   	pop    %rbp
+  803271:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803272:	48 b9 98 40 80 00 00 	movabs $0x804098,%rcx
+  803279:	00 00 00 
+  80327c:	48 ba a8 3f 80 00 00 	movabs $0x803fa8,%rdx
+  803283:	00 00 00 
+  803286:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80328b:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  803292:	00 00 00 
+  803295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329a:	49 b8 f2 36 80 00 00 	movabs $0x8036f2,%r8
+  8032a1:	00 00 00 
+  8032a4:	41 ff d0             	call   *%r8
+
+00000000008032a7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032a7:	55                   	push   %rbp
+  8032a8:	48 89 e5             	mov    %rsp,%rbp
+  8032ab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032af:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032b3:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8032ba:	00 00 00 
+  8032bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032bf:	85 c0                	test   %eax,%eax
+  8032c1:	78 35                	js     8032f8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032c3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032c7:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+  8032d3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032d6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032e4:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	0f 94 c0             	sete   %al
+  8032f5:	0f b6 c0             	movzbl %al,%eax
+}
+  8032f8:	c9                   	leave
+  8032f9:	c3                   	ret
+
+00000000008032fa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032fa:	48 89 f8             	mov    %rdi,%rax
+  8032fd:	48 c1 e8 27          	shr    $0x27,%rax
+  803301:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803308:	01 00 00 
+  80330b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80330f:	f6 c2 01             	test   $0x1,%dl
+  803312:	74 6d                	je     803381 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803314:	48 89 f8             	mov    %rdi,%rax
+  803317:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80331b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803322:	01 00 00 
+  803325:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803329:	f6 c2 01             	test   $0x1,%dl
+  80332c:	74 62                	je     803390 <get_uvpt_entry+0x96>
+  80332e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803335:	01 00 00 
+  803338:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80333c:	f6 c2 80             	test   $0x80,%dl
+  80333f:	75 4f                	jne    803390 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803341:	48 89 f8             	mov    %rdi,%rax
+  803344:	48 c1 e8 15          	shr    $0x15,%rax
+  803348:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80334f:	01 00 00 
+  803352:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803356:	f6 c2 01             	test   $0x1,%dl
+  803359:	74 44                	je     80339f <get_uvpt_entry+0xa5>
+  80335b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803362:	01 00 00 
+  803365:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803369:	f6 c2 80             	test   $0x80,%dl
+  80336c:	75 31                	jne    80339f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80336e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803372:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803379:	01 00 00 
+  80337c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803380:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803381:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803388:	01 00 00 
+  80338b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80338f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803390:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803397:	01 00 00 
+  80339a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80339e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80339f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8033a6:	01 00 00 
+  8033a9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033ad:	c3                   	ret
+
+00000000008033ae <get_prot>:
+
+int
+get_prot(void *va) {
+  8033ae:	55                   	push   %rbp
+  8033af:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033b2:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+  8033be:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8033c1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8033c6:	89 c1                	mov    %eax,%ecx
+  8033c8:	83 c9 04             	or     $0x4,%ecx
+  8033cb:	f6 c2 01             	test   $0x1,%dl
+  8033ce:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8033d1:	89 c1                	mov    %eax,%ecx
+  8033d3:	83 c9 02             	or     $0x2,%ecx
+  8033d6:	f6 c2 02             	test   $0x2,%dl
+  8033d9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8033dc:	89 c1                	mov    %eax,%ecx
+  8033de:	83 c9 01             	or     $0x1,%ecx
+  8033e1:	48 85 d2             	test   %rdx,%rdx
+  8033e4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8033e7:	89 c1                	mov    %eax,%ecx
+  8033e9:	83 c9 40             	or     $0x40,%ecx
+  8033ec:	f6 c6 04             	test   $0x4,%dh
+  8033ef:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8033f2:	5d                   	pop    %rbp
+  8033f3:	c3                   	ret
+
+00000000008033f4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8033f4:	55                   	push   %rbp
+  8033f5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033f8:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803404:	48 c1 e8 06          	shr    $0x6,%rax
+  803408:	83 e0 01             	and    $0x1,%eax
+}
+  80340b:	5d                   	pop    %rbp
+  80340c:	c3                   	ret
+
+000000000080340d <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80340d:	55                   	push   %rbp
+  80340e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803411:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80341d:	48 c1 e8 05          	shr    $0x5,%rax
+  803421:	83 e0 01             	and    $0x1,%eax
+}
+  803424:	5d                   	pop    %rbp
+  803425:	c3                   	ret
+
+0000000000803426 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803426:	55                   	push   %rbp
+  803427:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80342a:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+  803436:	83 e0 01             	and    $0x1,%eax
+}
+  803439:	5d                   	pop    %rbp
+  80343a:	c3                   	ret
+
+000000000080343b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80343b:	55                   	push   %rbp
+  80343c:	48 89 e5             	mov    %rsp,%rbp
+  80343f:	41 57                	push   %r15
+  803441:	41 56                	push   %r14
+  803443:	41 55                	push   %r13
+  803445:	41 54                	push   %r12
+  803447:	53                   	push   %rbx
+  803448:	48 83 ec 18          	sub    $0x18,%rsp
+  80344c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803450:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803454:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803459:	49 bd 26 34 80 00 00 	movabs $0x803426,%r13
+  803460:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803463:	49 bf ae 33 80 00 00 	movabs $0x8033ae,%r15
+  80346a:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80346d:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803474:	00 00 00 
+  803477:	eb 0c                	jmp    803485 <foreach_shared_region+0x4a>
+  803479:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803480:	4c 39 f3             	cmp    %r14,%rbx
+  803483:	74 2e                	je     8034b3 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803485:	48 89 df             	mov    %rbx,%rdi
+  803488:	41 ff d5             	call   *%r13
+  80348b:	84 c0                	test   %al,%al
+  80348d:	74 ea                	je     803479 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80348f:	48 89 df             	mov    %rbx,%rdi
+  803492:	41 ff d7             	call   *%r15
+  803495:	a8 40                	test   $0x40,%al
+  803497:	74 e0                	je     803479 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803499:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8034a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034a4:	48 89 df             	mov    %rbx,%rdi
+  8034a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ab:	ff d0                	call   *%rax
+				if (res < 0) {
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	79 c8                	jns    803479 <foreach_shared_region+0x3e>
+  8034b1:	eb 05                	jmp    8034b8 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8034b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b8:	48 83 c4 18          	add    $0x18,%rsp
+  8034bc:	5b                   	pop    %rbx
+  8034bd:	41 5c                	pop    %r12
+  8034bf:	41 5d                	pop    %r13
+  8034c1:	41 5e                	pop    %r14
+  8034c3:	41 5f                	pop    %r15
+  8034c5:	5d                   	pop    %rbp
+  8034c6:	c3                   	ret
+
+00000000008034c7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8034c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cc:	c3                   	ret
+
+00000000008034cd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8034cd:	55                   	push   %rbp
+  8034ce:	48 89 e5             	mov    %rsp,%rbp
+  8034d1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8034d4:	48 be bc 40 80 00 00 	movabs $0x8040bc,%rsi
+  8034db:	00 00 00 
+  8034de:	48 b8 38 0b 80 00 00 	movabs $0x800b38,%rax
+  8034e5:	00 00 00 
+  8034e8:	ff d0                	call   *%rax
+    return 0;
+}
+  8034ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ef:	5d                   	pop    %rbp
+  8034f0:	c3                   	ret
+
+00000000008034f1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034f1:	55                   	push   %rbp
+  8034f2:	48 89 e5             	mov    %rsp,%rbp
+  8034f5:	41 57                	push   %r15
+  8034f7:	41 56                	push   %r14
+  8034f9:	41 55                	push   %r13
+  8034fb:	41 54                	push   %r12
+  8034fd:	53                   	push   %rbx
+  8034fe:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803505:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80350c:	48 85 d2             	test   %rdx,%rdx
+  80350f:	74 7a                	je     80358b <devcons_write+0x9a>
+  803511:	49 89 d6             	mov    %rdx,%r14
+  803514:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80351a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80351f:	49 bf 32 0d 80 00 00 	movabs $0x800d32,%r15
+  803526:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803529:	4c 89 f3             	mov    %r14,%rbx
+  80352c:	48 29 f3             	sub    %rsi,%rbx
+  80352f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803534:	48 39 c3             	cmp    %rax,%rbx
+  803537:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80353b:	4c 63 eb             	movslq %ebx,%r13
+  80353e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803545:	48 01 c6             	add    %rax,%rsi
+  803548:	4c 89 ea             	mov    %r13,%rdx
+  80354b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803552:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803555:	4c 89 ee             	mov    %r13,%rsi
+  803558:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80355f:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80356b:	41 01 dc             	add    %ebx,%r12d
+  80356e:	49 63 f4             	movslq %r12d,%rsi
+  803571:	4c 39 f6             	cmp    %r14,%rsi
+  803574:	72 b3                	jb     803529 <devcons_write+0x38>
+    return res;
+  803576:	49 63 c4             	movslq %r12d,%rax
+}
+  803579:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803580:	5b                   	pop    %rbx
+  803581:	41 5c                	pop    %r12
+  803583:	41 5d                	pop    %r13
+  803585:	41 5e                	pop    %r14
+  803587:	41 5f                	pop    %r15
+  803589:	5d                   	pop    %rbp
+  80358a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80358b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803591:	eb e3                	jmp    803576 <devcons_write+0x85>
+
+0000000000803593 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803593:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80359b:	48 85 c0             	test   %rax,%rax
+  80359e:	74 55                	je     8035f5 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	41 55                	push   %r13
+  8035a6:	41 54                	push   %r12
+  8035a8:	53                   	push   %rbx
+  8035a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ad:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8035b0:	48 bb 68 10 80 00 00 	movabs $0x801068,%rbx
+  8035b7:	00 00 00 
+  8035ba:	49 bc 35 11 80 00 00 	movabs $0x801135,%r12
+  8035c1:	00 00 00 
+  8035c4:	eb 03                	jmp    8035c9 <devcons_read+0x36>
+  8035c6:	41 ff d4             	call   *%r12
+  8035c9:	ff d3                	call   *%rbx
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	74 f7                	je     8035c6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8035cf:	48 63 d0             	movslq %eax,%rdx
+  8035d2:	78 13                	js     8035e7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8035d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d9:	83 f8 04             	cmp    $0x4,%eax
+  8035dc:	74 09                	je     8035e7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8035de:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8035e2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8035e7:	48 89 d0             	mov    %rdx,%rax
+  8035ea:	48 83 c4 08          	add    $0x8,%rsp
+  8035ee:	5b                   	pop    %rbx
+  8035ef:	41 5c                	pop    %r12
+  8035f1:	41 5d                	pop    %r13
+  8035f3:	5d                   	pop    %rbp
+  8035f4:	c3                   	ret
+  8035f5:	48 89 d0             	mov    %rdx,%rax
+  8035f8:	c3                   	ret
+
+00000000008035f9 <cputchar>:
+cputchar(int ch) {
+  8035f9:	55                   	push   %rbp
+  8035fa:	48 89 e5             	mov    %rsp,%rbp
+  8035fd:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803601:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803605:	be 01 00 00 00       	mov    $0x1,%esi
+  80360a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80360e:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+}
+  80361a:	c9                   	leave
+  80361b:	c3                   	ret
+
+000000000080361c <getchar>:
+getchar(void) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+  803620:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803624:	ba 01 00 00 00       	mov    $0x1,%edx
+  803629:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80362d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803632:	48 b8 d2 1b 80 00 00 	movabs $0x801bd2,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+  80363e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803640:	85 c0                	test   %eax,%eax
+  803642:	78 06                	js     80364a <getchar+0x2e>
+  803644:	74 08                	je     80364e <getchar+0x32>
+  803646:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80364a:	89 d0                	mov    %edx,%eax
+  80364c:	c9                   	leave
+  80364d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80364e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803653:	eb f5                	jmp    80364a <getchar+0x2e>
+
+0000000000803655 <iscons>:
+iscons(int fdnum) {
+  803655:	55                   	push   %rbp
+  803656:	48 89 e5             	mov    %rsp,%rbp
+  803659:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80365d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803661:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80366d:	85 c0                	test   %eax,%eax
+  80366f:	78 18                	js     803689 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803671:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803675:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80367c:	00 00 00 
+  80367f:	8b 00                	mov    (%rax),%eax
+  803681:	39 02                	cmp    %eax,(%rdx)
+  803683:	0f 94 c0             	sete   %al
+  803686:	0f b6 c0             	movzbl %al,%eax
+}
+  803689:	c9                   	leave
+  80368a:	c3                   	ret
+
+000000000080368b <opencons>:
+opencons(void) {
+  80368b:	55                   	push   %rbp
+  80368c:	48 89 e5             	mov    %rsp,%rbp
+  80368f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803693:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803697:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  80369e:	00 00 00 
+  8036a1:	ff d0                	call   *%rax
+  8036a3:	85 c0                	test   %eax,%eax
+  8036a5:	78 49                	js     8036f0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8036a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036b1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8036b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ba:	48 b8 c4 11 80 00 00 	movabs $0x8011c4,%rax
+  8036c1:	00 00 00 
+  8036c4:	ff d0                	call   *%rax
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	78 26                	js     8036f0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8036ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036ce:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8036d5:	00 00 
+  8036d7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8036d9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036dd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8036e4:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  8036eb:	00 00 00 
+  8036ee:	ff d0                	call   *%rax
+}
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+00000000008036f2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	41 56                	push   %r14
+  8036f8:	41 55                	push   %r13
+  8036fa:	41 54                	push   %r12
+  8036fc:	53                   	push   %rbx
+  8036fd:	48 83 ec 50          	sub    $0x50,%rsp
+  803701:	49 89 fc             	mov    %rdi,%r12
+  803704:	41 89 f5             	mov    %esi,%r13d
+  803707:	48 89 d3             	mov    %rdx,%rbx
+  80370a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80370e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803712:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803716:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80371d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803721:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803725:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803729:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80372d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803734:	00 00 00 
+  803737:	4c 8b 30             	mov    (%rax),%r14
+  80373a:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  803741:	00 00 00 
+  803744:	ff d0                	call   *%rax
+  803746:	89 c6                	mov    %eax,%esi
+  803748:	45 89 e8             	mov    %r13d,%r8d
+  80374b:	4c 89 e1             	mov    %r12,%rcx
+  80374e:	4c 89 f2             	mov    %r14,%rdx
+  803751:	48 bf c8 40 80 00 00 	movabs $0x8040c8,%rdi
+  803758:	00 00 00 
+  80375b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803760:	49 bc 13 02 80 00 00 	movabs $0x800213,%r12
+  803767:	00 00 00 
+  80376a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80376d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803771:	48 89 df             	mov    %rbx,%rdi
+  803774:	48 b8 af 01 80 00 00 	movabs $0x8001af,%rax
+  80377b:	00 00 00 
+  80377e:	ff d0                	call   *%rax
+    cprintf("\n");
+  803780:	48 bf 3b 40 80 00 00 	movabs $0x80403b,%rdi
+  803787:	00 00 00 
+  80378a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803792:	cc                   	int3
+  803793:	eb fd                	jmp    803792 <_panic+0xa0>
+
+0000000000803795 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803795:	55                   	push   %rbp
+  803796:	48 89 e5             	mov    %rsp,%rbp
+  803799:	41 55                	push   %r13
+  80379b:	41 54                	push   %r12
+  80379d:	53                   	push   %rbx
+  80379e:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a2:	49 89 fc             	mov    %rdi,%r12
+  8037a5:	48 89 f7             	mov    %rsi,%rdi
+  8037a8:	48 89 d3             	mov    %rdx,%rbx
+  8037ab:	49 89 cd             	mov    %rcx,%r13
+  8037ae:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8037b1:	48 85 f6             	test   %rsi,%rsi
+  8037b4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037bb:	00 00 00 
+  8037be:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8037c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037c7:	48 85 db             	test   %rbx,%rbx
+  8037ca:	74 03                	je     8037cf <ipc_recv_timed+0x3a>
+  8037cc:	48 8b 33             	mov    (%rbx),%rsi
+  8037cf:	48 b8 5e 14 80 00 00 	movabs $0x80145e,%rax
+  8037d6:	00 00 00 
+  8037d9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	78 75                	js     803854 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8037df:	4d 85 e4             	test   %r12,%r12
+  8037e2:	74 14                	je     8037f8 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8037e4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037eb:	00 00 00 
+  8037ee:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8037f4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8037f8:	4d 85 ed             	test   %r13,%r13
+  8037fb:	74 14                	je     803811 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8037fd:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803804:	00 00 00 
+  803807:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80380d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803811:	48 85 db             	test   %rbx,%rbx
+  803814:	74 23                	je     803839 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803816:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80381d:	00 00 00 
+  803820:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80382b:	85 c9                	test   %ecx,%ecx
+  80382d:	74 07                	je     803836 <ipc_recv_timed+0xa1>
+  80382f:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803836:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803839:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803840:	00 00 00 
+  803843:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803849:	48 83 c4 08          	add    $0x8,%rsp
+  80384d:	5b                   	pop    %rbx
+  80384e:	41 5c                	pop    %r12
+  803850:	41 5d                	pop    %r13
+  803852:	5d                   	pop    %rbp
+  803853:	c3                   	ret
+        if (from_env_store != NULL) {
+  803854:	4d 85 e4             	test   %r12,%r12
+  803857:	74 08                	je     803861 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803859:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803860:	00 
+        if (perm_store != NULL) {
+  803861:	4d 85 ed             	test   %r13,%r13
+  803864:	74 08                	je     80386e <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803866:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80386d:	00 
+        if (size != NULL) {
+  80386e:	48 85 db             	test   %rbx,%rbx
+  803871:	74 d6                	je     803849 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803873:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80387a:	eb cd                	jmp    803849 <ipc_recv_timed+0xb4>
+
+000000000080387c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80387c:	55                   	push   %rbp
+  80387d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803886:	48 b8 95 37 80 00 00 	movabs $0x803795,%rax
+  80388d:	00 00 00 
+  803890:	ff d0                	call   *%rax
+}
+  803892:	5d                   	pop    %rbp
+  803893:	c3                   	ret
+
+0000000000803894 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803894:	55                   	push   %rbp
+  803895:	48 89 e5             	mov    %rsp,%rbp
+  803898:	41 57                	push   %r15
+  80389a:	41 56                	push   %r14
+  80389c:	41 55                	push   %r13
+  80389e:	41 54                	push   %r12
+  8038a0:	53                   	push   %rbx
+  8038a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a5:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8038a8:	48 89 d3             	mov    %rdx,%rbx
+  8038ab:	49 89 cc             	mov    %rcx,%r12
+  8038ae:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038b1:	48 85 d2             	test   %rdx,%rdx
+  8038b4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038bb:	00 00 00 
+  8038be:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038c2:	89 f0                	mov    %esi,%eax
+  8038c4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038c8:	48 89 da             	mov    %rbx,%rdx
+  8038cb:	48 89 c6             	mov    %rax,%rsi
+  8038ce:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8038d5:	00 00 00 
+  8038d8:	ff d0                	call   *%rax
+    while (res < 0) {
+  8038da:	85 c0                	test   %eax,%eax
+  8038dc:	79 65                	jns    803943 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8038de:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038e1:	75 33                	jne    803916 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8038e3:	49 bf 35 11 80 00 00 	movabs $0x801135,%r15
+  8038ea:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038ed:	49 be 32 14 80 00 00 	movabs $0x801432,%r14
+  8038f4:	00 00 00 
+        sys_yield();
+  8038f7:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038fa:	45 89 e8             	mov    %r13d,%r8d
+  8038fd:	4c 89 e1             	mov    %r12,%rcx
+  803900:	48 89 da             	mov    %rbx,%rdx
+  803903:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803907:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80390a:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80390d:	85 c0                	test   %eax,%eax
+  80390f:	79 32                	jns    803943 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803911:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803914:	74 e1                	je     8038f7 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803916:	89 c1                	mov    %eax,%ecx
+  803918:	48 ba eb 40 80 00 00 	movabs $0x8040eb,%rdx
+  80391f:	00 00 00 
+  803922:	be 52 00 00 00       	mov    $0x52,%esi
+  803927:	48 bf ff 40 80 00 00 	movabs $0x8040ff,%rdi
+  80392e:	00 00 00 
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+  803936:	49 b8 f2 36 80 00 00 	movabs $0x8036f2,%r8
+  80393d:	00 00 00 
+  803940:	41 ff d0             	call   *%r8
+    }
+}
+  803943:	48 83 c4 18          	add    $0x18,%rsp
+  803947:	5b                   	pop    %rbx
+  803948:	41 5c                	pop    %r12
+  80394a:	41 5d                	pop    %r13
+  80394c:	41 5e                	pop    %r14
+  80394e:	41 5f                	pop    %r15
+  803950:	5d                   	pop    %rbp
+  803951:	c3                   	ret
+
+0000000000803952 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803952:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803957:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80395e:	00 00 00 
+  803961:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803965:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803969:	48 c1 e2 04          	shl    $0x4,%rdx
+  80396d:	48 01 ca             	add    %rcx,%rdx
+  803970:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803976:	39 fa                	cmp    %edi,%edx
+  803978:	74 12                	je     80398c <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80397a:	48 83 c0 01          	add    $0x1,%rax
+  80397e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803984:	75 db                	jne    803961 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803986:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80398b:	c3                   	ret
+            return envs[i].env_id;
+  80398c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803990:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803994:	48 c1 e2 04          	shl    $0x4,%rdx
+  803998:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80399f:	00 00 00 
+  8039a2:	48 01 d0             	add    %rdx,%rax
+  8039a5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8039ab:	c3                   	ret
+  8039ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008039b0 <__rodata_start>:
+  8039b0:	69 20 66 61 75 6c    	imul   $0x6c756166,(%rax),%esp
+  8039b6:	74 65                	je     803a1d <__rodata_start+0x6d>
+  8039b8:	64 20 61 74          	and    %ah,%fs:0x74(%rcx)
+  8039bc:	20 76 61             	and    %dh,0x61(%rsi)
+  8039bf:	20 25 6c 78 2c 20    	and    %ah,0x202c786c(%rip)        # 20acb231 <__bss_end+0x202c2231>
+  8039c5:	65 72 72             	gs jb  803a3a <__rodata_start+0x8a>
+  8039c8:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c804446 <__bss_end+0x3bffb446>
+  8039ce:	75 6e                	jne    803a3e <__rodata_start+0x8e>
+  8039d0:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8039d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039d5:	3e 00 30             	ds add %dh,(%rax)
+  8039d8:	31 32                	xor    %esi,(%rdx)
+  8039da:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8039e1:	41                   	rex.B
+  8039e2:	42                   	rex.X
+  8039e3:	43                   	rex.XB
+  8039e4:	44                   	rex.R
+  8039e5:	45                   	rex.RB
+  8039e6:	46 00 30             	rex.RX add %r14b,(%rax)
+  8039e9:	31 32                	xor    %esi,(%rdx)
+  8039eb:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8039f2:	61                   	(bad)
+  8039f3:	62 63 64 65 66       	(bad)
+  8039f8:	00 28                	add    %ch,(%rax)
+  8039fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039fb:	75 6c                	jne    803a69 <__rodata_start+0xb9>
+  8039fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8039fe:	29 00                	sub    %eax,(%rax)
+  803a00:	65 72 72             	gs jb  803a75 <__rodata_start+0xc5>
+  803a03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a04:	72 20                	jb     803a26 <__rodata_start+0x76>
+  803a06:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803a0b:	73 70                	jae    803a7d <__rodata_start+0xcd>
+  803a0d:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803a11:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803a18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a19:	72 00                	jb     803a1b <__rodata_start+0x6b>
+  803a1b:	62 61 64 20 65       	(bad)
+  803a20:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a21:	76 69                	jbe    803a8c <__rodata_start+0xdc>
+  803a23:	72 6f                	jb     803a94 <__rodata_start+0xe4>
+  803a25:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a26:	6d                   	insl   (%dx),%es:(%rdi)
+  803a27:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a29:	74 00                	je     803a2b <__rodata_start+0x7b>
+  803a2b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803a32:	20 70 61             	and    %dh,0x61(%rax)
+  803a35:	72 61                	jb     803a98 <__rodata_start+0xe8>
+  803a37:	6d                   	insl   (%dx),%es:(%rdi)
+  803a38:	65 74 65             	gs je  803aa0 <__rodata_start+0xf0>
+  803a3b:	72 00                	jb     803a3d <__rodata_start+0x8d>
+  803a3d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a3e:	75 74                	jne    803ab4 <__rodata_start+0x104>
+  803a40:	20 6f 66             	and    %ch,0x66(%rdi)
+  803a43:	20 6d 65             	and    %ch,0x65(%rbp)
+  803a46:	6d                   	insl   (%dx),%es:(%rdi)
+  803a47:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a48:	72 79                	jb     803ac3 <__rodata_start+0x113>
+  803a4a:	00 6f 75             	add    %ch,0x75(%rdi)
+  803a4d:	74 20                	je     803a6f <__rodata_start+0xbf>
+  803a4f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a50:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803a54:	76 69                	jbe    803abf <__rodata_start+0x10f>
+  803a56:	72 6f                	jb     803ac7 <__rodata_start+0x117>
+  803a58:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a59:	6d                   	insl   (%dx),%es:(%rdi)
+  803a5a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a5c:	74 73                	je     803ad1 <__rodata_start+0x121>
+  803a5e:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803a61:	72 72                	jb     803ad5 <__rodata_start+0x125>
+  803a63:	75 70                	jne    803ad5 <__rodata_start+0x125>
+  803a65:	74 65                	je     803acc <__rodata_start+0x11c>
+  803a67:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803a6c:	75 67                	jne    803ad5 <__rodata_start+0x125>
+  803a6e:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803a71:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a73:	00 73 65             	add    %dh,0x65(%rbx)
+  803a76:	67 6d                	insl   (%dx),%es:(%edi)
+  803a78:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a7a:	74 61                	je     803add <__rodata_start+0x12d>
+  803a7c:	74 69                	je     803ae7 <__rodata_start+0x137>
+  803a7e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a80:	20 66 61             	and    %ah,0x61(%rsi)
+  803a83:	75 6c                	jne    803af1 <__rodata_start+0x141>
+  803a85:	74 00                	je     803a87 <__rodata_start+0xd7>
+  803a87:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803a8e:	20 45 4c             	and    %al,0x4c(%rbp)
+  803a91:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803a95:	61                   	(bad)
+  803a96:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803a9b:	20 73 75             	and    %dh,0x75(%rbx)
+  803a9e:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803aa1:	73 79                	jae    803b1c <__rodata_start+0x16c>
+  803aa3:	73 74                	jae    803b19 <__rodata_start+0x169>
+  803aa5:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803aa7:	20 63 61             	and    %ah,0x61(%rbx)
+  803aaa:	6c                   	insb   (%dx),%es:(%rdi)
+  803aab:	6c                   	insb   (%dx),%es:(%rdi)
+  803aac:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803aaf:	74 72                	je     803b23 <__rodata_start+0x173>
+  803ab1:	79 20                	jns    803ad3 <__rodata_start+0x123>
+  803ab3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ab4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ab5:	74 20                	je     803ad7 <__rodata_start+0x127>
+  803ab7:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ab9:	75 6e                	jne    803b29 <__rodata_start+0x179>
+  803abb:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803abf:	76 20                	jbe    803ae1 <__rodata_start+0x131>
+  803ac1:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803ac8:	72 65                	jb     803b2f <__rodata_start+0x17f>
+  803aca:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803acd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ace:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803ad2:	65 78 70             	gs js  803b45 <__rodata_start+0x195>
+  803ad5:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803ada:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803add:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803ae1:	20 66 69             	and    %ah,0x69(%rsi)
+  803ae4:	6c                   	insb   (%dx),%es:(%rdi)
+  803ae5:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803ae9:	20 66 72             	and    %ah,0x72(%rsi)
+  803aec:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803af1:	61                   	(bad)
+  803af2:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803af5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803af7:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803afb:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803afe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b00:	20 6d 61             	and    %ch,0x61(%rbp)
+  803b03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b04:	79 20                	jns    803b26 <__rodata_start+0x176>
+  803b06:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803b0d:	72 65                	jb     803b74 <__rodata_start+0x1c4>
+  803b0f:	20 6f 70             	and    %ch,0x70(%rdi)
+  803b12:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b14:	00 66 69             	add    %ah,0x69(%rsi)
+  803b17:	6c                   	insb   (%dx),%es:(%rdi)
+  803b18:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803b1c:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803b1f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b20:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803b23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b25:	74 20                	je     803b47 <__rodata_start+0x197>
+  803b27:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b29:	75 6e                	jne    803b99 <__rodata_start+0x1e9>
+  803b2b:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803b2f:	76 61                	jbe    803b92 <__rodata_start+0x1e2>
+  803b31:	6c                   	insb   (%dx),%es:(%rdi)
+  803b32:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803b39:	00 
+  803b3a:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803b41:	72 65                	jb     803ba8 <__rodata_start+0x1f8>
+  803b43:	61                   	(bad)
+  803b44:	64 79 20             	fs jns 803b67 <__rodata_start+0x1b7>
+  803b47:	65 78 69             	gs js  803bb3 <__rodata_start+0x203>
+  803b4a:	73 74                	jae    803bc0 <__rodata_start+0x210>
+  803b4c:	73 00                	jae    803b4e <__rodata_start+0x19e>
+  803b4e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b4f:	70 65                	jo     803bb6 <__rodata_start+0x206>
+  803b51:	72 61                	jb     803bb4 <__rodata_start+0x204>
+  803b53:	74 69                	je     803bbe <__rodata_start+0x20e>
+  803b55:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b57:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803b5a:	74 20                	je     803b7c <__rodata_start+0x1cc>
+  803b5c:	73 75                	jae    803bd3 <__rodata_start+0x223>
+  803b5e:	70 70                	jo     803bd0 <__rodata_start+0x220>
+  803b60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b61:	72 74                	jb     803bd7 <__rodata_start+0x227>
+  803b63:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803b69:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803b6e:	74 00                	je     803b70 <__rodata_start+0x1c0>
+  803b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803b77:	00 00 00 
+  803b7a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  803b80:	00 04 80             	add    %al,(%rax,%rax,4)
+  803b83:	00 00                	add    %al,(%rax)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 41 0a             	add    %al,0xa(%rcx)
+  803b8a:	80 00 00             	addb   $0x0,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 31                	add    %dh,(%rcx)
+  803b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b97:	00 41 0a             	add    %al,0xa(%rcx)
+  803b9a:	80 00 00             	addb   $0x0,(%rax)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 41 0a             	add    %al,0xa(%rcx)
+  803ba2:	80 00 00             	addb   $0x0,(%rax)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 41 0a             	add    %al,0xa(%rcx)
+  803baa:	80 00 00             	addb   $0x0,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 41 0a             	add    %al,0xa(%rcx)
+  803bb2:	80 00 00             	addb   $0x0,(%rax)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 1f                	add    %bl,(%rdi)
+  803bb9:	04 80                	add    $0x80,%al
+  803bbb:	00 00                	add    %al,(%rax)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 41 0a             	add    %al,0xa(%rcx)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 41 0a             	add    %al,0xa(%rcx)
+  803bca:	80 00 00             	addb   $0x0,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 13                	add    %dl,(%rbx)
+  803bd1:	04 80                	add    $0x80,%al
+  803bd3:	00 00                	add    %al,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 8d 04 80 00 00    	add    %cl,0x8004(%rbp)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 41 0a             	add    %al,0xa(%rcx)
+  803be2:	80 00 00             	addb   $0x0,(%rax)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 13                	add    %dl,(%rbx)
+  803be9:	04 80                	add    $0x80,%al
+  803beb:	00 00                	add    %al,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 59 04             	add    %bl,0x4(%rcx)
+  803bf2:	80 00 00             	addb   $0x0,(%rax)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 59 04             	add    %bl,0x4(%rcx)
+  803bfa:	80 00 00             	addb   $0x0,(%rax)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 59 04             	add    %bl,0x4(%rcx)
+  803c02:	80 00 00             	addb   $0x0,(%rax)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 59 04             	add    %bl,0x4(%rcx)
+  803c0a:	80 00 00             	addb   $0x0,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 59 04             	add    %bl,0x4(%rcx)
+  803c12:	80 00 00             	addb   $0x0,(%rax)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 59 04             	add    %bl,0x4(%rcx)
+  803c1a:	80 00 00             	addb   $0x0,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 59 04             	add    %bl,0x4(%rcx)
+  803c22:	80 00 00             	addb   $0x0,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 59 04             	add    %bl,0x4(%rcx)
+  803c2a:	80 00 00             	addb   $0x0,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 59 04             	add    %bl,0x4(%rcx)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 41 0a             	add    %al,0xa(%rcx)
+  803c3a:	80 00 00             	addb   $0x0,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 41 0a             	add    %al,0xa(%rcx)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c52:	80 00 00             	addb   $0x0,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 41 0a             	add    %al,0xa(%rcx)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c62:	80 00 00             	addb   $0x0,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 41 0a             	add    %al,0xa(%rcx)
+  803c6a:	80 00 00             	addb   $0x0,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 41 0a             	add    %al,0xa(%rcx)
+  803c7a:	80 00 00             	addb   $0x0,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 41 0a             	add    %al,0xa(%rcx)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 41 0a             	add    %al,0xa(%rcx)
+  803c92:	80 00 00             	addb   $0x0,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 41 0a             	add    %al,0xa(%rcx)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 41 0a             	add    %al,0xa(%rcx)
+  803ca2:	80 00 00             	addb   $0x0,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 41 0a             	add    %al,0xa(%rcx)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 41 0a             	add    %al,0xa(%rcx)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 41 0a             	add    %al,0xa(%rcx)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 41 0a             	add    %al,0xa(%rcx)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 41 0a             	add    %al,0xa(%rcx)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 41 0a             	add    %al,0xa(%rcx)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 41 0a             	add    %al,0xa(%rcx)
+  803cda:	80 00 00             	addb   $0x0,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 41 0a             	add    %al,0xa(%rcx)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 41 0a             	add    %al,0xa(%rcx)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 41 0a             	add    %al,0xa(%rcx)
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 41 0a             	add    %al,0xa(%rcx)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 41 0a             	add    %al,0xa(%rcx)
+  803d02:	80 00 00             	addb   $0x0,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 41 0a             	add    %al,0xa(%rcx)
+  803d0a:	80 00 00             	addb   $0x0,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 41 0a             	add    %al,0xa(%rcx)
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d22:	80 00 00             	addb   $0x0,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 64 09 80          	add    %ah,-0x80(%rcx,%rcx,1)
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d32:	80 00 00             	addb   $0x0,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 41 0a             	add    %al,0xa(%rcx)
+  803d3a:	80 00 00             	addb   $0x0,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d42:	80 00 00             	addb   $0x0,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 41 0a             	add    %al,0xa(%rcx)
+  803d4a:	80 00 00             	addb   $0x0,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d52:	80 00 00             	addb   $0x0,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 41 0a             	add    %al,0xa(%rcx)
+  803d5a:	80 00 00             	addb   $0x0,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d62:	80 00 00             	addb   $0x0,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 41 0a             	add    %al,0xa(%rcx)
+  803d6a:	80 00 00             	addb   $0x0,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d72:	80 00 00             	addb   $0x0,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 41 0a             	add    %al,0xa(%rcx)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 b0 04 80 00 00    	add    %dh,0x8004(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 7f 06             	add    %bh,0x6(%rdi)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 41 0a             	add    %al,0xa(%rcx)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 41 0a             	add    %al,0xa(%rcx)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 41 0a             	add    %al,0xa(%rcx)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 41 0a             	add    %al,0xa(%rcx)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 df                	add    %bl,%bh
+  803db1:	04 80                	add    $0x80,%al
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 41 0a             	add    %al,0xa(%rcx)
+  803dba:	80 00 00             	addb   $0x0,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 41 0a             	add    %al,0xa(%rcx)
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 41 0a             	add    %al,0xa(%rcx)
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 41 0a             	add    %al,0xa(%rcx)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 27                	add    %ah,(%rdi)
+  803de1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803de7:	00 f1                	add    %dh,%cl
+  803de9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803def:	00 41 0a             	add    %al,0xa(%rcx)
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 41 0a             	add    %al,0xa(%rcx)
+  803dfa:	80 00 00             	addb   $0x0,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 76 05             	add    %dh,0x5(%rsi)
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 41 0a             	add    %al,0xa(%rcx)
+  803e0a:	80 00 00             	addb   $0x0,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 53 07             	add    %dl,0x7(%rbx)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 41 0a             	add    %al,0xa(%rcx)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 41 0a             	add    %al,0xa(%rcx)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 64 09 80          	add    %ah,-0x80(%rcx,%rcx,1)
+  803e2b:	00 00                	add    %al,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 41 0a             	add    %al,0xa(%rcx)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 09                	add    %cl,(%rcx)
+  803e39:	04 80                	add    $0x80,%al
+  803e3b:	00 00                	add    %al,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803e40 <error_string>:
+	...
+  803e48:	09 3a 80 00 00 00 00 00 1b 3a 80 00 00 00 00 00     .:.......:......
+  803e58:	2b 3a 80 00 00 00 00 00 3d 3a 80 00 00 00 00 00     +:......=:......
+  803e68:	4b 3a 80 00 00 00 00 00 5f 3a 80 00 00 00 00 00     K:......_:......
+  803e78:	74 3a 80 00 00 00 00 00 87 3a 80 00 00 00 00 00     t:.......:......
+  803e88:	99 3a 80 00 00 00 00 00 ad 3a 80 00 00 00 00 00     .:.......:......
+  803e98:	bd 3a 80 00 00 00 00 00 d0 3a 80 00 00 00 00 00     .:.......:......
+  803ea8:	e7 3a 80 00 00 00 00 00 fd 3a 80 00 00 00 00 00     .:.......:......
+  803eb8:	15 3b 80 00 00 00 00 00 2d 3b 80 00 00 00 00 00     .;......-;......
+  803ec8:	3a 3b 80 00 00 00 00 00 e8 3e 80 00 00 00 00 00     :;.......>......
+  803ed8:	4e 3b 80 00 00 00 00 00 66 3b 80 00 00 00 00 00     N;......f;......
+  803ee8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803ef8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803f08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803f18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803f28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803f38:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  803f48:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  803f58:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  803f68:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  803f78:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  803f88:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  803f98:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  803fa8:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  803fb8:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  803fc8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803fd8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803fe8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803ff8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804008:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804018:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804028:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804038:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804048:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804058:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804060 <devtab>:
+  804060:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804070:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804080:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804090:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8040a0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8040b0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8040c0:	73 3e 00 63 6f 6e 73 00 5b 25 30 38 78 5d 20 75     s>.cons.[%08x] u
+  8040d0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8040e0:	61 74 20 25 73 3a 25 64 3a 20 00 69 70 63 5f 73     at %s:%d: .ipc_s
+  8040f0:	65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 6c     end error: %i..l
+  804100:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  804110:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804120:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804130:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804140:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804150:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804160:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804170:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804180:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804190:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804200:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804210:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804220:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804230:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804240:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804250:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804260:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804270:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804280:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804290:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804300:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804310:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804320:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804330:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804340:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804350:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804360:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804370:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804380:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804390:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,7167 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be 7b 06 80 00 00 	movabs $0x80067b,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 b0 04 80 00 00 	movabs $0x8004b0,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800062:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800069:	00 00 00 
+  80006c:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800073:	00 00 00 
+  800076:	48 39 c2             	cmp    %rax,%rdx
+  800079:	73 17                	jae    800092 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007e:	49 89 c4             	mov    %rax,%r12
+  800081:	48 83 c3 08          	add    $0x8,%rbx
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	ff 53 f8             	call   *-0x8(%rbx)
+  80008d:	4c 39 e3             	cmp    %r12,%rbx
+  800090:	72 ef                	jb     800081 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800092:	48 b8 eb 01 80 00 00 	movabs $0x8001eb,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000a7:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000ab:	48 c1 e0 04          	shl    $0x4,%rax
+  8000af:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b6:	00 00 00 
+  8000b9:	48 01 d0             	add    %rdx,%rax
+  8000bc:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000c3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c6:	45 85 ed             	test   %r13d,%r13d
+  8000c9:	7e 0d                	jle    8000d8 <libmain+0x87>
+  8000cb:	49 8b 06             	mov    (%r14),%rax
+  8000ce:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000d5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d8:	4c 89 f6             	mov    %r14,%rsi
+  8000db:	44 89 ef             	mov    %r13d,%edi
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ea:	48 b8 ff 00 80 00 00 	movabs $0x8000ff,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+#endif
+}
+  8000f6:	5b                   	pop    %rbx
+  8000f7:	41 5c                	pop    %r12
+  8000f9:	41 5d                	pop    %r13
+  8000fb:	41 5e                	pop    %r14
+  8000fd:	5d                   	pop    %rbp
+  8000fe:	c3                   	ret
+
+00000000008000ff <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800103:	48 b8 ec 08 80 00 00 	movabs $0x8008ec,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800114:	48 b8 80 01 80 00 00 	movabs $0x800180,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	53                   	push   %rbx
+  800127:	48 89 fa             	mov    %rdi,%rdx
+  80012a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80012d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800137:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013c:	be 00 00 00 00       	mov    $0x0,%esi
+  800141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800147:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+
+000000000080014f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80014f:	55                   	push   %rbp
+  800150:	48 89 e5             	mov    %rsp,%rbp
+  800153:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800154:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800168:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80016d:	be 00 00 00 00       	mov    $0x0,%esi
+  800172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800178:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80017a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80017e:	c9                   	leave
+  80017f:	c3                   	ret
+
+0000000000800180 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800180:	55                   	push   %rbp
+  800181:	48 89 e5             	mov    %rsp,%rbp
+  800184:	53                   	push   %rbx
+  800185:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800189:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80018c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800191:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001ad:	48 85 c0             	test   %rax,%rax
+  8001b0:	7f 06                	jg     8001b8 <sys_env_destroy+0x38>
+}
+  8001b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b8:	49 89 c0             	mov    %rax,%r8
+  8001bb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001c0:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  8001c7:	00 00 00 
+  8001ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8001cf:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  8001d6:	00 00 00 
+  8001d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001de:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  8001e5:	00 00 00 
+  8001e8:	41 ff d1             	call   *%r9
+
+00000000008001eb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001eb:	55                   	push   %rbp
+  8001ec:	48 89 e5             	mov    %rsp,%rbp
+  8001ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800204:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800209:	be 00 00 00 00       	mov    $0x0,%esi
+  80020e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800214:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+000000000080021c <sys_yield>:
+
+void
+sys_yield(void) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800221:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800235:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023a:	be 00 00 00 00       	mov    $0x0,%esi
+  80023f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800245:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800247:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+000000000080024d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80024d:	55                   	push   %rbp
+  80024e:	48 89 e5             	mov    %rsp,%rbp
+  800251:	53                   	push   %rbx
+  800252:	48 89 fa             	mov    %rdi,%rdx
+  800255:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800258:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80025d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800264:	00 00 00 
+  800267:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026c:	be 00 00 00 00       	mov    $0x0,%esi
+  800271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800277:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+
+000000000080027f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80027f:	55                   	push   %rbp
+  800280:	48 89 e5             	mov    %rsp,%rbp
+  800283:	53                   	push   %rbx
+  800284:	49 89 f8             	mov    %rdi,%r8
+  800287:	48 89 d3             	mov    %rdx,%rbx
+  80028a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80028d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800292:	4c 89 c2             	mov    %r8,%rdx
+  800295:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800298:	be 00 00 00 00       	mov    $0x0,%esi
+  80029d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a9:	c9                   	leave
+  8002aa:	c3                   	ret
+
+00000000008002ab <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002ab:	55                   	push   %rbp
+  8002ac:	48 89 e5             	mov    %rsp,%rbp
+  8002af:	53                   	push   %rbx
+  8002b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b4:	89 f8                	mov    %edi,%eax
+  8002b6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b9:	48 63 f9             	movslq %ecx,%rdi
+  8002bc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002bf:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002c4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002d4:	48 85 c0             	test   %rax,%rax
+  8002d7:	7f 06                	jg     8002df <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002dd:	c9                   	leave
+  8002de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002df:	49 89 c0             	mov    %rax,%r8
+  8002e2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e7:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  8002ee:	00 00 00 
+  8002f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002f6:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  8002fd:	00 00 00 
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  80030c:	00 00 00 
+  80030f:	41 ff d1             	call   *%r9
+
+0000000000800312 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800312:	55                   	push   %rbp
+  800313:	48 89 e5             	mov    %rsp,%rbp
+  800316:	53                   	push   %rbx
+  800317:	48 83 ec 08          	sub    $0x8,%rsp
+  80031b:	89 f8                	mov    %edi,%eax
+  80031d:	49 89 f2             	mov    %rsi,%r10
+  800320:	48 89 cf             	mov    %rcx,%rdi
+  800323:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800326:	48 63 da             	movslq %edx,%rbx
+  800329:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80032c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800331:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800334:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800337:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800339:	48 85 c0             	test   %rax,%rax
+  80033c:	7f 06                	jg     800344 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80033e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800342:	c9                   	leave
+  800343:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800344:	49 89 c0             	mov    %rax,%r8
+  800347:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80034c:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  800353:	00 00 00 
+  800356:	be 26 00 00 00       	mov    $0x26,%esi
+  80035b:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  800362:	00 00 00 
+  800365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036a:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  800371:	00 00 00 
+  800374:	41 ff d1             	call   *%r9
+
+0000000000800377 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800377:	55                   	push   %rbp
+  800378:	48 89 e5             	mov    %rsp,%rbp
+  80037b:	53                   	push   %rbx
+  80037c:	48 83 ec 08          	sub    $0x8,%rsp
+  800380:	48 89 f1             	mov    %rsi,%rcx
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800386:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800389:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80038e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800393:	be 00 00 00 00       	mov    $0x0,%esi
+  800398:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80039e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003a0:	48 85 c0             	test   %rax,%rax
+  8003a3:	7f 06                	jg     8003ab <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a9:	c9                   	leave
+  8003aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ab:	49 89 c0             	mov    %rax,%r8
+  8003ae:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003b3:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  8003ba:	00 00 00 
+  8003bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8003c2:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  8003c9:	00 00 00 
+  8003cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d1:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  8003d8:	00 00 00 
+  8003db:	41 ff d1             	call   *%r9
+
+00000000008003de <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003de:	55                   	push   %rbp
+  8003df:	48 89 e5             	mov    %rsp,%rbp
+  8003e2:	53                   	push   %rbx
+  8003e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003e7:	48 63 ce             	movslq %esi,%rcx
+  8003ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ed:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800401:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800407:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800409:	48 85 c0             	test   %rax,%rax
+  80040c:	7f 06                	jg     800414 <sys_env_set_status+0x36>
+}
+  80040e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800414:	49 89 c0             	mov    %rax,%r8
+  800417:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80041c:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  800423:	00 00 00 
+  800426:	be 26 00 00 00       	mov    $0x26,%esi
+  80042b:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  800432:	00 00 00 
+  800435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043a:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  800441:	00 00 00 
+  800444:	41 ff d1             	call   *%r9
+
+0000000000800447 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	53                   	push   %rbx
+  80044c:	48 83 ec 08          	sub    $0x8,%rsp
+  800450:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800453:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800456:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80045b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800460:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800465:	be 00 00 00 00       	mov    $0x0,%esi
+  80046a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800470:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800472:	48 85 c0             	test   %rax,%rax
+  800475:	7f 06                	jg     80047d <sys_env_set_trapframe+0x36>
+}
+  800477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80047b:	c9                   	leave
+  80047c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80047d:	49 89 c0             	mov    %rax,%r8
+  800480:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800485:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  80048c:	00 00 00 
+  80048f:	be 26 00 00 00       	mov    $0x26,%esi
+  800494:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  80049b:	00 00 00 
+  80049e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a3:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  8004aa:	00 00 00 
+  8004ad:	41 ff d1             	call   *%r9
+
+00000000008004b0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004b0:	55                   	push   %rbp
+  8004b1:	48 89 e5             	mov    %rsp,%rbp
+  8004b4:	53                   	push   %rbx
+  8004b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004bf:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004db:	48 85 c0             	test   %rax,%rax
+  8004de:	7f 06                	jg     8004e6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8004e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e4:	c9                   	leave
+  8004e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e6:	49 89 c0             	mov    %rax,%r8
+  8004e9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004ee:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  8004f5:	00 00 00 
+  8004f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8004fd:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  800504:	00 00 00 
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  800513:	00 00 00 
+  800516:	41 ff d1             	call   *%r9
+
+0000000000800519 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800519:	55                   	push   %rbp
+  80051a:	48 89 e5             	mov    %rsp,%rbp
+  80051d:	53                   	push   %rbx
+  80051e:	89 f8                	mov    %edi,%eax
+  800520:	49 89 f1             	mov    %rsi,%r9
+  800523:	48 89 d3             	mov    %rdx,%rbx
+  800526:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800529:	49 63 f0             	movslq %r8d,%rsi
+  80052c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80052f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800534:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80053d:	cd 30                	int    $0x30
+}
+  80053f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800543:	c9                   	leave
+  800544:	c3                   	ret
+
+0000000000800545 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800545:	55                   	push   %rbp
+  800546:	48 89 e5             	mov    %rsp,%rbp
+  800549:	53                   	push   %rbx
+  80054a:	48 83 ec 08          	sub    $0x8,%rsp
+  80054e:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800551:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800554:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800559:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80055c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800561:	be 00 00 00 00       	mov    $0x0,%esi
+  800566:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80056c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80056e:	48 85 c0             	test   %rax,%rax
+  800571:	7f 06                	jg     800579 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800573:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800577:	c9                   	leave
+  800578:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800579:	49 89 c0             	mov    %rax,%r8
+  80057c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800581:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  800588:	00 00 00 
+  80058b:	be 26 00 00 00       	mov    $0x26,%esi
+  800590:	48 bf 97 39 80 00 00 	movabs $0x803997,%rdi
+  800597:	00 00 00 
+  80059a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059f:	49 b9 57 25 80 00 00 	movabs $0x802557,%r9
+  8005a6:	00 00 00 
+  8005a9:	41 ff d1             	call   *%r9
+
+00000000008005ac <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8005ac:	55                   	push   %rbp
+  8005ad:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b5:	48 b8 45 05 80 00 00 	movabs $0x800545,%rax
+  8005bc:	00 00 00 
+  8005bf:	ff d0                	call   *%rax
+}
+  8005c1:	5d                   	pop    %rbp
+  8005c2:	c3                   	ret
+
+00000000008005c3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005c3:	55                   	push   %rbp
+  8005c4:	48 89 e5             	mov    %rsp,%rbp
+  8005c7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ec:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f2:	c9                   	leave
+  8005f3:	c3                   	ret
+
+00000000008005f4 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005f4:	55                   	push   %rbp
+  8005f5:	48 89 e5             	mov    %rsp,%rbp
+  8005f8:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005f9:	48 63 ce             	movslq %esi,%rcx
+  8005fc:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  800600:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800605:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80060f:	be 00 00 00 00       	mov    $0x0,%esi
+  800614:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80061a:	cd 30                	int    $0x30
+}
+  80061c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800620:	c9                   	leave
+  800621:	c3                   	ret
+
+0000000000800622 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800622:	55                   	push   %rbp
+  800623:	48 89 e5             	mov    %rsp,%rbp
+  800626:	53                   	push   %rbx
+  800627:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80062a:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80062e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800633:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800638:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063d:	be 00 00 00 00       	mov    $0x0,%esi
+  800642:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800648:	cd 30                	int    $0x30
+}
+  80064a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064e:	c9                   	leave
+  80064f:	c3                   	ret
+
+0000000000800650 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800650:	55                   	push   %rbp
+  800651:	48 89 e5             	mov    %rsp,%rbp
+  800654:	53                   	push   %rbx
+  800655:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800658:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80065b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800660:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800663:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800668:	be 00 00 00 00       	mov    $0x0,%esi
+  80066d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800673:	cd 30                	int    $0x30
+}
+  800675:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800679:	c9                   	leave
+  80067a:	c3                   	ret
+
+000000000080067b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80067b:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80067e:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  800685:	00 00 00 
+    call *%rax
+  800688:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    popq %r15
+  80068a:	41 5f                	pop    %r15
+    popq %r15
+  80068c:	41 5f                	pop    %r15
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+    popq %r15
+  80068e:	41 5f                	pop    %r15
+    popq %r14
+  800690:	41 5e                	pop    %r14
+    popq %r13
+  800692:	41 5d                	pop    %r13
+    popq %r12
+  800694:	41 5c                	pop    %r12
+    popq %r11
+  800696:	41 5b                	pop    %r11
+    popq %r10
+  800698:	41 5a                	pop    %r10
+    popq %r9
+  80069a:	41 59                	pop    %r9
+    popq %r8
+  80069c:	41 58                	pop    %r8
+    popq %rsi
+  80069e:	5e                   	pop    %rsi
+    popq %rdi
+  80069f:	5f                   	pop    %rdi
+    popq %rbp
+  8006a0:	5d                   	pop    %rbp
+    popq %rdx
+  8006a1:	5a                   	pop    %rdx
+    popq %rcx
+  8006a2:	59                   	pop    %rcx
+    movq 32(%rsp), %rbx
+  8006a3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  8006a8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  8006ad:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  8006b1:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  8006b4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+    popq %rbx
+  8006b9:	5b                   	pop    %rbx
+    popq %rax
+  8006ba:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    pushq 8(%rsp)
+  8006bb:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  8006bf:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    movq 16(%rsp), %rsp
+  8006c0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+  8006c5:	c3                   	ret
+
+00000000008006c6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006c6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006cd:	ff ff ff 
+  8006d0:	48 01 f8             	add    %rdi,%rax
+  8006d3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006d7:	c3                   	ret
+
+00000000008006d8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006df:	ff ff ff 
+  8006e2:	48 01 f8             	add    %rdi,%rax
+  8006e5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006e9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ef:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006f3:	c3                   	ret
+
+00000000008006f4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006f4:	55                   	push   %rbp
+  8006f5:	48 89 e5             	mov    %rsp,%rbp
+  8006f8:	41 57                	push   %r15
+  8006fa:	41 56                	push   %r14
+  8006fc:	41 55                	push   %r13
+  8006fe:	41 54                	push   %r12
+  800700:	53                   	push   %rbx
+  800701:	48 83 ec 08          	sub    $0x8,%rsp
+  800705:	49 89 ff             	mov    %rdi,%r15
+  800708:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80070d:	49 bd 13 22 80 00 00 	movabs $0x802213,%r13
+  800714:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800717:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80071d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800720:	48 89 df             	mov    %rbx,%rdi
+  800723:	41 ff d5             	call   *%r13
+  800726:	83 e0 04             	and    $0x4,%eax
+  800729:	74 17                	je     800742 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80072b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800732:	4c 39 f3             	cmp    %r14,%rbx
+  800735:	75 e6                	jne    80071d <fd_alloc+0x29>
+  800737:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80073d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800742:	4d 89 27             	mov    %r12,(%r15)
+}
+  800745:	48 83 c4 08          	add    $0x8,%rsp
+  800749:	5b                   	pop    %rbx
+  80074a:	41 5c                	pop    %r12
+  80074c:	41 5d                	pop    %r13
+  80074e:	41 5e                	pop    %r14
+  800750:	41 5f                	pop    %r15
+  800752:	5d                   	pop    %rbp
+  800753:	c3                   	ret
+
+0000000000800754 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800754:	83 ff 1f             	cmp    $0x1f,%edi
+  800757:	77 39                	ja     800792 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800759:	55                   	push   %rbp
+  80075a:	48 89 e5             	mov    %rsp,%rbp
+  80075d:	41 54                	push   %r12
+  80075f:	53                   	push   %rbx
+  800760:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800763:	48 63 df             	movslq %edi,%rbx
+  800766:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80076d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800771:	48 89 df             	mov    %rbx,%rdi
+  800774:	48 b8 13 22 80 00 00 	movabs $0x802213,%rax
+  80077b:	00 00 00 
+  80077e:	ff d0                	call   *%rax
+  800780:	a8 04                	test   $0x4,%al
+  800782:	74 14                	je     800798 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800784:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800788:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80078d:	5b                   	pop    %rbx
+  80078e:	41 5c                	pop    %r12
+  800790:	5d                   	pop    %rbp
+  800791:	c3                   	ret
+        return -E_INVAL;
+  800792:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800797:	c3                   	ret
+        return -E_INVAL;
+  800798:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079d:	eb ee                	jmp    80078d <fd_lookup+0x39>
+
+000000000080079f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80079f:	55                   	push   %rbp
+  8007a0:	48 89 e5             	mov    %rsp,%rbp
+  8007a3:	41 54                	push   %r12
+  8007a5:	53                   	push   %rbx
+  8007a6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007a9:	48 b8 60 3a 80 00 00 	movabs $0x803a60,%rax
+  8007b0:	00 00 00 
+  8007b3:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8007ba:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007bd:	39 3b                	cmp    %edi,(%rbx)
+  8007bf:	74 47                	je     800808 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007c1:	48 83 c0 08          	add    $0x8,%rax
+  8007c5:	48 8b 18             	mov    (%rax),%rbx
+  8007c8:	48 85 db             	test   %rbx,%rbx
+  8007cb:	75 f0                	jne    8007bd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007cd:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8007d4:	00 00 00 
+  8007d7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007dd:	89 fa                	mov    %edi,%edx
+  8007df:	48 bf a8 39 80 00 00 	movabs $0x8039a8,%rdi
+  8007e6:	00 00 00 
+  8007e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ee:	48 b9 a7 26 80 00 00 	movabs $0x8026a7,%rcx
+  8007f5:	00 00 00 
+  8007f8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007ff:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800803:	5b                   	pop    %rbx
+  800804:	41 5c                	pop    %r12
+  800806:	5d                   	pop    %rbp
+  800807:	c3                   	ret
+            return 0;
+  800808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080d:	eb f0                	jmp    8007ff <dev_lookup+0x60>
+
+000000000080080f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80080f:	55                   	push   %rbp
+  800810:	48 89 e5             	mov    %rsp,%rbp
+  800813:	41 55                	push   %r13
+  800815:	41 54                	push   %r12
+  800817:	53                   	push   %rbx
+  800818:	48 83 ec 18          	sub    $0x18,%rsp
+  80081c:	48 89 fb             	mov    %rdi,%rbx
+  80081f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800822:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800829:	ff ff ff 
+  80082c:	48 01 df             	add    %rbx,%rdi
+  80082f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800833:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800837:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  80083e:	00 00 00 
+  800841:	ff d0                	call   *%rax
+  800843:	41 89 c5             	mov    %eax,%r13d
+  800846:	85 c0                	test   %eax,%eax
+  800848:	78 06                	js     800850 <fd_close+0x41>
+  80084a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80084e:	74 1a                	je     80086a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800850:	45 84 e4             	test   %r12b,%r12b
+  800853:	b8 00 00 00 00       	mov    $0x0,%eax
+  800858:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80085c:	44 89 e8             	mov    %r13d,%eax
+  80085f:	48 83 c4 18          	add    $0x18,%rsp
+  800863:	5b                   	pop    %rbx
+  800864:	41 5c                	pop    %r12
+  800866:	41 5d                	pop    %r13
+  800868:	5d                   	pop    %rbp
+  800869:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80086a:	8b 3b                	mov    (%rbx),%edi
+  80086c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800870:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800877:	00 00 00 
+  80087a:	ff d0                	call   *%rax
+  80087c:	41 89 c5             	mov    %eax,%r13d
+  80087f:	85 c0                	test   %eax,%eax
+  800881:	78 1b                	js     80089e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800883:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800887:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80088b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800891:	48 85 c0             	test   %rax,%rax
+  800894:	74 08                	je     80089e <fd_close+0x8f>
+  800896:	48 89 df             	mov    %rbx,%rdi
+  800899:	ff d0                	call   *%rax
+  80089b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80089e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008a3:	48 89 de             	mov    %rbx,%rsi
+  8008a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008ab:	48 b8 77 03 80 00 00 	movabs $0x800377,%rax
+  8008b2:	00 00 00 
+  8008b5:	ff d0                	call   *%rax
+    return res;
+  8008b7:	eb a3                	jmp    80085c <fd_close+0x4d>
+
+00000000008008b9 <close>:
+
+int
+close(int fdnum) {
+  8008b9:	55                   	push   %rbp
+  8008ba:	48 89 e5             	mov    %rsp,%rbp
+  8008bd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008c5:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  8008cc:	00 00 00 
+  8008cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008d1:	85 c0                	test   %eax,%eax
+  8008d3:	78 15                	js     8008ea <close+0x31>
+
+    return fd_close(fd, 1);
+  8008d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8008da:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008de:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  8008e5:	00 00 00 
+  8008e8:	ff d0                	call   *%rax
+}
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+00000000008008ec <close_all>:
+
+void
+close_all(void) {
+  8008ec:	55                   	push   %rbp
+  8008ed:	48 89 e5             	mov    %rsp,%rbp
+  8008f0:	41 54                	push   %r12
+  8008f2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f8:	49 bc b9 08 80 00 00 	movabs $0x8008b9,%r12
+  8008ff:	00 00 00 
+  800902:	89 df                	mov    %ebx,%edi
+  800904:	41 ff d4             	call   *%r12
+  800907:	83 c3 01             	add    $0x1,%ebx
+  80090a:	83 fb 20             	cmp    $0x20,%ebx
+  80090d:	75 f3                	jne    800902 <close_all+0x16>
+}
+  80090f:	5b                   	pop    %rbx
+  800910:	41 5c                	pop    %r12
+  800912:	5d                   	pop    %rbp
+  800913:	c3                   	ret
+
+0000000000800914 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800914:	55                   	push   %rbp
+  800915:	48 89 e5             	mov    %rsp,%rbp
+  800918:	41 57                	push   %r15
+  80091a:	41 56                	push   %r14
+  80091c:	41 55                	push   %r13
+  80091e:	41 54                	push   %r12
+  800920:	53                   	push   %rbx
+  800921:	48 83 ec 18          	sub    $0x18,%rsp
+  800925:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800928:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80092c:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800933:	00 00 00 
+  800936:	ff d0                	call   *%rax
+  800938:	89 c3                	mov    %eax,%ebx
+  80093a:	85 c0                	test   %eax,%eax
+  80093c:	0f 88 b8 00 00 00    	js     8009fa <dup+0xe6>
+    close(newfdnum);
+  800942:	44 89 e7             	mov    %r12d,%edi
+  800945:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  80094c:	00 00 00 
+  80094f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800951:	4d 63 ec             	movslq %r12d,%r13
+  800954:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80095b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80095f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800963:	4c 89 ff             	mov    %r15,%rdi
+  800966:	49 be d8 06 80 00 00 	movabs $0x8006d8,%r14
+  80096d:	00 00 00 
+  800970:	41 ff d6             	call   *%r14
+  800973:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800976:	4c 89 ef             	mov    %r13,%rdi
+  800979:	41 ff d6             	call   *%r14
+  80097c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80097f:	48 89 df             	mov    %rbx,%rdi
+  800982:	48 b8 13 22 80 00 00 	movabs $0x802213,%rax
+  800989:	00 00 00 
+  80098c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80098e:	a8 04                	test   $0x4,%al
+  800990:	74 2b                	je     8009bd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800992:	41 89 c1             	mov    %eax,%r9d
+  800995:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80099b:	4c 89 f1             	mov    %r14,%rcx
+  80099e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a3:	48 89 de             	mov    %rbx,%rsi
+  8009a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ab:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  8009b2:	00 00 00 
+  8009b5:	ff d0                	call   *%rax
+  8009b7:	89 c3                	mov    %eax,%ebx
+  8009b9:	85 c0                	test   %eax,%eax
+  8009bb:	78 4e                	js     800a0b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009bd:	4c 89 ff             	mov    %r15,%rdi
+  8009c0:	48 b8 13 22 80 00 00 	movabs $0x802213,%rax
+  8009c7:	00 00 00 
+  8009ca:	ff d0                	call   *%rax
+  8009cc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009cf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009d5:	4c 89 e9             	mov    %r13,%rcx
+  8009d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009dd:	4c 89 fe             	mov    %r15,%rsi
+  8009e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e5:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	89 c3                	mov    %eax,%ebx
+  8009f3:	85 c0                	test   %eax,%eax
+  8009f5:	78 14                	js     800a0b <dup+0xf7>
+
+    return newfdnum;
+  8009f7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009fa:	89 d8                	mov    %ebx,%eax
+  8009fc:	48 83 c4 18          	add    $0x18,%rsp
+  800a00:	5b                   	pop    %rbx
+  800a01:	41 5c                	pop    %r12
+  800a03:	41 5d                	pop    %r13
+  800a05:	41 5e                	pop    %r14
+  800a07:	41 5f                	pop    %r15
+  800a09:	5d                   	pop    %rbp
+  800a0a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a10:	4c 89 ee             	mov    %r13,%rsi
+  800a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a18:	49 bc 77 03 80 00 00 	movabs $0x800377,%r12
+  800a1f:	00 00 00 
+  800a22:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a2a:	4c 89 f6             	mov    %r14,%rsi
+  800a2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a32:	41 ff d4             	call   *%r12
+    return res;
+  800a35:	eb c3                	jmp    8009fa <dup+0xe6>
+
+0000000000800a37 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	41 56                	push   %r14
+  800a3d:	41 55                	push   %r13
+  800a3f:	41 54                	push   %r12
+  800a41:	53                   	push   %rbx
+  800a42:	48 83 ec 10          	sub    $0x10,%rsp
+  800a46:	89 fb                	mov    %edi,%ebx
+  800a48:	49 89 f4             	mov    %rsi,%r12
+  800a4b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a52:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800a59:	00 00 00 
+  800a5c:	ff d0                	call   *%rax
+  800a5e:	85 c0                	test   %eax,%eax
+  800a60:	78 4c                	js     800aae <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a62:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a66:	41 8b 3e             	mov    (%r14),%edi
+  800a69:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a6d:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800a74:	00 00 00 
+  800a77:	ff d0                	call   *%rax
+  800a79:	85 c0                	test   %eax,%eax
+  800a7b:	78 35                	js     800ab2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a7d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a81:	83 e0 03             	and    $0x3,%eax
+  800a84:	83 f8 01             	cmp    $0x1,%eax
+  800a87:	74 2d                	je     800ab6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a8d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a91:	48 85 c0             	test   %rax,%rax
+  800a94:	74 56                	je     800aec <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a96:	4c 89 ea             	mov    %r13,%rdx
+  800a99:	4c 89 e6             	mov    %r12,%rsi
+  800a9c:	4c 89 f7             	mov    %r14,%rdi
+  800a9f:	ff d0                	call   *%rax
+}
+  800aa1:	48 83 c4 10          	add    $0x10,%rsp
+  800aa5:	5b                   	pop    %rbx
+  800aa6:	41 5c                	pop    %r12
+  800aa8:	41 5d                	pop    %r13
+  800aaa:	41 5e                	pop    %r14
+  800aac:	5d                   	pop    %rbp
+  800aad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aae:	48 98                	cltq
+  800ab0:	eb ef                	jmp    800aa1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ab2:	48 98                	cltq
+  800ab4:	eb eb                	jmp    800aa1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ab6:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800abd:	00 00 00 
+  800ac0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800ac6:	89 da                	mov    %ebx,%edx
+  800ac8:	48 bf 09 3a 80 00 00 	movabs $0x803a09,%rdi
+  800acf:	00 00 00 
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad7:	48 b9 a7 26 80 00 00 	movabs $0x8026a7,%rcx
+  800ade:	00 00 00 
+  800ae1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ae3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800aea:	eb b5                	jmp    800aa1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800af3:	eb ac                	jmp    800aa1 <read+0x6a>
+
+0000000000800af5 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800af5:	55                   	push   %rbp
+  800af6:	48 89 e5             	mov    %rsp,%rbp
+  800af9:	41 56                	push   %r14
+  800afb:	41 55                	push   %r13
+  800afd:	41 54                	push   %r12
+  800aff:	53                   	push   %rbx
+  800b00:	48 83 ec 10          	sub    $0x10,%rsp
+  800b04:	89 fb                	mov    %edi,%ebx
+  800b06:	49 89 f4             	mov    %rsi,%r12
+  800b09:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b0c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b10:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800b17:	00 00 00 
+  800b1a:	ff d0                	call   *%rax
+  800b1c:	85 c0                	test   %eax,%eax
+  800b1e:	78 41                	js     800b61 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b20:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b24:	41 8b 3e             	mov    (%r14),%edi
+  800b27:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b2b:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800b32:	00 00 00 
+  800b35:	ff d0                	call   *%rax
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	78 35                	js     800b70 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800b3b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800b3f:	83 e0 03             	and    $0x3,%eax
+  800b42:	83 f8 01             	cmp    $0x1,%eax
+  800b45:	74 2d                	je     800b74 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b4b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b4f:	48 85 c0             	test   %rax,%rax
+  800b52:	74 56                	je     800baa <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800b54:	4c 89 ea             	mov    %r13,%rdx
+  800b57:	4c 89 e6             	mov    %r12,%rsi
+  800b5a:	4c 89 f7             	mov    %r14,%rdi
+  800b5d:	ff d0                	call   *%rax
+  800b5f:	eb 02                	jmp    800b63 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b61:	48 98                	cltq
+}
+  800b63:	48 83 c4 10          	add    $0x10,%rsp
+  800b67:	5b                   	pop    %rbx
+  800b68:	41 5c                	pop    %r12
+  800b6a:	41 5d                	pop    %r13
+  800b6c:	41 5e                	pop    %r14
+  800b6e:	5d                   	pop    %rbp
+  800b6f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b70:	48 98                	cltq
+  800b72:	eb ef                	jmp    800b63 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b74:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800b7b:	00 00 00 
+  800b7e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b84:	89 da                	mov    %ebx,%edx
+  800b86:	48 bf c8 39 80 00 00 	movabs $0x8039c8,%rdi
+  800b8d:	00 00 00 
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b95:	48 b9 a7 26 80 00 00 	movabs $0x8026a7,%rcx
+  800b9c:	00 00 00 
+  800b9f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ba1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800ba8:	eb b9                	jmp    800b63 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800baa:	4c 89 ea             	mov    %r13,%rdx
+  800bad:	4c 89 e6             	mov    %r12,%rsi
+  800bb0:	89 df                	mov    %ebx,%edi
+  800bb2:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  800bb9:	00 00 00 
+  800bbc:	ff d0                	call   *%rax
+  800bbe:	eb a3                	jmp    800b63 <readmap+0x6e>
+
+0000000000800bc0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800bc0:	55                   	push   %rbp
+  800bc1:	48 89 e5             	mov    %rsp,%rbp
+  800bc4:	41 57                	push   %r15
+  800bc6:	41 56                	push   %r14
+  800bc8:	41 55                	push   %r13
+  800bca:	41 54                	push   %r12
+  800bcc:	53                   	push   %rbx
+  800bcd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800bd1:	48 85 d2             	test   %rdx,%rdx
+  800bd4:	74 54                	je     800c2a <readn+0x6a>
+  800bd6:	41 89 fd             	mov    %edi,%r13d
+  800bd9:	49 89 f6             	mov    %rsi,%r14
+  800bdc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800be4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800be9:	49 bf 37 0a 80 00 00 	movabs $0x800a37,%r15
+  800bf0:	00 00 00 
+  800bf3:	4c 89 e2             	mov    %r12,%rdx
+  800bf6:	48 29 f2             	sub    %rsi,%rdx
+  800bf9:	4c 01 f6             	add    %r14,%rsi
+  800bfc:	44 89 ef             	mov    %r13d,%edi
+  800bff:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c02:	85 c0                	test   %eax,%eax
+  800c04:	78 20                	js     800c26 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800c06:	01 c3                	add    %eax,%ebx
+  800c08:	85 c0                	test   %eax,%eax
+  800c0a:	74 08                	je     800c14 <readn+0x54>
+  800c0c:	48 63 f3             	movslq %ebx,%rsi
+  800c0f:	4c 39 e6             	cmp    %r12,%rsi
+  800c12:	72 df                	jb     800bf3 <readn+0x33>
+    }
+    return res;
+  800c14:	48 63 c3             	movslq %ebx,%rax
+}
+  800c17:	48 83 c4 08          	add    $0x8,%rsp
+  800c1b:	5b                   	pop    %rbx
+  800c1c:	41 5c                	pop    %r12
+  800c1e:	41 5d                	pop    %r13
+  800c20:	41 5e                	pop    %r14
+  800c22:	41 5f                	pop    %r15
+  800c24:	5d                   	pop    %rbp
+  800c25:	c3                   	ret
+        if (inc < 0) return inc;
+  800c26:	48 98                	cltq
+  800c28:	eb ed                	jmp    800c17 <readn+0x57>
+    int inc = 1, res = 0;
+  800c2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2f:	eb e3                	jmp    800c14 <readn+0x54>
+
+0000000000800c31 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800c31:	55                   	push   %rbp
+  800c32:	48 89 e5             	mov    %rsp,%rbp
+  800c35:	41 56                	push   %r14
+  800c37:	41 55                	push   %r13
+  800c39:	41 54                	push   %r12
+  800c3b:	53                   	push   %rbx
+  800c3c:	48 83 ec 10          	sub    $0x10,%rsp
+  800c40:	89 fb                	mov    %edi,%ebx
+  800c42:	49 89 f4             	mov    %rsi,%r12
+  800c45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c4c:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800c53:	00 00 00 
+  800c56:	ff d0                	call   *%rax
+  800c58:	85 c0                	test   %eax,%eax
+  800c5a:	78 47                	js     800ca3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c60:	41 8b 3e             	mov    (%r14),%edi
+  800c63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c67:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800c6e:	00 00 00 
+  800c71:	ff d0                	call   *%rax
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	78 30                	js     800ca7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c77:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c7c:	74 2d                	je     800cab <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c82:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c86:	48 85 c0             	test   %rax,%rax
+  800c89:	74 56                	je     800ce1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c8b:	4c 89 ea             	mov    %r13,%rdx
+  800c8e:	4c 89 e6             	mov    %r12,%rsi
+  800c91:	4c 89 f7             	mov    %r14,%rdi
+  800c94:	ff d0                	call   *%rax
+}
+  800c96:	48 83 c4 10          	add    $0x10,%rsp
+  800c9a:	5b                   	pop    %rbx
+  800c9b:	41 5c                	pop    %r12
+  800c9d:	41 5d                	pop    %r13
+  800c9f:	41 5e                	pop    %r14
+  800ca1:	5d                   	pop    %rbp
+  800ca2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca3:	48 98                	cltq
+  800ca5:	eb ef                	jmp    800c96 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ca7:	48 98                	cltq
+  800ca9:	eb eb                	jmp    800c96 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800cab:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800cb2:	00 00 00 
+  800cb5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800cbb:	89 da                	mov    %ebx,%edx
+  800cbd:	48 bf 25 3a 80 00 00 	movabs $0x803a25,%rdi
+  800cc4:	00 00 00 
+  800cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccc:	48 b9 a7 26 80 00 00 	movabs $0x8026a7,%rcx
+  800cd3:	00 00 00 
+  800cd6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cd8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800cdf:	eb b5                	jmp    800c96 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800ce1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800ce8:	eb ac                	jmp    800c96 <write+0x65>
+
+0000000000800cea <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800cea:	55                   	push   %rbp
+  800ceb:	48 89 e5             	mov    %rsp,%rbp
+  800cee:	53                   	push   %rbx
+  800cef:	48 83 ec 18          	sub    $0x18,%rsp
+  800cf3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cf5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cf9:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	78 0c                	js     800d15 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800d09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d0d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d19:	c9                   	leave
+  800d1a:	c3                   	ret
+
+0000000000800d1b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800d1b:	55                   	push   %rbp
+  800d1c:	48 89 e5             	mov    %rsp,%rbp
+  800d1f:	41 55                	push   %r13
+  800d21:	41 54                	push   %r12
+  800d23:	53                   	push   %rbx
+  800d24:	48 83 ec 18          	sub    $0x18,%rsp
+  800d28:	89 fb                	mov    %edi,%ebx
+  800d2a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d31:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800d38:	00 00 00 
+  800d3b:	ff d0                	call   *%rax
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	78 38                	js     800d79 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d41:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800d45:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800d49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d4d:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800d54:	00 00 00 
+  800d57:	ff d0                	call   *%rax
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	78 1c                	js     800d79 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d5d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d62:	74 20                	je     800d84 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d68:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d6c:	48 85 c0             	test   %rax,%rax
+  800d6f:	74 47                	je     800db8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d71:	44 89 e6             	mov    %r12d,%esi
+  800d74:	4c 89 ef             	mov    %r13,%rdi
+  800d77:	ff d0                	call   *%rax
+}
+  800d79:	48 83 c4 18          	add    $0x18,%rsp
+  800d7d:	5b                   	pop    %rbx
+  800d7e:	41 5c                	pop    %r12
+  800d80:	41 5d                	pop    %r13
+  800d82:	5d                   	pop    %rbp
+  800d83:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d84:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800d8b:	00 00 00 
+  800d8e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d94:	89 da                	mov    %ebx,%edx
+  800d96:	48 bf e8 39 80 00 00 	movabs $0x8039e8,%rdi
+  800d9d:	00 00 00 
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da5:	48 b9 a7 26 80 00 00 	movabs $0x8026a7,%rcx
+  800dac:	00 00 00 
+  800daf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db6:	eb c1                	jmp    800d79 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800db8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dbd:	eb ba                	jmp    800d79 <ftruncate+0x5e>
+
+0000000000800dbf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800dbf:	55                   	push   %rbp
+  800dc0:	48 89 e5             	mov    %rsp,%rbp
+  800dc3:	41 54                	push   %r12
+  800dc5:	53                   	push   %rbx
+  800dc6:	48 83 ec 10          	sub    $0x10,%rsp
+  800dca:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dd1:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  800dd8:	00 00 00 
+  800ddb:	ff d0                	call   *%rax
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	78 4e                	js     800e2f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800de1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800de5:	41 8b 3c 24          	mov    (%r12),%edi
+  800de9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ded:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800df4:	00 00 00 
+  800df7:	ff d0                	call   *%rax
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	78 32                	js     800e2f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dfd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e01:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800e06:	74 30                	je     800e38 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800e08:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800e0b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800e12:	00 00 00 
+    stat->st_isdir = 0;
+  800e15:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800e1c:	00 00 00 
+    stat->st_dev = dev;
+  800e1f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800e26:	48 89 de             	mov    %rbx,%rsi
+  800e29:	4c 89 e7             	mov    %r12,%rdi
+  800e2c:	ff 50 30             	call   *0x30(%rax)
+}
+  800e2f:	48 83 c4 10          	add    $0x10,%rsp
+  800e33:	5b                   	pop    %rbx
+  800e34:	41 5c                	pop    %r12
+  800e36:	5d                   	pop    %rbp
+  800e37:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e38:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e3d:	eb f0                	jmp    800e2f <fstat+0x70>
+
+0000000000800e3f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800e3f:	55                   	push   %rbp
+  800e40:	48 89 e5             	mov    %rsp,%rbp
+  800e43:	41 54                	push   %r12
+  800e45:	53                   	push   %rbx
+  800e46:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800e49:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4e:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+  800e5a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	78 25                	js     800e85 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e60:	4c 89 e6             	mov    %r12,%rsi
+  800e63:	89 c7                	mov    %eax,%edi
+  800e65:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  800e6c:	00 00 00 
+  800e6f:	ff d0                	call   *%rax
+  800e71:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e74:	89 df                	mov    %ebx,%edi
+  800e76:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800e7d:	00 00 00 
+  800e80:	ff d0                	call   *%rax
+
+    return res;
+  800e82:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e85:	89 d8                	mov    %ebx,%eax
+  800e87:	5b                   	pop    %rbx
+  800e88:	41 5c                	pop    %r12
+  800e8a:	5d                   	pop    %rbp
+  800e8b:	c3                   	ret
+
+0000000000800e8c <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e8c:	55                   	push   %rbp
+  800e8d:	48 89 e5             	mov    %rsp,%rbp
+  800e90:	41 54                	push   %r12
+  800e92:	53                   	push   %rbx
+  800e93:	48 83 ec 10          	sub    $0x10,%rsp
+  800e97:	48 89 fb             	mov    %rdi,%rbx
+  800e9a:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ea1:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ea6:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800ead:	00 00 00 
+  800eb0:	ff d0                	call   *%rax
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	78 1f                	js     800ed5 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800eb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eba:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800ebe:	48 85 c0             	test   %rax,%rax
+  800ec1:	74 1b                	je     800ede <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800ec3:	4c 89 e6             	mov    %r12,%rsi
+  800ec6:	48 89 df             	mov    %rbx,%rdi
+  800ec9:	ff d0                	call   *%rax
+    if (res < 0) {
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed2:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ed5:	48 83 c4 10          	add    $0x10,%rsp
+  800ed9:	5b                   	pop    %rbx
+  800eda:	41 5c                	pop    %r12
+  800edc:	5d                   	pop    %rbp
+  800edd:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ede:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ee3:	eb f0                	jmp    800ed5 <create_snapshot+0x49>
+
+0000000000800ee5 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800ee5:	55                   	push   %rbp
+  800ee6:	48 89 e5             	mov    %rsp,%rbp
+  800ee9:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800eed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800ef1:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ef6:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800efd:	00 00 00 
+  800f00:	ff d0                	call   *%rax
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	78 1e                	js     800f24 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f0a:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800f0e:	48 85 d2             	test   %rdx,%rdx
+  800f11:	74 13                	je     800f26 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f18:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800f1a:	85 c0                	test   %eax,%eax
+  800f1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f21:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f24:	c9                   	leave
+  800f25:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f26:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f2b:	eb f7                	jmp    800f24 <print_snapshot_list+0x3f>
+
+0000000000800f2d <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800f2d:	55                   	push   %rbp
+  800f2e:	48 89 e5             	mov    %rsp,%rbp
+  800f31:	53                   	push   %rbx
+  800f32:	48 83 ec 18          	sub    $0x18,%rsp
+  800f36:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f39:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f3d:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f42:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800f49:	00 00 00 
+  800f4c:	ff d0                	call   *%rax
+  800f4e:	85 c0                	test   %eax,%eax
+  800f50:	78 1c                	js     800f6e <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800f52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f56:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800f5a:	48 85 c0             	test   %rax,%rax
+  800f5d:	74 15                	je     800f74 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f5f:	48 89 df             	mov    %rbx,%rdi
+  800f62:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f74:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f79:	eb f3                	jmp    800f6e <accept_snapshot+0x41>
+
+0000000000800f7b <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f7b:	55                   	push   %rbp
+  800f7c:	48 89 e5             	mov    %rsp,%rbp
+  800f7f:	53                   	push   %rbx
+  800f80:	48 83 ec 18          	sub    $0x18,%rsp
+  800f84:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f87:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f8b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f90:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800f97:	00 00 00 
+  800f9a:	ff d0                	call   *%rax
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	78 1c                	js     800fbc <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800fa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fa4:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800fa8:	48 85 c0             	test   %rax,%rax
+  800fab:	74 15                	je     800fc2 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800fad:	48 89 df             	mov    %rbx,%rdi
+  800fb0:	ff d0                	call   *%rax
+    if (res < 0) {
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800fbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc0:	c9                   	leave
+  800fc1:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fc2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800fc7:	eb f3                	jmp    800fbc <delete_snapshot+0x41>
+
+0000000000800fc9 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800fc9:	55                   	push   %rbp
+  800fca:	48 89 e5             	mov    %rsp,%rbp
+  800fcd:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fd1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800fd5:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fda:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	78 14                	js     800ffe <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800fee:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800ff2:	48 85 d2             	test   %rdx,%rdx
+  800ff5:	74 09                	je     801000 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffc:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800ffe:	c9                   	leave
+  800fff:	c3                   	ret
+        return -E_NOT_SUPP;
+  801000:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801005:	eb f7                	jmp    800ffe <gc_snapshots+0x35>
+
+0000000000801007 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801007:	55                   	push   %rbp
+  801008:	48 89 e5             	mov    %rsp,%rbp
+  80100b:	41 56                	push   %r14
+  80100d:	41 55                	push   %r13
+  80100f:	41 54                	push   %r12
+  801011:	53                   	push   %rbx
+  801012:	48 83 ec 10          	sub    $0x10,%rsp
+  801016:	48 89 fb             	mov    %rdi,%rbx
+  801019:	49 89 f4             	mov    %rsi,%r12
+  80101c:	49 89 d5             	mov    %rdx,%r13
+  80101f:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801022:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801026:	bf 66 00 00 00       	mov    $0x66,%edi
+  80102b:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  801032:	00 00 00 
+  801035:	ff d0                	call   *%rax
+  801037:	85 c0                	test   %eax,%eax
+  801039:	78 1b                	js     801056 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80103b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80103f:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801043:	48 85 c0             	test   %rax,%rax
+  801046:	74 1b                	je     801063 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801048:	4c 89 f1             	mov    %r14,%rcx
+  80104b:	4c 89 ea             	mov    %r13,%rdx
+  80104e:	4c 89 e6             	mov    %r12,%rsi
+  801051:	48 89 df             	mov    %rbx,%rdi
+  801054:	ff d0                	call   *%rax
+
+    return res;
+}
+  801056:	48 83 c4 10          	add    $0x10,%rsp
+  80105a:	5b                   	pop    %rbx
+  80105b:	41 5c                	pop    %r12
+  80105d:	41 5d                	pop    %r13
+  80105f:	41 5e                	pop    %r14
+  801061:	5d                   	pop    %rbp
+  801062:	c3                   	ret
+        return -E_NOT_SUPP;
+  801063:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801068:	eb ec                	jmp    801056 <diff_snapshots+0x4f>
+
+000000000080106a <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80106a:	55                   	push   %rbp
+  80106b:	48 89 e5             	mov    %rsp,%rbp
+  80106e:	41 55                	push   %r13
+  801070:	41 54                	push   %r12
+  801072:	53                   	push   %rbx
+  801073:	48 83 ec 18          	sub    $0x18,%rsp
+  801077:	48 89 fb             	mov    %rdi,%rbx
+  80107a:	49 89 f4             	mov    %rsi,%r12
+  80107d:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801080:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801084:	bf 66 00 00 00       	mov    $0x66,%edi
+  801089:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  801090:	00 00 00 
+  801093:	ff d0                	call   *%rax
+  801095:	85 c0                	test   %eax,%eax
+  801097:	78 18                	js     8010b1 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801099:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80109d:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8010a1:	48 85 c0             	test   %rax,%rax
+  8010a4:	74 16                	je     8010bc <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8010a6:	4c 89 ea             	mov    %r13,%rdx
+  8010a9:	4c 89 e6             	mov    %r12,%rsi
+  8010ac:	48 89 df             	mov    %rbx,%rdi
+  8010af:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010b1:	48 83 c4 18          	add    $0x18,%rsp
+  8010b5:	5b                   	pop    %rbx
+  8010b6:	41 5c                	pop    %r12
+  8010b8:	41 5d                	pop    %r13
+  8010ba:	5d                   	pop    %rbp
+  8010bb:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010bc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010c1:	eb ee                	jmp    8010b1 <send_snapshot+0x47>
+
+00000000008010c3 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+  8010c7:	53                   	push   %rbx
+  8010c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8010cc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010cf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010d3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010d8:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  8010df:	00 00 00 
+  8010e2:	ff d0                	call   *%rax
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	78 12                	js     8010fa <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8010e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ec:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8010f0:	48 85 c0             	test   %rax,%rax
+  8010f3:	74 0b                	je     801100 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8010f5:	48 89 df             	mov    %rbx,%rdi
+  8010f8:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fe:	c9                   	leave
+  8010ff:	c3                   	ret
+        return -E_NOT_SUPP;
+  801100:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801105:	eb f3                	jmp    8010fa <receive_snapshot+0x37>
+
+0000000000801107 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801107:	55                   	push   %rbp
+  801108:	48 89 e5             	mov    %rsp,%rbp
+  80110b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80110f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801113:	bf 66 00 00 00       	mov    $0x66,%edi
+  801118:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  80111f:	00 00 00 
+  801122:	ff d0                	call   *%rax
+  801124:	85 c0                	test   %eax,%eax
+  801126:	78 17                	js     80113f <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801128:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80112c:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801133:	48 85 d2             	test   %rdx,%rdx
+  801136:	74 09                	je     801141 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80113f:	c9                   	leave
+  801140:	c3                   	ret
+        return -E_NOT_SUPP;
+  801141:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801146:	eb f7                	jmp    80113f <free_space_bytes+0x38>
+
+0000000000801148 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801148:	55                   	push   %rbp
+  801149:	48 89 e5             	mov    %rsp,%rbp
+  80114c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801150:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801154:	bf 66 00 00 00       	mov    $0x66,%edi
+  801159:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  801160:	00 00 00 
+  801163:	ff d0                	call   *%rax
+  801165:	85 c0                	test   %eax,%eax
+  801167:	78 17                	js     801180 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801169:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80116d:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801174:	48 85 d2             	test   %rdx,%rdx
+  801177:	74 09                	je     801182 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117e:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801180:	c9                   	leave
+  801181:	c3                   	ret
+        return -E_NOT_SUPP;
+  801182:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801187:	eb f7                	jmp    801180 <busy_space_bytes+0x38>
+
+0000000000801189 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	41 54                	push   %r12
+  80118f:	53                   	push   %rbx
+  801190:	48 83 ec 10          	sub    $0x10,%rsp
+  801194:	89 fb                	mov    %edi,%ebx
+  801196:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801199:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80119d:	bf 66 00 00 00       	mov    $0x66,%edi
+  8011a2:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  8011a9:	00 00 00 
+  8011ac:	ff d0                	call   *%rax
+  8011ae:	85 c0                	test   %eax,%eax
+  8011b0:	78 17                	js     8011c9 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8011b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b6:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8011bd:	48 85 c0             	test   %rax,%rax
+  8011c0:	74 10                	je     8011d2 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8011c2:	4c 89 e6             	mov    %r12,%rsi
+  8011c5:	89 df                	mov    %ebx,%edi
+  8011c7:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8011c9:	48 83 c4 10          	add    $0x10,%rsp
+  8011cd:	5b                   	pop    %rbx
+  8011ce:	41 5c                	pop    %r12
+  8011d0:	5d                   	pop    %rbp
+  8011d1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8011d2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8011d7:	eb f0                	jmp    8011c9 <snapshots_space+0x40>
+
+00000000008011d9 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+  8011dd:	41 55                	push   %r13
+  8011df:	41 54                	push   %r12
+  8011e1:	53                   	push   %rbx
+  8011e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e6:	41 89 fd             	mov    %edi,%r13d
+  8011e9:	48 89 f3             	mov    %rsi,%rbx
+  8011ec:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ef:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8011f6:	00 00 00 
+  8011f9:	83 38 00             	cmpl   $0x0,(%rax)
+  8011fc:	74 57                	je     801255 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011fe:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801204:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801209:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801210:	00 00 00 
+  801213:	44 89 ee             	mov    %r13d,%esi
+  801216:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80121d:	00 00 00 
+  801220:	8b 38                	mov    (%rax),%edi
+  801222:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  801229:	00 00 00 
+  80122c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801233:	4c 89 e2             	mov    %r12,%rdx
+  801236:	48 89 de             	mov    %rbx,%rsi
+  801239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80123e:	48 b8 38 38 80 00 00 	movabs $0x803838,%rax
+  801245:	00 00 00 
+  801248:	ff d0                	call   *%rax
+}
+  80124a:	48 83 c4 08          	add    $0x8,%rsp
+  80124e:	5b                   	pop    %rbx
+  80124f:	41 5c                	pop    %r12
+  801251:	41 5d                	pop    %r13
+  801253:	5d                   	pop    %rbp
+  801254:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801255:	bf 03 00 00 00       	mov    $0x3,%edi
+  80125a:	48 b8 0e 39 80 00 00 	movabs $0x80390e,%rax
+  801261:	00 00 00 
+  801264:	ff d0                	call   *%rax
+  801266:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80126d:	00 00 
+  80126f:	eb 8d                	jmp    8011fe <fsipc_region+0x25>
+
+0000000000801271 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+  801275:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801279:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801280:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801281:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801285:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  80128c:	00 00 00 
+  80128f:	ff d0                	call   *%rax
+}
+  801291:	c9                   	leave
+  801292:	c3                   	ret
+
+0000000000801293 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801293:	85 ff                	test   %edi,%edi
+  801295:	78 6d                	js     801304 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801297:	55                   	push   %rbp
+  801298:	48 89 e5             	mov    %rsp,%rbp
+  80129b:	41 54                	push   %r12
+  80129d:	53                   	push   %rbx
+  80129e:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8012a1:	48 85 f6             	test   %rsi,%rsi
+  8012a4:	74 57                	je     8012fd <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8012a6:	89 f8                	mov    %edi,%eax
+  8012a8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8012af:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8012b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b6:	bf 12 00 00 00       	mov    $0x12,%edi
+  8012bb:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8012c2:	00 00 00 
+  8012c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	78 2d                	js     8012f8 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8012cb:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8012d2:	00 00 00 
+  8012d5:	49 63 14 24          	movslq (%r12),%rdx
+  8012d9:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8012e0:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8012e5:	48 89 df             	mov    %rbx,%rdi
+  8012e8:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  8012ef:	00 00 00 
+  8012f2:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8012f4:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8012f8:	5b                   	pop    %rbx
+  8012f9:	41 5c                	pop    %r12
+  8012fb:	5d                   	pop    %rbp
+  8012fc:	c3                   	ret
+        return -E_INVAL;
+  8012fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801302:	eb f4                	jmp    8012f8 <devfile_df_snapshots+0x65>
+  801304:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801309:	c3                   	ret
+
+000000000080130a <devfile_df_busy>:
+devfile_df_busy() {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	bf 11 00 00 00       	mov    $0x11,%edi
+  801318:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  80131f:	00 00 00 
+  801322:	ff d0                	call   *%rax
+}
+  801324:	5d                   	pop    %rbp
+  801325:	c3                   	ret
+
+0000000000801326 <devfile_df_free>:
+devfile_df_free() {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+  80132f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801334:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  80133b:	00 00 00 
+  80133e:	ff d0                	call   *%rax
+}
+  801340:	5d                   	pop    %rbp
+  801341:	c3                   	ret
+
+0000000000801342 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  801342:	55                   	push   %rbp
+  801343:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  801346:	be 00 00 00 00       	mov    $0x0,%esi
+  80134b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801350:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801357:	00 00 00 
+  80135a:	ff d0                	call   *%rax
+}
+  80135c:	5d                   	pop    %rbp
+  80135d:	c3                   	ret
+
+000000000080135e <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80135e:	55                   	push   %rbp
+  80135f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  801362:	be 00 00 00 00       	mov    $0x0,%esi
+  801367:	bf 09 00 00 00       	mov    $0x9,%edi
+  80136c:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801373:	00 00 00 
+  801376:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801378:	85 c0                	test   %eax,%eax
+  80137a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801382:	5d                   	pop    %rbp
+  801383:	c3                   	ret
+
+0000000000801384 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801388:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80138f:	00 00 00 
+  801392:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801395:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801397:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	bf 02 00 00 00       	mov    $0x2,%edi
+  8013a4:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8013ab:	00 00 00 
+  8013ae:	ff d0                	call   *%rax
+}
+  8013b0:	5d                   	pop    %rbp
+  8013b1:	c3                   	ret
+
+00000000008013b2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8013b2:	55                   	push   %rbp
+  8013b3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013b6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8013b9:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8013c0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8013cc:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8013d3:	00 00 00 
+  8013d6:	ff d0                	call   *%rax
+}
+  8013d8:	5d                   	pop    %rbp
+  8013d9:	c3                   	ret
+
+00000000008013da <devfile_write>:
+    if (!fd || !buf) {
+  8013da:	48 85 ff             	test   %rdi,%rdi
+  8013dd:	0f 84 c1 00 00 00    	je     8014a4 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	41 57                	push   %r15
+  8013e9:	41 56                	push   %r14
+  8013eb:	41 55                	push   %r13
+  8013ed:	41 54                	push   %r12
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8013f4:	49 89 ff             	mov    %rdi,%r15
+  8013f7:	49 89 f5             	mov    %rsi,%r13
+  8013fa:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013fd:	48 85 f6             	test   %rsi,%rsi
+  801400:	0f 84 95 00 00 00    	je     80149b <devfile_write+0xc1>
+    while (n) {
+  801406:	48 85 d2             	test   %rdx,%rdx
+  801409:	0f 84 83 00 00 00    	je     801492 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80140f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801416:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80141d:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801420:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801425:	49 39 dc             	cmp    %rbx,%r12
+  801428:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80142c:	48 89 da             	mov    %rbx,%rdx
+  80142f:	4c 89 ee             	mov    %r13,%rsi
+  801432:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  801439:	00 00 00 
+  80143c:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  801443:	00 00 00 
+  801446:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801448:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80144c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80144f:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	bf 04 00 00 00       	mov    $0x4,%edi
+  80145d:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801464:	00 00 00 
+  801467:	ff d0                	call   *%rax
+        if (write < 0) {
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	78 21                	js     80148e <devfile_write+0xb4>
+        buf += write;
+  80146d:	48 63 d0             	movslq %eax,%rdx
+  801470:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801473:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801476:	49 29 d4             	sub    %rdx,%r12
+  801479:	75 a5                	jne    801420 <devfile_write+0x46>
+    return totalWrite;
+  80147b:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80147f:	48 83 c4 18          	add    $0x18,%rsp
+  801483:	5b                   	pop    %rbx
+  801484:	41 5c                	pop    %r12
+  801486:	41 5d                	pop    %r13
+  801488:	41 5e                	pop    %r14
+  80148a:	41 5f                	pop    %r15
+  80148c:	5d                   	pop    %rbp
+  80148d:	c3                   	ret
+            return write;
+  80148e:	48 98                	cltq
+  801490:	eb ed                	jmp    80147f <devfile_write+0xa5>
+    int totalWrite = 0;
+  801492:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801499:	eb e0                	jmp    80147b <devfile_write+0xa1>
+        return -E_INVAL;
+  80149b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8014a2:	eb db                	jmp    80147f <devfile_write+0xa5>
+  8014a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8014ab:	c3                   	ret
+
+00000000008014ac <devfile_read>:
+    if (!fd || !buf) {
+  8014ac:	48 85 ff             	test   %rdi,%rdi
+  8014af:	0f 84 c0 00 00 00    	je     801575 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8014b5:	55                   	push   %rbp
+  8014b6:	48 89 e5             	mov    %rsp,%rbp
+  8014b9:	41 57                	push   %r15
+  8014bb:	41 56                	push   %r14
+  8014bd:	41 55                	push   %r13
+  8014bf:	41 54                	push   %r12
+  8014c1:	53                   	push   %rbx
+  8014c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c6:	49 89 ff             	mov    %rdi,%r15
+  8014c9:	49 89 f5             	mov    %rsi,%r13
+  8014cc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8014cf:	48 85 f6             	test   %rsi,%rsi
+  8014d2:	0f 84 96 00 00 00    	je     80156e <devfile_read+0xc2>
+    while (n) {
+  8014d8:	48 85 d2             	test   %rdx,%rdx
+  8014db:	0f 84 87 00 00 00    	je     801568 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8014e1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8014e8:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014e9:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8014f0:	00 00 00 
+  8014f3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014f7:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8014fa:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014ff:	49 39 c4             	cmp    %rax,%r12
+  801502:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  801506:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80150a:	be 00 00 00 00       	mov    $0x0,%esi
+  80150f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801514:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+        if (read <= 0) {
+  801520:	85 c0                	test   %eax,%eax
+  801522:	7e 37                	jle    80155b <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  801524:	48 63 d8             	movslq %eax,%rbx
+  801527:	48 89 da             	mov    %rbx,%rdx
+  80152a:	4c 89 f6             	mov    %r14,%rsi
+  80152d:	4c 89 ef             	mov    %r13,%rdi
+  801530:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  801537:	00 00 00 
+  80153a:	ff d0                	call   *%rax
+        buf += read;
+  80153c:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80153f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  801543:	49 29 dc             	sub    %rbx,%r12
+  801546:	75 ab                	jne    8014f3 <devfile_read+0x47>
+  return totalRead;
+  801548:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80154c:	48 83 c4 18          	add    $0x18,%rsp
+  801550:	5b                   	pop    %rbx
+  801551:	41 5c                	pop    %r12
+  801553:	41 5d                	pop    %r13
+  801555:	41 5e                	pop    %r14
+  801557:	41 5f                	pop    %r15
+  801559:	5d                   	pop    %rbp
+  80155a:	c3                   	ret
+            return read ? read : totalRead;
+  80155b:	48 63 d0             	movslq %eax,%rdx
+  80155e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801562:	48 0f 45 c2          	cmovne %rdx,%rax
+  801566:	eb e4                	jmp    80154c <devfile_read+0xa0>
+    size_t totalRead = 0;
+  801568:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80156c:	eb da                	jmp    801548 <devfile_read+0x9c>
+        return E_INVAL;
+  80156e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801573:	eb d7                	jmp    80154c <devfile_read+0xa0>
+  801575:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80157a:	c3                   	ret
+
+000000000080157b <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80157b:	48 85 ff             	test   %rdi,%rdi
+  80157e:	74 5f                	je     8015df <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+  801589:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80158c:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801593:	00 00 00 
+  801596:	ff d0                	call   *%rax
+  801598:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80159e:	77 45                	ja     8015e5 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8015a0:	48 89 de             	mov    %rbx,%rsi
+  8015a3:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8015aa:	00 00 00 
+  8015ad:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  8015b4:	00 00 00 
+  8015b7:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8015b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015be:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8015c3:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8015ca:	00 00 00 
+  8015cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8015cf:	85 c0                	test   %eax,%eax
+  8015d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8015d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+        return -E_INVAL;
+  8015df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015e4:	c3                   	ret
+        return -E_INVAL;
+  8015e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ea:	eb ed                	jmp    8015d9 <devfile_receive_snapshot+0x5e>
+
+00000000008015ec <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8015ec:	55                   	push   %rbp
+  8015ed:	48 89 e5             	mov    %rsp,%rbp
+  8015f0:	41 55                	push   %r13
+  8015f2:	41 54                	push   %r12
+  8015f4:	53                   	push   %rbx
+  8015f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f9:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015fc:	48 85 f6             	test   %rsi,%rsi
+  8015ff:	0f 94 c0             	sete   %al
+  801602:	48 85 d2             	test   %rdx,%rdx
+  801605:	0f 94 c2             	sete   %dl
+  801608:	08 d0                	or     %dl,%al
+  80160a:	0f 85 ad 00 00 00    	jne    8016bd <devfile_send_snapshot+0xd1>
+  801610:	48 89 fb             	mov    %rdi,%rbx
+  801613:	49 89 f4             	mov    %rsi,%r12
+  801616:	48 85 ff             	test   %rdi,%rdi
+  801619:	0f 84 9e 00 00 00    	je     8016bd <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80161f:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801626:	00 00 00 
+  801629:	ff d0                	call   *%rax
+  80162b:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801631:	0f 87 8d 00 00 00    	ja     8016c4 <devfile_send_snapshot+0xd8>
+  801637:	4c 89 e7             	mov    %r12,%rdi
+  80163a:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+  801646:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80164c:	77 7d                	ja     8016cb <devfile_send_snapshot+0xdf>
+  80164e:	4c 89 ef             	mov    %r13,%rdi
+  801651:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801658:	00 00 00 
+  80165b:	ff d0                	call   *%rax
+  80165d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801663:	77 6d                	ja     8016d2 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  801665:	48 89 de             	mov    %rbx,%rsi
+  801668:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80166f:	00 00 00 
+  801672:	48 bb cc 2f 80 00 00 	movabs $0x802fcc,%rbx
+  801679:	00 00 00 
+  80167c:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80167e:	4c 89 e6             	mov    %r12,%rsi
+  801681:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  801688:	00 00 00 
+  80168b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80168d:	4c 89 ee             	mov    %r13,%rsi
+  801690:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  801697:	00 00 00 
+  80169a:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  80169c:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a1:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8016a6:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8016ad:	00 00 00 
+  8016b0:	ff d0                	call   *%rax
+}
+  8016b2:	48 83 c4 08          	add    $0x8,%rsp
+  8016b6:	5b                   	pop    %rbx
+  8016b7:	41 5c                	pop    %r12
+  8016b9:	41 5d                	pop    %r13
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+        return -E_INVAL;
+  8016bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c2:	eb ee                	jmp    8016b2 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8016c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c9:	eb e7                	jmp    8016b2 <devfile_send_snapshot+0xc6>
+  8016cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d0:	eb e0                	jmp    8016b2 <devfile_send_snapshot+0xc6>
+  8016d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d7:	eb d9                	jmp    8016b2 <devfile_send_snapshot+0xc6>
+
+00000000008016d9 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8016d9:	48 85 ff             	test   %rdi,%rdi
+  8016dc:	0f 84 41 01 00 00    	je     801823 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8016e2:	55                   	push   %rbp
+  8016e3:	48 89 e5             	mov    %rsp,%rbp
+  8016e6:	41 57                	push   %r15
+  8016e8:	41 56                	push   %r14
+  8016ea:	41 55                	push   %r13
+  8016ec:	41 54                	push   %r12
+  8016ee:	53                   	push   %rbx
+  8016ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f3:	49 89 fc             	mov    %rdi,%r12
+  8016f6:	49 89 f5             	mov    %rsi,%r13
+  8016f9:	48 89 d3             	mov    %rdx,%rbx
+  8016fc:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016ff:	48 85 f6             	test   %rsi,%rsi
+  801702:	0f 84 ff 00 00 00    	je     801807 <devfile_diff_snapshots+0x12e>
+  801708:	48 85 d2             	test   %rdx,%rdx
+  80170b:	0f 84 fd 00 00 00    	je     80180e <devfile_diff_snapshots+0x135>
+  801711:	48 85 c9             	test   %rcx,%rcx
+  801714:	0f 84 f4 00 00 00    	je     80180e <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80171a:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801721:	00 00 00 
+  801724:	ff d0                	call   *%rax
+  801726:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80172c:	0f 87 e3 00 00 00    	ja     801815 <devfile_diff_snapshots+0x13c>
+  801732:	4c 89 ef             	mov    %r13,%rdi
+  801735:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+  801741:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801747:	0f 87 cf 00 00 00    	ja     80181c <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80174d:	4c 89 e6             	mov    %r12,%rsi
+  801750:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  801757:	00 00 00 
+  80175a:	4c 89 e7             	mov    %r12,%rdi
+  80175d:	49 bf cc 2f 80 00 00 	movabs $0x802fcc,%r15
+  801764:	00 00 00 
+  801767:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80176a:	4c 89 ee             	mov    %r13,%rsi
+  80176d:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801774:	00 
+  801775:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801778:	48 8b 03             	mov    (%rbx),%rax
+  80177b:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801782:	00 
+  801783:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801787:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80178e:	00 
+  80178f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801793:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80179a:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  80179b:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8017a5:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8017ac:	00 00 00 
+  8017af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 43                	js     8017f8 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8017b5:	49 8b 04 24          	mov    (%r12),%rax
+  8017b9:	48 89 03             	mov    %rax,(%rbx)
+  8017bc:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8017c1:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8017c5:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8017ca:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8017ce:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8017d3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017d7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8017db:	48 c1 e2 03          	shl    $0x3,%rdx
+  8017df:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8017e4:	4c 89 f7             	mov    %r14,%rdi
+  8017e7:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8017f3:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8017f8:	48 83 c4 08          	add    $0x8,%rsp
+  8017fc:	5b                   	pop    %rbx
+  8017fd:	41 5c                	pop    %r12
+  8017ff:	41 5d                	pop    %r13
+  801801:	41 5e                	pop    %r14
+  801803:	41 5f                	pop    %r15
+  801805:	5d                   	pop    %rbp
+  801806:	c3                   	ret
+        return -E_INVAL;
+  801807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180c:	eb ea                	jmp    8017f8 <devfile_diff_snapshots+0x11f>
+  80180e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801813:	eb e3                	jmp    8017f8 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  801815:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80181a:	eb dc                	jmp    8017f8 <devfile_diff_snapshots+0x11f>
+  80181c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801821:	eb d5                	jmp    8017f8 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  801823:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801828:	c3                   	ret
+
+0000000000801829 <devfile_delete_snapshot>:
+    if (!name) {
+  801829:	48 85 ff             	test   %rdi,%rdi
+  80182c:	74 5f                	je     80188d <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+  801832:	53                   	push   %rbx
+  801833:	48 83 ec 08          	sub    $0x8,%rsp
+  801837:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80183a:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801841:	00 00 00 
+  801844:	ff d0                	call   *%rax
+  801846:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80184c:	77 45                	ja     801893 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80184e:	48 89 de             	mov    %rbx,%rsi
+  801851:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  801858:	00 00 00 
+  80185b:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  801867:	be 00 00 00 00       	mov    $0x0,%esi
+  80186c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801871:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801878:	00 00 00 
+  80187b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801884:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+        return -E_INVAL;
+  80188d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801892:	c3                   	ret
+        return -E_INVAL;
+  801893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801898:	eb ed                	jmp    801887 <devfile_delete_snapshot+0x5e>
+
+000000000080189a <devfile_accept_snapshot>:
+    if (!name) {
+  80189a:	48 85 ff             	test   %rdi,%rdi
+  80189d:	74 5f                	je     8018fe <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80189f:	55                   	push   %rbp
+  8018a0:	48 89 e5             	mov    %rsp,%rbp
+  8018a3:	53                   	push   %rbx
+  8018a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a8:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8018ab:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  8018b2:	00 00 00 
+  8018b5:	ff d0                	call   *%rax
+  8018b7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018bd:	77 45                	ja     801904 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8018bf:	48 89 de             	mov    %rbx,%rsi
+  8018c2:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8018c9:	00 00 00 
+  8018cc:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8018d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8018e2:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+        return -E_INVAL;
+  8018fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801903:	c3                   	ret
+        return -E_INVAL;
+  801904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801909:	eb ed                	jmp    8018f8 <devfile_accept_snapshot+0x5e>
+
+000000000080190b <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80190b:	48 85 ff             	test   %rdi,%rdi
+  80190e:	0f 84 9f 00 00 00    	je     8019b3 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	41 54                	push   %r12
+  80191a:	53                   	push   %rbx
+  80191b:	48 89 fb             	mov    %rdi,%rbx
+  80191e:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  801921:	48 85 f6             	test   %rsi,%rsi
+  801924:	74 78                	je     80199e <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  801926:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  80192d:	00 00 00 
+  801930:	ff d0                	call   *%rax
+  801932:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801938:	77 6b                	ja     8019a5 <devfile_create_snapshot+0x9a>
+  80193a:	4c 89 e7             	mov    %r12,%rdi
+  80193d:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801944:	00 00 00 
+  801947:	ff d0                	call   *%rax
+  801949:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80194f:	77 5b                	ja     8019ac <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  801951:	48 89 de             	mov    %rbx,%rsi
+  801954:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80195b:	00 00 00 
+  80195e:	48 bb cc 2f 80 00 00 	movabs $0x802fcc,%rbx
+  801965:	00 00 00 
+  801968:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80196a:	4c 89 e6             	mov    %r12,%rsi
+  80196d:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  801974:	00 00 00 
+  801977:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801979:	be 00 00 00 00       	mov    $0x0,%esi
+  80197e:	bf 08 00 00 00       	mov    $0x8,%edi
+  801983:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  80198a:	00 00 00 
+  80198d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	ba 00 00 00 00       	mov    $0x0,%edx
+  801996:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801999:	5b                   	pop    %rbx
+  80199a:	41 5c                	pop    %r12
+  80199c:	5d                   	pop    %rbp
+  80199d:	c3                   	ret
+        return -E_INVAL;
+  80199e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a3:	eb f4                	jmp    801999 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8019a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019aa:	eb ed                	jmp    801999 <devfile_create_snapshot+0x8e>
+  8019ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b1:	eb e6                	jmp    801999 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8019b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019b8:	c3                   	ret
+
+00000000008019b9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	41 54                	push   %r12
+  8019bf:	53                   	push   %rbx
+  8019c0:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019c3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8019c6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8019cd:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8019cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8019d9:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 3d                	js     801a26 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019e9:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8019f0:	00 00 00 
+  8019f3:	4c 89 e6             	mov    %r12,%rsi
+  8019f6:	48 89 df             	mov    %rbx,%rdi
+  8019f9:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  801a00:	00 00 00 
+  801a03:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801a05:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801a0c:	00 
+  801a0d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a13:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801a1a:	00 
+  801a1b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a26:	5b                   	pop    %rbx
+  801a27:	41 5c                	pop    %r12
+  801a29:	5d                   	pop    %rbp
+  801a2a:	c3                   	ret
+
+0000000000801a2b <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  801a2b:	55                   	push   %rbp
+  801a2c:	48 89 e5             	mov    %rsp,%rbp
+  801a2f:	41 57                	push   %r15
+  801a31:	41 56                	push   %r14
+  801a33:	41 55                	push   %r13
+  801a35:	41 54                	push   %r12
+  801a37:	53                   	push   %rbx
+  801a38:	48 83 ec 38          	sub    $0x38,%rsp
+  801a3c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801a40:	49 89 f5             	mov    %rsi,%r13
+  801a43:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a46:	48 89 f0             	mov    %rsi,%rax
+  801a49:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a4e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801a52:	75 4f                	jne    801aa3 <devfile_readmap+0x78>
+  801a54:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a58:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a5e:	75 1f                	jne    801a7f <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a60:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a64:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a68:	49 be 13 22 80 00 00 	movabs $0x802213,%r14
+  801a6f:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a72:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a79:	0f 87 9d 00 00 00    	ja     801b1c <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a7f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a83:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a87:	4d 85 ff             	test   %r15,%r15
+  801a8a:	0f 85 cf 00 00 00    	jne    801b5f <devfile_readmap+0x134>
+  801a90:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a94:	48 83 c4 38          	add    $0x38,%rsp
+  801a98:	5b                   	pop    %rbx
+  801a99:	41 5c                	pop    %r12
+  801a9b:	41 5d                	pop    %r13
+  801a9d:	41 5e                	pop    %r14
+  801a9f:	41 5f                	pop    %r15
+  801aa1:	5d                   	pop    %rbp
+  801aa2:	c3                   	ret
+    size_t totalRead = 0;
+  801aa3:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801aaa:	00 
+  801aab:	eb da                	jmp    801a87 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aad:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ab1:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ab4:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801abb:	00 00 00 
+  801abe:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801ac0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ac4:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801ac8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801acc:	4c 89 ee             	mov    %r13,%rsi
+  801acf:	bf 14 00 00 00       	mov    $0x14,%edi
+  801ad4:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	7e a3                	jle    801a87 <devfile_readmap+0x5c>
+  801ae4:	48 98                	cltq
+  801ae6:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801aea:	72 9b                	jb     801a87 <devfile_readmap+0x5c>
+        buf += read;
+  801aec:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801aef:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801af2:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801af6:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801afd:	75 88                	jne    801a87 <devfile_readmap+0x5c>
+  801aff:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b03:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801b09:	0f 85 78 ff ff ff    	jne    801a87 <devfile_readmap+0x5c>
+  801b0f:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801b16:	0f 86 6b ff ff ff    	jbe    801a87 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801b1c:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801b22:	4d 39 e7             	cmp    %r12,%r15
+  801b25:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801b29:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801b30:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801b34:	0f 84 73 ff ff ff    	je     801aad <devfile_readmap+0x82>
+  801b3a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801b3e:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801b43:	41 ff d6             	call   *%r14
+  801b46:	a8 40                	test   $0x40,%al
+  801b48:	0f 85 39 ff ff ff    	jne    801a87 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801b4e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b55:	4c 39 e3             	cmp    %r12,%rbx
+  801b58:	72 e4                	jb     801b3e <devfile_readmap+0x113>
+  801b5a:	e9 4e ff ff ff       	jmp    801aad <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b5f:	4c 89 fa             	mov    %r15,%rdx
+  801b62:	4c 89 ee             	mov    %r13,%rsi
+  801b65:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b69:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  801b70:	00 00 00 
+  801b73:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b75:	48 85 c0             	test   %rax,%rax
+  801b78:	78 0c                	js     801b86 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b7a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b7e:	48 01 f0             	add    %rsi,%rax
+  801b81:	e9 0e ff ff ff       	jmp    801a94 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b8a:	48 85 f6             	test   %rsi,%rsi
+  801b8d:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b91:	e9 fe fe ff ff       	jmp    801a94 <devfile_readmap+0x69>
+
+0000000000801b96 <open>:
+open(const char *path, int mode) {
+  801b96:	55                   	push   %rbp
+  801b97:	48 89 e5             	mov    %rsp,%rbp
+  801b9a:	41 55                	push   %r13
+  801b9c:	41 54                	push   %r12
+  801b9e:	53                   	push   %rbx
+  801b9f:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba3:	49 89 fc             	mov    %rdi,%r12
+  801ba6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ba9:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801bbb:	0f 87 8a 00 00 00    	ja     801c4b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bc1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801bc5:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+  801bd1:	89 c3                	mov    %eax,%ebx
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	78 50                	js     801c27 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801bd7:	4c 89 e6             	mov    %r12,%rsi
+  801bda:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  801be1:	00 00 00 
+  801be4:	48 89 df             	mov    %rbx,%rdi
+  801be7:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801bf3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bfa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801bfe:	bf 01 00 00 00       	mov    $0x1,%edi
+  801c03:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	89 c3                	mov    %eax,%ebx
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 1f                	js     801c34 <open+0x9e>
+    return fd2num(fd);
+  801c15:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801c19:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+  801c25:	89 c3                	mov    %eax,%ebx
+}
+  801c27:	89 d8                	mov    %ebx,%eax
+  801c29:	48 83 c4 18          	add    $0x18,%rsp
+  801c2d:	5b                   	pop    %rbx
+  801c2e:	41 5c                	pop    %r12
+  801c30:	41 5d                	pop    %r13
+  801c32:	5d                   	pop    %rbp
+  801c33:	c3                   	ret
+        fd_close(fd, 0);
+  801c34:	be 00 00 00 00       	mov    $0x0,%esi
+  801c39:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801c3d:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+        return res;
+  801c49:	eb dc                	jmp    801c27 <open+0x91>
+        return -E_BAD_PATH;
+  801c4b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801c50:	eb d5                	jmp    801c27 <open+0x91>
+
+0000000000801c52 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801c52:	55                   	push   %rbp
+  801c53:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801c56:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5b:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c60:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  801c67:	00 00 00 
+  801c6a:	ff d0                	call   *%rax
+}
+  801c6c:	5d                   	pop    %rbp
+  801c6d:	c3                   	ret
+
+0000000000801c6e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	41 54                	push   %r12
+  801c74:	53                   	push   %rbx
+  801c75:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c78:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801c7f:	00 00 00 
+  801c82:	ff d0                	call   *%rax
+  801c84:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c87:	48 be 80 3a 80 00 00 	movabs $0x803a80,%rsi
+  801c8e:	00 00 00 
+  801c91:	48 89 df             	mov    %rbx,%rdi
+  801c94:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  801c9b:	00 00 00 
+  801c9e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801ca0:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801ca5:	41 2b 04 24          	sub    (%r12),%eax
+  801ca9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801caf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cb6:	00 00 00 
+    stat->st_dev = &devpipe;
+  801cb9:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  801cc0:	00 00 00 
+  801cc3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccf:	5b                   	pop    %rbx
+  801cd0:	41 5c                	pop    %r12
+  801cd2:	5d                   	pop    %rbp
+  801cd3:	c3                   	ret
+
+0000000000801cd4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801cd4:	55                   	push   %rbp
+  801cd5:	48 89 e5             	mov    %rsp,%rbp
+  801cd8:	41 54                	push   %r12
+  801cda:	53                   	push   %rbx
+  801cdb:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce3:	48 89 fe             	mov    %rdi,%rsi
+  801ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ceb:	49 bc 77 03 80 00 00 	movabs $0x800377,%r12
+  801cf2:	00 00 00 
+  801cf5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801cf8:	48 89 df             	mov    %rbx,%rdi
+  801cfb:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801d02:	00 00 00 
+  801d05:	ff d0                	call   *%rax
+  801d07:	48 89 c6             	mov    %rax,%rsi
+  801d0a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d14:	41 ff d4             	call   *%r12
+}
+  801d17:	5b                   	pop    %rbx
+  801d18:	41 5c                	pop    %r12
+  801d1a:	5d                   	pop    %rbp
+  801d1b:	c3                   	ret
+
+0000000000801d1c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801d1c:	55                   	push   %rbp
+  801d1d:	48 89 e5             	mov    %rsp,%rbp
+  801d20:	41 57                	push   %r15
+  801d22:	41 56                	push   %r14
+  801d24:	41 55                	push   %r13
+  801d26:	41 54                	push   %r12
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 18          	sub    $0x18,%rsp
+  801d2d:	49 89 fc             	mov    %rdi,%r12
+  801d30:	49 89 f5             	mov    %rsi,%r13
+  801d33:	49 89 d7             	mov    %rdx,%r15
+  801d36:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801d3a:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801d41:	00 00 00 
+  801d44:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801d46:	4d 85 ff             	test   %r15,%r15
+  801d49:	0f 84 af 00 00 00    	je     801dfe <devpipe_write+0xe2>
+  801d4f:	48 89 c3             	mov    %rax,%rbx
+  801d52:	4c 89 f8             	mov    %r15,%rax
+  801d55:	4d 89 ef             	mov    %r13,%r15
+  801d58:	4c 01 e8             	add    %r13,%rax
+  801d5b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d5f:	49 bd 7f 02 80 00 00 	movabs $0x80027f,%r13
+  801d66:	00 00 00 
+            sys_yield();
+  801d69:	49 be 1c 02 80 00 00 	movabs $0x80021c,%r14
+  801d70:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d73:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d76:	48 63 ce             	movslq %esi,%rcx
+  801d79:	48 63 03             	movslq (%rbx),%rax
+  801d7c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d82:	48 39 c1             	cmp    %rax,%rcx
+  801d85:	72 2e                	jb     801db5 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d87:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d8c:	48 89 da             	mov    %rbx,%rdx
+  801d8f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d94:	4c 89 e7             	mov    %r12,%rdi
+  801d97:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	74 66                	je     801e04 <devpipe_write+0xe8>
+            sys_yield();
+  801d9e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801da1:	8b 73 04             	mov    0x4(%rbx),%esi
+  801da4:	48 63 ce             	movslq %esi,%rcx
+  801da7:	48 63 03             	movslq (%rbx),%rax
+  801daa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801db0:	48 39 c1             	cmp    %rax,%rcx
+  801db3:	73 d2                	jae    801d87 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801db5:	41 0f b6 3f          	movzbl (%r15),%edi
+  801db9:	48 89 ca             	mov    %rcx,%rdx
+  801dbc:	48 c1 ea 03          	shr    $0x3,%rdx
+  801dc0:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801dc7:	08 10 20 
+  801dca:	48 f7 e2             	mul    %rdx
+  801dcd:	48 c1 ea 06          	shr    $0x6,%rdx
+  801dd1:	48 89 d0             	mov    %rdx,%rax
+  801dd4:	48 c1 e0 09          	shl    $0x9,%rax
+  801dd8:	48 29 d0             	sub    %rdx,%rax
+  801ddb:	48 c1 e0 03          	shl    $0x3,%rax
+  801ddf:	48 29 c1             	sub    %rax,%rcx
+  801de2:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801de7:	83 c6 01             	add    $0x1,%esi
+  801dea:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801ded:	49 83 c7 01          	add    $0x1,%r15
+  801df1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801df5:	49 39 c7             	cmp    %rax,%r15
+  801df8:	0f 85 75 ff ff ff    	jne    801d73 <devpipe_write+0x57>
+    return n;
+  801dfe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e02:	eb 05                	jmp    801e09 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e09:	48 83 c4 18          	add    $0x18,%rsp
+  801e0d:	5b                   	pop    %rbx
+  801e0e:	41 5c                	pop    %r12
+  801e10:	41 5d                	pop    %r13
+  801e12:	41 5e                	pop    %r14
+  801e14:	41 5f                	pop    %r15
+  801e16:	5d                   	pop    %rbp
+  801e17:	c3                   	ret
+
+0000000000801e18 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801e18:	55                   	push   %rbp
+  801e19:	48 89 e5             	mov    %rsp,%rbp
+  801e1c:	41 57                	push   %r15
+  801e1e:	41 56                	push   %r14
+  801e20:	41 55                	push   %r13
+  801e22:	41 54                	push   %r12
+  801e24:	53                   	push   %rbx
+  801e25:	48 83 ec 18          	sub    $0x18,%rsp
+  801e29:	49 89 fc             	mov    %rdi,%r12
+  801e2c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801e30:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801e34:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801e3b:	00 00 00 
+  801e3e:	ff d0                	call   *%rax
+  801e40:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801e43:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e49:	49 bd 7f 02 80 00 00 	movabs $0x80027f,%r13
+  801e50:	00 00 00 
+            sys_yield();
+  801e53:	49 be 1c 02 80 00 00 	movabs $0x80021c,%r14
+  801e5a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e5d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e62:	74 7d                	je     801ee1 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e64:	8b 03                	mov    (%rbx),%eax
+  801e66:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e69:	75 26                	jne    801e91 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e6b:	4d 85 ff             	test   %r15,%r15
+  801e6e:	75 77                	jne    801ee7 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e70:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e75:	48 89 da             	mov    %rbx,%rdx
+  801e78:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e7d:	4c 89 e7             	mov    %r12,%rdi
+  801e80:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	74 72                	je     801ef9 <devpipe_read+0xe1>
+            sys_yield();
+  801e87:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e8a:	8b 03                	mov    (%rbx),%eax
+  801e8c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e8f:	74 df                	je     801e70 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e91:	48 63 c8             	movslq %eax,%rcx
+  801e94:	48 89 ca             	mov    %rcx,%rdx
+  801e97:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e9b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801ea2:	08 10 20 
+  801ea5:	48 89 d0             	mov    %rdx,%rax
+  801ea8:	48 f7 e6             	mul    %rsi
+  801eab:	48 c1 ea 06          	shr    $0x6,%rdx
+  801eaf:	48 89 d0             	mov    %rdx,%rax
+  801eb2:	48 c1 e0 09          	shl    $0x9,%rax
+  801eb6:	48 29 d0             	sub    %rdx,%rax
+  801eb9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801ec0:	00 
+  801ec1:	48 89 c8             	mov    %rcx,%rax
+  801ec4:	48 29 d0             	sub    %rdx,%rax
+  801ec7:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801ecc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ed0:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801ed4:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801ed7:	49 83 c7 01          	add    $0x1,%r15
+  801edb:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801edf:	75 83                	jne    801e64 <devpipe_read+0x4c>
+    return n;
+  801ee1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ee5:	eb 03                	jmp    801eea <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801ee7:	4c 89 f8             	mov    %r15,%rax
+}
+  801eea:	48 83 c4 18          	add    $0x18,%rsp
+  801eee:	5b                   	pop    %rbx
+  801eef:	41 5c                	pop    %r12
+  801ef1:	41 5d                	pop    %r13
+  801ef3:	41 5e                	pop    %r14
+  801ef5:	41 5f                	pop    %r15
+  801ef7:	5d                   	pop    %rbp
+  801ef8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efe:	eb ea                	jmp    801eea <devpipe_read+0xd2>
+
+0000000000801f00 <pipe>:
+pipe(int pfd[2]) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 55                	push   %r13
+  801f06:	41 54                	push   %r12
+  801f08:	53                   	push   %rbx
+  801f09:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801f10:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f14:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+  801f20:	89 c3                	mov    %eax,%ebx
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	0f 88 a0 01 00 00    	js     8020ca <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801f2a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f34:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f3d:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  801f44:	00 00 00 
+  801f47:	ff d0                	call   *%rax
+  801f49:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	0f 88 77 01 00 00    	js     8020ca <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f53:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801f57:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	0f 88 43 01 00 00    	js     8020b0 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f6d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f77:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f80:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  801f87:	00 00 00 
+  801f8a:	ff d0                	call   *%rax
+  801f8c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	0f 88 1a 01 00 00    	js     8020b0 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f96:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f9a:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801fa1:	00 00 00 
+  801fa4:	ff d0                	call   *%rax
+  801fa6:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801fa9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801fae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fb3:	48 89 c6             	mov    %rax,%rsi
+  801fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fbb:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  801fc2:	00 00 00 
+  801fc5:	ff d0                	call   *%rax
+  801fc7:	89 c3                	mov    %eax,%ebx
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	0f 88 c5 00 00 00    	js     802096 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801fd1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801fd5:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	48 89 c1             	mov    %rax,%rcx
+  801fe4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801fea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff5:	4c 89 ee             	mov    %r13,%rsi
+  801ff8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ffd:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  802004:	00 00 00 
+  802007:	ff d0                	call   *%rax
+  802009:	89 c3                	mov    %eax,%ebx
+  80200b:	85 c0                	test   %eax,%eax
+  80200d:	78 6e                	js     80207d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80200f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802014:	4c 89 ef             	mov    %r13,%rdi
+  802017:	48 b8 4d 02 80 00 00 	movabs $0x80024d,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+  802023:	83 f8 02             	cmp    $0x2,%eax
+  802026:	0f 85 ab 00 00 00    	jne    8020d7 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80202c:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  802033:	00 00 
+  802035:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802039:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80203b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80203f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802046:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80204a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80204c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802050:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802057:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80205b:	48 bb c6 06 80 00 00 	movabs $0x8006c6,%rbx
+  802062:	00 00 00 
+  802065:	ff d3                	call   *%rbx
+  802067:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80206b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80206f:	ff d3                	call   *%rbx
+  802071:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802076:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80207b:	eb 4d                	jmp    8020ca <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80207d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802082:	4c 89 ee             	mov    %r13,%rsi
+  802085:	bf 00 00 00 00       	mov    $0x0,%edi
+  80208a:	48 b8 77 03 80 00 00 	movabs $0x800377,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802096:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80209b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80209f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a4:	48 b8 77 03 80 00 00 	movabs $0x800377,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8020b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020b5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8020b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020be:	48 b8 77 03 80 00 00 	movabs $0x800377,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+}
+  8020ca:	89 d8                	mov    %ebx,%eax
+  8020cc:	48 83 c4 18          	add    $0x18,%rsp
+  8020d0:	5b                   	pop    %rbx
+  8020d1:	41 5c                	pop    %r12
+  8020d3:	41 5d                	pop    %r13
+  8020d5:	5d                   	pop    %rbp
+  8020d6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8020d7:	48 b9 b0 3a 80 00 00 	movabs $0x803ab0,%rcx
+  8020de:	00 00 00 
+  8020e1:	48 ba 87 3a 80 00 00 	movabs $0x803a87,%rdx
+  8020e8:	00 00 00 
+  8020eb:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8020f0:	48 bf 9c 3a 80 00 00 	movabs $0x803a9c,%rdi
+  8020f7:	00 00 00 
+  8020fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ff:	49 b8 57 25 80 00 00 	movabs $0x802557,%r8
+  802106:	00 00 00 
+  802109:	41 ff d0             	call   *%r8
+
+000000000080210c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80210c:	55                   	push   %rbp
+  80210d:	48 89 e5             	mov    %rsp,%rbp
+  802110:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802114:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802118:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802124:	85 c0                	test   %eax,%eax
+  802126:	78 35                	js     80215d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802128:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80212c:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+  802138:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80213b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802140:	be 00 10 00 00       	mov    $0x1000,%esi
+  802145:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802149:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+  802155:	85 c0                	test   %eax,%eax
+  802157:	0f 94 c0             	sete   %al
+  80215a:	0f b6 c0             	movzbl %al,%eax
+}
+  80215d:	c9                   	leave
+  80215e:	c3                   	ret
+
+000000000080215f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80215f:	48 89 f8             	mov    %rdi,%rax
+  802162:	48 c1 e8 27          	shr    $0x27,%rax
+  802166:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80216d:	01 00 00 
+  802170:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802174:	f6 c2 01             	test   $0x1,%dl
+  802177:	74 6d                	je     8021e6 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802179:	48 89 f8             	mov    %rdi,%rax
+  80217c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802180:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802187:	01 00 00 
+  80218a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80218e:	f6 c2 01             	test   $0x1,%dl
+  802191:	74 62                	je     8021f5 <get_uvpt_entry+0x96>
+  802193:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80219a:	01 00 00 
+  80219d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8021a1:	f6 c2 80             	test   $0x80,%dl
+  8021a4:	75 4f                	jne    8021f5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021a6:	48 89 f8             	mov    %rdi,%rax
+  8021a9:	48 c1 e8 15          	shr    $0x15,%rax
+  8021ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021b4:	01 00 00 
+  8021b7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8021bb:	f6 c2 01             	test   $0x1,%dl
+  8021be:	74 44                	je     802204 <get_uvpt_entry+0xa5>
+  8021c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021c7:	01 00 00 
+  8021ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8021ce:	f6 c2 80             	test   $0x80,%dl
+  8021d1:	75 31                	jne    802204 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8021d3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8021d7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8021de:	01 00 00 
+  8021e1:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8021e5:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8021e6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8021ed:	01 00 00 
+  8021f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021f4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8021f5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021fc:	01 00 00 
+  8021ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802203:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802204:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80220b:	01 00 00 
+  80220e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802212:	c3                   	ret
+
+0000000000802213 <get_prot>:
+
+int
+get_prot(void *va) {
+  802213:	55                   	push   %rbp
+  802214:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802217:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+  802223:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802226:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80222b:	89 c1                	mov    %eax,%ecx
+  80222d:	83 c9 04             	or     $0x4,%ecx
+  802230:	f6 c2 01             	test   $0x1,%dl
+  802233:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802236:	89 c1                	mov    %eax,%ecx
+  802238:	83 c9 02             	or     $0x2,%ecx
+  80223b:	f6 c2 02             	test   $0x2,%dl
+  80223e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802241:	89 c1                	mov    %eax,%ecx
+  802243:	83 c9 01             	or     $0x1,%ecx
+  802246:	48 85 d2             	test   %rdx,%rdx
+  802249:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80224c:	89 c1                	mov    %eax,%ecx
+  80224e:	83 c9 40             	or     $0x40,%ecx
+  802251:	f6 c6 04             	test   $0x4,%dh
+  802254:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+
+0000000000802259 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802259:	55                   	push   %rbp
+  80225a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80225d:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802269:	48 c1 e8 06          	shr    $0x6,%rax
+  80226d:	83 e0 01             	and    $0x1,%eax
+}
+  802270:	5d                   	pop    %rbp
+  802271:	c3                   	ret
+
+0000000000802272 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802272:	55                   	push   %rbp
+  802273:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802276:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802282:	48 c1 e8 05          	shr    $0x5,%rax
+  802286:	83 e0 01             	and    $0x1,%eax
+}
+  802289:	5d                   	pop    %rbp
+  80228a:	c3                   	ret
+
+000000000080228b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80228b:	55                   	push   %rbp
+  80228c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80228f:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  802296:	00 00 00 
+  802299:	ff d0                	call   *%rax
+  80229b:	83 e0 01             	and    $0x1,%eax
+}
+  80229e:	5d                   	pop    %rbp
+  80229f:	c3                   	ret
+
+00000000008022a0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8022a0:	55                   	push   %rbp
+  8022a1:	48 89 e5             	mov    %rsp,%rbp
+  8022a4:	41 57                	push   %r15
+  8022a6:	41 56                	push   %r14
+  8022a8:	41 55                	push   %r13
+  8022aa:	41 54                	push   %r12
+  8022ac:	53                   	push   %rbx
+  8022ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8022b1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022b5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8022b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8022be:	49 bd 8b 22 80 00 00 	movabs $0x80228b,%r13
+  8022c5:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8022c8:	49 bf 13 22 80 00 00 	movabs $0x802213,%r15
+  8022cf:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8022d2:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8022d9:	00 00 00 
+  8022dc:	eb 0c                	jmp    8022ea <foreach_shared_region+0x4a>
+  8022de:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022e5:	4c 39 f3             	cmp    %r14,%rbx
+  8022e8:	74 2e                	je     802318 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8022ea:	48 89 df             	mov    %rbx,%rdi
+  8022ed:	41 ff d5             	call   *%r13
+  8022f0:	84 c0                	test   %al,%al
+  8022f2:	74 ea                	je     8022de <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8022f4:	48 89 df             	mov    %rbx,%rdi
+  8022f7:	41 ff d7             	call   *%r15
+  8022fa:	a8 40                	test   $0x40,%al
+  8022fc:	74 e0                	je     8022de <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022fe:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802305:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802309:	48 89 df             	mov    %rbx,%rdi
+  80230c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802310:	ff d0                	call   *%rax
+				if (res < 0) {
+  802312:	85 c0                	test   %eax,%eax
+  802314:	79 c8                	jns    8022de <foreach_shared_region+0x3e>
+  802316:	eb 05                	jmp    80231d <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  802318:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80231d:	48 83 c4 18          	add    $0x18,%rsp
+  802321:	5b                   	pop    %rbx
+  802322:	41 5c                	pop    %r12
+  802324:	41 5d                	pop    %r13
+  802326:	41 5e                	pop    %r14
+  802328:	41 5f                	pop    %r15
+  80232a:	5d                   	pop    %rbp
+  80232b:	c3                   	ret
+
+000000000080232c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80232c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802331:	c3                   	ret
+
+0000000000802332 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+  802336:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802339:	48 be d4 3a 80 00 00 	movabs $0x803ad4,%rsi
+  802340:	00 00 00 
+  802343:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+    return 0;
+}
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	5d                   	pop    %rbp
+  802355:	c3                   	ret
+
+0000000000802356 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	41 57                	push   %r15
+  80235c:	41 56                	push   %r14
+  80235e:	41 55                	push   %r13
+  802360:	41 54                	push   %r12
+  802362:	53                   	push   %rbx
+  802363:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80236a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802371:	48 85 d2             	test   %rdx,%rdx
+  802374:	74 7a                	je     8023f0 <devcons_write+0x9a>
+  802376:	49 89 d6             	mov    %rdx,%r14
+  802379:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80237f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802384:	49 bf c6 31 80 00 00 	movabs $0x8031c6,%r15
+  80238b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80238e:	4c 89 f3             	mov    %r14,%rbx
+  802391:	48 29 f3             	sub    %rsi,%rbx
+  802394:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802399:	48 39 c3             	cmp    %rax,%rbx
+  80239c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8023a0:	4c 63 eb             	movslq %ebx,%r13
+  8023a3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8023aa:	48 01 c6             	add    %rax,%rsi
+  8023ad:	4c 89 ea             	mov    %r13,%rdx
+  8023b0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8023b7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8023ba:	4c 89 ee             	mov    %r13,%rsi
+  8023bd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8023c4:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  8023cb:	00 00 00 
+  8023ce:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8023d0:	41 01 dc             	add    %ebx,%r12d
+  8023d3:	49 63 f4             	movslq %r12d,%rsi
+  8023d6:	4c 39 f6             	cmp    %r14,%rsi
+  8023d9:	72 b3                	jb     80238e <devcons_write+0x38>
+    return res;
+  8023db:	49 63 c4             	movslq %r12d,%rax
+}
+  8023de:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8023e5:	5b                   	pop    %rbx
+  8023e6:	41 5c                	pop    %r12
+  8023e8:	41 5d                	pop    %r13
+  8023ea:	41 5e                	pop    %r14
+  8023ec:	41 5f                	pop    %r15
+  8023ee:	5d                   	pop    %rbp
+  8023ef:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8023f0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023f6:	eb e3                	jmp    8023db <devcons_write+0x85>
+
+00000000008023f8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023f8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802400:	48 85 c0             	test   %rax,%rax
+  802403:	74 55                	je     80245a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802405:	55                   	push   %rbp
+  802406:	48 89 e5             	mov    %rsp,%rbp
+  802409:	41 55                	push   %r13
+  80240b:	41 54                	push   %r12
+  80240d:	53                   	push   %rbx
+  80240e:	48 83 ec 08          	sub    $0x8,%rsp
+  802412:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802415:	48 bb 4f 01 80 00 00 	movabs $0x80014f,%rbx
+  80241c:	00 00 00 
+  80241f:	49 bc 1c 02 80 00 00 	movabs $0x80021c,%r12
+  802426:	00 00 00 
+  802429:	eb 03                	jmp    80242e <devcons_read+0x36>
+  80242b:	41 ff d4             	call   *%r12
+  80242e:	ff d3                	call   *%rbx
+  802430:	85 c0                	test   %eax,%eax
+  802432:	74 f7                	je     80242b <devcons_read+0x33>
+    if (c < 0) return c;
+  802434:	48 63 d0             	movslq %eax,%rdx
+  802437:	78 13                	js     80244c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802439:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243e:	83 f8 04             	cmp    $0x4,%eax
+  802441:	74 09                	je     80244c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802443:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802447:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80244c:	48 89 d0             	mov    %rdx,%rax
+  80244f:	48 83 c4 08          	add    $0x8,%rsp
+  802453:	5b                   	pop    %rbx
+  802454:	41 5c                	pop    %r12
+  802456:	41 5d                	pop    %r13
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+  80245a:	48 89 d0             	mov    %rdx,%rax
+  80245d:	c3                   	ret
+
+000000000080245e <cputchar>:
+cputchar(int ch) {
+  80245e:	55                   	push   %rbp
+  80245f:	48 89 e5             	mov    %rsp,%rbp
+  802462:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802466:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80246a:	be 01 00 00 00       	mov    $0x1,%esi
+  80246f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802473:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+}
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+
+0000000000802481 <getchar>:
+getchar(void) {
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802489:	ba 01 00 00 00       	mov    $0x1,%edx
+  80248e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802492:	bf 00 00 00 00       	mov    $0x0,%edi
+  802497:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 06                	js     8024af <getchar+0x2e>
+  8024a9:	74 08                	je     8024b3 <getchar+0x32>
+  8024ab:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8024af:	89 d0                	mov    %edx,%eax
+  8024b1:	c9                   	leave
+  8024b2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8024b3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8024b8:	eb f5                	jmp    8024af <getchar+0x2e>
+
+00000000008024ba <iscons>:
+iscons(int fdnum) {
+  8024ba:	55                   	push   %rbp
+  8024bb:	48 89 e5             	mov    %rsp,%rbp
+  8024be:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024c2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024c6:	48 b8 54 07 80 00 00 	movabs $0x800754,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	78 18                	js     8024ee <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8024d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024da:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8024e1:	00 00 00 
+  8024e4:	8b 00                	mov    (%rax),%eax
+  8024e6:	39 02                	cmp    %eax,(%rdx)
+  8024e8:	0f 94 c0             	sete   %al
+  8024eb:	0f b6 c0             	movzbl %al,%eax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+00000000008024f0 <opencons>:
+opencons(void) {
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  8024f4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024f8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024fc:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 49                	js     802555 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80250c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802511:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802516:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80251a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251f:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  802526:	00 00 00 
+  802529:	ff d0                	call   *%rax
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	78 26                	js     802555 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80252f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802533:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  80253a:	00 00 
+  80253c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80253e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802542:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802549:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+}
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+0000000000802557 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+  80255b:	41 56                	push   %r14
+  80255d:	41 55                	push   %r13
+  80255f:	41 54                	push   %r12
+  802561:	53                   	push   %rbx
+  802562:	48 83 ec 50          	sub    $0x50,%rsp
+  802566:	49 89 fc             	mov    %rdi,%r12
+  802569:	41 89 f5             	mov    %esi,%r13d
+  80256c:	48 89 d3             	mov    %rdx,%rbx
+  80256f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802573:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802577:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80257b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802582:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802586:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80258a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80258e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802592:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  802599:	00 00 00 
+  80259c:	4c 8b 30             	mov    (%rax),%r14
+  80259f:	48 b8 eb 01 80 00 00 	movabs $0x8001eb,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+  8025ab:	89 c6                	mov    %eax,%esi
+  8025ad:	45 89 e8             	mov    %r13d,%r8d
+  8025b0:	4c 89 e1             	mov    %r12,%rcx
+  8025b3:	4c 89 f2             	mov    %r14,%rdx
+  8025b6:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  8025bd:	00 00 00 
+  8025c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c5:	49 bc a7 26 80 00 00 	movabs $0x8026a7,%r12
+  8025cc:	00 00 00 
+  8025cf:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8025d2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8025d6:	48 89 df             	mov    %rbx,%rdi
+  8025d9:	48 b8 43 26 80 00 00 	movabs $0x802643,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+    cprintf("\n");
+  8025e5:	48 bf 23 3a 80 00 00 	movabs $0x803a23,%rdi
+  8025ec:	00 00 00 
+  8025ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8025f7:	cc                   	int3
+  8025f8:	eb fd                	jmp    8025f7 <_panic+0xa0>
+
+00000000008025fa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+  8025fe:	53                   	push   %rbx
+  8025ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802603:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802606:	8b 06                	mov    (%rsi),%eax
+  802608:	8d 50 01             	lea    0x1(%rax),%edx
+  80260b:	89 16                	mov    %edx,(%rsi)
+  80260d:	48 98                	cltq
+  80260f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802614:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80261a:	74 0a                	je     802626 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80261c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802624:	c9                   	leave
+  802625:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802626:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80262a:	be ff 00 00 00       	mov    $0xff,%esi
+  80262f:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+        state->offset = 0;
+  80263b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802641:	eb d9                	jmp    80261c <putch+0x22>
+
+0000000000802643 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802643:	55                   	push   %rbp
+  802644:	48 89 e5             	mov    %rsp,%rbp
+  802647:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80264e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802651:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802658:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802665:	48 89 f1             	mov    %rsi,%rcx
+  802668:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80266f:	48 bf fa 25 80 00 00 	movabs $0x8025fa,%rdi
+  802676:	00 00 00 
+  802679:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  802680:	00 00 00 
+  802683:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802685:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80268c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802693:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80269f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8026a5:	c9                   	leave
+  8026a6:	c3                   	ret
+
+00000000008026a7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8026a7:	55                   	push   %rbp
+  8026a8:	48 89 e5             	mov    %rsp,%rbp
+  8026ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8026af:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8026b3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8026b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8026bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8026bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8026c3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8026ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8026da:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8026de:	48 b8 43 26 80 00 00 	movabs $0x802643,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+00000000008026ec <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8026ec:	55                   	push   %rbp
+  8026ed:	48 89 e5             	mov    %rsp,%rbp
+  8026f0:	41 57                	push   %r15
+  8026f2:	41 56                	push   %r14
+  8026f4:	41 55                	push   %r13
+  8026f6:	41 54                	push   %r12
+  8026f8:	53                   	push   %rbx
+  8026f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8026fd:	49 89 fc             	mov    %rdi,%r12
+  802700:	49 89 f5             	mov    %rsi,%r13
+  802703:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802707:	8b 45 10             	mov    0x10(%rbp),%eax
+  80270a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80270d:	41 89 cf             	mov    %ecx,%r15d
+  802710:	4c 39 fa             	cmp    %r15,%rdx
+  802713:	73 5b                	jae    802770 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802715:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802719:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80271d:	85 db                	test   %ebx,%ebx
+  80271f:	7e 0e                	jle    80272f <print_num+0x43>
+            putch(padc, put_arg);
+  802721:	4c 89 ee             	mov    %r13,%rsi
+  802724:	44 89 f7             	mov    %r14d,%edi
+  802727:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80272a:	83 eb 01             	sub    $0x1,%ebx
+  80272d:	75 f2                	jne    802721 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80272f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802733:	48 b9 14 3b 80 00 00 	movabs $0x803b14,%rcx
+  80273a:	00 00 00 
+  80273d:	48 b8 03 3b 80 00 00 	movabs $0x803b03,%rax
+  802744:	00 00 00 
+  802747:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80274b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80274f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802754:	49 f7 f7             	div    %r15
+  802757:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80275b:	4c 89 ee             	mov    %r13,%rsi
+  80275e:	41 ff d4             	call   *%r12
+}
+  802761:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802765:	5b                   	pop    %rbx
+  802766:	41 5c                	pop    %r12
+  802768:	41 5d                	pop    %r13
+  80276a:	41 5e                	pop    %r14
+  80276c:	41 5f                	pop    %r15
+  80276e:	5d                   	pop    %rbp
+  80276f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802770:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	49 f7 f7             	div    %r15
+  80277c:	48 83 ec 08          	sub    $0x8,%rsp
+  802780:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802784:	52                   	push   %rdx
+  802785:	45 0f be c9          	movsbl %r9b,%r9d
+  802789:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80278d:	48 89 c2             	mov    %rax,%rdx
+  802790:	48 b8 ec 26 80 00 00 	movabs $0x8026ec,%rax
+  802797:	00 00 00 
+  80279a:	ff d0                	call   *%rax
+  80279c:	48 83 c4 10          	add    $0x10,%rsp
+  8027a0:	eb 8d                	jmp    80272f <print_num+0x43>
+
+00000000008027a2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8027a2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8027a6:	48 8b 06             	mov    (%rsi),%rax
+  8027a9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8027ad:	73 0a                	jae    8027b9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8027af:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8027b3:	48 89 16             	mov    %rdx,(%rsi)
+  8027b6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8027b9:	c3                   	ret
+
+00000000008027ba <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8027ba:	55                   	push   %rbp
+  8027bb:	48 89 e5             	mov    %rsp,%rbp
+  8027be:	48 83 ec 50          	sub    $0x50,%rsp
+  8027c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8027c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8027ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8027ce:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8027d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8027e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8027e5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8027e9:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  8027f0:	00 00 00 
+  8027f3:	ff d0                	call   *%rax
+}
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+00000000008027f7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8027f7:	55                   	push   %rbp
+  8027f8:	48 89 e5             	mov    %rsp,%rbp
+  8027fb:	41 57                	push   %r15
+  8027fd:	41 56                	push   %r14
+  8027ff:	41 55                	push   %r13
+  802801:	41 54                	push   %r12
+  802803:	53                   	push   %rbx
+  802804:	48 83 ec 38          	sub    $0x38,%rsp
+  802808:	49 89 fe             	mov    %rdi,%r14
+  80280b:	49 89 f5             	mov    %rsi,%r13
+  80280e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802811:	48 8b 01             	mov    (%rcx),%rax
+  802814:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802818:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80281c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802820:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802824:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802828:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80282c:	0f b6 3b             	movzbl (%rbx),%edi
+  80282f:	40 80 ff 25          	cmp    $0x25,%dil
+  802833:	74 18                	je     80284d <vprintfmt+0x56>
+            if (!ch) return;
+  802835:	40 84 ff             	test   %dil,%dil
+  802838:	0f 84 b1 06 00 00    	je     802eef <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80283e:	40 0f b6 ff          	movzbl %dil,%edi
+  802842:	4c 89 ee             	mov    %r13,%rsi
+  802845:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802848:	4c 89 e3             	mov    %r12,%rbx
+  80284b:	eb db                	jmp    802828 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80284d:	be 00 00 00 00       	mov    $0x0,%esi
+  802852:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802856:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80285b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802861:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802868:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80286c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802871:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802876:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802879:	83 e8 23             	sub    $0x23,%eax
+  80287c:	3c 57                	cmp    $0x57,%al
+  80287e:	0f 87 51 06 00 00    	ja     802ed5 <vprintfmt+0x6de>
+  802884:	0f b6 c0             	movzbl %al,%eax
+  802887:	48 b9 a0 3c 80 00 00 	movabs $0x803ca0,%rcx
+  80288e:	00 00 00 
+  802891:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802894:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802897:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80289b:	eb cf                	jmp    80286c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80289d:	49 89 dc             	mov    %rbx,%r12
+  8028a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8028a5:	eb c5                	jmp    80286c <vprintfmt+0x75>
+            padc = ch;
+  8028a7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8028ab:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8028ae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028b1:	eb b9                	jmp    80286c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8028b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8028b9:	77 24                	ja     8028df <vprintfmt+0xe8>
+  8028bb:	89 c1                	mov    %eax,%ecx
+  8028bd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8028c1:	83 c0 08             	add    $0x8,%eax
+  8028c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028c7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8028ca:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8028cd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8028d1:	79 99                	jns    80286c <vprintfmt+0x75>
+                width = precision;
+  8028d3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8028d7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8028dd:	eb 8d                	jmp    80286c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8028df:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8028e3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8028e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028eb:	eb da                	jmp    8028c7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8028ed:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8028f2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028f6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028fc:	3c 39                	cmp    $0x39,%al
+  8028fe:	77 1c                	ja     80291c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802900:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802904:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802908:	0f b6 c0             	movzbl %al,%eax
+  80290b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802910:	0f b6 03             	movzbl (%rbx),%eax
+  802913:	3c 39                	cmp    $0x39,%al
+  802915:	76 e9                	jbe    802900 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802917:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80291a:	eb b1                	jmp    8028cd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80291c:	49 89 dc             	mov    %rbx,%r12
+  80291f:	eb ac                	jmp    8028cd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802921:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802924:	85 c9                	test   %ecx,%ecx
+  802926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292b:	0f 49 c1             	cmovns %ecx,%eax
+  80292e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802931:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802934:	e9 33 ff ff ff       	jmp    80286c <vprintfmt+0x75>
+            lflag++;
+  802939:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80293c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80293f:	e9 28 ff ff ff       	jmp    80286c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802944:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802947:	83 f8 2f             	cmp    $0x2f,%eax
+  80294a:	77 19                	ja     802965 <vprintfmt+0x16e>
+  80294c:	89 c2                	mov    %eax,%edx
+  80294e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802952:	83 c0 08             	add    $0x8,%eax
+  802955:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802958:	8b 3a                	mov    (%rdx),%edi
+  80295a:	4c 89 ee             	mov    %r13,%rsi
+  80295d:	41 ff d6             	call   *%r14
+            break;
+  802960:	e9 c3 fe ff ff       	jmp    802828 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80296d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802971:	eb e5                	jmp    802958 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802973:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802976:	83 f8 2f             	cmp    $0x2f,%eax
+  802979:	77 5a                	ja     8029d5 <vprintfmt+0x1de>
+  80297b:	89 c2                	mov    %eax,%edx
+  80297d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802981:	83 c0 08             	add    $0x8,%eax
+  802984:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802987:	8b 02                	mov    (%rdx),%eax
+  802989:	89 c1                	mov    %eax,%ecx
+  80298b:	f7 d9                	neg    %ecx
+  80298d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802990:	83 f9 14             	cmp    $0x14,%ecx
+  802993:	7f 4e                	jg     8029e3 <vprintfmt+0x1ec>
+  802995:	48 63 c1             	movslq %ecx,%rax
+  802998:	48 ba 60 3f 80 00 00 	movabs $0x803f60,%rdx
+  80299f:	00 00 00 
+  8029a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029a6:	48 85 c0             	test   %rax,%rax
+  8029a9:	74 38                	je     8029e3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8029ab:	48 89 c1             	mov    %rax,%rcx
+  8029ae:	48 ba 99 3a 80 00 00 	movabs $0x803a99,%rdx
+  8029b5:	00 00 00 
+  8029b8:	4c 89 ee             	mov    %r13,%rsi
+  8029bb:	4c 89 f7             	mov    %r14,%rdi
+  8029be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c3:	49 b8 ba 27 80 00 00 	movabs $0x8027ba,%r8
+  8029ca:	00 00 00 
+  8029cd:	41 ff d0             	call   *%r8
+  8029d0:	e9 53 fe ff ff       	jmp    802828 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8029d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029e1:	eb a4                	jmp    802987 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8029e3:	48 ba 2c 3b 80 00 00 	movabs $0x803b2c,%rdx
+  8029ea:	00 00 00 
+  8029ed:	4c 89 ee             	mov    %r13,%rsi
+  8029f0:	4c 89 f7             	mov    %r14,%rdi
+  8029f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f8:	49 b8 ba 27 80 00 00 	movabs $0x8027ba,%r8
+  8029ff:	00 00 00 
+  802a02:	41 ff d0             	call   *%r8
+  802a05:	e9 1e fe ff ff       	jmp    802828 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  802a10:	77 6c                	ja     802a7e <vprintfmt+0x287>
+  802a12:	89 c2                	mov    %eax,%edx
+  802a14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a18:	83 c0 08             	add    $0x8,%eax
+  802a1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a1e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802a21:	48 85 d2             	test   %rdx,%rdx
+  802a24:	48 b8 25 3b 80 00 00 	movabs $0x803b25,%rax
+  802a2b:	00 00 00 
+  802a2e:	48 0f 45 c2          	cmovne %rdx,%rax
+  802a32:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802a36:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802a3a:	7e 06                	jle    802a42 <vprintfmt+0x24b>
+  802a3c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802a40:	75 4a                	jne    802a8c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a42:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802a46:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802a4a:	0f b6 00             	movzbl (%rax),%eax
+  802a4d:	84 c0                	test   %al,%al
+  802a4f:	0f 85 9a 00 00 00    	jne    802aef <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802a55:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a58:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	0f 8e c4 fd ff ff    	jle    802828 <vprintfmt+0x31>
+  802a64:	4c 89 ee             	mov    %r13,%rsi
+  802a67:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a6c:	41 ff d6             	call   *%r14
+  802a6f:	41 83 ec 01          	sub    $0x1,%r12d
+  802a73:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a77:	75 eb                	jne    802a64 <vprintfmt+0x26d>
+  802a79:	e9 aa fd ff ff       	jmp    802828 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a8a:	eb 92                	jmp    802a1e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a8c:	49 63 f7             	movslq %r15d,%rsi
+  802a8f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a93:	48 b8 a9 2f 80 00 00 	movabs $0x802fa9,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+  802a9f:	48 89 c2             	mov    %rax,%rdx
+  802aa2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802aa5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802aa7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802aaa:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	7e 91                	jle    802a42 <vprintfmt+0x24b>
+  802ab1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802ab6:	4c 89 ee             	mov    %r13,%rsi
+  802ab9:	44 89 e7             	mov    %r12d,%edi
+  802abc:	41 ff d6             	call   *%r14
+  802abf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802ac3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802ac6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802ac9:	75 eb                	jne    802ab6 <vprintfmt+0x2bf>
+  802acb:	e9 72 ff ff ff       	jmp    802a42 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802ad0:	0f b6 f8             	movzbl %al,%edi
+  802ad3:	4c 89 ee             	mov    %r13,%rsi
+  802ad6:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802ad9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802add:	49 83 c4 01          	add    $0x1,%r12
+  802ae1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802ae7:	84 c0                	test   %al,%al
+  802ae9:	0f 84 66 ff ff ff    	je     802a55 <vprintfmt+0x25e>
+  802aef:	45 85 ff             	test   %r15d,%r15d
+  802af2:	78 0a                	js     802afe <vprintfmt+0x307>
+  802af4:	41 83 ef 01          	sub    $0x1,%r15d
+  802af8:	0f 88 57 ff ff ff    	js     802a55 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802afe:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802b02:	74 cc                	je     802ad0 <vprintfmt+0x2d9>
+  802b04:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802b07:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802b0c:	80 fa 5e             	cmp    $0x5e,%dl
+  802b0f:	77 c2                	ja     802ad3 <vprintfmt+0x2dc>
+  802b11:	eb bd                	jmp    802ad0 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802b13:	40 84 f6             	test   %sil,%sil
+  802b16:	75 26                	jne    802b3e <vprintfmt+0x347>
+    switch (lflag) {
+  802b18:	85 d2                	test   %edx,%edx
+  802b1a:	74 59                	je     802b75 <vprintfmt+0x37e>
+  802b1c:	83 fa 01             	cmp    $0x1,%edx
+  802b1f:	74 7b                	je     802b9c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802b21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b24:	83 f8 2f             	cmp    $0x2f,%eax
+  802b27:	0f 87 96 00 00 00    	ja     802bc3 <vprintfmt+0x3cc>
+  802b2d:	89 c2                	mov    %eax,%edx
+  802b2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b33:	83 c0 08             	add    $0x8,%eax
+  802b36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b39:	4c 8b 22             	mov    (%rdx),%r12
+  802b3c:	eb 17                	jmp    802b55 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802b3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b41:	83 f8 2f             	cmp    $0x2f,%eax
+  802b44:	77 21                	ja     802b67 <vprintfmt+0x370>
+  802b46:	89 c2                	mov    %eax,%edx
+  802b48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b4c:	83 c0 08             	add    $0x8,%eax
+  802b4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b52:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802b55:	4d 85 e4             	test   %r12,%r12
+  802b58:	78 7a                	js     802bd4 <vprintfmt+0x3dd>
+            num = i;
+  802b5a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b5d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b62:	e9 50 02 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b73:	eb dd                	jmp    802b52 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b78:	83 f8 2f             	cmp    $0x2f,%eax
+  802b7b:	77 11                	ja     802b8e <vprintfmt+0x397>
+  802b7d:	89 c2                	mov    %eax,%edx
+  802b7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b83:	83 c0 08             	add    $0x8,%eax
+  802b86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b89:	4c 63 22             	movslq (%rdx),%r12
+  802b8c:	eb c7                	jmp    802b55 <vprintfmt+0x35e>
+  802b8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b9a:	eb ed                	jmp    802b89 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  802ba2:	77 11                	ja     802bb5 <vprintfmt+0x3be>
+  802ba4:	89 c2                	mov    %eax,%edx
+  802ba6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802baa:	83 c0 08             	add    $0x8,%eax
+  802bad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bb0:	4c 8b 22             	mov    (%rdx),%r12
+  802bb3:	eb a0                	jmp    802b55 <vprintfmt+0x35e>
+  802bb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bc1:	eb ed                	jmp    802bb0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802bc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bcf:	e9 65 ff ff ff       	jmp    802b39 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802bd4:	4c 89 ee             	mov    %r13,%rsi
+  802bd7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802bdc:	41 ff d6             	call   *%r14
+                i = -i;
+  802bdf:	49 f7 dc             	neg    %r12
+  802be2:	e9 73 ff ff ff       	jmp    802b5a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802be7:	40 84 f6             	test   %sil,%sil
+  802bea:	75 32                	jne    802c1e <vprintfmt+0x427>
+    switch (lflag) {
+  802bec:	85 d2                	test   %edx,%edx
+  802bee:	74 5d                	je     802c4d <vprintfmt+0x456>
+  802bf0:	83 fa 01             	cmp    $0x1,%edx
+  802bf3:	0f 84 82 00 00 00    	je     802c7b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  802bff:	0f 87 a5 00 00 00    	ja     802caa <vprintfmt+0x4b3>
+  802c05:	89 c2                	mov    %eax,%edx
+  802c07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c0b:	83 c0 08             	add    $0x8,%eax
+  802c0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c11:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c14:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c19:	e9 99 01 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c21:	83 f8 2f             	cmp    $0x2f,%eax
+  802c24:	77 19                	ja     802c3f <vprintfmt+0x448>
+  802c26:	89 c2                	mov    %eax,%edx
+  802c28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c2c:	83 c0 08             	add    $0x8,%eax
+  802c2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c32:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c35:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c3a:	e9 78 01 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+  802c3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c4b:	eb e5                	jmp    802c32 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c50:	83 f8 2f             	cmp    $0x2f,%eax
+  802c53:	77 18                	ja     802c6d <vprintfmt+0x476>
+  802c55:	89 c2                	mov    %eax,%edx
+  802c57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c5b:	83 c0 08             	add    $0x8,%eax
+  802c5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c61:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c63:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c68:	e9 4a 01 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+  802c6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c79:	eb e6                	jmp    802c61 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c7e:	83 f8 2f             	cmp    $0x2f,%eax
+  802c81:	77 19                	ja     802c9c <vprintfmt+0x4a5>
+  802c83:	89 c2                	mov    %eax,%edx
+  802c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c89:	83 c0 08             	add    $0x8,%eax
+  802c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c92:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c97:	e9 1b 01 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+  802c9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ca0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ca4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ca8:	eb e5                	jmp    802c8f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802caa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cb6:	e9 56 ff ff ff       	jmp    802c11 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802cbb:	40 84 f6             	test   %sil,%sil
+  802cbe:	75 2e                	jne    802cee <vprintfmt+0x4f7>
+    switch (lflag) {
+  802cc0:	85 d2                	test   %edx,%edx
+  802cc2:	74 59                	je     802d1d <vprintfmt+0x526>
+  802cc4:	83 fa 01             	cmp    $0x1,%edx
+  802cc7:	74 7f                	je     802d48 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802cc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ccc:	83 f8 2f             	cmp    $0x2f,%eax
+  802ccf:	0f 87 9f 00 00 00    	ja     802d74 <vprintfmt+0x57d>
+  802cd5:	89 c2                	mov    %eax,%edx
+  802cd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cdb:	83 c0 08             	add    $0x8,%eax
+  802cde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ce1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802ce4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802ce9:	e9 c9 00 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802cee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf1:	83 f8 2f             	cmp    $0x2f,%eax
+  802cf4:	77 19                	ja     802d0f <vprintfmt+0x518>
+  802cf6:	89 c2                	mov    %eax,%edx
+  802cf8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cfc:	83 c0 08             	add    $0x8,%eax
+  802cff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d05:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802d0a:	e9 a8 00 00 00       	jmp    802db7 <vprintfmt+0x5c0>
+  802d0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d1b:	eb e5                	jmp    802d02 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802d1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d20:	83 f8 2f             	cmp    $0x2f,%eax
+  802d23:	77 15                	ja     802d3a <vprintfmt+0x543>
+  802d25:	89 c2                	mov    %eax,%edx
+  802d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d2b:	83 c0 08             	add    $0x8,%eax
+  802d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d31:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802d33:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802d38:	eb 7d                	jmp    802db7 <vprintfmt+0x5c0>
+  802d3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d46:	eb e9                	jmp    802d31 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802d48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  802d4e:	77 16                	ja     802d66 <vprintfmt+0x56f>
+  802d50:	89 c2                	mov    %eax,%edx
+  802d52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d56:	83 c0 08             	add    $0x8,%eax
+  802d59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d5f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d64:	eb 51                	jmp    802db7 <vprintfmt+0x5c0>
+  802d66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d72:	eb e8                	jmp    802d5c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d80:	e9 5c ff ff ff       	jmp    802ce1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d85:	4c 89 ee             	mov    %r13,%rsi
+  802d88:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d8d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d90:	4c 89 ee             	mov    %r13,%rsi
+  802d93:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d98:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d9e:	83 f8 2f             	cmp    $0x2f,%eax
+  802da1:	77 47                	ja     802dea <vprintfmt+0x5f3>
+  802da3:	89 c2                	mov    %eax,%edx
+  802da5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802da9:	83 c0 08             	add    $0x8,%eax
+  802dac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802daf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802db2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802db7:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802dbf:	0f 94 c0             	sete   %al
+  802dc2:	0f b6 c0             	movzbl %al,%eax
+  802dc5:	50                   	push   %rax
+  802dc6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802dcb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802dcf:	4c 89 ee             	mov    %r13,%rsi
+  802dd2:	4c 89 f7             	mov    %r14,%rdi
+  802dd5:	48 b8 ec 26 80 00 00 	movabs $0x8026ec,%rax
+  802ddc:	00 00 00 
+  802ddf:	ff d0                	call   *%rax
+            break;
+  802de1:	48 83 c4 10          	add    $0x10,%rsp
+  802de5:	e9 3e fa ff ff       	jmp    802828 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802dea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802df2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802df6:	eb b7                	jmp    802daf <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802df8:	40 84 f6             	test   %sil,%sil
+  802dfb:	75 2b                	jne    802e28 <vprintfmt+0x631>
+    switch (lflag) {
+  802dfd:	85 d2                	test   %edx,%edx
+  802dff:	74 56                	je     802e57 <vprintfmt+0x660>
+  802e01:	83 fa 01             	cmp    $0x1,%edx
+  802e04:	74 7f                	je     802e85 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802e06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e09:	83 f8 2f             	cmp    $0x2f,%eax
+  802e0c:	0f 87 a2 00 00 00    	ja     802eb4 <vprintfmt+0x6bd>
+  802e12:	89 c2                	mov    %eax,%edx
+  802e14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e18:	83 c0 08             	add    $0x8,%eax
+  802e1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802e26:	eb 8f                	jmp    802db7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802e28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e2b:	83 f8 2f             	cmp    $0x2f,%eax
+  802e2e:	77 19                	ja     802e49 <vprintfmt+0x652>
+  802e30:	89 c2                	mov    %eax,%edx
+  802e32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e36:	83 c0 08             	add    $0x8,%eax
+  802e39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802e44:	e9 6e ff ff ff       	jmp    802db7 <vprintfmt+0x5c0>
+  802e49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e55:	eb e5                	jmp    802e3c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802e57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e5a:	83 f8 2f             	cmp    $0x2f,%eax
+  802e5d:	77 18                	ja     802e77 <vprintfmt+0x680>
+  802e5f:	89 c2                	mov    %eax,%edx
+  802e61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e65:	83 c0 08             	add    $0x8,%eax
+  802e68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e6b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e72:	e9 40 ff ff ff       	jmp    802db7 <vprintfmt+0x5c0>
+  802e77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e83:	eb e6                	jmp    802e6b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e88:	83 f8 2f             	cmp    $0x2f,%eax
+  802e8b:	77 19                	ja     802ea6 <vprintfmt+0x6af>
+  802e8d:	89 c2                	mov    %eax,%edx
+  802e8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e93:	83 c0 08             	add    $0x8,%eax
+  802e96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802ea1:	e9 11 ff ff ff       	jmp    802db7 <vprintfmt+0x5c0>
+  802ea6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802eaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802eb2:	eb e5                	jmp    802e99 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec0:	e9 59 ff ff ff       	jmp    802e1e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802ec5:	4c 89 ee             	mov    %r13,%rsi
+  802ec8:	bf 25 00 00 00       	mov    $0x25,%edi
+  802ecd:	41 ff d6             	call   *%r14
+            break;
+  802ed0:	e9 53 f9 ff ff       	jmp    802828 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802ed5:	4c 89 ee             	mov    %r13,%rsi
+  802ed8:	bf 25 00 00 00       	mov    $0x25,%edi
+  802edd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802ee0:	48 83 eb 01          	sub    $0x1,%rbx
+  802ee4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802ee8:	75 f6                	jne    802ee0 <vprintfmt+0x6e9>
+  802eea:	e9 39 f9 ff ff       	jmp    802828 <vprintfmt+0x31>
+}
+  802eef:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802ef3:	5b                   	pop    %rbx
+  802ef4:	41 5c                	pop    %r12
+  802ef6:	41 5d                	pop    %r13
+  802ef8:	41 5e                	pop    %r14
+  802efa:	41 5f                	pop    %r15
+  802efc:	5d                   	pop    %rbp
+  802efd:	c3                   	ret
+
+0000000000802efe <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802f06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f0a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802f0f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802f13:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802f1a:	48 85 ff             	test   %rdi,%rdi
+  802f1d:	74 2b                	je     802f4a <vsnprintf+0x4c>
+  802f1f:	48 85 f6             	test   %rsi,%rsi
+  802f22:	74 26                	je     802f4a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802f24:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802f28:	48 bf a2 27 80 00 00 	movabs $0x8027a2,%rdi
+  802f2f:	00 00 00 
+  802f32:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f42:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802f45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802f4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f4f:	eb f7                	jmp    802f48 <vsnprintf+0x4a>
+
+0000000000802f51 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802f51:	55                   	push   %rbp
+  802f52:	48 89 e5             	mov    %rsp,%rbp
+  802f55:	48 83 ec 50          	sub    $0x50,%rsp
+  802f59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f65:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f7c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f80:	48 b8 fe 2e 80 00 00 	movabs $0x802efe,%rax
+  802f87:	00 00 00 
+  802f8a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f8c:	c9                   	leave
+  802f8d:	c3                   	ret
+
+0000000000802f8e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f8e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f91:	74 10                	je     802fa3 <strlen+0x15>
+    size_t n = 0;
+  802f93:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f98:	48 83 c0 01          	add    $0x1,%rax
+  802f9c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802fa0:	75 f6                	jne    802f98 <strlen+0xa>
+  802fa2:	c3                   	ret
+    size_t n = 0;
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802fa8:	c3                   	ret
+
+0000000000802fa9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802fa9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802fac:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802fb1:	48 85 f6             	test   %rsi,%rsi
+  802fb4:	74 11                	je     802fc7 <strnlen+0x1e>
+  802fb6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802fba:	74 0c                	je     802fc8 <strnlen+0x1f>
+  802fbc:	48 83 c2 01          	add    $0x1,%rdx
+  802fc0:	48 39 d0             	cmp    %rdx,%rax
+  802fc3:	75 f1                	jne    802fb6 <strnlen+0xd>
+  802fc5:	eb 04                	jmp    802fcb <strnlen+0x22>
+  802fc7:	c3                   	ret
+  802fc8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802fcb:	c3                   	ret
+
+0000000000802fcc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802fcc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802fd8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802fdb:	48 83 c2 01          	add    $0x1,%rdx
+  802fdf:	84 c9                	test   %cl,%cl
+  802fe1:	75 f1                	jne    802fd4 <strcpy+0x8>
+        ;
+    return res;
+}
+  802fe3:	c3                   	ret
+
+0000000000802fe4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802fe4:	55                   	push   %rbp
+  802fe5:	48 89 e5             	mov    %rsp,%rbp
+  802fe8:	41 54                	push   %r12
+  802fea:	53                   	push   %rbx
+  802feb:	48 89 fb             	mov    %rdi,%rbx
+  802fee:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802ff1:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802ffd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803001:	4c 89 e6             	mov    %r12,%rsi
+  803004:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  80300b:	00 00 00 
+  80300e:	ff d0                	call   *%rax
+    return dst;
+}
+  803010:	48 89 d8             	mov    %rbx,%rax
+  803013:	5b                   	pop    %rbx
+  803014:	41 5c                	pop    %r12
+  803016:	5d                   	pop    %rbp
+  803017:	c3                   	ret
+
+0000000000803018 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803018:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80301b:	48 85 d2             	test   %rdx,%rdx
+  80301e:	74 1f                	je     80303f <strncpy+0x27>
+  803020:	48 01 fa             	add    %rdi,%rdx
+  803023:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803026:	48 83 c1 01          	add    $0x1,%rcx
+  80302a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80302e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803032:	41 80 f8 01          	cmp    $0x1,%r8b
+  803036:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80303a:	48 39 ca             	cmp    %rcx,%rdx
+  80303d:	75 e7                	jne    803026 <strncpy+0xe>
+    }
+    return ret;
+}
+  80303f:	c3                   	ret
+
+0000000000803040 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803040:	48 89 f8             	mov    %rdi,%rax
+  803043:	48 85 d2             	test   %rdx,%rdx
+  803046:	74 24                	je     80306c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803048:	48 83 ea 01          	sub    $0x1,%rdx
+  80304c:	74 1b                	je     803069 <strlcpy+0x29>
+  80304e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803052:	0f b6 16             	movzbl (%rsi),%edx
+  803055:	84 d2                	test   %dl,%dl
+  803057:	74 10                	je     803069 <strlcpy+0x29>
+            *dst++ = *src++;
+  803059:	48 83 c6 01          	add    $0x1,%rsi
+  80305d:	48 83 c0 01          	add    $0x1,%rax
+  803061:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803064:	48 39 c8             	cmp    %rcx,%rax
+  803067:	75 e9                	jne    803052 <strlcpy+0x12>
+        *dst = '\0';
+  803069:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80306c:	48 29 f8             	sub    %rdi,%rax
+}
+  80306f:	c3                   	ret
+
+0000000000803070 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803070:	0f b6 07             	movzbl (%rdi),%eax
+  803073:	84 c0                	test   %al,%al
+  803075:	74 13                	je     80308a <strcmp+0x1a>
+  803077:	38 06                	cmp    %al,(%rsi)
+  803079:	75 0f                	jne    80308a <strcmp+0x1a>
+  80307b:	48 83 c7 01          	add    $0x1,%rdi
+  80307f:	48 83 c6 01          	add    $0x1,%rsi
+  803083:	0f b6 07             	movzbl (%rdi),%eax
+  803086:	84 c0                	test   %al,%al
+  803088:	75 ed                	jne    803077 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80308a:	0f b6 c0             	movzbl %al,%eax
+  80308d:	0f b6 16             	movzbl (%rsi),%edx
+  803090:	29 d0                	sub    %edx,%eax
+}
+  803092:	c3                   	ret
+
+0000000000803093 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803093:	48 85 d2             	test   %rdx,%rdx
+  803096:	74 1f                	je     8030b7 <strncmp+0x24>
+  803098:	0f b6 07             	movzbl (%rdi),%eax
+  80309b:	84 c0                	test   %al,%al
+  80309d:	74 1e                	je     8030bd <strncmp+0x2a>
+  80309f:	3a 06                	cmp    (%rsi),%al
+  8030a1:	75 1a                	jne    8030bd <strncmp+0x2a>
+  8030a3:	48 83 c7 01          	add    $0x1,%rdi
+  8030a7:	48 83 c6 01          	add    $0x1,%rsi
+  8030ab:	48 83 ea 01          	sub    $0x1,%rdx
+  8030af:	75 e7                	jne    803098 <strncmp+0x5>
+
+    if (!n) return 0;
+  8030b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b6:	c3                   	ret
+  8030b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bc:	c3                   	ret
+  8030bd:	48 85 d2             	test   %rdx,%rdx
+  8030c0:	74 09                	je     8030cb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8030c2:	0f b6 07             	movzbl (%rdi),%eax
+  8030c5:	0f b6 16             	movzbl (%rsi),%edx
+  8030c8:	29 d0                	sub    %edx,%eax
+  8030ca:	c3                   	ret
+    if (!n) return 0;
+  8030cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d0:	c3                   	ret
+
+00000000008030d1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8030d1:	0f b6 17             	movzbl (%rdi),%edx
+  8030d4:	84 d2                	test   %dl,%dl
+  8030d6:	74 18                	je     8030f0 <strchr+0x1f>
+        if (*str == c) {
+  8030d8:	0f be d2             	movsbl %dl,%edx
+  8030db:	39 f2                	cmp    %esi,%edx
+  8030dd:	74 17                	je     8030f6 <strchr+0x25>
+    for (; *str; str++) {
+  8030df:	48 83 c7 01          	add    $0x1,%rdi
+  8030e3:	0f b6 17             	movzbl (%rdi),%edx
+  8030e6:	84 d2                	test   %dl,%dl
+  8030e8:	75 ee                	jne    8030d8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8030ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ef:	c3                   	ret
+  8030f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f5:	c3                   	ret
+  8030f6:	48 89 f8             	mov    %rdi,%rax
+}
+  8030f9:	c3                   	ret
+
+00000000008030fa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8030fa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030fd:	0f b6 17             	movzbl (%rdi),%edx
+  803100:	84 d2                	test   %dl,%dl
+  803102:	74 13                	je     803117 <strfind+0x1d>
+  803104:	0f be d2             	movsbl %dl,%edx
+  803107:	39 f2                	cmp    %esi,%edx
+  803109:	74 0b                	je     803116 <strfind+0x1c>
+  80310b:	48 83 c0 01          	add    $0x1,%rax
+  80310f:	0f b6 10             	movzbl (%rax),%edx
+  803112:	84 d2                	test   %dl,%dl
+  803114:	75 ee                	jne    803104 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803116:	c3                   	ret
+  803117:	c3                   	ret
+
+0000000000803118 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803118:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80311b:	48 89 f8             	mov    %rdi,%rax
+  80311e:	48 f7 d8             	neg    %rax
+  803121:	83 e0 07             	and    $0x7,%eax
+  803124:	49 89 d1             	mov    %rdx,%r9
+  803127:	49 29 c1             	sub    %rax,%r9
+  80312a:	78 36                	js     803162 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80312c:	40 0f b6 c6          	movzbl %sil,%eax
+  803130:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803137:	01 01 01 
+  80313a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80313e:	40 f6 c7 07          	test   $0x7,%dil
+  803142:	75 38                	jne    80317c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803144:	4c 89 c9             	mov    %r9,%rcx
+  803147:	48 c1 f9 03          	sar    $0x3,%rcx
+  80314b:	74 0c                	je     803159 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80314d:	fc                   	cld
+  80314e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803151:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803155:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803159:	4d 85 c9             	test   %r9,%r9
+  80315c:	75 45                	jne    8031a3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80315e:	4c 89 c0             	mov    %r8,%rax
+  803161:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803162:	48 85 d2             	test   %rdx,%rdx
+  803165:	74 f7                	je     80315e <memset+0x46>
+  803167:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80316a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80316d:	48 83 c0 01          	add    $0x1,%rax
+  803171:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803175:	48 39 c2             	cmp    %rax,%rdx
+  803178:	75 f3                	jne    80316d <memset+0x55>
+  80317a:	eb e2                	jmp    80315e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80317c:	40 f6 c7 01          	test   $0x1,%dil
+  803180:	74 06                	je     803188 <memset+0x70>
+  803182:	88 07                	mov    %al,(%rdi)
+  803184:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803188:	40 f6 c7 02          	test   $0x2,%dil
+  80318c:	74 07                	je     803195 <memset+0x7d>
+  80318e:	66 89 07             	mov    %ax,(%rdi)
+  803191:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803195:	40 f6 c7 04          	test   $0x4,%dil
+  803199:	74 a9                	je     803144 <memset+0x2c>
+  80319b:	89 07                	mov    %eax,(%rdi)
+  80319d:	48 83 c7 04          	add    $0x4,%rdi
+  8031a1:	eb a1                	jmp    803144 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8031a3:	41 f6 c1 04          	test   $0x4,%r9b
+  8031a7:	74 06                	je     8031af <memset+0x97>
+  8031a9:	89 07                	mov    %eax,(%rdi)
+  8031ab:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8031af:	41 f6 c1 02          	test   $0x2,%r9b
+  8031b3:	74 07                	je     8031bc <memset+0xa4>
+  8031b5:	66 89 07             	mov    %ax,(%rdi)
+  8031b8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8031bc:	41 f6 c1 01          	test   $0x1,%r9b
+  8031c0:	74 9c                	je     80315e <memset+0x46>
+  8031c2:	88 07                	mov    %al,(%rdi)
+  8031c4:	eb 98                	jmp    80315e <memset+0x46>
+
+00000000008031c6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8031c6:	48 89 f8             	mov    %rdi,%rax
+  8031c9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8031cc:	48 39 fe             	cmp    %rdi,%rsi
+  8031cf:	73 3b                	jae    80320c <memmove+0x46>
+  8031d1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8031d5:	48 39 d7             	cmp    %rdx,%rdi
+  8031d8:	73 32                	jae    80320c <memmove+0x46>
+        s += n;
+        d += n;
+  8031da:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031de:	48 89 d6             	mov    %rdx,%rsi
+  8031e1:	48 09 fe             	or     %rdi,%rsi
+  8031e4:	48 09 ce             	or     %rcx,%rsi
+  8031e7:	40 f6 c6 07          	test   $0x7,%sil
+  8031eb:	75 12                	jne    8031ff <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8031ed:	48 83 ef 08          	sub    $0x8,%rdi
+  8031f1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8031f5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031f9:	fd                   	std
+  8031fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031fd:	fc                   	cld
+  8031fe:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031ff:	48 83 ef 01          	sub    $0x1,%rdi
+  803203:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803207:	fd                   	std
+  803208:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80320a:	eb f1                	jmp    8031fd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80320c:	48 89 f2             	mov    %rsi,%rdx
+  80320f:	48 09 c2             	or     %rax,%rdx
+  803212:	48 09 ca             	or     %rcx,%rdx
+  803215:	f6 c2 07             	test   $0x7,%dl
+  803218:	75 0c                	jne    803226 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80321a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80321e:	48 89 c7             	mov    %rax,%rdi
+  803221:	fc                   	cld
+  803222:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803225:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803226:	48 89 c7             	mov    %rax,%rdi
+  803229:	fc                   	cld
+  80322a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80322c:	c3                   	ret
+
+000000000080322d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80322d:	55                   	push   %rbp
+  80322e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803231:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  803238:	00 00 00 
+  80323b:	ff d0                	call   *%rax
+}
+  80323d:	5d                   	pop    %rbp
+  80323e:	c3                   	ret
+
+000000000080323f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80323f:	55                   	push   %rbp
+  803240:	48 89 e5             	mov    %rsp,%rbp
+  803243:	41 57                	push   %r15
+  803245:	41 56                	push   %r14
+  803247:	41 55                	push   %r13
+  803249:	41 54                	push   %r12
+  80324b:	53                   	push   %rbx
+  80324c:	48 83 ec 08          	sub    $0x8,%rsp
+  803250:	49 89 fe             	mov    %rdi,%r14
+  803253:	49 89 f7             	mov    %rsi,%r15
+  803256:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803259:	48 89 f7             	mov    %rsi,%rdi
+  80325c:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+  803268:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80326b:	48 89 de             	mov    %rbx,%rsi
+  80326e:	4c 89 f7             	mov    %r14,%rdi
+  803271:	48 b8 a9 2f 80 00 00 	movabs $0x802fa9,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+  80327d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803280:	48 39 c3             	cmp    %rax,%rbx
+  803283:	74 36                	je     8032bb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803285:	48 89 d8             	mov    %rbx,%rax
+  803288:	4c 29 e8             	sub    %r13,%rax
+  80328b:	49 39 c4             	cmp    %rax,%r12
+  80328e:	73 31                	jae    8032c1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803290:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803295:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803299:	4c 89 fe             	mov    %r15,%rsi
+  80329c:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  8032a3:	00 00 00 
+  8032a6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8032a8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8032ac:	48 83 c4 08          	add    $0x8,%rsp
+  8032b0:	5b                   	pop    %rbx
+  8032b1:	41 5c                	pop    %r12
+  8032b3:	41 5d                	pop    %r13
+  8032b5:	41 5e                	pop    %r14
+  8032b7:	41 5f                	pop    %r15
+  8032b9:	5d                   	pop    %rbp
+  8032ba:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8032bb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8032bf:	eb eb                	jmp    8032ac <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8032c1:	48 83 eb 01          	sub    $0x1,%rbx
+  8032c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8032c9:	48 89 da             	mov    %rbx,%rdx
+  8032cc:	4c 89 fe             	mov    %r15,%rsi
+  8032cf:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8032db:	49 01 de             	add    %rbx,%r14
+  8032de:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8032e3:	eb c3                	jmp    8032a8 <strlcat+0x69>
+
+00000000008032e5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8032e5:	48 85 d2             	test   %rdx,%rdx
+  8032e8:	74 2d                	je     803317 <memcmp+0x32>
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8032ef:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8032f3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8032f8:	44 38 c1             	cmp    %r8b,%cl
+  8032fb:	75 0f                	jne    80330c <memcmp+0x27>
+    while (n-- > 0) {
+  8032fd:	48 83 c0 01          	add    $0x1,%rax
+  803301:	48 39 c2             	cmp    %rax,%rdx
+  803304:	75 e9                	jne    8032ef <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80330c:	0f b6 c1             	movzbl %cl,%eax
+  80330f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803313:	44 29 c0             	sub    %r8d,%eax
+  803316:	c3                   	ret
+    return 0;
+  803317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331c:	c3                   	ret
+
+000000000080331d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80331d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803321:	48 39 c7             	cmp    %rax,%rdi
+  803324:	73 0f                	jae    803335 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803326:	40 38 37             	cmp    %sil,(%rdi)
+  803329:	74 0e                	je     803339 <memfind+0x1c>
+    for (; src < end; src++) {
+  80332b:	48 83 c7 01          	add    $0x1,%rdi
+  80332f:	48 39 f8             	cmp    %rdi,%rax
+  803332:	75 f2                	jne    803326 <memfind+0x9>
+  803334:	c3                   	ret
+  803335:	48 89 f8             	mov    %rdi,%rax
+  803338:	c3                   	ret
+  803339:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80333c:	c3                   	ret
+
+000000000080333d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80333d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803340:	0f b6 37             	movzbl (%rdi),%esi
+  803343:	40 80 fe 20          	cmp    $0x20,%sil
+  803347:	74 06                	je     80334f <strtol+0x12>
+  803349:	40 80 fe 09          	cmp    $0x9,%sil
+  80334d:	75 13                	jne    803362 <strtol+0x25>
+  80334f:	48 83 c7 01          	add    $0x1,%rdi
+  803353:	0f b6 37             	movzbl (%rdi),%esi
+  803356:	40 80 fe 20          	cmp    $0x20,%sil
+  80335a:	74 f3                	je     80334f <strtol+0x12>
+  80335c:	40 80 fe 09          	cmp    $0x9,%sil
+  803360:	74 ed                	je     80334f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803362:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803365:	83 e0 fd             	and    $0xfffffffd,%eax
+  803368:	3c 01                	cmp    $0x1,%al
+  80336a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80336e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803374:	75 0f                	jne    803385 <strtol+0x48>
+  803376:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803379:	74 14                	je     80338f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80337b:	85 d2                	test   %edx,%edx
+  80337d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803382:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80338a:	4c 63 ca             	movslq %edx,%r9
+  80338d:	eb 36                	jmp    8033c5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80338f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803393:	74 0f                	je     8033a4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803395:	85 d2                	test   %edx,%edx
+  803397:	75 ec                	jne    803385 <strtol+0x48>
+        s++;
+  803399:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80339d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8033a2:	eb e1                	jmp    803385 <strtol+0x48>
+        s += 2;
+  8033a4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8033a8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8033ad:	eb d6                	jmp    803385 <strtol+0x48>
+            dig -= '0';
+  8033af:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8033b2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8033b6:	41 39 d0             	cmp    %edx,%r8d
+  8033b9:	7d 21                	jge    8033dc <strtol+0x9f>
+        val = val * base + dig;
+  8033bb:	49 0f af c1          	imul   %r9,%rax
+  8033bf:	0f b6 c9             	movzbl %cl,%ecx
+  8033c2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8033c5:	48 83 c7 01          	add    $0x1,%rdi
+  8033c9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8033cd:	80 f9 39             	cmp    $0x39,%cl
+  8033d0:	76 dd                	jbe    8033af <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8033d2:	80 f9 7b             	cmp    $0x7b,%cl
+  8033d5:	77 05                	ja     8033dc <strtol+0x9f>
+            dig -= 'a' - 10;
+  8033d7:	83 e9 57             	sub    $0x57,%ecx
+  8033da:	eb d6                	jmp    8033b2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8033dc:	4d 85 d2             	test   %r10,%r10
+  8033df:	74 03                	je     8033e4 <strtol+0xa7>
+  8033e1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8033e4:	48 89 c2             	mov    %rax,%rdx
+  8033e7:	48 f7 da             	neg    %rdx
+  8033ea:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8033ee:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8033f2:	c3                   	ret
+
+00000000008033f3 <strrev>:
+
+void
+strrev(char *str)
+{
+  8033f3:	55                   	push   %rbp
+  8033f4:	48 89 e5             	mov    %rsp,%rbp
+  8033f7:	53                   	push   %rbx
+  8033f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8033fc:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033ff:	48 b8 8e 2f 80 00 00 	movabs $0x802f8e,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80340b:	83 e8 01             	sub    $0x1,%eax
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	7e 22                	jle    803434 <strrev+0x41>
+  803412:	48 98                	cltq
+  803414:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  803419:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80341d:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  803421:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  803425:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  803428:	48 83 c2 01          	add    $0x1,%rdx
+  80342c:	48 83 e8 01          	sub    $0x1,%rax
+  803430:	39 c2                	cmp    %eax,%edx
+  803432:	7c e5                	jl     803419 <strrev+0x26>
+	}
+}
+  803434:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803438:	c9                   	leave
+  803439:	c3                   	ret
+
+000000000080343a <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80343a:	85 d2                	test   %edx,%edx
+  80343c:	0f 84 80 00 00 00    	je     8034c2 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  803442:	55                   	push   %rbp
+  803443:	48 89 e5             	mov    %rsp,%rbp
+  803446:	53                   	push   %rbx
+  803447:	48 83 ec 08          	sub    $0x8,%rsp
+  80344b:	49 89 f2             	mov    %rsi,%r10
+  80344e:	41 89 d3             	mov    %edx,%r11d
+  803451:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  803454:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  803459:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80345c:	eb 20                	jmp    80347e <itoa+0x44>
+			str[i++] = '0' + digit;
+  80345e:	41 89 f1             	mov    %esi,%r9d
+  803461:	83 c2 30             	add    $0x30,%edx
+  803464:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  803467:	89 f8                	mov    %edi,%eax
+  803469:	99                   	cltd
+  80346a:	f7 f9                	idiv   %ecx
+  80346c:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80346e:	85 c0                	test   %eax,%eax
+  803470:	74 2e                	je     8034a0 <itoa+0x66>
+  803472:	83 c6 01             	add    $0x1,%esi
+  803475:	49 83 c0 01          	add    $0x1,%r8
+  803479:	44 39 cb             	cmp    %r9d,%ebx
+  80347c:	7e 15                	jle    803493 <itoa+0x59>
+		digit = sum % base;
+  80347e:	89 f8                	mov    %edi,%eax
+  803480:	99                   	cltd
+  803481:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803483:	83 fa 09             	cmp    $0x9,%edx
+  803486:	7e d6                	jle    80345e <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803488:	41 89 f1             	mov    %esi,%r9d
+  80348b:	83 c2 37             	add    $0x37,%edx
+  80348e:	41 88 10             	mov    %dl,(%r8)
+  803491:	eb d4                	jmp    803467 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803493:	41 83 eb 01          	sub    $0x1,%r11d
+  803497:	45 39 cb             	cmp    %r9d,%r11d
+  80349a:	75 04                	jne    8034a0 <itoa+0x66>
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	75 28                	jne    8034c8 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8034a0:	4d 63 c9             	movslq %r9d,%r9
+  8034a3:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8034a8:	4c 89 d7             	mov    %r10,%rdi
+  8034ab:	48 b8 f3 33 80 00 00 	movabs $0x8033f3,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+	return 0;
+  8034b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034c0:	c9                   	leave
+  8034c1:	c3                   	ret
+		return -1;
+  8034c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8034c7:	c3                   	ret
+		return -1;
+  8034c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8034cd:	eb ed                	jmp    8034bc <itoa+0x82>
+
+00000000008034cf <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8034cf:	55                   	push   %rbp
+  8034d0:	48 89 e5             	mov    %rsp,%rbp
+  8034d3:	41 56                	push   %r14
+  8034d5:	41 55                	push   %r13
+  8034d7:	41 54                	push   %r12
+  8034d9:	53                   	push   %rbx
+  8034da:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8034dd:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  8034e4:	00 00 00 
+  8034e7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8034eb:	74 27                	je     803514 <_handle_vectored_pagefault+0x45>
+  8034ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8034f2:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  8034f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8034fc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8034ff:	4c 89 e7             	mov    %r12,%rdi
+  803502:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803507:	84 c0                	test   %al,%al
+  803509:	75 45                	jne    803550 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80350b:	48 83 c3 01          	add    $0x1,%rbx
+  80350f:	49 3b 1e             	cmp    (%r14),%rbx
+  803512:	72 eb                	jb     8034ff <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803514:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80351b:	00 
+  80351c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803521:	4d 8b 04 24          	mov    (%r12),%r8
+  803525:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  80352c:	00 00 00 
+  80352f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803534:	48 bf 58 40 80 00 00 	movabs $0x804058,%rdi
+  80353b:	00 00 00 
+  80353e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803543:	49 ba 57 25 80 00 00 	movabs $0x802557,%r10
+  80354a:	00 00 00 
+  80354d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803550:	5b                   	pop    %rbx
+  803551:	41 5c                	pop    %r12
+  803553:	41 5d                	pop    %r13
+  803555:	41 5e                	pop    %r14
+  803557:	5d                   	pop    %rbp
+  803558:	c3                   	ret
+
+0000000000803559 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803559:	55                   	push   %rbp
+  80355a:	48 89 e5             	mov    %rsp,%rbp
+  80355d:	53                   	push   %rbx
+  80355e:	48 83 ec 08          	sub    $0x8,%rsp
+  803562:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  803565:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  80356c:	00 00 00 
+  80356f:	80 38 00             	cmpb   $0x0,(%rax)
+  803572:	0f 84 84 00 00 00    	je     8035fc <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803578:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  80357f:	00 00 00 
+  803582:	48 8b 10             	mov    (%rax),%rdx
+  803585:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80358a:	48 b9 20 80 80 00 00 	movabs $0x808020,%rcx
+  803591:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803594:	48 85 d2             	test   %rdx,%rdx
+  803597:	74 19                	je     8035b2 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803599:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80359d:	0f 84 e8 00 00 00    	je     80368b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8035a3:	48 83 c0 01          	add    $0x1,%rax
+  8035a7:	48 39 d0             	cmp    %rdx,%rax
+  8035aa:	75 ed                	jne    803599 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8035ac:	48 83 fa 08          	cmp    $0x8,%rdx
+  8035b0:	74 1c                	je     8035ce <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8035b2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8035b6:	48 a3 68 80 80 00 00 	movabs %rax,0x808068
+  8035bd:	00 00 00 
+  8035c0:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8035c7:	00 00 00 
+  8035ca:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8035ce:	48 b8 eb 01 80 00 00 	movabs $0x8001eb,%rax
+  8035d5:	00 00 00 
+  8035d8:	ff d0                	call   *%rax
+  8035da:	89 c7                	mov    %eax,%edi
+  8035dc:	48 be 7b 06 80 00 00 	movabs $0x80067b,%rsi
+  8035e3:	00 00 00 
+  8035e6:	48 b8 b0 04 80 00 00 	movabs $0x8004b0,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8035f2:	85 c0                	test   %eax,%eax
+  8035f4:	78 68                	js     80365e <add_pgfault_handler+0x105>
+    return res;
+}
+  8035f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8035fc:	48 b8 eb 01 80 00 00 	movabs $0x8001eb,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+  803608:	89 c7                	mov    %eax,%edi
+  80360a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80360f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803614:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80361b:	00 00 00 
+  80361e:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80362a:	48 ba 68 80 80 00 00 	movabs $0x808068,%rdx
+  803631:	00 00 00 
+  803634:	48 8b 02             	mov    (%rdx),%rax
+  803637:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80363b:	48 89 0a             	mov    %rcx,(%rdx)
+  80363e:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803645:	00 00 00 
+  803648:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80364c:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803653:	00 00 00 
+  803656:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  803659:	e9 70 ff ff ff       	jmp    8035ce <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80365e:	89 c1                	mov    %eax,%ecx
+  803660:	48 ba 66 40 80 00 00 	movabs $0x804066,%rdx
+  803667:	00 00 00 
+  80366a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80366f:	48 bf 58 40 80 00 00 	movabs $0x804058,%rdi
+  803676:	00 00 00 
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	49 b8 57 25 80 00 00 	movabs $0x802557,%r8
+  803685:	00 00 00 
+  803688:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80368b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803690:	e9 61 ff ff ff       	jmp    8035f6 <add_pgfault_handler+0x9d>
+
+0000000000803695 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803695:	55                   	push   %rbp
+  803696:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803699:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  8036a0:	00 00 00 
+  8036a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8036a6:	74 33                	je     8036db <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8036a8:	48 a1 68 80 80 00 00 	movabs 0x808068,%rax
+  8036af:	00 00 00 
+  8036b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8036b7:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8036be:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8036c1:	48 85 c0             	test   %rax,%rax
+  8036c4:	0f 84 85 00 00 00    	je     80374f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8036ca:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8036ce:	74 40                	je     803710 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8036d0:	48 83 c1 01          	add    $0x1,%rcx
+  8036d4:	48 39 c1             	cmp    %rax,%rcx
+  8036d7:	75 f1                	jne    8036ca <remove_pgfault_handler+0x35>
+  8036d9:	eb 74                	jmp    80374f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8036db:	48 b9 7e 40 80 00 00 	movabs $0x80407e,%rcx
+  8036e2:	00 00 00 
+  8036e5:	48 ba 87 3a 80 00 00 	movabs $0x803a87,%rdx
+  8036ec:	00 00 00 
+  8036ef:	be 43 00 00 00       	mov    $0x43,%esi
+  8036f4:	48 bf 58 40 80 00 00 	movabs $0x804058,%rdi
+  8036fb:	00 00 00 
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803703:	49 b8 57 25 80 00 00 	movabs $0x802557,%r8
+  80370a:	00 00 00 
+  80370d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803710:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803717:	00 
+  803718:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80371c:	48 29 ca             	sub    %rcx,%rdx
+  80371f:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  803726:	00 00 00 
+  803729:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80372d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803732:	48 89 ce             	mov    %rcx,%rsi
+  803735:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  80373c:	00 00 00 
+  80373f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803741:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  803748:	00 00 00 
+  80374b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80374f:	5d                   	pop    %rbp
+  803750:	c3                   	ret
+
+0000000000803751 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803751:	55                   	push   %rbp
+  803752:	48 89 e5             	mov    %rsp,%rbp
+  803755:	41 55                	push   %r13
+  803757:	41 54                	push   %r12
+  803759:	53                   	push   %rbx
+  80375a:	48 83 ec 08          	sub    $0x8,%rsp
+  80375e:	49 89 fc             	mov    %rdi,%r12
+  803761:	48 89 f7             	mov    %rsi,%rdi
+  803764:	48 89 d3             	mov    %rdx,%rbx
+  803767:	49 89 cd             	mov    %rcx,%r13
+  80376a:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80376d:	48 85 f6             	test   %rsi,%rsi
+  803770:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803777:	00 00 00 
+  80377a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80377e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803783:	48 85 db             	test   %rbx,%rbx
+  803786:	74 03                	je     80378b <ipc_recv_timed+0x3a>
+  803788:	48 8b 33             	mov    (%rbx),%rsi
+  80378b:	48 b8 45 05 80 00 00 	movabs $0x800545,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+    if (res < 0) {
+  803797:	85 c0                	test   %eax,%eax
+  803799:	78 75                	js     803810 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80379b:	4d 85 e4             	test   %r12,%r12
+  80379e:	74 14                	je     8037b4 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8037a0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037a7:	00 00 00 
+  8037aa:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8037b0:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8037b4:	4d 85 ed             	test   %r13,%r13
+  8037b7:	74 14                	je     8037cd <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8037b9:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037c0:	00 00 00 
+  8037c3:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8037c9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8037cd:	48 85 db             	test   %rbx,%rbx
+  8037d0:	74 23                	je     8037f5 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8037d2:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037d9:	00 00 00 
+  8037dc:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8037e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e7:	85 c9                	test   %ecx,%ecx
+  8037e9:	74 07                	je     8037f2 <ipc_recv_timed+0xa1>
+  8037eb:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8037f2:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8037f5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8037fc:	00 00 00 
+  8037ff:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803805:	48 83 c4 08          	add    $0x8,%rsp
+  803809:	5b                   	pop    %rbx
+  80380a:	41 5c                	pop    %r12
+  80380c:	41 5d                	pop    %r13
+  80380e:	5d                   	pop    %rbp
+  80380f:	c3                   	ret
+        if (from_env_store != NULL) {
+  803810:	4d 85 e4             	test   %r12,%r12
+  803813:	74 08                	je     80381d <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803815:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80381c:	00 
+        if (perm_store != NULL) {
+  80381d:	4d 85 ed             	test   %r13,%r13
+  803820:	74 08                	je     80382a <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803822:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803829:	00 
+        if (size != NULL) {
+  80382a:	48 85 db             	test   %rbx,%rbx
+  80382d:	74 d6                	je     803805 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80382f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803836:	eb cd                	jmp    803805 <ipc_recv_timed+0xb4>
+
+0000000000803838 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80383c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803842:	48 b8 51 37 80 00 00 	movabs $0x803751,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+}
+  80384e:	5d                   	pop    %rbp
+  80384f:	c3                   	ret
+
+0000000000803850 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803850:	55                   	push   %rbp
+  803851:	48 89 e5             	mov    %rsp,%rbp
+  803854:	41 57                	push   %r15
+  803856:	41 56                	push   %r14
+  803858:	41 55                	push   %r13
+  80385a:	41 54                	push   %r12
+  80385c:	53                   	push   %rbx
+  80385d:	48 83 ec 18          	sub    $0x18,%rsp
+  803861:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803864:	48 89 d3             	mov    %rdx,%rbx
+  803867:	49 89 cc             	mov    %rcx,%r12
+  80386a:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80386d:	48 85 d2             	test   %rdx,%rdx
+  803870:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803877:	00 00 00 
+  80387a:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80387e:	89 f0                	mov    %esi,%eax
+  803880:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803884:	48 89 da             	mov    %rbx,%rdx
+  803887:	48 89 c6             	mov    %rax,%rsi
+  80388a:	48 b8 19 05 80 00 00 	movabs $0x800519,%rax
+  803891:	00 00 00 
+  803894:	ff d0                	call   *%rax
+    while (res < 0) {
+  803896:	85 c0                	test   %eax,%eax
+  803898:	79 65                	jns    8038ff <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80389a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80389d:	75 33                	jne    8038d2 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80389f:	49 bf 1c 02 80 00 00 	movabs $0x80021c,%r15
+  8038a6:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038a9:	49 be 19 05 80 00 00 	movabs $0x800519,%r14
+  8038b0:	00 00 00 
+        sys_yield();
+  8038b3:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8038b6:	45 89 e8             	mov    %r13d,%r8d
+  8038b9:	4c 89 e1             	mov    %r12,%rcx
+  8038bc:	48 89 da             	mov    %rbx,%rdx
+  8038bf:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8038c3:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8038c6:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8038c9:	85 c0                	test   %eax,%eax
+  8038cb:	79 32                	jns    8038ff <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8038cd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038d0:	74 e1                	je     8038b3 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8038d2:	89 c1                	mov    %eax,%ecx
+  8038d4:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  8038db:	00 00 00 
+  8038de:	be 52 00 00 00       	mov    $0x52,%esi
+  8038e3:	48 bf ac 40 80 00 00 	movabs $0x8040ac,%rdi
+  8038ea:	00 00 00 
+  8038ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f2:	49 b8 57 25 80 00 00 	movabs $0x802557,%r8
+  8038f9:	00 00 00 
+  8038fc:	41 ff d0             	call   *%r8
+    }
+}
+  8038ff:	48 83 c4 18          	add    $0x18,%rsp
+  803903:	5b                   	pop    %rbx
+  803904:	41 5c                	pop    %r12
+  803906:	41 5d                	pop    %r13
+  803908:	41 5e                	pop    %r14
+  80390a:	41 5f                	pop    %r15
+  80390c:	5d                   	pop    %rbp
+  80390d:	c3                   	ret
+
+000000000080390e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80390e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803913:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80391a:	00 00 00 
+  80391d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803921:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803925:	48 c1 e2 04          	shl    $0x4,%rdx
+  803929:	48 01 ca             	add    %rcx,%rdx
+  80392c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803932:	39 fa                	cmp    %edi,%edx
+  803934:	74 12                	je     803948 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803936:	48 83 c0 01          	add    $0x1,%rax
+  80393a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803940:	75 db                	jne    80391d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803947:	c3                   	ret
+            return envs[i].env_id;
+  803948:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80394c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803950:	48 c1 e2 04          	shl    $0x4,%rdx
+  803954:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80395b:	00 00 00 
+  80395e:	48 01 d0             	add    %rdx,%rax
+  803961:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803967:	c3                   	ret
+
+0000000000803968 <__rodata_start>:
+  803968:	3c 75                	cmp    $0x75,%al
+  80396a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80396b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80396f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803970:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803974:	1f                   	(bad)
+  803975:	44 00 00             	add    %r8b,(%rax)
+  803978:	73 79                	jae    8039f3 <__rodata_start+0x8b>
+  80397a:	73 63                	jae    8039df <__rodata_start+0x77>
+  80397c:	61                   	(bad)
+  80397d:	6c                   	insb   (%dx),%es:(%rdi)
+  80397e:	6c                   	insb   (%dx),%es:(%rdi)
+  80397f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09dff <__bss_end+0x72200dff>
+  803985:	65 74 75             	gs je  8039fd <__rodata_start+0x95>
+  803988:	72 6e                	jb     8039f8 <__rodata_start+0x90>
+  80398a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09e0c <__bss_end+0x28200e0c>
+  803991:	28 
+  803992:	3e 20 30             	ds and %dh,(%rax)
+  803995:	29 00                	sub    %eax,(%rax)
+  803997:	6c                   	insb   (%dx),%es:(%rdi)
+  803998:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  80399f:	61                   	(bad)
+  8039a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8039a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8039a2:	2e 63 00             	cs movsxd (%rax),%eax
+  8039a5:	0f 1f 00             	nopl   (%rax)
+  8039a8:	5b                   	pop    %rbx
+  8039a9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8039ae:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8039b1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8039b5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039b6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8039ba:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8039c1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80442c <error_string+0x4cc>
+  8039c8:	5b                   	pop    %rbx
+  8039c9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8039ce:	20 72 65             	and    %dh,0x65(%rdx)
+  8039d1:	61                   	(bad)
+  8039d2:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8039d4:	61                   	(bad)
+  8039d5:	70 20                	jo     8039f7 <__rodata_start+0x8f>
+  8039d7:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8039dc:	20 62 61             	and    %ah,0x61(%rdx)
+  8039df:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8039e3:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8039e7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8039ea:	30 38                	xor    %bh,(%rax)
+  8039ec:	78 5d                	js     803a4b <__rodata_start+0xe3>
+  8039ee:	20 66 74             	and    %ah,0x74(%rsi)
+  8039f1:	72 75                	jb     803a68 <devtab+0x8>
+  8039f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039f4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8039f7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad5a62 <__bss_end+0x2d2cca62>
+  8039fe:	20 62 61             	and    %ah,0x61(%rdx)
+  803a01:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803a05:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803a09:	5b                   	pop    %rbx
+  803a0a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803a0f:	20 72 65             	and    %dh,0x65(%rdx)
+  803a12:	61                   	(bad)
+  803a13:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad5a7e <__bss_end+0x2d2cca7e>
+  803a1a:	20 62 61             	and    %ah,0x61(%rdx)
+  803a1d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803a21:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803a25:	5b                   	pop    %rbx
+  803a26:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803a2b:	20 77 72             	and    %dh,0x72(%rdi)
+  803a2e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  803a35:	2d 
+  803a36:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803a3b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803a3e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a49:	00 00 00 
+  803a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a53:	00 00 00 
+  803a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a5d:	00 00 00 
+
+0000000000803a60 <devtab>:
+  803a60:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  803a70:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  803a80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803a90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803aa0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803ab0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803ac0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803ad0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803ae0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803af0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803b00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803b10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803b20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803b30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803b40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803b50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803b60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803b70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803b80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803b90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803ba0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  803bb0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  803bc0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  803bd0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803be0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803bf0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803c00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803c10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803c20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803c30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803c40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803c50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803c60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803c70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803c80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803c90:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  803ca0:	94 28 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     .(..............
+  803cb0:	c5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803cc0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803cd0:	d5 2e 80 00 00 00 00 00 b3 28 80 00 00 00 00 00     .........(......
+  803ce0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803cf0:	a7 28 80 00 00 00 00 00 21 29 80 00 00 00 00 00     .(......!)......
+  803d00:	d5 2e 80 00 00 00 00 00 a7 28 80 00 00 00 00 00     .........(......
+  803d10:	ed 28 80 00 00 00 00 00 ed 28 80 00 00 00 00 00     .(.......(......
+  803d20:	ed 28 80 00 00 00 00 00 ed 28 80 00 00 00 00 00     .(.......(......
+  803d30:	ed 28 80 00 00 00 00 00 ed 28 80 00 00 00 00 00     .(.......(......
+  803d40:	ed 28 80 00 00 00 00 00 ed 28 80 00 00 00 00 00     .(.......(......
+  803d50:	ed 28 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     .(..............
+  803d60:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803d70:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803d80:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803d90:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803da0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803db0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803dc0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803dd0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803de0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803df0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e00:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e10:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e20:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e30:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e40:	d5 2e 80 00 00 00 00 00 f8 2d 80 00 00 00 00 00     .........-......
+  803e50:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e60:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e70:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e80:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803e90:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803ea0:	44 29 80 00 00 00 00 00 13 2b 80 00 00 00 00 00     D).......+......
+  803eb0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803ec0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803ed0:	73 29 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     s)..............
+  803ee0:	d5 2e 80 00 00 00 00 00 39 29 80 00 00 00 00 00     ........9)......
+  803ef0:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803f00:	bb 2c 80 00 00 00 00 00 85 2d 80 00 00 00 00 00     .,.......-......
+  803f10:	d5 2e 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     ................
+  803f20:	0a 2a 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     .*..............
+  803f30:	e7 2b 80 00 00 00 00 00 d5 2e 80 00 00 00 00 00     .+..............
+  803f40:	d5 2e 80 00 00 00 00 00 f8 2d 80 00 00 00 00 00     .........-......
+  803f50:	d5 2e 80 00 00 00 00 00 9d 28 80 00 00 00 00 00     .........(......
+
+0000000000803f60 <error_string>:
+	...
+  803f68:	35 3b 80 00 00 00 00 00 47 3b 80 00 00 00 00 00     5;......G;......
+  803f78:	57 3b 80 00 00 00 00 00 69 3b 80 00 00 00 00 00     W;......i;......
+  803f88:	77 3b 80 00 00 00 00 00 8b 3b 80 00 00 00 00 00     w;.......;......
+  803f98:	a0 3b 80 00 00 00 00 00 b3 3b 80 00 00 00 00 00     .;.......;......
+  803fa8:	c5 3b 80 00 00 00 00 00 d9 3b 80 00 00 00 00 00     .;.......;......
+  803fb8:	e9 3b 80 00 00 00 00 00 fc 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	13 3c 80 00 00 00 00 00 29 3c 80 00 00 00 00 00     .<......)<......
+  803fd8:	41 3c 80 00 00 00 00 00 59 3c 80 00 00 00 00 00     A<......Y<......
+  803fe8:	66 3c 80 00 00 00 00 00 08 40 80 00 00 00 00 00     f<.......@......
+  803ff8:	7a 3c 80 00 00 00 00 00 92 3c 80 00 00 00 00 00     z<.......<......
+  804008:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804018:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804028:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804038:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804048:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804058:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804068:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804078:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804088:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804098:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8040a8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  8040b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8040c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8040d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8040e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8040f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804108:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804118:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804128:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804138:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804148:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804158:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804168:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804178:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804188:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804198:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8041d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804208:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804218:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804228:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804238:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804248:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804258:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804268:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804278:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804288:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804298:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804308:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804318:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804328:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804338:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804348:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804358:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804368:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804378:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804388:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804398:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804408:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804418:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804428:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804438:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804448:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804458:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804468:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804478:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804488:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804498:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804508:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804518:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804528:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804538:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804548:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804558:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804568:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804578:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804588:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804598:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804608:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804618:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804628:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804638:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804648:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804658:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804668:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804678:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804688:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804698:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804708:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804718:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804728:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804738:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804748:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804758:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804768:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804778:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804788:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804798:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804808:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804818:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804828:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804838:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804848:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804858:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804868:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804878:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804888:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804898:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804908:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804918:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804928:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804938:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804948:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804958:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804968:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804978:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804988:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804998:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff8:	00 00 00 00 0f 1f 40 00                             ......@.
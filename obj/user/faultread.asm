@@ -0,0 +1,6881 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf 98 36 80 00 00 	movabs $0x803698,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba cb 01 80 00 00 	movabs $0x8001cb,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800065:	00 00 00 
+  800068:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80006f:	00 00 00 
+  800072:	48 39 c2             	cmp    %rax,%rdx
+  800075:	73 17                	jae    80008e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800077:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	49 89 c4             	mov    %rax,%r12
+  80007d:	48 83 c3 08          	add    $0x8,%rbx
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	ff 53 f8             	call   *-0x8(%rbx)
+  800089:	4c 39 e3             	cmp    %r12,%rbx
+  80008c:	72 ef                	jb     80007d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008e:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000a3:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000a7:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ab:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b2:	00 00 00 
+  8000b5:	48 01 d0             	add    %rdx,%rax
+  8000b8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bf:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c2:	45 85 ed             	test   %r13d,%r13d
+  8000c5:	7e 0d                	jle    8000d4 <libmain+0x87>
+  8000c7:	49 8b 06             	mov    (%r14),%rax
+  8000ca:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000d1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d4:	4c 89 f6             	mov    %r14,%rsi
+  8000d7:	44 89 ef             	mov    %r13d,%edi
+  8000da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e6:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+#endif
+}
+  8000f2:	5b                   	pop    %rbx
+  8000f3:	41 5c                	pop    %r12
+  8000f5:	41 5d                	pop    %r13
+  8000f7:	41 5e                	pop    %r14
+  8000f9:	5d                   	pop    %rbp
+  8000fa:	c3                   	ret
+
+00000000008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ff:	48 b8 72 17 80 00 00 	movabs $0x801772,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800110:	48 b8 51 10 80 00 00 	movabs $0x801051,%rax
+  800117:	00 00 00 
+  80011a:	ff d0                	call   *%rax
+}
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	53                   	push   %rbx
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012a:	8b 06                	mov    (%rsi),%eax
+  80012c:	8d 50 01             	lea    0x1(%rax),%edx
+  80012f:	89 16                	mov    %edx,(%rsi)
+  800131:	48 98                	cltq
+  800133:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800138:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80013e:	74 0a                	je     80014a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800140:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80014e:	be ff 00 00 00       	mov    $0xff,%esi
+  800153:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800165:	eb d9                	jmp    800140 <putch+0x22>
+
+0000000000800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800167:	55                   	push   %rbp
+  800168:	48 89 e5             	mov    %rsp,%rbp
+  80016b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800172:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800175:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800189:	48 89 f1             	mov    %rsi,%rcx
+  80018c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800193:	48 bf 1e 01 80 00 00 	movabs $0x80011e,%rdi
+  80019a:	00 00 00 
+  80019d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b7:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+00000000008001cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001fe:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800202:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80020e:	c9                   	leave
+  80020f:	c3                   	ret
+
+0000000000800210 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800210:	55                   	push   %rbp
+  800211:	48 89 e5             	mov    %rsp,%rbp
+  800214:	41 57                	push   %r15
+  800216:	41 56                	push   %r14
+  800218:	41 55                	push   %r13
+  80021a:	41 54                	push   %r12
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 18          	sub    $0x18,%rsp
+  800221:	49 89 fc             	mov    %rdi,%r12
+  800224:	49 89 f5             	mov    %rsi,%r13
+  800227:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80022b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80022e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800231:	41 89 cf             	mov    %ecx,%r15d
+  800234:	4c 39 fa             	cmp    %r15,%rdx
+  800237:	73 5b                	jae    800294 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800239:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80023d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7e 0e                	jle    800253 <print_num+0x43>
+            putch(padc, put_arg);
+  800245:	4c 89 ee             	mov    %r13,%rsi
+  800248:	44 89 f7             	mov    %r14d,%edi
+  80024b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80024e:	83 eb 01             	sub    $0x1,%ebx
+  800251:	75 f2                	jne    800245 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800253:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800257:	48 b9 d1 36 80 00 00 	movabs $0x8036d1,%rcx
+  80025e:	00 00 00 
+  800261:	48 b8 c0 36 80 00 00 	movabs $0x8036c0,%rax
+  800268:	00 00 00 
+  80026b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800273:	ba 00 00 00 00       	mov    $0x0,%edx
+  800278:	49 f7 f7             	div    %r15
+  80027b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027f:	4c 89 ee             	mov    %r13,%rsi
+  800282:	41 ff d4             	call   *%r12
+}
+  800285:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800289:	5b                   	pop    %rbx
+  80028a:	41 5c                	pop    %r12
+  80028c:	41 5d                	pop    %r13
+  80028e:	41 5e                	pop    %r14
+  800290:	41 5f                	pop    %r15
+  800292:	5d                   	pop    %rbp
+  800293:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800294:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029d:	49 f7 f7             	div    %r15
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a8:	52                   	push   %rdx
+  8002a9:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ad:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b1:	48 89 c2             	mov    %rax,%rdx
+  8002b4:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+  8002c0:	48 83 c4 10          	add    $0x10,%rsp
+  8002c4:	eb 8d                	jmp    800253 <print_num+0x43>
+
+00000000008002c6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002ca:	48 8b 06             	mov    (%rsi),%rax
+  8002cd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d1:	73 0a                	jae    8002dd <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d7:	48 89 16             	mov    %rdx,(%rsi)
+  8002da:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002dd:	c3                   	ret
+
+00000000008002de <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800301:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800305:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800309:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80030d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800314:	00 00 00 
+  800317:	ff d0                	call   *%rax
+}
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+000000000080031b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+  80031f:	41 57                	push   %r15
+  800321:	41 56                	push   %r14
+  800323:	41 55                	push   %r13
+  800325:	41 54                	push   %r12
+  800327:	53                   	push   %rbx
+  800328:	48 83 ec 38          	sub    $0x38,%rsp
+  80032c:	49 89 fe             	mov    %rdi,%r14
+  80032f:	49 89 f5             	mov    %rsi,%r13
+  800332:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800335:	48 8b 01             	mov    (%rcx),%rax
+  800338:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800344:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800350:	0f b6 3b             	movzbl (%rbx),%edi
+  800353:	40 80 ff 25          	cmp    $0x25,%dil
+  800357:	74 18                	je     800371 <vprintfmt+0x56>
+            if (!ch) return;
+  800359:	40 84 ff             	test   %dil,%dil
+  80035c:	0f 84 b1 06 00 00    	je     800a13 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800362:	40 0f b6 ff          	movzbl %dil,%edi
+  800366:	4c 89 ee             	mov    %r13,%rsi
+  800369:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036c:	4c 89 e3             	mov    %r12,%rbx
+  80036f:	eb db                	jmp    80034c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800371:	be 00 00 00 00       	mov    $0x0,%esi
+  800376:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800385:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800390:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800395:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80039d:	83 e8 23             	sub    $0x23,%eax
+  8003a0:	3c 57                	cmp    $0x57,%al
+  8003a2:	0f 87 51 06 00 00    	ja     8009f9 <vprintfmt+0x6de>
+  8003a8:	0f b6 c0             	movzbl %al,%eax
+  8003ab:	48 b9 60 38 80 00 00 	movabs $0x803860,%rcx
+  8003b2:	00 00 00 
+  8003b5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003bb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003bf:	eb cf                	jmp    800390 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c1:	49 89 dc             	mov    %rbx,%r12
+  8003c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c9:	eb c5                	jmp    800390 <vprintfmt+0x75>
+            padc = ch;
+  8003cb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003cf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d5:	eb b9                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003da:	83 f8 2f             	cmp    $0x2f,%eax
+  8003dd:	77 24                	ja     800403 <vprintfmt+0xe8>
+  8003df:	89 c1                	mov    %eax,%ecx
+  8003e1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e5:	83 c0 08             	add    $0x8,%eax
+  8003e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003eb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003ee:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f5:	79 99                	jns    800390 <vprintfmt+0x75>
+                width = precision;
+  8003f7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003fb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800401:	eb 8d                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800403:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800407:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80040b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040f:	eb da                	jmp    8003eb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800411:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800416:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800420:	3c 39                	cmp    $0x39,%al
+  800422:	77 1c                	ja     800440 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800424:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800428:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042c:	0f b6 c0             	movzbl %al,%eax
+  80042f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800434:	0f b6 03             	movzbl (%rbx),%eax
+  800437:	3c 39                	cmp    $0x39,%al
+  800439:	76 e9                	jbe    800424 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80043e:	eb b1                	jmp    8003f1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+  800443:	eb ac                	jmp    8003f1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800445:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800448:	85 c9                	test   %ecx,%ecx
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	0f 49 c1             	cmovns %ecx,%eax
+  800452:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800455:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800458:	e9 33 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            lflag++;
+  80045d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800460:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800463:	e9 28 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800468:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046b:	83 f8 2f             	cmp    $0x2f,%eax
+  80046e:	77 19                	ja     800489 <vprintfmt+0x16e>
+  800470:	89 c2                	mov    %eax,%edx
+  800472:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800476:	83 c0 08             	add    $0x8,%eax
+  800479:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047c:	8b 3a                	mov    (%rdx),%edi
+  80047e:	4c 89 ee             	mov    %r13,%rsi
+  800481:	41 ff d6             	call   *%r14
+            break;
+  800484:	e9 c3 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800489:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80048d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800491:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800495:	eb e5                	jmp    80047c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800497:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049a:	83 f8 2f             	cmp    $0x2f,%eax
+  80049d:	77 5a                	ja     8004f9 <vprintfmt+0x1de>
+  80049f:	89 c2                	mov    %eax,%edx
+  8004a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a5:	83 c0 08             	add    $0x8,%eax
+  8004a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ab:	8b 02                	mov    (%rdx),%eax
+  8004ad:	89 c1                	mov    %eax,%ecx
+  8004af:	f7 d9                	neg    %ecx
+  8004b1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b4:	83 f9 14             	cmp    $0x14,%ecx
+  8004b7:	7f 4e                	jg     800507 <vprintfmt+0x1ec>
+  8004b9:	48 63 c1             	movslq %ecx,%rax
+  8004bc:	48 ba 20 3b 80 00 00 	movabs $0x803b20,%rdx
+  8004c3:	00 00 00 
+  8004c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004ca:	48 85 c0             	test   %rax,%rax
+  8004cd:	74 38                	je     800507 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004cf:	48 89 c1             	mov    %rax,%rcx
+  8004d2:	48 ba f9 3c 80 00 00 	movabs $0x803cf9,%rdx
+  8004d9:	00 00 00 
+  8004dc:	4c 89 ee             	mov    %r13,%rsi
+  8004df:	4c 89 f7             	mov    %r14,%rdi
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  8004ee:	00 00 00 
+  8004f1:	41 ff d0             	call   *%r8
+  8004f4:	e9 53 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800501:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800505:	eb a4                	jmp    8004ab <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800507:	48 ba e9 36 80 00 00 	movabs $0x8036e9,%rdx
+  80050e:	00 00 00 
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	4c 89 f7             	mov    %r14,%rdi
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  800523:	00 00 00 
+  800526:	41 ff d0             	call   *%r8
+  800529:	e9 1e fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 6c                	ja     8005a2 <vprintfmt+0x287>
+  800536:	89 c2                	mov    %eax,%edx
+  800538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800542:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800545:	48 85 d2             	test   %rdx,%rdx
+  800548:	48 b8 e2 36 80 00 00 	movabs $0x8036e2,%rax
+  80054f:	00 00 00 
+  800552:	48 0f 45 c2          	cmovne %rdx,%rax
+  800556:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055e:	7e 06                	jle    800566 <vprintfmt+0x24b>
+  800560:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800564:	75 4a                	jne    8005b0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800566:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80056a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80056e:	0f b6 00             	movzbl (%rax),%eax
+  800571:	84 c0                	test   %al,%al
+  800573:	0f 85 9a 00 00 00    	jne    800613 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800579:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80057c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800580:	85 c0                	test   %eax,%eax
+  800582:	0f 8e c4 fd ff ff    	jle    80034c <vprintfmt+0x31>
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800590:	41 ff d6             	call   *%r14
+  800593:	41 83 ec 01          	sub    $0x1,%r12d
+  800597:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80059b:	75 eb                	jne    800588 <vprintfmt+0x26d>
+  80059d:	e9 aa fd ff ff       	jmp    80034c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ae:	eb 92                	jmp    800542 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b0:	49 63 f7             	movslq %r15d,%rsi
+  8005b3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b7:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  8005be:	00 00 00 
+  8005c1:	ff d0                	call   *%rax
+  8005c3:	48 89 c2             	mov    %rax,%rdx
+  8005c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005cb:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005ce:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005d1:	85 c0                	test   %eax,%eax
+  8005d3:	7e 91                	jle    800566 <vprintfmt+0x24b>
+  8005d5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005da:	4c 89 ee             	mov    %r13,%rsi
+  8005dd:	44 89 e7             	mov    %r12d,%edi
+  8005e0:	41 ff d6             	call   *%r14
+  8005e3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005ed:	75 eb                	jne    8005da <vprintfmt+0x2bf>
+  8005ef:	e9 72 ff ff ff       	jmp    800566 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f4:	0f b6 f8             	movzbl %al,%edi
+  8005f7:	4c 89 ee             	mov    %r13,%rsi
+  8005fa:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800601:	49 83 c4 01          	add    $0x1,%r12
+  800605:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80060b:	84 c0                	test   %al,%al
+  80060d:	0f 84 66 ff ff ff    	je     800579 <vprintfmt+0x25e>
+  800613:	45 85 ff             	test   %r15d,%r15d
+  800616:	78 0a                	js     800622 <vprintfmt+0x307>
+  800618:	41 83 ef 01          	sub    $0x1,%r15d
+  80061c:	0f 88 57 ff ff ff    	js     800579 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800622:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800626:	74 cc                	je     8005f4 <vprintfmt+0x2d9>
+  800628:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80062b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800630:	80 fa 5e             	cmp    $0x5e,%dl
+  800633:	77 c2                	ja     8005f7 <vprintfmt+0x2dc>
+  800635:	eb bd                	jmp    8005f4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800637:	40 84 f6             	test   %sil,%sil
+  80063a:	75 26                	jne    800662 <vprintfmt+0x347>
+    switch (lflag) {
+  80063c:	85 d2                	test   %edx,%edx
+  80063e:	74 59                	je     800699 <vprintfmt+0x37e>
+  800640:	83 fa 01             	cmp    $0x1,%edx
+  800643:	74 7b                	je     8006c0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	0f 87 96 00 00 00    	ja     8006e7 <vprintfmt+0x3cc>
+  800651:	89 c2                	mov    %eax,%edx
+  800653:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800657:	83 c0 08             	add    $0x8,%eax
+  80065a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065d:	4c 8b 22             	mov    (%rdx),%r12
+  800660:	eb 17                	jmp    800679 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800662:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800665:	83 f8 2f             	cmp    $0x2f,%eax
+  800668:	77 21                	ja     80068b <vprintfmt+0x370>
+  80066a:	89 c2                	mov    %eax,%edx
+  80066c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800670:	83 c0 08             	add    $0x8,%eax
+  800673:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800676:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800679:	4d 85 e4             	test   %r12,%r12
+  80067c:	78 7a                	js     8006f8 <vprintfmt+0x3dd>
+            num = i;
+  80067e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800681:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800686:	e9 50 02 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80068b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800693:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800697:	eb dd                	jmp    800676 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800699:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069c:	83 f8 2f             	cmp    $0x2f,%eax
+  80069f:	77 11                	ja     8006b2 <vprintfmt+0x397>
+  8006a1:	89 c2                	mov    %eax,%edx
+  8006a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a7:	83 c0 08             	add    $0x8,%eax
+  8006aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ad:	4c 63 22             	movslq (%rdx),%r12
+  8006b0:	eb c7                	jmp    800679 <vprintfmt+0x35e>
+  8006b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006be:	eb ed                	jmp    8006ad <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c6:	77 11                	ja     8006d9 <vprintfmt+0x3be>
+  8006c8:	89 c2                	mov    %eax,%edx
+  8006ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ce:	83 c0 08             	add    $0x8,%eax
+  8006d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d4:	4c 8b 22             	mov    (%rdx),%r12
+  8006d7:	eb a0                	jmp    800679 <vprintfmt+0x35e>
+  8006d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e5:	eb ed                	jmp    8006d4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	e9 65 ff ff ff       	jmp    80065d <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f8:	4c 89 ee             	mov    %r13,%rsi
+  8006fb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800700:	41 ff d6             	call   *%r14
+                i = -i;
+  800703:	49 f7 dc             	neg    %r12
+  800706:	e9 73 ff ff ff       	jmp    80067e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80070b:	40 84 f6             	test   %sil,%sil
+  80070e:	75 32                	jne    800742 <vprintfmt+0x427>
+    switch (lflag) {
+  800710:	85 d2                	test   %edx,%edx
+  800712:	74 5d                	je     800771 <vprintfmt+0x456>
+  800714:	83 fa 01             	cmp    $0x1,%edx
+  800717:	0f 84 82 00 00 00    	je     80079f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800720:	83 f8 2f             	cmp    $0x2f,%eax
+  800723:	0f 87 a5 00 00 00    	ja     8007ce <vprintfmt+0x4b3>
+  800729:	89 c2                	mov    %eax,%edx
+  80072b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072f:	83 c0 08             	add    $0x8,%eax
+  800732:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800735:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800738:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80073d:	e9 99 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800742:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800745:	83 f8 2f             	cmp    $0x2f,%eax
+  800748:	77 19                	ja     800763 <vprintfmt+0x448>
+  80074a:	89 c2                	mov    %eax,%edx
+  80074c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800750:	83 c0 08             	add    $0x8,%eax
+  800753:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800756:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800759:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80075e:	e9 78 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800763:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800767:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076f:	eb e5                	jmp    800756 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800771:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800774:	83 f8 2f             	cmp    $0x2f,%eax
+  800777:	77 18                	ja     800791 <vprintfmt+0x476>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077f:	83 c0 08             	add    $0x8,%eax
+  800782:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800785:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800787:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80078c:	e9 4a 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800791:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800795:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800799:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079d:	eb e6                	jmp    800785 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80079f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a5:	77 19                	ja     8007c0 <vprintfmt+0x4a5>
+  8007a7:	89 c2                	mov    %eax,%edx
+  8007a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ad:	83 c0 08             	add    $0x8,%eax
+  8007b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007bb:	e9 1b 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  8007c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cc:	eb e5                	jmp    8007b3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	e9 56 ff ff ff       	jmp    800735 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007df:	40 84 f6             	test   %sil,%sil
+  8007e2:	75 2e                	jne    800812 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e4:	85 d2                	test   %edx,%edx
+  8007e6:	74 59                	je     800841 <vprintfmt+0x526>
+  8007e8:	83 fa 01             	cmp    $0x1,%edx
+  8007eb:	74 7f                	je     80086c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f3:	0f 87 9f 00 00 00    	ja     800898 <vprintfmt+0x57d>
+  8007f9:	89 c2                	mov    %eax,%edx
+  8007fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ff:	83 c0 08             	add    $0x8,%eax
+  800802:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800805:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800808:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080d:	e9 c9 00 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 19                	ja     800833 <vprintfmt+0x518>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800829:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082e:	e9 a8 00 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb e5                	jmp    800826 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800841:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800844:	83 f8 2f             	cmp    $0x2f,%eax
+  800847:	77 15                	ja     80085e <vprintfmt+0x543>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084f:	83 c0 08             	add    $0x8,%eax
+  800852:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800855:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800857:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80085c:	eb 7d                	jmp    8008db <vprintfmt+0x5c0>
+  80085e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800862:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800866:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086a:	eb e9                	jmp    800855 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 16                	ja     80088a <vprintfmt+0x56f>
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800883:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800888:	eb 51                	jmp    8008db <vprintfmt+0x5c0>
+  80088a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800896:	eb e8                	jmp    800880 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	e9 5c ff ff ff       	jmp    800805 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a9:	4c 89 ee             	mov    %r13,%rsi
+  8008ac:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008b1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b4:	4c 89 ee             	mov    %r13,%rsi
+  8008b7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008bc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c5:	77 47                	ja     80090e <vprintfmt+0x5f3>
+  8008c7:	89 c2                	mov    %eax,%edx
+  8008c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cd:	83 c0 08             	add    $0x8,%eax
+  8008d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008db:	48 83 ec 08          	sub    $0x8,%rsp
+  8008df:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e3:	0f 94 c0             	sete   %al
+  8008e6:	0f b6 c0             	movzbl %al,%eax
+  8008e9:	50                   	push   %rax
+  8008ea:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ef:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f3:	4c 89 ee             	mov    %r13,%rsi
+  8008f6:	4c 89 f7             	mov    %r14,%rdi
+  8008f9:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  800900:	00 00 00 
+  800903:	ff d0                	call   *%rax
+            break;
+  800905:	48 83 c4 10          	add    $0x10,%rsp
+  800909:	e9 3e fa ff ff       	jmp    80034c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80090e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800912:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091a:	eb b7                	jmp    8008d3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80091c:	40 84 f6             	test   %sil,%sil
+  80091f:	75 2b                	jne    80094c <vprintfmt+0x631>
+    switch (lflag) {
+  800921:	85 d2                	test   %edx,%edx
+  800923:	74 56                	je     80097b <vprintfmt+0x660>
+  800925:	83 fa 01             	cmp    $0x1,%edx
+  800928:	74 7f                	je     8009a9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80092a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092d:	83 f8 2f             	cmp    $0x2f,%eax
+  800930:	0f 87 a2 00 00 00    	ja     8009d8 <vprintfmt+0x6bd>
+  800936:	89 c2                	mov    %eax,%edx
+  800938:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093c:	83 c0 08             	add    $0x8,%eax
+  80093f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800942:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800945:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094a:	eb 8f                	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094f:	83 f8 2f             	cmp    $0x2f,%eax
+  800952:	77 19                	ja     80096d <vprintfmt+0x652>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800963:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800968:	e9 6e ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb e5                	jmp    800960 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80097b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097e:	83 f8 2f             	cmp    $0x2f,%eax
+  800981:	77 18                	ja     80099b <vprintfmt+0x680>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800991:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800996:	e9 40 ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb e6                	jmp    80098f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 19                	ja     8009ca <vprintfmt+0x6af>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c5:	e9 11 ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  8009ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d6:	eb e5                	jmp    8009bd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	e9 59 ff ff ff       	jmp    800942 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e9:	4c 89 ee             	mov    %r13,%rsi
+  8009ec:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f1:	41 ff d6             	call   *%r14
+            break;
+  8009f4:	e9 53 f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f9:	4c 89 ee             	mov    %r13,%rsi
+  8009fc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a01:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a04:	48 83 eb 01          	sub    $0x1,%rbx
+  800a08:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a0c:	75 f6                	jne    800a04 <vprintfmt+0x6e9>
+  800a0e:	e9 39 f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+}
+  800a13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a17:	5b                   	pop    %rbx
+  800a18:	41 5c                	pop    %r12
+  800a1a:	41 5d                	pop    %r13
+  800a1c:	41 5e                	pop    %r14
+  800a1e:	41 5f                	pop    %r15
+  800a20:	5d                   	pop    %rbp
+  800a21:	c3                   	ret
+
+0000000000800a22 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a22:	55                   	push   %rbp
+  800a23:	48 89 e5             	mov    %rsp,%rbp
+  800a26:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a2e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a33:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a37:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a3e:	48 85 ff             	test   %rdi,%rdi
+  800a41:	74 2b                	je     800a6e <vsnprintf+0x4c>
+  800a43:	48 85 f6             	test   %rsi,%rsi
+  800a46:	74 26                	je     800a6e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a4c:	48 bf c6 02 80 00 00 	movabs $0x8002c6,%rdi
+  800a53:	00 00 00 
+  800a56:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a66:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a6c:	c9                   	leave
+  800a6d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a73:	eb f7                	jmp    800a6c <vsnprintf+0x4a>
+
+0000000000800a75 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a75:	55                   	push   %rbp
+  800a76:	48 89 e5             	mov    %rsp,%rbp
+  800a79:	48 83 ec 50          	sub    $0x50,%rsp
+  800a7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa4:	48 b8 22 0a 80 00 00 	movabs $0x800a22,%rax
+  800aab:	00 00 00 
+  800aae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+
+0000000000800ab2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab5:	74 10                	je     800ac7 <strlen+0x15>
+    size_t n = 0;
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800abc:	48 83 c0 01          	add    $0x1,%rax
+  800ac0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac4:	75 f6                	jne    800abc <strlen+0xa>
+  800ac6:	c3                   	ret
+    size_t n = 0;
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800acc:	c3                   	ret
+
+0000000000800acd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800acd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad5:	48 85 f6             	test   %rsi,%rsi
+  800ad8:	74 11                	je     800aeb <strnlen+0x1e>
+  800ada:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ade:	74 0c                	je     800aec <strnlen+0x1f>
+  800ae0:	48 83 c2 01          	add    $0x1,%rdx
+  800ae4:	48 39 d0             	cmp    %rdx,%rax
+  800ae7:	75 f1                	jne    800ada <strnlen+0xd>
+  800ae9:	eb 04                	jmp    800aef <strnlen+0x22>
+  800aeb:	c3                   	ret
+  800aec:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aef:	c3                   	ret
+
+0000000000800af0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800afc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800aff:	48 83 c2 01          	add    $0x1,%rdx
+  800b03:	84 c9                	test   %cl,%cl
+  800b05:	75 f1                	jne    800af8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b07:	c3                   	ret
+
+0000000000800b08 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	41 54                	push   %r12
+  800b0e:	53                   	push   %rbx
+  800b0f:	48 89 fb             	mov    %rdi,%rbx
+  800b12:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b15:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  800b1c:	00 00 00 
+  800b1f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b21:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b25:	4c 89 e6             	mov    %r12,%rsi
+  800b28:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+    return dst;
+}
+  800b34:	48 89 d8             	mov    %rbx,%rax
+  800b37:	5b                   	pop    %rbx
+  800b38:	41 5c                	pop    %r12
+  800b3a:	5d                   	pop    %rbp
+  800b3b:	c3                   	ret
+
+0000000000800b3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b3f:	48 85 d2             	test   %rdx,%rdx
+  800b42:	74 1f                	je     800b63 <strncpy+0x27>
+  800b44:	48 01 fa             	add    %rdi,%rdx
+  800b47:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b4a:	48 83 c1 01          	add    $0x1,%rcx
+  800b4e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b52:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b56:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b5e:	48 39 ca             	cmp    %rcx,%rdx
+  800b61:	75 e7                	jne    800b4a <strncpy+0xe>
+    }
+    return ret;
+}
+  800b63:	c3                   	ret
+
+0000000000800b64 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b64:	48 89 f8             	mov    %rdi,%rax
+  800b67:	48 85 d2             	test   %rdx,%rdx
+  800b6a:	74 24                	je     800b90 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800b70:	74 1b                	je     800b8d <strlcpy+0x29>
+  800b72:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b76:	0f b6 16             	movzbl (%rsi),%edx
+  800b79:	84 d2                	test   %dl,%dl
+  800b7b:	74 10                	je     800b8d <strlcpy+0x29>
+            *dst++ = *src++;
+  800b7d:	48 83 c6 01          	add    $0x1,%rsi
+  800b81:	48 83 c0 01          	add    $0x1,%rax
+  800b85:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b88:	48 39 c8             	cmp    %rcx,%rax
+  800b8b:	75 e9                	jne    800b76 <strlcpy+0x12>
+        *dst = '\0';
+  800b8d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b90:	48 29 f8             	sub    %rdi,%rax
+}
+  800b93:	c3                   	ret
+
+0000000000800b94 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b94:	0f b6 07             	movzbl (%rdi),%eax
+  800b97:	84 c0                	test   %al,%al
+  800b99:	74 13                	je     800bae <strcmp+0x1a>
+  800b9b:	38 06                	cmp    %al,(%rsi)
+  800b9d:	75 0f                	jne    800bae <strcmp+0x1a>
+  800b9f:	48 83 c7 01          	add    $0x1,%rdi
+  800ba3:	48 83 c6 01          	add    $0x1,%rsi
+  800ba7:	0f b6 07             	movzbl (%rdi),%eax
+  800baa:	84 c0                	test   %al,%al
+  800bac:	75 ed                	jne    800b9b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bae:	0f b6 c0             	movzbl %al,%eax
+  800bb1:	0f b6 16             	movzbl (%rsi),%edx
+  800bb4:	29 d0                	sub    %edx,%eax
+}
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb7:	48 85 d2             	test   %rdx,%rdx
+  800bba:	74 1f                	je     800bdb <strncmp+0x24>
+  800bbc:	0f b6 07             	movzbl (%rdi),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	74 1e                	je     800be1 <strncmp+0x2a>
+  800bc3:	3a 06                	cmp    (%rsi),%al
+  800bc5:	75 1a                	jne    800be1 <strncmp+0x2a>
+  800bc7:	48 83 c7 01          	add    $0x1,%rdi
+  800bcb:	48 83 c6 01          	add    $0x1,%rsi
+  800bcf:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd3:	75 e7                	jne    800bbc <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bda:	c3                   	ret
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be0:	c3                   	ret
+  800be1:	48 85 d2             	test   %rdx,%rdx
+  800be4:	74 09                	je     800bef <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be6:	0f b6 07             	movzbl (%rdi),%eax
+  800be9:	0f b6 16             	movzbl (%rsi),%edx
+  800bec:	29 d0                	sub    %edx,%eax
+  800bee:	c3                   	ret
+    if (!n) return 0;
+  800bef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf5:	0f b6 17             	movzbl (%rdi),%edx
+  800bf8:	84 d2                	test   %dl,%dl
+  800bfa:	74 18                	je     800c14 <strchr+0x1f>
+        if (*str == c) {
+  800bfc:	0f be d2             	movsbl %dl,%edx
+  800bff:	39 f2                	cmp    %esi,%edx
+  800c01:	74 17                	je     800c1a <strchr+0x25>
+    for (; *str; str++) {
+  800c03:	48 83 c7 01          	add    $0x1,%rdi
+  800c07:	0f b6 17             	movzbl (%rdi),%edx
+  800c0a:	84 d2                	test   %dl,%dl
+  800c0c:	75 ee                	jne    800bfc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c13:	c3                   	ret
+  800c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c19:	c3                   	ret
+  800c1a:	48 89 f8             	mov    %rdi,%rax
+}
+  800c1d:	c3                   	ret
+
+0000000000800c1e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c1e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c21:	0f b6 17             	movzbl (%rdi),%edx
+  800c24:	84 d2                	test   %dl,%dl
+  800c26:	74 13                	je     800c3b <strfind+0x1d>
+  800c28:	0f be d2             	movsbl %dl,%edx
+  800c2b:	39 f2                	cmp    %esi,%edx
+  800c2d:	74 0b                	je     800c3a <strfind+0x1c>
+  800c2f:	48 83 c0 01          	add    $0x1,%rax
+  800c33:	0f b6 10             	movzbl (%rax),%edx
+  800c36:	84 d2                	test   %dl,%dl
+  800c38:	75 ee                	jne    800c28 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c3a:	c3                   	ret
+  800c3b:	c3                   	ret
+
+0000000000800c3c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c3c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c3f:	48 89 f8             	mov    %rdi,%rax
+  800c42:	48 f7 d8             	neg    %rax
+  800c45:	83 e0 07             	and    $0x7,%eax
+  800c48:	49 89 d1             	mov    %rdx,%r9
+  800c4b:	49 29 c1             	sub    %rax,%r9
+  800c4e:	78 36                	js     800c86 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c50:	40 0f b6 c6          	movzbl %sil,%eax
+  800c54:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c5b:	01 01 01 
+  800c5e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c62:	40 f6 c7 07          	test   $0x7,%dil
+  800c66:	75 38                	jne    800ca0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c68:	4c 89 c9             	mov    %r9,%rcx
+  800c6b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c6f:	74 0c                	je     800c7d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c71:	fc                   	cld
+  800c72:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c75:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c79:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c7d:	4d 85 c9             	test   %r9,%r9
+  800c80:	75 45                	jne    800cc7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c82:	4c 89 c0             	mov    %r8,%rax
+  800c85:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c86:	48 85 d2             	test   %rdx,%rdx
+  800c89:	74 f7                	je     800c82 <memset+0x46>
+  800c8b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c8e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c91:	48 83 c0 01          	add    $0x1,%rax
+  800c95:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c99:	48 39 c2             	cmp    %rax,%rdx
+  800c9c:	75 f3                	jne    800c91 <memset+0x55>
+  800c9e:	eb e2                	jmp    800c82 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca0:	40 f6 c7 01          	test   $0x1,%dil
+  800ca4:	74 06                	je     800cac <memset+0x70>
+  800ca6:	88 07                	mov    %al,(%rdi)
+  800ca8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cac:	40 f6 c7 02          	test   $0x2,%dil
+  800cb0:	74 07                	je     800cb9 <memset+0x7d>
+  800cb2:	66 89 07             	mov    %ax,(%rdi)
+  800cb5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb9:	40 f6 c7 04          	test   $0x4,%dil
+  800cbd:	74 a9                	je     800c68 <memset+0x2c>
+  800cbf:	89 07                	mov    %eax,(%rdi)
+  800cc1:	48 83 c7 04          	add    $0x4,%rdi
+  800cc5:	eb a1                	jmp    800c68 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc7:	41 f6 c1 04          	test   $0x4,%r9b
+  800ccb:	74 06                	je     800cd3 <memset+0x97>
+  800ccd:	89 07                	mov    %eax,(%rdi)
+  800ccf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd3:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd7:	74 07                	je     800ce0 <memset+0xa4>
+  800cd9:	66 89 07             	mov    %ax,(%rdi)
+  800cdc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce0:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce4:	74 9c                	je     800c82 <memset+0x46>
+  800ce6:	88 07                	mov    %al,(%rdi)
+  800ce8:	eb 98                	jmp    800c82 <memset+0x46>
+
+0000000000800cea <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+  800ced:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf0:	48 39 fe             	cmp    %rdi,%rsi
+  800cf3:	73 3b                	jae    800d30 <memmove+0x46>
+  800cf5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf9:	48 39 d7             	cmp    %rdx,%rdi
+  800cfc:	73 32                	jae    800d30 <memmove+0x46>
+        s += n;
+        d += n;
+  800cfe:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d02:	48 89 d6             	mov    %rdx,%rsi
+  800d05:	48 09 fe             	or     %rdi,%rsi
+  800d08:	48 09 ce             	or     %rcx,%rsi
+  800d0b:	40 f6 c6 07          	test   $0x7,%sil
+  800d0f:	75 12                	jne    800d23 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d11:	48 83 ef 08          	sub    $0x8,%rdi
+  800d15:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d19:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d1d:	fd                   	std
+  800d1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d21:	fc                   	cld
+  800d22:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d23:	48 83 ef 01          	sub    $0x1,%rdi
+  800d27:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d2b:	fd                   	std
+  800d2c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d2e:	eb f1                	jmp    800d21 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d30:	48 89 f2             	mov    %rsi,%rdx
+  800d33:	48 09 c2             	or     %rax,%rdx
+  800d36:	48 09 ca             	or     %rcx,%rdx
+  800d39:	f6 c2 07             	test   $0x7,%dl
+  800d3c:	75 0c                	jne    800d4a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d3e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d42:	48 89 c7             	mov    %rax,%rdi
+  800d45:	fc                   	cld
+  800d46:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d49:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d4a:	48 89 c7             	mov    %rax,%rdi
+  800d4d:	fc                   	cld
+  800d4e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d50:	c3                   	ret
+
+0000000000800d51 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d51:	55                   	push   %rbp
+  800d52:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d55:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  800d5c:	00 00 00 
+  800d5f:	ff d0                	call   *%rax
+}
+  800d61:	5d                   	pop    %rbp
+  800d62:	c3                   	ret
+
+0000000000800d63 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	41 57                	push   %r15
+  800d69:	41 56                	push   %r14
+  800d6b:	41 55                	push   %r13
+  800d6d:	41 54                	push   %r12
+  800d6f:	53                   	push   %rbx
+  800d70:	48 83 ec 08          	sub    $0x8,%rsp
+  800d74:	49 89 fe             	mov    %rdi,%r14
+  800d77:	49 89 f7             	mov    %rsi,%r15
+  800d7a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d7d:	48 89 f7             	mov    %rsi,%rdi
+  800d80:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  800d87:	00 00 00 
+  800d8a:	ff d0                	call   *%rax
+  800d8c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d8f:	48 89 de             	mov    %rbx,%rsi
+  800d92:	4c 89 f7             	mov    %r14,%rdi
+  800d95:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+  800da1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da4:	48 39 c3             	cmp    %rax,%rbx
+  800da7:	74 36                	je     800ddf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da9:	48 89 d8             	mov    %rbx,%rax
+  800dac:	4c 29 e8             	sub    %r13,%rax
+  800daf:	49 39 c4             	cmp    %rax,%r12
+  800db2:	73 31                	jae    800de5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dbd:	4c 89 fe             	mov    %r15,%rsi
+  800dc0:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dcc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd0:	48 83 c4 08          	add    $0x8,%rsp
+  800dd4:	5b                   	pop    %rbx
+  800dd5:	41 5c                	pop    %r12
+  800dd7:	41 5d                	pop    %r13
+  800dd9:	41 5e                	pop    %r14
+  800ddb:	41 5f                	pop    %r15
+  800ddd:	5d                   	pop    %rbp
+  800dde:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ddf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de3:	eb eb                	jmp    800dd0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de5:	48 83 eb 01          	sub    $0x1,%rbx
+  800de9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ded:	48 89 da             	mov    %rbx,%rdx
+  800df0:	4c 89 fe             	mov    %r15,%rsi
+  800df3:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  800dfa:	00 00 00 
+  800dfd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800dff:	49 01 de             	add    %rbx,%r14
+  800e02:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e07:	eb c3                	jmp    800dcc <strlcat+0x69>
+
+0000000000800e09 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e09:	48 85 d2             	test   %rdx,%rdx
+  800e0c:	74 2d                	je     800e3b <memcmp+0x32>
+  800e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e13:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e17:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e1c:	44 38 c1             	cmp    %r8b,%cl
+  800e1f:	75 0f                	jne    800e30 <memcmp+0x27>
+    while (n-- > 0) {
+  800e21:	48 83 c0 01          	add    $0x1,%rax
+  800e25:	48 39 c2             	cmp    %rax,%rdx
+  800e28:	75 e9                	jne    800e13 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e30:	0f b6 c1             	movzbl %cl,%eax
+  800e33:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e37:	44 29 c0             	sub    %r8d,%eax
+  800e3a:	c3                   	ret
+    return 0;
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e40:	c3                   	ret
+
+0000000000800e41 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e41:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e45:	48 39 c7             	cmp    %rax,%rdi
+  800e48:	73 0f                	jae    800e59 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e4a:	40 38 37             	cmp    %sil,(%rdi)
+  800e4d:	74 0e                	je     800e5d <memfind+0x1c>
+    for (; src < end; src++) {
+  800e4f:	48 83 c7 01          	add    $0x1,%rdi
+  800e53:	48 39 f8             	cmp    %rdi,%rax
+  800e56:	75 f2                	jne    800e4a <memfind+0x9>
+  800e58:	c3                   	ret
+  800e59:	48 89 f8             	mov    %rdi,%rax
+  800e5c:	c3                   	ret
+  800e5d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e60:	c3                   	ret
+
+0000000000800e61 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e61:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e64:	0f b6 37             	movzbl (%rdi),%esi
+  800e67:	40 80 fe 20          	cmp    $0x20,%sil
+  800e6b:	74 06                	je     800e73 <strtol+0x12>
+  800e6d:	40 80 fe 09          	cmp    $0x9,%sil
+  800e71:	75 13                	jne    800e86 <strtol+0x25>
+  800e73:	48 83 c7 01          	add    $0x1,%rdi
+  800e77:	0f b6 37             	movzbl (%rdi),%esi
+  800e7a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7e:	74 f3                	je     800e73 <strtol+0x12>
+  800e80:	40 80 fe 09          	cmp    $0x9,%sil
+  800e84:	74 ed                	je     800e73 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e86:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e89:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e8c:	3c 01                	cmp    $0x1,%al
+  800e8e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e92:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e98:	75 0f                	jne    800ea9 <strtol+0x48>
+  800e9a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e9d:	74 14                	je     800eb3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e9f:	85 d2                	test   %edx,%edx
+  800ea1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eae:	4c 63 ca             	movslq %edx,%r9
+  800eb1:	eb 36                	jmp    800ee9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb7:	74 0f                	je     800ec8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb9:	85 d2                	test   %edx,%edx
+  800ebb:	75 ec                	jne    800ea9 <strtol+0x48>
+        s++;
+  800ebd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ec1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec6:	eb e1                	jmp    800ea9 <strtol+0x48>
+        s += 2;
+  800ec8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ecc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ed1:	eb d6                	jmp    800ea9 <strtol+0x48>
+            dig -= '0';
+  800ed3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed6:	44 0f b6 c1          	movzbl %cl,%r8d
+  800eda:	41 39 d0             	cmp    %edx,%r8d
+  800edd:	7d 21                	jge    800f00 <strtol+0x9f>
+        val = val * base + dig;
+  800edf:	49 0f af c1          	imul   %r9,%rax
+  800ee3:	0f b6 c9             	movzbl %cl,%ecx
+  800ee6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee9:	48 83 c7 01          	add    $0x1,%rdi
+  800eed:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ef1:	80 f9 39             	cmp    $0x39,%cl
+  800ef4:	76 dd                	jbe    800ed3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef6:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef9:	77 05                	ja     800f00 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800efb:	83 e9 57             	sub    $0x57,%ecx
+  800efe:	eb d6                	jmp    800ed6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f00:	4d 85 d2             	test   %r10,%r10
+  800f03:	74 03                	je     800f08 <strtol+0xa7>
+  800f05:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f08:	48 89 c2             	mov    %rax,%rdx
+  800f0b:	48 f7 da             	neg    %rdx
+  800f0e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f12:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f16:	c3                   	ret
+
+0000000000800f17 <strrev>:
+
+void
+strrev(char *str)
+{
+  800f17:	55                   	push   %rbp
+  800f18:	48 89 e5             	mov    %rsp,%rbp
+  800f1b:	53                   	push   %rbx
+  800f1c:	48 83 ec 08          	sub    $0x8,%rsp
+  800f20:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f23:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f2f:	83 e8 01             	sub    $0x1,%eax
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7e 22                	jle    800f58 <strrev+0x41>
+  800f36:	48 98                	cltq
+  800f38:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f3d:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f41:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f45:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f49:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f4c:	48 83 c2 01          	add    $0x1,%rdx
+  800f50:	48 83 e8 01          	sub    $0x1,%rax
+  800f54:	39 c2                	cmp    %eax,%edx
+  800f56:	7c e5                	jl     800f3d <strrev+0x26>
+	}
+}
+  800f58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f5c:	c9                   	leave
+  800f5d:	c3                   	ret
+
+0000000000800f5e <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f5e:	85 d2                	test   %edx,%edx
+  800f60:	0f 84 80 00 00 00    	je     800fe6 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f66:	55                   	push   %rbp
+  800f67:	48 89 e5             	mov    %rsp,%rbp
+  800f6a:	53                   	push   %rbx
+  800f6b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f6f:	49 89 f2             	mov    %rsi,%r10
+  800f72:	41 89 d3             	mov    %edx,%r11d
+  800f75:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f78:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800f7d:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800f80:	eb 20                	jmp    800fa2 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800f82:	41 89 f1             	mov    %esi,%r9d
+  800f85:	83 c2 30             	add    $0x30,%edx
+  800f88:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800f8b:	89 f8                	mov    %edi,%eax
+  800f8d:	99                   	cltd
+  800f8e:	f7 f9                	idiv   %ecx
+  800f90:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	74 2e                	je     800fc4 <itoa+0x66>
+  800f96:	83 c6 01             	add    $0x1,%esi
+  800f99:	49 83 c0 01          	add    $0x1,%r8
+  800f9d:	44 39 cb             	cmp    %r9d,%ebx
+  800fa0:	7e 15                	jle    800fb7 <itoa+0x59>
+		digit = sum % base;
+  800fa2:	89 f8                	mov    %edi,%eax
+  800fa4:	99                   	cltd
+  800fa5:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fa7:	83 fa 09             	cmp    $0x9,%edx
+  800faa:	7e d6                	jle    800f82 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800fac:	41 89 f1             	mov    %esi,%r9d
+  800faf:	83 c2 37             	add    $0x37,%edx
+  800fb2:	41 88 10             	mov    %dl,(%r8)
+  800fb5:	eb d4                	jmp    800f8b <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fb7:	41 83 eb 01          	sub    $0x1,%r11d
+  800fbb:	45 39 cb             	cmp    %r9d,%r11d
+  800fbe:	75 04                	jne    800fc4 <itoa+0x66>
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	75 28                	jne    800fec <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fc4:	4d 63 c9             	movslq %r9d,%r9
+  800fc7:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fcc:	4c 89 d7             	mov    %r10,%rdi
+  800fcf:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+	return 0;
+  800fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe4:	c9                   	leave
+  800fe5:	c3                   	ret
+		return -1;
+  800fe6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800feb:	c3                   	ret
+		return -1;
+  800fec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800ff1:	eb ed                	jmp    800fe0 <itoa+0x82>
+
+0000000000800ff3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ff3:	55                   	push   %rbp
+  800ff4:	48 89 e5             	mov    %rsp,%rbp
+  800ff7:	53                   	push   %rbx
+  800ff8:	48 89 fa             	mov    %rdi,%rdx
+  800ffb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100d:	be 00 00 00 00       	mov    $0x0,%esi
+  801012:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801018:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80101a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101e:	c9                   	leave
+  80101f:	c3                   	ret
+
+0000000000801020 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801020:	55                   	push   %rbp
+  801021:	48 89 e5             	mov    %rsp,%rbp
+  801024:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801025:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103e:	be 00 00 00 00       	mov    $0x0,%esi
+  801043:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801049:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104f:	c9                   	leave
+  801050:	c3                   	ret
+
+0000000000801051 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801051:	55                   	push   %rbp
+  801052:	48 89 e5             	mov    %rsp,%rbp
+  801055:	53                   	push   %rbx
+  801056:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80105a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80105d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801062:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801071:	be 00 00 00 00       	mov    $0x0,%esi
+  801076:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80107e:	48 85 c0             	test   %rax,%rax
+  801081:	7f 06                	jg     801089 <sys_env_destroy+0x38>
+}
+  801083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801087:	c9                   	leave
+  801088:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801089:	49 89 c0             	mov    %rax,%r8
+  80108c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801091:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  801098:	00 00 00 
+  80109b:	be 26 00 00 00       	mov    $0x26,%esi
+  8010a0:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  8010a7:	00 00 00 
+  8010aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010af:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  8010b6:	00 00 00 
+  8010b9:	41 ff d1             	call   *%r9
+
+00000000008010bc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010eb:	c9                   	leave
+  8010ec:	c3                   	ret
+
+00000000008010ed <sys_yield>:
+
+void
+sys_yield(void) {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801116:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	53                   	push   %rbx
+  801123:	48 89 fa             	mov    %rdi,%rdx
+  801126:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801129:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80112e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801135:	00 00 00 
+  801138:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113d:	be 00 00 00 00       	mov    $0x0,%esi
+  801142:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801148:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80114a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114e:	c9                   	leave
+  80114f:	c3                   	ret
+
+0000000000801150 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801150:	55                   	push   %rbp
+  801151:	48 89 e5             	mov    %rsp,%rbp
+  801154:	53                   	push   %rbx
+  801155:	49 89 f8             	mov    %rdi,%r8
+  801158:	48 89 d3             	mov    %rdx,%rbx
+  80115b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80115e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801163:	4c 89 c2             	mov    %r8,%rdx
+  801166:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801169:	be 00 00 00 00       	mov    $0x0,%esi
+  80116e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801174:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801176:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117a:	c9                   	leave
+  80117b:	c3                   	ret
+
+000000000080117c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80117c:	55                   	push   %rbp
+  80117d:	48 89 e5             	mov    %rsp,%rbp
+  801180:	53                   	push   %rbx
+  801181:	48 83 ec 08          	sub    $0x8,%rsp
+  801185:	89 f8                	mov    %edi,%eax
+  801187:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80118a:	48 63 f9             	movslq %ecx,%rdi
+  80118d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801190:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801195:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801198:	be 00 00 00 00       	mov    $0x0,%esi
+  80119d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a5:	48 85 c0             	test   %rax,%rax
+  8011a8:	7f 06                	jg     8011b0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b0:	49 89 c0             	mov    %rax,%r8
+  8011b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011b8:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  8011bf:	00 00 00 
+  8011c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c7:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  8011ce:	00 00 00 
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d6:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  8011dd:	00 00 00 
+  8011e0:	41 ff d1             	call   *%r9
+
+00000000008011e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+  8011e7:	53                   	push   %rbx
+  8011e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ec:	89 f8                	mov    %edi,%eax
+  8011ee:	49 89 f2             	mov    %rsi,%r10
+  8011f1:	48 89 cf             	mov    %rcx,%rdi
+  8011f4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011f7:	48 63 da             	movslq %edx,%rbx
+  8011fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801202:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801205:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801208:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120a:	48 85 c0             	test   %rax,%rax
+  80120d:	7f 06                	jg     801215 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80120f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801215:	49 89 c0             	mov    %rax,%r8
+  801218:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80121d:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  801224:	00 00 00 
+  801227:	be 26 00 00 00       	mov    $0x26,%esi
+  80122c:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  801233:	00 00 00 
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123b:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  801242:	00 00 00 
+  801245:	41 ff d1             	call   *%r9
+
+0000000000801248 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801248:	55                   	push   %rbp
+  801249:	48 89 e5             	mov    %rsp,%rbp
+  80124c:	53                   	push   %rbx
+  80124d:	48 83 ec 08          	sub    $0x8,%rsp
+  801251:	48 89 f1             	mov    %rsi,%rcx
+  801254:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801257:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801264:	be 00 00 00 00       	mov    $0x0,%esi
+  801269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 06                	jg     80127c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127a:	c9                   	leave
+  80127b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127c:	49 89 c0             	mov    %rax,%r8
+  80127f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801284:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  80128b:	00 00 00 
+  80128e:	be 26 00 00 00       	mov    $0x26,%esi
+  801293:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  80129a:	00 00 00 
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a2:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  8012a9:	00 00 00 
+  8012ac:	41 ff d1             	call   *%r9
+
+00000000008012af <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012af:	55                   	push   %rbp
+  8012b0:	48 89 e5             	mov    %rsp,%rbp
+  8012b3:	53                   	push   %rbx
+  8012b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012b8:	48 63 ce             	movslq %esi,%rcx
+  8012bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012da:	48 85 c0             	test   %rax,%rax
+  8012dd:	7f 06                	jg     8012e5 <sys_env_set_status+0x36>
+}
+  8012df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e5:	49 89 c0             	mov    %rax,%r8
+  8012e8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012ed:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  8012f4:	00 00 00 
+  8012f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fc:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  801303:	00 00 00 
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130b:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  801312:	00 00 00 
+  801315:	41 ff d1             	call   *%r9
+
+0000000000801318 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 08          	sub    $0x8,%rsp
+  801321:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801324:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801327:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801331:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801336:	be 00 00 00 00       	mov    $0x0,%esi
+  80133b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801341:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801343:	48 85 c0             	test   %rax,%rax
+  801346:	7f 06                	jg     80134e <sys_env_set_trapframe+0x36>
+}
+  801348:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134c:	c9                   	leave
+  80134d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134e:	49 89 c0             	mov    %rax,%r8
+  801351:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801356:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  80135d:	00 00 00 
+  801360:	be 26 00 00 00       	mov    $0x26,%esi
+  801365:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  80136c:	00 00 00 
+  80136f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801374:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  80137b:	00 00 00 
+  80137e:	41 ff d1             	call   *%r9
+
+0000000000801381 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801381:	55                   	push   %rbp
+  801382:	48 89 e5             	mov    %rsp,%rbp
+  801385:	53                   	push   %rbx
+  801386:	48 83 ec 08          	sub    $0x8,%rsp
+  80138a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80138d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801390:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139f:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ac:	48 85 c0             	test   %rax,%rax
+  8013af:	7f 06                	jg     8013b7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b5:	c9                   	leave
+  8013b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b7:	49 89 c0             	mov    %rax,%r8
+  8013ba:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013bf:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  8013c6:	00 00 00 
+  8013c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ce:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  8013d5:	00 00 00 
+  8013d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dd:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  8013e4:	00 00 00 
+  8013e7:	41 ff d1             	call   *%r9
+
+00000000008013ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ea:	55                   	push   %rbp
+  8013eb:	48 89 e5             	mov    %rsp,%rbp
+  8013ee:	53                   	push   %rbx
+  8013ef:	89 f8                	mov    %edi,%eax
+  8013f1:	49 89 f1             	mov    %rsi,%r9
+  8013f4:	48 89 d3             	mov    %rdx,%rbx
+  8013f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013fa:	49 63 f0             	movslq %r8d,%rsi
+  8013fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801400:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801405:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140e:	cd 30                	int    $0x30
+}
+  801410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+
+0000000000801416 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	53                   	push   %rbx
+  80141b:	48 83 ec 08          	sub    $0x8,%rsp
+  80141f:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801422:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143f:	48 85 c0             	test   %rax,%rax
+  801442:	7f 06                	jg     80144a <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144a:	49 89 c0             	mov    %rax,%r8
+  80144d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801452:	48 ba e8 3b 80 00 00 	movabs $0x803be8,%rdx
+  801459:	00 00 00 
+  80145c:	be 26 00 00 00       	mov    $0x26,%esi
+  801461:	48 bf 07 3c 80 00 00 	movabs $0x803c07,%rdi
+  801468:	00 00 00 
+  80146b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801470:	49 b9 dd 33 80 00 00 	movabs $0x8033dd,%r9
+  801477:	00 00 00 
+  80147a:	41 ff d1             	call   *%r9
+
+000000000080147d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801481:	ba 00 00 00 00       	mov    $0x0,%edx
+  801486:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  80148d:	00 00 00 
+  801490:	ff d0                	call   *%rax
+}
+  801492:	5d                   	pop    %rbp
+  801493:	c3                   	ret
+
+0000000000801494 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801494:	55                   	push   %rbp
+  801495:	48 89 e5             	mov    %rsp,%rbp
+  801498:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801499:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+00000000008014c5 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014ca:	48 63 ce             	movslq %esi,%rcx
+  8014cd:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014eb:	cd 30                	int    $0x30
+}
+  8014ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8014fb:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ff:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801504:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801509:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150e:	be 00 00 00 00       	mov    $0x0,%esi
+  801513:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801519:	cd 30                	int    $0x30
+}
+  80151b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151f:	c9                   	leave
+  801520:	c3                   	ret
+
+0000000000801521 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	53                   	push   %rbx
+  801526:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801529:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80152c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801531:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801534:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801539:	be 00 00 00 00       	mov    $0x0,%esi
+  80153e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801544:	cd 30                	int    $0x30
+}
+  801546:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154a:	c9                   	leave
+  80154b:	c3                   	ret
+
+000000000080154c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80154c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801553:	ff ff ff 
+  801556:	48 01 f8             	add    %rdi,%rax
+  801559:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80155d:	c3                   	ret
+
+000000000080155e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80155e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801565:	ff ff ff 
+  801568:	48 01 f8             	add    %rdi,%rax
+  80156b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80156f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801575:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801579:	c3                   	ret
+
+000000000080157a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80157a:	55                   	push   %rbp
+  80157b:	48 89 e5             	mov    %rsp,%rbp
+  80157e:	41 57                	push   %r15
+  801580:	41 56                	push   %r14
+  801582:	41 55                	push   %r13
+  801584:	41 54                	push   %r12
+  801586:	53                   	push   %rbx
+  801587:	48 83 ec 08          	sub    $0x8,%rsp
+  80158b:	49 89 ff             	mov    %rdi,%r15
+  80158e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801593:	49 bd 99 30 80 00 00 	movabs $0x803099,%r13
+  80159a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80159d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015a3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015a6:	48 89 df             	mov    %rbx,%rdi
+  8015a9:	41 ff d5             	call   *%r13
+  8015ac:	83 e0 04             	and    $0x4,%eax
+  8015af:	74 17                	je     8015c8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015b1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015b8:	4c 39 f3             	cmp    %r14,%rbx
+  8015bb:	75 e6                	jne    8015a3 <fd_alloc+0x29>
+  8015bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015c3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015c8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015cb:	48 83 c4 08          	add    $0x8,%rsp
+  8015cf:	5b                   	pop    %rbx
+  8015d0:	41 5c                	pop    %r12
+  8015d2:	41 5d                	pop    %r13
+  8015d4:	41 5e                	pop    %r14
+  8015d6:	41 5f                	pop    %r15
+  8015d8:	5d                   	pop    %rbp
+  8015d9:	c3                   	ret
+
+00000000008015da <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015da:	83 ff 1f             	cmp    $0x1f,%edi
+  8015dd:	77 39                	ja     801618 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	41 54                	push   %r12
+  8015e5:	53                   	push   %rbx
+  8015e6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015e9:	48 63 df             	movslq %edi,%rbx
+  8015ec:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015f3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015f7:	48 89 df             	mov    %rbx,%rdi
+  8015fa:	48 b8 99 30 80 00 00 	movabs $0x803099,%rax
+  801601:	00 00 00 
+  801604:	ff d0                	call   *%rax
+  801606:	a8 04                	test   $0x4,%al
+  801608:	74 14                	je     80161e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80160a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801613:	5b                   	pop    %rbx
+  801614:	41 5c                	pop    %r12
+  801616:	5d                   	pop    %rbp
+  801617:	c3                   	ret
+        return -E_INVAL;
+  801618:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80161d:	c3                   	ret
+        return -E_INVAL;
+  80161e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801623:	eb ee                	jmp    801613 <fd_lookup+0x39>
+
+0000000000801625 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801625:	55                   	push   %rbp
+  801626:	48 89 e5             	mov    %rsp,%rbp
+  801629:	41 54                	push   %r12
+  80162b:	53                   	push   %rbx
+  80162c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80162f:	48 b8 c0 3c 80 00 00 	movabs $0x803cc0,%rax
+  801636:	00 00 00 
+  801639:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801640:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801643:	39 3b                	cmp    %edi,(%rbx)
+  801645:	74 47                	je     80168e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801647:	48 83 c0 08          	add    $0x8,%rax
+  80164b:	48 8b 18             	mov    (%rax),%rbx
+  80164e:	48 85 db             	test   %rbx,%rbx
+  801651:	75 f0                	jne    801643 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801653:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80165a:	00 00 00 
+  80165d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801663:	89 fa                	mov    %edi,%edx
+  801665:	48 bf 18 3c 80 00 00 	movabs $0x803c18,%rdi
+  80166c:	00 00 00 
+  80166f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801674:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  80167b:	00 00 00 
+  80167e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801680:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801685:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801689:	5b                   	pop    %rbx
+  80168a:	41 5c                	pop    %r12
+  80168c:	5d                   	pop    %rbp
+  80168d:	c3                   	ret
+            return 0;
+  80168e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801693:	eb f0                	jmp    801685 <dev_lookup+0x60>
+
+0000000000801695 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	41 55                	push   %r13
+  80169b:	41 54                	push   %r12
+  80169d:	53                   	push   %rbx
+  80169e:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a2:	48 89 fb             	mov    %rdi,%rbx
+  8016a5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016a8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016af:	ff ff ff 
+  8016b2:	48 01 df             	add    %rbx,%rdi
+  8016b5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016b9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016bd:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  8016c4:	00 00 00 
+  8016c7:	ff d0                	call   *%rax
+  8016c9:	41 89 c5             	mov    %eax,%r13d
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 06                	js     8016d6 <fd_close+0x41>
+  8016d0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016d4:	74 1a                	je     8016f0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016d6:	45 84 e4             	test   %r12b,%r12b
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016e2:	44 89 e8             	mov    %r13d,%eax
+  8016e5:	48 83 c4 18          	add    $0x18,%rsp
+  8016e9:	5b                   	pop    %rbx
+  8016ea:	41 5c                	pop    %r12
+  8016ec:	41 5d                	pop    %r13
+  8016ee:	5d                   	pop    %rbp
+  8016ef:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016f0:	8b 3b                	mov    (%rbx),%edi
+  8016f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016f6:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  8016fd:	00 00 00 
+  801700:	ff d0                	call   *%rax
+  801702:	41 89 c5             	mov    %eax,%r13d
+  801705:	85 c0                	test   %eax,%eax
+  801707:	78 1b                	js     801724 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801709:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80170d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801711:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801717:	48 85 c0             	test   %rax,%rax
+  80171a:	74 08                	je     801724 <fd_close+0x8f>
+  80171c:	48 89 df             	mov    %rbx,%rdi
+  80171f:	ff d0                	call   *%rax
+  801721:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801724:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801729:	48 89 de             	mov    %rbx,%rsi
+  80172c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801731:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  801738:	00 00 00 
+  80173b:	ff d0                	call   *%rax
+    return res;
+  80173d:	eb a3                	jmp    8016e2 <fd_close+0x4d>
+
+000000000080173f <close>:
+
+int
+close(int fdnum) {
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801747:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80174b:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 15                	js     801770 <close+0x31>
+
+    return fd_close(fd, 1);
+  80175b:	be 01 00 00 00       	mov    $0x1,%esi
+  801760:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801764:	48 b8 95 16 80 00 00 	movabs $0x801695,%rax
+  80176b:	00 00 00 
+  80176e:	ff d0                	call   *%rax
+}
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+0000000000801772 <close_all>:
+
+void
+close_all(void) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+  801776:	41 54                	push   %r12
+  801778:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801779:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177e:	49 bc 3f 17 80 00 00 	movabs $0x80173f,%r12
+  801785:	00 00 00 
+  801788:	89 df                	mov    %ebx,%edi
+  80178a:	41 ff d4             	call   *%r12
+  80178d:	83 c3 01             	add    $0x1,%ebx
+  801790:	83 fb 20             	cmp    $0x20,%ebx
+  801793:	75 f3                	jne    801788 <close_all+0x16>
+}
+  801795:	5b                   	pop    %rbx
+  801796:	41 5c                	pop    %r12
+  801798:	5d                   	pop    %rbp
+  801799:	c3                   	ret
+
+000000000080179a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80179a:	55                   	push   %rbp
+  80179b:	48 89 e5             	mov    %rsp,%rbp
+  80179e:	41 57                	push   %r15
+  8017a0:	41 56                	push   %r14
+  8017a2:	41 55                	push   %r13
+  8017a4:	41 54                	push   %r12
+  8017a6:	53                   	push   %rbx
+  8017a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8017ab:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017b2:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  8017b9:	00 00 00 
+  8017bc:	ff d0                	call   *%rax
+  8017be:	89 c3                	mov    %eax,%ebx
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	0f 88 b8 00 00 00    	js     801880 <dup+0xe6>
+    close(newfdnum);
+  8017c8:	44 89 e7             	mov    %r12d,%edi
+  8017cb:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  8017d2:	00 00 00 
+  8017d5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017d7:	4d 63 ec             	movslq %r12d,%r13
+  8017da:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017e1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017e5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017e9:	4c 89 ff             	mov    %r15,%rdi
+  8017ec:	49 be 5e 15 80 00 00 	movabs $0x80155e,%r14
+  8017f3:	00 00 00 
+  8017f6:	41 ff d6             	call   *%r14
+  8017f9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017fc:	4c 89 ef             	mov    %r13,%rdi
+  8017ff:	41 ff d6             	call   *%r14
+  801802:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801805:	48 89 df             	mov    %rbx,%rdi
+  801808:	48 b8 99 30 80 00 00 	movabs $0x803099,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801814:	a8 04                	test   $0x4,%al
+  801816:	74 2b                	je     801843 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801818:	41 89 c1             	mov    %eax,%r9d
+  80181b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801821:	4c 89 f1             	mov    %r14,%rcx
+  801824:	ba 00 00 00 00       	mov    $0x0,%edx
+  801829:	48 89 de             	mov    %rbx,%rsi
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801831:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+  80183d:	89 c3                	mov    %eax,%ebx
+  80183f:	85 c0                	test   %eax,%eax
+  801841:	78 4e                	js     801891 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801843:	4c 89 ff             	mov    %r15,%rdi
+  801846:	48 b8 99 30 80 00 00 	movabs $0x803099,%rax
+  80184d:	00 00 00 
+  801850:	ff d0                	call   *%rax
+  801852:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801855:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80185b:	4c 89 e9             	mov    %r13,%rcx
+  80185e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801863:	4c 89 fe             	mov    %r15,%rsi
+  801866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186b:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801872:	00 00 00 
+  801875:	ff d0                	call   *%rax
+  801877:	89 c3                	mov    %eax,%ebx
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 14                	js     801891 <dup+0xf7>
+
+    return newfdnum;
+  80187d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801880:	89 d8                	mov    %ebx,%eax
+  801882:	48 83 c4 18          	add    $0x18,%rsp
+  801886:	5b                   	pop    %rbx
+  801887:	41 5c                	pop    %r12
+  801889:	41 5d                	pop    %r13
+  80188b:	41 5e                	pop    %r14
+  80188d:	41 5f                	pop    %r15
+  80188f:	5d                   	pop    %rbp
+  801890:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801891:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801896:	4c 89 ee             	mov    %r13,%rsi
+  801899:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189e:	49 bc 48 12 80 00 00 	movabs $0x801248,%r12
+  8018a5:	00 00 00 
+  8018a8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b0:	4c 89 f6             	mov    %r14,%rsi
+  8018b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b8:	41 ff d4             	call   *%r12
+    return res;
+  8018bb:	eb c3                	jmp    801880 <dup+0xe6>
+
+00000000008018bd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018bd:	55                   	push   %rbp
+  8018be:	48 89 e5             	mov    %rsp,%rbp
+  8018c1:	41 56                	push   %r14
+  8018c3:	41 55                	push   %r13
+  8018c5:	41 54                	push   %r12
+  8018c7:	53                   	push   %rbx
+  8018c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018cc:	89 fb                	mov    %edi,%ebx
+  8018ce:	49 89 f4             	mov    %rsi,%r12
+  8018d1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018d4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018d8:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  8018df:	00 00 00 
+  8018e2:	ff d0                	call   *%rax
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 4c                	js     801934 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018e8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018ec:	41 8b 3e             	mov    (%r14),%edi
+  8018ef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018f3:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  8018fa:	00 00 00 
+  8018fd:	ff d0                	call   *%rax
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 35                	js     801938 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801903:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801907:	83 e0 03             	and    $0x3,%eax
+  80190a:	83 f8 01             	cmp    $0x1,%eax
+  80190d:	74 2d                	je     80193c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80190f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801913:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801917:	48 85 c0             	test   %rax,%rax
+  80191a:	74 56                	je     801972 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80191c:	4c 89 ea             	mov    %r13,%rdx
+  80191f:	4c 89 e6             	mov    %r12,%rsi
+  801922:	4c 89 f7             	mov    %r14,%rdi
+  801925:	ff d0                	call   *%rax
+}
+  801927:	48 83 c4 10          	add    $0x10,%rsp
+  80192b:	5b                   	pop    %rbx
+  80192c:	41 5c                	pop    %r12
+  80192e:	41 5d                	pop    %r13
+  801930:	41 5e                	pop    %r14
+  801932:	5d                   	pop    %rbp
+  801933:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801934:	48 98                	cltq
+  801936:	eb ef                	jmp    801927 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801938:	48 98                	cltq
+  80193a:	eb eb                	jmp    801927 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80193c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801943:	00 00 00 
+  801946:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80194c:	89 da                	mov    %ebx,%edx
+  80194e:	48 bf 79 3c 80 00 00 	movabs $0x803c79,%rdi
+  801955:	00 00 00 
+  801958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195d:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801964:	00 00 00 
+  801967:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801969:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801970:	eb b5                	jmp    801927 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801972:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801979:	eb ac                	jmp    801927 <read+0x6a>
+
+000000000080197b <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+  80197f:	41 56                	push   %r14
+  801981:	41 55                	push   %r13
+  801983:	41 54                	push   %r12
+  801985:	53                   	push   %rbx
+  801986:	48 83 ec 10          	sub    $0x10,%rsp
+  80198a:	89 fb                	mov    %edi,%ebx
+  80198c:	49 89 f4             	mov    %rsi,%r12
+  80198f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801992:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801996:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	78 41                	js     8019e7 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019a6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019aa:	41 8b 3e             	mov    (%r14),%edi
+  8019ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019b1:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 35                	js     8019f6 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019c5:	83 e0 03             	and    $0x3,%eax
+  8019c8:	83 f8 01             	cmp    $0x1,%eax
+  8019cb:	74 2d                	je     8019fa <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019d1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019d5:	48 85 c0             	test   %rax,%rax
+  8019d8:	74 56                	je     801a30 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019da:	4c 89 ea             	mov    %r13,%rdx
+  8019dd:	4c 89 e6             	mov    %r12,%rsi
+  8019e0:	4c 89 f7             	mov    %r14,%rdi
+  8019e3:	ff d0                	call   *%rax
+  8019e5:	eb 02                	jmp    8019e9 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019e7:	48 98                	cltq
+}
+  8019e9:	48 83 c4 10          	add    $0x10,%rsp
+  8019ed:	5b                   	pop    %rbx
+  8019ee:	41 5c                	pop    %r12
+  8019f0:	41 5d                	pop    %r13
+  8019f2:	41 5e                	pop    %r14
+  8019f4:	5d                   	pop    %rbp
+  8019f5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019f6:	48 98                	cltq
+  8019f8:	eb ef                	jmp    8019e9 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019fa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a01:	00 00 00 
+  801a04:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a0a:	89 da                	mov    %ebx,%edx
+  801a0c:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  801a13:	00 00 00 
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1b:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801a22:	00 00 00 
+  801a25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a27:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a2e:	eb b9                	jmp    8019e9 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a30:	4c 89 ea             	mov    %r13,%rdx
+  801a33:	4c 89 e6             	mov    %r12,%rsi
+  801a36:	89 df                	mov    %ebx,%edi
+  801a38:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  801a3f:	00 00 00 
+  801a42:	ff d0                	call   *%rax
+  801a44:	eb a3                	jmp    8019e9 <readmap+0x6e>
+
+0000000000801a46 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a46:	55                   	push   %rbp
+  801a47:	48 89 e5             	mov    %rsp,%rbp
+  801a4a:	41 57                	push   %r15
+  801a4c:	41 56                	push   %r14
+  801a4e:	41 55                	push   %r13
+  801a50:	41 54                	push   %r12
+  801a52:	53                   	push   %rbx
+  801a53:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a57:	48 85 d2             	test   %rdx,%rdx
+  801a5a:	74 54                	je     801ab0 <readn+0x6a>
+  801a5c:	41 89 fd             	mov    %edi,%r13d
+  801a5f:	49 89 f6             	mov    %rsi,%r14
+  801a62:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a65:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a6a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a6f:	49 bf bd 18 80 00 00 	movabs $0x8018bd,%r15
+  801a76:	00 00 00 
+  801a79:	4c 89 e2             	mov    %r12,%rdx
+  801a7c:	48 29 f2             	sub    %rsi,%rdx
+  801a7f:	4c 01 f6             	add    %r14,%rsi
+  801a82:	44 89 ef             	mov    %r13d,%edi
+  801a85:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 20                	js     801aac <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a8c:	01 c3                	add    %eax,%ebx
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	74 08                	je     801a9a <readn+0x54>
+  801a92:	48 63 f3             	movslq %ebx,%rsi
+  801a95:	4c 39 e6             	cmp    %r12,%rsi
+  801a98:	72 df                	jb     801a79 <readn+0x33>
+    }
+    return res;
+  801a9a:	48 63 c3             	movslq %ebx,%rax
+}
+  801a9d:	48 83 c4 08          	add    $0x8,%rsp
+  801aa1:	5b                   	pop    %rbx
+  801aa2:	41 5c                	pop    %r12
+  801aa4:	41 5d                	pop    %r13
+  801aa6:	41 5e                	pop    %r14
+  801aa8:	41 5f                	pop    %r15
+  801aaa:	5d                   	pop    %rbp
+  801aab:	c3                   	ret
+        if (inc < 0) return inc;
+  801aac:	48 98                	cltq
+  801aae:	eb ed                	jmp    801a9d <readn+0x57>
+    int inc = 1, res = 0;
+  801ab0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab5:	eb e3                	jmp    801a9a <readn+0x54>
+
+0000000000801ab7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ab7:	55                   	push   %rbp
+  801ab8:	48 89 e5             	mov    %rsp,%rbp
+  801abb:	41 56                	push   %r14
+  801abd:	41 55                	push   %r13
+  801abf:	41 54                	push   %r12
+  801ac1:	53                   	push   %rbx
+  801ac2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ac6:	89 fb                	mov    %edi,%ebx
+  801ac8:	49 89 f4             	mov    %rsi,%r12
+  801acb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ace:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad2:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  801ad9:	00 00 00 
+  801adc:	ff d0                	call   *%rax
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	78 47                	js     801b29 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ae6:	41 8b 3e             	mov    (%r14),%edi
+  801ae9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aed:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801af4:	00 00 00 
+  801af7:	ff d0                	call   *%rax
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 30                	js     801b2d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801afd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b02:	74 2d                	je     801b31 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b08:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b0c:	48 85 c0             	test   %rax,%rax
+  801b0f:	74 56                	je     801b67 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b11:	4c 89 ea             	mov    %r13,%rdx
+  801b14:	4c 89 e6             	mov    %r12,%rsi
+  801b17:	4c 89 f7             	mov    %r14,%rdi
+  801b1a:	ff d0                	call   *%rax
+}
+  801b1c:	48 83 c4 10          	add    $0x10,%rsp
+  801b20:	5b                   	pop    %rbx
+  801b21:	41 5c                	pop    %r12
+  801b23:	41 5d                	pop    %r13
+  801b25:	41 5e                	pop    %r14
+  801b27:	5d                   	pop    %rbp
+  801b28:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b29:	48 98                	cltq
+  801b2b:	eb ef                	jmp    801b1c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b2d:	48 98                	cltq
+  801b2f:	eb eb                	jmp    801b1c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b31:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b38:	00 00 00 
+  801b3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b41:	89 da                	mov    %ebx,%edx
+  801b43:	48 bf 95 3c 80 00 00 	movabs $0x803c95,%rdi
+  801b4a:	00 00 00 
+  801b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b52:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801b59:	00 00 00 
+  801b5c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b5e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b65:	eb b5                	jmp    801b1c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b67:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b6e:	eb ac                	jmp    801b1c <write+0x65>
+
+0000000000801b70 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b70:	55                   	push   %rbp
+  801b71:	48 89 e5             	mov    %rsp,%rbp
+  801b74:	53                   	push   %rbx
+  801b75:	48 83 ec 18          	sub    $0x18,%rsp
+  801b79:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b7b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b7f:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  801b86:	00 00 00 
+  801b89:	ff d0                	call   *%rax
+  801b8b:	85 c0                	test   %eax,%eax
+  801b8d:	78 0c                	js     801b9b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b93:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801b96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+0000000000801ba1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ba1:	55                   	push   %rbp
+  801ba2:	48 89 e5             	mov    %rsp,%rbp
+  801ba5:	41 55                	push   %r13
+  801ba7:	41 54                	push   %r12
+  801ba9:	53                   	push   %rbx
+  801baa:	48 83 ec 18          	sub    $0x18,%rsp
+  801bae:	89 fb                	mov    %edi,%ebx
+  801bb0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb7:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 38                	js     801bff <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bc7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bcb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bcf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd3:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 1c                	js     801bff <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801be8:	74 20                	je     801c0a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bee:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bf2:	48 85 c0             	test   %rax,%rax
+  801bf5:	74 47                	je     801c3e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801bf7:	44 89 e6             	mov    %r12d,%esi
+  801bfa:	4c 89 ef             	mov    %r13,%rdi
+  801bfd:	ff d0                	call   *%rax
+}
+  801bff:	48 83 c4 18          	add    $0x18,%rsp
+  801c03:	5b                   	pop    %rbx
+  801c04:	41 5c                	pop    %r12
+  801c06:	41 5d                	pop    %r13
+  801c08:	5d                   	pop    %rbp
+  801c09:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c0a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c11:	00 00 00 
+  801c14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c1a:	89 da                	mov    %ebx,%edx
+  801c1c:	48 bf 58 3c 80 00 00 	movabs $0x803c58,%rdi
+  801c23:	00 00 00 
+  801c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2b:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801c32:	00 00 00 
+  801c35:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3c:	eb c1                	jmp    801bff <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c3e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c43:	eb ba                	jmp    801bff <ftruncate+0x5e>
+
+0000000000801c45 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c45:	55                   	push   %rbp
+  801c46:	48 89 e5             	mov    %rsp,%rbp
+  801c49:	41 54                	push   %r12
+  801c4b:	53                   	push   %rbx
+  801c4c:	48 83 ec 10          	sub    $0x10,%rsp
+  801c50:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c57:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 4e                	js     801cb5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c67:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c6b:	41 8b 3c 24          	mov    (%r12),%edi
+  801c6f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c73:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	78 32                	js     801cb5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c87:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801c8c:	74 30                	je     801cbe <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c8e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c91:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c98:	00 00 00 
+    stat->st_isdir = 0;
+  801c9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ca2:	00 00 00 
+    stat->st_dev = dev;
+  801ca5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cac:	48 89 de             	mov    %rbx,%rsi
+  801caf:	4c 89 e7             	mov    %r12,%rdi
+  801cb2:	ff 50 30             	call   *0x30(%rax)
+}
+  801cb5:	48 83 c4 10          	add    $0x10,%rsp
+  801cb9:	5b                   	pop    %rbx
+  801cba:	41 5c                	pop    %r12
+  801cbc:	5d                   	pop    %rbp
+  801cbd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cbe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cc3:	eb f0                	jmp    801cb5 <fstat+0x70>
+
+0000000000801cc5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cc5:	55                   	push   %rbp
+  801cc6:	48 89 e5             	mov    %rsp,%rbp
+  801cc9:	41 54                	push   %r12
+  801ccb:	53                   	push   %rbx
+  801ccc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd4:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+  801ce0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 25                	js     801d0b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ce6:	4c 89 e6             	mov    %r12,%rsi
+  801ce9:	89 c7                	mov    %eax,%edi
+  801ceb:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801cfa:	89 df                	mov    %ebx,%edi
+  801cfc:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  801d03:	00 00 00 
+  801d06:	ff d0                	call   *%rax
+
+    return res;
+  801d08:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d0b:	89 d8                	mov    %ebx,%eax
+  801d0d:	5b                   	pop    %rbx
+  801d0e:	41 5c                	pop    %r12
+  801d10:	5d                   	pop    %rbp
+  801d11:	c3                   	ret
+
+0000000000801d12 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d12:	55                   	push   %rbp
+  801d13:	48 89 e5             	mov    %rsp,%rbp
+  801d16:	41 54                	push   %r12
+  801d18:	53                   	push   %rbx
+  801d19:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1d:	48 89 fb             	mov    %rdi,%rbx
+  801d20:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d23:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d27:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d2c:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 1f                	js     801d5b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d40:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d44:	48 85 c0             	test   %rax,%rax
+  801d47:	74 1b                	je     801d64 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d49:	4c 89 e6             	mov    %r12,%rsi
+  801d4c:	48 89 df             	mov    %rbx,%rdi
+  801d4f:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d58:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d5b:	48 83 c4 10          	add    $0x10,%rsp
+  801d5f:	5b                   	pop    %rbx
+  801d60:	41 5c                	pop    %r12
+  801d62:	5d                   	pop    %rbp
+  801d63:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d64:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d69:	eb f0                	jmp    801d5b <create_snapshot+0x49>
+
+0000000000801d6b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d6b:	55                   	push   %rbp
+  801d6c:	48 89 e5             	mov    %rsp,%rbp
+  801d6f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d73:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d77:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d7c:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801d83:	00 00 00 
+  801d86:	ff d0                	call   *%rax
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	78 1e                	js     801daa <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d90:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801d94:	48 85 d2             	test   %rdx,%rdx
+  801d97:	74 13                	je     801dac <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9e:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801daa:	c9                   	leave
+  801dab:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dac:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801db1:	eb f7                	jmp    801daa <print_snapshot_list+0x3f>
+
+0000000000801db3 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801db3:	55                   	push   %rbp
+  801db4:	48 89 e5             	mov    %rsp,%rbp
+  801db7:	53                   	push   %rbx
+  801db8:	48 83 ec 18          	sub    $0x18,%rsp
+  801dbc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc3:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dc8:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801dcf:	00 00 00 
+  801dd2:	ff d0                	call   *%rax
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 1c                	js     801df4 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ddc:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801de0:	48 85 c0             	test   %rax,%rax
+  801de3:	74 15                	je     801dfa <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801de5:	48 89 df             	mov    %rbx,%rdi
+  801de8:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dea:	85 c0                	test   %eax,%eax
+  801dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801df4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dfa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dff:	eb f3                	jmp    801df4 <accept_snapshot+0x41>
+
+0000000000801e01 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e01:	55                   	push   %rbp
+  801e02:	48 89 e5             	mov    %rsp,%rbp
+  801e05:	53                   	push   %rbx
+  801e06:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e11:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e16:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	78 1c                	js     801e42 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e2a:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e2e:	48 85 c0             	test   %rax,%rax
+  801e31:	74 15                	je     801e48 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e33:	48 89 df             	mov    %rbx,%rdi
+  801e36:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e4d:	eb f3                	jmp    801e42 <delete_snapshot+0x41>
+
+0000000000801e4f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+  801e53:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e5b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e60:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 14                	js     801e84 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e74:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e78:	48 85 d2             	test   %rdx,%rdx
+  801e7b:	74 09                	je     801e86 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e82:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e8b:	eb f7                	jmp    801e84 <gc_snapshots+0x35>
+
+0000000000801e8d <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801e8d:	55                   	push   %rbp
+  801e8e:	48 89 e5             	mov    %rsp,%rbp
+  801e91:	41 56                	push   %r14
+  801e93:	41 55                	push   %r13
+  801e95:	41 54                	push   %r12
+  801e97:	53                   	push   %rbx
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	48 89 fb             	mov    %rdi,%rbx
+  801e9f:	49 89 f4             	mov    %rsi,%r12
+  801ea2:	49 89 d5             	mov    %rdx,%r13
+  801ea5:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ea8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eac:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eb1:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 1b                	js     801edc <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ec5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801ec9:	48 85 c0             	test   %rax,%rax
+  801ecc:	74 1b                	je     801ee9 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ece:	4c 89 f1             	mov    %r14,%rcx
+  801ed1:	4c 89 ea             	mov    %r13,%rdx
+  801ed4:	4c 89 e6             	mov    %r12,%rsi
+  801ed7:	48 89 df             	mov    %rbx,%rdi
+  801eda:	ff d0                	call   *%rax
+
+    return res;
+}
+  801edc:	48 83 c4 10          	add    $0x10,%rsp
+  801ee0:	5b                   	pop    %rbx
+  801ee1:	41 5c                	pop    %r12
+  801ee3:	41 5d                	pop    %r13
+  801ee5:	41 5e                	pop    %r14
+  801ee7:	5d                   	pop    %rbp
+  801ee8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ee9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eee:	eb ec                	jmp    801edc <diff_snapshots+0x4f>
+
+0000000000801ef0 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801ef0:	55                   	push   %rbp
+  801ef1:	48 89 e5             	mov    %rsp,%rbp
+  801ef4:	41 55                	push   %r13
+  801ef6:	41 54                	push   %r12
+  801ef8:	53                   	push   %rbx
+  801ef9:	48 83 ec 18          	sub    $0x18,%rsp
+  801efd:	48 89 fb             	mov    %rdi,%rbx
+  801f00:	49 89 f4             	mov    %rsi,%r12
+  801f03:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f06:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f0a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f0f:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801f16:	00 00 00 
+  801f19:	ff d0                	call   *%rax
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	78 18                	js     801f37 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f23:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f27:	48 85 c0             	test   %rax,%rax
+  801f2a:	74 16                	je     801f42 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f2c:	4c 89 ea             	mov    %r13,%rdx
+  801f2f:	4c 89 e6             	mov    %r12,%rsi
+  801f32:	48 89 df             	mov    %rbx,%rdi
+  801f35:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f37:	48 83 c4 18          	add    $0x18,%rsp
+  801f3b:	5b                   	pop    %rbx
+  801f3c:	41 5c                	pop    %r12
+  801f3e:	41 5d                	pop    %r13
+  801f40:	5d                   	pop    %rbp
+  801f41:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f47:	eb ee                	jmp    801f37 <send_snapshot+0x47>
+
+0000000000801f49 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	53                   	push   %rbx
+  801f4e:	48 83 ec 18          	sub    $0x18,%rsp
+  801f52:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f59:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f5e:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801f65:	00 00 00 
+  801f68:	ff d0                	call   *%rax
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	78 12                	js     801f80 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f72:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f76:	48 85 c0             	test   %rax,%rax
+  801f79:	74 0b                	je     801f86 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f7b:	48 89 df             	mov    %rbx,%rdi
+  801f7e:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f8b:	eb f3                	jmp    801f80 <receive_snapshot+0x37>
+
+0000000000801f8d <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f99:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f9e:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 17                	js     801fc5 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb2:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fb9:	48 85 d2             	test   %rdx,%rdx
+  801fbc:	74 09                	je     801fc7 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc3:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fc7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fcc:	eb f7                	jmp    801fc5 <free_space_bytes+0x38>
+
+0000000000801fce <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801fce:	55                   	push   %rbp
+  801fcf:	48 89 e5             	mov    %rsp,%rbp
+  801fd2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fd6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fda:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fdf:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	78 17                	js     802006 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801fef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff3:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801ffa:	48 85 d2             	test   %rdx,%rdx
+  801ffd:	74 09                	je     802008 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802004:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+        return -E_NOT_SUPP;
+  802008:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80200d:	eb f7                	jmp    802006 <busy_space_bytes+0x38>
+
+000000000080200f <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80200f:	55                   	push   %rbp
+  802010:	48 89 e5             	mov    %rsp,%rbp
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	48 83 ec 10          	sub    $0x10,%rsp
+  80201a:	89 fb                	mov    %edi,%ebx
+  80201c:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80201f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802023:	bf 66 00 00 00       	mov    $0x66,%edi
+  802028:	48 b8 25 16 80 00 00 	movabs $0x801625,%rax
+  80202f:	00 00 00 
+  802032:	ff d0                	call   *%rax
+  802034:	85 c0                	test   %eax,%eax
+  802036:	78 17                	js     80204f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80203c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802043:	48 85 c0             	test   %rax,%rax
+  802046:	74 10                	je     802058 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802048:	4c 89 e6             	mov    %r12,%rsi
+  80204b:	89 df                	mov    %ebx,%edi
+  80204d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80204f:	48 83 c4 10          	add    $0x10,%rsp
+  802053:	5b                   	pop    %rbx
+  802054:	41 5c                	pop    %r12
+  802056:	5d                   	pop    %rbp
+  802057:	c3                   	ret
+        return -E_NOT_SUPP;
+  802058:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80205d:	eb f0                	jmp    80204f <snapshots_space+0x40>
+
+000000000080205f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80205f:	55                   	push   %rbp
+  802060:	48 89 e5             	mov    %rsp,%rbp
+  802063:	41 55                	push   %r13
+  802065:	41 54                	push   %r12
+  802067:	53                   	push   %rbx
+  802068:	48 83 ec 08          	sub    $0x8,%rsp
+  80206c:	41 89 fd             	mov    %edi,%r13d
+  80206f:	48 89 f3             	mov    %rsi,%rbx
+  802072:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802075:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80207c:	00 00 00 
+  80207f:	83 38 00             	cmpl   $0x0,(%rax)
+  802082:	74 57                	je     8020db <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802084:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80208a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80208f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802096:	00 00 00 
+  802099:	44 89 ee             	mov    %r13d,%esi
+  80209c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a3:	00 00 00 
+  8020a6:	8b 38                	mov    (%rax),%edi
+  8020a8:	48 b8 7f 35 80 00 00 	movabs $0x80357f,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b9:	4c 89 e2             	mov    %r12,%rdx
+  8020bc:	48 89 de             	mov    %rbx,%rsi
+  8020bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c4:	48 b8 67 35 80 00 00 	movabs $0x803567,%rax
+  8020cb:	00 00 00 
+  8020ce:	ff d0                	call   *%rax
+}
+  8020d0:	48 83 c4 08          	add    $0x8,%rsp
+  8020d4:	5b                   	pop    %rbx
+  8020d5:	41 5c                	pop    %r12
+  8020d7:	41 5d                	pop    %r13
+  8020d9:	5d                   	pop    %rbp
+  8020da:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020e0:	48 b8 3d 36 80 00 00 	movabs $0x80363d,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020f3:	00 00 
+  8020f5:	eb 8d                	jmp    802084 <fsipc_region+0x25>
+
+00000000008020f7 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020f7:	55                   	push   %rbp
+  8020f8:	48 89 e5             	mov    %rsp,%rbp
+  8020fb:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8020ff:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802106:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802107:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80210b:	48 b8 5f 20 80 00 00 	movabs $0x80205f,%rax
+  802112:	00 00 00 
+  802115:	ff d0                	call   *%rax
+}
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+0000000000802119 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802119:	85 ff                	test   %edi,%edi
+  80211b:	78 6d                	js     80218a <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80211d:	55                   	push   %rbp
+  80211e:	48 89 e5             	mov    %rsp,%rbp
+  802121:	41 54                	push   %r12
+  802123:	53                   	push   %rbx
+  802124:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802127:	48 85 f6             	test   %rsi,%rsi
+  80212a:	74 57                	je     802183 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80212c:	89 f8                	mov    %edi,%eax
+  80212e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802135:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802137:	be 00 00 00 00       	mov    $0x0,%esi
+  80213c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802141:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 2d                	js     80217e <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802151:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802158:	00 00 00 
+  80215b:	49 63 14 24          	movslq (%r12),%rdx
+  80215f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802166:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80216b:	48 89 df             	mov    %rbx,%rdi
+  80216e:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80217a:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80217e:	5b                   	pop    %rbx
+  80217f:	41 5c                	pop    %r12
+  802181:	5d                   	pop    %rbp
+  802182:	c3                   	ret
+        return -E_INVAL;
+  802183:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802188:	eb f4                	jmp    80217e <devfile_df_snapshots+0x65>
+  80218a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80218f:	c3                   	ret
+
+0000000000802190 <devfile_df_busy>:
+devfile_df_busy() {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802194:	be 00 00 00 00       	mov    $0x0,%esi
+  802199:	bf 11 00 00 00       	mov    $0x11,%edi
+  80219e:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+}
+  8021aa:	5d                   	pop    %rbp
+  8021ab:	c3                   	ret
+
+00000000008021ac <devfile_df_free>:
+devfile_df_free() {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021ba:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8021c1:	00 00 00 
+  8021c4:	ff d0                	call   *%rax
+}
+  8021c6:	5d                   	pop    %rbp
+  8021c7:	c3                   	ret
+
+00000000008021c8 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021c8:	55                   	push   %rbp
+  8021c9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021d6:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+}
+  8021e2:	5d                   	pop    %rbp
+  8021e3:	c3                   	ret
+
+00000000008021e4 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8021e4:	55                   	push   %rbp
+  8021e5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8021e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ed:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021f2:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	ba 00 00 00 00       	mov    $0x0,%edx
+  802205:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802208:	5d                   	pop    %rbp
+  802209:	c3                   	ret
+
+000000000080220a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80220a:	55                   	push   %rbp
+  80220b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80220e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802215:	00 00 00 
+  802218:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80221b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80221d:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802220:	be 00 00 00 00       	mov    $0x0,%esi
+  802225:	bf 02 00 00 00       	mov    $0x2,%edi
+  80222a:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+}
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+
+0000000000802238 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80223c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80223f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802246:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802248:	be 00 00 00 00       	mov    $0x0,%esi
+  80224d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802252:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+}
+  80225e:	5d                   	pop    %rbp
+  80225f:	c3                   	ret
+
+0000000000802260 <devfile_write>:
+    if (!fd || !buf) {
+  802260:	48 85 ff             	test   %rdi,%rdi
+  802263:	0f 84 c1 00 00 00    	je     80232a <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	41 57                	push   %r15
+  80226f:	41 56                	push   %r14
+  802271:	41 55                	push   %r13
+  802273:	41 54                	push   %r12
+  802275:	53                   	push   %rbx
+  802276:	48 83 ec 18          	sub    $0x18,%rsp
+  80227a:	49 89 ff             	mov    %rdi,%r15
+  80227d:	49 89 f5             	mov    %rsi,%r13
+  802280:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802283:	48 85 f6             	test   %rsi,%rsi
+  802286:	0f 84 95 00 00 00    	je     802321 <devfile_write+0xc1>
+    while (n) {
+  80228c:	48 85 d2             	test   %rdx,%rdx
+  80228f:	0f 84 83 00 00 00    	je     802318 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802295:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80229c:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022a3:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022a6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022ab:	49 39 dc             	cmp    %rbx,%r12
+  8022ae:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022b2:	48 89 da             	mov    %rbx,%rdx
+  8022b5:	4c 89 ee             	mov    %r13,%rsi
+  8022b8:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022bf:	00 00 00 
+  8022c2:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022d2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022d5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e3:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+        if (write < 0) {
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 21                	js     802314 <devfile_write+0xb4>
+        buf += write;
+  8022f3:	48 63 d0             	movslq %eax,%rdx
+  8022f6:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8022f9:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8022fc:	49 29 d4             	sub    %rdx,%r12
+  8022ff:	75 a5                	jne    8022a6 <devfile_write+0x46>
+    return totalWrite;
+  802301:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802305:	48 83 c4 18          	add    $0x18,%rsp
+  802309:	5b                   	pop    %rbx
+  80230a:	41 5c                	pop    %r12
+  80230c:	41 5d                	pop    %r13
+  80230e:	41 5e                	pop    %r14
+  802310:	41 5f                	pop    %r15
+  802312:	5d                   	pop    %rbp
+  802313:	c3                   	ret
+            return write;
+  802314:	48 98                	cltq
+  802316:	eb ed                	jmp    802305 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802318:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80231f:	eb e0                	jmp    802301 <devfile_write+0xa1>
+        return -E_INVAL;
+  802321:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802328:	eb db                	jmp    802305 <devfile_write+0xa5>
+  80232a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802331:	c3                   	ret
+
+0000000000802332 <devfile_read>:
+    if (!fd || !buf) {
+  802332:	48 85 ff             	test   %rdi,%rdi
+  802335:	0f 84 c0 00 00 00    	je     8023fb <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  80233f:	41 57                	push   %r15
+  802341:	41 56                	push   %r14
+  802343:	41 55                	push   %r13
+  802345:	41 54                	push   %r12
+  802347:	53                   	push   %rbx
+  802348:	48 83 ec 18          	sub    $0x18,%rsp
+  80234c:	49 89 ff             	mov    %rdi,%r15
+  80234f:	49 89 f5             	mov    %rsi,%r13
+  802352:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802355:	48 85 f6             	test   %rsi,%rsi
+  802358:	0f 84 96 00 00 00    	je     8023f4 <devfile_read+0xc2>
+    while (n) {
+  80235e:	48 85 d2             	test   %rdx,%rdx
+  802361:	0f 84 87 00 00 00    	je     8023ee <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802367:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80236e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80236f:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802376:	00 00 00 
+  802379:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80237d:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802380:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802385:	49 39 c4             	cmp    %rax,%r12
+  802388:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80238c:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802390:	be 00 00 00 00       	mov    $0x0,%esi
+  802395:	bf 03 00 00 00       	mov    $0x3,%edi
+  80239a:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	7e 37                	jle    8023e1 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023aa:	48 63 d8             	movslq %eax,%rbx
+  8023ad:	48 89 da             	mov    %rbx,%rdx
+  8023b0:	4c 89 f6             	mov    %r14,%rsi
+  8023b3:	4c 89 ef             	mov    %r13,%rdi
+  8023b6:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  8023bd:	00 00 00 
+  8023c0:	ff d0                	call   *%rax
+        buf += read;
+  8023c2:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023c5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023c9:	49 29 dc             	sub    %rbx,%r12
+  8023cc:	75 ab                	jne    802379 <devfile_read+0x47>
+  return totalRead;
+  8023ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023d2:	48 83 c4 18          	add    $0x18,%rsp
+  8023d6:	5b                   	pop    %rbx
+  8023d7:	41 5c                	pop    %r12
+  8023d9:	41 5d                	pop    %r13
+  8023db:	41 5e                	pop    %r14
+  8023dd:	41 5f                	pop    %r15
+  8023df:	5d                   	pop    %rbp
+  8023e0:	c3                   	ret
+            return read ? read : totalRead;
+  8023e1:	48 63 d0             	movslq %eax,%rdx
+  8023e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023e8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8023ec:	eb e4                	jmp    8023d2 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8023ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8023f2:	eb da                	jmp    8023ce <devfile_read+0x9c>
+        return E_INVAL;
+  8023f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023f9:	eb d7                	jmp    8023d2 <devfile_read+0xa0>
+  8023fb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802400:	c3                   	ret
+
+0000000000802401 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802401:	48 85 ff             	test   %rdi,%rdi
+  802404:	74 5f                	je     802465 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802406:	55                   	push   %rbp
+  802407:	48 89 e5             	mov    %rsp,%rbp
+  80240a:	53                   	push   %rbx
+  80240b:	48 83 ec 08          	sub    $0x8,%rsp
+  80240f:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802412:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  802419:	00 00 00 
+  80241c:	ff d0                	call   *%rax
+  80241e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802424:	77 45                	ja     80246b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802426:	48 89 de             	mov    %rbx,%rsi
+  802429:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802430:	00 00 00 
+  802433:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80243f:	be 00 00 00 00       	mov    $0x0,%esi
+  802444:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802449:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802455:	85 c0                	test   %eax,%eax
+  802457:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80245f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802463:	c9                   	leave
+  802464:	c3                   	ret
+        return -E_INVAL;
+  802465:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80246a:	c3                   	ret
+        return -E_INVAL;
+  80246b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802470:	eb ed                	jmp    80245f <devfile_receive_snapshot+0x5e>
+
+0000000000802472 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802472:	55                   	push   %rbp
+  802473:	48 89 e5             	mov    %rsp,%rbp
+  802476:	41 55                	push   %r13
+  802478:	41 54                	push   %r12
+  80247a:	53                   	push   %rbx
+  80247b:	48 83 ec 08          	sub    $0x8,%rsp
+  80247f:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802482:	48 85 f6             	test   %rsi,%rsi
+  802485:	0f 94 c0             	sete   %al
+  802488:	48 85 d2             	test   %rdx,%rdx
+  80248b:	0f 94 c2             	sete   %dl
+  80248e:	08 d0                	or     %dl,%al
+  802490:	0f 85 ad 00 00 00    	jne    802543 <devfile_send_snapshot+0xd1>
+  802496:	48 89 fb             	mov    %rdi,%rbx
+  802499:	49 89 f4             	mov    %rsi,%r12
+  80249c:	48 85 ff             	test   %rdi,%rdi
+  80249f:	0f 84 9e 00 00 00    	je     802543 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024a5:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+  8024b1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024b7:	0f 87 8d 00 00 00    	ja     80254a <devfile_send_snapshot+0xd8>
+  8024bd:	4c 89 e7             	mov    %r12,%rdi
+  8024c0:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+  8024cc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024d2:	77 7d                	ja     802551 <devfile_send_snapshot+0xdf>
+  8024d4:	4c 89 ef             	mov    %r13,%rdi
+  8024d7:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+  8024e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024e9:	77 6d                	ja     802558 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8024eb:	48 89 de             	mov    %rbx,%rsi
+  8024ee:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024f5:	00 00 00 
+  8024f8:	48 bb f0 0a 80 00 00 	movabs $0x800af0,%rbx
+  8024ff:	00 00 00 
+  802502:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802504:	4c 89 e6             	mov    %r12,%rsi
+  802507:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80250e:	00 00 00 
+  802511:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802513:	4c 89 ee             	mov    %r13,%rsi
+  802516:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80251d:	00 00 00 
+  802520:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802522:	be 00 00 00 00       	mov    $0x0,%esi
+  802527:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80252c:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802533:	00 00 00 
+  802536:	ff d0                	call   *%rax
+}
+  802538:	48 83 c4 08          	add    $0x8,%rsp
+  80253c:	5b                   	pop    %rbx
+  80253d:	41 5c                	pop    %r12
+  80253f:	41 5d                	pop    %r13
+  802541:	5d                   	pop    %rbp
+  802542:	c3                   	ret
+        return -E_INVAL;
+  802543:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802548:	eb ee                	jmp    802538 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80254a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254f:	eb e7                	jmp    802538 <devfile_send_snapshot+0xc6>
+  802551:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802556:	eb e0                	jmp    802538 <devfile_send_snapshot+0xc6>
+  802558:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255d:	eb d9                	jmp    802538 <devfile_send_snapshot+0xc6>
+
+000000000080255f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80255f:	48 85 ff             	test   %rdi,%rdi
+  802562:	0f 84 41 01 00 00    	je     8026a9 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802568:	55                   	push   %rbp
+  802569:	48 89 e5             	mov    %rsp,%rbp
+  80256c:	41 57                	push   %r15
+  80256e:	41 56                	push   %r14
+  802570:	41 55                	push   %r13
+  802572:	41 54                	push   %r12
+  802574:	53                   	push   %rbx
+  802575:	48 83 ec 08          	sub    $0x8,%rsp
+  802579:	49 89 fc             	mov    %rdi,%r12
+  80257c:	49 89 f5             	mov    %rsi,%r13
+  80257f:	48 89 d3             	mov    %rdx,%rbx
+  802582:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802585:	48 85 f6             	test   %rsi,%rsi
+  802588:	0f 84 ff 00 00 00    	je     80268d <devfile_diff_snapshots+0x12e>
+  80258e:	48 85 d2             	test   %rdx,%rdx
+  802591:	0f 84 fd 00 00 00    	je     802694 <devfile_diff_snapshots+0x135>
+  802597:	48 85 c9             	test   %rcx,%rcx
+  80259a:	0f 84 f4 00 00 00    	je     802694 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8025a0:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8025a7:	00 00 00 
+  8025aa:	ff d0                	call   *%rax
+  8025ac:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025b2:	0f 87 e3 00 00 00    	ja     80269b <devfile_diff_snapshots+0x13c>
+  8025b8:	4c 89 ef             	mov    %r13,%rdi
+  8025bb:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+  8025c7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025cd:	0f 87 cf 00 00 00    	ja     8026a2 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025d3:	4c 89 e6             	mov    %r12,%rsi
+  8025d6:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8025dd:	00 00 00 
+  8025e0:	4c 89 e7             	mov    %r12,%rdi
+  8025e3:	49 bf f0 0a 80 00 00 	movabs $0x800af0,%r15
+  8025ea:	00 00 00 
+  8025ed:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8025f0:	4c 89 ee             	mov    %r13,%rsi
+  8025f3:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8025fa:	00 
+  8025fb:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8025fe:	48 8b 03             	mov    (%rbx),%rax
+  802601:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802608:	00 
+  802609:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80260d:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802614:	00 
+  802615:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802619:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802620:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802621:	be 00 00 00 00       	mov    $0x0,%esi
+  802626:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80262b:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 43                	js     80267e <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80263b:	49 8b 04 24          	mov    (%r12),%rax
+  80263f:	48 89 03             	mov    %rax,(%rbx)
+  802642:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802647:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80264b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802650:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802654:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802659:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80265d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802661:	48 c1 e2 03          	shl    $0x3,%rdx
+  802665:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80266a:	4c 89 f7             	mov    %r14,%rdi
+  80266d:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802679:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80267e:	48 83 c4 08          	add    $0x8,%rsp
+  802682:	5b                   	pop    %rbx
+  802683:	41 5c                	pop    %r12
+  802685:	41 5d                	pop    %r13
+  802687:	41 5e                	pop    %r14
+  802689:	41 5f                	pop    %r15
+  80268b:	5d                   	pop    %rbp
+  80268c:	c3                   	ret
+        return -E_INVAL;
+  80268d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802692:	eb ea                	jmp    80267e <devfile_diff_snapshots+0x11f>
+  802694:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802699:	eb e3                	jmp    80267e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80269b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a0:	eb dc                	jmp    80267e <devfile_diff_snapshots+0x11f>
+  8026a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a7:	eb d5                	jmp    80267e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026ae:	c3                   	ret
+
+00000000008026af <devfile_delete_snapshot>:
+    if (!name) {
+  8026af:	48 85 ff             	test   %rdi,%rdi
+  8026b2:	74 5f                	je     802713 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026b4:	55                   	push   %rbp
+  8026b5:	48 89 e5             	mov    %rsp,%rbp
+  8026b8:	53                   	push   %rbx
+  8026b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026bd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026c0:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026d2:	77 45                	ja     802719 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026d4:	48 89 de             	mov    %rbx,%rsi
+  8026d7:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026de:	00 00 00 
+  8026e1:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  8026e8:	00 00 00 
+  8026eb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8026ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026f7:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  8026fe:	00 00 00 
+  802701:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802703:	85 c0                	test   %eax,%eax
+  802705:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80270d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802711:	c9                   	leave
+  802712:	c3                   	ret
+        return -E_INVAL;
+  802713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802718:	c3                   	ret
+        return -E_INVAL;
+  802719:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80271e:	eb ed                	jmp    80270d <devfile_delete_snapshot+0x5e>
+
+0000000000802720 <devfile_accept_snapshot>:
+    if (!name) {
+  802720:	48 85 ff             	test   %rdi,%rdi
+  802723:	74 5f                	je     802784 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802725:	55                   	push   %rbp
+  802726:	48 89 e5             	mov    %rsp,%rbp
+  802729:	53                   	push   %rbx
+  80272a:	48 83 ec 08          	sub    $0x8,%rsp
+  80272e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802731:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  802738:	00 00 00 
+  80273b:	ff d0                	call   *%rax
+  80273d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802743:	77 45                	ja     80278a <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802745:	48 89 de             	mov    %rbx,%rsi
+  802748:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80274f:	00 00 00 
+  802752:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80275e:	be 00 00 00 00       	mov    $0x0,%esi
+  802763:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802768:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802774:	85 c0                	test   %eax,%eax
+  802776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80277b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80277e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802782:	c9                   	leave
+  802783:	c3                   	ret
+        return -E_INVAL;
+  802784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802789:	c3                   	ret
+        return -E_INVAL;
+  80278a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80278f:	eb ed                	jmp    80277e <devfile_accept_snapshot+0x5e>
+
+0000000000802791 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802791:	48 85 ff             	test   %rdi,%rdi
+  802794:	0f 84 9f 00 00 00    	je     802839 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	41 54                	push   %r12
+  8027a0:	53                   	push   %rbx
+  8027a1:	48 89 fb             	mov    %rdi,%rbx
+  8027a4:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027a7:	48 85 f6             	test   %rsi,%rsi
+  8027aa:	74 78                	je     802824 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027ac:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8027b3:	00 00 00 
+  8027b6:	ff d0                	call   *%rax
+  8027b8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027be:	77 6b                	ja     80282b <devfile_create_snapshot+0x9a>
+  8027c0:	4c 89 e7             	mov    %r12,%rdi
+  8027c3:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027d5:	77 5b                	ja     802832 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027d7:	48 89 de             	mov    %rbx,%rsi
+  8027da:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027e1:	00 00 00 
+  8027e4:	48 bb f0 0a 80 00 00 	movabs $0x800af0,%rbx
+  8027eb:	00 00 00 
+  8027ee:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8027f0:	4c 89 e6             	mov    %r12,%rsi
+  8027f3:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8027fa:	00 00 00 
+  8027fd:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8027ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802804:	bf 08 00 00 00       	mov    $0x8,%edi
+  802809:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802815:	85 c0                	test   %eax,%eax
+  802817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80281f:	5b                   	pop    %rbx
+  802820:	41 5c                	pop    %r12
+  802822:	5d                   	pop    %rbp
+  802823:	c3                   	ret
+        return -E_INVAL;
+  802824:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802829:	eb f4                	jmp    80281f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80282b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802830:	eb ed                	jmp    80281f <devfile_create_snapshot+0x8e>
+  802832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802837:	eb e6                	jmp    80281f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802839:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80283e:	c3                   	ret
+
+000000000080283f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80283f:	55                   	push   %rbp
+  802840:	48 89 e5             	mov    %rsp,%rbp
+  802843:	41 54                	push   %r12
+  802845:	53                   	push   %rbx
+  802846:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802849:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80284c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802853:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802855:	be 00 00 00 00       	mov    $0x0,%esi
+  80285a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80285f:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	78 3d                	js     8028ac <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80286f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802876:	00 00 00 
+  802879:	4c 89 e6             	mov    %r12,%rsi
+  80287c:	48 89 df             	mov    %rbx,%rdi
+  80287f:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  802886:	00 00 00 
+  802889:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80288b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802892:	00 
+  802893:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802899:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8028a0:	00 
+  8028a1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028ac:	5b                   	pop    %rbx
+  8028ad:	41 5c                	pop    %r12
+  8028af:	5d                   	pop    %rbp
+  8028b0:	c3                   	ret
+
+00000000008028b1 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028b1:	55                   	push   %rbp
+  8028b2:	48 89 e5             	mov    %rsp,%rbp
+  8028b5:	41 57                	push   %r15
+  8028b7:	41 56                	push   %r14
+  8028b9:	41 55                	push   %r13
+  8028bb:	41 54                	push   %r12
+  8028bd:	53                   	push   %rbx
+  8028be:	48 83 ec 38          	sub    $0x38,%rsp
+  8028c2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028c6:	49 89 f5             	mov    %rsi,%r13
+  8028c9:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028cc:	48 89 f0             	mov    %rsi,%rax
+  8028cf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028d4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028d8:	75 4f                	jne    802929 <devfile_readmap+0x78>
+  8028da:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028de:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028e4:	75 1f                	jne    802905 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8028e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028ea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8028ee:	49 be 99 30 80 00 00 	movabs $0x803099,%r14
+  8028f5:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028f8:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8028ff:	0f 87 9d 00 00 00    	ja     8029a2 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802905:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802909:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80290d:	4d 85 ff             	test   %r15,%r15
+  802910:	0f 85 cf 00 00 00    	jne    8029e5 <devfile_readmap+0x134>
+  802916:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80291a:	48 83 c4 38          	add    $0x38,%rsp
+  80291e:	5b                   	pop    %rbx
+  80291f:	41 5c                	pop    %r12
+  802921:	41 5d                	pop    %r13
+  802923:	41 5e                	pop    %r14
+  802925:	41 5f                	pop    %r15
+  802927:	5d                   	pop    %rbp
+  802928:	c3                   	ret
+    size_t totalRead = 0;
+  802929:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802930:	00 
+  802931:	eb da                	jmp    80290d <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802933:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802937:	8b 40 0c             	mov    0xc(%rax),%eax
+  80293a:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802941:	00 00 00 
+  802944:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802946:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  80294e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802952:	4c 89 ee             	mov    %r13,%rsi
+  802955:	bf 14 00 00 00       	mov    $0x14,%edi
+  80295a:	48 b8 5f 20 80 00 00 	movabs $0x80205f,%rax
+  802961:	00 00 00 
+  802964:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802966:	85 c0                	test   %eax,%eax
+  802968:	7e a3                	jle    80290d <devfile_readmap+0x5c>
+  80296a:	48 98                	cltq
+  80296c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802970:	72 9b                	jb     80290d <devfile_readmap+0x5c>
+        buf += read;
+  802972:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802975:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802978:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80297c:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802983:	75 88                	jne    80290d <devfile_readmap+0x5c>
+  802985:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802989:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80298f:	0f 85 78 ff ff ff    	jne    80290d <devfile_readmap+0x5c>
+  802995:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  80299c:	0f 86 6b ff ff ff    	jbe    80290d <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029a2:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029a8:	4d 39 e7             	cmp    %r12,%r15
+  8029ab:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029af:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029b6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029ba:	0f 84 73 ff ff ff    	je     802933 <devfile_readmap+0x82>
+  8029c0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029c4:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029c9:	41 ff d6             	call   *%r14
+  8029cc:	a8 40                	test   $0x40,%al
+  8029ce:	0f 85 39 ff ff ff    	jne    80290d <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029d4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029db:	4c 39 e3             	cmp    %r12,%rbx
+  8029de:	72 e4                	jb     8029c4 <devfile_readmap+0x113>
+  8029e0:	e9 4e ff ff ff       	jmp    802933 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8029e5:	4c 89 fa             	mov    %r15,%rdx
+  8029e8:	4c 89 ee             	mov    %r13,%rsi
+  8029eb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029ef:	48 b8 32 23 80 00 00 	movabs $0x802332,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8029fb:	48 85 c0             	test   %rax,%rax
+  8029fe:	78 0c                	js     802a0c <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a00:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a04:	48 01 f0             	add    %rsi,%rax
+  802a07:	e9 0e ff ff ff       	jmp    80291a <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a0c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a10:	48 85 f6             	test   %rsi,%rsi
+  802a13:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a17:	e9 fe fe ff ff       	jmp    80291a <devfile_readmap+0x69>
+
+0000000000802a1c <open>:
+open(const char *path, int mode) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	41 55                	push   %r13
+  802a22:	41 54                	push   %r12
+  802a24:	53                   	push   %rbx
+  802a25:	48 83 ec 18          	sub    $0x18,%rsp
+  802a29:	49 89 fc             	mov    %rdi,%r12
+  802a2c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a2f:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+  802a3b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a41:	0f 87 8a 00 00 00    	ja     802ad1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a4b:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  802a52:	00 00 00 
+  802a55:	ff d0                	call   *%rax
+  802a57:	89 c3                	mov    %eax,%ebx
+  802a59:	85 c0                	test   %eax,%eax
+  802a5b:	78 50                	js     802aad <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a5d:	4c 89 e6             	mov    %r12,%rsi
+  802a60:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a67:	00 00 00 
+  802a6a:	48 89 df             	mov    %rbx,%rdi
+  802a6d:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a79:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a80:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a84:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a89:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802a90:	00 00 00 
+  802a93:	ff d0                	call   *%rax
+  802a95:	89 c3                	mov    %eax,%ebx
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 1f                	js     802aba <open+0x9e>
+    return fd2num(fd);
+  802a9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a9f:	48 b8 4c 15 80 00 00 	movabs $0x80154c,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+  802aab:	89 c3                	mov    %eax,%ebx
+}
+  802aad:	89 d8                	mov    %ebx,%eax
+  802aaf:	48 83 c4 18          	add    $0x18,%rsp
+  802ab3:	5b                   	pop    %rbx
+  802ab4:	41 5c                	pop    %r12
+  802ab6:	41 5d                	pop    %r13
+  802ab8:	5d                   	pop    %rbp
+  802ab9:	c3                   	ret
+        fd_close(fd, 0);
+  802aba:	be 00 00 00 00       	mov    $0x0,%esi
+  802abf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ac3:	48 b8 95 16 80 00 00 	movabs $0x801695,%rax
+  802aca:	00 00 00 
+  802acd:	ff d0                	call   *%rax
+        return res;
+  802acf:	eb dc                	jmp    802aad <open+0x91>
+        return -E_BAD_PATH;
+  802ad1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ad6:	eb d5                	jmp    802aad <open+0x91>
+
+0000000000802ad8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802ad8:	55                   	push   %rbp
+  802ad9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802adc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae1:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ae6:	48 b8 f7 20 80 00 00 	movabs $0x8020f7,%rax
+  802aed:	00 00 00 
+  802af0:	ff d0                	call   *%rax
+}
+  802af2:	5d                   	pop    %rbp
+  802af3:	c3                   	ret
+
+0000000000802af4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802af4:	55                   	push   %rbp
+  802af5:	48 89 e5             	mov    %rsp,%rbp
+  802af8:	41 54                	push   %r12
+  802afa:	53                   	push   %rbx
+  802afb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802afe:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b0d:	48 be e0 3c 80 00 00 	movabs $0x803ce0,%rsi
+  802b14:	00 00 00 
+  802b17:	48 89 df             	mov    %rbx,%rdi
+  802b1a:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b26:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b2b:	41 2b 04 24          	sub    (%r12),%eax
+  802b2f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b35:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b3c:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b3f:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b46:	00 00 00 
+  802b49:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b55:	5b                   	pop    %rbx
+  802b56:	41 5c                	pop    %r12
+  802b58:	5d                   	pop    %rbp
+  802b59:	c3                   	ret
+
+0000000000802b5a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b5a:	55                   	push   %rbp
+  802b5b:	48 89 e5             	mov    %rsp,%rbp
+  802b5e:	41 54                	push   %r12
+  802b60:	53                   	push   %rbx
+  802b61:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b69:	48 89 fe             	mov    %rdi,%rsi
+  802b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b71:	49 bc 48 12 80 00 00 	movabs $0x801248,%r12
+  802b78:	00 00 00 
+  802b7b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b7e:	48 89 df             	mov    %rbx,%rdi
+  802b81:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+  802b8d:	48 89 c6             	mov    %rax,%rsi
+  802b90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9a:	41 ff d4             	call   *%r12
+}
+  802b9d:	5b                   	pop    %rbx
+  802b9e:	41 5c                	pop    %r12
+  802ba0:	5d                   	pop    %rbp
+  802ba1:	c3                   	ret
+
+0000000000802ba2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ba2:	55                   	push   %rbp
+  802ba3:	48 89 e5             	mov    %rsp,%rbp
+  802ba6:	41 57                	push   %r15
+  802ba8:	41 56                	push   %r14
+  802baa:	41 55                	push   %r13
+  802bac:	41 54                	push   %r12
+  802bae:	53                   	push   %rbx
+  802baf:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb3:	49 89 fc             	mov    %rdi,%r12
+  802bb6:	49 89 f5             	mov    %rsi,%r13
+  802bb9:	49 89 d7             	mov    %rdx,%r15
+  802bbc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bc0:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802bc7:	00 00 00 
+  802bca:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bcc:	4d 85 ff             	test   %r15,%r15
+  802bcf:	0f 84 af 00 00 00    	je     802c84 <devpipe_write+0xe2>
+  802bd5:	48 89 c3             	mov    %rax,%rbx
+  802bd8:	4c 89 f8             	mov    %r15,%rax
+  802bdb:	4d 89 ef             	mov    %r13,%r15
+  802bde:	4c 01 e8             	add    %r13,%rax
+  802be1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802be5:	49 bd 50 11 80 00 00 	movabs $0x801150,%r13
+  802bec:	00 00 00 
+            sys_yield();
+  802bef:	49 be ed 10 80 00 00 	movabs $0x8010ed,%r14
+  802bf6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802bf9:	8b 73 04             	mov    0x4(%rbx),%esi
+  802bfc:	48 63 ce             	movslq %esi,%rcx
+  802bff:	48 63 03             	movslq (%rbx),%rax
+  802c02:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c08:	48 39 c1             	cmp    %rax,%rcx
+  802c0b:	72 2e                	jb     802c3b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c0d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c12:	48 89 da             	mov    %rbx,%rdx
+  802c15:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c1a:	4c 89 e7             	mov    %r12,%rdi
+  802c1d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	74 66                	je     802c8a <devpipe_write+0xe8>
+            sys_yield();
+  802c24:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c27:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c2a:	48 63 ce             	movslq %esi,%rcx
+  802c2d:	48 63 03             	movslq (%rbx),%rax
+  802c30:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c36:	48 39 c1             	cmp    %rax,%rcx
+  802c39:	73 d2                	jae    802c0d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c3b:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c3f:	48 89 ca             	mov    %rcx,%rdx
+  802c42:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c46:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c4d:	08 10 20 
+  802c50:	48 f7 e2             	mul    %rdx
+  802c53:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c57:	48 89 d0             	mov    %rdx,%rax
+  802c5a:	48 c1 e0 09          	shl    $0x9,%rax
+  802c5e:	48 29 d0             	sub    %rdx,%rax
+  802c61:	48 c1 e0 03          	shl    $0x3,%rax
+  802c65:	48 29 c1             	sub    %rax,%rcx
+  802c68:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c6d:	83 c6 01             	add    $0x1,%esi
+  802c70:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c73:	49 83 c7 01          	add    $0x1,%r15
+  802c77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c7b:	49 39 c7             	cmp    %rax,%r15
+  802c7e:	0f 85 75 ff ff ff    	jne    802bf9 <devpipe_write+0x57>
+    return n;
+  802c84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c88:	eb 05                	jmp    802c8f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8f:	48 83 c4 18          	add    $0x18,%rsp
+  802c93:	5b                   	pop    %rbx
+  802c94:	41 5c                	pop    %r12
+  802c96:	41 5d                	pop    %r13
+  802c98:	41 5e                	pop    %r14
+  802c9a:	41 5f                	pop    %r15
+  802c9c:	5d                   	pop    %rbp
+  802c9d:	c3                   	ret
+
+0000000000802c9e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c9e:	55                   	push   %rbp
+  802c9f:	48 89 e5             	mov    %rsp,%rbp
+  802ca2:	41 57                	push   %r15
+  802ca4:	41 56                	push   %r14
+  802ca6:	41 55                	push   %r13
+  802ca8:	41 54                	push   %r12
+  802caa:	53                   	push   %rbx
+  802cab:	48 83 ec 18          	sub    $0x18,%rsp
+  802caf:	49 89 fc             	mov    %rdi,%r12
+  802cb2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cb6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cba:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+  802cc6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cc9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ccf:	49 bd 50 11 80 00 00 	movabs $0x801150,%r13
+  802cd6:	00 00 00 
+            sys_yield();
+  802cd9:	49 be ed 10 80 00 00 	movabs $0x8010ed,%r14
+  802ce0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ce3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ce8:	74 7d                	je     802d67 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802cea:	8b 03                	mov    (%rbx),%eax
+  802cec:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802cef:	75 26                	jne    802d17 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802cf1:	4d 85 ff             	test   %r15,%r15
+  802cf4:	75 77                	jne    802d6d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cf6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cfb:	48 89 da             	mov    %rbx,%rdx
+  802cfe:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d03:	4c 89 e7             	mov    %r12,%rdi
+  802d06:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d09:	85 c0                	test   %eax,%eax
+  802d0b:	74 72                	je     802d7f <devpipe_read+0xe1>
+            sys_yield();
+  802d0d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d10:	8b 03                	mov    (%rbx),%eax
+  802d12:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d15:	74 df                	je     802cf6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d17:	48 63 c8             	movslq %eax,%rcx
+  802d1a:	48 89 ca             	mov    %rcx,%rdx
+  802d1d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d21:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d28:	08 10 20 
+  802d2b:	48 89 d0             	mov    %rdx,%rax
+  802d2e:	48 f7 e6             	mul    %rsi
+  802d31:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d35:	48 89 d0             	mov    %rdx,%rax
+  802d38:	48 c1 e0 09          	shl    $0x9,%rax
+  802d3c:	48 29 d0             	sub    %rdx,%rax
+  802d3f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d46:	00 
+  802d47:	48 89 c8             	mov    %rcx,%rax
+  802d4a:	48 29 d0             	sub    %rdx,%rax
+  802d4d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d52:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d56:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d5a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d5d:	49 83 c7 01          	add    $0x1,%r15
+  802d61:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d65:	75 83                	jne    802cea <devpipe_read+0x4c>
+    return n;
+  802d67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d6b:	eb 03                	jmp    802d70 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d6d:	4c 89 f8             	mov    %r15,%rax
+}
+  802d70:	48 83 c4 18          	add    $0x18,%rsp
+  802d74:	5b                   	pop    %rbx
+  802d75:	41 5c                	pop    %r12
+  802d77:	41 5d                	pop    %r13
+  802d79:	41 5e                	pop    %r14
+  802d7b:	41 5f                	pop    %r15
+  802d7d:	5d                   	pop    %rbp
+  802d7e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d84:	eb ea                	jmp    802d70 <devpipe_read+0xd2>
+
+0000000000802d86 <pipe>:
+pipe(int pfd[2]) {
+  802d86:	55                   	push   %rbp
+  802d87:	48 89 e5             	mov    %rsp,%rbp
+  802d8a:	41 55                	push   %r13
+  802d8c:	41 54                	push   %r12
+  802d8e:	53                   	push   %rbx
+  802d8f:	48 83 ec 18          	sub    $0x18,%rsp
+  802d93:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802d96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d9a:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  802da1:	00 00 00 
+  802da4:	ff d0                	call   *%rax
+  802da6:	89 c3                	mov    %eax,%ebx
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	0f 88 a0 01 00 00    	js     802f50 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802db0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802db5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc3:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  802dca:	00 00 00 
+  802dcd:	ff d0                	call   *%rax
+  802dcf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802dd1:	85 c0                	test   %eax,%eax
+  802dd3:	0f 88 77 01 00 00    	js     802f50 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dd9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ddd:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  802de4:	00 00 00 
+  802de7:	ff d0                	call   *%rax
+  802de9:	89 c3                	mov    %eax,%ebx
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	0f 88 43 01 00 00    	js     802f36 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802df3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802df8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dfd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e06:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  802e0d:	00 00 00 
+  802e10:	ff d0                	call   *%rax
+  802e12:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e14:	85 c0                	test   %eax,%eax
+  802e16:	0f 88 1a 01 00 00    	js     802f36 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e1c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e20:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e2f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e39:	48 89 c6             	mov    %rax,%rsi
+  802e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e41:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+  802e4d:	89 c3                	mov    %eax,%ebx
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	0f 88 c5 00 00 00    	js     802f1c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e57:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e5b:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	48 89 c1             	mov    %rax,%rcx
+  802e6a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e70:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7b:	4c 89 ee             	mov    %r13,%rsi
+  802e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e83:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  802e8a:	00 00 00 
+  802e8d:	ff d0                	call   *%rax
+  802e8f:	89 c3                	mov    %eax,%ebx
+  802e91:	85 c0                	test   %eax,%eax
+  802e93:	78 6e                	js     802f03 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802e95:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e9a:	4c 89 ef             	mov    %r13,%rdi
+  802e9d:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+  802ea9:	83 f8 02             	cmp    $0x2,%eax
+  802eac:	0f 85 ab 00 00 00    	jne    802f5d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802eb2:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802eb9:	00 00 
+  802ebb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ebf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ec1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ec5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802ecc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ed0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ed2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ed6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802edd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ee1:	48 bb 4c 15 80 00 00 	movabs $0x80154c,%rbx
+  802ee8:	00 00 00 
+  802eeb:	ff d3                	call   *%rbx
+  802eed:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802ef1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ef5:	ff d3                	call   *%rbx
+  802ef7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802efc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f01:	eb 4d                	jmp    802f50 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f08:	4c 89 ee             	mov    %r13,%rsi
+  802f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f10:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f21:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2a:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f3b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f44:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+}
+  802f50:	89 d8                	mov    %ebx,%eax
+  802f52:	48 83 c4 18          	add    $0x18,%rsp
+  802f56:	5b                   	pop    %rbx
+  802f57:	41 5c                	pop    %r12
+  802f59:	41 5d                	pop    %r13
+  802f5b:	5d                   	pop    %rbp
+  802f5c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f5d:	48 b9 10 3d 80 00 00 	movabs $0x803d10,%rcx
+  802f64:	00 00 00 
+  802f67:	48 ba e7 3c 80 00 00 	movabs $0x803ce7,%rdx
+  802f6e:	00 00 00 
+  802f71:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f76:	48 bf fc 3c 80 00 00 	movabs $0x803cfc,%rdi
+  802f7d:	00 00 00 
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	49 b8 dd 33 80 00 00 	movabs $0x8033dd,%r8
+  802f8c:	00 00 00 
+  802f8f:	41 ff d0             	call   *%r8
+
+0000000000802f92 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802f92:	55                   	push   %rbp
+  802f93:	48 89 e5             	mov    %rsp,%rbp
+  802f96:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f9e:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 35                	js     802fe3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb2:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  802fb9:	00 00 00 
+  802fbc:	ff d0                	call   *%rax
+  802fbe:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fc1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fc6:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fcb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fcf:	48 b8 50 11 80 00 00 	movabs $0x801150,%rax
+  802fd6:	00 00 00 
+  802fd9:	ff d0                	call   *%rax
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	0f 94 c0             	sete   %al
+  802fe0:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe3:	c9                   	leave
+  802fe4:	c3                   	ret
+
+0000000000802fe5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802fe5:	48 89 f8             	mov    %rdi,%rax
+  802fe8:	48 c1 e8 27          	shr    $0x27,%rax
+  802fec:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ff3:	01 00 00 
+  802ff6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ffa:	f6 c2 01             	test   $0x1,%dl
+  802ffd:	74 6d                	je     80306c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802fff:	48 89 f8             	mov    %rdi,%rax
+  803002:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803006:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80300d:	01 00 00 
+  803010:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803014:	f6 c2 01             	test   $0x1,%dl
+  803017:	74 62                	je     80307b <get_uvpt_entry+0x96>
+  803019:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803020:	01 00 00 
+  803023:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803027:	f6 c2 80             	test   $0x80,%dl
+  80302a:	75 4f                	jne    80307b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80302c:	48 89 f8             	mov    %rdi,%rax
+  80302f:	48 c1 e8 15          	shr    $0x15,%rax
+  803033:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80303a:	01 00 00 
+  80303d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803041:	f6 c2 01             	test   $0x1,%dl
+  803044:	74 44                	je     80308a <get_uvpt_entry+0xa5>
+  803046:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80304d:	01 00 00 
+  803050:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803054:	f6 c2 80             	test   $0x80,%dl
+  803057:	75 31                	jne    80308a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803059:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80305d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803064:	01 00 00 
+  803067:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80306b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80306c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803073:	01 00 00 
+  803076:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80307a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80307b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803082:	01 00 00 
+  803085:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803089:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80308a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803091:	01 00 00 
+  803094:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803098:	c3                   	ret
+
+0000000000803099 <get_prot>:
+
+int
+get_prot(void *va) {
+  803099:	55                   	push   %rbp
+  80309a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80309d:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+  8030a9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030ac:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030b1:	89 c1                	mov    %eax,%ecx
+  8030b3:	83 c9 04             	or     $0x4,%ecx
+  8030b6:	f6 c2 01             	test   $0x1,%dl
+  8030b9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030bc:	89 c1                	mov    %eax,%ecx
+  8030be:	83 c9 02             	or     $0x2,%ecx
+  8030c1:	f6 c2 02             	test   $0x2,%dl
+  8030c4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030c7:	89 c1                	mov    %eax,%ecx
+  8030c9:	83 c9 01             	or     $0x1,%ecx
+  8030cc:	48 85 d2             	test   %rdx,%rdx
+  8030cf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030d2:	89 c1                	mov    %eax,%ecx
+  8030d4:	83 c9 40             	or     $0x40,%ecx
+  8030d7:	f6 c6 04             	test   $0x4,%dh
+  8030da:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030dd:	5d                   	pop    %rbp
+  8030de:	c3                   	ret
+
+00000000008030df <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030df:	55                   	push   %rbp
+  8030e0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030e3:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  8030ea:	00 00 00 
+  8030ed:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8030ef:	48 c1 e8 06          	shr    $0x6,%rax
+  8030f3:	83 e0 01             	and    $0x1,%eax
+}
+  8030f6:	5d                   	pop    %rbp
+  8030f7:	c3                   	ret
+
+00000000008030f8 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8030f8:	55                   	push   %rbp
+  8030f9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030fc:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  803103:	00 00 00 
+  803106:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803108:	48 c1 e8 05          	shr    $0x5,%rax
+  80310c:	83 e0 01             	and    $0x1,%eax
+}
+  80310f:	5d                   	pop    %rbp
+  803110:	c3                   	ret
+
+0000000000803111 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803111:	55                   	push   %rbp
+  803112:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803115:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  80311c:	00 00 00 
+  80311f:	ff d0                	call   *%rax
+  803121:	83 e0 01             	and    $0x1,%eax
+}
+  803124:	5d                   	pop    %rbp
+  803125:	c3                   	ret
+
+0000000000803126 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+  80312a:	41 57                	push   %r15
+  80312c:	41 56                	push   %r14
+  80312e:	41 55                	push   %r13
+  803130:	41 54                	push   %r12
+  803132:	53                   	push   %rbx
+  803133:	48 83 ec 18          	sub    $0x18,%rsp
+  803137:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80313b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80313f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803144:	49 bd 11 31 80 00 00 	movabs $0x803111,%r13
+  80314b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80314e:	49 bf 99 30 80 00 00 	movabs $0x803099,%r15
+  803155:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803158:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80315f:	00 00 00 
+  803162:	eb 0c                	jmp    803170 <foreach_shared_region+0x4a>
+  803164:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80316b:	4c 39 f3             	cmp    %r14,%rbx
+  80316e:	74 2e                	je     80319e <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803170:	48 89 df             	mov    %rbx,%rdi
+  803173:	41 ff d5             	call   *%r13
+  803176:	84 c0                	test   %al,%al
+  803178:	74 ea                	je     803164 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80317a:	48 89 df             	mov    %rbx,%rdi
+  80317d:	41 ff d7             	call   *%r15
+  803180:	a8 40                	test   $0x40,%al
+  803182:	74 e0                	je     803164 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803184:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80318b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80318f:	48 89 df             	mov    %rbx,%rdi
+  803192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803196:	ff d0                	call   *%rax
+				if (res < 0) {
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	79 c8                	jns    803164 <foreach_shared_region+0x3e>
+  80319c:	eb 05                	jmp    8031a3 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80319e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031a3:	48 83 c4 18          	add    $0x18,%rsp
+  8031a7:	5b                   	pop    %rbx
+  8031a8:	41 5c                	pop    %r12
+  8031aa:	41 5d                	pop    %r13
+  8031ac:	41 5e                	pop    %r14
+  8031ae:	41 5f                	pop    %r15
+  8031b0:	5d                   	pop    %rbp
+  8031b1:	c3                   	ret
+
+00000000008031b2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b7:	c3                   	ret
+
+00000000008031b8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031b8:	55                   	push   %rbp
+  8031b9:	48 89 e5             	mov    %rsp,%rbp
+  8031bc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031bf:	48 be 34 3d 80 00 00 	movabs $0x803d34,%rsi
+  8031c6:	00 00 00 
+  8031c9:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+    return 0;
+}
+  8031d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031da:	5d                   	pop    %rbp
+  8031db:	c3                   	ret
+
+00000000008031dc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031dc:	55                   	push   %rbp
+  8031dd:	48 89 e5             	mov    %rsp,%rbp
+  8031e0:	41 57                	push   %r15
+  8031e2:	41 56                	push   %r14
+  8031e4:	41 55                	push   %r13
+  8031e6:	41 54                	push   %r12
+  8031e8:	53                   	push   %rbx
+  8031e9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031f0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031f7:	48 85 d2             	test   %rdx,%rdx
+  8031fa:	74 7a                	je     803276 <devcons_write+0x9a>
+  8031fc:	49 89 d6             	mov    %rdx,%r14
+  8031ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803205:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80320a:	49 bf ea 0c 80 00 00 	movabs $0x800cea,%r15
+  803211:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803214:	4c 89 f3             	mov    %r14,%rbx
+  803217:	48 29 f3             	sub    %rsi,%rbx
+  80321a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80321f:	48 39 c3             	cmp    %rax,%rbx
+  803222:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803226:	4c 63 eb             	movslq %ebx,%r13
+  803229:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803230:	48 01 c6             	add    %rax,%rsi
+  803233:	4c 89 ea             	mov    %r13,%rdx
+  803236:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80323d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803240:	4c 89 ee             	mov    %r13,%rsi
+  803243:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80324a:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803256:	41 01 dc             	add    %ebx,%r12d
+  803259:	49 63 f4             	movslq %r12d,%rsi
+  80325c:	4c 39 f6             	cmp    %r14,%rsi
+  80325f:	72 b3                	jb     803214 <devcons_write+0x38>
+    return res;
+  803261:	49 63 c4             	movslq %r12d,%rax
+}
+  803264:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80326b:	5b                   	pop    %rbx
+  80326c:	41 5c                	pop    %r12
+  80326e:	41 5d                	pop    %r13
+  803270:	41 5e                	pop    %r14
+  803272:	41 5f                	pop    %r15
+  803274:	5d                   	pop    %rbp
+  803275:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803276:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80327c:	eb e3                	jmp    803261 <devcons_write+0x85>
+
+000000000080327e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80327e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803281:	ba 00 00 00 00       	mov    $0x0,%edx
+  803286:	48 85 c0             	test   %rax,%rax
+  803289:	74 55                	je     8032e0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80328b:	55                   	push   %rbp
+  80328c:	48 89 e5             	mov    %rsp,%rbp
+  80328f:	41 55                	push   %r13
+  803291:	41 54                	push   %r12
+  803293:	53                   	push   %rbx
+  803294:	48 83 ec 08          	sub    $0x8,%rsp
+  803298:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80329b:	48 bb 20 10 80 00 00 	movabs $0x801020,%rbx
+  8032a2:	00 00 00 
+  8032a5:	49 bc ed 10 80 00 00 	movabs $0x8010ed,%r12
+  8032ac:	00 00 00 
+  8032af:	eb 03                	jmp    8032b4 <devcons_read+0x36>
+  8032b1:	41 ff d4             	call   *%r12
+  8032b4:	ff d3                	call   *%rbx
+  8032b6:	85 c0                	test   %eax,%eax
+  8032b8:	74 f7                	je     8032b1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8032ba:	48 63 d0             	movslq %eax,%rdx
+  8032bd:	78 13                	js     8032d2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c4:	83 f8 04             	cmp    $0x4,%eax
+  8032c7:	74 09                	je     8032d2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032c9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032cd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032d2:	48 89 d0             	mov    %rdx,%rax
+  8032d5:	48 83 c4 08          	add    $0x8,%rsp
+  8032d9:	5b                   	pop    %rbx
+  8032da:	41 5c                	pop    %r12
+  8032dc:	41 5d                	pop    %r13
+  8032de:	5d                   	pop    %rbp
+  8032df:	c3                   	ret
+  8032e0:	48 89 d0             	mov    %rdx,%rax
+  8032e3:	c3                   	ret
+
+00000000008032e4 <cputchar>:
+cputchar(int ch) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032ec:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8032f5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032f9:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+}
+  803305:	c9                   	leave
+  803306:	c3                   	ret
+
+0000000000803307 <getchar>:
+getchar(void) {
+  803307:	55                   	push   %rbp
+  803308:	48 89 e5             	mov    %rsp,%rbp
+  80330b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80330f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803314:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331d:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80332b:	85 c0                	test   %eax,%eax
+  80332d:	78 06                	js     803335 <getchar+0x2e>
+  80332f:	74 08                	je     803339 <getchar+0x32>
+  803331:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803335:	89 d0                	mov    %edx,%eax
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803339:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80333e:	eb f5                	jmp    803335 <getchar+0x2e>
+
+0000000000803340 <iscons>:
+iscons(int fdnum) {
+  803340:	55                   	push   %rbp
+  803341:	48 89 e5             	mov    %rsp,%rbp
+  803344:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803348:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80334c:	48 b8 da 15 80 00 00 	movabs $0x8015da,%rax
+  803353:	00 00 00 
+  803356:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803358:	85 c0                	test   %eax,%eax
+  80335a:	78 18                	js     803374 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80335c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803360:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803367:	00 00 00 
+  80336a:	8b 00                	mov    (%rax),%eax
+  80336c:	39 02                	cmp    %eax,(%rdx)
+  80336e:	0f 94 c0             	sete   %al
+  803371:	0f b6 c0             	movzbl %al,%eax
+}
+  803374:	c9                   	leave
+  803375:	c3                   	ret
+
+0000000000803376 <opencons>:
+opencons(void) {
+  803376:	55                   	push   %rbp
+  803377:	48 89 e5             	mov    %rsp,%rbp
+  80337a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80337e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803382:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	78 49                	js     8033db <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803392:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803397:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80339c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8033a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a5:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	78 26                	js     8033db <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b9:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033c0:	00 00 
+  8033c2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033c8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033cf:	48 b8 4c 15 80 00 00 	movabs $0x80154c,%rax
+  8033d6:	00 00 00 
+  8033d9:	ff d0                	call   *%rax
+}
+  8033db:	c9                   	leave
+  8033dc:	c3                   	ret
+
+00000000008033dd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033dd:	55                   	push   %rbp
+  8033de:	48 89 e5             	mov    %rsp,%rbp
+  8033e1:	41 56                	push   %r14
+  8033e3:	41 55                	push   %r13
+  8033e5:	41 54                	push   %r12
+  8033e7:	53                   	push   %rbx
+  8033e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8033ec:	49 89 fc             	mov    %rdi,%r12
+  8033ef:	41 89 f5             	mov    %esi,%r13d
+  8033f2:	48 89 d3             	mov    %rdx,%rbx
+  8033f5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033f9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8033fd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803401:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803408:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80340c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803410:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803414:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803418:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80341f:	00 00 00 
+  803422:	4c 8b 30             	mov    (%rax),%r14
+  803425:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80342c:	00 00 00 
+  80342f:	ff d0                	call   *%rax
+  803431:	89 c6                	mov    %eax,%esi
+  803433:	45 89 e8             	mov    %r13d,%r8d
+  803436:	4c 89 e1             	mov    %r12,%rcx
+  803439:	4c 89 f2             	mov    %r14,%rdx
+  80343c:	48 bf 40 3d 80 00 00 	movabs $0x803d40,%rdi
+  803443:	00 00 00 
+  803446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344b:	49 bc cb 01 80 00 00 	movabs $0x8001cb,%r12
+  803452:	00 00 00 
+  803455:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803458:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80345c:	48 89 df             	mov    %rbx,%rdi
+  80345f:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+    cprintf("\n");
+  80346b:	48 bf b4 36 80 00 00 	movabs $0x8036b4,%rdi
+  803472:	00 00 00 
+  803475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80347d:	cc                   	int3
+  80347e:	eb fd                	jmp    80347d <_panic+0xa0>
+
+0000000000803480 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803480:	55                   	push   %rbp
+  803481:	48 89 e5             	mov    %rsp,%rbp
+  803484:	41 55                	push   %r13
+  803486:	41 54                	push   %r12
+  803488:	53                   	push   %rbx
+  803489:	48 83 ec 08          	sub    $0x8,%rsp
+  80348d:	49 89 fc             	mov    %rdi,%r12
+  803490:	48 89 f7             	mov    %rsi,%rdi
+  803493:	48 89 d3             	mov    %rdx,%rbx
+  803496:	49 89 cd             	mov    %rcx,%r13
+  803499:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80349c:	48 85 f6             	test   %rsi,%rsi
+  80349f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034a6:	00 00 00 
+  8034a9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034ad:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034b2:	48 85 db             	test   %rbx,%rbx
+  8034b5:	74 03                	je     8034ba <ipc_recv_timed+0x3a>
+  8034b7:	48 8b 33             	mov    (%rbx),%rsi
+  8034ba:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  8034c1:	00 00 00 
+  8034c4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034c6:	85 c0                	test   %eax,%eax
+  8034c8:	78 75                	js     80353f <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034ca:	4d 85 e4             	test   %r12,%r12
+  8034cd:	74 14                	je     8034e3 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034cf:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d6:	00 00 00 
+  8034d9:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034df:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034e3:	4d 85 ed             	test   %r13,%r13
+  8034e6:	74 14                	je     8034fc <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034e8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ef:	00 00 00 
+  8034f2:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034f8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034fc:	48 85 db             	test   %rbx,%rbx
+  8034ff:	74 23                	je     803524 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803501:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803508:	00 00 00 
+  80350b:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803511:	ba 00 00 00 00       	mov    $0x0,%edx
+  803516:	85 c9                	test   %ecx,%ecx
+  803518:	74 07                	je     803521 <ipc_recv_timed+0xa1>
+  80351a:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803521:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803524:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80352b:	00 00 00 
+  80352e:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803534:	48 83 c4 08          	add    $0x8,%rsp
+  803538:	5b                   	pop    %rbx
+  803539:	41 5c                	pop    %r12
+  80353b:	41 5d                	pop    %r13
+  80353d:	5d                   	pop    %rbp
+  80353e:	c3                   	ret
+        if (from_env_store != NULL) {
+  80353f:	4d 85 e4             	test   %r12,%r12
+  803542:	74 08                	je     80354c <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803544:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80354b:	00 
+        if (perm_store != NULL) {
+  80354c:	4d 85 ed             	test   %r13,%r13
+  80354f:	74 08                	je     803559 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803551:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803558:	00 
+        if (size != NULL) {
+  803559:	48 85 db             	test   %rbx,%rbx
+  80355c:	74 d6                	je     803534 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80355e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803565:	eb cd                	jmp    803534 <ipc_recv_timed+0xb4>
+
+0000000000803567 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803567:	55                   	push   %rbp
+  803568:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80356b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803571:	48 b8 80 34 80 00 00 	movabs $0x803480,%rax
+  803578:	00 00 00 
+  80357b:	ff d0                	call   *%rax
+}
+  80357d:	5d                   	pop    %rbp
+  80357e:	c3                   	ret
+
+000000000080357f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	41 57                	push   %r15
+  803585:	41 56                	push   %r14
+  803587:	41 55                	push   %r13
+  803589:	41 54                	push   %r12
+  80358b:	53                   	push   %rbx
+  80358c:	48 83 ec 18          	sub    $0x18,%rsp
+  803590:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803593:	48 89 d3             	mov    %rdx,%rbx
+  803596:	49 89 cc             	mov    %rcx,%r12
+  803599:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80359c:	48 85 d2             	test   %rdx,%rdx
+  80359f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035a6:	00 00 00 
+  8035a9:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035ad:	89 f0                	mov    %esi,%eax
+  8035af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035b3:	48 89 da             	mov    %rbx,%rdx
+  8035b6:	48 89 c6             	mov    %rax,%rsi
+  8035b9:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  8035c0:	00 00 00 
+  8035c3:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035c5:	85 c0                	test   %eax,%eax
+  8035c7:	79 65                	jns    80362e <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035c9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035cc:	75 33                	jne    803601 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035ce:	49 bf ed 10 80 00 00 	movabs $0x8010ed,%r15
+  8035d5:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d8:	49 be ea 13 80 00 00 	movabs $0x8013ea,%r14
+  8035df:	00 00 00 
+        sys_yield();
+  8035e2:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035e5:	45 89 e8             	mov    %r13d,%r8d
+  8035e8:	4c 89 e1             	mov    %r12,%rcx
+  8035eb:	48 89 da             	mov    %rbx,%rdx
+  8035ee:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035f2:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035f5:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035f8:	85 c0                	test   %eax,%eax
+  8035fa:	79 32                	jns    80362e <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035fc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035ff:	74 e1                	je     8035e2 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803601:	89 c1                	mov    %eax,%ecx
+  803603:	48 ba 63 3d 80 00 00 	movabs $0x803d63,%rdx
+  80360a:	00 00 00 
+  80360d:	be 52 00 00 00       	mov    $0x52,%esi
+  803612:	48 bf 77 3d 80 00 00 	movabs $0x803d77,%rdi
+  803619:	00 00 00 
+  80361c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803621:	49 b8 dd 33 80 00 00 	movabs $0x8033dd,%r8
+  803628:	00 00 00 
+  80362b:	41 ff d0             	call   *%r8
+    }
+}
+  80362e:	48 83 c4 18          	add    $0x18,%rsp
+  803632:	5b                   	pop    %rbx
+  803633:	41 5c                	pop    %r12
+  803635:	41 5d                	pop    %r13
+  803637:	41 5e                	pop    %r14
+  803639:	41 5f                	pop    %r15
+  80363b:	5d                   	pop    %rbp
+  80363c:	c3                   	ret
+
+000000000080363d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80363d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803642:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803649:	00 00 00 
+  80364c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803650:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803654:	48 c1 e2 04          	shl    $0x4,%rdx
+  803658:	48 01 ca             	add    %rcx,%rdx
+  80365b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803661:	39 fa                	cmp    %edi,%edx
+  803663:	74 12                	je     803677 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803665:	48 83 c0 01          	add    $0x1,%rax
+  803669:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80366f:	75 db                	jne    80364c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803671:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803676:	c3                   	ret
+            return envs[i].env_id;
+  803677:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80367b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80367f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803683:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80368a:	00 00 00 
+  80368d:	48 01 d0             	add    %rdx,%rax
+  803690:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803696:	c3                   	ret
+  803697:	90                   	nop
+
+0000000000803698 <__rodata_start>:
+  803698:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  80369c:	61                   	(bad)
+  80369d:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f86ed4 <__bss_end+0x2077eed4>
+  8036a4:	66 72 6f             	data16 jb 803716 <__rodata_start+0x7e>
+  8036a7:	6d                   	insl   (%dx),%es:(%rdi)
+  8036a8:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  8036ac:	61                   	(bad)
+  8036ad:	74 69                	je     803718 <__rodata_start+0x80>
+  8036af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036b0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036b1:	20 30                	and    %dh,(%rax)
+  8036b3:	21 0a                	and    %ecx,(%rdx)
+  8036b5:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8036bc:	77 6e                	ja     80372c <__rodata_start+0x94>
+  8036be:	3e 00 30             	ds add %dh,(%rax)
+  8036c1:	31 32                	xor    %esi,(%rdx)
+  8036c3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036ca:	41                   	rex.B
+  8036cb:	42                   	rex.X
+  8036cc:	43                   	rex.XB
+  8036cd:	44                   	rex.R
+  8036ce:	45                   	rex.RB
+  8036cf:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036d2:	31 32                	xor    %esi,(%rdx)
+  8036d4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036db:	61                   	(bad)
+  8036dc:	62 63 64 65 66       	(bad)
+  8036e1:	00 28                	add    %ch,(%rax)
+  8036e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036e4:	75 6c                	jne    803752 <__rodata_start+0xba>
+  8036e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036e7:	29 00                	sub    %eax,(%rax)
+  8036e9:	65 72 72             	gs jb  80375e <__rodata_start+0xc6>
+  8036ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036ed:	72 20                	jb     80370f <__rodata_start+0x77>
+  8036ef:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8036f4:	73 70                	jae    803766 <__rodata_start+0xce>
+  8036f6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8036fa:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803701:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803702:	72 00                	jb     803704 <__rodata_start+0x6c>
+  803704:	62 61 64 20 65       	(bad)
+  803709:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370a:	76 69                	jbe    803775 <__rodata_start+0xdd>
+  80370c:	72 6f                	jb     80377d <__rodata_start+0xe5>
+  80370e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370f:	6d                   	insl   (%dx),%es:(%rdi)
+  803710:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803712:	74 00                	je     803714 <__rodata_start+0x7c>
+  803714:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80371b:	20 70 61             	and    %dh,0x61(%rax)
+  80371e:	72 61                	jb     803781 <__rodata_start+0xe9>
+  803720:	6d                   	insl   (%dx),%es:(%rdi)
+  803721:	65 74 65             	gs je  803789 <__rodata_start+0xf1>
+  803724:	72 00                	jb     803726 <__rodata_start+0x8e>
+  803726:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803727:	75 74                	jne    80379d <__rodata_start+0x105>
+  803729:	20 6f 66             	and    %ch,0x66(%rdi)
+  80372c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80372f:	6d                   	insl   (%dx),%es:(%rdi)
+  803730:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803731:	72 79                	jb     8037ac <__rodata_start+0x114>
+  803733:	00 6f 75             	add    %ch,0x75(%rdi)
+  803736:	74 20                	je     803758 <__rodata_start+0xc0>
+  803738:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803739:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80373d:	76 69                	jbe    8037a8 <__rodata_start+0x110>
+  80373f:	72 6f                	jb     8037b0 <__rodata_start+0x118>
+  803741:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803742:	6d                   	insl   (%dx),%es:(%rdi)
+  803743:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803745:	74 73                	je     8037ba <__rodata_start+0x122>
+  803747:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80374a:	72 72                	jb     8037be <__rodata_start+0x126>
+  80374c:	75 70                	jne    8037be <__rodata_start+0x126>
+  80374e:	74 65                	je     8037b5 <__rodata_start+0x11d>
+  803750:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803755:	75 67                	jne    8037be <__rodata_start+0x126>
+  803757:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80375a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80375c:	00 73 65             	add    %dh,0x65(%rbx)
+  80375f:	67 6d                	insl   (%dx),%es:(%edi)
+  803761:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803763:	74 61                	je     8037c6 <__rodata_start+0x12e>
+  803765:	74 69                	je     8037d0 <__rodata_start+0x138>
+  803767:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803768:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803769:	20 66 61             	and    %ah,0x61(%rsi)
+  80376c:	75 6c                	jne    8037da <__rodata_start+0x142>
+  80376e:	74 00                	je     803770 <__rodata_start+0xd8>
+  803770:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803777:	20 45 4c             	and    %al,0x4c(%rbp)
+  80377a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80377e:	61                   	(bad)
+  80377f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803784:	20 73 75             	and    %dh,0x75(%rbx)
+  803787:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80378a:	73 79                	jae    803805 <__rodata_start+0x16d>
+  80378c:	73 74                	jae    803802 <__rodata_start+0x16a>
+  80378e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803790:	20 63 61             	and    %ah,0x61(%rbx)
+  803793:	6c                   	insb   (%dx),%es:(%rdi)
+  803794:	6c                   	insb   (%dx),%es:(%rdi)
+  803795:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803798:	74 72                	je     80380c <__rodata_start+0x174>
+  80379a:	79 20                	jns    8037bc <__rodata_start+0x124>
+  80379c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80379e:	74 20                	je     8037c0 <__rodata_start+0x128>
+  8037a0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037a2:	75 6e                	jne    803812 <__rodata_start+0x17a>
+  8037a4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8037a8:	76 20                	jbe    8037ca <__rodata_start+0x132>
+  8037aa:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8037b1:	72 65                	jb     803818 <__rodata_start+0x180>
+  8037b3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8037b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037b7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037bb:	65 78 70             	gs js  80382e <__rodata_start+0x196>
+  8037be:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037c3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037c6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037ca:	20 66 69             	and    %ah,0x69(%rsi)
+  8037cd:	6c                   	insb   (%dx),%es:(%rdi)
+  8037ce:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037d2:	20 66 72             	and    %ah,0x72(%rsi)
+  8037d5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037da:	61                   	(bad)
+  8037db:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037de:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037e0:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037e4:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037e7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037e9:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ed:	79 20                	jns    80380f <__rodata_start+0x177>
+  8037ef:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8037f6:	72 65                	jb     80385d <__rodata_start+0x1c5>
+  8037f8:	20 6f 70             	and    %ch,0x70(%rdi)
+  8037fb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037fd:	00 66 69             	add    %ah,0x69(%rsi)
+  803800:	6c                   	insb   (%dx),%es:(%rdi)
+  803801:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803805:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803808:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803809:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80380c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80380d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80380e:	74 20                	je     803830 <__rodata_start+0x198>
+  803810:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803812:	75 6e                	jne    803882 <__rodata_start+0x1ea>
+  803814:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803818:	76 61                	jbe    80387b <__rodata_start+0x1e3>
+  80381a:	6c                   	insb   (%dx),%es:(%rdi)
+  80381b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803822:	00 
+  803823:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80382a:	72 65                	jb     803891 <__rodata_start+0x1f9>
+  80382c:	61                   	(bad)
+  80382d:	64 79 20             	fs jns 803850 <__rodata_start+0x1b8>
+  803830:	65 78 69             	gs js  80389c <__rodata_start+0x204>
+  803833:	73 74                	jae    8038a9 <__rodata_start+0x211>
+  803835:	73 00                	jae    803837 <__rodata_start+0x19f>
+  803837:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803838:	70 65                	jo     80389f <__rodata_start+0x207>
+  80383a:	72 61                	jb     80389d <__rodata_start+0x205>
+  80383c:	74 69                	je     8038a7 <__rodata_start+0x20f>
+  80383e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80383f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803840:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803843:	74 20                	je     803865 <__rodata_start+0x1cd>
+  803845:	73 75                	jae    8038bc <__rodata_start+0x224>
+  803847:	70 70                	jo     8038b9 <__rodata_start+0x221>
+  803849:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80384a:	72 74                	jb     8038c0 <__rodata_start+0x228>
+  80384c:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803852:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803857:	74 00                	je     803859 <__rodata_start+0x1c1>
+  803859:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  803860:	b8 03 80 00 00       	mov    $0x8003,%eax
+  803865:	00 00                	add    %al,(%rax)
+  803867:	00 f9                	add    %bh,%cl
+  803869:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80386f:	00 e9                	add    %ch,%cl
+  803871:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803877:	00 f9                	add    %bh,%cl
+  803879:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80387f:	00 f9                	add    %bh,%cl
+  803881:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803887:	00 f9                	add    %bh,%cl
+  803889:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80388f:	00 f9                	add    %bh,%cl
+  803891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803897:	00 d7                	add    %dl,%bh
+  803899:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80389f:	00 f9                	add    %bh,%cl
+  8038a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038a7:	00 f9                	add    %bh,%cl
+  8038a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038af:	00 cb                	add    %cl,%bl
+  8038b1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038b7:	00 45 04             	add    %al,0x4(%rbp)
+  8038ba:	80 00 00             	addb   $0x0,(%rax)
+  8038bd:	00 00                	add    %al,(%rax)
+  8038bf:	00 f9                	add    %bh,%cl
+  8038c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038c7:	00 cb                	add    %cl,%bl
+  8038c9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038cf:	00 11                	add    %dl,(%rcx)
+  8038d1:	04 80                	add    $0x80,%al
+  8038d3:	00 00                	add    %al,(%rax)
+  8038d5:	00 00                	add    %al,(%rax)
+  8038d7:	00 11                	add    %dl,(%rcx)
+  8038d9:	04 80                	add    $0x80,%al
+  8038db:	00 00                	add    %al,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 11                	add    %dl,(%rcx)
+  8038e1:	04 80                	add    $0x80,%al
+  8038e3:	00 00                	add    %al,(%rax)
+  8038e5:	00 00                	add    %al,(%rax)
+  8038e7:	00 11                	add    %dl,(%rcx)
+  8038e9:	04 80                	add    $0x80,%al
+  8038eb:	00 00                	add    %al,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 11                	add    %dl,(%rcx)
+  8038f1:	04 80                	add    $0x80,%al
+  8038f3:	00 00                	add    %al,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 11                	add    %dl,(%rcx)
+  8038f9:	04 80                	add    $0x80,%al
+  8038fb:	00 00                	add    %al,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 11                	add    %dl,(%rcx)
+  803901:	04 80                	add    $0x80,%al
+  803903:	00 00                	add    %al,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 11                	add    %dl,(%rcx)
+  803909:	04 80                	add    $0x80,%al
+  80390b:	00 00                	add    %al,(%rax)
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 11                	add    %dl,(%rcx)
+  803911:	04 80                	add    $0x80,%al
+  803913:	00 00                	add    %al,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 f9                	add    %bh,%cl
+  803919:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80391f:	00 f9                	add    %bh,%cl
+  803921:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803927:	00 f9                	add    %bh,%cl
+  803929:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80392f:	00 f9                	add    %bh,%cl
+  803931:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803937:	00 f9                	add    %bh,%cl
+  803939:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80393f:	00 f9                	add    %bh,%cl
+  803941:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803947:	00 f9                	add    %bh,%cl
+  803949:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80394f:	00 f9                	add    %bh,%cl
+  803951:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803957:	00 f9                	add    %bh,%cl
+  803959:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80395f:	00 f9                	add    %bh,%cl
+  803961:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803967:	00 f9                	add    %bh,%cl
+  803969:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80396f:	00 f9                	add    %bh,%cl
+  803971:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803977:	00 f9                	add    %bh,%cl
+  803979:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80397f:	00 f9                	add    %bh,%cl
+  803981:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803987:	00 f9                	add    %bh,%cl
+  803989:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80398f:	00 f9                	add    %bh,%cl
+  803991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803997:	00 f9                	add    %bh,%cl
+  803999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80399f:	00 f9                	add    %bh,%cl
+  8039a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039a7:	00 f9                	add    %bh,%cl
+  8039a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039af:	00 f9                	add    %bh,%cl
+  8039b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039b7:	00 f9                	add    %bh,%cl
+  8039b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039bf:	00 f9                	add    %bh,%cl
+  8039c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039c7:	00 f9                	add    %bh,%cl
+  8039c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039cf:	00 f9                	add    %bh,%cl
+  8039d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039d7:	00 f9                	add    %bh,%cl
+  8039d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039df:	00 f9                	add    %bh,%cl
+  8039e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039e7:	00 f9                	add    %bh,%cl
+  8039e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ef:	00 f9                	add    %bh,%cl
+  8039f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039f7:	00 f9                	add    %bh,%cl
+  8039f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ff:	00 f9                	add    %bh,%cl
+  803a01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a07:	00 1c 09             	add    %bl,(%rcx,%rcx,1)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 f9                	add    %bh,%cl
+  803a11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a17:	00 f9                	add    %bh,%cl
+  803a19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a1f:	00 f9                	add    %bh,%cl
+  803a21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a27:	00 f9                	add    %bh,%cl
+  803a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a2f:	00 f9                	add    %bh,%cl
+  803a31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a37:	00 f9                	add    %bh,%cl
+  803a39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a3f:	00 f9                	add    %bh,%cl
+  803a41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a47:	00 f9                	add    %bh,%cl
+  803a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a4f:	00 f9                	add    %bh,%cl
+  803a51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a57:	00 f9                	add    %bh,%cl
+  803a59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a5f:	00 68 04             	add    %ch,0x4(%rax)
+  803a62:	80 00 00             	addb   $0x0,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 37                	add    %dh,(%rdi)
+  803a69:	06                   	(bad)
+  803a6a:	80 00 00             	addb   $0x0,(%rax)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 f9                	add    %bh,%cl
+  803a71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a77:	00 f9                	add    %bh,%cl
+  803a79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a7f:	00 f9                	add    %bh,%cl
+  803a81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a87:	00 f9                	add    %bh,%cl
+  803a89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a8f:	00 97 04 80 00 00    	add    %dl,0x8004(%rdi)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 f9                	add    %bh,%cl
+  803a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a9f:	00 f9                	add    %bh,%cl
+  803aa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aa7:	00 5d 04             	add    %bl,0x4(%rbp)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 f9                	add    %bh,%cl
+  803ab1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ab7:	00 f9                	add    %bh,%cl
+  803ab9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803abf:	00 df                	add    %bl,%bh
+  803ac1:	07                   	(bad)
+  803ac2:	80 00 00             	addb   $0x0,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 a9 08 80 00 00    	add    %ch,0x8008(%rcx)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 f9                	add    %bh,%cl
+  803ad1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ad7:	00 f9                	add    %bh,%cl
+  803ad9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803adf:	00 2e                	add    %ch,(%rsi)
+  803ae1:	05 80 00 00 00       	add    $0x80,%eax
+  803ae6:	00 00                	add    %al,(%rax)
+  803ae8:	f9                   	stc
+  803ae9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aef:	00 0b                	add    %cl,(%rbx)
+  803af1:	07                   	(bad)
+  803af2:	80 00 00             	addb   $0x0,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 f9                	add    %bh,%cl
+  803af9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aff:	00 f9                	add    %bh,%cl
+  803b01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b07:	00 1c 09             	add    %bl,(%rcx,%rcx,1)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 f9                	add    %bh,%cl
+  803b11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b17:	00 c1                	add    %al,%cl
+  803b19:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803b20 <error_string>:
+	...
+  803b28:	f2 36 80 00 00 00 00 00 04 37 80 00 00 00 00 00     .6.......7......
+  803b38:	14 37 80 00 00 00 00 00 26 37 80 00 00 00 00 00     .7......&7......
+  803b48:	34 37 80 00 00 00 00 00 48 37 80 00 00 00 00 00     47......H7......
+  803b58:	5d 37 80 00 00 00 00 00 70 37 80 00 00 00 00 00     ]7......p7......
+  803b68:	82 37 80 00 00 00 00 00 96 37 80 00 00 00 00 00     .7.......7......
+  803b78:	a6 37 80 00 00 00 00 00 b9 37 80 00 00 00 00 00     .7.......7......
+  803b88:	d0 37 80 00 00 00 00 00 e6 37 80 00 00 00 00 00     .7.......7......
+  803b98:	fe 37 80 00 00 00 00 00 16 38 80 00 00 00 00 00     .7.......8......
+  803ba8:	23 38 80 00 00 00 00 00 c8 3b 80 00 00 00 00 00     #8.......;......
+  803bb8:	37 38 80 00 00 00 00 00 4f 38 80 00 00 00 00 00     78......O8......
+  803bc8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803bd8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803be8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803bf8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803c08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803c18:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c28:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c38:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c48:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c58:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c68:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c78:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803c88:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803c98:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803ca8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cb8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803cc0 <devtab>:
+  803cc0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803cd0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803ce0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803cf0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803d00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803d10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803d60:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803d70:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,6886 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf a0 36 80 00 00 	movabs $0x8036a0,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba d0 01 80 00 00 	movabs $0x8001d0,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	41 89 fd             	mov    %edi,%r13d
+  800060:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80006a:	00 00 00 
+  80006d:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800074:	00 00 00 
+  800077:	48 39 c2             	cmp    %rax,%rdx
+  80007a:	73 17                	jae    800093 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	49 89 c4             	mov    %rax,%r12
+  800082:	48 83 c3 08          	add    $0x8,%rbx
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	ff 53 f8             	call   *-0x8(%rbx)
+  80008e:	4c 39 e3             	cmp    %r12,%rbx
+  800091:	72 ef                	jb     800082 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800093:	48 b8 c1 10 80 00 00 	movabs $0x8010c1,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000a8:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000ac:	48 c1 e0 04          	shl    $0x4,%rax
+  8000b0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b7:	00 00 00 
+  8000ba:	48 01 d0             	add    %rdx,%rax
+  8000bd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000c4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c7:	45 85 ed             	test   %r13d,%r13d
+  8000ca:	7e 0d                	jle    8000d9 <libmain+0x87>
+  8000cc:	49 8b 06             	mov    (%r14),%rax
+  8000cf:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000d6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d9:	4c 89 f6             	mov    %r14,%rsi
+  8000dc:	44 89 ef             	mov    %r13d,%edi
+  8000df:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000eb:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+#endif
+}
+  8000f7:	5b                   	pop    %rbx
+  8000f8:	41 5c                	pop    %r12
+  8000fa:	41 5d                	pop    %r13
+  8000fc:	41 5e                	pop    %r14
+  8000fe:	5d                   	pop    %rbp
+  8000ff:	c3                   	ret
+
+0000000000800100 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800100:	55                   	push   %rbp
+  800101:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800104:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800110:	bf 00 00 00 00       	mov    $0x0,%edi
+  800115:	48 b8 56 10 80 00 00 	movabs $0x801056,%rax
+  80011c:	00 00 00 
+  80011f:	ff d0                	call   *%rax
+}
+  800121:	5d                   	pop    %rbp
+  800122:	c3                   	ret
+
+0000000000800123 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800123:	55                   	push   %rbp
+  800124:	48 89 e5             	mov    %rsp,%rbp
+  800127:	53                   	push   %rbx
+  800128:	48 83 ec 08          	sub    $0x8,%rsp
+  80012c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012f:	8b 06                	mov    (%rsi),%eax
+  800131:	8d 50 01             	lea    0x1(%rax),%edx
+  800134:	89 16                	mov    %edx,(%rsi)
+  800136:	48 98                	cltq
+  800138:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80013d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800143:	74 0a                	je     80014f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800145:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800153:	be ff 00 00 00       	mov    $0xff,%esi
+  800158:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  80015f:	00 00 00 
+  800162:	ff d0                	call   *%rax
+        state->offset = 0;
+  800164:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80016a:	eb d9                	jmp    800145 <putch+0x22>
+
+000000000080016c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80016c:	55                   	push   %rbp
+  80016d:	48 89 e5             	mov    %rsp,%rbp
+  800170:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800177:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80017a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800181:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80018e:	48 89 f1             	mov    %rsi,%rcx
+  800191:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800198:	48 bf 23 01 80 00 00 	movabs $0x800123,%rdi
+  80019f:	00 00 00 
+  8001a2:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  8001a9:	00 00 00 
+  8001ac:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ae:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001bc:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001ce:	c9                   	leave
+  8001cf:	c3                   	ret
+
+00000000008001d0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+  8001d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001dc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001ec:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800203:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800207:	48 b8 6c 01 80 00 00 	movabs $0x80016c,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800213:	c9                   	leave
+  800214:	c3                   	ret
+
+0000000000800215 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800215:	55                   	push   %rbp
+  800216:	48 89 e5             	mov    %rsp,%rbp
+  800219:	41 57                	push   %r15
+  80021b:	41 56                	push   %r14
+  80021d:	41 55                	push   %r13
+  80021f:	41 54                	push   %r12
+  800221:	53                   	push   %rbx
+  800222:	48 83 ec 18          	sub    $0x18,%rsp
+  800226:	49 89 fc             	mov    %rdi,%r12
+  800229:	49 89 f5             	mov    %rsi,%r13
+  80022c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800230:	8b 45 10             	mov    0x10(%rbp),%eax
+  800233:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800236:	41 89 cf             	mov    %ecx,%r15d
+  800239:	4c 39 fa             	cmp    %r15,%rdx
+  80023c:	73 5b                	jae    800299 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80023e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800242:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800246:	85 db                	test   %ebx,%ebx
+  800248:	7e 0e                	jle    800258 <print_num+0x43>
+            putch(padc, put_arg);
+  80024a:	4c 89 ee             	mov    %r13,%rsi
+  80024d:	44 89 f7             	mov    %r14d,%edi
+  800250:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800253:	83 eb 01             	sub    $0x1,%ebx
+  800256:	75 f2                	jne    80024a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800258:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80025c:	48 b9 e4 36 80 00 00 	movabs $0x8036e4,%rcx
+  800263:	00 00 00 
+  800266:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  80026d:	00 00 00 
+  800270:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800274:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027d:	49 f7 f7             	div    %r15
+  800280:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800284:	4c 89 ee             	mov    %r13,%rsi
+  800287:	41 ff d4             	call   *%r12
+}
+  80028a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80028e:	5b                   	pop    %rbx
+  80028f:	41 5c                	pop    %r12
+  800291:	41 5d                	pop    %r13
+  800293:	41 5e                	pop    %r14
+  800295:	41 5f                	pop    %r15
+  800297:	5d                   	pop    %rbp
+  800298:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800299:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80029d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a2:	49 f7 f7             	div    %r15
+  8002a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002ad:	52                   	push   %rdx
+  8002ae:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b6:	48 89 c2             	mov    %rax,%rdx
+  8002b9:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+  8002c5:	48 83 c4 10          	add    $0x10,%rsp
+  8002c9:	eb 8d                	jmp    800258 <print_num+0x43>
+
+00000000008002cb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002cb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002cf:	48 8b 06             	mov    (%rsi),%rax
+  8002d2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d6:	73 0a                	jae    8002e2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002dc:	48 89 16             	mov    %rdx,(%rsi)
+  8002df:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e2:	c3                   	ret
+
+00000000008002e3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8002eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800302:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800306:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80030a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80030e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800312:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800319:	00 00 00 
+  80031c:	ff d0                	call   *%rax
+}
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+0000000000800320 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800320:	55                   	push   %rbp
+  800321:	48 89 e5             	mov    %rsp,%rbp
+  800324:	41 57                	push   %r15
+  800326:	41 56                	push   %r14
+  800328:	41 55                	push   %r13
+  80032a:	41 54                	push   %r12
+  80032c:	53                   	push   %rbx
+  80032d:	48 83 ec 38          	sub    $0x38,%rsp
+  800331:	49 89 fe             	mov    %rdi,%r14
+  800334:	49 89 f5             	mov    %rsi,%r13
+  800337:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80033a:	48 8b 01             	mov    (%rcx),%rax
+  80033d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800341:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800345:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800349:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80034d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800351:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800355:	0f b6 3b             	movzbl (%rbx),%edi
+  800358:	40 80 ff 25          	cmp    $0x25,%dil
+  80035c:	74 18                	je     800376 <vprintfmt+0x56>
+            if (!ch) return;
+  80035e:	40 84 ff             	test   %dil,%dil
+  800361:	0f 84 b1 06 00 00    	je     800a18 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800367:	40 0f b6 ff          	movzbl %dil,%edi
+  80036b:	4c 89 ee             	mov    %r13,%rsi
+  80036e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800371:	4c 89 e3             	mov    %r12,%rbx
+  800374:	eb db                	jmp    800351 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800376:	be 00 00 00 00       	mov    $0x0,%esi
+  80037b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800384:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80038a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800391:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800395:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80039a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a2:	83 e8 23             	sub    $0x23,%eax
+  8003a5:	3c 57                	cmp    $0x57,%al
+  8003a7:	0f 87 51 06 00 00    	ja     8009fe <vprintfmt+0x6de>
+  8003ad:	0f b6 c0             	movzbl %al,%eax
+  8003b0:	48 b9 80 38 80 00 00 	movabs $0x803880,%rcx
+  8003b7:	00 00 00 
+  8003ba:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003bd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003c4:	eb cf                	jmp    800395 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c6:	49 89 dc             	mov    %rbx,%r12
+  8003c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ce:	eb c5                	jmp    800395 <vprintfmt+0x75>
+            padc = ch;
+  8003d0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003d4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003da:	eb b9                	jmp    800395 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003df:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e2:	77 24                	ja     800408 <vprintfmt+0xe8>
+  8003e4:	89 c1                	mov    %eax,%ecx
+  8003e6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003ea:	83 c0 08             	add    $0x8,%eax
+  8003ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003fa:	79 99                	jns    800395 <vprintfmt+0x75>
+                width = precision;
+  8003fc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800400:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800406:	eb 8d                	jmp    800395 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800408:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80040c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800410:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800414:	eb da                	jmp    8003f0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800416:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80041b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800425:	3c 39                	cmp    $0x39,%al
+  800427:	77 1c                	ja     800445 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800429:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80042d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800431:	0f b6 c0             	movzbl %al,%eax
+  800434:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800439:	0f b6 03             	movzbl (%rbx),%eax
+  80043c:	3c 39                	cmp    $0x39,%al
+  80043e:	76 e9                	jbe    800429 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800443:	eb b1                	jmp    8003f6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800445:	49 89 dc             	mov    %rbx,%r12
+  800448:	eb ac                	jmp    8003f6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80044a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80044d:	85 c9                	test   %ecx,%ecx
+  80044f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800454:	0f 49 c1             	cmovns %ecx,%eax
+  800457:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80045a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045d:	e9 33 ff ff ff       	jmp    800395 <vprintfmt+0x75>
+            lflag++;
+  800462:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800465:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800468:	e9 28 ff ff ff       	jmp    800395 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80046d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800470:	83 f8 2f             	cmp    $0x2f,%eax
+  800473:	77 19                	ja     80048e <vprintfmt+0x16e>
+  800475:	89 c2                	mov    %eax,%edx
+  800477:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80047b:	83 c0 08             	add    $0x8,%eax
+  80047e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800481:	8b 3a                	mov    (%rdx),%edi
+  800483:	4c 89 ee             	mov    %r13,%rsi
+  800486:	41 ff d6             	call   *%r14
+            break;
+  800489:	e9 c3 fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80048e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800492:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800496:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049a:	eb e5                	jmp    800481 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80049c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049f:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a2:	77 5a                	ja     8004fe <vprintfmt+0x1de>
+  8004a4:	89 c2                	mov    %eax,%edx
+  8004a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004aa:	83 c0 08             	add    $0x8,%eax
+  8004ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b0:	8b 02                	mov    (%rdx),%eax
+  8004b2:	89 c1                	mov    %eax,%ecx
+  8004b4:	f7 d9                	neg    %ecx
+  8004b6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b9:	83 f9 14             	cmp    $0x14,%ecx
+  8004bc:	7f 4e                	jg     80050c <vprintfmt+0x1ec>
+  8004be:	48 63 c1             	movslq %ecx,%rax
+  8004c1:	48 ba 40 3b 80 00 00 	movabs $0x803b40,%rdx
+  8004c8:	00 00 00 
+  8004cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	74 38                	je     80050c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004d4:	48 89 c1             	mov    %rax,%rcx
+  8004d7:	48 ba 19 3d 80 00 00 	movabs $0x803d19,%rdx
+  8004de:	00 00 00 
+  8004e1:	4c 89 ee             	mov    %r13,%rsi
+  8004e4:	4c 89 f7             	mov    %r14,%rdi
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	49 b8 e3 02 80 00 00 	movabs $0x8002e3,%r8
+  8004f3:	00 00 00 
+  8004f6:	41 ff d0             	call   *%r8
+  8004f9:	e9 53 fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800502:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	eb a4                	jmp    8004b0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80050c:	48 ba fc 36 80 00 00 	movabs $0x8036fc,%rdx
+  800513:	00 00 00 
+  800516:	4c 89 ee             	mov    %r13,%rsi
+  800519:	4c 89 f7             	mov    %r14,%rdi
+  80051c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800521:	49 b8 e3 02 80 00 00 	movabs $0x8002e3,%r8
+  800528:	00 00 00 
+  80052b:	41 ff d0             	call   *%r8
+  80052e:	e9 1e fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800533:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800536:	83 f8 2f             	cmp    $0x2f,%eax
+  800539:	77 6c                	ja     8005a7 <vprintfmt+0x287>
+  80053b:	89 c2                	mov    %eax,%edx
+  80053d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800541:	83 c0 08             	add    $0x8,%eax
+  800544:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800547:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80054a:	48 85 d2             	test   %rdx,%rdx
+  80054d:	48 b8 f5 36 80 00 00 	movabs $0x8036f5,%rax
+  800554:	00 00 00 
+  800557:	48 0f 45 c2          	cmovne %rdx,%rax
+  80055b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800563:	7e 06                	jle    80056b <vprintfmt+0x24b>
+  800565:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800569:	75 4a                	jne    8005b5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80056b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80056f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800573:	0f b6 00             	movzbl (%rax),%eax
+  800576:	84 c0                	test   %al,%al
+  800578:	0f 85 9a 00 00 00    	jne    800618 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80057e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800581:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800585:	85 c0                	test   %eax,%eax
+  800587:	0f 8e c4 fd ff ff    	jle    800351 <vprintfmt+0x31>
+  80058d:	4c 89 ee             	mov    %r13,%rsi
+  800590:	bf 20 00 00 00       	mov    $0x20,%edi
+  800595:	41 ff d6             	call   *%r14
+  800598:	41 83 ec 01          	sub    $0x1,%r12d
+  80059c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a0:	75 eb                	jne    80058d <vprintfmt+0x26d>
+  8005a2:	e9 aa fd ff ff       	jmp    800351 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b3:	eb 92                	jmp    800547 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b5:	49 63 f7             	movslq %r15d,%rsi
+  8005b8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005bc:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  8005c3:	00 00 00 
+  8005c6:	ff d0                	call   *%rax
+  8005c8:	48 89 c2             	mov    %rax,%rdx
+  8005cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ce:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005d6:	85 c0                	test   %eax,%eax
+  8005d8:	7e 91                	jle    80056b <vprintfmt+0x24b>
+  8005da:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005df:	4c 89 ee             	mov    %r13,%rsi
+  8005e2:	44 89 e7             	mov    %r12d,%edi
+  8005e5:	41 ff d6             	call   *%r14
+  8005e8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ec:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f2:	75 eb                	jne    8005df <vprintfmt+0x2bf>
+  8005f4:	e9 72 ff ff ff       	jmp    80056b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f9:	0f b6 f8             	movzbl %al,%edi
+  8005fc:	4c 89 ee             	mov    %r13,%rsi
+  8005ff:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800602:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800606:	49 83 c4 01          	add    $0x1,%r12
+  80060a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800610:	84 c0                	test   %al,%al
+  800612:	0f 84 66 ff ff ff    	je     80057e <vprintfmt+0x25e>
+  800618:	45 85 ff             	test   %r15d,%r15d
+  80061b:	78 0a                	js     800627 <vprintfmt+0x307>
+  80061d:	41 83 ef 01          	sub    $0x1,%r15d
+  800621:	0f 88 57 ff ff ff    	js     80057e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800627:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80062b:	74 cc                	je     8005f9 <vprintfmt+0x2d9>
+  80062d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800630:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800635:	80 fa 5e             	cmp    $0x5e,%dl
+  800638:	77 c2                	ja     8005fc <vprintfmt+0x2dc>
+  80063a:	eb bd                	jmp    8005f9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80063c:	40 84 f6             	test   %sil,%sil
+  80063f:	75 26                	jne    800667 <vprintfmt+0x347>
+    switch (lflag) {
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 59                	je     80069e <vprintfmt+0x37e>
+  800645:	83 fa 01             	cmp    $0x1,%edx
+  800648:	74 7b                	je     8006c5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80064a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064d:	83 f8 2f             	cmp    $0x2f,%eax
+  800650:	0f 87 96 00 00 00    	ja     8006ec <vprintfmt+0x3cc>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065c:	83 c0 08             	add    $0x8,%eax
+  80065f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800662:	4c 8b 22             	mov    (%rdx),%r12
+  800665:	eb 17                	jmp    80067e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800667:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066a:	83 f8 2f             	cmp    $0x2f,%eax
+  80066d:	77 21                	ja     800690 <vprintfmt+0x370>
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800675:	83 c0 08             	add    $0x8,%eax
+  800678:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80067e:	4d 85 e4             	test   %r12,%r12
+  800681:	78 7a                	js     8006fd <vprintfmt+0x3dd>
+            num = i;
+  800683:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80068b:	e9 50 02 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800690:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800694:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb dd                	jmp    80067b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80069e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a4:	77 11                	ja     8006b7 <vprintfmt+0x397>
+  8006a6:	89 c2                	mov    %eax,%edx
+  8006a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ac:	83 c0 08             	add    $0x8,%eax
+  8006af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b2:	4c 63 22             	movslq (%rdx),%r12
+  8006b5:	eb c7                	jmp    80067e <vprintfmt+0x35e>
+  8006b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c3:	eb ed                	jmp    8006b2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cb:	77 11                	ja     8006de <vprintfmt+0x3be>
+  8006cd:	89 c2                	mov    %eax,%edx
+  8006cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d3:	83 c0 08             	add    $0x8,%eax
+  8006d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d9:	4c 8b 22             	mov    (%rdx),%r12
+  8006dc:	eb a0                	jmp    80067e <vprintfmt+0x35e>
+  8006de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ea:	eb ed                	jmp    8006d9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	e9 65 ff ff ff       	jmp    800662 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006fd:	4c 89 ee             	mov    %r13,%rsi
+  800700:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800705:	41 ff d6             	call   *%r14
+                i = -i;
+  800708:	49 f7 dc             	neg    %r12
+  80070b:	e9 73 ff ff ff       	jmp    800683 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800710:	40 84 f6             	test   %sil,%sil
+  800713:	75 32                	jne    800747 <vprintfmt+0x427>
+    switch (lflag) {
+  800715:	85 d2                	test   %edx,%edx
+  800717:	74 5d                	je     800776 <vprintfmt+0x456>
+  800719:	83 fa 01             	cmp    $0x1,%edx
+  80071c:	0f 84 82 00 00 00    	je     8007a4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800722:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800725:	83 f8 2f             	cmp    $0x2f,%eax
+  800728:	0f 87 a5 00 00 00    	ja     8007d3 <vprintfmt+0x4b3>
+  80072e:	89 c2                	mov    %eax,%edx
+  800730:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800734:	83 c0 08             	add    $0x8,%eax
+  800737:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80073d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800742:	e9 99 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800747:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074a:	83 f8 2f             	cmp    $0x2f,%eax
+  80074d:	77 19                	ja     800768 <vprintfmt+0x448>
+  80074f:	89 c2                	mov    %eax,%edx
+  800751:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800755:	83 c0 08             	add    $0x8,%eax
+  800758:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80075e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800763:	e9 78 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800768:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800770:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800774:	eb e5                	jmp    80075b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800776:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800779:	83 f8 2f             	cmp    $0x2f,%eax
+  80077c:	77 18                	ja     800796 <vprintfmt+0x476>
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800784:	83 c0 08             	add    $0x8,%eax
+  800787:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80078c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800791:	e9 4a 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800796:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a2:	eb e6                	jmp    80078a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	77 19                	ja     8007c5 <vprintfmt+0x4a5>
+  8007ac:	89 c2                	mov    %eax,%edx
+  8007ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b2:	83 c0 08             	add    $0x8,%eax
+  8007b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c0:	e9 1b 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  8007c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d1:	eb e5                	jmp    8007b8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	e9 56 ff ff ff       	jmp    80073a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e4:	40 84 f6             	test   %sil,%sil
+  8007e7:	75 2e                	jne    800817 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	74 59                	je     800846 <vprintfmt+0x526>
+  8007ed:	83 fa 01             	cmp    $0x1,%edx
+  8007f0:	74 7f                	je     800871 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	0f 87 9f 00 00 00    	ja     80089d <vprintfmt+0x57d>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80080d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800812:	e9 c9 00 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 19                	ja     800838 <vprintfmt+0x518>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80082e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800833:	e9 a8 00 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800844:	eb e5                	jmp    80082b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 15                	ja     800863 <vprintfmt+0x543>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80085c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800861:	eb 7d                	jmp    8008e0 <vprintfmt+0x5c0>
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb e9                	jmp    80085a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 16                	ja     80088f <vprintfmt+0x56f>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800888:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80088d:	eb 51                	jmp    8008e0 <vprintfmt+0x5c0>
+  80088f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089b:	eb e8                	jmp    800885 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	e9 5c ff ff ff       	jmp    80080a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ae:	4c 89 ee             	mov    %r13,%rsi
+  8008b1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008b6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	77 47                	ja     800913 <vprintfmt+0x5f3>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008db:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e8:	0f 94 c0             	sete   %al
+  8008eb:	0f b6 c0             	movzbl %al,%eax
+  8008ee:	50                   	push   %rax
+  8008ef:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008f4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f8:	4c 89 ee             	mov    %r13,%rsi
+  8008fb:	4c 89 f7             	mov    %r14,%rdi
+  8008fe:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  800905:	00 00 00 
+  800908:	ff d0                	call   *%rax
+            break;
+  80090a:	48 83 c4 10          	add    $0x10,%rsp
+  80090e:	e9 3e fa ff ff       	jmp    800351 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800913:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800917:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091f:	eb b7                	jmp    8008d8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800921:	40 84 f6             	test   %sil,%sil
+  800924:	75 2b                	jne    800951 <vprintfmt+0x631>
+    switch (lflag) {
+  800926:	85 d2                	test   %edx,%edx
+  800928:	74 56                	je     800980 <vprintfmt+0x660>
+  80092a:	83 fa 01             	cmp    $0x1,%edx
+  80092d:	74 7f                	je     8009ae <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	0f 87 a2 00 00 00    	ja     8009dd <vprintfmt+0x6bd>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80094a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094f:	eb 8f                	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800954:	83 f8 2f             	cmp    $0x2f,%eax
+  800957:	77 19                	ja     800972 <vprintfmt+0x652>
+  800959:	89 c2                	mov    %eax,%edx
+  80095b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095f:	83 c0 08             	add    $0x8,%eax
+  800962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800965:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800968:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096d:	e9 6e ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	eb e5                	jmp    800965 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 18                	ja     8009a0 <vprintfmt+0x680>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800996:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80099b:	e9 40 ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  8009a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ac:	eb e6                	jmp    800994 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b4:	77 19                	ja     8009cf <vprintfmt+0x6af>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ca:	e9 11 ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  8009cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009db:	eb e5                	jmp    8009c2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	e9 59 ff ff ff       	jmp    800947 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009ee:	4c 89 ee             	mov    %r13,%rsi
+  8009f1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f6:	41 ff d6             	call   *%r14
+            break;
+  8009f9:	e9 53 f9 ff ff       	jmp    800351 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009fe:	4c 89 ee             	mov    %r13,%rsi
+  800a01:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a06:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a09:	48 83 eb 01          	sub    $0x1,%rbx
+  800a0d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a11:	75 f6                	jne    800a09 <vprintfmt+0x6e9>
+  800a13:	e9 39 f9 ff ff       	jmp    800351 <vprintfmt+0x31>
+}
+  800a18:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a1c:	5b                   	pop    %rbx
+  800a1d:	41 5c                	pop    %r12
+  800a1f:	41 5d                	pop    %r13
+  800a21:	41 5e                	pop    %r14
+  800a23:	41 5f                	pop    %r15
+  800a25:	5d                   	pop    %rbp
+  800a26:	c3                   	ret
+
+0000000000800a27 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a27:	55                   	push   %rbp
+  800a28:	48 89 e5             	mov    %rsp,%rbp
+  800a2b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a33:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a3c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a43:	48 85 ff             	test   %rdi,%rdi
+  800a46:	74 2b                	je     800a73 <vsnprintf+0x4c>
+  800a48:	48 85 f6             	test   %rsi,%rsi
+  800a4b:	74 26                	je     800a73 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a4d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a51:	48 bf cb 02 80 00 00 	movabs $0x8002cb,%rdi
+  800a58:	00 00 00 
+  800a5b:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800a62:	00 00 00 
+  800a65:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a6b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a71:	c9                   	leave
+  800a72:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a78:	eb f7                	jmp    800a71 <vsnprintf+0x4a>
+
+0000000000800a7a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a7a:	55                   	push   %rbp
+  800a7b:	48 89 e5             	mov    %rsp,%rbp
+  800a7e:	48 83 ec 50          	sub    $0x50,%rsp
+  800a82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a8e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa9:	48 b8 27 0a 80 00 00 	movabs $0x800a27,%rax
+  800ab0:	00 00 00 
+  800ab3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+
+0000000000800ab7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aba:	74 10                	je     800acc <strlen+0x15>
+    size_t n = 0;
+  800abc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac1:	48 83 c0 01          	add    $0x1,%rax
+  800ac5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac9:	75 f6                	jne    800ac1 <strlen+0xa>
+  800acb:	c3                   	ret
+    size_t n = 0;
+  800acc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad1:	c3                   	ret
+
+0000000000800ad2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ada:	48 85 f6             	test   %rsi,%rsi
+  800add:	74 11                	je     800af0 <strnlen+0x1e>
+  800adf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae3:	74 0c                	je     800af1 <strnlen+0x1f>
+  800ae5:	48 83 c2 01          	add    $0x1,%rdx
+  800ae9:	48 39 d0             	cmp    %rdx,%rax
+  800aec:	75 f1                	jne    800adf <strnlen+0xd>
+  800aee:	eb 04                	jmp    800af4 <strnlen+0x22>
+  800af0:	c3                   	ret
+  800af1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800af4:	c3                   	ret
+
+0000000000800af5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b01:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b04:	48 83 c2 01          	add    $0x1,%rdx
+  800b08:	84 c9                	test   %cl,%cl
+  800b0a:	75 f1                	jne    800afd <strcpy+0x8>
+        ;
+    return res;
+}
+  800b0c:	c3                   	ret
+
+0000000000800b0d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b0d:	55                   	push   %rbp
+  800b0e:	48 89 e5             	mov    %rsp,%rbp
+  800b11:	41 54                	push   %r12
+  800b13:	53                   	push   %rbx
+  800b14:	48 89 fb             	mov    %rdi,%rbx
+  800b17:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b1a:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800b21:	00 00 00 
+  800b24:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b26:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b2a:	4c 89 e6             	mov    %r12,%rsi
+  800b2d:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+    return dst;
+}
+  800b39:	48 89 d8             	mov    %rbx,%rax
+  800b3c:	5b                   	pop    %rbx
+  800b3d:	41 5c                	pop    %r12
+  800b3f:	5d                   	pop    %rbp
+  800b40:	c3                   	ret
+
+0000000000800b41 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b41:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b44:	48 85 d2             	test   %rdx,%rdx
+  800b47:	74 1f                	je     800b68 <strncpy+0x27>
+  800b49:	48 01 fa             	add    %rdi,%rdx
+  800b4c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b4f:	48 83 c1 01          	add    $0x1,%rcx
+  800b53:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b57:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b5b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b63:	48 39 ca             	cmp    %rcx,%rdx
+  800b66:	75 e7                	jne    800b4f <strncpy+0xe>
+    }
+    return ret;
+}
+  800b68:	c3                   	ret
+
+0000000000800b69 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b69:	48 89 f8             	mov    %rdi,%rax
+  800b6c:	48 85 d2             	test   %rdx,%rdx
+  800b6f:	74 24                	je     800b95 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b71:	48 83 ea 01          	sub    $0x1,%rdx
+  800b75:	74 1b                	je     800b92 <strlcpy+0x29>
+  800b77:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b7b:	0f b6 16             	movzbl (%rsi),%edx
+  800b7e:	84 d2                	test   %dl,%dl
+  800b80:	74 10                	je     800b92 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b82:	48 83 c6 01          	add    $0x1,%rsi
+  800b86:	48 83 c0 01          	add    $0x1,%rax
+  800b8a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b8d:	48 39 c8             	cmp    %rcx,%rax
+  800b90:	75 e9                	jne    800b7b <strlcpy+0x12>
+        *dst = '\0';
+  800b92:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b95:	48 29 f8             	sub    %rdi,%rax
+}
+  800b98:	c3                   	ret
+
+0000000000800b99 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b99:	0f b6 07             	movzbl (%rdi),%eax
+  800b9c:	84 c0                	test   %al,%al
+  800b9e:	74 13                	je     800bb3 <strcmp+0x1a>
+  800ba0:	38 06                	cmp    %al,(%rsi)
+  800ba2:	75 0f                	jne    800bb3 <strcmp+0x1a>
+  800ba4:	48 83 c7 01          	add    $0x1,%rdi
+  800ba8:	48 83 c6 01          	add    $0x1,%rsi
+  800bac:	0f b6 07             	movzbl (%rdi),%eax
+  800baf:	84 c0                	test   %al,%al
+  800bb1:	75 ed                	jne    800ba0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb3:	0f b6 c0             	movzbl %al,%eax
+  800bb6:	0f b6 16             	movzbl (%rsi),%edx
+  800bb9:	29 d0                	sub    %edx,%eax
+}
+  800bbb:	c3                   	ret
+
+0000000000800bbc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bbc:	48 85 d2             	test   %rdx,%rdx
+  800bbf:	74 1f                	je     800be0 <strncmp+0x24>
+  800bc1:	0f b6 07             	movzbl (%rdi),%eax
+  800bc4:	84 c0                	test   %al,%al
+  800bc6:	74 1e                	je     800be6 <strncmp+0x2a>
+  800bc8:	3a 06                	cmp    (%rsi),%al
+  800bca:	75 1a                	jne    800be6 <strncmp+0x2a>
+  800bcc:	48 83 c7 01          	add    $0x1,%rdi
+  800bd0:	48 83 c6 01          	add    $0x1,%rsi
+  800bd4:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd8:	75 e7                	jne    800bc1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdf:	c3                   	ret
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be5:	c3                   	ret
+  800be6:	48 85 d2             	test   %rdx,%rdx
+  800be9:	74 09                	je     800bf4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800beb:	0f b6 07             	movzbl (%rdi),%eax
+  800bee:	0f b6 16             	movzbl (%rsi),%edx
+  800bf1:	29 d0                	sub    %edx,%eax
+  800bf3:	c3                   	ret
+    if (!n) return 0;
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf9:	c3                   	ret
+
+0000000000800bfa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bfa:	0f b6 17             	movzbl (%rdi),%edx
+  800bfd:	84 d2                	test   %dl,%dl
+  800bff:	74 18                	je     800c19 <strchr+0x1f>
+        if (*str == c) {
+  800c01:	0f be d2             	movsbl %dl,%edx
+  800c04:	39 f2                	cmp    %esi,%edx
+  800c06:	74 17                	je     800c1f <strchr+0x25>
+    for (; *str; str++) {
+  800c08:	48 83 c7 01          	add    $0x1,%rdi
+  800c0c:	0f b6 17             	movzbl (%rdi),%edx
+  800c0f:	84 d2                	test   %dl,%dl
+  800c11:	75 ee                	jne    800c01 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	c3                   	ret
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1e:	c3                   	ret
+  800c1f:	48 89 f8             	mov    %rdi,%rax
+}
+  800c22:	c3                   	ret
+
+0000000000800c23 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c23:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c26:	0f b6 17             	movzbl (%rdi),%edx
+  800c29:	84 d2                	test   %dl,%dl
+  800c2b:	74 13                	je     800c40 <strfind+0x1d>
+  800c2d:	0f be d2             	movsbl %dl,%edx
+  800c30:	39 f2                	cmp    %esi,%edx
+  800c32:	74 0b                	je     800c3f <strfind+0x1c>
+  800c34:	48 83 c0 01          	add    $0x1,%rax
+  800c38:	0f b6 10             	movzbl (%rax),%edx
+  800c3b:	84 d2                	test   %dl,%dl
+  800c3d:	75 ee                	jne    800c2d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c3f:	c3                   	ret
+  800c40:	c3                   	ret
+
+0000000000800c41 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c41:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c44:	48 89 f8             	mov    %rdi,%rax
+  800c47:	48 f7 d8             	neg    %rax
+  800c4a:	83 e0 07             	and    $0x7,%eax
+  800c4d:	49 89 d1             	mov    %rdx,%r9
+  800c50:	49 29 c1             	sub    %rax,%r9
+  800c53:	78 36                	js     800c8b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c55:	40 0f b6 c6          	movzbl %sil,%eax
+  800c59:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c60:	01 01 01 
+  800c63:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c67:	40 f6 c7 07          	test   $0x7,%dil
+  800c6b:	75 38                	jne    800ca5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c6d:	4c 89 c9             	mov    %r9,%rcx
+  800c70:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c74:	74 0c                	je     800c82 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c76:	fc                   	cld
+  800c77:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c7a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c7e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c82:	4d 85 c9             	test   %r9,%r9
+  800c85:	75 45                	jne    800ccc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c87:	4c 89 c0             	mov    %r8,%rax
+  800c8a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c8b:	48 85 d2             	test   %rdx,%rdx
+  800c8e:	74 f7                	je     800c87 <memset+0x46>
+  800c90:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c93:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c96:	48 83 c0 01          	add    $0x1,%rax
+  800c9a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c9e:	48 39 c2             	cmp    %rax,%rdx
+  800ca1:	75 f3                	jne    800c96 <memset+0x55>
+  800ca3:	eb e2                	jmp    800c87 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca5:	40 f6 c7 01          	test   $0x1,%dil
+  800ca9:	74 06                	je     800cb1 <memset+0x70>
+  800cab:	88 07                	mov    %al,(%rdi)
+  800cad:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb1:	40 f6 c7 02          	test   $0x2,%dil
+  800cb5:	74 07                	je     800cbe <memset+0x7d>
+  800cb7:	66 89 07             	mov    %ax,(%rdi)
+  800cba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cbe:	40 f6 c7 04          	test   $0x4,%dil
+  800cc2:	74 a9                	je     800c6d <memset+0x2c>
+  800cc4:	89 07                	mov    %eax,(%rdi)
+  800cc6:	48 83 c7 04          	add    $0x4,%rdi
+  800cca:	eb a1                	jmp    800c6d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ccc:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd0:	74 06                	je     800cd8 <memset+0x97>
+  800cd2:	89 07                	mov    %eax,(%rdi)
+  800cd4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd8:	41 f6 c1 02          	test   $0x2,%r9b
+  800cdc:	74 07                	je     800ce5 <memset+0xa4>
+  800cde:	66 89 07             	mov    %ax,(%rdi)
+  800ce1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce5:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce9:	74 9c                	je     800c87 <memset+0x46>
+  800ceb:	88 07                	mov    %al,(%rdi)
+  800ced:	eb 98                	jmp    800c87 <memset+0x46>
+
+0000000000800cef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cef:	48 89 f8             	mov    %rdi,%rax
+  800cf2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf5:	48 39 fe             	cmp    %rdi,%rsi
+  800cf8:	73 3b                	jae    800d35 <memmove+0x46>
+  800cfa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cfe:	48 39 d7             	cmp    %rdx,%rdi
+  800d01:	73 32                	jae    800d35 <memmove+0x46>
+        s += n;
+        d += n;
+  800d03:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d07:	48 89 d6             	mov    %rdx,%rsi
+  800d0a:	48 09 fe             	or     %rdi,%rsi
+  800d0d:	48 09 ce             	or     %rcx,%rsi
+  800d10:	40 f6 c6 07          	test   $0x7,%sil
+  800d14:	75 12                	jne    800d28 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d16:	48 83 ef 08          	sub    $0x8,%rdi
+  800d1a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d1e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d22:	fd                   	std
+  800d23:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d26:	fc                   	cld
+  800d27:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d28:	48 83 ef 01          	sub    $0x1,%rdi
+  800d2c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d30:	fd                   	std
+  800d31:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d33:	eb f1                	jmp    800d26 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d35:	48 89 f2             	mov    %rsi,%rdx
+  800d38:	48 09 c2             	or     %rax,%rdx
+  800d3b:	48 09 ca             	or     %rcx,%rdx
+  800d3e:	f6 c2 07             	test   $0x7,%dl
+  800d41:	75 0c                	jne    800d4f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d43:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d47:	48 89 c7             	mov    %rax,%rdi
+  800d4a:	fc                   	cld
+  800d4b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d4e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d4f:	48 89 c7             	mov    %rax,%rdi
+  800d52:	fc                   	cld
+  800d53:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d55:	c3                   	ret
+
+0000000000800d56 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d56:	55                   	push   %rbp
+  800d57:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d5a:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d61:	00 00 00 
+  800d64:	ff d0                	call   *%rax
+}
+  800d66:	5d                   	pop    %rbp
+  800d67:	c3                   	ret
+
+0000000000800d68 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	41 57                	push   %r15
+  800d6e:	41 56                	push   %r14
+  800d70:	41 55                	push   %r13
+  800d72:	41 54                	push   %r12
+  800d74:	53                   	push   %rbx
+  800d75:	48 83 ec 08          	sub    $0x8,%rsp
+  800d79:	49 89 fe             	mov    %rdi,%r14
+  800d7c:	49 89 f7             	mov    %rsi,%r15
+  800d7f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d82:	48 89 f7             	mov    %rsi,%rdi
+  800d85:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+  800d91:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d94:	48 89 de             	mov    %rbx,%rsi
+  800d97:	4c 89 f7             	mov    %r14,%rdi
+  800d9a:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  800da1:	00 00 00 
+  800da4:	ff d0                	call   *%rax
+  800da6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da9:	48 39 c3             	cmp    %rax,%rbx
+  800dac:	74 36                	je     800de4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dae:	48 89 d8             	mov    %rbx,%rax
+  800db1:	4c 29 e8             	sub    %r13,%rax
+  800db4:	49 39 c4             	cmp    %rax,%r12
+  800db7:	73 31                	jae    800dea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dbe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc2:	4c 89 fe             	mov    %r15,%rsi
+  800dc5:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  800dcc:	00 00 00 
+  800dcf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd5:	48 83 c4 08          	add    $0x8,%rsp
+  800dd9:	5b                   	pop    %rbx
+  800dda:	41 5c                	pop    %r12
+  800ddc:	41 5d                	pop    %r13
+  800dde:	41 5e                	pop    %r14
+  800de0:	41 5f                	pop    %r15
+  800de2:	5d                   	pop    %rbp
+  800de3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de8:	eb eb                	jmp    800dd5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dea:	48 83 eb 01          	sub    $0x1,%rbx
+  800dee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df2:	48 89 da             	mov    %rbx,%rdx
+  800df5:	4c 89 fe             	mov    %r15,%rsi
+  800df8:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  800dff:	00 00 00 
+  800e02:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e04:	49 01 de             	add    %rbx,%r14
+  800e07:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e0c:	eb c3                	jmp    800dd1 <strlcat+0x69>
+
+0000000000800e0e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e0e:	48 85 d2             	test   %rdx,%rdx
+  800e11:	74 2d                	je     800e40 <memcmp+0x32>
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e18:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e1c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e21:	44 38 c1             	cmp    %r8b,%cl
+  800e24:	75 0f                	jne    800e35 <memcmp+0x27>
+    while (n-- > 0) {
+  800e26:	48 83 c0 01          	add    $0x1,%rax
+  800e2a:	48 39 c2             	cmp    %rax,%rdx
+  800e2d:	75 e9                	jne    800e18 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e34:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e35:	0f b6 c1             	movzbl %cl,%eax
+  800e38:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e3c:	44 29 c0             	sub    %r8d,%eax
+  800e3f:	c3                   	ret
+    return 0;
+  800e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e45:	c3                   	ret
+
+0000000000800e46 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e46:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e4a:	48 39 c7             	cmp    %rax,%rdi
+  800e4d:	73 0f                	jae    800e5e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e4f:	40 38 37             	cmp    %sil,(%rdi)
+  800e52:	74 0e                	je     800e62 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e54:	48 83 c7 01          	add    $0x1,%rdi
+  800e58:	48 39 f8             	cmp    %rdi,%rax
+  800e5b:	75 f2                	jne    800e4f <memfind+0x9>
+  800e5d:	c3                   	ret
+  800e5e:	48 89 f8             	mov    %rdi,%rax
+  800e61:	c3                   	ret
+  800e62:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e65:	c3                   	ret
+
+0000000000800e66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e66:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e69:	0f b6 37             	movzbl (%rdi),%esi
+  800e6c:	40 80 fe 20          	cmp    $0x20,%sil
+  800e70:	74 06                	je     800e78 <strtol+0x12>
+  800e72:	40 80 fe 09          	cmp    $0x9,%sil
+  800e76:	75 13                	jne    800e8b <strtol+0x25>
+  800e78:	48 83 c7 01          	add    $0x1,%rdi
+  800e7c:	0f b6 37             	movzbl (%rdi),%esi
+  800e7f:	40 80 fe 20          	cmp    $0x20,%sil
+  800e83:	74 f3                	je     800e78 <strtol+0x12>
+  800e85:	40 80 fe 09          	cmp    $0x9,%sil
+  800e89:	74 ed                	je     800e78 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e8b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e8e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e91:	3c 01                	cmp    $0x1,%al
+  800e93:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e97:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e9d:	75 0f                	jne    800eae <strtol+0x48>
+  800e9f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea2:	74 14                	je     800eb8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ea4:	85 d2                	test   %edx,%edx
+  800ea6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb3:	4c 63 ca             	movslq %edx,%r9
+  800eb6:	eb 36                	jmp    800eee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ebc:	74 0f                	je     800ecd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ebe:	85 d2                	test   %edx,%edx
+  800ec0:	75 ec                	jne    800eae <strtol+0x48>
+        s++;
+  800ec2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ec6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ecb:	eb e1                	jmp    800eae <strtol+0x48>
+        s += 2;
+  800ecd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ed6:	eb d6                	jmp    800eae <strtol+0x48>
+            dig -= '0';
+  800ed8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800edb:	44 0f b6 c1          	movzbl %cl,%r8d
+  800edf:	41 39 d0             	cmp    %edx,%r8d
+  800ee2:	7d 21                	jge    800f05 <strtol+0x9f>
+        val = val * base + dig;
+  800ee4:	49 0f af c1          	imul   %r9,%rax
+  800ee8:	0f b6 c9             	movzbl %cl,%ecx
+  800eeb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800eee:	48 83 c7 01          	add    $0x1,%rdi
+  800ef2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ef6:	80 f9 39             	cmp    $0x39,%cl
+  800ef9:	76 dd                	jbe    800ed8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800efb:	80 f9 7b             	cmp    $0x7b,%cl
+  800efe:	77 05                	ja     800f05 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f00:	83 e9 57             	sub    $0x57,%ecx
+  800f03:	eb d6                	jmp    800edb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f05:	4d 85 d2             	test   %r10,%r10
+  800f08:	74 03                	je     800f0d <strtol+0xa7>
+  800f0a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f0d:	48 89 c2             	mov    %rax,%rdx
+  800f10:	48 f7 da             	neg    %rdx
+  800f13:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f17:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f1b:	c3                   	ret
+
+0000000000800f1c <strrev>:
+
+void
+strrev(char *str)
+{
+  800f1c:	55                   	push   %rbp
+  800f1d:	48 89 e5             	mov    %rsp,%rbp
+  800f20:	53                   	push   %rbx
+  800f21:	48 83 ec 08          	sub    $0x8,%rsp
+  800f25:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f28:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800f2f:	00 00 00 
+  800f32:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f34:	83 e8 01             	sub    $0x1,%eax
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7e 22                	jle    800f5d <strrev+0x41>
+  800f3b:	48 98                	cltq
+  800f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f42:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f46:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f4a:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f4e:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f51:	48 83 c2 01          	add    $0x1,%rdx
+  800f55:	48 83 e8 01          	sub    $0x1,%rax
+  800f59:	39 c2                	cmp    %eax,%edx
+  800f5b:	7c e5                	jl     800f42 <strrev+0x26>
+	}
+}
+  800f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f61:	c9                   	leave
+  800f62:	c3                   	ret
+
+0000000000800f63 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f63:	85 d2                	test   %edx,%edx
+  800f65:	0f 84 80 00 00 00    	je     800feb <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f6b:	55                   	push   %rbp
+  800f6c:	48 89 e5             	mov    %rsp,%rbp
+  800f6f:	53                   	push   %rbx
+  800f70:	48 83 ec 08          	sub    $0x8,%rsp
+  800f74:	49 89 f2             	mov    %rsi,%r10
+  800f77:	41 89 d3             	mov    %edx,%r11d
+  800f7a:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f7d:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800f82:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800f85:	eb 20                	jmp    800fa7 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800f87:	41 89 f1             	mov    %esi,%r9d
+  800f8a:	83 c2 30             	add    $0x30,%edx
+  800f8d:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800f90:	89 f8                	mov    %edi,%eax
+  800f92:	99                   	cltd
+  800f93:	f7 f9                	idiv   %ecx
+  800f95:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800f97:	85 c0                	test   %eax,%eax
+  800f99:	74 2e                	je     800fc9 <itoa+0x66>
+  800f9b:	83 c6 01             	add    $0x1,%esi
+  800f9e:	49 83 c0 01          	add    $0x1,%r8
+  800fa2:	44 39 cb             	cmp    %r9d,%ebx
+  800fa5:	7e 15                	jle    800fbc <itoa+0x59>
+		digit = sum % base;
+  800fa7:	89 f8                	mov    %edi,%eax
+  800fa9:	99                   	cltd
+  800faa:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fac:	83 fa 09             	cmp    $0x9,%edx
+  800faf:	7e d6                	jle    800f87 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800fb1:	41 89 f1             	mov    %esi,%r9d
+  800fb4:	83 c2 37             	add    $0x37,%edx
+  800fb7:	41 88 10             	mov    %dl,(%r8)
+  800fba:	eb d4                	jmp    800f90 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fbc:	41 83 eb 01          	sub    $0x1,%r11d
+  800fc0:	45 39 cb             	cmp    %r9d,%r11d
+  800fc3:	75 04                	jne    800fc9 <itoa+0x66>
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	75 28                	jne    800ff1 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fc9:	4d 63 c9             	movslq %r9d,%r9
+  800fcc:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fd1:	4c 89 d7             	mov    %r10,%rdi
+  800fd4:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  800fdb:	00 00 00 
+  800fde:	ff d0                	call   *%rax
+	return 0;
+  800fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe9:	c9                   	leave
+  800fea:	c3                   	ret
+		return -1;
+  800feb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800ff0:	c3                   	ret
+		return -1;
+  800ff1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800ff6:	eb ed                	jmp    800fe5 <itoa+0x82>
+
+0000000000800ff8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ff8:	55                   	push   %rbp
+  800ff9:	48 89 e5             	mov    %rsp,%rbp
+  800ffc:	53                   	push   %rbx
+  800ffd:	48 89 fa             	mov    %rdi,%rdx
+  801000:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801008:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801012:	be 00 00 00 00       	mov    $0x0,%esi
+  801017:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80101d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80101f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801023:	c9                   	leave
+  801024:	c3                   	ret
+
+0000000000801025 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801025:	55                   	push   %rbp
+  801026:	48 89 e5             	mov    %rsp,%rbp
+  801029:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80102a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801034:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801039:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801043:	be 00 00 00 00       	mov    $0x0,%esi
+  801048:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801050:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801054:	c9                   	leave
+  801055:	c3                   	ret
+
+0000000000801056 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801056:	55                   	push   %rbp
+  801057:	48 89 e5             	mov    %rsp,%rbp
+  80105a:	53                   	push   %rbx
+  80105b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80105f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801062:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801067:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801076:	be 00 00 00 00       	mov    $0x0,%esi
+  80107b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801081:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801083:	48 85 c0             	test   %rax,%rax
+  801086:	7f 06                	jg     80108e <sys_env_destroy+0x38>
+}
+  801088:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108c:	c9                   	leave
+  80108d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80108e:	49 89 c0             	mov    %rax,%r8
+  801091:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801096:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80109d:	00 00 00 
+  8010a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8010a5:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8010ac:	00 00 00 
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  8010bb:	00 00 00 
+  8010be:	41 ff d1             	call   *%r9
+
+00000000008010c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010c1:	55                   	push   %rbp
+  8010c2:	48 89 e5             	mov    %rsp,%rbp
+  8010c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010df:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+00000000008010f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801106:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801110:	be 00 00 00 00       	mov    $0x0,%esi
+  801115:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80111d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801121:	c9                   	leave
+  801122:	c3                   	ret
+
+0000000000801123 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801123:	55                   	push   %rbp
+  801124:	48 89 e5             	mov    %rsp,%rbp
+  801127:	53                   	push   %rbx
+  801128:	48 89 fa             	mov    %rdi,%rdx
+  80112b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80112e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801133:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80113a:	00 00 00 
+  80113d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801142:	be 00 00 00 00       	mov    $0x0,%esi
+  801147:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	53                   	push   %rbx
+  80115a:	49 89 f8             	mov    %rdi,%r8
+  80115d:	48 89 d3             	mov    %rdx,%rbx
+  801160:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801163:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801168:	4c 89 c2             	mov    %r8,%rdx
+  80116b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116e:	be 00 00 00 00       	mov    $0x0,%esi
+  801173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801179:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80117b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117f:	c9                   	leave
+  801180:	c3                   	ret
+
+0000000000801181 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801181:	55                   	push   %rbp
+  801182:	48 89 e5             	mov    %rsp,%rbp
+  801185:	53                   	push   %rbx
+  801186:	48 83 ec 08          	sub    $0x8,%rsp
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80118f:	48 63 f9             	movslq %ecx,%rdi
+  801192:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801195:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011aa:	48 85 c0             	test   %rax,%rax
+  8011ad:	7f 06                	jg     8011b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b5:	49 89 c0             	mov    %rax,%r8
+  8011b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011bd:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8011c4:	00 00 00 
+  8011c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8011cc:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8011d3:	00 00 00 
+  8011d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011db:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  8011e2:	00 00 00 
+  8011e5:	41 ff d1             	call   *%r9
+
+00000000008011e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e8:	55                   	push   %rbp
+  8011e9:	48 89 e5             	mov    %rsp,%rbp
+  8011ec:	53                   	push   %rbx
+  8011ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8011f1:	89 f8                	mov    %edi,%eax
+  8011f3:	49 89 f2             	mov    %rsi,%r10
+  8011f6:	48 89 cf             	mov    %rcx,%rdi
+  8011f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011fc:	48 63 da             	movslq %edx,%rbx
+  8011ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801202:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801207:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80120d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120f:	48 85 c0             	test   %rax,%rax
+  801212:	7f 06                	jg     80121a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121a:	49 89 c0             	mov    %rax,%r8
+  80121d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801222:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801229:	00 00 00 
+  80122c:	be 26 00 00 00       	mov    $0x26,%esi
+  801231:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801238:	00 00 00 
+  80123b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801240:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  801247:	00 00 00 
+  80124a:	41 ff d1             	call   *%r9
+
+000000000080124d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	53                   	push   %rbx
+  801252:	48 83 ec 08          	sub    $0x8,%rsp
+  801256:	48 89 f1             	mov    %rsi,%rcx
+  801259:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80125c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801264:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801269:	be 00 00 00 00       	mov    $0x0,%esi
+  80126e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801274:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801276:	48 85 c0             	test   %rax,%rax
+  801279:	7f 06                	jg     801281 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80127b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801281:	49 89 c0             	mov    %rax,%r8
+  801284:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801289:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801290:	00 00 00 
+  801293:	be 26 00 00 00       	mov    $0x26,%esi
+  801298:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  80129f:	00 00 00 
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  8012ae:	00 00 00 
+  8012b1:	41 ff d1             	call   *%r9
+
+00000000008012b4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012b4:	55                   	push   %rbp
+  8012b5:	48 89 e5             	mov    %rsp,%rbp
+  8012b8:	53                   	push   %rbx
+  8012b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012bd:	48 63 ce             	movslq %esi,%rcx
+  8012c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012df:	48 85 c0             	test   %rax,%rax
+  8012e2:	7f 06                	jg     8012ea <sys_env_set_status+0x36>
+}
+  8012e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e8:	c9                   	leave
+  8012e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ea:	49 89 c0             	mov    %rax,%r8
+  8012ed:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012f2:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8012f9:	00 00 00 
+  8012fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801301:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801308:	00 00 00 
+  80130b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801310:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  801317:	00 00 00 
+  80131a:	41 ff d1             	call   *%r9
+
+000000000080131d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	53                   	push   %rbx
+  801322:	48 83 ec 08          	sub    $0x8,%rsp
+  801326:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801329:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801331:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801336:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133b:	be 00 00 00 00       	mov    $0x0,%esi
+  801340:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801346:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801348:	48 85 c0             	test   %rax,%rax
+  80134b:	7f 06                	jg     801353 <sys_env_set_trapframe+0x36>
+}
+  80134d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801353:	49 89 c0             	mov    %rax,%r8
+  801356:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80135b:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801362:	00 00 00 
+  801365:	be 26 00 00 00       	mov    $0x26,%esi
+  80136a:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801371:	00 00 00 
+  801374:	b8 00 00 00 00       	mov    $0x0,%eax
+  801379:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  801380:	00 00 00 
+  801383:	41 ff d1             	call   *%r9
+
+0000000000801386 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801386:	55                   	push   %rbp
+  801387:	48 89 e5             	mov    %rsp,%rbp
+  80138a:	53                   	push   %rbx
+  80138b:	48 83 ec 08          	sub    $0x8,%rsp
+  80138f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801392:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801395:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b1:	48 85 c0             	test   %rax,%rax
+  8013b4:	7f 06                	jg     8013bc <sys_env_set_pgfault_upcall+0x36>
+}
+  8013b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ba:	c9                   	leave
+  8013bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bc:	49 89 c0             	mov    %rax,%r8
+  8013bf:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013c4:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8013cb:	00 00 00 
+  8013ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d3:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8013da:	00 00 00 
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  8013e9:	00 00 00 
+  8013ec:	41 ff d1             	call   *%r9
+
+00000000008013ef <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ef:	55                   	push   %rbp
+  8013f0:	48 89 e5             	mov    %rsp,%rbp
+  8013f3:	53                   	push   %rbx
+  8013f4:	89 f8                	mov    %edi,%eax
+  8013f6:	49 89 f1             	mov    %rsi,%r9
+  8013f9:	48 89 d3             	mov    %rdx,%rbx
+  8013fc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013ff:	49 63 f0             	movslq %r8d,%rsi
+  801402:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801413:	cd 30                	int    $0x30
+}
+  801415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801419:	c9                   	leave
+  80141a:	c3                   	ret
+
+000000000080141b <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80141b:	55                   	push   %rbp
+  80141c:	48 89 e5             	mov    %rsp,%rbp
+  80141f:	53                   	push   %rbx
+  801420:	48 83 ec 08          	sub    $0x8,%rsp
+  801424:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801427:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80142a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801432:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801442:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801444:	48 85 c0             	test   %rax,%rax
+  801447:	7f 06                	jg     80144f <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144f:	49 89 c0             	mov    %rax,%r8
+  801452:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801457:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80145e:	00 00 00 
+  801461:	be 26 00 00 00       	mov    $0x26,%esi
+  801466:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  80146d:	00 00 00 
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	49 b9 e2 33 80 00 00 	movabs $0x8033e2,%r9
+  80147c:	00 00 00 
+  80147f:	41 ff d1             	call   *%r9
+
+0000000000801482 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801482:	55                   	push   %rbp
+  801483:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148b:	48 b8 1b 14 80 00 00 	movabs $0x80141b,%rax
+  801492:	00 00 00 
+  801495:	ff d0                	call   *%rax
+}
+  801497:	5d                   	pop    %rbp
+  801498:	c3                   	ret
+
+0000000000801499 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80149e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c8:	c9                   	leave
+  8014c9:	c3                   	ret
+
+00000000008014ca <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014ca:	55                   	push   %rbp
+  8014cb:	48 89 e5             	mov    %rsp,%rbp
+  8014ce:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014cf:	48 63 ce             	movslq %esi,%rcx
+  8014d2:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f0:	cd 30                	int    $0x30
+}
+  8014f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+00000000008014f8 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	53                   	push   %rbx
+  8014fd:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801500:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801504:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801513:	be 00 00 00 00       	mov    $0x0,%esi
+  801518:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151e:	cd 30                	int    $0x30
+}
+  801520:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801524:	c9                   	leave
+  801525:	c3                   	ret
+
+0000000000801526 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801526:	55                   	push   %rbp
+  801527:	48 89 e5             	mov    %rsp,%rbp
+  80152a:	53                   	push   %rbx
+  80152b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80152e:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801531:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801536:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801539:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153e:	be 00 00 00 00       	mov    $0x0,%esi
+  801543:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801549:	cd 30                	int    $0x30
+}
+  80154b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154f:	c9                   	leave
+  801550:	c3                   	ret
+
+0000000000801551 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801551:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801558:	ff ff ff 
+  80155b:	48 01 f8             	add    %rdi,%rax
+  80155e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801562:	c3                   	ret
+
+0000000000801563 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801563:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80156a:	ff ff ff 
+  80156d:	48 01 f8             	add    %rdi,%rax
+  801570:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801574:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80157a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80157e:	c3                   	ret
+
+000000000080157f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80157f:	55                   	push   %rbp
+  801580:	48 89 e5             	mov    %rsp,%rbp
+  801583:	41 57                	push   %r15
+  801585:	41 56                	push   %r14
+  801587:	41 55                	push   %r13
+  801589:	41 54                	push   %r12
+  80158b:	53                   	push   %rbx
+  80158c:	48 83 ec 08          	sub    $0x8,%rsp
+  801590:	49 89 ff             	mov    %rdi,%r15
+  801593:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801598:	49 bd 9e 30 80 00 00 	movabs $0x80309e,%r13
+  80159f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8015a2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015a8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015ab:	48 89 df             	mov    %rbx,%rdi
+  8015ae:	41 ff d5             	call   *%r13
+  8015b1:	83 e0 04             	and    $0x4,%eax
+  8015b4:	74 17                	je     8015cd <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015b6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015bd:	4c 39 f3             	cmp    %r14,%rbx
+  8015c0:	75 e6                	jne    8015a8 <fd_alloc+0x29>
+  8015c2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015c8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015cd:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015d0:	48 83 c4 08          	add    $0x8,%rsp
+  8015d4:	5b                   	pop    %rbx
+  8015d5:	41 5c                	pop    %r12
+  8015d7:	41 5d                	pop    %r13
+  8015d9:	41 5e                	pop    %r14
+  8015db:	41 5f                	pop    %r15
+  8015dd:	5d                   	pop    %rbp
+  8015de:	c3                   	ret
+
+00000000008015df <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015df:	83 ff 1f             	cmp    $0x1f,%edi
+  8015e2:	77 39                	ja     80161d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	41 54                	push   %r12
+  8015ea:	53                   	push   %rbx
+  8015eb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015ee:	48 63 df             	movslq %edi,%rbx
+  8015f1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015f8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015fc:	48 89 df             	mov    %rbx,%rdi
+  8015ff:	48 b8 9e 30 80 00 00 	movabs $0x80309e,%rax
+  801606:	00 00 00 
+  801609:	ff d0                	call   *%rax
+  80160b:	a8 04                	test   $0x4,%al
+  80160d:	74 14                	je     801623 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80160f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801618:	5b                   	pop    %rbx
+  801619:	41 5c                	pop    %r12
+  80161b:	5d                   	pop    %rbp
+  80161c:	c3                   	ret
+        return -E_INVAL;
+  80161d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801622:	c3                   	ret
+        return -E_INVAL;
+  801623:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801628:	eb ee                	jmp    801618 <fd_lookup+0x39>
+
+000000000080162a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80162a:	55                   	push   %rbp
+  80162b:	48 89 e5             	mov    %rsp,%rbp
+  80162e:	41 54                	push   %r12
+  801630:	53                   	push   %rbx
+  801631:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801634:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  80163b:	00 00 00 
+  80163e:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801645:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801648:	39 3b                	cmp    %edi,(%rbx)
+  80164a:	74 47                	je     801693 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80164c:	48 83 c0 08          	add    $0x8,%rax
+  801650:	48 8b 18             	mov    (%rax),%rbx
+  801653:	48 85 db             	test   %rbx,%rbx
+  801656:	75 f0                	jne    801648 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801658:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80165f:	00 00 00 
+  801662:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801668:	89 fa                	mov    %edi,%edx
+  80166a:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  801671:	00 00 00 
+  801674:	b8 00 00 00 00       	mov    $0x0,%eax
+  801679:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801680:	00 00 00 
+  801683:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801685:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80168a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80168e:	5b                   	pop    %rbx
+  80168f:	41 5c                	pop    %r12
+  801691:	5d                   	pop    %rbp
+  801692:	c3                   	ret
+            return 0;
+  801693:	b8 00 00 00 00       	mov    $0x0,%eax
+  801698:	eb f0                	jmp    80168a <dev_lookup+0x60>
+
+000000000080169a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  80169e:	41 55                	push   %r13
+  8016a0:	41 54                	push   %r12
+  8016a2:	53                   	push   %rbx
+  8016a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a7:	48 89 fb             	mov    %rdi,%rbx
+  8016aa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016ad:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016b4:	ff ff ff 
+  8016b7:	48 01 df             	add    %rbx,%rdi
+  8016ba:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016c2:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+  8016ce:	41 89 c5             	mov    %eax,%r13d
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 06                	js     8016db <fd_close+0x41>
+  8016d5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016d9:	74 1a                	je     8016f5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016db:	45 84 e4             	test   %r12b,%r12b
+  8016de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016e7:	44 89 e8             	mov    %r13d,%eax
+  8016ea:	48 83 c4 18          	add    $0x18,%rsp
+  8016ee:	5b                   	pop    %rbx
+  8016ef:	41 5c                	pop    %r12
+  8016f1:	41 5d                	pop    %r13
+  8016f3:	5d                   	pop    %rbp
+  8016f4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016f5:	8b 3b                	mov    (%rbx),%edi
+  8016f7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016fb:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801702:	00 00 00 
+  801705:	ff d0                	call   *%rax
+  801707:	41 89 c5             	mov    %eax,%r13d
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	78 1b                	js     801729 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80170e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801712:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801716:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80171c:	48 85 c0             	test   %rax,%rax
+  80171f:	74 08                	je     801729 <fd_close+0x8f>
+  801721:	48 89 df             	mov    %rbx,%rdi
+  801724:	ff d0                	call   *%rax
+  801726:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801729:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80172e:	48 89 de             	mov    %rbx,%rsi
+  801731:	bf 00 00 00 00       	mov    $0x0,%edi
+  801736:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  80173d:	00 00 00 
+  801740:	ff d0                	call   *%rax
+    return res;
+  801742:	eb a3                	jmp    8016e7 <fd_close+0x4d>
+
+0000000000801744 <close>:
+
+int
+close(int fdnum) {
+  801744:	55                   	push   %rbp
+  801745:	48 89 e5             	mov    %rsp,%rbp
+  801748:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80174c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801750:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801757:	00 00 00 
+  80175a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80175c:	85 c0                	test   %eax,%eax
+  80175e:	78 15                	js     801775 <close+0x31>
+
+    return fd_close(fd, 1);
+  801760:	be 01 00 00 00       	mov    $0x1,%esi
+  801765:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801769:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  801770:	00 00 00 
+  801773:	ff d0                	call   *%rax
+}
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+0000000000801777 <close_all>:
+
+void
+close_all(void) {
+  801777:	55                   	push   %rbp
+  801778:	48 89 e5             	mov    %rsp,%rbp
+  80177b:	41 54                	push   %r12
+  80177d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80177e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801783:	49 bc 44 17 80 00 00 	movabs $0x801744,%r12
+  80178a:	00 00 00 
+  80178d:	89 df                	mov    %ebx,%edi
+  80178f:	41 ff d4             	call   *%r12
+  801792:	83 c3 01             	add    $0x1,%ebx
+  801795:	83 fb 20             	cmp    $0x20,%ebx
+  801798:	75 f3                	jne    80178d <close_all+0x16>
+}
+  80179a:	5b                   	pop    %rbx
+  80179b:	41 5c                	pop    %r12
+  80179d:	5d                   	pop    %rbp
+  80179e:	c3                   	ret
+
+000000000080179f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80179f:	55                   	push   %rbp
+  8017a0:	48 89 e5             	mov    %rsp,%rbp
+  8017a3:	41 57                	push   %r15
+  8017a5:	41 56                	push   %r14
+  8017a7:	41 55                	push   %r13
+  8017a9:	41 54                	push   %r12
+  8017ab:	53                   	push   %rbx
+  8017ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8017b0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017b3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017b7:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8017be:	00 00 00 
+  8017c1:	ff d0                	call   *%rax
+  8017c3:	89 c3                	mov    %eax,%ebx
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	0f 88 b8 00 00 00    	js     801885 <dup+0xe6>
+    close(newfdnum);
+  8017cd:	44 89 e7             	mov    %r12d,%edi
+  8017d0:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017dc:	4d 63 ec             	movslq %r12d,%r13
+  8017df:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017e6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017ea:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017ee:	4c 89 ff             	mov    %r15,%rdi
+  8017f1:	49 be 63 15 80 00 00 	movabs $0x801563,%r14
+  8017f8:	00 00 00 
+  8017fb:	41 ff d6             	call   *%r14
+  8017fe:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801801:	4c 89 ef             	mov    %r13,%rdi
+  801804:	41 ff d6             	call   *%r14
+  801807:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80180a:	48 89 df             	mov    %rbx,%rdi
+  80180d:	48 b8 9e 30 80 00 00 	movabs $0x80309e,%rax
+  801814:	00 00 00 
+  801817:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801819:	a8 04                	test   $0x4,%al
+  80181b:	74 2b                	je     801848 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80181d:	41 89 c1             	mov    %eax,%r9d
+  801820:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801826:	4c 89 f1             	mov    %r14,%rcx
+  801829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182e:	48 89 de             	mov    %rbx,%rsi
+  801831:	bf 00 00 00 00       	mov    $0x0,%edi
+  801836:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80183d:	00 00 00 
+  801840:	ff d0                	call   *%rax
+  801842:	89 c3                	mov    %eax,%ebx
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 4e                	js     801896 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801848:	4c 89 ff             	mov    %r15,%rdi
+  80184b:	48 b8 9e 30 80 00 00 	movabs $0x80309e,%rax
+  801852:	00 00 00 
+  801855:	ff d0                	call   *%rax
+  801857:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80185a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801860:	4c 89 e9             	mov    %r13,%rcx
+  801863:	ba 00 00 00 00       	mov    $0x0,%edx
+  801868:	4c 89 fe             	mov    %r15,%rsi
+  80186b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801870:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  801877:	00 00 00 
+  80187a:	ff d0                	call   *%rax
+  80187c:	89 c3                	mov    %eax,%ebx
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	78 14                	js     801896 <dup+0xf7>
+
+    return newfdnum;
+  801882:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801885:	89 d8                	mov    %ebx,%eax
+  801887:	48 83 c4 18          	add    $0x18,%rsp
+  80188b:	5b                   	pop    %rbx
+  80188c:	41 5c                	pop    %r12
+  80188e:	41 5d                	pop    %r13
+  801890:	41 5e                	pop    %r14
+  801892:	41 5f                	pop    %r15
+  801894:	5d                   	pop    %rbp
+  801895:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801896:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80189b:	4c 89 ee             	mov    %r13,%rsi
+  80189e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018a3:	49 bc 4d 12 80 00 00 	movabs $0x80124d,%r12
+  8018aa:	00 00 00 
+  8018ad:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b5:	4c 89 f6             	mov    %r14,%rsi
+  8018b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018bd:	41 ff d4             	call   *%r12
+    return res;
+  8018c0:	eb c3                	jmp    801885 <dup+0xe6>
+
+00000000008018c2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018c2:	55                   	push   %rbp
+  8018c3:	48 89 e5             	mov    %rsp,%rbp
+  8018c6:	41 56                	push   %r14
+  8018c8:	41 55                	push   %r13
+  8018ca:	41 54                	push   %r12
+  8018cc:	53                   	push   %rbx
+  8018cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8018d1:	89 fb                	mov    %edi,%ebx
+  8018d3:	49 89 f4             	mov    %rsi,%r12
+  8018d6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018d9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018dd:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 4c                	js     801939 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018ed:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018f1:	41 8b 3e             	mov    (%r14),%edi
+  8018f4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018f8:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+  801904:	85 c0                	test   %eax,%eax
+  801906:	78 35                	js     80193d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801908:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80190c:	83 e0 03             	and    $0x3,%eax
+  80190f:	83 f8 01             	cmp    $0x1,%eax
+  801912:	74 2d                	je     801941 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801914:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801918:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80191c:	48 85 c0             	test   %rax,%rax
+  80191f:	74 56                	je     801977 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801921:	4c 89 ea             	mov    %r13,%rdx
+  801924:	4c 89 e6             	mov    %r12,%rsi
+  801927:	4c 89 f7             	mov    %r14,%rdi
+  80192a:	ff d0                	call   *%rax
+}
+  80192c:	48 83 c4 10          	add    $0x10,%rsp
+  801930:	5b                   	pop    %rbx
+  801931:	41 5c                	pop    %r12
+  801933:	41 5d                	pop    %r13
+  801935:	41 5e                	pop    %r14
+  801937:	5d                   	pop    %rbp
+  801938:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801939:	48 98                	cltq
+  80193b:	eb ef                	jmp    80192c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80193d:	48 98                	cltq
+  80193f:	eb eb                	jmp    80192c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801941:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801948:	00 00 00 
+  80194b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801951:	89 da                	mov    %ebx,%edx
+  801953:	48 bf 99 3c 80 00 00 	movabs $0x803c99,%rdi
+  80195a:	00 00 00 
+  80195d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801962:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801969:	00 00 00 
+  80196c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80196e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801975:	eb b5                	jmp    80192c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801977:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80197e:	eb ac                	jmp    80192c <read+0x6a>
+
+0000000000801980 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801980:	55                   	push   %rbp
+  801981:	48 89 e5             	mov    %rsp,%rbp
+  801984:	41 56                	push   %r14
+  801986:	41 55                	push   %r13
+  801988:	41 54                	push   %r12
+  80198a:	53                   	push   %rbx
+  80198b:	48 83 ec 10          	sub    $0x10,%rsp
+  80198f:	89 fb                	mov    %edi,%ebx
+  801991:	49 89 f4             	mov    %rsi,%r12
+  801994:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801997:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80199b:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	78 41                	js     8019ec <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ab:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019af:	41 8b 3e             	mov    (%r14),%edi
+  8019b2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019b6:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  8019bd:	00 00 00 
+  8019c0:	ff d0                	call   *%rax
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 35                	js     8019fb <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019ca:	83 e0 03             	and    $0x3,%eax
+  8019cd:	83 f8 01             	cmp    $0x1,%eax
+  8019d0:	74 2d                	je     8019ff <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019d6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019da:	48 85 c0             	test   %rax,%rax
+  8019dd:	74 56                	je     801a35 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019df:	4c 89 ea             	mov    %r13,%rdx
+  8019e2:	4c 89 e6             	mov    %r12,%rsi
+  8019e5:	4c 89 f7             	mov    %r14,%rdi
+  8019e8:	ff d0                	call   *%rax
+  8019ea:	eb 02                	jmp    8019ee <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019ec:	48 98                	cltq
+}
+  8019ee:	48 83 c4 10          	add    $0x10,%rsp
+  8019f2:	5b                   	pop    %rbx
+  8019f3:	41 5c                	pop    %r12
+  8019f5:	41 5d                	pop    %r13
+  8019f7:	41 5e                	pop    %r14
+  8019f9:	5d                   	pop    %rbp
+  8019fa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019fb:	48 98                	cltq
+  8019fd:	eb ef                	jmp    8019ee <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019ff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a06:	00 00 00 
+  801a09:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a0f:	89 da                	mov    %ebx,%edx
+  801a11:	48 bf 58 3c 80 00 00 	movabs $0x803c58,%rdi
+  801a18:	00 00 00 
+  801a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a20:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801a27:	00 00 00 
+  801a2a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a2c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a33:	eb b9                	jmp    8019ee <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a35:	4c 89 ea             	mov    %r13,%rdx
+  801a38:	4c 89 e6             	mov    %r12,%rsi
+  801a3b:	89 df                	mov    %ebx,%edi
+  801a3d:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  801a44:	00 00 00 
+  801a47:	ff d0                	call   *%rax
+  801a49:	eb a3                	jmp    8019ee <readmap+0x6e>
+
+0000000000801a4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	41 57                	push   %r15
+  801a51:	41 56                	push   %r14
+  801a53:	41 55                	push   %r13
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a5c:	48 85 d2             	test   %rdx,%rdx
+  801a5f:	74 54                	je     801ab5 <readn+0x6a>
+  801a61:	41 89 fd             	mov    %edi,%r13d
+  801a64:	49 89 f6             	mov    %rsi,%r14
+  801a67:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a6f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a74:	49 bf c2 18 80 00 00 	movabs $0x8018c2,%r15
+  801a7b:	00 00 00 
+  801a7e:	4c 89 e2             	mov    %r12,%rdx
+  801a81:	48 29 f2             	sub    %rsi,%rdx
+  801a84:	4c 01 f6             	add    %r14,%rsi
+  801a87:	44 89 ef             	mov    %r13d,%edi
+  801a8a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 20                	js     801ab1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a91:	01 c3                	add    %eax,%ebx
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	74 08                	je     801a9f <readn+0x54>
+  801a97:	48 63 f3             	movslq %ebx,%rsi
+  801a9a:	4c 39 e6             	cmp    %r12,%rsi
+  801a9d:	72 df                	jb     801a7e <readn+0x33>
+    }
+    return res;
+  801a9f:	48 63 c3             	movslq %ebx,%rax
+}
+  801aa2:	48 83 c4 08          	add    $0x8,%rsp
+  801aa6:	5b                   	pop    %rbx
+  801aa7:	41 5c                	pop    %r12
+  801aa9:	41 5d                	pop    %r13
+  801aab:	41 5e                	pop    %r14
+  801aad:	41 5f                	pop    %r15
+  801aaf:	5d                   	pop    %rbp
+  801ab0:	c3                   	ret
+        if (inc < 0) return inc;
+  801ab1:	48 98                	cltq
+  801ab3:	eb ed                	jmp    801aa2 <readn+0x57>
+    int inc = 1, res = 0;
+  801ab5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aba:	eb e3                	jmp    801a9f <readn+0x54>
+
+0000000000801abc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	41 56                	push   %r14
+  801ac2:	41 55                	push   %r13
+  801ac4:	41 54                	push   %r12
+  801ac6:	53                   	push   %rbx
+  801ac7:	48 83 ec 10          	sub    $0x10,%rsp
+  801acb:	89 fb                	mov    %edi,%ebx
+  801acd:	49 89 f4             	mov    %rsi,%r12
+  801ad0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ad3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad7:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	78 47                	js     801b2e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aeb:	41 8b 3e             	mov    (%r14),%edi
+  801aee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af2:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 30                	js     801b32 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b02:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b07:	74 2d                	je     801b36 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b0d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b11:	48 85 c0             	test   %rax,%rax
+  801b14:	74 56                	je     801b6c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b16:	4c 89 ea             	mov    %r13,%rdx
+  801b19:	4c 89 e6             	mov    %r12,%rsi
+  801b1c:	4c 89 f7             	mov    %r14,%rdi
+  801b1f:	ff d0                	call   *%rax
+}
+  801b21:	48 83 c4 10          	add    $0x10,%rsp
+  801b25:	5b                   	pop    %rbx
+  801b26:	41 5c                	pop    %r12
+  801b28:	41 5d                	pop    %r13
+  801b2a:	41 5e                	pop    %r14
+  801b2c:	5d                   	pop    %rbp
+  801b2d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b2e:	48 98                	cltq
+  801b30:	eb ef                	jmp    801b21 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b32:	48 98                	cltq
+  801b34:	eb eb                	jmp    801b21 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b36:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b3d:	00 00 00 
+  801b40:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b46:	89 da                	mov    %ebx,%edx
+  801b48:	48 bf b5 3c 80 00 00 	movabs $0x803cb5,%rdi
+  801b4f:	00 00 00 
+  801b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b57:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801b5e:	00 00 00 
+  801b61:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b6a:	eb b5                	jmp    801b21 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b6c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b73:	eb ac                	jmp    801b21 <write+0x65>
+
+0000000000801b75 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b75:	55                   	push   %rbp
+  801b76:	48 89 e5             	mov    %rsp,%rbp
+  801b79:	53                   	push   %rbx
+  801b7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b7e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b84:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	78 0c                	js     801ba0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b98:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ba4:	c9                   	leave
+  801ba5:	c3                   	ret
+
+0000000000801ba6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ba6:	55                   	push   %rbp
+  801ba7:	48 89 e5             	mov    %rsp,%rbp
+  801baa:	41 55                	push   %r13
+  801bac:	41 54                	push   %r12
+  801bae:	53                   	push   %rbx
+  801baf:	48 83 ec 18          	sub    $0x18,%rsp
+  801bb3:	89 fb                	mov    %edi,%ebx
+  801bb5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bbc:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 38                	js     801c04 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bcc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bd0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bd4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd8:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801bdf:	00 00 00 
+  801be2:	ff d0                	call   *%rax
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 1c                	js     801c04 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801bed:	74 20                	je     801c0f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf3:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bf7:	48 85 c0             	test   %rax,%rax
+  801bfa:	74 47                	je     801c43 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801bfc:	44 89 e6             	mov    %r12d,%esi
+  801bff:	4c 89 ef             	mov    %r13,%rdi
+  801c02:	ff d0                	call   *%rax
+}
+  801c04:	48 83 c4 18          	add    $0x18,%rsp
+  801c08:	5b                   	pop    %rbx
+  801c09:	41 5c                	pop    %r12
+  801c0b:	41 5d                	pop    %r13
+  801c0d:	5d                   	pop    %rbp
+  801c0e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c16:	00 00 00 
+  801c19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c1f:	89 da                	mov    %ebx,%edx
+  801c21:	48 bf 78 3c 80 00 00 	movabs $0x803c78,%rdi
+  801c28:	00 00 00 
+  801c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c30:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801c37:	00 00 00 
+  801c3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c41:	eb c1                	jmp    801c04 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c43:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c48:	eb ba                	jmp    801c04 <ftruncate+0x5e>
+
+0000000000801c4a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	41 54                	push   %r12
+  801c50:	53                   	push   %rbx
+  801c51:	48 83 ec 10          	sub    $0x10,%rsp
+  801c55:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c5c:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801c63:	00 00 00 
+  801c66:	ff d0                	call   *%rax
+  801c68:	85 c0                	test   %eax,%eax
+  801c6a:	78 4e                	js     801cba <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c6c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c70:	41 8b 3c 24          	mov    (%r12),%edi
+  801c74:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c78:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801c7f:	00 00 00 
+  801c82:	ff d0                	call   *%rax
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	78 32                	js     801cba <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c8c:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801c91:	74 30                	je     801cc3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c93:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c96:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c9d:	00 00 00 
+    stat->st_isdir = 0;
+  801ca0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ca7:	00 00 00 
+    stat->st_dev = dev;
+  801caa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cb1:	48 89 de             	mov    %rbx,%rsi
+  801cb4:	4c 89 e7             	mov    %r12,%rdi
+  801cb7:	ff 50 30             	call   *0x30(%rax)
+}
+  801cba:	48 83 c4 10          	add    $0x10,%rsp
+  801cbe:	5b                   	pop    %rbx
+  801cbf:	41 5c                	pop    %r12
+  801cc1:	5d                   	pop    %rbp
+  801cc2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cc3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cc8:	eb f0                	jmp    801cba <fstat+0x70>
+
+0000000000801cca <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+  801cce:	41 54                	push   %r12
+  801cd0:	53                   	push   %rbx
+  801cd1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd9:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  801ce0:	00 00 00 
+  801ce3:	ff d0                	call   *%rax
+  801ce5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	78 25                	js     801d10 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ceb:	4c 89 e6             	mov    %r12,%rsi
+  801cee:	89 c7                	mov    %eax,%edi
+  801cf0:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  801cf7:	00 00 00 
+  801cfa:	ff d0                	call   *%rax
+  801cfc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801cff:	89 df                	mov    %ebx,%edi
+  801d01:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+
+    return res;
+  801d0d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d10:	89 d8                	mov    %ebx,%eax
+  801d12:	5b                   	pop    %rbx
+  801d13:	41 5c                	pop    %r12
+  801d15:	5d                   	pop    %rbp
+  801d16:	c3                   	ret
+
+0000000000801d17 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d17:	55                   	push   %rbp
+  801d18:	48 89 e5             	mov    %rsp,%rbp
+  801d1b:	41 54                	push   %r12
+  801d1d:	53                   	push   %rbx
+  801d1e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d22:	48 89 fb             	mov    %rdi,%rbx
+  801d25:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d2c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d31:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	78 1f                	js     801d60 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d45:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d49:	48 85 c0             	test   %rax,%rax
+  801d4c:	74 1b                	je     801d69 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d4e:	4c 89 e6             	mov    %r12,%rsi
+  801d51:	48 89 df             	mov    %rbx,%rdi
+  801d54:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d60:	48 83 c4 10          	add    $0x10,%rsp
+  801d64:	5b                   	pop    %rbx
+  801d65:	41 5c                	pop    %r12
+  801d67:	5d                   	pop    %rbp
+  801d68:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d69:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d6e:	eb f0                	jmp    801d60 <create_snapshot+0x49>
+
+0000000000801d70 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d70:	55                   	push   %rbp
+  801d71:	48 89 e5             	mov    %rsp,%rbp
+  801d74:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d78:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d7c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d81:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 1e                	js     801daf <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801d91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d95:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801d99:	48 85 d2             	test   %rdx,%rdx
+  801d9c:	74 13                	je     801db1 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da3:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dac:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+        return -E_NOT_SUPP;
+  801db1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801db6:	eb f7                	jmp    801daf <print_snapshot_list+0x3f>
+
+0000000000801db8 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801db8:	55                   	push   %rbp
+  801db9:	48 89 e5             	mov    %rsp,%rbp
+  801dbc:	53                   	push   %rbx
+  801dbd:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dc4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc8:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dcd:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 1c                	js     801df9 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801ddd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de1:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801de5:	48 85 c0             	test   %rax,%rax
+  801de8:	74 15                	je     801dff <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801dea:	48 89 df             	mov    %rbx,%rdi
+  801ded:	ff d0                	call   *%rax
+    if (res < 0) {
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801df9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dfd:	c9                   	leave
+  801dfe:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dff:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e04:	eb f3                	jmp    801df9 <accept_snapshot+0x41>
+
+0000000000801e06 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e06:	55                   	push   %rbp
+  801e07:	48 89 e5             	mov    %rsp,%rbp
+  801e0a:	53                   	push   %rbx
+  801e0b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0f:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e12:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e16:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e1b:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 1c                	js     801e47 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e2f:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e33:	48 85 c0             	test   %rax,%rax
+  801e36:	74 15                	je     801e4d <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e38:	48 89 df             	mov    %rbx,%rdi
+  801e3b:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e44:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e4b:	c9                   	leave
+  801e4c:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e4d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e52:	eb f3                	jmp    801e47 <delete_snapshot+0x41>
+
+0000000000801e54 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e54:	55                   	push   %rbp
+  801e55:	48 89 e5             	mov    %rsp,%rbp
+  801e58:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e5c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e60:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e65:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 14                	js     801e89 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e79:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e7d:	48 85 d2             	test   %rdx,%rdx
+  801e80:	74 09                	je     801e8b <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801e89:	c9                   	leave
+  801e8a:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e8b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e90:	eb f7                	jmp    801e89 <gc_snapshots+0x35>
+
+0000000000801e92 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801e92:	55                   	push   %rbp
+  801e93:	48 89 e5             	mov    %rsp,%rbp
+  801e96:	41 56                	push   %r14
+  801e98:	41 55                	push   %r13
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+  801e9d:	48 83 ec 10          	sub    $0x10,%rsp
+  801ea1:	48 89 fb             	mov    %rdi,%rbx
+  801ea4:	49 89 f4             	mov    %rsi,%r12
+  801ea7:	49 89 d5             	mov    %rdx,%r13
+  801eaa:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ead:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eb1:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eb6:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801ebd:	00 00 00 
+  801ec0:	ff d0                	call   *%rax
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 1b                	js     801ee1 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ec6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eca:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801ece:	48 85 c0             	test   %rax,%rax
+  801ed1:	74 1b                	je     801eee <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ed3:	4c 89 f1             	mov    %r14,%rcx
+  801ed6:	4c 89 ea             	mov    %r13,%rdx
+  801ed9:	4c 89 e6             	mov    %r12,%rsi
+  801edc:	48 89 df             	mov    %rbx,%rdi
+  801edf:	ff d0                	call   *%rax
+
+    return res;
+}
+  801ee1:	48 83 c4 10          	add    $0x10,%rsp
+  801ee5:	5b                   	pop    %rbx
+  801ee6:	41 5c                	pop    %r12
+  801ee8:	41 5d                	pop    %r13
+  801eea:	41 5e                	pop    %r14
+  801eec:	5d                   	pop    %rbp
+  801eed:	c3                   	ret
+        return -E_NOT_SUPP;
+  801eee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ef3:	eb ec                	jmp    801ee1 <diff_snapshots+0x4f>
+
+0000000000801ef5 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801ef5:	55                   	push   %rbp
+  801ef6:	48 89 e5             	mov    %rsp,%rbp
+  801ef9:	41 55                	push   %r13
+  801efb:	41 54                	push   %r12
+  801efd:	53                   	push   %rbx
+  801efe:	48 83 ec 18          	sub    $0x18,%rsp
+  801f02:	48 89 fb             	mov    %rdi,%rbx
+  801f05:	49 89 f4             	mov    %rsi,%r12
+  801f08:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f0b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f0f:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f14:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 18                	js     801f3c <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f28:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f2c:	48 85 c0             	test   %rax,%rax
+  801f2f:	74 16                	je     801f47 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f31:	4c 89 ea             	mov    %r13,%rdx
+  801f34:	4c 89 e6             	mov    %r12,%rsi
+  801f37:	48 89 df             	mov    %rbx,%rdi
+  801f3a:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f3c:	48 83 c4 18          	add    $0x18,%rsp
+  801f40:	5b                   	pop    %rbx
+  801f41:	41 5c                	pop    %r12
+  801f43:	41 5d                	pop    %r13
+  801f45:	5d                   	pop    %rbp
+  801f46:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f47:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f4c:	eb ee                	jmp    801f3c <send_snapshot+0x47>
+
+0000000000801f4e <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f4e:	55                   	push   %rbp
+  801f4f:	48 89 e5             	mov    %rsp,%rbp
+  801f52:	53                   	push   %rbx
+  801f53:	48 83 ec 18          	sub    $0x18,%rsp
+  801f57:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f5a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f5e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f63:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	78 12                	js     801f85 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f77:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f7b:	48 85 c0             	test   %rax,%rax
+  801f7e:	74 0b                	je     801f8b <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f80:	48 89 df             	mov    %rbx,%rdi
+  801f83:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f89:	c9                   	leave
+  801f8a:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f8b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f90:	eb f3                	jmp    801f85 <receive_snapshot+0x37>
+
+0000000000801f92 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801f92:	55                   	push   %rbp
+  801f93:	48 89 e5             	mov    %rsp,%rbp
+  801f96:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f9e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fa3:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 17                	js     801fca <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb7:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fbe:	48 85 d2             	test   %rdx,%rdx
+  801fc1:	74 09                	je     801fcc <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc8:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fcc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd1:	eb f7                	jmp    801fca <free_space_bytes+0x38>
+
+0000000000801fd3 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+  801fd7:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fdb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fdf:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fe4:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+  801ff0:	85 c0                	test   %eax,%eax
+  801ff2:	78 17                	js     80200b <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801ff4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff8:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801fff:	48 85 d2             	test   %rdx,%rdx
+  802002:	74 09                	je     80200d <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802004:	b8 00 00 00 00       	mov    $0x0,%eax
+  802009:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80200d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802012:	eb f7                	jmp    80200b <busy_space_bytes+0x38>
+
+0000000000802014 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	41 54                	push   %r12
+  80201a:	53                   	push   %rbx
+  80201b:	48 83 ec 10          	sub    $0x10,%rsp
+  80201f:	89 fb                	mov    %edi,%ebx
+  802021:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802024:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802028:	bf 66 00 00 00       	mov    $0x66,%edi
+  80202d:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	85 c0                	test   %eax,%eax
+  80203b:	78 17                	js     802054 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80203d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802041:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802048:	48 85 c0             	test   %rax,%rax
+  80204b:	74 10                	je     80205d <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80204d:	4c 89 e6             	mov    %r12,%rsi
+  802050:	89 df                	mov    %ebx,%edi
+  802052:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802054:	48 83 c4 10          	add    $0x10,%rsp
+  802058:	5b                   	pop    %rbx
+  802059:	41 5c                	pop    %r12
+  80205b:	5d                   	pop    %rbp
+  80205c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80205d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802062:	eb f0                	jmp    802054 <snapshots_space+0x40>
+
+0000000000802064 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802064:	55                   	push   %rbp
+  802065:	48 89 e5             	mov    %rsp,%rbp
+  802068:	41 55                	push   %r13
+  80206a:	41 54                	push   %r12
+  80206c:	53                   	push   %rbx
+  80206d:	48 83 ec 08          	sub    $0x8,%rsp
+  802071:	41 89 fd             	mov    %edi,%r13d
+  802074:	48 89 f3             	mov    %rsi,%rbx
+  802077:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80207a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802081:	00 00 00 
+  802084:	83 38 00             	cmpl   $0x0,(%rax)
+  802087:	74 57                	je     8020e0 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802089:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80208f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802094:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80209b:	00 00 00 
+  80209e:	44 89 ee             	mov    %r13d,%esi
+  8020a1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a8:	00 00 00 
+  8020ab:	8b 38                	mov    (%rax),%edi
+  8020ad:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020be:	4c 89 e2             	mov    %r12,%rdx
+  8020c1:	48 89 de             	mov    %rbx,%rsi
+  8020c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c9:	48 b8 6c 35 80 00 00 	movabs $0x80356c,%rax
+  8020d0:	00 00 00 
+  8020d3:	ff d0                	call   *%rax
+}
+  8020d5:	48 83 c4 08          	add    $0x8,%rsp
+  8020d9:	5b                   	pop    %rbx
+  8020da:	41 5c                	pop    %r12
+  8020dc:	41 5d                	pop    %r13
+  8020de:	5d                   	pop    %rbp
+  8020df:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020e0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020e5:	48 b8 42 36 80 00 00 	movabs $0x803642,%rax
+  8020ec:	00 00 00 
+  8020ef:	ff d0                	call   *%rax
+  8020f1:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020f8:	00 00 
+  8020fa:	eb 8d                	jmp    802089 <fsipc_region+0x25>
+
+00000000008020fc <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020fc:	55                   	push   %rbp
+  8020fd:	48 89 e5             	mov    %rsp,%rbp
+  802100:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802104:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80210b:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80210c:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802110:	48 b8 64 20 80 00 00 	movabs $0x802064,%rax
+  802117:	00 00 00 
+  80211a:	ff d0                	call   *%rax
+}
+  80211c:	c9                   	leave
+  80211d:	c3                   	ret
+
+000000000080211e <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80211e:	85 ff                	test   %edi,%edi
+  802120:	78 6d                	js     80218f <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802122:	55                   	push   %rbp
+  802123:	48 89 e5             	mov    %rsp,%rbp
+  802126:	41 54                	push   %r12
+  802128:	53                   	push   %rbx
+  802129:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80212c:	48 85 f6             	test   %rsi,%rsi
+  80212f:	74 57                	je     802188 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802131:	89 f8                	mov    %edi,%eax
+  802133:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80213a:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80213c:	be 00 00 00 00       	mov    $0x0,%esi
+  802141:	bf 12 00 00 00       	mov    $0x12,%edi
+  802146:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 2d                	js     802183 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802156:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80215d:	00 00 00 
+  802160:	49 63 14 24          	movslq (%r12),%rdx
+  802164:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80216b:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802170:	48 89 df             	mov    %rbx,%rdi
+  802173:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80217f:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802183:	5b                   	pop    %rbx
+  802184:	41 5c                	pop    %r12
+  802186:	5d                   	pop    %rbp
+  802187:	c3                   	ret
+        return -E_INVAL;
+  802188:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80218d:	eb f4                	jmp    802183 <devfile_df_snapshots+0x65>
+  80218f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802194:	c3                   	ret
+
+0000000000802195 <devfile_df_busy>:
+devfile_df_busy() {
+  802195:	55                   	push   %rbp
+  802196:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802199:	be 00 00 00 00       	mov    $0x0,%esi
+  80219e:	bf 11 00 00 00       	mov    $0x11,%edi
+  8021a3:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+}
+  8021af:	5d                   	pop    %rbp
+  8021b0:	c3                   	ret
+
+00000000008021b1 <devfile_df_free>:
+devfile_df_free() {
+  8021b1:	55                   	push   %rbp
+  8021b2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ba:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021bf:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+}
+  8021cb:	5d                   	pop    %rbp
+  8021cc:	c3                   	ret
+
+00000000008021cd <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021db:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+}
+  8021e7:	5d                   	pop    %rbp
+  8021e8:	c3                   	ret
+
+00000000008021e9 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8021e9:	55                   	push   %rbp
+  8021ea:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8021ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f2:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021f7:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8021fe:	00 00 00 
+  802201:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802203:	85 c0                	test   %eax,%eax
+  802205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80220d:	5d                   	pop    %rbp
+  80220e:	c3                   	ret
+
+000000000080220f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80220f:	55                   	push   %rbp
+  802210:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802213:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80221a:	00 00 00 
+  80221d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802220:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802222:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802225:	be 00 00 00 00       	mov    $0x0,%esi
+  80222a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80222f:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+}
+  80223b:	5d                   	pop    %rbp
+  80223c:	c3                   	ret
+
+000000000080223d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80223d:	55                   	push   %rbp
+  80223e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802241:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802244:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80224b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80224d:	be 00 00 00 00       	mov    $0x0,%esi
+  802252:	bf 06 00 00 00       	mov    $0x6,%edi
+  802257:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  80225e:	00 00 00 
+  802261:	ff d0                	call   *%rax
+}
+  802263:	5d                   	pop    %rbp
+  802264:	c3                   	ret
+
+0000000000802265 <devfile_write>:
+    if (!fd || !buf) {
+  802265:	48 85 ff             	test   %rdi,%rdi
+  802268:	0f 84 c1 00 00 00    	je     80232f <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	41 57                	push   %r15
+  802274:	41 56                	push   %r14
+  802276:	41 55                	push   %r13
+  802278:	41 54                	push   %r12
+  80227a:	53                   	push   %rbx
+  80227b:	48 83 ec 18          	sub    $0x18,%rsp
+  80227f:	49 89 ff             	mov    %rdi,%r15
+  802282:	49 89 f5             	mov    %rsi,%r13
+  802285:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802288:	48 85 f6             	test   %rsi,%rsi
+  80228b:	0f 84 95 00 00 00    	je     802326 <devfile_write+0xc1>
+    while (n) {
+  802291:	48 85 d2             	test   %rdx,%rdx
+  802294:	0f 84 83 00 00 00    	je     80231d <devfile_write+0xb8>
+    int totalWrite = 0;
+  80229a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022a1:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022a8:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022ab:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022b0:	49 39 dc             	cmp    %rbx,%r12
+  8022b3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022b7:	48 89 da             	mov    %rbx,%rdx
+  8022ba:	4c 89 ee             	mov    %r13,%rsi
+  8022bd:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022c4:	00 00 00 
+  8022c7:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022d3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022d7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022da:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022de:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e8:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+        if (write < 0) {
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	78 21                	js     802319 <devfile_write+0xb4>
+        buf += write;
+  8022f8:	48 63 d0             	movslq %eax,%rdx
+  8022fb:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8022fe:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802301:	49 29 d4             	sub    %rdx,%r12
+  802304:	75 a5                	jne    8022ab <devfile_write+0x46>
+    return totalWrite;
+  802306:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80230a:	48 83 c4 18          	add    $0x18,%rsp
+  80230e:	5b                   	pop    %rbx
+  80230f:	41 5c                	pop    %r12
+  802311:	41 5d                	pop    %r13
+  802313:	41 5e                	pop    %r14
+  802315:	41 5f                	pop    %r15
+  802317:	5d                   	pop    %rbp
+  802318:	c3                   	ret
+            return write;
+  802319:	48 98                	cltq
+  80231b:	eb ed                	jmp    80230a <devfile_write+0xa5>
+    int totalWrite = 0;
+  80231d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802324:	eb e0                	jmp    802306 <devfile_write+0xa1>
+        return -E_INVAL;
+  802326:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80232d:	eb db                	jmp    80230a <devfile_write+0xa5>
+  80232f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802336:	c3                   	ret
+
+0000000000802337 <devfile_read>:
+    if (!fd || !buf) {
+  802337:	48 85 ff             	test   %rdi,%rdi
+  80233a:	0f 84 c0 00 00 00    	je     802400 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802340:	55                   	push   %rbp
+  802341:	48 89 e5             	mov    %rsp,%rbp
+  802344:	41 57                	push   %r15
+  802346:	41 56                	push   %r14
+  802348:	41 55                	push   %r13
+  80234a:	41 54                	push   %r12
+  80234c:	53                   	push   %rbx
+  80234d:	48 83 ec 18          	sub    $0x18,%rsp
+  802351:	49 89 ff             	mov    %rdi,%r15
+  802354:	49 89 f5             	mov    %rsi,%r13
+  802357:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80235a:	48 85 f6             	test   %rsi,%rsi
+  80235d:	0f 84 96 00 00 00    	je     8023f9 <devfile_read+0xc2>
+    while (n) {
+  802363:	48 85 d2             	test   %rdx,%rdx
+  802366:	0f 84 87 00 00 00    	je     8023f3 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80236c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802373:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802374:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80237b:	00 00 00 
+  80237e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802382:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802385:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80238a:	49 39 c4             	cmp    %rax,%r12
+  80238d:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802391:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802395:	be 00 00 00 00       	mov    $0x0,%esi
+  80239a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80239f:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	7e 37                	jle    8023e6 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023af:	48 63 d8             	movslq %eax,%rbx
+  8023b2:	48 89 da             	mov    %rbx,%rdx
+  8023b5:	4c 89 f6             	mov    %r14,%rsi
+  8023b8:	4c 89 ef             	mov    %r13,%rdi
+  8023bb:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+        buf += read;
+  8023c7:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023ca:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023ce:	49 29 dc             	sub    %rbx,%r12
+  8023d1:	75 ab                	jne    80237e <devfile_read+0x47>
+  return totalRead;
+  8023d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023d7:	48 83 c4 18          	add    $0x18,%rsp
+  8023db:	5b                   	pop    %rbx
+  8023dc:	41 5c                	pop    %r12
+  8023de:	41 5d                	pop    %r13
+  8023e0:	41 5e                	pop    %r14
+  8023e2:	41 5f                	pop    %r15
+  8023e4:	5d                   	pop    %rbp
+  8023e5:	c3                   	ret
+            return read ? read : totalRead;
+  8023e6:	48 63 d0             	movslq %eax,%rdx
+  8023e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023ed:	48 0f 45 c2          	cmovne %rdx,%rax
+  8023f1:	eb e4                	jmp    8023d7 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8023f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8023f7:	eb da                	jmp    8023d3 <devfile_read+0x9c>
+        return E_INVAL;
+  8023f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023fe:	eb d7                	jmp    8023d7 <devfile_read+0xa0>
+  802400:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802405:	c3                   	ret
+
+0000000000802406 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802406:	48 85 ff             	test   %rdi,%rdi
+  802409:	74 5f                	je     80246a <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80240b:	55                   	push   %rbp
+  80240c:	48 89 e5             	mov    %rsp,%rbp
+  80240f:	53                   	push   %rbx
+  802410:	48 83 ec 08          	sub    $0x8,%rsp
+  802414:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802417:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802429:	77 45                	ja     802470 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80242b:	48 89 de             	mov    %rbx,%rsi
+  80242e:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802435:	00 00 00 
+  802438:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802444:	be 00 00 00 00       	mov    $0x0,%esi
+  802449:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80244e:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802461:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802464:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802468:	c9                   	leave
+  802469:	c3                   	ret
+        return -E_INVAL;
+  80246a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80246f:	c3                   	ret
+        return -E_INVAL;
+  802470:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802475:	eb ed                	jmp    802464 <devfile_receive_snapshot+0x5e>
+
+0000000000802477 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802477:	55                   	push   %rbp
+  802478:	48 89 e5             	mov    %rsp,%rbp
+  80247b:	41 55                	push   %r13
+  80247d:	41 54                	push   %r12
+  80247f:	53                   	push   %rbx
+  802480:	48 83 ec 08          	sub    $0x8,%rsp
+  802484:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802487:	48 85 f6             	test   %rsi,%rsi
+  80248a:	0f 94 c0             	sete   %al
+  80248d:	48 85 d2             	test   %rdx,%rdx
+  802490:	0f 94 c2             	sete   %dl
+  802493:	08 d0                	or     %dl,%al
+  802495:	0f 85 ad 00 00 00    	jne    802548 <devfile_send_snapshot+0xd1>
+  80249b:	48 89 fb             	mov    %rdi,%rbx
+  80249e:	49 89 f4             	mov    %rsi,%r12
+  8024a1:	48 85 ff             	test   %rdi,%rdi
+  8024a4:	0f 84 9e 00 00 00    	je     802548 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024aa:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8024b1:	00 00 00 
+  8024b4:	ff d0                	call   *%rax
+  8024b6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024bc:	0f 87 8d 00 00 00    	ja     80254f <devfile_send_snapshot+0xd8>
+  8024c2:	4c 89 e7             	mov    %r12,%rdi
+  8024c5:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+  8024d1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024d7:	77 7d                	ja     802556 <devfile_send_snapshot+0xdf>
+  8024d9:	4c 89 ef             	mov    %r13,%rdi
+  8024dc:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+  8024e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024ee:	77 6d                	ja     80255d <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8024f0:	48 89 de             	mov    %rbx,%rsi
+  8024f3:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024fa:	00 00 00 
+  8024fd:	48 bb f5 0a 80 00 00 	movabs $0x800af5,%rbx
+  802504:	00 00 00 
+  802507:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802509:	4c 89 e6             	mov    %r12,%rsi
+  80250c:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802513:	00 00 00 
+  802516:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802518:	4c 89 ee             	mov    %r13,%rsi
+  80251b:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802522:	00 00 00 
+  802525:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802527:	be 00 00 00 00       	mov    $0x0,%esi
+  80252c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802531:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+}
+  80253d:	48 83 c4 08          	add    $0x8,%rsp
+  802541:	5b                   	pop    %rbx
+  802542:	41 5c                	pop    %r12
+  802544:	41 5d                	pop    %r13
+  802546:	5d                   	pop    %rbp
+  802547:	c3                   	ret
+        return -E_INVAL;
+  802548:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254d:	eb ee                	jmp    80253d <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80254f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802554:	eb e7                	jmp    80253d <devfile_send_snapshot+0xc6>
+  802556:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255b:	eb e0                	jmp    80253d <devfile_send_snapshot+0xc6>
+  80255d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802562:	eb d9                	jmp    80253d <devfile_send_snapshot+0xc6>
+
+0000000000802564 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802564:	48 85 ff             	test   %rdi,%rdi
+  802567:	0f 84 41 01 00 00    	je     8026ae <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+  802571:	41 57                	push   %r15
+  802573:	41 56                	push   %r14
+  802575:	41 55                	push   %r13
+  802577:	41 54                	push   %r12
+  802579:	53                   	push   %rbx
+  80257a:	48 83 ec 08          	sub    $0x8,%rsp
+  80257e:	49 89 fc             	mov    %rdi,%r12
+  802581:	49 89 f5             	mov    %rsi,%r13
+  802584:	48 89 d3             	mov    %rdx,%rbx
+  802587:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80258a:	48 85 f6             	test   %rsi,%rsi
+  80258d:	0f 84 ff 00 00 00    	je     802692 <devfile_diff_snapshots+0x12e>
+  802593:	48 85 d2             	test   %rdx,%rdx
+  802596:	0f 84 fd 00 00 00    	je     802699 <devfile_diff_snapshots+0x135>
+  80259c:	48 85 c9             	test   %rcx,%rcx
+  80259f:	0f 84 f4 00 00 00    	je     802699 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8025a5:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+  8025b1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025b7:	0f 87 e3 00 00 00    	ja     8026a0 <devfile_diff_snapshots+0x13c>
+  8025bd:	4c 89 ef             	mov    %r13,%rdi
+  8025c0:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+  8025cc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025d2:	0f 87 cf 00 00 00    	ja     8026a7 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025d8:	4c 89 e6             	mov    %r12,%rsi
+  8025db:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8025e2:	00 00 00 
+  8025e5:	4c 89 e7             	mov    %r12,%rdi
+  8025e8:	49 bf f5 0a 80 00 00 	movabs $0x800af5,%r15
+  8025ef:	00 00 00 
+  8025f2:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8025f5:	4c 89 ee             	mov    %r13,%rsi
+  8025f8:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8025ff:	00 
+  802600:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802603:	48 8b 03             	mov    (%rbx),%rax
+  802606:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80260d:	00 
+  80260e:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802612:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802619:	00 
+  80261a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80261e:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802625:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802626:	be 00 00 00 00       	mov    $0x0,%esi
+  80262b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802630:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80263c:	85 c0                	test   %eax,%eax
+  80263e:	78 43                	js     802683 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802640:	49 8b 04 24          	mov    (%r12),%rax
+  802644:	48 89 03             	mov    %rax,(%rbx)
+  802647:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80264c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802650:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802655:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802659:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80265e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802662:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802666:	48 c1 e2 03          	shl    $0x3,%rdx
+  80266a:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80266f:	4c 89 f7             	mov    %r14,%rdi
+  802672:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80267e:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802683:	48 83 c4 08          	add    $0x8,%rsp
+  802687:	5b                   	pop    %rbx
+  802688:	41 5c                	pop    %r12
+  80268a:	41 5d                	pop    %r13
+  80268c:	41 5e                	pop    %r14
+  80268e:	41 5f                	pop    %r15
+  802690:	5d                   	pop    %rbp
+  802691:	c3                   	ret
+        return -E_INVAL;
+  802692:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802697:	eb ea                	jmp    802683 <devfile_diff_snapshots+0x11f>
+  802699:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80269e:	eb e3                	jmp    802683 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a5:	eb dc                	jmp    802683 <devfile_diff_snapshots+0x11f>
+  8026a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ac:	eb d5                	jmp    802683 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026b3:	c3                   	ret
+
+00000000008026b4 <devfile_delete_snapshot>:
+    if (!name) {
+  8026b4:	48 85 ff             	test   %rdi,%rdi
+  8026b7:	74 5f                	je     802718 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026b9:	55                   	push   %rbp
+  8026ba:	48 89 e5             	mov    %rsp,%rbp
+  8026bd:	53                   	push   %rbx
+  8026be:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026c5:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+  8026d1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026d7:	77 45                	ja     80271e <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026d9:	48 89 de             	mov    %rbx,%rsi
+  8026dc:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026e3:	00 00 00 
+  8026e6:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  8026ed:	00 00 00 
+  8026f0:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8026f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026fc:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802712:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802716:	c9                   	leave
+  802717:	c3                   	ret
+        return -E_INVAL;
+  802718:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80271d:	c3                   	ret
+        return -E_INVAL;
+  80271e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802723:	eb ed                	jmp    802712 <devfile_delete_snapshot+0x5e>
+
+0000000000802725 <devfile_accept_snapshot>:
+    if (!name) {
+  802725:	48 85 ff             	test   %rdi,%rdi
+  802728:	74 5f                	je     802789 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80272a:	55                   	push   %rbp
+  80272b:	48 89 e5             	mov    %rsp,%rbp
+  80272e:	53                   	push   %rbx
+  80272f:	48 83 ec 08          	sub    $0x8,%rsp
+  802733:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802736:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+  802742:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802748:	77 45                	ja     80278f <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80274a:	48 89 de             	mov    %rbx,%rsi
+  80274d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802754:	00 00 00 
+  802757:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802763:	be 00 00 00 00       	mov    $0x0,%esi
+  802768:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80276d:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802774:	00 00 00 
+  802777:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802779:	85 c0                	test   %eax,%eax
+  80277b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802780:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802783:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+        return -E_INVAL;
+  802789:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80278e:	c3                   	ret
+        return -E_INVAL;
+  80278f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802794:	eb ed                	jmp    802783 <devfile_accept_snapshot+0x5e>
+
+0000000000802796 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802796:	48 85 ff             	test   %rdi,%rdi
+  802799:	0f 84 9f 00 00 00    	je     80283e <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	41 54                	push   %r12
+  8027a5:	53                   	push   %rbx
+  8027a6:	48 89 fb             	mov    %rdi,%rbx
+  8027a9:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027ac:	48 85 f6             	test   %rsi,%rsi
+  8027af:	74 78                	je     802829 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027b1:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8027b8:	00 00 00 
+  8027bb:	ff d0                	call   *%rax
+  8027bd:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027c3:	77 6b                	ja     802830 <devfile_create_snapshot+0x9a>
+  8027c5:	4c 89 e7             	mov    %r12,%rdi
+  8027c8:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  8027cf:	00 00 00 
+  8027d2:	ff d0                	call   *%rax
+  8027d4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027da:	77 5b                	ja     802837 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027dc:	48 89 de             	mov    %rbx,%rsi
+  8027df:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027e6:	00 00 00 
+  8027e9:	48 bb f5 0a 80 00 00 	movabs $0x800af5,%rbx
+  8027f0:	00 00 00 
+  8027f3:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8027f5:	4c 89 e6             	mov    %r12,%rsi
+  8027f8:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8027ff:	00 00 00 
+  802802:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802804:	be 00 00 00 00       	mov    $0x0,%esi
+  802809:	bf 08 00 00 00       	mov    $0x8,%edi
+  80280e:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802821:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802824:	5b                   	pop    %rbx
+  802825:	41 5c                	pop    %r12
+  802827:	5d                   	pop    %rbp
+  802828:	c3                   	ret
+        return -E_INVAL;
+  802829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80282e:	eb f4                	jmp    802824 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802830:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802835:	eb ed                	jmp    802824 <devfile_create_snapshot+0x8e>
+  802837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80283c:	eb e6                	jmp    802824 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80283e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802843:	c3                   	ret
+
+0000000000802844 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802844:	55                   	push   %rbp
+  802845:	48 89 e5             	mov    %rsp,%rbp
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80284e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802851:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802858:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80285a:	be 00 00 00 00       	mov    $0x0,%esi
+  80285f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802864:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802870:	85 c0                	test   %eax,%eax
+  802872:	78 3d                	js     8028b1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802874:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80287b:	00 00 00 
+  80287e:	4c 89 e6             	mov    %r12,%rsi
+  802881:	48 89 df             	mov    %rbx,%rdi
+  802884:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802890:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802897:	00 
+  802898:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80289e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8028a5:	00 
+  8028a6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b1:	5b                   	pop    %rbx
+  8028b2:	41 5c                	pop    %r12
+  8028b4:	5d                   	pop    %rbp
+  8028b5:	c3                   	ret
+
+00000000008028b6 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028b6:	55                   	push   %rbp
+  8028b7:	48 89 e5             	mov    %rsp,%rbp
+  8028ba:	41 57                	push   %r15
+  8028bc:	41 56                	push   %r14
+  8028be:	41 55                	push   %r13
+  8028c0:	41 54                	push   %r12
+  8028c2:	53                   	push   %rbx
+  8028c3:	48 83 ec 38          	sub    $0x38,%rsp
+  8028c7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028cb:	49 89 f5             	mov    %rsi,%r13
+  8028ce:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028d1:	48 89 f0             	mov    %rsi,%rax
+  8028d4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028d9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028dd:	75 4f                	jne    80292e <devfile_readmap+0x78>
+  8028df:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028e3:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028e9:	75 1f                	jne    80290a <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8028eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028ef:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8028f3:	49 be 9e 30 80 00 00 	movabs $0x80309e,%r14
+  8028fa:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028fd:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802904:	0f 87 9d 00 00 00    	ja     8029a7 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  80290a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80290e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802912:	4d 85 ff             	test   %r15,%r15
+  802915:	0f 85 cf 00 00 00    	jne    8029ea <devfile_readmap+0x134>
+  80291b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80291f:	48 83 c4 38          	add    $0x38,%rsp
+  802923:	5b                   	pop    %rbx
+  802924:	41 5c                	pop    %r12
+  802926:	41 5d                	pop    %r13
+  802928:	41 5e                	pop    %r14
+  80292a:	41 5f                	pop    %r15
+  80292c:	5d                   	pop    %rbp
+  80292d:	c3                   	ret
+    size_t totalRead = 0;
+  80292e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802935:	00 
+  802936:	eb da                	jmp    802912 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802938:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80293c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80293f:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802946:	00 00 00 
+  802949:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  80294b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294f:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802953:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802957:	4c 89 ee             	mov    %r13,%rsi
+  80295a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80295f:	48 b8 64 20 80 00 00 	movabs $0x802064,%rax
+  802966:	00 00 00 
+  802969:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  80296b:	85 c0                	test   %eax,%eax
+  80296d:	7e a3                	jle    802912 <devfile_readmap+0x5c>
+  80296f:	48 98                	cltq
+  802971:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802975:	72 9b                	jb     802912 <devfile_readmap+0x5c>
+        buf += read;
+  802977:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  80297a:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  80297d:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802981:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802988:	75 88                	jne    802912 <devfile_readmap+0x5c>
+  80298a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80298e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802994:	0f 85 78 ff ff ff    	jne    802912 <devfile_readmap+0x5c>
+  80299a:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  8029a1:	0f 86 6b ff ff ff    	jbe    802912 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029a7:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029ad:	4d 39 e7             	cmp    %r12,%r15
+  8029b0:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029b4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029bb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029bf:	0f 84 73 ff ff ff    	je     802938 <devfile_readmap+0x82>
+  8029c5:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029c9:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029ce:	41 ff d6             	call   *%r14
+  8029d1:	a8 40                	test   $0x40,%al
+  8029d3:	0f 85 39 ff ff ff    	jne    802912 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029d9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029e0:	4c 39 e3             	cmp    %r12,%rbx
+  8029e3:	72 e4                	jb     8029c9 <devfile_readmap+0x113>
+  8029e5:	e9 4e ff ff ff       	jmp    802938 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8029ea:	4c 89 fa             	mov    %r15,%rdx
+  8029ed:	4c 89 ee             	mov    %r13,%rsi
+  8029f0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029f4:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a00:	48 85 c0             	test   %rax,%rax
+  802a03:	78 0c                	js     802a11 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a05:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a09:	48 01 f0             	add    %rsi,%rax
+  802a0c:	e9 0e ff ff ff       	jmp    80291f <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a11:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a15:	48 85 f6             	test   %rsi,%rsi
+  802a18:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a1c:	e9 fe fe ff ff       	jmp    80291f <devfile_readmap+0x69>
+
+0000000000802a21 <open>:
+open(const char *path, int mode) {
+  802a21:	55                   	push   %rbp
+  802a22:	48 89 e5             	mov    %rsp,%rbp
+  802a25:	41 55                	push   %r13
+  802a27:	41 54                	push   %r12
+  802a29:	53                   	push   %rbx
+  802a2a:	48 83 ec 18          	sub    $0x18,%rsp
+  802a2e:	49 89 fc             	mov    %rdi,%r12
+  802a31:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a34:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+  802a40:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a46:	0f 87 8a 00 00 00    	ja     802ad6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a4c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a50:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+  802a5c:	89 c3                	mov    %eax,%ebx
+  802a5e:	85 c0                	test   %eax,%eax
+  802a60:	78 50                	js     802ab2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a62:	4c 89 e6             	mov    %r12,%rsi
+  802a65:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a6c:	00 00 00 
+  802a6f:	48 89 df             	mov    %rbx,%rdi
+  802a72:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a7e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a85:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a89:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a8e:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+  802a9a:	89 c3                	mov    %eax,%ebx
+  802a9c:	85 c0                	test   %eax,%eax
+  802a9e:	78 1f                	js     802abf <open+0x9e>
+    return fd2num(fd);
+  802aa0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802aa4:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+  802ab0:	89 c3                	mov    %eax,%ebx
+}
+  802ab2:	89 d8                	mov    %ebx,%eax
+  802ab4:	48 83 c4 18          	add    $0x18,%rsp
+  802ab8:	5b                   	pop    %rbx
+  802ab9:	41 5c                	pop    %r12
+  802abb:	41 5d                	pop    %r13
+  802abd:	5d                   	pop    %rbp
+  802abe:	c3                   	ret
+        fd_close(fd, 0);
+  802abf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ac8:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  802acf:	00 00 00 
+  802ad2:	ff d0                	call   *%rax
+        return res;
+  802ad4:	eb dc                	jmp    802ab2 <open+0x91>
+        return -E_BAD_PATH;
+  802ad6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802adb:	eb d5                	jmp    802ab2 <open+0x91>
+
+0000000000802add <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802ae1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae6:	bf 13 00 00 00       	mov    $0x13,%edi
+  802aeb:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  802af2:	00 00 00 
+  802af5:	ff d0                	call   *%rax
+}
+  802af7:	5d                   	pop    %rbp
+  802af8:	c3                   	ret
+
+0000000000802af9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802af9:	55                   	push   %rbp
+  802afa:	48 89 e5             	mov    %rsp,%rbp
+  802afd:	41 54                	push   %r12
+  802aff:	53                   	push   %rbx
+  802b00:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b03:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802b0a:	00 00 00 
+  802b0d:	ff d0                	call   *%rax
+  802b0f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b12:	48 be 00 3d 80 00 00 	movabs $0x803d00,%rsi
+  802b19:	00 00 00 
+  802b1c:	48 89 df             	mov    %rbx,%rdi
+  802b1f:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  802b26:	00 00 00 
+  802b29:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b2b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b30:	41 2b 04 24          	sub    (%r12),%eax
+  802b34:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b41:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b44:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b4b:	00 00 00 
+  802b4e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5a:	5b                   	pop    %rbx
+  802b5b:	41 5c                	pop    %r12
+  802b5d:	5d                   	pop    %rbp
+  802b5e:	c3                   	ret
+
+0000000000802b5f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b5f:	55                   	push   %rbp
+  802b60:	48 89 e5             	mov    %rsp,%rbp
+  802b63:	41 54                	push   %r12
+  802b65:	53                   	push   %rbx
+  802b66:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b6e:	48 89 fe             	mov    %rdi,%rsi
+  802b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b76:	49 bc 4d 12 80 00 00 	movabs $0x80124d,%r12
+  802b7d:	00 00 00 
+  802b80:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b83:	48 89 df             	mov    %rbx,%rdi
+  802b86:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+  802b92:	48 89 c6             	mov    %rax,%rsi
+  802b95:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9f:	41 ff d4             	call   *%r12
+}
+  802ba2:	5b                   	pop    %rbx
+  802ba3:	41 5c                	pop    %r12
+  802ba5:	5d                   	pop    %rbp
+  802ba6:	c3                   	ret
+
+0000000000802ba7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ba7:	55                   	push   %rbp
+  802ba8:	48 89 e5             	mov    %rsp,%rbp
+  802bab:	41 57                	push   %r15
+  802bad:	41 56                	push   %r14
+  802baf:	41 55                	push   %r13
+  802bb1:	41 54                	push   %r12
+  802bb3:	53                   	push   %rbx
+  802bb4:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb8:	49 89 fc             	mov    %rdi,%r12
+  802bbb:	49 89 f5             	mov    %rsi,%r13
+  802bbe:	49 89 d7             	mov    %rdx,%r15
+  802bc1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bc5:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bd1:	4d 85 ff             	test   %r15,%r15
+  802bd4:	0f 84 af 00 00 00    	je     802c89 <devpipe_write+0xe2>
+  802bda:	48 89 c3             	mov    %rax,%rbx
+  802bdd:	4c 89 f8             	mov    %r15,%rax
+  802be0:	4d 89 ef             	mov    %r13,%r15
+  802be3:	4c 01 e8             	add    %r13,%rax
+  802be6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bea:	49 bd 55 11 80 00 00 	movabs $0x801155,%r13
+  802bf1:	00 00 00 
+            sys_yield();
+  802bf4:	49 be f2 10 80 00 00 	movabs $0x8010f2,%r14
+  802bfb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802bfe:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c01:	48 63 ce             	movslq %esi,%rcx
+  802c04:	48 63 03             	movslq (%rbx),%rax
+  802c07:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c0d:	48 39 c1             	cmp    %rax,%rcx
+  802c10:	72 2e                	jb     802c40 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c12:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c17:	48 89 da             	mov    %rbx,%rdx
+  802c1a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c1f:	4c 89 e7             	mov    %r12,%rdi
+  802c22:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c25:	85 c0                	test   %eax,%eax
+  802c27:	74 66                	je     802c8f <devpipe_write+0xe8>
+            sys_yield();
+  802c29:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c2c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c2f:	48 63 ce             	movslq %esi,%rcx
+  802c32:	48 63 03             	movslq (%rbx),%rax
+  802c35:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c3b:	48 39 c1             	cmp    %rax,%rcx
+  802c3e:	73 d2                	jae    802c12 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c40:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c44:	48 89 ca             	mov    %rcx,%rdx
+  802c47:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c4b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c52:	08 10 20 
+  802c55:	48 f7 e2             	mul    %rdx
+  802c58:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c5c:	48 89 d0             	mov    %rdx,%rax
+  802c5f:	48 c1 e0 09          	shl    $0x9,%rax
+  802c63:	48 29 d0             	sub    %rdx,%rax
+  802c66:	48 c1 e0 03          	shl    $0x3,%rax
+  802c6a:	48 29 c1             	sub    %rax,%rcx
+  802c6d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c72:	83 c6 01             	add    $0x1,%esi
+  802c75:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c78:	49 83 c7 01          	add    $0x1,%r15
+  802c7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c80:	49 39 c7             	cmp    %rax,%r15
+  802c83:	0f 85 75 ff ff ff    	jne    802bfe <devpipe_write+0x57>
+    return n;
+  802c89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c8d:	eb 05                	jmp    802c94 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c94:	48 83 c4 18          	add    $0x18,%rsp
+  802c98:	5b                   	pop    %rbx
+  802c99:	41 5c                	pop    %r12
+  802c9b:	41 5d                	pop    %r13
+  802c9d:	41 5e                	pop    %r14
+  802c9f:	41 5f                	pop    %r15
+  802ca1:	5d                   	pop    %rbp
+  802ca2:	c3                   	ret
+
+0000000000802ca3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ca3:	55                   	push   %rbp
+  802ca4:	48 89 e5             	mov    %rsp,%rbp
+  802ca7:	41 57                	push   %r15
+  802ca9:	41 56                	push   %r14
+  802cab:	41 55                	push   %r13
+  802cad:	41 54                	push   %r12
+  802caf:	53                   	push   %rbx
+  802cb0:	48 83 ec 18          	sub    $0x18,%rsp
+  802cb4:	49 89 fc             	mov    %rdi,%r12
+  802cb7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cbf:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802cc6:	00 00 00 
+  802cc9:	ff d0                	call   *%rax
+  802ccb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cce:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cd4:	49 bd 55 11 80 00 00 	movabs $0x801155,%r13
+  802cdb:	00 00 00 
+            sys_yield();
+  802cde:	49 be f2 10 80 00 00 	movabs $0x8010f2,%r14
+  802ce5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ce8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ced:	74 7d                	je     802d6c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802cef:	8b 03                	mov    (%rbx),%eax
+  802cf1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802cf4:	75 26                	jne    802d1c <devpipe_read+0x79>
+            if (i > 0) return i;
+  802cf6:	4d 85 ff             	test   %r15,%r15
+  802cf9:	75 77                	jne    802d72 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cfb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d00:	48 89 da             	mov    %rbx,%rdx
+  802d03:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d08:	4c 89 e7             	mov    %r12,%rdi
+  802d0b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	74 72                	je     802d84 <devpipe_read+0xe1>
+            sys_yield();
+  802d12:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d15:	8b 03                	mov    (%rbx),%eax
+  802d17:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d1a:	74 df                	je     802cfb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d1c:	48 63 c8             	movslq %eax,%rcx
+  802d1f:	48 89 ca             	mov    %rcx,%rdx
+  802d22:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d26:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d2d:	08 10 20 
+  802d30:	48 89 d0             	mov    %rdx,%rax
+  802d33:	48 f7 e6             	mul    %rsi
+  802d36:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d3a:	48 89 d0             	mov    %rdx,%rax
+  802d3d:	48 c1 e0 09          	shl    $0x9,%rax
+  802d41:	48 29 d0             	sub    %rdx,%rax
+  802d44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d4b:	00 
+  802d4c:	48 89 c8             	mov    %rcx,%rax
+  802d4f:	48 29 d0             	sub    %rdx,%rax
+  802d52:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d57:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d5b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d5f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d62:	49 83 c7 01          	add    $0x1,%r15
+  802d66:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d6a:	75 83                	jne    802cef <devpipe_read+0x4c>
+    return n;
+  802d6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d70:	eb 03                	jmp    802d75 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d72:	4c 89 f8             	mov    %r15,%rax
+}
+  802d75:	48 83 c4 18          	add    $0x18,%rsp
+  802d79:	5b                   	pop    %rbx
+  802d7a:	41 5c                	pop    %r12
+  802d7c:	41 5d                	pop    %r13
+  802d7e:	41 5e                	pop    %r14
+  802d80:	41 5f                	pop    %r15
+  802d82:	5d                   	pop    %rbp
+  802d83:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d89:	eb ea                	jmp    802d75 <devpipe_read+0xd2>
+
+0000000000802d8b <pipe>:
+pipe(int pfd[2]) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	41 55                	push   %r13
+  802d91:	41 54                	push   %r12
+  802d93:	53                   	push   %rbx
+  802d94:	48 83 ec 18          	sub    $0x18,%rsp
+  802d98:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802d9b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d9f:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  802da6:	00 00 00 
+  802da9:	ff d0                	call   *%rax
+  802dab:	89 c3                	mov    %eax,%ebx
+  802dad:	85 c0                	test   %eax,%eax
+  802daf:	0f 88 a0 01 00 00    	js     802f55 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802db5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dbf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc8:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+  802dd4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802dd6:	85 c0                	test   %eax,%eax
+  802dd8:	0f 88 77 01 00 00    	js     802f55 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dde:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802de2:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  802de9:	00 00 00 
+  802dec:	ff d0                	call   *%rax
+  802dee:	89 c3                	mov    %eax,%ebx
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	0f 88 43 01 00 00    	js     802f3b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802df8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dfd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e02:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0b:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+  802e17:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	0f 88 1a 01 00 00    	js     802f3b <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e21:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e25:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+  802e31:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e34:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e3e:	48 89 c6             	mov    %rax,%rsi
+  802e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e46:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  802e52:	89 c3                	mov    %eax,%ebx
+  802e54:	85 c0                	test   %eax,%eax
+  802e56:	0f 88 c5 00 00 00    	js     802f21 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e5c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e60:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+  802e6c:	48 89 c1             	mov    %rax,%rcx
+  802e6f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e75:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e80:	4c 89 ee             	mov    %r13,%rsi
+  802e83:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e88:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  802e8f:	00 00 00 
+  802e92:	ff d0                	call   *%rax
+  802e94:	89 c3                	mov    %eax,%ebx
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	78 6e                	js     802f08 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802e9a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e9f:	4c 89 ef             	mov    %r13,%rdi
+  802ea2:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  802eae:	83 f8 02             	cmp    $0x2,%eax
+  802eb1:	0f 85 ab 00 00 00    	jne    802f62 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802eb7:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802ebe:	00 00 
+  802ec0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ec4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ec6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802eca:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802ed1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ed5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ed7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802edb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802ee2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ee6:	48 bb 51 15 80 00 00 	movabs $0x801551,%rbx
+  802eed:	00 00 00 
+  802ef0:	ff d3                	call   *%rbx
+  802ef2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802ef6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802efa:	ff d3                	call   *%rbx
+  802efc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f06:	eb 4d                	jmp    802f55 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f0d:	4c 89 ee             	mov    %r13,%rsi
+  802f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f15:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  802f1c:	00 00 00 
+  802f1f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f26:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2f:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f40:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f49:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+}
+  802f55:	89 d8                	mov    %ebx,%eax
+  802f57:	48 83 c4 18          	add    $0x18,%rsp
+  802f5b:	5b                   	pop    %rbx
+  802f5c:	41 5c                	pop    %r12
+  802f5e:	41 5d                	pop    %r13
+  802f60:	5d                   	pop    %rbp
+  802f61:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f62:	48 b9 30 3d 80 00 00 	movabs $0x803d30,%rcx
+  802f69:	00 00 00 
+  802f6c:	48 ba 07 3d 80 00 00 	movabs $0x803d07,%rdx
+  802f73:	00 00 00 
+  802f76:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f7b:	48 bf 1c 3d 80 00 00 	movabs $0x803d1c,%rdi
+  802f82:	00 00 00 
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8a:	49 b8 e2 33 80 00 00 	movabs $0x8033e2,%r8
+  802f91:	00 00 00 
+  802f94:	41 ff d0             	call   *%r8
+
+0000000000802f97 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802f97:	55                   	push   %rbp
+  802f98:	48 89 e5             	mov    %rsp,%rbp
+  802f9b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f9f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fa3:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  802faa:	00 00 00 
+  802fad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802faf:	85 c0                	test   %eax,%eax
+  802fb1:	78 35                	js     802fe8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fb3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb7:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fc6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fcb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fd0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fd4:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	0f 94 c0             	sete   %al
+  802fe5:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe8:	c9                   	leave
+  802fe9:	c3                   	ret
+
+0000000000802fea <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802fea:	48 89 f8             	mov    %rdi,%rax
+  802fed:	48 c1 e8 27          	shr    $0x27,%rax
+  802ff1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ff8:	01 00 00 
+  802ffb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802fff:	f6 c2 01             	test   $0x1,%dl
+  803002:	74 6d                	je     803071 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803004:	48 89 f8             	mov    %rdi,%rax
+  803007:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80300b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803012:	01 00 00 
+  803015:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803019:	f6 c2 01             	test   $0x1,%dl
+  80301c:	74 62                	je     803080 <get_uvpt_entry+0x96>
+  80301e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803025:	01 00 00 
+  803028:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80302c:	f6 c2 80             	test   $0x80,%dl
+  80302f:	75 4f                	jne    803080 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803031:	48 89 f8             	mov    %rdi,%rax
+  803034:	48 c1 e8 15          	shr    $0x15,%rax
+  803038:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80303f:	01 00 00 
+  803042:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803046:	f6 c2 01             	test   $0x1,%dl
+  803049:	74 44                	je     80308f <get_uvpt_entry+0xa5>
+  80304b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803052:	01 00 00 
+  803055:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803059:	f6 c2 80             	test   $0x80,%dl
+  80305c:	75 31                	jne    80308f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80305e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803062:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803069:	01 00 00 
+  80306c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803070:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803071:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803078:	01 00 00 
+  80307b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80307f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803080:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803087:	01 00 00 
+  80308a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80308e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80308f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803096:	01 00 00 
+  803099:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80309d:	c3                   	ret
+
+000000000080309e <get_prot>:
+
+int
+get_prot(void *va) {
+  80309e:	55                   	push   %rbp
+  80309f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030a2:	48 b8 ea 2f 80 00 00 	movabs $0x802fea,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+  8030ae:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030b1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030b6:	89 c1                	mov    %eax,%ecx
+  8030b8:	83 c9 04             	or     $0x4,%ecx
+  8030bb:	f6 c2 01             	test   $0x1,%dl
+  8030be:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030c1:	89 c1                	mov    %eax,%ecx
+  8030c3:	83 c9 02             	or     $0x2,%ecx
+  8030c6:	f6 c2 02             	test   $0x2,%dl
+  8030c9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030cc:	89 c1                	mov    %eax,%ecx
+  8030ce:	83 c9 01             	or     $0x1,%ecx
+  8030d1:	48 85 d2             	test   %rdx,%rdx
+  8030d4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030d7:	89 c1                	mov    %eax,%ecx
+  8030d9:	83 c9 40             	or     $0x40,%ecx
+  8030dc:	f6 c6 04             	test   $0x4,%dh
+  8030df:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030e2:	5d                   	pop    %rbp
+  8030e3:	c3                   	ret
+
+00000000008030e4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030e4:	55                   	push   %rbp
+  8030e5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030e8:	48 b8 ea 2f 80 00 00 	movabs $0x802fea,%rax
+  8030ef:	00 00 00 
+  8030f2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8030f4:	48 c1 e8 06          	shr    $0x6,%rax
+  8030f8:	83 e0 01             	and    $0x1,%eax
+}
+  8030fb:	5d                   	pop    %rbp
+  8030fc:	c3                   	ret
+
+00000000008030fd <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8030fd:	55                   	push   %rbp
+  8030fe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803101:	48 b8 ea 2f 80 00 00 	movabs $0x802fea,%rax
+  803108:	00 00 00 
+  80310b:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80310d:	48 c1 e8 05          	shr    $0x5,%rax
+  803111:	83 e0 01             	and    $0x1,%eax
+}
+  803114:	5d                   	pop    %rbp
+  803115:	c3                   	ret
+
+0000000000803116 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803116:	55                   	push   %rbp
+  803117:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80311a:	48 b8 ea 2f 80 00 00 	movabs $0x802fea,%rax
+  803121:	00 00 00 
+  803124:	ff d0                	call   *%rax
+  803126:	83 e0 01             	and    $0x1,%eax
+}
+  803129:	5d                   	pop    %rbp
+  80312a:	c3                   	ret
+
+000000000080312b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80312b:	55                   	push   %rbp
+  80312c:	48 89 e5             	mov    %rsp,%rbp
+  80312f:	41 57                	push   %r15
+  803131:	41 56                	push   %r14
+  803133:	41 55                	push   %r13
+  803135:	41 54                	push   %r12
+  803137:	53                   	push   %rbx
+  803138:	48 83 ec 18          	sub    $0x18,%rsp
+  80313c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803140:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803144:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803149:	49 bd 16 31 80 00 00 	movabs $0x803116,%r13
+  803150:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803153:	49 bf 9e 30 80 00 00 	movabs $0x80309e,%r15
+  80315a:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80315d:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803164:	00 00 00 
+  803167:	eb 0c                	jmp    803175 <foreach_shared_region+0x4a>
+  803169:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803170:	4c 39 f3             	cmp    %r14,%rbx
+  803173:	74 2e                	je     8031a3 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803175:	48 89 df             	mov    %rbx,%rdi
+  803178:	41 ff d5             	call   *%r13
+  80317b:	84 c0                	test   %al,%al
+  80317d:	74 ea                	je     803169 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80317f:	48 89 df             	mov    %rbx,%rdi
+  803182:	41 ff d7             	call   *%r15
+  803185:	a8 40                	test   $0x40,%al
+  803187:	74 e0                	je     803169 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803189:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803190:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803194:	48 89 df             	mov    %rbx,%rdi
+  803197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80319b:	ff d0                	call   *%rax
+				if (res < 0) {
+  80319d:	85 c0                	test   %eax,%eax
+  80319f:	79 c8                	jns    803169 <foreach_shared_region+0x3e>
+  8031a1:	eb 05                	jmp    8031a8 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8031a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031a8:	48 83 c4 18          	add    $0x18,%rsp
+  8031ac:	5b                   	pop    %rbx
+  8031ad:	41 5c                	pop    %r12
+  8031af:	41 5d                	pop    %r13
+  8031b1:	41 5e                	pop    %r14
+  8031b3:	41 5f                	pop    %r15
+  8031b5:	5d                   	pop    %rbp
+  8031b6:	c3                   	ret
+
+00000000008031b7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bc:	c3                   	ret
+
+00000000008031bd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031bd:	55                   	push   %rbp
+  8031be:	48 89 e5             	mov    %rsp,%rbp
+  8031c1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031c4:	48 be 54 3d 80 00 00 	movabs $0x803d54,%rsi
+  8031cb:	00 00 00 
+  8031ce:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  8031d5:	00 00 00 
+  8031d8:	ff d0                	call   *%rax
+    return 0;
+}
+  8031da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031df:	5d                   	pop    %rbp
+  8031e0:	c3                   	ret
+
+00000000008031e1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031e1:	55                   	push   %rbp
+  8031e2:	48 89 e5             	mov    %rsp,%rbp
+  8031e5:	41 57                	push   %r15
+  8031e7:	41 56                	push   %r14
+  8031e9:	41 55                	push   %r13
+  8031eb:	41 54                	push   %r12
+  8031ed:	53                   	push   %rbx
+  8031ee:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031f5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031fc:	48 85 d2             	test   %rdx,%rdx
+  8031ff:	74 7a                	je     80327b <devcons_write+0x9a>
+  803201:	49 89 d6             	mov    %rdx,%r14
+  803204:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80320a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80320f:	49 bf ef 0c 80 00 00 	movabs $0x800cef,%r15
+  803216:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803219:	4c 89 f3             	mov    %r14,%rbx
+  80321c:	48 29 f3             	sub    %rsi,%rbx
+  80321f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803224:	48 39 c3             	cmp    %rax,%rbx
+  803227:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80322b:	4c 63 eb             	movslq %ebx,%r13
+  80322e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803235:	48 01 c6             	add    %rax,%rsi
+  803238:	4c 89 ea             	mov    %r13,%rdx
+  80323b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803242:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803245:	4c 89 ee             	mov    %r13,%rsi
+  803248:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80324f:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  803256:	00 00 00 
+  803259:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80325b:	41 01 dc             	add    %ebx,%r12d
+  80325e:	49 63 f4             	movslq %r12d,%rsi
+  803261:	4c 39 f6             	cmp    %r14,%rsi
+  803264:	72 b3                	jb     803219 <devcons_write+0x38>
+    return res;
+  803266:	49 63 c4             	movslq %r12d,%rax
+}
+  803269:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803270:	5b                   	pop    %rbx
+  803271:	41 5c                	pop    %r12
+  803273:	41 5d                	pop    %r13
+  803275:	41 5e                	pop    %r14
+  803277:	41 5f                	pop    %r15
+  803279:	5d                   	pop    %rbp
+  80327a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80327b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803281:	eb e3                	jmp    803266 <devcons_write+0x85>
+
+0000000000803283 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803283:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328b:	48 85 c0             	test   %rax,%rax
+  80328e:	74 55                	je     8032e5 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803290:	55                   	push   %rbp
+  803291:	48 89 e5             	mov    %rsp,%rbp
+  803294:	41 55                	push   %r13
+  803296:	41 54                	push   %r12
+  803298:	53                   	push   %rbx
+  803299:	48 83 ec 08          	sub    $0x8,%rsp
+  80329d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8032a0:	48 bb 25 10 80 00 00 	movabs $0x801025,%rbx
+  8032a7:	00 00 00 
+  8032aa:	49 bc f2 10 80 00 00 	movabs $0x8010f2,%r12
+  8032b1:	00 00 00 
+  8032b4:	eb 03                	jmp    8032b9 <devcons_read+0x36>
+  8032b6:	41 ff d4             	call   *%r12
+  8032b9:	ff d3                	call   *%rbx
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	74 f7                	je     8032b6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8032bf:	48 63 d0             	movslq %eax,%rdx
+  8032c2:	78 13                	js     8032d7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c9:	83 f8 04             	cmp    $0x4,%eax
+  8032cc:	74 09                	je     8032d7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032ce:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032d2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032d7:	48 89 d0             	mov    %rdx,%rax
+  8032da:	48 83 c4 08          	add    $0x8,%rsp
+  8032de:	5b                   	pop    %rbx
+  8032df:	41 5c                	pop    %r12
+  8032e1:	41 5d                	pop    %r13
+  8032e3:	5d                   	pop    %rbp
+  8032e4:	c3                   	ret
+  8032e5:	48 89 d0             	mov    %rdx,%rax
+  8032e8:	c3                   	ret
+
+00000000008032e9 <cputchar>:
+cputchar(int ch) {
+  8032e9:	55                   	push   %rbp
+  8032ea:	48 89 e5             	mov    %rsp,%rbp
+  8032ed:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032f1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8032fa:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032fe:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  803305:	00 00 00 
+  803308:	ff d0                	call   *%rax
+}
+  80330a:	c9                   	leave
+  80330b:	c3                   	ret
+
+000000000080330c <getchar>:
+getchar(void) {
+  80330c:	55                   	push   %rbp
+  80330d:	48 89 e5             	mov    %rsp,%rbp
+  803310:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803314:	ba 01 00 00 00       	mov    $0x1,%edx
+  803319:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80331d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803322:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  803329:	00 00 00 
+  80332c:	ff d0                	call   *%rax
+  80332e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803330:	85 c0                	test   %eax,%eax
+  803332:	78 06                	js     80333a <getchar+0x2e>
+  803334:	74 08                	je     80333e <getchar+0x32>
+  803336:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80333a:	89 d0                	mov    %edx,%eax
+  80333c:	c9                   	leave
+  80333d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80333e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803343:	eb f5                	jmp    80333a <getchar+0x2e>
+
+0000000000803345 <iscons>:
+iscons(int fdnum) {
+  803345:	55                   	push   %rbp
+  803346:	48 89 e5             	mov    %rsp,%rbp
+  803349:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80334d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803351:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  803358:	00 00 00 
+  80335b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80335d:	85 c0                	test   %eax,%eax
+  80335f:	78 18                	js     803379 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803365:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80336c:	00 00 00 
+  80336f:	8b 00                	mov    (%rax),%eax
+  803371:	39 02                	cmp    %eax,(%rdx)
+  803373:	0f 94 c0             	sete   %al
+  803376:	0f b6 c0             	movzbl %al,%eax
+}
+  803379:	c9                   	leave
+  80337a:	c3                   	ret
+
+000000000080337b <opencons>:
+opencons(void) {
+  80337b:	55                   	push   %rbp
+  80337c:	48 89 e5             	mov    %rsp,%rbp
+  80337f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803383:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803387:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  80338e:	00 00 00 
+  803391:	ff d0                	call   *%rax
+  803393:	85 c0                	test   %eax,%eax
+  803395:	78 49                	js     8033e0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803397:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80339c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033a1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8033a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033aa:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  8033b1:	00 00 00 
+  8033b4:	ff d0                	call   *%rax
+  8033b6:	85 c0                	test   %eax,%eax
+  8033b8:	78 26                	js     8033e0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033be:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033c5:	00 00 
+  8033c7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033cd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033d4:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+}
+  8033e0:	c9                   	leave
+  8033e1:	c3                   	ret
+
+00000000008033e2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033e2:	55                   	push   %rbp
+  8033e3:	48 89 e5             	mov    %rsp,%rbp
+  8033e6:	41 56                	push   %r14
+  8033e8:	41 55                	push   %r13
+  8033ea:	41 54                	push   %r12
+  8033ec:	53                   	push   %rbx
+  8033ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8033f1:	49 89 fc             	mov    %rdi,%r12
+  8033f4:	41 89 f5             	mov    %esi,%r13d
+  8033f7:	48 89 d3             	mov    %rdx,%rbx
+  8033fa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033fe:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803402:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803406:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80340d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803411:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803415:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803419:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80341d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  803424:	00 00 00 
+  803427:	4c 8b 30             	mov    (%rax),%r14
+  80342a:	48 b8 c1 10 80 00 00 	movabs $0x8010c1,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+  803436:	89 c6                	mov    %eax,%esi
+  803438:	45 89 e8             	mov    %r13d,%r8d
+  80343b:	4c 89 e1             	mov    %r12,%rcx
+  80343e:	4c 89 f2             	mov    %r14,%rdx
+  803441:	48 bf 60 3d 80 00 00 	movabs $0x803d60,%rdi
+  803448:	00 00 00 
+  80344b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803450:	49 bc d0 01 80 00 00 	movabs $0x8001d0,%r12
+  803457:	00 00 00 
+  80345a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80345d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803461:	48 89 df             	mov    %rbx,%rdi
+  803464:	48 b8 6c 01 80 00 00 	movabs $0x80016c,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+    cprintf("\n");
+  803470:	48 bf b3 3c 80 00 00 	movabs $0x803cb3,%rdi
+  803477:	00 00 00 
+  80347a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803482:	cc                   	int3
+  803483:	eb fd                	jmp    803482 <_panic+0xa0>
+
+0000000000803485 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803485:	55                   	push   %rbp
+  803486:	48 89 e5             	mov    %rsp,%rbp
+  803489:	41 55                	push   %r13
+  80348b:	41 54                	push   %r12
+  80348d:	53                   	push   %rbx
+  80348e:	48 83 ec 08          	sub    $0x8,%rsp
+  803492:	49 89 fc             	mov    %rdi,%r12
+  803495:	48 89 f7             	mov    %rsi,%rdi
+  803498:	48 89 d3             	mov    %rdx,%rbx
+  80349b:	49 89 cd             	mov    %rcx,%r13
+  80349e:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8034a1:	48 85 f6             	test   %rsi,%rsi
+  8034a4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034ab:	00 00 00 
+  8034ae:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034b2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034b7:	48 85 db             	test   %rbx,%rbx
+  8034ba:	74 03                	je     8034bf <ipc_recv_timed+0x3a>
+  8034bc:	48 8b 33             	mov    (%rbx),%rsi
+  8034bf:	48 b8 1b 14 80 00 00 	movabs $0x80141b,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034cb:	85 c0                	test   %eax,%eax
+  8034cd:	78 75                	js     803544 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034cf:	4d 85 e4             	test   %r12,%r12
+  8034d2:	74 14                	je     8034e8 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034d4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034db:	00 00 00 
+  8034de:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034e4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034e8:	4d 85 ed             	test   %r13,%r13
+  8034eb:	74 14                	je     803501 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034ed:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034f4:	00 00 00 
+  8034f7:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034fd:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803501:	48 85 db             	test   %rbx,%rbx
+  803504:	74 23                	je     803529 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803506:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80350d:	00 00 00 
+  803510:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80351b:	85 c9                	test   %ecx,%ecx
+  80351d:	74 07                	je     803526 <ipc_recv_timed+0xa1>
+  80351f:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803526:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803529:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803530:	00 00 00 
+  803533:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803539:	48 83 c4 08          	add    $0x8,%rsp
+  80353d:	5b                   	pop    %rbx
+  80353e:	41 5c                	pop    %r12
+  803540:	41 5d                	pop    %r13
+  803542:	5d                   	pop    %rbp
+  803543:	c3                   	ret
+        if (from_env_store != NULL) {
+  803544:	4d 85 e4             	test   %r12,%r12
+  803547:	74 08                	je     803551 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803549:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803550:	00 
+        if (perm_store != NULL) {
+  803551:	4d 85 ed             	test   %r13,%r13
+  803554:	74 08                	je     80355e <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803556:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80355d:	00 
+        if (size != NULL) {
+  80355e:	48 85 db             	test   %rbx,%rbx
+  803561:	74 d6                	je     803539 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803563:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80356a:	eb cd                	jmp    803539 <ipc_recv_timed+0xb4>
+
+000000000080356c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80356c:	55                   	push   %rbp
+  80356d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803570:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803576:	48 b8 85 34 80 00 00 	movabs $0x803485,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+}
+  803582:	5d                   	pop    %rbp
+  803583:	c3                   	ret
+
+0000000000803584 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+  803588:	41 57                	push   %r15
+  80358a:	41 56                	push   %r14
+  80358c:	41 55                	push   %r13
+  80358e:	41 54                	push   %r12
+  803590:	53                   	push   %rbx
+  803591:	48 83 ec 18          	sub    $0x18,%rsp
+  803595:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803598:	48 89 d3             	mov    %rdx,%rbx
+  80359b:	49 89 cc             	mov    %rcx,%r12
+  80359e:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035a1:	48 85 d2             	test   %rdx,%rdx
+  8035a4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035ab:	00 00 00 
+  8035ae:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035b2:	89 f0                	mov    %esi,%eax
+  8035b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035b8:	48 89 da             	mov    %rbx,%rdx
+  8035bb:	48 89 c6             	mov    %rax,%rsi
+  8035be:	48 b8 ef 13 80 00 00 	movabs $0x8013ef,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035ca:	85 c0                	test   %eax,%eax
+  8035cc:	79 65                	jns    803633 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035ce:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035d1:	75 33                	jne    803606 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035d3:	49 bf f2 10 80 00 00 	movabs $0x8010f2,%r15
+  8035da:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035dd:	49 be ef 13 80 00 00 	movabs $0x8013ef,%r14
+  8035e4:	00 00 00 
+        sys_yield();
+  8035e7:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035ea:	45 89 e8             	mov    %r13d,%r8d
+  8035ed:	4c 89 e1             	mov    %r12,%rcx
+  8035f0:	48 89 da             	mov    %rbx,%rdx
+  8035f3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035f7:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035fa:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	79 32                	jns    803633 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803601:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803604:	74 e1                	je     8035e7 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803606:	89 c1                	mov    %eax,%ecx
+  803608:	48 ba 83 3d 80 00 00 	movabs $0x803d83,%rdx
+  80360f:	00 00 00 
+  803612:	be 52 00 00 00       	mov    $0x52,%esi
+  803617:	48 bf 97 3d 80 00 00 	movabs $0x803d97,%rdi
+  80361e:	00 00 00 
+  803621:	b8 00 00 00 00       	mov    $0x0,%eax
+  803626:	49 b8 e2 33 80 00 00 	movabs $0x8033e2,%r8
+  80362d:	00 00 00 
+  803630:	41 ff d0             	call   *%r8
+    }
+}
+  803633:	48 83 c4 18          	add    $0x18,%rsp
+  803637:	5b                   	pop    %rbx
+  803638:	41 5c                	pop    %r12
+  80363a:	41 5d                	pop    %r13
+  80363c:	41 5e                	pop    %r14
+  80363e:	41 5f                	pop    %r15
+  803640:	5d                   	pop    %rbp
+  803641:	c3                   	ret
+
+0000000000803642 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803647:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80364e:	00 00 00 
+  803651:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803655:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803659:	48 c1 e2 04          	shl    $0x4,%rdx
+  80365d:	48 01 ca             	add    %rcx,%rdx
+  803660:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803666:	39 fa                	cmp    %edi,%edx
+  803668:	74 12                	je     80367c <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80366a:	48 83 c0 01          	add    $0x1,%rax
+  80366e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803674:	75 db                	jne    803651 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367b:	c3                   	ret
+            return envs[i].env_id;
+  80367c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803680:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803684:	48 c1 e2 04          	shl    $0x4,%rdx
+  803688:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80368f:	00 00 00 
+  803692:	48 01 d0             	add    %rdx,%rax
+  803695:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80369b:	c3                   	ret
+  80369c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008036a0 <__rodata_start>:
+  8036a0:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  8036a4:	61                   	(bad)
+  8036a5:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f86edc <__bss_end+0x2077eedc>
+  8036ac:	66 72 6f             	data16 jb 80371e <__rodata_start+0x7e>
+  8036af:	6d                   	insl   (%dx),%es:(%rdi)
+  8036b0:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  8036b4:	61                   	(bad)
+  8036b5:	74 69                	je     803720 <__rodata_start+0x80>
+  8036b7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036b9:	20 30                	and    %dh,(%rax)
+  8036bb:	78 38                	js     8036f5 <__rodata_start+0x55>
+  8036bd:	30 34 30             	xor    %dh,(%rax,%rsi,1)
+  8036c0:	30 30                	xor    %dh,(%rax)
+  8036c2:	30 30                	xor    %dh,(%rax)
+  8036c4:	30 30                	xor    %dh,(%rax)
+  8036c6:	21 0a                	and    %ecx,(%rdx)
+  8036c8:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8036cf:	77 6e                	ja     80373f <__rodata_start+0x9f>
+  8036d1:	3e 00 30             	ds add %dh,(%rax)
+  8036d4:	31 32                	xor    %esi,(%rdx)
+  8036d6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036dd:	41                   	rex.B
+  8036de:	42                   	rex.X
+  8036df:	43                   	rex.XB
+  8036e0:	44                   	rex.R
+  8036e1:	45                   	rex.RB
+  8036e2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036e5:	31 32                	xor    %esi,(%rdx)
+  8036e7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036ee:	61                   	(bad)
+  8036ef:	62 63 64 65 66       	(bad)
+  8036f4:	00 28                	add    %ch,(%rax)
+  8036f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f7:	75 6c                	jne    803765 <__rodata_start+0xc5>
+  8036f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036fa:	29 00                	sub    %eax,(%rax)
+  8036fc:	65 72 72             	gs jb  803771 <__rodata_start+0xd1>
+  8036ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803700:	72 20                	jb     803722 <__rodata_start+0x82>
+  803702:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803707:	73 70                	jae    803779 <__rodata_start+0xd9>
+  803709:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80370d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803714:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803715:	72 00                	jb     803717 <__rodata_start+0x77>
+  803717:	62 61 64 20 65       	(bad)
+  80371c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371d:	76 69                	jbe    803788 <__rodata_start+0xe8>
+  80371f:	72 6f                	jb     803790 <__rodata_start+0xf0>
+  803721:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803722:	6d                   	insl   (%dx),%es:(%rdi)
+  803723:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803725:	74 00                	je     803727 <__rodata_start+0x87>
+  803727:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80372e:	20 70 61             	and    %dh,0x61(%rax)
+  803731:	72 61                	jb     803794 <__rodata_start+0xf4>
+  803733:	6d                   	insl   (%dx),%es:(%rdi)
+  803734:	65 74 65             	gs je  80379c <__rodata_start+0xfc>
+  803737:	72 00                	jb     803739 <__rodata_start+0x99>
+  803739:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373a:	75 74                	jne    8037b0 <__rodata_start+0x110>
+  80373c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80373f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803742:	6d                   	insl   (%dx),%es:(%rdi)
+  803743:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803744:	72 79                	jb     8037bf <__rodata_start+0x11f>
+  803746:	00 6f 75             	add    %ch,0x75(%rdi)
+  803749:	74 20                	je     80376b <__rodata_start+0xcb>
+  80374b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803750:	76 69                	jbe    8037bb <__rodata_start+0x11b>
+  803752:	72 6f                	jb     8037c3 <__rodata_start+0x123>
+  803754:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803755:	6d                   	insl   (%dx),%es:(%rdi)
+  803756:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803758:	74 73                	je     8037cd <__rodata_start+0x12d>
+  80375a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80375d:	72 72                	jb     8037d1 <__rodata_start+0x131>
+  80375f:	75 70                	jne    8037d1 <__rodata_start+0x131>
+  803761:	74 65                	je     8037c8 <__rodata_start+0x128>
+  803763:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803768:	75 67                	jne    8037d1 <__rodata_start+0x131>
+  80376a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80376d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80376f:	00 73 65             	add    %dh,0x65(%rbx)
+  803772:	67 6d                	insl   (%dx),%es:(%edi)
+  803774:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803776:	74 61                	je     8037d9 <__rodata_start+0x139>
+  803778:	74 69                	je     8037e3 <__rodata_start+0x143>
+  80377a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80377b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377c:	20 66 61             	and    %ah,0x61(%rsi)
+  80377f:	75 6c                	jne    8037ed <__rodata_start+0x14d>
+  803781:	74 00                	je     803783 <__rodata_start+0xe3>
+  803783:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80378a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80378d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803791:	61                   	(bad)
+  803792:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803797:	20 73 75             	and    %dh,0x75(%rbx)
+  80379a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80379d:	73 79                	jae    803818 <__rodata_start+0x178>
+  80379f:	73 74                	jae    803815 <__rodata_start+0x175>
+  8037a1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8037a3:	20 63 61             	and    %ah,0x61(%rbx)
+  8037a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8037ab:	74 72                	je     80381f <__rodata_start+0x17f>
+  8037ad:	79 20                	jns    8037cf <__rodata_start+0x12f>
+  8037af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037b1:	74 20                	je     8037d3 <__rodata_start+0x133>
+  8037b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037b5:	75 6e                	jne    803825 <__rodata_start+0x185>
+  8037b7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8037bb:	76 20                	jbe    8037dd <__rodata_start+0x13d>
+  8037bd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8037c4:	72 65                	jb     80382b <__rodata_start+0x18b>
+  8037c6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8037c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ca:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037ce:	65 78 70             	gs js  803841 <__rodata_start+0x1a1>
+  8037d1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037d6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037d9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037dd:	20 66 69             	and    %ah,0x69(%rsi)
+  8037e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8037e1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037e5:	20 66 72             	and    %ah,0x72(%rsi)
+  8037e8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037ed:	61                   	(bad)
+  8037ee:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037f7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803800:	79 20                	jns    803822 <__rodata_start+0x182>
+  803802:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803809:	72 65                	jb     803870 <__rodata_start+0x1d0>
+  80380b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80380e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803810:	00 66 69             	add    %ah,0x69(%rsi)
+  803813:	6c                   	insb   (%dx),%es:(%rdi)
+  803814:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803818:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80381b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80381c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80381f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803820:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803821:	74 20                	je     803843 <__rodata_start+0x1a3>
+  803823:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803825:	75 6e                	jne    803895 <__rodata_start+0x1f5>
+  803827:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80382b:	76 61                	jbe    80388e <__rodata_start+0x1ee>
+  80382d:	6c                   	insb   (%dx),%es:(%rdi)
+  80382e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803835:	00 
+  803836:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80383d:	72 65                	jb     8038a4 <__rodata_start+0x204>
+  80383f:	61                   	(bad)
+  803840:	64 79 20             	fs jns 803863 <__rodata_start+0x1c3>
+  803843:	65 78 69             	gs js  8038af <__rodata_start+0x20f>
+  803846:	73 74                	jae    8038bc <__rodata_start+0x21c>
+  803848:	73 00                	jae    80384a <__rodata_start+0x1aa>
+  80384a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80384b:	70 65                	jo     8038b2 <__rodata_start+0x212>
+  80384d:	72 61                	jb     8038b0 <__rodata_start+0x210>
+  80384f:	74 69                	je     8038ba <__rodata_start+0x21a>
+  803851:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803852:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803853:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803856:	74 20                	je     803878 <__rodata_start+0x1d8>
+  803858:	73 75                	jae    8038cf <__rodata_start+0x22f>
+  80385a:	70 70                	jo     8038cc <__rodata_start+0x22c>
+  80385c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80385d:	72 74                	jb     8038d3 <__rodata_start+0x233>
+  80385f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803865:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80386a:	74 00                	je     80386c <__rodata_start+0x1cc>
+  80386c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803873:	00 00 00 
+  803876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80387d:	00 00 00 
+  803880:	bd 03 80 00 00       	mov    $0x8003,%ebp
+  803885:	00 00                	add    %al,(%rax)
+  803887:	00 fe                	add    %bh,%dh
+  803889:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80388f:	00 ee                	add    %ch,%dh
+  803891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803897:	00 fe                	add    %bh,%dh
+  803899:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80389f:	00 fe                	add    %bh,%dh
+  8038a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038a7:	00 fe                	add    %bh,%dh
+  8038a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038af:	00 fe                	add    %bh,%dh
+  8038b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038b7:	00 dc                	add    %bl,%ah
+  8038b9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038bf:	00 fe                	add    %bh,%dh
+  8038c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038c7:	00 fe                	add    %bh,%dh
+  8038c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038cf:	00 d0                	add    %dl,%al
+  8038d1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038d7:	00 4a 04             	add    %cl,0x4(%rdx)
+  8038da:	80 00 00             	addb   $0x0,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 fe                	add    %bh,%dh
+  8038e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038e7:	00 d0                	add    %dl,%al
+  8038e9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038ef:	00 16                	add    %dl,(%rsi)
+  8038f1:	04 80                	add    $0x80,%al
+  8038f3:	00 00                	add    %al,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 16                	add    %dl,(%rsi)
+  8038f9:	04 80                	add    $0x80,%al
+  8038fb:	00 00                	add    %al,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 16                	add    %dl,(%rsi)
+  803901:	04 80                	add    $0x80,%al
+  803903:	00 00                	add    %al,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 16                	add    %dl,(%rsi)
+  803909:	04 80                	add    $0x80,%al
+  80390b:	00 00                	add    %al,(%rax)
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 16                	add    %dl,(%rsi)
+  803911:	04 80                	add    $0x80,%al
+  803913:	00 00                	add    %al,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 16                	add    %dl,(%rsi)
+  803919:	04 80                	add    $0x80,%al
+  80391b:	00 00                	add    %al,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 16                	add    %dl,(%rsi)
+  803921:	04 80                	add    $0x80,%al
+  803923:	00 00                	add    %al,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 16                	add    %dl,(%rsi)
+  803929:	04 80                	add    $0x80,%al
+  80392b:	00 00                	add    %al,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 16                	add    %dl,(%rsi)
+  803931:	04 80                	add    $0x80,%al
+  803933:	00 00                	add    %al,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 fe                	add    %bh,%dh
+  803939:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80393f:	00 fe                	add    %bh,%dh
+  803941:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803947:	00 fe                	add    %bh,%dh
+  803949:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80394f:	00 fe                	add    %bh,%dh
+  803951:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803957:	00 fe                	add    %bh,%dh
+  803959:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80395f:	00 fe                	add    %bh,%dh
+  803961:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803967:	00 fe                	add    %bh,%dh
+  803969:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80396f:	00 fe                	add    %bh,%dh
+  803971:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803977:	00 fe                	add    %bh,%dh
+  803979:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80397f:	00 fe                	add    %bh,%dh
+  803981:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803987:	00 fe                	add    %bh,%dh
+  803989:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80398f:	00 fe                	add    %bh,%dh
+  803991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803997:	00 fe                	add    %bh,%dh
+  803999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80399f:	00 fe                	add    %bh,%dh
+  8039a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039a7:	00 fe                	add    %bh,%dh
+  8039a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039af:	00 fe                	add    %bh,%dh
+  8039b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039b7:	00 fe                	add    %bh,%dh
+  8039b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039bf:	00 fe                	add    %bh,%dh
+  8039c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039c7:	00 fe                	add    %bh,%dh
+  8039c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039cf:	00 fe                	add    %bh,%dh
+  8039d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039d7:	00 fe                	add    %bh,%dh
+  8039d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039df:	00 fe                	add    %bh,%dh
+  8039e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039e7:	00 fe                	add    %bh,%dh
+  8039e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ef:	00 fe                	add    %bh,%dh
+  8039f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039f7:	00 fe                	add    %bh,%dh
+  8039f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ff:	00 fe                	add    %bh,%dh
+  803a01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a07:	00 fe                	add    %bh,%dh
+  803a09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a0f:	00 fe                	add    %bh,%dh
+  803a11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a17:	00 fe                	add    %bh,%dh
+  803a19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a1f:	00 fe                	add    %bh,%dh
+  803a21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a27:	00 21                	add    %ah,(%rcx)
+  803a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a2f:	00 fe                	add    %bh,%dh
+  803a31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a37:	00 fe                	add    %bh,%dh
+  803a39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a3f:	00 fe                	add    %bh,%dh
+  803a41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a47:	00 fe                	add    %bh,%dh
+  803a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a4f:	00 fe                	add    %bh,%dh
+  803a51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a57:	00 fe                	add    %bh,%dh
+  803a59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a5f:	00 fe                	add    %bh,%dh
+  803a61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a67:	00 fe                	add    %bh,%dh
+  803a69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a6f:	00 fe                	add    %bh,%dh
+  803a71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a77:	00 fe                	add    %bh,%dh
+  803a79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a7f:	00 6d 04             	add    %ch,0x4(%rbp)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 3c 06             	add    %bh,(%rsi,%rax,1)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 fe                	add    %bh,%dh
+  803a91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a97:	00 fe                	add    %bh,%dh
+  803a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a9f:	00 fe                	add    %bh,%dh
+  803aa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aa7:	00 fe                	add    %bh,%dh
+  803aa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aaf:	00 9c 04 80 00 00 00 	add    %bl,0x80(%rsp,%rax,1)
+  803ab6:	00 00                	add    %al,(%rax)
+  803ab8:	fe 09                	decb   (%rcx)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 fe                	add    %bh,%dh
+  803ac1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ac7:	00 62 04             	add    %ah,0x4(%rdx)
+  803aca:	80 00 00             	addb   $0x0,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 fe                	add    %bh,%dh
+  803ad1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ad7:	00 fe                	add    %bh,%dh
+  803ad9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803adf:	00 e4                	add    %ah,%ah
+  803ae1:	07                   	(bad)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 ae 08 80 00 00    	add    %ch,0x8008(%rsi)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 fe                	add    %bh,%dh
+  803af1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803af7:	00 fe                	add    %bh,%dh
+  803af9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aff:	00 33                	add    %dh,(%rbx)
+  803b01:	05 80 00 00 00       	add    $0x80,%eax
+  803b06:	00 00                	add    %al,(%rax)
+  803b08:	fe 09                	decb   (%rcx)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 10                	add    %dl,(%rax)
+  803b11:	07                   	(bad)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 fe                	add    %bh,%dh
+  803b19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b1f:	00 fe                	add    %bh,%dh
+  803b21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b27:	00 21                	add    %ah,(%rcx)
+  803b29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b2f:	00 fe                	add    %bh,%dh
+  803b31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b37:	00 c6                	add    %al,%dh
+  803b39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803b40 <error_string>:
+	...
+  803b48:	05 37 80 00 00 00 00 00 17 37 80 00 00 00 00 00     .7.......7......
+  803b58:	27 37 80 00 00 00 00 00 39 37 80 00 00 00 00 00     '7......97......
+  803b68:	47 37 80 00 00 00 00 00 5b 37 80 00 00 00 00 00     G7......[7......
+  803b78:	70 37 80 00 00 00 00 00 83 37 80 00 00 00 00 00     p7.......7......
+  803b88:	95 37 80 00 00 00 00 00 a9 37 80 00 00 00 00 00     .7.......7......
+  803b98:	b9 37 80 00 00 00 00 00 cc 37 80 00 00 00 00 00     .7.......7......
+  803ba8:	e3 37 80 00 00 00 00 00 f9 37 80 00 00 00 00 00     .7.......7......
+  803bb8:	11 38 80 00 00 00 00 00 29 38 80 00 00 00 00 00     .8......)8......
+  803bc8:	36 38 80 00 00 00 00 00 e8 3b 80 00 00 00 00 00     68.......;......
+  803bd8:	4a 38 80 00 00 00 00 00 62 38 80 00 00 00 00 00     J8......b8......
+  803be8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803bf8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803c08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803c18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803c28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803c38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c58:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c68:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c78:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c88:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c98:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803ca8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803cb8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803cc8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cd8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ce0 <devtab>:
+  803ce0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803cf0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803d00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803d10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803d20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803d30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803d80:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803d90:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
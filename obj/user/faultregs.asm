@@ -0,0 +1,8194 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 2b 46 80 00 00 	movabs $0x80462b,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf f8 45 80 00 00 	movabs $0x8045f8,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd fe 0e 80 00 00 	movabs $0x800efe,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 08 46 80 00 00 	movabs $0x804608,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 2c 46 80 00 00 	movabs $0x80462c,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 30 46 80 00 00 	movabs $0x804630,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 34 46 80 00 00 	movabs $0x804634,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 38 46 80 00 00 	movabs $0x804638,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 3c 46 80 00 00 	movabs $0x80463c,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 40 46 80 00 00 	movabs $0x804640,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 40 46 80 00 00 	movabs $0x804640,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 3c 46 80 00 00 	movabs $0x80463c,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 44 46 80 00 00 	movabs $0x804644,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 48 46 80 00 00 	movabs $0x804648,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 4c 46 80 00 00 	movabs $0x80464c,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 50 46 80 00 00 	movabs $0x804650,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 54 46 80 00 00 	movabs $0x804654,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be 58 46 80 00 00 	movabs $0x804658,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be 5c 46 80 00 00 	movabs $0x80465c,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 fe 0e 80 00 00 	movabs $0x800efe,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd fe 0e 80 00 00 	movabs $0x800efe,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be 63 46 80 00 00 	movabs $0x804663,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb fe 0e 80 00 00 	movabs $0x800efe,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf 67 46 80 00 00 	movabs $0x804667,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 22 46 80 00 00 	movabs $0x804622,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf fe 0e 80 00 00 	movabs $0x800efe,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be 63 46 80 00 00 	movabs $0x804663,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 0c 46 80 00 00 	movabs $0x80460c,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb fe 0e 80 00 00 	movabs $0x800efe,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf 67 46 80 00 00 	movabs $0x804667,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 1e 46 80 00 00 	movabs $0x80461e,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb fe 0e 80 00 00 	movabs $0x800efe,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf 67 46 80 00 00 	movabs $0x804667,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 60 80 00 00 	movabs $0x8060a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 86 46 80 00 00 	movabs $0x804686,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 94 46 80 00 00 	movabs $0x804694,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be 9b 46 80 00 00 	movabs $0x80469b,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba d0 46 80 00 00 	movabs $0x8046d0,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf 75 46 80 00 00 	movabs $0x804675,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba a2 46 80 00 00 	movabs $0x8046a2,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf 75 46 80 00 00 	movabs $0x804675,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 ae 0d 80 00 00 	movabs $0x800dae,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 09 23 80 00 00 	movabs $0x802309,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 61 80 00 00 	movabs $0x806140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 b5 46 80 00 00 	movabs $0x8046b5,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 c6 46 80 00 00 	movabs $0x8046c6,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be 9b 46 80 00 00 	movabs $0x80469b,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 08 47 80 00 00 	movabs $0x804708,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba fe 0e 80 00 00 	movabs $0x800efe,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	41 89 fd             	mov    %edi,%r13d
+  800ceb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800cee:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800cf5:	00 00 00 
+  800cf8:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800cff:	00 00 00 
+  800d02:	48 39 c2             	cmp    %rax,%rdx
+  800d05:	73 17                	jae    800d1e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800d07:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d0a:	49 89 c4             	mov    %rax,%r12
+  800d0d:	48 83 c3 08          	add    $0x8,%rbx
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	ff 53 f8             	call   *-0x8(%rbx)
+  800d19:	4c 39 e3             	cmp    %r12,%rbx
+  800d1c:	72 ef                	jb     800d0d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800d1e:	48 b8 ef 1d 80 00 00 	movabs $0x801def,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d2f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800d33:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800d37:	48 c1 e0 04          	shl    $0x4,%rax
+  800d3b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800d42:	00 00 00 
+  800d45:	48 01 d0             	add    %rdx,%rax
+  800d48:	48 a3 d0 61 80 00 00 	movabs %rax,0x8061d0
+  800d4f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d52:	45 85 ed             	test   %r13d,%r13d
+  800d55:	7e 0d                	jle    800d64 <libmain+0x87>
+  800d57:	49 8b 06             	mov    (%r14),%rax
+  800d5a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800d61:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d64:	4c 89 f6             	mov    %r14,%rsi
+  800d67:	44 89 ef             	mov    %r13d,%edi
+  800d6a:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800d76:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  800d7d:	00 00 00 
+  800d80:	ff d0                	call   *%rax
+#endif
+}
+  800d82:	5b                   	pop    %rbx
+  800d83:	41 5c                	pop    %r12
+  800d85:	41 5d                	pop    %r13
+  800d87:	41 5e                	pop    %r14
+  800d89:	5d                   	pop    %rbp
+  800d8a:	c3                   	ret
+
+0000000000800d8b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800d8b:	55                   	push   %rbp
+  800d8c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800d8f:	48 b8 72 27 80 00 00 	movabs $0x802772,%rax
+  800d96:	00 00 00 
+  800d99:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da0:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  800da7:	00 00 00 
+  800daa:	ff d0                	call   *%rax
+}
+  800dac:	5d                   	pop    %rbp
+  800dad:	c3                   	ret
+
+0000000000800dae <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800dae:	55                   	push   %rbp
+  800daf:	48 89 e5             	mov    %rsp,%rbp
+  800db2:	41 56                	push   %r14
+  800db4:	41 55                	push   %r13
+  800db6:	41 54                	push   %r12
+  800db8:	53                   	push   %rbx
+  800db9:	48 83 ec 50          	sub    $0x50,%rsp
+  800dbd:	49 89 fc             	mov    %rdi,%r12
+  800dc0:	41 89 f5             	mov    %esi,%r13d
+  800dc3:	48 89 d3             	mov    %rdx,%rbx
+  800dc6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dca:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800dce:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dd2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800dd9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ddd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800de1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800de5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800de9:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800df0:	00 00 00 
+  800df3:	4c 8b 30             	mov    (%rax),%r14
+  800df6:	48 b8 ef 1d 80 00 00 	movabs $0x801def,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+  800e02:	89 c6                	mov    %eax,%esi
+  800e04:	45 89 e8             	mov    %r13d,%r8d
+  800e07:	4c 89 e1             	mov    %r12,%rcx
+  800e0a:	4c 89 f2             	mov    %r14,%rdx
+  800e0d:	48 bf 38 47 80 00 00 	movabs $0x804738,%rdi
+  800e14:	00 00 00 
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	49 bc fe 0e 80 00 00 	movabs $0x800efe,%r12
+  800e23:	00 00 00 
+  800e26:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e29:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e2d:	48 89 df             	mov    %rbx,%rdi
+  800e30:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  800e37:	00 00 00 
+  800e3a:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e3c:	48 bf 2a 46 80 00 00 	movabs $0x80462a,%rdi
+  800e43:	00 00 00 
+  800e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e4e:	cc                   	int3
+  800e4f:	eb fd                	jmp    800e4e <_panic+0xa0>
+
+0000000000800e51 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e51:	55                   	push   %rbp
+  800e52:	48 89 e5             	mov    %rsp,%rbp
+  800e55:	53                   	push   %rbx
+  800e56:	48 83 ec 08          	sub    $0x8,%rsp
+  800e5a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e5d:	8b 06                	mov    (%rsi),%eax
+  800e5f:	8d 50 01             	lea    0x1(%rax),%edx
+  800e62:	89 16                	mov    %edx,(%rsi)
+  800e64:	48 98                	cltq
+  800e66:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800e6b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e71:	74 0a                	je     800e7d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800e73:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e7b:	c9                   	leave
+  800e7c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800e7d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e81:	be ff 00 00 00       	mov    $0xff,%esi
+  800e86:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+        state->offset = 0;
+  800e92:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e98:	eb d9                	jmp    800e73 <putch+0x22>
+
+0000000000800e9a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e9a:	55                   	push   %rbp
+  800e9b:	48 89 e5             	mov    %rsp,%rbp
+  800e9e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ea5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ea8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800eaf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800ebc:	48 89 f1             	mov    %rsi,%rcx
+  800ebf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800ec6:	48 bf 51 0e 80 00 00 	movabs $0x800e51,%rdi
+  800ecd:	00 00 00 
+  800ed0:	48 b8 4e 10 80 00 00 	movabs $0x80104e,%rax
+  800ed7:	00 00 00 
+  800eda:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800edc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800ee3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800eea:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  800ef1:	00 00 00 
+  800ef4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800ef6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800efc:	c9                   	leave
+  800efd:	c3                   	ret
+
+0000000000800efe <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800efe:	55                   	push   %rbp
+  800eff:	48 89 e5             	mov    %rsp,%rbp
+  800f02:	48 83 ec 50          	sub    $0x50,%rsp
+  800f06:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f0a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f0e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f12:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f16:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f1a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f29:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f2d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f31:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f35:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  800f3c:	00 00 00 
+  800f3f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f41:	c9                   	leave
+  800f42:	c3                   	ret
+
+0000000000800f43 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f43:	55                   	push   %rbp
+  800f44:	48 89 e5             	mov    %rsp,%rbp
+  800f47:	41 57                	push   %r15
+  800f49:	41 56                	push   %r14
+  800f4b:	41 55                	push   %r13
+  800f4d:	41 54                	push   %r12
+  800f4f:	53                   	push   %rbx
+  800f50:	48 83 ec 18          	sub    $0x18,%rsp
+  800f54:	49 89 fc             	mov    %rdi,%r12
+  800f57:	49 89 f5             	mov    %rsi,%r13
+  800f5a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f5e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800f61:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800f64:	41 89 cf             	mov    %ecx,%r15d
+  800f67:	4c 39 fa             	cmp    %r15,%rdx
+  800f6a:	73 5b                	jae    800fc7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800f6c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800f70:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800f74:	85 db                	test   %ebx,%ebx
+  800f76:	7e 0e                	jle    800f86 <print_num+0x43>
+            putch(padc, put_arg);
+  800f78:	4c 89 ee             	mov    %r13,%rsi
+  800f7b:	44 89 f7             	mov    %r14d,%edi
+  800f7e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800f81:	83 eb 01             	sub    $0x1,%ebx
+  800f84:	75 f2                	jne    800f78 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800f86:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800f8a:	48 b9 6c 47 80 00 00 	movabs $0x80476c,%rcx
+  800f91:	00 00 00 
+  800f94:	48 b8 5b 47 80 00 00 	movabs $0x80475b,%rax
+  800f9b:	00 00 00 
+  800f9e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800fa2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fab:	49 f7 f7             	div    %r15
+  800fae:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800fb2:	4c 89 ee             	mov    %r13,%rsi
+  800fb5:	41 ff d4             	call   *%r12
+}
+  800fb8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fbc:	5b                   	pop    %rbx
+  800fbd:	41 5c                	pop    %r12
+  800fbf:	41 5d                	pop    %r13
+  800fc1:	41 5e                	pop    %r14
+  800fc3:	41 5f                	pop    %r15
+  800fc5:	5d                   	pop    %rbp
+  800fc6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800fc7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd0:	49 f7 f7             	div    %r15
+  800fd3:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800fdb:	52                   	push   %rdx
+  800fdc:	45 0f be c9          	movsbl %r9b,%r9d
+  800fe0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fe4:	48 89 c2             	mov    %rax,%rdx
+  800fe7:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  800fee:	00 00 00 
+  800ff1:	ff d0                	call   *%rax
+  800ff3:	48 83 c4 10          	add    $0x10,%rsp
+  800ff7:	eb 8d                	jmp    800f86 <print_num+0x43>
+
+0000000000800ff9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ff9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800ffd:	48 8b 06             	mov    (%rsi),%rax
+  801000:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801004:	73 0a                	jae    801010 <sprintputch+0x17>
+        *state->start++ = ch;
+  801006:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80100a:	48 89 16             	mov    %rdx,(%rsi)
+  80100d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801010:	c3                   	ret
+
+0000000000801011 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801011:	55                   	push   %rbp
+  801012:	48 89 e5             	mov    %rsp,%rbp
+  801015:	48 83 ec 50          	sub    $0x50,%rsp
+  801019:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80101d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801021:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801025:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80102c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801030:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801034:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801038:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80103c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801040:	48 b8 4e 10 80 00 00 	movabs $0x80104e,%rax
+  801047:	00 00 00 
+  80104a:	ff d0                	call   *%rax
+}
+  80104c:	c9                   	leave
+  80104d:	c3                   	ret
+
+000000000080104e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80104e:	55                   	push   %rbp
+  80104f:	48 89 e5             	mov    %rsp,%rbp
+  801052:	41 57                	push   %r15
+  801054:	41 56                	push   %r14
+  801056:	41 55                	push   %r13
+  801058:	41 54                	push   %r12
+  80105a:	53                   	push   %rbx
+  80105b:	48 83 ec 38          	sub    $0x38,%rsp
+  80105f:	49 89 fe             	mov    %rdi,%r14
+  801062:	49 89 f5             	mov    %rsi,%r13
+  801065:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801068:	48 8b 01             	mov    (%rcx),%rax
+  80106b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80106f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801073:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801077:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80107b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80107f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801083:	0f b6 3b             	movzbl (%rbx),%edi
+  801086:	40 80 ff 25          	cmp    $0x25,%dil
+  80108a:	74 18                	je     8010a4 <vprintfmt+0x56>
+            if (!ch) return;
+  80108c:	40 84 ff             	test   %dil,%dil
+  80108f:	0f 84 b1 06 00 00    	je     801746 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801095:	40 0f b6 ff          	movzbl %dil,%edi
+  801099:	4c 89 ee             	mov    %r13,%rsi
+  80109c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80109f:	4c 89 e3             	mov    %r12,%rbx
+  8010a2:	eb db                	jmp    80107f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8010a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010ad:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010b2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010b8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010bf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010c3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8010c8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8010cd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8010d0:	83 e8 23             	sub    $0x23,%eax
+  8010d3:	3c 57                	cmp    $0x57,%al
+  8010d5:	0f 87 51 06 00 00    	ja     80172c <vprintfmt+0x6de>
+  8010db:	0f b6 c0             	movzbl %al,%eax
+  8010de:	48 b9 00 49 80 00 00 	movabs $0x804900,%rcx
+  8010e5:	00 00 00 
+  8010e8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8010eb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8010ee:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8010f2:	eb cf                	jmp    8010c3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8010f4:	49 89 dc             	mov    %rbx,%r12
+  8010f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8010fc:	eb c5                	jmp    8010c3 <vprintfmt+0x75>
+            padc = ch;
+  8010fe:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801102:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801105:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801108:	eb b9                	jmp    8010c3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80110a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80110d:	83 f8 2f             	cmp    $0x2f,%eax
+  801110:	77 24                	ja     801136 <vprintfmt+0xe8>
+  801112:	89 c1                	mov    %eax,%ecx
+  801114:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801118:	83 c0 08             	add    $0x8,%eax
+  80111b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80111e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801121:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801124:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801128:	79 99                	jns    8010c3 <vprintfmt+0x75>
+                width = precision;
+  80112a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80112e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801134:	eb 8d                	jmp    8010c3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801136:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80113a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80113e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801142:	eb da                	jmp    80111e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801144:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801149:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80114d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801153:	3c 39                	cmp    $0x39,%al
+  801155:	77 1c                	ja     801173 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801157:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80115b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80115f:	0f b6 c0             	movzbl %al,%eax
+  801162:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801167:	0f b6 03             	movzbl (%rbx),%eax
+  80116a:	3c 39                	cmp    $0x39,%al
+  80116c:	76 e9                	jbe    801157 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80116e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801171:	eb b1                	jmp    801124 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801173:	49 89 dc             	mov    %rbx,%r12
+  801176:	eb ac                	jmp    801124 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801178:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80117b:	85 c9                	test   %ecx,%ecx
+  80117d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801182:	0f 49 c1             	cmovns %ecx,%eax
+  801185:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801188:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80118b:	e9 33 ff ff ff       	jmp    8010c3 <vprintfmt+0x75>
+            lflag++;
+  801190:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801193:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801196:	e9 28 ff ff ff       	jmp    8010c3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80119b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80119e:	83 f8 2f             	cmp    $0x2f,%eax
+  8011a1:	77 19                	ja     8011bc <vprintfmt+0x16e>
+  8011a3:	89 c2                	mov    %eax,%edx
+  8011a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a9:	83 c0 08             	add    $0x8,%eax
+  8011ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011af:	8b 3a                	mov    (%rdx),%edi
+  8011b1:	4c 89 ee             	mov    %r13,%rsi
+  8011b4:	41 ff d6             	call   *%r14
+            break;
+  8011b7:	e9 c3 fe ff ff       	jmp    80107f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c8:	eb e5                	jmp    8011af <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8011ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8011d0:	77 5a                	ja     80122c <vprintfmt+0x1de>
+  8011d2:	89 c2                	mov    %eax,%edx
+  8011d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d8:	83 c0 08             	add    $0x8,%eax
+  8011db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8011de:	8b 02                	mov    (%rdx),%eax
+  8011e0:	89 c1                	mov    %eax,%ecx
+  8011e2:	f7 d9                	neg    %ecx
+  8011e4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8011e7:	83 f9 14             	cmp    $0x14,%ecx
+  8011ea:	7f 4e                	jg     80123a <vprintfmt+0x1ec>
+  8011ec:	48 63 c1             	movslq %ecx,%rax
+  8011ef:	48 ba c0 4b 80 00 00 	movabs $0x804bc0,%rdx
+  8011f6:	00 00 00 
+  8011f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8011fd:	48 85 c0             	test   %rax,%rax
+  801200:	74 38                	je     80123a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801202:	48 89 c1             	mov    %rax,%rcx
+  801205:	48 ba 3a 4d 80 00 00 	movabs $0x804d3a,%rdx
+  80120c:	00 00 00 
+  80120f:	4c 89 ee             	mov    %r13,%rsi
+  801212:	4c 89 f7             	mov    %r14,%rdi
+  801215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121a:	49 b8 11 10 80 00 00 	movabs $0x801011,%r8
+  801221:	00 00 00 
+  801224:	41 ff d0             	call   *%r8
+  801227:	e9 53 fe ff ff       	jmp    80107f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80122c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801230:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801234:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801238:	eb a4                	jmp    8011de <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80123a:	48 ba 84 47 80 00 00 	movabs $0x804784,%rdx
+  801241:	00 00 00 
+  801244:	4c 89 ee             	mov    %r13,%rsi
+  801247:	4c 89 f7             	mov    %r14,%rdi
+  80124a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124f:	49 b8 11 10 80 00 00 	movabs $0x801011,%r8
+  801256:	00 00 00 
+  801259:	41 ff d0             	call   *%r8
+  80125c:	e9 1e fe ff ff       	jmp    80107f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801261:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801264:	83 f8 2f             	cmp    $0x2f,%eax
+  801267:	77 6c                	ja     8012d5 <vprintfmt+0x287>
+  801269:	89 c2                	mov    %eax,%edx
+  80126b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80126f:	83 c0 08             	add    $0x8,%eax
+  801272:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801275:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801278:	48 85 d2             	test   %rdx,%rdx
+  80127b:	48 b8 7d 47 80 00 00 	movabs $0x80477d,%rax
+  801282:	00 00 00 
+  801285:	48 0f 45 c2          	cmovne %rdx,%rax
+  801289:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80128d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801291:	7e 06                	jle    801299 <vprintfmt+0x24b>
+  801293:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801297:	75 4a                	jne    8012e3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801299:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80129d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8012a1:	0f b6 00             	movzbl (%rax),%eax
+  8012a4:	84 c0                	test   %al,%al
+  8012a6:	0f 85 9a 00 00 00    	jne    801346 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8012ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012af:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	0f 8e c4 fd ff ff    	jle    80107f <vprintfmt+0x31>
+  8012bb:	4c 89 ee             	mov    %r13,%rsi
+  8012be:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012c3:	41 ff d6             	call   *%r14
+  8012c6:	41 83 ec 01          	sub    $0x1,%r12d
+  8012ca:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8012ce:	75 eb                	jne    8012bb <vprintfmt+0x26d>
+  8012d0:	e9 aa fd ff ff       	jmp    80107f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8012d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e1:	eb 92                	jmp    801275 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8012e3:	49 63 f7             	movslq %r15d,%rsi
+  8012e6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8012ea:	48 b8 00 18 80 00 00 	movabs $0x801800,%rax
+  8012f1:	00 00 00 
+  8012f4:	ff d0                	call   *%rax
+  8012f6:	48 89 c2             	mov    %rax,%rdx
+  8012f9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012fc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8012fe:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801301:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801304:	85 c0                	test   %eax,%eax
+  801306:	7e 91                	jle    801299 <vprintfmt+0x24b>
+  801308:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80130d:	4c 89 ee             	mov    %r13,%rsi
+  801310:	44 89 e7             	mov    %r12d,%edi
+  801313:	41 ff d6             	call   *%r14
+  801316:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80131a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80131d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801320:	75 eb                	jne    80130d <vprintfmt+0x2bf>
+  801322:	e9 72 ff ff ff       	jmp    801299 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801327:	0f b6 f8             	movzbl %al,%edi
+  80132a:	4c 89 ee             	mov    %r13,%rsi
+  80132d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801330:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801334:	49 83 c4 01          	add    $0x1,%r12
+  801338:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80133e:	84 c0                	test   %al,%al
+  801340:	0f 84 66 ff ff ff    	je     8012ac <vprintfmt+0x25e>
+  801346:	45 85 ff             	test   %r15d,%r15d
+  801349:	78 0a                	js     801355 <vprintfmt+0x307>
+  80134b:	41 83 ef 01          	sub    $0x1,%r15d
+  80134f:	0f 88 57 ff ff ff    	js     8012ac <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801355:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801359:	74 cc                	je     801327 <vprintfmt+0x2d9>
+  80135b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80135e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801363:	80 fa 5e             	cmp    $0x5e,%dl
+  801366:	77 c2                	ja     80132a <vprintfmt+0x2dc>
+  801368:	eb bd                	jmp    801327 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80136a:	40 84 f6             	test   %sil,%sil
+  80136d:	75 26                	jne    801395 <vprintfmt+0x347>
+    switch (lflag) {
+  80136f:	85 d2                	test   %edx,%edx
+  801371:	74 59                	je     8013cc <vprintfmt+0x37e>
+  801373:	83 fa 01             	cmp    $0x1,%edx
+  801376:	74 7b                	je     8013f3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801378:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80137b:	83 f8 2f             	cmp    $0x2f,%eax
+  80137e:	0f 87 96 00 00 00    	ja     80141a <vprintfmt+0x3cc>
+  801384:	89 c2                	mov    %eax,%edx
+  801386:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80138a:	83 c0 08             	add    $0x8,%eax
+  80138d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801390:	4c 8b 22             	mov    (%rdx),%r12
+  801393:	eb 17                	jmp    8013ac <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801395:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801398:	83 f8 2f             	cmp    $0x2f,%eax
+  80139b:	77 21                	ja     8013be <vprintfmt+0x370>
+  80139d:	89 c2                	mov    %eax,%edx
+  80139f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a3:	83 c0 08             	add    $0x8,%eax
+  8013a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013a9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8013ac:	4d 85 e4             	test   %r12,%r12
+  8013af:	78 7a                	js     80142b <vprintfmt+0x3dd>
+            num = i;
+  8013b1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8013b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013b9:	e9 50 02 00 00       	jmp    80160e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ca:	eb dd                	jmp    8013a9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8013cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8013d2:	77 11                	ja     8013e5 <vprintfmt+0x397>
+  8013d4:	89 c2                	mov    %eax,%edx
+  8013d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013da:	83 c0 08             	add    $0x8,%eax
+  8013dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013e0:	4c 63 22             	movslq (%rdx),%r12
+  8013e3:	eb c7                	jmp    8013ac <vprintfmt+0x35e>
+  8013e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013f1:	eb ed                	jmp    8013e0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8013f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f9:	77 11                	ja     80140c <vprintfmt+0x3be>
+  8013fb:	89 c2                	mov    %eax,%edx
+  8013fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801401:	83 c0 08             	add    $0x8,%eax
+  801404:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801407:	4c 8b 22             	mov    (%rdx),%r12
+  80140a:	eb a0                	jmp    8013ac <vprintfmt+0x35e>
+  80140c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801410:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801414:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801418:	eb ed                	jmp    801407 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80141a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80141e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801422:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801426:	e9 65 ff ff ff       	jmp    801390 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80142b:	4c 89 ee             	mov    %r13,%rsi
+  80142e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801433:	41 ff d6             	call   *%r14
+                i = -i;
+  801436:	49 f7 dc             	neg    %r12
+  801439:	e9 73 ff ff ff       	jmp    8013b1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80143e:	40 84 f6             	test   %sil,%sil
+  801441:	75 32                	jne    801475 <vprintfmt+0x427>
+    switch (lflag) {
+  801443:	85 d2                	test   %edx,%edx
+  801445:	74 5d                	je     8014a4 <vprintfmt+0x456>
+  801447:	83 fa 01             	cmp    $0x1,%edx
+  80144a:	0f 84 82 00 00 00    	je     8014d2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801450:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801453:	83 f8 2f             	cmp    $0x2f,%eax
+  801456:	0f 87 a5 00 00 00    	ja     801501 <vprintfmt+0x4b3>
+  80145c:	89 c2                	mov    %eax,%edx
+  80145e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801462:	83 c0 08             	add    $0x8,%eax
+  801465:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801468:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80146b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801470:	e9 99 01 00 00       	jmp    80160e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801475:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801478:	83 f8 2f             	cmp    $0x2f,%eax
+  80147b:	77 19                	ja     801496 <vprintfmt+0x448>
+  80147d:	89 c2                	mov    %eax,%edx
+  80147f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801483:	83 c0 08             	add    $0x8,%eax
+  801486:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801489:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80148c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801491:	e9 78 01 00 00       	jmp    80160e <vprintfmt+0x5c0>
+  801496:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80149a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80149e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014a2:	eb e5                	jmp    801489 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8014a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8014aa:	77 18                	ja     8014c4 <vprintfmt+0x476>
+  8014ac:	89 c2                	mov    %eax,%edx
+  8014ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014b2:	83 c0 08             	add    $0x8,%eax
+  8014b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014b8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014ba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014bf:	e9 4a 01 00 00       	jmp    80160e <vprintfmt+0x5c0>
+  8014c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014d0:	eb e6                	jmp    8014b8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8014d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d8:	77 19                	ja     8014f3 <vprintfmt+0x4a5>
+  8014da:	89 c2                	mov    %eax,%edx
+  8014dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014e0:	83 c0 08             	add    $0x8,%eax
+  8014e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014e6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8014ee:	e9 1b 01 00 00       	jmp    80160e <vprintfmt+0x5c0>
+  8014f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014ff:	eb e5                	jmp    8014e6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801501:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801505:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801509:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80150d:	e9 56 ff ff ff       	jmp    801468 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801512:	40 84 f6             	test   %sil,%sil
+  801515:	75 2e                	jne    801545 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801517:	85 d2                	test   %edx,%edx
+  801519:	74 59                	je     801574 <vprintfmt+0x526>
+  80151b:	83 fa 01             	cmp    $0x1,%edx
+  80151e:	74 7f                	je     80159f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801520:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801523:	83 f8 2f             	cmp    $0x2f,%eax
+  801526:	0f 87 9f 00 00 00    	ja     8015cb <vprintfmt+0x57d>
+  80152c:	89 c2                	mov    %eax,%edx
+  80152e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801532:	83 c0 08             	add    $0x8,%eax
+  801535:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801538:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80153b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801540:	e9 c9 00 00 00       	jmp    80160e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801545:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801548:	83 f8 2f             	cmp    $0x2f,%eax
+  80154b:	77 19                	ja     801566 <vprintfmt+0x518>
+  80154d:	89 c2                	mov    %eax,%edx
+  80154f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801553:	83 c0 08             	add    $0x8,%eax
+  801556:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801559:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80155c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801561:	e9 a8 00 00 00       	jmp    80160e <vprintfmt+0x5c0>
+  801566:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80156a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80156e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801572:	eb e5                	jmp    801559 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801574:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801577:	83 f8 2f             	cmp    $0x2f,%eax
+  80157a:	77 15                	ja     801591 <vprintfmt+0x543>
+  80157c:	89 c2                	mov    %eax,%edx
+  80157e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801582:	83 c0 08             	add    $0x8,%eax
+  801585:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801588:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80158a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80158f:	eb 7d                	jmp    80160e <vprintfmt+0x5c0>
+  801591:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801595:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801599:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80159d:	eb e9                	jmp    801588 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80159f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8015a5:	77 16                	ja     8015bd <vprintfmt+0x56f>
+  8015a7:	89 c2                	mov    %eax,%edx
+  8015a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015ad:	83 c0 08             	add    $0x8,%eax
+  8015b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8015b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8015bb:	eb 51                	jmp    80160e <vprintfmt+0x5c0>
+  8015bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015c9:	eb e8                	jmp    8015b3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8015cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d7:	e9 5c ff ff ff       	jmp    801538 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8015dc:	4c 89 ee             	mov    %r13,%rsi
+  8015df:	bf 30 00 00 00       	mov    $0x30,%edi
+  8015e4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8015e7:	4c 89 ee             	mov    %r13,%rsi
+  8015ea:	bf 78 00 00 00       	mov    $0x78,%edi
+  8015ef:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8015f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f8:	77 47                	ja     801641 <vprintfmt+0x5f3>
+  8015fa:	89 c2                	mov    %eax,%edx
+  8015fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801600:	83 c0 08             	add    $0x8,%eax
+  801603:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801606:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801609:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80160e:	48 83 ec 08          	sub    $0x8,%rsp
+  801612:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801616:	0f 94 c0             	sete   %al
+  801619:	0f b6 c0             	movzbl %al,%eax
+  80161c:	50                   	push   %rax
+  80161d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801622:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801626:	4c 89 ee             	mov    %r13,%rsi
+  801629:	4c 89 f7             	mov    %r14,%rdi
+  80162c:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  801633:	00 00 00 
+  801636:	ff d0                	call   *%rax
+            break;
+  801638:	48 83 c4 10          	add    $0x10,%rsp
+  80163c:	e9 3e fa ff ff       	jmp    80107f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801641:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801645:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801649:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80164d:	eb b7                	jmp    801606 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80164f:	40 84 f6             	test   %sil,%sil
+  801652:	75 2b                	jne    80167f <vprintfmt+0x631>
+    switch (lflag) {
+  801654:	85 d2                	test   %edx,%edx
+  801656:	74 56                	je     8016ae <vprintfmt+0x660>
+  801658:	83 fa 01             	cmp    $0x1,%edx
+  80165b:	74 7f                	je     8016dc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80165d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801660:	83 f8 2f             	cmp    $0x2f,%eax
+  801663:	0f 87 a2 00 00 00    	ja     80170b <vprintfmt+0x6bd>
+  801669:	89 c2                	mov    %eax,%edx
+  80166b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80166f:	83 c0 08             	add    $0x8,%eax
+  801672:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801675:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801678:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80167d:	eb 8f                	jmp    80160e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80167f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801682:	83 f8 2f             	cmp    $0x2f,%eax
+  801685:	77 19                	ja     8016a0 <vprintfmt+0x652>
+  801687:	89 c2                	mov    %eax,%edx
+  801689:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80168d:	83 c0 08             	add    $0x8,%eax
+  801690:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801693:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801696:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80169b:	e9 6e ff ff ff       	jmp    80160e <vprintfmt+0x5c0>
+  8016a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016ac:	eb e5                	jmp    801693 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8016ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8016b4:	77 18                	ja     8016ce <vprintfmt+0x680>
+  8016b6:	89 c2                	mov    %eax,%edx
+  8016b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016bc:	83 c0 08             	add    $0x8,%eax
+  8016bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016c2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8016c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8016c9:	e9 40 ff ff ff       	jmp    80160e <vprintfmt+0x5c0>
+  8016ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016da:	eb e6                	jmp    8016c2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8016dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016df:	83 f8 2f             	cmp    $0x2f,%eax
+  8016e2:	77 19                	ja     8016fd <vprintfmt+0x6af>
+  8016e4:	89 c2                	mov    %eax,%edx
+  8016e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016ea:	83 c0 08             	add    $0x8,%eax
+  8016ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016f0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016f3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8016f8:	e9 11 ff ff ff       	jmp    80160e <vprintfmt+0x5c0>
+  8016fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801701:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801705:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801709:	eb e5                	jmp    8016f0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80170b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80170f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801713:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801717:	e9 59 ff ff ff       	jmp    801675 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80171c:	4c 89 ee             	mov    %r13,%rsi
+  80171f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801724:	41 ff d6             	call   *%r14
+            break;
+  801727:	e9 53 f9 ff ff       	jmp    80107f <vprintfmt+0x31>
+            putch('%', put_arg);
+  80172c:	4c 89 ee             	mov    %r13,%rsi
+  80172f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801734:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801737:	48 83 eb 01          	sub    $0x1,%rbx
+  80173b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80173f:	75 f6                	jne    801737 <vprintfmt+0x6e9>
+  801741:	e9 39 f9 ff ff       	jmp    80107f <vprintfmt+0x31>
+}
+  801746:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80174a:	5b                   	pop    %rbx
+  80174b:	41 5c                	pop    %r12
+  80174d:	41 5d                	pop    %r13
+  80174f:	41 5e                	pop    %r14
+  801751:	41 5f                	pop    %r15
+  801753:	5d                   	pop    %rbp
+  801754:	c3                   	ret
+
+0000000000801755 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801755:	55                   	push   %rbp
+  801756:	48 89 e5             	mov    %rsp,%rbp
+  801759:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80175d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801761:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801766:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80176a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801771:	48 85 ff             	test   %rdi,%rdi
+  801774:	74 2b                	je     8017a1 <vsnprintf+0x4c>
+  801776:	48 85 f6             	test   %rsi,%rsi
+  801779:	74 26                	je     8017a1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80177b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80177f:	48 bf f9 0f 80 00 00 	movabs $0x800ff9,%rdi
+  801786:	00 00 00 
+  801789:	48 b8 4e 10 80 00 00 	movabs $0x80104e,%rax
+  801790:	00 00 00 
+  801793:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801795:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801799:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80179c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80179f:	c9                   	leave
+  8017a0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8017a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a6:	eb f7                	jmp    80179f <vsnprintf+0x4a>
+
+00000000008017a8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017a8:	55                   	push   %rbp
+  8017a9:	48 89 e5             	mov    %rsp,%rbp
+  8017ac:	48 83 ec 50          	sub    $0x50,%rsp
+  8017b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017bc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8017d3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017d7:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  8017de:	00 00 00 
+  8017e1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8017e5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8017e8:	74 10                	je     8017fa <strlen+0x15>
+    size_t n = 0;
+  8017ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8017ef:	48 83 c0 01          	add    $0x1,%rax
+  8017f3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8017f7:	75 f6                	jne    8017ef <strlen+0xa>
+  8017f9:	c3                   	ret
+    size_t n = 0;
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8017ff:	c3                   	ret
+
+0000000000801800 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801800:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801803:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801808:	48 85 f6             	test   %rsi,%rsi
+  80180b:	74 11                	je     80181e <strnlen+0x1e>
+  80180d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801811:	74 0c                	je     80181f <strnlen+0x1f>
+  801813:	48 83 c2 01          	add    $0x1,%rdx
+  801817:	48 39 d0             	cmp    %rdx,%rax
+  80181a:	75 f1                	jne    80180d <strnlen+0xd>
+  80181c:	eb 04                	jmp    801822 <strnlen+0x22>
+  80181e:	c3                   	ret
+  80181f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801822:	c3                   	ret
+
+0000000000801823 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801823:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80182f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801832:	48 83 c2 01          	add    $0x1,%rdx
+  801836:	84 c9                	test   %cl,%cl
+  801838:	75 f1                	jne    80182b <strcpy+0x8>
+        ;
+    return res;
+}
+  80183a:	c3                   	ret
+
+000000000080183b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80183b:	55                   	push   %rbp
+  80183c:	48 89 e5             	mov    %rsp,%rbp
+  80183f:	41 54                	push   %r12
+  801841:	53                   	push   %rbx
+  801842:	48 89 fb             	mov    %rdi,%rbx
+  801845:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801848:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801854:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801858:	4c 89 e6             	mov    %r12,%rsi
+  80185b:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+    return dst;
+}
+  801867:	48 89 d8             	mov    %rbx,%rax
+  80186a:	5b                   	pop    %rbx
+  80186b:	41 5c                	pop    %r12
+  80186d:	5d                   	pop    %rbp
+  80186e:	c3                   	ret
+
+000000000080186f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80186f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801872:	48 85 d2             	test   %rdx,%rdx
+  801875:	74 1f                	je     801896 <strncpy+0x27>
+  801877:	48 01 fa             	add    %rdi,%rdx
+  80187a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80187d:	48 83 c1 01          	add    $0x1,%rcx
+  801881:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801885:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801889:	41 80 f8 01          	cmp    $0x1,%r8b
+  80188d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801891:	48 39 ca             	cmp    %rcx,%rdx
+  801894:	75 e7                	jne    80187d <strncpy+0xe>
+    }
+    return ret;
+}
+  801896:	c3                   	ret
+
+0000000000801897 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801897:	48 89 f8             	mov    %rdi,%rax
+  80189a:	48 85 d2             	test   %rdx,%rdx
+  80189d:	74 24                	je     8018c3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80189f:	48 83 ea 01          	sub    $0x1,%rdx
+  8018a3:	74 1b                	je     8018c0 <strlcpy+0x29>
+  8018a5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018a9:	0f b6 16             	movzbl (%rsi),%edx
+  8018ac:	84 d2                	test   %dl,%dl
+  8018ae:	74 10                	je     8018c0 <strlcpy+0x29>
+            *dst++ = *src++;
+  8018b0:	48 83 c6 01          	add    $0x1,%rsi
+  8018b4:	48 83 c0 01          	add    $0x1,%rax
+  8018b8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8018bb:	48 39 c8             	cmp    %rcx,%rax
+  8018be:	75 e9                	jne    8018a9 <strlcpy+0x12>
+        *dst = '\0';
+  8018c0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8018c3:	48 29 f8             	sub    %rdi,%rax
+}
+  8018c6:	c3                   	ret
+
+00000000008018c7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8018c7:	0f b6 07             	movzbl (%rdi),%eax
+  8018ca:	84 c0                	test   %al,%al
+  8018cc:	74 13                	je     8018e1 <strcmp+0x1a>
+  8018ce:	38 06                	cmp    %al,(%rsi)
+  8018d0:	75 0f                	jne    8018e1 <strcmp+0x1a>
+  8018d2:	48 83 c7 01          	add    $0x1,%rdi
+  8018d6:	48 83 c6 01          	add    $0x1,%rsi
+  8018da:	0f b6 07             	movzbl (%rdi),%eax
+  8018dd:	84 c0                	test   %al,%al
+  8018df:	75 ed                	jne    8018ce <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018e1:	0f b6 c0             	movzbl %al,%eax
+  8018e4:	0f b6 16             	movzbl (%rsi),%edx
+  8018e7:	29 d0                	sub    %edx,%eax
+}
+  8018e9:	c3                   	ret
+
+00000000008018ea <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8018ea:	48 85 d2             	test   %rdx,%rdx
+  8018ed:	74 1f                	je     80190e <strncmp+0x24>
+  8018ef:	0f b6 07             	movzbl (%rdi),%eax
+  8018f2:	84 c0                	test   %al,%al
+  8018f4:	74 1e                	je     801914 <strncmp+0x2a>
+  8018f6:	3a 06                	cmp    (%rsi),%al
+  8018f8:	75 1a                	jne    801914 <strncmp+0x2a>
+  8018fa:	48 83 c7 01          	add    $0x1,%rdi
+  8018fe:	48 83 c6 01          	add    $0x1,%rsi
+  801902:	48 83 ea 01          	sub    $0x1,%rdx
+  801906:	75 e7                	jne    8018ef <strncmp+0x5>
+
+    if (!n) return 0;
+  801908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190d:	c3                   	ret
+  80190e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801913:	c3                   	ret
+  801914:	48 85 d2             	test   %rdx,%rdx
+  801917:	74 09                	je     801922 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801919:	0f b6 07             	movzbl (%rdi),%eax
+  80191c:	0f b6 16             	movzbl (%rsi),%edx
+  80191f:	29 d0                	sub    %edx,%eax
+  801921:	c3                   	ret
+    if (!n) return 0;
+  801922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801927:	c3                   	ret
+
+0000000000801928 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801928:	0f b6 17             	movzbl (%rdi),%edx
+  80192b:	84 d2                	test   %dl,%dl
+  80192d:	74 18                	je     801947 <strchr+0x1f>
+        if (*str == c) {
+  80192f:	0f be d2             	movsbl %dl,%edx
+  801932:	39 f2                	cmp    %esi,%edx
+  801934:	74 17                	je     80194d <strchr+0x25>
+    for (; *str; str++) {
+  801936:	48 83 c7 01          	add    $0x1,%rdi
+  80193a:	0f b6 17             	movzbl (%rdi),%edx
+  80193d:	84 d2                	test   %dl,%dl
+  80193f:	75 ee                	jne    80192f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801941:	b8 00 00 00 00       	mov    $0x0,%eax
+  801946:	c3                   	ret
+  801947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194c:	c3                   	ret
+  80194d:	48 89 f8             	mov    %rdi,%rax
+}
+  801950:	c3                   	ret
+
+0000000000801951 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801951:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801954:	0f b6 17             	movzbl (%rdi),%edx
+  801957:	84 d2                	test   %dl,%dl
+  801959:	74 13                	je     80196e <strfind+0x1d>
+  80195b:	0f be d2             	movsbl %dl,%edx
+  80195e:	39 f2                	cmp    %esi,%edx
+  801960:	74 0b                	je     80196d <strfind+0x1c>
+  801962:	48 83 c0 01          	add    $0x1,%rax
+  801966:	0f b6 10             	movzbl (%rax),%edx
+  801969:	84 d2                	test   %dl,%dl
+  80196b:	75 ee                	jne    80195b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80196d:	c3                   	ret
+  80196e:	c3                   	ret
+
+000000000080196f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80196f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801972:	48 89 f8             	mov    %rdi,%rax
+  801975:	48 f7 d8             	neg    %rax
+  801978:	83 e0 07             	and    $0x7,%eax
+  80197b:	49 89 d1             	mov    %rdx,%r9
+  80197e:	49 29 c1             	sub    %rax,%r9
+  801981:	78 36                	js     8019b9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801983:	40 0f b6 c6          	movzbl %sil,%eax
+  801987:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80198e:	01 01 01 
+  801991:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801995:	40 f6 c7 07          	test   $0x7,%dil
+  801999:	75 38                	jne    8019d3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80199b:	4c 89 c9             	mov    %r9,%rcx
+  80199e:	48 c1 f9 03          	sar    $0x3,%rcx
+  8019a2:	74 0c                	je     8019b0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8019a4:	fc                   	cld
+  8019a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8019a8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8019ac:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8019b0:	4d 85 c9             	test   %r9,%r9
+  8019b3:	75 45                	jne    8019fa <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8019b5:	4c 89 c0             	mov    %r8,%rax
+  8019b8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8019b9:	48 85 d2             	test   %rdx,%rdx
+  8019bc:	74 f7                	je     8019b5 <memset+0x46>
+  8019be:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8019c1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8019c4:	48 83 c0 01          	add    $0x1,%rax
+  8019c8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8019cc:	48 39 c2             	cmp    %rax,%rdx
+  8019cf:	75 f3                	jne    8019c4 <memset+0x55>
+  8019d1:	eb e2                	jmp    8019b5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8019d3:	40 f6 c7 01          	test   $0x1,%dil
+  8019d7:	74 06                	je     8019df <memset+0x70>
+  8019d9:	88 07                	mov    %al,(%rdi)
+  8019db:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019df:	40 f6 c7 02          	test   $0x2,%dil
+  8019e3:	74 07                	je     8019ec <memset+0x7d>
+  8019e5:	66 89 07             	mov    %ax,(%rdi)
+  8019e8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019ec:	40 f6 c7 04          	test   $0x4,%dil
+  8019f0:	74 a9                	je     80199b <memset+0x2c>
+  8019f2:	89 07                	mov    %eax,(%rdi)
+  8019f4:	48 83 c7 04          	add    $0x4,%rdi
+  8019f8:	eb a1                	jmp    80199b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019fa:	41 f6 c1 04          	test   $0x4,%r9b
+  8019fe:	74 06                	je     801a06 <memset+0x97>
+  801a00:	89 07                	mov    %eax,(%rdi)
+  801a02:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801a06:	41 f6 c1 02          	test   $0x2,%r9b
+  801a0a:	74 07                	je     801a13 <memset+0xa4>
+  801a0c:	66 89 07             	mov    %ax,(%rdi)
+  801a0f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801a13:	41 f6 c1 01          	test   $0x1,%r9b
+  801a17:	74 9c                	je     8019b5 <memset+0x46>
+  801a19:	88 07                	mov    %al,(%rdi)
+  801a1b:	eb 98                	jmp    8019b5 <memset+0x46>
+
+0000000000801a1d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801a1d:	48 89 f8             	mov    %rdi,%rax
+  801a20:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801a23:	48 39 fe             	cmp    %rdi,%rsi
+  801a26:	73 3b                	jae    801a63 <memmove+0x46>
+  801a28:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801a2c:	48 39 d7             	cmp    %rdx,%rdi
+  801a2f:	73 32                	jae    801a63 <memmove+0x46>
+        s += n;
+        d += n;
+  801a31:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a35:	48 89 d6             	mov    %rdx,%rsi
+  801a38:	48 09 fe             	or     %rdi,%rsi
+  801a3b:	48 09 ce             	or     %rcx,%rsi
+  801a3e:	40 f6 c6 07          	test   $0x7,%sil
+  801a42:	75 12                	jne    801a56 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a44:	48 83 ef 08          	sub    $0x8,%rdi
+  801a48:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a4c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a50:	fd                   	std
+  801a51:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a54:	fc                   	cld
+  801a55:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a56:	48 83 ef 01          	sub    $0x1,%rdi
+  801a5a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a5e:	fd                   	std
+  801a5f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a61:	eb f1                	jmp    801a54 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a63:	48 89 f2             	mov    %rsi,%rdx
+  801a66:	48 09 c2             	or     %rax,%rdx
+  801a69:	48 09 ca             	or     %rcx,%rdx
+  801a6c:	f6 c2 07             	test   $0x7,%dl
+  801a6f:	75 0c                	jne    801a7d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a71:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a75:	48 89 c7             	mov    %rax,%rdi
+  801a78:	fc                   	cld
+  801a79:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a7c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a7d:	48 89 c7             	mov    %rax,%rdi
+  801a80:	fc                   	cld
+  801a81:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a83:	c3                   	ret
+
+0000000000801a84 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a84:	55                   	push   %rbp
+  801a85:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a88:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+}
+  801a94:	5d                   	pop    %rbp
+  801a95:	c3                   	ret
+
+0000000000801a96 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	41 57                	push   %r15
+  801a9c:	41 56                	push   %r14
+  801a9e:	41 55                	push   %r13
+  801aa0:	41 54                	push   %r12
+  801aa2:	53                   	push   %rbx
+  801aa3:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa7:	49 89 fe             	mov    %rdi,%r14
+  801aaa:	49 89 f7             	mov    %rsi,%r15
+  801aad:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801ab0:	48 89 f7             	mov    %rsi,%rdi
+  801ab3:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  801aba:	00 00 00 
+  801abd:	ff d0                	call   *%rax
+  801abf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801ac2:	48 89 de             	mov    %rbx,%rsi
+  801ac5:	4c 89 f7             	mov    %r14,%rdi
+  801ac8:	48 b8 00 18 80 00 00 	movabs $0x801800,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+  801ad4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ad7:	48 39 c3             	cmp    %rax,%rbx
+  801ada:	74 36                	je     801b12 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801adc:	48 89 d8             	mov    %rbx,%rax
+  801adf:	4c 29 e8             	sub    %r13,%rax
+  801ae2:	49 39 c4             	cmp    %rax,%r12
+  801ae5:	73 31                	jae    801b18 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801ae7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801aec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801af0:	4c 89 fe             	mov    %r15,%rsi
+  801af3:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801aff:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801b03:	48 83 c4 08          	add    $0x8,%rsp
+  801b07:	5b                   	pop    %rbx
+  801b08:	41 5c                	pop    %r12
+  801b0a:	41 5d                	pop    %r13
+  801b0c:	41 5e                	pop    %r14
+  801b0e:	41 5f                	pop    %r15
+  801b10:	5d                   	pop    %rbp
+  801b11:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b12:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b16:	eb eb                	jmp    801b03 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801b18:	48 83 eb 01          	sub    $0x1,%rbx
+  801b1c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b20:	48 89 da             	mov    %rbx,%rdx
+  801b23:	4c 89 fe             	mov    %r15,%rsi
+  801b26:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801b32:	49 01 de             	add    %rbx,%r14
+  801b35:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801b3a:	eb c3                	jmp    801aff <strlcat+0x69>
+
+0000000000801b3c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801b3c:	48 85 d2             	test   %rdx,%rdx
+  801b3f:	74 2d                	je     801b6e <memcmp+0x32>
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b46:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b4a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b4f:	44 38 c1             	cmp    %r8b,%cl
+  801b52:	75 0f                	jne    801b63 <memcmp+0x27>
+    while (n-- > 0) {
+  801b54:	48 83 c0 01          	add    $0x1,%rax
+  801b58:	48 39 c2             	cmp    %rax,%rdx
+  801b5b:	75 e9                	jne    801b46 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b62:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b63:	0f b6 c1             	movzbl %cl,%eax
+  801b66:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b6a:	44 29 c0             	sub    %r8d,%eax
+  801b6d:	c3                   	ret
+    return 0;
+  801b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b73:	c3                   	ret
+
+0000000000801b74 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b74:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b78:	48 39 c7             	cmp    %rax,%rdi
+  801b7b:	73 0f                	jae    801b8c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b7d:	40 38 37             	cmp    %sil,(%rdi)
+  801b80:	74 0e                	je     801b90 <memfind+0x1c>
+    for (; src < end; src++) {
+  801b82:	48 83 c7 01          	add    $0x1,%rdi
+  801b86:	48 39 f8             	cmp    %rdi,%rax
+  801b89:	75 f2                	jne    801b7d <memfind+0x9>
+  801b8b:	c3                   	ret
+  801b8c:	48 89 f8             	mov    %rdi,%rax
+  801b8f:	c3                   	ret
+  801b90:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b93:	c3                   	ret
+
+0000000000801b94 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b94:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b97:	0f b6 37             	movzbl (%rdi),%esi
+  801b9a:	40 80 fe 20          	cmp    $0x20,%sil
+  801b9e:	74 06                	je     801ba6 <strtol+0x12>
+  801ba0:	40 80 fe 09          	cmp    $0x9,%sil
+  801ba4:	75 13                	jne    801bb9 <strtol+0x25>
+  801ba6:	48 83 c7 01          	add    $0x1,%rdi
+  801baa:	0f b6 37             	movzbl (%rdi),%esi
+  801bad:	40 80 fe 20          	cmp    $0x20,%sil
+  801bb1:	74 f3                	je     801ba6 <strtol+0x12>
+  801bb3:	40 80 fe 09          	cmp    $0x9,%sil
+  801bb7:	74 ed                	je     801ba6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801bb9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801bbc:	83 e0 fd             	and    $0xfffffffd,%eax
+  801bbf:	3c 01                	cmp    $0x1,%al
+  801bc1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801bc5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801bcb:	75 0f                	jne    801bdc <strtol+0x48>
+  801bcd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801bd0:	74 14                	je     801be6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801bd2:	85 d2                	test   %edx,%edx
+  801bd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bd9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801be1:	4c 63 ca             	movslq %edx,%r9
+  801be4:	eb 36                	jmp    801c1c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801be6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801bea:	74 0f                	je     801bfb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801bec:	85 d2                	test   %edx,%edx
+  801bee:	75 ec                	jne    801bdc <strtol+0x48>
+        s++;
+  801bf0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801bf4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801bf9:	eb e1                	jmp    801bdc <strtol+0x48>
+        s += 2;
+  801bfb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801bff:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801c04:	eb d6                	jmp    801bdc <strtol+0x48>
+            dig -= '0';
+  801c06:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801c09:	44 0f b6 c1          	movzbl %cl,%r8d
+  801c0d:	41 39 d0             	cmp    %edx,%r8d
+  801c10:	7d 21                	jge    801c33 <strtol+0x9f>
+        val = val * base + dig;
+  801c12:	49 0f af c1          	imul   %r9,%rax
+  801c16:	0f b6 c9             	movzbl %cl,%ecx
+  801c19:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801c1c:	48 83 c7 01          	add    $0x1,%rdi
+  801c20:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801c24:	80 f9 39             	cmp    $0x39,%cl
+  801c27:	76 dd                	jbe    801c06 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801c29:	80 f9 7b             	cmp    $0x7b,%cl
+  801c2c:	77 05                	ja     801c33 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801c2e:	83 e9 57             	sub    $0x57,%ecx
+  801c31:	eb d6                	jmp    801c09 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801c33:	4d 85 d2             	test   %r10,%r10
+  801c36:	74 03                	je     801c3b <strtol+0xa7>
+  801c38:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801c3b:	48 89 c2             	mov    %rax,%rdx
+  801c3e:	48 f7 da             	neg    %rdx
+  801c41:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c45:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c49:	c3                   	ret
+
+0000000000801c4a <strrev>:
+
+void
+strrev(char *str)
+{
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	53                   	push   %rbx
+  801c4f:	48 83 ec 08          	sub    $0x8,%rsp
+  801c53:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801c56:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  801c5d:	00 00 00 
+  801c60:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801c62:	83 e8 01             	sub    $0x1,%eax
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	7e 22                	jle    801c8b <strrev+0x41>
+  801c69:	48 98                	cltq
+  801c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801c70:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801c74:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801c78:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801c7c:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801c7f:	48 83 c2 01          	add    $0x1,%rdx
+  801c83:	48 83 e8 01          	sub    $0x1,%rax
+  801c87:	39 c2                	cmp    %eax,%edx
+  801c89:	7c e5                	jl     801c70 <strrev+0x26>
+	}
+}
+  801c8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c8f:	c9                   	leave
+  801c90:	c3                   	ret
+
+0000000000801c91 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801c91:	85 d2                	test   %edx,%edx
+  801c93:	0f 84 80 00 00 00    	je     801d19 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801c99:	55                   	push   %rbp
+  801c9a:	48 89 e5             	mov    %rsp,%rbp
+  801c9d:	53                   	push   %rbx
+  801c9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801ca2:	49 89 f2             	mov    %rsi,%r10
+  801ca5:	41 89 d3             	mov    %edx,%r11d
+  801ca8:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801cab:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801cb0:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801cb3:	eb 20                	jmp    801cd5 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801cb5:	41 89 f1             	mov    %esi,%r9d
+  801cb8:	83 c2 30             	add    $0x30,%edx
+  801cbb:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801cbe:	89 f8                	mov    %edi,%eax
+  801cc0:	99                   	cltd
+  801cc1:	f7 f9                	idiv   %ecx
+  801cc3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	74 2e                	je     801cf7 <itoa+0x66>
+  801cc9:	83 c6 01             	add    $0x1,%esi
+  801ccc:	49 83 c0 01          	add    $0x1,%r8
+  801cd0:	44 39 cb             	cmp    %r9d,%ebx
+  801cd3:	7e 15                	jle    801cea <itoa+0x59>
+		digit = sum % base;
+  801cd5:	89 f8                	mov    %edi,%eax
+  801cd7:	99                   	cltd
+  801cd8:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801cda:	83 fa 09             	cmp    $0x9,%edx
+  801cdd:	7e d6                	jle    801cb5 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801cdf:	41 89 f1             	mov    %esi,%r9d
+  801ce2:	83 c2 37             	add    $0x37,%edx
+  801ce5:	41 88 10             	mov    %dl,(%r8)
+  801ce8:	eb d4                	jmp    801cbe <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801cea:	41 83 eb 01          	sub    $0x1,%r11d
+  801cee:	45 39 cb             	cmp    %r9d,%r11d
+  801cf1:	75 04                	jne    801cf7 <itoa+0x66>
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	75 28                	jne    801d1f <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801cf7:	4d 63 c9             	movslq %r9d,%r9
+  801cfa:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801cff:	4c 89 d7             	mov    %r10,%rdi
+  801d02:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+	return 0;
+  801d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d17:	c9                   	leave
+  801d18:	c3                   	ret
+		return -1;
+  801d19:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d1e:	c3                   	ret
+		return -1;
+  801d1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d24:	eb ed                	jmp    801d13 <itoa+0x82>
+
+0000000000801d26 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	53                   	push   %rbx
+  801d2b:	48 89 fa             	mov    %rdi,%rdx
+  801d2e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d31:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d40:	be 00 00 00 00       	mov    $0x0,%esi
+  801d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d4b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801d4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+0000000000801d53 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801d53:	55                   	push   %rbp
+  801d54:	48 89 e5             	mov    %rsp,%rbp
+  801d57:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d58:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d62:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d71:	be 00 00 00 00       	mov    $0x0,%esi
+  801d76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d7c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+0000000000801d84 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	53                   	push   %rbx
+  801d89:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801d8d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d90:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d95:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da4:	be 00 00 00 00       	mov    $0x0,%esi
+  801da9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801daf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801db1:	48 85 c0             	test   %rax,%rax
+  801db4:	7f 06                	jg     801dbc <sys_env_destroy+0x38>
+}
+  801db6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dbc:	49 89 c0             	mov    %rax,%r8
+  801dbf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801dc4:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  801dcb:	00 00 00 
+  801dce:	be 26 00 00 00       	mov    $0x26,%esi
+  801dd3:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  801dda:	00 00 00 
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  801de9:	00 00 00 
+  801dec:	41 ff d1             	call   *%r9
+
+0000000000801def <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801def:	55                   	push   %rbp
+  801df0:	48 89 e5             	mov    %rsp,%rbp
+  801df3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801df4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801df9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e08:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e18:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+
+0000000000801e20 <sys_yield>:
+
+void
+sys_yield(void) {
+  801e20:	55                   	push   %rbp
+  801e21:	48 89 e5             	mov    %rsp,%rbp
+  801e24:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e25:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e49:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+0000000000801e51 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801e51:	55                   	push   %rbp
+  801e52:	48 89 e5             	mov    %rsp,%rbp
+  801e55:	53                   	push   %rbx
+  801e56:	48 89 fa             	mov    %rdi,%rdx
+  801e59:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e5c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e61:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801e68:	00 00 00 
+  801e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e70:	be 00 00 00 00       	mov    $0x0,%esi
+  801e75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e7b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801e7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+
+0000000000801e83 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801e83:	55                   	push   %rbp
+  801e84:	48 89 e5             	mov    %rsp,%rbp
+  801e87:	53                   	push   %rbx
+  801e88:	49 89 f8             	mov    %rdi,%r8
+  801e8b:	48 89 d3             	mov    %rdx,%rbx
+  801e8e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801e91:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e96:	4c 89 c2             	mov    %r8,%rdx
+  801e99:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ea7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801ea9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+
+0000000000801eaf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	53                   	push   %rbx
+  801eb4:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb8:	89 f8                	mov    %edi,%eax
+  801eba:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801ebd:	48 63 f9             	movslq %ecx,%rdi
+  801ec0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ec3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ec8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ecb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ed6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ed8:	48 85 c0             	test   %rax,%rax
+  801edb:	7f 06                	jg     801ee3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801edd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ee3:	49 89 c0             	mov    %rax,%r8
+  801ee6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801eeb:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  801ef2:	00 00 00 
+  801ef5:	be 26 00 00 00       	mov    $0x26,%esi
+  801efa:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  801f01:	00 00 00 
+  801f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f09:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  801f10:	00 00 00 
+  801f13:	41 ff d1             	call   *%r9
+
+0000000000801f16 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	53                   	push   %rbx
+  801f1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f1f:	89 f8                	mov    %edi,%eax
+  801f21:	49 89 f2             	mov    %rsi,%r10
+  801f24:	48 89 cf             	mov    %rcx,%rdi
+  801f27:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801f2a:	48 63 da             	movslq %edx,%rbx
+  801f2d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f30:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f35:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f38:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801f3b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f3d:	48 85 c0             	test   %rax,%rax
+  801f40:	7f 06                	jg     801f48 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801f42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f48:	49 89 c0             	mov    %rax,%r8
+  801f4b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f50:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  801f57:	00 00 00 
+  801f5a:	be 26 00 00 00       	mov    $0x26,%esi
+  801f5f:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  801f66:	00 00 00 
+  801f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6e:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  801f75:	00 00 00 
+  801f78:	41 ff d1             	call   *%r9
+
+0000000000801f7b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+  801f7f:	53                   	push   %rbx
+  801f80:	48 83 ec 08          	sub    $0x8,%rsp
+  801f84:	48 89 f1             	mov    %rsi,%rcx
+  801f87:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801f8a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f8d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f92:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f97:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fa2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fa4:	48 85 c0             	test   %rax,%rax
+  801fa7:	7f 06                	jg     801faf <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801fa9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801faf:	49 89 c0             	mov    %rax,%r8
+  801fb2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801fb7:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  801fbe:	00 00 00 
+  801fc1:	be 26 00 00 00       	mov    $0x26,%esi
+  801fc6:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  801fcd:	00 00 00 
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd5:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  801fdc:	00 00 00 
+  801fdf:	41 ff d1             	call   *%r9
+
+0000000000801fe2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801fe2:	55                   	push   %rbp
+  801fe3:	48 89 e5             	mov    %rsp,%rbp
+  801fe6:	53                   	push   %rbx
+  801fe7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801feb:	48 63 ce             	movslq %esi,%rcx
+  801fee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ff1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ffb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802000:	be 00 00 00 00       	mov    $0x0,%esi
+  802005:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80200b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80200d:	48 85 c0             	test   %rax,%rax
+  802010:	7f 06                	jg     802018 <sys_env_set_status+0x36>
+}
+  802012:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802018:	49 89 c0             	mov    %rax,%r8
+  80201b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802020:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  802027:	00 00 00 
+  80202a:	be 26 00 00 00       	mov    $0x26,%esi
+  80202f:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  802036:	00 00 00 
+  802039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203e:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  802045:	00 00 00 
+  802048:	41 ff d1             	call   *%r9
+
+000000000080204b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80204b:	55                   	push   %rbp
+  80204c:	48 89 e5             	mov    %rsp,%rbp
+  80204f:	53                   	push   %rbx
+  802050:	48 83 ec 08          	sub    $0x8,%rsp
+  802054:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802057:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80205a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80205f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802064:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802069:	be 00 00 00 00       	mov    $0x0,%esi
+  80206e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802074:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802076:	48 85 c0             	test   %rax,%rax
+  802079:	7f 06                	jg     802081 <sys_env_set_trapframe+0x36>
+}
+  80207b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80207f:	c9                   	leave
+  802080:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802081:	49 89 c0             	mov    %rax,%r8
+  802084:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802089:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  802090:	00 00 00 
+  802093:	be 26 00 00 00       	mov    $0x26,%esi
+  802098:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  80209f:	00 00 00 
+  8020a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a7:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  8020ae:	00 00 00 
+  8020b1:	41 ff d1             	call   *%r9
+
+00000000008020b4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8020b4:	55                   	push   %rbp
+  8020b5:	48 89 e5             	mov    %rsp,%rbp
+  8020b8:	53                   	push   %rbx
+  8020b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8020c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020df:	48 85 c0             	test   %rax,%rax
+  8020e2:	7f 06                	jg     8020ea <sys_env_set_pgfault_upcall+0x36>
+}
+  8020e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020e8:	c9                   	leave
+  8020e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020ea:	49 89 c0             	mov    %rax,%r8
+  8020ed:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8020f2:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  8020f9:	00 00 00 
+  8020fc:	be 26 00 00 00       	mov    $0x26,%esi
+  802101:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  802108:	00 00 00 
+  80210b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802110:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  802117:	00 00 00 
+  80211a:	41 ff d1             	call   *%r9
+
+000000000080211d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80211d:	55                   	push   %rbp
+  80211e:	48 89 e5             	mov    %rsp,%rbp
+  802121:	53                   	push   %rbx
+  802122:	89 f8                	mov    %edi,%eax
+  802124:	49 89 f1             	mov    %rsi,%r9
+  802127:	48 89 d3             	mov    %rdx,%rbx
+  80212a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80212d:	49 63 f0             	movslq %r8d,%rsi
+  802130:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802133:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802138:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80213b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802141:	cd 30                	int    $0x30
+}
+  802143:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+
+0000000000802149 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	53                   	push   %rbx
+  80214e:	48 83 ec 08          	sub    $0x8,%rsp
+  802152:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  802155:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802158:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80215d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802160:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802165:	be 00 00 00 00       	mov    $0x0,%esi
+  80216a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802170:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802172:	48 85 c0             	test   %rax,%rax
+  802175:	7f 06                	jg     80217d <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802177:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80217b:	c9                   	leave
+  80217c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80217d:	49 89 c0             	mov    %rax,%r8
+  802180:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802185:	48 ba 88 4c 80 00 00 	movabs $0x804c88,%rdx
+  80218c:	00 00 00 
+  80218f:	be 26 00 00 00       	mov    $0x26,%esi
+  802194:	48 bf a7 4c 80 00 00 	movabs $0x804ca7,%rdi
+  80219b:	00 00 00 
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a3:	49 b9 ae 0d 80 00 00 	movabs $0x800dae,%r9
+  8021aa:	00 00 00 
+  8021ad:	41 ff d1             	call   *%r9
+
+00000000008021b0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8021b0:	55                   	push   %rbp
+  8021b1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8021b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b9:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+}
+  8021c5:	5d                   	pop    %rbp
+  8021c6:	c3                   	ret
+
+00000000008021c7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+  8021cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8021cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021f0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8021f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021f6:	c9                   	leave
+  8021f7:	c3                   	ret
+
+00000000008021f8 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8021f8:	55                   	push   %rbp
+  8021f9:	48 89 e5             	mov    %rsp,%rbp
+  8021fc:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8021fd:	48 63 ce             	movslq %esi,%rcx
+  802200:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  802204:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80220e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802213:	be 00 00 00 00       	mov    $0x0,%esi
+  802218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80221e:	cd 30                	int    $0x30
+}
+  802220:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+
+0000000000802226 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	53                   	push   %rbx
+  80222b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80222e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802232:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802237:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80223c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802241:	be 00 00 00 00       	mov    $0x0,%esi
+  802246:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80224c:	cd 30                	int    $0x30
+}
+  80224e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+
+0000000000802254 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	53                   	push   %rbx
+  802259:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80225c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80225f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802264:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802267:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80226c:	be 00 00 00 00       	mov    $0x0,%esi
+  802271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802277:	cd 30                	int    $0x30
+}
+  802279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+
+000000000080227f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80227f:	55                   	push   %rbp
+  802280:	48 89 e5             	mov    %rsp,%rbp
+  802283:	41 56                	push   %r14
+  802285:	41 55                	push   %r13
+  802287:	41 54                	push   %r12
+  802289:	53                   	push   %rbx
+  80228a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80228d:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  802294:	00 00 00 
+  802297:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80229b:	74 27                	je     8022c4 <_handle_vectored_pagefault+0x45>
+  80229d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8022a2:	49 bd e0 61 80 00 00 	movabs $0x8061e0,%r13
+  8022a9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8022ac:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8022af:	4c 89 e7             	mov    %r12,%rdi
+  8022b2:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8022b7:	84 c0                	test   %al,%al
+  8022b9:	75 45                	jne    802300 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8022bb:	48 83 c3 01          	add    $0x1,%rbx
+  8022bf:	49 3b 1e             	cmp    (%r14),%rbx
+  8022c2:	72 eb                	jb     8022af <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8022c4:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8022cb:	00 
+  8022cc:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8022d1:	4d 8b 04 24          	mov    (%r12),%r8
+  8022d5:	48 ba b8 4c 80 00 00 	movabs $0x804cb8,%rdx
+  8022dc:	00 00 00 
+  8022df:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8022e4:	48 bf e8 4c 80 00 00 	movabs $0x804ce8,%rdi
+  8022eb:	00 00 00 
+  8022ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f3:	49 ba ae 0d 80 00 00 	movabs $0x800dae,%r10
+  8022fa:	00 00 00 
+  8022fd:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802300:	5b                   	pop    %rbx
+  802301:	41 5c                	pop    %r12
+  802303:	41 5d                	pop    %r13
+  802305:	41 5e                	pop    %r14
+  802307:	5d                   	pop    %rbp
+  802308:	c3                   	ret
+
+0000000000802309 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802309:	55                   	push   %rbp
+  80230a:	48 89 e5             	mov    %rsp,%rbp
+  80230d:	53                   	push   %rbx
+  80230e:	48 83 ec 08          	sub    $0x8,%rsp
+  802312:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  802315:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  80231c:	00 00 00 
+  80231f:	80 38 00             	cmpb   $0x0,(%rax)
+  802322:	0f 84 84 00 00 00    	je     8023ac <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802328:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  80232f:	00 00 00 
+  802332:	48 8b 10             	mov    (%rax),%rdx
+  802335:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80233a:	48 b9 e0 61 80 00 00 	movabs $0x8061e0,%rcx
+  802341:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802344:	48 85 d2             	test   %rdx,%rdx
+  802347:	74 19                	je     802362 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802349:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80234d:	0f 84 e8 00 00 00    	je     80243b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802353:	48 83 c0 01          	add    $0x1,%rax
+  802357:	48 39 d0             	cmp    %rdx,%rax
+  80235a:	75 ed                	jne    802349 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80235c:	48 83 fa 08          	cmp    $0x8,%rdx
+  802360:	74 1c                	je     80237e <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802362:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802366:	48 a3 28 62 80 00 00 	movabs %rax,0x806228
+  80236d:	00 00 00 
+  802370:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802377:	00 00 00 
+  80237a:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80237e:	48 b8 ef 1d 80 00 00 	movabs $0x801def,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	89 c7                	mov    %eax,%edi
+  80238c:	48 be 01 25 80 00 00 	movabs $0x802501,%rsi
+  802393:	00 00 00 
+  802396:	48 b8 b4 20 80 00 00 	movabs $0x8020b4,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	78 68                	js     80240e <add_pgfault_handler+0x105>
+    return res;
+}
+  8023a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023aa:	c9                   	leave
+  8023ab:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8023ac:	48 b8 ef 1d 80 00 00 	movabs $0x801def,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+  8023b8:	89 c7                	mov    %eax,%edi
+  8023ba:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8023bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023c4:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8023cb:	00 00 00 
+  8023ce:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  8023d5:	00 00 00 
+  8023d8:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8023da:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8023e1:	00 00 00 
+  8023e4:	48 8b 02             	mov    (%rdx),%rax
+  8023e7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8023eb:	48 89 0a             	mov    %rcx,(%rdx)
+  8023ee:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  8023f5:	00 00 00 
+  8023f8:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8023fc:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  802403:	00 00 00 
+  802406:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  802409:	e9 70 ff ff ff       	jmp    80237e <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80240e:	89 c1                	mov    %eax,%ecx
+  802410:	48 ba f6 4c 80 00 00 	movabs $0x804cf6,%rdx
+  802417:	00 00 00 
+  80241a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80241f:	48 bf e8 4c 80 00 00 	movabs $0x804ce8,%rdi
+  802426:	00 00 00 
+  802429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242e:	49 b8 ae 0d 80 00 00 	movabs $0x800dae,%r8
+  802435:	00 00 00 
+  802438:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80243b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802440:	e9 61 ff ff ff       	jmp    8023a6 <add_pgfault_handler+0x9d>
+
+0000000000802445 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802445:	55                   	push   %rbp
+  802446:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802449:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  802450:	00 00 00 
+  802453:	80 38 00             	cmpb   $0x0,(%rax)
+  802456:	74 33                	je     80248b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802458:	48 a1 28 62 80 00 00 	movabs 0x806228,%rax
+  80245f:	00 00 00 
+  802462:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802467:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  80246e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802471:	48 85 c0             	test   %rax,%rax
+  802474:	0f 84 85 00 00 00    	je     8024ff <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80247a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80247e:	74 40                	je     8024c0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802480:	48 83 c1 01          	add    $0x1,%rcx
+  802484:	48 39 c1             	cmp    %rax,%rcx
+  802487:	75 f1                	jne    80247a <remove_pgfault_handler+0x35>
+  802489:	eb 74                	jmp    8024ff <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80248b:	48 b9 0e 4d 80 00 00 	movabs $0x804d0e,%rcx
+  802492:	00 00 00 
+  802495:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  80249c:	00 00 00 
+  80249f:	be 43 00 00 00       	mov    $0x43,%esi
+  8024a4:	48 bf e8 4c 80 00 00 	movabs $0x804ce8,%rdi
+  8024ab:	00 00 00 
+  8024ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b3:	49 b8 ae 0d 80 00 00 	movabs $0x800dae,%r8
+  8024ba:	00 00 00 
+  8024bd:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8024c0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8024c7:	00 
+  8024c8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8024cc:	48 29 ca             	sub    %rcx,%rdx
+  8024cf:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  8024d6:	00 00 00 
+  8024d9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8024dd:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8024e2:	48 89 ce             	mov    %rcx,%rsi
+  8024e5:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8024f1:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  8024f8:	00 00 00 
+  8024fb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8024ff:	5d                   	pop    %rbp
+  802500:	c3                   	ret
+
+0000000000802501 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  802501:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  802504:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80250b:	00 00 00 
+    call *%rax
+  80250e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    popq %r15
+  802510:	41 5f                	pop    %r15
+    popq %r15
+  802512:	41 5f                	pop    %r15
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+    popq %r15
+  802514:	41 5f                	pop    %r15
+    popq %r14
+  802516:	41 5e                	pop    %r14
+    popq %r13
+  802518:	41 5d                	pop    %r13
+    popq %r12
+  80251a:	41 5c                	pop    %r12
+    popq %r11
+  80251c:	41 5b                	pop    %r11
+    popq %r10
+  80251e:	41 5a                	pop    %r10
+    popq %r9
+  802520:	41 59                	pop    %r9
+    popq %r8
+  802522:	41 58                	pop    %r8
+    popq %rsi
+  802524:	5e                   	pop    %rsi
+    popq %rdi
+  802525:	5f                   	pop    %rdi
+    popq %rbp
+  802526:	5d                   	pop    %rbp
+    popq %rdx
+  802527:	5a                   	pop    %rdx
+    popq %rcx
+  802528:	59                   	pop    %rcx
+    movq 32(%rsp), %rbx
+  802529:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  80252e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  802533:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  802537:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80253a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+    popq %rbx
+  80253f:	5b                   	pop    %rbx
+    popq %rax
+  802540:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    pushq 8(%rsp)
+  802541:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  802545:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    movq 16(%rsp), %rsp
+  802546:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+  80254b:	c3                   	ret
+
+000000000080254c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80254c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802553:	ff ff ff 
+  802556:	48 01 f8             	add    %rdi,%rax
+  802559:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80255d:	c3                   	ret
+
+000000000080255e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80255e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802565:	ff ff ff 
+  802568:	48 01 f8             	add    %rdi,%rax
+  80256b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80256f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802575:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802579:	c3                   	ret
+
+000000000080257a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80257a:	55                   	push   %rbp
+  80257b:	48 89 e5             	mov    %rsp,%rbp
+  80257e:	41 57                	push   %r15
+  802580:	41 56                	push   %r14
+  802582:	41 55                	push   %r13
+  802584:	41 54                	push   %r12
+  802586:	53                   	push   %rbx
+  802587:	48 83 ec 08          	sub    $0x8,%rsp
+  80258b:	49 89 ff             	mov    %rdi,%r15
+  80258e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802593:	49 bd 99 40 80 00 00 	movabs $0x804099,%r13
+  80259a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80259d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8025a3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8025a6:	48 89 df             	mov    %rbx,%rdi
+  8025a9:	41 ff d5             	call   *%r13
+  8025ac:	83 e0 04             	and    $0x4,%eax
+  8025af:	74 17                	je     8025c8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8025b1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025b8:	4c 39 f3             	cmp    %r14,%rbx
+  8025bb:	75 e6                	jne    8025a3 <fd_alloc+0x29>
+  8025bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8025c3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8025c8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8025cb:	48 83 c4 08          	add    $0x8,%rsp
+  8025cf:	5b                   	pop    %rbx
+  8025d0:	41 5c                	pop    %r12
+  8025d2:	41 5d                	pop    %r13
+  8025d4:	41 5e                	pop    %r14
+  8025d6:	41 5f                	pop    %r15
+  8025d8:	5d                   	pop    %rbp
+  8025d9:	c3                   	ret
+
+00000000008025da <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8025da:	83 ff 1f             	cmp    $0x1f,%edi
+  8025dd:	77 39                	ja     802618 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	41 54                	push   %r12
+  8025e5:	53                   	push   %rbx
+  8025e6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8025e9:	48 63 df             	movslq %edi,%rbx
+  8025ec:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8025f3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8025f7:	48 89 df             	mov    %rbx,%rdi
+  8025fa:	48 b8 99 40 80 00 00 	movabs $0x804099,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+  802606:	a8 04                	test   $0x4,%al
+  802608:	74 14                	je     80261e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80260a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80260e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802613:	5b                   	pop    %rbx
+  802614:	41 5c                	pop    %r12
+  802616:	5d                   	pop    %rbp
+  802617:	c3                   	ret
+        return -E_INVAL;
+  802618:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80261d:	c3                   	ret
+        return -E_INVAL;
+  80261e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802623:	eb ee                	jmp    802613 <fd_lookup+0x39>
+
+0000000000802625 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802625:	55                   	push   %rbp
+  802626:	48 89 e5             	mov    %rsp,%rbp
+  802629:	41 54                	push   %r12
+  80262b:	53                   	push   %rbx
+  80262c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80262f:	48 b8 e0 4d 80 00 00 	movabs $0x804de0,%rax
+  802636:	00 00 00 
+  802639:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  802640:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802643:	39 3b                	cmp    %edi,(%rbx)
+  802645:	74 47                	je     80268e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802647:	48 83 c0 08          	add    $0x8,%rax
+  80264b:	48 8b 18             	mov    (%rax),%rbx
+  80264e:	48 85 db             	test   %rbx,%rbx
+  802651:	75 f0                	jne    802643 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802653:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  80265a:	00 00 00 
+  80265d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802663:	89 fa                	mov    %edi,%edx
+  802665:	48 bf 40 4d 80 00 00 	movabs $0x804d40,%rdi
+  80266c:	00 00 00 
+  80266f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802674:	48 b9 fe 0e 80 00 00 	movabs $0x800efe,%rcx
+  80267b:	00 00 00 
+  80267e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802680:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802685:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802689:	5b                   	pop    %rbx
+  80268a:	41 5c                	pop    %r12
+  80268c:	5d                   	pop    %rbp
+  80268d:	c3                   	ret
+            return 0;
+  80268e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802693:	eb f0                	jmp    802685 <dev_lookup+0x60>
+
+0000000000802695 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802695:	55                   	push   %rbp
+  802696:	48 89 e5             	mov    %rsp,%rbp
+  802699:	41 55                	push   %r13
+  80269b:	41 54                	push   %r12
+  80269d:	53                   	push   %rbx
+  80269e:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a2:	48 89 fb             	mov    %rdi,%rbx
+  8026a5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026a8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8026af:	ff ff ff 
+  8026b2:	48 01 df             	add    %rbx,%rdi
+  8026b5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8026b9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026bd:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  8026c4:	00 00 00 
+  8026c7:	ff d0                	call   *%rax
+  8026c9:	41 89 c5             	mov    %eax,%r13d
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	78 06                	js     8026d6 <fd_close+0x41>
+  8026d0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8026d4:	74 1a                	je     8026f0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8026d6:	45 84 e4             	test   %r12b,%r12b
+  8026d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026de:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8026e2:	44 89 e8             	mov    %r13d,%eax
+  8026e5:	48 83 c4 18          	add    $0x18,%rsp
+  8026e9:	5b                   	pop    %rbx
+  8026ea:	41 5c                	pop    %r12
+  8026ec:	41 5d                	pop    %r13
+  8026ee:	5d                   	pop    %rbp
+  8026ef:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8026f0:	8b 3b                	mov    (%rbx),%edi
+  8026f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026f6:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  8026fd:	00 00 00 
+  802700:	ff d0                	call   *%rax
+  802702:	41 89 c5             	mov    %eax,%r13d
+  802705:	85 c0                	test   %eax,%eax
+  802707:	78 1b                	js     802724 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802709:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80270d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802711:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802717:	48 85 c0             	test   %rax,%rax
+  80271a:	74 08                	je     802724 <fd_close+0x8f>
+  80271c:	48 89 df             	mov    %rbx,%rdi
+  80271f:	ff d0                	call   *%rax
+  802721:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802724:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802729:	48 89 de             	mov    %rbx,%rsi
+  80272c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802731:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  802738:	00 00 00 
+  80273b:	ff d0                	call   *%rax
+    return res;
+  80273d:	eb a3                	jmp    8026e2 <fd_close+0x4d>
+
+000000000080273f <close>:
+
+int
+close(int fdnum) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+  802743:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802747:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80274b:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802757:	85 c0                	test   %eax,%eax
+  802759:	78 15                	js     802770 <close+0x31>
+
+    return fd_close(fd, 1);
+  80275b:	be 01 00 00 00       	mov    $0x1,%esi
+  802760:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802764:	48 b8 95 26 80 00 00 	movabs $0x802695,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+}
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+0000000000802772 <close_all>:
+
+void
+close_all(void) {
+  802772:	55                   	push   %rbp
+  802773:	48 89 e5             	mov    %rsp,%rbp
+  802776:	41 54                	push   %r12
+  802778:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802779:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80277e:	49 bc 3f 27 80 00 00 	movabs $0x80273f,%r12
+  802785:	00 00 00 
+  802788:	89 df                	mov    %ebx,%edi
+  80278a:	41 ff d4             	call   *%r12
+  80278d:	83 c3 01             	add    $0x1,%ebx
+  802790:	83 fb 20             	cmp    $0x20,%ebx
+  802793:	75 f3                	jne    802788 <close_all+0x16>
+}
+  802795:	5b                   	pop    %rbx
+  802796:	41 5c                	pop    %r12
+  802798:	5d                   	pop    %rbp
+  802799:	c3                   	ret
+
+000000000080279a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	41 57                	push   %r15
+  8027a0:	41 56                	push   %r14
+  8027a2:	41 55                	push   %r13
+  8027a4:	41 54                	push   %r12
+  8027a6:	53                   	push   %rbx
+  8027a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ab:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8027ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8027b2:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  8027b9:	00 00 00 
+  8027bc:	ff d0                	call   *%rax
+  8027be:	89 c3                	mov    %eax,%ebx
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	0f 88 b8 00 00 00    	js     802880 <dup+0xe6>
+    close(newfdnum);
+  8027c8:	44 89 e7             	mov    %r12d,%edi
+  8027cb:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8027d7:	4d 63 ec             	movslq %r12d,%r13
+  8027da:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8027e1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8027e5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8027e9:	4c 89 ff             	mov    %r15,%rdi
+  8027ec:	49 be 5e 25 80 00 00 	movabs $0x80255e,%r14
+  8027f3:	00 00 00 
+  8027f6:	41 ff d6             	call   *%r14
+  8027f9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8027fc:	4c 89 ef             	mov    %r13,%rdi
+  8027ff:	41 ff d6             	call   *%r14
+  802802:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802805:	48 89 df             	mov    %rbx,%rdi
+  802808:	48 b8 99 40 80 00 00 	movabs $0x804099,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802814:	a8 04                	test   $0x4,%al
+  802816:	74 2b                	je     802843 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802818:	41 89 c1             	mov    %eax,%r9d
+  80281b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802821:	4c 89 f1             	mov    %r14,%rcx
+  802824:	ba 00 00 00 00       	mov    $0x0,%edx
+  802829:	48 89 de             	mov    %rbx,%rsi
+  80282c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802831:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	89 c3                	mov    %eax,%ebx
+  80283f:	85 c0                	test   %eax,%eax
+  802841:	78 4e                	js     802891 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802843:	4c 89 ff             	mov    %r15,%rdi
+  802846:	48 b8 99 40 80 00 00 	movabs $0x804099,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802855:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80285b:	4c 89 e9             	mov    %r13,%rcx
+  80285e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802863:	4c 89 fe             	mov    %r15,%rsi
+  802866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286b:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  802872:	00 00 00 
+  802875:	ff d0                	call   *%rax
+  802877:	89 c3                	mov    %eax,%ebx
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 14                	js     802891 <dup+0xf7>
+
+    return newfdnum;
+  80287d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802880:	89 d8                	mov    %ebx,%eax
+  802882:	48 83 c4 18          	add    $0x18,%rsp
+  802886:	5b                   	pop    %rbx
+  802887:	41 5c                	pop    %r12
+  802889:	41 5d                	pop    %r13
+  80288b:	41 5e                	pop    %r14
+  80288d:	41 5f                	pop    %r15
+  80288f:	5d                   	pop    %rbp
+  802890:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802891:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802896:	4c 89 ee             	mov    %r13,%rsi
+  802899:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289e:	49 bc 7b 1f 80 00 00 	movabs $0x801f7b,%r12
+  8028a5:	00 00 00 
+  8028a8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8028ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028b0:	4c 89 f6             	mov    %r14,%rsi
+  8028b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028b8:	41 ff d4             	call   *%r12
+    return res;
+  8028bb:	eb c3                	jmp    802880 <dup+0xe6>
+
+00000000008028bd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8028bd:	55                   	push   %rbp
+  8028be:	48 89 e5             	mov    %rsp,%rbp
+  8028c1:	41 56                	push   %r14
+  8028c3:	41 55                	push   %r13
+  8028c5:	41 54                	push   %r12
+  8028c7:	53                   	push   %rbx
+  8028c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cc:	89 fb                	mov    %edi,%ebx
+  8028ce:	49 89 f4             	mov    %rsi,%r12
+  8028d1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028d4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028d8:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	78 4c                	js     802934 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028e8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8028ec:	41 8b 3e             	mov    (%r14),%edi
+  8028ef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028f3:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	78 35                	js     802938 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802903:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802907:	83 e0 03             	and    $0x3,%eax
+  80290a:	83 f8 01             	cmp    $0x1,%eax
+  80290d:	74 2d                	je     80293c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80290f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802913:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802917:	48 85 c0             	test   %rax,%rax
+  80291a:	74 56                	je     802972 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80291c:	4c 89 ea             	mov    %r13,%rdx
+  80291f:	4c 89 e6             	mov    %r12,%rsi
+  802922:	4c 89 f7             	mov    %r14,%rdi
+  802925:	ff d0                	call   *%rax
+}
+  802927:	48 83 c4 10          	add    $0x10,%rsp
+  80292b:	5b                   	pop    %rbx
+  80292c:	41 5c                	pop    %r12
+  80292e:	41 5d                	pop    %r13
+  802930:	41 5e                	pop    %r14
+  802932:	5d                   	pop    %rbp
+  802933:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802934:	48 98                	cltq
+  802936:	eb ef                	jmp    802927 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802938:	48 98                	cltq
+  80293a:	eb eb                	jmp    802927 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80293c:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802943:	00 00 00 
+  802946:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80294c:	89 da                	mov    %ebx,%edx
+  80294e:	48 bf a1 4d 80 00 00 	movabs $0x804da1,%rdi
+  802955:	00 00 00 
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295d:	48 b9 fe 0e 80 00 00 	movabs $0x800efe,%rcx
+  802964:	00 00 00 
+  802967:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802969:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802970:	eb b5                	jmp    802927 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802972:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802979:	eb ac                	jmp    802927 <read+0x6a>
+
+000000000080297b <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  80297b:	55                   	push   %rbp
+  80297c:	48 89 e5             	mov    %rsp,%rbp
+  80297f:	41 56                	push   %r14
+  802981:	41 55                	push   %r13
+  802983:	41 54                	push   %r12
+  802985:	53                   	push   %rbx
+  802986:	48 83 ec 10          	sub    $0x10,%rsp
+  80298a:	89 fb                	mov    %edi,%ebx
+  80298c:	49 89 f4             	mov    %rsi,%r12
+  80298f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802992:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802996:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  80299d:	00 00 00 
+  8029a0:	ff d0                	call   *%rax
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 41                	js     8029e7 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029a6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8029aa:	41 8b 3e             	mov    (%r14),%edi
+  8029ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029b1:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 35                	js     8029f6 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8029c1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8029c5:	83 e0 03             	and    $0x3,%eax
+  8029c8:	83 f8 01             	cmp    $0x1,%eax
+  8029cb:	74 2d                	je     8029fa <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8029cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029d1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8029d5:	48 85 c0             	test   %rax,%rax
+  8029d8:	74 56                	je     802a30 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8029da:	4c 89 ea             	mov    %r13,%rdx
+  8029dd:	4c 89 e6             	mov    %r12,%rsi
+  8029e0:	4c 89 f7             	mov    %r14,%rdi
+  8029e3:	ff d0                	call   *%rax
+  8029e5:	eb 02                	jmp    8029e9 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029e7:	48 98                	cltq
+}
+  8029e9:	48 83 c4 10          	add    $0x10,%rsp
+  8029ed:	5b                   	pop    %rbx
+  8029ee:	41 5c                	pop    %r12
+  8029f0:	41 5d                	pop    %r13
+  8029f2:	41 5e                	pop    %r14
+  8029f4:	5d                   	pop    %rbp
+  8029f5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029f6:	48 98                	cltq
+  8029f8:	eb ef                	jmp    8029e9 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8029fa:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802a01:	00 00 00 
+  802a04:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a0a:	89 da                	mov    %ebx,%edx
+  802a0c:	48 bf 60 4d 80 00 00 	movabs $0x804d60,%rdi
+  802a13:	00 00 00 
+  802a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1b:	48 b9 fe 0e 80 00 00 	movabs $0x800efe,%rcx
+  802a22:	00 00 00 
+  802a25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a27:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a2e:	eb b9                	jmp    8029e9 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802a30:	4c 89 ea             	mov    %r13,%rdx
+  802a33:	4c 89 e6             	mov    %r12,%rsi
+  802a36:	89 df                	mov    %ebx,%edi
+  802a38:	48 b8 bd 28 80 00 00 	movabs $0x8028bd,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	eb a3                	jmp    8029e9 <readmap+0x6e>
+
+0000000000802a46 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802a46:	55                   	push   %rbp
+  802a47:	48 89 e5             	mov    %rsp,%rbp
+  802a4a:	41 57                	push   %r15
+  802a4c:	41 56                	push   %r14
+  802a4e:	41 55                	push   %r13
+  802a50:	41 54                	push   %r12
+  802a52:	53                   	push   %rbx
+  802a53:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802a57:	48 85 d2             	test   %rdx,%rdx
+  802a5a:	74 54                	je     802ab0 <readn+0x6a>
+  802a5c:	41 89 fd             	mov    %edi,%r13d
+  802a5f:	49 89 f6             	mov    %rsi,%r14
+  802a62:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802a65:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802a6a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802a6f:	49 bf bd 28 80 00 00 	movabs $0x8028bd,%r15
+  802a76:	00 00 00 
+  802a79:	4c 89 e2             	mov    %r12,%rdx
+  802a7c:	48 29 f2             	sub    %rsi,%rdx
+  802a7f:	4c 01 f6             	add    %r14,%rsi
+  802a82:	44 89 ef             	mov    %r13d,%edi
+  802a85:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	78 20                	js     802aac <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802a8c:	01 c3                	add    %eax,%ebx
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	74 08                	je     802a9a <readn+0x54>
+  802a92:	48 63 f3             	movslq %ebx,%rsi
+  802a95:	4c 39 e6             	cmp    %r12,%rsi
+  802a98:	72 df                	jb     802a79 <readn+0x33>
+    }
+    return res;
+  802a9a:	48 63 c3             	movslq %ebx,%rax
+}
+  802a9d:	48 83 c4 08          	add    $0x8,%rsp
+  802aa1:	5b                   	pop    %rbx
+  802aa2:	41 5c                	pop    %r12
+  802aa4:	41 5d                	pop    %r13
+  802aa6:	41 5e                	pop    %r14
+  802aa8:	41 5f                	pop    %r15
+  802aaa:	5d                   	pop    %rbp
+  802aab:	c3                   	ret
+        if (inc < 0) return inc;
+  802aac:	48 98                	cltq
+  802aae:	eb ed                	jmp    802a9d <readn+0x57>
+    int inc = 1, res = 0;
+  802ab0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ab5:	eb e3                	jmp    802a9a <readn+0x54>
+
+0000000000802ab7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802ab7:	55                   	push   %rbp
+  802ab8:	48 89 e5             	mov    %rsp,%rbp
+  802abb:	41 56                	push   %r14
+  802abd:	41 55                	push   %r13
+  802abf:	41 54                	push   %r12
+  802ac1:	53                   	push   %rbx
+  802ac2:	48 83 ec 10          	sub    $0x10,%rsp
+  802ac6:	89 fb                	mov    %edi,%ebx
+  802ac8:	49 89 f4             	mov    %rsi,%r12
+  802acb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ace:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ad2:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+  802ade:	85 c0                	test   %eax,%eax
+  802ae0:	78 47                	js     802b29 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ae2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802ae6:	41 8b 3e             	mov    (%r14),%edi
+  802ae9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802aed:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802af4:	00 00 00 
+  802af7:	ff d0                	call   *%rax
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 30                	js     802b2d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802afd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802b02:	74 2d                	je     802b31 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802b04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b08:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b0c:	48 85 c0             	test   %rax,%rax
+  802b0f:	74 56                	je     802b67 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802b11:	4c 89 ea             	mov    %r13,%rdx
+  802b14:	4c 89 e6             	mov    %r12,%rsi
+  802b17:	4c 89 f7             	mov    %r14,%rdi
+  802b1a:	ff d0                	call   *%rax
+}
+  802b1c:	48 83 c4 10          	add    $0x10,%rsp
+  802b20:	5b                   	pop    %rbx
+  802b21:	41 5c                	pop    %r12
+  802b23:	41 5d                	pop    %r13
+  802b25:	41 5e                	pop    %r14
+  802b27:	5d                   	pop    %rbp
+  802b28:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b29:	48 98                	cltq
+  802b2b:	eb ef                	jmp    802b1c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b2d:	48 98                	cltq
+  802b2f:	eb eb                	jmp    802b1c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802b31:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802b38:	00 00 00 
+  802b3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802b41:	89 da                	mov    %ebx,%edx
+  802b43:	48 bf bd 4d 80 00 00 	movabs $0x804dbd,%rdi
+  802b4a:	00 00 00 
+  802b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b52:	48 b9 fe 0e 80 00 00 	movabs $0x800efe,%rcx
+  802b59:	00 00 00 
+  802b5c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b5e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b65:	eb b5                	jmp    802b1c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802b67:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802b6e:	eb ac                	jmp    802b1c <write+0x65>
+
+0000000000802b70 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802b70:	55                   	push   %rbp
+  802b71:	48 89 e5             	mov    %rsp,%rbp
+  802b74:	53                   	push   %rbx
+  802b75:	48 83 ec 18          	sub    $0x18,%rsp
+  802b79:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b7b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b7f:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	78 0c                	js     802b9b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b93:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+0000000000802ba1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+  802ba5:	41 55                	push   %r13
+  802ba7:	41 54                	push   %r12
+  802ba9:	53                   	push   %rbx
+  802baa:	48 83 ec 18          	sub    $0x18,%rsp
+  802bae:	89 fb                	mov    %edi,%ebx
+  802bb0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bb3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802bb7:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 38                	js     802bff <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bc7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802bcb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802bcf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802bd3:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+  802bdf:	85 c0                	test   %eax,%eax
+  802be1:	78 1c                	js     802bff <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802be3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802be8:	74 20                	je     802c0a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802bea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bee:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802bf2:	48 85 c0             	test   %rax,%rax
+  802bf5:	74 47                	je     802c3e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802bf7:	44 89 e6             	mov    %r12d,%esi
+  802bfa:	4c 89 ef             	mov    %r13,%rdi
+  802bfd:	ff d0                	call   *%rax
+}
+  802bff:	48 83 c4 18          	add    $0x18,%rsp
+  802c03:	5b                   	pop    %rbx
+  802c04:	41 5c                	pop    %r12
+  802c06:	41 5d                	pop    %r13
+  802c08:	5d                   	pop    %rbp
+  802c09:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802c0a:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802c11:	00 00 00 
+  802c14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802c1a:	89 da                	mov    %ebx,%edx
+  802c1c:	48 bf 80 4d 80 00 00 	movabs $0x804d80,%rdi
+  802c23:	00 00 00 
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2b:	48 b9 fe 0e 80 00 00 	movabs $0x800efe,%rcx
+  802c32:	00 00 00 
+  802c35:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c3c:	eb c1                	jmp    802bff <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802c3e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802c43:	eb ba                	jmp    802bff <ftruncate+0x5e>
+
+0000000000802c45 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802c45:	55                   	push   %rbp
+  802c46:	48 89 e5             	mov    %rsp,%rbp
+  802c49:	41 54                	push   %r12
+  802c4b:	53                   	push   %rbx
+  802c4c:	48 83 ec 10          	sub    $0x10,%rsp
+  802c50:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c57:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  802c5e:	00 00 00 
+  802c61:	ff d0                	call   *%rax
+  802c63:	85 c0                	test   %eax,%eax
+  802c65:	78 4e                	js     802cb5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c67:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802c6b:	41 8b 3c 24          	mov    (%r12),%edi
+  802c6f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802c73:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	78 32                	js     802cb5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802c83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c87:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802c8c:	74 30                	je     802cbe <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802c8e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802c91:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802c98:	00 00 00 
+    stat->st_isdir = 0;
+  802c9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ca2:	00 00 00 
+    stat->st_dev = dev;
+  802ca5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802cac:	48 89 de             	mov    %rbx,%rsi
+  802caf:	4c 89 e7             	mov    %r12,%rdi
+  802cb2:	ff 50 30             	call   *0x30(%rax)
+}
+  802cb5:	48 83 c4 10          	add    $0x10,%rsp
+  802cb9:	5b                   	pop    %rbx
+  802cba:	41 5c                	pop    %r12
+  802cbc:	5d                   	pop    %rbp
+  802cbd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802cbe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802cc3:	eb f0                	jmp    802cb5 <fstat+0x70>
+
+0000000000802cc5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802cc5:	55                   	push   %rbp
+  802cc6:	48 89 e5             	mov    %rsp,%rbp
+  802cc9:	41 54                	push   %r12
+  802ccb:	53                   	push   %rbx
+  802ccc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd4:	48 b8 1c 3a 80 00 00 	movabs $0x803a1c,%rax
+  802cdb:	00 00 00 
+  802cde:	ff d0                	call   *%rax
+  802ce0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802ce2:	85 c0                	test   %eax,%eax
+  802ce4:	78 25                	js     802d0b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802ce6:	4c 89 e6             	mov    %r12,%rsi
+  802ce9:	89 c7                	mov    %eax,%edi
+  802ceb:	48 b8 45 2c 80 00 00 	movabs $0x802c45,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+  802cf7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802cfa:	89 df                	mov    %ebx,%edi
+  802cfc:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  802d03:	00 00 00 
+  802d06:	ff d0                	call   *%rax
+
+    return res;
+  802d08:	44 89 e3             	mov    %r12d,%ebx
+}
+  802d0b:	89 d8                	mov    %ebx,%eax
+  802d0d:	5b                   	pop    %rbx
+  802d0e:	41 5c                	pop    %r12
+  802d10:	5d                   	pop    %rbp
+  802d11:	c3                   	ret
+
+0000000000802d12 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802d12:	55                   	push   %rbp
+  802d13:	48 89 e5             	mov    %rsp,%rbp
+  802d16:	41 54                	push   %r12
+  802d18:	53                   	push   %rbx
+  802d19:	48 83 ec 10          	sub    $0x10,%rsp
+  802d1d:	48 89 fb             	mov    %rdi,%rbx
+  802d20:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802d23:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d27:	bf 66 00 00 00       	mov    $0x66,%edi
+  802d2c:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	78 1f                	js     802d5b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d40:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802d44:	48 85 c0             	test   %rax,%rax
+  802d47:	74 1b                	je     802d64 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802d49:	4c 89 e6             	mov    %r12,%rsi
+  802d4c:	48 89 df             	mov    %rbx,%rdi
+  802d4f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d51:	85 c0                	test   %eax,%eax
+  802d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d58:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802d5b:	48 83 c4 10          	add    $0x10,%rsp
+  802d5f:	5b                   	pop    %rbx
+  802d60:	41 5c                	pop    %r12
+  802d62:	5d                   	pop    %rbp
+  802d63:	c3                   	ret
+        return -E_NOT_SUPP;
+  802d64:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d69:	eb f0                	jmp    802d5b <create_snapshot+0x49>
+
+0000000000802d6b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802d73:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d77:	bf 66 00 00 00       	mov    $0x66,%edi
+  802d7c:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+  802d88:	85 c0                	test   %eax,%eax
+  802d8a:	78 1e                	js     802daa <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d90:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802d94:	48 85 d2             	test   %rdx,%rdx
+  802d97:	74 13                	je     802dac <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802da0:	85 c0                	test   %eax,%eax
+  802da2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802daa:	c9                   	leave
+  802dab:	c3                   	ret
+        return -E_NOT_SUPP;
+  802dac:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802db1:	eb f7                	jmp    802daa <print_snapshot_list+0x3f>
+
+0000000000802db3 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802db3:	55                   	push   %rbp
+  802db4:	48 89 e5             	mov    %rsp,%rbp
+  802db7:	53                   	push   %rbx
+  802db8:	48 83 ec 18          	sub    $0x18,%rsp
+  802dbc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802dbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802dc3:	bf 66 00 00 00       	mov    $0x66,%edi
+  802dc8:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	78 1c                	js     802df4 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ddc:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802de0:	48 85 c0             	test   %rax,%rax
+  802de3:	74 15                	je     802dfa <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802de5:	48 89 df             	mov    %rbx,%rdi
+  802de8:	ff d0                	call   *%rax
+    if (res < 0) {
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802df4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802df8:	c9                   	leave
+  802df9:	c3                   	ret
+        return -E_NOT_SUPP;
+  802dfa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802dff:	eb f3                	jmp    802df4 <accept_snapshot+0x41>
+
+0000000000802e01 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	53                   	push   %rbx
+  802e06:	48 83 ec 18          	sub    $0x18,%rsp
+  802e0a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e11:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e16:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	78 1c                	js     802e42 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e2a:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802e2e:	48 85 c0             	test   %rax,%rax
+  802e31:	74 15                	je     802e48 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802e33:	48 89 df             	mov    %rbx,%rdi
+  802e36:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e38:	85 c0                	test   %eax,%eax
+  802e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802e42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e46:	c9                   	leave
+  802e47:	c3                   	ret
+        return -E_NOT_SUPP;
+  802e48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e4d:	eb f3                	jmp    802e42 <delete_snapshot+0x41>
+
+0000000000802e4f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802e4f:	55                   	push   %rbp
+  802e50:	48 89 e5             	mov    %rsp,%rbp
+  802e53:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e5b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e60:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	78 14                	js     802e84 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802e70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e74:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802e78:	48 85 d2             	test   %rdx,%rdx
+  802e7b:	74 09                	je     802e86 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e82:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+        return -E_NOT_SUPP;
+  802e86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e8b:	eb f7                	jmp    802e84 <gc_snapshots+0x35>
+
+0000000000802e8d <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802e8d:	55                   	push   %rbp
+  802e8e:	48 89 e5             	mov    %rsp,%rbp
+  802e91:	41 56                	push   %r14
+  802e93:	41 55                	push   %r13
+  802e95:	41 54                	push   %r12
+  802e97:	53                   	push   %rbx
+  802e98:	48 83 ec 10          	sub    $0x10,%rsp
+  802e9c:	48 89 fb             	mov    %rdi,%rbx
+  802e9f:	49 89 f4             	mov    %rsi,%r12
+  802ea2:	49 89 d5             	mov    %rdx,%r13
+  802ea5:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802ea8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802eac:	bf 66 00 00 00       	mov    $0x66,%edi
+  802eb1:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802eb8:	00 00 00 
+  802ebb:	ff d0                	call   *%rax
+  802ebd:	85 c0                	test   %eax,%eax
+  802ebf:	78 1b                	js     802edc <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ec5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802ec9:	48 85 c0             	test   %rax,%rax
+  802ecc:	74 1b                	je     802ee9 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802ece:	4c 89 f1             	mov    %r14,%rcx
+  802ed1:	4c 89 ea             	mov    %r13,%rdx
+  802ed4:	4c 89 e6             	mov    %r12,%rsi
+  802ed7:	48 89 df             	mov    %rbx,%rdi
+  802eda:	ff d0                	call   *%rax
+
+    return res;
+}
+  802edc:	48 83 c4 10          	add    $0x10,%rsp
+  802ee0:	5b                   	pop    %rbx
+  802ee1:	41 5c                	pop    %r12
+  802ee3:	41 5d                	pop    %r13
+  802ee5:	41 5e                	pop    %r14
+  802ee7:	5d                   	pop    %rbp
+  802ee8:	c3                   	ret
+        return -E_NOT_SUPP;
+  802ee9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802eee:	eb ec                	jmp    802edc <diff_snapshots+0x4f>
+
+0000000000802ef0 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802ef0:	55                   	push   %rbp
+  802ef1:	48 89 e5             	mov    %rsp,%rbp
+  802ef4:	41 55                	push   %r13
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 83 ec 18          	sub    $0x18,%rsp
+  802efd:	48 89 fb             	mov    %rdi,%rbx
+  802f00:	49 89 f4             	mov    %rsi,%r12
+  802f03:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802f06:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f0a:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f0f:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802f16:	00 00 00 
+  802f19:	ff d0                	call   *%rax
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	78 18                	js     802f37 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802f1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f23:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802f27:	48 85 c0             	test   %rax,%rax
+  802f2a:	74 16                	je     802f42 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802f2c:	4c 89 ea             	mov    %r13,%rdx
+  802f2f:	4c 89 e6             	mov    %r12,%rsi
+  802f32:	48 89 df             	mov    %rbx,%rdi
+  802f35:	ff d0                	call   *%rax
+
+    return res;
+}
+  802f37:	48 83 c4 18          	add    $0x18,%rsp
+  802f3b:	5b                   	pop    %rbx
+  802f3c:	41 5c                	pop    %r12
+  802f3e:	41 5d                	pop    %r13
+  802f40:	5d                   	pop    %rbp
+  802f41:	c3                   	ret
+        return -E_NOT_SUPP;
+  802f42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f47:	eb ee                	jmp    802f37 <send_snapshot+0x47>
+
+0000000000802f49 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+  802f4d:	53                   	push   %rbx
+  802f4e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f52:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802f55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802f59:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f5e:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+  802f6a:	85 c0                	test   %eax,%eax
+  802f6c:	78 12                	js     802f80 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f72:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802f76:	48 85 c0             	test   %rax,%rax
+  802f79:	74 0b                	je     802f86 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802f7b:	48 89 df             	mov    %rbx,%rdi
+  802f7e:	ff d0                	call   *%rax
+
+    return res;
+}
+  802f80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f84:	c9                   	leave
+  802f85:	c3                   	ret
+        return -E_NOT_SUPP;
+  802f86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f8b:	eb f3                	jmp    802f80 <receive_snapshot+0x37>
+
+0000000000802f8d <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802f8d:	55                   	push   %rbp
+  802f8e:	48 89 e5             	mov    %rsp,%rbp
+  802f91:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802f95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f99:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f9e:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 17                	js     802fc5 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802fae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fb2:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802fb9:	48 85 d2             	test   %rdx,%rdx
+  802fbc:	74 09                	je     802fc7 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc3:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802fc5:	c9                   	leave
+  802fc6:	c3                   	ret
+        return -E_NOT_SUPP;
+  802fc7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802fcc:	eb f7                	jmp    802fc5 <free_space_bytes+0x38>
+
+0000000000802fce <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802fce:	55                   	push   %rbp
+  802fcf:	48 89 e5             	mov    %rsp,%rbp
+  802fd2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802fd6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fda:	bf 66 00 00 00       	mov    $0x66,%edi
+  802fdf:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	78 17                	js     803006 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802fef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ff3:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802ffa:	48 85 d2             	test   %rdx,%rdx
+  802ffd:	74 09                	je     803008 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803004:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  803006:	c9                   	leave
+  803007:	c3                   	ret
+        return -E_NOT_SUPP;
+  803008:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80300d:	eb f7                	jmp    803006 <busy_space_bytes+0x38>
+
+000000000080300f <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80300f:	55                   	push   %rbp
+  803010:	48 89 e5             	mov    %rsp,%rbp
+  803013:	41 54                	push   %r12
+  803015:	53                   	push   %rbx
+  803016:	48 83 ec 10          	sub    $0x10,%rsp
+  80301a:	89 fb                	mov    %edi,%ebx
+  80301c:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80301f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803023:	bf 66 00 00 00       	mov    $0x66,%edi
+  803028:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  80302f:	00 00 00 
+  803032:	ff d0                	call   *%rax
+  803034:	85 c0                	test   %eax,%eax
+  803036:	78 17                	js     80304f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  803038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  803043:	48 85 c0             	test   %rax,%rax
+  803046:	74 10                	je     803058 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  803048:	4c 89 e6             	mov    %r12,%rsi
+  80304b:	89 df                	mov    %ebx,%edi
+  80304d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80304f:	48 83 c4 10          	add    $0x10,%rsp
+  803053:	5b                   	pop    %rbx
+  803054:	41 5c                	pop    %r12
+  803056:	5d                   	pop    %rbp
+  803057:	c3                   	ret
+        return -E_NOT_SUPP;
+  803058:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80305d:	eb f0                	jmp    80304f <snapshots_space+0x40>
+
+000000000080305f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80305f:	55                   	push   %rbp
+  803060:	48 89 e5             	mov    %rsp,%rbp
+  803063:	41 55                	push   %r13
+  803065:	41 54                	push   %r12
+  803067:	53                   	push   %rbx
+  803068:	48 83 ec 08          	sub    $0x8,%rsp
+  80306c:	41 89 fd             	mov    %edi,%r13d
+  80306f:	48 89 f3             	mov    %rsi,%rbx
+  803072:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803075:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80307c:	00 00 00 
+  80307f:	83 38 00             	cmpl   $0x0,(%rax)
+  803082:	74 57                	je     8030db <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  803084:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80308a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80308f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803096:	00 00 00 
+  803099:	44 89 ee             	mov    %r13d,%esi
+  80309c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8030a3:	00 00 00 
+  8030a6:	8b 38                	mov    (%rax),%edi
+  8030a8:	48 b8 dc 44 80 00 00 	movabs $0x8044dc,%rax
+  8030af:	00 00 00 
+  8030b2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8030b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030b9:	4c 89 e2             	mov    %r12,%rdx
+  8030bc:	48 89 de             	mov    %rbx,%rsi
+  8030bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c4:	48 b8 c4 44 80 00 00 	movabs $0x8044c4,%rax
+  8030cb:	00 00 00 
+  8030ce:	ff d0                	call   *%rax
+}
+  8030d0:	48 83 c4 08          	add    $0x8,%rsp
+  8030d4:	5b                   	pop    %rbx
+  8030d5:	41 5c                	pop    %r12
+  8030d7:	41 5d                	pop    %r13
+  8030d9:	5d                   	pop    %rbp
+  8030da:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030e0:	48 b8 9a 45 80 00 00 	movabs $0x80459a,%rax
+  8030e7:	00 00 00 
+  8030ea:	ff d0                	call   *%rax
+  8030ec:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8030f3:	00 00 
+  8030f5:	eb 8d                	jmp    803084 <fsipc_region+0x25>
+
+00000000008030f7 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8030ff:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  803106:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  803107:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80310b:	48 b8 5f 30 80 00 00 	movabs $0x80305f,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+}
+  803117:	c9                   	leave
+  803118:	c3                   	ret
+
+0000000000803119 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  803119:	85 ff                	test   %edi,%edi
+  80311b:	78 6d                	js     80318a <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80311d:	55                   	push   %rbp
+  80311e:	48 89 e5             	mov    %rsp,%rbp
+  803121:	41 54                	push   %r12
+  803123:	53                   	push   %rbx
+  803124:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  803127:	48 85 f6             	test   %rsi,%rsi
+  80312a:	74 57                	je     803183 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80312c:	89 f8                	mov    %edi,%eax
+  80312e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  803135:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  803137:	be 00 00 00 00       	mov    $0x0,%esi
+  80313c:	bf 12 00 00 00       	mov    $0x12,%edi
+  803141:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	78 2d                	js     80317e <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  803151:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  803158:	00 00 00 
+  80315b:	49 63 14 24          	movslq (%r12),%rdx
+  80315f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  803166:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80316b:	48 89 df             	mov    %rbx,%rdi
+  80316e:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80317a:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80317e:	5b                   	pop    %rbx
+  80317f:	41 5c                	pop    %r12
+  803181:	5d                   	pop    %rbp
+  803182:	c3                   	ret
+        return -E_INVAL;
+  803183:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803188:	eb f4                	jmp    80317e <devfile_df_snapshots+0x65>
+  80318a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80318f:	c3                   	ret
+
+0000000000803190 <devfile_df_busy>:
+devfile_df_busy() {
+  803190:	55                   	push   %rbp
+  803191:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  803194:	be 00 00 00 00       	mov    $0x0,%esi
+  803199:	bf 11 00 00 00       	mov    $0x11,%edi
+  80319e:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8031a5:	00 00 00 
+  8031a8:	ff d0                	call   *%rax
+}
+  8031aa:	5d                   	pop    %rbp
+  8031ab:	c3                   	ret
+
+00000000008031ac <devfile_df_free>:
+devfile_df_free() {
+  8031ac:	55                   	push   %rbp
+  8031ad:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8031b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8031ba:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+}
+  8031c6:	5d                   	pop    %rbp
+  8031c7:	c3                   	ret
+
+00000000008031c8 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8031c8:	55                   	push   %rbp
+  8031c9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8031cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8031d6:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8031dd:	00 00 00 
+  8031e0:	ff d0                	call   *%rax
+}
+  8031e2:	5d                   	pop    %rbp
+  8031e3:	c3                   	ret
+
+00000000008031e4 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8031e4:	55                   	push   %rbp
+  8031e5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8031e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ed:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031f2:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031fe:	85 c0                	test   %eax,%eax
+  803200:	ba 00 00 00 00       	mov    $0x0,%edx
+  803205:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803208:	5d                   	pop    %rbp
+  803209:	c3                   	ret
+
+000000000080320a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80320a:	55                   	push   %rbp
+  80320b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80320e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803215:	00 00 00 
+  803218:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80321b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80321d:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  803220:	be 00 00 00 00       	mov    $0x0,%esi
+  803225:	bf 02 00 00 00       	mov    $0x2,%edi
+  80322a:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803231:	00 00 00 
+  803234:	ff d0                	call   *%rax
+}
+  803236:	5d                   	pop    %rbp
+  803237:	c3                   	ret
+
+0000000000803238 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803238:	55                   	push   %rbp
+  803239:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80323c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80323f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  803246:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803248:	be 00 00 00 00       	mov    $0x0,%esi
+  80324d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803252:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803259:	00 00 00 
+  80325c:	ff d0                	call   *%rax
+}
+  80325e:	5d                   	pop    %rbp
+  80325f:	c3                   	ret
+
+0000000000803260 <devfile_write>:
+    if (!fd || !buf) {
+  803260:	48 85 ff             	test   %rdi,%rdi
+  803263:	0f 84 c1 00 00 00    	je     80332a <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	41 57                	push   %r15
+  80326f:	41 56                	push   %r14
+  803271:	41 55                	push   %r13
+  803273:	41 54                	push   %r12
+  803275:	53                   	push   %rbx
+  803276:	48 83 ec 18          	sub    $0x18,%rsp
+  80327a:	49 89 ff             	mov    %rdi,%r15
+  80327d:	49 89 f5             	mov    %rsi,%r13
+  803280:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  803283:	48 85 f6             	test   %rsi,%rsi
+  803286:	0f 84 95 00 00 00    	je     803321 <devfile_write+0xc1>
+    while (n) {
+  80328c:	48 85 d2             	test   %rdx,%rdx
+  80328f:	0f 84 83 00 00 00    	je     803318 <devfile_write+0xb8>
+    int totalWrite = 0;
+  803295:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80329c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8032a3:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8032a6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8032ab:	49 39 dc             	cmp    %rbx,%r12
+  8032ae:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8032b2:	48 89 da             	mov    %rbx,%rdx
+  8032b5:	4c 89 ee             	mov    %r13,%rsi
+  8032b8:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8032bf:	00 00 00 
+  8032c2:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8032ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032d2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8032d5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8032d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8032de:	bf 04 00 00 00       	mov    $0x4,%edi
+  8032e3:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8032ea:	00 00 00 
+  8032ed:	ff d0                	call   *%rax
+        if (write < 0) {
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	78 21                	js     803314 <devfile_write+0xb4>
+        buf += write;
+  8032f3:	48 63 d0             	movslq %eax,%rdx
+  8032f6:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8032f9:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8032fc:	49 29 d4             	sub    %rdx,%r12
+  8032ff:	75 a5                	jne    8032a6 <devfile_write+0x46>
+    return totalWrite;
+  803301:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  803305:	48 83 c4 18          	add    $0x18,%rsp
+  803309:	5b                   	pop    %rbx
+  80330a:	41 5c                	pop    %r12
+  80330c:	41 5d                	pop    %r13
+  80330e:	41 5e                	pop    %r14
+  803310:	41 5f                	pop    %r15
+  803312:	5d                   	pop    %rbp
+  803313:	c3                   	ret
+            return write;
+  803314:	48 98                	cltq
+  803316:	eb ed                	jmp    803305 <devfile_write+0xa5>
+    int totalWrite = 0;
+  803318:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80331f:	eb e0                	jmp    803301 <devfile_write+0xa1>
+        return -E_INVAL;
+  803321:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803328:	eb db                	jmp    803305 <devfile_write+0xa5>
+  80332a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803331:	c3                   	ret
+
+0000000000803332 <devfile_read>:
+    if (!fd || !buf) {
+  803332:	48 85 ff             	test   %rdi,%rdi
+  803335:	0f 84 c0 00 00 00    	je     8033fb <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80333b:	55                   	push   %rbp
+  80333c:	48 89 e5             	mov    %rsp,%rbp
+  80333f:	41 57                	push   %r15
+  803341:	41 56                	push   %r14
+  803343:	41 55                	push   %r13
+  803345:	41 54                	push   %r12
+  803347:	53                   	push   %rbx
+  803348:	48 83 ec 18          	sub    $0x18,%rsp
+  80334c:	49 89 ff             	mov    %rdi,%r15
+  80334f:	49 89 f5             	mov    %rsi,%r13
+  803352:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  803355:	48 85 f6             	test   %rsi,%rsi
+  803358:	0f 84 96 00 00 00    	je     8033f4 <devfile_read+0xc2>
+    while (n) {
+  80335e:	48 85 d2             	test   %rdx,%rdx
+  803361:	0f 84 87 00 00 00    	je     8033ee <devfile_read+0xbc>
+    size_t totalRead = 0;
+  803367:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80336e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80336f:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  803376:	00 00 00 
+  803379:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80337d:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  803380:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803385:	49 39 c4             	cmp    %rax,%r12
+  803388:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80338c:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  803390:	be 00 00 00 00       	mov    $0x0,%esi
+  803395:	bf 03 00 00 00       	mov    $0x3,%edi
+  80339a:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	7e 37                	jle    8033e1 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8033aa:	48 63 d8             	movslq %eax,%rbx
+  8033ad:	48 89 da             	mov    %rbx,%rdx
+  8033b0:	4c 89 f6             	mov    %r14,%rsi
+  8033b3:	4c 89 ef             	mov    %r13,%rdi
+  8033b6:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  8033bd:	00 00 00 
+  8033c0:	ff d0                	call   *%rax
+        buf += read;
+  8033c2:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8033c5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8033c9:	49 29 dc             	sub    %rbx,%r12
+  8033cc:	75 ab                	jne    803379 <devfile_read+0x47>
+  return totalRead;
+  8033ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8033d2:	48 83 c4 18          	add    $0x18,%rsp
+  8033d6:	5b                   	pop    %rbx
+  8033d7:	41 5c                	pop    %r12
+  8033d9:	41 5d                	pop    %r13
+  8033db:	41 5e                	pop    %r14
+  8033dd:	41 5f                	pop    %r15
+  8033df:	5d                   	pop    %rbp
+  8033e0:	c3                   	ret
+            return read ? read : totalRead;
+  8033e1:	48 63 d0             	movslq %eax,%rdx
+  8033e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033e8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8033ec:	eb e4                	jmp    8033d2 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8033ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8033f2:	eb da                	jmp    8033ce <devfile_read+0x9c>
+        return E_INVAL;
+  8033f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8033f9:	eb d7                	jmp    8033d2 <devfile_read+0xa0>
+  8033fb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803400:	c3                   	ret
+
+0000000000803401 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  803401:	48 85 ff             	test   %rdi,%rdi
+  803404:	74 5f                	je     803465 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  803406:	55                   	push   %rbp
+  803407:	48 89 e5             	mov    %rsp,%rbp
+  80340a:	53                   	push   %rbx
+  80340b:	48 83 ec 08          	sub    $0x8,%rsp
+  80340f:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  803412:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  803419:	00 00 00 
+  80341c:	ff d0                	call   *%rax
+  80341e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803424:	77 45                	ja     80346b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  803426:	48 89 de             	mov    %rbx,%rsi
+  803429:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  803430:	00 00 00 
+  803433:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  80343a:	00 00 00 
+  80343d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80343f:	be 00 00 00 00       	mov    $0x0,%esi
+  803444:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803449:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803455:	85 c0                	test   %eax,%eax
+  803457:	ba 00 00 00 00       	mov    $0x0,%edx
+  80345c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80345f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803463:	c9                   	leave
+  803464:	c3                   	ret
+        return -E_INVAL;
+  803465:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80346a:	c3                   	ret
+        return -E_INVAL;
+  80346b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803470:	eb ed                	jmp    80345f <devfile_receive_snapshot+0x5e>
+
+0000000000803472 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  803472:	55                   	push   %rbp
+  803473:	48 89 e5             	mov    %rsp,%rbp
+  803476:	41 55                	push   %r13
+  803478:	41 54                	push   %r12
+  80347a:	53                   	push   %rbx
+  80347b:	48 83 ec 08          	sub    $0x8,%rsp
+  80347f:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  803482:	48 85 f6             	test   %rsi,%rsi
+  803485:	0f 94 c0             	sete   %al
+  803488:	48 85 d2             	test   %rdx,%rdx
+  80348b:	0f 94 c2             	sete   %dl
+  80348e:	08 d0                	or     %dl,%al
+  803490:	0f 85 ad 00 00 00    	jne    803543 <devfile_send_snapshot+0xd1>
+  803496:	48 89 fb             	mov    %rdi,%rbx
+  803499:	49 89 f4             	mov    %rsi,%r12
+  80349c:	48 85 ff             	test   %rdi,%rdi
+  80349f:	0f 84 9e 00 00 00    	je     803543 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8034a5:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+  8034b1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8034b7:	0f 87 8d 00 00 00    	ja     80354a <devfile_send_snapshot+0xd8>
+  8034bd:	4c 89 e7             	mov    %r12,%rdi
+  8034c0:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+  8034cc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8034d2:	77 7d                	ja     803551 <devfile_send_snapshot+0xdf>
+  8034d4:	4c 89 ef             	mov    %r13,%rdi
+  8034d7:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034e9:	77 6d                	ja     803558 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8034eb:	48 89 de             	mov    %rbx,%rsi
+  8034ee:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8034f5:	00 00 00 
+  8034f8:	48 bb 23 18 80 00 00 	movabs $0x801823,%rbx
+  8034ff:	00 00 00 
+  803502:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  803504:	4c 89 e6             	mov    %r12,%rsi
+  803507:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  80350e:	00 00 00 
+  803511:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  803513:	4c 89 ee             	mov    %r13,%rsi
+  803516:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80351d:	00 00 00 
+  803520:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  803522:	be 00 00 00 00       	mov    $0x0,%esi
+  803527:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80352c:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+}
+  803538:	48 83 c4 08          	add    $0x8,%rsp
+  80353c:	5b                   	pop    %rbx
+  80353d:	41 5c                	pop    %r12
+  80353f:	41 5d                	pop    %r13
+  803541:	5d                   	pop    %rbp
+  803542:	c3                   	ret
+        return -E_INVAL;
+  803543:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803548:	eb ee                	jmp    803538 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80354a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80354f:	eb e7                	jmp    803538 <devfile_send_snapshot+0xc6>
+  803551:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803556:	eb e0                	jmp    803538 <devfile_send_snapshot+0xc6>
+  803558:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355d:	eb d9                	jmp    803538 <devfile_send_snapshot+0xc6>
+
+000000000080355f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80355f:	48 85 ff             	test   %rdi,%rdi
+  803562:	0f 84 41 01 00 00    	je     8036a9 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 57                	push   %r15
+  80356e:	41 56                	push   %r14
+  803570:	41 55                	push   %r13
+  803572:	41 54                	push   %r12
+  803574:	53                   	push   %rbx
+  803575:	48 83 ec 08          	sub    $0x8,%rsp
+  803579:	49 89 fc             	mov    %rdi,%r12
+  80357c:	49 89 f5             	mov    %rsi,%r13
+  80357f:	48 89 d3             	mov    %rdx,%rbx
+  803582:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  803585:	48 85 f6             	test   %rsi,%rsi
+  803588:	0f 84 ff 00 00 00    	je     80368d <devfile_diff_snapshots+0x12e>
+  80358e:	48 85 d2             	test   %rdx,%rdx
+  803591:	0f 84 fd 00 00 00    	je     803694 <devfile_diff_snapshots+0x135>
+  803597:	48 85 c9             	test   %rcx,%rcx
+  80359a:	0f 84 f4 00 00 00    	je     803694 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8035a0:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8035a7:	00 00 00 
+  8035aa:	ff d0                	call   *%rax
+  8035ac:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8035b2:	0f 87 e3 00 00 00    	ja     80369b <devfile_diff_snapshots+0x13c>
+  8035b8:	4c 89 ef             	mov    %r13,%rdi
+  8035bb:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+  8035c7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8035cd:	0f 87 cf 00 00 00    	ja     8036a2 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8035d3:	4c 89 e6             	mov    %r12,%rsi
+  8035d6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8035dd:	00 00 00 
+  8035e0:	4c 89 e7             	mov    %r12,%rdi
+  8035e3:	49 bf 23 18 80 00 00 	movabs $0x801823,%r15
+  8035ea:	00 00 00 
+  8035ed:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8035f0:	4c 89 ee             	mov    %r13,%rsi
+  8035f3:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8035fa:	00 
+  8035fb:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8035fe:	48 8b 03             	mov    (%rbx),%rax
+  803601:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  803608:	00 
+  803609:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80360d:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  803614:	00 
+  803615:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  803619:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  803620:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  803621:	be 00 00 00 00       	mov    $0x0,%esi
+  803626:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80362b:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803637:	85 c0                	test   %eax,%eax
+  803639:	78 43                	js     80367e <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80363b:	49 8b 04 24          	mov    (%r12),%rax
+  80363f:	48 89 03             	mov    %rax,(%rbx)
+  803642:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  803647:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80364b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  803650:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  803654:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  803659:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80365d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803661:	48 c1 e2 03          	shl    $0x3,%rdx
+  803665:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80366a:	4c 89 f7             	mov    %r14,%rdi
+  80366d:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  803674:	00 00 00 
+  803677:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  803679:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80367e:	48 83 c4 08          	add    $0x8,%rsp
+  803682:	5b                   	pop    %rbx
+  803683:	41 5c                	pop    %r12
+  803685:	41 5d                	pop    %r13
+  803687:	41 5e                	pop    %r14
+  803689:	41 5f                	pop    %r15
+  80368b:	5d                   	pop    %rbp
+  80368c:	c3                   	ret
+        return -E_INVAL;
+  80368d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803692:	eb ea                	jmp    80367e <devfile_diff_snapshots+0x11f>
+  803694:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803699:	eb e3                	jmp    80367e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80369b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036a0:	eb dc                	jmp    80367e <devfile_diff_snapshots+0x11f>
+  8036a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036a7:	eb d5                	jmp    80367e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8036a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8036ae:	c3                   	ret
+
+00000000008036af <devfile_delete_snapshot>:
+    if (!name) {
+  8036af:	48 85 ff             	test   %rdi,%rdi
+  8036b2:	74 5f                	je     803713 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8036b4:	55                   	push   %rbp
+  8036b5:	48 89 e5             	mov    %rsp,%rbp
+  8036b8:	53                   	push   %rbx
+  8036b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8036bd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8036c0:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8036d2:	77 45                	ja     803719 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8036d4:	48 89 de             	mov    %rbx,%rsi
+  8036d7:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8036de:	00 00 00 
+  8036e1:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  8036e8:	00 00 00 
+  8036eb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8036ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8036f2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8036f7:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  8036fe:	00 00 00 
+  803701:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803703:	85 c0                	test   %eax,%eax
+  803705:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80370d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803711:	c9                   	leave
+  803712:	c3                   	ret
+        return -E_INVAL;
+  803713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803718:	c3                   	ret
+        return -E_INVAL;
+  803719:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371e:	eb ed                	jmp    80370d <devfile_delete_snapshot+0x5e>
+
+0000000000803720 <devfile_accept_snapshot>:
+    if (!name) {
+  803720:	48 85 ff             	test   %rdi,%rdi
+  803723:	74 5f                	je     803784 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  803725:	55                   	push   %rbp
+  803726:	48 89 e5             	mov    %rsp,%rbp
+  803729:	53                   	push   %rbx
+  80372a:	48 83 ec 08          	sub    $0x8,%rsp
+  80372e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  803731:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  803738:	00 00 00 
+  80373b:	ff d0                	call   *%rax
+  80373d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803743:	77 45                	ja     80378a <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  803745:	48 89 de             	mov    %rbx,%rsi
+  803748:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80374f:	00 00 00 
+  803752:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80375e:	be 00 00 00 00       	mov    $0x0,%esi
+  803763:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803768:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  80376f:	00 00 00 
+  803772:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803774:	85 c0                	test   %eax,%eax
+  803776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80377b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80377e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803782:	c9                   	leave
+  803783:	c3                   	ret
+        return -E_INVAL;
+  803784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803789:	c3                   	ret
+        return -E_INVAL;
+  80378a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80378f:	eb ed                	jmp    80377e <devfile_accept_snapshot+0x5e>
+
+0000000000803791 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  803791:	48 85 ff             	test   %rdi,%rdi
+  803794:	0f 84 9f 00 00 00    	je     803839 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80379a:	55                   	push   %rbp
+  80379b:	48 89 e5             	mov    %rsp,%rbp
+  80379e:	41 54                	push   %r12
+  8037a0:	53                   	push   %rbx
+  8037a1:	48 89 fb             	mov    %rdi,%rbx
+  8037a4:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8037a7:	48 85 f6             	test   %rsi,%rsi
+  8037aa:	74 78                	je     803824 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8037ac:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8037b3:	00 00 00 
+  8037b6:	ff d0                	call   *%rax
+  8037b8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8037be:	77 6b                	ja     80382b <devfile_create_snapshot+0x9a>
+  8037c0:	4c 89 e7             	mov    %r12,%rdi
+  8037c3:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8037ca:	00 00 00 
+  8037cd:	ff d0                	call   *%rax
+  8037cf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8037d5:	77 5b                	ja     803832 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8037d7:	48 89 de             	mov    %rbx,%rsi
+  8037da:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8037e1:	00 00 00 
+  8037e4:	48 bb 23 18 80 00 00 	movabs $0x801823,%rbx
+  8037eb:	00 00 00 
+  8037ee:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8037f0:	4c 89 e6             	mov    %r12,%rsi
+  8037f3:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8037fa:	00 00 00 
+  8037fd:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8037ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803804:	bf 08 00 00 00       	mov    $0x8,%edi
+  803809:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803810:	00 00 00 
+  803813:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803815:	85 c0                	test   %eax,%eax
+  803817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80381c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80381f:	5b                   	pop    %rbx
+  803820:	41 5c                	pop    %r12
+  803822:	5d                   	pop    %rbp
+  803823:	c3                   	ret
+        return -E_INVAL;
+  803824:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803829:	eb f4                	jmp    80381f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80382b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803830:	eb ed                	jmp    80381f <devfile_create_snapshot+0x8e>
+  803832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803837:	eb e6                	jmp    80381f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  803839:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80383e:	c3                   	ret
+
+000000000080383f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80383f:	55                   	push   %rbp
+  803840:	48 89 e5             	mov    %rsp,%rbp
+  803843:	41 54                	push   %r12
+  803845:	53                   	push   %rbx
+  803846:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803849:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80384c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  803853:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  803855:	be 00 00 00 00       	mov    $0x0,%esi
+  80385a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80385f:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803866:	00 00 00 
+  803869:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80386b:	85 c0                	test   %eax,%eax
+  80386d:	78 3d                	js     8038ac <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80386f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  803876:	00 00 00 
+  803879:	4c 89 e6             	mov    %r12,%rsi
+  80387c:	48 89 df             	mov    %rbx,%rdi
+  80387f:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803886:	00 00 00 
+  803889:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80388b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803892:	00 
+  803893:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803899:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8038a0:	00 
+  8038a1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8038a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ac:	5b                   	pop    %rbx
+  8038ad:	41 5c                	pop    %r12
+  8038af:	5d                   	pop    %rbp
+  8038b0:	c3                   	ret
+
+00000000008038b1 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8038b1:	55                   	push   %rbp
+  8038b2:	48 89 e5             	mov    %rsp,%rbp
+  8038b5:	41 57                	push   %r15
+  8038b7:	41 56                	push   %r14
+  8038b9:	41 55                	push   %r13
+  8038bb:	41 54                	push   %r12
+  8038bd:	53                   	push   %rbx
+  8038be:	48 83 ec 38          	sub    $0x38,%rsp
+  8038c2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8038c6:	49 89 f5             	mov    %rsi,%r13
+  8038c9:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8038cc:	48 89 f0             	mov    %rsi,%rax
+  8038cf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8038d4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8038d8:	75 4f                	jne    803929 <devfile_readmap+0x78>
+  8038da:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038de:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8038e4:	75 1f                	jne    803905 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8038e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8038ea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8038ee:	49 be 99 40 80 00 00 	movabs $0x804099,%r14
+  8038f5:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8038f8:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8038ff:	0f 87 9d 00 00 00    	ja     8039a2 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  803905:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803909:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80390d:	4d 85 ff             	test   %r15,%r15
+  803910:	0f 85 cf 00 00 00    	jne    8039e5 <devfile_readmap+0x134>
+  803916:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80391a:	48 83 c4 38          	add    $0x38,%rsp
+  80391e:	5b                   	pop    %rbx
+  80391f:	41 5c                	pop    %r12
+  803921:	41 5d                	pop    %r13
+  803923:	41 5e                	pop    %r14
+  803925:	41 5f                	pop    %r15
+  803927:	5d                   	pop    %rbp
+  803928:	c3                   	ret
+    size_t totalRead = 0;
+  803929:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  803930:	00 
+  803931:	eb da                	jmp    80390d <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803933:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803937:	8b 40 0c             	mov    0xc(%rax),%eax
+  80393a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803941:	00 00 00 
+  803944:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  803946:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80394a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  80394e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803952:	4c 89 ee             	mov    %r13,%rsi
+  803955:	bf 14 00 00 00       	mov    $0x14,%edi
+  80395a:	48 b8 5f 30 80 00 00 	movabs $0x80305f,%rax
+  803961:	00 00 00 
+  803964:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  803966:	85 c0                	test   %eax,%eax
+  803968:	7e a3                	jle    80390d <devfile_readmap+0x5c>
+  80396a:	48 98                	cltq
+  80396c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803970:	72 9b                	jb     80390d <devfile_readmap+0x5c>
+        buf += read;
+  803972:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  803975:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  803978:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80397c:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  803983:	75 88                	jne    80390d <devfile_readmap+0x5c>
+  803985:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803989:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80398f:	0f 85 78 ff ff ff    	jne    80390d <devfile_readmap+0x5c>
+  803995:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  80399c:	0f 86 6b ff ff ff    	jbe    80390d <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8039a2:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8039a8:	4d 39 e7             	cmp    %r12,%r15
+  8039ab:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8039af:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8039b6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8039ba:	0f 84 73 ff ff ff    	je     803933 <devfile_readmap+0x82>
+  8039c0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8039c4:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8039c9:	41 ff d6             	call   *%r14
+  8039cc:	a8 40                	test   $0x40,%al
+  8039ce:	0f 85 39 ff ff ff    	jne    80390d <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8039d4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039db:	4c 39 e3             	cmp    %r12,%rbx
+  8039de:	72 e4                	jb     8039c4 <devfile_readmap+0x113>
+  8039e0:	e9 4e ff ff ff       	jmp    803933 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8039e5:	4c 89 fa             	mov    %r15,%rdx
+  8039e8:	4c 89 ee             	mov    %r13,%rsi
+  8039eb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039ef:	48 b8 32 33 80 00 00 	movabs $0x803332,%rax
+  8039f6:	00 00 00 
+  8039f9:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8039fb:	48 85 c0             	test   %rax,%rax
+  8039fe:	78 0c                	js     803a0c <devfile_readmap+0x15b>
+    return totalRead + read;
+  803a00:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803a04:	48 01 f0             	add    %rsi,%rax
+  803a07:	e9 0e ff ff ff       	jmp    80391a <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  803a0c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803a10:	48 85 f6             	test   %rsi,%rsi
+  803a13:	48 0f 45 c6          	cmovne %rsi,%rax
+  803a17:	e9 fe fe ff ff       	jmp    80391a <devfile_readmap+0x69>
+
+0000000000803a1c <open>:
+open(const char *path, int mode) {
+  803a1c:	55                   	push   %rbp
+  803a1d:	48 89 e5             	mov    %rsp,%rbp
+  803a20:	41 55                	push   %r13
+  803a22:	41 54                	push   %r12
+  803a24:	53                   	push   %rbx
+  803a25:	48 83 ec 18          	sub    $0x18,%rsp
+  803a29:	49 89 fc             	mov    %rdi,%r12
+  803a2c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803a2f:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  803a36:	00 00 00 
+  803a39:	ff d0                	call   *%rax
+  803a3b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a41:	0f 87 8a 00 00 00    	ja     803ad1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a4b:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  803a52:	00 00 00 
+  803a55:	ff d0                	call   *%rax
+  803a57:	89 c3                	mov    %eax,%ebx
+  803a59:	85 c0                	test   %eax,%eax
+  803a5b:	78 50                	js     803aad <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803a5d:	4c 89 e6             	mov    %r12,%rsi
+  803a60:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803a67:	00 00 00 
+  803a6a:	48 89 df             	mov    %rbx,%rdi
+  803a6d:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803a74:	00 00 00 
+  803a77:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a79:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a80:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a84:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a89:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803a90:	00 00 00 
+  803a93:	ff d0                	call   *%rax
+  803a95:	89 c3                	mov    %eax,%ebx
+  803a97:	85 c0                	test   %eax,%eax
+  803a99:	78 1f                	js     803aba <open+0x9e>
+    return fd2num(fd);
+  803a9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a9f:	48 b8 4c 25 80 00 00 	movabs $0x80254c,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+  803aab:	89 c3                	mov    %eax,%ebx
+}
+  803aad:	89 d8                	mov    %ebx,%eax
+  803aaf:	48 83 c4 18          	add    $0x18,%rsp
+  803ab3:	5b                   	pop    %rbx
+  803ab4:	41 5c                	pop    %r12
+  803ab6:	41 5d                	pop    %r13
+  803ab8:	5d                   	pop    %rbp
+  803ab9:	c3                   	ret
+        fd_close(fd, 0);
+  803aba:	be 00 00 00 00       	mov    $0x0,%esi
+  803abf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ac3:	48 b8 95 26 80 00 00 	movabs $0x802695,%rax
+  803aca:	00 00 00 
+  803acd:	ff d0                	call   *%rax
+        return res;
+  803acf:	eb dc                	jmp    803aad <open+0x91>
+        return -E_BAD_PATH;
+  803ad1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ad6:	eb d5                	jmp    803aad <open+0x91>
+
+0000000000803ad8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803ad8:	55                   	push   %rbp
+  803ad9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803adc:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae1:	bf 13 00 00 00       	mov    $0x13,%edi
+  803ae6:	48 b8 f7 30 80 00 00 	movabs $0x8030f7,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+}
+  803af2:	5d                   	pop    %rbp
+  803af3:	c3                   	ret
+
+0000000000803af4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803af4:	55                   	push   %rbp
+  803af5:	48 89 e5             	mov    %rsp,%rbp
+  803af8:	41 54                	push   %r12
+  803afa:	53                   	push   %rbx
+  803afb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803afe:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803b05:	00 00 00 
+  803b08:	ff d0                	call   *%rax
+  803b0a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b0d:	48 be 00 4e 80 00 00 	movabs $0x804e00,%rsi
+  803b14:	00 00 00 
+  803b17:	48 89 df             	mov    %rbx,%rdi
+  803b1a:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803b21:	00 00 00 
+  803b24:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b26:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b2b:	41 2b 04 24          	sub    (%r12),%eax
+  803b2f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b35:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b3c:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b3f:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803b46:	00 00 00 
+  803b49:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b55:	5b                   	pop    %rbx
+  803b56:	41 5c                	pop    %r12
+  803b58:	5d                   	pop    %rbp
+  803b59:	c3                   	ret
+
+0000000000803b5a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b5a:	55                   	push   %rbp
+  803b5b:	48 89 e5             	mov    %rsp,%rbp
+  803b5e:	41 54                	push   %r12
+  803b60:	53                   	push   %rbx
+  803b61:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b69:	48 89 fe             	mov    %rdi,%rsi
+  803b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b71:	49 bc 7b 1f 80 00 00 	movabs $0x801f7b,%r12
+  803b78:	00 00 00 
+  803b7b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803b7e:	48 89 df             	mov    %rbx,%rdi
+  803b81:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803b88:	00 00 00 
+  803b8b:	ff d0                	call   *%rax
+  803b8d:	48 89 c6             	mov    %rax,%rsi
+  803b90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b9a:	41 ff d4             	call   *%r12
+}
+  803b9d:	5b                   	pop    %rbx
+  803b9e:	41 5c                	pop    %r12
+  803ba0:	5d                   	pop    %rbp
+  803ba1:	c3                   	ret
+
+0000000000803ba2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ba2:	55                   	push   %rbp
+  803ba3:	48 89 e5             	mov    %rsp,%rbp
+  803ba6:	41 57                	push   %r15
+  803ba8:	41 56                	push   %r14
+  803baa:	41 55                	push   %r13
+  803bac:	41 54                	push   %r12
+  803bae:	53                   	push   %rbx
+  803baf:	48 83 ec 18          	sub    $0x18,%rsp
+  803bb3:	49 89 fc             	mov    %rdi,%r12
+  803bb6:	49 89 f5             	mov    %rsi,%r13
+  803bb9:	49 89 d7             	mov    %rdx,%r15
+  803bbc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bc0:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803bc7:	00 00 00 
+  803bca:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803bcc:	4d 85 ff             	test   %r15,%r15
+  803bcf:	0f 84 af 00 00 00    	je     803c84 <devpipe_write+0xe2>
+  803bd5:	48 89 c3             	mov    %rax,%rbx
+  803bd8:	4c 89 f8             	mov    %r15,%rax
+  803bdb:	4d 89 ef             	mov    %r13,%r15
+  803bde:	4c 01 e8             	add    %r13,%rax
+  803be1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803be5:	49 bd 83 1e 80 00 00 	movabs $0x801e83,%r13
+  803bec:	00 00 00 
+            sys_yield();
+  803bef:	49 be 20 1e 80 00 00 	movabs $0x801e20,%r14
+  803bf6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803bf9:	8b 73 04             	mov    0x4(%rbx),%esi
+  803bfc:	48 63 ce             	movslq %esi,%rcx
+  803bff:	48 63 03             	movslq (%rbx),%rax
+  803c02:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803c08:	48 39 c1             	cmp    %rax,%rcx
+  803c0b:	72 2e                	jb     803c3b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c0d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c12:	48 89 da             	mov    %rbx,%rdx
+  803c15:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c1a:	4c 89 e7             	mov    %r12,%rdi
+  803c1d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803c20:	85 c0                	test   %eax,%eax
+  803c22:	74 66                	je     803c8a <devpipe_write+0xe8>
+            sys_yield();
+  803c24:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803c27:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c2a:	48 63 ce             	movslq %esi,%rcx
+  803c2d:	48 63 03             	movslq (%rbx),%rax
+  803c30:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803c36:	48 39 c1             	cmp    %rax,%rcx
+  803c39:	73 d2                	jae    803c0d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c3b:	41 0f b6 3f          	movzbl (%r15),%edi
+  803c3f:	48 89 ca             	mov    %rcx,%rdx
+  803c42:	48 c1 ea 03          	shr    $0x3,%rdx
+  803c46:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803c4d:	08 10 20 
+  803c50:	48 f7 e2             	mul    %rdx
+  803c53:	48 c1 ea 06          	shr    $0x6,%rdx
+  803c57:	48 89 d0             	mov    %rdx,%rax
+  803c5a:	48 c1 e0 09          	shl    $0x9,%rax
+  803c5e:	48 29 d0             	sub    %rdx,%rax
+  803c61:	48 c1 e0 03          	shl    $0x3,%rax
+  803c65:	48 29 c1             	sub    %rax,%rcx
+  803c68:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c6d:	83 c6 01             	add    $0x1,%esi
+  803c70:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c73:	49 83 c7 01          	add    $0x1,%r15
+  803c77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c7b:	49 39 c7             	cmp    %rax,%r15
+  803c7e:	0f 85 75 ff ff ff    	jne    803bf9 <devpipe_write+0x57>
+    return n;
+  803c84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c88:	eb 05                	jmp    803c8f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c8f:	48 83 c4 18          	add    $0x18,%rsp
+  803c93:	5b                   	pop    %rbx
+  803c94:	41 5c                	pop    %r12
+  803c96:	41 5d                	pop    %r13
+  803c98:	41 5e                	pop    %r14
+  803c9a:	41 5f                	pop    %r15
+  803c9c:	5d                   	pop    %rbp
+  803c9d:	c3                   	ret
+
+0000000000803c9e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+  803ca2:	41 57                	push   %r15
+  803ca4:	41 56                	push   %r14
+  803ca6:	41 55                	push   %r13
+  803ca8:	41 54                	push   %r12
+  803caa:	53                   	push   %rbx
+  803cab:	48 83 ec 18          	sub    $0x18,%rsp
+  803caf:	49 89 fc             	mov    %rdi,%r12
+  803cb2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803cb6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cba:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803cc1:	00 00 00 
+  803cc4:	ff d0                	call   *%rax
+  803cc6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803cc9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ccf:	49 bd 83 1e 80 00 00 	movabs $0x801e83,%r13
+  803cd6:	00 00 00 
+            sys_yield();
+  803cd9:	49 be 20 1e 80 00 00 	movabs $0x801e20,%r14
+  803ce0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ce3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ce8:	74 7d                	je     803d67 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cea:	8b 03                	mov    (%rbx),%eax
+  803cec:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cef:	75 26                	jne    803d17 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803cf1:	4d 85 ff             	test   %r15,%r15
+  803cf4:	75 77                	jne    803d6d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cf6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cfb:	48 89 da             	mov    %rbx,%rdx
+  803cfe:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d03:	4c 89 e7             	mov    %r12,%rdi
+  803d06:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803d09:	85 c0                	test   %eax,%eax
+  803d0b:	74 72                	je     803d7f <devpipe_read+0xe1>
+            sys_yield();
+  803d0d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803d10:	8b 03                	mov    (%rbx),%eax
+  803d12:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803d15:	74 df                	je     803cf6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d17:	48 63 c8             	movslq %eax,%rcx
+  803d1a:	48 89 ca             	mov    %rcx,%rdx
+  803d1d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803d21:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803d28:	08 10 20 
+  803d2b:	48 89 d0             	mov    %rdx,%rax
+  803d2e:	48 f7 e6             	mul    %rsi
+  803d31:	48 c1 ea 06          	shr    $0x6,%rdx
+  803d35:	48 89 d0             	mov    %rdx,%rax
+  803d38:	48 c1 e0 09          	shl    $0x9,%rax
+  803d3c:	48 29 d0             	sub    %rdx,%rax
+  803d3f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803d46:	00 
+  803d47:	48 89 c8             	mov    %rcx,%rax
+  803d4a:	48 29 d0             	sub    %rdx,%rax
+  803d4d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803d52:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d56:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803d5a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d5d:	49 83 c7 01          	add    $0x1,%r15
+  803d61:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803d65:	75 83                	jne    803cea <devpipe_read+0x4c>
+    return n;
+  803d67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d6b:	eb 03                	jmp    803d70 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803d6d:	4c 89 f8             	mov    %r15,%rax
+}
+  803d70:	48 83 c4 18          	add    $0x18,%rsp
+  803d74:	5b                   	pop    %rbx
+  803d75:	41 5c                	pop    %r12
+  803d77:	41 5d                	pop    %r13
+  803d79:	41 5e                	pop    %r14
+  803d7b:	41 5f                	pop    %r15
+  803d7d:	5d                   	pop    %rbp
+  803d7e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d84:	eb ea                	jmp    803d70 <devpipe_read+0xd2>
+
+0000000000803d86 <pipe>:
+pipe(int pfd[2]) {
+  803d86:	55                   	push   %rbp
+  803d87:	48 89 e5             	mov    %rsp,%rbp
+  803d8a:	41 55                	push   %r13
+  803d8c:	41 54                	push   %r12
+  803d8e:	53                   	push   %rbx
+  803d8f:	48 83 ec 18          	sub    $0x18,%rsp
+  803d93:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d9a:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+  803da6:	89 c3                	mov    %eax,%ebx
+  803da8:	85 c0                	test   %eax,%eax
+  803daa:	0f 88 a0 01 00 00    	js     803f50 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803db0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803db5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc3:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+  803dcf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803dd1:	85 c0                	test   %eax,%eax
+  803dd3:	0f 88 77 01 00 00    	js     803f50 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dd9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ddd:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+  803de9:	89 c3                	mov    %eax,%ebx
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	0f 88 43 01 00 00    	js     803f36 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803df3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803df8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dfd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e06:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  803e0d:	00 00 00 
+  803e10:	ff d0                	call   *%rax
+  803e12:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e14:	85 c0                	test   %eax,%eax
+  803e16:	0f 88 1a 01 00 00    	js     803f36 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e1c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e20:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803e27:	00 00 00 
+  803e2a:	ff d0                	call   *%rax
+  803e2c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e2f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e39:	48 89 c6             	mov    %rax,%rsi
+  803e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e41:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  803e48:	00 00 00 
+  803e4b:	ff d0                	call   *%rax
+  803e4d:	89 c3                	mov    %eax,%ebx
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	0f 88 c5 00 00 00    	js     803f1c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e57:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e5b:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803e62:	00 00 00 
+  803e65:	ff d0                	call   *%rax
+  803e67:	48 89 c1             	mov    %rax,%rcx
+  803e6a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e70:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e7b:	4c 89 ee             	mov    %r13,%rsi
+  803e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e83:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+  803e8f:	89 c3                	mov    %eax,%ebx
+  803e91:	85 c0                	test   %eax,%eax
+  803e93:	78 6e                	js     803f03 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e95:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e9a:	4c 89 ef             	mov    %r13,%rdi
+  803e9d:	48 b8 51 1e 80 00 00 	movabs $0x801e51,%rax
+  803ea4:	00 00 00 
+  803ea7:	ff d0                	call   *%rax
+  803ea9:	83 f8 02             	cmp    $0x2,%eax
+  803eac:	0f 85 ab 00 00 00    	jne    803f5d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803eb2:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803eb9:	00 00 
+  803ebb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ebf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ec1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ec5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ecc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ed0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ed2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ed6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803edd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ee1:	48 bb 4c 25 80 00 00 	movabs $0x80254c,%rbx
+  803ee8:	00 00 00 
+  803eeb:	ff d3                	call   *%rbx
+  803eed:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ef1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ef5:	ff d3                	call   *%rbx
+  803ef7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803efc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f01:	eb 4d                	jmp    803f50 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f08:	4c 89 ee             	mov    %r13,%rsi
+  803f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f10:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  803f17:	00 00 00 
+  803f1a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f21:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f2a:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  803f31:	00 00 00 
+  803f34:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f3b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f44:	48 b8 7b 1f 80 00 00 	movabs $0x801f7b,%rax
+  803f4b:	00 00 00 
+  803f4e:	ff d0                	call   *%rax
+}
+  803f50:	89 d8                	mov    %ebx,%eax
+  803f52:	48 83 c4 18          	add    $0x18,%rsp
+  803f56:	5b                   	pop    %rbx
+  803f57:	41 5c                	pop    %r12
+  803f59:	41 5d                	pop    %r13
+  803f5b:	5d                   	pop    %rbp
+  803f5c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f5d:	48 b9 18 4e 80 00 00 	movabs $0x804e18,%rcx
+  803f64:	00 00 00 
+  803f67:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  803f6e:	00 00 00 
+  803f71:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803f76:	48 bf 07 4e 80 00 00 	movabs $0x804e07,%rdi
+  803f7d:	00 00 00 
+  803f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f85:	49 b8 ae 0d 80 00 00 	movabs $0x800dae,%r8
+  803f8c:	00 00 00 
+  803f8f:	41 ff d0             	call   *%r8
+
+0000000000803f92 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f9e:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  803fa5:	00 00 00 
+  803fa8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803faa:	85 c0                	test   %eax,%eax
+  803fac:	78 35                	js     803fe3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fb2:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+  803fbe:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fc1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803fc6:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fcb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fcf:	48 b8 83 1e 80 00 00 	movabs $0x801e83,%rax
+  803fd6:	00 00 00 
+  803fd9:	ff d0                	call   *%rax
+  803fdb:	85 c0                	test   %eax,%eax
+  803fdd:	0f 94 c0             	sete   %al
+  803fe0:	0f b6 c0             	movzbl %al,%eax
+}
+  803fe3:	c9                   	leave
+  803fe4:	c3                   	ret
+
+0000000000803fe5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fe5:	48 89 f8             	mov    %rdi,%rax
+  803fe8:	48 c1 e8 27          	shr    $0x27,%rax
+  803fec:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ff3:	01 00 00 
+  803ff6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ffa:	f6 c2 01             	test   $0x1,%dl
+  803ffd:	74 6d                	je     80406c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fff:	48 89 f8             	mov    %rdi,%rax
+  804002:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804006:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80400d:	01 00 00 
+  804010:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804014:	f6 c2 01             	test   $0x1,%dl
+  804017:	74 62                	je     80407b <get_uvpt_entry+0x96>
+  804019:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804020:	01 00 00 
+  804023:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804027:	f6 c2 80             	test   $0x80,%dl
+  80402a:	75 4f                	jne    80407b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80402c:	48 89 f8             	mov    %rdi,%rax
+  80402f:	48 c1 e8 15          	shr    $0x15,%rax
+  804033:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80403a:	01 00 00 
+  80403d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804041:	f6 c2 01             	test   $0x1,%dl
+  804044:	74 44                	je     80408a <get_uvpt_entry+0xa5>
+  804046:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80404d:	01 00 00 
+  804050:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804054:	f6 c2 80             	test   $0x80,%dl
+  804057:	75 31                	jne    80408a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804059:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80405d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804064:	01 00 00 
+  804067:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80406b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80406c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804073:	01 00 00 
+  804076:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80407a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80407b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804082:	01 00 00 
+  804085:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804089:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80408a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804091:	01 00 00 
+  804094:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804098:	c3                   	ret
+
+0000000000804099 <get_prot>:
+
+int
+get_prot(void *va) {
+  804099:	55                   	push   %rbp
+  80409a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80409d:	48 b8 e5 3f 80 00 00 	movabs $0x803fe5,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+  8040a9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040ac:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040b1:	89 c1                	mov    %eax,%ecx
+  8040b3:	83 c9 04             	or     $0x4,%ecx
+  8040b6:	f6 c2 01             	test   $0x1,%dl
+  8040b9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040bc:	89 c1                	mov    %eax,%ecx
+  8040be:	83 c9 02             	or     $0x2,%ecx
+  8040c1:	f6 c2 02             	test   $0x2,%dl
+  8040c4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040c7:	89 c1                	mov    %eax,%ecx
+  8040c9:	83 c9 01             	or     $0x1,%ecx
+  8040cc:	48 85 d2             	test   %rdx,%rdx
+  8040cf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040d2:	89 c1                	mov    %eax,%ecx
+  8040d4:	83 c9 40             	or     $0x40,%ecx
+  8040d7:	f6 c6 04             	test   $0x4,%dh
+  8040da:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040dd:	5d                   	pop    %rbp
+  8040de:	c3                   	ret
+
+00000000008040df <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040df:	55                   	push   %rbp
+  8040e0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040e3:	48 b8 e5 3f 80 00 00 	movabs $0x803fe5,%rax
+  8040ea:	00 00 00 
+  8040ed:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040ef:	48 c1 e8 06          	shr    $0x6,%rax
+  8040f3:	83 e0 01             	and    $0x1,%eax
+}
+  8040f6:	5d                   	pop    %rbp
+  8040f7:	c3                   	ret
+
+00000000008040f8 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8040f8:	55                   	push   %rbp
+  8040f9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040fc:	48 b8 e5 3f 80 00 00 	movabs $0x803fe5,%rax
+  804103:	00 00 00 
+  804106:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  804108:	48 c1 e8 05          	shr    $0x5,%rax
+  80410c:	83 e0 01             	and    $0x1,%eax
+}
+  80410f:	5d                   	pop    %rbp
+  804110:	c3                   	ret
+
+0000000000804111 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804111:	55                   	push   %rbp
+  804112:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804115:	48 b8 e5 3f 80 00 00 	movabs $0x803fe5,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+  804121:	83 e0 01             	and    $0x1,%eax
+}
+  804124:	5d                   	pop    %rbp
+  804125:	c3                   	ret
+
+0000000000804126 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804126:	55                   	push   %rbp
+  804127:	48 89 e5             	mov    %rsp,%rbp
+  80412a:	41 57                	push   %r15
+  80412c:	41 56                	push   %r14
+  80412e:	41 55                	push   %r13
+  804130:	41 54                	push   %r12
+  804132:	53                   	push   %rbx
+  804133:	48 83 ec 18          	sub    $0x18,%rsp
+  804137:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80413b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80413f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  804144:	49 bd 11 41 80 00 00 	movabs $0x804111,%r13
+  80414b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80414e:	49 bf 99 40 80 00 00 	movabs $0x804099,%r15
+  804155:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  804158:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80415f:	00 00 00 
+  804162:	eb 0c                	jmp    804170 <foreach_shared_region+0x4a>
+  804164:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80416b:	4c 39 f3             	cmp    %r14,%rbx
+  80416e:	74 2e                	je     80419e <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  804170:	48 89 df             	mov    %rbx,%rdi
+  804173:	41 ff d5             	call   *%r13
+  804176:	84 c0                	test   %al,%al
+  804178:	74 ea                	je     804164 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80417a:	48 89 df             	mov    %rbx,%rdi
+  80417d:	41 ff d7             	call   *%r15
+  804180:	a8 40                	test   $0x40,%al
+  804182:	74 e0                	je     804164 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  804184:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80418b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80418f:	48 89 df             	mov    %rbx,%rdi
+  804192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804196:	ff d0                	call   *%rax
+				if (res < 0) {
+  804198:	85 c0                	test   %eax,%eax
+  80419a:	79 c8                	jns    804164 <foreach_shared_region+0x3e>
+  80419c:	eb 05                	jmp    8041a3 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80419e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041a3:	48 83 c4 18          	add    $0x18,%rsp
+  8041a7:	5b                   	pop    %rbx
+  8041a8:	41 5c                	pop    %r12
+  8041aa:	41 5d                	pop    %r13
+  8041ac:	41 5e                	pop    %r14
+  8041ae:	41 5f                	pop    %r15
+  8041b0:	5d                   	pop    %rbp
+  8041b1:	c3                   	ret
+
+00000000008041b2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b7:	c3                   	ret
+
+00000000008041b8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041b8:	55                   	push   %rbp
+  8041b9:	48 89 e5             	mov    %rsp,%rbp
+  8041bc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041bf:	48 be 3c 4e 80 00 00 	movabs $0x804e3c,%rsi
+  8041c6:	00 00 00 
+  8041c9:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  8041d0:	00 00 00 
+  8041d3:	ff d0                	call   *%rax
+    return 0;
+}
+  8041d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041da:	5d                   	pop    %rbp
+  8041db:	c3                   	ret
+
+00000000008041dc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041dc:	55                   	push   %rbp
+  8041dd:	48 89 e5             	mov    %rsp,%rbp
+  8041e0:	41 57                	push   %r15
+  8041e2:	41 56                	push   %r14
+  8041e4:	41 55                	push   %r13
+  8041e6:	41 54                	push   %r12
+  8041e8:	53                   	push   %rbx
+  8041e9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041f0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041f7:	48 85 d2             	test   %rdx,%rdx
+  8041fa:	74 7a                	je     804276 <devcons_write+0x9a>
+  8041fc:	49 89 d6             	mov    %rdx,%r14
+  8041ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804205:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80420a:	49 bf 1d 1a 80 00 00 	movabs $0x801a1d,%r15
+  804211:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804214:	4c 89 f3             	mov    %r14,%rbx
+  804217:	48 29 f3             	sub    %rsi,%rbx
+  80421a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80421f:	48 39 c3             	cmp    %rax,%rbx
+  804222:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804226:	4c 63 eb             	movslq %ebx,%r13
+  804229:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804230:	48 01 c6             	add    %rax,%rsi
+  804233:	4c 89 ea             	mov    %r13,%rdx
+  804236:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80423d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804240:	4c 89 ee             	mov    %r13,%rsi
+  804243:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80424a:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  804251:	00 00 00 
+  804254:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804256:	41 01 dc             	add    %ebx,%r12d
+  804259:	49 63 f4             	movslq %r12d,%rsi
+  80425c:	4c 39 f6             	cmp    %r14,%rsi
+  80425f:	72 b3                	jb     804214 <devcons_write+0x38>
+    return res;
+  804261:	49 63 c4             	movslq %r12d,%rax
+}
+  804264:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80426b:	5b                   	pop    %rbx
+  80426c:	41 5c                	pop    %r12
+  80426e:	41 5d                	pop    %r13
+  804270:	41 5e                	pop    %r14
+  804272:	41 5f                	pop    %r15
+  804274:	5d                   	pop    %rbp
+  804275:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804276:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80427c:	eb e3                	jmp    804261 <devcons_write+0x85>
+
+000000000080427e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80427e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804281:	ba 00 00 00 00       	mov    $0x0,%edx
+  804286:	48 85 c0             	test   %rax,%rax
+  804289:	74 55                	je     8042e0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80428b:	55                   	push   %rbp
+  80428c:	48 89 e5             	mov    %rsp,%rbp
+  80428f:	41 55                	push   %r13
+  804291:	41 54                	push   %r12
+  804293:	53                   	push   %rbx
+  804294:	48 83 ec 08          	sub    $0x8,%rsp
+  804298:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80429b:	48 bb 53 1d 80 00 00 	movabs $0x801d53,%rbx
+  8042a2:	00 00 00 
+  8042a5:	49 bc 20 1e 80 00 00 	movabs $0x801e20,%r12
+  8042ac:	00 00 00 
+  8042af:	eb 03                	jmp    8042b4 <devcons_read+0x36>
+  8042b1:	41 ff d4             	call   *%r12
+  8042b4:	ff d3                	call   *%rbx
+  8042b6:	85 c0                	test   %eax,%eax
+  8042b8:	74 f7                	je     8042b1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8042ba:	48 63 d0             	movslq %eax,%rdx
+  8042bd:	78 13                	js     8042d2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042c4:	83 f8 04             	cmp    $0x4,%eax
+  8042c7:	74 09                	je     8042d2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042c9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042cd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042d2:	48 89 d0             	mov    %rdx,%rax
+  8042d5:	48 83 c4 08          	add    $0x8,%rsp
+  8042d9:	5b                   	pop    %rbx
+  8042da:	41 5c                	pop    %r12
+  8042dc:	41 5d                	pop    %r13
+  8042de:	5d                   	pop    %rbp
+  8042df:	c3                   	ret
+  8042e0:	48 89 d0             	mov    %rdx,%rax
+  8042e3:	c3                   	ret
+
+00000000008042e4 <cputchar>:
+cputchar(int ch) {
+  8042e4:	55                   	push   %rbp
+  8042e5:	48 89 e5             	mov    %rsp,%rbp
+  8042e8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042ec:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8042f5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042f9:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  804300:	00 00 00 
+  804303:	ff d0                	call   *%rax
+}
+  804305:	c9                   	leave
+  804306:	c3                   	ret
+
+0000000000804307 <getchar>:
+getchar(void) {
+  804307:	55                   	push   %rbp
+  804308:	48 89 e5             	mov    %rsp,%rbp
+  80430b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80430f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804314:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431d:	48 b8 bd 28 80 00 00 	movabs $0x8028bd,%rax
+  804324:	00 00 00 
+  804327:	ff d0                	call   *%rax
+  804329:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80432b:	85 c0                	test   %eax,%eax
+  80432d:	78 06                	js     804335 <getchar+0x2e>
+  80432f:	74 08                	je     804339 <getchar+0x32>
+  804331:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804335:	89 d0                	mov    %edx,%eax
+  804337:	c9                   	leave
+  804338:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804339:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80433e:	eb f5                	jmp    804335 <getchar+0x2e>
+
+0000000000804340 <iscons>:
+iscons(int fdnum) {
+  804340:	55                   	push   %rbp
+  804341:	48 89 e5             	mov    %rsp,%rbp
+  804344:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804348:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80434c:	48 b8 da 25 80 00 00 	movabs $0x8025da,%rax
+  804353:	00 00 00 
+  804356:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804358:	85 c0                	test   %eax,%eax
+  80435a:	78 18                	js     804374 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80435c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804360:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  804367:	00 00 00 
+  80436a:	8b 00                	mov    (%rax),%eax
+  80436c:	39 02                	cmp    %eax,(%rdx)
+  80436e:	0f 94 c0             	sete   %al
+  804371:	0f b6 c0             	movzbl %al,%eax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+0000000000804376 <opencons>:
+opencons(void) {
+  804376:	55                   	push   %rbp
+  804377:	48 89 e5             	mov    %rsp,%rbp
+  80437a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80437e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804382:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  804389:	00 00 00 
+  80438c:	ff d0                	call   *%rax
+  80438e:	85 c0                	test   %eax,%eax
+  804390:	78 49                	js     8043db <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804392:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804397:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80439c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a5:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  8043ac:	00 00 00 
+  8043af:	ff d0                	call   *%rax
+  8043b1:	85 c0                	test   %eax,%eax
+  8043b3:	78 26                	js     8043db <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043b9:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8043c0:	00 00 
+  8043c2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043c8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043cf:	48 b8 4c 25 80 00 00 	movabs $0x80254c,%rax
+  8043d6:	00 00 00 
+  8043d9:	ff d0                	call   *%rax
+}
+  8043db:	c9                   	leave
+  8043dc:	c3                   	ret
+
+00000000008043dd <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8043dd:	55                   	push   %rbp
+  8043de:	48 89 e5             	mov    %rsp,%rbp
+  8043e1:	41 55                	push   %r13
+  8043e3:	41 54                	push   %r12
+  8043e5:	53                   	push   %rbx
+  8043e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8043ea:	49 89 fc             	mov    %rdi,%r12
+  8043ed:	48 89 f7             	mov    %rsi,%rdi
+  8043f0:	48 89 d3             	mov    %rdx,%rbx
+  8043f3:	49 89 cd             	mov    %rcx,%r13
+  8043f6:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8043f9:	48 85 f6             	test   %rsi,%rsi
+  8043fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804403:	00 00 00 
+  804406:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80440a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80440f:	48 85 db             	test   %rbx,%rbx
+  804412:	74 03                	je     804417 <ipc_recv_timed+0x3a>
+  804414:	48 8b 33             	mov    (%rbx),%rsi
+  804417:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  80441e:	00 00 00 
+  804421:	ff d0                	call   *%rax
+    if (res < 0) {
+  804423:	85 c0                	test   %eax,%eax
+  804425:	78 75                	js     80449c <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804427:	4d 85 e4             	test   %r12,%r12
+  80442a:	74 14                	je     804440 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80442c:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  804433:	00 00 00 
+  804436:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80443c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  804440:	4d 85 ed             	test   %r13,%r13
+  804443:	74 14                	je     804459 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  804445:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  80444c:	00 00 00 
+  80444f:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  804455:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  804459:	48 85 db             	test   %rbx,%rbx
+  80445c:	74 23                	je     804481 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80445e:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  804465:	00 00 00 
+  804468:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80446e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804473:	85 c9                	test   %ecx,%ecx
+  804475:	74 07                	je     80447e <ipc_recv_timed+0xa1>
+  804477:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80447e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804481:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  804488:	00 00 00 
+  80448b:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  804491:	48 83 c4 08          	add    $0x8,%rsp
+  804495:	5b                   	pop    %rbx
+  804496:	41 5c                	pop    %r12
+  804498:	41 5d                	pop    %r13
+  80449a:	5d                   	pop    %rbp
+  80449b:	c3                   	ret
+        if (from_env_store != NULL) {
+  80449c:	4d 85 e4             	test   %r12,%r12
+  80449f:	74 08                	je     8044a9 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8044a1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044a8:	00 
+        if (perm_store != NULL) {
+  8044a9:	4d 85 ed             	test   %r13,%r13
+  8044ac:	74 08                	je     8044b6 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8044ae:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044b5:	00 
+        if (size != NULL) {
+  8044b6:	48 85 db             	test   %rbx,%rbx
+  8044b9:	74 d6                	je     804491 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8044bb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8044c2:	eb cd                	jmp    804491 <ipc_recv_timed+0xb4>
+
+00000000008044c4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044c4:	55                   	push   %rbp
+  8044c5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8044c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8044ce:	48 b8 dd 43 80 00 00 	movabs $0x8043dd,%rax
+  8044d5:	00 00 00 
+  8044d8:	ff d0                	call   *%rax
+}
+  8044da:	5d                   	pop    %rbp
+  8044db:	c3                   	ret
+
+00000000008044dc <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8044dc:	55                   	push   %rbp
+  8044dd:	48 89 e5             	mov    %rsp,%rbp
+  8044e0:	41 57                	push   %r15
+  8044e2:	41 56                	push   %r14
+  8044e4:	41 55                	push   %r13
+  8044e6:	41 54                	push   %r12
+  8044e8:	53                   	push   %rbx
+  8044e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8044ed:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8044f0:	48 89 d3             	mov    %rdx,%rbx
+  8044f3:	49 89 cc             	mov    %rcx,%r12
+  8044f6:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044f9:	48 85 d2             	test   %rdx,%rdx
+  8044fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804503:	00 00 00 
+  804506:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80450a:	89 f0                	mov    %esi,%eax
+  80450c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804510:	48 89 da             	mov    %rbx,%rdx
+  804513:	48 89 c6             	mov    %rax,%rsi
+  804516:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  80451d:	00 00 00 
+  804520:	ff d0                	call   *%rax
+    while (res < 0) {
+  804522:	85 c0                	test   %eax,%eax
+  804524:	79 65                	jns    80458b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804526:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804529:	75 33                	jne    80455e <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80452b:	49 bf 20 1e 80 00 00 	movabs $0x801e20,%r15
+  804532:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804535:	49 be 1d 21 80 00 00 	movabs $0x80211d,%r14
+  80453c:	00 00 00 
+        sys_yield();
+  80453f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804542:	45 89 e8             	mov    %r13d,%r8d
+  804545:	4c 89 e1             	mov    %r12,%rcx
+  804548:	48 89 da             	mov    %rbx,%rdx
+  80454b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80454f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804552:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  804555:	85 c0                	test   %eax,%eax
+  804557:	79 32                	jns    80458b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804559:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80455c:	74 e1                	je     80453f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80455e:	89 c1                	mov    %eax,%ecx
+  804560:	48 ba 48 4e 80 00 00 	movabs $0x804e48,%rdx
+  804567:	00 00 00 
+  80456a:	be 52 00 00 00       	mov    $0x52,%esi
+  80456f:	48 bf 5c 4e 80 00 00 	movabs $0x804e5c,%rdi
+  804576:	00 00 00 
+  804579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457e:	49 b8 ae 0d 80 00 00 	movabs $0x800dae,%r8
+  804585:	00 00 00 
+  804588:	41 ff d0             	call   *%r8
+    }
+}
+  80458b:	48 83 c4 18          	add    $0x18,%rsp
+  80458f:	5b                   	pop    %rbx
+  804590:	41 5c                	pop    %r12
+  804592:	41 5d                	pop    %r13
+  804594:	41 5e                	pop    %r14
+  804596:	41 5f                	pop    %r15
+  804598:	5d                   	pop    %rbp
+  804599:	c3                   	ret
+
+000000000080459a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80459a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80459f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8045a6:	00 00 00 
+  8045a9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8045ad:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8045b1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8045b5:	48 01 ca             	add    %rcx,%rdx
+  8045b8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8045be:	39 fa                	cmp    %edi,%edx
+  8045c0:	74 12                	je     8045d4 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8045c2:	48 83 c0 01          	add    $0x1,%rax
+  8045c6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8045cc:	75 db                	jne    8045a9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8045ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045d3:	c3                   	ret
+            return envs[i].env_id;
+  8045d4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8045d8:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8045dc:	48 c1 e2 04          	shl    $0x4,%rdx
+  8045e0:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8045e7:	00 00 00 
+  8045ea:	48 01 d0             	add    %rdx,%rax
+  8045ed:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8045f3:	c3                   	ret
+  8045f4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008045f8 <__rodata_start>:
+  8045f8:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  8045fd:	25 2d 38 73 20       	and    $0x2073382d,%eax
+  804602:	25 2d 38 73 0a       	and    $0xa73382d,%eax
+  804607:	00 72 31             	add    %dh,0x31(%rdx)
+  80460a:	34 00                	xor    $0x0,%al
+  80460c:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  804611:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  804616:	20 25 30 38 6c 78    	and    %ah,0x786c3830(%rip)        # 78ec7e4c <__bss_end+0x786bee4c>
+  80461c:	20 00                	and    %al,(%rax)
+  80461e:	4f                   	rex.WRXB
+  80461f:	4b 0a 00             	rex.WXB or (%r8),%al
+  804622:	4d                   	rex.WRB
+  804623:	49 53                	rex.WB push %r11
+  804625:	4d                   	rex.WRB
+  804626:	41 54                	push   %r12
+  804628:	43                   	rex.XB
+  804629:	48 0a 00             	rex.W or (%rax),%al
+  80462c:	72 31                	jb     80465f <__rodata_start+0x67>
+  80462e:	33 00                	xor    (%rax),%eax
+  804630:	72 31                	jb     804663 <__rodata_start+0x6b>
+  804632:	32 00                	xor    (%rax),%al
+  804634:	72 31                	jb     804667 <__rodata_start+0x6f>
+  804636:	31 00                	xor    %eax,(%rax)
+  804638:	72 31                	jb     80466b <__rodata_start+0x73>
+  80463a:	30 00                	xor    %al,(%rax)
+  80463c:	72 73                	jb     8046b1 <__rodata_start+0xb9>
+  80463e:	69 00 72 64 69 00    	imul   $0x696472,(%rax),%eax
+  804644:	72 62                	jb     8046a8 <__rodata_start+0xb0>
+  804646:	70 00                	jo     804648 <__rodata_start+0x50>
+  804648:	72 62                	jb     8046ac <__rodata_start+0xb4>
+  80464a:	78 00                	js     80464c <__rodata_start+0x54>
+  80464c:	72 64                	jb     8046b2 <__rodata_start+0xba>
+  80464e:	78 00                	js     804650 <__rodata_start+0x58>
+  804650:	72 63                	jb     8046b5 <__rodata_start+0xbd>
+  804652:	78 00                	js     804654 <__rodata_start+0x5c>
+  804654:	72 61                	jb     8046b7 <__rodata_start+0xbf>
+  804656:	78 00                	js     804658 <__rodata_start+0x60>
+  804658:	72 69                	jb     8046c3 <__rodata_start+0xcb>
+  80465a:	70 00                	jo     80465c <__rodata_start+0x64>
+  80465c:	72 66                	jb     8046c4 <__rodata_start+0xcc>
+  80465e:	6c                   	insb   (%dx),%es:(%rdi)
+  80465f:	61                   	(bad)
+  804660:	67 73 00             	addr32 jae 804663 <__rodata_start+0x6b>
+  804663:	72 73                	jb     8046d8 <__rodata_start+0xe0>
+  804665:	70 00                	jo     804667 <__rodata_start+0x6f>
+  804667:	52                   	push   %rdx
+  804668:	65 67 69 73 74 65 72 	imul   $0x20737265,%gs:0x74(%ebx),%esi
+  80466f:	73 20 
+  804671:	25 73 20 00 75       	and    $0x75002073,%eax
+  804676:	73 65                	jae    8046dd <__rodata_start+0xe5>
+  804678:	72 2f                	jb     8046a9 <__rodata_start+0xb1>
+  80467a:	66 61                	data16 (bad)
+  80467c:	75 6c                	jne    8046ea <__rodata_start+0xf2>
+  80467e:	74 72                	je     8046f2 <__rodata_start+0xfa>
+  804680:	65 67 73 2e          	gs addr32 jae 8046b2 <__rodata_start+0xba>
+  804684:	63 00                	movsxd (%rax),%eax
+  804686:	69 6e 20 55 54 72 61 	imul   $0x61725455,0x20(%rsi),%ebp
+  80468d:	70 66                	jo     8046f5 <__rodata_start+0xfd>
+  80468f:	72 61                	jb     8046f2 <__rodata_start+0xfa>
+  804691:	6d                   	insl   (%dx),%es:(%rdi)
+  804692:	65 00 64 75 72       	add    %ah,%gs:0x72(%rbp,%rsi,2)
+  804697:	69 6e 67 00 62 65 66 	imul   $0x66656200,0x67(%rsi),%ebp
+  80469e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80469f:	72 65                	jb     804706 <__rodata_start+0x10e>
+  8046a1:	00 73 79             	add    %dh,0x79(%rbx)
+  8046a4:	73 5f                	jae    804705 <__rodata_start+0x10d>
+  8046a6:	70 61                	jo     804709 <__rodata_start+0x111>
+  8046a8:	67 65 5f             	addr32 gs pop %rdi
+  8046ab:	61                   	(bad)
+  8046ac:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046af:	63 3a                	movsxd (%rdx),%edi
+  8046b1:	20 25 69 00 61 66    	and    %ah,0x66610069(%rip)        # 66e14720 <__bss_end+0x6660b720>
+  8046b7:	74 65                	je     80471e <__rodata_start+0x126>
+  8046b9:	72 20                	jb     8046db <__rodata_start+0xe3>
+  8046bb:	70 61                	jo     80471e <__rodata_start+0x126>
+  8046bd:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  8046c4:	74 00                	je     8046c6 <__rodata_start+0xce>
+  8046c6:	61                   	(bad)
+  8046c7:	66 74 65             	data16 je 80472f <__rodata_start+0x137>
+  8046ca:	72 00                	jb     8046cc <__rodata_start+0xd4>
+  8046cc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8046d0:	70 67                	jo     804739 <__rodata_start+0x141>
+  8046d2:	66 61                	data16 (bad)
+  8046d4:	75 6c                	jne    804742 <__rodata_start+0x14a>
+  8046d6:	74 20                	je     8046f8 <__rodata_start+0x100>
+  8046d8:	65 78 70             	gs js  80474b <__rodata_start+0x153>
+  8046db:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8046e0:	20 61 74             	and    %ah,0x74(%rcx)
+  8046e3:	20 55 54             	and    %dl,0x54(%rbp)
+  8046e6:	45                   	rex.RB
+  8046e7:	4d 50                	rex.WRB push %r8
+  8046e9:	2c 20                	sub    $0x20,%al
+  8046eb:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8046ed:	74 20                	je     80470f <__rodata_start+0x117>
+  8046ef:	30 78 25             	xor    %bh,0x25(%rax)
+  8046f2:	30 38                	xor    %bh,(%rax)
+  8046f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8046f5:	78 20                	js     804717 <__rodata_start+0x11f>
+  8046f7:	28 72 69             	sub    %dh,0x69(%rdx)
+  8046fa:	70 20                	jo     80471c <__rodata_start+0x124>
+  8046fc:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  804701:	29 00                	sub    %eax,(%rax)
+  804703:	00 00                	add    %al,(%rax)
+  804705:	00 00                	add    %al,(%rax)
+  804707:	00 52 49             	add    %dl,0x49(%rdx)
+  80470a:	50                   	push   %rax
+  80470b:	20 61 66             	and    %ah,0x66(%rcx)
+  80470e:	74 65                	je     804775 <__rodata_start+0x17d>
+  804710:	72 20                	jb     804732 <__rodata_start+0x13a>
+  804712:	70 61                	jo     804775 <__rodata_start+0x17d>
+  804714:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  80471b:	74 20                	je     80473d <__rodata_start+0x145>
+  80471d:	4d                   	rex.WRB
+  80471e:	49 53                	rex.WB push %r11
+  804720:	4d                   	rex.WRB
+  804721:	41 54                	push   %r12
+  804723:	43                   	rex.XB
+  804724:	48 0a 00             	rex.W or (%rax),%al
+  804727:	3c 75                	cmp    $0x75,%al
+  804729:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80472a:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80472e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80472f:	3e 00 0f             	ds add %cl,(%rdi)
+  804732:	1f                   	(bad)
+  804733:	80 00 00             	addb   $0x0,(%rax)
+  804736:	00 00                	add    %al,(%rax)
+  804738:	5b                   	pop    %rbx
+  804739:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80473e:	20 75 73             	and    %dh,0x73(%rbp)
+  804741:	65 72 20             	gs jb  804764 <__rodata_start+0x16c>
+  804744:	70 61                	jo     8047a7 <__rodata_start+0x1af>
+  804746:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804747:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80474e:	73 20                	jae    804770 <__rodata_start+0x178>
+  804750:	61                   	(bad)
+  804751:	74 20                	je     804773 <__rodata_start+0x17b>
+  804753:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804758:	3a 20                	cmp    (%rax),%ah
+  80475a:	00 30                	add    %dh,(%rax)
+  80475c:	31 32                	xor    %esi,(%rdx)
+  80475e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804765:	41                   	rex.B
+  804766:	42                   	rex.X
+  804767:	43                   	rex.XB
+  804768:	44                   	rex.R
+  804769:	45                   	rex.RB
+  80476a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80476d:	31 32                	xor    %esi,(%rdx)
+  80476f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804776:	61                   	(bad)
+  804777:	62 63 64 65 66       	(bad)
+  80477c:	00 28                	add    %ch,(%rax)
+  80477e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80477f:	75 6c                	jne    8047ed <__rodata_start+0x1f5>
+  804781:	6c                   	insb   (%dx),%es:(%rdi)
+  804782:	29 00                	sub    %eax,(%rax)
+  804784:	65 72 72             	gs jb  8047f9 <__rodata_start+0x201>
+  804787:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804788:	72 20                	jb     8047aa <__rodata_start+0x1b2>
+  80478a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80478f:	73 70                	jae    804801 <__rodata_start+0x209>
+  804791:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804795:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80479c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80479d:	72 00                	jb     80479f <__rodata_start+0x1a7>
+  80479f:	62 61 64 20 65       	(bad)
+  8047a4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047a5:	76 69                	jbe    804810 <__rodata_start+0x218>
+  8047a7:	72 6f                	jb     804818 <__rodata_start+0x220>
+  8047a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8047ab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047ad:	74 00                	je     8047af <__rodata_start+0x1b7>
+  8047af:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8047b6:	20 70 61             	and    %dh,0x61(%rax)
+  8047b9:	72 61                	jb     80481c <__rodata_start+0x224>
+  8047bb:	6d                   	insl   (%dx),%es:(%rdi)
+  8047bc:	65 74 65             	gs je  804824 <__rodata_start+0x22c>
+  8047bf:	72 00                	jb     8047c1 <__rodata_start+0x1c9>
+  8047c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047c2:	75 74                	jne    804838 <__rodata_start+0x240>
+  8047c4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8047c7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8047ca:	6d                   	insl   (%dx),%es:(%rdi)
+  8047cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047cc:	72 79                	jb     804847 <__rodata_start+0x24f>
+  8047ce:	00 6f 75             	add    %ch,0x75(%rdi)
+  8047d1:	74 20                	je     8047f3 <__rodata_start+0x1fb>
+  8047d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047d4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8047d8:	76 69                	jbe    804843 <__rodata_start+0x24b>
+  8047da:	72 6f                	jb     80484b <__rodata_start+0x253>
+  8047dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047dd:	6d                   	insl   (%dx),%es:(%rdi)
+  8047de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047e0:	74 73                	je     804855 <__rodata_start+0x25d>
+  8047e2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8047e5:	72 72                	jb     804859 <__rodata_start+0x261>
+  8047e7:	75 70                	jne    804859 <__rodata_start+0x261>
+  8047e9:	74 65                	je     804850 <__rodata_start+0x258>
+  8047eb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8047f0:	75 67                	jne    804859 <__rodata_start+0x261>
+  8047f2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8047f5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047f7:	00 73 65             	add    %dh,0x65(%rbx)
+  8047fa:	67 6d                	insl   (%dx),%es:(%edi)
+  8047fc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047fe:	74 61                	je     804861 <__rodata_start+0x269>
+  804800:	74 69                	je     80486b <__rodata_start+0x273>
+  804802:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804803:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804804:	20 66 61             	and    %ah,0x61(%rsi)
+  804807:	75 6c                	jne    804875 <__rodata_start+0x27d>
+  804809:	74 00                	je     80480b <__rodata_start+0x213>
+  80480b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804812:	20 45 4c             	and    %al,0x4c(%rbp)
+  804815:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804819:	61                   	(bad)
+  80481a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80481f:	20 73 75             	and    %dh,0x75(%rbx)
+  804822:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804825:	73 79                	jae    8048a0 <__rodata_start+0x2a8>
+  804827:	73 74                	jae    80489d <__rodata_start+0x2a5>
+  804829:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80482b:	20 63 61             	and    %ah,0x61(%rbx)
+  80482e:	6c                   	insb   (%dx),%es:(%rdi)
+  80482f:	6c                   	insb   (%dx),%es:(%rdi)
+  804830:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804833:	74 72                	je     8048a7 <__rodata_start+0x2af>
+  804835:	79 20                	jns    804857 <__rodata_start+0x25f>
+  804837:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804838:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804839:	74 20                	je     80485b <__rodata_start+0x263>
+  80483b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80483d:	75 6e                	jne    8048ad <__rodata_start+0x2b5>
+  80483f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804843:	76 20                	jbe    804865 <__rodata_start+0x26d>
+  804845:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80484c:	72 65                	jb     8048b3 <__rodata_start+0x2bb>
+  80484e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804851:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804852:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804856:	65 78 70             	gs js  8048c9 <__rodata_start+0x2d1>
+  804859:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80485e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804861:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804865:	20 66 69             	and    %ah,0x69(%rsi)
+  804868:	6c                   	insb   (%dx),%es:(%rdi)
+  804869:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80486d:	20 66 72             	and    %ah,0x72(%rsi)
+  804870:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804875:	61                   	(bad)
+  804876:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804879:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80487a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80487b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80487f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804882:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804883:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804884:	20 6d 61             	and    %ch,0x61(%rbp)
+  804887:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804888:	79 20                	jns    8048aa <__rodata_start+0x2b2>
+  80488a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804891:	72 65                	jb     8048f8 <__rodata_start+0x300>
+  804893:	20 6f 70             	and    %ch,0x70(%rdi)
+  804896:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804898:	00 66 69             	add    %ah,0x69(%rsi)
+  80489b:	6c                   	insb   (%dx),%es:(%rdi)
+  80489c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8048a0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8048a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048a4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8048a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048a9:	74 20                	je     8048cb <__rodata_start+0x2d3>
+  8048ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048ad:	75 6e                	jne    80491d <__rodata_start+0x325>
+  8048af:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8048b3:	76 61                	jbe    804916 <__rodata_start+0x31e>
+  8048b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8048b6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8048bd:	00 
+  8048be:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8048c5:	72 65                	jb     80492c <__rodata_start+0x334>
+  8048c7:	61                   	(bad)
+  8048c8:	64 79 20             	fs jns 8048eb <__rodata_start+0x2f3>
+  8048cb:	65 78 69             	gs js  804937 <__rodata_start+0x33f>
+  8048ce:	73 74                	jae    804944 <__rodata_start+0x34c>
+  8048d0:	73 00                	jae    8048d2 <__rodata_start+0x2da>
+  8048d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048d3:	70 65                	jo     80493a <__rodata_start+0x342>
+  8048d5:	72 61                	jb     804938 <__rodata_start+0x340>
+  8048d7:	74 69                	je     804942 <__rodata_start+0x34a>
+  8048d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048db:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8048de:	74 20                	je     804900 <__rodata_start+0x308>
+  8048e0:	73 75                	jae    804957 <__rodata_start+0x35f>
+  8048e2:	70 70                	jo     804954 <__rodata_start+0x35c>
+  8048e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e5:	72 74                	jb     80495b <__rodata_start+0x363>
+  8048e7:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  8048ed:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  8048f2:	74 00                	je     8048f4 <__rodata_start+0x2fc>
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 90                	xchg   %ax,%ax
+  804900:	eb 10                	jmp    804912 <__rodata_start+0x31a>
+  804902:	80 00 00             	addb   $0x0,(%rax)
+  804905:	00 00                	add    %al,(%rax)
+  804907:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  80490a:	80 00 00             	addb   $0x0,(%rax)
+  80490d:	00 00                	add    %al,(%rax)
+  80490f:	00 1c 17             	add    %bl,(%rdi,%rdx,1)
+  804912:	80 00 00             	addb   $0x0,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  80491a:	80 00 00             	addb   $0x0,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804922:	80 00 00             	addb   $0x0,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  80492a:	80 00 00             	addb   $0x0,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804932:	80 00 00             	addb   $0x0,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 0a                	add    %cl,(%rdx)
+  804939:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80493f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804942:	80 00 00             	addb   $0x0,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  80494a:	80 00 00             	addb   $0x0,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 fe                	add    %bh,%dh
+  804951:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  804957:	00 78 11             	add    %bh,0x11(%rax)
+  80495a:	80 00 00             	addb   $0x0,(%rax)
+  80495d:	00 00                	add    %al,(%rax)
+  80495f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804962:	80 00 00             	addb   $0x0,(%rax)
+  804965:	00 00                	add    %al,(%rax)
+  804967:	00 fe                	add    %bh,%dh
+  804969:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  80496f:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  804973:	00 00                	add    %al,(%rax)
+  804975:	00 00                	add    %al,(%rax)
+  804977:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  80497b:	00 00                	add    %al,(%rax)
+  80497d:	00 00                	add    %al,(%rax)
+  80497f:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  804983:	00 00                	add    %al,(%rax)
+  804985:	00 00                	add    %al,(%rax)
+  804987:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  80498b:	00 00                	add    %al,(%rax)
+  80498d:	00 00                	add    %al,(%rax)
+  80498f:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  804993:	00 00                	add    %al,(%rax)
+  804995:	00 00                	add    %al,(%rax)
+  804997:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  80499b:	00 00                	add    %al,(%rax)
+  80499d:	00 00                	add    %al,(%rax)
+  80499f:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  8049a3:	00 00                	add    %al,(%rax)
+  8049a5:	00 00                	add    %al,(%rax)
+  8049a7:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  8049ab:	00 00                	add    %al,(%rax)
+  8049ad:	00 00                	add    %al,(%rax)
+  8049af:	00 44 11 80          	add    %al,-0x80(%rcx,%rdx,1)
+  8049b3:	00 00                	add    %al,(%rax)
+  8049b5:	00 00                	add    %al,(%rax)
+  8049b7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049ba:	80 00 00             	addb   $0x0,(%rax)
+  8049bd:	00 00                	add    %al,(%rax)
+  8049bf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049c2:	80 00 00             	addb   $0x0,(%rax)
+  8049c5:	00 00                	add    %al,(%rax)
+  8049c7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049ca:	80 00 00             	addb   $0x0,(%rax)
+  8049cd:	00 00                	add    %al,(%rax)
+  8049cf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049d2:	80 00 00             	addb   $0x0,(%rax)
+  8049d5:	00 00                	add    %al,(%rax)
+  8049d7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049da:	80 00 00             	addb   $0x0,(%rax)
+  8049dd:	00 00                	add    %al,(%rax)
+  8049df:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049e2:	80 00 00             	addb   $0x0,(%rax)
+  8049e5:	00 00                	add    %al,(%rax)
+  8049e7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049ea:	80 00 00             	addb   $0x0,(%rax)
+  8049ed:	00 00                	add    %al,(%rax)
+  8049ef:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049f2:	80 00 00             	addb   $0x0,(%rax)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  8049fa:	80 00 00             	addb   $0x0,(%rax)
+  8049fd:	00 00                	add    %al,(%rax)
+  8049ff:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a02:	80 00 00             	addb   $0x0,(%rax)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a0a:	80 00 00             	addb   $0x0,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a12:	80 00 00             	addb   $0x0,(%rax)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a1a:	80 00 00             	addb   $0x0,(%rax)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a22:	80 00 00             	addb   $0x0,(%rax)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a2a:	80 00 00             	addb   $0x0,(%rax)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a32:	80 00 00             	addb   $0x0,(%rax)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a3a:	80 00 00             	addb   $0x0,(%rax)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a42:	80 00 00             	addb   $0x0,(%rax)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a4a:	80 00 00             	addb   $0x0,(%rax)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a52:	80 00 00             	addb   $0x0,(%rax)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a5a:	80 00 00             	addb   $0x0,(%rax)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a62:	80 00 00             	addb   $0x0,(%rax)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a6a:	80 00 00             	addb   $0x0,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a72:	80 00 00             	addb   $0x0,(%rax)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a7a:	80 00 00             	addb   $0x0,(%rax)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a82:	80 00 00             	addb   $0x0,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a8a:	80 00 00             	addb   $0x0,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a92:	80 00 00             	addb   $0x0,(%rax)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804a9a:	80 00 00             	addb   $0x0,(%rax)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804aa2:	80 00 00             	addb   $0x0,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 4f 16             	add    %cl,0x16(%rdi)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ab2:	80 00 00             	addb   $0x0,(%rax)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804aba:	80 00 00             	addb   $0x0,(%rax)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ac2:	80 00 00             	addb   $0x0,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ad2:	80 00 00             	addb   $0x0,(%rax)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ada:	80 00 00             	addb   $0x0,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804af2:	80 00 00             	addb   $0x0,(%rax)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804afa:	80 00 00             	addb   $0x0,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 9b 11 80 00 00    	add    %bl,0x8011(%rbx)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 6a 13             	add    %ch,0x13(%rdx)
+  804b0a:	80 00 00             	addb   $0x0,(%rax)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b1a:	80 00 00             	addb   $0x0,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b22:	80 00 00             	addb   $0x0,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 ca                	add    %cl,%dl
+  804b31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  804b37:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b3a:	80 00 00             	addb   $0x0,(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b42:	80 00 00             	addb   $0x0,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 90 11 80 00 00    	add    %dl,0x8011(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b52:	80 00 00             	addb   $0x0,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b5a:	80 00 00             	addb   $0x0,(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 12                	add    %dl,(%rdx)
+  804b61:	15 80 00 00 00       	adc    $0x80,%eax
+  804b66:	00 00                	add    %al,(%rax)
+  804b68:	dc 15 80 00 00 00    	fcoml  0x80(%rip)        # 804bee <error_string+0x2e>
+  804b6e:	00 00                	add    %al,(%rax)
+  804b70:	2c 17                	sub    $0x17,%al
+  804b72:	80 00 00             	addb   $0x0,(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b7a:	80 00 00             	addb   $0x0,(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 61 12             	add    %ah,0x12(%rcx)
+  804b82:	80 00 00             	addb   $0x0,(%rax)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b8a:	80 00 00             	addb   $0x0,(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 3e                	add    %bh,(%rsi)
+  804b91:	14 80                	adc    $0x80,%al
+  804b93:	00 00                	add    %al,(%rax)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804b9a:	80 00 00             	addb   $0x0,(%rax)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804ba2:	80 00 00             	addb   $0x0,(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 4f 16             	add    %cl,0x16(%rdi)
+  804baa:	80 00 00             	addb   $0x0,(%rax)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 2c 17             	add    %ch,(%rdi,%rdx,1)
+  804bb2:	80 00 00             	addb   $0x0,(%rax)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 f4                	add    %dh,%ah
+  804bb9:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+	...
+
+0000000000804bc0 <error_string>:
+	...
+  804bc8:	8d 47 80 00 00 00 00 00 9f 47 80 00 00 00 00 00     .G.......G......
+  804bd8:	af 47 80 00 00 00 00 00 c1 47 80 00 00 00 00 00     .G.......G......
+  804be8:	cf 47 80 00 00 00 00 00 e3 47 80 00 00 00 00 00     .G.......G......
+  804bf8:	f8 47 80 00 00 00 00 00 0b 48 80 00 00 00 00 00     .G.......H......
+  804c08:	1d 48 80 00 00 00 00 00 31 48 80 00 00 00 00 00     .H......1H......
+  804c18:	41 48 80 00 00 00 00 00 54 48 80 00 00 00 00 00     AH......TH......
+  804c28:	6b 48 80 00 00 00 00 00 81 48 80 00 00 00 00 00     kH.......H......
+  804c38:	99 48 80 00 00 00 00 00 b1 48 80 00 00 00 00 00     .H.......H......
+  804c48:	be 48 80 00 00 00 00 00 68 4c 80 00 00 00 00 00     .H......hL......
+  804c58:	d2 48 80 00 00 00 00 00 ea 48 80 00 00 00 00 00     .H.......H......
+  804c68:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c78:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c88:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c98:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804ca8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804cb8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804cc8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804cd8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804ce8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804cf8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804d08:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804d18:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804d28:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  804d38:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  804d48:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804d58:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804d68:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804d78:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804d88:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804d98:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804da8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804db8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804dc8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804dd8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804de0 <devtab>:
+  804de0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804df0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804e00:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804e10:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804e20:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804e30:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804e40:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  804e50:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e60:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
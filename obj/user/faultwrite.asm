@@ -0,0 +1,6616 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	41 89 fd             	mov    %edi,%r13d
+  80003f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800042:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800053:	00 00 00 
+  800056:	48 39 c2             	cmp    %rax,%rdx
+  800059:	73 17                	jae    800072 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80005b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	49 89 c4             	mov    %rax,%r12
+  800061:	48 83 c3 08          	add    $0x8,%rbx
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	ff 53 f8             	call   *-0x8(%rbx)
+  80006d:	4c 39 e3             	cmp    %r12,%rbx
+  800070:	72 ef                	jb     800061 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800072:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+  80007e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800083:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800087:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80008b:	48 c1 e0 04          	shl    $0x4,%rax
+  80008f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800096:	00 00 00 
+  800099:	48 01 d0             	add    %rdx,%rax
+  80009c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000a3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a6:	45 85 ed             	test   %r13d,%r13d
+  8000a9:	7e 0d                	jle    8000b8 <libmain+0x87>
+  8000ab:	49 8b 06             	mov    (%r14),%rax
+  8000ae:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b8:	4c 89 f6             	mov    %r14,%rsi
+  8000bb:	44 89 ef             	mov    %r13d,%edi
+  8000be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ca:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+#endif
+}
+  8000d6:	5b                   	pop    %rbx
+  8000d7:	41 5c                	pop    %r12
+  8000d9:	41 5d                	pop    %r13
+  8000db:	41 5e                	pop    %r14
+  8000dd:	5d                   	pop    %rbp
+  8000de:	c3                   	ret
+
+00000000008000df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e3:	48 b8 81 08 80 00 00 	movabs $0x800881,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f4:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+}
+  800100:	5d                   	pop    %rbp
+  800101:	c3                   	ret
+
+0000000000800102 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800102:	55                   	push   %rbp
+  800103:	48 89 e5             	mov    %rsp,%rbp
+  800106:	53                   	push   %rbx
+  800107:	48 89 fa             	mov    %rdi,%rdx
+  80010a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800117:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80011c:	be 00 00 00 00       	mov    $0x0,%esi
+  800121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800127:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80012d:	c9                   	leave
+  80012e:	c3                   	ret
+
+000000000080012f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800134:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80014d:	be 00 00 00 00       	mov    $0x0,%esi
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800158:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80015a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+0000000000800160 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	53                   	push   %rbx
+  800165:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800169:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80016c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800171:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80017b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800180:	be 00 00 00 00       	mov    $0x0,%esi
+  800185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80018b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80018d:	48 85 c0             	test   %rax,%rax
+  800190:	7f 06                	jg     800198 <sys_env_destroy+0x38>
+}
+  800192:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800198:	49 89 c0             	mov    %rax,%r8
+  80019b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a0:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8001a7:	00 00 00 
+  8001aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8001af:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8001b6:	00 00 00 
+  8001b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001be:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  8001c5:	00 00 00 
+  8001c8:	41 ff d1             	call   *%r9
+
+00000000008001cb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001d0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001f4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fa:	c9                   	leave
+  8001fb:	c3                   	ret
+
+00000000008001fc <sys_yield>:
+
+void
+sys_yield(void) {
+  8001fc:	55                   	push   %rbp
+  8001fd:	48 89 e5             	mov    %rsp,%rbp
+  800200:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800201:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800215:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021a:	be 00 00 00 00       	mov    $0x0,%esi
+  80021f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800225:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800227:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+000000000080022d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80022d:	55                   	push   %rbp
+  80022e:	48 89 e5             	mov    %rsp,%rbp
+  800231:	53                   	push   %rbx
+  800232:	48 89 fa             	mov    %rdi,%rdx
+  800235:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800238:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800244:	00 00 00 
+  800247:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80024c:	be 00 00 00 00       	mov    $0x0,%esi
+  800251:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800257:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800259:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+000000000080025f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+  800263:	53                   	push   %rbx
+  800264:	49 89 f8             	mov    %rdi,%r8
+  800267:	48 89 d3             	mov    %rdx,%rbx
+  80026a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80026d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800272:	4c 89 c2             	mov    %r8,%rdx
+  800275:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800278:	be 00 00 00 00       	mov    $0x0,%esi
+  80027d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800283:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800285:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+
+000000000080028b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80028b:	55                   	push   %rbp
+  80028c:	48 89 e5             	mov    %rsp,%rbp
+  80028f:	53                   	push   %rbx
+  800290:	48 83 ec 08          	sub    $0x8,%rsp
+  800294:	89 f8                	mov    %edi,%eax
+  800296:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800299:	48 63 f9             	movslq %ecx,%rdi
+  80029c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002b4:	48 85 c0             	test   %rax,%rax
+  8002b7:	7f 06                	jg     8002bf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002bf:	49 89 c0             	mov    %rax,%r8
+  8002c2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c7:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002d6:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	53                   	push   %rbx
+  8002f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002fb:	89 f8                	mov    %edi,%eax
+  8002fd:	49 89 f2             	mov    %rsi,%r10
+  800300:	48 89 cf             	mov    %rcx,%rdi
+  800303:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800306:	48 63 da             	movslq %edx,%rbx
+  800309:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80030c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800311:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800314:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800317:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800319:	48 85 c0             	test   %rax,%rax
+  80031c:	7f 06                	jg     800324 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80031e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800324:	49 89 c0             	mov    %rax,%r8
+  800327:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80032c:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800333:	00 00 00 
+  800336:	be 26 00 00 00       	mov    $0x26,%esi
+  80033b:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  800351:	00 00 00 
+  800354:	41 ff d1             	call   *%r9
+
+0000000000800357 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800357:	55                   	push   %rbp
+  800358:	48 89 e5             	mov    %rsp,%rbp
+  80035b:	53                   	push   %rbx
+  80035c:	48 83 ec 08          	sub    $0x8,%rsp
+  800360:	48 89 f1             	mov    %rsi,%rcx
+  800363:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800366:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800369:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80036e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800373:	be 00 00 00 00       	mov    $0x0,%esi
+  800378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80037e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800380:	48 85 c0             	test   %rax,%rax
+  800383:	7f 06                	jg     80038b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800385:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800389:	c9                   	leave
+  80038a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80038b:	49 89 c0             	mov    %rax,%r8
+  80038e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800393:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  80039a:	00 00 00 
+  80039d:	be 26 00 00 00       	mov    $0x26,%esi
+  8003a2:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8003a9:	00 00 00 
+  8003ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b1:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  8003b8:	00 00 00 
+  8003bb:	41 ff d1             	call   *%r9
+
+00000000008003be <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	53                   	push   %rbx
+  8003c3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003c7:	48 63 ce             	movslq %esi,%rcx
+  8003ca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003cd:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e9:	48 85 c0             	test   %rax,%rax
+  8003ec:	7f 06                	jg     8003f4 <sys_env_set_status+0x36>
+}
+  8003ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f2:	c9                   	leave
+  8003f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003f4:	49 89 c0             	mov    %rax,%r8
+  8003f7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8003fc:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800403:	00 00 00 
+  800406:	be 26 00 00 00       	mov    $0x26,%esi
+  80040b:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800412:	00 00 00 
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  800421:	00 00 00 
+  800424:	41 ff d1             	call   *%r9
+
+0000000000800427 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800427:	55                   	push   %rbp
+  800428:	48 89 e5             	mov    %rsp,%rbp
+  80042b:	53                   	push   %rbx
+  80042c:	48 83 ec 08          	sub    $0x8,%rsp
+  800430:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800433:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800436:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80043b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800445:	be 00 00 00 00       	mov    $0x0,%esi
+  80044a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800450:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800452:	48 85 c0             	test   %rax,%rax
+  800455:	7f 06                	jg     80045d <sys_env_set_trapframe+0x36>
+}
+  800457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80045d:	49 89 c0             	mov    %rax,%r8
+  800460:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800465:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  80046c:	00 00 00 
+  80046f:	be 26 00 00 00       	mov    $0x26,%esi
+  800474:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  80047b:	00 00 00 
+  80047e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800483:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  80048a:	00 00 00 
+  80048d:	41 ff d1             	call   *%r9
+
+0000000000800490 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800490:	55                   	push   %rbp
+  800491:	48 89 e5             	mov    %rsp,%rbp
+  800494:	53                   	push   %rbx
+  800495:	48 83 ec 08          	sub    $0x8,%rsp
+  800499:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80049c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004bb:	48 85 c0             	test   %rax,%rax
+  8004be:	7f 06                	jg     8004c6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8004c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c4:	c9                   	leave
+  8004c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c6:	49 89 c0             	mov    %rax,%r8
+  8004c9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004ce:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8004d5:	00 00 00 
+  8004d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8004dd:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8004e4:	00 00 00 
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  8004f3:	00 00 00 
+  8004f6:	41 ff d1             	call   *%r9
+
+00000000008004f9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004f9:	55                   	push   %rbp
+  8004fa:	48 89 e5             	mov    %rsp,%rbp
+  8004fd:	53                   	push   %rbx
+  8004fe:	89 f8                	mov    %edi,%eax
+  800500:	49 89 f1             	mov    %rsi,%r9
+  800503:	48 89 d3             	mov    %rdx,%rbx
+  800506:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800509:	49 63 f0             	movslq %r8d,%rsi
+  80050c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80050f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800514:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051d:	cd 30                	int    $0x30
+}
+  80051f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800523:	c9                   	leave
+  800524:	c3                   	ret
+
+0000000000800525 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800525:	55                   	push   %rbp
+  800526:	48 89 e5             	mov    %rsp,%rbp
+  800529:	53                   	push   %rbx
+  80052a:	48 83 ec 08          	sub    $0x8,%rsp
+  80052e:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800531:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800534:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800539:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80053c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800541:	be 00 00 00 00       	mov    $0x0,%esi
+  800546:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80054c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80054e:	48 85 c0             	test   %rax,%rax
+  800551:	7f 06                	jg     800559 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800553:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800559:	49 89 c0             	mov    %rax,%r8
+  80055c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800561:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800568:	00 00 00 
+  80056b:	be 26 00 00 00       	mov    $0x26,%esi
+  800570:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800577:	00 00 00 
+  80057a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057f:	49 b9 ec 24 80 00 00 	movabs $0x8024ec,%r9
+  800586:	00 00 00 
+  800589:	41 ff d1             	call   *%r9
+
+000000000080058c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80058c:	55                   	push   %rbp
+  80058d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  800590:	ba 00 00 00 00       	mov    $0x0,%edx
+  800595:	48 b8 25 05 80 00 00 	movabs $0x800525,%rax
+  80059c:	00 00 00 
+  80059f:	ff d0                	call   *%rax
+}
+  8005a1:	5d                   	pop    %rbp
+  8005a2:	c3                   	ret
+
+00000000008005a3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005cc:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d2:	c9                   	leave
+  8005d3:	c3                   	ret
+
+00000000008005d4 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005d4:	55                   	push   %rbp
+  8005d5:	48 89 e5             	mov    %rsp,%rbp
+  8005d8:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005d9:	48 63 ce             	movslq %esi,%rcx
+  8005dc:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fa:	cd 30                	int    $0x30
+}
+  8005fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800600:	c9                   	leave
+  800601:	c3                   	ret
+
+0000000000800602 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800602:	55                   	push   %rbp
+  800603:	48 89 e5             	mov    %rsp,%rbp
+  800606:	53                   	push   %rbx
+  800607:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80060a:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80060e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800613:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800618:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80061d:	be 00 00 00 00       	mov    $0x0,%esi
+  800622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800628:	cd 30                	int    $0x30
+}
+  80062a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80062e:	c9                   	leave
+  80062f:	c3                   	ret
+
+0000000000800630 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800630:	55                   	push   %rbp
+  800631:	48 89 e5             	mov    %rsp,%rbp
+  800634:	53                   	push   %rbx
+  800635:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800638:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80063b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800640:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800648:	be 00 00 00 00       	mov    $0x0,%esi
+  80064d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800653:	cd 30                	int    $0x30
+}
+  800655:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800659:	c9                   	leave
+  80065a:	c3                   	ret
+
+000000000080065b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80065b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800662:	ff ff ff 
+  800665:	48 01 f8             	add    %rdi,%rax
+  800668:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80066c:	c3                   	ret
+
+000000000080066d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80066d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800674:	ff ff ff 
+  800677:	48 01 f8             	add    %rdi,%rax
+  80067a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80067e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800684:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800688:	c3                   	ret
+
+0000000000800689 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800689:	55                   	push   %rbp
+  80068a:	48 89 e5             	mov    %rsp,%rbp
+  80068d:	41 57                	push   %r15
+  80068f:	41 56                	push   %r14
+  800691:	41 55                	push   %r13
+  800693:	41 54                	push   %r12
+  800695:	53                   	push   %rbx
+  800696:	48 83 ec 08          	sub    $0x8,%rsp
+  80069a:	49 89 ff             	mov    %rdi,%r15
+  80069d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006a2:	49 bd a8 21 80 00 00 	movabs $0x8021a8,%r13
+  8006a9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006ac:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006b2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b5:	48 89 df             	mov    %rbx,%rdi
+  8006b8:	41 ff d5             	call   *%r13
+  8006bb:	83 e0 04             	and    $0x4,%eax
+  8006be:	74 17                	je     8006d7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006c0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006c7:	4c 39 f3             	cmp    %r14,%rbx
+  8006ca:	75 e6                	jne    8006b2 <fd_alloc+0x29>
+  8006cc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006d2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006d7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006da:	48 83 c4 08          	add    $0x8,%rsp
+  8006de:	5b                   	pop    %rbx
+  8006df:	41 5c                	pop    %r12
+  8006e1:	41 5d                	pop    %r13
+  8006e3:	41 5e                	pop    %r14
+  8006e5:	41 5f                	pop    %r15
+  8006e7:	5d                   	pop    %rbp
+  8006e8:	c3                   	ret
+
+00000000008006e9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e9:	83 ff 1f             	cmp    $0x1f,%edi
+  8006ec:	77 39                	ja     800727 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006ee:	55                   	push   %rbp
+  8006ef:	48 89 e5             	mov    %rsp,%rbp
+  8006f2:	41 54                	push   %r12
+  8006f4:	53                   	push   %rbx
+  8006f5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8006f8:	48 63 df             	movslq %edi,%rbx
+  8006fb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800702:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800706:	48 89 df             	mov    %rbx,%rdi
+  800709:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  800710:	00 00 00 
+  800713:	ff d0                	call   *%rax
+  800715:	a8 04                	test   $0x4,%al
+  800717:	74 14                	je     80072d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800719:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800722:	5b                   	pop    %rbx
+  800723:	41 5c                	pop    %r12
+  800725:	5d                   	pop    %rbp
+  800726:	c3                   	ret
+        return -E_INVAL;
+  800727:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80072c:	c3                   	ret
+        return -E_INVAL;
+  80072d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800732:	eb ee                	jmp    800722 <fd_lookup+0x39>
+
+0000000000800734 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800734:	55                   	push   %rbp
+  800735:	48 89 e5             	mov    %rsp,%rbp
+  800738:	41 54                	push   %r12
+  80073a:	53                   	push   %rbx
+  80073b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80073e:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  800745:	00 00 00 
+  800748:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80074f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800752:	39 3b                	cmp    %edi,(%rbx)
+  800754:	74 47                	je     80079d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800756:	48 83 c0 08          	add    $0x8,%rax
+  80075a:	48 8b 18             	mov    (%rax),%rbx
+  80075d:	48 85 db             	test   %rbx,%rbx
+  800760:	75 f0                	jne    800752 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800762:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800769:	00 00 00 
+  80076c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800772:	89 fa                	mov    %edi,%edx
+  800774:	48 bf c0 36 80 00 00 	movabs $0x8036c0,%rdi
+  80077b:	00 00 00 
+  80077e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800783:	48 b9 3c 26 80 00 00 	movabs $0x80263c,%rcx
+  80078a:	00 00 00 
+  80078d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80078f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800794:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800798:	5b                   	pop    %rbx
+  800799:	41 5c                	pop    %r12
+  80079b:	5d                   	pop    %rbp
+  80079c:	c3                   	ret
+            return 0;
+  80079d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a2:	eb f0                	jmp    800794 <dev_lookup+0x60>
+
+00000000008007a4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007a4:	55                   	push   %rbp
+  8007a5:	48 89 e5             	mov    %rsp,%rbp
+  8007a8:	41 55                	push   %r13
+  8007aa:	41 54                	push   %r12
+  8007ac:	53                   	push   %rbx
+  8007ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8007b1:	48 89 fb             	mov    %rdi,%rbx
+  8007b4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007b7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007be:	ff ff ff 
+  8007c1:	48 01 df             	add    %rbx,%rdi
+  8007c4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007cc:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  8007d3:	00 00 00 
+  8007d6:	ff d0                	call   *%rax
+  8007d8:	41 89 c5             	mov    %eax,%r13d
+  8007db:	85 c0                	test   %eax,%eax
+  8007dd:	78 06                	js     8007e5 <fd_close+0x41>
+  8007df:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007e3:	74 1a                	je     8007ff <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007e5:	45 84 e4             	test   %r12b,%r12b
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007f1:	44 89 e8             	mov    %r13d,%eax
+  8007f4:	48 83 c4 18          	add    $0x18,%rsp
+  8007f8:	5b                   	pop    %rbx
+  8007f9:	41 5c                	pop    %r12
+  8007fb:	41 5d                	pop    %r13
+  8007fd:	5d                   	pop    %rbp
+  8007fe:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007ff:	8b 3b                	mov    (%rbx),%edi
+  800801:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800805:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  80080c:	00 00 00 
+  80080f:	ff d0                	call   *%rax
+  800811:	41 89 c5             	mov    %eax,%r13d
+  800814:	85 c0                	test   %eax,%eax
+  800816:	78 1b                	js     800833 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800818:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80081c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800820:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800826:	48 85 c0             	test   %rax,%rax
+  800829:	74 08                	je     800833 <fd_close+0x8f>
+  80082b:	48 89 df             	mov    %rbx,%rdi
+  80082e:	ff d0                	call   *%rax
+  800830:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800833:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800838:	48 89 de             	mov    %rbx,%rsi
+  80083b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800840:	48 b8 57 03 80 00 00 	movabs $0x800357,%rax
+  800847:	00 00 00 
+  80084a:	ff d0                	call   *%rax
+    return res;
+  80084c:	eb a3                	jmp    8007f1 <fd_close+0x4d>
+
+000000000080084e <close>:
+
+int
+close(int fdnum) {
+  80084e:	55                   	push   %rbp
+  80084f:	48 89 e5             	mov    %rsp,%rbp
+  800852:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800856:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80085a:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800861:	00 00 00 
+  800864:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800866:	85 c0                	test   %eax,%eax
+  800868:	78 15                	js     80087f <close+0x31>
+
+    return fd_close(fd, 1);
+  80086a:	be 01 00 00 00       	mov    $0x1,%esi
+  80086f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800873:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  80087a:	00 00 00 
+  80087d:	ff d0                	call   *%rax
+}
+  80087f:	c9                   	leave
+  800880:	c3                   	ret
+
+0000000000800881 <close_all>:
+
+void
+close_all(void) {
+  800881:	55                   	push   %rbp
+  800882:	48 89 e5             	mov    %rsp,%rbp
+  800885:	41 54                	push   %r12
+  800887:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800888:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80088d:	49 bc 4e 08 80 00 00 	movabs $0x80084e,%r12
+  800894:	00 00 00 
+  800897:	89 df                	mov    %ebx,%edi
+  800899:	41 ff d4             	call   *%r12
+  80089c:	83 c3 01             	add    $0x1,%ebx
+  80089f:	83 fb 20             	cmp    $0x20,%ebx
+  8008a2:	75 f3                	jne    800897 <close_all+0x16>
+}
+  8008a4:	5b                   	pop    %rbx
+  8008a5:	41 5c                	pop    %r12
+  8008a7:	5d                   	pop    %rbp
+  8008a8:	c3                   	ret
+
+00000000008008a9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008a9:	55                   	push   %rbp
+  8008aa:	48 89 e5             	mov    %rsp,%rbp
+  8008ad:	41 57                	push   %r15
+  8008af:	41 56                	push   %r14
+  8008b1:	41 55                	push   %r13
+  8008b3:	41 54                	push   %r12
+  8008b5:	53                   	push   %rbx
+  8008b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8008ba:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008bd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008c1:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  8008c8:	00 00 00 
+  8008cb:	ff d0                	call   *%rax
+  8008cd:	89 c3                	mov    %eax,%ebx
+  8008cf:	85 c0                	test   %eax,%eax
+  8008d1:	0f 88 b8 00 00 00    	js     80098f <dup+0xe6>
+    close(newfdnum);
+  8008d7:	44 89 e7             	mov    %r12d,%edi
+  8008da:	48 b8 4e 08 80 00 00 	movabs $0x80084e,%rax
+  8008e1:	00 00 00 
+  8008e4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008e6:	4d 63 ec             	movslq %r12d,%r13
+  8008e9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008f0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8008f4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8008f8:	4c 89 ff             	mov    %r15,%rdi
+  8008fb:	49 be 6d 06 80 00 00 	movabs $0x80066d,%r14
+  800902:	00 00 00 
+  800905:	41 ff d6             	call   *%r14
+  800908:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80090b:	4c 89 ef             	mov    %r13,%rdi
+  80090e:	41 ff d6             	call   *%r14
+  800911:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800914:	48 89 df             	mov    %rbx,%rdi
+  800917:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800923:	a8 04                	test   $0x4,%al
+  800925:	74 2b                	je     800952 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800927:	41 89 c1             	mov    %eax,%r9d
+  80092a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800930:	4c 89 f1             	mov    %r14,%rcx
+  800933:	ba 00 00 00 00       	mov    $0x0,%edx
+  800938:	48 89 de             	mov    %rbx,%rsi
+  80093b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800940:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  800947:	00 00 00 
+  80094a:	ff d0                	call   *%rax
+  80094c:	89 c3                	mov    %eax,%ebx
+  80094e:	85 c0                	test   %eax,%eax
+  800950:	78 4e                	js     8009a0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800952:	4c 89 ff             	mov    %r15,%rdi
+  800955:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  80095c:	00 00 00 
+  80095f:	ff d0                	call   *%rax
+  800961:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800964:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80096a:	4c 89 e9             	mov    %r13,%rcx
+  80096d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800972:	4c 89 fe             	mov    %r15,%rsi
+  800975:	bf 00 00 00 00       	mov    $0x0,%edi
+  80097a:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  800981:	00 00 00 
+  800984:	ff d0                	call   *%rax
+  800986:	89 c3                	mov    %eax,%ebx
+  800988:	85 c0                	test   %eax,%eax
+  80098a:	78 14                	js     8009a0 <dup+0xf7>
+
+    return newfdnum;
+  80098c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80098f:	89 d8                	mov    %ebx,%eax
+  800991:	48 83 c4 18          	add    $0x18,%rsp
+  800995:	5b                   	pop    %rbx
+  800996:	41 5c                	pop    %r12
+  800998:	41 5d                	pop    %r13
+  80099a:	41 5e                	pop    %r14
+  80099c:	41 5f                	pop    %r15
+  80099e:	5d                   	pop    %rbp
+  80099f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009a5:	4c 89 ee             	mov    %r13,%rsi
+  8009a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ad:	49 bc 57 03 80 00 00 	movabs $0x800357,%r12
+  8009b4:	00 00 00 
+  8009b7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009bf:	4c 89 f6             	mov    %r14,%rsi
+  8009c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c7:	41 ff d4             	call   *%r12
+    return res;
+  8009ca:	eb c3                	jmp    80098f <dup+0xe6>
+
+00000000008009cc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009cc:	55                   	push   %rbp
+  8009cd:	48 89 e5             	mov    %rsp,%rbp
+  8009d0:	41 56                	push   %r14
+  8009d2:	41 55                	push   %r13
+  8009d4:	41 54                	push   %r12
+  8009d6:	53                   	push   %rbx
+  8009d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8009db:	89 fb                	mov    %edi,%ebx
+  8009dd:	49 89 f4             	mov    %rsi,%r12
+  8009e0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009e3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009e7:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  8009ee:	00 00 00 
+  8009f1:	ff d0                	call   *%rax
+  8009f3:	85 c0                	test   %eax,%eax
+  8009f5:	78 4c                	js     800a43 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8009f7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8009fb:	41 8b 3e             	mov    (%r14),%edi
+  8009fe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a02:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800a09:	00 00 00 
+  800a0c:	ff d0                	call   *%rax
+  800a0e:	85 c0                	test   %eax,%eax
+  800a10:	78 35                	js     800a47 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a12:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a16:	83 e0 03             	and    $0x3,%eax
+  800a19:	83 f8 01             	cmp    $0x1,%eax
+  800a1c:	74 2d                	je     800a4b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a22:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a26:	48 85 c0             	test   %rax,%rax
+  800a29:	74 56                	je     800a81 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a2b:	4c 89 ea             	mov    %r13,%rdx
+  800a2e:	4c 89 e6             	mov    %r12,%rsi
+  800a31:	4c 89 f7             	mov    %r14,%rdi
+  800a34:	ff d0                	call   *%rax
+}
+  800a36:	48 83 c4 10          	add    $0x10,%rsp
+  800a3a:	5b                   	pop    %rbx
+  800a3b:	41 5c                	pop    %r12
+  800a3d:	41 5d                	pop    %r13
+  800a3f:	41 5e                	pop    %r14
+  800a41:	5d                   	pop    %rbp
+  800a42:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a43:	48 98                	cltq
+  800a45:	eb ef                	jmp    800a36 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a47:	48 98                	cltq
+  800a49:	eb eb                	jmp    800a36 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a4b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a52:	00 00 00 
+  800a55:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a5b:	89 da                	mov    %ebx,%edx
+  800a5d:	48 bf 21 37 80 00 00 	movabs $0x803721,%rdi
+  800a64:	00 00 00 
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	48 b9 3c 26 80 00 00 	movabs $0x80263c,%rcx
+  800a73:	00 00 00 
+  800a76:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a78:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a7f:	eb b5                	jmp    800a36 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a81:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a88:	eb ac                	jmp    800a36 <read+0x6a>
+
+0000000000800a8a <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a8a:	55                   	push   %rbp
+  800a8b:	48 89 e5             	mov    %rsp,%rbp
+  800a8e:	41 56                	push   %r14
+  800a90:	41 55                	push   %r13
+  800a92:	41 54                	push   %r12
+  800a94:	53                   	push   %rbx
+  800a95:	48 83 ec 10          	sub    $0x10,%rsp
+  800a99:	89 fb                	mov    %edi,%ebx
+  800a9b:	49 89 f4             	mov    %rsi,%r12
+  800a9e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aa1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800aa5:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800aac:	00 00 00 
+  800aaf:	ff d0                	call   *%rax
+  800ab1:	85 c0                	test   %eax,%eax
+  800ab3:	78 41                	js     800af6 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ab5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ab9:	41 8b 3e             	mov    (%r14),%edi
+  800abc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ac0:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800ac7:	00 00 00 
+  800aca:	ff d0                	call   *%rax
+  800acc:	85 c0                	test   %eax,%eax
+  800ace:	78 35                	js     800b05 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ad0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ad4:	83 e0 03             	and    $0x3,%eax
+  800ad7:	83 f8 01             	cmp    $0x1,%eax
+  800ada:	74 2d                	je     800b09 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800adc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ae0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800ae4:	48 85 c0             	test   %rax,%rax
+  800ae7:	74 56                	je     800b3f <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800ae9:	4c 89 ea             	mov    %r13,%rdx
+  800aec:	4c 89 e6             	mov    %r12,%rsi
+  800aef:	4c 89 f7             	mov    %r14,%rdi
+  800af2:	ff d0                	call   *%rax
+  800af4:	eb 02                	jmp    800af8 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800af6:	48 98                	cltq
+}
+  800af8:	48 83 c4 10          	add    $0x10,%rsp
+  800afc:	5b                   	pop    %rbx
+  800afd:	41 5c                	pop    %r12
+  800aff:	41 5d                	pop    %r13
+  800b01:	41 5e                	pop    %r14
+  800b03:	5d                   	pop    %rbp
+  800b04:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b05:	48 98                	cltq
+  800b07:	eb ef                	jmp    800af8 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b09:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b10:	00 00 00 
+  800b13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b19:	89 da                	mov    %ebx,%edx
+  800b1b:	48 bf e0 36 80 00 00 	movabs $0x8036e0,%rdi
+  800b22:	00 00 00 
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	48 b9 3c 26 80 00 00 	movabs $0x80263c,%rcx
+  800b31:	00 00 00 
+  800b34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b36:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b3d:	eb b9                	jmp    800af8 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b3f:	4c 89 ea             	mov    %r13,%rdx
+  800b42:	4c 89 e6             	mov    %r12,%rsi
+  800b45:	89 df                	mov    %ebx,%edi
+  800b47:	48 b8 cc 09 80 00 00 	movabs $0x8009cc,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+  800b53:	eb a3                	jmp    800af8 <readmap+0x6e>
+
+0000000000800b55 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b55:	55                   	push   %rbp
+  800b56:	48 89 e5             	mov    %rsp,%rbp
+  800b59:	41 57                	push   %r15
+  800b5b:	41 56                	push   %r14
+  800b5d:	41 55                	push   %r13
+  800b5f:	41 54                	push   %r12
+  800b61:	53                   	push   %rbx
+  800b62:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b66:	48 85 d2             	test   %rdx,%rdx
+  800b69:	74 54                	je     800bbf <readn+0x6a>
+  800b6b:	41 89 fd             	mov    %edi,%r13d
+  800b6e:	49 89 f6             	mov    %rsi,%r14
+  800b71:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b74:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b79:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b7e:	49 bf cc 09 80 00 00 	movabs $0x8009cc,%r15
+  800b85:	00 00 00 
+  800b88:	4c 89 e2             	mov    %r12,%rdx
+  800b8b:	48 29 f2             	sub    %rsi,%rdx
+  800b8e:	4c 01 f6             	add    %r14,%rsi
+  800b91:	44 89 ef             	mov    %r13d,%edi
+  800b94:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b97:	85 c0                	test   %eax,%eax
+  800b99:	78 20                	js     800bbb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b9b:	01 c3                	add    %eax,%ebx
+  800b9d:	85 c0                	test   %eax,%eax
+  800b9f:	74 08                	je     800ba9 <readn+0x54>
+  800ba1:	48 63 f3             	movslq %ebx,%rsi
+  800ba4:	4c 39 e6             	cmp    %r12,%rsi
+  800ba7:	72 df                	jb     800b88 <readn+0x33>
+    }
+    return res;
+  800ba9:	48 63 c3             	movslq %ebx,%rax
+}
+  800bac:	48 83 c4 08          	add    $0x8,%rsp
+  800bb0:	5b                   	pop    %rbx
+  800bb1:	41 5c                	pop    %r12
+  800bb3:	41 5d                	pop    %r13
+  800bb5:	41 5e                	pop    %r14
+  800bb7:	41 5f                	pop    %r15
+  800bb9:	5d                   	pop    %rbp
+  800bba:	c3                   	ret
+        if (inc < 0) return inc;
+  800bbb:	48 98                	cltq
+  800bbd:	eb ed                	jmp    800bac <readn+0x57>
+    int inc = 1, res = 0;
+  800bbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bc4:	eb e3                	jmp    800ba9 <readn+0x54>
+
+0000000000800bc6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bc6:	55                   	push   %rbp
+  800bc7:	48 89 e5             	mov    %rsp,%rbp
+  800bca:	41 56                	push   %r14
+  800bcc:	41 55                	push   %r13
+  800bce:	41 54                	push   %r12
+  800bd0:	53                   	push   %rbx
+  800bd1:	48 83 ec 10          	sub    $0x10,%rsp
+  800bd5:	89 fb                	mov    %edi,%ebx
+  800bd7:	49 89 f4             	mov    %rsi,%r12
+  800bda:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bdd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800be1:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800be8:	00 00 00 
+  800beb:	ff d0                	call   *%rax
+  800bed:	85 c0                	test   %eax,%eax
+  800bef:	78 47                	js     800c38 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bf1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bf5:	41 8b 3e             	mov    (%r14),%edi
+  800bf8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bfc:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800c03:	00 00 00 
+  800c06:	ff d0                	call   *%rax
+  800c08:	85 c0                	test   %eax,%eax
+  800c0a:	78 30                	js     800c3c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c0c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c11:	74 2d                	je     800c40 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c17:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c1b:	48 85 c0             	test   %rax,%rax
+  800c1e:	74 56                	je     800c76 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c20:	4c 89 ea             	mov    %r13,%rdx
+  800c23:	4c 89 e6             	mov    %r12,%rsi
+  800c26:	4c 89 f7             	mov    %r14,%rdi
+  800c29:	ff d0                	call   *%rax
+}
+  800c2b:	48 83 c4 10          	add    $0x10,%rsp
+  800c2f:	5b                   	pop    %rbx
+  800c30:	41 5c                	pop    %r12
+  800c32:	41 5d                	pop    %r13
+  800c34:	41 5e                	pop    %r14
+  800c36:	5d                   	pop    %rbp
+  800c37:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c38:	48 98                	cltq
+  800c3a:	eb ef                	jmp    800c2b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c3c:	48 98                	cltq
+  800c3e:	eb eb                	jmp    800c2b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c40:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c47:	00 00 00 
+  800c4a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c50:	89 da                	mov    %ebx,%edx
+  800c52:	48 bf 3d 37 80 00 00 	movabs $0x80373d,%rdi
+  800c59:	00 00 00 
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c61:	48 b9 3c 26 80 00 00 	movabs $0x80263c,%rcx
+  800c68:	00 00 00 
+  800c6b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c6d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c74:	eb b5                	jmp    800c2b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c76:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c7d:	eb ac                	jmp    800c2b <write+0x65>
+
+0000000000800c7f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c7f:	55                   	push   %rbp
+  800c80:	48 89 e5             	mov    %rsp,%rbp
+  800c83:	53                   	push   %rbx
+  800c84:	48 83 ec 18          	sub    $0x18,%rsp
+  800c88:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c8e:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800c95:	00 00 00 
+  800c98:	ff d0                	call   *%rax
+  800c9a:	85 c0                	test   %eax,%eax
+  800c9c:	78 0c                	js     800caa <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cae:	c9                   	leave
+  800caf:	c3                   	ret
+
+0000000000800cb0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cb0:	55                   	push   %rbp
+  800cb1:	48 89 e5             	mov    %rsp,%rbp
+  800cb4:	41 55                	push   %r13
+  800cb6:	41 54                	push   %r12
+  800cb8:	53                   	push   %rbx
+  800cb9:	48 83 ec 18          	sub    $0x18,%rsp
+  800cbd:	89 fb                	mov    %edi,%ebx
+  800cbf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cc2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cc6:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800ccd:	00 00 00 
+  800cd0:	ff d0                	call   *%rax
+  800cd2:	85 c0                	test   %eax,%eax
+  800cd4:	78 38                	js     800d0e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cd6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cda:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ce2:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800ce9:	00 00 00 
+  800cec:	ff d0                	call   *%rax
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	78 1c                	js     800d0e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cf2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cf7:	74 20                	je     800d19 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cf9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cfd:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d01:	48 85 c0             	test   %rax,%rax
+  800d04:	74 47                	je     800d4d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d06:	44 89 e6             	mov    %r12d,%esi
+  800d09:	4c 89 ef             	mov    %r13,%rdi
+  800d0c:	ff d0                	call   *%rax
+}
+  800d0e:	48 83 c4 18          	add    $0x18,%rsp
+  800d12:	5b                   	pop    %rbx
+  800d13:	41 5c                	pop    %r12
+  800d15:	41 5d                	pop    %r13
+  800d17:	5d                   	pop    %rbp
+  800d18:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d19:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d20:	00 00 00 
+  800d23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d29:	89 da                	mov    %ebx,%edx
+  800d2b:	48 bf 00 37 80 00 00 	movabs $0x803700,%rdi
+  800d32:	00 00 00 
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3a:	48 b9 3c 26 80 00 00 	movabs $0x80263c,%rcx
+  800d41:	00 00 00 
+  800d44:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d4b:	eb c1                	jmp    800d0e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d4d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d52:	eb ba                	jmp    800d0e <ftruncate+0x5e>
+
+0000000000800d54 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d54:	55                   	push   %rbp
+  800d55:	48 89 e5             	mov    %rsp,%rbp
+  800d58:	41 54                	push   %r12
+  800d5a:	53                   	push   %rbx
+  800d5b:	48 83 ec 10          	sub    $0x10,%rsp
+  800d5f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d62:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d66:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  800d6d:	00 00 00 
+  800d70:	ff d0                	call   *%rax
+  800d72:	85 c0                	test   %eax,%eax
+  800d74:	78 4e                	js     800dc4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d76:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d7a:	41 8b 3c 24          	mov    (%r12),%edi
+  800d7e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d82:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800d89:	00 00 00 
+  800d8c:	ff d0                	call   *%rax
+  800d8e:	85 c0                	test   %eax,%eax
+  800d90:	78 32                	js     800dc4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d96:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800d9b:	74 30                	je     800dcd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d9d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800da0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800da7:	00 00 00 
+    stat->st_isdir = 0;
+  800daa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800db1:	00 00 00 
+    stat->st_dev = dev;
+  800db4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dbb:	48 89 de             	mov    %rbx,%rsi
+  800dbe:	4c 89 e7             	mov    %r12,%rdi
+  800dc1:	ff 50 30             	call   *0x30(%rax)
+}
+  800dc4:	48 83 c4 10          	add    $0x10,%rsp
+  800dc8:	5b                   	pop    %rbx
+  800dc9:	41 5c                	pop    %r12
+  800dcb:	5d                   	pop    %rbp
+  800dcc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dcd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dd2:	eb f0                	jmp    800dc4 <fstat+0x70>
+
+0000000000800dd4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dd4:	55                   	push   %rbp
+  800dd5:	48 89 e5             	mov    %rsp,%rbp
+  800dd8:	41 54                	push   %r12
+  800dda:	53                   	push   %rbx
+  800ddb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dde:	be 00 00 00 00       	mov    $0x0,%esi
+  800de3:	48 b8 2b 1b 80 00 00 	movabs $0x801b2b,%rax
+  800dea:	00 00 00 
+  800ded:	ff d0                	call   *%rax
+  800def:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	78 25                	js     800e1a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800df5:	4c 89 e6             	mov    %r12,%rsi
+  800df8:	89 c7                	mov    %eax,%edi
+  800dfa:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+  800e06:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e09:	89 df                	mov    %ebx,%edi
+  800e0b:	48 b8 4e 08 80 00 00 	movabs $0x80084e,%rax
+  800e12:	00 00 00 
+  800e15:	ff d0                	call   *%rax
+
+    return res;
+  800e17:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e1a:	89 d8                	mov    %ebx,%eax
+  800e1c:	5b                   	pop    %rbx
+  800e1d:	41 5c                	pop    %r12
+  800e1f:	5d                   	pop    %rbp
+  800e20:	c3                   	ret
+
+0000000000800e21 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e21:	55                   	push   %rbp
+  800e22:	48 89 e5             	mov    %rsp,%rbp
+  800e25:	41 54                	push   %r12
+  800e27:	53                   	push   %rbx
+  800e28:	48 83 ec 10          	sub    $0x10,%rsp
+  800e2c:	48 89 fb             	mov    %rdi,%rbx
+  800e2f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e32:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e36:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e3b:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800e42:	00 00 00 
+  800e45:	ff d0                	call   *%rax
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	78 1f                	js     800e6a <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e4f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e53:	48 85 c0             	test   %rax,%rax
+  800e56:	74 1b                	je     800e73 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e58:	4c 89 e6             	mov    %r12,%rsi
+  800e5b:	48 89 df             	mov    %rbx,%rdi
+  800e5e:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e60:	85 c0                	test   %eax,%eax
+  800e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e67:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e6a:	48 83 c4 10          	add    $0x10,%rsp
+  800e6e:	5b                   	pop    %rbx
+  800e6f:	41 5c                	pop    %r12
+  800e71:	5d                   	pop    %rbp
+  800e72:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e73:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e78:	eb f0                	jmp    800e6a <create_snapshot+0x49>
+
+0000000000800e7a <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e7a:	55                   	push   %rbp
+  800e7b:	48 89 e5             	mov    %rsp,%rbp
+  800e7e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e82:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e86:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e8b:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800e92:	00 00 00 
+  800e95:	ff d0                	call   *%rax
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	78 1e                	js     800eb9 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800e9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e9f:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800ea3:	48 85 d2             	test   %rdx,%rdx
+  800ea6:	74 13                	je     800ebb <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ead:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800eaf:	85 c0                	test   %eax,%eax
+  800eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800eb9:	c9                   	leave
+  800eba:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ebb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ec0:	eb f7                	jmp    800eb9 <print_snapshot_list+0x3f>
+
+0000000000800ec2 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ec2:	55                   	push   %rbp
+  800ec3:	48 89 e5             	mov    %rsp,%rbp
+  800ec6:	53                   	push   %rbx
+  800ec7:	48 83 ec 18          	sub    $0x18,%rsp
+  800ecb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ece:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ed2:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ed7:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800ede:	00 00 00 
+  800ee1:	ff d0                	call   *%rax
+  800ee3:	85 c0                	test   %eax,%eax
+  800ee5:	78 1c                	js     800f03 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800ee7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eeb:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800eef:	48 85 c0             	test   %rax,%rax
+  800ef2:	74 15                	je     800f09 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800ef4:	48 89 df             	mov    %rbx,%rdi
+  800ef7:	ff d0                	call   *%rax
+    if (res < 0) {
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f00:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f07:	c9                   	leave
+  800f08:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f09:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f0e:	eb f3                	jmp    800f03 <accept_snapshot+0x41>
+
+0000000000800f10 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f10:	55                   	push   %rbp
+  800f11:	48 89 e5             	mov    %rsp,%rbp
+  800f14:	53                   	push   %rbx
+  800f15:	48 83 ec 18          	sub    $0x18,%rsp
+  800f19:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f1c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f20:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f25:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800f2c:	00 00 00 
+  800f2f:	ff d0                	call   *%rax
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	78 1c                	js     800f51 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f39:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f3d:	48 85 c0             	test   %rax,%rax
+  800f40:	74 15                	je     800f57 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f42:	48 89 df             	mov    %rbx,%rdi
+  800f45:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f55:	c9                   	leave
+  800f56:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f57:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f5c:	eb f3                	jmp    800f51 <delete_snapshot+0x41>
+
+0000000000800f5e <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f5e:	55                   	push   %rbp
+  800f5f:	48 89 e5             	mov    %rsp,%rbp
+  800f62:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f66:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f6a:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f6f:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800f76:	00 00 00 
+  800f79:	ff d0                	call   *%rax
+  800f7b:	85 c0                	test   %eax,%eax
+  800f7d:	78 14                	js     800f93 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f83:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f87:	48 85 d2             	test   %rdx,%rdx
+  800f8a:	74 09                	je     800f95 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f91:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800f93:	c9                   	leave
+  800f94:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f95:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f9a:	eb f7                	jmp    800f93 <gc_snapshots+0x35>
+
+0000000000800f9c <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800f9c:	55                   	push   %rbp
+  800f9d:	48 89 e5             	mov    %rsp,%rbp
+  800fa0:	41 56                	push   %r14
+  800fa2:	41 55                	push   %r13
+  800fa4:	41 54                	push   %r12
+  800fa6:	53                   	push   %rbx
+  800fa7:	48 83 ec 10          	sub    $0x10,%rsp
+  800fab:	48 89 fb             	mov    %rdi,%rbx
+  800fae:	49 89 f4             	mov    %rsi,%r12
+  800fb1:	49 89 d5             	mov    %rdx,%r13
+  800fb4:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fb7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fbb:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fc0:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  800fc7:	00 00 00 
+  800fca:	ff d0                	call   *%rax
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	78 1b                	js     800feb <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fd4:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fd8:	48 85 c0             	test   %rax,%rax
+  800fdb:	74 1b                	je     800ff8 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fdd:	4c 89 f1             	mov    %r14,%rcx
+  800fe0:	4c 89 ea             	mov    %r13,%rdx
+  800fe3:	4c 89 e6             	mov    %r12,%rsi
+  800fe6:	48 89 df             	mov    %rbx,%rdi
+  800fe9:	ff d0                	call   *%rax
+
+    return res;
+}
+  800feb:	48 83 c4 10          	add    $0x10,%rsp
+  800fef:	5b                   	pop    %rbx
+  800ff0:	41 5c                	pop    %r12
+  800ff2:	41 5d                	pop    %r13
+  800ff4:	41 5e                	pop    %r14
+  800ff6:	5d                   	pop    %rbp
+  800ff7:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ff8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ffd:	eb ec                	jmp    800feb <diff_snapshots+0x4f>
+
+0000000000800fff <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  800fff:	55                   	push   %rbp
+  801000:	48 89 e5             	mov    %rsp,%rbp
+  801003:	41 55                	push   %r13
+  801005:	41 54                	push   %r12
+  801007:	53                   	push   %rbx
+  801008:	48 83 ec 18          	sub    $0x18,%rsp
+  80100c:	48 89 fb             	mov    %rdi,%rbx
+  80100f:	49 89 f4             	mov    %rsi,%r12
+  801012:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801015:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801019:	bf 66 00 00 00       	mov    $0x66,%edi
+  80101e:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	78 18                	js     801046 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80102e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801032:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801036:	48 85 c0             	test   %rax,%rax
+  801039:	74 16                	je     801051 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80103b:	4c 89 ea             	mov    %r13,%rdx
+  80103e:	4c 89 e6             	mov    %r12,%rsi
+  801041:	48 89 df             	mov    %rbx,%rdi
+  801044:	ff d0                	call   *%rax
+
+    return res;
+}
+  801046:	48 83 c4 18          	add    $0x18,%rsp
+  80104a:	5b                   	pop    %rbx
+  80104b:	41 5c                	pop    %r12
+  80104d:	41 5d                	pop    %r13
+  80104f:	5d                   	pop    %rbp
+  801050:	c3                   	ret
+        return -E_NOT_SUPP;
+  801051:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801056:	eb ee                	jmp    801046 <send_snapshot+0x47>
+
+0000000000801058 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801058:	55                   	push   %rbp
+  801059:	48 89 e5             	mov    %rsp,%rbp
+  80105c:	53                   	push   %rbx
+  80105d:	48 83 ec 18          	sub    $0x18,%rsp
+  801061:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801064:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801068:	bf 66 00 00 00       	mov    $0x66,%edi
+  80106d:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  801074:	00 00 00 
+  801077:	ff d0                	call   *%rax
+  801079:	85 c0                	test   %eax,%eax
+  80107b:	78 12                	js     80108f <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80107d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801081:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801085:	48 85 c0             	test   %rax,%rax
+  801088:	74 0b                	je     801095 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80108a:	48 89 df             	mov    %rbx,%rdi
+  80108d:	ff d0                	call   *%rax
+
+    return res;
+}
+  80108f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801093:	c9                   	leave
+  801094:	c3                   	ret
+        return -E_NOT_SUPP;
+  801095:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80109a:	eb f3                	jmp    80108f <receive_snapshot+0x37>
+
+000000000080109c <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80109c:	55                   	push   %rbp
+  80109d:	48 89 e5             	mov    %rsp,%rbp
+  8010a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010a8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010ad:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  8010b4:	00 00 00 
+  8010b7:	ff d0                	call   *%rax
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	78 17                	js     8010d4 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010c1:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010c8:	48 85 d2             	test   %rdx,%rdx
+  8010cb:	74 09                	je     8010d6 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010d4:	c9                   	leave
+  8010d5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010d6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010db:	eb f7                	jmp    8010d4 <free_space_bytes+0x38>
+
+00000000008010dd <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010dd:	55                   	push   %rbp
+  8010de:	48 89 e5             	mov    %rsp,%rbp
+  8010e1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010e9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010ee:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  8010f5:	00 00 00 
+  8010f8:	ff d0                	call   *%rax
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	78 17                	js     801115 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8010fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801102:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801109:	48 85 d2             	test   %rdx,%rdx
+  80110c:	74 09                	je     801117 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80110e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801113:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801115:	c9                   	leave
+  801116:	c3                   	ret
+        return -E_NOT_SUPP;
+  801117:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80111c:	eb f7                	jmp    801115 <busy_space_bytes+0x38>
+
+000000000080111e <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	41 54                	push   %r12
+  801124:	53                   	push   %rbx
+  801125:	48 83 ec 10          	sub    $0x10,%rsp
+  801129:	89 fb                	mov    %edi,%ebx
+  80112b:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80112e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801132:	bf 66 00 00 00       	mov    $0x66,%edi
+  801137:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  80113e:	00 00 00 
+  801141:	ff d0                	call   *%rax
+  801143:	85 c0                	test   %eax,%eax
+  801145:	78 17                	js     80115e <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  801147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114b:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801152:	48 85 c0             	test   %rax,%rax
+  801155:	74 10                	je     801167 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  801157:	4c 89 e6             	mov    %r12,%rsi
+  80115a:	89 df                	mov    %ebx,%edi
+  80115c:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80115e:	48 83 c4 10          	add    $0x10,%rsp
+  801162:	5b                   	pop    %rbx
+  801163:	41 5c                	pop    %r12
+  801165:	5d                   	pop    %rbp
+  801166:	c3                   	ret
+        return -E_NOT_SUPP;
+  801167:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80116c:	eb f0                	jmp    80115e <snapshots_space+0x40>
+
+000000000080116e <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80116e:	55                   	push   %rbp
+  80116f:	48 89 e5             	mov    %rsp,%rbp
+  801172:	41 55                	push   %r13
+  801174:	41 54                	push   %r12
+  801176:	53                   	push   %rbx
+  801177:	48 83 ec 08          	sub    $0x8,%rsp
+  80117b:	41 89 fd             	mov    %edi,%r13d
+  80117e:	48 89 f3             	mov    %rsi,%rbx
+  801181:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801184:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80118b:	00 00 00 
+  80118e:	83 38 00             	cmpl   $0x0,(%rax)
+  801191:	74 57                	je     8011ea <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801193:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801199:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80119e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011a5:	00 00 00 
+  8011a8:	44 89 ee             	mov    %r13d,%esi
+  8011ab:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011b2:	00 00 00 
+  8011b5:	8b 38                	mov    (%rax),%edi
+  8011b7:	48 b8 63 35 80 00 00 	movabs $0x803563,%rax
+  8011be:	00 00 00 
+  8011c1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c8:	4c 89 e2             	mov    %r12,%rdx
+  8011cb:	48 89 de             	mov    %rbx,%rsi
+  8011ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d3:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+}
+  8011df:	48 83 c4 08          	add    $0x8,%rsp
+  8011e3:	5b                   	pop    %rbx
+  8011e4:	41 5c                	pop    %r12
+  8011e6:	41 5d                	pop    %r13
+  8011e8:	5d                   	pop    %rbp
+  8011e9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011ef:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  8011f6:	00 00 00 
+  8011f9:	ff d0                	call   *%rax
+  8011fb:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801202:	00 00 
+  801204:	eb 8d                	jmp    801193 <fsipc_region+0x25>
+
+0000000000801206 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80120e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801215:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801216:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80121a:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  801221:	00 00 00 
+  801224:	ff d0                	call   *%rax
+}
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+
+0000000000801228 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801228:	85 ff                	test   %edi,%edi
+  80122a:	78 6d                	js     801299 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80122c:	55                   	push   %rbp
+  80122d:	48 89 e5             	mov    %rsp,%rbp
+  801230:	41 54                	push   %r12
+  801232:	53                   	push   %rbx
+  801233:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801236:	48 85 f6             	test   %rsi,%rsi
+  801239:	74 57                	je     801292 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80123b:	89 f8                	mov    %edi,%eax
+  80123d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801244:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801246:	be 00 00 00 00       	mov    $0x0,%esi
+  80124b:	bf 12 00 00 00       	mov    $0x12,%edi
+  801250:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801257:	00 00 00 
+  80125a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	78 2d                	js     80128d <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801260:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801267:	00 00 00 
+  80126a:	49 63 14 24          	movslq (%r12),%rdx
+  80126e:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  801275:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80127a:	48 89 df             	mov    %rbx,%rdi
+  80127d:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  801284:	00 00 00 
+  801287:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  801289:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80128d:	5b                   	pop    %rbx
+  80128e:	41 5c                	pop    %r12
+  801290:	5d                   	pop    %rbp
+  801291:	c3                   	ret
+        return -E_INVAL;
+  801292:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801297:	eb f4                	jmp    80128d <devfile_df_snapshots+0x65>
+  801299:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80129e:	c3                   	ret
+
+000000000080129f <devfile_df_busy>:
+devfile_df_busy() {
+  80129f:	55                   	push   %rbp
+  8012a0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012ad:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  8012b4:	00 00 00 
+  8012b7:	ff d0                	call   *%rax
+}
+  8012b9:	5d                   	pop    %rbp
+  8012ba:	c3                   	ret
+
+00000000008012bb <devfile_df_free>:
+devfile_df_free() {
+  8012bb:	55                   	push   %rbp
+  8012bc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012c9:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  8012d0:	00 00 00 
+  8012d3:	ff d0                	call   *%rax
+}
+  8012d5:	5d                   	pop    %rbp
+  8012d6:	c3                   	ret
+
+00000000008012d7 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012d7:	55                   	push   %rbp
+  8012d8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012db:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012e5:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+}
+  8012f1:	5d                   	pop    %rbp
+  8012f2:	c3                   	ret
+
+00000000008012f3 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8012f3:	55                   	push   %rbp
+  8012f4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	bf 09 00 00 00       	mov    $0x9,%edi
+  801301:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801314:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801317:	5d                   	pop    %rbp
+  801318:	c3                   	ret
+
+0000000000801319 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801319:	55                   	push   %rbp
+  80131a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80131d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801324:	00 00 00 
+  801327:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80132a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80132c:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	bf 02 00 00 00       	mov    $0x2,%edi
+  801339:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801340:	00 00 00 
+  801343:	ff d0                	call   *%rax
+}
+  801345:	5d                   	pop    %rbp
+  801346:	c3                   	ret
+
+0000000000801347 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801347:	55                   	push   %rbp
+  801348:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80134b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80134e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801355:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801357:	be 00 00 00 00       	mov    $0x0,%esi
+  80135c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801361:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801368:	00 00 00 
+  80136b:	ff d0                	call   *%rax
+}
+  80136d:	5d                   	pop    %rbp
+  80136e:	c3                   	ret
+
+000000000080136f <devfile_write>:
+    if (!fd || !buf) {
+  80136f:	48 85 ff             	test   %rdi,%rdi
+  801372:	0f 84 c1 00 00 00    	je     801439 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801378:	55                   	push   %rbp
+  801379:	48 89 e5             	mov    %rsp,%rbp
+  80137c:	41 57                	push   %r15
+  80137e:	41 56                	push   %r14
+  801380:	41 55                	push   %r13
+  801382:	41 54                	push   %r12
+  801384:	53                   	push   %rbx
+  801385:	48 83 ec 18          	sub    $0x18,%rsp
+  801389:	49 89 ff             	mov    %rdi,%r15
+  80138c:	49 89 f5             	mov    %rsi,%r13
+  80138f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801392:	48 85 f6             	test   %rsi,%rsi
+  801395:	0f 84 95 00 00 00    	je     801430 <devfile_write+0xc1>
+    while (n) {
+  80139b:	48 85 d2             	test   %rdx,%rdx
+  80139e:	0f 84 83 00 00 00    	je     801427 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013a4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013ab:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013b2:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013b5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013ba:	49 39 dc             	cmp    %rbx,%r12
+  8013bd:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013c1:	48 89 da             	mov    %rbx,%rdx
+  8013c4:	4c 89 ee             	mov    %r13,%rsi
+  8013c7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013ce:	00 00 00 
+  8013d1:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  8013d8:	00 00 00 
+  8013db:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013dd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013e1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013e4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013f2:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  8013f9:	00 00 00 
+  8013fc:	ff d0                	call   *%rax
+        if (write < 0) {
+  8013fe:	85 c0                	test   %eax,%eax
+  801400:	78 21                	js     801423 <devfile_write+0xb4>
+        buf += write;
+  801402:	48 63 d0             	movslq %eax,%rdx
+  801405:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801408:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80140b:	49 29 d4             	sub    %rdx,%r12
+  80140e:	75 a5                	jne    8013b5 <devfile_write+0x46>
+    return totalWrite;
+  801410:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801414:	48 83 c4 18          	add    $0x18,%rsp
+  801418:	5b                   	pop    %rbx
+  801419:	41 5c                	pop    %r12
+  80141b:	41 5d                	pop    %r13
+  80141d:	41 5e                	pop    %r14
+  80141f:	41 5f                	pop    %r15
+  801421:	5d                   	pop    %rbp
+  801422:	c3                   	ret
+            return write;
+  801423:	48 98                	cltq
+  801425:	eb ed                	jmp    801414 <devfile_write+0xa5>
+    int totalWrite = 0;
+  801427:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80142e:	eb e0                	jmp    801410 <devfile_write+0xa1>
+        return -E_INVAL;
+  801430:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801437:	eb db                	jmp    801414 <devfile_write+0xa5>
+  801439:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801440:	c3                   	ret
+
+0000000000801441 <devfile_read>:
+    if (!fd || !buf) {
+  801441:	48 85 ff             	test   %rdi,%rdi
+  801444:	0f 84 c0 00 00 00    	je     80150a <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	41 57                	push   %r15
+  801450:	41 56                	push   %r14
+  801452:	41 55                	push   %r13
+  801454:	41 54                	push   %r12
+  801456:	53                   	push   %rbx
+  801457:	48 83 ec 18          	sub    $0x18,%rsp
+  80145b:	49 89 ff             	mov    %rdi,%r15
+  80145e:	49 89 f5             	mov    %rsi,%r13
+  801461:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801464:	48 85 f6             	test   %rsi,%rsi
+  801467:	0f 84 96 00 00 00    	je     801503 <devfile_read+0xc2>
+    while (n) {
+  80146d:	48 85 d2             	test   %rdx,%rdx
+  801470:	0f 84 87 00 00 00    	je     8014fd <devfile_read+0xbc>
+    size_t totalRead = 0;
+  801476:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80147d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80147e:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  801485:	00 00 00 
+  801488:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80148c:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80148f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801494:	49 39 c4             	cmp    %rax,%r12
+  801497:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80149b:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014a9:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  8014b0:	00 00 00 
+  8014b3:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	7e 37                	jle    8014f0 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014b9:	48 63 d8             	movslq %eax,%rbx
+  8014bc:	48 89 da             	mov    %rbx,%rdx
+  8014bf:	4c 89 f6             	mov    %r14,%rsi
+  8014c2:	4c 89 ef             	mov    %r13,%rdi
+  8014c5:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  8014cc:	00 00 00 
+  8014cf:	ff d0                	call   *%rax
+        buf += read;
+  8014d1:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014d4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014d8:	49 29 dc             	sub    %rbx,%r12
+  8014db:	75 ab                	jne    801488 <devfile_read+0x47>
+  return totalRead;
+  8014dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014e1:	48 83 c4 18          	add    $0x18,%rsp
+  8014e5:	5b                   	pop    %rbx
+  8014e6:	41 5c                	pop    %r12
+  8014e8:	41 5d                	pop    %r13
+  8014ea:	41 5e                	pop    %r14
+  8014ec:	41 5f                	pop    %r15
+  8014ee:	5d                   	pop    %rbp
+  8014ef:	c3                   	ret
+            return read ? read : totalRead;
+  8014f0:	48 63 d0             	movslq %eax,%rdx
+  8014f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014f7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8014fb:	eb e4                	jmp    8014e1 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8014fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801501:	eb da                	jmp    8014dd <devfile_read+0x9c>
+        return E_INVAL;
+  801503:	b8 03 00 00 00       	mov    $0x3,%eax
+  801508:	eb d7                	jmp    8014e1 <devfile_read+0xa0>
+  80150a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80150f:	c3                   	ret
+
+0000000000801510 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801510:	48 85 ff             	test   %rdi,%rdi
+  801513:	74 5f                	je     801574 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	48 83 ec 08          	sub    $0x8,%rsp
+  80151e:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801521:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  801528:	00 00 00 
+  80152b:	ff d0                	call   *%rax
+  80152d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801533:	77 45                	ja     80157a <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801535:	48 89 de             	mov    %rbx,%rsi
+  801538:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80153f:	00 00 00 
+  801542:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801549:	00 00 00 
+  80154c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80154e:	be 00 00 00 00       	mov    $0x0,%esi
+  801553:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801558:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80155f:	00 00 00 
+  801562:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801564:	85 c0                	test   %eax,%eax
+  801566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80156e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801572:	c9                   	leave
+  801573:	c3                   	ret
+        return -E_INVAL;
+  801574:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801579:	c3                   	ret
+        return -E_INVAL;
+  80157a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157f:	eb ed                	jmp    80156e <devfile_receive_snapshot+0x5e>
+
+0000000000801581 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	41 55                	push   %r13
+  801587:	41 54                	push   %r12
+  801589:	53                   	push   %rbx
+  80158a:	48 83 ec 08          	sub    $0x8,%rsp
+  80158e:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  801591:	48 85 f6             	test   %rsi,%rsi
+  801594:	0f 94 c0             	sete   %al
+  801597:	48 85 d2             	test   %rdx,%rdx
+  80159a:	0f 94 c2             	sete   %dl
+  80159d:	08 d0                	or     %dl,%al
+  80159f:	0f 85 ad 00 00 00    	jne    801652 <devfile_send_snapshot+0xd1>
+  8015a5:	48 89 fb             	mov    %rdi,%rbx
+  8015a8:	49 89 f4             	mov    %rsi,%r12
+  8015ab:	48 85 ff             	test   %rdi,%rdi
+  8015ae:	0f 84 9e 00 00 00    	je     801652 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015b4:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8015bb:	00 00 00 
+  8015be:	ff d0                	call   *%rax
+  8015c0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015c6:	0f 87 8d 00 00 00    	ja     801659 <devfile_send_snapshot+0xd8>
+  8015cc:	4c 89 e7             	mov    %r12,%rdi
+  8015cf:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8015d6:	00 00 00 
+  8015d9:	ff d0                	call   *%rax
+  8015db:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015e1:	77 7d                	ja     801660 <devfile_send_snapshot+0xdf>
+  8015e3:	4c 89 ef             	mov    %r13,%rdi
+  8015e6:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+  8015f2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8015f8:	77 6d                	ja     801667 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8015fa:	48 89 de             	mov    %rbx,%rsi
+  8015fd:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801604:	00 00 00 
+  801607:	48 bb 61 2f 80 00 00 	movabs $0x802f61,%rbx
+  80160e:	00 00 00 
+  801611:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801613:	4c 89 e6             	mov    %r12,%rsi
+  801616:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80161d:	00 00 00 
+  801620:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801622:	4c 89 ee             	mov    %r13,%rsi
+  801625:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80162c:	00 00 00 
+  80162f:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80163b:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+}
+  801647:	48 83 c4 08          	add    $0x8,%rsp
+  80164b:	5b                   	pop    %rbx
+  80164c:	41 5c                	pop    %r12
+  80164e:	41 5d                	pop    %r13
+  801650:	5d                   	pop    %rbp
+  801651:	c3                   	ret
+        return -E_INVAL;
+  801652:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801657:	eb ee                	jmp    801647 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801659:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165e:	eb e7                	jmp    801647 <devfile_send_snapshot+0xc6>
+  801660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801665:	eb e0                	jmp    801647 <devfile_send_snapshot+0xc6>
+  801667:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166c:	eb d9                	jmp    801647 <devfile_send_snapshot+0xc6>
+
+000000000080166e <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80166e:	48 85 ff             	test   %rdi,%rdi
+  801671:	0f 84 41 01 00 00    	je     8017b8 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	41 57                	push   %r15
+  80167d:	41 56                	push   %r14
+  80167f:	41 55                	push   %r13
+  801681:	41 54                	push   %r12
+  801683:	53                   	push   %rbx
+  801684:	48 83 ec 08          	sub    $0x8,%rsp
+  801688:	49 89 fc             	mov    %rdi,%r12
+  80168b:	49 89 f5             	mov    %rsi,%r13
+  80168e:	48 89 d3             	mov    %rdx,%rbx
+  801691:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  801694:	48 85 f6             	test   %rsi,%rsi
+  801697:	0f 84 ff 00 00 00    	je     80179c <devfile_diff_snapshots+0x12e>
+  80169d:	48 85 d2             	test   %rdx,%rdx
+  8016a0:	0f 84 fd 00 00 00    	je     8017a3 <devfile_diff_snapshots+0x135>
+  8016a6:	48 85 c9             	test   %rcx,%rcx
+  8016a9:	0f 84 f4 00 00 00    	je     8017a3 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016af:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+  8016bb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016c1:	0f 87 e3 00 00 00    	ja     8017aa <devfile_diff_snapshots+0x13c>
+  8016c7:	4c 89 ef             	mov    %r13,%rdi
+  8016ca:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8016d1:	00 00 00 
+  8016d4:	ff d0                	call   *%rax
+  8016d6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016dc:	0f 87 cf 00 00 00    	ja     8017b1 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016e2:	4c 89 e6             	mov    %r12,%rsi
+  8016e5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016ec:	00 00 00 
+  8016ef:	4c 89 e7             	mov    %r12,%rdi
+  8016f2:	49 bf 61 2f 80 00 00 	movabs $0x802f61,%r15
+  8016f9:	00 00 00 
+  8016fc:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8016ff:	4c 89 ee             	mov    %r13,%rsi
+  801702:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801709:	00 
+  80170a:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80170d:	48 8b 03             	mov    (%rbx),%rax
+  801710:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801717:	00 
+  801718:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80171c:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801723:	00 
+  801724:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801728:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80172f:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801730:	be 00 00 00 00       	mov    $0x0,%esi
+  801735:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80173a:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801741:	00 00 00 
+  801744:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801746:	85 c0                	test   %eax,%eax
+  801748:	78 43                	js     80178d <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80174a:	49 8b 04 24          	mov    (%r12),%rax
+  80174e:	48 89 03             	mov    %rax,(%rbx)
+  801751:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801756:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80175a:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80175f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801763:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801768:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80176c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801770:	48 c1 e2 03          	shl    $0x3,%rdx
+  801774:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801779:	4c 89 f7             	mov    %r14,%rdi
+  80177c:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  801783:	00 00 00 
+  801786:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  801788:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80178d:	48 83 c4 08          	add    $0x8,%rsp
+  801791:	5b                   	pop    %rbx
+  801792:	41 5c                	pop    %r12
+  801794:	41 5d                	pop    %r13
+  801796:	41 5e                	pop    %r14
+  801798:	41 5f                	pop    %r15
+  80179a:	5d                   	pop    %rbp
+  80179b:	c3                   	ret
+        return -E_INVAL;
+  80179c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a1:	eb ea                	jmp    80178d <devfile_diff_snapshots+0x11f>
+  8017a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a8:	eb e3                	jmp    80178d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017af:	eb dc                	jmp    80178d <devfile_diff_snapshots+0x11f>
+  8017b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b6:	eb d5                	jmp    80178d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017bd:	c3                   	ret
+
+00000000008017be <devfile_delete_snapshot>:
+    if (!name) {
+  8017be:	48 85 ff             	test   %rdi,%rdi
+  8017c1:	74 5f                	je     801822 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017c3:	55                   	push   %rbp
+  8017c4:	48 89 e5             	mov    %rsp,%rbp
+  8017c7:	53                   	push   %rbx
+  8017c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017cc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017cf:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+  8017db:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017e1:	77 45                	ja     801828 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017e3:	48 89 de             	mov    %rbx,%rsi
+  8017e6:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017ed:	00 00 00 
+  8017f0:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  8017f7:	00 00 00 
+  8017fa:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8017fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801801:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801806:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80180d:	00 00 00 
+  801810:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801812:	85 c0                	test   %eax,%eax
+  801814:	ba 00 00 00 00       	mov    $0x0,%edx
+  801819:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80181c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801820:	c9                   	leave
+  801821:	c3                   	ret
+        return -E_INVAL;
+  801822:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801827:	c3                   	ret
+        return -E_INVAL;
+  801828:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80182d:	eb ed                	jmp    80181c <devfile_delete_snapshot+0x5e>
+
+000000000080182f <devfile_accept_snapshot>:
+    if (!name) {
+  80182f:	48 85 ff             	test   %rdi,%rdi
+  801832:	74 5f                	je     801893 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801834:	55                   	push   %rbp
+  801835:	48 89 e5             	mov    %rsp,%rbp
+  801838:	53                   	push   %rbx
+  801839:	48 83 ec 08          	sub    $0x8,%rsp
+  80183d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801840:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  801847:	00 00 00 
+  80184a:	ff d0                	call   *%rax
+  80184c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801852:	77 45                	ja     801899 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801854:	48 89 de             	mov    %rbx,%rsi
+  801857:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80185e:	00 00 00 
+  801861:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80186d:	be 00 00 00 00       	mov    $0x0,%esi
+  801872:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801877:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80187e:	00 00 00 
+  801881:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801883:	85 c0                	test   %eax,%eax
+  801885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+        return -E_INVAL;
+  801893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801898:	c3                   	ret
+        return -E_INVAL;
+  801899:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189e:	eb ed                	jmp    80188d <devfile_accept_snapshot+0x5e>
+
+00000000008018a0 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018a0:	48 85 ff             	test   %rdi,%rdi
+  8018a3:	0f 84 9f 00 00 00    	je     801948 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018a9:	55                   	push   %rbp
+  8018aa:	48 89 e5             	mov    %rsp,%rbp
+  8018ad:	41 54                	push   %r12
+  8018af:	53                   	push   %rbx
+  8018b0:	48 89 fb             	mov    %rdi,%rbx
+  8018b3:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018b6:	48 85 f6             	test   %rsi,%rsi
+  8018b9:	74 78                	je     801933 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018bb:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8018c2:	00 00 00 
+  8018c5:	ff d0                	call   *%rax
+  8018c7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018cd:	77 6b                	ja     80193a <devfile_create_snapshot+0x9a>
+  8018cf:	4c 89 e7             	mov    %r12,%rdi
+  8018d2:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+  8018de:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018e4:	77 5b                	ja     801941 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018e6:	48 89 de             	mov    %rbx,%rsi
+  8018e9:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018f0:	00 00 00 
+  8018f3:	48 bb 61 2f 80 00 00 	movabs $0x802f61,%rbx
+  8018fa:	00 00 00 
+  8018fd:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8018ff:	4c 89 e6             	mov    %r12,%rsi
+  801902:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801909:	00 00 00 
+  80190c:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80190e:	be 00 00 00 00       	mov    $0x0,%esi
+  801913:	bf 08 00 00 00       	mov    $0x8,%edi
+  801918:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801924:	85 c0                	test   %eax,%eax
+  801926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80192e:	5b                   	pop    %rbx
+  80192f:	41 5c                	pop    %r12
+  801931:	5d                   	pop    %rbp
+  801932:	c3                   	ret
+        return -E_INVAL;
+  801933:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801938:	eb f4                	jmp    80192e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80193a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193f:	eb ed                	jmp    80192e <devfile_create_snapshot+0x8e>
+  801941:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801946:	eb e6                	jmp    80192e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80194d:	c3                   	ret
+
+000000000080194e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80194e:	55                   	push   %rbp
+  80194f:	48 89 e5             	mov    %rsp,%rbp
+  801952:	41 54                	push   %r12
+  801954:	53                   	push   %rbx
+  801955:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801958:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80195b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801962:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801964:	be 00 00 00 00       	mov    $0x0,%esi
+  801969:	bf 05 00 00 00       	mov    $0x5,%edi
+  80196e:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 3d                	js     8019bb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80197e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801985:	00 00 00 
+  801988:	4c 89 e6             	mov    %r12,%rsi
+  80198b:	48 89 df             	mov    %rbx,%rdi
+  80198e:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80199a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019a1:	00 
+  8019a2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019a8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019af:	00 
+  8019b0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019bb:	5b                   	pop    %rbx
+  8019bc:	41 5c                	pop    %r12
+  8019be:	5d                   	pop    %rbp
+  8019bf:	c3                   	ret
+
+00000000008019c0 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019c0:	55                   	push   %rbp
+  8019c1:	48 89 e5             	mov    %rsp,%rbp
+  8019c4:	41 57                	push   %r15
+  8019c6:	41 56                	push   %r14
+  8019c8:	41 55                	push   %r13
+  8019ca:	41 54                	push   %r12
+  8019cc:	53                   	push   %rbx
+  8019cd:	48 83 ec 38          	sub    $0x38,%rsp
+  8019d1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019d5:	49 89 f5             	mov    %rsi,%r13
+  8019d8:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019db:	48 89 f0             	mov    %rsi,%rax
+  8019de:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019e3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019e7:	75 4f                	jne    801a38 <devfile_readmap+0x78>
+  8019e9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019ed:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8019f3:	75 1f                	jne    801a14 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8019f5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019f9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8019fd:	49 be a8 21 80 00 00 	movabs $0x8021a8,%r14
+  801a04:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a07:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a0e:	0f 87 9d 00 00 00    	ja     801ab1 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a14:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a18:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a1c:	4d 85 ff             	test   %r15,%r15
+  801a1f:	0f 85 cf 00 00 00    	jne    801af4 <devfile_readmap+0x134>
+  801a25:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a29:	48 83 c4 38          	add    $0x38,%rsp
+  801a2d:	5b                   	pop    %rbx
+  801a2e:	41 5c                	pop    %r12
+  801a30:	41 5d                	pop    %r13
+  801a32:	41 5e                	pop    %r14
+  801a34:	41 5f                	pop    %r15
+  801a36:	5d                   	pop    %rbp
+  801a37:	c3                   	ret
+    size_t totalRead = 0;
+  801a38:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a3f:	00 
+  801a40:	eb da                	jmp    801a1c <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a42:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a46:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a49:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a50:	00 00 00 
+  801a53:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a59:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a5d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a61:	4c 89 ee             	mov    %r13,%rsi
+  801a64:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a69:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	7e a3                	jle    801a1c <devfile_readmap+0x5c>
+  801a79:	48 98                	cltq
+  801a7b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a7f:	72 9b                	jb     801a1c <devfile_readmap+0x5c>
+        buf += read;
+  801a81:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a84:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a87:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a8b:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801a92:	75 88                	jne    801a1c <devfile_readmap+0x5c>
+  801a94:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a98:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a9e:	0f 85 78 ff ff ff    	jne    801a1c <devfile_readmap+0x5c>
+  801aa4:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aab:	0f 86 6b ff ff ff    	jbe    801a1c <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ab1:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801ab7:	4d 39 e7             	cmp    %r12,%r15
+  801aba:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801abe:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801ac5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ac9:	0f 84 73 ff ff ff    	je     801a42 <devfile_readmap+0x82>
+  801acf:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ad3:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801ad8:	41 ff d6             	call   *%r14
+  801adb:	a8 40                	test   $0x40,%al
+  801add:	0f 85 39 ff ff ff    	jne    801a1c <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ae3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aea:	4c 39 e3             	cmp    %r12,%rbx
+  801aed:	72 e4                	jb     801ad3 <devfile_readmap+0x113>
+  801aef:	e9 4e ff ff ff       	jmp    801a42 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801af4:	4c 89 fa             	mov    %r15,%rdx
+  801af7:	4c 89 ee             	mov    %r13,%rsi
+  801afa:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801afe:	48 b8 41 14 80 00 00 	movabs $0x801441,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b0a:	48 85 c0             	test   %rax,%rax
+  801b0d:	78 0c                	js     801b1b <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b0f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b13:	48 01 f0             	add    %rsi,%rax
+  801b16:	e9 0e ff ff ff       	jmp    801a29 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b1b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b1f:	48 85 f6             	test   %rsi,%rsi
+  801b22:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b26:	e9 fe fe ff ff       	jmp    801a29 <devfile_readmap+0x69>
+
+0000000000801b2b <open>:
+open(const char *path, int mode) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 55                	push   %r13
+  801b31:	41 54                	push   %r12
+  801b33:	53                   	push   %rbx
+  801b34:	48 83 ec 18          	sub    $0x18,%rsp
+  801b38:	49 89 fc             	mov    %rdi,%r12
+  801b3b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b3e:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  801b45:	00 00 00 
+  801b48:	ff d0                	call   *%rax
+  801b4a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b50:	0f 87 8a 00 00 00    	ja     801be0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b56:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b5a:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  801b61:	00 00 00 
+  801b64:	ff d0                	call   *%rax
+  801b66:	89 c3                	mov    %eax,%ebx
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 50                	js     801bbc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b6c:	4c 89 e6             	mov    %r12,%rsi
+  801b6f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b76:	00 00 00 
+  801b79:	48 89 df             	mov    %rbx,%rdi
+  801b7c:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b88:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b8f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801b93:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b98:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801b9f:	00 00 00 
+  801ba2:	ff d0                	call   *%rax
+  801ba4:	89 c3                	mov    %eax,%ebx
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 1f                	js     801bc9 <open+0x9e>
+    return fd2num(fd);
+  801baa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bae:	48 b8 5b 06 80 00 00 	movabs $0x80065b,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+  801bba:	89 c3                	mov    %eax,%ebx
+}
+  801bbc:	89 d8                	mov    %ebx,%eax
+  801bbe:	48 83 c4 18          	add    $0x18,%rsp
+  801bc2:	5b                   	pop    %rbx
+  801bc3:	41 5c                	pop    %r12
+  801bc5:	41 5d                	pop    %r13
+  801bc7:	5d                   	pop    %rbp
+  801bc8:	c3                   	ret
+        fd_close(fd, 0);
+  801bc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bce:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bd2:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+        return res;
+  801bde:	eb dc                	jmp    801bbc <open+0x91>
+        return -E_BAD_PATH;
+  801be0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801be5:	eb d5                	jmp    801bbc <open+0x91>
+
+0000000000801be7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801be7:	55                   	push   %rbp
+  801be8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801beb:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf0:	bf 13 00 00 00       	mov    $0x13,%edi
+  801bf5:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801bfc:	00 00 00 
+  801bff:	ff d0                	call   *%rax
+}
+  801c01:	5d                   	pop    %rbp
+  801c02:	c3                   	ret
+
+0000000000801c03 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c03:	55                   	push   %rbp
+  801c04:	48 89 e5             	mov    %rsp,%rbp
+  801c07:	41 54                	push   %r12
+  801c09:	53                   	push   %rbx
+  801c0a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c0d:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c1c:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  801c23:	00 00 00 
+  801c26:	48 89 df             	mov    %rbx,%rdi
+  801c29:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801c30:	00 00 00 
+  801c33:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c35:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c3a:	41 2b 04 24          	sub    (%r12),%eax
+  801c3e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c44:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c4b:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c4e:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c55:	00 00 00 
+  801c58:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c64:	5b                   	pop    %rbx
+  801c65:	41 5c                	pop    %r12
+  801c67:	5d                   	pop    %rbp
+  801c68:	c3                   	ret
+
+0000000000801c69 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c69:	55                   	push   %rbp
+  801c6a:	48 89 e5             	mov    %rsp,%rbp
+  801c6d:	41 54                	push   %r12
+  801c6f:	53                   	push   %rbx
+  801c70:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c78:	48 89 fe             	mov    %rdi,%rsi
+  801c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c80:	49 bc 57 03 80 00 00 	movabs $0x800357,%r12
+  801c87:	00 00 00 
+  801c8a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c8d:	48 89 df             	mov    %rbx,%rdi
+  801c90:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+  801c9c:	48 89 c6             	mov    %rax,%rsi
+  801c9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ca4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca9:	41 ff d4             	call   *%r12
+}
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	5d                   	pop    %rbp
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	41 57                	push   %r15
+  801cb7:	41 56                	push   %r14
+  801cb9:	41 55                	push   %r13
+  801cbb:	41 54                	push   %r12
+  801cbd:	53                   	push   %rbx
+  801cbe:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc2:	49 89 fc             	mov    %rdi,%r12
+  801cc5:	49 89 f5             	mov    %rsi,%r13
+  801cc8:	49 89 d7             	mov    %rdx,%r15
+  801ccb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801ccf:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801cd6:	00 00 00 
+  801cd9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cdb:	4d 85 ff             	test   %r15,%r15
+  801cde:	0f 84 af 00 00 00    	je     801d93 <devpipe_write+0xe2>
+  801ce4:	48 89 c3             	mov    %rax,%rbx
+  801ce7:	4c 89 f8             	mov    %r15,%rax
+  801cea:	4d 89 ef             	mov    %r13,%r15
+  801ced:	4c 01 e8             	add    %r13,%rax
+  801cf0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801cf4:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  801cfb:	00 00 00 
+            sys_yield();
+  801cfe:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  801d05:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d08:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d0b:	48 63 ce             	movslq %esi,%rcx
+  801d0e:	48 63 03             	movslq (%rbx),%rax
+  801d11:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d17:	48 39 c1             	cmp    %rax,%rcx
+  801d1a:	72 2e                	jb     801d4a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d1c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d21:	48 89 da             	mov    %rbx,%rdx
+  801d24:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d29:	4c 89 e7             	mov    %r12,%rdi
+  801d2c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	74 66                	je     801d99 <devpipe_write+0xe8>
+            sys_yield();
+  801d33:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d36:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d39:	48 63 ce             	movslq %esi,%rcx
+  801d3c:	48 63 03             	movslq (%rbx),%rax
+  801d3f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d45:	48 39 c1             	cmp    %rax,%rcx
+  801d48:	73 d2                	jae    801d1c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d4a:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d4e:	48 89 ca             	mov    %rcx,%rdx
+  801d51:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d55:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d5c:	08 10 20 
+  801d5f:	48 f7 e2             	mul    %rdx
+  801d62:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d66:	48 89 d0             	mov    %rdx,%rax
+  801d69:	48 c1 e0 09          	shl    $0x9,%rax
+  801d6d:	48 29 d0             	sub    %rdx,%rax
+  801d70:	48 c1 e0 03          	shl    $0x3,%rax
+  801d74:	48 29 c1             	sub    %rax,%rcx
+  801d77:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d7c:	83 c6 01             	add    $0x1,%esi
+  801d7f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d82:	49 83 c7 01          	add    $0x1,%r15
+  801d86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d8a:	49 39 c7             	cmp    %rax,%r15
+  801d8d:	0f 85 75 ff ff ff    	jne    801d08 <devpipe_write+0x57>
+    return n;
+  801d93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d97:	eb 05                	jmp    801d9e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d9e:	48 83 c4 18          	add    $0x18,%rsp
+  801da2:	5b                   	pop    %rbx
+  801da3:	41 5c                	pop    %r12
+  801da5:	41 5d                	pop    %r13
+  801da7:	41 5e                	pop    %r14
+  801da9:	41 5f                	pop    %r15
+  801dab:	5d                   	pop    %rbp
+  801dac:	c3                   	ret
+
+0000000000801dad <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801dad:	55                   	push   %rbp
+  801dae:	48 89 e5             	mov    %rsp,%rbp
+  801db1:	41 57                	push   %r15
+  801db3:	41 56                	push   %r14
+  801db5:	41 55                	push   %r13
+  801db7:	41 54                	push   %r12
+  801db9:	53                   	push   %rbx
+  801dba:	48 83 ec 18          	sub    $0x18,%rsp
+  801dbe:	49 89 fc             	mov    %rdi,%r12
+  801dc1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dc5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dc9:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801dd8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dde:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  801de5:	00 00 00 
+            sys_yield();
+  801de8:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  801def:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801df2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801df7:	74 7d                	je     801e76 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801df9:	8b 03                	mov    (%rbx),%eax
+  801dfb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801dfe:	75 26                	jne    801e26 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e00:	4d 85 ff             	test   %r15,%r15
+  801e03:	75 77                	jne    801e7c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e05:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e0a:	48 89 da             	mov    %rbx,%rdx
+  801e0d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e12:	4c 89 e7             	mov    %r12,%rdi
+  801e15:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	74 72                	je     801e8e <devpipe_read+0xe1>
+            sys_yield();
+  801e1c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e1f:	8b 03                	mov    (%rbx),%eax
+  801e21:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e24:	74 df                	je     801e05 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e26:	48 63 c8             	movslq %eax,%rcx
+  801e29:	48 89 ca             	mov    %rcx,%rdx
+  801e2c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e30:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e37:	08 10 20 
+  801e3a:	48 89 d0             	mov    %rdx,%rax
+  801e3d:	48 f7 e6             	mul    %rsi
+  801e40:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e44:	48 89 d0             	mov    %rdx,%rax
+  801e47:	48 c1 e0 09          	shl    $0x9,%rax
+  801e4b:	48 29 d0             	sub    %rdx,%rax
+  801e4e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e55:	00 
+  801e56:	48 89 c8             	mov    %rcx,%rax
+  801e59:	48 29 d0             	sub    %rdx,%rax
+  801e5c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e61:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e65:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e69:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e6c:	49 83 c7 01          	add    $0x1,%r15
+  801e70:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e74:	75 83                	jne    801df9 <devpipe_read+0x4c>
+    return n;
+  801e76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e7a:	eb 03                	jmp    801e7f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e7c:	4c 89 f8             	mov    %r15,%rax
+}
+  801e7f:	48 83 c4 18          	add    $0x18,%rsp
+  801e83:	5b                   	pop    %rbx
+  801e84:	41 5c                	pop    %r12
+  801e86:	41 5d                	pop    %r13
+  801e88:	41 5e                	pop    %r14
+  801e8a:	41 5f                	pop    %r15
+  801e8c:	5d                   	pop    %rbp
+  801e8d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e93:	eb ea                	jmp    801e7f <devpipe_read+0xd2>
+
+0000000000801e95 <pipe>:
+pipe(int pfd[2]) {
+  801e95:	55                   	push   %rbp
+  801e96:	48 89 e5             	mov    %rsp,%rbp
+  801e99:	41 55                	push   %r13
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ea5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ea9:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  801eb0:	00 00 00 
+  801eb3:	ff d0                	call   *%rax
+  801eb5:	89 c3                	mov    %eax,%ebx
+  801eb7:	85 c0                	test   %eax,%eax
+  801eb9:	0f 88 a0 01 00 00    	js     80205f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ebf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ec4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ec9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed2:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+  801ede:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	0f 88 77 01 00 00    	js     80205f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801ee8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801eec:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+  801ef8:	89 c3                	mov    %eax,%ebx
+  801efa:	85 c0                	test   %eax,%eax
+  801efc:	0f 88 43 01 00 00    	js     802045 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f02:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f0c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f15:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+  801f21:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	0f 88 1a 01 00 00    	js     802045 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f2b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f2f:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+  801f3b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f3e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f48:	48 89 c6             	mov    %rax,%rsi
+  801f4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f50:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  801f57:	00 00 00 
+  801f5a:	ff d0                	call   *%rax
+  801f5c:	89 c3                	mov    %eax,%ebx
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	0f 88 c5 00 00 00    	js     80202b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f66:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f6a:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801f71:	00 00 00 
+  801f74:	ff d0                	call   *%rax
+  801f76:	48 89 c1             	mov    %rax,%rcx
+  801f79:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f85:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8a:	4c 89 ee             	mov    %r13,%rsi
+  801f8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f92:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  801f99:	00 00 00 
+  801f9c:	ff d0                	call   *%rax
+  801f9e:	89 c3                	mov    %eax,%ebx
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	78 6e                	js     802012 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fa4:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fa9:	4c 89 ef             	mov    %r13,%rdi
+  801fac:	48 b8 2d 02 80 00 00 	movabs $0x80022d,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	83 f8 02             	cmp    $0x2,%eax
+  801fbb:	0f 85 ab 00 00 00    	jne    80206c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fc1:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fc8:	00 00 
+  801fca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fce:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fd0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fd4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801fdb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fdf:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801fe1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801fec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ff0:	48 bb 5b 06 80 00 00 	movabs $0x80065b,%rbx
+  801ff7:	00 00 00 
+  801ffa:	ff d3                	call   *%rbx
+  801ffc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802000:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802004:	ff d3                	call   *%rbx
+  802006:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80200b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802010:	eb 4d                	jmp    80205f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802012:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802017:	4c 89 ee             	mov    %r13,%rsi
+  80201a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201f:	48 b8 57 03 80 00 00 	movabs $0x800357,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80202b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802030:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802034:	bf 00 00 00 00       	mov    $0x0,%edi
+  802039:	48 b8 57 03 80 00 00 	movabs $0x800357,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802045:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80204a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80204e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802053:	48 b8 57 03 80 00 00 	movabs $0x800357,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+}
+  80205f:	89 d8                	mov    %ebx,%eax
+  802061:	48 83 c4 18          	add    $0x18,%rsp
+  802065:	5b                   	pop    %rbx
+  802066:	41 5c                	pop    %r12
+  802068:	41 5d                	pop    %r13
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80206c:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  802073:	00 00 00 
+  802076:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  80207d:	00 00 00 
+  802080:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802085:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  80208c:	00 00 00 
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802094:	49 b8 ec 24 80 00 00 	movabs $0x8024ec,%r8
+  80209b:	00 00 00 
+  80209e:	41 ff d0             	call   *%r8
+
+00000000008020a1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020ad:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 35                	js     8020f2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020bd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020c1:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  8020c8:	00 00 00 
+  8020cb:	ff d0                	call   *%rax
+  8020cd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020da:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020de:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	85 c0                	test   %eax,%eax
+  8020ec:	0f 94 c0             	sete   %al
+  8020ef:	0f b6 c0             	movzbl %al,%eax
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+00000000008020f4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8020f4:	48 89 f8             	mov    %rdi,%rax
+  8020f7:	48 c1 e8 27          	shr    $0x27,%rax
+  8020fb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802102:	01 00 00 
+  802105:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802109:	f6 c2 01             	test   $0x1,%dl
+  80210c:	74 6d                	je     80217b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80210e:	48 89 f8             	mov    %rdi,%rax
+  802111:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802115:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80211c:	01 00 00 
+  80211f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802123:	f6 c2 01             	test   $0x1,%dl
+  802126:	74 62                	je     80218a <get_uvpt_entry+0x96>
+  802128:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80212f:	01 00 00 
+  802132:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802136:	f6 c2 80             	test   $0x80,%dl
+  802139:	75 4f                	jne    80218a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80213b:	48 89 f8             	mov    %rdi,%rax
+  80213e:	48 c1 e8 15          	shr    $0x15,%rax
+  802142:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802149:	01 00 00 
+  80214c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802150:	f6 c2 01             	test   $0x1,%dl
+  802153:	74 44                	je     802199 <get_uvpt_entry+0xa5>
+  802155:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80215c:	01 00 00 
+  80215f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802163:	f6 c2 80             	test   $0x80,%dl
+  802166:	75 31                	jne    802199 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802168:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80216c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802173:	01 00 00 
+  802176:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80217a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80217b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802182:	01 00 00 
+  802185:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802189:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80218a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802191:	01 00 00 
+  802194:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802198:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802199:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021a0:	01 00 00 
+  8021a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a7:	c3                   	ret
+
+00000000008021a8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021a8:	55                   	push   %rbp
+  8021a9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021ac:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021bb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021c0:	89 c1                	mov    %eax,%ecx
+  8021c2:	83 c9 04             	or     $0x4,%ecx
+  8021c5:	f6 c2 01             	test   $0x1,%dl
+  8021c8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021cb:	89 c1                	mov    %eax,%ecx
+  8021cd:	83 c9 02             	or     $0x2,%ecx
+  8021d0:	f6 c2 02             	test   $0x2,%dl
+  8021d3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021d6:	89 c1                	mov    %eax,%ecx
+  8021d8:	83 c9 01             	or     $0x1,%ecx
+  8021db:	48 85 d2             	test   %rdx,%rdx
+  8021de:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021e1:	89 c1                	mov    %eax,%ecx
+  8021e3:	83 c9 40             	or     $0x40,%ecx
+  8021e6:	f6 c6 04             	test   $0x4,%dh
+  8021e9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021ec:	5d                   	pop    %rbp
+  8021ed:	c3                   	ret
+
+00000000008021ee <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021ee:	55                   	push   %rbp
+  8021ef:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021f2:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8021fe:	48 c1 e8 06          	shr    $0x6,%rax
+  802202:	83 e0 01             	and    $0x1,%eax
+}
+  802205:	5d                   	pop    %rbp
+  802206:	c3                   	ret
+
+0000000000802207 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802207:	55                   	push   %rbp
+  802208:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80220b:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802217:	48 c1 e8 05          	shr    $0x5,%rax
+  80221b:	83 e0 01             	and    $0x1,%eax
+}
+  80221e:	5d                   	pop    %rbp
+  80221f:	c3                   	ret
+
+0000000000802220 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802224:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	83 e0 01             	and    $0x1,%eax
+}
+  802233:	5d                   	pop    %rbp
+  802234:	c3                   	ret
+
+0000000000802235 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	41 57                	push   %r15
+  80223b:	41 56                	push   %r14
+  80223d:	41 55                	push   %r13
+  80223f:	41 54                	push   %r12
+  802241:	53                   	push   %rbx
+  802242:	48 83 ec 18          	sub    $0x18,%rsp
+  802246:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80224a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80224e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802253:	49 bd 20 22 80 00 00 	movabs $0x802220,%r13
+  80225a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80225d:	49 bf a8 21 80 00 00 	movabs $0x8021a8,%r15
+  802264:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802267:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80226e:	00 00 00 
+  802271:	eb 0c                	jmp    80227f <foreach_shared_region+0x4a>
+  802273:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80227a:	4c 39 f3             	cmp    %r14,%rbx
+  80227d:	74 2e                	je     8022ad <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80227f:	48 89 df             	mov    %rbx,%rdi
+  802282:	41 ff d5             	call   *%r13
+  802285:	84 c0                	test   %al,%al
+  802287:	74 ea                	je     802273 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802289:	48 89 df             	mov    %rbx,%rdi
+  80228c:	41 ff d7             	call   *%r15
+  80228f:	a8 40                	test   $0x40,%al
+  802291:	74 e0                	je     802273 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  802293:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80229a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229e:	48 89 df             	mov    %rbx,%rdi
+  8022a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022a5:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	79 c8                	jns    802273 <foreach_shared_region+0x3e>
+  8022ab:	eb 05                	jmp    8022b2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b2:	48 83 c4 18          	add    $0x18,%rsp
+  8022b6:	5b                   	pop    %rbx
+  8022b7:	41 5c                	pop    %r12
+  8022b9:	41 5d                	pop    %r13
+  8022bb:	41 5e                	pop    %r14
+  8022bd:	41 5f                	pop    %r15
+  8022bf:	5d                   	pop    %rbp
+  8022c0:	c3                   	ret
+
+00000000008022c1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c6:	c3                   	ret
+
+00000000008022c7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022c7:	55                   	push   %rbp
+  8022c8:	48 89 e5             	mov    %rsp,%rbp
+  8022cb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022ce:	48 be d4 37 80 00 00 	movabs $0x8037d4,%rsi
+  8022d5:	00 00 00 
+  8022d8:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  8022df:	00 00 00 
+  8022e2:	ff d0                	call   *%rax
+    return 0;
+}
+  8022e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e9:	5d                   	pop    %rbp
+  8022ea:	c3                   	ret
+
+00000000008022eb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022eb:	55                   	push   %rbp
+  8022ec:	48 89 e5             	mov    %rsp,%rbp
+  8022ef:	41 57                	push   %r15
+  8022f1:	41 56                	push   %r14
+  8022f3:	41 55                	push   %r13
+  8022f5:	41 54                	push   %r12
+  8022f7:	53                   	push   %rbx
+  8022f8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8022ff:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802306:	48 85 d2             	test   %rdx,%rdx
+  802309:	74 7a                	je     802385 <devcons_write+0x9a>
+  80230b:	49 89 d6             	mov    %rdx,%r14
+  80230e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802314:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802319:	49 bf 5b 31 80 00 00 	movabs $0x80315b,%r15
+  802320:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802323:	4c 89 f3             	mov    %r14,%rbx
+  802326:	48 29 f3             	sub    %rsi,%rbx
+  802329:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80232e:	48 39 c3             	cmp    %rax,%rbx
+  802331:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802335:	4c 63 eb             	movslq %ebx,%r13
+  802338:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80233f:	48 01 c6             	add    %rax,%rsi
+  802342:	4c 89 ea             	mov    %r13,%rdx
+  802345:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80234c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80234f:	4c 89 ee             	mov    %r13,%rsi
+  802352:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802359:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802365:	41 01 dc             	add    %ebx,%r12d
+  802368:	49 63 f4             	movslq %r12d,%rsi
+  80236b:	4c 39 f6             	cmp    %r14,%rsi
+  80236e:	72 b3                	jb     802323 <devcons_write+0x38>
+    return res;
+  802370:	49 63 c4             	movslq %r12d,%rax
+}
+  802373:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80237a:	5b                   	pop    %rbx
+  80237b:	41 5c                	pop    %r12
+  80237d:	41 5d                	pop    %r13
+  80237f:	41 5e                	pop    %r14
+  802381:	41 5f                	pop    %r15
+  802383:	5d                   	pop    %rbp
+  802384:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802385:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80238b:	eb e3                	jmp    802370 <devcons_write+0x85>
+
+000000000080238d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80238d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802390:	ba 00 00 00 00       	mov    $0x0,%edx
+  802395:	48 85 c0             	test   %rax,%rax
+  802398:	74 55                	je     8023ef <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	41 55                	push   %r13
+  8023a0:	41 54                	push   %r12
+  8023a2:	53                   	push   %rbx
+  8023a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023aa:	48 bb 2f 01 80 00 00 	movabs $0x80012f,%rbx
+  8023b1:	00 00 00 
+  8023b4:	49 bc fc 01 80 00 00 	movabs $0x8001fc,%r12
+  8023bb:	00 00 00 
+  8023be:	eb 03                	jmp    8023c3 <devcons_read+0x36>
+  8023c0:	41 ff d4             	call   *%r12
+  8023c3:	ff d3                	call   *%rbx
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	74 f7                	je     8023c0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023c9:	48 63 d0             	movslq %eax,%rdx
+  8023cc:	78 13                	js     8023e1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d3:	83 f8 04             	cmp    $0x4,%eax
+  8023d6:	74 09                	je     8023e1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023d8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023dc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023e1:	48 89 d0             	mov    %rdx,%rax
+  8023e4:	48 83 c4 08          	add    $0x8,%rsp
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	41 5d                	pop    %r13
+  8023ed:	5d                   	pop    %rbp
+  8023ee:	c3                   	ret
+  8023ef:	48 89 d0             	mov    %rdx,%rax
+  8023f2:	c3                   	ret
+
+00000000008023f3 <cputchar>:
+cputchar(int ch) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8023fb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8023ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802404:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802408:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+}
+  802414:	c9                   	leave
+  802415:	c3                   	ret
+
+0000000000802416 <getchar>:
+getchar(void) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80241e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802423:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802427:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242c:	48 b8 cc 09 80 00 00 	movabs $0x8009cc,%rax
+  802433:	00 00 00 
+  802436:	ff d0                	call   *%rax
+  802438:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	78 06                	js     802444 <getchar+0x2e>
+  80243e:	74 08                	je     802448 <getchar+0x32>
+  802440:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802444:	89 d0                	mov    %edx,%eax
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802448:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80244d:	eb f5                	jmp    802444 <getchar+0x2e>
+
+000000000080244f <iscons>:
+iscons(int fdnum) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802457:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80245b:	48 b8 e9 06 80 00 00 	movabs $0x8006e9,%rax
+  802462:	00 00 00 
+  802465:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 18                	js     802483 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80246b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80246f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802476:	00 00 00 
+  802479:	8b 00                	mov    (%rax),%eax
+  80247b:	39 02                	cmp    %eax,(%rdx)
+  80247d:	0f 94 c0             	sete   %al
+  802480:	0f b6 c0             	movzbl %al,%eax
+}
+  802483:	c9                   	leave
+  802484:	c3                   	ret
+
+0000000000802485 <opencons>:
+opencons(void) {
+  802485:	55                   	push   %rbp
+  802486:	48 89 e5             	mov    %rsp,%rbp
+  802489:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80248d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802491:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 49                	js     8024ea <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ab:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b4:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+  8024c0:	85 c0                	test   %eax,%eax
+  8024c2:	78 26                	js     8024ea <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024c8:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024cf:	00 00 
+  8024d1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024d3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024de:	48 b8 5b 06 80 00 00 	movabs $0x80065b,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+}
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+00000000008024ec <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024ec:	55                   	push   %rbp
+  8024ed:	48 89 e5             	mov    %rsp,%rbp
+  8024f0:	41 56                	push   %r14
+  8024f2:	41 55                	push   %r13
+  8024f4:	41 54                	push   %r12
+  8024f6:	53                   	push   %rbx
+  8024f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8024fb:	49 89 fc             	mov    %rdi,%r12
+  8024fe:	41 89 f5             	mov    %esi,%r13d
+  802501:	48 89 d3             	mov    %rdx,%rbx
+  802504:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802508:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80250c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802510:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802517:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80251b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80251f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802523:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802527:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80252e:	00 00 00 
+  802531:	4c 8b 30             	mov    (%rax),%r14
+  802534:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	89 c6                	mov    %eax,%esi
+  802542:	45 89 e8             	mov    %r13d,%r8d
+  802545:	4c 89 e1             	mov    %r12,%rcx
+  802548:	4c 89 f2             	mov    %r14,%rdx
+  80254b:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  802552:	00 00 00 
+  802555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255a:	49 bc 3c 26 80 00 00 	movabs $0x80263c,%r12
+  802561:	00 00 00 
+  802564:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802567:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80256b:	48 89 df             	mov    %rbx,%rdi
+  80256e:	48 b8 d8 25 80 00 00 	movabs $0x8025d8,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+    cprintf("\n");
+  80257a:	48 bf 3b 37 80 00 00 	movabs $0x80373b,%rdi
+  802581:	00 00 00 
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+  802589:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80258c:	cc                   	int3
+  80258d:	eb fd                	jmp    80258c <_panic+0xa0>
+
+000000000080258f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	53                   	push   %rbx
+  802594:	48 83 ec 08          	sub    $0x8,%rsp
+  802598:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80259b:	8b 06                	mov    (%rsi),%eax
+  80259d:	8d 50 01             	lea    0x1(%rax),%edx
+  8025a0:	89 16                	mov    %edx,(%rsi)
+  8025a2:	48 98                	cltq
+  8025a4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025a9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025af:	74 0a                	je     8025bb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025b1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b9:	c9                   	leave
+  8025ba:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025bb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025bf:	be ff 00 00 00       	mov    $0xff,%esi
+  8025c4:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  8025cb:	00 00 00 
+  8025ce:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025d0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025d6:	eb d9                	jmp    8025b1 <putch+0x22>
+
+00000000008025d8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025d8:	55                   	push   %rbp
+  8025d9:	48 89 e5             	mov    %rsp,%rbp
+  8025dc:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025e3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025e6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025ed:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8025f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8025fa:	48 89 f1             	mov    %rsi,%rcx
+  8025fd:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802604:	48 bf 8f 25 80 00 00 	movabs $0x80258f,%rdi
+  80260b:	00 00 00 
+  80260e:	48 b8 8c 27 80 00 00 	movabs $0x80278c,%rax
+  802615:	00 00 00 
+  802618:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80261a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802621:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802628:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  80262f:	00 00 00 
+  802632:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802634:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+000000000080263c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	48 83 ec 50          	sub    $0x50,%rsp
+  802644:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802648:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80264c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802650:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802654:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802658:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80265f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802663:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802667:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80266b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80266f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802673:	48 b8 d8 25 80 00 00 	movabs $0x8025d8,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+
+0000000000802681 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  802685:	41 57                	push   %r15
+  802687:	41 56                	push   %r14
+  802689:	41 55                	push   %r13
+  80268b:	41 54                	push   %r12
+  80268d:	53                   	push   %rbx
+  80268e:	48 83 ec 18          	sub    $0x18,%rsp
+  802692:	49 89 fc             	mov    %rdi,%r12
+  802695:	49 89 f5             	mov    %rsi,%r13
+  802698:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80269c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80269f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026a2:	41 89 cf             	mov    %ecx,%r15d
+  8026a5:	4c 39 fa             	cmp    %r15,%rdx
+  8026a8:	73 5b                	jae    802705 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026aa:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026ae:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026b2:	85 db                	test   %ebx,%ebx
+  8026b4:	7e 0e                	jle    8026c4 <print_num+0x43>
+            putch(padc, put_arg);
+  8026b6:	4c 89 ee             	mov    %r13,%rsi
+  8026b9:	44 89 f7             	mov    %r14d,%edi
+  8026bc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026bf:	83 eb 01             	sub    $0x1,%ebx
+  8026c2:	75 f2                	jne    8026b6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026c4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026c8:	48 b9 14 38 80 00 00 	movabs $0x803814,%rcx
+  8026cf:	00 00 00 
+  8026d2:	48 b8 03 38 80 00 00 	movabs $0x803803,%rax
+  8026d9:	00 00 00 
+  8026dc:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e9:	49 f7 f7             	div    %r15
+  8026ec:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8026f0:	4c 89 ee             	mov    %r13,%rsi
+  8026f3:	41 ff d4             	call   *%r12
+}
+  8026f6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8026fa:	5b                   	pop    %rbx
+  8026fb:	41 5c                	pop    %r12
+  8026fd:	41 5d                	pop    %r13
+  8026ff:	41 5e                	pop    %r14
+  802701:	41 5f                	pop    %r15
+  802703:	5d                   	pop    %rbp
+  802704:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802705:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802709:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270e:	49 f7 f7             	div    %r15
+  802711:	48 83 ec 08          	sub    $0x8,%rsp
+  802715:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802719:	52                   	push   %rdx
+  80271a:	45 0f be c9          	movsbl %r9b,%r9d
+  80271e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802722:	48 89 c2             	mov    %rax,%rdx
+  802725:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+  802731:	48 83 c4 10          	add    $0x10,%rsp
+  802735:	eb 8d                	jmp    8026c4 <print_num+0x43>
+
+0000000000802737 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802737:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80273b:	48 8b 06             	mov    (%rsi),%rax
+  80273e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802742:	73 0a                	jae    80274e <sprintputch+0x17>
+        *state->start++ = ch;
+  802744:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802748:	48 89 16             	mov    %rdx,(%rsi)
+  80274b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80274e:	c3                   	ret
+
+000000000080274f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	48 83 ec 50          	sub    $0x50,%rsp
+  802757:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80275b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80275f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802763:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80276a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80276e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802772:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802776:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80277a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80277e:	48 b8 8c 27 80 00 00 	movabs $0x80278c,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+}
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+
+000000000080278c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80278c:	55                   	push   %rbp
+  80278d:	48 89 e5             	mov    %rsp,%rbp
+  802790:	41 57                	push   %r15
+  802792:	41 56                	push   %r14
+  802794:	41 55                	push   %r13
+  802796:	41 54                	push   %r12
+  802798:	53                   	push   %rbx
+  802799:	48 83 ec 38          	sub    $0x38,%rsp
+  80279d:	49 89 fe             	mov    %rdi,%r14
+  8027a0:	49 89 f5             	mov    %rsi,%r13
+  8027a3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027a6:	48 8b 01             	mov    (%rcx),%rax
+  8027a9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ad:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027bd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027c1:	0f b6 3b             	movzbl (%rbx),%edi
+  8027c4:	40 80 ff 25          	cmp    $0x25,%dil
+  8027c8:	74 18                	je     8027e2 <vprintfmt+0x56>
+            if (!ch) return;
+  8027ca:	40 84 ff             	test   %dil,%dil
+  8027cd:	0f 84 b1 06 00 00    	je     802e84 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027d3:	40 0f b6 ff          	movzbl %dil,%edi
+  8027d7:	4c 89 ee             	mov    %r13,%rsi
+  8027da:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027dd:	4c 89 e3             	mov    %r12,%rbx
+  8027e0:	eb db                	jmp    8027bd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027eb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8027f0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027f6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8027fd:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802801:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802806:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80280b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80280e:	83 e8 23             	sub    $0x23,%eax
+  802811:	3c 57                	cmp    $0x57,%al
+  802813:	0f 87 51 06 00 00    	ja     802e6a <vprintfmt+0x6de>
+  802819:	0f b6 c0             	movzbl %al,%eax
+  80281c:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  802823:	00 00 00 
+  802826:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802829:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80282c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802830:	eb cf                	jmp    802801 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802832:	49 89 dc             	mov    %rbx,%r12
+  802835:	be 01 00 00 00       	mov    $0x1,%esi
+  80283a:	eb c5                	jmp    802801 <vprintfmt+0x75>
+            padc = ch;
+  80283c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802840:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802843:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802846:	eb b9                	jmp    802801 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802848:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80284b:	83 f8 2f             	cmp    $0x2f,%eax
+  80284e:	77 24                	ja     802874 <vprintfmt+0xe8>
+  802850:	89 c1                	mov    %eax,%ecx
+  802852:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802856:	83 c0 08             	add    $0x8,%eax
+  802859:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80285c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80285f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802862:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802866:	79 99                	jns    802801 <vprintfmt+0x75>
+                width = precision;
+  802868:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80286c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802872:	eb 8d                	jmp    802801 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802874:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802878:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80287c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802880:	eb da                	jmp    80285c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802882:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802887:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80288b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802891:	3c 39                	cmp    $0x39,%al
+  802893:	77 1c                	ja     8028b1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802895:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802899:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80289d:	0f b6 c0             	movzbl %al,%eax
+  8028a0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028a5:	0f b6 03             	movzbl (%rbx),%eax
+  8028a8:	3c 39                	cmp    $0x39,%al
+  8028aa:	76 e9                	jbe    802895 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028ac:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028af:	eb b1                	jmp    802862 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028b1:	49 89 dc             	mov    %rbx,%r12
+  8028b4:	eb ac                	jmp    802862 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028b6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028b9:	85 c9                	test   %ecx,%ecx
+  8028bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c0:	0f 49 c1             	cmovns %ecx,%eax
+  8028c3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028c6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028c9:	e9 33 ff ff ff       	jmp    802801 <vprintfmt+0x75>
+            lflag++;
+  8028ce:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028d1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028d4:	e9 28 ff ff ff       	jmp    802801 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8028df:	77 19                	ja     8028fa <vprintfmt+0x16e>
+  8028e1:	89 c2                	mov    %eax,%edx
+  8028e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028e7:	83 c0 08             	add    $0x8,%eax
+  8028ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028ed:	8b 3a                	mov    (%rdx),%edi
+  8028ef:	4c 89 ee             	mov    %r13,%rsi
+  8028f2:	41 ff d6             	call   *%r14
+            break;
+  8028f5:	e9 c3 fe ff ff       	jmp    8027bd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8028fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802906:	eb e5                	jmp    8028ed <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80290b:	83 f8 2f             	cmp    $0x2f,%eax
+  80290e:	77 5a                	ja     80296a <vprintfmt+0x1de>
+  802910:	89 c2                	mov    %eax,%edx
+  802912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802916:	83 c0 08             	add    $0x8,%eax
+  802919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80291c:	8b 02                	mov    (%rdx),%eax
+  80291e:	89 c1                	mov    %eax,%ecx
+  802920:	f7 d9                	neg    %ecx
+  802922:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802925:	83 f9 14             	cmp    $0x14,%ecx
+  802928:	7f 4e                	jg     802978 <vprintfmt+0x1ec>
+  80292a:	48 63 c1             	movslq %ecx,%rax
+  80292d:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  802934:	00 00 00 
+  802937:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80293b:	48 85 c0             	test   %rax,%rax
+  80293e:	74 38                	je     802978 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802940:	48 89 c1             	mov    %rax,%rcx
+  802943:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  80294a:	00 00 00 
+  80294d:	4c 89 ee             	mov    %r13,%rsi
+  802950:	4c 89 f7             	mov    %r14,%rdi
+  802953:	b8 00 00 00 00       	mov    $0x0,%eax
+  802958:	49 b8 4f 27 80 00 00 	movabs $0x80274f,%r8
+  80295f:	00 00 00 
+  802962:	41 ff d0             	call   *%r8
+  802965:	e9 53 fe ff ff       	jmp    8027bd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80296a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80296e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802972:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802976:	eb a4                	jmp    80291c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802978:	48 ba 2c 38 80 00 00 	movabs $0x80382c,%rdx
+  80297f:	00 00 00 
+  802982:	4c 89 ee             	mov    %r13,%rsi
+  802985:	4c 89 f7             	mov    %r14,%rdi
+  802988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298d:	49 b8 4f 27 80 00 00 	movabs $0x80274f,%r8
+  802994:	00 00 00 
+  802997:	41 ff d0             	call   *%r8
+  80299a:	e9 1e fe ff ff       	jmp    8027bd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80299f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8029a5:	77 6c                	ja     802a13 <vprintfmt+0x287>
+  8029a7:	89 c2                	mov    %eax,%edx
+  8029a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029ad:	83 c0 08             	add    $0x8,%eax
+  8029b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029b3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029b6:	48 85 d2             	test   %rdx,%rdx
+  8029b9:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8029c0:	00 00 00 
+  8029c3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029c7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029cb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029cf:	7e 06                	jle    8029d7 <vprintfmt+0x24b>
+  8029d1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029d5:	75 4a                	jne    802a21 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029d7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029db:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029df:	0f b6 00             	movzbl (%rax),%eax
+  8029e2:	84 c0                	test   %al,%al
+  8029e4:	0f 85 9a 00 00 00    	jne    802a84 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029ea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029ed:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8029f1:	85 c0                	test   %eax,%eax
+  8029f3:	0f 8e c4 fd ff ff    	jle    8027bd <vprintfmt+0x31>
+  8029f9:	4c 89 ee             	mov    %r13,%rsi
+  8029fc:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a01:	41 ff d6             	call   *%r14
+  802a04:	41 83 ec 01          	sub    $0x1,%r12d
+  802a08:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a0c:	75 eb                	jne    8029f9 <vprintfmt+0x26d>
+  802a0e:	e9 aa fd ff ff       	jmp    8027bd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a1f:	eb 92                	jmp    8029b3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a21:	49 63 f7             	movslq %r15d,%rsi
+  802a24:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a28:	48 b8 3e 2f 80 00 00 	movabs $0x802f3e,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+  802a34:	48 89 c2             	mov    %rax,%rdx
+  802a37:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a3a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a3c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a3f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a42:	85 c0                	test   %eax,%eax
+  802a44:	7e 91                	jle    8029d7 <vprintfmt+0x24b>
+  802a46:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a4b:	4c 89 ee             	mov    %r13,%rsi
+  802a4e:	44 89 e7             	mov    %r12d,%edi
+  802a51:	41 ff d6             	call   *%r14
+  802a54:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a58:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a5b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a5e:	75 eb                	jne    802a4b <vprintfmt+0x2bf>
+  802a60:	e9 72 ff ff ff       	jmp    8029d7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a65:	0f b6 f8             	movzbl %al,%edi
+  802a68:	4c 89 ee             	mov    %r13,%rsi
+  802a6b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a6e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a72:	49 83 c4 01          	add    $0x1,%r12
+  802a76:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a7c:	84 c0                	test   %al,%al
+  802a7e:	0f 84 66 ff ff ff    	je     8029ea <vprintfmt+0x25e>
+  802a84:	45 85 ff             	test   %r15d,%r15d
+  802a87:	78 0a                	js     802a93 <vprintfmt+0x307>
+  802a89:	41 83 ef 01          	sub    $0x1,%r15d
+  802a8d:	0f 88 57 ff ff ff    	js     8029ea <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a93:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802a97:	74 cc                	je     802a65 <vprintfmt+0x2d9>
+  802a99:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802a9c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802aa1:	80 fa 5e             	cmp    $0x5e,%dl
+  802aa4:	77 c2                	ja     802a68 <vprintfmt+0x2dc>
+  802aa6:	eb bd                	jmp    802a65 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802aa8:	40 84 f6             	test   %sil,%sil
+  802aab:	75 26                	jne    802ad3 <vprintfmt+0x347>
+    switch (lflag) {
+  802aad:	85 d2                	test   %edx,%edx
+  802aaf:	74 59                	je     802b0a <vprintfmt+0x37e>
+  802ab1:	83 fa 01             	cmp    $0x1,%edx
+  802ab4:	74 7b                	je     802b31 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802ab6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ab9:	83 f8 2f             	cmp    $0x2f,%eax
+  802abc:	0f 87 96 00 00 00    	ja     802b58 <vprintfmt+0x3cc>
+  802ac2:	89 c2                	mov    %eax,%edx
+  802ac4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ac8:	83 c0 08             	add    $0x8,%eax
+  802acb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ace:	4c 8b 22             	mov    (%rdx),%r12
+  802ad1:	eb 17                	jmp    802aea <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ad3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ad6:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad9:	77 21                	ja     802afc <vprintfmt+0x370>
+  802adb:	89 c2                	mov    %eax,%edx
+  802add:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ae1:	83 c0 08             	add    $0x8,%eax
+  802ae4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ae7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802aea:	4d 85 e4             	test   %r12,%r12
+  802aed:	78 7a                	js     802b69 <vprintfmt+0x3dd>
+            num = i;
+  802aef:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802af2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802af7:	e9 50 02 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802afc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b08:	eb dd                	jmp    802ae7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b0d:	83 f8 2f             	cmp    $0x2f,%eax
+  802b10:	77 11                	ja     802b23 <vprintfmt+0x397>
+  802b12:	89 c2                	mov    %eax,%edx
+  802b14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b18:	83 c0 08             	add    $0x8,%eax
+  802b1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b1e:	4c 63 22             	movslq (%rdx),%r12
+  802b21:	eb c7                	jmp    802aea <vprintfmt+0x35e>
+  802b23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b2f:	eb ed                	jmp    802b1e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b34:	83 f8 2f             	cmp    $0x2f,%eax
+  802b37:	77 11                	ja     802b4a <vprintfmt+0x3be>
+  802b39:	89 c2                	mov    %eax,%edx
+  802b3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b3f:	83 c0 08             	add    $0x8,%eax
+  802b42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b45:	4c 8b 22             	mov    (%rdx),%r12
+  802b48:	eb a0                	jmp    802aea <vprintfmt+0x35e>
+  802b4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b56:	eb ed                	jmp    802b45 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b64:	e9 65 ff ff ff       	jmp    802ace <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b69:	4c 89 ee             	mov    %r13,%rsi
+  802b6c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b71:	41 ff d6             	call   *%r14
+                i = -i;
+  802b74:	49 f7 dc             	neg    %r12
+  802b77:	e9 73 ff ff ff       	jmp    802aef <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b7c:	40 84 f6             	test   %sil,%sil
+  802b7f:	75 32                	jne    802bb3 <vprintfmt+0x427>
+    switch (lflag) {
+  802b81:	85 d2                	test   %edx,%edx
+  802b83:	74 5d                	je     802be2 <vprintfmt+0x456>
+  802b85:	83 fa 01             	cmp    $0x1,%edx
+  802b88:	0f 84 82 00 00 00    	je     802c10 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b91:	83 f8 2f             	cmp    $0x2f,%eax
+  802b94:	0f 87 a5 00 00 00    	ja     802c3f <vprintfmt+0x4b3>
+  802b9a:	89 c2                	mov    %eax,%edx
+  802b9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ba0:	83 c0 08             	add    $0x8,%eax
+  802ba3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ba6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802ba9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bae:	e9 99 01 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bb6:	83 f8 2f             	cmp    $0x2f,%eax
+  802bb9:	77 19                	ja     802bd4 <vprintfmt+0x448>
+  802bbb:	89 c2                	mov    %eax,%edx
+  802bbd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bc1:	83 c0 08             	add    $0x8,%eax
+  802bc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bc7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bcf:	e9 78 01 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+  802bd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802be0:	eb e5                	jmp    802bc7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802be2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802be5:	83 f8 2f             	cmp    $0x2f,%eax
+  802be8:	77 18                	ja     802c02 <vprintfmt+0x476>
+  802bea:	89 c2                	mov    %eax,%edx
+  802bec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bf0:	83 c0 08             	add    $0x8,%eax
+  802bf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bf6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802bf8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802bfd:	e9 4a 01 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+  802c02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c0e:	eb e6                	jmp    802bf6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c13:	83 f8 2f             	cmp    $0x2f,%eax
+  802c16:	77 19                	ja     802c31 <vprintfmt+0x4a5>
+  802c18:	89 c2                	mov    %eax,%edx
+  802c1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c1e:	83 c0 08             	add    $0x8,%eax
+  802c21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c24:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c27:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c2c:	e9 1b 01 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+  802c31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c3d:	eb e5                	jmp    802c24 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c4b:	e9 56 ff ff ff       	jmp    802ba6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c50:	40 84 f6             	test   %sil,%sil
+  802c53:	75 2e                	jne    802c83 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c55:	85 d2                	test   %edx,%edx
+  802c57:	74 59                	je     802cb2 <vprintfmt+0x526>
+  802c59:	83 fa 01             	cmp    $0x1,%edx
+  802c5c:	74 7f                	je     802cdd <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c61:	83 f8 2f             	cmp    $0x2f,%eax
+  802c64:	0f 87 9f 00 00 00    	ja     802d09 <vprintfmt+0x57d>
+  802c6a:	89 c2                	mov    %eax,%edx
+  802c6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c70:	83 c0 08             	add    $0x8,%eax
+  802c73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c76:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c79:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c7e:	e9 c9 00 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c86:	83 f8 2f             	cmp    $0x2f,%eax
+  802c89:	77 19                	ja     802ca4 <vprintfmt+0x518>
+  802c8b:	89 c2                	mov    %eax,%edx
+  802c8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c91:	83 c0 08             	add    $0x8,%eax
+  802c94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c9a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c9f:	e9 a8 00 00 00       	jmp    802d4c <vprintfmt+0x5c0>
+  802ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ca8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cb0:	eb e5                	jmp    802c97 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cb8:	77 15                	ja     802ccf <vprintfmt+0x543>
+  802cba:	89 c2                	mov    %eax,%edx
+  802cbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cc0:	83 c0 08             	add    $0x8,%eax
+  802cc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cc6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cc8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802ccd:	eb 7d                	jmp    802d4c <vprintfmt+0x5c0>
+  802ccf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cdb:	eb e9                	jmp    802cc6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  802ce3:	77 16                	ja     802cfb <vprintfmt+0x56f>
+  802ce5:	89 c2                	mov    %eax,%edx
+  802ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ceb:	83 c0 08             	add    $0x8,%eax
+  802cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cf1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cf4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802cf9:	eb 51                	jmp    802d4c <vprintfmt+0x5c0>
+  802cfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d07:	eb e8                	jmp    802cf1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d15:	e9 5c ff ff ff       	jmp    802c76 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d1a:	4c 89 ee             	mov    %r13,%rsi
+  802d1d:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d22:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d25:	4c 89 ee             	mov    %r13,%rsi
+  802d28:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d2d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d33:	83 f8 2f             	cmp    $0x2f,%eax
+  802d36:	77 47                	ja     802d7f <vprintfmt+0x5f3>
+  802d38:	89 c2                	mov    %eax,%edx
+  802d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d3e:	83 c0 08             	add    $0x8,%eax
+  802d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d47:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d4c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d50:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d54:	0f 94 c0             	sete   %al
+  802d57:	0f b6 c0             	movzbl %al,%eax
+  802d5a:	50                   	push   %rax
+  802d5b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d60:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d64:	4c 89 ee             	mov    %r13,%rsi
+  802d67:	4c 89 f7             	mov    %r14,%rdi
+  802d6a:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  802d71:	00 00 00 
+  802d74:	ff d0                	call   *%rax
+            break;
+  802d76:	48 83 c4 10          	add    $0x10,%rsp
+  802d7a:	e9 3e fa ff ff       	jmp    8027bd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d8b:	eb b7                	jmp    802d44 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d8d:	40 84 f6             	test   %sil,%sil
+  802d90:	75 2b                	jne    802dbd <vprintfmt+0x631>
+    switch (lflag) {
+  802d92:	85 d2                	test   %edx,%edx
+  802d94:	74 56                	je     802dec <vprintfmt+0x660>
+  802d96:	83 fa 01             	cmp    $0x1,%edx
+  802d99:	74 7f                	je     802e1a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802d9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d9e:	83 f8 2f             	cmp    $0x2f,%eax
+  802da1:	0f 87 a2 00 00 00    	ja     802e49 <vprintfmt+0x6bd>
+  802da7:	89 c2                	mov    %eax,%edx
+  802da9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dad:	83 c0 08             	add    $0x8,%eax
+  802db0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802db3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802db6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dbb:	eb 8f                	jmp    802d4c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  802dc3:	77 19                	ja     802dde <vprintfmt+0x652>
+  802dc5:	89 c2                	mov    %eax,%edx
+  802dc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dcb:	83 c0 08             	add    $0x8,%eax
+  802dce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dd1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dd4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dd9:	e9 6e ff ff ff       	jmp    802d4c <vprintfmt+0x5c0>
+  802dde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802de2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802de6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dea:	eb e5                	jmp    802dd1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802dec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802def:	83 f8 2f             	cmp    $0x2f,%eax
+  802df2:	77 18                	ja     802e0c <vprintfmt+0x680>
+  802df4:	89 c2                	mov    %eax,%edx
+  802df6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dfa:	83 c0 08             	add    $0x8,%eax
+  802dfd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e00:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e02:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e07:	e9 40 ff ff ff       	jmp    802d4c <vprintfmt+0x5c0>
+  802e0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e18:	eb e6                	jmp    802e00 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e1d:	83 f8 2f             	cmp    $0x2f,%eax
+  802e20:	77 19                	ja     802e3b <vprintfmt+0x6af>
+  802e22:	89 c2                	mov    %eax,%edx
+  802e24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e28:	83 c0 08             	add    $0x8,%eax
+  802e2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e31:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e36:	e9 11 ff ff ff       	jmp    802d4c <vprintfmt+0x5c0>
+  802e3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e47:	eb e5                	jmp    802e2e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e55:	e9 59 ff ff ff       	jmp    802db3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e5a:	4c 89 ee             	mov    %r13,%rsi
+  802e5d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e62:	41 ff d6             	call   *%r14
+            break;
+  802e65:	e9 53 f9 ff ff       	jmp    8027bd <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e6a:	4c 89 ee             	mov    %r13,%rsi
+  802e6d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e72:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e75:	48 83 eb 01          	sub    $0x1,%rbx
+  802e79:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e7d:	75 f6                	jne    802e75 <vprintfmt+0x6e9>
+  802e7f:	e9 39 f9 ff ff       	jmp    8027bd <vprintfmt+0x31>
+}
+  802e84:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e88:	5b                   	pop    %rbx
+  802e89:	41 5c                	pop    %r12
+  802e8b:	41 5d                	pop    %r13
+  802e8d:	41 5e                	pop    %r14
+  802e8f:	41 5f                	pop    %r15
+  802e91:	5d                   	pop    %rbp
+  802e92:	c3                   	ret
+
+0000000000802e93 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802e93:	55                   	push   %rbp
+  802e94:	48 89 e5             	mov    %rsp,%rbp
+  802e97:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802e9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e9f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ea4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ea8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802eaf:	48 85 ff             	test   %rdi,%rdi
+  802eb2:	74 2b                	je     802edf <vsnprintf+0x4c>
+  802eb4:	48 85 f6             	test   %rsi,%rsi
+  802eb7:	74 26                	je     802edf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802eb9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ebd:	48 bf 37 27 80 00 00 	movabs $0x802737,%rdi
+  802ec4:	00 00 00 
+  802ec7:	48 b8 8c 27 80 00 00 	movabs $0x80278c,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ed3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802eda:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802edd:	c9                   	leave
+  802ede:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ee4:	eb f7                	jmp    802edd <vsnprintf+0x4a>
+
+0000000000802ee6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802ee6:	55                   	push   %rbp
+  802ee7:	48 89 e5             	mov    %rsp,%rbp
+  802eea:	48 83 ec 50          	sub    $0x50,%rsp
+  802eee:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ef2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ef6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802efa:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f01:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f09:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f11:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f15:	48 b8 93 2e 80 00 00 	movabs $0x802e93,%rax
+  802f1c:	00 00 00 
+  802f1f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+0000000000802f23 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f23:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f26:	74 10                	je     802f38 <strlen+0x15>
+    size_t n = 0;
+  802f28:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f2d:	48 83 c0 01          	add    $0x1,%rax
+  802f31:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f35:	75 f6                	jne    802f2d <strlen+0xa>
+  802f37:	c3                   	ret
+    size_t n = 0;
+  802f38:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f3d:	c3                   	ret
+
+0000000000802f3e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f3e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f41:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f46:	48 85 f6             	test   %rsi,%rsi
+  802f49:	74 11                	je     802f5c <strnlen+0x1e>
+  802f4b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f4f:	74 0c                	je     802f5d <strnlen+0x1f>
+  802f51:	48 83 c2 01          	add    $0x1,%rdx
+  802f55:	48 39 d0             	cmp    %rdx,%rax
+  802f58:	75 f1                	jne    802f4b <strnlen+0xd>
+  802f5a:	eb 04                	jmp    802f60 <strnlen+0x22>
+  802f5c:	c3                   	ret
+  802f5d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f60:	c3                   	ret
+
+0000000000802f61 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f61:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f69:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f6d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f70:	48 83 c2 01          	add    $0x1,%rdx
+  802f74:	84 c9                	test   %cl,%cl
+  802f76:	75 f1                	jne    802f69 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f78:	c3                   	ret
+
+0000000000802f79 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f79:	55                   	push   %rbp
+  802f7a:	48 89 e5             	mov    %rsp,%rbp
+  802f7d:	41 54                	push   %r12
+  802f7f:	53                   	push   %rbx
+  802f80:	48 89 fb             	mov    %rdi,%rbx
+  802f83:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f86:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802f92:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802f96:	4c 89 e6             	mov    %r12,%rsi
+  802f99:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+    return dst;
+}
+  802fa5:	48 89 d8             	mov    %rbx,%rax
+  802fa8:	5b                   	pop    %rbx
+  802fa9:	41 5c                	pop    %r12
+  802fab:	5d                   	pop    %rbp
+  802fac:	c3                   	ret
+
+0000000000802fad <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fad:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fb0:	48 85 d2             	test   %rdx,%rdx
+  802fb3:	74 1f                	je     802fd4 <strncpy+0x27>
+  802fb5:	48 01 fa             	add    %rdi,%rdx
+  802fb8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fbb:	48 83 c1 01          	add    $0x1,%rcx
+  802fbf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fc3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fc7:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fcb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fcf:	48 39 ca             	cmp    %rcx,%rdx
+  802fd2:	75 e7                	jne    802fbb <strncpy+0xe>
+    }
+    return ret;
+}
+  802fd4:	c3                   	ret
+
+0000000000802fd5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fd5:	48 89 f8             	mov    %rdi,%rax
+  802fd8:	48 85 d2             	test   %rdx,%rdx
+  802fdb:	74 24                	je     803001 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fdd:	48 83 ea 01          	sub    $0x1,%rdx
+  802fe1:	74 1b                	je     802ffe <strlcpy+0x29>
+  802fe3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fe7:	0f b6 16             	movzbl (%rsi),%edx
+  802fea:	84 d2                	test   %dl,%dl
+  802fec:	74 10                	je     802ffe <strlcpy+0x29>
+            *dst++ = *src++;
+  802fee:	48 83 c6 01          	add    $0x1,%rsi
+  802ff2:	48 83 c0 01          	add    $0x1,%rax
+  802ff6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802ff9:	48 39 c8             	cmp    %rcx,%rax
+  802ffc:	75 e9                	jne    802fe7 <strlcpy+0x12>
+        *dst = '\0';
+  802ffe:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803001:	48 29 f8             	sub    %rdi,%rax
+}
+  803004:	c3                   	ret
+
+0000000000803005 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803005:	0f b6 07             	movzbl (%rdi),%eax
+  803008:	84 c0                	test   %al,%al
+  80300a:	74 13                	je     80301f <strcmp+0x1a>
+  80300c:	38 06                	cmp    %al,(%rsi)
+  80300e:	75 0f                	jne    80301f <strcmp+0x1a>
+  803010:	48 83 c7 01          	add    $0x1,%rdi
+  803014:	48 83 c6 01          	add    $0x1,%rsi
+  803018:	0f b6 07             	movzbl (%rdi),%eax
+  80301b:	84 c0                	test   %al,%al
+  80301d:	75 ed                	jne    80300c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80301f:	0f b6 c0             	movzbl %al,%eax
+  803022:	0f b6 16             	movzbl (%rsi),%edx
+  803025:	29 d0                	sub    %edx,%eax
+}
+  803027:	c3                   	ret
+
+0000000000803028 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803028:	48 85 d2             	test   %rdx,%rdx
+  80302b:	74 1f                	je     80304c <strncmp+0x24>
+  80302d:	0f b6 07             	movzbl (%rdi),%eax
+  803030:	84 c0                	test   %al,%al
+  803032:	74 1e                	je     803052 <strncmp+0x2a>
+  803034:	3a 06                	cmp    (%rsi),%al
+  803036:	75 1a                	jne    803052 <strncmp+0x2a>
+  803038:	48 83 c7 01          	add    $0x1,%rdi
+  80303c:	48 83 c6 01          	add    $0x1,%rsi
+  803040:	48 83 ea 01          	sub    $0x1,%rdx
+  803044:	75 e7                	jne    80302d <strncmp+0x5>
+
+    if (!n) return 0;
+  803046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304b:	c3                   	ret
+  80304c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803051:	c3                   	ret
+  803052:	48 85 d2             	test   %rdx,%rdx
+  803055:	74 09                	je     803060 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803057:	0f b6 07             	movzbl (%rdi),%eax
+  80305a:	0f b6 16             	movzbl (%rsi),%edx
+  80305d:	29 d0                	sub    %edx,%eax
+  80305f:	c3                   	ret
+    if (!n) return 0;
+  803060:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803065:	c3                   	ret
+
+0000000000803066 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803066:	0f b6 17             	movzbl (%rdi),%edx
+  803069:	84 d2                	test   %dl,%dl
+  80306b:	74 18                	je     803085 <strchr+0x1f>
+        if (*str == c) {
+  80306d:	0f be d2             	movsbl %dl,%edx
+  803070:	39 f2                	cmp    %esi,%edx
+  803072:	74 17                	je     80308b <strchr+0x25>
+    for (; *str; str++) {
+  803074:	48 83 c7 01          	add    $0x1,%rdi
+  803078:	0f b6 17             	movzbl (%rdi),%edx
+  80307b:	84 d2                	test   %dl,%dl
+  80307d:	75 ee                	jne    80306d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80307f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803084:	c3                   	ret
+  803085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308a:	c3                   	ret
+  80308b:	48 89 f8             	mov    %rdi,%rax
+}
+  80308e:	c3                   	ret
+
+000000000080308f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80308f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803092:	0f b6 17             	movzbl (%rdi),%edx
+  803095:	84 d2                	test   %dl,%dl
+  803097:	74 13                	je     8030ac <strfind+0x1d>
+  803099:	0f be d2             	movsbl %dl,%edx
+  80309c:	39 f2                	cmp    %esi,%edx
+  80309e:	74 0b                	je     8030ab <strfind+0x1c>
+  8030a0:	48 83 c0 01          	add    $0x1,%rax
+  8030a4:	0f b6 10             	movzbl (%rax),%edx
+  8030a7:	84 d2                	test   %dl,%dl
+  8030a9:	75 ee                	jne    803099 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030ab:	c3                   	ret
+  8030ac:	c3                   	ret
+
+00000000008030ad <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030ad:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030b0:	48 89 f8             	mov    %rdi,%rax
+  8030b3:	48 f7 d8             	neg    %rax
+  8030b6:	83 e0 07             	and    $0x7,%eax
+  8030b9:	49 89 d1             	mov    %rdx,%r9
+  8030bc:	49 29 c1             	sub    %rax,%r9
+  8030bf:	78 36                	js     8030f7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030c1:	40 0f b6 c6          	movzbl %sil,%eax
+  8030c5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030cc:	01 01 01 
+  8030cf:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030d3:	40 f6 c7 07          	test   $0x7,%dil
+  8030d7:	75 38                	jne    803111 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030d9:	4c 89 c9             	mov    %r9,%rcx
+  8030dc:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030e0:	74 0c                	je     8030ee <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030e2:	fc                   	cld
+  8030e3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030e6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030ea:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030ee:	4d 85 c9             	test   %r9,%r9
+  8030f1:	75 45                	jne    803138 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8030f3:	4c 89 c0             	mov    %r8,%rax
+  8030f6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8030f7:	48 85 d2             	test   %rdx,%rdx
+  8030fa:	74 f7                	je     8030f3 <memset+0x46>
+  8030fc:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8030ff:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803102:	48 83 c0 01          	add    $0x1,%rax
+  803106:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80310a:	48 39 c2             	cmp    %rax,%rdx
+  80310d:	75 f3                	jne    803102 <memset+0x55>
+  80310f:	eb e2                	jmp    8030f3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803111:	40 f6 c7 01          	test   $0x1,%dil
+  803115:	74 06                	je     80311d <memset+0x70>
+  803117:	88 07                	mov    %al,(%rdi)
+  803119:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80311d:	40 f6 c7 02          	test   $0x2,%dil
+  803121:	74 07                	je     80312a <memset+0x7d>
+  803123:	66 89 07             	mov    %ax,(%rdi)
+  803126:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80312a:	40 f6 c7 04          	test   $0x4,%dil
+  80312e:	74 a9                	je     8030d9 <memset+0x2c>
+  803130:	89 07                	mov    %eax,(%rdi)
+  803132:	48 83 c7 04          	add    $0x4,%rdi
+  803136:	eb a1                	jmp    8030d9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803138:	41 f6 c1 04          	test   $0x4,%r9b
+  80313c:	74 06                	je     803144 <memset+0x97>
+  80313e:	89 07                	mov    %eax,(%rdi)
+  803140:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803144:	41 f6 c1 02          	test   $0x2,%r9b
+  803148:	74 07                	je     803151 <memset+0xa4>
+  80314a:	66 89 07             	mov    %ax,(%rdi)
+  80314d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803151:	41 f6 c1 01          	test   $0x1,%r9b
+  803155:	74 9c                	je     8030f3 <memset+0x46>
+  803157:	88 07                	mov    %al,(%rdi)
+  803159:	eb 98                	jmp    8030f3 <memset+0x46>
+
+000000000080315b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80315b:	48 89 f8             	mov    %rdi,%rax
+  80315e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803161:	48 39 fe             	cmp    %rdi,%rsi
+  803164:	73 3b                	jae    8031a1 <memmove+0x46>
+  803166:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80316a:	48 39 d7             	cmp    %rdx,%rdi
+  80316d:	73 32                	jae    8031a1 <memmove+0x46>
+        s += n;
+        d += n;
+  80316f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803173:	48 89 d6             	mov    %rdx,%rsi
+  803176:	48 09 fe             	or     %rdi,%rsi
+  803179:	48 09 ce             	or     %rcx,%rsi
+  80317c:	40 f6 c6 07          	test   $0x7,%sil
+  803180:	75 12                	jne    803194 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803182:	48 83 ef 08          	sub    $0x8,%rdi
+  803186:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80318a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80318e:	fd                   	std
+  80318f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803192:	fc                   	cld
+  803193:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803194:	48 83 ef 01          	sub    $0x1,%rdi
+  803198:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80319c:	fd                   	std
+  80319d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80319f:	eb f1                	jmp    803192 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031a1:	48 89 f2             	mov    %rsi,%rdx
+  8031a4:	48 09 c2             	or     %rax,%rdx
+  8031a7:	48 09 ca             	or     %rcx,%rdx
+  8031aa:	f6 c2 07             	test   $0x7,%dl
+  8031ad:	75 0c                	jne    8031bb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031af:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031b3:	48 89 c7             	mov    %rax,%rdi
+  8031b6:	fc                   	cld
+  8031b7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031ba:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031bb:	48 89 c7             	mov    %rax,%rdi
+  8031be:	fc                   	cld
+  8031bf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031c1:	c3                   	ret
+
+00000000008031c2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031c2:	55                   	push   %rbp
+  8031c3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031c6:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  8031cd:	00 00 00 
+  8031d0:	ff d0                	call   *%rax
+}
+  8031d2:	5d                   	pop    %rbp
+  8031d3:	c3                   	ret
+
+00000000008031d4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031d4:	55                   	push   %rbp
+  8031d5:	48 89 e5             	mov    %rsp,%rbp
+  8031d8:	41 57                	push   %r15
+  8031da:	41 56                	push   %r14
+  8031dc:	41 55                	push   %r13
+  8031de:	41 54                	push   %r12
+  8031e0:	53                   	push   %rbx
+  8031e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e5:	49 89 fe             	mov    %rdi,%r14
+  8031e8:	49 89 f7             	mov    %rsi,%r15
+  8031eb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031ee:	48 89 f7             	mov    %rsi,%rdi
+  8031f1:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803200:	48 89 de             	mov    %rbx,%rsi
+  803203:	4c 89 f7             	mov    %r14,%rdi
+  803206:	48 b8 3e 2f 80 00 00 	movabs $0x802f3e,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+  803212:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803215:	48 39 c3             	cmp    %rax,%rbx
+  803218:	74 36                	je     803250 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80321a:	48 89 d8             	mov    %rbx,%rax
+  80321d:	4c 29 e8             	sub    %r13,%rax
+  803220:	49 39 c4             	cmp    %rax,%r12
+  803223:	73 31                	jae    803256 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803225:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80322a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80322e:	4c 89 fe             	mov    %r15,%rsi
+  803231:	48 b8 c2 31 80 00 00 	movabs $0x8031c2,%rax
+  803238:	00 00 00 
+  80323b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80323d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803241:	48 83 c4 08          	add    $0x8,%rsp
+  803245:	5b                   	pop    %rbx
+  803246:	41 5c                	pop    %r12
+  803248:	41 5d                	pop    %r13
+  80324a:	41 5e                	pop    %r14
+  80324c:	41 5f                	pop    %r15
+  80324e:	5d                   	pop    %rbp
+  80324f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803250:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803254:	eb eb                	jmp    803241 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803256:	48 83 eb 01          	sub    $0x1,%rbx
+  80325a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80325e:	48 89 da             	mov    %rbx,%rdx
+  803261:	4c 89 fe             	mov    %r15,%rsi
+  803264:	48 b8 c2 31 80 00 00 	movabs $0x8031c2,%rax
+  80326b:	00 00 00 
+  80326e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803270:	49 01 de             	add    %rbx,%r14
+  803273:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803278:	eb c3                	jmp    80323d <strlcat+0x69>
+
+000000000080327a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80327a:	48 85 d2             	test   %rdx,%rdx
+  80327d:	74 2d                	je     8032ac <memcmp+0x32>
+  80327f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803284:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803288:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80328d:	44 38 c1             	cmp    %r8b,%cl
+  803290:	75 0f                	jne    8032a1 <memcmp+0x27>
+    while (n-- > 0) {
+  803292:	48 83 c0 01          	add    $0x1,%rax
+  803296:	48 39 c2             	cmp    %rax,%rdx
+  803299:	75 e9                	jne    803284 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80329b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032a1:	0f b6 c1             	movzbl %cl,%eax
+  8032a4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032a8:	44 29 c0             	sub    %r8d,%eax
+  8032ab:	c3                   	ret
+    return 0;
+  8032ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b1:	c3                   	ret
+
+00000000008032b2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032b2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032b6:	48 39 c7             	cmp    %rax,%rdi
+  8032b9:	73 0f                	jae    8032ca <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032bb:	40 38 37             	cmp    %sil,(%rdi)
+  8032be:	74 0e                	je     8032ce <memfind+0x1c>
+    for (; src < end; src++) {
+  8032c0:	48 83 c7 01          	add    $0x1,%rdi
+  8032c4:	48 39 f8             	cmp    %rdi,%rax
+  8032c7:	75 f2                	jne    8032bb <memfind+0x9>
+  8032c9:	c3                   	ret
+  8032ca:	48 89 f8             	mov    %rdi,%rax
+  8032cd:	c3                   	ret
+  8032ce:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032d1:	c3                   	ret
+
+00000000008032d2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032d2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032d5:	0f b6 37             	movzbl (%rdi),%esi
+  8032d8:	40 80 fe 20          	cmp    $0x20,%sil
+  8032dc:	74 06                	je     8032e4 <strtol+0x12>
+  8032de:	40 80 fe 09          	cmp    $0x9,%sil
+  8032e2:	75 13                	jne    8032f7 <strtol+0x25>
+  8032e4:	48 83 c7 01          	add    $0x1,%rdi
+  8032e8:	0f b6 37             	movzbl (%rdi),%esi
+  8032eb:	40 80 fe 20          	cmp    $0x20,%sil
+  8032ef:	74 f3                	je     8032e4 <strtol+0x12>
+  8032f1:	40 80 fe 09          	cmp    $0x9,%sil
+  8032f5:	74 ed                	je     8032e4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8032f7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8032fa:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032fd:	3c 01                	cmp    $0x1,%al
+  8032ff:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803303:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803309:	75 0f                	jne    80331a <strtol+0x48>
+  80330b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80330e:	74 14                	je     803324 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803310:	85 d2                	test   %edx,%edx
+  803312:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803317:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80331f:	4c 63 ca             	movslq %edx,%r9
+  803322:	eb 36                	jmp    80335a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803324:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803328:	74 0f                	je     803339 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80332a:	85 d2                	test   %edx,%edx
+  80332c:	75 ec                	jne    80331a <strtol+0x48>
+        s++;
+  80332e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803332:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803337:	eb e1                	jmp    80331a <strtol+0x48>
+        s += 2;
+  803339:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80333d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803342:	eb d6                	jmp    80331a <strtol+0x48>
+            dig -= '0';
+  803344:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803347:	44 0f b6 c1          	movzbl %cl,%r8d
+  80334b:	41 39 d0             	cmp    %edx,%r8d
+  80334e:	7d 21                	jge    803371 <strtol+0x9f>
+        val = val * base + dig;
+  803350:	49 0f af c1          	imul   %r9,%rax
+  803354:	0f b6 c9             	movzbl %cl,%ecx
+  803357:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80335a:	48 83 c7 01          	add    $0x1,%rdi
+  80335e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803362:	80 f9 39             	cmp    $0x39,%cl
+  803365:	76 dd                	jbe    803344 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803367:	80 f9 7b             	cmp    $0x7b,%cl
+  80336a:	77 05                	ja     803371 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80336c:	83 e9 57             	sub    $0x57,%ecx
+  80336f:	eb d6                	jmp    803347 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803371:	4d 85 d2             	test   %r10,%r10
+  803374:	74 03                	je     803379 <strtol+0xa7>
+  803376:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803379:	48 89 c2             	mov    %rax,%rdx
+  80337c:	48 f7 da             	neg    %rdx
+  80337f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803383:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803387:	c3                   	ret
+
+0000000000803388 <strrev>:
+
+void
+strrev(char *str)
+{
+  803388:	55                   	push   %rbp
+  803389:	48 89 e5             	mov    %rsp,%rbp
+  80338c:	53                   	push   %rbx
+  80338d:	48 83 ec 08          	sub    $0x8,%rsp
+  803391:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  803394:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  80339b:	00 00 00 
+  80339e:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033a0:	83 e8 01             	sub    $0x1,%eax
+  8033a3:	85 c0                	test   %eax,%eax
+  8033a5:	7e 22                	jle    8033c9 <strrev+0x41>
+  8033a7:	48 98                	cltq
+  8033a9:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033ae:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033b2:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033b6:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033ba:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033bd:	48 83 c2 01          	add    $0x1,%rdx
+  8033c1:	48 83 e8 01          	sub    $0x1,%rax
+  8033c5:	39 c2                	cmp    %eax,%edx
+  8033c7:	7c e5                	jl     8033ae <strrev+0x26>
+	}
+}
+  8033c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033cd:	c9                   	leave
+  8033ce:	c3                   	ret
+
+00000000008033cf <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033cf:	85 d2                	test   %edx,%edx
+  8033d1:	0f 84 80 00 00 00    	je     803457 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033d7:	55                   	push   %rbp
+  8033d8:	48 89 e5             	mov    %rsp,%rbp
+  8033db:	53                   	push   %rbx
+  8033dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8033e0:	49 89 f2             	mov    %rsi,%r10
+  8033e3:	41 89 d3             	mov    %edx,%r11d
+  8033e6:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033e9:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033ee:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8033f1:	eb 20                	jmp    803413 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8033f3:	41 89 f1             	mov    %esi,%r9d
+  8033f6:	83 c2 30             	add    $0x30,%edx
+  8033f9:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8033fc:	89 f8                	mov    %edi,%eax
+  8033fe:	99                   	cltd
+  8033ff:	f7 f9                	idiv   %ecx
+  803401:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803403:	85 c0                	test   %eax,%eax
+  803405:	74 2e                	je     803435 <itoa+0x66>
+  803407:	83 c6 01             	add    $0x1,%esi
+  80340a:	49 83 c0 01          	add    $0x1,%r8
+  80340e:	44 39 cb             	cmp    %r9d,%ebx
+  803411:	7e 15                	jle    803428 <itoa+0x59>
+		digit = sum % base;
+  803413:	89 f8                	mov    %edi,%eax
+  803415:	99                   	cltd
+  803416:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803418:	83 fa 09             	cmp    $0x9,%edx
+  80341b:	7e d6                	jle    8033f3 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80341d:	41 89 f1             	mov    %esi,%r9d
+  803420:	83 c2 37             	add    $0x37,%edx
+  803423:	41 88 10             	mov    %dl,(%r8)
+  803426:	eb d4                	jmp    8033fc <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803428:	41 83 eb 01          	sub    $0x1,%r11d
+  80342c:	45 39 cb             	cmp    %r9d,%r11d
+  80342f:	75 04                	jne    803435 <itoa+0x66>
+  803431:	85 c0                	test   %eax,%eax
+  803433:	75 28                	jne    80345d <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  803435:	4d 63 c9             	movslq %r9d,%r9
+  803438:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80343d:	4c 89 d7             	mov    %r10,%rdi
+  803440:	48 b8 88 33 80 00 00 	movabs $0x803388,%rax
+  803447:	00 00 00 
+  80344a:	ff d0                	call   *%rax
+	return 0;
+  80344c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+		return -1;
+  803457:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80345c:	c3                   	ret
+		return -1;
+  80345d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803462:	eb ed                	jmp    803451 <itoa+0x82>
+
+0000000000803464 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803464:	55                   	push   %rbp
+  803465:	48 89 e5             	mov    %rsp,%rbp
+  803468:	41 55                	push   %r13
+  80346a:	41 54                	push   %r12
+  80346c:	53                   	push   %rbx
+  80346d:	48 83 ec 08          	sub    $0x8,%rsp
+  803471:	49 89 fc             	mov    %rdi,%r12
+  803474:	48 89 f7             	mov    %rsi,%rdi
+  803477:	48 89 d3             	mov    %rdx,%rbx
+  80347a:	49 89 cd             	mov    %rcx,%r13
+  80347d:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803480:	48 85 f6             	test   %rsi,%rsi
+  803483:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80348a:	00 00 00 
+  80348d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803491:	be 00 10 00 00       	mov    $0x1000,%esi
+  803496:	48 85 db             	test   %rbx,%rbx
+  803499:	74 03                	je     80349e <ipc_recv_timed+0x3a>
+  80349b:	48 8b 33             	mov    (%rbx),%rsi
+  80349e:	48 b8 25 05 80 00 00 	movabs $0x800525,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034aa:	85 c0                	test   %eax,%eax
+  8034ac:	78 75                	js     803523 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034ae:	4d 85 e4             	test   %r12,%r12
+  8034b1:	74 14                	je     8034c7 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034b3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ba:	00 00 00 
+  8034bd:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034c3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034c7:	4d 85 ed             	test   %r13,%r13
+  8034ca:	74 14                	je     8034e0 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034cc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d3:	00 00 00 
+  8034d6:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034dc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034e0:	48 85 db             	test   %rbx,%rbx
+  8034e3:	74 23                	je     803508 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034e5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ec:	00 00 00 
+  8034ef:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8034f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034fa:	85 c9                	test   %ecx,%ecx
+  8034fc:	74 07                	je     803505 <ipc_recv_timed+0xa1>
+  8034fe:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803505:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803508:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80350f:	00 00 00 
+  803512:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803518:	48 83 c4 08          	add    $0x8,%rsp
+  80351c:	5b                   	pop    %rbx
+  80351d:	41 5c                	pop    %r12
+  80351f:	41 5d                	pop    %r13
+  803521:	5d                   	pop    %rbp
+  803522:	c3                   	ret
+        if (from_env_store != NULL) {
+  803523:	4d 85 e4             	test   %r12,%r12
+  803526:	74 08                	je     803530 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803528:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80352f:	00 
+        if (perm_store != NULL) {
+  803530:	4d 85 ed             	test   %r13,%r13
+  803533:	74 08                	je     80353d <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803535:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80353c:	00 
+        if (size != NULL) {
+  80353d:	48 85 db             	test   %rbx,%rbx
+  803540:	74 d6                	je     803518 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803542:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803549:	eb cd                	jmp    803518 <ipc_recv_timed+0xb4>
+
+000000000080354b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80354b:	55                   	push   %rbp
+  80354c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80354f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803555:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+}
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+
+0000000000803563 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+  803567:	41 57                	push   %r15
+  803569:	41 56                	push   %r14
+  80356b:	41 55                	push   %r13
+  80356d:	41 54                	push   %r12
+  80356f:	53                   	push   %rbx
+  803570:	48 83 ec 18          	sub    $0x18,%rsp
+  803574:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803577:	48 89 d3             	mov    %rdx,%rbx
+  80357a:	49 89 cc             	mov    %rcx,%r12
+  80357d:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803580:	48 85 d2             	test   %rdx,%rdx
+  803583:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80358a:	00 00 00 
+  80358d:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803591:	89 f0                	mov    %esi,%eax
+  803593:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803597:	48 89 da             	mov    %rbx,%rdx
+  80359a:	48 89 c6             	mov    %rax,%rsi
+  80359d:	48 b8 f9 04 80 00 00 	movabs $0x8004f9,%rax
+  8035a4:	00 00 00 
+  8035a7:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	79 65                	jns    803612 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035ad:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035b0:	75 33                	jne    8035e5 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035b2:	49 bf fc 01 80 00 00 	movabs $0x8001fc,%r15
+  8035b9:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035bc:	49 be f9 04 80 00 00 	movabs $0x8004f9,%r14
+  8035c3:	00 00 00 
+        sys_yield();
+  8035c6:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035c9:	45 89 e8             	mov    %r13d,%r8d
+  8035cc:	4c 89 e1             	mov    %r12,%rcx
+  8035cf:	48 89 da             	mov    %rbx,%rdx
+  8035d2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035d6:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035d9:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035dc:	85 c0                	test   %eax,%eax
+  8035de:	79 32                	jns    803612 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035e0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035e3:	74 e1                	je     8035c6 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035e5:	89 c1                	mov    %eax,%ecx
+  8035e7:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  8035ee:	00 00 00 
+  8035f1:	be 52 00 00 00       	mov    $0x52,%esi
+  8035f6:	48 bf 3b 3d 80 00 00 	movabs $0x803d3b,%rdi
+  8035fd:	00 00 00 
+  803600:	b8 00 00 00 00       	mov    $0x0,%eax
+  803605:	49 b8 ec 24 80 00 00 	movabs $0x8024ec,%r8
+  80360c:	00 00 00 
+  80360f:	41 ff d0             	call   *%r8
+    }
+}
+  803612:	48 83 c4 18          	add    $0x18,%rsp
+  803616:	5b                   	pop    %rbx
+  803617:	41 5c                	pop    %r12
+  803619:	41 5d                	pop    %r13
+  80361b:	41 5e                	pop    %r14
+  80361d:	41 5f                	pop    %r15
+  80361f:	5d                   	pop    %rbp
+  803620:	c3                   	ret
+
+0000000000803621 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803621:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803626:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80362d:	00 00 00 
+  803630:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803634:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803638:	48 c1 e2 04          	shl    $0x4,%rdx
+  80363c:	48 01 ca             	add    %rcx,%rdx
+  80363f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803645:	39 fa                	cmp    %edi,%edx
+  803647:	74 12                	je     80365b <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803649:	48 83 c0 01          	add    $0x1,%rax
+  80364d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803653:	75 db                	jne    803630 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803655:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80365a:	c3                   	ret
+            return envs[i].env_id;
+  80365b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80365f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803663:	48 c1 e2 04          	shl    $0x4,%rdx
+  803667:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80366e:	00 00 00 
+  803671:	48 01 d0             	add    %rdx,%rax
+  803674:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80367a:	c3                   	ret
+  80367b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803680 <__rodata_start>:
+  803680:	3c 75                	cmp    $0x75,%al
+  803682:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803683:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803687:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803688:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  80368c:	1f                   	(bad)
+  80368d:	44 00 00             	add    %r8b,(%rax)
+  803690:	73 79                	jae    80370b <__rodata_start+0x8b>
+  803692:	73 63                	jae    8036f7 <__rodata_start+0x77>
+  803694:	61                   	(bad)
+  803695:	6c                   	insb   (%dx),%es:(%rdi)
+  803696:	6c                   	insb   (%dx),%es:(%rdi)
+  803697:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b17 <__bss_end+0x72201b17>
+  80369d:	65 74 75             	gs je  803715 <__rodata_start+0x95>
+  8036a0:	72 6e                	jb     803710 <__rodata_start+0x90>
+  8036a2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b24 <__bss_end+0x28201b24>
+  8036a9:	28 
+  8036aa:	3e 20 30             	ds and %dh,(%rax)
+  8036ad:	29 00                	sub    %eax,(%rax)
+  8036af:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036b7:	61                   	(bad)
+  8036b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ba:	2e 63 00             	cs movsxd (%rax),%eax
+  8036bd:	0f 1f 00             	nopl   (%rax)
+  8036c0:	5b                   	pop    %rbx
+  8036c1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036c6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036c9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036cd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ce:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036d2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036d9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804144 <devpipe+0x84>
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036e6:	20 72 65             	and    %dh,0x65(%rdx)
+  8036e9:	61                   	(bad)
+  8036ea:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036ec:	61                   	(bad)
+  8036ed:	70 20                	jo     80370f <__rodata_start+0x8f>
+  8036ef:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8036f4:	20 62 61             	and    %ah,0x61(%rdx)
+  8036f7:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8036fb:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8036ff:	00 5b 25             	add    %bl,0x25(%rbx)
+  803702:	30 38                	xor    %bh,(%rax)
+  803704:	78 5d                	js     803763 <devtab+0x3>
+  803706:	20 66 74             	and    %ah,0x74(%rsi)
+  803709:	72 75                	jb     803780 <devtab+0x20>
+  80370b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80370f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad577a <__bss_end+0x2d2cd77a>
+  803716:	20 62 61             	and    %ah,0x61(%rdx)
+  803719:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80371d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803721:	5b                   	pop    %rbx
+  803722:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803727:	20 72 65             	and    %dh,0x65(%rdx)
+  80372a:	61                   	(bad)
+  80372b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad5796 <__bss_end+0x2d2cd796>
+  803732:	20 62 61             	and    %ah,0x61(%rdx)
+  803735:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803739:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80373d:	5b                   	pop    %rbx
+  80373e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803743:	20 77 72             	and    %dh,0x72(%rdi)
+  803746:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80374d:	2d 
+  80374e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803753:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803756:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80375a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803770:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8037e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8037f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8038e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8038f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803990:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039a0:	29 28 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     )(......j.......
+  8039b0:	5a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     Z.......j.......
+  8039c0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  8039d0:	6a 2e 80 00 00 00 00 00 48 28 80 00 00 00 00 00     j.......H(......
+  8039e0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  8039f0:	3c 28 80 00 00 00 00 00 b6 28 80 00 00 00 00 00     <(.......(......
+  803a00:	6a 2e 80 00 00 00 00 00 3c 28 80 00 00 00 00 00     j.......<(......
+  803a10:	82 28 80 00 00 00 00 00 82 28 80 00 00 00 00 00     .(.......(......
+  803a20:	82 28 80 00 00 00 00 00 82 28 80 00 00 00 00 00     .(.......(......
+  803a30:	82 28 80 00 00 00 00 00 82 28 80 00 00 00 00 00     .(.......(......
+  803a40:	82 28 80 00 00 00 00 00 82 28 80 00 00 00 00 00     .(.......(......
+  803a50:	82 28 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     .(......j.......
+  803a60:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803a70:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803a80:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803a90:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803aa0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803ab0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803ac0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803ad0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803ae0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803af0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b00:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b10:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b20:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b30:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b40:	6a 2e 80 00 00 00 00 00 8d 2d 80 00 00 00 00 00     j........-......
+  803b50:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b60:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b70:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b80:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803b90:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803ba0:	d9 28 80 00 00 00 00 00 a8 2a 80 00 00 00 00 00     .(.......*......
+  803bb0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803bc0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803bd0:	08 29 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     .)......j.......
+  803be0:	6a 2e 80 00 00 00 00 00 ce 28 80 00 00 00 00 00     j........(......
+  803bf0:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803c00:	50 2c 80 00 00 00 00 00 1a 2d 80 00 00 00 00 00     P,.......-......
+  803c10:	6a 2e 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     j.......j.......
+  803c20:	9f 29 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     .)......j.......
+  803c30:	7c 2b 80 00 00 00 00 00 6a 2e 80 00 00 00 00 00     |+......j.......
+  803c40:	6a 2e 80 00 00 00 00 00 8d 2d 80 00 00 00 00 00     j........-......
+  803c50:	6a 2e 80 00 00 00 00 00 32 28 80 00 00 00 00 00     j.......2(......
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	35 38 80 00 00 00 00 00 47 38 80 00 00 00 00 00     58......G8......
+  803c78:	57 38 80 00 00 00 00 00 69 38 80 00 00 00 00 00     W8......i8......
+  803c88:	77 38 80 00 00 00 00 00 8b 38 80 00 00 00 00 00     w8.......8......
+  803c98:	a0 38 80 00 00 00 00 00 b3 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	c5 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	e9 38 80 00 00 00 00 00 fc 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	13 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803cd8:	41 39 80 00 00 00 00 00 59 39 80 00 00 00 00 00     A9......Y9......
+  803ce8:	66 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     f9.......=......
+  803cf8:	7a 39 80 00 00 00 00 00 92 39 80 00 00 00 00 00     z9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d28:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d38:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,6615 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	41 89 fd             	mov    %edi,%r13d
+  800044:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800047:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80004e:	00 00 00 
+  800051:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800058:	00 00 00 
+  80005b:	48 39 c2             	cmp    %rax,%rdx
+  80005e:	73 17                	jae    800077 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800060:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	49 89 c4             	mov    %rax,%r12
+  800066:	48 83 c3 08          	add    $0x8,%rbx
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	ff 53 f8             	call   *-0x8(%rbx)
+  800072:	4c 39 e3             	cmp    %r12,%rbx
+  800075:	72 ef                	jb     800066 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800077:	48 b8 d0 01 80 00 00 	movabs $0x8001d0,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+  800083:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800088:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80008c:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800090:	48 c1 e0 04          	shl    $0x4,%rax
+  800094:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80009b:	00 00 00 
+  80009e:	48 01 d0             	add    %rdx,%rax
+  8000a1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000a8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000ab:	45 85 ed             	test   %r13d,%r13d
+  8000ae:	7e 0d                	jle    8000bd <libmain+0x87>
+  8000b0:	49 8b 06             	mov    (%r14),%rax
+  8000b3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ba:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000bd:	4c 89 f6             	mov    %r14,%rsi
+  8000c0:	44 89 ef             	mov    %r13d,%edi
+  8000c3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000cf:	48 b8 e4 00 80 00 00 	movabs $0x8000e4,%rax
+  8000d6:	00 00 00 
+  8000d9:	ff d0                	call   *%rax
+#endif
+}
+  8000db:	5b                   	pop    %rbx
+  8000dc:	41 5c                	pop    %r12
+  8000de:	41 5d                	pop    %r13
+  8000e0:	41 5e                	pop    %r14
+  8000e2:	5d                   	pop    %rbp
+  8000e3:	c3                   	ret
+
+00000000008000e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e4:	55                   	push   %rbp
+  8000e5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e8:	48 b8 86 08 80 00 00 	movabs $0x800886,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f9:	48 b8 65 01 80 00 00 	movabs $0x800165,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+}
+  800105:	5d                   	pop    %rbp
+  800106:	c3                   	ret
+
+0000000000800107 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800107:	55                   	push   %rbp
+  800108:	48 89 e5             	mov    %rsp,%rbp
+  80010b:	53                   	push   %rbx
+  80010c:	48 89 fa             	mov    %rdi,%rdx
+  80010f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800117:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80011c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800121:	be 00 00 00 00       	mov    $0x0,%esi
+  800126:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80012c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80012e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+
+0000000000800134 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800134:	55                   	push   %rbp
+  800135:	48 89 e5             	mov    %rsp,%rbp
+  800138:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800139:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80013e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800143:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80014d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800152:	be 00 00 00 00       	mov    $0x0,%esi
+  800157:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80015d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80015f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+
+0000000000800165 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800165:	55                   	push   %rbp
+  800166:	48 89 e5             	mov    %rsp,%rbp
+  800169:	53                   	push   %rbx
+  80016a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80016e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800171:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800176:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800180:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800185:	be 00 00 00 00       	mov    $0x0,%esi
+  80018a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800190:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800192:	48 85 c0             	test   %rax,%rax
+  800195:	7f 06                	jg     80019d <sys_env_destroy+0x38>
+}
+  800197:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019b:	c9                   	leave
+  80019c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80019d:	49 89 c0             	mov    %rax,%r8
+  8001a0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a5:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8001ac:	00 00 00 
+  8001af:	be 26 00 00 00       	mov    $0x26,%esi
+  8001b4:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8001bb:	00 00 00 
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c3:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  8001ca:	00 00 00 
+  8001cd:	41 ff d1             	call   *%r9
+
+00000000008001d0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+  8001d4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001d5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001df:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001f9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+
+0000000000800201 <sys_yield>:
+
+void
+sys_yield(void) {
+  800201:	55                   	push   %rbp
+  800202:	48 89 e5             	mov    %rsp,%rbp
+  800205:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800206:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800210:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021f:	be 00 00 00 00       	mov    $0x0,%esi
+  800224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80022c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+0000000000800232 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800232:	55                   	push   %rbp
+  800233:	48 89 e5             	mov    %rsp,%rbp
+  800236:	53                   	push   %rbx
+  800237:	48 89 fa             	mov    %rdi,%rdx
+  80023a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80023d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800242:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800249:	00 00 00 
+  80024c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800251:	be 00 00 00 00       	mov    $0x0,%esi
+  800256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80025c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80025e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800262:	c9                   	leave
+  800263:	c3                   	ret
+
+0000000000800264 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800264:	55                   	push   %rbp
+  800265:	48 89 e5             	mov    %rsp,%rbp
+  800268:	53                   	push   %rbx
+  800269:	49 89 f8             	mov    %rdi,%r8
+  80026c:	48 89 d3             	mov    %rdx,%rbx
+  80026f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800272:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800277:	4c 89 c2             	mov    %r8,%rdx
+  80027a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80027d:	be 00 00 00 00       	mov    $0x0,%esi
+  800282:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800288:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80028a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+0000000000800290 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800290:	55                   	push   %rbp
+  800291:	48 89 e5             	mov    %rsp,%rbp
+  800294:	53                   	push   %rbx
+  800295:	48 83 ec 08          	sub    $0x8,%rsp
+  800299:	89 f8                	mov    %edi,%eax
+  80029b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80029e:	48 63 f9             	movslq %ecx,%rdi
+  8002a1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002a4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	7f 06                	jg     8002c4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002c4:	49 89 c0             	mov    %rax,%r8
+  8002c7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002cc:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8002d3:	00 00 00 
+  8002d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8002db:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8002e2:	00 00 00 
+  8002e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ea:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  8002f1:	00 00 00 
+  8002f4:	41 ff d1             	call   *%r9
+
+00000000008002f7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	53                   	push   %rbx
+  8002fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800300:	89 f8                	mov    %edi,%eax
+  800302:	49 89 f2             	mov    %rsi,%r10
+  800305:	48 89 cf             	mov    %rcx,%rdi
+  800308:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80030b:	48 63 da             	movslq %edx,%rbx
+  80030e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800311:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800316:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800319:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80031c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80031e:	48 85 c0             	test   %rax,%rax
+  800321:	7f 06                	jg     800329 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800329:	49 89 c0             	mov    %rax,%r8
+  80032c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800331:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800338:	00 00 00 
+  80033b:	be 26 00 00 00       	mov    $0x26,%esi
+  800340:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800347:	00 00 00 
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034f:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  800356:	00 00 00 
+  800359:	41 ff d1             	call   *%r9
+
+000000000080035c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80035c:	55                   	push   %rbp
+  80035d:	48 89 e5             	mov    %rsp,%rbp
+  800360:	53                   	push   %rbx
+  800361:	48 83 ec 08          	sub    $0x8,%rsp
+  800365:	48 89 f1             	mov    %rsi,%rcx
+  800368:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80036b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80036e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800373:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800378:	be 00 00 00 00       	mov    $0x0,%esi
+  80037d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800383:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800385:	48 85 c0             	test   %rax,%rax
+  800388:	7f 06                	jg     800390 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80038a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800390:	49 89 c0             	mov    %rax,%r8
+  800393:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800398:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  80039f:	00 00 00 
+  8003a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8003a7:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8003ae:	00 00 00 
+  8003b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b6:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  8003bd:	00 00 00 
+  8003c0:	41 ff d1             	call   *%r9
+
+00000000008003c3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003c3:	55                   	push   %rbp
+  8003c4:	48 89 e5             	mov    %rsp,%rbp
+  8003c7:	53                   	push   %rbx
+  8003c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003cc:	48 63 ce             	movslq %esi,%rcx
+  8003cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003d2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003ee:	48 85 c0             	test   %rax,%rax
+  8003f1:	7f 06                	jg     8003f9 <sys_env_set_status+0x36>
+}
+  8003f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f7:	c9                   	leave
+  8003f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003f9:	49 89 c0             	mov    %rax,%r8
+  8003fc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800401:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800408:	00 00 00 
+  80040b:	be 26 00 00 00       	mov    $0x26,%esi
+  800410:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800417:	00 00 00 
+  80041a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041f:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  800426:	00 00 00 
+  800429:	41 ff d1             	call   *%r9
+
+000000000080042c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80042c:	55                   	push   %rbp
+  80042d:	48 89 e5             	mov    %rsp,%rbp
+  800430:	53                   	push   %rbx
+  800431:	48 83 ec 08          	sub    $0x8,%rsp
+  800435:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800438:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80043b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800445:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80044a:	be 00 00 00 00       	mov    $0x0,%esi
+  80044f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800455:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800457:	48 85 c0             	test   %rax,%rax
+  80045a:	7f 06                	jg     800462 <sys_env_set_trapframe+0x36>
+}
+  80045c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800460:	c9                   	leave
+  800461:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800462:	49 89 c0             	mov    %rax,%r8
+  800465:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80046a:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  800471:	00 00 00 
+  800474:	be 26 00 00 00       	mov    $0x26,%esi
+  800479:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  800480:	00 00 00 
+  800483:	b8 00 00 00 00       	mov    $0x0,%eax
+  800488:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  80048f:	00 00 00 
+  800492:	41 ff d1             	call   *%r9
+
+0000000000800495 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800495:	55                   	push   %rbp
+  800496:	48 89 e5             	mov    %rsp,%rbp
+  800499:	53                   	push   %rbx
+  80049a:	48 83 ec 08          	sub    $0x8,%rsp
+  80049e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c0:	48 85 c0             	test   %rax,%rax
+  8004c3:	7f 06                	jg     8004cb <sys_env_set_pgfault_upcall+0x36>
+}
+  8004c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c9:	c9                   	leave
+  8004ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004cb:	49 89 c0             	mov    %rax,%r8
+  8004ce:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004d3:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  8004da:	00 00 00 
+  8004dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e2:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  8004e9:	00 00 00 
+  8004ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f1:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  8004f8:	00 00 00 
+  8004fb:	41 ff d1             	call   *%r9
+
+00000000008004fe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	53                   	push   %rbx
+  800503:	89 f8                	mov    %edi,%eax
+  800505:	49 89 f1             	mov    %rsi,%r9
+  800508:	48 89 d3             	mov    %rdx,%rbx
+  80050b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80050e:	49 63 f0             	movslq %r8d,%rsi
+  800511:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800514:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800519:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80051c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800522:	cd 30                	int    $0x30
+}
+  800524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	53                   	push   %rbx
+  80052f:	48 83 ec 08          	sub    $0x8,%rsp
+  800533:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800536:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800539:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80053e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800541:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800546:	be 00 00 00 00       	mov    $0x0,%esi
+  80054b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800551:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800553:	48 85 c0             	test   %rax,%rax
+  800556:	7f 06                	jg     80055e <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800558:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80055c:	c9                   	leave
+  80055d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80055e:	49 89 c0             	mov    %rax,%r8
+  800561:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800566:	48 ba 90 36 80 00 00 	movabs $0x803690,%rdx
+  80056d:	00 00 00 
+  800570:	be 26 00 00 00       	mov    $0x26,%esi
+  800575:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  80057c:	00 00 00 
+  80057f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800584:	49 b9 f1 24 80 00 00 	movabs $0x8024f1,%r9
+  80058b:	00 00 00 
+  80058e:	41 ff d1             	call   *%r9
+
+0000000000800591 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800591:	55                   	push   %rbp
+  800592:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  800595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059a:	48 b8 2a 05 80 00 00 	movabs $0x80052a,%rax
+  8005a1:	00 00 00 
+  8005a4:	ff d0                	call   *%rax
+}
+  8005a6:	5d                   	pop    %rbp
+  8005a7:	c3                   	ret
+
+00000000008005a8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005a8:	55                   	push   %rbp
+  8005a9:	48 89 e5             	mov    %rsp,%rbp
+  8005ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005d1:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d7:	c9                   	leave
+  8005d8:	c3                   	ret
+
+00000000008005d9 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005d9:	55                   	push   %rbp
+  8005da:	48 89 e5             	mov    %rsp,%rbp
+  8005dd:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005de:	48 63 ce             	movslq %esi,%rcx
+  8005e1:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ff:	cd 30                	int    $0x30
+}
+  800601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800605:	c9                   	leave
+  800606:	c3                   	ret
+
+0000000000800607 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800607:	55                   	push   %rbp
+  800608:	48 89 e5             	mov    %rsp,%rbp
+  80060b:	53                   	push   %rbx
+  80060c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80060f:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800613:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800618:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80061d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800622:	be 00 00 00 00       	mov    $0x0,%esi
+  800627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80062d:	cd 30                	int    $0x30
+}
+  80062f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+0000000000800635 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800635:	55                   	push   %rbp
+  800636:	48 89 e5             	mov    %rsp,%rbp
+  800639:	53                   	push   %rbx
+  80063a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80063d:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800640:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800645:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800648:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064d:	be 00 00 00 00       	mov    $0x0,%esi
+  800652:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800658:	cd 30                	int    $0x30
+}
+  80065a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80065e:	c9                   	leave
+  80065f:	c3                   	ret
+
+0000000000800660 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800660:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800667:	ff ff ff 
+  80066a:	48 01 f8             	add    %rdi,%rax
+  80066d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800671:	c3                   	ret
+
+0000000000800672 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800672:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800679:	ff ff ff 
+  80067c:	48 01 f8             	add    %rdi,%rax
+  80067f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800683:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800689:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80068d:	c3                   	ret
+
+000000000080068e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80068e:	55                   	push   %rbp
+  80068f:	48 89 e5             	mov    %rsp,%rbp
+  800692:	41 57                	push   %r15
+  800694:	41 56                	push   %r14
+  800696:	41 55                	push   %r13
+  800698:	41 54                	push   %r12
+  80069a:	53                   	push   %rbx
+  80069b:	48 83 ec 08          	sub    $0x8,%rsp
+  80069f:	49 89 ff             	mov    %rdi,%r15
+  8006a2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006a7:	49 bd ad 21 80 00 00 	movabs $0x8021ad,%r13
+  8006ae:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006b1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006b7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	41 ff d5             	call   *%r13
+  8006c0:	83 e0 04             	and    $0x4,%eax
+  8006c3:	74 17                	je     8006dc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006c5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006cc:	4c 39 f3             	cmp    %r14,%rbx
+  8006cf:	75 e6                	jne    8006b7 <fd_alloc+0x29>
+  8006d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006d7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006dc:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006df:	48 83 c4 08          	add    $0x8,%rsp
+  8006e3:	5b                   	pop    %rbx
+  8006e4:	41 5c                	pop    %r12
+  8006e6:	41 5d                	pop    %r13
+  8006e8:	41 5e                	pop    %r14
+  8006ea:	41 5f                	pop    %r15
+  8006ec:	5d                   	pop    %rbp
+  8006ed:	c3                   	ret
+
+00000000008006ee <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006ee:	83 ff 1f             	cmp    $0x1f,%edi
+  8006f1:	77 39                	ja     80072c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+  8006f7:	41 54                	push   %r12
+  8006f9:	53                   	push   %rbx
+  8006fa:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8006fd:	48 63 df             	movslq %edi,%rbx
+  800700:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800707:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80070b:	48 89 df             	mov    %rbx,%rdi
+  80070e:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  800715:	00 00 00 
+  800718:	ff d0                	call   *%rax
+  80071a:	a8 04                	test   $0x4,%al
+  80071c:	74 14                	je     800732 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80071e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800722:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800727:	5b                   	pop    %rbx
+  800728:	41 5c                	pop    %r12
+  80072a:	5d                   	pop    %rbp
+  80072b:	c3                   	ret
+        return -E_INVAL;
+  80072c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800731:	c3                   	ret
+        return -E_INVAL;
+  800732:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800737:	eb ee                	jmp    800727 <fd_lookup+0x39>
+
+0000000000800739 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800739:	55                   	push   %rbp
+  80073a:	48 89 e5             	mov    %rsp,%rbp
+  80073d:	41 54                	push   %r12
+  80073f:	53                   	push   %rbx
+  800740:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800743:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  80074a:	00 00 00 
+  80074d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800754:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800757:	39 3b                	cmp    %edi,(%rbx)
+  800759:	74 47                	je     8007a2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80075b:	48 83 c0 08          	add    $0x8,%rax
+  80075f:	48 8b 18             	mov    (%rax),%rbx
+  800762:	48 85 db             	test   %rbx,%rbx
+  800765:	75 f0                	jne    800757 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800767:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80076e:	00 00 00 
+  800771:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800777:	89 fa                	mov    %edi,%edx
+  800779:	48 bf c0 36 80 00 00 	movabs $0x8036c0,%rdi
+  800780:	00 00 00 
+  800783:	b8 00 00 00 00       	mov    $0x0,%eax
+  800788:	48 b9 41 26 80 00 00 	movabs $0x802641,%rcx
+  80078f:	00 00 00 
+  800792:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800794:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800799:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80079d:	5b                   	pop    %rbx
+  80079e:	41 5c                	pop    %r12
+  8007a0:	5d                   	pop    %rbp
+  8007a1:	c3                   	ret
+            return 0;
+  8007a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a7:	eb f0                	jmp    800799 <dev_lookup+0x60>
+
+00000000008007a9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007a9:	55                   	push   %rbp
+  8007aa:	48 89 e5             	mov    %rsp,%rbp
+  8007ad:	41 55                	push   %r13
+  8007af:	41 54                	push   %r12
+  8007b1:	53                   	push   %rbx
+  8007b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8007b6:	48 89 fb             	mov    %rdi,%rbx
+  8007b9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007bc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007c3:	ff ff ff 
+  8007c6:	48 01 df             	add    %rbx,%rdi
+  8007c9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007cd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007d1:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  8007d8:	00 00 00 
+  8007db:	ff d0                	call   *%rax
+  8007dd:	41 89 c5             	mov    %eax,%r13d
+  8007e0:	85 c0                	test   %eax,%eax
+  8007e2:	78 06                	js     8007ea <fd_close+0x41>
+  8007e4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007e8:	74 1a                	je     800804 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007ea:	45 84 e4             	test   %r12b,%r12b
+  8007ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007f6:	44 89 e8             	mov    %r13d,%eax
+  8007f9:	48 83 c4 18          	add    $0x18,%rsp
+  8007fd:	5b                   	pop    %rbx
+  8007fe:	41 5c                	pop    %r12
+  800800:	41 5d                	pop    %r13
+  800802:	5d                   	pop    %rbp
+  800803:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800804:	8b 3b                	mov    (%rbx),%edi
+  800806:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80080a:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800811:	00 00 00 
+  800814:	ff d0                	call   *%rax
+  800816:	41 89 c5             	mov    %eax,%r13d
+  800819:	85 c0                	test   %eax,%eax
+  80081b:	78 1b                	js     800838 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80081d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800821:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800825:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80082b:	48 85 c0             	test   %rax,%rax
+  80082e:	74 08                	je     800838 <fd_close+0x8f>
+  800830:	48 89 df             	mov    %rbx,%rdi
+  800833:	ff d0                	call   *%rax
+  800835:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800838:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80083d:	48 89 de             	mov    %rbx,%rsi
+  800840:	bf 00 00 00 00       	mov    $0x0,%edi
+  800845:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  80084c:	00 00 00 
+  80084f:	ff d0                	call   *%rax
+    return res;
+  800851:	eb a3                	jmp    8007f6 <fd_close+0x4d>
+
+0000000000800853 <close>:
+
+int
+close(int fdnum) {
+  800853:	55                   	push   %rbp
+  800854:	48 89 e5             	mov    %rsp,%rbp
+  800857:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80085b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80085f:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800866:	00 00 00 
+  800869:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	78 15                	js     800884 <close+0x31>
+
+    return fd_close(fd, 1);
+  80086f:	be 01 00 00 00       	mov    $0x1,%esi
+  800874:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800878:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  80087f:	00 00 00 
+  800882:	ff d0                	call   *%rax
+}
+  800884:	c9                   	leave
+  800885:	c3                   	ret
+
+0000000000800886 <close_all>:
+
+void
+close_all(void) {
+  800886:	55                   	push   %rbp
+  800887:	48 89 e5             	mov    %rsp,%rbp
+  80088a:	41 54                	push   %r12
+  80088c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80088d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800892:	49 bc 53 08 80 00 00 	movabs $0x800853,%r12
+  800899:	00 00 00 
+  80089c:	89 df                	mov    %ebx,%edi
+  80089e:	41 ff d4             	call   *%r12
+  8008a1:	83 c3 01             	add    $0x1,%ebx
+  8008a4:	83 fb 20             	cmp    $0x20,%ebx
+  8008a7:	75 f3                	jne    80089c <close_all+0x16>
+}
+  8008a9:	5b                   	pop    %rbx
+  8008aa:	41 5c                	pop    %r12
+  8008ac:	5d                   	pop    %rbp
+  8008ad:	c3                   	ret
+
+00000000008008ae <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008ae:	55                   	push   %rbp
+  8008af:	48 89 e5             	mov    %rsp,%rbp
+  8008b2:	41 57                	push   %r15
+  8008b4:	41 56                	push   %r14
+  8008b6:	41 55                	push   %r13
+  8008b8:	41 54                	push   %r12
+  8008ba:	53                   	push   %rbx
+  8008bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8008bf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008c2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008c6:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  8008cd:	00 00 00 
+  8008d0:	ff d0                	call   *%rax
+  8008d2:	89 c3                	mov    %eax,%ebx
+  8008d4:	85 c0                	test   %eax,%eax
+  8008d6:	0f 88 b8 00 00 00    	js     800994 <dup+0xe6>
+    close(newfdnum);
+  8008dc:	44 89 e7             	mov    %r12d,%edi
+  8008df:	48 b8 53 08 80 00 00 	movabs $0x800853,%rax
+  8008e6:	00 00 00 
+  8008e9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008eb:	4d 63 ec             	movslq %r12d,%r13
+  8008ee:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008f5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8008f9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8008fd:	4c 89 ff             	mov    %r15,%rdi
+  800900:	49 be 72 06 80 00 00 	movabs $0x800672,%r14
+  800907:	00 00 00 
+  80090a:	41 ff d6             	call   *%r14
+  80090d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800910:	4c 89 ef             	mov    %r13,%rdi
+  800913:	41 ff d6             	call   *%r14
+  800916:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800919:	48 89 df             	mov    %rbx,%rdi
+  80091c:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  800923:	00 00 00 
+  800926:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800928:	a8 04                	test   $0x4,%al
+  80092a:	74 2b                	je     800957 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80092c:	41 89 c1             	mov    %eax,%r9d
+  80092f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800935:	4c 89 f1             	mov    %r14,%rcx
+  800938:	ba 00 00 00 00       	mov    $0x0,%edx
+  80093d:	48 89 de             	mov    %rbx,%rsi
+  800940:	bf 00 00 00 00       	mov    $0x0,%edi
+  800945:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  80094c:	00 00 00 
+  80094f:	ff d0                	call   *%rax
+  800951:	89 c3                	mov    %eax,%ebx
+  800953:	85 c0                	test   %eax,%eax
+  800955:	78 4e                	js     8009a5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800957:	4c 89 ff             	mov    %r15,%rdi
+  80095a:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  800961:	00 00 00 
+  800964:	ff d0                	call   *%rax
+  800966:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800969:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80096f:	4c 89 e9             	mov    %r13,%rcx
+  800972:	ba 00 00 00 00       	mov    $0x0,%edx
+  800977:	4c 89 fe             	mov    %r15,%rsi
+  80097a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80097f:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  800986:	00 00 00 
+  800989:	ff d0                	call   *%rax
+  80098b:	89 c3                	mov    %eax,%ebx
+  80098d:	85 c0                	test   %eax,%eax
+  80098f:	78 14                	js     8009a5 <dup+0xf7>
+
+    return newfdnum;
+  800991:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800994:	89 d8                	mov    %ebx,%eax
+  800996:	48 83 c4 18          	add    $0x18,%rsp
+  80099a:	5b                   	pop    %rbx
+  80099b:	41 5c                	pop    %r12
+  80099d:	41 5d                	pop    %r13
+  80099f:	41 5e                	pop    %r14
+  8009a1:	41 5f                	pop    %r15
+  8009a3:	5d                   	pop    %rbp
+  8009a4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009aa:	4c 89 ee             	mov    %r13,%rsi
+  8009ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009b2:	49 bc 5c 03 80 00 00 	movabs $0x80035c,%r12
+  8009b9:	00 00 00 
+  8009bc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009c4:	4c 89 f6             	mov    %r14,%rsi
+  8009c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009cc:	41 ff d4             	call   *%r12
+    return res;
+  8009cf:	eb c3                	jmp    800994 <dup+0xe6>
+
+00000000008009d1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009d1:	55                   	push   %rbp
+  8009d2:	48 89 e5             	mov    %rsp,%rbp
+  8009d5:	41 56                	push   %r14
+  8009d7:	41 55                	push   %r13
+  8009d9:	41 54                	push   %r12
+  8009db:	53                   	push   %rbx
+  8009dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8009e0:	89 fb                	mov    %edi,%ebx
+  8009e2:	49 89 f4             	mov    %rsi,%r12
+  8009e5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009e8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009ec:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  8009f3:	00 00 00 
+  8009f6:	ff d0                	call   *%rax
+  8009f8:	85 c0                	test   %eax,%eax
+  8009fa:	78 4c                	js     800a48 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8009fc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a00:	41 8b 3e             	mov    (%r14),%edi
+  800a03:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a07:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800a0e:	00 00 00 
+  800a11:	ff d0                	call   *%rax
+  800a13:	85 c0                	test   %eax,%eax
+  800a15:	78 35                	js     800a4c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a17:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a1b:	83 e0 03             	and    $0x3,%eax
+  800a1e:	83 f8 01             	cmp    $0x1,%eax
+  800a21:	74 2d                	je     800a50 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a27:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a2b:	48 85 c0             	test   %rax,%rax
+  800a2e:	74 56                	je     800a86 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a30:	4c 89 ea             	mov    %r13,%rdx
+  800a33:	4c 89 e6             	mov    %r12,%rsi
+  800a36:	4c 89 f7             	mov    %r14,%rdi
+  800a39:	ff d0                	call   *%rax
+}
+  800a3b:	48 83 c4 10          	add    $0x10,%rsp
+  800a3f:	5b                   	pop    %rbx
+  800a40:	41 5c                	pop    %r12
+  800a42:	41 5d                	pop    %r13
+  800a44:	41 5e                	pop    %r14
+  800a46:	5d                   	pop    %rbp
+  800a47:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a48:	48 98                	cltq
+  800a4a:	eb ef                	jmp    800a3b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a4c:	48 98                	cltq
+  800a4e:	eb eb                	jmp    800a3b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a50:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a57:	00 00 00 
+  800a5a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a60:	89 da                	mov    %ebx,%edx
+  800a62:	48 bf 21 37 80 00 00 	movabs $0x803721,%rdi
+  800a69:	00 00 00 
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a71:	48 b9 41 26 80 00 00 	movabs $0x802641,%rcx
+  800a78:	00 00 00 
+  800a7b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a7d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a84:	eb b5                	jmp    800a3b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a86:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a8d:	eb ac                	jmp    800a3b <read+0x6a>
+
+0000000000800a8f <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a8f:	55                   	push   %rbp
+  800a90:	48 89 e5             	mov    %rsp,%rbp
+  800a93:	41 56                	push   %r14
+  800a95:	41 55                	push   %r13
+  800a97:	41 54                	push   %r12
+  800a99:	53                   	push   %rbx
+  800a9a:	48 83 ec 10          	sub    $0x10,%rsp
+  800a9e:	89 fb                	mov    %edi,%ebx
+  800aa0:	49 89 f4             	mov    %rsi,%r12
+  800aa3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aa6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800aaa:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800ab1:	00 00 00 
+  800ab4:	ff d0                	call   *%rax
+  800ab6:	85 c0                	test   %eax,%eax
+  800ab8:	78 41                	js     800afb <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aba:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800abe:	41 8b 3e             	mov    (%r14),%edi
+  800ac1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ac5:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800acc:	00 00 00 
+  800acf:	ff d0                	call   *%rax
+  800ad1:	85 c0                	test   %eax,%eax
+  800ad3:	78 35                	js     800b0a <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ad5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ad9:	83 e0 03             	and    $0x3,%eax
+  800adc:	83 f8 01             	cmp    $0x1,%eax
+  800adf:	74 2d                	je     800b0e <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800ae1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ae5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800ae9:	48 85 c0             	test   %rax,%rax
+  800aec:	74 56                	je     800b44 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800aee:	4c 89 ea             	mov    %r13,%rdx
+  800af1:	4c 89 e6             	mov    %r12,%rsi
+  800af4:	4c 89 f7             	mov    %r14,%rdi
+  800af7:	ff d0                	call   *%rax
+  800af9:	eb 02                	jmp    800afd <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800afb:	48 98                	cltq
+}
+  800afd:	48 83 c4 10          	add    $0x10,%rsp
+  800b01:	5b                   	pop    %rbx
+  800b02:	41 5c                	pop    %r12
+  800b04:	41 5d                	pop    %r13
+  800b06:	41 5e                	pop    %r14
+  800b08:	5d                   	pop    %rbp
+  800b09:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b0a:	48 98                	cltq
+  800b0c:	eb ef                	jmp    800afd <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b0e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b15:	00 00 00 
+  800b18:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b1e:	89 da                	mov    %ebx,%edx
+  800b20:	48 bf e0 36 80 00 00 	movabs $0x8036e0,%rdi
+  800b27:	00 00 00 
+  800b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2f:	48 b9 41 26 80 00 00 	movabs $0x802641,%rcx
+  800b36:	00 00 00 
+  800b39:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b3b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b42:	eb b9                	jmp    800afd <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b44:	4c 89 ea             	mov    %r13,%rdx
+  800b47:	4c 89 e6             	mov    %r12,%rsi
+  800b4a:	89 df                	mov    %ebx,%edi
+  800b4c:	48 b8 d1 09 80 00 00 	movabs $0x8009d1,%rax
+  800b53:	00 00 00 
+  800b56:	ff d0                	call   *%rax
+  800b58:	eb a3                	jmp    800afd <readmap+0x6e>
+
+0000000000800b5a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b5a:	55                   	push   %rbp
+  800b5b:	48 89 e5             	mov    %rsp,%rbp
+  800b5e:	41 57                	push   %r15
+  800b60:	41 56                	push   %r14
+  800b62:	41 55                	push   %r13
+  800b64:	41 54                	push   %r12
+  800b66:	53                   	push   %rbx
+  800b67:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b6b:	48 85 d2             	test   %rdx,%rdx
+  800b6e:	74 54                	je     800bc4 <readn+0x6a>
+  800b70:	41 89 fd             	mov    %edi,%r13d
+  800b73:	49 89 f6             	mov    %rsi,%r14
+  800b76:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b7e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b83:	49 bf d1 09 80 00 00 	movabs $0x8009d1,%r15
+  800b8a:	00 00 00 
+  800b8d:	4c 89 e2             	mov    %r12,%rdx
+  800b90:	48 29 f2             	sub    %rsi,%rdx
+  800b93:	4c 01 f6             	add    %r14,%rsi
+  800b96:	44 89 ef             	mov    %r13d,%edi
+  800b99:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b9c:	85 c0                	test   %eax,%eax
+  800b9e:	78 20                	js     800bc0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ba0:	01 c3                	add    %eax,%ebx
+  800ba2:	85 c0                	test   %eax,%eax
+  800ba4:	74 08                	je     800bae <readn+0x54>
+  800ba6:	48 63 f3             	movslq %ebx,%rsi
+  800ba9:	4c 39 e6             	cmp    %r12,%rsi
+  800bac:	72 df                	jb     800b8d <readn+0x33>
+    }
+    return res;
+  800bae:	48 63 c3             	movslq %ebx,%rax
+}
+  800bb1:	48 83 c4 08          	add    $0x8,%rsp
+  800bb5:	5b                   	pop    %rbx
+  800bb6:	41 5c                	pop    %r12
+  800bb8:	41 5d                	pop    %r13
+  800bba:	41 5e                	pop    %r14
+  800bbc:	41 5f                	pop    %r15
+  800bbe:	5d                   	pop    %rbp
+  800bbf:	c3                   	ret
+        if (inc < 0) return inc;
+  800bc0:	48 98                	cltq
+  800bc2:	eb ed                	jmp    800bb1 <readn+0x57>
+    int inc = 1, res = 0;
+  800bc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bc9:	eb e3                	jmp    800bae <readn+0x54>
+
+0000000000800bcb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bcb:	55                   	push   %rbp
+  800bcc:	48 89 e5             	mov    %rsp,%rbp
+  800bcf:	41 56                	push   %r14
+  800bd1:	41 55                	push   %r13
+  800bd3:	41 54                	push   %r12
+  800bd5:	53                   	push   %rbx
+  800bd6:	48 83 ec 10          	sub    $0x10,%rsp
+  800bda:	89 fb                	mov    %edi,%ebx
+  800bdc:	49 89 f4             	mov    %rsi,%r12
+  800bdf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800be2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800be6:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800bed:	00 00 00 
+  800bf0:	ff d0                	call   *%rax
+  800bf2:	85 c0                	test   %eax,%eax
+  800bf4:	78 47                	js     800c3d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bf6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bfa:	41 8b 3e             	mov    (%r14),%edi
+  800bfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c01:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800c08:	00 00 00 
+  800c0b:	ff d0                	call   *%rax
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	78 30                	js     800c41 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c11:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c16:	74 2d                	je     800c45 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c1c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c20:	48 85 c0             	test   %rax,%rax
+  800c23:	74 56                	je     800c7b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c25:	4c 89 ea             	mov    %r13,%rdx
+  800c28:	4c 89 e6             	mov    %r12,%rsi
+  800c2b:	4c 89 f7             	mov    %r14,%rdi
+  800c2e:	ff d0                	call   *%rax
+}
+  800c30:	48 83 c4 10          	add    $0x10,%rsp
+  800c34:	5b                   	pop    %rbx
+  800c35:	41 5c                	pop    %r12
+  800c37:	41 5d                	pop    %r13
+  800c39:	41 5e                	pop    %r14
+  800c3b:	5d                   	pop    %rbp
+  800c3c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c3d:	48 98                	cltq
+  800c3f:	eb ef                	jmp    800c30 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c41:	48 98                	cltq
+  800c43:	eb eb                	jmp    800c30 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c45:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c4c:	00 00 00 
+  800c4f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c55:	89 da                	mov    %ebx,%edx
+  800c57:	48 bf 3d 37 80 00 00 	movabs $0x80373d,%rdi
+  800c5e:	00 00 00 
+  800c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c66:	48 b9 41 26 80 00 00 	movabs $0x802641,%rcx
+  800c6d:	00 00 00 
+  800c70:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c72:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c79:	eb b5                	jmp    800c30 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c7b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c82:	eb ac                	jmp    800c30 <write+0x65>
+
+0000000000800c84 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c84:	55                   	push   %rbp
+  800c85:	48 89 e5             	mov    %rsp,%rbp
+  800c88:	53                   	push   %rbx
+  800c89:	48 83 ec 18          	sub    $0x18,%rsp
+  800c8d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c8f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c93:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800c9a:	00 00 00 
+  800c9d:	ff d0                	call   *%rax
+  800c9f:	85 c0                	test   %eax,%eax
+  800ca1:	78 0c                	js     800caf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800ca3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cb5:	55                   	push   %rbp
+  800cb6:	48 89 e5             	mov    %rsp,%rbp
+  800cb9:	41 55                	push   %r13
+  800cbb:	41 54                	push   %r12
+  800cbd:	53                   	push   %rbx
+  800cbe:	48 83 ec 18          	sub    $0x18,%rsp
+  800cc2:	89 fb                	mov    %edi,%ebx
+  800cc4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ccb:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800cd2:	00 00 00 
+  800cd5:	ff d0                	call   *%rax
+  800cd7:	85 c0                	test   %eax,%eax
+  800cd9:	78 38                	js     800d13 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cdb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cdf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ce3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ce7:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800cee:	00 00 00 
+  800cf1:	ff d0                	call   *%rax
+  800cf3:	85 c0                	test   %eax,%eax
+  800cf5:	78 1c                	js     800d13 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cf7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cfc:	74 20                	je     800d1e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d02:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d06:	48 85 c0             	test   %rax,%rax
+  800d09:	74 47                	je     800d52 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d0b:	44 89 e6             	mov    %r12d,%esi
+  800d0e:	4c 89 ef             	mov    %r13,%rdi
+  800d11:	ff d0                	call   *%rax
+}
+  800d13:	48 83 c4 18          	add    $0x18,%rsp
+  800d17:	5b                   	pop    %rbx
+  800d18:	41 5c                	pop    %r12
+  800d1a:	41 5d                	pop    %r13
+  800d1c:	5d                   	pop    %rbp
+  800d1d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d25:	00 00 00 
+  800d28:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d2e:	89 da                	mov    %ebx,%edx
+  800d30:	48 bf 00 37 80 00 00 	movabs $0x803700,%rdi
+  800d37:	00 00 00 
+  800d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3f:	48 b9 41 26 80 00 00 	movabs $0x802641,%rcx
+  800d46:	00 00 00 
+  800d49:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d50:	eb c1                	jmp    800d13 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d52:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d57:	eb ba                	jmp    800d13 <ftruncate+0x5e>
+
+0000000000800d59 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d59:	55                   	push   %rbp
+  800d5a:	48 89 e5             	mov    %rsp,%rbp
+  800d5d:	41 54                	push   %r12
+  800d5f:	53                   	push   %rbx
+  800d60:	48 83 ec 10          	sub    $0x10,%rsp
+  800d64:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d67:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d6b:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800d72:	00 00 00 
+  800d75:	ff d0                	call   *%rax
+  800d77:	85 c0                	test   %eax,%eax
+  800d79:	78 4e                	js     800dc9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d7b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d7f:	41 8b 3c 24          	mov    (%r12),%edi
+  800d83:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d87:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800d8e:	00 00 00 
+  800d91:	ff d0                	call   *%rax
+  800d93:	85 c0                	test   %eax,%eax
+  800d95:	78 32                	js     800dc9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d9b:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800da0:	74 30                	je     800dd2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800da2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800da5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800dac:	00 00 00 
+    stat->st_isdir = 0;
+  800daf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800db6:	00 00 00 
+    stat->st_dev = dev;
+  800db9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dc0:	48 89 de             	mov    %rbx,%rsi
+  800dc3:	4c 89 e7             	mov    %r12,%rdi
+  800dc6:	ff 50 30             	call   *0x30(%rax)
+}
+  800dc9:	48 83 c4 10          	add    $0x10,%rsp
+  800dcd:	5b                   	pop    %rbx
+  800dce:	41 5c                	pop    %r12
+  800dd0:	5d                   	pop    %rbp
+  800dd1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dd2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dd7:	eb f0                	jmp    800dc9 <fstat+0x70>
+
+0000000000800dd9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dd9:	55                   	push   %rbp
+  800dda:	48 89 e5             	mov    %rsp,%rbp
+  800ddd:	41 54                	push   %r12
+  800ddf:	53                   	push   %rbx
+  800de0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800de3:	be 00 00 00 00       	mov    $0x0,%esi
+  800de8:	48 b8 30 1b 80 00 00 	movabs $0x801b30,%rax
+  800def:	00 00 00 
+  800df2:	ff d0                	call   *%rax
+  800df4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800df6:	85 c0                	test   %eax,%eax
+  800df8:	78 25                	js     800e1f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dfa:	4c 89 e6             	mov    %r12,%rsi
+  800dfd:	89 c7                	mov    %eax,%edi
+  800dff:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  800e06:	00 00 00 
+  800e09:	ff d0                	call   *%rax
+  800e0b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e0e:	89 df                	mov    %ebx,%edi
+  800e10:	48 b8 53 08 80 00 00 	movabs $0x800853,%rax
+  800e17:	00 00 00 
+  800e1a:	ff d0                	call   *%rax
+
+    return res;
+  800e1c:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e1f:	89 d8                	mov    %ebx,%eax
+  800e21:	5b                   	pop    %rbx
+  800e22:	41 5c                	pop    %r12
+  800e24:	5d                   	pop    %rbp
+  800e25:	c3                   	ret
+
+0000000000800e26 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+  800e2a:	41 54                	push   %r12
+  800e2c:	53                   	push   %rbx
+  800e2d:	48 83 ec 10          	sub    $0x10,%rsp
+  800e31:	48 89 fb             	mov    %rdi,%rbx
+  800e34:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e3b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e40:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	78 1f                	js     800e6f <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e54:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e58:	48 85 c0             	test   %rax,%rax
+  800e5b:	74 1b                	je     800e78 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e5d:	4c 89 e6             	mov    %r12,%rsi
+  800e60:	48 89 df             	mov    %rbx,%rdi
+  800e63:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e6f:	48 83 c4 10          	add    $0x10,%rsp
+  800e73:	5b                   	pop    %rbx
+  800e74:	41 5c                	pop    %r12
+  800e76:	5d                   	pop    %rbp
+  800e77:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e78:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e7d:	eb f0                	jmp    800e6f <create_snapshot+0x49>
+
+0000000000800e7f <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e7f:	55                   	push   %rbp
+  800e80:	48 89 e5             	mov    %rsp,%rbp
+  800e83:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e8b:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e90:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	78 1e                	js     800ebe <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800ea0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ea4:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800ea8:	48 85 d2             	test   %rdx,%rdx
+  800eab:	74 13                	je     800ec0 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb2:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800eb4:	85 c0                	test   %eax,%eax
+  800eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ebe:	c9                   	leave
+  800ebf:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ec0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ec5:	eb f7                	jmp    800ebe <print_snapshot_list+0x3f>
+
+0000000000800ec7 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ec7:	55                   	push   %rbp
+  800ec8:	48 89 e5             	mov    %rsp,%rbp
+  800ecb:	53                   	push   %rbx
+  800ecc:	48 83 ec 18          	sub    $0x18,%rsp
+  800ed0:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ed3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ed7:	bf 66 00 00 00       	mov    $0x66,%edi
+  800edc:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	78 1c                	js     800f08 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800eec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ef0:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800ef4:	48 85 c0             	test   %rax,%rax
+  800ef7:	74 15                	je     800f0e <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800ef9:	48 89 df             	mov    %rbx,%rdi
+  800efc:	ff d0                	call   *%rax
+    if (res < 0) {
+  800efe:	85 c0                	test   %eax,%eax
+  800f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f05:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f0c:	c9                   	leave
+  800f0d:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f0e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f13:	eb f3                	jmp    800f08 <accept_snapshot+0x41>
+
+0000000000800f15 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f15:	55                   	push   %rbp
+  800f16:	48 89 e5             	mov    %rsp,%rbp
+  800f19:	53                   	push   %rbx
+  800f1a:	48 83 ec 18          	sub    $0x18,%rsp
+  800f1e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f21:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f25:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f2a:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800f31:	00 00 00 
+  800f34:	ff d0                	call   *%rax
+  800f36:	85 c0                	test   %eax,%eax
+  800f38:	78 1c                	js     800f56 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f3e:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f42:	48 85 c0             	test   %rax,%rax
+  800f45:	74 15                	je     800f5c <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f47:	48 89 df             	mov    %rbx,%rdi
+  800f4a:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f53:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f5c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f61:	eb f3                	jmp    800f56 <delete_snapshot+0x41>
+
+0000000000800f63 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f63:	55                   	push   %rbp
+  800f64:	48 89 e5             	mov    %rsp,%rbp
+  800f67:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f6b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f6f:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f74:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800f7b:	00 00 00 
+  800f7e:	ff d0                	call   *%rax
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	78 14                	js     800f98 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f88:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f8c:	48 85 d2             	test   %rdx,%rdx
+  800f8f:	74 09                	je     800f9a <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f96:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800f98:	c9                   	leave
+  800f99:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f9a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f9f:	eb f7                	jmp    800f98 <gc_snapshots+0x35>
+
+0000000000800fa1 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fa1:	55                   	push   %rbp
+  800fa2:	48 89 e5             	mov    %rsp,%rbp
+  800fa5:	41 56                	push   %r14
+  800fa7:	41 55                	push   %r13
+  800fa9:	41 54                	push   %r12
+  800fab:	53                   	push   %rbx
+  800fac:	48 83 ec 10          	sub    $0x10,%rsp
+  800fb0:	48 89 fb             	mov    %rdi,%rbx
+  800fb3:	49 89 f4             	mov    %rsi,%r12
+  800fb6:	49 89 d5             	mov    %rdx,%r13
+  800fb9:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fbc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fc0:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fc5:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  800fcc:	00 00 00 
+  800fcf:	ff d0                	call   *%rax
+  800fd1:	85 c0                	test   %eax,%eax
+  800fd3:	78 1b                	js     800ff0 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fd9:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fdd:	48 85 c0             	test   %rax,%rax
+  800fe0:	74 1b                	je     800ffd <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fe2:	4c 89 f1             	mov    %r14,%rcx
+  800fe5:	4c 89 ea             	mov    %r13,%rdx
+  800fe8:	4c 89 e6             	mov    %r12,%rsi
+  800feb:	48 89 df             	mov    %rbx,%rdi
+  800fee:	ff d0                	call   *%rax
+
+    return res;
+}
+  800ff0:	48 83 c4 10          	add    $0x10,%rsp
+  800ff4:	5b                   	pop    %rbx
+  800ff5:	41 5c                	pop    %r12
+  800ff7:	41 5d                	pop    %r13
+  800ff9:	41 5e                	pop    %r14
+  800ffb:	5d                   	pop    %rbp
+  800ffc:	c3                   	ret
+        return -E_NOT_SUPP;
+  800ffd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801002:	eb ec                	jmp    800ff0 <diff_snapshots+0x4f>
+
+0000000000801004 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801004:	55                   	push   %rbp
+  801005:	48 89 e5             	mov    %rsp,%rbp
+  801008:	41 55                	push   %r13
+  80100a:	41 54                	push   %r12
+  80100c:	53                   	push   %rbx
+  80100d:	48 83 ec 18          	sub    $0x18,%rsp
+  801011:	48 89 fb             	mov    %rdi,%rbx
+  801014:	49 89 f4             	mov    %rsi,%r12
+  801017:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80101a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80101e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801023:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  80102a:	00 00 00 
+  80102d:	ff d0                	call   *%rax
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	78 18                	js     80104b <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801033:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801037:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80103b:	48 85 c0             	test   %rax,%rax
+  80103e:	74 16                	je     801056 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801040:	4c 89 ea             	mov    %r13,%rdx
+  801043:	4c 89 e6             	mov    %r12,%rsi
+  801046:	48 89 df             	mov    %rbx,%rdi
+  801049:	ff d0                	call   *%rax
+
+    return res;
+}
+  80104b:	48 83 c4 18          	add    $0x18,%rsp
+  80104f:	5b                   	pop    %rbx
+  801050:	41 5c                	pop    %r12
+  801052:	41 5d                	pop    %r13
+  801054:	5d                   	pop    %rbp
+  801055:	c3                   	ret
+        return -E_NOT_SUPP;
+  801056:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80105b:	eb ee                	jmp    80104b <send_snapshot+0x47>
+
+000000000080105d <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80105d:	55                   	push   %rbp
+  80105e:	48 89 e5             	mov    %rsp,%rbp
+  801061:	53                   	push   %rbx
+  801062:	48 83 ec 18          	sub    $0x18,%rsp
+  801066:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801069:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80106d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801072:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  801079:	00 00 00 
+  80107c:	ff d0                	call   *%rax
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	78 12                	js     801094 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801082:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801086:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80108a:	48 85 c0             	test   %rax,%rax
+  80108d:	74 0b                	je     80109a <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80108f:	48 89 df             	mov    %rbx,%rdi
+  801092:	ff d0                	call   *%rax
+
+    return res;
+}
+  801094:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801098:	c9                   	leave
+  801099:	c3                   	ret
+        return -E_NOT_SUPP;
+  80109a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80109f:	eb f3                	jmp    801094 <receive_snapshot+0x37>
+
+00000000008010a1 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010a1:	55                   	push   %rbp
+  8010a2:	48 89 e5             	mov    %rsp,%rbp
+  8010a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010ad:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010b2:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  8010b9:	00 00 00 
+  8010bc:	ff d0                	call   *%rax
+  8010be:	85 c0                	test   %eax,%eax
+  8010c0:	78 17                	js     8010d9 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010c6:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010cd:	48 85 d2             	test   %rdx,%rdx
+  8010d0:	74 09                	je     8010db <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d7:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010d9:	c9                   	leave
+  8010da:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010db:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010e0:	eb f7                	jmp    8010d9 <free_space_bytes+0x38>
+
+00000000008010e2 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010e2:	55                   	push   %rbp
+  8010e3:	48 89 e5             	mov    %rsp,%rbp
+  8010e6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010ee:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010f3:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  8010fa:	00 00 00 
+  8010fd:	ff d0                	call   *%rax
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	78 17                	js     80111a <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801103:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801107:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80110e:	48 85 d2             	test   %rdx,%rdx
+  801111:	74 09                	je     80111c <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+  801118:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80111a:	c9                   	leave
+  80111b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80111c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801121:	eb f7                	jmp    80111a <busy_space_bytes+0x38>
+
+0000000000801123 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801123:	55                   	push   %rbp
+  801124:	48 89 e5             	mov    %rsp,%rbp
+  801127:	41 54                	push   %r12
+  801129:	53                   	push   %rbx
+  80112a:	48 83 ec 10          	sub    $0x10,%rsp
+  80112e:	89 fb                	mov    %edi,%ebx
+  801130:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801133:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801137:	bf 66 00 00 00       	mov    $0x66,%edi
+  80113c:	48 b8 39 07 80 00 00 	movabs $0x800739,%rax
+  801143:	00 00 00 
+  801146:	ff d0                	call   *%rax
+  801148:	85 c0                	test   %eax,%eax
+  80114a:	78 17                	js     801163 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80114c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801150:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801157:	48 85 c0             	test   %rax,%rax
+  80115a:	74 10                	je     80116c <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80115c:	4c 89 e6             	mov    %r12,%rsi
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801163:	48 83 c4 10          	add    $0x10,%rsp
+  801167:	5b                   	pop    %rbx
+  801168:	41 5c                	pop    %r12
+  80116a:	5d                   	pop    %rbp
+  80116b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80116c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801171:	eb f0                	jmp    801163 <snapshots_space+0x40>
+
+0000000000801173 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+  801177:	41 55                	push   %r13
+  801179:	41 54                	push   %r12
+  80117b:	53                   	push   %rbx
+  80117c:	48 83 ec 08          	sub    $0x8,%rsp
+  801180:	41 89 fd             	mov    %edi,%r13d
+  801183:	48 89 f3             	mov    %rsi,%rbx
+  801186:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801189:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801190:	00 00 00 
+  801193:	83 38 00             	cmpl   $0x0,(%rax)
+  801196:	74 57                	je     8011ef <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801198:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80119e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011a3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011aa:	00 00 00 
+  8011ad:	44 89 ee             	mov    %r13d,%esi
+  8011b0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011b7:	00 00 00 
+  8011ba:	8b 38                	mov    (%rax),%edi
+  8011bc:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  8011c3:	00 00 00 
+  8011c6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011cd:	4c 89 e2             	mov    %r12,%rdx
+  8011d0:	48 89 de             	mov    %rbx,%rsi
+  8011d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d8:	48 b8 50 35 80 00 00 	movabs $0x803550,%rax
+  8011df:	00 00 00 
+  8011e2:	ff d0                	call   *%rax
+}
+  8011e4:	48 83 c4 08          	add    $0x8,%rsp
+  8011e8:	5b                   	pop    %rbx
+  8011e9:	41 5c                	pop    %r12
+  8011eb:	41 5d                	pop    %r13
+  8011ed:	5d                   	pop    %rbp
+  8011ee:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011ef:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011f4:	48 b8 26 36 80 00 00 	movabs $0x803626,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+  801200:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801207:	00 00 
+  801209:	eb 8d                	jmp    801198 <fsipc_region+0x25>
+
+000000000080120b <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80120b:	55                   	push   %rbp
+  80120c:	48 89 e5             	mov    %rsp,%rbp
+  80120f:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801213:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80121a:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80121b:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80121f:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  801226:	00 00 00 
+  801229:	ff d0                	call   *%rax
+}
+  80122b:	c9                   	leave
+  80122c:	c3                   	ret
+
+000000000080122d <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80122d:	85 ff                	test   %edi,%edi
+  80122f:	78 6d                	js     80129e <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	41 54                	push   %r12
+  801237:	53                   	push   %rbx
+  801238:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80123b:	48 85 f6             	test   %rsi,%rsi
+  80123e:	74 57                	je     801297 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801240:	89 f8                	mov    %edi,%eax
+  801242:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801249:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80124b:	be 00 00 00 00       	mov    $0x0,%esi
+  801250:	bf 12 00 00 00       	mov    $0x12,%edi
+  801255:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  80125c:	00 00 00 
+  80125f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801261:	85 c0                	test   %eax,%eax
+  801263:	78 2d                	js     801292 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801265:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80126c:	00 00 00 
+  80126f:	49 63 14 24          	movslq (%r12),%rdx
+  801273:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80127a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80127f:	48 89 df             	mov    %rbx,%rdi
+  801282:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  801289:	00 00 00 
+  80128c:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80128e:	41 8b 04 24          	mov    (%r12),%eax
+}
+  801292:	5b                   	pop    %rbx
+  801293:	41 5c                	pop    %r12
+  801295:	5d                   	pop    %rbp
+  801296:	c3                   	ret
+        return -E_INVAL;
+  801297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129c:	eb f4                	jmp    801292 <devfile_df_snapshots+0x65>
+  80129e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012a3:	c3                   	ret
+
+00000000008012a4 <devfile_df_busy>:
+devfile_df_busy() {
+  8012a4:	55                   	push   %rbp
+  8012a5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012b2:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8012b9:	00 00 00 
+  8012bc:	ff d0                	call   *%rax
+}
+  8012be:	5d                   	pop    %rbp
+  8012bf:	c3                   	ret
+
+00000000008012c0 <devfile_df_free>:
+devfile_df_free() {
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012ce:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8012d5:	00 00 00 
+  8012d8:	ff d0                	call   *%rax
+}
+  8012da:	5d                   	pop    %rbp
+  8012db:	c3                   	ret
+
+00000000008012dc <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012ea:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8012f1:	00 00 00 
+  8012f4:	ff d0                	call   *%rax
+}
+  8012f6:	5d                   	pop    %rbp
+  8012f7:	c3                   	ret
+
+00000000008012f8 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	bf 09 00 00 00       	mov    $0x9,%edi
+  801306:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  80130d:	00 00 00 
+  801310:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801312:	85 c0                	test   %eax,%eax
+  801314:	ba 00 00 00 00       	mov    $0x0,%edx
+  801319:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80131c:	5d                   	pop    %rbp
+  80131d:	c3                   	ret
+
+000000000080131e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80131e:	55                   	push   %rbp
+  80131f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801322:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801329:	00 00 00 
+  80132c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80132f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801331:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801334:	be 00 00 00 00       	mov    $0x0,%esi
+  801339:	bf 02 00 00 00       	mov    $0x2,%edi
+  80133e:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+}
+  80134a:	5d                   	pop    %rbp
+  80134b:	c3                   	ret
+
+000000000080134c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80134c:	55                   	push   %rbp
+  80134d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801350:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801353:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80135a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80135c:	be 00 00 00 00       	mov    $0x0,%esi
+  801361:	bf 06 00 00 00       	mov    $0x6,%edi
+  801366:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  80136d:	00 00 00 
+  801370:	ff d0                	call   *%rax
+}
+  801372:	5d                   	pop    %rbp
+  801373:	c3                   	ret
+
+0000000000801374 <devfile_write>:
+    if (!fd || !buf) {
+  801374:	48 85 ff             	test   %rdi,%rdi
+  801377:	0f 84 c1 00 00 00    	je     80143e <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	41 57                	push   %r15
+  801383:	41 56                	push   %r14
+  801385:	41 55                	push   %r13
+  801387:	41 54                	push   %r12
+  801389:	53                   	push   %rbx
+  80138a:	48 83 ec 18          	sub    $0x18,%rsp
+  80138e:	49 89 ff             	mov    %rdi,%r15
+  801391:	49 89 f5             	mov    %rsi,%r13
+  801394:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801397:	48 85 f6             	test   %rsi,%rsi
+  80139a:	0f 84 95 00 00 00    	je     801435 <devfile_write+0xc1>
+    while (n) {
+  8013a0:	48 85 d2             	test   %rdx,%rdx
+  8013a3:	0f 84 83 00 00 00    	je     80142c <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013a9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013b0:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013b7:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013ba:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013bf:	49 39 dc             	cmp    %rbx,%r12
+  8013c2:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013c6:	48 89 da             	mov    %rbx,%rdx
+  8013c9:	4c 89 ee             	mov    %r13,%rsi
+  8013cc:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013d3:	00 00 00 
+  8013d6:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  8013dd:	00 00 00 
+  8013e0:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013e2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013e6:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013e9:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013f7:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8013fe:	00 00 00 
+  801401:	ff d0                	call   *%rax
+        if (write < 0) {
+  801403:	85 c0                	test   %eax,%eax
+  801405:	78 21                	js     801428 <devfile_write+0xb4>
+        buf += write;
+  801407:	48 63 d0             	movslq %eax,%rdx
+  80140a:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80140d:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801410:	49 29 d4             	sub    %rdx,%r12
+  801413:	75 a5                	jne    8013ba <devfile_write+0x46>
+    return totalWrite;
+  801415:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801419:	48 83 c4 18          	add    $0x18,%rsp
+  80141d:	5b                   	pop    %rbx
+  80141e:	41 5c                	pop    %r12
+  801420:	41 5d                	pop    %r13
+  801422:	41 5e                	pop    %r14
+  801424:	41 5f                	pop    %r15
+  801426:	5d                   	pop    %rbp
+  801427:	c3                   	ret
+            return write;
+  801428:	48 98                	cltq
+  80142a:	eb ed                	jmp    801419 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80142c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801433:	eb e0                	jmp    801415 <devfile_write+0xa1>
+        return -E_INVAL;
+  801435:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80143c:	eb db                	jmp    801419 <devfile_write+0xa5>
+  80143e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801445:	c3                   	ret
+
+0000000000801446 <devfile_read>:
+    if (!fd || !buf) {
+  801446:	48 85 ff             	test   %rdi,%rdi
+  801449:	0f 84 c0 00 00 00    	je     80150f <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+  801453:	41 57                	push   %r15
+  801455:	41 56                	push   %r14
+  801457:	41 55                	push   %r13
+  801459:	41 54                	push   %r12
+  80145b:	53                   	push   %rbx
+  80145c:	48 83 ec 18          	sub    $0x18,%rsp
+  801460:	49 89 ff             	mov    %rdi,%r15
+  801463:	49 89 f5             	mov    %rsi,%r13
+  801466:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801469:	48 85 f6             	test   %rsi,%rsi
+  80146c:	0f 84 96 00 00 00    	je     801508 <devfile_read+0xc2>
+    while (n) {
+  801472:	48 85 d2             	test   %rdx,%rdx
+  801475:	0f 84 87 00 00 00    	je     801502 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80147b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801482:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801483:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80148a:	00 00 00 
+  80148d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801491:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  801494:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801499:	49 39 c4             	cmp    %rax,%r12
+  80149c:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014a0:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014ae:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8014b5:	00 00 00 
+  8014b8:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	7e 37                	jle    8014f5 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014be:	48 63 d8             	movslq %eax,%rbx
+  8014c1:	48 89 da             	mov    %rbx,%rdx
+  8014c4:	4c 89 f6             	mov    %r14,%rsi
+  8014c7:	4c 89 ef             	mov    %r13,%rdi
+  8014ca:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+        buf += read;
+  8014d6:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014d9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014dd:	49 29 dc             	sub    %rbx,%r12
+  8014e0:	75 ab                	jne    80148d <devfile_read+0x47>
+  return totalRead;
+  8014e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014e6:	48 83 c4 18          	add    $0x18,%rsp
+  8014ea:	5b                   	pop    %rbx
+  8014eb:	41 5c                	pop    %r12
+  8014ed:	41 5d                	pop    %r13
+  8014ef:	41 5e                	pop    %r14
+  8014f1:	41 5f                	pop    %r15
+  8014f3:	5d                   	pop    %rbp
+  8014f4:	c3                   	ret
+            return read ? read : totalRead;
+  8014f5:	48 63 d0             	movslq %eax,%rdx
+  8014f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014fc:	48 0f 45 c2          	cmovne %rdx,%rax
+  801500:	eb e4                	jmp    8014e6 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  801502:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801506:	eb da                	jmp    8014e2 <devfile_read+0x9c>
+        return E_INVAL;
+  801508:	b8 03 00 00 00       	mov    $0x3,%eax
+  80150d:	eb d7                	jmp    8014e6 <devfile_read+0xa0>
+  80150f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801514:	c3                   	ret
+
+0000000000801515 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801515:	48 85 ff             	test   %rdi,%rdi
+  801518:	74 5f                	je     801579 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80151a:	55                   	push   %rbp
+  80151b:	48 89 e5             	mov    %rsp,%rbp
+  80151e:	53                   	push   %rbx
+  80151f:	48 83 ec 08          	sub    $0x8,%rsp
+  801523:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801526:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  80152d:	00 00 00 
+  801530:	ff d0                	call   *%rax
+  801532:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801538:	77 45                	ja     80157f <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80153a:	48 89 de             	mov    %rbx,%rsi
+  80153d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801544:	00 00 00 
+  801547:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  80154e:	00 00 00 
+  801551:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80155d:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801564:	00 00 00 
+  801567:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801570:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801573:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+        return -E_INVAL;
+  801579:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80157e:	c3                   	ret
+        return -E_INVAL;
+  80157f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801584:	eb ed                	jmp    801573 <devfile_receive_snapshot+0x5e>
+
+0000000000801586 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	41 55                	push   %r13
+  80158c:	41 54                	push   %r12
+  80158e:	53                   	push   %rbx
+  80158f:	48 83 ec 08          	sub    $0x8,%rsp
+  801593:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  801596:	48 85 f6             	test   %rsi,%rsi
+  801599:	0f 94 c0             	sete   %al
+  80159c:	48 85 d2             	test   %rdx,%rdx
+  80159f:	0f 94 c2             	sete   %dl
+  8015a2:	08 d0                	or     %dl,%al
+  8015a4:	0f 85 ad 00 00 00    	jne    801657 <devfile_send_snapshot+0xd1>
+  8015aa:	48 89 fb             	mov    %rdi,%rbx
+  8015ad:	49 89 f4             	mov    %rsi,%r12
+  8015b0:	48 85 ff             	test   %rdi,%rdi
+  8015b3:	0f 84 9e 00 00 00    	je     801657 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015b9:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8015c0:	00 00 00 
+  8015c3:	ff d0                	call   *%rax
+  8015c5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015cb:	0f 87 8d 00 00 00    	ja     80165e <devfile_send_snapshot+0xd8>
+  8015d1:	4c 89 e7             	mov    %r12,%rdi
+  8015d4:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015e6:	77 7d                	ja     801665 <devfile_send_snapshot+0xdf>
+  8015e8:	4c 89 ef             	mov    %r13,%rdi
+  8015eb:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8015f2:	00 00 00 
+  8015f5:	ff d0                	call   *%rax
+  8015f7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8015fd:	77 6d                	ja     80166c <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8015ff:	48 89 de             	mov    %rbx,%rsi
+  801602:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801609:	00 00 00 
+  80160c:	48 bb 66 2f 80 00 00 	movabs $0x802f66,%rbx
+  801613:	00 00 00 
+  801616:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801618:	4c 89 e6             	mov    %r12,%rsi
+  80161b:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801622:	00 00 00 
+  801625:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801627:	4c 89 ee             	mov    %r13,%rsi
+  80162a:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801631:	00 00 00 
+  801634:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801636:	be 00 00 00 00       	mov    $0x0,%esi
+  80163b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801640:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801647:	00 00 00 
+  80164a:	ff d0                	call   *%rax
+}
+  80164c:	48 83 c4 08          	add    $0x8,%rsp
+  801650:	5b                   	pop    %rbx
+  801651:	41 5c                	pop    %r12
+  801653:	41 5d                	pop    %r13
+  801655:	5d                   	pop    %rbp
+  801656:	c3                   	ret
+        return -E_INVAL;
+  801657:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165c:	eb ee                	jmp    80164c <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80165e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801663:	eb e7                	jmp    80164c <devfile_send_snapshot+0xc6>
+  801665:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80166a:	eb e0                	jmp    80164c <devfile_send_snapshot+0xc6>
+  80166c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801671:	eb d9                	jmp    80164c <devfile_send_snapshot+0xc6>
+
+0000000000801673 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801673:	48 85 ff             	test   %rdi,%rdi
+  801676:	0f 84 41 01 00 00    	je     8017bd <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	41 57                	push   %r15
+  801682:	41 56                	push   %r14
+  801684:	41 55                	push   %r13
+  801686:	41 54                	push   %r12
+  801688:	53                   	push   %rbx
+  801689:	48 83 ec 08          	sub    $0x8,%rsp
+  80168d:	49 89 fc             	mov    %rdi,%r12
+  801690:	49 89 f5             	mov    %rsi,%r13
+  801693:	48 89 d3             	mov    %rdx,%rbx
+  801696:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  801699:	48 85 f6             	test   %rsi,%rsi
+  80169c:	0f 84 ff 00 00 00    	je     8017a1 <devfile_diff_snapshots+0x12e>
+  8016a2:	48 85 d2             	test   %rdx,%rdx
+  8016a5:	0f 84 fd 00 00 00    	je     8017a8 <devfile_diff_snapshots+0x135>
+  8016ab:	48 85 c9             	test   %rcx,%rcx
+  8016ae:	0f 84 f4 00 00 00    	je     8017a8 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016b4:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8016bb:	00 00 00 
+  8016be:	ff d0                	call   *%rax
+  8016c0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016c6:	0f 87 e3 00 00 00    	ja     8017af <devfile_diff_snapshots+0x13c>
+  8016cc:	4c 89 ef             	mov    %r13,%rdi
+  8016cf:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8016d6:	00 00 00 
+  8016d9:	ff d0                	call   *%rax
+  8016db:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016e1:	0f 87 cf 00 00 00    	ja     8017b6 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016e7:	4c 89 e6             	mov    %r12,%rsi
+  8016ea:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016f1:	00 00 00 
+  8016f4:	4c 89 e7             	mov    %r12,%rdi
+  8016f7:	49 bf 66 2f 80 00 00 	movabs $0x802f66,%r15
+  8016fe:	00 00 00 
+  801701:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  801704:	4c 89 ee             	mov    %r13,%rsi
+  801707:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80170e:	00 
+  80170f:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801712:	48 8b 03             	mov    (%rbx),%rax
+  801715:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80171c:	00 
+  80171d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801721:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801728:	00 
+  801729:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80172d:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801734:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801735:	be 00 00 00 00       	mov    $0x0,%esi
+  80173a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80173f:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801746:	00 00 00 
+  801749:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	78 43                	js     801792 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80174f:	49 8b 04 24          	mov    (%r12),%rax
+  801753:	48 89 03             	mov    %rax,(%rbx)
+  801756:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80175b:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80175f:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801764:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801768:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80176d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801771:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801775:	48 c1 e2 03          	shl    $0x3,%rdx
+  801779:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80177e:	4c 89 f7             	mov    %r14,%rdi
+  801781:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  801788:	00 00 00 
+  80178b:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80178d:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  801792:	48 83 c4 08          	add    $0x8,%rsp
+  801796:	5b                   	pop    %rbx
+  801797:	41 5c                	pop    %r12
+  801799:	41 5d                	pop    %r13
+  80179b:	41 5e                	pop    %r14
+  80179d:	41 5f                	pop    %r15
+  80179f:	5d                   	pop    %rbp
+  8017a0:	c3                   	ret
+        return -E_INVAL;
+  8017a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a6:	eb ea                	jmp    801792 <devfile_diff_snapshots+0x11f>
+  8017a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ad:	eb e3                	jmp    801792 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b4:	eb dc                	jmp    801792 <devfile_diff_snapshots+0x11f>
+  8017b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bb:	eb d5                	jmp    801792 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017c2:	c3                   	ret
+
+00000000008017c3 <devfile_delete_snapshot>:
+    if (!name) {
+  8017c3:	48 85 ff             	test   %rdi,%rdi
+  8017c6:	74 5f                	je     801827 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+  8017cc:	53                   	push   %rbx
+  8017cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d1:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017d4:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8017db:	00 00 00 
+  8017de:	ff d0                	call   *%rax
+  8017e0:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017e6:	77 45                	ja     80182d <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017e8:	48 89 de             	mov    %rbx,%rsi
+  8017eb:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017f2:	00 00 00 
+  8017f5:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  801801:	be 00 00 00 00       	mov    $0x0,%esi
+  801806:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80180b:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801812:	00 00 00 
+  801815:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801817:	85 c0                	test   %eax,%eax
+  801819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801821:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+        return -E_INVAL;
+  801827:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80182c:	c3                   	ret
+        return -E_INVAL;
+  80182d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801832:	eb ed                	jmp    801821 <devfile_delete_snapshot+0x5e>
+
+0000000000801834 <devfile_accept_snapshot>:
+    if (!name) {
+  801834:	48 85 ff             	test   %rdi,%rdi
+  801837:	74 5f                	je     801898 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 83 ec 08          	sub    $0x8,%rsp
+  801842:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801845:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  80184c:	00 00 00 
+  80184f:	ff d0                	call   *%rax
+  801851:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801857:	77 45                	ja     80189e <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801859:	48 89 de             	mov    %rbx,%rsi
+  80185c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801863:	00 00 00 
+  801866:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801872:	be 00 00 00 00       	mov    $0x0,%esi
+  801877:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80187c:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801883:	00 00 00 
+  801886:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801892:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+        return -E_INVAL;
+  801898:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80189d:	c3                   	ret
+        return -E_INVAL;
+  80189e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a3:	eb ed                	jmp    801892 <devfile_accept_snapshot+0x5e>
+
+00000000008018a5 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018a5:	48 85 ff             	test   %rdi,%rdi
+  8018a8:	0f 84 9f 00 00 00    	je     80194d <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018ae:	55                   	push   %rbp
+  8018af:	48 89 e5             	mov    %rsp,%rbp
+  8018b2:	41 54                	push   %r12
+  8018b4:	53                   	push   %rbx
+  8018b5:	48 89 fb             	mov    %rdi,%rbx
+  8018b8:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018bb:	48 85 f6             	test   %rsi,%rsi
+  8018be:	74 78                	je     801938 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018c0:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8018c7:	00 00 00 
+  8018ca:	ff d0                	call   *%rax
+  8018cc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018d2:	77 6b                	ja     80193f <devfile_create_snapshot+0x9a>
+  8018d4:	4c 89 e7             	mov    %r12,%rdi
+  8018d7:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8018de:	00 00 00 
+  8018e1:	ff d0                	call   *%rax
+  8018e3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018e9:	77 5b                	ja     801946 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018eb:	48 89 de             	mov    %rbx,%rsi
+  8018ee:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018f5:	00 00 00 
+  8018f8:	48 bb 66 2f 80 00 00 	movabs $0x802f66,%rbx
+  8018ff:	00 00 00 
+  801902:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  801904:	4c 89 e6             	mov    %r12,%rsi
+  801907:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80190e:	00 00 00 
+  801911:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801913:	be 00 00 00 00       	mov    $0x0,%esi
+  801918:	bf 08 00 00 00       	mov    $0x8,%edi
+  80191d:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801930:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801933:	5b                   	pop    %rbx
+  801934:	41 5c                	pop    %r12
+  801936:	5d                   	pop    %rbp
+  801937:	c3                   	ret
+        return -E_INVAL;
+  801938:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193d:	eb f4                	jmp    801933 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80193f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801944:	eb ed                	jmp    801933 <devfile_create_snapshot+0x8e>
+  801946:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194b:	eb e6                	jmp    801933 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80194d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801952:	c3                   	ret
+
+0000000000801953 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801953:	55                   	push   %rbp
+  801954:	48 89 e5             	mov    %rsp,%rbp
+  801957:	41 54                	push   %r12
+  801959:	53                   	push   %rbx
+  80195a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80195d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801960:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801967:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801969:	be 00 00 00 00       	mov    $0x0,%esi
+  80196e:	bf 05 00 00 00       	mov    $0x5,%edi
+  801973:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	78 3d                	js     8019c0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801983:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80198a:	00 00 00 
+  80198d:	4c 89 e6             	mov    %r12,%rsi
+  801990:	48 89 df             	mov    %rbx,%rdi
+  801993:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80199f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019a6:	00 
+  8019a7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ad:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019b4:	00 
+  8019b5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c0:	5b                   	pop    %rbx
+  8019c1:	41 5c                	pop    %r12
+  8019c3:	5d                   	pop    %rbp
+  8019c4:	c3                   	ret
+
+00000000008019c5 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019c5:	55                   	push   %rbp
+  8019c6:	48 89 e5             	mov    %rsp,%rbp
+  8019c9:	41 57                	push   %r15
+  8019cb:	41 56                	push   %r14
+  8019cd:	41 55                	push   %r13
+  8019cf:	41 54                	push   %r12
+  8019d1:	53                   	push   %rbx
+  8019d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8019d6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019da:	49 89 f5             	mov    %rsi,%r13
+  8019dd:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019e0:	48 89 f0             	mov    %rsi,%rax
+  8019e3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019e8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019ec:	75 4f                	jne    801a3d <devfile_readmap+0x78>
+  8019ee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019f2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8019f8:	75 1f                	jne    801a19 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8019fa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019fe:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a02:	49 be ad 21 80 00 00 	movabs $0x8021ad,%r14
+  801a09:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a0c:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a13:	0f 87 9d 00 00 00    	ja     801ab6 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a19:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a1d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a21:	4d 85 ff             	test   %r15,%r15
+  801a24:	0f 85 cf 00 00 00    	jne    801af9 <devfile_readmap+0x134>
+  801a2a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a2e:	48 83 c4 38          	add    $0x38,%rsp
+  801a32:	5b                   	pop    %rbx
+  801a33:	41 5c                	pop    %r12
+  801a35:	41 5d                	pop    %r13
+  801a37:	41 5e                	pop    %r14
+  801a39:	41 5f                	pop    %r15
+  801a3b:	5d                   	pop    %rbp
+  801a3c:	c3                   	ret
+    size_t totalRead = 0;
+  801a3d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a44:	00 
+  801a45:	eb da                	jmp    801a21 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a47:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a4b:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a4e:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a55:	00 00 00 
+  801a58:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a5e:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a62:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a66:	4c 89 ee             	mov    %r13,%rsi
+  801a69:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a6e:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	7e a3                	jle    801a21 <devfile_readmap+0x5c>
+  801a7e:	48 98                	cltq
+  801a80:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a84:	72 9b                	jb     801a21 <devfile_readmap+0x5c>
+        buf += read;
+  801a86:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a89:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a8c:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a90:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801a97:	75 88                	jne    801a21 <devfile_readmap+0x5c>
+  801a99:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a9d:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801aa3:	0f 85 78 ff ff ff    	jne    801a21 <devfile_readmap+0x5c>
+  801aa9:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801ab0:	0f 86 6b ff ff ff    	jbe    801a21 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ab6:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801abc:	4d 39 e7             	cmp    %r12,%r15
+  801abf:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ac3:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801aca:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ace:	0f 84 73 ff ff ff    	je     801a47 <devfile_readmap+0x82>
+  801ad4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801ad8:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801add:	41 ff d6             	call   *%r14
+  801ae0:	a8 40                	test   $0x40,%al
+  801ae2:	0f 85 39 ff ff ff    	jne    801a21 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ae8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aef:	4c 39 e3             	cmp    %r12,%rbx
+  801af2:	72 e4                	jb     801ad8 <devfile_readmap+0x113>
+  801af4:	e9 4e ff ff ff       	jmp    801a47 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801af9:	4c 89 fa             	mov    %r15,%rdx
+  801afc:	4c 89 ee             	mov    %r13,%rsi
+  801aff:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b03:	48 b8 46 14 80 00 00 	movabs $0x801446,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b0f:	48 85 c0             	test   %rax,%rax
+  801b12:	78 0c                	js     801b20 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b14:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b18:	48 01 f0             	add    %rsi,%rax
+  801b1b:	e9 0e ff ff ff       	jmp    801a2e <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b20:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b24:	48 85 f6             	test   %rsi,%rsi
+  801b27:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b2b:	e9 fe fe ff ff       	jmp    801a2e <devfile_readmap+0x69>
+
+0000000000801b30 <open>:
+open(const char *path, int mode) {
+  801b30:	55                   	push   %rbp
+  801b31:	48 89 e5             	mov    %rsp,%rbp
+  801b34:	41 55                	push   %r13
+  801b36:	41 54                	push   %r12
+  801b38:	53                   	push   %rbx
+  801b39:	48 83 ec 18          	sub    $0x18,%rsp
+  801b3d:	49 89 fc             	mov    %rdi,%r12
+  801b40:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b43:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+  801b4f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b55:	0f 87 8a 00 00 00    	ja     801be5 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b5b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b5f:	48 b8 8e 06 80 00 00 	movabs $0x80068e,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	89 c3                	mov    %eax,%ebx
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 50                	js     801bc1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b71:	4c 89 e6             	mov    %r12,%rsi
+  801b74:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b7b:	00 00 00 
+  801b7e:	48 89 df             	mov    %rbx,%rdi
+  801b81:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  801b88:	00 00 00 
+  801b8b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b8d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b94:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801b98:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b9d:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	89 c3                	mov    %eax,%ebx
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 1f                	js     801bce <open+0x9e>
+    return fd2num(fd);
+  801baf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bb3:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+  801bbf:	89 c3                	mov    %eax,%ebx
+}
+  801bc1:	89 d8                	mov    %ebx,%eax
+  801bc3:	48 83 c4 18          	add    $0x18,%rsp
+  801bc7:	5b                   	pop    %rbx
+  801bc8:	41 5c                	pop    %r12
+  801bca:	41 5d                	pop    %r13
+  801bcc:	5d                   	pop    %rbp
+  801bcd:	c3                   	ret
+        fd_close(fd, 0);
+  801bce:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bd7:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+        return res;
+  801be3:	eb dc                	jmp    801bc1 <open+0x91>
+        return -E_BAD_PATH;
+  801be5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bea:	eb d5                	jmp    801bc1 <open+0x91>
+
+0000000000801bec <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bec:	55                   	push   %rbp
+  801bed:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801bf0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf5:	bf 13 00 00 00       	mov    $0x13,%edi
+  801bfa:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+}
+  801c06:	5d                   	pop    %rbp
+  801c07:	c3                   	ret
+
+0000000000801c08 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c08:	55                   	push   %rbp
+  801c09:	48 89 e5             	mov    %rsp,%rbp
+  801c0c:	41 54                	push   %r12
+  801c0e:	53                   	push   %rbx
+  801c0f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c12:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+  801c1e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c21:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  801c28:	00 00 00 
+  801c2b:	48 89 df             	mov    %rbx,%rdi
+  801c2e:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c3a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c3f:	41 2b 04 24          	sub    (%r12),%eax
+  801c43:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c50:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c53:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c5a:	00 00 00 
+  801c5d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c69:	5b                   	pop    %rbx
+  801c6a:	41 5c                	pop    %r12
+  801c6c:	5d                   	pop    %rbp
+  801c6d:	c3                   	ret
+
+0000000000801c6e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	41 54                	push   %r12
+  801c74:	53                   	push   %rbx
+  801c75:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c7d:	48 89 fe             	mov    %rdi,%rsi
+  801c80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c85:	49 bc 5c 03 80 00 00 	movabs $0x80035c,%r12
+  801c8c:	00 00 00 
+  801c8f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c92:	48 89 df             	mov    %rbx,%rdi
+  801c95:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	48 89 c6             	mov    %rax,%rsi
+  801ca4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ca9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cae:	41 ff d4             	call   *%r12
+}
+  801cb1:	5b                   	pop    %rbx
+  801cb2:	41 5c                	pop    %r12
+  801cb4:	5d                   	pop    %rbp
+  801cb5:	c3                   	ret
+
+0000000000801cb6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cb6:	55                   	push   %rbp
+  801cb7:	48 89 e5             	mov    %rsp,%rbp
+  801cba:	41 57                	push   %r15
+  801cbc:	41 56                	push   %r14
+  801cbe:	41 55                	push   %r13
+  801cc0:	41 54                	push   %r12
+  801cc2:	53                   	push   %rbx
+  801cc3:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc7:	49 89 fc             	mov    %rdi,%r12
+  801cca:	49 89 f5             	mov    %rsi,%r13
+  801ccd:	49 89 d7             	mov    %rdx,%r15
+  801cd0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cd4:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801ce0:	4d 85 ff             	test   %r15,%r15
+  801ce3:	0f 84 af 00 00 00    	je     801d98 <devpipe_write+0xe2>
+  801ce9:	48 89 c3             	mov    %rax,%rbx
+  801cec:	4c 89 f8             	mov    %r15,%rax
+  801cef:	4d 89 ef             	mov    %r13,%r15
+  801cf2:	4c 01 e8             	add    %r13,%rax
+  801cf5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801cf9:	49 bd 64 02 80 00 00 	movabs $0x800264,%r13
+  801d00:	00 00 00 
+            sys_yield();
+  801d03:	49 be 01 02 80 00 00 	movabs $0x800201,%r14
+  801d0a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d0d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d10:	48 63 ce             	movslq %esi,%rcx
+  801d13:	48 63 03             	movslq (%rbx),%rax
+  801d16:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d1c:	48 39 c1             	cmp    %rax,%rcx
+  801d1f:	72 2e                	jb     801d4f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d21:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d26:	48 89 da             	mov    %rbx,%rdx
+  801d29:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d2e:	4c 89 e7             	mov    %r12,%rdi
+  801d31:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	74 66                	je     801d9e <devpipe_write+0xe8>
+            sys_yield();
+  801d38:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d3b:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d3e:	48 63 ce             	movslq %esi,%rcx
+  801d41:	48 63 03             	movslq (%rbx),%rax
+  801d44:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d4a:	48 39 c1             	cmp    %rax,%rcx
+  801d4d:	73 d2                	jae    801d21 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d4f:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d53:	48 89 ca             	mov    %rcx,%rdx
+  801d56:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d5a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d61:	08 10 20 
+  801d64:	48 f7 e2             	mul    %rdx
+  801d67:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d6b:	48 89 d0             	mov    %rdx,%rax
+  801d6e:	48 c1 e0 09          	shl    $0x9,%rax
+  801d72:	48 29 d0             	sub    %rdx,%rax
+  801d75:	48 c1 e0 03          	shl    $0x3,%rax
+  801d79:	48 29 c1             	sub    %rax,%rcx
+  801d7c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d81:	83 c6 01             	add    $0x1,%esi
+  801d84:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d87:	49 83 c7 01          	add    $0x1,%r15
+  801d8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d8f:	49 39 c7             	cmp    %rax,%r15
+  801d92:	0f 85 75 ff ff ff    	jne    801d0d <devpipe_write+0x57>
+    return n;
+  801d98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d9c:	eb 05                	jmp    801da3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801da3:	48 83 c4 18          	add    $0x18,%rsp
+  801da7:	5b                   	pop    %rbx
+  801da8:	41 5c                	pop    %r12
+  801daa:	41 5d                	pop    %r13
+  801dac:	41 5e                	pop    %r14
+  801dae:	41 5f                	pop    %r15
+  801db0:	5d                   	pop    %rbp
+  801db1:	c3                   	ret
+
+0000000000801db2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	41 57                	push   %r15
+  801db8:	41 56                	push   %r14
+  801dba:	41 55                	push   %r13
+  801dbc:	41 54                	push   %r12
+  801dbe:	53                   	push   %rbx
+  801dbf:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc3:	49 89 fc             	mov    %rdi,%r12
+  801dc6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dce:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801dd5:	00 00 00 
+  801dd8:	ff d0                	call   *%rax
+  801dda:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801ddd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801de3:	49 bd 64 02 80 00 00 	movabs $0x800264,%r13
+  801dea:	00 00 00 
+            sys_yield();
+  801ded:	49 be 01 02 80 00 00 	movabs $0x800201,%r14
+  801df4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801df7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dfc:	74 7d                	je     801e7b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801dfe:	8b 03                	mov    (%rbx),%eax
+  801e00:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e03:	75 26                	jne    801e2b <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e05:	4d 85 ff             	test   %r15,%r15
+  801e08:	75 77                	jne    801e81 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e0f:	48 89 da             	mov    %rbx,%rdx
+  801e12:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e17:	4c 89 e7             	mov    %r12,%rdi
+  801e1a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	74 72                	je     801e93 <devpipe_read+0xe1>
+            sys_yield();
+  801e21:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e24:	8b 03                	mov    (%rbx),%eax
+  801e26:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e29:	74 df                	je     801e0a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e2b:	48 63 c8             	movslq %eax,%rcx
+  801e2e:	48 89 ca             	mov    %rcx,%rdx
+  801e31:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e35:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e3c:	08 10 20 
+  801e3f:	48 89 d0             	mov    %rdx,%rax
+  801e42:	48 f7 e6             	mul    %rsi
+  801e45:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e49:	48 89 d0             	mov    %rdx,%rax
+  801e4c:	48 c1 e0 09          	shl    $0x9,%rax
+  801e50:	48 29 d0             	sub    %rdx,%rax
+  801e53:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e5a:	00 
+  801e5b:	48 89 c8             	mov    %rcx,%rax
+  801e5e:	48 29 d0             	sub    %rdx,%rax
+  801e61:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e66:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e6a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e6e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e71:	49 83 c7 01          	add    $0x1,%r15
+  801e75:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e79:	75 83                	jne    801dfe <devpipe_read+0x4c>
+    return n;
+  801e7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e7f:	eb 03                	jmp    801e84 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e81:	4c 89 f8             	mov    %r15,%rax
+}
+  801e84:	48 83 c4 18          	add    $0x18,%rsp
+  801e88:	5b                   	pop    %rbx
+  801e89:	41 5c                	pop    %r12
+  801e8b:	41 5d                	pop    %r13
+  801e8d:	41 5e                	pop    %r14
+  801e8f:	41 5f                	pop    %r15
+  801e91:	5d                   	pop    %rbp
+  801e92:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e98:	eb ea                	jmp    801e84 <devpipe_read+0xd2>
+
+0000000000801e9a <pipe>:
+pipe(int pfd[2]) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+  801e9e:	41 55                	push   %r13
+  801ea0:	41 54                	push   %r12
+  801ea2:	53                   	push   %rbx
+  801ea3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801eaa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801eae:	48 b8 8e 06 80 00 00 	movabs $0x80068e,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	89 c3                	mov    %eax,%ebx
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	0f 88 a0 01 00 00    	js     802064 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ec4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ec9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ece:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ed2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed7:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  801ede:	00 00 00 
+  801ee1:	ff d0                	call   *%rax
+  801ee3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	0f 88 77 01 00 00    	js     802064 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801eed:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801ef1:	48 b8 8e 06 80 00 00 	movabs $0x80068e,%rax
+  801ef8:	00 00 00 
+  801efb:	ff d0                	call   *%rax
+  801efd:	89 c3                	mov    %eax,%ebx
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	0f 88 43 01 00 00    	js     80204a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f07:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f0c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f11:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1a:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  801f21:	00 00 00 
+  801f24:	ff d0                	call   *%rax
+  801f26:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	0f 88 1a 01 00 00    	js     80204a <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f30:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f34:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f43:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f4d:	48 89 c6             	mov    %rax,%rsi
+  801f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f55:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  801f61:	89 c3                	mov    %eax,%ebx
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	0f 88 c5 00 00 00    	js     802030 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f6b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f6f:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	48 89 c1             	mov    %rax,%rcx
+  801f7e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f84:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8f:	4c 89 ee             	mov    %r13,%rsi
+  801f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f97:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 6e                	js     802017 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fa9:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fae:	4c 89 ef             	mov    %r13,%rdi
+  801fb1:	48 b8 32 02 80 00 00 	movabs $0x800232,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	83 f8 02             	cmp    $0x2,%eax
+  801fc0:	0f 85 ab 00 00 00    	jne    802071 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fc6:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fcd:	00 00 
+  801fcf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fd3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fd5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fd9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801fe0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fe4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801fe6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801ff1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ff5:	48 bb 60 06 80 00 00 	movabs $0x800660,%rbx
+  801ffc:	00 00 00 
+  801fff:	ff d3                	call   *%rbx
+  802001:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802005:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802009:	ff d3                	call   *%rbx
+  80200b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802010:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802015:	eb 4d                	jmp    802064 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802017:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80201c:	4c 89 ee             	mov    %r13,%rsi
+  80201f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802024:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802030:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802035:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203e:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80204a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80204f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802053:	bf 00 00 00 00       	mov    $0x0,%edi
+  802058:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+}
+  802064:	89 d8                	mov    %ebx,%eax
+  802066:	48 83 c4 18          	add    $0x18,%rsp
+  80206a:	5b                   	pop    %rbx
+  80206b:	41 5c                	pop    %r12
+  80206d:	41 5d                	pop    %r13
+  80206f:	5d                   	pop    %rbp
+  802070:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802071:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  802078:	00 00 00 
+  80207b:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  802082:	00 00 00 
+  802085:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80208a:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  802091:	00 00 00 
+  802094:	b8 00 00 00 00       	mov    $0x0,%eax
+  802099:	49 b8 f1 24 80 00 00 	movabs $0x8024f1,%r8
+  8020a0:	00 00 00 
+  8020a3:	41 ff d0             	call   *%r8
+
+00000000008020a6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020a6:	55                   	push   %rbp
+  8020a7:	48 89 e5             	mov    %rsp,%rbp
+  8020aa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020ae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020b2:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 35                	js     8020f7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020c6:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+  8020d2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020d5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020df:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020e3:	48 b8 64 02 80 00 00 	movabs $0x800264,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	0f 94 c0             	sete   %al
+  8020f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+00000000008020f9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8020f9:	48 89 f8             	mov    %rdi,%rax
+  8020fc:	48 c1 e8 27          	shr    $0x27,%rax
+  802100:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802107:	01 00 00 
+  80210a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80210e:	f6 c2 01             	test   $0x1,%dl
+  802111:	74 6d                	je     802180 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802113:	48 89 f8             	mov    %rdi,%rax
+  802116:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80211a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802121:	01 00 00 
+  802124:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802128:	f6 c2 01             	test   $0x1,%dl
+  80212b:	74 62                	je     80218f <get_uvpt_entry+0x96>
+  80212d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802134:	01 00 00 
+  802137:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80213b:	f6 c2 80             	test   $0x80,%dl
+  80213e:	75 4f                	jne    80218f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802140:	48 89 f8             	mov    %rdi,%rax
+  802143:	48 c1 e8 15          	shr    $0x15,%rax
+  802147:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80214e:	01 00 00 
+  802151:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802155:	f6 c2 01             	test   $0x1,%dl
+  802158:	74 44                	je     80219e <get_uvpt_entry+0xa5>
+  80215a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802161:	01 00 00 
+  802164:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802168:	f6 c2 80             	test   $0x80,%dl
+  80216b:	75 31                	jne    80219e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80216d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802171:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802178:	01 00 00 
+  80217b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80217f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802180:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802187:	01 00 00 
+  80218a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80218e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80218f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802196:	01 00 00 
+  802199:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80219d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80219e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021a5:	01 00 00 
+  8021a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021ac:	c3                   	ret
+
+00000000008021ad <get_prot>:
+
+int
+get_prot(void *va) {
+  8021ad:	55                   	push   %rbp
+  8021ae:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021b1:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  8021b8:	00 00 00 
+  8021bb:	ff d0                	call   *%rax
+  8021bd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021c0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021c5:	89 c1                	mov    %eax,%ecx
+  8021c7:	83 c9 04             	or     $0x4,%ecx
+  8021ca:	f6 c2 01             	test   $0x1,%dl
+  8021cd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021d0:	89 c1                	mov    %eax,%ecx
+  8021d2:	83 c9 02             	or     $0x2,%ecx
+  8021d5:	f6 c2 02             	test   $0x2,%dl
+  8021d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021db:	89 c1                	mov    %eax,%ecx
+  8021dd:	83 c9 01             	or     $0x1,%ecx
+  8021e0:	48 85 d2             	test   %rdx,%rdx
+  8021e3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021e6:	89 c1                	mov    %eax,%ecx
+  8021e8:	83 c9 40             	or     $0x40,%ecx
+  8021eb:	f6 c6 04             	test   $0x4,%dh
+  8021ee:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021f1:	5d                   	pop    %rbp
+  8021f2:	c3                   	ret
+
+00000000008021f3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021f7:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  8021fe:	00 00 00 
+  802201:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802203:	48 c1 e8 06          	shr    $0x6,%rax
+  802207:	83 e0 01             	and    $0x1,%eax
+}
+  80220a:	5d                   	pop    %rbp
+  80220b:	c3                   	ret
+
+000000000080220c <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80220c:	55                   	push   %rbp
+  80220d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802210:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80221c:	48 c1 e8 05          	shr    $0x5,%rax
+  802220:	83 e0 01             	and    $0x1,%eax
+}
+  802223:	5d                   	pop    %rbp
+  802224:	c3                   	ret
+
+0000000000802225 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802229:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  802230:	00 00 00 
+  802233:	ff d0                	call   *%rax
+  802235:	83 e0 01             	and    $0x1,%eax
+}
+  802238:	5d                   	pop    %rbp
+  802239:	c3                   	ret
+
+000000000080223a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+  80223e:	41 57                	push   %r15
+  802240:	41 56                	push   %r14
+  802242:	41 55                	push   %r13
+  802244:	41 54                	push   %r12
+  802246:	53                   	push   %rbx
+  802247:	48 83 ec 18          	sub    $0x18,%rsp
+  80224b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80224f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802253:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802258:	49 bd 25 22 80 00 00 	movabs $0x802225,%r13
+  80225f:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802262:	49 bf ad 21 80 00 00 	movabs $0x8021ad,%r15
+  802269:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80226c:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802273:	00 00 00 
+  802276:	eb 0c                	jmp    802284 <foreach_shared_region+0x4a>
+  802278:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80227f:	4c 39 f3             	cmp    %r14,%rbx
+  802282:	74 2e                	je     8022b2 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  802284:	48 89 df             	mov    %rbx,%rdi
+  802287:	41 ff d5             	call   *%r13
+  80228a:	84 c0                	test   %al,%al
+  80228c:	74 ea                	je     802278 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80228e:	48 89 df             	mov    %rbx,%rdi
+  802291:	41 ff d7             	call   *%r15
+  802294:	a8 40                	test   $0x40,%al
+  802296:	74 e0                	je     802278 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  802298:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80229f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022a3:	48 89 df             	mov    %rbx,%rdi
+  8022a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022aa:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	79 c8                	jns    802278 <foreach_shared_region+0x3e>
+  8022b0:	eb 05                	jmp    8022b7 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b7:	48 83 c4 18          	add    $0x18,%rsp
+  8022bb:	5b                   	pop    %rbx
+  8022bc:	41 5c                	pop    %r12
+  8022be:	41 5d                	pop    %r13
+  8022c0:	41 5e                	pop    %r14
+  8022c2:	41 5f                	pop    %r15
+  8022c4:	5d                   	pop    %rbp
+  8022c5:	c3                   	ret
+
+00000000008022c6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cb:	c3                   	ret
+
+00000000008022cc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022cc:	55                   	push   %rbp
+  8022cd:	48 89 e5             	mov    %rsp,%rbp
+  8022d0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022d3:	48 be d4 37 80 00 00 	movabs $0x8037d4,%rsi
+  8022da:	00 00 00 
+  8022dd:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  8022e4:	00 00 00 
+  8022e7:	ff d0                	call   *%rax
+    return 0;
+}
+  8022e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ee:	5d                   	pop    %rbp
+  8022ef:	c3                   	ret
+
+00000000008022f0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022f0:	55                   	push   %rbp
+  8022f1:	48 89 e5             	mov    %rsp,%rbp
+  8022f4:	41 57                	push   %r15
+  8022f6:	41 56                	push   %r14
+  8022f8:	41 55                	push   %r13
+  8022fa:	41 54                	push   %r12
+  8022fc:	53                   	push   %rbx
+  8022fd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802304:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80230b:	48 85 d2             	test   %rdx,%rdx
+  80230e:	74 7a                	je     80238a <devcons_write+0x9a>
+  802310:	49 89 d6             	mov    %rdx,%r14
+  802313:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802319:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80231e:	49 bf 60 31 80 00 00 	movabs $0x803160,%r15
+  802325:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802328:	4c 89 f3             	mov    %r14,%rbx
+  80232b:	48 29 f3             	sub    %rsi,%rbx
+  80232e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802333:	48 39 c3             	cmp    %rax,%rbx
+  802336:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80233a:	4c 63 eb             	movslq %ebx,%r13
+  80233d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802344:	48 01 c6             	add    %rax,%rsi
+  802347:	4c 89 ea             	mov    %r13,%rdx
+  80234a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802351:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802354:	4c 89 ee             	mov    %r13,%rsi
+  802357:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80235e:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80236a:	41 01 dc             	add    %ebx,%r12d
+  80236d:	49 63 f4             	movslq %r12d,%rsi
+  802370:	4c 39 f6             	cmp    %r14,%rsi
+  802373:	72 b3                	jb     802328 <devcons_write+0x38>
+    return res;
+  802375:	49 63 c4             	movslq %r12d,%rax
+}
+  802378:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80237f:	5b                   	pop    %rbx
+  802380:	41 5c                	pop    %r12
+  802382:	41 5d                	pop    %r13
+  802384:	41 5e                	pop    %r14
+  802386:	41 5f                	pop    %r15
+  802388:	5d                   	pop    %rbp
+  802389:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80238a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802390:	eb e3                	jmp    802375 <devcons_write+0x85>
+
+0000000000802392 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802392:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239a:	48 85 c0             	test   %rax,%rax
+  80239d:	74 55                	je     8023f4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80239f:	55                   	push   %rbp
+  8023a0:	48 89 e5             	mov    %rsp,%rbp
+  8023a3:	41 55                	push   %r13
+  8023a5:	41 54                	push   %r12
+  8023a7:	53                   	push   %rbx
+  8023a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ac:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023af:	48 bb 34 01 80 00 00 	movabs $0x800134,%rbx
+  8023b6:	00 00 00 
+  8023b9:	49 bc 01 02 80 00 00 	movabs $0x800201,%r12
+  8023c0:	00 00 00 
+  8023c3:	eb 03                	jmp    8023c8 <devcons_read+0x36>
+  8023c5:	41 ff d4             	call   *%r12
+  8023c8:	ff d3                	call   *%rbx
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	74 f7                	je     8023c5 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023ce:	48 63 d0             	movslq %eax,%rdx
+  8023d1:	78 13                	js     8023e6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d8:	83 f8 04             	cmp    $0x4,%eax
+  8023db:	74 09                	je     8023e6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023dd:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023e1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023e6:	48 89 d0             	mov    %rdx,%rax
+  8023e9:	48 83 c4 08          	add    $0x8,%rsp
+  8023ed:	5b                   	pop    %rbx
+  8023ee:	41 5c                	pop    %r12
+  8023f0:	41 5d                	pop    %r13
+  8023f2:	5d                   	pop    %rbp
+  8023f3:	c3                   	ret
+  8023f4:	48 89 d0             	mov    %rdx,%rax
+  8023f7:	c3                   	ret
+
+00000000008023f8 <cputchar>:
+cputchar(int ch) {
+  8023f8:	55                   	push   %rbp
+  8023f9:	48 89 e5             	mov    %rsp,%rbp
+  8023fc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802400:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802404:	be 01 00 00 00       	mov    $0x1,%esi
+  802409:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80240d:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  802414:	00 00 00 
+  802417:	ff d0                	call   *%rax
+}
+  802419:	c9                   	leave
+  80241a:	c3                   	ret
+
+000000000080241b <getchar>:
+getchar(void) {
+  80241b:	55                   	push   %rbp
+  80241c:	48 89 e5             	mov    %rsp,%rbp
+  80241f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802423:	ba 01 00 00 00       	mov    $0x1,%edx
+  802428:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80242c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802431:	48 b8 d1 09 80 00 00 	movabs $0x8009d1,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+  80243d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 06                	js     802449 <getchar+0x2e>
+  802443:	74 08                	je     80244d <getchar+0x32>
+  802445:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802449:	89 d0                	mov    %edx,%eax
+  80244b:	c9                   	leave
+  80244c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80244d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802452:	eb f5                	jmp    802449 <getchar+0x2e>
+
+0000000000802454 <iscons>:
+iscons(int fdnum) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+  802458:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80245c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802460:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	78 18                	js     802488 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802470:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802474:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80247b:	00 00 00 
+  80247e:	8b 00                	mov    (%rax),%eax
+  802480:	39 02                	cmp    %eax,(%rdx)
+  802482:	0f 94 c0             	sete   %al
+  802485:	0f b6 c0             	movzbl %al,%eax
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+000000000080248a <opencons>:
+opencons(void) {
+  80248a:	55                   	push   %rbp
+  80248b:	48 89 e5             	mov    %rsp,%rbp
+  80248e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802492:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802496:	48 b8 8e 06 80 00 00 	movabs $0x80068e,%rax
+  80249d:	00 00 00 
+  8024a0:	ff d0                	call   *%rax
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	78 49                	js     8024ef <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024a6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024b0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b9:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 26                	js     8024ef <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024cd:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024d4:	00 00 
+  8024d6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024dc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024e3:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+}
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+00000000008024f1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+  8024f5:	41 56                	push   %r14
+  8024f7:	41 55                	push   %r13
+  8024f9:	41 54                	push   %r12
+  8024fb:	53                   	push   %rbx
+  8024fc:	48 83 ec 50          	sub    $0x50,%rsp
+  802500:	49 89 fc             	mov    %rdi,%r12
+  802503:	41 89 f5             	mov    %esi,%r13d
+  802506:	48 89 d3             	mov    %rdx,%rbx
+  802509:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80250d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802511:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802515:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80251c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802520:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802524:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802528:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80252c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802533:	00 00 00 
+  802536:	4c 8b 30             	mov    (%rax),%r14
+  802539:	48 b8 d0 01 80 00 00 	movabs $0x8001d0,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+  802545:	89 c6                	mov    %eax,%esi
+  802547:	45 89 e8             	mov    %r13d,%r8d
+  80254a:	4c 89 e1             	mov    %r12,%rcx
+  80254d:	4c 89 f2             	mov    %r14,%rdx
+  802550:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  802557:	00 00 00 
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255f:	49 bc 41 26 80 00 00 	movabs $0x802641,%r12
+  802566:	00 00 00 
+  802569:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80256c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802570:	48 89 df             	mov    %rbx,%rdi
+  802573:	48 b8 dd 25 80 00 00 	movabs $0x8025dd,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80257f:	48 bf 3b 37 80 00 00 	movabs $0x80373b,%rdi
+  802586:	00 00 00 
+  802589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802591:	cc                   	int3
+  802592:	eb fd                	jmp    802591 <_panic+0xa0>
+
+0000000000802594 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802594:	55                   	push   %rbp
+  802595:	48 89 e5             	mov    %rsp,%rbp
+  802598:	53                   	push   %rbx
+  802599:	48 83 ec 08          	sub    $0x8,%rsp
+  80259d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025a0:	8b 06                	mov    (%rsi),%eax
+  8025a2:	8d 50 01             	lea    0x1(%rax),%edx
+  8025a5:	89 16                	mov    %edx,(%rsi)
+  8025a7:	48 98                	cltq
+  8025a9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025ae:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025b4:	74 0a                	je     8025c0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025b6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025be:	c9                   	leave
+  8025bf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025c0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025c4:	be ff 00 00 00       	mov    $0xff,%esi
+  8025c9:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025d5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025db:	eb d9                	jmp    8025b6 <putch+0x22>
+
+00000000008025dd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025dd:	55                   	push   %rbp
+  8025de:	48 89 e5             	mov    %rsp,%rbp
+  8025e1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025e8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025eb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025f2:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8025ff:	48 89 f1             	mov    %rsi,%rcx
+  802602:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802609:	48 bf 94 25 80 00 00 	movabs $0x802594,%rdi
+  802610:	00 00 00 
+  802613:	48 b8 91 27 80 00 00 	movabs $0x802791,%rax
+  80261a:	00 00 00 
+  80261d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80261f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802626:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80262d:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802639:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+
+0000000000802641 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	48 83 ec 50          	sub    $0x50,%rsp
+  802649:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80264d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802651:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802655:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802659:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80265d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802664:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802668:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80266c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802670:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802674:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802678:	48 b8 dd 25 80 00 00 	movabs $0x8025dd,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	41 57                	push   %r15
+  80268c:	41 56                	push   %r14
+  80268e:	41 55                	push   %r13
+  802690:	41 54                	push   %r12
+  802692:	53                   	push   %rbx
+  802693:	48 83 ec 18          	sub    $0x18,%rsp
+  802697:	49 89 fc             	mov    %rdi,%r12
+  80269a:	49 89 f5             	mov    %rsi,%r13
+  80269d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026a1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026a4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026a7:	41 89 cf             	mov    %ecx,%r15d
+  8026aa:	4c 39 fa             	cmp    %r15,%rdx
+  8026ad:	73 5b                	jae    80270a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026af:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026b3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026b7:	85 db                	test   %ebx,%ebx
+  8026b9:	7e 0e                	jle    8026c9 <print_num+0x43>
+            putch(padc, put_arg);
+  8026bb:	4c 89 ee             	mov    %r13,%rsi
+  8026be:	44 89 f7             	mov    %r14d,%edi
+  8026c1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026c4:	83 eb 01             	sub    $0x1,%ebx
+  8026c7:	75 f2                	jne    8026bb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026c9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026cd:	48 b9 14 38 80 00 00 	movabs $0x803814,%rcx
+  8026d4:	00 00 00 
+  8026d7:	48 b8 03 38 80 00 00 	movabs $0x803803,%rax
+  8026de:	00 00 00 
+  8026e1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ee:	49 f7 f7             	div    %r15
+  8026f1:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8026f5:	4c 89 ee             	mov    %r13,%rsi
+  8026f8:	41 ff d4             	call   *%r12
+}
+  8026fb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8026ff:	5b                   	pop    %rbx
+  802700:	41 5c                	pop    %r12
+  802702:	41 5d                	pop    %r13
+  802704:	41 5e                	pop    %r14
+  802706:	41 5f                	pop    %r15
+  802708:	5d                   	pop    %rbp
+  802709:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80270a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80270e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802713:	49 f7 f7             	div    %r15
+  802716:	48 83 ec 08          	sub    $0x8,%rsp
+  80271a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80271e:	52                   	push   %rdx
+  80271f:	45 0f be c9          	movsbl %r9b,%r9d
+  802723:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802727:	48 89 c2             	mov    %rax,%rdx
+  80272a:	48 b8 86 26 80 00 00 	movabs $0x802686,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	48 83 c4 10          	add    $0x10,%rsp
+  80273a:	eb 8d                	jmp    8026c9 <print_num+0x43>
+
+000000000080273c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80273c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802740:	48 8b 06             	mov    (%rsi),%rax
+  802743:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802747:	73 0a                	jae    802753 <sprintputch+0x17>
+        *state->start++ = ch;
+  802749:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80274d:	48 89 16             	mov    %rdx,(%rsi)
+  802750:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802753:	c3                   	ret
+
+0000000000802754 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802754:	55                   	push   %rbp
+  802755:	48 89 e5             	mov    %rsp,%rbp
+  802758:	48 83 ec 50          	sub    $0x50,%rsp
+  80275c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802760:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802764:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802768:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80276f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802773:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802777:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80277b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80277f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802783:	48 b8 91 27 80 00 00 	movabs $0x802791,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+}
+  80278f:	c9                   	leave
+  802790:	c3                   	ret
+
+0000000000802791 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802791:	55                   	push   %rbp
+  802792:	48 89 e5             	mov    %rsp,%rbp
+  802795:	41 57                	push   %r15
+  802797:	41 56                	push   %r14
+  802799:	41 55                	push   %r13
+  80279b:	41 54                	push   %r12
+  80279d:	53                   	push   %rbx
+  80279e:	48 83 ec 38          	sub    $0x38,%rsp
+  8027a2:	49 89 fe             	mov    %rdi,%r14
+  8027a5:	49 89 f5             	mov    %rsi,%r13
+  8027a8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027ab:	48 8b 01             	mov    (%rcx),%rax
+  8027ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027b2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ba:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027c2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027c6:	0f b6 3b             	movzbl (%rbx),%edi
+  8027c9:	40 80 ff 25          	cmp    $0x25,%dil
+  8027cd:	74 18                	je     8027e7 <vprintfmt+0x56>
+            if (!ch) return;
+  8027cf:	40 84 ff             	test   %dil,%dil
+  8027d2:	0f 84 b1 06 00 00    	je     802e89 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027d8:	40 0f b6 ff          	movzbl %dil,%edi
+  8027dc:	4c 89 ee             	mov    %r13,%rsi
+  8027df:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027e2:	4c 89 e3             	mov    %r12,%rbx
+  8027e5:	eb db                	jmp    8027c2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ec:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027f0:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8027f5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027fb:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802802:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802806:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80280b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802810:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802813:	83 e8 23             	sub    $0x23,%eax
+  802816:	3c 57                	cmp    $0x57,%al
+  802818:	0f 87 51 06 00 00    	ja     802e6f <vprintfmt+0x6de>
+  80281e:	0f b6 c0             	movzbl %al,%eax
+  802821:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  802828:	00 00 00 
+  80282b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80282e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802831:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802835:	eb cf                	jmp    802806 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802837:	49 89 dc             	mov    %rbx,%r12
+  80283a:	be 01 00 00 00       	mov    $0x1,%esi
+  80283f:	eb c5                	jmp    802806 <vprintfmt+0x75>
+            padc = ch;
+  802841:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802845:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802848:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80284b:	eb b9                	jmp    802806 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80284d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802850:	83 f8 2f             	cmp    $0x2f,%eax
+  802853:	77 24                	ja     802879 <vprintfmt+0xe8>
+  802855:	89 c1                	mov    %eax,%ecx
+  802857:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80285b:	83 c0 08             	add    $0x8,%eax
+  80285e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802861:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802864:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802867:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80286b:	79 99                	jns    802806 <vprintfmt+0x75>
+                width = precision;
+  80286d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802871:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802877:	eb 8d                	jmp    802806 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802879:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80287d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802881:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802885:	eb da                	jmp    802861 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802887:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80288c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802890:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802896:	3c 39                	cmp    $0x39,%al
+  802898:	77 1c                	ja     8028b6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80289a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80289e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028a2:	0f b6 c0             	movzbl %al,%eax
+  8028a5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028aa:	0f b6 03             	movzbl (%rbx),%eax
+  8028ad:	3c 39                	cmp    $0x39,%al
+  8028af:	76 e9                	jbe    80289a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028b1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028b4:	eb b1                	jmp    802867 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028b6:	49 89 dc             	mov    %rbx,%r12
+  8028b9:	eb ac                	jmp    802867 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028bb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028be:	85 c9                	test   %ecx,%ecx
+  8028c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c5:	0f 49 c1             	cmovns %ecx,%eax
+  8028c8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028ce:	e9 33 ff ff ff       	jmp    802806 <vprintfmt+0x75>
+            lflag++;
+  8028d3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028d6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028d9:	e9 28 ff ff ff       	jmp    802806 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8028e4:	77 19                	ja     8028ff <vprintfmt+0x16e>
+  8028e6:	89 c2                	mov    %eax,%edx
+  8028e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028ec:	83 c0 08             	add    $0x8,%eax
+  8028ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028f2:	8b 3a                	mov    (%rdx),%edi
+  8028f4:	4c 89 ee             	mov    %r13,%rsi
+  8028f7:	41 ff d6             	call   *%r14
+            break;
+  8028fa:	e9 c3 fe ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8028ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802903:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80290b:	eb e5                	jmp    8028f2 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80290d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802910:	83 f8 2f             	cmp    $0x2f,%eax
+  802913:	77 5a                	ja     80296f <vprintfmt+0x1de>
+  802915:	89 c2                	mov    %eax,%edx
+  802917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80291b:	83 c0 08             	add    $0x8,%eax
+  80291e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802921:	8b 02                	mov    (%rdx),%eax
+  802923:	89 c1                	mov    %eax,%ecx
+  802925:	f7 d9                	neg    %ecx
+  802927:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80292a:	83 f9 14             	cmp    $0x14,%ecx
+  80292d:	7f 4e                	jg     80297d <vprintfmt+0x1ec>
+  80292f:	48 63 c1             	movslq %ecx,%rax
+  802932:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  802939:	00 00 00 
+  80293c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802940:	48 85 c0             	test   %rax,%rax
+  802943:	74 38                	je     80297d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802945:	48 89 c1             	mov    %rax,%rcx
+  802948:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  80294f:	00 00 00 
+  802952:	4c 89 ee             	mov    %r13,%rsi
+  802955:	4c 89 f7             	mov    %r14,%rdi
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295d:	49 b8 54 27 80 00 00 	movabs $0x802754,%r8
+  802964:	00 00 00 
+  802967:	41 ff d0             	call   *%r8
+  80296a:	e9 53 fe ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80296f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80297b:	eb a4                	jmp    802921 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80297d:	48 ba 2c 38 80 00 00 	movabs $0x80382c,%rdx
+  802984:	00 00 00 
+  802987:	4c 89 ee             	mov    %r13,%rsi
+  80298a:	4c 89 f7             	mov    %r14,%rdi
+  80298d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802992:	49 b8 54 27 80 00 00 	movabs $0x802754,%r8
+  802999:	00 00 00 
+  80299c:	41 ff d0             	call   *%r8
+  80299f:	e9 1e fe ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8029aa:	77 6c                	ja     802a18 <vprintfmt+0x287>
+  8029ac:	89 c2                	mov    %eax,%edx
+  8029ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029b2:	83 c0 08             	add    $0x8,%eax
+  8029b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029b8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029bb:	48 85 d2             	test   %rdx,%rdx
+  8029be:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8029c5:	00 00 00 
+  8029c8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029cc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029d0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029d4:	7e 06                	jle    8029dc <vprintfmt+0x24b>
+  8029d6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029da:	75 4a                	jne    802a26 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029dc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029e0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029e4:	0f b6 00             	movzbl (%rax),%eax
+  8029e7:	84 c0                	test   %al,%al
+  8029e9:	0f 85 9a 00 00 00    	jne    802a89 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029ef:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029f2:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	0f 8e c4 fd ff ff    	jle    8027c2 <vprintfmt+0x31>
+  8029fe:	4c 89 ee             	mov    %r13,%rsi
+  802a01:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a06:	41 ff d6             	call   *%r14
+  802a09:	41 83 ec 01          	sub    $0x1,%r12d
+  802a0d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a11:	75 eb                	jne    8029fe <vprintfmt+0x26d>
+  802a13:	e9 aa fd ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a24:	eb 92                	jmp    8029b8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a26:	49 63 f7             	movslq %r15d,%rsi
+  802a29:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a2d:	48 b8 43 2f 80 00 00 	movabs $0x802f43,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+  802a39:	48 89 c2             	mov    %rax,%rdx
+  802a3c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a3f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a41:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a44:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a47:	85 c0                	test   %eax,%eax
+  802a49:	7e 91                	jle    8029dc <vprintfmt+0x24b>
+  802a4b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a50:	4c 89 ee             	mov    %r13,%rsi
+  802a53:	44 89 e7             	mov    %r12d,%edi
+  802a56:	41 ff d6             	call   *%r14
+  802a59:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a5d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a60:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a63:	75 eb                	jne    802a50 <vprintfmt+0x2bf>
+  802a65:	e9 72 ff ff ff       	jmp    8029dc <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a6a:	0f b6 f8             	movzbl %al,%edi
+  802a6d:	4c 89 ee             	mov    %r13,%rsi
+  802a70:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a73:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a77:	49 83 c4 01          	add    $0x1,%r12
+  802a7b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a81:	84 c0                	test   %al,%al
+  802a83:	0f 84 66 ff ff ff    	je     8029ef <vprintfmt+0x25e>
+  802a89:	45 85 ff             	test   %r15d,%r15d
+  802a8c:	78 0a                	js     802a98 <vprintfmt+0x307>
+  802a8e:	41 83 ef 01          	sub    $0x1,%r15d
+  802a92:	0f 88 57 ff ff ff    	js     8029ef <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a98:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802a9c:	74 cc                	je     802a6a <vprintfmt+0x2d9>
+  802a9e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802aa1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802aa6:	80 fa 5e             	cmp    $0x5e,%dl
+  802aa9:	77 c2                	ja     802a6d <vprintfmt+0x2dc>
+  802aab:	eb bd                	jmp    802a6a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802aad:	40 84 f6             	test   %sil,%sil
+  802ab0:	75 26                	jne    802ad8 <vprintfmt+0x347>
+    switch (lflag) {
+  802ab2:	85 d2                	test   %edx,%edx
+  802ab4:	74 59                	je     802b0f <vprintfmt+0x37e>
+  802ab6:	83 fa 01             	cmp    $0x1,%edx
+  802ab9:	74 7b                	je     802b36 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802abb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802abe:	83 f8 2f             	cmp    $0x2f,%eax
+  802ac1:	0f 87 96 00 00 00    	ja     802b5d <vprintfmt+0x3cc>
+  802ac7:	89 c2                	mov    %eax,%edx
+  802ac9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802acd:	83 c0 08             	add    $0x8,%eax
+  802ad0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ad3:	4c 8b 22             	mov    (%rdx),%r12
+  802ad6:	eb 17                	jmp    802aef <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802adb:	83 f8 2f             	cmp    $0x2f,%eax
+  802ade:	77 21                	ja     802b01 <vprintfmt+0x370>
+  802ae0:	89 c2                	mov    %eax,%edx
+  802ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ae6:	83 c0 08             	add    $0x8,%eax
+  802ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802aec:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802aef:	4d 85 e4             	test   %r12,%r12
+  802af2:	78 7a                	js     802b6e <vprintfmt+0x3dd>
+            num = i;
+  802af4:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802af7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802afc:	e9 50 02 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b0d:	eb dd                	jmp    802aec <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b12:	83 f8 2f             	cmp    $0x2f,%eax
+  802b15:	77 11                	ja     802b28 <vprintfmt+0x397>
+  802b17:	89 c2                	mov    %eax,%edx
+  802b19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b1d:	83 c0 08             	add    $0x8,%eax
+  802b20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b23:	4c 63 22             	movslq (%rdx),%r12
+  802b26:	eb c7                	jmp    802aef <vprintfmt+0x35e>
+  802b28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b34:	eb ed                	jmp    802b23 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b39:	83 f8 2f             	cmp    $0x2f,%eax
+  802b3c:	77 11                	ja     802b4f <vprintfmt+0x3be>
+  802b3e:	89 c2                	mov    %eax,%edx
+  802b40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b44:	83 c0 08             	add    $0x8,%eax
+  802b47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b4a:	4c 8b 22             	mov    (%rdx),%r12
+  802b4d:	eb a0                	jmp    802aef <vprintfmt+0x35e>
+  802b4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b5b:	eb ed                	jmp    802b4a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b69:	e9 65 ff ff ff       	jmp    802ad3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b6e:	4c 89 ee             	mov    %r13,%rsi
+  802b71:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b76:	41 ff d6             	call   *%r14
+                i = -i;
+  802b79:	49 f7 dc             	neg    %r12
+  802b7c:	e9 73 ff ff ff       	jmp    802af4 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b81:	40 84 f6             	test   %sil,%sil
+  802b84:	75 32                	jne    802bb8 <vprintfmt+0x427>
+    switch (lflag) {
+  802b86:	85 d2                	test   %edx,%edx
+  802b88:	74 5d                	je     802be7 <vprintfmt+0x456>
+  802b8a:	83 fa 01             	cmp    $0x1,%edx
+  802b8d:	0f 84 82 00 00 00    	je     802c15 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b96:	83 f8 2f             	cmp    $0x2f,%eax
+  802b99:	0f 87 a5 00 00 00    	ja     802c44 <vprintfmt+0x4b3>
+  802b9f:	89 c2                	mov    %eax,%edx
+  802ba1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ba5:	83 c0 08             	add    $0x8,%eax
+  802ba8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bab:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bb3:	e9 99 01 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  802bbe:	77 19                	ja     802bd9 <vprintfmt+0x448>
+  802bc0:	89 c2                	mov    %eax,%edx
+  802bc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bc6:	83 c0 08             	add    $0x8,%eax
+  802bc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bcc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bcf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bd4:	e9 78 01 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+  802bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802be5:	eb e5                	jmp    802bcc <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802be7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bea:	83 f8 2f             	cmp    $0x2f,%eax
+  802bed:	77 18                	ja     802c07 <vprintfmt+0x476>
+  802bef:	89 c2                	mov    %eax,%edx
+  802bf1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bf5:	83 c0 08             	add    $0x8,%eax
+  802bf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bfb:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802bfd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c02:	e9 4a 01 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+  802c07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c13:	eb e6                	jmp    802bfb <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c18:	83 f8 2f             	cmp    $0x2f,%eax
+  802c1b:	77 19                	ja     802c36 <vprintfmt+0x4a5>
+  802c1d:	89 c2                	mov    %eax,%edx
+  802c1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c23:	83 c0 08             	add    $0x8,%eax
+  802c26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c29:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c2c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c31:	e9 1b 01 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+  802c36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c42:	eb e5                	jmp    802c29 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c50:	e9 56 ff ff ff       	jmp    802bab <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c55:	40 84 f6             	test   %sil,%sil
+  802c58:	75 2e                	jne    802c88 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c5a:	85 d2                	test   %edx,%edx
+  802c5c:	74 59                	je     802cb7 <vprintfmt+0x526>
+  802c5e:	83 fa 01             	cmp    $0x1,%edx
+  802c61:	74 7f                	je     802ce2 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c66:	83 f8 2f             	cmp    $0x2f,%eax
+  802c69:	0f 87 9f 00 00 00    	ja     802d0e <vprintfmt+0x57d>
+  802c6f:	89 c2                	mov    %eax,%edx
+  802c71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c75:	83 c0 08             	add    $0x8,%eax
+  802c78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c7b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c7e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c83:	e9 c9 00 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c8b:	83 f8 2f             	cmp    $0x2f,%eax
+  802c8e:	77 19                	ja     802ca9 <vprintfmt+0x518>
+  802c90:	89 c2                	mov    %eax,%edx
+  802c92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c96:	83 c0 08             	add    $0x8,%eax
+  802c99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c9c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c9f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802ca4:	e9 a8 00 00 00       	jmp    802d51 <vprintfmt+0x5c0>
+  802ca9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cb5:	eb e5                	jmp    802c9c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cba:	83 f8 2f             	cmp    $0x2f,%eax
+  802cbd:	77 15                	ja     802cd4 <vprintfmt+0x543>
+  802cbf:	89 c2                	mov    %eax,%edx
+  802cc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cc5:	83 c0 08             	add    $0x8,%eax
+  802cc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ccb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802ccd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cd2:	eb 7d                	jmp    802d51 <vprintfmt+0x5c0>
+  802cd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ce0:	eb e9                	jmp    802ccb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802ce2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ce5:	83 f8 2f             	cmp    $0x2f,%eax
+  802ce8:	77 16                	ja     802d00 <vprintfmt+0x56f>
+  802cea:	89 c2                	mov    %eax,%edx
+  802cec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cf0:	83 c0 08             	add    $0x8,%eax
+  802cf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cf9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802cfe:	eb 51                	jmp    802d51 <vprintfmt+0x5c0>
+  802d00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d0c:	eb e8                	jmp    802cf6 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d1a:	e9 5c ff ff ff       	jmp    802c7b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d1f:	4c 89 ee             	mov    %r13,%rsi
+  802d22:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d27:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d2a:	4c 89 ee             	mov    %r13,%rsi
+  802d2d:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d32:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d38:	83 f8 2f             	cmp    $0x2f,%eax
+  802d3b:	77 47                	ja     802d84 <vprintfmt+0x5f3>
+  802d3d:	89 c2                	mov    %eax,%edx
+  802d3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d43:	83 c0 08             	add    $0x8,%eax
+  802d46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d49:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d4c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d51:	48 83 ec 08          	sub    $0x8,%rsp
+  802d55:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d59:	0f 94 c0             	sete   %al
+  802d5c:	0f b6 c0             	movzbl %al,%eax
+  802d5f:	50                   	push   %rax
+  802d60:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d65:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d69:	4c 89 ee             	mov    %r13,%rsi
+  802d6c:	4c 89 f7             	mov    %r14,%rdi
+  802d6f:	48 b8 86 26 80 00 00 	movabs $0x802686,%rax
+  802d76:	00 00 00 
+  802d79:	ff d0                	call   *%rax
+            break;
+  802d7b:	48 83 c4 10          	add    $0x10,%rsp
+  802d7f:	e9 3e fa ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d90:	eb b7                	jmp    802d49 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d92:	40 84 f6             	test   %sil,%sil
+  802d95:	75 2b                	jne    802dc2 <vprintfmt+0x631>
+    switch (lflag) {
+  802d97:	85 d2                	test   %edx,%edx
+  802d99:	74 56                	je     802df1 <vprintfmt+0x660>
+  802d9b:	83 fa 01             	cmp    $0x1,%edx
+  802d9e:	74 7f                	je     802e1f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802da0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802da3:	83 f8 2f             	cmp    $0x2f,%eax
+  802da6:	0f 87 a2 00 00 00    	ja     802e4e <vprintfmt+0x6bd>
+  802dac:	89 c2                	mov    %eax,%edx
+  802dae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802db2:	83 c0 08             	add    $0x8,%eax
+  802db5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802db8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dbb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dc0:	eb 8f                	jmp    802d51 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802dc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dc5:	83 f8 2f             	cmp    $0x2f,%eax
+  802dc8:	77 19                	ja     802de3 <vprintfmt+0x652>
+  802dca:	89 c2                	mov    %eax,%edx
+  802dcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dd0:	83 c0 08             	add    $0x8,%eax
+  802dd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dd6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dde:	e9 6e ff ff ff       	jmp    802d51 <vprintfmt+0x5c0>
+  802de3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802de7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802def:	eb e5                	jmp    802dd6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802df1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802df4:	83 f8 2f             	cmp    $0x2f,%eax
+  802df7:	77 18                	ja     802e11 <vprintfmt+0x680>
+  802df9:	89 c2                	mov    %eax,%edx
+  802dfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dff:	83 c0 08             	add    $0x8,%eax
+  802e02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e05:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e07:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e0c:	e9 40 ff ff ff       	jmp    802d51 <vprintfmt+0x5c0>
+  802e11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e1d:	eb e6                	jmp    802e05 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e22:	83 f8 2f             	cmp    $0x2f,%eax
+  802e25:	77 19                	ja     802e40 <vprintfmt+0x6af>
+  802e27:	89 c2                	mov    %eax,%edx
+  802e29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e2d:	83 c0 08             	add    $0x8,%eax
+  802e30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e36:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e3b:	e9 11 ff ff ff       	jmp    802d51 <vprintfmt+0x5c0>
+  802e40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e4c:	eb e5                	jmp    802e33 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e5a:	e9 59 ff ff ff       	jmp    802db8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e5f:	4c 89 ee             	mov    %r13,%rsi
+  802e62:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e67:	41 ff d6             	call   *%r14
+            break;
+  802e6a:	e9 53 f9 ff ff       	jmp    8027c2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e6f:	4c 89 ee             	mov    %r13,%rsi
+  802e72:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e77:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e7a:	48 83 eb 01          	sub    $0x1,%rbx
+  802e7e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e82:	75 f6                	jne    802e7a <vprintfmt+0x6e9>
+  802e84:	e9 39 f9 ff ff       	jmp    8027c2 <vprintfmt+0x31>
+}
+  802e89:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e8d:	5b                   	pop    %rbx
+  802e8e:	41 5c                	pop    %r12
+  802e90:	41 5d                	pop    %r13
+  802e92:	41 5e                	pop    %r14
+  802e94:	41 5f                	pop    %r15
+  802e96:	5d                   	pop    %rbp
+  802e97:	c3                   	ret
+
+0000000000802e98 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802e98:	55                   	push   %rbp
+  802e99:	48 89 e5             	mov    %rsp,%rbp
+  802e9c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802ea0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ea4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ea9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ead:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802eb4:	48 85 ff             	test   %rdi,%rdi
+  802eb7:	74 2b                	je     802ee4 <vsnprintf+0x4c>
+  802eb9:	48 85 f6             	test   %rsi,%rsi
+  802ebc:	74 26                	je     802ee4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ebe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ec2:	48 bf 3c 27 80 00 00 	movabs $0x80273c,%rdi
+  802ec9:	00 00 00 
+  802ecc:	48 b8 91 27 80 00 00 	movabs $0x802791,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ed8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802edc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802edf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ee2:	c9                   	leave
+  802ee3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802ee4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ee9:	eb f7                	jmp    802ee2 <vsnprintf+0x4a>
+
+0000000000802eeb <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802eeb:	55                   	push   %rbp
+  802eec:	48 89 e5             	mov    %rsp,%rbp
+  802eef:	48 83 ec 50          	sub    $0x50,%rsp
+  802ef3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ef7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802efb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802eff:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f06:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f0e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f12:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f16:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f1a:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f26:	c9                   	leave
+  802f27:	c3                   	ret
+
+0000000000802f28 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f28:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f2b:	74 10                	je     802f3d <strlen+0x15>
+    size_t n = 0;
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f32:	48 83 c0 01          	add    $0x1,%rax
+  802f36:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f3a:	75 f6                	jne    802f32 <strlen+0xa>
+  802f3c:	c3                   	ret
+    size_t n = 0;
+  802f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f42:	c3                   	ret
+
+0000000000802f43 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f43:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f46:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f4b:	48 85 f6             	test   %rsi,%rsi
+  802f4e:	74 11                	je     802f61 <strnlen+0x1e>
+  802f50:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f54:	74 0c                	je     802f62 <strnlen+0x1f>
+  802f56:	48 83 c2 01          	add    $0x1,%rdx
+  802f5a:	48 39 d0             	cmp    %rdx,%rax
+  802f5d:	75 f1                	jne    802f50 <strnlen+0xd>
+  802f5f:	eb 04                	jmp    802f65 <strnlen+0x22>
+  802f61:	c3                   	ret
+  802f62:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f65:	c3                   	ret
+
+0000000000802f66 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f66:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f72:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f75:	48 83 c2 01          	add    $0x1,%rdx
+  802f79:	84 c9                	test   %cl,%cl
+  802f7b:	75 f1                	jne    802f6e <strcpy+0x8>
+        ;
+    return res;
+}
+  802f7d:	c3                   	ret
+
+0000000000802f7e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f7e:	55                   	push   %rbp
+  802f7f:	48 89 e5             	mov    %rsp,%rbp
+  802f82:	41 54                	push   %r12
+  802f84:	53                   	push   %rbx
+  802f85:	48 89 fb             	mov    %rdi,%rbx
+  802f88:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f8b:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  802f92:	00 00 00 
+  802f95:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802f97:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802f9b:	4c 89 e6             	mov    %r12,%rsi
+  802f9e:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+    return dst;
+}
+  802faa:	48 89 d8             	mov    %rbx,%rax
+  802fad:	5b                   	pop    %rbx
+  802fae:	41 5c                	pop    %r12
+  802fb0:	5d                   	pop    %rbp
+  802fb1:	c3                   	ret
+
+0000000000802fb2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fb2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fb5:	48 85 d2             	test   %rdx,%rdx
+  802fb8:	74 1f                	je     802fd9 <strncpy+0x27>
+  802fba:	48 01 fa             	add    %rdi,%rdx
+  802fbd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fc0:	48 83 c1 01          	add    $0x1,%rcx
+  802fc4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fc8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fcc:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fd0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fd4:	48 39 ca             	cmp    %rcx,%rdx
+  802fd7:	75 e7                	jne    802fc0 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fd9:	c3                   	ret
+
+0000000000802fda <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fda:	48 89 f8             	mov    %rdi,%rax
+  802fdd:	48 85 d2             	test   %rdx,%rdx
+  802fe0:	74 24                	je     803006 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fe2:	48 83 ea 01          	sub    $0x1,%rdx
+  802fe6:	74 1b                	je     803003 <strlcpy+0x29>
+  802fe8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fec:	0f b6 16             	movzbl (%rsi),%edx
+  802fef:	84 d2                	test   %dl,%dl
+  802ff1:	74 10                	je     803003 <strlcpy+0x29>
+            *dst++ = *src++;
+  802ff3:	48 83 c6 01          	add    $0x1,%rsi
+  802ff7:	48 83 c0 01          	add    $0x1,%rax
+  802ffb:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802ffe:	48 39 c8             	cmp    %rcx,%rax
+  803001:	75 e9                	jne    802fec <strlcpy+0x12>
+        *dst = '\0';
+  803003:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803006:	48 29 f8             	sub    %rdi,%rax
+}
+  803009:	c3                   	ret
+
+000000000080300a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80300a:	0f b6 07             	movzbl (%rdi),%eax
+  80300d:	84 c0                	test   %al,%al
+  80300f:	74 13                	je     803024 <strcmp+0x1a>
+  803011:	38 06                	cmp    %al,(%rsi)
+  803013:	75 0f                	jne    803024 <strcmp+0x1a>
+  803015:	48 83 c7 01          	add    $0x1,%rdi
+  803019:	48 83 c6 01          	add    $0x1,%rsi
+  80301d:	0f b6 07             	movzbl (%rdi),%eax
+  803020:	84 c0                	test   %al,%al
+  803022:	75 ed                	jne    803011 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803024:	0f b6 c0             	movzbl %al,%eax
+  803027:	0f b6 16             	movzbl (%rsi),%edx
+  80302a:	29 d0                	sub    %edx,%eax
+}
+  80302c:	c3                   	ret
+
+000000000080302d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80302d:	48 85 d2             	test   %rdx,%rdx
+  803030:	74 1f                	je     803051 <strncmp+0x24>
+  803032:	0f b6 07             	movzbl (%rdi),%eax
+  803035:	84 c0                	test   %al,%al
+  803037:	74 1e                	je     803057 <strncmp+0x2a>
+  803039:	3a 06                	cmp    (%rsi),%al
+  80303b:	75 1a                	jne    803057 <strncmp+0x2a>
+  80303d:	48 83 c7 01          	add    $0x1,%rdi
+  803041:	48 83 c6 01          	add    $0x1,%rsi
+  803045:	48 83 ea 01          	sub    $0x1,%rdx
+  803049:	75 e7                	jne    803032 <strncmp+0x5>
+
+    if (!n) return 0;
+  80304b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803050:	c3                   	ret
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+  803056:	c3                   	ret
+  803057:	48 85 d2             	test   %rdx,%rdx
+  80305a:	74 09                	je     803065 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80305c:	0f b6 07             	movzbl (%rdi),%eax
+  80305f:	0f b6 16             	movzbl (%rsi),%edx
+  803062:	29 d0                	sub    %edx,%eax
+  803064:	c3                   	ret
+    if (!n) return 0;
+  803065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80306a:	c3                   	ret
+
+000000000080306b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80306b:	0f b6 17             	movzbl (%rdi),%edx
+  80306e:	84 d2                	test   %dl,%dl
+  803070:	74 18                	je     80308a <strchr+0x1f>
+        if (*str == c) {
+  803072:	0f be d2             	movsbl %dl,%edx
+  803075:	39 f2                	cmp    %esi,%edx
+  803077:	74 17                	je     803090 <strchr+0x25>
+    for (; *str; str++) {
+  803079:	48 83 c7 01          	add    $0x1,%rdi
+  80307d:	0f b6 17             	movzbl (%rdi),%edx
+  803080:	84 d2                	test   %dl,%dl
+  803082:	75 ee                	jne    803072 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803084:	b8 00 00 00 00       	mov    $0x0,%eax
+  803089:	c3                   	ret
+  80308a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308f:	c3                   	ret
+  803090:	48 89 f8             	mov    %rdi,%rax
+}
+  803093:	c3                   	ret
+
+0000000000803094 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803094:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803097:	0f b6 17             	movzbl (%rdi),%edx
+  80309a:	84 d2                	test   %dl,%dl
+  80309c:	74 13                	je     8030b1 <strfind+0x1d>
+  80309e:	0f be d2             	movsbl %dl,%edx
+  8030a1:	39 f2                	cmp    %esi,%edx
+  8030a3:	74 0b                	je     8030b0 <strfind+0x1c>
+  8030a5:	48 83 c0 01          	add    $0x1,%rax
+  8030a9:	0f b6 10             	movzbl (%rax),%edx
+  8030ac:	84 d2                	test   %dl,%dl
+  8030ae:	75 ee                	jne    80309e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030b0:	c3                   	ret
+  8030b1:	c3                   	ret
+
+00000000008030b2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030b2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030b5:	48 89 f8             	mov    %rdi,%rax
+  8030b8:	48 f7 d8             	neg    %rax
+  8030bb:	83 e0 07             	and    $0x7,%eax
+  8030be:	49 89 d1             	mov    %rdx,%r9
+  8030c1:	49 29 c1             	sub    %rax,%r9
+  8030c4:	78 36                	js     8030fc <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030c6:	40 0f b6 c6          	movzbl %sil,%eax
+  8030ca:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030d1:	01 01 01 
+  8030d4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030d8:	40 f6 c7 07          	test   $0x7,%dil
+  8030dc:	75 38                	jne    803116 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030de:	4c 89 c9             	mov    %r9,%rcx
+  8030e1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030e5:	74 0c                	je     8030f3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030e7:	fc                   	cld
+  8030e8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030eb:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030ef:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030f3:	4d 85 c9             	test   %r9,%r9
+  8030f6:	75 45                	jne    80313d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8030f8:	4c 89 c0             	mov    %r8,%rax
+  8030fb:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8030fc:	48 85 d2             	test   %rdx,%rdx
+  8030ff:	74 f7                	je     8030f8 <memset+0x46>
+  803101:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803104:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803107:	48 83 c0 01          	add    $0x1,%rax
+  80310b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80310f:	48 39 c2             	cmp    %rax,%rdx
+  803112:	75 f3                	jne    803107 <memset+0x55>
+  803114:	eb e2                	jmp    8030f8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803116:	40 f6 c7 01          	test   $0x1,%dil
+  80311a:	74 06                	je     803122 <memset+0x70>
+  80311c:	88 07                	mov    %al,(%rdi)
+  80311e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803122:	40 f6 c7 02          	test   $0x2,%dil
+  803126:	74 07                	je     80312f <memset+0x7d>
+  803128:	66 89 07             	mov    %ax,(%rdi)
+  80312b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80312f:	40 f6 c7 04          	test   $0x4,%dil
+  803133:	74 a9                	je     8030de <memset+0x2c>
+  803135:	89 07                	mov    %eax,(%rdi)
+  803137:	48 83 c7 04          	add    $0x4,%rdi
+  80313b:	eb a1                	jmp    8030de <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80313d:	41 f6 c1 04          	test   $0x4,%r9b
+  803141:	74 06                	je     803149 <memset+0x97>
+  803143:	89 07                	mov    %eax,(%rdi)
+  803145:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803149:	41 f6 c1 02          	test   $0x2,%r9b
+  80314d:	74 07                	je     803156 <memset+0xa4>
+  80314f:	66 89 07             	mov    %ax,(%rdi)
+  803152:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803156:	41 f6 c1 01          	test   $0x1,%r9b
+  80315a:	74 9c                	je     8030f8 <memset+0x46>
+  80315c:	88 07                	mov    %al,(%rdi)
+  80315e:	eb 98                	jmp    8030f8 <memset+0x46>
+
+0000000000803160 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803160:	48 89 f8             	mov    %rdi,%rax
+  803163:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803166:	48 39 fe             	cmp    %rdi,%rsi
+  803169:	73 3b                	jae    8031a6 <memmove+0x46>
+  80316b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80316f:	48 39 d7             	cmp    %rdx,%rdi
+  803172:	73 32                	jae    8031a6 <memmove+0x46>
+        s += n;
+        d += n;
+  803174:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803178:	48 89 d6             	mov    %rdx,%rsi
+  80317b:	48 09 fe             	or     %rdi,%rsi
+  80317e:	48 09 ce             	or     %rcx,%rsi
+  803181:	40 f6 c6 07          	test   $0x7,%sil
+  803185:	75 12                	jne    803199 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803187:	48 83 ef 08          	sub    $0x8,%rdi
+  80318b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80318f:	48 c1 e9 03          	shr    $0x3,%rcx
+  803193:	fd                   	std
+  803194:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803197:	fc                   	cld
+  803198:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803199:	48 83 ef 01          	sub    $0x1,%rdi
+  80319d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031a1:	fd                   	std
+  8031a2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031a4:	eb f1                	jmp    803197 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031a6:	48 89 f2             	mov    %rsi,%rdx
+  8031a9:	48 09 c2             	or     %rax,%rdx
+  8031ac:	48 09 ca             	or     %rcx,%rdx
+  8031af:	f6 c2 07             	test   $0x7,%dl
+  8031b2:	75 0c                	jne    8031c0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031b4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031b8:	48 89 c7             	mov    %rax,%rdi
+  8031bb:	fc                   	cld
+  8031bc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031bf:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031c0:	48 89 c7             	mov    %rax,%rdi
+  8031c3:	fc                   	cld
+  8031c4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031c6:	c3                   	ret
+
+00000000008031c7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031c7:	55                   	push   %rbp
+  8031c8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031cb:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  8031d2:	00 00 00 
+  8031d5:	ff d0                	call   *%rax
+}
+  8031d7:	5d                   	pop    %rbp
+  8031d8:	c3                   	ret
+
+00000000008031d9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031d9:	55                   	push   %rbp
+  8031da:	48 89 e5             	mov    %rsp,%rbp
+  8031dd:	41 57                	push   %r15
+  8031df:	41 56                	push   %r14
+  8031e1:	41 55                	push   %r13
+  8031e3:	41 54                	push   %r12
+  8031e5:	53                   	push   %rbx
+  8031e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ea:	49 89 fe             	mov    %rdi,%r14
+  8031ed:	49 89 f7             	mov    %rsi,%r15
+  8031f0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031f3:	48 89 f7             	mov    %rsi,%rdi
+  8031f6:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+  803202:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803205:	48 89 de             	mov    %rbx,%rsi
+  803208:	4c 89 f7             	mov    %r14,%rdi
+  80320b:	48 b8 43 2f 80 00 00 	movabs $0x802f43,%rax
+  803212:	00 00 00 
+  803215:	ff d0                	call   *%rax
+  803217:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80321a:	48 39 c3             	cmp    %rax,%rbx
+  80321d:	74 36                	je     803255 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80321f:	48 89 d8             	mov    %rbx,%rax
+  803222:	4c 29 e8             	sub    %r13,%rax
+  803225:	49 39 c4             	cmp    %rax,%r12
+  803228:	73 31                	jae    80325b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80322a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80322f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803233:	4c 89 fe             	mov    %r15,%rsi
+  803236:	48 b8 c7 31 80 00 00 	movabs $0x8031c7,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803242:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803246:	48 83 c4 08          	add    $0x8,%rsp
+  80324a:	5b                   	pop    %rbx
+  80324b:	41 5c                	pop    %r12
+  80324d:	41 5d                	pop    %r13
+  80324f:	41 5e                	pop    %r14
+  803251:	41 5f                	pop    %r15
+  803253:	5d                   	pop    %rbp
+  803254:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803255:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803259:	eb eb                	jmp    803246 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80325b:	48 83 eb 01          	sub    $0x1,%rbx
+  80325f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803263:	48 89 da             	mov    %rbx,%rdx
+  803266:	4c 89 fe             	mov    %r15,%rsi
+  803269:	48 b8 c7 31 80 00 00 	movabs $0x8031c7,%rax
+  803270:	00 00 00 
+  803273:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803275:	49 01 de             	add    %rbx,%r14
+  803278:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80327d:	eb c3                	jmp    803242 <strlcat+0x69>
+
+000000000080327f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80327f:	48 85 d2             	test   %rdx,%rdx
+  803282:	74 2d                	je     8032b1 <memcmp+0x32>
+  803284:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803289:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80328d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803292:	44 38 c1             	cmp    %r8b,%cl
+  803295:	75 0f                	jne    8032a6 <memcmp+0x27>
+    while (n-- > 0) {
+  803297:	48 83 c0 01          	add    $0x1,%rax
+  80329b:	48 39 c2             	cmp    %rax,%rdx
+  80329e:	75 e9                	jne    803289 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032a6:	0f b6 c1             	movzbl %cl,%eax
+  8032a9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032ad:	44 29 c0             	sub    %r8d,%eax
+  8032b0:	c3                   	ret
+    return 0;
+  8032b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b6:	c3                   	ret
+
+00000000008032b7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032b7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032bb:	48 39 c7             	cmp    %rax,%rdi
+  8032be:	73 0f                	jae    8032cf <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032c0:	40 38 37             	cmp    %sil,(%rdi)
+  8032c3:	74 0e                	je     8032d3 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032c5:	48 83 c7 01          	add    $0x1,%rdi
+  8032c9:	48 39 f8             	cmp    %rdi,%rax
+  8032cc:	75 f2                	jne    8032c0 <memfind+0x9>
+  8032ce:	c3                   	ret
+  8032cf:	48 89 f8             	mov    %rdi,%rax
+  8032d2:	c3                   	ret
+  8032d3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032d6:	c3                   	ret
+
+00000000008032d7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032d7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032da:	0f b6 37             	movzbl (%rdi),%esi
+  8032dd:	40 80 fe 20          	cmp    $0x20,%sil
+  8032e1:	74 06                	je     8032e9 <strtol+0x12>
+  8032e3:	40 80 fe 09          	cmp    $0x9,%sil
+  8032e7:	75 13                	jne    8032fc <strtol+0x25>
+  8032e9:	48 83 c7 01          	add    $0x1,%rdi
+  8032ed:	0f b6 37             	movzbl (%rdi),%esi
+  8032f0:	40 80 fe 20          	cmp    $0x20,%sil
+  8032f4:	74 f3                	je     8032e9 <strtol+0x12>
+  8032f6:	40 80 fe 09          	cmp    $0x9,%sil
+  8032fa:	74 ed                	je     8032e9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8032fc:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8032ff:	83 e0 fd             	and    $0xfffffffd,%eax
+  803302:	3c 01                	cmp    $0x1,%al
+  803304:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803308:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80330e:	75 0f                	jne    80331f <strtol+0x48>
+  803310:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803313:	74 14                	je     803329 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803315:	85 d2                	test   %edx,%edx
+  803317:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80331c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80331f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803324:	4c 63 ca             	movslq %edx,%r9
+  803327:	eb 36                	jmp    80335f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803329:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80332d:	74 0f                	je     80333e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80332f:	85 d2                	test   %edx,%edx
+  803331:	75 ec                	jne    80331f <strtol+0x48>
+        s++;
+  803333:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803337:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80333c:	eb e1                	jmp    80331f <strtol+0x48>
+        s += 2;
+  80333e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803342:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803347:	eb d6                	jmp    80331f <strtol+0x48>
+            dig -= '0';
+  803349:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80334c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803350:	41 39 d0             	cmp    %edx,%r8d
+  803353:	7d 21                	jge    803376 <strtol+0x9f>
+        val = val * base + dig;
+  803355:	49 0f af c1          	imul   %r9,%rax
+  803359:	0f b6 c9             	movzbl %cl,%ecx
+  80335c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80335f:	48 83 c7 01          	add    $0x1,%rdi
+  803363:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803367:	80 f9 39             	cmp    $0x39,%cl
+  80336a:	76 dd                	jbe    803349 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80336c:	80 f9 7b             	cmp    $0x7b,%cl
+  80336f:	77 05                	ja     803376 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803371:	83 e9 57             	sub    $0x57,%ecx
+  803374:	eb d6                	jmp    80334c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803376:	4d 85 d2             	test   %r10,%r10
+  803379:	74 03                	je     80337e <strtol+0xa7>
+  80337b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80337e:	48 89 c2             	mov    %rax,%rdx
+  803381:	48 f7 da             	neg    %rdx
+  803384:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803388:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80338c:	c3                   	ret
+
+000000000080338d <strrev>:
+
+void
+strrev(char *str)
+{
+  80338d:	55                   	push   %rbp
+  80338e:	48 89 e5             	mov    %rsp,%rbp
+  803391:	53                   	push   %rbx
+  803392:	48 83 ec 08          	sub    $0x8,%rsp
+  803396:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  803399:	48 b8 28 2f 80 00 00 	movabs $0x802f28,%rax
+  8033a0:	00 00 00 
+  8033a3:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033a5:	83 e8 01             	sub    $0x1,%eax
+  8033a8:	85 c0                	test   %eax,%eax
+  8033aa:	7e 22                	jle    8033ce <strrev+0x41>
+  8033ac:	48 98                	cltq
+  8033ae:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033b3:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033b7:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033bb:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033bf:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033c2:	48 83 c2 01          	add    $0x1,%rdx
+  8033c6:	48 83 e8 01          	sub    $0x1,%rax
+  8033ca:	39 c2                	cmp    %eax,%edx
+  8033cc:	7c e5                	jl     8033b3 <strrev+0x26>
+	}
+}
+  8033ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+
+00000000008033d4 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033d4:	85 d2                	test   %edx,%edx
+  8033d6:	0f 84 80 00 00 00    	je     80345c <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033dc:	55                   	push   %rbp
+  8033dd:	48 89 e5             	mov    %rsp,%rbp
+  8033e0:	53                   	push   %rbx
+  8033e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033e5:	49 89 f2             	mov    %rsi,%r10
+  8033e8:	41 89 d3             	mov    %edx,%r11d
+  8033eb:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033ee:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033f3:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8033f6:	eb 20                	jmp    803418 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8033f8:	41 89 f1             	mov    %esi,%r9d
+  8033fb:	83 c2 30             	add    $0x30,%edx
+  8033fe:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  803401:	89 f8                	mov    %edi,%eax
+  803403:	99                   	cltd
+  803404:	f7 f9                	idiv   %ecx
+  803406:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	74 2e                	je     80343a <itoa+0x66>
+  80340c:	83 c6 01             	add    $0x1,%esi
+  80340f:	49 83 c0 01          	add    $0x1,%r8
+  803413:	44 39 cb             	cmp    %r9d,%ebx
+  803416:	7e 15                	jle    80342d <itoa+0x59>
+		digit = sum % base;
+  803418:	89 f8                	mov    %edi,%eax
+  80341a:	99                   	cltd
+  80341b:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80341d:	83 fa 09             	cmp    $0x9,%edx
+  803420:	7e d6                	jle    8033f8 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803422:	41 89 f1             	mov    %esi,%r9d
+  803425:	83 c2 37             	add    $0x37,%edx
+  803428:	41 88 10             	mov    %dl,(%r8)
+  80342b:	eb d4                	jmp    803401 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80342d:	41 83 eb 01          	sub    $0x1,%r11d
+  803431:	45 39 cb             	cmp    %r9d,%r11d
+  803434:	75 04                	jne    80343a <itoa+0x66>
+  803436:	85 c0                	test   %eax,%eax
+  803438:	75 28                	jne    803462 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80343a:	4d 63 c9             	movslq %r9d,%r9
+  80343d:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803442:	4c 89 d7             	mov    %r10,%rdi
+  803445:	48 b8 8d 33 80 00 00 	movabs $0x80338d,%rax
+  80344c:	00 00 00 
+  80344f:	ff d0                	call   *%rax
+	return 0;
+  803451:	b8 00 00 00 00       	mov    $0x0,%eax
+  803456:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+		return -1;
+  80345c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803461:	c3                   	ret
+		return -1;
+  803462:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803467:	eb ed                	jmp    803456 <itoa+0x82>
+
+0000000000803469 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803469:	55                   	push   %rbp
+  80346a:	48 89 e5             	mov    %rsp,%rbp
+  80346d:	41 55                	push   %r13
+  80346f:	41 54                	push   %r12
+  803471:	53                   	push   %rbx
+  803472:	48 83 ec 08          	sub    $0x8,%rsp
+  803476:	49 89 fc             	mov    %rdi,%r12
+  803479:	48 89 f7             	mov    %rsi,%rdi
+  80347c:	48 89 d3             	mov    %rdx,%rbx
+  80347f:	49 89 cd             	mov    %rcx,%r13
+  803482:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803485:	48 85 f6             	test   %rsi,%rsi
+  803488:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80348f:	00 00 00 
+  803492:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803496:	be 00 10 00 00       	mov    $0x1000,%esi
+  80349b:	48 85 db             	test   %rbx,%rbx
+  80349e:	74 03                	je     8034a3 <ipc_recv_timed+0x3a>
+  8034a0:	48 8b 33             	mov    (%rbx),%rsi
+  8034a3:	48 b8 2a 05 80 00 00 	movabs $0x80052a,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	78 75                	js     803528 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034b3:	4d 85 e4             	test   %r12,%r12
+  8034b6:	74 14                	je     8034cc <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034b8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034bf:	00 00 00 
+  8034c2:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034c8:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034cc:	4d 85 ed             	test   %r13,%r13
+  8034cf:	74 14                	je     8034e5 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034d1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d8:	00 00 00 
+  8034db:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034e1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034e5:	48 85 db             	test   %rbx,%rbx
+  8034e8:	74 23                	je     80350d <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034ea:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034f1:	00 00 00 
+  8034f4:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8034fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ff:	85 c9                	test   %ecx,%ecx
+  803501:	74 07                	je     80350a <ipc_recv_timed+0xa1>
+  803503:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80350a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80350d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803514:	00 00 00 
+  803517:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80351d:	48 83 c4 08          	add    $0x8,%rsp
+  803521:	5b                   	pop    %rbx
+  803522:	41 5c                	pop    %r12
+  803524:	41 5d                	pop    %r13
+  803526:	5d                   	pop    %rbp
+  803527:	c3                   	ret
+        if (from_env_store != NULL) {
+  803528:	4d 85 e4             	test   %r12,%r12
+  80352b:	74 08                	je     803535 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80352d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803534:	00 
+        if (perm_store != NULL) {
+  803535:	4d 85 ed             	test   %r13,%r13
+  803538:	74 08                	je     803542 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80353a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803541:	00 
+        if (size != NULL) {
+  803542:	48 85 db             	test   %rbx,%rbx
+  803545:	74 d6                	je     80351d <ipc_recv_timed+0xb4>
+            *size = 0;
+  803547:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80354e:	eb cd                	jmp    80351d <ipc_recv_timed+0xb4>
+
+0000000000803550 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803550:	55                   	push   %rbp
+  803551:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803554:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80355a:	48 b8 69 34 80 00 00 	movabs $0x803469,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+}
+  803566:	5d                   	pop    %rbp
+  803567:	c3                   	ret
+
+0000000000803568 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 57                	push   %r15
+  80356e:	41 56                	push   %r14
+  803570:	41 55                	push   %r13
+  803572:	41 54                	push   %r12
+  803574:	53                   	push   %rbx
+  803575:	48 83 ec 18          	sub    $0x18,%rsp
+  803579:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80357c:	48 89 d3             	mov    %rdx,%rbx
+  80357f:	49 89 cc             	mov    %rcx,%r12
+  803582:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803585:	48 85 d2             	test   %rdx,%rdx
+  803588:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80358f:	00 00 00 
+  803592:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803596:	89 f0                	mov    %esi,%eax
+  803598:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80359c:	48 89 da             	mov    %rbx,%rdx
+  80359f:	48 89 c6             	mov    %rax,%rsi
+  8035a2:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  8035a9:	00 00 00 
+  8035ac:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035ae:	85 c0                	test   %eax,%eax
+  8035b0:	79 65                	jns    803617 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035b2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035b5:	75 33                	jne    8035ea <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035b7:	49 bf 01 02 80 00 00 	movabs $0x800201,%r15
+  8035be:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035c1:	49 be fe 04 80 00 00 	movabs $0x8004fe,%r14
+  8035c8:	00 00 00 
+        sys_yield();
+  8035cb:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035ce:	45 89 e8             	mov    %r13d,%r8d
+  8035d1:	4c 89 e1             	mov    %r12,%rcx
+  8035d4:	48 89 da             	mov    %rbx,%rdx
+  8035d7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035db:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035de:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	79 32                	jns    803617 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035e5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035e8:	74 e1                	je     8035cb <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035ea:	89 c1                	mov    %eax,%ecx
+  8035ec:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  8035f3:	00 00 00 
+  8035f6:	be 52 00 00 00       	mov    $0x52,%esi
+  8035fb:	48 bf 3b 3d 80 00 00 	movabs $0x803d3b,%rdi
+  803602:	00 00 00 
+  803605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360a:	49 b8 f1 24 80 00 00 	movabs $0x8024f1,%r8
+  803611:	00 00 00 
+  803614:	41 ff d0             	call   *%r8
+    }
+}
+  803617:	48 83 c4 18          	add    $0x18,%rsp
+  80361b:	5b                   	pop    %rbx
+  80361c:	41 5c                	pop    %r12
+  80361e:	41 5d                	pop    %r13
+  803620:	41 5e                	pop    %r14
+  803622:	41 5f                	pop    %r15
+  803624:	5d                   	pop    %rbp
+  803625:	c3                   	ret
+
+0000000000803626 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80362b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803632:	00 00 00 
+  803635:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803639:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80363d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803641:	48 01 ca             	add    %rcx,%rdx
+  803644:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80364a:	39 fa                	cmp    %edi,%edx
+  80364c:	74 12                	je     803660 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80364e:	48 83 c0 01          	add    $0x1,%rax
+  803652:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803658:	75 db                	jne    803635 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80365a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80365f:	c3                   	ret
+            return envs[i].env_id;
+  803660:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803664:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803668:	48 c1 e2 04          	shl    $0x4,%rdx
+  80366c:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803673:	00 00 00 
+  803676:	48 01 d0             	add    %rdx,%rax
+  803679:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80367f:	c3                   	ret
+
+0000000000803680 <__rodata_start>:
+  803680:	3c 75                	cmp    $0x75,%al
+  803682:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803683:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803687:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803688:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  80368c:	1f                   	(bad)
+  80368d:	44 00 00             	add    %r8b,(%rax)
+  803690:	73 79                	jae    80370b <__rodata_start+0x8b>
+  803692:	73 63                	jae    8036f7 <__rodata_start+0x77>
+  803694:	61                   	(bad)
+  803695:	6c                   	insb   (%dx),%es:(%rdi)
+  803696:	6c                   	insb   (%dx),%es:(%rdi)
+  803697:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b17 <__bss_end+0x72201b17>
+  80369d:	65 74 75             	gs je  803715 <__rodata_start+0x95>
+  8036a0:	72 6e                	jb     803710 <__rodata_start+0x90>
+  8036a2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b24 <__bss_end+0x28201b24>
+  8036a9:	28 
+  8036aa:	3e 20 30             	ds and %dh,(%rax)
+  8036ad:	29 00                	sub    %eax,(%rax)
+  8036af:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036b7:	61                   	(bad)
+  8036b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ba:	2e 63 00             	cs movsxd (%rax),%eax
+  8036bd:	0f 1f 00             	nopl   (%rax)
+  8036c0:	5b                   	pop    %rbx
+  8036c1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036c6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036c9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036cd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ce:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036d2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036d9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804144 <devpipe+0x84>
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036e6:	20 72 65             	and    %dh,0x65(%rdx)
+  8036e9:	61                   	(bad)
+  8036ea:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036ec:	61                   	(bad)
+  8036ed:	70 20                	jo     80370f <__rodata_start+0x8f>
+  8036ef:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8036f4:	20 62 61             	and    %ah,0x61(%rdx)
+  8036f7:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8036fb:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8036ff:	00 5b 25             	add    %bl,0x25(%rbx)
+  803702:	30 38                	xor    %bh,(%rax)
+  803704:	78 5d                	js     803763 <devtab+0x3>
+  803706:	20 66 74             	and    %ah,0x74(%rsi)
+  803709:	72 75                	jb     803780 <devtab+0x20>
+  80370b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80370f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad577a <__bss_end+0x2d2cd77a>
+  803716:	20 62 61             	and    %ah,0x61(%rdx)
+  803719:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80371d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803721:	5b                   	pop    %rbx
+  803722:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803727:	20 72 65             	and    %dh,0x65(%rdx)
+  80372a:	61                   	(bad)
+  80372b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad5796 <__bss_end+0x2d2cd796>
+  803732:	20 62 61             	and    %ah,0x61(%rdx)
+  803735:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803739:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80373d:	5b                   	pop    %rbx
+  80373e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803743:	20 77 72             	and    %dh,0x72(%rdi)
+  803746:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80374d:	2d 
+  80374e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803753:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803756:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80375a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803770:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8037e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8037f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8038e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8038f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803990:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039a0:	2e 28 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     .(......o.......
+  8039b0:	5f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     _.......o.......
+  8039c0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  8039d0:	6f 2e 80 00 00 00 00 00 4d 28 80 00 00 00 00 00     o.......M(......
+  8039e0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  8039f0:	41 28 80 00 00 00 00 00 bb 28 80 00 00 00 00 00     A(.......(......
+  803a00:	6f 2e 80 00 00 00 00 00 41 28 80 00 00 00 00 00     o.......A(......
+  803a10:	87 28 80 00 00 00 00 00 87 28 80 00 00 00 00 00     .(.......(......
+  803a20:	87 28 80 00 00 00 00 00 87 28 80 00 00 00 00 00     .(.......(......
+  803a30:	87 28 80 00 00 00 00 00 87 28 80 00 00 00 00 00     .(.......(......
+  803a40:	87 28 80 00 00 00 00 00 87 28 80 00 00 00 00 00     .(.......(......
+  803a50:	87 28 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     .(......o.......
+  803a60:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803a70:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803a80:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803a90:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803aa0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803ab0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803ac0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803ad0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803ae0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803af0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b00:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b10:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b20:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b30:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b40:	6f 2e 80 00 00 00 00 00 92 2d 80 00 00 00 00 00     o........-......
+  803b50:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b60:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b70:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b80:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803b90:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803ba0:	de 28 80 00 00 00 00 00 ad 2a 80 00 00 00 00 00     .(.......*......
+  803bb0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803bc0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803bd0:	0d 29 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     .)......o.......
+  803be0:	6f 2e 80 00 00 00 00 00 d3 28 80 00 00 00 00 00     o........(......
+  803bf0:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803c00:	55 2c 80 00 00 00 00 00 1f 2d 80 00 00 00 00 00     U,.......-......
+  803c10:	6f 2e 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     o.......o.......
+  803c20:	a4 29 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     .)......o.......
+  803c30:	81 2b 80 00 00 00 00 00 6f 2e 80 00 00 00 00 00     .+......o.......
+  803c40:	6f 2e 80 00 00 00 00 00 92 2d 80 00 00 00 00 00     o........-......
+  803c50:	6f 2e 80 00 00 00 00 00 37 28 80 00 00 00 00 00     o.......7(......
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	35 38 80 00 00 00 00 00 47 38 80 00 00 00 00 00     58......G8......
+  803c78:	57 38 80 00 00 00 00 00 69 38 80 00 00 00 00 00     W8......i8......
+  803c88:	77 38 80 00 00 00 00 00 8b 38 80 00 00 00 00 00     w8.......8......
+  803c98:	a0 38 80 00 00 00 00 00 b3 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	c5 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	e9 38 80 00 00 00 00 00 fc 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	13 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803cd8:	41 39 80 00 00 00 00 00 59 39 80 00 00 00 00 00     A9......Y9......
+  803ce8:	66 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     f9.......=......
+  803cf8:	7a 39 80 00 00 00 00 00 92 39 80 00 00 00 00 00     z9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d28:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d38:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,7044 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 91 11 80 00 00 	movabs $0x801191,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf 80 38 80 00 00 	movabs $0x803880,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba 91 38 80 00 00 	movabs $0x803891,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 4a 0b 80 00 00 	movabs $0x800b4a,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 21 16 80 00 00 	movabs $0x801621,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 d0 01 80 00 00 	movabs $0x8001d0,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf 90 38 80 00 00 	movabs $0x803890,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	41 89 fd             	mov    %edi,%r13d
+  800130:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800163:	48 b8 91 11 80 00 00 	movabs $0x801191,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+  80016f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800174:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800178:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80017c:	48 c1 e0 04          	shl    $0x4,%rax
+  800180:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800187:	00 00 00 
+  80018a:	48 01 d0             	add    %rdx,%rax
+  80018d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800194:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800197:	45 85 ed             	test   %r13d,%r13d
+  80019a:	7e 0d                	jle    8001a9 <libmain+0x87>
+  80019c:	49 8b 06             	mov    (%r14),%rax
+  80019f:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001a6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001a9:	4c 89 f6             	mov    %r14,%rsi
+  8001ac:	44 89 ef             	mov    %r13d,%edi
+  8001af:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001bb:	48 b8 d0 01 80 00 00 	movabs $0x8001d0,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+#endif
+}
+  8001c7:	5b                   	pop    %rbx
+  8001c8:	41 5c                	pop    %r12
+  8001ca:	41 5d                	pop    %r13
+  8001cc:	41 5e                	pop    %r14
+  8001ce:	5d                   	pop    %rbp
+  8001cf:	c3                   	ret
+
+00000000008001d0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001d4:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e5:	48 b8 26 11 80 00 00 	movabs $0x801126,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+}
+  8001f1:	5d                   	pop    %rbp
+  8001f2:	c3                   	ret
+
+00000000008001f3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001f3:	55                   	push   %rbp
+  8001f4:	48 89 e5             	mov    %rsp,%rbp
+  8001f7:	53                   	push   %rbx
+  8001f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8001fc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001ff:	8b 06                	mov    (%rsi),%eax
+  800201:	8d 50 01             	lea    0x1(%rax),%edx
+  800204:	89 16                	mov    %edx,(%rsi)
+  800206:	48 98                	cltq
+  800208:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80020d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800213:	74 0a                	je     80021f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800215:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80021f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800223:	be ff 00 00 00       	mov    $0xff,%esi
+  800228:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  80022f:	00 00 00 
+  800232:	ff d0                	call   *%rax
+        state->offset = 0;
+  800234:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80023a:	eb d9                	jmp    800215 <putch+0x22>
+
+000000000080023c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800247:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80024a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800251:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80025e:	48 89 f1             	mov    %rsi,%rcx
+  800261:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800268:	48 bf f3 01 80 00 00 	movabs $0x8001f3,%rdi
+  80026f:	00 00 00 
+  800272:	48 b8 f0 03 80 00 00 	movabs $0x8003f0,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80027e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800285:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80028c:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  800293:	00 00 00 
+  800296:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800298:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80029e:	c9                   	leave
+  80029f:	c3                   	ret
+
+00000000008002a0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002a0:	55                   	push   %rbp
+  8002a1:	48 89 e5             	mov    %rsp,%rbp
+  8002a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002ac:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002bc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002d3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002d7:	48 b8 3c 02 80 00 00 	movabs $0x80023c,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002e3:	c9                   	leave
+  8002e4:	c3                   	ret
+
+00000000008002e5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+  8002e9:	41 57                	push   %r15
+  8002eb:	41 56                	push   %r14
+  8002ed:	41 55                	push   %r13
+  8002ef:	41 54                	push   %r12
+  8002f1:	53                   	push   %rbx
+  8002f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8002f6:	49 89 fc             	mov    %rdi,%r12
+  8002f9:	49 89 f5             	mov    %rsi,%r13
+  8002fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800300:	8b 45 10             	mov    0x10(%rbp),%eax
+  800303:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800306:	41 89 cf             	mov    %ecx,%r15d
+  800309:	4c 39 fa             	cmp    %r15,%rdx
+  80030c:	73 5b                	jae    800369 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80030e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800312:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800316:	85 db                	test   %ebx,%ebx
+  800318:	7e 0e                	jle    800328 <print_num+0x43>
+            putch(padc, put_arg);
+  80031a:	4c 89 ee             	mov    %r13,%rsi
+  80031d:	44 89 f7             	mov    %r14d,%edi
+  800320:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800323:	83 eb 01             	sub    $0x1,%ebx
+  800326:	75 f2                	jne    80031a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800328:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80032c:	48 b9 b1 38 80 00 00 	movabs $0x8038b1,%rcx
+  800333:	00 00 00 
+  800336:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  80033d:	00 00 00 
+  800340:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800344:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034d:	49 f7 f7             	div    %r15
+  800350:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800354:	4c 89 ee             	mov    %r13,%rsi
+  800357:	41 ff d4             	call   *%r12
+}
+  80035a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80035e:	5b                   	pop    %rbx
+  80035f:	41 5c                	pop    %r12
+  800361:	41 5d                	pop    %r13
+  800363:	41 5e                	pop    %r14
+  800365:	41 5f                	pop    %r15
+  800367:	5d                   	pop    %rbp
+  800368:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800369:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800372:	49 f7 f7             	div    %r15
+  800375:	48 83 ec 08          	sub    $0x8,%rsp
+  800379:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80037d:	52                   	push   %rdx
+  80037e:	45 0f be c9          	movsbl %r9b,%r9d
+  800382:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800386:	48 89 c2             	mov    %rax,%rdx
+  800389:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+  800395:	48 83 c4 10          	add    $0x10,%rsp
+  800399:	eb 8d                	jmp    800328 <print_num+0x43>
+
+000000000080039b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80039b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80039f:	48 8b 06             	mov    (%rsi),%rax
+  8003a2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003a6:	73 0a                	jae    8003b2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003ac:	48 89 16             	mov    %rdx,(%rsi)
+  8003af:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003b2:	c3                   	ret
+
+00000000008003b3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003b3:	55                   	push   %rbp
+  8003b4:	48 89 e5             	mov    %rsp,%rbp
+  8003b7:	48 83 ec 50          	sub    $0x50,%rsp
+  8003bb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003bf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003c3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003c7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003de:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003e2:	48 b8 f0 03 80 00 00 	movabs $0x8003f0,%rax
+  8003e9:	00 00 00 
+  8003ec:	ff d0                	call   *%rax
+}
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+
+00000000008003f0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003f0:	55                   	push   %rbp
+  8003f1:	48 89 e5             	mov    %rsp,%rbp
+  8003f4:	41 57                	push   %r15
+  8003f6:	41 56                	push   %r14
+  8003f8:	41 55                	push   %r13
+  8003fa:	41 54                	push   %r12
+  8003fc:	53                   	push   %rbx
+  8003fd:	48 83 ec 38          	sub    $0x38,%rsp
+  800401:	49 89 fe             	mov    %rdi,%r14
+  800404:	49 89 f5             	mov    %rsi,%r13
+  800407:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80040a:	48 8b 01             	mov    (%rcx),%rax
+  80040d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800411:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800415:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800419:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80041d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800421:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800425:	0f b6 3b             	movzbl (%rbx),%edi
+  800428:	40 80 ff 25          	cmp    $0x25,%dil
+  80042c:	74 18                	je     800446 <vprintfmt+0x56>
+            if (!ch) return;
+  80042e:	40 84 ff             	test   %dil,%dil
+  800431:	0f 84 b1 06 00 00    	je     800ae8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800437:	40 0f b6 ff          	movzbl %dil,%edi
+  80043b:	4c 89 ee             	mov    %r13,%rsi
+  80043e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800441:	4c 89 e3             	mov    %r12,%rbx
+  800444:	eb db                	jmp    800421 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800446:	be 00 00 00 00       	mov    $0x0,%esi
+  80044b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80044f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800454:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80045a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800461:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800465:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80046a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80046f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800472:	83 e8 23             	sub    $0x23,%eax
+  800475:	3c 57                	cmp    $0x57,%al
+  800477:	0f 87 51 06 00 00    	ja     800ace <vprintfmt+0x6de>
+  80047d:	0f b6 c0             	movzbl %al,%eax
+  800480:	48 b9 40 3a 80 00 00 	movabs $0x803a40,%rcx
+  800487:	00 00 00 
+  80048a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80048d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800490:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800494:	eb cf                	jmp    800465 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800496:	49 89 dc             	mov    %rbx,%r12
+  800499:	be 01 00 00 00       	mov    $0x1,%esi
+  80049e:	eb c5                	jmp    800465 <vprintfmt+0x75>
+            padc = ch;
+  8004a0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004a4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004aa:	eb b9                	jmp    800465 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004af:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b2:	77 24                	ja     8004d8 <vprintfmt+0xe8>
+  8004b4:	89 c1                	mov    %eax,%ecx
+  8004b6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004ba:	83 c0 08             	add    $0x8,%eax
+  8004bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004c3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004c6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ca:	79 99                	jns    800465 <vprintfmt+0x75>
+                width = precision;
+  8004cc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004d0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004d6:	eb 8d                	jmp    800465 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004dc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e4:	eb da                	jmp    8004c0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004e6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004eb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ef:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004f5:	3c 39                	cmp    $0x39,%al
+  8004f7:	77 1c                	ja     800515 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004f9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004fd:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800501:	0f b6 c0             	movzbl %al,%eax
+  800504:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800509:	0f b6 03             	movzbl (%rbx),%eax
+  80050c:	3c 39                	cmp    $0x39,%al
+  80050e:	76 e9                	jbe    8004f9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800510:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800513:	eb b1                	jmp    8004c6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800515:	49 89 dc             	mov    %rbx,%r12
+  800518:	eb ac                	jmp    8004c6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80051a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80051d:	85 c9                	test   %ecx,%ecx
+  80051f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800524:	0f 49 c1             	cmovns %ecx,%eax
+  800527:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80052a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80052d:	e9 33 ff ff ff       	jmp    800465 <vprintfmt+0x75>
+            lflag++;
+  800532:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800535:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800538:	e9 28 ff ff ff       	jmp    800465 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80053d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800540:	83 f8 2f             	cmp    $0x2f,%eax
+  800543:	77 19                	ja     80055e <vprintfmt+0x16e>
+  800545:	89 c2                	mov    %eax,%edx
+  800547:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054b:	83 c0 08             	add    $0x8,%eax
+  80054e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800551:	8b 3a                	mov    (%rdx),%edi
+  800553:	4c 89 ee             	mov    %r13,%rsi
+  800556:	41 ff d6             	call   *%r14
+            break;
+  800559:	e9 c3 fe ff ff       	jmp    800421 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80055e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800562:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800566:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056a:	eb e5                	jmp    800551 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80056c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80056f:	83 f8 2f             	cmp    $0x2f,%eax
+  800572:	77 5a                	ja     8005ce <vprintfmt+0x1de>
+  800574:	89 c2                	mov    %eax,%edx
+  800576:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057a:	83 c0 08             	add    $0x8,%eax
+  80057d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800580:	8b 02                	mov    (%rdx),%eax
+  800582:	89 c1                	mov    %eax,%ecx
+  800584:	f7 d9                	neg    %ecx
+  800586:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800589:	83 f9 14             	cmp    $0x14,%ecx
+  80058c:	7f 4e                	jg     8005dc <vprintfmt+0x1ec>
+  80058e:	48 63 c1             	movslq %ecx,%rax
+  800591:	48 ba 00 3d 80 00 00 	movabs $0x803d00,%rdx
+  800598:	00 00 00 
+  80059b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80059f:	48 85 c0             	test   %rax,%rax
+  8005a2:	74 38                	je     8005dc <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005a4:	48 89 c1             	mov    %rax,%rcx
+  8005a7:	48 ba f9 3e 80 00 00 	movabs $0x803ef9,%rdx
+  8005ae:	00 00 00 
+  8005b1:	4c 89 ee             	mov    %r13,%rsi
+  8005b4:	4c 89 f7             	mov    %r14,%rdi
+  8005b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bc:	49 b8 b3 03 80 00 00 	movabs $0x8003b3,%r8
+  8005c3:	00 00 00 
+  8005c6:	41 ff d0             	call   *%r8
+  8005c9:	e9 53 fe ff ff       	jmp    800421 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005da:	eb a4                	jmp    800580 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005dc:	48 ba c9 38 80 00 00 	movabs $0x8038c9,%rdx
+  8005e3:	00 00 00 
+  8005e6:	4c 89 ee             	mov    %r13,%rsi
+  8005e9:	4c 89 f7             	mov    %r14,%rdi
+  8005ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f1:	49 b8 b3 03 80 00 00 	movabs $0x8003b3,%r8
+  8005f8:	00 00 00 
+  8005fb:	41 ff d0             	call   *%r8
+  8005fe:	e9 1e fe ff ff       	jmp    800421 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800603:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800606:	83 f8 2f             	cmp    $0x2f,%eax
+  800609:	77 6c                	ja     800677 <vprintfmt+0x287>
+  80060b:	89 c2                	mov    %eax,%edx
+  80060d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800611:	83 c0 08             	add    $0x8,%eax
+  800614:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800617:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80061a:	48 85 d2             	test   %rdx,%rdx
+  80061d:	48 b8 c2 38 80 00 00 	movabs $0x8038c2,%rax
+  800624:	00 00 00 
+  800627:	48 0f 45 c2          	cmovne %rdx,%rax
+  80062b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80062f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800633:	7e 06                	jle    80063b <vprintfmt+0x24b>
+  800635:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800639:	75 4a                	jne    800685 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80063b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80063f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800643:	0f b6 00             	movzbl (%rax),%eax
+  800646:	84 c0                	test   %al,%al
+  800648:	0f 85 9a 00 00 00    	jne    8006e8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80064e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800651:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800655:	85 c0                	test   %eax,%eax
+  800657:	0f 8e c4 fd ff ff    	jle    800421 <vprintfmt+0x31>
+  80065d:	4c 89 ee             	mov    %r13,%rsi
+  800660:	bf 20 00 00 00       	mov    $0x20,%edi
+  800665:	41 ff d6             	call   *%r14
+  800668:	41 83 ec 01          	sub    $0x1,%r12d
+  80066c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800670:	75 eb                	jne    80065d <vprintfmt+0x26d>
+  800672:	e9 aa fd ff ff       	jmp    800421 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800677:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800683:	eb 92                	jmp    800617 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800685:	49 63 f7             	movslq %r15d,%rsi
+  800688:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80068c:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  800693:	00 00 00 
+  800696:	ff d0                	call   *%rax
+  800698:	48 89 c2             	mov    %rax,%rdx
+  80069b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80069e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006a0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006a3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006a6:	85 c0                	test   %eax,%eax
+  8006a8:	7e 91                	jle    80063b <vprintfmt+0x24b>
+  8006aa:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006af:	4c 89 ee             	mov    %r13,%rsi
+  8006b2:	44 89 e7             	mov    %r12d,%edi
+  8006b5:	41 ff d6             	call   *%r14
+  8006b8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006bc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006c2:	75 eb                	jne    8006af <vprintfmt+0x2bf>
+  8006c4:	e9 72 ff ff ff       	jmp    80063b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c9:	0f b6 f8             	movzbl %al,%edi
+  8006cc:	4c 89 ee             	mov    %r13,%rsi
+  8006cf:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006d2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006d6:	49 83 c4 01          	add    $0x1,%r12
+  8006da:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006e0:	84 c0                	test   %al,%al
+  8006e2:	0f 84 66 ff ff ff    	je     80064e <vprintfmt+0x25e>
+  8006e8:	45 85 ff             	test   %r15d,%r15d
+  8006eb:	78 0a                	js     8006f7 <vprintfmt+0x307>
+  8006ed:	41 83 ef 01          	sub    $0x1,%r15d
+  8006f1:	0f 88 57 ff ff ff    	js     80064e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006fb:	74 cc                	je     8006c9 <vprintfmt+0x2d9>
+  8006fd:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800700:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800705:	80 fa 5e             	cmp    $0x5e,%dl
+  800708:	77 c2                	ja     8006cc <vprintfmt+0x2dc>
+  80070a:	eb bd                	jmp    8006c9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80070c:	40 84 f6             	test   %sil,%sil
+  80070f:	75 26                	jne    800737 <vprintfmt+0x347>
+    switch (lflag) {
+  800711:	85 d2                	test   %edx,%edx
+  800713:	74 59                	je     80076e <vprintfmt+0x37e>
+  800715:	83 fa 01             	cmp    $0x1,%edx
+  800718:	74 7b                	je     800795 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80071a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071d:	83 f8 2f             	cmp    $0x2f,%eax
+  800720:	0f 87 96 00 00 00    	ja     8007bc <vprintfmt+0x3cc>
+  800726:	89 c2                	mov    %eax,%edx
+  800728:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072c:	83 c0 08             	add    $0x8,%eax
+  80072f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800732:	4c 8b 22             	mov    (%rdx),%r12
+  800735:	eb 17                	jmp    80074e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073a:	83 f8 2f             	cmp    $0x2f,%eax
+  80073d:	77 21                	ja     800760 <vprintfmt+0x370>
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800745:	83 c0 08             	add    $0x8,%eax
+  800748:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80074e:	4d 85 e4             	test   %r12,%r12
+  800751:	78 7a                	js     8007cd <vprintfmt+0x3dd>
+            num = i;
+  800753:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80075b:	e9 50 02 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800760:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800764:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800768:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076c:	eb dd                	jmp    80074b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80076e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800771:	83 f8 2f             	cmp    $0x2f,%eax
+  800774:	77 11                	ja     800787 <vprintfmt+0x397>
+  800776:	89 c2                	mov    %eax,%edx
+  800778:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077c:	83 c0 08             	add    $0x8,%eax
+  80077f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800782:	4c 63 22             	movslq (%rdx),%r12
+  800785:	eb c7                	jmp    80074e <vprintfmt+0x35e>
+  800787:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800793:	eb ed                	jmp    800782 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800795:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800798:	83 f8 2f             	cmp    $0x2f,%eax
+  80079b:	77 11                	ja     8007ae <vprintfmt+0x3be>
+  80079d:	89 c2                	mov    %eax,%edx
+  80079f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a3:	83 c0 08             	add    $0x8,%eax
+  8007a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a9:	4c 8b 22             	mov    (%rdx),%r12
+  8007ac:	eb a0                	jmp    80074e <vprintfmt+0x35e>
+  8007ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ba:	eb ed                	jmp    8007a9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c8:	e9 65 ff ff ff       	jmp    800732 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007cd:	4c 89 ee             	mov    %r13,%rsi
+  8007d0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007d5:	41 ff d6             	call   *%r14
+                i = -i;
+  8007d8:	49 f7 dc             	neg    %r12
+  8007db:	e9 73 ff ff ff       	jmp    800753 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e0:	40 84 f6             	test   %sil,%sil
+  8007e3:	75 32                	jne    800817 <vprintfmt+0x427>
+    switch (lflag) {
+  8007e5:	85 d2                	test   %edx,%edx
+  8007e7:	74 5d                	je     800846 <vprintfmt+0x456>
+  8007e9:	83 fa 01             	cmp    $0x1,%edx
+  8007ec:	0f 84 82 00 00 00    	je     800874 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	0f 87 a5 00 00 00    	ja     8008a3 <vprintfmt+0x4b3>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80080d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800812:	e9 99 01 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 19                	ja     800838 <vprintfmt+0x448>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80082e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800833:	e9 78 01 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+  800838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800844:	eb e5                	jmp    80082b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 18                	ja     800866 <vprintfmt+0x476>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80085c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800861:	e9 4a 01 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+  800866:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800872:	eb e6                	jmp    80085a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	77 19                	ja     800895 <vprintfmt+0x4a5>
+  80087c:	89 c2                	mov    %eax,%edx
+  80087e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800882:	83 c0 08             	add    $0x8,%eax
+  800885:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800888:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80088b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800890:	e9 1b 01 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	eb e5                	jmp    800888 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	e9 56 ff ff ff       	jmp    80080a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b4:	40 84 f6             	test   %sil,%sil
+  8008b7:	75 2e                	jne    8008e7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008b9:	85 d2                	test   %edx,%edx
+  8008bb:	74 59                	je     800916 <vprintfmt+0x526>
+  8008bd:	83 fa 01             	cmp    $0x1,%edx
+  8008c0:	74 7f                	je     800941 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c8:	0f 87 9f 00 00 00    	ja     80096d <vprintfmt+0x57d>
+  8008ce:	89 c2                	mov    %eax,%edx
+  8008d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d4:	83 c0 08             	add    $0x8,%eax
+  8008d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008da:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008dd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008e2:	e9 c9 00 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ed:	77 19                	ja     800908 <vprintfmt+0x518>
+  8008ef:	89 c2                	mov    %eax,%edx
+  8008f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f5:	83 c0 08             	add    $0x8,%eax
+  8008f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008fe:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800903:	e9 a8 00 00 00       	jmp    8009b0 <vprintfmt+0x5c0>
+  800908:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	eb e5                	jmp    8008fb <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800916:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800919:	83 f8 2f             	cmp    $0x2f,%eax
+  80091c:	77 15                	ja     800933 <vprintfmt+0x543>
+  80091e:	89 c2                	mov    %eax,%edx
+  800920:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800924:	83 c0 08             	add    $0x8,%eax
+  800927:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80092c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800931:	eb 7d                	jmp    8009b0 <vprintfmt+0x5c0>
+  800933:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800937:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093f:	eb e9                	jmp    80092a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	77 16                	ja     80095f <vprintfmt+0x56f>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800958:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80095d:	eb 51                	jmp    8009b0 <vprintfmt+0x5c0>
+  80095f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800963:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800967:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096b:	eb e8                	jmp    800955 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	e9 5c ff ff ff       	jmp    8008da <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80097e:	4c 89 ee             	mov    %r13,%rsi
+  800981:	bf 30 00 00 00       	mov    $0x30,%edi
+  800986:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800989:	4c 89 ee             	mov    %r13,%rsi
+  80098c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800991:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800997:	83 f8 2f             	cmp    $0x2f,%eax
+  80099a:	77 47                	ja     8009e3 <vprintfmt+0x5f3>
+  80099c:	89 c2                	mov    %eax,%edx
+  80099e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a2:	83 c0 08             	add    $0x8,%eax
+  8009a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009b8:	0f 94 c0             	sete   %al
+  8009bb:	0f b6 c0             	movzbl %al,%eax
+  8009be:	50                   	push   %rax
+  8009bf:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009c4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009c8:	4c 89 ee             	mov    %r13,%rsi
+  8009cb:	4c 89 f7             	mov    %r14,%rdi
+  8009ce:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  8009d5:	00 00 00 
+  8009d8:	ff d0                	call   *%rax
+            break;
+  8009da:	48 83 c4 10          	add    $0x10,%rsp
+  8009de:	e9 3e fa ff ff       	jmp    800421 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ef:	eb b7                	jmp    8009a8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f1:	40 84 f6             	test   %sil,%sil
+  8009f4:	75 2b                	jne    800a21 <vprintfmt+0x631>
+    switch (lflag) {
+  8009f6:	85 d2                	test   %edx,%edx
+  8009f8:	74 56                	je     800a50 <vprintfmt+0x660>
+  8009fa:	83 fa 01             	cmp    $0x1,%edx
+  8009fd:	74 7f                	je     800a7e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a02:	83 f8 2f             	cmp    $0x2f,%eax
+  800a05:	0f 87 a2 00 00 00    	ja     800aad <vprintfmt+0x6bd>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a1f:	eb 8f                	jmp    8009b0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a24:	83 f8 2f             	cmp    $0x2f,%eax
+  800a27:	77 19                	ja     800a42 <vprintfmt+0x652>
+  800a29:	89 c2                	mov    %eax,%edx
+  800a2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2f:	83 c0 08             	add    $0x8,%eax
+  800a32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a38:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a3d:	e9 6e ff ff ff       	jmp    8009b0 <vprintfmt+0x5c0>
+  800a42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4e:	eb e5                	jmp    800a35 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	77 18                	ja     800a70 <vprintfmt+0x680>
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5e:	83 c0 08             	add    $0x8,%eax
+  800a61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a64:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a6b:	e9 40 ff ff ff       	jmp    8009b0 <vprintfmt+0x5c0>
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	eb e6                	jmp    800a64 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a81:	83 f8 2f             	cmp    $0x2f,%eax
+  800a84:	77 19                	ja     800a9f <vprintfmt+0x6af>
+  800a86:	89 c2                	mov    %eax,%edx
+  800a88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8c:	83 c0 08             	add    $0x8,%eax
+  800a8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a92:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a95:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a9a:	e9 11 ff ff ff       	jmp    8009b0 <vprintfmt+0x5c0>
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	eb e5                	jmp    800a92 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab9:	e9 59 ff ff ff       	jmp    800a17 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800abe:	4c 89 ee             	mov    %r13,%rsi
+  800ac1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ac6:	41 ff d6             	call   *%r14
+            break;
+  800ac9:	e9 53 f9 ff ff       	jmp    800421 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ace:	4c 89 ee             	mov    %r13,%rsi
+  800ad1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ad9:	48 83 eb 01          	sub    $0x1,%rbx
+  800add:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ae1:	75 f6                	jne    800ad9 <vprintfmt+0x6e9>
+  800ae3:	e9 39 f9 ff ff       	jmp    800421 <vprintfmt+0x31>
+}
+  800ae8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aec:	5b                   	pop    %rbx
+  800aed:	41 5c                	pop    %r12
+  800aef:	41 5d                	pop    %r13
+  800af1:	41 5e                	pop    %r14
+  800af3:	41 5f                	pop    %r15
+  800af5:	5d                   	pop    %rbp
+  800af6:	c3                   	ret
+
+0000000000800af7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800af7:	55                   	push   %rbp
+  800af8:	48 89 e5             	mov    %rsp,%rbp
+  800afb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800aff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b03:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b08:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b0c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b13:	48 85 ff             	test   %rdi,%rdi
+  800b16:	74 2b                	je     800b43 <vsnprintf+0x4c>
+  800b18:	48 85 f6             	test   %rsi,%rsi
+  800b1b:	74 26                	je     800b43 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b1d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b21:	48 bf 9b 03 80 00 00 	movabs $0x80039b,%rdi
+  800b28:	00 00 00 
+  800b2b:	48 b8 f0 03 80 00 00 	movabs $0x8003f0,%rax
+  800b32:	00 00 00 
+  800b35:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b3b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b41:	c9                   	leave
+  800b42:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b48:	eb f7                	jmp    800b41 <vsnprintf+0x4a>
+
+0000000000800b4a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b4a:	55                   	push   %rbp
+  800b4b:	48 89 e5             	mov    %rsp,%rbp
+  800b4e:	48 83 ec 50          	sub    $0x50,%rsp
+  800b52:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b56:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b5a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b5e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b65:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b75:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b79:	48 b8 f7 0a 80 00 00 	movabs $0x800af7,%rax
+  800b80:	00 00 00 
+  800b83:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b85:	c9                   	leave
+  800b86:	c3                   	ret
+
+0000000000800b87 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b87:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b8a:	74 10                	je     800b9c <strlen+0x15>
+    size_t n = 0;
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b91:	48 83 c0 01          	add    $0x1,%rax
+  800b95:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b99:	75 f6                	jne    800b91 <strlen+0xa>
+  800b9b:	c3                   	ret
+    size_t n = 0;
+  800b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ba1:	c3                   	ret
+
+0000000000800ba2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ba2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800baa:	48 85 f6             	test   %rsi,%rsi
+  800bad:	74 11                	je     800bc0 <strnlen+0x1e>
+  800baf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bb3:	74 0c                	je     800bc1 <strnlen+0x1f>
+  800bb5:	48 83 c2 01          	add    $0x1,%rdx
+  800bb9:	48 39 d0             	cmp    %rdx,%rax
+  800bbc:	75 f1                	jne    800baf <strnlen+0xd>
+  800bbe:	eb 04                	jmp    800bc4 <strnlen+0x22>
+  800bc0:	c3                   	ret
+  800bc1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bc4:	c3                   	ret
+
+0000000000800bc5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bc5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bd1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bd4:	48 83 c2 01          	add    $0x1,%rdx
+  800bd8:	84 c9                	test   %cl,%cl
+  800bda:	75 f1                	jne    800bcd <strcpy+0x8>
+        ;
+    return res;
+}
+  800bdc:	c3                   	ret
+
+0000000000800bdd <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bdd:	55                   	push   %rbp
+  800bde:	48 89 e5             	mov    %rsp,%rbp
+  800be1:	41 54                	push   %r12
+  800be3:	53                   	push   %rbx
+  800be4:	48 89 fb             	mov    %rdi,%rbx
+  800be7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bea:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  800bf1:	00 00 00 
+  800bf4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bf6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bfa:	4c 89 e6             	mov    %r12,%rsi
+  800bfd:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  800c04:	00 00 00 
+  800c07:	ff d0                	call   *%rax
+    return dst;
+}
+  800c09:	48 89 d8             	mov    %rbx,%rax
+  800c0c:	5b                   	pop    %rbx
+  800c0d:	41 5c                	pop    %r12
+  800c0f:	5d                   	pop    %rbp
+  800c10:	c3                   	ret
+
+0000000000800c11 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c11:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c14:	48 85 d2             	test   %rdx,%rdx
+  800c17:	74 1f                	je     800c38 <strncpy+0x27>
+  800c19:	48 01 fa             	add    %rdi,%rdx
+  800c1c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c1f:	48 83 c1 01          	add    $0x1,%rcx
+  800c23:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c27:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c2b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c2f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c33:	48 39 ca             	cmp    %rcx,%rdx
+  800c36:	75 e7                	jne    800c1f <strncpy+0xe>
+    }
+    return ret;
+}
+  800c38:	c3                   	ret
+
+0000000000800c39 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c39:	48 89 f8             	mov    %rdi,%rax
+  800c3c:	48 85 d2             	test   %rdx,%rdx
+  800c3f:	74 24                	je     800c65 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c41:	48 83 ea 01          	sub    $0x1,%rdx
+  800c45:	74 1b                	je     800c62 <strlcpy+0x29>
+  800c47:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c4b:	0f b6 16             	movzbl (%rsi),%edx
+  800c4e:	84 d2                	test   %dl,%dl
+  800c50:	74 10                	je     800c62 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c52:	48 83 c6 01          	add    $0x1,%rsi
+  800c56:	48 83 c0 01          	add    $0x1,%rax
+  800c5a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c5d:	48 39 c8             	cmp    %rcx,%rax
+  800c60:	75 e9                	jne    800c4b <strlcpy+0x12>
+        *dst = '\0';
+  800c62:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c65:	48 29 f8             	sub    %rdi,%rax
+}
+  800c68:	c3                   	ret
+
+0000000000800c69 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c69:	0f b6 07             	movzbl (%rdi),%eax
+  800c6c:	84 c0                	test   %al,%al
+  800c6e:	74 13                	je     800c83 <strcmp+0x1a>
+  800c70:	38 06                	cmp    %al,(%rsi)
+  800c72:	75 0f                	jne    800c83 <strcmp+0x1a>
+  800c74:	48 83 c7 01          	add    $0x1,%rdi
+  800c78:	48 83 c6 01          	add    $0x1,%rsi
+  800c7c:	0f b6 07             	movzbl (%rdi),%eax
+  800c7f:	84 c0                	test   %al,%al
+  800c81:	75 ed                	jne    800c70 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c83:	0f b6 c0             	movzbl %al,%eax
+  800c86:	0f b6 16             	movzbl (%rsi),%edx
+  800c89:	29 d0                	sub    %edx,%eax
+}
+  800c8b:	c3                   	ret
+
+0000000000800c8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c8c:	48 85 d2             	test   %rdx,%rdx
+  800c8f:	74 1f                	je     800cb0 <strncmp+0x24>
+  800c91:	0f b6 07             	movzbl (%rdi),%eax
+  800c94:	84 c0                	test   %al,%al
+  800c96:	74 1e                	je     800cb6 <strncmp+0x2a>
+  800c98:	3a 06                	cmp    (%rsi),%al
+  800c9a:	75 1a                	jne    800cb6 <strncmp+0x2a>
+  800c9c:	48 83 c7 01          	add    $0x1,%rdi
+  800ca0:	48 83 c6 01          	add    $0x1,%rsi
+  800ca4:	48 83 ea 01          	sub    $0x1,%rdx
+  800ca8:	75 e7                	jne    800c91 <strncmp+0x5>
+
+    if (!n) return 0;
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caf:	c3                   	ret
+  800cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb5:	c3                   	ret
+  800cb6:	48 85 d2             	test   %rdx,%rdx
+  800cb9:	74 09                	je     800cc4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cbb:	0f b6 07             	movzbl (%rdi),%eax
+  800cbe:	0f b6 16             	movzbl (%rsi),%edx
+  800cc1:	29 d0                	sub    %edx,%eax
+  800cc3:	c3                   	ret
+    if (!n) return 0;
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc9:	c3                   	ret
+
+0000000000800cca <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cca:	0f b6 17             	movzbl (%rdi),%edx
+  800ccd:	84 d2                	test   %dl,%dl
+  800ccf:	74 18                	je     800ce9 <strchr+0x1f>
+        if (*str == c) {
+  800cd1:	0f be d2             	movsbl %dl,%edx
+  800cd4:	39 f2                	cmp    %esi,%edx
+  800cd6:	74 17                	je     800cef <strchr+0x25>
+    for (; *str; str++) {
+  800cd8:	48 83 c7 01          	add    $0x1,%rdi
+  800cdc:	0f b6 17             	movzbl (%rdi),%edx
+  800cdf:	84 d2                	test   %dl,%dl
+  800ce1:	75 ee                	jne    800cd1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce8:	c3                   	ret
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cee:	c3                   	ret
+  800cef:	48 89 f8             	mov    %rdi,%rax
+}
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cf3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cf6:	0f b6 17             	movzbl (%rdi),%edx
+  800cf9:	84 d2                	test   %dl,%dl
+  800cfb:	74 13                	je     800d10 <strfind+0x1d>
+  800cfd:	0f be d2             	movsbl %dl,%edx
+  800d00:	39 f2                	cmp    %esi,%edx
+  800d02:	74 0b                	je     800d0f <strfind+0x1c>
+  800d04:	48 83 c0 01          	add    $0x1,%rax
+  800d08:	0f b6 10             	movzbl (%rax),%edx
+  800d0b:	84 d2                	test   %dl,%dl
+  800d0d:	75 ee                	jne    800cfd <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d0f:	c3                   	ret
+  800d10:	c3                   	ret
+
+0000000000800d11 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d11:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d14:	48 89 f8             	mov    %rdi,%rax
+  800d17:	48 f7 d8             	neg    %rax
+  800d1a:	83 e0 07             	and    $0x7,%eax
+  800d1d:	49 89 d1             	mov    %rdx,%r9
+  800d20:	49 29 c1             	sub    %rax,%r9
+  800d23:	78 36                	js     800d5b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d25:	40 0f b6 c6          	movzbl %sil,%eax
+  800d29:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d30:	01 01 01 
+  800d33:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d37:	40 f6 c7 07          	test   $0x7,%dil
+  800d3b:	75 38                	jne    800d75 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d3d:	4c 89 c9             	mov    %r9,%rcx
+  800d40:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d44:	74 0c                	je     800d52 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d46:	fc                   	cld
+  800d47:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d4a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d4e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d52:	4d 85 c9             	test   %r9,%r9
+  800d55:	75 45                	jne    800d9c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d57:	4c 89 c0             	mov    %r8,%rax
+  800d5a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d5b:	48 85 d2             	test   %rdx,%rdx
+  800d5e:	74 f7                	je     800d57 <memset+0x46>
+  800d60:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d63:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d66:	48 83 c0 01          	add    $0x1,%rax
+  800d6a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d6e:	48 39 c2             	cmp    %rax,%rdx
+  800d71:	75 f3                	jne    800d66 <memset+0x55>
+  800d73:	eb e2                	jmp    800d57 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d75:	40 f6 c7 01          	test   $0x1,%dil
+  800d79:	74 06                	je     800d81 <memset+0x70>
+  800d7b:	88 07                	mov    %al,(%rdi)
+  800d7d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d81:	40 f6 c7 02          	test   $0x2,%dil
+  800d85:	74 07                	je     800d8e <memset+0x7d>
+  800d87:	66 89 07             	mov    %ax,(%rdi)
+  800d8a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d8e:	40 f6 c7 04          	test   $0x4,%dil
+  800d92:	74 a9                	je     800d3d <memset+0x2c>
+  800d94:	89 07                	mov    %eax,(%rdi)
+  800d96:	48 83 c7 04          	add    $0x4,%rdi
+  800d9a:	eb a1                	jmp    800d3d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d9c:	41 f6 c1 04          	test   $0x4,%r9b
+  800da0:	74 06                	je     800da8 <memset+0x97>
+  800da2:	89 07                	mov    %eax,(%rdi)
+  800da4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da8:	41 f6 c1 02          	test   $0x2,%r9b
+  800dac:	74 07                	je     800db5 <memset+0xa4>
+  800dae:	66 89 07             	mov    %ax,(%rdi)
+  800db1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800db5:	41 f6 c1 01          	test   $0x1,%r9b
+  800db9:	74 9c                	je     800d57 <memset+0x46>
+  800dbb:	88 07                	mov    %al,(%rdi)
+  800dbd:	eb 98                	jmp    800d57 <memset+0x46>
+
+0000000000800dbf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dbf:	48 89 f8             	mov    %rdi,%rax
+  800dc2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dc5:	48 39 fe             	cmp    %rdi,%rsi
+  800dc8:	73 3b                	jae    800e05 <memmove+0x46>
+  800dca:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dce:	48 39 d7             	cmp    %rdx,%rdi
+  800dd1:	73 32                	jae    800e05 <memmove+0x46>
+        s += n;
+        d += n;
+  800dd3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dd7:	48 89 d6             	mov    %rdx,%rsi
+  800dda:	48 09 fe             	or     %rdi,%rsi
+  800ddd:	48 09 ce             	or     %rcx,%rsi
+  800de0:	40 f6 c6 07          	test   $0x7,%sil
+  800de4:	75 12                	jne    800df8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800de6:	48 83 ef 08          	sub    $0x8,%rdi
+  800dea:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dee:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df2:	fd                   	std
+  800df3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800df6:	fc                   	cld
+  800df7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800df8:	48 83 ef 01          	sub    $0x1,%rdi
+  800dfc:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e00:	fd                   	std
+  800e01:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e03:	eb f1                	jmp    800df6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e05:	48 89 f2             	mov    %rsi,%rdx
+  800e08:	48 09 c2             	or     %rax,%rdx
+  800e0b:	48 09 ca             	or     %rcx,%rdx
+  800e0e:	f6 c2 07             	test   $0x7,%dl
+  800e11:	75 0c                	jne    800e1f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e13:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e17:	48 89 c7             	mov    %rax,%rdi
+  800e1a:	fc                   	cld
+  800e1b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e1e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e1f:	48 89 c7             	mov    %rax,%rdi
+  800e22:	fc                   	cld
+  800e23:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e25:	c3                   	ret
+
+0000000000800e26 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e2a:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+}
+  800e36:	5d                   	pop    %rbp
+  800e37:	c3                   	ret
+
+0000000000800e38 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e38:	55                   	push   %rbp
+  800e39:	48 89 e5             	mov    %rsp,%rbp
+  800e3c:	41 57                	push   %r15
+  800e3e:	41 56                	push   %r14
+  800e40:	41 55                	push   %r13
+  800e42:	41 54                	push   %r12
+  800e44:	53                   	push   %rbx
+  800e45:	48 83 ec 08          	sub    $0x8,%rsp
+  800e49:	49 89 fe             	mov    %rdi,%r14
+  800e4c:	49 89 f7             	mov    %rsi,%r15
+  800e4f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e52:	48 89 f7             	mov    %rsi,%rdi
+  800e55:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  800e5c:	00 00 00 
+  800e5f:	ff d0                	call   *%rax
+  800e61:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e64:	48 89 de             	mov    %rbx,%rsi
+  800e67:	4c 89 f7             	mov    %r14,%rdi
+  800e6a:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+  800e76:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e79:	48 39 c3             	cmp    %rax,%rbx
+  800e7c:	74 36                	je     800eb4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e7e:	48 89 d8             	mov    %rbx,%rax
+  800e81:	4c 29 e8             	sub    %r13,%rax
+  800e84:	49 39 c4             	cmp    %rax,%r12
+  800e87:	73 31                	jae    800eba <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e89:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e8e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e92:	4c 89 fe             	mov    %r15,%rsi
+  800e95:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ea1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ea5:	48 83 c4 08          	add    $0x8,%rsp
+  800ea9:	5b                   	pop    %rbx
+  800eaa:	41 5c                	pop    %r12
+  800eac:	41 5d                	pop    %r13
+  800eae:	41 5e                	pop    %r14
+  800eb0:	41 5f                	pop    %r15
+  800eb2:	5d                   	pop    %rbp
+  800eb3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eb4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eb8:	eb eb                	jmp    800ea5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800eba:	48 83 eb 01          	sub    $0x1,%rbx
+  800ebe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ec2:	48 89 da             	mov    %rbx,%rdx
+  800ec5:	4c 89 fe             	mov    %r15,%rsi
+  800ec8:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800ecf:	00 00 00 
+  800ed2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ed4:	49 01 de             	add    %rbx,%r14
+  800ed7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800edc:	eb c3                	jmp    800ea1 <strlcat+0x69>
+
+0000000000800ede <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ede:	48 85 d2             	test   %rdx,%rdx
+  800ee1:	74 2d                	je     800f10 <memcmp+0x32>
+  800ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ee8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eec:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ef1:	44 38 c1             	cmp    %r8b,%cl
+  800ef4:	75 0f                	jne    800f05 <memcmp+0x27>
+    while (n-- > 0) {
+  800ef6:	48 83 c0 01          	add    $0x1,%rax
+  800efa:	48 39 c2             	cmp    %rax,%rdx
+  800efd:	75 e9                	jne    800ee8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f04:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f05:	0f b6 c1             	movzbl %cl,%eax
+  800f08:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f0c:	44 29 c0             	sub    %r8d,%eax
+  800f0f:	c3                   	ret
+    return 0;
+  800f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f15:	c3                   	ret
+
+0000000000800f16 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f16:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f1a:	48 39 c7             	cmp    %rax,%rdi
+  800f1d:	73 0f                	jae    800f2e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f1f:	40 38 37             	cmp    %sil,(%rdi)
+  800f22:	74 0e                	je     800f32 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f24:	48 83 c7 01          	add    $0x1,%rdi
+  800f28:	48 39 f8             	cmp    %rdi,%rax
+  800f2b:	75 f2                	jne    800f1f <memfind+0x9>
+  800f2d:	c3                   	ret
+  800f2e:	48 89 f8             	mov    %rdi,%rax
+  800f31:	c3                   	ret
+  800f32:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f35:	c3                   	ret
+
+0000000000800f36 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f36:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f39:	0f b6 37             	movzbl (%rdi),%esi
+  800f3c:	40 80 fe 20          	cmp    $0x20,%sil
+  800f40:	74 06                	je     800f48 <strtol+0x12>
+  800f42:	40 80 fe 09          	cmp    $0x9,%sil
+  800f46:	75 13                	jne    800f5b <strtol+0x25>
+  800f48:	48 83 c7 01          	add    $0x1,%rdi
+  800f4c:	0f b6 37             	movzbl (%rdi),%esi
+  800f4f:	40 80 fe 20          	cmp    $0x20,%sil
+  800f53:	74 f3                	je     800f48 <strtol+0x12>
+  800f55:	40 80 fe 09          	cmp    $0x9,%sil
+  800f59:	74 ed                	je     800f48 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f5b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f5e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f61:	3c 01                	cmp    $0x1,%al
+  800f63:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f67:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f6d:	75 0f                	jne    800f7e <strtol+0x48>
+  800f6f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f72:	74 14                	je     800f88 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f74:	85 d2                	test   %edx,%edx
+  800f76:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f83:	4c 63 ca             	movslq %edx,%r9
+  800f86:	eb 36                	jmp    800fbe <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f88:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f8c:	74 0f                	je     800f9d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f8e:	85 d2                	test   %edx,%edx
+  800f90:	75 ec                	jne    800f7e <strtol+0x48>
+        s++;
+  800f92:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f96:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f9b:	eb e1                	jmp    800f7e <strtol+0x48>
+        s += 2;
+  800f9d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fa1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fa6:	eb d6                	jmp    800f7e <strtol+0x48>
+            dig -= '0';
+  800fa8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fab:	44 0f b6 c1          	movzbl %cl,%r8d
+  800faf:	41 39 d0             	cmp    %edx,%r8d
+  800fb2:	7d 21                	jge    800fd5 <strtol+0x9f>
+        val = val * base + dig;
+  800fb4:	49 0f af c1          	imul   %r9,%rax
+  800fb8:	0f b6 c9             	movzbl %cl,%ecx
+  800fbb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fbe:	48 83 c7 01          	add    $0x1,%rdi
+  800fc2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fc6:	80 f9 39             	cmp    $0x39,%cl
+  800fc9:	76 dd                	jbe    800fa8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fcb:	80 f9 7b             	cmp    $0x7b,%cl
+  800fce:	77 05                	ja     800fd5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fd0:	83 e9 57             	sub    $0x57,%ecx
+  800fd3:	eb d6                	jmp    800fab <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fd5:	4d 85 d2             	test   %r10,%r10
+  800fd8:	74 03                	je     800fdd <strtol+0xa7>
+  800fda:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fdd:	48 89 c2             	mov    %rax,%rdx
+  800fe0:	48 f7 da             	neg    %rdx
+  800fe3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fe7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800feb:	c3                   	ret
+
+0000000000800fec <strrev>:
+
+void
+strrev(char *str)
+{
+  800fec:	55                   	push   %rbp
+  800fed:	48 89 e5             	mov    %rsp,%rbp
+  800ff0:	53                   	push   %rbx
+  800ff1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ff5:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800ff8:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  800fff:	00 00 00 
+  801002:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801004:	83 e8 01             	sub    $0x1,%eax
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7e 22                	jle    80102d <strrev+0x41>
+  80100b:	48 98                	cltq
+  80100d:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801012:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801016:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  80101a:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80101e:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801021:	48 83 c2 01          	add    $0x1,%rdx
+  801025:	48 83 e8 01          	sub    $0x1,%rax
+  801029:	39 c2                	cmp    %eax,%edx
+  80102b:	7c e5                	jl     801012 <strrev+0x26>
+	}
+}
+  80102d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801031:	c9                   	leave
+  801032:	c3                   	ret
+
+0000000000801033 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801033:	85 d2                	test   %edx,%edx
+  801035:	0f 84 80 00 00 00    	je     8010bb <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  80103b:	55                   	push   %rbp
+  80103c:	48 89 e5             	mov    %rsp,%rbp
+  80103f:	53                   	push   %rbx
+  801040:	48 83 ec 08          	sub    $0x8,%rsp
+  801044:	49 89 f2             	mov    %rsi,%r10
+  801047:	41 89 d3             	mov    %edx,%r11d
+  80104a:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  80104d:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801052:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801055:	eb 20                	jmp    801077 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801057:	41 89 f1             	mov    %esi,%r9d
+  80105a:	83 c2 30             	add    $0x30,%edx
+  80105d:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801060:	89 f8                	mov    %edi,%eax
+  801062:	99                   	cltd
+  801063:	f7 f9                	idiv   %ecx
+  801065:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801067:	85 c0                	test   %eax,%eax
+  801069:	74 2e                	je     801099 <itoa+0x66>
+  80106b:	83 c6 01             	add    $0x1,%esi
+  80106e:	49 83 c0 01          	add    $0x1,%r8
+  801072:	44 39 cb             	cmp    %r9d,%ebx
+  801075:	7e 15                	jle    80108c <itoa+0x59>
+		digit = sum % base;
+  801077:	89 f8                	mov    %edi,%eax
+  801079:	99                   	cltd
+  80107a:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80107c:	83 fa 09             	cmp    $0x9,%edx
+  80107f:	7e d6                	jle    801057 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801081:	41 89 f1             	mov    %esi,%r9d
+  801084:	83 c2 37             	add    $0x37,%edx
+  801087:	41 88 10             	mov    %dl,(%r8)
+  80108a:	eb d4                	jmp    801060 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80108c:	41 83 eb 01          	sub    $0x1,%r11d
+  801090:	45 39 cb             	cmp    %r9d,%r11d
+  801093:	75 04                	jne    801099 <itoa+0x66>
+  801095:	85 c0                	test   %eax,%eax
+  801097:	75 28                	jne    8010c1 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801099:	4d 63 c9             	movslq %r9d,%r9
+  80109c:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8010a1:	4c 89 d7             	mov    %r10,%rdi
+  8010a4:	48 b8 ec 0f 80 00 00 	movabs $0x800fec,%rax
+  8010ab:	00 00 00 
+  8010ae:	ff d0                	call   *%rax
+	return 0;
+  8010b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b9:	c9                   	leave
+  8010ba:	c3                   	ret
+		return -1;
+  8010bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010c0:	c3                   	ret
+		return -1;
+  8010c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010c6:	eb ed                	jmp    8010b5 <itoa+0x82>
+
+00000000008010c8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010c8:	55                   	push   %rbp
+  8010c9:	48 89 e5             	mov    %rsp,%rbp
+  8010cc:	53                   	push   %rbx
+  8010cd:	48 89 fa             	mov    %rdi,%rdx
+  8010d0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ed:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f3:	c9                   	leave
+  8010f4:	c3                   	ret
+
+00000000008010f5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+  8010f9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fa:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801113:	be 00 00 00 00       	mov    $0x0,%esi
+  801118:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801120:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801124:	c9                   	leave
+  801125:	c3                   	ret
+
+0000000000801126 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801126:	55                   	push   %rbp
+  801127:	48 89 e5             	mov    %rsp,%rbp
+  80112a:	53                   	push   %rbx
+  80112b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80112f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801132:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801137:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80113c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801141:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801151:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801153:	48 85 c0             	test   %rax,%rax
+  801156:	7f 06                	jg     80115e <sys_env_destroy+0x38>
+}
+  801158:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115c:	c9                   	leave
+  80115d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80115e:	49 89 c0             	mov    %rax,%r8
+  801161:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801166:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  80116d:	00 00 00 
+  801170:	be 26 00 00 00       	mov    $0x26,%esi
+  801175:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  80117c:	00 00 00 
+  80117f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801184:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  80118b:	00 00 00 
+  80118e:	41 ff d1             	call   *%r9
+
+0000000000801191 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801191:	55                   	push   %rbp
+  801192:	48 89 e5             	mov    %rsp,%rbp
+  801195:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801196:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011af:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ba:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c0:	c9                   	leave
+  8011c1:	c3                   	ret
+
+00000000008011c2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011c2:	55                   	push   %rbp
+  8011c3:	48 89 e5             	mov    %rsp,%rbp
+  8011c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011eb:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+
+00000000008011f3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011f3:	55                   	push   %rbp
+  8011f4:	48 89 e5             	mov    %rsp,%rbp
+  8011f7:	53                   	push   %rbx
+  8011f8:	48 89 fa             	mov    %rdi,%rdx
+  8011fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fe:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801203:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80120a:	00 00 00 
+  80120d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80121f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+
+0000000000801225 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	53                   	push   %rbx
+  80122a:	49 89 f8             	mov    %rdi,%r8
+  80122d:	48 89 d3             	mov    %rdx,%rbx
+  801230:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801233:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801238:	4c 89 c2             	mov    %r8,%rdx
+  80123b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123e:	be 00 00 00 00       	mov    $0x0,%esi
+  801243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801249:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80124b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+0000000000801251 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+  801255:	53                   	push   %rbx
+  801256:	48 83 ec 08          	sub    $0x8,%rsp
+  80125a:	89 f8                	mov    %edi,%eax
+  80125c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80125f:	48 63 f9             	movslq %ecx,%rdi
+  801262:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801265:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126d:	be 00 00 00 00       	mov    $0x0,%esi
+  801272:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801278:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80127a:	48 85 c0             	test   %rax,%rax
+  80127d:	7f 06                	jg     801285 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80127f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801285:	49 89 c0             	mov    %rax,%r8
+  801288:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80128d:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801294:	00 00 00 
+  801297:	be 26 00 00 00       	mov    $0x26,%esi
+  80129c:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  8012a3:	00 00 00 
+  8012a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ab:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  8012b2:	00 00 00 
+  8012b5:	41 ff d1             	call   *%r9
+
+00000000008012b8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012b8:	55                   	push   %rbp
+  8012b9:	48 89 e5             	mov    %rsp,%rbp
+  8012bc:	53                   	push   %rbx
+  8012bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c1:	89 f8                	mov    %edi,%eax
+  8012c3:	49 89 f2             	mov    %rsi,%r10
+  8012c6:	48 89 cf             	mov    %rcx,%rdi
+  8012c9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012cc:	48 63 da             	movslq %edx,%rbx
+  8012cf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012da:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012df:	48 85 c0             	test   %rax,%rax
+  8012e2:	7f 06                	jg     8012ea <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e8:	c9                   	leave
+  8012e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ea:	49 89 c0             	mov    %rax,%r8
+  8012ed:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012f2:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  8012f9:	00 00 00 
+  8012fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801301:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801308:	00 00 00 
+  80130b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801310:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  801317:	00 00 00 
+  80131a:	41 ff d1             	call   *%r9
+
+000000000080131d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	53                   	push   %rbx
+  801322:	48 83 ec 08          	sub    $0x8,%rsp
+  801326:	48 89 f1             	mov    %rsi,%rcx
+  801329:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80132c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801334:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801339:	be 00 00 00 00       	mov    $0x0,%esi
+  80133e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801344:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801346:	48 85 c0             	test   %rax,%rax
+  801349:	7f 06                	jg     801351 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80134b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134f:	c9                   	leave
+  801350:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801351:	49 89 c0             	mov    %rax,%r8
+  801354:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801359:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801360:	00 00 00 
+  801363:	be 26 00 00 00       	mov    $0x26,%esi
+  801368:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  80136f:	00 00 00 
+  801372:	b8 00 00 00 00       	mov    $0x0,%eax
+  801377:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  80137e:	00 00 00 
+  801381:	41 ff d1             	call   *%r9
+
+0000000000801384 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	53                   	push   %rbx
+  801389:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80138d:	48 63 ce             	movslq %esi,%rcx
+  801390:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801393:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801398:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013af:	48 85 c0             	test   %rax,%rax
+  8013b2:	7f 06                	jg     8013ba <sys_env_set_status+0x36>
+}
+  8013b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b8:	c9                   	leave
+  8013b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ba:	49 89 c0             	mov    %rax,%r8
+  8013bd:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013c2:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  8013c9:	00 00 00 
+  8013cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d1:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  8013d8:	00 00 00 
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e0:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  8013e7:	00 00 00 
+  8013ea:	41 ff d1             	call   *%r9
+
+00000000008013ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013ed:	55                   	push   %rbp
+  8013ee:	48 89 e5             	mov    %rsp,%rbp
+  8013f1:	53                   	push   %rbx
+  8013f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013f9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801401:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801406:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140b:	be 00 00 00 00       	mov    $0x0,%esi
+  801410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801416:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801418:	48 85 c0             	test   %rax,%rax
+  80141b:	7f 06                	jg     801423 <sys_env_set_trapframe+0x36>
+}
+  80141d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801423:	49 89 c0             	mov    %rax,%r8
+  801426:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80142b:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801432:	00 00 00 
+  801435:	be 26 00 00 00       	mov    $0x26,%esi
+  80143a:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801441:	00 00 00 
+  801444:	b8 00 00 00 00       	mov    $0x0,%eax
+  801449:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  801450:	00 00 00 
+  801453:	41 ff d1             	call   *%r9
+
+0000000000801456 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801456:	55                   	push   %rbp
+  801457:	48 89 e5             	mov    %rsp,%rbp
+  80145a:	53                   	push   %rbx
+  80145b:	48 83 ec 08          	sub    $0x8,%rsp
+  80145f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801462:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801465:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801474:	be 00 00 00 00       	mov    $0x0,%esi
+  801479:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801481:	48 85 c0             	test   %rax,%rax
+  801484:	7f 06                	jg     80148c <sys_env_set_pgfault_upcall+0x36>
+}
+  801486:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148a:	c9                   	leave
+  80148b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148c:	49 89 c0             	mov    %rax,%r8
+  80148f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801494:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  80149b:	00 00 00 
+  80149e:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a3:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  8014aa:	00 00 00 
+  8014ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b2:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  8014b9:	00 00 00 
+  8014bc:	41 ff d1             	call   *%r9
+
+00000000008014bf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014bf:	55                   	push   %rbp
+  8014c0:	48 89 e5             	mov    %rsp,%rbp
+  8014c3:	53                   	push   %rbx
+  8014c4:	89 f8                	mov    %edi,%eax
+  8014c6:	49 89 f1             	mov    %rsi,%r9
+  8014c9:	48 89 d3             	mov    %rdx,%rbx
+  8014cc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014cf:	49 63 f0             	movslq %r8d,%rsi
+  8014d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014da:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e3:	cd 30                	int    $0x30
+}
+  8014e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+00000000008014eb <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014eb:	55                   	push   %rbp
+  8014ec:	48 89 e5             	mov    %rsp,%rbp
+  8014ef:	53                   	push   %rbx
+  8014f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f4:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014f7:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ff:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801502:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801507:	be 00 00 00 00       	mov    $0x0,%esi
+  80150c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801512:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801514:	48 85 c0             	test   %rax,%rax
+  801517:	7f 06                	jg     80151f <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151f:	49 89 c0             	mov    %rax,%r8
+  801522:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801527:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  80152e:	00 00 00 
+  801531:	be 26 00 00 00       	mov    $0x26,%esi
+  801536:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  80153d:	00 00 00 
+  801540:	b8 00 00 00 00       	mov    $0x0,%eax
+  801545:	49 b9 c1 35 80 00 00 	movabs $0x8035c1,%r9
+  80154c:	00 00 00 
+  80154f:	41 ff d1             	call   *%r9
+
+0000000000801552 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801552:	55                   	push   %rbp
+  801553:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155b:	48 b8 eb 14 80 00 00 	movabs $0x8014eb,%rax
+  801562:	00 00 00 
+  801565:	ff d0                	call   *%rax
+}
+  801567:	5d                   	pop    %rbp
+  801568:	c3                   	ret
+
+0000000000801569 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80156e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801573:	ba 00 00 00 00       	mov    $0x0,%edx
+  801578:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801587:	be 00 00 00 00       	mov    $0x0,%esi
+  80158c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801592:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801594:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801598:	c9                   	leave
+  801599:	c3                   	ret
+
+000000000080159a <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80159f:	48 63 ce             	movslq %esi,%rcx
+  8015a2:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c0:	cd 30                	int    $0x30
+}
+  8015c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c6:	c9                   	leave
+  8015c7:	c3                   	ret
+
+00000000008015c8 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015c8:	55                   	push   %rbp
+  8015c9:	48 89 e5             	mov    %rsp,%rbp
+  8015cc:	53                   	push   %rbx
+  8015cd:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015d0:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ee:	cd 30                	int    $0x30
+}
+  8015f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	53                   	push   %rbx
+  8015fb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015fe:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801601:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801606:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	41 54                	push   %r12
+  801627:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801628:	b8 08 00 00 00       	mov    $0x8,%eax
+  80162d:	cd 30                	int    $0x30
+  80162f:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801632:	85 c0                	test   %eax,%eax
+  801634:	78 7e                	js     8016b4 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801636:	0f 84 80 00 00 00    	je     8016bc <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80163c:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801642:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801649:	00 00 00 
+  80164c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801651:	89 c2                	mov    %eax,%edx
+  801653:	be 00 00 00 00       	mov    $0x0,%esi
+  801658:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165d:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  801664:	00 00 00 
+  801667:	ff d0                	call   *%rax
+  801669:	85 c0                	test   %eax,%eax
+  80166b:	0f 88 81 00 00 00    	js     8016f2 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801671:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801678:	00 00 00 
+  80167b:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801682:	44 89 e7             	mov    %r12d,%edi
+  801685:	48 b8 56 14 80 00 00 	movabs $0x801456,%rax
+  80168c:	00 00 00 
+  80168f:	ff d0                	call   *%rax
+  801691:	85 c0                	test   %eax,%eax
+  801693:	78 65                	js     8016fa <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801695:	be 02 00 00 00       	mov    $0x2,%esi
+  80169a:	44 89 e7             	mov    %r12d,%edi
+  80169d:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  8016a4:	00 00 00 
+  8016a7:	ff d0                	call   *%rax
+        return -1;
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8016b0:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  8016b4:	44 89 e0             	mov    %r12d,%eax
+  8016b7:	5b                   	pop    %rbx
+  8016b8:	41 5c                	pop    %r12
+  8016ba:	5d                   	pop    %rbp
+  8016bb:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8016bc:	48 b8 91 11 80 00 00 	movabs $0x801191,%rax
+  8016c3:	00 00 00 
+  8016c6:	ff d0                	call   *%rax
+  8016c8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016cd:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8016d1:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8016d5:	48 c1 e0 04          	shl    $0x4,%rax
+  8016d9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016e0:	00 00 00 
+  8016e3:	48 01 d0             	add    %rdx,%rax
+  8016e6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8016ed:	00 00 00 
+        return 0;
+  8016f0:	eb c2                	jmp    8016b4 <fork+0x93>
+        return -1;
+  8016f2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016f8:	eb ba                	jmp    8016b4 <fork+0x93>
+        return -1;
+  8016fa:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801700:	eb b2                	jmp    8016b4 <fork+0x93>
+
+0000000000801702 <sfork>:
+
+envid_t
+sfork() {
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801706:	48 ba f5 3d 80 00 00 	movabs $0x803df5,%rdx
+  80170d:	00 00 00 
+  801710:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801715:	48 bf 10 3e 80 00 00 	movabs $0x803e10,%rdi
+  80171c:	00 00 00 
+  80171f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801724:	48 b9 c1 35 80 00 00 	movabs $0x8035c1,%rcx
+  80172b:	00 00 00 
+  80172e:	ff d1                	call   *%rcx
+
+0000000000801730 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801730:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801737:	ff ff ff 
+  80173a:	48 01 f8             	add    %rdi,%rax
+  80173d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801741:	c3                   	ret
+
+0000000000801742 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801742:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801749:	ff ff ff 
+  80174c:	48 01 f8             	add    %rdi,%rax
+  80174f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801753:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801759:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80175d:	c3                   	ret
+
+000000000080175e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	41 57                	push   %r15
+  801764:	41 56                	push   %r14
+  801766:	41 55                	push   %r13
+  801768:	41 54                	push   %r12
+  80176a:	53                   	push   %rbx
+  80176b:	48 83 ec 08          	sub    $0x8,%rsp
+  80176f:	49 89 ff             	mov    %rdi,%r15
+  801772:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801777:	49 bd 7d 32 80 00 00 	movabs $0x80327d,%r13
+  80177e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801781:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801787:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80178a:	48 89 df             	mov    %rbx,%rdi
+  80178d:	41 ff d5             	call   *%r13
+  801790:	83 e0 04             	and    $0x4,%eax
+  801793:	74 17                	je     8017ac <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801795:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80179c:	4c 39 f3             	cmp    %r14,%rbx
+  80179f:	75 e6                	jne    801787 <fd_alloc+0x29>
+  8017a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017a7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017ac:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017af:	48 83 c4 08          	add    $0x8,%rsp
+  8017b3:	5b                   	pop    %rbx
+  8017b4:	41 5c                	pop    %r12
+  8017b6:	41 5d                	pop    %r13
+  8017b8:	41 5e                	pop    %r14
+  8017ba:	41 5f                	pop    %r15
+  8017bc:	5d                   	pop    %rbp
+  8017bd:	c3                   	ret
+
+00000000008017be <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017be:	83 ff 1f             	cmp    $0x1f,%edi
+  8017c1:	77 39                	ja     8017fc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017c3:	55                   	push   %rbp
+  8017c4:	48 89 e5             	mov    %rsp,%rbp
+  8017c7:	41 54                	push   %r12
+  8017c9:	53                   	push   %rbx
+  8017ca:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017cd:	48 63 df             	movslq %edi,%rbx
+  8017d0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017d7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017db:	48 89 df             	mov    %rbx,%rdi
+  8017de:	48 b8 7d 32 80 00 00 	movabs $0x80327d,%rax
+  8017e5:	00 00 00 
+  8017e8:	ff d0                	call   *%rax
+  8017ea:	a8 04                	test   $0x4,%al
+  8017ec:	74 14                	je     801802 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017ee:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f7:	5b                   	pop    %rbx
+  8017f8:	41 5c                	pop    %r12
+  8017fa:	5d                   	pop    %rbp
+  8017fb:	c3                   	ret
+        return -E_INVAL;
+  8017fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801801:	c3                   	ret
+        return -E_INVAL;
+  801802:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801807:	eb ee                	jmp    8017f7 <fd_lookup+0x39>
+
+0000000000801809 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801809:	55                   	push   %rbp
+  80180a:	48 89 e5             	mov    %rsp,%rbp
+  80180d:	41 54                	push   %r12
+  80180f:	53                   	push   %rbx
+  801810:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801813:	48 b8 c0 3e 80 00 00 	movabs $0x803ec0,%rax
+  80181a:	00 00 00 
+  80181d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801824:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801827:	39 3b                	cmp    %edi,(%rbx)
+  801829:	74 47                	je     801872 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80182b:	48 83 c0 08          	add    $0x8,%rax
+  80182f:	48 8b 18             	mov    (%rax),%rbx
+  801832:	48 85 db             	test   %rbx,%rbx
+  801835:	75 f0                	jne    801827 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801837:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80183e:	00 00 00 
+  801841:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801847:	89 fa                	mov    %edi,%edx
+  801849:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  801850:	00 00 00 
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  80185f:	00 00 00 
+  801862:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801864:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801869:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80186d:	5b                   	pop    %rbx
+  80186e:	41 5c                	pop    %r12
+  801870:	5d                   	pop    %rbp
+  801871:	c3                   	ret
+            return 0;
+  801872:	b8 00 00 00 00       	mov    $0x0,%eax
+  801877:	eb f0                	jmp    801869 <dev_lookup+0x60>
+
+0000000000801879 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801879:	55                   	push   %rbp
+  80187a:	48 89 e5             	mov    %rsp,%rbp
+  80187d:	41 55                	push   %r13
+  80187f:	41 54                	push   %r12
+  801881:	53                   	push   %rbx
+  801882:	48 83 ec 18          	sub    $0x18,%rsp
+  801886:	48 89 fb             	mov    %rdi,%rbx
+  801889:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80188c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801893:	ff ff ff 
+  801896:	48 01 df             	add    %rbx,%rdi
+  801899:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80189d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018a1:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+  8018ad:	41 89 c5             	mov    %eax,%r13d
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	78 06                	js     8018ba <fd_close+0x41>
+  8018b4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018b8:	74 1a                	je     8018d4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018ba:	45 84 e4             	test   %r12b,%r12b
+  8018bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018c6:	44 89 e8             	mov    %r13d,%eax
+  8018c9:	48 83 c4 18          	add    $0x18,%rsp
+  8018cd:	5b                   	pop    %rbx
+  8018ce:	41 5c                	pop    %r12
+  8018d0:	41 5d                	pop    %r13
+  8018d2:	5d                   	pop    %rbp
+  8018d3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018d4:	8b 3b                	mov    (%rbx),%edi
+  8018d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018da:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  8018e1:	00 00 00 
+  8018e4:	ff d0                	call   *%rax
+  8018e6:	41 89 c5             	mov    %eax,%r13d
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 1b                	js     801908 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018f1:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8018f5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018fb:	48 85 c0             	test   %rax,%rax
+  8018fe:	74 08                	je     801908 <fd_close+0x8f>
+  801900:	48 89 df             	mov    %rbx,%rdi
+  801903:	ff d0                	call   *%rax
+  801905:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801908:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80190d:	48 89 de             	mov    %rbx,%rsi
+  801910:	bf 00 00 00 00       	mov    $0x0,%edi
+  801915:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  80191c:	00 00 00 
+  80191f:	ff d0                	call   *%rax
+    return res;
+  801921:	eb a3                	jmp    8018c6 <fd_close+0x4d>
+
+0000000000801923 <close>:
+
+int
+close(int fdnum) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+  801927:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80192b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80192f:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	78 15                	js     801954 <close+0x31>
+
+    return fd_close(fd, 1);
+  80193f:	be 01 00 00 00       	mov    $0x1,%esi
+  801944:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801948:	48 b8 79 18 80 00 00 	movabs $0x801879,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+}
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+
+0000000000801956 <close_all>:
+
+void
+close_all(void) {
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	41 54                	push   %r12
+  80195c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80195d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801962:	49 bc 23 19 80 00 00 	movabs $0x801923,%r12
+  801969:	00 00 00 
+  80196c:	89 df                	mov    %ebx,%edi
+  80196e:	41 ff d4             	call   *%r12
+  801971:	83 c3 01             	add    $0x1,%ebx
+  801974:	83 fb 20             	cmp    $0x20,%ebx
+  801977:	75 f3                	jne    80196c <close_all+0x16>
+}
+  801979:	5b                   	pop    %rbx
+  80197a:	41 5c                	pop    %r12
+  80197c:	5d                   	pop    %rbp
+  80197d:	c3                   	ret
+
+000000000080197e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80197e:	55                   	push   %rbp
+  80197f:	48 89 e5             	mov    %rsp,%rbp
+  801982:	41 57                	push   %r15
+  801984:	41 56                	push   %r14
+  801986:	41 55                	push   %r13
+  801988:	41 54                	push   %r12
+  80198a:	53                   	push   %rbx
+  80198b:	48 83 ec 18          	sub    $0x18,%rsp
+  80198f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801992:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801996:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+  8019a2:	89 c3                	mov    %eax,%ebx
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	0f 88 b8 00 00 00    	js     801a64 <dup+0xe6>
+    close(newfdnum);
+  8019ac:	44 89 e7             	mov    %r12d,%edi
+  8019af:	48 b8 23 19 80 00 00 	movabs $0x801923,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019bb:	4d 63 ec             	movslq %r12d,%r13
+  8019be:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019c5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019c9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019cd:	4c 89 ff             	mov    %r15,%rdi
+  8019d0:	49 be 42 17 80 00 00 	movabs $0x801742,%r14
+  8019d7:	00 00 00 
+  8019da:	41 ff d6             	call   *%r14
+  8019dd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019e0:	4c 89 ef             	mov    %r13,%rdi
+  8019e3:	41 ff d6             	call   *%r14
+  8019e6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019e9:	48 89 df             	mov    %rbx,%rdi
+  8019ec:	48 b8 7d 32 80 00 00 	movabs $0x80327d,%rax
+  8019f3:	00 00 00 
+  8019f6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019f8:	a8 04                	test   $0x4,%al
+  8019fa:	74 2b                	je     801a27 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019fc:	41 89 c1             	mov    %eax,%r9d
+  8019ff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a05:	4c 89 f1             	mov    %r14,%rcx
+  801a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0d:	48 89 de             	mov    %rbx,%rsi
+  801a10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a15:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+  801a21:	89 c3                	mov    %eax,%ebx
+  801a23:	85 c0                	test   %eax,%eax
+  801a25:	78 4e                	js     801a75 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a27:	4c 89 ff             	mov    %r15,%rdi
+  801a2a:	48 b8 7d 32 80 00 00 	movabs $0x80327d,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+  801a36:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a39:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a3f:	4c 89 e9             	mov    %r13,%rcx
+  801a42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a47:	4c 89 fe             	mov    %r15,%rsi
+  801a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a4f:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  801a56:	00 00 00 
+  801a59:	ff d0                	call   *%rax
+  801a5b:	89 c3                	mov    %eax,%ebx
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	78 14                	js     801a75 <dup+0xf7>
+
+    return newfdnum;
+  801a61:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a64:	89 d8                	mov    %ebx,%eax
+  801a66:	48 83 c4 18          	add    $0x18,%rsp
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	41 5d                	pop    %r13
+  801a6f:	41 5e                	pop    %r14
+  801a71:	41 5f                	pop    %r15
+  801a73:	5d                   	pop    %rbp
+  801a74:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a7a:	4c 89 ee             	mov    %r13,%rsi
+  801a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a82:	49 bc 1d 13 80 00 00 	movabs $0x80131d,%r12
+  801a89:	00 00 00 
+  801a8c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a94:	4c 89 f6             	mov    %r14,%rsi
+  801a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9c:	41 ff d4             	call   *%r12
+    return res;
+  801a9f:	eb c3                	jmp    801a64 <dup+0xe6>
+
+0000000000801aa1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801aa1:	55                   	push   %rbp
+  801aa2:	48 89 e5             	mov    %rsp,%rbp
+  801aa5:	41 56                	push   %r14
+  801aa7:	41 55                	push   %r13
+  801aa9:	41 54                	push   %r12
+  801aab:	53                   	push   %rbx
+  801aac:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab0:	89 fb                	mov    %edi,%ebx
+  801ab2:	49 89 f4             	mov    %rsi,%r12
+  801ab5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ab8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801abc:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 4c                	js     801b18 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801acc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ad0:	41 8b 3e             	mov    (%r14),%edi
+  801ad3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ad7:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	78 35                	js     801b1c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ae7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801aeb:	83 e0 03             	and    $0x3,%eax
+  801aee:	83 f8 01             	cmp    $0x1,%eax
+  801af1:	74 2d                	je     801b20 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801af3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801af7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801afb:	48 85 c0             	test   %rax,%rax
+  801afe:	74 56                	je     801b56 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b00:	4c 89 ea             	mov    %r13,%rdx
+  801b03:	4c 89 e6             	mov    %r12,%rsi
+  801b06:	4c 89 f7             	mov    %r14,%rdi
+  801b09:	ff d0                	call   *%rax
+}
+  801b0b:	48 83 c4 10          	add    $0x10,%rsp
+  801b0f:	5b                   	pop    %rbx
+  801b10:	41 5c                	pop    %r12
+  801b12:	41 5d                	pop    %r13
+  801b14:	41 5e                	pop    %r14
+  801b16:	5d                   	pop    %rbp
+  801b17:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b18:	48 98                	cltq
+  801b1a:	eb ef                	jmp    801b0b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b1c:	48 98                	cltq
+  801b1e:	eb eb                	jmp    801b0b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b20:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b27:	00 00 00 
+  801b2a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b30:	89 da                	mov    %ebx,%edx
+  801b32:	48 bf 81 3e 80 00 00 	movabs $0x803e81,%rdi
+  801b39:	00 00 00 
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b41:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  801b48:	00 00 00 
+  801b4b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b4d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b54:	eb b5                	jmp    801b0b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b56:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b5d:	eb ac                	jmp    801b0b <read+0x6a>
+
+0000000000801b5f <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801b5f:	55                   	push   %rbp
+  801b60:	48 89 e5             	mov    %rsp,%rbp
+  801b63:	41 56                	push   %r14
+  801b65:	41 55                	push   %r13
+  801b67:	41 54                	push   %r12
+  801b69:	53                   	push   %rbx
+  801b6a:	48 83 ec 10          	sub    $0x10,%rsp
+  801b6e:	89 fb                	mov    %edi,%ebx
+  801b70:	49 89 f4             	mov    %rsi,%r12
+  801b73:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b76:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b7a:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 41                	js     801bcb <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b8a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b8e:	41 8b 3e             	mov    (%r14),%edi
+  801b91:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b95:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 35                	js     801bda <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ba5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ba9:	83 e0 03             	and    $0x3,%eax
+  801bac:	83 f8 01             	cmp    $0x1,%eax
+  801baf:	74 2d                	je     801bde <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801bb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bb5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bb9:	48 85 c0             	test   %rax,%rax
+  801bbc:	74 56                	je     801c14 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801bbe:	4c 89 ea             	mov    %r13,%rdx
+  801bc1:	4c 89 e6             	mov    %r12,%rsi
+  801bc4:	4c 89 f7             	mov    %r14,%rdi
+  801bc7:	ff d0                	call   *%rax
+  801bc9:	eb 02                	jmp    801bcd <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bcb:	48 98                	cltq
+}
+  801bcd:	48 83 c4 10          	add    $0x10,%rsp
+  801bd1:	5b                   	pop    %rbx
+  801bd2:	41 5c                	pop    %r12
+  801bd4:	41 5d                	pop    %r13
+  801bd6:	41 5e                	pop    %r14
+  801bd8:	5d                   	pop    %rbp
+  801bd9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bda:	48 98                	cltq
+  801bdc:	eb ef                	jmp    801bcd <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bde:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801be5:	00 00 00 
+  801be8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bee:	89 da                	mov    %ebx,%edx
+  801bf0:	48 bf 40 3e 80 00 00 	movabs $0x803e40,%rdi
+  801bf7:	00 00 00 
+  801bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bff:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  801c06:	00 00 00 
+  801c09:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c0b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c12:	eb b9                	jmp    801bcd <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c14:	4c 89 ea             	mov    %r13,%rdx
+  801c17:	4c 89 e6             	mov    %r12,%rsi
+  801c1a:	89 df                	mov    %ebx,%edi
+  801c1c:	48 b8 a1 1a 80 00 00 	movabs $0x801aa1,%rax
+  801c23:	00 00 00 
+  801c26:	ff d0                	call   *%rax
+  801c28:	eb a3                	jmp    801bcd <readmap+0x6e>
+
+0000000000801c2a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c2a:	55                   	push   %rbp
+  801c2b:	48 89 e5             	mov    %rsp,%rbp
+  801c2e:	41 57                	push   %r15
+  801c30:	41 56                	push   %r14
+  801c32:	41 55                	push   %r13
+  801c34:	41 54                	push   %r12
+  801c36:	53                   	push   %rbx
+  801c37:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c3b:	48 85 d2             	test   %rdx,%rdx
+  801c3e:	74 54                	je     801c94 <readn+0x6a>
+  801c40:	41 89 fd             	mov    %edi,%r13d
+  801c43:	49 89 f6             	mov    %rsi,%r14
+  801c46:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c4e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c53:	49 bf a1 1a 80 00 00 	movabs $0x801aa1,%r15
+  801c5a:	00 00 00 
+  801c5d:	4c 89 e2             	mov    %r12,%rdx
+  801c60:	48 29 f2             	sub    %rsi,%rdx
+  801c63:	4c 01 f6             	add    %r14,%rsi
+  801c66:	44 89 ef             	mov    %r13d,%edi
+  801c69:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 20                	js     801c90 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c70:	01 c3                	add    %eax,%ebx
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	74 08                	je     801c7e <readn+0x54>
+  801c76:	48 63 f3             	movslq %ebx,%rsi
+  801c79:	4c 39 e6             	cmp    %r12,%rsi
+  801c7c:	72 df                	jb     801c5d <readn+0x33>
+    }
+    return res;
+  801c7e:	48 63 c3             	movslq %ebx,%rax
+}
+  801c81:	48 83 c4 08          	add    $0x8,%rsp
+  801c85:	5b                   	pop    %rbx
+  801c86:	41 5c                	pop    %r12
+  801c88:	41 5d                	pop    %r13
+  801c8a:	41 5e                	pop    %r14
+  801c8c:	41 5f                	pop    %r15
+  801c8e:	5d                   	pop    %rbp
+  801c8f:	c3                   	ret
+        if (inc < 0) return inc;
+  801c90:	48 98                	cltq
+  801c92:	eb ed                	jmp    801c81 <readn+0x57>
+    int inc = 1, res = 0;
+  801c94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c99:	eb e3                	jmp    801c7e <readn+0x54>
+
+0000000000801c9b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c9b:	55                   	push   %rbp
+  801c9c:	48 89 e5             	mov    %rsp,%rbp
+  801c9f:	41 56                	push   %r14
+  801ca1:	41 55                	push   %r13
+  801ca3:	41 54                	push   %r12
+  801ca5:	53                   	push   %rbx
+  801ca6:	48 83 ec 10          	sub    $0x10,%rsp
+  801caa:	89 fb                	mov    %edi,%ebx
+  801cac:	49 89 f4             	mov    %rsi,%r12
+  801caf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cb6:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801cbd:	00 00 00 
+  801cc0:	ff d0                	call   *%rax
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 47                	js     801d0d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cca:	41 8b 3e             	mov    (%r14),%edi
+  801ccd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cd1:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801cd8:	00 00 00 
+  801cdb:	ff d0                	call   *%rax
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 30                	js     801d11 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ce6:	74 2d                	je     801d15 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ce8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cec:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801cf0:	48 85 c0             	test   %rax,%rax
+  801cf3:	74 56                	je     801d4b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cf5:	4c 89 ea             	mov    %r13,%rdx
+  801cf8:	4c 89 e6             	mov    %r12,%rsi
+  801cfb:	4c 89 f7             	mov    %r14,%rdi
+  801cfe:	ff d0                	call   *%rax
+}
+  801d00:	48 83 c4 10          	add    $0x10,%rsp
+  801d04:	5b                   	pop    %rbx
+  801d05:	41 5c                	pop    %r12
+  801d07:	41 5d                	pop    %r13
+  801d09:	41 5e                	pop    %r14
+  801d0b:	5d                   	pop    %rbp
+  801d0c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d0d:	48 98                	cltq
+  801d0f:	eb ef                	jmp    801d00 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d11:	48 98                	cltq
+  801d13:	eb eb                	jmp    801d00 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d15:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d1c:	00 00 00 
+  801d1f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d25:	89 da                	mov    %ebx,%edx
+  801d27:	48 bf 9d 3e 80 00 00 	movabs $0x803e9d,%rdi
+  801d2e:	00 00 00 
+  801d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d36:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  801d3d:	00 00 00 
+  801d40:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d42:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d49:	eb b5                	jmp    801d00 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d4b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d52:	eb ac                	jmp    801d00 <write+0x65>
+
+0000000000801d54 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d54:	55                   	push   %rbp
+  801d55:	48 89 e5             	mov    %rsp,%rbp
+  801d58:	53                   	push   %rbx
+  801d59:	48 83 ec 18          	sub    $0x18,%rsp
+  801d5d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d5f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d63:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801d6a:	00 00 00 
+  801d6d:	ff d0                	call   *%rax
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 0c                	js     801d7f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d77:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+
+0000000000801d85 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	41 55                	push   %r13
+  801d8b:	41 54                	push   %r12
+  801d8d:	53                   	push   %rbx
+  801d8e:	48 83 ec 18          	sub    $0x18,%rsp
+  801d92:	89 fb                	mov    %edi,%ebx
+  801d94:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d97:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d9b:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 38                	js     801de3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dab:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801daf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801db3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db7:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801dbe:	00 00 00 
+  801dc1:	ff d0                	call   *%rax
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 1c                	js     801de3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801dcc:	74 20                	je     801dee <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd2:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801dd6:	48 85 c0             	test   %rax,%rax
+  801dd9:	74 47                	je     801e22 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ddb:	44 89 e6             	mov    %r12d,%esi
+  801dde:	4c 89 ef             	mov    %r13,%rdi
+  801de1:	ff d0                	call   *%rax
+}
+  801de3:	48 83 c4 18          	add    $0x18,%rsp
+  801de7:	5b                   	pop    %rbx
+  801de8:	41 5c                	pop    %r12
+  801dea:	41 5d                	pop    %r13
+  801dec:	5d                   	pop    %rbp
+  801ded:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dee:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801df5:	00 00 00 
+  801df8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dfe:	89 da                	mov    %ebx,%edx
+  801e00:	48 bf 60 3e 80 00 00 	movabs $0x803e60,%rdi
+  801e07:	00 00 00 
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0f:	48 b9 a0 02 80 00 00 	movabs $0x8002a0,%rcx
+  801e16:	00 00 00 
+  801e19:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e20:	eb c1                	jmp    801de3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e22:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e27:	eb ba                	jmp    801de3 <ftruncate+0x5e>
+
+0000000000801e29 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e29:	55                   	push   %rbp
+  801e2a:	48 89 e5             	mov    %rsp,%rbp
+  801e2d:	41 54                	push   %r12
+  801e2f:	53                   	push   %rbx
+  801e30:	48 83 ec 10          	sub    $0x10,%rsp
+  801e34:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e3b:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	78 4e                	js     801e99 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e4b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e4f:	41 8b 3c 24          	mov    (%r12),%edi
+  801e53:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e57:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 32                	js     801e99 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e6b:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801e70:	74 30                	je     801ea2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e72:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e75:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e7c:	00 00 00 
+    stat->st_isdir = 0;
+  801e7f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e86:	00 00 00 
+    stat->st_dev = dev;
+  801e89:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e90:	48 89 de             	mov    %rbx,%rsi
+  801e93:	4c 89 e7             	mov    %r12,%rdi
+  801e96:	ff 50 30             	call   *0x30(%rax)
+}
+  801e99:	48 83 c4 10          	add    $0x10,%rsp
+  801e9d:	5b                   	pop    %rbx
+  801e9e:	41 5c                	pop    %r12
+  801ea0:	5d                   	pop    %rbp
+  801ea1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ea2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ea7:	eb f0                	jmp    801e99 <fstat+0x70>
+
+0000000000801ea9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ea9:	55                   	push   %rbp
+  801eaa:	48 89 e5             	mov    %rsp,%rbp
+  801ead:	41 54                	push   %r12
+  801eaf:	53                   	push   %rbx
+  801eb0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801eb3:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb8:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	78 25                	js     801eef <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801eca:	4c 89 e6             	mov    %r12,%rsi
+  801ecd:	89 c7                	mov    %eax,%edi
+  801ecf:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  801ed6:	00 00 00 
+  801ed9:	ff d0                	call   *%rax
+  801edb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ede:	89 df                	mov    %ebx,%edi
+  801ee0:	48 b8 23 19 80 00 00 	movabs $0x801923,%rax
+  801ee7:	00 00 00 
+  801eea:	ff d0                	call   *%rax
+
+    return res;
+  801eec:	44 89 e3             	mov    %r12d,%ebx
+}
+  801eef:	89 d8                	mov    %ebx,%eax
+  801ef1:	5b                   	pop    %rbx
+  801ef2:	41 5c                	pop    %r12
+  801ef4:	5d                   	pop    %rbp
+  801ef5:	c3                   	ret
+
+0000000000801ef6 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801ef6:	55                   	push   %rbp
+  801ef7:	48 89 e5             	mov    %rsp,%rbp
+  801efa:	41 54                	push   %r12
+  801efc:	53                   	push   %rbx
+  801efd:	48 83 ec 10          	sub    $0x10,%rsp
+  801f01:	48 89 fb             	mov    %rdi,%rbx
+  801f04:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f07:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f0b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f10:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 1f                	js     801f3f <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801f20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f24:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801f28:	48 85 c0             	test   %rax,%rax
+  801f2b:	74 1b                	je     801f48 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801f2d:	4c 89 e6             	mov    %r12,%rsi
+  801f30:	48 89 df             	mov    %rbx,%rdi
+  801f33:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f3f:	48 83 c4 10          	add    $0x10,%rsp
+  801f43:	5b                   	pop    %rbx
+  801f44:	41 5c                	pop    %r12
+  801f46:	5d                   	pop    %rbp
+  801f47:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f4d:	eb f0                	jmp    801f3f <create_snapshot+0x49>
+
+0000000000801f4f <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801f4f:	55                   	push   %rbp
+  801f50:	48 89 e5             	mov    %rsp,%rbp
+  801f53:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f5b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f60:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 1e                	js     801f8e <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f74:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801f78:	48 85 d2             	test   %rdx,%rdx
+  801f7b:	74 13                	je     801f90 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f82:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f90:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f95:	eb f7                	jmp    801f8e <print_snapshot_list+0x3f>
+
+0000000000801f97 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801f97:	55                   	push   %rbp
+  801f98:	48 89 e5             	mov    %rsp,%rbp
+  801f9b:	53                   	push   %rbx
+  801f9c:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa0:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fa3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fa7:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fac:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 1c                	js     801fd8 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801fbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fc0:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801fc4:	48 85 c0             	test   %rax,%rax
+  801fc7:	74 15                	je     801fde <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801fc9:	48 89 df             	mov    %rbx,%rdi
+  801fcc:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd5:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fdc:	c9                   	leave
+  801fdd:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fde:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fe3:	eb f3                	jmp    801fd8 <accept_snapshot+0x41>
+
+0000000000801fe5 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+  801fe9:	53                   	push   %rbx
+  801fea:	48 83 ec 18          	sub    $0x18,%rsp
+  801fee:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ff1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ff5:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ffa:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 1c                	js     802026 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80200a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80200e:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802012:	48 85 c0             	test   %rax,%rax
+  802015:	74 15                	je     80202c <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802017:	48 89 df             	mov    %rbx,%rdi
+  80201a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80201c:	85 c0                	test   %eax,%eax
+  80201e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802023:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802026:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80202c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802031:	eb f3                	jmp    802026 <delete_snapshot+0x41>
+
+0000000000802033 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80203b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80203f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802044:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+  802050:	85 c0                	test   %eax,%eax
+  802052:	78 14                	js     802068 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802054:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802058:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80205c:	48 85 d2             	test   %rdx,%rdx
+  80205f:	74 09                	je     80206a <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802061:	b8 00 00 00 00       	mov    $0x0,%eax
+  802066:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+        return -E_NOT_SUPP;
+  80206a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206f:	eb f7                	jmp    802068 <gc_snapshots+0x35>
+
+0000000000802071 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802071:	55                   	push   %rbp
+  802072:	48 89 e5             	mov    %rsp,%rbp
+  802075:	41 56                	push   %r14
+  802077:	41 55                	push   %r13
+  802079:	41 54                	push   %r12
+  80207b:	53                   	push   %rbx
+  80207c:	48 83 ec 10          	sub    $0x10,%rsp
+  802080:	48 89 fb             	mov    %rdi,%rbx
+  802083:	49 89 f4             	mov    %rsi,%r12
+  802086:	49 89 d5             	mov    %rdx,%r13
+  802089:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80208c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802090:	bf 66 00 00 00       	mov    $0x66,%edi
+  802095:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  80209c:	00 00 00 
+  80209f:	ff d0                	call   *%rax
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 1b                	js     8020c0 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8020a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a9:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8020ad:	48 85 c0             	test   %rax,%rax
+  8020b0:	74 1b                	je     8020cd <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8020b2:	4c 89 f1             	mov    %r14,%rcx
+  8020b5:	4c 89 ea             	mov    %r13,%rdx
+  8020b8:	4c 89 e6             	mov    %r12,%rsi
+  8020bb:	48 89 df             	mov    %rbx,%rdi
+  8020be:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020c0:	48 83 c4 10          	add    $0x10,%rsp
+  8020c4:	5b                   	pop    %rbx
+  8020c5:	41 5c                	pop    %r12
+  8020c7:	41 5d                	pop    %r13
+  8020c9:	41 5e                	pop    %r14
+  8020cb:	5d                   	pop    %rbp
+  8020cc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020d2:	eb ec                	jmp    8020c0 <diff_snapshots+0x4f>
+
+00000000008020d4 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8020d4:	55                   	push   %rbp
+  8020d5:	48 89 e5             	mov    %rsp,%rbp
+  8020d8:	41 55                	push   %r13
+  8020da:	41 54                	push   %r12
+  8020dc:	53                   	push   %rbx
+  8020dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020e1:	48 89 fb             	mov    %rdi,%rbx
+  8020e4:	49 89 f4             	mov    %rsi,%r12
+  8020e7:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020ee:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020f3:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  8020fa:	00 00 00 
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 18                	js     80211b <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802103:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802107:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80210b:	48 85 c0             	test   %rax,%rax
+  80210e:	74 16                	je     802126 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802110:	4c 89 ea             	mov    %r13,%rdx
+  802113:	4c 89 e6             	mov    %r12,%rsi
+  802116:	48 89 df             	mov    %rbx,%rdi
+  802119:	ff d0                	call   *%rax
+
+    return res;
+}
+  80211b:	48 83 c4 18          	add    $0x18,%rsp
+  80211f:	5b                   	pop    %rbx
+  802120:	41 5c                	pop    %r12
+  802122:	41 5d                	pop    %r13
+  802124:	5d                   	pop    %rbp
+  802125:	c3                   	ret
+        return -E_NOT_SUPP;
+  802126:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80212b:	eb ee                	jmp    80211b <send_snapshot+0x47>
+
+000000000080212d <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+  802131:	53                   	push   %rbx
+  802132:	48 83 ec 18          	sub    $0x18,%rsp
+  802136:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802139:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802142:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802149:	00 00 00 
+  80214c:	ff d0                	call   *%rax
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 12                	js     802164 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802156:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80215a:	48 85 c0             	test   %rax,%rax
+  80215d:	74 0b                	je     80216a <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80215f:	48 89 df             	mov    %rbx,%rdi
+  802162:	ff d0                	call   *%rax
+
+    return res;
+}
+  802164:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802168:	c9                   	leave
+  802169:	c3                   	ret
+        return -E_NOT_SUPP;
+  80216a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80216f:	eb f3                	jmp    802164 <receive_snapshot+0x37>
+
+0000000000802171 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802179:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80217d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802182:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 17                	js     8021a9 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802192:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802196:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  80219d:	48 85 d2             	test   %rdx,%rdx
+  8021a0:	74 09                	je     8021ab <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8021a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a7:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021ab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021b0:	eb f7                	jmp    8021a9 <free_space_bytes+0x38>
+
+00000000008021b2 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+  8021b6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021be:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021c3:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 17                	js     8021ea <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8021d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d7:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8021de:	48 85 d2             	test   %rdx,%rdx
+  8021e1:	74 09                	je     8021ec <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8021e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e8:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021ec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021f1:	eb f7                	jmp    8021ea <busy_space_bytes+0x38>
+
+00000000008021f3 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	41 54                	push   %r12
+  8021f9:	53                   	push   %rbx
+  8021fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fe:	89 fb                	mov    %edi,%ebx
+  802200:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802203:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802207:	bf 66 00 00 00       	mov    $0x66,%edi
+  80220c:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802213:	00 00 00 
+  802216:	ff d0                	call   *%rax
+  802218:	85 c0                	test   %eax,%eax
+  80221a:	78 17                	js     802233 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80221c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802220:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802227:	48 85 c0             	test   %rax,%rax
+  80222a:	74 10                	je     80223c <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80222c:	4c 89 e6             	mov    %r12,%rsi
+  80222f:	89 df                	mov    %ebx,%edi
+  802231:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802233:	48 83 c4 10          	add    $0x10,%rsp
+  802237:	5b                   	pop    %rbx
+  802238:	41 5c                	pop    %r12
+  80223a:	5d                   	pop    %rbp
+  80223b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80223c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802241:	eb f0                	jmp    802233 <snapshots_space+0x40>
+
+0000000000802243 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802243:	55                   	push   %rbp
+  802244:	48 89 e5             	mov    %rsp,%rbp
+  802247:	41 55                	push   %r13
+  802249:	41 54                	push   %r12
+  80224b:	53                   	push   %rbx
+  80224c:	48 83 ec 08          	sub    $0x8,%rsp
+  802250:	41 89 fd             	mov    %edi,%r13d
+  802253:	48 89 f3             	mov    %rsi,%rbx
+  802256:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802259:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802260:	00 00 00 
+  802263:	83 38 00             	cmpl   $0x0,(%rax)
+  802266:	74 57                	je     8022bf <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802268:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80226e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802273:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80227a:	00 00 00 
+  80227d:	44 89 ee             	mov    %r13d,%esi
+  802280:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802287:	00 00 00 
+  80228a:	8b 38                	mov    (%rax),%edi
+  80228c:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802298:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80229d:	4c 89 e2             	mov    %r12,%rdx
+  8022a0:	48 89 de             	mov    %rbx,%rsi
+  8022a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a8:	48 b8 4b 37 80 00 00 	movabs $0x80374b,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+}
+  8022b4:	48 83 c4 08          	add    $0x8,%rsp
+  8022b8:	5b                   	pop    %rbx
+  8022b9:	41 5c                	pop    %r12
+  8022bb:	41 5d                	pop    %r13
+  8022bd:	5d                   	pop    %rbp
+  8022be:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022bf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022c4:	48 b8 21 38 80 00 00 	movabs $0x803821,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+  8022d0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022d7:	00 00 
+  8022d9:	eb 8d                	jmp    802268 <fsipc_region+0x25>
+
+00000000008022db <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8022db:	55                   	push   %rbp
+  8022dc:	48 89 e5             	mov    %rsp,%rbp
+  8022df:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8022e3:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8022ea:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8022eb:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8022ef:	48 b8 43 22 80 00 00 	movabs $0x802243,%rax
+  8022f6:	00 00 00 
+  8022f9:	ff d0                	call   *%rax
+}
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+
+00000000008022fd <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8022fd:	85 ff                	test   %edi,%edi
+  8022ff:	78 6d                	js     80236e <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802301:	55                   	push   %rbp
+  802302:	48 89 e5             	mov    %rsp,%rbp
+  802305:	41 54                	push   %r12
+  802307:	53                   	push   %rbx
+  802308:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80230b:	48 85 f6             	test   %rsi,%rsi
+  80230e:	74 57                	je     802367 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802310:	89 f8                	mov    %edi,%eax
+  802312:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802319:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80231b:	be 00 00 00 00       	mov    $0x0,%esi
+  802320:	bf 12 00 00 00       	mov    $0x12,%edi
+  802325:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 2d                	js     802362 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802335:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80233c:	00 00 00 
+  80233f:	49 63 14 24          	movslq (%r12),%rdx
+  802343:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80234a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80234f:	48 89 df             	mov    %rbx,%rdi
+  802352:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80235e:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802362:	5b                   	pop    %rbx
+  802363:	41 5c                	pop    %r12
+  802365:	5d                   	pop    %rbp
+  802366:	c3                   	ret
+        return -E_INVAL;
+  802367:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80236c:	eb f4                	jmp    802362 <devfile_df_snapshots+0x65>
+  80236e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802373:	c3                   	ret
+
+0000000000802374 <devfile_df_busy>:
+devfile_df_busy() {
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802378:	be 00 00 00 00       	mov    $0x0,%esi
+  80237d:	bf 11 00 00 00       	mov    $0x11,%edi
+  802382:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802389:	00 00 00 
+  80238c:	ff d0                	call   *%rax
+}
+  80238e:	5d                   	pop    %rbp
+  80238f:	c3                   	ret
+
+0000000000802390 <devfile_df_free>:
+devfile_df_free() {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802394:	be 00 00 00 00       	mov    $0x0,%esi
+  802399:	bf 10 00 00 00       	mov    $0x10,%edi
+  80239e:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+}
+  8023aa:	5d                   	pop    %rbp
+  8023ab:	c3                   	ret
+
+00000000008023ac <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8023ac:	55                   	push   %rbp
+  8023ad:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8023b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023ba:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+}
+  8023c6:	5d                   	pop    %rbp
+  8023c7:	c3                   	ret
+
+00000000008023c8 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8023c8:	55                   	push   %rbp
+  8023c9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8023cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d1:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023d6:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023e2:	85 c0                	test   %eax,%eax
+  8023e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8023ec:	5d                   	pop    %rbp
+  8023ed:	c3                   	ret
+
+00000000008023ee <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023f2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023f9:	00 00 00 
+  8023fc:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023ff:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802401:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802404:	be 00 00 00 00       	mov    $0x0,%esi
+  802409:	bf 02 00 00 00       	mov    $0x2,%edi
+  80240e:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+}
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+
+000000000080241c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802420:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802423:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80242a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80242c:	be 00 00 00 00       	mov    $0x0,%esi
+  802431:	bf 06 00 00 00       	mov    $0x6,%edi
+  802436:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+}
+  802442:	5d                   	pop    %rbp
+  802443:	c3                   	ret
+
+0000000000802444 <devfile_write>:
+    if (!fd || !buf) {
+  802444:	48 85 ff             	test   %rdi,%rdi
+  802447:	0f 84 c1 00 00 00    	je     80250e <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80244d:	55                   	push   %rbp
+  80244e:	48 89 e5             	mov    %rsp,%rbp
+  802451:	41 57                	push   %r15
+  802453:	41 56                	push   %r14
+  802455:	41 55                	push   %r13
+  802457:	41 54                	push   %r12
+  802459:	53                   	push   %rbx
+  80245a:	48 83 ec 18          	sub    $0x18,%rsp
+  80245e:	49 89 ff             	mov    %rdi,%r15
+  802461:	49 89 f5             	mov    %rsi,%r13
+  802464:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802467:	48 85 f6             	test   %rsi,%rsi
+  80246a:	0f 84 95 00 00 00    	je     802505 <devfile_write+0xc1>
+    while (n) {
+  802470:	48 85 d2             	test   %rdx,%rdx
+  802473:	0f 84 83 00 00 00    	je     8024fc <devfile_write+0xb8>
+    int totalWrite = 0;
+  802479:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802480:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802487:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80248a:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80248f:	49 39 dc             	cmp    %rbx,%r12
+  802492:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802496:	48 89 da             	mov    %rbx,%rdx
+  802499:	4c 89 ee             	mov    %r13,%rsi
+  80249c:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024a3:	00 00 00 
+  8024a6:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024b2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024b6:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8024b9:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8024bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024c7:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+        if (write < 0) {
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 21                	js     8024f8 <devfile_write+0xb4>
+        buf += write;
+  8024d7:	48 63 d0             	movslq %eax,%rdx
+  8024da:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8024dd:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8024e0:	49 29 d4             	sub    %rdx,%r12
+  8024e3:	75 a5                	jne    80248a <devfile_write+0x46>
+    return totalWrite;
+  8024e5:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8024e9:	48 83 c4 18          	add    $0x18,%rsp
+  8024ed:	5b                   	pop    %rbx
+  8024ee:	41 5c                	pop    %r12
+  8024f0:	41 5d                	pop    %r13
+  8024f2:	41 5e                	pop    %r14
+  8024f4:	41 5f                	pop    %r15
+  8024f6:	5d                   	pop    %rbp
+  8024f7:	c3                   	ret
+            return write;
+  8024f8:	48 98                	cltq
+  8024fa:	eb ed                	jmp    8024e9 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8024fc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802503:	eb e0                	jmp    8024e5 <devfile_write+0xa1>
+        return -E_INVAL;
+  802505:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80250c:	eb db                	jmp    8024e9 <devfile_write+0xa5>
+  80250e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802515:	c3                   	ret
+
+0000000000802516 <devfile_read>:
+    if (!fd || !buf) {
+  802516:	48 85 ff             	test   %rdi,%rdi
+  802519:	0f 84 c0 00 00 00    	je     8025df <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	41 57                	push   %r15
+  802525:	41 56                	push   %r14
+  802527:	41 55                	push   %r13
+  802529:	41 54                	push   %r12
+  80252b:	53                   	push   %rbx
+  80252c:	48 83 ec 18          	sub    $0x18,%rsp
+  802530:	49 89 ff             	mov    %rdi,%r15
+  802533:	49 89 f5             	mov    %rsi,%r13
+  802536:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802539:	48 85 f6             	test   %rsi,%rsi
+  80253c:	0f 84 96 00 00 00    	je     8025d8 <devfile_read+0xc2>
+    while (n) {
+  802542:	48 85 d2             	test   %rdx,%rdx
+  802545:	0f 84 87 00 00 00    	je     8025d2 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80254b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802552:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802553:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80255a:	00 00 00 
+  80255d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802561:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802564:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802569:	49 39 c4             	cmp    %rax,%r12
+  80256c:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802570:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802574:	be 00 00 00 00       	mov    $0x0,%esi
+  802579:	bf 03 00 00 00       	mov    $0x3,%edi
+  80257e:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	7e 37                	jle    8025c5 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  80258e:	48 63 d8             	movslq %eax,%rbx
+  802591:	48 89 da             	mov    %rbx,%rdx
+  802594:	4c 89 f6             	mov    %r14,%rsi
+  802597:	4c 89 ef             	mov    %r13,%rdi
+  80259a:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+        buf += read;
+  8025a6:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8025a9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8025ad:	49 29 dc             	sub    %rbx,%r12
+  8025b0:	75 ab                	jne    80255d <devfile_read+0x47>
+  return totalRead;
+  8025b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8025b6:	48 83 c4 18          	add    $0x18,%rsp
+  8025ba:	5b                   	pop    %rbx
+  8025bb:	41 5c                	pop    %r12
+  8025bd:	41 5d                	pop    %r13
+  8025bf:	41 5e                	pop    %r14
+  8025c1:	41 5f                	pop    %r15
+  8025c3:	5d                   	pop    %rbp
+  8025c4:	c3                   	ret
+            return read ? read : totalRead;
+  8025c5:	48 63 d0             	movslq %eax,%rdx
+  8025c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025cc:	48 0f 45 c2          	cmovne %rdx,%rax
+  8025d0:	eb e4                	jmp    8025b6 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8025d2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8025d6:	eb da                	jmp    8025b2 <devfile_read+0x9c>
+        return E_INVAL;
+  8025d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025dd:	eb d7                	jmp    8025b6 <devfile_read+0xa0>
+  8025df:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8025e4:	c3                   	ret
+
+00000000008025e5 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025e5:	48 85 ff             	test   %rdi,%rdi
+  8025e8:	74 5f                	je     802649 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8025ea:	55                   	push   %rbp
+  8025eb:	48 89 e5             	mov    %rsp,%rbp
+  8025ee:	53                   	push   %rbx
+  8025ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f3:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025f6:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+  802602:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802608:	77 45                	ja     80264f <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80260a:	48 89 de             	mov    %rbx,%rsi
+  80260d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802614:	00 00 00 
+  802617:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  80261e:	00 00 00 
+  802621:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802623:	be 00 00 00 00       	mov    $0x0,%esi
+  802628:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80262d:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802639:	85 c0                	test   %eax,%eax
+  80263b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802640:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802643:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+        return -E_INVAL;
+  802649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80264e:	c3                   	ret
+        return -E_INVAL;
+  80264f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802654:	eb ed                	jmp    802643 <devfile_receive_snapshot+0x5e>
+
+0000000000802656 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802656:	55                   	push   %rbp
+  802657:	48 89 e5             	mov    %rsp,%rbp
+  80265a:	41 55                	push   %r13
+  80265c:	41 54                	push   %r12
+  80265e:	53                   	push   %rbx
+  80265f:	48 83 ec 08          	sub    $0x8,%rsp
+  802663:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802666:	48 85 f6             	test   %rsi,%rsi
+  802669:	0f 94 c0             	sete   %al
+  80266c:	48 85 d2             	test   %rdx,%rdx
+  80266f:	0f 94 c2             	sete   %dl
+  802672:	08 d0                	or     %dl,%al
+  802674:	0f 85 ad 00 00 00    	jne    802727 <devfile_send_snapshot+0xd1>
+  80267a:	48 89 fb             	mov    %rdi,%rbx
+  80267d:	49 89 f4             	mov    %rsi,%r12
+  802680:	48 85 ff             	test   %rdi,%rdi
+  802683:	0f 84 9e 00 00 00    	je     802727 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802689:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80269b:	0f 87 8d 00 00 00    	ja     80272e <devfile_send_snapshot+0xd8>
+  8026a1:	4c 89 e7             	mov    %r12,%rdi
+  8026a4:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+  8026b0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026b6:	77 7d                	ja     802735 <devfile_send_snapshot+0xdf>
+  8026b8:	4c 89 ef             	mov    %r13,%rdi
+  8026bb:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+  8026c7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026cd:	77 6d                	ja     80273c <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8026cf:	48 89 de             	mov    %rbx,%rsi
+  8026d2:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026d9:	00 00 00 
+  8026dc:	48 bb c5 0b 80 00 00 	movabs $0x800bc5,%rbx
+  8026e3:	00 00 00 
+  8026e6:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8026e8:	4c 89 e6             	mov    %r12,%rsi
+  8026eb:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8026f2:	00 00 00 
+  8026f5:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8026f7:	4c 89 ee             	mov    %r13,%rsi
+  8026fa:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802701:	00 00 00 
+  802704:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802706:	be 00 00 00 00       	mov    $0x0,%esi
+  80270b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802710:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+}
+  80271c:	48 83 c4 08          	add    $0x8,%rsp
+  802720:	5b                   	pop    %rbx
+  802721:	41 5c                	pop    %r12
+  802723:	41 5d                	pop    %r13
+  802725:	5d                   	pop    %rbp
+  802726:	c3                   	ret
+        return -E_INVAL;
+  802727:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272c:	eb ee                	jmp    80271c <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80272e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802733:	eb e7                	jmp    80271c <devfile_send_snapshot+0xc6>
+  802735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80273a:	eb e0                	jmp    80271c <devfile_send_snapshot+0xc6>
+  80273c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802741:	eb d9                	jmp    80271c <devfile_send_snapshot+0xc6>
+
+0000000000802743 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802743:	48 85 ff             	test   %rdi,%rdi
+  802746:	0f 84 41 01 00 00    	je     80288d <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80274c:	55                   	push   %rbp
+  80274d:	48 89 e5             	mov    %rsp,%rbp
+  802750:	41 57                	push   %r15
+  802752:	41 56                	push   %r14
+  802754:	41 55                	push   %r13
+  802756:	41 54                	push   %r12
+  802758:	53                   	push   %rbx
+  802759:	48 83 ec 08          	sub    $0x8,%rsp
+  80275d:	49 89 fc             	mov    %rdi,%r12
+  802760:	49 89 f5             	mov    %rsi,%r13
+  802763:	48 89 d3             	mov    %rdx,%rbx
+  802766:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802769:	48 85 f6             	test   %rsi,%rsi
+  80276c:	0f 84 ff 00 00 00    	je     802871 <devfile_diff_snapshots+0x12e>
+  802772:	48 85 d2             	test   %rdx,%rdx
+  802775:	0f 84 fd 00 00 00    	je     802878 <devfile_diff_snapshots+0x135>
+  80277b:	48 85 c9             	test   %rcx,%rcx
+  80277e:	0f 84 f4 00 00 00    	je     802878 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802784:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+  802790:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802796:	0f 87 e3 00 00 00    	ja     80287f <devfile_diff_snapshots+0x13c>
+  80279c:	4c 89 ef             	mov    %r13,%rdi
+  80279f:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027b1:	0f 87 cf 00 00 00    	ja     802886 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8027b7:	4c 89 e6             	mov    %r12,%rsi
+  8027ba:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8027c1:	00 00 00 
+  8027c4:	4c 89 e7             	mov    %r12,%rdi
+  8027c7:	49 bf c5 0b 80 00 00 	movabs $0x800bc5,%r15
+  8027ce:	00 00 00 
+  8027d1:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8027d4:	4c 89 ee             	mov    %r13,%rsi
+  8027d7:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8027de:	00 
+  8027df:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8027e2:	48 8b 03             	mov    (%rbx),%rax
+  8027e5:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8027ec:	00 
+  8027ed:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8027f1:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8027f8:	00 
+  8027f9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8027fd:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802804:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802805:	be 00 00 00 00       	mov    $0x0,%esi
+  80280a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80280f:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80281b:	85 c0                	test   %eax,%eax
+  80281d:	78 43                	js     802862 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80281f:	49 8b 04 24          	mov    (%r12),%rax
+  802823:	48 89 03             	mov    %rax,(%rbx)
+  802826:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80282b:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80282f:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802834:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802838:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80283d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802841:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802845:	48 c1 e2 03          	shl    $0x3,%rdx
+  802849:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80284e:	4c 89 f7             	mov    %r14,%rdi
+  802851:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80285d:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802862:	48 83 c4 08          	add    $0x8,%rsp
+  802866:	5b                   	pop    %rbx
+  802867:	41 5c                	pop    %r12
+  802869:	41 5d                	pop    %r13
+  80286b:	41 5e                	pop    %r14
+  80286d:	41 5f                	pop    %r15
+  80286f:	5d                   	pop    %rbp
+  802870:	c3                   	ret
+        return -E_INVAL;
+  802871:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802876:	eb ea                	jmp    802862 <devfile_diff_snapshots+0x11f>
+  802878:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287d:	eb e3                	jmp    802862 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80287f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802884:	eb dc                	jmp    802862 <devfile_diff_snapshots+0x11f>
+  802886:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80288b:	eb d5                	jmp    802862 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80288d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802892:	c3                   	ret
+
+0000000000802893 <devfile_delete_snapshot>:
+    if (!name) {
+  802893:	48 85 ff             	test   %rdi,%rdi
+  802896:	74 5f                	je     8028f7 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802898:	55                   	push   %rbp
+  802899:	48 89 e5             	mov    %rsp,%rbp
+  80289c:	53                   	push   %rbx
+  80289d:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a1:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8028a4:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8028ab:	00 00 00 
+  8028ae:	ff d0                	call   *%rax
+  8028b0:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028b6:	77 45                	ja     8028fd <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8028b8:	48 89 de             	mov    %rbx,%rsi
+  8028bb:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8028c2:	00 00 00 
+  8028c5:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8028d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8028db:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8028e2:	00 00 00 
+  8028e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ee:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+        return -E_INVAL;
+  8028f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028fc:	c3                   	ret
+        return -E_INVAL;
+  8028fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802902:	eb ed                	jmp    8028f1 <devfile_delete_snapshot+0x5e>
+
+0000000000802904 <devfile_accept_snapshot>:
+    if (!name) {
+  802904:	48 85 ff             	test   %rdi,%rdi
+  802907:	74 5f                	je     802968 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802909:	55                   	push   %rbp
+  80290a:	48 89 e5             	mov    %rsp,%rbp
+  80290d:	53                   	push   %rbx
+  80290e:	48 83 ec 08          	sub    $0x8,%rsp
+  802912:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802915:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  80291c:	00 00 00 
+  80291f:	ff d0                	call   *%rax
+  802921:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802927:	77 45                	ja     80296e <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802929:	48 89 de             	mov    %rbx,%rsi
+  80292c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802933:	00 00 00 
+  802936:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802942:	be 00 00 00 00       	mov    $0x0,%esi
+  802947:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80294c:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802953:	00 00 00 
+  802956:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802958:	85 c0                	test   %eax,%eax
+  80295a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802962:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+        return -E_INVAL;
+  802968:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80296d:	c3                   	ret
+        return -E_INVAL;
+  80296e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802973:	eb ed                	jmp    802962 <devfile_accept_snapshot+0x5e>
+
+0000000000802975 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802975:	48 85 ff             	test   %rdi,%rdi
+  802978:	0f 84 9f 00 00 00    	je     802a1d <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80297e:	55                   	push   %rbp
+  80297f:	48 89 e5             	mov    %rsp,%rbp
+  802982:	41 54                	push   %r12
+  802984:	53                   	push   %rbx
+  802985:	48 89 fb             	mov    %rdi,%rbx
+  802988:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  80298b:	48 85 f6             	test   %rsi,%rsi
+  80298e:	74 78                	je     802a08 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802990:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029a2:	77 6b                	ja     802a0f <devfile_create_snapshot+0x9a>
+  8029a4:	4c 89 e7             	mov    %r12,%rdi
+  8029a7:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+  8029b3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029b9:	77 5b                	ja     802a16 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8029bb:	48 89 de             	mov    %rbx,%rsi
+  8029be:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8029c5:	00 00 00 
+  8029c8:	48 bb c5 0b 80 00 00 	movabs $0x800bc5,%rbx
+  8029cf:	00 00 00 
+  8029d2:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8029d4:	4c 89 e6             	mov    %r12,%rsi
+  8029d7:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8029de:	00 00 00 
+  8029e1:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8029e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8029ed:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029f9:	85 c0                	test   %eax,%eax
+  8029fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a00:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a03:	5b                   	pop    %rbx
+  802a04:	41 5c                	pop    %r12
+  802a06:	5d                   	pop    %rbp
+  802a07:	c3                   	ret
+        return -E_INVAL;
+  802a08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a0d:	eb f4                	jmp    802a03 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a14:	eb ed                	jmp    802a03 <devfile_create_snapshot+0x8e>
+  802a16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a1b:	eb e6                	jmp    802a03 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a22:	c3                   	ret
+
+0000000000802a23 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a23:	55                   	push   %rbp
+  802a24:	48 89 e5             	mov    %rsp,%rbp
+  802a27:	41 54                	push   %r12
+  802a29:	53                   	push   %rbx
+  802a2a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a2d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a30:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802a37:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a39:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a43:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802a4a:	00 00 00 
+  802a4d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a4f:	85 c0                	test   %eax,%eax
+  802a51:	78 3d                	js     802a90 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a53:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802a5a:	00 00 00 
+  802a5d:	4c 89 e6             	mov    %r12,%rsi
+  802a60:	48 89 df             	mov    %rbx,%rdi
+  802a63:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  802a6a:	00 00 00 
+  802a6d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a6f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a76:	00 
+  802a77:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a7d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a84:	00 
+  802a85:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a90:	5b                   	pop    %rbx
+  802a91:	41 5c                	pop    %r12
+  802a93:	5d                   	pop    %rbp
+  802a94:	c3                   	ret
+
+0000000000802a95 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+  802a99:	41 57                	push   %r15
+  802a9b:	41 56                	push   %r14
+  802a9d:	41 55                	push   %r13
+  802a9f:	41 54                	push   %r12
+  802aa1:	53                   	push   %rbx
+  802aa2:	48 83 ec 38          	sub    $0x38,%rsp
+  802aa6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802aaa:	49 89 f5             	mov    %rsi,%r13
+  802aad:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ab0:	48 89 f0             	mov    %rsi,%rax
+  802ab3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ab8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802abc:	75 4f                	jne    802b0d <devfile_readmap+0x78>
+  802abe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ac2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ac8:	75 1f                	jne    802ae9 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802aca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ace:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ad2:	49 be 7d 32 80 00 00 	movabs $0x80327d,%r14
+  802ad9:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802adc:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802ae3:	0f 87 9d 00 00 00    	ja     802b86 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ae9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802aed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802af1:	4d 85 ff             	test   %r15,%r15
+  802af4:	0f 85 cf 00 00 00    	jne    802bc9 <devfile_readmap+0x134>
+  802afa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802afe:	48 83 c4 38          	add    $0x38,%rsp
+  802b02:	5b                   	pop    %rbx
+  802b03:	41 5c                	pop    %r12
+  802b05:	41 5d                	pop    %r13
+  802b07:	41 5e                	pop    %r14
+  802b09:	41 5f                	pop    %r15
+  802b0b:	5d                   	pop    %rbp
+  802b0c:	c3                   	ret
+    size_t totalRead = 0;
+  802b0d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802b14:	00 
+  802b15:	eb da                	jmp    802af1 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b17:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b1b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b1e:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802b25:	00 00 00 
+  802b28:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802b2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b2e:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802b32:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b36:	4c 89 ee             	mov    %r13,%rsi
+  802b39:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b3e:	48 b8 43 22 80 00 00 	movabs $0x802243,%rax
+  802b45:	00 00 00 
+  802b48:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	7e a3                	jle    802af1 <devfile_readmap+0x5c>
+  802b4e:	48 98                	cltq
+  802b50:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b54:	72 9b                	jb     802af1 <devfile_readmap+0x5c>
+        buf += read;
+  802b56:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802b59:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802b5c:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b60:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802b67:	75 88                	jne    802af1 <devfile_readmap+0x5c>
+  802b69:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b6d:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b73:	0f 85 78 ff ff ff    	jne    802af1 <devfile_readmap+0x5c>
+  802b79:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802b80:	0f 86 6b ff ff ff    	jbe    802af1 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802b86:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802b8c:	4d 39 e7             	cmp    %r12,%r15
+  802b8f:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802b93:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802b9a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b9e:	0f 84 73 ff ff ff    	je     802b17 <devfile_readmap+0x82>
+  802ba4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ba8:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802bad:	41 ff d6             	call   *%r14
+  802bb0:	a8 40                	test   $0x40,%al
+  802bb2:	0f 85 39 ff ff ff    	jne    802af1 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bb8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bbf:	4c 39 e3             	cmp    %r12,%rbx
+  802bc2:	72 e4                	jb     802ba8 <devfile_readmap+0x113>
+  802bc4:	e9 4e ff ff ff       	jmp    802b17 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802bc9:	4c 89 fa             	mov    %r15,%rdx
+  802bcc:	4c 89 ee             	mov    %r13,%rsi
+  802bcf:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802bd3:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802bdf:	48 85 c0             	test   %rax,%rax
+  802be2:	78 0c                	js     802bf0 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802be4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802be8:	48 01 f0             	add    %rsi,%rax
+  802beb:	e9 0e ff ff ff       	jmp    802afe <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802bf0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bf4:	48 85 f6             	test   %rsi,%rsi
+  802bf7:	48 0f 45 c6          	cmovne %rsi,%rax
+  802bfb:	e9 fe fe ff ff       	jmp    802afe <devfile_readmap+0x69>
+
+0000000000802c00 <open>:
+open(const char *path, int mode) {
+  802c00:	55                   	push   %rbp
+  802c01:	48 89 e5             	mov    %rsp,%rbp
+  802c04:	41 55                	push   %r13
+  802c06:	41 54                	push   %r12
+  802c08:	53                   	push   %rbx
+  802c09:	48 83 ec 18          	sub    $0x18,%rsp
+  802c0d:	49 89 fc             	mov    %rdi,%r12
+  802c10:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c13:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+  802c1f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c25:	0f 87 8a 00 00 00    	ja     802cb5 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c2b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c2f:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+  802c3b:	89 c3                	mov    %eax,%ebx
+  802c3d:	85 c0                	test   %eax,%eax
+  802c3f:	78 50                	js     802c91 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c41:	4c 89 e6             	mov    %r12,%rsi
+  802c44:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802c4b:	00 00 00 
+  802c4e:	48 89 df             	mov    %rbx,%rdi
+  802c51:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c5d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c64:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c68:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c6d:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802c74:	00 00 00 
+  802c77:	ff d0                	call   *%rax
+  802c79:	89 c3                	mov    %eax,%ebx
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	78 1f                	js     802c9e <open+0x9e>
+    return fd2num(fd);
+  802c7f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c83:	48 b8 30 17 80 00 00 	movabs $0x801730,%rax
+  802c8a:	00 00 00 
+  802c8d:	ff d0                	call   *%rax
+  802c8f:	89 c3                	mov    %eax,%ebx
+}
+  802c91:	89 d8                	mov    %ebx,%eax
+  802c93:	48 83 c4 18          	add    $0x18,%rsp
+  802c97:	5b                   	pop    %rbx
+  802c98:	41 5c                	pop    %r12
+  802c9a:	41 5d                	pop    %r13
+  802c9c:	5d                   	pop    %rbp
+  802c9d:	c3                   	ret
+        fd_close(fd, 0);
+  802c9e:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ca7:	48 b8 79 18 80 00 00 	movabs $0x801879,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+        return res;
+  802cb3:	eb dc                	jmp    802c91 <open+0x91>
+        return -E_BAD_PATH;
+  802cb5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802cba:	eb d5                	jmp    802c91 <open+0x91>
+
+0000000000802cbc <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802cbc:	55                   	push   %rbp
+  802cbd:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802cc0:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc5:	bf 13 00 00 00       	mov    $0x13,%edi
+  802cca:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+}
+  802cd6:	5d                   	pop    %rbp
+  802cd7:	c3                   	ret
+
+0000000000802cd8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cd8:	55                   	push   %rbp
+  802cd9:	48 89 e5             	mov    %rsp,%rbp
+  802cdc:	41 54                	push   %r12
+  802cde:	53                   	push   %rbx
+  802cdf:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ce2:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  802ce9:	00 00 00 
+  802cec:	ff d0                	call   *%rax
+  802cee:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cf1:	48 be e0 3e 80 00 00 	movabs $0x803ee0,%rsi
+  802cf8:	00 00 00 
+  802cfb:	48 89 df             	mov    %rbx,%rdi
+  802cfe:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802d0a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d0f:	41 2b 04 24          	sub    (%r12),%eax
+  802d13:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d19:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d20:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d23:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802d2a:	00 00 00 
+  802d2d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d39:	5b                   	pop    %rbx
+  802d3a:	41 5c                	pop    %r12
+  802d3c:	5d                   	pop    %rbp
+  802d3d:	c3                   	ret
+
+0000000000802d3e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 54                	push   %r12
+  802d44:	53                   	push   %rbx
+  802d45:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d4d:	48 89 fe             	mov    %rdi,%rsi
+  802d50:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d55:	49 bc 1d 13 80 00 00 	movabs $0x80131d,%r12
+  802d5c:	00 00 00 
+  802d5f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d62:	48 89 df             	mov    %rbx,%rdi
+  802d65:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  802d6c:	00 00 00 
+  802d6f:	ff d0                	call   *%rax
+  802d71:	48 89 c6             	mov    %rax,%rsi
+  802d74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7e:	41 ff d4             	call   *%r12
+}
+  802d81:	5b                   	pop    %rbx
+  802d82:	41 5c                	pop    %r12
+  802d84:	5d                   	pop    %rbp
+  802d85:	c3                   	ret
+
+0000000000802d86 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d86:	55                   	push   %rbp
+  802d87:	48 89 e5             	mov    %rsp,%rbp
+  802d8a:	41 57                	push   %r15
+  802d8c:	41 56                	push   %r14
+  802d8e:	41 55                	push   %r13
+  802d90:	41 54                	push   %r12
+  802d92:	53                   	push   %rbx
+  802d93:	48 83 ec 18          	sub    $0x18,%rsp
+  802d97:	49 89 fc             	mov    %rdi,%r12
+  802d9a:	49 89 f5             	mov    %rsi,%r13
+  802d9d:	49 89 d7             	mov    %rdx,%r15
+  802da0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802da4:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  802dab:	00 00 00 
+  802dae:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802db0:	4d 85 ff             	test   %r15,%r15
+  802db3:	0f 84 af 00 00 00    	je     802e68 <devpipe_write+0xe2>
+  802db9:	48 89 c3             	mov    %rax,%rbx
+  802dbc:	4c 89 f8             	mov    %r15,%rax
+  802dbf:	4d 89 ef             	mov    %r13,%r15
+  802dc2:	4c 01 e8             	add    %r13,%rax
+  802dc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dc9:	49 bd 25 12 80 00 00 	movabs $0x801225,%r13
+  802dd0:	00 00 00 
+            sys_yield();
+  802dd3:	49 be c2 11 80 00 00 	movabs $0x8011c2,%r14
+  802dda:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802ddd:	8b 73 04             	mov    0x4(%rbx),%esi
+  802de0:	48 63 ce             	movslq %esi,%rcx
+  802de3:	48 63 03             	movslq (%rbx),%rax
+  802de6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802dec:	48 39 c1             	cmp    %rax,%rcx
+  802def:	72 2e                	jb     802e1f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802df1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802df6:	48 89 da             	mov    %rbx,%rdx
+  802df9:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dfe:	4c 89 e7             	mov    %r12,%rdi
+  802e01:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e04:	85 c0                	test   %eax,%eax
+  802e06:	74 66                	je     802e6e <devpipe_write+0xe8>
+            sys_yield();
+  802e08:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e0b:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e0e:	48 63 ce             	movslq %esi,%rcx
+  802e11:	48 63 03             	movslq (%rbx),%rax
+  802e14:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e1a:	48 39 c1             	cmp    %rax,%rcx
+  802e1d:	73 d2                	jae    802df1 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e1f:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e23:	48 89 ca             	mov    %rcx,%rdx
+  802e26:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e2a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e31:	08 10 20 
+  802e34:	48 f7 e2             	mul    %rdx
+  802e37:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e3b:	48 89 d0             	mov    %rdx,%rax
+  802e3e:	48 c1 e0 09          	shl    $0x9,%rax
+  802e42:	48 29 d0             	sub    %rdx,%rax
+  802e45:	48 c1 e0 03          	shl    $0x3,%rax
+  802e49:	48 29 c1             	sub    %rax,%rcx
+  802e4c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e51:	83 c6 01             	add    $0x1,%esi
+  802e54:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e57:	49 83 c7 01          	add    $0x1,%r15
+  802e5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e5f:	49 39 c7             	cmp    %rax,%r15
+  802e62:	0f 85 75 ff ff ff    	jne    802ddd <devpipe_write+0x57>
+    return n;
+  802e68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e6c:	eb 05                	jmp    802e73 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e73:	48 83 c4 18          	add    $0x18,%rsp
+  802e77:	5b                   	pop    %rbx
+  802e78:	41 5c                	pop    %r12
+  802e7a:	41 5d                	pop    %r13
+  802e7c:	41 5e                	pop    %r14
+  802e7e:	41 5f                	pop    %r15
+  802e80:	5d                   	pop    %rbp
+  802e81:	c3                   	ret
+
+0000000000802e82 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e82:	55                   	push   %rbp
+  802e83:	48 89 e5             	mov    %rsp,%rbp
+  802e86:	41 57                	push   %r15
+  802e88:	41 56                	push   %r14
+  802e8a:	41 55                	push   %r13
+  802e8c:	41 54                	push   %r12
+  802e8e:	53                   	push   %rbx
+  802e8f:	48 83 ec 18          	sub    $0x18,%rsp
+  802e93:	49 89 fc             	mov    %rdi,%r12
+  802e96:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e9e:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802ead:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802eb3:	49 bd 25 12 80 00 00 	movabs $0x801225,%r13
+  802eba:	00 00 00 
+            sys_yield();
+  802ebd:	49 be c2 11 80 00 00 	movabs $0x8011c2,%r14
+  802ec4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ec7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ecc:	74 7d                	je     802f4b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ece:	8b 03                	mov    (%rbx),%eax
+  802ed0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ed3:	75 26                	jne    802efb <devpipe_read+0x79>
+            if (i > 0) return i;
+  802ed5:	4d 85 ff             	test   %r15,%r15
+  802ed8:	75 77                	jne    802f51 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802eda:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802edf:	48 89 da             	mov    %rbx,%rdx
+  802ee2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ee7:	4c 89 e7             	mov    %r12,%rdi
+  802eea:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	74 72                	je     802f63 <devpipe_read+0xe1>
+            sys_yield();
+  802ef1:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ef4:	8b 03                	mov    (%rbx),%eax
+  802ef6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ef9:	74 df                	je     802eda <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802efb:	48 63 c8             	movslq %eax,%rcx
+  802efe:	48 89 ca             	mov    %rcx,%rdx
+  802f01:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f05:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802f0c:	08 10 20 
+  802f0f:	48 89 d0             	mov    %rdx,%rax
+  802f12:	48 f7 e6             	mul    %rsi
+  802f15:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f19:	48 89 d0             	mov    %rdx,%rax
+  802f1c:	48 c1 e0 09          	shl    $0x9,%rax
+  802f20:	48 29 d0             	sub    %rdx,%rax
+  802f23:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f2a:	00 
+  802f2b:	48 89 c8             	mov    %rcx,%rax
+  802f2e:	48 29 d0             	sub    %rdx,%rax
+  802f31:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f36:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f3a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f3e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f41:	49 83 c7 01          	add    $0x1,%r15
+  802f45:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f49:	75 83                	jne    802ece <devpipe_read+0x4c>
+    return n;
+  802f4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f4f:	eb 03                	jmp    802f54 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f51:	4c 89 f8             	mov    %r15,%rax
+}
+  802f54:	48 83 c4 18          	add    $0x18,%rsp
+  802f58:	5b                   	pop    %rbx
+  802f59:	41 5c                	pop    %r12
+  802f5b:	41 5d                	pop    %r13
+  802f5d:	41 5e                	pop    %r14
+  802f5f:	41 5f                	pop    %r15
+  802f61:	5d                   	pop    %rbp
+  802f62:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f68:	eb ea                	jmp    802f54 <devpipe_read+0xd2>
+
+0000000000802f6a <pipe>:
+pipe(int pfd[2]) {
+  802f6a:	55                   	push   %rbp
+  802f6b:	48 89 e5             	mov    %rsp,%rbp
+  802f6e:	41 55                	push   %r13
+  802f70:	41 54                	push   %r12
+  802f72:	53                   	push   %rbx
+  802f73:	48 83 ec 18          	sub    $0x18,%rsp
+  802f77:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f7a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f7e:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  802f85:	00 00 00 
+  802f88:	ff d0                	call   *%rax
+  802f8a:	89 c3                	mov    %eax,%ebx
+  802f8c:	85 c0                	test   %eax,%eax
+  802f8e:	0f 88 a0 01 00 00    	js     803134 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f94:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f9e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa7:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+  802fb3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	0f 88 77 01 00 00    	js     803134 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802fbd:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802fc1:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  802fc8:	00 00 00 
+  802fcb:	ff d0                	call   *%rax
+  802fcd:	89 c3                	mov    %eax,%ebx
+  802fcf:	85 c0                	test   %eax,%eax
+  802fd1:	0f 88 43 01 00 00    	js     80311a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802fd7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fea:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ff8:	85 c0                	test   %eax,%eax
+  802ffa:	0f 88 1a 01 00 00    	js     80311a <pipe+0x1b0>
+    va = fd2data(fd0);
+  803000:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803004:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  80300b:	00 00 00 
+  80300e:	ff d0                	call   *%rax
+  803010:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803013:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803018:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80301d:	48 89 c6             	mov    %rax,%rsi
+  803020:	bf 00 00 00 00       	mov    $0x0,%edi
+  803025:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  80302c:	00 00 00 
+  80302f:	ff d0                	call   *%rax
+  803031:	89 c3                	mov    %eax,%ebx
+  803033:	85 c0                	test   %eax,%eax
+  803035:	0f 88 c5 00 00 00    	js     803100 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80303b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80303f:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+  80304b:	48 89 c1             	mov    %rax,%rcx
+  80304e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803054:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80305a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80305f:	4c 89 ee             	mov    %r13,%rsi
+  803062:	bf 00 00 00 00       	mov    $0x0,%edi
+  803067:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  80306e:	00 00 00 
+  803071:	ff d0                	call   *%rax
+  803073:	89 c3                	mov    %eax,%ebx
+  803075:	85 c0                	test   %eax,%eax
+  803077:	78 6e                	js     8030e7 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803079:	be 00 10 00 00       	mov    $0x1000,%esi
+  80307e:	4c 89 ef             	mov    %r13,%rdi
+  803081:	48 b8 f3 11 80 00 00 	movabs $0x8011f3,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	83 f8 02             	cmp    $0x2,%eax
+  803090:	0f 85 ab 00 00 00    	jne    803141 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803096:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  80309d:	00 00 
+  80309f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030a3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8030a5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030a9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8030b0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030b4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8030b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030ba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8030c1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030c5:	48 bb 30 17 80 00 00 	movabs $0x801730,%rbx
+  8030cc:	00 00 00 
+  8030cf:	ff d3                	call   *%rbx
+  8030d1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8030d5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8030d9:	ff d3                	call   *%rbx
+  8030db:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e5:	eb 4d                	jmp    803134 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8030e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ec:	4c 89 ee             	mov    %r13,%rsi
+  8030ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f4:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  8030fb:	00 00 00 
+  8030fe:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803100:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803105:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310e:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  803115:	00 00 00 
+  803118:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80311a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80311f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803123:	bf 00 00 00 00       	mov    $0x0,%edi
+  803128:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+}
+  803134:	89 d8                	mov    %ebx,%eax
+  803136:	48 83 c4 18          	add    $0x18,%rsp
+  80313a:	5b                   	pop    %rbx
+  80313b:	41 5c                	pop    %r12
+  80313d:	41 5d                	pop    %r13
+  80313f:	5d                   	pop    %rbp
+  803140:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803141:	48 b9 10 3f 80 00 00 	movabs $0x803f10,%rcx
+  803148:	00 00 00 
+  80314b:	48 ba e7 3e 80 00 00 	movabs $0x803ee7,%rdx
+  803152:	00 00 00 
+  803155:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80315a:	48 bf fc 3e 80 00 00 	movabs $0x803efc,%rdi
+  803161:	00 00 00 
+  803164:	b8 00 00 00 00       	mov    $0x0,%eax
+  803169:	49 b8 c1 35 80 00 00 	movabs $0x8035c1,%r8
+  803170:	00 00 00 
+  803173:	41 ff d0             	call   *%r8
+
+0000000000803176 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803176:	55                   	push   %rbp
+  803177:	48 89 e5             	mov    %rsp,%rbp
+  80317a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80317e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803182:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  803189:	00 00 00 
+  80318c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80318e:	85 c0                	test   %eax,%eax
+  803190:	78 35                	js     8031c7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803192:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803196:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031a5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031aa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031b3:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	0f 94 c0             	sete   %al
+  8031c4:	0f b6 c0             	movzbl %al,%eax
+}
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+
+00000000008031c9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031c9:	48 89 f8             	mov    %rdi,%rax
+  8031cc:	48 c1 e8 27          	shr    $0x27,%rax
+  8031d0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031d7:	01 00 00 
+  8031da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031de:	f6 c2 01             	test   $0x1,%dl
+  8031e1:	74 6d                	je     803250 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031e3:	48 89 f8             	mov    %rdi,%rax
+  8031e6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031ea:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031f1:	01 00 00 
+  8031f4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031f8:	f6 c2 01             	test   $0x1,%dl
+  8031fb:	74 62                	je     80325f <get_uvpt_entry+0x96>
+  8031fd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803204:	01 00 00 
+  803207:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80320b:	f6 c2 80             	test   $0x80,%dl
+  80320e:	75 4f                	jne    80325f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803210:	48 89 f8             	mov    %rdi,%rax
+  803213:	48 c1 e8 15          	shr    $0x15,%rax
+  803217:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80321e:	01 00 00 
+  803221:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803225:	f6 c2 01             	test   $0x1,%dl
+  803228:	74 44                	je     80326e <get_uvpt_entry+0xa5>
+  80322a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803231:	01 00 00 
+  803234:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803238:	f6 c2 80             	test   $0x80,%dl
+  80323b:	75 31                	jne    80326e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80323d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803241:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803248:	01 00 00 
+  80324b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80324f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803250:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803257:	01 00 00 
+  80325a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80325e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80325f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803266:	01 00 00 
+  803269:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80326d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80326e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803275:	01 00 00 
+  803278:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80327c:	c3                   	ret
+
+000000000080327d <get_prot>:
+
+int
+get_prot(void *va) {
+  80327d:	55                   	push   %rbp
+  80327e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803281:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  803288:	00 00 00 
+  80328b:	ff d0                	call   *%rax
+  80328d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803290:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803295:	89 c1                	mov    %eax,%ecx
+  803297:	83 c9 04             	or     $0x4,%ecx
+  80329a:	f6 c2 01             	test   $0x1,%dl
+  80329d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8032a0:	89 c1                	mov    %eax,%ecx
+  8032a2:	83 c9 02             	or     $0x2,%ecx
+  8032a5:	f6 c2 02             	test   $0x2,%dl
+  8032a8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8032ab:	89 c1                	mov    %eax,%ecx
+  8032ad:	83 c9 01             	or     $0x1,%ecx
+  8032b0:	48 85 d2             	test   %rdx,%rdx
+  8032b3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8032b6:	89 c1                	mov    %eax,%ecx
+  8032b8:	83 c9 40             	or     $0x40,%ecx
+  8032bb:	f6 c6 04             	test   $0x4,%dh
+  8032be:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032c1:	5d                   	pop    %rbp
+  8032c2:	c3                   	ret
+
+00000000008032c3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032c3:	55                   	push   %rbp
+  8032c4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032c7:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8032d3:	48 c1 e8 06          	shr    $0x6,%rax
+  8032d7:	83 e0 01             	and    $0x1,%eax
+}
+  8032da:	5d                   	pop    %rbp
+  8032db:	c3                   	ret
+
+00000000008032dc <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8032dc:	55                   	push   %rbp
+  8032dd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032e0:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  8032e7:	00 00 00 
+  8032ea:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8032ec:	48 c1 e8 05          	shr    $0x5,%rax
+  8032f0:	83 e0 01             	and    $0x1,%eax
+}
+  8032f3:	5d                   	pop    %rbp
+  8032f4:	c3                   	ret
+
+00000000008032f5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032f5:	55                   	push   %rbp
+  8032f6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032f9:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+  803305:	83 e0 01             	and    $0x1,%eax
+}
+  803308:	5d                   	pop    %rbp
+  803309:	c3                   	ret
+
+000000000080330a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+  80330e:	41 57                	push   %r15
+  803310:	41 56                	push   %r14
+  803312:	41 55                	push   %r13
+  803314:	41 54                	push   %r12
+  803316:	53                   	push   %rbx
+  803317:	48 83 ec 18          	sub    $0x18,%rsp
+  80331b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80331f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803323:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803328:	49 bd f5 32 80 00 00 	movabs $0x8032f5,%r13
+  80332f:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803332:	49 bf 7d 32 80 00 00 	movabs $0x80327d,%r15
+  803339:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80333c:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803343:	00 00 00 
+  803346:	eb 0c                	jmp    803354 <foreach_shared_region+0x4a>
+  803348:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80334f:	4c 39 f3             	cmp    %r14,%rbx
+  803352:	74 2e                	je     803382 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803354:	48 89 df             	mov    %rbx,%rdi
+  803357:	41 ff d5             	call   *%r13
+  80335a:	84 c0                	test   %al,%al
+  80335c:	74 ea                	je     803348 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80335e:	48 89 df             	mov    %rbx,%rdi
+  803361:	41 ff d7             	call   *%r15
+  803364:	a8 40                	test   $0x40,%al
+  803366:	74 e0                	je     803348 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803368:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80336f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803373:	48 89 df             	mov    %rbx,%rdi
+  803376:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80337a:	ff d0                	call   *%rax
+				if (res < 0) {
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	79 c8                	jns    803348 <foreach_shared_region+0x3e>
+  803380:	eb 05                	jmp    803387 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803382:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803387:	48 83 c4 18          	add    $0x18,%rsp
+  80338b:	5b                   	pop    %rbx
+  80338c:	41 5c                	pop    %r12
+  80338e:	41 5d                	pop    %r13
+  803390:	41 5e                	pop    %r14
+  803392:	41 5f                	pop    %r15
+  803394:	5d                   	pop    %rbp
+  803395:	c3                   	ret
+
+0000000000803396 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339b:	c3                   	ret
+
+000000000080339c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80339c:	55                   	push   %rbp
+  80339d:	48 89 e5             	mov    %rsp,%rbp
+  8033a0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8033a3:	48 be 34 3f 80 00 00 	movabs $0x803f34,%rsi
+  8033aa:	00 00 00 
+  8033ad:	48 b8 c5 0b 80 00 00 	movabs $0x800bc5,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+    return 0;
+}
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033be:	5d                   	pop    %rbp
+  8033bf:	c3                   	ret
+
+00000000008033c0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8033c0:	55                   	push   %rbp
+  8033c1:	48 89 e5             	mov    %rsp,%rbp
+  8033c4:	41 57                	push   %r15
+  8033c6:	41 56                	push   %r14
+  8033c8:	41 55                	push   %r13
+  8033ca:	41 54                	push   %r12
+  8033cc:	53                   	push   %rbx
+  8033cd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8033d4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8033db:	48 85 d2             	test   %rdx,%rdx
+  8033de:	74 7a                	je     80345a <devcons_write+0x9a>
+  8033e0:	49 89 d6             	mov    %rdx,%r14
+  8033e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033e9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8033ee:	49 bf bf 0d 80 00 00 	movabs $0x800dbf,%r15
+  8033f5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8033f8:	4c 89 f3             	mov    %r14,%rbx
+  8033fb:	48 29 f3             	sub    %rsi,%rbx
+  8033fe:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803403:	48 39 c3             	cmp    %rax,%rbx
+  803406:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80340a:	4c 63 eb             	movslq %ebx,%r13
+  80340d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803414:	48 01 c6             	add    %rax,%rsi
+  803417:	4c 89 ea             	mov    %r13,%rdx
+  80341a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803421:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803424:	4c 89 ee             	mov    %r13,%rsi
+  803427:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80342e:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  803435:	00 00 00 
+  803438:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80343a:	41 01 dc             	add    %ebx,%r12d
+  80343d:	49 63 f4             	movslq %r12d,%rsi
+  803440:	4c 39 f6             	cmp    %r14,%rsi
+  803443:	72 b3                	jb     8033f8 <devcons_write+0x38>
+    return res;
+  803445:	49 63 c4             	movslq %r12d,%rax
+}
+  803448:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80344f:	5b                   	pop    %rbx
+  803450:	41 5c                	pop    %r12
+  803452:	41 5d                	pop    %r13
+  803454:	41 5e                	pop    %r14
+  803456:	41 5f                	pop    %r15
+  803458:	5d                   	pop    %rbp
+  803459:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80345a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803460:	eb e3                	jmp    803445 <devcons_write+0x85>
+
+0000000000803462 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803462:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803465:	ba 00 00 00 00       	mov    $0x0,%edx
+  80346a:	48 85 c0             	test   %rax,%rax
+  80346d:	74 55                	je     8034c4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80346f:	55                   	push   %rbp
+  803470:	48 89 e5             	mov    %rsp,%rbp
+  803473:	41 55                	push   %r13
+  803475:	41 54                	push   %r12
+  803477:	53                   	push   %rbx
+  803478:	48 83 ec 08          	sub    $0x8,%rsp
+  80347c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80347f:	48 bb f5 10 80 00 00 	movabs $0x8010f5,%rbx
+  803486:	00 00 00 
+  803489:	49 bc c2 11 80 00 00 	movabs $0x8011c2,%r12
+  803490:	00 00 00 
+  803493:	eb 03                	jmp    803498 <devcons_read+0x36>
+  803495:	41 ff d4             	call   *%r12
+  803498:	ff d3                	call   *%rbx
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	74 f7                	je     803495 <devcons_read+0x33>
+    if (c < 0) return c;
+  80349e:	48 63 d0             	movslq %eax,%rdx
+  8034a1:	78 13                	js     8034b6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8034a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a8:	83 f8 04             	cmp    $0x4,%eax
+  8034ab:	74 09                	je     8034b6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8034ad:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8034b1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8034b6:	48 89 d0             	mov    %rdx,%rax
+  8034b9:	48 83 c4 08          	add    $0x8,%rsp
+  8034bd:	5b                   	pop    %rbx
+  8034be:	41 5c                	pop    %r12
+  8034c0:	41 5d                	pop    %r13
+  8034c2:	5d                   	pop    %rbp
+  8034c3:	c3                   	ret
+  8034c4:	48 89 d0             	mov    %rdx,%rax
+  8034c7:	c3                   	ret
+
+00000000008034c8 <cputchar>:
+cputchar(int ch) {
+  8034c8:	55                   	push   %rbp
+  8034c9:	48 89 e5             	mov    %rsp,%rbp
+  8034cc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8034d0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8034d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8034d9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034dd:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+}
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+00000000008034eb <getchar>:
+getchar(void) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+  8034ef:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8034f3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034f8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8034fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803501:	48 b8 a1 1a 80 00 00 	movabs $0x801aa1,%rax
+  803508:	00 00 00 
+  80350b:	ff d0                	call   *%rax
+  80350d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80350f:	85 c0                	test   %eax,%eax
+  803511:	78 06                	js     803519 <getchar+0x2e>
+  803513:	74 08                	je     80351d <getchar+0x32>
+  803515:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803519:	89 d0                	mov    %edx,%eax
+  80351b:	c9                   	leave
+  80351c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80351d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803522:	eb f5                	jmp    803519 <getchar+0x2e>
+
+0000000000803524 <iscons>:
+iscons(int fdnum) {
+  803524:	55                   	push   %rbp
+  803525:	48 89 e5             	mov    %rsp,%rbp
+  803528:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80352c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803530:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80353c:	85 c0                	test   %eax,%eax
+  80353e:	78 18                	js     803558 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803540:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803544:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80354b:	00 00 00 
+  80354e:	8b 00                	mov    (%rax),%eax
+  803550:	39 02                	cmp    %eax,(%rdx)
+  803552:	0f 94 c0             	sete   %al
+  803555:	0f b6 c0             	movzbl %al,%eax
+}
+  803558:	c9                   	leave
+  803559:	c3                   	ret
+
+000000000080355a <opencons>:
+opencons(void) {
+  80355a:	55                   	push   %rbp
+  80355b:	48 89 e5             	mov    %rsp,%rbp
+  80355e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803562:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803566:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  80356d:	00 00 00 
+  803570:	ff d0                	call   *%rax
+  803572:	85 c0                	test   %eax,%eax
+  803574:	78 49                	js     8035bf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803576:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80357b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803580:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803584:	bf 00 00 00 00       	mov    $0x0,%edi
+  803589:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+  803595:	85 c0                	test   %eax,%eax
+  803597:	78 26                	js     8035bf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803599:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80359d:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8035a4:	00 00 
+  8035a6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8035a8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035ac:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8035b3:	48 b8 30 17 80 00 00 	movabs $0x801730,%rax
+  8035ba:	00 00 00 
+  8035bd:	ff d0                	call   *%rax
+}
+  8035bf:	c9                   	leave
+  8035c0:	c3                   	ret
+
+00000000008035c1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8035c1:	55                   	push   %rbp
+  8035c2:	48 89 e5             	mov    %rsp,%rbp
+  8035c5:	41 56                	push   %r14
+  8035c7:	41 55                	push   %r13
+  8035c9:	41 54                	push   %r12
+  8035cb:	53                   	push   %rbx
+  8035cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8035d0:	49 89 fc             	mov    %rdi,%r12
+  8035d3:	41 89 f5             	mov    %esi,%r13d
+  8035d6:	48 89 d3             	mov    %rdx,%rbx
+  8035d9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8035dd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8035e1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035e5:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8035ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035f4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8035f8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8035fc:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  803603:	00 00 00 
+  803606:	4c 8b 30             	mov    (%rax),%r14
+  803609:	48 b8 91 11 80 00 00 	movabs $0x801191,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+  803615:	89 c6                	mov    %eax,%esi
+  803617:	45 89 e8             	mov    %r13d,%r8d
+  80361a:	4c 89 e1             	mov    %r12,%rcx
+  80361d:	4c 89 f2             	mov    %r14,%rdx
+  803620:	48 bf 40 3f 80 00 00 	movabs $0x803f40,%rdi
+  803627:	00 00 00 
+  80362a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362f:	49 bc a0 02 80 00 00 	movabs $0x8002a0,%r12
+  803636:	00 00 00 
+  803639:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80363c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803640:	48 89 df             	mov    %rbx,%rdi
+  803643:	48 b8 3c 02 80 00 00 	movabs $0x80023c,%rax
+  80364a:	00 00 00 
+  80364d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80364f:	48 bf 8f 38 80 00 00 	movabs $0x80388f,%rdi
+  803656:	00 00 00 
+  803659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803661:	cc                   	int3
+  803662:	eb fd                	jmp    803661 <_panic+0xa0>
+
+0000000000803664 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803664:	55                   	push   %rbp
+  803665:	48 89 e5             	mov    %rsp,%rbp
+  803668:	41 55                	push   %r13
+  80366a:	41 54                	push   %r12
+  80366c:	53                   	push   %rbx
+  80366d:	48 83 ec 08          	sub    $0x8,%rsp
+  803671:	49 89 fc             	mov    %rdi,%r12
+  803674:	48 89 f7             	mov    %rsi,%rdi
+  803677:	48 89 d3             	mov    %rdx,%rbx
+  80367a:	49 89 cd             	mov    %rcx,%r13
+  80367d:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803680:	48 85 f6             	test   %rsi,%rsi
+  803683:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80368a:	00 00 00 
+  80368d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803691:	be 00 10 00 00       	mov    $0x1000,%esi
+  803696:	48 85 db             	test   %rbx,%rbx
+  803699:	74 03                	je     80369e <ipc_recv_timed+0x3a>
+  80369b:	48 8b 33             	mov    (%rbx),%rsi
+  80369e:	48 b8 eb 14 80 00 00 	movabs $0x8014eb,%rax
+  8036a5:	00 00 00 
+  8036a8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	78 75                	js     803723 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8036ae:	4d 85 e4             	test   %r12,%r12
+  8036b1:	74 14                	je     8036c7 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8036b3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8036ba:	00 00 00 
+  8036bd:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8036c3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8036c7:	4d 85 ed             	test   %r13,%r13
+  8036ca:	74 14                	je     8036e0 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8036cc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8036d3:	00 00 00 
+  8036d6:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8036dc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8036e0:	48 85 db             	test   %rbx,%rbx
+  8036e3:	74 23                	je     803708 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8036e5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8036ec:	00 00 00 
+  8036ef:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8036f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036fa:	85 c9                	test   %ecx,%ecx
+  8036fc:	74 07                	je     803705 <ipc_recv_timed+0xa1>
+  8036fe:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803705:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803708:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80370f:	00 00 00 
+  803712:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803718:	48 83 c4 08          	add    $0x8,%rsp
+  80371c:	5b                   	pop    %rbx
+  80371d:	41 5c                	pop    %r12
+  80371f:	41 5d                	pop    %r13
+  803721:	5d                   	pop    %rbp
+  803722:	c3                   	ret
+        if (from_env_store != NULL) {
+  803723:	4d 85 e4             	test   %r12,%r12
+  803726:	74 08                	je     803730 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803728:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80372f:	00 
+        if (perm_store != NULL) {
+  803730:	4d 85 ed             	test   %r13,%r13
+  803733:	74 08                	je     80373d <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803735:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80373c:	00 
+        if (size != NULL) {
+  80373d:	48 85 db             	test   %rbx,%rbx
+  803740:	74 d6                	je     803718 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803742:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803749:	eb cd                	jmp    803718 <ipc_recv_timed+0xb4>
+
+000000000080374b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80374b:	55                   	push   %rbp
+  80374c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80374f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803755:	48 b8 64 36 80 00 00 	movabs $0x803664,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+}
+  803761:	5d                   	pop    %rbp
+  803762:	c3                   	ret
+
+0000000000803763 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803763:	55                   	push   %rbp
+  803764:	48 89 e5             	mov    %rsp,%rbp
+  803767:	41 57                	push   %r15
+  803769:	41 56                	push   %r14
+  80376b:	41 55                	push   %r13
+  80376d:	41 54                	push   %r12
+  80376f:	53                   	push   %rbx
+  803770:	48 83 ec 18          	sub    $0x18,%rsp
+  803774:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803777:	48 89 d3             	mov    %rdx,%rbx
+  80377a:	49 89 cc             	mov    %rcx,%r12
+  80377d:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803780:	48 85 d2             	test   %rdx,%rdx
+  803783:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80378a:	00 00 00 
+  80378d:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803791:	89 f0                	mov    %esi,%eax
+  803793:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803797:	48 89 da             	mov    %rbx,%rdx
+  80379a:	48 89 c6             	mov    %rax,%rsi
+  80379d:	48 b8 bf 14 80 00 00 	movabs $0x8014bf,%rax
+  8037a4:	00 00 00 
+  8037a7:	ff d0                	call   *%rax
+    while (res < 0) {
+  8037a9:	85 c0                	test   %eax,%eax
+  8037ab:	79 65                	jns    803812 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8037ad:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8037b0:	75 33                	jne    8037e5 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8037b2:	49 bf c2 11 80 00 00 	movabs $0x8011c2,%r15
+  8037b9:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8037bc:	49 be bf 14 80 00 00 	movabs $0x8014bf,%r14
+  8037c3:	00 00 00 
+        sys_yield();
+  8037c6:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8037c9:	45 89 e8             	mov    %r13d,%r8d
+  8037cc:	4c 89 e1             	mov    %r12,%rcx
+  8037cf:	48 89 da             	mov    %rbx,%rdx
+  8037d2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8037d6:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8037d9:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	79 32                	jns    803812 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8037e0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8037e3:	74 e1                	je     8037c6 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8037e5:	89 c1                	mov    %eax,%ecx
+  8037e7:	48 ba 63 3f 80 00 00 	movabs $0x803f63,%rdx
+  8037ee:	00 00 00 
+  8037f1:	be 52 00 00 00       	mov    $0x52,%esi
+  8037f6:	48 bf 77 3f 80 00 00 	movabs $0x803f77,%rdi
+  8037fd:	00 00 00 
+  803800:	b8 00 00 00 00       	mov    $0x0,%eax
+  803805:	49 b8 c1 35 80 00 00 	movabs $0x8035c1,%r8
+  80380c:	00 00 00 
+  80380f:	41 ff d0             	call   *%r8
+    }
+}
+  803812:	48 83 c4 18          	add    $0x18,%rsp
+  803816:	5b                   	pop    %rbx
+  803817:	41 5c                	pop    %r12
+  803819:	41 5d                	pop    %r13
+  80381b:	41 5e                	pop    %r14
+  80381d:	41 5f                	pop    %r15
+  80381f:	5d                   	pop    %rbp
+  803820:	c3                   	ret
+
+0000000000803821 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803821:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803826:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80382d:	00 00 00 
+  803830:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803834:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803838:	48 c1 e2 04          	shl    $0x4,%rdx
+  80383c:	48 01 ca             	add    %rcx,%rdx
+  80383f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803845:	39 fa                	cmp    %edi,%edx
+  803847:	74 12                	je     80385b <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803849:	48 83 c0 01          	add    $0x1,%rax
+  80384d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803853:	75 db                	jne    803830 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80385a:	c3                   	ret
+            return envs[i].env_id;
+  80385b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80385f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803863:	48 c1 e2 04          	shl    $0x4,%rdx
+  803867:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80386e:	00 00 00 
+  803871:	48 01 d0             	add    %rdx,%rax
+  803874:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80387a:	c3                   	ret
+  80387b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803880 <__rodata_start>:
+  803880:	25 30 34 78 3a       	and    $0x3a783430,%eax
+  803885:	20 49 20             	and    %cl,0x20(%rcx)
+  803888:	61                   	(bad)
+  803889:	6d                   	insl   (%dx),%es:(%rdi)
+  80388a:	20 27                	and    %ah,(%rdi)
+  80388c:	25 73 27 0a 00       	and    $0xa2773,%eax
+  803891:	25 73 25 63 00       	and    $0x632573,%eax
+  803896:	3c 75                	cmp    $0x75,%al
+  803898:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803899:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80389d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80389e:	3e 00 30             	ds add %dh,(%rax)
+  8038a1:	31 32                	xor    %esi,(%rdx)
+  8038a3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038aa:	41                   	rex.B
+  8038ab:	42                   	rex.X
+  8038ac:	43                   	rex.XB
+  8038ad:	44                   	rex.R
+  8038ae:	45                   	rex.RB
+  8038af:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038b2:	31 32                	xor    %esi,(%rdx)
+  8038b4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038bb:	61                   	(bad)
+  8038bc:	62 63 64 65 66       	(bad)
+  8038c1:	00 28                	add    %ch,(%rax)
+  8038c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c4:	75 6c                	jne    803932 <__rodata_start+0xb2>
+  8038c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8038c7:	29 00                	sub    %eax,(%rax)
+  8038c9:	65 72 72             	gs jb  80393e <__rodata_start+0xbe>
+  8038cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038cd:	72 20                	jb     8038ef <__rodata_start+0x6f>
+  8038cf:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038d4:	73 70                	jae    803946 <__rodata_start+0xc6>
+  8038d6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038da:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8038e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038e2:	72 00                	jb     8038e4 <__rodata_start+0x64>
+  8038e4:	62 61 64 20 65       	(bad)
+  8038e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038ea:	76 69                	jbe    803955 <__rodata_start+0xd5>
+  8038ec:	72 6f                	jb     80395d <__rodata_start+0xdd>
+  8038ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038ef:	6d                   	insl   (%dx),%es:(%rdi)
+  8038f0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038f2:	74 00                	je     8038f4 <__rodata_start+0x74>
+  8038f4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038fb:	20 70 61             	and    %dh,0x61(%rax)
+  8038fe:	72 61                	jb     803961 <__rodata_start+0xe1>
+  803900:	6d                   	insl   (%dx),%es:(%rdi)
+  803901:	65 74 65             	gs je  803969 <__rodata_start+0xe9>
+  803904:	72 00                	jb     803906 <__rodata_start+0x86>
+  803906:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803907:	75 74                	jne    80397d <__rodata_start+0xfd>
+  803909:	20 6f 66             	and    %ch,0x66(%rdi)
+  80390c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80390f:	6d                   	insl   (%dx),%es:(%rdi)
+  803910:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803911:	72 79                	jb     80398c <__rodata_start+0x10c>
+  803913:	00 6f 75             	add    %ch,0x75(%rdi)
+  803916:	74 20                	je     803938 <__rodata_start+0xb8>
+  803918:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803919:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80391d:	76 69                	jbe    803988 <__rodata_start+0x108>
+  80391f:	72 6f                	jb     803990 <__rodata_start+0x110>
+  803921:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803922:	6d                   	insl   (%dx),%es:(%rdi)
+  803923:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803925:	74 73                	je     80399a <__rodata_start+0x11a>
+  803927:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80392a:	72 72                	jb     80399e <__rodata_start+0x11e>
+  80392c:	75 70                	jne    80399e <__rodata_start+0x11e>
+  80392e:	74 65                	je     803995 <__rodata_start+0x115>
+  803930:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803935:	75 67                	jne    80399e <__rodata_start+0x11e>
+  803937:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80393a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80393c:	00 73 65             	add    %dh,0x65(%rbx)
+  80393f:	67 6d                	insl   (%dx),%es:(%edi)
+  803941:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803943:	74 61                	je     8039a6 <__rodata_start+0x126>
+  803945:	74 69                	je     8039b0 <__rodata_start+0x130>
+  803947:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803948:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803949:	20 66 61             	and    %ah,0x61(%rsi)
+  80394c:	75 6c                	jne    8039ba <__rodata_start+0x13a>
+  80394e:	74 00                	je     803950 <__rodata_start+0xd0>
+  803950:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803957:	20 45 4c             	and    %al,0x4c(%rbp)
+  80395a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80395e:	61                   	(bad)
+  80395f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803964:	20 73 75             	and    %dh,0x75(%rbx)
+  803967:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80396a:	73 79                	jae    8039e5 <__rodata_start+0x165>
+  80396c:	73 74                	jae    8039e2 <__rodata_start+0x162>
+  80396e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803970:	20 63 61             	and    %ah,0x61(%rbx)
+  803973:	6c                   	insb   (%dx),%es:(%rdi)
+  803974:	6c                   	insb   (%dx),%es:(%rdi)
+  803975:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803978:	74 72                	je     8039ec <__rodata_start+0x16c>
+  80397a:	79 20                	jns    80399c <__rodata_start+0x11c>
+  80397c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80397d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80397e:	74 20                	je     8039a0 <__rodata_start+0x120>
+  803980:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803982:	75 6e                	jne    8039f2 <__rodata_start+0x172>
+  803984:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803988:	76 20                	jbe    8039aa <__rodata_start+0x12a>
+  80398a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803991:	72 65                	jb     8039f8 <__rodata_start+0x178>
+  803993:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803996:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803997:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80399b:	65 78 70             	gs js  803a0e <__rodata_start+0x18e>
+  80399e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8039a3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8039a6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8039aa:	20 66 69             	and    %ah,0x69(%rsi)
+  8039ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ae:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039b2:	20 66 72             	and    %ah,0x72(%rsi)
+  8039b5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039ba:	61                   	(bad)
+  8039bb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039be:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c0:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8039c4:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c9:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039cd:	79 20                	jns    8039ef <__rodata_start+0x16f>
+  8039cf:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039d6:	72 65                	jb     803a3d <__rodata_start+0x1bd>
+  8039d8:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039db:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039dd:	00 66 69             	add    %ah,0x69(%rsi)
+  8039e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8039e1:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8039e5:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8039e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e9:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8039ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ed:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ee:	74 20                	je     803a10 <__rodata_start+0x190>
+  8039f0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039f2:	75 6e                	jne    803a62 <__rodata_start+0x1e2>
+  8039f4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8039f8:	76 61                	jbe    803a5b <__rodata_start+0x1db>
+  8039fa:	6c                   	insb   (%dx),%es:(%rdi)
+  8039fb:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a02:	00 
+  803a03:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a0a:	72 65                	jb     803a71 <__rodata_start+0x1f1>
+  803a0c:	61                   	(bad)
+  803a0d:	64 79 20             	fs jns 803a30 <__rodata_start+0x1b0>
+  803a10:	65 78 69             	gs js  803a7c <__rodata_start+0x1fc>
+  803a13:	73 74                	jae    803a89 <__rodata_start+0x209>
+  803a15:	73 00                	jae    803a17 <__rodata_start+0x197>
+  803a17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a18:	70 65                	jo     803a7f <__rodata_start+0x1ff>
+  803a1a:	72 61                	jb     803a7d <__rodata_start+0x1fd>
+  803a1c:	74 69                	je     803a87 <__rodata_start+0x207>
+  803a1e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a20:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a23:	74 20                	je     803a45 <__rodata_start+0x1c5>
+  803a25:	73 75                	jae    803a9c <__rodata_start+0x21c>
+  803a27:	70 70                	jo     803a99 <__rodata_start+0x219>
+  803a29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a2a:	72 74                	jb     803aa0 <__rodata_start+0x220>
+  803a2c:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a32:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a37:	74 00                	je     803a39 <__rodata_start+0x1b9>
+  803a39:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  803a40:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  803a43:	00 00                	add    %al,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 ce                	add    %cl,%dh
+  803a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a4f:	00 be 0a 80 00 00    	add    %bh,0x800a(%rsi)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 ce                	add    %cl,%dh
+  803a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a5f:	00 ce                	add    %cl,%dh
+  803a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a67:	00 ce                	add    %cl,%dh
+  803a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a6f:	00 ce                	add    %cl,%dh
+  803a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a77:	00 ac 04 80 00 00 00 	add    %ch,0x80(%rsp,%rax,1)
+  803a7e:	00 00                	add    %al,(%rax)
+  803a80:	ce                   	(bad)
+  803a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a87:	00 ce                	add    %cl,%dh
+  803a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a8f:	00 a0 04 80 00 00    	add    %ah,0x8004(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 1a                	add    %bl,(%rdx)
+  803a99:	05 80 00 00 00       	add    $0x80,%eax
+  803a9e:	00 00                	add    %al,(%rax)
+  803aa0:	ce                   	(bad)
+  803aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aa7:	00 a0 04 80 00 00    	add    %ah,0x8004(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 e6                	add    %ah,%dh
+  803ab1:	04 80                	add    $0x80,%al
+  803ab3:	00 00                	add    %al,(%rax)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 e6                	add    %ah,%dh
+  803ab9:	04 80                	add    $0x80,%al
+  803abb:	00 00                	add    %al,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 e6                	add    %ah,%dh
+  803ac1:	04 80                	add    $0x80,%al
+  803ac3:	00 00                	add    %al,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 e6                	add    %ah,%dh
+  803ac9:	04 80                	add    $0x80,%al
+  803acb:	00 00                	add    %al,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 e6                	add    %ah,%dh
+  803ad1:	04 80                	add    $0x80,%al
+  803ad3:	00 00                	add    %al,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 e6                	add    %ah,%dh
+  803ad9:	04 80                	add    $0x80,%al
+  803adb:	00 00                	add    %al,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 e6                	add    %ah,%dh
+  803ae1:	04 80                	add    $0x80,%al
+  803ae3:	00 00                	add    %al,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 e6                	add    %ah,%dh
+  803ae9:	04 80                	add    $0x80,%al
+  803aeb:	00 00                	add    %al,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 e6                	add    %ah,%dh
+  803af1:	04 80                	add    $0x80,%al
+  803af3:	00 00                	add    %al,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 ce                	add    %cl,%dh
+  803af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aff:	00 ce                	add    %cl,%dh
+  803b01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b07:	00 ce                	add    %cl,%dh
+  803b09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b0f:	00 ce                	add    %cl,%dh
+  803b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b17:	00 ce                	add    %cl,%dh
+  803b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b1f:	00 ce                	add    %cl,%dh
+  803b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b27:	00 ce                	add    %cl,%dh
+  803b29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b2f:	00 ce                	add    %cl,%dh
+  803b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b37:	00 ce                	add    %cl,%dh
+  803b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b3f:	00 ce                	add    %cl,%dh
+  803b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b47:	00 ce                	add    %cl,%dh
+  803b49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b4f:	00 ce                	add    %cl,%dh
+  803b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b57:	00 ce                	add    %cl,%dh
+  803b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b5f:	00 ce                	add    %cl,%dh
+  803b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b67:	00 ce                	add    %cl,%dh
+  803b69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b6f:	00 ce                	add    %cl,%dh
+  803b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b77:	00 ce                	add    %cl,%dh
+  803b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b7f:	00 ce                	add    %cl,%dh
+  803b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b87:	00 ce                	add    %cl,%dh
+  803b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b8f:	00 ce                	add    %cl,%dh
+  803b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b97:	00 ce                	add    %cl,%dh
+  803b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b9f:	00 ce                	add    %cl,%dh
+  803ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ba7:	00 ce                	add    %cl,%dh
+  803ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803baf:	00 ce                	add    %cl,%dh
+  803bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bb7:	00 ce                	add    %cl,%dh
+  803bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bbf:	00 ce                	add    %cl,%dh
+  803bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bc7:	00 ce                	add    %cl,%dh
+  803bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bcf:	00 ce                	add    %cl,%dh
+  803bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bd7:	00 ce                	add    %cl,%dh
+  803bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bdf:	00 ce                	add    %cl,%dh
+  803be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803be7:	00 f1                	add    %dh,%cl
+  803be9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803bef:	00 ce                	add    %cl,%dh
+  803bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bf7:	00 ce                	add    %cl,%dh
+  803bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bff:	00 ce                	add    %cl,%dh
+  803c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c07:	00 ce                	add    %cl,%dh
+  803c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c0f:	00 ce                	add    %cl,%dh
+  803c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c17:	00 ce                	add    %cl,%dh
+  803c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c1f:	00 ce                	add    %cl,%dh
+  803c21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c27:	00 ce                	add    %cl,%dh
+  803c29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c2f:	00 ce                	add    %cl,%dh
+  803c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c37:	00 ce                	add    %cl,%dh
+  803c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c3f:	00 3d 05 80 00 00    	add    %bh,0x8005(%rip)        # 80bc4a <__bss_end+0x3c4a>
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 0c 07             	add    %cl,(%rdi,%rax,1)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 ce                	add    %cl,%dh
+  803c51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c57:	00 ce                	add    %cl,%dh
+  803c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c5f:	00 ce                	add    %cl,%dh
+  803c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c67:	00 ce                	add    %cl,%dh
+  803c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c6f:	00 6c 05 80          	add    %ch,-0x80(%rbp,%rax,1)
+  803c73:	00 00                	add    %al,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 ce                	add    %cl,%dh
+  803c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c7f:	00 ce                	add    %cl,%dh
+  803c81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c87:	00 32                	add    %dh,(%rdx)
+  803c89:	05 80 00 00 00       	add    $0x80,%eax
+  803c8e:	00 00                	add    %al,(%rax)
+  803c90:	ce                   	(bad)
+  803c91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c97:	00 ce                	add    %cl,%dh
+  803c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c9f:	00 b4 08 80 00 00 00 	add    %dh,0x80(%rax,%rcx,1)
+  803ca6:	00 00                	add    %al,(%rax)
+  803ca8:	7e 09                	jle    803cb3 <__rodata_start+0x433>
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 ce                	add    %cl,%dh
+  803cb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cb7:	00 ce                	add    %cl,%dh
+  803cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cbf:	00 03                	add    %al,(%rbx)
+  803cc1:	06                   	(bad)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 ce                	add    %cl,%dh
+  803cc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ccf:	00 e0                	add    %ah,%al
+  803cd1:	07                   	(bad)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 ce                	add    %cl,%dh
+  803cd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cdf:	00 ce                	add    %cl,%dh
+  803ce1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ce7:	00 f1                	add    %dh,%cl
+  803ce9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803cef:	00 ce                	add    %cl,%dh
+  803cf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cf7:	00 96 04 80 00 00    	add    %dl,0x8004(%rsi)
+  803cfd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d00 <error_string>:
+	...
+  803d08:	d2 38 80 00 00 00 00 00 e4 38 80 00 00 00 00 00     .8.......8......
+  803d18:	f4 38 80 00 00 00 00 00 06 39 80 00 00 00 00 00     .8.......9......
+  803d28:	14 39 80 00 00 00 00 00 28 39 80 00 00 00 00 00     .9......(9......
+  803d38:	3d 39 80 00 00 00 00 00 50 39 80 00 00 00 00 00     =9......P9......
+  803d48:	62 39 80 00 00 00 00 00 76 39 80 00 00 00 00 00     b9......v9......
+  803d58:	86 39 80 00 00 00 00 00 99 39 80 00 00 00 00 00     .9.......9......
+  803d68:	b0 39 80 00 00 00 00 00 c6 39 80 00 00 00 00 00     .9.......9......
+  803d78:	de 39 80 00 00 00 00 00 f6 39 80 00 00 00 00 00     .9.......9......
+  803d88:	03 3a 80 00 00 00 00 00 a8 3d 80 00 00 00 00 00     .:.......=......
+  803d98:	17 3a 80 00 00 00 00 00 2f 3a 80 00 00 00 00 00     .:....../:......
+  803da8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803db8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803dc8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803dd8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803de8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803df8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803e08:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803e18:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803e28:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803e38:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803e48:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803e58:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803e68:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803e78:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803e88:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803e98:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803ea8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803eb8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803ec0 <devtab>:
+  803ec0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803ed0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803ee0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803ef0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803f00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803f10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803f20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803f30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803f50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803f60:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803f70:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
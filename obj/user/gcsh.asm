@@ -0,0 +1,6972 @@
+
+obj/user/gcsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 d4 00 00 00       	call   8000f7 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+
+    if (argc > 1) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 38                	jg     800073 <umain+0x4e>
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    int res = gc_snapshots();
+  80003b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800040:	48 ba f9 1e 80 00 00 	movabs $0x801ef9,%rdx
+  800047:	00 00 00 
+  80004a:	ff d2                	call   *%rdx
+  80004c:	89 c6                	mov    %eax,%esi
+
+    if (res < 0) {
+  80004e:	85 c0                	test   %eax,%eax
+  800050:	0f 88 84 00 00 00    	js     8000da <umain+0xb5>
+        cprintf("Snapshot garbage collection failed: %i\n", res);
+    } else {
+        cprintf("reclaimed %d bytes on disk\n", res);
+  800056:	48 bf d0 37 80 00 00 	movabs $0x8037d0,%rdi
+  80005d:	00 00 00 
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	48 ba 75 02 80 00 00 	movabs $0x800275,%rdx
+  80006c:	00 00 00 
+  80006f:	ff d2                	call   *%rdx
+  800071:	eb 58                	jmp    8000cb <umain+0xa6>
+  800073:	41 89 fc             	mov    %edi,%r12d
+  800076:	49 89 f5             	mov    %rsi,%r13
+        cprintf("Too much arguments for snapshot garbage collection\n");
+  800079:	48 bf 48 37 80 00 00 	movabs $0x803748,%rdi
+  800080:	00 00 00 
+  800083:	b8 00 00 00 00       	mov    $0x0,%eax
+  800088:	48 ba 75 02 80 00 00 	movabs $0x800275,%rdx
+  80008f:	00 00 00 
+  800092:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  800094:	4d 63 e4             	movslq %r12d,%r12
+        cprintf("Too much arguments for snapshot garbage collection\n");
+  800097:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  80009c:	49 bf 80 37 80 00 00 	movabs $0x803780,%r15
+  8000a3:	00 00 00 
+  8000a6:	49 be 75 02 80 00 00 	movabs $0x800275,%r14
+  8000ad:	00 00 00 
+  8000b0:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  8000b5:	89 de                	mov    %ebx,%esi
+  8000b7:	4c 89 ff             	mov    %r15,%rdi
+  8000ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bf:	41 ff d6             	call   *%r14
+        for(int i = 0; i < argc; ++i) {
+  8000c2:	48 83 c3 01          	add    $0x1,%rbx
+  8000c6:	4c 39 e3             	cmp    %r12,%rbx
+  8000c9:	75 e5                	jne    8000b0 <umain+0x8b>
+    }
+
+    return;
+}
+  8000cb:	48 83 c4 08          	add    $0x8,%rsp
+  8000cf:	5b                   	pop    %rbx
+  8000d0:	41 5c                	pop    %r12
+  8000d2:	41 5d                	pop    %r13
+  8000d4:	41 5e                	pop    %r14
+  8000d6:	41 5f                	pop    %r15
+  8000d8:	5d                   	pop    %rbp
+  8000d9:	c3                   	ret
+        cprintf("Snapshot garbage collection failed: %i\n", res);
+  8000da:	48 bf a8 37 80 00 00 	movabs $0x8037a8,%rdi
+  8000e1:	00 00 00 
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	48 ba 75 02 80 00 00 	movabs $0x800275,%rdx
+  8000f0:	00 00 00 
+  8000f3:	ff d2                	call   *%rdx
+  8000f5:	eb d4                	jmp    8000cb <umain+0xa6>
+
+00000000008000f7 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000f7:	55                   	push   %rbp
+  8000f8:	48 89 e5             	mov    %rsp,%rbp
+  8000fb:	41 56                	push   %r14
+  8000fd:	41 55                	push   %r13
+  8000ff:	41 54                	push   %r12
+  800101:	53                   	push   %rbx
+  800102:	41 89 fd             	mov    %edi,%r13d
+  800105:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800108:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80010f:	00 00 00 
+  800112:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800119:	00 00 00 
+  80011c:	48 39 c2             	cmp    %rax,%rdx
+  80011f:	73 17                	jae    800138 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800121:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800124:	49 89 c4             	mov    %rax,%r12
+  800127:	48 83 c3 08          	add    $0x8,%rbx
+  80012b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800130:	ff 53 f8             	call   *-0x8(%rbx)
+  800133:	4c 39 e3             	cmp    %r12,%rbx
+  800136:	72 ef                	jb     800127 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800138:	48 b8 66 11 80 00 00 	movabs $0x801166,%rax
+  80013f:	00 00 00 
+  800142:	ff d0                	call   *%rax
+  800144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800149:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80014d:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800151:	48 c1 e0 04          	shl    $0x4,%rax
+  800155:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80015c:	00 00 00 
+  80015f:	48 01 d0             	add    %rdx,%rax
+  800162:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800169:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80016c:	45 85 ed             	test   %r13d,%r13d
+  80016f:	7e 0d                	jle    80017e <libmain+0x87>
+  800171:	49 8b 06             	mov    (%r14),%rax
+  800174:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80017b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80017e:	4c 89 f6             	mov    %r14,%rsi
+  800181:	44 89 ef             	mov    %r13d,%edi
+  800184:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80018b:	00 00 00 
+  80018e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800190:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+#endif
+}
+  80019c:	5b                   	pop    %rbx
+  80019d:	41 5c                	pop    %r12
+  80019f:	41 5d                	pop    %r13
+  8001a1:	41 5e                	pop    %r14
+  8001a3:	5d                   	pop    %rbp
+  8001a4:	c3                   	ret
+
+00000000008001a5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001a5:	55                   	push   %rbp
+  8001a6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001a9:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ba:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+}
+  8001c6:	5d                   	pop    %rbp
+  8001c7:	c3                   	ret
+
+00000000008001c8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001c8:	55                   	push   %rbp
+  8001c9:	48 89 e5             	mov    %rsp,%rbp
+  8001cc:	53                   	push   %rbx
+  8001cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8001d1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001d4:	8b 06                	mov    (%rsi),%eax
+  8001d6:	8d 50 01             	lea    0x1(%rax),%edx
+  8001d9:	89 16                	mov    %edx,(%rsi)
+  8001db:	48 98                	cltq
+  8001dd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001e2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001e8:	74 0a                	je     8001f4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001ea:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001f4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001f8:	be ff 00 00 00       	mov    $0xff,%esi
+  8001fd:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+        state->offset = 0;
+  800209:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80020f:	eb d9                	jmp    8001ea <putch+0x22>
+
+0000000000800211 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800211:	55                   	push   %rbp
+  800212:	48 89 e5             	mov    %rsp,%rbp
+  800215:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80021c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80021f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800226:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80022b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800230:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800233:	48 89 f1             	mov    %rsi,%rcx
+  800236:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80023d:	48 bf c8 01 80 00 00 	movabs $0x8001c8,%rdi
+  800244:	00 00 00 
+  800247:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800253:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80025a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800261:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  800268:	00 00 00 
+  80026b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80026d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+0000000000800275 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+  800279:	48 83 ec 50          	sub    $0x50,%rsp
+  80027d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800281:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800285:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800289:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80028d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800291:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800298:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002a0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002a8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002ac:	48 b8 11 02 80 00 00 	movabs $0x800211,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+00000000008002ba <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002ba:	55                   	push   %rbp
+  8002bb:	48 89 e5             	mov    %rsp,%rbp
+  8002be:	41 57                	push   %r15
+  8002c0:	41 56                	push   %r14
+  8002c2:	41 55                	push   %r13
+  8002c4:	41 54                	push   %r12
+  8002c6:	53                   	push   %rbx
+  8002c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8002cb:	49 89 fc             	mov    %rdi,%r12
+  8002ce:	49 89 f5             	mov    %rsi,%r13
+  8002d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002d8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002db:	41 89 cf             	mov    %ecx,%r15d
+  8002de:	4c 39 fa             	cmp    %r15,%rdx
+  8002e1:	73 5b                	jae    80033e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002e3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002e7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002eb:	85 db                	test   %ebx,%ebx
+  8002ed:	7e 0e                	jle    8002fd <print_num+0x43>
+            putch(padc, put_arg);
+  8002ef:	4c 89 ee             	mov    %r13,%rsi
+  8002f2:	44 89 f7             	mov    %r14d,%edi
+  8002f5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002f8:	83 eb 01             	sub    $0x1,%ebx
+  8002fb:	75 f2                	jne    8002ef <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002fd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800301:	48 b9 07 38 80 00 00 	movabs $0x803807,%rcx
+  800308:	00 00 00 
+  80030b:	48 b8 f6 37 80 00 00 	movabs $0x8037f6,%rax
+  800312:	00 00 00 
+  800315:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800319:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80031d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800322:	49 f7 f7             	div    %r15
+  800325:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800329:	4c 89 ee             	mov    %r13,%rsi
+  80032c:	41 ff d4             	call   *%r12
+}
+  80032f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800333:	5b                   	pop    %rbx
+  800334:	41 5c                	pop    %r12
+  800336:	41 5d                	pop    %r13
+  800338:	41 5e                	pop    %r14
+  80033a:	41 5f                	pop    %r15
+  80033c:	5d                   	pop    %rbp
+  80033d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80033e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800342:	ba 00 00 00 00       	mov    $0x0,%edx
+  800347:	49 f7 f7             	div    %r15
+  80034a:	48 83 ec 08          	sub    $0x8,%rsp
+  80034e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800352:	52                   	push   %rdx
+  800353:	45 0f be c9          	movsbl %r9b,%r9d
+  800357:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80035b:	48 89 c2             	mov    %rax,%rdx
+  80035e:	48 b8 ba 02 80 00 00 	movabs $0x8002ba,%rax
+  800365:	00 00 00 
+  800368:	ff d0                	call   *%rax
+  80036a:	48 83 c4 10          	add    $0x10,%rsp
+  80036e:	eb 8d                	jmp    8002fd <print_num+0x43>
+
+0000000000800370 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800370:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800374:	48 8b 06             	mov    (%rsi),%rax
+  800377:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80037b:	73 0a                	jae    800387 <sprintputch+0x17>
+        *state->start++ = ch;
+  80037d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800381:	48 89 16             	mov    %rdx,(%rsi)
+  800384:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800387:	c3                   	ret
+
+0000000000800388 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800388:	55                   	push   %rbp
+  800389:	48 89 e5             	mov    %rsp,%rbp
+  80038c:	48 83 ec 50          	sub    $0x50,%rsp
+  800390:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800394:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800398:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80039c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003b3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003b7:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  8003be:	00 00 00 
+  8003c1:	ff d0                	call   *%rax
+}
+  8003c3:	c9                   	leave
+  8003c4:	c3                   	ret
+
+00000000008003c5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003c5:	55                   	push   %rbp
+  8003c6:	48 89 e5             	mov    %rsp,%rbp
+  8003c9:	41 57                	push   %r15
+  8003cb:	41 56                	push   %r14
+  8003cd:	41 55                	push   %r13
+  8003cf:	41 54                	push   %r12
+  8003d1:	53                   	push   %rbx
+  8003d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8003d6:	49 89 fe             	mov    %rdi,%r14
+  8003d9:	49 89 f5             	mov    %rsi,%r13
+  8003dc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003df:	48 8b 01             	mov    (%rcx),%rax
+  8003e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003e6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ee:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003f6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003fa:	0f b6 3b             	movzbl (%rbx),%edi
+  8003fd:	40 80 ff 25          	cmp    $0x25,%dil
+  800401:	74 18                	je     80041b <vprintfmt+0x56>
+            if (!ch) return;
+  800403:	40 84 ff             	test   %dil,%dil
+  800406:	0f 84 b1 06 00 00    	je     800abd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80040c:	40 0f b6 ff          	movzbl %dil,%edi
+  800410:	4c 89 ee             	mov    %r13,%rsi
+  800413:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800416:	4c 89 e3             	mov    %r12,%rbx
+  800419:	eb db                	jmp    8003f6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80041b:	be 00 00 00 00       	mov    $0x0,%esi
+  800420:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800424:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800429:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80042f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800436:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80043a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80043f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800444:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800447:	83 e8 23             	sub    $0x23,%eax
+  80044a:	3c 57                	cmp    $0x57,%al
+  80044c:	0f 87 51 06 00 00    	ja     800aa3 <vprintfmt+0x6de>
+  800452:	0f b6 c0             	movzbl %al,%eax
+  800455:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  80045c:	00 00 00 
+  80045f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800462:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800465:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800469:	eb cf                	jmp    80043a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80046b:	49 89 dc             	mov    %rbx,%r12
+  80046e:	be 01 00 00 00       	mov    $0x1,%esi
+  800473:	eb c5                	jmp    80043a <vprintfmt+0x75>
+            padc = ch;
+  800475:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800479:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80047c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80047f:	eb b9                	jmp    80043a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800481:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800484:	83 f8 2f             	cmp    $0x2f,%eax
+  800487:	77 24                	ja     8004ad <vprintfmt+0xe8>
+  800489:	89 c1                	mov    %eax,%ecx
+  80048b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80048f:	83 c0 08             	add    $0x8,%eax
+  800492:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800495:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800498:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80049b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80049f:	79 99                	jns    80043a <vprintfmt+0x75>
+                width = precision;
+  8004a1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ab:	eb 8d                	jmp    80043a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004b1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b9:	eb da                	jmp    800495 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004bb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004c0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004ca:	3c 39                	cmp    $0x39,%al
+  8004cc:	77 1c                	ja     8004ea <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004ce:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004d2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004d6:	0f b6 c0             	movzbl %al,%eax
+  8004d9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004de:	0f b6 03             	movzbl (%rbx),%eax
+  8004e1:	3c 39                	cmp    $0x39,%al
+  8004e3:	76 e9                	jbe    8004ce <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004e5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004e8:	eb b1                	jmp    80049b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004ea:	49 89 dc             	mov    %rbx,%r12
+  8004ed:	eb ac                	jmp    80049b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004ef:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004f2:	85 c9                	test   %ecx,%ecx
+  8004f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f9:	0f 49 c1             	cmovns %ecx,%eax
+  8004fc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800502:	e9 33 ff ff ff       	jmp    80043a <vprintfmt+0x75>
+            lflag++;
+  800507:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80050a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80050d:	e9 28 ff ff ff       	jmp    80043a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800512:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800515:	83 f8 2f             	cmp    $0x2f,%eax
+  800518:	77 19                	ja     800533 <vprintfmt+0x16e>
+  80051a:	89 c2                	mov    %eax,%edx
+  80051c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800520:	83 c0 08             	add    $0x8,%eax
+  800523:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800526:	8b 3a                	mov    (%rdx),%edi
+  800528:	4c 89 ee             	mov    %r13,%rsi
+  80052b:	41 ff d6             	call   *%r14
+            break;
+  80052e:	e9 c3 fe ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800533:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800537:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80053b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053f:	eb e5                	jmp    800526 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800541:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800544:	83 f8 2f             	cmp    $0x2f,%eax
+  800547:	77 5a                	ja     8005a3 <vprintfmt+0x1de>
+  800549:	89 c2                	mov    %eax,%edx
+  80054b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054f:	83 c0 08             	add    $0x8,%eax
+  800552:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800555:	8b 02                	mov    (%rdx),%eax
+  800557:	89 c1                	mov    %eax,%ecx
+  800559:	f7 d9                	neg    %ecx
+  80055b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80055e:	83 f9 14             	cmp    $0x14,%ecx
+  800561:	7f 4e                	jg     8005b1 <vprintfmt+0x1ec>
+  800563:	48 63 c1             	movslq %ecx,%rax
+  800566:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  80056d:	00 00 00 
+  800570:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800574:	48 85 c0             	test   %rax,%rax
+  800577:	74 38                	je     8005b1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800579:	48 89 c1             	mov    %rax,%rcx
+  80057c:	48 ba 39 3e 80 00 00 	movabs $0x803e39,%rdx
+  800583:	00 00 00 
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	4c 89 f7             	mov    %r14,%rdi
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	49 b8 88 03 80 00 00 	movabs $0x800388,%r8
+  800598:	00 00 00 
+  80059b:	41 ff d0             	call   *%r8
+  80059e:	e9 53 fe ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005af:	eb a4                	jmp    800555 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005b1:	48 ba 1f 38 80 00 00 	movabs $0x80381f,%rdx
+  8005b8:	00 00 00 
+  8005bb:	4c 89 ee             	mov    %r13,%rsi
+  8005be:	4c 89 f7             	mov    %r14,%rdi
+  8005c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c6:	49 b8 88 03 80 00 00 	movabs $0x800388,%r8
+  8005cd:	00 00 00 
+  8005d0:	41 ff d0             	call   *%r8
+  8005d3:	e9 1e fe ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005db:	83 f8 2f             	cmp    $0x2f,%eax
+  8005de:	77 6c                	ja     80064c <vprintfmt+0x287>
+  8005e0:	89 c2                	mov    %eax,%edx
+  8005e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e6:	83 c0 08             	add    $0x8,%eax
+  8005e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ec:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005ef:	48 85 d2             	test   %rdx,%rdx
+  8005f2:	48 b8 18 38 80 00 00 	movabs $0x803818,%rax
+  8005f9:	00 00 00 
+  8005fc:	48 0f 45 c2          	cmovne %rdx,%rax
+  800600:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800604:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800608:	7e 06                	jle    800610 <vprintfmt+0x24b>
+  80060a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80060e:	75 4a                	jne    80065a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800610:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800614:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800618:	0f b6 00             	movzbl (%rax),%eax
+  80061b:	84 c0                	test   %al,%al
+  80061d:	0f 85 9a 00 00 00    	jne    8006bd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800623:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800626:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80062a:	85 c0                	test   %eax,%eax
+  80062c:	0f 8e c4 fd ff ff    	jle    8003f6 <vprintfmt+0x31>
+  800632:	4c 89 ee             	mov    %r13,%rsi
+  800635:	bf 20 00 00 00       	mov    $0x20,%edi
+  80063a:	41 ff d6             	call   *%r14
+  80063d:	41 83 ec 01          	sub    $0x1,%r12d
+  800641:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800645:	75 eb                	jne    800632 <vprintfmt+0x26d>
+  800647:	e9 aa fd ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80064c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800650:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800654:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800658:	eb 92                	jmp    8005ec <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80065a:	49 63 f7             	movslq %r15d,%rsi
+  80065d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800661:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  800668:	00 00 00 
+  80066b:	ff d0                	call   *%rax
+  80066d:	48 89 c2             	mov    %rax,%rdx
+  800670:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800673:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800675:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800678:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80067b:	85 c0                	test   %eax,%eax
+  80067d:	7e 91                	jle    800610 <vprintfmt+0x24b>
+  80067f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800684:	4c 89 ee             	mov    %r13,%rsi
+  800687:	44 89 e7             	mov    %r12d,%edi
+  80068a:	41 ff d6             	call   *%r14
+  80068d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800691:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800694:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800697:	75 eb                	jne    800684 <vprintfmt+0x2bf>
+  800699:	e9 72 ff ff ff       	jmp    800610 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80069e:	0f b6 f8             	movzbl %al,%edi
+  8006a1:	4c 89 ee             	mov    %r13,%rsi
+  8006a4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ab:	49 83 c4 01          	add    $0x1,%r12
+  8006af:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006b5:	84 c0                	test   %al,%al
+  8006b7:	0f 84 66 ff ff ff    	je     800623 <vprintfmt+0x25e>
+  8006bd:	45 85 ff             	test   %r15d,%r15d
+  8006c0:	78 0a                	js     8006cc <vprintfmt+0x307>
+  8006c2:	41 83 ef 01          	sub    $0x1,%r15d
+  8006c6:	0f 88 57 ff ff ff    	js     800623 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006cc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006d0:	74 cc                	je     80069e <vprintfmt+0x2d9>
+  8006d2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006da:	80 fa 5e             	cmp    $0x5e,%dl
+  8006dd:	77 c2                	ja     8006a1 <vprintfmt+0x2dc>
+  8006df:	eb bd                	jmp    80069e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e1:	40 84 f6             	test   %sil,%sil
+  8006e4:	75 26                	jne    80070c <vprintfmt+0x347>
+    switch (lflag) {
+  8006e6:	85 d2                	test   %edx,%edx
+  8006e8:	74 59                	je     800743 <vprintfmt+0x37e>
+  8006ea:	83 fa 01             	cmp    $0x1,%edx
+  8006ed:	74 7b                	je     80076a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f5:	0f 87 96 00 00 00    	ja     800791 <vprintfmt+0x3cc>
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800701:	83 c0 08             	add    $0x8,%eax
+  800704:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800707:	4c 8b 22             	mov    (%rdx),%r12
+  80070a:	eb 17                	jmp    800723 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80070c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070f:	83 f8 2f             	cmp    $0x2f,%eax
+  800712:	77 21                	ja     800735 <vprintfmt+0x370>
+  800714:	89 c2                	mov    %eax,%edx
+  800716:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071a:	83 c0 08             	add    $0x8,%eax
+  80071d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800720:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800723:	4d 85 e4             	test   %r12,%r12
+  800726:	78 7a                	js     8007a2 <vprintfmt+0x3dd>
+            num = i;
+  800728:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80072b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800730:	e9 50 02 00 00       	jmp    800985 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800735:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800739:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800741:	eb dd                	jmp    800720 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800743:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800746:	83 f8 2f             	cmp    $0x2f,%eax
+  800749:	77 11                	ja     80075c <vprintfmt+0x397>
+  80074b:	89 c2                	mov    %eax,%edx
+  80074d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800751:	83 c0 08             	add    $0x8,%eax
+  800754:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800757:	4c 63 22             	movslq (%rdx),%r12
+  80075a:	eb c7                	jmp    800723 <vprintfmt+0x35e>
+  80075c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800760:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800768:	eb ed                	jmp    800757 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 11                	ja     800783 <vprintfmt+0x3be>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	4c 8b 22             	mov    (%rdx),%r12
+  800781:	eb a0                	jmp    800723 <vprintfmt+0x35e>
+  800783:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800787:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078f:	eb ed                	jmp    80077e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800791:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800795:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800799:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079d:	e9 65 ff ff ff       	jmp    800707 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007a2:	4c 89 ee             	mov    %r13,%rsi
+  8007a5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007aa:	41 ff d6             	call   *%r14
+                i = -i;
+  8007ad:	49 f7 dc             	neg    %r12
+  8007b0:	e9 73 ff ff ff       	jmp    800728 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b5:	40 84 f6             	test   %sil,%sil
+  8007b8:	75 32                	jne    8007ec <vprintfmt+0x427>
+    switch (lflag) {
+  8007ba:	85 d2                	test   %edx,%edx
+  8007bc:	74 5d                	je     80081b <vprintfmt+0x456>
+  8007be:	83 fa 01             	cmp    $0x1,%edx
+  8007c1:	0f 84 82 00 00 00    	je     800849 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cd:	0f 87 a5 00 00 00    	ja     800878 <vprintfmt+0x4b3>
+  8007d3:	89 c2                	mov    %eax,%edx
+  8007d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d9:	83 c0 08             	add    $0x8,%eax
+  8007dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007df:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007e7:	e9 99 01 00 00       	jmp    800985 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f2:	77 19                	ja     80080d <vprintfmt+0x448>
+  8007f4:	89 c2                	mov    %eax,%edx
+  8007f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fa:	83 c0 08             	add    $0x8,%eax
+  8007fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800800:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800803:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800808:	e9 78 01 00 00       	jmp    800985 <vprintfmt+0x5c0>
+  80080d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800811:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800819:	eb e5                	jmp    800800 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80081b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081e:	83 f8 2f             	cmp    $0x2f,%eax
+  800821:	77 18                	ja     80083b <vprintfmt+0x476>
+  800823:	89 c2                	mov    %eax,%edx
+  800825:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800829:	83 c0 08             	add    $0x8,%eax
+  80082c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800831:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800836:	e9 4a 01 00 00       	jmp    800985 <vprintfmt+0x5c0>
+  80083b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800843:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800847:	eb e6                	jmp    80082f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800849:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084c:	83 f8 2f             	cmp    $0x2f,%eax
+  80084f:	77 19                	ja     80086a <vprintfmt+0x4a5>
+  800851:	89 c2                	mov    %eax,%edx
+  800853:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800857:	83 c0 08             	add    $0x8,%eax
+  80085a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800860:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800865:	e9 1b 01 00 00       	jmp    800985 <vprintfmt+0x5c0>
+  80086a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800876:	eb e5                	jmp    80085d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800878:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800880:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800884:	e9 56 ff ff ff       	jmp    8007df <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800889:	40 84 f6             	test   %sil,%sil
+  80088c:	75 2e                	jne    8008bc <vprintfmt+0x4f7>
+    switch (lflag) {
+  80088e:	85 d2                	test   %edx,%edx
+  800890:	74 59                	je     8008eb <vprintfmt+0x526>
+  800892:	83 fa 01             	cmp    $0x1,%edx
+  800895:	74 7f                	je     800916 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800897:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089a:	83 f8 2f             	cmp    $0x2f,%eax
+  80089d:	0f 87 9f 00 00 00    	ja     800942 <vprintfmt+0x57d>
+  8008a3:	89 c2                	mov    %eax,%edx
+  8008a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a9:	83 c0 08             	add    $0x8,%eax
+  8008ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008af:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008b2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008b7:	e9 c9 00 00 00       	jmp    800985 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c2:	77 19                	ja     8008dd <vprintfmt+0x518>
+  8008c4:	89 c2                	mov    %eax,%edx
+  8008c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ca:	83 c0 08             	add    $0x8,%eax
+  8008cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008d8:	e9 a8 00 00 00       	jmp    800985 <vprintfmt+0x5c0>
+  8008dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e9:	eb e5                	jmp    8008d0 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f1:	77 15                	ja     800908 <vprintfmt+0x543>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800901:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800906:	eb 7d                	jmp    800985 <vprintfmt+0x5c0>
+  800908:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	eb e9                	jmp    8008ff <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800916:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800919:	83 f8 2f             	cmp    $0x2f,%eax
+  80091c:	77 16                	ja     800934 <vprintfmt+0x56f>
+  80091e:	89 c2                	mov    %eax,%edx
+  800920:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800924:	83 c0 08             	add    $0x8,%eax
+  800927:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80092d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800932:	eb 51                	jmp    800985 <vprintfmt+0x5c0>
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	eb e8                	jmp    80092a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800942:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800946:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094e:	e9 5c ff ff ff       	jmp    8008af <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800953:	4c 89 ee             	mov    %r13,%rsi
+  800956:	bf 30 00 00 00       	mov    $0x30,%edi
+  80095b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80095e:	4c 89 ee             	mov    %r13,%rsi
+  800961:	bf 78 00 00 00       	mov    $0x78,%edi
+  800966:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800969:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	77 47                	ja     8009b8 <vprintfmt+0x5f3>
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800977:	83 c0 08             	add    $0x8,%eax
+  80097a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800980:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800985:	48 83 ec 08          	sub    $0x8,%rsp
+  800989:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80098d:	0f 94 c0             	sete   %al
+  800990:	0f b6 c0             	movzbl %al,%eax
+  800993:	50                   	push   %rax
+  800994:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800999:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80099d:	4c 89 ee             	mov    %r13,%rsi
+  8009a0:	4c 89 f7             	mov    %r14,%rdi
+  8009a3:	48 b8 ba 02 80 00 00 	movabs $0x8002ba,%rax
+  8009aa:	00 00 00 
+  8009ad:	ff d0                	call   *%rax
+            break;
+  8009af:	48 83 c4 10          	add    $0x10,%rsp
+  8009b3:	e9 3e fa ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c4:	eb b7                	jmp    80097d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c6:	40 84 f6             	test   %sil,%sil
+  8009c9:	75 2b                	jne    8009f6 <vprintfmt+0x631>
+    switch (lflag) {
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	74 56                	je     800a25 <vprintfmt+0x660>
+  8009cf:	83 fa 01             	cmp    $0x1,%edx
+  8009d2:	74 7f                	je     800a53 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009da:	0f 87 a2 00 00 00    	ja     800a82 <vprintfmt+0x6bd>
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e6:	83 c0 08             	add    $0x8,%eax
+  8009e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f4:	eb 8f                	jmp    800985 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	77 19                	ja     800a17 <vprintfmt+0x652>
+  8009fe:	89 c2                	mov    %eax,%edx
+  800a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a04:	83 c0 08             	add    $0x8,%eax
+  800a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a12:	e9 6e ff ff ff       	jmp    800985 <vprintfmt+0x5c0>
+  800a17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a23:	eb e5                	jmp    800a0a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a28:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2b:	77 18                	ja     800a45 <vprintfmt+0x680>
+  800a2d:	89 c2                	mov    %eax,%edx
+  800a2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a33:	83 c0 08             	add    $0x8,%eax
+  800a36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a39:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a3b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a40:	e9 40 ff ff ff       	jmp    800985 <vprintfmt+0x5c0>
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	eb e6                	jmp    800a39 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a56:	83 f8 2f             	cmp    $0x2f,%eax
+  800a59:	77 19                	ja     800a74 <vprintfmt+0x6af>
+  800a5b:	89 c2                	mov    %eax,%edx
+  800a5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a61:	83 c0 08             	add    $0x8,%eax
+  800a64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a6f:	e9 11 ff ff ff       	jmp    800985 <vprintfmt+0x5c0>
+  800a74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a80:	eb e5                	jmp    800a67 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8e:	e9 59 ff ff ff       	jmp    8009ec <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a93:	4c 89 ee             	mov    %r13,%rsi
+  800a96:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a9b:	41 ff d6             	call   *%r14
+            break;
+  800a9e:	e9 53 f9 ff ff       	jmp    8003f6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800aa3:	4c 89 ee             	mov    %r13,%rsi
+  800aa6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aab:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aae:	48 83 eb 01          	sub    $0x1,%rbx
+  800ab2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ab6:	75 f6                	jne    800aae <vprintfmt+0x6e9>
+  800ab8:	e9 39 f9 ff ff       	jmp    8003f6 <vprintfmt+0x31>
+}
+  800abd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ac1:	5b                   	pop    %rbx
+  800ac2:	41 5c                	pop    %r12
+  800ac4:	41 5d                	pop    %r13
+  800ac6:	41 5e                	pop    %r14
+  800ac8:	41 5f                	pop    %r15
+  800aca:	5d                   	pop    %rbp
+  800acb:	c3                   	ret
+
+0000000000800acc <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800acc:	55                   	push   %rbp
+  800acd:	48 89 e5             	mov    %rsp,%rbp
+  800ad0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ad4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ad8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800add:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ae1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ae8:	48 85 ff             	test   %rdi,%rdi
+  800aeb:	74 2b                	je     800b18 <vsnprintf+0x4c>
+  800aed:	48 85 f6             	test   %rsi,%rsi
+  800af0:	74 26                	je     800b18 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800af2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800af6:	48 bf 70 03 80 00 00 	movabs $0x800370,%rdi
+  800afd:	00 00 00 
+  800b00:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  800b07:	00 00 00 
+  800b0a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b10:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b13:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b16:	c9                   	leave
+  800b17:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1d:	eb f7                	jmp    800b16 <vsnprintf+0x4a>
+
+0000000000800b1f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b1f:	55                   	push   %rbp
+  800b20:	48 89 e5             	mov    %rsp,%rbp
+  800b23:	48 83 ec 50          	sub    $0x50,%rsp
+  800b27:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b2b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b2f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b33:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b3a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b42:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b46:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b4a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b4e:	48 b8 cc 0a 80 00 00 	movabs $0x800acc,%rax
+  800b55:	00 00 00 
+  800b58:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b5a:	c9                   	leave
+  800b5b:	c3                   	ret
+
+0000000000800b5c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b5c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b5f:	74 10                	je     800b71 <strlen+0x15>
+    size_t n = 0;
+  800b61:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b66:	48 83 c0 01          	add    $0x1,%rax
+  800b6a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b6e:	75 f6                	jne    800b66 <strlen+0xa>
+  800b70:	c3                   	ret
+    size_t n = 0;
+  800b71:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b76:	c3                   	ret
+
+0000000000800b77 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b77:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b7f:	48 85 f6             	test   %rsi,%rsi
+  800b82:	74 11                	je     800b95 <strnlen+0x1e>
+  800b84:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b88:	74 0c                	je     800b96 <strnlen+0x1f>
+  800b8a:	48 83 c2 01          	add    $0x1,%rdx
+  800b8e:	48 39 d0             	cmp    %rdx,%rax
+  800b91:	75 f1                	jne    800b84 <strnlen+0xd>
+  800b93:	eb 04                	jmp    800b99 <strnlen+0x22>
+  800b95:	c3                   	ret
+  800b96:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b99:	c3                   	ret
+
+0000000000800b9a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b9a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ba6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ba9:	48 83 c2 01          	add    $0x1,%rdx
+  800bad:	84 c9                	test   %cl,%cl
+  800baf:	75 f1                	jne    800ba2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bb2:	55                   	push   %rbp
+  800bb3:	48 89 e5             	mov    %rsp,%rbp
+  800bb6:	41 54                	push   %r12
+  800bb8:	53                   	push   %rbx
+  800bb9:	48 89 fb             	mov    %rdi,%rbx
+  800bbc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bbf:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bcb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bcf:	4c 89 e6             	mov    %r12,%rsi
+  800bd2:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  800bd9:	00 00 00 
+  800bdc:	ff d0                	call   *%rax
+    return dst;
+}
+  800bde:	48 89 d8             	mov    %rbx,%rax
+  800be1:	5b                   	pop    %rbx
+  800be2:	41 5c                	pop    %r12
+  800be4:	5d                   	pop    %rbp
+  800be5:	c3                   	ret
+
+0000000000800be6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800be6:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800be9:	48 85 d2             	test   %rdx,%rdx
+  800bec:	74 1f                	je     800c0d <strncpy+0x27>
+  800bee:	48 01 fa             	add    %rdi,%rdx
+  800bf1:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bf4:	48 83 c1 01          	add    $0x1,%rcx
+  800bf8:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bfc:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c00:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c04:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c08:	48 39 ca             	cmp    %rcx,%rdx
+  800c0b:	75 e7                	jne    800bf4 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c0d:	c3                   	ret
+
+0000000000800c0e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c0e:	48 89 f8             	mov    %rdi,%rax
+  800c11:	48 85 d2             	test   %rdx,%rdx
+  800c14:	74 24                	je     800c3a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c16:	48 83 ea 01          	sub    $0x1,%rdx
+  800c1a:	74 1b                	je     800c37 <strlcpy+0x29>
+  800c1c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c20:	0f b6 16             	movzbl (%rsi),%edx
+  800c23:	84 d2                	test   %dl,%dl
+  800c25:	74 10                	je     800c37 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c27:	48 83 c6 01          	add    $0x1,%rsi
+  800c2b:	48 83 c0 01          	add    $0x1,%rax
+  800c2f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c32:	48 39 c8             	cmp    %rcx,%rax
+  800c35:	75 e9                	jne    800c20 <strlcpy+0x12>
+        *dst = '\0';
+  800c37:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c3a:	48 29 f8             	sub    %rdi,%rax
+}
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c3e:	0f b6 07             	movzbl (%rdi),%eax
+  800c41:	84 c0                	test   %al,%al
+  800c43:	74 13                	je     800c58 <strcmp+0x1a>
+  800c45:	38 06                	cmp    %al,(%rsi)
+  800c47:	75 0f                	jne    800c58 <strcmp+0x1a>
+  800c49:	48 83 c7 01          	add    $0x1,%rdi
+  800c4d:	48 83 c6 01          	add    $0x1,%rsi
+  800c51:	0f b6 07             	movzbl (%rdi),%eax
+  800c54:	84 c0                	test   %al,%al
+  800c56:	75 ed                	jne    800c45 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c58:	0f b6 c0             	movzbl %al,%eax
+  800c5b:	0f b6 16             	movzbl (%rsi),%edx
+  800c5e:	29 d0                	sub    %edx,%eax
+}
+  800c60:	c3                   	ret
+
+0000000000800c61 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c61:	48 85 d2             	test   %rdx,%rdx
+  800c64:	74 1f                	je     800c85 <strncmp+0x24>
+  800c66:	0f b6 07             	movzbl (%rdi),%eax
+  800c69:	84 c0                	test   %al,%al
+  800c6b:	74 1e                	je     800c8b <strncmp+0x2a>
+  800c6d:	3a 06                	cmp    (%rsi),%al
+  800c6f:	75 1a                	jne    800c8b <strncmp+0x2a>
+  800c71:	48 83 c7 01          	add    $0x1,%rdi
+  800c75:	48 83 c6 01          	add    $0x1,%rsi
+  800c79:	48 83 ea 01          	sub    $0x1,%rdx
+  800c7d:	75 e7                	jne    800c66 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c84:	c3                   	ret
+  800c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8a:	c3                   	ret
+  800c8b:	48 85 d2             	test   %rdx,%rdx
+  800c8e:	74 09                	je     800c99 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c90:	0f b6 07             	movzbl (%rdi),%eax
+  800c93:	0f b6 16             	movzbl (%rsi),%edx
+  800c96:	29 d0                	sub    %edx,%eax
+  800c98:	c3                   	ret
+    if (!n) return 0;
+  800c99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9e:	c3                   	ret
+
+0000000000800c9f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c9f:	0f b6 17             	movzbl (%rdi),%edx
+  800ca2:	84 d2                	test   %dl,%dl
+  800ca4:	74 18                	je     800cbe <strchr+0x1f>
+        if (*str == c) {
+  800ca6:	0f be d2             	movsbl %dl,%edx
+  800ca9:	39 f2                	cmp    %esi,%edx
+  800cab:	74 17                	je     800cc4 <strchr+0x25>
+    for (; *str; str++) {
+  800cad:	48 83 c7 01          	add    $0x1,%rdi
+  800cb1:	0f b6 17             	movzbl (%rdi),%edx
+  800cb4:	84 d2                	test   %dl,%dl
+  800cb6:	75 ee                	jne    800ca6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbd:	c3                   	ret
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc3:	c3                   	ret
+  800cc4:	48 89 f8             	mov    %rdi,%rax
+}
+  800cc7:	c3                   	ret
+
+0000000000800cc8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cc8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ccb:	0f b6 17             	movzbl (%rdi),%edx
+  800cce:	84 d2                	test   %dl,%dl
+  800cd0:	74 13                	je     800ce5 <strfind+0x1d>
+  800cd2:	0f be d2             	movsbl %dl,%edx
+  800cd5:	39 f2                	cmp    %esi,%edx
+  800cd7:	74 0b                	je     800ce4 <strfind+0x1c>
+  800cd9:	48 83 c0 01          	add    $0x1,%rax
+  800cdd:	0f b6 10             	movzbl (%rax),%edx
+  800ce0:	84 d2                	test   %dl,%dl
+  800ce2:	75 ee                	jne    800cd2 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ce4:	c3                   	ret
+  800ce5:	c3                   	ret
+
+0000000000800ce6 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ce6:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ce9:	48 89 f8             	mov    %rdi,%rax
+  800cec:	48 f7 d8             	neg    %rax
+  800cef:	83 e0 07             	and    $0x7,%eax
+  800cf2:	49 89 d1             	mov    %rdx,%r9
+  800cf5:	49 29 c1             	sub    %rax,%r9
+  800cf8:	78 36                	js     800d30 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cfa:	40 0f b6 c6          	movzbl %sil,%eax
+  800cfe:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d05:	01 01 01 
+  800d08:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d0c:	40 f6 c7 07          	test   $0x7,%dil
+  800d10:	75 38                	jne    800d4a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d12:	4c 89 c9             	mov    %r9,%rcx
+  800d15:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d19:	74 0c                	je     800d27 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d1b:	fc                   	cld
+  800d1c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d1f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d23:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d27:	4d 85 c9             	test   %r9,%r9
+  800d2a:	75 45                	jne    800d71 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d2c:	4c 89 c0             	mov    %r8,%rax
+  800d2f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d30:	48 85 d2             	test   %rdx,%rdx
+  800d33:	74 f7                	je     800d2c <memset+0x46>
+  800d35:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d38:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d3b:	48 83 c0 01          	add    $0x1,%rax
+  800d3f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d43:	48 39 c2             	cmp    %rax,%rdx
+  800d46:	75 f3                	jne    800d3b <memset+0x55>
+  800d48:	eb e2                	jmp    800d2c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d4a:	40 f6 c7 01          	test   $0x1,%dil
+  800d4e:	74 06                	je     800d56 <memset+0x70>
+  800d50:	88 07                	mov    %al,(%rdi)
+  800d52:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d56:	40 f6 c7 02          	test   $0x2,%dil
+  800d5a:	74 07                	je     800d63 <memset+0x7d>
+  800d5c:	66 89 07             	mov    %ax,(%rdi)
+  800d5f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d63:	40 f6 c7 04          	test   $0x4,%dil
+  800d67:	74 a9                	je     800d12 <memset+0x2c>
+  800d69:	89 07                	mov    %eax,(%rdi)
+  800d6b:	48 83 c7 04          	add    $0x4,%rdi
+  800d6f:	eb a1                	jmp    800d12 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d71:	41 f6 c1 04          	test   $0x4,%r9b
+  800d75:	74 06                	je     800d7d <memset+0x97>
+  800d77:	89 07                	mov    %eax,(%rdi)
+  800d79:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d7d:	41 f6 c1 02          	test   $0x2,%r9b
+  800d81:	74 07                	je     800d8a <memset+0xa4>
+  800d83:	66 89 07             	mov    %ax,(%rdi)
+  800d86:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d8a:	41 f6 c1 01          	test   $0x1,%r9b
+  800d8e:	74 9c                	je     800d2c <memset+0x46>
+  800d90:	88 07                	mov    %al,(%rdi)
+  800d92:	eb 98                	jmp    800d2c <memset+0x46>
+
+0000000000800d94 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d94:	48 89 f8             	mov    %rdi,%rax
+  800d97:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d9a:	48 39 fe             	cmp    %rdi,%rsi
+  800d9d:	73 3b                	jae    800dda <memmove+0x46>
+  800d9f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800da3:	48 39 d7             	cmp    %rdx,%rdi
+  800da6:	73 32                	jae    800dda <memmove+0x46>
+        s += n;
+        d += n;
+  800da8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dac:	48 89 d6             	mov    %rdx,%rsi
+  800daf:	48 09 fe             	or     %rdi,%rsi
+  800db2:	48 09 ce             	or     %rcx,%rsi
+  800db5:	40 f6 c6 07          	test   $0x7,%sil
+  800db9:	75 12                	jne    800dcd <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dbb:	48 83 ef 08          	sub    $0x8,%rdi
+  800dbf:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dc3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dc7:	fd                   	std
+  800dc8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dcb:	fc                   	cld
+  800dcc:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dcd:	48 83 ef 01          	sub    $0x1,%rdi
+  800dd1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dd5:	fd                   	std
+  800dd6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dd8:	eb f1                	jmp    800dcb <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dda:	48 89 f2             	mov    %rsi,%rdx
+  800ddd:	48 09 c2             	or     %rax,%rdx
+  800de0:	48 09 ca             	or     %rcx,%rdx
+  800de3:	f6 c2 07             	test   $0x7,%dl
+  800de6:	75 0c                	jne    800df4 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800de8:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dec:	48 89 c7             	mov    %rax,%rdi
+  800def:	fc                   	cld
+  800df0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800df3:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800df4:	48 89 c7             	mov    %rax,%rdi
+  800df7:	fc                   	cld
+  800df8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800dfa:	c3                   	ret
+
+0000000000800dfb <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dfb:	55                   	push   %rbp
+  800dfc:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800dff:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  800e06:	00 00 00 
+  800e09:	ff d0                	call   *%rax
+}
+  800e0b:	5d                   	pop    %rbp
+  800e0c:	c3                   	ret
+
+0000000000800e0d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e0d:	55                   	push   %rbp
+  800e0e:	48 89 e5             	mov    %rsp,%rbp
+  800e11:	41 57                	push   %r15
+  800e13:	41 56                	push   %r14
+  800e15:	41 55                	push   %r13
+  800e17:	41 54                	push   %r12
+  800e19:	53                   	push   %rbx
+  800e1a:	48 83 ec 08          	sub    $0x8,%rsp
+  800e1e:	49 89 fe             	mov    %rdi,%r14
+  800e21:	49 89 f7             	mov    %rsi,%r15
+  800e24:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e27:	48 89 f7             	mov    %rsi,%rdi
+  800e2a:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+  800e36:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e39:	48 89 de             	mov    %rbx,%rsi
+  800e3c:	4c 89 f7             	mov    %r14,%rdi
+  800e3f:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  800e46:	00 00 00 
+  800e49:	ff d0                	call   *%rax
+  800e4b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e4e:	48 39 c3             	cmp    %rax,%rbx
+  800e51:	74 36                	je     800e89 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e53:	48 89 d8             	mov    %rbx,%rax
+  800e56:	4c 29 e8             	sub    %r13,%rax
+  800e59:	49 39 c4             	cmp    %rax,%r12
+  800e5c:	73 31                	jae    800e8f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e5e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e63:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e67:	4c 89 fe             	mov    %r15,%rsi
+  800e6a:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e76:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e7a:	48 83 c4 08          	add    $0x8,%rsp
+  800e7e:	5b                   	pop    %rbx
+  800e7f:	41 5c                	pop    %r12
+  800e81:	41 5d                	pop    %r13
+  800e83:	41 5e                	pop    %r14
+  800e85:	41 5f                	pop    %r15
+  800e87:	5d                   	pop    %rbp
+  800e88:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e89:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e8d:	eb eb                	jmp    800e7a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e8f:	48 83 eb 01          	sub    $0x1,%rbx
+  800e93:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e97:	48 89 da             	mov    %rbx,%rdx
+  800e9a:	4c 89 fe             	mov    %r15,%rsi
+  800e9d:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ea9:	49 01 de             	add    %rbx,%r14
+  800eac:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800eb1:	eb c3                	jmp    800e76 <strlcat+0x69>
+
+0000000000800eb3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eb3:	48 85 d2             	test   %rdx,%rdx
+  800eb6:	74 2d                	je     800ee5 <memcmp+0x32>
+  800eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ebd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ec1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ec6:	44 38 c1             	cmp    %r8b,%cl
+  800ec9:	75 0f                	jne    800eda <memcmp+0x27>
+    while (n-- > 0) {
+  800ecb:	48 83 c0 01          	add    $0x1,%rax
+  800ecf:	48 39 c2             	cmp    %rax,%rdx
+  800ed2:	75 e9                	jne    800ebd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800eda:	0f b6 c1             	movzbl %cl,%eax
+  800edd:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ee1:	44 29 c0             	sub    %r8d,%eax
+  800ee4:	c3                   	ret
+    return 0;
+  800ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eea:	c3                   	ret
+
+0000000000800eeb <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800eeb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800eef:	48 39 c7             	cmp    %rax,%rdi
+  800ef2:	73 0f                	jae    800f03 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ef4:	40 38 37             	cmp    %sil,(%rdi)
+  800ef7:	74 0e                	je     800f07 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ef9:	48 83 c7 01          	add    $0x1,%rdi
+  800efd:	48 39 f8             	cmp    %rdi,%rax
+  800f00:	75 f2                	jne    800ef4 <memfind+0x9>
+  800f02:	c3                   	ret
+  800f03:	48 89 f8             	mov    %rdi,%rax
+  800f06:	c3                   	ret
+  800f07:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f0a:	c3                   	ret
+
+0000000000800f0b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f0b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f0e:	0f b6 37             	movzbl (%rdi),%esi
+  800f11:	40 80 fe 20          	cmp    $0x20,%sil
+  800f15:	74 06                	je     800f1d <strtol+0x12>
+  800f17:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1b:	75 13                	jne    800f30 <strtol+0x25>
+  800f1d:	48 83 c7 01          	add    $0x1,%rdi
+  800f21:	0f b6 37             	movzbl (%rdi),%esi
+  800f24:	40 80 fe 20          	cmp    $0x20,%sil
+  800f28:	74 f3                	je     800f1d <strtol+0x12>
+  800f2a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f2e:	74 ed                	je     800f1d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f30:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f33:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f36:	3c 01                	cmp    $0x1,%al
+  800f38:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f3c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f42:	75 0f                	jne    800f53 <strtol+0x48>
+  800f44:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f47:	74 14                	je     800f5d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f49:	85 d2                	test   %edx,%edx
+  800f4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f50:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f53:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f58:	4c 63 ca             	movslq %edx,%r9
+  800f5b:	eb 36                	jmp    800f93 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f5d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f61:	74 0f                	je     800f72 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f63:	85 d2                	test   %edx,%edx
+  800f65:	75 ec                	jne    800f53 <strtol+0x48>
+        s++;
+  800f67:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f6b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f70:	eb e1                	jmp    800f53 <strtol+0x48>
+        s += 2;
+  800f72:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f76:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f7b:	eb d6                	jmp    800f53 <strtol+0x48>
+            dig -= '0';
+  800f7d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f80:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f84:	41 39 d0             	cmp    %edx,%r8d
+  800f87:	7d 21                	jge    800faa <strtol+0x9f>
+        val = val * base + dig;
+  800f89:	49 0f af c1          	imul   %r9,%rax
+  800f8d:	0f b6 c9             	movzbl %cl,%ecx
+  800f90:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f93:	48 83 c7 01          	add    $0x1,%rdi
+  800f97:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f9b:	80 f9 39             	cmp    $0x39,%cl
+  800f9e:	76 dd                	jbe    800f7d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fa0:	80 f9 7b             	cmp    $0x7b,%cl
+  800fa3:	77 05                	ja     800faa <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fa5:	83 e9 57             	sub    $0x57,%ecx
+  800fa8:	eb d6                	jmp    800f80 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800faa:	4d 85 d2             	test   %r10,%r10
+  800fad:	74 03                	je     800fb2 <strtol+0xa7>
+  800faf:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fb2:	48 89 c2             	mov    %rax,%rdx
+  800fb5:	48 f7 da             	neg    %rdx
+  800fb8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fbc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fc0:	c3                   	ret
+
+0000000000800fc1 <strrev>:
+
+void
+strrev(char *str)
+{
+  800fc1:	55                   	push   %rbp
+  800fc2:	48 89 e5             	mov    %rsp,%rbp
+  800fc5:	53                   	push   %rbx
+  800fc6:	48 83 ec 08          	sub    $0x8,%rsp
+  800fca:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fcd:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  800fd4:	00 00 00 
+  800fd7:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fd9:	83 e8 01             	sub    $0x1,%eax
+  800fdc:	85 c0                	test   %eax,%eax
+  800fde:	7e 22                	jle    801002 <strrev+0x41>
+  800fe0:	48 98                	cltq
+  800fe2:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800fe7:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800feb:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800fef:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800ff3:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800ff6:	48 83 c2 01          	add    $0x1,%rdx
+  800ffa:	48 83 e8 01          	sub    $0x1,%rax
+  800ffe:	39 c2                	cmp    %eax,%edx
+  801000:	7c e5                	jl     800fe7 <strrev+0x26>
+	}
+}
+  801002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801006:	c9                   	leave
+  801007:	c3                   	ret
+
+0000000000801008 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801008:	85 d2                	test   %edx,%edx
+  80100a:	0f 84 80 00 00 00    	je     801090 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801010:	55                   	push   %rbp
+  801011:	48 89 e5             	mov    %rsp,%rbp
+  801014:	53                   	push   %rbx
+  801015:	48 83 ec 08          	sub    $0x8,%rsp
+  801019:	49 89 f2             	mov    %rsi,%r10
+  80101c:	41 89 d3             	mov    %edx,%r11d
+  80101f:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801022:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801027:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80102a:	eb 20                	jmp    80104c <itoa+0x44>
+			str[i++] = '0' + digit;
+  80102c:	41 89 f1             	mov    %esi,%r9d
+  80102f:	83 c2 30             	add    $0x30,%edx
+  801032:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801035:	89 f8                	mov    %edi,%eax
+  801037:	99                   	cltd
+  801038:	f7 f9                	idiv   %ecx
+  80103a:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	74 2e                	je     80106e <itoa+0x66>
+  801040:	83 c6 01             	add    $0x1,%esi
+  801043:	49 83 c0 01          	add    $0x1,%r8
+  801047:	44 39 cb             	cmp    %r9d,%ebx
+  80104a:	7e 15                	jle    801061 <itoa+0x59>
+		digit = sum % base;
+  80104c:	89 f8                	mov    %edi,%eax
+  80104e:	99                   	cltd
+  80104f:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801051:	83 fa 09             	cmp    $0x9,%edx
+  801054:	7e d6                	jle    80102c <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801056:	41 89 f1             	mov    %esi,%r9d
+  801059:	83 c2 37             	add    $0x37,%edx
+  80105c:	41 88 10             	mov    %dl,(%r8)
+  80105f:	eb d4                	jmp    801035 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801061:	41 83 eb 01          	sub    $0x1,%r11d
+  801065:	45 39 cb             	cmp    %r9d,%r11d
+  801068:	75 04                	jne    80106e <itoa+0x66>
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	75 28                	jne    801096 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80106e:	4d 63 c9             	movslq %r9d,%r9
+  801071:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801076:	4c 89 d7             	mov    %r10,%rdi
+  801079:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  801080:	00 00 00 
+  801083:	ff d0                	call   *%rax
+	return 0;
+  801085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108e:	c9                   	leave
+  80108f:	c3                   	ret
+		return -1;
+  801090:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801095:	c3                   	ret
+		return -1;
+  801096:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80109b:	eb ed                	jmp    80108a <itoa+0x82>
+
+000000000080109d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80109d:	55                   	push   %rbp
+  80109e:	48 89 e5             	mov    %rsp,%rbp
+  8010a1:	53                   	push   %rbx
+  8010a2:	48 89 fa             	mov    %rdi,%rdx
+  8010a5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c2:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c8:	c9                   	leave
+  8010c9:	c3                   	ret
+
+00000000008010ca <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010ca:	55                   	push   %rbp
+  8010cb:	48 89 e5             	mov    %rsp,%rbp
+  8010ce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010cf:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+
+00000000008010fb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010fb:	55                   	push   %rbp
+  8010fc:	48 89 e5             	mov    %rsp,%rbp
+  8010ff:	53                   	push   %rbx
+  801100:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801104:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801107:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801111:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801116:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111b:	be 00 00 00 00       	mov    $0x0,%esi
+  801120:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801126:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801128:	48 85 c0             	test   %rax,%rax
+  80112b:	7f 06                	jg     801133 <sys_env_destroy+0x38>
+}
+  80112d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801131:	c9                   	leave
+  801132:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801133:	49 89 c0             	mov    %rax,%r8
+  801136:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80113b:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801142:	00 00 00 
+  801145:	be 26 00 00 00       	mov    $0x26,%esi
+  80114a:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801151:	00 00 00 
+  801154:	b8 00 00 00 00       	mov    $0x0,%eax
+  801159:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  801160:	00 00 00 
+  801163:	41 ff d1             	call   *%r9
+
+0000000000801166 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801166:	55                   	push   %rbp
+  801167:	48 89 e5             	mov    %rsp,%rbp
+  80116a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80116b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801170:	ba 00 00 00 00       	mov    $0x0,%edx
+  801175:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801184:	be 00 00 00 00       	mov    $0x0,%esi
+  801189:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801195:	c9                   	leave
+  801196:	c3                   	ret
+
+0000000000801197 <sys_yield>:
+
+void
+sys_yield(void) {
+  801197:	55                   	push   %rbp
+  801198:	48 89 e5             	mov    %rsp,%rbp
+  80119b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80119c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c6:	c9                   	leave
+  8011c7:	c3                   	ret
+
+00000000008011c8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011c8:	55                   	push   %rbp
+  8011c9:	48 89 e5             	mov    %rsp,%rbp
+  8011cc:	53                   	push   %rbx
+  8011cd:	48 89 fa             	mov    %rdi,%rdx
+  8011d0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011df:	00 00 00 
+  8011e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f8:	c9                   	leave
+  8011f9:	c3                   	ret
+
+00000000008011fa <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011fa:	55                   	push   %rbp
+  8011fb:	48 89 e5             	mov    %rsp,%rbp
+  8011fe:	53                   	push   %rbx
+  8011ff:	49 89 f8             	mov    %rdi,%r8
+  801202:	48 89 d3             	mov    %rdx,%rbx
+  801205:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801208:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120d:	4c 89 c2             	mov    %r8,%rdx
+  801210:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801213:	be 00 00 00 00       	mov    $0x0,%esi
+  801218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801220:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+0000000000801226 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	53                   	push   %rbx
+  80122b:	48 83 ec 08          	sub    $0x8,%rsp
+  80122f:	89 f8                	mov    %edi,%eax
+  801231:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801234:	48 63 f9             	movslq %ecx,%rdi
+  801237:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80123a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801242:	be 00 00 00 00       	mov    $0x0,%esi
+  801247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80124f:	48 85 c0             	test   %rax,%rax
+  801252:	7f 06                	jg     80125a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125a:	49 89 c0             	mov    %rax,%r8
+  80125d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801262:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801269:	00 00 00 
+  80126c:	be 26 00 00 00       	mov    $0x26,%esi
+  801271:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801278:	00 00 00 
+  80127b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801280:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  801287:	00 00 00 
+  80128a:	41 ff d1             	call   *%r9
+
+000000000080128d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80128d:	55                   	push   %rbp
+  80128e:	48 89 e5             	mov    %rsp,%rbp
+  801291:	53                   	push   %rbx
+  801292:	48 83 ec 08          	sub    $0x8,%rsp
+  801296:	89 f8                	mov    %edi,%eax
+  801298:	49 89 f2             	mov    %rsi,%r10
+  80129b:	48 89 cf             	mov    %rcx,%rdi
+  80129e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012a1:	48 63 da             	movslq %edx,%rbx
+  8012a4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ac:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012af:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012b4:	48 85 c0             	test   %rax,%rax
+  8012b7:	7f 06                	jg     8012bf <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bd:	c9                   	leave
+  8012be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012bf:	49 89 c0             	mov    %rax,%r8
+  8012c2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012c7:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  8012ce:	00 00 00 
+  8012d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d6:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  8012dd:	00 00 00 
+  8012e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e5:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  8012ec:	00 00 00 
+  8012ef:	41 ff d1             	call   *%r9
+
+00000000008012f2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012f2:	55                   	push   %rbp
+  8012f3:	48 89 e5             	mov    %rsp,%rbp
+  8012f6:	53                   	push   %rbx
+  8012f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8012fb:	48 89 f1             	mov    %rsi,%rcx
+  8012fe:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801301:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801304:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801309:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801319:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80131b:	48 85 c0             	test   %rax,%rax
+  80131e:	7f 06                	jg     801326 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801324:	c9                   	leave
+  801325:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801326:	49 89 c0             	mov    %rax,%r8
+  801329:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80132e:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801335:	00 00 00 
+  801338:	be 26 00 00 00       	mov    $0x26,%esi
+  80133d:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801344:	00 00 00 
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  801353:	00 00 00 
+  801356:	41 ff d1             	call   *%r9
+
+0000000000801359 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801359:	55                   	push   %rbp
+  80135a:	48 89 e5             	mov    %rsp,%rbp
+  80135d:	53                   	push   %rbx
+  80135e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801362:	48 63 ce             	movslq %esi,%rcx
+  801365:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801368:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80136d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801372:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801377:	be 00 00 00 00       	mov    $0x0,%esi
+  80137c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801382:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801384:	48 85 c0             	test   %rax,%rax
+  801387:	7f 06                	jg     80138f <sys_env_set_status+0x36>
+}
+  801389:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138d:	c9                   	leave
+  80138e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138f:	49 89 c0             	mov    %rax,%r8
+  801392:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801397:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  80139e:	00 00 00 
+  8013a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a6:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  8013ad:	00 00 00 
+  8013b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b5:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  8013bc:	00 00 00 
+  8013bf:	41 ff d1             	call   *%r9
+
+00000000008013c2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013c2:	55                   	push   %rbp
+  8013c3:	48 89 e5             	mov    %rsp,%rbp
+  8013c6:	53                   	push   %rbx
+  8013c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013cb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ed:	48 85 c0             	test   %rax,%rax
+  8013f0:	7f 06                	jg     8013f8 <sys_env_set_trapframe+0x36>
+}
+  8013f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f6:	c9                   	leave
+  8013f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f8:	49 89 c0             	mov    %rax,%r8
+  8013fb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801400:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801407:	00 00 00 
+  80140a:	be 26 00 00 00       	mov    $0x26,%esi
+  80140f:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801416:	00 00 00 
+  801419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141e:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  801425:	00 00 00 
+  801428:	41 ff d1             	call   *%r9
+
+000000000080142b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80142b:	55                   	push   %rbp
+  80142c:	48 89 e5             	mov    %rsp,%rbp
+  80142f:	53                   	push   %rbx
+  801430:	48 83 ec 08          	sub    $0x8,%rsp
+  801434:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801437:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801449:	be 00 00 00 00       	mov    $0x0,%esi
+  80144e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801454:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801456:	48 85 c0             	test   %rax,%rax
+  801459:	7f 06                	jg     801461 <sys_env_set_pgfault_upcall+0x36>
+}
+  80145b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145f:	c9                   	leave
+  801460:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801461:	49 89 c0             	mov    %rax,%r8
+  801464:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801469:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801470:	00 00 00 
+  801473:	be 26 00 00 00       	mov    $0x26,%esi
+  801478:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  80147f:	00 00 00 
+  801482:	b8 00 00 00 00       	mov    $0x0,%eax
+  801487:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  80148e:	00 00 00 
+  801491:	41 ff d1             	call   *%r9
+
+0000000000801494 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801494:	55                   	push   %rbp
+  801495:	48 89 e5             	mov    %rsp,%rbp
+  801498:	53                   	push   %rbx
+  801499:	89 f8                	mov    %edi,%eax
+  80149b:	49 89 f1             	mov    %rsi,%r9
+  80149e:	48 89 d3             	mov    %rdx,%rbx
+  8014a1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014a4:	49 63 f0             	movslq %r8d,%rsi
+  8014a7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014af:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b8:	cd 30                	int    $0x30
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	53                   	push   %rbx
+  8014c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c9:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014cc:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d4:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e9:	48 85 c0             	test   %rax,%rax
+  8014ec:	7f 06                	jg     8014f4 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f4:	49 89 c0             	mov    %rax,%r8
+  8014f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014fc:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801503:	00 00 00 
+  801506:	be 26 00 00 00       	mov    $0x26,%esi
+  80150b:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801512:	00 00 00 
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151a:	49 b9 87 34 80 00 00 	movabs $0x803487,%r9
+  801521:	00 00 00 
+  801524:	41 ff d1             	call   *%r9
+
+0000000000801527 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801527:	55                   	push   %rbp
+  801528:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80152b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801530:	48 b8 c0 14 80 00 00 	movabs $0x8014c0,%rax
+  801537:	00 00 00 
+  80153a:	ff d0                	call   *%rax
+}
+  80153c:	5d                   	pop    %rbp
+  80153d:	c3                   	ret
+
+000000000080153e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80153e:	55                   	push   %rbp
+  80153f:	48 89 e5             	mov    %rsp,%rbp
+  801542:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801552:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801557:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801567:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156d:	c9                   	leave
+  80156e:	c3                   	ret
+
+000000000080156f <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+  801573:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801574:	48 63 ce             	movslq %esi,%rcx
+  801577:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80157b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801580:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801585:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158a:	be 00 00 00 00       	mov    $0x0,%esi
+  80158f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801595:	cd 30                	int    $0x30
+}
+  801597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+
+000000000080159d <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	53                   	push   %rbx
+  8015a2:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015a5:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c3:	cd 30                	int    $0x30
+}
+  8015c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+00000000008015cb <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015cb:	55                   	push   %rbp
+  8015cc:	48 89 e5             	mov    %rsp,%rbp
+  8015cf:	53                   	push   %rbx
+  8015d0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015d3:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015db:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ee:	cd 30                	int    $0x30
+}
+  8015f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015f6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015fd:	ff ff ff 
+  801600:	48 01 f8             	add    %rdi,%rax
+  801603:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801607:	c3                   	ret
+
+0000000000801608 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801608:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80160f:	ff ff ff 
+  801612:	48 01 f8             	add    %rdi,%rax
+  801615:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801619:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80161f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801623:	c3                   	ret
+
+0000000000801624 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+  801628:	41 57                	push   %r15
+  80162a:	41 56                	push   %r14
+  80162c:	41 55                	push   %r13
+  80162e:	41 54                	push   %r12
+  801630:	53                   	push   %rbx
+  801631:	48 83 ec 08          	sub    $0x8,%rsp
+  801635:	49 89 ff             	mov    %rdi,%r15
+  801638:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80163d:	49 bd 43 31 80 00 00 	movabs $0x803143,%r13
+  801644:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801647:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80164d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801650:	48 89 df             	mov    %rbx,%rdi
+  801653:	41 ff d5             	call   *%r13
+  801656:	83 e0 04             	and    $0x4,%eax
+  801659:	74 17                	je     801672 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80165b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801662:	4c 39 f3             	cmp    %r14,%rbx
+  801665:	75 e6                	jne    80164d <fd_alloc+0x29>
+  801667:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80166d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801672:	4d 89 27             	mov    %r12,(%r15)
+}
+  801675:	48 83 c4 08          	add    $0x8,%rsp
+  801679:	5b                   	pop    %rbx
+  80167a:	41 5c                	pop    %r12
+  80167c:	41 5d                	pop    %r13
+  80167e:	41 5e                	pop    %r14
+  801680:	41 5f                	pop    %r15
+  801682:	5d                   	pop    %rbp
+  801683:	c3                   	ret
+
+0000000000801684 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801684:	83 ff 1f             	cmp    $0x1f,%edi
+  801687:	77 39                	ja     8016c2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801689:	55                   	push   %rbp
+  80168a:	48 89 e5             	mov    %rsp,%rbp
+  80168d:	41 54                	push   %r12
+  80168f:	53                   	push   %rbx
+  801690:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801693:	48 63 df             	movslq %edi,%rbx
+  801696:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80169d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016a1:	48 89 df             	mov    %rbx,%rdi
+  8016a4:	48 b8 43 31 80 00 00 	movabs $0x803143,%rax
+  8016ab:	00 00 00 
+  8016ae:	ff d0                	call   *%rax
+  8016b0:	a8 04                	test   $0x4,%al
+  8016b2:	74 14                	je     8016c8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016b4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016bd:	5b                   	pop    %rbx
+  8016be:	41 5c                	pop    %r12
+  8016c0:	5d                   	pop    %rbp
+  8016c1:	c3                   	ret
+        return -E_INVAL;
+  8016c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016c7:	c3                   	ret
+        return -E_INVAL;
+  8016c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016cd:	eb ee                	jmp    8016bd <fd_lookup+0x39>
+
+00000000008016cf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016cf:	55                   	push   %rbp
+  8016d0:	48 89 e5             	mov    %rsp,%rbp
+  8016d3:	41 54                	push   %r12
+  8016d5:	53                   	push   %rbx
+  8016d6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016d9:	48 b8 00 3e 80 00 00 	movabs $0x803e00,%rax
+  8016e0:	00 00 00 
+  8016e3:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8016ea:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8016ed:	39 3b                	cmp    %edi,(%rbx)
+  8016ef:	74 47                	je     801738 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8016f1:	48 83 c0 08          	add    $0x8,%rax
+  8016f5:	48 8b 18             	mov    (%rax),%rbx
+  8016f8:	48 85 db             	test   %rbx,%rbx
+  8016fb:	75 f0                	jne    8016ed <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016fd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801704:	00 00 00 
+  801707:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80170d:	89 fa                	mov    %edi,%edx
+  80170f:	48 bf 58 3d 80 00 00 	movabs $0x803d58,%rdi
+  801716:	00 00 00 
+  801719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171e:	48 b9 75 02 80 00 00 	movabs $0x800275,%rcx
+  801725:	00 00 00 
+  801728:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80172a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80172f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801733:	5b                   	pop    %rbx
+  801734:	41 5c                	pop    %r12
+  801736:	5d                   	pop    %rbp
+  801737:	c3                   	ret
+            return 0;
+  801738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173d:	eb f0                	jmp    80172f <dev_lookup+0x60>
+
+000000000080173f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	41 55                	push   %r13
+  801745:	41 54                	push   %r12
+  801747:	53                   	push   %rbx
+  801748:	48 83 ec 18          	sub    $0x18,%rsp
+  80174c:	48 89 fb             	mov    %rdi,%rbx
+  80174f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801752:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801759:	ff ff ff 
+  80175c:	48 01 df             	add    %rbx,%rdi
+  80175f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801763:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801767:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  80176e:	00 00 00 
+  801771:	ff d0                	call   *%rax
+  801773:	41 89 c5             	mov    %eax,%r13d
+  801776:	85 c0                	test   %eax,%eax
+  801778:	78 06                	js     801780 <fd_close+0x41>
+  80177a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80177e:	74 1a                	je     80179a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801780:	45 84 e4             	test   %r12b,%r12b
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+  801788:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80178c:	44 89 e8             	mov    %r13d,%eax
+  80178f:	48 83 c4 18          	add    $0x18,%rsp
+  801793:	5b                   	pop    %rbx
+  801794:	41 5c                	pop    %r12
+  801796:	41 5d                	pop    %r13
+  801798:	5d                   	pop    %rbp
+  801799:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80179a:	8b 3b                	mov    (%rbx),%edi
+  80179c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017a0:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+  8017ac:	41 89 c5             	mov    %eax,%r13d
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 1b                	js     8017ce <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017b7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8017bb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017c1:	48 85 c0             	test   %rax,%rax
+  8017c4:	74 08                	je     8017ce <fd_close+0x8f>
+  8017c6:	48 89 df             	mov    %rbx,%rdi
+  8017c9:	ff d0                	call   *%rax
+  8017cb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017d3:	48 89 de             	mov    %rbx,%rsi
+  8017d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017db:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+    return res;
+  8017e7:	eb a3                	jmp    80178c <fd_close+0x4d>
+
+00000000008017e9 <close>:
+
+int
+close(int fdnum) {
+  8017e9:	55                   	push   %rbp
+  8017ea:	48 89 e5             	mov    %rsp,%rbp
+  8017ed:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8017f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017f5:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 15                	js     80181a <close+0x31>
+
+    return fd_close(fd, 1);
+  801805:	be 01 00 00 00       	mov    $0x1,%esi
+  80180a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80180e:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  801815:	00 00 00 
+  801818:	ff d0                	call   *%rax
+}
+  80181a:	c9                   	leave
+  80181b:	c3                   	ret
+
+000000000080181c <close_all>:
+
+void
+close_all(void) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	41 54                	push   %r12
+  801822:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801823:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801828:	49 bc e9 17 80 00 00 	movabs $0x8017e9,%r12
+  80182f:	00 00 00 
+  801832:	89 df                	mov    %ebx,%edi
+  801834:	41 ff d4             	call   *%r12
+  801837:	83 c3 01             	add    $0x1,%ebx
+  80183a:	83 fb 20             	cmp    $0x20,%ebx
+  80183d:	75 f3                	jne    801832 <close_all+0x16>
+}
+  80183f:	5b                   	pop    %rbx
+  801840:	41 5c                	pop    %r12
+  801842:	5d                   	pop    %rbp
+  801843:	c3                   	ret
+
+0000000000801844 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	41 57                	push   %r15
+  80184a:	41 56                	push   %r14
+  80184c:	41 55                	push   %r13
+  80184e:	41 54                	push   %r12
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 18          	sub    $0x18,%rsp
+  801855:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801858:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80185c:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801863:	00 00 00 
+  801866:	ff d0                	call   *%rax
+  801868:	89 c3                	mov    %eax,%ebx
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	0f 88 b8 00 00 00    	js     80192a <dup+0xe6>
+    close(newfdnum);
+  801872:	44 89 e7             	mov    %r12d,%edi
+  801875:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  80187c:	00 00 00 
+  80187f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801881:	4d 63 ec             	movslq %r12d,%r13
+  801884:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80188b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80188f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801893:	4c 89 ff             	mov    %r15,%rdi
+  801896:	49 be 08 16 80 00 00 	movabs $0x801608,%r14
+  80189d:	00 00 00 
+  8018a0:	41 ff d6             	call   *%r14
+  8018a3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018a6:	4c 89 ef             	mov    %r13,%rdi
+  8018a9:	41 ff d6             	call   *%r14
+  8018ac:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018af:	48 89 df             	mov    %rbx,%rdi
+  8018b2:	48 b8 43 31 80 00 00 	movabs $0x803143,%rax
+  8018b9:	00 00 00 
+  8018bc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018be:	a8 04                	test   $0x4,%al
+  8018c0:	74 2b                	je     8018ed <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018c2:	41 89 c1             	mov    %eax,%r9d
+  8018c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018cb:	4c 89 f1             	mov    %r14,%rcx
+  8018ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d3:	48 89 de             	mov    %rbx,%rsi
+  8018d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018db:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  8018e2:	00 00 00 
+  8018e5:	ff d0                	call   *%rax
+  8018e7:	89 c3                	mov    %eax,%ebx
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 4e                	js     80193b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8018ed:	4c 89 ff             	mov    %r15,%rdi
+  8018f0:	48 b8 43 31 80 00 00 	movabs $0x803143,%rax
+  8018f7:	00 00 00 
+  8018fa:	ff d0                	call   *%rax
+  8018fc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8018ff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801905:	4c 89 e9             	mov    %r13,%rcx
+  801908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190d:	4c 89 fe             	mov    %r15,%rsi
+  801910:	bf 00 00 00 00       	mov    $0x0,%edi
+  801915:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  80191c:	00 00 00 
+  80191f:	ff d0                	call   *%rax
+  801921:	89 c3                	mov    %eax,%ebx
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 14                	js     80193b <dup+0xf7>
+
+    return newfdnum;
+  801927:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80192a:	89 d8                	mov    %ebx,%eax
+  80192c:	48 83 c4 18          	add    $0x18,%rsp
+  801930:	5b                   	pop    %rbx
+  801931:	41 5c                	pop    %r12
+  801933:	41 5d                	pop    %r13
+  801935:	41 5e                	pop    %r14
+  801937:	41 5f                	pop    %r15
+  801939:	5d                   	pop    %rbp
+  80193a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80193b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801940:	4c 89 ee             	mov    %r13,%rsi
+  801943:	bf 00 00 00 00       	mov    $0x0,%edi
+  801948:	49 bc f2 12 80 00 00 	movabs $0x8012f2,%r12
+  80194f:	00 00 00 
+  801952:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801955:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80195a:	4c 89 f6             	mov    %r14,%rsi
+  80195d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801962:	41 ff d4             	call   *%r12
+    return res;
+  801965:	eb c3                	jmp    80192a <dup+0xe6>
+
+0000000000801967 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+  80196b:	41 56                	push   %r14
+  80196d:	41 55                	push   %r13
+  80196f:	41 54                	push   %r12
+  801971:	53                   	push   %rbx
+  801972:	48 83 ec 10          	sub    $0x10,%rsp
+  801976:	89 fb                	mov    %edi,%ebx
+  801978:	49 89 f4             	mov    %rsi,%r12
+  80197b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80197e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801982:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801989:	00 00 00 
+  80198c:	ff d0                	call   *%rax
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 4c                	js     8019de <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801992:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801996:	41 8b 3e             	mov    (%r14),%edi
+  801999:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80199d:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	78 35                	js     8019e2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019ad:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019b1:	83 e0 03             	and    $0x3,%eax
+  8019b4:	83 f8 01             	cmp    $0x1,%eax
+  8019b7:	74 2d                	je     8019e6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019bd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019c1:	48 85 c0             	test   %rax,%rax
+  8019c4:	74 56                	je     801a1c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019c6:	4c 89 ea             	mov    %r13,%rdx
+  8019c9:	4c 89 e6             	mov    %r12,%rsi
+  8019cc:	4c 89 f7             	mov    %r14,%rdi
+  8019cf:	ff d0                	call   *%rax
+}
+  8019d1:	48 83 c4 10          	add    $0x10,%rsp
+  8019d5:	5b                   	pop    %rbx
+  8019d6:	41 5c                	pop    %r12
+  8019d8:	41 5d                	pop    %r13
+  8019da:	41 5e                	pop    %r14
+  8019dc:	5d                   	pop    %rbp
+  8019dd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019de:	48 98                	cltq
+  8019e0:	eb ef                	jmp    8019d1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019e2:	48 98                	cltq
+  8019e4:	eb eb                	jmp    8019d1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019e6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019ed:	00 00 00 
+  8019f0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019f6:	89 da                	mov    %ebx,%edx
+  8019f8:	48 bf b9 3d 80 00 00 	movabs $0x803db9,%rdi
+  8019ff:	00 00 00 
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	48 b9 75 02 80 00 00 	movabs $0x800275,%rcx
+  801a0e:	00 00 00 
+  801a11:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a13:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a1a:	eb b5                	jmp    8019d1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a1c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a23:	eb ac                	jmp    8019d1 <read+0x6a>
+
+0000000000801a25 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a25:	55                   	push   %rbp
+  801a26:	48 89 e5             	mov    %rsp,%rbp
+  801a29:	41 56                	push   %r14
+  801a2b:	41 55                	push   %r13
+  801a2d:	41 54                	push   %r12
+  801a2f:	53                   	push   %rbx
+  801a30:	48 83 ec 10          	sub    $0x10,%rsp
+  801a34:	89 fb                	mov    %edi,%ebx
+  801a36:	49 89 f4             	mov    %rsi,%r12
+  801a39:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a3c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a40:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801a47:	00 00 00 
+  801a4a:	ff d0                	call   *%rax
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 41                	js     801a91 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a50:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a54:	41 8b 3e             	mov    (%r14),%edi
+  801a57:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5b:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 35                	js     801aa0 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a6b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a6f:	83 e0 03             	and    $0x3,%eax
+  801a72:	83 f8 01             	cmp    $0x1,%eax
+  801a75:	74 2d                	je     801aa4 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a7b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a7f:	48 85 c0             	test   %rax,%rax
+  801a82:	74 56                	je     801ada <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801a84:	4c 89 ea             	mov    %r13,%rdx
+  801a87:	4c 89 e6             	mov    %r12,%rsi
+  801a8a:	4c 89 f7             	mov    %r14,%rdi
+  801a8d:	ff d0                	call   *%rax
+  801a8f:	eb 02                	jmp    801a93 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a91:	48 98                	cltq
+}
+  801a93:	48 83 c4 10          	add    $0x10,%rsp
+  801a97:	5b                   	pop    %rbx
+  801a98:	41 5c                	pop    %r12
+  801a9a:	41 5d                	pop    %r13
+  801a9c:	41 5e                	pop    %r14
+  801a9e:	5d                   	pop    %rbp
+  801a9f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aa0:	48 98                	cltq
+  801aa2:	eb ef                	jmp    801a93 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aa4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801aab:	00 00 00 
+  801aae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ab4:	89 da                	mov    %ebx,%edx
+  801ab6:	48 bf 78 3d 80 00 00 	movabs $0x803d78,%rdi
+  801abd:	00 00 00 
+  801ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac5:	48 b9 75 02 80 00 00 	movabs $0x800275,%rcx
+  801acc:	00 00 00 
+  801acf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ad1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ad8:	eb b9                	jmp    801a93 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ada:	4c 89 ea             	mov    %r13,%rdx
+  801add:	4c 89 e6             	mov    %r12,%rsi
+  801ae0:	89 df                	mov    %ebx,%edi
+  801ae2:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  801aee:	eb a3                	jmp    801a93 <readmap+0x6e>
+
+0000000000801af0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801af0:	55                   	push   %rbp
+  801af1:	48 89 e5             	mov    %rsp,%rbp
+  801af4:	41 57                	push   %r15
+  801af6:	41 56                	push   %r14
+  801af8:	41 55                	push   %r13
+  801afa:	41 54                	push   %r12
+  801afc:	53                   	push   %rbx
+  801afd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b01:	48 85 d2             	test   %rdx,%rdx
+  801b04:	74 54                	je     801b5a <readn+0x6a>
+  801b06:	41 89 fd             	mov    %edi,%r13d
+  801b09:	49 89 f6             	mov    %rsi,%r14
+  801b0c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b14:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b19:	49 bf 67 19 80 00 00 	movabs $0x801967,%r15
+  801b20:	00 00 00 
+  801b23:	4c 89 e2             	mov    %r12,%rdx
+  801b26:	48 29 f2             	sub    %rsi,%rdx
+  801b29:	4c 01 f6             	add    %r14,%rsi
+  801b2c:	44 89 ef             	mov    %r13d,%edi
+  801b2f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	78 20                	js     801b56 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b36:	01 c3                	add    %eax,%ebx
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	74 08                	je     801b44 <readn+0x54>
+  801b3c:	48 63 f3             	movslq %ebx,%rsi
+  801b3f:	4c 39 e6             	cmp    %r12,%rsi
+  801b42:	72 df                	jb     801b23 <readn+0x33>
+    }
+    return res;
+  801b44:	48 63 c3             	movslq %ebx,%rax
+}
+  801b47:	48 83 c4 08          	add    $0x8,%rsp
+  801b4b:	5b                   	pop    %rbx
+  801b4c:	41 5c                	pop    %r12
+  801b4e:	41 5d                	pop    %r13
+  801b50:	41 5e                	pop    %r14
+  801b52:	41 5f                	pop    %r15
+  801b54:	5d                   	pop    %rbp
+  801b55:	c3                   	ret
+        if (inc < 0) return inc;
+  801b56:	48 98                	cltq
+  801b58:	eb ed                	jmp    801b47 <readn+0x57>
+    int inc = 1, res = 0;
+  801b5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5f:	eb e3                	jmp    801b44 <readn+0x54>
+
+0000000000801b61 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b61:	55                   	push   %rbp
+  801b62:	48 89 e5             	mov    %rsp,%rbp
+  801b65:	41 56                	push   %r14
+  801b67:	41 55                	push   %r13
+  801b69:	41 54                	push   %r12
+  801b6b:	53                   	push   %rbx
+  801b6c:	48 83 ec 10          	sub    $0x10,%rsp
+  801b70:	89 fb                	mov    %edi,%ebx
+  801b72:	49 89 f4             	mov    %rsi,%r12
+  801b75:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b78:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b7c:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 47                	js     801bd3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b8c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b90:	41 8b 3e             	mov    (%r14),%edi
+  801b93:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b97:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	78 30                	js     801bd7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ba7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bac:	74 2d                	je     801bdb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bb2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bb6:	48 85 c0             	test   %rax,%rax
+  801bb9:	74 56                	je     801c11 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bbb:	4c 89 ea             	mov    %r13,%rdx
+  801bbe:	4c 89 e6             	mov    %r12,%rsi
+  801bc1:	4c 89 f7             	mov    %r14,%rdi
+  801bc4:	ff d0                	call   *%rax
+}
+  801bc6:	48 83 c4 10          	add    $0x10,%rsp
+  801bca:	5b                   	pop    %rbx
+  801bcb:	41 5c                	pop    %r12
+  801bcd:	41 5d                	pop    %r13
+  801bcf:	41 5e                	pop    %r14
+  801bd1:	5d                   	pop    %rbp
+  801bd2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd3:	48 98                	cltq
+  801bd5:	eb ef                	jmp    801bc6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bd7:	48 98                	cltq
+  801bd9:	eb eb                	jmp    801bc6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bdb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801be2:	00 00 00 
+  801be5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801beb:	89 da                	mov    %ebx,%edx
+  801bed:	48 bf d5 3d 80 00 00 	movabs $0x803dd5,%rdi
+  801bf4:	00 00 00 
+  801bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfc:	48 b9 75 02 80 00 00 	movabs $0x800275,%rcx
+  801c03:	00 00 00 
+  801c06:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c08:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c0f:	eb b5                	jmp    801bc6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c11:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c18:	eb ac                	jmp    801bc6 <write+0x65>
+
+0000000000801c1a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c1a:	55                   	push   %rbp
+  801c1b:	48 89 e5             	mov    %rsp,%rbp
+  801c1e:	53                   	push   %rbx
+  801c1f:	48 83 ec 18          	sub    $0x18,%rsp
+  801c23:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c29:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801c30:	00 00 00 
+  801c33:	ff d0                	call   *%rax
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	78 0c                	js     801c45 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c3d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c49:	c9                   	leave
+  801c4a:	c3                   	ret
+
+0000000000801c4b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c4b:	55                   	push   %rbp
+  801c4c:	48 89 e5             	mov    %rsp,%rbp
+  801c4f:	41 55                	push   %r13
+  801c51:	41 54                	push   %r12
+  801c53:	53                   	push   %rbx
+  801c54:	48 83 ec 18          	sub    $0x18,%rsp
+  801c58:	89 fb                	mov    %edi,%ebx
+  801c5a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c61:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801c68:	00 00 00 
+  801c6b:	ff d0                	call   *%rax
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	78 38                	js     801ca9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c71:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c75:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c79:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c7d:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 1c                	js     801ca9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c8d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c92:	74 20                	je     801cb4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c98:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c9c:	48 85 c0             	test   %rax,%rax
+  801c9f:	74 47                	je     801ce8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ca1:	44 89 e6             	mov    %r12d,%esi
+  801ca4:	4c 89 ef             	mov    %r13,%rdi
+  801ca7:	ff d0                	call   *%rax
+}
+  801ca9:	48 83 c4 18          	add    $0x18,%rsp
+  801cad:	5b                   	pop    %rbx
+  801cae:	41 5c                	pop    %r12
+  801cb0:	41 5d                	pop    %r13
+  801cb2:	5d                   	pop    %rbp
+  801cb3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cb4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cbb:	00 00 00 
+  801cbe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cc4:	89 da                	mov    %ebx,%edx
+  801cc6:	48 bf 98 3d 80 00 00 	movabs $0x803d98,%rdi
+  801ccd:	00 00 00 
+  801cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd5:	48 b9 75 02 80 00 00 	movabs $0x800275,%rcx
+  801cdc:	00 00 00 
+  801cdf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ce1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce6:	eb c1                	jmp    801ca9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ce8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ced:	eb ba                	jmp    801ca9 <ftruncate+0x5e>
+
+0000000000801cef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801cef:	55                   	push   %rbp
+  801cf0:	48 89 e5             	mov    %rsp,%rbp
+  801cf3:	41 54                	push   %r12
+  801cf5:	53                   	push   %rbx
+  801cf6:	48 83 ec 10          	sub    $0x10,%rsp
+  801cfa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d01:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+  801d0d:	85 c0                	test   %eax,%eax
+  801d0f:	78 4e                	js     801d5f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d11:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d15:	41 8b 3c 24          	mov    (%r12),%edi
+  801d19:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d1d:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 32                	js     801d5f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d31:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d36:	74 30                	je     801d68 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d38:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d3b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d42:	00 00 00 
+    stat->st_isdir = 0;
+  801d45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d4c:	00 00 00 
+    stat->st_dev = dev;
+  801d4f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d56:	48 89 de             	mov    %rbx,%rsi
+  801d59:	4c 89 e7             	mov    %r12,%rdi
+  801d5c:	ff 50 30             	call   *0x30(%rax)
+}
+  801d5f:	48 83 c4 10          	add    $0x10,%rsp
+  801d63:	5b                   	pop    %rbx
+  801d64:	41 5c                	pop    %r12
+  801d66:	5d                   	pop    %rbp
+  801d67:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d68:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d6d:	eb f0                	jmp    801d5f <fstat+0x70>
+
+0000000000801d6f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+  801d73:	41 54                	push   %r12
+  801d75:	53                   	push   %rbx
+  801d76:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d79:	be 00 00 00 00       	mov    $0x0,%esi
+  801d7e:	48 b8 c6 2a 80 00 00 	movabs $0x802ac6,%rax
+  801d85:	00 00 00 
+  801d88:	ff d0                	call   *%rax
+  801d8a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 25                	js     801db5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d90:	4c 89 e6             	mov    %r12,%rsi
+  801d93:	89 c7                	mov    %eax,%edi
+  801d95:	48 b8 ef 1c 80 00 00 	movabs $0x801cef,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+  801da1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801da4:	89 df                	mov    %ebx,%edi
+  801da6:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  801dad:	00 00 00 
+  801db0:	ff d0                	call   *%rax
+
+    return res;
+  801db2:	44 89 e3             	mov    %r12d,%ebx
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	5b                   	pop    %rbx
+  801db8:	41 5c                	pop    %r12
+  801dba:	5d                   	pop    %rbp
+  801dbb:	c3                   	ret
+
+0000000000801dbc <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801dbc:	55                   	push   %rbp
+  801dbd:	48 89 e5             	mov    %rsp,%rbp
+  801dc0:	41 54                	push   %r12
+  801dc2:	53                   	push   %rbx
+  801dc3:	48 83 ec 10          	sub    $0x10,%rsp
+  801dc7:	48 89 fb             	mov    %rdi,%rbx
+  801dca:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dd1:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dd6:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801ddd:	00 00 00 
+  801de0:	ff d0                	call   *%rax
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 1f                	js     801e05 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801de6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dea:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801dee:	48 85 c0             	test   %rax,%rax
+  801df1:	74 1b                	je     801e0e <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801df3:	4c 89 e6             	mov    %r12,%rsi
+  801df6:	48 89 df             	mov    %rbx,%rdi
+  801df9:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e02:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e05:	48 83 c4 10          	add    $0x10,%rsp
+  801e09:	5b                   	pop    %rbx
+  801e0a:	41 5c                	pop    %r12
+  801e0c:	5d                   	pop    %rbp
+  801e0d:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e0e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e13:	eb f0                	jmp    801e05 <create_snapshot+0x49>
+
+0000000000801e15 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+  801e19:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e1d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e21:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e26:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 1e                	js     801e54 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e3a:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e3e:	48 85 d2             	test   %rdx,%rdx
+  801e41:	74 13                	je     801e56 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e48:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801e4a:	85 c0                	test   %eax,%eax
+  801e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e51:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e56:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e5b:	eb f7                	jmp    801e54 <print_snapshot_list+0x3f>
+
+0000000000801e5d <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801e5d:	55                   	push   %rbp
+  801e5e:	48 89 e5             	mov    %rsp,%rbp
+  801e61:	53                   	push   %rbx
+  801e62:	48 83 ec 18          	sub    $0x18,%rsp
+  801e66:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e69:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e6d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e72:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801e79:	00 00 00 
+  801e7c:	ff d0                	call   *%rax
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	78 1c                	js     801e9e <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801e82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e86:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801e8a:	48 85 c0             	test   %rax,%rax
+  801e8d:	74 15                	je     801ea4 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801e8f:	48 89 df             	mov    %rbx,%rdi
+  801e92:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ea4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ea9:	eb f3                	jmp    801e9e <accept_snapshot+0x41>
+
+0000000000801eab <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	53                   	push   %rbx
+  801eb0:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb4:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801eb7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ebb:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ec0:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801ec7:	00 00 00 
+  801eca:	ff d0                	call   *%rax
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 1c                	js     801eec <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801ed0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ed4:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801ed8:	48 85 c0             	test   %rax,%rax
+  801edb:	74 15                	je     801ef2 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801edd:	48 89 df             	mov    %rbx,%rdi
+  801ee0:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ee2:	85 c0                	test   %eax,%eax
+  801ee4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801eec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef0:	c9                   	leave
+  801ef1:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ef2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ef7:	eb f3                	jmp    801eec <delete_snapshot+0x41>
+
+0000000000801ef9 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801ef9:	55                   	push   %rbp
+  801efa:	48 89 e5             	mov    %rsp,%rbp
+  801efd:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f01:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f05:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f0a:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801f11:	00 00 00 
+  801f14:	ff d0                	call   *%rax
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 14                	js     801f2e <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801f1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f1e:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f22:	48 85 d2             	test   %rdx,%rdx
+  801f25:	74 09                	je     801f30 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2c:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f2e:	c9                   	leave
+  801f2f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f35:	eb f7                	jmp    801f2e <gc_snapshots+0x35>
+
+0000000000801f37 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f37:	55                   	push   %rbp
+  801f38:	48 89 e5             	mov    %rsp,%rbp
+  801f3b:	41 56                	push   %r14
+  801f3d:	41 55                	push   %r13
+  801f3f:	41 54                	push   %r12
+  801f41:	53                   	push   %rbx
+  801f42:	48 83 ec 10          	sub    $0x10,%rsp
+  801f46:	48 89 fb             	mov    %rdi,%rbx
+  801f49:	49 89 f4             	mov    %rsi,%r12
+  801f4c:	49 89 d5             	mov    %rdx,%r13
+  801f4f:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f52:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f56:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f5b:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 1b                	js     801f86 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801f6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f6f:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801f73:	48 85 c0             	test   %rax,%rax
+  801f76:	74 1b                	je     801f93 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801f78:	4c 89 f1             	mov    %r14,%rcx
+  801f7b:	4c 89 ea             	mov    %r13,%rdx
+  801f7e:	4c 89 e6             	mov    %r12,%rsi
+  801f81:	48 89 df             	mov    %rbx,%rdi
+  801f84:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f86:	48 83 c4 10          	add    $0x10,%rsp
+  801f8a:	5b                   	pop    %rbx
+  801f8b:	41 5c                	pop    %r12
+  801f8d:	41 5d                	pop    %r13
+  801f8f:	41 5e                	pop    %r14
+  801f91:	5d                   	pop    %rbp
+  801f92:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f93:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f98:	eb ec                	jmp    801f86 <diff_snapshots+0x4f>
+
+0000000000801f9a <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	41 55                	push   %r13
+  801fa0:	41 54                	push   %r12
+  801fa2:	53                   	push   %rbx
+  801fa3:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa7:	48 89 fb             	mov    %rdi,%rbx
+  801faa:	49 89 f4             	mov    %rsi,%r12
+  801fad:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fb4:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fb9:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  801fc0:	00 00 00 
+  801fc3:	ff d0                	call   *%rax
+  801fc5:	85 c0                	test   %eax,%eax
+  801fc7:	78 18                	js     801fe1 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801fc9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fcd:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801fd1:	48 85 c0             	test   %rax,%rax
+  801fd4:	74 16                	je     801fec <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801fd6:	4c 89 ea             	mov    %r13,%rdx
+  801fd9:	4c 89 e6             	mov    %r12,%rsi
+  801fdc:	48 89 df             	mov    %rbx,%rdi
+  801fdf:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fe1:	48 83 c4 18          	add    $0x18,%rsp
+  801fe5:	5b                   	pop    %rbx
+  801fe6:	41 5c                	pop    %r12
+  801fe8:	41 5d                	pop    %r13
+  801fea:	5d                   	pop    %rbp
+  801feb:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff1:	eb ee                	jmp    801fe1 <send_snapshot+0x47>
+
+0000000000801ff3 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801ff3:	55                   	push   %rbp
+  801ff4:	48 89 e5             	mov    %rsp,%rbp
+  801ff7:	53                   	push   %rbx
+  801ff8:	48 83 ec 18          	sub    $0x18,%rsp
+  801ffc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fff:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802003:	bf 66 00 00 00       	mov    $0x66,%edi
+  802008:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 12                	js     80202a <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80201c:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802020:	48 85 c0             	test   %rax,%rax
+  802023:	74 0b                	je     802030 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802025:	48 89 df             	mov    %rbx,%rdi
+  802028:	ff d0                	call   *%rax
+
+    return res;
+}
+  80202a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80202e:	c9                   	leave
+  80202f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802030:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802035:	eb f3                	jmp    80202a <receive_snapshot+0x37>
+
+0000000000802037 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80203f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802043:	bf 66 00 00 00       	mov    $0x66,%edi
+  802048:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	85 c0                	test   %eax,%eax
+  802056:	78 17                	js     80206f <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802058:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80205c:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802063:	48 85 d2             	test   %rdx,%rdx
+  802066:	74 09                	je     802071 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80206f:	c9                   	leave
+  802070:	c3                   	ret
+        return -E_NOT_SUPP;
+  802071:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802076:	eb f7                	jmp    80206f <free_space_bytes+0x38>
+
+0000000000802078 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802078:	55                   	push   %rbp
+  802079:	48 89 e5             	mov    %rsp,%rbp
+  80207c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802080:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802084:	bf 66 00 00 00       	mov    $0x66,%edi
+  802089:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 17                	js     8020b0 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802099:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80209d:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8020a4:	48 85 d2             	test   %rdx,%rdx
+  8020a7:	74 09                	je     8020b2 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020b0:	c9                   	leave
+  8020b1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b7:	eb f7                	jmp    8020b0 <busy_space_bytes+0x38>
+
+00000000008020b9 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	41 54                	push   %r12
+  8020bf:	53                   	push   %rbx
+  8020c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020c4:	89 fb                	mov    %edi,%ebx
+  8020c6:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020c9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020cd:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020d2:	48 b8 cf 16 80 00 00 	movabs $0x8016cf,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 17                	js     8020f9 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8020e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e6:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8020ed:	48 85 c0             	test   %rax,%rax
+  8020f0:	74 10                	je     802102 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8020f2:	4c 89 e6             	mov    %r12,%rsi
+  8020f5:	89 df                	mov    %ebx,%edi
+  8020f7:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8020f9:	48 83 c4 10          	add    $0x10,%rsp
+  8020fd:	5b                   	pop    %rbx
+  8020fe:	41 5c                	pop    %r12
+  802100:	5d                   	pop    %rbp
+  802101:	c3                   	ret
+        return -E_NOT_SUPP;
+  802102:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802107:	eb f0                	jmp    8020f9 <snapshots_space+0x40>
+
+0000000000802109 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802109:	55                   	push   %rbp
+  80210a:	48 89 e5             	mov    %rsp,%rbp
+  80210d:	41 55                	push   %r13
+  80210f:	41 54                	push   %r12
+  802111:	53                   	push   %rbx
+  802112:	48 83 ec 08          	sub    $0x8,%rsp
+  802116:	41 89 fd             	mov    %edi,%r13d
+  802119:	48 89 f3             	mov    %rsi,%rbx
+  80211c:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80211f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802126:	00 00 00 
+  802129:	83 38 00             	cmpl   $0x0,(%rax)
+  80212c:	74 57                	je     802185 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80212e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802134:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802139:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802140:	00 00 00 
+  802143:	44 89 ee             	mov    %r13d,%esi
+  802146:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80214d:	00 00 00 
+  802150:	8b 38                	mov    (%rax),%edi
+  802152:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80215e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802163:	4c 89 e2             	mov    %r12,%rdx
+  802166:	48 89 de             	mov    %rbx,%rsi
+  802169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216e:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+}
+  80217a:	48 83 c4 08          	add    $0x8,%rsp
+  80217e:	5b                   	pop    %rbx
+  80217f:	41 5c                	pop    %r12
+  802181:	41 5d                	pop    %r13
+  802183:	5d                   	pop    %rbp
+  802184:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802185:	bf 03 00 00 00       	mov    $0x3,%edi
+  80218a:	48 b8 e7 36 80 00 00 	movabs $0x8036e7,%rax
+  802191:	00 00 00 
+  802194:	ff d0                	call   *%rax
+  802196:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80219d:	00 00 
+  80219f:	eb 8d                	jmp    80212e <fsipc_region+0x25>
+
+00000000008021a1 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8021a1:	55                   	push   %rbp
+  8021a2:	48 89 e5             	mov    %rsp,%rbp
+  8021a5:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8021a9:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8021b0:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8021b1:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8021b5:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+}
+  8021c1:	c9                   	leave
+  8021c2:	c3                   	ret
+
+00000000008021c3 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8021c3:	85 ff                	test   %edi,%edi
+  8021c5:	78 6d                	js     802234 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+  8021cb:	41 54                	push   %r12
+  8021cd:	53                   	push   %rbx
+  8021ce:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8021d1:	48 85 f6             	test   %rsi,%rsi
+  8021d4:	74 57                	je     80222d <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8021d6:	89 f8                	mov    %edi,%eax
+  8021d8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021df:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8021e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e6:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021eb:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8021f2:	00 00 00 
+  8021f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	78 2d                	js     802228 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8021fb:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802202:	00 00 00 
+  802205:	49 63 14 24          	movslq (%r12),%rdx
+  802209:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802210:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802215:	48 89 df             	mov    %rbx,%rdi
+  802218:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802224:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802228:	5b                   	pop    %rbx
+  802229:	41 5c                	pop    %r12
+  80222b:	5d                   	pop    %rbp
+  80222c:	c3                   	ret
+        return -E_INVAL;
+  80222d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802232:	eb f4                	jmp    802228 <devfile_df_snapshots+0x65>
+  802234:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802239:	c3                   	ret
+
+000000000080223a <devfile_df_busy>:
+devfile_df_busy() {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80223e:	be 00 00 00 00       	mov    $0x0,%esi
+  802243:	bf 11 00 00 00       	mov    $0x11,%edi
+  802248:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+}
+  802254:	5d                   	pop    %rbp
+  802255:	c3                   	ret
+
+0000000000802256 <devfile_df_free>:
+devfile_df_free() {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80225a:	be 00 00 00 00       	mov    $0x0,%esi
+  80225f:	bf 10 00 00 00       	mov    $0x10,%edi
+  802264:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+}
+  802270:	5d                   	pop    %rbp
+  802271:	c3                   	ret
+
+0000000000802272 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802272:	55                   	push   %rbp
+  802273:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802276:	be 00 00 00 00       	mov    $0x0,%esi
+  80227b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802280:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802287:	00 00 00 
+  80228a:	ff d0                	call   *%rax
+}
+  80228c:	5d                   	pop    %rbp
+  80228d:	c3                   	ret
+
+000000000080228e <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80228e:	55                   	push   %rbp
+  80228f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802292:	be 00 00 00 00       	mov    $0x0,%esi
+  802297:	bf 09 00 00 00       	mov    $0x9,%edi
+  80229c:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022af:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8022b2:	5d                   	pop    %rbp
+  8022b3:	c3                   	ret
+
+00000000008022b4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022b8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022bf:	00 00 00 
+  8022c2:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022c5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022c7:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cf:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022d4:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+}
+  8022e0:	5d                   	pop    %rbp
+  8022e1:	c3                   	ret
+
+00000000008022e2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022e2:	55                   	push   %rbp
+  8022e3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022e6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022e9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022f0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022fc:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+}
+  802308:	5d                   	pop    %rbp
+  802309:	c3                   	ret
+
+000000000080230a <devfile_write>:
+    if (!fd || !buf) {
+  80230a:	48 85 ff             	test   %rdi,%rdi
+  80230d:	0f 84 c1 00 00 00    	je     8023d4 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802313:	55                   	push   %rbp
+  802314:	48 89 e5             	mov    %rsp,%rbp
+  802317:	41 57                	push   %r15
+  802319:	41 56                	push   %r14
+  80231b:	41 55                	push   %r13
+  80231d:	41 54                	push   %r12
+  80231f:	53                   	push   %rbx
+  802320:	48 83 ec 18          	sub    $0x18,%rsp
+  802324:	49 89 ff             	mov    %rdi,%r15
+  802327:	49 89 f5             	mov    %rsi,%r13
+  80232a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80232d:	48 85 f6             	test   %rsi,%rsi
+  802330:	0f 84 95 00 00 00    	je     8023cb <devfile_write+0xc1>
+    while (n) {
+  802336:	48 85 d2             	test   %rdx,%rdx
+  802339:	0f 84 83 00 00 00    	je     8023c2 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80233f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802346:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80234d:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802350:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802355:	49 39 dc             	cmp    %rbx,%r12
+  802358:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80235c:	48 89 da             	mov    %rbx,%rdx
+  80235f:	4c 89 ee             	mov    %r13,%rsi
+  802362:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802369:	00 00 00 
+  80236c:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  802373:	00 00 00 
+  802376:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802378:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80237c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80237f:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802383:	be 00 00 00 00       	mov    $0x0,%esi
+  802388:	bf 04 00 00 00       	mov    $0x4,%edi
+  80238d:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+        if (write < 0) {
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 21                	js     8023be <devfile_write+0xb4>
+        buf += write;
+  80239d:	48 63 d0             	movslq %eax,%rdx
+  8023a0:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8023a3:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8023a6:	49 29 d4             	sub    %rdx,%r12
+  8023a9:	75 a5                	jne    802350 <devfile_write+0x46>
+    return totalWrite;
+  8023ab:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8023af:	48 83 c4 18          	add    $0x18,%rsp
+  8023b3:	5b                   	pop    %rbx
+  8023b4:	41 5c                	pop    %r12
+  8023b6:	41 5d                	pop    %r13
+  8023b8:	41 5e                	pop    %r14
+  8023ba:	41 5f                	pop    %r15
+  8023bc:	5d                   	pop    %rbp
+  8023bd:	c3                   	ret
+            return write;
+  8023be:	48 98                	cltq
+  8023c0:	eb ed                	jmp    8023af <devfile_write+0xa5>
+    int totalWrite = 0;
+  8023c2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8023c9:	eb e0                	jmp    8023ab <devfile_write+0xa1>
+        return -E_INVAL;
+  8023cb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023d2:	eb db                	jmp    8023af <devfile_write+0xa5>
+  8023d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023db:	c3                   	ret
+
+00000000008023dc <devfile_read>:
+    if (!fd || !buf) {
+  8023dc:	48 85 ff             	test   %rdi,%rdi
+  8023df:	0f 84 c0 00 00 00    	je     8024a5 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023e5:	55                   	push   %rbp
+  8023e6:	48 89 e5             	mov    %rsp,%rbp
+  8023e9:	41 57                	push   %r15
+  8023eb:	41 56                	push   %r14
+  8023ed:	41 55                	push   %r13
+  8023ef:	41 54                	push   %r12
+  8023f1:	53                   	push   %rbx
+  8023f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8023f6:	49 89 ff             	mov    %rdi,%r15
+  8023f9:	49 89 f5             	mov    %rsi,%r13
+  8023fc:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023ff:	48 85 f6             	test   %rsi,%rsi
+  802402:	0f 84 96 00 00 00    	je     80249e <devfile_read+0xc2>
+    while (n) {
+  802408:	48 85 d2             	test   %rdx,%rdx
+  80240b:	0f 84 87 00 00 00    	je     802498 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802411:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802418:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802419:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802420:	00 00 00 
+  802423:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802427:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80242a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80242f:	49 39 c4             	cmp    %rax,%r12
+  802432:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802436:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80243a:	be 00 00 00 00       	mov    $0x0,%esi
+  80243f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802444:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802450:	85 c0                	test   %eax,%eax
+  802452:	7e 37                	jle    80248b <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802454:	48 63 d8             	movslq %eax,%rbx
+  802457:	48 89 da             	mov    %rbx,%rdx
+  80245a:	4c 89 f6             	mov    %r14,%rsi
+  80245d:	4c 89 ef             	mov    %r13,%rdi
+  802460:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+        buf += read;
+  80246c:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80246f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802473:	49 29 dc             	sub    %rbx,%r12
+  802476:	75 ab                	jne    802423 <devfile_read+0x47>
+  return totalRead;
+  802478:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80247c:	48 83 c4 18          	add    $0x18,%rsp
+  802480:	5b                   	pop    %rbx
+  802481:	41 5c                	pop    %r12
+  802483:	41 5d                	pop    %r13
+  802485:	41 5e                	pop    %r14
+  802487:	41 5f                	pop    %r15
+  802489:	5d                   	pop    %rbp
+  80248a:	c3                   	ret
+            return read ? read : totalRead;
+  80248b:	48 63 d0             	movslq %eax,%rdx
+  80248e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802492:	48 0f 45 c2          	cmovne %rdx,%rax
+  802496:	eb e4                	jmp    80247c <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802498:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80249c:	eb da                	jmp    802478 <devfile_read+0x9c>
+        return E_INVAL;
+  80249e:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024a3:	eb d7                	jmp    80247c <devfile_read+0xa0>
+  8024a5:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8024aa:	c3                   	ret
+
+00000000008024ab <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024ab:	48 85 ff             	test   %rdi,%rdi
+  8024ae:	74 5f                	je     80250f <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	53                   	push   %rbx
+  8024b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b9:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024bc:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+  8024c8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024ce:	77 45                	ja     802515 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8024d0:	48 89 de             	mov    %rbx,%rsi
+  8024d3:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024da:	00 00 00 
+  8024dd:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  8024e4:	00 00 00 
+  8024e7:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8024e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ee:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024f3:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	ba 00 00 00 00       	mov    $0x0,%edx
+  802506:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802509:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80250d:	c9                   	leave
+  80250e:	c3                   	ret
+        return -E_INVAL;
+  80250f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802514:	c3                   	ret
+        return -E_INVAL;
+  802515:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80251a:	eb ed                	jmp    802509 <devfile_receive_snapshot+0x5e>
+
+000000000080251c <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80251c:	55                   	push   %rbp
+  80251d:	48 89 e5             	mov    %rsp,%rbp
+  802520:	41 55                	push   %r13
+  802522:	41 54                	push   %r12
+  802524:	53                   	push   %rbx
+  802525:	48 83 ec 08          	sub    $0x8,%rsp
+  802529:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80252c:	48 85 f6             	test   %rsi,%rsi
+  80252f:	0f 94 c0             	sete   %al
+  802532:	48 85 d2             	test   %rdx,%rdx
+  802535:	0f 94 c2             	sete   %dl
+  802538:	08 d0                	or     %dl,%al
+  80253a:	0f 85 ad 00 00 00    	jne    8025ed <devfile_send_snapshot+0xd1>
+  802540:	48 89 fb             	mov    %rdi,%rbx
+  802543:	49 89 f4             	mov    %rsi,%r12
+  802546:	48 85 ff             	test   %rdi,%rdi
+  802549:	0f 84 9e 00 00 00    	je     8025ed <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80254f:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+  80255b:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802561:	0f 87 8d 00 00 00    	ja     8025f4 <devfile_send_snapshot+0xd8>
+  802567:	4c 89 e7             	mov    %r12,%rdi
+  80256a:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+  802576:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80257c:	77 7d                	ja     8025fb <devfile_send_snapshot+0xdf>
+  80257e:	4c 89 ef             	mov    %r13,%rdi
+  802581:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802593:	77 6d                	ja     802602 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802595:	48 89 de             	mov    %rbx,%rsi
+  802598:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80259f:	00 00 00 
+  8025a2:	48 bb 9a 0b 80 00 00 	movabs $0x800b9a,%rbx
+  8025a9:	00 00 00 
+  8025ac:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8025ae:	4c 89 e6             	mov    %r12,%rsi
+  8025b1:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8025b8:	00 00 00 
+  8025bb:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8025bd:	4c 89 ee             	mov    %r13,%rsi
+  8025c0:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8025c7:	00 00 00 
+  8025ca:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8025cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d1:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025d6:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8025dd:	00 00 00 
+  8025e0:	ff d0                	call   *%rax
+}
+  8025e2:	48 83 c4 08          	add    $0x8,%rsp
+  8025e6:	5b                   	pop    %rbx
+  8025e7:	41 5c                	pop    %r12
+  8025e9:	41 5d                	pop    %r13
+  8025eb:	5d                   	pop    %rbp
+  8025ec:	c3                   	ret
+        return -E_INVAL;
+  8025ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f2:	eb ee                	jmp    8025e2 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8025f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f9:	eb e7                	jmp    8025e2 <devfile_send_snapshot+0xc6>
+  8025fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802600:	eb e0                	jmp    8025e2 <devfile_send_snapshot+0xc6>
+  802602:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802607:	eb d9                	jmp    8025e2 <devfile_send_snapshot+0xc6>
+
+0000000000802609 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802609:	48 85 ff             	test   %rdi,%rdi
+  80260c:	0f 84 41 01 00 00    	je     802753 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802612:	55                   	push   %rbp
+  802613:	48 89 e5             	mov    %rsp,%rbp
+  802616:	41 57                	push   %r15
+  802618:	41 56                	push   %r14
+  80261a:	41 55                	push   %r13
+  80261c:	41 54                	push   %r12
+  80261e:	53                   	push   %rbx
+  80261f:	48 83 ec 08          	sub    $0x8,%rsp
+  802623:	49 89 fc             	mov    %rdi,%r12
+  802626:	49 89 f5             	mov    %rsi,%r13
+  802629:	48 89 d3             	mov    %rdx,%rbx
+  80262c:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80262f:	48 85 f6             	test   %rsi,%rsi
+  802632:	0f 84 ff 00 00 00    	je     802737 <devfile_diff_snapshots+0x12e>
+  802638:	48 85 d2             	test   %rdx,%rdx
+  80263b:	0f 84 fd 00 00 00    	je     80273e <devfile_diff_snapshots+0x135>
+  802641:	48 85 c9             	test   %rcx,%rcx
+  802644:	0f 84 f4 00 00 00    	je     80273e <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80264a:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80265c:	0f 87 e3 00 00 00    	ja     802745 <devfile_diff_snapshots+0x13c>
+  802662:	4c 89 ef             	mov    %r13,%rdi
+  802665:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+  802671:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802677:	0f 87 cf 00 00 00    	ja     80274c <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80267d:	4c 89 e6             	mov    %r12,%rsi
+  802680:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802687:	00 00 00 
+  80268a:	4c 89 e7             	mov    %r12,%rdi
+  80268d:	49 bf 9a 0b 80 00 00 	movabs $0x800b9a,%r15
+  802694:	00 00 00 
+  802697:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80269a:	4c 89 ee             	mov    %r13,%rsi
+  80269d:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8026a4:	00 
+  8026a5:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8026a8:	48 8b 03             	mov    (%rbx),%rax
+  8026ab:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8026b2:	00 
+  8026b3:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8026b7:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8026be:	00 
+  8026bf:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8026c3:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8026ca:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8026cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026d5:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	78 43                	js     802728 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8026e5:	49 8b 04 24          	mov    (%r12),%rax
+  8026e9:	48 89 03             	mov    %rax,(%rbx)
+  8026ec:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8026f1:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8026f5:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8026fa:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8026fe:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802703:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802707:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80270b:	48 c1 e2 03          	shl    $0x3,%rdx
+  80270f:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802714:	4c 89 f7             	mov    %r14,%rdi
+  802717:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  80271e:	00 00 00 
+  802721:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802723:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802728:	48 83 c4 08          	add    $0x8,%rsp
+  80272c:	5b                   	pop    %rbx
+  80272d:	41 5c                	pop    %r12
+  80272f:	41 5d                	pop    %r13
+  802731:	41 5e                	pop    %r14
+  802733:	41 5f                	pop    %r15
+  802735:	5d                   	pop    %rbp
+  802736:	c3                   	ret
+        return -E_INVAL;
+  802737:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80273c:	eb ea                	jmp    802728 <devfile_diff_snapshots+0x11f>
+  80273e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802743:	eb e3                	jmp    802728 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80274a:	eb dc                	jmp    802728 <devfile_diff_snapshots+0x11f>
+  80274c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802751:	eb d5                	jmp    802728 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802758:	c3                   	ret
+
+0000000000802759 <devfile_delete_snapshot>:
+    if (!name) {
+  802759:	48 85 ff             	test   %rdi,%rdi
+  80275c:	74 5f                	je     8027bd <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80275e:	55                   	push   %rbp
+  80275f:	48 89 e5             	mov    %rsp,%rbp
+  802762:	53                   	push   %rbx
+  802763:	48 83 ec 08          	sub    $0x8,%rsp
+  802767:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80276a:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+  802776:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80277c:	77 45                	ja     8027c3 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80277e:	48 89 de             	mov    %rbx,%rsi
+  802781:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802788:	00 00 00 
+  80278b:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802797:	be 00 00 00 00       	mov    $0x0,%esi
+  80279c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027a1:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8027a8:	00 00 00 
+  8027ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bb:	c9                   	leave
+  8027bc:	c3                   	ret
+        return -E_INVAL;
+  8027bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027c2:	c3                   	ret
+        return -E_INVAL;
+  8027c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027c8:	eb ed                	jmp    8027b7 <devfile_delete_snapshot+0x5e>
+
+00000000008027ca <devfile_accept_snapshot>:
+    if (!name) {
+  8027ca:	48 85 ff             	test   %rdi,%rdi
+  8027cd:	74 5f                	je     80282e <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+  8027d3:	53                   	push   %rbx
+  8027d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d8:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8027db:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027ed:	77 45                	ja     802834 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8027ef:	48 89 de             	mov    %rbx,%rsi
+  8027f2:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027f9:	00 00 00 
+  8027fc:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802808:	be 00 00 00 00       	mov    $0x0,%esi
+  80280d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802812:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	ba 00 00 00 00       	mov    $0x0,%edx
+  802825:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802828:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+        return -E_INVAL;
+  80282e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802833:	c3                   	ret
+        return -E_INVAL;
+  802834:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802839:	eb ed                	jmp    802828 <devfile_accept_snapshot+0x5e>
+
+000000000080283b <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80283b:	48 85 ff             	test   %rdi,%rdi
+  80283e:	0f 84 9f 00 00 00    	je     8028e3 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802844:	55                   	push   %rbp
+  802845:	48 89 e5             	mov    %rsp,%rbp
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 89 fb             	mov    %rdi,%rbx
+  80284e:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802851:	48 85 f6             	test   %rsi,%rsi
+  802854:	74 78                	je     8028ce <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802856:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802868:	77 6b                	ja     8028d5 <devfile_create_snapshot+0x9a>
+  80286a:	4c 89 e7             	mov    %r12,%rdi
+  80286d:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+  802879:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80287f:	77 5b                	ja     8028dc <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802881:	48 89 de             	mov    %rbx,%rsi
+  802884:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80288b:	00 00 00 
+  80288e:	48 bb 9a 0b 80 00 00 	movabs $0x800b9a,%rbx
+  802895:	00 00 00 
+  802898:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80289a:	4c 89 e6             	mov    %r12,%rsi
+  80289d:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8028a4:	00 00 00 
+  8028a7:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8028a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ae:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028b3:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028c9:	5b                   	pop    %rbx
+  8028ca:	41 5c                	pop    %r12
+  8028cc:	5d                   	pop    %rbp
+  8028cd:	c3                   	ret
+        return -E_INVAL;
+  8028ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d3:	eb f4                	jmp    8028c9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028da:	eb ed                	jmp    8028c9 <devfile_create_snapshot+0x8e>
+  8028dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e1:	eb e6                	jmp    8028c9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028e8:	c3                   	ret
+
+00000000008028e9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028e9:	55                   	push   %rbp
+  8028ea:	48 89 e5             	mov    %rsp,%rbp
+  8028ed:	41 54                	push   %r12
+  8028ef:	53                   	push   %rbx
+  8028f0:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8028f3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8028f6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8028fd:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8028ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802904:	bf 05 00 00 00       	mov    $0x5,%edi
+  802909:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802915:	85 c0                	test   %eax,%eax
+  802917:	78 3d                	js     802956 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802919:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802920:	00 00 00 
+  802923:	4c 89 e6             	mov    %r12,%rsi
+  802926:	48 89 df             	mov    %rbx,%rdi
+  802929:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802935:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80293c:	00 
+  80293d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802943:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80294a:	00 
+  80294b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802951:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802956:	5b                   	pop    %rbx
+  802957:	41 5c                	pop    %r12
+  802959:	5d                   	pop    %rbp
+  80295a:	c3                   	ret
+
+000000000080295b <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  80295b:	55                   	push   %rbp
+  80295c:	48 89 e5             	mov    %rsp,%rbp
+  80295f:	41 57                	push   %r15
+  802961:	41 56                	push   %r14
+  802963:	41 55                	push   %r13
+  802965:	41 54                	push   %r12
+  802967:	53                   	push   %rbx
+  802968:	48 83 ec 38          	sub    $0x38,%rsp
+  80296c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802970:	49 89 f5             	mov    %rsi,%r13
+  802973:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802976:	48 89 f0             	mov    %rsi,%rax
+  802979:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80297e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802982:	75 4f                	jne    8029d3 <devfile_readmap+0x78>
+  802984:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802988:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80298e:	75 1f                	jne    8029af <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802990:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802994:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802998:	49 be 43 31 80 00 00 	movabs $0x803143,%r14
+  80299f:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029a2:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8029a9:	0f 87 9d 00 00 00    	ja     802a4c <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8029af:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029b3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8029b7:	4d 85 ff             	test   %r15,%r15
+  8029ba:	0f 85 cf 00 00 00    	jne    802a8f <devfile_readmap+0x134>
+  8029c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8029c4:	48 83 c4 38          	add    $0x38,%rsp
+  8029c8:	5b                   	pop    %rbx
+  8029c9:	41 5c                	pop    %r12
+  8029cb:	41 5d                	pop    %r13
+  8029cd:	41 5e                	pop    %r14
+  8029cf:	41 5f                	pop    %r15
+  8029d1:	5d                   	pop    %rbp
+  8029d2:	c3                   	ret
+    size_t totalRead = 0;
+  8029d3:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8029da:	00 
+  8029db:	eb da                	jmp    8029b7 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029dd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029e1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029e4:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8029eb:	00 00 00 
+  8029ee:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  8029f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f4:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  8029f8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029fc:	4c 89 ee             	mov    %r13,%rsi
+  8029ff:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a04:	48 b8 09 21 80 00 00 	movabs $0x802109,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	7e a3                	jle    8029b7 <devfile_readmap+0x5c>
+  802a14:	48 98                	cltq
+  802a16:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a1a:	72 9b                	jb     8029b7 <devfile_readmap+0x5c>
+        buf += read;
+  802a1c:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a1f:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a22:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a26:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a2d:	75 88                	jne    8029b7 <devfile_readmap+0x5c>
+  802a2f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a33:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a39:	0f 85 78 ff ff ff    	jne    8029b7 <devfile_readmap+0x5c>
+  802a3f:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a46:	0f 86 6b ff ff ff    	jbe    8029b7 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802a4c:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802a52:	4d 39 e7             	cmp    %r12,%r15
+  802a55:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802a59:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802a60:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a64:	0f 84 73 ff ff ff    	je     8029dd <devfile_readmap+0x82>
+  802a6a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a6e:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802a73:	41 ff d6             	call   *%r14
+  802a76:	a8 40                	test   $0x40,%al
+  802a78:	0f 85 39 ff ff ff    	jne    8029b7 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a7e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a85:	4c 39 e3             	cmp    %r12,%rbx
+  802a88:	72 e4                	jb     802a6e <devfile_readmap+0x113>
+  802a8a:	e9 4e ff ff ff       	jmp    8029dd <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802a8f:	4c 89 fa             	mov    %r15,%rdx
+  802a92:	4c 89 ee             	mov    %r13,%rsi
+  802a95:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a99:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  802aa0:	00 00 00 
+  802aa3:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802aa5:	48 85 c0             	test   %rax,%rax
+  802aa8:	78 0c                	js     802ab6 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802aaa:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aae:	48 01 f0             	add    %rsi,%rax
+  802ab1:	e9 0e ff ff ff       	jmp    8029c4 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802ab6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aba:	48 85 f6             	test   %rsi,%rsi
+  802abd:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ac1:	e9 fe fe ff ff       	jmp    8029c4 <devfile_readmap+0x69>
+
+0000000000802ac6 <open>:
+open(const char *path, int mode) {
+  802ac6:	55                   	push   %rbp
+  802ac7:	48 89 e5             	mov    %rsp,%rbp
+  802aca:	41 55                	push   %r13
+  802acc:	41 54                	push   %r12
+  802ace:	53                   	push   %rbx
+  802acf:	48 83 ec 18          	sub    $0x18,%rsp
+  802ad3:	49 89 fc             	mov    %rdi,%r12
+  802ad6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ad9:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802ae0:	00 00 00 
+  802ae3:	ff d0                	call   *%rax
+  802ae5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802aeb:	0f 87 8a 00 00 00    	ja     802b7b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802af1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802af5:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	89 c3                	mov    %eax,%ebx
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	78 50                	js     802b57 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b07:	4c 89 e6             	mov    %r12,%rsi
+  802b0a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802b11:	00 00 00 
+  802b14:	48 89 df             	mov    %rbx,%rdi
+  802b17:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b23:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b2a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b2e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b33:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+  802b3f:	89 c3                	mov    %eax,%ebx
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	78 1f                	js     802b64 <open+0x9e>
+    return fd2num(fd);
+  802b45:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b49:	48 b8 f6 15 80 00 00 	movabs $0x8015f6,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+  802b55:	89 c3                	mov    %eax,%ebx
+}
+  802b57:	89 d8                	mov    %ebx,%eax
+  802b59:	48 83 c4 18          	add    $0x18,%rsp
+  802b5d:	5b                   	pop    %rbx
+  802b5e:	41 5c                	pop    %r12
+  802b60:	41 5d                	pop    %r13
+  802b62:	5d                   	pop    %rbp
+  802b63:	c3                   	ret
+        fd_close(fd, 0);
+  802b64:	be 00 00 00 00       	mov    $0x0,%esi
+  802b69:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b6d:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+        return res;
+  802b79:	eb dc                	jmp    802b57 <open+0x91>
+        return -E_BAD_PATH;
+  802b7b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b80:	eb d5                	jmp    802b57 <open+0x91>
+
+0000000000802b82 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802b82:	55                   	push   %rbp
+  802b83:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802b86:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8b:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b90:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+}
+  802b9c:	5d                   	pop    %rbp
+  802b9d:	c3                   	ret
+
+0000000000802b9e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b9e:	55                   	push   %rbp
+  802b9f:	48 89 e5             	mov    %rsp,%rbp
+  802ba2:	41 54                	push   %r12
+  802ba4:	53                   	push   %rbx
+  802ba5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ba8:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802baf:	00 00 00 
+  802bb2:	ff d0                	call   *%rax
+  802bb4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802bb7:	48 be 20 3e 80 00 00 	movabs $0x803e20,%rsi
+  802bbe:	00 00 00 
+  802bc1:	48 89 df             	mov    %rbx,%rdi
+  802bc4:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bd0:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802bd5:	41 2b 04 24          	sub    (%r12),%eax
+  802bd9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802bdf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802be6:	00 00 00 
+    stat->st_dev = &devpipe;
+  802be9:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802bf0:	00 00 00 
+  802bf3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bff:	5b                   	pop    %rbx
+  802c00:	41 5c                	pop    %r12
+  802c02:	5d                   	pop    %rbp
+  802c03:	c3                   	ret
+
+0000000000802c04 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802c04:	55                   	push   %rbp
+  802c05:	48 89 e5             	mov    %rsp,%rbp
+  802c08:	41 54                	push   %r12
+  802c0a:	53                   	push   %rbx
+  802c0b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c13:	48 89 fe             	mov    %rdi,%rsi
+  802c16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c1b:	49 bc f2 12 80 00 00 	movabs $0x8012f2,%r12
+  802c22:	00 00 00 
+  802c25:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c28:	48 89 df             	mov    %rbx,%rdi
+  802c2b:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802c32:	00 00 00 
+  802c35:	ff d0                	call   *%rax
+  802c37:	48 89 c6             	mov    %rax,%rsi
+  802c3a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c44:	41 ff d4             	call   *%r12
+}
+  802c47:	5b                   	pop    %rbx
+  802c48:	41 5c                	pop    %r12
+  802c4a:	5d                   	pop    %rbp
+  802c4b:	c3                   	ret
+
+0000000000802c4c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	41 57                	push   %r15
+  802c52:	41 56                	push   %r14
+  802c54:	41 55                	push   %r13
+  802c56:	41 54                	push   %r12
+  802c58:	53                   	push   %rbx
+  802c59:	48 83 ec 18          	sub    $0x18,%rsp
+  802c5d:	49 89 fc             	mov    %rdi,%r12
+  802c60:	49 89 f5             	mov    %rsi,%r13
+  802c63:	49 89 d7             	mov    %rdx,%r15
+  802c66:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c6a:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c76:	4d 85 ff             	test   %r15,%r15
+  802c79:	0f 84 af 00 00 00    	je     802d2e <devpipe_write+0xe2>
+  802c7f:	48 89 c3             	mov    %rax,%rbx
+  802c82:	4c 89 f8             	mov    %r15,%rax
+  802c85:	4d 89 ef             	mov    %r13,%r15
+  802c88:	4c 01 e8             	add    %r13,%rax
+  802c8b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c8f:	49 bd fa 11 80 00 00 	movabs $0x8011fa,%r13
+  802c96:	00 00 00 
+            sys_yield();
+  802c99:	49 be 97 11 80 00 00 	movabs $0x801197,%r14
+  802ca0:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802ca3:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ca6:	48 63 ce             	movslq %esi,%rcx
+  802ca9:	48 63 03             	movslq (%rbx),%rax
+  802cac:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cb2:	48 39 c1             	cmp    %rax,%rcx
+  802cb5:	72 2e                	jb     802ce5 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cb7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cbc:	48 89 da             	mov    %rbx,%rdx
+  802cbf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cc4:	4c 89 e7             	mov    %r12,%rdi
+  802cc7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cca:	85 c0                	test   %eax,%eax
+  802ccc:	74 66                	je     802d34 <devpipe_write+0xe8>
+            sys_yield();
+  802cce:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cd1:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cd4:	48 63 ce             	movslq %esi,%rcx
+  802cd7:	48 63 03             	movslq (%rbx),%rax
+  802cda:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ce0:	48 39 c1             	cmp    %rax,%rcx
+  802ce3:	73 d2                	jae    802cb7 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ce5:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ce9:	48 89 ca             	mov    %rcx,%rdx
+  802cec:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cf0:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802cf7:	08 10 20 
+  802cfa:	48 f7 e2             	mul    %rdx
+  802cfd:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d01:	48 89 d0             	mov    %rdx,%rax
+  802d04:	48 c1 e0 09          	shl    $0x9,%rax
+  802d08:	48 29 d0             	sub    %rdx,%rax
+  802d0b:	48 c1 e0 03          	shl    $0x3,%rax
+  802d0f:	48 29 c1             	sub    %rax,%rcx
+  802d12:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802d17:	83 c6 01             	add    $0x1,%esi
+  802d1a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d1d:	49 83 c7 01          	add    $0x1,%r15
+  802d21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d25:	49 39 c7             	cmp    %rax,%r15
+  802d28:	0f 85 75 ff ff ff    	jne    802ca3 <devpipe_write+0x57>
+    return n;
+  802d2e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d32:	eb 05                	jmp    802d39 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d39:	48 83 c4 18          	add    $0x18,%rsp
+  802d3d:	5b                   	pop    %rbx
+  802d3e:	41 5c                	pop    %r12
+  802d40:	41 5d                	pop    %r13
+  802d42:	41 5e                	pop    %r14
+  802d44:	41 5f                	pop    %r15
+  802d46:	5d                   	pop    %rbp
+  802d47:	c3                   	ret
+
+0000000000802d48 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d48:	55                   	push   %rbp
+  802d49:	48 89 e5             	mov    %rsp,%rbp
+  802d4c:	41 57                	push   %r15
+  802d4e:	41 56                	push   %r14
+  802d50:	41 55                	push   %r13
+  802d52:	41 54                	push   %r12
+  802d54:	53                   	push   %rbx
+  802d55:	48 83 ec 18          	sub    $0x18,%rsp
+  802d59:	49 89 fc             	mov    %rdi,%r12
+  802d5c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d64:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+  802d70:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d73:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d79:	49 bd fa 11 80 00 00 	movabs $0x8011fa,%r13
+  802d80:	00 00 00 
+            sys_yield();
+  802d83:	49 be 97 11 80 00 00 	movabs $0x801197,%r14
+  802d8a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d8d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d92:	74 7d                	je     802e11 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d94:	8b 03                	mov    (%rbx),%eax
+  802d96:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d99:	75 26                	jne    802dc1 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d9b:	4d 85 ff             	test   %r15,%r15
+  802d9e:	75 77                	jne    802e17 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802da0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802da5:	48 89 da             	mov    %rbx,%rdx
+  802da8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dad:	4c 89 e7             	mov    %r12,%rdi
+  802db0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802db3:	85 c0                	test   %eax,%eax
+  802db5:	74 72                	je     802e29 <devpipe_read+0xe1>
+            sys_yield();
+  802db7:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dba:	8b 03                	mov    (%rbx),%eax
+  802dbc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802dbf:	74 df                	je     802da0 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802dc1:	48 63 c8             	movslq %eax,%rcx
+  802dc4:	48 89 ca             	mov    %rcx,%rdx
+  802dc7:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dcb:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802dd2:	08 10 20 
+  802dd5:	48 89 d0             	mov    %rdx,%rax
+  802dd8:	48 f7 e6             	mul    %rsi
+  802ddb:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ddf:	48 89 d0             	mov    %rdx,%rax
+  802de2:	48 c1 e0 09          	shl    $0x9,%rax
+  802de6:	48 29 d0             	sub    %rdx,%rax
+  802de9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802df0:	00 
+  802df1:	48 89 c8             	mov    %rcx,%rax
+  802df4:	48 29 d0             	sub    %rdx,%rax
+  802df7:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802dfc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e00:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802e04:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e07:	49 83 c7 01          	add    $0x1,%r15
+  802e0b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802e0f:	75 83                	jne    802d94 <devpipe_read+0x4c>
+    return n;
+  802e11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e15:	eb 03                	jmp    802e1a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802e17:	4c 89 f8             	mov    %r15,%rax
+}
+  802e1a:	48 83 c4 18          	add    $0x18,%rsp
+  802e1e:	5b                   	pop    %rbx
+  802e1f:	41 5c                	pop    %r12
+  802e21:	41 5d                	pop    %r13
+  802e23:	41 5e                	pop    %r14
+  802e25:	41 5f                	pop    %r15
+  802e27:	5d                   	pop    %rbp
+  802e28:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2e:	eb ea                	jmp    802e1a <devpipe_read+0xd2>
+
+0000000000802e30 <pipe>:
+pipe(int pfd[2]) {
+  802e30:	55                   	push   %rbp
+  802e31:	48 89 e5             	mov    %rsp,%rbp
+  802e34:	41 55                	push   %r13
+  802e36:	41 54                	push   %r12
+  802e38:	53                   	push   %rbx
+  802e39:	48 83 ec 18          	sub    $0x18,%rsp
+  802e3d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e40:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e44:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  802e4b:	00 00 00 
+  802e4e:	ff d0                	call   *%rax
+  802e50:	89 c3                	mov    %eax,%ebx
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	0f 88 a0 01 00 00    	js     802ffa <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e5a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e64:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6d:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  802e74:	00 00 00 
+  802e77:	ff d0                	call   *%rax
+  802e79:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e7b:	85 c0                	test   %eax,%eax
+  802e7d:	0f 88 77 01 00 00    	js     802ffa <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e83:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e87:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+  802e93:	89 c3                	mov    %eax,%ebx
+  802e95:	85 c0                	test   %eax,%eax
+  802e97:	0f 88 43 01 00 00    	js     802fe0 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e9d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ea2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ea7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802eab:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb0:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	0f 88 1a 01 00 00    	js     802fe0 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802ec6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802eca:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+  802ed6:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802ed9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ede:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee3:	48 89 c6             	mov    %rax,%rsi
+  802ee6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eeb:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  802ef2:	00 00 00 
+  802ef5:	ff d0                	call   *%rax
+  802ef7:	89 c3                	mov    %eax,%ebx
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	0f 88 c5 00 00 00    	js     802fc6 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802f01:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f05:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  802f0c:	00 00 00 
+  802f0f:	ff d0                	call   *%rax
+  802f11:	48 89 c1             	mov    %rax,%rcx
+  802f14:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802f1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f25:	4c 89 ee             	mov    %r13,%rsi
+  802f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2d:	48 b8 8d 12 80 00 00 	movabs $0x80128d,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+  802f39:	89 c3                	mov    %eax,%ebx
+  802f3b:	85 c0                	test   %eax,%eax
+  802f3d:	78 6e                	js     802fad <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f3f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f44:	4c 89 ef             	mov    %r13,%rdi
+  802f47:	48 b8 c8 11 80 00 00 	movabs $0x8011c8,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	83 f8 02             	cmp    $0x2,%eax
+  802f56:	0f 85 ab 00 00 00    	jne    803007 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f5c:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802f63:	00 00 
+  802f65:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f69:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f6b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f6f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f76:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f7a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f80:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f87:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f8b:	48 bb f6 15 80 00 00 	movabs $0x8015f6,%rbx
+  802f92:	00 00 00 
+  802f95:	ff d3                	call   *%rbx
+  802f97:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f9b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f9f:	ff d3                	call   *%rbx
+  802fa1:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802fa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fab:	eb 4d                	jmp    802ffa <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802fad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fb2:	4c 89 ee             	mov    %r13,%rsi
+  802fb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fba:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802fc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fcb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd4:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802fe0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fee:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  802ff5:	00 00 00 
+  802ff8:	ff d0                	call   *%rax
+}
+  802ffa:	89 d8                	mov    %ebx,%eax
+  802ffc:	48 83 c4 18          	add    $0x18,%rsp
+  803000:	5b                   	pop    %rbx
+  803001:	41 5c                	pop    %r12
+  803003:	41 5d                	pop    %r13
+  803005:	5d                   	pop    %rbp
+  803006:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803007:	48 b9 50 3e 80 00 00 	movabs $0x803e50,%rcx
+  80300e:	00 00 00 
+  803011:	48 ba 27 3e 80 00 00 	movabs $0x803e27,%rdx
+  803018:	00 00 00 
+  80301b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803020:	48 bf 3c 3e 80 00 00 	movabs $0x803e3c,%rdi
+  803027:	00 00 00 
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	49 b8 87 34 80 00 00 	movabs $0x803487,%r8
+  803036:	00 00 00 
+  803039:	41 ff d0             	call   *%r8
+
+000000000080303c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80303c:	55                   	push   %rbp
+  80303d:	48 89 e5             	mov    %rsp,%rbp
+  803040:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803044:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803048:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803054:	85 c0                	test   %eax,%eax
+  803056:	78 35                	js     80308d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803058:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80305c:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+  803068:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80306b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803070:	be 00 10 00 00       	mov    $0x1000,%esi
+  803075:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803079:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  803080:	00 00 00 
+  803083:	ff d0                	call   *%rax
+  803085:	85 c0                	test   %eax,%eax
+  803087:	0f 94 c0             	sete   %al
+  80308a:	0f b6 c0             	movzbl %al,%eax
+}
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+000000000080308f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80308f:	48 89 f8             	mov    %rdi,%rax
+  803092:	48 c1 e8 27          	shr    $0x27,%rax
+  803096:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80309d:	01 00 00 
+  8030a0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030a4:	f6 c2 01             	test   $0x1,%dl
+  8030a7:	74 6d                	je     803116 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8030a9:	48 89 f8             	mov    %rdi,%rax
+  8030ac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030b0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030b7:	01 00 00 
+  8030ba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030be:	f6 c2 01             	test   $0x1,%dl
+  8030c1:	74 62                	je     803125 <get_uvpt_entry+0x96>
+  8030c3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030ca:	01 00 00 
+  8030cd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030d1:	f6 c2 80             	test   $0x80,%dl
+  8030d4:	75 4f                	jne    803125 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030d6:	48 89 f8             	mov    %rdi,%rax
+  8030d9:	48 c1 e8 15          	shr    $0x15,%rax
+  8030dd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030e4:	01 00 00 
+  8030e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030eb:	f6 c2 01             	test   $0x1,%dl
+  8030ee:	74 44                	je     803134 <get_uvpt_entry+0xa5>
+  8030f0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030f7:	01 00 00 
+  8030fa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030fe:	f6 c2 80             	test   $0x80,%dl
+  803101:	75 31                	jne    803134 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803103:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803107:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80310e:	01 00 00 
+  803111:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803115:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803116:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80311d:	01 00 00 
+  803120:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803124:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803125:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80312c:	01 00 00 
+  80312f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803133:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803134:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80313b:	01 00 00 
+  80313e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803142:	c3                   	ret
+
+0000000000803143 <get_prot>:
+
+int
+get_prot(void *va) {
+  803143:	55                   	push   %rbp
+  803144:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803147:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803156:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80315b:	89 c1                	mov    %eax,%ecx
+  80315d:	83 c9 04             	or     $0x4,%ecx
+  803160:	f6 c2 01             	test   $0x1,%dl
+  803163:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803166:	89 c1                	mov    %eax,%ecx
+  803168:	83 c9 02             	or     $0x2,%ecx
+  80316b:	f6 c2 02             	test   $0x2,%dl
+  80316e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803171:	89 c1                	mov    %eax,%ecx
+  803173:	83 c9 01             	or     $0x1,%ecx
+  803176:	48 85 d2             	test   %rdx,%rdx
+  803179:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80317c:	89 c1                	mov    %eax,%ecx
+  80317e:	83 c9 40             	or     $0x40,%ecx
+  803181:	f6 c6 04             	test   $0x4,%dh
+  803184:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803187:	5d                   	pop    %rbp
+  803188:	c3                   	ret
+
+0000000000803189 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803189:	55                   	push   %rbp
+  80318a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80318d:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  803194:	00 00 00 
+  803197:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803199:	48 c1 e8 06          	shr    $0x6,%rax
+  80319d:	83 e0 01             	and    $0x1,%eax
+}
+  8031a0:	5d                   	pop    %rbp
+  8031a1:	c3                   	ret
+
+00000000008031a2 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8031a2:	55                   	push   %rbp
+  8031a3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8031a6:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  8031ad:	00 00 00 
+  8031b0:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8031b2:	48 c1 e8 05          	shr    $0x5,%rax
+  8031b6:	83 e0 01             	and    $0x1,%eax
+}
+  8031b9:	5d                   	pop    %rbp
+  8031ba:	c3                   	ret
+
+00000000008031bb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8031bb:	55                   	push   %rbp
+  8031bc:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8031bf:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  8031c6:	00 00 00 
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	83 e0 01             	and    $0x1,%eax
+}
+  8031ce:	5d                   	pop    %rbp
+  8031cf:	c3                   	ret
+
+00000000008031d0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8031d0:	55                   	push   %rbp
+  8031d1:	48 89 e5             	mov    %rsp,%rbp
+  8031d4:	41 57                	push   %r15
+  8031d6:	41 56                	push   %r14
+  8031d8:	41 55                	push   %r13
+  8031da:	41 54                	push   %r12
+  8031dc:	53                   	push   %rbx
+  8031dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8031e1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031e5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8031ee:	49 bd bb 31 80 00 00 	movabs $0x8031bb,%r13
+  8031f5:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8031f8:	49 bf 43 31 80 00 00 	movabs $0x803143,%r15
+  8031ff:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803202:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803209:	00 00 00 
+  80320c:	eb 0c                	jmp    80321a <foreach_shared_region+0x4a>
+  80320e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803215:	4c 39 f3             	cmp    %r14,%rbx
+  803218:	74 2e                	je     803248 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80321a:	48 89 df             	mov    %rbx,%rdi
+  80321d:	41 ff d5             	call   *%r13
+  803220:	84 c0                	test   %al,%al
+  803222:	74 ea                	je     80320e <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803224:	48 89 df             	mov    %rbx,%rdi
+  803227:	41 ff d7             	call   *%r15
+  80322a:	a8 40                	test   $0x40,%al
+  80322c:	74 e0                	je     80320e <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80322e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803235:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803239:	48 89 df             	mov    %rbx,%rdi
+  80323c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803240:	ff d0                	call   *%rax
+				if (res < 0) {
+  803242:	85 c0                	test   %eax,%eax
+  803244:	79 c8                	jns    80320e <foreach_shared_region+0x3e>
+  803246:	eb 05                	jmp    80324d <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803248:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80324d:	48 83 c4 18          	add    $0x18,%rsp
+  803251:	5b                   	pop    %rbx
+  803252:	41 5c                	pop    %r12
+  803254:	41 5d                	pop    %r13
+  803256:	41 5e                	pop    %r14
+  803258:	41 5f                	pop    %r15
+  80325a:	5d                   	pop    %rbp
+  80325b:	c3                   	ret
+
+000000000080325c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80325c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803261:	c3                   	ret
+
+0000000000803262 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803262:	55                   	push   %rbp
+  803263:	48 89 e5             	mov    %rsp,%rbp
+  803266:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803269:	48 be 74 3e 80 00 00 	movabs $0x803e74,%rsi
+  803270:	00 00 00 
+  803273:	48 b8 9a 0b 80 00 00 	movabs $0x800b9a,%rax
+  80327a:	00 00 00 
+  80327d:	ff d0                	call   *%rax
+    return 0;
+}
+  80327f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803284:	5d                   	pop    %rbp
+  803285:	c3                   	ret
+
+0000000000803286 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+  80328a:	41 57                	push   %r15
+  80328c:	41 56                	push   %r14
+  80328e:	41 55                	push   %r13
+  803290:	41 54                	push   %r12
+  803292:	53                   	push   %rbx
+  803293:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80329a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8032a1:	48 85 d2             	test   %rdx,%rdx
+  8032a4:	74 7a                	je     803320 <devcons_write+0x9a>
+  8032a6:	49 89 d6             	mov    %rdx,%r14
+  8032a9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032af:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8032b4:	49 bf 94 0d 80 00 00 	movabs $0x800d94,%r15
+  8032bb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032be:	4c 89 f3             	mov    %r14,%rbx
+  8032c1:	48 29 f3             	sub    %rsi,%rbx
+  8032c4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032c9:	48 39 c3             	cmp    %rax,%rbx
+  8032cc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8032d0:	4c 63 eb             	movslq %ebx,%r13
+  8032d3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8032da:	48 01 c6             	add    %rax,%rsi
+  8032dd:	4c 89 ea             	mov    %r13,%rdx
+  8032e0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032e7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8032ea:	4c 89 ee             	mov    %r13,%rsi
+  8032ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032f4:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803300:	41 01 dc             	add    %ebx,%r12d
+  803303:	49 63 f4             	movslq %r12d,%rsi
+  803306:	4c 39 f6             	cmp    %r14,%rsi
+  803309:	72 b3                	jb     8032be <devcons_write+0x38>
+    return res;
+  80330b:	49 63 c4             	movslq %r12d,%rax
+}
+  80330e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803315:	5b                   	pop    %rbx
+  803316:	41 5c                	pop    %r12
+  803318:	41 5d                	pop    %r13
+  80331a:	41 5e                	pop    %r14
+  80331c:	41 5f                	pop    %r15
+  80331e:	5d                   	pop    %rbp
+  80331f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803320:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803326:	eb e3                	jmp    80330b <devcons_write+0x85>
+
+0000000000803328 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803328:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80332b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803330:	48 85 c0             	test   %rax,%rax
+  803333:	74 55                	je     80338a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803335:	55                   	push   %rbp
+  803336:	48 89 e5             	mov    %rsp,%rbp
+  803339:	41 55                	push   %r13
+  80333b:	41 54                	push   %r12
+  80333d:	53                   	push   %rbx
+  80333e:	48 83 ec 08          	sub    $0x8,%rsp
+  803342:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803345:	48 bb ca 10 80 00 00 	movabs $0x8010ca,%rbx
+  80334c:	00 00 00 
+  80334f:	49 bc 97 11 80 00 00 	movabs $0x801197,%r12
+  803356:	00 00 00 
+  803359:	eb 03                	jmp    80335e <devcons_read+0x36>
+  80335b:	41 ff d4             	call   *%r12
+  80335e:	ff d3                	call   *%rbx
+  803360:	85 c0                	test   %eax,%eax
+  803362:	74 f7                	je     80335b <devcons_read+0x33>
+    if (c < 0) return c;
+  803364:	48 63 d0             	movslq %eax,%rdx
+  803367:	78 13                	js     80337c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80336e:	83 f8 04             	cmp    $0x4,%eax
+  803371:	74 09                	je     80337c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803373:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803377:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80337c:	48 89 d0             	mov    %rdx,%rax
+  80337f:	48 83 c4 08          	add    $0x8,%rsp
+  803383:	5b                   	pop    %rbx
+  803384:	41 5c                	pop    %r12
+  803386:	41 5d                	pop    %r13
+  803388:	5d                   	pop    %rbp
+  803389:	c3                   	ret
+  80338a:	48 89 d0             	mov    %rdx,%rax
+  80338d:	c3                   	ret
+
+000000000080338e <cputchar>:
+cputchar(int ch) {
+  80338e:	55                   	push   %rbp
+  80338f:	48 89 e5             	mov    %rsp,%rbp
+  803392:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803396:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80339a:	be 01 00 00 00       	mov    $0x1,%esi
+  80339f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8033a3:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+}
+  8033af:	c9                   	leave
+  8033b0:	c3                   	ret
+
+00000000008033b1 <getchar>:
+getchar(void) {
+  8033b1:	55                   	push   %rbp
+  8033b2:	48 89 e5             	mov    %rsp,%rbp
+  8033b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8033b9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033be:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c7:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  8033ce:	00 00 00 
+  8033d1:	ff d0                	call   *%rax
+  8033d3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8033d5:	85 c0                	test   %eax,%eax
+  8033d7:	78 06                	js     8033df <getchar+0x2e>
+  8033d9:	74 08                	je     8033e3 <getchar+0x32>
+  8033db:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8033df:	89 d0                	mov    %edx,%eax
+  8033e1:	c9                   	leave
+  8033e2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8033e3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8033e8:	eb f5                	jmp    8033df <getchar+0x2e>
+
+00000000008033ea <iscons>:
+iscons(int fdnum) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033f6:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8033fd:	00 00 00 
+  803400:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803402:	85 c0                	test   %eax,%eax
+  803404:	78 18                	js     80341e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803406:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80340a:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803411:	00 00 00 
+  803414:	8b 00                	mov    (%rax),%eax
+  803416:	39 02                	cmp    %eax,(%rdx)
+  803418:	0f 94 c0             	sete   %al
+  80341b:	0f b6 c0             	movzbl %al,%eax
+}
+  80341e:	c9                   	leave
+  80341f:	c3                   	ret
+
+0000000000803420 <opencons>:
+opencons(void) {
+  803420:	55                   	push   %rbp
+  803421:	48 89 e5             	mov    %rsp,%rbp
+  803424:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803428:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80342c:	48 b8 24 16 80 00 00 	movabs $0x801624,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	78 49                	js     803485 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80343c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803441:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803446:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80344a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344f:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  803456:	00 00 00 
+  803459:	ff d0                	call   *%rax
+  80345b:	85 c0                	test   %eax,%eax
+  80345d:	78 26                	js     803485 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80345f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803463:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80346a:	00 00 
+  80346c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80346e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803472:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803479:	48 b8 f6 15 80 00 00 	movabs $0x8015f6,%rax
+  803480:	00 00 00 
+  803483:	ff d0                	call   *%rax
+}
+  803485:	c9                   	leave
+  803486:	c3                   	ret
+
+0000000000803487 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803487:	55                   	push   %rbp
+  803488:	48 89 e5             	mov    %rsp,%rbp
+  80348b:	41 56                	push   %r14
+  80348d:	41 55                	push   %r13
+  80348f:	41 54                	push   %r12
+  803491:	53                   	push   %rbx
+  803492:	48 83 ec 50          	sub    $0x50,%rsp
+  803496:	49 89 fc             	mov    %rdi,%r12
+  803499:	41 89 f5             	mov    %esi,%r13d
+  80349c:	48 89 d3             	mov    %rdx,%rbx
+  80349f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8034a3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8034a7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8034ab:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8034b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8034ba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8034be:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034c2:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8034c9:	00 00 00 
+  8034cc:	4c 8b 30             	mov    (%rax),%r14
+  8034cf:	48 b8 66 11 80 00 00 	movabs $0x801166,%rax
+  8034d6:	00 00 00 
+  8034d9:	ff d0                	call   *%rax
+  8034db:	89 c6                	mov    %eax,%esi
+  8034dd:	45 89 e8             	mov    %r13d,%r8d
+  8034e0:	4c 89 e1             	mov    %r12,%rcx
+  8034e3:	4c 89 f2             	mov    %r14,%rdx
+  8034e6:	48 bf 80 3e 80 00 00 	movabs $0x803e80,%rdi
+  8034ed:	00 00 00 
+  8034f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f5:	49 bc 75 02 80 00 00 	movabs $0x800275,%r12
+  8034fc:	00 00 00 
+  8034ff:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803502:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803506:	48 89 df             	mov    %rbx,%rdi
+  803509:	48 b8 11 02 80 00 00 	movabs $0x800211,%rax
+  803510:	00 00 00 
+  803513:	ff d0                	call   *%rax
+    cprintf("\n");
+  803515:	48 bf d3 3d 80 00 00 	movabs $0x803dd3,%rdi
+  80351c:	00 00 00 
+  80351f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803524:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803527:	cc                   	int3
+  803528:	eb fd                	jmp    803527 <_panic+0xa0>
+
+000000000080352a <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80352a:	55                   	push   %rbp
+  80352b:	48 89 e5             	mov    %rsp,%rbp
+  80352e:	41 55                	push   %r13
+  803530:	41 54                	push   %r12
+  803532:	53                   	push   %rbx
+  803533:	48 83 ec 08          	sub    $0x8,%rsp
+  803537:	49 89 fc             	mov    %rdi,%r12
+  80353a:	48 89 f7             	mov    %rsi,%rdi
+  80353d:	48 89 d3             	mov    %rdx,%rbx
+  803540:	49 89 cd             	mov    %rcx,%r13
+  803543:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803546:	48 85 f6             	test   %rsi,%rsi
+  803549:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803550:	00 00 00 
+  803553:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803557:	be 00 10 00 00       	mov    $0x1000,%esi
+  80355c:	48 85 db             	test   %rbx,%rbx
+  80355f:	74 03                	je     803564 <ipc_recv_timed+0x3a>
+  803561:	48 8b 33             	mov    (%rbx),%rsi
+  803564:	48 b8 c0 14 80 00 00 	movabs $0x8014c0,%rax
+  80356b:	00 00 00 
+  80356e:	ff d0                	call   *%rax
+    if (res < 0) {
+  803570:	85 c0                	test   %eax,%eax
+  803572:	78 75                	js     8035e9 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803574:	4d 85 e4             	test   %r12,%r12
+  803577:	74 14                	je     80358d <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803579:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803580:	00 00 00 
+  803583:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803589:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80358d:	4d 85 ed             	test   %r13,%r13
+  803590:	74 14                	je     8035a6 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803592:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803599:	00 00 00 
+  80359c:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8035a2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8035a6:	48 85 db             	test   %rbx,%rbx
+  8035a9:	74 23                	je     8035ce <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8035ab:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035b2:	00 00 00 
+  8035b5:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8035bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c0:	85 c9                	test   %ecx,%ecx
+  8035c2:	74 07                	je     8035cb <ipc_recv_timed+0xa1>
+  8035c4:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035cb:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8035ce:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035d5:	00 00 00 
+  8035d8:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8035de:	48 83 c4 08          	add    $0x8,%rsp
+  8035e2:	5b                   	pop    %rbx
+  8035e3:	41 5c                	pop    %r12
+  8035e5:	41 5d                	pop    %r13
+  8035e7:	5d                   	pop    %rbp
+  8035e8:	c3                   	ret
+        if (from_env_store != NULL) {
+  8035e9:	4d 85 e4             	test   %r12,%r12
+  8035ec:	74 08                	je     8035f6 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8035ee:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8035f5:	00 
+        if (perm_store != NULL) {
+  8035f6:	4d 85 ed             	test   %r13,%r13
+  8035f9:	74 08                	je     803603 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8035fb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803602:	00 
+        if (size != NULL) {
+  803603:	48 85 db             	test   %rbx,%rbx
+  803606:	74 d6                	je     8035de <ipc_recv_timed+0xb4>
+            *size = 0;
+  803608:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80360f:	eb cd                	jmp    8035de <ipc_recv_timed+0xb4>
+
+0000000000803611 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803611:	55                   	push   %rbp
+  803612:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80361b:	48 b8 2a 35 80 00 00 	movabs $0x80352a,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+}
+  803627:	5d                   	pop    %rbp
+  803628:	c3                   	ret
+
+0000000000803629 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803629:	55                   	push   %rbp
+  80362a:	48 89 e5             	mov    %rsp,%rbp
+  80362d:	41 57                	push   %r15
+  80362f:	41 56                	push   %r14
+  803631:	41 55                	push   %r13
+  803633:	41 54                	push   %r12
+  803635:	53                   	push   %rbx
+  803636:	48 83 ec 18          	sub    $0x18,%rsp
+  80363a:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80363d:	48 89 d3             	mov    %rdx,%rbx
+  803640:	49 89 cc             	mov    %rcx,%r12
+  803643:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803646:	48 85 d2             	test   %rdx,%rdx
+  803649:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803650:	00 00 00 
+  803653:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803657:	89 f0                	mov    %esi,%eax
+  803659:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80365d:	48 89 da             	mov    %rbx,%rdx
+  803660:	48 89 c6             	mov    %rax,%rsi
+  803663:	48 b8 94 14 80 00 00 	movabs $0x801494,%rax
+  80366a:	00 00 00 
+  80366d:	ff d0                	call   *%rax
+    while (res < 0) {
+  80366f:	85 c0                	test   %eax,%eax
+  803671:	79 65                	jns    8036d8 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803673:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803676:	75 33                	jne    8036ab <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803678:	49 bf 97 11 80 00 00 	movabs $0x801197,%r15
+  80367f:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803682:	49 be 94 14 80 00 00 	movabs $0x801494,%r14
+  803689:	00 00 00 
+        sys_yield();
+  80368c:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80368f:	45 89 e8             	mov    %r13d,%r8d
+  803692:	4c 89 e1             	mov    %r12,%rcx
+  803695:	48 89 da             	mov    %rbx,%rdx
+  803698:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80369c:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80369f:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	79 32                	jns    8036d8 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036a6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036a9:	74 e1                	je     80368c <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8036ab:	89 c1                	mov    %eax,%ecx
+  8036ad:	48 ba a3 3e 80 00 00 	movabs $0x803ea3,%rdx
+  8036b4:	00 00 00 
+  8036b7:	be 52 00 00 00       	mov    $0x52,%esi
+  8036bc:	48 bf b7 3e 80 00 00 	movabs $0x803eb7,%rdi
+  8036c3:	00 00 00 
+  8036c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036cb:	49 b8 87 34 80 00 00 	movabs $0x803487,%r8
+  8036d2:	00 00 00 
+  8036d5:	41 ff d0             	call   *%r8
+    }
+}
+  8036d8:	48 83 c4 18          	add    $0x18,%rsp
+  8036dc:	5b                   	pop    %rbx
+  8036dd:	41 5c                	pop    %r12
+  8036df:	41 5d                	pop    %r13
+  8036e1:	41 5e                	pop    %r14
+  8036e3:	41 5f                	pop    %r15
+  8036e5:	5d                   	pop    %rbp
+  8036e6:	c3                   	ret
+
+00000000008036e7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036ec:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036f3:	00 00 00 
+  8036f6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8036fa:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8036fe:	48 c1 e2 04          	shl    $0x4,%rdx
+  803702:	48 01 ca             	add    %rcx,%rdx
+  803705:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80370b:	39 fa                	cmp    %edi,%edx
+  80370d:	74 12                	je     803721 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80370f:	48 83 c0 01          	add    $0x1,%rax
+  803713:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803719:	75 db                	jne    8036f6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80371b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803720:	c3                   	ret
+            return envs[i].env_id;
+  803721:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803725:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803729:	48 c1 e2 04          	shl    $0x4,%rdx
+  80372d:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803734:	00 00 00 
+  803737:	48 01 d0             	add    %rdx,%rax
+  80373a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803740:	c3                   	ret
+  803741:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803748 <__rodata_start>:
+  803748:	54                   	push   %rsp
+  803749:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374b:	20 6d 75             	and    %ch,0x75(%rbp)
+  80374e:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803751:	61                   	(bad)
+  803752:	72 67                	jb     8037bb <__rodata_start+0x73>
+  803754:	75 6d                	jne    8037c3 <__rodata_start+0x7b>
+  803756:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803758:	74 73                	je     8037cd <__rodata_start+0x85>
+  80375a:	20 66 6f             	and    %ah,0x6f(%rsi)
+  80375d:	72 20                	jb     80377f <__rodata_start+0x37>
+  80375f:	73 6e                	jae    8037cf <__rodata_start+0x87>
+  803761:	61                   	(bad)
+  803762:	70 73                	jo     8037d7 <__rodata_start+0x8f>
+  803764:	68 6f 74 20 67       	push   $0x6720746f
+  803769:	61                   	(bad)
+  80376a:	72 62                	jb     8037ce <__rodata_start+0x86>
+  80376c:	61                   	(bad)
+  80376d:	67 65 20 63 6f       	and    %ah,%gs:0x6f(%ebx)
+  803772:	6c                   	insb   (%dx),%es:(%rdi)
+  803773:	6c                   	insb   (%dx),%es:(%rdi)
+  803774:	65 63 74 69 6f       	movsxd %gs:0x6f(%rcx,%rbp,2),%esi
+  803779:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377a:	0a 00                	or     (%rax),%al
+  80377c:	00 00                	add    %al,(%rax)
+  80377e:	00 00                	add    %al,(%rax)
+  803780:	20 20                	and    %ah,(%rax)
+  803782:	20 20                	and    %ah,(%rax)
+  803784:	20 20                	and    %ah,(%rax)
+  803786:	20 61 72             	and    %ah,0x72(%rcx)
+  803789:	67 20 70 6f          	and    %dh,0x6f(%eax)
+  80378d:	73 69                	jae    8037f8 <__rodata_start+0xb0>
+  80378f:	74 69                	je     8037fa <__rodata_start+0xb2>
+  803791:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803792:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803793:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e157fd <__bss_end+0x7260d7fd>
+  803799:	67 75 6d             	addr32 jne 803809 <__rodata_start+0xc1>
+  80379c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80379e:	74 3a                	je     8037da <__rodata_start+0x92>
+  8037a0:	25 73 0a 00 00       	and    $0xa73,%eax
+  8037a5:	00 00                	add    %al,(%rax)
+  8037a7:	00 53 6e             	add    %dl,0x6e(%rbx)
+  8037aa:	61                   	(bad)
+  8037ab:	70 73                	jo     803820 <__rodata_start+0xd8>
+  8037ad:	68 6f 74 20 67       	push   $0x6720746f
+  8037b2:	61                   	(bad)
+  8037b3:	72 62                	jb     803817 <__rodata_start+0xcf>
+  8037b5:	61                   	(bad)
+  8037b6:	67 65 20 63 6f       	and    %ah,%gs:0x6f(%ebx)
+  8037bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8037bc:	6c                   	insb   (%dx),%es:(%rdi)
+  8037bd:	65 63 74 69 6f       	movsxd %gs:0x6f(%rcx,%rbp,2),%esi
+  8037c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c3:	20 66 61             	and    %ah,0x61(%rsi)
+  8037c6:	69 6c 65 64 3a 20 25 	imul   $0x6925203a,0x64(%rbp,%riz,2),%ebp
+  8037cd:	69 
+  8037ce:	0a 00                	or     (%rax),%al
+  8037d0:	72 65                	jb     803837 <__rodata_start+0xef>
+  8037d2:	63 6c 61 69          	movsxd 0x69(%rcx,%riz,2),%ebp
+  8037d6:	6d                   	insl   (%dx),%es:(%rdi)
+  8037d7:	65 64 20 25 64 20 62 	gs and %ah,%fs:0x79622064(%rip)        # 79e25843 <__bss_end+0x7961d843>
+  8037de:	79 
+  8037df:	74 65                	je     803846 <__rodata_start+0xfe>
+  8037e1:	73 20                	jae    803803 <__rodata_start+0xbb>
+  8037e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037e5:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037e9:	6b 0a 00             	imul   $0x0,(%rdx),%ecx
+  8037ec:	3c 75                	cmp    $0x75,%al
+  8037ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ef:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8037f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f4:	3e 00 30             	ds add %dh,(%rax)
+  8037f7:	31 32                	xor    %esi,(%rdx)
+  8037f9:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803800:	41                   	rex.B
+  803801:	42                   	rex.X
+  803802:	43                   	rex.XB
+  803803:	44                   	rex.R
+  803804:	45                   	rex.RB
+  803805:	46 00 30             	rex.RX add %r14b,(%rax)
+  803808:	31 32                	xor    %esi,(%rdx)
+  80380a:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803811:	61                   	(bad)
+  803812:	62 63 64 65 66       	(bad)
+  803817:	00 28                	add    %ch,(%rax)
+  803819:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80381a:	75 6c                	jne    803888 <__rodata_start+0x140>
+  80381c:	6c                   	insb   (%dx),%es:(%rdi)
+  80381d:	29 00                	sub    %eax,(%rax)
+  80381f:	65 72 72             	gs jb  803894 <__rodata_start+0x14c>
+  803822:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803823:	72 20                	jb     803845 <__rodata_start+0xfd>
+  803825:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80382a:	73 70                	jae    80389c <__rodata_start+0x154>
+  80382c:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803830:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803837:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803838:	72 00                	jb     80383a <__rodata_start+0xf2>
+  80383a:	62 61 64 20 65       	(bad)
+  80383f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803840:	76 69                	jbe    8038ab <__rodata_start+0x163>
+  803842:	72 6f                	jb     8038b3 <__rodata_start+0x16b>
+  803844:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803845:	6d                   	insl   (%dx),%es:(%rdi)
+  803846:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803848:	74 00                	je     80384a <__rodata_start+0x102>
+  80384a:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803851:	20 70 61             	and    %dh,0x61(%rax)
+  803854:	72 61                	jb     8038b7 <__rodata_start+0x16f>
+  803856:	6d                   	insl   (%dx),%es:(%rdi)
+  803857:	65 74 65             	gs je  8038bf <__rodata_start+0x177>
+  80385a:	72 00                	jb     80385c <__rodata_start+0x114>
+  80385c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80385d:	75 74                	jne    8038d3 <__rodata_start+0x18b>
+  80385f:	20 6f 66             	and    %ch,0x66(%rdi)
+  803862:	20 6d 65             	and    %ch,0x65(%rbp)
+  803865:	6d                   	insl   (%dx),%es:(%rdi)
+  803866:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803867:	72 79                	jb     8038e2 <__rodata_start+0x19a>
+  803869:	00 6f 75             	add    %ch,0x75(%rdi)
+  80386c:	74 20                	je     80388e <__rodata_start+0x146>
+  80386e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80386f:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803873:	76 69                	jbe    8038de <__rodata_start+0x196>
+  803875:	72 6f                	jb     8038e6 <__rodata_start+0x19e>
+  803877:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803878:	6d                   	insl   (%dx),%es:(%rdi)
+  803879:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80387b:	74 73                	je     8038f0 <__rodata_start+0x1a8>
+  80387d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803880:	72 72                	jb     8038f4 <__rodata_start+0x1ac>
+  803882:	75 70                	jne    8038f4 <__rodata_start+0x1ac>
+  803884:	74 65                	je     8038eb <__rodata_start+0x1a3>
+  803886:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80388b:	75 67                	jne    8038f4 <__rodata_start+0x1ac>
+  80388d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803890:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803892:	00 73 65             	add    %dh,0x65(%rbx)
+  803895:	67 6d                	insl   (%dx),%es:(%edi)
+  803897:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803899:	74 61                	je     8038fc <__rodata_start+0x1b4>
+  80389b:	74 69                	je     803906 <__rodata_start+0x1be>
+  80389d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80389e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80389f:	20 66 61             	and    %ah,0x61(%rsi)
+  8038a2:	75 6c                	jne    803910 <__rodata_start+0x1c8>
+  8038a4:	74 00                	je     8038a6 <__rodata_start+0x15e>
+  8038a6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038ad:	20 45 4c             	and    %al,0x4c(%rbp)
+  8038b0:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8038b4:	61                   	(bad)
+  8038b5:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8038ba:	20 73 75             	and    %dh,0x75(%rbx)
+  8038bd:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8038c0:	73 79                	jae    80393b <__rodata_start+0x1f3>
+  8038c2:	73 74                	jae    803938 <__rodata_start+0x1f0>
+  8038c4:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8038c6:	20 63 61             	and    %ah,0x61(%rbx)
+  8038c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8038ca:	6c                   	insb   (%dx),%es:(%rdi)
+  8038cb:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8038ce:	74 72                	je     803942 <__rodata_start+0x1fa>
+  8038d0:	79 20                	jns    8038f2 <__rodata_start+0x1aa>
+  8038d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d4:	74 20                	je     8038f6 <__rodata_start+0x1ae>
+  8038d6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038d8:	75 6e                	jne    803948 <__rodata_start+0x200>
+  8038da:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8038de:	76 20                	jbe    803900 <__rodata_start+0x1b8>
+  8038e0:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8038e7:	72 65                	jb     80394e <__rodata_start+0x206>
+  8038e9:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8038ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038ed:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8038f1:	65 78 70             	gs js  803964 <__rodata_start+0x21c>
+  8038f4:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8038f9:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8038fc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803900:	20 66 69             	and    %ah,0x69(%rsi)
+  803903:	6c                   	insb   (%dx),%es:(%rdi)
+  803904:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803908:	20 66 72             	and    %ah,0x72(%rsi)
+  80390b:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803910:	61                   	(bad)
+  803911:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803914:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803915:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803916:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80391a:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80391d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80391e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80391f:	20 6d 61             	and    %ch,0x61(%rbp)
+  803922:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803923:	79 20                	jns    803945 <__rodata_start+0x1fd>
+  803925:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  80392c:	72 65                	jb     803993 <__rodata_start+0x24b>
+  80392e:	20 6f 70             	and    %ch,0x70(%rdi)
+  803931:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803933:	00 66 69             	add    %ah,0x69(%rsi)
+  803936:	6c                   	insb   (%dx),%es:(%rdi)
+  803937:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  80393b:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80393e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803942:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803943:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803944:	74 20                	je     803966 <__rodata_start+0x21e>
+  803946:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803948:	75 6e                	jne    8039b8 <__rodata_start+0x270>
+  80394a:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80394e:	76 61                	jbe    8039b1 <__rodata_start+0x269>
+  803950:	6c                   	insb   (%dx),%es:(%rdi)
+  803951:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803958:	00 
+  803959:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803960:	72 65                	jb     8039c7 <__rodata_start+0x27f>
+  803962:	61                   	(bad)
+  803963:	64 79 20             	fs jns 803986 <__rodata_start+0x23e>
+  803966:	65 78 69             	gs js  8039d2 <__rodata_start+0x28a>
+  803969:	73 74                	jae    8039df <__rodata_start+0x297>
+  80396b:	73 00                	jae    80396d <__rodata_start+0x225>
+  80396d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80396e:	70 65                	jo     8039d5 <__rodata_start+0x28d>
+  803970:	72 61                	jb     8039d3 <__rodata_start+0x28b>
+  803972:	74 69                	je     8039dd <__rodata_start+0x295>
+  803974:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803975:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803976:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803979:	74 20                	je     80399b <__rodata_start+0x253>
+  80397b:	73 75                	jae    8039f2 <__rodata_start+0x2aa>
+  80397d:	70 70                	jo     8039ef <__rodata_start+0x2a7>
+  80397f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803980:	72 74                	jb     8039f6 <__rodata_start+0x2ae>
+  803982:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803988:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80398d:	74 00                	je     80398f <__rodata_start+0x247>
+  80398f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803996:	00 00 00 
+  803999:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  8039a0:	62                   	(bad)
+  8039a1:	04 80                	add    $0x80,%al
+  8039a3:	00 00                	add    %al,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 93 0a 80 00 00    	add    %dl,0x800a(%rbx)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 81 04 80 00 00    	add    %al,0x8004(%rcx)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 75 04             	add    %dh,0x4(%rbp)
+  8039f2:	80 00 00             	addb   $0x0,(%rax)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 ef                	add    %ch,%bh
+  8039f9:	04 80                	add    $0x80,%al
+  8039fb:	00 00                	add    %al,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 75 04             	add    %dh,0x4(%rbp)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 c6                	add    %al,%dh
+  803b49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b4f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 12                	add    %dl,(%rdx)
+  803ba1:	05 80 00 00 00       	add    $0x80,%eax
+  803ba6:	00 00                	add    %al,(%rax)
+  803ba8:	e1 06                	loope  803bb0 <__rodata_start+0x468>
+  803baa:	80 00 00             	addb   $0x0,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 41 05             	add    %al,0x5(%rcx)
+  803bd2:	80 00 00             	addb   $0x0,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 07                	add    %al,(%rdi)
+  803be9:	05 80 00 00 00       	add    $0x80,%eax
+  803bee:	00 00                	add    %al,(%rax)
+  803bf0:	a3 0a 80 00 00 00 00 	movabs %eax,0xa30000000000800a
+  803bf7:	00 a3 
+  803bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bff:	00 89 08 80 00 00    	add    %cl,0x8008(%rcx)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 53 09             	add    %dl,0x9(%rbx)
+  803c0a:	80 00 00             	addb   $0x0,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 d8                	add    %bl,%al
+  803c21:	05 80 00 00 00       	add    $0x80,%eax
+  803c26:	00 00                	add    %al,(%rax)
+  803c28:	a3 0a 80 00 00 00 00 	movabs %eax,0xb50000000000800a
+  803c2f:	00 b5 
+  803c31:	07                   	(bad)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 c6                	add    %al,%dh
+  803c49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803c4f:	00 a3 0a 80 00 00    	add    %ah,0x800a(%rbx)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 6b 04             	add    %ch,0x4(%rbx)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	28 38 80 00 00 00 00 00 3a 38 80 00 00 00 00 00     (8......:8......
+  803c78:	4a 38 80 00 00 00 00 00 5c 38 80 00 00 00 00 00     J8......\8......
+  803c88:	6a 38 80 00 00 00 00 00 7e 38 80 00 00 00 00 00     j8......~8......
+  803c98:	93 38 80 00 00 00 00 00 a6 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	b8 38 80 00 00 00 00 00 cc 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	dc 38 80 00 00 00 00 00 ef 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	06 39 80 00 00 00 00 00 1c 39 80 00 00 00 00 00     .9.......9......
+  803cd8:	34 39 80 00 00 00 00 00 4c 39 80 00 00 00 00 00     49......L9......
+  803ce8:	59 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     Y9.......=......
+  803cf8:	6d 39 80 00 00 00 00 00 85 39 80 00 00 00 00 00     m9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803d28:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803d38:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803d48:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803d58:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d68:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d78:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803d88:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803d98:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803da8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803db8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803dc8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803dd8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803de8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803df8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803e00 <devtab>:
+  803e00:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803e10:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803e20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803e30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803e40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803e50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803e80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803e90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803ea0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803eb0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,6938 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 00 00 00       	call   800070 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf c0 36 80 00 00 	movabs $0x8036c0,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb ee 01 80 00 00 	movabs $0x8001ee,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800049:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800050:	00 00 00 
+  800053:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800059:	48 bf ce 36 80 00 00 	movabs $0x8036ce,%rdi
+  800060:	00 00 00 
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	ff d3                	call   *%rbx
+}
+  80006a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	41 56                	push   %r14
+  800076:	41 55                	push   %r13
+  800078:	41 54                	push   %r12
+  80007a:	53                   	push   %rbx
+  80007b:	41 89 fd             	mov    %edi,%r13d
+  80007e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800081:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800088:	00 00 00 
+  80008b:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800092:	00 00 00 
+  800095:	48 39 c2             	cmp    %rax,%rdx
+  800098:	73 17                	jae    8000b1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009d:	49 89 c4             	mov    %rax,%r12
+  8000a0:	48 83 c3 08          	add    $0x8,%rbx
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ac:	4c 39 e3             	cmp    %r12,%rbx
+  8000af:	72 ef                	jb     8000a0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b1:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000c6:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000ca:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d5:	00 00 00 
+  8000d8:	48 01 d0             	add    %rdx,%rax
+  8000db:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e5:	45 85 ed             	test   %r13d,%r13d
+  8000e8:	7e 0d                	jle    8000f7 <libmain+0x87>
+  8000ea:	49 8b 06             	mov    (%r14),%rax
+  8000ed:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000f4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f7:	4c 89 f6             	mov    %r14,%rsi
+  8000fa:	44 89 ef             	mov    %r13d,%edi
+  8000fd:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800109:	48 b8 1e 01 80 00 00 	movabs $0x80011e,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+#endif
+}
+  800115:	5b                   	pop    %rbx
+  800116:	41 5c                	pop    %r12
+  800118:	41 5d                	pop    %r13
+  80011a:	41 5e                	pop    %r14
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800122:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80012e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800133:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  80013a:	00 00 00 
+  80013d:	ff d0                	call   *%rax
+}
+  80013f:	5d                   	pop    %rbp
+  800140:	c3                   	ret
+
+0000000000800141 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800141:	55                   	push   %rbp
+  800142:	48 89 e5             	mov    %rsp,%rbp
+  800145:	53                   	push   %rbx
+  800146:	48 83 ec 08          	sub    $0x8,%rsp
+  80014a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80014d:	8b 06                	mov    (%rsi),%eax
+  80014f:	8d 50 01             	lea    0x1(%rax),%edx
+  800152:	89 16                	mov    %edx,(%rsi)
+  800154:	48 98                	cltq
+  800156:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80015b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800161:	74 0a                	je     80016d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800163:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800167:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016b:	c9                   	leave
+  80016c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80016d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800171:	be ff 00 00 00       	mov    $0xff,%esi
+  800176:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  80017d:	00 00 00 
+  800180:	ff d0                	call   *%rax
+        state->offset = 0;
+  800182:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800188:	eb d9                	jmp    800163 <putch+0x22>
+
+000000000080018a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80018a:	55                   	push   %rbp
+  80018b:	48 89 e5             	mov    %rsp,%rbp
+  80018e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800195:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800198:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80019f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001ac:	48 89 f1             	mov    %rsi,%rcx
+  8001af:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001b6:	48 bf 41 01 80 00 00 	movabs $0x800141,%rdi
+  8001bd:	00 00 00 
+  8001c0:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001cc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001d3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001da:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001e6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001ec:	c9                   	leave
+  8001ed:	c3                   	ret
+
+00000000008001ee <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8001f6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001fa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800202:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800206:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80020a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800211:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800215:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800219:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80021d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800221:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800225:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+0000000000800233 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800233:	55                   	push   %rbp
+  800234:	48 89 e5             	mov    %rsp,%rbp
+  800237:	41 57                	push   %r15
+  800239:	41 56                	push   %r14
+  80023b:	41 55                	push   %r13
+  80023d:	41 54                	push   %r12
+  80023f:	53                   	push   %rbx
+  800240:	48 83 ec 18          	sub    $0x18,%rsp
+  800244:	49 89 fc             	mov    %rdi,%r12
+  800247:	49 89 f5             	mov    %rsi,%r13
+  80024a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80024e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800251:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800254:	41 89 cf             	mov    %ecx,%r15d
+  800257:	4c 39 fa             	cmp    %r15,%rdx
+  80025a:	73 5b                	jae    8002b7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80025c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800260:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7e 0e                	jle    800276 <print_num+0x43>
+            putch(padc, put_arg);
+  800268:	4c 89 ee             	mov    %r13,%rsi
+  80026b:	44 89 f7             	mov    %r14d,%edi
+  80026e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800271:	83 eb 01             	sub    $0x1,%ebx
+  800274:	75 f2                	jne    800268 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800276:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80027a:	48 b9 00 37 80 00 00 	movabs $0x803700,%rcx
+  800281:	00 00 00 
+  800284:	48 b8 ef 36 80 00 00 	movabs $0x8036ef,%rax
+  80028b:	00 00 00 
+  80028e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800292:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029b:	49 f7 f7             	div    %r15
+  80029e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002a2:	4c 89 ee             	mov    %r13,%rsi
+  8002a5:	41 ff d4             	call   *%r12
+}
+  8002a8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002ac:	5b                   	pop    %rbx
+  8002ad:	41 5c                	pop    %r12
+  8002af:	41 5d                	pop    %r13
+  8002b1:	41 5e                	pop    %r14
+  8002b3:	41 5f                	pop    %r15
+  8002b5:	5d                   	pop    %rbp
+  8002b6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c0:	49 f7 f7             	div    %r15
+  8002c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002cb:	52                   	push   %rdx
+  8002cc:	45 0f be c9          	movsbl %r9b,%r9d
+  8002d0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002d4:	48 89 c2             	mov    %rax,%rdx
+  8002d7:	48 b8 33 02 80 00 00 	movabs $0x800233,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+  8002e3:	48 83 c4 10          	add    $0x10,%rsp
+  8002e7:	eb 8d                	jmp    800276 <print_num+0x43>
+
+00000000008002e9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002e9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002ed:	48 8b 06             	mov    (%rsi),%rax
+  8002f0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002f4:	73 0a                	jae    800300 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002f6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002fa:	48 89 16             	mov    %rdx,(%rsi)
+  8002fd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800300:	c3                   	ret
+
+0000000000800301 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800301:	55                   	push   %rbp
+  800302:	48 89 e5             	mov    %rsp,%rbp
+  800305:	48 83 ec 50          	sub    $0x50,%rsp
+  800309:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80030d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800311:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800315:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80031c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800320:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800324:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800328:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80032c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800330:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  800337:	00 00 00 
+  80033a:	ff d0                	call   *%rax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+000000000080033e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80033e:	55                   	push   %rbp
+  80033f:	48 89 e5             	mov    %rsp,%rbp
+  800342:	41 57                	push   %r15
+  800344:	41 56                	push   %r14
+  800346:	41 55                	push   %r13
+  800348:	41 54                	push   %r12
+  80034a:	53                   	push   %rbx
+  80034b:	48 83 ec 38          	sub    $0x38,%rsp
+  80034f:	49 89 fe             	mov    %rdi,%r14
+  800352:	49 89 f5             	mov    %rsi,%r13
+  800355:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800358:	48 8b 01             	mov    (%rcx),%rax
+  80035b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80035f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800363:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800367:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80036b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80036f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800373:	0f b6 3b             	movzbl (%rbx),%edi
+  800376:	40 80 ff 25          	cmp    $0x25,%dil
+  80037a:	74 18                	je     800394 <vprintfmt+0x56>
+            if (!ch) return;
+  80037c:	40 84 ff             	test   %dil,%dil
+  80037f:	0f 84 b1 06 00 00    	je     800a36 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800385:	40 0f b6 ff          	movzbl %dil,%edi
+  800389:	4c 89 ee             	mov    %r13,%rsi
+  80038c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80038f:	4c 89 e3             	mov    %r12,%rbx
+  800392:	eb db                	jmp    80036f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800394:	be 00 00 00 00       	mov    $0x0,%esi
+  800399:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80039d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003a2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003a8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003af:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003b3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003b8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003bd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003c0:	83 e8 23             	sub    $0x23,%eax
+  8003c3:	3c 57                	cmp    $0x57,%al
+  8003c5:	0f 87 51 06 00 00    	ja     800a1c <vprintfmt+0x6de>
+  8003cb:	0f b6 c0             	movzbl %al,%eax
+  8003ce:	48 b9 a0 38 80 00 00 	movabs $0x8038a0,%rcx
+  8003d5:	00 00 00 
+  8003d8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003db:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003de:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003e2:	eb cf                	jmp    8003b3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003e4:	49 89 dc             	mov    %rbx,%r12
+  8003e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ec:	eb c5                	jmp    8003b3 <vprintfmt+0x75>
+            padc = ch;
+  8003ee:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003f2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003f5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003f8:	eb b9                	jmp    8003b3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800400:	77 24                	ja     800426 <vprintfmt+0xe8>
+  800402:	89 c1                	mov    %eax,%ecx
+  800404:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800408:	83 c0 08             	add    $0x8,%eax
+  80040b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80040e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800411:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800414:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800418:	79 99                	jns    8003b3 <vprintfmt+0x75>
+                width = precision;
+  80041a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80041e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800424:	eb 8d                	jmp    8003b3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800426:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80042a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80042e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800432:	eb da                	jmp    80040e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800434:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800439:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80043d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800443:	3c 39                	cmp    $0x39,%al
+  800445:	77 1c                	ja     800463 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800447:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80044b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80044f:	0f b6 c0             	movzbl %al,%eax
+  800452:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800457:	0f b6 03             	movzbl (%rbx),%eax
+  80045a:	3c 39                	cmp    $0x39,%al
+  80045c:	76 e9                	jbe    800447 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800461:	eb b1                	jmp    800414 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+  800466:	eb ac                	jmp    800414 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800468:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80046b:	85 c9                	test   %ecx,%ecx
+  80046d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800472:	0f 49 c1             	cmovns %ecx,%eax
+  800475:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800478:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80047b:	e9 33 ff ff ff       	jmp    8003b3 <vprintfmt+0x75>
+            lflag++;
+  800480:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800483:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800486:	e9 28 ff ff ff       	jmp    8003b3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80048b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80048e:	83 f8 2f             	cmp    $0x2f,%eax
+  800491:	77 19                	ja     8004ac <vprintfmt+0x16e>
+  800493:	89 c2                	mov    %eax,%edx
+  800495:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800499:	83 c0 08             	add    $0x8,%eax
+  80049c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049f:	8b 3a                	mov    (%rdx),%edi
+  8004a1:	4c 89 ee             	mov    %r13,%rsi
+  8004a4:	41 ff d6             	call   *%r14
+            break;
+  8004a7:	e9 c3 fe ff ff       	jmp    80036f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b8:	eb e5                	jmp    80049f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c0:	77 5a                	ja     80051c <vprintfmt+0x1de>
+  8004c2:	89 c2                	mov    %eax,%edx
+  8004c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c8:	83 c0 08             	add    $0x8,%eax
+  8004cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ce:	8b 02                	mov    (%rdx),%eax
+  8004d0:	89 c1                	mov    %eax,%ecx
+  8004d2:	f7 d9                	neg    %ecx
+  8004d4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004d7:	83 f9 14             	cmp    $0x14,%ecx
+  8004da:	7f 4e                	jg     80052a <vprintfmt+0x1ec>
+  8004dc:	48 63 c1             	movslq %ecx,%rax
+  8004df:	48 ba 60 3b 80 00 00 	movabs $0x803b60,%rdx
+  8004e6:	00 00 00 
+  8004e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004ed:	48 85 c0             	test   %rax,%rax
+  8004f0:	74 38                	je     80052a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004f2:	48 89 c1             	mov    %rax,%rcx
+  8004f5:	48 ba 39 3d 80 00 00 	movabs $0x803d39,%rdx
+  8004fc:	00 00 00 
+  8004ff:	4c 89 ee             	mov    %r13,%rsi
+  800502:	4c 89 f7             	mov    %r14,%rdi
+  800505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050a:	49 b8 01 03 80 00 00 	movabs $0x800301,%r8
+  800511:	00 00 00 
+  800514:	41 ff d0             	call   *%r8
+  800517:	e9 53 fe ff ff       	jmp    80036f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80051c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800520:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800524:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800528:	eb a4                	jmp    8004ce <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80052a:	48 ba 18 37 80 00 00 	movabs $0x803718,%rdx
+  800531:	00 00 00 
+  800534:	4c 89 ee             	mov    %r13,%rsi
+  800537:	4c 89 f7             	mov    %r14,%rdi
+  80053a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053f:	49 b8 01 03 80 00 00 	movabs $0x800301,%r8
+  800546:	00 00 00 
+  800549:	41 ff d0             	call   *%r8
+  80054c:	e9 1e fe ff ff       	jmp    80036f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800551:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800554:	83 f8 2f             	cmp    $0x2f,%eax
+  800557:	77 6c                	ja     8005c5 <vprintfmt+0x287>
+  800559:	89 c2                	mov    %eax,%edx
+  80055b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055f:	83 c0 08             	add    $0x8,%eax
+  800562:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800565:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800568:	48 85 d2             	test   %rdx,%rdx
+  80056b:	48 b8 11 37 80 00 00 	movabs $0x803711,%rax
+  800572:	00 00 00 
+  800575:	48 0f 45 c2          	cmovne %rdx,%rax
+  800579:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80057d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800581:	7e 06                	jle    800589 <vprintfmt+0x24b>
+  800583:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800587:	75 4a                	jne    8005d3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800589:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80058d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800591:	0f b6 00             	movzbl (%rax),%eax
+  800594:	84 c0                	test   %al,%al
+  800596:	0f 85 9a 00 00 00    	jne    800636 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80059c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80059f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005a3:	85 c0                	test   %eax,%eax
+  8005a5:	0f 8e c4 fd ff ff    	jle    80036f <vprintfmt+0x31>
+  8005ab:	4c 89 ee             	mov    %r13,%rsi
+  8005ae:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005b3:	41 ff d6             	call   *%r14
+  8005b6:	41 83 ec 01          	sub    $0x1,%r12d
+  8005ba:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005be:	75 eb                	jne    8005ab <vprintfmt+0x26d>
+  8005c0:	e9 aa fd ff ff       	jmp    80036f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d1:	eb 92                	jmp    800565 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005d3:	49 63 f7             	movslq %r15d,%rsi
+  8005d6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005da:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+  8005e6:	48 89 c2             	mov    %rax,%rdx
+  8005e9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ec:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005ee:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005f1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005f4:	85 c0                	test   %eax,%eax
+  8005f6:	7e 91                	jle    800589 <vprintfmt+0x24b>
+  8005f8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005fd:	4c 89 ee             	mov    %r13,%rsi
+  800600:	44 89 e7             	mov    %r12d,%edi
+  800603:	41 ff d6             	call   *%r14
+  800606:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800610:	75 eb                	jne    8005fd <vprintfmt+0x2bf>
+  800612:	e9 72 ff ff ff       	jmp    800589 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800617:	0f b6 f8             	movzbl %al,%edi
+  80061a:	4c 89 ee             	mov    %r13,%rsi
+  80061d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800620:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800624:	49 83 c4 01          	add    $0x1,%r12
+  800628:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80062e:	84 c0                	test   %al,%al
+  800630:	0f 84 66 ff ff ff    	je     80059c <vprintfmt+0x25e>
+  800636:	45 85 ff             	test   %r15d,%r15d
+  800639:	78 0a                	js     800645 <vprintfmt+0x307>
+  80063b:	41 83 ef 01          	sub    $0x1,%r15d
+  80063f:	0f 88 57 ff ff ff    	js     80059c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800645:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800649:	74 cc                	je     800617 <vprintfmt+0x2d9>
+  80064b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80064e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800653:	80 fa 5e             	cmp    $0x5e,%dl
+  800656:	77 c2                	ja     80061a <vprintfmt+0x2dc>
+  800658:	eb bd                	jmp    800617 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80065a:	40 84 f6             	test   %sil,%sil
+  80065d:	75 26                	jne    800685 <vprintfmt+0x347>
+    switch (lflag) {
+  80065f:	85 d2                	test   %edx,%edx
+  800661:	74 59                	je     8006bc <vprintfmt+0x37e>
+  800663:	83 fa 01             	cmp    $0x1,%edx
+  800666:	74 7b                	je     8006e3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800668:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066b:	83 f8 2f             	cmp    $0x2f,%eax
+  80066e:	0f 87 96 00 00 00    	ja     80070a <vprintfmt+0x3cc>
+  800674:	89 c2                	mov    %eax,%edx
+  800676:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067a:	83 c0 08             	add    $0x8,%eax
+  80067d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800680:	4c 8b 22             	mov    (%rdx),%r12
+  800683:	eb 17                	jmp    80069c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800685:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800688:	83 f8 2f             	cmp    $0x2f,%eax
+  80068b:	77 21                	ja     8006ae <vprintfmt+0x370>
+  80068d:	89 c2                	mov    %eax,%edx
+  80068f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800693:	83 c0 08             	add    $0x8,%eax
+  800696:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800699:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80069c:	4d 85 e4             	test   %r12,%r12
+  80069f:	78 7a                	js     80071b <vprintfmt+0x3dd>
+            num = i;
+  8006a1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006a4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006a9:	e9 50 02 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ba:	eb dd                	jmp    800699 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c2:	77 11                	ja     8006d5 <vprintfmt+0x397>
+  8006c4:	89 c2                	mov    %eax,%edx
+  8006c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ca:	83 c0 08             	add    $0x8,%eax
+  8006cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d0:	4c 63 22             	movslq (%rdx),%r12
+  8006d3:	eb c7                	jmp    80069c <vprintfmt+0x35e>
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb ed                	jmp    8006d0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e9:	77 11                	ja     8006fc <vprintfmt+0x3be>
+  8006eb:	89 c2                	mov    %eax,%edx
+  8006ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f1:	83 c0 08             	add    $0x8,%eax
+  8006f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f7:	4c 8b 22             	mov    (%rdx),%r12
+  8006fa:	eb a0                	jmp    80069c <vprintfmt+0x35e>
+  8006fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800700:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800704:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800708:	eb ed                	jmp    8006f7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80070a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80070e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800712:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800716:	e9 65 ff ff ff       	jmp    800680 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80071b:	4c 89 ee             	mov    %r13,%rsi
+  80071e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800723:	41 ff d6             	call   *%r14
+                i = -i;
+  800726:	49 f7 dc             	neg    %r12
+  800729:	e9 73 ff ff ff       	jmp    8006a1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80072e:	40 84 f6             	test   %sil,%sil
+  800731:	75 32                	jne    800765 <vprintfmt+0x427>
+    switch (lflag) {
+  800733:	85 d2                	test   %edx,%edx
+  800735:	74 5d                	je     800794 <vprintfmt+0x456>
+  800737:	83 fa 01             	cmp    $0x1,%edx
+  80073a:	0f 84 82 00 00 00    	je     8007c2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	0f 87 a5 00 00 00    	ja     8007f1 <vprintfmt+0x4b3>
+  80074c:	89 c2                	mov    %eax,%edx
+  80074e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800752:	83 c0 08             	add    $0x8,%eax
+  800755:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800758:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80075b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800760:	e9 99 01 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800765:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800768:	83 f8 2f             	cmp    $0x2f,%eax
+  80076b:	77 19                	ja     800786 <vprintfmt+0x448>
+  80076d:	89 c2                	mov    %eax,%edx
+  80076f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800773:	83 c0 08             	add    $0x8,%eax
+  800776:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800779:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80077c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800781:	e9 78 01 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb e5                	jmp    800779 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800794:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800797:	83 f8 2f             	cmp    $0x2f,%eax
+  80079a:	77 18                	ja     8007b4 <vprintfmt+0x476>
+  80079c:	89 c2                	mov    %eax,%edx
+  80079e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a2:	83 c0 08             	add    $0x8,%eax
+  8007a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007aa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007af:	e9 4a 01 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+  8007b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c0:	eb e6                	jmp    8007a8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c8:	77 19                	ja     8007e3 <vprintfmt+0x4a5>
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d0:	83 c0 08             	add    $0x8,%eax
+  8007d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007de:	e9 1b 01 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+  8007e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ef:	eb e5                	jmp    8007d6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fd:	e9 56 ff ff ff       	jmp    800758 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800802:	40 84 f6             	test   %sil,%sil
+  800805:	75 2e                	jne    800835 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800807:	85 d2                	test   %edx,%edx
+  800809:	74 59                	je     800864 <vprintfmt+0x526>
+  80080b:	83 fa 01             	cmp    $0x1,%edx
+  80080e:	74 7f                	je     80088f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	0f 87 9f 00 00 00    	ja     8008bb <vprintfmt+0x57d>
+  80081c:	89 c2                	mov    %eax,%edx
+  80081e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800822:	83 c0 08             	add    $0x8,%eax
+  800825:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800828:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80082b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800830:	e9 c9 00 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800835:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800838:	83 f8 2f             	cmp    $0x2f,%eax
+  80083b:	77 19                	ja     800856 <vprintfmt+0x518>
+  80083d:	89 c2                	mov    %eax,%edx
+  80083f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800843:	83 c0 08             	add    $0x8,%eax
+  800846:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800849:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80084c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800851:	e9 a8 00 00 00       	jmp    8008fe <vprintfmt+0x5c0>
+  800856:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800862:	eb e5                	jmp    800849 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800864:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800867:	83 f8 2f             	cmp    $0x2f,%eax
+  80086a:	77 15                	ja     800881 <vprintfmt+0x543>
+  80086c:	89 c2                	mov    %eax,%edx
+  80086e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800872:	83 c0 08             	add    $0x8,%eax
+  800875:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800878:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80087a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80087f:	eb 7d                	jmp    8008fe <vprintfmt+0x5c0>
+  800881:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800885:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800889:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088d:	eb e9                	jmp    800878 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80088f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800892:	83 f8 2f             	cmp    $0x2f,%eax
+  800895:	77 16                	ja     8008ad <vprintfmt+0x56f>
+  800897:	89 c2                	mov    %eax,%edx
+  800899:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089d:	83 c0 08             	add    $0x8,%eax
+  8008a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008ab:	eb 51                	jmp    8008fe <vprintfmt+0x5c0>
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	eb e8                	jmp    8008a3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c7:	e9 5c ff ff ff       	jmp    800828 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008cc:	4c 89 ee             	mov    %r13,%rsi
+  8008cf:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008d4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008d7:	4c 89 ee             	mov    %r13,%rsi
+  8008da:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008df:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 47                	ja     800931 <vprintfmt+0x5f3>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800902:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800906:	0f 94 c0             	sete   %al
+  800909:	0f b6 c0             	movzbl %al,%eax
+  80090c:	50                   	push   %rax
+  80090d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800912:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800916:	4c 89 ee             	mov    %r13,%rsi
+  800919:	4c 89 f7             	mov    %r14,%rdi
+  80091c:	48 b8 33 02 80 00 00 	movabs $0x800233,%rax
+  800923:	00 00 00 
+  800926:	ff d0                	call   *%rax
+            break;
+  800928:	48 83 c4 10          	add    $0x10,%rsp
+  80092c:	e9 3e fa ff ff       	jmp    80036f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800931:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800935:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800939:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093d:	eb b7                	jmp    8008f6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80093f:	40 84 f6             	test   %sil,%sil
+  800942:	75 2b                	jne    80096f <vprintfmt+0x631>
+    switch (lflag) {
+  800944:	85 d2                	test   %edx,%edx
+  800946:	74 56                	je     80099e <vprintfmt+0x660>
+  800948:	83 fa 01             	cmp    $0x1,%edx
+  80094b:	74 7f                	je     8009cc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	0f 87 a2 00 00 00    	ja     8009fb <vprintfmt+0x6bd>
+  800959:	89 c2                	mov    %eax,%edx
+  80095b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095f:	83 c0 08             	add    $0x8,%eax
+  800962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800965:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800968:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80096d:	eb 8f                	jmp    8008fe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80096f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800972:	83 f8 2f             	cmp    $0x2f,%eax
+  800975:	77 19                	ja     800990 <vprintfmt+0x652>
+  800977:	89 c2                	mov    %eax,%edx
+  800979:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097d:	83 c0 08             	add    $0x8,%eax
+  800980:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800983:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800986:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80098b:	e9 6e ff ff ff       	jmp    8008fe <vprintfmt+0x5c0>
+  800990:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800994:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800998:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099c:	eb e5                	jmp    800983 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 18                	ja     8009be <vprintfmt+0x680>
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ac:	83 c0 08             	add    $0x8,%eax
+  8009af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b9:	e9 40 ff ff ff       	jmp    8008fe <vprintfmt+0x5c0>
+  8009be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	eb e6                	jmp    8009b2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 19                	ja     8009ed <vprintfmt+0x6af>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e8:	e9 11 ff ff ff       	jmp    8008fe <vprintfmt+0x5c0>
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb e5                	jmp    8009e0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a07:	e9 59 ff ff ff       	jmp    800965 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a0c:	4c 89 ee             	mov    %r13,%rsi
+  800a0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a14:	41 ff d6             	call   *%r14
+            break;
+  800a17:	e9 53 f9 ff ff       	jmp    80036f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a1c:	4c 89 ee             	mov    %r13,%rsi
+  800a1f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a24:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a27:	48 83 eb 01          	sub    $0x1,%rbx
+  800a2b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a2f:	75 f6                	jne    800a27 <vprintfmt+0x6e9>
+  800a31:	e9 39 f9 ff ff       	jmp    80036f <vprintfmt+0x31>
+}
+  800a36:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a3a:	5b                   	pop    %rbx
+  800a3b:	41 5c                	pop    %r12
+  800a3d:	41 5d                	pop    %r13
+  800a3f:	41 5e                	pop    %r14
+  800a41:	41 5f                	pop    %r15
+  800a43:	5d                   	pop    %rbp
+  800a44:	c3                   	ret
+
+0000000000800a45 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a45:	55                   	push   %rbp
+  800a46:	48 89 e5             	mov    %rsp,%rbp
+  800a49:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a4d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a51:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a56:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a5a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a61:	48 85 ff             	test   %rdi,%rdi
+  800a64:	74 2b                	je     800a91 <vsnprintf+0x4c>
+  800a66:	48 85 f6             	test   %rsi,%rsi
+  800a69:	74 26                	je     800a91 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a6f:	48 bf e9 02 80 00 00 	movabs $0x8002e9,%rdi
+  800a76:	00 00 00 
+  800a79:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a89:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a8c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a96:	eb f7                	jmp    800a8f <vsnprintf+0x4a>
+
+0000000000800a98 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a98:	55                   	push   %rbp
+  800a99:	48 89 e5             	mov    %rsp,%rbp
+  800a9c:	48 83 ec 50          	sub    $0x50,%rsp
+  800aa0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800aa4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800aa8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aac:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ab3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800abf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ac3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ac7:	48 b8 45 0a 80 00 00 	movabs $0x800a45,%rax
+  800ace:	00 00 00 
+  800ad1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ad3:	c9                   	leave
+  800ad4:	c3                   	ret
+
+0000000000800ad5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ad5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ad8:	74 10                	je     800aea <strlen+0x15>
+    size_t n = 0;
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800adf:	48 83 c0 01          	add    $0x1,%rax
+  800ae3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ae7:	75 f6                	jne    800adf <strlen+0xa>
+  800ae9:	c3                   	ret
+    size_t n = 0;
+  800aea:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800aef:	c3                   	ret
+
+0000000000800af0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800af0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800af3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800af8:	48 85 f6             	test   %rsi,%rsi
+  800afb:	74 11                	je     800b0e <strnlen+0x1e>
+  800afd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b01:	74 0c                	je     800b0f <strnlen+0x1f>
+  800b03:	48 83 c2 01          	add    $0x1,%rdx
+  800b07:	48 39 d0             	cmp    %rdx,%rax
+  800b0a:	75 f1                	jne    800afd <strnlen+0xd>
+  800b0c:	eb 04                	jmp    800b12 <strnlen+0x22>
+  800b0e:	c3                   	ret
+  800b0f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b12:	c3                   	ret
+
+0000000000800b13 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b13:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b1f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b22:	48 83 c2 01          	add    $0x1,%rdx
+  800b26:	84 c9                	test   %cl,%cl
+  800b28:	75 f1                	jne    800b1b <strcpy+0x8>
+        ;
+    return res;
+}
+  800b2a:	c3                   	ret
+
+0000000000800b2b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b2b:	55                   	push   %rbp
+  800b2c:	48 89 e5             	mov    %rsp,%rbp
+  800b2f:	41 54                	push   %r12
+  800b31:	53                   	push   %rbx
+  800b32:	48 89 fb             	mov    %rdi,%rbx
+  800b35:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b38:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  800b3f:	00 00 00 
+  800b42:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b44:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b48:	4c 89 e6             	mov    %r12,%rsi
+  800b4b:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  800b52:	00 00 00 
+  800b55:	ff d0                	call   *%rax
+    return dst;
+}
+  800b57:	48 89 d8             	mov    %rbx,%rax
+  800b5a:	5b                   	pop    %rbx
+  800b5b:	41 5c                	pop    %r12
+  800b5d:	5d                   	pop    %rbp
+  800b5e:	c3                   	ret
+
+0000000000800b5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b5f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b62:	48 85 d2             	test   %rdx,%rdx
+  800b65:	74 1f                	je     800b86 <strncpy+0x27>
+  800b67:	48 01 fa             	add    %rdi,%rdx
+  800b6a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b6d:	48 83 c1 01          	add    $0x1,%rcx
+  800b71:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b75:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b79:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b7d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b81:	48 39 ca             	cmp    %rcx,%rdx
+  800b84:	75 e7                	jne    800b6d <strncpy+0xe>
+    }
+    return ret;
+}
+  800b86:	c3                   	ret
+
+0000000000800b87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b87:	48 89 f8             	mov    %rdi,%rax
+  800b8a:	48 85 d2             	test   %rdx,%rdx
+  800b8d:	74 24                	je     800bb3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b8f:	48 83 ea 01          	sub    $0x1,%rdx
+  800b93:	74 1b                	je     800bb0 <strlcpy+0x29>
+  800b95:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b99:	0f b6 16             	movzbl (%rsi),%edx
+  800b9c:	84 d2                	test   %dl,%dl
+  800b9e:	74 10                	je     800bb0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ba0:	48 83 c6 01          	add    $0x1,%rsi
+  800ba4:	48 83 c0 01          	add    $0x1,%rax
+  800ba8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bab:	48 39 c8             	cmp    %rcx,%rax
+  800bae:	75 e9                	jne    800b99 <strlcpy+0x12>
+        *dst = '\0';
+  800bb0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bb3:	48 29 f8             	sub    %rdi,%rax
+}
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bb7:	0f b6 07             	movzbl (%rdi),%eax
+  800bba:	84 c0                	test   %al,%al
+  800bbc:	74 13                	je     800bd1 <strcmp+0x1a>
+  800bbe:	38 06                	cmp    %al,(%rsi)
+  800bc0:	75 0f                	jne    800bd1 <strcmp+0x1a>
+  800bc2:	48 83 c7 01          	add    $0x1,%rdi
+  800bc6:	48 83 c6 01          	add    $0x1,%rsi
+  800bca:	0f b6 07             	movzbl (%rdi),%eax
+  800bcd:	84 c0                	test   %al,%al
+  800bcf:	75 ed                	jne    800bbe <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bd1:	0f b6 c0             	movzbl %al,%eax
+  800bd4:	0f b6 16             	movzbl (%rsi),%edx
+  800bd7:	29 d0                	sub    %edx,%eax
+}
+  800bd9:	c3                   	ret
+
+0000000000800bda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bda:	48 85 d2             	test   %rdx,%rdx
+  800bdd:	74 1f                	je     800bfe <strncmp+0x24>
+  800bdf:	0f b6 07             	movzbl (%rdi),%eax
+  800be2:	84 c0                	test   %al,%al
+  800be4:	74 1e                	je     800c04 <strncmp+0x2a>
+  800be6:	3a 06                	cmp    (%rsi),%al
+  800be8:	75 1a                	jne    800c04 <strncmp+0x2a>
+  800bea:	48 83 c7 01          	add    $0x1,%rdi
+  800bee:	48 83 c6 01          	add    $0x1,%rsi
+  800bf2:	48 83 ea 01          	sub    $0x1,%rdx
+  800bf6:	75 e7                	jne    800bdf <strncmp+0x5>
+
+    if (!n) return 0;
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfd:	c3                   	ret
+  800bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c03:	c3                   	ret
+  800c04:	48 85 d2             	test   %rdx,%rdx
+  800c07:	74 09                	je     800c12 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c09:	0f b6 07             	movzbl (%rdi),%eax
+  800c0c:	0f b6 16             	movzbl (%rsi),%edx
+  800c0f:	29 d0                	sub    %edx,%eax
+  800c11:	c3                   	ret
+    if (!n) return 0;
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c17:	c3                   	ret
+
+0000000000800c18 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c18:	0f b6 17             	movzbl (%rdi),%edx
+  800c1b:	84 d2                	test   %dl,%dl
+  800c1d:	74 18                	je     800c37 <strchr+0x1f>
+        if (*str == c) {
+  800c1f:	0f be d2             	movsbl %dl,%edx
+  800c22:	39 f2                	cmp    %esi,%edx
+  800c24:	74 17                	je     800c3d <strchr+0x25>
+    for (; *str; str++) {
+  800c26:	48 83 c7 01          	add    $0x1,%rdi
+  800c2a:	0f b6 17             	movzbl (%rdi),%edx
+  800c2d:	84 d2                	test   %dl,%dl
+  800c2f:	75 ee                	jne    800c1f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c36:	c3                   	ret
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	c3                   	ret
+  800c3d:	48 89 f8             	mov    %rdi,%rax
+}
+  800c40:	c3                   	ret
+
+0000000000800c41 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c41:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c44:	0f b6 17             	movzbl (%rdi),%edx
+  800c47:	84 d2                	test   %dl,%dl
+  800c49:	74 13                	je     800c5e <strfind+0x1d>
+  800c4b:	0f be d2             	movsbl %dl,%edx
+  800c4e:	39 f2                	cmp    %esi,%edx
+  800c50:	74 0b                	je     800c5d <strfind+0x1c>
+  800c52:	48 83 c0 01          	add    $0x1,%rax
+  800c56:	0f b6 10             	movzbl (%rax),%edx
+  800c59:	84 d2                	test   %dl,%dl
+  800c5b:	75 ee                	jne    800c4b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c5d:	c3                   	ret
+  800c5e:	c3                   	ret
+
+0000000000800c5f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c5f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c62:	48 89 f8             	mov    %rdi,%rax
+  800c65:	48 f7 d8             	neg    %rax
+  800c68:	83 e0 07             	and    $0x7,%eax
+  800c6b:	49 89 d1             	mov    %rdx,%r9
+  800c6e:	49 29 c1             	sub    %rax,%r9
+  800c71:	78 36                	js     800ca9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c73:	40 0f b6 c6          	movzbl %sil,%eax
+  800c77:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c7e:	01 01 01 
+  800c81:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c85:	40 f6 c7 07          	test   $0x7,%dil
+  800c89:	75 38                	jne    800cc3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c8b:	4c 89 c9             	mov    %r9,%rcx
+  800c8e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c92:	74 0c                	je     800ca0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c94:	fc                   	cld
+  800c95:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c98:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c9c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ca0:	4d 85 c9             	test   %r9,%r9
+  800ca3:	75 45                	jne    800cea <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ca5:	4c 89 c0             	mov    %r8,%rax
+  800ca8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ca9:	48 85 d2             	test   %rdx,%rdx
+  800cac:	74 f7                	je     800ca5 <memset+0x46>
+  800cae:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cb1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cb4:	48 83 c0 01          	add    $0x1,%rax
+  800cb8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cbc:	48 39 c2             	cmp    %rax,%rdx
+  800cbf:	75 f3                	jne    800cb4 <memset+0x55>
+  800cc1:	eb e2                	jmp    800ca5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cc3:	40 f6 c7 01          	test   $0x1,%dil
+  800cc7:	74 06                	je     800ccf <memset+0x70>
+  800cc9:	88 07                	mov    %al,(%rdi)
+  800ccb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ccf:	40 f6 c7 02          	test   $0x2,%dil
+  800cd3:	74 07                	je     800cdc <memset+0x7d>
+  800cd5:	66 89 07             	mov    %ax,(%rdi)
+  800cd8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cdc:	40 f6 c7 04          	test   $0x4,%dil
+  800ce0:	74 a9                	je     800c8b <memset+0x2c>
+  800ce2:	89 07                	mov    %eax,(%rdi)
+  800ce4:	48 83 c7 04          	add    $0x4,%rdi
+  800ce8:	eb a1                	jmp    800c8b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cea:	41 f6 c1 04          	test   $0x4,%r9b
+  800cee:	74 06                	je     800cf6 <memset+0x97>
+  800cf0:	89 07                	mov    %eax,(%rdi)
+  800cf2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cf6:	41 f6 c1 02          	test   $0x2,%r9b
+  800cfa:	74 07                	je     800d03 <memset+0xa4>
+  800cfc:	66 89 07             	mov    %ax,(%rdi)
+  800cff:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d03:	41 f6 c1 01          	test   $0x1,%r9b
+  800d07:	74 9c                	je     800ca5 <memset+0x46>
+  800d09:	88 07                	mov    %al,(%rdi)
+  800d0b:	eb 98                	jmp    800ca5 <memset+0x46>
+
+0000000000800d0d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d0d:	48 89 f8             	mov    %rdi,%rax
+  800d10:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d13:	48 39 fe             	cmp    %rdi,%rsi
+  800d16:	73 3b                	jae    800d53 <memmove+0x46>
+  800d18:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d1c:	48 39 d7             	cmp    %rdx,%rdi
+  800d1f:	73 32                	jae    800d53 <memmove+0x46>
+        s += n;
+        d += n;
+  800d21:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d25:	48 89 d6             	mov    %rdx,%rsi
+  800d28:	48 09 fe             	or     %rdi,%rsi
+  800d2b:	48 09 ce             	or     %rcx,%rsi
+  800d2e:	40 f6 c6 07          	test   $0x7,%sil
+  800d32:	75 12                	jne    800d46 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d34:	48 83 ef 08          	sub    $0x8,%rdi
+  800d38:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d3c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d40:	fd                   	std
+  800d41:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d44:	fc                   	cld
+  800d45:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d46:	48 83 ef 01          	sub    $0x1,%rdi
+  800d4a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d4e:	fd                   	std
+  800d4f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d51:	eb f1                	jmp    800d44 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d53:	48 89 f2             	mov    %rsi,%rdx
+  800d56:	48 09 c2             	or     %rax,%rdx
+  800d59:	48 09 ca             	or     %rcx,%rdx
+  800d5c:	f6 c2 07             	test   $0x7,%dl
+  800d5f:	75 0c                	jne    800d6d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d61:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d65:	48 89 c7             	mov    %rax,%rdi
+  800d68:	fc                   	cld
+  800d69:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d6c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d6d:	48 89 c7             	mov    %rax,%rdi
+  800d70:	fc                   	cld
+  800d71:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d73:	c3                   	ret
+
+0000000000800d74 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d74:	55                   	push   %rbp
+  800d75:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d78:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  800d7f:	00 00 00 
+  800d82:	ff d0                	call   *%rax
+}
+  800d84:	5d                   	pop    %rbp
+  800d85:	c3                   	ret
+
+0000000000800d86 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d86:	55                   	push   %rbp
+  800d87:	48 89 e5             	mov    %rsp,%rbp
+  800d8a:	41 57                	push   %r15
+  800d8c:	41 56                	push   %r14
+  800d8e:	41 55                	push   %r13
+  800d90:	41 54                	push   %r12
+  800d92:	53                   	push   %rbx
+  800d93:	48 83 ec 08          	sub    $0x8,%rsp
+  800d97:	49 89 fe             	mov    %rdi,%r14
+  800d9a:	49 89 f7             	mov    %rsi,%r15
+  800d9d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800da0:	48 89 f7             	mov    %rsi,%rdi
+  800da3:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  800daa:	00 00 00 
+  800dad:	ff d0                	call   *%rax
+  800daf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800db2:	48 89 de             	mov    %rbx,%rsi
+  800db5:	4c 89 f7             	mov    %r14,%rdi
+  800db8:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+  800dc4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dc7:	48 39 c3             	cmp    %rax,%rbx
+  800dca:	74 36                	je     800e02 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dcc:	48 89 d8             	mov    %rbx,%rax
+  800dcf:	4c 29 e8             	sub    %r13,%rax
+  800dd2:	49 39 c4             	cmp    %rax,%r12
+  800dd5:	73 31                	jae    800e08 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dd7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ddc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de0:	4c 89 fe             	mov    %r15,%rsi
+  800de3:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  800dea:	00 00 00 
+  800ded:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800def:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800df3:	48 83 c4 08          	add    $0x8,%rsp
+  800df7:	5b                   	pop    %rbx
+  800df8:	41 5c                	pop    %r12
+  800dfa:	41 5d                	pop    %r13
+  800dfc:	41 5e                	pop    %r14
+  800dfe:	41 5f                	pop    %r15
+  800e00:	5d                   	pop    %rbp
+  800e01:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e02:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e06:	eb eb                	jmp    800df3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e08:	48 83 eb 01          	sub    $0x1,%rbx
+  800e0c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e10:	48 89 da             	mov    %rbx,%rdx
+  800e13:	4c 89 fe             	mov    %r15,%rsi
+  800e16:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  800e1d:	00 00 00 
+  800e20:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e22:	49 01 de             	add    %rbx,%r14
+  800e25:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e2a:	eb c3                	jmp    800def <strlcat+0x69>
+
+0000000000800e2c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e2c:	48 85 d2             	test   %rdx,%rdx
+  800e2f:	74 2d                	je     800e5e <memcmp+0x32>
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e36:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e3a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e3f:	44 38 c1             	cmp    %r8b,%cl
+  800e42:	75 0f                	jne    800e53 <memcmp+0x27>
+    while (n-- > 0) {
+  800e44:	48 83 c0 01          	add    $0x1,%rax
+  800e48:	48 39 c2             	cmp    %rax,%rdx
+  800e4b:	75 e9                	jne    800e36 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e52:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e53:	0f b6 c1             	movzbl %cl,%eax
+  800e56:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e5a:	44 29 c0             	sub    %r8d,%eax
+  800e5d:	c3                   	ret
+    return 0;
+  800e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e63:	c3                   	ret
+
+0000000000800e64 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e64:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e68:	48 39 c7             	cmp    %rax,%rdi
+  800e6b:	73 0f                	jae    800e7c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e6d:	40 38 37             	cmp    %sil,(%rdi)
+  800e70:	74 0e                	je     800e80 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e72:	48 83 c7 01          	add    $0x1,%rdi
+  800e76:	48 39 f8             	cmp    %rdi,%rax
+  800e79:	75 f2                	jne    800e6d <memfind+0x9>
+  800e7b:	c3                   	ret
+  800e7c:	48 89 f8             	mov    %rdi,%rax
+  800e7f:	c3                   	ret
+  800e80:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e83:	c3                   	ret
+
+0000000000800e84 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e84:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e87:	0f b6 37             	movzbl (%rdi),%esi
+  800e8a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e8e:	74 06                	je     800e96 <strtol+0x12>
+  800e90:	40 80 fe 09          	cmp    $0x9,%sil
+  800e94:	75 13                	jne    800ea9 <strtol+0x25>
+  800e96:	48 83 c7 01          	add    $0x1,%rdi
+  800e9a:	0f b6 37             	movzbl (%rdi),%esi
+  800e9d:	40 80 fe 20          	cmp    $0x20,%sil
+  800ea1:	74 f3                	je     800e96 <strtol+0x12>
+  800ea3:	40 80 fe 09          	cmp    $0x9,%sil
+  800ea7:	74 ed                	je     800e96 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ea9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800eac:	83 e0 fd             	and    $0xfffffffd,%eax
+  800eaf:	3c 01                	cmp    $0x1,%al
+  800eb1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ebb:	75 0f                	jne    800ecc <strtol+0x48>
+  800ebd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ec0:	74 14                	je     800ed6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ec2:	85 d2                	test   %edx,%edx
+  800ec4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ed1:	4c 63 ca             	movslq %edx,%r9
+  800ed4:	eb 36                	jmp    800f0c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eda:	74 0f                	je     800eeb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800edc:	85 d2                	test   %edx,%edx
+  800ede:	75 ec                	jne    800ecc <strtol+0x48>
+        s++;
+  800ee0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ee4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ee9:	eb e1                	jmp    800ecc <strtol+0x48>
+        s += 2;
+  800eeb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800eef:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ef4:	eb d6                	jmp    800ecc <strtol+0x48>
+            dig -= '0';
+  800ef6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ef9:	44 0f b6 c1          	movzbl %cl,%r8d
+  800efd:	41 39 d0             	cmp    %edx,%r8d
+  800f00:	7d 21                	jge    800f23 <strtol+0x9f>
+        val = val * base + dig;
+  800f02:	49 0f af c1          	imul   %r9,%rax
+  800f06:	0f b6 c9             	movzbl %cl,%ecx
+  800f09:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f0c:	48 83 c7 01          	add    $0x1,%rdi
+  800f10:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f14:	80 f9 39             	cmp    $0x39,%cl
+  800f17:	76 dd                	jbe    800ef6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f19:	80 f9 7b             	cmp    $0x7b,%cl
+  800f1c:	77 05                	ja     800f23 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f1e:	83 e9 57             	sub    $0x57,%ecx
+  800f21:	eb d6                	jmp    800ef9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f23:	4d 85 d2             	test   %r10,%r10
+  800f26:	74 03                	je     800f2b <strtol+0xa7>
+  800f28:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f2b:	48 89 c2             	mov    %rax,%rdx
+  800f2e:	48 f7 da             	neg    %rdx
+  800f31:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f35:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f39:	c3                   	ret
+
+0000000000800f3a <strrev>:
+
+void
+strrev(char *str)
+{
+  800f3a:	55                   	push   %rbp
+  800f3b:	48 89 e5             	mov    %rsp,%rbp
+  800f3e:	53                   	push   %rbx
+  800f3f:	48 83 ec 08          	sub    $0x8,%rsp
+  800f43:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f46:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  800f4d:	00 00 00 
+  800f50:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f52:	83 e8 01             	sub    $0x1,%eax
+  800f55:	85 c0                	test   %eax,%eax
+  800f57:	7e 22                	jle    800f7b <strrev+0x41>
+  800f59:	48 98                	cltq
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f60:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f64:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f68:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f6c:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f6f:	48 83 c2 01          	add    $0x1,%rdx
+  800f73:	48 83 e8 01          	sub    $0x1,%rax
+  800f77:	39 c2                	cmp    %eax,%edx
+  800f79:	7c e5                	jl     800f60 <strrev+0x26>
+	}
+}
+  800f7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+
+0000000000800f81 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f81:	85 d2                	test   %edx,%edx
+  800f83:	0f 84 80 00 00 00    	je     801009 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f89:	55                   	push   %rbp
+  800f8a:	48 89 e5             	mov    %rsp,%rbp
+  800f8d:	53                   	push   %rbx
+  800f8e:	48 83 ec 08          	sub    $0x8,%rsp
+  800f92:	49 89 f2             	mov    %rsi,%r10
+  800f95:	41 89 d3             	mov    %edx,%r11d
+  800f98:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f9b:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800fa0:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800fa3:	eb 20                	jmp    800fc5 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800fa5:	41 89 f1             	mov    %esi,%r9d
+  800fa8:	83 c2 30             	add    $0x30,%edx
+  800fab:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800fae:	89 f8                	mov    %edi,%eax
+  800fb0:	99                   	cltd
+  800fb1:	f7 f9                	idiv   %ecx
+  800fb3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	74 2e                	je     800fe7 <itoa+0x66>
+  800fb9:	83 c6 01             	add    $0x1,%esi
+  800fbc:	49 83 c0 01          	add    $0x1,%r8
+  800fc0:	44 39 cb             	cmp    %r9d,%ebx
+  800fc3:	7e 15                	jle    800fda <itoa+0x59>
+		digit = sum % base;
+  800fc5:	89 f8                	mov    %edi,%eax
+  800fc7:	99                   	cltd
+  800fc8:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fca:	83 fa 09             	cmp    $0x9,%edx
+  800fcd:	7e d6                	jle    800fa5 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800fcf:	41 89 f1             	mov    %esi,%r9d
+  800fd2:	83 c2 37             	add    $0x37,%edx
+  800fd5:	41 88 10             	mov    %dl,(%r8)
+  800fd8:	eb d4                	jmp    800fae <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fda:	41 83 eb 01          	sub    $0x1,%r11d
+  800fde:	45 39 cb             	cmp    %r9d,%r11d
+  800fe1:	75 04                	jne    800fe7 <itoa+0x66>
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	75 28                	jne    80100f <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fe7:	4d 63 c9             	movslq %r9d,%r9
+  800fea:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fef:	4c 89 d7             	mov    %r10,%rdi
+  800ff2:	48 b8 3a 0f 80 00 00 	movabs $0x800f3a,%rax
+  800ff9:	00 00 00 
+  800ffc:	ff d0                	call   *%rax
+	return 0;
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801003:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801007:	c9                   	leave
+  801008:	c3                   	ret
+		return -1;
+  801009:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80100e:	c3                   	ret
+		return -1;
+  80100f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801014:	eb ed                	jmp    801003 <itoa+0x82>
+
+0000000000801016 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801016:	55                   	push   %rbp
+  801017:	48 89 e5             	mov    %rsp,%rbp
+  80101a:	53                   	push   %rbx
+  80101b:	48 89 fa             	mov    %rdi,%rdx
+  80101e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801021:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801030:	be 00 00 00 00       	mov    $0x0,%esi
+  801035:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80103b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80103d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801041:	c9                   	leave
+  801042:	c3                   	ret
+
+0000000000801043 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801043:	55                   	push   %rbp
+  801044:	48 89 e5             	mov    %rsp,%rbp
+  801047:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801048:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80104d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801052:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801057:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801061:	be 00 00 00 00       	mov    $0x0,%esi
+  801066:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80106e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801072:	c9                   	leave
+  801073:	c3                   	ret
+
+0000000000801074 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801074:	55                   	push   %rbp
+  801075:	48 89 e5             	mov    %rsp,%rbp
+  801078:	53                   	push   %rbx
+  801079:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80107d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801080:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801085:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80108a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801094:	be 00 00 00 00       	mov    $0x0,%esi
+  801099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010a1:	48 85 c0             	test   %rax,%rax
+  8010a4:	7f 06                	jg     8010ac <sys_env_destroy+0x38>
+}
+  8010a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010ac:	49 89 c0             	mov    %rax,%r8
+  8010af:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010b4:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  8010bb:	00 00 00 
+  8010be:	be 26 00 00 00       	mov    $0x26,%esi
+  8010c3:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  8010ca:	00 00 00 
+  8010cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d2:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  8010d9:	00 00 00 
+  8010dc:	41 ff d1             	call   *%r9
+
+00000000008010df <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010df:	55                   	push   %rbp
+  8010e0:	48 89 e5             	mov    %rsp,%rbp
+  8010e3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801102:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801108:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110e:	c9                   	leave
+  80110f:	c3                   	ret
+
+0000000000801110 <sys_yield>:
+
+void
+sys_yield(void) {
+  801110:	55                   	push   %rbp
+  801111:	48 89 e5             	mov    %rsp,%rbp
+  801114:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801115:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801124:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801129:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112e:	be 00 00 00 00       	mov    $0x0,%esi
+  801133:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801139:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80113b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113f:	c9                   	leave
+  801140:	c3                   	ret
+
+0000000000801141 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801141:	55                   	push   %rbp
+  801142:	48 89 e5             	mov    %rsp,%rbp
+  801145:	53                   	push   %rbx
+  801146:	48 89 fa             	mov    %rdi,%rdx
+  801149:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80114c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801151:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801158:	00 00 00 
+  80115b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801160:	be 00 00 00 00       	mov    $0x0,%esi
+  801165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80116b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80116d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801171:	c9                   	leave
+  801172:	c3                   	ret
+
+0000000000801173 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+  801177:	53                   	push   %rbx
+  801178:	49 89 f8             	mov    %rdi,%r8
+  80117b:	48 89 d3             	mov    %rdx,%rbx
+  80117e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801181:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801186:	4c 89 c2             	mov    %r8,%rdx
+  801189:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118c:	be 00 00 00 00       	mov    $0x0,%esi
+  801191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801197:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801199:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119d:	c9                   	leave
+  80119e:	c3                   	ret
+
+000000000080119f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80119f:	55                   	push   %rbp
+  8011a0:	48 89 e5             	mov    %rsp,%rbp
+  8011a3:	53                   	push   %rbx
+  8011a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a8:	89 f8                	mov    %edi,%eax
+  8011aa:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011ad:	48 63 f9             	movslq %ecx,%rdi
+  8011b0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c8:	48 85 c0             	test   %rax,%rax
+  8011cb:	7f 06                	jg     8011d3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d1:	c9                   	leave
+  8011d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011d3:	49 89 c0             	mov    %rax,%r8
+  8011d6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011db:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  8011e2:	00 00 00 
+  8011e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8011ea:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  8011f1:	00 00 00 
+  8011f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f9:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  801200:	00 00 00 
+  801203:	41 ff d1             	call   *%r9
+
+0000000000801206 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	53                   	push   %rbx
+  80120b:	48 83 ec 08          	sub    $0x8,%rsp
+  80120f:	89 f8                	mov    %edi,%eax
+  801211:	49 89 f2             	mov    %rsi,%r10
+  801214:	48 89 cf             	mov    %rcx,%rdi
+  801217:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80121a:	48 63 da             	movslq %edx,%rbx
+  80121d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801220:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801225:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801228:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80122b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122d:	48 85 c0             	test   %rax,%rax
+  801230:	7f 06                	jg     801238 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801238:	49 89 c0             	mov    %rax,%r8
+  80123b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801240:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  801247:	00 00 00 
+  80124a:	be 26 00 00 00       	mov    $0x26,%esi
+  80124f:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  801256:	00 00 00 
+  801259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125e:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  801265:	00 00 00 
+  801268:	41 ff d1             	call   *%r9
+
+000000000080126b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80126b:	55                   	push   %rbp
+  80126c:	48 89 e5             	mov    %rsp,%rbp
+  80126f:	53                   	push   %rbx
+  801270:	48 83 ec 08          	sub    $0x8,%rsp
+  801274:	48 89 f1             	mov    %rsi,%rcx
+  801277:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80127a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801282:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801287:	be 00 00 00 00       	mov    $0x0,%esi
+  80128c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801292:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801294:	48 85 c0             	test   %rax,%rax
+  801297:	7f 06                	jg     80129f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801299:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129d:	c9                   	leave
+  80129e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80129f:	49 89 c0             	mov    %rax,%r8
+  8012a2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012a7:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  8012ae:	00 00 00 
+  8012b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b6:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  8012bd:	00 00 00 
+  8012c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c5:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  8012cc:	00 00 00 
+  8012cf:	41 ff d1             	call   *%r9
+
+00000000008012d2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+  8012d6:	53                   	push   %rbx
+  8012d7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012db:	48 63 ce             	movslq %esi,%rcx
+  8012de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fd:	48 85 c0             	test   %rax,%rax
+  801300:	7f 06                	jg     801308 <sys_env_set_status+0x36>
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801308:	49 89 c0             	mov    %rax,%r8
+  80130b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801310:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  801317:	00 00 00 
+  80131a:	be 26 00 00 00       	mov    $0x26,%esi
+  80131f:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  801326:	00 00 00 
+  801329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132e:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  801335:	00 00 00 
+  801338:	41 ff d1             	call   *%r9
+
+000000000080133b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	53                   	push   %rbx
+  801340:	48 83 ec 08          	sub    $0x8,%rsp
+  801344:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801347:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801354:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801359:	be 00 00 00 00       	mov    $0x0,%esi
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801364:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801366:	48 85 c0             	test   %rax,%rax
+  801369:	7f 06                	jg     801371 <sys_env_set_trapframe+0x36>
+}
+  80136b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136f:	c9                   	leave
+  801370:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801371:	49 89 c0             	mov    %rax,%r8
+  801374:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801379:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  801380:	00 00 00 
+  801383:	be 26 00 00 00       	mov    $0x26,%esi
+  801388:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  80138f:	00 00 00 
+  801392:	b8 00 00 00 00       	mov    $0x0,%eax
+  801397:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  80139e:	00 00 00 
+  8013a1:	41 ff d1             	call   *%r9
+
+00000000008013a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+  8013a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013cf:	48 85 c0             	test   %rax,%rax
+  8013d2:	7f 06                	jg     8013da <sys_env_set_pgfault_upcall+0x36>
+}
+  8013d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d8:	c9                   	leave
+  8013d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013da:	49 89 c0             	mov    %rax,%r8
+  8013dd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013e2:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  8013e9:	00 00 00 
+  8013ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f1:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  8013f8:	00 00 00 
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801400:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  801407:	00 00 00 
+  80140a:	41 ff d1             	call   *%r9
+
+000000000080140d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80140d:	55                   	push   %rbp
+  80140e:	48 89 e5             	mov    %rsp,%rbp
+  801411:	53                   	push   %rbx
+  801412:	89 f8                	mov    %edi,%eax
+  801414:	49 89 f1             	mov    %rsi,%r9
+  801417:	48 89 d3             	mov    %rdx,%rbx
+  80141a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80141d:	49 63 f0             	movslq %r8d,%rsi
+  801420:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801423:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801428:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801431:	cd 30                	int    $0x30
+}
+  801433:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801437:	c9                   	leave
+  801438:	c3                   	ret
+
+0000000000801439 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801439:	55                   	push   %rbp
+  80143a:	48 89 e5             	mov    %rsp,%rbp
+  80143d:	53                   	push   %rbx
+  80143e:	48 83 ec 08          	sub    $0x8,%rsp
+  801442:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801445:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801448:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+  80145a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801460:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801462:	48 85 c0             	test   %rax,%rax
+  801465:	7f 06                	jg     80146d <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146d:	49 89 c0             	mov    %rax,%r8
+  801470:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801475:	48 ba 28 3c 80 00 00 	movabs $0x803c28,%rdx
+  80147c:	00 00 00 
+  80147f:	be 26 00 00 00       	mov    $0x26,%esi
+  801484:	48 bf 47 3c 80 00 00 	movabs $0x803c47,%rdi
+  80148b:	00 00 00 
+  80148e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801493:	49 b9 00 34 80 00 00 	movabs $0x803400,%r9
+  80149a:	00 00 00 
+  80149d:	41 ff d1             	call   *%r9
+
+00000000008014a0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8014a0:	55                   	push   %rbp
+  8014a1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8014a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a9:	48 b8 39 14 80 00 00 	movabs $0x801439,%rax
+  8014b0:	00 00 00 
+  8014b3:	ff d0                	call   *%rax
+}
+  8014b5:	5d                   	pop    %rbp
+  8014b6:	c3                   	ret
+
+00000000008014b7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8014b7:	55                   	push   %rbp
+  8014b8:	48 89 e5             	mov    %rsp,%rbp
+  8014bb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e6:	c9                   	leave
+  8014e7:	c3                   	ret
+
+00000000008014e8 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014e8:	55                   	push   %rbp
+  8014e9:	48 89 e5             	mov    %rsp,%rbp
+  8014ec:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014ed:	48 63 ce             	movslq %esi,%rcx
+  8014f0:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801503:	be 00 00 00 00       	mov    $0x0,%esi
+  801508:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150e:	cd 30                	int    $0x30
+}
+  801510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+0000000000801516 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80151e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801522:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801527:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+}
+  80153e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+
+0000000000801544 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801544:	55                   	push   %rbp
+  801545:	48 89 e5             	mov    %rsp,%rbp
+  801548:	53                   	push   %rbx
+  801549:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80154c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80154f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801554:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801557:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801567:	cd 30                	int    $0x30
+}
+  801569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156d:	c9                   	leave
+  80156e:	c3                   	ret
+
+000000000080156f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80156f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801576:	ff ff ff 
+  801579:	48 01 f8             	add    %rdi,%rax
+  80157c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801580:	c3                   	ret
+
+0000000000801581 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801581:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801588:	ff ff ff 
+  80158b:	48 01 f8             	add    %rdi,%rax
+  80158e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801592:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801598:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80159c:	c3                   	ret
+
+000000000080159d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	41 57                	push   %r15
+  8015a3:	41 56                	push   %r14
+  8015a5:	41 55                	push   %r13
+  8015a7:	41 54                	push   %r12
+  8015a9:	53                   	push   %rbx
+  8015aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ae:	49 89 ff             	mov    %rdi,%r15
+  8015b1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8015b6:	49 bd bc 30 80 00 00 	movabs $0x8030bc,%r13
+  8015bd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8015c0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015c6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015c9:	48 89 df             	mov    %rbx,%rdi
+  8015cc:	41 ff d5             	call   *%r13
+  8015cf:	83 e0 04             	and    $0x4,%eax
+  8015d2:	74 17                	je     8015eb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015d4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015db:	4c 39 f3             	cmp    %r14,%rbx
+  8015de:	75 e6                	jne    8015c6 <fd_alloc+0x29>
+  8015e0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015e6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015eb:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015ee:	48 83 c4 08          	add    $0x8,%rsp
+  8015f2:	5b                   	pop    %rbx
+  8015f3:	41 5c                	pop    %r12
+  8015f5:	41 5d                	pop    %r13
+  8015f7:	41 5e                	pop    %r14
+  8015f9:	41 5f                	pop    %r15
+  8015fb:	5d                   	pop    %rbp
+  8015fc:	c3                   	ret
+
+00000000008015fd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015fd:	83 ff 1f             	cmp    $0x1f,%edi
+  801600:	77 39                	ja     80163b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801602:	55                   	push   %rbp
+  801603:	48 89 e5             	mov    %rsp,%rbp
+  801606:	41 54                	push   %r12
+  801608:	53                   	push   %rbx
+  801609:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80160c:	48 63 df             	movslq %edi,%rbx
+  80160f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801616:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80161a:	48 89 df             	mov    %rbx,%rdi
+  80161d:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  801624:	00 00 00 
+  801627:	ff d0                	call   *%rax
+  801629:	a8 04                	test   $0x4,%al
+  80162b:	74 14                	je     801641 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80162d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801631:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801636:	5b                   	pop    %rbx
+  801637:	41 5c                	pop    %r12
+  801639:	5d                   	pop    %rbp
+  80163a:	c3                   	ret
+        return -E_INVAL;
+  80163b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801640:	c3                   	ret
+        return -E_INVAL;
+  801641:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801646:	eb ee                	jmp    801636 <fd_lookup+0x39>
+
+0000000000801648 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	41 54                	push   %r12
+  80164e:	53                   	push   %rbx
+  80164f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801652:	48 b8 00 3d 80 00 00 	movabs $0x803d00,%rax
+  801659:	00 00 00 
+  80165c:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801663:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801666:	39 3b                	cmp    %edi,(%rbx)
+  801668:	74 47                	je     8016b1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80166a:	48 83 c0 08          	add    $0x8,%rax
+  80166e:	48 8b 18             	mov    (%rax),%rbx
+  801671:	48 85 db             	test   %rbx,%rbx
+  801674:	75 f0                	jne    801666 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801676:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80167d:	00 00 00 
+  801680:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801686:	89 fa                	mov    %edi,%edx
+  801688:	48 bf 58 3c 80 00 00 	movabs $0x803c58,%rdi
+  80168f:	00 00 00 
+  801692:	b8 00 00 00 00       	mov    $0x0,%eax
+  801697:	48 b9 ee 01 80 00 00 	movabs $0x8001ee,%rcx
+  80169e:	00 00 00 
+  8016a1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8016a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8016a8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8016ac:	5b                   	pop    %rbx
+  8016ad:	41 5c                	pop    %r12
+  8016af:	5d                   	pop    %rbp
+  8016b0:	c3                   	ret
+            return 0;
+  8016b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b6:	eb f0                	jmp    8016a8 <dev_lookup+0x60>
+
+00000000008016b8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8016b8:	55                   	push   %rbp
+  8016b9:	48 89 e5             	mov    %rsp,%rbp
+  8016bc:	41 55                	push   %r13
+  8016be:	41 54                	push   %r12
+  8016c0:	53                   	push   %rbx
+  8016c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c5:	48 89 fb             	mov    %rdi,%rbx
+  8016c8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016cb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016d2:	ff ff ff 
+  8016d5:	48 01 df             	add    %rbx,%rdi
+  8016d8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016e0:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  8016e7:	00 00 00 
+  8016ea:	ff d0                	call   *%rax
+  8016ec:	41 89 c5             	mov    %eax,%r13d
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	78 06                	js     8016f9 <fd_close+0x41>
+  8016f3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016f7:	74 1a                	je     801713 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016f9:	45 84 e4             	test   %r12b,%r12b
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801705:	44 89 e8             	mov    %r13d,%eax
+  801708:	48 83 c4 18          	add    $0x18,%rsp
+  80170c:	5b                   	pop    %rbx
+  80170d:	41 5c                	pop    %r12
+  80170f:	41 5d                	pop    %r13
+  801711:	5d                   	pop    %rbp
+  801712:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801713:	8b 3b                	mov    (%rbx),%edi
+  801715:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801719:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801720:	00 00 00 
+  801723:	ff d0                	call   *%rax
+  801725:	41 89 c5             	mov    %eax,%r13d
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	78 1b                	js     801747 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80172c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801730:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801734:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80173a:	48 85 c0             	test   %rax,%rax
+  80173d:	74 08                	je     801747 <fd_close+0x8f>
+  80173f:	48 89 df             	mov    %rbx,%rdi
+  801742:	ff d0                	call   *%rax
+  801744:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801747:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80174c:	48 89 de             	mov    %rbx,%rsi
+  80174f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801754:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  80175b:	00 00 00 
+  80175e:	ff d0                	call   *%rax
+    return res;
+  801760:	eb a3                	jmp    801705 <fd_close+0x4d>
+
+0000000000801762 <close>:
+
+int
+close(int fdnum) {
+  801762:	55                   	push   %rbp
+  801763:	48 89 e5             	mov    %rsp,%rbp
+  801766:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80176a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80176e:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801775:	00 00 00 
+  801778:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 15                	js     801793 <close+0x31>
+
+    return fd_close(fd, 1);
+  80177e:	be 01 00 00 00       	mov    $0x1,%esi
+  801783:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801787:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+}
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+0000000000801795 <close_all>:
+
+void
+close_all(void) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	41 54                	push   %r12
+  80179b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80179c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a1:	49 bc 62 17 80 00 00 	movabs $0x801762,%r12
+  8017a8:	00 00 00 
+  8017ab:	89 df                	mov    %ebx,%edi
+  8017ad:	41 ff d4             	call   *%r12
+  8017b0:	83 c3 01             	add    $0x1,%ebx
+  8017b3:	83 fb 20             	cmp    $0x20,%ebx
+  8017b6:	75 f3                	jne    8017ab <close_all+0x16>
+}
+  8017b8:	5b                   	pop    %rbx
+  8017b9:	41 5c                	pop    %r12
+  8017bb:	5d                   	pop    %rbp
+  8017bc:	c3                   	ret
+
+00000000008017bd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8017bd:	55                   	push   %rbp
+  8017be:	48 89 e5             	mov    %rsp,%rbp
+  8017c1:	41 57                	push   %r15
+  8017c3:	41 56                	push   %r14
+  8017c5:	41 55                	push   %r13
+  8017c7:	41 54                	push   %r12
+  8017c9:	53                   	push   %rbx
+  8017ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8017ce:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017d1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017d5:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  8017dc:	00 00 00 
+  8017df:	ff d0                	call   *%rax
+  8017e1:	89 c3                	mov    %eax,%ebx
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	0f 88 b8 00 00 00    	js     8018a3 <dup+0xe6>
+    close(newfdnum);
+  8017eb:	44 89 e7             	mov    %r12d,%edi
+  8017ee:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017fa:	4d 63 ec             	movslq %r12d,%r13
+  8017fd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801804:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801808:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80180c:	4c 89 ff             	mov    %r15,%rdi
+  80180f:	49 be 81 15 80 00 00 	movabs $0x801581,%r14
+  801816:	00 00 00 
+  801819:	41 ff d6             	call   *%r14
+  80181c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80181f:	4c 89 ef             	mov    %r13,%rdi
+  801822:	41 ff d6             	call   *%r14
+  801825:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801828:	48 89 df             	mov    %rbx,%rdi
+  80182b:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  801832:	00 00 00 
+  801835:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801837:	a8 04                	test   $0x4,%al
+  801839:	74 2b                	je     801866 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80183b:	41 89 c1             	mov    %eax,%r9d
+  80183e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801844:	4c 89 f1             	mov    %r14,%rcx
+  801847:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184c:	48 89 de             	mov    %rbx,%rsi
+  80184f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801854:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80185b:	00 00 00 
+  80185e:	ff d0                	call   *%rax
+  801860:	89 c3                	mov    %eax,%ebx
+  801862:	85 c0                	test   %eax,%eax
+  801864:	78 4e                	js     8018b4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801866:	4c 89 ff             	mov    %r15,%rdi
+  801869:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+  801875:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801878:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80187e:	4c 89 e9             	mov    %r13,%rcx
+  801881:	ba 00 00 00 00       	mov    $0x0,%edx
+  801886:	4c 89 fe             	mov    %r15,%rsi
+  801889:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188e:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  801895:	00 00 00 
+  801898:	ff d0                	call   *%rax
+  80189a:	89 c3                	mov    %eax,%ebx
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	78 14                	js     8018b4 <dup+0xf7>
+
+    return newfdnum;
+  8018a0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8018a3:	89 d8                	mov    %ebx,%eax
+  8018a5:	48 83 c4 18          	add    $0x18,%rsp
+  8018a9:	5b                   	pop    %rbx
+  8018aa:	41 5c                	pop    %r12
+  8018ac:	41 5d                	pop    %r13
+  8018ae:	41 5e                	pop    %r14
+  8018b0:	41 5f                	pop    %r15
+  8018b2:	5d                   	pop    %rbp
+  8018b3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8018b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b9:	4c 89 ee             	mov    %r13,%rsi
+  8018bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c1:	49 bc 6b 12 80 00 00 	movabs $0x80126b,%r12
+  8018c8:	00 00 00 
+  8018cb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d3:	4c 89 f6             	mov    %r14,%rsi
+  8018d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018db:	41 ff d4             	call   *%r12
+    return res;
+  8018de:	eb c3                	jmp    8018a3 <dup+0xe6>
+
+00000000008018e0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018e0:	55                   	push   %rbp
+  8018e1:	48 89 e5             	mov    %rsp,%rbp
+  8018e4:	41 56                	push   %r14
+  8018e6:	41 55                	push   %r13
+  8018e8:	41 54                	push   %r12
+  8018ea:	53                   	push   %rbx
+  8018eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ef:	89 fb                	mov    %edi,%ebx
+  8018f1:	49 89 f4             	mov    %rsi,%r12
+  8018f4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018fb:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+  801907:	85 c0                	test   %eax,%eax
+  801909:	78 4c                	js     801957 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80190b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80190f:	41 8b 3e             	mov    (%r14),%edi
+  801912:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801916:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  80191d:	00 00 00 
+  801920:	ff d0                	call   *%rax
+  801922:	85 c0                	test   %eax,%eax
+  801924:	78 35                	js     80195b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801926:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80192a:	83 e0 03             	and    $0x3,%eax
+  80192d:	83 f8 01             	cmp    $0x1,%eax
+  801930:	74 2d                	je     80195f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801932:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801936:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80193a:	48 85 c0             	test   %rax,%rax
+  80193d:	74 56                	je     801995 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80193f:	4c 89 ea             	mov    %r13,%rdx
+  801942:	4c 89 e6             	mov    %r12,%rsi
+  801945:	4c 89 f7             	mov    %r14,%rdi
+  801948:	ff d0                	call   *%rax
+}
+  80194a:	48 83 c4 10          	add    $0x10,%rsp
+  80194e:	5b                   	pop    %rbx
+  80194f:	41 5c                	pop    %r12
+  801951:	41 5d                	pop    %r13
+  801953:	41 5e                	pop    %r14
+  801955:	5d                   	pop    %rbp
+  801956:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801957:	48 98                	cltq
+  801959:	eb ef                	jmp    80194a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80195b:	48 98                	cltq
+  80195d:	eb eb                	jmp    80194a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80195f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801966:	00 00 00 
+  801969:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80196f:	89 da                	mov    %ebx,%edx
+  801971:	48 bf b9 3c 80 00 00 	movabs $0x803cb9,%rdi
+  801978:	00 00 00 
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801980:	48 b9 ee 01 80 00 00 	movabs $0x8001ee,%rcx
+  801987:	00 00 00 
+  80198a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80198c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801993:	eb b5                	jmp    80194a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801995:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80199c:	eb ac                	jmp    80194a <read+0x6a>
+
+000000000080199e <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	41 56                	push   %r14
+  8019a4:	41 55                	push   %r13
+  8019a6:	41 54                	push   %r12
+  8019a8:	53                   	push   %rbx
+  8019a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ad:	89 fb                	mov    %edi,%ebx
+  8019af:	49 89 f4             	mov    %rsi,%r12
+  8019b2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019b5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019b9:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  8019c0:	00 00 00 
+  8019c3:	ff d0                	call   *%rax
+  8019c5:	85 c0                	test   %eax,%eax
+  8019c7:	78 41                	js     801a0a <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019c9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019cd:	41 8b 3e             	mov    (%r14),%edi
+  8019d0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019d4:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 35                	js     801a19 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019e4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019e8:	83 e0 03             	and    $0x3,%eax
+  8019eb:	83 f8 01             	cmp    $0x1,%eax
+  8019ee:	74 2d                	je     801a1d <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019f8:	48 85 c0             	test   %rax,%rax
+  8019fb:	74 56                	je     801a53 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019fd:	4c 89 ea             	mov    %r13,%rdx
+  801a00:	4c 89 e6             	mov    %r12,%rsi
+  801a03:	4c 89 f7             	mov    %r14,%rdi
+  801a06:	ff d0                	call   *%rax
+  801a08:	eb 02                	jmp    801a0c <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a0a:	48 98                	cltq
+}
+  801a0c:	48 83 c4 10          	add    $0x10,%rsp
+  801a10:	5b                   	pop    %rbx
+  801a11:	41 5c                	pop    %r12
+  801a13:	41 5d                	pop    %r13
+  801a15:	41 5e                	pop    %r14
+  801a17:	5d                   	pop    %rbp
+  801a18:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a19:	48 98                	cltq
+  801a1b:	eb ef                	jmp    801a0c <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a1d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a24:	00 00 00 
+  801a27:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a2d:	89 da                	mov    %ebx,%edx
+  801a2f:	48 bf 78 3c 80 00 00 	movabs $0x803c78,%rdi
+  801a36:	00 00 00 
+  801a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3e:	48 b9 ee 01 80 00 00 	movabs $0x8001ee,%rcx
+  801a45:	00 00 00 
+  801a48:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a4a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a51:	eb b9                	jmp    801a0c <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a53:	4c 89 ea             	mov    %r13,%rdx
+  801a56:	4c 89 e6             	mov    %r12,%rsi
+  801a59:	89 df                	mov    %ebx,%edi
+  801a5b:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  801a67:	eb a3                	jmp    801a0c <readmap+0x6e>
+
+0000000000801a69 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a69:	55                   	push   %rbp
+  801a6a:	48 89 e5             	mov    %rsp,%rbp
+  801a6d:	41 57                	push   %r15
+  801a6f:	41 56                	push   %r14
+  801a71:	41 55                	push   %r13
+  801a73:	41 54                	push   %r12
+  801a75:	53                   	push   %rbx
+  801a76:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a7a:	48 85 d2             	test   %rdx,%rdx
+  801a7d:	74 54                	je     801ad3 <readn+0x6a>
+  801a7f:	41 89 fd             	mov    %edi,%r13d
+  801a82:	49 89 f6             	mov    %rsi,%r14
+  801a85:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a88:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a8d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a92:	49 bf e0 18 80 00 00 	movabs $0x8018e0,%r15
+  801a99:	00 00 00 
+  801a9c:	4c 89 e2             	mov    %r12,%rdx
+  801a9f:	48 29 f2             	sub    %rsi,%rdx
+  801aa2:	4c 01 f6             	add    %r14,%rsi
+  801aa5:	44 89 ef             	mov    %r13d,%edi
+  801aa8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	78 20                	js     801acf <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801aaf:	01 c3                	add    %eax,%ebx
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	74 08                	je     801abd <readn+0x54>
+  801ab5:	48 63 f3             	movslq %ebx,%rsi
+  801ab8:	4c 39 e6             	cmp    %r12,%rsi
+  801abb:	72 df                	jb     801a9c <readn+0x33>
+    }
+    return res;
+  801abd:	48 63 c3             	movslq %ebx,%rax
+}
+  801ac0:	48 83 c4 08          	add    $0x8,%rsp
+  801ac4:	5b                   	pop    %rbx
+  801ac5:	41 5c                	pop    %r12
+  801ac7:	41 5d                	pop    %r13
+  801ac9:	41 5e                	pop    %r14
+  801acb:	41 5f                	pop    %r15
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+        if (inc < 0) return inc;
+  801acf:	48 98                	cltq
+  801ad1:	eb ed                	jmp    801ac0 <readn+0x57>
+    int inc = 1, res = 0;
+  801ad3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad8:	eb e3                	jmp    801abd <readn+0x54>
+
+0000000000801ada <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ada:	55                   	push   %rbp
+  801adb:	48 89 e5             	mov    %rsp,%rbp
+  801ade:	41 56                	push   %r14
+  801ae0:	41 55                	push   %r13
+  801ae2:	41 54                	push   %r12
+  801ae4:	53                   	push   %rbx
+  801ae5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ae9:	89 fb                	mov    %edi,%ebx
+  801aeb:	49 89 f4             	mov    %rsi,%r12
+  801aee:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801af5:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 47                	js     801b4c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b05:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b09:	41 8b 3e             	mov    (%r14),%edi
+  801b0c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b10:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801b17:	00 00 00 
+  801b1a:	ff d0                	call   *%rax
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	78 30                	js     801b50 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b20:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b25:	74 2d                	je     801b54 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b2b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b2f:	48 85 c0             	test   %rax,%rax
+  801b32:	74 56                	je     801b8a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b34:	4c 89 ea             	mov    %r13,%rdx
+  801b37:	4c 89 e6             	mov    %r12,%rsi
+  801b3a:	4c 89 f7             	mov    %r14,%rdi
+  801b3d:	ff d0                	call   *%rax
+}
+  801b3f:	48 83 c4 10          	add    $0x10,%rsp
+  801b43:	5b                   	pop    %rbx
+  801b44:	41 5c                	pop    %r12
+  801b46:	41 5d                	pop    %r13
+  801b48:	41 5e                	pop    %r14
+  801b4a:	5d                   	pop    %rbp
+  801b4b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b4c:	48 98                	cltq
+  801b4e:	eb ef                	jmp    801b3f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b50:	48 98                	cltq
+  801b52:	eb eb                	jmp    801b3f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b54:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b5b:	00 00 00 
+  801b5e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b64:	89 da                	mov    %ebx,%edx
+  801b66:	48 bf d5 3c 80 00 00 	movabs $0x803cd5,%rdi
+  801b6d:	00 00 00 
+  801b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b75:	48 b9 ee 01 80 00 00 	movabs $0x8001ee,%rcx
+  801b7c:	00 00 00 
+  801b7f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b81:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b88:	eb b5                	jmp    801b3f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b8a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b91:	eb ac                	jmp    801b3f <write+0x65>
+
+0000000000801b93 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	53                   	push   %rbx
+  801b98:	48 83 ec 18          	sub    $0x18,%rsp
+  801b9c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ba2:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801ba9:	00 00 00 
+  801bac:	ff d0                	call   *%rax
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 0c                	js     801bbe <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bb6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	41 55                	push   %r13
+  801bca:	41 54                	push   %r12
+  801bcc:	53                   	push   %rbx
+  801bcd:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd1:	89 fb                	mov    %edi,%ebx
+  801bd3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bda:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 38                	js     801c22 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bea:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bee:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bf2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf6:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 1c                	js     801c22 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c06:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c0b:	74 20                	je     801c2d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c11:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c15:	48 85 c0             	test   %rax,%rax
+  801c18:	74 47                	je     801c61 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c1a:	44 89 e6             	mov    %r12d,%esi
+  801c1d:	4c 89 ef             	mov    %r13,%rdi
+  801c20:	ff d0                	call   *%rax
+}
+  801c22:	48 83 c4 18          	add    $0x18,%rsp
+  801c26:	5b                   	pop    %rbx
+  801c27:	41 5c                	pop    %r12
+  801c29:	41 5d                	pop    %r13
+  801c2b:	5d                   	pop    %rbp
+  801c2c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c2d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c34:	00 00 00 
+  801c37:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c3d:	89 da                	mov    %ebx,%edx
+  801c3f:	48 bf 98 3c 80 00 00 	movabs $0x803c98,%rdi
+  801c46:	00 00 00 
+  801c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4e:	48 b9 ee 01 80 00 00 	movabs $0x8001ee,%rcx
+  801c55:	00 00 00 
+  801c58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5f:	eb c1                	jmp    801c22 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c61:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c66:	eb ba                	jmp    801c22 <ftruncate+0x5e>
+
+0000000000801c68 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c68:	55                   	push   %rbp
+  801c69:	48 89 e5             	mov    %rsp,%rbp
+  801c6c:	41 54                	push   %r12
+  801c6e:	53                   	push   %rbx
+  801c6f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c73:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c76:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c7a:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 4e                	js     801cd8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c8e:	41 8b 3c 24          	mov    (%r12),%edi
+  801c92:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c96:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801c9d:	00 00 00 
+  801ca0:	ff d0                	call   *%rax
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	78 32                	js     801cd8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ca6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801caa:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801caf:	74 30                	je     801ce1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cb1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cb4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cbb:	00 00 00 
+    stat->st_isdir = 0;
+  801cbe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cc5:	00 00 00 
+    stat->st_dev = dev;
+  801cc8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ccf:	48 89 de             	mov    %rbx,%rsi
+  801cd2:	4c 89 e7             	mov    %r12,%rdi
+  801cd5:	ff 50 30             	call   *0x30(%rax)
+}
+  801cd8:	48 83 c4 10          	add    $0x10,%rsp
+  801cdc:	5b                   	pop    %rbx
+  801cdd:	41 5c                	pop    %r12
+  801cdf:	5d                   	pop    %rbp
+  801ce0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ce1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ce6:	eb f0                	jmp    801cd8 <fstat+0x70>
+
+0000000000801ce8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ce8:	55                   	push   %rbp
+  801ce9:	48 89 e5             	mov    %rsp,%rbp
+  801cec:	41 54                	push   %r12
+  801cee:	53                   	push   %rbx
+  801cef:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cf2:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf7:	48 b8 3f 2a 80 00 00 	movabs $0x802a3f,%rax
+  801cfe:	00 00 00 
+  801d01:	ff d0                	call   *%rax
+  801d03:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 25                	js     801d2e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d09:	4c 89 e6             	mov    %r12,%rsi
+  801d0c:	89 c7                	mov    %eax,%edi
+  801d0e:	48 b8 68 1c 80 00 00 	movabs $0x801c68,%rax
+  801d15:	00 00 00 
+  801d18:	ff d0                	call   *%rax
+  801d1a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d1d:	89 df                	mov    %ebx,%edi
+  801d1f:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+
+    return res;
+  801d2b:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d2e:	89 d8                	mov    %ebx,%eax
+  801d30:	5b                   	pop    %rbx
+  801d31:	41 5c                	pop    %r12
+  801d33:	5d                   	pop    %rbp
+  801d34:	c3                   	ret
+
+0000000000801d35 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d35:	55                   	push   %rbp
+  801d36:	48 89 e5             	mov    %rsp,%rbp
+  801d39:	41 54                	push   %r12
+  801d3b:	53                   	push   %rbx
+  801d3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d40:	48 89 fb             	mov    %rdi,%rbx
+  801d43:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d46:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d4a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d4f:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801d56:	00 00 00 
+  801d59:	ff d0                	call   *%rax
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	78 1f                	js     801d7e <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d63:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d67:	48 85 c0             	test   %rax,%rax
+  801d6a:	74 1b                	je     801d87 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d6c:	4c 89 e6             	mov    %r12,%rsi
+  801d6f:	48 89 df             	mov    %rbx,%rdi
+  801d72:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d7e:	48 83 c4 10          	add    $0x10,%rsp
+  801d82:	5b                   	pop    %rbx
+  801d83:	41 5c                	pop    %r12
+  801d85:	5d                   	pop    %rbp
+  801d86:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d87:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d8c:	eb f0                	jmp    801d7e <create_snapshot+0x49>
+
+0000000000801d8e <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d96:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d9a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d9f:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 1e                	js     801dcd <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801daf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801db3:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801db7:	48 85 d2             	test   %rdx,%rdx
+  801dba:	74 13                	je     801dcf <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dca:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dcf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dd4:	eb f7                	jmp    801dcd <print_snapshot_list+0x3f>
+
+0000000000801dd6 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801dd6:	55                   	push   %rbp
+  801dd7:	48 89 e5             	mov    %rsp,%rbp
+  801dda:	53                   	push   %rbx
+  801ddb:	48 83 ec 18          	sub    $0x18,%rsp
+  801ddf:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801de2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801de6:	bf 66 00 00 00       	mov    $0x66,%edi
+  801deb:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 1c                	js     801e17 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801dfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dff:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801e03:	48 85 c0             	test   %rax,%rax
+  801e06:	74 15                	je     801e1d <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801e08:	48 89 df             	mov    %rbx,%rdi
+  801e0b:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e14:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e1b:	c9                   	leave
+  801e1c:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e1d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e22:	eb f3                	jmp    801e17 <accept_snapshot+0x41>
+
+0000000000801e24 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e24:	55                   	push   %rbp
+  801e25:	48 89 e5             	mov    %rsp,%rbp
+  801e28:	53                   	push   %rbx
+  801e29:	48 83 ec 18          	sub    $0x18,%rsp
+  801e2d:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e30:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e34:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e39:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801e40:	00 00 00 
+  801e43:	ff d0                	call   *%rax
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 1c                	js     801e65 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e4d:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e51:	48 85 c0             	test   %rax,%rax
+  801e54:	74 15                	je     801e6b <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e56:	48 89 df             	mov    %rbx,%rdi
+  801e59:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e62:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e6b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e70:	eb f3                	jmp    801e65 <delete_snapshot+0x41>
+
+0000000000801e72 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e7e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e83:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801e8a:	00 00 00 
+  801e8d:	ff d0                	call   *%rax
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 14                	js     801ea7 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e97:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e9b:	48 85 d2             	test   %rdx,%rdx
+  801e9e:	74 09                	je     801ea9 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea5:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ea9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eae:	eb f7                	jmp    801ea7 <gc_snapshots+0x35>
+
+0000000000801eb0 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801eb0:	55                   	push   %rbp
+  801eb1:	48 89 e5             	mov    %rsp,%rbp
+  801eb4:	41 56                	push   %r14
+  801eb6:	41 55                	push   %r13
+  801eb8:	41 54                	push   %r12
+  801eba:	53                   	push   %rbx
+  801ebb:	48 83 ec 10          	sub    $0x10,%rsp
+  801ebf:	48 89 fb             	mov    %rdi,%rbx
+  801ec2:	49 89 f4             	mov    %rsi,%r12
+  801ec5:	49 89 d5             	mov    %rdx,%r13
+  801ec8:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ecb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ecf:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ed4:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	78 1b                	js     801eff <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ee4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee8:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801eec:	48 85 c0             	test   %rax,%rax
+  801eef:	74 1b                	je     801f0c <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ef1:	4c 89 f1             	mov    %r14,%rcx
+  801ef4:	4c 89 ea             	mov    %r13,%rdx
+  801ef7:	4c 89 e6             	mov    %r12,%rsi
+  801efa:	48 89 df             	mov    %rbx,%rdi
+  801efd:	ff d0                	call   *%rax
+
+    return res;
+}
+  801eff:	48 83 c4 10          	add    $0x10,%rsp
+  801f03:	5b                   	pop    %rbx
+  801f04:	41 5c                	pop    %r12
+  801f06:	41 5d                	pop    %r13
+  801f08:	41 5e                	pop    %r14
+  801f0a:	5d                   	pop    %rbp
+  801f0b:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f0c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f11:	eb ec                	jmp    801eff <diff_snapshots+0x4f>
+
+0000000000801f13 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f13:	55                   	push   %rbp
+  801f14:	48 89 e5             	mov    %rsp,%rbp
+  801f17:	41 55                	push   %r13
+  801f19:	41 54                	push   %r12
+  801f1b:	53                   	push   %rbx
+  801f1c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f20:	48 89 fb             	mov    %rdi,%rbx
+  801f23:	49 89 f4             	mov    %rsi,%r12
+  801f26:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f2d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f32:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801f39:	00 00 00 
+  801f3c:	ff d0                	call   *%rax
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 18                	js     801f5a <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f46:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f4a:	48 85 c0             	test   %rax,%rax
+  801f4d:	74 16                	je     801f65 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f4f:	4c 89 ea             	mov    %r13,%rdx
+  801f52:	4c 89 e6             	mov    %r12,%rsi
+  801f55:	48 89 df             	mov    %rbx,%rdi
+  801f58:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f5a:	48 83 c4 18          	add    $0x18,%rsp
+  801f5e:	5b                   	pop    %rbx
+  801f5f:	41 5c                	pop    %r12
+  801f61:	41 5d                	pop    %r13
+  801f63:	5d                   	pop    %rbp
+  801f64:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f6a:	eb ee                	jmp    801f5a <send_snapshot+0x47>
+
+0000000000801f6c <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f6c:	55                   	push   %rbp
+  801f6d:	48 89 e5             	mov    %rsp,%rbp
+  801f70:	53                   	push   %rbx
+  801f71:	48 83 ec 18          	sub    $0x18,%rsp
+  801f75:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f78:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7c:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f81:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 12                	js     801fa3 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f95:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f99:	48 85 c0             	test   %rax,%rax
+  801f9c:	74 0b                	je     801fa9 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f9e:	48 89 df             	mov    %rbx,%rdi
+  801fa1:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fa3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fa9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fae:	eb f3                	jmp    801fa3 <receive_snapshot+0x37>
+
+0000000000801fb0 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fb8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fbc:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc1:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	78 17                	js     801fe8 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd5:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fdc:	48 85 d2             	test   %rdx,%rdx
+  801fdf:	74 09                	je     801fea <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe6:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fef:	eb f7                	jmp    801fe8 <free_space_bytes+0x38>
+
+0000000000801ff1 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ff9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ffd:	bf 66 00 00 00       	mov    $0x66,%edi
+  802002:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	78 17                	js     802029 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802012:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802016:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80201d:	48 85 d2             	test   %rdx,%rdx
+  802020:	74 09                	je     80202b <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802022:	b8 00 00 00 00       	mov    $0x0,%eax
+  802027:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802029:	c9                   	leave
+  80202a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80202b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802030:	eb f7                	jmp    802029 <busy_space_bytes+0x38>
+
+0000000000802032 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  802036:	41 54                	push   %r12
+  802038:	53                   	push   %rbx
+  802039:	48 83 ec 10          	sub    $0x10,%rsp
+  80203d:	89 fb                	mov    %edi,%ebx
+  80203f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802042:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802046:	bf 66 00 00 00       	mov    $0x66,%edi
+  80204b:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 17                	js     802072 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80205b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80205f:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802066:	48 85 c0             	test   %rax,%rax
+  802069:	74 10                	je     80207b <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80206b:	4c 89 e6             	mov    %r12,%rsi
+  80206e:	89 df                	mov    %ebx,%edi
+  802070:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802072:	48 83 c4 10          	add    $0x10,%rsp
+  802076:	5b                   	pop    %rbx
+  802077:	41 5c                	pop    %r12
+  802079:	5d                   	pop    %rbp
+  80207a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80207b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802080:	eb f0                	jmp    802072 <snapshots_space+0x40>
+
+0000000000802082 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802082:	55                   	push   %rbp
+  802083:	48 89 e5             	mov    %rsp,%rbp
+  802086:	41 55                	push   %r13
+  802088:	41 54                	push   %r12
+  80208a:	53                   	push   %rbx
+  80208b:	48 83 ec 08          	sub    $0x8,%rsp
+  80208f:	41 89 fd             	mov    %edi,%r13d
+  802092:	48 89 f3             	mov    %rsi,%rbx
+  802095:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802098:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80209f:	00 00 00 
+  8020a2:	83 38 00             	cmpl   $0x0,(%rax)
+  8020a5:	74 57                	je     8020fe <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020b2:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020b9:	00 00 00 
+  8020bc:	44 89 ee             	mov    %r13d,%esi
+  8020bf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020c6:	00 00 00 
+  8020c9:	8b 38                	mov    (%rax),%edi
+  8020cb:	48 b8 a2 35 80 00 00 	movabs $0x8035a2,%rax
+  8020d2:	00 00 00 
+  8020d5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020dc:	4c 89 e2             	mov    %r12,%rdx
+  8020df:	48 89 de             	mov    %rbx,%rsi
+  8020e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e7:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+}
+  8020f3:	48 83 c4 08          	add    $0x8,%rsp
+  8020f7:	5b                   	pop    %rbx
+  8020f8:	41 5c                	pop    %r12
+  8020fa:	41 5d                	pop    %r13
+  8020fc:	5d                   	pop    %rbp
+  8020fd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802103:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  80210a:	00 00 00 
+  80210d:	ff d0                	call   *%rax
+  80210f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802116:	00 00 
+  802118:	eb 8d                	jmp    8020a7 <fsipc_region+0x25>
+
+000000000080211a <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802122:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802129:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80212a:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80212e:	48 b8 82 20 80 00 00 	movabs $0x802082,%rax
+  802135:	00 00 00 
+  802138:	ff d0                	call   *%rax
+}
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+000000000080213c <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80213c:	85 ff                	test   %edi,%edi
+  80213e:	78 6d                	js     8021ad <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802140:	55                   	push   %rbp
+  802141:	48 89 e5             	mov    %rsp,%rbp
+  802144:	41 54                	push   %r12
+  802146:	53                   	push   %rbx
+  802147:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80214a:	48 85 f6             	test   %rsi,%rsi
+  80214d:	74 57                	je     8021a6 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80214f:	89 f8                	mov    %edi,%eax
+  802151:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802158:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80215a:	be 00 00 00 00       	mov    $0x0,%esi
+  80215f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802164:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  80216b:	00 00 00 
+  80216e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 2d                	js     8021a1 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802174:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80217b:	00 00 00 
+  80217e:	49 63 14 24          	movslq (%r12),%rdx
+  802182:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802189:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80218e:	48 89 df             	mov    %rbx,%rdi
+  802191:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80219d:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8021a1:	5b                   	pop    %rbx
+  8021a2:	41 5c                	pop    %r12
+  8021a4:	5d                   	pop    %rbp
+  8021a5:	c3                   	ret
+        return -E_INVAL;
+  8021a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ab:	eb f4                	jmp    8021a1 <devfile_df_snapshots+0x65>
+  8021ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021b2:	c3                   	ret
+
+00000000008021b3 <devfile_df_busy>:
+devfile_df_busy() {
+  8021b3:	55                   	push   %rbp
+  8021b4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8021b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bc:	bf 11 00 00 00       	mov    $0x11,%edi
+  8021c1:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+}
+  8021cd:	5d                   	pop    %rbp
+  8021ce:	c3                   	ret
+
+00000000008021cf <devfile_df_free>:
+devfile_df_free() {
+  8021cf:	55                   	push   %rbp
+  8021d0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d8:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021dd:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+}
+  8021e9:	5d                   	pop    %rbp
+  8021ea:	c3                   	ret
+
+00000000008021eb <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021f9:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+}
+  802205:	5d                   	pop    %rbp
+  802206:	c3                   	ret
+
+0000000000802207 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802207:	55                   	push   %rbp
+  802208:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80220b:	be 00 00 00 00       	mov    $0x0,%esi
+  802210:	bf 09 00 00 00       	mov    $0x9,%edi
+  802215:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802221:	85 c0                	test   %eax,%eax
+  802223:	ba 00 00 00 00       	mov    $0x0,%edx
+  802228:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80222b:	5d                   	pop    %rbp
+  80222c:	c3                   	ret
+
+000000000080222d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80222d:	55                   	push   %rbp
+  80222e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802231:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802238:	00 00 00 
+  80223b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80223e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802240:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802243:	be 00 00 00 00       	mov    $0x0,%esi
+  802248:	bf 02 00 00 00       	mov    $0x2,%edi
+  80224d:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+}
+  802259:	5d                   	pop    %rbp
+  80225a:	c3                   	ret
+
+000000000080225b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80225f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802262:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802269:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80226b:	be 00 00 00 00       	mov    $0x0,%esi
+  802270:	bf 06 00 00 00       	mov    $0x6,%edi
+  802275:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+}
+  802281:	5d                   	pop    %rbp
+  802282:	c3                   	ret
+
+0000000000802283 <devfile_write>:
+    if (!fd || !buf) {
+  802283:	48 85 ff             	test   %rdi,%rdi
+  802286:	0f 84 c1 00 00 00    	je     80234d <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80228c:	55                   	push   %rbp
+  80228d:	48 89 e5             	mov    %rsp,%rbp
+  802290:	41 57                	push   %r15
+  802292:	41 56                	push   %r14
+  802294:	41 55                	push   %r13
+  802296:	41 54                	push   %r12
+  802298:	53                   	push   %rbx
+  802299:	48 83 ec 18          	sub    $0x18,%rsp
+  80229d:	49 89 ff             	mov    %rdi,%r15
+  8022a0:	49 89 f5             	mov    %rsi,%r13
+  8022a3:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8022a6:	48 85 f6             	test   %rsi,%rsi
+  8022a9:	0f 84 95 00 00 00    	je     802344 <devfile_write+0xc1>
+    while (n) {
+  8022af:	48 85 d2             	test   %rdx,%rdx
+  8022b2:	0f 84 83 00 00 00    	je     80233b <devfile_write+0xb8>
+    int totalWrite = 0;
+  8022b8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022bf:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022c6:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022c9:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022ce:	49 39 dc             	cmp    %rbx,%r12
+  8022d1:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022d5:	48 89 da             	mov    %rbx,%rdx
+  8022d8:	4c 89 ee             	mov    %r13,%rsi
+  8022db:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022e2:	00 00 00 
+  8022e5:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022f1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022f5:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022f8:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802301:	bf 04 00 00 00       	mov    $0x4,%edi
+  802306:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+        if (write < 0) {
+  802312:	85 c0                	test   %eax,%eax
+  802314:	78 21                	js     802337 <devfile_write+0xb4>
+        buf += write;
+  802316:	48 63 d0             	movslq %eax,%rdx
+  802319:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80231c:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80231f:	49 29 d4             	sub    %rdx,%r12
+  802322:	75 a5                	jne    8022c9 <devfile_write+0x46>
+    return totalWrite;
+  802324:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802328:	48 83 c4 18          	add    $0x18,%rsp
+  80232c:	5b                   	pop    %rbx
+  80232d:	41 5c                	pop    %r12
+  80232f:	41 5d                	pop    %r13
+  802331:	41 5e                	pop    %r14
+  802333:	41 5f                	pop    %r15
+  802335:	5d                   	pop    %rbp
+  802336:	c3                   	ret
+            return write;
+  802337:	48 98                	cltq
+  802339:	eb ed                	jmp    802328 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80233b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802342:	eb e0                	jmp    802324 <devfile_write+0xa1>
+        return -E_INVAL;
+  802344:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80234b:	eb db                	jmp    802328 <devfile_write+0xa5>
+  80234d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802354:	c3                   	ret
+
+0000000000802355 <devfile_read>:
+    if (!fd || !buf) {
+  802355:	48 85 ff             	test   %rdi,%rdi
+  802358:	0f 84 c0 00 00 00    	je     80241e <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80235e:	55                   	push   %rbp
+  80235f:	48 89 e5             	mov    %rsp,%rbp
+  802362:	41 57                	push   %r15
+  802364:	41 56                	push   %r14
+  802366:	41 55                	push   %r13
+  802368:	41 54                	push   %r12
+  80236a:	53                   	push   %rbx
+  80236b:	48 83 ec 18          	sub    $0x18,%rsp
+  80236f:	49 89 ff             	mov    %rdi,%r15
+  802372:	49 89 f5             	mov    %rsi,%r13
+  802375:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802378:	48 85 f6             	test   %rsi,%rsi
+  80237b:	0f 84 96 00 00 00    	je     802417 <devfile_read+0xc2>
+    while (n) {
+  802381:	48 85 d2             	test   %rdx,%rdx
+  802384:	0f 84 87 00 00 00    	je     802411 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80238a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802391:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802392:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802399:	00 00 00 
+  80239c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8023a0:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8023a3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023a8:	49 39 c4             	cmp    %rax,%r12
+  8023ab:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8023af:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8023b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023bd:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	7e 37                	jle    802404 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023cd:	48 63 d8             	movslq %eax,%rbx
+  8023d0:	48 89 da             	mov    %rbx,%rdx
+  8023d3:	4c 89 f6             	mov    %r14,%rsi
+  8023d6:	4c 89 ef             	mov    %r13,%rdi
+  8023d9:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+        buf += read;
+  8023e5:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023e8:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023ec:	49 29 dc             	sub    %rbx,%r12
+  8023ef:	75 ab                	jne    80239c <devfile_read+0x47>
+  return totalRead;
+  8023f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023f5:	48 83 c4 18          	add    $0x18,%rsp
+  8023f9:	5b                   	pop    %rbx
+  8023fa:	41 5c                	pop    %r12
+  8023fc:	41 5d                	pop    %r13
+  8023fe:	41 5e                	pop    %r14
+  802400:	41 5f                	pop    %r15
+  802402:	5d                   	pop    %rbp
+  802403:	c3                   	ret
+            return read ? read : totalRead;
+  802404:	48 63 d0             	movslq %eax,%rdx
+  802407:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80240b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80240f:	eb e4                	jmp    8023f5 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802411:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802415:	eb da                	jmp    8023f1 <devfile_read+0x9c>
+        return E_INVAL;
+  802417:	b8 03 00 00 00       	mov    $0x3,%eax
+  80241c:	eb d7                	jmp    8023f5 <devfile_read+0xa0>
+  80241e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802423:	c3                   	ret
+
+0000000000802424 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802424:	48 85 ff             	test   %rdi,%rdi
+  802427:	74 5f                	je     802488 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802429:	55                   	push   %rbp
+  80242a:	48 89 e5             	mov    %rsp,%rbp
+  80242d:	53                   	push   %rbx
+  80242e:	48 83 ec 08          	sub    $0x8,%rsp
+  802432:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802435:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802447:	77 45                	ja     80248e <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802449:	48 89 de             	mov    %rbx,%rsi
+  80244c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802453:	00 00 00 
+  802456:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802462:	be 00 00 00 00       	mov    $0x0,%esi
+  802467:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80246c:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802478:	85 c0                	test   %eax,%eax
+  80247a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802482:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802486:	c9                   	leave
+  802487:	c3                   	ret
+        return -E_INVAL;
+  802488:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80248d:	c3                   	ret
+        return -E_INVAL;
+  80248e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802493:	eb ed                	jmp    802482 <devfile_receive_snapshot+0x5e>
+
+0000000000802495 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802495:	55                   	push   %rbp
+  802496:	48 89 e5             	mov    %rsp,%rbp
+  802499:	41 55                	push   %r13
+  80249b:	41 54                	push   %r12
+  80249d:	53                   	push   %rbx
+  80249e:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a2:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8024a5:	48 85 f6             	test   %rsi,%rsi
+  8024a8:	0f 94 c0             	sete   %al
+  8024ab:	48 85 d2             	test   %rdx,%rdx
+  8024ae:	0f 94 c2             	sete   %dl
+  8024b1:	08 d0                	or     %dl,%al
+  8024b3:	0f 85 ad 00 00 00    	jne    802566 <devfile_send_snapshot+0xd1>
+  8024b9:	48 89 fb             	mov    %rdi,%rbx
+  8024bc:	49 89 f4             	mov    %rsi,%r12
+  8024bf:	48 85 ff             	test   %rdi,%rdi
+  8024c2:	0f 84 9e 00 00 00    	je     802566 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024c8:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024da:	0f 87 8d 00 00 00    	ja     80256d <devfile_send_snapshot+0xd8>
+  8024e0:	4c 89 e7             	mov    %r12,%rdi
+  8024e3:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+  8024ef:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024f5:	77 7d                	ja     802574 <devfile_send_snapshot+0xdf>
+  8024f7:	4c 89 ef             	mov    %r13,%rdi
+  8024fa:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+  802506:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80250c:	77 6d                	ja     80257b <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80250e:	48 89 de             	mov    %rbx,%rsi
+  802511:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802518:	00 00 00 
+  80251b:	48 bb 13 0b 80 00 00 	movabs $0x800b13,%rbx
+  802522:	00 00 00 
+  802525:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802527:	4c 89 e6             	mov    %r12,%rsi
+  80252a:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802531:	00 00 00 
+  802534:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802536:	4c 89 ee             	mov    %r13,%rsi
+  802539:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802540:	00 00 00 
+  802543:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802545:	be 00 00 00 00       	mov    $0x0,%esi
+  80254a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80254f:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+}
+  80255b:	48 83 c4 08          	add    $0x8,%rsp
+  80255f:	5b                   	pop    %rbx
+  802560:	41 5c                	pop    %r12
+  802562:	41 5d                	pop    %r13
+  802564:	5d                   	pop    %rbp
+  802565:	c3                   	ret
+        return -E_INVAL;
+  802566:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256b:	eb ee                	jmp    80255b <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80256d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802572:	eb e7                	jmp    80255b <devfile_send_snapshot+0xc6>
+  802574:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802579:	eb e0                	jmp    80255b <devfile_send_snapshot+0xc6>
+  80257b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802580:	eb d9                	jmp    80255b <devfile_send_snapshot+0xc6>
+
+0000000000802582 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802582:	48 85 ff             	test   %rdi,%rdi
+  802585:	0f 84 41 01 00 00    	je     8026cc <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80258b:	55                   	push   %rbp
+  80258c:	48 89 e5             	mov    %rsp,%rbp
+  80258f:	41 57                	push   %r15
+  802591:	41 56                	push   %r14
+  802593:	41 55                	push   %r13
+  802595:	41 54                	push   %r12
+  802597:	53                   	push   %rbx
+  802598:	48 83 ec 08          	sub    $0x8,%rsp
+  80259c:	49 89 fc             	mov    %rdi,%r12
+  80259f:	49 89 f5             	mov    %rsi,%r13
+  8025a2:	48 89 d3             	mov    %rdx,%rbx
+  8025a5:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8025a8:	48 85 f6             	test   %rsi,%rsi
+  8025ab:	0f 84 ff 00 00 00    	je     8026b0 <devfile_diff_snapshots+0x12e>
+  8025b1:	48 85 d2             	test   %rdx,%rdx
+  8025b4:	0f 84 fd 00 00 00    	je     8026b7 <devfile_diff_snapshots+0x135>
+  8025ba:	48 85 c9             	test   %rcx,%rcx
+  8025bd:	0f 84 f4 00 00 00    	je     8026b7 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8025c3:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8025ca:	00 00 00 
+  8025cd:	ff d0                	call   *%rax
+  8025cf:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025d5:	0f 87 e3 00 00 00    	ja     8026be <devfile_diff_snapshots+0x13c>
+  8025db:	4c 89 ef             	mov    %r13,%rdi
+  8025de:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025f0:	0f 87 cf 00 00 00    	ja     8026c5 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025f6:	4c 89 e6             	mov    %r12,%rsi
+  8025f9:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802600:	00 00 00 
+  802603:	4c 89 e7             	mov    %r12,%rdi
+  802606:	49 bf 13 0b 80 00 00 	movabs $0x800b13,%r15
+  80260d:	00 00 00 
+  802610:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802613:	4c 89 ee             	mov    %r13,%rsi
+  802616:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80261d:	00 
+  80261e:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802621:	48 8b 03             	mov    (%rbx),%rax
+  802624:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80262b:	00 
+  80262c:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802630:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802637:	00 
+  802638:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80263c:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802643:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802644:	be 00 00 00 00       	mov    $0x0,%esi
+  802649:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80264e:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802655:	00 00 00 
+  802658:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80265a:	85 c0                	test   %eax,%eax
+  80265c:	78 43                	js     8026a1 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80265e:	49 8b 04 24          	mov    (%r12),%rax
+  802662:	48 89 03             	mov    %rax,(%rbx)
+  802665:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80266a:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80266e:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802673:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802677:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80267c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802680:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802684:	48 c1 e2 03          	shl    $0x3,%rdx
+  802688:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80268d:	4c 89 f7             	mov    %r14,%rdi
+  802690:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80269c:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8026a1:	48 83 c4 08          	add    $0x8,%rsp
+  8026a5:	5b                   	pop    %rbx
+  8026a6:	41 5c                	pop    %r12
+  8026a8:	41 5d                	pop    %r13
+  8026aa:	41 5e                	pop    %r14
+  8026ac:	41 5f                	pop    %r15
+  8026ae:	5d                   	pop    %rbp
+  8026af:	c3                   	ret
+        return -E_INVAL;
+  8026b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b5:	eb ea                	jmp    8026a1 <devfile_diff_snapshots+0x11f>
+  8026b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026bc:	eb e3                	jmp    8026a1 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c3:	eb dc                	jmp    8026a1 <devfile_diff_snapshots+0x11f>
+  8026c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ca:	eb d5                	jmp    8026a1 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026d1:	c3                   	ret
+
+00000000008026d2 <devfile_delete_snapshot>:
+    if (!name) {
+  8026d2:	48 85 ff             	test   %rdi,%rdi
+  8026d5:	74 5f                	je     802736 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026d7:	55                   	push   %rbp
+  8026d8:	48 89 e5             	mov    %rsp,%rbp
+  8026db:	53                   	push   %rbx
+  8026dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e0:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026e3:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8026ea:	00 00 00 
+  8026ed:	ff d0                	call   *%rax
+  8026ef:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026f5:	77 45                	ja     80273c <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026f7:	48 89 de             	mov    %rbx,%rsi
+  8026fa:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802701:	00 00 00 
+  802704:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802710:	be 00 00 00 00       	mov    $0x0,%esi
+  802715:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80271a:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802726:	85 c0                	test   %eax,%eax
+  802728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802730:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802734:	c9                   	leave
+  802735:	c3                   	ret
+        return -E_INVAL;
+  802736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80273b:	c3                   	ret
+        return -E_INVAL;
+  80273c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802741:	eb ed                	jmp    802730 <devfile_delete_snapshot+0x5e>
+
+0000000000802743 <devfile_accept_snapshot>:
+    if (!name) {
+  802743:	48 85 ff             	test   %rdi,%rdi
+  802746:	74 5f                	je     8027a7 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802748:	55                   	push   %rbp
+  802749:	48 89 e5             	mov    %rsp,%rbp
+  80274c:	53                   	push   %rbx
+  80274d:	48 83 ec 08          	sub    $0x8,%rsp
+  802751:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802754:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802766:	77 45                	ja     8027ad <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802768:	48 89 de             	mov    %rbx,%rsi
+  80276b:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802772:	00 00 00 
+  802775:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  80277c:	00 00 00 
+  80277f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802781:	be 00 00 00 00       	mov    $0x0,%esi
+  802786:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80278b:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802797:	85 c0                	test   %eax,%eax
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a5:	c9                   	leave
+  8027a6:	c3                   	ret
+        return -E_INVAL;
+  8027a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027ac:	c3                   	ret
+        return -E_INVAL;
+  8027ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027b2:	eb ed                	jmp    8027a1 <devfile_accept_snapshot+0x5e>
+
+00000000008027b4 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8027b4:	48 85 ff             	test   %rdi,%rdi
+  8027b7:	0f 84 9f 00 00 00    	je     80285c <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8027bd:	55                   	push   %rbp
+  8027be:	48 89 e5             	mov    %rsp,%rbp
+  8027c1:	41 54                	push   %r12
+  8027c3:	53                   	push   %rbx
+  8027c4:	48 89 fb             	mov    %rdi,%rbx
+  8027c7:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027ca:	48 85 f6             	test   %rsi,%rsi
+  8027cd:	74 78                	je     802847 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027cf:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8027d6:	00 00 00 
+  8027d9:	ff d0                	call   *%rax
+  8027db:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027e1:	77 6b                	ja     80284e <devfile_create_snapshot+0x9a>
+  8027e3:	4c 89 e7             	mov    %r12,%rdi
+  8027e6:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+  8027f2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027f8:	77 5b                	ja     802855 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027fa:	48 89 de             	mov    %rbx,%rsi
+  8027fd:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802804:	00 00 00 
+  802807:	48 bb 13 0b 80 00 00 	movabs $0x800b13,%rbx
+  80280e:	00 00 00 
+  802811:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802813:	4c 89 e6             	mov    %r12,%rsi
+  802816:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80281d:	00 00 00 
+  802820:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802822:	be 00 00 00 00       	mov    $0x0,%esi
+  802827:	bf 08 00 00 00       	mov    $0x8,%edi
+  80282c:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802833:	00 00 00 
+  802836:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802842:	5b                   	pop    %rbx
+  802843:	41 5c                	pop    %r12
+  802845:	5d                   	pop    %rbp
+  802846:	c3                   	ret
+        return -E_INVAL;
+  802847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284c:	eb f4                	jmp    802842 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80284e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802853:	eb ed                	jmp    802842 <devfile_create_snapshot+0x8e>
+  802855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80285a:	eb e6                	jmp    802842 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80285c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802861:	c3                   	ret
+
+0000000000802862 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802862:	55                   	push   %rbp
+  802863:	48 89 e5             	mov    %rsp,%rbp
+  802866:	41 54                	push   %r12
+  802868:	53                   	push   %rbx
+  802869:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80286c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80286f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802876:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802878:	be 00 00 00 00       	mov    $0x0,%esi
+  80287d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802882:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	78 3d                	js     8028cf <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802892:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802899:	00 00 00 
+  80289c:	4c 89 e6             	mov    %r12,%rsi
+  80289f:	48 89 df             	mov    %rbx,%rdi
+  8028a2:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  8028a9:	00 00 00 
+  8028ac:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8028ae:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8028b5:	00 
+  8028b6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028bc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8028c3:	00 
+  8028c4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028cf:	5b                   	pop    %rbx
+  8028d0:	41 5c                	pop    %r12
+  8028d2:	5d                   	pop    %rbp
+  8028d3:	c3                   	ret
+
+00000000008028d4 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028d4:	55                   	push   %rbp
+  8028d5:	48 89 e5             	mov    %rsp,%rbp
+  8028d8:	41 57                	push   %r15
+  8028da:	41 56                	push   %r14
+  8028dc:	41 55                	push   %r13
+  8028de:	41 54                	push   %r12
+  8028e0:	53                   	push   %rbx
+  8028e1:	48 83 ec 38          	sub    $0x38,%rsp
+  8028e5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028e9:	49 89 f5             	mov    %rsi,%r13
+  8028ec:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028ef:	48 89 f0             	mov    %rsi,%rax
+  8028f2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028f7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028fb:	75 4f                	jne    80294c <devfile_readmap+0x78>
+  8028fd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802901:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802907:	75 1f                	jne    802928 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802909:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80290d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802911:	49 be bc 30 80 00 00 	movabs $0x8030bc,%r14
+  802918:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80291b:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802922:	0f 87 9d 00 00 00    	ja     8029c5 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802928:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80292c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802930:	4d 85 ff             	test   %r15,%r15
+  802933:	0f 85 cf 00 00 00    	jne    802a08 <devfile_readmap+0x134>
+  802939:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80293d:	48 83 c4 38          	add    $0x38,%rsp
+  802941:	5b                   	pop    %rbx
+  802942:	41 5c                	pop    %r12
+  802944:	41 5d                	pop    %r13
+  802946:	41 5e                	pop    %r14
+  802948:	41 5f                	pop    %r15
+  80294a:	5d                   	pop    %rbp
+  80294b:	c3                   	ret
+    size_t totalRead = 0;
+  80294c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802953:	00 
+  802954:	eb da                	jmp    802930 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802956:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80295a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80295d:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802964:	00 00 00 
+  802967:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802969:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80296d:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802971:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802975:	4c 89 ee             	mov    %r13,%rsi
+  802978:	bf 14 00 00 00       	mov    $0x14,%edi
+  80297d:	48 b8 82 20 80 00 00 	movabs $0x802082,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	7e a3                	jle    802930 <devfile_readmap+0x5c>
+  80298d:	48 98                	cltq
+  80298f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802993:	72 9b                	jb     802930 <devfile_readmap+0x5c>
+        buf += read;
+  802995:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802998:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  80299b:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80299f:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  8029a6:	75 88                	jne    802930 <devfile_readmap+0x5c>
+  8029a8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ac:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8029b2:	0f 85 78 ff ff ff    	jne    802930 <devfile_readmap+0x5c>
+  8029b8:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  8029bf:	0f 86 6b ff ff ff    	jbe    802930 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029c5:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029cb:	4d 39 e7             	cmp    %r12,%r15
+  8029ce:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029d2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029d9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029dd:	0f 84 73 ff ff ff    	je     802956 <devfile_readmap+0x82>
+  8029e3:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029e7:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029ec:	41 ff d6             	call   *%r14
+  8029ef:	a8 40                	test   $0x40,%al
+  8029f1:	0f 85 39 ff ff ff    	jne    802930 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029f7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029fe:	4c 39 e3             	cmp    %r12,%rbx
+  802a01:	72 e4                	jb     8029e7 <devfile_readmap+0x113>
+  802a03:	e9 4e ff ff ff       	jmp    802956 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802a08:	4c 89 fa             	mov    %r15,%rdx
+  802a0b:	4c 89 ee             	mov    %r13,%rsi
+  802a0e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a12:	48 b8 55 23 80 00 00 	movabs $0x802355,%rax
+  802a19:	00 00 00 
+  802a1c:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a1e:	48 85 c0             	test   %rax,%rax
+  802a21:	78 0c                	js     802a2f <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a23:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a27:	48 01 f0             	add    %rsi,%rax
+  802a2a:	e9 0e ff ff ff       	jmp    80293d <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a2f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a33:	48 85 f6             	test   %rsi,%rsi
+  802a36:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a3a:	e9 fe fe ff ff       	jmp    80293d <devfile_readmap+0x69>
+
+0000000000802a3f <open>:
+open(const char *path, int mode) {
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	41 55                	push   %r13
+  802a45:	41 54                	push   %r12
+  802a47:	53                   	push   %rbx
+  802a48:	48 83 ec 18          	sub    $0x18,%rsp
+  802a4c:	49 89 fc             	mov    %rdi,%r12
+  802a4f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a52:	48 b8 d5 0a 80 00 00 	movabs $0x800ad5,%rax
+  802a59:	00 00 00 
+  802a5c:	ff d0                	call   *%rax
+  802a5e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a64:	0f 87 8a 00 00 00    	ja     802af4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a6a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a6e:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  802a75:	00 00 00 
+  802a78:	ff d0                	call   *%rax
+  802a7a:	89 c3                	mov    %eax,%ebx
+  802a7c:	85 c0                	test   %eax,%eax
+  802a7e:	78 50                	js     802ad0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a80:	4c 89 e6             	mov    %r12,%rsi
+  802a83:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a8a:	00 00 00 
+  802a8d:	48 89 df             	mov    %rbx,%rdi
+  802a90:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a9c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802aa3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802aa7:	bf 01 00 00 00       	mov    $0x1,%edi
+  802aac:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802ab3:	00 00 00 
+  802ab6:	ff d0                	call   *%rax
+  802ab8:	89 c3                	mov    %eax,%ebx
+  802aba:	85 c0                	test   %eax,%eax
+  802abc:	78 1f                	js     802add <open+0x9e>
+    return fd2num(fd);
+  802abe:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ac2:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	89 c3                	mov    %eax,%ebx
+}
+  802ad0:	89 d8                	mov    %ebx,%eax
+  802ad2:	48 83 c4 18          	add    $0x18,%rsp
+  802ad6:	5b                   	pop    %rbx
+  802ad7:	41 5c                	pop    %r12
+  802ad9:	41 5d                	pop    %r13
+  802adb:	5d                   	pop    %rbp
+  802adc:	c3                   	ret
+        fd_close(fd, 0);
+  802add:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ae6:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  802aed:	00 00 00 
+  802af0:	ff d0                	call   *%rax
+        return res;
+  802af2:	eb dc                	jmp    802ad0 <open+0x91>
+        return -E_BAD_PATH;
+  802af4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802af9:	eb d5                	jmp    802ad0 <open+0x91>
+
+0000000000802afb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802afb:	55                   	push   %rbp
+  802afc:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802aff:	be 00 00 00 00       	mov    $0x0,%esi
+  802b04:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b09:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+}
+  802b15:	5d                   	pop    %rbp
+  802b16:	c3                   	ret
+
+0000000000802b17 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b17:	55                   	push   %rbp
+  802b18:	48 89 e5             	mov    %rsp,%rbp
+  802b1b:	41 54                	push   %r12
+  802b1d:	53                   	push   %rbx
+  802b1e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b21:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802b28:	00 00 00 
+  802b2b:	ff d0                	call   *%rax
+  802b2d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b30:	48 be 20 3d 80 00 00 	movabs $0x803d20,%rsi
+  802b37:	00 00 00 
+  802b3a:	48 89 df             	mov    %rbx,%rdi
+  802b3d:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b49:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b4e:	41 2b 04 24          	sub    (%r12),%eax
+  802b52:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b58:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b5f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b62:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b69:	00 00 00 
+  802b6c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b78:	5b                   	pop    %rbx
+  802b79:	41 5c                	pop    %r12
+  802b7b:	5d                   	pop    %rbp
+  802b7c:	c3                   	ret
+
+0000000000802b7d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b7d:	55                   	push   %rbp
+  802b7e:	48 89 e5             	mov    %rsp,%rbp
+  802b81:	41 54                	push   %r12
+  802b83:	53                   	push   %rbx
+  802b84:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b8c:	48 89 fe             	mov    %rdi,%rsi
+  802b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b94:	49 bc 6b 12 80 00 00 	movabs $0x80126b,%r12
+  802b9b:	00 00 00 
+  802b9e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802ba1:	48 89 df             	mov    %rbx,%rdi
+  802ba4:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	48 89 c6             	mov    %rax,%rsi
+  802bb3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbd:	41 ff d4             	call   *%r12
+}
+  802bc0:	5b                   	pop    %rbx
+  802bc1:	41 5c                	pop    %r12
+  802bc3:	5d                   	pop    %rbp
+  802bc4:	c3                   	ret
+
+0000000000802bc5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802bc5:	55                   	push   %rbp
+  802bc6:	48 89 e5             	mov    %rsp,%rbp
+  802bc9:	41 57                	push   %r15
+  802bcb:	41 56                	push   %r14
+  802bcd:	41 55                	push   %r13
+  802bcf:	41 54                	push   %r12
+  802bd1:	53                   	push   %rbx
+  802bd2:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd6:	49 89 fc             	mov    %rdi,%r12
+  802bd9:	49 89 f5             	mov    %rsi,%r13
+  802bdc:	49 89 d7             	mov    %rdx,%r15
+  802bdf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802be3:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802bea:	00 00 00 
+  802bed:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bef:	4d 85 ff             	test   %r15,%r15
+  802bf2:	0f 84 af 00 00 00    	je     802ca7 <devpipe_write+0xe2>
+  802bf8:	48 89 c3             	mov    %rax,%rbx
+  802bfb:	4c 89 f8             	mov    %r15,%rax
+  802bfe:	4d 89 ef             	mov    %r13,%r15
+  802c01:	4c 01 e8             	add    %r13,%rax
+  802c04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c08:	49 bd 73 11 80 00 00 	movabs $0x801173,%r13
+  802c0f:	00 00 00 
+            sys_yield();
+  802c12:	49 be 10 11 80 00 00 	movabs $0x801110,%r14
+  802c19:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c1c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c1f:	48 63 ce             	movslq %esi,%rcx
+  802c22:	48 63 03             	movslq (%rbx),%rax
+  802c25:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c2b:	48 39 c1             	cmp    %rax,%rcx
+  802c2e:	72 2e                	jb     802c5e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c30:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c35:	48 89 da             	mov    %rbx,%rdx
+  802c38:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c3d:	4c 89 e7             	mov    %r12,%rdi
+  802c40:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c43:	85 c0                	test   %eax,%eax
+  802c45:	74 66                	je     802cad <devpipe_write+0xe8>
+            sys_yield();
+  802c47:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c4a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c4d:	48 63 ce             	movslq %esi,%rcx
+  802c50:	48 63 03             	movslq (%rbx),%rax
+  802c53:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c59:	48 39 c1             	cmp    %rax,%rcx
+  802c5c:	73 d2                	jae    802c30 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c5e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c62:	48 89 ca             	mov    %rcx,%rdx
+  802c65:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c69:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c70:	08 10 20 
+  802c73:	48 f7 e2             	mul    %rdx
+  802c76:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c7a:	48 89 d0             	mov    %rdx,%rax
+  802c7d:	48 c1 e0 09          	shl    $0x9,%rax
+  802c81:	48 29 d0             	sub    %rdx,%rax
+  802c84:	48 c1 e0 03          	shl    $0x3,%rax
+  802c88:	48 29 c1             	sub    %rax,%rcx
+  802c8b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c90:	83 c6 01             	add    $0x1,%esi
+  802c93:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c96:	49 83 c7 01          	add    $0x1,%r15
+  802c9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c9e:	49 39 c7             	cmp    %rax,%r15
+  802ca1:	0f 85 75 ff ff ff    	jne    802c1c <devpipe_write+0x57>
+    return n;
+  802ca7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cab:	eb 05                	jmp    802cb2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802cad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb2:	48 83 c4 18          	add    $0x18,%rsp
+  802cb6:	5b                   	pop    %rbx
+  802cb7:	41 5c                	pop    %r12
+  802cb9:	41 5d                	pop    %r13
+  802cbb:	41 5e                	pop    %r14
+  802cbd:	41 5f                	pop    %r15
+  802cbf:	5d                   	pop    %rbp
+  802cc0:	c3                   	ret
+
+0000000000802cc1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cc1:	55                   	push   %rbp
+  802cc2:	48 89 e5             	mov    %rsp,%rbp
+  802cc5:	41 57                	push   %r15
+  802cc7:	41 56                	push   %r14
+  802cc9:	41 55                	push   %r13
+  802ccb:	41 54                	push   %r12
+  802ccd:	53                   	push   %rbx
+  802cce:	48 83 ec 18          	sub    $0x18,%rsp
+  802cd2:	49 89 fc             	mov    %rdi,%r12
+  802cd5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cd9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cdd:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802ce4:	00 00 00 
+  802ce7:	ff d0                	call   *%rax
+  802ce9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cf2:	49 bd 73 11 80 00 00 	movabs $0x801173,%r13
+  802cf9:	00 00 00 
+            sys_yield();
+  802cfc:	49 be 10 11 80 00 00 	movabs $0x801110,%r14
+  802d03:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d06:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d0b:	74 7d                	je     802d8a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d0d:	8b 03                	mov    (%rbx),%eax
+  802d0f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d12:	75 26                	jne    802d3a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d14:	4d 85 ff             	test   %r15,%r15
+  802d17:	75 77                	jne    802d90 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d19:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d1e:	48 89 da             	mov    %rbx,%rdx
+  802d21:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d26:	4c 89 e7             	mov    %r12,%rdi
+  802d29:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d2c:	85 c0                	test   %eax,%eax
+  802d2e:	74 72                	je     802da2 <devpipe_read+0xe1>
+            sys_yield();
+  802d30:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d33:	8b 03                	mov    (%rbx),%eax
+  802d35:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d38:	74 df                	je     802d19 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d3a:	48 63 c8             	movslq %eax,%rcx
+  802d3d:	48 89 ca             	mov    %rcx,%rdx
+  802d40:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d44:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d4b:	08 10 20 
+  802d4e:	48 89 d0             	mov    %rdx,%rax
+  802d51:	48 f7 e6             	mul    %rsi
+  802d54:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d58:	48 89 d0             	mov    %rdx,%rax
+  802d5b:	48 c1 e0 09          	shl    $0x9,%rax
+  802d5f:	48 29 d0             	sub    %rdx,%rax
+  802d62:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d69:	00 
+  802d6a:	48 89 c8             	mov    %rcx,%rax
+  802d6d:	48 29 d0             	sub    %rdx,%rax
+  802d70:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d75:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d79:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d7d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d80:	49 83 c7 01          	add    $0x1,%r15
+  802d84:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d88:	75 83                	jne    802d0d <devpipe_read+0x4c>
+    return n;
+  802d8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d8e:	eb 03                	jmp    802d93 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d90:	4c 89 f8             	mov    %r15,%rax
+}
+  802d93:	48 83 c4 18          	add    $0x18,%rsp
+  802d97:	5b                   	pop    %rbx
+  802d98:	41 5c                	pop    %r12
+  802d9a:	41 5d                	pop    %r13
+  802d9c:	41 5e                	pop    %r14
+  802d9e:	41 5f                	pop    %r15
+  802da0:	5d                   	pop    %rbp
+  802da1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da7:	eb ea                	jmp    802d93 <devpipe_read+0xd2>
+
+0000000000802da9 <pipe>:
+pipe(int pfd[2]) {
+  802da9:	55                   	push   %rbp
+  802daa:	48 89 e5             	mov    %rsp,%rbp
+  802dad:	41 55                	push   %r13
+  802daf:	41 54                	push   %r12
+  802db1:	53                   	push   %rbx
+  802db2:	48 83 ec 18          	sub    $0x18,%rsp
+  802db6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802db9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802dbd:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  802dc4:	00 00 00 
+  802dc7:	ff d0                	call   *%rax
+  802dc9:	89 c3                	mov    %eax,%ebx
+  802dcb:	85 c0                	test   %eax,%eax
+  802dcd:	0f 88 a0 01 00 00    	js     802f73 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802dd3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dd8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ddd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802de1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de6:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  802ded:	00 00 00 
+  802df0:	ff d0                	call   *%rax
+  802df2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802df4:	85 c0                	test   %eax,%eax
+  802df6:	0f 88 77 01 00 00    	js     802f73 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dfc:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e00:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  802e07:	00 00 00 
+  802e0a:	ff d0                	call   *%rax
+  802e0c:	89 c3                	mov    %eax,%ebx
+  802e0e:	85 c0                	test   %eax,%eax
+  802e10:	0f 88 43 01 00 00    	js     802f59 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e20:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e29:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+  802e35:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e37:	85 c0                	test   %eax,%eax
+  802e39:	0f 88 1a 01 00 00    	js     802f59 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e3f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e43:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e52:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e5c:	48 89 c6             	mov    %rax,%rsi
+  802e5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e64:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  802e6b:	00 00 00 
+  802e6e:	ff d0                	call   *%rax
+  802e70:	89 c3                	mov    %eax,%ebx
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	0f 88 c5 00 00 00    	js     802f3f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e7a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e7e:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+  802e8a:	48 89 c1             	mov    %rax,%rcx
+  802e8d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e93:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e9e:	4c 89 ee             	mov    %r13,%rsi
+  802ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea6:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  802ead:	00 00 00 
+  802eb0:	ff d0                	call   *%rax
+  802eb2:	89 c3                	mov    %eax,%ebx
+  802eb4:	85 c0                	test   %eax,%eax
+  802eb6:	78 6e                	js     802f26 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802eb8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ebd:	4c 89 ef             	mov    %r13,%rdi
+  802ec0:	48 b8 41 11 80 00 00 	movabs $0x801141,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+  802ecc:	83 f8 02             	cmp    $0x2,%eax
+  802ecf:	0f 85 ab 00 00 00    	jne    802f80 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802ed5:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802edc:	00 00 
+  802ede:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ee2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ee4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ee8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802eef:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ef3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ef5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ef9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f00:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f04:	48 bb 6f 15 80 00 00 	movabs $0x80156f,%rbx
+  802f0b:	00 00 00 
+  802f0e:	ff d3                	call   *%rbx
+  802f10:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f14:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f18:	ff d3                	call   *%rbx
+  802f1a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f24:	eb 4d                	jmp    802f73 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f2b:	4c 89 ee             	mov    %r13,%rsi
+  802f2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f33:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f44:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f48:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f4d:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  802f54:	00 00 00 
+  802f57:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f5e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f62:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f67:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+}
+  802f73:	89 d8                	mov    %ebx,%eax
+  802f75:	48 83 c4 18          	add    $0x18,%rsp
+  802f79:	5b                   	pop    %rbx
+  802f7a:	41 5c                	pop    %r12
+  802f7c:	41 5d                	pop    %r13
+  802f7e:	5d                   	pop    %rbp
+  802f7f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f80:	48 b9 50 3d 80 00 00 	movabs $0x803d50,%rcx
+  802f87:	00 00 00 
+  802f8a:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  802f91:	00 00 00 
+  802f94:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f99:	48 bf 3c 3d 80 00 00 	movabs $0x803d3c,%rdi
+  802fa0:	00 00 00 
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa8:	49 b8 00 34 80 00 00 	movabs $0x803400,%r8
+  802faf:	00 00 00 
+  802fb2:	41 ff d0             	call   *%r8
+
+0000000000802fb5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802fb5:	55                   	push   %rbp
+  802fb6:	48 89 e5             	mov    %rsp,%rbp
+  802fb9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802fbd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fc1:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  802fc8:	00 00 00 
+  802fcb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	78 35                	js     803006 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fd1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fd5:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  802fdc:	00 00 00 
+  802fdf:	ff d0                	call   *%rax
+  802fe1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fe4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fe9:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ff2:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  802ff9:	00 00 00 
+  802ffc:	ff d0                	call   *%rax
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	0f 94 c0             	sete   %al
+  803003:	0f b6 c0             	movzbl %al,%eax
+}
+  803006:	c9                   	leave
+  803007:	c3                   	ret
+
+0000000000803008 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803008:	48 89 f8             	mov    %rdi,%rax
+  80300b:	48 c1 e8 27          	shr    $0x27,%rax
+  80300f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803016:	01 00 00 
+  803019:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80301d:	f6 c2 01             	test   $0x1,%dl
+  803020:	74 6d                	je     80308f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803022:	48 89 f8             	mov    %rdi,%rax
+  803025:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803029:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803030:	01 00 00 
+  803033:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803037:	f6 c2 01             	test   $0x1,%dl
+  80303a:	74 62                	je     80309e <get_uvpt_entry+0x96>
+  80303c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803043:	01 00 00 
+  803046:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80304a:	f6 c2 80             	test   $0x80,%dl
+  80304d:	75 4f                	jne    80309e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80304f:	48 89 f8             	mov    %rdi,%rax
+  803052:	48 c1 e8 15          	shr    $0x15,%rax
+  803056:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80305d:	01 00 00 
+  803060:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803064:	f6 c2 01             	test   $0x1,%dl
+  803067:	74 44                	je     8030ad <get_uvpt_entry+0xa5>
+  803069:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803070:	01 00 00 
+  803073:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803077:	f6 c2 80             	test   $0x80,%dl
+  80307a:	75 31                	jne    8030ad <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80307c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803080:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803087:	01 00 00 
+  80308a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80308e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80308f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803096:	01 00 00 
+  803099:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80309d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80309e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030a5:	01 00 00 
+  8030a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030ac:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030b4:	01 00 00 
+  8030b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030bb:	c3                   	ret
+
+00000000008030bc <get_prot>:
+
+int
+get_prot(void *va) {
+  8030bc:	55                   	push   %rbp
+  8030bd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030c0:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8030c7:	00 00 00 
+  8030ca:	ff d0                	call   *%rax
+  8030cc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030cf:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030d4:	89 c1                	mov    %eax,%ecx
+  8030d6:	83 c9 04             	or     $0x4,%ecx
+  8030d9:	f6 c2 01             	test   $0x1,%dl
+  8030dc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030df:	89 c1                	mov    %eax,%ecx
+  8030e1:	83 c9 02             	or     $0x2,%ecx
+  8030e4:	f6 c2 02             	test   $0x2,%dl
+  8030e7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030ea:	89 c1                	mov    %eax,%ecx
+  8030ec:	83 c9 01             	or     $0x1,%ecx
+  8030ef:	48 85 d2             	test   %rdx,%rdx
+  8030f2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030f5:	89 c1                	mov    %eax,%ecx
+  8030f7:	83 c9 40             	or     $0x40,%ecx
+  8030fa:	f6 c6 04             	test   $0x4,%dh
+  8030fd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803100:	5d                   	pop    %rbp
+  803101:	c3                   	ret
+
+0000000000803102 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803102:	55                   	push   %rbp
+  803103:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803106:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  80310d:	00 00 00 
+  803110:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803112:	48 c1 e8 06          	shr    $0x6,%rax
+  803116:	83 e0 01             	and    $0x1,%eax
+}
+  803119:	5d                   	pop    %rbp
+  80311a:	c3                   	ret
+
+000000000080311b <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80311b:	55                   	push   %rbp
+  80311c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80311f:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  803126:	00 00 00 
+  803129:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80312b:	48 c1 e8 05          	shr    $0x5,%rax
+  80312f:	83 e0 01             	and    $0x1,%eax
+}
+  803132:	5d                   	pop    %rbp
+  803133:	c3                   	ret
+
+0000000000803134 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803134:	55                   	push   %rbp
+  803135:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803138:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+  803144:	83 e0 01             	and    $0x1,%eax
+}
+  803147:	5d                   	pop    %rbp
+  803148:	c3                   	ret
+
+0000000000803149 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803149:	55                   	push   %rbp
+  80314a:	48 89 e5             	mov    %rsp,%rbp
+  80314d:	41 57                	push   %r15
+  80314f:	41 56                	push   %r14
+  803151:	41 55                	push   %r13
+  803153:	41 54                	push   %r12
+  803155:	53                   	push   %rbx
+  803156:	48 83 ec 18          	sub    $0x18,%rsp
+  80315a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80315e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803162:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803167:	49 bd 34 31 80 00 00 	movabs $0x803134,%r13
+  80316e:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803171:	49 bf bc 30 80 00 00 	movabs $0x8030bc,%r15
+  803178:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80317b:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803182:	00 00 00 
+  803185:	eb 0c                	jmp    803193 <foreach_shared_region+0x4a>
+  803187:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80318e:	4c 39 f3             	cmp    %r14,%rbx
+  803191:	74 2e                	je     8031c1 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803193:	48 89 df             	mov    %rbx,%rdi
+  803196:	41 ff d5             	call   *%r13
+  803199:	84 c0                	test   %al,%al
+  80319b:	74 ea                	je     803187 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80319d:	48 89 df             	mov    %rbx,%rdi
+  8031a0:	41 ff d7             	call   *%r15
+  8031a3:	a8 40                	test   $0x40,%al
+  8031a5:	74 e0                	je     803187 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8031a7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8031ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031b2:	48 89 df             	mov    %rbx,%rdi
+  8031b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b9:	ff d0                	call   *%rax
+				if (res < 0) {
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	79 c8                	jns    803187 <foreach_shared_region+0x3e>
+  8031bf:	eb 05                	jmp    8031c6 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8031c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031c6:	48 83 c4 18          	add    $0x18,%rsp
+  8031ca:	5b                   	pop    %rbx
+  8031cb:	41 5c                	pop    %r12
+  8031cd:	41 5d                	pop    %r13
+  8031cf:	41 5e                	pop    %r14
+  8031d1:	41 5f                	pop    %r15
+  8031d3:	5d                   	pop    %rbp
+  8031d4:	c3                   	ret
+
+00000000008031d5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031da:	c3                   	ret
+
+00000000008031db <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031db:	55                   	push   %rbp
+  8031dc:	48 89 e5             	mov    %rsp,%rbp
+  8031df:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031e2:	48 be 74 3d 80 00 00 	movabs $0x803d74,%rsi
+  8031e9:	00 00 00 
+  8031ec:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  8031f3:	00 00 00 
+  8031f6:	ff d0                	call   *%rax
+    return 0;
+}
+  8031f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fd:	5d                   	pop    %rbp
+  8031fe:	c3                   	ret
+
+00000000008031ff <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031ff:	55                   	push   %rbp
+  803200:	48 89 e5             	mov    %rsp,%rbp
+  803203:	41 57                	push   %r15
+  803205:	41 56                	push   %r14
+  803207:	41 55                	push   %r13
+  803209:	41 54                	push   %r12
+  80320b:	53                   	push   %rbx
+  80320c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803213:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80321a:	48 85 d2             	test   %rdx,%rdx
+  80321d:	74 7a                	je     803299 <devcons_write+0x9a>
+  80321f:	49 89 d6             	mov    %rdx,%r14
+  803222:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803228:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80322d:	49 bf 0d 0d 80 00 00 	movabs $0x800d0d,%r15
+  803234:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803237:	4c 89 f3             	mov    %r14,%rbx
+  80323a:	48 29 f3             	sub    %rsi,%rbx
+  80323d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803242:	48 39 c3             	cmp    %rax,%rbx
+  803245:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803249:	4c 63 eb             	movslq %ebx,%r13
+  80324c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803253:	48 01 c6             	add    %rax,%rsi
+  803256:	4c 89 ea             	mov    %r13,%rdx
+  803259:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803260:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803263:	4c 89 ee             	mov    %r13,%rsi
+  803266:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80326d:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  803274:	00 00 00 
+  803277:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803279:	41 01 dc             	add    %ebx,%r12d
+  80327c:	49 63 f4             	movslq %r12d,%rsi
+  80327f:	4c 39 f6             	cmp    %r14,%rsi
+  803282:	72 b3                	jb     803237 <devcons_write+0x38>
+    return res;
+  803284:	49 63 c4             	movslq %r12d,%rax
+}
+  803287:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80328e:	5b                   	pop    %rbx
+  80328f:	41 5c                	pop    %r12
+  803291:	41 5d                	pop    %r13
+  803293:	41 5e                	pop    %r14
+  803295:	41 5f                	pop    %r15
+  803297:	5d                   	pop    %rbp
+  803298:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803299:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80329f:	eb e3                	jmp    803284 <devcons_write+0x85>
+
+00000000008032a1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8032a1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8032a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a9:	48 85 c0             	test   %rax,%rax
+  8032ac:	74 55                	je     803303 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8032ae:	55                   	push   %rbp
+  8032af:	48 89 e5             	mov    %rsp,%rbp
+  8032b2:	41 55                	push   %r13
+  8032b4:	41 54                	push   %r12
+  8032b6:	53                   	push   %rbx
+  8032b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bb:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8032be:	48 bb 43 10 80 00 00 	movabs $0x801043,%rbx
+  8032c5:	00 00 00 
+  8032c8:	49 bc 10 11 80 00 00 	movabs $0x801110,%r12
+  8032cf:	00 00 00 
+  8032d2:	eb 03                	jmp    8032d7 <devcons_read+0x36>
+  8032d4:	41 ff d4             	call   *%r12
+  8032d7:	ff d3                	call   *%rbx
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	74 f7                	je     8032d4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8032dd:	48 63 d0             	movslq %eax,%rdx
+  8032e0:	78 13                	js     8032f5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e7:	83 f8 04             	cmp    $0x4,%eax
+  8032ea:	74 09                	je     8032f5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032ec:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032f0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032f5:	48 89 d0             	mov    %rdx,%rax
+  8032f8:	48 83 c4 08          	add    $0x8,%rsp
+  8032fc:	5b                   	pop    %rbx
+  8032fd:	41 5c                	pop    %r12
+  8032ff:	41 5d                	pop    %r13
+  803301:	5d                   	pop    %rbp
+  803302:	c3                   	ret
+  803303:	48 89 d0             	mov    %rdx,%rax
+  803306:	c3                   	ret
+
+0000000000803307 <cputchar>:
+cputchar(int ch) {
+  803307:	55                   	push   %rbp
+  803308:	48 89 e5             	mov    %rsp,%rbp
+  80330b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80330f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803313:	be 01 00 00 00       	mov    $0x1,%esi
+  803318:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80331c:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+}
+  803328:	c9                   	leave
+  803329:	c3                   	ret
+
+000000000080332a <getchar>:
+getchar(void) {
+  80332a:	55                   	push   %rbp
+  80332b:	48 89 e5             	mov    %rsp,%rbp
+  80332e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803332:	ba 01 00 00 00       	mov    $0x1,%edx
+  803337:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80333b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803340:	48 b8 e0 18 80 00 00 	movabs $0x8018e0,%rax
+  803347:	00 00 00 
+  80334a:	ff d0                	call   *%rax
+  80334c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 06                	js     803358 <getchar+0x2e>
+  803352:	74 08                	je     80335c <getchar+0x32>
+  803354:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803358:	89 d0                	mov    %edx,%eax
+  80335a:	c9                   	leave
+  80335b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80335c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803361:	eb f5                	jmp    803358 <getchar+0x2e>
+
+0000000000803363 <iscons>:
+iscons(int fdnum) {
+  803363:	55                   	push   %rbp
+  803364:	48 89 e5             	mov    %rsp,%rbp
+  803367:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80336b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80336f:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  803376:	00 00 00 
+  803379:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80337b:	85 c0                	test   %eax,%eax
+  80337d:	78 18                	js     803397 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80337f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803383:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80338a:	00 00 00 
+  80338d:	8b 00                	mov    (%rax),%eax
+  80338f:	39 02                	cmp    %eax,(%rdx)
+  803391:	0f 94 c0             	sete   %al
+  803394:	0f b6 c0             	movzbl %al,%eax
+}
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+
+0000000000803399 <opencons>:
+opencons(void) {
+  803399:	55                   	push   %rbp
+  80339a:	48 89 e5             	mov    %rsp,%rbp
+  80339d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8033a1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8033a5:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	78 49                	js     8033fe <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8033b5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033bf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8033c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c8:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  8033cf:	00 00 00 
+  8033d2:	ff d0                	call   *%rax
+  8033d4:	85 c0                	test   %eax,%eax
+  8033d6:	78 26                	js     8033fe <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033dc:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033e3:	00 00 
+  8033e5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033eb:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033f2:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8033f9:	00 00 00 
+  8033fc:	ff d0                	call   *%rax
+}
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+
+0000000000803400 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803400:	55                   	push   %rbp
+  803401:	48 89 e5             	mov    %rsp,%rbp
+  803404:	41 56                	push   %r14
+  803406:	41 55                	push   %r13
+  803408:	41 54                	push   %r12
+  80340a:	53                   	push   %rbx
+  80340b:	48 83 ec 50          	sub    $0x50,%rsp
+  80340f:	49 89 fc             	mov    %rdi,%r12
+  803412:	41 89 f5             	mov    %esi,%r13d
+  803415:	48 89 d3             	mov    %rdx,%rbx
+  803418:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80341c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803420:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803424:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80342b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80342f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803433:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803437:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80343b:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  803442:	00 00 00 
+  803445:	4c 8b 30             	mov    (%rax),%r14
+  803448:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  80344f:	00 00 00 
+  803452:	ff d0                	call   *%rax
+  803454:	89 c6                	mov    %eax,%esi
+  803456:	45 89 e8             	mov    %r13d,%r8d
+  803459:	4c 89 e1             	mov    %r12,%rcx
+  80345c:	4c 89 f2             	mov    %r14,%rdx
+  80345f:	48 bf 80 3d 80 00 00 	movabs $0x803d80,%rdi
+  803466:	00 00 00 
+  803469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346e:	49 bc ee 01 80 00 00 	movabs $0x8001ee,%r12
+  803475:	00 00 00 
+  803478:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80347b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80347f:	48 89 df             	mov    %rbx,%rdi
+  803482:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80348e:	48 bf cc 36 80 00 00 	movabs $0x8036cc,%rdi
+  803495:	00 00 00 
+  803498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8034a0:	cc                   	int3
+  8034a1:	eb fd                	jmp    8034a0 <_panic+0xa0>
+
+00000000008034a3 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8034a3:	55                   	push   %rbp
+  8034a4:	48 89 e5             	mov    %rsp,%rbp
+  8034a7:	41 55                	push   %r13
+  8034a9:	41 54                	push   %r12
+  8034ab:	53                   	push   %rbx
+  8034ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8034b0:	49 89 fc             	mov    %rdi,%r12
+  8034b3:	48 89 f7             	mov    %rsi,%rdi
+  8034b6:	48 89 d3             	mov    %rdx,%rbx
+  8034b9:	49 89 cd             	mov    %rcx,%r13
+  8034bc:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8034bf:	48 85 f6             	test   %rsi,%rsi
+  8034c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034c9:	00 00 00 
+  8034cc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034d5:	48 85 db             	test   %rbx,%rbx
+  8034d8:	74 03                	je     8034dd <ipc_recv_timed+0x3a>
+  8034da:	48 8b 33             	mov    (%rbx),%rsi
+  8034dd:	48 b8 39 14 80 00 00 	movabs $0x801439,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	78 75                	js     803562 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034ed:	4d 85 e4             	test   %r12,%r12
+  8034f0:	74 14                	je     803506 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034f2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034f9:	00 00 00 
+  8034fc:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803502:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803506:	4d 85 ed             	test   %r13,%r13
+  803509:	74 14                	je     80351f <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80350b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803512:	00 00 00 
+  803515:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80351b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80351f:	48 85 db             	test   %rbx,%rbx
+  803522:	74 23                	je     803547 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803524:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80352b:	00 00 00 
+  80352e:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803534:	ba 00 00 00 00       	mov    $0x0,%edx
+  803539:	85 c9                	test   %ecx,%ecx
+  80353b:	74 07                	je     803544 <ipc_recv_timed+0xa1>
+  80353d:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803544:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803547:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80354e:	00 00 00 
+  803551:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803557:	48 83 c4 08          	add    $0x8,%rsp
+  80355b:	5b                   	pop    %rbx
+  80355c:	41 5c                	pop    %r12
+  80355e:	41 5d                	pop    %r13
+  803560:	5d                   	pop    %rbp
+  803561:	c3                   	ret
+        if (from_env_store != NULL) {
+  803562:	4d 85 e4             	test   %r12,%r12
+  803565:	74 08                	je     80356f <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803567:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80356e:	00 
+        if (perm_store != NULL) {
+  80356f:	4d 85 ed             	test   %r13,%r13
+  803572:	74 08                	je     80357c <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803574:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80357b:	00 
+        if (size != NULL) {
+  80357c:	48 85 db             	test   %rbx,%rbx
+  80357f:	74 d6                	je     803557 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803581:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803588:	eb cd                	jmp    803557 <ipc_recv_timed+0xb4>
+
+000000000080358a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80358a:	55                   	push   %rbp
+  80358b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80358e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803594:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  80359b:	00 00 00 
+  80359e:	ff d0                	call   *%rax
+}
+  8035a0:	5d                   	pop    %rbp
+  8035a1:	c3                   	ret
+
+00000000008035a2 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8035a2:	55                   	push   %rbp
+  8035a3:	48 89 e5             	mov    %rsp,%rbp
+  8035a6:	41 57                	push   %r15
+  8035a8:	41 56                	push   %r14
+  8035aa:	41 55                	push   %r13
+  8035ac:	41 54                	push   %r12
+  8035ae:	53                   	push   %rbx
+  8035af:	48 83 ec 18          	sub    $0x18,%rsp
+  8035b3:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8035b6:	48 89 d3             	mov    %rdx,%rbx
+  8035b9:	49 89 cc             	mov    %rcx,%r12
+  8035bc:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035bf:	48 85 d2             	test   %rdx,%rdx
+  8035c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035c9:	00 00 00 
+  8035cc:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d0:	89 f0                	mov    %esi,%eax
+  8035d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035d6:	48 89 da             	mov    %rbx,%rdx
+  8035d9:	48 89 c6             	mov    %rax,%rsi
+  8035dc:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  8035e3:	00 00 00 
+  8035e6:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035e8:	85 c0                	test   %eax,%eax
+  8035ea:	79 65                	jns    803651 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035ec:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035ef:	75 33                	jne    803624 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035f1:	49 bf 10 11 80 00 00 	movabs $0x801110,%r15
+  8035f8:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035fb:	49 be 0d 14 80 00 00 	movabs $0x80140d,%r14
+  803602:	00 00 00 
+        sys_yield();
+  803605:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803608:	45 89 e8             	mov    %r13d,%r8d
+  80360b:	4c 89 e1             	mov    %r12,%rcx
+  80360e:	48 89 da             	mov    %rbx,%rdx
+  803611:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803615:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803618:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80361b:	85 c0                	test   %eax,%eax
+  80361d:	79 32                	jns    803651 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80361f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803622:	74 e1                	je     803605 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803624:	89 c1                	mov    %eax,%ecx
+  803626:	48 ba a3 3d 80 00 00 	movabs $0x803da3,%rdx
+  80362d:	00 00 00 
+  803630:	be 52 00 00 00       	mov    $0x52,%esi
+  803635:	48 bf b7 3d 80 00 00 	movabs $0x803db7,%rdi
+  80363c:	00 00 00 
+  80363f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803644:	49 b8 00 34 80 00 00 	movabs $0x803400,%r8
+  80364b:	00 00 00 
+  80364e:	41 ff d0             	call   *%r8
+    }
+}
+  803651:	48 83 c4 18          	add    $0x18,%rsp
+  803655:	5b                   	pop    %rbx
+  803656:	41 5c                	pop    %r12
+  803658:	41 5d                	pop    %r13
+  80365a:	41 5e                	pop    %r14
+  80365c:	41 5f                	pop    %r15
+  80365e:	5d                   	pop    %rbp
+  80365f:	c3                   	ret
+
+0000000000803660 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803660:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803665:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80366c:	00 00 00 
+  80366f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803673:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803677:	48 c1 e2 04          	shl    $0x4,%rdx
+  80367b:	48 01 ca             	add    %rcx,%rdx
+  80367e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803684:	39 fa                	cmp    %edi,%edx
+  803686:	74 12                	je     80369a <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803688:	48 83 c0 01          	add    $0x1,%rax
+  80368c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803692:	75 db                	jne    80366f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803694:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803699:	c3                   	ret
+            return envs[i].env_id;
+  80369a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80369e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8036a2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036a6:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8036ad:	00 00 00 
+  8036b0:	48 01 d0             	add    %rdx,%rax
+  8036b3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036b9:	c3                   	ret
+  8036ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008036c0 <__rodata_start>:
+  8036c0:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  8036c5:	2c 20                	sub    $0x20,%al
+  8036c7:	77 6f                	ja     803738 <__rodata_start+0x78>
+  8036c9:	72 6c                	jb     803737 <__rodata_start+0x77>
+  8036cb:	64 0a 00             	or     %fs:(%rax),%al
+  8036ce:	69 20 61 6d 20 65    	imul   $0x65206d61,(%rax),%esp
+  8036d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036d5:	76 69                	jbe    803740 <__rodata_start+0x80>
+  8036d7:	72 6f                	jb     803748 <__rodata_start+0x88>
+  8036d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036da:	6d                   	insl   (%dx),%es:(%rdi)
+  8036db:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8036dd:	74 20                	je     8036ff <__rodata_start+0x3f>
+  8036df:	25 30 38 78 0a       	and    $0xa783830,%eax
+  8036e4:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8036eb:	77 6e                	ja     80375b <__rodata_start+0x9b>
+  8036ed:	3e 00 30             	ds add %dh,(%rax)
+  8036f0:	31 32                	xor    %esi,(%rdx)
+  8036f2:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036f9:	41                   	rex.B
+  8036fa:	42                   	rex.X
+  8036fb:	43                   	rex.XB
+  8036fc:	44                   	rex.R
+  8036fd:	45                   	rex.RB
+  8036fe:	46 00 30             	rex.RX add %r14b,(%rax)
+  803701:	31 32                	xor    %esi,(%rdx)
+  803703:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80370a:	61                   	(bad)
+  80370b:	62 63 64 65 66       	(bad)
+  803710:	00 28                	add    %ch,(%rax)
+  803712:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803713:	75 6c                	jne    803781 <__rodata_start+0xc1>
+  803715:	6c                   	insb   (%dx),%es:(%rdi)
+  803716:	29 00                	sub    %eax,(%rax)
+  803718:	65 72 72             	gs jb  80378d <__rodata_start+0xcd>
+  80371b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80371c:	72 20                	jb     80373e <__rodata_start+0x7e>
+  80371e:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803723:	73 70                	jae    803795 <__rodata_start+0xd5>
+  803725:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803729:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803730:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803731:	72 00                	jb     803733 <__rodata_start+0x73>
+  803733:	62 61 64 20 65       	(bad)
+  803738:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803739:	76 69                	jbe    8037a4 <__rodata_start+0xe4>
+  80373b:	72 6f                	jb     8037ac <__rodata_start+0xec>
+  80373d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80373e:	6d                   	insl   (%dx),%es:(%rdi)
+  80373f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803741:	74 00                	je     803743 <__rodata_start+0x83>
+  803743:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80374a:	20 70 61             	and    %dh,0x61(%rax)
+  80374d:	72 61                	jb     8037b0 <__rodata_start+0xf0>
+  80374f:	6d                   	insl   (%dx),%es:(%rdi)
+  803750:	65 74 65             	gs je  8037b8 <__rodata_start+0xf8>
+  803753:	72 00                	jb     803755 <__rodata_start+0x95>
+  803755:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803756:	75 74                	jne    8037cc <__rodata_start+0x10c>
+  803758:	20 6f 66             	and    %ch,0x66(%rdi)
+  80375b:	20 6d 65             	and    %ch,0x65(%rbp)
+  80375e:	6d                   	insl   (%dx),%es:(%rdi)
+  80375f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803760:	72 79                	jb     8037db <__rodata_start+0x11b>
+  803762:	00 6f 75             	add    %ch,0x75(%rdi)
+  803765:	74 20                	je     803787 <__rodata_start+0xc7>
+  803767:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803768:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80376c:	76 69                	jbe    8037d7 <__rodata_start+0x117>
+  80376e:	72 6f                	jb     8037df <__rodata_start+0x11f>
+  803770:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803771:	6d                   	insl   (%dx),%es:(%rdi)
+  803772:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803774:	74 73                	je     8037e9 <__rodata_start+0x129>
+  803776:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803779:	72 72                	jb     8037ed <__rodata_start+0x12d>
+  80377b:	75 70                	jne    8037ed <__rodata_start+0x12d>
+  80377d:	74 65                	je     8037e4 <__rodata_start+0x124>
+  80377f:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803784:	75 67                	jne    8037ed <__rodata_start+0x12d>
+  803786:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803789:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80378b:	00 73 65             	add    %dh,0x65(%rbx)
+  80378e:	67 6d                	insl   (%dx),%es:(%edi)
+  803790:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803792:	74 61                	je     8037f5 <__rodata_start+0x135>
+  803794:	74 69                	je     8037ff <__rodata_start+0x13f>
+  803796:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803797:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803798:	20 66 61             	and    %ah,0x61(%rsi)
+  80379b:	75 6c                	jne    803809 <__rodata_start+0x149>
+  80379d:	74 00                	je     80379f <__rodata_start+0xdf>
+  80379f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8037a6:	20 45 4c             	and    %al,0x4c(%rbp)
+  8037a9:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8037ad:	61                   	(bad)
+  8037ae:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8037b3:	20 73 75             	and    %dh,0x75(%rbx)
+  8037b6:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8037b9:	73 79                	jae    803834 <__rodata_start+0x174>
+  8037bb:	73 74                	jae    803831 <__rodata_start+0x171>
+  8037bd:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8037bf:	20 63 61             	and    %ah,0x61(%rbx)
+  8037c2:	6c                   	insb   (%dx),%es:(%rdi)
+  8037c3:	6c                   	insb   (%dx),%es:(%rdi)
+  8037c4:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8037c7:	74 72                	je     80383b <__rodata_start+0x17b>
+  8037c9:	79 20                	jns    8037eb <__rodata_start+0x12b>
+  8037cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037cd:	74 20                	je     8037ef <__rodata_start+0x12f>
+  8037cf:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037d1:	75 6e                	jne    803841 <__rodata_start+0x181>
+  8037d3:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8037d7:	76 20                	jbe    8037f9 <__rodata_start+0x139>
+  8037d9:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8037e0:	72 65                	jb     803847 <__rodata_start+0x187>
+  8037e2:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8037e5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037e6:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037ea:	65 78 70             	gs js  80385d <__rodata_start+0x19d>
+  8037ed:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037f2:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037f5:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037f9:	20 66 69             	and    %ah,0x69(%rsi)
+  8037fc:	6c                   	insb   (%dx),%es:(%rdi)
+  8037fd:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803801:	20 66 72             	and    %ah,0x72(%rsi)
+  803804:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803809:	61                   	(bad)
+  80380a:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80380d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80380e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80380f:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803813:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803816:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803817:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803818:	20 6d 61             	and    %ch,0x61(%rbp)
+  80381b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80381c:	79 20                	jns    80383e <__rodata_start+0x17e>
+  80381e:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803825:	72 65                	jb     80388c <__rodata_start+0x1cc>
+  803827:	20 6f 70             	and    %ch,0x70(%rdi)
+  80382a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80382c:	00 66 69             	add    %ah,0x69(%rsi)
+  80382f:	6c                   	insb   (%dx),%es:(%rdi)
+  803830:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803834:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803837:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803838:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80383b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80383c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80383d:	74 20                	je     80385f <__rodata_start+0x19f>
+  80383f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803841:	75 6e                	jne    8038b1 <__rodata_start+0x1f1>
+  803843:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803847:	76 61                	jbe    8038aa <__rodata_start+0x1ea>
+  803849:	6c                   	insb   (%dx),%es:(%rdi)
+  80384a:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803851:	00 
+  803852:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803859:	72 65                	jb     8038c0 <__rodata_start+0x200>
+  80385b:	61                   	(bad)
+  80385c:	64 79 20             	fs jns 80387f <__rodata_start+0x1bf>
+  80385f:	65 78 69             	gs js  8038cb <__rodata_start+0x20b>
+  803862:	73 74                	jae    8038d8 <__rodata_start+0x218>
+  803864:	73 00                	jae    803866 <__rodata_start+0x1a6>
+  803866:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803867:	70 65                	jo     8038ce <__rodata_start+0x20e>
+  803869:	72 61                	jb     8038cc <__rodata_start+0x20c>
+  80386b:	74 69                	je     8038d6 <__rodata_start+0x216>
+  80386d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80386e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80386f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803872:	74 20                	je     803894 <__rodata_start+0x1d4>
+  803874:	73 75                	jae    8038eb <__rodata_start+0x22b>
+  803876:	70 70                	jo     8038e8 <__rodata_start+0x228>
+  803878:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803879:	72 74                	jb     8038ef <__rodata_start+0x22f>
+  80387b:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803881:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803886:	74 00                	je     803888 <__rodata_start+0x1c8>
+  803888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80388f:	00 00 00 
+  803892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803899:	00 00 00 
+  80389c:	0f 1f 40 00          	nopl   0x0(%rax)
+  8038a0:	db 03                	fildl  (%rbx)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038aa:	80 00 00             	addb   $0x0,(%rax)
+  8038ad:	00 00                	add    %al,(%rax)
+  8038af:	00 0c 0a             	add    %cl,(%rdx,%rcx,1)
+  8038b2:	80 00 00             	addb   $0x0,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038ba:	80 00 00             	addb   $0x0,(%rax)
+  8038bd:	00 00                	add    %al,(%rax)
+  8038bf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038c2:	80 00 00             	addb   $0x0,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038ca:	80 00 00             	addb   $0x0,(%rax)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038d2:	80 00 00             	addb   $0x0,(%rax)
+  8038d5:	00 00                	add    %al,(%rax)
+  8038d7:	00 fa                	add    %bh,%dl
+  8038d9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038df:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038e2:	80 00 00             	addb   $0x0,(%rax)
+  8038e5:	00 00                	add    %al,(%rax)
+  8038e7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8038ea:	80 00 00             	addb   $0x0,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 ee                	add    %ch,%dh
+  8038f1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038f7:	00 68 04             	add    %ch,0x4(%rax)
+  8038fa:	80 00 00             	addb   $0x0,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803902:	80 00 00             	addb   $0x0,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 ee                	add    %ch,%dh
+  803909:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80390f:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  803912:	80 00 00             	addb   $0x0,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  80391a:	80 00 00             	addb   $0x0,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  803922:	80 00 00             	addb   $0x0,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  80392a:	80 00 00             	addb   $0x0,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  803932:	80 00 00             	addb   $0x0,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  80393a:	80 00 00             	addb   $0x0,(%rax)
+  80393d:	00 00                	add    %al,(%rax)
+  80393f:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  803942:	80 00 00             	addb   $0x0,(%rax)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  80394a:	80 00 00             	addb   $0x0,(%rax)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 34 04             	add    %dh,(%rsp,%rax,1)
+  803952:	80 00 00             	addb   $0x0,(%rax)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80395a:	80 00 00             	addb   $0x0,(%rax)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803962:	80 00 00             	addb   $0x0,(%rax)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80396a:	80 00 00             	addb   $0x0,(%rax)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803972:	80 00 00             	addb   $0x0,(%rax)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80397a:	80 00 00             	addb   $0x0,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803982:	80 00 00             	addb   $0x0,(%rax)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80398a:	80 00 00             	addb   $0x0,(%rax)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803992:	80 00 00             	addb   $0x0,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039a2:	80 00 00             	addb   $0x0,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039aa:	80 00 00             	addb   $0x0,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039b2:	80 00 00             	addb   $0x0,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039ba:	80 00 00             	addb   $0x0,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039c2:	80 00 00             	addb   $0x0,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039d2:	80 00 00             	addb   $0x0,(%rax)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039da:	80 00 00             	addb   $0x0,(%rax)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039e2:	80 00 00             	addb   $0x0,(%rax)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039ea:	80 00 00             	addb   $0x0,(%rax)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039f2:	80 00 00             	addb   $0x0,(%rax)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8039fa:	80 00 00             	addb   $0x0,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a02:	80 00 00             	addb   $0x0,(%rax)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a12:	80 00 00             	addb   $0x0,(%rax)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a1a:	80 00 00             	addb   $0x0,(%rax)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a22:	80 00 00             	addb   $0x0,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a2a:	80 00 00             	addb   $0x0,(%rax)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a32:	80 00 00             	addb   $0x0,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a3a:	80 00 00             	addb   $0x0,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a42:	80 00 00             	addb   $0x0,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 3f                	add    %bh,(%rdi)
+  803a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a4f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a52:	80 00 00             	addb   $0x0,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a5a:	80 00 00             	addb   $0x0,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a62:	80 00 00             	addb   $0x0,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a6a:	80 00 00             	addb   $0x0,(%rax)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 8b 04 80 00 00    	add    %cl,0x8004(%rbx)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 5a 06             	add    %bl,0x6(%rdx)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803ab2:	80 00 00             	addb   $0x0,(%rax)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803ac2:	80 00 00             	addb   $0x0,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803aca:	80 00 00             	addb   $0x0,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 ba 04 80 00 00    	add    %bh,0x8004(%rdx)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803ada:	80 00 00             	addb   $0x0,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 80 04 80 00 00    	add    %al,0x8004(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803af2:	80 00 00             	addb   $0x0,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803afa:	80 00 00             	addb   $0x0,(%rax)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 02                	add    %al,(%rdx)
+  803b01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803b07:	00 cc                	add    %cl,%ah
+  803b09:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803b0f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b1a:	80 00 00             	addb   $0x0,(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 51 05             	add    %dl,0x5(%rcx)
+  803b22:	80 00 00             	addb   $0x0,(%rax)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b2a:	80 00 00             	addb   $0x0,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 2e                	add    %ch,(%rsi)
+  803b31:	07                   	(bad)
+  803b32:	80 00 00             	addb   $0x0,(%rax)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b3a:	80 00 00             	addb   $0x0,(%rax)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b42:	80 00 00             	addb   $0x0,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 3f                	add    %bh,(%rdi)
+  803b49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b4f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803b52:	80 00 00             	addb   $0x0,(%rax)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 e4                	add    %ah,%ah
+  803b59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803b60 <error_string>:
+	...
+  803b68:	21 37 80 00 00 00 00 00 33 37 80 00 00 00 00 00     !7......37......
+  803b78:	43 37 80 00 00 00 00 00 55 37 80 00 00 00 00 00     C7......U7......
+  803b88:	63 37 80 00 00 00 00 00 77 37 80 00 00 00 00 00     c7......w7......
+  803b98:	8c 37 80 00 00 00 00 00 9f 37 80 00 00 00 00 00     .7.......7......
+  803ba8:	b1 37 80 00 00 00 00 00 c5 37 80 00 00 00 00 00     .7.......7......
+  803bb8:	d5 37 80 00 00 00 00 00 e8 37 80 00 00 00 00 00     .7.......7......
+  803bc8:	ff 37 80 00 00 00 00 00 15 38 80 00 00 00 00 00     .7.......8......
+  803bd8:	2d 38 80 00 00 00 00 00 45 38 80 00 00 00 00 00     -8......E8......
+  803be8:	52 38 80 00 00 00 00 00 08 3c 80 00 00 00 00 00     R8.......<......
+  803bf8:	66 38 80 00 00 00 00 00 7e 38 80 00 00 00 00 00     f8......~8......
+  803c08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803c18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803c28:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803c38:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803c48:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803c58:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c68:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c78:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c88:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c98:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803ca8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803cb8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803cc8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803cd8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803ce8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cf8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803d00 <devtab>:
+  803d00:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803d10:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803d20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803d30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803d40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803d50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803da0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803db0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
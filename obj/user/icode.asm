@@ -0,0 +1,8000 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 48 41 80 00 00 	movabs $0x804148,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 4e 41 80 00 00 	movabs $0x80414e,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 0d 04 80 00 00 	movabs $0x80040d,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf 5d 41 80 00 00 	movabs $0x80415d,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf 70 41 80 00 00 	movabs $0x804170,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 5e 2c 80 00 00 	movabs $0x802c5e,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf 99 41 80 00 00 	movabs $0x804199,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc ff 1a 80 00 00 	movabs $0x801aff,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 35 12 80 00 00 	movabs $0x801235,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba 76 41 80 00 00 	movabs $0x804176,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf 8c 41 80 00 00 	movabs $0x80418c,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf ac 41 80 00 00 	movabs $0x8041ac,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 0d 04 80 00 00 	movabs $0x80040d,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf c0 41 80 00 00 	movabs $0x8041c0,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 d4 41 80 00 00 	movabs $0x8041d4,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba dd 41 80 00 00 	movabs $0x8041dd,%rdx
+  800169:	00 00 00 
+  80016c:	48 be e7 41 80 00 00 	movabs $0x8041e7,%rsi
+  800173:	00 00 00 
+  800176:	48 bf e6 41 80 00 00 	movabs $0x8041e6,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 39 35 80 00 00 	movabs $0x803539,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf 03 42 80 00 00 	movabs $0x804203,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba ec 41 80 00 00 	movabs $0x8041ec,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf 8c 41 80 00 00 	movabs $0x80418c,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	41 89 fd             	mov    %edi,%r13d
+  8001fa:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fd:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800204:	00 00 00 
+  800207:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80020e:	00 00 00 
+  800211:	48 39 c2             	cmp    %rax,%rdx
+  800214:	73 17                	jae    80022d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800216:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800219:	49 89 c4             	mov    %rax,%r12
+  80021c:	48 83 c3 08          	add    $0x8,%rbx
+  800220:	b8 00 00 00 00       	mov    $0x0,%eax
+  800225:	ff 53 f8             	call   *-0x8(%rbx)
+  800228:	4c 39 e3             	cmp    %r12,%rbx
+  80022b:	72 ef                	jb     80021c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80022d:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+  800239:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800242:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800246:	48 c1 e0 04          	shl    $0x4,%rax
+  80024a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800251:	00 00 00 
+  800254:	48 01 d0             	add    %rdx,%rax
+  800257:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80025e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800261:	45 85 ed             	test   %r13d,%r13d
+  800264:	7e 0d                	jle    800273 <libmain+0x87>
+  800266:	49 8b 06             	mov    (%r14),%rax
+  800269:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800270:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800273:	4c 89 f6             	mov    %r14,%rsi
+  800276:	44 89 ef             	mov    %r13d,%edi
+  800279:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800285:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  80028c:	00 00 00 
+  80028f:	ff d0                	call   *%rax
+#endif
+}
+  800291:	5b                   	pop    %rbx
+  800292:	41 5c                	pop    %r12
+  800294:	41 5d                	pop    %r13
+  800296:	41 5e                	pop    %r14
+  800298:	5d                   	pop    %rbp
+  800299:	c3                   	ret
+
+000000000080029a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80029e:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  8002a5:	00 00 00 
+  8002a8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002af:	48 b8 93 12 80 00 00 	movabs $0x801293,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+}
+  8002bb:	5d                   	pop    %rbp
+  8002bc:	c3                   	ret
+
+00000000008002bd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002bd:	55                   	push   %rbp
+  8002be:	48 89 e5             	mov    %rsp,%rbp
+  8002c1:	41 56                	push   %r14
+  8002c3:	41 55                	push   %r13
+  8002c5:	41 54                	push   %r12
+  8002c7:	53                   	push   %rbx
+  8002c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8002cc:	49 89 fc             	mov    %rdi,%r12
+  8002cf:	41 89 f5             	mov    %esi,%r13d
+  8002d2:	48 89 d3             	mov    %rdx,%rbx
+  8002d5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002dd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002e1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ec:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002f0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002f4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f8:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8002ff:	00 00 00 
+  800302:	4c 8b 30             	mov    (%rax),%r14
+  800305:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  80030c:	00 00 00 
+  80030f:	ff d0                	call   *%rax
+  800311:	89 c6                	mov    %eax,%esi
+  800313:	45 89 e8             	mov    %r13d,%r8d
+  800316:	4c 89 e1             	mov    %r12,%rcx
+  800319:	4c 89 f2             	mov    %r14,%rdx
+  80031c:	48 bf 20 42 80 00 00 	movabs $0x804220,%rdi
+  800323:	00 00 00 
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	49 bc 0d 04 80 00 00 	movabs $0x80040d,%r12
+  800332:	00 00 00 
+  800335:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800338:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80033c:	48 89 df             	mov    %rbx,%rdi
+  80033f:	48 b8 a9 03 80 00 00 	movabs $0x8003a9,%rax
+  800346:	00 00 00 
+  800349:	ff d0                	call   *%rax
+    cprintf("\n");
+  80034b:	48 bf aa 41 80 00 00 	movabs $0x8041aa,%rdi
+  800352:	00 00 00 
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80035d:	cc                   	int3
+  80035e:	eb fd                	jmp    80035d <_panic+0xa0>
+
+0000000000800360 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800360:	55                   	push   %rbp
+  800361:	48 89 e5             	mov    %rsp,%rbp
+  800364:	53                   	push   %rbx
+  800365:	48 83 ec 08          	sub    $0x8,%rsp
+  800369:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80036c:	8b 06                	mov    (%rsi),%eax
+  80036e:	8d 50 01             	lea    0x1(%rax),%edx
+  800371:	89 16                	mov    %edx,(%rsi)
+  800373:	48 98                	cltq
+  800375:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80037a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800380:	74 0a                	je     80038c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800382:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800386:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80038a:	c9                   	leave
+  80038b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80038c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800390:	be ff 00 00 00       	mov    $0xff,%esi
+  800395:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  80039c:	00 00 00 
+  80039f:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003a1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a7:	eb d9                	jmp    800382 <putch+0x22>
+
+00000000008003a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a9:	55                   	push   %rbp
+  8003aa:	48 89 e5             	mov    %rsp,%rbp
+  8003ad:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003b4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003be:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003cb:	48 89 f1             	mov    %rsi,%rcx
+  8003ce:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003d5:	48 bf 60 03 80 00 00 	movabs $0x800360,%rdi
+  8003dc:	00 00 00 
+  8003df:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  8003e6:	00 00 00 
+  8003e9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003eb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003f2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f9:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800405:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80040b:	c9                   	leave
+  80040c:	c3                   	ret
+
+000000000080040d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80040d:	55                   	push   %rbp
+  80040e:	48 89 e5             	mov    %rsp,%rbp
+  800411:	48 83 ec 50          	sub    $0x50,%rsp
+  800415:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800419:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80041d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800421:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800425:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800429:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800430:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800434:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800438:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80043c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800440:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800444:	48 b8 a9 03 80 00 00 	movabs $0x8003a9,%rax
+  80044b:	00 00 00 
+  80044e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800450:	c9                   	leave
+  800451:	c3                   	ret
+
+0000000000800452 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800452:	55                   	push   %rbp
+  800453:	48 89 e5             	mov    %rsp,%rbp
+  800456:	41 57                	push   %r15
+  800458:	41 56                	push   %r14
+  80045a:	41 55                	push   %r13
+  80045c:	41 54                	push   %r12
+  80045e:	53                   	push   %rbx
+  80045f:	48 83 ec 18          	sub    $0x18,%rsp
+  800463:	49 89 fc             	mov    %rdi,%r12
+  800466:	49 89 f5             	mov    %rsi,%r13
+  800469:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80046d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800470:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800473:	41 89 cf             	mov    %ecx,%r15d
+  800476:	4c 39 fa             	cmp    %r15,%rdx
+  800479:	73 5b                	jae    8004d6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80047b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80047f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800483:	85 db                	test   %ebx,%ebx
+  800485:	7e 0e                	jle    800495 <print_num+0x43>
+            putch(padc, put_arg);
+  800487:	4c 89 ee             	mov    %r13,%rsi
+  80048a:	44 89 f7             	mov    %r14d,%edi
+  80048d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800490:	83 eb 01             	sub    $0x1,%ebx
+  800493:	75 f2                	jne    800487 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800495:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800499:	48 b9 54 42 80 00 00 	movabs $0x804254,%rcx
+  8004a0:	00 00 00 
+  8004a3:	48 b8 43 42 80 00 00 	movabs $0x804243,%rax
+  8004aa:	00 00 00 
+  8004ad:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ba:	49 f7 f7             	div    %r15
+  8004bd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004c1:	4c 89 ee             	mov    %r13,%rsi
+  8004c4:	41 ff d4             	call   *%r12
+}
+  8004c7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004cb:	5b                   	pop    %rbx
+  8004cc:	41 5c                	pop    %r12
+  8004ce:	41 5d                	pop    %r13
+  8004d0:	41 5e                	pop    %r14
+  8004d2:	41 5f                	pop    %r15
+  8004d4:	5d                   	pop    %rbp
+  8004d5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004df:	49 f7 f7             	div    %r15
+  8004e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004ea:	52                   	push   %rdx
+  8004eb:	45 0f be c9          	movsbl %r9b,%r9d
+  8004ef:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004f3:	48 89 c2             	mov    %rax,%rdx
+  8004f6:	48 b8 52 04 80 00 00 	movabs $0x800452,%rax
+  8004fd:	00 00 00 
+  800500:	ff d0                	call   *%rax
+  800502:	48 83 c4 10          	add    $0x10,%rsp
+  800506:	eb 8d                	jmp    800495 <print_num+0x43>
+
+0000000000800508 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800508:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80050c:	48 8b 06             	mov    (%rsi),%rax
+  80050f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800513:	73 0a                	jae    80051f <sprintputch+0x17>
+        *state->start++ = ch;
+  800515:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800519:	48 89 16             	mov    %rdx,(%rsi)
+  80051c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80051f:	c3                   	ret
+
+0000000000800520 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800520:	55                   	push   %rbp
+  800521:	48 89 e5             	mov    %rsp,%rbp
+  800524:	48 83 ec 50          	sub    $0x50,%rsp
+  800528:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80052c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800530:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800534:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80053b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800543:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800547:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80054b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80054f:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  800556:	00 00 00 
+  800559:	ff d0                	call   *%rax
+}
+  80055b:	c9                   	leave
+  80055c:	c3                   	ret
+
+000000000080055d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	41 57                	push   %r15
+  800563:	41 56                	push   %r14
+  800565:	41 55                	push   %r13
+  800567:	41 54                	push   %r12
+  800569:	53                   	push   %rbx
+  80056a:	48 83 ec 38          	sub    $0x38,%rsp
+  80056e:	49 89 fe             	mov    %rdi,%r14
+  800571:	49 89 f5             	mov    %rsi,%r13
+  800574:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800577:	48 8b 01             	mov    (%rcx),%rax
+  80057a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80057e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800582:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800586:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80058a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80058e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800592:	0f b6 3b             	movzbl (%rbx),%edi
+  800595:	40 80 ff 25          	cmp    $0x25,%dil
+  800599:	74 18                	je     8005b3 <vprintfmt+0x56>
+            if (!ch) return;
+  80059b:	40 84 ff             	test   %dil,%dil
+  80059e:	0f 84 b1 06 00 00    	je     800c55 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005a4:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005ae:	4c 89 e3             	mov    %r12,%rbx
+  8005b1:	eb db                	jmp    80058e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005bc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ce:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005d2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005dc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005df:	83 e8 23             	sub    $0x23,%eax
+  8005e2:	3c 57                	cmp    $0x57,%al
+  8005e4:	0f 87 51 06 00 00    	ja     800c3b <vprintfmt+0x6de>
+  8005ea:	0f b6 c0             	movzbl %al,%eax
+  8005ed:	48 b9 e0 43 80 00 00 	movabs $0x8043e0,%rcx
+  8005f4:	00 00 00 
+  8005f7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005fa:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005fd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800601:	eb cf                	jmp    8005d2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800603:	49 89 dc             	mov    %rbx,%r12
+  800606:	be 01 00 00 00       	mov    $0x1,%esi
+  80060b:	eb c5                	jmp    8005d2 <vprintfmt+0x75>
+            padc = ch;
+  80060d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800611:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800614:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800617:	eb b9                	jmp    8005d2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800619:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061c:	83 f8 2f             	cmp    $0x2f,%eax
+  80061f:	77 24                	ja     800645 <vprintfmt+0xe8>
+  800621:	89 c1                	mov    %eax,%ecx
+  800623:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800627:	83 c0 08             	add    $0x8,%eax
+  80062a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800630:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800633:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800637:	79 99                	jns    8005d2 <vprintfmt+0x75>
+                width = precision;
+  800639:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80063d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800643:	eb 8d                	jmp    8005d2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800645:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800649:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80064d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800651:	eb da                	jmp    80062d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800653:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800658:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80065c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800662:	3c 39                	cmp    $0x39,%al
+  800664:	77 1c                	ja     800682 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800666:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80066a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80066e:	0f b6 c0             	movzbl %al,%eax
+  800671:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800676:	0f b6 03             	movzbl (%rbx),%eax
+  800679:	3c 39                	cmp    $0x39,%al
+  80067b:	76 e9                	jbe    800666 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80067d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800680:	eb b1                	jmp    800633 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800682:	49 89 dc             	mov    %rbx,%r12
+  800685:	eb ac                	jmp    800633 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800687:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80068a:	85 c9                	test   %ecx,%ecx
+  80068c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800691:	0f 49 c1             	cmovns %ecx,%eax
+  800694:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800697:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069a:	e9 33 ff ff ff       	jmp    8005d2 <vprintfmt+0x75>
+            lflag++;
+  80069f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a5:	e9 28 ff ff ff       	jmp    8005d2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b0:	77 19                	ja     8006cb <vprintfmt+0x16e>
+  8006b2:	89 c2                	mov    %eax,%edx
+  8006b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b8:	83 c0 08             	add    $0x8,%eax
+  8006bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006be:	8b 3a                	mov    (%rdx),%edi
+  8006c0:	4c 89 ee             	mov    %r13,%rsi
+  8006c3:	41 ff d6             	call   *%r14
+            break;
+  8006c6:	e9 c3 fe ff ff       	jmp    80058e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d7:	eb e5                	jmp    8006be <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006df:	77 5a                	ja     80073b <vprintfmt+0x1de>
+  8006e1:	89 c2                	mov    %eax,%edx
+  8006e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e7:	83 c0 08             	add    $0x8,%eax
+  8006ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006ed:	8b 02                	mov    (%rdx),%eax
+  8006ef:	89 c1                	mov    %eax,%ecx
+  8006f1:	f7 d9                	neg    %ecx
+  8006f3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006f6:	83 f9 14             	cmp    $0x14,%ecx
+  8006f9:	7f 4e                	jg     800749 <vprintfmt+0x1ec>
+  8006fb:	48 63 c1             	movslq %ecx,%rax
+  8006fe:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  800705:	00 00 00 
+  800708:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80070c:	48 85 c0             	test   %rax,%rax
+  80070f:	74 38                	je     800749 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800711:	48 89 c1             	mov    %rax,%rcx
+  800714:	48 ba 8d 49 80 00 00 	movabs $0x80498d,%rdx
+  80071b:	00 00 00 
+  80071e:	4c 89 ee             	mov    %r13,%rsi
+  800721:	4c 89 f7             	mov    %r14,%rdi
+  800724:	b8 00 00 00 00       	mov    $0x0,%eax
+  800729:	49 b8 20 05 80 00 00 	movabs $0x800520,%r8
+  800730:	00 00 00 
+  800733:	41 ff d0             	call   *%r8
+  800736:	e9 53 fe ff ff       	jmp    80058e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80073b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800743:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800747:	eb a4                	jmp    8006ed <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800749:	48 ba 6c 42 80 00 00 	movabs $0x80426c,%rdx
+  800750:	00 00 00 
+  800753:	4c 89 ee             	mov    %r13,%rsi
+  800756:	4c 89 f7             	mov    %r14,%rdi
+  800759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075e:	49 b8 20 05 80 00 00 	movabs $0x800520,%r8
+  800765:	00 00 00 
+  800768:	41 ff d0             	call   *%r8
+  80076b:	e9 1e fe ff ff       	jmp    80058e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800770:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800773:	83 f8 2f             	cmp    $0x2f,%eax
+  800776:	77 6c                	ja     8007e4 <vprintfmt+0x287>
+  800778:	89 c2                	mov    %eax,%edx
+  80077a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077e:	83 c0 08             	add    $0x8,%eax
+  800781:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800784:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800787:	48 85 d2             	test   %rdx,%rdx
+  80078a:	48 b8 65 42 80 00 00 	movabs $0x804265,%rax
+  800791:	00 00 00 
+  800794:	48 0f 45 c2          	cmovne %rdx,%rax
+  800798:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80079c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a0:	7e 06                	jle    8007a8 <vprintfmt+0x24b>
+  8007a2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007a6:	75 4a                	jne    8007f2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007ac:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007b0:	0f b6 00             	movzbl (%rax),%eax
+  8007b3:	84 c0                	test   %al,%al
+  8007b5:	0f 85 9a 00 00 00    	jne    800855 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007bb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007be:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007c2:	85 c0                	test   %eax,%eax
+  8007c4:	0f 8e c4 fd ff ff    	jle    80058e <vprintfmt+0x31>
+  8007ca:	4c 89 ee             	mov    %r13,%rsi
+  8007cd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007d2:	41 ff d6             	call   *%r14
+  8007d5:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007dd:	75 eb                	jne    8007ca <vprintfmt+0x26d>
+  8007df:	e9 aa fd ff ff       	jmp    80058e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f0:	eb 92                	jmp    800784 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007f2:	49 63 f7             	movslq %r15d,%rsi
+  8007f5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007f9:	48 b8 0f 0d 80 00 00 	movabs $0x800d0f,%rax
+  800800:	00 00 00 
+  800803:	ff d0                	call   *%rax
+  800805:	48 89 c2             	mov    %rax,%rdx
+  800808:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80080d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800810:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800813:	85 c0                	test   %eax,%eax
+  800815:	7e 91                	jle    8007a8 <vprintfmt+0x24b>
+  800817:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80081c:	4c 89 ee             	mov    %r13,%rsi
+  80081f:	44 89 e7             	mov    %r12d,%edi
+  800822:	41 ff d6             	call   *%r14
+  800825:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800829:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80082c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80082f:	75 eb                	jne    80081c <vprintfmt+0x2bf>
+  800831:	e9 72 ff ff ff       	jmp    8007a8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800836:	0f b6 f8             	movzbl %al,%edi
+  800839:	4c 89 ee             	mov    %r13,%rsi
+  80083c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80083f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800843:	49 83 c4 01          	add    $0x1,%r12
+  800847:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80084d:	84 c0                	test   %al,%al
+  80084f:	0f 84 66 ff ff ff    	je     8007bb <vprintfmt+0x25e>
+  800855:	45 85 ff             	test   %r15d,%r15d
+  800858:	78 0a                	js     800864 <vprintfmt+0x307>
+  80085a:	41 83 ef 01          	sub    $0x1,%r15d
+  80085e:	0f 88 57 ff ff ff    	js     8007bb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800864:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800868:	74 cc                	je     800836 <vprintfmt+0x2d9>
+  80086a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80086d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800872:	80 fa 5e             	cmp    $0x5e,%dl
+  800875:	77 c2                	ja     800839 <vprintfmt+0x2dc>
+  800877:	eb bd                	jmp    800836 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800879:	40 84 f6             	test   %sil,%sil
+  80087c:	75 26                	jne    8008a4 <vprintfmt+0x347>
+    switch (lflag) {
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	74 59                	je     8008db <vprintfmt+0x37e>
+  800882:	83 fa 01             	cmp    $0x1,%edx
+  800885:	74 7b                	je     800902 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800887:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088a:	83 f8 2f             	cmp    $0x2f,%eax
+  80088d:	0f 87 96 00 00 00    	ja     800929 <vprintfmt+0x3cc>
+  800893:	89 c2                	mov    %eax,%edx
+  800895:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800899:	83 c0 08             	add    $0x8,%eax
+  80089c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089f:	4c 8b 22             	mov    (%rdx),%r12
+  8008a2:	eb 17                	jmp    8008bb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008aa:	77 21                	ja     8008cd <vprintfmt+0x370>
+  8008ac:	89 c2                	mov    %eax,%edx
+  8008ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b2:	83 c0 08             	add    $0x8,%eax
+  8008b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008bb:	4d 85 e4             	test   %r12,%r12
+  8008be:	78 7a                	js     80093a <vprintfmt+0x3dd>
+            num = i;
+  8008c0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008c8:	e9 50 02 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	eb dd                	jmp    8008b8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	77 11                	ja     8008f4 <vprintfmt+0x397>
+  8008e3:	89 c2                	mov    %eax,%edx
+  8008e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e9:	83 c0 08             	add    $0x8,%eax
+  8008ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ef:	4c 63 22             	movslq (%rdx),%r12
+  8008f2:	eb c7                	jmp    8008bb <vprintfmt+0x35e>
+  8008f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800900:	eb ed                	jmp    8008ef <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800902:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800905:	83 f8 2f             	cmp    $0x2f,%eax
+  800908:	77 11                	ja     80091b <vprintfmt+0x3be>
+  80090a:	89 c2                	mov    %eax,%edx
+  80090c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800910:	83 c0 08             	add    $0x8,%eax
+  800913:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800916:	4c 8b 22             	mov    (%rdx),%r12
+  800919:	eb a0                	jmp    8008bb <vprintfmt+0x35e>
+  80091b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800923:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800927:	eb ed                	jmp    800916 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800929:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800931:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800935:	e9 65 ff ff ff       	jmp    80089f <vprintfmt+0x342>
+                putch('-', put_arg);
+  80093a:	4c 89 ee             	mov    %r13,%rsi
+  80093d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800942:	41 ff d6             	call   *%r14
+                i = -i;
+  800945:	49 f7 dc             	neg    %r12
+  800948:	e9 73 ff ff ff       	jmp    8008c0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80094d:	40 84 f6             	test   %sil,%sil
+  800950:	75 32                	jne    800984 <vprintfmt+0x427>
+    switch (lflag) {
+  800952:	85 d2                	test   %edx,%edx
+  800954:	74 5d                	je     8009b3 <vprintfmt+0x456>
+  800956:	83 fa 01             	cmp    $0x1,%edx
+  800959:	0f 84 82 00 00 00    	je     8009e1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	0f 87 a5 00 00 00    	ja     800a10 <vprintfmt+0x4b3>
+  80096b:	89 c2                	mov    %eax,%edx
+  80096d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800971:	83 c0 08             	add    $0x8,%eax
+  800974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800977:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80097a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80097f:	e9 99 01 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800987:	83 f8 2f             	cmp    $0x2f,%eax
+  80098a:	77 19                	ja     8009a5 <vprintfmt+0x448>
+  80098c:	89 c2                	mov    %eax,%edx
+  80098e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800992:	83 c0 08             	add    $0x8,%eax
+  800995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800998:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80099b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009a0:	e9 78 01 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+  8009a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b1:	eb e5                	jmp    800998 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b9:	77 18                	ja     8009d3 <vprintfmt+0x476>
+  8009bb:	89 c2                	mov    %eax,%edx
+  8009bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c1:	83 c0 08             	add    $0x8,%eax
+  8009c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ce:	e9 4a 01 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+  8009d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb e6                	jmp    8009c7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 19                	ja     800a02 <vprintfmt+0x4a5>
+  8009e9:	89 c2                	mov    %eax,%edx
+  8009eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009fd:	e9 1b 01 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+  800a02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0e:	eb e5                	jmp    8009f5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1c:	e9 56 ff ff ff       	jmp    800977 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a21:	40 84 f6             	test   %sil,%sil
+  800a24:	75 2e                	jne    800a54 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 59                	je     800a83 <vprintfmt+0x526>
+  800a2a:	83 fa 01             	cmp    $0x1,%edx
+  800a2d:	74 7f                	je     800aae <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	0f 87 9f 00 00 00    	ja     800ada <vprintfmt+0x57d>
+  800a3b:	89 c2                	mov    %eax,%edx
+  800a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a4a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4f:	e9 c9 00 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a57:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5a:	77 19                	ja     800a75 <vprintfmt+0x518>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a6b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a70:	e9 a8 00 00 00       	jmp    800b1d <vprintfmt+0x5c0>
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb e5                	jmp    800a68 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 15                	ja     800aa0 <vprintfmt+0x543>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a99:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a9e:	eb 7d                	jmp    800b1d <vprintfmt+0x5c0>
+  800aa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aac:	eb e9                	jmp    800a97 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab4:	77 16                	ja     800acc <vprintfmt+0x56f>
+  800ab6:	89 c2                	mov    %eax,%edx
+  800ab8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abc:	83 c0 08             	add    $0x8,%eax
+  800abf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ac5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800aca:	eb 51                	jmp    800b1d <vprintfmt+0x5c0>
+  800acc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad8:	eb e8                	jmp    800ac2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ada:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ade:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae6:	e9 5c ff ff ff       	jmp    800a47 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800aeb:	4c 89 ee             	mov    %r13,%rsi
+  800aee:	bf 30 00 00 00       	mov    $0x30,%edi
+  800af3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800af6:	4c 89 ee             	mov    %r13,%rsi
+  800af9:	bf 78 00 00 00       	mov    $0x78,%edi
+  800afe:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b04:	83 f8 2f             	cmp    $0x2f,%eax
+  800b07:	77 47                	ja     800b50 <vprintfmt+0x5f3>
+  800b09:	89 c2                	mov    %eax,%edx
+  800b0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0f:	83 c0 08             	add    $0x8,%eax
+  800b12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b15:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b18:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b1d:	48 83 ec 08          	sub    $0x8,%rsp
+  800b21:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b25:	0f 94 c0             	sete   %al
+  800b28:	0f b6 c0             	movzbl %al,%eax
+  800b2b:	50                   	push   %rax
+  800b2c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b31:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b35:	4c 89 ee             	mov    %r13,%rsi
+  800b38:	4c 89 f7             	mov    %r14,%rdi
+  800b3b:	48 b8 52 04 80 00 00 	movabs $0x800452,%rax
+  800b42:	00 00 00 
+  800b45:	ff d0                	call   *%rax
+            break;
+  800b47:	48 83 c4 10          	add    $0x10,%rsp
+  800b4b:	e9 3e fa ff ff       	jmp    80058e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5c:	eb b7                	jmp    800b15 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5e:	40 84 f6             	test   %sil,%sil
+  800b61:	75 2b                	jne    800b8e <vprintfmt+0x631>
+    switch (lflag) {
+  800b63:	85 d2                	test   %edx,%edx
+  800b65:	74 56                	je     800bbd <vprintfmt+0x660>
+  800b67:	83 fa 01             	cmp    $0x1,%edx
+  800b6a:	74 7f                	je     800beb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b72:	0f 87 a2 00 00 00    	ja     800c1a <vprintfmt+0x6bd>
+  800b78:	89 c2                	mov    %eax,%edx
+  800b7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7e:	83 c0 08             	add    $0x8,%eax
+  800b81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b87:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b8c:	eb 8f                	jmp    800b1d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b91:	83 f8 2f             	cmp    $0x2f,%eax
+  800b94:	77 19                	ja     800baf <vprintfmt+0x652>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9c:	83 c0 08             	add    $0x8,%eax
+  800b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800baa:	e9 6e ff ff ff       	jmp    800b1d <vprintfmt+0x5c0>
+  800baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	eb e5                	jmp    800ba2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc3:	77 18                	ja     800bdd <vprintfmt+0x680>
+  800bc5:	89 c2                	mov    %eax,%edx
+  800bc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcb:	83 c0 08             	add    $0x8,%eax
+  800bce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bd3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd8:	e9 40 ff ff ff       	jmp    800b1d <vprintfmt+0x5c0>
+  800bdd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be9:	eb e6                	jmp    800bd1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800beb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bee:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf1:	77 19                	ja     800c0c <vprintfmt+0x6af>
+  800bf3:	89 c2                	mov    %eax,%edx
+  800bf5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf9:	83 c0 08             	add    $0x8,%eax
+  800bfc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c02:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c07:	e9 11 ff ff ff       	jmp    800b1d <vprintfmt+0x5c0>
+  800c0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c18:	eb e5                	jmp    800bff <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c26:	e9 59 ff ff ff       	jmp    800b84 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c2b:	4c 89 ee             	mov    %r13,%rsi
+  800c2e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c33:	41 ff d6             	call   *%r14
+            break;
+  800c36:	e9 53 f9 ff ff       	jmp    80058e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c3b:	4c 89 ee             	mov    %r13,%rsi
+  800c3e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c43:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c46:	48 83 eb 01          	sub    $0x1,%rbx
+  800c4a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c4e:	75 f6                	jne    800c46 <vprintfmt+0x6e9>
+  800c50:	e9 39 f9 ff ff       	jmp    80058e <vprintfmt+0x31>
+}
+  800c55:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c59:	5b                   	pop    %rbx
+  800c5a:	41 5c                	pop    %r12
+  800c5c:	41 5d                	pop    %r13
+  800c5e:	41 5e                	pop    %r14
+  800c60:	41 5f                	pop    %r15
+  800c62:	5d                   	pop    %rbp
+  800c63:	c3                   	ret
+
+0000000000800c64 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c64:	55                   	push   %rbp
+  800c65:	48 89 e5             	mov    %rsp,%rbp
+  800c68:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c70:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c79:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c80:	48 85 ff             	test   %rdi,%rdi
+  800c83:	74 2b                	je     800cb0 <vsnprintf+0x4c>
+  800c85:	48 85 f6             	test   %rsi,%rsi
+  800c88:	74 26                	je     800cb0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c8e:	48 bf 08 05 80 00 00 	movabs $0x800508,%rdi
+  800c95:	00 00 00 
+  800c98:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  800c9f:	00 00 00 
+  800ca2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cae:	c9                   	leave
+  800caf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb5:	eb f7                	jmp    800cae <vsnprintf+0x4a>
+
+0000000000800cb7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cb7:	55                   	push   %rbp
+  800cb8:	48 89 e5             	mov    %rsp,%rbp
+  800cbb:	48 83 ec 50          	sub    $0x50,%rsp
+  800cbf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cc3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cc7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ccb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cd2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cda:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cde:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ce2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ce6:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800ced:	00 00 00 
+  800cf0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cf2:	c9                   	leave
+  800cf3:	c3                   	ret
+
+0000000000800cf4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cf4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cf7:	74 10                	je     800d09 <strlen+0x15>
+    size_t n = 0;
+  800cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cfe:	48 83 c0 01          	add    $0x1,%rax
+  800d02:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d06:	75 f6                	jne    800cfe <strlen+0xa>
+  800d08:	c3                   	ret
+    size_t n = 0;
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d0e:	c3                   	ret
+
+0000000000800d0f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d0f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d12:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d17:	48 85 f6             	test   %rsi,%rsi
+  800d1a:	74 11                	je     800d2d <strnlen+0x1e>
+  800d1c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d20:	74 0c                	je     800d2e <strnlen+0x1f>
+  800d22:	48 83 c2 01          	add    $0x1,%rdx
+  800d26:	48 39 d0             	cmp    %rdx,%rax
+  800d29:	75 f1                	jne    800d1c <strnlen+0xd>
+  800d2b:	eb 04                	jmp    800d31 <strnlen+0x22>
+  800d2d:	c3                   	ret
+  800d2e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d31:	c3                   	ret
+
+0000000000800d32 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d32:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d3e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d41:	48 83 c2 01          	add    $0x1,%rdx
+  800d45:	84 c9                	test   %cl,%cl
+  800d47:	75 f1                	jne    800d3a <strcpy+0x8>
+        ;
+    return res;
+}
+  800d49:	c3                   	ret
+
+0000000000800d4a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d4a:	55                   	push   %rbp
+  800d4b:	48 89 e5             	mov    %rsp,%rbp
+  800d4e:	41 54                	push   %r12
+  800d50:	53                   	push   %rbx
+  800d51:	48 89 fb             	mov    %rdi,%rbx
+  800d54:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d57:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  800d5e:	00 00 00 
+  800d61:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d63:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d67:	4c 89 e6             	mov    %r12,%rsi
+  800d6a:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+    return dst;
+}
+  800d76:	48 89 d8             	mov    %rbx,%rax
+  800d79:	5b                   	pop    %rbx
+  800d7a:	41 5c                	pop    %r12
+  800d7c:	5d                   	pop    %rbp
+  800d7d:	c3                   	ret
+
+0000000000800d7e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d7e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d81:	48 85 d2             	test   %rdx,%rdx
+  800d84:	74 1f                	je     800da5 <strncpy+0x27>
+  800d86:	48 01 fa             	add    %rdi,%rdx
+  800d89:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d8c:	48 83 c1 01          	add    $0x1,%rcx
+  800d90:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d94:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d98:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d9c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800da0:	48 39 ca             	cmp    %rcx,%rdx
+  800da3:	75 e7                	jne    800d8c <strncpy+0xe>
+    }
+    return ret;
+}
+  800da5:	c3                   	ret
+
+0000000000800da6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800da6:	48 89 f8             	mov    %rdi,%rax
+  800da9:	48 85 d2             	test   %rdx,%rdx
+  800dac:	74 24                	je     800dd2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dae:	48 83 ea 01          	sub    $0x1,%rdx
+  800db2:	74 1b                	je     800dcf <strlcpy+0x29>
+  800db4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800db8:	0f b6 16             	movzbl (%rsi),%edx
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	74 10                	je     800dcf <strlcpy+0x29>
+            *dst++ = *src++;
+  800dbf:	48 83 c6 01          	add    $0x1,%rsi
+  800dc3:	48 83 c0 01          	add    $0x1,%rax
+  800dc7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dca:	48 39 c8             	cmp    %rcx,%rax
+  800dcd:	75 e9                	jne    800db8 <strlcpy+0x12>
+        *dst = '\0';
+  800dcf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dd2:	48 29 f8             	sub    %rdi,%rax
+}
+  800dd5:	c3                   	ret
+
+0000000000800dd6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dd6:	0f b6 07             	movzbl (%rdi),%eax
+  800dd9:	84 c0                	test   %al,%al
+  800ddb:	74 13                	je     800df0 <strcmp+0x1a>
+  800ddd:	38 06                	cmp    %al,(%rsi)
+  800ddf:	75 0f                	jne    800df0 <strcmp+0x1a>
+  800de1:	48 83 c7 01          	add    $0x1,%rdi
+  800de5:	48 83 c6 01          	add    $0x1,%rsi
+  800de9:	0f b6 07             	movzbl (%rdi),%eax
+  800dec:	84 c0                	test   %al,%al
+  800dee:	75 ed                	jne    800ddd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800df0:	0f b6 c0             	movzbl %al,%eax
+  800df3:	0f b6 16             	movzbl (%rsi),%edx
+  800df6:	29 d0                	sub    %edx,%eax
+}
+  800df8:	c3                   	ret
+
+0000000000800df9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800df9:	48 85 d2             	test   %rdx,%rdx
+  800dfc:	74 1f                	je     800e1d <strncmp+0x24>
+  800dfe:	0f b6 07             	movzbl (%rdi),%eax
+  800e01:	84 c0                	test   %al,%al
+  800e03:	74 1e                	je     800e23 <strncmp+0x2a>
+  800e05:	3a 06                	cmp    (%rsi),%al
+  800e07:	75 1a                	jne    800e23 <strncmp+0x2a>
+  800e09:	48 83 c7 01          	add    $0x1,%rdi
+  800e0d:	48 83 c6 01          	add    $0x1,%rsi
+  800e11:	48 83 ea 01          	sub    $0x1,%rdx
+  800e15:	75 e7                	jne    800dfe <strncmp+0x5>
+
+    if (!n) return 0;
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	c3                   	ret
+  800e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e22:	c3                   	ret
+  800e23:	48 85 d2             	test   %rdx,%rdx
+  800e26:	74 09                	je     800e31 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e28:	0f b6 07             	movzbl (%rdi),%eax
+  800e2b:	0f b6 16             	movzbl (%rsi),%edx
+  800e2e:	29 d0                	sub    %edx,%eax
+  800e30:	c3                   	ret
+    if (!n) return 0;
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e36:	c3                   	ret
+
+0000000000800e37 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e37:	0f b6 17             	movzbl (%rdi),%edx
+  800e3a:	84 d2                	test   %dl,%dl
+  800e3c:	74 18                	je     800e56 <strchr+0x1f>
+        if (*str == c) {
+  800e3e:	0f be d2             	movsbl %dl,%edx
+  800e41:	39 f2                	cmp    %esi,%edx
+  800e43:	74 17                	je     800e5c <strchr+0x25>
+    for (; *str; str++) {
+  800e45:	48 83 c7 01          	add    $0x1,%rdi
+  800e49:	0f b6 17             	movzbl (%rdi),%edx
+  800e4c:	84 d2                	test   %dl,%dl
+  800e4e:	75 ee                	jne    800e3e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e55:	c3                   	ret
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	c3                   	ret
+  800e5c:	48 89 f8             	mov    %rdi,%rax
+}
+  800e5f:	c3                   	ret
+
+0000000000800e60 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e60:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e63:	0f b6 17             	movzbl (%rdi),%edx
+  800e66:	84 d2                	test   %dl,%dl
+  800e68:	74 13                	je     800e7d <strfind+0x1d>
+  800e6a:	0f be d2             	movsbl %dl,%edx
+  800e6d:	39 f2                	cmp    %esi,%edx
+  800e6f:	74 0b                	je     800e7c <strfind+0x1c>
+  800e71:	48 83 c0 01          	add    $0x1,%rax
+  800e75:	0f b6 10             	movzbl (%rax),%edx
+  800e78:	84 d2                	test   %dl,%dl
+  800e7a:	75 ee                	jne    800e6a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e7c:	c3                   	ret
+  800e7d:	c3                   	ret
+
+0000000000800e7e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e7e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e81:	48 89 f8             	mov    %rdi,%rax
+  800e84:	48 f7 d8             	neg    %rax
+  800e87:	83 e0 07             	and    $0x7,%eax
+  800e8a:	49 89 d1             	mov    %rdx,%r9
+  800e8d:	49 29 c1             	sub    %rax,%r9
+  800e90:	78 36                	js     800ec8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e92:	40 0f b6 c6          	movzbl %sil,%eax
+  800e96:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e9d:	01 01 01 
+  800ea0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ea4:	40 f6 c7 07          	test   $0x7,%dil
+  800ea8:	75 38                	jne    800ee2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800eaa:	4c 89 c9             	mov    %r9,%rcx
+  800ead:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eb1:	74 0c                	je     800ebf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eb3:	fc                   	cld
+  800eb4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eb7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ebb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ebf:	4d 85 c9             	test   %r9,%r9
+  800ec2:	75 45                	jne    800f09 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ec4:	4c 89 c0             	mov    %r8,%rax
+  800ec7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ec8:	48 85 d2             	test   %rdx,%rdx
+  800ecb:	74 f7                	je     800ec4 <memset+0x46>
+  800ecd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ed0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ed3:	48 83 c0 01          	add    $0x1,%rax
+  800ed7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800edb:	48 39 c2             	cmp    %rax,%rdx
+  800ede:	75 f3                	jne    800ed3 <memset+0x55>
+  800ee0:	eb e2                	jmp    800ec4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ee2:	40 f6 c7 01          	test   $0x1,%dil
+  800ee6:	74 06                	je     800eee <memset+0x70>
+  800ee8:	88 07                	mov    %al,(%rdi)
+  800eea:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eee:	40 f6 c7 02          	test   $0x2,%dil
+  800ef2:	74 07                	je     800efb <memset+0x7d>
+  800ef4:	66 89 07             	mov    %ax,(%rdi)
+  800ef7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800efb:	40 f6 c7 04          	test   $0x4,%dil
+  800eff:	74 a9                	je     800eaa <memset+0x2c>
+  800f01:	89 07                	mov    %eax,(%rdi)
+  800f03:	48 83 c7 04          	add    $0x4,%rdi
+  800f07:	eb a1                	jmp    800eaa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f09:	41 f6 c1 04          	test   $0x4,%r9b
+  800f0d:	74 06                	je     800f15 <memset+0x97>
+  800f0f:	89 07                	mov    %eax,(%rdi)
+  800f11:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f15:	41 f6 c1 02          	test   $0x2,%r9b
+  800f19:	74 07                	je     800f22 <memset+0xa4>
+  800f1b:	66 89 07             	mov    %ax,(%rdi)
+  800f1e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f22:	41 f6 c1 01          	test   $0x1,%r9b
+  800f26:	74 9c                	je     800ec4 <memset+0x46>
+  800f28:	88 07                	mov    %al,(%rdi)
+  800f2a:	eb 98                	jmp    800ec4 <memset+0x46>
+
+0000000000800f2c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f2c:	48 89 f8             	mov    %rdi,%rax
+  800f2f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f32:	48 39 fe             	cmp    %rdi,%rsi
+  800f35:	73 3b                	jae    800f72 <memmove+0x46>
+  800f37:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f3b:	48 39 d7             	cmp    %rdx,%rdi
+  800f3e:	73 32                	jae    800f72 <memmove+0x46>
+        s += n;
+        d += n;
+  800f40:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f44:	48 89 d6             	mov    %rdx,%rsi
+  800f47:	48 09 fe             	or     %rdi,%rsi
+  800f4a:	48 09 ce             	or     %rcx,%rsi
+  800f4d:	40 f6 c6 07          	test   $0x7,%sil
+  800f51:	75 12                	jne    800f65 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f53:	48 83 ef 08          	sub    $0x8,%rdi
+  800f57:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f5b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f5f:	fd                   	std
+  800f60:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f63:	fc                   	cld
+  800f64:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f65:	48 83 ef 01          	sub    $0x1,%rdi
+  800f69:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f6d:	fd                   	std
+  800f6e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f70:	eb f1                	jmp    800f63 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f72:	48 89 f2             	mov    %rsi,%rdx
+  800f75:	48 09 c2             	or     %rax,%rdx
+  800f78:	48 09 ca             	or     %rcx,%rdx
+  800f7b:	f6 c2 07             	test   $0x7,%dl
+  800f7e:	75 0c                	jne    800f8c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f80:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f84:	48 89 c7             	mov    %rax,%rdi
+  800f87:	fc                   	cld
+  800f88:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f8b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f8c:	48 89 c7             	mov    %rax,%rdi
+  800f8f:	fc                   	cld
+  800f90:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f92:	c3                   	ret
+
+0000000000800f93 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f97:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  800f9e:	00 00 00 
+  800fa1:	ff d0                	call   *%rax
+}
+  800fa3:	5d                   	pop    %rbp
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fa5:	55                   	push   %rbp
+  800fa6:	48 89 e5             	mov    %rsp,%rbp
+  800fa9:	41 57                	push   %r15
+  800fab:	41 56                	push   %r14
+  800fad:	41 55                	push   %r13
+  800faf:	41 54                	push   %r12
+  800fb1:	53                   	push   %rbx
+  800fb2:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb6:	49 89 fe             	mov    %rdi,%r14
+  800fb9:	49 89 f7             	mov    %rsi,%r15
+  800fbc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fbf:	48 89 f7             	mov    %rsi,%rdi
+  800fc2:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  800fc9:	00 00 00 
+  800fcc:	ff d0                	call   *%rax
+  800fce:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fd1:	48 89 de             	mov    %rbx,%rsi
+  800fd4:	4c 89 f7             	mov    %r14,%rdi
+  800fd7:	48 b8 0f 0d 80 00 00 	movabs $0x800d0f,%rax
+  800fde:	00 00 00 
+  800fe1:	ff d0                	call   *%rax
+  800fe3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe6:	48 39 c3             	cmp    %rax,%rbx
+  800fe9:	74 36                	je     801021 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800feb:	48 89 d8             	mov    %rbx,%rax
+  800fee:	4c 29 e8             	sub    %r13,%rax
+  800ff1:	49 39 c4             	cmp    %rax,%r12
+  800ff4:	73 31                	jae    801027 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ff6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ffb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fff:	4c 89 fe             	mov    %r15,%rsi
+  801002:	48 b8 93 0f 80 00 00 	movabs $0x800f93,%rax
+  801009:	00 00 00 
+  80100c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80100e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801012:	48 83 c4 08          	add    $0x8,%rsp
+  801016:	5b                   	pop    %rbx
+  801017:	41 5c                	pop    %r12
+  801019:	41 5d                	pop    %r13
+  80101b:	41 5e                	pop    %r14
+  80101d:	41 5f                	pop    %r15
+  80101f:	5d                   	pop    %rbp
+  801020:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801021:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801025:	eb eb                	jmp    801012 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801027:	48 83 eb 01          	sub    $0x1,%rbx
+  80102b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80102f:	48 89 da             	mov    %rbx,%rdx
+  801032:	4c 89 fe             	mov    %r15,%rsi
+  801035:	48 b8 93 0f 80 00 00 	movabs $0x800f93,%rax
+  80103c:	00 00 00 
+  80103f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801041:	49 01 de             	add    %rbx,%r14
+  801044:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801049:	eb c3                	jmp    80100e <strlcat+0x69>
+
+000000000080104b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80104b:	48 85 d2             	test   %rdx,%rdx
+  80104e:	74 2d                	je     80107d <memcmp+0x32>
+  801050:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801055:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801059:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80105e:	44 38 c1             	cmp    %r8b,%cl
+  801061:	75 0f                	jne    801072 <memcmp+0x27>
+    while (n-- > 0) {
+  801063:	48 83 c0 01          	add    $0x1,%rax
+  801067:	48 39 c2             	cmp    %rax,%rdx
+  80106a:	75 e9                	jne    801055 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80106c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801071:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801072:	0f b6 c1             	movzbl %cl,%eax
+  801075:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801079:	44 29 c0             	sub    %r8d,%eax
+  80107c:	c3                   	ret
+    return 0;
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801082:	c3                   	ret
+
+0000000000801083 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801083:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801087:	48 39 c7             	cmp    %rax,%rdi
+  80108a:	73 0f                	jae    80109b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80108c:	40 38 37             	cmp    %sil,(%rdi)
+  80108f:	74 0e                	je     80109f <memfind+0x1c>
+    for (; src < end; src++) {
+  801091:	48 83 c7 01          	add    $0x1,%rdi
+  801095:	48 39 f8             	cmp    %rdi,%rax
+  801098:	75 f2                	jne    80108c <memfind+0x9>
+  80109a:	c3                   	ret
+  80109b:	48 89 f8             	mov    %rdi,%rax
+  80109e:	c3                   	ret
+  80109f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010a2:	c3                   	ret
+
+00000000008010a3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010a3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010a6:	0f b6 37             	movzbl (%rdi),%esi
+  8010a9:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ad:	74 06                	je     8010b5 <strtol+0x12>
+  8010af:	40 80 fe 09          	cmp    $0x9,%sil
+  8010b3:	75 13                	jne    8010c8 <strtol+0x25>
+  8010b5:	48 83 c7 01          	add    $0x1,%rdi
+  8010b9:	0f b6 37             	movzbl (%rdi),%esi
+  8010bc:	40 80 fe 20          	cmp    $0x20,%sil
+  8010c0:	74 f3                	je     8010b5 <strtol+0x12>
+  8010c2:	40 80 fe 09          	cmp    $0x9,%sil
+  8010c6:	74 ed                	je     8010b5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010c8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010cb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ce:	3c 01                	cmp    $0x1,%al
+  8010d0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010da:	75 0f                	jne    8010eb <strtol+0x48>
+  8010dc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010df:	74 14                	je     8010f5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010e1:	85 d2                	test   %edx,%edx
+  8010e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010eb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010f0:	4c 63 ca             	movslq %edx,%r9
+  8010f3:	eb 36                	jmp    80112b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010f5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010f9:	74 0f                	je     80110a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010fb:	85 d2                	test   %edx,%edx
+  8010fd:	75 ec                	jne    8010eb <strtol+0x48>
+        s++;
+  8010ff:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801103:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801108:	eb e1                	jmp    8010eb <strtol+0x48>
+        s += 2;
+  80110a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80110e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801113:	eb d6                	jmp    8010eb <strtol+0x48>
+            dig -= '0';
+  801115:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801118:	44 0f b6 c1          	movzbl %cl,%r8d
+  80111c:	41 39 d0             	cmp    %edx,%r8d
+  80111f:	7d 21                	jge    801142 <strtol+0x9f>
+        val = val * base + dig;
+  801121:	49 0f af c1          	imul   %r9,%rax
+  801125:	0f b6 c9             	movzbl %cl,%ecx
+  801128:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80112b:	48 83 c7 01          	add    $0x1,%rdi
+  80112f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801133:	80 f9 39             	cmp    $0x39,%cl
+  801136:	76 dd                	jbe    801115 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801138:	80 f9 7b             	cmp    $0x7b,%cl
+  80113b:	77 05                	ja     801142 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80113d:	83 e9 57             	sub    $0x57,%ecx
+  801140:	eb d6                	jmp    801118 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801142:	4d 85 d2             	test   %r10,%r10
+  801145:	74 03                	je     80114a <strtol+0xa7>
+  801147:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80114a:	48 89 c2             	mov    %rax,%rdx
+  80114d:	48 f7 da             	neg    %rdx
+  801150:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801154:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801158:	c3                   	ret
+
+0000000000801159 <strrev>:
+
+void
+strrev(char *str)
+{
+  801159:	55                   	push   %rbp
+  80115a:	48 89 e5             	mov    %rsp,%rbp
+  80115d:	53                   	push   %rbx
+  80115e:	48 83 ec 08          	sub    $0x8,%rsp
+  801162:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801165:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  80116c:	00 00 00 
+  80116f:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801171:	83 e8 01             	sub    $0x1,%eax
+  801174:	85 c0                	test   %eax,%eax
+  801176:	7e 22                	jle    80119a <strrev+0x41>
+  801178:	48 98                	cltq
+  80117a:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80117f:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801183:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801187:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80118b:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80118e:	48 83 c2 01          	add    $0x1,%rdx
+  801192:	48 83 e8 01          	sub    $0x1,%rax
+  801196:	39 c2                	cmp    %eax,%edx
+  801198:	7c e5                	jl     80117f <strrev+0x26>
+	}
+}
+  80119a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119e:	c9                   	leave
+  80119f:	c3                   	ret
+
+00000000008011a0 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8011a0:	85 d2                	test   %edx,%edx
+  8011a2:	0f 84 80 00 00 00    	je     801228 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8011a8:	55                   	push   %rbp
+  8011a9:	48 89 e5             	mov    %rsp,%rbp
+  8011ac:	53                   	push   %rbx
+  8011ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b1:	49 89 f2             	mov    %rsi,%r10
+  8011b4:	41 89 d3             	mov    %edx,%r11d
+  8011b7:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8011ba:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8011bf:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8011c2:	eb 20                	jmp    8011e4 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8011c4:	41 89 f1             	mov    %esi,%r9d
+  8011c7:	83 c2 30             	add    $0x30,%edx
+  8011ca:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8011cd:	89 f8                	mov    %edi,%eax
+  8011cf:	99                   	cltd
+  8011d0:	f7 f9                	idiv   %ecx
+  8011d2:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	74 2e                	je     801206 <itoa+0x66>
+  8011d8:	83 c6 01             	add    $0x1,%esi
+  8011db:	49 83 c0 01          	add    $0x1,%r8
+  8011df:	44 39 cb             	cmp    %r9d,%ebx
+  8011e2:	7e 15                	jle    8011f9 <itoa+0x59>
+		digit = sum % base;
+  8011e4:	89 f8                	mov    %edi,%eax
+  8011e6:	99                   	cltd
+  8011e7:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8011e9:	83 fa 09             	cmp    $0x9,%edx
+  8011ec:	7e d6                	jle    8011c4 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8011ee:	41 89 f1             	mov    %esi,%r9d
+  8011f1:	83 c2 37             	add    $0x37,%edx
+  8011f4:	41 88 10             	mov    %dl,(%r8)
+  8011f7:	eb d4                	jmp    8011cd <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8011f9:	41 83 eb 01          	sub    $0x1,%r11d
+  8011fd:	45 39 cb             	cmp    %r9d,%r11d
+  801200:	75 04                	jne    801206 <itoa+0x66>
+  801202:	85 c0                	test   %eax,%eax
+  801204:	75 28                	jne    80122e <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801206:	4d 63 c9             	movslq %r9d,%r9
+  801209:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80120e:	4c 89 d7             	mov    %r10,%rdi
+  801211:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  801218:	00 00 00 
+  80121b:	ff d0                	call   *%rax
+	return 0;
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+		return -1;
+  801228:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80122d:	c3                   	ret
+		return -1;
+  80122e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801233:	eb ed                	jmp    801222 <itoa+0x82>
+
+0000000000801235 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801235:	55                   	push   %rbp
+  801236:	48 89 e5             	mov    %rsp,%rbp
+  801239:	53                   	push   %rbx
+  80123a:	48 89 fa             	mov    %rdi,%rdx
+  80123d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801240:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124f:	be 00 00 00 00       	mov    $0x0,%esi
+  801254:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80125c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801260:	c9                   	leave
+  801261:	c3                   	ret
+
+0000000000801262 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801262:	55                   	push   %rbp
+  801263:	48 89 e5             	mov    %rsp,%rbp
+  801266:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801267:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801271:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+  801285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80128d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801291:	c9                   	leave
+  801292:	c3                   	ret
+
+0000000000801293 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801293:	55                   	push   %rbp
+  801294:	48 89 e5             	mov    %rsp,%rbp
+  801297:	53                   	push   %rbx
+  801298:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80129c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80129f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c0:	48 85 c0             	test   %rax,%rax
+  8012c3:	7f 06                	jg     8012cb <sys_env_destroy+0x38>
+}
+  8012c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cb:	49 89 c0             	mov    %rax,%r8
+  8012ce:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d3:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  8012da:	00 00 00 
+  8012dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e2:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  8012e9:	00 00 00 
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  8012f8:	00 00 00 
+  8012fb:	41 ff d1             	call   *%r9
+
+00000000008012fe <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+  801302:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801303:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801312:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801317:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131c:	be 00 00 00 00       	mov    $0x0,%esi
+  801321:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801327:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801329:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132d:	c9                   	leave
+  80132e:	c3                   	ret
+
+000000000080132f <sys_yield>:
+
+void
+sys_yield(void) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801334:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801343:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801348:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801358:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135e:	c9                   	leave
+  80135f:	c3                   	ret
+
+0000000000801360 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801360:	55                   	push   %rbp
+  801361:	48 89 e5             	mov    %rsp,%rbp
+  801364:	53                   	push   %rbx
+  801365:	48 89 fa             	mov    %rdi,%rdx
+  801368:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80136b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801370:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801377:	00 00 00 
+  80137a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137f:	be 00 00 00 00       	mov    $0x0,%esi
+  801384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80138c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801390:	c9                   	leave
+  801391:	c3                   	ret
+
+0000000000801392 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801392:	55                   	push   %rbp
+  801393:	48 89 e5             	mov    %rsp,%rbp
+  801396:	53                   	push   %rbx
+  801397:	49 89 f8             	mov    %rdi,%r8
+  80139a:	48 89 d3             	mov    %rdx,%rbx
+  80139d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a5:	4c 89 c2             	mov    %r8,%rdx
+  8013a8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bc:	c9                   	leave
+  8013bd:	c3                   	ret
+
+00000000008013be <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013be:	55                   	push   %rbp
+  8013bf:	48 89 e5             	mov    %rsp,%rbp
+  8013c2:	53                   	push   %rbx
+  8013c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c7:	89 f8                	mov    %edi,%eax
+  8013c9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013cc:	48 63 f9             	movslq %ecx,%rdi
+  8013cf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013da:	be 00 00 00 00       	mov    $0x0,%esi
+  8013df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e7:	48 85 c0             	test   %rax,%rax
+  8013ea:	7f 06                	jg     8013f2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f2:	49 89 c0             	mov    %rax,%r8
+  8013f5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013fa:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  801401:	00 00 00 
+  801404:	be 26 00 00 00       	mov    $0x26,%esi
+  801409:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  801410:	00 00 00 
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+  801418:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  80141f:	00 00 00 
+  801422:	41 ff d1             	call   *%r9
+
+0000000000801425 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801425:	55                   	push   %rbp
+  801426:	48 89 e5             	mov    %rsp,%rbp
+  801429:	53                   	push   %rbx
+  80142a:	48 83 ec 08          	sub    $0x8,%rsp
+  80142e:	89 f8                	mov    %edi,%eax
+  801430:	49 89 f2             	mov    %rsi,%r10
+  801433:	48 89 cf             	mov    %rcx,%rdi
+  801436:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801439:	48 63 da             	movslq %edx,%rbx
+  80143c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801444:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801447:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80144a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144c:	48 85 c0             	test   %rax,%rax
+  80144f:	7f 06                	jg     801457 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801457:	49 89 c0             	mov    %rax,%r8
+  80145a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80145f:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  801466:	00 00 00 
+  801469:	be 26 00 00 00       	mov    $0x26,%esi
+  80146e:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  801475:	00 00 00 
+  801478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147d:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  801484:	00 00 00 
+  801487:	41 ff d1             	call   *%r9
+
+000000000080148a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	48 89 f1             	mov    %rsi,%rcx
+  801496:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801499:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b3:	48 85 c0             	test   %rax,%rax
+  8014b6:	7f 06                	jg     8014be <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bc:	c9                   	leave
+  8014bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014be:	49 89 c0             	mov    %rax,%r8
+  8014c1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014c6:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  8014cd:	00 00 00 
+  8014d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d5:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  8014dc:	00 00 00 
+  8014df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e4:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  8014eb:	00 00 00 
+  8014ee:	41 ff d1             	call   *%r9
+
+00000000008014f1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	53                   	push   %rbx
+  8014f6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014fa:	48 63 ce             	movslq %esi,%rcx
+  8014fd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801500:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801505:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150f:	be 00 00 00 00       	mov    $0x0,%esi
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151c:	48 85 c0             	test   %rax,%rax
+  80151f:	7f 06                	jg     801527 <sys_env_set_status+0x36>
+}
+  801521:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801527:	49 89 c0             	mov    %rax,%r8
+  80152a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80152f:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  801536:	00 00 00 
+  801539:	be 26 00 00 00       	mov    $0x26,%esi
+  80153e:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  801545:	00 00 00 
+  801548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154d:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  801554:	00 00 00 
+  801557:	41 ff d1             	call   *%r9
+
+000000000080155a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	48 83 ec 08          	sub    $0x8,%rsp
+  801563:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801566:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801569:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801578:	be 00 00 00 00       	mov    $0x0,%esi
+  80157d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801583:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801585:	48 85 c0             	test   %rax,%rax
+  801588:	7f 06                	jg     801590 <sys_env_set_trapframe+0x36>
+}
+  80158a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158e:	c9                   	leave
+  80158f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801590:	49 89 c0             	mov    %rax,%r8
+  801593:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801598:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  80159f:	00 00 00 
+  8015a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a7:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  8015ae:	00 00 00 
+  8015b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b6:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  8015bd:	00 00 00 
+  8015c0:	41 ff d1             	call   *%r9
+
+00000000008015c3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ee:	48 85 c0             	test   %rax,%rax
+  8015f1:	7f 06                	jg     8015f9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f7:	c9                   	leave
+  8015f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f9:	49 89 c0             	mov    %rax,%r8
+  8015fc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801601:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  801608:	00 00 00 
+  80160b:	be 26 00 00 00       	mov    $0x26,%esi
+  801610:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  801617:	00 00 00 
+  80161a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161f:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  801626:	00 00 00 
+  801629:	41 ff d1             	call   *%r9
+
+000000000080162c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80162c:	55                   	push   %rbp
+  80162d:	48 89 e5             	mov    %rsp,%rbp
+  801630:	53                   	push   %rbx
+  801631:	89 f8                	mov    %edi,%eax
+  801633:	49 89 f1             	mov    %rsi,%r9
+  801636:	48 89 d3             	mov    %rdx,%rbx
+  801639:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80163c:	49 63 f0             	movslq %r8d,%rsi
+  80163f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801642:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801647:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801650:	cd 30                	int    $0x30
+}
+  801652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801656:	c9                   	leave
+  801657:	c3                   	ret
+
+0000000000801658 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801658:	55                   	push   %rbp
+  801659:	48 89 e5             	mov    %rsp,%rbp
+  80165c:	53                   	push   %rbx
+  80165d:	48 83 ec 08          	sub    $0x8,%rsp
+  801661:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801664:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801667:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166c:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801674:	be 00 00 00 00       	mov    $0x0,%esi
+  801679:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801681:	48 85 c0             	test   %rax,%rax
+  801684:	7f 06                	jg     80168c <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801686:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168c:	49 89 c0             	mov    %rax,%r8
+  80168f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801694:	48 ba 68 47 80 00 00 	movabs $0x804768,%rdx
+  80169b:	00 00 00 
+  80169e:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a3:	48 bf 87 47 80 00 00 	movabs $0x804787,%rdi
+  8016aa:	00 00 00 
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b2:	49 b9 bd 02 80 00 00 	movabs $0x8002bd,%r9
+  8016b9:	00 00 00 
+  8016bc:	41 ff d1             	call   *%r9
+
+00000000008016bf <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8016c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c8:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  8016cf:	00 00 00 
+  8016d2:	ff d0                	call   *%rax
+}
+  8016d4:	5d                   	pop    %rbp
+  8016d5:	c3                   	ret
+
+00000000008016d6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ff:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801701:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+0000000000801707 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801707:	55                   	push   %rbp
+  801708:	48 89 e5             	mov    %rsp,%rbp
+  80170b:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80170c:	48 63 ce             	movslq %esi,%rcx
+  80170f:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801713:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801722:	be 00 00 00 00       	mov    $0x0,%esi
+  801727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172d:	cd 30                	int    $0x30
+}
+  80172f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801733:	c9                   	leave
+  801734:	c3                   	ret
+
+0000000000801735 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801735:	55                   	push   %rbp
+  801736:	48 89 e5             	mov    %rsp,%rbp
+  801739:	53                   	push   %rbx
+  80173a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80173d:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801741:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801746:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801750:	be 00 00 00 00       	mov    $0x0,%esi
+  801755:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175b:	cd 30                	int    $0x30
+}
+  80175d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	53                   	push   %rbx
+  801768:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80176b:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80176e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801773:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801776:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177b:	be 00 00 00 00       	mov    $0x0,%esi
+  801780:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801786:	cd 30                	int    $0x30
+}
+  801788:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178c:	c9                   	leave
+  80178d:	c3                   	ret
+
+000000000080178e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80178e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801795:	ff ff ff 
+  801798:	48 01 f8             	add    %rdi,%rax
+  80179b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80179f:	c3                   	ret
+
+00000000008017a0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017a0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017a7:	ff ff ff 
+  8017aa:	48 01 f8             	add    %rdi,%rax
+  8017ad:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017b1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017b7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017bb:	c3                   	ret
+
+00000000008017bc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8017bc:	55                   	push   %rbp
+  8017bd:	48 89 e5             	mov    %rsp,%rbp
+  8017c0:	41 57                	push   %r15
+  8017c2:	41 56                	push   %r14
+  8017c4:	41 55                	push   %r13
+  8017c6:	41 54                	push   %r12
+  8017c8:	53                   	push   %rbx
+  8017c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017cd:	49 89 ff             	mov    %rdi,%r15
+  8017d0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017d5:	49 bd e8 3b 80 00 00 	movabs $0x803be8,%r13
+  8017dc:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8017df:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8017e5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8017e8:	48 89 df             	mov    %rbx,%rdi
+  8017eb:	41 ff d5             	call   *%r13
+  8017ee:	83 e0 04             	and    $0x4,%eax
+  8017f1:	74 17                	je     80180a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8017f3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017fa:	4c 39 f3             	cmp    %r14,%rbx
+  8017fd:	75 e6                	jne    8017e5 <fd_alloc+0x29>
+  8017ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801805:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80180a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80180d:	48 83 c4 08          	add    $0x8,%rsp
+  801811:	5b                   	pop    %rbx
+  801812:	41 5c                	pop    %r12
+  801814:	41 5d                	pop    %r13
+  801816:	41 5e                	pop    %r14
+  801818:	41 5f                	pop    %r15
+  80181a:	5d                   	pop    %rbp
+  80181b:	c3                   	ret
+
+000000000080181c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80181c:	83 ff 1f             	cmp    $0x1f,%edi
+  80181f:	77 39                	ja     80185a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801821:	55                   	push   %rbp
+  801822:	48 89 e5             	mov    %rsp,%rbp
+  801825:	41 54                	push   %r12
+  801827:	53                   	push   %rbx
+  801828:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80182b:	48 63 df             	movslq %edi,%rbx
+  80182e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801835:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801839:	48 89 df             	mov    %rbx,%rdi
+  80183c:	48 b8 e8 3b 80 00 00 	movabs $0x803be8,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+  801848:	a8 04                	test   $0x4,%al
+  80184a:	74 14                	je     801860 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80184c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801855:	5b                   	pop    %rbx
+  801856:	41 5c                	pop    %r12
+  801858:	5d                   	pop    %rbp
+  801859:	c3                   	ret
+        return -E_INVAL;
+  80185a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80185f:	c3                   	ret
+        return -E_INVAL;
+  801860:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801865:	eb ee                	jmp    801855 <fd_lookup+0x39>
+
+0000000000801867 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	41 54                	push   %r12
+  80186d:	53                   	push   %rbx
+  80186e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801871:	48 b8 40 48 80 00 00 	movabs $0x804840,%rax
+  801878:	00 00 00 
+  80187b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801882:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801885:	39 3b                	cmp    %edi,(%rbx)
+  801887:	74 47                	je     8018d0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801889:	48 83 c0 08          	add    $0x8,%rax
+  80188d:	48 8b 18             	mov    (%rax),%rbx
+  801890:	48 85 db             	test   %rbx,%rbx
+  801893:	75 f0                	jne    801885 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801895:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80189c:	00 00 00 
+  80189f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018a5:	89 fa                	mov    %edi,%edx
+  8018a7:	48 bf 98 47 80 00 00 	movabs $0x804798,%rdi
+  8018ae:	00 00 00 
+  8018b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b6:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  8018bd:	00 00 00 
+  8018c0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018c7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018cb:	5b                   	pop    %rbx
+  8018cc:	41 5c                	pop    %r12
+  8018ce:	5d                   	pop    %rbp
+  8018cf:	c3                   	ret
+            return 0;
+  8018d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d5:	eb f0                	jmp    8018c7 <dev_lookup+0x60>
+
+00000000008018d7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8018d7:	55                   	push   %rbp
+  8018d8:	48 89 e5             	mov    %rsp,%rbp
+  8018db:	41 55                	push   %r13
+  8018dd:	41 54                	push   %r12
+  8018df:	53                   	push   %rbx
+  8018e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8018e4:	48 89 fb             	mov    %rdi,%rbx
+  8018e7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ea:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018f1:	ff ff ff 
+  8018f4:	48 01 df             	add    %rbx,%rdi
+  8018f7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018fb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018ff:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801906:	00 00 00 
+  801909:	ff d0                	call   *%rax
+  80190b:	41 89 c5             	mov    %eax,%r13d
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	78 06                	js     801918 <fd_close+0x41>
+  801912:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801916:	74 1a                	je     801932 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801918:	45 84 e4             	test   %r12b,%r12b
+  80191b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801920:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801924:	44 89 e8             	mov    %r13d,%eax
+  801927:	48 83 c4 18          	add    $0x18,%rsp
+  80192b:	5b                   	pop    %rbx
+  80192c:	41 5c                	pop    %r12
+  80192e:	41 5d                	pop    %r13
+  801930:	5d                   	pop    %rbp
+  801931:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801932:	8b 3b                	mov    (%rbx),%edi
+  801934:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801938:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  80193f:	00 00 00 
+  801942:	ff d0                	call   *%rax
+  801944:	41 89 c5             	mov    %eax,%r13d
+  801947:	85 c0                	test   %eax,%eax
+  801949:	78 1b                	js     801966 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80194b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80194f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801953:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801959:	48 85 c0             	test   %rax,%rax
+  80195c:	74 08                	je     801966 <fd_close+0x8f>
+  80195e:	48 89 df             	mov    %rbx,%rdi
+  801961:	ff d0                	call   *%rax
+  801963:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801966:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80196b:	48 89 de             	mov    %rbx,%rsi
+  80196e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801973:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+    return res;
+  80197f:	eb a3                	jmp    801924 <fd_close+0x4d>
+
+0000000000801981 <close>:
+
+int
+close(int fdnum) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801989:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80198d:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801994:	00 00 00 
+  801997:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 15                	js     8019b2 <close+0x31>
+
+    return fd_close(fd, 1);
+  80199d:	be 01 00 00 00       	mov    $0x1,%esi
+  8019a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019a6:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+}
+  8019b2:	c9                   	leave
+  8019b3:	c3                   	ret
+
+00000000008019b4 <close_all>:
+
+void
+close_all(void) {
+  8019b4:	55                   	push   %rbp
+  8019b5:	48 89 e5             	mov    %rsp,%rbp
+  8019b8:	41 54                	push   %r12
+  8019ba:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c0:	49 bc 81 19 80 00 00 	movabs $0x801981,%r12
+  8019c7:	00 00 00 
+  8019ca:	89 df                	mov    %ebx,%edi
+  8019cc:	41 ff d4             	call   *%r12
+  8019cf:	83 c3 01             	add    $0x1,%ebx
+  8019d2:	83 fb 20             	cmp    $0x20,%ebx
+  8019d5:	75 f3                	jne    8019ca <close_all+0x16>
+}
+  8019d7:	5b                   	pop    %rbx
+  8019d8:	41 5c                	pop    %r12
+  8019da:	5d                   	pop    %rbp
+  8019db:	c3                   	ret
+
+00000000008019dc <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+  8019e0:	41 57                	push   %r15
+  8019e2:	41 56                	push   %r14
+  8019e4:	41 55                	push   %r13
+  8019e6:	41 54                	push   %r12
+  8019e8:	53                   	push   %rbx
+  8019e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ed:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019f0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019f4:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+  801a00:	89 c3                	mov    %eax,%ebx
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	0f 88 b8 00 00 00    	js     801ac2 <dup+0xe6>
+    close(newfdnum);
+  801a0a:	44 89 e7             	mov    %r12d,%edi
+  801a0d:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  801a14:	00 00 00 
+  801a17:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a19:	4d 63 ec             	movslq %r12d,%r13
+  801a1c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a23:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a27:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a2b:	4c 89 ff             	mov    %r15,%rdi
+  801a2e:	49 be a0 17 80 00 00 	movabs $0x8017a0,%r14
+  801a35:	00 00 00 
+  801a38:	41 ff d6             	call   *%r14
+  801a3b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a3e:	4c 89 ef             	mov    %r13,%rdi
+  801a41:	41 ff d6             	call   *%r14
+  801a44:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a47:	48 89 df             	mov    %rbx,%rdi
+  801a4a:	48 b8 e8 3b 80 00 00 	movabs $0x803be8,%rax
+  801a51:	00 00 00 
+  801a54:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a56:	a8 04                	test   $0x4,%al
+  801a58:	74 2b                	je     801a85 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a5a:	41 89 c1             	mov    %eax,%r9d
+  801a5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a63:	4c 89 f1             	mov    %r14,%rcx
+  801a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6b:	48 89 de             	mov    %rbx,%rsi
+  801a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a73:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  801a7a:	00 00 00 
+  801a7d:	ff d0                	call   *%rax
+  801a7f:	89 c3                	mov    %eax,%ebx
+  801a81:	85 c0                	test   %eax,%eax
+  801a83:	78 4e                	js     801ad3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a85:	4c 89 ff             	mov    %r15,%rdi
+  801a88:	48 b8 e8 3b 80 00 00 	movabs $0x803be8,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+  801a94:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a97:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a9d:	4c 89 e9             	mov    %r13,%rcx
+  801aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa5:	4c 89 fe             	mov    %r15,%rsi
+  801aa8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aad:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  801ab4:	00 00 00 
+  801ab7:	ff d0                	call   *%rax
+  801ab9:	89 c3                	mov    %eax,%ebx
+  801abb:	85 c0                	test   %eax,%eax
+  801abd:	78 14                	js     801ad3 <dup+0xf7>
+
+    return newfdnum;
+  801abf:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ac2:	89 d8                	mov    %ebx,%eax
+  801ac4:	48 83 c4 18          	add    $0x18,%rsp
+  801ac8:	5b                   	pop    %rbx
+  801ac9:	41 5c                	pop    %r12
+  801acb:	41 5d                	pop    %r13
+  801acd:	41 5e                	pop    %r14
+  801acf:	41 5f                	pop    %r15
+  801ad1:	5d                   	pop    %rbp
+  801ad2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ad3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ad8:	4c 89 ee             	mov    %r13,%rsi
+  801adb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae0:	49 bc 8a 14 80 00 00 	movabs $0x80148a,%r12
+  801ae7:	00 00 00 
+  801aea:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801aed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801af2:	4c 89 f6             	mov    %r14,%rsi
+  801af5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afa:	41 ff d4             	call   *%r12
+    return res;
+  801afd:	eb c3                	jmp    801ac2 <dup+0xe6>
+
+0000000000801aff <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	41 56                	push   %r14
+  801b05:	41 55                	push   %r13
+  801b07:	41 54                	push   %r12
+  801b09:	53                   	push   %rbx
+  801b0a:	48 83 ec 10          	sub    $0x10,%rsp
+  801b0e:	89 fb                	mov    %edi,%ebx
+  801b10:	49 89 f4             	mov    %rsi,%r12
+  801b13:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b16:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b1a:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 4c                	js     801b76 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b2a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b2e:	41 8b 3e             	mov    (%r14),%edi
+  801b31:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b35:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	85 c0                	test   %eax,%eax
+  801b43:	78 35                	js     801b7a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b45:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b49:	83 e0 03             	and    $0x3,%eax
+  801b4c:	83 f8 01             	cmp    $0x1,%eax
+  801b4f:	74 2d                	je     801b7e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b55:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b59:	48 85 c0             	test   %rax,%rax
+  801b5c:	74 56                	je     801bb4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b5e:	4c 89 ea             	mov    %r13,%rdx
+  801b61:	4c 89 e6             	mov    %r12,%rsi
+  801b64:	4c 89 f7             	mov    %r14,%rdi
+  801b67:	ff d0                	call   *%rax
+}
+  801b69:	48 83 c4 10          	add    $0x10,%rsp
+  801b6d:	5b                   	pop    %rbx
+  801b6e:	41 5c                	pop    %r12
+  801b70:	41 5d                	pop    %r13
+  801b72:	41 5e                	pop    %r14
+  801b74:	5d                   	pop    %rbp
+  801b75:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b76:	48 98                	cltq
+  801b78:	eb ef                	jmp    801b69 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b7a:	48 98                	cltq
+  801b7c:	eb eb                	jmp    801b69 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b7e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b85:	00 00 00 
+  801b88:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b8e:	89 da                	mov    %ebx,%edx
+  801b90:	48 bf f9 47 80 00 00 	movabs $0x8047f9,%rdi
+  801b97:	00 00 00 
+  801b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9f:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801ba6:	00 00 00 
+  801ba9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bb2:	eb b5                	jmp    801b69 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bb4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bbb:	eb ac                	jmp    801b69 <read+0x6a>
+
+0000000000801bbd <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	41 56                	push   %r14
+  801bc3:	41 55                	push   %r13
+  801bc5:	41 54                	push   %r12
+  801bc7:	53                   	push   %rbx
+  801bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801bcc:	89 fb                	mov    %edi,%ebx
+  801bce:	49 89 f4             	mov    %rsi,%r12
+  801bd1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd8:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801bdf:	00 00 00 
+  801be2:	ff d0                	call   *%rax
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 41                	js     801c29 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801be8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bec:	41 8b 3e             	mov    (%r14),%edi
+  801bef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf3:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801bfa:	00 00 00 
+  801bfd:	ff d0                	call   *%rax
+  801bff:	85 c0                	test   %eax,%eax
+  801c01:	78 35                	js     801c38 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c03:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c07:	83 e0 03             	and    $0x3,%eax
+  801c0a:	83 f8 01             	cmp    $0x1,%eax
+  801c0d:	74 2d                	je     801c3c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c13:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c17:	48 85 c0             	test   %rax,%rax
+  801c1a:	74 56                	je     801c72 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801c1c:	4c 89 ea             	mov    %r13,%rdx
+  801c1f:	4c 89 e6             	mov    %r12,%rsi
+  801c22:	4c 89 f7             	mov    %r14,%rdi
+  801c25:	ff d0                	call   *%rax
+  801c27:	eb 02                	jmp    801c2b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c29:	48 98                	cltq
+}
+  801c2b:	48 83 c4 10          	add    $0x10,%rsp
+  801c2f:	5b                   	pop    %rbx
+  801c30:	41 5c                	pop    %r12
+  801c32:	41 5d                	pop    %r13
+  801c34:	41 5e                	pop    %r14
+  801c36:	5d                   	pop    %rbp
+  801c37:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c38:	48 98                	cltq
+  801c3a:	eb ef                	jmp    801c2b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c3c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c43:	00 00 00 
+  801c46:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c4c:	89 da                	mov    %ebx,%edx
+  801c4e:	48 bf b8 47 80 00 00 	movabs $0x8047b8,%rdi
+  801c55:	00 00 00 
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5d:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801c64:	00 00 00 
+  801c67:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c69:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c70:	eb b9                	jmp    801c2b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c72:	4c 89 ea             	mov    %r13,%rdx
+  801c75:	4c 89 e6             	mov    %r12,%rsi
+  801c78:	89 df                	mov    %ebx,%edi
+  801c7a:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	eb a3                	jmp    801c2b <readmap+0x6e>
+
+0000000000801c88 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c88:	55                   	push   %rbp
+  801c89:	48 89 e5             	mov    %rsp,%rbp
+  801c8c:	41 57                	push   %r15
+  801c8e:	41 56                	push   %r14
+  801c90:	41 55                	push   %r13
+  801c92:	41 54                	push   %r12
+  801c94:	53                   	push   %rbx
+  801c95:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c99:	48 85 d2             	test   %rdx,%rdx
+  801c9c:	74 54                	je     801cf2 <readn+0x6a>
+  801c9e:	41 89 fd             	mov    %edi,%r13d
+  801ca1:	49 89 f6             	mov    %rsi,%r14
+  801ca4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ca7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cac:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cb1:	49 bf ff 1a 80 00 00 	movabs $0x801aff,%r15
+  801cb8:	00 00 00 
+  801cbb:	4c 89 e2             	mov    %r12,%rdx
+  801cbe:	48 29 f2             	sub    %rsi,%rdx
+  801cc1:	4c 01 f6             	add    %r14,%rsi
+  801cc4:	44 89 ef             	mov    %r13d,%edi
+  801cc7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 20                	js     801cee <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cce:	01 c3                	add    %eax,%ebx
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	74 08                	je     801cdc <readn+0x54>
+  801cd4:	48 63 f3             	movslq %ebx,%rsi
+  801cd7:	4c 39 e6             	cmp    %r12,%rsi
+  801cda:	72 df                	jb     801cbb <readn+0x33>
+    }
+    return res;
+  801cdc:	48 63 c3             	movslq %ebx,%rax
+}
+  801cdf:	48 83 c4 08          	add    $0x8,%rsp
+  801ce3:	5b                   	pop    %rbx
+  801ce4:	41 5c                	pop    %r12
+  801ce6:	41 5d                	pop    %r13
+  801ce8:	41 5e                	pop    %r14
+  801cea:	41 5f                	pop    %r15
+  801cec:	5d                   	pop    %rbp
+  801ced:	c3                   	ret
+        if (inc < 0) return inc;
+  801cee:	48 98                	cltq
+  801cf0:	eb ed                	jmp    801cdf <readn+0x57>
+    int inc = 1, res = 0;
+  801cf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf7:	eb e3                	jmp    801cdc <readn+0x54>
+
+0000000000801cf9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	41 56                	push   %r14
+  801cff:	41 55                	push   %r13
+  801d01:	41 54                	push   %r12
+  801d03:	53                   	push   %rbx
+  801d04:	48 83 ec 10          	sub    $0x10,%rsp
+  801d08:	89 fb                	mov    %edi,%ebx
+  801d0a:	49 89 f4             	mov    %rsi,%r12
+  801d0d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d10:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d14:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 47                	js     801d6b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d24:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d28:	41 8b 3e             	mov    (%r14),%edi
+  801d2b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d2f:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 30                	js     801d6f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d3f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d44:	74 2d                	je     801d73 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d4e:	48 85 c0             	test   %rax,%rax
+  801d51:	74 56                	je     801da9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d53:	4c 89 ea             	mov    %r13,%rdx
+  801d56:	4c 89 e6             	mov    %r12,%rsi
+  801d59:	4c 89 f7             	mov    %r14,%rdi
+  801d5c:	ff d0                	call   *%rax
+}
+  801d5e:	48 83 c4 10          	add    $0x10,%rsp
+  801d62:	5b                   	pop    %rbx
+  801d63:	41 5c                	pop    %r12
+  801d65:	41 5d                	pop    %r13
+  801d67:	41 5e                	pop    %r14
+  801d69:	5d                   	pop    %rbp
+  801d6a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6b:	48 98                	cltq
+  801d6d:	eb ef                	jmp    801d5e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d6f:	48 98                	cltq
+  801d71:	eb eb                	jmp    801d5e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d73:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d7a:	00 00 00 
+  801d7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d83:	89 da                	mov    %ebx,%edx
+  801d85:	48 bf 15 48 80 00 00 	movabs $0x804815,%rdi
+  801d8c:	00 00 00 
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d94:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801d9b:	00 00 00 
+  801d9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801da7:	eb b5                	jmp    801d5e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801da9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801db0:	eb ac                	jmp    801d5e <write+0x65>
+
+0000000000801db2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	53                   	push   %rbx
+  801db7:	48 83 ec 18          	sub    $0x18,%rsp
+  801dbb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc1:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801dc8:	00 00 00 
+  801dcb:	ff d0                	call   *%rax
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 0c                	js     801ddd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dd5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ddd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de1:	c9                   	leave
+  801de2:	c3                   	ret
+
+0000000000801de3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801de3:	55                   	push   %rbp
+  801de4:	48 89 e5             	mov    %rsp,%rbp
+  801de7:	41 55                	push   %r13
+  801de9:	41 54                	push   %r12
+  801deb:	53                   	push   %rbx
+  801dec:	48 83 ec 18          	sub    $0x18,%rsp
+  801df0:	89 fb                	mov    %edi,%ebx
+  801df2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801df9:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801e00:	00 00 00 
+  801e03:	ff d0                	call   *%rax
+  801e05:	85 c0                	test   %eax,%eax
+  801e07:	78 38                	js     801e41 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e09:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e0d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e15:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801e1c:	00 00 00 
+  801e1f:	ff d0                	call   *%rax
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 1c                	js     801e41 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e25:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e2a:	74 20                	je     801e4c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e30:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e34:	48 85 c0             	test   %rax,%rax
+  801e37:	74 47                	je     801e80 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e39:	44 89 e6             	mov    %r12d,%esi
+  801e3c:	4c 89 ef             	mov    %r13,%rdi
+  801e3f:	ff d0                	call   *%rax
+}
+  801e41:	48 83 c4 18          	add    $0x18,%rsp
+  801e45:	5b                   	pop    %rbx
+  801e46:	41 5c                	pop    %r12
+  801e48:	41 5d                	pop    %r13
+  801e4a:	5d                   	pop    %rbp
+  801e4b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e4c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e53:	00 00 00 
+  801e56:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e5c:	89 da                	mov    %ebx,%edx
+  801e5e:	48 bf d8 47 80 00 00 	movabs $0x8047d8,%rdi
+  801e65:	00 00 00 
+  801e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6d:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801e74:	00 00 00 
+  801e77:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7e:	eb c1                	jmp    801e41 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e80:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e85:	eb ba                	jmp    801e41 <ftruncate+0x5e>
+
+0000000000801e87 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e87:	55                   	push   %rbp
+  801e88:	48 89 e5             	mov    %rsp,%rbp
+  801e8b:	41 54                	push   %r12
+  801e8d:	53                   	push   %rbx
+  801e8e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e92:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e99:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+  801ea5:	85 c0                	test   %eax,%eax
+  801ea7:	78 4e                	js     801ef7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ea9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ead:	41 8b 3c 24          	mov    (%r12),%edi
+  801eb1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801eb5:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801ebc:	00 00 00 
+  801ebf:	ff d0                	call   *%rax
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 32                	js     801ef7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ec5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ec9:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801ece:	74 30                	je     801f00 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ed0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ed3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801eda:	00 00 00 
+    stat->st_isdir = 0;
+  801edd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ee4:	00 00 00 
+    stat->st_dev = dev;
+  801ee7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801eee:	48 89 de             	mov    %rbx,%rsi
+  801ef1:	4c 89 e7             	mov    %r12,%rdi
+  801ef4:	ff 50 30             	call   *0x30(%rax)
+}
+  801ef7:	48 83 c4 10          	add    $0x10,%rsp
+  801efb:	5b                   	pop    %rbx
+  801efc:	41 5c                	pop    %r12
+  801efe:	5d                   	pop    %rbp
+  801eff:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f00:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f05:	eb f0                	jmp    801ef7 <fstat+0x70>
+
+0000000000801f07 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f07:	55                   	push   %rbp
+  801f08:	48 89 e5             	mov    %rsp,%rbp
+  801f0b:	41 54                	push   %r12
+  801f0d:	53                   	push   %rbx
+  801f0e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f11:	be 00 00 00 00       	mov    $0x0,%esi
+  801f16:	48 b8 5e 2c 80 00 00 	movabs $0x802c5e,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	78 25                	js     801f4d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f28:	4c 89 e6             	mov    %r12,%rsi
+  801f2b:	89 c7                	mov    %eax,%edi
+  801f2d:	48 b8 87 1e 80 00 00 	movabs $0x801e87,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+  801f39:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f3c:	89 df                	mov    %ebx,%edi
+  801f3e:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+
+    return res;
+  801f4a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f4d:	89 d8                	mov    %ebx,%eax
+  801f4f:	5b                   	pop    %rbx
+  801f50:	41 5c                	pop    %r12
+  801f52:	5d                   	pop    %rbp
+  801f53:	c3                   	ret
+
+0000000000801f54 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801f54:	55                   	push   %rbp
+  801f55:	48 89 e5             	mov    %rsp,%rbp
+  801f58:	41 54                	push   %r12
+  801f5a:	53                   	push   %rbx
+  801f5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5f:	48 89 fb             	mov    %rdi,%rbx
+  801f62:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f65:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f69:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f6e:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801f75:	00 00 00 
+  801f78:	ff d0                	call   *%rax
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 1f                	js     801f9d <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f82:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801f86:	48 85 c0             	test   %rax,%rax
+  801f89:	74 1b                	je     801fa6 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801f8b:	4c 89 e6             	mov    %r12,%rsi
+  801f8e:	48 89 df             	mov    %rbx,%rdi
+  801f91:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f9d:	48 83 c4 10          	add    $0x10,%rsp
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	5d                   	pop    %rbp
+  801fa5:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fa6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fab:	eb f0                	jmp    801f9d <create_snapshot+0x49>
+
+0000000000801fad <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fb5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fb9:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fbe:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 1e                	js     801fec <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801fce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd2:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801fd6:	48 85 d2             	test   %rdx,%rdx
+  801fd9:	74 13                	je     801fee <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff3:	eb f7                	jmp    801fec <print_snapshot_list+0x3f>
+
+0000000000801ff5 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+  801ff9:	53                   	push   %rbx
+  801ffa:	48 83 ec 18          	sub    $0x18,%rsp
+  801ffe:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802001:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802005:	bf 66 00 00 00       	mov    $0x66,%edi
+  80200a:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 1c                	js     802036 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80201a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80201e:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802022:	48 85 c0             	test   %rax,%rax
+  802025:	74 15                	je     80203c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802027:	48 89 df             	mov    %rbx,%rdi
+  80202a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802033:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802036:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80203c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802041:	eb f3                	jmp    802036 <accept_snapshot+0x41>
+
+0000000000802043 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  802047:	53                   	push   %rbx
+  802048:	48 83 ec 18          	sub    $0x18,%rsp
+  80204c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80204f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802053:	bf 66 00 00 00       	mov    $0x66,%edi
+  802058:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+  802064:	85 c0                	test   %eax,%eax
+  802066:	78 1c                	js     802084 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802068:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206c:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802070:	48 85 c0             	test   %rax,%rax
+  802073:	74 15                	je     80208a <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802075:	48 89 df             	mov    %rbx,%rdi
+  802078:	ff d0                	call   *%rax
+    if (res < 0) {
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802081:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802084:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802088:	c9                   	leave
+  802089:	c3                   	ret
+        return -E_NOT_SUPP;
+  80208a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80208f:	eb f3                	jmp    802084 <delete_snapshot+0x41>
+
+0000000000802091 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802091:	55                   	push   %rbp
+  802092:	48 89 e5             	mov    %rsp,%rbp
+  802095:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802099:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80209d:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020a2:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	85 c0                	test   %eax,%eax
+  8020b0:	78 14                	js     8020c6 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8020b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020b6:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8020ba:	48 85 d2             	test   %rdx,%rdx
+  8020bd:	74 09                	je     8020c8 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c4:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020cd:	eb f7                	jmp    8020c6 <gc_snapshots+0x35>
+
+00000000008020cf <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+  8020d3:	41 56                	push   %r14
+  8020d5:	41 55                	push   %r13
+  8020d7:	41 54                	push   %r12
+  8020d9:	53                   	push   %rbx
+  8020da:	48 83 ec 10          	sub    $0x10,%rsp
+  8020de:	48 89 fb             	mov    %rdi,%rbx
+  8020e1:	49 89 f4             	mov    %rsi,%r12
+  8020e4:	49 89 d5             	mov    %rdx,%r13
+  8020e7:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020ee:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020f3:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8020fa:	00 00 00 
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 1b                	js     80211e <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802103:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802107:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80210b:	48 85 c0             	test   %rax,%rax
+  80210e:	74 1b                	je     80212b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802110:	4c 89 f1             	mov    %r14,%rcx
+  802113:	4c 89 ea             	mov    %r13,%rdx
+  802116:	4c 89 e6             	mov    %r12,%rsi
+  802119:	48 89 df             	mov    %rbx,%rdi
+  80211c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80211e:	48 83 c4 10          	add    $0x10,%rsp
+  802122:	5b                   	pop    %rbx
+  802123:	41 5c                	pop    %r12
+  802125:	41 5d                	pop    %r13
+  802127:	41 5e                	pop    %r14
+  802129:	5d                   	pop    %rbp
+  80212a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80212b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802130:	eb ec                	jmp    80211e <diff_snapshots+0x4f>
+
+0000000000802132 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802132:	55                   	push   %rbp
+  802133:	48 89 e5             	mov    %rsp,%rbp
+  802136:	41 55                	push   %r13
+  802138:	41 54                	push   %r12
+  80213a:	53                   	push   %rbx
+  80213b:	48 83 ec 18          	sub    $0x18,%rsp
+  80213f:	48 89 fb             	mov    %rdi,%rbx
+  802142:	49 89 f4             	mov    %rsi,%r12
+  802145:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802148:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80214c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802151:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 18                	js     802179 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802161:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802165:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802169:	48 85 c0             	test   %rax,%rax
+  80216c:	74 16                	je     802184 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80216e:	4c 89 ea             	mov    %r13,%rdx
+  802171:	4c 89 e6             	mov    %r12,%rsi
+  802174:	48 89 df             	mov    %rbx,%rdi
+  802177:	ff d0                	call   *%rax
+
+    return res;
+}
+  802179:	48 83 c4 18          	add    $0x18,%rsp
+  80217d:	5b                   	pop    %rbx
+  80217e:	41 5c                	pop    %r12
+  802180:	41 5d                	pop    %r13
+  802182:	5d                   	pop    %rbp
+  802183:	c3                   	ret
+        return -E_NOT_SUPP;
+  802184:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802189:	eb ee                	jmp    802179 <send_snapshot+0x47>
+
+000000000080218b <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80218b:	55                   	push   %rbp
+  80218c:	48 89 e5             	mov    %rsp,%rbp
+  80218f:	53                   	push   %rbx
+  802190:	48 83 ec 18          	sub    $0x18,%rsp
+  802194:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802197:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80219b:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021a0:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8021a7:	00 00 00 
+  8021aa:	ff d0                	call   *%rax
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 12                	js     8021c2 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8021b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b4:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8021b8:	48 85 c0             	test   %rax,%rax
+  8021bb:	74 0b                	je     8021c8 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8021bd:	48 89 df             	mov    %rbx,%rdi
+  8021c0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021cd:	eb f3                	jmp    8021c2 <receive_snapshot+0x37>
+
+00000000008021cf <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8021cf:	55                   	push   %rbp
+  8021d0:	48 89 e5             	mov    %rsp,%rbp
+  8021d3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021db:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021e0:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 17                	js     802207 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8021f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021f4:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8021fb:	48 85 d2             	test   %rdx,%rdx
+  8021fe:	74 09                	je     802209 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+  802205:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+        return -E_NOT_SUPP;
+  802209:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80220e:	eb f7                	jmp    802207 <free_space_bytes+0x38>
+
+0000000000802210 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+  802214:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802218:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80221c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802221:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 17                	js     802248 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802231:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802235:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80223c:	48 85 d2             	test   %rdx,%rdx
+  80223f:	74 09                	je     80224a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802241:	b8 00 00 00 00       	mov    $0x0,%eax
+  802246:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802248:	c9                   	leave
+  802249:	c3                   	ret
+        return -E_NOT_SUPP;
+  80224a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80224f:	eb f7                	jmp    802248 <busy_space_bytes+0x38>
+
+0000000000802251 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802251:	55                   	push   %rbp
+  802252:	48 89 e5             	mov    %rsp,%rbp
+  802255:	41 54                	push   %r12
+  802257:	53                   	push   %rbx
+  802258:	48 83 ec 10          	sub    $0x10,%rsp
+  80225c:	89 fb                	mov    %edi,%ebx
+  80225e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802261:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802265:	bf 66 00 00 00       	mov    $0x66,%edi
+  80226a:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  802271:	00 00 00 
+  802274:	ff d0                	call   *%rax
+  802276:	85 c0                	test   %eax,%eax
+  802278:	78 17                	js     802291 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80227a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80227e:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802285:	48 85 c0             	test   %rax,%rax
+  802288:	74 10                	je     80229a <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80228a:	4c 89 e6             	mov    %r12,%rsi
+  80228d:	89 df                	mov    %ebx,%edi
+  80228f:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802291:	48 83 c4 10          	add    $0x10,%rsp
+  802295:	5b                   	pop    %rbx
+  802296:	41 5c                	pop    %r12
+  802298:	5d                   	pop    %rbp
+  802299:	c3                   	ret
+        return -E_NOT_SUPP;
+  80229a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80229f:	eb f0                	jmp    802291 <snapshots_space+0x40>
+
+00000000008022a1 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8022a1:	55                   	push   %rbp
+  8022a2:	48 89 e5             	mov    %rsp,%rbp
+  8022a5:	41 55                	push   %r13
+  8022a7:	41 54                	push   %r12
+  8022a9:	53                   	push   %rbx
+  8022aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ae:	41 89 fd             	mov    %edi,%r13d
+  8022b1:	48 89 f3             	mov    %rsi,%rbx
+  8022b4:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022b7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8022be:	00 00 00 
+  8022c1:	83 38 00             	cmpl   $0x0,(%rax)
+  8022c4:	74 57                	je     80231d <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8022c6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022d1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8022d8:	00 00 00 
+  8022db:	44 89 ee             	mov    %r13d,%esi
+  8022de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8022e5:	00 00 00 
+  8022e8:	8b 38                	mov    (%rax),%edi
+  8022ea:	48 b8 2b 40 80 00 00 	movabs $0x80402b,%rax
+  8022f1:	00 00 00 
+  8022f4:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8022f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fb:	4c 89 e2             	mov    %r12,%rdx
+  8022fe:	48 89 de             	mov    %rbx,%rsi
+  802301:	bf 00 00 00 00       	mov    $0x0,%edi
+  802306:	48 b8 13 40 80 00 00 	movabs $0x804013,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+}
+  802312:	48 83 c4 08          	add    $0x8,%rsp
+  802316:	5b                   	pop    %rbx
+  802317:	41 5c                	pop    %r12
+  802319:	41 5d                	pop    %r13
+  80231b:	5d                   	pop    %rbp
+  80231c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80231d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802322:	48 b8 e9 40 80 00 00 	movabs $0x8040e9,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+  80232e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802335:	00 00 
+  802337:	eb 8d                	jmp    8022c6 <fsipc_region+0x25>
+
+0000000000802339 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  80233d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802341:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802348:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802349:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80234d:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  802354:	00 00 00 
+  802357:	ff d0                	call   *%rax
+}
+  802359:	c9                   	leave
+  80235a:	c3                   	ret
+
+000000000080235b <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80235b:	85 ff                	test   %edi,%edi
+  80235d:	78 6d                	js     8023cc <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80235f:	55                   	push   %rbp
+  802360:	48 89 e5             	mov    %rsp,%rbp
+  802363:	41 54                	push   %r12
+  802365:	53                   	push   %rbx
+  802366:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802369:	48 85 f6             	test   %rsi,%rsi
+  80236c:	74 57                	je     8023c5 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80236e:	89 f8                	mov    %edi,%eax
+  802370:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802377:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802379:	be 00 00 00 00       	mov    $0x0,%esi
+  80237e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802383:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  80238a:	00 00 00 
+  80238d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80238f:	85 c0                	test   %eax,%eax
+  802391:	78 2d                	js     8023c0 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802393:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80239a:	00 00 00 
+  80239d:	49 63 14 24          	movslq (%r12),%rdx
+  8023a1:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8023a8:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8023ad:	48 89 df             	mov    %rbx,%rdi
+  8023b0:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8023bc:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8023c0:	5b                   	pop    %rbx
+  8023c1:	41 5c                	pop    %r12
+  8023c3:	5d                   	pop    %rbp
+  8023c4:	c3                   	ret
+        return -E_INVAL;
+  8023c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ca:	eb f4                	jmp    8023c0 <devfile_df_snapshots+0x65>
+  8023cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8023d1:	c3                   	ret
+
+00000000008023d2 <devfile_df_busy>:
+devfile_df_busy() {
+  8023d2:	55                   	push   %rbp
+  8023d3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8023d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023db:	bf 11 00 00 00       	mov    $0x11,%edi
+  8023e0:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  8023e7:	00 00 00 
+  8023ea:	ff d0                	call   *%rax
+}
+  8023ec:	5d                   	pop    %rbp
+  8023ed:	c3                   	ret
+
+00000000008023ee <devfile_df_free>:
+devfile_df_free() {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8023f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8023fc:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802403:	00 00 00 
+  802406:	ff d0                	call   *%rax
+}
+  802408:	5d                   	pop    %rbp
+  802409:	c3                   	ret
+
+000000000080240a <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80240a:	55                   	push   %rbp
+  80240b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80240e:	be 00 00 00 00       	mov    $0x0,%esi
+  802413:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802418:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+}
+  802424:	5d                   	pop    %rbp
+  802425:	c3                   	ret
+
+0000000000802426 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802426:	55                   	push   %rbp
+  802427:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80242a:	be 00 00 00 00       	mov    $0x0,%esi
+  80242f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802434:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802440:	85 c0                	test   %eax,%eax
+  802442:	ba 00 00 00 00       	mov    $0x0,%edx
+  802447:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80244a:	5d                   	pop    %rbp
+  80244b:	c3                   	ret
+
+000000000080244c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80244c:	55                   	push   %rbp
+  80244d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802450:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802457:	00 00 00 
+  80245a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80245d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80245f:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802462:	be 00 00 00 00       	mov    $0x0,%esi
+  802467:	bf 02 00 00 00       	mov    $0x2,%edi
+  80246c:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+}
+  802478:	5d                   	pop    %rbp
+  802479:	c3                   	ret
+
+000000000080247a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80247a:	55                   	push   %rbp
+  80247b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80247e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802481:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802488:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80248a:	be 00 00 00 00       	mov    $0x0,%esi
+  80248f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802494:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+}
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+
+00000000008024a2 <devfile_write>:
+    if (!fd || !buf) {
+  8024a2:	48 85 ff             	test   %rdi,%rdi
+  8024a5:	0f 84 c1 00 00 00    	je     80256c <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+  8024af:	41 57                	push   %r15
+  8024b1:	41 56                	push   %r14
+  8024b3:	41 55                	push   %r13
+  8024b5:	41 54                	push   %r12
+  8024b7:	53                   	push   %rbx
+  8024b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8024bc:	49 89 ff             	mov    %rdi,%r15
+  8024bf:	49 89 f5             	mov    %rsi,%r13
+  8024c2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8024c5:	48 85 f6             	test   %rsi,%rsi
+  8024c8:	0f 84 95 00 00 00    	je     802563 <devfile_write+0xc1>
+    while (n) {
+  8024ce:	48 85 d2             	test   %rdx,%rdx
+  8024d1:	0f 84 83 00 00 00    	je     80255a <devfile_write+0xb8>
+    int totalWrite = 0;
+  8024d7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024de:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8024e5:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8024e8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8024ed:	49 39 dc             	cmp    %rbx,%r12
+  8024f0:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8024f4:	48 89 da             	mov    %rbx,%rdx
+  8024f7:	4c 89 ee             	mov    %r13,%rsi
+  8024fa:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802501:	00 00 00 
+  802504:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802510:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802514:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802517:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80251b:	be 00 00 00 00       	mov    $0x0,%esi
+  802520:	bf 04 00 00 00       	mov    $0x4,%edi
+  802525:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  80252c:	00 00 00 
+  80252f:	ff d0                	call   *%rax
+        if (write < 0) {
+  802531:	85 c0                	test   %eax,%eax
+  802533:	78 21                	js     802556 <devfile_write+0xb4>
+        buf += write;
+  802535:	48 63 d0             	movslq %eax,%rdx
+  802538:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80253b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80253e:	49 29 d4             	sub    %rdx,%r12
+  802541:	75 a5                	jne    8024e8 <devfile_write+0x46>
+    return totalWrite;
+  802543:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802547:	48 83 c4 18          	add    $0x18,%rsp
+  80254b:	5b                   	pop    %rbx
+  80254c:	41 5c                	pop    %r12
+  80254e:	41 5d                	pop    %r13
+  802550:	41 5e                	pop    %r14
+  802552:	41 5f                	pop    %r15
+  802554:	5d                   	pop    %rbp
+  802555:	c3                   	ret
+            return write;
+  802556:	48 98                	cltq
+  802558:	eb ed                	jmp    802547 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80255a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802561:	eb e0                	jmp    802543 <devfile_write+0xa1>
+        return -E_INVAL;
+  802563:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80256a:	eb db                	jmp    802547 <devfile_write+0xa5>
+  80256c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802573:	c3                   	ret
+
+0000000000802574 <devfile_read>:
+    if (!fd || !buf) {
+  802574:	48 85 ff             	test   %rdi,%rdi
+  802577:	0f 84 c0 00 00 00    	je     80263d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	41 57                	push   %r15
+  802583:	41 56                	push   %r14
+  802585:	41 55                	push   %r13
+  802587:	41 54                	push   %r12
+  802589:	53                   	push   %rbx
+  80258a:	48 83 ec 18          	sub    $0x18,%rsp
+  80258e:	49 89 ff             	mov    %rdi,%r15
+  802591:	49 89 f5             	mov    %rsi,%r13
+  802594:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802597:	48 85 f6             	test   %rsi,%rsi
+  80259a:	0f 84 96 00 00 00    	je     802636 <devfile_read+0xc2>
+    while (n) {
+  8025a0:	48 85 d2             	test   %rdx,%rdx
+  8025a3:	0f 84 87 00 00 00    	je     802630 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8025a9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025b0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025b1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025b8:	00 00 00 
+  8025bb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025bf:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8025c2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025c7:	49 39 c4             	cmp    %rax,%r12
+  8025ca:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8025ce:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8025d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025dc:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	7e 37                	jle    802623 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8025ec:	48 63 d8             	movslq %eax,%rbx
+  8025ef:	48 89 da             	mov    %rbx,%rdx
+  8025f2:	4c 89 f6             	mov    %r14,%rsi
+  8025f5:	4c 89 ef             	mov    %r13,%rdi
+  8025f8:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+        buf += read;
+  802604:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802607:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80260b:	49 29 dc             	sub    %rbx,%r12
+  80260e:	75 ab                	jne    8025bb <devfile_read+0x47>
+  return totalRead;
+  802610:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802614:	48 83 c4 18          	add    $0x18,%rsp
+  802618:	5b                   	pop    %rbx
+  802619:	41 5c                	pop    %r12
+  80261b:	41 5d                	pop    %r13
+  80261d:	41 5e                	pop    %r14
+  80261f:	41 5f                	pop    %r15
+  802621:	5d                   	pop    %rbp
+  802622:	c3                   	ret
+            return read ? read : totalRead;
+  802623:	48 63 d0             	movslq %eax,%rdx
+  802626:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80262a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80262e:	eb e4                	jmp    802614 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802630:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802634:	eb da                	jmp    802610 <devfile_read+0x9c>
+        return E_INVAL;
+  802636:	b8 03 00 00 00       	mov    $0x3,%eax
+  80263b:	eb d7                	jmp    802614 <devfile_read+0xa0>
+  80263d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802642:	c3                   	ret
+
+0000000000802643 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802643:	48 85 ff             	test   %rdi,%rdi
+  802646:	74 5f                	je     8026a7 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802648:	55                   	push   %rbp
+  802649:	48 89 e5             	mov    %rsp,%rbp
+  80264c:	53                   	push   %rbx
+  80264d:	48 83 ec 08          	sub    $0x8,%rsp
+  802651:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802654:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  80265b:	00 00 00 
+  80265e:	ff d0                	call   *%rax
+  802660:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802666:	77 45                	ja     8026ad <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802668:	48 89 de             	mov    %rbx,%rsi
+  80266b:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802672:	00 00 00 
+  802675:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802681:	be 00 00 00 00       	mov    $0x0,%esi
+  802686:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80268b:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802697:	85 c0                	test   %eax,%eax
+  802699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026a5:	c9                   	leave
+  8026a6:	c3                   	ret
+        return -E_INVAL;
+  8026a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026ac:	c3                   	ret
+        return -E_INVAL;
+  8026ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b2:	eb ed                	jmp    8026a1 <devfile_receive_snapshot+0x5e>
+
+00000000008026b4 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8026b4:	55                   	push   %rbp
+  8026b5:	48 89 e5             	mov    %rsp,%rbp
+  8026b8:	41 55                	push   %r13
+  8026ba:	41 54                	push   %r12
+  8026bc:	53                   	push   %rbx
+  8026bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c1:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8026c4:	48 85 f6             	test   %rsi,%rsi
+  8026c7:	0f 94 c0             	sete   %al
+  8026ca:	48 85 d2             	test   %rdx,%rdx
+  8026cd:	0f 94 c2             	sete   %dl
+  8026d0:	08 d0                	or     %dl,%al
+  8026d2:	0f 85 ad 00 00 00    	jne    802785 <devfile_send_snapshot+0xd1>
+  8026d8:	48 89 fb             	mov    %rdi,%rbx
+  8026db:	49 89 f4             	mov    %rsi,%r12
+  8026de:	48 85 ff             	test   %rdi,%rdi
+  8026e1:	0f 84 9e 00 00 00    	je     802785 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8026e7:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026f9:	0f 87 8d 00 00 00    	ja     80278c <devfile_send_snapshot+0xd8>
+  8026ff:	4c 89 e7             	mov    %r12,%rdi
+  802702:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802709:	00 00 00 
+  80270c:	ff d0                	call   *%rax
+  80270e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802714:	77 7d                	ja     802793 <devfile_send_snapshot+0xdf>
+  802716:	4c 89 ef             	mov    %r13,%rdi
+  802719:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80272b:	77 6d                	ja     80279a <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80272d:	48 89 de             	mov    %rbx,%rsi
+  802730:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802737:	00 00 00 
+  80273a:	48 bb 32 0d 80 00 00 	movabs $0x800d32,%rbx
+  802741:	00 00 00 
+  802744:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802746:	4c 89 e6             	mov    %r12,%rsi
+  802749:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802750:	00 00 00 
+  802753:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802755:	4c 89 ee             	mov    %r13,%rsi
+  802758:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80275f:	00 00 00 
+  802762:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802764:	be 00 00 00 00       	mov    $0x0,%esi
+  802769:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80276e:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+}
+  80277a:	48 83 c4 08          	add    $0x8,%rsp
+  80277e:	5b                   	pop    %rbx
+  80277f:	41 5c                	pop    %r12
+  802781:	41 5d                	pop    %r13
+  802783:	5d                   	pop    %rbp
+  802784:	c3                   	ret
+        return -E_INVAL;
+  802785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80278a:	eb ee                	jmp    80277a <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80278c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802791:	eb e7                	jmp    80277a <devfile_send_snapshot+0xc6>
+  802793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802798:	eb e0                	jmp    80277a <devfile_send_snapshot+0xc6>
+  80279a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80279f:	eb d9                	jmp    80277a <devfile_send_snapshot+0xc6>
+
+00000000008027a1 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8027a1:	48 85 ff             	test   %rdi,%rdi
+  8027a4:	0f 84 41 01 00 00    	je     8028eb <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8027aa:	55                   	push   %rbp
+  8027ab:	48 89 e5             	mov    %rsp,%rbp
+  8027ae:	41 57                	push   %r15
+  8027b0:	41 56                	push   %r14
+  8027b2:	41 55                	push   %r13
+  8027b4:	41 54                	push   %r12
+  8027b6:	53                   	push   %rbx
+  8027b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bb:	49 89 fc             	mov    %rdi,%r12
+  8027be:	49 89 f5             	mov    %rsi,%r13
+  8027c1:	48 89 d3             	mov    %rdx,%rbx
+  8027c4:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8027c7:	48 85 f6             	test   %rsi,%rsi
+  8027ca:	0f 84 ff 00 00 00    	je     8028cf <devfile_diff_snapshots+0x12e>
+  8027d0:	48 85 d2             	test   %rdx,%rdx
+  8027d3:	0f 84 fd 00 00 00    	je     8028d6 <devfile_diff_snapshots+0x135>
+  8027d9:	48 85 c9             	test   %rcx,%rcx
+  8027dc:	0f 84 f4 00 00 00    	je     8028d6 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8027e2:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027f4:	0f 87 e3 00 00 00    	ja     8028dd <devfile_diff_snapshots+0x13c>
+  8027fa:	4c 89 ef             	mov    %r13,%rdi
+  8027fd:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+  802809:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80280f:	0f 87 cf 00 00 00    	ja     8028e4 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802815:	4c 89 e6             	mov    %r12,%rsi
+  802818:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80281f:	00 00 00 
+  802822:	4c 89 e7             	mov    %r12,%rdi
+  802825:	49 bf 32 0d 80 00 00 	movabs $0x800d32,%r15
+  80282c:	00 00 00 
+  80282f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802832:	4c 89 ee             	mov    %r13,%rsi
+  802835:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80283c:	00 
+  80283d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802840:	48 8b 03             	mov    (%rbx),%rax
+  802843:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80284a:	00 
+  80284b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80284f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802856:	00 
+  802857:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80285b:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802862:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802863:	be 00 00 00 00       	mov    $0x0,%esi
+  802868:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80286d:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 43                	js     8028c0 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80287d:	49 8b 04 24          	mov    (%r12),%rax
+  802881:	48 89 03             	mov    %rax,(%rbx)
+  802884:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802889:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80288d:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802892:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802896:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80289b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80289f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8028a3:	48 c1 e2 03          	shl    $0x3,%rdx
+  8028a7:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8028ac:	4c 89 f7             	mov    %r14,%rdi
+  8028af:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8028bb:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8028c0:	48 83 c4 08          	add    $0x8,%rsp
+  8028c4:	5b                   	pop    %rbx
+  8028c5:	41 5c                	pop    %r12
+  8028c7:	41 5d                	pop    %r13
+  8028c9:	41 5e                	pop    %r14
+  8028cb:	41 5f                	pop    %r15
+  8028cd:	5d                   	pop    %rbp
+  8028ce:	c3                   	ret
+        return -E_INVAL;
+  8028cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d4:	eb ea                	jmp    8028c0 <devfile_diff_snapshots+0x11f>
+  8028d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028db:	eb e3                	jmp    8028c0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8028dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e2:	eb dc                	jmp    8028c0 <devfile_diff_snapshots+0x11f>
+  8028e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e9:	eb d5                	jmp    8028c0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8028eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028f0:	c3                   	ret
+
+00000000008028f1 <devfile_delete_snapshot>:
+    if (!name) {
+  8028f1:	48 85 ff             	test   %rdi,%rdi
+  8028f4:	74 5f                	je     802955 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	53                   	push   %rbx
+  8028fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ff:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802902:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+  80290e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802914:	77 45                	ja     80295b <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802916:	48 89 de             	mov    %rbx,%rsi
+  802919:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802920:	00 00 00 
+  802923:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80292f:	be 00 00 00 00       	mov    $0x0,%esi
+  802934:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802939:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802940:	00 00 00 
+  802943:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802945:	85 c0                	test   %eax,%eax
+  802947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80294f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802953:	c9                   	leave
+  802954:	c3                   	ret
+        return -E_INVAL;
+  802955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80295a:	c3                   	ret
+        return -E_INVAL;
+  80295b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802960:	eb ed                	jmp    80294f <devfile_delete_snapshot+0x5e>
+
+0000000000802962 <devfile_accept_snapshot>:
+    if (!name) {
+  802962:	48 85 ff             	test   %rdi,%rdi
+  802965:	74 5f                	je     8029c6 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802967:	55                   	push   %rbp
+  802968:	48 89 e5             	mov    %rsp,%rbp
+  80296b:	53                   	push   %rbx
+  80296c:	48 83 ec 08          	sub    $0x8,%rsp
+  802970:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802973:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+  80297f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802985:	77 45                	ja     8029cc <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802987:	48 89 de             	mov    %rbx,%rsi
+  80298a:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802991:	00 00 00 
+  802994:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8029a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029aa:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029bd:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c4:	c9                   	leave
+  8029c5:	c3                   	ret
+        return -E_INVAL;
+  8029c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029cb:	c3                   	ret
+        return -E_INVAL;
+  8029cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d1:	eb ed                	jmp    8029c0 <devfile_accept_snapshot+0x5e>
+
+00000000008029d3 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8029d3:	48 85 ff             	test   %rdi,%rdi
+  8029d6:	0f 84 9f 00 00 00    	je     802a7b <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8029dc:	55                   	push   %rbp
+  8029dd:	48 89 e5             	mov    %rsp,%rbp
+  8029e0:	41 54                	push   %r12
+  8029e2:	53                   	push   %rbx
+  8029e3:	48 89 fb             	mov    %rdi,%rbx
+  8029e6:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8029e9:	48 85 f6             	test   %rsi,%rsi
+  8029ec:	74 78                	je     802a66 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8029ee:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+  8029fa:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a00:	77 6b                	ja     802a6d <devfile_create_snapshot+0x9a>
+  802a02:	4c 89 e7             	mov    %r12,%rdi
+  802a05:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a17:	77 5b                	ja     802a74 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802a19:	48 89 de             	mov    %rbx,%rsi
+  802a1c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a23:	00 00 00 
+  802a26:	48 bb 32 0d 80 00 00 	movabs $0x800d32,%rbx
+  802a2d:	00 00 00 
+  802a30:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802a32:	4c 89 e6             	mov    %r12,%rsi
+  802a35:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802a3c:	00 00 00 
+  802a3f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802a41:	be 00 00 00 00       	mov    $0x0,%esi
+  802a46:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a4b:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802a52:	00 00 00 
+  802a55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a57:	85 c0                	test   %eax,%eax
+  802a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a61:	5b                   	pop    %rbx
+  802a62:	41 5c                	pop    %r12
+  802a64:	5d                   	pop    %rbp
+  802a65:	c3                   	ret
+        return -E_INVAL;
+  802a66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6b:	eb f4                	jmp    802a61 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a72:	eb ed                	jmp    802a61 <devfile_create_snapshot+0x8e>
+  802a74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a79:	eb e6                	jmp    802a61 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802a7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a80:	c3                   	ret
+
+0000000000802a81 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a81:	55                   	push   %rbp
+  802a82:	48 89 e5             	mov    %rsp,%rbp
+  802a85:	41 54                	push   %r12
+  802a87:	53                   	push   %rbx
+  802a88:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a8b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a8e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802a95:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a97:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802aa1:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 3d                	js     802aee <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ab1:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802ab8:	00 00 00 
+  802abb:	4c 89 e6             	mov    %r12,%rsi
+  802abe:	48 89 df             	mov    %rbx,%rdi
+  802ac1:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802acd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ad4:	00 
+  802ad5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802adb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ae2:	00 
+  802ae3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aee:	5b                   	pop    %rbx
+  802aef:	41 5c                	pop    %r12
+  802af1:	5d                   	pop    %rbp
+  802af2:	c3                   	ret
+
+0000000000802af3 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	41 57                	push   %r15
+  802af9:	41 56                	push   %r14
+  802afb:	41 55                	push   %r13
+  802afd:	41 54                	push   %r12
+  802aff:	53                   	push   %rbx
+  802b00:	48 83 ec 38          	sub    $0x38,%rsp
+  802b04:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802b08:	49 89 f5             	mov    %rsi,%r13
+  802b0b:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b0e:	48 89 f0             	mov    %rsi,%rax
+  802b11:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b16:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b1a:	75 4f                	jne    802b6b <devfile_readmap+0x78>
+  802b1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b20:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b26:	75 1f                	jne    802b47 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802b28:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b2c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b30:	49 be e8 3b 80 00 00 	movabs $0x803be8,%r14
+  802b37:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b3a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802b41:	0f 87 9d 00 00 00    	ja     802be4 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802b47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b4b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802b4f:	4d 85 ff             	test   %r15,%r15
+  802b52:	0f 85 cf 00 00 00    	jne    802c27 <devfile_readmap+0x134>
+  802b58:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802b5c:	48 83 c4 38          	add    $0x38,%rsp
+  802b60:	5b                   	pop    %rbx
+  802b61:	41 5c                	pop    %r12
+  802b63:	41 5d                	pop    %r13
+  802b65:	41 5e                	pop    %r14
+  802b67:	41 5f                	pop    %r15
+  802b69:	5d                   	pop    %rbp
+  802b6a:	c3                   	ret
+    size_t totalRead = 0;
+  802b6b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802b72:	00 
+  802b73:	eb da                	jmp    802b4f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b75:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b79:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b7c:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802b83:	00 00 00 
+  802b86:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802b88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b8c:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802b90:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b94:	4c 89 ee             	mov    %r13,%rsi
+  802b97:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b9c:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  802ba3:	00 00 00 
+  802ba6:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	7e a3                	jle    802b4f <devfile_readmap+0x5c>
+  802bac:	48 98                	cltq
+  802bae:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802bb2:	72 9b                	jb     802b4f <devfile_readmap+0x5c>
+        buf += read;
+  802bb4:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802bb7:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802bba:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802bbe:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802bc5:	75 88                	jne    802b4f <devfile_readmap+0x5c>
+  802bc7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bcb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802bd1:	0f 85 78 ff ff ff    	jne    802b4f <devfile_readmap+0x5c>
+  802bd7:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802bde:	0f 86 6b ff ff ff    	jbe    802b4f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802be4:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802bea:	4d 39 e7             	cmp    %r12,%r15
+  802bed:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802bf1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802bf8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802bfc:	0f 84 73 ff ff ff    	je     802b75 <devfile_readmap+0x82>
+  802c02:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c06:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802c0b:	41 ff d6             	call   *%r14
+  802c0e:	a8 40                	test   $0x40,%al
+  802c10:	0f 85 39 ff ff ff    	jne    802b4f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c16:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c1d:	4c 39 e3             	cmp    %r12,%rbx
+  802c20:	72 e4                	jb     802c06 <devfile_readmap+0x113>
+  802c22:	e9 4e ff ff ff       	jmp    802b75 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802c27:	4c 89 fa             	mov    %r15,%rdx
+  802c2a:	4c 89 ee             	mov    %r13,%rsi
+  802c2d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c31:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802c38:	00 00 00 
+  802c3b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802c3d:	48 85 c0             	test   %rax,%rax
+  802c40:	78 0c                	js     802c4e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802c42:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c46:	48 01 f0             	add    %rsi,%rax
+  802c49:	e9 0e ff ff ff       	jmp    802b5c <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802c4e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c52:	48 85 f6             	test   %rsi,%rsi
+  802c55:	48 0f 45 c6          	cmovne %rsi,%rax
+  802c59:	e9 fe fe ff ff       	jmp    802b5c <devfile_readmap+0x69>
+
+0000000000802c5e <open>:
+open(const char *path, int mode) {
+  802c5e:	55                   	push   %rbp
+  802c5f:	48 89 e5             	mov    %rsp,%rbp
+  802c62:	41 55                	push   %r13
+  802c64:	41 54                	push   %r12
+  802c66:	53                   	push   %rbx
+  802c67:	48 83 ec 18          	sub    $0x18,%rsp
+  802c6b:	49 89 fc             	mov    %rdi,%r12
+  802c6e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c71:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802c78:	00 00 00 
+  802c7b:	ff d0                	call   *%rax
+  802c7d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c83:	0f 87 8a 00 00 00    	ja     802d13 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c89:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c8d:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+  802c99:	89 c3                	mov    %eax,%ebx
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	78 50                	js     802cef <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c9f:	4c 89 e6             	mov    %r12,%rsi
+  802ca2:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ca9:	00 00 00 
+  802cac:	48 89 df             	mov    %rbx,%rdi
+  802caf:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802cbb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802cc2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cc6:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ccb:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802cd2:	00 00 00 
+  802cd5:	ff d0                	call   *%rax
+  802cd7:	89 c3                	mov    %eax,%ebx
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	78 1f                	js     802cfc <open+0x9e>
+    return fd2num(fd);
+  802cdd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ce1:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  802ce8:	00 00 00 
+  802ceb:	ff d0                	call   *%rax
+  802ced:	89 c3                	mov    %eax,%ebx
+}
+  802cef:	89 d8                	mov    %ebx,%eax
+  802cf1:	48 83 c4 18          	add    $0x18,%rsp
+  802cf5:	5b                   	pop    %rbx
+  802cf6:	41 5c                	pop    %r12
+  802cf8:	41 5d                	pop    %r13
+  802cfa:	5d                   	pop    %rbp
+  802cfb:	c3                   	ret
+        fd_close(fd, 0);
+  802cfc:	be 00 00 00 00       	mov    $0x0,%esi
+  802d01:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d05:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+        return res;
+  802d11:	eb dc                	jmp    802cef <open+0x91>
+        return -E_BAD_PATH;
+  802d13:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d18:	eb d5                	jmp    802cef <open+0x91>
+
+0000000000802d1a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d23:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d28:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  802d2f:	00 00 00 
+  802d32:	ff d0                	call   *%rax
+}
+  802d34:	5d                   	pop    %rbp
+  802d35:	c3                   	ret
+
+0000000000802d36 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802d36:	55                   	push   %rbp
+  802d37:	48 89 e5             	mov    %rsp,%rbp
+  802d3a:	41 55                	push   %r13
+  802d3c:	41 54                	push   %r12
+  802d3e:	53                   	push   %rbx
+  802d3f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d43:	48 89 fb             	mov    %rdi,%rbx
+  802d46:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802d49:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802d4c:	48 b8 e8 3b 80 00 00 	movabs $0x803be8,%rax
+  802d53:	00 00 00 
+  802d56:	ff d0                	call   *%rax
+  802d58:	41 89 c1             	mov    %eax,%r9d
+  802d5b:	4d 89 e0             	mov    %r12,%r8
+  802d5e:	49 29 d8             	sub    %rbx,%r8
+  802d61:	48 89 d9             	mov    %rbx,%rcx
+  802d64:	44 89 ea             	mov    %r13d,%edx
+  802d67:	48 89 de             	mov    %rbx,%rsi
+  802d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6f:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  802d76:	00 00 00 
+  802d79:	ff d0                	call   *%rax
+}
+  802d7b:	48 83 c4 08          	add    $0x8,%rsp
+  802d7f:	5b                   	pop    %rbx
+  802d80:	41 5c                	pop    %r12
+  802d82:	41 5d                	pop    %r13
+  802d84:	5d                   	pop    %rbp
+  802d85:	c3                   	ret
+
+0000000000802d86 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802d86:	55                   	push   %rbp
+  802d87:	48 89 e5             	mov    %rsp,%rbp
+  802d8a:	41 57                	push   %r15
+  802d8c:	41 56                	push   %r14
+  802d8e:	41 55                	push   %r13
+  802d90:	41 54                	push   %r12
+  802d92:	53                   	push   %rbx
+  802d93:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802d9a:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  802d9d:	be 00 00 00 00       	mov    $0x0,%esi
+  802da2:	48 b8 5e 2c 80 00 00 	movabs $0x802c5e,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+  802dae:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  802db4:	85 c0                	test   %eax,%eax
+  802db6:	0f 88 10 04 00 00    	js     8031cc <spawn+0x446>
+  802dbc:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802dbe:	ba 00 02 00 00       	mov    $0x200,%edx
+  802dc3:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802dca:	48 b8 88 1c 80 00 00 	movabs $0x801c88,%rax
+  802dd1:	00 00 00 
+  802dd4:	ff d0                	call   *%rax
+  802dd6:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802dd8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802ddd:	0f 85 85 02 00 00    	jne    803068 <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802de3:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802dea:	ff ff 00 
+  802ded:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802df4:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802dfb:	01 01 00 
+  802dfe:	48 39 d0             	cmp    %rdx,%rax
+  802e01:	0f 85 9d 02 00 00    	jne    8030a4 <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802e07:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802e0e:	00 3e 00 
+  802e11:	0f 85 8d 02 00 00    	jne    8030a4 <spawn+0x31e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802e17:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e1c:	cd 30                	int    $0x30
+  802e1e:	41 89 c6             	mov    %eax,%r14d
+  802e21:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802e23:	85 c0                	test   %eax,%eax
+  802e25:	0f 88 89 03 00 00    	js     8031b4 <spawn+0x42e>
+    envid_t child = res;
+  802e2b:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802e31:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e36:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802e3a:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  802e3e:	48 c1 e0 04          	shl    $0x4,%rax
+  802e42:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802e49:	00 00 00 
+  802e4c:	48 01 c6             	add    %rax,%rsi
+  802e4f:	48 8b 06             	mov    (%rsi),%rax
+  802e52:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802e59:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802e60:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802e67:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802e6e:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802e75:	48 29 c6             	sub    %rax,%rsi
+  802e78:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  802e7e:	89 c8                	mov    %ecx,%eax
+  802e80:	c1 e8 03             	shr    $0x3,%eax
+  802e83:	89 c1                	mov    %eax,%ecx
+  802e85:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802e88:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  802e8f:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802e96:	49 8b 3f             	mov    (%r15),%rdi
+  802e99:	48 85 ff             	test   %rdi,%rdi
+  802e9c:	0f 84 41 06 00 00    	je     8034e3 <spawn+0x75d>
+  802ea2:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  802ea7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  802ead:	49 bc f4 0c 80 00 00 	movabs $0x800cf4,%r12
+  802eb4:	00 00 00 
+  802eb7:	41 ff d4             	call   *%r12
+  802eba:	4c 01 e8             	add    %r13,%rax
+  802ebd:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  802ec1:	48 89 da             	mov    %rbx,%rdx
+  802ec4:	48 83 c3 01          	add    $0x1,%rbx
+  802ec8:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  802ecd:	48 85 ff             	test   %rdi,%rdi
+  802ed0:	75 e5                	jne    802eb7 <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802ed2:	48 f7 d0             	not    %rax
+  802ed5:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802edc:	4d 89 e5             	mov    %r12,%r13
+  802edf:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  802ee3:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  802eea:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  802ef1:	89 d0                	mov    %edx,%eax
+  802ef3:	83 c0 01             	add    $0x1,%eax
+  802ef6:	48 98                	cltq
+  802ef8:	48 c1 e0 03          	shl    $0x3,%rax
+  802efc:	49 29 c5             	sub    %rax,%r13
+  802eff:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802f06:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  802f0a:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802f10:	0f 86 c3 05 00 00    	jbe    8034d9 <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802f16:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f1b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802f20:	be 00 00 40 00       	mov    $0x400000,%esi
+  802f25:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	89 c3                	mov    %eax,%ebx
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	0f 88 67 02 00 00    	js     8031a2 <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  802f3b:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  802f42:	85 d2                	test   %edx,%edx
+  802f44:	7e 54                	jle    802f9a <spawn+0x214>
+  802f46:	4c 89 fb             	mov    %r15,%rbx
+  802f49:	48 63 c2             	movslq %edx,%rax
+  802f4c:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802f51:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802f58:	00 00 00 
+  802f5b:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  802f62:	ff 
+  802f63:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802f67:	48 8b 33             	mov    (%rbx),%rsi
+  802f6a:	4c 89 e7             	mov    %r12,%rdi
+  802f6d:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802f79:	48 8b 3b             	mov    (%rbx),%rdi
+  802f7c:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  802f83:	00 00 00 
+  802f86:	ff d0                	call   *%rax
+  802f88:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  802f8d:	49 83 c5 08          	add    $0x8,%r13
+  802f91:	48 83 c3 08          	add    $0x8,%rbx
+  802f95:	4d 39 fd             	cmp    %r15,%r13
+  802f98:	75 b7                	jne    802f51 <spawn+0x1cb>
+    argv_store[argc] = 0;
+  802f9a:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802fa1:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802fa8:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802fa9:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  802fb0:	0f 85 35 01 00 00    	jne    8030eb <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802fb6:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  802fbd:	00 00 00 
+  802fc0:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  802fc7:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  802fce:	ff 
+  802fcf:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802fd3:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  802fda:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  802fde:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802fe5:	00 00 00 
+  802fe8:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802fef:	ff 
+  802ff0:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  802ff7:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  802ffd:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803003:	44 89 f2             	mov    %r14d,%edx
+  803006:	be 00 00 40 00       	mov    $0x400000,%esi
+  80300b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803010:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  803017:	00 00 00 
+  80301a:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80301c:	48 bb 8a 14 80 00 00 	movabs $0x80148a,%rbx
+  803023:	00 00 00 
+  803026:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80302b:	be 00 00 40 00       	mov    $0x400000,%esi
+  803030:	bf 00 00 00 00       	mov    $0x0,%edi
+  803035:	ff d3                	call   *%rbx
+  803037:	85 c0                	test   %eax,%eax
+  803039:	78 eb                	js     803026 <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80303b:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803042:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  803049:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80304a:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803051:	00 
+  803052:	0f 84 7e 03 00 00    	je     8033d6 <spawn+0x650>
+  803058:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  80305f:	00 00 00 00 
+  803063:	e9 c0 01 00 00       	jmp    803228 <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803068:	48 bf 60 48 80 00 00 	movabs $0x804860,%rdi
+  80306f:	00 00 00 
+  803072:	b8 00 00 00 00       	mov    $0x0,%eax
+  803077:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  80307e:	00 00 00 
+  803081:	ff d2                	call   *%rdx
+        close(fd);
+  803083:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803089:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  803090:	00 00 00 
+  803093:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803095:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80309c:	ff ff ff 
+  80309f:	e9 28 01 00 00       	jmp    8031cc <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8030a4:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8030a9:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8030af:	48 bf 61 49 80 00 00 	movabs $0x804961,%rdi
+  8030b6:	00 00 00 
+  8030b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030be:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  8030c5:	00 00 00 
+  8030c8:	ff d1                	call   *%rcx
+        close(fd);
+  8030ca:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8030d0:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  8030d7:	00 00 00 
+  8030da:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8030dc:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8030e3:	ff ff ff 
+  8030e6:	e9 e1 00 00 00       	jmp    8031cc <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8030eb:	48 b9 90 48 80 00 00 	movabs $0x804890,%rcx
+  8030f2:	00 00 00 
+  8030f5:	48 ba 7b 49 80 00 00 	movabs $0x80497b,%rdx
+  8030fc:	00 00 00 
+  8030ff:	be f0 00 00 00       	mov    $0xf0,%esi
+  803104:	48 bf 90 49 80 00 00 	movabs $0x804990,%rdi
+  80310b:	00 00 00 
+  80310e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803113:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  80311a:	00 00 00 
+  80311d:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  803120:	89 c3                	mov    %eax,%ebx
+  803122:	89 c6                	mov    %eax,%esi
+  803124:	48 bf c0 48 80 00 00 	movabs $0x8048c0,%rdi
+  80312b:	00 00 00 
+  80312e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803133:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  80313a:	00 00 00 
+  80313d:	ff d2                	call   *%rdx
+            return res;
+  80313f:	eb 61                	jmp    8031a2 <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  803141:	89 c3                	mov    %eax,%ebx
+  803143:	89 c6                	mov    %eax,%esi
+  803145:	48 bf e8 48 80 00 00 	movabs $0x8048e8,%rdi
+  80314c:	00 00 00 
+  80314f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803154:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  80315b:	00 00 00 
+  80315e:	ff d2                	call   *%rdx
+        return res;
+  803160:	eb 40                	jmp    8031a2 <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  803162:	89 c3                	mov    %eax,%ebx
+  803164:	89 c6                	mov    %eax,%esi
+  803166:	48 bf 9c 49 80 00 00 	movabs $0x80499c,%rdi
+  80316d:	00 00 00 
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+  803175:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  80317c:	00 00 00 
+  80317f:	ff d2                	call   *%rdx
+        return res;
+  803181:	eb 1f                	jmp    8031a2 <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  803183:	89 c3                	mov    %eax,%ebx
+  803185:	89 c6                	mov    %eax,%esi
+  803187:	48 bf b9 49 80 00 00 	movabs $0x8049b9,%rdi
+  80318e:	00 00 00 
+  803191:	b8 00 00 00 00       	mov    $0x0,%eax
+  803196:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  80319d:	00 00 00 
+  8031a0:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  8031a2:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8031a8:	48 b8 93 12 80 00 00 	movabs $0x801293,%rax
+  8031af:	00 00 00 
+  8031b2:	ff d0                	call   *%rax
+    close(fd);
+  8031b4:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8031ba:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+    return res;
+  8031c6:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  8031cc:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  8031d2:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  8031d9:	5b                   	pop    %rbx
+  8031da:	41 5c                	pop    %r12
+  8031dc:	41 5d                	pop    %r13
+  8031de:	41 5e                	pop    %r14
+  8031e0:	41 5f                	pop    %r15
+  8031e2:	5d                   	pop    %rbp
+  8031e3:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  8031e4:	89 c3                	mov    %eax,%ebx
+  8031e6:	89 c6                	mov    %eax,%esi
+  8031e8:	48 bf 10 49 80 00 00 	movabs $0x804910,%rdi
+  8031ef:	00 00 00 
+  8031f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f7:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  8031fe:	00 00 00 
+  803201:	ff d2                	call   *%rdx
+        return res;
+  803203:	eb 9d                	jmp    8031a2 <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803205:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  80320c:	01 
+  80320d:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  803214:	48 83 c3 38          	add    $0x38,%rbx
+  803218:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80321f:	48 39 c1             	cmp    %rax,%rcx
+  803222:	0f 83 ae 01 00 00    	jae    8033d6 <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803228:	83 3b 01             	cmpl   $0x1,(%rbx)
+  80322b:	75 d8                	jne    803205 <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80322d:	8b 43 04             	mov    0x4(%rbx),%eax
+  803230:	41 89 c6             	mov    %eax,%r14d
+  803233:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803237:	44 89 f2             	mov    %r14d,%edx
+  80323a:	83 ca 04             	or     $0x4,%edx
+  80323d:	a8 04                	test   $0x4,%al
+  80323f:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803243:	44 89 f2             	mov    %r14d,%edx
+  803246:	83 ca 01             	or     $0x1,%edx
+  803249:	a8 01                	test   $0x1,%al
+  80324b:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80324f:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  803253:	41 89 cc             	mov    %ecx,%r12d
+  803256:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80325a:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  80325e:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  803262:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803268:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  80326e:	44 89 fe             	mov    %r15d,%esi
+  803271:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803277:	74 0f                	je     803288 <spawn+0x502>
+        va -= res;
+  803279:	48 63 fe             	movslq %esi,%rdi
+  80327c:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  80327f:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  803282:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  803285:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803288:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  80328f:	00 
+  803290:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803297:	49 89 f5             	mov    %rsi,%r13
+  80329a:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  80329d:	49 39 d5             	cmp    %rdx,%r13
+  8032a0:	73 23                	jae    8032c5 <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  8032a2:	4c 01 fa             	add    %r15,%rdx
+  8032a5:	48 29 f2             	sub    %rsi,%rdx
+  8032a8:	44 89 f1             	mov    %r14d,%ecx
+  8032ab:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8032b1:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  8032b8:	00 00 00 
+  8032bb:	ff d0                	call   *%rax
+        if (res < 0) {
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	0f 88 5b fe ff ff    	js     803120 <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  8032c5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8032ca:	4c 89 ea             	mov    %r13,%rdx
+  8032cd:	be 00 00 40 00       	mov    $0x400000,%esi
+  8032d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d7:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8032e3:	85 c0                	test   %eax,%eax
+  8032e5:	0f 88 56 fe ff ff    	js     803141 <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  8032eb:	44 89 e6             	mov    %r12d,%esi
+  8032ee:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8032f4:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+    if (res < 0) {
+  803300:	85 c0                	test   %eax,%eax
+  803302:	0f 88 5a fe ff ff    	js     803162 <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  803308:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80330e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803313:	4d 85 ed             	test   %r13,%r13
+  803316:	74 48                	je     803360 <spawn+0x5da>
+  803318:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  80331f:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  803325:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  80332c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803331:	89 df                	mov    %ebx,%edi
+  803333:	48 b8 88 1c 80 00 00 	movabs $0x801c88,%rax
+  80333a:	00 00 00 
+  80333d:	ff d0                	call   *%rax
+        if (res < 0) {
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	0f 88 3c fe ff ff    	js     803183 <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  803347:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  80334e:	00 
+  80334f:	41 89 c4             	mov    %eax,%r12d
+  803352:	48 98                	cltq
+  803354:	4c 39 e8             	cmp    %r13,%rax
+  803357:	72 cc                	jb     803325 <spawn+0x59f>
+  803359:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  803360:	45 89 f1             	mov    %r14d,%r9d
+  803363:	41 80 c9 80          	or     $0x80,%r9b
+  803367:	4d 89 e8             	mov    %r13,%r8
+  80336a:	4c 89 f9             	mov    %r15,%rcx
+  80336d:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803373:	be 00 00 40 00       	mov    $0x400000,%esi
+  803378:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337d:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  803384:	00 00 00 
+  803387:	ff d0                	call   *%rax
+    if (res < 0) {
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	0f 88 53 fe ff ff    	js     8031e4 <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  803391:	4c 89 ea             	mov    %r13,%rdx
+  803394:	be 00 00 40 00       	mov    $0x400000,%esi
+  803399:	bf 00 00 00 00       	mov    $0x0,%edi
+  80339e:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8033aa:	85 c0                	test   %eax,%eax
+  8033ac:	0f 89 53 fe ff ff    	jns    803205 <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  8033b2:	89 c3                	mov    %eax,%ebx
+  8033b4:	89 c6                	mov    %eax,%esi
+  8033b6:	48 bf 38 49 80 00 00 	movabs $0x804938,%rdi
+  8033bd:	00 00 00 
+  8033c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c5:	48 ba 0d 04 80 00 00 	movabs $0x80040d,%rdx
+  8033cc:	00 00 00 
+  8033cf:	ff d2                	call   *%rdx
+        return res;
+  8033d1:	e9 cc fd ff ff       	jmp    8031a2 <spawn+0x41c>
+    close(fd);
+  8033d6:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8033dc:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8033e8:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8033ef:	48 bf 36 2d 80 00 00 	movabs $0x802d36,%rdi
+  8033f6:	00 00 00 
+  8033f9:	48 b8 75 3c 80 00 00 	movabs $0x803c75,%rax
+  803400:	00 00 00 
+  803403:	ff d0                	call   *%rax
+  803405:	85 c0                	test   %eax,%eax
+  803407:	78 49                	js     803452 <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803409:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803410:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803416:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+  803422:	85 c0                	test   %eax,%eax
+  803424:	78 59                	js     80347f <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803426:	be 02 00 00 00       	mov    $0x2,%esi
+  80342b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803431:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+  80343d:	85 c0                	test   %eax,%eax
+  80343f:	78 6b                	js     8034ac <spawn+0x726>
+    return child;
+  803441:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803447:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  80344d:	e9 7a fd ff ff       	jmp    8031cc <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  803452:	89 c1                	mov    %eax,%ecx
+  803454:	48 ba d7 49 80 00 00 	movabs $0x8049d7,%rdx
+  80345b:	00 00 00 
+  80345e:	be 84 00 00 00       	mov    $0x84,%esi
+  803463:	48 bf 90 49 80 00 00 	movabs $0x804990,%rdi
+  80346a:	00 00 00 
+  80346d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803472:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  803479:	00 00 00 
+  80347c:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  80347f:	89 c1                	mov    %eax,%ecx
+  803481:	48 ba ee 49 80 00 00 	movabs $0x8049ee,%rdx
+  803488:	00 00 00 
+  80348b:	be 87 00 00 00       	mov    $0x87,%esi
+  803490:	48 bf 90 49 80 00 00 	movabs $0x804990,%rdi
+  803497:	00 00 00 
+  80349a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349f:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  8034a6:	00 00 00 
+  8034a9:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8034ac:	89 c1                	mov    %eax,%ecx
+  8034ae:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  8034b5:	00 00 00 
+  8034b8:	be 8a 00 00 00       	mov    $0x8a,%esi
+  8034bd:	48 bf 90 49 80 00 00 	movabs $0x804990,%rdi
+  8034c4:	00 00 00 
+  8034c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cc:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  8034d3:	00 00 00 
+  8034d6:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8034d9:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8034de:	e9 bf fc ff ff       	jmp    8031a2 <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8034e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8034e8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8034ed:	be 00 00 40 00       	mov    $0x400000,%esi
+  8034f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f7:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+  803503:	89 c3                	mov    %eax,%ebx
+  803505:	85 c0                	test   %eax,%eax
+  803507:	0f 88 95 fc ff ff    	js     8031a2 <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  80350d:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803514:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803518:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  80351f:	f8 ff 40 00 
+  803523:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  80352a:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80352e:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  803534:	e9 61 fa ff ff       	jmp    802f9a <spawn+0x214>
+
+0000000000803539 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803539:	55                   	push   %rbp
+  80353a:	48 89 e5             	mov    %rsp,%rbp
+  80353d:	48 83 ec 50          	sub    $0x50,%rsp
+  803541:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803545:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803549:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80354d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803551:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803558:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80355c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803560:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803564:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803568:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80356d:	eb 15                	jmp    803584 <spawnl+0x4b>
+  80356f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803573:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803577:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80357b:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80357f:	74 1c                	je     80359d <spawnl+0x64>
+  803581:	83 c1 01             	add    $0x1,%ecx
+  803584:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803587:	83 f8 2f             	cmp    $0x2f,%eax
+  80358a:	77 e3                	ja     80356f <spawnl+0x36>
+  80358c:	89 c2                	mov    %eax,%edx
+  80358e:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803592:	4c 01 d2             	add    %r10,%rdx
+  803595:	83 c0 08             	add    $0x8,%eax
+  803598:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80359b:	eb de                	jmp    80357b <spawnl+0x42>
+    const char *argv[argc + 2];
+  80359d:	8d 41 02             	lea    0x2(%rcx),%eax
+  8035a0:	48 98                	cltq
+  8035a2:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8035a9:	00 
+  8035aa:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8035ae:	48 29 c4             	sub    %rax,%rsp
+  8035b1:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8035b6:	4c 89 c0             	mov    %r8,%rax
+  8035b9:	48 c1 e8 03          	shr    $0x3,%rax
+  8035bd:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8035c1:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8035c8:	00 
+    argv[argc + 1] = NULL;
+  8035c9:	8d 41 01             	lea    0x1(%rcx),%eax
+  8035cc:	48 98                	cltq
+  8035ce:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8035d5:	00 
+    va_start(vl, arg0);
+  8035d6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8035dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035e5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8035ed:	85 c9                	test   %ecx,%ecx
+  8035ef:	74 41                	je     803632 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8035f1:	49 89 c1             	mov    %rax,%r9
+  8035f4:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8035f8:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8035fb:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803600:	eb 1b                	jmp    80361d <spawnl+0xe4>
+  803602:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803606:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  80360a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80360e:	48 8b 11             	mov    (%rcx),%rdx
+  803611:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803614:	48 83 c0 08          	add    $0x8,%rax
+  803618:	48 39 f0             	cmp    %rsi,%rax
+  80361b:	74 15                	je     803632 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80361d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803620:	83 fa 2f             	cmp    $0x2f,%edx
+  803623:	77 dd                	ja     803602 <spawnl+0xc9>
+  803625:	89 d1                	mov    %edx,%ecx
+  803627:	4c 01 c9             	add    %r9,%rcx
+  80362a:	83 c2 08             	add    $0x8,%edx
+  80362d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803630:	eb dc                	jmp    80360e <spawnl+0xd5>
+    return spawn(prog, argv);
+  803632:	4c 89 c6             	mov    %r8,%rsi
+  803635:	48 b8 86 2d 80 00 00 	movabs $0x802d86,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+}
+  803641:	c9                   	leave
+  803642:	c3                   	ret
+
+0000000000803643 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803643:	55                   	push   %rbp
+  803644:	48 89 e5             	mov    %rsp,%rbp
+  803647:	41 54                	push   %r12
+  803649:	53                   	push   %rbx
+  80364a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80364d:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+  803659:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80365c:	48 be 1f 4a 80 00 00 	movabs $0x804a1f,%rsi
+  803663:	00 00 00 
+  803666:	48 89 df             	mov    %rbx,%rdi
+  803669:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803675:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80367a:	41 2b 04 24          	sub    (%r12),%eax
+  80367e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803684:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80368b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80368e:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803695:	00 00 00 
+  803698:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80369f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a4:	5b                   	pop    %rbx
+  8036a5:	41 5c                	pop    %r12
+  8036a7:	5d                   	pop    %rbp
+  8036a8:	c3                   	ret
+
+00000000008036a9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8036a9:	55                   	push   %rbp
+  8036aa:	48 89 e5             	mov    %rsp,%rbp
+  8036ad:	41 54                	push   %r12
+  8036af:	53                   	push   %rbx
+  8036b0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8036b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036b8:	48 89 fe             	mov    %rdi,%rsi
+  8036bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c0:	49 bc 8a 14 80 00 00 	movabs $0x80148a,%r12
+  8036c7:	00 00 00 
+  8036ca:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8036cd:	48 89 df             	mov    %rbx,%rdi
+  8036d0:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	48 89 c6             	mov    %rax,%rsi
+  8036df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e9:	41 ff d4             	call   *%r12
+}
+  8036ec:	5b                   	pop    %rbx
+  8036ed:	41 5c                	pop    %r12
+  8036ef:	5d                   	pop    %rbp
+  8036f0:	c3                   	ret
+
+00000000008036f1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036f1:	55                   	push   %rbp
+  8036f2:	48 89 e5             	mov    %rsp,%rbp
+  8036f5:	41 57                	push   %r15
+  8036f7:	41 56                	push   %r14
+  8036f9:	41 55                	push   %r13
+  8036fb:	41 54                	push   %r12
+  8036fd:	53                   	push   %rbx
+  8036fe:	48 83 ec 18          	sub    $0x18,%rsp
+  803702:	49 89 fc             	mov    %rdi,%r12
+  803705:	49 89 f5             	mov    %rsi,%r13
+  803708:	49 89 d7             	mov    %rdx,%r15
+  80370b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80370f:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  803716:	00 00 00 
+  803719:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80371b:	4d 85 ff             	test   %r15,%r15
+  80371e:	0f 84 af 00 00 00    	je     8037d3 <devpipe_write+0xe2>
+  803724:	48 89 c3             	mov    %rax,%rbx
+  803727:	4c 89 f8             	mov    %r15,%rax
+  80372a:	4d 89 ef             	mov    %r13,%r15
+  80372d:	4c 01 e8             	add    %r13,%rax
+  803730:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803734:	49 bd 92 13 80 00 00 	movabs $0x801392,%r13
+  80373b:	00 00 00 
+            sys_yield();
+  80373e:	49 be 2f 13 80 00 00 	movabs $0x80132f,%r14
+  803745:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803748:	8b 73 04             	mov    0x4(%rbx),%esi
+  80374b:	48 63 ce             	movslq %esi,%rcx
+  80374e:	48 63 03             	movslq (%rbx),%rax
+  803751:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803757:	48 39 c1             	cmp    %rax,%rcx
+  80375a:	72 2e                	jb     80378a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80375c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803761:	48 89 da             	mov    %rbx,%rdx
+  803764:	be 00 10 00 00       	mov    $0x1000,%esi
+  803769:	4c 89 e7             	mov    %r12,%rdi
+  80376c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80376f:	85 c0                	test   %eax,%eax
+  803771:	74 66                	je     8037d9 <devpipe_write+0xe8>
+            sys_yield();
+  803773:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803776:	8b 73 04             	mov    0x4(%rbx),%esi
+  803779:	48 63 ce             	movslq %esi,%rcx
+  80377c:	48 63 03             	movslq (%rbx),%rax
+  80377f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803785:	48 39 c1             	cmp    %rax,%rcx
+  803788:	73 d2                	jae    80375c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80378a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80378e:	48 89 ca             	mov    %rcx,%rdx
+  803791:	48 c1 ea 03          	shr    $0x3,%rdx
+  803795:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80379c:	08 10 20 
+  80379f:	48 f7 e2             	mul    %rdx
+  8037a2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8037a6:	48 89 d0             	mov    %rdx,%rax
+  8037a9:	48 c1 e0 09          	shl    $0x9,%rax
+  8037ad:	48 29 d0             	sub    %rdx,%rax
+  8037b0:	48 c1 e0 03          	shl    $0x3,%rax
+  8037b4:	48 29 c1             	sub    %rax,%rcx
+  8037b7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037bc:	83 c6 01             	add    $0x1,%esi
+  8037bf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037c2:	49 83 c7 01          	add    $0x1,%r15
+  8037c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037ca:	49 39 c7             	cmp    %rax,%r15
+  8037cd:	0f 85 75 ff ff ff    	jne    803748 <devpipe_write+0x57>
+    return n;
+  8037d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8037d7:	eb 05                	jmp    8037de <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037de:	48 83 c4 18          	add    $0x18,%rsp
+  8037e2:	5b                   	pop    %rbx
+  8037e3:	41 5c                	pop    %r12
+  8037e5:	41 5d                	pop    %r13
+  8037e7:	41 5e                	pop    %r14
+  8037e9:	41 5f                	pop    %r15
+  8037eb:	5d                   	pop    %rbp
+  8037ec:	c3                   	ret
+
+00000000008037ed <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8037ed:	55                   	push   %rbp
+  8037ee:	48 89 e5             	mov    %rsp,%rbp
+  8037f1:	41 57                	push   %r15
+  8037f3:	41 56                	push   %r14
+  8037f5:	41 55                	push   %r13
+  8037f7:	41 54                	push   %r12
+  8037f9:	53                   	push   %rbx
+  8037fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8037fe:	49 89 fc             	mov    %rdi,%r12
+  803801:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803805:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803809:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  803810:	00 00 00 
+  803813:	ff d0                	call   *%rax
+  803815:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803818:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80381e:	49 bd 92 13 80 00 00 	movabs $0x801392,%r13
+  803825:	00 00 00 
+            sys_yield();
+  803828:	49 be 2f 13 80 00 00 	movabs $0x80132f,%r14
+  80382f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803832:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803837:	74 7d                	je     8038b6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803839:	8b 03                	mov    (%rbx),%eax
+  80383b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80383e:	75 26                	jne    803866 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803840:	4d 85 ff             	test   %r15,%r15
+  803843:	75 77                	jne    8038bc <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803845:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80384a:	48 89 da             	mov    %rbx,%rdx
+  80384d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803852:	4c 89 e7             	mov    %r12,%rdi
+  803855:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803858:	85 c0                	test   %eax,%eax
+  80385a:	74 72                	je     8038ce <devpipe_read+0xe1>
+            sys_yield();
+  80385c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80385f:	8b 03                	mov    (%rbx),%eax
+  803861:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803864:	74 df                	je     803845 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803866:	48 63 c8             	movslq %eax,%rcx
+  803869:	48 89 ca             	mov    %rcx,%rdx
+  80386c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803870:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803877:	08 10 20 
+  80387a:	48 89 d0             	mov    %rdx,%rax
+  80387d:	48 f7 e6             	mul    %rsi
+  803880:	48 c1 ea 06          	shr    $0x6,%rdx
+  803884:	48 89 d0             	mov    %rdx,%rax
+  803887:	48 c1 e0 09          	shl    $0x9,%rax
+  80388b:	48 29 d0             	sub    %rdx,%rax
+  80388e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803895:	00 
+  803896:	48 89 c8             	mov    %rcx,%rax
+  803899:	48 29 d0             	sub    %rdx,%rax
+  80389c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8038a1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8038a5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8038a9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8038ac:	49 83 c7 01          	add    $0x1,%r15
+  8038b0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8038b4:	75 83                	jne    803839 <devpipe_read+0x4c>
+    return n;
+  8038b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ba:	eb 03                	jmp    8038bf <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8038bc:	4c 89 f8             	mov    %r15,%rax
+}
+  8038bf:	48 83 c4 18          	add    $0x18,%rsp
+  8038c3:	5b                   	pop    %rbx
+  8038c4:	41 5c                	pop    %r12
+  8038c6:	41 5d                	pop    %r13
+  8038c8:	41 5e                	pop    %r14
+  8038ca:	41 5f                	pop    %r15
+  8038cc:	5d                   	pop    %rbp
+  8038cd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8038ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d3:	eb ea                	jmp    8038bf <devpipe_read+0xd2>
+
+00000000008038d5 <pipe>:
+pipe(int pfd[2]) {
+  8038d5:	55                   	push   %rbp
+  8038d6:	48 89 e5             	mov    %rsp,%rbp
+  8038d9:	41 55                	push   %r13
+  8038db:	41 54                	push   %r12
+  8038dd:	53                   	push   %rbx
+  8038de:	48 83 ec 18          	sub    $0x18,%rsp
+  8038e2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8038e5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8038e9:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+  8038f5:	89 c3                	mov    %eax,%ebx
+  8038f7:	85 c0                	test   %eax,%eax
+  8038f9:	0f 88 a0 01 00 00    	js     803a9f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8038ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803904:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803909:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80390d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803912:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+  80391e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803920:	85 c0                	test   %eax,%eax
+  803922:	0f 88 77 01 00 00    	js     803a9f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803928:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80392c:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+  803938:	89 c3                	mov    %eax,%ebx
+  80393a:	85 c0                	test   %eax,%eax
+  80393c:	0f 88 43 01 00 00    	js     803a85 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803942:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803947:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80394c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803950:	bf 00 00 00 00       	mov    $0x0,%edi
+  803955:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+  803961:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803963:	85 c0                	test   %eax,%eax
+  803965:	0f 88 1a 01 00 00    	js     803a85 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80396b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80396f:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  803976:	00 00 00 
+  803979:	ff d0                	call   *%rax
+  80397b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80397e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803983:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803988:	48 89 c6             	mov    %rax,%rsi
+  80398b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803990:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  803997:	00 00 00 
+  80399a:	ff d0                	call   *%rax
+  80399c:	89 c3                	mov    %eax,%ebx
+  80399e:	85 c0                	test   %eax,%eax
+  8039a0:	0f 88 c5 00 00 00    	js     803a6b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8039a6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8039aa:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  8039b1:	00 00 00 
+  8039b4:	ff d0                	call   *%rax
+  8039b6:	48 89 c1             	mov    %rax,%rcx
+  8039b9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8039bf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8039c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039ca:	4c 89 ee             	mov    %r13,%rsi
+  8039cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d2:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  8039d9:	00 00 00 
+  8039dc:	ff d0                	call   *%rax
+  8039de:	89 c3                	mov    %eax,%ebx
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	78 6e                	js     803a52 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8039e4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039e9:	4c 89 ef             	mov    %r13,%rdi
+  8039ec:	48 b8 60 13 80 00 00 	movabs $0x801360,%rax
+  8039f3:	00 00 00 
+  8039f6:	ff d0                	call   *%rax
+  8039f8:	83 f8 02             	cmp    $0x2,%eax
+  8039fb:	0f 85 ab 00 00 00    	jne    803aac <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a01:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803a08:	00 00 
+  803a0a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a0e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a10:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a14:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a1f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a25:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a30:	48 bb 8e 17 80 00 00 	movabs $0x80178e,%rbx
+  803a37:	00 00 00 
+  803a3a:	ff d3                	call   *%rbx
+  803a3c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803a40:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a44:	ff d3                	call   *%rbx
+  803a46:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a50:	eb 4d                	jmp    803a9f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803a52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a57:	4c 89 ee             	mov    %r13,%rsi
+  803a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a5f:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803a6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a70:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a79:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803a85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a8a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a93:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803a9a:	00 00 00 
+  803a9d:	ff d0                	call   *%rax
+}
+  803a9f:	89 d8                	mov    %ebx,%eax
+  803aa1:	48 83 c4 18          	add    $0x18,%rsp
+  803aa5:	5b                   	pop    %rbx
+  803aa6:	41 5c                	pop    %r12
+  803aa8:	41 5d                	pop    %r13
+  803aaa:	5d                   	pop    %rbp
+  803aab:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803aac:	48 b9 38 4a 80 00 00 	movabs $0x804a38,%rcx
+  803ab3:	00 00 00 
+  803ab6:	48 ba 7b 49 80 00 00 	movabs $0x80497b,%rdx
+  803abd:	00 00 00 
+  803ac0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803ac5:	48 bf 26 4a 80 00 00 	movabs $0x804a26,%rdi
+  803acc:	00 00 00 
+  803acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad4:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  803adb:	00 00 00 
+  803ade:	41 ff d0             	call   *%r8
+
+0000000000803ae1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803ae1:	55                   	push   %rbp
+  803ae2:	48 89 e5             	mov    %rsp,%rbp
+  803ae5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ae9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803aed:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  803af4:	00 00 00 
+  803af7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803af9:	85 c0                	test   %eax,%eax
+  803afb:	78 35                	js     803b32 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803afd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b01:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  803b08:	00 00 00 
+  803b0b:	ff d0                	call   *%rax
+  803b0d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b10:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b15:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b1a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b1e:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  803b25:	00 00 00 
+  803b28:	ff d0                	call   *%rax
+  803b2a:	85 c0                	test   %eax,%eax
+  803b2c:	0f 94 c0             	sete   %al
+  803b2f:	0f b6 c0             	movzbl %al,%eax
+}
+  803b32:	c9                   	leave
+  803b33:	c3                   	ret
+
+0000000000803b34 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b34:	48 89 f8             	mov    %rdi,%rax
+  803b37:	48 c1 e8 27          	shr    $0x27,%rax
+  803b3b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803b42:	01 00 00 
+  803b45:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b49:	f6 c2 01             	test   $0x1,%dl
+  803b4c:	74 6d                	je     803bbb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b4e:	48 89 f8             	mov    %rdi,%rax
+  803b51:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b55:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803b5c:	01 00 00 
+  803b5f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b63:	f6 c2 01             	test   $0x1,%dl
+  803b66:	74 62                	je     803bca <get_uvpt_entry+0x96>
+  803b68:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803b6f:	01 00 00 
+  803b72:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b76:	f6 c2 80             	test   $0x80,%dl
+  803b79:	75 4f                	jne    803bca <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803b7b:	48 89 f8             	mov    %rdi,%rax
+  803b7e:	48 c1 e8 15          	shr    $0x15,%rax
+  803b82:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803b89:	01 00 00 
+  803b8c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b90:	f6 c2 01             	test   $0x1,%dl
+  803b93:	74 44                	je     803bd9 <get_uvpt_entry+0xa5>
+  803b95:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803b9c:	01 00 00 
+  803b9f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ba3:	f6 c2 80             	test   $0x80,%dl
+  803ba6:	75 31                	jne    803bd9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ba8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803bac:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803bb3:	01 00 00 
+  803bb6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803bba:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bbb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803bc2:	01 00 00 
+  803bc5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bc9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bca:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bd1:	01 00 00 
+  803bd4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bd8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bd9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803be0:	01 00 00 
+  803be3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803be7:	c3                   	ret
+
+0000000000803be8 <get_prot>:
+
+int
+get_prot(void *va) {
+  803be8:	55                   	push   %rbp
+  803be9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bec:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  803bf3:	00 00 00 
+  803bf6:	ff d0                	call   *%rax
+  803bf8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803bfb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c00:	89 c1                	mov    %eax,%ecx
+  803c02:	83 c9 04             	or     $0x4,%ecx
+  803c05:	f6 c2 01             	test   $0x1,%dl
+  803c08:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c0b:	89 c1                	mov    %eax,%ecx
+  803c0d:	83 c9 02             	or     $0x2,%ecx
+  803c10:	f6 c2 02             	test   $0x2,%dl
+  803c13:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c16:	89 c1                	mov    %eax,%ecx
+  803c18:	83 c9 01             	or     $0x1,%ecx
+  803c1b:	48 85 d2             	test   %rdx,%rdx
+  803c1e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c21:	89 c1                	mov    %eax,%ecx
+  803c23:	83 c9 40             	or     $0x40,%ecx
+  803c26:	f6 c6 04             	test   $0x4,%dh
+  803c29:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c2c:	5d                   	pop    %rbp
+  803c2d:	c3                   	ret
+
+0000000000803c2e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c2e:	55                   	push   %rbp
+  803c2f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c32:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c3e:	48 c1 e8 06          	shr    $0x6,%rax
+  803c42:	83 e0 01             	and    $0x1,%eax
+}
+  803c45:	5d                   	pop    %rbp
+  803c46:	c3                   	ret
+
+0000000000803c47 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803c47:	55                   	push   %rbp
+  803c48:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c4b:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803c57:	48 c1 e8 05          	shr    $0x5,%rax
+  803c5b:	83 e0 01             	and    $0x1,%eax
+}
+  803c5e:	5d                   	pop    %rbp
+  803c5f:	c3                   	ret
+
+0000000000803c60 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c60:	55                   	push   %rbp
+  803c61:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c64:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+  803c70:	83 e0 01             	and    $0x1,%eax
+}
+  803c73:	5d                   	pop    %rbp
+  803c74:	c3                   	ret
+
+0000000000803c75 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c75:	55                   	push   %rbp
+  803c76:	48 89 e5             	mov    %rsp,%rbp
+  803c79:	41 57                	push   %r15
+  803c7b:	41 56                	push   %r14
+  803c7d:	41 55                	push   %r13
+  803c7f:	41 54                	push   %r12
+  803c81:	53                   	push   %rbx
+  803c82:	48 83 ec 18          	sub    $0x18,%rsp
+  803c86:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c8a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803c8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803c93:	49 bd 60 3c 80 00 00 	movabs $0x803c60,%r13
+  803c9a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803c9d:	49 bf e8 3b 80 00 00 	movabs $0x803be8,%r15
+  803ca4:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803ca7:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803cae:	00 00 00 
+  803cb1:	eb 0c                	jmp    803cbf <foreach_shared_region+0x4a>
+  803cb3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cba:	4c 39 f3             	cmp    %r14,%rbx
+  803cbd:	74 2e                	je     803ced <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803cbf:	48 89 df             	mov    %rbx,%rdi
+  803cc2:	41 ff d5             	call   *%r13
+  803cc5:	84 c0                	test   %al,%al
+  803cc7:	74 ea                	je     803cb3 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803cc9:	48 89 df             	mov    %rbx,%rdi
+  803ccc:	41 ff d7             	call   *%r15
+  803ccf:	a8 40                	test   $0x40,%al
+  803cd1:	74 e0                	je     803cb3 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803cd3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803cda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cde:	48 89 df             	mov    %rbx,%rdi
+  803ce1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ce5:	ff d0                	call   *%rax
+				if (res < 0) {
+  803ce7:	85 c0                	test   %eax,%eax
+  803ce9:	79 c8                	jns    803cb3 <foreach_shared_region+0x3e>
+  803ceb:	eb 05                	jmp    803cf2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803ced:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cf2:	48 83 c4 18          	add    $0x18,%rsp
+  803cf6:	5b                   	pop    %rbx
+  803cf7:	41 5c                	pop    %r12
+  803cf9:	41 5d                	pop    %r13
+  803cfb:	41 5e                	pop    %r14
+  803cfd:	41 5f                	pop    %r15
+  803cff:	5d                   	pop    %rbp
+  803d00:	c3                   	ret
+
+0000000000803d01 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d06:	c3                   	ret
+
+0000000000803d07 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d07:	55                   	push   %rbp
+  803d08:	48 89 e5             	mov    %rsp,%rbp
+  803d0b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d0e:	48 be 5c 4a 80 00 00 	movabs $0x804a5c,%rsi
+  803d15:	00 00 00 
+  803d18:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  803d1f:	00 00 00 
+  803d22:	ff d0                	call   *%rax
+    return 0;
+}
+  803d24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d29:	5d                   	pop    %rbp
+  803d2a:	c3                   	ret
+
+0000000000803d2b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d2b:	55                   	push   %rbp
+  803d2c:	48 89 e5             	mov    %rsp,%rbp
+  803d2f:	41 57                	push   %r15
+  803d31:	41 56                	push   %r14
+  803d33:	41 55                	push   %r13
+  803d35:	41 54                	push   %r12
+  803d37:	53                   	push   %rbx
+  803d38:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d3f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d46:	48 85 d2             	test   %rdx,%rdx
+  803d49:	74 7a                	je     803dc5 <devcons_write+0x9a>
+  803d4b:	49 89 d6             	mov    %rdx,%r14
+  803d4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d54:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d59:	49 bf 2c 0f 80 00 00 	movabs $0x800f2c,%r15
+  803d60:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d63:	4c 89 f3             	mov    %r14,%rbx
+  803d66:	48 29 f3             	sub    %rsi,%rbx
+  803d69:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d6e:	48 39 c3             	cmp    %rax,%rbx
+  803d71:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d75:	4c 63 eb             	movslq %ebx,%r13
+  803d78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803d7f:	48 01 c6             	add    %rax,%rsi
+  803d82:	4c 89 ea             	mov    %r13,%rdx
+  803d85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803d8c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803d8f:	4c 89 ee             	mov    %r13,%rsi
+  803d92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803d99:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803da0:	00 00 00 
+  803da3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803da5:	41 01 dc             	add    %ebx,%r12d
+  803da8:	49 63 f4             	movslq %r12d,%rsi
+  803dab:	4c 39 f6             	cmp    %r14,%rsi
+  803dae:	72 b3                	jb     803d63 <devcons_write+0x38>
+    return res;
+  803db0:	49 63 c4             	movslq %r12d,%rax
+}
+  803db3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dba:	5b                   	pop    %rbx
+  803dbb:	41 5c                	pop    %r12
+  803dbd:	41 5d                	pop    %r13
+  803dbf:	41 5e                	pop    %r14
+  803dc1:	41 5f                	pop    %r15
+  803dc3:	5d                   	pop    %rbp
+  803dc4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803dc5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803dcb:	eb e3                	jmp    803db0 <devcons_write+0x85>
+
+0000000000803dcd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dcd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd5:	48 85 c0             	test   %rax,%rax
+  803dd8:	74 55                	je     803e2f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dda:	55                   	push   %rbp
+  803ddb:	48 89 e5             	mov    %rsp,%rbp
+  803dde:	41 55                	push   %r13
+  803de0:	41 54                	push   %r12
+  803de2:	53                   	push   %rbx
+  803de3:	48 83 ec 08          	sub    $0x8,%rsp
+  803de7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803dea:	48 bb 62 12 80 00 00 	movabs $0x801262,%rbx
+  803df1:	00 00 00 
+  803df4:	49 bc 2f 13 80 00 00 	movabs $0x80132f,%r12
+  803dfb:	00 00 00 
+  803dfe:	eb 03                	jmp    803e03 <devcons_read+0x36>
+  803e00:	41 ff d4             	call   *%r12
+  803e03:	ff d3                	call   *%rbx
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	74 f7                	je     803e00 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e09:	48 63 d0             	movslq %eax,%rdx
+  803e0c:	78 13                	js     803e21 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e13:	83 f8 04             	cmp    $0x4,%eax
+  803e16:	74 09                	je     803e21 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e18:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e1c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e21:	48 89 d0             	mov    %rdx,%rax
+  803e24:	48 83 c4 08          	add    $0x8,%rsp
+  803e28:	5b                   	pop    %rbx
+  803e29:	41 5c                	pop    %r12
+  803e2b:	41 5d                	pop    %r13
+  803e2d:	5d                   	pop    %rbp
+  803e2e:	c3                   	ret
+  803e2f:	48 89 d0             	mov    %rdx,%rax
+  803e32:	c3                   	ret
+
+0000000000803e33 <cputchar>:
+cputchar(int ch) {
+  803e33:	55                   	push   %rbp
+  803e34:	48 89 e5             	mov    %rsp,%rbp
+  803e37:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e3b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e3f:	be 01 00 00 00       	mov    $0x1,%esi
+  803e44:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e48:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803e4f:	00 00 00 
+  803e52:	ff d0                	call   *%rax
+}
+  803e54:	c9                   	leave
+  803e55:	c3                   	ret
+
+0000000000803e56 <getchar>:
+getchar(void) {
+  803e56:	55                   	push   %rbp
+  803e57:	48 89 e5             	mov    %rsp,%rbp
+  803e5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e63:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e67:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e6c:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  803e73:	00 00 00 
+  803e76:	ff d0                	call   *%rax
+  803e78:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	78 06                	js     803e84 <getchar+0x2e>
+  803e7e:	74 08                	je     803e88 <getchar+0x32>
+  803e80:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803e84:	89 d0                	mov    %edx,%eax
+  803e86:	c9                   	leave
+  803e87:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803e88:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803e8d:	eb f5                	jmp    803e84 <getchar+0x2e>
+
+0000000000803e8f <iscons>:
+iscons(int fdnum) {
+  803e8f:	55                   	push   %rbp
+  803e90:	48 89 e5             	mov    %rsp,%rbp
+  803e93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e9b:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  803ea2:	00 00 00 
+  803ea5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ea7:	85 c0                	test   %eax,%eax
+  803ea9:	78 18                	js     803ec3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803eab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803eaf:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803eb6:	00 00 00 
+  803eb9:	8b 00                	mov    (%rax),%eax
+  803ebb:	39 02                	cmp    %eax,(%rdx)
+  803ebd:	0f 94 c0             	sete   %al
+  803ec0:	0f b6 c0             	movzbl %al,%eax
+}
+  803ec3:	c9                   	leave
+  803ec4:	c3                   	ret
+
+0000000000803ec5 <opencons>:
+opencons(void) {
+  803ec5:	55                   	push   %rbp
+  803ec6:	48 89 e5             	mov    %rsp,%rbp
+  803ec9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ecd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ed1:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  803ed8:	00 00 00 
+  803edb:	ff d0                	call   *%rax
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	78 49                	js     803f2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ee1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ee6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eeb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ef4:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  803efb:	00 00 00 
+  803efe:	ff d0                	call   *%rax
+  803f00:	85 c0                	test   %eax,%eax
+  803f02:	78 26                	js     803f2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f08:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803f0f:	00 00 
+  803f11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f1e:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  803f25:	00 00 00 
+  803f28:	ff d0                	call   *%rax
+}
+  803f2a:	c9                   	leave
+  803f2b:	c3                   	ret
+
+0000000000803f2c <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803f2c:	55                   	push   %rbp
+  803f2d:	48 89 e5             	mov    %rsp,%rbp
+  803f30:	41 55                	push   %r13
+  803f32:	41 54                	push   %r12
+  803f34:	53                   	push   %rbx
+  803f35:	48 83 ec 08          	sub    $0x8,%rsp
+  803f39:	49 89 fc             	mov    %rdi,%r12
+  803f3c:	48 89 f7             	mov    %rsi,%rdi
+  803f3f:	48 89 d3             	mov    %rdx,%rbx
+  803f42:	49 89 cd             	mov    %rcx,%r13
+  803f45:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f48:	48 85 f6             	test   %rsi,%rsi
+  803f4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f52:	00 00 00 
+  803f55:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803f59:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f5e:	48 85 db             	test   %rbx,%rbx
+  803f61:	74 03                	je     803f66 <ipc_recv_timed+0x3a>
+  803f63:	48 8b 33             	mov    (%rbx),%rsi
+  803f66:	48 b8 58 16 80 00 00 	movabs $0x801658,%rax
+  803f6d:	00 00 00 
+  803f70:	ff d0                	call   *%rax
+    if (res < 0) {
+  803f72:	85 c0                	test   %eax,%eax
+  803f74:	78 75                	js     803feb <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803f76:	4d 85 e4             	test   %r12,%r12
+  803f79:	74 14                	je     803f8f <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803f7b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803f82:	00 00 00 
+  803f85:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803f8b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803f8f:	4d 85 ed             	test   %r13,%r13
+  803f92:	74 14                	je     803fa8 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803f94:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803f9b:	00 00 00 
+  803f9e:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803fa4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803fa8:	48 85 db             	test   %rbx,%rbx
+  803fab:	74 23                	je     803fd0 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803fad:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803fb4:	00 00 00 
+  803fb7:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc2:	85 c9                	test   %ecx,%ecx
+  803fc4:	74 07                	je     803fcd <ipc_recv_timed+0xa1>
+  803fc6:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803fcd:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803fd0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803fd7:	00 00 00 
+  803fda:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803fe0:	48 83 c4 08          	add    $0x8,%rsp
+  803fe4:	5b                   	pop    %rbx
+  803fe5:	41 5c                	pop    %r12
+  803fe7:	41 5d                	pop    %r13
+  803fe9:	5d                   	pop    %rbp
+  803fea:	c3                   	ret
+        if (from_env_store != NULL) {
+  803feb:	4d 85 e4             	test   %r12,%r12
+  803fee:	74 08                	je     803ff8 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803ff0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803ff7:	00 
+        if (perm_store != NULL) {
+  803ff8:	4d 85 ed             	test   %r13,%r13
+  803ffb:	74 08                	je     804005 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803ffd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804004:	00 
+        if (size != NULL) {
+  804005:	48 85 db             	test   %rbx,%rbx
+  804008:	74 d6                	je     803fe0 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80400a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804011:	eb cd                	jmp    803fe0 <ipc_recv_timed+0xb4>
+
+0000000000804013 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804013:	55                   	push   %rbp
+  804014:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  804017:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80401d:	48 b8 2c 3f 80 00 00 	movabs $0x803f2c,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+}
+  804029:	5d                   	pop    %rbp
+  80402a:	c3                   	ret
+
+000000000080402b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80402b:	55                   	push   %rbp
+  80402c:	48 89 e5             	mov    %rsp,%rbp
+  80402f:	41 57                	push   %r15
+  804031:	41 56                	push   %r14
+  804033:	41 55                	push   %r13
+  804035:	41 54                	push   %r12
+  804037:	53                   	push   %rbx
+  804038:	48 83 ec 18          	sub    $0x18,%rsp
+  80403c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80403f:	48 89 d3             	mov    %rdx,%rbx
+  804042:	49 89 cc             	mov    %rcx,%r12
+  804045:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804048:	48 85 d2             	test   %rdx,%rdx
+  80404b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804052:	00 00 00 
+  804055:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804059:	89 f0                	mov    %esi,%eax
+  80405b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80405f:	48 89 da             	mov    %rbx,%rdx
+  804062:	48 89 c6             	mov    %rax,%rsi
+  804065:	48 b8 2c 16 80 00 00 	movabs $0x80162c,%rax
+  80406c:	00 00 00 
+  80406f:	ff d0                	call   *%rax
+    while (res < 0) {
+  804071:	85 c0                	test   %eax,%eax
+  804073:	79 65                	jns    8040da <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804075:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804078:	75 33                	jne    8040ad <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80407a:	49 bf 2f 13 80 00 00 	movabs $0x80132f,%r15
+  804081:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804084:	49 be 2c 16 80 00 00 	movabs $0x80162c,%r14
+  80408b:	00 00 00 
+        sys_yield();
+  80408e:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804091:	45 89 e8             	mov    %r13d,%r8d
+  804094:	4c 89 e1             	mov    %r12,%rcx
+  804097:	48 89 da             	mov    %rbx,%rdx
+  80409a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80409e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8040a1:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8040a4:	85 c0                	test   %eax,%eax
+  8040a6:	79 32                	jns    8040da <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8040a8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040ab:	74 e1                	je     80408e <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8040ad:	89 c1                	mov    %eax,%ecx
+  8040af:	48 ba 68 4a 80 00 00 	movabs $0x804a68,%rdx
+  8040b6:	00 00 00 
+  8040b9:	be 52 00 00 00       	mov    $0x52,%esi
+  8040be:	48 bf 7c 4a 80 00 00 	movabs $0x804a7c,%rdi
+  8040c5:	00 00 00 
+  8040c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040cd:	49 b8 bd 02 80 00 00 	movabs $0x8002bd,%r8
+  8040d4:	00 00 00 
+  8040d7:	41 ff d0             	call   *%r8
+    }
+}
+  8040da:	48 83 c4 18          	add    $0x18,%rsp
+  8040de:	5b                   	pop    %rbx
+  8040df:	41 5c                	pop    %r12
+  8040e1:	41 5d                	pop    %r13
+  8040e3:	41 5e                	pop    %r14
+  8040e5:	41 5f                	pop    %r15
+  8040e7:	5d                   	pop    %rbp
+  8040e8:	c3                   	ret
+
+00000000008040e9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8040e9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8040ee:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8040f5:	00 00 00 
+  8040f8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8040fc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804100:	48 c1 e2 04          	shl    $0x4,%rdx
+  804104:	48 01 ca             	add    %rcx,%rdx
+  804107:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80410d:	39 fa                	cmp    %edi,%edx
+  80410f:	74 12                	je     804123 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  804111:	48 83 c0 01          	add    $0x1,%rax
+  804115:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80411b:	75 db                	jne    8040f8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80411d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804122:	c3                   	ret
+            return envs[i].env_id;
+  804123:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804127:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80412b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80412f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  804136:	00 00 00 
+  804139:	48 01 d0             	add    %rdx,%rax
+  80413c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804142:	c3                   	ret
+  804143:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804148 <__rodata_start>:
+  804148:	69 63 6f 64 65 00 69 	imul   $0x69006564,0x6f(%rbx),%esp
+  80414f:	63 6f 64             	movsxd 0x64(%rdi),%ebp
+  804152:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  804156:	61                   	(bad)
+  804157:	72 74                	jb     8041cd <__rodata_start+0x85>
+  804159:	75 70                	jne    8041cb <__rodata_start+0x83>
+  80415b:	0a 00                	or     (%rax),%al
+  80415d:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  804164:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804165:	70 65                	jo     8041cc <__rodata_start+0x84>
+  804167:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804168:	20 2f                	and    %ch,(%rdi)
+  80416a:	6d                   	insl   (%dx),%es:(%rdi)
+  80416b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80416c:	74 64                	je     8041d2 <__rodata_start+0x8a>
+  80416e:	0a 00                	or     (%rax),%al
+  804170:	2f                   	(bad)
+  804171:	6d                   	insl   (%dx),%es:(%rdi)
+  804172:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804173:	74 64                	je     8041d9 <__rodata_start+0x91>
+  804175:	00 69 63             	add    %ch,0x63(%rcx)
+  804178:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804179:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  80417d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80417e:	70 65                	jo     8041e5 <__rodata_start+0x9d>
+  804180:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804181:	20 2f                	and    %ch,(%rdi)
+  804183:	6d                   	insl   (%dx),%es:(%rdi)
+  804184:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804185:	74 64                	je     8041eb <__rodata_start+0xa3>
+  804187:	3a 20                	cmp    (%rax),%ah
+  804189:	25 69 00 75 73       	and    $0x73750069,%eax
+  80418e:	65 72 2f             	gs jb  8041c0 <__rodata_start+0x78>
+  804191:	69 63 6f 64 65 2e 63 	imul   $0x632e6564,0x6f(%rbx),%esp
+  804198:	00 69 63             	add    %ch,0x63(%rcx)
+  80419b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80419c:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8041a0:	72 65                	jb     804207 <__rodata_start+0xbf>
+  8041a2:	61                   	(bad)
+  8041a3:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8041a6:	6d                   	insl   (%dx),%es:(%rdi)
+  8041a7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041a8:	74 64                	je     80420e <__rodata_start+0xc6>
+  8041aa:	0a 00                	or     (%rax),%al
+  8041ac:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  8041b3:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  8041b7:	65 20 2f             	and    %ch,%gs:(%rdi)
+  8041ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8041bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041bc:	74 64                	je     804222 <__rodata_start+0xda>
+  8041be:	0a 00                	or     (%rax),%al
+  8041c0:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  8041c7:	73 70                	jae    804239 <__rodata_start+0xf1>
+  8041c9:	61                   	(bad)
+  8041ca:	77 6e                	ja     80423a <__rodata_start+0xf2>
+  8041cc:	20 2f                	and    %ch,(%rdi)
+  8041ce:	69 6e 69 74 0a 00 69 	imul   $0x69000a74,0x69(%rsi),%ebp
+  8041d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041d6:	69 74 61 72 67 32 00 	imul   $0x69003267,0x72(%rcx,%riz,2),%esi
+  8041dd:	69 
+  8041de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041df:	69 74 61 72 67 31 00 	imul   $0x2f003167,0x72(%rcx,%riz,2),%esi
+  8041e6:	2f 
+  8041e7:	69 6e 69 74 00 69 63 	imul   $0x63690074,0x69(%rsi),%ebp
+  8041ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041ef:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8041f3:	73 70                	jae    804265 <__rodata_start+0x11d>
+  8041f5:	61                   	(bad)
+  8041f6:	77 6e                	ja     804266 <__rodata_start+0x11e>
+  8041f8:	20 2f                	and    %ch,(%rdi)
+  8041fa:	69 6e 69 74 3a 20 25 	imul   $0x25203a74,0x69(%rsi),%ebp
+  804201:	69 00 69 63 6f 64    	imul   $0x646f6369,(%rax),%eax
+  804207:	65 3a 20             	cmp    %gs:(%rax),%ah
+  80420a:	65 78 69             	gs js  804276 <__rodata_start+0x12e>
+  80420d:	74 69                	je     804278 <__rodata_start+0x130>
+  80420f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804210:	67 0a 00             	or     (%eax),%al
+  804213:	3c 75                	cmp    $0x75,%al
+  804215:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804216:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80421a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80421b:	3e 00 0f             	ds add %cl,(%rdi)
+  80421e:	1f                   	(bad)
+  80421f:	00 5b 25             	add    %bl,0x25(%rbx)
+  804222:	30 38                	xor    %bh,(%rax)
+  804224:	78 5d                	js     804283 <__rodata_start+0x13b>
+  804226:	20 75 73             	and    %dh,0x73(%rbp)
+  804229:	65 72 20             	gs jb  80424c <__rodata_start+0x104>
+  80422c:	70 61                	jo     80428f <__rodata_start+0x147>
+  80422e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80422f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804236:	73 20                	jae    804258 <__rodata_start+0x110>
+  804238:	61                   	(bad)
+  804239:	74 20                	je     80425b <__rodata_start+0x113>
+  80423b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804240:	3a 20                	cmp    (%rax),%ah
+  804242:	00 30                	add    %dh,(%rax)
+  804244:	31 32                	xor    %esi,(%rdx)
+  804246:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80424d:	41                   	rex.B
+  80424e:	42                   	rex.X
+  80424f:	43                   	rex.XB
+  804250:	44                   	rex.R
+  804251:	45                   	rex.RB
+  804252:	46 00 30             	rex.RX add %r14b,(%rax)
+  804255:	31 32                	xor    %esi,(%rdx)
+  804257:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80425e:	61                   	(bad)
+  80425f:	62 63 64 65 66       	(bad)
+  804264:	00 28                	add    %ch,(%rax)
+  804266:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804267:	75 6c                	jne    8042d5 <__rodata_start+0x18d>
+  804269:	6c                   	insb   (%dx),%es:(%rdi)
+  80426a:	29 00                	sub    %eax,(%rax)
+  80426c:	65 72 72             	gs jb  8042e1 <__rodata_start+0x199>
+  80426f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804270:	72 20                	jb     804292 <__rodata_start+0x14a>
+  804272:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804277:	73 70                	jae    8042e9 <__rodata_start+0x1a1>
+  804279:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80427d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804284:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804285:	72 00                	jb     804287 <__rodata_start+0x13f>
+  804287:	62 61 64 20 65       	(bad)
+  80428c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80428d:	76 69                	jbe    8042f8 <__rodata_start+0x1b0>
+  80428f:	72 6f                	jb     804300 <__rodata_start+0x1b8>
+  804291:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804292:	6d                   	insl   (%dx),%es:(%rdi)
+  804293:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804295:	74 00                	je     804297 <__rodata_start+0x14f>
+  804297:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80429e:	20 70 61             	and    %dh,0x61(%rax)
+  8042a1:	72 61                	jb     804304 <__rodata_start+0x1bc>
+  8042a3:	6d                   	insl   (%dx),%es:(%rdi)
+  8042a4:	65 74 65             	gs je  80430c <__rodata_start+0x1c4>
+  8042a7:	72 00                	jb     8042a9 <__rodata_start+0x161>
+  8042a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042aa:	75 74                	jne    804320 <__rodata_start+0x1d8>
+  8042ac:	20 6f 66             	and    %ch,0x66(%rdi)
+  8042af:	20 6d 65             	and    %ch,0x65(%rbp)
+  8042b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8042b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042b4:	72 79                	jb     80432f <__rodata_start+0x1e7>
+  8042b6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8042b9:	74 20                	je     8042db <__rodata_start+0x193>
+  8042bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042bc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8042c0:	76 69                	jbe    80432b <__rodata_start+0x1e3>
+  8042c2:	72 6f                	jb     804333 <__rodata_start+0x1eb>
+  8042c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042c5:	6d                   	insl   (%dx),%es:(%rdi)
+  8042c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8042c8:	74 73                	je     80433d <__rodata_start+0x1f5>
+  8042ca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8042cd:	72 72                	jb     804341 <__rodata_start+0x1f9>
+  8042cf:	75 70                	jne    804341 <__rodata_start+0x1f9>
+  8042d1:	74 65                	je     804338 <__rodata_start+0x1f0>
+  8042d3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8042d8:	75 67                	jne    804341 <__rodata_start+0x1f9>
+  8042da:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8042dd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8042df:	00 73 65             	add    %dh,0x65(%rbx)
+  8042e2:	67 6d                	insl   (%dx),%es:(%edi)
+  8042e4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8042e6:	74 61                	je     804349 <__rodata_start+0x201>
+  8042e8:	74 69                	je     804353 <__rodata_start+0x20b>
+  8042ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042ec:	20 66 61             	and    %ah,0x61(%rsi)
+  8042ef:	75 6c                	jne    80435d <__rodata_start+0x215>
+  8042f1:	74 00                	je     8042f3 <__rodata_start+0x1ab>
+  8042f3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8042fa:	20 45 4c             	and    %al,0x4c(%rbp)
+  8042fd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804301:	61                   	(bad)
+  804302:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804307:	20 73 75             	and    %dh,0x75(%rbx)
+  80430a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80430d:	73 79                	jae    804388 <__rodata_start+0x240>
+  80430f:	73 74                	jae    804385 <__rodata_start+0x23d>
+  804311:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804313:	20 63 61             	and    %ah,0x61(%rbx)
+  804316:	6c                   	insb   (%dx),%es:(%rdi)
+  804317:	6c                   	insb   (%dx),%es:(%rdi)
+  804318:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80431b:	74 72                	je     80438f <__rodata_start+0x247>
+  80431d:	79 20                	jns    80433f <__rodata_start+0x1f7>
+  80431f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804320:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804321:	74 20                	je     804343 <__rodata_start+0x1fb>
+  804323:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804325:	75 6e                	jne    804395 <__rodata_start+0x24d>
+  804327:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80432b:	76 20                	jbe    80434d <__rodata_start+0x205>
+  80432d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804334:	72 65                	jb     80439b <__rodata_start+0x253>
+  804336:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804339:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80433a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80433e:	65 78 70             	gs js  8043b1 <__rodata_start+0x269>
+  804341:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804346:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804349:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80434d:	20 66 69             	and    %ah,0x69(%rsi)
+  804350:	6c                   	insb   (%dx),%es:(%rdi)
+  804351:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804355:	20 66 72             	and    %ah,0x72(%rsi)
+  804358:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80435d:	61                   	(bad)
+  80435e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804361:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804362:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804363:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804367:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80436a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80436b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80436c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80436f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804370:	79 20                	jns    804392 <__rodata_start+0x24a>
+  804372:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804379:	72 65                	jb     8043e0 <__rodata_start+0x298>
+  80437b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80437e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804380:	00 66 69             	add    %ah,0x69(%rsi)
+  804383:	6c                   	insb   (%dx),%es:(%rdi)
+  804384:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804388:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80438b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80438c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80438f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804390:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804391:	74 20                	je     8043b3 <__rodata_start+0x26b>
+  804393:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804395:	75 6e                	jne    804405 <__rodata_start+0x2bd>
+  804397:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80439b:	76 61                	jbe    8043fe <__rodata_start+0x2b6>
+  80439d:	6c                   	insb   (%dx),%es:(%rdi)
+  80439e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8043a5:	00 
+  8043a6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8043ad:	72 65                	jb     804414 <__rodata_start+0x2cc>
+  8043af:	61                   	(bad)
+  8043b0:	64 79 20             	fs jns 8043d3 <__rodata_start+0x28b>
+  8043b3:	65 78 69             	gs js  80441f <__rodata_start+0x2d7>
+  8043b6:	73 74                	jae    80442c <__rodata_start+0x2e4>
+  8043b8:	73 00                	jae    8043ba <__rodata_start+0x272>
+  8043ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043bb:	70 65                	jo     804422 <__rodata_start+0x2da>
+  8043bd:	72 61                	jb     804420 <__rodata_start+0x2d8>
+  8043bf:	74 69                	je     80442a <__rodata_start+0x2e2>
+  8043c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043c3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8043c6:	74 20                	je     8043e8 <__rodata_start+0x2a0>
+  8043c8:	73 75                	jae    80443f <__rodata_start+0x2f7>
+  8043ca:	70 70                	jo     80443c <__rodata_start+0x2f4>
+  8043cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043cd:	72 74                	jb     804443 <__rodata_start+0x2fb>
+  8043cf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  8043d5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  8043da:	74 00                	je     8043dc <__rodata_start+0x294>
+  8043dc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8043e0:	fa                   	cli
+  8043e1:	05 80 00 00 00       	add    $0x80,%eax
+  8043e6:	00 00                	add    %al,(%rax)
+  8043e8:	3b 0c 80             	cmp    (%rax,%rax,4),%ecx
+  8043eb:	00 00                	add    %al,(%rax)
+  8043ed:	00 00                	add    %al,(%rax)
+  8043ef:	00 2b                	add    %ch,(%rbx)
+  8043f1:	0c 80                	or     $0x80,%al
+  8043f3:	00 00                	add    %al,(%rax)
+  8043f5:	00 00                	add    %al,(%rax)
+  8043f7:	00 3b                	add    %bh,(%rbx)
+  8043f9:	0c 80                	or     $0x80,%al
+  8043fb:	00 00                	add    %al,(%rax)
+  8043fd:	00 00                	add    %al,(%rax)
+  8043ff:	00 3b                	add    %bh,(%rbx)
+  804401:	0c 80                	or     $0x80,%al
+  804403:	00 00                	add    %al,(%rax)
+  804405:	00 00                	add    %al,(%rax)
+  804407:	00 3b                	add    %bh,(%rbx)
+  804409:	0c 80                	or     $0x80,%al
+  80440b:	00 00                	add    %al,(%rax)
+  80440d:	00 00                	add    %al,(%rax)
+  80440f:	00 3b                	add    %bh,(%rbx)
+  804411:	0c 80                	or     $0x80,%al
+  804413:	00 00                	add    %al,(%rax)
+  804415:	00 00                	add    %al,(%rax)
+  804417:	00 19                	add    %bl,(%rcx)
+  804419:	06                   	(bad)
+  80441a:	80 00 00             	addb   $0x0,(%rax)
+  80441d:	00 00                	add    %al,(%rax)
+  80441f:	00 3b                	add    %bh,(%rbx)
+  804421:	0c 80                	or     $0x80,%al
+  804423:	00 00                	add    %al,(%rax)
+  804425:	00 00                	add    %al,(%rax)
+  804427:	00 3b                	add    %bh,(%rbx)
+  804429:	0c 80                	or     $0x80,%al
+  80442b:	00 00                	add    %al,(%rax)
+  80442d:	00 00                	add    %al,(%rax)
+  80442f:	00 0d 06 80 00 00    	add    %cl,0x8006(%rip)        # 80c43b <__bss_end+0x343b>
+  804435:	00 00                	add    %al,(%rax)
+  804437:	00 87 06 80 00 00    	add    %al,0x8006(%rdi)
+  80443d:	00 00                	add    %al,(%rax)
+  80443f:	00 3b                	add    %bh,(%rbx)
+  804441:	0c 80                	or     $0x80,%al
+  804443:	00 00                	add    %al,(%rax)
+  804445:	00 00                	add    %al,(%rax)
+  804447:	00 0d 06 80 00 00    	add    %cl,0x8006(%rip)        # 80c453 <__bss_end+0x3453>
+  80444d:	00 00                	add    %al,(%rax)
+  80444f:	00 53 06             	add    %dl,0x6(%rbx)
+  804452:	80 00 00             	addb   $0x0,(%rax)
+  804455:	00 00                	add    %al,(%rax)
+  804457:	00 53 06             	add    %dl,0x6(%rbx)
+  80445a:	80 00 00             	addb   $0x0,(%rax)
+  80445d:	00 00                	add    %al,(%rax)
+  80445f:	00 53 06             	add    %dl,0x6(%rbx)
+  804462:	80 00 00             	addb   $0x0,(%rax)
+  804465:	00 00                	add    %al,(%rax)
+  804467:	00 53 06             	add    %dl,0x6(%rbx)
+  80446a:	80 00 00             	addb   $0x0,(%rax)
+  80446d:	00 00                	add    %al,(%rax)
+  80446f:	00 53 06             	add    %dl,0x6(%rbx)
+  804472:	80 00 00             	addb   $0x0,(%rax)
+  804475:	00 00                	add    %al,(%rax)
+  804477:	00 53 06             	add    %dl,0x6(%rbx)
+  80447a:	80 00 00             	addb   $0x0,(%rax)
+  80447d:	00 00                	add    %al,(%rax)
+  80447f:	00 53 06             	add    %dl,0x6(%rbx)
+  804482:	80 00 00             	addb   $0x0,(%rax)
+  804485:	00 00                	add    %al,(%rax)
+  804487:	00 53 06             	add    %dl,0x6(%rbx)
+  80448a:	80 00 00             	addb   $0x0,(%rax)
+  80448d:	00 00                	add    %al,(%rax)
+  80448f:	00 53 06             	add    %dl,0x6(%rbx)
+  804492:	80 00 00             	addb   $0x0,(%rax)
+  804495:	00 00                	add    %al,(%rax)
+  804497:	00 3b                	add    %bh,(%rbx)
+  804499:	0c 80                	or     $0x80,%al
+  80449b:	00 00                	add    %al,(%rax)
+  80449d:	00 00                	add    %al,(%rax)
+  80449f:	00 3b                	add    %bh,(%rbx)
+  8044a1:	0c 80                	or     $0x80,%al
+  8044a3:	00 00                	add    %al,(%rax)
+  8044a5:	00 00                	add    %al,(%rax)
+  8044a7:	00 3b                	add    %bh,(%rbx)
+  8044a9:	0c 80                	or     $0x80,%al
+  8044ab:	00 00                	add    %al,(%rax)
+  8044ad:	00 00                	add    %al,(%rax)
+  8044af:	00 3b                	add    %bh,(%rbx)
+  8044b1:	0c 80                	or     $0x80,%al
+  8044b3:	00 00                	add    %al,(%rax)
+  8044b5:	00 00                	add    %al,(%rax)
+  8044b7:	00 3b                	add    %bh,(%rbx)
+  8044b9:	0c 80                	or     $0x80,%al
+  8044bb:	00 00                	add    %al,(%rax)
+  8044bd:	00 00                	add    %al,(%rax)
+  8044bf:	00 3b                	add    %bh,(%rbx)
+  8044c1:	0c 80                	or     $0x80,%al
+  8044c3:	00 00                	add    %al,(%rax)
+  8044c5:	00 00                	add    %al,(%rax)
+  8044c7:	00 3b                	add    %bh,(%rbx)
+  8044c9:	0c 80                	or     $0x80,%al
+  8044cb:	00 00                	add    %al,(%rax)
+  8044cd:	00 00                	add    %al,(%rax)
+  8044cf:	00 3b                	add    %bh,(%rbx)
+  8044d1:	0c 80                	or     $0x80,%al
+  8044d3:	00 00                	add    %al,(%rax)
+  8044d5:	00 00                	add    %al,(%rax)
+  8044d7:	00 3b                	add    %bh,(%rbx)
+  8044d9:	0c 80                	or     $0x80,%al
+  8044db:	00 00                	add    %al,(%rax)
+  8044dd:	00 00                	add    %al,(%rax)
+  8044df:	00 3b                	add    %bh,(%rbx)
+  8044e1:	0c 80                	or     $0x80,%al
+  8044e3:	00 00                	add    %al,(%rax)
+  8044e5:	00 00                	add    %al,(%rax)
+  8044e7:	00 3b                	add    %bh,(%rbx)
+  8044e9:	0c 80                	or     $0x80,%al
+  8044eb:	00 00                	add    %al,(%rax)
+  8044ed:	00 00                	add    %al,(%rax)
+  8044ef:	00 3b                	add    %bh,(%rbx)
+  8044f1:	0c 80                	or     $0x80,%al
+  8044f3:	00 00                	add    %al,(%rax)
+  8044f5:	00 00                	add    %al,(%rax)
+  8044f7:	00 3b                	add    %bh,(%rbx)
+  8044f9:	0c 80                	or     $0x80,%al
+  8044fb:	00 00                	add    %al,(%rax)
+  8044fd:	00 00                	add    %al,(%rax)
+  8044ff:	00 3b                	add    %bh,(%rbx)
+  804501:	0c 80                	or     $0x80,%al
+  804503:	00 00                	add    %al,(%rax)
+  804505:	00 00                	add    %al,(%rax)
+  804507:	00 3b                	add    %bh,(%rbx)
+  804509:	0c 80                	or     $0x80,%al
+  80450b:	00 00                	add    %al,(%rax)
+  80450d:	00 00                	add    %al,(%rax)
+  80450f:	00 3b                	add    %bh,(%rbx)
+  804511:	0c 80                	or     $0x80,%al
+  804513:	00 00                	add    %al,(%rax)
+  804515:	00 00                	add    %al,(%rax)
+  804517:	00 3b                	add    %bh,(%rbx)
+  804519:	0c 80                	or     $0x80,%al
+  80451b:	00 00                	add    %al,(%rax)
+  80451d:	00 00                	add    %al,(%rax)
+  80451f:	00 3b                	add    %bh,(%rbx)
+  804521:	0c 80                	or     $0x80,%al
+  804523:	00 00                	add    %al,(%rax)
+  804525:	00 00                	add    %al,(%rax)
+  804527:	00 3b                	add    %bh,(%rbx)
+  804529:	0c 80                	or     $0x80,%al
+  80452b:	00 00                	add    %al,(%rax)
+  80452d:	00 00                	add    %al,(%rax)
+  80452f:	00 3b                	add    %bh,(%rbx)
+  804531:	0c 80                	or     $0x80,%al
+  804533:	00 00                	add    %al,(%rax)
+  804535:	00 00                	add    %al,(%rax)
+  804537:	00 3b                	add    %bh,(%rbx)
+  804539:	0c 80                	or     $0x80,%al
+  80453b:	00 00                	add    %al,(%rax)
+  80453d:	00 00                	add    %al,(%rax)
+  80453f:	00 3b                	add    %bh,(%rbx)
+  804541:	0c 80                	or     $0x80,%al
+  804543:	00 00                	add    %al,(%rax)
+  804545:	00 00                	add    %al,(%rax)
+  804547:	00 3b                	add    %bh,(%rbx)
+  804549:	0c 80                	or     $0x80,%al
+  80454b:	00 00                	add    %al,(%rax)
+  80454d:	00 00                	add    %al,(%rax)
+  80454f:	00 3b                	add    %bh,(%rbx)
+  804551:	0c 80                	or     $0x80,%al
+  804553:	00 00                	add    %al,(%rax)
+  804555:	00 00                	add    %al,(%rax)
+  804557:	00 3b                	add    %bh,(%rbx)
+  804559:	0c 80                	or     $0x80,%al
+  80455b:	00 00                	add    %al,(%rax)
+  80455d:	00 00                	add    %al,(%rax)
+  80455f:	00 3b                	add    %bh,(%rbx)
+  804561:	0c 80                	or     $0x80,%al
+  804563:	00 00                	add    %al,(%rax)
+  804565:	00 00                	add    %al,(%rax)
+  804567:	00 3b                	add    %bh,(%rbx)
+  804569:	0c 80                	or     $0x80,%al
+  80456b:	00 00                	add    %al,(%rax)
+  80456d:	00 00                	add    %al,(%rax)
+  80456f:	00 3b                	add    %bh,(%rbx)
+  804571:	0c 80                	or     $0x80,%al
+  804573:	00 00                	add    %al,(%rax)
+  804575:	00 00                	add    %al,(%rax)
+  804577:	00 3b                	add    %bh,(%rbx)
+  804579:	0c 80                	or     $0x80,%al
+  80457b:	00 00                	add    %al,(%rax)
+  80457d:	00 00                	add    %al,(%rax)
+  80457f:	00 3b                	add    %bh,(%rbx)
+  804581:	0c 80                	or     $0x80,%al
+  804583:	00 00                	add    %al,(%rax)
+  804585:	00 00                	add    %al,(%rax)
+  804587:	00 5e 0b             	add    %bl,0xb(%rsi)
+  80458a:	80 00 00             	addb   $0x0,(%rax)
+  80458d:	00 00                	add    %al,(%rax)
+  80458f:	00 3b                	add    %bh,(%rbx)
+  804591:	0c 80                	or     $0x80,%al
+  804593:	00 00                	add    %al,(%rax)
+  804595:	00 00                	add    %al,(%rax)
+  804597:	00 3b                	add    %bh,(%rbx)
+  804599:	0c 80                	or     $0x80,%al
+  80459b:	00 00                	add    %al,(%rax)
+  80459d:	00 00                	add    %al,(%rax)
+  80459f:	00 3b                	add    %bh,(%rbx)
+  8045a1:	0c 80                	or     $0x80,%al
+  8045a3:	00 00                	add    %al,(%rax)
+  8045a5:	00 00                	add    %al,(%rax)
+  8045a7:	00 3b                	add    %bh,(%rbx)
+  8045a9:	0c 80                	or     $0x80,%al
+  8045ab:	00 00                	add    %al,(%rax)
+  8045ad:	00 00                	add    %al,(%rax)
+  8045af:	00 3b                	add    %bh,(%rbx)
+  8045b1:	0c 80                	or     $0x80,%al
+  8045b3:	00 00                	add    %al,(%rax)
+  8045b5:	00 00                	add    %al,(%rax)
+  8045b7:	00 3b                	add    %bh,(%rbx)
+  8045b9:	0c 80                	or     $0x80,%al
+  8045bb:	00 00                	add    %al,(%rax)
+  8045bd:	00 00                	add    %al,(%rax)
+  8045bf:	00 3b                	add    %bh,(%rbx)
+  8045c1:	0c 80                	or     $0x80,%al
+  8045c3:	00 00                	add    %al,(%rax)
+  8045c5:	00 00                	add    %al,(%rax)
+  8045c7:	00 3b                	add    %bh,(%rbx)
+  8045c9:	0c 80                	or     $0x80,%al
+  8045cb:	00 00                	add    %al,(%rax)
+  8045cd:	00 00                	add    %al,(%rax)
+  8045cf:	00 3b                	add    %bh,(%rbx)
+  8045d1:	0c 80                	or     $0x80,%al
+  8045d3:	00 00                	add    %al,(%rax)
+  8045d5:	00 00                	add    %al,(%rax)
+  8045d7:	00 3b                	add    %bh,(%rbx)
+  8045d9:	0c 80                	or     $0x80,%al
+  8045db:	00 00                	add    %al,(%rax)
+  8045dd:	00 00                	add    %al,(%rax)
+  8045df:	00 aa 06 80 00 00    	add    %ch,0x8006(%rdx)
+  8045e5:	00 00                	add    %al,(%rax)
+  8045e7:	00 79 08             	add    %bh,0x8(%rcx)
+  8045ea:	80 00 00             	addb   $0x0,(%rax)
+  8045ed:	00 00                	add    %al,(%rax)
+  8045ef:	00 3b                	add    %bh,(%rbx)
+  8045f1:	0c 80                	or     $0x80,%al
+  8045f3:	00 00                	add    %al,(%rax)
+  8045f5:	00 00                	add    %al,(%rax)
+  8045f7:	00 3b                	add    %bh,(%rbx)
+  8045f9:	0c 80                	or     $0x80,%al
+  8045fb:	00 00                	add    %al,(%rax)
+  8045fd:	00 00                	add    %al,(%rax)
+  8045ff:	00 3b                	add    %bh,(%rbx)
+  804601:	0c 80                	or     $0x80,%al
+  804603:	00 00                	add    %al,(%rax)
+  804605:	00 00                	add    %al,(%rax)
+  804607:	00 3b                	add    %bh,(%rbx)
+  804609:	0c 80                	or     $0x80,%al
+  80460b:	00 00                	add    %al,(%rax)
+  80460d:	00 00                	add    %al,(%rax)
+  80460f:	00 d9                	add    %bl,%cl
+  804611:	06                   	(bad)
+  804612:	80 00 00             	addb   $0x0,(%rax)
+  804615:	00 00                	add    %al,(%rax)
+  804617:	00 3b                	add    %bh,(%rbx)
+  804619:	0c 80                	or     $0x80,%al
+  80461b:	00 00                	add    %al,(%rax)
+  80461d:	00 00                	add    %al,(%rax)
+  80461f:	00 3b                	add    %bh,(%rbx)
+  804621:	0c 80                	or     $0x80,%al
+  804623:	00 00                	add    %al,(%rax)
+  804625:	00 00                	add    %al,(%rax)
+  804627:	00 9f 06 80 00 00    	add    %bl,0x8006(%rdi)
+  80462d:	00 00                	add    %al,(%rax)
+  80462f:	00 3b                	add    %bh,(%rbx)
+  804631:	0c 80                	or     $0x80,%al
+  804633:	00 00                	add    %al,(%rax)
+  804635:	00 00                	add    %al,(%rax)
+  804637:	00 3b                	add    %bh,(%rbx)
+  804639:	0c 80                	or     $0x80,%al
+  80463b:	00 00                	add    %al,(%rax)
+  80463d:	00 00                	add    %al,(%rax)
+  80463f:	00 21                	add    %ah,(%rcx)
+  804641:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804647:	00 eb                	add    %ch,%bl
+  804649:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80464f:	00 3b                	add    %bh,(%rbx)
+  804651:	0c 80                	or     $0x80,%al
+  804653:	00 00                	add    %al,(%rax)
+  804655:	00 00                	add    %al,(%rax)
+  804657:	00 3b                	add    %bh,(%rbx)
+  804659:	0c 80                	or     $0x80,%al
+  80465b:	00 00                	add    %al,(%rax)
+  80465d:	00 00                	add    %al,(%rax)
+  80465f:	00 70 07             	add    %dh,0x7(%rax)
+  804662:	80 00 00             	addb   $0x0,(%rax)
+  804665:	00 00                	add    %al,(%rax)
+  804667:	00 3b                	add    %bh,(%rbx)
+  804669:	0c 80                	or     $0x80,%al
+  80466b:	00 00                	add    %al,(%rax)
+  80466d:	00 00                	add    %al,(%rax)
+  80466f:	00 4d 09             	add    %cl,0x9(%rbp)
+  804672:	80 00 00             	addb   $0x0,(%rax)
+  804675:	00 00                	add    %al,(%rax)
+  804677:	00 3b                	add    %bh,(%rbx)
+  804679:	0c 80                	or     $0x80,%al
+  80467b:	00 00                	add    %al,(%rax)
+  80467d:	00 00                	add    %al,(%rax)
+  80467f:	00 3b                	add    %bh,(%rbx)
+  804681:	0c 80                	or     $0x80,%al
+  804683:	00 00                	add    %al,(%rax)
+  804685:	00 00                	add    %al,(%rax)
+  804687:	00 5e 0b             	add    %bl,0xb(%rsi)
+  80468a:	80 00 00             	addb   $0x0,(%rax)
+  80468d:	00 00                	add    %al,(%rax)
+  80468f:	00 3b                	add    %bh,(%rbx)
+  804691:	0c 80                	or     $0x80,%al
+  804693:	00 00                	add    %al,(%rax)
+  804695:	00 00                	add    %al,(%rax)
+  804697:	00 03                	add    %al,(%rbx)
+  804699:	06                   	(bad)
+  80469a:	80 00 00             	addb   $0x0,(%rax)
+  80469d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008046a0 <error_string>:
+	...
+  8046a8:	75 42 80 00 00 00 00 00 87 42 80 00 00 00 00 00     uB.......B......
+  8046b8:	97 42 80 00 00 00 00 00 a9 42 80 00 00 00 00 00     .B.......B......
+  8046c8:	b7 42 80 00 00 00 00 00 cb 42 80 00 00 00 00 00     .B.......B......
+  8046d8:	e0 42 80 00 00 00 00 00 f3 42 80 00 00 00 00 00     .B.......B......
+  8046e8:	05 43 80 00 00 00 00 00 19 43 80 00 00 00 00 00     .C.......C......
+  8046f8:	29 43 80 00 00 00 00 00 3c 43 80 00 00 00 00 00     )C......<C......
+  804708:	53 43 80 00 00 00 00 00 69 43 80 00 00 00 00 00     SC......iC......
+  804718:	81 43 80 00 00 00 00 00 99 43 80 00 00 00 00 00     .C.......C......
+  804728:	a6 43 80 00 00 00 00 00 48 47 80 00 00 00 00 00     .C......HG......
+  804738:	ba 43 80 00 00 00 00 00 d2 43 80 00 00 00 00 00     .C.......C......
+  804748:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804758:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804768:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804778:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804788:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804798:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8047a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8047b8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  8047c8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  8047d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8047e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8047f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804808:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804818:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804828:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804838:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804840 <devtab>:
+  804840:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804850:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804860:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804870:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804880:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804890:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8048a0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8048b0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8048c0:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  8048d0:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  8048e0:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  8048f0:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  804900:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  804910:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  804920:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  804930:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804940:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  804950:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  804960:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  804970:	77 61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72     want %08x..asser
+  804980:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  804990:	6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70 5f     lib/spawn.c.map_
+  8049a0:	73 65 67 6d 65 6e 74 2e 73 65 65 6b 20 66 61 69     segment.seek fai
+  8049b0:	6c 65 64 3a 20 25 69 0a 00 6d 61 70 5f 73 65 67     led: %i..map_seg
+  8049c0:	6d 65 6e 74 2e 72 65 61 64 6e 20 66 61 69 6c 65     ment.readn faile
+  8049d0:	64 3a 20 25 69 0a 00 63 6f 70 79 5f 73 68 61 72     d: %i..copy_shar
+  8049e0:	65 64 5f 72 65 67 69 6f 6e 3a 20 25 69 00 73 79     ed_region: %i.sy
+  8049f0:	73 5f 65 6e 76 5f 73 65 74 5f 74 72 61 70 66 72     s_env_set_trapfr
+  804a00:	61 6d 65 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f     ame: %i.sys_env_
+  804a10:	73 65 74 5f 73 74 61 74 75 73 3a 20 25 69 00 3c     set_status: %i.<
+  804a20:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  804a30:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  804a40:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804a50:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804a60:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  804a70:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804a80:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
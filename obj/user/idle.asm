@@ -0,0 +1,6625 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 a0 36 80 00 00 	movabs $0x8036a0,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb 1b 02 80 00 00 	movabs $0x80021b,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	41 89 fd             	mov    %edi,%r13d
+  80005e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800061:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800068:	00 00 00 
+  80006b:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800072:	00 00 00 
+  800075:	48 39 c2             	cmp    %rax,%rdx
+  800078:	73 17                	jae    800091 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007d:	49 89 c4             	mov    %rax,%r12
+  800080:	48 83 c3 08          	add    $0x8,%rbx
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	ff 53 f8             	call   *-0x8(%rbx)
+  80008c:	4c 39 e3             	cmp    %r12,%rbx
+  80008f:	72 ef                	jb     800080 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800091:	48 b8 ea 01 80 00 00 	movabs $0x8001ea,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000a6:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000aa:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b5:	00 00 00 
+  8000b8:	48 01 d0             	add    %rdx,%rax
+  8000bb:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000c2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c5:	45 85 ed             	test   %r13d,%r13d
+  8000c8:	7e 0d                	jle    8000d7 <libmain+0x87>
+  8000ca:	49 8b 06             	mov    (%r14),%rax
+  8000cd:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000d4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d7:	4c 89 f6             	mov    %r14,%rsi
+  8000da:	44 89 ef             	mov    %r13d,%edi
+  8000dd:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e9:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+#endif
+}
+  8000f5:	5b                   	pop    %rbx
+  8000f6:	41 5c                	pop    %r12
+  8000f8:	41 5d                	pop    %r13
+  8000fa:	41 5e                	pop    %r14
+  8000fc:	5d                   	pop    %rbp
+  8000fd:	c3                   	ret
+
+00000000008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fe:	55                   	push   %rbp
+  8000ff:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800102:	48 b8 a0 08 80 00 00 	movabs $0x8008a0,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800113:	48 b8 7f 01 80 00 00 	movabs $0x80017f,%rax
+  80011a:	00 00 00 
+  80011d:	ff d0                	call   *%rax
+}
+  80011f:	5d                   	pop    %rbp
+  800120:	c3                   	ret
+
+0000000000800121 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800121:	55                   	push   %rbp
+  800122:	48 89 e5             	mov    %rsp,%rbp
+  800125:	53                   	push   %rbx
+  800126:	48 89 fa             	mov    %rdi,%rdx
+  800129:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80012c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800136:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013b:	be 00 00 00 00       	mov    $0x0,%esi
+  800140:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800146:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+000000000080014e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80014e:	55                   	push   %rbp
+  80014f:	48 89 e5             	mov    %rsp,%rbp
+  800152:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800153:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800167:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80016c:	be 00 00 00 00       	mov    $0x0,%esi
+  800171:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800177:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800179:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80017d:	c9                   	leave
+  80017e:	c3                   	ret
+
+000000000080017f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80017f:	55                   	push   %rbp
+  800180:	48 89 e5             	mov    %rsp,%rbp
+  800183:	53                   	push   %rbx
+  800184:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800188:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80018b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800190:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800195:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019f:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001ac:	48 85 c0             	test   %rax,%rax
+  8001af:	7f 06                	jg     8001b7 <sys_env_destroy+0x38>
+}
+  8001b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b7:	49 89 c0             	mov    %rax,%r8
+  8001ba:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001bf:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8001c6:	00 00 00 
+  8001c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ce:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8001d5:	00 00 00 
+  8001d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001dd:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  8001e4:	00 00 00 
+  8001e7:	41 ff d1             	call   *%r9
+
+00000000008001ea <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001ea:	55                   	push   %rbp
+  8001eb:	48 89 e5             	mov    %rsp,%rbp
+  8001ee:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ef:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800203:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800208:	be 00 00 00 00       	mov    $0x0,%esi
+  80020d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800213:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800215:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+
+000000000080021b <sys_yield>:
+
+void
+sys_yield(void) {
+  80021b:	55                   	push   %rbp
+  80021c:	48 89 e5             	mov    %rsp,%rbp
+  80021f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800220:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800234:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800239:	be 00 00 00 00       	mov    $0x0,%esi
+  80023e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800244:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+
+000000000080024c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80024c:	55                   	push   %rbp
+  80024d:	48 89 e5             	mov    %rsp,%rbp
+  800250:	53                   	push   %rbx
+  800251:	48 89 fa             	mov    %rdi,%rdx
+  800254:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800257:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80025c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800263:	00 00 00 
+  800266:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026b:	be 00 00 00 00       	mov    $0x0,%esi
+  800270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800276:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800278:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027c:	c9                   	leave
+  80027d:	c3                   	ret
+
+000000000080027e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80027e:	55                   	push   %rbp
+  80027f:	48 89 e5             	mov    %rsp,%rbp
+  800282:	53                   	push   %rbx
+  800283:	49 89 f8             	mov    %rdi,%r8
+  800286:	48 89 d3             	mov    %rdx,%rbx
+  800289:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80028c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800291:	4c 89 c2             	mov    %r8,%rdx
+  800294:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800297:	be 00 00 00 00       	mov    $0x0,%esi
+  80029c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+
+00000000008002aa <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002aa:	55                   	push   %rbp
+  8002ab:	48 89 e5             	mov    %rsp,%rbp
+  8002ae:	53                   	push   %rbx
+  8002af:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b3:	89 f8                	mov    %edi,%eax
+  8002b5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b8:	48 63 f9             	movslq %ecx,%rdi
+  8002bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002be:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002c3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002d3:	48 85 c0             	test   %rax,%rax
+  8002d6:	7f 06                	jg     8002de <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002dc:	c9                   	leave
+  8002dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002de:	49 89 c0             	mov    %rax,%r8
+  8002e1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e6:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8002ed:	00 00 00 
+  8002f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8002f5:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8002fc:	00 00 00 
+  8002ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800304:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  80030b:	00 00 00 
+  80030e:	41 ff d1             	call   *%r9
+
+0000000000800311 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800311:	55                   	push   %rbp
+  800312:	48 89 e5             	mov    %rsp,%rbp
+  800315:	53                   	push   %rbx
+  800316:	48 83 ec 08          	sub    $0x8,%rsp
+  80031a:	89 f8                	mov    %edi,%eax
+  80031c:	49 89 f2             	mov    %rsi,%r10
+  80031f:	48 89 cf             	mov    %rcx,%rdi
+  800322:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800325:	48 63 da             	movslq %edx,%rbx
+  800328:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80032b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800330:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800333:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800336:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800338:	48 85 c0             	test   %rax,%rax
+  80033b:	7f 06                	jg     800343 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80033d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800341:	c9                   	leave
+  800342:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800343:	49 89 c0             	mov    %rax,%r8
+  800346:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80034b:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  800352:	00 00 00 
+  800355:	be 26 00 00 00       	mov    $0x26,%esi
+  80035a:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  800361:	00 00 00 
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  800370:	00 00 00 
+  800373:	41 ff d1             	call   *%r9
+
+0000000000800376 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800376:	55                   	push   %rbp
+  800377:	48 89 e5             	mov    %rsp,%rbp
+  80037a:	53                   	push   %rbx
+  80037b:	48 83 ec 08          	sub    $0x8,%rsp
+  80037f:	48 89 f1             	mov    %rsi,%rcx
+  800382:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800385:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800388:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80038d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800392:	be 00 00 00 00       	mov    $0x0,%esi
+  800397:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80039d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80039f:	48 85 c0             	test   %rax,%rax
+  8003a2:	7f 06                	jg     8003aa <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003aa:	49 89 c0             	mov    %rax,%r8
+  8003ad:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003b2:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8003b9:	00 00 00 
+  8003bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8003c1:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8003c8:	00 00 00 
+  8003cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d0:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  8003d7:	00 00 00 
+  8003da:	41 ff d1             	call   *%r9
+
+00000000008003dd <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003dd:	55                   	push   %rbp
+  8003de:	48 89 e5             	mov    %rsp,%rbp
+  8003e1:	53                   	push   %rbx
+  8003e2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003e6:	48 63 ce             	movslq %esi,%rcx
+  8003e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ec:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800406:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800408:	48 85 c0             	test   %rax,%rax
+  80040b:	7f 06                	jg     800413 <sys_env_set_status+0x36>
+}
+  80040d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800411:	c9                   	leave
+  800412:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800413:	49 89 c0             	mov    %rax,%r8
+  800416:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80041b:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  800422:	00 00 00 
+  800425:	be 26 00 00 00       	mov    $0x26,%esi
+  80042a:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  800431:	00 00 00 
+  800434:	b8 00 00 00 00       	mov    $0x0,%eax
+  800439:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  800440:	00 00 00 
+  800443:	41 ff d1             	call   *%r9
+
+0000000000800446 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+  80044a:	53                   	push   %rbx
+  80044b:	48 83 ec 08          	sub    $0x8,%rsp
+  80044f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800452:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800455:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80045a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800464:	be 00 00 00 00       	mov    $0x0,%esi
+  800469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80046f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800471:	48 85 c0             	test   %rax,%rax
+  800474:	7f 06                	jg     80047c <sys_env_set_trapframe+0x36>
+}
+  800476:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80047c:	49 89 c0             	mov    %rax,%r8
+  80047f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800484:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80048b:	00 00 00 
+  80048e:	be 26 00 00 00       	mov    $0x26,%esi
+  800493:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80049a:	00 00 00 
+  80049d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a2:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  8004a9:	00 00 00 
+  8004ac:	41 ff d1             	call   *%r9
+
+00000000008004af <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8004af:	55                   	push   %rbp
+  8004b0:	48 89 e5             	mov    %rsp,%rbp
+  8004b3:	53                   	push   %rbx
+  8004b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8004bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004be:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004da:	48 85 c0             	test   %rax,%rax
+  8004dd:	7f 06                	jg     8004e5 <sys_env_set_pgfault_upcall+0x36>
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e5:	49 89 c0             	mov    %rax,%r8
+  8004e8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004ed:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8004f4:	00 00 00 
+  8004f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8004fc:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  800503:	00 00 00 
+  800506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050b:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  800512:	00 00 00 
+  800515:	41 ff d1             	call   *%r9
+
+0000000000800518 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800518:	55                   	push   %rbp
+  800519:	48 89 e5             	mov    %rsp,%rbp
+  80051c:	53                   	push   %rbx
+  80051d:	89 f8                	mov    %edi,%eax
+  80051f:	49 89 f1             	mov    %rsi,%r9
+  800522:	48 89 d3             	mov    %rdx,%rbx
+  800525:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800528:	49 63 f0             	movslq %r8d,%rsi
+  80052b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80052e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800533:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80053c:	cd 30                	int    $0x30
+}
+  80053e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800542:	c9                   	leave
+  800543:	c3                   	ret
+
+0000000000800544 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  800544:	55                   	push   %rbp
+  800545:	48 89 e5             	mov    %rsp,%rbp
+  800548:	53                   	push   %rbx
+  800549:	48 83 ec 08          	sub    $0x8,%rsp
+  80054d:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800550:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800553:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800558:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80055b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800560:	be 00 00 00 00       	mov    $0x0,%esi
+  800565:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80056b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80056d:	48 85 c0             	test   %rax,%rax
+  800570:	7f 06                	jg     800578 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800572:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800576:	c9                   	leave
+  800577:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800578:	49 89 c0             	mov    %rax,%r8
+  80057b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800580:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  800587:	00 00 00 
+  80058a:	be 26 00 00 00       	mov    $0x26,%esi
+  80058f:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  800596:	00 00 00 
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	49 b9 0b 25 80 00 00 	movabs $0x80250b,%r9
+  8005a5:	00 00 00 
+  8005a8:	41 ff d1             	call   *%r9
+
+00000000008005ab <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8005ab:	55                   	push   %rbp
+  8005ac:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8005af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b4:	48 b8 44 05 80 00 00 	movabs $0x800544,%rax
+  8005bb:	00 00 00 
+  8005be:	ff d0                	call   *%rax
+}
+  8005c0:	5d                   	pop    %rbp
+  8005c1:	c3                   	ret
+
+00000000008005c2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8005c2:	55                   	push   %rbp
+  8005c3:	48 89 e5             	mov    %rsp,%rbp
+  8005c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005eb:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f1:	c9                   	leave
+  8005f2:	c3                   	ret
+
+00000000008005f3 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005f3:	55                   	push   %rbp
+  8005f4:	48 89 e5             	mov    %rsp,%rbp
+  8005f7:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005f8:	48 63 ce             	movslq %esi,%rcx
+  8005fb:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ff:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80060e:	be 00 00 00 00       	mov    $0x0,%esi
+  800613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800619:	cd 30                	int    $0x30
+}
+  80061b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80061f:	c9                   	leave
+  800620:	c3                   	ret
+
+0000000000800621 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	53                   	push   %rbx
+  800626:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800629:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80062d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800637:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063c:	be 00 00 00 00       	mov    $0x0,%esi
+  800641:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800647:	cd 30                	int    $0x30
+}
+  800649:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064d:	c9                   	leave
+  80064e:	c3                   	ret
+
+000000000080064f <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80064f:	55                   	push   %rbp
+  800650:	48 89 e5             	mov    %rsp,%rbp
+  800653:	53                   	push   %rbx
+  800654:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  800657:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80065a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80065f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800662:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800667:	be 00 00 00 00       	mov    $0x0,%esi
+  80066c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800672:	cd 30                	int    $0x30
+}
+  800674:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800678:	c9                   	leave
+  800679:	c3                   	ret
+
+000000000080067a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80067a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800681:	ff ff ff 
+  800684:	48 01 f8             	add    %rdi,%rax
+  800687:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80068b:	c3                   	ret
+
+000000000080068c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80068c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800693:	ff ff ff 
+  800696:	48 01 f8             	add    %rdi,%rax
+  800699:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80069d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006a3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006a7:	c3                   	ret
+
+00000000008006a8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006a8:	55                   	push   %rbp
+  8006a9:	48 89 e5             	mov    %rsp,%rbp
+  8006ac:	41 57                	push   %r15
+  8006ae:	41 56                	push   %r14
+  8006b0:	41 55                	push   %r13
+  8006b2:	41 54                	push   %r12
+  8006b4:	53                   	push   %rbx
+  8006b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b9:	49 89 ff             	mov    %rdi,%r15
+  8006bc:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c1:	49 bd c7 21 80 00 00 	movabs $0x8021c7,%r13
+  8006c8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006cb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006d1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006d4:	48 89 df             	mov    %rbx,%rdi
+  8006d7:	41 ff d5             	call   *%r13
+  8006da:	83 e0 04             	and    $0x4,%eax
+  8006dd:	74 17                	je     8006f6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006df:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006e6:	4c 39 f3             	cmp    %r14,%rbx
+  8006e9:	75 e6                	jne    8006d1 <fd_alloc+0x29>
+  8006eb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006f1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006f6:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006f9:	48 83 c4 08          	add    $0x8,%rsp
+  8006fd:	5b                   	pop    %rbx
+  8006fe:	41 5c                	pop    %r12
+  800700:	41 5d                	pop    %r13
+  800702:	41 5e                	pop    %r14
+  800704:	41 5f                	pop    %r15
+  800706:	5d                   	pop    %rbp
+  800707:	c3                   	ret
+
+0000000000800708 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800708:	83 ff 1f             	cmp    $0x1f,%edi
+  80070b:	77 39                	ja     800746 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80070d:	55                   	push   %rbp
+  80070e:	48 89 e5             	mov    %rsp,%rbp
+  800711:	41 54                	push   %r12
+  800713:	53                   	push   %rbx
+  800714:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800717:	48 63 df             	movslq %edi,%rbx
+  80071a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800721:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800725:	48 89 df             	mov    %rbx,%rdi
+  800728:	48 b8 c7 21 80 00 00 	movabs $0x8021c7,%rax
+  80072f:	00 00 00 
+  800732:	ff d0                	call   *%rax
+  800734:	a8 04                	test   $0x4,%al
+  800736:	74 14                	je     80074c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800738:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800741:	5b                   	pop    %rbx
+  800742:	41 5c                	pop    %r12
+  800744:	5d                   	pop    %rbp
+  800745:	c3                   	ret
+        return -E_INVAL;
+  800746:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80074b:	c3                   	ret
+        return -E_INVAL;
+  80074c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800751:	eb ee                	jmp    800741 <fd_lookup+0x39>
+
+0000000000800753 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800753:	55                   	push   %rbp
+  800754:	48 89 e5             	mov    %rsp,%rbp
+  800757:	41 54                	push   %r12
+  800759:	53                   	push   %rbx
+  80075a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80075d:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  800764:	00 00 00 
+  800767:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80076e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800771:	39 3b                	cmp    %edi,(%rbx)
+  800773:	74 47                	je     8007bc <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800775:	48 83 c0 08          	add    $0x8,%rax
+  800779:	48 8b 18             	mov    (%rax),%rbx
+  80077c:	48 85 db             	test   %rbx,%rbx
+  80077f:	75 f0                	jne    800771 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800781:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800788:	00 00 00 
+  80078b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800791:	89 fa                	mov    %edi,%edx
+  800793:	48 bf e0 36 80 00 00 	movabs $0x8036e0,%rdi
+  80079a:	00 00 00 
+  80079d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a2:	48 b9 5b 26 80 00 00 	movabs $0x80265b,%rcx
+  8007a9:	00 00 00 
+  8007ac:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007b3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007b7:	5b                   	pop    %rbx
+  8007b8:	41 5c                	pop    %r12
+  8007ba:	5d                   	pop    %rbp
+  8007bb:	c3                   	ret
+            return 0;
+  8007bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c1:	eb f0                	jmp    8007b3 <dev_lookup+0x60>
+
+00000000008007c3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007c3:	55                   	push   %rbp
+  8007c4:	48 89 e5             	mov    %rsp,%rbp
+  8007c7:	41 55                	push   %r13
+  8007c9:	41 54                	push   %r12
+  8007cb:	53                   	push   %rbx
+  8007cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8007d0:	48 89 fb             	mov    %rdi,%rbx
+  8007d3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007d6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007dd:	ff ff ff 
+  8007e0:	48 01 df             	add    %rbx,%rdi
+  8007e3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007e7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007eb:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+  8007f7:	41 89 c5             	mov    %eax,%r13d
+  8007fa:	85 c0                	test   %eax,%eax
+  8007fc:	78 06                	js     800804 <fd_close+0x41>
+  8007fe:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800802:	74 1a                	je     80081e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800804:	45 84 e4             	test   %r12b,%r12b
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800810:	44 89 e8             	mov    %r13d,%eax
+  800813:	48 83 c4 18          	add    $0x18,%rsp
+  800817:	5b                   	pop    %rbx
+  800818:	41 5c                	pop    %r12
+  80081a:	41 5d                	pop    %r13
+  80081c:	5d                   	pop    %rbp
+  80081d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80081e:	8b 3b                	mov    (%rbx),%edi
+  800820:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800824:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  80082b:	00 00 00 
+  80082e:	ff d0                	call   *%rax
+  800830:	41 89 c5             	mov    %eax,%r13d
+  800833:	85 c0                	test   %eax,%eax
+  800835:	78 1b                	js     800852 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800837:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80083b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80083f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800845:	48 85 c0             	test   %rax,%rax
+  800848:	74 08                	je     800852 <fd_close+0x8f>
+  80084a:	48 89 df             	mov    %rbx,%rdi
+  80084d:	ff d0                	call   *%rax
+  80084f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800852:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800857:	48 89 de             	mov    %rbx,%rsi
+  80085a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80085f:	48 b8 76 03 80 00 00 	movabs $0x800376,%rax
+  800866:	00 00 00 
+  800869:	ff d0                	call   *%rax
+    return res;
+  80086b:	eb a3                	jmp    800810 <fd_close+0x4d>
+
+000000000080086d <close>:
+
+int
+close(int fdnum) {
+  80086d:	55                   	push   %rbp
+  80086e:	48 89 e5             	mov    %rsp,%rbp
+  800871:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800875:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800879:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800880:	00 00 00 
+  800883:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800885:	85 c0                	test   %eax,%eax
+  800887:	78 15                	js     80089e <close+0x31>
+
+    return fd_close(fd, 1);
+  800889:	be 01 00 00 00       	mov    $0x1,%esi
+  80088e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800892:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800899:	00 00 00 
+  80089c:	ff d0                	call   *%rax
+}
+  80089e:	c9                   	leave
+  80089f:	c3                   	ret
+
+00000000008008a0 <close_all>:
+
+void
+close_all(void) {
+  8008a0:	55                   	push   %rbp
+  8008a1:	48 89 e5             	mov    %rsp,%rbp
+  8008a4:	41 54                	push   %r12
+  8008a6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008ac:	49 bc 6d 08 80 00 00 	movabs $0x80086d,%r12
+  8008b3:	00 00 00 
+  8008b6:	89 df                	mov    %ebx,%edi
+  8008b8:	41 ff d4             	call   *%r12
+  8008bb:	83 c3 01             	add    $0x1,%ebx
+  8008be:	83 fb 20             	cmp    $0x20,%ebx
+  8008c1:	75 f3                	jne    8008b6 <close_all+0x16>
+}
+  8008c3:	5b                   	pop    %rbx
+  8008c4:	41 5c                	pop    %r12
+  8008c6:	5d                   	pop    %rbp
+  8008c7:	c3                   	ret
+
+00000000008008c8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008c8:	55                   	push   %rbp
+  8008c9:	48 89 e5             	mov    %rsp,%rbp
+  8008cc:	41 57                	push   %r15
+  8008ce:	41 56                	push   %r14
+  8008d0:	41 55                	push   %r13
+  8008d2:	41 54                	push   %r12
+  8008d4:	53                   	push   %rbx
+  8008d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8008d9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008dc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008e0:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  8008e7:	00 00 00 
+  8008ea:	ff d0                	call   *%rax
+  8008ec:	89 c3                	mov    %eax,%ebx
+  8008ee:	85 c0                	test   %eax,%eax
+  8008f0:	0f 88 b8 00 00 00    	js     8009ae <dup+0xe6>
+    close(newfdnum);
+  8008f6:	44 89 e7             	mov    %r12d,%edi
+  8008f9:	48 b8 6d 08 80 00 00 	movabs $0x80086d,%rax
+  800900:	00 00 00 
+  800903:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800905:	4d 63 ec             	movslq %r12d,%r13
+  800908:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80090f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800913:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800917:	4c 89 ff             	mov    %r15,%rdi
+  80091a:	49 be 8c 06 80 00 00 	movabs $0x80068c,%r14
+  800921:	00 00 00 
+  800924:	41 ff d6             	call   *%r14
+  800927:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80092a:	4c 89 ef             	mov    %r13,%rdi
+  80092d:	41 ff d6             	call   *%r14
+  800930:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800933:	48 89 df             	mov    %rbx,%rdi
+  800936:	48 b8 c7 21 80 00 00 	movabs $0x8021c7,%rax
+  80093d:	00 00 00 
+  800940:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800942:	a8 04                	test   $0x4,%al
+  800944:	74 2b                	je     800971 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800946:	41 89 c1             	mov    %eax,%r9d
+  800949:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80094f:	4c 89 f1             	mov    %r14,%rcx
+  800952:	ba 00 00 00 00       	mov    $0x0,%edx
+  800957:	48 89 de             	mov    %rbx,%rsi
+  80095a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80095f:	48 b8 11 03 80 00 00 	movabs $0x800311,%rax
+  800966:	00 00 00 
+  800969:	ff d0                	call   *%rax
+  80096b:	89 c3                	mov    %eax,%ebx
+  80096d:	85 c0                	test   %eax,%eax
+  80096f:	78 4e                	js     8009bf <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800971:	4c 89 ff             	mov    %r15,%rdi
+  800974:	48 b8 c7 21 80 00 00 	movabs $0x8021c7,%rax
+  80097b:	00 00 00 
+  80097e:	ff d0                	call   *%rax
+  800980:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800983:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800989:	4c 89 e9             	mov    %r13,%rcx
+  80098c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800991:	4c 89 fe             	mov    %r15,%rsi
+  800994:	bf 00 00 00 00       	mov    $0x0,%edi
+  800999:	48 b8 11 03 80 00 00 	movabs $0x800311,%rax
+  8009a0:	00 00 00 
+  8009a3:	ff d0                	call   *%rax
+  8009a5:	89 c3                	mov    %eax,%ebx
+  8009a7:	85 c0                	test   %eax,%eax
+  8009a9:	78 14                	js     8009bf <dup+0xf7>
+
+    return newfdnum;
+  8009ab:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009ae:	89 d8                	mov    %ebx,%eax
+  8009b0:	48 83 c4 18          	add    $0x18,%rsp
+  8009b4:	5b                   	pop    %rbx
+  8009b5:	41 5c                	pop    %r12
+  8009b7:	41 5d                	pop    %r13
+  8009b9:	41 5e                	pop    %r14
+  8009bb:	41 5f                	pop    %r15
+  8009bd:	5d                   	pop    %rbp
+  8009be:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009c4:	4c 89 ee             	mov    %r13,%rsi
+  8009c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009cc:	49 bc 76 03 80 00 00 	movabs $0x800376,%r12
+  8009d3:	00 00 00 
+  8009d6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009de:	4c 89 f6             	mov    %r14,%rsi
+  8009e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e6:	41 ff d4             	call   *%r12
+    return res;
+  8009e9:	eb c3                	jmp    8009ae <dup+0xe6>
+
+00000000008009eb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009eb:	55                   	push   %rbp
+  8009ec:	48 89 e5             	mov    %rsp,%rbp
+  8009ef:	41 56                	push   %r14
+  8009f1:	41 55                	push   %r13
+  8009f3:	41 54                	push   %r12
+  8009f5:	53                   	push   %rbx
+  8009f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8009fa:	89 fb                	mov    %edi,%ebx
+  8009fc:	49 89 f4             	mov    %rsi,%r12
+  8009ff:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a06:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800a0d:	00 00 00 
+  800a10:	ff d0                	call   *%rax
+  800a12:	85 c0                	test   %eax,%eax
+  800a14:	78 4c                	js     800a62 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a16:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a1a:	41 8b 3e             	mov    (%r14),%edi
+  800a1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a21:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800a28:	00 00 00 
+  800a2b:	ff d0                	call   *%rax
+  800a2d:	85 c0                	test   %eax,%eax
+  800a2f:	78 35                	js     800a66 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a31:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a35:	83 e0 03             	and    $0x3,%eax
+  800a38:	83 f8 01             	cmp    $0x1,%eax
+  800a3b:	74 2d                	je     800a6a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a41:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a45:	48 85 c0             	test   %rax,%rax
+  800a48:	74 56                	je     800aa0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a4a:	4c 89 ea             	mov    %r13,%rdx
+  800a4d:	4c 89 e6             	mov    %r12,%rsi
+  800a50:	4c 89 f7             	mov    %r14,%rdi
+  800a53:	ff d0                	call   *%rax
+}
+  800a55:	48 83 c4 10          	add    $0x10,%rsp
+  800a59:	5b                   	pop    %rbx
+  800a5a:	41 5c                	pop    %r12
+  800a5c:	41 5d                	pop    %r13
+  800a5e:	41 5e                	pop    %r14
+  800a60:	5d                   	pop    %rbp
+  800a61:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a62:	48 98                	cltq
+  800a64:	eb ef                	jmp    800a55 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a66:	48 98                	cltq
+  800a68:	eb eb                	jmp    800a55 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a6a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a71:	00 00 00 
+  800a74:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a7a:	89 da                	mov    %ebx,%edx
+  800a7c:	48 bf 41 37 80 00 00 	movabs $0x803741,%rdi
+  800a83:	00 00 00 
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8b:	48 b9 5b 26 80 00 00 	movabs $0x80265b,%rcx
+  800a92:	00 00 00 
+  800a95:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a97:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a9e:	eb b5                	jmp    800a55 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aa0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800aa7:	eb ac                	jmp    800a55 <read+0x6a>
+
+0000000000800aa9 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800aa9:	55                   	push   %rbp
+  800aaa:	48 89 e5             	mov    %rsp,%rbp
+  800aad:	41 56                	push   %r14
+  800aaf:	41 55                	push   %r13
+  800ab1:	41 54                	push   %r12
+  800ab3:	53                   	push   %rbx
+  800ab4:	48 83 ec 10          	sub    $0x10,%rsp
+  800ab8:	89 fb                	mov    %edi,%ebx
+  800aba:	49 89 f4             	mov    %rsi,%r12
+  800abd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ac0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ac4:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800acb:	00 00 00 
+  800ace:	ff d0                	call   *%rax
+  800ad0:	85 c0                	test   %eax,%eax
+  800ad2:	78 41                	js     800b15 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ad4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ad8:	41 8b 3e             	mov    (%r14),%edi
+  800adb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800adf:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800ae6:	00 00 00 
+  800ae9:	ff d0                	call   *%rax
+  800aeb:	85 c0                	test   %eax,%eax
+  800aed:	78 35                	js     800b24 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aef:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800af3:	83 e0 03             	and    $0x3,%eax
+  800af6:	83 f8 01             	cmp    $0x1,%eax
+  800af9:	74 2d                	je     800b28 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800afb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800aff:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b03:	48 85 c0             	test   %rax,%rax
+  800b06:	74 56                	je     800b5e <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800b08:	4c 89 ea             	mov    %r13,%rdx
+  800b0b:	4c 89 e6             	mov    %r12,%rsi
+  800b0e:	4c 89 f7             	mov    %r14,%rdi
+  800b11:	ff d0                	call   *%rax
+  800b13:	eb 02                	jmp    800b17 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b15:	48 98                	cltq
+}
+  800b17:	48 83 c4 10          	add    $0x10,%rsp
+  800b1b:	5b                   	pop    %rbx
+  800b1c:	41 5c                	pop    %r12
+  800b1e:	41 5d                	pop    %r13
+  800b20:	41 5e                	pop    %r14
+  800b22:	5d                   	pop    %rbp
+  800b23:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b24:	48 98                	cltq
+  800b26:	eb ef                	jmp    800b17 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b2f:	00 00 00 
+  800b32:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b38:	89 da                	mov    %ebx,%edx
+  800b3a:	48 bf 00 37 80 00 00 	movabs $0x803700,%rdi
+  800b41:	00 00 00 
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b49:	48 b9 5b 26 80 00 00 	movabs $0x80265b,%rcx
+  800b50:	00 00 00 
+  800b53:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b55:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b5c:	eb b9                	jmp    800b17 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b5e:	4c 89 ea             	mov    %r13,%rdx
+  800b61:	4c 89 e6             	mov    %r12,%rsi
+  800b64:	89 df                	mov    %ebx,%edi
+  800b66:	48 b8 eb 09 80 00 00 	movabs $0x8009eb,%rax
+  800b6d:	00 00 00 
+  800b70:	ff d0                	call   *%rax
+  800b72:	eb a3                	jmp    800b17 <readmap+0x6e>
+
+0000000000800b74 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b74:	55                   	push   %rbp
+  800b75:	48 89 e5             	mov    %rsp,%rbp
+  800b78:	41 57                	push   %r15
+  800b7a:	41 56                	push   %r14
+  800b7c:	41 55                	push   %r13
+  800b7e:	41 54                	push   %r12
+  800b80:	53                   	push   %rbx
+  800b81:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b85:	48 85 d2             	test   %rdx,%rdx
+  800b88:	74 54                	je     800bde <readn+0x6a>
+  800b8a:	41 89 fd             	mov    %edi,%r13d
+  800b8d:	49 89 f6             	mov    %rsi,%r14
+  800b90:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b93:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b98:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b9d:	49 bf eb 09 80 00 00 	movabs $0x8009eb,%r15
+  800ba4:	00 00 00 
+  800ba7:	4c 89 e2             	mov    %r12,%rdx
+  800baa:	48 29 f2             	sub    %rsi,%rdx
+  800bad:	4c 01 f6             	add    %r14,%rsi
+  800bb0:	44 89 ef             	mov    %r13d,%edi
+  800bb3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800bb6:	85 c0                	test   %eax,%eax
+  800bb8:	78 20                	js     800bda <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bba:	01 c3                	add    %eax,%ebx
+  800bbc:	85 c0                	test   %eax,%eax
+  800bbe:	74 08                	je     800bc8 <readn+0x54>
+  800bc0:	48 63 f3             	movslq %ebx,%rsi
+  800bc3:	4c 39 e6             	cmp    %r12,%rsi
+  800bc6:	72 df                	jb     800ba7 <readn+0x33>
+    }
+    return res;
+  800bc8:	48 63 c3             	movslq %ebx,%rax
+}
+  800bcb:	48 83 c4 08          	add    $0x8,%rsp
+  800bcf:	5b                   	pop    %rbx
+  800bd0:	41 5c                	pop    %r12
+  800bd2:	41 5d                	pop    %r13
+  800bd4:	41 5e                	pop    %r14
+  800bd6:	41 5f                	pop    %r15
+  800bd8:	5d                   	pop    %rbp
+  800bd9:	c3                   	ret
+        if (inc < 0) return inc;
+  800bda:	48 98                	cltq
+  800bdc:	eb ed                	jmp    800bcb <readn+0x57>
+    int inc = 1, res = 0;
+  800bde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be3:	eb e3                	jmp    800bc8 <readn+0x54>
+
+0000000000800be5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800be5:	55                   	push   %rbp
+  800be6:	48 89 e5             	mov    %rsp,%rbp
+  800be9:	41 56                	push   %r14
+  800beb:	41 55                	push   %r13
+  800bed:	41 54                	push   %r12
+  800bef:	53                   	push   %rbx
+  800bf0:	48 83 ec 10          	sub    $0x10,%rsp
+  800bf4:	89 fb                	mov    %edi,%ebx
+  800bf6:	49 89 f4             	mov    %rsi,%r12
+  800bf9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c00:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800c07:	00 00 00 
+  800c0a:	ff d0                	call   *%rax
+  800c0c:	85 c0                	test   %eax,%eax
+  800c0e:	78 47                	js     800c57 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c10:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c14:	41 8b 3e             	mov    (%r14),%edi
+  800c17:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c1b:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800c22:	00 00 00 
+  800c25:	ff d0                	call   *%rax
+  800c27:	85 c0                	test   %eax,%eax
+  800c29:	78 30                	js     800c5b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c2b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c30:	74 2d                	je     800c5f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c36:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c3a:	48 85 c0             	test   %rax,%rax
+  800c3d:	74 56                	je     800c95 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c3f:	4c 89 ea             	mov    %r13,%rdx
+  800c42:	4c 89 e6             	mov    %r12,%rsi
+  800c45:	4c 89 f7             	mov    %r14,%rdi
+  800c48:	ff d0                	call   *%rax
+}
+  800c4a:	48 83 c4 10          	add    $0x10,%rsp
+  800c4e:	5b                   	pop    %rbx
+  800c4f:	41 5c                	pop    %r12
+  800c51:	41 5d                	pop    %r13
+  800c53:	41 5e                	pop    %r14
+  800c55:	5d                   	pop    %rbp
+  800c56:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c57:	48 98                	cltq
+  800c59:	eb ef                	jmp    800c4a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c5b:	48 98                	cltq
+  800c5d:	eb eb                	jmp    800c4a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c5f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c66:	00 00 00 
+  800c69:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c6f:	89 da                	mov    %ebx,%edx
+  800c71:	48 bf 5d 37 80 00 00 	movabs $0x80375d,%rdi
+  800c78:	00 00 00 
+  800c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c80:	48 b9 5b 26 80 00 00 	movabs $0x80265b,%rcx
+  800c87:	00 00 00 
+  800c8a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c8c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c93:	eb b5                	jmp    800c4a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c95:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c9c:	eb ac                	jmp    800c4a <write+0x65>
+
+0000000000800c9e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c9e:	55                   	push   %rbp
+  800c9f:	48 89 e5             	mov    %rsp,%rbp
+  800ca2:	53                   	push   %rbx
+  800ca3:	48 83 ec 18          	sub    $0x18,%rsp
+  800ca7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cad:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+  800cb9:	85 c0                	test   %eax,%eax
+  800cbb:	78 0c                	js     800cc9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ccd:	c9                   	leave
+  800cce:	c3                   	ret
+
+0000000000800ccf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800ccf:	55                   	push   %rbp
+  800cd0:	48 89 e5             	mov    %rsp,%rbp
+  800cd3:	41 55                	push   %r13
+  800cd5:	41 54                	push   %r12
+  800cd7:	53                   	push   %rbx
+  800cd8:	48 83 ec 18          	sub    $0x18,%rsp
+  800cdc:	89 fb                	mov    %edi,%ebx
+  800cde:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ce1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ce5:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800cec:	00 00 00 
+  800cef:	ff d0                	call   *%rax
+  800cf1:	85 c0                	test   %eax,%eax
+  800cf3:	78 38                	js     800d2d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cf9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d01:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800d08:	00 00 00 
+  800d0b:	ff d0                	call   *%rax
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	78 1c                	js     800d2d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d11:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d16:	74 20                	je     800d38 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d1c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800d20:	48 85 c0             	test   %rax,%rax
+  800d23:	74 47                	je     800d6c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d25:	44 89 e6             	mov    %r12d,%esi
+  800d28:	4c 89 ef             	mov    %r13,%rdi
+  800d2b:	ff d0                	call   *%rax
+}
+  800d2d:	48 83 c4 18          	add    $0x18,%rsp
+  800d31:	5b                   	pop    %rbx
+  800d32:	41 5c                	pop    %r12
+  800d34:	41 5d                	pop    %r13
+  800d36:	5d                   	pop    %rbp
+  800d37:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d38:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d3f:	00 00 00 
+  800d42:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d48:	89 da                	mov    %ebx,%edx
+  800d4a:	48 bf 20 37 80 00 00 	movabs $0x803720,%rdi
+  800d51:	00 00 00 
+  800d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d59:	48 b9 5b 26 80 00 00 	movabs $0x80265b,%rcx
+  800d60:	00 00 00 
+  800d63:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d6a:	eb c1                	jmp    800d2d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d6c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d71:	eb ba                	jmp    800d2d <ftruncate+0x5e>
+
+0000000000800d73 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d73:	55                   	push   %rbp
+  800d74:	48 89 e5             	mov    %rsp,%rbp
+  800d77:	41 54                	push   %r12
+  800d79:	53                   	push   %rbx
+  800d7a:	48 83 ec 10          	sub    $0x10,%rsp
+  800d7e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d85:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	78 4e                	js     800de3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d95:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d99:	41 8b 3c 24          	mov    (%r12),%edi
+  800d9d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800da1:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800da8:	00 00 00 
+  800dab:	ff d0                	call   *%rax
+  800dad:	85 c0                	test   %eax,%eax
+  800daf:	78 32                	js     800de3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800db1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800db5:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800dba:	74 30                	je     800dec <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800dbc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800dbf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800dc6:	00 00 00 
+    stat->st_isdir = 0;
+  800dc9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dd0:	00 00 00 
+    stat->st_dev = dev;
+  800dd3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dda:	48 89 de             	mov    %rbx,%rsi
+  800ddd:	4c 89 e7             	mov    %r12,%rdi
+  800de0:	ff 50 30             	call   *0x30(%rax)
+}
+  800de3:	48 83 c4 10          	add    $0x10,%rsp
+  800de7:	5b                   	pop    %rbx
+  800de8:	41 5c                	pop    %r12
+  800dea:	5d                   	pop    %rbp
+  800deb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800df1:	eb f0                	jmp    800de3 <fstat+0x70>
+
+0000000000800df3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800df3:	55                   	push   %rbp
+  800df4:	48 89 e5             	mov    %rsp,%rbp
+  800df7:	41 54                	push   %r12
+  800df9:	53                   	push   %rbx
+  800dfa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dfd:	be 00 00 00 00       	mov    $0x0,%esi
+  800e02:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  800e09:	00 00 00 
+  800e0c:	ff d0                	call   *%rax
+  800e0e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e10:	85 c0                	test   %eax,%eax
+  800e12:	78 25                	js     800e39 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e14:	4c 89 e6             	mov    %r12,%rsi
+  800e17:	89 c7                	mov    %eax,%edi
+  800e19:	48 b8 73 0d 80 00 00 	movabs $0x800d73,%rax
+  800e20:	00 00 00 
+  800e23:	ff d0                	call   *%rax
+  800e25:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e28:	89 df                	mov    %ebx,%edi
+  800e2a:	48 b8 6d 08 80 00 00 	movabs $0x80086d,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+
+    return res;
+  800e36:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e39:	89 d8                	mov    %ebx,%eax
+  800e3b:	5b                   	pop    %rbx
+  800e3c:	41 5c                	pop    %r12
+  800e3e:	5d                   	pop    %rbp
+  800e3f:	c3                   	ret
+
+0000000000800e40 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e40:	55                   	push   %rbp
+  800e41:	48 89 e5             	mov    %rsp,%rbp
+  800e44:	41 54                	push   %r12
+  800e46:	53                   	push   %rbx
+  800e47:	48 83 ec 10          	sub    $0x10,%rsp
+  800e4b:	48 89 fb             	mov    %rdi,%rbx
+  800e4e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e51:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e55:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e5a:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800e61:	00 00 00 
+  800e64:	ff d0                	call   *%rax
+  800e66:	85 c0                	test   %eax,%eax
+  800e68:	78 1f                	js     800e89 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e6e:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e72:	48 85 c0             	test   %rax,%rax
+  800e75:	74 1b                	je     800e92 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e77:	4c 89 e6             	mov    %r12,%rsi
+  800e7a:	48 89 df             	mov    %rbx,%rdi
+  800e7d:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e86:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e89:	48 83 c4 10          	add    $0x10,%rsp
+  800e8d:	5b                   	pop    %rbx
+  800e8e:	41 5c                	pop    %r12
+  800e90:	5d                   	pop    %rbp
+  800e91:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e92:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e97:	eb f0                	jmp    800e89 <create_snapshot+0x49>
+
+0000000000800e99 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e99:	55                   	push   %rbp
+  800e9a:	48 89 e5             	mov    %rsp,%rbp
+  800e9d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ea1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800ea5:	bf 66 00 00 00       	mov    $0x66,%edi
+  800eaa:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	78 1e                	js     800ed8 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800eba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ebe:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800ec2:	48 85 d2             	test   %rdx,%rdx
+  800ec5:	74 13                	je     800eda <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecc:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed5:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800ed8:	c9                   	leave
+  800ed9:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eda:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800edf:	eb f7                	jmp    800ed8 <print_snapshot_list+0x3f>
+
+0000000000800ee1 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800ee1:	55                   	push   %rbp
+  800ee2:	48 89 e5             	mov    %rsp,%rbp
+  800ee5:	53                   	push   %rbx
+  800ee6:	48 83 ec 18          	sub    $0x18,%rsp
+  800eea:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800eed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ef1:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ef6:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800efd:	00 00 00 
+  800f00:	ff d0                	call   *%rax
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	78 1c                	js     800f22 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f0a:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800f0e:	48 85 c0             	test   %rax,%rax
+  800f11:	74 15                	je     800f28 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800f13:	48 89 df             	mov    %rbx,%rdi
+  800f16:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f18:	85 c0                	test   %eax,%eax
+  800f1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f26:	c9                   	leave
+  800f27:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f28:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f2d:	eb f3                	jmp    800f22 <accept_snapshot+0x41>
+
+0000000000800f2f <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f2f:	55                   	push   %rbp
+  800f30:	48 89 e5             	mov    %rsp,%rbp
+  800f33:	53                   	push   %rbx
+  800f34:	48 83 ec 18          	sub    $0x18,%rsp
+  800f38:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f3b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f3f:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f44:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800f4b:	00 00 00 
+  800f4e:	ff d0                	call   *%rax
+  800f50:	85 c0                	test   %eax,%eax
+  800f52:	78 1c                	js     800f70 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f58:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f5c:	48 85 c0             	test   %rax,%rax
+  800f5f:	74 15                	je     800f76 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f61:	48 89 df             	mov    %rbx,%rdi
+  800f64:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f66:	85 c0                	test   %eax,%eax
+  800f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f74:	c9                   	leave
+  800f75:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f76:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f7b:	eb f3                	jmp    800f70 <delete_snapshot+0x41>
+
+0000000000800f7d <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f7d:	55                   	push   %rbp
+  800f7e:	48 89 e5             	mov    %rsp,%rbp
+  800f81:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f85:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f89:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f8e:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800f95:	00 00 00 
+  800f98:	ff d0                	call   *%rax
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	78 14                	js     800fb2 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800fa2:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800fa6:	48 85 d2             	test   %rdx,%rdx
+  800fa9:	74 09                	je     800fb4 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb0:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800fb2:	c9                   	leave
+  800fb3:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fb4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800fb9:	eb f7                	jmp    800fb2 <gc_snapshots+0x35>
+
+0000000000800fbb <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800fbb:	55                   	push   %rbp
+  800fbc:	48 89 e5             	mov    %rsp,%rbp
+  800fbf:	41 56                	push   %r14
+  800fc1:	41 55                	push   %r13
+  800fc3:	41 54                	push   %r12
+  800fc5:	53                   	push   %rbx
+  800fc6:	48 83 ec 10          	sub    $0x10,%rsp
+  800fca:	48 89 fb             	mov    %rdi,%rbx
+  800fcd:	49 89 f4             	mov    %rsi,%r12
+  800fd0:	49 89 d5             	mov    %rdx,%r13
+  800fd3:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fd6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fda:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fdf:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  800fe6:	00 00 00 
+  800fe9:	ff d0                	call   *%rax
+  800feb:	85 c0                	test   %eax,%eax
+  800fed:	78 1b                	js     80100a <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ff3:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800ff7:	48 85 c0             	test   %rax,%rax
+  800ffa:	74 1b                	je     801017 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800ffc:	4c 89 f1             	mov    %r14,%rcx
+  800fff:	4c 89 ea             	mov    %r13,%rdx
+  801002:	4c 89 e6             	mov    %r12,%rsi
+  801005:	48 89 df             	mov    %rbx,%rdi
+  801008:	ff d0                	call   *%rax
+
+    return res;
+}
+  80100a:	48 83 c4 10          	add    $0x10,%rsp
+  80100e:	5b                   	pop    %rbx
+  80100f:	41 5c                	pop    %r12
+  801011:	41 5d                	pop    %r13
+  801013:	41 5e                	pop    %r14
+  801015:	5d                   	pop    %rbp
+  801016:	c3                   	ret
+        return -E_NOT_SUPP;
+  801017:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80101c:	eb ec                	jmp    80100a <diff_snapshots+0x4f>
+
+000000000080101e <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80101e:	55                   	push   %rbp
+  80101f:	48 89 e5             	mov    %rsp,%rbp
+  801022:	41 55                	push   %r13
+  801024:	41 54                	push   %r12
+  801026:	53                   	push   %rbx
+  801027:	48 83 ec 18          	sub    $0x18,%rsp
+  80102b:	48 89 fb             	mov    %rdi,%rbx
+  80102e:	49 89 f4             	mov    %rsi,%r12
+  801031:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801034:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801038:	bf 66 00 00 00       	mov    $0x66,%edi
+  80103d:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  801044:	00 00 00 
+  801047:	ff d0                	call   *%rax
+  801049:	85 c0                	test   %eax,%eax
+  80104b:	78 18                	js     801065 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80104d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801051:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801055:	48 85 c0             	test   %rax,%rax
+  801058:	74 16                	je     801070 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80105a:	4c 89 ea             	mov    %r13,%rdx
+  80105d:	4c 89 e6             	mov    %r12,%rsi
+  801060:	48 89 df             	mov    %rbx,%rdi
+  801063:	ff d0                	call   *%rax
+
+    return res;
+}
+  801065:	48 83 c4 18          	add    $0x18,%rsp
+  801069:	5b                   	pop    %rbx
+  80106a:	41 5c                	pop    %r12
+  80106c:	41 5d                	pop    %r13
+  80106e:	5d                   	pop    %rbp
+  80106f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801070:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801075:	eb ee                	jmp    801065 <send_snapshot+0x47>
+
+0000000000801077 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801077:	55                   	push   %rbp
+  801078:	48 89 e5             	mov    %rsp,%rbp
+  80107b:	53                   	push   %rbx
+  80107c:	48 83 ec 18          	sub    $0x18,%rsp
+  801080:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801083:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801087:	bf 66 00 00 00       	mov    $0x66,%edi
+  80108c:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  801093:	00 00 00 
+  801096:	ff d0                	call   *%rax
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	78 12                	js     8010ae <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80109c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010a0:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8010a4:	48 85 c0             	test   %rax,%rax
+  8010a7:	74 0b                	je     8010b4 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8010a9:	48 89 df             	mov    %rbx,%rdi
+  8010ac:	ff d0                	call   *%rax
+
+    return res;
+}
+  8010ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b2:	c9                   	leave
+  8010b3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010b4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010b9:	eb f3                	jmp    8010ae <receive_snapshot+0x37>
+
+00000000008010bb <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8010bb:	55                   	push   %rbp
+  8010bc:	48 89 e5             	mov    %rsp,%rbp
+  8010bf:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010c7:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010cc:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+  8010d8:	85 c0                	test   %eax,%eax
+  8010da:	78 17                	js     8010f3 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010e0:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010e7:	48 85 d2             	test   %rdx,%rdx
+  8010ea:	74 09                	je     8010f5 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010f3:	c9                   	leave
+  8010f4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010f5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010fa:	eb f7                	jmp    8010f3 <free_space_bytes+0x38>
+
+00000000008010fc <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010fc:	55                   	push   %rbp
+  8010fd:	48 89 e5             	mov    %rsp,%rbp
+  801100:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801104:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801108:	bf 66 00 00 00       	mov    $0x66,%edi
+  80110d:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  801114:	00 00 00 
+  801117:	ff d0                	call   *%rax
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	78 17                	js     801134 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80111d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801121:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801128:	48 85 d2             	test   %rdx,%rdx
+  80112b:	74 09                	je     801136 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80112d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801132:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801134:	c9                   	leave
+  801135:	c3                   	ret
+        return -E_NOT_SUPP;
+  801136:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80113b:	eb f7                	jmp    801134 <busy_space_bytes+0x38>
+
+000000000080113d <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80113d:	55                   	push   %rbp
+  80113e:	48 89 e5             	mov    %rsp,%rbp
+  801141:	41 54                	push   %r12
+  801143:	53                   	push   %rbx
+  801144:	48 83 ec 10          	sub    $0x10,%rsp
+  801148:	89 fb                	mov    %edi,%ebx
+  80114a:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80114d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801151:	bf 66 00 00 00       	mov    $0x66,%edi
+  801156:	48 b8 53 07 80 00 00 	movabs $0x800753,%rax
+  80115d:	00 00 00 
+  801160:	ff d0                	call   *%rax
+  801162:	85 c0                	test   %eax,%eax
+  801164:	78 17                	js     80117d <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  801166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80116a:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801171:	48 85 c0             	test   %rax,%rax
+  801174:	74 10                	je     801186 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  801176:	4c 89 e6             	mov    %r12,%rsi
+  801179:	89 df                	mov    %ebx,%edi
+  80117b:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80117d:	48 83 c4 10          	add    $0x10,%rsp
+  801181:	5b                   	pop    %rbx
+  801182:	41 5c                	pop    %r12
+  801184:	5d                   	pop    %rbp
+  801185:	c3                   	ret
+        return -E_NOT_SUPP;
+  801186:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80118b:	eb f0                	jmp    80117d <snapshots_space+0x40>
+
+000000000080118d <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+  801191:	41 55                	push   %r13
+  801193:	41 54                	push   %r12
+  801195:	53                   	push   %rbx
+  801196:	48 83 ec 08          	sub    $0x8,%rsp
+  80119a:	41 89 fd             	mov    %edi,%r13d
+  80119d:	48 89 f3             	mov    %rsi,%rbx
+  8011a0:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011a3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011aa:	00 00 00 
+  8011ad:	83 38 00             	cmpl   $0x0,(%rax)
+  8011b0:	74 57                	je     801209 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8011b2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8011b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011bd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8011c4:	00 00 00 
+  8011c7:	44 89 ee             	mov    %r13d,%esi
+  8011ca:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011d1:	00 00 00 
+  8011d4:	8b 38                	mov    (%rax),%edi
+  8011d6:	48 b8 82 35 80 00 00 	movabs $0x803582,%rax
+  8011dd:	00 00 00 
+  8011e0:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e7:	4c 89 e2             	mov    %r12,%rdx
+  8011ea:	48 89 de             	mov    %rbx,%rsi
+  8011ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011f2:	48 b8 6a 35 80 00 00 	movabs $0x80356a,%rax
+  8011f9:	00 00 00 
+  8011fc:	ff d0                	call   *%rax
+}
+  8011fe:	48 83 c4 08          	add    $0x8,%rsp
+  801202:	5b                   	pop    %rbx
+  801203:	41 5c                	pop    %r12
+  801205:	41 5d                	pop    %r13
+  801207:	5d                   	pop    %rbp
+  801208:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801209:	bf 03 00 00 00       	mov    $0x3,%edi
+  80120e:	48 b8 40 36 80 00 00 	movabs $0x803640,%rax
+  801215:	00 00 00 
+  801218:	ff d0                	call   *%rax
+  80121a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801221:	00 00 
+  801223:	eb 8d                	jmp    8011b2 <fsipc_region+0x25>
+
+0000000000801225 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80122d:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801234:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  801235:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801239:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  801240:	00 00 00 
+  801243:	ff d0                	call   *%rax
+}
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+
+0000000000801247 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  801247:	85 ff                	test   %edi,%edi
+  801249:	78 6d                	js     8012b8 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80124b:	55                   	push   %rbp
+  80124c:	48 89 e5             	mov    %rsp,%rbp
+  80124f:	41 54                	push   %r12
+  801251:	53                   	push   %rbx
+  801252:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  801255:	48 85 f6             	test   %rsi,%rsi
+  801258:	74 57                	je     8012b1 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80125a:	89 f8                	mov    %edi,%eax
+  80125c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801263:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  801265:	be 00 00 00 00       	mov    $0x0,%esi
+  80126a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80126f:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801276:	00 00 00 
+  801279:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80127b:	85 c0                	test   %eax,%eax
+  80127d:	78 2d                	js     8012ac <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80127f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801286:	00 00 00 
+  801289:	49 63 14 24          	movslq (%r12),%rdx
+  80128d:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  801294:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  801299:	48 89 df             	mov    %rbx,%rdi
+  80129c:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  8012a3:	00 00 00 
+  8012a6:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8012a8:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8012ac:	5b                   	pop    %rbx
+  8012ad:	41 5c                	pop    %r12
+  8012af:	5d                   	pop    %rbp
+  8012b0:	c3                   	ret
+        return -E_INVAL;
+  8012b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012b6:	eb f4                	jmp    8012ac <devfile_df_snapshots+0x65>
+  8012b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8012bd:	c3                   	ret
+
+00000000008012be <devfile_df_busy>:
+devfile_df_busy() {
+  8012be:	55                   	push   %rbp
+  8012bf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8012c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c7:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012cc:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8012d3:	00 00 00 
+  8012d6:	ff d0                	call   *%rax
+}
+  8012d8:	5d                   	pop    %rbp
+  8012d9:	c3                   	ret
+
+00000000008012da <devfile_df_free>:
+devfile_df_free() {
+  8012da:	55                   	push   %rbp
+  8012db:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012de:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012e8:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8012ef:	00 00 00 
+  8012f2:	ff d0                	call   *%rax
+}
+  8012f4:	5d                   	pop    %rbp
+  8012f5:	c3                   	ret
+
+00000000008012f6 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012f6:	55                   	push   %rbp
+  8012f7:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ff:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801304:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80130b:	00 00 00 
+  80130e:	ff d0                	call   *%rax
+}
+  801310:	5d                   	pop    %rbp
+  801311:	c3                   	ret
+
+0000000000801312 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  801312:	55                   	push   %rbp
+  801313:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  801316:	be 00 00 00 00       	mov    $0x0,%esi
+  80131b:	bf 09 00 00 00       	mov    $0x9,%edi
+  801320:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801327:	00 00 00 
+  80132a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801333:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801336:	5d                   	pop    %rbp
+  801337:	c3                   	ret
+
+0000000000801338 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801338:	55                   	push   %rbp
+  801339:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80133c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801343:	00 00 00 
+  801346:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801349:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80134b:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	bf 02 00 00 00       	mov    $0x2,%edi
+  801358:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80135f:	00 00 00 
+  801362:	ff d0                	call   *%rax
+}
+  801364:	5d                   	pop    %rbp
+  801365:	c3                   	ret
+
+0000000000801366 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80136a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80136d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801374:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801376:	be 00 00 00 00       	mov    $0x0,%esi
+  80137b:	bf 06 00 00 00       	mov    $0x6,%edi
+  801380:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801387:	00 00 00 
+  80138a:	ff d0                	call   *%rax
+}
+  80138c:	5d                   	pop    %rbp
+  80138d:	c3                   	ret
+
+000000000080138e <devfile_write>:
+    if (!fd || !buf) {
+  80138e:	48 85 ff             	test   %rdi,%rdi
+  801391:	0f 84 c1 00 00 00    	je     801458 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801397:	55                   	push   %rbp
+  801398:	48 89 e5             	mov    %rsp,%rbp
+  80139b:	41 57                	push   %r15
+  80139d:	41 56                	push   %r14
+  80139f:	41 55                	push   %r13
+  8013a1:	41 54                	push   %r12
+  8013a3:	53                   	push   %rbx
+  8013a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8013a8:	49 89 ff             	mov    %rdi,%r15
+  8013ab:	49 89 f5             	mov    %rsi,%r13
+  8013ae:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8013b1:	48 85 f6             	test   %rsi,%rsi
+  8013b4:	0f 84 95 00 00 00    	je     80144f <devfile_write+0xc1>
+    while (n) {
+  8013ba:	48 85 d2             	test   %rdx,%rdx
+  8013bd:	0f 84 83 00 00 00    	je     801446 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8013c3:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013ca:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013d1:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013d4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013d9:	49 39 dc             	cmp    %rbx,%r12
+  8013dc:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013e0:	48 89 da             	mov    %rbx,%rdx
+  8013e3:	4c 89 ee             	mov    %r13,%rsi
+  8013e6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013ed:	00 00 00 
+  8013f0:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  8013f7:	00 00 00 
+  8013fa:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013fc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801400:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  801403:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  801407:	be 00 00 00 00       	mov    $0x0,%esi
+  80140c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801411:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801418:	00 00 00 
+  80141b:	ff d0                	call   *%rax
+        if (write < 0) {
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	78 21                	js     801442 <devfile_write+0xb4>
+        buf += write;
+  801421:	48 63 d0             	movslq %eax,%rdx
+  801424:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  801427:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80142a:	49 29 d4             	sub    %rdx,%r12
+  80142d:	75 a5                	jne    8013d4 <devfile_write+0x46>
+    return totalWrite;
+  80142f:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  801433:	48 83 c4 18          	add    $0x18,%rsp
+  801437:	5b                   	pop    %rbx
+  801438:	41 5c                	pop    %r12
+  80143a:	41 5d                	pop    %r13
+  80143c:	41 5e                	pop    %r14
+  80143e:	41 5f                	pop    %r15
+  801440:	5d                   	pop    %rbp
+  801441:	c3                   	ret
+            return write;
+  801442:	48 98                	cltq
+  801444:	eb ed                	jmp    801433 <devfile_write+0xa5>
+    int totalWrite = 0;
+  801446:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80144d:	eb e0                	jmp    80142f <devfile_write+0xa1>
+        return -E_INVAL;
+  80144f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801456:	eb db                	jmp    801433 <devfile_write+0xa5>
+  801458:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80145f:	c3                   	ret
+
+0000000000801460 <devfile_read>:
+    if (!fd || !buf) {
+  801460:	48 85 ff             	test   %rdi,%rdi
+  801463:	0f 84 c0 00 00 00    	je     801529 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	41 57                	push   %r15
+  80146f:	41 56                	push   %r14
+  801471:	41 55                	push   %r13
+  801473:	41 54                	push   %r12
+  801475:	53                   	push   %rbx
+  801476:	48 83 ec 18          	sub    $0x18,%rsp
+  80147a:	49 89 ff             	mov    %rdi,%r15
+  80147d:	49 89 f5             	mov    %rsi,%r13
+  801480:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801483:	48 85 f6             	test   %rsi,%rsi
+  801486:	0f 84 96 00 00 00    	je     801522 <devfile_read+0xc2>
+    while (n) {
+  80148c:	48 85 d2             	test   %rdx,%rdx
+  80148f:	0f 84 87 00 00 00    	je     80151c <devfile_read+0xbc>
+    size_t totalRead = 0;
+  801495:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80149c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80149d:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8014a4:	00 00 00 
+  8014a7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8014ab:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8014ae:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8014b3:	49 39 c4             	cmp    %rax,%r12
+  8014b6:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8014ba:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8014be:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014c8:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8014cf:	00 00 00 
+  8014d2:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014d4:	85 c0                	test   %eax,%eax
+  8014d6:	7e 37                	jle    80150f <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014d8:	48 63 d8             	movslq %eax,%rbx
+  8014db:	48 89 da             	mov    %rbx,%rdx
+  8014de:	4c 89 f6             	mov    %r14,%rsi
+  8014e1:	4c 89 ef             	mov    %r13,%rdi
+  8014e4:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  8014eb:	00 00 00 
+  8014ee:	ff d0                	call   *%rax
+        buf += read;
+  8014f0:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014f3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014f7:	49 29 dc             	sub    %rbx,%r12
+  8014fa:	75 ab                	jne    8014a7 <devfile_read+0x47>
+  return totalRead;
+  8014fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801500:	48 83 c4 18          	add    $0x18,%rsp
+  801504:	5b                   	pop    %rbx
+  801505:	41 5c                	pop    %r12
+  801507:	41 5d                	pop    %r13
+  801509:	41 5e                	pop    %r14
+  80150b:	41 5f                	pop    %r15
+  80150d:	5d                   	pop    %rbp
+  80150e:	c3                   	ret
+            return read ? read : totalRead;
+  80150f:	48 63 d0             	movslq %eax,%rdx
+  801512:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801516:	48 0f 45 c2          	cmovne %rdx,%rax
+  80151a:	eb e4                	jmp    801500 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80151c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801520:	eb da                	jmp    8014fc <devfile_read+0x9c>
+        return E_INVAL;
+  801522:	b8 03 00 00 00       	mov    $0x3,%eax
+  801527:	eb d7                	jmp    801500 <devfile_read+0xa0>
+  801529:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80152e:	c3                   	ret
+
+000000000080152f <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80152f:	48 85 ff             	test   %rdi,%rdi
+  801532:	74 5f                	je     801593 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	53                   	push   %rbx
+  801539:	48 83 ec 08          	sub    $0x8,%rsp
+  80153d:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801540:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  801547:	00 00 00 
+  80154a:	ff d0                	call   *%rax
+  80154c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801552:	77 45                	ja     801599 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  801554:	48 89 de             	mov    %rbx,%rsi
+  801557:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80155e:	00 00 00 
+  801561:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  801568:	00 00 00 
+  80156b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80156d:	be 00 00 00 00       	mov    $0x0,%esi
+  801572:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801577:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80157e:	00 00 00 
+  801581:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801583:	85 c0                	test   %eax,%eax
+  801585:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80158d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+        return -E_INVAL;
+  801593:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801598:	c3                   	ret
+        return -E_INVAL;
+  801599:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159e:	eb ed                	jmp    80158d <devfile_receive_snapshot+0x5e>
+
+00000000008015a0 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8015a0:	55                   	push   %rbp
+  8015a1:	48 89 e5             	mov    %rsp,%rbp
+  8015a4:	41 55                	push   %r13
+  8015a6:	41 54                	push   %r12
+  8015a8:	53                   	push   %rbx
+  8015a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ad:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8015b0:	48 85 f6             	test   %rsi,%rsi
+  8015b3:	0f 94 c0             	sete   %al
+  8015b6:	48 85 d2             	test   %rdx,%rdx
+  8015b9:	0f 94 c2             	sete   %dl
+  8015bc:	08 d0                	or     %dl,%al
+  8015be:	0f 85 ad 00 00 00    	jne    801671 <devfile_send_snapshot+0xd1>
+  8015c4:	48 89 fb             	mov    %rdi,%rbx
+  8015c7:	49 89 f4             	mov    %rsi,%r12
+  8015ca:	48 85 ff             	test   %rdi,%rdi
+  8015cd:	0f 84 9e 00 00 00    	je     801671 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015d3:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8015da:	00 00 00 
+  8015dd:	ff d0                	call   *%rax
+  8015df:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015e5:	0f 87 8d 00 00 00    	ja     801678 <devfile_send_snapshot+0xd8>
+  8015eb:	4c 89 e7             	mov    %r12,%rdi
+  8015ee:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8015f5:	00 00 00 
+  8015f8:	ff d0                	call   *%rax
+  8015fa:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  801600:	77 7d                	ja     80167f <devfile_send_snapshot+0xdf>
+  801602:	4c 89 ef             	mov    %r13,%rdi
+  801605:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  80160c:	00 00 00 
+  80160f:	ff d0                	call   *%rax
+  801611:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801617:	77 6d                	ja     801686 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  801619:	48 89 de             	mov    %rbx,%rsi
+  80161c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801623:	00 00 00 
+  801626:	48 bb 80 2f 80 00 00 	movabs $0x802f80,%rbx
+  80162d:	00 00 00 
+  801630:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  801632:	4c 89 e6             	mov    %r12,%rsi
+  801635:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80163c:	00 00 00 
+  80163f:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801641:	4c 89 ee             	mov    %r13,%rsi
+  801644:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80164b:	00 00 00 
+  80164e:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801650:	be 00 00 00 00       	mov    $0x0,%esi
+  801655:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80165a:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801661:	00 00 00 
+  801664:	ff d0                	call   *%rax
+}
+  801666:	48 83 c4 08          	add    $0x8,%rsp
+  80166a:	5b                   	pop    %rbx
+  80166b:	41 5c                	pop    %r12
+  80166d:	41 5d                	pop    %r13
+  80166f:	5d                   	pop    %rbp
+  801670:	c3                   	ret
+        return -E_INVAL;
+  801671:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801676:	eb ee                	jmp    801666 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801678:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167d:	eb e7                	jmp    801666 <devfile_send_snapshot+0xc6>
+  80167f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801684:	eb e0                	jmp    801666 <devfile_send_snapshot+0xc6>
+  801686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168b:	eb d9                	jmp    801666 <devfile_send_snapshot+0xc6>
+
+000000000080168d <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80168d:	48 85 ff             	test   %rdi,%rdi
+  801690:	0f 84 41 01 00 00    	je     8017d7 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801696:	55                   	push   %rbp
+  801697:	48 89 e5             	mov    %rsp,%rbp
+  80169a:	41 57                	push   %r15
+  80169c:	41 56                	push   %r14
+  80169e:	41 55                	push   %r13
+  8016a0:	41 54                	push   %r12
+  8016a2:	53                   	push   %rbx
+  8016a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a7:	49 89 fc             	mov    %rdi,%r12
+  8016aa:	49 89 f5             	mov    %rsi,%r13
+  8016ad:	48 89 d3             	mov    %rdx,%rbx
+  8016b0:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8016b3:	48 85 f6             	test   %rsi,%rsi
+  8016b6:	0f 84 ff 00 00 00    	je     8017bb <devfile_diff_snapshots+0x12e>
+  8016bc:	48 85 d2             	test   %rdx,%rdx
+  8016bf:	0f 84 fd 00 00 00    	je     8017c2 <devfile_diff_snapshots+0x135>
+  8016c5:	48 85 c9             	test   %rcx,%rcx
+  8016c8:	0f 84 f4 00 00 00    	je     8017c2 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016ce:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8016d5:	00 00 00 
+  8016d8:	ff d0                	call   *%rax
+  8016da:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016e0:	0f 87 e3 00 00 00    	ja     8017c9 <devfile_diff_snapshots+0x13c>
+  8016e6:	4c 89 ef             	mov    %r13,%rdi
+  8016e9:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+  8016f5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016fb:	0f 87 cf 00 00 00    	ja     8017d0 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  801701:	4c 89 e6             	mov    %r12,%rsi
+  801704:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80170b:	00 00 00 
+  80170e:	4c 89 e7             	mov    %r12,%rdi
+  801711:	49 bf 80 2f 80 00 00 	movabs $0x802f80,%r15
+  801718:	00 00 00 
+  80171b:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80171e:	4c 89 ee             	mov    %r13,%rsi
+  801721:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801728:	00 
+  801729:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80172c:	48 8b 03             	mov    (%rbx),%rax
+  80172f:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  801736:	00 
+  801737:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80173b:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  801742:	00 
+  801743:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801747:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80174e:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  80174f:	be 00 00 00 00       	mov    $0x0,%esi
+  801754:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801759:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801760:	00 00 00 
+  801763:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 43                	js     8017ac <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801769:	49 8b 04 24          	mov    (%r12),%rax
+  80176d:	48 89 03             	mov    %rax,(%rbx)
+  801770:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801775:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801779:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80177e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  801782:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  801787:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80178b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80178f:	48 c1 e2 03          	shl    $0x3,%rdx
+  801793:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801798:	4c 89 f7             	mov    %r14,%rdi
+  80179b:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8017a7:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8017ac:	48 83 c4 08          	add    $0x8,%rsp
+  8017b0:	5b                   	pop    %rbx
+  8017b1:	41 5c                	pop    %r12
+  8017b3:	41 5d                	pop    %r13
+  8017b5:	41 5e                	pop    %r14
+  8017b7:	41 5f                	pop    %r15
+  8017b9:	5d                   	pop    %rbp
+  8017ba:	c3                   	ret
+        return -E_INVAL;
+  8017bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c0:	eb ea                	jmp    8017ac <devfile_diff_snapshots+0x11f>
+  8017c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c7:	eb e3                	jmp    8017ac <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ce:	eb dc                	jmp    8017ac <devfile_diff_snapshots+0x11f>
+  8017d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d5:	eb d5                	jmp    8017ac <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017dc:	c3                   	ret
+
+00000000008017dd <devfile_delete_snapshot>:
+    if (!name) {
+  8017dd:	48 85 ff             	test   %rdi,%rdi
+  8017e0:	74 5f                	je     801841 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+  8017e6:	53                   	push   %rbx
+  8017e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017eb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017ee:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+  8017fa:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801800:	77 45                	ja     801847 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  801802:	48 89 de             	mov    %rbx,%rsi
+  801805:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80180c:	00 00 00 
+  80180f:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  801816:	00 00 00 
+  801819:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80181b:	be 00 00 00 00       	mov    $0x0,%esi
+  801820:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801825:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80182c:	00 00 00 
+  80182f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801831:	85 c0                	test   %eax,%eax
+  801833:	ba 00 00 00 00       	mov    $0x0,%edx
+  801838:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80183b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80183f:	c9                   	leave
+  801840:	c3                   	ret
+        return -E_INVAL;
+  801841:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801846:	c3                   	ret
+        return -E_INVAL;
+  801847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184c:	eb ed                	jmp    80183b <devfile_delete_snapshot+0x5e>
+
+000000000080184e <devfile_accept_snapshot>:
+    if (!name) {
+  80184e:	48 85 ff             	test   %rdi,%rdi
+  801851:	74 5f                	je     8018b2 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  801853:	55                   	push   %rbp
+  801854:	48 89 e5             	mov    %rsp,%rbp
+  801857:	53                   	push   %rbx
+  801858:	48 83 ec 08          	sub    $0x8,%rsp
+  80185c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80185f:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  801866:	00 00 00 
+  801869:	ff d0                	call   *%rax
+  80186b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801871:	77 45                	ja     8018b8 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  801873:	48 89 de             	mov    %rbx,%rsi
+  801876:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80187d:	00 00 00 
+  801880:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  801887:	00 00 00 
+  80188a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80188c:	be 00 00 00 00       	mov    $0x0,%esi
+  801891:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801896:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80189d:	00 00 00 
+  8018a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b0:	c9                   	leave
+  8018b1:	c3                   	ret
+        return -E_INVAL;
+  8018b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018b7:	c3                   	ret
+        return -E_INVAL;
+  8018b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018bd:	eb ed                	jmp    8018ac <devfile_accept_snapshot+0x5e>
+
+00000000008018bf <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8018bf:	48 85 ff             	test   %rdi,%rdi
+  8018c2:	0f 84 9f 00 00 00    	je     801967 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018c8:	55                   	push   %rbp
+  8018c9:	48 89 e5             	mov    %rsp,%rbp
+  8018cc:	41 54                	push   %r12
+  8018ce:	53                   	push   %rbx
+  8018cf:	48 89 fb             	mov    %rdi,%rbx
+  8018d2:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018d5:	48 85 f6             	test   %rsi,%rsi
+  8018d8:	74 78                	je     801952 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018da:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8018e1:	00 00 00 
+  8018e4:	ff d0                	call   *%rax
+  8018e6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018ec:	77 6b                	ja     801959 <devfile_create_snapshot+0x9a>
+  8018ee:	4c 89 e7             	mov    %r12,%rdi
+  8018f1:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+  8018fd:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801903:	77 5b                	ja     801960 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  801905:	48 89 de             	mov    %rbx,%rsi
+  801908:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80190f:	00 00 00 
+  801912:	48 bb 80 2f 80 00 00 	movabs $0x802f80,%rbx
+  801919:	00 00 00 
+  80191c:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80191e:	4c 89 e6             	mov    %r12,%rsi
+  801921:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801928:	00 00 00 
+  80192b:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80192d:	be 00 00 00 00       	mov    $0x0,%esi
+  801932:	bf 08 00 00 00       	mov    $0x8,%edi
+  801937:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  80193e:	00 00 00 
+  801941:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801943:	85 c0                	test   %eax,%eax
+  801945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80194d:	5b                   	pop    %rbx
+  80194e:	41 5c                	pop    %r12
+  801950:	5d                   	pop    %rbp
+  801951:	c3                   	ret
+        return -E_INVAL;
+  801952:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801957:	eb f4                	jmp    80194d <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801959:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195e:	eb ed                	jmp    80194d <devfile_create_snapshot+0x8e>
+  801960:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801965:	eb e6                	jmp    80194d <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801967:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80196c:	c3                   	ret
+
+000000000080196d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80196d:	55                   	push   %rbp
+  80196e:	48 89 e5             	mov    %rsp,%rbp
+  801971:	41 54                	push   %r12
+  801973:	53                   	push   %rbx
+  801974:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801977:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80197a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801981:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801983:	be 00 00 00 00       	mov    $0x0,%esi
+  801988:	bf 05 00 00 00       	mov    $0x5,%edi
+  80198d:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801994:	00 00 00 
+  801997:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 3d                	js     8019da <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80199d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8019a4:	00 00 00 
+  8019a7:	4c 89 e6             	mov    %r12,%rsi
+  8019aa:	48 89 df             	mov    %rbx,%rdi
+  8019ad:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  8019b4:	00 00 00 
+  8019b7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8019b9:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8019c0:	00 
+  8019c1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019c7:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019ce:	00 
+  8019cf:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019da:	5b                   	pop    %rbx
+  8019db:	41 5c                	pop    %r12
+  8019dd:	5d                   	pop    %rbp
+  8019de:	c3                   	ret
+
+00000000008019df <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019df:	55                   	push   %rbp
+  8019e0:	48 89 e5             	mov    %rsp,%rbp
+  8019e3:	41 57                	push   %r15
+  8019e5:	41 56                	push   %r14
+  8019e7:	41 55                	push   %r13
+  8019e9:	41 54                	push   %r12
+  8019eb:	53                   	push   %rbx
+  8019ec:	48 83 ec 38          	sub    $0x38,%rsp
+  8019f0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019f4:	49 89 f5             	mov    %rsi,%r13
+  8019f7:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019fa:	48 89 f0             	mov    %rsi,%rax
+  8019fd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a02:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  801a06:	75 4f                	jne    801a57 <devfile_readmap+0x78>
+  801a08:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a0c:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a12:	75 1f                	jne    801a33 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  801a14:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a18:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801a1c:	49 be c7 21 80 00 00 	movabs $0x8021c7,%r14
+  801a23:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a26:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a2d:	0f 87 9d 00 00 00    	ja     801ad0 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a33:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a37:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a3b:	4d 85 ff             	test   %r15,%r15
+  801a3e:	0f 85 cf 00 00 00    	jne    801b13 <devfile_readmap+0x134>
+  801a44:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a48:	48 83 c4 38          	add    $0x38,%rsp
+  801a4c:	5b                   	pop    %rbx
+  801a4d:	41 5c                	pop    %r12
+  801a4f:	41 5d                	pop    %r13
+  801a51:	41 5e                	pop    %r14
+  801a53:	41 5f                	pop    %r15
+  801a55:	5d                   	pop    %rbp
+  801a56:	c3                   	ret
+    size_t totalRead = 0;
+  801a57:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a5e:	00 
+  801a5f:	eb da                	jmp    801a3b <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a65:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a68:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a6f:	00 00 00 
+  801a72:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a78:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a7c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a80:	4c 89 ee             	mov    %r13,%rsi
+  801a83:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a88:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	7e a3                	jle    801a3b <devfile_readmap+0x5c>
+  801a98:	48 98                	cltq
+  801a9a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a9e:	72 9b                	jb     801a3b <devfile_readmap+0x5c>
+        buf += read;
+  801aa0:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801aa3:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801aa6:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801aaa:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801ab1:	75 88                	jne    801a3b <devfile_readmap+0x5c>
+  801ab3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ab7:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801abd:	0f 85 78 ff ff ff    	jne    801a3b <devfile_readmap+0x5c>
+  801ac3:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aca:	0f 86 6b ff ff ff    	jbe    801a3b <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801ad0:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801ad6:	4d 39 e7             	cmp    %r12,%r15
+  801ad9:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801add:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801ae4:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ae8:	0f 84 73 ff ff ff    	je     801a61 <devfile_readmap+0x82>
+  801aee:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801af2:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801af7:	41 ff d6             	call   *%r14
+  801afa:	a8 40                	test   $0x40,%al
+  801afc:	0f 85 39 ff ff ff    	jne    801a3b <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801b02:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b09:	4c 39 e3             	cmp    %r12,%rbx
+  801b0c:	72 e4                	jb     801af2 <devfile_readmap+0x113>
+  801b0e:	e9 4e ff ff ff       	jmp    801a61 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801b13:	4c 89 fa             	mov    %r15,%rdx
+  801b16:	4c 89 ee             	mov    %r13,%rsi
+  801b19:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b1d:	48 b8 60 14 80 00 00 	movabs $0x801460,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b29:	48 85 c0             	test   %rax,%rax
+  801b2c:	78 0c                	js     801b3a <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b2e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b32:	48 01 f0             	add    %rsi,%rax
+  801b35:	e9 0e ff ff ff       	jmp    801a48 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b3a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b3e:	48 85 f6             	test   %rsi,%rsi
+  801b41:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b45:	e9 fe fe ff ff       	jmp    801a48 <devfile_readmap+0x69>
+
+0000000000801b4a <open>:
+open(const char *path, int mode) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 55                	push   %r13
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	48 83 ec 18          	sub    $0x18,%rsp
+  801b57:	49 89 fc             	mov    %rdi,%r12
+  801b5a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b5d:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+  801b69:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b6f:	0f 87 8a 00 00 00    	ja     801bff <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b75:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b79:	48 b8 a8 06 80 00 00 	movabs $0x8006a8,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	89 c3                	mov    %eax,%ebx
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 50                	js     801bdb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b8b:	4c 89 e6             	mov    %r12,%rsi
+  801b8e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b95:	00 00 00 
+  801b98:	48 89 df             	mov    %rbx,%rdi
+  801b9b:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  801ba2:	00 00 00 
+  801ba5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801ba7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bae:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801bb2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801bb7:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	89 c3                	mov    %eax,%ebx
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	78 1f                	js     801be8 <open+0x9e>
+    return fd2num(fd);
+  801bc9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bcd:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+  801bd9:	89 c3                	mov    %eax,%ebx
+}
+  801bdb:	89 d8                	mov    %ebx,%eax
+  801bdd:	48 83 c4 18          	add    $0x18,%rsp
+  801be1:	5b                   	pop    %rbx
+  801be2:	41 5c                	pop    %r12
+  801be4:	41 5d                	pop    %r13
+  801be6:	5d                   	pop    %rbp
+  801be7:	c3                   	ret
+        fd_close(fd, 0);
+  801be8:	be 00 00 00 00       	mov    $0x0,%esi
+  801bed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bf1:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+        return res;
+  801bfd:	eb dc                	jmp    801bdb <open+0x91>
+        return -E_BAD_PATH;
+  801bff:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801c04:	eb d5                	jmp    801bdb <open+0x91>
+
+0000000000801c06 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801c06:	55                   	push   %rbp
+  801c07:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801c0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0f:	bf 13 00 00 00       	mov    $0x13,%edi
+  801c14:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+}
+  801c20:	5d                   	pop    %rbp
+  801c21:	c3                   	ret
+
+0000000000801c22 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	41 54                	push   %r12
+  801c28:	53                   	push   %rbx
+  801c29:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c2c:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801c33:	00 00 00 
+  801c36:	ff d0                	call   *%rax
+  801c38:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c3b:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  801c42:	00 00 00 
+  801c45:	48 89 df             	mov    %rbx,%rdi
+  801c48:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  801c4f:	00 00 00 
+  801c52:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c54:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c59:	41 2b 04 24          	sub    (%r12),%eax
+  801c5d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c6a:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c6d:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c74:	00 00 00 
+  801c77:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	5b                   	pop    %rbx
+  801c84:	41 5c                	pop    %r12
+  801c86:	5d                   	pop    %rbp
+  801c87:	c3                   	ret
+
+0000000000801c88 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c88:	55                   	push   %rbp
+  801c89:	48 89 e5             	mov    %rsp,%rbp
+  801c8c:	41 54                	push   %r12
+  801c8e:	53                   	push   %rbx
+  801c8f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c92:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c97:	48 89 fe             	mov    %rdi,%rsi
+  801c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9f:	49 bc 76 03 80 00 00 	movabs $0x800376,%r12
+  801ca6:	00 00 00 
+  801ca9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801cac:	48 89 df             	mov    %rbx,%rdi
+  801caf:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+  801cbb:	48 89 c6             	mov    %rax,%rsi
+  801cbe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc8:	41 ff d4             	call   *%r12
+}
+  801ccb:	5b                   	pop    %rbx
+  801ccc:	41 5c                	pop    %r12
+  801cce:	5d                   	pop    %rbp
+  801ccf:	c3                   	ret
+
+0000000000801cd0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	41 57                	push   %r15
+  801cd6:	41 56                	push   %r14
+  801cd8:	41 55                	push   %r13
+  801cda:	41 54                	push   %r12
+  801cdc:	53                   	push   %rbx
+  801cdd:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce1:	49 89 fc             	mov    %rdi,%r12
+  801ce4:	49 89 f5             	mov    %rsi,%r13
+  801ce7:	49 89 d7             	mov    %rdx,%r15
+  801cea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cee:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cfa:	4d 85 ff             	test   %r15,%r15
+  801cfd:	0f 84 af 00 00 00    	je     801db2 <devpipe_write+0xe2>
+  801d03:	48 89 c3             	mov    %rax,%rbx
+  801d06:	4c 89 f8             	mov    %r15,%rax
+  801d09:	4d 89 ef             	mov    %r13,%r15
+  801d0c:	4c 01 e8             	add    %r13,%rax
+  801d0f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d13:	49 bd 7e 02 80 00 00 	movabs $0x80027e,%r13
+  801d1a:	00 00 00 
+            sys_yield();
+  801d1d:	49 be 1b 02 80 00 00 	movabs $0x80021b,%r14
+  801d24:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d27:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d2a:	48 63 ce             	movslq %esi,%rcx
+  801d2d:	48 63 03             	movslq (%rbx),%rax
+  801d30:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d36:	48 39 c1             	cmp    %rax,%rcx
+  801d39:	72 2e                	jb     801d69 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d3b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d40:	48 89 da             	mov    %rbx,%rdx
+  801d43:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d48:	4c 89 e7             	mov    %r12,%rdi
+  801d4b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	74 66                	je     801db8 <devpipe_write+0xe8>
+            sys_yield();
+  801d52:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d55:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d58:	48 63 ce             	movslq %esi,%rcx
+  801d5b:	48 63 03             	movslq (%rbx),%rax
+  801d5e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d64:	48 39 c1             	cmp    %rax,%rcx
+  801d67:	73 d2                	jae    801d3b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d69:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d6d:	48 89 ca             	mov    %rcx,%rdx
+  801d70:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d74:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d7b:	08 10 20 
+  801d7e:	48 f7 e2             	mul    %rdx
+  801d81:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d85:	48 89 d0             	mov    %rdx,%rax
+  801d88:	48 c1 e0 09          	shl    $0x9,%rax
+  801d8c:	48 29 d0             	sub    %rdx,%rax
+  801d8f:	48 c1 e0 03          	shl    $0x3,%rax
+  801d93:	48 29 c1             	sub    %rax,%rcx
+  801d96:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d9b:	83 c6 01             	add    $0x1,%esi
+  801d9e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801da1:	49 83 c7 01          	add    $0x1,%r15
+  801da5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da9:	49 39 c7             	cmp    %rax,%r15
+  801dac:	0f 85 75 ff ff ff    	jne    801d27 <devpipe_write+0x57>
+    return n;
+  801db2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801db6:	eb 05                	jmp    801dbd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dbd:	48 83 c4 18          	add    $0x18,%rsp
+  801dc1:	5b                   	pop    %rbx
+  801dc2:	41 5c                	pop    %r12
+  801dc4:	41 5d                	pop    %r13
+  801dc6:	41 5e                	pop    %r14
+  801dc8:	41 5f                	pop    %r15
+  801dca:	5d                   	pop    %rbp
+  801dcb:	c3                   	ret
+
+0000000000801dcc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801dcc:	55                   	push   %rbp
+  801dcd:	48 89 e5             	mov    %rsp,%rbp
+  801dd0:	41 57                	push   %r15
+  801dd2:	41 56                	push   %r14
+  801dd4:	41 55                	push   %r13
+  801dd6:	41 54                	push   %r12
+  801dd8:	53                   	push   %rbx
+  801dd9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ddd:	49 89 fc             	mov    %rdi,%r12
+  801de0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801de4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801de8:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+  801df4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801df7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dfd:	49 bd 7e 02 80 00 00 	movabs $0x80027e,%r13
+  801e04:	00 00 00 
+            sys_yield();
+  801e07:	49 be 1b 02 80 00 00 	movabs $0x80021b,%r14
+  801e0e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801e11:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e16:	74 7d                	je     801e95 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e18:	8b 03                	mov    (%rbx),%eax
+  801e1a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e1d:	75 26                	jne    801e45 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801e1f:	4d 85 ff             	test   %r15,%r15
+  801e22:	75 77                	jne    801e9b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e24:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e29:	48 89 da             	mov    %rbx,%rdx
+  801e2c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e31:	4c 89 e7             	mov    %r12,%rdi
+  801e34:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	74 72                	je     801ead <devpipe_read+0xe1>
+            sys_yield();
+  801e3b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e3e:	8b 03                	mov    (%rbx),%eax
+  801e40:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e43:	74 df                	je     801e24 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e45:	48 63 c8             	movslq %eax,%rcx
+  801e48:	48 89 ca             	mov    %rcx,%rdx
+  801e4b:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e4f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e56:	08 10 20 
+  801e59:	48 89 d0             	mov    %rdx,%rax
+  801e5c:	48 f7 e6             	mul    %rsi
+  801e5f:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e63:	48 89 d0             	mov    %rdx,%rax
+  801e66:	48 c1 e0 09          	shl    $0x9,%rax
+  801e6a:	48 29 d0             	sub    %rdx,%rax
+  801e6d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e74:	00 
+  801e75:	48 89 c8             	mov    %rcx,%rax
+  801e78:	48 29 d0             	sub    %rdx,%rax
+  801e7b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e80:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e84:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e88:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e8b:	49 83 c7 01          	add    $0x1,%r15
+  801e8f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e93:	75 83                	jne    801e18 <devpipe_read+0x4c>
+    return n;
+  801e95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e99:	eb 03                	jmp    801e9e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e9b:	4c 89 f8             	mov    %r15,%rax
+}
+  801e9e:	48 83 c4 18          	add    $0x18,%rsp
+  801ea2:	5b                   	pop    %rbx
+  801ea3:	41 5c                	pop    %r12
+  801ea5:	41 5d                	pop    %r13
+  801ea7:	41 5e                	pop    %r14
+  801ea9:	41 5f                	pop    %r15
+  801eab:	5d                   	pop    %rbp
+  801eac:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb2:	eb ea                	jmp    801e9e <devpipe_read+0xd2>
+
+0000000000801eb4 <pipe>:
+pipe(int pfd[2]) {
+  801eb4:	55                   	push   %rbp
+  801eb5:	48 89 e5             	mov    %rsp,%rbp
+  801eb8:	41 55                	push   %r13
+  801eba:	41 54                	push   %r12
+  801ebc:	53                   	push   %rbx
+  801ebd:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ec4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ec8:	48 b8 a8 06 80 00 00 	movabs $0x8006a8,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	89 c3                	mov    %eax,%ebx
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	0f 88 a0 01 00 00    	js     80207e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801ede:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ee3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ee8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801eec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef1:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  801ef8:	00 00 00 
+  801efb:	ff d0                	call   *%rax
+  801efd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	0f 88 77 01 00 00    	js     80207e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f07:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801f0b:	48 b8 a8 06 80 00 00 	movabs $0x8006a8,%rax
+  801f12:	00 00 00 
+  801f15:	ff d0                	call   *%rax
+  801f17:	89 c3                	mov    %eax,%ebx
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	0f 88 43 01 00 00    	js     802064 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801f21:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f2b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f34:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	0f 88 1a 01 00 00    	js     802064 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f4a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f4e:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+  801f5a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f5d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f67:	48 89 c6             	mov    %rax,%rsi
+  801f6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6f:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	89 c3                	mov    %eax,%ebx
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	0f 88 c5 00 00 00    	js     80204a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f85:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f89:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+  801f95:	48 89 c1             	mov    %rax,%rcx
+  801f98:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f9e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa9:	4c 89 ee             	mov    %r13,%rsi
+  801fac:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fb1:	48 b8 11 03 80 00 00 	movabs $0x800311,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	89 c3                	mov    %eax,%ebx
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 6e                	js     802031 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801fc3:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fc8:	4c 89 ef             	mov    %r13,%rdi
+  801fcb:	48 b8 4c 02 80 00 00 	movabs $0x80024c,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+  801fd7:	83 f8 02             	cmp    $0x2,%eax
+  801fda:	0f 85 ab 00 00 00    	jne    80208b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fe0:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fe7:	00 00 
+  801fe9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fed:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ff3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801ffa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801ffe:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802000:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802004:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80200b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80200f:	48 bb 7a 06 80 00 00 	movabs $0x80067a,%rbx
+  802016:	00 00 00 
+  802019:	ff d3                	call   *%rbx
+  80201b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80201f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802023:	ff d3                	call   *%rbx
+  802025:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80202a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80202f:	eb 4d                	jmp    80207e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802031:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802036:	4c 89 ee             	mov    %r13,%rsi
+  802039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203e:	48 b8 76 03 80 00 00 	movabs $0x800376,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80204a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80204f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802053:	bf 00 00 00 00       	mov    $0x0,%edi
+  802058:	48 b8 76 03 80 00 00 	movabs $0x800376,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802064:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802069:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80206d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802072:	48 b8 76 03 80 00 00 	movabs $0x800376,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+}
+  80207e:	89 d8                	mov    %ebx,%eax
+  802080:	48 83 c4 18          	add    $0x18,%rsp
+  802084:	5b                   	pop    %rbx
+  802085:	41 5c                	pop    %r12
+  802087:	41 5d                	pop    %r13
+  802089:	5d                   	pop    %rbp
+  80208a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80208b:	48 b9 d0 37 80 00 00 	movabs $0x8037d0,%rcx
+  802092:	00 00 00 
+  802095:	48 ba a7 37 80 00 00 	movabs $0x8037a7,%rdx
+  80209c:	00 00 00 
+  80209f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8020a4:	48 bf bc 37 80 00 00 	movabs $0x8037bc,%rdi
+  8020ab:	00 00 00 
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	49 b8 0b 25 80 00 00 	movabs $0x80250b,%r8
+  8020ba:	00 00 00 
+  8020bd:	41 ff d0             	call   *%r8
+
+00000000008020c0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8020c0:	55                   	push   %rbp
+  8020c1:	48 89 e5             	mov    %rsp,%rbp
+  8020c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020cc:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  8020d3:	00 00 00 
+  8020d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	78 35                	js     802111 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020e0:	48 b8 8c 06 80 00 00 	movabs $0x80068c,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020ef:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020f9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020fd:	48 b8 7e 02 80 00 00 	movabs $0x80027e,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	0f 94 c0             	sete   %al
+  80210e:	0f b6 c0             	movzbl %al,%eax
+}
+  802111:	c9                   	leave
+  802112:	c3                   	ret
+
+0000000000802113 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802113:	48 89 f8             	mov    %rdi,%rax
+  802116:	48 c1 e8 27          	shr    $0x27,%rax
+  80211a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802121:	01 00 00 
+  802124:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802128:	f6 c2 01             	test   $0x1,%dl
+  80212b:	74 6d                	je     80219a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80212d:	48 89 f8             	mov    %rdi,%rax
+  802130:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802134:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80213b:	01 00 00 
+  80213e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802142:	f6 c2 01             	test   $0x1,%dl
+  802145:	74 62                	je     8021a9 <get_uvpt_entry+0x96>
+  802147:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80214e:	01 00 00 
+  802151:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802155:	f6 c2 80             	test   $0x80,%dl
+  802158:	75 4f                	jne    8021a9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80215a:	48 89 f8             	mov    %rdi,%rax
+  80215d:	48 c1 e8 15          	shr    $0x15,%rax
+  802161:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802168:	01 00 00 
+  80216b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80216f:	f6 c2 01             	test   $0x1,%dl
+  802172:	74 44                	je     8021b8 <get_uvpt_entry+0xa5>
+  802174:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80217b:	01 00 00 
+  80217e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802182:	f6 c2 80             	test   $0x80,%dl
+  802185:	75 31                	jne    8021b8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802187:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80218b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802192:	01 00 00 
+  802195:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802199:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80219a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8021a1:	01 00 00 
+  8021a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8021a9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8021b0:	01 00 00 
+  8021b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021b7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8021b8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8021bf:	01 00 00 
+  8021c2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021c6:	c3                   	ret
+
+00000000008021c7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021cb:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+  8021d7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021da:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021df:	89 c1                	mov    %eax,%ecx
+  8021e1:	83 c9 04             	or     $0x4,%ecx
+  8021e4:	f6 c2 01             	test   $0x1,%dl
+  8021e7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021ea:	89 c1                	mov    %eax,%ecx
+  8021ec:	83 c9 02             	or     $0x2,%ecx
+  8021ef:	f6 c2 02             	test   $0x2,%dl
+  8021f2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021f5:	89 c1                	mov    %eax,%ecx
+  8021f7:	83 c9 01             	or     $0x1,%ecx
+  8021fa:	48 85 d2             	test   %rdx,%rdx
+  8021fd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802200:	89 c1                	mov    %eax,%ecx
+  802202:	83 c9 40             	or     $0x40,%ecx
+  802205:	f6 c6 04             	test   $0x4,%dh
+  802208:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80220b:	5d                   	pop    %rbp
+  80220c:	c3                   	ret
+
+000000000080220d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80220d:	55                   	push   %rbp
+  80220e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802211:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80221d:	48 c1 e8 06          	shr    $0x6,%rax
+  802221:	83 e0 01             	and    $0x1,%eax
+}
+  802224:	5d                   	pop    %rbp
+  802225:	c3                   	ret
+
+0000000000802226 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80222a:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  802236:	48 c1 e8 05          	shr    $0x5,%rax
+  80223a:	83 e0 01             	and    $0x1,%eax
+}
+  80223d:	5d                   	pop    %rbp
+  80223e:	c3                   	ret
+
+000000000080223f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80223f:	55                   	push   %rbp
+  802240:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802243:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	83 e0 01             	and    $0x1,%eax
+}
+  802252:	5d                   	pop    %rbp
+  802253:	c3                   	ret
+
+0000000000802254 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	41 57                	push   %r15
+  80225a:	41 56                	push   %r14
+  80225c:	41 55                	push   %r13
+  80225e:	41 54                	push   %r12
+  802260:	53                   	push   %rbx
+  802261:	48 83 ec 18          	sub    $0x18,%rsp
+  802265:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802269:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80226d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  802272:	49 bd 3f 22 80 00 00 	movabs $0x80223f,%r13
+  802279:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80227c:	49 bf c7 21 80 00 00 	movabs $0x8021c7,%r15
+  802283:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802286:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80228d:	00 00 00 
+  802290:	eb 0c                	jmp    80229e <foreach_shared_region+0x4a>
+  802292:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802299:	4c 39 f3             	cmp    %r14,%rbx
+  80229c:	74 2e                	je     8022cc <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80229e:	48 89 df             	mov    %rbx,%rdi
+  8022a1:	41 ff d5             	call   *%r13
+  8022a4:	84 c0                	test   %al,%al
+  8022a6:	74 ea                	je     802292 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8022a8:	48 89 df             	mov    %rbx,%rdi
+  8022ab:	41 ff d7             	call   *%r15
+  8022ae:	a8 40                	test   $0x40,%al
+  8022b0:	74 e0                	je     802292 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8022b2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8022b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022bd:	48 89 df             	mov    %rbx,%rdi
+  8022c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022c4:	ff d0                	call   *%rax
+				if (res < 0) {
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	79 c8                	jns    802292 <foreach_shared_region+0x3e>
+  8022ca:	eb 05                	jmp    8022d1 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d1:	48 83 c4 18          	add    $0x18,%rsp
+  8022d5:	5b                   	pop    %rbx
+  8022d6:	41 5c                	pop    %r12
+  8022d8:	41 5d                	pop    %r13
+  8022da:	41 5e                	pop    %r14
+  8022dc:	41 5f                	pop    %r15
+  8022de:	5d                   	pop    %rbp
+  8022df:	c3                   	ret
+
+00000000008022e0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e5:	c3                   	ret
+
+00000000008022e6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022e6:	55                   	push   %rbp
+  8022e7:	48 89 e5             	mov    %rsp,%rbp
+  8022ea:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022ed:	48 be f4 37 80 00 00 	movabs $0x8037f4,%rsi
+  8022f4:	00 00 00 
+  8022f7:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  8022fe:	00 00 00 
+  802301:	ff d0                	call   *%rax
+    return 0;
+}
+  802303:	b8 00 00 00 00       	mov    $0x0,%eax
+  802308:	5d                   	pop    %rbp
+  802309:	c3                   	ret
+
+000000000080230a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80230a:	55                   	push   %rbp
+  80230b:	48 89 e5             	mov    %rsp,%rbp
+  80230e:	41 57                	push   %r15
+  802310:	41 56                	push   %r14
+  802312:	41 55                	push   %r13
+  802314:	41 54                	push   %r12
+  802316:	53                   	push   %rbx
+  802317:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80231e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802325:	48 85 d2             	test   %rdx,%rdx
+  802328:	74 7a                	je     8023a4 <devcons_write+0x9a>
+  80232a:	49 89 d6             	mov    %rdx,%r14
+  80232d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802333:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802338:	49 bf 7a 31 80 00 00 	movabs $0x80317a,%r15
+  80233f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802342:	4c 89 f3             	mov    %r14,%rbx
+  802345:	48 29 f3             	sub    %rsi,%rbx
+  802348:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80234d:	48 39 c3             	cmp    %rax,%rbx
+  802350:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802354:	4c 63 eb             	movslq %ebx,%r13
+  802357:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80235e:	48 01 c6             	add    %rax,%rsi
+  802361:	4c 89 ea             	mov    %r13,%rdx
+  802364:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80236b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80236e:	4c 89 ee             	mov    %r13,%rsi
+  802371:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802378:	48 b8 21 01 80 00 00 	movabs $0x800121,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802384:	41 01 dc             	add    %ebx,%r12d
+  802387:	49 63 f4             	movslq %r12d,%rsi
+  80238a:	4c 39 f6             	cmp    %r14,%rsi
+  80238d:	72 b3                	jb     802342 <devcons_write+0x38>
+    return res;
+  80238f:	49 63 c4             	movslq %r12d,%rax
+}
+  802392:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802399:	5b                   	pop    %rbx
+  80239a:	41 5c                	pop    %r12
+  80239c:	41 5d                	pop    %r13
+  80239e:	41 5e                	pop    %r14
+  8023a0:	41 5f                	pop    %r15
+  8023a2:	5d                   	pop    %rbp
+  8023a3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8023a4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023aa:	eb e3                	jmp    80238f <devcons_write+0x85>
+
+00000000008023ac <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023ac:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8023af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b4:	48 85 c0             	test   %rax,%rax
+  8023b7:	74 55                	je     80240e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023b9:	55                   	push   %rbp
+  8023ba:	48 89 e5             	mov    %rsp,%rbp
+  8023bd:	41 55                	push   %r13
+  8023bf:	41 54                	push   %r12
+  8023c1:	53                   	push   %rbx
+  8023c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023c9:	48 bb 4e 01 80 00 00 	movabs $0x80014e,%rbx
+  8023d0:	00 00 00 
+  8023d3:	49 bc 1b 02 80 00 00 	movabs $0x80021b,%r12
+  8023da:	00 00 00 
+  8023dd:	eb 03                	jmp    8023e2 <devcons_read+0x36>
+  8023df:	41 ff d4             	call   *%r12
+  8023e2:	ff d3                	call   *%rbx
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	74 f7                	je     8023df <devcons_read+0x33>
+    if (c < 0) return c;
+  8023e8:	48 63 d0             	movslq %eax,%rdx
+  8023eb:	78 13                	js     802400 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f2:	83 f8 04             	cmp    $0x4,%eax
+  8023f5:	74 09                	je     802400 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023f7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023fb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802400:	48 89 d0             	mov    %rdx,%rax
+  802403:	48 83 c4 08          	add    $0x8,%rsp
+  802407:	5b                   	pop    %rbx
+  802408:	41 5c                	pop    %r12
+  80240a:	41 5d                	pop    %r13
+  80240c:	5d                   	pop    %rbp
+  80240d:	c3                   	ret
+  80240e:	48 89 d0             	mov    %rdx,%rax
+  802411:	c3                   	ret
+
+0000000000802412 <cputchar>:
+cputchar(int ch) {
+  802412:	55                   	push   %rbp
+  802413:	48 89 e5             	mov    %rsp,%rbp
+  802416:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80241a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80241e:	be 01 00 00 00       	mov    $0x1,%esi
+  802423:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802427:	48 b8 21 01 80 00 00 	movabs $0x800121,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+}
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+
+0000000000802435 <getchar>:
+getchar(void) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80243d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802442:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802446:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244b:	48 b8 eb 09 80 00 00 	movabs $0x8009eb,%rax
+  802452:	00 00 00 
+  802455:	ff d0                	call   *%rax
+  802457:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	78 06                	js     802463 <getchar+0x2e>
+  80245d:	74 08                	je     802467 <getchar+0x32>
+  80245f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802463:	89 d0                	mov    %edx,%eax
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802467:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80246c:	eb f5                	jmp    802463 <getchar+0x2e>
+
+000000000080246e <iscons>:
+iscons(int fdnum) {
+  80246e:	55                   	push   %rbp
+  80246f:	48 89 e5             	mov    %rsp,%rbp
+  802472:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802476:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80247a:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802486:	85 c0                	test   %eax,%eax
+  802488:	78 18                	js     8024a2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80248a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80248e:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802495:	00 00 00 
+  802498:	8b 00                	mov    (%rax),%eax
+  80249a:	39 02                	cmp    %eax,(%rdx)
+  80249c:	0f 94 c0             	sete   %al
+  80249f:	0f b6 c0             	movzbl %al,%eax
+}
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+
+00000000008024a4 <opencons>:
+opencons(void) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+  8024a8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024ac:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8024b0:	48 b8 a8 06 80 00 00 	movabs $0x8006a8,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+  8024bc:	85 c0                	test   %eax,%eax
+  8024be:	78 49                	js     802509 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8024c0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ca:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d3:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	78 26                	js     802509 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024e7:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024ee:	00 00 
+  8024f0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024f2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024f6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024fd:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+}
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+000000000080250b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+  80250f:	41 56                	push   %r14
+  802511:	41 55                	push   %r13
+  802513:	41 54                	push   %r12
+  802515:	53                   	push   %rbx
+  802516:	48 83 ec 50          	sub    $0x50,%rsp
+  80251a:	49 89 fc             	mov    %rdi,%r12
+  80251d:	41 89 f5             	mov    %esi,%r13d
+  802520:	48 89 d3             	mov    %rdx,%rbx
+  802523:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802527:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80252b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80252f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802536:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80253a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80253e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802542:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802546:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80254d:	00 00 00 
+  802550:	4c 8b 30             	mov    (%rax),%r14
+  802553:	48 b8 ea 01 80 00 00 	movabs $0x8001ea,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+  80255f:	89 c6                	mov    %eax,%esi
+  802561:	45 89 e8             	mov    %r13d,%r8d
+  802564:	4c 89 e1             	mov    %r12,%rcx
+  802567:	4c 89 f2             	mov    %r14,%rdx
+  80256a:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  802571:	00 00 00 
+  802574:	b8 00 00 00 00       	mov    $0x0,%eax
+  802579:	49 bc 5b 26 80 00 00 	movabs $0x80265b,%r12
+  802580:	00 00 00 
+  802583:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802586:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80258a:	48 89 df             	mov    %rbx,%rdi
+  80258d:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+    cprintf("\n");
+  802599:	48 bf 5b 37 80 00 00 	movabs $0x80375b,%rdi
+  8025a0:	00 00 00 
+  8025a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8025ab:	cc                   	int3
+  8025ac:	eb fd                	jmp    8025ab <_panic+0xa0>
+
+00000000008025ae <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8025ae:	55                   	push   %rbp
+  8025af:	48 89 e5             	mov    %rsp,%rbp
+  8025b2:	53                   	push   %rbx
+  8025b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8025ba:	8b 06                	mov    (%rsi),%eax
+  8025bc:	8d 50 01             	lea    0x1(%rax),%edx
+  8025bf:	89 16                	mov    %edx,(%rsi)
+  8025c1:	48 98                	cltq
+  8025c3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025c8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025ce:	74 0a                	je     8025da <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025d0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d8:	c9                   	leave
+  8025d9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025da:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025de:	be ff 00 00 00       	mov    $0xff,%esi
+  8025e3:	48 b8 21 01 80 00 00 	movabs $0x800121,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025ef:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025f5:	eb d9                	jmp    8025d0 <putch+0x22>
+
+00000000008025f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802602:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802605:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80260c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802611:	b8 00 00 00 00       	mov    $0x0,%eax
+  802616:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802619:	48 89 f1             	mov    %rsi,%rcx
+  80261c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802623:	48 bf ae 25 80 00 00 	movabs $0x8025ae,%rdi
+  80262a:	00 00 00 
+  80262d:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802639:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802640:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802647:	48 b8 21 01 80 00 00 	movabs $0x800121,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802653:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802659:	c9                   	leave
+  80265a:	c3                   	ret
+
+000000000080265b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80265b:	55                   	push   %rbp
+  80265c:	48 89 e5             	mov    %rsp,%rbp
+  80265f:	48 83 ec 50          	sub    $0x50,%rsp
+  802663:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802667:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80266b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80266f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802673:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802677:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80267e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802682:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802686:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80268a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80268e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802692:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  802699:	00 00 00 
+  80269c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80269e:	c9                   	leave
+  80269f:	c3                   	ret
+
+00000000008026a0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8026a0:	55                   	push   %rbp
+  8026a1:	48 89 e5             	mov    %rsp,%rbp
+  8026a4:	41 57                	push   %r15
+  8026a6:	41 56                	push   %r14
+  8026a8:	41 55                	push   %r13
+  8026aa:	41 54                	push   %r12
+  8026ac:	53                   	push   %rbx
+  8026ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8026b1:	49 89 fc             	mov    %rdi,%r12
+  8026b4:	49 89 f5             	mov    %rsi,%r13
+  8026b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026bb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8026be:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8026c1:	41 89 cf             	mov    %ecx,%r15d
+  8026c4:	4c 39 fa             	cmp    %r15,%rdx
+  8026c7:	73 5b                	jae    802724 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026c9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026cd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026d1:	85 db                	test   %ebx,%ebx
+  8026d3:	7e 0e                	jle    8026e3 <print_num+0x43>
+            putch(padc, put_arg);
+  8026d5:	4c 89 ee             	mov    %r13,%rsi
+  8026d8:	44 89 f7             	mov    %r14d,%edi
+  8026db:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026de:	83 eb 01             	sub    $0x1,%ebx
+  8026e1:	75 f2                	jne    8026d5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026e3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026e7:	48 b9 34 38 80 00 00 	movabs $0x803834,%rcx
+  8026ee:	00 00 00 
+  8026f1:	48 b8 23 38 80 00 00 	movabs $0x803823,%rax
+  8026f8:	00 00 00 
+  8026fb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802703:	ba 00 00 00 00       	mov    $0x0,%edx
+  802708:	49 f7 f7             	div    %r15
+  80270b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80270f:	4c 89 ee             	mov    %r13,%rsi
+  802712:	41 ff d4             	call   *%r12
+}
+  802715:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802719:	5b                   	pop    %rbx
+  80271a:	41 5c                	pop    %r12
+  80271c:	41 5d                	pop    %r13
+  80271e:	41 5e                	pop    %r14
+  802720:	41 5f                	pop    %r15
+  802722:	5d                   	pop    %rbp
+  802723:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802724:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272d:	49 f7 f7             	div    %r15
+  802730:	48 83 ec 08          	sub    $0x8,%rsp
+  802734:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802738:	52                   	push   %rdx
+  802739:	45 0f be c9          	movsbl %r9b,%r9d
+  80273d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802741:	48 89 c2             	mov    %rax,%rdx
+  802744:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+  802750:	48 83 c4 10          	add    $0x10,%rsp
+  802754:	eb 8d                	jmp    8026e3 <print_num+0x43>
+
+0000000000802756 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802756:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80275a:	48 8b 06             	mov    (%rsi),%rax
+  80275d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802761:	73 0a                	jae    80276d <sprintputch+0x17>
+        *state->start++ = ch;
+  802763:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802767:	48 89 16             	mov    %rdx,(%rsi)
+  80276a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80276d:	c3                   	ret
+
+000000000080276e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 50          	sub    $0x50,%rsp
+  802776:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80277a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80277e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802782:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802789:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80278d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802791:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802795:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802799:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80279d:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  8027a4:	00 00 00 
+  8027a7:	ff d0                	call   *%rax
+}
+  8027a9:	c9                   	leave
+  8027aa:	c3                   	ret
+
+00000000008027ab <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8027ab:	55                   	push   %rbp
+  8027ac:	48 89 e5             	mov    %rsp,%rbp
+  8027af:	41 57                	push   %r15
+  8027b1:	41 56                	push   %r14
+  8027b3:	41 55                	push   %r13
+  8027b5:	41 54                	push   %r12
+  8027b7:	53                   	push   %rbx
+  8027b8:	48 83 ec 38          	sub    $0x38,%rsp
+  8027bc:	49 89 fe             	mov    %rdi,%r14
+  8027bf:	49 89 f5             	mov    %rsi,%r13
+  8027c2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8027c5:	48 8b 01             	mov    (%rcx),%rax
+  8027c8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027cc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027d4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027dc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027e0:	0f b6 3b             	movzbl (%rbx),%edi
+  8027e3:	40 80 ff 25          	cmp    $0x25,%dil
+  8027e7:	74 18                	je     802801 <vprintfmt+0x56>
+            if (!ch) return;
+  8027e9:	40 84 ff             	test   %dil,%dil
+  8027ec:	0f 84 b1 06 00 00    	je     802ea3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027f2:	40 0f b6 ff          	movzbl %dil,%edi
+  8027f6:	4c 89 ee             	mov    %r13,%rsi
+  8027f9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027fc:	4c 89 e3             	mov    %r12,%rbx
+  8027ff:	eb db                	jmp    8027dc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802801:	be 00 00 00 00       	mov    $0x0,%esi
+  802806:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80280a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80280f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802815:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80281c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802820:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802825:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80282a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80282d:	83 e8 23             	sub    $0x23,%eax
+  802830:	3c 57                	cmp    $0x57,%al
+  802832:	0f 87 51 06 00 00    	ja     802e89 <vprintfmt+0x6de>
+  802838:	0f b6 c0             	movzbl %al,%eax
+  80283b:	48 b9 c0 39 80 00 00 	movabs $0x8039c0,%rcx
+  802842:	00 00 00 
+  802845:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802848:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80284b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80284f:	eb cf                	jmp    802820 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802851:	49 89 dc             	mov    %rbx,%r12
+  802854:	be 01 00 00 00       	mov    $0x1,%esi
+  802859:	eb c5                	jmp    802820 <vprintfmt+0x75>
+            padc = ch;
+  80285b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80285f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802862:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802865:	eb b9                	jmp    802820 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80286a:	83 f8 2f             	cmp    $0x2f,%eax
+  80286d:	77 24                	ja     802893 <vprintfmt+0xe8>
+  80286f:	89 c1                	mov    %eax,%ecx
+  802871:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802875:	83 c0 08             	add    $0x8,%eax
+  802878:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80287b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80287e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802881:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802885:	79 99                	jns    802820 <vprintfmt+0x75>
+                width = precision;
+  802887:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80288b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802891:	eb 8d                	jmp    802820 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802893:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802897:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80289b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80289f:	eb da                	jmp    80287b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8028a1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8028a6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028aa:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8028b0:	3c 39                	cmp    $0x39,%al
+  8028b2:	77 1c                	ja     8028d0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8028b4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8028b8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8028bc:	0f b6 c0             	movzbl %al,%eax
+  8028bf:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8028c4:	0f b6 03             	movzbl (%rbx),%eax
+  8028c7:	3c 39                	cmp    $0x39,%al
+  8028c9:	76 e9                	jbe    8028b4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028cb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028ce:	eb b1                	jmp    802881 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028d0:	49 89 dc             	mov    %rbx,%r12
+  8028d3:	eb ac                	jmp    802881 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028d5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028d8:	85 c9                	test   %ecx,%ecx
+  8028da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028df:	0f 49 c1             	cmovns %ecx,%eax
+  8028e2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028e5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028e8:	e9 33 ff ff ff       	jmp    802820 <vprintfmt+0x75>
+            lflag++;
+  8028ed:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028f0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028f3:	e9 28 ff ff ff       	jmp    802820 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8028fe:	77 19                	ja     802919 <vprintfmt+0x16e>
+  802900:	89 c2                	mov    %eax,%edx
+  802902:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802906:	83 c0 08             	add    $0x8,%eax
+  802909:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80290c:	8b 3a                	mov    (%rdx),%edi
+  80290e:	4c 89 ee             	mov    %r13,%rsi
+  802911:	41 ff d6             	call   *%r14
+            break;
+  802914:	e9 c3 fe ff ff       	jmp    8027dc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802919:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80291d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802921:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802925:	eb e5                	jmp    80290c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802927:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80292a:	83 f8 2f             	cmp    $0x2f,%eax
+  80292d:	77 5a                	ja     802989 <vprintfmt+0x1de>
+  80292f:	89 c2                	mov    %eax,%edx
+  802931:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802935:	83 c0 08             	add    $0x8,%eax
+  802938:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80293b:	8b 02                	mov    (%rdx),%eax
+  80293d:	89 c1                	mov    %eax,%ecx
+  80293f:	f7 d9                	neg    %ecx
+  802941:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802944:	83 f9 14             	cmp    $0x14,%ecx
+  802947:	7f 4e                	jg     802997 <vprintfmt+0x1ec>
+  802949:	48 63 c1             	movslq %ecx,%rax
+  80294c:	48 ba 80 3c 80 00 00 	movabs $0x803c80,%rdx
+  802953:	00 00 00 
+  802956:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80295a:	48 85 c0             	test   %rax,%rax
+  80295d:	74 38                	je     802997 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80295f:	48 89 c1             	mov    %rax,%rcx
+  802962:	48 ba b9 37 80 00 00 	movabs $0x8037b9,%rdx
+  802969:	00 00 00 
+  80296c:	4c 89 ee             	mov    %r13,%rsi
+  80296f:	4c 89 f7             	mov    %r14,%rdi
+  802972:	b8 00 00 00 00       	mov    $0x0,%eax
+  802977:	49 b8 6e 27 80 00 00 	movabs $0x80276e,%r8
+  80297e:	00 00 00 
+  802981:	41 ff d0             	call   *%r8
+  802984:	e9 53 fe ff ff       	jmp    8027dc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80298d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802995:	eb a4                	jmp    80293b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802997:	48 ba 4c 38 80 00 00 	movabs $0x80384c,%rdx
+  80299e:	00 00 00 
+  8029a1:	4c 89 ee             	mov    %r13,%rsi
+  8029a4:	4c 89 f7             	mov    %r14,%rdi
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ac:	49 b8 6e 27 80 00 00 	movabs $0x80276e,%r8
+  8029b3:	00 00 00 
+  8029b6:	41 ff d0             	call   *%r8
+  8029b9:	e9 1e fe ff ff       	jmp    8027dc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8029be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8029c4:	77 6c                	ja     802a32 <vprintfmt+0x287>
+  8029c6:	89 c2                	mov    %eax,%edx
+  8029c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029cc:	83 c0 08             	add    $0x8,%eax
+  8029cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029d2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029d5:	48 85 d2             	test   %rdx,%rdx
+  8029d8:	48 b8 45 38 80 00 00 	movabs $0x803845,%rax
+  8029df:	00 00 00 
+  8029e2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029e6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029ee:	7e 06                	jle    8029f6 <vprintfmt+0x24b>
+  8029f0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029f4:	75 4a                	jne    802a40 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029f6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029fa:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029fe:	0f b6 00             	movzbl (%rax),%eax
+  802a01:	84 c0                	test   %al,%al
+  802a03:	0f 85 9a 00 00 00    	jne    802aa3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802a09:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a0c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	0f 8e c4 fd ff ff    	jle    8027dc <vprintfmt+0x31>
+  802a18:	4c 89 ee             	mov    %r13,%rsi
+  802a1b:	bf 20 00 00 00       	mov    $0x20,%edi
+  802a20:	41 ff d6             	call   *%r14
+  802a23:	41 83 ec 01          	sub    $0x1,%r12d
+  802a27:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a2b:	75 eb                	jne    802a18 <vprintfmt+0x26d>
+  802a2d:	e9 aa fd ff ff       	jmp    8027dc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a3e:	eb 92                	jmp    8029d2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a40:	49 63 f7             	movslq %r15d,%rsi
+  802a43:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a47:	48 b8 5d 2f 80 00 00 	movabs $0x802f5d,%rax
+  802a4e:	00 00 00 
+  802a51:	ff d0                	call   *%rax
+  802a53:	48 89 c2             	mov    %rax,%rdx
+  802a56:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a59:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a5b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a5e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	7e 91                	jle    8029f6 <vprintfmt+0x24b>
+  802a65:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a6a:	4c 89 ee             	mov    %r13,%rsi
+  802a6d:	44 89 e7             	mov    %r12d,%edi
+  802a70:	41 ff d6             	call   *%r14
+  802a73:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a77:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a7a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a7d:	75 eb                	jne    802a6a <vprintfmt+0x2bf>
+  802a7f:	e9 72 ff ff ff       	jmp    8029f6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a84:	0f b6 f8             	movzbl %al,%edi
+  802a87:	4c 89 ee             	mov    %r13,%rsi
+  802a8a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a8d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a91:	49 83 c4 01          	add    $0x1,%r12
+  802a95:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a9b:	84 c0                	test   %al,%al
+  802a9d:	0f 84 66 ff ff ff    	je     802a09 <vprintfmt+0x25e>
+  802aa3:	45 85 ff             	test   %r15d,%r15d
+  802aa6:	78 0a                	js     802ab2 <vprintfmt+0x307>
+  802aa8:	41 83 ef 01          	sub    $0x1,%r15d
+  802aac:	0f 88 57 ff ff ff    	js     802a09 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802ab2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802ab6:	74 cc                	je     802a84 <vprintfmt+0x2d9>
+  802ab8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802abb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ac0:	80 fa 5e             	cmp    $0x5e,%dl
+  802ac3:	77 c2                	ja     802a87 <vprintfmt+0x2dc>
+  802ac5:	eb bd                	jmp    802a84 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802ac7:	40 84 f6             	test   %sil,%sil
+  802aca:	75 26                	jne    802af2 <vprintfmt+0x347>
+    switch (lflag) {
+  802acc:	85 d2                	test   %edx,%edx
+  802ace:	74 59                	je     802b29 <vprintfmt+0x37e>
+  802ad0:	83 fa 01             	cmp    $0x1,%edx
+  802ad3:	74 7b                	je     802b50 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802ad5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ad8:	83 f8 2f             	cmp    $0x2f,%eax
+  802adb:	0f 87 96 00 00 00    	ja     802b77 <vprintfmt+0x3cc>
+  802ae1:	89 c2                	mov    %eax,%edx
+  802ae3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ae7:	83 c0 08             	add    $0x8,%eax
+  802aea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802aed:	4c 8b 22             	mov    (%rdx),%r12
+  802af0:	eb 17                	jmp    802b09 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802af2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802af5:	83 f8 2f             	cmp    $0x2f,%eax
+  802af8:	77 21                	ja     802b1b <vprintfmt+0x370>
+  802afa:	89 c2                	mov    %eax,%edx
+  802afc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b00:	83 c0 08             	add    $0x8,%eax
+  802b03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b06:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802b09:	4d 85 e4             	test   %r12,%r12
+  802b0c:	78 7a                	js     802b88 <vprintfmt+0x3dd>
+            num = i;
+  802b0e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802b11:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802b16:	e9 50 02 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b27:	eb dd                	jmp    802b06 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  802b2f:	77 11                	ja     802b42 <vprintfmt+0x397>
+  802b31:	89 c2                	mov    %eax,%edx
+  802b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b37:	83 c0 08             	add    $0x8,%eax
+  802b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b3d:	4c 63 22             	movslq (%rdx),%r12
+  802b40:	eb c7                	jmp    802b09 <vprintfmt+0x35e>
+  802b42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b4e:	eb ed                	jmp    802b3d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b53:	83 f8 2f             	cmp    $0x2f,%eax
+  802b56:	77 11                	ja     802b69 <vprintfmt+0x3be>
+  802b58:	89 c2                	mov    %eax,%edx
+  802b5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b5e:	83 c0 08             	add    $0x8,%eax
+  802b61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b64:	4c 8b 22             	mov    (%rdx),%r12
+  802b67:	eb a0                	jmp    802b09 <vprintfmt+0x35e>
+  802b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b75:	eb ed                	jmp    802b64 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b83:	e9 65 ff ff ff       	jmp    802aed <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b88:	4c 89 ee             	mov    %r13,%rsi
+  802b8b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b90:	41 ff d6             	call   *%r14
+                i = -i;
+  802b93:	49 f7 dc             	neg    %r12
+  802b96:	e9 73 ff ff ff       	jmp    802b0e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b9b:	40 84 f6             	test   %sil,%sil
+  802b9e:	75 32                	jne    802bd2 <vprintfmt+0x427>
+    switch (lflag) {
+  802ba0:	85 d2                	test   %edx,%edx
+  802ba2:	74 5d                	je     802c01 <vprintfmt+0x456>
+  802ba4:	83 fa 01             	cmp    $0x1,%edx
+  802ba7:	0f 84 82 00 00 00    	je     802c2f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  802bb3:	0f 87 a5 00 00 00    	ja     802c5e <vprintfmt+0x4b3>
+  802bb9:	89 c2                	mov    %eax,%edx
+  802bbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bbf:	83 c0 08             	add    $0x8,%eax
+  802bc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bc5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bc8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bcd:	e9 99 01 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bd5:	83 f8 2f             	cmp    $0x2f,%eax
+  802bd8:	77 19                	ja     802bf3 <vprintfmt+0x448>
+  802bda:	89 c2                	mov    %eax,%edx
+  802bdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802be0:	83 c0 08             	add    $0x8,%eax
+  802be3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802be6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802be9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bee:	e9 78 01 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+  802bf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bff:	eb e5                	jmp    802be6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c04:	83 f8 2f             	cmp    $0x2f,%eax
+  802c07:	77 18                	ja     802c21 <vprintfmt+0x476>
+  802c09:	89 c2                	mov    %eax,%edx
+  802c0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c0f:	83 c0 08             	add    $0x8,%eax
+  802c12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c15:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802c17:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802c1c:	e9 4a 01 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+  802c21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c2d:	eb e6                	jmp    802c15 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c32:	83 f8 2f             	cmp    $0x2f,%eax
+  802c35:	77 19                	ja     802c50 <vprintfmt+0x4a5>
+  802c37:	89 c2                	mov    %eax,%edx
+  802c39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c3d:	83 c0 08             	add    $0x8,%eax
+  802c40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c43:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c4b:	e9 1b 01 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+  802c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c5c:	eb e5                	jmp    802c43 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c6a:	e9 56 ff ff ff       	jmp    802bc5 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c6f:	40 84 f6             	test   %sil,%sil
+  802c72:	75 2e                	jne    802ca2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c74:	85 d2                	test   %edx,%edx
+  802c76:	74 59                	je     802cd1 <vprintfmt+0x526>
+  802c78:	83 fa 01             	cmp    $0x1,%edx
+  802c7b:	74 7f                	je     802cfc <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c80:	83 f8 2f             	cmp    $0x2f,%eax
+  802c83:	0f 87 9f 00 00 00    	ja     802d28 <vprintfmt+0x57d>
+  802c89:	89 c2                	mov    %eax,%edx
+  802c8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c8f:	83 c0 08             	add    $0x8,%eax
+  802c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c98:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c9d:	e9 c9 00 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802ca2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ca5:	83 f8 2f             	cmp    $0x2f,%eax
+  802ca8:	77 19                	ja     802cc3 <vprintfmt+0x518>
+  802caa:	89 c2                	mov    %eax,%edx
+  802cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cb0:	83 c0 08             	add    $0x8,%eax
+  802cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802cb9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802cbe:	e9 a8 00 00 00       	jmp    802d6b <vprintfmt+0x5c0>
+  802cc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ccb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ccf:	eb e5                	jmp    802cb6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802cd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cd4:	83 f8 2f             	cmp    $0x2f,%eax
+  802cd7:	77 15                	ja     802cee <vprintfmt+0x543>
+  802cd9:	89 c2                	mov    %eax,%edx
+  802cdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cdf:	83 c0 08             	add    $0x8,%eax
+  802ce2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ce5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802ce7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cec:	eb 7d                	jmp    802d6b <vprintfmt+0x5c0>
+  802cee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cf2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cfa:	eb e9                	jmp    802ce5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cff:	83 f8 2f             	cmp    $0x2f,%eax
+  802d02:	77 16                	ja     802d1a <vprintfmt+0x56f>
+  802d04:	89 c2                	mov    %eax,%edx
+  802d06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d0a:	83 c0 08             	add    $0x8,%eax
+  802d0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802d13:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802d18:	eb 51                	jmp    802d6b <vprintfmt+0x5c0>
+  802d1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d26:	eb e8                	jmp    802d10 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d34:	e9 5c ff ff ff       	jmp    802c95 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d39:	4c 89 ee             	mov    %r13,%rsi
+  802d3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d41:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d44:	4c 89 ee             	mov    %r13,%rsi
+  802d47:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d4c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d52:	83 f8 2f             	cmp    $0x2f,%eax
+  802d55:	77 47                	ja     802d9e <vprintfmt+0x5f3>
+  802d57:	89 c2                	mov    %eax,%edx
+  802d59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d5d:	83 c0 08             	add    $0x8,%eax
+  802d60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d66:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d73:	0f 94 c0             	sete   %al
+  802d76:	0f b6 c0             	movzbl %al,%eax
+  802d79:	50                   	push   %rax
+  802d7a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d7f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d83:	4c 89 ee             	mov    %r13,%rsi
+  802d86:	4c 89 f7             	mov    %r14,%rdi
+  802d89:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  802d90:	00 00 00 
+  802d93:	ff d0                	call   *%rax
+            break;
+  802d95:	48 83 c4 10          	add    $0x10,%rsp
+  802d99:	e9 3e fa ff ff       	jmp    8027dc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802da2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802daa:	eb b7                	jmp    802d63 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802dac:	40 84 f6             	test   %sil,%sil
+  802daf:	75 2b                	jne    802ddc <vprintfmt+0x631>
+    switch (lflag) {
+  802db1:	85 d2                	test   %edx,%edx
+  802db3:	74 56                	je     802e0b <vprintfmt+0x660>
+  802db5:	83 fa 01             	cmp    $0x1,%edx
+  802db8:	74 7f                	je     802e39 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802dba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dbd:	83 f8 2f             	cmp    $0x2f,%eax
+  802dc0:	0f 87 a2 00 00 00    	ja     802e68 <vprintfmt+0x6bd>
+  802dc6:	89 c2                	mov    %eax,%edx
+  802dc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dcc:	83 c0 08             	add    $0x8,%eax
+  802dcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dd2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dd5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802dda:	eb 8f                	jmp    802d6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802ddc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ddf:	83 f8 2f             	cmp    $0x2f,%eax
+  802de2:	77 19                	ja     802dfd <vprintfmt+0x652>
+  802de4:	89 c2                	mov    %eax,%edx
+  802de6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dea:	83 c0 08             	add    $0x8,%eax
+  802ded:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802df0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802df3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802df8:	e9 6e ff ff ff       	jmp    802d6b <vprintfmt+0x5c0>
+  802dfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e09:	eb e5                	jmp    802df0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802e0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e0e:	83 f8 2f             	cmp    $0x2f,%eax
+  802e11:	77 18                	ja     802e2b <vprintfmt+0x680>
+  802e13:	89 c2                	mov    %eax,%edx
+  802e15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e19:	83 c0 08             	add    $0x8,%eax
+  802e1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e1f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802e21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802e26:	e9 40 ff ff ff       	jmp    802d6b <vprintfmt+0x5c0>
+  802e2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e37:	eb e6                	jmp    802e1f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e3c:	83 f8 2f             	cmp    $0x2f,%eax
+  802e3f:	77 19                	ja     802e5a <vprintfmt+0x6af>
+  802e41:	89 c2                	mov    %eax,%edx
+  802e43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e47:	83 c0 08             	add    $0x8,%eax
+  802e4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e50:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e55:	e9 11 ff ff ff       	jmp    802d6b <vprintfmt+0x5c0>
+  802e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e66:	eb e5                	jmp    802e4d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e74:	e9 59 ff ff ff       	jmp    802dd2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e79:	4c 89 ee             	mov    %r13,%rsi
+  802e7c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e81:	41 ff d6             	call   *%r14
+            break;
+  802e84:	e9 53 f9 ff ff       	jmp    8027dc <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e89:	4c 89 ee             	mov    %r13,%rsi
+  802e8c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e91:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e94:	48 83 eb 01          	sub    $0x1,%rbx
+  802e98:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e9c:	75 f6                	jne    802e94 <vprintfmt+0x6e9>
+  802e9e:	e9 39 f9 ff ff       	jmp    8027dc <vprintfmt+0x31>
+}
+  802ea3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802ea7:	5b                   	pop    %rbx
+  802ea8:	41 5c                	pop    %r12
+  802eaa:	41 5d                	pop    %r13
+  802eac:	41 5e                	pop    %r14
+  802eae:	41 5f                	pop    %r15
+  802eb0:	5d                   	pop    %rbp
+  802eb1:	c3                   	ret
+
+0000000000802eb2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802eb2:	55                   	push   %rbp
+  802eb3:	48 89 e5             	mov    %rsp,%rbp
+  802eb6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802eba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ebe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ec3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ec7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ece:	48 85 ff             	test   %rdi,%rdi
+  802ed1:	74 2b                	je     802efe <vsnprintf+0x4c>
+  802ed3:	48 85 f6             	test   %rsi,%rsi
+  802ed6:	74 26                	je     802efe <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802ed8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802edc:	48 bf 56 27 80 00 00 	movabs $0x802756,%rdi
+  802ee3:	00 00 00 
+  802ee6:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ef2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802ef9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802efc:	c9                   	leave
+  802efd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802efe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f03:	eb f7                	jmp    802efc <vsnprintf+0x4a>
+
+0000000000802f05 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802f05:	55                   	push   %rbp
+  802f06:	48 89 e5             	mov    %rsp,%rbp
+  802f09:	48 83 ec 50          	sub    $0x50,%rsp
+  802f0d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f11:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802f15:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f19:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802f20:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f28:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f30:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f34:	48 b8 b2 2e 80 00 00 	movabs $0x802eb2,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f40:	c9                   	leave
+  802f41:	c3                   	ret
+
+0000000000802f42 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f42:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f45:	74 10                	je     802f57 <strlen+0x15>
+    size_t n = 0;
+  802f47:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f4c:	48 83 c0 01          	add    $0x1,%rax
+  802f50:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f54:	75 f6                	jne    802f4c <strlen+0xa>
+  802f56:	c3                   	ret
+    size_t n = 0;
+  802f57:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f5c:	c3                   	ret
+
+0000000000802f5d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f5d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f60:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f65:	48 85 f6             	test   %rsi,%rsi
+  802f68:	74 11                	je     802f7b <strnlen+0x1e>
+  802f6a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f6e:	74 0c                	je     802f7c <strnlen+0x1f>
+  802f70:	48 83 c2 01          	add    $0x1,%rdx
+  802f74:	48 39 d0             	cmp    %rdx,%rax
+  802f77:	75 f1                	jne    802f6a <strnlen+0xd>
+  802f79:	eb 04                	jmp    802f7f <strnlen+0x22>
+  802f7b:	c3                   	ret
+  802f7c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f7f:	c3                   	ret
+
+0000000000802f80 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f80:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f88:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f8c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f8f:	48 83 c2 01          	add    $0x1,%rdx
+  802f93:	84 c9                	test   %cl,%cl
+  802f95:	75 f1                	jne    802f88 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f97:	c3                   	ret
+
+0000000000802f98 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f98:	55                   	push   %rbp
+  802f99:	48 89 e5             	mov    %rsp,%rbp
+  802f9c:	41 54                	push   %r12
+  802f9e:	53                   	push   %rbx
+  802f9f:	48 89 fb             	mov    %rdi,%rbx
+  802fa2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802fa5:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802fb1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802fb5:	4c 89 e6             	mov    %r12,%rsi
+  802fb8:	48 b8 80 2f 80 00 00 	movabs $0x802f80,%rax
+  802fbf:	00 00 00 
+  802fc2:	ff d0                	call   *%rax
+    return dst;
+}
+  802fc4:	48 89 d8             	mov    %rbx,%rax
+  802fc7:	5b                   	pop    %rbx
+  802fc8:	41 5c                	pop    %r12
+  802fca:	5d                   	pop    %rbp
+  802fcb:	c3                   	ret
+
+0000000000802fcc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fcc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fcf:	48 85 d2             	test   %rdx,%rdx
+  802fd2:	74 1f                	je     802ff3 <strncpy+0x27>
+  802fd4:	48 01 fa             	add    %rdi,%rdx
+  802fd7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fda:	48 83 c1 01          	add    $0x1,%rcx
+  802fde:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fe2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fe6:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fea:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fee:	48 39 ca             	cmp    %rcx,%rdx
+  802ff1:	75 e7                	jne    802fda <strncpy+0xe>
+    }
+    return ret;
+}
+  802ff3:	c3                   	ret
+
+0000000000802ff4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802ff4:	48 89 f8             	mov    %rdi,%rax
+  802ff7:	48 85 d2             	test   %rdx,%rdx
+  802ffa:	74 24                	je     803020 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802ffc:	48 83 ea 01          	sub    $0x1,%rdx
+  803000:	74 1b                	je     80301d <strlcpy+0x29>
+  803002:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803006:	0f b6 16             	movzbl (%rsi),%edx
+  803009:	84 d2                	test   %dl,%dl
+  80300b:	74 10                	je     80301d <strlcpy+0x29>
+            *dst++ = *src++;
+  80300d:	48 83 c6 01          	add    $0x1,%rsi
+  803011:	48 83 c0 01          	add    $0x1,%rax
+  803015:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803018:	48 39 c8             	cmp    %rcx,%rax
+  80301b:	75 e9                	jne    803006 <strlcpy+0x12>
+        *dst = '\0';
+  80301d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803020:	48 29 f8             	sub    %rdi,%rax
+}
+  803023:	c3                   	ret
+
+0000000000803024 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803024:	0f b6 07             	movzbl (%rdi),%eax
+  803027:	84 c0                	test   %al,%al
+  803029:	74 13                	je     80303e <strcmp+0x1a>
+  80302b:	38 06                	cmp    %al,(%rsi)
+  80302d:	75 0f                	jne    80303e <strcmp+0x1a>
+  80302f:	48 83 c7 01          	add    $0x1,%rdi
+  803033:	48 83 c6 01          	add    $0x1,%rsi
+  803037:	0f b6 07             	movzbl (%rdi),%eax
+  80303a:	84 c0                	test   %al,%al
+  80303c:	75 ed                	jne    80302b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80303e:	0f b6 c0             	movzbl %al,%eax
+  803041:	0f b6 16             	movzbl (%rsi),%edx
+  803044:	29 d0                	sub    %edx,%eax
+}
+  803046:	c3                   	ret
+
+0000000000803047 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803047:	48 85 d2             	test   %rdx,%rdx
+  80304a:	74 1f                	je     80306b <strncmp+0x24>
+  80304c:	0f b6 07             	movzbl (%rdi),%eax
+  80304f:	84 c0                	test   %al,%al
+  803051:	74 1e                	je     803071 <strncmp+0x2a>
+  803053:	3a 06                	cmp    (%rsi),%al
+  803055:	75 1a                	jne    803071 <strncmp+0x2a>
+  803057:	48 83 c7 01          	add    $0x1,%rdi
+  80305b:	48 83 c6 01          	add    $0x1,%rsi
+  80305f:	48 83 ea 01          	sub    $0x1,%rdx
+  803063:	75 e7                	jne    80304c <strncmp+0x5>
+
+    if (!n) return 0;
+  803065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306a:	c3                   	ret
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803070:	c3                   	ret
+  803071:	48 85 d2             	test   %rdx,%rdx
+  803074:	74 09                	je     80307f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803076:	0f b6 07             	movzbl (%rdi),%eax
+  803079:	0f b6 16             	movzbl (%rsi),%edx
+  80307c:	29 d0                	sub    %edx,%eax
+  80307e:	c3                   	ret
+    if (!n) return 0;
+  80307f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803084:	c3                   	ret
+
+0000000000803085 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803085:	0f b6 17             	movzbl (%rdi),%edx
+  803088:	84 d2                	test   %dl,%dl
+  80308a:	74 18                	je     8030a4 <strchr+0x1f>
+        if (*str == c) {
+  80308c:	0f be d2             	movsbl %dl,%edx
+  80308f:	39 f2                	cmp    %esi,%edx
+  803091:	74 17                	je     8030aa <strchr+0x25>
+    for (; *str; str++) {
+  803093:	48 83 c7 01          	add    $0x1,%rdi
+  803097:	0f b6 17             	movzbl (%rdi),%edx
+  80309a:	84 d2                	test   %dl,%dl
+  80309c:	75 ee                	jne    80308c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80309e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a3:	c3                   	ret
+  8030a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a9:	c3                   	ret
+  8030aa:	48 89 f8             	mov    %rdi,%rax
+}
+  8030ad:	c3                   	ret
+
+00000000008030ae <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8030ae:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8030b1:	0f b6 17             	movzbl (%rdi),%edx
+  8030b4:	84 d2                	test   %dl,%dl
+  8030b6:	74 13                	je     8030cb <strfind+0x1d>
+  8030b8:	0f be d2             	movsbl %dl,%edx
+  8030bb:	39 f2                	cmp    %esi,%edx
+  8030bd:	74 0b                	je     8030ca <strfind+0x1c>
+  8030bf:	48 83 c0 01          	add    $0x1,%rax
+  8030c3:	0f b6 10             	movzbl (%rax),%edx
+  8030c6:	84 d2                	test   %dl,%dl
+  8030c8:	75 ee                	jne    8030b8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030ca:	c3                   	ret
+  8030cb:	c3                   	ret
+
+00000000008030cc <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030cc:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030cf:	48 89 f8             	mov    %rdi,%rax
+  8030d2:	48 f7 d8             	neg    %rax
+  8030d5:	83 e0 07             	and    $0x7,%eax
+  8030d8:	49 89 d1             	mov    %rdx,%r9
+  8030db:	49 29 c1             	sub    %rax,%r9
+  8030de:	78 36                	js     803116 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030e0:	40 0f b6 c6          	movzbl %sil,%eax
+  8030e4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030eb:	01 01 01 
+  8030ee:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030f2:	40 f6 c7 07          	test   $0x7,%dil
+  8030f6:	75 38                	jne    803130 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030f8:	4c 89 c9             	mov    %r9,%rcx
+  8030fb:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030ff:	74 0c                	je     80310d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803101:	fc                   	cld
+  803102:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803105:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803109:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80310d:	4d 85 c9             	test   %r9,%r9
+  803110:	75 45                	jne    803157 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803112:	4c 89 c0             	mov    %r8,%rax
+  803115:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803116:	48 85 d2             	test   %rdx,%rdx
+  803119:	74 f7                	je     803112 <memset+0x46>
+  80311b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80311e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803121:	48 83 c0 01          	add    $0x1,%rax
+  803125:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803129:	48 39 c2             	cmp    %rax,%rdx
+  80312c:	75 f3                	jne    803121 <memset+0x55>
+  80312e:	eb e2                	jmp    803112 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803130:	40 f6 c7 01          	test   $0x1,%dil
+  803134:	74 06                	je     80313c <memset+0x70>
+  803136:	88 07                	mov    %al,(%rdi)
+  803138:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80313c:	40 f6 c7 02          	test   $0x2,%dil
+  803140:	74 07                	je     803149 <memset+0x7d>
+  803142:	66 89 07             	mov    %ax,(%rdi)
+  803145:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803149:	40 f6 c7 04          	test   $0x4,%dil
+  80314d:	74 a9                	je     8030f8 <memset+0x2c>
+  80314f:	89 07                	mov    %eax,(%rdi)
+  803151:	48 83 c7 04          	add    $0x4,%rdi
+  803155:	eb a1                	jmp    8030f8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803157:	41 f6 c1 04          	test   $0x4,%r9b
+  80315b:	74 06                	je     803163 <memset+0x97>
+  80315d:	89 07                	mov    %eax,(%rdi)
+  80315f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803163:	41 f6 c1 02          	test   $0x2,%r9b
+  803167:	74 07                	je     803170 <memset+0xa4>
+  803169:	66 89 07             	mov    %ax,(%rdi)
+  80316c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803170:	41 f6 c1 01          	test   $0x1,%r9b
+  803174:	74 9c                	je     803112 <memset+0x46>
+  803176:	88 07                	mov    %al,(%rdi)
+  803178:	eb 98                	jmp    803112 <memset+0x46>
+
+000000000080317a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80317a:	48 89 f8             	mov    %rdi,%rax
+  80317d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803180:	48 39 fe             	cmp    %rdi,%rsi
+  803183:	73 3b                	jae    8031c0 <memmove+0x46>
+  803185:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803189:	48 39 d7             	cmp    %rdx,%rdi
+  80318c:	73 32                	jae    8031c0 <memmove+0x46>
+        s += n;
+        d += n;
+  80318e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803192:	48 89 d6             	mov    %rdx,%rsi
+  803195:	48 09 fe             	or     %rdi,%rsi
+  803198:	48 09 ce             	or     %rcx,%rsi
+  80319b:	40 f6 c6 07          	test   $0x7,%sil
+  80319f:	75 12                	jne    8031b3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8031a1:	48 83 ef 08          	sub    $0x8,%rdi
+  8031a5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8031a9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031ad:	fd                   	std
+  8031ae:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8031b1:	fc                   	cld
+  8031b2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8031b3:	48 83 ef 01          	sub    $0x1,%rdi
+  8031b7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8031bb:	fd                   	std
+  8031bc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8031be:	eb f1                	jmp    8031b1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8031c0:	48 89 f2             	mov    %rsi,%rdx
+  8031c3:	48 09 c2             	or     %rax,%rdx
+  8031c6:	48 09 ca             	or     %rcx,%rdx
+  8031c9:	f6 c2 07             	test   $0x7,%dl
+  8031cc:	75 0c                	jne    8031da <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031ce:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031d2:	48 89 c7             	mov    %rax,%rdi
+  8031d5:	fc                   	cld
+  8031d6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031d9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031da:	48 89 c7             	mov    %rax,%rdi
+  8031dd:	fc                   	cld
+  8031de:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031e0:	c3                   	ret
+
+00000000008031e1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031e1:	55                   	push   %rbp
+  8031e2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031e5:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  8031ec:	00 00 00 
+  8031ef:	ff d0                	call   *%rax
+}
+  8031f1:	5d                   	pop    %rbp
+  8031f2:	c3                   	ret
+
+00000000008031f3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031f3:	55                   	push   %rbp
+  8031f4:	48 89 e5             	mov    %rsp,%rbp
+  8031f7:	41 57                	push   %r15
+  8031f9:	41 56                	push   %r14
+  8031fb:	41 55                	push   %r13
+  8031fd:	41 54                	push   %r12
+  8031ff:	53                   	push   %rbx
+  803200:	48 83 ec 08          	sub    $0x8,%rsp
+  803204:	49 89 fe             	mov    %rdi,%r14
+  803207:	49 89 f7             	mov    %rsi,%r15
+  80320a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80320d:	48 89 f7             	mov    %rsi,%rdi
+  803210:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  803217:	00 00 00 
+  80321a:	ff d0                	call   *%rax
+  80321c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80321f:	48 89 de             	mov    %rbx,%rsi
+  803222:	4c 89 f7             	mov    %r14,%rdi
+  803225:	48 b8 5d 2f 80 00 00 	movabs $0x802f5d,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+  803231:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803234:	48 39 c3             	cmp    %rax,%rbx
+  803237:	74 36                	je     80326f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803239:	48 89 d8             	mov    %rbx,%rax
+  80323c:	4c 29 e8             	sub    %r13,%rax
+  80323f:	49 39 c4             	cmp    %rax,%r12
+  803242:	73 31                	jae    803275 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803244:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803249:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80324d:	4c 89 fe             	mov    %r15,%rsi
+  803250:	48 b8 e1 31 80 00 00 	movabs $0x8031e1,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80325c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803260:	48 83 c4 08          	add    $0x8,%rsp
+  803264:	5b                   	pop    %rbx
+  803265:	41 5c                	pop    %r12
+  803267:	41 5d                	pop    %r13
+  803269:	41 5e                	pop    %r14
+  80326b:	41 5f                	pop    %r15
+  80326d:	5d                   	pop    %rbp
+  80326e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80326f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803273:	eb eb                	jmp    803260 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803275:	48 83 eb 01          	sub    $0x1,%rbx
+  803279:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80327d:	48 89 da             	mov    %rbx,%rdx
+  803280:	4c 89 fe             	mov    %r15,%rsi
+  803283:	48 b8 e1 31 80 00 00 	movabs $0x8031e1,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80328f:	49 01 de             	add    %rbx,%r14
+  803292:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803297:	eb c3                	jmp    80325c <strlcat+0x69>
+
+0000000000803299 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803299:	48 85 d2             	test   %rdx,%rdx
+  80329c:	74 2d                	je     8032cb <memcmp+0x32>
+  80329e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8032a3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8032a7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8032ac:	44 38 c1             	cmp    %r8b,%cl
+  8032af:	75 0f                	jne    8032c0 <memcmp+0x27>
+    while (n-- > 0) {
+  8032b1:	48 83 c0 01          	add    $0x1,%rax
+  8032b5:	48 39 c2             	cmp    %rax,%rdx
+  8032b8:	75 e9                	jne    8032a3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8032ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bf:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8032c0:	0f b6 c1             	movzbl %cl,%eax
+  8032c3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8032c7:	44 29 c0             	sub    %r8d,%eax
+  8032ca:	c3                   	ret
+    return 0;
+  8032cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d0:	c3                   	ret
+
+00000000008032d1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032d1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032d5:	48 39 c7             	cmp    %rax,%rdi
+  8032d8:	73 0f                	jae    8032e9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032da:	40 38 37             	cmp    %sil,(%rdi)
+  8032dd:	74 0e                	je     8032ed <memfind+0x1c>
+    for (; src < end; src++) {
+  8032df:	48 83 c7 01          	add    $0x1,%rdi
+  8032e3:	48 39 f8             	cmp    %rdi,%rax
+  8032e6:	75 f2                	jne    8032da <memfind+0x9>
+  8032e8:	c3                   	ret
+  8032e9:	48 89 f8             	mov    %rdi,%rax
+  8032ec:	c3                   	ret
+  8032ed:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032f0:	c3                   	ret
+
+00000000008032f1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032f1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032f4:	0f b6 37             	movzbl (%rdi),%esi
+  8032f7:	40 80 fe 20          	cmp    $0x20,%sil
+  8032fb:	74 06                	je     803303 <strtol+0x12>
+  8032fd:	40 80 fe 09          	cmp    $0x9,%sil
+  803301:	75 13                	jne    803316 <strtol+0x25>
+  803303:	48 83 c7 01          	add    $0x1,%rdi
+  803307:	0f b6 37             	movzbl (%rdi),%esi
+  80330a:	40 80 fe 20          	cmp    $0x20,%sil
+  80330e:	74 f3                	je     803303 <strtol+0x12>
+  803310:	40 80 fe 09          	cmp    $0x9,%sil
+  803314:	74 ed                	je     803303 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803316:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803319:	83 e0 fd             	and    $0xfffffffd,%eax
+  80331c:	3c 01                	cmp    $0x1,%al
+  80331e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803322:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803328:	75 0f                	jne    803339 <strtol+0x48>
+  80332a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80332d:	74 14                	je     803343 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80332f:	85 d2                	test   %edx,%edx
+  803331:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803336:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803339:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80333e:	4c 63 ca             	movslq %edx,%r9
+  803341:	eb 36                	jmp    803379 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803343:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803347:	74 0f                	je     803358 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803349:	85 d2                	test   %edx,%edx
+  80334b:	75 ec                	jne    803339 <strtol+0x48>
+        s++;
+  80334d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803351:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803356:	eb e1                	jmp    803339 <strtol+0x48>
+        s += 2;
+  803358:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80335c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803361:	eb d6                	jmp    803339 <strtol+0x48>
+            dig -= '0';
+  803363:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803366:	44 0f b6 c1          	movzbl %cl,%r8d
+  80336a:	41 39 d0             	cmp    %edx,%r8d
+  80336d:	7d 21                	jge    803390 <strtol+0x9f>
+        val = val * base + dig;
+  80336f:	49 0f af c1          	imul   %r9,%rax
+  803373:	0f b6 c9             	movzbl %cl,%ecx
+  803376:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803379:	48 83 c7 01          	add    $0x1,%rdi
+  80337d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803381:	80 f9 39             	cmp    $0x39,%cl
+  803384:	76 dd                	jbe    803363 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803386:	80 f9 7b             	cmp    $0x7b,%cl
+  803389:	77 05                	ja     803390 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80338b:	83 e9 57             	sub    $0x57,%ecx
+  80338e:	eb d6                	jmp    803366 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803390:	4d 85 d2             	test   %r10,%r10
+  803393:	74 03                	je     803398 <strtol+0xa7>
+  803395:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803398:	48 89 c2             	mov    %rax,%rdx
+  80339b:	48 f7 da             	neg    %rdx
+  80339e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8033a2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8033a6:	c3                   	ret
+
+00000000008033a7 <strrev>:
+
+void
+strrev(char *str)
+{
+  8033a7:	55                   	push   %rbp
+  8033a8:	48 89 e5             	mov    %rsp,%rbp
+  8033ab:	53                   	push   %rbx
+  8033ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b0:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8033b3:	48 b8 42 2f 80 00 00 	movabs $0x802f42,%rax
+  8033ba:	00 00 00 
+  8033bd:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033bf:	83 e8 01             	sub    $0x1,%eax
+  8033c2:	85 c0                	test   %eax,%eax
+  8033c4:	7e 22                	jle    8033e8 <strrev+0x41>
+  8033c6:	48 98                	cltq
+  8033c8:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033cd:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033d1:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033d5:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033d9:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033dc:	48 83 c2 01          	add    $0x1,%rdx
+  8033e0:	48 83 e8 01          	sub    $0x1,%rax
+  8033e4:	39 c2                	cmp    %eax,%edx
+  8033e6:	7c e5                	jl     8033cd <strrev+0x26>
+	}
+}
+  8033e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ec:	c9                   	leave
+  8033ed:	c3                   	ret
+
+00000000008033ee <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033ee:	85 d2                	test   %edx,%edx
+  8033f0:	0f 84 80 00 00 00    	je     803476 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033f6:	55                   	push   %rbp
+  8033f7:	48 89 e5             	mov    %rsp,%rbp
+  8033fa:	53                   	push   %rbx
+  8033fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ff:	49 89 f2             	mov    %rsi,%r10
+  803402:	41 89 d3             	mov    %edx,%r11d
+  803405:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  803408:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80340d:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  803410:	eb 20                	jmp    803432 <itoa+0x44>
+			str[i++] = '0' + digit;
+  803412:	41 89 f1             	mov    %esi,%r9d
+  803415:	83 c2 30             	add    $0x30,%edx
+  803418:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80341b:	89 f8                	mov    %edi,%eax
+  80341d:	99                   	cltd
+  80341e:	f7 f9                	idiv   %ecx
+  803420:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  803422:	85 c0                	test   %eax,%eax
+  803424:	74 2e                	je     803454 <itoa+0x66>
+  803426:	83 c6 01             	add    $0x1,%esi
+  803429:	49 83 c0 01          	add    $0x1,%r8
+  80342d:	44 39 cb             	cmp    %r9d,%ebx
+  803430:	7e 15                	jle    803447 <itoa+0x59>
+		digit = sum % base;
+  803432:	89 f8                	mov    %edi,%eax
+  803434:	99                   	cltd
+  803435:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  803437:	83 fa 09             	cmp    $0x9,%edx
+  80343a:	7e d6                	jle    803412 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80343c:	41 89 f1             	mov    %esi,%r9d
+  80343f:	83 c2 37             	add    $0x37,%edx
+  803442:	41 88 10             	mov    %dl,(%r8)
+  803445:	eb d4                	jmp    80341b <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  803447:	41 83 eb 01          	sub    $0x1,%r11d
+  80344b:	45 39 cb             	cmp    %r9d,%r11d
+  80344e:	75 04                	jne    803454 <itoa+0x66>
+  803450:	85 c0                	test   %eax,%eax
+  803452:	75 28                	jne    80347c <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  803454:	4d 63 c9             	movslq %r9d,%r9
+  803457:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80345c:	4c 89 d7             	mov    %r10,%rdi
+  80345f:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+	return 0;
+  80346b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803470:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803474:	c9                   	leave
+  803475:	c3                   	ret
+		return -1;
+  803476:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80347b:	c3                   	ret
+		return -1;
+  80347c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803481:	eb ed                	jmp    803470 <itoa+0x82>
+
+0000000000803483 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803483:	55                   	push   %rbp
+  803484:	48 89 e5             	mov    %rsp,%rbp
+  803487:	41 55                	push   %r13
+  803489:	41 54                	push   %r12
+  80348b:	53                   	push   %rbx
+  80348c:	48 83 ec 08          	sub    $0x8,%rsp
+  803490:	49 89 fc             	mov    %rdi,%r12
+  803493:	48 89 f7             	mov    %rsi,%rdi
+  803496:	48 89 d3             	mov    %rdx,%rbx
+  803499:	49 89 cd             	mov    %rcx,%r13
+  80349c:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80349f:	48 85 f6             	test   %rsi,%rsi
+  8034a2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034a9:	00 00 00 
+  8034ac:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034b5:	48 85 db             	test   %rbx,%rbx
+  8034b8:	74 03                	je     8034bd <ipc_recv_timed+0x3a>
+  8034ba:	48 8b 33             	mov    (%rbx),%rsi
+  8034bd:	48 b8 44 05 80 00 00 	movabs $0x800544,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	78 75                	js     803542 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034cd:	4d 85 e4             	test   %r12,%r12
+  8034d0:	74 14                	je     8034e6 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034d2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d9:	00 00 00 
+  8034dc:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034e2:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034e6:	4d 85 ed             	test   %r13,%r13
+  8034e9:	74 14                	je     8034ff <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034eb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034f2:	00 00 00 
+  8034f5:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034fb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034ff:	48 85 db             	test   %rbx,%rbx
+  803502:	74 23                	je     803527 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803504:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80350b:	00 00 00 
+  80350e:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803514:	ba 00 00 00 00       	mov    $0x0,%edx
+  803519:	85 c9                	test   %ecx,%ecx
+  80351b:	74 07                	je     803524 <ipc_recv_timed+0xa1>
+  80351d:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803524:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803527:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80352e:	00 00 00 
+  803531:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803537:	48 83 c4 08          	add    $0x8,%rsp
+  80353b:	5b                   	pop    %rbx
+  80353c:	41 5c                	pop    %r12
+  80353e:	41 5d                	pop    %r13
+  803540:	5d                   	pop    %rbp
+  803541:	c3                   	ret
+        if (from_env_store != NULL) {
+  803542:	4d 85 e4             	test   %r12,%r12
+  803545:	74 08                	je     80354f <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803547:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80354e:	00 
+        if (perm_store != NULL) {
+  80354f:	4d 85 ed             	test   %r13,%r13
+  803552:	74 08                	je     80355c <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803554:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80355b:	00 
+        if (size != NULL) {
+  80355c:	48 85 db             	test   %rbx,%rbx
+  80355f:	74 d6                	je     803537 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803561:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803568:	eb cd                	jmp    803537 <ipc_recv_timed+0xb4>
+
+000000000080356a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80356a:	55                   	push   %rbp
+  80356b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80356e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803574:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+}
+  803580:	5d                   	pop    %rbp
+  803581:	c3                   	ret
+
+0000000000803582 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803582:	55                   	push   %rbp
+  803583:	48 89 e5             	mov    %rsp,%rbp
+  803586:	41 57                	push   %r15
+  803588:	41 56                	push   %r14
+  80358a:	41 55                	push   %r13
+  80358c:	41 54                	push   %r12
+  80358e:	53                   	push   %rbx
+  80358f:	48 83 ec 18          	sub    $0x18,%rsp
+  803593:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803596:	48 89 d3             	mov    %rdx,%rbx
+  803599:	49 89 cc             	mov    %rcx,%r12
+  80359c:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80359f:	48 85 d2             	test   %rdx,%rdx
+  8035a2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035a9:	00 00 00 
+  8035ac:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035b0:	89 f0                	mov    %esi,%eax
+  8035b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035b6:	48 89 da             	mov    %rbx,%rdx
+  8035b9:	48 89 c6             	mov    %rax,%rsi
+  8035bc:	48 b8 18 05 80 00 00 	movabs $0x800518,%rax
+  8035c3:	00 00 00 
+  8035c6:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	79 65                	jns    803631 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035cc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035cf:	75 33                	jne    803604 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035d1:	49 bf 1b 02 80 00 00 	movabs $0x80021b,%r15
+  8035d8:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035db:	49 be 18 05 80 00 00 	movabs $0x800518,%r14
+  8035e2:	00 00 00 
+        sys_yield();
+  8035e5:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035e8:	45 89 e8             	mov    %r13d,%r8d
+  8035eb:	4c 89 e1             	mov    %r12,%rcx
+  8035ee:	48 89 da             	mov    %rbx,%rdx
+  8035f1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035f5:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035f8:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	79 32                	jns    803631 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035ff:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803602:	74 e1                	je     8035e5 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803604:	89 c1                	mov    %eax,%ecx
+  803606:	48 ba 47 3d 80 00 00 	movabs $0x803d47,%rdx
+  80360d:	00 00 00 
+  803610:	be 52 00 00 00       	mov    $0x52,%esi
+  803615:	48 bf 5b 3d 80 00 00 	movabs $0x803d5b,%rdi
+  80361c:	00 00 00 
+  80361f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803624:	49 b8 0b 25 80 00 00 	movabs $0x80250b,%r8
+  80362b:	00 00 00 
+  80362e:	41 ff d0             	call   *%r8
+    }
+}
+  803631:	48 83 c4 18          	add    $0x18,%rsp
+  803635:	5b                   	pop    %rbx
+  803636:	41 5c                	pop    %r12
+  803638:	41 5d                	pop    %r13
+  80363a:	41 5e                	pop    %r14
+  80363c:	41 5f                	pop    %r15
+  80363e:	5d                   	pop    %rbp
+  80363f:	c3                   	ret
+
+0000000000803640 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803640:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803645:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80364c:	00 00 00 
+  80364f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803653:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803657:	48 c1 e2 04          	shl    $0x4,%rdx
+  80365b:	48 01 ca             	add    %rcx,%rdx
+  80365e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803664:	39 fa                	cmp    %edi,%edx
+  803666:	74 12                	je     80367a <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803668:	48 83 c0 01          	add    $0x1,%rax
+  80366c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803672:	75 db                	jne    80364f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803674:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803679:	c3                   	ret
+            return envs[i].env_id;
+  80367a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80367e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803682:	48 c1 e2 04          	shl    $0x4,%rdx
+  803686:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80368d:	00 00 00 
+  803690:	48 01 d0             	add    %rdx,%rax
+  803693:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803699:	c3                   	ret
+  80369a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008036a0 <__rodata_start>:
+  8036a0:	69 64 6c 65 00 3c 75 	imul   $0x6e753c00,0x65(%rsp,%rbp,2),%esp
+  8036a7:	6e 
+  8036a8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ad:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  8036b4:	61                   	(bad)
+  8036b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b37 <__bss_end+0x72201b37>
+  8036bd:	65 74 75             	gs je  803735 <__rodata_start+0x95>
+  8036c0:	72 6e                	jb     803730 <__rodata_start+0x90>
+  8036c2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b44 <__bss_end+0x28201b44>
+  8036c9:	28 
+  8036ca:	3e 20 30             	ds and %dh,(%rax)
+  8036cd:	29 00                	sub    %eax,(%rax)
+  8036cf:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036d7:	61                   	(bad)
+  8036d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036da:	2e 63 00             	cs movsxd (%rax),%eax
+  8036dd:	0f 1f 00             	nopl   (%rax)
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036e6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036e9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ee:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036f2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036f9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 804164 <devcons+0x4>
+  803700:	5b                   	pop    %rbx
+  803701:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803706:	20 72 65             	and    %dh,0x65(%rdx)
+  803709:	61                   	(bad)
+  80370a:	64 6d                	fs insl (%dx),%es:(%rdi)
+  80370c:	61                   	(bad)
+  80370d:	70 20                	jo     80372f <__rodata_start+0x8f>
+  80370f:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  803714:	20 62 61             	and    %ah,0x61(%rdx)
+  803717:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80371b:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80371f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803722:	30 38                	xor    %bh,(%rax)
+  803724:	78 5d                	js     803783 <devtab+0x3>
+  803726:	20 66 74             	and    %ah,0x74(%rsi)
+  803729:	72 75                	jb     8037a0 <devtab+0x20>
+  80372b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80372c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80372f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad579a <__bss_end+0x2d2cd79a>
+  803736:	20 62 61             	and    %ah,0x61(%rdx)
+  803739:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80373d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803741:	5b                   	pop    %rbx
+  803742:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803747:	20 72 65             	and    %dh,0x65(%rdx)
+  80374a:	61                   	(bad)
+  80374b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad57b6 <__bss_end+0x2d2cd7b6>
+  803752:	20 62 61             	and    %ah,0x61(%rdx)
+  803755:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803759:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80375d:	5b                   	pop    %rbx
+  80375e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803763:	20 77 72             	and    %dh,0x72(%rdi)
+  803766:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80376d:	2d 
+  80376e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803773:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803776:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80377a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803780 <devtab>:
+  803780:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803790:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  8037a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8038a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8038b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8039a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8039b0:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039c0:	48 28 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     H(..............
+  8039d0:	79 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     y...............
+  8039e0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  8039f0:	89 2e 80 00 00 00 00 00 67 28 80 00 00 00 00 00     ........g(......
+  803a00:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803a10:	5b 28 80 00 00 00 00 00 d5 28 80 00 00 00 00 00     [(.......(......
+  803a20:	89 2e 80 00 00 00 00 00 5b 28 80 00 00 00 00 00     ........[(......
+  803a30:	a1 28 80 00 00 00 00 00 a1 28 80 00 00 00 00 00     .(.......(......
+  803a40:	a1 28 80 00 00 00 00 00 a1 28 80 00 00 00 00 00     .(.......(......
+  803a50:	a1 28 80 00 00 00 00 00 a1 28 80 00 00 00 00 00     .(.......(......
+  803a60:	a1 28 80 00 00 00 00 00 a1 28 80 00 00 00 00 00     .(.......(......
+  803a70:	a1 28 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     .(..............
+  803a80:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803a90:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803aa0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803ab0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803ac0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803ad0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803ae0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803af0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b00:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b10:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b20:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b30:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b40:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b50:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b60:	89 2e 80 00 00 00 00 00 ac 2d 80 00 00 00 00 00     .........-......
+  803b70:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b80:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803b90:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803ba0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803bb0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803bc0:	f8 28 80 00 00 00 00 00 c7 2a 80 00 00 00 00 00     .(.......*......
+  803bd0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803be0:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803bf0:	27 29 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ')..............
+  803c00:	89 2e 80 00 00 00 00 00 ed 28 80 00 00 00 00 00     .........(......
+  803c10:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803c20:	6f 2c 80 00 00 00 00 00 39 2d 80 00 00 00 00 00     o,......9-......
+  803c30:	89 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     ................
+  803c40:	be 29 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     .)..............
+  803c50:	9b 2b 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     .+..............
+  803c60:	89 2e 80 00 00 00 00 00 ac 2d 80 00 00 00 00 00     .........-......
+  803c70:	89 2e 80 00 00 00 00 00 51 28 80 00 00 00 00 00     ........Q(......
+
+0000000000803c80 <error_string>:
+	...
+  803c88:	55 38 80 00 00 00 00 00 67 38 80 00 00 00 00 00     U8......g8......
+  803c98:	77 38 80 00 00 00 00 00 89 38 80 00 00 00 00 00     w8.......8......
+  803ca8:	97 38 80 00 00 00 00 00 ab 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	c0 38 80 00 00 00 00 00 d3 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	e5 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803cd8:	09 39 80 00 00 00 00 00 1c 39 80 00 00 00 00 00     .9.......9......
+  803ce8:	33 39 80 00 00 00 00 00 49 39 80 00 00 00 00 00     39......I9......
+  803cf8:	61 39 80 00 00 00 00 00 79 39 80 00 00 00 00 00     a9......y9......
+  803d08:	86 39 80 00 00 00 00 00 28 3d 80 00 00 00 00 00     .9......(=......
+  803d18:	9a 39 80 00 00 00 00 00 b2 39 80 00 00 00 00 00     .9.......9......
+  803d28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d48:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d58:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff8:	00 0f 1f 80 00 00 00 00                             ........
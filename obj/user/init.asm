@@ -0,0 +1,8080 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 42 05 00 00       	call   800565 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  800025:	85 f6                	test   %esi,%esi
+  800027:	7e 22                	jle    80004b <sum+0x26>
+  800029:	48 63 f6             	movslq %esi,%rsi
+  80002c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  800031:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  800036:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  80003a:	0f af d0             	imul   %eax,%edx
+  80003d:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80003f:	48 83 c0 01          	add    $0x1,%rax
+  800043:	48 39 f0             	cmp    %rsi,%rax
+  800046:	75 ee                	jne    800036 <sum+0x11>
+    return tot;
+}
+  800048:	89 c8                	mov    %ecx,%eax
+  80004a:	c3                   	ret
+    int i, tot = 0;
+  80004b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  800050:	eb f6                	jmp    800048 <sum+0x23>
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  800066:	41 89 fc             	mov    %edi,%r12d
+  800069:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  80006c:	48 bf 58 43 80 00 00 	movabs $0x804358,%rdi
+  800073:	00 00 00 
+  800076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007b:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  800082:	00 00 00 
+  800085:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  800087:	be 70 17 00 00       	mov    $0x1770,%esi
+  80008c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800093:	00 00 00 
+  800096:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  8000a7:	0f 84 64 01 00 00    	je     800211 <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000ad:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	48 bf 20 44 80 00 00 	movabs $0x804420,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  8000ca:	00 00 00 
+  8000cd:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8000cf:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000d4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8000db:	00 00 00 
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 84 3f 01 00 00    	je     800231 <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	48 bf 60 44 80 00 00 	movabs $0x804460,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  80010f:	48 be 94 43 80 00 00 	movabs $0x804394,%rsi
+  800116:	00 00 00 
+  800119:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800120:	48 b8 c3 10 80 00 00 	movabs $0x8010c3,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  80012c:	45 85 e4             	test   %r12d,%r12d
+  80012f:	7e 59                	jle    80018a <umain+0x138>
+  800131:	4c 89 eb             	mov    %r13,%rbx
+  800134:	4d 63 e4             	movslq %r12d,%r12
+  800137:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  80013c:	49 be a0 43 80 00 00 	movabs $0x8043a0,%r14
+  800143:	00 00 00 
+  800146:	49 bc c3 10 80 00 00 	movabs $0x8010c3,%r12
+  80014d:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  800150:	49 bd a1 43 80 00 00 	movabs $0x8043a1,%r13
+  800157:	00 00 00 
+        strcat(args, " '");
+  80015a:	4c 89 f6             	mov    %r14,%rsi
+  80015d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800164:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  800167:	48 8b 33             	mov    (%rbx),%rsi
+  80016a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800171:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  800174:	4c 89 ee             	mov    %r13,%rsi
+  800177:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80017e:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  800181:	48 83 c3 08          	add    $0x8,%rbx
+  800185:	4c 39 fb             	cmp    %r15,%rbx
+  800188:	75 d0                	jne    80015a <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  80018a:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  800191:	48 bf a3 43 80 00 00 	movabs $0x8043a3,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	48 bb 86 07 80 00 00 	movabs $0x800786,%rbx
+  8001a7:	00 00 00 
+  8001aa:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  8001ac:	48 bf a7 43 80 00 00 	movabs $0x8043a7,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8001ce:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 73                	js     800251 <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8001de:	0f 84 9a 00 00 00    	je     80027e <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	48 ba d2 43 80 00 00 	movabs $0x8043d2,%rdx
+  8001ed:	00 00 00 
+  8001f0:	be 36 00 00 00       	mov    $0x36,%esi
+  8001f5:	48 bf c6 43 80 00 00 	movabs $0x8043c6,%rdi
+  8001fc:	00 00 00 
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  80020b:	00 00 00 
+  80020e:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  800211:	48 bf 67 43 80 00 00 	movabs $0x804367,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+  80022c:	e9 9e fe ff ff       	jmp    8000cf <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  800231:	48 bf 7e 43 80 00 00 	movabs $0x80437e,%rdi
+  800238:	00 00 00 
+  80023b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800240:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  800247:	00 00 00 
+  80024a:	ff d2                	call   *%rdx
+  80024c:	e9 be fe ff ff       	jmp    80010f <umain+0xbd>
+        panic("opencons: %i", r);
+  800251:	89 c1                	mov    %eax,%ecx
+  800253:	48 ba b9 43 80 00 00 	movabs $0x8043b9,%rdx
+  80025a:	00 00 00 
+  80025d:	be 34 00 00 00       	mov    $0x34,%esi
+  800262:	48 bf c6 43 80 00 00 	movabs $0x8043c6,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  800278:	00 00 00 
+  80027b:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 00 00 00 00       	mov    $0x0,%edi
+  800288:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("init: starting sh\n");
+  800294:	49 be f4 43 80 00 00 	movabs $0x8043f4,%r14
+  80029b:	00 00 00 
+  80029e:	48 bb 86 07 80 00 00 	movabs $0x800786,%rbx
+  8002a5:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  8002a8:	49 bd 08 44 80 00 00 	movabs $0x804408,%r13
+  8002af:	00 00 00 
+  8002b2:	49 bc 07 44 80 00 00 	movabs $0x804407,%r12
+  8002b9:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	79 40                	jns    800300 <umain+0x2ae>
+        panic("dup: %i", r);
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 ba ec 43 80 00 00 	movabs $0x8043ec,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d1:	48 bf c6 43 80 00 00 	movabs $0x8043c6,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  8002e7:	00 00 00 
+  8002ea:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8002ed:	89 c6                	mov    %eax,%esi
+  8002ef:	48 bf 0b 44 80 00 00 	movabs $0x80440b,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	ff d3                	call   *%rbx
+        cprintf("init: starting sh\n");
+  800300:	4c 89 f7             	mov    %r14,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	4c 89 ee             	mov    %r13,%rsi
+  800312:	4c 89 e7             	mov    %r12,%rdi
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	48 b9 b2 38 80 00 00 	movabs $0x8038b2,%rcx
+  800321:	00 00 00 
+  800324:	ff d1                	call   *%rcx
+        if (r < 0) {
+  800326:	85 c0                	test   %eax,%eax
+  800328:	78 c3                	js     8002ed <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  80032a:	89 c7                	mov    %eax,%edi
+  80032c:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb c6                	jmp    800300 <umain+0x2ae>
+
+000000000080033a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	c3                   	ret
+
+0000000000800340 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800347:	48 be 8f 44 80 00 00 	movabs $0x80448f,%rsi
+  80034e:	00 00 00 
+  800351:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+    return 0;
+}
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800378:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80037f:	48 85 d2             	test   %rdx,%rdx
+  800382:	74 7a                	je     8003fe <devcons_write+0x9a>
+  800384:	49 89 d6             	mov    %rdx,%r14
+  800387:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800392:	49 bf a5 12 80 00 00 	movabs $0x8012a5,%r15
+  800399:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80039c:	4c 89 f3             	mov    %r14,%rbx
+  80039f:	48 29 f3             	sub    %rsi,%rbx
+  8003a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8003a7:	48 39 c3             	cmp    %rax,%rbx
+  8003aa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8003ae:	4c 63 eb             	movslq %ebx,%r13
+  8003b1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8003b8:	48 01 c6             	add    %rax,%rsi
+  8003bb:	4c 89 ea             	mov    %r13,%rdx
+  8003be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003c5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8003c8:	4c 89 ee             	mov    %r13,%rsi
+  8003cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003d2:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8003de:	41 01 dc             	add    %ebx,%r12d
+  8003e1:	49 63 f4             	movslq %r12d,%rsi
+  8003e4:	4c 39 f6             	cmp    %r14,%rsi
+  8003e7:	72 b3                	jb     80039c <devcons_write+0x38>
+    return res;
+  8003e9:	49 63 c4             	movslq %r12d,%rax
+}
+  8003ec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8003f3:	5b                   	pop    %rbx
+  8003f4:	41 5c                	pop    %r12
+  8003f6:	41 5d                	pop    %r13
+  8003f8:	41 5e                	pop    %r14
+  8003fa:	41 5f                	pop    %r15
+  8003fc:	5d                   	pop    %rbp
+  8003fd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8003fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800404:	eb e3                	jmp    8003e9 <devcons_write+0x85>
+
+0000000000800406 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800406:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	48 85 c0             	test   %rax,%rax
+  800411:	74 55                	je     800468 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 08          	sub    $0x8,%rsp
+  800420:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800423:	48 bb db 15 80 00 00 	movabs $0x8015db,%rbx
+  80042a:	00 00 00 
+  80042d:	49 bc a8 16 80 00 00 	movabs $0x8016a8,%r12
+  800434:	00 00 00 
+  800437:	eb 03                	jmp    80043c <devcons_read+0x36>
+  800439:	41 ff d4             	call   *%r12
+  80043c:	ff d3                	call   *%rbx
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	74 f7                	je     800439 <devcons_read+0x33>
+    if (c < 0) return c;
+  800442:	48 63 d0             	movslq %eax,%rdx
+  800445:	78 13                	js     80045a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	83 f8 04             	cmp    $0x4,%eax
+  80044f:	74 09                	je     80045a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800451:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800455:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80045a:	48 89 d0             	mov    %rdx,%rax
+  80045d:	48 83 c4 08          	add    $0x8,%rsp
+  800461:	5b                   	pop    %rbx
+  800462:	41 5c                	pop    %r12
+  800464:	41 5d                	pop    %r13
+  800466:	5d                   	pop    %rbp
+  800467:	c3                   	ret
+  800468:	48 89 d0             	mov    %rdx,%rax
+  80046b:	c3                   	ret
+
+000000000080046c <cputchar>:
+cputchar(int ch) {
+  80046c:	55                   	push   %rbp
+  80046d:	48 89 e5             	mov    %rsp,%rbp
+  800470:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800474:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800478:	be 01 00 00 00       	mov    $0x1,%esi
+  80047d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800481:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+}
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+000000000080048f <getchar>:
+getchar(void) {
+  80048f:	55                   	push   %rbp
+  800490:	48 89 e5             	mov    %rsp,%rbp
+  800493:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800497:	ba 01 00 00 00       	mov    $0x1,%edx
+  80049c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a5:	48 b8 78 1e 80 00 00 	movabs $0x801e78,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  8004b1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	78 06                	js     8004bd <getchar+0x2e>
+  8004b7:	74 08                	je     8004c1 <getchar+0x32>
+  8004b9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8004bd:	89 d0                	mov    %edx,%eax
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8004c1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8004c6:	eb f5                	jmp    8004bd <getchar+0x2e>
+
+00000000008004c8 <iscons>:
+iscons(int fdnum) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8004d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8004d4:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	78 18                	js     8004fc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8004e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e8:	48 b8 80 67 80 00 00 	movabs $0x806780,%rax
+  8004ef:	00 00 00 
+  8004f2:	8b 00                	mov    (%rax),%eax
+  8004f4:	39 02                	cmp    %eax,(%rdx)
+  8004f6:	0f 94 c0             	sete   %al
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <opencons>:
+opencons(void) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800506:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80050a:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+  800516:	85 c0                	test   %eax,%eax
+  800518:	78 49                	js     800563 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80051a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80051f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800524:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80052d:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+  800539:	85 c0                	test   %eax,%eax
+  80053b:	78 26                	js     800563 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80053d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800541:	a1 80 67 80 00 00 00 	movabs 0x806780,%eax
+  800548:	00 00 
+  80054a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80054c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800550:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800557:	48 b8 07 1b 80 00 00 	movabs $0x801b07,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 56                	push   %r14
+  80056b:	41 55                	push   %r13
+  80056d:	41 54                	push   %r12
+  80056f:	53                   	push   %rbx
+  800570:	41 89 fd             	mov    %edi,%r13d
+  800573:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800576:	48 ba 58 69 80 00 00 	movabs $0x806958,%rdx
+  80057d:	00 00 00 
+  800580:	48 b8 58 69 80 00 00 	movabs $0x806958,%rax
+  800587:	00 00 00 
+  80058a:	48 39 c2             	cmp    %rax,%rdx
+  80058d:	73 17                	jae    8005a6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80058f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800592:	49 89 c4             	mov    %rax,%r12
+  800595:	48 83 c3 08          	add    $0x8,%rbx
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	ff 53 f8             	call   *-0x8(%rbx)
+  8005a1:	4c 39 e3             	cmp    %r12,%rbx
+  8005a4:	72 ef                	jb     800595 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005a6:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+  8005b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005b7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8005bb:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8005bf:	48 c1 e0 04          	shl    $0x4,%rax
+  8005c3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8005ca:	00 00 00 
+  8005cd:	48 01 d0             	add    %rdx,%rax
+  8005d0:	48 a3 70 87 80 00 00 	movabs %rax,0x808770
+  8005d7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005da:	45 85 ed             	test   %r13d,%r13d
+  8005dd:	7e 0d                	jle    8005ec <libmain+0x87>
+  8005df:	49 8b 06             	mov    (%r14),%rax
+  8005e2:	48 a3 18 68 80 00 00 	movabs %rax,0x806818
+  8005e9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005ec:	4c 89 f6             	mov    %r14,%rsi
+  8005ef:	44 89 ef             	mov    %r13d,%edi
+  8005f2:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8005f9:	00 00 00 
+  8005fc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8005fe:	48 b8 13 06 80 00 00 	movabs $0x800613,%rax
+  800605:	00 00 00 
+  800608:	ff d0                	call   *%rax
+#endif
+}
+  80060a:	5b                   	pop    %rbx
+  80060b:	41 5c                	pop    %r12
+  80060d:	41 5d                	pop    %r13
+  80060f:	41 5e                	pop    %r14
+  800611:	5d                   	pop    %rbp
+  800612:	c3                   	ret
+
+0000000000800613 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800613:	55                   	push   %rbp
+  800614:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800617:	48 b8 2d 1d 80 00 00 	movabs $0x801d2d,%rax
+  80061e:	00 00 00 
+  800621:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800623:	bf 00 00 00 00       	mov    $0x0,%edi
+  800628:	48 b8 0c 16 80 00 00 	movabs $0x80160c,%rax
+  80062f:	00 00 00 
+  800632:	ff d0                	call   *%rax
+}
+  800634:	5d                   	pop    %rbp
+  800635:	c3                   	ret
+
+0000000000800636 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800636:	55                   	push   %rbp
+  800637:	48 89 e5             	mov    %rsp,%rbp
+  80063a:	41 56                	push   %r14
+  80063c:	41 55                	push   %r13
+  80063e:	41 54                	push   %r12
+  800640:	53                   	push   %rbx
+  800641:	48 83 ec 50          	sub    $0x50,%rsp
+  800645:	49 89 fc             	mov    %rdi,%r12
+  800648:	41 89 f5             	mov    %esi,%r13d
+  80064b:	48 89 d3             	mov    %rdx,%rbx
+  80064e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800652:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800656:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80065a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800661:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800665:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800669:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80066d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800671:	48 b8 18 68 80 00 00 	movabs $0x806818,%rax
+  800678:	00 00 00 
+  80067b:	4c 8b 30             	mov    (%rax),%r14
+  80067e:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  800685:	00 00 00 
+  800688:	ff d0                	call   *%rax
+  80068a:	89 c6                	mov    %eax,%esi
+  80068c:	45 89 e8             	mov    %r13d,%r8d
+  80068f:	4c 89 e1             	mov    %r12,%rcx
+  800692:	4c 89 f2             	mov    %r14,%rdx
+  800695:	48 bf a8 44 80 00 00 	movabs $0x8044a8,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	49 bc 86 07 80 00 00 	movabs $0x800786,%r12
+  8006ab:	00 00 00 
+  8006ae:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006b1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006b5:	48 89 df             	mov    %rbx,%rdi
+  8006b8:	48 b8 22 07 80 00 00 	movabs $0x800722,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006c4:	48 bf b3 4a 80 00 00 	movabs $0x804ab3,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006d6:	cc                   	int3
+  8006d7:	eb fd                	jmp    8006d6 <_panic+0xa0>
+
+00000000008006d9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006d9:	55                   	push   %rbp
+  8006da:	48 89 e5             	mov    %rsp,%rbp
+  8006dd:	53                   	push   %rbx
+  8006de:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006e5:	8b 06                	mov    (%rsi),%eax
+  8006e7:	8d 50 01             	lea    0x1(%rax),%edx
+  8006ea:	89 16                	mov    %edx,(%rsi)
+  8006ec:	48 98                	cltq
+  8006ee:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8006f3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006f9:	74 0a                	je     800705 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8006fb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8006ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800705:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800709:	be ff 00 00 00       	mov    $0xff,%esi
+  80070e:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  800715:	00 00 00 
+  800718:	ff d0                	call   *%rax
+        state->offset = 0;
+  80071a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800720:	eb d9                	jmp    8006fb <putch+0x22>
+
+0000000000800722 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800722:	55                   	push   %rbp
+  800723:	48 89 e5             	mov    %rsp,%rbp
+  800726:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80072d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800730:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800737:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800744:	48 89 f1             	mov    %rsi,%rcx
+  800747:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80074e:	48 bf d9 06 80 00 00 	movabs $0x8006d9,%rdi
+  800755:	00 00 00 
+  800758:	48 b8 d6 08 80 00 00 	movabs $0x8008d6,%rax
+  80075f:	00 00 00 
+  800762:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800764:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80076b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800772:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  800779:	00 00 00 
+  80077c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80077e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+
+0000000000800786 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800786:	55                   	push   %rbp
+  800787:	48 89 e5             	mov    %rsp,%rbp
+  80078a:	48 83 ec 50          	sub    $0x50,%rsp
+  80078e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800792:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800796:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80079a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80079e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007a2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007b9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007bd:	48 b8 22 07 80 00 00 	movabs $0x800722,%rax
+  8007c4:	00 00 00 
+  8007c7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+
+00000000008007cb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007cb:	55                   	push   %rbp
+  8007cc:	48 89 e5             	mov    %rsp,%rbp
+  8007cf:	41 57                	push   %r15
+  8007d1:	41 56                	push   %r14
+  8007d3:	41 55                	push   %r13
+  8007d5:	41 54                	push   %r12
+  8007d7:	53                   	push   %rbx
+  8007d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8007dc:	49 89 fc             	mov    %rdi,%r12
+  8007df:	49 89 f5             	mov    %rsi,%r13
+  8007e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007e6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007e9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8007ec:	41 89 cf             	mov    %ecx,%r15d
+  8007ef:	4c 39 fa             	cmp    %r15,%rdx
+  8007f2:	73 5b                	jae    80084f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8007f4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8007f8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8007fc:	85 db                	test   %ebx,%ebx
+  8007fe:	7e 0e                	jle    80080e <print_num+0x43>
+            putch(padc, put_arg);
+  800800:	4c 89 ee             	mov    %r13,%rsi
+  800803:	44 89 f7             	mov    %r14d,%edi
+  800806:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800809:	83 eb 01             	sub    $0x1,%ebx
+  80080c:	75 f2                	jne    800800 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80080e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800812:	48 b9 dc 44 80 00 00 	movabs $0x8044dc,%rcx
+  800819:	00 00 00 
+  80081c:	48 b8 cb 44 80 00 00 	movabs $0x8044cb,%rax
+  800823:	00 00 00 
+  800826:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80082a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80082e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800833:	49 f7 f7             	div    %r15
+  800836:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80083a:	4c 89 ee             	mov    %r13,%rsi
+  80083d:	41 ff d4             	call   *%r12
+}
+  800840:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800844:	5b                   	pop    %rbx
+  800845:	41 5c                	pop    %r12
+  800847:	41 5d                	pop    %r13
+  800849:	41 5e                	pop    %r14
+  80084b:	41 5f                	pop    %r15
+  80084d:	5d                   	pop    %rbp
+  80084e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80084f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800853:	ba 00 00 00 00       	mov    $0x0,%edx
+  800858:	49 f7 f7             	div    %r15
+  80085b:	48 83 ec 08          	sub    $0x8,%rsp
+  80085f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800863:	52                   	push   %rdx
+  800864:	45 0f be c9          	movsbl %r9b,%r9d
+  800868:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80086c:	48 89 c2             	mov    %rax,%rdx
+  80086f:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  800876:	00 00 00 
+  800879:	ff d0                	call   *%rax
+  80087b:	48 83 c4 10          	add    $0x10,%rsp
+  80087f:	eb 8d                	jmp    80080e <print_num+0x43>
+
+0000000000800881 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800881:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800885:	48 8b 06             	mov    (%rsi),%rax
+  800888:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80088c:	73 0a                	jae    800898 <sprintputch+0x17>
+        *state->start++ = ch;
+  80088e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800892:	48 89 16             	mov    %rdx,(%rsi)
+  800895:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800898:	c3                   	ret
+
+0000000000800899 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800899:	55                   	push   %rbp
+  80089a:	48 89 e5             	mov    %rsp,%rbp
+  80089d:	48 83 ec 50          	sub    $0x50,%rsp
+  8008a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008ad:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008c4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008c8:	48 b8 d6 08 80 00 00 	movabs $0x8008d6,%rax
+  8008cf:	00 00 00 
+  8008d2:	ff d0                	call   *%rax
+}
+  8008d4:	c9                   	leave
+  8008d5:	c3                   	ret
+
+00000000008008d6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008d6:	55                   	push   %rbp
+  8008d7:	48 89 e5             	mov    %rsp,%rbp
+  8008da:	41 57                	push   %r15
+  8008dc:	41 56                	push   %r14
+  8008de:	41 55                	push   %r13
+  8008e0:	41 54                	push   %r12
+  8008e2:	53                   	push   %rbx
+  8008e3:	48 83 ec 38          	sub    $0x38,%rsp
+  8008e7:	49 89 fe             	mov    %rdi,%r14
+  8008ea:	49 89 f5             	mov    %rsi,%r13
+  8008ed:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8008f0:	48 8b 01             	mov    (%rcx),%rax
+  8008f3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8008f7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8008fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ff:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800903:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800907:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80090b:	0f b6 3b             	movzbl (%rbx),%edi
+  80090e:	40 80 ff 25          	cmp    $0x25,%dil
+  800912:	74 18                	je     80092c <vprintfmt+0x56>
+            if (!ch) return;
+  800914:	40 84 ff             	test   %dil,%dil
+  800917:	0f 84 b1 06 00 00    	je     800fce <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80091d:	40 0f b6 ff          	movzbl %dil,%edi
+  800921:	4c 89 ee             	mov    %r13,%rsi
+  800924:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800927:	4c 89 e3             	mov    %r12,%rbx
+  80092a:	eb db                	jmp    800907 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80092c:	be 00 00 00 00       	mov    $0x0,%esi
+  800931:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800935:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80093a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800940:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800947:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80094b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800950:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800955:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800958:	83 e8 23             	sub    $0x23,%eax
+  80095b:	3c 57                	cmp    $0x57,%al
+  80095d:	0f 87 51 06 00 00    	ja     800fb4 <vprintfmt+0x6de>
+  800963:	0f b6 c0             	movzbl %al,%eax
+  800966:	48 b9 80 46 80 00 00 	movabs $0x804680,%rcx
+  80096d:	00 00 00 
+  800970:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800973:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800976:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80097a:	eb cf                	jmp    80094b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80097c:	49 89 dc             	mov    %rbx,%r12
+  80097f:	be 01 00 00 00       	mov    $0x1,%esi
+  800984:	eb c5                	jmp    80094b <vprintfmt+0x75>
+            padc = ch;
+  800986:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80098a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80098d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800990:	eb b9                	jmp    80094b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	77 24                	ja     8009be <vprintfmt+0xe8>
+  80099a:	89 c1                	mov    %eax,%ecx
+  80099c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009a0:	83 c0 08             	add    $0x8,%eax
+  8009a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009a9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009ac:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009b0:	79 99                	jns    80094b <vprintfmt+0x75>
+                width = precision;
+  8009b2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009b6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009bc:	eb 8d                	jmp    80094b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009be:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009c2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	eb da                	jmp    8009a6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009cc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009d1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009d5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009db:	3c 39                	cmp    $0x39,%al
+  8009dd:	77 1c                	ja     8009fb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009df:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009e3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009e7:	0f b6 c0             	movzbl %al,%eax
+  8009ea:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009ef:	0f b6 03             	movzbl (%rbx),%eax
+  8009f2:	3c 39                	cmp    $0x39,%al
+  8009f4:	76 e9                	jbe    8009df <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8009f6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8009f9:	eb b1                	jmp    8009ac <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8009fb:	49 89 dc             	mov    %rbx,%r12
+  8009fe:	eb ac                	jmp    8009ac <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a00:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a03:	85 c9                	test   %ecx,%ecx
+  800a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0a:	0f 49 c1             	cmovns %ecx,%eax
+  800a0d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a10:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a13:	e9 33 ff ff ff       	jmp    80094b <vprintfmt+0x75>
+            lflag++;
+  800a18:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a1b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a1e:	e9 28 ff ff ff       	jmp    80094b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a26:	83 f8 2f             	cmp    $0x2f,%eax
+  800a29:	77 19                	ja     800a44 <vprintfmt+0x16e>
+  800a2b:	89 c2                	mov    %eax,%edx
+  800a2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a31:	83 c0 08             	add    $0x8,%eax
+  800a34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a37:	8b 3a                	mov    (%rdx),%edi
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	41 ff d6             	call   *%r14
+            break;
+  800a3f:	e9 c3 fe ff ff       	jmp    800907 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a50:	eb e5                	jmp    800a37 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	77 5a                	ja     800ab4 <vprintfmt+0x1de>
+  800a5a:	89 c2                	mov    %eax,%edx
+  800a5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a60:	83 c0 08             	add    $0x8,%eax
+  800a63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a66:	8b 02                	mov    (%rdx),%eax
+  800a68:	89 c1                	mov    %eax,%ecx
+  800a6a:	f7 d9                	neg    %ecx
+  800a6c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a6f:	83 f9 14             	cmp    $0x14,%ecx
+  800a72:	7f 4e                	jg     800ac2 <vprintfmt+0x1ec>
+  800a74:	48 63 c1             	movslq %ecx,%rax
+  800a77:	48 ba 40 49 80 00 00 	movabs $0x804940,%rdx
+  800a7e:	00 00 00 
+  800a81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a85:	48 85 c0             	test   %rax,%rax
+  800a88:	74 38                	je     800ac2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a8a:	48 89 c1             	mov    %rax,%rcx
+  800a8d:	48 ba 2d 4c 80 00 00 	movabs $0x804c2d,%rdx
+  800a94:	00 00 00 
+  800a97:	4c 89 ee             	mov    %r13,%rsi
+  800a9a:	4c 89 f7             	mov    %r14,%rdi
+  800a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa2:	49 b8 99 08 80 00 00 	movabs $0x800899,%r8
+  800aa9:	00 00 00 
+  800aac:	41 ff d0             	call   *%r8
+  800aaf:	e9 53 fe ff ff       	jmp    800907 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ab4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	eb a4                	jmp    800a66 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ac2:	48 ba f4 44 80 00 00 	movabs $0x8044f4,%rdx
+  800ac9:	00 00 00 
+  800acc:	4c 89 ee             	mov    %r13,%rsi
+  800acf:	4c 89 f7             	mov    %r14,%rdi
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad7:	49 b8 99 08 80 00 00 	movabs $0x800899,%r8
+  800ade:	00 00 00 
+  800ae1:	41 ff d0             	call   *%r8
+  800ae4:	e9 1e fe ff ff       	jmp    800907 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ae9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aec:	83 f8 2f             	cmp    $0x2f,%eax
+  800aef:	77 6c                	ja     800b5d <vprintfmt+0x287>
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af7:	83 c0 08             	add    $0x8,%eax
+  800afa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afd:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b00:	48 85 d2             	test   %rdx,%rdx
+  800b03:	48 b8 ed 44 80 00 00 	movabs $0x8044ed,%rax
+  800b0a:	00 00 00 
+  800b0d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b11:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b15:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b19:	7e 06                	jle    800b21 <vprintfmt+0x24b>
+  800b1b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b1f:	75 4a                	jne    800b6b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b21:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b25:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b29:	0f b6 00             	movzbl (%rax),%eax
+  800b2c:	84 c0                	test   %al,%al
+  800b2e:	0f 85 9a 00 00 00    	jne    800bce <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b34:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b37:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b3b:	85 c0                	test   %eax,%eax
+  800b3d:	0f 8e c4 fd ff ff    	jle    800907 <vprintfmt+0x31>
+  800b43:	4c 89 ee             	mov    %r13,%rsi
+  800b46:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b4b:	41 ff d6             	call   *%r14
+  800b4e:	41 83 ec 01          	sub    $0x1,%r12d
+  800b52:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b56:	75 eb                	jne    800b43 <vprintfmt+0x26d>
+  800b58:	e9 aa fd ff ff       	jmp    800907 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b69:	eb 92                	jmp    800afd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b6b:	49 63 f7             	movslq %r15d,%rsi
+  800b6e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b72:	48 b8 88 10 80 00 00 	movabs $0x801088,%rax
+  800b79:	00 00 00 
+  800b7c:	ff d0                	call   *%rax
+  800b7e:	48 89 c2             	mov    %rax,%rdx
+  800b81:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b84:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b86:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b89:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	7e 91                	jle    800b21 <vprintfmt+0x24b>
+  800b90:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800b95:	4c 89 ee             	mov    %r13,%rsi
+  800b98:	44 89 e7             	mov    %r12d,%edi
+  800b9b:	41 ff d6             	call   *%r14
+  800b9e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ba2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ba5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ba8:	75 eb                	jne    800b95 <vprintfmt+0x2bf>
+  800baa:	e9 72 ff ff ff       	jmp    800b21 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800baf:	0f b6 f8             	movzbl %al,%edi
+  800bb2:	4c 89 ee             	mov    %r13,%rsi
+  800bb5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bb8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bbc:	49 83 c4 01          	add    $0x1,%r12
+  800bc0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bc6:	84 c0                	test   %al,%al
+  800bc8:	0f 84 66 ff ff ff    	je     800b34 <vprintfmt+0x25e>
+  800bce:	45 85 ff             	test   %r15d,%r15d
+  800bd1:	78 0a                	js     800bdd <vprintfmt+0x307>
+  800bd3:	41 83 ef 01          	sub    $0x1,%r15d
+  800bd7:	0f 88 57 ff ff ff    	js     800b34 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bdd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800be1:	74 cc                	je     800baf <vprintfmt+0x2d9>
+  800be3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800be6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800beb:	80 fa 5e             	cmp    $0x5e,%dl
+  800bee:	77 c2                	ja     800bb2 <vprintfmt+0x2dc>
+  800bf0:	eb bd                	jmp    800baf <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf2:	40 84 f6             	test   %sil,%sil
+  800bf5:	75 26                	jne    800c1d <vprintfmt+0x347>
+    switch (lflag) {
+  800bf7:	85 d2                	test   %edx,%edx
+  800bf9:	74 59                	je     800c54 <vprintfmt+0x37e>
+  800bfb:	83 fa 01             	cmp    $0x1,%edx
+  800bfe:	74 7b                	je     800c7b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	0f 87 96 00 00 00    	ja     800ca2 <vprintfmt+0x3cc>
+  800c0c:	89 c2                	mov    %eax,%edx
+  800c0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c12:	83 c0 08             	add    $0x8,%eax
+  800c15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c18:	4c 8b 22             	mov    (%rdx),%r12
+  800c1b:	eb 17                	jmp    800c34 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c20:	83 f8 2f             	cmp    $0x2f,%eax
+  800c23:	77 21                	ja     800c46 <vprintfmt+0x370>
+  800c25:	89 c2                	mov    %eax,%edx
+  800c27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2b:	83 c0 08             	add    $0x8,%eax
+  800c2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c31:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c34:	4d 85 e4             	test   %r12,%r12
+  800c37:	78 7a                	js     800cb3 <vprintfmt+0x3dd>
+            num = i;
+  800c39:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c41:	e9 50 02 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c52:	eb dd                	jmp    800c31 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c57:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5a:	77 11                	ja     800c6d <vprintfmt+0x397>
+  800c5c:	89 c2                	mov    %eax,%edx
+  800c5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c62:	83 c0 08             	add    $0x8,%eax
+  800c65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c68:	4c 63 22             	movslq (%rdx),%r12
+  800c6b:	eb c7                	jmp    800c34 <vprintfmt+0x35e>
+  800c6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c79:	eb ed                	jmp    800c68 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c81:	77 11                	ja     800c94 <vprintfmt+0x3be>
+  800c83:	89 c2                	mov    %eax,%edx
+  800c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c89:	83 c0 08             	add    $0x8,%eax
+  800c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8f:	4c 8b 22             	mov    (%rdx),%r12
+  800c92:	eb a0                	jmp    800c34 <vprintfmt+0x35e>
+  800c94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca0:	eb ed                	jmp    800c8f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cae:	e9 65 ff ff ff       	jmp    800c18 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cb3:	4c 89 ee             	mov    %r13,%rsi
+  800cb6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cbb:	41 ff d6             	call   *%r14
+                i = -i;
+  800cbe:	49 f7 dc             	neg    %r12
+  800cc1:	e9 73 ff ff ff       	jmp    800c39 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc6:	40 84 f6             	test   %sil,%sil
+  800cc9:	75 32                	jne    800cfd <vprintfmt+0x427>
+    switch (lflag) {
+  800ccb:	85 d2                	test   %edx,%edx
+  800ccd:	74 5d                	je     800d2c <vprintfmt+0x456>
+  800ccf:	83 fa 01             	cmp    $0x1,%edx
+  800cd2:	0f 84 82 00 00 00    	je     800d5a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800cd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cde:	0f 87 a5 00 00 00    	ja     800d89 <vprintfmt+0x4b3>
+  800ce4:	89 c2                	mov    %eax,%edx
+  800ce6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cea:	83 c0 08             	add    $0x8,%eax
+  800ced:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cf3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf8:	e9 99 01 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d00:	83 f8 2f             	cmp    $0x2f,%eax
+  800d03:	77 19                	ja     800d1e <vprintfmt+0x448>
+  800d05:	89 c2                	mov    %eax,%edx
+  800d07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0b:	83 c0 08             	add    $0x8,%eax
+  800d0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d11:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d14:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d19:	e9 78 01 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+  800d1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2a:	eb e5                	jmp    800d11 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d32:	77 18                	ja     800d4c <vprintfmt+0x476>
+  800d34:	89 c2                	mov    %eax,%edx
+  800d36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3a:	83 c0 08             	add    $0x8,%eax
+  800d3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d40:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d47:	e9 4a 01 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+  800d4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d58:	eb e6                	jmp    800d40 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d60:	77 19                	ja     800d7b <vprintfmt+0x4a5>
+  800d62:	89 c2                	mov    %eax,%edx
+  800d64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d68:	83 c0 08             	add    $0x8,%eax
+  800d6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d76:	e9 1b 01 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+  800d7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d87:	eb e5                	jmp    800d6e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800d89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d95:	e9 56 ff ff ff       	jmp    800cf0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800d9a:	40 84 f6             	test   %sil,%sil
+  800d9d:	75 2e                	jne    800dcd <vprintfmt+0x4f7>
+    switch (lflag) {
+  800d9f:	85 d2                	test   %edx,%edx
+  800da1:	74 59                	je     800dfc <vprintfmt+0x526>
+  800da3:	83 fa 01             	cmp    $0x1,%edx
+  800da6:	74 7f                	je     800e27 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800da8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dab:	83 f8 2f             	cmp    $0x2f,%eax
+  800dae:	0f 87 9f 00 00 00    	ja     800e53 <vprintfmt+0x57d>
+  800db4:	89 c2                	mov    %eax,%edx
+  800db6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dba:	83 c0 08             	add    $0x8,%eax
+  800dbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800dc3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800dc8:	e9 c9 00 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd3:	77 19                	ja     800dee <vprintfmt+0x518>
+  800dd5:	89 c2                	mov    %eax,%edx
+  800dd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ddb:	83 c0 08             	add    $0x8,%eax
+  800dde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800de4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800de9:	e9 a8 00 00 00       	jmp    800e96 <vprintfmt+0x5c0>
+  800dee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfa:	eb e5                	jmp    800de1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dff:	83 f8 2f             	cmp    $0x2f,%eax
+  800e02:	77 15                	ja     800e19 <vprintfmt+0x543>
+  800e04:	89 c2                	mov    %eax,%edx
+  800e06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e0a:	83 c0 08             	add    $0x8,%eax
+  800e0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e10:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e12:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e17:	eb 7d                	jmp    800e96 <vprintfmt+0x5c0>
+  800e19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e25:	eb e9                	jmp    800e10 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2d:	77 16                	ja     800e45 <vprintfmt+0x56f>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e35:	83 c0 08             	add    $0x8,%eax
+  800e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e3e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e43:	eb 51                	jmp    800e96 <vprintfmt+0x5c0>
+  800e45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e51:	eb e8                	jmp    800e3b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5f:	e9 5c ff ff ff       	jmp    800dc0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e64:	4c 89 ee             	mov    %r13,%rsi
+  800e67:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e6c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e6f:	4c 89 ee             	mov    %r13,%rsi
+  800e72:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e77:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e80:	77 47                	ja     800ec9 <vprintfmt+0x5f3>
+  800e82:	89 c2                	mov    %eax,%edx
+  800e84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e88:	83 c0 08             	add    $0x8,%eax
+  800e8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e91:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800e96:	48 83 ec 08          	sub    $0x8,%rsp
+  800e9a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800e9e:	0f 94 c0             	sete   %al
+  800ea1:	0f b6 c0             	movzbl %al,%eax
+  800ea4:	50                   	push   %rax
+  800ea5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800eaa:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800eae:	4c 89 ee             	mov    %r13,%rsi
+  800eb1:	4c 89 f7             	mov    %r14,%rdi
+  800eb4:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  800ebb:	00 00 00 
+  800ebe:	ff d0                	call   *%rax
+            break;
+  800ec0:	48 83 c4 10          	add    $0x10,%rsp
+  800ec4:	e9 3e fa ff ff       	jmp    800907 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ec9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ecd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed5:	eb b7                	jmp    800e8e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ed7:	40 84 f6             	test   %sil,%sil
+  800eda:	75 2b                	jne    800f07 <vprintfmt+0x631>
+    switch (lflag) {
+  800edc:	85 d2                	test   %edx,%edx
+  800ede:	74 56                	je     800f36 <vprintfmt+0x660>
+  800ee0:	83 fa 01             	cmp    $0x1,%edx
+  800ee3:	74 7f                	je     800f64 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ee5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee8:	83 f8 2f             	cmp    $0x2f,%eax
+  800eeb:	0f 87 a2 00 00 00    	ja     800f93 <vprintfmt+0x6bd>
+  800ef1:	89 c2                	mov    %eax,%edx
+  800ef3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef7:	83 c0 08             	add    $0x8,%eax
+  800efa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800efd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f00:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f05:	eb 8f                	jmp    800e96 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0d:	77 19                	ja     800f28 <vprintfmt+0x652>
+  800f0f:	89 c2                	mov    %eax,%edx
+  800f11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f15:	83 c0 08             	add    $0x8,%eax
+  800f18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f23:	e9 6e ff ff ff       	jmp    800e96 <vprintfmt+0x5c0>
+  800f28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f34:	eb e5                	jmp    800f1b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f39:	83 f8 2f             	cmp    $0x2f,%eax
+  800f3c:	77 18                	ja     800f56 <vprintfmt+0x680>
+  800f3e:	89 c2                	mov    %eax,%edx
+  800f40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f44:	83 c0 08             	add    $0x8,%eax
+  800f47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f4c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f51:	e9 40 ff ff ff       	jmp    800e96 <vprintfmt+0x5c0>
+  800f56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f62:	eb e6                	jmp    800f4a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f67:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6a:	77 19                	ja     800f85 <vprintfmt+0x6af>
+  800f6c:	89 c2                	mov    %eax,%edx
+  800f6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f72:	83 c0 08             	add    $0x8,%eax
+  800f75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f80:	e9 11 ff ff ff       	jmp    800e96 <vprintfmt+0x5c0>
+  800f85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f91:	eb e5                	jmp    800f78 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800f93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9f:	e9 59 ff ff ff       	jmp    800efd <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fa4:	4c 89 ee             	mov    %r13,%rsi
+  800fa7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fac:	41 ff d6             	call   *%r14
+            break;
+  800faf:	e9 53 f9 ff ff       	jmp    800907 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fb4:	4c 89 ee             	mov    %r13,%rsi
+  800fb7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fbc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fbf:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fc7:	75 f6                	jne    800fbf <vprintfmt+0x6e9>
+  800fc9:	e9 39 f9 ff ff       	jmp    800907 <vprintfmt+0x31>
+}
+  800fce:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fd2:	5b                   	pop    %rbx
+  800fd3:	41 5c                	pop    %r12
+  800fd5:	41 5d                	pop    %r13
+  800fd7:	41 5e                	pop    %r14
+  800fd9:	41 5f                	pop    %r15
+  800fdb:	5d                   	pop    %rbp
+  800fdc:	c3                   	ret
+
+0000000000800fdd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800fdd:	55                   	push   %rbp
+  800fde:	48 89 e5             	mov    %rsp,%rbp
+  800fe1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800fe5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fe9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800fee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ff2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ff9:	48 85 ff             	test   %rdi,%rdi
+  800ffc:	74 2b                	je     801029 <vsnprintf+0x4c>
+  800ffe:	48 85 f6             	test   %rsi,%rsi
+  801001:	74 26                	je     801029 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801003:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801007:	48 bf 81 08 80 00 00 	movabs $0x800881,%rdi
+  80100e:	00 00 00 
+  801011:	48 b8 d6 08 80 00 00 	movabs $0x8008d6,%rax
+  801018:	00 00 00 
+  80101b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80101d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801021:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801024:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801027:	c9                   	leave
+  801028:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801029:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80102e:	eb f7                	jmp    801027 <vsnprintf+0x4a>
+
+0000000000801030 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	48 83 ec 50          	sub    $0x50,%rsp
+  801038:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80103c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801040:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801044:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80104b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80104f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801053:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801057:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80105b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80105f:	48 b8 dd 0f 80 00 00 	movabs $0x800fdd,%rax
+  801066:	00 00 00 
+  801069:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80106b:	c9                   	leave
+  80106c:	c3                   	ret
+
+000000000080106d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80106d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801070:	74 10                	je     801082 <strlen+0x15>
+    size_t n = 0;
+  801072:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801077:	48 83 c0 01          	add    $0x1,%rax
+  80107b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80107f:	75 f6                	jne    801077 <strlen+0xa>
+  801081:	c3                   	ret
+    size_t n = 0;
+  801082:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801087:	c3                   	ret
+
+0000000000801088 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801088:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80108b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801090:	48 85 f6             	test   %rsi,%rsi
+  801093:	74 11                	je     8010a6 <strnlen+0x1e>
+  801095:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801099:	74 0c                	je     8010a7 <strnlen+0x1f>
+  80109b:	48 83 c2 01          	add    $0x1,%rdx
+  80109f:	48 39 d0             	cmp    %rdx,%rax
+  8010a2:	75 f1                	jne    801095 <strnlen+0xd>
+  8010a4:	eb 04                	jmp    8010aa <strnlen+0x22>
+  8010a6:	c3                   	ret
+  8010a7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010aa:	c3                   	ret
+
+00000000008010ab <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010ab:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010b7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010ba:	48 83 c2 01          	add    $0x1,%rdx
+  8010be:	84 c9                	test   %cl,%cl
+  8010c0:	75 f1                	jne    8010b3 <strcpy+0x8>
+        ;
+    return res;
+}
+  8010c2:	c3                   	ret
+
+00000000008010c3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+  8010c7:	41 54                	push   %r12
+  8010c9:	53                   	push   %rbx
+  8010ca:	48 89 fb             	mov    %rdi,%rbx
+  8010cd:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010d0:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  8010d7:	00 00 00 
+  8010da:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010dc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010e0:	4c 89 e6             	mov    %r12,%rsi
+  8010e3:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  8010ea:	00 00 00 
+  8010ed:	ff d0                	call   *%rax
+    return dst;
+}
+  8010ef:	48 89 d8             	mov    %rbx,%rax
+  8010f2:	5b                   	pop    %rbx
+  8010f3:	41 5c                	pop    %r12
+  8010f5:	5d                   	pop    %rbp
+  8010f6:	c3                   	ret
+
+00000000008010f7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8010f7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8010fa:	48 85 d2             	test   %rdx,%rdx
+  8010fd:	74 1f                	je     80111e <strncpy+0x27>
+  8010ff:	48 01 fa             	add    %rdi,%rdx
+  801102:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801105:	48 83 c1 01          	add    $0x1,%rcx
+  801109:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80110d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801111:	41 80 f8 01          	cmp    $0x1,%r8b
+  801115:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801119:	48 39 ca             	cmp    %rcx,%rdx
+  80111c:	75 e7                	jne    801105 <strncpy+0xe>
+    }
+    return ret;
+}
+  80111e:	c3                   	ret
+
+000000000080111f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80111f:	48 89 f8             	mov    %rdi,%rax
+  801122:	48 85 d2             	test   %rdx,%rdx
+  801125:	74 24                	je     80114b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801127:	48 83 ea 01          	sub    $0x1,%rdx
+  80112b:	74 1b                	je     801148 <strlcpy+0x29>
+  80112d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801131:	0f b6 16             	movzbl (%rsi),%edx
+  801134:	84 d2                	test   %dl,%dl
+  801136:	74 10                	je     801148 <strlcpy+0x29>
+            *dst++ = *src++;
+  801138:	48 83 c6 01          	add    $0x1,%rsi
+  80113c:	48 83 c0 01          	add    $0x1,%rax
+  801140:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801143:	48 39 c8             	cmp    %rcx,%rax
+  801146:	75 e9                	jne    801131 <strlcpy+0x12>
+        *dst = '\0';
+  801148:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80114b:	48 29 f8             	sub    %rdi,%rax
+}
+  80114e:	c3                   	ret
+
+000000000080114f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80114f:	0f b6 07             	movzbl (%rdi),%eax
+  801152:	84 c0                	test   %al,%al
+  801154:	74 13                	je     801169 <strcmp+0x1a>
+  801156:	38 06                	cmp    %al,(%rsi)
+  801158:	75 0f                	jne    801169 <strcmp+0x1a>
+  80115a:	48 83 c7 01          	add    $0x1,%rdi
+  80115e:	48 83 c6 01          	add    $0x1,%rsi
+  801162:	0f b6 07             	movzbl (%rdi),%eax
+  801165:	84 c0                	test   %al,%al
+  801167:	75 ed                	jne    801156 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801169:	0f b6 c0             	movzbl %al,%eax
+  80116c:	0f b6 16             	movzbl (%rsi),%edx
+  80116f:	29 d0                	sub    %edx,%eax
+}
+  801171:	c3                   	ret
+
+0000000000801172 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801172:	48 85 d2             	test   %rdx,%rdx
+  801175:	74 1f                	je     801196 <strncmp+0x24>
+  801177:	0f b6 07             	movzbl (%rdi),%eax
+  80117a:	84 c0                	test   %al,%al
+  80117c:	74 1e                	je     80119c <strncmp+0x2a>
+  80117e:	3a 06                	cmp    (%rsi),%al
+  801180:	75 1a                	jne    80119c <strncmp+0x2a>
+  801182:	48 83 c7 01          	add    $0x1,%rdi
+  801186:	48 83 c6 01          	add    $0x1,%rsi
+  80118a:	48 83 ea 01          	sub    $0x1,%rdx
+  80118e:	75 e7                	jne    801177 <strncmp+0x5>
+
+    if (!n) return 0;
+  801190:	b8 00 00 00 00       	mov    $0x0,%eax
+  801195:	c3                   	ret
+  801196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119b:	c3                   	ret
+  80119c:	48 85 d2             	test   %rdx,%rdx
+  80119f:	74 09                	je     8011aa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011a1:	0f b6 07             	movzbl (%rdi),%eax
+  8011a4:	0f b6 16             	movzbl (%rsi),%edx
+  8011a7:	29 d0                	sub    %edx,%eax
+  8011a9:	c3                   	ret
+    if (!n) return 0;
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011af:	c3                   	ret
+
+00000000008011b0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011b0:	0f b6 17             	movzbl (%rdi),%edx
+  8011b3:	84 d2                	test   %dl,%dl
+  8011b5:	74 18                	je     8011cf <strchr+0x1f>
+        if (*str == c) {
+  8011b7:	0f be d2             	movsbl %dl,%edx
+  8011ba:	39 f2                	cmp    %esi,%edx
+  8011bc:	74 17                	je     8011d5 <strchr+0x25>
+    for (; *str; str++) {
+  8011be:	48 83 c7 01          	add    $0x1,%rdi
+  8011c2:	0f b6 17             	movzbl (%rdi),%edx
+  8011c5:	84 d2                	test   %dl,%dl
+  8011c7:	75 ee                	jne    8011b7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ce:	c3                   	ret
+  8011cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d4:	c3                   	ret
+  8011d5:	48 89 f8             	mov    %rdi,%rax
+}
+  8011d8:	c3                   	ret
+
+00000000008011d9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011d9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011dc:	0f b6 17             	movzbl (%rdi),%edx
+  8011df:	84 d2                	test   %dl,%dl
+  8011e1:	74 13                	je     8011f6 <strfind+0x1d>
+  8011e3:	0f be d2             	movsbl %dl,%edx
+  8011e6:	39 f2                	cmp    %esi,%edx
+  8011e8:	74 0b                	je     8011f5 <strfind+0x1c>
+  8011ea:	48 83 c0 01          	add    $0x1,%rax
+  8011ee:	0f b6 10             	movzbl (%rax),%edx
+  8011f1:	84 d2                	test   %dl,%dl
+  8011f3:	75 ee                	jne    8011e3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8011f5:	c3                   	ret
+  8011f6:	c3                   	ret
+
+00000000008011f7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011f7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011fa:	48 89 f8             	mov    %rdi,%rax
+  8011fd:	48 f7 d8             	neg    %rax
+  801200:	83 e0 07             	and    $0x7,%eax
+  801203:	49 89 d1             	mov    %rdx,%r9
+  801206:	49 29 c1             	sub    %rax,%r9
+  801209:	78 36                	js     801241 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80120b:	40 0f b6 c6          	movzbl %sil,%eax
+  80120f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801216:	01 01 01 
+  801219:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80121d:	40 f6 c7 07          	test   $0x7,%dil
+  801221:	75 38                	jne    80125b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801223:	4c 89 c9             	mov    %r9,%rcx
+  801226:	48 c1 f9 03          	sar    $0x3,%rcx
+  80122a:	74 0c                	je     801238 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80122c:	fc                   	cld
+  80122d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801230:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801234:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801238:	4d 85 c9             	test   %r9,%r9
+  80123b:	75 45                	jne    801282 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80123d:	4c 89 c0             	mov    %r8,%rax
+  801240:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801241:	48 85 d2             	test   %rdx,%rdx
+  801244:	74 f7                	je     80123d <memset+0x46>
+  801246:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801249:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80124c:	48 83 c0 01          	add    $0x1,%rax
+  801250:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801254:	48 39 c2             	cmp    %rax,%rdx
+  801257:	75 f3                	jne    80124c <memset+0x55>
+  801259:	eb e2                	jmp    80123d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80125b:	40 f6 c7 01          	test   $0x1,%dil
+  80125f:	74 06                	je     801267 <memset+0x70>
+  801261:	88 07                	mov    %al,(%rdi)
+  801263:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801267:	40 f6 c7 02          	test   $0x2,%dil
+  80126b:	74 07                	je     801274 <memset+0x7d>
+  80126d:	66 89 07             	mov    %ax,(%rdi)
+  801270:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801274:	40 f6 c7 04          	test   $0x4,%dil
+  801278:	74 a9                	je     801223 <memset+0x2c>
+  80127a:	89 07                	mov    %eax,(%rdi)
+  80127c:	48 83 c7 04          	add    $0x4,%rdi
+  801280:	eb a1                	jmp    801223 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801282:	41 f6 c1 04          	test   $0x4,%r9b
+  801286:	74 06                	je     80128e <memset+0x97>
+  801288:	89 07                	mov    %eax,(%rdi)
+  80128a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80128e:	41 f6 c1 02          	test   $0x2,%r9b
+  801292:	74 07                	je     80129b <memset+0xa4>
+  801294:	66 89 07             	mov    %ax,(%rdi)
+  801297:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80129b:	41 f6 c1 01          	test   $0x1,%r9b
+  80129f:	74 9c                	je     80123d <memset+0x46>
+  8012a1:	88 07                	mov    %al,(%rdi)
+  8012a3:	eb 98                	jmp    80123d <memset+0x46>
+
+00000000008012a5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012a5:	48 89 f8             	mov    %rdi,%rax
+  8012a8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012ab:	48 39 fe             	cmp    %rdi,%rsi
+  8012ae:	73 3b                	jae    8012eb <memmove+0x46>
+  8012b0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012b4:	48 39 d7             	cmp    %rdx,%rdi
+  8012b7:	73 32                	jae    8012eb <memmove+0x46>
+        s += n;
+        d += n;
+  8012b9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012bd:	48 89 d6             	mov    %rdx,%rsi
+  8012c0:	48 09 fe             	or     %rdi,%rsi
+  8012c3:	48 09 ce             	or     %rcx,%rsi
+  8012c6:	40 f6 c6 07          	test   $0x7,%sil
+  8012ca:	75 12                	jne    8012de <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012cc:	48 83 ef 08          	sub    $0x8,%rdi
+  8012d0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012d4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012d8:	fd                   	std
+  8012d9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012dc:	fc                   	cld
+  8012dd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012de:	48 83 ef 01          	sub    $0x1,%rdi
+  8012e2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012e6:	fd                   	std
+  8012e7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012e9:	eb f1                	jmp    8012dc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012eb:	48 89 f2             	mov    %rsi,%rdx
+  8012ee:	48 09 c2             	or     %rax,%rdx
+  8012f1:	48 09 ca             	or     %rcx,%rdx
+  8012f4:	f6 c2 07             	test   $0x7,%dl
+  8012f7:	75 0c                	jne    801305 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012f9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012fd:	48 89 c7             	mov    %rax,%rdi
+  801300:	fc                   	cld
+  801301:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801304:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801305:	48 89 c7             	mov    %rax,%rdi
+  801308:	fc                   	cld
+  801309:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80130b:	c3                   	ret
+
+000000000080130c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80130c:	55                   	push   %rbp
+  80130d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801310:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  801317:	00 00 00 
+  80131a:	ff d0                	call   *%rax
+}
+  80131c:	5d                   	pop    %rbp
+  80131d:	c3                   	ret
+
+000000000080131e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80131e:	55                   	push   %rbp
+  80131f:	48 89 e5             	mov    %rsp,%rbp
+  801322:	41 57                	push   %r15
+  801324:	41 56                	push   %r14
+  801326:	41 55                	push   %r13
+  801328:	41 54                	push   %r12
+  80132a:	53                   	push   %rbx
+  80132b:	48 83 ec 08          	sub    $0x8,%rsp
+  80132f:	49 89 fe             	mov    %rdi,%r14
+  801332:	49 89 f7             	mov    %rsi,%r15
+  801335:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801338:	48 89 f7             	mov    %rsi,%rdi
+  80133b:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  801342:	00 00 00 
+  801345:	ff d0                	call   *%rax
+  801347:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80134a:	48 89 de             	mov    %rbx,%rsi
+  80134d:	4c 89 f7             	mov    %r14,%rdi
+  801350:	48 b8 88 10 80 00 00 	movabs $0x801088,%rax
+  801357:	00 00 00 
+  80135a:	ff d0                	call   *%rax
+  80135c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80135f:	48 39 c3             	cmp    %rax,%rbx
+  801362:	74 36                	je     80139a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801364:	48 89 d8             	mov    %rbx,%rax
+  801367:	4c 29 e8             	sub    %r13,%rax
+  80136a:	49 39 c4             	cmp    %rax,%r12
+  80136d:	73 31                	jae    8013a0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80136f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801374:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801378:	4c 89 fe             	mov    %r15,%rsi
+  80137b:	48 b8 0c 13 80 00 00 	movabs $0x80130c,%rax
+  801382:	00 00 00 
+  801385:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801387:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80138b:	48 83 c4 08          	add    $0x8,%rsp
+  80138f:	5b                   	pop    %rbx
+  801390:	41 5c                	pop    %r12
+  801392:	41 5d                	pop    %r13
+  801394:	41 5e                	pop    %r14
+  801396:	41 5f                	pop    %r15
+  801398:	5d                   	pop    %rbp
+  801399:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80139a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80139e:	eb eb                	jmp    80138b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013a0:	48 83 eb 01          	sub    $0x1,%rbx
+  8013a4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013a8:	48 89 da             	mov    %rbx,%rdx
+  8013ab:	4c 89 fe             	mov    %r15,%rsi
+  8013ae:	48 b8 0c 13 80 00 00 	movabs $0x80130c,%rax
+  8013b5:	00 00 00 
+  8013b8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013ba:	49 01 de             	add    %rbx,%r14
+  8013bd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013c2:	eb c3                	jmp    801387 <strlcat+0x69>
+
+00000000008013c4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013c4:	48 85 d2             	test   %rdx,%rdx
+  8013c7:	74 2d                	je     8013f6 <memcmp+0x32>
+  8013c9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013ce:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013d2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013d7:	44 38 c1             	cmp    %r8b,%cl
+  8013da:	75 0f                	jne    8013eb <memcmp+0x27>
+    while (n-- > 0) {
+  8013dc:	48 83 c0 01          	add    $0x1,%rax
+  8013e0:	48 39 c2             	cmp    %rax,%rdx
+  8013e3:	75 e9                	jne    8013ce <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013eb:	0f b6 c1             	movzbl %cl,%eax
+  8013ee:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013f2:	44 29 c0             	sub    %r8d,%eax
+  8013f5:	c3                   	ret
+    return 0;
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013fb:	c3                   	ret
+
+00000000008013fc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013fc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801400:	48 39 c7             	cmp    %rax,%rdi
+  801403:	73 0f                	jae    801414 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801405:	40 38 37             	cmp    %sil,(%rdi)
+  801408:	74 0e                	je     801418 <memfind+0x1c>
+    for (; src < end; src++) {
+  80140a:	48 83 c7 01          	add    $0x1,%rdi
+  80140e:	48 39 f8             	cmp    %rdi,%rax
+  801411:	75 f2                	jne    801405 <memfind+0x9>
+  801413:	c3                   	ret
+  801414:	48 89 f8             	mov    %rdi,%rax
+  801417:	c3                   	ret
+  801418:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80141b:	c3                   	ret
+
+000000000080141c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80141c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80141f:	0f b6 37             	movzbl (%rdi),%esi
+  801422:	40 80 fe 20          	cmp    $0x20,%sil
+  801426:	74 06                	je     80142e <strtol+0x12>
+  801428:	40 80 fe 09          	cmp    $0x9,%sil
+  80142c:	75 13                	jne    801441 <strtol+0x25>
+  80142e:	48 83 c7 01          	add    $0x1,%rdi
+  801432:	0f b6 37             	movzbl (%rdi),%esi
+  801435:	40 80 fe 20          	cmp    $0x20,%sil
+  801439:	74 f3                	je     80142e <strtol+0x12>
+  80143b:	40 80 fe 09          	cmp    $0x9,%sil
+  80143f:	74 ed                	je     80142e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801441:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801444:	83 e0 fd             	and    $0xfffffffd,%eax
+  801447:	3c 01                	cmp    $0x1,%al
+  801449:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80144d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801453:	75 0f                	jne    801464 <strtol+0x48>
+  801455:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801458:	74 14                	je     80146e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80145a:	85 d2                	test   %edx,%edx
+  80145c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801461:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801464:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801469:	4c 63 ca             	movslq %edx,%r9
+  80146c:	eb 36                	jmp    8014a4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80146e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801472:	74 0f                	je     801483 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801474:	85 d2                	test   %edx,%edx
+  801476:	75 ec                	jne    801464 <strtol+0x48>
+        s++;
+  801478:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80147c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801481:	eb e1                	jmp    801464 <strtol+0x48>
+        s += 2;
+  801483:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801487:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80148c:	eb d6                	jmp    801464 <strtol+0x48>
+            dig -= '0';
+  80148e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801491:	44 0f b6 c1          	movzbl %cl,%r8d
+  801495:	41 39 d0             	cmp    %edx,%r8d
+  801498:	7d 21                	jge    8014bb <strtol+0x9f>
+        val = val * base + dig;
+  80149a:	49 0f af c1          	imul   %r9,%rax
+  80149e:	0f b6 c9             	movzbl %cl,%ecx
+  8014a1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014a4:	48 83 c7 01          	add    $0x1,%rdi
+  8014a8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014ac:	80 f9 39             	cmp    $0x39,%cl
+  8014af:	76 dd                	jbe    80148e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014b1:	80 f9 7b             	cmp    $0x7b,%cl
+  8014b4:	77 05                	ja     8014bb <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014b6:	83 e9 57             	sub    $0x57,%ecx
+  8014b9:	eb d6                	jmp    801491 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014bb:	4d 85 d2             	test   %r10,%r10
+  8014be:	74 03                	je     8014c3 <strtol+0xa7>
+  8014c0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014c3:	48 89 c2             	mov    %rax,%rdx
+  8014c6:	48 f7 da             	neg    %rdx
+  8014c9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014cd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014d1:	c3                   	ret
+
+00000000008014d2 <strrev>:
+
+void
+strrev(char *str)
+{
+  8014d2:	55                   	push   %rbp
+  8014d3:	48 89 e5             	mov    %rsp,%rbp
+  8014d6:	53                   	push   %rbx
+  8014d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014db:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8014de:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  8014e5:	00 00 00 
+  8014e8:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8014ea:	83 e8 01             	sub    $0x1,%eax
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	7e 22                	jle    801513 <strrev+0x41>
+  8014f1:	48 98                	cltq
+  8014f3:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8014f8:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8014fc:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801500:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801504:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801507:	48 83 c2 01          	add    $0x1,%rdx
+  80150b:	48 83 e8 01          	sub    $0x1,%rax
+  80150f:	39 c2                	cmp    %eax,%edx
+  801511:	7c e5                	jl     8014f8 <strrev+0x26>
+	}
+}
+  801513:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801517:	c9                   	leave
+  801518:	c3                   	ret
+
+0000000000801519 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801519:	85 d2                	test   %edx,%edx
+  80151b:	0f 84 80 00 00 00    	je     8015a1 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	53                   	push   %rbx
+  801526:	48 83 ec 08          	sub    $0x8,%rsp
+  80152a:	49 89 f2             	mov    %rsi,%r10
+  80152d:	41 89 d3             	mov    %edx,%r11d
+  801530:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801533:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801538:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80153b:	eb 20                	jmp    80155d <itoa+0x44>
+			str[i++] = '0' + digit;
+  80153d:	41 89 f1             	mov    %esi,%r9d
+  801540:	83 c2 30             	add    $0x30,%edx
+  801543:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801546:	89 f8                	mov    %edi,%eax
+  801548:	99                   	cltd
+  801549:	f7 f9                	idiv   %ecx
+  80154b:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	74 2e                	je     80157f <itoa+0x66>
+  801551:	83 c6 01             	add    $0x1,%esi
+  801554:	49 83 c0 01          	add    $0x1,%r8
+  801558:	44 39 cb             	cmp    %r9d,%ebx
+  80155b:	7e 15                	jle    801572 <itoa+0x59>
+		digit = sum % base;
+  80155d:	89 f8                	mov    %edi,%eax
+  80155f:	99                   	cltd
+  801560:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801562:	83 fa 09             	cmp    $0x9,%edx
+  801565:	7e d6                	jle    80153d <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801567:	41 89 f1             	mov    %esi,%r9d
+  80156a:	83 c2 37             	add    $0x37,%edx
+  80156d:	41 88 10             	mov    %dl,(%r8)
+  801570:	eb d4                	jmp    801546 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801572:	41 83 eb 01          	sub    $0x1,%r11d
+  801576:	45 39 cb             	cmp    %r9d,%r11d
+  801579:	75 04                	jne    80157f <itoa+0x66>
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	75 28                	jne    8015a7 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80157f:	4d 63 c9             	movslq %r9d,%r9
+  801582:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801587:	4c 89 d7             	mov    %r10,%rdi
+  80158a:	48 b8 d2 14 80 00 00 	movabs $0x8014d2,%rax
+  801591:	00 00 00 
+  801594:	ff d0                	call   *%rax
+	return 0;
+  801596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159f:	c9                   	leave
+  8015a0:	c3                   	ret
+		return -1;
+  8015a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015a6:	c3                   	ret
+		return -1;
+  8015a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015ac:	eb ed                	jmp    80159b <itoa+0x82>
+
+00000000008015ae <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 89 fa             	mov    %rdi,%rdx
+  8015b6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8015d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+00000000008015db <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8015db:	55                   	push   %rbp
+  8015dc:	48 89 e5             	mov    %rsp,%rbp
+  8015df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801604:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801606:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160a:	c9                   	leave
+  80160b:	c3                   	ret
+
+000000000080160c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80160c:	55                   	push   %rbp
+  80160d:	48 89 e5             	mov    %rsp,%rbp
+  801610:	53                   	push   %rbx
+  801611:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801615:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801618:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80161d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801622:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801627:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162c:	be 00 00 00 00       	mov    $0x0,%esi
+  801631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801637:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801639:	48 85 c0             	test   %rax,%rax
+  80163c:	7f 06                	jg     801644 <sys_env_destroy+0x38>
+}
+  80163e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801644:	49 89 c0             	mov    %rax,%r8
+  801647:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80164c:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  801653:	00 00 00 
+  801656:	be 26 00 00 00       	mov    $0x26,%esi
+  80165b:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801662:	00 00 00 
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166a:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  801671:	00 00 00 
+  801674:	41 ff d1             	call   *%r9
+
+0000000000801677 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80167c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801681:	ba 00 00 00 00       	mov    $0x0,%edx
+  801686:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801690:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801695:	be 00 00 00 00       	mov    $0x0,%esi
+  80169a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+
+00000000008016a8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+00000000008016d9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8016d9:	55                   	push   %rbp
+  8016da:	48 89 e5             	mov    %rsp,%rbp
+  8016dd:	53                   	push   %rbx
+  8016de:	48 89 fa             	mov    %rdi,%rdx
+  8016e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8016f0:	00 00 00 
+  8016f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801703:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801705:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801709:	c9                   	leave
+  80170a:	c3                   	ret
+
+000000000080170b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80170b:	55                   	push   %rbp
+  80170c:	48 89 e5             	mov    %rsp,%rbp
+  80170f:	53                   	push   %rbx
+  801710:	49 89 f8             	mov    %rdi,%r8
+  801713:	48 89 d3             	mov    %rdx,%rbx
+  801716:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801719:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80171e:	4c 89 c2             	mov    %r8,%rdx
+  801721:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801724:	be 00 00 00 00       	mov    $0x0,%esi
+  801729:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801731:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801735:	c9                   	leave
+  801736:	c3                   	ret
+
+0000000000801737 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	53                   	push   %rbx
+  80173c:	48 83 ec 08          	sub    $0x8,%rsp
+  801740:	89 f8                	mov    %edi,%eax
+  801742:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801745:	48 63 f9             	movslq %ecx,%rdi
+  801748:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80174b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801750:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801753:	be 00 00 00 00       	mov    $0x0,%esi
+  801758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801760:	48 85 c0             	test   %rax,%rax
+  801763:	7f 06                	jg     80176b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801765:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801769:	c9                   	leave
+  80176a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176b:	49 89 c0             	mov    %rax,%r8
+  80176e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801773:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  80177a:	00 00 00 
+  80177d:	be 26 00 00 00       	mov    $0x26,%esi
+  801782:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801789:	00 00 00 
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  801798:	00 00 00 
+  80179b:	41 ff d1             	call   *%r9
+
+000000000080179e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	53                   	push   %rbx
+  8017a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a7:	89 f8                	mov    %edi,%eax
+  8017a9:	49 89 f2             	mov    %rsi,%r10
+  8017ac:	48 89 cf             	mov    %rcx,%rdi
+  8017af:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8017b2:	48 63 da             	movslq %edx,%rbx
+  8017b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017bd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8017c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c5:	48 85 c0             	test   %rax,%rax
+  8017c8:	7f 06                	jg     8017d0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d0:	49 89 c0             	mov    %rax,%r8
+  8017d3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8017d8:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  8017df:	00 00 00 
+  8017e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e7:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  8017ee:	00 00 00 
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  8017fd:	00 00 00 
+  801800:	41 ff d1             	call   *%r9
+
+0000000000801803 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	53                   	push   %rbx
+  801808:	48 83 ec 08          	sub    $0x8,%rsp
+  80180c:	48 89 f1             	mov    %rsi,%rcx
+  80180f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801812:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801815:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181f:	be 00 00 00 00       	mov    $0x0,%esi
+  801824:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80182c:	48 85 c0             	test   %rax,%rax
+  80182f:	7f 06                	jg     801837 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801831:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801835:	c9                   	leave
+  801836:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801837:	49 89 c0             	mov    %rax,%r8
+  80183a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80183f:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  801846:	00 00 00 
+  801849:	be 26 00 00 00       	mov    $0x26,%esi
+  80184e:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801855:	00 00 00 
+  801858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185d:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  801864:	00 00 00 
+  801867:	41 ff d1             	call   *%r9
+
+000000000080186a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80186a:	55                   	push   %rbp
+  80186b:	48 89 e5             	mov    %rsp,%rbp
+  80186e:	53                   	push   %rbx
+  80186f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801873:	48 63 ce             	movslq %esi,%rcx
+  801876:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801879:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801883:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801888:	be 00 00 00 00       	mov    $0x0,%esi
+  80188d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801893:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801895:	48 85 c0             	test   %rax,%rax
+  801898:	7f 06                	jg     8018a0 <sys_env_set_status+0x36>
+}
+  80189a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189e:	c9                   	leave
+  80189f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a0:	49 89 c0             	mov    %rax,%r8
+  8018a3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8018a8:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  8018af:	00 00 00 
+  8018b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b7:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  8018be:	00 00 00 
+  8018c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c6:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  8018cd:	00 00 00 
+  8018d0:	41 ff d1             	call   *%r9
+
+00000000008018d3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018d3:	55                   	push   %rbp
+  8018d4:	48 89 e5             	mov    %rsp,%rbp
+  8018d7:	53                   	push   %rbx
+  8018d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018dc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018fe:	48 85 c0             	test   %rax,%rax
+  801901:	7f 06                	jg     801909 <sys_env_set_trapframe+0x36>
+}
+  801903:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801909:	49 89 c0             	mov    %rax,%r8
+  80190c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801911:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  801918:	00 00 00 
+  80191b:	be 26 00 00 00       	mov    $0x26,%esi
+  801920:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801927:	00 00 00 
+  80192a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192f:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  801936:	00 00 00 
+  801939:	41 ff d1             	call   *%r9
+
+000000000080193c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80193c:	55                   	push   %rbp
+  80193d:	48 89 e5             	mov    %rsp,%rbp
+  801940:	53                   	push   %rbx
+  801941:	48 83 ec 08          	sub    $0x8,%rsp
+  801945:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801948:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80194b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801955:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195a:	be 00 00 00 00       	mov    $0x0,%esi
+  80195f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801965:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801967:	48 85 c0             	test   %rax,%rax
+  80196a:	7f 06                	jg     801972 <sys_env_set_pgfault_upcall+0x36>
+}
+  80196c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801970:	c9                   	leave
+  801971:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801972:	49 89 c0             	mov    %rax,%r8
+  801975:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80197a:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  801981:	00 00 00 
+  801984:	be 26 00 00 00       	mov    $0x26,%esi
+  801989:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801990:	00 00 00 
+  801993:	b8 00 00 00 00       	mov    $0x0,%eax
+  801998:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  80199f:	00 00 00 
+  8019a2:	41 ff d1             	call   *%r9
+
+00000000008019a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019a5:	55                   	push   %rbp
+  8019a6:	48 89 e5             	mov    %rsp,%rbp
+  8019a9:	53                   	push   %rbx
+  8019aa:	89 f8                	mov    %edi,%eax
+  8019ac:	49 89 f1             	mov    %rsi,%r9
+  8019af:	48 89 d3             	mov    %rdx,%rbx
+  8019b2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019b5:	49 63 f0             	movslq %r8d,%rsi
+  8019b8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019bb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019c0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c9:	cd 30                	int    $0x30
+}
+  8019cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+00000000008019d1 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	53                   	push   %rbx
+  8019d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019da:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8019dd:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e5:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019fa:	48 85 c0             	test   %rax,%rax
+  8019fd:	7f 06                	jg     801a05 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a05:	49 89 c0             	mov    %rax,%r8
+  801a08:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801a0d:	48 ba 08 4a 80 00 00 	movabs $0x804a08,%rdx
+  801a14:	00 00 00 
+  801a17:	be 26 00 00 00       	mov    $0x26,%esi
+  801a1c:	48 bf 27 4a 80 00 00 	movabs $0x804a27,%rdi
+  801a23:	00 00 00 
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	49 b9 36 06 80 00 00 	movabs $0x800636,%r9
+  801a32:	00 00 00 
+  801a35:	41 ff d1             	call   *%r9
+
+0000000000801a38 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a41:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+}
+  801a4d:	5d                   	pop    %rbp
+  801a4e:	c3                   	ret
+
+0000000000801a4f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a4f:	55                   	push   %rbp
+  801a50:	48 89 e5             	mov    %rsp,%rbp
+  801a53:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a54:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a78:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7e:	c9                   	leave
+  801a7f:	c3                   	ret
+
+0000000000801a80 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801a80:	55                   	push   %rbp
+  801a81:	48 89 e5             	mov    %rsp,%rbp
+  801a84:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801a85:	48 63 ce             	movslq %esi,%rcx
+  801a88:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801a8c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa6:	cd 30                	int    $0x30
+}
+  801aa8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+0000000000801aae <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801aae:	55                   	push   %rbp
+  801aaf:	48 89 e5             	mov    %rsp,%rbp
+  801ab2:	53                   	push   %rbx
+  801ab3:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801ab6:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801aba:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ace:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ad4:	cd 30                	int    $0x30
+}
+  801ad6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ada:	c9                   	leave
+  801adb:	c3                   	ret
+
+0000000000801adc <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801adc:	55                   	push   %rbp
+  801add:	48 89 e5             	mov    %rsp,%rbp
+  801ae0:	53                   	push   %rbx
+  801ae1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801ae4:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aec:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af4:	be 00 00 00 00       	mov    $0x0,%esi
+  801af9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aff:	cd 30                	int    $0x30
+}
+  801b01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b05:	c9                   	leave
+  801b06:	c3                   	ret
+
+0000000000801b07 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b07:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b0e:	ff ff ff 
+  801b11:	48 01 f8             	add    %rdi,%rax
+  801b14:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b18:	c3                   	ret
+
+0000000000801b19 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b19:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b20:	ff ff ff 
+  801b23:	48 01 f8             	add    %rdi,%rax
+  801b26:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b2a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b30:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b34:	c3                   	ret
+
+0000000000801b35 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b35:	55                   	push   %rbp
+  801b36:	48 89 e5             	mov    %rsp,%rbp
+  801b39:	41 57                	push   %r15
+  801b3b:	41 56                	push   %r14
+  801b3d:	41 55                	push   %r13
+  801b3f:	41 54                	push   %r12
+  801b41:	53                   	push   %rbx
+  801b42:	48 83 ec 08          	sub    $0x8,%rsp
+  801b46:	49 89 ff             	mov    %rdi,%r15
+  801b49:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b4e:	49 bd 24 40 80 00 00 	movabs $0x804024,%r13
+  801b55:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b58:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b5e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b61:	48 89 df             	mov    %rbx,%rdi
+  801b64:	41 ff d5             	call   *%r13
+  801b67:	83 e0 04             	and    $0x4,%eax
+  801b6a:	74 17                	je     801b83 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b6c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b73:	4c 39 f3             	cmp    %r14,%rbx
+  801b76:	75 e6                	jne    801b5e <fd_alloc+0x29>
+  801b78:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b7e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b83:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b86:	48 83 c4 08          	add    $0x8,%rsp
+  801b8a:	5b                   	pop    %rbx
+  801b8b:	41 5c                	pop    %r12
+  801b8d:	41 5d                	pop    %r13
+  801b8f:	41 5e                	pop    %r14
+  801b91:	41 5f                	pop    %r15
+  801b93:	5d                   	pop    %rbp
+  801b94:	c3                   	ret
+
+0000000000801b95 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b95:	83 ff 1f             	cmp    $0x1f,%edi
+  801b98:	77 39                	ja     801bd3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	41 54                	push   %r12
+  801ba0:	53                   	push   %rbx
+  801ba1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ba4:	48 63 df             	movslq %edi,%rbx
+  801ba7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bae:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bb2:	48 89 df             	mov    %rbx,%rdi
+  801bb5:	48 b8 24 40 80 00 00 	movabs $0x804024,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+  801bc1:	a8 04                	test   $0x4,%al
+  801bc3:	74 14                	je     801bd9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bc5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bce:	5b                   	pop    %rbx
+  801bcf:	41 5c                	pop    %r12
+  801bd1:	5d                   	pop    %rbp
+  801bd2:	c3                   	ret
+        return -E_INVAL;
+  801bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bd8:	c3                   	ret
+        return -E_INVAL;
+  801bd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bde:	eb ee                	jmp    801bce <fd_lookup+0x39>
+
+0000000000801be0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801be0:	55                   	push   %rbp
+  801be1:	48 89 e5             	mov    %rsp,%rbp
+  801be4:	41 54                	push   %r12
+  801be6:	53                   	push   %rbx
+  801be7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801bea:	48 b8 e0 4a 80 00 00 	movabs $0x804ae0,%rax
+  801bf1:	00 00 00 
+  801bf4:	48 bb 20 68 80 00 00 	movabs $0x806820,%rbx
+  801bfb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801bfe:	39 3b                	cmp    %edi,(%rbx)
+  801c00:	74 47                	je     801c49 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c02:	48 83 c0 08          	add    $0x8,%rax
+  801c06:	48 8b 18             	mov    (%rax),%rbx
+  801c09:	48 85 db             	test   %rbx,%rbx
+  801c0c:	75 f0                	jne    801bfe <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c0e:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  801c15:	00 00 00 
+  801c18:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c1e:	89 fa                	mov    %edi,%edx
+  801c20:	48 bf 38 4a 80 00 00 	movabs $0x804a38,%rdi
+  801c27:	00 00 00 
+  801c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2f:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  801c36:	00 00 00 
+  801c39:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c40:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c44:	5b                   	pop    %rbx
+  801c45:	41 5c                	pop    %r12
+  801c47:	5d                   	pop    %rbp
+  801c48:	c3                   	ret
+            return 0;
+  801c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4e:	eb f0                	jmp    801c40 <dev_lookup+0x60>
+
+0000000000801c50 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c50:	55                   	push   %rbp
+  801c51:	48 89 e5             	mov    %rsp,%rbp
+  801c54:	41 55                	push   %r13
+  801c56:	41 54                	push   %r12
+  801c58:	53                   	push   %rbx
+  801c59:	48 83 ec 18          	sub    $0x18,%rsp
+  801c5d:	48 89 fb             	mov    %rdi,%rbx
+  801c60:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c63:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c6a:	ff ff ff 
+  801c6d:	48 01 df             	add    %rbx,%rdi
+  801c70:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c74:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c78:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  801c7f:	00 00 00 
+  801c82:	ff d0                	call   *%rax
+  801c84:	41 89 c5             	mov    %eax,%r13d
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 06                	js     801c91 <fd_close+0x41>
+  801c8b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c8f:	74 1a                	je     801cab <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c91:	45 84 e4             	test   %r12b,%r12b
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c9d:	44 89 e8             	mov    %r13d,%eax
+  801ca0:	48 83 c4 18          	add    $0x18,%rsp
+  801ca4:	5b                   	pop    %rbx
+  801ca5:	41 5c                	pop    %r12
+  801ca7:	41 5d                	pop    %r13
+  801ca9:	5d                   	pop    %rbp
+  801caa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cab:	8b 3b                	mov    (%rbx),%edi
+  801cad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cb1:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+  801cbd:	41 89 c5             	mov    %eax,%r13d
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 1b                	js     801cdf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ccc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801cd2:	48 85 c0             	test   %rax,%rax
+  801cd5:	74 08                	je     801cdf <fd_close+0x8f>
+  801cd7:	48 89 df             	mov    %rbx,%rdi
+  801cda:	ff d0                	call   *%rax
+  801cdc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce4:	48 89 de             	mov    %rbx,%rsi
+  801ce7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cec:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801cf3:	00 00 00 
+  801cf6:	ff d0                	call   *%rax
+    return res;
+  801cf8:	eb a3                	jmp    801c9d <fd_close+0x4d>
+
+0000000000801cfa <close>:
+
+int
+close(int fdnum) {
+  801cfa:	55                   	push   %rbp
+  801cfb:	48 89 e5             	mov    %rsp,%rbp
+  801cfe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d02:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d06:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 15                	js     801d2b <close+0x31>
+
+    return fd_close(fd, 1);
+  801d16:	be 01 00 00 00       	mov    $0x1,%esi
+  801d1b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d1f:	48 b8 50 1c 80 00 00 	movabs $0x801c50,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+}
+  801d2b:	c9                   	leave
+  801d2c:	c3                   	ret
+
+0000000000801d2d <close_all>:
+
+void
+close_all(void) {
+  801d2d:	55                   	push   %rbp
+  801d2e:	48 89 e5             	mov    %rsp,%rbp
+  801d31:	41 54                	push   %r12
+  801d33:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d39:	49 bc fa 1c 80 00 00 	movabs $0x801cfa,%r12
+  801d40:	00 00 00 
+  801d43:	89 df                	mov    %ebx,%edi
+  801d45:	41 ff d4             	call   *%r12
+  801d48:	83 c3 01             	add    $0x1,%ebx
+  801d4b:	83 fb 20             	cmp    $0x20,%ebx
+  801d4e:	75 f3                	jne    801d43 <close_all+0x16>
+}
+  801d50:	5b                   	pop    %rbx
+  801d51:	41 5c                	pop    %r12
+  801d53:	5d                   	pop    %rbp
+  801d54:	c3                   	ret
+
+0000000000801d55 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d55:	55                   	push   %rbp
+  801d56:	48 89 e5             	mov    %rsp,%rbp
+  801d59:	41 57                	push   %r15
+  801d5b:	41 56                	push   %r14
+  801d5d:	41 55                	push   %r13
+  801d5f:	41 54                	push   %r12
+  801d61:	53                   	push   %rbx
+  801d62:	48 83 ec 18          	sub    $0x18,%rsp
+  801d66:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d69:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d6d:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  801d74:	00 00 00 
+  801d77:	ff d0                	call   *%rax
+  801d79:	89 c3                	mov    %eax,%ebx
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	0f 88 b8 00 00 00    	js     801e3b <dup+0xe6>
+    close(newfdnum);
+  801d83:	44 89 e7             	mov    %r12d,%edi
+  801d86:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d92:	4d 63 ec             	movslq %r12d,%r13
+  801d95:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d9c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801da0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801da4:	4c 89 ff             	mov    %r15,%rdi
+  801da7:	49 be 19 1b 80 00 00 	movabs $0x801b19,%r14
+  801dae:	00 00 00 
+  801db1:	41 ff d6             	call   *%r14
+  801db4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801db7:	4c 89 ef             	mov    %r13,%rdi
+  801dba:	41 ff d6             	call   *%r14
+  801dbd:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801dc0:	48 89 df             	mov    %rbx,%rdi
+  801dc3:	48 b8 24 40 80 00 00 	movabs $0x804024,%rax
+  801dca:	00 00 00 
+  801dcd:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801dcf:	a8 04                	test   $0x4,%al
+  801dd1:	74 2b                	je     801dfe <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801dd3:	41 89 c1             	mov    %eax,%r9d
+  801dd6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ddc:	4c 89 f1             	mov    %r14,%rcx
+  801ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de4:	48 89 de             	mov    %rbx,%rsi
+  801de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dec:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	89 c3                	mov    %eax,%ebx
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 4e                	js     801e4c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801dfe:	4c 89 ff             	mov    %r15,%rdi
+  801e01:	48 b8 24 40 80 00 00 	movabs $0x804024,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e10:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e16:	4c 89 e9             	mov    %r13,%rcx
+  801e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1e:	4c 89 fe             	mov    %r15,%rsi
+  801e21:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e26:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+  801e32:	89 c3                	mov    %eax,%ebx
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 14                	js     801e4c <dup+0xf7>
+
+    return newfdnum;
+  801e38:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e3b:	89 d8                	mov    %ebx,%eax
+  801e3d:	48 83 c4 18          	add    $0x18,%rsp
+  801e41:	5b                   	pop    %rbx
+  801e42:	41 5c                	pop    %r12
+  801e44:	41 5d                	pop    %r13
+  801e46:	41 5e                	pop    %r14
+  801e48:	41 5f                	pop    %r15
+  801e4a:	5d                   	pop    %rbp
+  801e4b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e51:	4c 89 ee             	mov    %r13,%rsi
+  801e54:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e59:	49 bc 03 18 80 00 00 	movabs $0x801803,%r12
+  801e60:	00 00 00 
+  801e63:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e6b:	4c 89 f6             	mov    %r14,%rsi
+  801e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e73:	41 ff d4             	call   *%r12
+    return res;
+  801e76:	eb c3                	jmp    801e3b <dup+0xe6>
+
+0000000000801e78 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e78:	55                   	push   %rbp
+  801e79:	48 89 e5             	mov    %rsp,%rbp
+  801e7c:	41 56                	push   %r14
+  801e7e:	41 55                	push   %r13
+  801e80:	41 54                	push   %r12
+  801e82:	53                   	push   %rbx
+  801e83:	48 83 ec 10          	sub    $0x10,%rsp
+  801e87:	89 fb                	mov    %edi,%ebx
+  801e89:	49 89 f4             	mov    %rsi,%r12
+  801e8c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e93:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 4c                	js     801eef <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ea3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ea7:	41 8b 3e             	mov    (%r14),%edi
+  801eaa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eae:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 35                	js     801ef3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ebe:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ec2:	83 e0 03             	and    $0x3,%eax
+  801ec5:	83 f8 01             	cmp    $0x1,%eax
+  801ec8:	74 2d                	je     801ef7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801eca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ece:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ed2:	48 85 c0             	test   %rax,%rax
+  801ed5:	74 56                	je     801f2d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ed7:	4c 89 ea             	mov    %r13,%rdx
+  801eda:	4c 89 e6             	mov    %r12,%rsi
+  801edd:	4c 89 f7             	mov    %r14,%rdi
+  801ee0:	ff d0                	call   *%rax
+}
+  801ee2:	48 83 c4 10          	add    $0x10,%rsp
+  801ee6:	5b                   	pop    %rbx
+  801ee7:	41 5c                	pop    %r12
+  801ee9:	41 5d                	pop    %r13
+  801eeb:	41 5e                	pop    %r14
+  801eed:	5d                   	pop    %rbp
+  801eee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eef:	48 98                	cltq
+  801ef1:	eb ef                	jmp    801ee2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef3:	48 98                	cltq
+  801ef5:	eb eb                	jmp    801ee2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ef7:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  801efe:	00 00 00 
+  801f01:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f07:	89 da                	mov    %ebx,%edx
+  801f09:	48 bf 99 4a 80 00 00 	movabs $0x804a99,%rdi
+  801f10:	00 00 00 
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f18:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  801f1f:	00 00 00 
+  801f22:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f24:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f2b:	eb b5                	jmp    801ee2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f2d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f34:	eb ac                	jmp    801ee2 <read+0x6a>
+
+0000000000801f36 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801f36:	55                   	push   %rbp
+  801f37:	48 89 e5             	mov    %rsp,%rbp
+  801f3a:	41 56                	push   %r14
+  801f3c:	41 55                	push   %r13
+  801f3e:	41 54                	push   %r12
+  801f40:	53                   	push   %rbx
+  801f41:	48 83 ec 10          	sub    $0x10,%rsp
+  801f45:	89 fb                	mov    %edi,%ebx
+  801f47:	49 89 f4             	mov    %rsi,%r12
+  801f4a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f4d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f51:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 41                	js     801fa2 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f61:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f65:	41 8b 3e             	mov    (%r14),%edi
+  801f68:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f6c:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 35                	js     801fb1 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f7c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f80:	83 e0 03             	and    $0x3,%eax
+  801f83:	83 f8 01             	cmp    $0x1,%eax
+  801f86:	74 2d                	je     801fb5 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f8c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f90:	48 85 c0             	test   %rax,%rax
+  801f93:	74 56                	je     801feb <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801f95:	4c 89 ea             	mov    %r13,%rdx
+  801f98:	4c 89 e6             	mov    %r12,%rsi
+  801f9b:	4c 89 f7             	mov    %r14,%rdi
+  801f9e:	ff d0                	call   *%rax
+  801fa0:	eb 02                	jmp    801fa4 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa2:	48 98                	cltq
+}
+  801fa4:	48 83 c4 10          	add    $0x10,%rsp
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	41 5d                	pop    %r13
+  801fad:	41 5e                	pop    %r14
+  801faf:	5d                   	pop    %rbp
+  801fb0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb1:	48 98                	cltq
+  801fb3:	eb ef                	jmp    801fa4 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fb5:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  801fbc:	00 00 00 
+  801fbf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fc5:	89 da                	mov    %ebx,%edx
+  801fc7:	48 bf 58 4a 80 00 00 	movabs $0x804a58,%rdi
+  801fce:	00 00 00 
+  801fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd6:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  801fdd:	00 00 00 
+  801fe0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fe2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fe9:	eb b9                	jmp    801fa4 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801feb:	4c 89 ea             	mov    %r13,%rdx
+  801fee:	4c 89 e6             	mov    %r12,%rsi
+  801ff1:	89 df                	mov    %ebx,%edi
+  801ff3:	48 b8 78 1e 80 00 00 	movabs $0x801e78,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+  801fff:	eb a3                	jmp    801fa4 <readmap+0x6e>
+
+0000000000802001 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802001:	55                   	push   %rbp
+  802002:	48 89 e5             	mov    %rsp,%rbp
+  802005:	41 57                	push   %r15
+  802007:	41 56                	push   %r14
+  802009:	41 55                	push   %r13
+  80200b:	41 54                	push   %r12
+  80200d:	53                   	push   %rbx
+  80200e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802012:	48 85 d2             	test   %rdx,%rdx
+  802015:	74 54                	je     80206b <readn+0x6a>
+  802017:	41 89 fd             	mov    %edi,%r13d
+  80201a:	49 89 f6             	mov    %rsi,%r14
+  80201d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802020:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802025:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80202a:	49 bf 78 1e 80 00 00 	movabs $0x801e78,%r15
+  802031:	00 00 00 
+  802034:	4c 89 e2             	mov    %r12,%rdx
+  802037:	48 29 f2             	sub    %rsi,%rdx
+  80203a:	4c 01 f6             	add    %r14,%rsi
+  80203d:	44 89 ef             	mov    %r13d,%edi
+  802040:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 20                	js     802067 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802047:	01 c3                	add    %eax,%ebx
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	74 08                	je     802055 <readn+0x54>
+  80204d:	48 63 f3             	movslq %ebx,%rsi
+  802050:	4c 39 e6             	cmp    %r12,%rsi
+  802053:	72 df                	jb     802034 <readn+0x33>
+    }
+    return res;
+  802055:	48 63 c3             	movslq %ebx,%rax
+}
+  802058:	48 83 c4 08          	add    $0x8,%rsp
+  80205c:	5b                   	pop    %rbx
+  80205d:	41 5c                	pop    %r12
+  80205f:	41 5d                	pop    %r13
+  802061:	41 5e                	pop    %r14
+  802063:	41 5f                	pop    %r15
+  802065:	5d                   	pop    %rbp
+  802066:	c3                   	ret
+        if (inc < 0) return inc;
+  802067:	48 98                	cltq
+  802069:	eb ed                	jmp    802058 <readn+0x57>
+    int inc = 1, res = 0;
+  80206b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802070:	eb e3                	jmp    802055 <readn+0x54>
+
+0000000000802072 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802072:	55                   	push   %rbp
+  802073:	48 89 e5             	mov    %rsp,%rbp
+  802076:	41 56                	push   %r14
+  802078:	41 55                	push   %r13
+  80207a:	41 54                	push   %r12
+  80207c:	53                   	push   %rbx
+  80207d:	48 83 ec 10          	sub    $0x10,%rsp
+  802081:	89 fb                	mov    %edi,%ebx
+  802083:	49 89 f4             	mov    %rsi,%r12
+  802086:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802089:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80208d:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+  802099:	85 c0                	test   %eax,%eax
+  80209b:	78 47                	js     8020e4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80209d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020a1:	41 8b 3e             	mov    (%r14),%edi
+  8020a4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020a8:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 30                	js     8020e8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020b8:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020bd:	74 2d                	je     8020ec <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020c7:	48 85 c0             	test   %rax,%rax
+  8020ca:	74 56                	je     802122 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020cc:	4c 89 ea             	mov    %r13,%rdx
+  8020cf:	4c 89 e6             	mov    %r12,%rsi
+  8020d2:	4c 89 f7             	mov    %r14,%rdi
+  8020d5:	ff d0                	call   *%rax
+}
+  8020d7:	48 83 c4 10          	add    $0x10,%rsp
+  8020db:	5b                   	pop    %rbx
+  8020dc:	41 5c                	pop    %r12
+  8020de:	41 5d                	pop    %r13
+  8020e0:	41 5e                	pop    %r14
+  8020e2:	5d                   	pop    %rbp
+  8020e3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020e4:	48 98                	cltq
+  8020e6:	eb ef                	jmp    8020d7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020e8:	48 98                	cltq
+  8020ea:	eb eb                	jmp    8020d7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020ec:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8020f3:	00 00 00 
+  8020f6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020fc:	89 da                	mov    %ebx,%edx
+  8020fe:	48 bf b5 4a 80 00 00 	movabs $0x804ab5,%rdi
+  802105:	00 00 00 
+  802108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210d:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  802114:	00 00 00 
+  802117:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802119:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802120:	eb b5                	jmp    8020d7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802122:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802129:	eb ac                	jmp    8020d7 <write+0x65>
+
+000000000080212b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80212b:	55                   	push   %rbp
+  80212c:	48 89 e5             	mov    %rsp,%rbp
+  80212f:	53                   	push   %rbx
+  802130:	48 83 ec 18          	sub    $0x18,%rsp
+  802134:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802136:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213a:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+  802146:	85 c0                	test   %eax,%eax
+  802148:	78 0c                	js     802156 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80214a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80214e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802151:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802156:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215a:	c9                   	leave
+  80215b:	c3                   	ret
+
+000000000080215c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80215c:	55                   	push   %rbp
+  80215d:	48 89 e5             	mov    %rsp,%rbp
+  802160:	41 55                	push   %r13
+  802162:	41 54                	push   %r12
+  802164:	53                   	push   %rbx
+  802165:	48 83 ec 18          	sub    $0x18,%rsp
+  802169:	89 fb                	mov    %edi,%ebx
+  80216b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80216e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802172:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	78 38                	js     8021ba <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802182:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802186:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80218a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80218e:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 1c                	js     8021ba <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80219e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021a3:	74 20                	je     8021c5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021a9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8021ad:	48 85 c0             	test   %rax,%rax
+  8021b0:	74 47                	je     8021f9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021b2:	44 89 e6             	mov    %r12d,%esi
+  8021b5:	4c 89 ef             	mov    %r13,%rdi
+  8021b8:	ff d0                	call   *%rax
+}
+  8021ba:	48 83 c4 18          	add    $0x18,%rsp
+  8021be:	5b                   	pop    %rbx
+  8021bf:	41 5c                	pop    %r12
+  8021c1:	41 5d                	pop    %r13
+  8021c3:	5d                   	pop    %rbp
+  8021c4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021c5:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8021cc:	00 00 00 
+  8021cf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021d5:	89 da                	mov    %ebx,%edx
+  8021d7:	48 bf 78 4a 80 00 00 	movabs $0x804a78,%rdi
+  8021de:	00 00 00 
+  8021e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e6:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  8021ed:	00 00 00 
+  8021f0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f7:	eb c1                	jmp    8021ba <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021f9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021fe:	eb ba                	jmp    8021ba <ftruncate+0x5e>
+
+0000000000802200 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802200:	55                   	push   %rbp
+  802201:	48 89 e5             	mov    %rsp,%rbp
+  802204:	41 54                	push   %r12
+  802206:	53                   	push   %rbx
+  802207:	48 83 ec 10          	sub    $0x10,%rsp
+  80220b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80220e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802212:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  802219:	00 00 00 
+  80221c:	ff d0                	call   *%rax
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	78 4e                	js     802270 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802222:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802226:	41 8b 3c 24          	mov    (%r12),%edi
+  80222a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80222e:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 32                	js     802270 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80223e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802242:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802247:	74 30                	je     802279 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802249:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80224c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802253:	00 00 00 
+    stat->st_isdir = 0;
+  802256:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80225d:	00 00 00 
+    stat->st_dev = dev;
+  802260:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802267:	48 89 de             	mov    %rbx,%rsi
+  80226a:	4c 89 e7             	mov    %r12,%rdi
+  80226d:	ff 50 30             	call   *0x30(%rax)
+}
+  802270:	48 83 c4 10          	add    $0x10,%rsp
+  802274:	5b                   	pop    %rbx
+  802275:	41 5c                	pop    %r12
+  802277:	5d                   	pop    %rbp
+  802278:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802279:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80227e:	eb f0                	jmp    802270 <fstat+0x70>
+
+0000000000802280 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802280:	55                   	push   %rbp
+  802281:	48 89 e5             	mov    %rsp,%rbp
+  802284:	41 54                	push   %r12
+  802286:	53                   	push   %rbx
+  802287:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80228a:	be 00 00 00 00       	mov    $0x0,%esi
+  80228f:	48 b8 d7 2f 80 00 00 	movabs $0x802fd7,%rax
+  802296:	00 00 00 
+  802299:	ff d0                	call   *%rax
+  80229b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	78 25                	js     8022c6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022a1:	4c 89 e6             	mov    %r12,%rsi
+  8022a4:	89 c7                	mov    %eax,%edi
+  8022a6:	48 b8 00 22 80 00 00 	movabs $0x802200,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+  8022b2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022b5:	89 df                	mov    %ebx,%edi
+  8022b7:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  8022be:	00 00 00 
+  8022c1:	ff d0                	call   *%rax
+
+    return res;
+  8022c3:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022c6:	89 d8                	mov    %ebx,%eax
+  8022c8:	5b                   	pop    %rbx
+  8022c9:	41 5c                	pop    %r12
+  8022cb:	5d                   	pop    %rbp
+  8022cc:	c3                   	ret
+
+00000000008022cd <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8022cd:	55                   	push   %rbp
+  8022ce:	48 89 e5             	mov    %rsp,%rbp
+  8022d1:	41 54                	push   %r12
+  8022d3:	53                   	push   %rbx
+  8022d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d8:	48 89 fb             	mov    %rdi,%rbx
+  8022db:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022de:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022e2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022e7:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8022ee:	00 00 00 
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 1f                	js     802316 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  8022f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022fb:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8022ff:	48 85 c0             	test   %rax,%rax
+  802302:	74 1b                	je     80231f <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802304:	4c 89 e6             	mov    %r12,%rsi
+  802307:	48 89 df             	mov    %rbx,%rdi
+  80230a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802313:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802316:	48 83 c4 10          	add    $0x10,%rsp
+  80231a:	5b                   	pop    %rbx
+  80231b:	41 5c                	pop    %r12
+  80231d:	5d                   	pop    %rbp
+  80231e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80231f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802324:	eb f0                	jmp    802316 <create_snapshot+0x49>
+
+0000000000802326 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802326:	55                   	push   %rbp
+  802327:	48 89 e5             	mov    %rsp,%rbp
+  80232a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80232e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802332:	bf 66 00 00 00       	mov    $0x66,%edi
+  802337:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+  802343:	85 c0                	test   %eax,%eax
+  802345:	78 1e                	js     802365 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80234b:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80234f:	48 85 d2             	test   %rdx,%rdx
+  802352:	74 13                	je     802367 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802354:	b8 00 00 00 00       	mov    $0x0,%eax
+  802359:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802362:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802365:	c9                   	leave
+  802366:	c3                   	ret
+        return -E_NOT_SUPP;
+  802367:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80236c:	eb f7                	jmp    802365 <print_snapshot_list+0x3f>
+
+000000000080236e <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80236e:	55                   	push   %rbp
+  80236f:	48 89 e5             	mov    %rsp,%rbp
+  802372:	53                   	push   %rbx
+  802373:	48 83 ec 18          	sub    $0x18,%rsp
+  802377:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80237a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80237e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802383:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  80238a:	00 00 00 
+  80238d:	ff d0                	call   *%rax
+  80238f:	85 c0                	test   %eax,%eax
+  802391:	78 1c                	js     8023af <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802393:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802397:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80239b:	48 85 c0             	test   %rax,%rax
+  80239e:	74 15                	je     8023b5 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8023a0:	48 89 df             	mov    %rbx,%rdi
+  8023a3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ac:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8023af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b3:	c9                   	leave
+  8023b4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023b5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023ba:	eb f3                	jmp    8023af <accept_snapshot+0x41>
+
+00000000008023bc <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8023bc:	55                   	push   %rbp
+  8023bd:	48 89 e5             	mov    %rsp,%rbp
+  8023c0:	53                   	push   %rbx
+  8023c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c5:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023c8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023cc:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023d1:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 1c                	js     8023fd <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8023e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023e5:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8023e9:	48 85 c0             	test   %rax,%rax
+  8023ec:	74 15                	je     802403 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8023ee:	48 89 df             	mov    %rbx,%rdi
+  8023f1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fa:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8023fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802401:	c9                   	leave
+  802402:	c3                   	ret
+        return -E_NOT_SUPP;
+  802403:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802408:	eb f3                	jmp    8023fd <delete_snapshot+0x41>
+
+000000000080240a <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80240a:	55                   	push   %rbp
+  80240b:	48 89 e5             	mov    %rsp,%rbp
+  80240e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802412:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802416:	bf 66 00 00 00       	mov    $0x66,%edi
+  80241b:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+  802427:	85 c0                	test   %eax,%eax
+  802429:	78 14                	js     80243f <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80242b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80242f:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802433:	48 85 d2             	test   %rdx,%rdx
+  802436:	74 09                	je     802441 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80243f:	c9                   	leave
+  802440:	c3                   	ret
+        return -E_NOT_SUPP;
+  802441:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802446:	eb f7                	jmp    80243f <gc_snapshots+0x35>
+
+0000000000802448 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802448:	55                   	push   %rbp
+  802449:	48 89 e5             	mov    %rsp,%rbp
+  80244c:	41 56                	push   %r14
+  80244e:	41 55                	push   %r13
+  802450:	41 54                	push   %r12
+  802452:	53                   	push   %rbx
+  802453:	48 83 ec 10          	sub    $0x10,%rsp
+  802457:	48 89 fb             	mov    %rdi,%rbx
+  80245a:	49 89 f4             	mov    %rsi,%r12
+  80245d:	49 89 d5             	mov    %rdx,%r13
+  802460:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802463:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802467:	bf 66 00 00 00       	mov    $0x66,%edi
+  80246c:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+  802478:	85 c0                	test   %eax,%eax
+  80247a:	78 1b                	js     802497 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80247c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802480:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802484:	48 85 c0             	test   %rax,%rax
+  802487:	74 1b                	je     8024a4 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802489:	4c 89 f1             	mov    %r14,%rcx
+  80248c:	4c 89 ea             	mov    %r13,%rdx
+  80248f:	4c 89 e6             	mov    %r12,%rsi
+  802492:	48 89 df             	mov    %rbx,%rdi
+  802495:	ff d0                	call   *%rax
+
+    return res;
+}
+  802497:	48 83 c4 10          	add    $0x10,%rsp
+  80249b:	5b                   	pop    %rbx
+  80249c:	41 5c                	pop    %r12
+  80249e:	41 5d                	pop    %r13
+  8024a0:	41 5e                	pop    %r14
+  8024a2:	5d                   	pop    %rbp
+  8024a3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024a4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024a9:	eb ec                	jmp    802497 <diff_snapshots+0x4f>
+
+00000000008024ab <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+  8024af:	41 55                	push   %r13
+  8024b1:	41 54                	push   %r12
+  8024b3:	53                   	push   %rbx
+  8024b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b8:	48 89 fb             	mov    %rdi,%rbx
+  8024bb:	49 89 f4             	mov    %rsi,%r12
+  8024be:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024c1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024c5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024ca:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+  8024d6:	85 c0                	test   %eax,%eax
+  8024d8:	78 18                	js     8024f2 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8024da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024de:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8024e2:	48 85 c0             	test   %rax,%rax
+  8024e5:	74 16                	je     8024fd <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8024e7:	4c 89 ea             	mov    %r13,%rdx
+  8024ea:	4c 89 e6             	mov    %r12,%rsi
+  8024ed:	48 89 df             	mov    %rbx,%rdi
+  8024f0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8024f2:	48 83 c4 18          	add    $0x18,%rsp
+  8024f6:	5b                   	pop    %rbx
+  8024f7:	41 5c                	pop    %r12
+  8024f9:	41 5d                	pop    %r13
+  8024fb:	5d                   	pop    %rbp
+  8024fc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024fd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802502:	eb ee                	jmp    8024f2 <send_snapshot+0x47>
+
+0000000000802504 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	53                   	push   %rbx
+  802509:	48 83 ec 18          	sub    $0x18,%rsp
+  80250d:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802510:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802514:	bf 66 00 00 00       	mov    $0x66,%edi
+  802519:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802520:	00 00 00 
+  802523:	ff d0                	call   *%rax
+  802525:	85 c0                	test   %eax,%eax
+  802527:	78 12                	js     80253b <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80252d:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802531:	48 85 c0             	test   %rax,%rax
+  802534:	74 0b                	je     802541 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802536:	48 89 df             	mov    %rbx,%rdi
+  802539:	ff d0                	call   *%rax
+
+    return res;
+}
+  80253b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+        return -E_NOT_SUPP;
+  802541:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802546:	eb f3                	jmp    80253b <receive_snapshot+0x37>
+
+0000000000802548 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802548:	55                   	push   %rbp
+  802549:	48 89 e5             	mov    %rsp,%rbp
+  80254c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802550:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802554:	bf 66 00 00 00       	mov    $0x66,%edi
+  802559:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	85 c0                	test   %eax,%eax
+  802567:	78 17                	js     802580 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80256d:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802574:	48 85 d2             	test   %rdx,%rdx
+  802577:	74 09                	je     802582 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257e:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+        return -E_NOT_SUPP;
+  802582:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802587:	eb f7                	jmp    802580 <free_space_bytes+0x38>
+
+0000000000802589 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802589:	55                   	push   %rbp
+  80258a:	48 89 e5             	mov    %rsp,%rbp
+  80258d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802591:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802595:	bf 66 00 00 00       	mov    $0x66,%edi
+  80259a:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+  8025a6:	85 c0                	test   %eax,%eax
+  8025a8:	78 17                	js     8025c1 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8025aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ae:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8025b5:	48 85 d2             	test   %rdx,%rdx
+  8025b8:	74 09                	je     8025c3 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8025ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bf:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8025c1:	c9                   	leave
+  8025c2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025c3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025c8:	eb f7                	jmp    8025c1 <busy_space_bytes+0x38>
+
+00000000008025ca <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8025ca:	55                   	push   %rbp
+  8025cb:	48 89 e5             	mov    %rsp,%rbp
+  8025ce:	41 54                	push   %r12
+  8025d0:	53                   	push   %rbx
+  8025d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d5:	89 fb                	mov    %edi,%ebx
+  8025d7:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025da:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025de:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025e3:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	85 c0                	test   %eax,%eax
+  8025f1:	78 17                	js     80260a <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8025f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025f7:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8025fe:	48 85 c0             	test   %rax,%rax
+  802601:	74 10                	je     802613 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802603:	4c 89 e6             	mov    %r12,%rsi
+  802606:	89 df                	mov    %ebx,%edi
+  802608:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80260a:	48 83 c4 10          	add    $0x10,%rsp
+  80260e:	5b                   	pop    %rbx
+  80260f:	41 5c                	pop    %r12
+  802611:	5d                   	pop    %rbp
+  802612:	c3                   	ret
+        return -E_NOT_SUPP;
+  802613:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802618:	eb f0                	jmp    80260a <snapshots_space+0x40>
+
+000000000080261a <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+  80261e:	41 55                	push   %r13
+  802620:	41 54                	push   %r12
+  802622:	53                   	push   %rbx
+  802623:	48 83 ec 08          	sub    $0x8,%rsp
+  802627:	41 89 fd             	mov    %edi,%r13d
+  80262a:	48 89 f3             	mov    %rsi,%rbx
+  80262d:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802630:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  802637:	00 00 00 
+  80263a:	83 38 00             	cmpl   $0x0,(%rax)
+  80263d:	74 57                	je     802696 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80263f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802645:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80264a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802651:	00 00 00 
+  802654:	44 89 ee             	mov    %r13d,%esi
+  802657:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80265e:	00 00 00 
+  802661:	8b 38                	mov    (%rax),%edi
+  802663:	48 b8 3c 42 80 00 00 	movabs $0x80423c,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80266f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802674:	4c 89 e2             	mov    %r12,%rdx
+  802677:	48 89 de             	mov    %rbx,%rsi
+  80267a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267f:	48 b8 24 42 80 00 00 	movabs $0x804224,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+}
+  80268b:	48 83 c4 08          	add    $0x8,%rsp
+  80268f:	5b                   	pop    %rbx
+  802690:	41 5c                	pop    %r12
+  802692:	41 5d                	pop    %r13
+  802694:	5d                   	pop    %rbp
+  802695:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802696:	bf 03 00 00 00       	mov    $0x3,%edi
+  80269b:	48 b8 fa 42 80 00 00 	movabs $0x8042fa,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+  8026a7:	a3 00 a0 80 00 00 00 	movabs %eax,0x80a000
+  8026ae:	00 00 
+  8026b0:	eb 8d                	jmp    80263f <fsipc_region+0x25>
+
+00000000008026b2 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8026b2:	55                   	push   %rbp
+  8026b3:	48 89 e5             	mov    %rsp,%rbp
+  8026b6:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8026ba:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8026c1:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8026c2:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8026c6:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+}
+  8026d2:	c9                   	leave
+  8026d3:	c3                   	ret
+
+00000000008026d4 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8026d4:	85 ff                	test   %edi,%edi
+  8026d6:	78 6d                	js     802745 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	41 54                	push   %r12
+  8026de:	53                   	push   %rbx
+  8026df:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8026e2:	48 85 f6             	test   %rsi,%rsi
+  8026e5:	74 57                	je     80273e <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8026e7:	89 f8                	mov    %edi,%eax
+  8026e9:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8026f0:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8026f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f7:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026fc:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 2d                	js     802739 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80270c:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802713:	00 00 00 
+  802716:	49 63 14 24          	movslq (%r12),%rdx
+  80271a:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802721:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802726:	48 89 df             	mov    %rbx,%rdi
+  802729:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802735:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802739:	5b                   	pop    %rbx
+  80273a:	41 5c                	pop    %r12
+  80273c:	5d                   	pop    %rbp
+  80273d:	c3                   	ret
+        return -E_INVAL;
+  80273e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802743:	eb f4                	jmp    802739 <devfile_df_snapshots+0x65>
+  802745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80274a:	c3                   	ret
+
+000000000080274b <devfile_df_busy>:
+devfile_df_busy() {
+  80274b:	55                   	push   %rbp
+  80274c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80274f:	be 00 00 00 00       	mov    $0x0,%esi
+  802754:	bf 11 00 00 00       	mov    $0x11,%edi
+  802759:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+}
+  802765:	5d                   	pop    %rbp
+  802766:	c3                   	ret
+
+0000000000802767 <devfile_df_free>:
+devfile_df_free() {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80276b:	be 00 00 00 00       	mov    $0x0,%esi
+  802770:	bf 10 00 00 00       	mov    $0x10,%edi
+  802775:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  80277c:	00 00 00 
+  80277f:	ff d0                	call   *%rax
+}
+  802781:	5d                   	pop    %rbp
+  802782:	c3                   	ret
+
+0000000000802783 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802783:	55                   	push   %rbp
+  802784:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802787:	be 00 00 00 00       	mov    $0x0,%esi
+  80278c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802791:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802798:	00 00 00 
+  80279b:	ff d0                	call   *%rax
+}
+  80279d:	5d                   	pop    %rbp
+  80279e:	c3                   	ret
+
+000000000080279f <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8027a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8027ad:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c0:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027c3:	5d                   	pop    %rbp
+  8027c4:	c3                   	ret
+
+00000000008027c5 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8027c9:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8027d0:	00 00 00 
+  8027d3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8027d6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8027d8:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8027db:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027e5:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+}
+  8027f1:	5d                   	pop    %rbp
+  8027f2:	c3                   	ret
+
+00000000008027f3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027f7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027fa:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802801:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802803:	be 00 00 00 00       	mov    $0x0,%esi
+  802808:	bf 06 00 00 00       	mov    $0x6,%edi
+  80280d:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+}
+  802819:	5d                   	pop    %rbp
+  80281a:	c3                   	ret
+
+000000000080281b <devfile_write>:
+    if (!fd || !buf) {
+  80281b:	48 85 ff             	test   %rdi,%rdi
+  80281e:	0f 84 c1 00 00 00    	je     8028e5 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	41 57                	push   %r15
+  80282a:	41 56                	push   %r14
+  80282c:	41 55                	push   %r13
+  80282e:	41 54                	push   %r12
+  802830:	53                   	push   %rbx
+  802831:	48 83 ec 18          	sub    $0x18,%rsp
+  802835:	49 89 ff             	mov    %rdi,%r15
+  802838:	49 89 f5             	mov    %rsi,%r13
+  80283b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80283e:	48 85 f6             	test   %rsi,%rsi
+  802841:	0f 84 95 00 00 00    	je     8028dc <devfile_write+0xc1>
+    while (n) {
+  802847:	48 85 d2             	test   %rdx,%rdx
+  80284a:	0f 84 83 00 00 00    	je     8028d3 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802850:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802857:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  80285e:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802861:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802866:	49 39 dc             	cmp    %rbx,%r12
+  802869:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80286d:	48 89 da             	mov    %rbx,%rdx
+  802870:	4c 89 ee             	mov    %r13,%rsi
+  802873:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  80287a:	00 00 00 
+  80287d:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802889:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80288d:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802890:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802894:	be 00 00 00 00       	mov    $0x0,%esi
+  802899:	bf 04 00 00 00       	mov    $0x4,%edi
+  80289e:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+        if (write < 0) {
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 21                	js     8028cf <devfile_write+0xb4>
+        buf += write;
+  8028ae:	48 63 d0             	movslq %eax,%rdx
+  8028b1:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8028b4:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8028b7:	49 29 d4             	sub    %rdx,%r12
+  8028ba:	75 a5                	jne    802861 <devfile_write+0x46>
+    return totalWrite;
+  8028bc:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8028c0:	48 83 c4 18          	add    $0x18,%rsp
+  8028c4:	5b                   	pop    %rbx
+  8028c5:	41 5c                	pop    %r12
+  8028c7:	41 5d                	pop    %r13
+  8028c9:	41 5e                	pop    %r14
+  8028cb:	41 5f                	pop    %r15
+  8028cd:	5d                   	pop    %rbp
+  8028ce:	c3                   	ret
+            return write;
+  8028cf:	48 98                	cltq
+  8028d1:	eb ed                	jmp    8028c0 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8028d3:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8028da:	eb e0                	jmp    8028bc <devfile_write+0xa1>
+        return -E_INVAL;
+  8028dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028e3:	eb db                	jmp    8028c0 <devfile_write+0xa5>
+  8028e5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8028ec:	c3                   	ret
+
+00000000008028ed <devfile_read>:
+    if (!fd || !buf) {
+  8028ed:	48 85 ff             	test   %rdi,%rdi
+  8028f0:	0f 84 c0 00 00 00    	je     8029b6 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	41 57                	push   %r15
+  8028fc:	41 56                	push   %r14
+  8028fe:	41 55                	push   %r13
+  802900:	41 54                	push   %r12
+  802902:	53                   	push   %rbx
+  802903:	48 83 ec 18          	sub    $0x18,%rsp
+  802907:	49 89 ff             	mov    %rdi,%r15
+  80290a:	49 89 f5             	mov    %rsi,%r13
+  80290d:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802910:	48 85 f6             	test   %rsi,%rsi
+  802913:	0f 84 96 00 00 00    	je     8029af <devfile_read+0xc2>
+    while (n) {
+  802919:	48 85 d2             	test   %rdx,%rdx
+  80291c:	0f 84 87 00 00 00    	je     8029a9 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802922:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802929:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80292a:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802931:	00 00 00 
+  802934:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802938:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80293b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802940:	49 39 c4             	cmp    %rax,%r12
+  802943:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802947:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80294b:	be 00 00 00 00       	mov    $0x0,%esi
+  802950:	bf 03 00 00 00       	mov    $0x3,%edi
+  802955:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802961:	85 c0                	test   %eax,%eax
+  802963:	7e 37                	jle    80299c <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802965:	48 63 d8             	movslq %eax,%rbx
+  802968:	48 89 da             	mov    %rbx,%rdx
+  80296b:	4c 89 f6             	mov    %r14,%rsi
+  80296e:	4c 89 ef             	mov    %r13,%rdi
+  802971:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+        buf += read;
+  80297d:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802980:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802984:	49 29 dc             	sub    %rbx,%r12
+  802987:	75 ab                	jne    802934 <devfile_read+0x47>
+  return totalRead;
+  802989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80298d:	48 83 c4 18          	add    $0x18,%rsp
+  802991:	5b                   	pop    %rbx
+  802992:	41 5c                	pop    %r12
+  802994:	41 5d                	pop    %r13
+  802996:	41 5e                	pop    %r14
+  802998:	41 5f                	pop    %r15
+  80299a:	5d                   	pop    %rbp
+  80299b:	c3                   	ret
+            return read ? read : totalRead;
+  80299c:	48 63 d0             	movslq %eax,%rdx
+  80299f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029a3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029a7:	eb e4                	jmp    80298d <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8029a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8029ad:	eb da                	jmp    802989 <devfile_read+0x9c>
+        return E_INVAL;
+  8029af:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029b4:	eb d7                	jmp    80298d <devfile_read+0xa0>
+  8029b6:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029bb:	c3                   	ret
+
+00000000008029bc <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8029bc:	48 85 ff             	test   %rdi,%rdi
+  8029bf:	74 5f                	je     802a20 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8029c1:	55                   	push   %rbp
+  8029c2:	48 89 e5             	mov    %rsp,%rbp
+  8029c5:	53                   	push   %rbx
+  8029c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ca:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8029cd:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  8029d4:	00 00 00 
+  8029d7:	ff d0                	call   *%rax
+  8029d9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029df:	77 45                	ja     802a26 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8029e1:	48 89 de             	mov    %rbx,%rsi
+  8029e4:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  8029eb:	00 00 00 
+  8029ee:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8029fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ff:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a04:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a17:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a1e:	c9                   	leave
+  802a1f:	c3                   	ret
+        return -E_INVAL;
+  802a20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a25:	c3                   	ret
+        return -E_INVAL;
+  802a26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a2b:	eb ed                	jmp    802a1a <devfile_receive_snapshot+0x5e>
+
+0000000000802a2d <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802a2d:	55                   	push   %rbp
+  802a2e:	48 89 e5             	mov    %rsp,%rbp
+  802a31:	41 55                	push   %r13
+  802a33:	41 54                	push   %r12
+  802a35:	53                   	push   %rbx
+  802a36:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3a:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802a3d:	48 85 f6             	test   %rsi,%rsi
+  802a40:	0f 94 c0             	sete   %al
+  802a43:	48 85 d2             	test   %rdx,%rdx
+  802a46:	0f 94 c2             	sete   %dl
+  802a49:	08 d0                	or     %dl,%al
+  802a4b:	0f 85 ad 00 00 00    	jne    802afe <devfile_send_snapshot+0xd1>
+  802a51:	48 89 fb             	mov    %rdi,%rbx
+  802a54:	49 89 f4             	mov    %rsi,%r12
+  802a57:	48 85 ff             	test   %rdi,%rdi
+  802a5a:	0f 84 9e 00 00 00    	je     802afe <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802a60:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802a67:	00 00 00 
+  802a6a:	ff d0                	call   *%rax
+  802a6c:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a72:	0f 87 8d 00 00 00    	ja     802b05 <devfile_send_snapshot+0xd8>
+  802a78:	4c 89 e7             	mov    %r12,%rdi
+  802a7b:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802a82:	00 00 00 
+  802a85:	ff d0                	call   *%rax
+  802a87:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a8d:	77 7d                	ja     802b0c <devfile_send_snapshot+0xdf>
+  802a8f:	4c 89 ef             	mov    %r13,%rdi
+  802a92:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+  802a9e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802aa4:	77 6d                	ja     802b13 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802aa6:	48 89 de             	mov    %rbx,%rsi
+  802aa9:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802ab0:	00 00 00 
+  802ab3:	48 bb ab 10 80 00 00 	movabs $0x8010ab,%rbx
+  802aba:	00 00 00 
+  802abd:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802abf:	4c 89 e6             	mov    %r12,%rsi
+  802ac2:	48 bf 00 91 80 00 00 	movabs $0x809100,%rdi
+  802ac9:	00 00 00 
+  802acc:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802ace:	4c 89 ee             	mov    %r13,%rsi
+  802ad1:	48 bf 00 92 80 00 00 	movabs $0x809200,%rdi
+  802ad8:	00 00 00 
+  802adb:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802add:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae2:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802ae7:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+}
+  802af3:	48 83 c4 08          	add    $0x8,%rsp
+  802af7:	5b                   	pop    %rbx
+  802af8:	41 5c                	pop    %r12
+  802afa:	41 5d                	pop    %r13
+  802afc:	5d                   	pop    %rbp
+  802afd:	c3                   	ret
+        return -E_INVAL;
+  802afe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b03:	eb ee                	jmp    802af3 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b0a:	eb e7                	jmp    802af3 <devfile_send_snapshot+0xc6>
+  802b0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b11:	eb e0                	jmp    802af3 <devfile_send_snapshot+0xc6>
+  802b13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b18:	eb d9                	jmp    802af3 <devfile_send_snapshot+0xc6>
+
+0000000000802b1a <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802b1a:	48 85 ff             	test   %rdi,%rdi
+  802b1d:	0f 84 41 01 00 00    	je     802c64 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	41 57                	push   %r15
+  802b29:	41 56                	push   %r14
+  802b2b:	41 55                	push   %r13
+  802b2d:	41 54                	push   %r12
+  802b2f:	53                   	push   %rbx
+  802b30:	48 83 ec 08          	sub    $0x8,%rsp
+  802b34:	49 89 fc             	mov    %rdi,%r12
+  802b37:	49 89 f5             	mov    %rsi,%r13
+  802b3a:	48 89 d3             	mov    %rdx,%rbx
+  802b3d:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802b40:	48 85 f6             	test   %rsi,%rsi
+  802b43:	0f 84 ff 00 00 00    	je     802c48 <devfile_diff_snapshots+0x12e>
+  802b49:	48 85 d2             	test   %rdx,%rdx
+  802b4c:	0f 84 fd 00 00 00    	je     802c4f <devfile_diff_snapshots+0x135>
+  802b52:	48 85 c9             	test   %rcx,%rcx
+  802b55:	0f 84 f4 00 00 00    	je     802c4f <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802b5b:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+  802b67:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b6d:	0f 87 e3 00 00 00    	ja     802c56 <devfile_diff_snapshots+0x13c>
+  802b73:	4c 89 ef             	mov    %r13,%rdi
+  802b76:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802b7d:	00 00 00 
+  802b80:	ff d0                	call   *%rax
+  802b82:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b88:	0f 87 cf 00 00 00    	ja     802c5d <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802b8e:	4c 89 e6             	mov    %r12,%rsi
+  802b91:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802b98:	00 00 00 
+  802b9b:	4c 89 e7             	mov    %r12,%rdi
+  802b9e:	49 bf ab 10 80 00 00 	movabs $0x8010ab,%r15
+  802ba5:	00 00 00 
+  802ba8:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802bab:	4c 89 ee             	mov    %r13,%rsi
+  802bae:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802bb5:	00 
+  802bb6:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802bb9:	48 8b 03             	mov    (%rbx),%rax
+  802bbc:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802bc3:	00 
+  802bc4:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802bc8:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802bcf:	00 
+  802bd0:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802bd4:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802bdb:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802bdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802be1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802be6:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	78 43                	js     802c39 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802bf6:	49 8b 04 24          	mov    (%r12),%rax
+  802bfa:	48 89 03             	mov    %rax,(%rbx)
+  802bfd:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802c02:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802c06:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802c0b:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802c0f:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802c14:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802c18:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802c1c:	48 c1 e2 03          	shl    $0x3,%rdx
+  802c20:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802c25:	4c 89 f7             	mov    %r14,%rdi
+  802c28:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  802c2f:	00 00 00 
+  802c32:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802c34:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802c39:	48 83 c4 08          	add    $0x8,%rsp
+  802c3d:	5b                   	pop    %rbx
+  802c3e:	41 5c                	pop    %r12
+  802c40:	41 5d                	pop    %r13
+  802c42:	41 5e                	pop    %r14
+  802c44:	41 5f                	pop    %r15
+  802c46:	5d                   	pop    %rbp
+  802c47:	c3                   	ret
+        return -E_INVAL;
+  802c48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c4d:	eb ea                	jmp    802c39 <devfile_diff_snapshots+0x11f>
+  802c4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c54:	eb e3                	jmp    802c39 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802c56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c5b:	eb dc                	jmp    802c39 <devfile_diff_snapshots+0x11f>
+  802c5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c62:	eb d5                	jmp    802c39 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c69:	c3                   	ret
+
+0000000000802c6a <devfile_delete_snapshot>:
+    if (!name) {
+  802c6a:	48 85 ff             	test   %rdi,%rdi
+  802c6d:	74 5f                	je     802cce <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802c6f:	55                   	push   %rbp
+  802c70:	48 89 e5             	mov    %rsp,%rbp
+  802c73:	53                   	push   %rbx
+  802c74:	48 83 ec 08          	sub    $0x8,%rsp
+  802c78:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802c7b:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c8d:	77 45                	ja     802cd4 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802c8f:	48 89 de             	mov    %rbx,%rsi
+  802c92:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802c99:	00 00 00 
+  802c9c:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802ca8:	be 00 00 00 00       	mov    $0x0,%esi
+  802cad:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802cb2:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802cb9:	00 00 00 
+  802cbc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cbe:	85 c0                	test   %eax,%eax
+  802cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802cc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ccc:	c9                   	leave
+  802ccd:	c3                   	ret
+        return -E_INVAL;
+  802cce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cd3:	c3                   	ret
+        return -E_INVAL;
+  802cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cd9:	eb ed                	jmp    802cc8 <devfile_delete_snapshot+0x5e>
+
+0000000000802cdb <devfile_accept_snapshot>:
+    if (!name) {
+  802cdb:	48 85 ff             	test   %rdi,%rdi
+  802cde:	74 5f                	je     802d3f <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802ce0:	55                   	push   %rbp
+  802ce1:	48 89 e5             	mov    %rsp,%rbp
+  802ce4:	53                   	push   %rbx
+  802ce5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce9:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802cec:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802cf3:	00 00 00 
+  802cf6:	ff d0                	call   *%rax
+  802cf8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cfe:	77 45                	ja     802d45 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802d00:	48 89 de             	mov    %rbx,%rsi
+  802d03:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802d0a:	00 00 00 
+  802d0d:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  802d14:	00 00 00 
+  802d17:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802d19:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d23:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802d2a:	00 00 00 
+  802d2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d2f:	85 c0                	test   %eax,%eax
+  802d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d36:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+        return -E_INVAL;
+  802d3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d44:	c3                   	ret
+        return -E_INVAL;
+  802d45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d4a:	eb ed                	jmp    802d39 <devfile_accept_snapshot+0x5e>
+
+0000000000802d4c <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802d4c:	48 85 ff             	test   %rdi,%rdi
+  802d4f:	0f 84 9f 00 00 00    	je     802df4 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802d55:	55                   	push   %rbp
+  802d56:	48 89 e5             	mov    %rsp,%rbp
+  802d59:	41 54                	push   %r12
+  802d5b:	53                   	push   %rbx
+  802d5c:	48 89 fb             	mov    %rdi,%rbx
+  802d5f:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802d62:	48 85 f6             	test   %rsi,%rsi
+  802d65:	74 78                	je     802ddf <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802d67:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802d6e:	00 00 00 
+  802d71:	ff d0                	call   *%rax
+  802d73:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d79:	77 6b                	ja     802de6 <devfile_create_snapshot+0x9a>
+  802d7b:	4c 89 e7             	mov    %r12,%rdi
+  802d7e:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802d85:	00 00 00 
+  802d88:	ff d0                	call   *%rax
+  802d8a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d90:	77 5b                	ja     802ded <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802d92:	48 89 de             	mov    %rbx,%rsi
+  802d95:	48 bf 00 90 80 00 00 	movabs $0x809000,%rdi
+  802d9c:	00 00 00 
+  802d9f:	48 bb ab 10 80 00 00 	movabs $0x8010ab,%rbx
+  802da6:	00 00 00 
+  802da9:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802dab:	4c 89 e6             	mov    %r12,%rsi
+  802dae:	48 bf 00 91 80 00 00 	movabs $0x809100,%rdi
+  802db5:	00 00 00 
+  802db8:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802dba:	be 00 00 00 00       	mov    $0x0,%esi
+  802dbf:	bf 08 00 00 00       	mov    $0x8,%edi
+  802dc4:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802dcb:	00 00 00 
+  802dce:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dd0:	85 c0                	test   %eax,%eax
+  802dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd7:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802dda:	5b                   	pop    %rbx
+  802ddb:	41 5c                	pop    %r12
+  802ddd:	5d                   	pop    %rbp
+  802dde:	c3                   	ret
+        return -E_INVAL;
+  802ddf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802de4:	eb f4                	jmp    802dda <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802de6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802deb:	eb ed                	jmp    802dda <devfile_create_snapshot+0x8e>
+  802ded:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802df2:	eb e6                	jmp    802dda <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802df4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802df9:	c3                   	ret
+
+0000000000802dfa <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802dfa:	55                   	push   %rbp
+  802dfb:	48 89 e5             	mov    %rsp,%rbp
+  802dfe:	41 54                	push   %r12
+  802e00:	53                   	push   %rbx
+  802e01:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e04:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e07:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802e0e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802e10:	be 00 00 00 00       	mov    $0x0,%esi
+  802e15:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e1a:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  802e21:	00 00 00 
+  802e24:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e26:	85 c0                	test   %eax,%eax
+  802e28:	78 3d                	js     802e67 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e2a:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802e31:	00 00 00 
+  802e34:	4c 89 e6             	mov    %r12,%rsi
+  802e37:	48 89 df             	mov    %rbx,%rdi
+  802e3a:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  802e41:	00 00 00 
+  802e44:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e46:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802e4d:	00 
+  802e4e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e54:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802e5b:	00 
+  802e5c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802e62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e67:	5b                   	pop    %rbx
+  802e68:	41 5c                	pop    %r12
+  802e6a:	5d                   	pop    %rbp
+  802e6b:	c3                   	ret
+
+0000000000802e6c <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	41 57                	push   %r15
+  802e72:	41 56                	push   %r14
+  802e74:	41 55                	push   %r13
+  802e76:	41 54                	push   %r12
+  802e78:	53                   	push   %rbx
+  802e79:	48 83 ec 38          	sub    $0x38,%rsp
+  802e7d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802e81:	49 89 f5             	mov    %rsi,%r13
+  802e84:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e87:	48 89 f0             	mov    %rsi,%rax
+  802e8a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e8f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802e93:	75 4f                	jne    802ee4 <devfile_readmap+0x78>
+  802e95:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e99:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e9f:	75 1f                	jne    802ec0 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802ea1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ea5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ea9:	49 be 24 40 80 00 00 	movabs $0x804024,%r14
+  802eb0:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802eb3:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802eba:	0f 87 9d 00 00 00    	ja     802f5d <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ec0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ec4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802ec8:	4d 85 ff             	test   %r15,%r15
+  802ecb:	0f 85 cf 00 00 00    	jne    802fa0 <devfile_readmap+0x134>
+  802ed1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802ed5:	48 83 c4 38          	add    $0x38,%rsp
+  802ed9:	5b                   	pop    %rbx
+  802eda:	41 5c                	pop    %r12
+  802edc:	41 5d                	pop    %r13
+  802ede:	41 5e                	pop    %r14
+  802ee0:	41 5f                	pop    %r15
+  802ee2:	5d                   	pop    %rbp
+  802ee3:	c3                   	ret
+    size_t totalRead = 0;
+  802ee4:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802eeb:	00 
+  802eec:	eb da                	jmp    802ec8 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802eee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ef2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ef5:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  802efc:	00 00 00 
+  802eff:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802f01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f05:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802f09:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f0d:	4c 89 ee             	mov    %r13,%rsi
+  802f10:	bf 14 00 00 00       	mov    $0x14,%edi
+  802f15:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  802f1c:	00 00 00 
+  802f1f:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802f21:	85 c0                	test   %eax,%eax
+  802f23:	7e a3                	jle    802ec8 <devfile_readmap+0x5c>
+  802f25:	48 98                	cltq
+  802f27:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802f2b:	72 9b                	jb     802ec8 <devfile_readmap+0x5c>
+        buf += read;
+  802f2d:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802f30:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802f33:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802f37:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802f3e:	75 88                	jne    802ec8 <devfile_readmap+0x5c>
+  802f40:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f44:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f4a:	0f 85 78 ff ff ff    	jne    802ec8 <devfile_readmap+0x5c>
+  802f50:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802f57:	0f 86 6b ff ff ff    	jbe    802ec8 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802f5d:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802f63:	4d 39 e7             	cmp    %r12,%r15
+  802f66:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802f6a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802f71:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802f75:	0f 84 73 ff ff ff    	je     802eee <devfile_readmap+0x82>
+  802f7b:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802f7f:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802f84:	41 ff d6             	call   *%r14
+  802f87:	a8 40                	test   $0x40,%al
+  802f89:	0f 85 39 ff ff ff    	jne    802ec8 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802f8f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f96:	4c 39 e3             	cmp    %r12,%rbx
+  802f99:	72 e4                	jb     802f7f <devfile_readmap+0x113>
+  802f9b:	e9 4e ff ff ff       	jmp    802eee <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802fa0:	4c 89 fa             	mov    %r15,%rdx
+  802fa3:	4c 89 ee             	mov    %r13,%rsi
+  802fa6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802faa:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  802fb1:	00 00 00 
+  802fb4:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802fb6:	48 85 c0             	test   %rax,%rax
+  802fb9:	78 0c                	js     802fc7 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802fbb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fbf:	48 01 f0             	add    %rsi,%rax
+  802fc2:	e9 0e ff ff ff       	jmp    802ed5 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802fc7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fcb:	48 85 f6             	test   %rsi,%rsi
+  802fce:	48 0f 45 c6          	cmovne %rsi,%rax
+  802fd2:	e9 fe fe ff ff       	jmp    802ed5 <devfile_readmap+0x69>
+
+0000000000802fd7 <open>:
+open(const char *path, int mode) {
+  802fd7:	55                   	push   %rbp
+  802fd8:	48 89 e5             	mov    %rsp,%rbp
+  802fdb:	41 55                	push   %r13
+  802fdd:	41 54                	push   %r12
+  802fdf:	53                   	push   %rbx
+  802fe0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe4:	49 89 fc             	mov    %rdi,%r12
+  802fe7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fea:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ffc:	0f 87 8a 00 00 00    	ja     80308c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803002:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803006:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+  803012:	89 c3                	mov    %eax,%ebx
+  803014:	85 c0                	test   %eax,%eax
+  803016:	78 50                	js     803068 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803018:	4c 89 e6             	mov    %r12,%rsi
+  80301b:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  803022:	00 00 00 
+  803025:	48 89 df             	mov    %rbx,%rdi
+  803028:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  80302f:	00 00 00 
+  803032:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803034:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80303b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80303f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803044:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  803050:	89 c3                	mov    %eax,%ebx
+  803052:	85 c0                	test   %eax,%eax
+  803054:	78 1f                	js     803075 <open+0x9e>
+    return fd2num(fd);
+  803056:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80305a:	48 b8 07 1b 80 00 00 	movabs $0x801b07,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  803066:	89 c3                	mov    %eax,%ebx
+}
+  803068:	89 d8                	mov    %ebx,%eax
+  80306a:	48 83 c4 18          	add    $0x18,%rsp
+  80306e:	5b                   	pop    %rbx
+  80306f:	41 5c                	pop    %r12
+  803071:	41 5d                	pop    %r13
+  803073:	5d                   	pop    %rbp
+  803074:	c3                   	ret
+        fd_close(fd, 0);
+  803075:	be 00 00 00 00       	mov    $0x0,%esi
+  80307a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80307e:	48 b8 50 1c 80 00 00 	movabs $0x801c50,%rax
+  803085:	00 00 00 
+  803088:	ff d0                	call   *%rax
+        return res;
+  80308a:	eb dc                	jmp    803068 <open+0x91>
+        return -E_BAD_PATH;
+  80308c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803091:	eb d5                	jmp    803068 <open+0x91>
+
+0000000000803093 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803097:	be 00 00 00 00       	mov    $0x0,%esi
+  80309c:	bf 13 00 00 00       	mov    $0x13,%edi
+  8030a1:	48 b8 b2 26 80 00 00 	movabs $0x8026b2,%rax
+  8030a8:	00 00 00 
+  8030ab:	ff d0                	call   *%rax
+}
+  8030ad:	5d                   	pop    %rbp
+  8030ae:	c3                   	ret
+
+00000000008030af <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8030af:	55                   	push   %rbp
+  8030b0:	48 89 e5             	mov    %rsp,%rbp
+  8030b3:	41 55                	push   %r13
+  8030b5:	41 54                	push   %r12
+  8030b7:	53                   	push   %rbx
+  8030b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8030bc:	48 89 fb             	mov    %rdi,%rbx
+  8030bf:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8030c2:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8030c5:	48 b8 24 40 80 00 00 	movabs $0x804024,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+  8030d1:	41 89 c1             	mov    %eax,%r9d
+  8030d4:	4d 89 e0             	mov    %r12,%r8
+  8030d7:	49 29 d8             	sub    %rbx,%r8
+  8030da:	48 89 d9             	mov    %rbx,%rcx
+  8030dd:	44 89 ea             	mov    %r13d,%edx
+  8030e0:	48 89 de             	mov    %rbx,%rsi
+  8030e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e8:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  8030ef:	00 00 00 
+  8030f2:	ff d0                	call   *%rax
+}
+  8030f4:	48 83 c4 08          	add    $0x8,%rsp
+  8030f8:	5b                   	pop    %rbx
+  8030f9:	41 5c                	pop    %r12
+  8030fb:	41 5d                	pop    %r13
+  8030fd:	5d                   	pop    %rbp
+  8030fe:	c3                   	ret
+
+00000000008030ff <spawn>:
+spawn(const char *prog, const char **argv) {
+  8030ff:	55                   	push   %rbp
+  803100:	48 89 e5             	mov    %rsp,%rbp
+  803103:	41 57                	push   %r15
+  803105:	41 56                	push   %r14
+  803107:	41 55                	push   %r13
+  803109:	41 54                	push   %r12
+  80310b:	53                   	push   %rbx
+  80310c:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803113:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  803116:	be 00 00 00 00       	mov    $0x0,%esi
+  80311b:	48 b8 d7 2f 80 00 00 	movabs $0x802fd7,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+  803127:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	0f 88 10 04 00 00    	js     803545 <spawn+0x446>
+  803135:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803137:	ba 00 02 00 00       	mov    $0x200,%edx
+  80313c:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803143:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+  80314f:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803151:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803156:	0f 85 85 02 00 00    	jne    8033e1 <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80315c:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803163:	ff ff 00 
+  803166:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80316d:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803174:	01 01 00 
+  803177:	48 39 d0             	cmp    %rdx,%rax
+  80317a:	0f 85 9d 02 00 00    	jne    80341d <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803180:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803187:	00 3e 00 
+  80318a:	0f 85 8d 02 00 00    	jne    80341d <spawn+0x31e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803190:	b8 08 00 00 00       	mov    $0x8,%eax
+  803195:	cd 30                	int    $0x30
+  803197:	41 89 c6             	mov    %eax,%r14d
+  80319a:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80319c:	85 c0                	test   %eax,%eax
+  80319e:	0f 88 89 03 00 00    	js     80352d <spawn+0x42e>
+    envid_t child = res;
+  8031a4:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8031aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031af:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8031b3:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8031b7:	48 c1 e0 04          	shl    $0x4,%rax
+  8031bb:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8031c2:	00 00 00 
+  8031c5:	48 01 c6             	add    %rax,%rsi
+  8031c8:	48 8b 06             	mov    (%rsi),%rax
+  8031cb:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8031d2:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8031d9:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8031e0:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8031e7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8031ee:	48 29 c6             	sub    %rax,%rsi
+  8031f1:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  8031f7:	89 c8                	mov    %ecx,%eax
+  8031f9:	c1 e8 03             	shr    $0x3,%eax
+  8031fc:	89 c1                	mov    %eax,%ecx
+  8031fe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803201:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803208:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  80320f:	49 8b 3f             	mov    (%r15),%rdi
+  803212:	48 85 ff             	test   %rdi,%rdi
+  803215:	0f 84 41 06 00 00    	je     80385c <spawn+0x75d>
+  80321b:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  803220:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803226:	49 bc 6d 10 80 00 00 	movabs $0x80106d,%r12
+  80322d:	00 00 00 
+  803230:	41 ff d4             	call   *%r12
+  803233:	4c 01 e8             	add    %r13,%rax
+  803236:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  80323a:	48 89 da             	mov    %rbx,%rdx
+  80323d:	48 83 c3 01          	add    $0x1,%rbx
+  803241:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  803246:	48 85 ff             	test   %rdi,%rdi
+  803249:	75 e5                	jne    803230 <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80324b:	48 f7 d0             	not    %rax
+  80324e:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803255:	4d 89 e5             	mov    %r12,%r13
+  803258:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  80325c:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  803263:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  80326a:	89 d0                	mov    %edx,%eax
+  80326c:	83 c0 01             	add    $0x1,%eax
+  80326f:	48 98                	cltq
+  803271:	48 c1 e0 03          	shl    $0x3,%rax
+  803275:	49 29 c5             	sub    %rax,%r13
+  803278:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80327f:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  803283:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803289:	0f 86 c3 05 00 00    	jbe    803852 <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80328f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803294:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803299:	be 00 00 40 00       	mov    $0x400000,%esi
+  80329e:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  8032a5:	00 00 00 
+  8032a8:	ff d0                	call   *%rax
+  8032aa:	89 c3                	mov    %eax,%ebx
+  8032ac:	85 c0                	test   %eax,%eax
+  8032ae:	0f 88 67 02 00 00    	js     80351b <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  8032b4:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  8032bb:	85 d2                	test   %edx,%edx
+  8032bd:	7e 54                	jle    803313 <spawn+0x214>
+  8032bf:	4c 89 fb             	mov    %r15,%rbx
+  8032c2:	48 63 c2             	movslq %edx,%rax
+  8032c5:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8032ca:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8032d1:	00 00 00 
+  8032d4:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  8032db:	ff 
+  8032dc:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8032e0:	48 8b 33             	mov    (%rbx),%rsi
+  8032e3:	4c 89 e7             	mov    %r12,%rdi
+  8032e6:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  8032ed:	00 00 00 
+  8032f0:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8032f2:	48 8b 3b             	mov    (%rbx),%rdi
+  8032f5:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+  803301:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803306:	49 83 c5 08          	add    $0x8,%r13
+  80330a:	48 83 c3 08          	add    $0x8,%rbx
+  80330e:	4d 39 fd             	cmp    %r15,%r13
+  803311:	75 b7                	jne    8032ca <spawn+0x1cb>
+    argv_store[argc] = 0;
+  803313:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80331a:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803321:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803322:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803329:	0f 85 35 01 00 00    	jne    803464 <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  80332f:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803336:	00 00 00 
+  803339:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803340:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803347:	ff 
+  803348:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  80334c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803353:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803357:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  80335e:	00 00 00 
+  803361:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803368:	ff 
+  803369:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803370:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803376:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  80337c:	44 89 f2             	mov    %r14d,%edx
+  80337f:	be 00 00 40 00       	mov    $0x400000,%esi
+  803384:	bf 00 00 00 00       	mov    $0x0,%edi
+  803389:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803395:	48 bb 03 18 80 00 00 	movabs $0x801803,%rbx
+  80339c:	00 00 00 
+  80339f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8033a4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8033a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ae:	ff d3                	call   *%rbx
+  8033b0:	85 c0                	test   %eax,%eax
+  8033b2:	78 eb                	js     80339f <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8033b4:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8033bb:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  8033c2:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8033c3:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8033ca:	00 
+  8033cb:	0f 84 7e 03 00 00    	je     80374f <spawn+0x650>
+  8033d1:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8033d8:	00 00 00 00 
+  8033dc:	e9 c0 01 00 00       	jmp    8035a1 <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8033e1:	48 bf 00 4b 80 00 00 	movabs $0x804b00,%rdi
+  8033e8:	00 00 00 
+  8033eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f0:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  8033f7:	00 00 00 
+  8033fa:	ff d2                	call   *%rdx
+        close(fd);
+  8033fc:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803402:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80340e:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803415:	ff ff ff 
+  803418:	e9 28 01 00 00       	jmp    803545 <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80341d:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803422:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803428:	48 bf 01 4c 80 00 00 	movabs $0x804c01,%rdi
+  80342f:	00 00 00 
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+  803437:	48 b9 86 07 80 00 00 	movabs $0x800786,%rcx
+  80343e:	00 00 00 
+  803441:	ff d1                	call   *%rcx
+        close(fd);
+  803443:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803449:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803455:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80345c:	ff ff ff 
+  80345f:	e9 e1 00 00 00       	jmp    803545 <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803464:	48 b9 30 4b 80 00 00 	movabs $0x804b30,%rcx
+  80346b:	00 00 00 
+  80346e:	48 ba 1b 4c 80 00 00 	movabs $0x804c1b,%rdx
+  803475:	00 00 00 
+  803478:	be f0 00 00 00       	mov    $0xf0,%esi
+  80347d:	48 bf 30 4c 80 00 00 	movabs $0x804c30,%rdi
+  803484:	00 00 00 
+  803487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348c:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  803493:	00 00 00 
+  803496:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  803499:	89 c3                	mov    %eax,%ebx
+  80349b:	89 c6                	mov    %eax,%esi
+  80349d:	48 bf 60 4b 80 00 00 	movabs $0x804b60,%rdi
+  8034a4:	00 00 00 
+  8034a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ac:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  8034b3:	00 00 00 
+  8034b6:	ff d2                	call   *%rdx
+            return res;
+  8034b8:	eb 61                	jmp    80351b <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  8034ba:	89 c3                	mov    %eax,%ebx
+  8034bc:	89 c6                	mov    %eax,%esi
+  8034be:	48 bf 88 4b 80 00 00 	movabs $0x804b88,%rdi
+  8034c5:	00 00 00 
+  8034c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cd:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  8034d4:	00 00 00 
+  8034d7:	ff d2                	call   *%rdx
+        return res;
+  8034d9:	eb 40                	jmp    80351b <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  8034db:	89 c3                	mov    %eax,%ebx
+  8034dd:	89 c6                	mov    %eax,%esi
+  8034df:	48 bf 3c 4c 80 00 00 	movabs $0x804c3c,%rdi
+  8034e6:	00 00 00 
+  8034e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ee:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  8034f5:	00 00 00 
+  8034f8:	ff d2                	call   *%rdx
+        return res;
+  8034fa:	eb 1f                	jmp    80351b <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  8034fc:	89 c3                	mov    %eax,%ebx
+  8034fe:	89 c6                	mov    %eax,%esi
+  803500:	48 bf 59 4c 80 00 00 	movabs $0x804c59,%rdi
+  803507:	00 00 00 
+  80350a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350f:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  803516:	00 00 00 
+  803519:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  80351b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803521:	48 b8 0c 16 80 00 00 	movabs $0x80160c,%rax
+  803528:	00 00 00 
+  80352b:	ff d0                	call   *%rax
+    close(fd);
+  80352d:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803533:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  80353a:	00 00 00 
+  80353d:	ff d0                	call   *%rax
+    return res;
+  80353f:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  803545:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  80354b:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803552:	5b                   	pop    %rbx
+  803553:	41 5c                	pop    %r12
+  803555:	41 5d                	pop    %r13
+  803557:	41 5e                	pop    %r14
+  803559:	41 5f                	pop    %r15
+  80355b:	5d                   	pop    %rbp
+  80355c:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  80355d:	89 c3                	mov    %eax,%ebx
+  80355f:	89 c6                	mov    %eax,%esi
+  803561:	48 bf b0 4b 80 00 00 	movabs $0x804bb0,%rdi
+  803568:	00 00 00 
+  80356b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803570:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  803577:	00 00 00 
+  80357a:	ff d2                	call   *%rdx
+        return res;
+  80357c:	eb 9d                	jmp    80351b <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80357e:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  803585:	01 
+  803586:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  80358d:	48 83 c3 38          	add    $0x38,%rbx
+  803591:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803598:	48 39 c1             	cmp    %rax,%rcx
+  80359b:	0f 83 ae 01 00 00    	jae    80374f <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8035a1:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8035a4:	75 d8                	jne    80357e <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8035a6:	8b 43 04             	mov    0x4(%rbx),%eax
+  8035a9:	41 89 c6             	mov    %eax,%r14d
+  8035ac:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8035b0:	44 89 f2             	mov    %r14d,%edx
+  8035b3:	83 ca 04             	or     $0x4,%edx
+  8035b6:	a8 04                	test   $0x4,%al
+  8035b8:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8035bc:	44 89 f2             	mov    %r14d,%edx
+  8035bf:	83 ca 01             	or     $0x1,%edx
+  8035c2:	a8 01                	test   $0x1,%al
+  8035c4:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8035c8:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  8035cc:	41 89 cc             	mov    %ecx,%r12d
+  8035cf:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8035d3:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  8035d7:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  8035db:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8035e1:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  8035e7:	44 89 fe             	mov    %r15d,%esi
+  8035ea:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8035f0:	74 0f                	je     803601 <spawn+0x502>
+        va -= res;
+  8035f2:	48 63 fe             	movslq %esi,%rdi
+  8035f5:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  8035f8:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  8035fb:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  8035fe:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803601:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  803608:	00 
+  803609:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803610:	49 89 f5             	mov    %rsi,%r13
+  803613:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  803616:	49 39 d5             	cmp    %rdx,%r13
+  803619:	73 23                	jae    80363e <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  80361b:	4c 01 fa             	add    %r15,%rdx
+  80361e:	48 29 f2             	sub    %rsi,%rdx
+  803621:	44 89 f1             	mov    %r14d,%ecx
+  803624:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  80362a:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803631:	00 00 00 
+  803634:	ff d0                	call   *%rax
+        if (res < 0) {
+  803636:	85 c0                	test   %eax,%eax
+  803638:	0f 88 5b fe ff ff    	js     803499 <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  80363e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803643:	4c 89 ea             	mov    %r13,%rdx
+  803646:	be 00 00 40 00       	mov    $0x400000,%esi
+  80364b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803650:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80365c:	85 c0                	test   %eax,%eax
+  80365e:	0f 88 56 fe ff ff    	js     8034ba <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  803664:	44 89 e6             	mov    %r12d,%esi
+  803667:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80366d:	48 b8 2b 21 80 00 00 	movabs $0x80212b,%rax
+  803674:	00 00 00 
+  803677:	ff d0                	call   *%rax
+    if (res < 0) {
+  803679:	85 c0                	test   %eax,%eax
+  80367b:	0f 88 5a fe ff ff    	js     8034db <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  803681:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368c:	4d 85 ed             	test   %r13,%r13
+  80368f:	74 48                	je     8036d9 <spawn+0x5da>
+  803691:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  803698:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  80369e:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8036a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036aa:	89 df                	mov    %ebx,%edi
+  8036ac:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8036b3:	00 00 00 
+  8036b6:	ff d0                	call   *%rax
+        if (res < 0) {
+  8036b8:	85 c0                	test   %eax,%eax
+  8036ba:	0f 88 3c fe ff ff    	js     8034fc <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  8036c0:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  8036c7:	00 
+  8036c8:	41 89 c4             	mov    %eax,%r12d
+  8036cb:	48 98                	cltq
+  8036cd:	4c 39 e8             	cmp    %r13,%rax
+  8036d0:	72 cc                	jb     80369e <spawn+0x59f>
+  8036d2:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  8036d9:	45 89 f1             	mov    %r14d,%r9d
+  8036dc:	41 80 c9 80          	or     $0x80,%r9b
+  8036e0:	4d 89 e8             	mov    %r13,%r8
+  8036e3:	4c 89 f9             	mov    %r15,%rcx
+  8036e6:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8036ec:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f6:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  8036fd:	00 00 00 
+  803700:	ff d0                	call   *%rax
+    if (res < 0) {
+  803702:	85 c0                	test   %eax,%eax
+  803704:	0f 88 53 fe ff ff    	js     80355d <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  80370a:	4c 89 ea             	mov    %r13,%rdx
+  80370d:	be 00 00 40 00       	mov    $0x400000,%esi
+  803712:	bf 00 00 00 00       	mov    $0x0,%edi
+  803717:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  80371e:	00 00 00 
+  803721:	ff d0                	call   *%rax
+    if (res < 0) {
+  803723:	85 c0                	test   %eax,%eax
+  803725:	0f 89 53 fe ff ff    	jns    80357e <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  80372b:	89 c3                	mov    %eax,%ebx
+  80372d:	89 c6                	mov    %eax,%esi
+  80372f:	48 bf d8 4b 80 00 00 	movabs $0x804bd8,%rdi
+  803736:	00 00 00 
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373e:	48 ba 86 07 80 00 00 	movabs $0x800786,%rdx
+  803745:	00 00 00 
+  803748:	ff d2                	call   *%rdx
+        return res;
+  80374a:	e9 cc fd ff ff       	jmp    80351b <spawn+0x41c>
+    close(fd);
+  80374f:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803755:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803761:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803768:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  80376f:	00 00 00 
+  803772:	48 b8 b1 40 80 00 00 	movabs $0x8040b1,%rax
+  803779:	00 00 00 
+  80377c:	ff d0                	call   *%rax
+  80377e:	85 c0                	test   %eax,%eax
+  803780:	78 49                	js     8037cb <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803782:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803789:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80378f:	48 b8 d3 18 80 00 00 	movabs $0x8018d3,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+  80379b:	85 c0                	test   %eax,%eax
+  80379d:	78 59                	js     8037f8 <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80379f:	be 02 00 00 00       	mov    $0x2,%esi
+  8037a4:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8037aa:	48 b8 6a 18 80 00 00 	movabs $0x80186a,%rax
+  8037b1:	00 00 00 
+  8037b4:	ff d0                	call   *%rax
+  8037b6:	85 c0                	test   %eax,%eax
+  8037b8:	78 6b                	js     803825 <spawn+0x726>
+    return child;
+  8037ba:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8037c0:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  8037c6:	e9 7a fd ff ff       	jmp    803545 <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  8037cb:	89 c1                	mov    %eax,%ecx
+  8037cd:	48 ba 77 4c 80 00 00 	movabs $0x804c77,%rdx
+  8037d4:	00 00 00 
+  8037d7:	be 84 00 00 00       	mov    $0x84,%esi
+  8037dc:	48 bf 30 4c 80 00 00 	movabs $0x804c30,%rdi
+  8037e3:	00 00 00 
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  8037f2:	00 00 00 
+  8037f5:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8037f8:	89 c1                	mov    %eax,%ecx
+  8037fa:	48 ba 8e 4c 80 00 00 	movabs $0x804c8e,%rdx
+  803801:	00 00 00 
+  803804:	be 87 00 00 00       	mov    $0x87,%esi
+  803809:	48 bf 30 4c 80 00 00 	movabs $0x804c30,%rdi
+  803810:	00 00 00 
+  803813:	b8 00 00 00 00       	mov    $0x0,%eax
+  803818:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  80381f:	00 00 00 
+  803822:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803825:	89 c1                	mov    %eax,%ecx
+  803827:	48 ba a8 4c 80 00 00 	movabs $0x804ca8,%rdx
+  80382e:	00 00 00 
+  803831:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803836:	48 bf 30 4c 80 00 00 	movabs $0x804c30,%rdi
+  80383d:	00 00 00 
+  803840:	b8 00 00 00 00       	mov    $0x0,%eax
+  803845:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  80384c:	00 00 00 
+  80384f:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803852:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803857:	e9 bf fc ff ff       	jmp    80351b <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80385c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803861:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803866:	be 00 00 40 00       	mov    $0x400000,%esi
+  80386b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803870:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+  80387c:	89 c3                	mov    %eax,%ebx
+  80387e:	85 c0                	test   %eax,%eax
+  803880:	0f 88 95 fc ff ff    	js     80351b <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803886:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  80388d:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803891:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  803898:	f8 ff 40 00 
+  80389c:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8038a3:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8038a7:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  8038ad:	e9 61 fa ff ff       	jmp    803313 <spawn+0x214>
+
+00000000008038b2 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8038b2:	55                   	push   %rbp
+  8038b3:	48 89 e5             	mov    %rsp,%rbp
+  8038b6:	48 83 ec 50          	sub    $0x50,%rsp
+  8038ba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8038be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8038c2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8038c6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8038ca:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8038d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8038e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8038e6:	eb 15                	jmp    8038fd <spawnl+0x4b>
+  8038e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f4:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8038f8:	74 1c                	je     803916 <spawnl+0x64>
+  8038fa:	83 c1 01             	add    $0x1,%ecx
+  8038fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803900:	83 f8 2f             	cmp    $0x2f,%eax
+  803903:	77 e3                	ja     8038e8 <spawnl+0x36>
+  803905:	89 c2                	mov    %eax,%edx
+  803907:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80390b:	4c 01 d2             	add    %r10,%rdx
+  80390e:	83 c0 08             	add    $0x8,%eax
+  803911:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803914:	eb de                	jmp    8038f4 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803916:	8d 41 02             	lea    0x2(%rcx),%eax
+  803919:	48 98                	cltq
+  80391b:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803922:	00 
+  803923:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803927:	48 29 c4             	sub    %rax,%rsp
+  80392a:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  80392f:	4c 89 c0             	mov    %r8,%rax
+  803932:	48 c1 e8 03          	shr    $0x3,%rax
+  803936:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80393a:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803941:	00 
+    argv[argc + 1] = NULL;
+  803942:	8d 41 01             	lea    0x1(%rcx),%eax
+  803945:	48 98                	cltq
+  803947:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80394e:	00 
+    va_start(vl, arg0);
+  80394f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803956:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80395a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80395e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803962:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803966:	85 c9                	test   %ecx,%ecx
+  803968:	74 41                	je     8039ab <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80396a:	49 89 c1             	mov    %rax,%r9
+  80396d:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803971:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803974:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803979:	eb 1b                	jmp    803996 <spawnl+0xe4>
+  80397b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80397f:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803983:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803987:	48 8b 11             	mov    (%rcx),%rdx
+  80398a:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80398d:	48 83 c0 08          	add    $0x8,%rax
+  803991:	48 39 f0             	cmp    %rsi,%rax
+  803994:	74 15                	je     8039ab <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803996:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803999:	83 fa 2f             	cmp    $0x2f,%edx
+  80399c:	77 dd                	ja     80397b <spawnl+0xc9>
+  80399e:	89 d1                	mov    %edx,%ecx
+  8039a0:	4c 01 c9             	add    %r9,%rcx
+  8039a3:	83 c2 08             	add    $0x8,%edx
+  8039a6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8039a9:	eb dc                	jmp    803987 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8039ab:	4c 89 c6             	mov    %r8,%rsi
+  8039ae:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  8039b5:	00 00 00 
+  8039b8:	ff d0                	call   *%rax
+}
+  8039ba:	c9                   	leave
+  8039bb:	c3                   	ret
+
+00000000008039bc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039bc:	55                   	push   %rbp
+  8039bd:	48 89 e5             	mov    %rsp,%rbp
+  8039c0:	41 54                	push   %r12
+  8039c2:	53                   	push   %rbx
+  8039c3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039c6:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  8039cd:	00 00 00 
+  8039d0:	ff d0                	call   *%rax
+  8039d2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039d5:	48 be bf 4c 80 00 00 	movabs $0x804cbf,%rsi
+  8039dc:	00 00 00 
+  8039df:	48 89 df             	mov    %rbx,%rdi
+  8039e2:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  8039e9:	00 00 00 
+  8039ec:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039ee:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039f3:	41 2b 04 24          	sub    (%r12),%eax
+  8039f7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a04:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a07:	48 b8 c0 68 80 00 00 	movabs $0x8068c0,%rax
+  803a0e:	00 00 00 
+  803a11:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1d:	5b                   	pop    %rbx
+  803a1e:	41 5c                	pop    %r12
+  803a20:	5d                   	pop    %rbp
+  803a21:	c3                   	ret
+
+0000000000803a22 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a22:	55                   	push   %rbp
+  803a23:	48 89 e5             	mov    %rsp,%rbp
+  803a26:	41 54                	push   %r12
+  803a28:	53                   	push   %rbx
+  803a29:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a31:	48 89 fe             	mov    %rdi,%rsi
+  803a34:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a39:	49 bc 03 18 80 00 00 	movabs $0x801803,%r12
+  803a40:	00 00 00 
+  803a43:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a46:	48 89 df             	mov    %rbx,%rdi
+  803a49:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803a50:	00 00 00 
+  803a53:	ff d0                	call   *%rax
+  803a55:	48 89 c6             	mov    %rax,%rsi
+  803a58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a62:	41 ff d4             	call   *%r12
+}
+  803a65:	5b                   	pop    %rbx
+  803a66:	41 5c                	pop    %r12
+  803a68:	5d                   	pop    %rbp
+  803a69:	c3                   	ret
+
+0000000000803a6a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a6a:	55                   	push   %rbp
+  803a6b:	48 89 e5             	mov    %rsp,%rbp
+  803a6e:	41 57                	push   %r15
+  803a70:	41 56                	push   %r14
+  803a72:	41 55                	push   %r13
+  803a74:	41 54                	push   %r12
+  803a76:	53                   	push   %rbx
+  803a77:	48 83 ec 18          	sub    $0x18,%rsp
+  803a7b:	49 89 fc             	mov    %rdi,%r12
+  803a7e:	49 89 f5             	mov    %rsi,%r13
+  803a81:	49 89 d7             	mov    %rdx,%r15
+  803a84:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a88:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803a8f:	00 00 00 
+  803a92:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a94:	4d 85 ff             	test   %r15,%r15
+  803a97:	0f 84 af 00 00 00    	je     803b4c <devpipe_write+0xe2>
+  803a9d:	48 89 c3             	mov    %rax,%rbx
+  803aa0:	4c 89 f8             	mov    %r15,%rax
+  803aa3:	4d 89 ef             	mov    %r13,%r15
+  803aa6:	4c 01 e8             	add    %r13,%rax
+  803aa9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803aad:	49 bd 0b 17 80 00 00 	movabs $0x80170b,%r13
+  803ab4:	00 00 00 
+            sys_yield();
+  803ab7:	49 be a8 16 80 00 00 	movabs $0x8016a8,%r14
+  803abe:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ac1:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ac4:	48 63 ce             	movslq %esi,%rcx
+  803ac7:	48 63 03             	movslq (%rbx),%rax
+  803aca:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ad0:	48 39 c1             	cmp    %rax,%rcx
+  803ad3:	72 2e                	jb     803b03 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ad5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ada:	48 89 da             	mov    %rbx,%rdx
+  803add:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ae2:	4c 89 e7             	mov    %r12,%rdi
+  803ae5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ae8:	85 c0                	test   %eax,%eax
+  803aea:	74 66                	je     803b52 <devpipe_write+0xe8>
+            sys_yield();
+  803aec:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803aef:	8b 73 04             	mov    0x4(%rbx),%esi
+  803af2:	48 63 ce             	movslq %esi,%rcx
+  803af5:	48 63 03             	movslq (%rbx),%rax
+  803af8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803afe:	48 39 c1             	cmp    %rax,%rcx
+  803b01:	73 d2                	jae    803ad5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b03:	41 0f b6 3f          	movzbl (%r15),%edi
+  803b07:	48 89 ca             	mov    %rcx,%rdx
+  803b0a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b0e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803b15:	08 10 20 
+  803b18:	48 f7 e2             	mul    %rdx
+  803b1b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b1f:	48 89 d0             	mov    %rdx,%rax
+  803b22:	48 c1 e0 09          	shl    $0x9,%rax
+  803b26:	48 29 d0             	sub    %rdx,%rax
+  803b29:	48 c1 e0 03          	shl    $0x3,%rax
+  803b2d:	48 29 c1             	sub    %rax,%rcx
+  803b30:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b35:	83 c6 01             	add    $0x1,%esi
+  803b38:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b3b:	49 83 c7 01          	add    $0x1,%r15
+  803b3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b43:	49 39 c7             	cmp    %rax,%r15
+  803b46:	0f 85 75 ff ff ff    	jne    803ac1 <devpipe_write+0x57>
+    return n;
+  803b4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b50:	eb 05                	jmp    803b57 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b57:	48 83 c4 18          	add    $0x18,%rsp
+  803b5b:	5b                   	pop    %rbx
+  803b5c:	41 5c                	pop    %r12
+  803b5e:	41 5d                	pop    %r13
+  803b60:	41 5e                	pop    %r14
+  803b62:	41 5f                	pop    %r15
+  803b64:	5d                   	pop    %rbp
+  803b65:	c3                   	ret
+
+0000000000803b66 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b66:	55                   	push   %rbp
+  803b67:	48 89 e5             	mov    %rsp,%rbp
+  803b6a:	41 57                	push   %r15
+  803b6c:	41 56                	push   %r14
+  803b6e:	41 55                	push   %r13
+  803b70:	41 54                	push   %r12
+  803b72:	53                   	push   %rbx
+  803b73:	48 83 ec 18          	sub    $0x18,%rsp
+  803b77:	49 89 fc             	mov    %rdi,%r12
+  803b7a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b7e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b82:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+  803b8e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b91:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b97:	49 bd 0b 17 80 00 00 	movabs $0x80170b,%r13
+  803b9e:	00 00 00 
+            sys_yield();
+  803ba1:	49 be a8 16 80 00 00 	movabs $0x8016a8,%r14
+  803ba8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803bab:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803bb0:	74 7d                	je     803c2f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bb2:	8b 03                	mov    (%rbx),%eax
+  803bb4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803bb7:	75 26                	jne    803bdf <devpipe_read+0x79>
+            if (i > 0) return i;
+  803bb9:	4d 85 ff             	test   %r15,%r15
+  803bbc:	75 77                	jne    803c35 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803bbe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bc3:	48 89 da             	mov    %rbx,%rdx
+  803bc6:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bcb:	4c 89 e7             	mov    %r12,%rdi
+  803bce:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803bd1:	85 c0                	test   %eax,%eax
+  803bd3:	74 72                	je     803c47 <devpipe_read+0xe1>
+            sys_yield();
+  803bd5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bd8:	8b 03                	mov    (%rbx),%eax
+  803bda:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803bdd:	74 df                	je     803bbe <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803bdf:	48 63 c8             	movslq %eax,%rcx
+  803be2:	48 89 ca             	mov    %rcx,%rdx
+  803be5:	48 c1 ea 03          	shr    $0x3,%rdx
+  803be9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803bf0:	08 10 20 
+  803bf3:	48 89 d0             	mov    %rdx,%rax
+  803bf6:	48 f7 e6             	mul    %rsi
+  803bf9:	48 c1 ea 06          	shr    $0x6,%rdx
+  803bfd:	48 89 d0             	mov    %rdx,%rax
+  803c00:	48 c1 e0 09          	shl    $0x9,%rax
+  803c04:	48 29 d0             	sub    %rdx,%rax
+  803c07:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803c0e:	00 
+  803c0f:	48 89 c8             	mov    %rcx,%rax
+  803c12:	48 29 d0             	sub    %rdx,%rax
+  803c15:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803c1a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c1e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803c22:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c25:	49 83 c7 01          	add    $0x1,%r15
+  803c29:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803c2d:	75 83                	jne    803bb2 <devpipe_read+0x4c>
+    return n;
+  803c2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c33:	eb 03                	jmp    803c38 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803c35:	4c 89 f8             	mov    %r15,%rax
+}
+  803c38:	48 83 c4 18          	add    $0x18,%rsp
+  803c3c:	5b                   	pop    %rbx
+  803c3d:	41 5c                	pop    %r12
+  803c3f:	41 5d                	pop    %r13
+  803c41:	41 5e                	pop    %r14
+  803c43:	41 5f                	pop    %r15
+  803c45:	5d                   	pop    %rbp
+  803c46:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4c:	eb ea                	jmp    803c38 <devpipe_read+0xd2>
+
+0000000000803c4e <pipe>:
+pipe(int pfd[2]) {
+  803c4e:	55                   	push   %rbp
+  803c4f:	48 89 e5             	mov    %rsp,%rbp
+  803c52:	41 55                	push   %r13
+  803c54:	41 54                	push   %r12
+  803c56:	53                   	push   %rbx
+  803c57:	48 83 ec 18          	sub    $0x18,%rsp
+  803c5b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c5e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c62:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+  803c6e:	89 c3                	mov    %eax,%ebx
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	0f 88 a0 01 00 00    	js     803e18 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c78:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c82:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c8b:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803c92:	00 00 00 
+  803c95:	ff d0                	call   *%rax
+  803c97:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c99:	85 c0                	test   %eax,%eax
+  803c9b:	0f 88 77 01 00 00    	js     803e18 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ca1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ca5:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  803cac:	00 00 00 
+  803caf:	ff d0                	call   *%rax
+  803cb1:	89 c3                	mov    %eax,%ebx
+  803cb3:	85 c0                	test   %eax,%eax
+  803cb5:	0f 88 43 01 00 00    	js     803dfe <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803cbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cce:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803cd5:	00 00 00 
+  803cd8:	ff d0                	call   *%rax
+  803cda:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803cdc:	85 c0                	test   %eax,%eax
+  803cde:	0f 88 1a 01 00 00    	js     803dfe <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ce4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ce8:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803cef:	00 00 00 
+  803cf2:	ff d0                	call   *%rax
+  803cf4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803cf7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cfc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d01:	48 89 c6             	mov    %rax,%rsi
+  803d04:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d09:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+  803d15:	89 c3                	mov    %eax,%ebx
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	0f 88 c5 00 00 00    	js     803de4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d1f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d23:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803d2a:	00 00 00 
+  803d2d:	ff d0                	call   *%rax
+  803d2f:	48 89 c1             	mov    %rax,%rcx
+  803d32:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d38:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d43:	4c 89 ee             	mov    %r13,%rsi
+  803d46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d4b:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  803d52:	00 00 00 
+  803d55:	ff d0                	call   *%rax
+  803d57:	89 c3                	mov    %eax,%ebx
+  803d59:	85 c0                	test   %eax,%eax
+  803d5b:	78 6e                	js     803dcb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d5d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d62:	4c 89 ef             	mov    %r13,%rdi
+  803d65:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  803d6c:	00 00 00 
+  803d6f:	ff d0                	call   *%rax
+  803d71:	83 f8 02             	cmp    $0x2,%eax
+  803d74:	0f 85 ab 00 00 00    	jne    803e25 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d7a:	a1 c0 68 80 00 00 00 	movabs 0x8068c0,%eax
+  803d81:	00 00 
+  803d83:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d87:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d89:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d8d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d94:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d98:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d9e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803da5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803da9:	48 bb 07 1b 80 00 00 	movabs $0x801b07,%rbx
+  803db0:	00 00 00 
+  803db3:	ff d3                	call   *%rbx
+  803db5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803db9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803dbd:	ff d3                	call   *%rbx
+  803dbf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dc9:	eb 4d                	jmp    803e18 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803dcb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd0:	4c 89 ee             	mov    %r13,%rsi
+  803dd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd8:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  803ddf:	00 00 00 
+  803de2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803de4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ded:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df2:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803dfe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e03:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e07:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e0c:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  803e13:	00 00 00 
+  803e16:	ff d0                	call   *%rax
+}
+  803e18:	89 d8                	mov    %ebx,%eax
+  803e1a:	48 83 c4 18          	add    $0x18,%rsp
+  803e1e:	5b                   	pop    %rbx
+  803e1f:	41 5c                	pop    %r12
+  803e21:	41 5d                	pop    %r13
+  803e23:	5d                   	pop    %rbp
+  803e24:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e25:	48 b9 d8 4c 80 00 00 	movabs $0x804cd8,%rcx
+  803e2c:	00 00 00 
+  803e2f:	48 ba 1b 4c 80 00 00 	movabs $0x804c1b,%rdx
+  803e36:	00 00 00 
+  803e39:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e3e:	48 bf c6 4c 80 00 00 	movabs $0x804cc6,%rdi
+  803e45:	00 00 00 
+  803e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4d:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  803e54:	00 00 00 
+  803e57:	41 ff d0             	call   *%r8
+
+0000000000803e5a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e5a:	55                   	push   %rbp
+  803e5b:	48 89 e5             	mov    %rsp,%rbp
+  803e5e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e62:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e66:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e72:	85 c0                	test   %eax,%eax
+  803e74:	78 35                	js     803eab <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e76:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e7a:	48 b8 19 1b 80 00 00 	movabs $0x801b19,%rax
+  803e81:	00 00 00 
+  803e84:	ff d0                	call   *%rax
+  803e86:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e89:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e8e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e93:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e97:	48 b8 0b 17 80 00 00 	movabs $0x80170b,%rax
+  803e9e:	00 00 00 
+  803ea1:	ff d0                	call   *%rax
+  803ea3:	85 c0                	test   %eax,%eax
+  803ea5:	0f 94 c0             	sete   %al
+  803ea8:	0f b6 c0             	movzbl %al,%eax
+}
+  803eab:	c9                   	leave
+  803eac:	c3                   	ret
+
+0000000000803ead <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ead:	55                   	push   %rbp
+  803eae:	48 89 e5             	mov    %rsp,%rbp
+  803eb1:	41 55                	push   %r13
+  803eb3:	41 54                	push   %r12
+  803eb5:	53                   	push   %rbx
+  803eb6:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803eba:	85 ff                	test   %edi,%edi
+  803ebc:	74 7d                	je     803f3b <wait+0x8e>
+  803ebe:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ec1:	89 f8                	mov    %edi,%eax
+  803ec3:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803ec8:	89 fa                	mov    %edi,%edx
+  803eca:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803ed0:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  803ed4:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  803ed8:	48 c1 e1 04          	shl    $0x4,%rcx
+  803edc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ee3:	00 00 00 
+  803ee6:	48 01 ca             	add    %rcx,%rdx
+  803ee9:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803eef:	39 d7                	cmp    %edx,%edi
+  803ef1:	75 3d                	jne    803f30 <wait+0x83>
+           env->env_status != ENV_FREE) {
+  803ef3:	48 98                	cltq
+  803ef5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803ef9:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  803efd:	48 c1 e0 04          	shl    $0x4,%rax
+  803f01:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803f08:	00 00 00 
+  803f0b:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803f0e:	49 bd a8 16 80 00 00 	movabs $0x8016a8,%r13
+  803f15:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803f18:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	74 0e                	je     803f30 <wait+0x83>
+        sys_yield();
+  803f22:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803f25:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803f2b:	44 39 e0             	cmp    %r12d,%eax
+  803f2e:	74 e8                	je     803f18 <wait+0x6b>
+    }
+}
+  803f30:	48 83 c4 08          	add    $0x8,%rsp
+  803f34:	5b                   	pop    %rbx
+  803f35:	41 5c                	pop    %r12
+  803f37:	41 5d                	pop    %r13
+  803f39:	5d                   	pop    %rbp
+  803f3a:	c3                   	ret
+    assert(envid != 0);
+  803f3b:	48 b9 fc 4c 80 00 00 	movabs $0x804cfc,%rcx
+  803f42:	00 00 00 
+  803f45:	48 ba 1b 4c 80 00 00 	movabs $0x804c1b,%rdx
+  803f4c:	00 00 00 
+  803f4f:	be 06 00 00 00       	mov    $0x6,%esi
+  803f54:	48 bf 07 4d 80 00 00 	movabs $0x804d07,%rdi
+  803f5b:	00 00 00 
+  803f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f63:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  803f6a:	00 00 00 
+  803f6d:	41 ff d0             	call   *%r8
+
+0000000000803f70 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f70:	48 89 f8             	mov    %rdi,%rax
+  803f73:	48 c1 e8 27          	shr    $0x27,%rax
+  803f77:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f7e:	01 00 00 
+  803f81:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f85:	f6 c2 01             	test   $0x1,%dl
+  803f88:	74 6d                	je     803ff7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f8a:	48 89 f8             	mov    %rdi,%rax
+  803f8d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f91:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f98:	01 00 00 
+  803f9b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f9f:	f6 c2 01             	test   $0x1,%dl
+  803fa2:	74 62                	je     804006 <get_uvpt_entry+0x96>
+  803fa4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fab:	01 00 00 
+  803fae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fb2:	f6 c2 80             	test   $0x80,%dl
+  803fb5:	75 4f                	jne    804006 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803fb7:	48 89 f8             	mov    %rdi,%rax
+  803fba:	48 c1 e8 15          	shr    $0x15,%rax
+  803fbe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fc5:	01 00 00 
+  803fc8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fcc:	f6 c2 01             	test   $0x1,%dl
+  803fcf:	74 44                	je     804015 <get_uvpt_entry+0xa5>
+  803fd1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fd8:	01 00 00 
+  803fdb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fdf:	f6 c2 80             	test   $0x80,%dl
+  803fe2:	75 31                	jne    804015 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803fe4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803fe8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803fef:	01 00 00 
+  803ff2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ff6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ff7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ffe:	01 00 00 
+  804001:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804005:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804006:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80400d:	01 00 00 
+  804010:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804014:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804015:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80401c:	01 00 00 
+  80401f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804023:	c3                   	ret
+
+0000000000804024 <get_prot>:
+
+int
+get_prot(void *va) {
+  804024:	55                   	push   %rbp
+  804025:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804028:	48 b8 70 3f 80 00 00 	movabs $0x803f70,%rax
+  80402f:	00 00 00 
+  804032:	ff d0                	call   *%rax
+  804034:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804037:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80403c:	89 c1                	mov    %eax,%ecx
+  80403e:	83 c9 04             	or     $0x4,%ecx
+  804041:	f6 c2 01             	test   $0x1,%dl
+  804044:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804047:	89 c1                	mov    %eax,%ecx
+  804049:	83 c9 02             	or     $0x2,%ecx
+  80404c:	f6 c2 02             	test   $0x2,%dl
+  80404f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804052:	89 c1                	mov    %eax,%ecx
+  804054:	83 c9 01             	or     $0x1,%ecx
+  804057:	48 85 d2             	test   %rdx,%rdx
+  80405a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80405d:	89 c1                	mov    %eax,%ecx
+  80405f:	83 c9 40             	or     $0x40,%ecx
+  804062:	f6 c6 04             	test   $0x4,%dh
+  804065:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804068:	5d                   	pop    %rbp
+  804069:	c3                   	ret
+
+000000000080406a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80406a:	55                   	push   %rbp
+  80406b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80406e:	48 b8 70 3f 80 00 00 	movabs $0x803f70,%rax
+  804075:	00 00 00 
+  804078:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80407a:	48 c1 e8 06          	shr    $0x6,%rax
+  80407e:	83 e0 01             	and    $0x1,%eax
+}
+  804081:	5d                   	pop    %rbp
+  804082:	c3                   	ret
+
+0000000000804083 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804087:	48 b8 70 3f 80 00 00 	movabs $0x803f70,%rax
+  80408e:	00 00 00 
+  804091:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  804093:	48 c1 e8 05          	shr    $0x5,%rax
+  804097:	83 e0 01             	and    $0x1,%eax
+}
+  80409a:	5d                   	pop    %rbp
+  80409b:	c3                   	ret
+
+000000000080409c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040a0:	48 b8 70 3f 80 00 00 	movabs $0x803f70,%rax
+  8040a7:	00 00 00 
+  8040aa:	ff d0                	call   *%rax
+  8040ac:	83 e0 01             	and    $0x1,%eax
+}
+  8040af:	5d                   	pop    %rbp
+  8040b0:	c3                   	ret
+
+00000000008040b1 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040b1:	55                   	push   %rbp
+  8040b2:	48 89 e5             	mov    %rsp,%rbp
+  8040b5:	41 57                	push   %r15
+  8040b7:	41 56                	push   %r14
+  8040b9:	41 55                	push   %r13
+  8040bb:	41 54                	push   %r12
+  8040bd:	53                   	push   %rbx
+  8040be:	48 83 ec 18          	sub    $0x18,%rsp
+  8040c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8040c6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8040ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8040cf:	49 bd 9c 40 80 00 00 	movabs $0x80409c,%r13
+  8040d6:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8040d9:	49 bf 24 40 80 00 00 	movabs $0x804024,%r15
+  8040e0:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8040e3:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8040ea:	00 00 00 
+  8040ed:	eb 0c                	jmp    8040fb <foreach_shared_region+0x4a>
+  8040ef:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040f6:	4c 39 f3             	cmp    %r14,%rbx
+  8040f9:	74 2e                	je     804129 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8040fb:	48 89 df             	mov    %rbx,%rdi
+  8040fe:	41 ff d5             	call   *%r13
+  804101:	84 c0                	test   %al,%al
+  804103:	74 ea                	je     8040ef <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  804105:	48 89 df             	mov    %rbx,%rdi
+  804108:	41 ff d7             	call   *%r15
+  80410b:	a8 40                	test   $0x40,%al
+  80410d:	74 e0                	je     8040ef <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80410f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804116:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80411a:	48 89 df             	mov    %rbx,%rdi
+  80411d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804121:	ff d0                	call   *%rax
+				if (res < 0) {
+  804123:	85 c0                	test   %eax,%eax
+  804125:	79 c8                	jns    8040ef <foreach_shared_region+0x3e>
+  804127:	eb 05                	jmp    80412e <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  804129:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80412e:	48 83 c4 18          	add    $0x18,%rsp
+  804132:	5b                   	pop    %rbx
+  804133:	41 5c                	pop    %r12
+  804135:	41 5d                	pop    %r13
+  804137:	41 5e                	pop    %r14
+  804139:	41 5f                	pop    %r15
+  80413b:	5d                   	pop    %rbp
+  80413c:	c3                   	ret
+
+000000000080413d <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80413d:	55                   	push   %rbp
+  80413e:	48 89 e5             	mov    %rsp,%rbp
+  804141:	41 55                	push   %r13
+  804143:	41 54                	push   %r12
+  804145:	53                   	push   %rbx
+  804146:	48 83 ec 08          	sub    $0x8,%rsp
+  80414a:	49 89 fc             	mov    %rdi,%r12
+  80414d:	48 89 f7             	mov    %rsi,%rdi
+  804150:	48 89 d3             	mov    %rdx,%rbx
+  804153:	49 89 cd             	mov    %rcx,%r13
+  804156:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804159:	48 85 f6             	test   %rsi,%rsi
+  80415c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804163:	00 00 00 
+  804166:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80416a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80416f:	48 85 db             	test   %rbx,%rbx
+  804172:	74 03                	je     804177 <ipc_recv_timed+0x3a>
+  804174:	48 8b 33             	mov    (%rbx),%rsi
+  804177:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+    if (res < 0) {
+  804183:	85 c0                	test   %eax,%eax
+  804185:	78 75                	js     8041fc <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804187:	4d 85 e4             	test   %r12,%r12
+  80418a:	74 14                	je     8041a0 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80418c:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  804193:	00 00 00 
+  804196:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80419c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8041a0:	4d 85 ed             	test   %r13,%r13
+  8041a3:	74 14                	je     8041b9 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8041a5:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8041ac:	00 00 00 
+  8041af:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8041b5:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8041b9:	48 85 db             	test   %rbx,%rbx
+  8041bc:	74 23                	je     8041e1 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8041be:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8041c5:	00 00 00 
+  8041c8:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8041ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041d3:	85 c9                	test   %ecx,%ecx
+  8041d5:	74 07                	je     8041de <ipc_recv_timed+0xa1>
+  8041d7:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8041de:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8041e1:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8041e8:	00 00 00 
+  8041eb:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8041f1:	48 83 c4 08          	add    $0x8,%rsp
+  8041f5:	5b                   	pop    %rbx
+  8041f6:	41 5c                	pop    %r12
+  8041f8:	41 5d                	pop    %r13
+  8041fa:	5d                   	pop    %rbp
+  8041fb:	c3                   	ret
+        if (from_env_store != NULL) {
+  8041fc:	4d 85 e4             	test   %r12,%r12
+  8041ff:	74 08                	je     804209 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  804201:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804208:	00 
+        if (perm_store != NULL) {
+  804209:	4d 85 ed             	test   %r13,%r13
+  80420c:	74 08                	je     804216 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80420e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804215:	00 
+        if (size != NULL) {
+  804216:	48 85 db             	test   %rbx,%rbx
+  804219:	74 d6                	je     8041f1 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80421b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804222:	eb cd                	jmp    8041f1 <ipc_recv_timed+0xb4>
+
+0000000000804224 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804224:	55                   	push   %rbp
+  804225:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  804228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80422e:	48 b8 3d 41 80 00 00 	movabs $0x80413d,%rax
+  804235:	00 00 00 
+  804238:	ff d0                	call   *%rax
+}
+  80423a:	5d                   	pop    %rbp
+  80423b:	c3                   	ret
+
+000000000080423c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80423c:	55                   	push   %rbp
+  80423d:	48 89 e5             	mov    %rsp,%rbp
+  804240:	41 57                	push   %r15
+  804242:	41 56                	push   %r14
+  804244:	41 55                	push   %r13
+  804246:	41 54                	push   %r12
+  804248:	53                   	push   %rbx
+  804249:	48 83 ec 18          	sub    $0x18,%rsp
+  80424d:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804250:	48 89 d3             	mov    %rdx,%rbx
+  804253:	49 89 cc             	mov    %rcx,%r12
+  804256:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804259:	48 85 d2             	test   %rdx,%rdx
+  80425c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804263:	00 00 00 
+  804266:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80426a:	89 f0                	mov    %esi,%eax
+  80426c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804270:	48 89 da             	mov    %rbx,%rdx
+  804273:	48 89 c6             	mov    %rax,%rsi
+  804276:	48 b8 a5 19 80 00 00 	movabs $0x8019a5,%rax
+  80427d:	00 00 00 
+  804280:	ff d0                	call   *%rax
+    while (res < 0) {
+  804282:	85 c0                	test   %eax,%eax
+  804284:	79 65                	jns    8042eb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804286:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804289:	75 33                	jne    8042be <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80428b:	49 bf a8 16 80 00 00 	movabs $0x8016a8,%r15
+  804292:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804295:	49 be a5 19 80 00 00 	movabs $0x8019a5,%r14
+  80429c:	00 00 00 
+        sys_yield();
+  80429f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8042a2:	45 89 e8             	mov    %r13d,%r8d
+  8042a5:	4c 89 e1             	mov    %r12,%rcx
+  8042a8:	48 89 da             	mov    %rbx,%rdx
+  8042ab:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8042af:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8042b2:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8042b5:	85 c0                	test   %eax,%eax
+  8042b7:	79 32                	jns    8042eb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8042b9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8042bc:	74 e1                	je     80429f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8042be:	89 c1                	mov    %eax,%ecx
+  8042c0:	48 ba 12 4d 80 00 00 	movabs $0x804d12,%rdx
+  8042c7:	00 00 00 
+  8042ca:	be 52 00 00 00       	mov    $0x52,%esi
+  8042cf:	48 bf 26 4d 80 00 00 	movabs $0x804d26,%rdi
+  8042d6:	00 00 00 
+  8042d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042de:	49 b8 36 06 80 00 00 	movabs $0x800636,%r8
+  8042e5:	00 00 00 
+  8042e8:	41 ff d0             	call   *%r8
+    }
+}
+  8042eb:	48 83 c4 18          	add    $0x18,%rsp
+  8042ef:	5b                   	pop    %rbx
+  8042f0:	41 5c                	pop    %r12
+  8042f2:	41 5d                	pop    %r13
+  8042f4:	41 5e                	pop    %r14
+  8042f6:	41 5f                	pop    %r15
+  8042f8:	5d                   	pop    %rbp
+  8042f9:	c3                   	ret
+
+00000000008042fa <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8042fa:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8042ff:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804306:	00 00 00 
+  804309:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80430d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804311:	48 c1 e2 04          	shl    $0x4,%rdx
+  804315:	48 01 ca             	add    %rcx,%rdx
+  804318:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80431e:	39 fa                	cmp    %edi,%edx
+  804320:	74 12                	je     804334 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  804322:	48 83 c0 01          	add    $0x1,%rax
+  804326:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80432c:	75 db                	jne    804309 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80432e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804333:	c3                   	ret
+            return envs[i].env_id;
+  804334:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804338:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80433c:	48 c1 e2 04          	shl    $0x4,%rdx
+  804340:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  804347:	00 00 00 
+  80434a:	48 01 d0             	add    %rdx,%rax
+  80434d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804353:	c3                   	ret
+  804354:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804358 <__rodata_start>:
+  804358:	69 6e 69 74 3a 20 72 	imul   $0x72203a74,0x69(%rsi),%ebp
+  80435f:	75 6e                	jne    8043cf <__rodata_start+0x77>
+  804361:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804362:	69 6e 67 0a 00 69 6e 	imul   $0x6e69000a,0x67(%rsi),%ebp
+  804369:	69 74 3a 20 64 61 74 	imul   $0x61746164,0x20(%rdx,%rdi,1),%esi
+  804370:	61 
+  804371:	20 73 65             	and    %dh,0x65(%rbx)
+  804374:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804376:	73 20                	jae    804398 <__rodata_start+0x40>
+  804378:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804379:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  80437d:	00 69 6e             	add    %ch,0x6e(%rcx)
+  804380:	69 74 3a 20 62 73 73 	imul   $0x20737362,0x20(%rdx,%rdi,1),%esi
+  804387:	20 
+  804388:	73 65                	jae    8043ef <__rodata_start+0x97>
+  80438a:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80438c:	73 20                	jae    8043ae <__rodata_start+0x56>
+  80438e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80438f:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  804393:	00 69 6e             	add    %ch,0x6e(%rcx)
+  804396:	69 74 3a 20 61 72 67 	imul   $0x73677261,0x20(%rdx,%rdi,1),%esi
+  80439d:	73 
+  80439e:	3a 00                	cmp    (%rax),%al
+  8043a0:	20 27                	and    %ah,(%rdi)
+  8043a2:	00 25 73 0a 00 69    	add    %ah,0x69000a73(%rip)        # 69804e1b <__bss_end+0x68ff9e1b>
+  8043a8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043a9:	69 74 3a 20 72 75 6e 	imul   $0x6e6e7572,0x20(%rdx,%rdi,1),%esi
+  8043b0:	6e 
+  8043b1:	69 6e 67 20 73 68 0a 	imul   $0xa687320,0x67(%rsi),%ebp
+  8043b8:	00 6f 70             	add    %ch,0x70(%rdi)
+  8043bb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8043bd:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  8043c0:	73 3a                	jae    8043fc <__rodata_start+0xa4>
+  8043c2:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f54431 <__bss_end+0x73749431>
+  8043c8:	65 72 2f             	gs jb  8043fa <__rodata_start+0xa2>
+  8043cb:	69 6e 69 74 2e 63 00 	imul   $0x632e74,0x69(%rsi),%ebp
+  8043d2:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  8043d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043d9:	70 65                	jo     804440 <__rodata_start+0xe8>
+  8043db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043dc:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  8043df:	73 20                	jae    804401 <__rodata_start+0xa9>
+  8043e1:	75 73                	jne    804456 <__rodata_start+0xfe>
+  8043e3:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  8043e8:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e44452 <__bss_end+0x75639452>
+  8043ee:	70 3a                	jo     80442a <__rodata_start+0xd2>
+  8043f0:	20 25 69 00 69 6e    	and    %ah,0x6e690069(%rip)        # 6ee9445f <__bss_end+0x6e68945f>
+  8043f6:	69 74 3a 20 73 74 61 	imul   $0x72617473,0x20(%rdx,%rdi,1),%esi
+  8043fd:	72 
+  8043fe:	74 69                	je     804469 <__rodata_start+0x111>
+  804400:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804401:	67 20 73 68          	and    %dh,0x68(%ebx)
+  804405:	0a 00                	or     (%rax),%al
+  804407:	2f                   	(bad)
+  804408:	73 68                	jae    804472 <__rodata_start+0x11a>
+  80440a:	00 69 6e             	add    %ch,0x6e(%rcx)
+  80440d:	69 74 3a 20 73 70 61 	imul   $0x77617073,0x20(%rdx,%rdi,1),%esi
+  804414:	77 
+  804415:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804416:	20 73 68             	and    %dh,0x68(%rbx)
+  804419:	3a 20                	cmp    (%rax),%ah
+  80441b:	25 69 0a 00 90       	and    $0x90000a69,%eax
+  804420:	69 6e 69 74 3a 20 64 	imul   $0x64203a74,0x69(%rsi),%ebp
+  804427:	61                   	(bad)
+  804428:	74 61                	je     80448b <__rodata_start+0x133>
+  80442a:	20 69 73             	and    %ch,0x73(%rcx)
+  80442d:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804430:	74 20                	je     804452 <__rodata_start+0xfa>
+  804432:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  804439:	69 7a 65 64 3a 20 67 	imul   $0x67203a64,0x65(%rdx),%edi
+  804440:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804441:	74 20                	je     804463 <__rodata_start+0x10b>
+  804443:	73 75                	jae    8044ba <__rodata_start+0x162>
+  804445:	6d                   	insl   (%dx),%es:(%rdi)
+  804446:	20 25 30 38 78 20    	and    %ah,0x20783830(%rip)        # 20f87c7c <__bss_end+0x2077cc7c>
+  80444c:	77 61                	ja     8044af <__rodata_start+0x157>
+  80444e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80444f:	74 65                	je     8044b6 <__rodata_start+0x15e>
+  804451:	64 20 25 30 38 78 0a 	and    %ah,%fs:0xa783830(%rip)        # af87c88 <__bss_end+0xa77cc88>
+	...
+  804460:	62 73                	(bad)
+  804462:	73 20                	jae    804484 <__rodata_start+0x12c>
+  804464:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80446b:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  804472:	69 7a 65 64 3a 20 77 	imul   $0x77203a64,0x65(%rdx),%edi
+  804479:	61                   	(bad)
+  80447a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80447b:	74 65                	je     8044e2 <__rodata_start+0x18a>
+  80447d:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  804481:	6d                   	insl   (%dx),%es:(%rdi)
+  804482:	20 30                	and    %dh,(%rax)
+  804484:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804487:	74 20                	je     8044a9 <__rodata_start+0x151>
+  804489:	25 30 38 78 0a       	and    $0xa783830,%eax
+  80448e:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  804491:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804492:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804493:	73 3e                	jae    8044d3 <__rodata_start+0x17b>
+  804495:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804498:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804499:	73 00                	jae    80449b <__rodata_start+0x143>
+  80449b:	3c 75                	cmp    $0x75,%al
+  80449d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80449e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8044a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044a3:	3e 00 0f             	ds add %cl,(%rdi)
+  8044a6:	1f                   	(bad)
+  8044a7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8044aa:	30 38                	xor    %bh,(%rax)
+  8044ac:	78 5d                	js     80450b <__rodata_start+0x1b3>
+  8044ae:	20 75 73             	and    %dh,0x73(%rbp)
+  8044b1:	65 72 20             	gs jb  8044d4 <__rodata_start+0x17c>
+  8044b4:	70 61                	jo     804517 <__rodata_start+0x1bf>
+  8044b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044b7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8044be:	73 20                	jae    8044e0 <__rodata_start+0x188>
+  8044c0:	61                   	(bad)
+  8044c1:	74 20                	je     8044e3 <__rodata_start+0x18b>
+  8044c3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8044c8:	3a 20                	cmp    (%rax),%ah
+  8044ca:	00 30                	add    %dh,(%rax)
+  8044cc:	31 32                	xor    %esi,(%rdx)
+  8044ce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8044d5:	41                   	rex.B
+  8044d6:	42                   	rex.X
+  8044d7:	43                   	rex.XB
+  8044d8:	44                   	rex.R
+  8044d9:	45                   	rex.RB
+  8044da:	46 00 30             	rex.RX add %r14b,(%rax)
+  8044dd:	31 32                	xor    %esi,(%rdx)
+  8044df:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8044e6:	61                   	(bad)
+  8044e7:	62 63 64 65 66       	(bad)
+  8044ec:	00 28                	add    %ch,(%rax)
+  8044ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044ef:	75 6c                	jne    80455d <__rodata_start+0x205>
+  8044f1:	6c                   	insb   (%dx),%es:(%rdi)
+  8044f2:	29 00                	sub    %eax,(%rax)
+  8044f4:	65 72 72             	gs jb  804569 <__rodata_start+0x211>
+  8044f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044f8:	72 20                	jb     80451a <__rodata_start+0x1c2>
+  8044fa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8044ff:	73 70                	jae    804571 <__rodata_start+0x219>
+  804501:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804505:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80450c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80450d:	72 00                	jb     80450f <__rodata_start+0x1b7>
+  80450f:	62 61 64 20 65       	(bad)
+  804514:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804515:	76 69                	jbe    804580 <__rodata_start+0x228>
+  804517:	72 6f                	jb     804588 <__rodata_start+0x230>
+  804519:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80451a:	6d                   	insl   (%dx),%es:(%rdi)
+  80451b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80451d:	74 00                	je     80451f <__rodata_start+0x1c7>
+  80451f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804526:	20 70 61             	and    %dh,0x61(%rax)
+  804529:	72 61                	jb     80458c <__rodata_start+0x234>
+  80452b:	6d                   	insl   (%dx),%es:(%rdi)
+  80452c:	65 74 65             	gs je  804594 <__rodata_start+0x23c>
+  80452f:	72 00                	jb     804531 <__rodata_start+0x1d9>
+  804531:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804532:	75 74                	jne    8045a8 <__rodata_start+0x250>
+  804534:	20 6f 66             	and    %ch,0x66(%rdi)
+  804537:	20 6d 65             	and    %ch,0x65(%rbp)
+  80453a:	6d                   	insl   (%dx),%es:(%rdi)
+  80453b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80453c:	72 79                	jb     8045b7 <__rodata_start+0x25f>
+  80453e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804541:	74 20                	je     804563 <__rodata_start+0x20b>
+  804543:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804544:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804548:	76 69                	jbe    8045b3 <__rodata_start+0x25b>
+  80454a:	72 6f                	jb     8045bb <__rodata_start+0x263>
+  80454c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80454d:	6d                   	insl   (%dx),%es:(%rdi)
+  80454e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804550:	74 73                	je     8045c5 <__rodata_start+0x26d>
+  804552:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804555:	72 72                	jb     8045c9 <__rodata_start+0x271>
+  804557:	75 70                	jne    8045c9 <__rodata_start+0x271>
+  804559:	74 65                	je     8045c0 <__rodata_start+0x268>
+  80455b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804560:	75 67                	jne    8045c9 <__rodata_start+0x271>
+  804562:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804565:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804567:	00 73 65             	add    %dh,0x65(%rbx)
+  80456a:	67 6d                	insl   (%dx),%es:(%edi)
+  80456c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80456e:	74 61                	je     8045d1 <__rodata_start+0x279>
+  804570:	74 69                	je     8045db <__rodata_start+0x283>
+  804572:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804573:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804574:	20 66 61             	and    %ah,0x61(%rsi)
+  804577:	75 6c                	jne    8045e5 <__rodata_start+0x28d>
+  804579:	74 00                	je     80457b <__rodata_start+0x223>
+  80457b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804582:	20 45 4c             	and    %al,0x4c(%rbp)
+  804585:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804589:	61                   	(bad)
+  80458a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80458f:	20 73 75             	and    %dh,0x75(%rbx)
+  804592:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804595:	73 79                	jae    804610 <__rodata_start+0x2b8>
+  804597:	73 74                	jae    80460d <__rodata_start+0x2b5>
+  804599:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80459b:	20 63 61             	and    %ah,0x61(%rbx)
+  80459e:	6c                   	insb   (%dx),%es:(%rdi)
+  80459f:	6c                   	insb   (%dx),%es:(%rdi)
+  8045a0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8045a3:	74 72                	je     804617 <__rodata_start+0x2bf>
+  8045a5:	79 20                	jns    8045c7 <__rodata_start+0x26f>
+  8045a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045a9:	74 20                	je     8045cb <__rodata_start+0x273>
+  8045ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8045ad:	75 6e                	jne    80461d <__rodata_start+0x2c5>
+  8045af:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8045b3:	76 20                	jbe    8045d5 <__rodata_start+0x27d>
+  8045b5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8045bc:	72 65                	jb     804623 <__rodata_start+0x2cb>
+  8045be:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8045c1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045c2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8045c6:	65 78 70             	gs js  804639 <__rodata_start+0x2e1>
+  8045c9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8045ce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8045d1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8045d5:	20 66 69             	and    %ah,0x69(%rsi)
+  8045d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8045d9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8045dd:	20 66 72             	and    %ah,0x72(%rsi)
+  8045e0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8045e5:	61                   	(bad)
+  8045e6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8045e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045eb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8045ef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8045f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045f4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8045f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045f8:	79 20                	jns    80461a <__rodata_start+0x2c2>
+  8045fa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804601:	72 65                	jb     804668 <__rodata_start+0x310>
+  804603:	20 6f 70             	and    %ch,0x70(%rdi)
+  804606:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804608:	00 66 69             	add    %ah,0x69(%rsi)
+  80460b:	6c                   	insb   (%dx),%es:(%rdi)
+  80460c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804610:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804613:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804614:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804617:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804618:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804619:	74 20                	je     80463b <__rodata_start+0x2e3>
+  80461b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80461d:	75 6e                	jne    80468d <__rodata_start+0x335>
+  80461f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804623:	76 61                	jbe    804686 <__rodata_start+0x32e>
+  804625:	6c                   	insb   (%dx),%es:(%rdi)
+  804626:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80462d:	00 
+  80462e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804635:	72 65                	jb     80469c <__rodata_start+0x344>
+  804637:	61                   	(bad)
+  804638:	64 79 20             	fs jns 80465b <__rodata_start+0x303>
+  80463b:	65 78 69             	gs js  8046a7 <__rodata_start+0x34f>
+  80463e:	73 74                	jae    8046b4 <__rodata_start+0x35c>
+  804640:	73 00                	jae    804642 <__rodata_start+0x2ea>
+  804642:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804643:	70 65                	jo     8046aa <__rodata_start+0x352>
+  804645:	72 61                	jb     8046a8 <__rodata_start+0x350>
+  804647:	74 69                	je     8046b2 <__rodata_start+0x35a>
+  804649:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80464a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80464b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80464e:	74 20                	je     804670 <__rodata_start+0x318>
+  804650:	73 75                	jae    8046c7 <__rodata_start+0x36f>
+  804652:	70 70                	jo     8046c4 <__rodata_start+0x36c>
+  804654:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804655:	72 74                	jb     8046cb <__rodata_start+0x373>
+  804657:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80465d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  804662:	74 00                	je     804664 <__rodata_start+0x30c>
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80467f:	00 
+  804680:	73 09                	jae    80468b <__rodata_start+0x333>
+  804682:	80 00 00             	addb   $0x0,(%rax)
+  804685:	00 00                	add    %al,(%rax)
+  804687:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80468e:	00 00                	add    %al,(%rax)
+  804690:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  804691:	0f 80 00 00 00 00    	jo     804697 <__rodata_start+0x33f>
+  804697:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80469e:	00 00                	add    %al,(%rax)
+  8046a0:	b4 0f                	mov    $0xf,%ah
+  8046a2:	80 00 00             	addb   $0x0,(%rax)
+  8046a5:	00 00                	add    %al,(%rax)
+  8046a7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8046ae:	00 00                	add    %al,(%rax)
+  8046b0:	b4 0f                	mov    $0xf,%ah
+  8046b2:	80 00 00             	addb   $0x0,(%rax)
+  8046b5:	00 00                	add    %al,(%rax)
+  8046b7:	00 92 09 80 00 00    	add    %dl,0x8009(%rdx)
+  8046bd:	00 00                	add    %al,(%rax)
+  8046bf:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8046c6:	00 00                	add    %al,(%rax)
+  8046c8:	b4 0f                	mov    $0xf,%ah
+  8046ca:	80 00 00             	addb   $0x0,(%rax)
+  8046cd:	00 00                	add    %al,(%rax)
+  8046cf:	00 86 09 80 00 00    	add    %al,0x8009(%rsi)
+  8046d5:	00 00                	add    %al,(%rax)
+  8046d7:	00 00                	add    %al,(%rax)
+  8046d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8046df:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8046e6:	00 00                	add    %al,(%rax)
+  8046e8:	86 09                	xchg   %cl,(%rcx)
+  8046ea:	80 00 00             	addb   $0x0,(%rax)
+  8046ed:	00 00                	add    %al,(%rax)
+  8046ef:	00 cc                	add    %cl,%ah
+  8046f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8046f7:	00 cc                	add    %cl,%ah
+  8046f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8046ff:	00 cc                	add    %cl,%ah
+  804701:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804707:	00 cc                	add    %cl,%ah
+  804709:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80470f:	00 cc                	add    %cl,%ah
+  804711:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804717:	00 cc                	add    %cl,%ah
+  804719:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80471f:	00 cc                	add    %cl,%ah
+  804721:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804727:	00 cc                	add    %cl,%ah
+  804729:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80472f:	00 cc                	add    %cl,%ah
+  804731:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804737:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80473e:	00 00                	add    %al,(%rax)
+  804740:	b4 0f                	mov    $0xf,%ah
+  804742:	80 00 00             	addb   $0x0,(%rax)
+  804745:	00 00                	add    %al,(%rax)
+  804747:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80474e:	00 00                	add    %al,(%rax)
+  804750:	b4 0f                	mov    $0xf,%ah
+  804752:	80 00 00             	addb   $0x0,(%rax)
+  804755:	00 00                	add    %al,(%rax)
+  804757:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80475e:	00 00                	add    %al,(%rax)
+  804760:	b4 0f                	mov    $0xf,%ah
+  804762:	80 00 00             	addb   $0x0,(%rax)
+  804765:	00 00                	add    %al,(%rax)
+  804767:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80476e:	00 00                	add    %al,(%rax)
+  804770:	b4 0f                	mov    $0xf,%ah
+  804772:	80 00 00             	addb   $0x0,(%rax)
+  804775:	00 00                	add    %al,(%rax)
+  804777:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80477e:	00 00                	add    %al,(%rax)
+  804780:	b4 0f                	mov    $0xf,%ah
+  804782:	80 00 00             	addb   $0x0,(%rax)
+  804785:	00 00                	add    %al,(%rax)
+  804787:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80478e:	00 00                	add    %al,(%rax)
+  804790:	b4 0f                	mov    $0xf,%ah
+  804792:	80 00 00             	addb   $0x0,(%rax)
+  804795:	00 00                	add    %al,(%rax)
+  804797:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80479e:	00 00                	add    %al,(%rax)
+  8047a0:	b4 0f                	mov    $0xf,%ah
+  8047a2:	80 00 00             	addb   $0x0,(%rax)
+  8047a5:	00 00                	add    %al,(%rax)
+  8047a7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047ae:	00 00                	add    %al,(%rax)
+  8047b0:	b4 0f                	mov    $0xf,%ah
+  8047b2:	80 00 00             	addb   $0x0,(%rax)
+  8047b5:	00 00                	add    %al,(%rax)
+  8047b7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047be:	00 00                	add    %al,(%rax)
+  8047c0:	b4 0f                	mov    $0xf,%ah
+  8047c2:	80 00 00             	addb   $0x0,(%rax)
+  8047c5:	00 00                	add    %al,(%rax)
+  8047c7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047ce:	00 00                	add    %al,(%rax)
+  8047d0:	b4 0f                	mov    $0xf,%ah
+  8047d2:	80 00 00             	addb   $0x0,(%rax)
+  8047d5:	00 00                	add    %al,(%rax)
+  8047d7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047de:	00 00                	add    %al,(%rax)
+  8047e0:	b4 0f                	mov    $0xf,%ah
+  8047e2:	80 00 00             	addb   $0x0,(%rax)
+  8047e5:	00 00                	add    %al,(%rax)
+  8047e7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047ee:	00 00                	add    %al,(%rax)
+  8047f0:	b4 0f                	mov    $0xf,%ah
+  8047f2:	80 00 00             	addb   $0x0,(%rax)
+  8047f5:	00 00                	add    %al,(%rax)
+  8047f7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8047fe:	00 00                	add    %al,(%rax)
+  804800:	b4 0f                	mov    $0xf,%ah
+  804802:	80 00 00             	addb   $0x0,(%rax)
+  804805:	00 00                	add    %al,(%rax)
+  804807:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80480e:	00 00                	add    %al,(%rax)
+  804810:	b4 0f                	mov    $0xf,%ah
+  804812:	80 00 00             	addb   $0x0,(%rax)
+  804815:	00 00                	add    %al,(%rax)
+  804817:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80481e:	00 00                	add    %al,(%rax)
+  804820:	b4 0f                	mov    $0xf,%ah
+  804822:	80 00 00             	addb   $0x0,(%rax)
+  804825:	00 00                	add    %al,(%rax)
+  804827:	00 d7                	add    %dl,%bh
+  804829:	0e                   	(bad)
+  80482a:	80 00 00             	addb   $0x0,(%rax)
+  80482d:	00 00                	add    %al,(%rax)
+  80482f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804836:	00 00                	add    %al,(%rax)
+  804838:	b4 0f                	mov    $0xf,%ah
+  80483a:	80 00 00             	addb   $0x0,(%rax)
+  80483d:	00 00                	add    %al,(%rax)
+  80483f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804846:	00 00                	add    %al,(%rax)
+  804848:	b4 0f                	mov    $0xf,%ah
+  80484a:	80 00 00             	addb   $0x0,(%rax)
+  80484d:	00 00                	add    %al,(%rax)
+  80484f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804856:	00 00                	add    %al,(%rax)
+  804858:	b4 0f                	mov    $0xf,%ah
+  80485a:	80 00 00             	addb   $0x0,(%rax)
+  80485d:	00 00                	add    %al,(%rax)
+  80485f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804866:	00 00                	add    %al,(%rax)
+  804868:	b4 0f                	mov    $0xf,%ah
+  80486a:	80 00 00             	addb   $0x0,(%rax)
+  80486d:	00 00                	add    %al,(%rax)
+  80486f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804876:	00 00                	add    %al,(%rax)
+  804878:	b4 0f                	mov    $0xf,%ah
+  80487a:	80 00 00             	addb   $0x0,(%rax)
+  80487d:	00 00                	add    %al,(%rax)
+  80487f:	00 23                	add    %ah,(%rbx)
+  804881:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804887:	00 f2                	add    %dh,%dl
+  804889:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80488f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804896:	00 00                	add    %al,(%rax)
+  804898:	b4 0f                	mov    $0xf,%ah
+  80489a:	80 00 00             	addb   $0x0,(%rax)
+  80489d:	00 00                	add    %al,(%rax)
+  80489f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8048a6:	00 00                	add    %al,(%rax)
+  8048a8:	b4 0f                	mov    $0xf,%ah
+  8048aa:	80 00 00             	addb   $0x0,(%rax)
+  8048ad:	00 00                	add    %al,(%rax)
+  8048af:	00 52 0a             	add    %dl,0xa(%rdx)
+  8048b2:	80 00 00             	addb   $0x0,(%rax)
+  8048b5:	00 00                	add    %al,(%rax)
+  8048b7:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8048be:	00 00                	add    %al,(%rax)
+  8048c0:	b4 0f                	mov    $0xf,%ah
+  8048c2:	80 00 00             	addb   $0x0,(%rax)
+  8048c5:	00 00                	add    %al,(%rax)
+  8048c7:	00 18                	add    %bl,(%rax)
+  8048c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048cf:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8048d6:	00 00                	add    %al,(%rax)
+  8048d8:	b4 0f                	mov    $0xf,%ah
+  8048da:	80 00 00             	addb   $0x0,(%rax)
+  8048dd:	00 00                	add    %al,(%rax)
+  8048df:	00 9a 0d 80 00 00    	add    %bl,0x800d(%rdx)
+  8048e5:	00 00                	add    %al,(%rax)
+  8048e7:	00 64 0e 80          	add    %ah,-0x80(%rsi,%rcx,1)
+  8048eb:	00 00                	add    %al,(%rax)
+  8048ed:	00 00                	add    %al,(%rax)
+  8048ef:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  8048f6:	00 00                	add    %al,(%rax)
+  8048f8:	b4 0f                	mov    $0xf,%ah
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 e9                	add    %ch,%cl
+  804901:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804907:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80490e:	00 00                	add    %al,(%rax)
+  804910:	c6                   	(bad)
+  804911:	0c 80                	or     $0x80,%al
+  804913:	00 00                	add    %al,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  80491e:	00 00                	add    %al,(%rax)
+  804920:	b4 0f                	mov    $0xf,%ah
+  804922:	80 00 00             	addb   $0x0,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 d7                	add    %dl,%bh
+  804929:	0e                   	(bad)
+  80492a:	80 00 00             	addb   $0x0,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 b4 0f 80 00 00 00 	add    %dh,0x80(%rdi,%rcx,1)
+  804936:	00 00                	add    %al,(%rax)
+  804938:	7c 09                	jl     804943 <error_string+0x3>
+  80493a:	80 00 00             	addb   $0x0,(%rax)
+  80493d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804940 <error_string>:
+	...
+  804948:	fd 44 80 00 00 00 00 00 0f 45 80 00 00 00 00 00     .D.......E......
+  804958:	1f 45 80 00 00 00 00 00 31 45 80 00 00 00 00 00     .E......1E......
+  804968:	3f 45 80 00 00 00 00 00 53 45 80 00 00 00 00 00     ?E......SE......
+  804978:	68 45 80 00 00 00 00 00 7b 45 80 00 00 00 00 00     hE......{E......
+  804988:	8d 45 80 00 00 00 00 00 a1 45 80 00 00 00 00 00     .E.......E......
+  804998:	b1 45 80 00 00 00 00 00 c4 45 80 00 00 00 00 00     .E.......E......
+  8049a8:	db 45 80 00 00 00 00 00 f1 45 80 00 00 00 00 00     .E.......E......
+  8049b8:	09 46 80 00 00 00 00 00 21 46 80 00 00 00 00 00     .F......!F......
+  8049c8:	2e 46 80 00 00 00 00 00 e8 49 80 00 00 00 00 00     .F.......I......
+  8049d8:	42 46 80 00 00 00 00 00 5a 46 80 00 00 00 00 00     BF......ZF......
+  8049e8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8049f8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804a08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804a18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804a28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804a38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804a48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804a58:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804a68:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804a78:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804a88:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804a98:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804aa8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804ab8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804ac8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ad8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804ae0 <devtab>:
+  804ae0:	20 68 80 00 00 00 00 00 c0 68 80 00 00 00 00 00      h.......h......
+  804af0:	80 67 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .g..............
+  804b00:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804b10:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804b20:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804b30:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804b40:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804b50:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804b60:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  804b70:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  804b80:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804b90:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  804ba0:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  804bb0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  804bc0:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  804bd0:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804be0:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  804bf0:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  804c00:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  804c10:	77 61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72     want %08x..asser
+  804c20:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  804c30:	6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70 5f     lib/spawn.c.map_
+  804c40:	73 65 67 6d 65 6e 74 2e 73 65 65 6b 20 66 61 69     segment.seek fai
+  804c50:	6c 65 64 3a 20 25 69 0a 00 6d 61 70 5f 73 65 67     led: %i..map_seg
+  804c60:	6d 65 6e 74 2e 72 65 61 64 6e 20 66 61 69 6c 65     ment.readn faile
+  804c70:	64 3a 20 25 69 0a 00 63 6f 70 79 5f 73 68 61 72     d: %i..copy_shar
+  804c80:	65 64 5f 72 65 67 69 6f 6e 3a 20 25 69 00 73 79     ed_region: %i.sy
+  804c90:	73 5f 65 6e 76 5f 73 65 74 5f 74 72 61 70 66 72     s_env_set_trapfr
+  804ca0:	61 6d 65 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f     ame: %i.sys_env_
+  804cb0:	73 65 74 5f 73 74 61 74 75 73 3a 20 25 69 00 3c     set_status: %i.<
+  804cc0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  804cd0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  804ce0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804cf0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  804d00:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  804d10:	63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72     c.ipc_send error
+  804d20:	3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00     : %i..lib/ipc.c.
+  804d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,7828 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 04 00 00       	call   800459 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+  800032:	48 89 fb             	mov    %rdi,%rbx
+  800035:	41 89 f5             	mov    %esi,%r13d
+  800038:	49 89 cc             	mov    %rcx,%r12
+    //cprintf("ls1\n");
+    const char *sep;
+
+    if (flag['l'])
+  80003b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800042:	00 00 00 
+  800045:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  80004c:	74 29                	je     800077 <ls1+0x52>
+  80004e:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  800050:	41 80 fd 01          	cmp    $0x1,%r13b
+  800054:	19 d2                	sbb    %edx,%edx
+  800056:	83 e2 c9             	and    $0xffffffc9,%edx
+  800059:	83 c2 64             	add    $0x64,%edx
+  80005c:	48 bf ca 3d 80 00 00 	movabs $0x803dca,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 74 32 80 00 00 	movabs $0x803274,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+    if (prefix) {
+  800077:	48 85 db             	test   %rbx,%rbx
+  80007a:	74 2d                	je     8000a9 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  80007c:	48 ba 3b 3e 80 00 00 	movabs $0x803e3b,%rdx
+  800083:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800086:	80 3b 00             	cmpb   $0x0,(%rbx)
+  800089:	75 46                	jne    8000d1 <ls1+0xac>
+        printf("%s%s", prefix, sep);
+  80008b:	48 89 de             	mov    %rbx,%rsi
+  80008e:	48 bf d3 3d 80 00 00 	movabs $0x803dd3,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 b9 74 32 80 00 00 	movabs $0x803274,%rcx
+  8000a4:	00 00 00 
+  8000a7:	ff d1                	call   *%rcx
+    }
+    if (strcmp(name,".snapshots")) {
+  8000a9:	48 be d8 3d 80 00 00 	movabs $0x803dd8,%rsi
+  8000b0:	00 00 00 
+  8000b3:	4c 89 e7             	mov    %r12,%rdi
+  8000b6:	48 b8 43 10 80 00 00 	movabs $0x801043,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	85 c0                	test   %eax,%eax
+  8000c4:	75 39                	jne    8000ff <ls1+0xda>
+        if (flag['F'] && isdir)
+            printf("/");
+        
+        printf("\n");
+    }
+}
+  8000c6:	48 83 c4 08          	add    $0x8,%rsp
+  8000ca:	5b                   	pop    %rbx
+  8000cb:	41 5c                	pop    %r12
+  8000cd:	41 5d                	pop    %r13
+  8000cf:	5d                   	pop    %rbp
+  8000d0:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  8000d1:	48 89 df             	mov    %rbx,%rdi
+  8000d4:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  8000db:	00 00 00 
+  8000de:	ff d0                	call   *%rax
+            sep = "/";
+  8000e0:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  8000e5:	48 ba 3b 3e 80 00 00 	movabs $0x803e3b,%rdx
+  8000ec:	00 00 00 
+  8000ef:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  8000f6:	00 00 00 
+  8000f9:	48 0f 45 d0          	cmovne %rax,%rdx
+  8000fd:	eb 8c                	jmp    80008b <ls1+0x66>
+        printf("%s", name);
+  8000ff:	4c 89 e6             	mov    %r12,%rsi
+  800102:	48 bf d9 44 80 00 00 	movabs $0x8044d9,%rdi
+  800109:	00 00 00 
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800111:	48 ba 74 32 80 00 00 	movabs $0x803274,%rdx
+  800118:	00 00 00 
+  80011b:	ff d2                	call   *%rdx
+        if (flag['F'] && isdir)
+  80011d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800124:	00 00 00 
+  800127:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  80012e:	74 05                	je     800135 <ls1+0x110>
+  800130:	45 84 ed             	test   %r13b,%r13b
+  800133:	75 20                	jne    800155 <ls1+0x130>
+        printf("\n");
+  800135:	48 bf 3a 3e 80 00 00 	movabs $0x803e3a,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	48 ba 74 32 80 00 00 	movabs $0x803274,%rdx
+  80014b:	00 00 00 
+  80014e:	ff d2                	call   *%rdx
+}
+  800150:	e9 71 ff ff ff       	jmp    8000c6 <ls1+0xa1>
+            printf("/");
+  800155:	48 bf c8 3d 80 00 00 	movabs $0x803dc8,%rdi
+  80015c:	00 00 00 
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	48 ba 74 32 80 00 00 	movabs $0x803274,%rdx
+  80016b:	00 00 00 
+  80016e:	ff d2                	call   *%rdx
+  800170:	eb c3                	jmp    800135 <ls1+0x110>
+
+0000000000800172 <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  800172:	55                   	push   %rbp
+  800173:	48 89 e5             	mov    %rsp,%rbp
+  800176:	41 56                	push   %r14
+  800178:	41 55                	push   %r13
+  80017a:	41 54                	push   %r12
+  80017c:	53                   	push   %rbx
+  80017d:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800184:	49 89 fd             	mov    %rdi,%r13
+  800187:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  80018a:	be 00 00 00 00       	mov    $0x0,%esi
+  80018f:	48 b8 45 30 80 00 00 	movabs $0x803045,%rax
+  800196:	00 00 00 
+  800199:	ff d0                	call   *%rax
+  80019b:	89 c3                	mov    %eax,%ebx
+  80019d:	85 c0                	test   %eax,%eax
+  80019f:	78 58                	js     8001f9 <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  8001a1:	49 bc 6f 20 80 00 00 	movabs $0x80206f,%r12
+  8001a8:	00 00 00 
+  8001ab:	ba 00 01 00 00       	mov    $0x100,%edx
+  8001b0:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  8001b7:	89 df                	mov    %ebx,%edi
+  8001b9:	41 ff d4             	call   *%r12
+  8001bc:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8001c1:	75 67                	jne    80022a <lsdir+0xb8>
+        if (f.f_name[0])
+  8001c3:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  8001ca:	74 df                	je     8001ab <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001cc:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  8001d3:	40 0f 94 c6          	sete   %sil
+  8001d7:	40 0f b6 f6          	movzbl %sil,%esi
+  8001db:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  8001e2:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8001e8:	4c 89 f7             	mov    %r14,%rdi
+  8001eb:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+  8001f7:	eb b2                	jmp    8001ab <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8001f9:	41 89 c0             	mov    %eax,%r8d
+  8001fc:	4c 89 e9             	mov    %r13,%rcx
+  8001ff:	48 ba e3 3d 80 00 00 	movabs $0x803de3,%rdx
+  800206:	00 00 00 
+  800209:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80020e:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  800215:	00 00 00 
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  800224:	00 00 00 
+  800227:	41 ff d1             	call   *%r9
+    if (n > 0)
+  80022a:	85 c0                	test   %eax,%eax
+  80022c:	7f 12                	jg     800240 <lsdir+0xce>
+    if (n < 0)
+  80022e:	78 3e                	js     80026e <lsdir+0xfc>
+}
+  800230:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  800237:	5b                   	pop    %rbx
+  800238:	41 5c                	pop    %r12
+  80023a:	41 5d                	pop    %r13
+  80023c:	41 5e                	pop    %r14
+  80023e:	5d                   	pop    %rbp
+  80023f:	c3                   	ret
+        panic("short read in directory %s", path);
+  800240:	4c 89 e9             	mov    %r13,%rcx
+  800243:	48 ba f9 3d 80 00 00 	movabs $0x803df9,%rdx
+  80024a:	00 00 00 
+  80024d:	be 22 00 00 00       	mov    $0x22,%esi
+  800252:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  800259:	00 00 00 
+  80025c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800261:	49 b8 2a 05 80 00 00 	movabs $0x80052a,%r8
+  800268:	00 00 00 
+  80026b:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80026e:	41 89 c0             	mov    %eax,%r8d
+  800271:	4c 89 e9             	mov    %r13,%rcx
+  800274:	48 ba 40 3e 80 00 00 	movabs $0x803e40,%rdx
+  80027b:	00 00 00 
+  80027e:	be 24 00 00 00       	mov    $0x24,%esi
+  800283:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  80028a:	00 00 00 
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  800299:	00 00 00 
+  80029c:	41 ff d1             	call   *%r9
+
+000000000080029f <ls>:
+ls(const char *path, const char *prefix) {
+  80029f:	55                   	push   %rbp
+  8002a0:	48 89 e5             	mov    %rsp,%rbp
+  8002a3:	41 54                	push   %r12
+  8002a5:	53                   	push   %rbx
+  8002a6:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8002ad:	48 89 fb             	mov    %rdi,%rbx
+  8002b0:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  8002b3:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  8002ba:	48 b8 ee 22 80 00 00 	movabs $0x8022ee,%rax
+  8002c1:	00 00 00 
+  8002c4:	ff d0                	call   *%rax
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	78 47                	js     800311 <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  8002ca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	74 13                	je     8002e4 <ls+0x45>
+  8002d1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8002d8:	00 00 00 
+  8002db:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  8002e2:	74 5e                	je     800342 <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	40 0f 95 c6          	setne  %sil
+  8002ea:	40 0f b6 f6          	movzbl %sil,%esi
+  8002ee:	48 89 d9             	mov    %rbx,%rcx
+  8002f1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8002f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800300:	00 00 00 
+  800303:	ff d0                	call   *%rax
+}
+  800305:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  80030c:	5b                   	pop    %rbx
+  80030d:	41 5c                	pop    %r12
+  80030f:	5d                   	pop    %rbp
+  800310:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  800311:	41 89 c0             	mov    %eax,%r8d
+  800314:	48 89 d9             	mov    %rbx,%rcx
+  800317:	48 ba 14 3e 80 00 00 	movabs $0x803e14,%rdx
+  80031e:	00 00 00 
+  800321:	be 0f 00 00 00       	mov    $0xf,%esi
+  800326:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  80032d:	00 00 00 
+  800330:	b8 00 00 00 00       	mov    $0x0,%eax
+  800335:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  80033c:	00 00 00 
+  80033f:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  800342:	4c 89 e6             	mov    %r12,%rsi
+  800345:	48 89 df             	mov    %rbx,%rdi
+  800348:	48 b8 72 01 80 00 00 	movabs $0x800172,%rax
+  80034f:	00 00 00 
+  800352:	ff d0                	call   *%rax
+  800354:	eb af                	jmp    800305 <ls+0x66>
+
+0000000000800356 <usage>:
+
+void
+usage(void) {
+  800356:	55                   	push   %rbp
+  800357:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  80035a:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  800361:	00 00 00 
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	48 ba 74 32 80 00 00 	movabs $0x803274,%rdx
+  800370:	00 00 00 
+  800373:	ff d2                	call   *%rdx
+    exit();
+  800375:	48 b8 07 05 80 00 00 	movabs $0x800507,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+}
+  800381:	5d                   	pop    %rbp
+  800382:	c3                   	ret
+
+0000000000800383 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800383:	55                   	push   %rbp
+  800384:	48 89 e5             	mov    %rsp,%rbp
+  800387:	41 57                	push   %r15
+  800389:	41 56                	push   %r14
+  80038b:	41 55                	push   %r13
+  80038d:	41 54                	push   %r12
+  80038f:	53                   	push   %rbx
+  800390:	48 83 ec 38          	sub    $0x38,%rsp
+  800394:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800397:	49 89 f4             	mov    %rsi,%r12
+    // cprintf("ls start\n");
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80039a:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80039e:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  8003a2:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8003a9:	00 00 00 
+  8003ac:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  8003ae:	49 bd 28 1a 80 00 00 	movabs $0x801a28,%r13
+  8003b5:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  8003b8:	49 bf 56 03 80 00 00 	movabs $0x800356,%r15
+  8003bf:	00 00 00 
+        switch (i) {
+  8003c2:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  8003c9:	00 00 00 
+            flag[i]++;
+  8003cc:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8003d3:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  8003d6:	eb 06                	jmp    8003de <umain+0x5b>
+            flag[i]++;
+  8003d8:	48 98                	cltq
+  8003da:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  8003de:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8003e2:	41 ff d5             	call   *%r13
+  8003e5:	85 c0                	test   %eax,%eax
+  8003e7:	78 13                	js     8003fc <umain+0x79>
+        switch (i) {
+  8003e9:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8003ec:	83 fa 26             	cmp    $0x26,%edx
+  8003ef:	77 06                	ja     8003f7 <umain+0x74>
+  8003f1:	49 0f a3 d6          	bt     %rdx,%r14
+  8003f5:	72 e1                	jb     8003d8 <umain+0x55>
+            usage();
+  8003f7:	41 ff d7             	call   *%r15
+  8003fa:	eb e2                	jmp    8003de <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8003fc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003ff:	83 f8 01             	cmp    $0x1,%eax
+  800402:	74 33                	je     800437 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  800404:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  800409:	49 bd 9f 02 80 00 00 	movabs $0x80029f,%r13
+  800410:	00 00 00 
+        for (i = 1; i < argc; i++)
+  800413:	7e 13                	jle    800428 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  800415:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  800419:	48 89 fe             	mov    %rdi,%rsi
+  80041c:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  80041f:	48 83 c3 01          	add    $0x1,%rbx
+  800423:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  800426:	7f ed                	jg     800415 <umain+0x92>
+    }
+}
+  800428:	48 83 c4 38          	add    $0x38,%rsp
+  80042c:	5b                   	pop    %rbx
+  80042d:	41 5c                	pop    %r12
+  80042f:	41 5d                	pop    %r13
+  800431:	41 5e                	pop    %r14
+  800433:	41 5f                	pop    %r15
+  800435:	5d                   	pop    %rbp
+  800436:	c3                   	ret
+        ls("/", "");
+  800437:	48 be 3b 3e 80 00 00 	movabs $0x803e3b,%rsi
+  80043e:	00 00 00 
+  800441:	48 bf c8 3d 80 00 00 	movabs $0x803dc8,%rdi
+  800448:	00 00 00 
+  80044b:	48 b8 9f 02 80 00 00 	movabs $0x80029f,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+  800457:	eb cf                	jmp    800428 <umain+0xa5>
+
+0000000000800459 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800459:	55                   	push   %rbp
+  80045a:	48 89 e5             	mov    %rsp,%rbp
+  80045d:	41 56                	push   %r14
+  80045f:	41 55                	push   %r13
+  800461:	41 54                	push   %r12
+  800463:	53                   	push   %rbx
+  800464:	41 89 fd             	mov    %edi,%r13d
+  800467:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80046a:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800471:	00 00 00 
+  800474:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80047b:	00 00 00 
+  80047e:	48 39 c2             	cmp    %rax,%rdx
+  800481:	73 17                	jae    80049a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800483:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800486:	49 89 c4             	mov    %rax,%r12
+  800489:	48 83 c3 08          	add    $0x8,%rbx
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	ff 53 f8             	call   *-0x8(%rbx)
+  800495:	4c 39 e3             	cmp    %r12,%rbx
+  800498:	72 ef                	jb     800489 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80049a:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+  8004a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004ab:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8004af:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8004b3:	48 c1 e0 04          	shl    $0x4,%rax
+  8004b7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8004be:	00 00 00 
+  8004c1:	48 01 d0             	add    %rdx,%rax
+  8004c4:	48 a3 00 64 80 00 00 	movabs %rax,0x806400
+  8004cb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004ce:	45 85 ed             	test   %r13d,%r13d
+  8004d1:	7e 0d                	jle    8004e0 <libmain+0x87>
+  8004d3:	49 8b 06             	mov    (%r14),%rax
+  8004d6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8004dd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004e0:	4c 89 f6             	mov    %r14,%rsi
+  8004e3:	44 89 ef             	mov    %r13d,%edi
+  8004e6:	48 b8 83 03 80 00 00 	movabs $0x800383,%rax
+  8004ed:	00 00 00 
+  8004f0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004f2:	48 b8 07 05 80 00 00 	movabs $0x800507,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+#endif
+}
+  8004fe:	5b                   	pop    %rbx
+  8004ff:	41 5c                	pop    %r12
+  800501:	41 5d                	pop    %r13
+  800503:	41 5e                	pop    %r14
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80050b:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  800512:	00 00 00 
+  800515:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80051c:	48 b8 00 15 80 00 00 	movabs $0x801500,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+}
+  800528:	5d                   	pop    %rbp
+  800529:	c3                   	ret
+
+000000000080052a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	41 56                	push   %r14
+  800530:	41 55                	push   %r13
+  800532:	41 54                	push   %r12
+  800534:	53                   	push   %rbx
+  800535:	48 83 ec 50          	sub    $0x50,%rsp
+  800539:	49 89 fc             	mov    %rdi,%r12
+  80053c:	41 89 f5             	mov    %esi,%r13d
+  80053f:	48 89 d3             	mov    %rdx,%rbx
+  800542:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800546:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80054a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80054e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800555:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800559:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80055d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800561:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800565:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80056c:	00 00 00 
+  80056f:	4c 8b 30             	mov    (%rax),%r14
+  800572:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  800579:	00 00 00 
+  80057c:	ff d0                	call   *%rax
+  80057e:	89 c6                	mov    %eax,%esi
+  800580:	45 89 e8             	mov    %r13d,%r8d
+  800583:	4c 89 e1             	mov    %r12,%rcx
+  800586:	4c 89 f2             	mov    %r14,%rdx
+  800589:	48 bf 70 3e 80 00 00 	movabs $0x803e70,%rdi
+  800590:	00 00 00 
+  800593:	b8 00 00 00 00       	mov    $0x0,%eax
+  800598:	49 bc 7a 06 80 00 00 	movabs $0x80067a,%r12
+  80059f:	00 00 00 
+  8005a2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005a5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005a9:	48 89 df             	mov    %rbx,%rdi
+  8005ac:	48 b8 16 06 80 00 00 	movabs $0x800616,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8005b8:	48 bf 3a 3e 80 00 00 	movabs $0x803e3a,%rdi
+  8005bf:	00 00 00 
+  8005c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005ca:	cc                   	int3
+  8005cb:	eb fd                	jmp    8005ca <_panic+0xa0>
+
+00000000008005cd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005cd:	55                   	push   %rbp
+  8005ce:	48 89 e5             	mov    %rsp,%rbp
+  8005d1:	53                   	push   %rbx
+  8005d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005d9:	8b 06                	mov    (%rsi),%eax
+  8005db:	8d 50 01             	lea    0x1(%rax),%edx
+  8005de:	89 16                	mov    %edx,(%rsi)
+  8005e0:	48 98                	cltq
+  8005e2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005e7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005ed:	74 0a                	je     8005f9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005ef:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f7:	c9                   	leave
+  8005f8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005f9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005fd:	be ff 00 00 00       	mov    $0xff,%esi
+  800602:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  800609:	00 00 00 
+  80060c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80060e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800614:	eb d9                	jmp    8005ef <putch+0x22>
+
+0000000000800616 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800616:	55                   	push   %rbp
+  800617:	48 89 e5             	mov    %rsp,%rbp
+  80061a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800621:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800624:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80062b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800630:	b8 00 00 00 00       	mov    $0x0,%eax
+  800635:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800638:	48 89 f1             	mov    %rsi,%rcx
+  80063b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800642:	48 bf cd 05 80 00 00 	movabs $0x8005cd,%rdi
+  800649:	00 00 00 
+  80064c:	48 b8 ca 07 80 00 00 	movabs $0x8007ca,%rax
+  800653:	00 00 00 
+  800656:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800658:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80065f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800666:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  80066d:	00 00 00 
+  800670:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800672:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800678:	c9                   	leave
+  800679:	c3                   	ret
+
+000000000080067a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80067a:	55                   	push   %rbp
+  80067b:	48 89 e5             	mov    %rsp,%rbp
+  80067e:	48 83 ec 50          	sub    $0x50,%rsp
+  800682:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800686:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80068a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80068e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800692:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800696:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80069d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006ad:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006b1:	48 b8 16 06 80 00 00 	movabs $0x800616,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8006bd:	c9                   	leave
+  8006be:	c3                   	ret
+
+00000000008006bf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	41 57                	push   %r15
+  8006c5:	41 56                	push   %r14
+  8006c7:	41 55                	push   %r13
+  8006c9:	41 54                	push   %r12
+  8006cb:	53                   	push   %rbx
+  8006cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8006d0:	49 89 fc             	mov    %rdi,%r12
+  8006d3:	49 89 f5             	mov    %rsi,%r13
+  8006d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006da:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006dd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006e0:	41 89 cf             	mov    %ecx,%r15d
+  8006e3:	4c 39 fa             	cmp    %r15,%rdx
+  8006e6:	73 5b                	jae    800743 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006e8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006ec:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006f0:	85 db                	test   %ebx,%ebx
+  8006f2:	7e 0e                	jle    800702 <print_num+0x43>
+            putch(padc, put_arg);
+  8006f4:	4c 89 ee             	mov    %r13,%rsi
+  8006f7:	44 89 f7             	mov    %r14d,%edi
+  8006fa:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006fd:	83 eb 01             	sub    $0x1,%ebx
+  800700:	75 f2                	jne    8006f4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800702:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800706:	48 b9 a4 3e 80 00 00 	movabs $0x803ea4,%rcx
+  80070d:	00 00 00 
+  800710:	48 b8 93 3e 80 00 00 	movabs $0x803e93,%rax
+  800717:	00 00 00 
+  80071a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80071e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800722:	ba 00 00 00 00       	mov    $0x0,%edx
+  800727:	49 f7 f7             	div    %r15
+  80072a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80072e:	4c 89 ee             	mov    %r13,%rsi
+  800731:	41 ff d4             	call   *%r12
+}
+  800734:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800738:	5b                   	pop    %rbx
+  800739:	41 5c                	pop    %r12
+  80073b:	41 5d                	pop    %r13
+  80073d:	41 5e                	pop    %r14
+  80073f:	41 5f                	pop    %r15
+  800741:	5d                   	pop    %rbp
+  800742:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800743:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800747:	ba 00 00 00 00       	mov    $0x0,%edx
+  80074c:	49 f7 f7             	div    %r15
+  80074f:	48 83 ec 08          	sub    $0x8,%rsp
+  800753:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800757:	52                   	push   %rdx
+  800758:	45 0f be c9          	movsbl %r9b,%r9d
+  80075c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800760:	48 89 c2             	mov    %rax,%rdx
+  800763:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  80076a:	00 00 00 
+  80076d:	ff d0                	call   *%rax
+  80076f:	48 83 c4 10          	add    $0x10,%rsp
+  800773:	eb 8d                	jmp    800702 <print_num+0x43>
+
+0000000000800775 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800775:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800779:	48 8b 06             	mov    (%rsi),%rax
+  80077c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800780:	73 0a                	jae    80078c <sprintputch+0x17>
+        *state->start++ = ch;
+  800782:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800786:	48 89 16             	mov    %rdx,(%rsi)
+  800789:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80078c:	c3                   	ret
+
+000000000080078d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80078d:	55                   	push   %rbp
+  80078e:	48 89 e5             	mov    %rsp,%rbp
+  800791:	48 83 ec 50          	sub    $0x50,%rsp
+  800795:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800799:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80079d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007a1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8007b8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007bc:	48 b8 ca 07 80 00 00 	movabs $0x8007ca,%rax
+  8007c3:	00 00 00 
+  8007c6:	ff d0                	call   *%rax
+}
+  8007c8:	c9                   	leave
+  8007c9:	c3                   	ret
+
+00000000008007ca <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007ca:	55                   	push   %rbp
+  8007cb:	48 89 e5             	mov    %rsp,%rbp
+  8007ce:	41 57                	push   %r15
+  8007d0:	41 56                	push   %r14
+  8007d2:	41 55                	push   %r13
+  8007d4:	41 54                	push   %r12
+  8007d6:	53                   	push   %rbx
+  8007d7:	48 83 ec 38          	sub    $0x38,%rsp
+  8007db:	49 89 fe             	mov    %rdi,%r14
+  8007de:	49 89 f5             	mov    %rsi,%r13
+  8007e1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007e4:	48 8b 01             	mov    (%rcx),%rax
+  8007e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007eb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007fb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007ff:	0f b6 3b             	movzbl (%rbx),%edi
+  800802:	40 80 ff 25          	cmp    $0x25,%dil
+  800806:	74 18                	je     800820 <vprintfmt+0x56>
+            if (!ch) return;
+  800808:	40 84 ff             	test   %dil,%dil
+  80080b:	0f 84 b1 06 00 00    	je     800ec2 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800811:	40 0f b6 ff          	movzbl %dil,%edi
+  800815:	4c 89 ee             	mov    %r13,%rsi
+  800818:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80081b:	4c 89 e3             	mov    %r12,%rbx
+  80081e:	eb db                	jmp    8007fb <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800820:	be 00 00 00 00       	mov    $0x0,%esi
+  800825:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800829:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80082e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800834:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80083b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80083f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800844:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800849:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80084c:	83 e8 23             	sub    $0x23,%eax
+  80084f:	3c 57                	cmp    $0x57,%al
+  800851:	0f 87 51 06 00 00    	ja     800ea8 <vprintfmt+0x6de>
+  800857:	0f b6 c0             	movzbl %al,%eax
+  80085a:	48 b9 40 40 80 00 00 	movabs $0x804040,%rcx
+  800861:	00 00 00 
+  800864:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800867:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80086a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80086e:	eb cf                	jmp    80083f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800870:	49 89 dc             	mov    %rbx,%r12
+  800873:	be 01 00 00 00       	mov    $0x1,%esi
+  800878:	eb c5                	jmp    80083f <vprintfmt+0x75>
+            padc = ch;
+  80087a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80087e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800881:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800884:	eb b9                	jmp    80083f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 24                	ja     8008b2 <vprintfmt+0xe8>
+  80088e:	89 c1                	mov    %eax,%ecx
+  800890:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80089d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008a0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008a4:	79 99                	jns    80083f <vprintfmt+0x75>
+                width = precision;
+  8008a6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008b0:	eb 8d                	jmp    80083f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8008b6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8008ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008be:	eb da                	jmp    80089a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8008c0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008c5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008c9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008cf:	3c 39                	cmp    $0x39,%al
+  8008d1:	77 1c                	ja     8008ef <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008d3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008d7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008db:	0f b6 c0             	movzbl %al,%eax
+  8008de:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008e3:	0f b6 03             	movzbl (%rbx),%eax
+  8008e6:	3c 39                	cmp    $0x39,%al
+  8008e8:	76 e9                	jbe    8008d3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008ea:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008ed:	eb b1                	jmp    8008a0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008ef:	49 89 dc             	mov    %rbx,%r12
+  8008f2:	eb ac                	jmp    8008a0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008f4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008f7:	85 c9                	test   %ecx,%ecx
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	0f 49 c1             	cmovns %ecx,%eax
+  800901:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800904:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800907:	e9 33 ff ff ff       	jmp    80083f <vprintfmt+0x75>
+            lflag++;
+  80090c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80090f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800912:	e9 28 ff ff ff       	jmp    80083f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800917:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091a:	83 f8 2f             	cmp    $0x2f,%eax
+  80091d:	77 19                	ja     800938 <vprintfmt+0x16e>
+  80091f:	89 c2                	mov    %eax,%edx
+  800921:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800925:	83 c0 08             	add    $0x8,%eax
+  800928:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092b:	8b 3a                	mov    (%rdx),%edi
+  80092d:	4c 89 ee             	mov    %r13,%rsi
+  800930:	41 ff d6             	call   *%r14
+            break;
+  800933:	e9 c3 fe ff ff       	jmp    8007fb <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800938:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800940:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800944:	eb e5                	jmp    80092b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 5a                	ja     8009a8 <vprintfmt+0x1de>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80095a:	8b 02                	mov    (%rdx),%eax
+  80095c:	89 c1                	mov    %eax,%ecx
+  80095e:	f7 d9                	neg    %ecx
+  800960:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800963:	83 f9 14             	cmp    $0x14,%ecx
+  800966:	7f 4e                	jg     8009b6 <vprintfmt+0x1ec>
+  800968:	48 63 c1             	movslq %ecx,%rax
+  80096b:	48 ba 00 43 80 00 00 	movabs $0x804300,%rdx
+  800972:	00 00 00 
+  800975:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800979:	48 85 c0             	test   %rax,%rax
+  80097c:	74 38                	je     8009b6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80097e:	48 89 c1             	mov    %rax,%rcx
+  800981:	48 ba d9 44 80 00 00 	movabs $0x8044d9,%rdx
+  800988:	00 00 00 
+  80098b:	4c 89 ee             	mov    %r13,%rsi
+  80098e:	4c 89 f7             	mov    %r14,%rdi
+  800991:	b8 00 00 00 00       	mov    $0x0,%eax
+  800996:	49 b8 8d 07 80 00 00 	movabs $0x80078d,%r8
+  80099d:	00 00 00 
+  8009a0:	41 ff d0             	call   *%r8
+  8009a3:	e9 53 fe ff ff       	jmp    8007fb <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b4:	eb a4                	jmp    80095a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8009b6:	48 ba bc 3e 80 00 00 	movabs $0x803ebc,%rdx
+  8009bd:	00 00 00 
+  8009c0:	4c 89 ee             	mov    %r13,%rsi
+  8009c3:	4c 89 f7             	mov    %r14,%rdi
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cb:	49 b8 8d 07 80 00 00 	movabs $0x80078d,%r8
+  8009d2:	00 00 00 
+  8009d5:	41 ff d0             	call   *%r8
+  8009d8:	e9 1e fe ff ff       	jmp    8007fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e3:	77 6c                	ja     800a51 <vprintfmt+0x287>
+  8009e5:	89 c2                	mov    %eax,%edx
+  8009e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009eb:	83 c0 08             	add    $0x8,%eax
+  8009ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f1:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009f4:	48 85 d2             	test   %rdx,%rdx
+  8009f7:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  8009fe:	00 00 00 
+  800a01:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a05:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a09:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a0d:	7e 06                	jle    800a15 <vprintfmt+0x24b>
+  800a0f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a13:	75 4a                	jne    800a5f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a15:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a19:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a1d:	0f b6 00             	movzbl (%rax),%eax
+  800a20:	84 c0                	test   %al,%al
+  800a22:	0f 85 9a 00 00 00    	jne    800ac2 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a28:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a2b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a2f:	85 c0                	test   %eax,%eax
+  800a31:	0f 8e c4 fd ff ff    	jle    8007fb <vprintfmt+0x31>
+  800a37:	4c 89 ee             	mov    %r13,%rsi
+  800a3a:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a3f:	41 ff d6             	call   *%r14
+  800a42:	41 83 ec 01          	sub    $0x1,%r12d
+  800a46:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a4a:	75 eb                	jne    800a37 <vprintfmt+0x26d>
+  800a4c:	e9 aa fd ff ff       	jmp    8007fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb 92                	jmp    8009f1 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a5f:	49 63 f7             	movslq %r15d,%rsi
+  800a62:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a66:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  800a6d:	00 00 00 
+  800a70:	ff d0                	call   *%rax
+  800a72:	48 89 c2             	mov    %rax,%rdx
+  800a75:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a78:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a7a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a7d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a80:	85 c0                	test   %eax,%eax
+  800a82:	7e 91                	jle    800a15 <vprintfmt+0x24b>
+  800a84:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a89:	4c 89 ee             	mov    %r13,%rsi
+  800a8c:	44 89 e7             	mov    %r12d,%edi
+  800a8f:	41 ff d6             	call   *%r14
+  800a92:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a96:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a99:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a9c:	75 eb                	jne    800a89 <vprintfmt+0x2bf>
+  800a9e:	e9 72 ff ff ff       	jmp    800a15 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800aa3:	0f b6 f8             	movzbl %al,%edi
+  800aa6:	4c 89 ee             	mov    %r13,%rsi
+  800aa9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800aac:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ab0:	49 83 c4 01          	add    $0x1,%r12
+  800ab4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800aba:	84 c0                	test   %al,%al
+  800abc:	0f 84 66 ff ff ff    	je     800a28 <vprintfmt+0x25e>
+  800ac2:	45 85 ff             	test   %r15d,%r15d
+  800ac5:	78 0a                	js     800ad1 <vprintfmt+0x307>
+  800ac7:	41 83 ef 01          	sub    $0x1,%r15d
+  800acb:	0f 88 57 ff ff ff    	js     800a28 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ad1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800ad5:	74 cc                	je     800aa3 <vprintfmt+0x2d9>
+  800ad7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800ada:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800adf:	80 fa 5e             	cmp    $0x5e,%dl
+  800ae2:	77 c2                	ja     800aa6 <vprintfmt+0x2dc>
+  800ae4:	eb bd                	jmp    800aa3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae6:	40 84 f6             	test   %sil,%sil
+  800ae9:	75 26                	jne    800b11 <vprintfmt+0x347>
+    switch (lflag) {
+  800aeb:	85 d2                	test   %edx,%edx
+  800aed:	74 59                	je     800b48 <vprintfmt+0x37e>
+  800aef:	83 fa 01             	cmp    $0x1,%edx
+  800af2:	74 7b                	je     800b6f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800af4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af7:	83 f8 2f             	cmp    $0x2f,%eax
+  800afa:	0f 87 96 00 00 00    	ja     800b96 <vprintfmt+0x3cc>
+  800b00:	89 c2                	mov    %eax,%edx
+  800b02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b06:	83 c0 08             	add    $0x8,%eax
+  800b09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0c:	4c 8b 22             	mov    (%rdx),%r12
+  800b0f:	eb 17                	jmp    800b28 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b14:	83 f8 2f             	cmp    $0x2f,%eax
+  800b17:	77 21                	ja     800b3a <vprintfmt+0x370>
+  800b19:	89 c2                	mov    %eax,%edx
+  800b1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1f:	83 c0 08             	add    $0x8,%eax
+  800b22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b25:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b28:	4d 85 e4             	test   %r12,%r12
+  800b2b:	78 7a                	js     800ba7 <vprintfmt+0x3dd>
+            num = i;
+  800b2d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b30:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b35:	e9 50 02 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b46:	eb dd                	jmp    800b25 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4e:	77 11                	ja     800b61 <vprintfmt+0x397>
+  800b50:	89 c2                	mov    %eax,%edx
+  800b52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b56:	83 c0 08             	add    $0x8,%eax
+  800b59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5c:	4c 63 22             	movslq (%rdx),%r12
+  800b5f:	eb c7                	jmp    800b28 <vprintfmt+0x35e>
+  800b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	eb ed                	jmp    800b5c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b72:	83 f8 2f             	cmp    $0x2f,%eax
+  800b75:	77 11                	ja     800b88 <vprintfmt+0x3be>
+  800b77:	89 c2                	mov    %eax,%edx
+  800b79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7d:	83 c0 08             	add    $0x8,%eax
+  800b80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b83:	4c 8b 22             	mov    (%rdx),%r12
+  800b86:	eb a0                	jmp    800b28 <vprintfmt+0x35e>
+  800b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b94:	eb ed                	jmp    800b83 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba2:	e9 65 ff ff ff       	jmp    800b0c <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800baf:	41 ff d6             	call   *%r14
+                i = -i;
+  800bb2:	49 f7 dc             	neg    %r12
+  800bb5:	e9 73 ff ff ff       	jmp    800b2d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800bba:	40 84 f6             	test   %sil,%sil
+  800bbd:	75 32                	jne    800bf1 <vprintfmt+0x427>
+    switch (lflag) {
+  800bbf:	85 d2                	test   %edx,%edx
+  800bc1:	74 5d                	je     800c20 <vprintfmt+0x456>
+  800bc3:	83 fa 01             	cmp    $0x1,%edx
+  800bc6:	0f 84 82 00 00 00    	je     800c4e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800bcc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcf:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd2:	0f 87 a5 00 00 00    	ja     800c7d <vprintfmt+0x4b3>
+  800bd8:	89 c2                	mov    %eax,%edx
+  800bda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bde:	83 c0 08             	add    $0x8,%eax
+  800be1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800be7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bec:	e9 99 01 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf7:	77 19                	ja     800c12 <vprintfmt+0x448>
+  800bf9:	89 c2                	mov    %eax,%edx
+  800bfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bff:	83 c0 08             	add    $0x8,%eax
+  800c02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c0d:	e9 78 01 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+  800c12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1e:	eb e5                	jmp    800c05 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c23:	83 f8 2f             	cmp    $0x2f,%eax
+  800c26:	77 18                	ja     800c40 <vprintfmt+0x476>
+  800c28:	89 c2                	mov    %eax,%edx
+  800c2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2e:	83 c0 08             	add    $0x8,%eax
+  800c31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c34:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c3b:	e9 4a 01 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+  800c40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4c:	eb e6                	jmp    800c34 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c51:	83 f8 2f             	cmp    $0x2f,%eax
+  800c54:	77 19                	ja     800c6f <vprintfmt+0x4a5>
+  800c56:	89 c2                	mov    %eax,%edx
+  800c58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5c:	83 c0 08             	add    $0x8,%eax
+  800c5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c62:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c65:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c6a:	e9 1b 01 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+  800c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7b:	eb e5                	jmp    800c62 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c89:	e9 56 ff ff ff       	jmp    800be4 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8e:	40 84 f6             	test   %sil,%sil
+  800c91:	75 2e                	jne    800cc1 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c93:	85 d2                	test   %edx,%edx
+  800c95:	74 59                	je     800cf0 <vprintfmt+0x526>
+  800c97:	83 fa 01             	cmp    $0x1,%edx
+  800c9a:	74 7f                	je     800d1b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca2:	0f 87 9f 00 00 00    	ja     800d47 <vprintfmt+0x57d>
+  800ca8:	89 c2                	mov    %eax,%edx
+  800caa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cae:	83 c0 08             	add    $0x8,%eax
+  800cb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cb7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cbc:	e9 c9 00 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc7:	77 19                	ja     800ce2 <vprintfmt+0x518>
+  800cc9:	89 c2                	mov    %eax,%edx
+  800ccb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ccf:	83 c0 08             	add    $0x8,%eax
+  800cd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cdd:	e9 a8 00 00 00       	jmp    800d8a <vprintfmt+0x5c0>
+  800ce2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cee:	eb e5                	jmp    800cd5 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800cf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf6:	77 15                	ja     800d0d <vprintfmt+0x543>
+  800cf8:	89 c2                	mov    %eax,%edx
+  800cfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cfe:	83 c0 08             	add    $0x8,%eax
+  800d01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d04:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d0b:	eb 7d                	jmp    800d8a <vprintfmt+0x5c0>
+  800d0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d19:	eb e9                	jmp    800d04 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d21:	77 16                	ja     800d39 <vprintfmt+0x56f>
+  800d23:	89 c2                	mov    %eax,%edx
+  800d25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d29:	83 c0 08             	add    $0x8,%eax
+  800d2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d32:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d37:	eb 51                	jmp    800d8a <vprintfmt+0x5c0>
+  800d39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d45:	eb e8                	jmp    800d2f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d53:	e9 5c ff ff ff       	jmp    800cb4 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d58:	4c 89 ee             	mov    %r13,%rsi
+  800d5b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d60:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d63:	4c 89 ee             	mov    %r13,%rsi
+  800d66:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d6b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d71:	83 f8 2f             	cmp    $0x2f,%eax
+  800d74:	77 47                	ja     800dbd <vprintfmt+0x5f3>
+  800d76:	89 c2                	mov    %eax,%edx
+  800d78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7c:	83 c0 08             	add    $0x8,%eax
+  800d7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d85:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d8a:	48 83 ec 08          	sub    $0x8,%rsp
+  800d8e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d92:	0f 94 c0             	sete   %al
+  800d95:	0f b6 c0             	movzbl %al,%eax
+  800d98:	50                   	push   %rax
+  800d99:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d9e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800da2:	4c 89 ee             	mov    %r13,%rsi
+  800da5:	4c 89 f7             	mov    %r14,%rdi
+  800da8:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+            break;
+  800db4:	48 83 c4 10          	add    $0x10,%rsp
+  800db8:	e9 3e fa ff ff       	jmp    8007fb <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800dbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc9:	eb b7                	jmp    800d82 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800dcb:	40 84 f6             	test   %sil,%sil
+  800dce:	75 2b                	jne    800dfb <vprintfmt+0x631>
+    switch (lflag) {
+  800dd0:	85 d2                	test   %edx,%edx
+  800dd2:	74 56                	je     800e2a <vprintfmt+0x660>
+  800dd4:	83 fa 01             	cmp    $0x1,%edx
+  800dd7:	74 7f                	je     800e58 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800dd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ddc:	83 f8 2f             	cmp    $0x2f,%eax
+  800ddf:	0f 87 a2 00 00 00    	ja     800e87 <vprintfmt+0x6bd>
+  800de5:	89 c2                	mov    %eax,%edx
+  800de7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800deb:	83 c0 08             	add    $0x8,%eax
+  800dee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800df4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800df9:	eb 8f                	jmp    800d8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800e01:	77 19                	ja     800e1c <vprintfmt+0x652>
+  800e03:	89 c2                	mov    %eax,%edx
+  800e05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e09:	83 c0 08             	add    $0x8,%eax
+  800e0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e12:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e17:	e9 6e ff ff ff       	jmp    800d8a <vprintfmt+0x5c0>
+  800e1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e28:	eb e5                	jmp    800e0f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e30:	77 18                	ja     800e4a <vprintfmt+0x680>
+  800e32:	89 c2                	mov    %eax,%edx
+  800e34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e38:	83 c0 08             	add    $0x8,%eax
+  800e3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e40:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e45:	e9 40 ff ff ff       	jmp    800d8a <vprintfmt+0x5c0>
+  800e4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e56:	eb e6                	jmp    800e3e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e5e:	77 19                	ja     800e79 <vprintfmt+0x6af>
+  800e60:	89 c2                	mov    %eax,%edx
+  800e62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e66:	83 c0 08             	add    $0x8,%eax
+  800e69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e74:	e9 11 ff ff ff       	jmp    800d8a <vprintfmt+0x5c0>
+  800e79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e85:	eb e5                	jmp    800e6c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e93:	e9 59 ff ff ff       	jmp    800df1 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e98:	4c 89 ee             	mov    %r13,%rsi
+  800e9b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ea0:	41 ff d6             	call   *%r14
+            break;
+  800ea3:	e9 53 f9 ff ff       	jmp    8007fb <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ea8:	4c 89 ee             	mov    %r13,%rsi
+  800eab:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eb0:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800eb3:	48 83 eb 01          	sub    $0x1,%rbx
+  800eb7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ebb:	75 f6                	jne    800eb3 <vprintfmt+0x6e9>
+  800ebd:	e9 39 f9 ff ff       	jmp    8007fb <vprintfmt+0x31>
+}
+  800ec2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ec6:	5b                   	pop    %rbx
+  800ec7:	41 5c                	pop    %r12
+  800ec9:	41 5d                	pop    %r13
+  800ecb:	41 5e                	pop    %r14
+  800ecd:	41 5f                	pop    %r15
+  800ecf:	5d                   	pop    %rbp
+  800ed0:	c3                   	ret
+
+0000000000800ed1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ed1:	55                   	push   %rbp
+  800ed2:	48 89 e5             	mov    %rsp,%rbp
+  800ed5:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ed9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800edd:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ee2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ee6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800eed:	48 85 ff             	test   %rdi,%rdi
+  800ef0:	74 2b                	je     800f1d <vsnprintf+0x4c>
+  800ef2:	48 85 f6             	test   %rsi,%rsi
+  800ef5:	74 26                	je     800f1d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ef7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800efb:	48 bf 75 07 80 00 00 	movabs $0x800775,%rdi
+  800f02:	00 00 00 
+  800f05:	48 b8 ca 07 80 00 00 	movabs $0x8007ca,%rax
+  800f0c:	00 00 00 
+  800f0f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f15:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f18:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f1b:	c9                   	leave
+  800f1c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f22:	eb f7                	jmp    800f1b <vsnprintf+0x4a>
+
+0000000000800f24 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f24:	55                   	push   %rbp
+  800f25:	48 89 e5             	mov    %rsp,%rbp
+  800f28:	48 83 ec 50          	sub    $0x50,%rsp
+  800f2c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f30:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f34:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f38:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f47:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f4f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f53:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f5a:	00 00 00 
+  800f5d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f5f:	c9                   	leave
+  800f60:	c3                   	ret
+
+0000000000800f61 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f61:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f64:	74 10                	je     800f76 <strlen+0x15>
+    size_t n = 0;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f6b:	48 83 c0 01          	add    $0x1,%rax
+  800f6f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f73:	75 f6                	jne    800f6b <strlen+0xa>
+  800f75:	c3                   	ret
+    size_t n = 0;
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f7b:	c3                   	ret
+
+0000000000800f7c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f7c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f84:	48 85 f6             	test   %rsi,%rsi
+  800f87:	74 11                	je     800f9a <strnlen+0x1e>
+  800f89:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f8d:	74 0c                	je     800f9b <strnlen+0x1f>
+  800f8f:	48 83 c2 01          	add    $0x1,%rdx
+  800f93:	48 39 d0             	cmp    %rdx,%rax
+  800f96:	75 f1                	jne    800f89 <strnlen+0xd>
+  800f98:	eb 04                	jmp    800f9e <strnlen+0x22>
+  800f9a:	c3                   	ret
+  800f9b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f9e:	c3                   	ret
+
+0000000000800f9f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f9f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fab:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fae:	48 83 c2 01          	add    $0x1,%rdx
+  800fb2:	84 c9                	test   %cl,%cl
+  800fb4:	75 f1                	jne    800fa7 <strcpy+0x8>
+        ;
+    return res;
+}
+  800fb6:	c3                   	ret
+
+0000000000800fb7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fb7:	55                   	push   %rbp
+  800fb8:	48 89 e5             	mov    %rsp,%rbp
+  800fbb:	41 54                	push   %r12
+  800fbd:	53                   	push   %rbx
+  800fbe:	48 89 fb             	mov    %rdi,%rbx
+  800fc1:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800fc4:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800fd0:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800fd4:	4c 89 e6             	mov    %r12,%rsi
+  800fd7:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  800fde:	00 00 00 
+  800fe1:	ff d0                	call   *%rax
+    return dst;
+}
+  800fe3:	48 89 d8             	mov    %rbx,%rax
+  800fe6:	5b                   	pop    %rbx
+  800fe7:	41 5c                	pop    %r12
+  800fe9:	5d                   	pop    %rbp
+  800fea:	c3                   	ret
+
+0000000000800feb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800feb:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800fee:	48 85 d2             	test   %rdx,%rdx
+  800ff1:	74 1f                	je     801012 <strncpy+0x27>
+  800ff3:	48 01 fa             	add    %rdi,%rdx
+  800ff6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ff9:	48 83 c1 01          	add    $0x1,%rcx
+  800ffd:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801001:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801005:	41 80 f8 01          	cmp    $0x1,%r8b
+  801009:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80100d:	48 39 ca             	cmp    %rcx,%rdx
+  801010:	75 e7                	jne    800ff9 <strncpy+0xe>
+    }
+    return ret;
+}
+  801012:	c3                   	ret
+
+0000000000801013 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801013:	48 89 f8             	mov    %rdi,%rax
+  801016:	48 85 d2             	test   %rdx,%rdx
+  801019:	74 24                	je     80103f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80101b:	48 83 ea 01          	sub    $0x1,%rdx
+  80101f:	74 1b                	je     80103c <strlcpy+0x29>
+  801021:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801025:	0f b6 16             	movzbl (%rsi),%edx
+  801028:	84 d2                	test   %dl,%dl
+  80102a:	74 10                	je     80103c <strlcpy+0x29>
+            *dst++ = *src++;
+  80102c:	48 83 c6 01          	add    $0x1,%rsi
+  801030:	48 83 c0 01          	add    $0x1,%rax
+  801034:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801037:	48 39 c8             	cmp    %rcx,%rax
+  80103a:	75 e9                	jne    801025 <strlcpy+0x12>
+        *dst = '\0';
+  80103c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80103f:	48 29 f8             	sub    %rdi,%rax
+}
+  801042:	c3                   	ret
+
+0000000000801043 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801043:	0f b6 07             	movzbl (%rdi),%eax
+  801046:	84 c0                	test   %al,%al
+  801048:	74 13                	je     80105d <strcmp+0x1a>
+  80104a:	38 06                	cmp    %al,(%rsi)
+  80104c:	75 0f                	jne    80105d <strcmp+0x1a>
+  80104e:	48 83 c7 01          	add    $0x1,%rdi
+  801052:	48 83 c6 01          	add    $0x1,%rsi
+  801056:	0f b6 07             	movzbl (%rdi),%eax
+  801059:	84 c0                	test   %al,%al
+  80105b:	75 ed                	jne    80104a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80105d:	0f b6 c0             	movzbl %al,%eax
+  801060:	0f b6 16             	movzbl (%rsi),%edx
+  801063:	29 d0                	sub    %edx,%eax
+}
+  801065:	c3                   	ret
+
+0000000000801066 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801066:	48 85 d2             	test   %rdx,%rdx
+  801069:	74 1f                	je     80108a <strncmp+0x24>
+  80106b:	0f b6 07             	movzbl (%rdi),%eax
+  80106e:	84 c0                	test   %al,%al
+  801070:	74 1e                	je     801090 <strncmp+0x2a>
+  801072:	3a 06                	cmp    (%rsi),%al
+  801074:	75 1a                	jne    801090 <strncmp+0x2a>
+  801076:	48 83 c7 01          	add    $0x1,%rdi
+  80107a:	48 83 c6 01          	add    $0x1,%rsi
+  80107e:	48 83 ea 01          	sub    $0x1,%rdx
+  801082:	75 e7                	jne    80106b <strncmp+0x5>
+
+    if (!n) return 0;
+  801084:	b8 00 00 00 00       	mov    $0x0,%eax
+  801089:	c3                   	ret
+  80108a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108f:	c3                   	ret
+  801090:	48 85 d2             	test   %rdx,%rdx
+  801093:	74 09                	je     80109e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801095:	0f b6 07             	movzbl (%rdi),%eax
+  801098:	0f b6 16             	movzbl (%rsi),%edx
+  80109b:	29 d0                	sub    %edx,%eax
+  80109d:	c3                   	ret
+    if (!n) return 0;
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010a3:	c3                   	ret
+
+00000000008010a4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010a4:	0f b6 17             	movzbl (%rdi),%edx
+  8010a7:	84 d2                	test   %dl,%dl
+  8010a9:	74 18                	je     8010c3 <strchr+0x1f>
+        if (*str == c) {
+  8010ab:	0f be d2             	movsbl %dl,%edx
+  8010ae:	39 f2                	cmp    %esi,%edx
+  8010b0:	74 17                	je     8010c9 <strchr+0x25>
+    for (; *str; str++) {
+  8010b2:	48 83 c7 01          	add    $0x1,%rdi
+  8010b6:	0f b6 17             	movzbl (%rdi),%edx
+  8010b9:	84 d2                	test   %dl,%dl
+  8010bb:	75 ee                	jne    8010ab <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c2:	c3                   	ret
+  8010c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c8:	c3                   	ret
+  8010c9:	48 89 f8             	mov    %rdi,%rax
+}
+  8010cc:	c3                   	ret
+
+00000000008010cd <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010cd:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010d0:	0f b6 17             	movzbl (%rdi),%edx
+  8010d3:	84 d2                	test   %dl,%dl
+  8010d5:	74 13                	je     8010ea <strfind+0x1d>
+  8010d7:	0f be d2             	movsbl %dl,%edx
+  8010da:	39 f2                	cmp    %esi,%edx
+  8010dc:	74 0b                	je     8010e9 <strfind+0x1c>
+  8010de:	48 83 c0 01          	add    $0x1,%rax
+  8010e2:	0f b6 10             	movzbl (%rax),%edx
+  8010e5:	84 d2                	test   %dl,%dl
+  8010e7:	75 ee                	jne    8010d7 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8010e9:	c3                   	ret
+  8010ea:	c3                   	ret
+
+00000000008010eb <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010eb:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010ee:	48 89 f8             	mov    %rdi,%rax
+  8010f1:	48 f7 d8             	neg    %rax
+  8010f4:	83 e0 07             	and    $0x7,%eax
+  8010f7:	49 89 d1             	mov    %rdx,%r9
+  8010fa:	49 29 c1             	sub    %rax,%r9
+  8010fd:	78 36                	js     801135 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010ff:	40 0f b6 c6          	movzbl %sil,%eax
+  801103:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80110a:	01 01 01 
+  80110d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801111:	40 f6 c7 07          	test   $0x7,%dil
+  801115:	75 38                	jne    80114f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801117:	4c 89 c9             	mov    %r9,%rcx
+  80111a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80111e:	74 0c                	je     80112c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801120:	fc                   	cld
+  801121:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801124:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801128:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80112c:	4d 85 c9             	test   %r9,%r9
+  80112f:	75 45                	jne    801176 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801131:	4c 89 c0             	mov    %r8,%rax
+  801134:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801135:	48 85 d2             	test   %rdx,%rdx
+  801138:	74 f7                	je     801131 <memset+0x46>
+  80113a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80113d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801140:	48 83 c0 01          	add    $0x1,%rax
+  801144:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801148:	48 39 c2             	cmp    %rax,%rdx
+  80114b:	75 f3                	jne    801140 <memset+0x55>
+  80114d:	eb e2                	jmp    801131 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80114f:	40 f6 c7 01          	test   $0x1,%dil
+  801153:	74 06                	je     80115b <memset+0x70>
+  801155:	88 07                	mov    %al,(%rdi)
+  801157:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80115b:	40 f6 c7 02          	test   $0x2,%dil
+  80115f:	74 07                	je     801168 <memset+0x7d>
+  801161:	66 89 07             	mov    %ax,(%rdi)
+  801164:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801168:	40 f6 c7 04          	test   $0x4,%dil
+  80116c:	74 a9                	je     801117 <memset+0x2c>
+  80116e:	89 07                	mov    %eax,(%rdi)
+  801170:	48 83 c7 04          	add    $0x4,%rdi
+  801174:	eb a1                	jmp    801117 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801176:	41 f6 c1 04          	test   $0x4,%r9b
+  80117a:	74 06                	je     801182 <memset+0x97>
+  80117c:	89 07                	mov    %eax,(%rdi)
+  80117e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801182:	41 f6 c1 02          	test   $0x2,%r9b
+  801186:	74 07                	je     80118f <memset+0xa4>
+  801188:	66 89 07             	mov    %ax,(%rdi)
+  80118b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80118f:	41 f6 c1 01          	test   $0x1,%r9b
+  801193:	74 9c                	je     801131 <memset+0x46>
+  801195:	88 07                	mov    %al,(%rdi)
+  801197:	eb 98                	jmp    801131 <memset+0x46>
+
+0000000000801199 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801199:	48 89 f8             	mov    %rdi,%rax
+  80119c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80119f:	48 39 fe             	cmp    %rdi,%rsi
+  8011a2:	73 3b                	jae    8011df <memmove+0x46>
+  8011a4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011a8:	48 39 d7             	cmp    %rdx,%rdi
+  8011ab:	73 32                	jae    8011df <memmove+0x46>
+        s += n;
+        d += n;
+  8011ad:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011b1:	48 89 d6             	mov    %rdx,%rsi
+  8011b4:	48 09 fe             	or     %rdi,%rsi
+  8011b7:	48 09 ce             	or     %rcx,%rsi
+  8011ba:	40 f6 c6 07          	test   $0x7,%sil
+  8011be:	75 12                	jne    8011d2 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011c0:	48 83 ef 08          	sub    $0x8,%rdi
+  8011c4:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011c8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011cc:	fd                   	std
+  8011cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011d0:	fc                   	cld
+  8011d1:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011d2:	48 83 ef 01          	sub    $0x1,%rdi
+  8011d6:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011da:	fd                   	std
+  8011db:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011dd:	eb f1                	jmp    8011d0 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011df:	48 89 f2             	mov    %rsi,%rdx
+  8011e2:	48 09 c2             	or     %rax,%rdx
+  8011e5:	48 09 ca             	or     %rcx,%rdx
+  8011e8:	f6 c2 07             	test   $0x7,%dl
+  8011eb:	75 0c                	jne    8011f9 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011ed:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011f1:	48 89 c7             	mov    %rax,%rdi
+  8011f4:	fc                   	cld
+  8011f5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011f8:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011f9:	48 89 c7             	mov    %rax,%rdi
+  8011fc:	fc                   	cld
+  8011fd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011ff:	c3                   	ret
+
+0000000000801200 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801204:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+}
+  801210:	5d                   	pop    %rbp
+  801211:	c3                   	ret
+
+0000000000801212 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801212:	55                   	push   %rbp
+  801213:	48 89 e5             	mov    %rsp,%rbp
+  801216:	41 57                	push   %r15
+  801218:	41 56                	push   %r14
+  80121a:	41 55                	push   %r13
+  80121c:	41 54                	push   %r12
+  80121e:	53                   	push   %rbx
+  80121f:	48 83 ec 08          	sub    $0x8,%rsp
+  801223:	49 89 fe             	mov    %rdi,%r14
+  801226:	49 89 f7             	mov    %rsi,%r15
+  801229:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80122c:	48 89 f7             	mov    %rsi,%rdi
+  80122f:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+  80123b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80123e:	48 89 de             	mov    %rbx,%rsi
+  801241:	4c 89 f7             	mov    %r14,%rdi
+  801244:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  80124b:	00 00 00 
+  80124e:	ff d0                	call   *%rax
+  801250:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801253:	48 39 c3             	cmp    %rax,%rbx
+  801256:	74 36                	je     80128e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801258:	48 89 d8             	mov    %rbx,%rax
+  80125b:	4c 29 e8             	sub    %r13,%rax
+  80125e:	49 39 c4             	cmp    %rax,%r12
+  801261:	73 31                	jae    801294 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801263:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801268:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80126c:	4c 89 fe             	mov    %r15,%rsi
+  80126f:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801276:	00 00 00 
+  801279:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80127b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80127f:	48 83 c4 08          	add    $0x8,%rsp
+  801283:	5b                   	pop    %rbx
+  801284:	41 5c                	pop    %r12
+  801286:	41 5d                	pop    %r13
+  801288:	41 5e                	pop    %r14
+  80128a:	41 5f                	pop    %r15
+  80128c:	5d                   	pop    %rbp
+  80128d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80128e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801292:	eb eb                	jmp    80127f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801294:	48 83 eb 01          	sub    $0x1,%rbx
+  801298:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80129c:	48 89 da             	mov    %rbx,%rdx
+  80129f:	4c 89 fe             	mov    %r15,%rsi
+  8012a2:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  8012a9:	00 00 00 
+  8012ac:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012ae:	49 01 de             	add    %rbx,%r14
+  8012b1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012b6:	eb c3                	jmp    80127b <strlcat+0x69>
+
+00000000008012b8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012b8:	48 85 d2             	test   %rdx,%rdx
+  8012bb:	74 2d                	je     8012ea <memcmp+0x32>
+  8012bd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012c2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012c6:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012cb:	44 38 c1             	cmp    %r8b,%cl
+  8012ce:	75 0f                	jne    8012df <memcmp+0x27>
+    while (n-- > 0) {
+  8012d0:	48 83 c0 01          	add    $0x1,%rax
+  8012d4:	48 39 c2             	cmp    %rax,%rdx
+  8012d7:	75 e9                	jne    8012c2 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012df:	0f b6 c1             	movzbl %cl,%eax
+  8012e2:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012e6:	44 29 c0             	sub    %r8d,%eax
+  8012e9:	c3                   	ret
+    return 0;
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ef:	c3                   	ret
+
+00000000008012f0 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012f0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012f4:	48 39 c7             	cmp    %rax,%rdi
+  8012f7:	73 0f                	jae    801308 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012f9:	40 38 37             	cmp    %sil,(%rdi)
+  8012fc:	74 0e                	je     80130c <memfind+0x1c>
+    for (; src < end; src++) {
+  8012fe:	48 83 c7 01          	add    $0x1,%rdi
+  801302:	48 39 f8             	cmp    %rdi,%rax
+  801305:	75 f2                	jne    8012f9 <memfind+0x9>
+  801307:	c3                   	ret
+  801308:	48 89 f8             	mov    %rdi,%rax
+  80130b:	c3                   	ret
+  80130c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80130f:	c3                   	ret
+
+0000000000801310 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801310:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801313:	0f b6 37             	movzbl (%rdi),%esi
+  801316:	40 80 fe 20          	cmp    $0x20,%sil
+  80131a:	74 06                	je     801322 <strtol+0x12>
+  80131c:	40 80 fe 09          	cmp    $0x9,%sil
+  801320:	75 13                	jne    801335 <strtol+0x25>
+  801322:	48 83 c7 01          	add    $0x1,%rdi
+  801326:	0f b6 37             	movzbl (%rdi),%esi
+  801329:	40 80 fe 20          	cmp    $0x20,%sil
+  80132d:	74 f3                	je     801322 <strtol+0x12>
+  80132f:	40 80 fe 09          	cmp    $0x9,%sil
+  801333:	74 ed                	je     801322 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801335:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801338:	83 e0 fd             	and    $0xfffffffd,%eax
+  80133b:	3c 01                	cmp    $0x1,%al
+  80133d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801341:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801347:	75 0f                	jne    801358 <strtol+0x48>
+  801349:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80134c:	74 14                	je     801362 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80134e:	85 d2                	test   %edx,%edx
+  801350:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801355:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801358:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80135d:	4c 63 ca             	movslq %edx,%r9
+  801360:	eb 36                	jmp    801398 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801362:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801366:	74 0f                	je     801377 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801368:	85 d2                	test   %edx,%edx
+  80136a:	75 ec                	jne    801358 <strtol+0x48>
+        s++;
+  80136c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801370:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801375:	eb e1                	jmp    801358 <strtol+0x48>
+        s += 2;
+  801377:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80137b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801380:	eb d6                	jmp    801358 <strtol+0x48>
+            dig -= '0';
+  801382:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801385:	44 0f b6 c1          	movzbl %cl,%r8d
+  801389:	41 39 d0             	cmp    %edx,%r8d
+  80138c:	7d 21                	jge    8013af <strtol+0x9f>
+        val = val * base + dig;
+  80138e:	49 0f af c1          	imul   %r9,%rax
+  801392:	0f b6 c9             	movzbl %cl,%ecx
+  801395:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801398:	48 83 c7 01          	add    $0x1,%rdi
+  80139c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013a0:	80 f9 39             	cmp    $0x39,%cl
+  8013a3:	76 dd                	jbe    801382 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013a5:	80 f9 7b             	cmp    $0x7b,%cl
+  8013a8:	77 05                	ja     8013af <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013aa:	83 e9 57             	sub    $0x57,%ecx
+  8013ad:	eb d6                	jmp    801385 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013af:	4d 85 d2             	test   %r10,%r10
+  8013b2:	74 03                	je     8013b7 <strtol+0xa7>
+  8013b4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013b7:	48 89 c2             	mov    %rax,%rdx
+  8013ba:	48 f7 da             	neg    %rdx
+  8013bd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013c1:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013c5:	c3                   	ret
+
+00000000008013c6 <strrev>:
+
+void
+strrev(char *str)
+{
+  8013c6:	55                   	push   %rbp
+  8013c7:	48 89 e5             	mov    %rsp,%rbp
+  8013ca:	53                   	push   %rbx
+  8013cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8013cf:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8013d2:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  8013d9:	00 00 00 
+  8013dc:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8013de:	83 e8 01             	sub    $0x1,%eax
+  8013e1:	85 c0                	test   %eax,%eax
+  8013e3:	7e 22                	jle    801407 <strrev+0x41>
+  8013e5:	48 98                	cltq
+  8013e7:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8013ec:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8013f0:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8013f4:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8013f8:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8013fb:	48 83 c2 01          	add    $0x1,%rdx
+  8013ff:	48 83 e8 01          	sub    $0x1,%rax
+  801403:	39 c2                	cmp    %eax,%edx
+  801405:	7c e5                	jl     8013ec <strrev+0x26>
+	}
+}
+  801407:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140b:	c9                   	leave
+  80140c:	c3                   	ret
+
+000000000080140d <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80140d:	85 d2                	test   %edx,%edx
+  80140f:	0f 84 80 00 00 00    	je     801495 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801415:	55                   	push   %rbp
+  801416:	48 89 e5             	mov    %rsp,%rbp
+  801419:	53                   	push   %rbx
+  80141a:	48 83 ec 08          	sub    $0x8,%rsp
+  80141e:	49 89 f2             	mov    %rsi,%r10
+  801421:	41 89 d3             	mov    %edx,%r11d
+  801424:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801427:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80142c:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80142f:	eb 20                	jmp    801451 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801431:	41 89 f1             	mov    %esi,%r9d
+  801434:	83 c2 30             	add    $0x30,%edx
+  801437:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80143a:	89 f8                	mov    %edi,%eax
+  80143c:	99                   	cltd
+  80143d:	f7 f9                	idiv   %ecx
+  80143f:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801441:	85 c0                	test   %eax,%eax
+  801443:	74 2e                	je     801473 <itoa+0x66>
+  801445:	83 c6 01             	add    $0x1,%esi
+  801448:	49 83 c0 01          	add    $0x1,%r8
+  80144c:	44 39 cb             	cmp    %r9d,%ebx
+  80144f:	7e 15                	jle    801466 <itoa+0x59>
+		digit = sum % base;
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	99                   	cltd
+  801454:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801456:	83 fa 09             	cmp    $0x9,%edx
+  801459:	7e d6                	jle    801431 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80145b:	41 89 f1             	mov    %esi,%r9d
+  80145e:	83 c2 37             	add    $0x37,%edx
+  801461:	41 88 10             	mov    %dl,(%r8)
+  801464:	eb d4                	jmp    80143a <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801466:	41 83 eb 01          	sub    $0x1,%r11d
+  80146a:	45 39 cb             	cmp    %r9d,%r11d
+  80146d:	75 04                	jne    801473 <itoa+0x66>
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	75 28                	jne    80149b <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801473:	4d 63 c9             	movslq %r9d,%r9
+  801476:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80147b:	4c 89 d7             	mov    %r10,%rdi
+  80147e:	48 b8 c6 13 80 00 00 	movabs $0x8013c6,%rax
+  801485:	00 00 00 
+  801488:	ff d0                	call   *%rax
+	return 0;
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801493:	c9                   	leave
+  801494:	c3                   	ret
+		return -1;
+  801495:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80149a:	c3                   	ret
+		return -1;
+  80149b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8014a0:	eb ed                	jmp    80148f <itoa+0x82>
+
+00000000008014a2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014a2:	55                   	push   %rbp
+  8014a3:	48 89 e5             	mov    %rsp,%rbp
+  8014a6:	53                   	push   %rbx
+  8014a7:	48 89 fa             	mov    %rdi,%rdx
+  8014aa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ad:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c7:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+00000000008014cf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014de:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+
+0000000000801500 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801500:	55                   	push   %rbp
+  801501:	48 89 e5             	mov    %rsp,%rbp
+  801504:	53                   	push   %rbx
+  801505:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801509:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801511:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801520:	be 00 00 00 00       	mov    $0x0,%esi
+  801525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152d:	48 85 c0             	test   %rax,%rax
+  801530:	7f 06                	jg     801538 <sys_env_destroy+0x38>
+}
+  801532:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801538:	49 89 c0             	mov    %rax,%r8
+  80153b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801540:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  801547:	00 00 00 
+  80154a:	be 26 00 00 00       	mov    $0x26,%esi
+  80154f:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  801556:	00 00 00 
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155e:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  801565:	00 00 00 
+  801568:	41 ff d1             	call   *%r9
+
+000000000080156b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801570:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801584:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801589:	be 00 00 00 00       	mov    $0x0,%esi
+  80158e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801594:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801596:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159a:	c9                   	leave
+  80159b:	c3                   	ret
+
+000000000080159c <sys_yield>:
+
+void
+sys_yield(void) {
+  80159c:	55                   	push   %rbp
+  80159d:	48 89 e5             	mov    %rsp,%rbp
+  8015a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+
+00000000008015cd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8015cd:	55                   	push   %rbp
+  8015ce:	48 89 e5             	mov    %rsp,%rbp
+  8015d1:	53                   	push   %rbx
+  8015d2:	48 89 fa             	mov    %rdi,%rdx
+  8015d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8015e4:	00 00 00 
+  8015e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8015f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+
+00000000008015ff <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015ff:	55                   	push   %rbp
+  801600:	48 89 e5             	mov    %rsp,%rbp
+  801603:	53                   	push   %rbx
+  801604:	49 89 f8             	mov    %rdi,%r8
+  801607:	48 89 d3             	mov    %rdx,%rbx
+  80160a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80160d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801612:	4c 89 c2             	mov    %r8,%rdx
+  801615:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801618:	be 00 00 00 00       	mov    $0x0,%esi
+  80161d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801623:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+
+000000000080162b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80162b:	55                   	push   %rbp
+  80162c:	48 89 e5             	mov    %rsp,%rbp
+  80162f:	53                   	push   %rbx
+  801630:	48 83 ec 08          	sub    $0x8,%rsp
+  801634:	89 f8                	mov    %edi,%eax
+  801636:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801639:	48 63 f9             	movslq %ecx,%rdi
+  80163c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801644:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801652:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801654:	48 85 c0             	test   %rax,%rax
+  801657:	7f 06                	jg     80165f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801659:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165d:	c9                   	leave
+  80165e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165f:	49 89 c0             	mov    %rax,%r8
+  801662:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801667:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  80166e:	00 00 00 
+  801671:	be 26 00 00 00       	mov    $0x26,%esi
+  801676:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  80167d:	00 00 00 
+  801680:	b8 00 00 00 00       	mov    $0x0,%eax
+  801685:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  80168c:	00 00 00 
+  80168f:	41 ff d1             	call   *%r9
+
+0000000000801692 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+  801696:	53                   	push   %rbx
+  801697:	48 83 ec 08          	sub    $0x8,%rsp
+  80169b:	89 f8                	mov    %edi,%eax
+  80169d:	49 89 f2             	mov    %rsi,%r10
+  8016a0:	48 89 cf             	mov    %rcx,%rdi
+  8016a3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016a6:	48 63 da             	movslq %edx,%rbx
+  8016a9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ac:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b9:	48 85 c0             	test   %rax,%rax
+  8016bc:	7f 06                	jg     8016c4 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c2:	c9                   	leave
+  8016c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c4:	49 89 c0             	mov    %rax,%r8
+  8016c7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016cc:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  8016d3:	00 00 00 
+  8016d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016db:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  8016e2:	00 00 00 
+  8016e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ea:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  8016f1:	00 00 00 
+  8016f4:	41 ff d1             	call   *%r9
+
+00000000008016f7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8016f7:	55                   	push   %rbp
+  8016f8:	48 89 e5             	mov    %rsp,%rbp
+  8016fb:	53                   	push   %rbx
+  8016fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801700:	48 89 f1             	mov    %rsi,%rcx
+  801703:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801706:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801709:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801713:	be 00 00 00 00       	mov    $0x0,%esi
+  801718:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801720:	48 85 c0             	test   %rax,%rax
+  801723:	7f 06                	jg     80172b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801725:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801729:	c9                   	leave
+  80172a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80172b:	49 89 c0             	mov    %rax,%r8
+  80172e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801733:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  80173a:	00 00 00 
+  80173d:	be 26 00 00 00       	mov    $0x26,%esi
+  801742:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  801749:	00 00 00 
+  80174c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801751:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  801758:	00 00 00 
+  80175b:	41 ff d1             	call   *%r9
+
+000000000080175e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	53                   	push   %rbx
+  801763:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801767:	48 63 ce             	movslq %esi,%rcx
+  80176a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177c:	be 00 00 00 00       	mov    $0x0,%esi
+  801781:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801787:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801789:	48 85 c0             	test   %rax,%rax
+  80178c:	7f 06                	jg     801794 <sys_env_set_status+0x36>
+}
+  80178e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801794:	49 89 c0             	mov    %rax,%r8
+  801797:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80179c:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  8017a3:	00 00 00 
+  8017a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ab:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  8017b2:	00 00 00 
+  8017b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ba:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  8017c1:	00 00 00 
+  8017c4:	41 ff d1             	call   *%r9
+
+00000000008017c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	53                   	push   %rbx
+  8017cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f2:	48 85 c0             	test   %rax,%rax
+  8017f5:	7f 06                	jg     8017fd <sys_env_set_trapframe+0x36>
+}
+  8017f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fd:	49 89 c0             	mov    %rax,%r8
+  801800:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801805:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  80180c:	00 00 00 
+  80180f:	be 26 00 00 00       	mov    $0x26,%esi
+  801814:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  80181b:	00 00 00 
+  80181e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801823:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  80182a:	00 00 00 
+  80182d:	41 ff d1             	call   *%r9
+
+0000000000801830 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801830:	55                   	push   %rbp
+  801831:	48 89 e5             	mov    %rsp,%rbp
+  801834:	53                   	push   %rbx
+  801835:	48 83 ec 08          	sub    $0x8,%rsp
+  801839:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80183c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80183f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801844:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801849:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184e:	be 00 00 00 00       	mov    $0x0,%esi
+  801853:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801859:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80185b:	48 85 c0             	test   %rax,%rax
+  80185e:	7f 06                	jg     801866 <sys_env_set_pgfault_upcall+0x36>
+}
+  801860:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801866:	49 89 c0             	mov    %rax,%r8
+  801869:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80186e:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  801875:	00 00 00 
+  801878:	be 26 00 00 00       	mov    $0x26,%esi
+  80187d:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  801884:	00 00 00 
+  801887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188c:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  801893:	00 00 00 
+  801896:	41 ff d1             	call   *%r9
+
+0000000000801899 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	53                   	push   %rbx
+  80189e:	89 f8                	mov    %edi,%eax
+  8018a0:	49 89 f1             	mov    %rsi,%r9
+  8018a3:	48 89 d3             	mov    %rdx,%rbx
+  8018a6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018a9:	49 63 f0             	movslq %r8d,%rsi
+  8018ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018af:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018b4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018bd:	cd 30                	int    $0x30
+}
+  8018bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c3:	c9                   	leave
+  8018c4:	c3                   	ret
+
+00000000008018c5 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8018c5:	55                   	push   %rbp
+  8018c6:	48 89 e5             	mov    %rsp,%rbp
+  8018c9:	53                   	push   %rbx
+  8018ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ce:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8018d1:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018d9:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ee:	48 85 c0             	test   %rax,%rax
+  8018f1:	7f 06                	jg     8018f9 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f9:	49 89 c0             	mov    %rax,%r8
+  8018fc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801901:	48 ba c8 43 80 00 00 	movabs $0x8043c8,%rdx
+  801908:	00 00 00 
+  80190b:	be 26 00 00 00       	mov    $0x26,%esi
+  801910:	48 bf e7 43 80 00 00 	movabs $0x8043e7,%rdi
+  801917:	00 00 00 
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191f:	49 b9 2a 05 80 00 00 	movabs $0x80052a,%r9
+  801926:	00 00 00 
+  801929:	41 ff d1             	call   *%r9
+
+000000000080192c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80192c:	55                   	push   %rbp
+  80192d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801930:	ba 00 00 00 00       	mov    $0x0,%edx
+  801935:	48 b8 c5 18 80 00 00 	movabs $0x8018c5,%rax
+  80193c:	00 00 00 
+  80193f:	ff d0                	call   *%rax
+}
+  801941:	5d                   	pop    %rbp
+  801942:	c3                   	ret
+
+0000000000801943 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801943:	55                   	push   %rbp
+  801944:	48 89 e5             	mov    %rsp,%rbp
+  801947:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801948:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80194d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801952:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801957:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80195c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801961:	be 00 00 00 00       	mov    $0x0,%esi
+  801966:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80196c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80196e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+
+0000000000801974 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801974:	55                   	push   %rbp
+  801975:	48 89 e5             	mov    %rsp,%rbp
+  801978:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801979:	48 63 ce             	movslq %esi,%rcx
+  80197c:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801980:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801985:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80198f:	be 00 00 00 00       	mov    $0x0,%esi
+  801994:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199a:	cd 30                	int    $0x30
+}
+  80199c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a0:	c9                   	leave
+  8019a1:	c3                   	ret
+
+00000000008019a2 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8019a2:	55                   	push   %rbp
+  8019a3:	48 89 e5             	mov    %rsp,%rbp
+  8019a6:	53                   	push   %rbx
+  8019a7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8019aa:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ae:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c8:	cd 30                	int    $0x30
+}
+  8019ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+00000000008019d0 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	53                   	push   %rbx
+  8019d5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8019d8:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019db:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f3:	cd 30                	int    $0x30
+}
+  8019f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+
+00000000008019fb <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  8019fb:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  8019fe:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801a02:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801a05:	7e 0f                	jle    801a16 <argstart+0x1b>
+  801a07:	48 b8 3b 3e 80 00 00 	movabs $0x803e3b,%rax
+  801a0e:	00 00 00 
+  801a11:	48 85 f6             	test   %rsi,%rsi
+  801a14:	75 05                	jne    801a1b <argstart+0x20>
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1b:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801a1f:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801a26:	00 
+}
+  801a27:	c3                   	ret
+
+0000000000801a28 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801a28:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801a2f:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801a30:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801a34:	48 85 c0             	test   %rax,%rax
+  801a37:	0f 84 8f 00 00 00    	je     801acc <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801a3d:	55                   	push   %rbp
+  801a3e:	48 89 e5             	mov    %rsp,%rbp
+  801a41:	53                   	push   %rbx
+  801a42:	48 83 ec 08          	sub    $0x8,%rsp
+  801a46:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801a49:	80 38 00             	cmpb   $0x0,(%rax)
+  801a4c:	75 52                	jne    801aa0 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  801a4e:	48 8b 17             	mov    (%rdi),%rdx
+  801a51:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801a54:	74 67                	je     801abd <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801a56:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801a5a:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  801a5e:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801a61:	75 5a                	jne    801abd <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801a63:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801a67:	74 54                	je     801abd <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801a69:	48 83 c0 01          	add    $0x1,%rax
+  801a6d:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801a71:	8b 12                	mov    (%rdx),%edx
+  801a73:	83 ea 01             	sub    $0x1,%edx
+  801a76:	48 63 d2             	movslq %edx,%rdx
+  801a79:	48 c1 e2 03          	shl    $0x3,%rdx
+  801a7d:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801a81:	48 83 c7 08          	add    $0x8,%rdi
+  801a85:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  801a8c:	00 00 00 
+  801a8f:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  801a91:	48 8b 03             	mov    (%rbx),%rax
+  801a94:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801a97:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801a9b:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801a9e:	74 17                	je     801ab7 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801aa0:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801aa4:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801aa7:	48 83 c0 01          	add    $0x1,%rax
+  801aab:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801aaf:	89 d0                	mov    %edx,%eax
+  801ab1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab5:	c9                   	leave
+  801ab6:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801ab7:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801abb:	75 e3                	jne    801aa0 <argnext+0x78>
+    args->curarg = 0;
+  801abd:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801ac4:	00 
+    return -1;
+  801ac5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801aca:	eb e3                	jmp    801aaf <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801acc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801ad1:	89 d0                	mov    %edx,%eax
+  801ad3:	c3                   	ret
+
+0000000000801ad4 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801ad4:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801ad8:	48 85 c0             	test   %rax,%rax
+  801adb:	74 7b                	je     801b58 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  801add:	55                   	push   %rbp
+  801ade:	48 89 e5             	mov    %rsp,%rbp
+  801ae1:	53                   	push   %rbx
+  801ae2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae6:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801ae9:	80 38 00             	cmpb   $0x0,(%rax)
+  801aec:	74 1c                	je     801b0a <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801aee:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801af2:	48 b8 3b 3e 80 00 00 	movabs $0x803e3b,%rax
+  801af9:	00 00 00 
+  801afc:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801b00:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801b04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b08:	c9                   	leave
+  801b09:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801b0a:	48 8b 07             	mov    (%rdi),%rax
+  801b0d:	83 38 01             	cmpl   $0x1,(%rax)
+  801b10:	7f 12                	jg     801b24 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801b12:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801b19:	00 
+        args->curarg = 0;
+  801b1a:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801b21:	00 
+  801b22:	eb dc                	jmp    801b00 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801b24:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801b28:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801b2c:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801b30:	8b 10                	mov    (%rax),%edx
+  801b32:	83 ea 01             	sub    $0x1,%edx
+  801b35:	48 63 d2             	movslq %edx,%rdx
+  801b38:	48 c1 e2 03          	shl    $0x3,%rdx
+  801b3c:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801b40:	48 83 c7 08          	add    $0x8,%rdi
+  801b44:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  801b4b:	00 00 00 
+  801b4e:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801b50:	48 8b 03             	mov    (%rbx),%rax
+  801b53:	83 28 01             	subl   $0x1,(%rax)
+  801b56:	eb a8                	jmp    801b00 <argnextvalue+0x2c>
+}
+  801b58:	c3                   	ret
+
+0000000000801b59 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801b59:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801b5d:	48 85 c0             	test   %rax,%rax
+  801b60:	74 01                	je     801b63 <argvalue+0xa>
+}
+  801b62:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801b67:	48 b8 d4 1a 80 00 00 	movabs $0x801ad4,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+}
+  801b73:	5d                   	pop    %rbp
+  801b74:	c3                   	ret
+
+0000000000801b75 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b75:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b7c:	ff ff ff 
+  801b7f:	48 01 f8             	add    %rdi,%rax
+  801b82:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b86:	c3                   	ret
+
+0000000000801b87 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b87:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b8e:	ff ff ff 
+  801b91:	48 01 f8             	add    %rdi,%rax
+  801b94:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b98:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b9e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ba2:	c3                   	ret
+
+0000000000801ba3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ba3:	55                   	push   %rbp
+  801ba4:	48 89 e5             	mov    %rsp,%rbp
+  801ba7:	41 57                	push   %r15
+  801ba9:	41 56                	push   %r14
+  801bab:	41 55                	push   %r13
+  801bad:	41 54                	push   %r12
+  801baf:	53                   	push   %rbx
+  801bb0:	48 83 ec 08          	sub    $0x8,%rsp
+  801bb4:	49 89 ff             	mov    %rdi,%r15
+  801bb7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bbc:	49 bd 66 38 80 00 00 	movabs $0x803866,%r13
+  801bc3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801bc6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bcc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bcf:	48 89 df             	mov    %rbx,%rdi
+  801bd2:	41 ff d5             	call   *%r13
+  801bd5:	83 e0 04             	and    $0x4,%eax
+  801bd8:	74 17                	je     801bf1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bda:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801be1:	4c 39 f3             	cmp    %r14,%rbx
+  801be4:	75 e6                	jne    801bcc <fd_alloc+0x29>
+  801be6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bec:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bf1:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bf4:	48 83 c4 08          	add    $0x8,%rsp
+  801bf8:	5b                   	pop    %rbx
+  801bf9:	41 5c                	pop    %r12
+  801bfb:	41 5d                	pop    %r13
+  801bfd:	41 5e                	pop    %r14
+  801bff:	41 5f                	pop    %r15
+  801c01:	5d                   	pop    %rbp
+  801c02:	c3                   	ret
+
+0000000000801c03 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c03:	83 ff 1f             	cmp    $0x1f,%edi
+  801c06:	77 39                	ja     801c41 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c08:	55                   	push   %rbp
+  801c09:	48 89 e5             	mov    %rsp,%rbp
+  801c0c:	41 54                	push   %r12
+  801c0e:	53                   	push   %rbx
+  801c0f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c12:	48 63 df             	movslq %edi,%rbx
+  801c15:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c1c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c20:	48 89 df             	mov    %rbx,%rdi
+  801c23:	48 b8 66 38 80 00 00 	movabs $0x803866,%rax
+  801c2a:	00 00 00 
+  801c2d:	ff d0                	call   *%rax
+  801c2f:	a8 04                	test   $0x4,%al
+  801c31:	74 14                	je     801c47 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c33:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c3c:	5b                   	pop    %rbx
+  801c3d:	41 5c                	pop    %r12
+  801c3f:	5d                   	pop    %rbp
+  801c40:	c3                   	ret
+        return -E_INVAL;
+  801c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c46:	c3                   	ret
+        return -E_INVAL;
+  801c47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4c:	eb ee                	jmp    801c3c <fd_lookup+0x39>
+
+0000000000801c4e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	41 54                	push   %r12
+  801c54:	53                   	push   %rbx
+  801c55:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c58:	48 b8 a0 44 80 00 00 	movabs $0x8044a0,%rax
+  801c5f:	00 00 00 
+  801c62:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801c69:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c6c:	39 3b                	cmp    %edi,(%rbx)
+  801c6e:	74 47                	je     801cb7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c70:	48 83 c0 08          	add    $0x8,%rax
+  801c74:	48 8b 18             	mov    (%rax),%rbx
+  801c77:	48 85 db             	test   %rbx,%rbx
+  801c7a:	75 f0                	jne    801c6c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c7c:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801c83:	00 00 00 
+  801c86:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c8c:	89 fa                	mov    %edi,%edx
+  801c8e:	48 bf f8 43 80 00 00 	movabs $0x8043f8,%rdi
+  801c95:	00 00 00 
+  801c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9d:	48 b9 7a 06 80 00 00 	movabs $0x80067a,%rcx
+  801ca4:	00 00 00 
+  801ca7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ca9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801cae:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cb2:	5b                   	pop    %rbx
+  801cb3:	41 5c                	pop    %r12
+  801cb5:	5d                   	pop    %rbp
+  801cb6:	c3                   	ret
+            return 0;
+  801cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbc:	eb f0                	jmp    801cae <dev_lookup+0x60>
+
+0000000000801cbe <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cbe:	55                   	push   %rbp
+  801cbf:	48 89 e5             	mov    %rsp,%rbp
+  801cc2:	41 55                	push   %r13
+  801cc4:	41 54                	push   %r12
+  801cc6:	53                   	push   %rbx
+  801cc7:	48 83 ec 18          	sub    $0x18,%rsp
+  801ccb:	48 89 fb             	mov    %rdi,%rbx
+  801cce:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cd1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cd8:	ff ff ff 
+  801cdb:	48 01 df             	add    %rbx,%rdi
+  801cde:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ce2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce6:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	41 89 c5             	mov    %eax,%r13d
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 06                	js     801cff <fd_close+0x41>
+  801cf9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cfd:	74 1a                	je     801d19 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cff:	45 84 e4             	test   %r12b,%r12b
+  801d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d07:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d0b:	44 89 e8             	mov    %r13d,%eax
+  801d0e:	48 83 c4 18          	add    $0x18,%rsp
+  801d12:	5b                   	pop    %rbx
+  801d13:	41 5c                	pop    %r12
+  801d15:	41 5d                	pop    %r13
+  801d17:	5d                   	pop    %rbp
+  801d18:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d19:	8b 3b                	mov    (%rbx),%edi
+  801d1b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d1f:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	41 89 c5             	mov    %eax,%r13d
+  801d2e:	85 c0                	test   %eax,%eax
+  801d30:	78 1b                	js     801d4d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d36:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801d3a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d40:	48 85 c0             	test   %rax,%rax
+  801d43:	74 08                	je     801d4d <fd_close+0x8f>
+  801d45:	48 89 df             	mov    %rbx,%rdi
+  801d48:	ff d0                	call   *%rax
+  801d4a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d52:	48 89 de             	mov    %rbx,%rsi
+  801d55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5a:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+    return res;
+  801d66:	eb a3                	jmp    801d0b <fd_close+0x4d>
+
+0000000000801d68 <close>:
+
+int
+close(int fdnum) {
+  801d68:	55                   	push   %rbp
+  801d69:	48 89 e5             	mov    %rsp,%rbp
+  801d6c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d70:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d74:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  801d7b:	00 00 00 
+  801d7e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d80:	85 c0                	test   %eax,%eax
+  801d82:	78 15                	js     801d99 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d84:	be 01 00 00 00       	mov    $0x1,%esi
+  801d89:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d8d:	48 b8 be 1c 80 00 00 	movabs $0x801cbe,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+}
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+
+0000000000801d9b <close_all>:
+
+void
+close_all(void) {
+  801d9b:	55                   	push   %rbp
+  801d9c:	48 89 e5             	mov    %rsp,%rbp
+  801d9f:	41 54                	push   %r12
+  801da1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801da2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da7:	49 bc 68 1d 80 00 00 	movabs $0x801d68,%r12
+  801dae:	00 00 00 
+  801db1:	89 df                	mov    %ebx,%edi
+  801db3:	41 ff d4             	call   *%r12
+  801db6:	83 c3 01             	add    $0x1,%ebx
+  801db9:	83 fb 20             	cmp    $0x20,%ebx
+  801dbc:	75 f3                	jne    801db1 <close_all+0x16>
+}
+  801dbe:	5b                   	pop    %rbx
+  801dbf:	41 5c                	pop    %r12
+  801dc1:	5d                   	pop    %rbp
+  801dc2:	c3                   	ret
+
+0000000000801dc3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801dc3:	55                   	push   %rbp
+  801dc4:	48 89 e5             	mov    %rsp,%rbp
+  801dc7:	41 57                	push   %r15
+  801dc9:	41 56                	push   %r14
+  801dcb:	41 55                	push   %r13
+  801dcd:	41 54                	push   %r12
+  801dcf:	53                   	push   %rbx
+  801dd0:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dd7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ddb:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+  801de7:	89 c3                	mov    %eax,%ebx
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	0f 88 b8 00 00 00    	js     801ea9 <dup+0xe6>
+    close(newfdnum);
+  801df1:	44 89 e7             	mov    %r12d,%edi
+  801df4:	48 b8 68 1d 80 00 00 	movabs $0x801d68,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e00:	4d 63 ec             	movslq %r12d,%r13
+  801e03:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e0a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e0e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e12:	4c 89 ff             	mov    %r15,%rdi
+  801e15:	49 be 87 1b 80 00 00 	movabs $0x801b87,%r14
+  801e1c:	00 00 00 
+  801e1f:	41 ff d6             	call   *%r14
+  801e22:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e25:	4c 89 ef             	mov    %r13,%rdi
+  801e28:	41 ff d6             	call   *%r14
+  801e2b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e2e:	48 89 df             	mov    %rbx,%rdi
+  801e31:	48 b8 66 38 80 00 00 	movabs $0x803866,%rax
+  801e38:	00 00 00 
+  801e3b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e3d:	a8 04                	test   $0x4,%al
+  801e3f:	74 2b                	je     801e6c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e41:	41 89 c1             	mov    %eax,%r9d
+  801e44:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e4a:	4c 89 f1             	mov    %r14,%rcx
+  801e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e52:	48 89 de             	mov    %rbx,%rsi
+  801e55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e5a:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	85 c0                	test   %eax,%eax
+  801e6a:	78 4e                	js     801eba <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e6c:	4c 89 ff             	mov    %r15,%rdi
+  801e6f:	48 b8 66 38 80 00 00 	movabs $0x803866,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+  801e7b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e7e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e84:	4c 89 e9             	mov    %r13,%rcx
+  801e87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8c:	4c 89 fe             	mov    %r15,%rsi
+  801e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e94:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	89 c3                	mov    %eax,%ebx
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 14                	js     801eba <dup+0xf7>
+
+    return newfdnum;
+  801ea6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ea9:	89 d8                	mov    %ebx,%eax
+  801eab:	48 83 c4 18          	add    $0x18,%rsp
+  801eaf:	5b                   	pop    %rbx
+  801eb0:	41 5c                	pop    %r12
+  801eb2:	41 5d                	pop    %r13
+  801eb4:	41 5e                	pop    %r14
+  801eb6:	41 5f                	pop    %r15
+  801eb8:	5d                   	pop    %rbp
+  801eb9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ebf:	4c 89 ee             	mov    %r13,%rsi
+  801ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec7:	49 bc f7 16 80 00 00 	movabs $0x8016f7,%r12
+  801ece:	00 00 00 
+  801ed1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ed4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ed9:	4c 89 f6             	mov    %r14,%rsi
+  801edc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee1:	41 ff d4             	call   *%r12
+    return res;
+  801ee4:	eb c3                	jmp    801ea9 <dup+0xe6>
+
+0000000000801ee6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ee6:	55                   	push   %rbp
+  801ee7:	48 89 e5             	mov    %rsp,%rbp
+  801eea:	41 56                	push   %r14
+  801eec:	41 55                	push   %r13
+  801eee:	41 54                	push   %r12
+  801ef0:	53                   	push   %rbx
+  801ef1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ef5:	89 fb                	mov    %edi,%ebx
+  801ef7:	49 89 f4             	mov    %rsi,%r12
+  801efa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801efd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f01:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	78 4c                	js     801f5d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f11:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f15:	41 8b 3e             	mov    (%r14),%edi
+  801f18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f1c:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  801f23:	00 00 00 
+  801f26:	ff d0                	call   *%rax
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	78 35                	js     801f61 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f2c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f30:	83 e0 03             	and    $0x3,%eax
+  801f33:	83 f8 01             	cmp    $0x1,%eax
+  801f36:	74 2d                	je     801f65 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f3c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f40:	48 85 c0             	test   %rax,%rax
+  801f43:	74 56                	je     801f9b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f45:	4c 89 ea             	mov    %r13,%rdx
+  801f48:	4c 89 e6             	mov    %r12,%rsi
+  801f4b:	4c 89 f7             	mov    %r14,%rdi
+  801f4e:	ff d0                	call   *%rax
+}
+  801f50:	48 83 c4 10          	add    $0x10,%rsp
+  801f54:	5b                   	pop    %rbx
+  801f55:	41 5c                	pop    %r12
+  801f57:	41 5d                	pop    %r13
+  801f59:	41 5e                	pop    %r14
+  801f5b:	5d                   	pop    %rbp
+  801f5c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f5d:	48 98                	cltq
+  801f5f:	eb ef                	jmp    801f50 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f61:	48 98                	cltq
+  801f63:	eb eb                	jmp    801f50 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f65:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801f6c:	00 00 00 
+  801f6f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f75:	89 da                	mov    %ebx,%edx
+  801f77:	48 bf 59 44 80 00 00 	movabs $0x804459,%rdi
+  801f7e:	00 00 00 
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	48 b9 7a 06 80 00 00 	movabs $0x80067a,%rcx
+  801f8d:	00 00 00 
+  801f90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f99:	eb b5                	jmp    801f50 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f9b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fa2:	eb ac                	jmp    801f50 <read+0x6a>
+
+0000000000801fa4 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801fa4:	55                   	push   %rbp
+  801fa5:	48 89 e5             	mov    %rsp,%rbp
+  801fa8:	41 56                	push   %r14
+  801faa:	41 55                	push   %r13
+  801fac:	41 54                	push   %r12
+  801fae:	53                   	push   %rbx
+  801faf:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb3:	89 fb                	mov    %edi,%ebx
+  801fb5:	49 89 f4             	mov    %rsi,%r12
+  801fb8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fbb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fbf:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  801fc6:	00 00 00 
+  801fc9:	ff d0                	call   *%rax
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	78 41                	js     802010 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fcf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fd3:	41 8b 3e             	mov    (%r14),%edi
+  801fd6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fda:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 35                	js     80201f <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fea:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fee:	83 e0 03             	and    $0x3,%eax
+  801ff1:	83 f8 01             	cmp    $0x1,%eax
+  801ff4:	74 2d                	je     802023 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ff6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ffa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ffe:	48 85 c0             	test   %rax,%rax
+  802001:	74 56                	je     802059 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  802003:	4c 89 ea             	mov    %r13,%rdx
+  802006:	4c 89 e6             	mov    %r12,%rsi
+  802009:	4c 89 f7             	mov    %r14,%rdi
+  80200c:	ff d0                	call   *%rax
+  80200e:	eb 02                	jmp    802012 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802010:	48 98                	cltq
+}
+  802012:	48 83 c4 10          	add    $0x10,%rsp
+  802016:	5b                   	pop    %rbx
+  802017:	41 5c                	pop    %r12
+  802019:	41 5d                	pop    %r13
+  80201b:	41 5e                	pop    %r14
+  80201d:	5d                   	pop    %rbp
+  80201e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80201f:	48 98                	cltq
+  802021:	eb ef                	jmp    802012 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  802023:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  80202a:	00 00 00 
+  80202d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802033:	89 da                	mov    %ebx,%edx
+  802035:	48 bf 18 44 80 00 00 	movabs $0x804418,%rdi
+  80203c:	00 00 00 
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802044:	48 b9 7a 06 80 00 00 	movabs $0x80067a,%rcx
+  80204b:	00 00 00 
+  80204e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802050:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802057:	eb b9                	jmp    802012 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802059:	4c 89 ea             	mov    %r13,%rdx
+  80205c:	4c 89 e6             	mov    %r12,%rsi
+  80205f:	89 df                	mov    %ebx,%edi
+  802061:	48 b8 e6 1e 80 00 00 	movabs $0x801ee6,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+  80206d:	eb a3                	jmp    802012 <readmap+0x6e>
+
+000000000080206f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80206f:	55                   	push   %rbp
+  802070:	48 89 e5             	mov    %rsp,%rbp
+  802073:	41 57                	push   %r15
+  802075:	41 56                	push   %r14
+  802077:	41 55                	push   %r13
+  802079:	41 54                	push   %r12
+  80207b:	53                   	push   %rbx
+  80207c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802080:	48 85 d2             	test   %rdx,%rdx
+  802083:	74 54                	je     8020d9 <readn+0x6a>
+  802085:	41 89 fd             	mov    %edi,%r13d
+  802088:	49 89 f6             	mov    %rsi,%r14
+  80208b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80208e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802093:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802098:	49 bf e6 1e 80 00 00 	movabs $0x801ee6,%r15
+  80209f:	00 00 00 
+  8020a2:	4c 89 e2             	mov    %r12,%rdx
+  8020a5:	48 29 f2             	sub    %rsi,%rdx
+  8020a8:	4c 01 f6             	add    %r14,%rsi
+  8020ab:	44 89 ef             	mov    %r13d,%edi
+  8020ae:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 20                	js     8020d5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8020b5:	01 c3                	add    %eax,%ebx
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	74 08                	je     8020c3 <readn+0x54>
+  8020bb:	48 63 f3             	movslq %ebx,%rsi
+  8020be:	4c 39 e6             	cmp    %r12,%rsi
+  8020c1:	72 df                	jb     8020a2 <readn+0x33>
+    }
+    return res;
+  8020c3:	48 63 c3             	movslq %ebx,%rax
+}
+  8020c6:	48 83 c4 08          	add    $0x8,%rsp
+  8020ca:	5b                   	pop    %rbx
+  8020cb:	41 5c                	pop    %r12
+  8020cd:	41 5d                	pop    %r13
+  8020cf:	41 5e                	pop    %r14
+  8020d1:	41 5f                	pop    %r15
+  8020d3:	5d                   	pop    %rbp
+  8020d4:	c3                   	ret
+        if (inc < 0) return inc;
+  8020d5:	48 98                	cltq
+  8020d7:	eb ed                	jmp    8020c6 <readn+0x57>
+    int inc = 1, res = 0;
+  8020d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020de:	eb e3                	jmp    8020c3 <readn+0x54>
+
+00000000008020e0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020e0:	55                   	push   %rbp
+  8020e1:	48 89 e5             	mov    %rsp,%rbp
+  8020e4:	41 56                	push   %r14
+  8020e6:	41 55                	push   %r13
+  8020e8:	41 54                	push   %r12
+  8020ea:	53                   	push   %rbx
+  8020eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ef:	89 fb                	mov    %edi,%ebx
+  8020f1:	49 89 f4             	mov    %rsi,%r12
+  8020f4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020fb:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 47                	js     802152 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80210b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80210f:	41 8b 3e             	mov    (%r14),%edi
+  802112:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802116:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+  802122:	85 c0                	test   %eax,%eax
+  802124:	78 30                	js     802156 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802126:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80212b:	74 2d                	je     80215a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80212d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802131:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802135:	48 85 c0             	test   %rax,%rax
+  802138:	74 56                	je     802190 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80213a:	4c 89 ea             	mov    %r13,%rdx
+  80213d:	4c 89 e6             	mov    %r12,%rsi
+  802140:	4c 89 f7             	mov    %r14,%rdi
+  802143:	ff d0                	call   *%rax
+}
+  802145:	48 83 c4 10          	add    $0x10,%rsp
+  802149:	5b                   	pop    %rbx
+  80214a:	41 5c                	pop    %r12
+  80214c:	41 5d                	pop    %r13
+  80214e:	41 5e                	pop    %r14
+  802150:	5d                   	pop    %rbp
+  802151:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802152:	48 98                	cltq
+  802154:	eb ef                	jmp    802145 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802156:	48 98                	cltq
+  802158:	eb eb                	jmp    802145 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80215a:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  802161:	00 00 00 
+  802164:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80216a:	89 da                	mov    %ebx,%edx
+  80216c:	48 bf 75 44 80 00 00 	movabs $0x804475,%rdi
+  802173:	00 00 00 
+  802176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217b:	48 b9 7a 06 80 00 00 	movabs $0x80067a,%rcx
+  802182:	00 00 00 
+  802185:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802187:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80218e:	eb b5                	jmp    802145 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802190:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802197:	eb ac                	jmp    802145 <write+0x65>
+
+0000000000802199 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802199:	55                   	push   %rbp
+  80219a:	48 89 e5             	mov    %rsp,%rbp
+  80219d:	53                   	push   %rbx
+  80219e:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021a8:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  8021af:	00 00 00 
+  8021b2:	ff d0                	call   *%rax
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	78 0c                	js     8021c4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8021b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021bc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021c8:	c9                   	leave
+  8021c9:	c3                   	ret
+
+00000000008021ca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021ca:	55                   	push   %rbp
+  8021cb:	48 89 e5             	mov    %rsp,%rbp
+  8021ce:	41 55                	push   %r13
+  8021d0:	41 54                	push   %r12
+  8021d2:	53                   	push   %rbx
+  8021d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8021d7:	89 fb                	mov    %edi,%ebx
+  8021d9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021e0:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 38                	js     802228 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021f0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021f4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021f8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021fc:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  802203:	00 00 00 
+  802206:	ff d0                	call   *%rax
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 1c                	js     802228 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80220c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802211:	74 20                	je     802233 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802213:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802217:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80221b:	48 85 c0             	test   %rax,%rax
+  80221e:	74 47                	je     802267 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802220:	44 89 e6             	mov    %r12d,%esi
+  802223:	4c 89 ef             	mov    %r13,%rdi
+  802226:	ff d0                	call   *%rax
+}
+  802228:	48 83 c4 18          	add    $0x18,%rsp
+  80222c:	5b                   	pop    %rbx
+  80222d:	41 5c                	pop    %r12
+  80222f:	41 5d                	pop    %r13
+  802231:	5d                   	pop    %rbp
+  802232:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802233:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  80223a:	00 00 00 
+  80223d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802243:	89 da                	mov    %ebx,%edx
+  802245:	48 bf 38 44 80 00 00 	movabs $0x804438,%rdi
+  80224c:	00 00 00 
+  80224f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802254:	48 b9 7a 06 80 00 00 	movabs $0x80067a,%rcx
+  80225b:	00 00 00 
+  80225e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802260:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802265:	eb c1                	jmp    802228 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802267:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80226c:	eb ba                	jmp    802228 <ftruncate+0x5e>
+
+000000000080226e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	41 54                	push   %r12
+  802274:	53                   	push   %rbx
+  802275:	48 83 ec 10          	sub    $0x10,%rsp
+  802279:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80227c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802280:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  802287:	00 00 00 
+  80228a:	ff d0                	call   *%rax
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	78 4e                	js     8022de <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802290:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802294:	41 8b 3c 24          	mov    (%r12),%edi
+  802298:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80229c:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	78 32                	js     8022de <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022b0:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8022b5:	74 30                	je     8022e7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8022b7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022ba:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022c1:	00 00 00 
+    stat->st_isdir = 0;
+  8022c4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022cb:	00 00 00 
+    stat->st_dev = dev;
+  8022ce:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022d5:	48 89 de             	mov    %rbx,%rsi
+  8022d8:	4c 89 e7             	mov    %r12,%rdi
+  8022db:	ff 50 30             	call   *0x30(%rax)
+}
+  8022de:	48 83 c4 10          	add    $0x10,%rsp
+  8022e2:	5b                   	pop    %rbx
+  8022e3:	41 5c                	pop    %r12
+  8022e5:	5d                   	pop    %rbp
+  8022e6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022e7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022ec:	eb f0                	jmp    8022de <fstat+0x70>
+
+00000000008022ee <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022ee:	55                   	push   %rbp
+  8022ef:	48 89 e5             	mov    %rsp,%rbp
+  8022f2:	41 54                	push   %r12
+  8022f4:	53                   	push   %rbx
+  8022f5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fd:	48 b8 45 30 80 00 00 	movabs $0x803045,%rax
+  802304:	00 00 00 
+  802307:	ff d0                	call   *%rax
+  802309:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 25                	js     802334 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80230f:	4c 89 e6             	mov    %r12,%rsi
+  802312:	89 c7                	mov    %eax,%edi
+  802314:	48 b8 6e 22 80 00 00 	movabs $0x80226e,%rax
+  80231b:	00 00 00 
+  80231e:	ff d0                	call   *%rax
+  802320:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802323:	89 df                	mov    %ebx,%edi
+  802325:	48 b8 68 1d 80 00 00 	movabs $0x801d68,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+
+    return res;
+  802331:	44 89 e3             	mov    %r12d,%ebx
+}
+  802334:	89 d8                	mov    %ebx,%eax
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	5d                   	pop    %rbp
+  80233a:	c3                   	ret
+
+000000000080233b <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  80233f:	41 54                	push   %r12
+  802341:	53                   	push   %rbx
+  802342:	48 83 ec 10          	sub    $0x10,%rsp
+  802346:	48 89 fb             	mov    %rdi,%rbx
+  802349:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80234c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802350:	bf 66 00 00 00       	mov    $0x66,%edi
+  802355:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 1f                	js     802384 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802365:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802369:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80236d:	48 85 c0             	test   %rax,%rax
+  802370:	74 1b                	je     80238d <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802372:	4c 89 e6             	mov    %r12,%rsi
+  802375:	48 89 df             	mov    %rbx,%rdi
+  802378:	ff d0                	call   *%rax
+    if (res < 0) {
+  80237a:	85 c0                	test   %eax,%eax
+  80237c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802381:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802384:	48 83 c4 10          	add    $0x10,%rsp
+  802388:	5b                   	pop    %rbx
+  802389:	41 5c                	pop    %r12
+  80238b:	5d                   	pop    %rbp
+  80238c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80238d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802392:	eb f0                	jmp    802384 <create_snapshot+0x49>
+
+0000000000802394 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80239c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023a0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023a5:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	78 1e                	js     8023d3 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8023b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023b9:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8023bd:	48 85 d2             	test   %rdx,%rdx
+  8023c0:	74 13                	je     8023d5 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8023c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c7:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d0:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023da:	eb f7                	jmp    8023d3 <print_snapshot_list+0x3f>
+
+00000000008023dc <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	53                   	push   %rbx
+  8023e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e5:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023e8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ec:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023f1:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  8023f8:	00 00 00 
+  8023fb:	ff d0                	call   *%rax
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	78 1c                	js     80241d <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802405:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802409:	48 85 c0             	test   %rax,%rax
+  80240c:	74 15                	je     802423 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  80240e:	48 89 df             	mov    %rbx,%rdi
+  802411:	ff d0                	call   *%rax
+    if (res < 0) {
+  802413:	85 c0                	test   %eax,%eax
+  802415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80241d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+        return -E_NOT_SUPP;
+  802423:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802428:	eb f3                	jmp    80241d <accept_snapshot+0x41>
+
+000000000080242a <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  80242a:	55                   	push   %rbp
+  80242b:	48 89 e5             	mov    %rsp,%rbp
+  80242e:	53                   	push   %rbx
+  80242f:	48 83 ec 18          	sub    $0x18,%rsp
+  802433:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802436:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80243a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80243f:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+  80244b:	85 c0                	test   %eax,%eax
+  80244d:	78 1c                	js     80246b <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80244f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802453:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802457:	48 85 c0             	test   %rax,%rax
+  80245a:	74 15                	je     802471 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80245c:	48 89 df             	mov    %rbx,%rdi
+  80245f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802461:	85 c0                	test   %eax,%eax
+  802463:	ba 00 00 00 00       	mov    $0x0,%edx
+  802468:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80246b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80246f:	c9                   	leave
+  802470:	c3                   	ret
+        return -E_NOT_SUPP;
+  802471:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802476:	eb f3                	jmp    80246b <delete_snapshot+0x41>
+
+0000000000802478 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802480:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802484:	bf 66 00 00 00       	mov    $0x66,%edi
+  802489:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  802490:	00 00 00 
+  802493:	ff d0                	call   *%rax
+  802495:	85 c0                	test   %eax,%eax
+  802497:	78 14                	js     8024ad <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249d:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8024a1:	48 85 d2             	test   %rdx,%rdx
+  8024a4:	74 09                	je     8024af <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8024a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ab:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b4:	eb f7                	jmp    8024ad <gc_snapshots+0x35>
+
+00000000008024b6 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8024b6:	55                   	push   %rbp
+  8024b7:	48 89 e5             	mov    %rsp,%rbp
+  8024ba:	41 56                	push   %r14
+  8024bc:	41 55                	push   %r13
+  8024be:	41 54                	push   %r12
+  8024c0:	53                   	push   %rbx
+  8024c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c5:	48 89 fb             	mov    %rdi,%rbx
+  8024c8:	49 89 f4             	mov    %rsi,%r12
+  8024cb:	49 89 d5             	mov    %rdx,%r13
+  8024ce:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024d1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024d5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024da:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 1b                	js     802505 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8024ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024ee:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8024f2:	48 85 c0             	test   %rax,%rax
+  8024f5:	74 1b                	je     802512 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8024f7:	4c 89 f1             	mov    %r14,%rcx
+  8024fa:	4c 89 ea             	mov    %r13,%rdx
+  8024fd:	4c 89 e6             	mov    %r12,%rsi
+  802500:	48 89 df             	mov    %rbx,%rdi
+  802503:	ff d0                	call   *%rax
+
+    return res;
+}
+  802505:	48 83 c4 10          	add    $0x10,%rsp
+  802509:	5b                   	pop    %rbx
+  80250a:	41 5c                	pop    %r12
+  80250c:	41 5d                	pop    %r13
+  80250e:	41 5e                	pop    %r14
+  802510:	5d                   	pop    %rbp
+  802511:	c3                   	ret
+        return -E_NOT_SUPP;
+  802512:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802517:	eb ec                	jmp    802505 <diff_snapshots+0x4f>
+
+0000000000802519 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	41 55                	push   %r13
+  80251f:	41 54                	push   %r12
+  802521:	53                   	push   %rbx
+  802522:	48 83 ec 18          	sub    $0x18,%rsp
+  802526:	48 89 fb             	mov    %rdi,%rbx
+  802529:	49 89 f4             	mov    %rsi,%r12
+  80252c:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80252f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802533:	bf 66 00 00 00       	mov    $0x66,%edi
+  802538:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 18                	js     802560 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802548:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80254c:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802550:	48 85 c0             	test   %rax,%rax
+  802553:	74 16                	je     80256b <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802555:	4c 89 ea             	mov    %r13,%rdx
+  802558:	4c 89 e6             	mov    %r12,%rsi
+  80255b:	48 89 df             	mov    %rbx,%rdi
+  80255e:	ff d0                	call   *%rax
+
+    return res;
+}
+  802560:	48 83 c4 18          	add    $0x18,%rsp
+  802564:	5b                   	pop    %rbx
+  802565:	41 5c                	pop    %r12
+  802567:	41 5d                	pop    %r13
+  802569:	5d                   	pop    %rbp
+  80256a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80256b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802570:	eb ee                	jmp    802560 <send_snapshot+0x47>
+
+0000000000802572 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	53                   	push   %rbx
+  802577:	48 83 ec 18          	sub    $0x18,%rsp
+  80257b:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80257e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802582:	bf 66 00 00 00       	mov    $0x66,%edi
+  802587:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+  802593:	85 c0                	test   %eax,%eax
+  802595:	78 12                	js     8025a9 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80259b:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80259f:	48 85 c0             	test   %rax,%rax
+  8025a2:	74 0b                	je     8025af <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8025a4:	48 89 df             	mov    %rbx,%rdi
+  8025a7:	ff d0                	call   *%rax
+
+    return res;
+}
+  8025a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ad:	c9                   	leave
+  8025ae:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025b4:	eb f3                	jmp    8025a9 <receive_snapshot+0x37>
+
+00000000008025b6 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8025b6:	55                   	push   %rbp
+  8025b7:	48 89 e5             	mov    %rsp,%rbp
+  8025ba:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025be:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025c2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025c7:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+  8025d3:	85 c0                	test   %eax,%eax
+  8025d5:	78 17                	js     8025ee <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8025d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025db:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8025e2:	48 85 d2             	test   %rdx,%rdx
+  8025e5:	74 09                	je     8025f0 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8025e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ec:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025f5:	eb f7                	jmp    8025ee <free_space_bytes+0x38>
+
+00000000008025f7 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802603:	bf 66 00 00 00       	mov    $0x66,%edi
+  802608:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 17                	js     80262f <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261c:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802623:	48 85 d2             	test   %rdx,%rdx
+  802626:	74 09                	je     802631 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80262f:	c9                   	leave
+  802630:	c3                   	ret
+        return -E_NOT_SUPP;
+  802631:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802636:	eb f7                	jmp    80262f <busy_space_bytes+0x38>
+
+0000000000802638 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802638:	55                   	push   %rbp
+  802639:	48 89 e5             	mov    %rsp,%rbp
+  80263c:	41 54                	push   %r12
+  80263e:	53                   	push   %rbx
+  80263f:	48 83 ec 10          	sub    $0x10,%rsp
+  802643:	89 fb                	mov    %edi,%ebx
+  802645:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802648:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80264c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802651:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	78 17                	js     802678 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802661:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802665:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80266c:	48 85 c0             	test   %rax,%rax
+  80266f:	74 10                	je     802681 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802671:	4c 89 e6             	mov    %r12,%rsi
+  802674:	89 df                	mov    %ebx,%edi
+  802676:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802678:	48 83 c4 10          	add    $0x10,%rsp
+  80267c:	5b                   	pop    %rbx
+  80267d:	41 5c                	pop    %r12
+  80267f:	5d                   	pop    %rbp
+  802680:	c3                   	ret
+        return -E_NOT_SUPP;
+  802681:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802686:	eb f0                	jmp    802678 <snapshots_space+0x40>
+
+0000000000802688 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802688:	55                   	push   %rbp
+  802689:	48 89 e5             	mov    %rsp,%rbp
+  80268c:	41 55                	push   %r13
+  80268e:	41 54                	push   %r12
+  802690:	53                   	push   %rbx
+  802691:	48 83 ec 08          	sub    $0x8,%rsp
+  802695:	41 89 fd             	mov    %edi,%r13d
+  802698:	48 89 f3             	mov    %rsi,%rbx
+  80269b:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80269e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8026a5:	00 00 00 
+  8026a8:	83 38 00             	cmpl   $0x0,(%rax)
+  8026ab:	74 57                	je     802704 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8026ad:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026b3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026b8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8026bf:	00 00 00 
+  8026c2:	44 89 ee             	mov    %r13d,%esi
+  8026c5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8026cc:	00 00 00 
+  8026cf:	8b 38                	mov    (%rax),%edi
+  8026d1:	48 b8 a9 3c 80 00 00 	movabs $0x803ca9,%rax
+  8026d8:	00 00 00 
+  8026db:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8026dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026e2:	4c 89 e2             	mov    %r12,%rdx
+  8026e5:	48 89 de             	mov    %rbx,%rsi
+  8026e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ed:	48 b8 91 3c 80 00 00 	movabs $0x803c91,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+}
+  8026f9:	48 83 c4 08          	add    $0x8,%rsp
+  8026fd:	5b                   	pop    %rbx
+  8026fe:	41 5c                	pop    %r12
+  802700:	41 5d                	pop    %r13
+  802702:	5d                   	pop    %rbp
+  802703:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802704:	bf 03 00 00 00       	mov    $0x3,%edi
+  802709:	48 b8 67 3d 80 00 00 	movabs $0x803d67,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80271c:	00 00 
+  80271e:	eb 8d                	jmp    8026ad <fsipc_region+0x25>
+
+0000000000802720 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802728:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80272f:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802730:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802734:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  80273b:	00 00 00 
+  80273e:	ff d0                	call   *%rax
+}
+  802740:	c9                   	leave
+  802741:	c3                   	ret
+
+0000000000802742 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802742:	85 ff                	test   %edi,%edi
+  802744:	78 6d                	js     8027b3 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 54                	push   %r12
+  80274c:	53                   	push   %rbx
+  80274d:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802750:	48 85 f6             	test   %rsi,%rsi
+  802753:	74 57                	je     8027ac <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802755:	89 f8                	mov    %edi,%eax
+  802757:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80275e:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802760:	be 00 00 00 00       	mov    $0x0,%esi
+  802765:	bf 12 00 00 00       	mov    $0x12,%edi
+  80276a:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802776:	85 c0                	test   %eax,%eax
+  802778:	78 2d                	js     8027a7 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80277a:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802781:	00 00 00 
+  802784:	49 63 14 24          	movslq (%r12),%rdx
+  802788:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80278f:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802794:	48 89 df             	mov    %rbx,%rdi
+  802797:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8027a3:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8027a7:	5b                   	pop    %rbx
+  8027a8:	41 5c                	pop    %r12
+  8027aa:	5d                   	pop    %rbp
+  8027ab:	c3                   	ret
+        return -E_INVAL;
+  8027ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027b1:	eb f4                	jmp    8027a7 <devfile_df_snapshots+0x65>
+  8027b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027b8:	c3                   	ret
+
+00000000008027b9 <devfile_df_busy>:
+devfile_df_busy() {
+  8027b9:	55                   	push   %rbp
+  8027ba:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8027bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c2:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027c7:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+}
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+
+00000000008027d5 <devfile_df_free>:
+devfile_df_free() {
+  8027d5:	55                   	push   %rbp
+  8027d6:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8027d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027de:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027e3:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+}
+  8027ef:	5d                   	pop    %rbp
+  8027f0:	c3                   	ret
+
+00000000008027f1 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8027f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fa:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027ff:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802806:	00 00 00 
+  802809:	ff d0                	call   *%rax
+}
+  80280b:	5d                   	pop    %rbp
+  80280c:	c3                   	ret
+
+000000000080280d <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80280d:	55                   	push   %rbp
+  80280e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802811:	be 00 00 00 00       	mov    $0x0,%esi
+  802816:	bf 09 00 00 00       	mov    $0x9,%edi
+  80281b:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802822:	00 00 00 
+  802825:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802827:	85 c0                	test   %eax,%eax
+  802829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802831:	5d                   	pop    %rbp
+  802832:	c3                   	ret
+
+0000000000802833 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802833:	55                   	push   %rbp
+  802834:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802837:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80283e:	00 00 00 
+  802841:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802844:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802846:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802849:	be 00 00 00 00       	mov    $0x0,%esi
+  80284e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802853:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+}
+  80285f:	5d                   	pop    %rbp
+  802860:	c3                   	ret
+
+0000000000802861 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802861:	55                   	push   %rbp
+  802862:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802865:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802868:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80286f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802871:	be 00 00 00 00       	mov    $0x0,%esi
+  802876:	bf 06 00 00 00       	mov    $0x6,%edi
+  80287b:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+}
+  802887:	5d                   	pop    %rbp
+  802888:	c3                   	ret
+
+0000000000802889 <devfile_write>:
+    if (!fd || !buf) {
+  802889:	48 85 ff             	test   %rdi,%rdi
+  80288c:	0f 84 c1 00 00 00    	je     802953 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802892:	55                   	push   %rbp
+  802893:	48 89 e5             	mov    %rsp,%rbp
+  802896:	41 57                	push   %r15
+  802898:	41 56                	push   %r14
+  80289a:	41 55                	push   %r13
+  80289c:	41 54                	push   %r12
+  80289e:	53                   	push   %rbx
+  80289f:	48 83 ec 18          	sub    $0x18,%rsp
+  8028a3:	49 89 ff             	mov    %rdi,%r15
+  8028a6:	49 89 f5             	mov    %rsi,%r13
+  8028a9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8028ac:	48 85 f6             	test   %rsi,%rsi
+  8028af:	0f 84 95 00 00 00    	je     80294a <devfile_write+0xc1>
+    while (n) {
+  8028b5:	48 85 d2             	test   %rdx,%rdx
+  8028b8:	0f 84 83 00 00 00    	je     802941 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8028be:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028c5:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8028cc:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8028cf:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8028d4:	49 39 dc             	cmp    %rbx,%r12
+  8028d7:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8028db:	48 89 da             	mov    %rbx,%rdx
+  8028de:	4c 89 ee             	mov    %r13,%rsi
+  8028e1:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8028e8:	00 00 00 
+  8028eb:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  8028f2:	00 00 00 
+  8028f5:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028f7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028fb:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8028fe:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802902:	be 00 00 00 00       	mov    $0x0,%esi
+  802907:	bf 04 00 00 00       	mov    $0x4,%edi
+  80290c:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+        if (write < 0) {
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	78 21                	js     80293d <devfile_write+0xb4>
+        buf += write;
+  80291c:	48 63 d0             	movslq %eax,%rdx
+  80291f:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802922:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802925:	49 29 d4             	sub    %rdx,%r12
+  802928:	75 a5                	jne    8028cf <devfile_write+0x46>
+    return totalWrite;
+  80292a:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80292e:	48 83 c4 18          	add    $0x18,%rsp
+  802932:	5b                   	pop    %rbx
+  802933:	41 5c                	pop    %r12
+  802935:	41 5d                	pop    %r13
+  802937:	41 5e                	pop    %r14
+  802939:	41 5f                	pop    %r15
+  80293b:	5d                   	pop    %rbp
+  80293c:	c3                   	ret
+            return write;
+  80293d:	48 98                	cltq
+  80293f:	eb ed                	jmp    80292e <devfile_write+0xa5>
+    int totalWrite = 0;
+  802941:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802948:	eb e0                	jmp    80292a <devfile_write+0xa1>
+        return -E_INVAL;
+  80294a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802951:	eb db                	jmp    80292e <devfile_write+0xa5>
+  802953:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80295a:	c3                   	ret
+
+000000000080295b <devfile_read>:
+    if (!fd || !buf) {
+  80295b:	48 85 ff             	test   %rdi,%rdi
+  80295e:	0f 84 c0 00 00 00    	je     802a24 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802964:	55                   	push   %rbp
+  802965:	48 89 e5             	mov    %rsp,%rbp
+  802968:	41 57                	push   %r15
+  80296a:	41 56                	push   %r14
+  80296c:	41 55                	push   %r13
+  80296e:	41 54                	push   %r12
+  802970:	53                   	push   %rbx
+  802971:	48 83 ec 18          	sub    $0x18,%rsp
+  802975:	49 89 ff             	mov    %rdi,%r15
+  802978:	49 89 f5             	mov    %rsi,%r13
+  80297b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80297e:	48 85 f6             	test   %rsi,%rsi
+  802981:	0f 84 96 00 00 00    	je     802a1d <devfile_read+0xc2>
+    while (n) {
+  802987:	48 85 d2             	test   %rdx,%rdx
+  80298a:	0f 84 87 00 00 00    	je     802a17 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802990:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802997:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802998:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80299f:	00 00 00 
+  8029a2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029a6:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8029a9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029ae:	49 39 c4             	cmp    %rax,%r12
+  8029b1:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8029b5:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8029b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029be:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029c3:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8029cf:	85 c0                	test   %eax,%eax
+  8029d1:	7e 37                	jle    802a0a <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8029d3:	48 63 d8             	movslq %eax,%rbx
+  8029d6:	48 89 da             	mov    %rbx,%rdx
+  8029d9:	4c 89 f6             	mov    %r14,%rsi
+  8029dc:	4c 89 ef             	mov    %r13,%rdi
+  8029df:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  8029e6:	00 00 00 
+  8029e9:	ff d0                	call   *%rax
+        buf += read;
+  8029eb:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8029ee:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8029f2:	49 29 dc             	sub    %rbx,%r12
+  8029f5:	75 ab                	jne    8029a2 <devfile_read+0x47>
+  return totalRead;
+  8029f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8029fb:	48 83 c4 18          	add    $0x18,%rsp
+  8029ff:	5b                   	pop    %rbx
+  802a00:	41 5c                	pop    %r12
+  802a02:	41 5d                	pop    %r13
+  802a04:	41 5e                	pop    %r14
+  802a06:	41 5f                	pop    %r15
+  802a08:	5d                   	pop    %rbp
+  802a09:	c3                   	ret
+            return read ? read : totalRead;
+  802a0a:	48 63 d0             	movslq %eax,%rdx
+  802a0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a11:	48 0f 45 c2          	cmovne %rdx,%rax
+  802a15:	eb e4                	jmp    8029fb <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802a17:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802a1b:	eb da                	jmp    8029f7 <devfile_read+0x9c>
+        return E_INVAL;
+  802a1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a22:	eb d7                	jmp    8029fb <devfile_read+0xa0>
+  802a24:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a29:	c3                   	ret
+
+0000000000802a2a <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802a2a:	48 85 ff             	test   %rdi,%rdi
+  802a2d:	74 5f                	je     802a8e <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802a2f:	55                   	push   %rbp
+  802a30:	48 89 e5             	mov    %rsp,%rbp
+  802a33:	53                   	push   %rbx
+  802a34:	48 83 ec 08          	sub    $0x8,%rsp
+  802a38:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802a3b:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802a42:	00 00 00 
+  802a45:	ff d0                	call   *%rax
+  802a47:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a4d:	77 45                	ja     802a94 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802a4f:	48 89 de             	mov    %rbx,%rsi
+  802a52:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a59:	00 00 00 
+  802a5c:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  802a63:	00 00 00 
+  802a66:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802a68:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a72:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a85:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8c:	c9                   	leave
+  802a8d:	c3                   	ret
+        return -E_INVAL;
+  802a8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a93:	c3                   	ret
+        return -E_INVAL;
+  802a94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a99:	eb ed                	jmp    802a88 <devfile_receive_snapshot+0x5e>
+
+0000000000802a9b <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802a9b:	55                   	push   %rbp
+  802a9c:	48 89 e5             	mov    %rsp,%rbp
+  802a9f:	41 55                	push   %r13
+  802aa1:	41 54                	push   %r12
+  802aa3:	53                   	push   %rbx
+  802aa4:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa8:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802aab:	48 85 f6             	test   %rsi,%rsi
+  802aae:	0f 94 c0             	sete   %al
+  802ab1:	48 85 d2             	test   %rdx,%rdx
+  802ab4:	0f 94 c2             	sete   %dl
+  802ab7:	08 d0                	or     %dl,%al
+  802ab9:	0f 85 ad 00 00 00    	jne    802b6c <devfile_send_snapshot+0xd1>
+  802abf:	48 89 fb             	mov    %rdi,%rbx
+  802ac2:	49 89 f4             	mov    %rsi,%r12
+  802ac5:	48 85 ff             	test   %rdi,%rdi
+  802ac8:	0f 84 9e 00 00 00    	je     802b6c <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802ace:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802ad5:	00 00 00 
+  802ad8:	ff d0                	call   *%rax
+  802ada:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ae0:	0f 87 8d 00 00 00    	ja     802b73 <devfile_send_snapshot+0xd8>
+  802ae6:	4c 89 e7             	mov    %r12,%rdi
+  802ae9:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+  802af5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802afb:	77 7d                	ja     802b7a <devfile_send_snapshot+0xdf>
+  802afd:	4c 89 ef             	mov    %r13,%rdi
+  802b00:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802b07:	00 00 00 
+  802b0a:	ff d0                	call   *%rax
+  802b0c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b12:	77 6d                	ja     802b81 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802b14:	48 89 de             	mov    %rbx,%rsi
+  802b17:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b1e:	00 00 00 
+  802b21:	48 bb 9f 0f 80 00 00 	movabs $0x800f9f,%rbx
+  802b28:	00 00 00 
+  802b2b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802b2d:	4c 89 e6             	mov    %r12,%rsi
+  802b30:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802b37:	00 00 00 
+  802b3a:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802b3c:	4c 89 ee             	mov    %r13,%rsi
+  802b3f:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802b46:	00 00 00 
+  802b49:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802b4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b50:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802b55:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+}
+  802b61:	48 83 c4 08          	add    $0x8,%rsp
+  802b65:	5b                   	pop    %rbx
+  802b66:	41 5c                	pop    %r12
+  802b68:	41 5d                	pop    %r13
+  802b6a:	5d                   	pop    %rbp
+  802b6b:	c3                   	ret
+        return -E_INVAL;
+  802b6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b71:	eb ee                	jmp    802b61 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b78:	eb e7                	jmp    802b61 <devfile_send_snapshot+0xc6>
+  802b7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b7f:	eb e0                	jmp    802b61 <devfile_send_snapshot+0xc6>
+  802b81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b86:	eb d9                	jmp    802b61 <devfile_send_snapshot+0xc6>
+
+0000000000802b88 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802b88:	48 85 ff             	test   %rdi,%rdi
+  802b8b:	0f 84 41 01 00 00    	je     802cd2 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802b91:	55                   	push   %rbp
+  802b92:	48 89 e5             	mov    %rsp,%rbp
+  802b95:	41 57                	push   %r15
+  802b97:	41 56                	push   %r14
+  802b99:	41 55                	push   %r13
+  802b9b:	41 54                	push   %r12
+  802b9d:	53                   	push   %rbx
+  802b9e:	48 83 ec 08          	sub    $0x8,%rsp
+  802ba2:	49 89 fc             	mov    %rdi,%r12
+  802ba5:	49 89 f5             	mov    %rsi,%r13
+  802ba8:	48 89 d3             	mov    %rdx,%rbx
+  802bab:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802bae:	48 85 f6             	test   %rsi,%rsi
+  802bb1:	0f 84 ff 00 00 00    	je     802cb6 <devfile_diff_snapshots+0x12e>
+  802bb7:	48 85 d2             	test   %rdx,%rdx
+  802bba:	0f 84 fd 00 00 00    	je     802cbd <devfile_diff_snapshots+0x135>
+  802bc0:	48 85 c9             	test   %rcx,%rcx
+  802bc3:	0f 84 f4 00 00 00    	je     802cbd <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802bc9:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+  802bd5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802bdb:	0f 87 e3 00 00 00    	ja     802cc4 <devfile_diff_snapshots+0x13c>
+  802be1:	4c 89 ef             	mov    %r13,%rdi
+  802be4:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802beb:	00 00 00 
+  802bee:	ff d0                	call   *%rax
+  802bf0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802bf6:	0f 87 cf 00 00 00    	ja     802ccb <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802bfc:	4c 89 e6             	mov    %r12,%rsi
+  802bff:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c06:	00 00 00 
+  802c09:	4c 89 e7             	mov    %r12,%rdi
+  802c0c:	49 bf 9f 0f 80 00 00 	movabs $0x800f9f,%r15
+  802c13:	00 00 00 
+  802c16:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802c19:	4c 89 ee             	mov    %r13,%rsi
+  802c1c:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802c23:	00 
+  802c24:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802c27:	48 8b 03             	mov    (%rbx),%rax
+  802c2a:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802c31:	00 
+  802c32:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802c36:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802c3d:	00 
+  802c3e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c42:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802c49:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802c54:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	78 43                	js     802ca7 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802c64:	49 8b 04 24          	mov    (%r12),%rax
+  802c68:	48 89 03             	mov    %rax,(%rbx)
+  802c6b:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802c70:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802c74:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802c79:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802c7d:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802c82:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802c86:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802c8a:	48 c1 e2 03          	shl    $0x3,%rdx
+  802c8e:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802c93:	4c 89 f7             	mov    %r14,%rdi
+  802c96:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802ca2:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802ca7:	48 83 c4 08          	add    $0x8,%rsp
+  802cab:	5b                   	pop    %rbx
+  802cac:	41 5c                	pop    %r12
+  802cae:	41 5d                	pop    %r13
+  802cb0:	41 5e                	pop    %r14
+  802cb2:	41 5f                	pop    %r15
+  802cb4:	5d                   	pop    %rbp
+  802cb5:	c3                   	ret
+        return -E_INVAL;
+  802cb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cbb:	eb ea                	jmp    802ca7 <devfile_diff_snapshots+0x11f>
+  802cbd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cc2:	eb e3                	jmp    802ca7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802cc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cc9:	eb dc                	jmp    802ca7 <devfile_diff_snapshots+0x11f>
+  802ccb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cd0:	eb d5                	jmp    802ca7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802cd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cd7:	c3                   	ret
+
+0000000000802cd8 <devfile_delete_snapshot>:
+    if (!name) {
+  802cd8:	48 85 ff             	test   %rdi,%rdi
+  802cdb:	74 5f                	je     802d3c <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802cdd:	55                   	push   %rbp
+  802cde:	48 89 e5             	mov    %rsp,%rbp
+  802ce1:	53                   	push   %rbx
+  802ce2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802ce9:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802cf0:	00 00 00 
+  802cf3:	ff d0                	call   *%rax
+  802cf5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cfb:	77 45                	ja     802d42 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802cfd:	48 89 de             	mov    %rbx,%rsi
+  802d00:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802d07:	00 00 00 
+  802d0a:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802d16:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802d20:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802d27:	00 00 00 
+  802d2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d2c:	85 c0                	test   %eax,%eax
+  802d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d33:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3a:	c9                   	leave
+  802d3b:	c3                   	ret
+        return -E_INVAL;
+  802d3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d41:	c3                   	ret
+        return -E_INVAL;
+  802d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d47:	eb ed                	jmp    802d36 <devfile_delete_snapshot+0x5e>
+
+0000000000802d49 <devfile_accept_snapshot>:
+    if (!name) {
+  802d49:	48 85 ff             	test   %rdi,%rdi
+  802d4c:	74 5f                	je     802dad <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	53                   	push   %rbx
+  802d53:	48 83 ec 08          	sub    $0x8,%rsp
+  802d57:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802d5a:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802d61:	00 00 00 
+  802d64:	ff d0                	call   *%rax
+  802d66:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d6c:	77 45                	ja     802db3 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802d6e:	48 89 de             	mov    %rbx,%rsi
+  802d71:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802d78:	00 00 00 
+  802d7b:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  802d82:	00 00 00 
+  802d85:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802d87:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d91:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802d98:	00 00 00 
+  802d9b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d9d:	85 c0                	test   %eax,%eax
+  802d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802da7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dab:	c9                   	leave
+  802dac:	c3                   	ret
+        return -E_INVAL;
+  802dad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802db2:	c3                   	ret
+        return -E_INVAL;
+  802db3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802db8:	eb ed                	jmp    802da7 <devfile_accept_snapshot+0x5e>
+
+0000000000802dba <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802dba:	48 85 ff             	test   %rdi,%rdi
+  802dbd:	0f 84 9f 00 00 00    	je     802e62 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802dc3:	55                   	push   %rbp
+  802dc4:	48 89 e5             	mov    %rsp,%rbp
+  802dc7:	41 54                	push   %r12
+  802dc9:	53                   	push   %rbx
+  802dca:	48 89 fb             	mov    %rdi,%rbx
+  802dcd:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802dd0:	48 85 f6             	test   %rsi,%rsi
+  802dd3:	74 78                	je     802e4d <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802dd5:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802ddc:	00 00 00 
+  802ddf:	ff d0                	call   *%rax
+  802de1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802de7:	77 6b                	ja     802e54 <devfile_create_snapshot+0x9a>
+  802de9:	4c 89 e7             	mov    %r12,%rdi
+  802dec:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  802df3:	00 00 00 
+  802df6:	ff d0                	call   *%rax
+  802df8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802dfe:	77 5b                	ja     802e5b <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802e00:	48 89 de             	mov    %rbx,%rsi
+  802e03:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802e0a:	00 00 00 
+  802e0d:	48 bb 9f 0f 80 00 00 	movabs $0x800f9f,%rbx
+  802e14:	00 00 00 
+  802e17:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802e19:	4c 89 e6             	mov    %r12,%rsi
+  802e1c:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802e23:	00 00 00 
+  802e26:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802e28:	be 00 00 00 00       	mov    $0x0,%esi
+  802e2d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802e32:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e45:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802e48:	5b                   	pop    %rbx
+  802e49:	41 5c                	pop    %r12
+  802e4b:	5d                   	pop    %rbp
+  802e4c:	c3                   	ret
+        return -E_INVAL;
+  802e4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e52:	eb f4                	jmp    802e48 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802e54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e59:	eb ed                	jmp    802e48 <devfile_create_snapshot+0x8e>
+  802e5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e60:	eb e6                	jmp    802e48 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802e62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e67:	c3                   	ret
+
+0000000000802e68 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e68:	55                   	push   %rbp
+  802e69:	48 89 e5             	mov    %rsp,%rbp
+  802e6c:	41 54                	push   %r12
+  802e6e:	53                   	push   %rbx
+  802e6f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e72:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e75:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802e7c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802e7e:	be 00 00 00 00       	mov    $0x0,%esi
+  802e83:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e88:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  802e8f:	00 00 00 
+  802e92:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	78 3d                	js     802ed5 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e98:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802e9f:	00 00 00 
+  802ea2:	4c 89 e6             	mov    %r12,%rsi
+  802ea5:	48 89 df             	mov    %rbx,%rdi
+  802ea8:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802eb4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ebb:	00 
+  802ebc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ec2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ec9:	00 
+  802eca:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed5:	5b                   	pop    %rbx
+  802ed6:	41 5c                	pop    %r12
+  802ed8:	5d                   	pop    %rbp
+  802ed9:	c3                   	ret
+
+0000000000802eda <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802eda:	55                   	push   %rbp
+  802edb:	48 89 e5             	mov    %rsp,%rbp
+  802ede:	41 57                	push   %r15
+  802ee0:	41 56                	push   %r14
+  802ee2:	41 55                	push   %r13
+  802ee4:	41 54                	push   %r12
+  802ee6:	53                   	push   %rbx
+  802ee7:	48 83 ec 38          	sub    $0x38,%rsp
+  802eeb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802eef:	49 89 f5             	mov    %rsi,%r13
+  802ef2:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ef5:	48 89 f0             	mov    %rsi,%rax
+  802ef8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802efd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802f01:	75 4f                	jne    802f52 <devfile_readmap+0x78>
+  802f03:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f07:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f0d:	75 1f                	jne    802f2e <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802f0f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f13:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802f17:	49 be 66 38 80 00 00 	movabs $0x803866,%r14
+  802f1e:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802f21:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802f28:	0f 87 9d 00 00 00    	ja     802fcb <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802f2e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f32:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802f36:	4d 85 ff             	test   %r15,%r15
+  802f39:	0f 85 cf 00 00 00    	jne    80300e <devfile_readmap+0x134>
+  802f3f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802f43:	48 83 c4 38          	add    $0x38,%rsp
+  802f47:	5b                   	pop    %rbx
+  802f48:	41 5c                	pop    %r12
+  802f4a:	41 5d                	pop    %r13
+  802f4c:	41 5e                	pop    %r14
+  802f4e:	41 5f                	pop    %r15
+  802f50:	5d                   	pop    %rbp
+  802f51:	c3                   	ret
+    size_t totalRead = 0;
+  802f52:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802f59:	00 
+  802f5a:	eb da                	jmp    802f36 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f5c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f60:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f63:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802f6a:	00 00 00 
+  802f6d:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802f6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f73:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802f77:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f7b:	4c 89 ee             	mov    %r13,%rsi
+  802f7e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802f83:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	7e a3                	jle    802f36 <devfile_readmap+0x5c>
+  802f93:	48 98                	cltq
+  802f95:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802f99:	72 9b                	jb     802f36 <devfile_readmap+0x5c>
+        buf += read;
+  802f9b:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802f9e:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802fa1:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802fa5:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802fac:	75 88                	jne    802f36 <devfile_readmap+0x5c>
+  802fae:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fb2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802fb8:	0f 85 78 ff ff ff    	jne    802f36 <devfile_readmap+0x5c>
+  802fbe:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802fc5:	0f 86 6b ff ff ff    	jbe    802f36 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802fcb:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802fd1:	4d 39 e7             	cmp    %r12,%r15
+  802fd4:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802fd8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802fdf:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802fe3:	0f 84 73 ff ff ff    	je     802f5c <devfile_readmap+0x82>
+  802fe9:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802fed:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802ff2:	41 ff d6             	call   *%r14
+  802ff5:	a8 40                	test   $0x40,%al
+  802ff7:	0f 85 39 ff ff ff    	jne    802f36 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ffd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803004:	4c 39 e3             	cmp    %r12,%rbx
+  803007:	72 e4                	jb     802fed <devfile_readmap+0x113>
+  803009:	e9 4e ff ff ff       	jmp    802f5c <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  80300e:	4c 89 fa             	mov    %r15,%rdx
+  803011:	4c 89 ee             	mov    %r13,%rsi
+  803014:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803018:	48 b8 5b 29 80 00 00 	movabs $0x80295b,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  803024:	48 85 c0             	test   %rax,%rax
+  803027:	78 0c                	js     803035 <devfile_readmap+0x15b>
+    return totalRead + read;
+  803029:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80302d:	48 01 f0             	add    %rsi,%rax
+  803030:	e9 0e ff ff ff       	jmp    802f43 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  803035:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803039:	48 85 f6             	test   %rsi,%rsi
+  80303c:	48 0f 45 c6          	cmovne %rsi,%rax
+  803040:	e9 fe fe ff ff       	jmp    802f43 <devfile_readmap+0x69>
+
+0000000000803045 <open>:
+open(const char *path, int mode) {
+  803045:	55                   	push   %rbp
+  803046:	48 89 e5             	mov    %rsp,%rbp
+  803049:	41 55                	push   %r13
+  80304b:	41 54                	push   %r12
+  80304d:	53                   	push   %rbx
+  80304e:	48 83 ec 18          	sub    $0x18,%rsp
+  803052:	49 89 fc             	mov    %rdi,%r12
+  803055:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803058:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+  803064:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80306a:	0f 87 8a 00 00 00    	ja     8030fa <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803070:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803074:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+  803080:	89 c3                	mov    %eax,%ebx
+  803082:	85 c0                	test   %eax,%eax
+  803084:	78 50                	js     8030d6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803086:	4c 89 e6             	mov    %r12,%rsi
+  803089:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803090:	00 00 00 
+  803093:	48 89 df             	mov    %rbx,%rdi
+  803096:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8030a2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8030a9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030b2:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+  8030be:	89 c3                	mov    %eax,%ebx
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	78 1f                	js     8030e3 <open+0x9e>
+    return fd2num(fd);
+  8030c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030c8:	48 b8 75 1b 80 00 00 	movabs $0x801b75,%rax
+  8030cf:	00 00 00 
+  8030d2:	ff d0                	call   *%rax
+  8030d4:	89 c3                	mov    %eax,%ebx
+}
+  8030d6:	89 d8                	mov    %ebx,%eax
+  8030d8:	48 83 c4 18          	add    $0x18,%rsp
+  8030dc:	5b                   	pop    %rbx
+  8030dd:	41 5c                	pop    %r12
+  8030df:	41 5d                	pop    %r13
+  8030e1:	5d                   	pop    %rbp
+  8030e2:	c3                   	ret
+        fd_close(fd, 0);
+  8030e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030ec:	48 b8 be 1c 80 00 00 	movabs $0x801cbe,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+        return res;
+  8030f8:	eb dc                	jmp    8030d6 <open+0x91>
+        return -E_BAD_PATH;
+  8030fa:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030ff:	eb d5                	jmp    8030d6 <open+0x91>
+
+0000000000803101 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803105:	be 00 00 00 00       	mov    $0x0,%esi
+  80310a:	bf 13 00 00 00       	mov    $0x13,%edi
+  80310f:	48 b8 20 27 80 00 00 	movabs $0x802720,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+}
+  80311b:	5d                   	pop    %rbp
+  80311c:	c3                   	ret
+
+000000000080311d <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80311d:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803121:	7f 01                	jg     803124 <writebuf+0x7>
+  803123:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	53                   	push   %rbx
+  803129:	48 83 ec 08          	sub    $0x8,%rsp
+  80312d:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803130:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803134:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803138:	8b 3f                	mov    (%rdi),%edi
+  80313a:	48 b8 e0 20 80 00 00 	movabs $0x8020e0,%rax
+  803141:	00 00 00 
+  803144:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803146:	48 85 c0             	test   %rax,%rax
+  803149:	7e 04                	jle    80314f <writebuf+0x32>
+  80314b:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80314f:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803153:	48 39 c2             	cmp    %rax,%rdx
+  803156:	74 0f                	je     803167 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803158:	48 85 c0             	test   %rax,%rax
+  80315b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803160:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803164:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803167:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80316b:	c9                   	leave
+  80316c:	c3                   	ret
+
+000000000080316d <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80316d:	8b 46 04             	mov    0x4(%rsi),%eax
+  803170:	8d 50 01             	lea    0x1(%rax),%edx
+  803173:	89 56 04             	mov    %edx,0x4(%rsi)
+  803176:	48 98                	cltq
+  803178:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80317d:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803183:	74 01                	je     803186 <putch+0x19>
+  803185:	c3                   	ret
+putch(int ch, void *arg) {
+  803186:	55                   	push   %rbp
+  803187:	48 89 e5             	mov    %rsp,%rbp
+  80318a:	53                   	push   %rbx
+  80318b:	48 83 ec 08          	sub    $0x8,%rsp
+  80318f:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803192:	48 89 f7             	mov    %rsi,%rdi
+  803195:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+        state->offset = 0;
+  8031a1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8031a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031ac:	c9                   	leave
+  8031ad:	c3                   	ret
+
+00000000008031ae <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8031ae:	55                   	push   %rbp
+  8031af:	48 89 e5             	mov    %rsp,%rbp
+  8031b2:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8031b9:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8031bc:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8031c2:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8031c9:	00 00 00 
+    state.result = 0;
+  8031cc:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8031d3:	00 00 00 00 
+    state.error = 1;
+  8031d7:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8031de:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8031e1:	48 89 f2             	mov    %rsi,%rdx
+  8031e4:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8031eb:	48 bf 6d 31 80 00 00 	movabs $0x80316d,%rdi
+  8031f2:	00 00 00 
+  8031f5:	48 b8 ca 07 80 00 00 	movabs $0x8007ca,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803201:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803208:	7f 14                	jg     80321e <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80320a:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803211:	48 85 c0             	test   %rax,%rax
+  803214:	75 06                	jne    80321c <vfprintf+0x6e>
+  803216:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80321c:	c9                   	leave
+  80321d:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80321e:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803225:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+  803231:	eb d7                	jmp    80320a <vfprintf+0x5c>
+
+0000000000803233 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803233:	55                   	push   %rbp
+  803234:	48 89 e5             	mov    %rsp,%rbp
+  803237:	48 83 ec 50          	sub    $0x50,%rsp
+  80323b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80323f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803243:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803247:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80324b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803252:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803256:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80325a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80325e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803262:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803266:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  80326d:	00 00 00 
+  803270:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803272:	c9                   	leave
+  803273:	c3                   	ret
+
+0000000000803274 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803274:	55                   	push   %rbp
+  803275:	48 89 e5             	mov    %rsp,%rbp
+  803278:	48 83 ec 50          	sub    $0x50,%rsp
+  80327c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803280:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803284:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803288:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80328c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803290:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803297:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80329b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80329f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8032a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8032a7:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8032ab:	48 89 fe             	mov    %rdi,%rsi
+  8032ae:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032b3:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  8032ba:	00 00 00 
+  8032bd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8032bf:	c9                   	leave
+  8032c0:	c3                   	ret
+
+00000000008032c1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8032c1:	55                   	push   %rbp
+  8032c2:	48 89 e5             	mov    %rsp,%rbp
+  8032c5:	41 54                	push   %r12
+  8032c7:	53                   	push   %rbx
+  8032c8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032cb:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  8032d2:	00 00 00 
+  8032d5:	ff d0                	call   *%rax
+  8032d7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8032da:	48 be c0 44 80 00 00 	movabs $0x8044c0,%rsi
+  8032e1:	00 00 00 
+  8032e4:	48 89 df             	mov    %rbx,%rdi
+  8032e7:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8032f3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8032f8:	41 2b 04 24          	sub    (%r12),%eax
+  8032fc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803302:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803309:	00 00 00 
+    stat->st_dev = &devpipe;
+  80330c:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803313:	00 00 00 
+  803316:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80331d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803322:	5b                   	pop    %rbx
+  803323:	41 5c                	pop    %r12
+  803325:	5d                   	pop    %rbp
+  803326:	c3                   	ret
+
+0000000000803327 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803327:	55                   	push   %rbp
+  803328:	48 89 e5             	mov    %rsp,%rbp
+  80332b:	41 54                	push   %r12
+  80332d:	53                   	push   %rbx
+  80332e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803331:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803336:	48 89 fe             	mov    %rdi,%rsi
+  803339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333e:	49 bc f7 16 80 00 00 	movabs $0x8016f7,%r12
+  803345:	00 00 00 
+  803348:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80334b:	48 89 df             	mov    %rbx,%rdi
+  80334e:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  803355:	00 00 00 
+  803358:	ff d0                	call   *%rax
+  80335a:	48 89 c6             	mov    %rax,%rsi
+  80335d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803362:	bf 00 00 00 00       	mov    $0x0,%edi
+  803367:	41 ff d4             	call   *%r12
+}
+  80336a:	5b                   	pop    %rbx
+  80336b:	41 5c                	pop    %r12
+  80336d:	5d                   	pop    %rbp
+  80336e:	c3                   	ret
+
+000000000080336f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80336f:	55                   	push   %rbp
+  803370:	48 89 e5             	mov    %rsp,%rbp
+  803373:	41 57                	push   %r15
+  803375:	41 56                	push   %r14
+  803377:	41 55                	push   %r13
+  803379:	41 54                	push   %r12
+  80337b:	53                   	push   %rbx
+  80337c:	48 83 ec 18          	sub    $0x18,%rsp
+  803380:	49 89 fc             	mov    %rdi,%r12
+  803383:	49 89 f5             	mov    %rsi,%r13
+  803386:	49 89 d7             	mov    %rdx,%r15
+  803389:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80338d:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803399:	4d 85 ff             	test   %r15,%r15
+  80339c:	0f 84 af 00 00 00    	je     803451 <devpipe_write+0xe2>
+  8033a2:	48 89 c3             	mov    %rax,%rbx
+  8033a5:	4c 89 f8             	mov    %r15,%rax
+  8033a8:	4d 89 ef             	mov    %r13,%r15
+  8033ab:	4c 01 e8             	add    %r13,%rax
+  8033ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033b2:	49 bd ff 15 80 00 00 	movabs $0x8015ff,%r13
+  8033b9:	00 00 00 
+            sys_yield();
+  8033bc:	49 be 9c 15 80 00 00 	movabs $0x80159c,%r14
+  8033c3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8033c6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8033c9:	48 63 ce             	movslq %esi,%rcx
+  8033cc:	48 63 03             	movslq (%rbx),%rax
+  8033cf:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8033d5:	48 39 c1             	cmp    %rax,%rcx
+  8033d8:	72 2e                	jb     803408 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033da:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033df:	48 89 da             	mov    %rbx,%rdx
+  8033e2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033e7:	4c 89 e7             	mov    %r12,%rdi
+  8033ea:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	74 66                	je     803457 <devpipe_write+0xe8>
+            sys_yield();
+  8033f1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8033f4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8033f7:	48 63 ce             	movslq %esi,%rcx
+  8033fa:	48 63 03             	movslq (%rbx),%rax
+  8033fd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803403:	48 39 c1             	cmp    %rax,%rcx
+  803406:	73 d2                	jae    8033da <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803408:	41 0f b6 3f          	movzbl (%r15),%edi
+  80340c:	48 89 ca             	mov    %rcx,%rdx
+  80340f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803413:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80341a:	08 10 20 
+  80341d:	48 f7 e2             	mul    %rdx
+  803420:	48 c1 ea 06          	shr    $0x6,%rdx
+  803424:	48 89 d0             	mov    %rdx,%rax
+  803427:	48 c1 e0 09          	shl    $0x9,%rax
+  80342b:	48 29 d0             	sub    %rdx,%rax
+  80342e:	48 c1 e0 03          	shl    $0x3,%rax
+  803432:	48 29 c1             	sub    %rax,%rcx
+  803435:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80343a:	83 c6 01             	add    $0x1,%esi
+  80343d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803440:	49 83 c7 01          	add    $0x1,%r15
+  803444:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803448:	49 39 c7             	cmp    %rax,%r15
+  80344b:	0f 85 75 ff ff ff    	jne    8033c6 <devpipe_write+0x57>
+    return n;
+  803451:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803455:	eb 05                	jmp    80345c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803457:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345c:	48 83 c4 18          	add    $0x18,%rsp
+  803460:	5b                   	pop    %rbx
+  803461:	41 5c                	pop    %r12
+  803463:	41 5d                	pop    %r13
+  803465:	41 5e                	pop    %r14
+  803467:	41 5f                	pop    %r15
+  803469:	5d                   	pop    %rbp
+  80346a:	c3                   	ret
+
+000000000080346b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80346b:	55                   	push   %rbp
+  80346c:	48 89 e5             	mov    %rsp,%rbp
+  80346f:	41 57                	push   %r15
+  803471:	41 56                	push   %r14
+  803473:	41 55                	push   %r13
+  803475:	41 54                	push   %r12
+  803477:	53                   	push   %rbx
+  803478:	48 83 ec 18          	sub    $0x18,%rsp
+  80347c:	49 89 fc             	mov    %rdi,%r12
+  80347f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803483:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803487:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  80348e:	00 00 00 
+  803491:	ff d0                	call   *%rax
+  803493:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803496:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80349c:	49 bd ff 15 80 00 00 	movabs $0x8015ff,%r13
+  8034a3:	00 00 00 
+            sys_yield();
+  8034a6:	49 be 9c 15 80 00 00 	movabs $0x80159c,%r14
+  8034ad:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8034b0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8034b5:	74 7d                	je     803534 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8034b7:	8b 03                	mov    (%rbx),%eax
+  8034b9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8034bc:	75 26                	jne    8034e4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8034be:	4d 85 ff             	test   %r15,%r15
+  8034c1:	75 77                	jne    80353a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8034c3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8034c8:	48 89 da             	mov    %rbx,%rdx
+  8034cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034d0:	4c 89 e7             	mov    %r12,%rdi
+  8034d3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	74 72                	je     80354c <devpipe_read+0xe1>
+            sys_yield();
+  8034da:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8034dd:	8b 03                	mov    (%rbx),%eax
+  8034df:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8034e2:	74 df                	je     8034c3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8034e4:	48 63 c8             	movslq %eax,%rcx
+  8034e7:	48 89 ca             	mov    %rcx,%rdx
+  8034ea:	48 c1 ea 03          	shr    $0x3,%rdx
+  8034ee:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8034f5:	08 10 20 
+  8034f8:	48 89 d0             	mov    %rdx,%rax
+  8034fb:	48 f7 e6             	mul    %rsi
+  8034fe:	48 c1 ea 06          	shr    $0x6,%rdx
+  803502:	48 89 d0             	mov    %rdx,%rax
+  803505:	48 c1 e0 09          	shl    $0x9,%rax
+  803509:	48 29 d0             	sub    %rdx,%rax
+  80350c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803513:	00 
+  803514:	48 89 c8             	mov    %rcx,%rax
+  803517:	48 29 d0             	sub    %rdx,%rax
+  80351a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80351f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803523:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803527:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80352a:	49 83 c7 01          	add    $0x1,%r15
+  80352e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803532:	75 83                	jne    8034b7 <devpipe_read+0x4c>
+    return n;
+  803534:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803538:	eb 03                	jmp    80353d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80353a:	4c 89 f8             	mov    %r15,%rax
+}
+  80353d:	48 83 c4 18          	add    $0x18,%rsp
+  803541:	5b                   	pop    %rbx
+  803542:	41 5c                	pop    %r12
+  803544:	41 5d                	pop    %r13
+  803546:	41 5e                	pop    %r14
+  803548:	41 5f                	pop    %r15
+  80354a:	5d                   	pop    %rbp
+  80354b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80354c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803551:	eb ea                	jmp    80353d <devpipe_read+0xd2>
+
+0000000000803553 <pipe>:
+pipe(int pfd[2]) {
+  803553:	55                   	push   %rbp
+  803554:	48 89 e5             	mov    %rsp,%rbp
+  803557:	41 55                	push   %r13
+  803559:	41 54                	push   %r12
+  80355b:	53                   	push   %rbx
+  80355c:	48 83 ec 18          	sub    $0x18,%rsp
+  803560:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803563:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803567:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  80356e:	00 00 00 
+  803571:	ff d0                	call   *%rax
+  803573:	89 c3                	mov    %eax,%ebx
+  803575:	85 c0                	test   %eax,%eax
+  803577:	0f 88 a0 01 00 00    	js     80371d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80357d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803582:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803587:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80358b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803590:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+  80359c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	0f 88 77 01 00 00    	js     80371d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8035a6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8035aa:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+  8035b6:	89 c3                	mov    %eax,%ebx
+  8035b8:	85 c0                	test   %eax,%eax
+  8035ba:	0f 88 43 01 00 00    	js     803703 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8035c0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8035c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035ca:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8035ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d3:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	0f 88 1a 01 00 00    	js     803703 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8035e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035ed:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+  8035f9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8035fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803601:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803606:	48 89 c6             	mov    %rax,%rsi
+  803609:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360e:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+  80361a:	89 c3                	mov    %eax,%ebx
+  80361c:	85 c0                	test   %eax,%eax
+  80361e:	0f 88 c5 00 00 00    	js     8036e9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803624:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803628:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  80362f:	00 00 00 
+  803632:	ff d0                	call   *%rax
+  803634:	48 89 c1             	mov    %rax,%rcx
+  803637:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80363d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803643:	ba 00 00 00 00       	mov    $0x0,%edx
+  803648:	4c 89 ee             	mov    %r13,%rsi
+  80364b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803650:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+  80365c:	89 c3                	mov    %eax,%ebx
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	78 6e                	js     8036d0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803662:	be 00 10 00 00       	mov    $0x1000,%esi
+  803667:	4c 89 ef             	mov    %r13,%rdi
+  80366a:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  803671:	00 00 00 
+  803674:	ff d0                	call   *%rax
+  803676:	83 f8 02             	cmp    $0x2,%eax
+  803679:	0f 85 ab 00 00 00    	jne    80372a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80367f:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803686:	00 00 
+  803688:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80368c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80368e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803692:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803699:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80369d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80369f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8036aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036ae:	48 bb 75 1b 80 00 00 	movabs $0x801b75,%rbx
+  8036b5:	00 00 00 
+  8036b8:	ff d3                	call   *%rbx
+  8036ba:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8036be:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8036c2:	ff d3                	call   *%rbx
+  8036c4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8036c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036ce:	eb 4d                	jmp    80371d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8036d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036d5:	4c 89 ee             	mov    %r13,%rsi
+  8036d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036dd:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  8036e4:	00 00 00 
+  8036e7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8036e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036ee:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8036f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f7:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  8036fe:	00 00 00 
+  803701:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803703:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803708:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80370c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803711:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  803718:	00 00 00 
+  80371b:	ff d0                	call   *%rax
+}
+  80371d:	89 d8                	mov    %ebx,%eax
+  80371f:	48 83 c4 18          	add    $0x18,%rsp
+  803723:	5b                   	pop    %rbx
+  803724:	41 5c                	pop    %r12
+  803726:	41 5d                	pop    %r13
+  803728:	5d                   	pop    %rbp
+  803729:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80372a:	48 b9 f0 44 80 00 00 	movabs $0x8044f0,%rcx
+  803731:	00 00 00 
+  803734:	48 ba c7 44 80 00 00 	movabs $0x8044c7,%rdx
+  80373b:	00 00 00 
+  80373e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803743:	48 bf dc 44 80 00 00 	movabs $0x8044dc,%rdi
+  80374a:	00 00 00 
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803752:	49 b8 2a 05 80 00 00 	movabs $0x80052a,%r8
+  803759:	00 00 00 
+  80375c:	41 ff d0             	call   *%r8
+
+000000000080375f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80375f:	55                   	push   %rbp
+  803760:	48 89 e5             	mov    %rsp,%rbp
+  803763:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803767:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80376b:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  803772:	00 00 00 
+  803775:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803777:	85 c0                	test   %eax,%eax
+  803779:	78 35                	js     8037b0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80377b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80377f:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  803786:	00 00 00 
+  803789:	ff d0                	call   *%rax
+  80378b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80378e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803793:	be 00 10 00 00       	mov    $0x1000,%esi
+  803798:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80379c:	48 b8 ff 15 80 00 00 	movabs $0x8015ff,%rax
+  8037a3:	00 00 00 
+  8037a6:	ff d0                	call   *%rax
+  8037a8:	85 c0                	test   %eax,%eax
+  8037aa:	0f 94 c0             	sete   %al
+  8037ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8037b0:	c9                   	leave
+  8037b1:	c3                   	ret
+
+00000000008037b2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8037b2:	48 89 f8             	mov    %rdi,%rax
+  8037b5:	48 c1 e8 27          	shr    $0x27,%rax
+  8037b9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8037c0:	01 00 00 
+  8037c3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037c7:	f6 c2 01             	test   $0x1,%dl
+  8037ca:	74 6d                	je     803839 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8037cc:	48 89 f8             	mov    %rdi,%rax
+  8037cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037d3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8037da:	01 00 00 
+  8037dd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037e1:	f6 c2 01             	test   $0x1,%dl
+  8037e4:	74 62                	je     803848 <get_uvpt_entry+0x96>
+  8037e6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8037ed:	01 00 00 
+  8037f0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037f4:	f6 c2 80             	test   $0x80,%dl
+  8037f7:	75 4f                	jne    803848 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8037f9:	48 89 f8             	mov    %rdi,%rax
+  8037fc:	48 c1 e8 15          	shr    $0x15,%rax
+  803800:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803807:	01 00 00 
+  80380a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80380e:	f6 c2 01             	test   $0x1,%dl
+  803811:	74 44                	je     803857 <get_uvpt_entry+0xa5>
+  803813:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80381a:	01 00 00 
+  80381d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803821:	f6 c2 80             	test   $0x80,%dl
+  803824:	75 31                	jne    803857 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803826:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80382a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803831:	01 00 00 
+  803834:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803838:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803839:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803840:	01 00 00 
+  803843:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803847:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803848:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80384f:	01 00 00 
+  803852:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803856:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803857:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80385e:	01 00 00 
+  803861:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803865:	c3                   	ret
+
+0000000000803866 <get_prot>:
+
+int
+get_prot(void *va) {
+  803866:	55                   	push   %rbp
+  803867:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80386a:	48 b8 b2 37 80 00 00 	movabs $0x8037b2,%rax
+  803871:	00 00 00 
+  803874:	ff d0                	call   *%rax
+  803876:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803879:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80387e:	89 c1                	mov    %eax,%ecx
+  803880:	83 c9 04             	or     $0x4,%ecx
+  803883:	f6 c2 01             	test   $0x1,%dl
+  803886:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803889:	89 c1                	mov    %eax,%ecx
+  80388b:	83 c9 02             	or     $0x2,%ecx
+  80388e:	f6 c2 02             	test   $0x2,%dl
+  803891:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803894:	89 c1                	mov    %eax,%ecx
+  803896:	83 c9 01             	or     $0x1,%ecx
+  803899:	48 85 d2             	test   %rdx,%rdx
+  80389c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80389f:	89 c1                	mov    %eax,%ecx
+  8038a1:	83 c9 40             	or     $0x40,%ecx
+  8038a4:	f6 c6 04             	test   $0x4,%dh
+  8038a7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8038aa:	5d                   	pop    %rbp
+  8038ab:	c3                   	ret
+
+00000000008038ac <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8038ac:	55                   	push   %rbp
+  8038ad:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038b0:	48 b8 b2 37 80 00 00 	movabs $0x8037b2,%rax
+  8038b7:	00 00 00 
+  8038ba:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8038bc:	48 c1 e8 06          	shr    $0x6,%rax
+  8038c0:	83 e0 01             	and    $0x1,%eax
+}
+  8038c3:	5d                   	pop    %rbp
+  8038c4:	c3                   	ret
+
+00000000008038c5 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8038c5:	55                   	push   %rbp
+  8038c6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8038c9:	48 b8 b2 37 80 00 00 	movabs $0x8037b2,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8038d5:	48 c1 e8 05          	shr    $0x5,%rax
+  8038d9:	83 e0 01             	and    $0x1,%eax
+}
+  8038dc:	5d                   	pop    %rbp
+  8038dd:	c3                   	ret
+
+00000000008038de <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8038de:	55                   	push   %rbp
+  8038df:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8038e2:	48 b8 b2 37 80 00 00 	movabs $0x8037b2,%rax
+  8038e9:	00 00 00 
+  8038ec:	ff d0                	call   *%rax
+  8038ee:	83 e0 01             	and    $0x1,%eax
+}
+  8038f1:	5d                   	pop    %rbp
+  8038f2:	c3                   	ret
+
+00000000008038f3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	41 57                	push   %r15
+  8038f9:	41 56                	push   %r14
+  8038fb:	41 55                	push   %r13
+  8038fd:	41 54                	push   %r12
+  8038ff:	53                   	push   %rbx
+  803900:	48 83 ec 18          	sub    $0x18,%rsp
+  803904:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803908:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80390c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803911:	49 bd de 38 80 00 00 	movabs $0x8038de,%r13
+  803918:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80391b:	49 bf 66 38 80 00 00 	movabs $0x803866,%r15
+  803922:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803925:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80392c:	00 00 00 
+  80392f:	eb 0c                	jmp    80393d <foreach_shared_region+0x4a>
+  803931:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803938:	4c 39 f3             	cmp    %r14,%rbx
+  80393b:	74 2e                	je     80396b <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80393d:	48 89 df             	mov    %rbx,%rdi
+  803940:	41 ff d5             	call   *%r13
+  803943:	84 c0                	test   %al,%al
+  803945:	74 ea                	je     803931 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803947:	48 89 df             	mov    %rbx,%rdi
+  80394a:	41 ff d7             	call   *%r15
+  80394d:	a8 40                	test   $0x40,%al
+  80394f:	74 e0                	je     803931 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803951:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80395c:	48 89 df             	mov    %rbx,%rdi
+  80395f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803963:	ff d0                	call   *%rax
+				if (res < 0) {
+  803965:	85 c0                	test   %eax,%eax
+  803967:	79 c8                	jns    803931 <foreach_shared_region+0x3e>
+  803969:	eb 05                	jmp    803970 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80396b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803970:	48 83 c4 18          	add    $0x18,%rsp
+  803974:	5b                   	pop    %rbx
+  803975:	41 5c                	pop    %r12
+  803977:	41 5d                	pop    %r13
+  803979:	41 5e                	pop    %r14
+  80397b:	41 5f                	pop    %r15
+  80397d:	5d                   	pop    %rbp
+  80397e:	c3                   	ret
+
+000000000080397f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80397f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803984:	c3                   	ret
+
+0000000000803985 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803985:	55                   	push   %rbp
+  803986:	48 89 e5             	mov    %rsp,%rbp
+  803989:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80398c:	48 be 14 45 80 00 00 	movabs $0x804514,%rsi
+  803993:	00 00 00 
+  803996:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  80399d:	00 00 00 
+  8039a0:	ff d0                	call   *%rax
+    return 0;
+}
+  8039a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a7:	5d                   	pop    %rbp
+  8039a8:	c3                   	ret
+
+00000000008039a9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039a9:	55                   	push   %rbp
+  8039aa:	48 89 e5             	mov    %rsp,%rbp
+  8039ad:	41 57                	push   %r15
+  8039af:	41 56                	push   %r14
+  8039b1:	41 55                	push   %r13
+  8039b3:	41 54                	push   %r12
+  8039b5:	53                   	push   %rbx
+  8039b6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8039bd:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8039c4:	48 85 d2             	test   %rdx,%rdx
+  8039c7:	74 7a                	je     803a43 <devcons_write+0x9a>
+  8039c9:	49 89 d6             	mov    %rdx,%r14
+  8039cc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039d2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8039d7:	49 bf 99 11 80 00 00 	movabs $0x801199,%r15
+  8039de:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8039e1:	4c 89 f3             	mov    %r14,%rbx
+  8039e4:	48 29 f3             	sub    %rsi,%rbx
+  8039e7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039ec:	48 39 c3             	cmp    %rax,%rbx
+  8039ef:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8039f3:	4c 63 eb             	movslq %ebx,%r13
+  8039f6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8039fd:	48 01 c6             	add    %rax,%rsi
+  803a00:	4c 89 ea             	mov    %r13,%rdx
+  803a03:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a0a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803a0d:	4c 89 ee             	mov    %r13,%rsi
+  803a10:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a17:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  803a1e:	00 00 00 
+  803a21:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a23:	41 01 dc             	add    %ebx,%r12d
+  803a26:	49 63 f4             	movslq %r12d,%rsi
+  803a29:	4c 39 f6             	cmp    %r14,%rsi
+  803a2c:	72 b3                	jb     8039e1 <devcons_write+0x38>
+    return res;
+  803a2e:	49 63 c4             	movslq %r12d,%rax
+}
+  803a31:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a38:	5b                   	pop    %rbx
+  803a39:	41 5c                	pop    %r12
+  803a3b:	41 5d                	pop    %r13
+  803a3d:	41 5e                	pop    %r14
+  803a3f:	41 5f                	pop    %r15
+  803a41:	5d                   	pop    %rbp
+  803a42:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a43:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a49:	eb e3                	jmp    803a2e <devcons_write+0x85>
+
+0000000000803a4b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a4b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a53:	48 85 c0             	test   %rax,%rax
+  803a56:	74 55                	je     803aad <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a58:	55                   	push   %rbp
+  803a59:	48 89 e5             	mov    %rsp,%rbp
+  803a5c:	41 55                	push   %r13
+  803a5e:	41 54                	push   %r12
+  803a60:	53                   	push   %rbx
+  803a61:	48 83 ec 08          	sub    $0x8,%rsp
+  803a65:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803a68:	48 bb cf 14 80 00 00 	movabs $0x8014cf,%rbx
+  803a6f:	00 00 00 
+  803a72:	49 bc 9c 15 80 00 00 	movabs $0x80159c,%r12
+  803a79:	00 00 00 
+  803a7c:	eb 03                	jmp    803a81 <devcons_read+0x36>
+  803a7e:	41 ff d4             	call   *%r12
+  803a81:	ff d3                	call   *%rbx
+  803a83:	85 c0                	test   %eax,%eax
+  803a85:	74 f7                	je     803a7e <devcons_read+0x33>
+    if (c < 0) return c;
+  803a87:	48 63 d0             	movslq %eax,%rdx
+  803a8a:	78 13                	js     803a9f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a91:	83 f8 04             	cmp    $0x4,%eax
+  803a94:	74 09                	je     803a9f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803a96:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803a9a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803a9f:	48 89 d0             	mov    %rdx,%rax
+  803aa2:	48 83 c4 08          	add    $0x8,%rsp
+  803aa6:	5b                   	pop    %rbx
+  803aa7:	41 5c                	pop    %r12
+  803aa9:	41 5d                	pop    %r13
+  803aab:	5d                   	pop    %rbp
+  803aac:	c3                   	ret
+  803aad:	48 89 d0             	mov    %rdx,%rax
+  803ab0:	c3                   	ret
+
+0000000000803ab1 <cputchar>:
+cputchar(int ch) {
+  803ab1:	55                   	push   %rbp
+  803ab2:	48 89 e5             	mov    %rsp,%rbp
+  803ab5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803ab9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803abd:	be 01 00 00 00       	mov    $0x1,%esi
+  803ac2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803ac6:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  803acd:	00 00 00 
+  803ad0:	ff d0                	call   *%rax
+}
+  803ad2:	c9                   	leave
+  803ad3:	c3                   	ret
+
+0000000000803ad4 <getchar>:
+getchar(void) {
+  803ad4:	55                   	push   %rbp
+  803ad5:	48 89 e5             	mov    %rsp,%rbp
+  803ad8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803adc:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ae1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aea:	48 b8 e6 1e 80 00 00 	movabs $0x801ee6,%rax
+  803af1:	00 00 00 
+  803af4:	ff d0                	call   *%rax
+  803af6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803af8:	85 c0                	test   %eax,%eax
+  803afa:	78 06                	js     803b02 <getchar+0x2e>
+  803afc:	74 08                	je     803b06 <getchar+0x32>
+  803afe:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803b02:	89 d0                	mov    %edx,%eax
+  803b04:	c9                   	leave
+  803b05:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803b06:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803b0b:	eb f5                	jmp    803b02 <getchar+0x2e>
+
+0000000000803b0d <iscons>:
+iscons(int fdnum) {
+  803b0d:	55                   	push   %rbp
+  803b0e:	48 89 e5             	mov    %rsp,%rbp
+  803b11:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b15:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b19:	48 b8 03 1c 80 00 00 	movabs $0x801c03,%rax
+  803b20:	00 00 00 
+  803b23:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	78 18                	js     803b41 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b2d:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803b34:	00 00 00 
+  803b37:	8b 00                	mov    (%rax),%eax
+  803b39:	39 02                	cmp    %eax,(%rdx)
+  803b3b:	0f 94 c0             	sete   %al
+  803b3e:	0f b6 c0             	movzbl %al,%eax
+}
+  803b41:	c9                   	leave
+  803b42:	c3                   	ret
+
+0000000000803b43 <opencons>:
+opencons(void) {
+  803b43:	55                   	push   %rbp
+  803b44:	48 89 e5             	mov    %rsp,%rbp
+  803b47:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b4b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803b4f:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  803b56:	00 00 00 
+  803b59:	ff d0                	call   *%rax
+  803b5b:	85 c0                	test   %eax,%eax
+  803b5d:	78 49                	js     803ba8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803b5f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b69:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b72:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803b79:	00 00 00 
+  803b7c:	ff d0                	call   *%rax
+  803b7e:	85 c0                	test   %eax,%eax
+  803b80:	78 26                	js     803ba8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803b82:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b86:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803b8d:	00 00 
+  803b8f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803b91:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b95:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803b9c:	48 b8 75 1b 80 00 00 	movabs $0x801b75,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+}
+  803ba8:	c9                   	leave
+  803ba9:	c3                   	ret
+
+0000000000803baa <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803baa:	55                   	push   %rbp
+  803bab:	48 89 e5             	mov    %rsp,%rbp
+  803bae:	41 55                	push   %r13
+  803bb0:	41 54                	push   %r12
+  803bb2:	53                   	push   %rbx
+  803bb3:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb7:	49 89 fc             	mov    %rdi,%r12
+  803bba:	48 89 f7             	mov    %rsi,%rdi
+  803bbd:	48 89 d3             	mov    %rdx,%rbx
+  803bc0:	49 89 cd             	mov    %rcx,%r13
+  803bc3:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bc6:	48 85 f6             	test   %rsi,%rsi
+  803bc9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bd0:	00 00 00 
+  803bd3:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803bd7:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bdc:	48 85 db             	test   %rbx,%rbx
+  803bdf:	74 03                	je     803be4 <ipc_recv_timed+0x3a>
+  803be1:	48 8b 33             	mov    (%rbx),%rsi
+  803be4:	48 b8 c5 18 80 00 00 	movabs $0x8018c5,%rax
+  803beb:	00 00 00 
+  803bee:	ff d0                	call   *%rax
+    if (res < 0) {
+  803bf0:	85 c0                	test   %eax,%eax
+  803bf2:	78 75                	js     803c69 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803bf4:	4d 85 e4             	test   %r12,%r12
+  803bf7:	74 14                	je     803c0d <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803bf9:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  803c00:	00 00 00 
+  803c03:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803c09:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803c0d:	4d 85 ed             	test   %r13,%r13
+  803c10:	74 14                	je     803c26 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803c12:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  803c19:	00 00 00 
+  803c1c:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803c22:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803c26:	48 85 db             	test   %rbx,%rbx
+  803c29:	74 23                	je     803c4e <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803c2b:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  803c32:	00 00 00 
+  803c35:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c40:	85 c9                	test   %ecx,%ecx
+  803c42:	74 07                	je     803c4b <ipc_recv_timed+0xa1>
+  803c44:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803c4b:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803c4e:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  803c55:	00 00 00 
+  803c58:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803c5e:	48 83 c4 08          	add    $0x8,%rsp
+  803c62:	5b                   	pop    %rbx
+  803c63:	41 5c                	pop    %r12
+  803c65:	41 5d                	pop    %r13
+  803c67:	5d                   	pop    %rbp
+  803c68:	c3                   	ret
+        if (from_env_store != NULL) {
+  803c69:	4d 85 e4             	test   %r12,%r12
+  803c6c:	74 08                	je     803c76 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803c6e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c75:	00 
+        if (perm_store != NULL) {
+  803c76:	4d 85 ed             	test   %r13,%r13
+  803c79:	74 08                	je     803c83 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803c7b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803c82:	00 
+        if (size != NULL) {
+  803c83:	48 85 db             	test   %rbx,%rbx
+  803c86:	74 d6                	je     803c5e <ipc_recv_timed+0xb4>
+            *size = 0;
+  803c88:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803c8f:	eb cd                	jmp    803c5e <ipc_recv_timed+0xb4>
+
+0000000000803c91 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803c91:	55                   	push   %rbp
+  803c92:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803c95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c9b:	48 b8 aa 3b 80 00 00 	movabs $0x803baa,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+}
+  803ca7:	5d                   	pop    %rbp
+  803ca8:	c3                   	ret
+
+0000000000803ca9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ca9:	55                   	push   %rbp
+  803caa:	48 89 e5             	mov    %rsp,%rbp
+  803cad:	41 57                	push   %r15
+  803caf:	41 56                	push   %r14
+  803cb1:	41 55                	push   %r13
+  803cb3:	41 54                	push   %r12
+  803cb5:	53                   	push   %rbx
+  803cb6:	48 83 ec 18          	sub    $0x18,%rsp
+  803cba:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803cbd:	48 89 d3             	mov    %rdx,%rbx
+  803cc0:	49 89 cc             	mov    %rcx,%r12
+  803cc3:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803cc6:	48 85 d2             	test   %rdx,%rdx
+  803cc9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd0:	00 00 00 
+  803cd3:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803cd7:	89 f0                	mov    %esi,%eax
+  803cd9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cdd:	48 89 da             	mov    %rbx,%rdx
+  803ce0:	48 89 c6             	mov    %rax,%rsi
+  803ce3:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+    while (res < 0) {
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	79 65                	jns    803d58 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803cf3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803cf6:	75 33                	jne    803d2b <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803cf8:	49 bf 9c 15 80 00 00 	movabs $0x80159c,%r15
+  803cff:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803d02:	49 be 99 18 80 00 00 	movabs $0x801899,%r14
+  803d09:	00 00 00 
+        sys_yield();
+  803d0c:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803d0f:	45 89 e8             	mov    %r13d,%r8d
+  803d12:	4c 89 e1             	mov    %r12,%rcx
+  803d15:	48 89 da             	mov    %rbx,%rdx
+  803d18:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803d1c:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803d1f:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803d22:	85 c0                	test   %eax,%eax
+  803d24:	79 32                	jns    803d58 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803d26:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803d29:	74 e1                	je     803d0c <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803d2b:	89 c1                	mov    %eax,%ecx
+  803d2d:	48 ba 20 45 80 00 00 	movabs $0x804520,%rdx
+  803d34:	00 00 00 
+  803d37:	be 52 00 00 00       	mov    $0x52,%esi
+  803d3c:	48 bf 34 45 80 00 00 	movabs $0x804534,%rdi
+  803d43:	00 00 00 
+  803d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4b:	49 b8 2a 05 80 00 00 	movabs $0x80052a,%r8
+  803d52:	00 00 00 
+  803d55:	41 ff d0             	call   *%r8
+    }
+}
+  803d58:	48 83 c4 18          	add    $0x18,%rsp
+  803d5c:	5b                   	pop    %rbx
+  803d5d:	41 5c                	pop    %r12
+  803d5f:	41 5d                	pop    %r13
+  803d61:	41 5e                	pop    %r14
+  803d63:	41 5f                	pop    %r15
+  803d65:	5d                   	pop    %rbp
+  803d66:	c3                   	ret
+
+0000000000803d67 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803d67:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803d6c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803d73:	00 00 00 
+  803d76:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803d7a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803d7e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803d82:	48 01 ca             	add    %rcx,%rdx
+  803d85:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803d8b:	39 fa                	cmp    %edi,%edx
+  803d8d:	74 12                	je     803da1 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803d8f:	48 83 c0 01          	add    $0x1,%rax
+  803d93:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803d99:	75 db                	jne    803d76 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803da0:	c3                   	ret
+            return envs[i].env_id;
+  803da1:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803da5:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803da9:	48 c1 e2 04          	shl    $0x4,%rdx
+  803dad:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803db4:	00 00 00 
+  803db7:	48 01 d0             	add    %rdx,%rax
+  803dba:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dc0:	c3                   	ret
+  803dc1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803dc8 <__rodata_start>:
+  803dc8:	2f                   	(bad)
+  803dc9:	00 25 31 31 64 20    	add    %ah,0x20643131(%rip)        # 20e46f00 <__bss_end+0x2063df00>
+  803dcf:	25 63 20 00 25       	and    $0x25002063,%eax
+  803dd4:	73 25                	jae    803dfb <__rodata_start+0x33>
+  803dd6:	73 00                	jae    803dd8 <__rodata_start+0x10>
+  803dd8:	2e 73 6e             	jae,pn 803e49 <__rodata_start+0x81>
+  803ddb:	61                   	(bad)
+  803ddc:	70 73                	jo     803e51 <__rodata_start+0x89>
+  803dde:	68 6f 74 73 00       	push   $0x73746f
+  803de3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803de4:	70 65                	jo     803e4b <__rodata_start+0x83>
+  803de6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803de7:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a07860 <__bss_end+0x251fe860>
+  803ded:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  803df3:	2f                   	(bad)
+  803df4:	6c                   	insb   (%dx),%es:(%rdi)
+  803df5:	73 2e                	jae    803e25 <__rodata_start+0x5d>
+  803df7:	63 00                	movsxd (%rax),%eax
+  803df9:	73 68                	jae    803e63 <__rodata_start+0x9b>
+  803dfb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dfc:	72 74                	jb     803e72 <__rodata_start+0xaa>
+  803dfe:	20 72 65             	and    %dh,0x65(%rdx)
+  803e01:	61                   	(bad)
+  803e02:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803e06:	20 64 69 72          	and    %ah,0x72(%rcx,%rbp,2)
+  803e0a:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  803e0f:	79 20                	jns    803e31 <__rodata_start+0x69>
+  803e11:	25 73 00 73 74       	and    $0x74730073,%eax
+  803e16:	61                   	(bad)
+  803e17:	74 20                	je     803e39 <__rodata_start+0x71>
+  803e19:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  803e1e:	69 00 75 73 61 67    	imul   $0x67617375,(%rax),%eax
+  803e24:	65 3a 20             	cmp    %gs:(%rax),%ah
+  803e27:	6c                   	insb   (%dx),%es:(%rdi)
+  803e28:	73 20                	jae    803e4a <__rodata_start+0x82>
+  803e2a:	5b                   	pop    %rbx
+  803e2b:	2d 64 46 6c 5d       	sub    $0x5d6c4664,%eax
+  803e30:	20 5b 66             	and    %bl,0x66(%rbx)
+  803e33:	69 6c 65 2e 2e 2e 5d 	imul   $0xa5d2e2e,0x2e(%rbp,%riz,2),%ebp
+  803e3a:	0a 
+  803e3b:	00 0f                	add    %cl,(%rdi)
+  803e3d:	1f                   	(bad)
+  803e3e:	40 00 65 72          	add    %spl,0x72(%rbp)
+  803e42:	72 6f                	jb     803eb3 <__rodata_start+0xeb>
+  803e44:	72 20                	jb     803e66 <__rodata_start+0x9e>
+  803e46:	72 65                	jb     803ead <__rodata_start+0xe5>
+  803e48:	61                   	(bad)
+  803e49:	64 69 6e 67 20 64 69 	imul   $0x72696420,%fs:0x67(%rsi),%ebp
+  803e50:	72 
+  803e51:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  803e56:	79 20                	jns    803e78 <__rodata_start+0xb0>
+  803e58:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  803e5d:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  803e63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e65:	77 6e                	ja     803ed5 <__rodata_start+0x10d>
+  803e67:	3e 00 0f             	ds add %cl,(%rdi)
+  803e6a:	1f                   	(bad)
+  803e6b:	80 00 00             	addb   $0x0,(%rax)
+  803e6e:	00 00                	add    %al,(%rax)
+  803e70:	5b                   	pop    %rbx
+  803e71:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803e76:	20 75 73             	and    %dh,0x73(%rbp)
+  803e79:	65 72 20             	gs jb  803e9c <__rodata_start+0xd4>
+  803e7c:	70 61                	jo     803edf <__rodata_start+0x117>
+  803e7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e7f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803e86:	73 20                	jae    803ea8 <__rodata_start+0xe0>
+  803e88:	61                   	(bad)
+  803e89:	74 20                	je     803eab <__rodata_start+0xe3>
+  803e8b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803e90:	3a 20                	cmp    (%rax),%ah
+  803e92:	00 30                	add    %dh,(%rax)
+  803e94:	31 32                	xor    %esi,(%rdx)
+  803e96:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803e9d:	41                   	rex.B
+  803e9e:	42                   	rex.X
+  803e9f:	43                   	rex.XB
+  803ea0:	44                   	rex.R
+  803ea1:	45                   	rex.RB
+  803ea2:	46 00 30             	rex.RX add %r14b,(%rax)
+  803ea5:	31 32                	xor    %esi,(%rdx)
+  803ea7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803eae:	61                   	(bad)
+  803eaf:	62 63 64 65 66       	(bad)
+  803eb4:	00 28                	add    %ch,(%rax)
+  803eb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eb7:	75 6c                	jne    803f25 <__rodata_start+0x15d>
+  803eb9:	6c                   	insb   (%dx),%es:(%rdi)
+  803eba:	29 00                	sub    %eax,(%rax)
+  803ebc:	65 72 72             	gs jb  803f31 <__rodata_start+0x169>
+  803ebf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ec0:	72 20                	jb     803ee2 <__rodata_start+0x11a>
+  803ec2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803ec7:	73 70                	jae    803f39 <__rodata_start+0x171>
+  803ec9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803ecd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803ed4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ed5:	72 00                	jb     803ed7 <__rodata_start+0x10f>
+  803ed7:	62 61 64 20 65       	(bad)
+  803edc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803edd:	76 69                	jbe    803f48 <__rodata_start+0x180>
+  803edf:	72 6f                	jb     803f50 <__rodata_start+0x188>
+  803ee1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ee2:	6d                   	insl   (%dx),%es:(%rdi)
+  803ee3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ee5:	74 00                	je     803ee7 <__rodata_start+0x11f>
+  803ee7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803eee:	20 70 61             	and    %dh,0x61(%rax)
+  803ef1:	72 61                	jb     803f54 <__rodata_start+0x18c>
+  803ef3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ef4:	65 74 65             	gs je  803f5c <__rodata_start+0x194>
+  803ef7:	72 00                	jb     803ef9 <__rodata_start+0x131>
+  803ef9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803efa:	75 74                	jne    803f70 <__rodata_start+0x1a8>
+  803efc:	20 6f 66             	and    %ch,0x66(%rdi)
+  803eff:	20 6d 65             	and    %ch,0x65(%rbp)
+  803f02:	6d                   	insl   (%dx),%es:(%rdi)
+  803f03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f04:	72 79                	jb     803f7f <__rodata_start+0x1b7>
+  803f06:	00 6f 75             	add    %ch,0x75(%rdi)
+  803f09:	74 20                	je     803f2b <__rodata_start+0x163>
+  803f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f0c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803f10:	76 69                	jbe    803f7b <__rodata_start+0x1b3>
+  803f12:	72 6f                	jb     803f83 <__rodata_start+0x1bb>
+  803f14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f15:	6d                   	insl   (%dx),%es:(%rdi)
+  803f16:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f18:	74 73                	je     803f8d <__rodata_start+0x1c5>
+  803f1a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803f1d:	72 72                	jb     803f91 <__rodata_start+0x1c9>
+  803f1f:	75 70                	jne    803f91 <__rodata_start+0x1c9>
+  803f21:	74 65                	je     803f88 <__rodata_start+0x1c0>
+  803f23:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803f28:	75 67                	jne    803f91 <__rodata_start+0x1c9>
+  803f2a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803f2d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f2f:	00 73 65             	add    %dh,0x65(%rbx)
+  803f32:	67 6d                	insl   (%dx),%es:(%edi)
+  803f34:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f36:	74 61                	je     803f99 <__rodata_start+0x1d1>
+  803f38:	74 69                	je     803fa3 <__rodata_start+0x1db>
+  803f3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f3b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f3c:	20 66 61             	and    %ah,0x61(%rsi)
+  803f3f:	75 6c                	jne    803fad <__rodata_start+0x1e5>
+  803f41:	74 00                	je     803f43 <__rodata_start+0x17b>
+  803f43:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803f4a:	20 45 4c             	and    %al,0x4c(%rbp)
+  803f4d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803f51:	61                   	(bad)
+  803f52:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803f57:	20 73 75             	and    %dh,0x75(%rbx)
+  803f5a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803f5d:	73 79                	jae    803fd8 <__rodata_start+0x210>
+  803f5f:	73 74                	jae    803fd5 <__rodata_start+0x20d>
+  803f61:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803f63:	20 63 61             	and    %ah,0x61(%rbx)
+  803f66:	6c                   	insb   (%dx),%es:(%rdi)
+  803f67:	6c                   	insb   (%dx),%es:(%rdi)
+  803f68:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803f6b:	74 72                	je     803fdf <__rodata_start+0x217>
+  803f6d:	79 20                	jns    803f8f <__rodata_start+0x1c7>
+  803f6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f70:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f71:	74 20                	je     803f93 <__rodata_start+0x1cb>
+  803f73:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f75:	75 6e                	jne    803fe5 <__rodata_start+0x21d>
+  803f77:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803f7b:	76 20                	jbe    803f9d <__rodata_start+0x1d5>
+  803f7d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803f84:	72 65                	jb     803feb <__rodata_start+0x223>
+  803f86:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803f89:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f8a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803f8e:	65 78 70             	gs js  804001 <__rodata_start+0x239>
+  803f91:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803f96:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803f99:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803f9d:	20 66 69             	and    %ah,0x69(%rsi)
+  803fa0:	6c                   	insb   (%dx),%es:(%rdi)
+  803fa1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803fa5:	20 66 72             	and    %ah,0x72(%rsi)
+  803fa8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803fad:	61                   	(bad)
+  803fae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803fb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fb3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803fb7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803fba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fbc:	20 6d 61             	and    %ch,0x61(%rbp)
+  803fbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fc0:	79 20                	jns    803fe2 <__rodata_start+0x21a>
+  803fc2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803fc9:	72 65                	jb     804030 <__rodata_start+0x268>
+  803fcb:	20 6f 70             	and    %ch,0x70(%rdi)
+  803fce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803fd0:	00 66 69             	add    %ah,0x69(%rsi)
+  803fd3:	6c                   	insb   (%dx),%es:(%rdi)
+  803fd4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803fd8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803fdb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fdc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803fdf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fe0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fe1:	74 20                	je     804003 <__rodata_start+0x23b>
+  803fe3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803fe5:	75 6e                	jne    804055 <__rodata_start+0x28d>
+  803fe7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803feb:	76 61                	jbe    80404e <__rodata_start+0x286>
+  803fed:	6c                   	insb   (%dx),%es:(%rdi)
+  803fee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ff5:	00 
+  803ff6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803ffd:	72 65                	jb     804064 <__rodata_start+0x29c>
+  803fff:	61                   	(bad)
+  804000:	64 79 20             	fs jns 804023 <__rodata_start+0x25b>
+  804003:	65 78 69             	gs js  80406f <__rodata_start+0x2a7>
+  804006:	73 74                	jae    80407c <__rodata_start+0x2b4>
+  804008:	73 00                	jae    80400a <__rodata_start+0x242>
+  80400a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80400b:	70 65                	jo     804072 <__rodata_start+0x2aa>
+  80400d:	72 61                	jb     804070 <__rodata_start+0x2a8>
+  80400f:	74 69                	je     80407a <__rodata_start+0x2b2>
+  804011:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804012:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804013:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804016:	74 20                	je     804038 <__rodata_start+0x270>
+  804018:	73 75                	jae    80408f <__rodata_start+0x2c7>
+  80401a:	70 70                	jo     80408c <__rodata_start+0x2c4>
+  80401c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80401d:	72 74                	jb     804093 <__rodata_start+0x2cb>
+  80401f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  804025:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80402a:	74 00                	je     80402c <__rodata_start+0x264>
+  80402c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804033:	00 00 00 
+  804036:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80403d:	00 00 00 
+  804040:	67 08 80 00 00 00 00 	or     %al,0x0(%eax)
+  804047:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80404d:	00 00                	add    %al,(%rax)
+  80404f:	00 98 0e 80 00 00    	add    %bl,0x800e(%rax)
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80405d:	00 00                	add    %al,(%rax)
+  80405f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804065:	00 00                	add    %al,(%rax)
+  804067:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80406d:	00 00                	add    %al,(%rax)
+  80406f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804075:	00 00                	add    %al,(%rax)
+  804077:	00 86 08 80 00 00    	add    %al,0x8008(%rsi)
+  80407d:	00 00                	add    %al,(%rax)
+  80407f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804085:	00 00                	add    %al,(%rax)
+  804087:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80408d:	00 00                	add    %al,(%rax)
+  80408f:	00 7a 08             	add    %bh,0x8(%rdx)
+  804092:	80 00 00             	addb   $0x0,(%rax)
+  804095:	00 00                	add    %al,(%rax)
+  804097:	00 f4                	add    %dh,%ah
+  804099:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80409f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 7a 08             	add    %bh,0x8(%rdx)
+  8040aa:	80 00 00             	addb   $0x0,(%rax)
+  8040ad:	00 00                	add    %al,(%rax)
+  8040af:	00 c0                	add    %al,%al
+  8040b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040b7:	00 c0                	add    %al,%al
+  8040b9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040bf:	00 c0                	add    %al,%al
+  8040c1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040c7:	00 c0                	add    %al,%al
+  8040c9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040cf:	00 c0                	add    %al,%al
+  8040d1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040d7:	00 c0                	add    %al,%al
+  8040d9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040df:	00 c0                	add    %al,%al
+  8040e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040e7:	00 c0                	add    %al,%al
+  8040e9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040ef:	00 c0                	add    %al,%al
+  8040f1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8040f7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8040fd:	00 00                	add    %al,(%rax)
+  8040ff:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804105:	00 00                	add    %al,(%rax)
+  804107:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80410d:	00 00                	add    %al,(%rax)
+  80410f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80411d:	00 00                	add    %al,(%rax)
+  80411f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804125:	00 00                	add    %al,(%rax)
+  804127:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804135:	00 00                	add    %al,(%rax)
+  804137:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80413d:	00 00                	add    %al,(%rax)
+  80413f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804155:	00 00                	add    %al,(%rax)
+  804157:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80415d:	00 00                	add    %al,(%rax)
+  80415f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804165:	00 00                	add    %al,(%rax)
+  804167:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80416d:	00 00                	add    %al,(%rax)
+  80416f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804175:	00 00                	add    %al,(%rax)
+  804177:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80417d:	00 00                	add    %al,(%rax)
+  80417f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804185:	00 00                	add    %al,(%rax)
+  804187:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804195:	00 00                	add    %al,(%rax)
+  804197:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80419d:	00 00                	add    %al,(%rax)
+  80419f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041a5:	00 00                	add    %al,(%rax)
+  8041a7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041ad:	00 00                	add    %al,(%rax)
+  8041af:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041b5:	00 00                	add    %al,(%rax)
+  8041b7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041bd:	00 00                	add    %al,(%rax)
+  8041bf:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041c5:	00 00                	add    %al,(%rax)
+  8041c7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041cd:	00 00                	add    %al,(%rax)
+  8041cf:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041d5:	00 00                	add    %al,(%rax)
+  8041d7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041dd:	00 00                	add    %al,(%rax)
+  8041df:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041e5:	00 00                	add    %al,(%rax)
+  8041e7:	00 cb                	add    %cl,%bl
+  8041e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8041ee:	00 00                	add    %al,(%rax)
+  8041f0:	a8 0e                	test   $0xe,%al
+  8041f2:	80 00 00             	addb   $0x0,(%rax)
+  8041f5:	00 00                	add    %al,(%rax)
+  8041f7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8041fd:	00 00                	add    %al,(%rax)
+  8041ff:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804205:	00 00                	add    %al,(%rax)
+  804207:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80420d:	00 00                	add    %al,(%rax)
+  80420f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804215:	00 00                	add    %al,(%rax)
+  804217:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80421d:	00 00                	add    %al,(%rax)
+  80421f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804225:	00 00                	add    %al,(%rax)
+  804227:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80422d:	00 00                	add    %al,(%rax)
+  80422f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804235:	00 00                	add    %al,(%rax)
+  804237:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80423d:	00 00                	add    %al,(%rax)
+  80423f:	00 17                	add    %dl,(%rdi)
+  804241:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804247:	00 e6                	add    %ah,%dh
+  804249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80424f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804255:	00 00                	add    %al,(%rax)
+  804257:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80425d:	00 00                	add    %al,(%rax)
+  80425f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804265:	00 00                	add    %al,(%rax)
+  804267:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80426d:	00 00                	add    %al,(%rax)
+  80426f:	00 46 09             	add    %al,0x9(%rsi)
+  804272:	80 00 00             	addb   $0x0,(%rax)
+  804275:	00 00                	add    %al,(%rax)
+  804277:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80427d:	00 00                	add    %al,(%rax)
+  80427f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804285:	00 00                	add    %al,(%rax)
+  804287:	00 0c 09             	add    %cl,(%rcx,%rcx,1)
+  80428a:	80 00 00             	addb   $0x0,(%rax)
+  80428d:	00 00                	add    %al,(%rax)
+  80428f:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  804295:	00 00                	add    %al,(%rax)
+  804297:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  80429d:	00 00                	add    %al,(%rax)
+  80429f:	00 8e 0c 80 00 00    	add    %cl,0x800c(%rsi)
+  8042a5:	00 00                	add    %al,(%rax)
+  8042a7:	00 58 0d             	add    %bl,0xd(%rax)
+  8042aa:	80 00 00             	addb   $0x0,(%rax)
+  8042ad:	00 00                	add    %al,(%rax)
+  8042af:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8042b5:	00 00                	add    %al,(%rax)
+  8042b7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8042bd:	00 00                	add    %al,(%rax)
+  8042bf:	00 dd                	add    %bl,%ch
+  8042c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8042c7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8042cd:	00 00                	add    %al,(%rax)
+  8042cf:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  8042d5:	00 00                	add    %al,(%rax)
+  8042d7:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8042dd:	00 00                	add    %al,(%rax)
+  8042df:	00 a8 0e 80 00 00    	add    %ch,0x800e(%rax)
+  8042e5:	00 00                	add    %al,(%rax)
+  8042e7:	00 cb                	add    %cl,%bl
+  8042e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8042ee:	00 00                	add    %al,(%rax)
+  8042f0:	a8 0e                	test   $0xe,%al
+  8042f2:	80 00 00             	addb   $0x0,(%rax)
+  8042f5:	00 00                	add    %al,(%rax)
+  8042f7:	00 70 08             	add    %dh,0x8(%rax)
+  8042fa:	80 00 00             	addb   $0x0,(%rax)
+  8042fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804300 <error_string>:
+	...
+  804308:	c5 3e 80 00 00 00 00 00 d7 3e 80 00 00 00 00 00     .>.......>......
+  804318:	e7 3e 80 00 00 00 00 00 f9 3e 80 00 00 00 00 00     .>.......>......
+  804328:	07 3f 80 00 00 00 00 00 1b 3f 80 00 00 00 00 00     .?.......?......
+  804338:	30 3f 80 00 00 00 00 00 43 3f 80 00 00 00 00 00     0?......C?......
+  804348:	55 3f 80 00 00 00 00 00 69 3f 80 00 00 00 00 00     U?......i?......
+  804358:	79 3f 80 00 00 00 00 00 8c 3f 80 00 00 00 00 00     y?.......?......
+  804368:	a3 3f 80 00 00 00 00 00 b9 3f 80 00 00 00 00 00     .?.......?......
+  804378:	d1 3f 80 00 00 00 00 00 e9 3f 80 00 00 00 00 00     .?.......?......
+  804388:	f6 3f 80 00 00 00 00 00 a8 43 80 00 00 00 00 00     .?.......C......
+  804398:	0a 40 80 00 00 00 00 00 22 40 80 00 00 00 00 00     .@......"@......
+  8043a8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8043b8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8043c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8043d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8043e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8043f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804408:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804418:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804428:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804438:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804448:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804458:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804468:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804478:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804488:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804498:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008044a0 <devtab>:
+  8044a0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  8044b0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8044c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8044d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8044e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8044f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804500:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804510:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804520:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804530:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
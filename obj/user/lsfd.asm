@@ -0,0 +1,7577 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  800029:	48 bf d8 3a 80 00 00 	movabs $0x803ad8,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba ec 02 80 00 00 	movabs $0x8002ec,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800066:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80006c:	48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+  800073:	48 8d bd 1c ff ff ff 	lea    -0xe4(%rbp),%rdi
+  80007a:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  800086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  80008c:	48 bb 9a 16 80 00 00 	movabs $0x80169a,%rbx
+  800093:	00 00 00 
+  800096:	48 8d bd 20 ff ff ff 	lea    -0xe0(%rbp),%rdi
+  80009d:	ff d3                	call   *%rbx
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 1b                	js     8000be <umain+0x6c>
+        if (i == '1')
+  8000a3:	83 f8 31             	cmp    $0x31,%eax
+  8000a6:	75 08                	jne    8000b0 <umain+0x5e>
+            usefprint = 1;
+  8000a8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8000ae:	eb e6                	jmp    800096 <umain+0x44>
+        else
+            usage();
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+  8000bc:	eb d8                	jmp    800096 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  8000be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  8000c3:	49 bd e0 1e 80 00 00 	movabs $0x801ee0,%r13
+  8000ca:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000cd:	49 be f0 3a 80 00 00 	movabs $0x803af0,%r14
+  8000d4:	00 00 00 
+  8000d7:	49 bf ec 02 80 00 00 	movabs $0x8002ec,%r15
+  8000de:	00 00 00 
+  8000e1:	eb 2b                	jmp    80010e <umain+0xbc>
+  8000e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000e7:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8000eb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8000ef:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8000f2:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8000f9:	89 de                	mov    %ebx,%esi
+  8000fb:	4c 89 f7             	mov    %r14,%rdi
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  800106:	83 c3 01             	add    $0x1,%ebx
+  800109:	83 fb 20             	cmp    $0x20,%ebx
+  80010c:	74 51                	je     80015f <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  80010e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800115:	89 df                	mov    %ebx,%edi
+  800117:	41 ff d5             	call   *%r13
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 e8                	js     800106 <umain+0xb4>
+            if (usefprint) {
+  80011e:	45 85 e4             	test   %r12d,%r12d
+  800121:	74 c0                	je     8000e3 <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80012b:	ff 70 08             	push   0x8(%rax)
+  80012e:	44 8b 4d c0          	mov    -0x40(%rbp),%r9d
+  800132:	44 8b 45 c4          	mov    -0x3c(%rbp),%r8d
+  800136:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  80013d:	89 da                	mov    %ebx,%edx
+  80013f:	4c 89 f6             	mov    %r14,%rsi
+  800142:	bf 01 00 00 00       	mov    $0x1,%edi
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 ba a5 2e 80 00 00 	movabs $0x802ea5,%r10
+  800153:	00 00 00 
+  800156:	41 ff d2             	call   *%r10
+  800159:	48 83 c4 10          	add    $0x10,%rsp
+  80015d:	eb a7                	jmp    800106 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80015f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800163:	5b                   	pop    %rbx
+  800164:	41 5c                	pop    %r12
+  800166:	41 5d                	pop    %r13
+  800168:	41 5e                	pop    %r14
+  80016a:	41 5f                	pop    %r15
+  80016c:	5d                   	pop    %rbp
+  80016d:	c3                   	ret
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	41 89 fd             	mov    %edi,%r13d
+  80017c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017f:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800186:	00 00 00 
+  800189:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800190:	00 00 00 
+  800193:	48 39 c2             	cmp    %rax,%rdx
+  800196:	73 17                	jae    8001af <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800198:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019b:	49 89 c4             	mov    %rax,%r12
+  80019e:	48 83 c3 08          	add    $0x8,%rbx
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001aa:	4c 39 e3             	cmp    %r12,%rbx
+  8001ad:	72 ef                	jb     80019e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c0:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001c4:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001c8:	48 c1 e0 04          	shl    $0x4,%rax
+  8001cc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001d3:	00 00 00 
+  8001d6:	48 01 d0             	add    %rdx,%rax
+  8001d9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001e0:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001e3:	45 85 ed             	test   %r13d,%r13d
+  8001e6:	7e 0d                	jle    8001f5 <libmain+0x87>
+  8001e8:	49 8b 06             	mov    (%r14),%rax
+  8001eb:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001f2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001f5:	4c 89 f6             	mov    %r14,%rsi
+  8001f8:	44 89 ef             	mov    %r13d,%edi
+  8001fb:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800207:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+#endif
+}
+  800213:	5b                   	pop    %rbx
+  800214:	41 5c                	pop    %r12
+  800216:	41 5d                	pop    %r13
+  800218:	41 5e                	pop    %r14
+  80021a:	5d                   	pop    %rbp
+  80021b:	c3                   	ret
+
+000000000080021c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800220:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80022c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800231:	48 b8 72 11 80 00 00 	movabs $0x801172,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+}
+  80023d:	5d                   	pop    %rbp
+  80023e:	c3                   	ret
+
+000000000080023f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80023f:	55                   	push   %rbp
+  800240:	48 89 e5             	mov    %rsp,%rbp
+  800243:	53                   	push   %rbx
+  800244:	48 83 ec 08          	sub    $0x8,%rsp
+  800248:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80024b:	8b 06                	mov    (%rsi),%eax
+  80024d:	8d 50 01             	lea    0x1(%rax),%edx
+  800250:	89 16                	mov    %edx,(%rsi)
+  800252:	48 98                	cltq
+  800254:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800259:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80025f:	74 0a                	je     80026b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800261:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800265:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800269:	c9                   	leave
+  80026a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80026b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80026f:	be ff 00 00 00       	mov    $0xff,%esi
+  800274:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800280:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800286:	eb d9                	jmp    800261 <putch+0x22>
+
+0000000000800288 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+  80028c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800293:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800296:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80029d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002aa:	48 89 f1             	mov    %rsi,%rcx
+  8002ad:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002b4:	48 bf 3f 02 80 00 00 	movabs $0x80023f,%rdi
+  8002bb:	00 00 00 
+  8002be:	48 b8 3c 04 80 00 00 	movabs $0x80043c,%rax
+  8002c5:	00 00 00 
+  8002c8:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002ca:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002d1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002d8:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  8002df:	00 00 00 
+  8002e2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002e4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ea:	c9                   	leave
+  8002eb:	c3                   	ret
+
+00000000008002ec <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002ec:	55                   	push   %rbp
+  8002ed:	48 89 e5             	mov    %rsp,%rbp
+  8002f0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002f8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002fc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800300:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800304:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800308:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80030f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800313:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800317:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80031b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80031f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800323:	48 b8 88 02 80 00 00 	movabs $0x800288,%rax
+  80032a:	00 00 00 
+  80032d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+0000000000800331 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800331:	55                   	push   %rbp
+  800332:	48 89 e5             	mov    %rsp,%rbp
+  800335:	41 57                	push   %r15
+  800337:	41 56                	push   %r14
+  800339:	41 55                	push   %r13
+  80033b:	41 54                	push   %r12
+  80033d:	53                   	push   %rbx
+  80033e:	48 83 ec 18          	sub    $0x18,%rsp
+  800342:	49 89 fc             	mov    %rdi,%r12
+  800345:	49 89 f5             	mov    %rsi,%r13
+  800348:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80034c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80034f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800352:	41 89 cf             	mov    %ecx,%r15d
+  800355:	4c 39 fa             	cmp    %r15,%rdx
+  800358:	73 5b                	jae    8003b5 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80035a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80035e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800362:	85 db                	test   %ebx,%ebx
+  800364:	7e 0e                	jle    800374 <print_num+0x43>
+            putch(padc, put_arg);
+  800366:	4c 89 ee             	mov    %r13,%rsi
+  800369:	44 89 f7             	mov    %r14d,%edi
+  80036c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80036f:	83 eb 01             	sub    $0x1,%ebx
+  800372:	75 f2                	jne    800366 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800374:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800378:	48 b9 33 3b 80 00 00 	movabs $0x803b33,%rcx
+  80037f:	00 00 00 
+  800382:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  800389:	00 00 00 
+  80038c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800390:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800394:	ba 00 00 00 00       	mov    $0x0,%edx
+  800399:	49 f7 f7             	div    %r15
+  80039c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003a0:	4c 89 ee             	mov    %r13,%rsi
+  8003a3:	41 ff d4             	call   *%r12
+}
+  8003a6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003aa:	5b                   	pop    %rbx
+  8003ab:	41 5c                	pop    %r12
+  8003ad:	41 5d                	pop    %r13
+  8003af:	41 5e                	pop    %r14
+  8003b1:	41 5f                	pop    %r15
+  8003b3:	5d                   	pop    %rbp
+  8003b4:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003be:	49 f7 f7             	div    %r15
+  8003c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c5:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003c9:	52                   	push   %rdx
+  8003ca:	45 0f be c9          	movsbl %r9b,%r9d
+  8003ce:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003d2:	48 89 c2             	mov    %rax,%rdx
+  8003d5:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	48 83 c4 10          	add    $0x10,%rsp
+  8003e5:	eb 8d                	jmp    800374 <print_num+0x43>
+
+00000000008003e7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003e7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003eb:	48 8b 06             	mov    (%rsi),%rax
+  8003ee:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003f2:	73 0a                	jae    8003fe <sprintputch+0x17>
+        *state->start++ = ch;
+  8003f4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003f8:	48 89 16             	mov    %rdx,(%rsi)
+  8003fb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003fe:	c3                   	ret
+
+00000000008003ff <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003ff:	55                   	push   %rbp
+  800400:	48 89 e5             	mov    %rsp,%rbp
+  800403:	48 83 ec 50          	sub    $0x50,%rsp
+  800407:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80040b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80040f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800413:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80041a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80041e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800422:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800426:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80042a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80042e:	48 b8 3c 04 80 00 00 	movabs $0x80043c,%rax
+  800435:	00 00 00 
+  800438:	ff d0                	call   *%rax
+}
+  80043a:	c9                   	leave
+  80043b:	c3                   	ret
+
+000000000080043c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+  800440:	41 57                	push   %r15
+  800442:	41 56                	push   %r14
+  800444:	41 55                	push   %r13
+  800446:	41 54                	push   %r12
+  800448:	53                   	push   %rbx
+  800449:	48 83 ec 38          	sub    $0x38,%rsp
+  80044d:	49 89 fe             	mov    %rdi,%r14
+  800450:	49 89 f5             	mov    %rsi,%r13
+  800453:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800456:	48 8b 01             	mov    (%rcx),%rax
+  800459:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80045d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800461:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800465:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800469:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80046d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800471:	0f b6 3b             	movzbl (%rbx),%edi
+  800474:	40 80 ff 25          	cmp    $0x25,%dil
+  800478:	74 18                	je     800492 <vprintfmt+0x56>
+            if (!ch) return;
+  80047a:	40 84 ff             	test   %dil,%dil
+  80047d:	0f 84 b1 06 00 00    	je     800b34 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800483:	40 0f b6 ff          	movzbl %dil,%edi
+  800487:	4c 89 ee             	mov    %r13,%rsi
+  80048a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80048d:	4c 89 e3             	mov    %r12,%rbx
+  800490:	eb db                	jmp    80046d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800492:	be 00 00 00 00       	mov    $0x0,%esi
+  800497:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80049b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004a0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004a6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ad:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b1:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004b6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004bb:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004be:	83 e8 23             	sub    $0x23,%eax
+  8004c1:	3c 57                	cmp    $0x57,%al
+  8004c3:	0f 87 51 06 00 00    	ja     800b1a <vprintfmt+0x6de>
+  8004c9:	0f b6 c0             	movzbl %al,%eax
+  8004cc:	48 b9 c0 3c 80 00 00 	movabs $0x803cc0,%rcx
+  8004d3:	00 00 00 
+  8004d6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004d9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004dc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004e0:	eb cf                	jmp    8004b1 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004e2:	49 89 dc             	mov    %rbx,%r12
+  8004e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ea:	eb c5                	jmp    8004b1 <vprintfmt+0x75>
+            padc = ch;
+  8004ec:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004f0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f6:	eb b9                	jmp    8004b1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8004fe:	77 24                	ja     800524 <vprintfmt+0xe8>
+  800500:	89 c1                	mov    %eax,%ecx
+  800502:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800506:	83 c0 08             	add    $0x8,%eax
+  800509:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80050c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80050f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800512:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800516:	79 99                	jns    8004b1 <vprintfmt+0x75>
+                width = precision;
+  800518:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80051c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800522:	eb 8d                	jmp    8004b1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800524:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800528:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80052c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800530:	eb da                	jmp    80050c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800532:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800537:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80053b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800541:	3c 39                	cmp    $0x39,%al
+  800543:	77 1c                	ja     800561 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800545:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800549:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80054d:	0f b6 c0             	movzbl %al,%eax
+  800550:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800555:	0f b6 03             	movzbl (%rbx),%eax
+  800558:	3c 39                	cmp    $0x39,%al
+  80055a:	76 e9                	jbe    800545 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80055c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80055f:	eb b1                	jmp    800512 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800561:	49 89 dc             	mov    %rbx,%r12
+  800564:	eb ac                	jmp    800512 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800566:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800569:	85 c9                	test   %ecx,%ecx
+  80056b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800570:	0f 49 c1             	cmovns %ecx,%eax
+  800573:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800576:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800579:	e9 33 ff ff ff       	jmp    8004b1 <vprintfmt+0x75>
+            lflag++;
+  80057e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800581:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800584:	e9 28 ff ff ff       	jmp    8004b1 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800589:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80058c:	83 f8 2f             	cmp    $0x2f,%eax
+  80058f:	77 19                	ja     8005aa <vprintfmt+0x16e>
+  800591:	89 c2                	mov    %eax,%edx
+  800593:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800597:	83 c0 08             	add    $0x8,%eax
+  80059a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80059d:	8b 3a                	mov    (%rdx),%edi
+  80059f:	4c 89 ee             	mov    %r13,%rsi
+  8005a2:	41 ff d6             	call   *%r14
+            break;
+  8005a5:	e9 c3 fe ff ff       	jmp    80046d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b6:	eb e5                	jmp    80059d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005be:	77 5a                	ja     80061a <vprintfmt+0x1de>
+  8005c0:	89 c2                	mov    %eax,%edx
+  8005c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005c6:	83 c0 08             	add    $0x8,%eax
+  8005c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005cc:	8b 02                	mov    (%rdx),%eax
+  8005ce:	89 c1                	mov    %eax,%ecx
+  8005d0:	f7 d9                	neg    %ecx
+  8005d2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005d5:	83 f9 14             	cmp    $0x14,%ecx
+  8005d8:	7f 4e                	jg     800628 <vprintfmt+0x1ec>
+  8005da:	48 63 c1             	movslq %ecx,%rax
+  8005dd:	48 ba 80 3f 80 00 00 	movabs $0x803f80,%rdx
+  8005e4:	00 00 00 
+  8005e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005eb:	48 85 c0             	test   %rax,%rax
+  8005ee:	74 38                	je     800628 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005f0:	48 89 c1             	mov    %rax,%rcx
+  8005f3:	48 ba 59 41 80 00 00 	movabs $0x804159,%rdx
+  8005fa:	00 00 00 
+  8005fd:	4c 89 ee             	mov    %r13,%rsi
+  800600:	4c 89 f7             	mov    %r14,%rdi
+  800603:	b8 00 00 00 00       	mov    $0x0,%eax
+  800608:	49 b8 ff 03 80 00 00 	movabs $0x8003ff,%r8
+  80060f:	00 00 00 
+  800612:	41 ff d0             	call   *%r8
+  800615:	e9 53 fe ff ff       	jmp    80046d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80061a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80061e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800622:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800626:	eb a4                	jmp    8005cc <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800628:	48 ba 4b 3b 80 00 00 	movabs $0x803b4b,%rdx
+  80062f:	00 00 00 
+  800632:	4c 89 ee             	mov    %r13,%rsi
+  800635:	4c 89 f7             	mov    %r14,%rdi
+  800638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063d:	49 b8 ff 03 80 00 00 	movabs $0x8003ff,%r8
+  800644:	00 00 00 
+  800647:	41 ff d0             	call   *%r8
+  80064a:	e9 1e fe ff ff       	jmp    80046d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80064f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800652:	83 f8 2f             	cmp    $0x2f,%eax
+  800655:	77 6c                	ja     8006c3 <vprintfmt+0x287>
+  800657:	89 c2                	mov    %eax,%edx
+  800659:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065d:	83 c0 08             	add    $0x8,%eax
+  800660:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800663:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800666:	48 85 d2             	test   %rdx,%rdx
+  800669:	48 b8 44 3b 80 00 00 	movabs $0x803b44,%rax
+  800670:	00 00 00 
+  800673:	48 0f 45 c2          	cmovne %rdx,%rax
+  800677:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80067b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80067f:	7e 06                	jle    800687 <vprintfmt+0x24b>
+  800681:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800685:	75 4a                	jne    8006d1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800687:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80068b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80068f:	0f b6 00             	movzbl (%rax),%eax
+  800692:	84 c0                	test   %al,%al
+  800694:	0f 85 9a 00 00 00    	jne    800734 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80069a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80069d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006a1:	85 c0                	test   %eax,%eax
+  8006a3:	0f 8e c4 fd ff ff    	jle    80046d <vprintfmt+0x31>
+  8006a9:	4c 89 ee             	mov    %r13,%rsi
+  8006ac:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006b1:	41 ff d6             	call   *%r14
+  8006b4:	41 83 ec 01          	sub    $0x1,%r12d
+  8006b8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006bc:	75 eb                	jne    8006a9 <vprintfmt+0x26d>
+  8006be:	e9 aa fd ff ff       	jmp    80046d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cf:	eb 92                	jmp    800663 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006d1:	49 63 f7             	movslq %r15d,%rsi
+  8006d4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006d8:	48 b8 ee 0b 80 00 00 	movabs $0x800bee,%rax
+  8006df:	00 00 00 
+  8006e2:	ff d0                	call   *%rax
+  8006e4:	48 89 c2             	mov    %rax,%rdx
+  8006e7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ea:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006ec:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006ef:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006f2:	85 c0                	test   %eax,%eax
+  8006f4:	7e 91                	jle    800687 <vprintfmt+0x24b>
+  8006f6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006fb:	4c 89 ee             	mov    %r13,%rsi
+  8006fe:	44 89 e7             	mov    %r12d,%edi
+  800701:	41 ff d6             	call   *%r14
+  800704:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800708:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80070b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80070e:	75 eb                	jne    8006fb <vprintfmt+0x2bf>
+  800710:	e9 72 ff ff ff       	jmp    800687 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800715:	0f b6 f8             	movzbl %al,%edi
+  800718:	4c 89 ee             	mov    %r13,%rsi
+  80071b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80071e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800722:	49 83 c4 01          	add    $0x1,%r12
+  800726:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80072c:	84 c0                	test   %al,%al
+  80072e:	0f 84 66 ff ff ff    	je     80069a <vprintfmt+0x25e>
+  800734:	45 85 ff             	test   %r15d,%r15d
+  800737:	78 0a                	js     800743 <vprintfmt+0x307>
+  800739:	41 83 ef 01          	sub    $0x1,%r15d
+  80073d:	0f 88 57 ff ff ff    	js     80069a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800743:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800747:	74 cc                	je     800715 <vprintfmt+0x2d9>
+  800749:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80074c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800751:	80 fa 5e             	cmp    $0x5e,%dl
+  800754:	77 c2                	ja     800718 <vprintfmt+0x2dc>
+  800756:	eb bd                	jmp    800715 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800758:	40 84 f6             	test   %sil,%sil
+  80075b:	75 26                	jne    800783 <vprintfmt+0x347>
+    switch (lflag) {
+  80075d:	85 d2                	test   %edx,%edx
+  80075f:	74 59                	je     8007ba <vprintfmt+0x37e>
+  800761:	83 fa 01             	cmp    $0x1,%edx
+  800764:	74 7b                	je     8007e1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800766:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800769:	83 f8 2f             	cmp    $0x2f,%eax
+  80076c:	0f 87 96 00 00 00    	ja     800808 <vprintfmt+0x3cc>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	4c 8b 22             	mov    (%rdx),%r12
+  800781:	eb 17                	jmp    80079a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800783:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800786:	83 f8 2f             	cmp    $0x2f,%eax
+  800789:	77 21                	ja     8007ac <vprintfmt+0x370>
+  80078b:	89 c2                	mov    %eax,%edx
+  80078d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800791:	83 c0 08             	add    $0x8,%eax
+  800794:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800797:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80079a:	4d 85 e4             	test   %r12,%r12
+  80079d:	78 7a                	js     800819 <vprintfmt+0x3dd>
+            num = i;
+  80079f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007a2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007a7:	e9 50 02 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b8:	eb dd                	jmp    800797 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 11                	ja     8007d3 <vprintfmt+0x397>
+  8007c2:	89 c2                	mov    %eax,%edx
+  8007c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c8:	83 c0 08             	add    $0x8,%eax
+  8007cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ce:	4c 63 22             	movslq (%rdx),%r12
+  8007d1:	eb c7                	jmp    80079a <vprintfmt+0x35e>
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb ed                	jmp    8007ce <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e7:	77 11                	ja     8007fa <vprintfmt+0x3be>
+  8007e9:	89 c2                	mov    %eax,%edx
+  8007eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ef:	83 c0 08             	add    $0x8,%eax
+  8007f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f5:	4c 8b 22             	mov    (%rdx),%r12
+  8007f8:	eb a0                	jmp    80079a <vprintfmt+0x35e>
+  8007fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800802:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800806:	eb ed                	jmp    8007f5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800808:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800810:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800814:	e9 65 ff ff ff       	jmp    80077e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800819:	4c 89 ee             	mov    %r13,%rsi
+  80081c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800821:	41 ff d6             	call   *%r14
+                i = -i;
+  800824:	49 f7 dc             	neg    %r12
+  800827:	e9 73 ff ff ff       	jmp    80079f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	40 84 f6             	test   %sil,%sil
+  80082f:	75 32                	jne    800863 <vprintfmt+0x427>
+    switch (lflag) {
+  800831:	85 d2                	test   %edx,%edx
+  800833:	74 5d                	je     800892 <vprintfmt+0x456>
+  800835:	83 fa 01             	cmp    $0x1,%edx
+  800838:	0f 84 82 00 00 00    	je     8008c0 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80083e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800841:	83 f8 2f             	cmp    $0x2f,%eax
+  800844:	0f 87 a5 00 00 00    	ja     8008ef <vprintfmt+0x4b3>
+  80084a:	89 c2                	mov    %eax,%edx
+  80084c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800850:	83 c0 08             	add    $0x8,%eax
+  800853:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800856:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800859:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80085e:	e9 99 01 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800863:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800866:	83 f8 2f             	cmp    $0x2f,%eax
+  800869:	77 19                	ja     800884 <vprintfmt+0x448>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800871:	83 c0 08             	add    $0x8,%eax
+  800874:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800877:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80087a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80087f:	e9 78 01 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+  800884:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800888:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800890:	eb e5                	jmp    800877 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800892:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800895:	83 f8 2f             	cmp    $0x2f,%eax
+  800898:	77 18                	ja     8008b2 <vprintfmt+0x476>
+  80089a:	89 c2                	mov    %eax,%edx
+  80089c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a0:	83 c0 08             	add    $0x8,%eax
+  8008a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ad:	e9 4a 01 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+  8008b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008be:	eb e6                	jmp    8008a6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	77 19                	ja     8008e1 <vprintfmt+0x4a5>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ce:	83 c0 08             	add    $0x8,%eax
+  8008d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008dc:	e9 1b 01 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+  8008e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ed:	eb e5                	jmp    8008d4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	e9 56 ff ff ff       	jmp    800856 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800900:	40 84 f6             	test   %sil,%sil
+  800903:	75 2e                	jne    800933 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800905:	85 d2                	test   %edx,%edx
+  800907:	74 59                	je     800962 <vprintfmt+0x526>
+  800909:	83 fa 01             	cmp    $0x1,%edx
+  80090c:	74 7f                	je     80098d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80090e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800911:	83 f8 2f             	cmp    $0x2f,%eax
+  800914:	0f 87 9f 00 00 00    	ja     8009b9 <vprintfmt+0x57d>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800920:	83 c0 08             	add    $0x8,%eax
+  800923:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800926:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800929:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80092e:	e9 c9 00 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800933:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800936:	83 f8 2f             	cmp    $0x2f,%eax
+  800939:	77 19                	ja     800954 <vprintfmt+0x518>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80094a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80094f:	e9 a8 00 00 00       	jmp    8009fc <vprintfmt+0x5c0>
+  800954:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800958:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800960:	eb e5                	jmp    800947 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800962:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800965:	83 f8 2f             	cmp    $0x2f,%eax
+  800968:	77 15                	ja     80097f <vprintfmt+0x543>
+  80096a:	89 c2                	mov    %eax,%edx
+  80096c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800970:	83 c0 08             	add    $0x8,%eax
+  800973:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800976:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800978:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80097d:	eb 7d                	jmp    8009fc <vprintfmt+0x5c0>
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb e9                	jmp    800976 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	77 16                	ja     8009ab <vprintfmt+0x56f>
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099b:	83 c0 08             	add    $0x8,%eax
+  80099e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009a4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009a9:	eb 51                	jmp    8009fc <vprintfmt+0x5c0>
+  8009ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b7:	eb e8                	jmp    8009a1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	e9 5c ff ff ff       	jmp    800926 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009ca:	4c 89 ee             	mov    %r13,%rsi
+  8009cd:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009d2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009d5:	4c 89 ee             	mov    %r13,%rsi
+  8009d8:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009dd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e6:	77 47                	ja     800a2f <vprintfmt+0x5f3>
+  8009e8:	89 c2                	mov    %eax,%edx
+  8009ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ee:	83 c0 08             	add    $0x8,%eax
+  8009f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800a00:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a04:	0f 94 c0             	sete   %al
+  800a07:	0f b6 c0             	movzbl %al,%eax
+  800a0a:	50                   	push   %rax
+  800a0b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a10:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a14:	4c 89 ee             	mov    %r13,%rsi
+  800a17:	4c 89 f7             	mov    %r14,%rdi
+  800a1a:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  800a21:	00 00 00 
+  800a24:	ff d0                	call   *%rax
+            break;
+  800a26:	48 83 c4 10          	add    $0x10,%rsp
+  800a2a:	e9 3e fa ff ff       	jmp    80046d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	eb b7                	jmp    8009f4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3d:	40 84 f6             	test   %sil,%sil
+  800a40:	75 2b                	jne    800a6d <vprintfmt+0x631>
+    switch (lflag) {
+  800a42:	85 d2                	test   %edx,%edx
+  800a44:	74 56                	je     800a9c <vprintfmt+0x660>
+  800a46:	83 fa 01             	cmp    $0x1,%edx
+  800a49:	74 7f                	je     800aca <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	0f 87 a2 00 00 00    	ja     800af9 <vprintfmt+0x6bd>
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5d:	83 c0 08             	add    $0x8,%eax
+  800a60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6b:	eb 8f                	jmp    8009fc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 19                	ja     800a8e <vprintfmt+0x652>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a84:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a89:	e9 6e ff ff ff       	jmp    8009fc <vprintfmt+0x5c0>
+  800a8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9a:	eb e5                	jmp    800a81 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 18                	ja     800abc <vprintfmt+0x680>
+  800aa4:	89 c2                	mov    %eax,%edx
+  800aa6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaa:	83 c0 08             	add    $0x8,%eax
+  800aad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ab2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ab7:	e9 40 ff ff ff       	jmp    8009fc <vprintfmt+0x5c0>
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb e6                	jmp    800ab0 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 19                	ja     800aeb <vprintfmt+0x6af>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae6:	e9 11 ff ff ff       	jmp    8009fc <vprintfmt+0x5c0>
+  800aeb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af7:	eb e5                	jmp    800ade <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b05:	e9 59 ff ff ff       	jmp    800a63 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b0a:	4c 89 ee             	mov    %r13,%rsi
+  800b0d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b12:	41 ff d6             	call   *%r14
+            break;
+  800b15:	e9 53 f9 ff ff       	jmp    80046d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b1a:	4c 89 ee             	mov    %r13,%rsi
+  800b1d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b22:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b25:	48 83 eb 01          	sub    $0x1,%rbx
+  800b29:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b2d:	75 f6                	jne    800b25 <vprintfmt+0x6e9>
+  800b2f:	e9 39 f9 ff ff       	jmp    80046d <vprintfmt+0x31>
+}
+  800b34:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b38:	5b                   	pop    %rbx
+  800b39:	41 5c                	pop    %r12
+  800b3b:	41 5d                	pop    %r13
+  800b3d:	41 5e                	pop    %r14
+  800b3f:	41 5f                	pop    %r15
+  800b41:	5d                   	pop    %rbp
+  800b42:	c3                   	ret
+
+0000000000800b43 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b43:	55                   	push   %rbp
+  800b44:	48 89 e5             	mov    %rsp,%rbp
+  800b47:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b4b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b4f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b58:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b5f:	48 85 ff             	test   %rdi,%rdi
+  800b62:	74 2b                	je     800b8f <vsnprintf+0x4c>
+  800b64:	48 85 f6             	test   %rsi,%rsi
+  800b67:	74 26                	je     800b8f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b69:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b6d:	48 bf e7 03 80 00 00 	movabs $0x8003e7,%rdi
+  800b74:	00 00 00 
+  800b77:	48 b8 3c 04 80 00 00 	movabs $0x80043c,%rax
+  800b7e:	00 00 00 
+  800b81:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b87:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b8a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b94:	eb f7                	jmp    800b8d <vsnprintf+0x4a>
+
+0000000000800b96 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b96:	55                   	push   %rbp
+  800b97:	48 89 e5             	mov    %rsp,%rbp
+  800b9a:	48 83 ec 50          	sub    $0x50,%rsp
+  800b9e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ba2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ba6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800baa:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bb1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bbd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bc1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bc5:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  800bcc:	00 00 00 
+  800bcf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bd1:	c9                   	leave
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bd3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bd6:	74 10                	je     800be8 <strlen+0x15>
+    size_t n = 0;
+  800bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bdd:	48 83 c0 01          	add    $0x1,%rax
+  800be1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800be5:	75 f6                	jne    800bdd <strlen+0xa>
+  800be7:	c3                   	ret
+    size_t n = 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bed:	c3                   	ret
+
+0000000000800bee <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bee:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bf6:	48 85 f6             	test   %rsi,%rsi
+  800bf9:	74 11                	je     800c0c <strnlen+0x1e>
+  800bfb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bff:	74 0c                	je     800c0d <strnlen+0x1f>
+  800c01:	48 83 c2 01          	add    $0x1,%rdx
+  800c05:	48 39 d0             	cmp    %rdx,%rax
+  800c08:	75 f1                	jne    800bfb <strnlen+0xd>
+  800c0a:	eb 04                	jmp    800c10 <strnlen+0x22>
+  800c0c:	c3                   	ret
+  800c0d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c10:	c3                   	ret
+
+0000000000800c11 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c11:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c19:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c1d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c20:	48 83 c2 01          	add    $0x1,%rdx
+  800c24:	84 c9                	test   %cl,%cl
+  800c26:	75 f1                	jne    800c19 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c28:	c3                   	ret
+
+0000000000800c29 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c29:	55                   	push   %rbp
+  800c2a:	48 89 e5             	mov    %rsp,%rbp
+  800c2d:	41 54                	push   %r12
+  800c2f:	53                   	push   %rbx
+  800c30:	48 89 fb             	mov    %rdi,%rbx
+  800c33:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c36:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800c3d:	00 00 00 
+  800c40:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c42:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c46:	4c 89 e6             	mov    %r12,%rsi
+  800c49:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  800c50:	00 00 00 
+  800c53:	ff d0                	call   *%rax
+    return dst;
+}
+  800c55:	48 89 d8             	mov    %rbx,%rax
+  800c58:	5b                   	pop    %rbx
+  800c59:	41 5c                	pop    %r12
+  800c5b:	5d                   	pop    %rbp
+  800c5c:	c3                   	ret
+
+0000000000800c5d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c5d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c60:	48 85 d2             	test   %rdx,%rdx
+  800c63:	74 1f                	je     800c84 <strncpy+0x27>
+  800c65:	48 01 fa             	add    %rdi,%rdx
+  800c68:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c6b:	48 83 c1 01          	add    $0x1,%rcx
+  800c6f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c73:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c77:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c7b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c7f:	48 39 ca             	cmp    %rcx,%rdx
+  800c82:	75 e7                	jne    800c6b <strncpy+0xe>
+    }
+    return ret;
+}
+  800c84:	c3                   	ret
+
+0000000000800c85 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c85:	48 89 f8             	mov    %rdi,%rax
+  800c88:	48 85 d2             	test   %rdx,%rdx
+  800c8b:	74 24                	je     800cb1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c8d:	48 83 ea 01          	sub    $0x1,%rdx
+  800c91:	74 1b                	je     800cae <strlcpy+0x29>
+  800c93:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c97:	0f b6 16             	movzbl (%rsi),%edx
+  800c9a:	84 d2                	test   %dl,%dl
+  800c9c:	74 10                	je     800cae <strlcpy+0x29>
+            *dst++ = *src++;
+  800c9e:	48 83 c6 01          	add    $0x1,%rsi
+  800ca2:	48 83 c0 01          	add    $0x1,%rax
+  800ca6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ca9:	48 39 c8             	cmp    %rcx,%rax
+  800cac:	75 e9                	jne    800c97 <strlcpy+0x12>
+        *dst = '\0';
+  800cae:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cb1:	48 29 f8             	sub    %rdi,%rax
+}
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cb5:	0f b6 07             	movzbl (%rdi),%eax
+  800cb8:	84 c0                	test   %al,%al
+  800cba:	74 13                	je     800ccf <strcmp+0x1a>
+  800cbc:	38 06                	cmp    %al,(%rsi)
+  800cbe:	75 0f                	jne    800ccf <strcmp+0x1a>
+  800cc0:	48 83 c7 01          	add    $0x1,%rdi
+  800cc4:	48 83 c6 01          	add    $0x1,%rsi
+  800cc8:	0f b6 07             	movzbl (%rdi),%eax
+  800ccb:	84 c0                	test   %al,%al
+  800ccd:	75 ed                	jne    800cbc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ccf:	0f b6 c0             	movzbl %al,%eax
+  800cd2:	0f b6 16             	movzbl (%rsi),%edx
+  800cd5:	29 d0                	sub    %edx,%eax
+}
+  800cd7:	c3                   	ret
+
+0000000000800cd8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cd8:	48 85 d2             	test   %rdx,%rdx
+  800cdb:	74 1f                	je     800cfc <strncmp+0x24>
+  800cdd:	0f b6 07             	movzbl (%rdi),%eax
+  800ce0:	84 c0                	test   %al,%al
+  800ce2:	74 1e                	je     800d02 <strncmp+0x2a>
+  800ce4:	3a 06                	cmp    (%rsi),%al
+  800ce6:	75 1a                	jne    800d02 <strncmp+0x2a>
+  800ce8:	48 83 c7 01          	add    $0x1,%rdi
+  800cec:	48 83 c6 01          	add    $0x1,%rsi
+  800cf0:	48 83 ea 01          	sub    $0x1,%rdx
+  800cf4:	75 e7                	jne    800cdd <strncmp+0x5>
+
+    if (!n) return 0;
+  800cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfb:	c3                   	ret
+  800cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d01:	c3                   	ret
+  800d02:	48 85 d2             	test   %rdx,%rdx
+  800d05:	74 09                	je     800d10 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d07:	0f b6 07             	movzbl (%rdi),%eax
+  800d0a:	0f b6 16             	movzbl (%rsi),%edx
+  800d0d:	29 d0                	sub    %edx,%eax
+  800d0f:	c3                   	ret
+    if (!n) return 0;
+  800d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d15:	c3                   	ret
+
+0000000000800d16 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d16:	0f b6 17             	movzbl (%rdi),%edx
+  800d19:	84 d2                	test   %dl,%dl
+  800d1b:	74 18                	je     800d35 <strchr+0x1f>
+        if (*str == c) {
+  800d1d:	0f be d2             	movsbl %dl,%edx
+  800d20:	39 f2                	cmp    %esi,%edx
+  800d22:	74 17                	je     800d3b <strchr+0x25>
+    for (; *str; str++) {
+  800d24:	48 83 c7 01          	add    $0x1,%rdi
+  800d28:	0f b6 17             	movzbl (%rdi),%edx
+  800d2b:	84 d2                	test   %dl,%dl
+  800d2d:	75 ee                	jne    800d1d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	c3                   	ret
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3a:	c3                   	ret
+  800d3b:	48 89 f8             	mov    %rdi,%rax
+}
+  800d3e:	c3                   	ret
+
+0000000000800d3f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d3f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d42:	0f b6 17             	movzbl (%rdi),%edx
+  800d45:	84 d2                	test   %dl,%dl
+  800d47:	74 13                	je     800d5c <strfind+0x1d>
+  800d49:	0f be d2             	movsbl %dl,%edx
+  800d4c:	39 f2                	cmp    %esi,%edx
+  800d4e:	74 0b                	je     800d5b <strfind+0x1c>
+  800d50:	48 83 c0 01          	add    $0x1,%rax
+  800d54:	0f b6 10             	movzbl (%rax),%edx
+  800d57:	84 d2                	test   %dl,%dl
+  800d59:	75 ee                	jne    800d49 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d5b:	c3                   	ret
+  800d5c:	c3                   	ret
+
+0000000000800d5d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d5d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d60:	48 89 f8             	mov    %rdi,%rax
+  800d63:	48 f7 d8             	neg    %rax
+  800d66:	83 e0 07             	and    $0x7,%eax
+  800d69:	49 89 d1             	mov    %rdx,%r9
+  800d6c:	49 29 c1             	sub    %rax,%r9
+  800d6f:	78 36                	js     800da7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d71:	40 0f b6 c6          	movzbl %sil,%eax
+  800d75:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d7c:	01 01 01 
+  800d7f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d83:	40 f6 c7 07          	test   $0x7,%dil
+  800d87:	75 38                	jne    800dc1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d89:	4c 89 c9             	mov    %r9,%rcx
+  800d8c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d90:	74 0c                	je     800d9e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d92:	fc                   	cld
+  800d93:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d96:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d9a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d9e:	4d 85 c9             	test   %r9,%r9
+  800da1:	75 45                	jne    800de8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800da3:	4c 89 c0             	mov    %r8,%rax
+  800da6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800da7:	48 85 d2             	test   %rdx,%rdx
+  800daa:	74 f7                	je     800da3 <memset+0x46>
+  800dac:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800daf:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800db2:	48 83 c0 01          	add    $0x1,%rax
+  800db6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dba:	48 39 c2             	cmp    %rax,%rdx
+  800dbd:	75 f3                	jne    800db2 <memset+0x55>
+  800dbf:	eb e2                	jmp    800da3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dc1:	40 f6 c7 01          	test   $0x1,%dil
+  800dc5:	74 06                	je     800dcd <memset+0x70>
+  800dc7:	88 07                	mov    %al,(%rdi)
+  800dc9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dcd:	40 f6 c7 02          	test   $0x2,%dil
+  800dd1:	74 07                	je     800dda <memset+0x7d>
+  800dd3:	66 89 07             	mov    %ax,(%rdi)
+  800dd6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dda:	40 f6 c7 04          	test   $0x4,%dil
+  800dde:	74 a9                	je     800d89 <memset+0x2c>
+  800de0:	89 07                	mov    %eax,(%rdi)
+  800de2:	48 83 c7 04          	add    $0x4,%rdi
+  800de6:	eb a1                	jmp    800d89 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800de8:	41 f6 c1 04          	test   $0x4,%r9b
+  800dec:	74 06                	je     800df4 <memset+0x97>
+  800dee:	89 07                	mov    %eax,(%rdi)
+  800df0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800df4:	41 f6 c1 02          	test   $0x2,%r9b
+  800df8:	74 07                	je     800e01 <memset+0xa4>
+  800dfa:	66 89 07             	mov    %ax,(%rdi)
+  800dfd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e01:	41 f6 c1 01          	test   $0x1,%r9b
+  800e05:	74 9c                	je     800da3 <memset+0x46>
+  800e07:	88 07                	mov    %al,(%rdi)
+  800e09:	eb 98                	jmp    800da3 <memset+0x46>
+
+0000000000800e0b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e0b:	48 89 f8             	mov    %rdi,%rax
+  800e0e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e11:	48 39 fe             	cmp    %rdi,%rsi
+  800e14:	73 3b                	jae    800e51 <memmove+0x46>
+  800e16:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e1a:	48 39 d7             	cmp    %rdx,%rdi
+  800e1d:	73 32                	jae    800e51 <memmove+0x46>
+        s += n;
+        d += n;
+  800e1f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e23:	48 89 d6             	mov    %rdx,%rsi
+  800e26:	48 09 fe             	or     %rdi,%rsi
+  800e29:	48 09 ce             	or     %rcx,%rsi
+  800e2c:	40 f6 c6 07          	test   $0x7,%sil
+  800e30:	75 12                	jne    800e44 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e32:	48 83 ef 08          	sub    $0x8,%rdi
+  800e36:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e3a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e3e:	fd                   	std
+  800e3f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e42:	fc                   	cld
+  800e43:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e44:	48 83 ef 01          	sub    $0x1,%rdi
+  800e48:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e4c:	fd                   	std
+  800e4d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e4f:	eb f1                	jmp    800e42 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e51:	48 89 f2             	mov    %rsi,%rdx
+  800e54:	48 09 c2             	or     %rax,%rdx
+  800e57:	48 09 ca             	or     %rcx,%rdx
+  800e5a:	f6 c2 07             	test   $0x7,%dl
+  800e5d:	75 0c                	jne    800e6b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e5f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e63:	48 89 c7             	mov    %rax,%rdi
+  800e66:	fc                   	cld
+  800e67:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e6a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e6b:	48 89 c7             	mov    %rax,%rdi
+  800e6e:	fc                   	cld
+  800e6f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e71:	c3                   	ret
+
+0000000000800e72 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e72:	55                   	push   %rbp
+  800e73:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e76:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  800e7d:	00 00 00 
+  800e80:	ff d0                	call   *%rax
+}
+  800e82:	5d                   	pop    %rbp
+  800e83:	c3                   	ret
+
+0000000000800e84 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+  800e88:	41 57                	push   %r15
+  800e8a:	41 56                	push   %r14
+  800e8c:	41 55                	push   %r13
+  800e8e:	41 54                	push   %r12
+  800e90:	53                   	push   %rbx
+  800e91:	48 83 ec 08          	sub    $0x8,%rsp
+  800e95:	49 89 fe             	mov    %rdi,%r14
+  800e98:	49 89 f7             	mov    %rsi,%r15
+  800e9b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e9e:	48 89 f7             	mov    %rsi,%rdi
+  800ea1:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+  800ead:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800eb0:	48 89 de             	mov    %rbx,%rsi
+  800eb3:	4c 89 f7             	mov    %r14,%rdi
+  800eb6:	48 b8 ee 0b 80 00 00 	movabs $0x800bee,%rax
+  800ebd:	00 00 00 
+  800ec0:	ff d0                	call   *%rax
+  800ec2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ec5:	48 39 c3             	cmp    %rax,%rbx
+  800ec8:	74 36                	je     800f00 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800eca:	48 89 d8             	mov    %rbx,%rax
+  800ecd:	4c 29 e8             	sub    %r13,%rax
+  800ed0:	49 39 c4             	cmp    %rax,%r12
+  800ed3:	73 31                	jae    800f06 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ed5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800eda:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ede:	4c 89 fe             	mov    %r15,%rsi
+  800ee1:	48 b8 72 0e 80 00 00 	movabs $0x800e72,%rax
+  800ee8:	00 00 00 
+  800eeb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eed:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ef1:	48 83 c4 08          	add    $0x8,%rsp
+  800ef5:	5b                   	pop    %rbx
+  800ef6:	41 5c                	pop    %r12
+  800ef8:	41 5d                	pop    %r13
+  800efa:	41 5e                	pop    %r14
+  800efc:	41 5f                	pop    %r15
+  800efe:	5d                   	pop    %rbp
+  800eff:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f00:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f04:	eb eb                	jmp    800ef1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f06:	48 83 eb 01          	sub    $0x1,%rbx
+  800f0a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f0e:	48 89 da             	mov    %rbx,%rdx
+  800f11:	4c 89 fe             	mov    %r15,%rsi
+  800f14:	48 b8 72 0e 80 00 00 	movabs $0x800e72,%rax
+  800f1b:	00 00 00 
+  800f1e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f20:	49 01 de             	add    %rbx,%r14
+  800f23:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f28:	eb c3                	jmp    800eed <strlcat+0x69>
+
+0000000000800f2a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f2a:	48 85 d2             	test   %rdx,%rdx
+  800f2d:	74 2d                	je     800f5c <memcmp+0x32>
+  800f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f34:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f38:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f3d:	44 38 c1             	cmp    %r8b,%cl
+  800f40:	75 0f                	jne    800f51 <memcmp+0x27>
+    while (n-- > 0) {
+  800f42:	48 83 c0 01          	add    $0x1,%rax
+  800f46:	48 39 c2             	cmp    %rax,%rdx
+  800f49:	75 e9                	jne    800f34 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f50:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f51:	0f b6 c1             	movzbl %cl,%eax
+  800f54:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f58:	44 29 c0             	sub    %r8d,%eax
+  800f5b:	c3                   	ret
+    return 0;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f61:	c3                   	ret
+
+0000000000800f62 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f62:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f66:	48 39 c7             	cmp    %rax,%rdi
+  800f69:	73 0f                	jae    800f7a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f6b:	40 38 37             	cmp    %sil,(%rdi)
+  800f6e:	74 0e                	je     800f7e <memfind+0x1c>
+    for (; src < end; src++) {
+  800f70:	48 83 c7 01          	add    $0x1,%rdi
+  800f74:	48 39 f8             	cmp    %rdi,%rax
+  800f77:	75 f2                	jne    800f6b <memfind+0x9>
+  800f79:	c3                   	ret
+  800f7a:	48 89 f8             	mov    %rdi,%rax
+  800f7d:	c3                   	ret
+  800f7e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f81:	c3                   	ret
+
+0000000000800f82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f82:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f85:	0f b6 37             	movzbl (%rdi),%esi
+  800f88:	40 80 fe 20          	cmp    $0x20,%sil
+  800f8c:	74 06                	je     800f94 <strtol+0x12>
+  800f8e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f92:	75 13                	jne    800fa7 <strtol+0x25>
+  800f94:	48 83 c7 01          	add    $0x1,%rdi
+  800f98:	0f b6 37             	movzbl (%rdi),%esi
+  800f9b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f9f:	74 f3                	je     800f94 <strtol+0x12>
+  800fa1:	40 80 fe 09          	cmp    $0x9,%sil
+  800fa5:	74 ed                	je     800f94 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fa7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800faa:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fad:	3c 01                	cmp    $0x1,%al
+  800faf:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fb3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fb9:	75 0f                	jne    800fca <strtol+0x48>
+  800fbb:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fbe:	74 14                	je     800fd4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fc0:	85 d2                	test   %edx,%edx
+  800fc2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fcf:	4c 63 ca             	movslq %edx,%r9
+  800fd2:	eb 36                	jmp    80100a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fd8:	74 0f                	je     800fe9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fda:	85 d2                	test   %edx,%edx
+  800fdc:	75 ec                	jne    800fca <strtol+0x48>
+        s++;
+  800fde:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fe2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fe7:	eb e1                	jmp    800fca <strtol+0x48>
+        s += 2;
+  800fe9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fed:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ff2:	eb d6                	jmp    800fca <strtol+0x48>
+            dig -= '0';
+  800ff4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ff7:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ffb:	41 39 d0             	cmp    %edx,%r8d
+  800ffe:	7d 21                	jge    801021 <strtol+0x9f>
+        val = val * base + dig;
+  801000:	49 0f af c1          	imul   %r9,%rax
+  801004:	0f b6 c9             	movzbl %cl,%ecx
+  801007:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80100a:	48 83 c7 01          	add    $0x1,%rdi
+  80100e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801012:	80 f9 39             	cmp    $0x39,%cl
+  801015:	76 dd                	jbe    800ff4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801017:	80 f9 7b             	cmp    $0x7b,%cl
+  80101a:	77 05                	ja     801021 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80101c:	83 e9 57             	sub    $0x57,%ecx
+  80101f:	eb d6                	jmp    800ff7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801021:	4d 85 d2             	test   %r10,%r10
+  801024:	74 03                	je     801029 <strtol+0xa7>
+  801026:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801029:	48 89 c2             	mov    %rax,%rdx
+  80102c:	48 f7 da             	neg    %rdx
+  80102f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801033:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801037:	c3                   	ret
+
+0000000000801038 <strrev>:
+
+void
+strrev(char *str)
+{
+  801038:	55                   	push   %rbp
+  801039:	48 89 e5             	mov    %rsp,%rbp
+  80103c:	53                   	push   %rbx
+  80103d:	48 83 ec 08          	sub    $0x8,%rsp
+  801041:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801044:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  80104b:	00 00 00 
+  80104e:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801050:	83 e8 01             	sub    $0x1,%eax
+  801053:	85 c0                	test   %eax,%eax
+  801055:	7e 22                	jle    801079 <strrev+0x41>
+  801057:	48 98                	cltq
+  801059:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80105e:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801062:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801066:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80106a:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80106d:	48 83 c2 01          	add    $0x1,%rdx
+  801071:	48 83 e8 01          	sub    $0x1,%rax
+  801075:	39 c2                	cmp    %eax,%edx
+  801077:	7c e5                	jl     80105e <strrev+0x26>
+	}
+}
+  801079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107d:	c9                   	leave
+  80107e:	c3                   	ret
+
+000000000080107f <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80107f:	85 d2                	test   %edx,%edx
+  801081:	0f 84 80 00 00 00    	je     801107 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801087:	55                   	push   %rbp
+  801088:	48 89 e5             	mov    %rsp,%rbp
+  80108b:	53                   	push   %rbx
+  80108c:	48 83 ec 08          	sub    $0x8,%rsp
+  801090:	49 89 f2             	mov    %rsi,%r10
+  801093:	41 89 d3             	mov    %edx,%r11d
+  801096:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801099:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80109e:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8010a1:	eb 20                	jmp    8010c3 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8010a3:	41 89 f1             	mov    %esi,%r9d
+  8010a6:	83 c2 30             	add    $0x30,%edx
+  8010a9:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8010ac:	89 f8                	mov    %edi,%eax
+  8010ae:	99                   	cltd
+  8010af:	f7 f9                	idiv   %ecx
+  8010b1:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8010b3:	85 c0                	test   %eax,%eax
+  8010b5:	74 2e                	je     8010e5 <itoa+0x66>
+  8010b7:	83 c6 01             	add    $0x1,%esi
+  8010ba:	49 83 c0 01          	add    $0x1,%r8
+  8010be:	44 39 cb             	cmp    %r9d,%ebx
+  8010c1:	7e 15                	jle    8010d8 <itoa+0x59>
+		digit = sum % base;
+  8010c3:	89 f8                	mov    %edi,%eax
+  8010c5:	99                   	cltd
+  8010c6:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8010c8:	83 fa 09             	cmp    $0x9,%edx
+  8010cb:	7e d6                	jle    8010a3 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8010cd:	41 89 f1             	mov    %esi,%r9d
+  8010d0:	83 c2 37             	add    $0x37,%edx
+  8010d3:	41 88 10             	mov    %dl,(%r8)
+  8010d6:	eb d4                	jmp    8010ac <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8010d8:	41 83 eb 01          	sub    $0x1,%r11d
+  8010dc:	45 39 cb             	cmp    %r9d,%r11d
+  8010df:	75 04                	jne    8010e5 <itoa+0x66>
+  8010e1:	85 c0                	test   %eax,%eax
+  8010e3:	75 28                	jne    80110d <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8010e5:	4d 63 c9             	movslq %r9d,%r9
+  8010e8:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8010ed:	4c 89 d7             	mov    %r10,%rdi
+  8010f0:	48 b8 38 10 80 00 00 	movabs $0x801038,%rax
+  8010f7:	00 00 00 
+  8010fa:	ff d0                	call   *%rax
+	return 0;
+  8010fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801101:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+		return -1;
+  801107:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80110c:	c3                   	ret
+		return -1;
+  80110d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801112:	eb ed                	jmp    801101 <itoa+0x82>
+
+0000000000801114 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	53                   	push   %rbx
+  801119:	48 89 fa             	mov    %rdi,%rdx
+  80111c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80111f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801124:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801129:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112e:	be 00 00 00 00       	mov    $0x0,%esi
+  801133:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801139:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80113b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113f:	c9                   	leave
+  801140:	c3                   	ret
+
+0000000000801141 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801141:	55                   	push   %rbp
+  801142:	48 89 e5             	mov    %rsp,%rbp
+  801145:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801146:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801150:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115f:	be 00 00 00 00       	mov    $0x0,%esi
+  801164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80116a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80116c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801170:	c9                   	leave
+  801171:	c3                   	ret
+
+0000000000801172 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801172:	55                   	push   %rbp
+  801173:	48 89 e5             	mov    %rsp,%rbp
+  801176:	53                   	push   %rbx
+  801177:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80117b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80117e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801183:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801192:	be 00 00 00 00       	mov    $0x0,%esi
+  801197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80119f:	48 85 c0             	test   %rax,%rax
+  8011a2:	7f 06                	jg     8011aa <sys_env_destroy+0x38>
+}
+  8011a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a8:	c9                   	leave
+  8011a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011aa:	49 89 c0             	mov    %rax,%r8
+  8011ad:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011b2:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  8011b9:	00 00 00 
+  8011bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c1:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  8011c8:	00 00 00 
+  8011cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d0:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  8011d7:	00 00 00 
+  8011da:	41 ff d1             	call   *%r9
+
+00000000008011dd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011dd:	55                   	push   %rbp
+  8011de:	48 89 e5             	mov    %rsp,%rbp
+  8011e1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801200:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801206:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801208:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120c:	c9                   	leave
+  80120d:	c3                   	ret
+
+000000000080120e <sys_yield>:
+
+void
+sys_yield(void) {
+  80120e:	55                   	push   %rbp
+  80120f:	48 89 e5             	mov    %rsp,%rbp
+  801212:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801213:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801227:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122c:	be 00 00 00 00       	mov    $0x0,%esi
+  801231:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801237:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801239:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+000000000080123f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+  801243:	53                   	push   %rbx
+  801244:	48 89 fa             	mov    %rdi,%rdx
+  801247:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80124a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801256:	00 00 00 
+  801259:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125e:	be 00 00 00 00       	mov    $0x0,%esi
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801269:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80126b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126f:	c9                   	leave
+  801270:	c3                   	ret
+
+0000000000801271 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+  801275:	53                   	push   %rbx
+  801276:	49 89 f8             	mov    %rdi,%r8
+  801279:	48 89 d3             	mov    %rdx,%rbx
+  80127c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80127f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801284:	4c 89 c2             	mov    %r8,%rdx
+  801287:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128a:	be 00 00 00 00       	mov    $0x0,%esi
+  80128f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801295:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801297:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129b:	c9                   	leave
+  80129c:	c3                   	ret
+
+000000000080129d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80129d:	55                   	push   %rbp
+  80129e:	48 89 e5             	mov    %rsp,%rbp
+  8012a1:	53                   	push   %rbx
+  8012a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a6:	89 f8                	mov    %edi,%eax
+  8012a8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ab:	48 63 f9             	movslq %ecx,%rdi
+  8012ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c6:	48 85 c0             	test   %rax,%rax
+  8012c9:	7f 06                	jg     8012d1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012cf:	c9                   	leave
+  8012d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d1:	49 89 c0             	mov    %rax,%r8
+  8012d4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012d9:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  8012e0:	00 00 00 
+  8012e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e8:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  8012ef:	00 00 00 
+  8012f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f7:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  8012fe:	00 00 00 
+  801301:	41 ff d1             	call   *%r9
+
+0000000000801304 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801304:	55                   	push   %rbp
+  801305:	48 89 e5             	mov    %rsp,%rbp
+  801308:	53                   	push   %rbx
+  801309:	48 83 ec 08          	sub    $0x8,%rsp
+  80130d:	89 f8                	mov    %edi,%eax
+  80130f:	49 89 f2             	mov    %rsi,%r10
+  801312:	48 89 cf             	mov    %rcx,%rdi
+  801315:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801318:	48 63 da             	movslq %edx,%rbx
+  80131b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801323:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801326:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801329:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132b:	48 85 c0             	test   %rax,%rax
+  80132e:	7f 06                	jg     801336 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801334:	c9                   	leave
+  801335:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801336:	49 89 c0             	mov    %rax,%r8
+  801339:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80133e:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  801345:	00 00 00 
+  801348:	be 26 00 00 00       	mov    $0x26,%esi
+  80134d:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  801354:	00 00 00 
+  801357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135c:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  801363:	00 00 00 
+  801366:	41 ff d1             	call   *%r9
+
+0000000000801369 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801369:	55                   	push   %rbp
+  80136a:	48 89 e5             	mov    %rsp,%rbp
+  80136d:	53                   	push   %rbx
+  80136e:	48 83 ec 08          	sub    $0x8,%rsp
+  801372:	48 89 f1             	mov    %rsi,%rcx
+  801375:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801378:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801380:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801385:	be 00 00 00 00       	mov    $0x0,%esi
+  80138a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801390:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801392:	48 85 c0             	test   %rax,%rax
+  801395:	7f 06                	jg     80139d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139d:	49 89 c0             	mov    %rax,%r8
+  8013a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013a5:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  8013ac:	00 00 00 
+  8013af:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b4:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  8013bb:	00 00 00 
+  8013be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c3:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  8013ca:	00 00 00 
+  8013cd:	41 ff d1             	call   *%r9
+
+00000000008013d0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013d0:	55                   	push   %rbp
+  8013d1:	48 89 e5             	mov    %rsp,%rbp
+  8013d4:	53                   	push   %rbx
+  8013d5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013d9:	48 63 ce             	movslq %esi,%rcx
+  8013dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013df:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013fb:	48 85 c0             	test   %rax,%rax
+  8013fe:	7f 06                	jg     801406 <sys_env_set_status+0x36>
+}
+  801400:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801404:	c9                   	leave
+  801405:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801406:	49 89 c0             	mov    %rax,%r8
+  801409:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80140e:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  801415:	00 00 00 
+  801418:	be 26 00 00 00       	mov    $0x26,%esi
+  80141d:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  801424:	00 00 00 
+  801427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142c:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  801433:	00 00 00 
+  801436:	41 ff d1             	call   *%r9
+
+0000000000801439 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801439:	55                   	push   %rbp
+  80143a:	48 89 e5             	mov    %rsp,%rbp
+  80143d:	53                   	push   %rbx
+  80143e:	48 83 ec 08          	sub    $0x8,%rsp
+  801442:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801445:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801448:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801452:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801457:	be 00 00 00 00       	mov    $0x0,%esi
+  80145c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801462:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801464:	48 85 c0             	test   %rax,%rax
+  801467:	7f 06                	jg     80146f <sys_env_set_trapframe+0x36>
+}
+  801469:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146d:	c9                   	leave
+  80146e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146f:	49 89 c0             	mov    %rax,%r8
+  801472:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801477:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  80147e:	00 00 00 
+  801481:	be 26 00 00 00       	mov    $0x26,%esi
+  801486:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  80148d:	00 00 00 
+  801490:	b8 00 00 00 00       	mov    $0x0,%eax
+  801495:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  80149c:	00 00 00 
+  80149f:	41 ff d1             	call   *%r9
+
+00000000008014a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014a2:	55                   	push   %rbp
+  8014a3:	48 89 e5             	mov    %rsp,%rbp
+  8014a6:	53                   	push   %rbx
+  8014a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ab:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cd:	48 85 c0             	test   %rax,%rax
+  8014d0:	7f 06                	jg     8014d8 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d8:	49 89 c0             	mov    %rax,%r8
+  8014db:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014e0:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  8014e7:	00 00 00 
+  8014ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ef:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  8014f6:	00 00 00 
+  8014f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fe:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  801505:	00 00 00 
+  801508:	41 ff d1             	call   *%r9
+
+000000000080150b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	53                   	push   %rbx
+  801510:	89 f8                	mov    %edi,%eax
+  801512:	49 89 f1             	mov    %rsi,%r9
+  801515:	48 89 d3             	mov    %rdx,%rbx
+  801518:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80151b:	49 63 f0             	movslq %r8d,%rsi
+  80151e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801521:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801526:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801529:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152f:	cd 30                	int    $0x30
+}
+  801531:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	53                   	push   %rbx
+  80153c:	48 83 ec 08          	sub    $0x8,%rsp
+  801540:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801543:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801546:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 06                	jg     80156b <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156b:	49 89 c0             	mov    %rax,%r8
+  80156e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801573:	48 ba 48 40 80 00 00 	movabs $0x804048,%rdx
+  80157a:	00 00 00 
+  80157d:	be 26 00 00 00       	mov    $0x26,%esi
+  801582:	48 bf 67 40 80 00 00 	movabs $0x804067,%rdi
+  801589:	00 00 00 
+  80158c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801591:	49 b9 1c 38 80 00 00 	movabs $0x80381c,%r9
+  801598:	00 00 00 
+  80159b:	41 ff d1             	call   *%r9
+
+000000000080159e <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80159e:	55                   	push   %rbp
+  80159f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8015a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a7:	48 b8 37 15 80 00 00 	movabs $0x801537,%rax
+  8015ae:	00 00 00 
+  8015b1:	ff d0                	call   *%rax
+}
+  8015b3:	5d                   	pop    %rbp
+  8015b4:	c3                   	ret
+
+00000000008015b5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ba:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015de:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+
+00000000008015e6 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8015e6:	55                   	push   %rbp
+  8015e7:	48 89 e5             	mov    %rsp,%rbp
+  8015ea:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8015eb:	48 63 ce             	movslq %esi,%rcx
+  8015ee:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801601:	be 00 00 00 00       	mov    $0x0,%esi
+  801606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160c:	cd 30                	int    $0x30
+}
+  80160e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+0000000000801614 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	53                   	push   %rbx
+  801619:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80161c:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801620:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801625:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162f:	be 00 00 00 00       	mov    $0x0,%esi
+  801634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163a:	cd 30                	int    $0x30
+}
+  80163c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801640:	c9                   	leave
+  801641:	c3                   	ret
+
+0000000000801642 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	53                   	push   %rbx
+  801647:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80164a:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80164d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801652:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801655:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165a:	be 00 00 00 00       	mov    $0x0,%esi
+  80165f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801665:	cd 30                	int    $0x30
+}
+  801667:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166b:	c9                   	leave
+  80166c:	c3                   	ret
+
+000000000080166d <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  80166d:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801670:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801674:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801677:	7e 0f                	jle    801688 <argstart+0x1b>
+  801679:	48 b8 e9 3a 80 00 00 	movabs $0x803ae9,%rax
+  801680:	00 00 00 
+  801683:	48 85 f6             	test   %rsi,%rsi
+  801686:	75 05                	jne    80168d <argstart+0x20>
+  801688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168d:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801691:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801698:	00 
+}
+  801699:	c3                   	ret
+
+000000000080169a <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  80169a:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8016a1:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8016a2:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8016a6:	48 85 c0             	test   %rax,%rax
+  8016a9:	0f 84 8f 00 00 00    	je     80173e <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+  8016b3:	53                   	push   %rbx
+  8016b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b8:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8016bb:	80 38 00             	cmpb   $0x0,(%rax)
+  8016be:	75 52                	jne    801712 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8016c0:	48 8b 17             	mov    (%rdi),%rdx
+  8016c3:	83 3a 01             	cmpl   $0x1,(%rdx)
+  8016c6:	74 67                	je     80172f <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8016c8:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8016cc:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8016d0:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8016d3:	75 5a                	jne    80172f <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8016d5:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8016d9:	74 54                	je     80172f <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  8016db:	48 83 c0 01          	add    $0x1,%rax
+  8016df:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8016e3:	8b 12                	mov    (%rdx),%edx
+  8016e5:	83 ea 01             	sub    $0x1,%edx
+  8016e8:	48 63 d2             	movslq %edx,%rdx
+  8016eb:	48 c1 e2 03          	shl    $0x3,%rdx
+  8016ef:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8016f3:	48 83 c7 08          	add    $0x8,%rdi
+  8016f7:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  8016fe:	00 00 00 
+  801701:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  801703:	48 8b 03             	mov    (%rbx),%rax
+  801706:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801709:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80170d:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801710:	74 17                	je     801729 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801712:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801716:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801719:	48 83 c0 01          	add    $0x1,%rax
+  80171d:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801721:	89 d0                	mov    %edx,%eax
+  801723:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801729:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  80172d:	75 e3                	jne    801712 <argnext+0x78>
+    args->curarg = 0;
+  80172f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801736:	00 
+    return -1;
+  801737:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80173c:	eb e3                	jmp    801721 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  80173e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801743:	89 d0                	mov    %edx,%eax
+  801745:	c3                   	ret
+
+0000000000801746 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801746:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  80174a:	48 85 c0             	test   %rax,%rax
+  80174d:	74 7b                	je     8017ca <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+  801753:	53                   	push   %rbx
+  801754:	48 83 ec 08          	sub    $0x8,%rsp
+  801758:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  80175b:	80 38 00             	cmpb   $0x0,(%rax)
+  80175e:	74 1c                	je     80177c <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801760:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801764:	48 b8 e9 3a 80 00 00 	movabs $0x803ae9,%rax
+  80176b:	00 00 00 
+  80176e:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801772:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801776:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177a:	c9                   	leave
+  80177b:	c3                   	ret
+    } else if (*args->argc > 1) {
+  80177c:	48 8b 07             	mov    (%rdi),%rax
+  80177f:	83 38 01             	cmpl   $0x1,(%rax)
+  801782:	7f 12                	jg     801796 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801784:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  80178b:	00 
+        args->curarg = 0;
+  80178c:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801793:	00 
+  801794:	eb dc                	jmp    801772 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801796:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80179a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80179e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8017a2:	8b 10                	mov    (%rax),%edx
+  8017a4:	83 ea 01             	sub    $0x1,%edx
+  8017a7:	48 63 d2             	movslq %edx,%rdx
+  8017aa:	48 c1 e2 03          	shl    $0x3,%rdx
+  8017ae:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8017b2:	48 83 c7 08          	add    $0x8,%rdi
+  8017b6:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8017c2:	48 8b 03             	mov    (%rbx),%rax
+  8017c5:	83 28 01             	subl   $0x1,(%rax)
+  8017c8:	eb a8                	jmp    801772 <argnextvalue+0x2c>
+}
+  8017ca:	c3                   	ret
+
+00000000008017cb <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8017cb:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8017cf:	48 85 c0             	test   %rax,%rax
+  8017d2:	74 01                	je     8017d5 <argvalue+0xa>
+}
+  8017d4:	c3                   	ret
+argvalue(struct Argstate *args) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8017d9:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  8017e0:	00 00 00 
+  8017e3:	ff d0                	call   *%rax
+}
+  8017e5:	5d                   	pop    %rbp
+  8017e6:	c3                   	ret
+
+00000000008017e7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017e7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017ee:	ff ff ff 
+  8017f1:	48 01 f8             	add    %rdi,%rax
+  8017f4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017f8:	c3                   	ret
+
+00000000008017f9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017f9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801800:	ff ff ff 
+  801803:	48 01 f8             	add    %rdi,%rax
+  801806:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80180a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801810:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801814:	c3                   	ret
+
+0000000000801815 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801815:	55                   	push   %rbp
+  801816:	48 89 e5             	mov    %rsp,%rbp
+  801819:	41 57                	push   %r15
+  80181b:	41 56                	push   %r14
+  80181d:	41 55                	push   %r13
+  80181f:	41 54                	push   %r12
+  801821:	53                   	push   %rbx
+  801822:	48 83 ec 08          	sub    $0x8,%rsp
+  801826:	49 89 ff             	mov    %rdi,%r15
+  801829:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80182e:	49 bd d8 34 80 00 00 	movabs $0x8034d8,%r13
+  801835:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801838:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80183e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801841:	48 89 df             	mov    %rbx,%rdi
+  801844:	41 ff d5             	call   *%r13
+  801847:	83 e0 04             	and    $0x4,%eax
+  80184a:	74 17                	je     801863 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80184c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801853:	4c 39 f3             	cmp    %r14,%rbx
+  801856:	75 e6                	jne    80183e <fd_alloc+0x29>
+  801858:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80185e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801863:	4d 89 27             	mov    %r12,(%r15)
+}
+  801866:	48 83 c4 08          	add    $0x8,%rsp
+  80186a:	5b                   	pop    %rbx
+  80186b:	41 5c                	pop    %r12
+  80186d:	41 5d                	pop    %r13
+  80186f:	41 5e                	pop    %r14
+  801871:	41 5f                	pop    %r15
+  801873:	5d                   	pop    %rbp
+  801874:	c3                   	ret
+
+0000000000801875 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801875:	83 ff 1f             	cmp    $0x1f,%edi
+  801878:	77 39                	ja     8018b3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+  80187e:	41 54                	push   %r12
+  801880:	53                   	push   %rbx
+  801881:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801884:	48 63 df             	movslq %edi,%rbx
+  801887:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80188e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801892:	48 89 df             	mov    %rbx,%rdi
+  801895:	48 b8 d8 34 80 00 00 	movabs $0x8034d8,%rax
+  80189c:	00 00 00 
+  80189f:	ff d0                	call   *%rax
+  8018a1:	a8 04                	test   $0x4,%al
+  8018a3:	74 14                	je     8018b9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018a5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ae:	5b                   	pop    %rbx
+  8018af:	41 5c                	pop    %r12
+  8018b1:	5d                   	pop    %rbp
+  8018b2:	c3                   	ret
+        return -E_INVAL;
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018b8:	c3                   	ret
+        return -E_INVAL;
+  8018b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018be:	eb ee                	jmp    8018ae <fd_lookup+0x39>
+
+00000000008018c0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018c0:	55                   	push   %rbp
+  8018c1:	48 89 e5             	mov    %rsp,%rbp
+  8018c4:	41 54                	push   %r12
+  8018c6:	53                   	push   %rbx
+  8018c7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018ca:	48 b8 20 41 80 00 00 	movabs $0x804120,%rax
+  8018d1:	00 00 00 
+  8018d4:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8018db:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018de:	39 3b                	cmp    %edi,(%rbx)
+  8018e0:	74 47                	je     801929 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018e2:	48 83 c0 08          	add    $0x8,%rax
+  8018e6:	48 8b 18             	mov    (%rax),%rbx
+  8018e9:	48 85 db             	test   %rbx,%rbx
+  8018ec:	75 f0                	jne    8018de <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018ee:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8018f5:	00 00 00 
+  8018f8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018fe:	89 fa                	mov    %edi,%edx
+  801900:	48 bf 78 40 80 00 00 	movabs $0x804078,%rdi
+  801907:	00 00 00 
+  80190a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190f:	48 b9 ec 02 80 00 00 	movabs $0x8002ec,%rcx
+  801916:	00 00 00 
+  801919:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80191b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801920:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801924:	5b                   	pop    %rbx
+  801925:	41 5c                	pop    %r12
+  801927:	5d                   	pop    %rbp
+  801928:	c3                   	ret
+            return 0;
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	eb f0                	jmp    801920 <dev_lookup+0x60>
+
+0000000000801930 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801930:	55                   	push   %rbp
+  801931:	48 89 e5             	mov    %rsp,%rbp
+  801934:	41 55                	push   %r13
+  801936:	41 54                	push   %r12
+  801938:	53                   	push   %rbx
+  801939:	48 83 ec 18          	sub    $0x18,%rsp
+  80193d:	48 89 fb             	mov    %rdi,%rbx
+  801940:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801943:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80194a:	ff ff ff 
+  80194d:	48 01 df             	add    %rbx,%rdi
+  801950:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801954:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801958:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+  801964:	41 89 c5             	mov    %eax,%r13d
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 06                	js     801971 <fd_close+0x41>
+  80196b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80196f:	74 1a                	je     80198b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801971:	45 84 e4             	test   %r12b,%r12b
+  801974:	b8 00 00 00 00       	mov    $0x0,%eax
+  801979:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80197d:	44 89 e8             	mov    %r13d,%eax
+  801980:	48 83 c4 18          	add    $0x18,%rsp
+  801984:	5b                   	pop    %rbx
+  801985:	41 5c                	pop    %r12
+  801987:	41 5d                	pop    %r13
+  801989:	5d                   	pop    %rbp
+  80198a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80198b:	8b 3b                	mov    (%rbx),%edi
+  80198d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801991:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801998:	00 00 00 
+  80199b:	ff d0                	call   *%rax
+  80199d:	41 89 c5             	mov    %eax,%r13d
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 1b                	js     8019bf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019a8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8019ac:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019b2:	48 85 c0             	test   %rax,%rax
+  8019b5:	74 08                	je     8019bf <fd_close+0x8f>
+  8019b7:	48 89 df             	mov    %rbx,%rdi
+  8019ba:	ff d0                	call   *%rax
+  8019bc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019c4:	48 89 de             	mov    %rbx,%rsi
+  8019c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019cc:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+    return res;
+  8019d8:	eb a3                	jmp    80197d <fd_close+0x4d>
+
+00000000008019da <close>:
+
+int
+close(int fdnum) {
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+  8019de:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019e2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019e6:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  8019ed:	00 00 00 
+  8019f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 15                	js     801a0b <close+0x31>
+
+    return fd_close(fd, 1);
+  8019f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8019fb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019ff:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801a06:	00 00 00 
+  801a09:	ff d0                	call   *%rax
+}
+  801a0b:	c9                   	leave
+  801a0c:	c3                   	ret
+
+0000000000801a0d <close_all>:
+
+void
+close_all(void) {
+  801a0d:	55                   	push   %rbp
+  801a0e:	48 89 e5             	mov    %rsp,%rbp
+  801a11:	41 54                	push   %r12
+  801a13:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a19:	49 bc da 19 80 00 00 	movabs $0x8019da,%r12
+  801a20:	00 00 00 
+  801a23:	89 df                	mov    %ebx,%edi
+  801a25:	41 ff d4             	call   *%r12
+  801a28:	83 c3 01             	add    $0x1,%ebx
+  801a2b:	83 fb 20             	cmp    $0x20,%ebx
+  801a2e:	75 f3                	jne    801a23 <close_all+0x16>
+}
+  801a30:	5b                   	pop    %rbx
+  801a31:	41 5c                	pop    %r12
+  801a33:	5d                   	pop    %rbp
+  801a34:	c3                   	ret
+
+0000000000801a35 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a35:	55                   	push   %rbp
+  801a36:	48 89 e5             	mov    %rsp,%rbp
+  801a39:	41 57                	push   %r15
+  801a3b:	41 56                	push   %r14
+  801a3d:	41 55                	push   %r13
+  801a3f:	41 54                	push   %r12
+  801a41:	53                   	push   %rbx
+  801a42:	48 83 ec 18          	sub    $0x18,%rsp
+  801a46:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a49:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a4d:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	89 c3                	mov    %eax,%ebx
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	0f 88 b8 00 00 00    	js     801b1b <dup+0xe6>
+    close(newfdnum);
+  801a63:	44 89 e7             	mov    %r12d,%edi
+  801a66:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  801a6d:	00 00 00 
+  801a70:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a72:	4d 63 ec             	movslq %r12d,%r13
+  801a75:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a7c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a80:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a84:	4c 89 ff             	mov    %r15,%rdi
+  801a87:	49 be f9 17 80 00 00 	movabs $0x8017f9,%r14
+  801a8e:	00 00 00 
+  801a91:	41 ff d6             	call   *%r14
+  801a94:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a97:	4c 89 ef             	mov    %r13,%rdi
+  801a9a:	41 ff d6             	call   *%r14
+  801a9d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801aa0:	48 89 df             	mov    %rbx,%rdi
+  801aa3:	48 b8 d8 34 80 00 00 	movabs $0x8034d8,%rax
+  801aaa:	00 00 00 
+  801aad:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801aaf:	a8 04                	test   $0x4,%al
+  801ab1:	74 2b                	je     801ade <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ab3:	41 89 c1             	mov    %eax,%r9d
+  801ab6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801abc:	4c 89 f1             	mov    %r14,%rcx
+  801abf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac4:	48 89 de             	mov    %rbx,%rsi
+  801ac7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801acc:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+  801ad8:	89 c3                	mov    %eax,%ebx
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	78 4e                	js     801b2c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ade:	4c 89 ff             	mov    %r15,%rdi
+  801ae1:	48 b8 d8 34 80 00 00 	movabs $0x8034d8,%rax
+  801ae8:	00 00 00 
+  801aeb:	ff d0                	call   *%rax
+  801aed:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801af0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801af6:	4c 89 e9             	mov    %r13,%rcx
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	4c 89 fe             	mov    %r15,%rsi
+  801b01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b06:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  801b0d:	00 00 00 
+  801b10:	ff d0                	call   *%rax
+  801b12:	89 c3                	mov    %eax,%ebx
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 14                	js     801b2c <dup+0xf7>
+
+    return newfdnum;
+  801b18:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b1b:	89 d8                	mov    %ebx,%eax
+  801b1d:	48 83 c4 18          	add    $0x18,%rsp
+  801b21:	5b                   	pop    %rbx
+  801b22:	41 5c                	pop    %r12
+  801b24:	41 5d                	pop    %r13
+  801b26:	41 5e                	pop    %r14
+  801b28:	41 5f                	pop    %r15
+  801b2a:	5d                   	pop    %rbp
+  801b2b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b31:	4c 89 ee             	mov    %r13,%rsi
+  801b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b39:	49 bc 69 13 80 00 00 	movabs $0x801369,%r12
+  801b40:	00 00 00 
+  801b43:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4b:	4c 89 f6             	mov    %r14,%rsi
+  801b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b53:	41 ff d4             	call   *%r12
+    return res;
+  801b56:	eb c3                	jmp    801b1b <dup+0xe6>
+
+0000000000801b58 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b58:	55                   	push   %rbp
+  801b59:	48 89 e5             	mov    %rsp,%rbp
+  801b5c:	41 56                	push   %r14
+  801b5e:	41 55                	push   %r13
+  801b60:	41 54                	push   %r12
+  801b62:	53                   	push   %rbx
+  801b63:	48 83 ec 10          	sub    $0x10,%rsp
+  801b67:	89 fb                	mov    %edi,%ebx
+  801b69:	49 89 f4             	mov    %rsi,%r12
+  801b6c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b73:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 4c                	js     801bcf <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b83:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b87:	41 8b 3e             	mov    (%r14),%edi
+  801b8a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b8e:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	78 35                	js     801bd3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b9e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ba2:	83 e0 03             	and    $0x3,%eax
+  801ba5:	83 f8 01             	cmp    $0x1,%eax
+  801ba8:	74 2d                	je     801bd7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801baa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bb2:	48 85 c0             	test   %rax,%rax
+  801bb5:	74 56                	je     801c0d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801bb7:	4c 89 ea             	mov    %r13,%rdx
+  801bba:	4c 89 e6             	mov    %r12,%rsi
+  801bbd:	4c 89 f7             	mov    %r14,%rdi
+  801bc0:	ff d0                	call   *%rax
+}
+  801bc2:	48 83 c4 10          	add    $0x10,%rsp
+  801bc6:	5b                   	pop    %rbx
+  801bc7:	41 5c                	pop    %r12
+  801bc9:	41 5d                	pop    %r13
+  801bcb:	41 5e                	pop    %r14
+  801bcd:	5d                   	pop    %rbp
+  801bce:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bcf:	48 98                	cltq
+  801bd1:	eb ef                	jmp    801bc2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bd3:	48 98                	cltq
+  801bd5:	eb eb                	jmp    801bc2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd7:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801bde:	00 00 00 
+  801be1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801be7:	89 da                	mov    %ebx,%edx
+  801be9:	48 bf d9 40 80 00 00 	movabs $0x8040d9,%rdi
+  801bf0:	00 00 00 
+  801bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf8:	48 b9 ec 02 80 00 00 	movabs $0x8002ec,%rcx
+  801bff:	00 00 00 
+  801c02:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c04:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c0b:	eb b5                	jmp    801bc2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c0d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c14:	eb ac                	jmp    801bc2 <read+0x6a>
+
+0000000000801c16 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c16:	55                   	push   %rbp
+  801c17:	48 89 e5             	mov    %rsp,%rbp
+  801c1a:	41 56                	push   %r14
+  801c1c:	41 55                	push   %r13
+  801c1e:	41 54                	push   %r12
+  801c20:	53                   	push   %rbx
+  801c21:	48 83 ec 10          	sub    $0x10,%rsp
+  801c25:	89 fb                	mov    %edi,%ebx
+  801c27:	49 89 f4             	mov    %rsi,%r12
+  801c2a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c31:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801c38:	00 00 00 
+  801c3b:	ff d0                	call   *%rax
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 41                	js     801c82 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c41:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c45:	41 8b 3e             	mov    (%r14),%edi
+  801c48:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c4c:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801c53:	00 00 00 
+  801c56:	ff d0                	call   *%rax
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	78 35                	js     801c91 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c5c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c60:	83 e0 03             	and    $0x3,%eax
+  801c63:	83 f8 01             	cmp    $0x1,%eax
+  801c66:	74 2d                	je     801c95 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c6c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c70:	48 85 c0             	test   %rax,%rax
+  801c73:	74 56                	je     801ccb <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801c75:	4c 89 ea             	mov    %r13,%rdx
+  801c78:	4c 89 e6             	mov    %r12,%rsi
+  801c7b:	4c 89 f7             	mov    %r14,%rdi
+  801c7e:	ff d0                	call   *%rax
+  801c80:	eb 02                	jmp    801c84 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c82:	48 98                	cltq
+}
+  801c84:	48 83 c4 10          	add    $0x10,%rsp
+  801c88:	5b                   	pop    %rbx
+  801c89:	41 5c                	pop    %r12
+  801c8b:	41 5d                	pop    %r13
+  801c8d:	41 5e                	pop    %r14
+  801c8f:	5d                   	pop    %rbp
+  801c90:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c91:	48 98                	cltq
+  801c93:	eb ef                	jmp    801c84 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c95:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c9c:	00 00 00 
+  801c9f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ca5:	89 da                	mov    %ebx,%edx
+  801ca7:	48 bf 98 40 80 00 00 	movabs $0x804098,%rdi
+  801cae:	00 00 00 
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	48 b9 ec 02 80 00 00 	movabs $0x8002ec,%rcx
+  801cbd:	00 00 00 
+  801cc0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cc2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cc9:	eb b9                	jmp    801c84 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ccb:	4c 89 ea             	mov    %r13,%rdx
+  801cce:	4c 89 e6             	mov    %r12,%rsi
+  801cd1:	89 df                	mov    %ebx,%edi
+  801cd3:	48 b8 58 1b 80 00 00 	movabs $0x801b58,%rax
+  801cda:	00 00 00 
+  801cdd:	ff d0                	call   *%rax
+  801cdf:	eb a3                	jmp    801c84 <readmap+0x6e>
+
+0000000000801ce1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	41 57                	push   %r15
+  801ce7:	41 56                	push   %r14
+  801ce9:	41 55                	push   %r13
+  801ceb:	41 54                	push   %r12
+  801ced:	53                   	push   %rbx
+  801cee:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cf2:	48 85 d2             	test   %rdx,%rdx
+  801cf5:	74 54                	je     801d4b <readn+0x6a>
+  801cf7:	41 89 fd             	mov    %edi,%r13d
+  801cfa:	49 89 f6             	mov    %rsi,%r14
+  801cfd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d00:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d05:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d0a:	49 bf 58 1b 80 00 00 	movabs $0x801b58,%r15
+  801d11:	00 00 00 
+  801d14:	4c 89 e2             	mov    %r12,%rdx
+  801d17:	48 29 f2             	sub    %rsi,%rdx
+  801d1a:	4c 01 f6             	add    %r14,%rsi
+  801d1d:	44 89 ef             	mov    %r13d,%edi
+  801d20:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	78 20                	js     801d47 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d27:	01 c3                	add    %eax,%ebx
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	74 08                	je     801d35 <readn+0x54>
+  801d2d:	48 63 f3             	movslq %ebx,%rsi
+  801d30:	4c 39 e6             	cmp    %r12,%rsi
+  801d33:	72 df                	jb     801d14 <readn+0x33>
+    }
+    return res;
+  801d35:	48 63 c3             	movslq %ebx,%rax
+}
+  801d38:	48 83 c4 08          	add    $0x8,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	41 5e                	pop    %r14
+  801d43:	41 5f                	pop    %r15
+  801d45:	5d                   	pop    %rbp
+  801d46:	c3                   	ret
+        if (inc < 0) return inc;
+  801d47:	48 98                	cltq
+  801d49:	eb ed                	jmp    801d38 <readn+0x57>
+    int inc = 1, res = 0;
+  801d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d50:	eb e3                	jmp    801d35 <readn+0x54>
+
+0000000000801d52 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d52:	55                   	push   %rbp
+  801d53:	48 89 e5             	mov    %rsp,%rbp
+  801d56:	41 56                	push   %r14
+  801d58:	41 55                	push   %r13
+  801d5a:	41 54                	push   %r12
+  801d5c:	53                   	push   %rbx
+  801d5d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d61:	89 fb                	mov    %edi,%ebx
+  801d63:	49 89 f4             	mov    %rsi,%r12
+  801d66:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d69:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d6d:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801d74:	00 00 00 
+  801d77:	ff d0                	call   *%rax
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 47                	js     801dc4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d81:	41 8b 3e             	mov    (%r14),%edi
+  801d84:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d88:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801d8f:	00 00 00 
+  801d92:	ff d0                	call   *%rax
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 30                	js     801dc8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d98:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d9d:	74 2d                	je     801dcc <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801da7:	48 85 c0             	test   %rax,%rax
+  801daa:	74 56                	je     801e02 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dac:	4c 89 ea             	mov    %r13,%rdx
+  801daf:	4c 89 e6             	mov    %r12,%rsi
+  801db2:	4c 89 f7             	mov    %r14,%rdi
+  801db5:	ff d0                	call   *%rax
+}
+  801db7:	48 83 c4 10          	add    $0x10,%rsp
+  801dbb:	5b                   	pop    %rbx
+  801dbc:	41 5c                	pop    %r12
+  801dbe:	41 5d                	pop    %r13
+  801dc0:	41 5e                	pop    %r14
+  801dc2:	5d                   	pop    %rbp
+  801dc3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc4:	48 98                	cltq
+  801dc6:	eb ef                	jmp    801db7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc8:	48 98                	cltq
+  801dca:	eb eb                	jmp    801db7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dcc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801dd3:	00 00 00 
+  801dd6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ddc:	89 da                	mov    %ebx,%edx
+  801dde:	48 bf f5 40 80 00 00 	movabs $0x8040f5,%rdi
+  801de5:	00 00 00 
+  801de8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ded:	48 b9 ec 02 80 00 00 	movabs $0x8002ec,%rcx
+  801df4:	00 00 00 
+  801df7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e00:	eb b5                	jmp    801db7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e02:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e09:	eb ac                	jmp    801db7 <write+0x65>
+
+0000000000801e0b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e0b:	55                   	push   %rbp
+  801e0c:	48 89 e5             	mov    %rsp,%rbp
+  801e0f:	53                   	push   %rbx
+  801e10:	48 83 ec 18          	sub    $0x18,%rsp
+  801e14:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e16:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e1a:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 0c                	js     801e36 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e2e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+
+0000000000801e3c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e3c:	55                   	push   %rbp
+  801e3d:	48 89 e5             	mov    %rsp,%rbp
+  801e40:	41 55                	push   %r13
+  801e42:	41 54                	push   %r12
+  801e44:	53                   	push   %rbx
+  801e45:	48 83 ec 18          	sub    $0x18,%rsp
+  801e49:	89 fb                	mov    %edi,%ebx
+  801e4b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e52:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801e59:	00 00 00 
+  801e5c:	ff d0                	call   *%rax
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 38                	js     801e9a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e62:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e66:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e6a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6e:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 1c                	js     801e9a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e7e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e83:	74 20                	je     801ea5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e89:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e8d:	48 85 c0             	test   %rax,%rax
+  801e90:	74 47                	je     801ed9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e92:	44 89 e6             	mov    %r12d,%esi
+  801e95:	4c 89 ef             	mov    %r13,%rdi
+  801e98:	ff d0                	call   *%rax
+}
+  801e9a:	48 83 c4 18          	add    $0x18,%rsp
+  801e9e:	5b                   	pop    %rbx
+  801e9f:	41 5c                	pop    %r12
+  801ea1:	41 5d                	pop    %r13
+  801ea3:	5d                   	pop    %rbp
+  801ea4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ea5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801eac:	00 00 00 
+  801eaf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eb5:	89 da                	mov    %ebx,%edx
+  801eb7:	48 bf b8 40 80 00 00 	movabs $0x8040b8,%rdi
+  801ebe:	00 00 00 
+  801ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec6:	48 b9 ec 02 80 00 00 	movabs $0x8002ec,%rcx
+  801ecd:	00 00 00 
+  801ed0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ed2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed7:	eb c1                	jmp    801e9a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ede:	eb ba                	jmp    801e9a <ftruncate+0x5e>
+
+0000000000801ee0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+  801ee4:	41 54                	push   %r12
+  801ee6:	53                   	push   %rbx
+  801ee7:	48 83 ec 10          	sub    $0x10,%rsp
+  801eeb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eee:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ef2:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 4e                	js     801f50 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f02:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f06:	41 8b 3c 24          	mov    (%r12),%edi
+  801f0a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f0e:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801f15:	00 00 00 
+  801f18:	ff d0                	call   *%rax
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 32                	js     801f50 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f22:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801f27:	74 30                	je     801f59 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f29:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f2c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f33:	00 00 00 
+    stat->st_isdir = 0;
+  801f36:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f3d:	00 00 00 
+    stat->st_dev = dev;
+  801f40:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f47:	48 89 de             	mov    %rbx,%rsi
+  801f4a:	4c 89 e7             	mov    %r12,%rdi
+  801f4d:	ff 50 30             	call   *0x30(%rax)
+}
+  801f50:	48 83 c4 10          	add    $0x10,%rsp
+  801f54:	5b                   	pop    %rbx
+  801f55:	41 5c                	pop    %r12
+  801f57:	5d                   	pop    %rbp
+  801f58:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f59:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f5e:	eb f0                	jmp    801f50 <fstat+0x70>
+
+0000000000801f60 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f60:	55                   	push   %rbp
+  801f61:	48 89 e5             	mov    %rsp,%rbp
+  801f64:	41 54                	push   %r12
+  801f66:	53                   	push   %rbx
+  801f67:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f6a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6f:	48 b8 b7 2c 80 00 00 	movabs $0x802cb7,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 25                	js     801fa6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f81:	4c 89 e6             	mov    %r12,%rsi
+  801f84:	89 c7                	mov    %eax,%edi
+  801f86:	48 b8 e0 1e 80 00 00 	movabs $0x801ee0,%rax
+  801f8d:	00 00 00 
+  801f90:	ff d0                	call   *%rax
+  801f92:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f95:	89 df                	mov    %ebx,%edi
+  801f97:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+
+    return res;
+  801fa3:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fa6:	89 d8                	mov    %ebx,%eax
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	5d                   	pop    %rbp
+  801fac:	c3                   	ret
+
+0000000000801fad <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	41 54                	push   %r12
+  801fb3:	53                   	push   %rbx
+  801fb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb8:	48 89 fb             	mov    %rdi,%rbx
+  801fbb:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fbe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc2:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc7:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	78 1f                	js     801ff6 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fdb:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801fdf:	48 85 c0             	test   %rax,%rax
+  801fe2:	74 1b                	je     801fff <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801fe4:	4c 89 e6             	mov    %r12,%rsi
+  801fe7:	48 89 df             	mov    %rbx,%rdi
+  801fea:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff3:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ff6:	48 83 c4 10          	add    $0x10,%rsp
+  801ffa:	5b                   	pop    %rbx
+  801ffb:	41 5c                	pop    %r12
+  801ffd:	5d                   	pop    %rbp
+  801ffe:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fff:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802004:	eb f0                	jmp    801ff6 <create_snapshot+0x49>
+
+0000000000802006 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802006:	55                   	push   %rbp
+  802007:	48 89 e5             	mov    %rsp,%rbp
+  80200a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80200e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802012:	bf 66 00 00 00       	mov    $0x66,%edi
+  802017:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+  802023:	85 c0                	test   %eax,%eax
+  802025:	78 1e                	js     802045 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802027:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80202b:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80202f:	48 85 d2             	test   %rdx,%rdx
+  802032:	74 13                	je     802047 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802042:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802045:	c9                   	leave
+  802046:	c3                   	ret
+        return -E_NOT_SUPP;
+  802047:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80204c:	eb f7                	jmp    802045 <print_snapshot_list+0x3f>
+
+000000000080204e <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80204e:	55                   	push   %rbp
+  80204f:	48 89 e5             	mov    %rsp,%rbp
+  802052:	53                   	push   %rbx
+  802053:	48 83 ec 18          	sub    $0x18,%rsp
+  802057:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80205a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80205e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802063:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 1c                	js     80208f <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802077:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80207b:	48 85 c0             	test   %rax,%rax
+  80207e:	74 15                	je     802095 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802080:	48 89 df             	mov    %rbx,%rdi
+  802083:	ff d0                	call   *%rax
+    if (res < 0) {
+  802085:	85 c0                	test   %eax,%eax
+  802087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80208f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802093:	c9                   	leave
+  802094:	c3                   	ret
+        return -E_NOT_SUPP;
+  802095:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209a:	eb f3                	jmp    80208f <accept_snapshot+0x41>
+
+000000000080209c <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  80209c:	55                   	push   %rbp
+  80209d:	48 89 e5             	mov    %rsp,%rbp
+  8020a0:	53                   	push   %rbx
+  8020a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8020a5:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020a8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020ac:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020b1:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 1c                	js     8020dd <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8020c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020c5:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8020c9:	48 85 c0             	test   %rax,%rax
+  8020cc:	74 15                	je     8020e3 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8020ce:	48 89 df             	mov    %rbx,%rdi
+  8020d1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020da:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e8:	eb f3                	jmp    8020dd <delete_snapshot+0x41>
+
+00000000008020ea <gc_snapshots>:
+
+int
+gc_snapshots() {
+  8020ea:	55                   	push   %rbp
+  8020eb:	48 89 e5             	mov    %rsp,%rbp
+  8020ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020f6:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020fb:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 14                	js     80211f <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80210b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80210f:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802113:	48 85 d2             	test   %rdx,%rdx
+  802116:	74 09                	je     802121 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211d:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+        return -E_NOT_SUPP;
+  802121:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802126:	eb f7                	jmp    80211f <gc_snapshots+0x35>
+
+0000000000802128 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802128:	55                   	push   %rbp
+  802129:	48 89 e5             	mov    %rsp,%rbp
+  80212c:	41 56                	push   %r14
+  80212e:	41 55                	push   %r13
+  802130:	41 54                	push   %r12
+  802132:	53                   	push   %rbx
+  802133:	48 83 ec 10          	sub    $0x10,%rsp
+  802137:	48 89 fb             	mov    %rdi,%rbx
+  80213a:	49 89 f4             	mov    %rsi,%r12
+  80213d:	49 89 d5             	mov    %rdx,%r13
+  802140:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802143:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802147:	bf 66 00 00 00       	mov    $0x66,%edi
+  80214c:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802153:	00 00 00 
+  802156:	ff d0                	call   *%rax
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 1b                	js     802177 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80215c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802160:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802164:	48 85 c0             	test   %rax,%rax
+  802167:	74 1b                	je     802184 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802169:	4c 89 f1             	mov    %r14,%rcx
+  80216c:	4c 89 ea             	mov    %r13,%rdx
+  80216f:	4c 89 e6             	mov    %r12,%rsi
+  802172:	48 89 df             	mov    %rbx,%rdi
+  802175:	ff d0                	call   *%rax
+
+    return res;
+}
+  802177:	48 83 c4 10          	add    $0x10,%rsp
+  80217b:	5b                   	pop    %rbx
+  80217c:	41 5c                	pop    %r12
+  80217e:	41 5d                	pop    %r13
+  802180:	41 5e                	pop    %r14
+  802182:	5d                   	pop    %rbp
+  802183:	c3                   	ret
+        return -E_NOT_SUPP;
+  802184:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802189:	eb ec                	jmp    802177 <diff_snapshots+0x4f>
+
+000000000080218b <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80218b:	55                   	push   %rbp
+  80218c:	48 89 e5             	mov    %rsp,%rbp
+  80218f:	41 55                	push   %r13
+  802191:	41 54                	push   %r12
+  802193:	53                   	push   %rbx
+  802194:	48 83 ec 18          	sub    $0x18,%rsp
+  802198:	48 89 fb             	mov    %rdi,%rbx
+  80219b:	49 89 f4             	mov    %rsi,%r12
+  80219e:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021a5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021aa:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 18                	js     8021d2 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8021ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021be:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8021c2:	48 85 c0             	test   %rax,%rax
+  8021c5:	74 16                	je     8021dd <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8021c7:	4c 89 ea             	mov    %r13,%rdx
+  8021ca:	4c 89 e6             	mov    %r12,%rsi
+  8021cd:	48 89 df             	mov    %rbx,%rdi
+  8021d0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021d2:	48 83 c4 18          	add    $0x18,%rsp
+  8021d6:	5b                   	pop    %rbx
+  8021d7:	41 5c                	pop    %r12
+  8021d9:	41 5d                	pop    %r13
+  8021db:	5d                   	pop    %rbp
+  8021dc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021dd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021e2:	eb ee                	jmp    8021d2 <send_snapshot+0x47>
+
+00000000008021e4 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8021e4:	55                   	push   %rbp
+  8021e5:	48 89 e5             	mov    %rsp,%rbp
+  8021e8:	53                   	push   %rbx
+  8021e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ed:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021f0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021f4:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021f9:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+  802205:	85 c0                	test   %eax,%eax
+  802207:	78 12                	js     80221b <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802209:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80220d:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802211:	48 85 c0             	test   %rax,%rax
+  802214:	74 0b                	je     802221 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802216:	48 89 df             	mov    %rbx,%rdi
+  802219:	ff d0                	call   *%rax
+
+    return res;
+}
+  80221b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+        return -E_NOT_SUPP;
+  802221:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802226:	eb f3                	jmp    80221b <receive_snapshot+0x37>
+
+0000000000802228 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802228:	55                   	push   %rbp
+  802229:	48 89 e5             	mov    %rsp,%rbp
+  80222c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802230:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802234:	bf 66 00 00 00       	mov    $0x66,%edi
+  802239:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802240:	00 00 00 
+  802243:	ff d0                	call   *%rax
+  802245:	85 c0                	test   %eax,%eax
+  802247:	78 17                	js     802260 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80224d:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802254:	48 85 d2             	test   %rdx,%rdx
+  802257:	74 09                	je     802262 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225e:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+        return -E_NOT_SUPP;
+  802262:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802267:	eb f7                	jmp    802260 <free_space_bytes+0x38>
+
+0000000000802269 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802271:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802275:	bf 66 00 00 00       	mov    $0x66,%edi
+  80227a:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 17                	js     8022a1 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80228a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80228e:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802295:	48 85 d2             	test   %rdx,%rdx
+  802298:	74 09                	je     8022a3 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80229a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229f:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022a1:	c9                   	leave
+  8022a2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022a3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022a8:	eb f7                	jmp    8022a1 <busy_space_bytes+0x38>
+
+00000000008022aa <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8022aa:	55                   	push   %rbp
+  8022ab:	48 89 e5             	mov    %rsp,%rbp
+  8022ae:	41 54                	push   %r12
+  8022b0:	53                   	push   %rbx
+  8022b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b5:	89 fb                	mov    %edi,%ebx
+  8022b7:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022ba:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022be:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022c3:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	85 c0                	test   %eax,%eax
+  8022d1:	78 17                	js     8022ea <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8022d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022d7:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8022de:	48 85 c0             	test   %rax,%rax
+  8022e1:	74 10                	je     8022f3 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8022e3:	4c 89 e6             	mov    %r12,%rsi
+  8022e6:	89 df                	mov    %ebx,%edi
+  8022e8:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8022ea:	48 83 c4 10          	add    $0x10,%rsp
+  8022ee:	5b                   	pop    %rbx
+  8022ef:	41 5c                	pop    %r12
+  8022f1:	5d                   	pop    %rbp
+  8022f2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022f3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022f8:	eb f0                	jmp    8022ea <snapshots_space+0x40>
+
+00000000008022fa <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8022fa:	55                   	push   %rbp
+  8022fb:	48 89 e5             	mov    %rsp,%rbp
+  8022fe:	41 55                	push   %r13
+  802300:	41 54                	push   %r12
+  802302:	53                   	push   %rbx
+  802303:	48 83 ec 08          	sub    $0x8,%rsp
+  802307:	41 89 fd             	mov    %edi,%r13d
+  80230a:	48 89 f3             	mov    %rsi,%rbx
+  80230d:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802310:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802317:	00 00 00 
+  80231a:	83 38 00             	cmpl   $0x0,(%rax)
+  80231d:	74 57                	je     802376 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80231f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802325:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80232a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802331:	00 00 00 
+  802334:	44 89 ee             	mov    %r13d,%esi
+  802337:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80233e:	00 00 00 
+  802341:	8b 38                	mov    (%rax),%edi
+  802343:	48 b8 be 39 80 00 00 	movabs $0x8039be,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80234f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802354:	4c 89 e2             	mov    %r12,%rdx
+  802357:	48 89 de             	mov    %rbx,%rsi
+  80235a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235f:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+}
+  80236b:	48 83 c4 08          	add    $0x8,%rsp
+  80236f:	5b                   	pop    %rbx
+  802370:	41 5c                	pop    %r12
+  802372:	41 5d                	pop    %r13
+  802374:	5d                   	pop    %rbp
+  802375:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802376:	bf 03 00 00 00       	mov    $0x3,%edi
+  80237b:	48 b8 7c 3a 80 00 00 	movabs $0x803a7c,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+  802387:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80238e:	00 00 
+  802390:	eb 8d                	jmp    80231f <fsipc_region+0x25>
+
+0000000000802392 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+  802396:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80239a:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8023a1:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8023a2:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8023a6:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+}
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+
+00000000008023b4 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8023b4:	85 ff                	test   %edi,%edi
+  8023b6:	78 6d                	js     802425 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8023c2:	48 85 f6             	test   %rsi,%rsi
+  8023c5:	74 57                	je     80241e <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8023c7:	89 f8                	mov    %edi,%eax
+  8023c9:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023d0:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8023d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d7:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023dc:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	78 2d                	js     802419 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8023ec:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8023f3:	00 00 00 
+  8023f6:	49 63 14 24          	movslq (%r12),%rdx
+  8023fa:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802401:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802406:	48 89 df             	mov    %rbx,%rdi
+  802409:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802415:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802419:	5b                   	pop    %rbx
+  80241a:	41 5c                	pop    %r12
+  80241c:	5d                   	pop    %rbp
+  80241d:	c3                   	ret
+        return -E_INVAL;
+  80241e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802423:	eb f4                	jmp    802419 <devfile_df_snapshots+0x65>
+  802425:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80242a:	c3                   	ret
+
+000000000080242b <devfile_df_busy>:
+devfile_df_busy() {
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80242f:	be 00 00 00 00       	mov    $0x0,%esi
+  802434:	bf 11 00 00 00       	mov    $0x11,%edi
+  802439:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+}
+  802445:	5d                   	pop    %rbp
+  802446:	c3                   	ret
+
+0000000000802447 <devfile_df_free>:
+devfile_df_free() {
+  802447:	55                   	push   %rbp
+  802448:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80244b:	be 00 00 00 00       	mov    $0x0,%esi
+  802450:	bf 10 00 00 00       	mov    $0x10,%edi
+  802455:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+}
+  802461:	5d                   	pop    %rbp
+  802462:	c3                   	ret
+
+0000000000802463 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802463:	55                   	push   %rbp
+  802464:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802467:	be 00 00 00 00       	mov    $0x0,%esi
+  80246c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802471:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+}
+  80247d:	5d                   	pop    %rbp
+  80247e:	c3                   	ret
+
+000000000080247f <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80247f:	55                   	push   %rbp
+  802480:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802483:	be 00 00 00 00       	mov    $0x0,%esi
+  802488:	bf 09 00 00 00       	mov    $0x9,%edi
+  80248d:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802499:	85 c0                	test   %eax,%eax
+  80249b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a0:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8024a3:	5d                   	pop    %rbp
+  8024a4:	c3                   	ret
+
+00000000008024a5 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8024a9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8024b0:	00 00 00 
+  8024b3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8024b6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8024b8:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8024bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024c5:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+}
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+
+00000000008024d3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8024d7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024da:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8024e1:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8024e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024ed:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+}
+  8024f9:	5d                   	pop    %rbp
+  8024fa:	c3                   	ret
+
+00000000008024fb <devfile_write>:
+    if (!fd || !buf) {
+  8024fb:	48 85 ff             	test   %rdi,%rdi
+  8024fe:	0f 84 c1 00 00 00    	je     8025c5 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	41 57                	push   %r15
+  80250a:	41 56                	push   %r14
+  80250c:	41 55                	push   %r13
+  80250e:	41 54                	push   %r12
+  802510:	53                   	push   %rbx
+  802511:	48 83 ec 18          	sub    $0x18,%rsp
+  802515:	49 89 ff             	mov    %rdi,%r15
+  802518:	49 89 f5             	mov    %rsi,%r13
+  80251b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80251e:	48 85 f6             	test   %rsi,%rsi
+  802521:	0f 84 95 00 00 00    	je     8025bc <devfile_write+0xc1>
+    while (n) {
+  802527:	48 85 d2             	test   %rdx,%rdx
+  80252a:	0f 84 83 00 00 00    	je     8025b3 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802530:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802537:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80253e:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802541:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802546:	49 39 dc             	cmp    %rbx,%r12
+  802549:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80254d:	48 89 da             	mov    %rbx,%rdx
+  802550:	4c 89 ee             	mov    %r13,%rsi
+  802553:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80255a:	00 00 00 
+  80255d:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  802564:	00 00 00 
+  802567:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802569:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80256d:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802570:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802574:	be 00 00 00 00       	mov    $0x0,%esi
+  802579:	bf 04 00 00 00       	mov    $0x4,%edi
+  80257e:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+        if (write < 0) {
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	78 21                	js     8025af <devfile_write+0xb4>
+        buf += write;
+  80258e:	48 63 d0             	movslq %eax,%rdx
+  802591:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802594:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802597:	49 29 d4             	sub    %rdx,%r12
+  80259a:	75 a5                	jne    802541 <devfile_write+0x46>
+    return totalWrite;
+  80259c:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8025a0:	48 83 c4 18          	add    $0x18,%rsp
+  8025a4:	5b                   	pop    %rbx
+  8025a5:	41 5c                	pop    %r12
+  8025a7:	41 5d                	pop    %r13
+  8025a9:	41 5e                	pop    %r14
+  8025ab:	41 5f                	pop    %r15
+  8025ad:	5d                   	pop    %rbp
+  8025ae:	c3                   	ret
+            return write;
+  8025af:	48 98                	cltq
+  8025b1:	eb ed                	jmp    8025a0 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8025b3:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8025ba:	eb e0                	jmp    80259c <devfile_write+0xa1>
+        return -E_INVAL;
+  8025bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025c3:	eb db                	jmp    8025a0 <devfile_write+0xa5>
+  8025c5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025cc:	c3                   	ret
+
+00000000008025cd <devfile_read>:
+    if (!fd || !buf) {
+  8025cd:	48 85 ff             	test   %rdi,%rdi
+  8025d0:	0f 84 c0 00 00 00    	je     802696 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025d6:	55                   	push   %rbp
+  8025d7:	48 89 e5             	mov    %rsp,%rbp
+  8025da:	41 57                	push   %r15
+  8025dc:	41 56                	push   %r14
+  8025de:	41 55                	push   %r13
+  8025e0:	41 54                	push   %r12
+  8025e2:	53                   	push   %rbx
+  8025e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8025e7:	49 89 ff             	mov    %rdi,%r15
+  8025ea:	49 89 f5             	mov    %rsi,%r13
+  8025ed:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8025f0:	48 85 f6             	test   %rsi,%rsi
+  8025f3:	0f 84 96 00 00 00    	je     80268f <devfile_read+0xc2>
+    while (n) {
+  8025f9:	48 85 d2             	test   %rdx,%rdx
+  8025fc:	0f 84 87 00 00 00    	je     802689 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802602:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802609:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80260a:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802611:	00 00 00 
+  802614:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802618:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80261b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802620:	49 39 c4             	cmp    %rax,%r12
+  802623:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802627:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80262b:	be 00 00 00 00       	mov    $0x0,%esi
+  802630:	bf 03 00 00 00       	mov    $0x3,%edi
+  802635:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802641:	85 c0                	test   %eax,%eax
+  802643:	7e 37                	jle    80267c <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802645:	48 63 d8             	movslq %eax,%rbx
+  802648:	48 89 da             	mov    %rbx,%rdx
+  80264b:	4c 89 f6             	mov    %r14,%rsi
+  80264e:	4c 89 ef             	mov    %r13,%rdi
+  802651:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+        buf += read;
+  80265d:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802660:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802664:	49 29 dc             	sub    %rbx,%r12
+  802667:	75 ab                	jne    802614 <devfile_read+0x47>
+  return totalRead;
+  802669:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80266d:	48 83 c4 18          	add    $0x18,%rsp
+  802671:	5b                   	pop    %rbx
+  802672:	41 5c                	pop    %r12
+  802674:	41 5d                	pop    %r13
+  802676:	41 5e                	pop    %r14
+  802678:	41 5f                	pop    %r15
+  80267a:	5d                   	pop    %rbp
+  80267b:	c3                   	ret
+            return read ? read : totalRead;
+  80267c:	48 63 d0             	movslq %eax,%rdx
+  80267f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802683:	48 0f 45 c2          	cmovne %rdx,%rax
+  802687:	eb e4                	jmp    80266d <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802689:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80268d:	eb da                	jmp    802669 <devfile_read+0x9c>
+        return E_INVAL;
+  80268f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802694:	eb d7                	jmp    80266d <devfile_read+0xa0>
+  802696:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80269b:	c3                   	ret
+
+000000000080269c <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80269c:	48 85 ff             	test   %rdi,%rdi
+  80269f:	74 5f                	je     802700 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+  8026a5:	53                   	push   %rbx
+  8026a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026aa:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026ad:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  8026b4:	00 00 00 
+  8026b7:	ff d0                	call   *%rax
+  8026b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026bf:	77 45                	ja     802706 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8026c1:	48 89 de             	mov    %rbx,%rsi
+  8026c4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8026cb:	00 00 00 
+  8026ce:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  8026d5:	00 00 00 
+  8026d8:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8026da:	be 00 00 00 00       	mov    $0x0,%esi
+  8026df:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026e4:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f7:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026fe:	c9                   	leave
+  8026ff:	c3                   	ret
+        return -E_INVAL;
+  802700:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802705:	c3                   	ret
+        return -E_INVAL;
+  802706:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80270b:	eb ed                	jmp    8026fa <devfile_receive_snapshot+0x5e>
+
+000000000080270d <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80270d:	55                   	push   %rbp
+  80270e:	48 89 e5             	mov    %rsp,%rbp
+  802711:	41 55                	push   %r13
+  802713:	41 54                	push   %r12
+  802715:	53                   	push   %rbx
+  802716:	48 83 ec 08          	sub    $0x8,%rsp
+  80271a:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80271d:	48 85 f6             	test   %rsi,%rsi
+  802720:	0f 94 c0             	sete   %al
+  802723:	48 85 d2             	test   %rdx,%rdx
+  802726:	0f 94 c2             	sete   %dl
+  802729:	08 d0                	or     %dl,%al
+  80272b:	0f 85 ad 00 00 00    	jne    8027de <devfile_send_snapshot+0xd1>
+  802731:	48 89 fb             	mov    %rdi,%rbx
+  802734:	49 89 f4             	mov    %rsi,%r12
+  802737:	48 85 ff             	test   %rdi,%rdi
+  80273a:	0f 84 9e 00 00 00    	je     8027de <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802740:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802747:	00 00 00 
+  80274a:	ff d0                	call   *%rax
+  80274c:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802752:	0f 87 8d 00 00 00    	ja     8027e5 <devfile_send_snapshot+0xd8>
+  802758:	4c 89 e7             	mov    %r12,%rdi
+  80275b:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+  802767:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80276d:	77 7d                	ja     8027ec <devfile_send_snapshot+0xdf>
+  80276f:	4c 89 ef             	mov    %r13,%rdi
+  802772:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+  80277e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802784:	77 6d                	ja     8027f3 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802786:	48 89 de             	mov    %rbx,%rsi
+  802789:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802790:	00 00 00 
+  802793:	48 bb 11 0c 80 00 00 	movabs $0x800c11,%rbx
+  80279a:	00 00 00 
+  80279d:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80279f:	4c 89 e6             	mov    %r12,%rsi
+  8027a2:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8027a9:	00 00 00 
+  8027ac:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8027ae:	4c 89 ee             	mov    %r13,%rsi
+  8027b1:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8027b8:	00 00 00 
+  8027bb:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8027bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c2:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027c7:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+}
+  8027d3:	48 83 c4 08          	add    $0x8,%rsp
+  8027d7:	5b                   	pop    %rbx
+  8027d8:	41 5c                	pop    %r12
+  8027da:	41 5d                	pop    %r13
+  8027dc:	5d                   	pop    %rbp
+  8027dd:	c3                   	ret
+        return -E_INVAL;
+  8027de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e3:	eb ee                	jmp    8027d3 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8027e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ea:	eb e7                	jmp    8027d3 <devfile_send_snapshot+0xc6>
+  8027ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027f1:	eb e0                	jmp    8027d3 <devfile_send_snapshot+0xc6>
+  8027f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027f8:	eb d9                	jmp    8027d3 <devfile_send_snapshot+0xc6>
+
+00000000008027fa <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8027fa:	48 85 ff             	test   %rdi,%rdi
+  8027fd:	0f 84 41 01 00 00    	je     802944 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+  802807:	41 57                	push   %r15
+  802809:	41 56                	push   %r14
+  80280b:	41 55                	push   %r13
+  80280d:	41 54                	push   %r12
+  80280f:	53                   	push   %rbx
+  802810:	48 83 ec 08          	sub    $0x8,%rsp
+  802814:	49 89 fc             	mov    %rdi,%r12
+  802817:	49 89 f5             	mov    %rsi,%r13
+  80281a:	48 89 d3             	mov    %rdx,%rbx
+  80281d:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802820:	48 85 f6             	test   %rsi,%rsi
+  802823:	0f 84 ff 00 00 00    	je     802928 <devfile_diff_snapshots+0x12e>
+  802829:	48 85 d2             	test   %rdx,%rdx
+  80282c:	0f 84 fd 00 00 00    	je     80292f <devfile_diff_snapshots+0x135>
+  802832:	48 85 c9             	test   %rcx,%rcx
+  802835:	0f 84 f4 00 00 00    	je     80292f <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80283b:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802842:	00 00 00 
+  802845:	ff d0                	call   *%rax
+  802847:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80284d:	0f 87 e3 00 00 00    	ja     802936 <devfile_diff_snapshots+0x13c>
+  802853:	4c 89 ef             	mov    %r13,%rdi
+  802856:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802868:	0f 87 cf 00 00 00    	ja     80293d <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80286e:	4c 89 e6             	mov    %r12,%rsi
+  802871:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802878:	00 00 00 
+  80287b:	4c 89 e7             	mov    %r12,%rdi
+  80287e:	49 bf 11 0c 80 00 00 	movabs $0x800c11,%r15
+  802885:	00 00 00 
+  802888:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80288b:	4c 89 ee             	mov    %r13,%rsi
+  80288e:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802895:	00 
+  802896:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802899:	48 8b 03             	mov    (%rbx),%rax
+  80289c:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8028a3:	00 
+  8028a4:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8028a8:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8028af:	00 
+  8028b0:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8028b4:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8028bb:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8028bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028c6:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	78 43                	js     802919 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8028d6:	49 8b 04 24          	mov    (%r12),%rax
+  8028da:	48 89 03             	mov    %rax,(%rbx)
+  8028dd:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8028e2:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8028e6:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8028eb:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8028ef:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8028f4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8028f8:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8028fc:	48 c1 e2 03          	shl    $0x3,%rdx
+  802900:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802905:	4c 89 f7             	mov    %r14,%rdi
+  802908:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802914:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802919:	48 83 c4 08          	add    $0x8,%rsp
+  80291d:	5b                   	pop    %rbx
+  80291e:	41 5c                	pop    %r12
+  802920:	41 5d                	pop    %r13
+  802922:	41 5e                	pop    %r14
+  802924:	41 5f                	pop    %r15
+  802926:	5d                   	pop    %rbp
+  802927:	c3                   	ret
+        return -E_INVAL;
+  802928:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80292d:	eb ea                	jmp    802919 <devfile_diff_snapshots+0x11f>
+  80292f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802934:	eb e3                	jmp    802919 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802936:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80293b:	eb dc                	jmp    802919 <devfile_diff_snapshots+0x11f>
+  80293d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802942:	eb d5                	jmp    802919 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802944:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802949:	c3                   	ret
+
+000000000080294a <devfile_delete_snapshot>:
+    if (!name) {
+  80294a:	48 85 ff             	test   %rdi,%rdi
+  80294d:	74 5f                	je     8029ae <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80294f:	55                   	push   %rbp
+  802950:	48 89 e5             	mov    %rsp,%rbp
+  802953:	53                   	push   %rbx
+  802954:	48 83 ec 08          	sub    $0x8,%rsp
+  802958:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80295b:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80296d:	77 45                	ja     8029b4 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80296f:	48 89 de             	mov    %rbx,%rsi
+  802972:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802979:	00 00 00 
+  80297c:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802988:	be 00 00 00 00       	mov    $0x0,%esi
+  80298d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802992:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802999:	00 00 00 
+  80299c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80299e:	85 c0                	test   %eax,%eax
+  8029a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+        return -E_INVAL;
+  8029ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029b3:	c3                   	ret
+        return -E_INVAL;
+  8029b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b9:	eb ed                	jmp    8029a8 <devfile_delete_snapshot+0x5e>
+
+00000000008029bb <devfile_accept_snapshot>:
+    if (!name) {
+  8029bb:	48 85 ff             	test   %rdi,%rdi
+  8029be:	74 5f                	je     802a1f <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	53                   	push   %rbx
+  8029c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c9:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029cc:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029de:	77 45                	ja     802a25 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8029e0:	48 89 de             	mov    %rbx,%rsi
+  8029e3:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029ea:	00 00 00 
+  8029ed:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8029f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a03:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a0f:	85 c0                	test   %eax,%eax
+  802a11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a16:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a1d:	c9                   	leave
+  802a1e:	c3                   	ret
+        return -E_INVAL;
+  802a1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a24:	c3                   	ret
+        return -E_INVAL;
+  802a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a2a:	eb ed                	jmp    802a19 <devfile_accept_snapshot+0x5e>
+
+0000000000802a2c <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802a2c:	48 85 ff             	test   %rdi,%rdi
+  802a2f:	0f 84 9f 00 00 00    	je     802ad4 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	41 54                	push   %r12
+  802a3b:	53                   	push   %rbx
+  802a3c:	48 89 fb             	mov    %rdi,%rbx
+  802a3f:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802a42:	48 85 f6             	test   %rsi,%rsi
+  802a45:	74 78                	je     802abf <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802a47:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802a4e:	00 00 00 
+  802a51:	ff d0                	call   *%rax
+  802a53:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a59:	77 6b                	ja     802ac6 <devfile_create_snapshot+0x9a>
+  802a5b:	4c 89 e7             	mov    %r12,%rdi
+  802a5e:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+  802a6a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a70:	77 5b                	ja     802acd <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802a72:	48 89 de             	mov    %rbx,%rsi
+  802a75:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a7c:	00 00 00 
+  802a7f:	48 bb 11 0c 80 00 00 	movabs $0x800c11,%rbx
+  802a86:	00 00 00 
+  802a89:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802a8b:	4c 89 e6             	mov    %r12,%rsi
+  802a8e:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802a95:	00 00 00 
+  802a98:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802a9a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802aa4:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab7:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802aba:	5b                   	pop    %rbx
+  802abb:	41 5c                	pop    %r12
+  802abd:	5d                   	pop    %rbp
+  802abe:	c3                   	ret
+        return -E_INVAL;
+  802abf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac4:	eb f4                	jmp    802aba <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802acb:	eb ed                	jmp    802aba <devfile_create_snapshot+0x8e>
+  802acd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad2:	eb e6                	jmp    802aba <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802ad4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ad9:	c3                   	ret
+
+0000000000802ada <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ada:	55                   	push   %rbp
+  802adb:	48 89 e5             	mov    %rsp,%rbp
+  802ade:	41 54                	push   %r12
+  802ae0:	53                   	push   %rbx
+  802ae1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ae4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802ae7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802aee:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802af0:	be 00 00 00 00       	mov    $0x0,%esi
+  802af5:	bf 05 00 00 00       	mov    $0x5,%edi
+  802afa:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b06:	85 c0                	test   %eax,%eax
+  802b08:	78 3d                	js     802b47 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b0a:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802b11:	00 00 00 
+  802b14:	4c 89 e6             	mov    %r12,%rsi
+  802b17:	48 89 df             	mov    %rbx,%rdi
+  802b1a:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b26:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b2d:	00 
+  802b2e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b34:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b3b:	00 
+  802b3c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b47:	5b                   	pop    %rbx
+  802b48:	41 5c                	pop    %r12
+  802b4a:	5d                   	pop    %rbp
+  802b4b:	c3                   	ret
+
+0000000000802b4c <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802b4c:	55                   	push   %rbp
+  802b4d:	48 89 e5             	mov    %rsp,%rbp
+  802b50:	41 57                	push   %r15
+  802b52:	41 56                	push   %r14
+  802b54:	41 55                	push   %r13
+  802b56:	41 54                	push   %r12
+  802b58:	53                   	push   %rbx
+  802b59:	48 83 ec 38          	sub    $0x38,%rsp
+  802b5d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802b61:	49 89 f5             	mov    %rsi,%r13
+  802b64:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b67:	48 89 f0             	mov    %rsi,%rax
+  802b6a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b6f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b73:	75 4f                	jne    802bc4 <devfile_readmap+0x78>
+  802b75:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b79:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b7f:	75 1f                	jne    802ba0 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802b81:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b85:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b89:	49 be d8 34 80 00 00 	movabs $0x8034d8,%r14
+  802b90:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b93:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802b9a:	0f 87 9d 00 00 00    	ja     802c3d <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ba0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ba4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802ba8:	4d 85 ff             	test   %r15,%r15
+  802bab:	0f 85 cf 00 00 00    	jne    802c80 <devfile_readmap+0x134>
+  802bb1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802bb5:	48 83 c4 38          	add    $0x38,%rsp
+  802bb9:	5b                   	pop    %rbx
+  802bba:	41 5c                	pop    %r12
+  802bbc:	41 5d                	pop    %r13
+  802bbe:	41 5e                	pop    %r14
+  802bc0:	41 5f                	pop    %r15
+  802bc2:	5d                   	pop    %rbp
+  802bc3:	c3                   	ret
+    size_t totalRead = 0;
+  802bc4:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802bcb:	00 
+  802bcc:	eb da                	jmp    802ba8 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bce:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bd2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bd5:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802bdc:	00 00 00 
+  802bdf:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802be5:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802be9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802bed:	4c 89 ee             	mov    %r13,%rsi
+  802bf0:	bf 14 00 00 00       	mov    $0x14,%edi
+  802bf5:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	7e a3                	jle    802ba8 <devfile_readmap+0x5c>
+  802c05:	48 98                	cltq
+  802c07:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c0b:	72 9b                	jb     802ba8 <devfile_readmap+0x5c>
+        buf += read;
+  802c0d:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c10:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c13:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c17:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c1e:	75 88                	jne    802ba8 <devfile_readmap+0x5c>
+  802c20:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c24:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c2a:	0f 85 78 ff ff ff    	jne    802ba8 <devfile_readmap+0x5c>
+  802c30:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802c37:	0f 86 6b ff ff ff    	jbe    802ba8 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802c3d:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802c43:	4d 39 e7             	cmp    %r12,%r15
+  802c46:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802c4a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802c51:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c55:	0f 84 73 ff ff ff    	je     802bce <devfile_readmap+0x82>
+  802c5b:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c5f:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802c64:	41 ff d6             	call   *%r14
+  802c67:	a8 40                	test   $0x40,%al
+  802c69:	0f 85 39 ff ff ff    	jne    802ba8 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c6f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c76:	4c 39 e3             	cmp    %r12,%rbx
+  802c79:	72 e4                	jb     802c5f <devfile_readmap+0x113>
+  802c7b:	e9 4e ff ff ff       	jmp    802bce <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802c80:	4c 89 fa             	mov    %r15,%rdx
+  802c83:	4c 89 ee             	mov    %r13,%rsi
+  802c86:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c8a:	48 b8 cd 25 80 00 00 	movabs $0x8025cd,%rax
+  802c91:	00 00 00 
+  802c94:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802c96:	48 85 c0             	test   %rax,%rax
+  802c99:	78 0c                	js     802ca7 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802c9b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c9f:	48 01 f0             	add    %rsi,%rax
+  802ca2:	e9 0e ff ff ff       	jmp    802bb5 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802ca7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cab:	48 85 f6             	test   %rsi,%rsi
+  802cae:	48 0f 45 c6          	cmovne %rsi,%rax
+  802cb2:	e9 fe fe ff ff       	jmp    802bb5 <devfile_readmap+0x69>
+
+0000000000802cb7 <open>:
+open(const char *path, int mode) {
+  802cb7:	55                   	push   %rbp
+  802cb8:	48 89 e5             	mov    %rsp,%rbp
+  802cbb:	41 55                	push   %r13
+  802cbd:	41 54                	push   %r12
+  802cbf:	53                   	push   %rbx
+  802cc0:	48 83 ec 18          	sub    $0x18,%rsp
+  802cc4:	49 89 fc             	mov    %rdi,%r12
+  802cc7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cca:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cdc:	0f 87 8a 00 00 00    	ja     802d6c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ce2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ce6:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  802ced:	00 00 00 
+  802cf0:	ff d0                	call   *%rax
+  802cf2:	89 c3                	mov    %eax,%ebx
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	78 50                	js     802d48 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802cf8:	4c 89 e6             	mov    %r12,%rsi
+  802cfb:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802d02:	00 00 00 
+  802d05:	48 89 df             	mov    %rbx,%rdi
+  802d08:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  802d0f:	00 00 00 
+  802d12:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d14:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d1b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d1f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d24:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+  802d30:	89 c3                	mov    %eax,%ebx
+  802d32:	85 c0                	test   %eax,%eax
+  802d34:	78 1f                	js     802d55 <open+0x9e>
+    return fd2num(fd);
+  802d36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d3a:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	89 c3                	mov    %eax,%ebx
+}
+  802d48:	89 d8                	mov    %ebx,%eax
+  802d4a:	48 83 c4 18          	add    $0x18,%rsp
+  802d4e:	5b                   	pop    %rbx
+  802d4f:	41 5c                	pop    %r12
+  802d51:	41 5d                	pop    %r13
+  802d53:	5d                   	pop    %rbp
+  802d54:	c3                   	ret
+        fd_close(fd, 0);
+  802d55:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d5e:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+        return res;
+  802d6a:	eb dc                	jmp    802d48 <open+0x91>
+        return -E_BAD_PATH;
+  802d6c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d71:	eb d5                	jmp    802d48 <open+0x91>
+
+0000000000802d73 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802d73:	55                   	push   %rbp
+  802d74:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802d77:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d81:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+}
+  802d8d:	5d                   	pop    %rbp
+  802d8e:	c3                   	ret
+
+0000000000802d8f <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802d8f:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802d93:	7f 01                	jg     802d96 <writebuf+0x7>
+  802d95:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802d96:	55                   	push   %rbp
+  802d97:	48 89 e5             	mov    %rsp,%rbp
+  802d9a:	53                   	push   %rbx
+  802d9b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d9f:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802da2:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802da6:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802daa:	8b 3f                	mov    (%rdi),%edi
+  802dac:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802db8:	48 85 c0             	test   %rax,%rax
+  802dbb:	7e 04                	jle    802dc1 <writebuf+0x32>
+  802dbd:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802dc1:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802dc5:	48 39 c2             	cmp    %rax,%rdx
+  802dc8:	74 0f                	je     802dd9 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802dca:	48 85 c0             	test   %rax,%rax
+  802dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd2:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802dd6:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802dd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ddd:	c9                   	leave
+  802dde:	c3                   	ret
+
+0000000000802ddf <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802ddf:	8b 46 04             	mov    0x4(%rsi),%eax
+  802de2:	8d 50 01             	lea    0x1(%rax),%edx
+  802de5:	89 56 04             	mov    %edx,0x4(%rsi)
+  802de8:	48 98                	cltq
+  802dea:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802def:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802df5:	74 01                	je     802df8 <putch+0x19>
+  802df7:	c3                   	ret
+putch(int ch, void *arg) {
+  802df8:	55                   	push   %rbp
+  802df9:	48 89 e5             	mov    %rsp,%rbp
+  802dfc:	53                   	push   %rbx
+  802dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802e01:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802e04:	48 89 f7             	mov    %rsi,%rdi
+  802e07:	48 b8 8f 2d 80 00 00 	movabs $0x802d8f,%rax
+  802e0e:	00 00 00 
+  802e11:	ff d0                	call   *%rax
+        state->offset = 0;
+  802e13:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802e1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e1e:	c9                   	leave
+  802e1f:	c3                   	ret
+
+0000000000802e20 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802e20:	55                   	push   %rbp
+  802e21:	48 89 e5             	mov    %rsp,%rbp
+  802e24:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802e2b:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802e2e:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802e34:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802e3b:	00 00 00 
+    state.result = 0;
+  802e3e:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802e45:	00 00 00 00 
+    state.error = 1;
+  802e49:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802e50:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802e53:	48 89 f2             	mov    %rsi,%rdx
+  802e56:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802e5d:	48 bf df 2d 80 00 00 	movabs $0x802ddf,%rdi
+  802e64:	00 00 00 
+  802e67:	48 b8 3c 04 80 00 00 	movabs $0x80043c,%rax
+  802e6e:	00 00 00 
+  802e71:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802e73:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802e7a:	7f 14                	jg     802e90 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802e7c:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802e83:	48 85 c0             	test   %rax,%rax
+  802e86:	75 06                	jne    802e8e <vfprintf+0x6e>
+  802e88:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802e90:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802e97:	48 b8 8f 2d 80 00 00 	movabs $0x802d8f,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	eb d7                	jmp    802e7c <vfprintf+0x5c>
+
+0000000000802ea5 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802ea5:	55                   	push   %rbp
+  802ea6:	48 89 e5             	mov    %rsp,%rbp
+  802ea9:	48 83 ec 50          	sub    $0x50,%rsp
+  802ead:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802eb1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802eb5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802eb9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802ebd:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802ec4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ecc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802ed0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802ed4:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802ed8:	48 b8 20 2e 80 00 00 	movabs $0x802e20,%rax
+  802edf:	00 00 00 
+  802ee2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802ee4:	c9                   	leave
+  802ee5:	c3                   	ret
+
+0000000000802ee6 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  802ee6:	55                   	push   %rbp
+  802ee7:	48 89 e5             	mov    %rsp,%rbp
+  802eea:	48 83 ec 50          	sub    $0x50,%rsp
+  802eee:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802ef2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802ef6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802efa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802efe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802f02:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802f09:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f11:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802f19:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802f1d:	48 89 fe             	mov    %rdi,%rsi
+  802f20:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f25:	48 b8 20 2e 80 00 00 	movabs $0x802e20,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+0000000000802f33 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f33:	55                   	push   %rbp
+  802f34:	48 89 e5             	mov    %rsp,%rbp
+  802f37:	41 54                	push   %r12
+  802f39:	53                   	push   %rbx
+  802f3a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f3d:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+  802f49:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f4c:	48 be 40 41 80 00 00 	movabs $0x804140,%rsi
+  802f53:	00 00 00 
+  802f56:	48 89 df             	mov    %rbx,%rdi
+  802f59:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f65:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f6a:	41 2b 04 24          	sub    (%r12),%eax
+  802f6e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f74:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f7b:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f7e:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f85:	00 00 00 
+  802f88:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f94:	5b                   	pop    %rbx
+  802f95:	41 5c                	pop    %r12
+  802f97:	5d                   	pop    %rbp
+  802f98:	c3                   	ret
+
+0000000000802f99 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f99:	55                   	push   %rbp
+  802f9a:	48 89 e5             	mov    %rsp,%rbp
+  802f9d:	41 54                	push   %r12
+  802f9f:	53                   	push   %rbx
+  802fa0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fa3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa8:	48 89 fe             	mov    %rdi,%rsi
+  802fab:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb0:	49 bc 69 13 80 00 00 	movabs $0x801369,%r12
+  802fb7:	00 00 00 
+  802fba:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fbd:	48 89 df             	mov    %rbx,%rdi
+  802fc0:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	48 89 c6             	mov    %rax,%rsi
+  802fcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd9:	41 ff d4             	call   *%r12
+}
+  802fdc:	5b                   	pop    %rbx
+  802fdd:	41 5c                	pop    %r12
+  802fdf:	5d                   	pop    %rbp
+  802fe0:	c3                   	ret
+
+0000000000802fe1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fe1:	55                   	push   %rbp
+  802fe2:	48 89 e5             	mov    %rsp,%rbp
+  802fe5:	41 57                	push   %r15
+  802fe7:	41 56                	push   %r14
+  802fe9:	41 55                	push   %r13
+  802feb:	41 54                	push   %r12
+  802fed:	53                   	push   %rbx
+  802fee:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff2:	49 89 fc             	mov    %rdi,%r12
+  802ff5:	49 89 f5             	mov    %rsi,%r13
+  802ff8:	49 89 d7             	mov    %rdx,%r15
+  802ffb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fff:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80300b:	4d 85 ff             	test   %r15,%r15
+  80300e:	0f 84 af 00 00 00    	je     8030c3 <devpipe_write+0xe2>
+  803014:	48 89 c3             	mov    %rax,%rbx
+  803017:	4c 89 f8             	mov    %r15,%rax
+  80301a:	4d 89 ef             	mov    %r13,%r15
+  80301d:	4c 01 e8             	add    %r13,%rax
+  803020:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803024:	49 bd 71 12 80 00 00 	movabs $0x801271,%r13
+  80302b:	00 00 00 
+            sys_yield();
+  80302e:	49 be 0e 12 80 00 00 	movabs $0x80120e,%r14
+  803035:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803038:	8b 73 04             	mov    0x4(%rbx),%esi
+  80303b:	48 63 ce             	movslq %esi,%rcx
+  80303e:	48 63 03             	movslq (%rbx),%rax
+  803041:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803047:	48 39 c1             	cmp    %rax,%rcx
+  80304a:	72 2e                	jb     80307a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80304c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803051:	48 89 da             	mov    %rbx,%rdx
+  803054:	be 00 10 00 00       	mov    $0x1000,%esi
+  803059:	4c 89 e7             	mov    %r12,%rdi
+  80305c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80305f:	85 c0                	test   %eax,%eax
+  803061:	74 66                	je     8030c9 <devpipe_write+0xe8>
+            sys_yield();
+  803063:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803066:	8b 73 04             	mov    0x4(%rbx),%esi
+  803069:	48 63 ce             	movslq %esi,%rcx
+  80306c:	48 63 03             	movslq (%rbx),%rax
+  80306f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803075:	48 39 c1             	cmp    %rax,%rcx
+  803078:	73 d2                	jae    80304c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80307a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80307e:	48 89 ca             	mov    %rcx,%rdx
+  803081:	48 c1 ea 03          	shr    $0x3,%rdx
+  803085:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80308c:	08 10 20 
+  80308f:	48 f7 e2             	mul    %rdx
+  803092:	48 c1 ea 06          	shr    $0x6,%rdx
+  803096:	48 89 d0             	mov    %rdx,%rax
+  803099:	48 c1 e0 09          	shl    $0x9,%rax
+  80309d:	48 29 d0             	sub    %rdx,%rax
+  8030a0:	48 c1 e0 03          	shl    $0x3,%rax
+  8030a4:	48 29 c1             	sub    %rax,%rcx
+  8030a7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030ac:	83 c6 01             	add    $0x1,%esi
+  8030af:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030b2:	49 83 c7 01          	add    $0x1,%r15
+  8030b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030ba:	49 39 c7             	cmp    %rax,%r15
+  8030bd:	0f 85 75 ff ff ff    	jne    803038 <devpipe_write+0x57>
+    return n;
+  8030c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030c7:	eb 05                	jmp    8030ce <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ce:	48 83 c4 18          	add    $0x18,%rsp
+  8030d2:	5b                   	pop    %rbx
+  8030d3:	41 5c                	pop    %r12
+  8030d5:	41 5d                	pop    %r13
+  8030d7:	41 5e                	pop    %r14
+  8030d9:	41 5f                	pop    %r15
+  8030db:	5d                   	pop    %rbp
+  8030dc:	c3                   	ret
+
+00000000008030dd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030dd:	55                   	push   %rbp
+  8030de:	48 89 e5             	mov    %rsp,%rbp
+  8030e1:	41 57                	push   %r15
+  8030e3:	41 56                	push   %r14
+  8030e5:	41 55                	push   %r13
+  8030e7:	41 54                	push   %r12
+  8030e9:	53                   	push   %rbx
+  8030ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8030ee:	49 89 fc             	mov    %rdi,%r12
+  8030f1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030f5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030f9:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+  803105:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803108:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80310e:	49 bd 71 12 80 00 00 	movabs $0x801271,%r13
+  803115:	00 00 00 
+            sys_yield();
+  803118:	49 be 0e 12 80 00 00 	movabs $0x80120e,%r14
+  80311f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803122:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803127:	74 7d                	je     8031a6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803129:	8b 03                	mov    (%rbx),%eax
+  80312b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80312e:	75 26                	jne    803156 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803130:	4d 85 ff             	test   %r15,%r15
+  803133:	75 77                	jne    8031ac <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803135:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80313a:	48 89 da             	mov    %rbx,%rdx
+  80313d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803142:	4c 89 e7             	mov    %r12,%rdi
+  803145:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	74 72                	je     8031be <devpipe_read+0xe1>
+            sys_yield();
+  80314c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80314f:	8b 03                	mov    (%rbx),%eax
+  803151:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803154:	74 df                	je     803135 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803156:	48 63 c8             	movslq %eax,%rcx
+  803159:	48 89 ca             	mov    %rcx,%rdx
+  80315c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803160:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803167:	08 10 20 
+  80316a:	48 89 d0             	mov    %rdx,%rax
+  80316d:	48 f7 e6             	mul    %rsi
+  803170:	48 c1 ea 06          	shr    $0x6,%rdx
+  803174:	48 89 d0             	mov    %rdx,%rax
+  803177:	48 c1 e0 09          	shl    $0x9,%rax
+  80317b:	48 29 d0             	sub    %rdx,%rax
+  80317e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803185:	00 
+  803186:	48 89 c8             	mov    %rcx,%rax
+  803189:	48 29 d0             	sub    %rdx,%rax
+  80318c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803191:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803195:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803199:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80319c:	49 83 c7 01          	add    $0x1,%r15
+  8031a0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8031a4:	75 83                	jne    803129 <devpipe_read+0x4c>
+    return n;
+  8031a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031aa:	eb 03                	jmp    8031af <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031ac:	4c 89 f8             	mov    %r15,%rax
+}
+  8031af:	48 83 c4 18          	add    $0x18,%rsp
+  8031b3:	5b                   	pop    %rbx
+  8031b4:	41 5c                	pop    %r12
+  8031b6:	41 5d                	pop    %r13
+  8031b8:	41 5e                	pop    %r14
+  8031ba:	41 5f                	pop    %r15
+  8031bc:	5d                   	pop    %rbp
+  8031bd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c3:	eb ea                	jmp    8031af <devpipe_read+0xd2>
+
+00000000008031c5 <pipe>:
+pipe(int pfd[2]) {
+  8031c5:	55                   	push   %rbp
+  8031c6:	48 89 e5             	mov    %rsp,%rbp
+  8031c9:	41 55                	push   %r13
+  8031cb:	41 54                	push   %r12
+  8031cd:	53                   	push   %rbx
+  8031ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8031d2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031d5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031d9:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+  8031e5:	89 c3                	mov    %eax,%ebx
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	0f 88 a0 01 00 00    	js     80338f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8031ef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031f9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803202:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  803209:	00 00 00 
+  80320c:	ff d0                	call   *%rax
+  80320e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803210:	85 c0                	test   %eax,%eax
+  803212:	0f 88 77 01 00 00    	js     80338f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803218:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80321c:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  803223:	00 00 00 
+  803226:	ff d0                	call   *%rax
+  803228:	89 c3                	mov    %eax,%ebx
+  80322a:	85 c0                	test   %eax,%eax
+  80322c:	0f 88 43 01 00 00    	js     803375 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803232:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803237:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80323c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803240:	bf 00 00 00 00       	mov    $0x0,%edi
+  803245:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+  803251:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803253:	85 c0                	test   %eax,%eax
+  803255:	0f 88 1a 01 00 00    	js     803375 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80325b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80325f:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+  80326b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80326e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803273:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803278:	48 89 c6             	mov    %rax,%rsi
+  80327b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803280:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  803287:	00 00 00 
+  80328a:	ff d0                	call   *%rax
+  80328c:	89 c3                	mov    %eax,%ebx
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	0f 88 c5 00 00 00    	js     80335b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803296:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80329a:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	48 89 c1             	mov    %rax,%rcx
+  8032a9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032af:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ba:	4c 89 ee             	mov    %r13,%rsi
+  8032bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c2:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+  8032ce:	89 c3                	mov    %eax,%ebx
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	78 6e                	js     803342 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032d4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032d9:	4c 89 ef             	mov    %r13,%rdi
+  8032dc:	48 b8 3f 12 80 00 00 	movabs $0x80123f,%rax
+  8032e3:	00 00 00 
+  8032e6:	ff d0                	call   *%rax
+  8032e8:	83 f8 02             	cmp    $0x2,%eax
+  8032eb:	0f 85 ab 00 00 00    	jne    80339c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8032f1:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8032f8:	00 00 
+  8032fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032fe:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803300:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803304:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80330b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80330f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803311:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803315:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80331c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803320:	48 bb e7 17 80 00 00 	movabs $0x8017e7,%rbx
+  803327:	00 00 00 
+  80332a:	ff d3                	call   *%rbx
+  80332c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803330:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803334:	ff d3                	call   *%rbx
+  803336:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80333b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803340:	eb 4d                	jmp    80338f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803342:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803347:	4c 89 ee             	mov    %r13,%rsi
+  80334a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80334f:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80335b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803360:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803364:	bf 00 00 00 00       	mov    $0x0,%edi
+  803369:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803375:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80337a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80337e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803383:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+}
+  80338f:	89 d8                	mov    %ebx,%eax
+  803391:	48 83 c4 18          	add    $0x18,%rsp
+  803395:	5b                   	pop    %rbx
+  803396:	41 5c                	pop    %r12
+  803398:	41 5d                	pop    %r13
+  80339a:	5d                   	pop    %rbp
+  80339b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80339c:	48 b9 70 41 80 00 00 	movabs $0x804170,%rcx
+  8033a3:	00 00 00 
+  8033a6:	48 ba 47 41 80 00 00 	movabs $0x804147,%rdx
+  8033ad:	00 00 00 
+  8033b0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033b5:	48 bf 5c 41 80 00 00 	movabs $0x80415c,%rdi
+  8033bc:	00 00 00 
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c4:	49 b8 1c 38 80 00 00 	movabs $0x80381c,%r8
+  8033cb:	00 00 00 
+  8033ce:	41 ff d0             	call   *%r8
+
+00000000008033d1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033d1:	55                   	push   %rbp
+  8033d2:	48 89 e5             	mov    %rsp,%rbp
+  8033d5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033d9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033dd:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  8033e4:	00 00 00 
+  8033e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033e9:	85 c0                	test   %eax,%eax
+  8033eb:	78 35                	js     803422 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8033ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033f1:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8033f8:	00 00 00 
+  8033fb:	ff d0                	call   *%rax
+  8033fd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803400:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803405:	be 00 10 00 00       	mov    $0x1000,%esi
+  80340a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80340e:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  803415:	00 00 00 
+  803418:	ff d0                	call   *%rax
+  80341a:	85 c0                	test   %eax,%eax
+  80341c:	0f 94 c0             	sete   %al
+  80341f:	0f b6 c0             	movzbl %al,%eax
+}
+  803422:	c9                   	leave
+  803423:	c3                   	ret
+
+0000000000803424 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803424:	48 89 f8             	mov    %rdi,%rax
+  803427:	48 c1 e8 27          	shr    $0x27,%rax
+  80342b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803432:	01 00 00 
+  803435:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803439:	f6 c2 01             	test   $0x1,%dl
+  80343c:	74 6d                	je     8034ab <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80343e:	48 89 f8             	mov    %rdi,%rax
+  803441:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803445:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80344c:	01 00 00 
+  80344f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803453:	f6 c2 01             	test   $0x1,%dl
+  803456:	74 62                	je     8034ba <get_uvpt_entry+0x96>
+  803458:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80345f:	01 00 00 
+  803462:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803466:	f6 c2 80             	test   $0x80,%dl
+  803469:	75 4f                	jne    8034ba <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80346b:	48 89 f8             	mov    %rdi,%rax
+  80346e:	48 c1 e8 15          	shr    $0x15,%rax
+  803472:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803479:	01 00 00 
+  80347c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803480:	f6 c2 01             	test   $0x1,%dl
+  803483:	74 44                	je     8034c9 <get_uvpt_entry+0xa5>
+  803485:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80348c:	01 00 00 
+  80348f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803493:	f6 c2 80             	test   $0x80,%dl
+  803496:	75 31                	jne    8034c9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803498:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80349c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034a3:	01 00 00 
+  8034a6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034aa:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034ab:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034b2:	01 00 00 
+  8034b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034b9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034ba:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034c1:	01 00 00 
+  8034c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034c8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034c9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034d0:	01 00 00 
+  8034d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034d7:	c3                   	ret
+
+00000000008034d8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8034d8:	55                   	push   %rbp
+  8034d9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034dc:	48 b8 24 34 80 00 00 	movabs $0x803424,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034eb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034f0:	89 c1                	mov    %eax,%ecx
+  8034f2:	83 c9 04             	or     $0x4,%ecx
+  8034f5:	f6 c2 01             	test   $0x1,%dl
+  8034f8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034fb:	89 c1                	mov    %eax,%ecx
+  8034fd:	83 c9 02             	or     $0x2,%ecx
+  803500:	f6 c2 02             	test   $0x2,%dl
+  803503:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803506:	89 c1                	mov    %eax,%ecx
+  803508:	83 c9 01             	or     $0x1,%ecx
+  80350b:	48 85 d2             	test   %rdx,%rdx
+  80350e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803511:	89 c1                	mov    %eax,%ecx
+  803513:	83 c9 40             	or     $0x40,%ecx
+  803516:	f6 c6 04             	test   $0x4,%dh
+  803519:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80351c:	5d                   	pop    %rbp
+  80351d:	c3                   	ret
+
+000000000080351e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80351e:	55                   	push   %rbp
+  80351f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803522:	48 b8 24 34 80 00 00 	movabs $0x803424,%rax
+  803529:	00 00 00 
+  80352c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80352e:	48 c1 e8 06          	shr    $0x6,%rax
+  803532:	83 e0 01             	and    $0x1,%eax
+}
+  803535:	5d                   	pop    %rbp
+  803536:	c3                   	ret
+
+0000000000803537 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803537:	55                   	push   %rbp
+  803538:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80353b:	48 b8 24 34 80 00 00 	movabs $0x803424,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803547:	48 c1 e8 05          	shr    $0x5,%rax
+  80354b:	83 e0 01             	and    $0x1,%eax
+}
+  80354e:	5d                   	pop    %rbp
+  80354f:	c3                   	ret
+
+0000000000803550 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803550:	55                   	push   %rbp
+  803551:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803554:	48 b8 24 34 80 00 00 	movabs $0x803424,%rax
+  80355b:	00 00 00 
+  80355e:	ff d0                	call   *%rax
+  803560:	83 e0 01             	and    $0x1,%eax
+}
+  803563:	5d                   	pop    %rbp
+  803564:	c3                   	ret
+
+0000000000803565 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803565:	55                   	push   %rbp
+  803566:	48 89 e5             	mov    %rsp,%rbp
+  803569:	41 57                	push   %r15
+  80356b:	41 56                	push   %r14
+  80356d:	41 55                	push   %r13
+  80356f:	41 54                	push   %r12
+  803571:	53                   	push   %rbx
+  803572:	48 83 ec 18          	sub    $0x18,%rsp
+  803576:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80357a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80357e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803583:	49 bd 50 35 80 00 00 	movabs $0x803550,%r13
+  80358a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80358d:	49 bf d8 34 80 00 00 	movabs $0x8034d8,%r15
+  803594:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803597:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80359e:	00 00 00 
+  8035a1:	eb 0c                	jmp    8035af <foreach_shared_region+0x4a>
+  8035a3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035aa:	4c 39 f3             	cmp    %r14,%rbx
+  8035ad:	74 2e                	je     8035dd <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035af:	48 89 df             	mov    %rbx,%rdi
+  8035b2:	41 ff d5             	call   *%r13
+  8035b5:	84 c0                	test   %al,%al
+  8035b7:	74 ea                	je     8035a3 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035b9:	48 89 df             	mov    %rbx,%rdi
+  8035bc:	41 ff d7             	call   *%r15
+  8035bf:	a8 40                	test   $0x40,%al
+  8035c1:	74 e0                	je     8035a3 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035c3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035ce:	48 89 df             	mov    %rbx,%rdi
+  8035d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d5:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	79 c8                	jns    8035a3 <foreach_shared_region+0x3e>
+  8035db:	eb 05                	jmp    8035e2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035e2:	48 83 c4 18          	add    $0x18,%rsp
+  8035e6:	5b                   	pop    %rbx
+  8035e7:	41 5c                	pop    %r12
+  8035e9:	41 5d                	pop    %r13
+  8035eb:	41 5e                	pop    %r14
+  8035ed:	41 5f                	pop    %r15
+  8035ef:	5d                   	pop    %rbp
+  8035f0:	c3                   	ret
+
+00000000008035f1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8035f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f6:	c3                   	ret
+
+00000000008035f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8035f7:	55                   	push   %rbp
+  8035f8:	48 89 e5             	mov    %rsp,%rbp
+  8035fb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8035fe:	48 be 94 41 80 00 00 	movabs $0x804194,%rsi
+  803605:	00 00 00 
+  803608:	48 b8 11 0c 80 00 00 	movabs $0x800c11,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+    return 0;
+}
+  803614:	b8 00 00 00 00       	mov    $0x0,%eax
+  803619:	5d                   	pop    %rbp
+  80361a:	c3                   	ret
+
+000000000080361b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	41 57                	push   %r15
+  803621:	41 56                	push   %r14
+  803623:	41 55                	push   %r13
+  803625:	41 54                	push   %r12
+  803627:	53                   	push   %rbx
+  803628:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80362f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803636:	48 85 d2             	test   %rdx,%rdx
+  803639:	74 7a                	je     8036b5 <devcons_write+0x9a>
+  80363b:	49 89 d6             	mov    %rdx,%r14
+  80363e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803644:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803649:	49 bf 0b 0e 80 00 00 	movabs $0x800e0b,%r15
+  803650:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803653:	4c 89 f3             	mov    %r14,%rbx
+  803656:	48 29 f3             	sub    %rsi,%rbx
+  803659:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80365e:	48 39 c3             	cmp    %rax,%rbx
+  803661:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803665:	4c 63 eb             	movslq %ebx,%r13
+  803668:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80366f:	48 01 c6             	add    %rax,%rsi
+  803672:	4c 89 ea             	mov    %r13,%rdx
+  803675:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80367c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80367f:	4c 89 ee             	mov    %r13,%rsi
+  803682:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803689:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803695:	41 01 dc             	add    %ebx,%r12d
+  803698:	49 63 f4             	movslq %r12d,%rsi
+  80369b:	4c 39 f6             	cmp    %r14,%rsi
+  80369e:	72 b3                	jb     803653 <devcons_write+0x38>
+    return res;
+  8036a0:	49 63 c4             	movslq %r12d,%rax
+}
+  8036a3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8036aa:	5b                   	pop    %rbx
+  8036ab:	41 5c                	pop    %r12
+  8036ad:	41 5d                	pop    %r13
+  8036af:	41 5e                	pop    %r14
+  8036b1:	41 5f                	pop    %r15
+  8036b3:	5d                   	pop    %rbp
+  8036b4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036bb:	eb e3                	jmp    8036a0 <devcons_write+0x85>
+
+00000000008036bd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036bd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c5:	48 85 c0             	test   %rax,%rax
+  8036c8:	74 55                	je     80371f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036ca:	55                   	push   %rbp
+  8036cb:	48 89 e5             	mov    %rsp,%rbp
+  8036ce:	41 55                	push   %r13
+  8036d0:	41 54                	push   %r12
+  8036d2:	53                   	push   %rbx
+  8036d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8036d7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036da:	48 bb 41 11 80 00 00 	movabs $0x801141,%rbx
+  8036e1:	00 00 00 
+  8036e4:	49 bc 0e 12 80 00 00 	movabs $0x80120e,%r12
+  8036eb:	00 00 00 
+  8036ee:	eb 03                	jmp    8036f3 <devcons_read+0x36>
+  8036f0:	41 ff d4             	call   *%r12
+  8036f3:	ff d3                	call   *%rbx
+  8036f5:	85 c0                	test   %eax,%eax
+  8036f7:	74 f7                	je     8036f0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8036f9:	48 63 d0             	movslq %eax,%rdx
+  8036fc:	78 13                	js     803711 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8036fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803703:	83 f8 04             	cmp    $0x4,%eax
+  803706:	74 09                	je     803711 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803708:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80370c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803711:	48 89 d0             	mov    %rdx,%rax
+  803714:	48 83 c4 08          	add    $0x8,%rsp
+  803718:	5b                   	pop    %rbx
+  803719:	41 5c                	pop    %r12
+  80371b:	41 5d                	pop    %r13
+  80371d:	5d                   	pop    %rbp
+  80371e:	c3                   	ret
+  80371f:	48 89 d0             	mov    %rdx,%rax
+  803722:	c3                   	ret
+
+0000000000803723 <cputchar>:
+cputchar(int ch) {
+  803723:	55                   	push   %rbp
+  803724:	48 89 e5             	mov    %rsp,%rbp
+  803727:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80372b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80372f:	be 01 00 00 00       	mov    $0x1,%esi
+  803734:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803738:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+}
+  803744:	c9                   	leave
+  803745:	c3                   	ret
+
+0000000000803746 <getchar>:
+getchar(void) {
+  803746:	55                   	push   %rbp
+  803747:	48 89 e5             	mov    %rsp,%rbp
+  80374a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80374e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803753:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80375c:	48 b8 58 1b 80 00 00 	movabs $0x801b58,%rax
+  803763:	00 00 00 
+  803766:	ff d0                	call   *%rax
+  803768:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	78 06                	js     803774 <getchar+0x2e>
+  80376e:	74 08                	je     803778 <getchar+0x32>
+  803770:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803774:	89 d0                	mov    %edx,%eax
+  803776:	c9                   	leave
+  803777:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803778:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80377d:	eb f5                	jmp    803774 <getchar+0x2e>
+
+000000000080377f <iscons>:
+iscons(int fdnum) {
+  80377f:	55                   	push   %rbp
+  803780:	48 89 e5             	mov    %rsp,%rbp
+  803783:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803787:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80378b:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803797:	85 c0                	test   %eax,%eax
+  803799:	78 18                	js     8037b3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80379b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80379f:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8037a6:	00 00 00 
+  8037a9:	8b 00                	mov    (%rax),%eax
+  8037ab:	39 02                	cmp    %eax,(%rdx)
+  8037ad:	0f 94 c0             	sete   %al
+  8037b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8037b3:	c9                   	leave
+  8037b4:	c3                   	ret
+
+00000000008037b5 <opencons>:
+opencons(void) {
+  8037b5:	55                   	push   %rbp
+  8037b6:	48 89 e5             	mov    %rsp,%rbp
+  8037b9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037bd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037c1:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  8037c8:	00 00 00 
+  8037cb:	ff d0                	call   *%rax
+  8037cd:	85 c0                	test   %eax,%eax
+  8037cf:	78 49                	js     80381a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037d1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037db:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e4:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	78 26                	js     80381a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8037f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037f8:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8037ff:	00 00 
+  803801:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803803:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803807:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80380e:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  803815:	00 00 00 
+  803818:	ff d0                	call   *%rax
+}
+  80381a:	c9                   	leave
+  80381b:	c3                   	ret
+
+000000000080381c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	41 56                	push   %r14
+  803822:	41 55                	push   %r13
+  803824:	41 54                	push   %r12
+  803826:	53                   	push   %rbx
+  803827:	48 83 ec 50          	sub    $0x50,%rsp
+  80382b:	49 89 fc             	mov    %rdi,%r12
+  80382e:	41 89 f5             	mov    %esi,%r13d
+  803831:	48 89 d3             	mov    %rdx,%rbx
+  803834:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803838:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80383c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803840:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803847:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80384b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80384f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803853:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803857:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80385e:	00 00 00 
+  803861:	4c 8b 30             	mov    (%rax),%r14
+  803864:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  80386b:	00 00 00 
+  80386e:	ff d0                	call   *%rax
+  803870:	89 c6                	mov    %eax,%esi
+  803872:	45 89 e8             	mov    %r13d,%r8d
+  803875:	4c 89 e1             	mov    %r12,%rcx
+  803878:	4c 89 f2             	mov    %r14,%rdx
+  80387b:	48 bf a0 41 80 00 00 	movabs $0x8041a0,%rdi
+  803882:	00 00 00 
+  803885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388a:	49 bc ec 02 80 00 00 	movabs $0x8002ec,%r12
+  803891:	00 00 00 
+  803894:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803897:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80389b:	48 89 df             	mov    %rbx,%rdi
+  80389e:	48 b8 88 02 80 00 00 	movabs $0x800288,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8038aa:	48 bf e8 3a 80 00 00 	movabs $0x803ae8,%rdi
+  8038b1:	00 00 00 
+  8038b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8038bc:	cc                   	int3
+  8038bd:	eb fd                	jmp    8038bc <_panic+0xa0>
+
+00000000008038bf <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8038bf:	55                   	push   %rbp
+  8038c0:	48 89 e5             	mov    %rsp,%rbp
+  8038c3:	41 55                	push   %r13
+  8038c5:	41 54                	push   %r12
+  8038c7:	53                   	push   %rbx
+  8038c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8038cc:	49 89 fc             	mov    %rdi,%r12
+  8038cf:	48 89 f7             	mov    %rsi,%rdi
+  8038d2:	48 89 d3             	mov    %rdx,%rbx
+  8038d5:	49 89 cd             	mov    %rcx,%r13
+  8038d8:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038db:	48 85 f6             	test   %rsi,%rsi
+  8038de:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038e5:	00 00 00 
+  8038e8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8038ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038f1:	48 85 db             	test   %rbx,%rbx
+  8038f4:	74 03                	je     8038f9 <ipc_recv_timed+0x3a>
+  8038f6:	48 8b 33             	mov    (%rbx),%rsi
+  8038f9:	48 b8 37 15 80 00 00 	movabs $0x801537,%rax
+  803900:	00 00 00 
+  803903:	ff d0                	call   *%rax
+    if (res < 0) {
+  803905:	85 c0                	test   %eax,%eax
+  803907:	78 75                	js     80397e <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803909:	4d 85 e4             	test   %r12,%r12
+  80390c:	74 14                	je     803922 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80390e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803915:	00 00 00 
+  803918:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80391e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803922:	4d 85 ed             	test   %r13,%r13
+  803925:	74 14                	je     80393b <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803927:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80392e:	00 00 00 
+  803931:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803937:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80393b:	48 85 db             	test   %rbx,%rbx
+  80393e:	74 23                	je     803963 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803940:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803947:	00 00 00 
+  80394a:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803950:	ba 00 00 00 00       	mov    $0x0,%edx
+  803955:	85 c9                	test   %ecx,%ecx
+  803957:	74 07                	je     803960 <ipc_recv_timed+0xa1>
+  803959:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803960:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803963:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80396a:	00 00 00 
+  80396d:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803973:	48 83 c4 08          	add    $0x8,%rsp
+  803977:	5b                   	pop    %rbx
+  803978:	41 5c                	pop    %r12
+  80397a:	41 5d                	pop    %r13
+  80397c:	5d                   	pop    %rbp
+  80397d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80397e:	4d 85 e4             	test   %r12,%r12
+  803981:	74 08                	je     80398b <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803983:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80398a:	00 
+        if (perm_store != NULL) {
+  80398b:	4d 85 ed             	test   %r13,%r13
+  80398e:	74 08                	je     803998 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803990:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803997:	00 
+        if (size != NULL) {
+  803998:	48 85 db             	test   %rbx,%rbx
+  80399b:	74 d6                	je     803973 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80399d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8039a4:	eb cd                	jmp    803973 <ipc_recv_timed+0xb4>
+
+00000000008039a6 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8039a6:	55                   	push   %rbp
+  8039a7:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8039aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8039b0:	48 b8 bf 38 80 00 00 	movabs $0x8038bf,%rax
+  8039b7:	00 00 00 
+  8039ba:	ff d0                	call   *%rax
+}
+  8039bc:	5d                   	pop    %rbp
+  8039bd:	c3                   	ret
+
+00000000008039be <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8039be:	55                   	push   %rbp
+  8039bf:	48 89 e5             	mov    %rsp,%rbp
+  8039c2:	41 57                	push   %r15
+  8039c4:	41 56                	push   %r14
+  8039c6:	41 55                	push   %r13
+  8039c8:	41 54                	push   %r12
+  8039ca:	53                   	push   %rbx
+  8039cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8039cf:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8039d2:	48 89 d3             	mov    %rdx,%rbx
+  8039d5:	49 89 cc             	mov    %rcx,%r12
+  8039d8:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8039db:	48 85 d2             	test   %rdx,%rdx
+  8039de:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039e5:	00 00 00 
+  8039e8:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039ec:	89 f0                	mov    %esi,%eax
+  8039ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039f2:	48 89 da             	mov    %rbx,%rdx
+  8039f5:	48 89 c6             	mov    %rax,%rsi
+  8039f8:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+    while (res < 0) {
+  803a04:	85 c0                	test   %eax,%eax
+  803a06:	79 65                	jns    803a6d <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a08:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a0b:	75 33                	jne    803a40 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803a0d:	49 bf 0e 12 80 00 00 	movabs $0x80120e,%r15
+  803a14:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a17:	49 be 0b 15 80 00 00 	movabs $0x80150b,%r14
+  803a1e:	00 00 00 
+        sys_yield();
+  803a21:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a24:	45 89 e8             	mov    %r13d,%r8d
+  803a27:	4c 89 e1             	mov    %r12,%rcx
+  803a2a:	48 89 da             	mov    %rbx,%rdx
+  803a2d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a31:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803a34:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803a37:	85 c0                	test   %eax,%eax
+  803a39:	79 32                	jns    803a6d <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a3b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a3e:	74 e1                	je     803a21 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803a40:	89 c1                	mov    %eax,%ecx
+  803a42:	48 ba c3 41 80 00 00 	movabs $0x8041c3,%rdx
+  803a49:	00 00 00 
+  803a4c:	be 52 00 00 00       	mov    $0x52,%esi
+  803a51:	48 bf d7 41 80 00 00 	movabs $0x8041d7,%rdi
+  803a58:	00 00 00 
+  803a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a60:	49 b8 1c 38 80 00 00 	movabs $0x80381c,%r8
+  803a67:	00 00 00 
+  803a6a:	41 ff d0             	call   *%r8
+    }
+}
+  803a6d:	48 83 c4 18          	add    $0x18,%rsp
+  803a71:	5b                   	pop    %rbx
+  803a72:	41 5c                	pop    %r12
+  803a74:	41 5d                	pop    %r13
+  803a76:	41 5e                	pop    %r14
+  803a78:	41 5f                	pop    %r15
+  803a7a:	5d                   	pop    %rbp
+  803a7b:	c3                   	ret
+
+0000000000803a7c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803a81:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803a88:	00 00 00 
+  803a8b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a8f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a93:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a97:	48 01 ca             	add    %rcx,%rdx
+  803a9a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803aa0:	39 fa                	cmp    %edi,%edx
+  803aa2:	74 12                	je     803ab6 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803aa4:	48 83 c0 01          	add    $0x1,%rax
+  803aa8:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803aae:	75 db                	jne    803a8b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab5:	c3                   	ret
+            return envs[i].env_id;
+  803ab6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803aba:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803abe:	48 c1 e2 04          	shl    $0x4,%rdx
+  803ac2:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803ac9:	00 00 00 
+  803acc:	48 01 d0             	add    %rdx,%rax
+  803acf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ad5:	c3                   	ret
+  803ad6:	66 90                	xchg   %ax,%ax
+
+0000000000803ad8 <__rodata_start>:
+  803ad8:	75 73                	jne    803b4d <__rodata_start+0x75>
+  803ada:	61                   	(bad)
+  803adb:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  803adf:	6c                   	insb   (%dx),%es:(%rdi)
+  803ae0:	73 66                	jae    803b48 <__rodata_start+0x70>
+  803ae2:	64 20 5b 2d          	and    %bl,%fs:0x2d(%rbx)
+  803ae6:	31 5d 0a             	xor    %ebx,0xa(%rbp)
+  803ae9:	00 66 0f             	add    %ah,0xf(%rsi)
+  803aec:	1f                   	(bad)
+  803aed:	44 00 00             	add    %r8b,(%rax)
+  803af0:	66 64 20 25 64 3a 20 	data16 and %ah,%fs:0x6e203a64(%rip)        # 6ea0755c <__bss_end+0x6e1fe55c>
+  803af7:	6e 
+  803af8:	61                   	(bad)
+  803af9:	6d                   	insl   (%dx),%es:(%rdi)
+  803afa:	65 20 25 73 20 69 73 	and    %ah,%gs:0x73692073(%rip)        # 73e95b74 <__bss_end+0x7368cb74>
+  803b01:	64 69 72 20 25 64 20 	imul   $0x73206425,%fs:0x20(%rdx),%esi
+  803b08:	73 
+  803b09:	69 7a 65 20 25 64 20 	imul   $0x20642520,0x65(%rdx),%edi
+  803b10:	64 65 76 20          	fs gs jbe 803b34 <__rodata_start+0x5c>
+  803b14:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  803b19:	75 6e                	jne    803b89 <__rodata_start+0xb1>
+  803b1b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803b1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b20:	3e 00 30             	ds add %dh,(%rax)
+  803b23:	31 32                	xor    %esi,(%rdx)
+  803b25:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b2c:	41                   	rex.B
+  803b2d:	42                   	rex.X
+  803b2e:	43                   	rex.XB
+  803b2f:	44                   	rex.R
+  803b30:	45                   	rex.RB
+  803b31:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b34:	31 32                	xor    %esi,(%rdx)
+  803b36:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b3d:	61                   	(bad)
+  803b3e:	62 63 64 65 66       	(bad)
+  803b43:	00 28                	add    %ch,(%rax)
+  803b45:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b46:	75 6c                	jne    803bb4 <__rodata_start+0xdc>
+  803b48:	6c                   	insb   (%dx),%es:(%rdi)
+  803b49:	29 00                	sub    %eax,(%rax)
+  803b4b:	65 72 72             	gs jb  803bc0 <__rodata_start+0xe8>
+  803b4e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b4f:	72 20                	jb     803b71 <__rodata_start+0x99>
+  803b51:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b56:	73 70                	jae    803bc8 <__rodata_start+0xf0>
+  803b58:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b5c:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b64:	72 00                	jb     803b66 <__rodata_start+0x8e>
+  803b66:	62 61 64 20 65       	(bad)
+  803b6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b6c:	76 69                	jbe    803bd7 <__rodata_start+0xff>
+  803b6e:	72 6f                	jb     803bdf <__rodata_start+0x107>
+  803b70:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b71:	6d                   	insl   (%dx),%es:(%rdi)
+  803b72:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b74:	74 00                	je     803b76 <__rodata_start+0x9e>
+  803b76:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b7d:	20 70 61             	and    %dh,0x61(%rax)
+  803b80:	72 61                	jb     803be3 <__rodata_start+0x10b>
+  803b82:	6d                   	insl   (%dx),%es:(%rdi)
+  803b83:	65 74 65             	gs je  803beb <__rodata_start+0x113>
+  803b86:	72 00                	jb     803b88 <__rodata_start+0xb0>
+  803b88:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b89:	75 74                	jne    803bff <__rodata_start+0x127>
+  803b8b:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b8e:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b91:	6d                   	insl   (%dx),%es:(%rdi)
+  803b92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b93:	72 79                	jb     803c0e <__rodata_start+0x136>
+  803b95:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b98:	74 20                	je     803bba <__rodata_start+0xe2>
+  803b9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b9b:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b9f:	76 69                	jbe    803c0a <__rodata_start+0x132>
+  803ba1:	72 6f                	jb     803c12 <__rodata_start+0x13a>
+  803ba3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba4:	6d                   	insl   (%dx),%es:(%rdi)
+  803ba5:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ba7:	74 73                	je     803c1c <__rodata_start+0x144>
+  803ba9:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803bac:	72 72                	jb     803c20 <__rodata_start+0x148>
+  803bae:	75 70                	jne    803c20 <__rodata_start+0x148>
+  803bb0:	74 65                	je     803c17 <__rodata_start+0x13f>
+  803bb2:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803bb7:	75 67                	jne    803c20 <__rodata_start+0x148>
+  803bb9:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803bbc:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bbe:	00 73 65             	add    %dh,0x65(%rbx)
+  803bc1:	67 6d                	insl   (%dx),%es:(%edi)
+  803bc3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bc5:	74 61                	je     803c28 <__rodata_start+0x150>
+  803bc7:	74 69                	je     803c32 <__rodata_start+0x15a>
+  803bc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bcb:	20 66 61             	and    %ah,0x61(%rsi)
+  803bce:	75 6c                	jne    803c3c <__rodata_start+0x164>
+  803bd0:	74 00                	je     803bd2 <__rodata_start+0xfa>
+  803bd2:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bd9:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bdc:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803be0:	61                   	(bad)
+  803be1:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803be6:	20 73 75             	and    %dh,0x75(%rbx)
+  803be9:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803bec:	73 79                	jae    803c67 <__rodata_start+0x18f>
+  803bee:	73 74                	jae    803c64 <__rodata_start+0x18c>
+  803bf0:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803bf2:	20 63 61             	and    %ah,0x61(%rbx)
+  803bf5:	6c                   	insb   (%dx),%es:(%rdi)
+  803bf6:	6c                   	insb   (%dx),%es:(%rdi)
+  803bf7:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803bfa:	74 72                	je     803c6e <__rodata_start+0x196>
+  803bfc:	79 20                	jns    803c1e <__rodata_start+0x146>
+  803bfe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c00:	74 20                	je     803c22 <__rodata_start+0x14a>
+  803c02:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c04:	75 6e                	jne    803c74 <__rodata_start+0x19c>
+  803c06:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803c0a:	76 20                	jbe    803c2c <__rodata_start+0x154>
+  803c0c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803c13:	72 65                	jb     803c7a <__rodata_start+0x1a2>
+  803c15:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803c18:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c19:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803c1d:	65 78 70             	gs js  803c90 <__rodata_start+0x1b8>
+  803c20:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c25:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c28:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c2c:	20 66 69             	and    %ah,0x69(%rsi)
+  803c2f:	6c                   	insb   (%dx),%es:(%rdi)
+  803c30:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c34:	20 66 72             	and    %ah,0x72(%rsi)
+  803c37:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c3c:	61                   	(bad)
+  803c3d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c40:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c42:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c46:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4b:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c4f:	79 20                	jns    803c71 <__rodata_start+0x199>
+  803c51:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c58:	72 65                	jb     803cbf <__rodata_start+0x1e7>
+  803c5a:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c5d:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c5f:	00 66 69             	add    %ah,0x69(%rsi)
+  803c62:	6c                   	insb   (%dx),%es:(%rdi)
+  803c63:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c67:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6b:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c70:	74 20                	je     803c92 <__rodata_start+0x1ba>
+  803c72:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c74:	75 6e                	jne    803ce4 <__rodata_start+0x20c>
+  803c76:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c7a:	76 61                	jbe    803cdd <__rodata_start+0x205>
+  803c7c:	6c                   	insb   (%dx),%es:(%rdi)
+  803c7d:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c84:	00 
+  803c85:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c8c:	72 65                	jb     803cf3 <__rodata_start+0x21b>
+  803c8e:	61                   	(bad)
+  803c8f:	64 79 20             	fs jns 803cb2 <__rodata_start+0x1da>
+  803c92:	65 78 69             	gs js  803cfe <__rodata_start+0x226>
+  803c95:	73 74                	jae    803d0b <__rodata_start+0x233>
+  803c97:	73 00                	jae    803c99 <__rodata_start+0x1c1>
+  803c99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c9a:	70 65                	jo     803d01 <__rodata_start+0x229>
+  803c9c:	72 61                	jb     803cff <__rodata_start+0x227>
+  803c9e:	74 69                	je     803d09 <__rodata_start+0x231>
+  803ca0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ca1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ca2:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803ca5:	74 20                	je     803cc7 <__rodata_start+0x1ef>
+  803ca7:	73 75                	jae    803d1e <__rodata_start+0x246>
+  803ca9:	70 70                	jo     803d1b <__rodata_start+0x243>
+  803cab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cac:	72 74                	jb     803d22 <__rodata_start+0x24a>
+  803cae:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803cb4:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803cb9:	74 00                	je     803cbb <__rodata_start+0x1e3>
+  803cbb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803cc0:	d9 04 80             	flds   (%rax,%rax,4)
+  803cc3:	00 00                	add    %al,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 1a                	add    %bl,(%rdx)
+  803cc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ccf:	00 0a                	add    %cl,(%rdx)
+  803cd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cd7:	00 1a                	add    %bl,(%rdx)
+  803cd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cdf:	00 1a                	add    %bl,(%rdx)
+  803ce1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ce7:	00 1a                	add    %bl,(%rdx)
+  803ce9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cef:	00 1a                	add    %bl,(%rdx)
+  803cf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cf7:	00 f8                	add    %bh,%al
+  803cf9:	04 80                	add    $0x80,%al
+  803cfb:	00 00                	add    %al,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 1a                	add    %bl,(%rdx)
+  803d01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d07:	00 1a                	add    %bl,(%rdx)
+  803d09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d0f:	00 ec                	add    %ch,%ah
+  803d11:	04 80                	add    $0x80,%al
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 66 05             	add    %ah,0x5(%rsi)
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 1a                	add    %bl,(%rdx)
+  803d21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d27:	00 ec                	add    %ch,%ah
+  803d29:	04 80                	add    $0x80,%al
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 32                	add    %dh,(%rdx)
+  803d31:	05 80 00 00 00       	add    $0x80,%eax
+  803d36:	00 00                	add    %al,(%rax)
+  803d38:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dbe <__rodata_start+0x2e6>
+  803d3e:	00 00                	add    %al,(%rax)
+  803d40:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dc6 <__rodata_start+0x2ee>
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dce <__rodata_start+0x2f6>
+  803d4e:	00 00                	add    %al,(%rax)
+  803d50:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dd6 <__rodata_start+0x2fe>
+  803d56:	00 00                	add    %al,(%rax)
+  803d58:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dde <__rodata_start+0x306>
+  803d5e:	00 00                	add    %al,(%rax)
+  803d60:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803de6 <__rodata_start+0x30e>
+  803d66:	00 00                	add    %al,(%rax)
+  803d68:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803dee <__rodata_start+0x316>
+  803d6e:	00 00                	add    %al,(%rax)
+  803d70:	32 05 80 00 00 00    	xor    0x80(%rip),%al        # 803df6 <__rodata_start+0x31e>
+  803d76:	00 00                	add    %al,(%rax)
+  803d78:	1a 0b                	sbb    (%rbx),%cl
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 1a                	add    %bl,(%rdx)
+  803d81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d87:	00 1a                	add    %bl,(%rdx)
+  803d89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d8f:	00 1a                	add    %bl,(%rdx)
+  803d91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d97:	00 1a                	add    %bl,(%rdx)
+  803d99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d9f:	00 1a                	add    %bl,(%rdx)
+  803da1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803da7:	00 1a                	add    %bl,(%rdx)
+  803da9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803daf:	00 1a                	add    %bl,(%rdx)
+  803db1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803db7:	00 1a                	add    %bl,(%rdx)
+  803db9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803dbf:	00 1a                	add    %bl,(%rdx)
+  803dc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803dc7:	00 1a                	add    %bl,(%rdx)
+  803dc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803dcf:	00 1a                	add    %bl,(%rdx)
+  803dd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803dd7:	00 1a                	add    %bl,(%rdx)
+  803dd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ddf:	00 1a                	add    %bl,(%rdx)
+  803de1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803de7:	00 1a                	add    %bl,(%rdx)
+  803de9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803def:	00 1a                	add    %bl,(%rdx)
+  803df1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803df7:	00 1a                	add    %bl,(%rdx)
+  803df9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803dff:	00 1a                	add    %bl,(%rdx)
+  803e01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e07:	00 1a                	add    %bl,(%rdx)
+  803e09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e0f:	00 1a                	add    %bl,(%rdx)
+  803e11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e17:	00 1a                	add    %bl,(%rdx)
+  803e19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e1f:	00 1a                	add    %bl,(%rdx)
+  803e21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e27:	00 1a                	add    %bl,(%rdx)
+  803e29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e2f:	00 1a                	add    %bl,(%rdx)
+  803e31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e37:	00 1a                	add    %bl,(%rdx)
+  803e39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e3f:	00 1a                	add    %bl,(%rdx)
+  803e41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e47:	00 1a                	add    %bl,(%rdx)
+  803e49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e4f:	00 1a                	add    %bl,(%rdx)
+  803e51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e57:	00 1a                	add    %bl,(%rdx)
+  803e59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e5f:	00 1a                	add    %bl,(%rdx)
+  803e61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e67:	00 3d 0a 80 00 00    	add    %bh,0x800a(%rip)        # 80be77 <__bss_end+0x2e77>
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 1a                	add    %bl,(%rdx)
+  803e71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e77:	00 1a                	add    %bl,(%rdx)
+  803e79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e7f:	00 1a                	add    %bl,(%rdx)
+  803e81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e87:	00 1a                	add    %bl,(%rdx)
+  803e89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e8f:	00 1a                	add    %bl,(%rdx)
+  803e91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e97:	00 1a                	add    %bl,(%rdx)
+  803e99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e9f:	00 1a                	add    %bl,(%rdx)
+  803ea1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ea7:	00 1a                	add    %bl,(%rdx)
+  803ea9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eaf:	00 1a                	add    %bl,(%rdx)
+  803eb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eb7:	00 1a                	add    %bl,(%rdx)
+  803eb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ebf:	00 89 05 80 00 00    	add    %cl,0x8005(%rcx)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 58 07             	add    %bl,0x7(%rax)
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 1a                	add    %bl,(%rdx)
+  803ed1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ed7:	00 1a                	add    %bl,(%rdx)
+  803ed9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803edf:	00 1a                	add    %bl,(%rdx)
+  803ee1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ee7:	00 1a                	add    %bl,(%rdx)
+  803ee9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eef:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 1a                	add    %bl,(%rdx)
+  803ef9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eff:	00 1a                	add    %bl,(%rdx)
+  803f01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f07:	00 7e 05             	add    %bh,0x5(%rsi)
+  803f0a:	80 00 00             	addb   $0x0,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 1a                	add    %bl,(%rdx)
+  803f11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f17:	00 1a                	add    %bl,(%rdx)
+  803f19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f1f:	00 00                	add    %al,(%rax)
+  803f21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f27:	00 ca                	add    %cl,%dl
+  803f29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f2f:	00 1a                	add    %bl,(%rdx)
+  803f31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f37:	00 1a                	add    %bl,(%rdx)
+  803f39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f3f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 1a                	add    %bl,(%rdx)
+  803f49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f4f:	00 2c 08             	add    %ch,(%rax,%rcx,1)
+  803f52:	80 00 00             	addb   $0x0,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 1a                	add    %bl,(%rdx)
+  803f59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f5f:	00 1a                	add    %bl,(%rdx)
+  803f61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f67:	00 3d 0a 80 00 00    	add    %bh,0x800a(%rip)        # 80bf77 <__bss_end+0x2f77>
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 1a                	add    %bl,(%rdx)
+  803f71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f77:	00 e2                	add    %ah,%dl
+  803f79:	04 80                	add    $0x80,%al
+  803f7b:	00 00                	add    %al,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f80 <error_string>:
+	...
+  803f88:	54 3b 80 00 00 00 00 00 66 3b 80 00 00 00 00 00     T;......f;......
+  803f98:	76 3b 80 00 00 00 00 00 88 3b 80 00 00 00 00 00     v;.......;......
+  803fa8:	96 3b 80 00 00 00 00 00 aa 3b 80 00 00 00 00 00     .;.......;......
+  803fb8:	bf 3b 80 00 00 00 00 00 d2 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	e4 3b 80 00 00 00 00 00 f8 3b 80 00 00 00 00 00     .;.......;......
+  803fd8:	08 3c 80 00 00 00 00 00 1b 3c 80 00 00 00 00 00     .<.......<......
+  803fe8:	32 3c 80 00 00 00 00 00 48 3c 80 00 00 00 00 00     2<......H<......
+  803ff8:	60 3c 80 00 00 00 00 00 78 3c 80 00 00 00 00 00     `<......x<......
+  804008:	85 3c 80 00 00 00 00 00 28 40 80 00 00 00 00 00     .<......(@......
+  804018:	99 3c 80 00 00 00 00 00 b1 3c 80 00 00 00 00 00     .<.......<......
+  804028:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804038:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804048:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804058:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804068:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804078:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804088:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804098:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  8040a8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  8040b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8040c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8040d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8040e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8040f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804108:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804118:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804120 <devtab>:
+  804120:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804130:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804140:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804150:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804160:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804170:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804180:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804190:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8041a0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8041b0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8041c0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  8041d0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  8041e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804200:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804210:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804220:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804230:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804240:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804250:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804260:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804270:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804280:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804290:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804300:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804310:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804320:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804330:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804340:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804350:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804360:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804370:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804380:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804390:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804400:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804410:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804420:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804430:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804440:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
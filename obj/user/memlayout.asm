@@ -0,0 +1,7611 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 03 00 00       	call   800375 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  800036:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80003d:	00 00 00 
+  800040:	49 8b 04 24          	mov    (%r12),%rax
+  800044:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80004a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800050:	48 bf dc 3a 80 00 00 	movabs $0x803adc,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb 96 05 80 00 00 	movabs $0x800596,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  80006b:	49 8b 04 24          	mov    (%r12),%rax
+  80006f:	48 8b b0 e8 00 00 00 	mov    0xe8(%rax),%rsi
+  800076:	49 b9 00 00 00 80 00 	movabs $0x10080000000,%r9
+  80007d:	01 00 00 
+  800080:	49 b8 00 00 00 00 00 	movabs $0x10000000000,%r8
+  800087:	01 00 00 
+  80008a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  800091:	01 00 00 
+  800094:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80009b:	01 00 00 
+  80009e:	48 bf 88 3b 80 00 00 	movabs $0x803b88,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000af:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b6:	00 
+    size_t total_w = 0;
+  8000b7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000be:	00 
+    size_t total_u = 0;
+  8000bf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c6:	00 
+    size_t total_p = 0;
+  8000c7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000ce:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d5:	49 bd bf 34 80 00 00 	movabs $0x8034bf,%r13
+  8000dc:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000df:	49 bc 05 3b 80 00 00 	movabs $0x803b05,%r12
+  8000e6:	00 00 00 
+  8000e9:	eb 5f                	jmp    80014a <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000ef:	41 ff d5             	call   *%r13
+  8000f2:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000f9:	41 57                	push   %r15
+  8000fb:	ff 75 c0             	push   -0x40(%rbp)
+  8000fe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800101:	50                   	push   %rax
+  800102:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800106:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010a:	48 89 d9             	mov    %rbx,%rcx
+  80010d:	4c 89 f2             	mov    %r14,%rdx
+  800110:	48 bf b8 3b 80 00 00 	movabs $0x803bb8,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	49 ba 96 05 80 00 00 	movabs $0x800596,%r10
+  800126:	00 00 00 
+  800129:	41 ff d2             	call   *%r10
+  80012c:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800130:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800137:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013e:	00 00 00 
+  800141:	49 39 c6             	cmp    %rax,%r14
+  800144:	0f 84 8f 00 00 00    	je     8001d9 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014a:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014e:	4c 89 f7             	mov    %r14,%rdi
+  800151:	41 ff d5             	call   *%r13
+  800154:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800157:	48 85 c0             	test   %rax,%rax
+  80015a:	74 d4                	je     800130 <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015c:	a8 40                	test   $0x40,%al
+  80015e:	49 bf d0 3a 80 00 00 	movabs $0x803ad0,%r15
+  800165:	00 00 00 
+  800168:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016c:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800170:	f6 c4 08             	test   $0x8,%ah
+  800173:	74 13                	je     800188 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800175:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017a:	48 b8 d7 3a 80 00 00 	movabs $0x803ad7,%rax
+  800181:	00 00 00 
+  800184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800188:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80018f:	f6 c3 02             	test   $0x2,%bl
+  800192:	74 0c                	je     8001a0 <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800194:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800199:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a0:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a7:	f6 c3 04             	test   $0x4,%bl
+  8001aa:	74 0c                	je     8001b8 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ac:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b1:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b8:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001bf:	f6 c3 01             	test   $0x1,%bl
+  8001c2:	0f 84 23 ff ff ff    	je     8000eb <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c8:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001cd:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d4:	e9 12 ff ff ff       	jmp    8000eb <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001d9:	48 bf ef 3a 80 00 00 	movabs $0x803aef,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 bb 96 05 80 00 00 	movabs $0x800596,%rbx
+  8001ef:	00 00 00 
+  8001f2:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f8:	48 bf 06 3b 80 00 00 	movabs $0x803b06,%rdi
+  8001ff:	00 00 00 
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800209:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020d:	48 bf 14 3b 80 00 00 	movabs $0x803b14,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021e:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800222:	48 bf 22 3b 80 00 00 	movabs $0x803b22,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800233:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800237:	48 bf 30 3b 80 00 00 	movabs $0x803b30,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	ff d3                	call   *%rbx
+}
+  800248:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800262:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026e:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800272:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 46                	js     8002c8 <umain+0x71>
+    ceid = fork();
+  800282:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	78 60                	js     8002f2 <umain+0x9b>
+
+    if (!ceid) {
+  800292:	0f 84 84 00 00 00    	je     80031c <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800298:	48 bf 7b 3b 80 00 00 	movabs $0x803b7b,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 ba 96 05 80 00 00 	movabs $0x800596,%rdx
+  8002ae:	00 00 00 
+  8002b1:	ff d2                	call   *%rdx
+    memlayout();
+  8002b3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	48 83 c4 10          	add    $0x10,%rsp
+  8002c3:	5b                   	pop    %rbx
+  8002c4:	41 5c                	pop    %r12
+  8002c6:	5d                   	pop    %rbp
+  8002c7:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c8:	48 ba 40 3b 80 00 00 	movabs $0x803b40,%rdx
+  8002cf:	00 00 00 
+  8002d2:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d7:	48 bf 4f 3b 80 00 00 	movabs $0x803b4f,%rdi
+  8002de:	00 00 00 
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	48 b9 46 04 80 00 00 	movabs $0x800446,%rcx
+  8002ed:	00 00 00 
+  8002f0:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f2:	48 ba 60 3b 80 00 00 	movabs $0x803b60,%rdx
+  8002f9:	00 00 00 
+  8002fc:	be 35 00 00 00       	mov    $0x35,%esi
+  800301:	48 bf 4f 3b 80 00 00 	movabs $0x803b4f,%rdi
+  800308:	00 00 00 
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 b9 46 04 80 00 00 	movabs $0x800446,%rcx
+  800317:	00 00 00 
+  80031a:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031c:	48 bf 04 3b 80 00 00 	movabs $0x803b04,%rdi
+  800323:	00 00 00 
+  800326:	48 ba 96 05 80 00 00 	movabs $0x800596,%rdx
+  80032d:	00 00 00 
+  800330:	ff d2                	call   *%rdx
+  800332:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800337:	49 bc b8 14 80 00 00 	movabs $0x8014b8,%r12
+  80033e:	00 00 00 
+  800341:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800344:	83 eb 01             	sub    $0x1,%ebx
+  800347:	75 f8                	jne    800341 <umain+0xea>
+        cprintf("==== Child\n");
+  800349:	48 bf 6f 3b 80 00 00 	movabs $0x803b6f,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	48 ba 96 05 80 00 00 	movabs $0x800596,%rdx
+  80035f:	00 00 00 
+  800362:	ff d2                	call   *%rdx
+        memlayout();
+  800364:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+        return;
+  800370:	e9 4a ff ff ff       	jmp    8002bf <umain+0x68>
+
+0000000000800375 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	41 89 fd             	mov    %edi,%r13d
+  800383:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  80038d:	00 00 00 
+  800390:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800397:	00 00 00 
+  80039a:	48 39 c2             	cmp    %rax,%rdx
+  80039d:	73 17                	jae    8003b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a2:	49 89 c4             	mov    %rax,%r12
+  8003a5:	48 83 c3 08          	add    $0x8,%rbx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8003b1:	4c 39 e3             	cmp    %r12,%rbx
+  8003b4:	72 ef                	jb     8003a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003b6:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+  8003c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003c7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8003cb:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8003cf:	48 c1 e0 04          	shl    $0x4,%rax
+  8003d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003da:	00 00 00 
+  8003dd:	48 01 d0             	add    %rdx,%rax
+  8003e0:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003e7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003ea:	45 85 ed             	test   %r13d,%r13d
+  8003ed:	7e 0d                	jle    8003fc <libmain+0x87>
+  8003ef:	49 8b 06             	mov    (%r14),%rax
+  8003f2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003f9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003fc:	4c 89 f6             	mov    %r14,%rsi
+  8003ff:	44 89 ef             	mov    %r13d,%edi
+  800402:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800409:	00 00 00 
+  80040c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80040e:	48 b8 23 04 80 00 00 	movabs $0x800423,%rax
+  800415:	00 00 00 
+  800418:	ff d0                	call   *%rax
+#endif
+}
+  80041a:	5b                   	pop    %rbx
+  80041b:	41 5c                	pop    %r12
+  80041d:	41 5d                	pop    %r13
+  80041f:	41 5e                	pop    %r14
+  800421:	5d                   	pop    %rbp
+  800422:	c3                   	ret
+
+0000000000800423 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800423:	55                   	push   %rbp
+  800424:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800427:	48 b8 4c 1c 80 00 00 	movabs $0x801c4c,%rax
+  80042e:	00 00 00 
+  800431:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800433:	bf 00 00 00 00       	mov    $0x0,%edi
+  800438:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  80043f:	00 00 00 
+  800442:	ff d0                	call   *%rax
+}
+  800444:	5d                   	pop    %rbp
+  800445:	c3                   	ret
+
+0000000000800446 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+  80044a:	41 56                	push   %r14
+  80044c:	41 55                	push   %r13
+  80044e:	41 54                	push   %r12
+  800450:	53                   	push   %rbx
+  800451:	48 83 ec 50          	sub    $0x50,%rsp
+  800455:	49 89 fc             	mov    %rdi,%r12
+  800458:	41 89 f5             	mov    %esi,%r13d
+  80045b:	48 89 d3             	mov    %rdx,%rbx
+  80045e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800462:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800466:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80046a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800471:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800475:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800479:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80047d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800481:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800488:	00 00 00 
+  80048b:	4c 8b 30             	mov    (%rax),%r14
+  80048e:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+  80049a:	89 c6                	mov    %eax,%esi
+  80049c:	45 89 e8             	mov    %r13d,%r8d
+  80049f:	4c 89 e1             	mov    %r12,%rcx
+  8004a2:	4c 89 f2             	mov    %r14,%rdx
+  8004a5:	48 bf e8 3b 80 00 00 	movabs $0x803be8,%rdi
+  8004ac:	00 00 00 
+  8004af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b4:	49 bc 96 05 80 00 00 	movabs $0x800596,%r12
+  8004bb:	00 00 00 
+  8004be:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004c1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004c5:	48 89 df             	mov    %rbx,%rdi
+  8004c8:	48 b8 32 05 80 00 00 	movabs $0x800532,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004d4:	48 bf 04 3b 80 00 00 	movabs $0x803b04,%rdi
+  8004db:	00 00 00 
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004e6:	cc                   	int3
+  8004e7:	eb fd                	jmp    8004e6 <_panic+0xa0>
+
+00000000008004e9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004e9:	55                   	push   %rbp
+  8004ea:	48 89 e5             	mov    %rsp,%rbp
+  8004ed:	53                   	push   %rbx
+  8004ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004f5:	8b 06                	mov    (%rsi),%eax
+  8004f7:	8d 50 01             	lea    0x1(%rax),%edx
+  8004fa:	89 16                	mov    %edx,(%rsi)
+  8004fc:	48 98                	cltq
+  8004fe:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800503:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800509:	74 0a                	je     800515 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80050b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80050f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800513:	c9                   	leave
+  800514:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800515:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800519:	be ff 00 00 00       	mov    $0xff,%esi
+  80051e:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  800525:	00 00 00 
+  800528:	ff d0                	call   *%rax
+        state->offset = 0;
+  80052a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800530:	eb d9                	jmp    80050b <putch+0x22>
+
+0000000000800532 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800532:	55                   	push   %rbp
+  800533:	48 89 e5             	mov    %rsp,%rbp
+  800536:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80053d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800540:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800547:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80054c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800551:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800554:	48 89 f1             	mov    %rsi,%rcx
+  800557:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80055e:	48 bf e9 04 80 00 00 	movabs $0x8004e9,%rdi
+  800565:	00 00 00 
+  800568:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  80056f:	00 00 00 
+  800572:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800574:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80057b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800582:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  800589:	00 00 00 
+  80058c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80058e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800594:	c9                   	leave
+  800595:	c3                   	ret
+
+0000000000800596 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800596:	55                   	push   %rbp
+  800597:	48 89 e5             	mov    %rsp,%rbp
+  80059a:	48 83 ec 50          	sub    $0x50,%rsp
+  80059e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005a2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005b2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005c9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005cd:	48 b8 32 05 80 00 00 	movabs $0x800532,%rax
+  8005d4:	00 00 00 
+  8005d7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005d9:	c9                   	leave
+  8005da:	c3                   	ret
+
+00000000008005db <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005db:	55                   	push   %rbp
+  8005dc:	48 89 e5             	mov    %rsp,%rbp
+  8005df:	41 57                	push   %r15
+  8005e1:	41 56                	push   %r14
+  8005e3:	41 55                	push   %r13
+  8005e5:	41 54                	push   %r12
+  8005e7:	53                   	push   %rbx
+  8005e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8005ec:	49 89 fc             	mov    %rdi,%r12
+  8005ef:	49 89 f5             	mov    %rsi,%r13
+  8005f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005f6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005f9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005fc:	41 89 cf             	mov    %ecx,%r15d
+  8005ff:	4c 39 fa             	cmp    %r15,%rdx
+  800602:	73 5b                	jae    80065f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800604:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800608:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80060c:	85 db                	test   %ebx,%ebx
+  80060e:	7e 0e                	jle    80061e <print_num+0x43>
+            putch(padc, put_arg);
+  800610:	4c 89 ee             	mov    %r13,%rsi
+  800613:	44 89 f7             	mov    %r14d,%edi
+  800616:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800619:	83 eb 01             	sub    $0x1,%ebx
+  80061c:	75 f2                	jne    800610 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80061e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800622:	48 b9 1c 3c 80 00 00 	movabs $0x803c1c,%rcx
+  800629:	00 00 00 
+  80062c:	48 b8 0b 3c 80 00 00 	movabs $0x803c0b,%rax
+  800633:	00 00 00 
+  800636:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80063a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80063e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800643:	49 f7 f7             	div    %r15
+  800646:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80064a:	4c 89 ee             	mov    %r13,%rsi
+  80064d:	41 ff d4             	call   *%r12
+}
+  800650:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800654:	5b                   	pop    %rbx
+  800655:	41 5c                	pop    %r12
+  800657:	41 5d                	pop    %r13
+  800659:	41 5e                	pop    %r14
+  80065b:	41 5f                	pop    %r15
+  80065d:	5d                   	pop    %rbp
+  80065e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80065f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800663:	ba 00 00 00 00       	mov    $0x0,%edx
+  800668:	49 f7 f7             	div    %r15
+  80066b:	48 83 ec 08          	sub    $0x8,%rsp
+  80066f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800673:	52                   	push   %rdx
+  800674:	45 0f be c9          	movsbl %r9b,%r9d
+  800678:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80067c:	48 89 c2             	mov    %rax,%rdx
+  80067f:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  800686:	00 00 00 
+  800689:	ff d0                	call   *%rax
+  80068b:	48 83 c4 10          	add    $0x10,%rsp
+  80068f:	eb 8d                	jmp    80061e <print_num+0x43>
+
+0000000000800691 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800691:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800695:	48 8b 06             	mov    (%rsi),%rax
+  800698:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80069c:	73 0a                	jae    8006a8 <sprintputch+0x17>
+        *state->start++ = ch;
+  80069e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006a2:	48 89 16             	mov    %rdx,(%rsi)
+  8006a5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006a8:	c3                   	ret
+
+00000000008006a9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006a9:	55                   	push   %rbp
+  8006aa:	48 89 e5             	mov    %rsp,%rbp
+  8006ad:	48 83 ec 50          	sub    $0x50,%rsp
+  8006b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006b5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006bd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006c4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006d4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d8:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  8006df:	00 00 00 
+  8006e2:	ff d0                	call   *%rax
+}
+  8006e4:	c9                   	leave
+  8006e5:	c3                   	ret
+
+00000000008006e6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	41 57                	push   %r15
+  8006ec:	41 56                	push   %r14
+  8006ee:	41 55                	push   %r13
+  8006f0:	41 54                	push   %r12
+  8006f2:	53                   	push   %rbx
+  8006f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f7:	49 89 fe             	mov    %rdi,%r14
+  8006fa:	49 89 f5             	mov    %rsi,%r13
+  8006fd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800700:	48 8b 01             	mov    (%rcx),%rax
+  800703:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800707:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80070b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800713:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800717:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80071b:	0f b6 3b             	movzbl (%rbx),%edi
+  80071e:	40 80 ff 25          	cmp    $0x25,%dil
+  800722:	74 18                	je     80073c <vprintfmt+0x56>
+            if (!ch) return;
+  800724:	40 84 ff             	test   %dil,%dil
+  800727:	0f 84 b1 06 00 00    	je     800dde <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80072d:	40 0f b6 ff          	movzbl %dil,%edi
+  800731:	4c 89 ee             	mov    %r13,%rsi
+  800734:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800737:	4c 89 e3             	mov    %r12,%rbx
+  80073a:	eb db                	jmp    800717 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80073c:	be 00 00 00 00       	mov    $0x0,%esi
+  800741:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800745:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80074a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800750:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800757:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80075b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800760:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800765:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800768:	83 e8 23             	sub    $0x23,%eax
+  80076b:	3c 57                	cmp    $0x57,%al
+  80076d:	0f 87 51 06 00 00    	ja     800dc4 <vprintfmt+0x6de>
+  800773:	0f b6 c0             	movzbl %al,%eax
+  800776:	48 b9 c0 3d 80 00 00 	movabs $0x803dc0,%rcx
+  80077d:	00 00 00 
+  800780:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800783:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800786:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80078a:	eb cf                	jmp    80075b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80078c:	49 89 dc             	mov    %rbx,%r12
+  80078f:	be 01 00 00 00       	mov    $0x1,%esi
+  800794:	eb c5                	jmp    80075b <vprintfmt+0x75>
+            padc = ch;
+  800796:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80079a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80079d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a0:	eb b9                	jmp    80075b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 24                	ja     8007ce <vprintfmt+0xe8>
+  8007aa:	89 c1                	mov    %eax,%ecx
+  8007ac:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007b9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007bc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007c0:	79 99                	jns    80075b <vprintfmt+0x75>
+                width = precision;
+  8007c2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007c6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007cc:	eb 8d                	jmp    80075b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ce:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007d2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	eb da                	jmp    8007b6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007dc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007e1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007eb:	3c 39                	cmp    $0x39,%al
+  8007ed:	77 1c                	ja     80080b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ef:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007f3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007f7:	0f b6 c0             	movzbl %al,%eax
+  8007fa:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ff:	0f b6 03             	movzbl (%rbx),%eax
+  800802:	3c 39                	cmp    $0x39,%al
+  800804:	76 e9                	jbe    8007ef <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800806:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800809:	eb b1                	jmp    8007bc <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80080b:	49 89 dc             	mov    %rbx,%r12
+  80080e:	eb ac                	jmp    8007bc <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800810:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800813:	85 c9                	test   %ecx,%ecx
+  800815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081a:	0f 49 c1             	cmovns %ecx,%eax
+  80081d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800820:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800823:	e9 33 ff ff ff       	jmp    80075b <vprintfmt+0x75>
+            lflag++;
+  800828:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80082b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80082e:	e9 28 ff ff ff       	jmp    80075b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800833:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800836:	83 f8 2f             	cmp    $0x2f,%eax
+  800839:	77 19                	ja     800854 <vprintfmt+0x16e>
+  80083b:	89 c2                	mov    %eax,%edx
+  80083d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800841:	83 c0 08             	add    $0x8,%eax
+  800844:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800847:	8b 3a                	mov    (%rdx),%edi
+  800849:	4c 89 ee             	mov    %r13,%rsi
+  80084c:	41 ff d6             	call   *%r14
+            break;
+  80084f:	e9 c3 fe ff ff       	jmp    800717 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800854:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800858:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800860:	eb e5                	jmp    800847 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800862:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800865:	83 f8 2f             	cmp    $0x2f,%eax
+  800868:	77 5a                	ja     8008c4 <vprintfmt+0x1de>
+  80086a:	89 c2                	mov    %eax,%edx
+  80086c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800870:	83 c0 08             	add    $0x8,%eax
+  800873:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800876:	8b 02                	mov    (%rdx),%eax
+  800878:	89 c1                	mov    %eax,%ecx
+  80087a:	f7 d9                	neg    %ecx
+  80087c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80087f:	83 f9 14             	cmp    $0x14,%ecx
+  800882:	7f 4e                	jg     8008d2 <vprintfmt+0x1ec>
+  800884:	48 63 c1             	movslq %ecx,%rax
+  800887:	48 ba 80 40 80 00 00 	movabs $0x804080,%rdx
+  80088e:	00 00 00 
+  800891:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800895:	48 85 c0             	test   %rax,%rax
+  800898:	74 38                	je     8008d2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80089a:	48 89 c1             	mov    %rax,%rcx
+  80089d:	48 ba 79 42 80 00 00 	movabs $0x804279,%rdx
+  8008a4:	00 00 00 
+  8008a7:	4c 89 ee             	mov    %r13,%rsi
+  8008aa:	4c 89 f7             	mov    %r14,%rdi
+  8008ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b2:	49 b8 a9 06 80 00 00 	movabs $0x8006a9,%r8
+  8008b9:	00 00 00 
+  8008bc:	41 ff d0             	call   *%r8
+  8008bf:	e9 53 fe ff ff       	jmp    800717 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d0:	eb a4                	jmp    800876 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008d2:	48 ba 34 3c 80 00 00 	movabs $0x803c34,%rdx
+  8008d9:	00 00 00 
+  8008dc:	4c 89 ee             	mov    %r13,%rsi
+  8008df:	4c 89 f7             	mov    %r14,%rdi
+  8008e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e7:	49 b8 a9 06 80 00 00 	movabs $0x8006a9,%r8
+  8008ee:	00 00 00 
+  8008f1:	41 ff d0             	call   *%r8
+  8008f4:	e9 1e fe ff ff       	jmp    800717 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 6c                	ja     80096d <vprintfmt+0x287>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800910:	48 85 d2             	test   %rdx,%rdx
+  800913:	48 b8 2d 3c 80 00 00 	movabs $0x803c2d,%rax
+  80091a:	00 00 00 
+  80091d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800921:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800925:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800929:	7e 06                	jle    800931 <vprintfmt+0x24b>
+  80092b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80092f:	75 4a                	jne    80097b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800931:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800935:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800939:	0f b6 00             	movzbl (%rax),%eax
+  80093c:	84 c0                	test   %al,%al
+  80093e:	0f 85 9a 00 00 00    	jne    8009de <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800944:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800947:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80094b:	85 c0                	test   %eax,%eax
+  80094d:	0f 8e c4 fd ff ff    	jle    800717 <vprintfmt+0x31>
+  800953:	4c 89 ee             	mov    %r13,%rsi
+  800956:	bf 20 00 00 00       	mov    $0x20,%edi
+  80095b:	41 ff d6             	call   *%r14
+  80095e:	41 83 ec 01          	sub    $0x1,%r12d
+  800962:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800966:	75 eb                	jne    800953 <vprintfmt+0x26d>
+  800968:	e9 aa fd ff ff       	jmp    800717 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb 92                	jmp    80090d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80097b:	49 63 f7             	movslq %r15d,%rsi
+  80097e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800982:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800989:	00 00 00 
+  80098c:	ff d0                	call   *%rax
+  80098e:	48 89 c2             	mov    %rax,%rdx
+  800991:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800994:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800996:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800999:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80099c:	85 c0                	test   %eax,%eax
+  80099e:	7e 91                	jle    800931 <vprintfmt+0x24b>
+  8009a0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009a5:	4c 89 ee             	mov    %r13,%rsi
+  8009a8:	44 89 e7             	mov    %r12d,%edi
+  8009ab:	41 ff d6             	call   *%r14
+  8009ae:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009b8:	75 eb                	jne    8009a5 <vprintfmt+0x2bf>
+  8009ba:	e9 72 ff ff ff       	jmp    800931 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009bf:	0f b6 f8             	movzbl %al,%edi
+  8009c2:	4c 89 ee             	mov    %r13,%rsi
+  8009c5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009cc:	49 83 c4 01          	add    $0x1,%r12
+  8009d0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009d6:	84 c0                	test   %al,%al
+  8009d8:	0f 84 66 ff ff ff    	je     800944 <vprintfmt+0x25e>
+  8009de:	45 85 ff             	test   %r15d,%r15d
+  8009e1:	78 0a                	js     8009ed <vprintfmt+0x307>
+  8009e3:	41 83 ef 01          	sub    $0x1,%r15d
+  8009e7:	0f 88 57 ff ff ff    	js     800944 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ed:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009f1:	74 cc                	je     8009bf <vprintfmt+0x2d9>
+  8009f3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009f6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009fb:	80 fa 5e             	cmp    $0x5e,%dl
+  8009fe:	77 c2                	ja     8009c2 <vprintfmt+0x2dc>
+  800a00:	eb bd                	jmp    8009bf <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a02:	40 84 f6             	test   %sil,%sil
+  800a05:	75 26                	jne    800a2d <vprintfmt+0x347>
+    switch (lflag) {
+  800a07:	85 d2                	test   %edx,%edx
+  800a09:	74 59                	je     800a64 <vprintfmt+0x37e>
+  800a0b:	83 fa 01             	cmp    $0x1,%edx
+  800a0e:	74 7b                	je     800a8b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a13:	83 f8 2f             	cmp    $0x2f,%eax
+  800a16:	0f 87 96 00 00 00    	ja     800ab2 <vprintfmt+0x3cc>
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a22:	83 c0 08             	add    $0x8,%eax
+  800a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a28:	4c 8b 22             	mov    (%rdx),%r12
+  800a2b:	eb 17                	jmp    800a44 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 21                	ja     800a56 <vprintfmt+0x370>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a44:	4d 85 e4             	test   %r12,%r12
+  800a47:	78 7a                	js     800ac3 <vprintfmt+0x3dd>
+            num = i;
+  800a49:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a4c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a51:	e9 50 02 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a62:	eb dd                	jmp    800a41 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a67:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6a:	77 11                	ja     800a7d <vprintfmt+0x397>
+  800a6c:	89 c2                	mov    %eax,%edx
+  800a6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a72:	83 c0 08             	add    $0x8,%eax
+  800a75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a78:	4c 63 22             	movslq (%rdx),%r12
+  800a7b:	eb c7                	jmp    800a44 <vprintfmt+0x35e>
+  800a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a89:	eb ed                	jmp    800a78 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a91:	77 11                	ja     800aa4 <vprintfmt+0x3be>
+  800a93:	89 c2                	mov    %eax,%edx
+  800a95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a99:	83 c0 08             	add    $0x8,%eax
+  800a9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9f:	4c 8b 22             	mov    (%rdx),%r12
+  800aa2:	eb a0                	jmp    800a44 <vprintfmt+0x35e>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb ed                	jmp    800a9f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ab2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abe:	e9 65 ff ff ff       	jmp    800a28 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ac3:	4c 89 ee             	mov    %r13,%rsi
+  800ac6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800acb:	41 ff d6             	call   *%r14
+                i = -i;
+  800ace:	49 f7 dc             	neg    %r12
+  800ad1:	e9 73 ff ff ff       	jmp    800a49 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad6:	40 84 f6             	test   %sil,%sil
+  800ad9:	75 32                	jne    800b0d <vprintfmt+0x427>
+    switch (lflag) {
+  800adb:	85 d2                	test   %edx,%edx
+  800add:	74 5d                	je     800b3c <vprintfmt+0x456>
+  800adf:	83 fa 01             	cmp    $0x1,%edx
+  800ae2:	0f 84 82 00 00 00    	je     800b6a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ae8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aeb:	83 f8 2f             	cmp    $0x2f,%eax
+  800aee:	0f 87 a5 00 00 00    	ja     800b99 <vprintfmt+0x4b3>
+  800af4:	89 c2                	mov    %eax,%edx
+  800af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afa:	83 c0 08             	add    $0x8,%eax
+  800afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b00:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b03:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b08:	e9 99 01 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b10:	83 f8 2f             	cmp    $0x2f,%eax
+  800b13:	77 19                	ja     800b2e <vprintfmt+0x448>
+  800b15:	89 c2                	mov    %eax,%edx
+  800b17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1b:	83 c0 08             	add    $0x8,%eax
+  800b1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b21:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b24:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b29:	e9 78 01 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+  800b2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3a:	eb e5                	jmp    800b21 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b42:	77 18                	ja     800b5c <vprintfmt+0x476>
+  800b44:	89 c2                	mov    %eax,%edx
+  800b46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4a:	83 c0 08             	add    $0x8,%eax
+  800b4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b50:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b52:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b57:	e9 4a 01 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+  800b5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	eb e6                	jmp    800b50 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b70:	77 19                	ja     800b8b <vprintfmt+0x4a5>
+  800b72:	89 c2                	mov    %eax,%edx
+  800b74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b78:	83 c0 08             	add    $0x8,%eax
+  800b7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b81:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b86:	e9 1b 01 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+  800b8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b97:	eb e5                	jmp    800b7e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba5:	e9 56 ff ff ff       	jmp    800b00 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800baa:	40 84 f6             	test   %sil,%sil
+  800bad:	75 2e                	jne    800bdd <vprintfmt+0x4f7>
+    switch (lflag) {
+  800baf:	85 d2                	test   %edx,%edx
+  800bb1:	74 59                	je     800c0c <vprintfmt+0x526>
+  800bb3:	83 fa 01             	cmp    $0x1,%edx
+  800bb6:	74 7f                	je     800c37 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	0f 87 9f 00 00 00    	ja     800c63 <vprintfmt+0x57d>
+  800bc4:	89 c2                	mov    %eax,%edx
+  800bc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bca:	83 c0 08             	add    $0x8,%eax
+  800bcd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd8:	e9 c9 00 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be0:	83 f8 2f             	cmp    $0x2f,%eax
+  800be3:	77 19                	ja     800bfe <vprintfmt+0x518>
+  800be5:	89 c2                	mov    %eax,%edx
+  800be7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800beb:	83 c0 08             	add    $0x8,%eax
+  800bee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf9:	e9 a8 00 00 00       	jmp    800ca6 <vprintfmt+0x5c0>
+  800bfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0a:	eb e5                	jmp    800bf1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c12:	77 15                	ja     800c29 <vprintfmt+0x543>
+  800c14:	89 c2                	mov    %eax,%edx
+  800c16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1a:	83 c0 08             	add    $0x8,%eax
+  800c1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c20:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c22:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c27:	eb 7d                	jmp    800ca6 <vprintfmt+0x5c0>
+  800c29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c35:	eb e9                	jmp    800c20 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3d:	77 16                	ja     800c55 <vprintfmt+0x56f>
+  800c3f:	89 c2                	mov    %eax,%edx
+  800c41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c45:	83 c0 08             	add    $0x8,%eax
+  800c48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c53:	eb 51                	jmp    800ca6 <vprintfmt+0x5c0>
+  800c55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c61:	eb e8                	jmp    800c4b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6f:	e9 5c ff ff ff       	jmp    800bd0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c74:	4c 89 ee             	mov    %r13,%rsi
+  800c77:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c7c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c7f:	4c 89 ee             	mov    %r13,%rsi
+  800c82:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c87:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c90:	77 47                	ja     800cd9 <vprintfmt+0x5f3>
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c98:	83 c0 08             	add    $0x8,%eax
+  800c9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ca6:	48 83 ec 08          	sub    $0x8,%rsp
+  800caa:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cae:	0f 94 c0             	sete   %al
+  800cb1:	0f b6 c0             	movzbl %al,%eax
+  800cb4:	50                   	push   %rax
+  800cb5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cba:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cbe:	4c 89 ee             	mov    %r13,%rsi
+  800cc1:	4c 89 f7             	mov    %r14,%rdi
+  800cc4:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  800ccb:	00 00 00 
+  800cce:	ff d0                	call   *%rax
+            break;
+  800cd0:	48 83 c4 10          	add    $0x10,%rsp
+  800cd4:	e9 3e fa ff ff       	jmp    800717 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce5:	eb b7                	jmp    800c9e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce7:	40 84 f6             	test   %sil,%sil
+  800cea:	75 2b                	jne    800d17 <vprintfmt+0x631>
+    switch (lflag) {
+  800cec:	85 d2                	test   %edx,%edx
+  800cee:	74 56                	je     800d46 <vprintfmt+0x660>
+  800cf0:	83 fa 01             	cmp    $0x1,%edx
+  800cf3:	74 7f                	je     800d74 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfb:	0f 87 a2 00 00 00    	ja     800da3 <vprintfmt+0x6bd>
+  800d01:	89 c2                	mov    %eax,%edx
+  800d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d07:	83 c0 08             	add    $0x8,%eax
+  800d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d10:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d15:	eb 8f                	jmp    800ca6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1d:	77 19                	ja     800d38 <vprintfmt+0x652>
+  800d1f:	89 c2                	mov    %eax,%edx
+  800d21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d25:	83 c0 08             	add    $0x8,%eax
+  800d28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d33:	e9 6e ff ff ff       	jmp    800ca6 <vprintfmt+0x5c0>
+  800d38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d44:	eb e5                	jmp    800d2b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d49:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4c:	77 18                	ja     800d66 <vprintfmt+0x680>
+  800d4e:	89 c2                	mov    %eax,%edx
+  800d50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d54:	83 c0 08             	add    $0x8,%eax
+  800d57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d61:	e9 40 ff ff ff       	jmp    800ca6 <vprintfmt+0x5c0>
+  800d66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d72:	eb e6                	jmp    800d5a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d77:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7a:	77 19                	ja     800d95 <vprintfmt+0x6af>
+  800d7c:	89 c2                	mov    %eax,%edx
+  800d7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d82:	83 c0 08             	add    $0x8,%eax
+  800d85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d88:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d8b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d90:	e9 11 ff ff ff       	jmp    800ca6 <vprintfmt+0x5c0>
+  800d95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da1:	eb e5                	jmp    800d88 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800da3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daf:	e9 59 ff ff ff       	jmp    800d0d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800db4:	4c 89 ee             	mov    %r13,%rsi
+  800db7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dbc:	41 ff d6             	call   *%r14
+            break;
+  800dbf:	e9 53 f9 ff ff       	jmp    800717 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dc4:	4c 89 ee             	mov    %r13,%rsi
+  800dc7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dcc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dcf:	48 83 eb 01          	sub    $0x1,%rbx
+  800dd3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dd7:	75 f6                	jne    800dcf <vprintfmt+0x6e9>
+  800dd9:	e9 39 f9 ff ff       	jmp    800717 <vprintfmt+0x31>
+}
+  800dde:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800de2:	5b                   	pop    %rbx
+  800de3:	41 5c                	pop    %r12
+  800de5:	41 5d                	pop    %r13
+  800de7:	41 5e                	pop    %r14
+  800de9:	41 5f                	pop    %r15
+  800deb:	5d                   	pop    %rbp
+  800dec:	c3                   	ret
+
+0000000000800ded <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ded:	55                   	push   %rbp
+  800dee:	48 89 e5             	mov    %rsp,%rbp
+  800df1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800df5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800df9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e02:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e09:	48 85 ff             	test   %rdi,%rdi
+  800e0c:	74 2b                	je     800e39 <vsnprintf+0x4c>
+  800e0e:	48 85 f6             	test   %rsi,%rsi
+  800e11:	74 26                	je     800e39 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e13:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e17:	48 bf 91 06 80 00 00 	movabs $0x800691,%rdi
+  800e1e:	00 00 00 
+  800e21:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  800e28:	00 00 00 
+  800e2b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e31:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e34:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e37:	c9                   	leave
+  800e38:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e3e:	eb f7                	jmp    800e37 <vsnprintf+0x4a>
+
+0000000000800e40 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e40:	55                   	push   %rbp
+  800e41:	48 89 e5             	mov    %rsp,%rbp
+  800e44:	48 83 ec 50          	sub    $0x50,%rsp
+  800e48:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e4c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e50:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e54:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e5b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e63:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e67:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e6b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e6f:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e7b:	c9                   	leave
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e7d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e80:	74 10                	je     800e92 <strlen+0x15>
+    size_t n = 0;
+  800e82:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e87:	48 83 c0 01          	add    $0x1,%rax
+  800e8b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e8f:	75 f6                	jne    800e87 <strlen+0xa>
+  800e91:	c3                   	ret
+    size_t n = 0;
+  800e92:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e97:	c3                   	ret
+
+0000000000800e98 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e98:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ea0:	48 85 f6             	test   %rsi,%rsi
+  800ea3:	74 11                	je     800eb6 <strnlen+0x1e>
+  800ea5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ea9:	74 0c                	je     800eb7 <strnlen+0x1f>
+  800eab:	48 83 c2 01          	add    $0x1,%rdx
+  800eaf:	48 39 d0             	cmp    %rdx,%rax
+  800eb2:	75 f1                	jne    800ea5 <strnlen+0xd>
+  800eb4:	eb 04                	jmp    800eba <strnlen+0x22>
+  800eb6:	c3                   	ret
+  800eb7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800eba:	c3                   	ret
+
+0000000000800ebb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ebb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ec7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eca:	48 83 c2 01          	add    $0x1,%rdx
+  800ece:	84 c9                	test   %cl,%cl
+  800ed0:	75 f1                	jne    800ec3 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ed2:	c3                   	ret
+
+0000000000800ed3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ed3:	55                   	push   %rbp
+  800ed4:	48 89 e5             	mov    %rsp,%rbp
+  800ed7:	41 54                	push   %r12
+  800ed9:	53                   	push   %rbx
+  800eda:	48 89 fb             	mov    %rdi,%rbx
+  800edd:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ee0:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  800ee7:	00 00 00 
+  800eea:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800eec:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ef0:	4c 89 e6             	mov    %r12,%rsi
+  800ef3:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+    return dst;
+}
+  800eff:	48 89 d8             	mov    %rbx,%rax
+  800f02:	5b                   	pop    %rbx
+  800f03:	41 5c                	pop    %r12
+  800f05:	5d                   	pop    %rbp
+  800f06:	c3                   	ret
+
+0000000000800f07 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f07:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f0a:	48 85 d2             	test   %rdx,%rdx
+  800f0d:	74 1f                	je     800f2e <strncpy+0x27>
+  800f0f:	48 01 fa             	add    %rdi,%rdx
+  800f12:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f15:	48 83 c1 01          	add    $0x1,%rcx
+  800f19:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f1d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f21:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f25:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f29:	48 39 ca             	cmp    %rcx,%rdx
+  800f2c:	75 e7                	jne    800f15 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f2f:	48 89 f8             	mov    %rdi,%rax
+  800f32:	48 85 d2             	test   %rdx,%rdx
+  800f35:	74 24                	je     800f5b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f37:	48 83 ea 01          	sub    $0x1,%rdx
+  800f3b:	74 1b                	je     800f58 <strlcpy+0x29>
+  800f3d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f41:	0f b6 16             	movzbl (%rsi),%edx
+  800f44:	84 d2                	test   %dl,%dl
+  800f46:	74 10                	je     800f58 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f48:	48 83 c6 01          	add    $0x1,%rsi
+  800f4c:	48 83 c0 01          	add    $0x1,%rax
+  800f50:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f53:	48 39 c8             	cmp    %rcx,%rax
+  800f56:	75 e9                	jne    800f41 <strlcpy+0x12>
+        *dst = '\0';
+  800f58:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f5b:	48 29 f8             	sub    %rdi,%rax
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f5f:	0f b6 07             	movzbl (%rdi),%eax
+  800f62:	84 c0                	test   %al,%al
+  800f64:	74 13                	je     800f79 <strcmp+0x1a>
+  800f66:	38 06                	cmp    %al,(%rsi)
+  800f68:	75 0f                	jne    800f79 <strcmp+0x1a>
+  800f6a:	48 83 c7 01          	add    $0x1,%rdi
+  800f6e:	48 83 c6 01          	add    $0x1,%rsi
+  800f72:	0f b6 07             	movzbl (%rdi),%eax
+  800f75:	84 c0                	test   %al,%al
+  800f77:	75 ed                	jne    800f66 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f79:	0f b6 c0             	movzbl %al,%eax
+  800f7c:	0f b6 16             	movzbl (%rsi),%edx
+  800f7f:	29 d0                	sub    %edx,%eax
+}
+  800f81:	c3                   	ret
+
+0000000000800f82 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f82:	48 85 d2             	test   %rdx,%rdx
+  800f85:	74 1f                	je     800fa6 <strncmp+0x24>
+  800f87:	0f b6 07             	movzbl (%rdi),%eax
+  800f8a:	84 c0                	test   %al,%al
+  800f8c:	74 1e                	je     800fac <strncmp+0x2a>
+  800f8e:	3a 06                	cmp    (%rsi),%al
+  800f90:	75 1a                	jne    800fac <strncmp+0x2a>
+  800f92:	48 83 c7 01          	add    $0x1,%rdi
+  800f96:	48 83 c6 01          	add    $0x1,%rsi
+  800f9a:	48 83 ea 01          	sub    $0x1,%rdx
+  800f9e:	75 e7                	jne    800f87 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa5:	c3                   	ret
+  800fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fab:	c3                   	ret
+  800fac:	48 85 d2             	test   %rdx,%rdx
+  800faf:	74 09                	je     800fba <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fb1:	0f b6 07             	movzbl (%rdi),%eax
+  800fb4:	0f b6 16             	movzbl (%rsi),%edx
+  800fb7:	29 d0                	sub    %edx,%eax
+  800fb9:	c3                   	ret
+    if (!n) return 0;
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fbf:	c3                   	ret
+
+0000000000800fc0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fc0:	0f b6 17             	movzbl (%rdi),%edx
+  800fc3:	84 d2                	test   %dl,%dl
+  800fc5:	74 18                	je     800fdf <strchr+0x1f>
+        if (*str == c) {
+  800fc7:	0f be d2             	movsbl %dl,%edx
+  800fca:	39 f2                	cmp    %esi,%edx
+  800fcc:	74 17                	je     800fe5 <strchr+0x25>
+    for (; *str; str++) {
+  800fce:	48 83 c7 01          	add    $0x1,%rdi
+  800fd2:	0f b6 17             	movzbl (%rdi),%edx
+  800fd5:	84 d2                	test   %dl,%dl
+  800fd7:	75 ee                	jne    800fc7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fde:	c3                   	ret
+  800fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe4:	c3                   	ret
+  800fe5:	48 89 f8             	mov    %rdi,%rax
+}
+  800fe8:	c3                   	ret
+
+0000000000800fe9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fe9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fec:	0f b6 17             	movzbl (%rdi),%edx
+  800fef:	84 d2                	test   %dl,%dl
+  800ff1:	74 13                	je     801006 <strfind+0x1d>
+  800ff3:	0f be d2             	movsbl %dl,%edx
+  800ff6:	39 f2                	cmp    %esi,%edx
+  800ff8:	74 0b                	je     801005 <strfind+0x1c>
+  800ffa:	48 83 c0 01          	add    $0x1,%rax
+  800ffe:	0f b6 10             	movzbl (%rax),%edx
+  801001:	84 d2                	test   %dl,%dl
+  801003:	75 ee                	jne    800ff3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801005:	c3                   	ret
+  801006:	c3                   	ret
+
+0000000000801007 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801007:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80100a:	48 89 f8             	mov    %rdi,%rax
+  80100d:	48 f7 d8             	neg    %rax
+  801010:	83 e0 07             	and    $0x7,%eax
+  801013:	49 89 d1             	mov    %rdx,%r9
+  801016:	49 29 c1             	sub    %rax,%r9
+  801019:	78 36                	js     801051 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80101b:	40 0f b6 c6          	movzbl %sil,%eax
+  80101f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801026:	01 01 01 
+  801029:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80102d:	40 f6 c7 07          	test   $0x7,%dil
+  801031:	75 38                	jne    80106b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801033:	4c 89 c9             	mov    %r9,%rcx
+  801036:	48 c1 f9 03          	sar    $0x3,%rcx
+  80103a:	74 0c                	je     801048 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80103c:	fc                   	cld
+  80103d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801040:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801044:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801048:	4d 85 c9             	test   %r9,%r9
+  80104b:	75 45                	jne    801092 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80104d:	4c 89 c0             	mov    %r8,%rax
+  801050:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801051:	48 85 d2             	test   %rdx,%rdx
+  801054:	74 f7                	je     80104d <memset+0x46>
+  801056:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801059:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80105c:	48 83 c0 01          	add    $0x1,%rax
+  801060:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801064:	48 39 c2             	cmp    %rax,%rdx
+  801067:	75 f3                	jne    80105c <memset+0x55>
+  801069:	eb e2                	jmp    80104d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80106b:	40 f6 c7 01          	test   $0x1,%dil
+  80106f:	74 06                	je     801077 <memset+0x70>
+  801071:	88 07                	mov    %al,(%rdi)
+  801073:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801077:	40 f6 c7 02          	test   $0x2,%dil
+  80107b:	74 07                	je     801084 <memset+0x7d>
+  80107d:	66 89 07             	mov    %ax,(%rdi)
+  801080:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801084:	40 f6 c7 04          	test   $0x4,%dil
+  801088:	74 a9                	je     801033 <memset+0x2c>
+  80108a:	89 07                	mov    %eax,(%rdi)
+  80108c:	48 83 c7 04          	add    $0x4,%rdi
+  801090:	eb a1                	jmp    801033 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801092:	41 f6 c1 04          	test   $0x4,%r9b
+  801096:	74 06                	je     80109e <memset+0x97>
+  801098:	89 07                	mov    %eax,(%rdi)
+  80109a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80109e:	41 f6 c1 02          	test   $0x2,%r9b
+  8010a2:	74 07                	je     8010ab <memset+0xa4>
+  8010a4:	66 89 07             	mov    %ax,(%rdi)
+  8010a7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010ab:	41 f6 c1 01          	test   $0x1,%r9b
+  8010af:	74 9c                	je     80104d <memset+0x46>
+  8010b1:	88 07                	mov    %al,(%rdi)
+  8010b3:	eb 98                	jmp    80104d <memset+0x46>
+
+00000000008010b5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010b5:	48 89 f8             	mov    %rdi,%rax
+  8010b8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010bb:	48 39 fe             	cmp    %rdi,%rsi
+  8010be:	73 3b                	jae    8010fb <memmove+0x46>
+  8010c0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010c4:	48 39 d7             	cmp    %rdx,%rdi
+  8010c7:	73 32                	jae    8010fb <memmove+0x46>
+        s += n;
+        d += n;
+  8010c9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010cd:	48 89 d6             	mov    %rdx,%rsi
+  8010d0:	48 09 fe             	or     %rdi,%rsi
+  8010d3:	48 09 ce             	or     %rcx,%rsi
+  8010d6:	40 f6 c6 07          	test   $0x7,%sil
+  8010da:	75 12                	jne    8010ee <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010dc:	48 83 ef 08          	sub    $0x8,%rdi
+  8010e0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010e4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010e8:	fd                   	std
+  8010e9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010ec:	fc                   	cld
+  8010ed:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010ee:	48 83 ef 01          	sub    $0x1,%rdi
+  8010f2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010f6:	fd                   	std
+  8010f7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010f9:	eb f1                	jmp    8010ec <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010fb:	48 89 f2             	mov    %rsi,%rdx
+  8010fe:	48 09 c2             	or     %rax,%rdx
+  801101:	48 09 ca             	or     %rcx,%rdx
+  801104:	f6 c2 07             	test   $0x7,%dl
+  801107:	75 0c                	jne    801115 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801109:	48 c1 e9 03          	shr    $0x3,%rcx
+  80110d:	48 89 c7             	mov    %rax,%rdi
+  801110:	fc                   	cld
+  801111:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801114:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801115:	48 89 c7             	mov    %rax,%rdi
+  801118:	fc                   	cld
+  801119:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80111b:	c3                   	ret
+
+000000000080111c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801120:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  801127:	00 00 00 
+  80112a:	ff d0                	call   *%rax
+}
+  80112c:	5d                   	pop    %rbp
+  80112d:	c3                   	ret
+
+000000000080112e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80112e:	55                   	push   %rbp
+  80112f:	48 89 e5             	mov    %rsp,%rbp
+  801132:	41 57                	push   %r15
+  801134:	41 56                	push   %r14
+  801136:	41 55                	push   %r13
+  801138:	41 54                	push   %r12
+  80113a:	53                   	push   %rbx
+  80113b:	48 83 ec 08          	sub    $0x8,%rsp
+  80113f:	49 89 fe             	mov    %rdi,%r14
+  801142:	49 89 f7             	mov    %rsi,%r15
+  801145:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801148:	48 89 f7             	mov    %rsi,%rdi
+  80114b:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  801152:	00 00 00 
+  801155:	ff d0                	call   *%rax
+  801157:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80115a:	48 89 de             	mov    %rbx,%rsi
+  80115d:	4c 89 f7             	mov    %r14,%rdi
+  801160:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  801167:	00 00 00 
+  80116a:	ff d0                	call   *%rax
+  80116c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80116f:	48 39 c3             	cmp    %rax,%rbx
+  801172:	74 36                	je     8011aa <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801174:	48 89 d8             	mov    %rbx,%rax
+  801177:	4c 29 e8             	sub    %r13,%rax
+  80117a:	49 39 c4             	cmp    %rax,%r12
+  80117d:	73 31                	jae    8011b0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80117f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801184:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801188:	4c 89 fe             	mov    %r15,%rsi
+  80118b:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  801192:	00 00 00 
+  801195:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801197:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80119b:	48 83 c4 08          	add    $0x8,%rsp
+  80119f:	5b                   	pop    %rbx
+  8011a0:	41 5c                	pop    %r12
+  8011a2:	41 5d                	pop    %r13
+  8011a4:	41 5e                	pop    %r14
+  8011a6:	41 5f                	pop    %r15
+  8011a8:	5d                   	pop    %rbp
+  8011a9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011aa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011ae:	eb eb                	jmp    80119b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011b0:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011b8:	48 89 da             	mov    %rbx,%rdx
+  8011bb:	4c 89 fe             	mov    %r15,%rsi
+  8011be:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  8011c5:	00 00 00 
+  8011c8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011ca:	49 01 de             	add    %rbx,%r14
+  8011cd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011d2:	eb c3                	jmp    801197 <strlcat+0x69>
+
+00000000008011d4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011d4:	48 85 d2             	test   %rdx,%rdx
+  8011d7:	74 2d                	je     801206 <memcmp+0x32>
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011de:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011e2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011e7:	44 38 c1             	cmp    %r8b,%cl
+  8011ea:	75 0f                	jne    8011fb <memcmp+0x27>
+    while (n-- > 0) {
+  8011ec:	48 83 c0 01          	add    $0x1,%rax
+  8011f0:	48 39 c2             	cmp    %rax,%rdx
+  8011f3:	75 e9                	jne    8011de <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fa:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011fb:	0f b6 c1             	movzbl %cl,%eax
+  8011fe:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801202:	44 29 c0             	sub    %r8d,%eax
+  801205:	c3                   	ret
+    return 0;
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80120b:	c3                   	ret
+
+000000000080120c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80120c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801210:	48 39 c7             	cmp    %rax,%rdi
+  801213:	73 0f                	jae    801224 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801215:	40 38 37             	cmp    %sil,(%rdi)
+  801218:	74 0e                	je     801228 <memfind+0x1c>
+    for (; src < end; src++) {
+  80121a:	48 83 c7 01          	add    $0x1,%rdi
+  80121e:	48 39 f8             	cmp    %rdi,%rax
+  801221:	75 f2                	jne    801215 <memfind+0x9>
+  801223:	c3                   	ret
+  801224:	48 89 f8             	mov    %rdi,%rax
+  801227:	c3                   	ret
+  801228:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80122b:	c3                   	ret
+
+000000000080122c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80122c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80122f:	0f b6 37             	movzbl (%rdi),%esi
+  801232:	40 80 fe 20          	cmp    $0x20,%sil
+  801236:	74 06                	je     80123e <strtol+0x12>
+  801238:	40 80 fe 09          	cmp    $0x9,%sil
+  80123c:	75 13                	jne    801251 <strtol+0x25>
+  80123e:	48 83 c7 01          	add    $0x1,%rdi
+  801242:	0f b6 37             	movzbl (%rdi),%esi
+  801245:	40 80 fe 20          	cmp    $0x20,%sil
+  801249:	74 f3                	je     80123e <strtol+0x12>
+  80124b:	40 80 fe 09          	cmp    $0x9,%sil
+  80124f:	74 ed                	je     80123e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801251:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801254:	83 e0 fd             	and    $0xfffffffd,%eax
+  801257:	3c 01                	cmp    $0x1,%al
+  801259:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80125d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801263:	75 0f                	jne    801274 <strtol+0x48>
+  801265:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801268:	74 14                	je     80127e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80126a:	85 d2                	test   %edx,%edx
+  80126c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801271:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801279:	4c 63 ca             	movslq %edx,%r9
+  80127c:	eb 36                	jmp    8012b4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80127e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801282:	74 0f                	je     801293 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801284:	85 d2                	test   %edx,%edx
+  801286:	75 ec                	jne    801274 <strtol+0x48>
+        s++;
+  801288:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80128c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801291:	eb e1                	jmp    801274 <strtol+0x48>
+        s += 2;
+  801293:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801297:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80129c:	eb d6                	jmp    801274 <strtol+0x48>
+            dig -= '0';
+  80129e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012a1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012a5:	41 39 d0             	cmp    %edx,%r8d
+  8012a8:	7d 21                	jge    8012cb <strtol+0x9f>
+        val = val * base + dig;
+  8012aa:	49 0f af c1          	imul   %r9,%rax
+  8012ae:	0f b6 c9             	movzbl %cl,%ecx
+  8012b1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012b4:	48 83 c7 01          	add    $0x1,%rdi
+  8012b8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012bc:	80 f9 39             	cmp    $0x39,%cl
+  8012bf:	76 dd                	jbe    80129e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012c1:	80 f9 7b             	cmp    $0x7b,%cl
+  8012c4:	77 05                	ja     8012cb <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012c6:	83 e9 57             	sub    $0x57,%ecx
+  8012c9:	eb d6                	jmp    8012a1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012cb:	4d 85 d2             	test   %r10,%r10
+  8012ce:	74 03                	je     8012d3 <strtol+0xa7>
+  8012d0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012d3:	48 89 c2             	mov    %rax,%rdx
+  8012d6:	48 f7 da             	neg    %rdx
+  8012d9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012dd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012e1:	c3                   	ret
+
+00000000008012e2 <strrev>:
+
+void
+strrev(char *str)
+{
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	53                   	push   %rbx
+  8012e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8012eb:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8012ee:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  8012f5:	00 00 00 
+  8012f8:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8012fa:	83 e8 01             	sub    $0x1,%eax
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	7e 22                	jle    801323 <strrev+0x41>
+  801301:	48 98                	cltq
+  801303:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801308:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80130c:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801310:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801314:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801317:	48 83 c2 01          	add    $0x1,%rdx
+  80131b:	48 83 e8 01          	sub    $0x1,%rax
+  80131f:	39 c2                	cmp    %eax,%edx
+  801321:	7c e5                	jl     801308 <strrev+0x26>
+	}
+}
+  801323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+0000000000801329 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801329:	85 d2                	test   %edx,%edx
+  80132b:	0f 84 80 00 00 00    	je     8013b1 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801331:	55                   	push   %rbp
+  801332:	48 89 e5             	mov    %rsp,%rbp
+  801335:	53                   	push   %rbx
+  801336:	48 83 ec 08          	sub    $0x8,%rsp
+  80133a:	49 89 f2             	mov    %rsi,%r10
+  80133d:	41 89 d3             	mov    %edx,%r11d
+  801340:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801343:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801348:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80134b:	eb 20                	jmp    80136d <itoa+0x44>
+			str[i++] = '0' + digit;
+  80134d:	41 89 f1             	mov    %esi,%r9d
+  801350:	83 c2 30             	add    $0x30,%edx
+  801353:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801356:	89 f8                	mov    %edi,%eax
+  801358:	99                   	cltd
+  801359:	f7 f9                	idiv   %ecx
+  80135b:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	74 2e                	je     80138f <itoa+0x66>
+  801361:	83 c6 01             	add    $0x1,%esi
+  801364:	49 83 c0 01          	add    $0x1,%r8
+  801368:	44 39 cb             	cmp    %r9d,%ebx
+  80136b:	7e 15                	jle    801382 <itoa+0x59>
+		digit = sum % base;
+  80136d:	89 f8                	mov    %edi,%eax
+  80136f:	99                   	cltd
+  801370:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801372:	83 fa 09             	cmp    $0x9,%edx
+  801375:	7e d6                	jle    80134d <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801377:	41 89 f1             	mov    %esi,%r9d
+  80137a:	83 c2 37             	add    $0x37,%edx
+  80137d:	41 88 10             	mov    %dl,(%r8)
+  801380:	eb d4                	jmp    801356 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801382:	41 83 eb 01          	sub    $0x1,%r11d
+  801386:	45 39 cb             	cmp    %r9d,%r11d
+  801389:	75 04                	jne    80138f <itoa+0x66>
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	75 28                	jne    8013b7 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80138f:	4d 63 c9             	movslq %r9d,%r9
+  801392:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801397:	4c 89 d7             	mov    %r10,%rdi
+  80139a:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  8013a1:	00 00 00 
+  8013a4:	ff d0                	call   *%rax
+	return 0;
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+		return -1;
+  8013b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013b6:	c3                   	ret
+		return -1;
+  8013b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013bc:	eb ed                	jmp    8013ab <itoa+0x82>
+
+00000000008013be <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013be:	55                   	push   %rbp
+  8013bf:	48 89 e5             	mov    %rsp,%rbp
+  8013c2:	53                   	push   %rbx
+  8013c3:	48 89 fa             	mov    %rdi,%rdx
+  8013c6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e9:	c9                   	leave
+  8013ea:	c3                   	ret
+
+00000000008013eb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+  80140e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801414:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141a:	c9                   	leave
+  80141b:	c3                   	ret
+
+000000000080141c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+  801421:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801428:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801432:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801437:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143c:	be 00 00 00 00       	mov    $0x0,%esi
+  801441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801447:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801449:	48 85 c0             	test   %rax,%rax
+  80144c:	7f 06                	jg     801454 <sys_env_destroy+0x38>
+}
+  80144e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801452:	c9                   	leave
+  801453:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801454:	49 89 c0             	mov    %rax,%r8
+  801457:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80145c:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  801463:	00 00 00 
+  801466:	be 26 00 00 00       	mov    $0x26,%esi
+  80146b:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  801472:	00 00 00 
+  801475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147a:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  801481:	00 00 00 
+  801484:	41 ff d1             	call   *%r9
+
+0000000000801487 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801487:	55                   	push   %rbp
+  801488:	48 89 e5             	mov    %rsp,%rbp
+  80148b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80148c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801491:	ba 00 00 00 00       	mov    $0x0,%edx
+  801496:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b6:	c9                   	leave
+  8014b7:	c3                   	ret
+
+00000000008014b8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8014b8:	55                   	push   %rbp
+  8014b9:	48 89 e5             	mov    %rsp,%rbp
+  8014bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e7:	c9                   	leave
+  8014e8:	c3                   	ret
+
+00000000008014e9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014e9:	55                   	push   %rbp
+  8014ea:	48 89 e5             	mov    %rsp,%rbp
+  8014ed:	53                   	push   %rbx
+  8014ee:	48 89 fa             	mov    %rdi,%rdx
+  8014f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801500:	00 00 00 
+  801503:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801508:	be 00 00 00 00       	mov    $0x0,%esi
+  80150d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801513:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801515:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801519:	c9                   	leave
+  80151a:	c3                   	ret
+
+000000000080151b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80151b:	55                   	push   %rbp
+  80151c:	48 89 e5             	mov    %rsp,%rbp
+  80151f:	53                   	push   %rbx
+  801520:	49 89 f8             	mov    %rdi,%r8
+  801523:	48 89 d3             	mov    %rdx,%rbx
+  801526:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801529:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152e:	4c 89 c2             	mov    %r8,%rdx
+  801531:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801534:	be 00 00 00 00       	mov    $0x0,%esi
+  801539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801541:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801545:	c9                   	leave
+  801546:	c3                   	ret
+
+0000000000801547 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801547:	55                   	push   %rbp
+  801548:	48 89 e5             	mov    %rsp,%rbp
+  80154b:	53                   	push   %rbx
+  80154c:	48 83 ec 08          	sub    $0x8,%rsp
+  801550:	89 f8                	mov    %edi,%eax
+  801552:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801555:	48 63 f9             	movslq %ecx,%rdi
+  801558:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801560:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801570:	48 85 c0             	test   %rax,%rax
+  801573:	7f 06                	jg     80157b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157b:	49 89 c0             	mov    %rax,%r8
+  80157e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801583:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  80158a:	00 00 00 
+  80158d:	be 26 00 00 00       	mov    $0x26,%esi
+  801592:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  801599:	00 00 00 
+  80159c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a1:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  8015a8:	00 00 00 
+  8015ab:	41 ff d1             	call   *%r9
+
+00000000008015ae <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b7:	89 f8                	mov    %edi,%eax
+  8015b9:	49 89 f2             	mov    %rsi,%r10
+  8015bc:	48 89 cf             	mov    %rcx,%rdi
+  8015bf:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015c2:	48 63 da             	movslq %edx,%rbx
+  8015c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d5:	48 85 c0             	test   %rax,%rax
+  8015d8:	7f 06                	jg     8015e0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e0:	49 89 c0             	mov    %rax,%r8
+  8015e3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015e8:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  8015ef:	00 00 00 
+  8015f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f7:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  8015fe:	00 00 00 
+  801601:	b8 00 00 00 00       	mov    $0x0,%eax
+  801606:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  80160d:	00 00 00 
+  801610:	41 ff d1             	call   *%r9
+
+0000000000801613 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801613:	55                   	push   %rbp
+  801614:	48 89 e5             	mov    %rsp,%rbp
+  801617:	53                   	push   %rbx
+  801618:	48 83 ec 08          	sub    $0x8,%rsp
+  80161c:	48 89 f1             	mov    %rsi,%rcx
+  80161f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801622:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162f:	be 00 00 00 00       	mov    $0x0,%esi
+  801634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80163c:	48 85 c0             	test   %rax,%rax
+  80163f:	7f 06                	jg     801647 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801647:	49 89 c0             	mov    %rax,%r8
+  80164a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80164f:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  801656:	00 00 00 
+  801659:	be 26 00 00 00       	mov    $0x26,%esi
+  80165e:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  801665:	00 00 00 
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  801674:	00 00 00 
+  801677:	41 ff d1             	call   *%r9
+
+000000000080167a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	53                   	push   %rbx
+  80167f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801683:	48 63 ce             	movslq %esi,%rcx
+  801686:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801689:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801693:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801698:	be 00 00 00 00       	mov    $0x0,%esi
+  80169d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a5:	48 85 c0             	test   %rax,%rax
+  8016a8:	7f 06                	jg     8016b0 <sys_env_set_status+0x36>
+}
+  8016aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ae:	c9                   	leave
+  8016af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b0:	49 89 c0             	mov    %rax,%r8
+  8016b3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8016b8:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  8016bf:	00 00 00 
+  8016c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c7:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  8016ce:	00 00 00 
+  8016d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d6:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  8016dd:	00 00 00 
+  8016e0:	41 ff d1             	call   *%r9
+
+00000000008016e3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	53                   	push   %rbx
+  8016e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ec:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801701:	be 00 00 00 00       	mov    $0x0,%esi
+  801706:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80170e:	48 85 c0             	test   %rax,%rax
+  801711:	7f 06                	jg     801719 <sys_env_set_trapframe+0x36>
+}
+  801713:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801719:	49 89 c0             	mov    %rax,%r8
+  80171c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801721:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  801728:	00 00 00 
+  80172b:	be 26 00 00 00       	mov    $0x26,%esi
+  801730:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  801737:	00 00 00 
+  80173a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173f:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  801746:	00 00 00 
+  801749:	41 ff d1             	call   *%r9
+
+000000000080174c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80174c:	55                   	push   %rbp
+  80174d:	48 89 e5             	mov    %rsp,%rbp
+  801750:	53                   	push   %rbx
+  801751:	48 83 ec 08          	sub    $0x8,%rsp
+  801755:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801758:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80175b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176a:	be 00 00 00 00       	mov    $0x0,%esi
+  80176f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801775:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801777:	48 85 c0             	test   %rax,%rax
+  80177a:	7f 06                	jg     801782 <sys_env_set_pgfault_upcall+0x36>
+}
+  80177c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801782:	49 89 c0             	mov    %rax,%r8
+  801785:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80178a:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  801791:	00 00 00 
+  801794:	be 26 00 00 00       	mov    $0x26,%esi
+  801799:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  8017a0:	00 00 00 
+  8017a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a8:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  8017af:	00 00 00 
+  8017b2:	41 ff d1             	call   *%r9
+
+00000000008017b5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	53                   	push   %rbx
+  8017ba:	89 f8                	mov    %edi,%eax
+  8017bc:	49 89 f1             	mov    %rsi,%r9
+  8017bf:	48 89 d3             	mov    %rdx,%rbx
+  8017c2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017c5:	49 63 f0             	movslq %r8d,%rsi
+  8017c8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d9:	cd 30                	int    $0x30
+}
+  8017db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+00000000008017e1 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8017e1:	55                   	push   %rbp
+  8017e2:	48 89 e5             	mov    %rsp,%rbp
+  8017e5:	53                   	push   %rbx
+  8017e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ea:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8017ed:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017f5:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801802:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801808:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	7f 06                	jg     801815 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80180f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801815:	49 89 c0             	mov    %rax,%r8
+  801818:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80181d:	48 ba 48 41 80 00 00 	movabs $0x804148,%rdx
+  801824:	00 00 00 
+  801827:	be 26 00 00 00       	mov    $0x26,%esi
+  80182c:	48 bf 67 41 80 00 00 	movabs $0x804167,%rdi
+  801833:	00 00 00 
+  801836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183b:	49 b9 46 04 80 00 00 	movabs $0x800446,%r9
+  801842:	00 00 00 
+  801845:	41 ff d1             	call   *%r9
+
+0000000000801848 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80184c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801851:	48 b8 e1 17 80 00 00 	movabs $0x8017e1,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+}
+  80185d:	5d                   	pop    %rbp
+  80185e:	c3                   	ret
+
+000000000080185f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80185f:	55                   	push   %rbp
+  801860:	48 89 e5             	mov    %rsp,%rbp
+  801863:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801864:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801869:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801873:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801878:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187d:	be 00 00 00 00       	mov    $0x0,%esi
+  801882:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801888:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80188a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188e:	c9                   	leave
+  80188f:	c3                   	ret
+
+0000000000801890 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+  801894:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801895:	48 63 ce             	movslq %esi,%rcx
+  801898:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80189c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b6:	cd 30                	int    $0x30
+}
+  8018b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018bc:	c9                   	leave
+  8018bd:	c3                   	ret
+
+00000000008018be <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8018be:	55                   	push   %rbp
+  8018bf:	48 89 e5             	mov    %rsp,%rbp
+  8018c2:	53                   	push   %rbx
+  8018c3:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8018c6:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ca:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e4:	cd 30                	int    $0x30
+}
+  8018e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+00000000008018ec <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8018ec:	55                   	push   %rbp
+  8018ed:	48 89 e5             	mov    %rsp,%rbp
+  8018f0:	53                   	push   %rbx
+  8018f1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8018f4:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018fc:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801904:	be 00 00 00 00       	mov    $0x0,%esi
+  801909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190f:	cd 30                	int    $0x30
+}
+  801911:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801915:	c9                   	leave
+  801916:	c3                   	ret
+
+0000000000801917 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801917:	55                   	push   %rbp
+  801918:	48 89 e5             	mov    %rsp,%rbp
+  80191b:	41 54                	push   %r12
+  80191d:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80191e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801923:	cd 30                	int    $0x30
+  801925:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	78 7e                	js     8019aa <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  80192c:	0f 84 80 00 00 00    	je     8019b2 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801932:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801938:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80193f:	00 00 00 
+  801942:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801947:	89 c2                	mov    %eax,%edx
+  801949:	be 00 00 00 00       	mov    $0x0,%esi
+  80194e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801953:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  80195a:	00 00 00 
+  80195d:	ff d0                	call   *%rax
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	0f 88 81 00 00 00    	js     8019e8 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801967:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80196e:	00 00 00 
+  801971:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801978:	44 89 e7             	mov    %r12d,%edi
+  80197b:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  801982:	00 00 00 
+  801985:	ff d0                	call   *%rax
+  801987:	85 c0                	test   %eax,%eax
+  801989:	78 65                	js     8019f0 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80198b:	be 02 00 00 00       	mov    $0x2,%esi
+  801990:	44 89 e7             	mov    %r12d,%edi
+  801993:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+        return -1;
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8019a6:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  8019aa:	44 89 e0             	mov    %r12d,%eax
+  8019ad:	5b                   	pop    %rbx
+  8019ae:	41 5c                	pop    %r12
+  8019b0:	5d                   	pop    %rbp
+  8019b1:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8019b2:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  8019b9:	00 00 00 
+  8019bc:	ff d0                	call   *%rax
+  8019be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019c3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8019c7:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8019cb:	48 c1 e0 04          	shl    $0x4,%rax
+  8019cf:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019d6:	00 00 00 
+  8019d9:	48 01 d0             	add    %rdx,%rax
+  8019dc:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8019e3:	00 00 00 
+        return 0;
+  8019e6:	eb c2                	jmp    8019aa <fork+0x93>
+        return -1;
+  8019e8:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019ee:	eb ba                	jmp    8019aa <fork+0x93>
+        return -1;
+  8019f0:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019f6:	eb b2                	jmp    8019aa <fork+0x93>
+
+00000000008019f8 <sfork>:
+
+envid_t
+sfork() {
+  8019f8:	55                   	push   %rbp
+  8019f9:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019fc:	48 ba 75 41 80 00 00 	movabs $0x804175,%rdx
+  801a03:	00 00 00 
+  801a06:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801a0b:	48 bf 90 41 80 00 00 	movabs $0x804190,%rdi
+  801a12:	00 00 00 
+  801a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1a:	48 b9 46 04 80 00 00 	movabs $0x800446,%rcx
+  801a21:	00 00 00 
+  801a24:	ff d1                	call   *%rcx
+
+0000000000801a26 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a26:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a2d:	ff ff ff 
+  801a30:	48 01 f8             	add    %rdi,%rax
+  801a33:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a37:	c3                   	ret
+
+0000000000801a38 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a38:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a3f:	ff ff ff 
+  801a42:	48 01 f8             	add    %rdi,%rax
+  801a45:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a49:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a4f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a53:	c3                   	ret
+
+0000000000801a54 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a54:	55                   	push   %rbp
+  801a55:	48 89 e5             	mov    %rsp,%rbp
+  801a58:	41 57                	push   %r15
+  801a5a:	41 56                	push   %r14
+  801a5c:	41 55                	push   %r13
+  801a5e:	41 54                	push   %r12
+  801a60:	53                   	push   %rbx
+  801a61:	48 83 ec 08          	sub    $0x8,%rsp
+  801a65:	49 89 ff             	mov    %rdi,%r15
+  801a68:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a6d:	49 bd 73 35 80 00 00 	movabs $0x803573,%r13
+  801a74:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a77:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a7d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a80:	48 89 df             	mov    %rbx,%rdi
+  801a83:	41 ff d5             	call   *%r13
+  801a86:	83 e0 04             	and    $0x4,%eax
+  801a89:	74 17                	je     801aa2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a8b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a92:	4c 39 f3             	cmp    %r14,%rbx
+  801a95:	75 e6                	jne    801a7d <fd_alloc+0x29>
+  801a97:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a9d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801aa2:	4d 89 27             	mov    %r12,(%r15)
+}
+  801aa5:	48 83 c4 08          	add    $0x8,%rsp
+  801aa9:	5b                   	pop    %rbx
+  801aaa:	41 5c                	pop    %r12
+  801aac:	41 5d                	pop    %r13
+  801aae:	41 5e                	pop    %r14
+  801ab0:	41 5f                	pop    %r15
+  801ab2:	5d                   	pop    %rbp
+  801ab3:	c3                   	ret
+
+0000000000801ab4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ab4:	83 ff 1f             	cmp    $0x1f,%edi
+  801ab7:	77 39                	ja     801af2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ab9:	55                   	push   %rbp
+  801aba:	48 89 e5             	mov    %rsp,%rbp
+  801abd:	41 54                	push   %r12
+  801abf:	53                   	push   %rbx
+  801ac0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ac3:	48 63 df             	movslq %edi,%rbx
+  801ac6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801acd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ad1:	48 89 df             	mov    %rbx,%rdi
+  801ad4:	48 b8 73 35 80 00 00 	movabs $0x803573,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+  801ae0:	a8 04                	test   $0x4,%al
+  801ae2:	74 14                	je     801af8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ae4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aed:	5b                   	pop    %rbx
+  801aee:	41 5c                	pop    %r12
+  801af0:	5d                   	pop    %rbp
+  801af1:	c3                   	ret
+        return -E_INVAL;
+  801af2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801af7:	c3                   	ret
+        return -E_INVAL;
+  801af8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801afd:	eb ee                	jmp    801aed <fd_lookup+0x39>
+
+0000000000801aff <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	41 54                	push   %r12
+  801b05:	53                   	push   %rbx
+  801b06:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b09:	48 b8 40 42 80 00 00 	movabs $0x804240,%rax
+  801b10:	00 00 00 
+  801b13:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801b1a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b1d:	39 3b                	cmp    %edi,(%rbx)
+  801b1f:	74 47                	je     801b68 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b21:	48 83 c0 08          	add    $0x8,%rax
+  801b25:	48 8b 18             	mov    (%rax),%rbx
+  801b28:	48 85 db             	test   %rbx,%rbx
+  801b2b:	75 f0                	jne    801b1d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b2d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b34:	00 00 00 
+  801b37:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b3d:	89 fa                	mov    %edi,%edx
+  801b3f:	48 bf a0 41 80 00 00 	movabs $0x8041a0,%rdi
+  801b46:	00 00 00 
+  801b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4e:	48 b9 96 05 80 00 00 	movabs $0x800596,%rcx
+  801b55:	00 00 00 
+  801b58:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b5f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b63:	5b                   	pop    %rbx
+  801b64:	41 5c                	pop    %r12
+  801b66:	5d                   	pop    %rbp
+  801b67:	c3                   	ret
+            return 0;
+  801b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6d:	eb f0                	jmp    801b5f <dev_lookup+0x60>
+
+0000000000801b6f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b6f:	55                   	push   %rbp
+  801b70:	48 89 e5             	mov    %rsp,%rbp
+  801b73:	41 55                	push   %r13
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+  801b78:	48 83 ec 18          	sub    $0x18,%rsp
+  801b7c:	48 89 fb             	mov    %rdi,%rbx
+  801b7f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b82:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b89:	ff ff ff 
+  801b8c:	48 01 df             	add    %rbx,%rdi
+  801b8f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b93:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b97:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	41 89 c5             	mov    %eax,%r13d
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 06                	js     801bb0 <fd_close+0x41>
+  801baa:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bae:	74 1a                	je     801bca <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bb0:	45 84 e4             	test   %r12b,%r12b
+  801bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bbc:	44 89 e8             	mov    %r13d,%eax
+  801bbf:	48 83 c4 18          	add    $0x18,%rsp
+  801bc3:	5b                   	pop    %rbx
+  801bc4:	41 5c                	pop    %r12
+  801bc6:	41 5d                	pop    %r13
+  801bc8:	5d                   	pop    %rbp
+  801bc9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bca:	8b 3b                	mov    (%rbx),%edi
+  801bcc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd0:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+  801bdc:	41 89 c5             	mov    %eax,%r13d
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 1b                	js     801bfe <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801be3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801be7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801beb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bf1:	48 85 c0             	test   %rax,%rax
+  801bf4:	74 08                	je     801bfe <fd_close+0x8f>
+  801bf6:	48 89 df             	mov    %rbx,%rdi
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bfe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c03:	48 89 de             	mov    %rbx,%rsi
+  801c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0b:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+    return res;
+  801c17:	eb a3                	jmp    801bbc <fd_close+0x4d>
+
+0000000000801c19 <close>:
+
+int
+close(int fdnum) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c25:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	78 15                	js     801c4a <close+0x31>
+
+    return fd_close(fd, 1);
+  801c35:	be 01 00 00 00       	mov    $0x1,%esi
+  801c3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c3e:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  801c45:	00 00 00 
+  801c48:	ff d0                	call   *%rax
+}
+  801c4a:	c9                   	leave
+  801c4b:	c3                   	ret
+
+0000000000801c4c <close_all>:
+
+void
+close_all(void) {
+  801c4c:	55                   	push   %rbp
+  801c4d:	48 89 e5             	mov    %rsp,%rbp
+  801c50:	41 54                	push   %r12
+  801c52:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c58:	49 bc 19 1c 80 00 00 	movabs $0x801c19,%r12
+  801c5f:	00 00 00 
+  801c62:	89 df                	mov    %ebx,%edi
+  801c64:	41 ff d4             	call   *%r12
+  801c67:	83 c3 01             	add    $0x1,%ebx
+  801c6a:	83 fb 20             	cmp    $0x20,%ebx
+  801c6d:	75 f3                	jne    801c62 <close_all+0x16>
+}
+  801c6f:	5b                   	pop    %rbx
+  801c70:	41 5c                	pop    %r12
+  801c72:	5d                   	pop    %rbp
+  801c73:	c3                   	ret
+
+0000000000801c74 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c74:	55                   	push   %rbp
+  801c75:	48 89 e5             	mov    %rsp,%rbp
+  801c78:	41 57                	push   %r15
+  801c7a:	41 56                	push   %r14
+  801c7c:	41 55                	push   %r13
+  801c7e:	41 54                	push   %r12
+  801c80:	53                   	push   %rbx
+  801c81:	48 83 ec 18          	sub    $0x18,%rsp
+  801c85:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c88:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c8c:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	89 c3                	mov    %eax,%ebx
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	0f 88 b8 00 00 00    	js     801d5a <dup+0xe6>
+    close(newfdnum);
+  801ca2:	44 89 e7             	mov    %r12d,%edi
+  801ca5:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cb1:	4d 63 ec             	movslq %r12d,%r13
+  801cb4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cbb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cbf:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cc3:	4c 89 ff             	mov    %r15,%rdi
+  801cc6:	49 be 38 1a 80 00 00 	movabs $0x801a38,%r14
+  801ccd:	00 00 00 
+  801cd0:	41 ff d6             	call   *%r14
+  801cd3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cd6:	4c 89 ef             	mov    %r13,%rdi
+  801cd9:	41 ff d6             	call   *%r14
+  801cdc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cdf:	48 89 df             	mov    %rbx,%rdi
+  801ce2:	48 b8 73 35 80 00 00 	movabs $0x803573,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cee:	a8 04                	test   $0x4,%al
+  801cf0:	74 2b                	je     801d1d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801cf2:	41 89 c1             	mov    %eax,%r9d
+  801cf5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cfb:	4c 89 f1             	mov    %r14,%rcx
+  801cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d03:	48 89 de             	mov    %rbx,%rsi
+  801d06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0b:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  801d12:	00 00 00 
+  801d15:	ff d0                	call   *%rax
+  801d17:	89 c3                	mov    %eax,%ebx
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	78 4e                	js     801d6b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d1d:	4c 89 ff             	mov    %r15,%rdi
+  801d20:	48 b8 73 35 80 00 00 	movabs $0x803573,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+  801d2c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d2f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d35:	4c 89 e9             	mov    %r13,%rcx
+  801d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3d:	4c 89 fe             	mov    %r15,%rsi
+  801d40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d45:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+  801d51:	89 c3                	mov    %eax,%ebx
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	78 14                	js     801d6b <dup+0xf7>
+
+    return newfdnum;
+  801d57:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d5a:	89 d8                	mov    %ebx,%eax
+  801d5c:	48 83 c4 18          	add    $0x18,%rsp
+  801d60:	5b                   	pop    %rbx
+  801d61:	41 5c                	pop    %r12
+  801d63:	41 5d                	pop    %r13
+  801d65:	41 5e                	pop    %r14
+  801d67:	41 5f                	pop    %r15
+  801d69:	5d                   	pop    %rbp
+  801d6a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d70:	4c 89 ee             	mov    %r13,%rsi
+  801d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d78:	49 bc 13 16 80 00 00 	movabs $0x801613,%r12
+  801d7f:	00 00 00 
+  801d82:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d8a:	4c 89 f6             	mov    %r14,%rsi
+  801d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d92:	41 ff d4             	call   *%r12
+    return res;
+  801d95:	eb c3                	jmp    801d5a <dup+0xe6>
+
+0000000000801d97 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d97:	55                   	push   %rbp
+  801d98:	48 89 e5             	mov    %rsp,%rbp
+  801d9b:	41 56                	push   %r14
+  801d9d:	41 55                	push   %r13
+  801d9f:	41 54                	push   %r12
+  801da1:	53                   	push   %rbx
+  801da2:	48 83 ec 10          	sub    $0x10,%rsp
+  801da6:	89 fb                	mov    %edi,%ebx
+  801da8:	49 89 f4             	mov    %rsi,%r12
+  801dab:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dae:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801db2:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 4c                	js     801e0e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dc6:	41 8b 3e             	mov    (%r14),%edi
+  801dc9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dcd:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 35                	js     801e12 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ddd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801de1:	83 e0 03             	and    $0x3,%eax
+  801de4:	83 f8 01             	cmp    $0x1,%eax
+  801de7:	74 2d                	je     801e16 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801de9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ded:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801df1:	48 85 c0             	test   %rax,%rax
+  801df4:	74 56                	je     801e4c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801df6:	4c 89 ea             	mov    %r13,%rdx
+  801df9:	4c 89 e6             	mov    %r12,%rsi
+  801dfc:	4c 89 f7             	mov    %r14,%rdi
+  801dff:	ff d0                	call   *%rax
+}
+  801e01:	48 83 c4 10          	add    $0x10,%rsp
+  801e05:	5b                   	pop    %rbx
+  801e06:	41 5c                	pop    %r12
+  801e08:	41 5d                	pop    %r13
+  801e0a:	41 5e                	pop    %r14
+  801e0c:	5d                   	pop    %rbp
+  801e0d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0e:	48 98                	cltq
+  801e10:	eb ef                	jmp    801e01 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e12:	48 98                	cltq
+  801e14:	eb eb                	jmp    801e01 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e16:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e1d:	00 00 00 
+  801e20:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e26:	89 da                	mov    %ebx,%edx
+  801e28:	48 bf 01 42 80 00 00 	movabs $0x804201,%rdi
+  801e2f:	00 00 00 
+  801e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e37:	48 b9 96 05 80 00 00 	movabs $0x800596,%rcx
+  801e3e:	00 00 00 
+  801e41:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e43:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e4a:	eb b5                	jmp    801e01 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e4c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e53:	eb ac                	jmp    801e01 <read+0x6a>
+
+0000000000801e55 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801e55:	55                   	push   %rbp
+  801e56:	48 89 e5             	mov    %rsp,%rbp
+  801e59:	41 56                	push   %r14
+  801e5b:	41 55                	push   %r13
+  801e5d:	41 54                	push   %r12
+  801e5f:	53                   	push   %rbx
+  801e60:	48 83 ec 10          	sub    $0x10,%rsp
+  801e64:	89 fb                	mov    %edi,%ebx
+  801e66:	49 89 f4             	mov    %rsi,%r12
+  801e69:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e70:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 41                	js     801ec1 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e80:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e84:	41 8b 3e             	mov    (%r14),%edi
+  801e87:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e8b:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801e92:	00 00 00 
+  801e95:	ff d0                	call   *%rax
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 35                	js     801ed0 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e9b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e9f:	83 e0 03             	and    $0x3,%eax
+  801ea2:	83 f8 01             	cmp    $0x1,%eax
+  801ea5:	74 2d                	je     801ed4 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ea7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eab:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801eaf:	48 85 c0             	test   %rax,%rax
+  801eb2:	74 56                	je     801f0a <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801eb4:	4c 89 ea             	mov    %r13,%rdx
+  801eb7:	4c 89 e6             	mov    %r12,%rsi
+  801eba:	4c 89 f7             	mov    %r14,%rdi
+  801ebd:	ff d0                	call   *%rax
+  801ebf:	eb 02                	jmp    801ec3 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec1:	48 98                	cltq
+}
+  801ec3:	48 83 c4 10          	add    $0x10,%rsp
+  801ec7:	5b                   	pop    %rbx
+  801ec8:	41 5c                	pop    %r12
+  801eca:	41 5d                	pop    %r13
+  801ecc:	41 5e                	pop    %r14
+  801ece:	5d                   	pop    %rbp
+  801ecf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed0:	48 98                	cltq
+  801ed2:	eb ef                	jmp    801ec3 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ed4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801edb:	00 00 00 
+  801ede:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ee4:	89 da                	mov    %ebx,%edx
+  801ee6:	48 bf c0 41 80 00 00 	movabs $0x8041c0,%rdi
+  801eed:	00 00 00 
+  801ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef5:	48 b9 96 05 80 00 00 	movabs $0x800596,%rcx
+  801efc:	00 00 00 
+  801eff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f01:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f08:	eb b9                	jmp    801ec3 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f0a:	4c 89 ea             	mov    %r13,%rdx
+  801f0d:	4c 89 e6             	mov    %r12,%rsi
+  801f10:	89 df                	mov    %ebx,%edi
+  801f12:	48 b8 97 1d 80 00 00 	movabs $0x801d97,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+  801f1e:	eb a3                	jmp    801ec3 <readmap+0x6e>
+
+0000000000801f20 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f20:	55                   	push   %rbp
+  801f21:	48 89 e5             	mov    %rsp,%rbp
+  801f24:	41 57                	push   %r15
+  801f26:	41 56                	push   %r14
+  801f28:	41 55                	push   %r13
+  801f2a:	41 54                	push   %r12
+  801f2c:	53                   	push   %rbx
+  801f2d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f31:	48 85 d2             	test   %rdx,%rdx
+  801f34:	74 54                	je     801f8a <readn+0x6a>
+  801f36:	41 89 fd             	mov    %edi,%r13d
+  801f39:	49 89 f6             	mov    %rsi,%r14
+  801f3c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f44:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f49:	49 bf 97 1d 80 00 00 	movabs $0x801d97,%r15
+  801f50:	00 00 00 
+  801f53:	4c 89 e2             	mov    %r12,%rdx
+  801f56:	48 29 f2             	sub    %rsi,%rdx
+  801f59:	4c 01 f6             	add    %r14,%rsi
+  801f5c:	44 89 ef             	mov    %r13d,%edi
+  801f5f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	78 20                	js     801f86 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f66:	01 c3                	add    %eax,%ebx
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	74 08                	je     801f74 <readn+0x54>
+  801f6c:	48 63 f3             	movslq %ebx,%rsi
+  801f6f:	4c 39 e6             	cmp    %r12,%rsi
+  801f72:	72 df                	jb     801f53 <readn+0x33>
+    }
+    return res;
+  801f74:	48 63 c3             	movslq %ebx,%rax
+}
+  801f77:	48 83 c4 08          	add    $0x8,%rsp
+  801f7b:	5b                   	pop    %rbx
+  801f7c:	41 5c                	pop    %r12
+  801f7e:	41 5d                	pop    %r13
+  801f80:	41 5e                	pop    %r14
+  801f82:	41 5f                	pop    %r15
+  801f84:	5d                   	pop    %rbp
+  801f85:	c3                   	ret
+        if (inc < 0) return inc;
+  801f86:	48 98                	cltq
+  801f88:	eb ed                	jmp    801f77 <readn+0x57>
+    int inc = 1, res = 0;
+  801f8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8f:	eb e3                	jmp    801f74 <readn+0x54>
+
+0000000000801f91 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	41 56                	push   %r14
+  801f97:	41 55                	push   %r13
+  801f99:	41 54                	push   %r12
+  801f9b:	53                   	push   %rbx
+  801f9c:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa0:	89 fb                	mov    %edi,%ebx
+  801fa2:	49 89 f4             	mov    %rsi,%r12
+  801fa5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fac:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 47                	js     802003 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fc0:	41 8b 3e             	mov    (%r14),%edi
+  801fc3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc7:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	78 30                	js     802007 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801fdc:	74 2d                	je     80200b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fe2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fe6:	48 85 c0             	test   %rax,%rax
+  801fe9:	74 56                	je     802041 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801feb:	4c 89 ea             	mov    %r13,%rdx
+  801fee:	4c 89 e6             	mov    %r12,%rsi
+  801ff1:	4c 89 f7             	mov    %r14,%rdi
+  801ff4:	ff d0                	call   *%rax
+}
+  801ff6:	48 83 c4 10          	add    $0x10,%rsp
+  801ffa:	5b                   	pop    %rbx
+  801ffb:	41 5c                	pop    %r12
+  801ffd:	41 5d                	pop    %r13
+  801fff:	41 5e                	pop    %r14
+  802001:	5d                   	pop    %rbp
+  802002:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802003:	48 98                	cltq
+  802005:	eb ef                	jmp    801ff6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802007:	48 98                	cltq
+  802009:	eb eb                	jmp    801ff6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80200b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802012:	00 00 00 
+  802015:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80201b:	89 da                	mov    %ebx,%edx
+  80201d:	48 bf 1d 42 80 00 00 	movabs $0x80421d,%rdi
+  802024:	00 00 00 
+  802027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202c:	48 b9 96 05 80 00 00 	movabs $0x800596,%rcx
+  802033:	00 00 00 
+  802036:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802038:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80203f:	eb b5                	jmp    801ff6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802041:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802048:	eb ac                	jmp    801ff6 <write+0x65>
+
+000000000080204a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80204a:	55                   	push   %rbp
+  80204b:	48 89 e5             	mov    %rsp,%rbp
+  80204e:	53                   	push   %rbx
+  80204f:	48 83 ec 18          	sub    $0x18,%rsp
+  802053:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802055:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802059:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 0c                	js     802075 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802069:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802070:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+
+000000000080207b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80207b:	55                   	push   %rbp
+  80207c:	48 89 e5             	mov    %rsp,%rbp
+  80207f:	41 55                	push   %r13
+  802081:	41 54                	push   %r12
+  802083:	53                   	push   %rbx
+  802084:	48 83 ec 18          	sub    $0x18,%rsp
+  802088:	89 fb                	mov    %edi,%ebx
+  80208a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80208d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802091:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 38                	js     8020d9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020a5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020a9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020ad:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 1c                	js     8020d9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020bd:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020c2:	74 20                	je     8020e4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c8:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8020cc:	48 85 c0             	test   %rax,%rax
+  8020cf:	74 47                	je     802118 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020d1:	44 89 e6             	mov    %r12d,%esi
+  8020d4:	4c 89 ef             	mov    %r13,%rdi
+  8020d7:	ff d0                	call   *%rax
+}
+  8020d9:	48 83 c4 18          	add    $0x18,%rsp
+  8020dd:	5b                   	pop    %rbx
+  8020de:	41 5c                	pop    %r12
+  8020e0:	41 5d                	pop    %r13
+  8020e2:	5d                   	pop    %rbp
+  8020e3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020e4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8020eb:	00 00 00 
+  8020ee:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020f4:	89 da                	mov    %ebx,%edx
+  8020f6:	48 bf e0 41 80 00 00 	movabs $0x8041e0,%rdi
+  8020fd:	00 00 00 
+  802100:	b8 00 00 00 00       	mov    $0x0,%eax
+  802105:	48 b9 96 05 80 00 00 	movabs $0x800596,%rcx
+  80210c:	00 00 00 
+  80210f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802111:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802116:	eb c1                	jmp    8020d9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802118:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80211d:	eb ba                	jmp    8020d9 <ftruncate+0x5e>
+
+000000000080211f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	41 54                	push   %r12
+  802125:	53                   	push   %rbx
+  802126:	48 83 ec 10          	sub    $0x10,%rsp
+  80212a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80212d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802131:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 4e                	js     80218f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802141:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802145:	41 8b 3c 24          	mov    (%r12),%edi
+  802149:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80214d:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  802154:	00 00 00 
+  802157:	ff d0                	call   *%rax
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	78 32                	js     80218f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80215d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802161:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802166:	74 30                	je     802198 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802168:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80216b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802172:	00 00 00 
+    stat->st_isdir = 0;
+  802175:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80217c:	00 00 00 
+    stat->st_dev = dev;
+  80217f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802186:	48 89 de             	mov    %rbx,%rsi
+  802189:	4c 89 e7             	mov    %r12,%rdi
+  80218c:	ff 50 30             	call   *0x30(%rax)
+}
+  80218f:	48 83 c4 10          	add    $0x10,%rsp
+  802193:	5b                   	pop    %rbx
+  802194:	41 5c                	pop    %r12
+  802196:	5d                   	pop    %rbp
+  802197:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802198:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80219d:	eb f0                	jmp    80218f <fstat+0x70>
+
+000000000080219f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	41 54                	push   %r12
+  8021a5:	53                   	push   %rbx
+  8021a6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ae:	48 b8 f6 2e 80 00 00 	movabs $0x802ef6,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+  8021ba:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 25                	js     8021e5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021c0:	4c 89 e6             	mov    %r12,%rsi
+  8021c3:	89 c7                	mov    %eax,%edi
+  8021c5:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+  8021d1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021d4:	89 df                	mov    %ebx,%edi
+  8021d6:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+
+    return res;
+  8021e2:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021e5:	89 d8                	mov    %ebx,%eax
+  8021e7:	5b                   	pop    %rbx
+  8021e8:	41 5c                	pop    %r12
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+
+00000000008021ec <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8021ec:	55                   	push   %rbp
+  8021ed:	48 89 e5             	mov    %rsp,%rbp
+  8021f0:	41 54                	push   %r12
+  8021f2:	53                   	push   %rbx
+  8021f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f7:	48 89 fb             	mov    %rdi,%rbx
+  8021fa:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802201:	bf 66 00 00 00       	mov    $0x66,%edi
+  802206:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  80220d:	00 00 00 
+  802210:	ff d0                	call   *%rax
+  802212:	85 c0                	test   %eax,%eax
+  802214:	78 1f                	js     802235 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80221a:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80221e:	48 85 c0             	test   %rax,%rax
+  802221:	74 1b                	je     80223e <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802223:	4c 89 e6             	mov    %r12,%rsi
+  802226:	48 89 df             	mov    %rbx,%rdi
+  802229:	ff d0                	call   *%rax
+    if (res < 0) {
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802232:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802235:	48 83 c4 10          	add    $0x10,%rsp
+  802239:	5b                   	pop    %rbx
+  80223a:	41 5c                	pop    %r12
+  80223c:	5d                   	pop    %rbp
+  80223d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80223e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802243:	eb f0                	jmp    802235 <create_snapshot+0x49>
+
+0000000000802245 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802245:	55                   	push   %rbp
+  802246:	48 89 e5             	mov    %rsp,%rbp
+  802249:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80224d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802251:	bf 66 00 00 00       	mov    $0x66,%edi
+  802256:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 1e                	js     802284 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802266:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80226a:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80226e:	48 85 d2             	test   %rdx,%rdx
+  802271:	74 13                	je     802286 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802273:	b8 00 00 00 00       	mov    $0x0,%eax
+  802278:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802281:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+        return -E_NOT_SUPP;
+  802286:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80228b:	eb f7                	jmp    802284 <print_snapshot_list+0x3f>
+
+000000000080228d <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80228d:	55                   	push   %rbp
+  80228e:	48 89 e5             	mov    %rsp,%rbp
+  802291:	53                   	push   %rbx
+  802292:	48 83 ec 18          	sub    $0x18,%rsp
+  802296:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802299:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80229d:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022a2:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8022a9:	00 00 00 
+  8022ac:	ff d0                	call   *%rax
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 1c                	js     8022ce <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8022b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b6:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8022ba:	48 85 c0             	test   %rax,%rax
+  8022bd:	74 15                	je     8022d4 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8022bf:	48 89 df             	mov    %rbx,%rdi
+  8022c2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022cb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022d4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022d9:	eb f3                	jmp    8022ce <accept_snapshot+0x41>
+
+00000000008022db <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8022db:	55                   	push   %rbp
+  8022dc:	48 89 e5             	mov    %rsp,%rbp
+  8022df:	53                   	push   %rbx
+  8022e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e4:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022e7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022eb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022f0:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 1c                	js     80231c <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802300:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802304:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802308:	48 85 c0             	test   %rax,%rax
+  80230b:	74 15                	je     802322 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80230d:	48 89 df             	mov    %rbx,%rdi
+  802310:	ff d0                	call   *%rax
+    if (res < 0) {
+  802312:	85 c0                	test   %eax,%eax
+  802314:	ba 00 00 00 00       	mov    $0x0,%edx
+  802319:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80231c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+        return -E_NOT_SUPP;
+  802322:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802327:	eb f3                	jmp    80231c <delete_snapshot+0x41>
+
+0000000000802329 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802329:	55                   	push   %rbp
+  80232a:	48 89 e5             	mov    %rsp,%rbp
+  80232d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802331:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802335:	bf 66 00 00 00       	mov    $0x66,%edi
+  80233a:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 14                	js     80235e <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80234a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80234e:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802352:	48 85 d2             	test   %rdx,%rdx
+  802355:	74 09                	je     802360 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235c:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80235e:	c9                   	leave
+  80235f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802360:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802365:	eb f7                	jmp    80235e <gc_snapshots+0x35>
+
+0000000000802367 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802367:	55                   	push   %rbp
+  802368:	48 89 e5             	mov    %rsp,%rbp
+  80236b:	41 56                	push   %r14
+  80236d:	41 55                	push   %r13
+  80236f:	41 54                	push   %r12
+  802371:	53                   	push   %rbx
+  802372:	48 83 ec 10          	sub    $0x10,%rsp
+  802376:	48 89 fb             	mov    %rdi,%rbx
+  802379:	49 89 f4             	mov    %rsi,%r12
+  80237c:	49 89 d5             	mov    %rdx,%r13
+  80237f:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802382:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802386:	bf 66 00 00 00       	mov    $0x66,%edi
+  80238b:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+  802397:	85 c0                	test   %eax,%eax
+  802399:	78 1b                	js     8023b6 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80239b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80239f:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8023a3:	48 85 c0             	test   %rax,%rax
+  8023a6:	74 1b                	je     8023c3 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8023a8:	4c 89 f1             	mov    %r14,%rcx
+  8023ab:	4c 89 ea             	mov    %r13,%rdx
+  8023ae:	4c 89 e6             	mov    %r12,%rsi
+  8023b1:	48 89 df             	mov    %rbx,%rdi
+  8023b4:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023b6:	48 83 c4 10          	add    $0x10,%rsp
+  8023ba:	5b                   	pop    %rbx
+  8023bb:	41 5c                	pop    %r12
+  8023bd:	41 5d                	pop    %r13
+  8023bf:	41 5e                	pop    %r14
+  8023c1:	5d                   	pop    %rbp
+  8023c2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023c3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023c8:	eb ec                	jmp    8023b6 <diff_snapshots+0x4f>
+
+00000000008023ca <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  8023ce:	41 55                	push   %r13
+  8023d0:	41 54                	push   %r12
+  8023d2:	53                   	push   %rbx
+  8023d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d7:	48 89 fb             	mov    %rdi,%rbx
+  8023da:	49 89 f4             	mov    %rsi,%r12
+  8023dd:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023e0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023e4:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023e9:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8023f0:	00 00 00 
+  8023f3:	ff d0                	call   *%rax
+  8023f5:	85 c0                	test   %eax,%eax
+  8023f7:	78 18                	js     802411 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8023f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023fd:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802401:	48 85 c0             	test   %rax,%rax
+  802404:	74 16                	je     80241c <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802406:	4c 89 ea             	mov    %r13,%rdx
+  802409:	4c 89 e6             	mov    %r12,%rsi
+  80240c:	48 89 df             	mov    %rbx,%rdi
+  80240f:	ff d0                	call   *%rax
+
+    return res;
+}
+  802411:	48 83 c4 18          	add    $0x18,%rsp
+  802415:	5b                   	pop    %rbx
+  802416:	41 5c                	pop    %r12
+  802418:	41 5d                	pop    %r13
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80241c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802421:	eb ee                	jmp    802411 <send_snapshot+0x47>
+
+0000000000802423 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	53                   	push   %rbx
+  802428:	48 83 ec 18          	sub    $0x18,%rsp
+  80242c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80242f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802433:	bf 66 00 00 00       	mov    $0x66,%edi
+  802438:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 12                	js     80245a <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244c:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802450:	48 85 c0             	test   %rax,%rax
+  802453:	74 0b                	je     802460 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802455:	48 89 df             	mov    %rbx,%rdi
+  802458:	ff d0                	call   *%rax
+
+    return res;
+}
+  80245a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802460:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802465:	eb f3                	jmp    80245a <receive_snapshot+0x37>
+
+0000000000802467 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80246f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802473:	bf 66 00 00 00       	mov    $0x66,%edi
+  802478:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+  802484:	85 c0                	test   %eax,%eax
+  802486:	78 17                	js     80249f <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248c:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802493:	48 85 d2             	test   %rdx,%rdx
+  802496:	74 09                	je     8024a1 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80249f:	c9                   	leave
+  8024a0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024a1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024a6:	eb f7                	jmp    80249f <free_space_bytes+0x38>
+
+00000000008024a8 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8024a8:	55                   	push   %rbp
+  8024a9:	48 89 e5             	mov    %rsp,%rbp
+  8024ac:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024b0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024b4:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024b9:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 17                	js     8024e0 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8024c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024cd:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8024d4:	48 85 d2             	test   %rdx,%rdx
+  8024d7:	74 09                	je     8024e2 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024de:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024e2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024e7:	eb f7                	jmp    8024e0 <busy_space_bytes+0x38>
+
+00000000008024e9 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8024e9:	55                   	push   %rbp
+  8024ea:	48 89 e5             	mov    %rsp,%rbp
+  8024ed:	41 54                	push   %r12
+  8024ef:	53                   	push   %rbx
+  8024f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f4:	89 fb                	mov    %edi,%ebx
+  8024f6:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024fd:	bf 66 00 00 00       	mov    $0x66,%edi
+  802502:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+  80250e:	85 c0                	test   %eax,%eax
+  802510:	78 17                	js     802529 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802512:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802516:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80251d:	48 85 c0             	test   %rax,%rax
+  802520:	74 10                	je     802532 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802522:	4c 89 e6             	mov    %r12,%rsi
+  802525:	89 df                	mov    %ebx,%edi
+  802527:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802529:	48 83 c4 10          	add    $0x10,%rsp
+  80252d:	5b                   	pop    %rbx
+  80252e:	41 5c                	pop    %r12
+  802530:	5d                   	pop    %rbp
+  802531:	c3                   	ret
+        return -E_NOT_SUPP;
+  802532:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802537:	eb f0                	jmp    802529 <snapshots_space+0x40>
+
+0000000000802539 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	41 55                	push   %r13
+  80253f:	41 54                	push   %r12
+  802541:	53                   	push   %rbx
+  802542:	48 83 ec 08          	sub    $0x8,%rsp
+  802546:	41 89 fd             	mov    %edi,%r13d
+  802549:	48 89 f3             	mov    %rsi,%rbx
+  80254c:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80254f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802556:	00 00 00 
+  802559:	83 38 00             	cmpl   $0x0,(%rax)
+  80255c:	74 57                	je     8025b5 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80255e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802564:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802569:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802570:	00 00 00 
+  802573:	44 89 ee             	mov    %r13d,%esi
+  802576:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80257d:	00 00 00 
+  802580:	8b 38                	mov    (%rax),%edi
+  802582:	48 b8 b6 39 80 00 00 	movabs $0x8039b6,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80258e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802593:	4c 89 e2             	mov    %r12,%rdx
+  802596:	48 89 de             	mov    %rbx,%rsi
+  802599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259e:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  8025a5:	00 00 00 
+  8025a8:	ff d0                	call   *%rax
+}
+  8025aa:	48 83 c4 08          	add    $0x8,%rsp
+  8025ae:	5b                   	pop    %rbx
+  8025af:	41 5c                	pop    %r12
+  8025b1:	41 5d                	pop    %r13
+  8025b3:	5d                   	pop    %rbp
+  8025b4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025b5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025ba:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  8025c1:	00 00 00 
+  8025c4:	ff d0                	call   *%rax
+  8025c6:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8025cd:	00 00 
+  8025cf:	eb 8d                	jmp    80255e <fsipc_region+0x25>
+
+00000000008025d1 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+  8025d5:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8025d9:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8025e0:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8025e1:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8025e5:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+}
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+
+00000000008025f3 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8025f3:	85 ff                	test   %edi,%edi
+  8025f5:	78 6d                	js     802664 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	41 54                	push   %r12
+  8025fd:	53                   	push   %rbx
+  8025fe:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802601:	48 85 f6             	test   %rsi,%rsi
+  802604:	74 57                	je     80265d <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802606:	89 f8                	mov    %edi,%eax
+  802608:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80260f:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802611:	be 00 00 00 00       	mov    $0x0,%esi
+  802616:	bf 12 00 00 00       	mov    $0x12,%edi
+  80261b:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802622:	00 00 00 
+  802625:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802627:	85 c0                	test   %eax,%eax
+  802629:	78 2d                	js     802658 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80262b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802632:	00 00 00 
+  802635:	49 63 14 24          	movslq (%r12),%rdx
+  802639:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802640:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802645:	48 89 df             	mov    %rbx,%rdi
+  802648:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802654:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802658:	5b                   	pop    %rbx
+  802659:	41 5c                	pop    %r12
+  80265b:	5d                   	pop    %rbp
+  80265c:	c3                   	ret
+        return -E_INVAL;
+  80265d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802662:	eb f4                	jmp    802658 <devfile_df_snapshots+0x65>
+  802664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802669:	c3                   	ret
+
+000000000080266a <devfile_df_busy>:
+devfile_df_busy() {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80266e:	be 00 00 00 00       	mov    $0x0,%esi
+  802673:	bf 11 00 00 00       	mov    $0x11,%edi
+  802678:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+}
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+
+0000000000802686 <devfile_df_free>:
+devfile_df_free() {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80268a:	be 00 00 00 00       	mov    $0x0,%esi
+  80268f:	bf 10 00 00 00       	mov    $0x10,%edi
+  802694:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+}
+  8026a0:	5d                   	pop    %rbp
+  8026a1:	c3                   	ret
+
+00000000008026a2 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8026a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ab:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8026b0:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+}
+  8026bc:	5d                   	pop    %rbp
+  8026bd:	c3                   	ret
+
+00000000008026be <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8026be:	55                   	push   %rbp
+  8026bf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8026c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8026cc:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  8026d3:	00 00 00 
+  8026d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026df:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026e2:	5d                   	pop    %rbp
+  8026e3:	c3                   	ret
+
+00000000008026e4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8026e4:	55                   	push   %rbp
+  8026e5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8026e8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8026ef:	00 00 00 
+  8026f2:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8026f5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8026f7:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8026fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ff:	bf 02 00 00 00       	mov    $0x2,%edi
+  802704:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+}
+  802710:	5d                   	pop    %rbp
+  802711:	c3                   	ret
+
+0000000000802712 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802712:	55                   	push   %rbp
+  802713:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802716:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802719:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802720:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802722:	be 00 00 00 00       	mov    $0x0,%esi
+  802727:	bf 06 00 00 00       	mov    $0x6,%edi
+  80272c:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+}
+  802738:	5d                   	pop    %rbp
+  802739:	c3                   	ret
+
+000000000080273a <devfile_write>:
+    if (!fd || !buf) {
+  80273a:	48 85 ff             	test   %rdi,%rdi
+  80273d:	0f 84 c1 00 00 00    	je     802804 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	41 57                	push   %r15
+  802749:	41 56                	push   %r14
+  80274b:	41 55                	push   %r13
+  80274d:	41 54                	push   %r12
+  80274f:	53                   	push   %rbx
+  802750:	48 83 ec 18          	sub    $0x18,%rsp
+  802754:	49 89 ff             	mov    %rdi,%r15
+  802757:	49 89 f5             	mov    %rsi,%r13
+  80275a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80275d:	48 85 f6             	test   %rsi,%rsi
+  802760:	0f 84 95 00 00 00    	je     8027fb <devfile_write+0xc1>
+    while (n) {
+  802766:	48 85 d2             	test   %rdx,%rdx
+  802769:	0f 84 83 00 00 00    	je     8027f2 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80276f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802776:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80277d:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802780:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802785:	49 39 dc             	cmp    %rbx,%r12
+  802788:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80278c:	48 89 da             	mov    %rbx,%rdx
+  80278f:	4c 89 ee             	mov    %r13,%rsi
+  802792:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802799:	00 00 00 
+  80279c:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  8027a3:	00 00 00 
+  8027a6:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027a8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027ac:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8027af:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8027b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027bd:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+        if (write < 0) {
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	78 21                	js     8027ee <devfile_write+0xb4>
+        buf += write;
+  8027cd:	48 63 d0             	movslq %eax,%rdx
+  8027d0:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8027d3:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8027d6:	49 29 d4             	sub    %rdx,%r12
+  8027d9:	75 a5                	jne    802780 <devfile_write+0x46>
+    return totalWrite;
+  8027db:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8027df:	48 83 c4 18          	add    $0x18,%rsp
+  8027e3:	5b                   	pop    %rbx
+  8027e4:	41 5c                	pop    %r12
+  8027e6:	41 5d                	pop    %r13
+  8027e8:	41 5e                	pop    %r14
+  8027ea:	41 5f                	pop    %r15
+  8027ec:	5d                   	pop    %rbp
+  8027ed:	c3                   	ret
+            return write;
+  8027ee:	48 98                	cltq
+  8027f0:	eb ed                	jmp    8027df <devfile_write+0xa5>
+    int totalWrite = 0;
+  8027f2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8027f9:	eb e0                	jmp    8027db <devfile_write+0xa1>
+        return -E_INVAL;
+  8027fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802802:	eb db                	jmp    8027df <devfile_write+0xa5>
+  802804:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80280b:	c3                   	ret
+
+000000000080280c <devfile_read>:
+    if (!fd || !buf) {
+  80280c:	48 85 ff             	test   %rdi,%rdi
+  80280f:	0f 84 c0 00 00 00    	je     8028d5 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	41 57                	push   %r15
+  80281b:	41 56                	push   %r14
+  80281d:	41 55                	push   %r13
+  80281f:	41 54                	push   %r12
+  802821:	53                   	push   %rbx
+  802822:	48 83 ec 18          	sub    $0x18,%rsp
+  802826:	49 89 ff             	mov    %rdi,%r15
+  802829:	49 89 f5             	mov    %rsi,%r13
+  80282c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80282f:	48 85 f6             	test   %rsi,%rsi
+  802832:	0f 84 96 00 00 00    	je     8028ce <devfile_read+0xc2>
+    while (n) {
+  802838:	48 85 d2             	test   %rdx,%rdx
+  80283b:	0f 84 87 00 00 00    	je     8028c8 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802841:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802848:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802849:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802850:	00 00 00 
+  802853:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802857:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80285a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80285f:	49 39 c4             	cmp    %rax,%r12
+  802862:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802866:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80286a:	be 00 00 00 00       	mov    $0x0,%esi
+  80286f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802874:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802880:	85 c0                	test   %eax,%eax
+  802882:	7e 37                	jle    8028bb <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802884:	48 63 d8             	movslq %eax,%rbx
+  802887:	48 89 da             	mov    %rbx,%rdx
+  80288a:	4c 89 f6             	mov    %r14,%rsi
+  80288d:	4c 89 ef             	mov    %r13,%rdi
+  802890:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+        buf += read;
+  80289c:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80289f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8028a3:	49 29 dc             	sub    %rbx,%r12
+  8028a6:	75 ab                	jne    802853 <devfile_read+0x47>
+  return totalRead;
+  8028a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8028ac:	48 83 c4 18          	add    $0x18,%rsp
+  8028b0:	5b                   	pop    %rbx
+  8028b1:	41 5c                	pop    %r12
+  8028b3:	41 5d                	pop    %r13
+  8028b5:	41 5e                	pop    %r14
+  8028b7:	41 5f                	pop    %r15
+  8028b9:	5d                   	pop    %rbp
+  8028ba:	c3                   	ret
+            return read ? read : totalRead;
+  8028bb:	48 63 d0             	movslq %eax,%rdx
+  8028be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8028c6:	eb e4                	jmp    8028ac <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8028c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028cc:	eb da                	jmp    8028a8 <devfile_read+0x9c>
+        return E_INVAL;
+  8028ce:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028d3:	eb d7                	jmp    8028ac <devfile_read+0xa0>
+  8028d5:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8028da:	c3                   	ret
+
+00000000008028db <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8028db:	48 85 ff             	test   %rdi,%rdi
+  8028de:	74 5f                	je     80293f <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8028e0:	55                   	push   %rbp
+  8028e1:	48 89 e5             	mov    %rsp,%rbp
+  8028e4:	53                   	push   %rbx
+  8028e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e9:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8028ec:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+  8028f8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028fe:	77 45                	ja     802945 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802900:	48 89 de             	mov    %rbx,%rsi
+  802903:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80290a:	00 00 00 
+  80290d:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802919:	be 00 00 00 00       	mov    $0x0,%esi
+  80291e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802923:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	ba 00 00 00 00       	mov    $0x0,%edx
+  802936:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802939:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+        return -E_INVAL;
+  80293f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802944:	c3                   	ret
+        return -E_INVAL;
+  802945:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80294a:	eb ed                	jmp    802939 <devfile_receive_snapshot+0x5e>
+
+000000000080294c <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80294c:	55                   	push   %rbp
+  80294d:	48 89 e5             	mov    %rsp,%rbp
+  802950:	41 55                	push   %r13
+  802952:	41 54                	push   %r12
+  802954:	53                   	push   %rbx
+  802955:	48 83 ec 08          	sub    $0x8,%rsp
+  802959:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80295c:	48 85 f6             	test   %rsi,%rsi
+  80295f:	0f 94 c0             	sete   %al
+  802962:	48 85 d2             	test   %rdx,%rdx
+  802965:	0f 94 c2             	sete   %dl
+  802968:	08 d0                	or     %dl,%al
+  80296a:	0f 85 ad 00 00 00    	jne    802a1d <devfile_send_snapshot+0xd1>
+  802970:	48 89 fb             	mov    %rdi,%rbx
+  802973:	49 89 f4             	mov    %rsi,%r12
+  802976:	48 85 ff             	test   %rdi,%rdi
+  802979:	0f 84 9e 00 00 00    	je     802a1d <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80297f:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802986:	00 00 00 
+  802989:	ff d0                	call   *%rax
+  80298b:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802991:	0f 87 8d 00 00 00    	ja     802a24 <devfile_send_snapshot+0xd8>
+  802997:	4c 89 e7             	mov    %r12,%rdi
+  80299a:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  8029a1:	00 00 00 
+  8029a4:	ff d0                	call   *%rax
+  8029a6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029ac:	77 7d                	ja     802a2b <devfile_send_snapshot+0xdf>
+  8029ae:	4c 89 ef             	mov    %r13,%rdi
+  8029b1:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029c3:	77 6d                	ja     802a32 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8029c5:	48 89 de             	mov    %rbx,%rsi
+  8029c8:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029cf:	00 00 00 
+  8029d2:	48 bb bb 0e 80 00 00 	movabs $0x800ebb,%rbx
+  8029d9:	00 00 00 
+  8029dc:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8029de:	4c 89 e6             	mov    %r12,%rsi
+  8029e1:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8029e8:	00 00 00 
+  8029eb:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8029ed:	4c 89 ee             	mov    %r13,%rsi
+  8029f0:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8029f7:	00 00 00 
+  8029fa:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8029fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802a01:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802a06:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+}
+  802a12:	48 83 c4 08          	add    $0x8,%rsp
+  802a16:	5b                   	pop    %rbx
+  802a17:	41 5c                	pop    %r12
+  802a19:	41 5d                	pop    %r13
+  802a1b:	5d                   	pop    %rbp
+  802a1c:	c3                   	ret
+        return -E_INVAL;
+  802a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a22:	eb ee                	jmp    802a12 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802a24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a29:	eb e7                	jmp    802a12 <devfile_send_snapshot+0xc6>
+  802a2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a30:	eb e0                	jmp    802a12 <devfile_send_snapshot+0xc6>
+  802a32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a37:	eb d9                	jmp    802a12 <devfile_send_snapshot+0xc6>
+
+0000000000802a39 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802a39:	48 85 ff             	test   %rdi,%rdi
+  802a3c:	0f 84 41 01 00 00    	je     802b83 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	41 57                	push   %r15
+  802a48:	41 56                	push   %r14
+  802a4a:	41 55                	push   %r13
+  802a4c:	41 54                	push   %r12
+  802a4e:	53                   	push   %rbx
+  802a4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a53:	49 89 fc             	mov    %rdi,%r12
+  802a56:	49 89 f5             	mov    %rsi,%r13
+  802a59:	48 89 d3             	mov    %rdx,%rbx
+  802a5c:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802a5f:	48 85 f6             	test   %rsi,%rsi
+  802a62:	0f 84 ff 00 00 00    	je     802b67 <devfile_diff_snapshots+0x12e>
+  802a68:	48 85 d2             	test   %rdx,%rdx
+  802a6b:	0f 84 fd 00 00 00    	je     802b6e <devfile_diff_snapshots+0x135>
+  802a71:	48 85 c9             	test   %rcx,%rcx
+  802a74:	0f 84 f4 00 00 00    	je     802b6e <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802a7a:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802a81:	00 00 00 
+  802a84:	ff d0                	call   *%rax
+  802a86:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a8c:	0f 87 e3 00 00 00    	ja     802b75 <devfile_diff_snapshots+0x13c>
+  802a92:	4c 89 ef             	mov    %r13,%rdi
+  802a95:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802a9c:	00 00 00 
+  802a9f:	ff d0                	call   *%rax
+  802aa1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802aa7:	0f 87 cf 00 00 00    	ja     802b7c <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802aad:	4c 89 e6             	mov    %r12,%rsi
+  802ab0:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802ab7:	00 00 00 
+  802aba:	4c 89 e7             	mov    %r12,%rdi
+  802abd:	49 bf bb 0e 80 00 00 	movabs $0x800ebb,%r15
+  802ac4:	00 00 00 
+  802ac7:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802aca:	4c 89 ee             	mov    %r13,%rsi
+  802acd:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802ad4:	00 
+  802ad5:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802ad8:	48 8b 03             	mov    (%rbx),%rax
+  802adb:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802ae2:	00 
+  802ae3:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802ae7:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802aee:	00 
+  802aef:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802af3:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802afa:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802afb:	be 00 00 00 00       	mov    $0x0,%esi
+  802b00:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802b05:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802b0c:	00 00 00 
+  802b0f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	78 43                	js     802b58 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802b15:	49 8b 04 24          	mov    (%r12),%rax
+  802b19:	48 89 03             	mov    %rax,(%rbx)
+  802b1c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802b21:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802b25:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802b2a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802b2e:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802b33:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802b37:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802b3b:	48 c1 e2 03          	shl    $0x3,%rdx
+  802b3f:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802b44:	4c 89 f7             	mov    %r14,%rdi
+  802b47:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802b53:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802b58:	48 83 c4 08          	add    $0x8,%rsp
+  802b5c:	5b                   	pop    %rbx
+  802b5d:	41 5c                	pop    %r12
+  802b5f:	41 5d                	pop    %r13
+  802b61:	41 5e                	pop    %r14
+  802b63:	41 5f                	pop    %r15
+  802b65:	5d                   	pop    %rbp
+  802b66:	c3                   	ret
+        return -E_INVAL;
+  802b67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6c:	eb ea                	jmp    802b58 <devfile_diff_snapshots+0x11f>
+  802b6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b73:	eb e3                	jmp    802b58 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b7a:	eb dc                	jmp    802b58 <devfile_diff_snapshots+0x11f>
+  802b7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b81:	eb d5                	jmp    802b58 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b88:	c3                   	ret
+
+0000000000802b89 <devfile_delete_snapshot>:
+    if (!name) {
+  802b89:	48 85 ff             	test   %rdi,%rdi
+  802b8c:	74 5f                	je     802bed <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	53                   	push   %rbx
+  802b93:	48 83 ec 08          	sub    $0x8,%rsp
+  802b97:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b9a:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bac:	77 45                	ja     802bf3 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802bae:	48 89 de             	mov    %rbx,%rsi
+  802bb1:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802bb8:	00 00 00 
+  802bbb:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bcc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802bd1:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+        return -E_INVAL;
+  802bed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bf2:	c3                   	ret
+        return -E_INVAL;
+  802bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf8:	eb ed                	jmp    802be7 <devfile_delete_snapshot+0x5e>
+
+0000000000802bfa <devfile_accept_snapshot>:
+    if (!name) {
+  802bfa:	48 85 ff             	test   %rdi,%rdi
+  802bfd:	74 5f                	je     802c5e <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802bff:	55                   	push   %rbp
+  802c00:	48 89 e5             	mov    %rsp,%rbp
+  802c03:	53                   	push   %rbx
+  802c04:	48 83 ec 08          	sub    $0x8,%rsp
+  802c08:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802c0b:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802c12:	00 00 00 
+  802c15:	ff d0                	call   *%rax
+  802c17:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c1d:	77 45                	ja     802c64 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802c1f:	48 89 de             	mov    %rbx,%rsi
+  802c22:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c29:	00 00 00 
+  802c2c:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802c38:	be 00 00 00 00       	mov    $0x0,%esi
+  802c3d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c42:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c55:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5c:	c9                   	leave
+  802c5d:	c3                   	ret
+        return -E_INVAL;
+  802c5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c63:	c3                   	ret
+        return -E_INVAL;
+  802c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c69:	eb ed                	jmp    802c58 <devfile_accept_snapshot+0x5e>
+
+0000000000802c6b <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802c6b:	48 85 ff             	test   %rdi,%rdi
+  802c6e:	0f 84 9f 00 00 00    	je     802d13 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802c74:	55                   	push   %rbp
+  802c75:	48 89 e5             	mov    %rsp,%rbp
+  802c78:	41 54                	push   %r12
+  802c7a:	53                   	push   %rbx
+  802c7b:	48 89 fb             	mov    %rdi,%rbx
+  802c7e:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802c81:	48 85 f6             	test   %rsi,%rsi
+  802c84:	74 78                	je     802cfe <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802c86:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+  802c92:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c98:	77 6b                	ja     802d05 <devfile_create_snapshot+0x9a>
+  802c9a:	4c 89 e7             	mov    %r12,%rdi
+  802c9d:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802ca4:	00 00 00 
+  802ca7:	ff d0                	call   *%rax
+  802ca9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802caf:	77 5b                	ja     802d0c <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802cb1:	48 89 de             	mov    %rbx,%rsi
+  802cb4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802cbb:	00 00 00 
+  802cbe:	48 bb bb 0e 80 00 00 	movabs $0x800ebb,%rbx
+  802cc5:	00 00 00 
+  802cc8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802cca:	4c 89 e6             	mov    %r12,%rsi
+  802ccd:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802cd4:	00 00 00 
+  802cd7:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802cd9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cde:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ce3:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cef:	85 c0                	test   %eax,%eax
+  802cf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	41 5c                	pop    %r12
+  802cfc:	5d                   	pop    %rbp
+  802cfd:	c3                   	ret
+        return -E_INVAL;
+  802cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d03:	eb f4                	jmp    802cf9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d0a:	eb ed                	jmp    802cf9 <devfile_create_snapshot+0x8e>
+  802d0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d11:	eb e6                	jmp    802cf9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d18:	c3                   	ret
+
+0000000000802d19 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d19:	55                   	push   %rbp
+  802d1a:	48 89 e5             	mov    %rsp,%rbp
+  802d1d:	41 54                	push   %r12
+  802d1f:	53                   	push   %rbx
+  802d20:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d23:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d26:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d2d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d34:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d39:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802d40:	00 00 00 
+  802d43:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	78 3d                	js     802d86 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d49:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802d50:	00 00 00 
+  802d53:	4c 89 e6             	mov    %r12,%rsi
+  802d56:	48 89 df             	mov    %rbx,%rdi
+  802d59:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802d60:	00 00 00 
+  802d63:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d65:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802d6c:	00 
+  802d6d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d73:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802d7a:	00 
+  802d7b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802d81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d86:	5b                   	pop    %rbx
+  802d87:	41 5c                	pop    %r12
+  802d89:	5d                   	pop    %rbp
+  802d8a:	c3                   	ret
+
+0000000000802d8b <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	41 57                	push   %r15
+  802d91:	41 56                	push   %r14
+  802d93:	41 55                	push   %r13
+  802d95:	41 54                	push   %r12
+  802d97:	53                   	push   %rbx
+  802d98:	48 83 ec 38          	sub    $0x38,%rsp
+  802d9c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802da0:	49 89 f5             	mov    %rsi,%r13
+  802da3:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802da6:	48 89 f0             	mov    %rsi,%rax
+  802da9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802dae:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802db2:	75 4f                	jne    802e03 <devfile_readmap+0x78>
+  802db4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802db8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802dbe:	75 1f                	jne    802ddf <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802dc0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802dc4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802dc8:	49 be 73 35 80 00 00 	movabs $0x803573,%r14
+  802dcf:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dd2:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802dd9:	0f 87 9d 00 00 00    	ja     802e7c <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ddf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802de3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802de7:	4d 85 ff             	test   %r15,%r15
+  802dea:	0f 85 cf 00 00 00    	jne    802ebf <devfile_readmap+0x134>
+  802df0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802df4:	48 83 c4 38          	add    $0x38,%rsp
+  802df8:	5b                   	pop    %rbx
+  802df9:	41 5c                	pop    %r12
+  802dfb:	41 5d                	pop    %r13
+  802dfd:	41 5e                	pop    %r14
+  802dff:	41 5f                	pop    %r15
+  802e01:	5d                   	pop    %rbp
+  802e02:	c3                   	ret
+    size_t totalRead = 0;
+  802e03:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802e0a:	00 
+  802e0b:	eb da                	jmp    802de7 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e0d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e11:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e14:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802e1b:	00 00 00 
+  802e1e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802e20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e24:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802e28:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e2c:	4c 89 ee             	mov    %r13,%rsi
+  802e2f:	bf 14 00 00 00       	mov    $0x14,%edi
+  802e34:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802e40:	85 c0                	test   %eax,%eax
+  802e42:	7e a3                	jle    802de7 <devfile_readmap+0x5c>
+  802e44:	48 98                	cltq
+  802e46:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802e4a:	72 9b                	jb     802de7 <devfile_readmap+0x5c>
+        buf += read;
+  802e4c:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802e4f:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802e52:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e56:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802e5d:	75 88                	jne    802de7 <devfile_readmap+0x5c>
+  802e5f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e63:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e69:	0f 85 78 ff ff ff    	jne    802de7 <devfile_readmap+0x5c>
+  802e6f:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802e76:	0f 86 6b ff ff ff    	jbe    802de7 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802e7c:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802e82:	4d 39 e7             	cmp    %r12,%r15
+  802e85:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802e89:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802e90:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e94:	0f 84 73 ff ff ff    	je     802e0d <devfile_readmap+0x82>
+  802e9a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e9e:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802ea3:	41 ff d6             	call   *%r14
+  802ea6:	a8 40                	test   $0x40,%al
+  802ea8:	0f 85 39 ff ff ff    	jne    802de7 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802eae:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802eb5:	4c 39 e3             	cmp    %r12,%rbx
+  802eb8:	72 e4                	jb     802e9e <devfile_readmap+0x113>
+  802eba:	e9 4e ff ff ff       	jmp    802e0d <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ebf:	4c 89 fa             	mov    %r15,%rdx
+  802ec2:	4c 89 ee             	mov    %r13,%rsi
+  802ec5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ec9:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  802ed0:	00 00 00 
+  802ed3:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802ed5:	48 85 c0             	test   %rax,%rax
+  802ed8:	78 0c                	js     802ee6 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802eda:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ede:	48 01 f0             	add    %rsi,%rax
+  802ee1:	e9 0e ff ff ff       	jmp    802df4 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802ee6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802eea:	48 85 f6             	test   %rsi,%rsi
+  802eed:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ef1:	e9 fe fe ff ff       	jmp    802df4 <devfile_readmap+0x69>
+
+0000000000802ef6 <open>:
+open(const char *path, int mode) {
+  802ef6:	55                   	push   %rbp
+  802ef7:	48 89 e5             	mov    %rsp,%rbp
+  802efa:	41 55                	push   %r13
+  802efc:	41 54                	push   %r12
+  802efe:	53                   	push   %rbx
+  802eff:	48 83 ec 18          	sub    $0x18,%rsp
+  802f03:	49 89 fc             	mov    %rdi,%r12
+  802f06:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f09:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+  802f15:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f1b:	0f 87 8a 00 00 00    	ja     802fab <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f21:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f25:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	89 c3                	mov    %eax,%ebx
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	78 50                	js     802f87 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f37:	4c 89 e6             	mov    %r12,%rsi
+  802f3a:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802f41:	00 00 00 
+  802f44:	48 89 df             	mov    %rbx,%rdi
+  802f47:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f53:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f5a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f5e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f63:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	89 c3                	mov    %eax,%ebx
+  802f71:	85 c0                	test   %eax,%eax
+  802f73:	78 1f                	js     802f94 <open+0x9e>
+    return fd2num(fd);
+  802f75:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f79:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+  802f85:	89 c3                	mov    %eax,%ebx
+}
+  802f87:	89 d8                	mov    %ebx,%eax
+  802f89:	48 83 c4 18          	add    $0x18,%rsp
+  802f8d:	5b                   	pop    %rbx
+  802f8e:	41 5c                	pop    %r12
+  802f90:	41 5d                	pop    %r13
+  802f92:	5d                   	pop    %rbp
+  802f93:	c3                   	ret
+        fd_close(fd, 0);
+  802f94:	be 00 00 00 00       	mov    $0x0,%esi
+  802f99:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f9d:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+        return res;
+  802fa9:	eb dc                	jmp    802f87 <open+0x91>
+        return -E_BAD_PATH;
+  802fab:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fb0:	eb d5                	jmp    802f87 <open+0x91>
+
+0000000000802fb2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802fb6:	be 00 00 00 00       	mov    $0x0,%esi
+  802fbb:	bf 13 00 00 00       	mov    $0x13,%edi
+  802fc0:	48 b8 d1 25 80 00 00 	movabs $0x8025d1,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+}
+  802fcc:	5d                   	pop    %rbp
+  802fcd:	c3                   	ret
+
+0000000000802fce <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802fce:	55                   	push   %rbp
+  802fcf:	48 89 e5             	mov    %rsp,%rbp
+  802fd2:	41 54                	push   %r12
+  802fd4:	53                   	push   %rbx
+  802fd5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fd8:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802fe7:	48 be 60 42 80 00 00 	movabs $0x804260,%rsi
+  802fee:	00 00 00 
+  802ff1:	48 89 df             	mov    %rbx,%rdi
+  802ff4:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803000:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803005:	41 2b 04 24          	sub    (%r12),%eax
+  803009:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80300f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803016:	00 00 00 
+    stat->st_dev = &devpipe;
+  803019:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803020:	00 00 00 
+  803023:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	5b                   	pop    %rbx
+  803030:	41 5c                	pop    %r12
+  803032:	5d                   	pop    %rbp
+  803033:	c3                   	ret
+
+0000000000803034 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803034:	55                   	push   %rbp
+  803035:	48 89 e5             	mov    %rsp,%rbp
+  803038:	41 54                	push   %r12
+  80303a:	53                   	push   %rbx
+  80303b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80303e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803043:	48 89 fe             	mov    %rdi,%rsi
+  803046:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304b:	49 bc 13 16 80 00 00 	movabs $0x801613,%r12
+  803052:	00 00 00 
+  803055:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803058:	48 89 df             	mov    %rbx,%rdi
+  80305b:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	48 89 c6             	mov    %rax,%rsi
+  80306a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80306f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803074:	41 ff d4             	call   *%r12
+}
+  803077:	5b                   	pop    %rbx
+  803078:	41 5c                	pop    %r12
+  80307a:	5d                   	pop    %rbp
+  80307b:	c3                   	ret
+
+000000000080307c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80307c:	55                   	push   %rbp
+  80307d:	48 89 e5             	mov    %rsp,%rbp
+  803080:	41 57                	push   %r15
+  803082:	41 56                	push   %r14
+  803084:	41 55                	push   %r13
+  803086:	41 54                	push   %r12
+  803088:	53                   	push   %rbx
+  803089:	48 83 ec 18          	sub    $0x18,%rsp
+  80308d:	49 89 fc             	mov    %rdi,%r12
+  803090:	49 89 f5             	mov    %rsi,%r13
+  803093:	49 89 d7             	mov    %rdx,%r15
+  803096:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80309a:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  8030a1:	00 00 00 
+  8030a4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8030a6:	4d 85 ff             	test   %r15,%r15
+  8030a9:	0f 84 af 00 00 00    	je     80315e <devpipe_write+0xe2>
+  8030af:	48 89 c3             	mov    %rax,%rbx
+  8030b2:	4c 89 f8             	mov    %r15,%rax
+  8030b5:	4d 89 ef             	mov    %r13,%r15
+  8030b8:	4c 01 e8             	add    %r13,%rax
+  8030bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030bf:	49 bd 1b 15 80 00 00 	movabs $0x80151b,%r13
+  8030c6:	00 00 00 
+            sys_yield();
+  8030c9:	49 be b8 14 80 00 00 	movabs $0x8014b8,%r14
+  8030d0:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8030d3:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030d6:	48 63 ce             	movslq %esi,%rcx
+  8030d9:	48 63 03             	movslq (%rbx),%rax
+  8030dc:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8030e2:	48 39 c1             	cmp    %rax,%rcx
+  8030e5:	72 2e                	jb     803115 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030e7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030ec:	48 89 da             	mov    %rbx,%rdx
+  8030ef:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030f4:	4c 89 e7             	mov    %r12,%rdi
+  8030f7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	74 66                	je     803164 <devpipe_write+0xe8>
+            sys_yield();
+  8030fe:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803101:	8b 73 04             	mov    0x4(%rbx),%esi
+  803104:	48 63 ce             	movslq %esi,%rcx
+  803107:	48 63 03             	movslq (%rbx),%rax
+  80310a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803110:	48 39 c1             	cmp    %rax,%rcx
+  803113:	73 d2                	jae    8030e7 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803115:	41 0f b6 3f          	movzbl (%r15),%edi
+  803119:	48 89 ca             	mov    %rcx,%rdx
+  80311c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803120:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803127:	08 10 20 
+  80312a:	48 f7 e2             	mul    %rdx
+  80312d:	48 c1 ea 06          	shr    $0x6,%rdx
+  803131:	48 89 d0             	mov    %rdx,%rax
+  803134:	48 c1 e0 09          	shl    $0x9,%rax
+  803138:	48 29 d0             	sub    %rdx,%rax
+  80313b:	48 c1 e0 03          	shl    $0x3,%rax
+  80313f:	48 29 c1             	sub    %rax,%rcx
+  803142:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803147:	83 c6 01             	add    $0x1,%esi
+  80314a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80314d:	49 83 c7 01          	add    $0x1,%r15
+  803151:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803155:	49 39 c7             	cmp    %rax,%r15
+  803158:	0f 85 75 ff ff ff    	jne    8030d3 <devpipe_write+0x57>
+    return n;
+  80315e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803162:	eb 05                	jmp    803169 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803164:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803169:	48 83 c4 18          	add    $0x18,%rsp
+  80316d:	5b                   	pop    %rbx
+  80316e:	41 5c                	pop    %r12
+  803170:	41 5d                	pop    %r13
+  803172:	41 5e                	pop    %r14
+  803174:	41 5f                	pop    %r15
+  803176:	5d                   	pop    %rbp
+  803177:	c3                   	ret
+
+0000000000803178 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803178:	55                   	push   %rbp
+  803179:	48 89 e5             	mov    %rsp,%rbp
+  80317c:	41 57                	push   %r15
+  80317e:	41 56                	push   %r14
+  803180:	41 55                	push   %r13
+  803182:	41 54                	push   %r12
+  803184:	53                   	push   %rbx
+  803185:	48 83 ec 18          	sub    $0x18,%rsp
+  803189:	49 89 fc             	mov    %rdi,%r12
+  80318c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803190:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803194:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  80319b:	00 00 00 
+  80319e:	ff d0                	call   *%rax
+  8031a0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8031a3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031a9:	49 bd 1b 15 80 00 00 	movabs $0x80151b,%r13
+  8031b0:	00 00 00 
+            sys_yield();
+  8031b3:	49 be b8 14 80 00 00 	movabs $0x8014b8,%r14
+  8031ba:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8031bd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031c2:	74 7d                	je     803241 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8031c4:	8b 03                	mov    (%rbx),%eax
+  8031c6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8031c9:	75 26                	jne    8031f1 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8031cb:	4d 85 ff             	test   %r15,%r15
+  8031ce:	75 77                	jne    803247 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031d5:	48 89 da             	mov    %rbx,%rdx
+  8031d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031dd:	4c 89 e7             	mov    %r12,%rdi
+  8031e0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8031e3:	85 c0                	test   %eax,%eax
+  8031e5:	74 72                	je     803259 <devpipe_read+0xe1>
+            sys_yield();
+  8031e7:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8031ea:	8b 03                	mov    (%rbx),%eax
+  8031ec:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8031ef:	74 df                	je     8031d0 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031f1:	48 63 c8             	movslq %eax,%rcx
+  8031f4:	48 89 ca             	mov    %rcx,%rdx
+  8031f7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8031fb:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803202:	08 10 20 
+  803205:	48 89 d0             	mov    %rdx,%rax
+  803208:	48 f7 e6             	mul    %rsi
+  80320b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80320f:	48 89 d0             	mov    %rdx,%rax
+  803212:	48 c1 e0 09          	shl    $0x9,%rax
+  803216:	48 29 d0             	sub    %rdx,%rax
+  803219:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803220:	00 
+  803221:	48 89 c8             	mov    %rcx,%rax
+  803224:	48 29 d0             	sub    %rdx,%rax
+  803227:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80322c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803230:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803234:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803237:	49 83 c7 01          	add    $0x1,%r15
+  80323b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80323f:	75 83                	jne    8031c4 <devpipe_read+0x4c>
+    return n;
+  803241:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803245:	eb 03                	jmp    80324a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803247:	4c 89 f8             	mov    %r15,%rax
+}
+  80324a:	48 83 c4 18          	add    $0x18,%rsp
+  80324e:	5b                   	pop    %rbx
+  80324f:	41 5c                	pop    %r12
+  803251:	41 5d                	pop    %r13
+  803253:	41 5e                	pop    %r14
+  803255:	41 5f                	pop    %r15
+  803257:	5d                   	pop    %rbp
+  803258:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325e:	eb ea                	jmp    80324a <devpipe_read+0xd2>
+
+0000000000803260 <pipe>:
+pipe(int pfd[2]) {
+  803260:	55                   	push   %rbp
+  803261:	48 89 e5             	mov    %rsp,%rbp
+  803264:	41 55                	push   %r13
+  803266:	41 54                	push   %r12
+  803268:	53                   	push   %rbx
+  803269:	48 83 ec 18          	sub    $0x18,%rsp
+  80326d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803270:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803274:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+  803280:	89 c3                	mov    %eax,%ebx
+  803282:	85 c0                	test   %eax,%eax
+  803284:	0f 88 a0 01 00 00    	js     80342a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80328a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80328f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803294:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803298:	bf 00 00 00 00       	mov    $0x0,%edi
+  80329d:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8032ab:	85 c0                	test   %eax,%eax
+  8032ad:	0f 88 77 01 00 00    	js     80342a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032b3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8032b7:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+  8032c3:	89 c3                	mov    %eax,%ebx
+  8032c5:	85 c0                	test   %eax,%eax
+  8032c7:	0f 88 43 01 00 00    	js     803410 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032cd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032d7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8032db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e0:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  8032e7:	00 00 00 
+  8032ea:	ff d0                	call   *%rax
+  8032ec:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032ee:	85 c0                	test   %eax,%eax
+  8032f0:	0f 88 1a 01 00 00    	js     803410 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8032f6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032fa:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  803301:	00 00 00 
+  803304:	ff d0                	call   *%rax
+  803306:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803309:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80330e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803313:	48 89 c6             	mov    %rax,%rsi
+  803316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331b:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	89 c3                	mov    %eax,%ebx
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	0f 88 c5 00 00 00    	js     8033f6 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803331:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803335:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+  803341:	48 89 c1             	mov    %rax,%rcx
+  803344:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80334a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803350:	ba 00 00 00 00       	mov    $0x0,%edx
+  803355:	4c 89 ee             	mov    %r13,%rsi
+  803358:	bf 00 00 00 00       	mov    $0x0,%edi
+  80335d:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+  803369:	89 c3                	mov    %eax,%ebx
+  80336b:	85 c0                	test   %eax,%eax
+  80336d:	78 6e                	js     8033dd <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80336f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803374:	4c 89 ef             	mov    %r13,%rdi
+  803377:	48 b8 e9 14 80 00 00 	movabs $0x8014e9,%rax
+  80337e:	00 00 00 
+  803381:	ff d0                	call   *%rax
+  803383:	83 f8 02             	cmp    $0x2,%eax
+  803386:	0f 85 ab 00 00 00    	jne    803437 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80338c:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803393:	00 00 
+  803395:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803399:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80339b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80339f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8033a6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033aa:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8033ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033b0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8033b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033bb:	48 bb 26 1a 80 00 00 	movabs $0x801a26,%rbx
+  8033c2:	00 00 00 
+  8033c5:	ff d3                	call   *%rbx
+  8033c7:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8033cb:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8033cf:	ff d3                	call   *%rbx
+  8033d1:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8033d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033db:	eb 4d                	jmp    80342a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8033dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033e2:	4c 89 ee             	mov    %r13,%rsi
+  8033e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ea:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  8033f1:	00 00 00 
+  8033f4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8033f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033fb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8033ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803404:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803410:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803415:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803419:	bf 00 00 00 00       	mov    $0x0,%edi
+  80341e:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  803425:	00 00 00 
+  803428:	ff d0                	call   *%rax
+}
+  80342a:	89 d8                	mov    %ebx,%eax
+  80342c:	48 83 c4 18          	add    $0x18,%rsp
+  803430:	5b                   	pop    %rbx
+  803431:	41 5c                	pop    %r12
+  803433:	41 5d                	pop    %r13
+  803435:	5d                   	pop    %rbp
+  803436:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803437:	48 b9 90 42 80 00 00 	movabs $0x804290,%rcx
+  80343e:	00 00 00 
+  803441:	48 ba 67 42 80 00 00 	movabs $0x804267,%rdx
+  803448:	00 00 00 
+  80344b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803450:	48 bf 7c 42 80 00 00 	movabs $0x80427c,%rdi
+  803457:	00 00 00 
+  80345a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345f:	49 b8 46 04 80 00 00 	movabs $0x800446,%r8
+  803466:	00 00 00 
+  803469:	41 ff d0             	call   *%r8
+
+000000000080346c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80346c:	55                   	push   %rbp
+  80346d:	48 89 e5             	mov    %rsp,%rbp
+  803470:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803474:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803478:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  80347f:	00 00 00 
+  803482:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803484:	85 c0                	test   %eax,%eax
+  803486:	78 35                	js     8034bd <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803488:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80348c:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  803493:	00 00 00 
+  803496:	ff d0                	call   *%rax
+  803498:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80349b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8034a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034a5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034a9:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	0f 94 c0             	sete   %al
+  8034ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8034bd:	c9                   	leave
+  8034be:	c3                   	ret
+
+00000000008034bf <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034bf:	48 89 f8             	mov    %rdi,%rax
+  8034c2:	48 c1 e8 27          	shr    $0x27,%rax
+  8034c6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034cd:	01 00 00 
+  8034d0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034d4:	f6 c2 01             	test   $0x1,%dl
+  8034d7:	74 6d                	je     803546 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034d9:	48 89 f8             	mov    %rdi,%rax
+  8034dc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034e0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034e7:	01 00 00 
+  8034ea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034ee:	f6 c2 01             	test   $0x1,%dl
+  8034f1:	74 62                	je     803555 <get_uvpt_entry+0x96>
+  8034f3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034fa:	01 00 00 
+  8034fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803501:	f6 c2 80             	test   $0x80,%dl
+  803504:	75 4f                	jne    803555 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803506:	48 89 f8             	mov    %rdi,%rax
+  803509:	48 c1 e8 15          	shr    $0x15,%rax
+  80350d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803514:	01 00 00 
+  803517:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80351b:	f6 c2 01             	test   $0x1,%dl
+  80351e:	74 44                	je     803564 <get_uvpt_entry+0xa5>
+  803520:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803527:	01 00 00 
+  80352a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80352e:	f6 c2 80             	test   $0x80,%dl
+  803531:	75 31                	jne    803564 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803533:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803537:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80353e:	01 00 00 
+  803541:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803545:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803546:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80354d:	01 00 00 
+  803550:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803554:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803555:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80355c:	01 00 00 
+  80355f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803563:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803564:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80356b:	01 00 00 
+  80356e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803572:	c3                   	ret
+
+0000000000803573 <get_prot>:
+
+int
+get_prot(void *va) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803577:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  80357e:	00 00 00 
+  803581:	ff d0                	call   *%rax
+  803583:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803586:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80358b:	89 c1                	mov    %eax,%ecx
+  80358d:	83 c9 04             	or     $0x4,%ecx
+  803590:	f6 c2 01             	test   $0x1,%dl
+  803593:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803596:	89 c1                	mov    %eax,%ecx
+  803598:	83 c9 02             	or     $0x2,%ecx
+  80359b:	f6 c2 02             	test   $0x2,%dl
+  80359e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8035a1:	89 c1                	mov    %eax,%ecx
+  8035a3:	83 c9 01             	or     $0x1,%ecx
+  8035a6:	48 85 d2             	test   %rdx,%rdx
+  8035a9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8035ac:	89 c1                	mov    %eax,%ecx
+  8035ae:	83 c9 40             	or     $0x40,%ecx
+  8035b1:	f6 c6 04             	test   $0x4,%dh
+  8035b4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8035b7:	5d                   	pop    %rbp
+  8035b8:	c3                   	ret
+
+00000000008035b9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8035b9:	55                   	push   %rbp
+  8035ba:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035bd:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8035c4:	00 00 00 
+  8035c7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8035c9:	48 c1 e8 06          	shr    $0x6,%rax
+  8035cd:	83 e0 01             	and    $0x1,%eax
+}
+  8035d0:	5d                   	pop    %rbp
+  8035d1:	c3                   	ret
+
+00000000008035d2 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8035d2:	55                   	push   %rbp
+  8035d3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035d6:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8035dd:	00 00 00 
+  8035e0:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8035e2:	48 c1 e8 05          	shr    $0x5,%rax
+  8035e6:	83 e0 01             	and    $0x1,%eax
+}
+  8035e9:	5d                   	pop    %rbp
+  8035ea:	c3                   	ret
+
+00000000008035eb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8035eb:	55                   	push   %rbp
+  8035ec:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8035ef:	48 b8 bf 34 80 00 00 	movabs $0x8034bf,%rax
+  8035f6:	00 00 00 
+  8035f9:	ff d0                	call   *%rax
+  8035fb:	83 e0 01             	and    $0x1,%eax
+}
+  8035fe:	5d                   	pop    %rbp
+  8035ff:	c3                   	ret
+
+0000000000803600 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	41 57                	push   %r15
+  803606:	41 56                	push   %r14
+  803608:	41 55                	push   %r13
+  80360a:	41 54                	push   %r12
+  80360c:	53                   	push   %rbx
+  80360d:	48 83 ec 18          	sub    $0x18,%rsp
+  803611:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803615:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803619:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80361e:	49 bd eb 35 80 00 00 	movabs $0x8035eb,%r13
+  803625:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803628:	49 bf 73 35 80 00 00 	movabs $0x803573,%r15
+  80362f:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803632:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803639:	00 00 00 
+  80363c:	eb 0c                	jmp    80364a <foreach_shared_region+0x4a>
+  80363e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803645:	4c 39 f3             	cmp    %r14,%rbx
+  803648:	74 2e                	je     803678 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80364a:	48 89 df             	mov    %rbx,%rdi
+  80364d:	41 ff d5             	call   *%r13
+  803650:	84 c0                	test   %al,%al
+  803652:	74 ea                	je     80363e <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803654:	48 89 df             	mov    %rbx,%rdi
+  803657:	41 ff d7             	call   *%r15
+  80365a:	a8 40                	test   $0x40,%al
+  80365c:	74 e0                	je     80363e <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80365e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803665:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803669:	48 89 df             	mov    %rbx,%rdi
+  80366c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803670:	ff d0                	call   *%rax
+				if (res < 0) {
+  803672:	85 c0                	test   %eax,%eax
+  803674:	79 c8                	jns    80363e <foreach_shared_region+0x3e>
+  803676:	eb 05                	jmp    80367d <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803678:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367d:	48 83 c4 18          	add    $0x18,%rsp
+  803681:	5b                   	pop    %rbx
+  803682:	41 5c                	pop    %r12
+  803684:	41 5d                	pop    %r13
+  803686:	41 5e                	pop    %r14
+  803688:	41 5f                	pop    %r15
+  80368a:	5d                   	pop    %rbp
+  80368b:	c3                   	ret
+
+000000000080368c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80368c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803691:	c3                   	ret
+
+0000000000803692 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803692:	55                   	push   %rbp
+  803693:	48 89 e5             	mov    %rsp,%rbp
+  803696:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803699:	48 be b4 42 80 00 00 	movabs $0x8042b4,%rsi
+  8036a0:	00 00 00 
+  8036a3:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  8036aa:	00 00 00 
+  8036ad:	ff d0                	call   *%rax
+    return 0;
+}
+  8036af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b4:	5d                   	pop    %rbp
+  8036b5:	c3                   	ret
+
+00000000008036b6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036b6:	55                   	push   %rbp
+  8036b7:	48 89 e5             	mov    %rsp,%rbp
+  8036ba:	41 57                	push   %r15
+  8036bc:	41 56                	push   %r14
+  8036be:	41 55                	push   %r13
+  8036c0:	41 54                	push   %r12
+  8036c2:	53                   	push   %rbx
+  8036c3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8036ca:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8036d1:	48 85 d2             	test   %rdx,%rdx
+  8036d4:	74 7a                	je     803750 <devcons_write+0x9a>
+  8036d6:	49 89 d6             	mov    %rdx,%r14
+  8036d9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036df:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8036e4:	49 bf b5 10 80 00 00 	movabs $0x8010b5,%r15
+  8036eb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8036ee:	4c 89 f3             	mov    %r14,%rbx
+  8036f1:	48 29 f3             	sub    %rsi,%rbx
+  8036f4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8036f9:	48 39 c3             	cmp    %rax,%rbx
+  8036fc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803700:	4c 63 eb             	movslq %ebx,%r13
+  803703:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80370a:	48 01 c6             	add    %rax,%rsi
+  80370d:	4c 89 ea             	mov    %r13,%rdx
+  803710:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803717:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80371a:	4c 89 ee             	mov    %r13,%rsi
+  80371d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803724:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  80372b:	00 00 00 
+  80372e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803730:	41 01 dc             	add    %ebx,%r12d
+  803733:	49 63 f4             	movslq %r12d,%rsi
+  803736:	4c 39 f6             	cmp    %r14,%rsi
+  803739:	72 b3                	jb     8036ee <devcons_write+0x38>
+    return res;
+  80373b:	49 63 c4             	movslq %r12d,%rax
+}
+  80373e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803745:	5b                   	pop    %rbx
+  803746:	41 5c                	pop    %r12
+  803748:	41 5d                	pop    %r13
+  80374a:	41 5e                	pop    %r14
+  80374c:	41 5f                	pop    %r15
+  80374e:	5d                   	pop    %rbp
+  80374f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803750:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803756:	eb e3                	jmp    80373b <devcons_write+0x85>
+
+0000000000803758 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803758:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80375b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803760:	48 85 c0             	test   %rax,%rax
+  803763:	74 55                	je     8037ba <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803765:	55                   	push   %rbp
+  803766:	48 89 e5             	mov    %rsp,%rbp
+  803769:	41 55                	push   %r13
+  80376b:	41 54                	push   %r12
+  80376d:	53                   	push   %rbx
+  80376e:	48 83 ec 08          	sub    $0x8,%rsp
+  803772:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803775:	48 bb eb 13 80 00 00 	movabs $0x8013eb,%rbx
+  80377c:	00 00 00 
+  80377f:	49 bc b8 14 80 00 00 	movabs $0x8014b8,%r12
+  803786:	00 00 00 
+  803789:	eb 03                	jmp    80378e <devcons_read+0x36>
+  80378b:	41 ff d4             	call   *%r12
+  80378e:	ff d3                	call   *%rbx
+  803790:	85 c0                	test   %eax,%eax
+  803792:	74 f7                	je     80378b <devcons_read+0x33>
+    if (c < 0) return c;
+  803794:	48 63 d0             	movslq %eax,%rdx
+  803797:	78 13                	js     8037ac <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80379e:	83 f8 04             	cmp    $0x4,%eax
+  8037a1:	74 09                	je     8037ac <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8037a3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8037a7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8037ac:	48 89 d0             	mov    %rdx,%rax
+  8037af:	48 83 c4 08          	add    $0x8,%rsp
+  8037b3:	5b                   	pop    %rbx
+  8037b4:	41 5c                	pop    %r12
+  8037b6:	41 5d                	pop    %r13
+  8037b8:	5d                   	pop    %rbp
+  8037b9:	c3                   	ret
+  8037ba:	48 89 d0             	mov    %rdx,%rax
+  8037bd:	c3                   	ret
+
+00000000008037be <cputchar>:
+cputchar(int ch) {
+  8037be:	55                   	push   %rbp
+  8037bf:	48 89 e5             	mov    %rsp,%rbp
+  8037c2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8037c6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8037ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8037cf:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8037d3:	48 b8 be 13 80 00 00 	movabs $0x8013be,%rax
+  8037da:	00 00 00 
+  8037dd:	ff d0                	call   *%rax
+}
+  8037df:	c9                   	leave
+  8037e0:	c3                   	ret
+
+00000000008037e1 <getchar>:
+getchar(void) {
+  8037e1:	55                   	push   %rbp
+  8037e2:	48 89 e5             	mov    %rsp,%rbp
+  8037e5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8037e9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037ee:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8037f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f7:	48 b8 97 1d 80 00 00 	movabs $0x801d97,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+  803803:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803805:	85 c0                	test   %eax,%eax
+  803807:	78 06                	js     80380f <getchar+0x2e>
+  803809:	74 08                	je     803813 <getchar+0x32>
+  80380b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80380f:	89 d0                	mov    %edx,%eax
+  803811:	c9                   	leave
+  803812:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803813:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803818:	eb f5                	jmp    80380f <getchar+0x2e>
+
+000000000080381a <iscons>:
+iscons(int fdnum) {
+  80381a:	55                   	push   %rbp
+  80381b:	48 89 e5             	mov    %rsp,%rbp
+  80381e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803822:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803826:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803832:	85 c0                	test   %eax,%eax
+  803834:	78 18                	js     80384e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803836:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80383a:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803841:	00 00 00 
+  803844:	8b 00                	mov    (%rax),%eax
+  803846:	39 02                	cmp    %eax,(%rdx)
+  803848:	0f 94 c0             	sete   %al
+  80384b:	0f b6 c0             	movzbl %al,%eax
+}
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+0000000000803850 <opencons>:
+opencons(void) {
+  803850:	55                   	push   %rbp
+  803851:	48 89 e5             	mov    %rsp,%rbp
+  803854:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803858:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80385c:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  803863:	00 00 00 
+  803866:	ff d0                	call   *%rax
+  803868:	85 c0                	test   %eax,%eax
+  80386a:	78 49                	js     8038b5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80386c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803871:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803876:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80387a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387f:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  803886:	00 00 00 
+  803889:	ff d0                	call   *%rax
+  80388b:	85 c0                	test   %eax,%eax
+  80388d:	78 26                	js     8038b5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80388f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803893:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  80389a:	00 00 
+  80389c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80389e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038a2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8038a9:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+}
+  8038b5:	c9                   	leave
+  8038b6:	c3                   	ret
+
+00000000008038b7 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8038b7:	55                   	push   %rbp
+  8038b8:	48 89 e5             	mov    %rsp,%rbp
+  8038bb:	41 55                	push   %r13
+  8038bd:	41 54                	push   %r12
+  8038bf:	53                   	push   %rbx
+  8038c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8038c4:	49 89 fc             	mov    %rdi,%r12
+  8038c7:	48 89 f7             	mov    %rsi,%rdi
+  8038ca:	48 89 d3             	mov    %rdx,%rbx
+  8038cd:	49 89 cd             	mov    %rcx,%r13
+  8038d0:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038d3:	48 85 f6             	test   %rsi,%rsi
+  8038d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038dd:	00 00 00 
+  8038e0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8038e4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038e9:	48 85 db             	test   %rbx,%rbx
+  8038ec:	74 03                	je     8038f1 <ipc_recv_timed+0x3a>
+  8038ee:	48 8b 33             	mov    (%rbx),%rsi
+  8038f1:	48 b8 e1 17 80 00 00 	movabs $0x8017e1,%rax
+  8038f8:	00 00 00 
+  8038fb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8038fd:	85 c0                	test   %eax,%eax
+  8038ff:	78 75                	js     803976 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803901:	4d 85 e4             	test   %r12,%r12
+  803904:	74 14                	je     80391a <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803906:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80390d:	00 00 00 
+  803910:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803916:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80391a:	4d 85 ed             	test   %r13,%r13
+  80391d:	74 14                	je     803933 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80391f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803926:	00 00 00 
+  803929:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80392f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803933:	48 85 db             	test   %rbx,%rbx
+  803936:	74 23                	je     80395b <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803938:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80393f:	00 00 00 
+  803942:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80394d:	85 c9                	test   %ecx,%ecx
+  80394f:	74 07                	je     803958 <ipc_recv_timed+0xa1>
+  803951:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803958:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80395b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803962:	00 00 00 
+  803965:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80396b:	48 83 c4 08          	add    $0x8,%rsp
+  80396f:	5b                   	pop    %rbx
+  803970:	41 5c                	pop    %r12
+  803972:	41 5d                	pop    %r13
+  803974:	5d                   	pop    %rbp
+  803975:	c3                   	ret
+        if (from_env_store != NULL) {
+  803976:	4d 85 e4             	test   %r12,%r12
+  803979:	74 08                	je     803983 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80397b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803982:	00 
+        if (perm_store != NULL) {
+  803983:	4d 85 ed             	test   %r13,%r13
+  803986:	74 08                	je     803990 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803988:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80398f:	00 
+        if (size != NULL) {
+  803990:	48 85 db             	test   %rbx,%rbx
+  803993:	74 d6                	je     80396b <ipc_recv_timed+0xb4>
+            *size = 0;
+  803995:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80399c:	eb cd                	jmp    80396b <ipc_recv_timed+0xb4>
+
+000000000080399e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80399e:	55                   	push   %rbp
+  80399f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8039a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8039a8:	48 b8 b7 38 80 00 00 	movabs $0x8038b7,%rax
+  8039af:	00 00 00 
+  8039b2:	ff d0                	call   *%rax
+}
+  8039b4:	5d                   	pop    %rbp
+  8039b5:	c3                   	ret
+
+00000000008039b6 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	41 57                	push   %r15
+  8039bc:	41 56                	push   %r14
+  8039be:	41 55                	push   %r13
+  8039c0:	41 54                	push   %r12
+  8039c2:	53                   	push   %rbx
+  8039c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c7:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8039ca:	48 89 d3             	mov    %rdx,%rbx
+  8039cd:	49 89 cc             	mov    %rcx,%r12
+  8039d0:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8039d3:	48 85 d2             	test   %rdx,%rdx
+  8039d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039dd:	00 00 00 
+  8039e0:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039e4:	89 f0                	mov    %esi,%eax
+  8039e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039ea:	48 89 da             	mov    %rbx,%rdx
+  8039ed:	48 89 c6             	mov    %rax,%rsi
+  8039f0:	48 b8 b5 17 80 00 00 	movabs $0x8017b5,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+    while (res < 0) {
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	79 65                	jns    803a65 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a00:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a03:	75 33                	jne    803a38 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803a05:	49 bf b8 14 80 00 00 	movabs $0x8014b8,%r15
+  803a0c:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a0f:	49 be b5 17 80 00 00 	movabs $0x8017b5,%r14
+  803a16:	00 00 00 
+        sys_yield();
+  803a19:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a1c:	45 89 e8             	mov    %r13d,%r8d
+  803a1f:	4c 89 e1             	mov    %r12,%rcx
+  803a22:	48 89 da             	mov    %rbx,%rdx
+  803a25:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a29:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803a2c:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803a2f:	85 c0                	test   %eax,%eax
+  803a31:	79 32                	jns    803a65 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a33:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a36:	74 e1                	je     803a19 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803a38:	89 c1                	mov    %eax,%ecx
+  803a3a:	48 ba c0 42 80 00 00 	movabs $0x8042c0,%rdx
+  803a41:	00 00 00 
+  803a44:	be 52 00 00 00       	mov    $0x52,%esi
+  803a49:	48 bf d4 42 80 00 00 	movabs $0x8042d4,%rdi
+  803a50:	00 00 00 
+  803a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a58:	49 b8 46 04 80 00 00 	movabs $0x800446,%r8
+  803a5f:	00 00 00 
+  803a62:	41 ff d0             	call   *%r8
+    }
+}
+  803a65:	48 83 c4 18          	add    $0x18,%rsp
+  803a69:	5b                   	pop    %rbx
+  803a6a:	41 5c                	pop    %r12
+  803a6c:	41 5d                	pop    %r13
+  803a6e:	41 5e                	pop    %r14
+  803a70:	41 5f                	pop    %r15
+  803a72:	5d                   	pop    %rbp
+  803a73:	c3                   	ret
+
+0000000000803a74 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a74:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803a79:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803a80:	00 00 00 
+  803a83:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a87:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a8b:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a8f:	48 01 ca             	add    %rcx,%rdx
+  803a92:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a98:	39 fa                	cmp    %edi,%edx
+  803a9a:	74 12                	je     803aae <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a9c:	48 83 c0 01          	add    $0x1,%rax
+  803aa0:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803aa6:	75 db                	jne    803a83 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aad:	c3                   	ret
+            return envs[i].env_id;
+  803aae:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803ab2:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803ab6:	48 c1 e2 04          	shl    $0x4,%rdx
+  803aba:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803ac1:	00 00 00 
+  803ac4:	48 01 d0             	add    %rdx,%rax
+  803ac7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803acd:	c3                   	ret
+  803ace:	66 90                	xchg   %ax,%ax
+
+0000000000803ad0 <__rodata_start>:
+  803ad0:	20 53 48             	and    %dl,0x48(%rbx)
+  803ad3:	41 52                	push   %r10
+  803ad5:	45 00 20             	add    %r12b,(%r8)
+  803ad8:	43                   	rex.XB
+  803ad9:	4f 57                	rex.WRXB push %r15
+  803adb:	00 45 49             	add    %al,0x49(%rbp)
+  803ade:	44 3a 20             	cmp    (%rax),%r12b
+  803ae1:	25 64 2c 20 50       	and    $0x50202c64,%eax
+  803ae6:	45                   	rex.RB
+  803ae7:	49                   	rex.WB
+  803ae8:	44 3a 20             	cmp    (%rax),%r12b
+  803aeb:	25 64 0a 00 4d       	and    $0x4d000a64,%eax
+  803af0:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803af2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af3:	72 79                	jb     803b6e <__rodata_start+0x9e>
+  803af5:	20 75 73             	and    %dh,0x73(%rbp)
+  803af8:	61                   	(bad)
+  803af9:	67 65 20 73 75       	and    %dh,%gs:0x75(%ebx)
+  803afe:	6d                   	insl   (%dx),%es:(%rdi)
+  803aff:	6d                   	insl   (%dx),%es:(%rdi)
+  803b00:	61                   	(bad)
+  803b01:	72 79                	jb     803b7c <__rodata_start+0xac>
+  803b03:	3a 0a                	cmp    (%rdx),%cl
+  803b05:	00 20                	add    %ah,(%rax)
+  803b07:	20 50 54             	and    %dl,0x54(%rax)
+  803b0a:	45 5f                	rex.RB pop %r15
+  803b0c:	50                   	push   %rax
+  803b0d:	3a 20                	cmp    (%rax),%ah
+  803b0f:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803b14:	20 20                	and    %ah,(%rax)
+  803b16:	50                   	push   %rax
+  803b17:	54                   	push   %rsp
+  803b18:	45 5f                	rex.RB pop %r15
+  803b1a:	55                   	push   %rbp
+  803b1b:	3a 20                	cmp    (%rax),%ah
+  803b1d:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803b22:	20 20                	and    %ah,(%rax)
+  803b24:	50                   	push   %rax
+  803b25:	54                   	push   %rsp
+  803b26:	45 5f                	rex.RB pop %r15
+  803b28:	57                   	push   %rdi
+  803b29:	3a 20                	cmp    (%rax),%ah
+  803b2b:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803b30:	20 20                	and    %ah,(%rax)
+  803b32:	50                   	push   %rax
+  803b33:	54                   	push   %rsp
+  803b34:	45 5f                	rex.RB pop %r15
+  803b36:	43                   	rex.XB
+  803b37:	4f 57                	rex.WRXB push %r15
+  803b39:	3a 20                	cmp    (%rax),%ah
+  803b3b:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803b40:	70 69                	jo     803bab <__rodata_start+0xdb>
+  803b42:	70 65                	jo     803ba9 <__rodata_start+0xd9>
+  803b44:	28 29                	sub    %ch,(%rcx)
+  803b46:	20 66 61             	and    %ah,0x61(%rsi)
+  803b49:	69 6c 65 64 0a 00 75 	imul   $0x7375000a,0x64(%rbp,%riz,2),%ebp
+  803b50:	73 
+  803b51:	65 72 2f             	gs jb  803b83 <__rodata_start+0xb3>
+  803b54:	6d                   	insl   (%dx),%es:(%rdi)
+  803b55:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b57:	6c                   	insb   (%dx),%es:(%rdi)
+  803b58:	61                   	(bad)
+  803b59:	79 6f                	jns    803bca <__rodata_start+0xfa>
+  803b5b:	75 74                	jne    803bd1 <__rodata_start+0x101>
+  803b5d:	2e 63 00             	cs movsxd (%rax),%eax
+  803b60:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b62:	72 6b                	jb     803bcf <__rodata_start+0xff>
+  803b64:	28 29                	sub    %ch,(%rcx)
+  803b66:	20 66 61             	and    %ah,0x61(%rsi)
+  803b69:	69 6c 65 64 0a 00 3d 	imul   $0x3d3d000a,0x64(%rbp,%riz,2),%ebp
+  803b70:	3d 
+  803b71:	3d 3d 20 43 68       	cmp    $0x6843203d,%eax
+  803b76:	69 6c 64 0a 00 3d 3d 	imul   $0x3d3d3d00,0xa(%rsp,%riz,2),%ebp
+  803b7d:	3d 
+  803b7e:	3d 20 50 61 72       	cmp    $0x72615020,%eax
+  803b83:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b85:	74 0a                	je     803b91 <__rodata_start+0xc1>
+  803b87:	00 70 6d             	add    %dh,0x6d(%rax)
+  803b8a:	6c                   	insb   (%dx),%es:(%rdi)
+  803b8b:	34 3d                	xor    $0x3d,%al
+  803b8d:	25 70 20 75 76       	and    $0x76752070,%eax
+  803b92:	70 6d                	jo     803c01 <__rodata_start+0x131>
+  803b94:	6c                   	insb   (%dx),%es:(%rdi)
+  803b95:	34 3d                	xor    $0x3d,%al
+  803b97:	25 70 20 75 76       	and    $0x76752070,%eax
+  803b9c:	70 64                	jo     803c02 <__rodata_start+0x132>
+  803b9e:	70 3d                	jo     803bdd <__rodata_start+0x10d>
+  803ba0:	25 70 20 75 76       	and    $0x76752070,%eax
+  803ba5:	70 64                	jo     803c0b <__rodata_start+0x13b>
+  803ba7:	3d 25 70 20 75       	cmp    $0x75207025,%eax
+  803bac:	76 70                	jbe    803c1e <__rodata_start+0x14e>
+  803bae:	74 3d                	je     803bed <__rodata_start+0x11d>
+  803bb0:	25 70 0a 00 00       	and    $0xa70,%eax
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 5b 25             	add    %bl,0x25(%rbx)
+  803bba:	70 5d                	jo     803c19 <__rodata_start+0x149>
+  803bbc:	20 25 6c 78 20 2d    	and    %ah,0x2d20786c(%rip)        # 2da0b42e <__bss_end+0x2d20242e>
+  803bc2:	3e 20 25 30 38 6c 78 	ds and %ah,0x786c3830(%rip)        # 78ec73f9 <__bss_end+0x786be3f9>
+  803bc9:	3a 20                	cmp    (%rax),%ah
+  803bcb:	25 63 20 25 63       	and    $0x63252063,%eax
+  803bd0:	20 25 63 20 7c 25    	and    %ah,0x257c2063(%rip)        # 25fc5c39 <__bss_end+0x257bcc39>
+  803bd6:	73 25                	jae    803bfd <__rodata_start+0x12d>
+  803bd8:	73 0a                	jae    803be4 <__rodata_start+0x114>
+  803bda:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803be1:	77 6e                	ja     803c51 <__rodata_start+0x181>
+  803be3:	3e 00 0f             	ds add %cl,(%rdi)
+  803be6:	1f                   	(bad)
+  803be7:	00 5b 25             	add    %bl,0x25(%rbx)
+  803bea:	30 38                	xor    %bh,(%rax)
+  803bec:	78 5d                	js     803c4b <__rodata_start+0x17b>
+  803bee:	20 75 73             	and    %dh,0x73(%rbp)
+  803bf1:	65 72 20             	gs jb  803c14 <__rodata_start+0x144>
+  803bf4:	70 61                	jo     803c57 <__rodata_start+0x187>
+  803bf6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803bfe:	73 20                	jae    803c20 <__rodata_start+0x150>
+  803c00:	61                   	(bad)
+  803c01:	74 20                	je     803c23 <__rodata_start+0x153>
+  803c03:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803c08:	3a 20                	cmp    (%rax),%ah
+  803c0a:	00 30                	add    %dh,(%rax)
+  803c0c:	31 32                	xor    %esi,(%rdx)
+  803c0e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c15:	41                   	rex.B
+  803c16:	42                   	rex.X
+  803c17:	43                   	rex.XB
+  803c18:	44                   	rex.R
+  803c19:	45                   	rex.RB
+  803c1a:	46 00 30             	rex.RX add %r14b,(%rax)
+  803c1d:	31 32                	xor    %esi,(%rdx)
+  803c1f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c26:	61                   	(bad)
+  803c27:	62 63 64 65 66       	(bad)
+  803c2c:	00 28                	add    %ch,(%rax)
+  803c2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c2f:	75 6c                	jne    803c9d <__rodata_start+0x1cd>
+  803c31:	6c                   	insb   (%dx),%es:(%rdi)
+  803c32:	29 00                	sub    %eax,(%rax)
+  803c34:	65 72 72             	gs jb  803ca9 <__rodata_start+0x1d9>
+  803c37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c38:	72 20                	jb     803c5a <__rodata_start+0x18a>
+  803c3a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803c3f:	73 70                	jae    803cb1 <__rodata_start+0x1e1>
+  803c41:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803c45:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803c4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4d:	72 00                	jb     803c4f <__rodata_start+0x17f>
+  803c4f:	62 61 64 20 65       	(bad)
+  803c54:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c55:	76 69                	jbe    803cc0 <__rodata_start+0x1f0>
+  803c57:	72 6f                	jb     803cc8 <__rodata_start+0x1f8>
+  803c59:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c5a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c5b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c5d:	74 00                	je     803c5f <__rodata_start+0x18f>
+  803c5f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c66:	20 70 61             	and    %dh,0x61(%rax)
+  803c69:	72 61                	jb     803ccc <__rodata_start+0x1fc>
+  803c6b:	6d                   	insl   (%dx),%es:(%rdi)
+  803c6c:	65 74 65             	gs je  803cd4 <__rodata_start+0x204>
+  803c6f:	72 00                	jb     803c71 <__rodata_start+0x1a1>
+  803c71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c72:	75 74                	jne    803ce8 <__rodata_start+0x218>
+  803c74:	20 6f 66             	and    %ch,0x66(%rdi)
+  803c77:	20 6d 65             	and    %ch,0x65(%rbp)
+  803c7a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c7c:	72 79                	jb     803cf7 <__rodata_start+0x227>
+  803c7e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803c81:	74 20                	je     803ca3 <__rodata_start+0x1d3>
+  803c83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c84:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803c88:	76 69                	jbe    803cf3 <__rodata_start+0x223>
+  803c8a:	72 6f                	jb     803cfb <__rodata_start+0x22b>
+  803c8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c8d:	6d                   	insl   (%dx),%es:(%rdi)
+  803c8e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c90:	74 73                	je     803d05 <__rodata_start+0x235>
+  803c92:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803c95:	72 72                	jb     803d09 <__rodata_start+0x239>
+  803c97:	75 70                	jne    803d09 <__rodata_start+0x239>
+  803c99:	74 65                	je     803d00 <__rodata_start+0x230>
+  803c9b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803ca0:	75 67                	jne    803d09 <__rodata_start+0x239>
+  803ca2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803ca5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ca7:	00 73 65             	add    %dh,0x65(%rbx)
+  803caa:	67 6d                	insl   (%dx),%es:(%edi)
+  803cac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cae:	74 61                	je     803d11 <__rodata_start+0x241>
+  803cb0:	74 69                	je     803d1b <__rodata_start+0x24b>
+  803cb2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cb3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cb4:	20 66 61             	and    %ah,0x61(%rsi)
+  803cb7:	75 6c                	jne    803d25 <__rodata_start+0x255>
+  803cb9:	74 00                	je     803cbb <__rodata_start+0x1eb>
+  803cbb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803cc2:	20 45 4c             	and    %al,0x4c(%rbp)
+  803cc5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803cc9:	61                   	(bad)
+  803cca:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803ccf:	20 73 75             	and    %dh,0x75(%rbx)
+  803cd2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803cd5:	73 79                	jae    803d50 <__rodata_start+0x280>
+  803cd7:	73 74                	jae    803d4d <__rodata_start+0x27d>
+  803cd9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803cdb:	20 63 61             	and    %ah,0x61(%rbx)
+  803cde:	6c                   	insb   (%dx),%es:(%rdi)
+  803cdf:	6c                   	insb   (%dx),%es:(%rdi)
+  803ce0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803ce3:	74 72                	je     803d57 <__rodata_start+0x287>
+  803ce5:	79 20                	jns    803d07 <__rodata_start+0x237>
+  803ce7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ce8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ce9:	74 20                	je     803d0b <__rodata_start+0x23b>
+  803ceb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ced:	75 6e                	jne    803d5d <__rodata_start+0x28d>
+  803cef:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803cf3:	76 20                	jbe    803d15 <__rodata_start+0x245>
+  803cf5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803cfc:	72 65                	jb     803d63 <__rodata_start+0x293>
+  803cfe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803d01:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d02:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803d06:	65 78 70             	gs js  803d79 <__rodata_start+0x2a9>
+  803d09:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803d0e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803d11:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803d15:	20 66 69             	and    %ah,0x69(%rsi)
+  803d18:	6c                   	insb   (%dx),%es:(%rdi)
+  803d19:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803d1d:	20 66 72             	and    %ah,0x72(%rsi)
+  803d20:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803d25:	61                   	(bad)
+  803d26:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803d29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d2a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d2b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803d2f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803d32:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d34:	20 6d 61             	and    %ch,0x61(%rbp)
+  803d37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d38:	79 20                	jns    803d5a <__rodata_start+0x28a>
+  803d3a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803d41:	72 65                	jb     803da8 <__rodata_start+0x2d8>
+  803d43:	20 6f 70             	and    %ch,0x70(%rdi)
+  803d46:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d48:	00 66 69             	add    %ah,0x69(%rsi)
+  803d4b:	6c                   	insb   (%dx),%es:(%rdi)
+  803d4c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803d50:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803d53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d54:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803d57:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d59:	74 20                	je     803d7b <__rodata_start+0x2ab>
+  803d5b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d5d:	75 6e                	jne    803dcd <__rodata_start+0x2fd>
+  803d5f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803d63:	76 61                	jbe    803dc6 <__rodata_start+0x2f6>
+  803d65:	6c                   	insb   (%dx),%es:(%rdi)
+  803d66:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803d6d:	00 
+  803d6e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803d75:	72 65                	jb     803ddc <__rodata_start+0x30c>
+  803d77:	61                   	(bad)
+  803d78:	64 79 20             	fs jns 803d9b <__rodata_start+0x2cb>
+  803d7b:	65 78 69             	gs js  803de7 <__rodata_start+0x317>
+  803d7e:	73 74                	jae    803df4 <__rodata_start+0x324>
+  803d80:	73 00                	jae    803d82 <__rodata_start+0x2b2>
+  803d82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d83:	70 65                	jo     803dea <__rodata_start+0x31a>
+  803d85:	72 61                	jb     803de8 <__rodata_start+0x318>
+  803d87:	74 69                	je     803df2 <__rodata_start+0x322>
+  803d89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d8b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803d8e:	74 20                	je     803db0 <__rodata_start+0x2e0>
+  803d90:	73 75                	jae    803e07 <__rodata_start+0x337>
+  803d92:	70 70                	jo     803e04 <__rodata_start+0x334>
+  803d94:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d95:	72 74                	jb     803e0b <__rodata_start+0x33b>
+  803d97:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803d9d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803da2:	74 00                	je     803da4 <__rodata_start+0x2d4>
+  803da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803dab:	00 00 00 
+  803dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803db5:	00 00 00 
+  803db8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803dbf:	00 
+  803dc0:	83 07 80             	addl   $0xffffff80,(%rdi)
+  803dc3:	00 00                	add    %al,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 c4                	add    %al,%ah
+  803dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dce:	00 00                	add    %al,(%rax)
+  803dd0:	b4 0d                	mov    $0xd,%ah
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 c4                	add    %al,%ah
+  803dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dde:	00 00                	add    %al,(%rax)
+  803de0:	c4                   	(bad)
+  803de1:	0d 80 00 00 00       	or     $0x80,%eax
+  803de6:	00 00                	add    %al,(%rax)
+  803de8:	c4                   	(bad)
+  803de9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dee:	00 00                	add    %al,(%rax)
+  803df0:	c4                   	(bad)
+  803df1:	0d 80 00 00 00       	or     $0x80,%eax
+  803df6:	00 00                	add    %al,(%rax)
+  803df8:	a2 07 80 00 00 00 00 	movabs %al,0xc400000000008007
+  803dff:	00 c4 
+  803e01:	0d 80 00 00 00       	or     $0x80,%eax
+  803e06:	00 00                	add    %al,(%rax)
+  803e08:	c4                   	(bad)
+  803e09:	0d 80 00 00 00       	or     $0x80,%eax
+  803e0e:	00 00                	add    %al,(%rax)
+  803e10:	96                   	xchg   %eax,%esi
+  803e11:	07                   	(bad)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 10                	add    %dl,(%rax)
+  803e19:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803e1f:	00 c4                	add    %al,%ah
+  803e21:	0d 80 00 00 00       	or     $0x80,%eax
+  803e26:	00 00                	add    %al,(%rax)
+  803e28:	96                   	xchg   %eax,%esi
+  803e29:	07                   	(bad)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 dc                	add    %bl,%ah
+  803e31:	07                   	(bad)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 dc                	add    %bl,%ah
+  803e39:	07                   	(bad)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 dc                	add    %bl,%ah
+  803e41:	07                   	(bad)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 dc                	add    %bl,%ah
+  803e49:	07                   	(bad)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 dc                	add    %bl,%ah
+  803e51:	07                   	(bad)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 dc                	add    %bl,%ah
+  803e59:	07                   	(bad)
+  803e5a:	80 00 00             	addb   $0x0,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 dc                	add    %bl,%ah
+  803e61:	07                   	(bad)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 dc                	add    %bl,%ah
+  803e69:	07                   	(bad)
+  803e6a:	80 00 00             	addb   $0x0,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 dc                	add    %bl,%ah
+  803e71:	07                   	(bad)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 c4                	add    %al,%ah
+  803e79:	0d 80 00 00 00       	or     $0x80,%eax
+  803e7e:	00 00                	add    %al,(%rax)
+  803e80:	c4                   	(bad)
+  803e81:	0d 80 00 00 00       	or     $0x80,%eax
+  803e86:	00 00                	add    %al,(%rax)
+  803e88:	c4                   	(bad)
+  803e89:	0d 80 00 00 00       	or     $0x80,%eax
+  803e8e:	00 00                	add    %al,(%rax)
+  803e90:	c4                   	(bad)
+  803e91:	0d 80 00 00 00       	or     $0x80,%eax
+  803e96:	00 00                	add    %al,(%rax)
+  803e98:	c4                   	(bad)
+  803e99:	0d 80 00 00 00       	or     $0x80,%eax
+  803e9e:	00 00                	add    %al,(%rax)
+  803ea0:	c4                   	(bad)
+  803ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  803ea6:	00 00                	add    %al,(%rax)
+  803ea8:	c4                   	(bad)
+  803ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  803eae:	00 00                	add    %al,(%rax)
+  803eb0:	c4                   	(bad)
+  803eb1:	0d 80 00 00 00       	or     $0x80,%eax
+  803eb6:	00 00                	add    %al,(%rax)
+  803eb8:	c4                   	(bad)
+  803eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ebe:	00 00                	add    %al,(%rax)
+  803ec0:	c4                   	(bad)
+  803ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  803ec6:	00 00                	add    %al,(%rax)
+  803ec8:	c4                   	(bad)
+  803ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ece:	00 00                	add    %al,(%rax)
+  803ed0:	c4                   	(bad)
+  803ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  803ed6:	00 00                	add    %al,(%rax)
+  803ed8:	c4                   	(bad)
+  803ed9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ede:	00 00                	add    %al,(%rax)
+  803ee0:	c4                   	(bad)
+  803ee1:	0d 80 00 00 00       	or     $0x80,%eax
+  803ee6:	00 00                	add    %al,(%rax)
+  803ee8:	c4                   	(bad)
+  803ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  803eee:	00 00                	add    %al,(%rax)
+  803ef0:	c4                   	(bad)
+  803ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  803ef6:	00 00                	add    %al,(%rax)
+  803ef8:	c4                   	(bad)
+  803ef9:	0d 80 00 00 00       	or     $0x80,%eax
+  803efe:	00 00                	add    %al,(%rax)
+  803f00:	c4                   	(bad)
+  803f01:	0d 80 00 00 00       	or     $0x80,%eax
+  803f06:	00 00                	add    %al,(%rax)
+  803f08:	c4                   	(bad)
+  803f09:	0d 80 00 00 00       	or     $0x80,%eax
+  803f0e:	00 00                	add    %al,(%rax)
+  803f10:	c4                   	(bad)
+  803f11:	0d 80 00 00 00       	or     $0x80,%eax
+  803f16:	00 00                	add    %al,(%rax)
+  803f18:	c4                   	(bad)
+  803f19:	0d 80 00 00 00       	or     $0x80,%eax
+  803f1e:	00 00                	add    %al,(%rax)
+  803f20:	c4                   	(bad)
+  803f21:	0d 80 00 00 00       	or     $0x80,%eax
+  803f26:	00 00                	add    %al,(%rax)
+  803f28:	c4                   	(bad)
+  803f29:	0d 80 00 00 00       	or     $0x80,%eax
+  803f2e:	00 00                	add    %al,(%rax)
+  803f30:	c4                   	(bad)
+  803f31:	0d 80 00 00 00       	or     $0x80,%eax
+  803f36:	00 00                	add    %al,(%rax)
+  803f38:	c4                   	(bad)
+  803f39:	0d 80 00 00 00       	or     $0x80,%eax
+  803f3e:	00 00                	add    %al,(%rax)
+  803f40:	c4                   	(bad)
+  803f41:	0d 80 00 00 00       	or     $0x80,%eax
+  803f46:	00 00                	add    %al,(%rax)
+  803f48:	c4                   	(bad)
+  803f49:	0d 80 00 00 00       	or     $0x80,%eax
+  803f4e:	00 00                	add    %al,(%rax)
+  803f50:	c4                   	(bad)
+  803f51:	0d 80 00 00 00       	or     $0x80,%eax
+  803f56:	00 00                	add    %al,(%rax)
+  803f58:	c4                   	(bad)
+  803f59:	0d 80 00 00 00       	or     $0x80,%eax
+  803f5e:	00 00                	add    %al,(%rax)
+  803f60:	c4                   	(bad)
+  803f61:	0d 80 00 00 00       	or     $0x80,%eax
+  803f66:	00 00                	add    %al,(%rax)
+  803f68:	e7 0c                	out    %eax,$0xc
+  803f6a:	80 00 00             	addb   $0x0,(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 c4                	add    %al,%ah
+  803f71:	0d 80 00 00 00       	or     $0x80,%eax
+  803f76:	00 00                	add    %al,(%rax)
+  803f78:	c4                   	(bad)
+  803f79:	0d 80 00 00 00       	or     $0x80,%eax
+  803f7e:	00 00                	add    %al,(%rax)
+  803f80:	c4                   	(bad)
+  803f81:	0d 80 00 00 00       	or     $0x80,%eax
+  803f86:	00 00                	add    %al,(%rax)
+  803f88:	c4                   	(bad)
+  803f89:	0d 80 00 00 00       	or     $0x80,%eax
+  803f8e:	00 00                	add    %al,(%rax)
+  803f90:	c4                   	(bad)
+  803f91:	0d 80 00 00 00       	or     $0x80,%eax
+  803f96:	00 00                	add    %al,(%rax)
+  803f98:	c4                   	(bad)
+  803f99:	0d 80 00 00 00       	or     $0x80,%eax
+  803f9e:	00 00                	add    %al,(%rax)
+  803fa0:	c4                   	(bad)
+  803fa1:	0d 80 00 00 00       	or     $0x80,%eax
+  803fa6:	00 00                	add    %al,(%rax)
+  803fa8:	c4                   	(bad)
+  803fa9:	0d 80 00 00 00       	or     $0x80,%eax
+  803fae:	00 00                	add    %al,(%rax)
+  803fb0:	c4                   	(bad)
+  803fb1:	0d 80 00 00 00       	or     $0x80,%eax
+  803fb6:	00 00                	add    %al,(%rax)
+  803fb8:	c4                   	(bad)
+  803fb9:	0d 80 00 00 00       	or     $0x80,%eax
+  803fbe:	00 00                	add    %al,(%rax)
+  803fc0:	33 08                	xor    (%rax),%ecx
+  803fc2:	80 00 00             	addb   $0x0,(%rax)
+  803fc5:	00 00                	add    %al,(%rax)
+  803fc7:	00 02                	add    %al,(%rdx)
+  803fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803fcf:	00 c4                	add    %al,%ah
+  803fd1:	0d 80 00 00 00       	or     $0x80,%eax
+  803fd6:	00 00                	add    %al,(%rax)
+  803fd8:	c4                   	(bad)
+  803fd9:	0d 80 00 00 00       	or     $0x80,%eax
+  803fde:	00 00                	add    %al,(%rax)
+  803fe0:	c4                   	(bad)
+  803fe1:	0d 80 00 00 00       	or     $0x80,%eax
+  803fe6:	00 00                	add    %al,(%rax)
+  803fe8:	c4                   	(bad)
+  803fe9:	0d 80 00 00 00       	or     $0x80,%eax
+  803fee:	00 00                	add    %al,(%rax)
+  803ff0:	62                   	(bad)
+  803ff1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803ff7:	00 c4                	add    %al,%ah
+  803ff9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ffe:	00 00                	add    %al,(%rax)
+  804000:	c4                   	(bad)
+  804001:	0d 80 00 00 00       	or     $0x80,%eax
+  804006:	00 00                	add    %al,(%rax)
+  804008:	28 08                	sub    %cl,(%rax)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 c4                	add    %al,%ah
+  804011:	0d 80 00 00 00       	or     $0x80,%eax
+  804016:	00 00                	add    %al,(%rax)
+  804018:	c4                   	(bad)
+  804019:	0d 80 00 00 00       	or     $0x80,%eax
+  80401e:	00 00                	add    %al,(%rax)
+  804020:	aa                   	stos   %al,%es:(%rdi)
+  804021:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804027:	00 74 0c 80          	add    %dh,-0x80(%rsp,%rcx,1)
+  80402b:	00 00                	add    %al,(%rax)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 c4                	add    %al,%ah
+  804031:	0d 80 00 00 00       	or     $0x80,%eax
+  804036:	00 00                	add    %al,(%rax)
+  804038:	c4                   	(bad)
+  804039:	0d 80 00 00 00       	or     $0x80,%eax
+  80403e:	00 00                	add    %al,(%rax)
+  804040:	f9                   	stc
+  804041:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804047:	00 c4                	add    %al,%ah
+  804049:	0d 80 00 00 00       	or     $0x80,%eax
+  80404e:	00 00                	add    %al,(%rax)
+  804050:	d6                   	(bad)
+  804051:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804057:	00 c4                	add    %al,%ah
+  804059:	0d 80 00 00 00       	or     $0x80,%eax
+  80405e:	00 00                	add    %al,(%rax)
+  804060:	c4                   	(bad)
+  804061:	0d 80 00 00 00       	or     $0x80,%eax
+  804066:	00 00                	add    %al,(%rax)
+  804068:	e7 0c                	out    %eax,$0xc
+  80406a:	80 00 00             	addb   $0x0,(%rax)
+  80406d:	00 00                	add    %al,(%rax)
+  80406f:	00 c4                	add    %al,%ah
+  804071:	0d 80 00 00 00       	or     $0x80,%eax
+  804076:	00 00                	add    %al,(%rax)
+  804078:	8c 07                	mov    %es,(%rdi)
+  80407a:	80 00 00             	addb   $0x0,(%rax)
+  80407d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804080 <error_string>:
+	...
+  804088:	3d 3c 80 00 00 00 00 00 4f 3c 80 00 00 00 00 00     =<......O<......
+  804098:	5f 3c 80 00 00 00 00 00 71 3c 80 00 00 00 00 00     _<......q<......
+  8040a8:	7f 3c 80 00 00 00 00 00 93 3c 80 00 00 00 00 00     .<.......<......
+  8040b8:	a8 3c 80 00 00 00 00 00 bb 3c 80 00 00 00 00 00     .<.......<......
+  8040c8:	cd 3c 80 00 00 00 00 00 e1 3c 80 00 00 00 00 00     .<.......<......
+  8040d8:	f1 3c 80 00 00 00 00 00 04 3d 80 00 00 00 00 00     .<.......=......
+  8040e8:	1b 3d 80 00 00 00 00 00 31 3d 80 00 00 00 00 00     .=......1=......
+  8040f8:	49 3d 80 00 00 00 00 00 61 3d 80 00 00 00 00 00     I=......a=......
+  804108:	6e 3d 80 00 00 00 00 00 28 41 80 00 00 00 00 00     n=......(A......
+  804118:	82 3d 80 00 00 00 00 00 9a 3d 80 00 00 00 00 00     .=.......=......
+  804128:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804138:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804178:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804188:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804198:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  8041a8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8041b8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  8041c8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  8041d8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  8041e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8041f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804208:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804218:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804228:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804238:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804240 <devtab>:
+  804240:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804250:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804260:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804270:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804280:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804290:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8042a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8042b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8042c0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8042d0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  8042e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,7469 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 19 02 00 00       	call   80023c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  80003d:	49 bd 4f 1b 80 00 00 	movabs $0x801b4f,%r13
+  800044:	00 00 00 
+        if (bol) {
+  800047:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  80004e:	00 00 00 
+            printf("%5d ", ++line);
+  800051:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  800058:	00 00 00 
+  80005b:	49 bf 30 3a 80 00 00 	movabs $0x803a30,%r15
+  800062:	00 00 00 
+  800065:	eb 25                	jmp    80008c <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  800067:	ba 01 00 00 00       	mov    $0x1,%edx
+  80006c:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800070:	bf 01 00 00 00       	mov    $0x1,%edi
+  800075:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  80007c:	00 00 00 
+  80007f:	ff d0                	call   *%rax
+  800081:	83 f8 01             	cmp    $0x1,%eax
+  800084:	75 44                	jne    8000ca <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  800086:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80008a:	74 70                	je     8000fc <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  80008c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800091:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800095:	44 89 e7             	mov    %r12d,%edi
+  800098:	41 ff d5             	call   *%r13
+  80009b:	48 85 c0             	test   %rax,%rax
+  80009e:	7e 71                	jle    800111 <num+0xec>
+        if (bol) {
+  8000a0:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8000a3:	74 c2                	je     800067 <num+0x42>
+            printf("%5d ", ++line);
+  8000a5:	41 8b 06             	mov    (%r14),%eax
+  8000a8:	8d 70 01             	lea    0x1(%rax),%esi
+  8000ab:	41 89 36             	mov    %esi,(%r14)
+  8000ae:	4c 89 ff             	mov    %r15,%rdi
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	48 ba dd 2e 80 00 00 	movabs $0x802edd,%rdx
+  8000bd:	00 00 00 
+  8000c0:	ff d2                	call   *%rdx
+            bol = 0;
+  8000c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000c8:	eb 9d                	jmp    800067 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8000d1:	48 ba 35 3a 80 00 00 	movabs $0x803a35,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 12 00 00 00       	mov    $0x12,%esi
+  8000e0:	48 bf 50 3a 80 00 00 	movabs $0x803a50,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+            bol = 1;
+  8000fc:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800103:	00 00 00 
+  800106:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80010c:	e9 4a ff ff ff       	jmp    80005b <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800111:	78 0f                	js     800122 <num+0xfd>
+}
+  800113:	48 83 c4 28          	add    $0x28,%rsp
+  800117:	5b                   	pop    %rbx
+  800118:	41 5c                	pop    %r12
+  80011a:	41 5d                	pop    %r13
+  80011c:	41 5e                	pop    %r14
+  80011e:	41 5f                	pop    %r15
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800122:	41 89 c0             	mov    %eax,%r8d
+  800125:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  800129:	48 ba 5b 3a 80 00 00 	movabs $0x803a5b,%rdx
+  800130:	00 00 00 
+  800133:	be 16 00 00 00       	mov    $0x16,%esi
+  800138:	48 bf 50 3a 80 00 00 	movabs $0x803a50,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  80014e:	00 00 00 
+  800151:	41 ff d1             	call   *%r9
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  800165:	48 b8 70 3a 80 00 00 	movabs $0x803a70,%rax
+  80016c:	00 00 00 
+  80016f:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  800176:	00 00 00 
+    if (argc == 1)
+  800179:	83 ff 01             	cmp    $0x1,%edi
+  80017c:	74 6f                	je     8001ed <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80017e:	7e 52                	jle    8001d2 <umain+0x7e>
+  800180:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  800184:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800187:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  80018c:	49 bd ae 2c 80 00 00 	movabs $0x802cae,%r13
+  800193:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  800196:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80019d:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  8001a0:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 ff d5             	call   *%r13
+  8001ac:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 58                	js     80020a <umain+0xb6>
+                num(f, argv[i]);
+  8001b2:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	41 ff d6             	call   *%r14
+                close(f);
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8001c9:	49 83 c4 08          	add    $0x8,%r12
+  8001cd:	4d 39 fc             	cmp    %r15,%r12
+  8001d0:	75 ce                	jne    8001a0 <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8001d2:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+}
+  8001de:	48 83 c4 08          	add    $0x8,%rsp
+  8001e2:	5b                   	pop    %rbx
+  8001e3:	41 5c                	pop    %r12
+  8001e5:	41 5d                	pop    %r13
+  8001e7:	41 5e                	pop    %r14
+  8001e9:	41 5f                	pop    %r15
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+        num(0, "<stdin>");
+  8001ed:	48 be 74 3a 80 00 00 	movabs $0x803a74,%rsi
+  8001f4:	00 00 00 
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	eb c8                	jmp    8001d2 <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  80020a:	49 8b 0c 24          	mov    (%r12),%rcx
+  80020e:	41 89 c0             	mov    %eax,%r8d
+  800211:	48 ba 7c 3a 80 00 00 	movabs $0x803a7c,%rdx
+  800218:	00 00 00 
+  80021b:	be 22 00 00 00       	mov    $0x22,%esi
+  800220:	48 bf 50 3a 80 00 00 	movabs $0x803a50,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  800236:	00 00 00 
+  800239:	41 ff d1             	call   *%r9
+
+000000000080023c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	41 89 fd             	mov    %edi,%r13d
+  80024a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80024d:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800254:	00 00 00 
+  800257:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80025e:	00 00 00 
+  800261:	48 39 c2             	cmp    %rax,%rdx
+  800264:	73 17                	jae    80027d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800266:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800269:	49 89 c4             	mov    %rax,%r12
+  80026c:	48 83 c3 08          	add    $0x8,%rbx
+  800270:	b8 00 00 00 00       	mov    $0x0,%eax
+  800275:	ff 53 f8             	call   *-0x8(%rbx)
+  800278:	4c 39 e3             	cmp    %r12,%rbx
+  80027b:	72 ef                	jb     80026c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80027d:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  800289:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80028e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800292:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800296:	48 c1 e0 04          	shl    $0x4,%rax
+  80029a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002a1:	00 00 00 
+  8002a4:	48 01 d0             	add    %rdx,%rax
+  8002a7:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8002ae:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002b1:	45 85 ed             	test   %r13d,%r13d
+  8002b4:	7e 0d                	jle    8002c3 <libmain+0x87>
+  8002b6:	49 8b 06             	mov    (%r14),%rax
+  8002b9:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8002c0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002c3:	4c 89 f6             	mov    %r14,%rsi
+  8002c6:	44 89 ef             	mov    %r13d,%edi
+  8002c9:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  8002d0:	00 00 00 
+  8002d3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002d5:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8002dc:	00 00 00 
+  8002df:	ff d0                	call   *%rax
+#endif
+}
+  8002e1:	5b                   	pop    %rbx
+  8002e2:	41 5c                	pop    %r12
+  8002e4:	41 5d                	pop    %r13
+  8002e6:	41 5e                	pop    %r14
+  8002e8:	5d                   	pop    %rbp
+  8002e9:	c3                   	ret
+
+00000000008002ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002ea:	55                   	push   %rbp
+  8002eb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002ee:	48 b8 04 1a 80 00 00 	movabs $0x801a04,%rax
+  8002f5:	00 00 00 
+  8002f8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ff:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+}
+  80030b:	5d                   	pop    %rbp
+  80030c:	c3                   	ret
+
+000000000080030d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80030d:	55                   	push   %rbp
+  80030e:	48 89 e5             	mov    %rsp,%rbp
+  800311:	41 56                	push   %r14
+  800313:	41 55                	push   %r13
+  800315:	41 54                	push   %r12
+  800317:	53                   	push   %rbx
+  800318:	48 83 ec 50          	sub    $0x50,%rsp
+  80031c:	49 89 fc             	mov    %rdi,%r12
+  80031f:	41 89 f5             	mov    %esi,%r13d
+  800322:	48 89 d3             	mov    %rdx,%rbx
+  800325:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800329:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80032d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800331:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800338:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800340:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800344:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800348:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  80034f:	00 00 00 
+  800352:	4c 8b 30             	mov    (%rax),%r14
+  800355:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  80035c:	00 00 00 
+  80035f:	ff d0                	call   *%rax
+  800361:	89 c6                	mov    %eax,%esi
+  800363:	45 89 e8             	mov    %r13d,%r8d
+  800366:	4c 89 e1             	mov    %r12,%rcx
+  800369:	4c 89 f2             	mov    %r14,%rdx
+  80036c:	48 bf 98 3a 80 00 00 	movabs $0x803a98,%rdi
+  800373:	00 00 00 
+  800376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037b:	49 bc 5d 04 80 00 00 	movabs $0x80045d,%r12
+  800382:	00 00 00 
+  800385:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800388:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80038c:	48 89 df             	mov    %rbx,%rdi
+  80038f:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+    cprintf("\n");
+  80039b:	48 bf 93 40 80 00 00 	movabs $0x804093,%rdi
+  8003a2:	00 00 00 
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003ad:	cc                   	int3
+  8003ae:	eb fd                	jmp    8003ad <_panic+0xa0>
+
+00000000008003b0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003b0:	55                   	push   %rbp
+  8003b1:	48 89 e5             	mov    %rsp,%rbp
+  8003b4:	53                   	push   %rbx
+  8003b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003bc:	8b 06                	mov    (%rsi),%eax
+  8003be:	8d 50 01             	lea    0x1(%rax),%edx
+  8003c1:	89 16                	mov    %edx,(%rsi)
+  8003c3:	48 98                	cltq
+  8003c5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003ca:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003d0:	74 0a                	je     8003dc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003d2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003da:	c9                   	leave
+  8003db:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003dc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003e0:	be ff 00 00 00       	mov    $0xff,%esi
+  8003e5:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8003ec:	00 00 00 
+  8003ef:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003f1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003f7:	eb d9                	jmp    8003d2 <putch+0x22>
+
+00000000008003f9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800404:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800407:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80040e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800413:	b8 00 00 00 00       	mov    $0x0,%eax
+  800418:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80041b:	48 89 f1             	mov    %rsi,%rcx
+  80041e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800425:	48 bf b0 03 80 00 00 	movabs $0x8003b0,%rdi
+  80042c:	00 00 00 
+  80042f:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800436:	00 00 00 
+  800439:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80043b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800442:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800449:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  800450:	00 00 00 
+  800453:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800455:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+000000000080045d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80045d:	55                   	push   %rbp
+  80045e:	48 89 e5             	mov    %rsp,%rbp
+  800461:	48 83 ec 50          	sub    $0x50,%rsp
+  800465:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800469:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80046d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800471:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800475:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800479:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800480:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800484:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800488:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80048c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800490:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800494:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  80049b:	00 00 00 
+  80049e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004a0:	c9                   	leave
+  8004a1:	c3                   	ret
+
+00000000008004a2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004a2:	55                   	push   %rbp
+  8004a3:	48 89 e5             	mov    %rsp,%rbp
+  8004a6:	41 57                	push   %r15
+  8004a8:	41 56                	push   %r14
+  8004aa:	41 55                	push   %r13
+  8004ac:	41 54                	push   %r12
+  8004ae:	53                   	push   %rbx
+  8004af:	48 83 ec 18          	sub    $0x18,%rsp
+  8004b3:	49 89 fc             	mov    %rdi,%r12
+  8004b6:	49 89 f5             	mov    %rsi,%r13
+  8004b9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004bd:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004c0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004c3:	41 89 cf             	mov    %ecx,%r15d
+  8004c6:	4c 39 fa             	cmp    %r15,%rdx
+  8004c9:	73 5b                	jae    800526 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004cb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004cf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004d3:	85 db                	test   %ebx,%ebx
+  8004d5:	7e 0e                	jle    8004e5 <print_num+0x43>
+            putch(padc, put_arg);
+  8004d7:	4c 89 ee             	mov    %r13,%rsi
+  8004da:	44 89 f7             	mov    %r14d,%edi
+  8004dd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004e0:	83 eb 01             	sub    $0x1,%ebx
+  8004e3:	75 f2                	jne    8004d7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004e5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004e9:	48 b9 cc 3a 80 00 00 	movabs $0x803acc,%rcx
+  8004f0:	00 00 00 
+  8004f3:	48 b8 bb 3a 80 00 00 	movabs $0x803abb,%rax
+  8004fa:	00 00 00 
+  8004fd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800501:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050a:	49 f7 f7             	div    %r15
+  80050d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	41 ff d4             	call   *%r12
+}
+  800517:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80051b:	5b                   	pop    %rbx
+  80051c:	41 5c                	pop    %r12
+  80051e:	41 5d                	pop    %r13
+  800520:	41 5e                	pop    %r14
+  800522:	41 5f                	pop    %r15
+  800524:	5d                   	pop    %rbp
+  800525:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800526:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80052a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052f:	49 f7 f7             	div    %r15
+  800532:	48 83 ec 08          	sub    $0x8,%rsp
+  800536:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80053a:	52                   	push   %rdx
+  80053b:	45 0f be c9          	movsbl %r9b,%r9d
+  80053f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800543:	48 89 c2             	mov    %rax,%rdx
+  800546:	48 b8 a2 04 80 00 00 	movabs $0x8004a2,%rax
+  80054d:	00 00 00 
+  800550:	ff d0                	call   *%rax
+  800552:	48 83 c4 10          	add    $0x10,%rsp
+  800556:	eb 8d                	jmp    8004e5 <print_num+0x43>
+
+0000000000800558 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800558:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80055c:	48 8b 06             	mov    (%rsi),%rax
+  80055f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800563:	73 0a                	jae    80056f <sprintputch+0x17>
+        *state->start++ = ch;
+  800565:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800569:	48 89 16             	mov    %rdx,(%rsi)
+  80056c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80056f:	c3                   	ret
+
+0000000000800570 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800570:	55                   	push   %rbp
+  800571:	48 89 e5             	mov    %rsp,%rbp
+  800574:	48 83 ec 50          	sub    $0x50,%rsp
+  800578:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80057c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800580:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800584:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80058b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800593:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800597:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80059b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059f:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+}
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+
+00000000008005ad <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005ad:	55                   	push   %rbp
+  8005ae:	48 89 e5             	mov    %rsp,%rbp
+  8005b1:	41 57                	push   %r15
+  8005b3:	41 56                	push   %r14
+  8005b5:	41 55                	push   %r13
+  8005b7:	41 54                	push   %r12
+  8005b9:	53                   	push   %rbx
+  8005ba:	48 83 ec 38          	sub    $0x38,%rsp
+  8005be:	49 89 fe             	mov    %rdi,%r14
+  8005c1:	49 89 f5             	mov    %rsi,%r13
+  8005c4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005c7:	48 8b 01             	mov    (%rcx),%rax
+  8005ca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005ce:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005de:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005e2:	0f b6 3b             	movzbl (%rbx),%edi
+  8005e5:	40 80 ff 25          	cmp    $0x25,%dil
+  8005e9:	74 18                	je     800603 <vprintfmt+0x56>
+            if (!ch) return;
+  8005eb:	40 84 ff             	test   %dil,%dil
+  8005ee:	0f 84 b1 06 00 00    	je     800ca5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005f4:	40 0f b6 ff          	movzbl %dil,%edi
+  8005f8:	4c 89 ee             	mov    %r13,%rsi
+  8005fb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005fe:	4c 89 e3             	mov    %r12,%rbx
+  800601:	eb db                	jmp    8005de <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800603:	be 00 00 00 00       	mov    $0x0,%esi
+  800608:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80060c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800611:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800617:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80061e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800622:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800627:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80062c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80062f:	83 e8 23             	sub    $0x23,%eax
+  800632:	3c 57                	cmp    $0x57,%al
+  800634:	0f 87 51 06 00 00    	ja     800c8b <vprintfmt+0x6de>
+  80063a:	0f b6 c0             	movzbl %al,%eax
+  80063d:	48 b9 60 3c 80 00 00 	movabs $0x803c60,%rcx
+  800644:	00 00 00 
+  800647:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80064a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80064d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800651:	eb cf                	jmp    800622 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800653:	49 89 dc             	mov    %rbx,%r12
+  800656:	be 01 00 00 00       	mov    $0x1,%esi
+  80065b:	eb c5                	jmp    800622 <vprintfmt+0x75>
+            padc = ch;
+  80065d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800661:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800664:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800667:	eb b9                	jmp    800622 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800669:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066c:	83 f8 2f             	cmp    $0x2f,%eax
+  80066f:	77 24                	ja     800695 <vprintfmt+0xe8>
+  800671:	89 c1                	mov    %eax,%ecx
+  800673:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800677:	83 c0 08             	add    $0x8,%eax
+  80067a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800680:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800683:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800687:	79 99                	jns    800622 <vprintfmt+0x75>
+                width = precision;
+  800689:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80068d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800693:	eb 8d                	jmp    800622 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800695:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800699:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80069d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a1:	eb da                	jmp    80067d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006a3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006a8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ac:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006b2:	3c 39                	cmp    $0x39,%al
+  8006b4:	77 1c                	ja     8006d2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006b6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006ba:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006be:	0f b6 c0             	movzbl %al,%eax
+  8006c1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006c6:	0f b6 03             	movzbl (%rbx),%eax
+  8006c9:	3c 39                	cmp    $0x39,%al
+  8006cb:	76 e9                	jbe    8006b6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006cd:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006d0:	eb b1                	jmp    800683 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006d2:	49 89 dc             	mov    %rbx,%r12
+  8006d5:	eb ac                	jmp    800683 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006d7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006da:	85 c9                	test   %ecx,%ecx
+  8006dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e1:	0f 49 c1             	cmovns %ecx,%eax
+  8006e4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006ea:	e9 33 ff ff ff       	jmp    800622 <vprintfmt+0x75>
+            lflag++;
+  8006ef:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006f5:	e9 28 ff ff ff       	jmp    800622 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800700:	77 19                	ja     80071b <vprintfmt+0x16e>
+  800702:	89 c2                	mov    %eax,%edx
+  800704:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800708:	83 c0 08             	add    $0x8,%eax
+  80070b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070e:	8b 3a                	mov    (%rdx),%edi
+  800710:	4c 89 ee             	mov    %r13,%rsi
+  800713:	41 ff d6             	call   *%r14
+            break;
+  800716:	e9 c3 fe ff ff       	jmp    8005de <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80071b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800723:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800727:	eb e5                	jmp    80070e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	77 5a                	ja     80078b <vprintfmt+0x1de>
+  800731:	89 c2                	mov    %eax,%edx
+  800733:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800737:	83 c0 08             	add    $0x8,%eax
+  80073a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80073d:	8b 02                	mov    (%rdx),%eax
+  80073f:	89 c1                	mov    %eax,%ecx
+  800741:	f7 d9                	neg    %ecx
+  800743:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800746:	83 f9 14             	cmp    $0x14,%ecx
+  800749:	7f 4e                	jg     800799 <vprintfmt+0x1ec>
+  80074b:	48 63 c1             	movslq %ecx,%rax
+  80074e:	48 ba 20 3f 80 00 00 	movabs $0x803f20,%rdx
+  800755:	00 00 00 
+  800758:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80075c:	48 85 c0             	test   %rax,%rax
+  80075f:	74 38                	je     800799 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800761:	48 89 c1             	mov    %rax,%rcx
+  800764:	48 ba f9 40 80 00 00 	movabs $0x8040f9,%rdx
+  80076b:	00 00 00 
+  80076e:	4c 89 ee             	mov    %r13,%rsi
+  800771:	4c 89 f7             	mov    %r14,%rdi
+  800774:	b8 00 00 00 00       	mov    $0x0,%eax
+  800779:	49 b8 70 05 80 00 00 	movabs $0x800570,%r8
+  800780:	00 00 00 
+  800783:	41 ff d0             	call   *%r8
+  800786:	e9 53 fe ff ff       	jmp    8005de <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80078b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	eb a4                	jmp    80073d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800799:	48 ba e4 3a 80 00 00 	movabs $0x803ae4,%rdx
+  8007a0:	00 00 00 
+  8007a3:	4c 89 ee             	mov    %r13,%rsi
+  8007a6:	4c 89 f7             	mov    %r14,%rdi
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	49 b8 70 05 80 00 00 	movabs $0x800570,%r8
+  8007b5:	00 00 00 
+  8007b8:	41 ff d0             	call   *%r8
+  8007bb:	e9 1e fe ff ff       	jmp    8005de <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 6c                	ja     800834 <vprintfmt+0x287>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007d7:	48 85 d2             	test   %rdx,%rdx
+  8007da:	48 b8 dd 3a 80 00 00 	movabs $0x803add,%rax
+  8007e1:	00 00 00 
+  8007e4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007e8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007f0:	7e 06                	jle    8007f8 <vprintfmt+0x24b>
+  8007f2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007f6:	75 4a                	jne    800842 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007f8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007fc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800800:	0f b6 00             	movzbl (%rax),%eax
+  800803:	84 c0                	test   %al,%al
+  800805:	0f 85 9a 00 00 00    	jne    8008a5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80080b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800812:	85 c0                	test   %eax,%eax
+  800814:	0f 8e c4 fd ff ff    	jle    8005de <vprintfmt+0x31>
+  80081a:	4c 89 ee             	mov    %r13,%rsi
+  80081d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800822:	41 ff d6             	call   *%r14
+  800825:	41 83 ec 01          	sub    $0x1,%r12d
+  800829:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80082d:	75 eb                	jne    80081a <vprintfmt+0x26d>
+  80082f:	e9 aa fd ff ff       	jmp    8005de <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800834:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800838:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800840:	eb 92                	jmp    8007d4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800842:	49 63 f7             	movslq %r15d,%rsi
+  800845:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800849:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  800850:	00 00 00 
+  800853:	ff d0                	call   *%rax
+  800855:	48 89 c2             	mov    %rax,%rdx
+  800858:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80085b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80085d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800860:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800863:	85 c0                	test   %eax,%eax
+  800865:	7e 91                	jle    8007f8 <vprintfmt+0x24b>
+  800867:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80086c:	4c 89 ee             	mov    %r13,%rsi
+  80086f:	44 89 e7             	mov    %r12d,%edi
+  800872:	41 ff d6             	call   *%r14
+  800875:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800879:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80087f:	75 eb                	jne    80086c <vprintfmt+0x2bf>
+  800881:	e9 72 ff ff ff       	jmp    8007f8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800886:	0f b6 f8             	movzbl %al,%edi
+  800889:	4c 89 ee             	mov    %r13,%rsi
+  80088c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80088f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800893:	49 83 c4 01          	add    $0x1,%r12
+  800897:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80089d:	84 c0                	test   %al,%al
+  80089f:	0f 84 66 ff ff ff    	je     80080b <vprintfmt+0x25e>
+  8008a5:	45 85 ff             	test   %r15d,%r15d
+  8008a8:	78 0a                	js     8008b4 <vprintfmt+0x307>
+  8008aa:	41 83 ef 01          	sub    $0x1,%r15d
+  8008ae:	0f 88 57 ff ff ff    	js     80080b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008b4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008b8:	74 cc                	je     800886 <vprintfmt+0x2d9>
+  8008ba:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008bd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008c2:	80 fa 5e             	cmp    $0x5e,%dl
+  8008c5:	77 c2                	ja     800889 <vprintfmt+0x2dc>
+  8008c7:	eb bd                	jmp    800886 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c9:	40 84 f6             	test   %sil,%sil
+  8008cc:	75 26                	jne    8008f4 <vprintfmt+0x347>
+    switch (lflag) {
+  8008ce:	85 d2                	test   %edx,%edx
+  8008d0:	74 59                	je     80092b <vprintfmt+0x37e>
+  8008d2:	83 fa 01             	cmp    $0x1,%edx
+  8008d5:	74 7b                	je     800952 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008da:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dd:	0f 87 96 00 00 00    	ja     800979 <vprintfmt+0x3cc>
+  8008e3:	89 c2                	mov    %eax,%edx
+  8008e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e9:	83 c0 08             	add    $0x8,%eax
+  8008ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ef:	4c 8b 22             	mov    (%rdx),%r12
+  8008f2:	eb 17                	jmp    80090b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fa:	77 21                	ja     80091d <vprintfmt+0x370>
+  8008fc:	89 c2                	mov    %eax,%edx
+  8008fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800902:	83 c0 08             	add    $0x8,%eax
+  800905:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800908:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80090b:	4d 85 e4             	test   %r12,%r12
+  80090e:	78 7a                	js     80098a <vprintfmt+0x3dd>
+            num = i;
+  800910:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800913:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800918:	e9 50 02 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800921:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800925:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800929:	eb dd                	jmp    800908 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80092b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092e:	83 f8 2f             	cmp    $0x2f,%eax
+  800931:	77 11                	ja     800944 <vprintfmt+0x397>
+  800933:	89 c2                	mov    %eax,%edx
+  800935:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800939:	83 c0 08             	add    $0x8,%eax
+  80093c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093f:	4c 63 22             	movslq (%rdx),%r12
+  800942:	eb c7                	jmp    80090b <vprintfmt+0x35e>
+  800944:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800948:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800950:	eb ed                	jmp    80093f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 11                	ja     80096b <vprintfmt+0x3be>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	4c 8b 22             	mov    (%rdx),%r12
+  800969:	eb a0                	jmp    80090b <vprintfmt+0x35e>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb ed                	jmp    800966 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800979:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800985:	e9 65 ff ff ff       	jmp    8008ef <vprintfmt+0x342>
+                putch('-', put_arg);
+  80098a:	4c 89 ee             	mov    %r13,%rsi
+  80098d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800992:	41 ff d6             	call   *%r14
+                i = -i;
+  800995:	49 f7 dc             	neg    %r12
+  800998:	e9 73 ff ff ff       	jmp    800910 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80099d:	40 84 f6             	test   %sil,%sil
+  8009a0:	75 32                	jne    8009d4 <vprintfmt+0x427>
+    switch (lflag) {
+  8009a2:	85 d2                	test   %edx,%edx
+  8009a4:	74 5d                	je     800a03 <vprintfmt+0x456>
+  8009a6:	83 fa 01             	cmp    $0x1,%edx
+  8009a9:	0f 84 82 00 00 00    	je     800a31 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	0f 87 a5 00 00 00    	ja     800a60 <vprintfmt+0x4b3>
+  8009bb:	89 c2                	mov    %eax,%edx
+  8009bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c1:	83 c0 08             	add    $0x8,%eax
+  8009c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009cf:	e9 99 01 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009da:	77 19                	ja     8009f5 <vprintfmt+0x448>
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e2:	83 c0 08             	add    $0x8,%eax
+  8009e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009eb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f0:	e9 78 01 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+  8009f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a01:	eb e5                	jmp    8009e8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 18                	ja     800a23 <vprintfmt+0x476>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a1e:	e9 4a 01 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+  800a23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2f:	eb e6                	jmp    800a17 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a34:	83 f8 2f             	cmp    $0x2f,%eax
+  800a37:	77 19                	ja     800a52 <vprintfmt+0x4a5>
+  800a39:	89 c2                	mov    %eax,%edx
+  800a3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3f:	83 c0 08             	add    $0x8,%eax
+  800a42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a45:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a4d:	e9 1b 01 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+  800a52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5e:	eb e5                	jmp    800a45 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	e9 56 ff ff ff       	jmp    8009c7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a71:	40 84 f6             	test   %sil,%sil
+  800a74:	75 2e                	jne    800aa4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a76:	85 d2                	test   %edx,%edx
+  800a78:	74 59                	je     800ad3 <vprintfmt+0x526>
+  800a7a:	83 fa 01             	cmp    $0x1,%edx
+  800a7d:	74 7f                	je     800afe <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a82:	83 f8 2f             	cmp    $0x2f,%eax
+  800a85:	0f 87 9f 00 00 00    	ja     800b2a <vprintfmt+0x57d>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a9a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a9f:	e9 c9 00 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	77 19                	ja     800ac5 <vprintfmt+0x518>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab2:	83 c0 08             	add    $0x8,%eax
+  800ab5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac0:	e9 a8 00 00 00       	jmp    800b6d <vprintfmt+0x5c0>
+  800ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad1:	eb e5                	jmp    800ab8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ad3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad9:	77 15                	ja     800af0 <vprintfmt+0x543>
+  800adb:	89 c2                	mov    %eax,%edx
+  800add:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae1:	83 c0 08             	add    $0x8,%eax
+  800ae4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ae9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aee:	eb 7d                	jmp    800b6d <vprintfmt+0x5c0>
+  800af0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afc:	eb e9                	jmp    800ae7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800afe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b01:	83 f8 2f             	cmp    $0x2f,%eax
+  800b04:	77 16                	ja     800b1c <vprintfmt+0x56f>
+  800b06:	89 c2                	mov    %eax,%edx
+  800b08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0c:	83 c0 08             	add    $0x8,%eax
+  800b0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b15:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b1a:	eb 51                	jmp    800b6d <vprintfmt+0x5c0>
+  800b1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b28:	eb e8                	jmp    800b12 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b36:	e9 5c ff ff ff       	jmp    800a97 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b3b:	4c 89 ee             	mov    %r13,%rsi
+  800b3e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b43:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b46:	4c 89 ee             	mov    %r13,%rsi
+  800b49:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b4e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b54:	83 f8 2f             	cmp    $0x2f,%eax
+  800b57:	77 47                	ja     800ba0 <vprintfmt+0x5f3>
+  800b59:	89 c2                	mov    %eax,%edx
+  800b5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5f:	83 c0 08             	add    $0x8,%eax
+  800b62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b68:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b6d:	48 83 ec 08          	sub    $0x8,%rsp
+  800b71:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b75:	0f 94 c0             	sete   %al
+  800b78:	0f b6 c0             	movzbl %al,%eax
+  800b7b:	50                   	push   %rax
+  800b7c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b81:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b85:	4c 89 ee             	mov    %r13,%rsi
+  800b88:	4c 89 f7             	mov    %r14,%rdi
+  800b8b:	48 b8 a2 04 80 00 00 	movabs $0x8004a2,%rax
+  800b92:	00 00 00 
+  800b95:	ff d0                	call   *%rax
+            break;
+  800b97:	48 83 c4 10          	add    $0x10,%rsp
+  800b9b:	e9 3e fa ff ff       	jmp    8005de <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ba0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bac:	eb b7                	jmp    800b65 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bae:	40 84 f6             	test   %sil,%sil
+  800bb1:	75 2b                	jne    800bde <vprintfmt+0x631>
+    switch (lflag) {
+  800bb3:	85 d2                	test   %edx,%edx
+  800bb5:	74 56                	je     800c0d <vprintfmt+0x660>
+  800bb7:	83 fa 01             	cmp    $0x1,%edx
+  800bba:	74 7f                	je     800c3b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc2:	0f 87 a2 00 00 00    	ja     800c6a <vprintfmt+0x6bd>
+  800bc8:	89 c2                	mov    %eax,%edx
+  800bca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bce:	83 c0 08             	add    $0x8,%eax
+  800bd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bdc:	eb 8f                	jmp    800b6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be1:	83 f8 2f             	cmp    $0x2f,%eax
+  800be4:	77 19                	ja     800bff <vprintfmt+0x652>
+  800be6:	89 c2                	mov    %eax,%edx
+  800be8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bec:	83 c0 08             	add    $0x8,%eax
+  800bef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bfa:	e9 6e ff ff ff       	jmp    800b6d <vprintfmt+0x5c0>
+  800bff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0b:	eb e5                	jmp    800bf2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c10:	83 f8 2f             	cmp    $0x2f,%eax
+  800c13:	77 18                	ja     800c2d <vprintfmt+0x680>
+  800c15:	89 c2                	mov    %eax,%edx
+  800c17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1b:	83 c0 08             	add    $0x8,%eax
+  800c1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c21:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c28:	e9 40 ff ff ff       	jmp    800b6d <vprintfmt+0x5c0>
+  800c2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c39:	eb e6                	jmp    800c21 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c41:	77 19                	ja     800c5c <vprintfmt+0x6af>
+  800c43:	89 c2                	mov    %eax,%edx
+  800c45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c49:	83 c0 08             	add    $0x8,%eax
+  800c4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c52:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c57:	e9 11 ff ff ff       	jmp    800b6d <vprintfmt+0x5c0>
+  800c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c68:	eb e5                	jmp    800c4f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c76:	e9 59 ff ff ff       	jmp    800bd4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c7b:	4c 89 ee             	mov    %r13,%rsi
+  800c7e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c83:	41 ff d6             	call   *%r14
+            break;
+  800c86:	e9 53 f9 ff ff       	jmp    8005de <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c8b:	4c 89 ee             	mov    %r13,%rsi
+  800c8e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c93:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c96:	48 83 eb 01          	sub    $0x1,%rbx
+  800c9a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c9e:	75 f6                	jne    800c96 <vprintfmt+0x6e9>
+  800ca0:	e9 39 f9 ff ff       	jmp    8005de <vprintfmt+0x31>
+}
+  800ca5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ca9:	5b                   	pop    %rbx
+  800caa:	41 5c                	pop    %r12
+  800cac:	41 5d                	pop    %r13
+  800cae:	41 5e                	pop    %r14
+  800cb0:	41 5f                	pop    %r15
+  800cb2:	5d                   	pop    %rbp
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cb4:	55                   	push   %rbp
+  800cb5:	48 89 e5             	mov    %rsp,%rbp
+  800cb8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cc0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cc5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cc9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cd0:	48 85 ff             	test   %rdi,%rdi
+  800cd3:	74 2b                	je     800d00 <vsnprintf+0x4c>
+  800cd5:	48 85 f6             	test   %rsi,%rsi
+  800cd8:	74 26                	je     800d00 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cda:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cde:	48 bf 58 05 80 00 00 	movabs $0x800558,%rdi
+  800ce5:	00 00 00 
+  800ce8:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800cef:	00 00 00 
+  800cf2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cfb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cfe:	c9                   	leave
+  800cff:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d05:	eb f7                	jmp    800cfe <vsnprintf+0x4a>
+
+0000000000800d07 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d07:	55                   	push   %rbp
+  800d08:	48 89 e5             	mov    %rsp,%rbp
+  800d0b:	48 83 ec 50          	sub    $0x50,%rsp
+  800d0f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d13:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d17:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d1b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d22:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d2e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d32:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d36:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  800d3d:	00 00 00 
+  800d40:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d42:	c9                   	leave
+  800d43:	c3                   	ret
+
+0000000000800d44 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d44:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d47:	74 10                	je     800d59 <strlen+0x15>
+    size_t n = 0;
+  800d49:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d4e:	48 83 c0 01          	add    $0x1,%rax
+  800d52:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d56:	75 f6                	jne    800d4e <strlen+0xa>
+  800d58:	c3                   	ret
+    size_t n = 0;
+  800d59:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d5e:	c3                   	ret
+
+0000000000800d5f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d5f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d62:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d67:	48 85 f6             	test   %rsi,%rsi
+  800d6a:	74 11                	je     800d7d <strnlen+0x1e>
+  800d6c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d70:	74 0c                	je     800d7e <strnlen+0x1f>
+  800d72:	48 83 c2 01          	add    $0x1,%rdx
+  800d76:	48 39 d0             	cmp    %rdx,%rax
+  800d79:	75 f1                	jne    800d6c <strnlen+0xd>
+  800d7b:	eb 04                	jmp    800d81 <strnlen+0x22>
+  800d7d:	c3                   	ret
+  800d7e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d81:	c3                   	ret
+
+0000000000800d82 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d82:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d8e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d91:	48 83 c2 01          	add    $0x1,%rdx
+  800d95:	84 c9                	test   %cl,%cl
+  800d97:	75 f1                	jne    800d8a <strcpy+0x8>
+        ;
+    return res;
+}
+  800d99:	c3                   	ret
+
+0000000000800d9a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d9a:	55                   	push   %rbp
+  800d9b:	48 89 e5             	mov    %rsp,%rbp
+  800d9e:	41 54                	push   %r12
+  800da0:	53                   	push   %rbx
+  800da1:	48 89 fb             	mov    %rdi,%rbx
+  800da4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800da7:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800db3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800db7:	4c 89 e6             	mov    %r12,%rsi
+  800dba:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800dc1:	00 00 00 
+  800dc4:	ff d0                	call   *%rax
+    return dst;
+}
+  800dc6:	48 89 d8             	mov    %rbx,%rax
+  800dc9:	5b                   	pop    %rbx
+  800dca:	41 5c                	pop    %r12
+  800dcc:	5d                   	pop    %rbp
+  800dcd:	c3                   	ret
+
+0000000000800dce <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dce:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dd1:	48 85 d2             	test   %rdx,%rdx
+  800dd4:	74 1f                	je     800df5 <strncpy+0x27>
+  800dd6:	48 01 fa             	add    %rdi,%rdx
+  800dd9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ddc:	48 83 c1 01          	add    $0x1,%rcx
+  800de0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800de4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800de8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dec:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800df0:	48 39 ca             	cmp    %rcx,%rdx
+  800df3:	75 e7                	jne    800ddc <strncpy+0xe>
+    }
+    return ret;
+}
+  800df5:	c3                   	ret
+
+0000000000800df6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800df6:	48 89 f8             	mov    %rdi,%rax
+  800df9:	48 85 d2             	test   %rdx,%rdx
+  800dfc:	74 24                	je     800e22 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dfe:	48 83 ea 01          	sub    $0x1,%rdx
+  800e02:	74 1b                	je     800e1f <strlcpy+0x29>
+  800e04:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e08:	0f b6 16             	movzbl (%rsi),%edx
+  800e0b:	84 d2                	test   %dl,%dl
+  800e0d:	74 10                	je     800e1f <strlcpy+0x29>
+            *dst++ = *src++;
+  800e0f:	48 83 c6 01          	add    $0x1,%rsi
+  800e13:	48 83 c0 01          	add    $0x1,%rax
+  800e17:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e1a:	48 39 c8             	cmp    %rcx,%rax
+  800e1d:	75 e9                	jne    800e08 <strlcpy+0x12>
+        *dst = '\0';
+  800e1f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e22:	48 29 f8             	sub    %rdi,%rax
+}
+  800e25:	c3                   	ret
+
+0000000000800e26 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e26:	0f b6 07             	movzbl (%rdi),%eax
+  800e29:	84 c0                	test   %al,%al
+  800e2b:	74 13                	je     800e40 <strcmp+0x1a>
+  800e2d:	38 06                	cmp    %al,(%rsi)
+  800e2f:	75 0f                	jne    800e40 <strcmp+0x1a>
+  800e31:	48 83 c7 01          	add    $0x1,%rdi
+  800e35:	48 83 c6 01          	add    $0x1,%rsi
+  800e39:	0f b6 07             	movzbl (%rdi),%eax
+  800e3c:	84 c0                	test   %al,%al
+  800e3e:	75 ed                	jne    800e2d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e40:	0f b6 c0             	movzbl %al,%eax
+  800e43:	0f b6 16             	movzbl (%rsi),%edx
+  800e46:	29 d0                	sub    %edx,%eax
+}
+  800e48:	c3                   	ret
+
+0000000000800e49 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e49:	48 85 d2             	test   %rdx,%rdx
+  800e4c:	74 1f                	je     800e6d <strncmp+0x24>
+  800e4e:	0f b6 07             	movzbl (%rdi),%eax
+  800e51:	84 c0                	test   %al,%al
+  800e53:	74 1e                	je     800e73 <strncmp+0x2a>
+  800e55:	3a 06                	cmp    (%rsi),%al
+  800e57:	75 1a                	jne    800e73 <strncmp+0x2a>
+  800e59:	48 83 c7 01          	add    $0x1,%rdi
+  800e5d:	48 83 c6 01          	add    $0x1,%rsi
+  800e61:	48 83 ea 01          	sub    $0x1,%rdx
+  800e65:	75 e7                	jne    800e4e <strncmp+0x5>
+
+    if (!n) return 0;
+  800e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6c:	c3                   	ret
+  800e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e72:	c3                   	ret
+  800e73:	48 85 d2             	test   %rdx,%rdx
+  800e76:	74 09                	je     800e81 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e78:	0f b6 07             	movzbl (%rdi),%eax
+  800e7b:	0f b6 16             	movzbl (%rsi),%edx
+  800e7e:	29 d0                	sub    %edx,%eax
+  800e80:	c3                   	ret
+    if (!n) return 0;
+  800e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e86:	c3                   	ret
+
+0000000000800e87 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e87:	0f b6 17             	movzbl (%rdi),%edx
+  800e8a:	84 d2                	test   %dl,%dl
+  800e8c:	74 18                	je     800ea6 <strchr+0x1f>
+        if (*str == c) {
+  800e8e:	0f be d2             	movsbl %dl,%edx
+  800e91:	39 f2                	cmp    %esi,%edx
+  800e93:	74 17                	je     800eac <strchr+0x25>
+    for (; *str; str++) {
+  800e95:	48 83 c7 01          	add    $0x1,%rdi
+  800e99:	0f b6 17             	movzbl (%rdi),%edx
+  800e9c:	84 d2                	test   %dl,%dl
+  800e9e:	75 ee                	jne    800e8e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea5:	c3                   	ret
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eab:	c3                   	ret
+  800eac:	48 89 f8             	mov    %rdi,%rax
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eb0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eb3:	0f b6 17             	movzbl (%rdi),%edx
+  800eb6:	84 d2                	test   %dl,%dl
+  800eb8:	74 13                	je     800ecd <strfind+0x1d>
+  800eba:	0f be d2             	movsbl %dl,%edx
+  800ebd:	39 f2                	cmp    %esi,%edx
+  800ebf:	74 0b                	je     800ecc <strfind+0x1c>
+  800ec1:	48 83 c0 01          	add    $0x1,%rax
+  800ec5:	0f b6 10             	movzbl (%rax),%edx
+  800ec8:	84 d2                	test   %dl,%dl
+  800eca:	75 ee                	jne    800eba <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ecc:	c3                   	ret
+  800ecd:	c3                   	ret
+
+0000000000800ece <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ece:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ed1:	48 89 f8             	mov    %rdi,%rax
+  800ed4:	48 f7 d8             	neg    %rax
+  800ed7:	83 e0 07             	and    $0x7,%eax
+  800eda:	49 89 d1             	mov    %rdx,%r9
+  800edd:	49 29 c1             	sub    %rax,%r9
+  800ee0:	78 36                	js     800f18 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ee2:	40 0f b6 c6          	movzbl %sil,%eax
+  800ee6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eed:	01 01 01 
+  800ef0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ef4:	40 f6 c7 07          	test   $0x7,%dil
+  800ef8:	75 38                	jne    800f32 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800efa:	4c 89 c9             	mov    %r9,%rcx
+  800efd:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f01:	74 0c                	je     800f0f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f03:	fc                   	cld
+  800f04:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f07:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f0b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f0f:	4d 85 c9             	test   %r9,%r9
+  800f12:	75 45                	jne    800f59 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f14:	4c 89 c0             	mov    %r8,%rax
+  800f17:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f18:	48 85 d2             	test   %rdx,%rdx
+  800f1b:	74 f7                	je     800f14 <memset+0x46>
+  800f1d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f20:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f23:	48 83 c0 01          	add    $0x1,%rax
+  800f27:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f2b:	48 39 c2             	cmp    %rax,%rdx
+  800f2e:	75 f3                	jne    800f23 <memset+0x55>
+  800f30:	eb e2                	jmp    800f14 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f32:	40 f6 c7 01          	test   $0x1,%dil
+  800f36:	74 06                	je     800f3e <memset+0x70>
+  800f38:	88 07                	mov    %al,(%rdi)
+  800f3a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f3e:	40 f6 c7 02          	test   $0x2,%dil
+  800f42:	74 07                	je     800f4b <memset+0x7d>
+  800f44:	66 89 07             	mov    %ax,(%rdi)
+  800f47:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f4b:	40 f6 c7 04          	test   $0x4,%dil
+  800f4f:	74 a9                	je     800efa <memset+0x2c>
+  800f51:	89 07                	mov    %eax,(%rdi)
+  800f53:	48 83 c7 04          	add    $0x4,%rdi
+  800f57:	eb a1                	jmp    800efa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f59:	41 f6 c1 04          	test   $0x4,%r9b
+  800f5d:	74 06                	je     800f65 <memset+0x97>
+  800f5f:	89 07                	mov    %eax,(%rdi)
+  800f61:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f65:	41 f6 c1 02          	test   $0x2,%r9b
+  800f69:	74 07                	je     800f72 <memset+0xa4>
+  800f6b:	66 89 07             	mov    %ax,(%rdi)
+  800f6e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f72:	41 f6 c1 01          	test   $0x1,%r9b
+  800f76:	74 9c                	je     800f14 <memset+0x46>
+  800f78:	88 07                	mov    %al,(%rdi)
+  800f7a:	eb 98                	jmp    800f14 <memset+0x46>
+
+0000000000800f7c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f7c:	48 89 f8             	mov    %rdi,%rax
+  800f7f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f82:	48 39 fe             	cmp    %rdi,%rsi
+  800f85:	73 3b                	jae    800fc2 <memmove+0x46>
+  800f87:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f8b:	48 39 d7             	cmp    %rdx,%rdi
+  800f8e:	73 32                	jae    800fc2 <memmove+0x46>
+        s += n;
+        d += n;
+  800f90:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f94:	48 89 d6             	mov    %rdx,%rsi
+  800f97:	48 09 fe             	or     %rdi,%rsi
+  800f9a:	48 09 ce             	or     %rcx,%rsi
+  800f9d:	40 f6 c6 07          	test   $0x7,%sil
+  800fa1:	75 12                	jne    800fb5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fa3:	48 83 ef 08          	sub    $0x8,%rdi
+  800fa7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fab:	48 c1 e9 03          	shr    $0x3,%rcx
+  800faf:	fd                   	std
+  800fb0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fb3:	fc                   	cld
+  800fb4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fb5:	48 83 ef 01          	sub    $0x1,%rdi
+  800fb9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fbd:	fd                   	std
+  800fbe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fc0:	eb f1                	jmp    800fb3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc2:	48 89 f2             	mov    %rsi,%rdx
+  800fc5:	48 09 c2             	or     %rax,%rdx
+  800fc8:	48 09 ca             	or     %rcx,%rdx
+  800fcb:	f6 c2 07             	test   $0x7,%dl
+  800fce:	75 0c                	jne    800fdc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fd0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd4:	48 89 c7             	mov    %rax,%rdi
+  800fd7:	fc                   	cld
+  800fd8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fdb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fdc:	48 89 c7             	mov    %rax,%rdi
+  800fdf:	fc                   	cld
+  800fe0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fe2:	c3                   	ret
+
+0000000000800fe3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fe3:	55                   	push   %rbp
+  800fe4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fe7:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  800fee:	00 00 00 
+  800ff1:	ff d0                	call   *%rax
+}
+  800ff3:	5d                   	pop    %rbp
+  800ff4:	c3                   	ret
+
+0000000000800ff5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ff5:	55                   	push   %rbp
+  800ff6:	48 89 e5             	mov    %rsp,%rbp
+  800ff9:	41 57                	push   %r15
+  800ffb:	41 56                	push   %r14
+  800ffd:	41 55                	push   %r13
+  800fff:	41 54                	push   %r12
+  801001:	53                   	push   %rbx
+  801002:	48 83 ec 08          	sub    $0x8,%rsp
+  801006:	49 89 fe             	mov    %rdi,%r14
+  801009:	49 89 f7             	mov    %rsi,%r15
+  80100c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80100f:	48 89 f7             	mov    %rsi,%rdi
+  801012:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  801019:	00 00 00 
+  80101c:	ff d0                	call   *%rax
+  80101e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801021:	48 89 de             	mov    %rbx,%rsi
+  801024:	4c 89 f7             	mov    %r14,%rdi
+  801027:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  80102e:	00 00 00 
+  801031:	ff d0                	call   *%rax
+  801033:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801036:	48 39 c3             	cmp    %rax,%rbx
+  801039:	74 36                	je     801071 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80103b:	48 89 d8             	mov    %rbx,%rax
+  80103e:	4c 29 e8             	sub    %r13,%rax
+  801041:	49 39 c4             	cmp    %rax,%r12
+  801044:	73 31                	jae    801077 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801046:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80104b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80104f:	4c 89 fe             	mov    %r15,%rsi
+  801052:	48 b8 e3 0f 80 00 00 	movabs $0x800fe3,%rax
+  801059:	00 00 00 
+  80105c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80105e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801062:	48 83 c4 08          	add    $0x8,%rsp
+  801066:	5b                   	pop    %rbx
+  801067:	41 5c                	pop    %r12
+  801069:	41 5d                	pop    %r13
+  80106b:	41 5e                	pop    %r14
+  80106d:	41 5f                	pop    %r15
+  80106f:	5d                   	pop    %rbp
+  801070:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801071:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801075:	eb eb                	jmp    801062 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801077:	48 83 eb 01          	sub    $0x1,%rbx
+  80107b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80107f:	48 89 da             	mov    %rbx,%rdx
+  801082:	4c 89 fe             	mov    %r15,%rsi
+  801085:	48 b8 e3 0f 80 00 00 	movabs $0x800fe3,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801091:	49 01 de             	add    %rbx,%r14
+  801094:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801099:	eb c3                	jmp    80105e <strlcat+0x69>
+
+000000000080109b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80109b:	48 85 d2             	test   %rdx,%rdx
+  80109e:	74 2d                	je     8010cd <memcmp+0x32>
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010a5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010a9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010ae:	44 38 c1             	cmp    %r8b,%cl
+  8010b1:	75 0f                	jne    8010c2 <memcmp+0x27>
+    while (n-- > 0) {
+  8010b3:	48 83 c0 01          	add    $0x1,%rax
+  8010b7:	48 39 c2             	cmp    %rax,%rdx
+  8010ba:	75 e9                	jne    8010a5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010c2:	0f b6 c1             	movzbl %cl,%eax
+  8010c5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010c9:	44 29 c0             	sub    %r8d,%eax
+  8010cc:	c3                   	ret
+    return 0;
+  8010cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d2:	c3                   	ret
+
+00000000008010d3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010d3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010d7:	48 39 c7             	cmp    %rax,%rdi
+  8010da:	73 0f                	jae    8010eb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010dc:	40 38 37             	cmp    %sil,(%rdi)
+  8010df:	74 0e                	je     8010ef <memfind+0x1c>
+    for (; src < end; src++) {
+  8010e1:	48 83 c7 01          	add    $0x1,%rdi
+  8010e5:	48 39 f8             	cmp    %rdi,%rax
+  8010e8:	75 f2                	jne    8010dc <memfind+0x9>
+  8010ea:	c3                   	ret
+  8010eb:	48 89 f8             	mov    %rdi,%rax
+  8010ee:	c3                   	ret
+  8010ef:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010f2:	c3                   	ret
+
+00000000008010f3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010f3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010f6:	0f b6 37             	movzbl (%rdi),%esi
+  8010f9:	40 80 fe 20          	cmp    $0x20,%sil
+  8010fd:	74 06                	je     801105 <strtol+0x12>
+  8010ff:	40 80 fe 09          	cmp    $0x9,%sil
+  801103:	75 13                	jne    801118 <strtol+0x25>
+  801105:	48 83 c7 01          	add    $0x1,%rdi
+  801109:	0f b6 37             	movzbl (%rdi),%esi
+  80110c:	40 80 fe 20          	cmp    $0x20,%sil
+  801110:	74 f3                	je     801105 <strtol+0x12>
+  801112:	40 80 fe 09          	cmp    $0x9,%sil
+  801116:	74 ed                	je     801105 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801118:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80111b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80111e:	3c 01                	cmp    $0x1,%al
+  801120:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801124:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80112a:	75 0f                	jne    80113b <strtol+0x48>
+  80112c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80112f:	74 14                	je     801145 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801131:	85 d2                	test   %edx,%edx
+  801133:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801138:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80113b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801140:	4c 63 ca             	movslq %edx,%r9
+  801143:	eb 36                	jmp    80117b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801145:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801149:	74 0f                	je     80115a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80114b:	85 d2                	test   %edx,%edx
+  80114d:	75 ec                	jne    80113b <strtol+0x48>
+        s++;
+  80114f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801153:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801158:	eb e1                	jmp    80113b <strtol+0x48>
+        s += 2;
+  80115a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80115e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801163:	eb d6                	jmp    80113b <strtol+0x48>
+            dig -= '0';
+  801165:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801168:	44 0f b6 c1          	movzbl %cl,%r8d
+  80116c:	41 39 d0             	cmp    %edx,%r8d
+  80116f:	7d 21                	jge    801192 <strtol+0x9f>
+        val = val * base + dig;
+  801171:	49 0f af c1          	imul   %r9,%rax
+  801175:	0f b6 c9             	movzbl %cl,%ecx
+  801178:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80117b:	48 83 c7 01          	add    $0x1,%rdi
+  80117f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801183:	80 f9 39             	cmp    $0x39,%cl
+  801186:	76 dd                	jbe    801165 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801188:	80 f9 7b             	cmp    $0x7b,%cl
+  80118b:	77 05                	ja     801192 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80118d:	83 e9 57             	sub    $0x57,%ecx
+  801190:	eb d6                	jmp    801168 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801192:	4d 85 d2             	test   %r10,%r10
+  801195:	74 03                	je     80119a <strtol+0xa7>
+  801197:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80119a:	48 89 c2             	mov    %rax,%rdx
+  80119d:	48 f7 da             	neg    %rdx
+  8011a0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011a4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011a8:	c3                   	ret
+
+00000000008011a9 <strrev>:
+
+void
+strrev(char *str)
+{
+  8011a9:	55                   	push   %rbp
+  8011aa:	48 89 e5             	mov    %rsp,%rbp
+  8011ad:	53                   	push   %rbx
+  8011ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b2:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8011b5:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  8011bc:	00 00 00 
+  8011bf:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8011c1:	83 e8 01             	sub    $0x1,%eax
+  8011c4:	85 c0                	test   %eax,%eax
+  8011c6:	7e 22                	jle    8011ea <strrev+0x41>
+  8011c8:	48 98                	cltq
+  8011ca:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8011cf:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8011d3:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8011d7:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8011db:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8011de:	48 83 c2 01          	add    $0x1,%rdx
+  8011e2:	48 83 e8 01          	sub    $0x1,%rax
+  8011e6:	39 c2                	cmp    %eax,%edx
+  8011e8:	7c e5                	jl     8011cf <strrev+0x26>
+	}
+}
+  8011ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ee:	c9                   	leave
+  8011ef:	c3                   	ret
+
+00000000008011f0 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8011f0:	85 d2                	test   %edx,%edx
+  8011f2:	0f 84 80 00 00 00    	je     801278 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+  8011fc:	53                   	push   %rbx
+  8011fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801201:	49 89 f2             	mov    %rsi,%r10
+  801204:	41 89 d3             	mov    %edx,%r11d
+  801207:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  80120a:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80120f:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801212:	eb 20                	jmp    801234 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801214:	41 89 f1             	mov    %esi,%r9d
+  801217:	83 c2 30             	add    $0x30,%edx
+  80121a:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80121d:	89 f8                	mov    %edi,%eax
+  80121f:	99                   	cltd
+  801220:	f7 f9                	idiv   %ecx
+  801222:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801224:	85 c0                	test   %eax,%eax
+  801226:	74 2e                	je     801256 <itoa+0x66>
+  801228:	83 c6 01             	add    $0x1,%esi
+  80122b:	49 83 c0 01          	add    $0x1,%r8
+  80122f:	44 39 cb             	cmp    %r9d,%ebx
+  801232:	7e 15                	jle    801249 <itoa+0x59>
+		digit = sum % base;
+  801234:	89 f8                	mov    %edi,%eax
+  801236:	99                   	cltd
+  801237:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801239:	83 fa 09             	cmp    $0x9,%edx
+  80123c:	7e d6                	jle    801214 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80123e:	41 89 f1             	mov    %esi,%r9d
+  801241:	83 c2 37             	add    $0x37,%edx
+  801244:	41 88 10             	mov    %dl,(%r8)
+  801247:	eb d4                	jmp    80121d <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801249:	41 83 eb 01          	sub    $0x1,%r11d
+  80124d:	45 39 cb             	cmp    %r9d,%r11d
+  801250:	75 04                	jne    801256 <itoa+0x66>
+  801252:	85 c0                	test   %eax,%eax
+  801254:	75 28                	jne    80127e <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801256:	4d 63 c9             	movslq %r9d,%r9
+  801259:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80125e:	4c 89 d7             	mov    %r10,%rdi
+  801261:	48 b8 a9 11 80 00 00 	movabs $0x8011a9,%rax
+  801268:	00 00 00 
+  80126b:	ff d0                	call   *%rax
+	return 0;
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801272:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+		return -1;
+  801278:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80127d:	c3                   	ret
+		return -1;
+  80127e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801283:	eb ed                	jmp    801272 <itoa+0x82>
+
+0000000000801285 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+  80128a:	48 89 fa             	mov    %rdi,%rdx
+  80128d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801290:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012aa:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b0:	c9                   	leave
+  8012b1:	c3                   	ret
+
+00000000008012b2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+  8012b6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012db:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e1:	c9                   	leave
+  8012e2:	c3                   	ret
+
+00000000008012e3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012e3:	55                   	push   %rbp
+  8012e4:	48 89 e5             	mov    %rsp,%rbp
+  8012e7:	53                   	push   %rbx
+  8012e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012ec:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ef:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801303:	be 00 00 00 00       	mov    $0x0,%esi
+  801308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801310:	48 85 c0             	test   %rax,%rax
+  801313:	7f 06                	jg     80131b <sys_env_destroy+0x38>
+}
+  801315:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131b:	49 89 c0             	mov    %rax,%r8
+  80131e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801323:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  80132a:	00 00 00 
+  80132d:	be 26 00 00 00       	mov    $0x26,%esi
+  801332:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  801339:	00 00 00 
+  80133c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801341:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  801348:	00 00 00 
+  80134b:	41 ff d1             	call   *%r9
+
+000000000080134e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80134e:	55                   	push   %rbp
+  80134f:	48 89 e5             	mov    %rsp,%rbp
+  801352:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801353:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801358:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801362:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801367:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801377:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801379:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+
+000000000080137f <sys_yield>:
+
+void
+sys_yield(void) {
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801384:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801398:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139d:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ae:	c9                   	leave
+  8013af:	c3                   	ret
+
+00000000008013b0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013b0:	55                   	push   %rbp
+  8013b1:	48 89 e5             	mov    %rsp,%rbp
+  8013b4:	53                   	push   %rbx
+  8013b5:	48 89 fa             	mov    %rdi,%rdx
+  8013b8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013c7:	00 00 00 
+  8013ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013da:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e0:	c9                   	leave
+  8013e1:	c3                   	ret
+
+00000000008013e2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+  8013e6:	53                   	push   %rbx
+  8013e7:	49 89 f8             	mov    %rdi,%r8
+  8013ea:	48 89 d3             	mov    %rdx,%rbx
+  8013ed:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f5:	4c 89 c2             	mov    %r8,%rdx
+  8013f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801406:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801408:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140c:	c9                   	leave
+  80140d:	c3                   	ret
+
+000000000080140e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	53                   	push   %rbx
+  801413:	48 83 ec 08          	sub    $0x8,%rsp
+  801417:	89 f8                	mov    %edi,%eax
+  801419:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80141c:	48 63 f9             	movslq %ecx,%rdi
+  80141f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801427:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801435:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801437:	48 85 c0             	test   %rax,%rax
+  80143a:	7f 06                	jg     801442 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80143c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801442:	49 89 c0             	mov    %rax,%r8
+  801445:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80144a:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  801451:	00 00 00 
+  801454:	be 26 00 00 00       	mov    $0x26,%esi
+  801459:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  801460:	00 00 00 
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  80146f:	00 00 00 
+  801472:	41 ff d1             	call   *%r9
+
+0000000000801475 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	53                   	push   %rbx
+  80147a:	48 83 ec 08          	sub    $0x8,%rsp
+  80147e:	89 f8                	mov    %edi,%eax
+  801480:	49 89 f2             	mov    %rsi,%r10
+  801483:	48 89 cf             	mov    %rcx,%rdi
+  801486:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801489:	48 63 da             	movslq %edx,%rbx
+  80148c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801494:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801497:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80149a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149c:	48 85 c0             	test   %rax,%rax
+  80149f:	7f 06                	jg     8014a7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a5:	c9                   	leave
+  8014a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a7:	49 89 c0             	mov    %rax,%r8
+  8014aa:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014af:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  8014b6:	00 00 00 
+  8014b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014be:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  8014c5:	00 00 00 
+  8014c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cd:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  8014d4:	00 00 00 
+  8014d7:	41 ff d1             	call   *%r9
+
+00000000008014da <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014da:	55                   	push   %rbp
+  8014db:	48 89 e5             	mov    %rsp,%rbp
+  8014de:	53                   	push   %rbx
+  8014df:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e3:	48 89 f1             	mov    %rsi,%rcx
+  8014e6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ec:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	7f 06                	jg     80150e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150c:	c9                   	leave
+  80150d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150e:	49 89 c0             	mov    %rax,%r8
+  801511:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801516:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  80151d:	00 00 00 
+  801520:	be 26 00 00 00       	mov    $0x26,%esi
+  801525:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  80153b:	00 00 00 
+  80153e:	41 ff d1             	call   *%r9
+
+0000000000801541 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+  801546:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80154a:	48 63 ce             	movslq %esi,%rcx
+  80154d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801550:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801555:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155f:	be 00 00 00 00       	mov    $0x0,%esi
+  801564:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156c:	48 85 c0             	test   %rax,%rax
+  80156f:	7f 06                	jg     801577 <sys_env_set_status+0x36>
+}
+  801571:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801575:	c9                   	leave
+  801576:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801577:	49 89 c0             	mov    %rax,%r8
+  80157a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80157f:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  801586:	00 00 00 
+  801589:	be 26 00 00 00       	mov    $0x26,%esi
+  80158e:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  801595:	00 00 00 
+  801598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159d:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  8015a4:	00 00 00 
+  8015a7:	41 ff d1             	call   *%r9
+
+00000000008015aa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015aa:	55                   	push   %rbp
+  8015ab:	48 89 e5             	mov    %rsp,%rbp
+  8015ae:	53                   	push   %rbx
+  8015af:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015b6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d5:	48 85 c0             	test   %rax,%rax
+  8015d8:	7f 06                	jg     8015e0 <sys_env_set_trapframe+0x36>
+}
+  8015da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e0:	49 89 c0             	mov    %rax,%r8
+  8015e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015e8:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  8015ef:	00 00 00 
+  8015f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015f7:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  8015fe:	00 00 00 
+  801601:	b8 00 00 00 00       	mov    $0x0,%eax
+  801606:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  80160d:	00 00 00 
+  801610:	41 ff d1             	call   *%r9
+
+0000000000801613 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801613:	55                   	push   %rbp
+  801614:	48 89 e5             	mov    %rsp,%rbp
+  801617:	53                   	push   %rbx
+  801618:	48 83 ec 08          	sub    $0x8,%rsp
+  80161c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80161f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801622:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801627:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80163e:	48 85 c0             	test   %rax,%rax
+  801641:	7f 06                	jg     801649 <sys_env_set_pgfault_upcall+0x36>
+}
+  801643:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801649:	49 89 c0             	mov    %rax,%r8
+  80164c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801651:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  801658:	00 00 00 
+  80165b:	be 26 00 00 00       	mov    $0x26,%esi
+  801660:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  801667:	00 00 00 
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  801676:	00 00 00 
+  801679:	41 ff d1             	call   *%r9
+
+000000000080167c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	53                   	push   %rbx
+  801681:	89 f8                	mov    %edi,%eax
+  801683:	49 89 f1             	mov    %rsi,%r9
+  801686:	48 89 d3             	mov    %rdx,%rbx
+  801689:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80168c:	49 63 f0             	movslq %r8d,%rsi
+  80168f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801692:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801697:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a0:	cd 30                	int    $0x30
+}
+  8016a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+
+00000000008016a8 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+  8016ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b1:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8016b4:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016bc:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d1:	48 85 c0             	test   %rax,%rax
+  8016d4:	7f 06                	jg     8016dc <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dc:	49 89 c0             	mov    %rax,%r8
+  8016df:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016e4:	48 ba e8 3f 80 00 00 	movabs $0x803fe8,%rdx
+  8016eb:	00 00 00 
+  8016ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f3:	48 bf 07 40 80 00 00 	movabs $0x804007,%rdi
+  8016fa:	00 00 00 
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801702:	49 b9 0d 03 80 00 00 	movabs $0x80030d,%r9
+  801709:	00 00 00 
+  80170c:	41 ff d1             	call   *%r9
+
+000000000080170f <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801713:	ba 00 00 00 00       	mov    $0x0,%edx
+  801718:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  80171f:	00 00 00 
+  801722:	ff d0                	call   *%rax
+}
+  801724:	5d                   	pop    %rbp
+  801725:	c3                   	ret
+
+0000000000801726 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801726:	55                   	push   %rbp
+  801727:	48 89 e5             	mov    %rsp,%rbp
+  80172a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801730:	ba 00 00 00 00       	mov    $0x0,%edx
+  801735:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801744:	be 00 00 00 00       	mov    $0x0,%esi
+  801749:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801751:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801755:	c9                   	leave
+  801756:	c3                   	ret
+
+0000000000801757 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801757:	55                   	push   %rbp
+  801758:	48 89 e5             	mov    %rsp,%rbp
+  80175b:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80175c:	48 63 ce             	movslq %esi,%rcx
+  80175f:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801763:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801768:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801772:	be 00 00 00 00       	mov    $0x0,%esi
+  801777:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80177d:	cd 30                	int    $0x30
+}
+  80177f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801783:	c9                   	leave
+  801784:	c3                   	ret
+
+0000000000801785 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801785:	55                   	push   %rbp
+  801786:	48 89 e5             	mov    %rsp,%rbp
+  801789:	53                   	push   %rbx
+  80178a:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80178d:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801791:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801796:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ab:	cd 30                	int    $0x30
+}
+  8017ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+00000000008017b3 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	53                   	push   %rbx
+  8017b8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8017bb:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017be:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c3:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d6:	cd 30                	int    $0x30
+}
+  8017d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017de:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017e5:	ff ff ff 
+  8017e8:	48 01 f8             	add    %rdi,%rax
+  8017eb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017ef:	c3                   	ret
+
+00000000008017f0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017f0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017f7:	ff ff ff 
+  8017fa:	48 01 f8             	add    %rdi,%rax
+  8017fd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801801:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801807:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80180b:	c3                   	ret
+
+000000000080180c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80180c:	55                   	push   %rbp
+  80180d:	48 89 e5             	mov    %rsp,%rbp
+  801810:	41 57                	push   %r15
+  801812:	41 56                	push   %r14
+  801814:	41 55                	push   %r13
+  801816:	41 54                	push   %r12
+  801818:	53                   	push   %rbx
+  801819:	48 83 ec 08          	sub    $0x8,%rsp
+  80181d:	49 89 ff             	mov    %rdi,%r15
+  801820:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801825:	49 bd cf 34 80 00 00 	movabs $0x8034cf,%r13
+  80182c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80182f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801835:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801838:	48 89 df             	mov    %rbx,%rdi
+  80183b:	41 ff d5             	call   *%r13
+  80183e:	83 e0 04             	and    $0x4,%eax
+  801841:	74 17                	je     80185a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801843:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80184a:	4c 39 f3             	cmp    %r14,%rbx
+  80184d:	75 e6                	jne    801835 <fd_alloc+0x29>
+  80184f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801855:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80185a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80185d:	48 83 c4 08          	add    $0x8,%rsp
+  801861:	5b                   	pop    %rbx
+  801862:	41 5c                	pop    %r12
+  801864:	41 5d                	pop    %r13
+  801866:	41 5e                	pop    %r14
+  801868:	41 5f                	pop    %r15
+  80186a:	5d                   	pop    %rbp
+  80186b:	c3                   	ret
+
+000000000080186c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80186c:	83 ff 1f             	cmp    $0x1f,%edi
+  80186f:	77 39                	ja     8018aa <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+  801875:	41 54                	push   %r12
+  801877:	53                   	push   %rbx
+  801878:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80187b:	48 63 df             	movslq %edi,%rbx
+  80187e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801885:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801889:	48 89 df             	mov    %rbx,%rdi
+  80188c:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+  801898:	a8 04                	test   $0x4,%al
+  80189a:	74 14                	je     8018b0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80189c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a5:	5b                   	pop    %rbx
+  8018a6:	41 5c                	pop    %r12
+  8018a8:	5d                   	pop    %rbp
+  8018a9:	c3                   	ret
+        return -E_INVAL;
+  8018aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018af:	c3                   	ret
+        return -E_INVAL;
+  8018b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b5:	eb ee                	jmp    8018a5 <fd_lookup+0x39>
+
+00000000008018b7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018b7:	55                   	push   %rbp
+  8018b8:	48 89 e5             	mov    %rsp,%rbp
+  8018bb:	41 54                	push   %r12
+  8018bd:	53                   	push   %rbx
+  8018be:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018c1:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  8018c8:	00 00 00 
+  8018cb:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8018d2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018d5:	39 3b                	cmp    %edi,(%rbx)
+  8018d7:	74 47                	je     801920 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018d9:	48 83 c0 08          	add    $0x8,%rax
+  8018dd:	48 8b 18             	mov    (%rax),%rbx
+  8018e0:	48 85 db             	test   %rbx,%rbx
+  8018e3:	75 f0                	jne    8018d5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018e5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8018ec:	00 00 00 
+  8018ef:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018f5:	89 fa                	mov    %edi,%edx
+  8018f7:	48 bf 18 40 80 00 00 	movabs $0x804018,%rdi
+  8018fe:	00 00 00 
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	48 b9 5d 04 80 00 00 	movabs $0x80045d,%rcx
+  80190d:	00 00 00 
+  801910:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801917:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80191b:	5b                   	pop    %rbx
+  80191c:	41 5c                	pop    %r12
+  80191e:	5d                   	pop    %rbp
+  80191f:	c3                   	ret
+            return 0;
+  801920:	b8 00 00 00 00       	mov    $0x0,%eax
+  801925:	eb f0                	jmp    801917 <dev_lookup+0x60>
+
+0000000000801927 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801927:	55                   	push   %rbp
+  801928:	48 89 e5             	mov    %rsp,%rbp
+  80192b:	41 55                	push   %r13
+  80192d:	41 54                	push   %r12
+  80192f:	53                   	push   %rbx
+  801930:	48 83 ec 18          	sub    $0x18,%rsp
+  801934:	48 89 fb             	mov    %rdi,%rbx
+  801937:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80193a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801941:	ff ff ff 
+  801944:	48 01 df             	add    %rbx,%rdi
+  801947:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80194b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80194f:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801956:	00 00 00 
+  801959:	ff d0                	call   *%rax
+  80195b:	41 89 c5             	mov    %eax,%r13d
+  80195e:	85 c0                	test   %eax,%eax
+  801960:	78 06                	js     801968 <fd_close+0x41>
+  801962:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801966:	74 1a                	je     801982 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801968:	45 84 e4             	test   %r12b,%r12b
+  80196b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801970:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801974:	44 89 e8             	mov    %r13d,%eax
+  801977:	48 83 c4 18          	add    $0x18,%rsp
+  80197b:	5b                   	pop    %rbx
+  80197c:	41 5c                	pop    %r12
+  80197e:	41 5d                	pop    %r13
+  801980:	5d                   	pop    %rbp
+  801981:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801982:	8b 3b                	mov    (%rbx),%edi
+  801984:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801988:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  80198f:	00 00 00 
+  801992:	ff d0                	call   *%rax
+  801994:	41 89 c5             	mov    %eax,%r13d
+  801997:	85 c0                	test   %eax,%eax
+  801999:	78 1b                	js     8019b6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80199b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80199f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8019a3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019a9:	48 85 c0             	test   %rax,%rax
+  8019ac:	74 08                	je     8019b6 <fd_close+0x8f>
+  8019ae:	48 89 df             	mov    %rbx,%rdi
+  8019b1:	ff d0                	call   *%rax
+  8019b3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019bb:	48 89 de             	mov    %rbx,%rsi
+  8019be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c3:	48 b8 da 14 80 00 00 	movabs $0x8014da,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+    return res;
+  8019cf:	eb a3                	jmp    801974 <fd_close+0x4d>
+
+00000000008019d1 <close>:
+
+int
+close(int fdnum) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019d9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019dd:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  8019e4:	00 00 00 
+  8019e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 15                	js     801a02 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8019f2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019f6:	48 b8 27 19 80 00 00 	movabs $0x801927,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+}
+  801a02:	c9                   	leave
+  801a03:	c3                   	ret
+
+0000000000801a04 <close_all>:
+
+void
+close_all(void) {
+  801a04:	55                   	push   %rbp
+  801a05:	48 89 e5             	mov    %rsp,%rbp
+  801a08:	41 54                	push   %r12
+  801a0a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a10:	49 bc d1 19 80 00 00 	movabs $0x8019d1,%r12
+  801a17:	00 00 00 
+  801a1a:	89 df                	mov    %ebx,%edi
+  801a1c:	41 ff d4             	call   *%r12
+  801a1f:	83 c3 01             	add    $0x1,%ebx
+  801a22:	83 fb 20             	cmp    $0x20,%ebx
+  801a25:	75 f3                	jne    801a1a <close_all+0x16>
+}
+  801a27:	5b                   	pop    %rbx
+  801a28:	41 5c                	pop    %r12
+  801a2a:	5d                   	pop    %rbp
+  801a2b:	c3                   	ret
+
+0000000000801a2c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a2c:	55                   	push   %rbp
+  801a2d:	48 89 e5             	mov    %rsp,%rbp
+  801a30:	41 57                	push   %r15
+  801a32:	41 56                	push   %r14
+  801a34:	41 55                	push   %r13
+  801a36:	41 54                	push   %r12
+  801a38:	53                   	push   %rbx
+  801a39:	48 83 ec 18          	sub    $0x18,%rsp
+  801a3d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a40:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a44:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801a4b:	00 00 00 
+  801a4e:	ff d0                	call   *%rax
+  801a50:	89 c3                	mov    %eax,%ebx
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	0f 88 b8 00 00 00    	js     801b12 <dup+0xe6>
+    close(newfdnum);
+  801a5a:	44 89 e7             	mov    %r12d,%edi
+  801a5d:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  801a64:	00 00 00 
+  801a67:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a69:	4d 63 ec             	movslq %r12d,%r13
+  801a6c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a73:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a77:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a7b:	4c 89 ff             	mov    %r15,%rdi
+  801a7e:	49 be f0 17 80 00 00 	movabs $0x8017f0,%r14
+  801a85:	00 00 00 
+  801a88:	41 ff d6             	call   *%r14
+  801a8b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a8e:	4c 89 ef             	mov    %r13,%rdi
+  801a91:	41 ff d6             	call   *%r14
+  801a94:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a97:	48 89 df             	mov    %rbx,%rdi
+  801a9a:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  801aa1:	00 00 00 
+  801aa4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801aa6:	a8 04                	test   $0x4,%al
+  801aa8:	74 2b                	je     801ad5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801aaa:	41 89 c1             	mov    %eax,%r9d
+  801aad:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ab3:	4c 89 f1             	mov    %r14,%rcx
+  801ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abb:	48 89 de             	mov    %rbx,%rsi
+  801abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac3:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801aca:	00 00 00 
+  801acd:	ff d0                	call   *%rax
+  801acf:	89 c3                	mov    %eax,%ebx
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	78 4e                	js     801b23 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ad5:	4c 89 ff             	mov    %r15,%rdi
+  801ad8:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ae7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801aed:	4c 89 e9             	mov    %r13,%rcx
+  801af0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af5:	4c 89 fe             	mov    %r15,%rsi
+  801af8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afd:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+  801b09:	89 c3                	mov    %eax,%ebx
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 14                	js     801b23 <dup+0xf7>
+
+    return newfdnum;
+  801b0f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b12:	89 d8                	mov    %ebx,%eax
+  801b14:	48 83 c4 18          	add    $0x18,%rsp
+  801b18:	5b                   	pop    %rbx
+  801b19:	41 5c                	pop    %r12
+  801b1b:	41 5d                	pop    %r13
+  801b1d:	41 5e                	pop    %r14
+  801b1f:	41 5f                	pop    %r15
+  801b21:	5d                   	pop    %rbp
+  801b22:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b28:	4c 89 ee             	mov    %r13,%rsi
+  801b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b30:	49 bc da 14 80 00 00 	movabs $0x8014da,%r12
+  801b37:	00 00 00 
+  801b3a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b42:	4c 89 f6             	mov    %r14,%rsi
+  801b45:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4a:	41 ff d4             	call   *%r12
+    return res;
+  801b4d:	eb c3                	jmp    801b12 <dup+0xe6>
+
+0000000000801b4f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b4f:	55                   	push   %rbp
+  801b50:	48 89 e5             	mov    %rsp,%rbp
+  801b53:	41 56                	push   %r14
+  801b55:	41 55                	push   %r13
+  801b57:	41 54                	push   %r12
+  801b59:	53                   	push   %rbx
+  801b5a:	48 83 ec 10          	sub    $0x10,%rsp
+  801b5e:	89 fb                	mov    %edi,%ebx
+  801b60:	49 89 f4             	mov    %rsi,%r12
+  801b63:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b66:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b6a:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801b71:	00 00 00 
+  801b74:	ff d0                	call   *%rax
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 4c                	js     801bc6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b7a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b7e:	41 8b 3e             	mov    (%r14),%edi
+  801b81:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b85:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801b8c:	00 00 00 
+  801b8f:	ff d0                	call   *%rax
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	78 35                	js     801bca <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b95:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b99:	83 e0 03             	and    $0x3,%eax
+  801b9c:	83 f8 01             	cmp    $0x1,%eax
+  801b9f:	74 2d                	je     801bce <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ba1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ba5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ba9:	48 85 c0             	test   %rax,%rax
+  801bac:	74 56                	je     801c04 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801bae:	4c 89 ea             	mov    %r13,%rdx
+  801bb1:	4c 89 e6             	mov    %r12,%rsi
+  801bb4:	4c 89 f7             	mov    %r14,%rdi
+  801bb7:	ff d0                	call   *%rax
+}
+  801bb9:	48 83 c4 10          	add    $0x10,%rsp
+  801bbd:	5b                   	pop    %rbx
+  801bbe:	41 5c                	pop    %r12
+  801bc0:	41 5d                	pop    %r13
+  801bc2:	41 5e                	pop    %r14
+  801bc4:	5d                   	pop    %rbp
+  801bc5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc6:	48 98                	cltq
+  801bc8:	eb ef                	jmp    801bb9 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bca:	48 98                	cltq
+  801bcc:	eb eb                	jmp    801bb9 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bce:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801bd5:	00 00 00 
+  801bd8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bde:	89 da                	mov    %ebx,%edx
+  801be0:	48 bf 79 40 80 00 00 	movabs $0x804079,%rdi
+  801be7:	00 00 00 
+  801bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bef:	48 b9 5d 04 80 00 00 	movabs $0x80045d,%rcx
+  801bf6:	00 00 00 
+  801bf9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bfb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c02:	eb b5                	jmp    801bb9 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c04:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c0b:	eb ac                	jmp    801bb9 <read+0x6a>
+
+0000000000801c0d <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c0d:	55                   	push   %rbp
+  801c0e:	48 89 e5             	mov    %rsp,%rbp
+  801c11:	41 56                	push   %r14
+  801c13:	41 55                	push   %r13
+  801c15:	41 54                	push   %r12
+  801c17:	53                   	push   %rbx
+  801c18:	48 83 ec 10          	sub    $0x10,%rsp
+  801c1c:	89 fb                	mov    %edi,%ebx
+  801c1e:	49 89 f4             	mov    %rsi,%r12
+  801c21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c28:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 41                	js     801c79 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c3c:	41 8b 3e             	mov    (%r14),%edi
+  801c3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c43:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801c4a:	00 00 00 
+  801c4d:	ff d0                	call   *%rax
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 35                	js     801c88 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c53:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c57:	83 e0 03             	and    $0x3,%eax
+  801c5a:	83 f8 01             	cmp    $0x1,%eax
+  801c5d:	74 2d                	je     801c8c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c67:	48 85 c0             	test   %rax,%rax
+  801c6a:	74 56                	je     801cc2 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801c6c:	4c 89 ea             	mov    %r13,%rdx
+  801c6f:	4c 89 e6             	mov    %r12,%rsi
+  801c72:	4c 89 f7             	mov    %r14,%rdi
+  801c75:	ff d0                	call   *%rax
+  801c77:	eb 02                	jmp    801c7b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c79:	48 98                	cltq
+}
+  801c7b:	48 83 c4 10          	add    $0x10,%rsp
+  801c7f:	5b                   	pop    %rbx
+  801c80:	41 5c                	pop    %r12
+  801c82:	41 5d                	pop    %r13
+  801c84:	41 5e                	pop    %r14
+  801c86:	5d                   	pop    %rbp
+  801c87:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c88:	48 98                	cltq
+  801c8a:	eb ef                	jmp    801c7b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c8c:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801c93:	00 00 00 
+  801c96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c9c:	89 da                	mov    %ebx,%edx
+  801c9e:	48 bf 38 40 80 00 00 	movabs $0x804038,%rdi
+  801ca5:	00 00 00 
+  801ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cad:	48 b9 5d 04 80 00 00 	movabs $0x80045d,%rcx
+  801cb4:	00 00 00 
+  801cb7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cb9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cc0:	eb b9                	jmp    801c7b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801cc2:	4c 89 ea             	mov    %r13,%rdx
+  801cc5:	4c 89 e6             	mov    %r12,%rsi
+  801cc8:	89 df                	mov    %ebx,%edi
+  801cca:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+  801cd6:	eb a3                	jmp    801c7b <readmap+0x6e>
+
+0000000000801cd8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801cd8:	55                   	push   %rbp
+  801cd9:	48 89 e5             	mov    %rsp,%rbp
+  801cdc:	41 57                	push   %r15
+  801cde:	41 56                	push   %r14
+  801ce0:	41 55                	push   %r13
+  801ce2:	41 54                	push   %r12
+  801ce4:	53                   	push   %rbx
+  801ce5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ce9:	48 85 d2             	test   %rdx,%rdx
+  801cec:	74 54                	je     801d42 <readn+0x6a>
+  801cee:	41 89 fd             	mov    %edi,%r13d
+  801cf1:	49 89 f6             	mov    %rsi,%r14
+  801cf4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cfc:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d01:	49 bf 4f 1b 80 00 00 	movabs $0x801b4f,%r15
+  801d08:	00 00 00 
+  801d0b:	4c 89 e2             	mov    %r12,%rdx
+  801d0e:	48 29 f2             	sub    %rsi,%rdx
+  801d11:	4c 01 f6             	add    %r14,%rsi
+  801d14:	44 89 ef             	mov    %r13d,%edi
+  801d17:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	78 20                	js     801d3e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d1e:	01 c3                	add    %eax,%ebx
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	74 08                	je     801d2c <readn+0x54>
+  801d24:	48 63 f3             	movslq %ebx,%rsi
+  801d27:	4c 39 e6             	cmp    %r12,%rsi
+  801d2a:	72 df                	jb     801d0b <readn+0x33>
+    }
+    return res;
+  801d2c:	48 63 c3             	movslq %ebx,%rax
+}
+  801d2f:	48 83 c4 08          	add    $0x8,%rsp
+  801d33:	5b                   	pop    %rbx
+  801d34:	41 5c                	pop    %r12
+  801d36:	41 5d                	pop    %r13
+  801d38:	41 5e                	pop    %r14
+  801d3a:	41 5f                	pop    %r15
+  801d3c:	5d                   	pop    %rbp
+  801d3d:	c3                   	ret
+        if (inc < 0) return inc;
+  801d3e:	48 98                	cltq
+  801d40:	eb ed                	jmp    801d2f <readn+0x57>
+    int inc = 1, res = 0;
+  801d42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d47:	eb e3                	jmp    801d2c <readn+0x54>
+
+0000000000801d49 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	41 56                	push   %r14
+  801d4f:	41 55                	push   %r13
+  801d51:	41 54                	push   %r12
+  801d53:	53                   	push   %rbx
+  801d54:	48 83 ec 10          	sub    $0x10,%rsp
+  801d58:	89 fb                	mov    %edi,%ebx
+  801d5a:	49 89 f4             	mov    %rsi,%r12
+  801d5d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d60:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d64:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801d6b:	00 00 00 
+  801d6e:	ff d0                	call   *%rax
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 47                	js     801dbb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d74:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d78:	41 8b 3e             	mov    (%r14),%edi
+  801d7b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d7f:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+  801d8b:	85 c0                	test   %eax,%eax
+  801d8d:	78 30                	js     801dbf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d8f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d94:	74 2d                	je     801dc3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d9e:	48 85 c0             	test   %rax,%rax
+  801da1:	74 56                	je     801df9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801da3:	4c 89 ea             	mov    %r13,%rdx
+  801da6:	4c 89 e6             	mov    %r12,%rsi
+  801da9:	4c 89 f7             	mov    %r14,%rdi
+  801dac:	ff d0                	call   *%rax
+}
+  801dae:	48 83 c4 10          	add    $0x10,%rsp
+  801db2:	5b                   	pop    %rbx
+  801db3:	41 5c                	pop    %r12
+  801db5:	41 5d                	pop    %r13
+  801db7:	41 5e                	pop    %r14
+  801db9:	5d                   	pop    %rbp
+  801dba:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbb:	48 98                	cltq
+  801dbd:	eb ef                	jmp    801dae <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dbf:	48 98                	cltq
+  801dc1:	eb eb                	jmp    801dae <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dc3:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801dca:	00 00 00 
+  801dcd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dd3:	89 da                	mov    %ebx,%edx
+  801dd5:	48 bf 95 40 80 00 00 	movabs $0x804095,%rdi
+  801ddc:	00 00 00 
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de4:	48 b9 5d 04 80 00 00 	movabs $0x80045d,%rcx
+  801deb:	00 00 00 
+  801dee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801df7:	eb b5                	jmp    801dae <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801df9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e00:	eb ac                	jmp    801dae <write+0x65>
+
+0000000000801e02 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	53                   	push   %rbx
+  801e07:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e11:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801e18:	00 00 00 
+  801e1b:	ff d0                	call   *%rax
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 0c                	js     801e2d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e25:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+
+0000000000801e33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e33:	55                   	push   %rbp
+  801e34:	48 89 e5             	mov    %rsp,%rbp
+  801e37:	41 55                	push   %r13
+  801e39:	41 54                	push   %r12
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801e40:	89 fb                	mov    %edi,%ebx
+  801e42:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e49:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801e50:	00 00 00 
+  801e53:	ff d0                	call   *%rax
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	78 38                	js     801e91 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e59:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e5d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e65:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 1c                	js     801e91 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e75:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e7a:	74 20                	je     801e9c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e80:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e84:	48 85 c0             	test   %rax,%rax
+  801e87:	74 47                	je     801ed0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e89:	44 89 e6             	mov    %r12d,%esi
+  801e8c:	4c 89 ef             	mov    %r13,%rdi
+  801e8f:	ff d0                	call   *%rax
+}
+  801e91:	48 83 c4 18          	add    $0x18,%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	41 5d                	pop    %r13
+  801e9a:	5d                   	pop    %rbp
+  801e9b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e9c:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801ea3:	00 00 00 
+  801ea6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eac:	89 da                	mov    %ebx,%edx
+  801eae:	48 bf 58 40 80 00 00 	movabs $0x804058,%rdi
+  801eb5:	00 00 00 
+  801eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebd:	48 b9 5d 04 80 00 00 	movabs $0x80045d,%rcx
+  801ec4:	00 00 00 
+  801ec7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ec9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ece:	eb c1                	jmp    801e91 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ed5:	eb ba                	jmp    801e91 <ftruncate+0x5e>
+
+0000000000801ed7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+  801edb:	41 54                	push   %r12
+  801edd:	53                   	push   %rbx
+  801ede:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ee9:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+  801ef5:	85 c0                	test   %eax,%eax
+  801ef7:	78 4e                	js     801f47 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801efd:	41 8b 3c 24          	mov    (%r12),%edi
+  801f01:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f05:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801f0c:	00 00 00 
+  801f0f:	ff d0                	call   *%rax
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 32                	js     801f47 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f19:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801f1e:	74 30                	je     801f50 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f20:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f23:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f2a:	00 00 00 
+    stat->st_isdir = 0;
+  801f2d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f34:	00 00 00 
+    stat->st_dev = dev;
+  801f37:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f3e:	48 89 de             	mov    %rbx,%rsi
+  801f41:	4c 89 e7             	mov    %r12,%rdi
+  801f44:	ff 50 30             	call   *0x30(%rax)
+}
+  801f47:	48 83 c4 10          	add    $0x10,%rsp
+  801f4b:	5b                   	pop    %rbx
+  801f4c:	41 5c                	pop    %r12
+  801f4e:	5d                   	pop    %rbp
+  801f4f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f50:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f55:	eb f0                	jmp    801f47 <fstat+0x70>
+
+0000000000801f57 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f57:	55                   	push   %rbp
+  801f58:	48 89 e5             	mov    %rsp,%rbp
+  801f5b:	41 54                	push   %r12
+  801f5d:	53                   	push   %rbx
+  801f5e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f61:	be 00 00 00 00       	mov    $0x0,%esi
+  801f66:	48 b8 ae 2c 80 00 00 	movabs $0x802cae,%rax
+  801f6d:	00 00 00 
+  801f70:	ff d0                	call   *%rax
+  801f72:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 25                	js     801f9d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f78:	4c 89 e6             	mov    %r12,%rsi
+  801f7b:	89 c7                	mov    %eax,%edi
+  801f7d:	48 b8 d7 1e 80 00 00 	movabs $0x801ed7,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+  801f89:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f8c:	89 df                	mov    %ebx,%edi
+  801f8e:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+
+    return res;
+  801f9a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f9d:	89 d8                	mov    %ebx,%eax
+  801f9f:	5b                   	pop    %rbx
+  801fa0:	41 5c                	pop    %r12
+  801fa2:	5d                   	pop    %rbp
+  801fa3:	c3                   	ret
+
+0000000000801fa4 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801fa4:	55                   	push   %rbp
+  801fa5:	48 89 e5             	mov    %rsp,%rbp
+  801fa8:	41 54                	push   %r12
+  801faa:	53                   	push   %rbx
+  801fab:	48 83 ec 10          	sub    $0x10,%rsp
+  801faf:	48 89 fb             	mov    %rdi,%rbx
+  801fb2:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fb5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fb9:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fbe:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 1f                	js     801fed <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801fce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fd2:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801fd6:	48 85 c0             	test   %rax,%rax
+  801fd9:	74 1b                	je     801ff6 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801fdb:	4c 89 e6             	mov    %r12,%rsi
+  801fde:	48 89 df             	mov    %rbx,%rdi
+  801fe1:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fea:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fed:	48 83 c4 10          	add    $0x10,%rsp
+  801ff1:	5b                   	pop    %rbx
+  801ff2:	41 5c                	pop    %r12
+  801ff4:	5d                   	pop    %rbp
+  801ff5:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ff6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ffb:	eb f0                	jmp    801fed <create_snapshot+0x49>
+
+0000000000801ffd <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801ffd:	55                   	push   %rbp
+  801ffe:	48 89 e5             	mov    %rsp,%rbp
+  802001:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802005:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802009:	bf 66 00 00 00       	mov    $0x66,%edi
+  80200e:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 1e                	js     80203c <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  80201e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802022:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802026:	48 85 d2             	test   %rdx,%rdx
+  802029:	74 13                	je     80203e <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802032:	85 c0                	test   %eax,%eax
+  802034:	ba 00 00 00 00       	mov    $0x0,%edx
+  802039:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80203e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802043:	eb f7                	jmp    80203c <print_snapshot_list+0x3f>
+
+0000000000802045 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+  802049:	53                   	push   %rbx
+  80204a:	48 83 ec 18          	sub    $0x18,%rsp
+  80204e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802051:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802055:	bf 66 00 00 00       	mov    $0x66,%edi
+  80205a:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 1c                	js     802086 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80206a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206e:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802072:	48 85 c0             	test   %rax,%rax
+  802075:	74 15                	je     80208c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802077:	48 89 df             	mov    %rbx,%rdi
+  80207a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80207c:	85 c0                	test   %eax,%eax
+  80207e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802083:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802086:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80208a:	c9                   	leave
+  80208b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80208c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802091:	eb f3                	jmp    802086 <accept_snapshot+0x41>
+
+0000000000802093 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802093:	55                   	push   %rbp
+  802094:	48 89 e5             	mov    %rsp,%rbp
+  802097:	53                   	push   %rbx
+  802098:	48 83 ec 18          	sub    $0x18,%rsp
+  80209c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80209f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020a3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020a8:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 1c                	js     8020d4 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8020b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020bc:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8020c0:	48 85 c0             	test   %rax,%rax
+  8020c3:	74 15                	je     8020da <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8020c5:	48 89 df             	mov    %rbx,%rdi
+  8020c8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020da:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020df:	eb f3                	jmp    8020d4 <delete_snapshot+0x41>
+
+00000000008020e1 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  8020e1:	55                   	push   %rbp
+  8020e2:	48 89 e5             	mov    %rsp,%rbp
+  8020e5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020e9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020ed:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020f2:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8020f9:	00 00 00 
+  8020fc:	ff d0                	call   *%rax
+  8020fe:	85 c0                	test   %eax,%eax
+  802100:	78 14                	js     802116 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802106:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80210a:	48 85 d2             	test   %rdx,%rdx
+  80210d:	74 09                	je     802118 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80210f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802114:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802116:	c9                   	leave
+  802117:	c3                   	ret
+        return -E_NOT_SUPP;
+  802118:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80211d:	eb f7                	jmp    802116 <gc_snapshots+0x35>
+
+000000000080211f <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	41 56                	push   %r14
+  802125:	41 55                	push   %r13
+  802127:	41 54                	push   %r12
+  802129:	53                   	push   %rbx
+  80212a:	48 83 ec 10          	sub    $0x10,%rsp
+  80212e:	48 89 fb             	mov    %rdi,%rbx
+  802131:	49 89 f4             	mov    %rsi,%r12
+  802134:	49 89 d5             	mov    %rdx,%r13
+  802137:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80213a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80213e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802143:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+  80214f:	85 c0                	test   %eax,%eax
+  802151:	78 1b                	js     80216e <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802157:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80215b:	48 85 c0             	test   %rax,%rax
+  80215e:	74 1b                	je     80217b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802160:	4c 89 f1             	mov    %r14,%rcx
+  802163:	4c 89 ea             	mov    %r13,%rdx
+  802166:	4c 89 e6             	mov    %r12,%rsi
+  802169:	48 89 df             	mov    %rbx,%rdi
+  80216c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80216e:	48 83 c4 10          	add    $0x10,%rsp
+  802172:	5b                   	pop    %rbx
+  802173:	41 5c                	pop    %r12
+  802175:	41 5d                	pop    %r13
+  802177:	41 5e                	pop    %r14
+  802179:	5d                   	pop    %rbp
+  80217a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80217b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802180:	eb ec                	jmp    80216e <diff_snapshots+0x4f>
+
+0000000000802182 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802182:	55                   	push   %rbp
+  802183:	48 89 e5             	mov    %rsp,%rbp
+  802186:	41 55                	push   %r13
+  802188:	41 54                	push   %r12
+  80218a:	53                   	push   %rbx
+  80218b:	48 83 ec 18          	sub    $0x18,%rsp
+  80218f:	48 89 fb             	mov    %rdi,%rbx
+  802192:	49 89 f4             	mov    %rsi,%r12
+  802195:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802198:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80219c:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021a1:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 18                	js     8021c9 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8021b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021b5:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8021b9:	48 85 c0             	test   %rax,%rax
+  8021bc:	74 16                	je     8021d4 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8021be:	4c 89 ea             	mov    %r13,%rdx
+  8021c1:	4c 89 e6             	mov    %r12,%rsi
+  8021c4:	48 89 df             	mov    %rbx,%rdi
+  8021c7:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021c9:	48 83 c4 18          	add    $0x18,%rsp
+  8021cd:	5b                   	pop    %rbx
+  8021ce:	41 5c                	pop    %r12
+  8021d0:	41 5d                	pop    %r13
+  8021d2:	5d                   	pop    %rbp
+  8021d3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021d4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021d9:	eb ee                	jmp    8021c9 <send_snapshot+0x47>
+
+00000000008021db <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8021db:	55                   	push   %rbp
+  8021dc:	48 89 e5             	mov    %rsp,%rbp
+  8021df:	53                   	push   %rbx
+  8021e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e4:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021e7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021eb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021f0:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+  8021fc:	85 c0                	test   %eax,%eax
+  8021fe:	78 12                	js     802212 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802200:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802204:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802208:	48 85 c0             	test   %rax,%rax
+  80220b:	74 0b                	je     802218 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80220d:	48 89 df             	mov    %rbx,%rdi
+  802210:	ff d0                	call   *%rax
+
+    return res;
+}
+  802212:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802216:	c9                   	leave
+  802217:	c3                   	ret
+        return -E_NOT_SUPP;
+  802218:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80221d:	eb f3                	jmp    802212 <receive_snapshot+0x37>
+
+000000000080221f <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802227:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80222b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802230:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 17                	js     802257 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802240:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802244:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  80224b:	48 85 d2             	test   %rdx,%rdx
+  80224e:	74 09                	je     802259 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802250:	b8 00 00 00 00       	mov    $0x0,%eax
+  802255:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802257:	c9                   	leave
+  802258:	c3                   	ret
+        return -E_NOT_SUPP;
+  802259:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80225e:	eb f7                	jmp    802257 <free_space_bytes+0x38>
+
+0000000000802260 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802260:	55                   	push   %rbp
+  802261:	48 89 e5             	mov    %rsp,%rbp
+  802264:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802268:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80226c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802271:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  802278:	00 00 00 
+  80227b:	ff d0                	call   *%rax
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	78 17                	js     802298 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802281:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802285:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80228c:	48 85 d2             	test   %rdx,%rdx
+  80228f:	74 09                	je     80229a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802291:	b8 00 00 00 00       	mov    $0x0,%eax
+  802296:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+        return -E_NOT_SUPP;
+  80229a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80229f:	eb f7                	jmp    802298 <busy_space_bytes+0x38>
+
+00000000008022a1 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8022a1:	55                   	push   %rbp
+  8022a2:	48 89 e5             	mov    %rsp,%rbp
+  8022a5:	41 54                	push   %r12
+  8022a7:	53                   	push   %rbx
+  8022a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ac:	89 fb                	mov    %edi,%ebx
+  8022ae:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022b1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022b5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022ba:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8022c1:	00 00 00 
+  8022c4:	ff d0                	call   *%rax
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	78 17                	js     8022e1 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8022ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022ce:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8022d5:	48 85 c0             	test   %rax,%rax
+  8022d8:	74 10                	je     8022ea <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8022da:	4c 89 e6             	mov    %r12,%rsi
+  8022dd:	89 df                	mov    %ebx,%edi
+  8022df:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8022e1:	48 83 c4 10          	add    $0x10,%rsp
+  8022e5:	5b                   	pop    %rbx
+  8022e6:	41 5c                	pop    %r12
+  8022e8:	5d                   	pop    %rbp
+  8022e9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022ea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022ef:	eb f0                	jmp    8022e1 <snapshots_space+0x40>
+
+00000000008022f1 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8022f1:	55                   	push   %rbp
+  8022f2:	48 89 e5             	mov    %rsp,%rbp
+  8022f5:	41 55                	push   %r13
+  8022f7:	41 54                	push   %r12
+  8022f9:	53                   	push   %rbx
+  8022fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fe:	41 89 fd             	mov    %edi,%r13d
+  802301:	48 89 f3             	mov    %rsi,%rbx
+  802304:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802307:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80230e:	00 00 00 
+  802311:	83 38 00             	cmpl   $0x0,(%rax)
+  802314:	74 57                	je     80236d <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802316:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80231c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802321:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802328:	00 00 00 
+  80232b:	44 89 ee             	mov    %r13d,%esi
+  80232e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802335:	00 00 00 
+  802338:	8b 38                	mov    (%rax),%edi
+  80233a:	48 b8 12 39 80 00 00 	movabs $0x803912,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234b:	4c 89 e2             	mov    %r12,%rdx
+  80234e:	48 89 de             	mov    %rbx,%rsi
+  802351:	bf 00 00 00 00       	mov    $0x0,%edi
+  802356:	48 b8 fa 38 80 00 00 	movabs $0x8038fa,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+}
+  802362:	48 83 c4 08          	add    $0x8,%rsp
+  802366:	5b                   	pop    %rbx
+  802367:	41 5c                	pop    %r12
+  802369:	41 5d                	pop    %r13
+  80236b:	5d                   	pop    %rbp
+  80236c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80236d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802372:	48 b8 d0 39 80 00 00 	movabs $0x8039d0,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+  80237e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802385:	00 00 
+  802387:	eb 8d                	jmp    802316 <fsipc_region+0x25>
+
+0000000000802389 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802389:	55                   	push   %rbp
+  80238a:	48 89 e5             	mov    %rsp,%rbp
+  80238d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802391:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802398:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802399:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80239d:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+00000000008023ab <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8023ab:	85 ff                	test   %edi,%edi
+  8023ad:	78 6d                	js     80241c <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8023af:	55                   	push   %rbp
+  8023b0:	48 89 e5             	mov    %rsp,%rbp
+  8023b3:	41 54                	push   %r12
+  8023b5:	53                   	push   %rbx
+  8023b6:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8023b9:	48 85 f6             	test   %rsi,%rsi
+  8023bc:	74 57                	je     802415 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8023be:	89 f8                	mov    %edi,%eax
+  8023c0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023c7:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8023c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ce:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023d3:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8023da:	00 00 00 
+  8023dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 2d                	js     802410 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8023e3:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8023ea:	00 00 00 
+  8023ed:	49 63 14 24          	movslq (%r12),%rdx
+  8023f1:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8023f8:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8023fd:	48 89 df             	mov    %rbx,%rdi
+  802400:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80240c:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802410:	5b                   	pop    %rbx
+  802411:	41 5c                	pop    %r12
+  802413:	5d                   	pop    %rbp
+  802414:	c3                   	ret
+        return -E_INVAL;
+  802415:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80241a:	eb f4                	jmp    802410 <devfile_df_snapshots+0x65>
+  80241c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802421:	c3                   	ret
+
+0000000000802422 <devfile_df_busy>:
+devfile_df_busy() {
+  802422:	55                   	push   %rbp
+  802423:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802426:	be 00 00 00 00       	mov    $0x0,%esi
+  80242b:	bf 11 00 00 00       	mov    $0x11,%edi
+  802430:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+}
+  80243c:	5d                   	pop    %rbp
+  80243d:	c3                   	ret
+
+000000000080243e <devfile_df_free>:
+devfile_df_free() {
+  80243e:	55                   	push   %rbp
+  80243f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802442:	be 00 00 00 00       	mov    $0x0,%esi
+  802447:	bf 10 00 00 00       	mov    $0x10,%edi
+  80244c:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+}
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+
+000000000080245a <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80245a:	55                   	push   %rbp
+  80245b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80245e:	be 00 00 00 00       	mov    $0x0,%esi
+  802463:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802468:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+}
+  802474:	5d                   	pop    %rbp
+  802475:	c3                   	ret
+
+0000000000802476 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802476:	55                   	push   %rbp
+  802477:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80247a:	be 00 00 00 00       	mov    $0x0,%esi
+  80247f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802484:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802490:	85 c0                	test   %eax,%eax
+  802492:	ba 00 00 00 00       	mov    $0x0,%edx
+  802497:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80249a:	5d                   	pop    %rbp
+  80249b:	c3                   	ret
+
+000000000080249c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8024a0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8024a7:	00 00 00 
+  8024aa:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8024ad:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8024af:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8024b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024bc:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+}
+  8024c8:	5d                   	pop    %rbp
+  8024c9:	c3                   	ret
+
+00000000008024ca <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8024ca:	55                   	push   %rbp
+  8024cb:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8024ce:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024d1:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8024d8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8024da:	be 00 00 00 00       	mov    $0x0,%esi
+  8024df:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024e4:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+}
+  8024f0:	5d                   	pop    %rbp
+  8024f1:	c3                   	ret
+
+00000000008024f2 <devfile_write>:
+    if (!fd || !buf) {
+  8024f2:	48 85 ff             	test   %rdi,%rdi
+  8024f5:	0f 84 c1 00 00 00    	je     8025bc <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	41 57                	push   %r15
+  802501:	41 56                	push   %r14
+  802503:	41 55                	push   %r13
+  802505:	41 54                	push   %r12
+  802507:	53                   	push   %rbx
+  802508:	48 83 ec 18          	sub    $0x18,%rsp
+  80250c:	49 89 ff             	mov    %rdi,%r15
+  80250f:	49 89 f5             	mov    %rsi,%r13
+  802512:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802515:	48 85 f6             	test   %rsi,%rsi
+  802518:	0f 84 95 00 00 00    	je     8025b3 <devfile_write+0xc1>
+    while (n) {
+  80251e:	48 85 d2             	test   %rdx,%rdx
+  802521:	0f 84 83 00 00 00    	je     8025aa <devfile_write+0xb8>
+    int totalWrite = 0;
+  802527:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80252e:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802535:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802538:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80253d:	49 39 dc             	cmp    %rbx,%r12
+  802540:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802544:	48 89 da             	mov    %rbx,%rdx
+  802547:	4c 89 ee             	mov    %r13,%rsi
+  80254a:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802551:	00 00 00 
+  802554:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802560:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802564:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802567:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80256b:	be 00 00 00 00       	mov    $0x0,%esi
+  802570:	bf 04 00 00 00       	mov    $0x4,%edi
+  802575:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+        if (write < 0) {
+  802581:	85 c0                	test   %eax,%eax
+  802583:	78 21                	js     8025a6 <devfile_write+0xb4>
+        buf += write;
+  802585:	48 63 d0             	movslq %eax,%rdx
+  802588:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80258b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80258e:	49 29 d4             	sub    %rdx,%r12
+  802591:	75 a5                	jne    802538 <devfile_write+0x46>
+    return totalWrite;
+  802593:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802597:	48 83 c4 18          	add    $0x18,%rsp
+  80259b:	5b                   	pop    %rbx
+  80259c:	41 5c                	pop    %r12
+  80259e:	41 5d                	pop    %r13
+  8025a0:	41 5e                	pop    %r14
+  8025a2:	41 5f                	pop    %r15
+  8025a4:	5d                   	pop    %rbp
+  8025a5:	c3                   	ret
+            return write;
+  8025a6:	48 98                	cltq
+  8025a8:	eb ed                	jmp    802597 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8025aa:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8025b1:	eb e0                	jmp    802593 <devfile_write+0xa1>
+        return -E_INVAL;
+  8025b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025ba:	eb db                	jmp    802597 <devfile_write+0xa5>
+  8025bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025c3:	c3                   	ret
+
+00000000008025c4 <devfile_read>:
+    if (!fd || !buf) {
+  8025c4:	48 85 ff             	test   %rdi,%rdi
+  8025c7:	0f 84 c0 00 00 00    	je     80268d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025cd:	55                   	push   %rbp
+  8025ce:	48 89 e5             	mov    %rsp,%rbp
+  8025d1:	41 57                	push   %r15
+  8025d3:	41 56                	push   %r14
+  8025d5:	41 55                	push   %r13
+  8025d7:	41 54                	push   %r12
+  8025d9:	53                   	push   %rbx
+  8025da:	48 83 ec 18          	sub    $0x18,%rsp
+  8025de:	49 89 ff             	mov    %rdi,%r15
+  8025e1:	49 89 f5             	mov    %rsi,%r13
+  8025e4:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8025e7:	48 85 f6             	test   %rsi,%rsi
+  8025ea:	0f 84 96 00 00 00    	je     802686 <devfile_read+0xc2>
+    while (n) {
+  8025f0:	48 85 d2             	test   %rdx,%rdx
+  8025f3:	0f 84 87 00 00 00    	je     802680 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8025f9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802600:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802601:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802608:	00 00 00 
+  80260b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80260f:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802612:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802617:	49 39 c4             	cmp    %rax,%r12
+  80261a:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80261e:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802622:	be 00 00 00 00       	mov    $0x0,%esi
+  802627:	bf 03 00 00 00       	mov    $0x3,%edi
+  80262c:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	7e 37                	jle    802673 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  80263c:	48 63 d8             	movslq %eax,%rbx
+  80263f:	48 89 da             	mov    %rbx,%rdx
+  802642:	4c 89 f6             	mov    %r14,%rsi
+  802645:	4c 89 ef             	mov    %r13,%rdi
+  802648:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+        buf += read;
+  802654:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802657:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80265b:	49 29 dc             	sub    %rbx,%r12
+  80265e:	75 ab                	jne    80260b <devfile_read+0x47>
+  return totalRead;
+  802660:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802664:	48 83 c4 18          	add    $0x18,%rsp
+  802668:	5b                   	pop    %rbx
+  802669:	41 5c                	pop    %r12
+  80266b:	41 5d                	pop    %r13
+  80266d:	41 5e                	pop    %r14
+  80266f:	41 5f                	pop    %r15
+  802671:	5d                   	pop    %rbp
+  802672:	c3                   	ret
+            return read ? read : totalRead;
+  802673:	48 63 d0             	movslq %eax,%rdx
+  802676:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80267a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80267e:	eb e4                	jmp    802664 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802680:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802684:	eb da                	jmp    802660 <devfile_read+0x9c>
+        return E_INVAL;
+  802686:	b8 03 00 00 00       	mov    $0x3,%eax
+  80268b:	eb d7                	jmp    802664 <devfile_read+0xa0>
+  80268d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802692:	c3                   	ret
+
+0000000000802693 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802693:	48 85 ff             	test   %rdi,%rdi
+  802696:	74 5f                	je     8026f7 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802698:	55                   	push   %rbp
+  802699:	48 89 e5             	mov    %rsp,%rbp
+  80269c:	53                   	push   %rbx
+  80269d:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a1:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026a4:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+  8026b0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026b6:	77 45                	ja     8026fd <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8026b8:	48 89 de             	mov    %rbx,%rsi
+  8026bb:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8026c2:	00 00 00 
+  8026c5:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8026d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026db:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026e7:	85 c0                	test   %eax,%eax
+  8026e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ee:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+        return -E_INVAL;
+  8026f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026fc:	c3                   	ret
+        return -E_INVAL;
+  8026fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802702:	eb ed                	jmp    8026f1 <devfile_receive_snapshot+0x5e>
+
+0000000000802704 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802704:	55                   	push   %rbp
+  802705:	48 89 e5             	mov    %rsp,%rbp
+  802708:	41 55                	push   %r13
+  80270a:	41 54                	push   %r12
+  80270c:	53                   	push   %rbx
+  80270d:	48 83 ec 08          	sub    $0x8,%rsp
+  802711:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802714:	48 85 f6             	test   %rsi,%rsi
+  802717:	0f 94 c0             	sete   %al
+  80271a:	48 85 d2             	test   %rdx,%rdx
+  80271d:	0f 94 c2             	sete   %dl
+  802720:	08 d0                	or     %dl,%al
+  802722:	0f 85 ad 00 00 00    	jne    8027d5 <devfile_send_snapshot+0xd1>
+  802728:	48 89 fb             	mov    %rdi,%rbx
+  80272b:	49 89 f4             	mov    %rsi,%r12
+  80272e:	48 85 ff             	test   %rdi,%rdi
+  802731:	0f 84 9e 00 00 00    	je     8027d5 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802737:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+  802743:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802749:	0f 87 8d 00 00 00    	ja     8027dc <devfile_send_snapshot+0xd8>
+  80274f:	4c 89 e7             	mov    %r12,%rdi
+  802752:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+  80275e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802764:	77 7d                	ja     8027e3 <devfile_send_snapshot+0xdf>
+  802766:	4c 89 ef             	mov    %r13,%rdi
+  802769:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+  802775:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80277b:	77 6d                	ja     8027ea <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80277d:	48 89 de             	mov    %rbx,%rsi
+  802780:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802787:	00 00 00 
+  80278a:	48 bb 82 0d 80 00 00 	movabs $0x800d82,%rbx
+  802791:	00 00 00 
+  802794:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802796:	4c 89 e6             	mov    %r12,%rsi
+  802799:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8027a0:	00 00 00 
+  8027a3:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8027a5:	4c 89 ee             	mov    %r13,%rsi
+  8027a8:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8027af:	00 00 00 
+  8027b2:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8027b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b9:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027be:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8027c5:	00 00 00 
+  8027c8:	ff d0                	call   *%rax
+}
+  8027ca:	48 83 c4 08          	add    $0x8,%rsp
+  8027ce:	5b                   	pop    %rbx
+  8027cf:	41 5c                	pop    %r12
+  8027d1:	41 5d                	pop    %r13
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+        return -E_INVAL;
+  8027d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027da:	eb ee                	jmp    8027ca <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8027dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e1:	eb e7                	jmp    8027ca <devfile_send_snapshot+0xc6>
+  8027e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e8:	eb e0                	jmp    8027ca <devfile_send_snapshot+0xc6>
+  8027ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ef:	eb d9                	jmp    8027ca <devfile_send_snapshot+0xc6>
+
+00000000008027f1 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8027f1:	48 85 ff             	test   %rdi,%rdi
+  8027f4:	0f 84 41 01 00 00    	je     80293b <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8027fa:	55                   	push   %rbp
+  8027fb:	48 89 e5             	mov    %rsp,%rbp
+  8027fe:	41 57                	push   %r15
+  802800:	41 56                	push   %r14
+  802802:	41 55                	push   %r13
+  802804:	41 54                	push   %r12
+  802806:	53                   	push   %rbx
+  802807:	48 83 ec 08          	sub    $0x8,%rsp
+  80280b:	49 89 fc             	mov    %rdi,%r12
+  80280e:	49 89 f5             	mov    %rsi,%r13
+  802811:	48 89 d3             	mov    %rdx,%rbx
+  802814:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802817:	48 85 f6             	test   %rsi,%rsi
+  80281a:	0f 84 ff 00 00 00    	je     80291f <devfile_diff_snapshots+0x12e>
+  802820:	48 85 d2             	test   %rdx,%rdx
+  802823:	0f 84 fd 00 00 00    	je     802926 <devfile_diff_snapshots+0x135>
+  802829:	48 85 c9             	test   %rcx,%rcx
+  80282c:	0f 84 f4 00 00 00    	je     802926 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802832:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+  80283e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802844:	0f 87 e3 00 00 00    	ja     80292d <devfile_diff_snapshots+0x13c>
+  80284a:	4c 89 ef             	mov    %r13,%rdi
+  80284d:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+  802859:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80285f:	0f 87 cf 00 00 00    	ja     802934 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802865:	4c 89 e6             	mov    %r12,%rsi
+  802868:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80286f:	00 00 00 
+  802872:	4c 89 e7             	mov    %r12,%rdi
+  802875:	49 bf 82 0d 80 00 00 	movabs $0x800d82,%r15
+  80287c:	00 00 00 
+  80287f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802882:	4c 89 ee             	mov    %r13,%rsi
+  802885:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80288c:	00 
+  80288d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802890:	48 8b 03             	mov    (%rbx),%rax
+  802893:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80289a:	00 
+  80289b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80289f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8028a6:	00 
+  8028a7:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8028ab:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8028b2:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8028b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028bd:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	78 43                	js     802910 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8028cd:	49 8b 04 24          	mov    (%r12),%rax
+  8028d1:	48 89 03             	mov    %rax,(%rbx)
+  8028d4:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8028d9:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8028dd:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8028e2:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8028e6:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8028eb:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8028ef:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8028f3:	48 c1 e2 03          	shl    $0x3,%rdx
+  8028f7:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8028fc:	4c 89 f7             	mov    %r14,%rdi
+  8028ff:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  802906:	00 00 00 
+  802909:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80290b:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802910:	48 83 c4 08          	add    $0x8,%rsp
+  802914:	5b                   	pop    %rbx
+  802915:	41 5c                	pop    %r12
+  802917:	41 5d                	pop    %r13
+  802919:	41 5e                	pop    %r14
+  80291b:	41 5f                	pop    %r15
+  80291d:	5d                   	pop    %rbp
+  80291e:	c3                   	ret
+        return -E_INVAL;
+  80291f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802924:	eb ea                	jmp    802910 <devfile_diff_snapshots+0x11f>
+  802926:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80292b:	eb e3                	jmp    802910 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80292d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802932:	eb dc                	jmp    802910 <devfile_diff_snapshots+0x11f>
+  802934:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802939:	eb d5                	jmp    802910 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80293b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802940:	c3                   	ret
+
+0000000000802941 <devfile_delete_snapshot>:
+    if (!name) {
+  802941:	48 85 ff             	test   %rdi,%rdi
+  802944:	74 5f                	je     8029a5 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802946:	55                   	push   %rbp
+  802947:	48 89 e5             	mov    %rsp,%rbp
+  80294a:	53                   	push   %rbx
+  80294b:	48 83 ec 08          	sub    $0x8,%rsp
+  80294f:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802952:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+  80295e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802964:	77 45                	ja     8029ab <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802966:	48 89 de             	mov    %rbx,%rsi
+  802969:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802970:	00 00 00 
+  802973:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80297f:	be 00 00 00 00       	mov    $0x0,%esi
+  802984:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802989:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802990:	00 00 00 
+  802993:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802995:	85 c0                	test   %eax,%eax
+  802997:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80299f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a3:	c9                   	leave
+  8029a4:	c3                   	ret
+        return -E_INVAL;
+  8029a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029aa:	c3                   	ret
+        return -E_INVAL;
+  8029ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b0:	eb ed                	jmp    80299f <devfile_delete_snapshot+0x5e>
+
+00000000008029b2 <devfile_accept_snapshot>:
+    if (!name) {
+  8029b2:	48 85 ff             	test   %rdi,%rdi
+  8029b5:	74 5f                	je     802a16 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8029b7:	55                   	push   %rbp
+  8029b8:	48 89 e5             	mov    %rsp,%rbp
+  8029bb:	53                   	push   %rbx
+  8029bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c0:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029c3:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+  8029cf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029d5:	77 45                	ja     802a1c <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8029d7:	48 89 de             	mov    %rbx,%rsi
+  8029da:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029e1:	00 00 00 
+  8029e4:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8029f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029fa:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a14:	c9                   	leave
+  802a15:	c3                   	ret
+        return -E_INVAL;
+  802a16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a1b:	c3                   	ret
+        return -E_INVAL;
+  802a1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a21:	eb ed                	jmp    802a10 <devfile_accept_snapshot+0x5e>
+
+0000000000802a23 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802a23:	48 85 ff             	test   %rdi,%rdi
+  802a26:	0f 84 9f 00 00 00    	je     802acb <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802a2c:	55                   	push   %rbp
+  802a2d:	48 89 e5             	mov    %rsp,%rbp
+  802a30:	41 54                	push   %r12
+  802a32:	53                   	push   %rbx
+  802a33:	48 89 fb             	mov    %rdi,%rbx
+  802a36:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802a39:	48 85 f6             	test   %rsi,%rsi
+  802a3c:	74 78                	je     802ab6 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802a3e:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+  802a4a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a50:	77 6b                	ja     802abd <devfile_create_snapshot+0x9a>
+  802a52:	4c 89 e7             	mov    %r12,%rdi
+  802a55:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802a5c:	00 00 00 
+  802a5f:	ff d0                	call   *%rax
+  802a61:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a67:	77 5b                	ja     802ac4 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802a69:	48 89 de             	mov    %rbx,%rsi
+  802a6c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a73:	00 00 00 
+  802a76:	48 bb 82 0d 80 00 00 	movabs $0x800d82,%rbx
+  802a7d:	00 00 00 
+  802a80:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802a82:	4c 89 e6             	mov    %r12,%rsi
+  802a85:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802a8c:	00 00 00 
+  802a8f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802a91:	be 00 00 00 00       	mov    $0x0,%esi
+  802a96:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a9b:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aae:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ab1:	5b                   	pop    %rbx
+  802ab2:	41 5c                	pop    %r12
+  802ab4:	5d                   	pop    %rbp
+  802ab5:	c3                   	ret
+        return -E_INVAL;
+  802ab6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802abb:	eb f4                	jmp    802ab1 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802abd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac2:	eb ed                	jmp    802ab1 <devfile_create_snapshot+0x8e>
+  802ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac9:	eb e6                	jmp    802ab1 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ad0:	c3                   	ret
+
+0000000000802ad1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ad1:	55                   	push   %rbp
+  802ad2:	48 89 e5             	mov    %rsp,%rbp
+  802ad5:	41 54                	push   %r12
+  802ad7:	53                   	push   %rbx
+  802ad8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802adb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802ade:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802ae5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802ae7:	be 00 00 00 00       	mov    $0x0,%esi
+  802aec:	bf 05 00 00 00       	mov    $0x5,%edi
+  802af1:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802af8:	00 00 00 
+  802afb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802afd:	85 c0                	test   %eax,%eax
+  802aff:	78 3d                	js     802b3e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b01:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802b08:	00 00 00 
+  802b0b:	4c 89 e6             	mov    %r12,%rsi
+  802b0e:	48 89 df             	mov    %rbx,%rdi
+  802b11:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b1d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b24:	00 
+  802b25:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b2b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b32:	00 
+  802b33:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3e:	5b                   	pop    %rbx
+  802b3f:	41 5c                	pop    %r12
+  802b41:	5d                   	pop    %rbp
+  802b42:	c3                   	ret
+
+0000000000802b43 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802b43:	55                   	push   %rbp
+  802b44:	48 89 e5             	mov    %rsp,%rbp
+  802b47:	41 57                	push   %r15
+  802b49:	41 56                	push   %r14
+  802b4b:	41 55                	push   %r13
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 83 ec 38          	sub    $0x38,%rsp
+  802b54:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802b58:	49 89 f5             	mov    %rsi,%r13
+  802b5b:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b5e:	48 89 f0             	mov    %rsi,%rax
+  802b61:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b66:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b6a:	75 4f                	jne    802bbb <devfile_readmap+0x78>
+  802b6c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b70:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b76:	75 1f                	jne    802b97 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802b78:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b7c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b80:	49 be cf 34 80 00 00 	movabs $0x8034cf,%r14
+  802b87:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b8a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802b91:	0f 87 9d 00 00 00    	ja     802c34 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802b97:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b9b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802b9f:	4d 85 ff             	test   %r15,%r15
+  802ba2:	0f 85 cf 00 00 00    	jne    802c77 <devfile_readmap+0x134>
+  802ba8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802bac:	48 83 c4 38          	add    $0x38,%rsp
+  802bb0:	5b                   	pop    %rbx
+  802bb1:	41 5c                	pop    %r12
+  802bb3:	41 5d                	pop    %r13
+  802bb5:	41 5e                	pop    %r14
+  802bb7:	41 5f                	pop    %r15
+  802bb9:	5d                   	pop    %rbp
+  802bba:	c3                   	ret
+    size_t totalRead = 0;
+  802bbb:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802bc2:	00 
+  802bc3:	eb da                	jmp    802b9f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bc5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bc9:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bcc:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802bd3:	00 00 00 
+  802bd6:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802bd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bdc:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802be0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802be4:	4c 89 ee             	mov    %r13,%rsi
+  802be7:	bf 14 00 00 00       	mov    $0x14,%edi
+  802bec:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  802bf3:	00 00 00 
+  802bf6:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	7e a3                	jle    802b9f <devfile_readmap+0x5c>
+  802bfc:	48 98                	cltq
+  802bfe:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c02:	72 9b                	jb     802b9f <devfile_readmap+0x5c>
+        buf += read;
+  802c04:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c07:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c0a:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c0e:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c15:	75 88                	jne    802b9f <devfile_readmap+0x5c>
+  802c17:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c1b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c21:	0f 85 78 ff ff ff    	jne    802b9f <devfile_readmap+0x5c>
+  802c27:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802c2e:	0f 86 6b ff ff ff    	jbe    802b9f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802c34:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802c3a:	4d 39 e7             	cmp    %r12,%r15
+  802c3d:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802c41:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802c48:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c4c:	0f 84 73 ff ff ff    	je     802bc5 <devfile_readmap+0x82>
+  802c52:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c56:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802c5b:	41 ff d6             	call   *%r14
+  802c5e:	a8 40                	test   $0x40,%al
+  802c60:	0f 85 39 ff ff ff    	jne    802b9f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c66:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c6d:	4c 39 e3             	cmp    %r12,%rbx
+  802c70:	72 e4                	jb     802c56 <devfile_readmap+0x113>
+  802c72:	e9 4e ff ff ff       	jmp    802bc5 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802c77:	4c 89 fa             	mov    %r15,%rdx
+  802c7a:	4c 89 ee             	mov    %r13,%rsi
+  802c7d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c81:	48 b8 c4 25 80 00 00 	movabs $0x8025c4,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802c8d:	48 85 c0             	test   %rax,%rax
+  802c90:	78 0c                	js     802c9e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802c92:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c96:	48 01 f0             	add    %rsi,%rax
+  802c99:	e9 0e ff ff ff       	jmp    802bac <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802c9e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ca2:	48 85 f6             	test   %rsi,%rsi
+  802ca5:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ca9:	e9 fe fe ff ff       	jmp    802bac <devfile_readmap+0x69>
+
+0000000000802cae <open>:
+open(const char *path, int mode) {
+  802cae:	55                   	push   %rbp
+  802caf:	48 89 e5             	mov    %rsp,%rbp
+  802cb2:	41 55                	push   %r13
+  802cb4:	41 54                	push   %r12
+  802cb6:	53                   	push   %rbx
+  802cb7:	48 83 ec 18          	sub    $0x18,%rsp
+  802cbb:	49 89 fc             	mov    %rdi,%r12
+  802cbe:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cc1:	48 b8 44 0d 80 00 00 	movabs $0x800d44,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  802ccd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cd3:	0f 87 8a 00 00 00    	ja     802d63 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802cd9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802cdd:	48 b8 0c 18 80 00 00 	movabs $0x80180c,%rax
+  802ce4:	00 00 00 
+  802ce7:	ff d0                	call   *%rax
+  802ce9:	89 c3                	mov    %eax,%ebx
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 50                	js     802d3f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802cef:	4c 89 e6             	mov    %r12,%rsi
+  802cf2:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802cf9:	00 00 00 
+  802cfc:	48 89 df             	mov    %rbx,%rdi
+  802cff:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  802d06:	00 00 00 
+  802d09:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d0b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d12:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d16:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d1b:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+  802d27:	89 c3                	mov    %eax,%ebx
+  802d29:	85 c0                	test   %eax,%eax
+  802d2b:	78 1f                	js     802d4c <open+0x9e>
+    return fd2num(fd);
+  802d2d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d31:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  802d38:	00 00 00 
+  802d3b:	ff d0                	call   *%rax
+  802d3d:	89 c3                	mov    %eax,%ebx
+}
+  802d3f:	89 d8                	mov    %ebx,%eax
+  802d41:	48 83 c4 18          	add    $0x18,%rsp
+  802d45:	5b                   	pop    %rbx
+  802d46:	41 5c                	pop    %r12
+  802d48:	41 5d                	pop    %r13
+  802d4a:	5d                   	pop    %rbp
+  802d4b:	c3                   	ret
+        fd_close(fd, 0);
+  802d4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d51:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d55:	48 b8 27 19 80 00 00 	movabs $0x801927,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+        return res;
+  802d61:	eb dc                	jmp    802d3f <open+0x91>
+        return -E_BAD_PATH;
+  802d63:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d68:	eb d5                	jmp    802d3f <open+0x91>
+
+0000000000802d6a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802d6a:	55                   	push   %rbp
+  802d6b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d73:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d78:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802d7f:	00 00 00 
+  802d82:	ff d0                	call   *%rax
+}
+  802d84:	5d                   	pop    %rbp
+  802d85:	c3                   	ret
+
+0000000000802d86 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802d86:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802d8a:	7f 01                	jg     802d8d <writebuf+0x7>
+  802d8c:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802d8d:	55                   	push   %rbp
+  802d8e:	48 89 e5             	mov    %rsp,%rbp
+  802d91:	53                   	push   %rbx
+  802d92:	48 83 ec 08          	sub    $0x8,%rsp
+  802d96:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802d99:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802d9d:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802da1:	8b 3f                	mov    (%rdi),%edi
+  802da3:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  802daa:	00 00 00 
+  802dad:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802daf:	48 85 c0             	test   %rax,%rax
+  802db2:	7e 04                	jle    802db8 <writebuf+0x32>
+  802db4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802db8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802dbc:	48 39 c2             	cmp    %rax,%rdx
+  802dbf:	74 0f                	je     802dd0 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802dc1:	48 85 c0             	test   %rax,%rax
+  802dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802dcd:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802dd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dd4:	c9                   	leave
+  802dd5:	c3                   	ret
+
+0000000000802dd6 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802dd6:	8b 46 04             	mov    0x4(%rsi),%eax
+  802dd9:	8d 50 01             	lea    0x1(%rax),%edx
+  802ddc:	89 56 04             	mov    %edx,0x4(%rsi)
+  802ddf:	48 98                	cltq
+  802de1:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802de6:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802dec:	74 01                	je     802def <putch+0x19>
+  802dee:	c3                   	ret
+putch(int ch, void *arg) {
+  802def:	55                   	push   %rbp
+  802df0:	48 89 e5             	mov    %rsp,%rbp
+  802df3:	53                   	push   %rbx
+  802df4:	48 83 ec 08          	sub    $0x8,%rsp
+  802df8:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802dfb:	48 89 f7             	mov    %rsi,%rdi
+  802dfe:	48 b8 86 2d 80 00 00 	movabs $0x802d86,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+        state->offset = 0;
+  802e0a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802e11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+
+0000000000802e17 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802e17:	55                   	push   %rbp
+  802e18:	48 89 e5             	mov    %rsp,%rbp
+  802e1b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802e22:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802e25:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802e2b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802e32:	00 00 00 
+    state.result = 0;
+  802e35:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802e3c:	00 00 00 00 
+    state.error = 1;
+  802e40:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802e47:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802e4a:	48 89 f2             	mov    %rsi,%rdx
+  802e4d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802e54:	48 bf d6 2d 80 00 00 	movabs $0x802dd6,%rdi
+  802e5b:	00 00 00 
+  802e5e:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802e6a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802e71:	7f 14                	jg     802e87 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802e73:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802e7a:	48 85 c0             	test   %rax,%rax
+  802e7d:	75 06                	jne    802e85 <vfprintf+0x6e>
+  802e7f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802e87:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802e8e:	48 b8 86 2d 80 00 00 	movabs $0x802d86,%rax
+  802e95:	00 00 00 
+  802e98:	ff d0                	call   *%rax
+  802e9a:	eb d7                	jmp    802e73 <vfprintf+0x5c>
+
+0000000000802e9c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802e9c:	55                   	push   %rbp
+  802e9d:	48 89 e5             	mov    %rsp,%rbp
+  802ea0:	48 83 ec 50          	sub    $0x50,%rsp
+  802ea4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802ea8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802eac:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802eb0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802eb4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802ebb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ebf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802ec7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802ecb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802ecf:	48 b8 17 2e 80 00 00 	movabs $0x802e17,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+
+0000000000802edd <printf>:
+
+int
+printf(const char *fmt, ...) {
+  802edd:	55                   	push   %rbp
+  802ede:	48 89 e5             	mov    %rsp,%rbp
+  802ee1:	48 83 ec 50          	sub    $0x50,%rsp
+  802ee5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802ee9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802eed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ef1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ef5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802ef9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802f00:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f08:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802f10:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802f14:	48 89 fe             	mov    %rdi,%rsi
+  802f17:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f1c:	48 b8 17 2e 80 00 00 	movabs $0x802e17,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+0000000000802f2a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+  802f2e:	41 54                	push   %r12
+  802f30:	53                   	push   %rbx
+  802f31:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f34:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+  802f40:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f43:	48 be e0 40 80 00 00 	movabs $0x8040e0,%rsi
+  802f4a:	00 00 00 
+  802f4d:	48 89 df             	mov    %rbx,%rdi
+  802f50:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f5c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f61:	41 2b 04 24          	sub    (%r12),%eax
+  802f65:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f6b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f72:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f75:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f7c:	00 00 00 
+  802f7f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8b:	5b                   	pop    %rbx
+  802f8c:	41 5c                	pop    %r12
+  802f8e:	5d                   	pop    %rbp
+  802f8f:	c3                   	ret
+
+0000000000802f90 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f90:	55                   	push   %rbp
+  802f91:	48 89 e5             	mov    %rsp,%rbp
+  802f94:	41 54                	push   %r12
+  802f96:	53                   	push   %rbx
+  802f97:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f9f:	48 89 fe             	mov    %rdi,%rsi
+  802fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa7:	49 bc da 14 80 00 00 	movabs $0x8014da,%r12
+  802fae:	00 00 00 
+  802fb1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fb4:	48 89 df             	mov    %rbx,%rdi
+  802fb7:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	48 89 c6             	mov    %rax,%rsi
+  802fc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd0:	41 ff d4             	call   *%r12
+}
+  802fd3:	5b                   	pop    %rbx
+  802fd4:	41 5c                	pop    %r12
+  802fd6:	5d                   	pop    %rbp
+  802fd7:	c3                   	ret
+
+0000000000802fd8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fd8:	55                   	push   %rbp
+  802fd9:	48 89 e5             	mov    %rsp,%rbp
+  802fdc:	41 57                	push   %r15
+  802fde:	41 56                	push   %r14
+  802fe0:	41 55                	push   %r13
+  802fe2:	41 54                	push   %r12
+  802fe4:	53                   	push   %rbx
+  802fe5:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe9:	49 89 fc             	mov    %rdi,%r12
+  802fec:	49 89 f5             	mov    %rsi,%r13
+  802fef:	49 89 d7             	mov    %rdx,%r15
+  802ff2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ff6:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  802ffd:	00 00 00 
+  803000:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803002:	4d 85 ff             	test   %r15,%r15
+  803005:	0f 84 af 00 00 00    	je     8030ba <devpipe_write+0xe2>
+  80300b:	48 89 c3             	mov    %rax,%rbx
+  80300e:	4c 89 f8             	mov    %r15,%rax
+  803011:	4d 89 ef             	mov    %r13,%r15
+  803014:	4c 01 e8             	add    %r13,%rax
+  803017:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80301b:	49 bd e2 13 80 00 00 	movabs $0x8013e2,%r13
+  803022:	00 00 00 
+            sys_yield();
+  803025:	49 be 7f 13 80 00 00 	movabs $0x80137f,%r14
+  80302c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80302f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803032:	48 63 ce             	movslq %esi,%rcx
+  803035:	48 63 03             	movslq (%rbx),%rax
+  803038:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80303e:	48 39 c1             	cmp    %rax,%rcx
+  803041:	72 2e                	jb     803071 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803043:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803048:	48 89 da             	mov    %rbx,%rdx
+  80304b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803050:	4c 89 e7             	mov    %r12,%rdi
+  803053:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803056:	85 c0                	test   %eax,%eax
+  803058:	74 66                	je     8030c0 <devpipe_write+0xe8>
+            sys_yield();
+  80305a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80305d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803060:	48 63 ce             	movslq %esi,%rcx
+  803063:	48 63 03             	movslq (%rbx),%rax
+  803066:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80306c:	48 39 c1             	cmp    %rax,%rcx
+  80306f:	73 d2                	jae    803043 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803071:	41 0f b6 3f          	movzbl (%r15),%edi
+  803075:	48 89 ca             	mov    %rcx,%rdx
+  803078:	48 c1 ea 03          	shr    $0x3,%rdx
+  80307c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803083:	08 10 20 
+  803086:	48 f7 e2             	mul    %rdx
+  803089:	48 c1 ea 06          	shr    $0x6,%rdx
+  80308d:	48 89 d0             	mov    %rdx,%rax
+  803090:	48 c1 e0 09          	shl    $0x9,%rax
+  803094:	48 29 d0             	sub    %rdx,%rax
+  803097:	48 c1 e0 03          	shl    $0x3,%rax
+  80309b:	48 29 c1             	sub    %rax,%rcx
+  80309e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030a3:	83 c6 01             	add    $0x1,%esi
+  8030a6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030a9:	49 83 c7 01          	add    $0x1,%r15
+  8030ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030b1:	49 39 c7             	cmp    %rax,%r15
+  8030b4:	0f 85 75 ff ff ff    	jne    80302f <devpipe_write+0x57>
+    return n;
+  8030ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030be:	eb 05                	jmp    8030c5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c5:	48 83 c4 18          	add    $0x18,%rsp
+  8030c9:	5b                   	pop    %rbx
+  8030ca:	41 5c                	pop    %r12
+  8030cc:	41 5d                	pop    %r13
+  8030ce:	41 5e                	pop    %r14
+  8030d0:	41 5f                	pop    %r15
+  8030d2:	5d                   	pop    %rbp
+  8030d3:	c3                   	ret
+
+00000000008030d4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030d4:	55                   	push   %rbp
+  8030d5:	48 89 e5             	mov    %rsp,%rbp
+  8030d8:	41 57                	push   %r15
+  8030da:	41 56                	push   %r14
+  8030dc:	41 55                	push   %r13
+  8030de:	41 54                	push   %r12
+  8030e0:	53                   	push   %rbx
+  8030e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8030e5:	49 89 fc             	mov    %rdi,%r12
+  8030e8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030f0:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  8030f7:	00 00 00 
+  8030fa:	ff d0                	call   *%rax
+  8030fc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8030ff:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803105:	49 bd e2 13 80 00 00 	movabs $0x8013e2,%r13
+  80310c:	00 00 00 
+            sys_yield();
+  80310f:	49 be 7f 13 80 00 00 	movabs $0x80137f,%r14
+  803116:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803119:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80311e:	74 7d                	je     80319d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803120:	8b 03                	mov    (%rbx),%eax
+  803122:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803125:	75 26                	jne    80314d <devpipe_read+0x79>
+            if (i > 0) return i;
+  803127:	4d 85 ff             	test   %r15,%r15
+  80312a:	75 77                	jne    8031a3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80312c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803131:	48 89 da             	mov    %rbx,%rdx
+  803134:	be 00 10 00 00       	mov    $0x1000,%esi
+  803139:	4c 89 e7             	mov    %r12,%rdi
+  80313c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80313f:	85 c0                	test   %eax,%eax
+  803141:	74 72                	je     8031b5 <devpipe_read+0xe1>
+            sys_yield();
+  803143:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803146:	8b 03                	mov    (%rbx),%eax
+  803148:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80314b:	74 df                	je     80312c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80314d:	48 63 c8             	movslq %eax,%rcx
+  803150:	48 89 ca             	mov    %rcx,%rdx
+  803153:	48 c1 ea 03          	shr    $0x3,%rdx
+  803157:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80315e:	08 10 20 
+  803161:	48 89 d0             	mov    %rdx,%rax
+  803164:	48 f7 e6             	mul    %rsi
+  803167:	48 c1 ea 06          	shr    $0x6,%rdx
+  80316b:	48 89 d0             	mov    %rdx,%rax
+  80316e:	48 c1 e0 09          	shl    $0x9,%rax
+  803172:	48 29 d0             	sub    %rdx,%rax
+  803175:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80317c:	00 
+  80317d:	48 89 c8             	mov    %rcx,%rax
+  803180:	48 29 d0             	sub    %rdx,%rax
+  803183:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803188:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80318c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803190:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803193:	49 83 c7 01          	add    $0x1,%r15
+  803197:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80319b:	75 83                	jne    803120 <devpipe_read+0x4c>
+    return n;
+  80319d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031a1:	eb 03                	jmp    8031a6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031a3:	4c 89 f8             	mov    %r15,%rax
+}
+  8031a6:	48 83 c4 18          	add    $0x18,%rsp
+  8031aa:	5b                   	pop    %rbx
+  8031ab:	41 5c                	pop    %r12
+  8031ad:	41 5d                	pop    %r13
+  8031af:	41 5e                	pop    %r14
+  8031b1:	41 5f                	pop    %r15
+  8031b3:	5d                   	pop    %rbp
+  8031b4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ba:	eb ea                	jmp    8031a6 <devpipe_read+0xd2>
+
+00000000008031bc <pipe>:
+pipe(int pfd[2]) {
+  8031bc:	55                   	push   %rbp
+  8031bd:	48 89 e5             	mov    %rsp,%rbp
+  8031c0:	41 55                	push   %r13
+  8031c2:	41 54                	push   %r12
+  8031c4:	53                   	push   %rbx
+  8031c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8031c9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031cc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031d0:	48 b8 0c 18 80 00 00 	movabs $0x80180c,%rax
+  8031d7:	00 00 00 
+  8031da:	ff d0                	call   *%rax
+  8031dc:	89 c3                	mov    %eax,%ebx
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	0f 88 a0 01 00 00    	js     803386 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8031e6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031f0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f9:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  803200:	00 00 00 
+  803203:	ff d0                	call   *%rax
+  803205:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803207:	85 c0                	test   %eax,%eax
+  803209:	0f 88 77 01 00 00    	js     803386 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80320f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803213:	48 b8 0c 18 80 00 00 	movabs $0x80180c,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+  80321f:	89 c3                	mov    %eax,%ebx
+  803221:	85 c0                	test   %eax,%eax
+  803223:	0f 88 43 01 00 00    	js     80336c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803229:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80322e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803233:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803237:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323c:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  803243:	00 00 00 
+  803246:	ff d0                	call   *%rax
+  803248:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	0f 88 1a 01 00 00    	js     80336c <pipe+0x1b0>
+    va = fd2data(fd0);
+  803252:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803256:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+  803262:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803265:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80326a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80326f:	48 89 c6             	mov    %rax,%rsi
+  803272:	bf 00 00 00 00       	mov    $0x0,%edi
+  803277:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	89 c3                	mov    %eax,%ebx
+  803285:	85 c0                	test   %eax,%eax
+  803287:	0f 88 c5 00 00 00    	js     803352 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80328d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803291:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+  80329d:	48 89 c1             	mov    %rax,%rcx
+  8032a0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032a6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b1:	4c 89 ee             	mov    %r13,%rsi
+  8032b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b9:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  8032c0:	00 00 00 
+  8032c3:	ff d0                	call   *%rax
+  8032c5:	89 c3                	mov    %eax,%ebx
+  8032c7:	85 c0                	test   %eax,%eax
+  8032c9:	78 6e                	js     803339 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032d0:	4c 89 ef             	mov    %r13,%rdi
+  8032d3:	48 b8 b0 13 80 00 00 	movabs $0x8013b0,%rax
+  8032da:	00 00 00 
+  8032dd:	ff d0                	call   *%rax
+  8032df:	83 f8 02             	cmp    $0x2,%eax
+  8032e2:	0f 85 ab 00 00 00    	jne    803393 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8032e8:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8032ef:	00 00 
+  8032f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032f5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8032f7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032fb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803302:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803306:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803308:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80330c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803313:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803317:	48 bb de 17 80 00 00 	movabs $0x8017de,%rbx
+  80331e:	00 00 00 
+  803321:	ff d3                	call   *%rbx
+  803323:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803327:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80332b:	ff d3                	call   *%rbx
+  80332d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803337:	eb 4d                	jmp    803386 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803339:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80333e:	4c 89 ee             	mov    %r13,%rsi
+  803341:	bf 00 00 00 00       	mov    $0x0,%edi
+  803346:	48 b8 da 14 80 00 00 	movabs $0x8014da,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803352:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803357:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80335b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803360:	48 b8 da 14 80 00 00 	movabs $0x8014da,%rax
+  803367:	00 00 00 
+  80336a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80336c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803371:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803375:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337a:	48 b8 da 14 80 00 00 	movabs $0x8014da,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+}
+  803386:	89 d8                	mov    %ebx,%eax
+  803388:	48 83 c4 18          	add    $0x18,%rsp
+  80338c:	5b                   	pop    %rbx
+  80338d:	41 5c                	pop    %r12
+  80338f:	41 5d                	pop    %r13
+  803391:	5d                   	pop    %rbp
+  803392:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803393:	48 b9 10 41 80 00 00 	movabs $0x804110,%rcx
+  80339a:	00 00 00 
+  80339d:	48 ba e7 40 80 00 00 	movabs $0x8040e7,%rdx
+  8033a4:	00 00 00 
+  8033a7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033ac:	48 bf fc 40 80 00 00 	movabs $0x8040fc,%rdi
+  8033b3:	00 00 00 
+  8033b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bb:	49 b8 0d 03 80 00 00 	movabs $0x80030d,%r8
+  8033c2:	00 00 00 
+  8033c5:	41 ff d0             	call   *%r8
+
+00000000008033c8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033c8:	55                   	push   %rbp
+  8033c9:	48 89 e5             	mov    %rsp,%rbp
+  8033cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033d4:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033e0:	85 c0                	test   %eax,%eax
+  8033e2:	78 35                	js     803419 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8033e4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033e8:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+  8033f4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803401:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803405:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  80340c:	00 00 00 
+  80340f:	ff d0                	call   *%rax
+  803411:	85 c0                	test   %eax,%eax
+  803413:	0f 94 c0             	sete   %al
+  803416:	0f b6 c0             	movzbl %al,%eax
+}
+  803419:	c9                   	leave
+  80341a:	c3                   	ret
+
+000000000080341b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80341b:	48 89 f8             	mov    %rdi,%rax
+  80341e:	48 c1 e8 27          	shr    $0x27,%rax
+  803422:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803429:	01 00 00 
+  80342c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803430:	f6 c2 01             	test   $0x1,%dl
+  803433:	74 6d                	je     8034a2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803435:	48 89 f8             	mov    %rdi,%rax
+  803438:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80343c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803443:	01 00 00 
+  803446:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80344a:	f6 c2 01             	test   $0x1,%dl
+  80344d:	74 62                	je     8034b1 <get_uvpt_entry+0x96>
+  80344f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803456:	01 00 00 
+  803459:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80345d:	f6 c2 80             	test   $0x80,%dl
+  803460:	75 4f                	jne    8034b1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803462:	48 89 f8             	mov    %rdi,%rax
+  803465:	48 c1 e8 15          	shr    $0x15,%rax
+  803469:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803470:	01 00 00 
+  803473:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803477:	f6 c2 01             	test   $0x1,%dl
+  80347a:	74 44                	je     8034c0 <get_uvpt_entry+0xa5>
+  80347c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803483:	01 00 00 
+  803486:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80348a:	f6 c2 80             	test   $0x80,%dl
+  80348d:	75 31                	jne    8034c0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80348f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803493:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80349a:	01 00 00 
+  80349d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034a1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034a2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034a9:	01 00 00 
+  8034ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034b0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034b1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034b8:	01 00 00 
+  8034bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034bf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034c7:	01 00 00 
+  8034ca:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034ce:	c3                   	ret
+
+00000000008034cf <get_prot>:
+
+int
+get_prot(void *va) {
+  8034cf:	55                   	push   %rbp
+  8034d0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034d3:	48 b8 1b 34 80 00 00 	movabs $0x80341b,%rax
+  8034da:	00 00 00 
+  8034dd:	ff d0                	call   *%rax
+  8034df:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034e2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034e7:	89 c1                	mov    %eax,%ecx
+  8034e9:	83 c9 04             	or     $0x4,%ecx
+  8034ec:	f6 c2 01             	test   $0x1,%dl
+  8034ef:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034f2:	89 c1                	mov    %eax,%ecx
+  8034f4:	83 c9 02             	or     $0x2,%ecx
+  8034f7:	f6 c2 02             	test   $0x2,%dl
+  8034fa:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8034fd:	89 c1                	mov    %eax,%ecx
+  8034ff:	83 c9 01             	or     $0x1,%ecx
+  803502:	48 85 d2             	test   %rdx,%rdx
+  803505:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803508:	89 c1                	mov    %eax,%ecx
+  80350a:	83 c9 40             	or     $0x40,%ecx
+  80350d:	f6 c6 04             	test   $0x4,%dh
+  803510:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803513:	5d                   	pop    %rbp
+  803514:	c3                   	ret
+
+0000000000803515 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803515:	55                   	push   %rbp
+  803516:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803519:	48 b8 1b 34 80 00 00 	movabs $0x80341b,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803525:	48 c1 e8 06          	shr    $0x6,%rax
+  803529:	83 e0 01             	and    $0x1,%eax
+}
+  80352c:	5d                   	pop    %rbp
+  80352d:	c3                   	ret
+
+000000000080352e <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80352e:	55                   	push   %rbp
+  80352f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803532:	48 b8 1b 34 80 00 00 	movabs $0x80341b,%rax
+  803539:	00 00 00 
+  80353c:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80353e:	48 c1 e8 05          	shr    $0x5,%rax
+  803542:	83 e0 01             	and    $0x1,%eax
+}
+  803545:	5d                   	pop    %rbp
+  803546:	c3                   	ret
+
+0000000000803547 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803547:	55                   	push   %rbp
+  803548:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80354b:	48 b8 1b 34 80 00 00 	movabs $0x80341b,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+  803557:	83 e0 01             	and    $0x1,%eax
+}
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+
+000000000080355c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80355c:	55                   	push   %rbp
+  80355d:	48 89 e5             	mov    %rsp,%rbp
+  803560:	41 57                	push   %r15
+  803562:	41 56                	push   %r14
+  803564:	41 55                	push   %r13
+  803566:	41 54                	push   %r12
+  803568:	53                   	push   %rbx
+  803569:	48 83 ec 18          	sub    $0x18,%rsp
+  80356d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803571:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803575:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80357a:	49 bd 47 35 80 00 00 	movabs $0x803547,%r13
+  803581:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803584:	49 bf cf 34 80 00 00 	movabs $0x8034cf,%r15
+  80358b:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80358e:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803595:	00 00 00 
+  803598:	eb 0c                	jmp    8035a6 <foreach_shared_region+0x4a>
+  80359a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035a1:	4c 39 f3             	cmp    %r14,%rbx
+  8035a4:	74 2e                	je     8035d4 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035a6:	48 89 df             	mov    %rbx,%rdi
+  8035a9:	41 ff d5             	call   *%r13
+  8035ac:	84 c0                	test   %al,%al
+  8035ae:	74 ea                	je     80359a <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035b0:	48 89 df             	mov    %rbx,%rdi
+  8035b3:	41 ff d7             	call   *%r15
+  8035b6:	a8 40                	test   $0x40,%al
+  8035b8:	74 e0                	je     80359a <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035ba:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035c5:	48 89 df             	mov    %rbx,%rdi
+  8035c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035cc:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	79 c8                	jns    80359a <foreach_shared_region+0x3e>
+  8035d2:	eb 05                	jmp    8035d9 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035d9:	48 83 c4 18          	add    $0x18,%rsp
+  8035dd:	5b                   	pop    %rbx
+  8035de:	41 5c                	pop    %r12
+  8035e0:	41 5d                	pop    %r13
+  8035e2:	41 5e                	pop    %r14
+  8035e4:	41 5f                	pop    %r15
+  8035e6:	5d                   	pop    %rbp
+  8035e7:	c3                   	ret
+
+00000000008035e8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8035e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ed:	c3                   	ret
+
+00000000008035ee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8035ee:	55                   	push   %rbp
+  8035ef:	48 89 e5             	mov    %rsp,%rbp
+  8035f2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8035f5:	48 be 34 41 80 00 00 	movabs $0x804134,%rsi
+  8035fc:	00 00 00 
+  8035ff:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+    return 0;
+}
+  80360b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803610:	5d                   	pop    %rbp
+  803611:	c3                   	ret
+
+0000000000803612 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803612:	55                   	push   %rbp
+  803613:	48 89 e5             	mov    %rsp,%rbp
+  803616:	41 57                	push   %r15
+  803618:	41 56                	push   %r14
+  80361a:	41 55                	push   %r13
+  80361c:	41 54                	push   %r12
+  80361e:	53                   	push   %rbx
+  80361f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803626:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80362d:	48 85 d2             	test   %rdx,%rdx
+  803630:	74 7a                	je     8036ac <devcons_write+0x9a>
+  803632:	49 89 d6             	mov    %rdx,%r14
+  803635:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80363b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803640:	49 bf 7c 0f 80 00 00 	movabs $0x800f7c,%r15
+  803647:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80364a:	4c 89 f3             	mov    %r14,%rbx
+  80364d:	48 29 f3             	sub    %rsi,%rbx
+  803650:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803655:	48 39 c3             	cmp    %rax,%rbx
+  803658:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80365c:	4c 63 eb             	movslq %ebx,%r13
+  80365f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803666:	48 01 c6             	add    %rax,%rsi
+  803669:	4c 89 ea             	mov    %r13,%rdx
+  80366c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803673:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803676:	4c 89 ee             	mov    %r13,%rsi
+  803679:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803680:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  803687:	00 00 00 
+  80368a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80368c:	41 01 dc             	add    %ebx,%r12d
+  80368f:	49 63 f4             	movslq %r12d,%rsi
+  803692:	4c 39 f6             	cmp    %r14,%rsi
+  803695:	72 b3                	jb     80364a <devcons_write+0x38>
+    return res;
+  803697:	49 63 c4             	movslq %r12d,%rax
+}
+  80369a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8036a1:	5b                   	pop    %rbx
+  8036a2:	41 5c                	pop    %r12
+  8036a4:	41 5d                	pop    %r13
+  8036a6:	41 5e                	pop    %r14
+  8036a8:	41 5f                	pop    %r15
+  8036aa:	5d                   	pop    %rbp
+  8036ab:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036b2:	eb e3                	jmp    803697 <devcons_write+0x85>
+
+00000000008036b4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036b4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036bc:	48 85 c0             	test   %rax,%rax
+  8036bf:	74 55                	je     803716 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036c1:	55                   	push   %rbp
+  8036c2:	48 89 e5             	mov    %rsp,%rbp
+  8036c5:	41 55                	push   %r13
+  8036c7:	41 54                	push   %r12
+  8036c9:	53                   	push   %rbx
+  8036ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8036ce:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036d1:	48 bb b2 12 80 00 00 	movabs $0x8012b2,%rbx
+  8036d8:	00 00 00 
+  8036db:	49 bc 7f 13 80 00 00 	movabs $0x80137f,%r12
+  8036e2:	00 00 00 
+  8036e5:	eb 03                	jmp    8036ea <devcons_read+0x36>
+  8036e7:	41 ff d4             	call   *%r12
+  8036ea:	ff d3                	call   *%rbx
+  8036ec:	85 c0                	test   %eax,%eax
+  8036ee:	74 f7                	je     8036e7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8036f0:	48 63 d0             	movslq %eax,%rdx
+  8036f3:	78 13                	js     803708 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8036f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036fa:	83 f8 04             	cmp    $0x4,%eax
+  8036fd:	74 09                	je     803708 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8036ff:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803703:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803708:	48 89 d0             	mov    %rdx,%rax
+  80370b:	48 83 c4 08          	add    $0x8,%rsp
+  80370f:	5b                   	pop    %rbx
+  803710:	41 5c                	pop    %r12
+  803712:	41 5d                	pop    %r13
+  803714:	5d                   	pop    %rbp
+  803715:	c3                   	ret
+  803716:	48 89 d0             	mov    %rdx,%rax
+  803719:	c3                   	ret
+
+000000000080371a <cputchar>:
+cputchar(int ch) {
+  80371a:	55                   	push   %rbp
+  80371b:	48 89 e5             	mov    %rsp,%rbp
+  80371e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803722:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803726:	be 01 00 00 00       	mov    $0x1,%esi
+  80372b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80372f:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+}
+  80373b:	c9                   	leave
+  80373c:	c3                   	ret
+
+000000000080373d <getchar>:
+getchar(void) {
+  80373d:	55                   	push   %rbp
+  80373e:	48 89 e5             	mov    %rsp,%rbp
+  803741:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803745:	ba 01 00 00 00       	mov    $0x1,%edx
+  80374a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80374e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803753:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  80375a:	00 00 00 
+  80375d:	ff d0                	call   *%rax
+  80375f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803761:	85 c0                	test   %eax,%eax
+  803763:	78 06                	js     80376b <getchar+0x2e>
+  803765:	74 08                	je     80376f <getchar+0x32>
+  803767:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80376b:	89 d0                	mov    %edx,%eax
+  80376d:	c9                   	leave
+  80376e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80376f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803774:	eb f5                	jmp    80376b <getchar+0x2e>
+
+0000000000803776 <iscons>:
+iscons(int fdnum) {
+  803776:	55                   	push   %rbp
+  803777:	48 89 e5             	mov    %rsp,%rbp
+  80377a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80377e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803782:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80378e:	85 c0                	test   %eax,%eax
+  803790:	78 18                	js     8037aa <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803792:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803796:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80379d:	00 00 00 
+  8037a0:	8b 00                	mov    (%rax),%eax
+  8037a2:	39 02                	cmp    %eax,(%rdx)
+  8037a4:	0f 94 c0             	sete   %al
+  8037a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8037aa:	c9                   	leave
+  8037ab:	c3                   	ret
+
+00000000008037ac <opencons>:
+opencons(void) {
+  8037ac:	55                   	push   %rbp
+  8037ad:	48 89 e5             	mov    %rsp,%rbp
+  8037b0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037b4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037b8:	48 b8 0c 18 80 00 00 	movabs $0x80180c,%rax
+  8037bf:	00 00 00 
+  8037c2:	ff d0                	call   *%rax
+  8037c4:	85 c0                	test   %eax,%eax
+  8037c6:	78 49                	js     803811 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037d2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037db:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  8037e2:	00 00 00 
+  8037e5:	ff d0                	call   *%rax
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	78 26                	js     803811 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8037eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037ef:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8037f6:	00 00 
+  8037f8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8037fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037fe:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803805:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  80380c:	00 00 00 
+  80380f:	ff d0                	call   *%rax
+}
+  803811:	c9                   	leave
+  803812:	c3                   	ret
+
+0000000000803813 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803813:	55                   	push   %rbp
+  803814:	48 89 e5             	mov    %rsp,%rbp
+  803817:	41 55                	push   %r13
+  803819:	41 54                	push   %r12
+  80381b:	53                   	push   %rbx
+  80381c:	48 83 ec 08          	sub    $0x8,%rsp
+  803820:	49 89 fc             	mov    %rdi,%r12
+  803823:	48 89 f7             	mov    %rsi,%rdi
+  803826:	48 89 d3             	mov    %rdx,%rbx
+  803829:	49 89 cd             	mov    %rcx,%r13
+  80382c:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80382f:	48 85 f6             	test   %rsi,%rsi
+  803832:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803839:	00 00 00 
+  80383c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803840:	be 00 10 00 00       	mov    $0x1000,%esi
+  803845:	48 85 db             	test   %rbx,%rbx
+  803848:	74 03                	je     80384d <ipc_recv_timed+0x3a>
+  80384a:	48 8b 33             	mov    (%rbx),%rsi
+  80384d:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  803854:	00 00 00 
+  803857:	ff d0                	call   *%rax
+    if (res < 0) {
+  803859:	85 c0                	test   %eax,%eax
+  80385b:	78 75                	js     8038d2 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80385d:	4d 85 e4             	test   %r12,%r12
+  803860:	74 14                	je     803876 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803862:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  803869:	00 00 00 
+  80386c:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803872:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803876:	4d 85 ed             	test   %r13,%r13
+  803879:	74 14                	je     80388f <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80387b:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  803882:	00 00 00 
+  803885:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80388b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80388f:	48 85 db             	test   %rbx,%rbx
+  803892:	74 23                	je     8038b7 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803894:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80389b:	00 00 00 
+  80389e:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8038a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a9:	85 c9                	test   %ecx,%ecx
+  8038ab:	74 07                	je     8038b4 <ipc_recv_timed+0xa1>
+  8038ad:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8038b4:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8038b7:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8038be:	00 00 00 
+  8038c1:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8038c7:	48 83 c4 08          	add    $0x8,%rsp
+  8038cb:	5b                   	pop    %rbx
+  8038cc:	41 5c                	pop    %r12
+  8038ce:	41 5d                	pop    %r13
+  8038d0:	5d                   	pop    %rbp
+  8038d1:	c3                   	ret
+        if (from_env_store != NULL) {
+  8038d2:	4d 85 e4             	test   %r12,%r12
+  8038d5:	74 08                	je     8038df <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8038d7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038de:	00 
+        if (perm_store != NULL) {
+  8038df:	4d 85 ed             	test   %r13,%r13
+  8038e2:	74 08                	je     8038ec <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8038e4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8038eb:	00 
+        if (size != NULL) {
+  8038ec:	48 85 db             	test   %rbx,%rbx
+  8038ef:	74 d6                	je     8038c7 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8038f1:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8038f8:	eb cd                	jmp    8038c7 <ipc_recv_timed+0xb4>
+
+00000000008038fa <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8038fa:	55                   	push   %rbp
+  8038fb:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8038fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803904:	48 b8 13 38 80 00 00 	movabs $0x803813,%rax
+  80390b:	00 00 00 
+  80390e:	ff d0                	call   *%rax
+}
+  803910:	5d                   	pop    %rbp
+  803911:	c3                   	ret
+
+0000000000803912 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803912:	55                   	push   %rbp
+  803913:	48 89 e5             	mov    %rsp,%rbp
+  803916:	41 57                	push   %r15
+  803918:	41 56                	push   %r14
+  80391a:	41 55                	push   %r13
+  80391c:	41 54                	push   %r12
+  80391e:	53                   	push   %rbx
+  80391f:	48 83 ec 18          	sub    $0x18,%rsp
+  803923:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803926:	48 89 d3             	mov    %rdx,%rbx
+  803929:	49 89 cc             	mov    %rcx,%r12
+  80392c:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80392f:	48 85 d2             	test   %rdx,%rdx
+  803932:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803939:	00 00 00 
+  80393c:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803940:	89 f0                	mov    %esi,%eax
+  803942:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803946:	48 89 da             	mov    %rbx,%rdx
+  803949:	48 89 c6             	mov    %rax,%rsi
+  80394c:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+    while (res < 0) {
+  803958:	85 c0                	test   %eax,%eax
+  80395a:	79 65                	jns    8039c1 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80395c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80395f:	75 33                	jne    803994 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803961:	49 bf 7f 13 80 00 00 	movabs $0x80137f,%r15
+  803968:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80396b:	49 be 7c 16 80 00 00 	movabs $0x80167c,%r14
+  803972:	00 00 00 
+        sys_yield();
+  803975:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803978:	45 89 e8             	mov    %r13d,%r8d
+  80397b:	4c 89 e1             	mov    %r12,%rcx
+  80397e:	48 89 da             	mov    %rbx,%rdx
+  803981:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803985:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803988:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80398b:	85 c0                	test   %eax,%eax
+  80398d:	79 32                	jns    8039c1 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80398f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803992:	74 e1                	je     803975 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803994:	89 c1                	mov    %eax,%ecx
+  803996:	48 ba 40 41 80 00 00 	movabs $0x804140,%rdx
+  80399d:	00 00 00 
+  8039a0:	be 52 00 00 00       	mov    $0x52,%esi
+  8039a5:	48 bf 54 41 80 00 00 	movabs $0x804154,%rdi
+  8039ac:	00 00 00 
+  8039af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b4:	49 b8 0d 03 80 00 00 	movabs $0x80030d,%r8
+  8039bb:	00 00 00 
+  8039be:	41 ff d0             	call   *%r8
+    }
+}
+  8039c1:	48 83 c4 18          	add    $0x18,%rsp
+  8039c5:	5b                   	pop    %rbx
+  8039c6:	41 5c                	pop    %r12
+  8039c8:	41 5d                	pop    %r13
+  8039ca:	41 5e                	pop    %r14
+  8039cc:	41 5f                	pop    %r15
+  8039ce:	5d                   	pop    %rbp
+  8039cf:	c3                   	ret
+
+00000000008039d0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8039d0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8039d5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8039dc:	00 00 00 
+  8039df:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039e3:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039e7:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039eb:	48 01 ca             	add    %rcx,%rdx
+  8039ee:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8039f4:	39 fa                	cmp    %edi,%edx
+  8039f6:	74 12                	je     803a0a <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8039f8:	48 83 c0 01          	add    $0x1,%rax
+  8039fc:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a02:	75 db                	jne    8039df <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a09:	c3                   	ret
+            return envs[i].env_id;
+  803a0a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a0e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a12:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a16:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a1d:	00 00 00 
+  803a20:	48 01 d0             	add    %rdx,%rax
+  803a23:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a29:	c3                   	ret
+  803a2a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803a30 <__rodata_start>:
+  803a30:	25 35 64 20 00       	and    $0x206435,%eax
+  803a35:	77 72                	ja     803aa9 <__rodata_start+0x79>
+  803a37:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  803a3e:	6f 
+  803a3f:	72 20                	jb     803a61 <__rodata_start+0x31>
+  803a41:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  803a44:	79 69                	jns    803aaf <__rodata_start+0x7f>
+  803a46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a47:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a074c1 <__bss_end+0x251fe4c1>
+  803a4e:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  803a54:	2f                   	(bad)
+  803a55:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a56:	75 6d                	jne    803ac5 <__rodata_start+0x95>
+  803a58:	2e 63 00             	cs movsxd (%rax),%eax
+  803a5b:	65 72 72             	gs jb  803ad0 <__rodata_start+0xa0>
+  803a5e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a5f:	72 20                	jb     803a81 <__rodata_start+0x51>
+  803a61:	72 65                	jb     803ac8 <__rodata_start+0x98>
+  803a63:	61                   	(bad)
+  803a64:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  803a6b:	3a 
+  803a6c:	20 25 69 00 6e 75    	and    %ah,0x756e0069(%rip)        # 75ee3adb <__bss_end+0x756daadb>
+  803a72:	6d                   	insl   (%dx),%es:(%rdi)
+  803a73:	00 3c 73             	add    %bh,(%rbx,%rsi,2)
+  803a76:	74 64                	je     803adc <__rodata_start+0xac>
+  803a78:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  803a7f:	27                   	(bad)
+  803a80:	74 20                	je     803aa2 <__rodata_start+0x72>
+  803a82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a83:	70 65                	jo     803aea <__rodata_start+0xba>
+  803a85:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a86:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a074ff <__bss_end+0x251fe4ff>
+  803a8c:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  803a92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a94:	77 6e                	ja     803b04 <__rodata_start+0xd4>
+  803a96:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803a9a:	30 38                	xor    %bh,(%rax)
+  803a9c:	78 5d                	js     803afb <__rodata_start+0xcb>
+  803a9e:	20 75 73             	and    %dh,0x73(%rbp)
+  803aa1:	65 72 20             	gs jb  803ac4 <__rodata_start+0x94>
+  803aa4:	70 61                	jo     803b07 <__rodata_start+0xd7>
+  803aa6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aa7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803aae:	73 20                	jae    803ad0 <__rodata_start+0xa0>
+  803ab0:	61                   	(bad)
+  803ab1:	74 20                	je     803ad3 <__rodata_start+0xa3>
+  803ab3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803ab8:	3a 20                	cmp    (%rax),%ah
+  803aba:	00 30                	add    %dh,(%rax)
+  803abc:	31 32                	xor    %esi,(%rdx)
+  803abe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ac5:	41                   	rex.B
+  803ac6:	42                   	rex.X
+  803ac7:	43                   	rex.XB
+  803ac8:	44                   	rex.R
+  803ac9:	45                   	rex.RB
+  803aca:	46 00 30             	rex.RX add %r14b,(%rax)
+  803acd:	31 32                	xor    %esi,(%rdx)
+  803acf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ad6:	61                   	(bad)
+  803ad7:	62 63 64 65 66       	(bad)
+  803adc:	00 28                	add    %ch,(%rax)
+  803ade:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803adf:	75 6c                	jne    803b4d <__rodata_start+0x11d>
+  803ae1:	6c                   	insb   (%dx),%es:(%rdi)
+  803ae2:	29 00                	sub    %eax,(%rax)
+  803ae4:	65 72 72             	gs jb  803b59 <__rodata_start+0x129>
+  803ae7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ae8:	72 20                	jb     803b0a <__rodata_start+0xda>
+  803aea:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803aef:	73 70                	jae    803b61 <__rodata_start+0x131>
+  803af1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803af5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803afc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803afd:	72 00                	jb     803aff <__rodata_start+0xcf>
+  803aff:	62 61 64 20 65       	(bad)
+  803b04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b05:	76 69                	jbe    803b70 <__rodata_start+0x140>
+  803b07:	72 6f                	jb     803b78 <__rodata_start+0x148>
+  803b09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b0a:	6d                   	insl   (%dx),%es:(%rdi)
+  803b0b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b0d:	74 00                	je     803b0f <__rodata_start+0xdf>
+  803b0f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b16:	20 70 61             	and    %dh,0x61(%rax)
+  803b19:	72 61                	jb     803b7c <__rodata_start+0x14c>
+  803b1b:	6d                   	insl   (%dx),%es:(%rdi)
+  803b1c:	65 74 65             	gs je  803b84 <__rodata_start+0x154>
+  803b1f:	72 00                	jb     803b21 <__rodata_start+0xf1>
+  803b21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b22:	75 74                	jne    803b98 <__rodata_start+0x168>
+  803b24:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b27:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b2a:	6d                   	insl   (%dx),%es:(%rdi)
+  803b2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b2c:	72 79                	jb     803ba7 <__rodata_start+0x177>
+  803b2e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b31:	74 20                	je     803b53 <__rodata_start+0x123>
+  803b33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b34:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b38:	76 69                	jbe    803ba3 <__rodata_start+0x173>
+  803b3a:	72 6f                	jb     803bab <__rodata_start+0x17b>
+  803b3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b3d:	6d                   	insl   (%dx),%es:(%rdi)
+  803b3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b40:	74 73                	je     803bb5 <__rodata_start+0x185>
+  803b42:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b45:	72 72                	jb     803bb9 <__rodata_start+0x189>
+  803b47:	75 70                	jne    803bb9 <__rodata_start+0x189>
+  803b49:	74 65                	je     803bb0 <__rodata_start+0x180>
+  803b4b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b50:	75 67                	jne    803bb9 <__rodata_start+0x189>
+  803b52:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b55:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b57:	00 73 65             	add    %dh,0x65(%rbx)
+  803b5a:	67 6d                	insl   (%dx),%es:(%edi)
+  803b5c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b5e:	74 61                	je     803bc1 <__rodata_start+0x191>
+  803b60:	74 69                	je     803bcb <__rodata_start+0x19b>
+  803b62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b64:	20 66 61             	and    %ah,0x61(%rsi)
+  803b67:	75 6c                	jne    803bd5 <__rodata_start+0x1a5>
+  803b69:	74 00                	je     803b6b <__rodata_start+0x13b>
+  803b6b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b72:	20 45 4c             	and    %al,0x4c(%rbp)
+  803b75:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803b79:	61                   	(bad)
+  803b7a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803b7f:	20 73 75             	and    %dh,0x75(%rbx)
+  803b82:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803b85:	73 79                	jae    803c00 <__rodata_start+0x1d0>
+  803b87:	73 74                	jae    803bfd <__rodata_start+0x1cd>
+  803b89:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b8b:	20 63 61             	and    %ah,0x61(%rbx)
+  803b8e:	6c                   	insb   (%dx),%es:(%rdi)
+  803b8f:	6c                   	insb   (%dx),%es:(%rdi)
+  803b90:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803b93:	74 72                	je     803c07 <__rodata_start+0x1d7>
+  803b95:	79 20                	jns    803bb7 <__rodata_start+0x187>
+  803b97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b99:	74 20                	je     803bbb <__rodata_start+0x18b>
+  803b9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b9d:	75 6e                	jne    803c0d <__rodata_start+0x1dd>
+  803b9f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803ba3:	76 20                	jbe    803bc5 <__rodata_start+0x195>
+  803ba5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803bac:	72 65                	jb     803c13 <__rodata_start+0x1e3>
+  803bae:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803bb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803bb6:	65 78 70             	gs js  803c29 <__rodata_start+0x1f9>
+  803bb9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803bbe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803bc1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803bc5:	20 66 69             	and    %ah,0x69(%rsi)
+  803bc8:	6c                   	insb   (%dx),%es:(%rdi)
+  803bc9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803bcd:	20 66 72             	and    %ah,0x72(%rsi)
+  803bd0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803bd5:	61                   	(bad)
+  803bd6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803bd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bdb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803bdf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803be2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be4:	20 6d 61             	and    %ch,0x61(%rbp)
+  803be7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803be8:	79 20                	jns    803c0a <__rodata_start+0x1da>
+  803bea:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803bf1:	72 65                	jb     803c58 <__rodata_start+0x228>
+  803bf3:	20 6f 70             	and    %ch,0x70(%rdi)
+  803bf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bf8:	00 66 69             	add    %ah,0x69(%rsi)
+  803bfb:	6c                   	insb   (%dx),%es:(%rdi)
+  803bfc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c00:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c04:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c09:	74 20                	je     803c2b <__rodata_start+0x1fb>
+  803c0b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c0d:	75 6e                	jne    803c7d <__rodata_start+0x24d>
+  803c0f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c13:	76 61                	jbe    803c76 <__rodata_start+0x246>
+  803c15:	6c                   	insb   (%dx),%es:(%rdi)
+  803c16:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c1d:	00 
+  803c1e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c25:	72 65                	jb     803c8c <__rodata_start+0x25c>
+  803c27:	61                   	(bad)
+  803c28:	64 79 20             	fs jns 803c4b <__rodata_start+0x21b>
+  803c2b:	65 78 69             	gs js  803c97 <__rodata_start+0x267>
+  803c2e:	73 74                	jae    803ca4 <__rodata_start+0x274>
+  803c30:	73 00                	jae    803c32 <__rodata_start+0x202>
+  803c32:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c33:	70 65                	jo     803c9a <__rodata_start+0x26a>
+  803c35:	72 61                	jb     803c98 <__rodata_start+0x268>
+  803c37:	74 69                	je     803ca2 <__rodata_start+0x272>
+  803c39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c3b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c3e:	74 20                	je     803c60 <__rodata_start+0x230>
+  803c40:	73 75                	jae    803cb7 <__rodata_start+0x287>
+  803c42:	70 70                	jo     803cb4 <__rodata_start+0x284>
+  803c44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c45:	72 74                	jb     803cbb <__rodata_start+0x28b>
+  803c47:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803c4d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803c52:	74 00                	je     803c54 <__rodata_start+0x224>
+  803c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c5b:	00 00 00 
+  803c5e:	66 90                	xchg   %ax,%ax
+  803c60:	4a 06                	rex.WX (bad)
+  803c62:	80 00 00             	addb   $0x0,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 7b 0c             	add    %bh,0xc(%rbx)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 69 06             	add    %ch,0x6(%rcx)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 5d 06             	add    %bl,0x6(%rbp)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 d7                	add    %dl,%bh
+  803cb9:	06                   	(bad)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 5d 06             	add    %bl,0x6(%rbp)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 ae 0b 80 00 00    	add    %ch,0x800b(%rsi)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 fa                	add    %bh,%dl
+  803e61:	06                   	(bad)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 c9                	add    %cl,%cl
+  803e69:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803e6f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 29                	add    %ch,(%rcx)
+  803e91:	07                   	(bad)
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 ef                	add    %ch,%bh
+  803ea9:	06                   	(bad)
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 71 0a             	add    %dh,0xa(%rcx)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 3b                	add    %bh,(%rbx)
+  803ec9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ecf:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 c0                	add    %al,%al
+  803ee1:	07                   	(bad)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 9d 09 80 00 00    	add    %bl,0x8009(%rbp)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 ae 0b 80 00 00    	add    %ch,0x800b(%rsi)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 8b 0c 80 00 00    	add    %cl,0x800c(%rbx)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 53 06             	add    %dl,0x6(%rbx)
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f20 <error_string>:
+	...
+  803f28:	ed 3a 80 00 00 00 00 00 ff 3a 80 00 00 00 00 00     .:.......:......
+  803f38:	0f 3b 80 00 00 00 00 00 21 3b 80 00 00 00 00 00     .;......!;......
+  803f48:	2f 3b 80 00 00 00 00 00 43 3b 80 00 00 00 00 00     /;......C;......
+  803f58:	58 3b 80 00 00 00 00 00 6b 3b 80 00 00 00 00 00     X;......k;......
+  803f68:	7d 3b 80 00 00 00 00 00 91 3b 80 00 00 00 00 00     };.......;......
+  803f78:	a1 3b 80 00 00 00 00 00 b4 3b 80 00 00 00 00 00     .;.......;......
+  803f88:	cb 3b 80 00 00 00 00 00 e1 3b 80 00 00 00 00 00     .;.......;......
+  803f98:	f9 3b 80 00 00 00 00 00 11 3c 80 00 00 00 00 00     .;.......<......
+  803fa8:	1e 3c 80 00 00 00 00 00 c8 3f 80 00 00 00 00 00     .<.......?......
+  803fb8:	32 3c 80 00 00 00 00 00 4a 3c 80 00 00 00 00 00     2<......J<......
+  803fc8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803fd8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803fe8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803ff8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804008:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804018:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804028:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804038:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804048:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804058:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804068:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804078:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804088:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804098:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8040a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8040b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008040c0 <devtab>:
+  8040c0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  8040d0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8040e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8040f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804100:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804110:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804120:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804130:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804140:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804150:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804160:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804170:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804180:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804190:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8041e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804200:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804210:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804220:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
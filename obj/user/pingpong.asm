@@ -0,0 +1,7048 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 01 00 00       	call   800136 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800036:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 93 00 00 00    	jne    8000e0 <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004d:	49 bf 2b 18 80 00 00 	movabs $0x80182b,%r15
+  800054:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800057:	49 be a5 11 80 00 00 	movabs $0x8011a5,%r14
+  80005e:	00 00 00 
+  800061:	49 bd b4 02 80 00 00 	movabs $0x8002b4,%r13
+  800068:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80006b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80007e:	41 ff d7             	call   *%r15
+  800081:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800083:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800087:	41 ff d6             	call   *%r14
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	44 89 e1             	mov    %r12d,%ecx
+  80008f:	89 da                	mov    %ebx,%edx
+  800091:	48 bf a6 38 80 00 00 	movabs $0x8038a6,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  8000a3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000a6:	74 29                	je     8000d1 <umain+0xac>
+        i++;
+  8000a8:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bb:	89 de                	mov    %ebx,%esi
+  8000bd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c0:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8000cc:	83 fb 0a             	cmp    $0xa,%ebx
+  8000cf:	75 9a                	jne    80006b <umain+0x46>
+    }
+}
+  8000d1:	48 83 c4 18          	add    $0x18,%rsp
+  8000d5:	5b                   	pop    %rbx
+  8000d6:	41 5c                	pop    %r12
+  8000d8:	41 5d                	pop    %r13
+  8000da:	41 5e                	pop    %r14
+  8000dc:	41 5f                	pop    %r15
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+  8000e0:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e2:	48 b8 a5 11 80 00 00 	movabs $0x8011a5,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	89 da                	mov    %ebx,%edx
+  8000f2:	48 bf 90 38 80 00 00 	movabs $0x803890,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  800108:	00 00 00 
+  80010b:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011d:	be 00 00 00 00       	mov    $0x0,%esi
+  800122:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800125:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	e9 17 ff ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800136 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 56                	push   %r14
+  80013c:	41 55                	push   %r13
+  80013e:	41 54                	push   %r12
+  800140:	53                   	push   %rbx
+  800141:	41 89 fd             	mov    %edi,%r13d
+  800144:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800147:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80014e:	00 00 00 
+  800151:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800158:	00 00 00 
+  80015b:	48 39 c2             	cmp    %rax,%rdx
+  80015e:	73 17                	jae    800177 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800160:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800163:	49 89 c4             	mov    %rax,%r12
+  800166:	48 83 c3 08          	add    $0x8,%rbx
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	ff 53 f8             	call   *-0x8(%rbx)
+  800172:	4c 39 e3             	cmp    %r12,%rbx
+  800175:	72 ef                	jb     800166 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800177:	48 b8 a5 11 80 00 00 	movabs $0x8011a5,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+  800183:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800188:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80018c:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800190:	48 c1 e0 04          	shl    $0x4,%rax
+  800194:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80019b:	00 00 00 
+  80019e:	48 01 d0             	add    %rdx,%rax
+  8001a1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001a8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001ab:	45 85 ed             	test   %r13d,%r13d
+  8001ae:	7e 0d                	jle    8001bd <libmain+0x87>
+  8001b0:	49 8b 06             	mov    (%r14),%rax
+  8001b3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001ba:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001bd:	4c 89 f6             	mov    %r14,%rsi
+  8001c0:	44 89 ef             	mov    %r13d,%edi
+  8001c3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001cf:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+#endif
+}
+  8001db:	5b                   	pop    %rbx
+  8001dc:	41 5c                	pop    %r12
+  8001de:	41 5d                	pop    %r13
+  8001e0:	41 5e                	pop    %r14
+  8001e2:	5d                   	pop    %rbp
+  8001e3:	c3                   	ret
+
+00000000008001e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001e4:	55                   	push   %rbp
+  8001e5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e8:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8001ef:	00 00 00 
+  8001f2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f9:	48 b8 3a 11 80 00 00 	movabs $0x80113a,%rax
+  800200:	00 00 00 
+  800203:	ff d0                	call   *%rax
+}
+  800205:	5d                   	pop    %rbp
+  800206:	c3                   	ret
+
+0000000000800207 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800207:	55                   	push   %rbp
+  800208:	48 89 e5             	mov    %rsp,%rbp
+  80020b:	53                   	push   %rbx
+  80020c:	48 83 ec 08          	sub    $0x8,%rsp
+  800210:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800213:	8b 06                	mov    (%rsi),%eax
+  800215:	8d 50 01             	lea    0x1(%rax),%edx
+  800218:	89 16                	mov    %edx,(%rsi)
+  80021a:	48 98                	cltq
+  80021c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800221:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800227:	74 0a                	je     800233 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800229:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80022d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800233:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800237:	be ff 00 00 00       	mov    $0xff,%esi
+  80023c:	48 b8 dc 10 80 00 00 	movabs $0x8010dc,%rax
+  800243:	00 00 00 
+  800246:	ff d0                	call   *%rax
+        state->offset = 0;
+  800248:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80024e:	eb d9                	jmp    800229 <putch+0x22>
+
+0000000000800250 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80025b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80025e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800265:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80026a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800272:	48 89 f1             	mov    %rsi,%rcx
+  800275:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80027c:	48 bf 07 02 80 00 00 	movabs $0x800207,%rdi
+  800283:	00 00 00 
+  800286:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  80028d:	00 00 00 
+  800290:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800292:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800299:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002a0:	48 b8 dc 10 80 00 00 	movabs $0x8010dc,%rax
+  8002a7:	00 00 00 
+  8002aa:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002ac:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002b2:	c9                   	leave
+  8002b3:	c3                   	ret
+
+00000000008002b4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002b4:	55                   	push   %rbp
+  8002b5:	48 89 e5             	mov    %rsp,%rbp
+  8002b8:	48 83 ec 50          	sub    $0x50,%rsp
+  8002bc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002c0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002c4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002c8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002cc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002d0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002df:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002e3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002e7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002eb:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002f7:	c9                   	leave
+  8002f8:	c3                   	ret
+
+00000000008002f9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002f9:	55                   	push   %rbp
+  8002fa:	48 89 e5             	mov    %rsp,%rbp
+  8002fd:	41 57                	push   %r15
+  8002ff:	41 56                	push   %r14
+  800301:	41 55                	push   %r13
+  800303:	41 54                	push   %r12
+  800305:	53                   	push   %rbx
+  800306:	48 83 ec 18          	sub    $0x18,%rsp
+  80030a:	49 89 fc             	mov    %rdi,%r12
+  80030d:	49 89 f5             	mov    %rsi,%r13
+  800310:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800314:	8b 45 10             	mov    0x10(%rbp),%eax
+  800317:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80031a:	41 89 cf             	mov    %ecx,%r15d
+  80031d:	4c 39 fa             	cmp    %r15,%rdx
+  800320:	73 5b                	jae    80037d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800322:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800326:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80032a:	85 db                	test   %ebx,%ebx
+  80032c:	7e 0e                	jle    80033c <print_num+0x43>
+            putch(padc, put_arg);
+  80032e:	4c 89 ee             	mov    %r13,%rsi
+  800331:	44 89 f7             	mov    %r14d,%edi
+  800334:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800337:	83 eb 01             	sub    $0x1,%ebx
+  80033a:	75 f2                	jne    80032e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80033c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800340:	48 b9 d4 38 80 00 00 	movabs $0x8038d4,%rcx
+  800347:	00 00 00 
+  80034a:	48 b8 c3 38 80 00 00 	movabs $0x8038c3,%rax
+  800351:	00 00 00 
+  800354:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800358:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80035c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800361:	49 f7 f7             	div    %r15
+  800364:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800368:	4c 89 ee             	mov    %r13,%rsi
+  80036b:	41 ff d4             	call   *%r12
+}
+  80036e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800372:	5b                   	pop    %rbx
+  800373:	41 5c                	pop    %r12
+  800375:	41 5d                	pop    %r13
+  800377:	41 5e                	pop    %r14
+  800379:	41 5f                	pop    %r15
+  80037b:	5d                   	pop    %rbp
+  80037c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80037d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800381:	ba 00 00 00 00       	mov    $0x0,%edx
+  800386:	49 f7 f7             	div    %r15
+  800389:	48 83 ec 08          	sub    $0x8,%rsp
+  80038d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800391:	52                   	push   %rdx
+  800392:	45 0f be c9          	movsbl %r9b,%r9d
+  800396:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80039a:	48 89 c2             	mov    %rax,%rdx
+  80039d:	48 b8 f9 02 80 00 00 	movabs $0x8002f9,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+  8003a9:	48 83 c4 10          	add    $0x10,%rsp
+  8003ad:	eb 8d                	jmp    80033c <print_num+0x43>
+
+00000000008003af <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003af:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003b3:	48 8b 06             	mov    (%rsi),%rax
+  8003b6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003ba:	73 0a                	jae    8003c6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003c0:	48 89 16             	mov    %rdx,(%rsi)
+  8003c3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003c6:	c3                   	ret
+
+00000000008003c7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003c7:	55                   	push   %rbp
+  8003c8:	48 89 e5             	mov    %rsp,%rbp
+  8003cb:	48 83 ec 50          	sub    $0x50,%rsp
+  8003cf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003d3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003db:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003f2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003f6:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  8003fd:	00 00 00 
+  800400:	ff d0                	call   *%rax
+}
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+
+0000000000800404 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+  800408:	41 57                	push   %r15
+  80040a:	41 56                	push   %r14
+  80040c:	41 55                	push   %r13
+  80040e:	41 54                	push   %r12
+  800410:	53                   	push   %rbx
+  800411:	48 83 ec 38          	sub    $0x38,%rsp
+  800415:	49 89 fe             	mov    %rdi,%r14
+  800418:	49 89 f5             	mov    %rsi,%r13
+  80041b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80041e:	48 8b 01             	mov    (%rcx),%rax
+  800421:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800425:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800429:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80042d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800431:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800435:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800439:	0f b6 3b             	movzbl (%rbx),%edi
+  80043c:	40 80 ff 25          	cmp    $0x25,%dil
+  800440:	74 18                	je     80045a <vprintfmt+0x56>
+            if (!ch) return;
+  800442:	40 84 ff             	test   %dil,%dil
+  800445:	0f 84 b1 06 00 00    	je     800afc <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80044b:	40 0f b6 ff          	movzbl %dil,%edi
+  80044f:	4c 89 ee             	mov    %r13,%rsi
+  800452:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800455:	4c 89 e3             	mov    %r12,%rbx
+  800458:	eb db                	jmp    800435 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80045a:	be 00 00 00 00       	mov    $0x0,%esi
+  80045f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800463:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800468:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80046e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800475:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800479:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80047e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800483:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800486:	83 e8 23             	sub    $0x23,%eax
+  800489:	3c 57                	cmp    $0x57,%al
+  80048b:	0f 87 51 06 00 00    	ja     800ae2 <vprintfmt+0x6de>
+  800491:	0f b6 c0             	movzbl %al,%eax
+  800494:	48 b9 60 3a 80 00 00 	movabs $0x803a60,%rcx
+  80049b:	00 00 00 
+  80049e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004a1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004a4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004a8:	eb cf                	jmp    800479 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004aa:	49 89 dc             	mov    %rbx,%r12
+  8004ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8004b2:	eb c5                	jmp    800479 <vprintfmt+0x75>
+            padc = ch;
+  8004b4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004b8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004bb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004be:	eb b9                	jmp    800479 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c6:	77 24                	ja     8004ec <vprintfmt+0xe8>
+  8004c8:	89 c1                	mov    %eax,%ecx
+  8004ca:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004ce:	83 c0 08             	add    $0x8,%eax
+  8004d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004d4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004da:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004de:	79 99                	jns    800479 <vprintfmt+0x75>
+                width = precision;
+  8004e0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004e4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ea:	eb 8d                	jmp    800479 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ec:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004f0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f8:	eb da                	jmp    8004d4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004fa:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ff:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800503:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800509:	3c 39                	cmp    $0x39,%al
+  80050b:	77 1c                	ja     800529 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80050d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800511:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800515:	0f b6 c0             	movzbl %al,%eax
+  800518:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80051d:	0f b6 03             	movzbl (%rbx),%eax
+  800520:	3c 39                	cmp    $0x39,%al
+  800522:	76 e9                	jbe    80050d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800524:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800527:	eb b1                	jmp    8004da <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800529:	49 89 dc             	mov    %rbx,%r12
+  80052c:	eb ac                	jmp    8004da <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80052e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800531:	85 c9                	test   %ecx,%ecx
+  800533:	b8 00 00 00 00       	mov    $0x0,%eax
+  800538:	0f 49 c1             	cmovns %ecx,%eax
+  80053b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80053e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800541:	e9 33 ff ff ff       	jmp    800479 <vprintfmt+0x75>
+            lflag++;
+  800546:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800549:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80054c:	e9 28 ff ff ff       	jmp    800479 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800551:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800554:	83 f8 2f             	cmp    $0x2f,%eax
+  800557:	77 19                	ja     800572 <vprintfmt+0x16e>
+  800559:	89 c2                	mov    %eax,%edx
+  80055b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055f:	83 c0 08             	add    $0x8,%eax
+  800562:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800565:	8b 3a                	mov    (%rdx),%edi
+  800567:	4c 89 ee             	mov    %r13,%rsi
+  80056a:	41 ff d6             	call   *%r14
+            break;
+  80056d:	e9 c3 fe ff ff       	jmp    800435 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800572:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800576:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80057a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80057e:	eb e5                	jmp    800565 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800583:	83 f8 2f             	cmp    $0x2f,%eax
+  800586:	77 5a                	ja     8005e2 <vprintfmt+0x1de>
+  800588:	89 c2                	mov    %eax,%edx
+  80058a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80058e:	83 c0 08             	add    $0x8,%eax
+  800591:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800594:	8b 02                	mov    (%rdx),%eax
+  800596:	89 c1                	mov    %eax,%ecx
+  800598:	f7 d9                	neg    %ecx
+  80059a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80059d:	83 f9 14             	cmp    $0x14,%ecx
+  8005a0:	7f 4e                	jg     8005f0 <vprintfmt+0x1ec>
+  8005a2:	48 63 c1             	movslq %ecx,%rax
+  8005a5:	48 ba 20 3d 80 00 00 	movabs $0x803d20,%rdx
+  8005ac:	00 00 00 
+  8005af:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005b3:	48 85 c0             	test   %rax,%rax
+  8005b6:	74 38                	je     8005f0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005b8:	48 89 c1             	mov    %rax,%rcx
+  8005bb:	48 ba 39 3f 80 00 00 	movabs $0x803f39,%rdx
+  8005c2:	00 00 00 
+  8005c5:	4c 89 ee             	mov    %r13,%rsi
+  8005c8:	4c 89 f7             	mov    %r14,%rdi
+  8005cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d0:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  8005d7:	00 00 00 
+  8005da:	41 ff d0             	call   *%r8
+  8005dd:	e9 53 fe ff ff       	jmp    800435 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ee:	eb a4                	jmp    800594 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005f0:	48 ba ec 38 80 00 00 	movabs $0x8038ec,%rdx
+  8005f7:	00 00 00 
+  8005fa:	4c 89 ee             	mov    %r13,%rsi
+  8005fd:	4c 89 f7             	mov    %r14,%rdi
+  800600:	b8 00 00 00 00       	mov    $0x0,%eax
+  800605:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  80060c:	00 00 00 
+  80060f:	41 ff d0             	call   *%r8
+  800612:	e9 1e fe ff ff       	jmp    800435 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800617:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061a:	83 f8 2f             	cmp    $0x2f,%eax
+  80061d:	77 6c                	ja     80068b <vprintfmt+0x287>
+  80061f:	89 c2                	mov    %eax,%edx
+  800621:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800625:	83 c0 08             	add    $0x8,%eax
+  800628:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80062e:	48 85 d2             	test   %rdx,%rdx
+  800631:	48 b8 e5 38 80 00 00 	movabs $0x8038e5,%rax
+  800638:	00 00 00 
+  80063b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80063f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800643:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800647:	7e 06                	jle    80064f <vprintfmt+0x24b>
+  800649:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80064d:	75 4a                	jne    800699 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80064f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800653:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800657:	0f b6 00             	movzbl (%rax),%eax
+  80065a:	84 c0                	test   %al,%al
+  80065c:	0f 85 9a 00 00 00    	jne    8006fc <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800662:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800665:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800669:	85 c0                	test   %eax,%eax
+  80066b:	0f 8e c4 fd ff ff    	jle    800435 <vprintfmt+0x31>
+  800671:	4c 89 ee             	mov    %r13,%rsi
+  800674:	bf 20 00 00 00       	mov    $0x20,%edi
+  800679:	41 ff d6             	call   *%r14
+  80067c:	41 83 ec 01          	sub    $0x1,%r12d
+  800680:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800684:	75 eb                	jne    800671 <vprintfmt+0x26d>
+  800686:	e9 aa fd ff ff       	jmp    800435 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80068b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800693:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800697:	eb 92                	jmp    80062b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800699:	49 63 f7             	movslq %r15d,%rsi
+  80069c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006a0:	48 b8 b6 0b 80 00 00 	movabs $0x800bb6,%rax
+  8006a7:	00 00 00 
+  8006aa:	ff d0                	call   *%rax
+  8006ac:	48 89 c2             	mov    %rax,%rdx
+  8006af:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006b2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006b4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006b7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006ba:	85 c0                	test   %eax,%eax
+  8006bc:	7e 91                	jle    80064f <vprintfmt+0x24b>
+  8006be:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006c3:	4c 89 ee             	mov    %r13,%rsi
+  8006c6:	44 89 e7             	mov    %r12d,%edi
+  8006c9:	41 ff d6             	call   *%r14
+  8006cc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006d0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006d6:	75 eb                	jne    8006c3 <vprintfmt+0x2bf>
+  8006d8:	e9 72 ff ff ff       	jmp    80064f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006dd:	0f b6 f8             	movzbl %al,%edi
+  8006e0:	4c 89 ee             	mov    %r13,%rsi
+  8006e3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006e6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ea:	49 83 c4 01          	add    $0x1,%r12
+  8006ee:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006f4:	84 c0                	test   %al,%al
+  8006f6:	0f 84 66 ff ff ff    	je     800662 <vprintfmt+0x25e>
+  8006fc:	45 85 ff             	test   %r15d,%r15d
+  8006ff:	78 0a                	js     80070b <vprintfmt+0x307>
+  800701:	41 83 ef 01          	sub    $0x1,%r15d
+  800705:	0f 88 57 ff ff ff    	js     800662 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80070b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80070f:	74 cc                	je     8006dd <vprintfmt+0x2d9>
+  800711:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800714:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800719:	80 fa 5e             	cmp    $0x5e,%dl
+  80071c:	77 c2                	ja     8006e0 <vprintfmt+0x2dc>
+  80071e:	eb bd                	jmp    8006dd <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800720:	40 84 f6             	test   %sil,%sil
+  800723:	75 26                	jne    80074b <vprintfmt+0x347>
+    switch (lflag) {
+  800725:	85 d2                	test   %edx,%edx
+  800727:	74 59                	je     800782 <vprintfmt+0x37e>
+  800729:	83 fa 01             	cmp    $0x1,%edx
+  80072c:	74 7b                	je     8007a9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	0f 87 96 00 00 00    	ja     8007d0 <vprintfmt+0x3cc>
+  80073a:	89 c2                	mov    %eax,%edx
+  80073c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800740:	83 c0 08             	add    $0x8,%eax
+  800743:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800746:	4c 8b 22             	mov    (%rdx),%r12
+  800749:	eb 17                	jmp    800762 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 21                	ja     800774 <vprintfmt+0x370>
+  800753:	89 c2                	mov    %eax,%edx
+  800755:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800762:	4d 85 e4             	test   %r12,%r12
+  800765:	78 7a                	js     8007e1 <vprintfmt+0x3dd>
+            num = i;
+  800767:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80076a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80076f:	e9 50 02 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800774:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800778:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800780:	eb dd                	jmp    80075f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800782:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800785:	83 f8 2f             	cmp    $0x2f,%eax
+  800788:	77 11                	ja     80079b <vprintfmt+0x397>
+  80078a:	89 c2                	mov    %eax,%edx
+  80078c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800790:	83 c0 08             	add    $0x8,%eax
+  800793:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800796:	4c 63 22             	movslq (%rdx),%r12
+  800799:	eb c7                	jmp    800762 <vprintfmt+0x35e>
+  80079b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a7:	eb ed                	jmp    800796 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8007af:	77 11                	ja     8007c2 <vprintfmt+0x3be>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	4c 8b 22             	mov    (%rdx),%r12
+  8007c0:	eb a0                	jmp    800762 <vprintfmt+0x35e>
+  8007c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ce:	eb ed                	jmp    8007bd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dc:	e9 65 ff ff ff       	jmp    800746 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007e1:	4c 89 ee             	mov    %r13,%rsi
+  8007e4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007e9:	41 ff d6             	call   *%r14
+                i = -i;
+  8007ec:	49 f7 dc             	neg    %r12
+  8007ef:	e9 73 ff ff ff       	jmp    800767 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	40 84 f6             	test   %sil,%sil
+  8007f7:	75 32                	jne    80082b <vprintfmt+0x427>
+    switch (lflag) {
+  8007f9:	85 d2                	test   %edx,%edx
+  8007fb:	74 5d                	je     80085a <vprintfmt+0x456>
+  8007fd:	83 fa 01             	cmp    $0x1,%edx
+  800800:	0f 84 82 00 00 00    	je     800888 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800809:	83 f8 2f             	cmp    $0x2f,%eax
+  80080c:	0f 87 a5 00 00 00    	ja     8008b7 <vprintfmt+0x4b3>
+  800812:	89 c2                	mov    %eax,%edx
+  800814:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800818:	83 c0 08             	add    $0x8,%eax
+  80081b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800821:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800826:	e9 99 01 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80082b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082e:	83 f8 2f             	cmp    $0x2f,%eax
+  800831:	77 19                	ja     80084c <vprintfmt+0x448>
+  800833:	89 c2                	mov    %eax,%edx
+  800835:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800839:	83 c0 08             	add    $0x8,%eax
+  80083c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800842:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800847:	e9 78 01 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+  80084c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800850:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800854:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800858:	eb e5                	jmp    80083f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80085a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085d:	83 f8 2f             	cmp    $0x2f,%eax
+  800860:	77 18                	ja     80087a <vprintfmt+0x476>
+  800862:	89 c2                	mov    %eax,%edx
+  800864:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800868:	83 c0 08             	add    $0x8,%eax
+  80086b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800870:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800875:	e9 4a 01 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+  80087a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800886:	eb e6                	jmp    80086e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088b:	83 f8 2f             	cmp    $0x2f,%eax
+  80088e:	77 19                	ja     8008a9 <vprintfmt+0x4a5>
+  800890:	89 c2                	mov    %eax,%edx
+  800892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800896:	83 c0 08             	add    $0x8,%eax
+  800899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a4:	e9 1b 01 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+  8008a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b5:	eb e5                	jmp    80089c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c3:	e9 56 ff ff ff       	jmp    80081e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c8:	40 84 f6             	test   %sil,%sil
+  8008cb:	75 2e                	jne    8008fb <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008cd:	85 d2                	test   %edx,%edx
+  8008cf:	74 59                	je     80092a <vprintfmt+0x526>
+  8008d1:	83 fa 01             	cmp    $0x1,%edx
+  8008d4:	74 7f                	je     800955 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dc:	0f 87 9f 00 00 00    	ja     800981 <vprintfmt+0x57d>
+  8008e2:	89 c2                	mov    %eax,%edx
+  8008e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e8:	83 c0 08             	add    $0x8,%eax
+  8008eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008f1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008f6:	e9 c9 00 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 19                	ja     80091c <vprintfmt+0x518>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800912:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800917:	e9 a8 00 00 00       	jmp    8009c4 <vprintfmt+0x5c0>
+  80091c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800920:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800924:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800928:	eb e5                	jmp    80090f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80092a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092d:	83 f8 2f             	cmp    $0x2f,%eax
+  800930:	77 15                	ja     800947 <vprintfmt+0x543>
+  800932:	89 c2                	mov    %eax,%edx
+  800934:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800938:	83 c0 08             	add    $0x8,%eax
+  80093b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800940:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800945:	eb 7d                	jmp    8009c4 <vprintfmt+0x5c0>
+  800947:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800953:	eb e9                	jmp    80093e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 16                	ja     800973 <vprintfmt+0x56f>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80096c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800971:	eb 51                	jmp    8009c4 <vprintfmt+0x5c0>
+  800973:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800977:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097f:	eb e8                	jmp    800969 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800981:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800985:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800989:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098d:	e9 5c ff ff ff       	jmp    8008ee <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800992:	4c 89 ee             	mov    %r13,%rsi
+  800995:	bf 30 00 00 00       	mov    $0x30,%edi
+  80099a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80099d:	4c 89 ee             	mov    %r13,%rsi
+  8009a0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 47                	ja     8009f7 <vprintfmt+0x5f3>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b6:	83 c0 08             	add    $0x8,%eax
+  8009b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009cc:	0f 94 c0             	sete   %al
+  8009cf:	0f b6 c0             	movzbl %al,%eax
+  8009d2:	50                   	push   %rax
+  8009d3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009dc:	4c 89 ee             	mov    %r13,%rsi
+  8009df:	4c 89 f7             	mov    %r14,%rdi
+  8009e2:	48 b8 f9 02 80 00 00 	movabs $0x8002f9,%rax
+  8009e9:	00 00 00 
+  8009ec:	ff d0                	call   *%rax
+            break;
+  8009ee:	48 83 c4 10          	add    $0x10,%rsp
+  8009f2:	e9 3e fa ff ff       	jmp    800435 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb b7                	jmp    8009bc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a05:	40 84 f6             	test   %sil,%sil
+  800a08:	75 2b                	jne    800a35 <vprintfmt+0x631>
+    switch (lflag) {
+  800a0a:	85 d2                	test   %edx,%edx
+  800a0c:	74 56                	je     800a64 <vprintfmt+0x660>
+  800a0e:	83 fa 01             	cmp    $0x1,%edx
+  800a11:	74 7f                	je     800a92 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	0f 87 a2 00 00 00    	ja     800ac1 <vprintfmt+0x6bd>
+  800a1f:	89 c2                	mov    %eax,%edx
+  800a21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a25:	83 c0 08             	add    $0x8,%eax
+  800a28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a2e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a33:	eb 8f                	jmp    8009c4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a38:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3b:	77 19                	ja     800a56 <vprintfmt+0x652>
+  800a3d:	89 c2                	mov    %eax,%edx
+  800a3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a43:	83 c0 08             	add    $0x8,%eax
+  800a46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a49:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a4c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a51:	e9 6e ff ff ff       	jmp    8009c4 <vprintfmt+0x5c0>
+  800a56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a62:	eb e5                	jmp    800a49 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a67:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6a:	77 18                	ja     800a84 <vprintfmt+0x680>
+  800a6c:	89 c2                	mov    %eax,%edx
+  800a6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a72:	83 c0 08             	add    $0x8,%eax
+  800a75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a78:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a7a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a7f:	e9 40 ff ff ff       	jmp    8009c4 <vprintfmt+0x5c0>
+  800a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a90:	eb e6                	jmp    800a78 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a95:	83 f8 2f             	cmp    $0x2f,%eax
+  800a98:	77 19                	ja     800ab3 <vprintfmt+0x6af>
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa0:	83 c0 08             	add    $0x8,%eax
+  800aa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aae:	e9 11 ff ff ff       	jmp    8009c4 <vprintfmt+0x5c0>
+  800ab3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abf:	eb e5                	jmp    800aa6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ac1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acd:	e9 59 ff ff ff       	jmp    800a2b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ad2:	4c 89 ee             	mov    %r13,%rsi
+  800ad5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ada:	41 ff d6             	call   *%r14
+            break;
+  800add:	e9 53 f9 ff ff       	jmp    800435 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ae2:	4c 89 ee             	mov    %r13,%rsi
+  800ae5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aea:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aed:	48 83 eb 01          	sub    $0x1,%rbx
+  800af1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800af5:	75 f6                	jne    800aed <vprintfmt+0x6e9>
+  800af7:	e9 39 f9 ff ff       	jmp    800435 <vprintfmt+0x31>
+}
+  800afc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b00:	5b                   	pop    %rbx
+  800b01:	41 5c                	pop    %r12
+  800b03:	41 5d                	pop    %r13
+  800b05:	41 5e                	pop    %r14
+  800b07:	41 5f                	pop    %r15
+  800b09:	5d                   	pop    %rbp
+  800b0a:	c3                   	ret
+
+0000000000800b0b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b0b:	55                   	push   %rbp
+  800b0c:	48 89 e5             	mov    %rsp,%rbp
+  800b0f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b13:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b17:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b1c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b20:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b27:	48 85 ff             	test   %rdi,%rdi
+  800b2a:	74 2b                	je     800b57 <vsnprintf+0x4c>
+  800b2c:	48 85 f6             	test   %rsi,%rsi
+  800b2f:	74 26                	je     800b57 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b35:	48 bf af 03 80 00 00 	movabs $0x8003af,%rdi
+  800b3c:	00 00 00 
+  800b3f:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  800b46:	00 00 00 
+  800b49:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b52:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b55:	c9                   	leave
+  800b56:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5c:	eb f7                	jmp    800b55 <vsnprintf+0x4a>
+
+0000000000800b5e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b5e:	55                   	push   %rbp
+  800b5f:	48 89 e5             	mov    %rsp,%rbp
+  800b62:	48 83 ec 50          	sub    $0x50,%rsp
+  800b66:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b6a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b6e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b72:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b81:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b89:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b8d:	48 b8 0b 0b 80 00 00 	movabs $0x800b0b,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b99:	c9                   	leave
+  800b9a:	c3                   	ret
+
+0000000000800b9b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b9b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b9e:	74 10                	je     800bb0 <strlen+0x15>
+    size_t n = 0;
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ba5:	48 83 c0 01          	add    $0x1,%rax
+  800ba9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bad:	75 f6                	jne    800ba5 <strlen+0xa>
+  800baf:	c3                   	ret
+    size_t n = 0;
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bb5:	c3                   	ret
+
+0000000000800bb6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bb6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bb9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bbe:	48 85 f6             	test   %rsi,%rsi
+  800bc1:	74 11                	je     800bd4 <strnlen+0x1e>
+  800bc3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bc7:	74 0c                	je     800bd5 <strnlen+0x1f>
+  800bc9:	48 83 c2 01          	add    $0x1,%rdx
+  800bcd:	48 39 d0             	cmp    %rdx,%rax
+  800bd0:	75 f1                	jne    800bc3 <strnlen+0xd>
+  800bd2:	eb 04                	jmp    800bd8 <strnlen+0x22>
+  800bd4:	c3                   	ret
+  800bd5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd8:	c3                   	ret
+
+0000000000800bd9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bd9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800be5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be8:	48 83 c2 01          	add    $0x1,%rdx
+  800bec:	84 c9                	test   %cl,%cl
+  800bee:	75 f1                	jne    800be1 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bf0:	c3                   	ret
+
+0000000000800bf1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bf1:	55                   	push   %rbp
+  800bf2:	48 89 e5             	mov    %rsp,%rbp
+  800bf5:	41 54                	push   %r12
+  800bf7:	53                   	push   %rbx
+  800bf8:	48 89 fb             	mov    %rdi,%rbx
+  800bfb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bfe:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  800c05:	00 00 00 
+  800c08:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c0a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c0e:	4c 89 e6             	mov    %r12,%rsi
+  800c11:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  800c18:	00 00 00 
+  800c1b:	ff d0                	call   *%rax
+    return dst;
+}
+  800c1d:	48 89 d8             	mov    %rbx,%rax
+  800c20:	5b                   	pop    %rbx
+  800c21:	41 5c                	pop    %r12
+  800c23:	5d                   	pop    %rbp
+  800c24:	c3                   	ret
+
+0000000000800c25 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c25:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c28:	48 85 d2             	test   %rdx,%rdx
+  800c2b:	74 1f                	je     800c4c <strncpy+0x27>
+  800c2d:	48 01 fa             	add    %rdi,%rdx
+  800c30:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c33:	48 83 c1 01          	add    $0x1,%rcx
+  800c37:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c3b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c3f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c43:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c47:	48 39 ca             	cmp    %rcx,%rdx
+  800c4a:	75 e7                	jne    800c33 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c4c:	c3                   	ret
+
+0000000000800c4d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c4d:	48 89 f8             	mov    %rdi,%rax
+  800c50:	48 85 d2             	test   %rdx,%rdx
+  800c53:	74 24                	je     800c79 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c55:	48 83 ea 01          	sub    $0x1,%rdx
+  800c59:	74 1b                	je     800c76 <strlcpy+0x29>
+  800c5b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c5f:	0f b6 16             	movzbl (%rsi),%edx
+  800c62:	84 d2                	test   %dl,%dl
+  800c64:	74 10                	je     800c76 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c66:	48 83 c6 01          	add    $0x1,%rsi
+  800c6a:	48 83 c0 01          	add    $0x1,%rax
+  800c6e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c71:	48 39 c8             	cmp    %rcx,%rax
+  800c74:	75 e9                	jne    800c5f <strlcpy+0x12>
+        *dst = '\0';
+  800c76:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c79:	48 29 f8             	sub    %rdi,%rax
+}
+  800c7c:	c3                   	ret
+
+0000000000800c7d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c7d:	0f b6 07             	movzbl (%rdi),%eax
+  800c80:	84 c0                	test   %al,%al
+  800c82:	74 13                	je     800c97 <strcmp+0x1a>
+  800c84:	38 06                	cmp    %al,(%rsi)
+  800c86:	75 0f                	jne    800c97 <strcmp+0x1a>
+  800c88:	48 83 c7 01          	add    $0x1,%rdi
+  800c8c:	48 83 c6 01          	add    $0x1,%rsi
+  800c90:	0f b6 07             	movzbl (%rdi),%eax
+  800c93:	84 c0                	test   %al,%al
+  800c95:	75 ed                	jne    800c84 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c97:	0f b6 c0             	movzbl %al,%eax
+  800c9a:	0f b6 16             	movzbl (%rsi),%edx
+  800c9d:	29 d0                	sub    %edx,%eax
+}
+  800c9f:	c3                   	ret
+
+0000000000800ca0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ca0:	48 85 d2             	test   %rdx,%rdx
+  800ca3:	74 1f                	je     800cc4 <strncmp+0x24>
+  800ca5:	0f b6 07             	movzbl (%rdi),%eax
+  800ca8:	84 c0                	test   %al,%al
+  800caa:	74 1e                	je     800cca <strncmp+0x2a>
+  800cac:	3a 06                	cmp    (%rsi),%al
+  800cae:	75 1a                	jne    800cca <strncmp+0x2a>
+  800cb0:	48 83 c7 01          	add    $0x1,%rdi
+  800cb4:	48 83 c6 01          	add    $0x1,%rsi
+  800cb8:	48 83 ea 01          	sub    $0x1,%rdx
+  800cbc:	75 e7                	jne    800ca5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc3:	c3                   	ret
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	c3                   	ret
+  800cca:	48 85 d2             	test   %rdx,%rdx
+  800ccd:	74 09                	je     800cd8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ccf:	0f b6 07             	movzbl (%rdi),%eax
+  800cd2:	0f b6 16             	movzbl (%rsi),%edx
+  800cd5:	29 d0                	sub    %edx,%eax
+  800cd7:	c3                   	ret
+    if (!n) return 0;
+  800cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cdd:	c3                   	ret
+
+0000000000800cde <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cde:	0f b6 17             	movzbl (%rdi),%edx
+  800ce1:	84 d2                	test   %dl,%dl
+  800ce3:	74 18                	je     800cfd <strchr+0x1f>
+        if (*str == c) {
+  800ce5:	0f be d2             	movsbl %dl,%edx
+  800ce8:	39 f2                	cmp    %esi,%edx
+  800cea:	74 17                	je     800d03 <strchr+0x25>
+    for (; *str; str++) {
+  800cec:	48 83 c7 01          	add    $0x1,%rdi
+  800cf0:	0f b6 17             	movzbl (%rdi),%edx
+  800cf3:	84 d2                	test   %dl,%dl
+  800cf5:	75 ee                	jne    800ce5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	c3                   	ret
+  800cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d02:	c3                   	ret
+  800d03:	48 89 f8             	mov    %rdi,%rax
+}
+  800d06:	c3                   	ret
+
+0000000000800d07 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d07:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d0a:	0f b6 17             	movzbl (%rdi),%edx
+  800d0d:	84 d2                	test   %dl,%dl
+  800d0f:	74 13                	je     800d24 <strfind+0x1d>
+  800d11:	0f be d2             	movsbl %dl,%edx
+  800d14:	39 f2                	cmp    %esi,%edx
+  800d16:	74 0b                	je     800d23 <strfind+0x1c>
+  800d18:	48 83 c0 01          	add    $0x1,%rax
+  800d1c:	0f b6 10             	movzbl (%rax),%edx
+  800d1f:	84 d2                	test   %dl,%dl
+  800d21:	75 ee                	jne    800d11 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d23:	c3                   	ret
+  800d24:	c3                   	ret
+
+0000000000800d25 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d25:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d28:	48 89 f8             	mov    %rdi,%rax
+  800d2b:	48 f7 d8             	neg    %rax
+  800d2e:	83 e0 07             	and    $0x7,%eax
+  800d31:	49 89 d1             	mov    %rdx,%r9
+  800d34:	49 29 c1             	sub    %rax,%r9
+  800d37:	78 36                	js     800d6f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d39:	40 0f b6 c6          	movzbl %sil,%eax
+  800d3d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d44:	01 01 01 
+  800d47:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d4b:	40 f6 c7 07          	test   $0x7,%dil
+  800d4f:	75 38                	jne    800d89 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d51:	4c 89 c9             	mov    %r9,%rcx
+  800d54:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d58:	74 0c                	je     800d66 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d5a:	fc                   	cld
+  800d5b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d5e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d62:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d66:	4d 85 c9             	test   %r9,%r9
+  800d69:	75 45                	jne    800db0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d6b:	4c 89 c0             	mov    %r8,%rax
+  800d6e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d6f:	48 85 d2             	test   %rdx,%rdx
+  800d72:	74 f7                	je     800d6b <memset+0x46>
+  800d74:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d77:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d7a:	48 83 c0 01          	add    $0x1,%rax
+  800d7e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d82:	48 39 c2             	cmp    %rax,%rdx
+  800d85:	75 f3                	jne    800d7a <memset+0x55>
+  800d87:	eb e2                	jmp    800d6b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d89:	40 f6 c7 01          	test   $0x1,%dil
+  800d8d:	74 06                	je     800d95 <memset+0x70>
+  800d8f:	88 07                	mov    %al,(%rdi)
+  800d91:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d95:	40 f6 c7 02          	test   $0x2,%dil
+  800d99:	74 07                	je     800da2 <memset+0x7d>
+  800d9b:	66 89 07             	mov    %ax,(%rdi)
+  800d9e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da2:	40 f6 c7 04          	test   $0x4,%dil
+  800da6:	74 a9                	je     800d51 <memset+0x2c>
+  800da8:	89 07                	mov    %eax,(%rdi)
+  800daa:	48 83 c7 04          	add    $0x4,%rdi
+  800dae:	eb a1                	jmp    800d51 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db0:	41 f6 c1 04          	test   $0x4,%r9b
+  800db4:	74 06                	je     800dbc <memset+0x97>
+  800db6:	89 07                	mov    %eax,(%rdi)
+  800db8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dbc:	41 f6 c1 02          	test   $0x2,%r9b
+  800dc0:	74 07                	je     800dc9 <memset+0xa4>
+  800dc2:	66 89 07             	mov    %ax,(%rdi)
+  800dc5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dc9:	41 f6 c1 01          	test   $0x1,%r9b
+  800dcd:	74 9c                	je     800d6b <memset+0x46>
+  800dcf:	88 07                	mov    %al,(%rdi)
+  800dd1:	eb 98                	jmp    800d6b <memset+0x46>
+
+0000000000800dd3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dd3:	48 89 f8             	mov    %rdi,%rax
+  800dd6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dd9:	48 39 fe             	cmp    %rdi,%rsi
+  800ddc:	73 3b                	jae    800e19 <memmove+0x46>
+  800dde:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800de2:	48 39 d7             	cmp    %rdx,%rdi
+  800de5:	73 32                	jae    800e19 <memmove+0x46>
+        s += n;
+        d += n;
+  800de7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800deb:	48 89 d6             	mov    %rdx,%rsi
+  800dee:	48 09 fe             	or     %rdi,%rsi
+  800df1:	48 09 ce             	or     %rcx,%rsi
+  800df4:	40 f6 c6 07          	test   $0x7,%sil
+  800df8:	75 12                	jne    800e0c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dfa:	48 83 ef 08          	sub    $0x8,%rdi
+  800dfe:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e02:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e06:	fd                   	std
+  800e07:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e0a:	fc                   	cld
+  800e0b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e0c:	48 83 ef 01          	sub    $0x1,%rdi
+  800e10:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e14:	fd                   	std
+  800e15:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e17:	eb f1                	jmp    800e0a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e19:	48 89 f2             	mov    %rsi,%rdx
+  800e1c:	48 09 c2             	or     %rax,%rdx
+  800e1f:	48 09 ca             	or     %rcx,%rdx
+  800e22:	f6 c2 07             	test   $0x7,%dl
+  800e25:	75 0c                	jne    800e33 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e27:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e2b:	48 89 c7             	mov    %rax,%rdi
+  800e2e:	fc                   	cld
+  800e2f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e32:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e33:	48 89 c7             	mov    %rax,%rdi
+  800e36:	fc                   	cld
+  800e37:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e39:	c3                   	ret
+
+0000000000800e3a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e3a:	55                   	push   %rbp
+  800e3b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e3e:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  800e45:	00 00 00 
+  800e48:	ff d0                	call   *%rax
+}
+  800e4a:	5d                   	pop    %rbp
+  800e4b:	c3                   	ret
+
+0000000000800e4c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e4c:	55                   	push   %rbp
+  800e4d:	48 89 e5             	mov    %rsp,%rbp
+  800e50:	41 57                	push   %r15
+  800e52:	41 56                	push   %r14
+  800e54:	41 55                	push   %r13
+  800e56:	41 54                	push   %r12
+  800e58:	53                   	push   %rbx
+  800e59:	48 83 ec 08          	sub    $0x8,%rsp
+  800e5d:	49 89 fe             	mov    %rdi,%r14
+  800e60:	49 89 f7             	mov    %rsi,%r15
+  800e63:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e66:	48 89 f7             	mov    %rsi,%rdi
+  800e69:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+  800e75:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e78:	48 89 de             	mov    %rbx,%rsi
+  800e7b:	4c 89 f7             	mov    %r14,%rdi
+  800e7e:	48 b8 b6 0b 80 00 00 	movabs $0x800bb6,%rax
+  800e85:	00 00 00 
+  800e88:	ff d0                	call   *%rax
+  800e8a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e8d:	48 39 c3             	cmp    %rax,%rbx
+  800e90:	74 36                	je     800ec8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e92:	48 89 d8             	mov    %rbx,%rax
+  800e95:	4c 29 e8             	sub    %r13,%rax
+  800e98:	49 39 c4             	cmp    %rax,%r12
+  800e9b:	73 31                	jae    800ece <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e9d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ea2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ea6:	4c 89 fe             	mov    %r15,%rsi
+  800ea9:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eb5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eb9:	48 83 c4 08          	add    $0x8,%rsp
+  800ebd:	5b                   	pop    %rbx
+  800ebe:	41 5c                	pop    %r12
+  800ec0:	41 5d                	pop    %r13
+  800ec2:	41 5e                	pop    %r14
+  800ec4:	41 5f                	pop    %r15
+  800ec6:	5d                   	pop    %rbp
+  800ec7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ec8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ecc:	eb eb                	jmp    800eb9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ece:	48 83 eb 01          	sub    $0x1,%rbx
+  800ed2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ed6:	48 89 da             	mov    %rbx,%rdx
+  800ed9:	4c 89 fe             	mov    %r15,%rsi
+  800edc:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ee8:	49 01 de             	add    %rbx,%r14
+  800eeb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ef0:	eb c3                	jmp    800eb5 <strlcat+0x69>
+
+0000000000800ef2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ef2:	48 85 d2             	test   %rdx,%rdx
+  800ef5:	74 2d                	je     800f24 <memcmp+0x32>
+  800ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800efc:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f00:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f05:	44 38 c1             	cmp    %r8b,%cl
+  800f08:	75 0f                	jne    800f19 <memcmp+0x27>
+    while (n-- > 0) {
+  800f0a:	48 83 c0 01          	add    $0x1,%rax
+  800f0e:	48 39 c2             	cmp    %rax,%rdx
+  800f11:	75 e9                	jne    800efc <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f18:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f19:	0f b6 c1             	movzbl %cl,%eax
+  800f1c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f20:	44 29 c0             	sub    %r8d,%eax
+  800f23:	c3                   	ret
+    return 0;
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f2a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f2e:	48 39 c7             	cmp    %rax,%rdi
+  800f31:	73 0f                	jae    800f42 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f33:	40 38 37             	cmp    %sil,(%rdi)
+  800f36:	74 0e                	je     800f46 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f38:	48 83 c7 01          	add    $0x1,%rdi
+  800f3c:	48 39 f8             	cmp    %rdi,%rax
+  800f3f:	75 f2                	jne    800f33 <memfind+0x9>
+  800f41:	c3                   	ret
+  800f42:	48 89 f8             	mov    %rdi,%rax
+  800f45:	c3                   	ret
+  800f46:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f49:	c3                   	ret
+
+0000000000800f4a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f4a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f4d:	0f b6 37             	movzbl (%rdi),%esi
+  800f50:	40 80 fe 20          	cmp    $0x20,%sil
+  800f54:	74 06                	je     800f5c <strtol+0x12>
+  800f56:	40 80 fe 09          	cmp    $0x9,%sil
+  800f5a:	75 13                	jne    800f6f <strtol+0x25>
+  800f5c:	48 83 c7 01          	add    $0x1,%rdi
+  800f60:	0f b6 37             	movzbl (%rdi),%esi
+  800f63:	40 80 fe 20          	cmp    $0x20,%sil
+  800f67:	74 f3                	je     800f5c <strtol+0x12>
+  800f69:	40 80 fe 09          	cmp    $0x9,%sil
+  800f6d:	74 ed                	je     800f5c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f6f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f72:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f75:	3c 01                	cmp    $0x1,%al
+  800f77:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f7b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f81:	75 0f                	jne    800f92 <strtol+0x48>
+  800f83:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f86:	74 14                	je     800f9c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f88:	85 d2                	test   %edx,%edx
+  800f8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f8f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f92:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f97:	4c 63 ca             	movslq %edx,%r9
+  800f9a:	eb 36                	jmp    800fd2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f9c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fa0:	74 0f                	je     800fb1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fa2:	85 d2                	test   %edx,%edx
+  800fa4:	75 ec                	jne    800f92 <strtol+0x48>
+        s++;
+  800fa6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800faa:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800faf:	eb e1                	jmp    800f92 <strtol+0x48>
+        s += 2;
+  800fb1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fb5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fba:	eb d6                	jmp    800f92 <strtol+0x48>
+            dig -= '0';
+  800fbc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fbf:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fc3:	41 39 d0             	cmp    %edx,%r8d
+  800fc6:	7d 21                	jge    800fe9 <strtol+0x9f>
+        val = val * base + dig;
+  800fc8:	49 0f af c1          	imul   %r9,%rax
+  800fcc:	0f b6 c9             	movzbl %cl,%ecx
+  800fcf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fd2:	48 83 c7 01          	add    $0x1,%rdi
+  800fd6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fda:	80 f9 39             	cmp    $0x39,%cl
+  800fdd:	76 dd                	jbe    800fbc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fdf:	80 f9 7b             	cmp    $0x7b,%cl
+  800fe2:	77 05                	ja     800fe9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fe4:	83 e9 57             	sub    $0x57,%ecx
+  800fe7:	eb d6                	jmp    800fbf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fe9:	4d 85 d2             	test   %r10,%r10
+  800fec:	74 03                	je     800ff1 <strtol+0xa7>
+  800fee:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800ff1:	48 89 c2             	mov    %rax,%rdx
+  800ff4:	48 f7 da             	neg    %rdx
+  800ff7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800ffb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fff:	c3                   	ret
+
+0000000000801000 <strrev>:
+
+void
+strrev(char *str)
+{
+  801000:	55                   	push   %rbp
+  801001:	48 89 e5             	mov    %rsp,%rbp
+  801004:	53                   	push   %rbx
+  801005:	48 83 ec 08          	sub    $0x8,%rsp
+  801009:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80100c:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  801013:	00 00 00 
+  801016:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801018:	83 e8 01             	sub    $0x1,%eax
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	7e 22                	jle    801041 <strrev+0x41>
+  80101f:	48 98                	cltq
+  801021:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801026:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80102a:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  80102e:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801032:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801035:	48 83 c2 01          	add    $0x1,%rdx
+  801039:	48 83 e8 01          	sub    $0x1,%rax
+  80103d:	39 c2                	cmp    %eax,%edx
+  80103f:	7c e5                	jl     801026 <strrev+0x26>
+	}
+}
+  801041:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801045:	c9                   	leave
+  801046:	c3                   	ret
+
+0000000000801047 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801047:	85 d2                	test   %edx,%edx
+  801049:	0f 84 80 00 00 00    	je     8010cf <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  80104f:	55                   	push   %rbp
+  801050:	48 89 e5             	mov    %rsp,%rbp
+  801053:	53                   	push   %rbx
+  801054:	48 83 ec 08          	sub    $0x8,%rsp
+  801058:	49 89 f2             	mov    %rsi,%r10
+  80105b:	41 89 d3             	mov    %edx,%r11d
+  80105e:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801061:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801066:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801069:	eb 20                	jmp    80108b <itoa+0x44>
+			str[i++] = '0' + digit;
+  80106b:	41 89 f1             	mov    %esi,%r9d
+  80106e:	83 c2 30             	add    $0x30,%edx
+  801071:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801074:	89 f8                	mov    %edi,%eax
+  801076:	99                   	cltd
+  801077:	f7 f9                	idiv   %ecx
+  801079:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	74 2e                	je     8010ad <itoa+0x66>
+  80107f:	83 c6 01             	add    $0x1,%esi
+  801082:	49 83 c0 01          	add    $0x1,%r8
+  801086:	44 39 cb             	cmp    %r9d,%ebx
+  801089:	7e 15                	jle    8010a0 <itoa+0x59>
+		digit = sum % base;
+  80108b:	89 f8                	mov    %edi,%eax
+  80108d:	99                   	cltd
+  80108e:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801090:	83 fa 09             	cmp    $0x9,%edx
+  801093:	7e d6                	jle    80106b <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801095:	41 89 f1             	mov    %esi,%r9d
+  801098:	83 c2 37             	add    $0x37,%edx
+  80109b:	41 88 10             	mov    %dl,(%r8)
+  80109e:	eb d4                	jmp    801074 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8010a0:	41 83 eb 01          	sub    $0x1,%r11d
+  8010a4:	45 39 cb             	cmp    %r9d,%r11d
+  8010a7:	75 04                	jne    8010ad <itoa+0x66>
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	75 28                	jne    8010d5 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8010ad:	4d 63 c9             	movslq %r9d,%r9
+  8010b0:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8010b5:	4c 89 d7             	mov    %r10,%rdi
+  8010b8:	48 b8 00 10 80 00 00 	movabs $0x801000,%rax
+  8010bf:	00 00 00 
+  8010c2:	ff d0                	call   *%rax
+	return 0;
+  8010c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cd:	c9                   	leave
+  8010ce:	c3                   	ret
+		return -1;
+  8010cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010d4:	c3                   	ret
+		return -1;
+  8010d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010da:	eb ed                	jmp    8010c9 <itoa+0x82>
+
+00000000008010dc <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010dc:	55                   	push   %rbp
+  8010dd:	48 89 e5             	mov    %rsp,%rbp
+  8010e0:	53                   	push   %rbx
+  8010e1:	48 89 fa             	mov    %rdi,%rdx
+  8010e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801101:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801103:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+
+0000000000801109 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+  80110d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80110e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801113:	ba 00 00 00 00       	mov    $0x0,%edx
+  801118:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80111d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801122:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801127:	be 00 00 00 00       	mov    $0x0,%esi
+  80112c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801132:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801134:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801138:	c9                   	leave
+  801139:	c3                   	ret
+
+000000000080113a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80113a:	55                   	push   %rbp
+  80113b:	48 89 e5             	mov    %rsp,%rbp
+  80113e:	53                   	push   %rbx
+  80113f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801143:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801146:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801155:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+  80115f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801165:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801167:	48 85 c0             	test   %rax,%rax
+  80116a:	7f 06                	jg     801172 <sys_env_destroy+0x38>
+}
+  80116c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801170:	c9                   	leave
+  801171:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801172:	49 89 c0             	mov    %rax,%r8
+  801175:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80117a:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801181:	00 00 00 
+  801184:	be 26 00 00 00       	mov    $0x26,%esi
+  801189:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801190:	00 00 00 
+  801193:	b8 00 00 00 00       	mov    $0x0,%eax
+  801198:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  80119f:	00 00 00 
+  8011a2:	41 ff d1             	call   *%r9
+
+00000000008011a5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011a5:	55                   	push   %rbp
+  8011a6:	48 89 e5             	mov    %rsp,%rbp
+  8011a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011aa:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ce:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d4:	c9                   	leave
+  8011d5:	c3                   	ret
+
+00000000008011d6 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011d6:	55                   	push   %rbp
+  8011d7:	48 89 e5             	mov    %rsp,%rbp
+  8011da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011db:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ff:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801205:	c9                   	leave
+  801206:	c3                   	ret
+
+0000000000801207 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801207:	55                   	push   %rbp
+  801208:	48 89 e5             	mov    %rsp,%rbp
+  80120b:	53                   	push   %rbx
+  80120c:	48 89 fa             	mov    %rdi,%rdx
+  80120f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801212:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801217:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80121e:	00 00 00 
+  801221:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801226:	be 00 00 00 00       	mov    $0x0,%esi
+  80122b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801231:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801233:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801237:	c9                   	leave
+  801238:	c3                   	ret
+
+0000000000801239 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801239:	55                   	push   %rbp
+  80123a:	48 89 e5             	mov    %rsp,%rbp
+  80123d:	53                   	push   %rbx
+  80123e:	49 89 f8             	mov    %rdi,%r8
+  801241:	48 89 d3             	mov    %rdx,%rbx
+  801244:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124c:	4c 89 c2             	mov    %r8,%rdx
+  80124f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801252:	be 00 00 00 00       	mov    $0x0,%esi
+  801257:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80125f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801263:	c9                   	leave
+  801264:	c3                   	ret
+
+0000000000801265 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	53                   	push   %rbx
+  80126a:	48 83 ec 08          	sub    $0x8,%rsp
+  80126e:	89 f8                	mov    %edi,%eax
+  801270:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801273:	48 63 f9             	movslq %ecx,%rdi
+  801276:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801279:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801281:	be 00 00 00 00       	mov    $0x0,%esi
+  801286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128e:	48 85 c0             	test   %rax,%rax
+  801291:	7f 06                	jg     801299 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801293:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801297:	c9                   	leave
+  801298:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801299:	49 89 c0             	mov    %rax,%r8
+  80129c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012a1:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8012a8:	00 00 00 
+  8012ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b0:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  8012b7:	00 00 00 
+  8012ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bf:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  8012c6:	00 00 00 
+  8012c9:	41 ff d1             	call   *%r9
+
+00000000008012cc <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012cc:	55                   	push   %rbp
+  8012cd:	48 89 e5             	mov    %rsp,%rbp
+  8012d0:	53                   	push   %rbx
+  8012d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d5:	89 f8                	mov    %edi,%eax
+  8012d7:	49 89 f2             	mov    %rsi,%r10
+  8012da:	48 89 cf             	mov    %rcx,%rdi
+  8012dd:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012e0:	48 63 da             	movslq %edx,%rbx
+  8012e3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012eb:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ee:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f3:	48 85 c0             	test   %rax,%rax
+  8012f6:	7f 06                	jg     8012fe <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012fe:	49 89 c0             	mov    %rax,%r8
+  801301:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801306:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  80130d:	00 00 00 
+  801310:	be 26 00 00 00       	mov    $0x26,%esi
+  801315:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  80131c:	00 00 00 
+  80131f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801324:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  80132b:	00 00 00 
+  80132e:	41 ff d1             	call   *%r9
+
+0000000000801331 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801331:	55                   	push   %rbp
+  801332:	48 89 e5             	mov    %rsp,%rbp
+  801335:	53                   	push   %rbx
+  801336:	48 83 ec 08          	sub    $0x8,%rsp
+  80133a:	48 89 f1             	mov    %rsi,%rcx
+  80133d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801340:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801343:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801348:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801358:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135a:	48 85 c0             	test   %rax,%rax
+  80135d:	7f 06                	jg     801365 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80135f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801365:	49 89 c0             	mov    %rax,%r8
+  801368:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80136d:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801374:	00 00 00 
+  801377:	be 26 00 00 00       	mov    $0x26,%esi
+  80137c:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801383:	00 00 00 
+  801386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138b:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  801392:	00 00 00 
+  801395:	41 ff d1             	call   *%r9
+
+0000000000801398 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801398:	55                   	push   %rbp
+  801399:	48 89 e5             	mov    %rsp,%rbp
+  80139c:	53                   	push   %rbx
+  80139d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013a1:	48 63 ce             	movslq %esi,%rcx
+  8013a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c3:	48 85 c0             	test   %rax,%rax
+  8013c6:	7f 06                	jg     8013ce <sys_env_set_status+0x36>
+}
+  8013c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cc:	c9                   	leave
+  8013cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ce:	49 89 c0             	mov    %rax,%r8
+  8013d1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013d6:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8013dd:	00 00 00 
+  8013e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e5:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  8013ec:	00 00 00 
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f4:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  8013fb:	00 00 00 
+  8013fe:	41 ff d1             	call   *%r9
+
+0000000000801401 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+  801405:	53                   	push   %rbx
+  801406:	48 83 ec 08          	sub    $0x8,%rsp
+  80140a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80140d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801410:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801415:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142c:	48 85 c0             	test   %rax,%rax
+  80142f:	7f 06                	jg     801437 <sys_env_set_trapframe+0x36>
+}
+  801431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801437:	49 89 c0             	mov    %rax,%r8
+  80143a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80143f:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801446:	00 00 00 
+  801449:	be 26 00 00 00       	mov    $0x26,%esi
+  80144e:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801455:	00 00 00 
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  801464:	00 00 00 
+  801467:	41 ff d1             	call   *%r9
+
+000000000080146a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 08          	sub    $0x8,%rsp
+  801473:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801476:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801479:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801483:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801488:	be 00 00 00 00       	mov    $0x0,%esi
+  80148d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801493:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801495:	48 85 c0             	test   %rax,%rax
+  801498:	7f 06                	jg     8014a0 <sys_env_set_pgfault_upcall+0x36>
+}
+  80149a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149e:	c9                   	leave
+  80149f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a0:	49 89 c0             	mov    %rax,%r8
+  8014a3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014a8:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  8014af:	00 00 00 
+  8014b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b7:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  8014be:	00 00 00 
+  8014c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c6:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  8014cd:	00 00 00 
+  8014d0:	41 ff d1             	call   *%r9
+
+00000000008014d3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014d3:	55                   	push   %rbp
+  8014d4:	48 89 e5             	mov    %rsp,%rbp
+  8014d7:	53                   	push   %rbx
+  8014d8:	89 f8                	mov    %edi,%eax
+  8014da:	49 89 f1             	mov    %rsi,%r9
+  8014dd:	48 89 d3             	mov    %rdx,%rbx
+  8014e0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014e3:	49 63 f0             	movslq %r8d,%rsi
+  8014e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ee:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f7:	cd 30                	int    $0x30
+}
+  8014f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+00000000008014ff <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	53                   	push   %rbx
+  801504:	48 83 ec 08          	sub    $0x8,%rsp
+  801508:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80150b:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80150e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801513:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801526:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801528:	48 85 c0             	test   %rax,%rax
+  80152b:	7f 06                	jg     801533 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80152d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801533:	49 89 c0             	mov    %rax,%r8
+  801536:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80153b:	48 ba e8 3d 80 00 00 	movabs $0x803de8,%rdx
+  801542:	00 00 00 
+  801545:	be 26 00 00 00       	mov    $0x26,%esi
+  80154a:	48 bf 07 3e 80 00 00 	movabs $0x803e07,%rdi
+  801551:	00 00 00 
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	49 b9 ec 37 80 00 00 	movabs $0x8037ec,%r9
+  801560:	00 00 00 
+  801563:	41 ff d1             	call   *%r9
+
+0000000000801566 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80156a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156f:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+}
+  80157b:	5d                   	pop    %rbp
+  80157c:	c3                   	ret
+
+000000000080157d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801582:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801596:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159b:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ac:	c9                   	leave
+  8015ad:	c3                   	ret
+
+00000000008015ae <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8015b3:	48 63 ce             	movslq %esi,%rcx
+  8015b6:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ba:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d4:	cd 30                	int    $0x30
+}
+  8015d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015da:	c9                   	leave
+  8015db:	c3                   	ret
+
+00000000008015dc <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015dc:	55                   	push   %rbp
+  8015dd:	48 89 e5             	mov    %rsp,%rbp
+  8015e0:	53                   	push   %rbx
+  8015e1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015e4:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801602:	cd 30                	int    $0x30
+}
+  801604:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+
+000000000080160a <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80160a:	55                   	push   %rbp
+  80160b:	48 89 e5             	mov    %rsp,%rbp
+  80160e:	53                   	push   %rbx
+  80160f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801612:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801615:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80161a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801622:	be 00 00 00 00       	mov    $0x0,%esi
+  801627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162d:	cd 30                	int    $0x30
+}
+  80162f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+0000000000801635 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	41 54                	push   %r12
+  80163b:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80163c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801641:	cd 30                	int    $0x30
+  801643:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 7e                	js     8016c8 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  80164a:	0f 84 80 00 00 00    	je     8016d0 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801650:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801656:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80165d:	00 00 00 
+  801660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801665:	89 c2                	mov    %eax,%edx
+  801667:	be 00 00 00 00       	mov    $0x0,%esi
+  80166c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801671:	48 b8 cc 12 80 00 00 	movabs $0x8012cc,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	0f 88 81 00 00 00    	js     801706 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801685:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80168c:	00 00 00 
+  80168f:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801696:	44 89 e7             	mov    %r12d,%edi
+  801699:	48 b8 6a 14 80 00 00 	movabs $0x80146a,%rax
+  8016a0:	00 00 00 
+  8016a3:	ff d0                	call   *%rax
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	78 65                	js     80170e <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8016a9:	be 02 00 00 00       	mov    $0x2,%esi
+  8016ae:	44 89 e7             	mov    %r12d,%edi
+  8016b1:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+        return -1;
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8016c4:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  8016c8:	44 89 e0             	mov    %r12d,%eax
+  8016cb:	5b                   	pop    %rbx
+  8016cc:	41 5c                	pop    %r12
+  8016ce:	5d                   	pop    %rbp
+  8016cf:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8016d0:	48 b8 a5 11 80 00 00 	movabs $0x8011a5,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+  8016dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016e1:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8016e5:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8016e9:	48 c1 e0 04          	shl    $0x4,%rax
+  8016ed:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016f4:	00 00 00 
+  8016f7:	48 01 d0             	add    %rdx,%rax
+  8016fa:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801701:	00 00 00 
+        return 0;
+  801704:	eb c2                	jmp    8016c8 <fork+0x93>
+        return -1;
+  801706:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80170c:	eb ba                	jmp    8016c8 <fork+0x93>
+        return -1;
+  80170e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801714:	eb b2                	jmp    8016c8 <fork+0x93>
+
+0000000000801716 <sfork>:
+
+envid_t
+sfork() {
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80171a:	48 ba 15 3e 80 00 00 	movabs $0x803e15,%rdx
+  801721:	00 00 00 
+  801724:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801729:	48 bf 30 3e 80 00 00 	movabs $0x803e30,%rdi
+  801730:	00 00 00 
+  801733:	b8 00 00 00 00       	mov    $0x0,%eax
+  801738:	48 b9 ec 37 80 00 00 	movabs $0x8037ec,%rcx
+  80173f:	00 00 00 
+  801742:	ff d1                	call   *%rcx
+
+0000000000801744 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  801744:	55                   	push   %rbp
+  801745:	48 89 e5             	mov    %rsp,%rbp
+  801748:	41 55                	push   %r13
+  80174a:	41 54                	push   %r12
+  80174c:	53                   	push   %rbx
+  80174d:	48 83 ec 08          	sub    $0x8,%rsp
+  801751:	49 89 fc             	mov    %rdi,%r12
+  801754:	48 89 f7             	mov    %rsi,%rdi
+  801757:	48 89 d3             	mov    %rdx,%rbx
+  80175a:	49 89 cd             	mov    %rcx,%r13
+  80175d:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801760:	48 85 f6             	test   %rsi,%rsi
+  801763:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80176a:	00 00 00 
+  80176d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  801771:	be 00 10 00 00       	mov    $0x1000,%esi
+  801776:	48 85 db             	test   %rbx,%rbx
+  801779:	74 03                	je     80177e <ipc_recv_timed+0x3a>
+  80177b:	48 8b 33             	mov    (%rbx),%rsi
+  80177e:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  801785:	00 00 00 
+  801788:	ff d0                	call   *%rax
+    if (res < 0) {
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	78 75                	js     801803 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80178e:	4d 85 e4             	test   %r12,%r12
+  801791:	74 14                	je     8017a7 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  801793:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80179a:	00 00 00 
+  80179d:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8017a3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8017a7:	4d 85 ed             	test   %r13,%r13
+  8017aa:	74 14                	je     8017c0 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8017ac:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017b3:	00 00 00 
+  8017b6:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8017bc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8017c0:	48 85 db             	test   %rbx,%rbx
+  8017c3:	74 23                	je     8017e8 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8017c5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017cc:	00 00 00 
+  8017cf:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8017d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017da:	85 c9                	test   %ecx,%ecx
+  8017dc:	74 07                	je     8017e5 <ipc_recv_timed+0xa1>
+  8017de:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8017e5:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8017e8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017ef:	00 00 00 
+  8017f2:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8017f8:	48 83 c4 08          	add    $0x8,%rsp
+  8017fc:	5b                   	pop    %rbx
+  8017fd:	41 5c                	pop    %r12
+  8017ff:	41 5d                	pop    %r13
+  801801:	5d                   	pop    %rbp
+  801802:	c3                   	ret
+        if (from_env_store != NULL) {
+  801803:	4d 85 e4             	test   %r12,%r12
+  801806:	74 08                	je     801810 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  801808:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80180f:	00 
+        if (perm_store != NULL) {
+  801810:	4d 85 ed             	test   %r13,%r13
+  801813:	74 08                	je     80181d <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  801815:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80181c:	00 
+        if (size != NULL) {
+  80181d:	48 85 db             	test   %rbx,%rbx
+  801820:	74 d6                	je     8017f8 <ipc_recv_timed+0xb4>
+            *size = 0;
+  801822:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801829:	eb cd                	jmp    8017f8 <ipc_recv_timed+0xb4>
+
+000000000080182b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80182f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801835:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+}
+  801841:	5d                   	pop    %rbp
+  801842:	c3                   	ret
+
+0000000000801843 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+  801847:	41 57                	push   %r15
+  801849:	41 56                	push   %r14
+  80184b:	41 55                	push   %r13
+  80184d:	41 54                	push   %r12
+  80184f:	53                   	push   %rbx
+  801850:	48 83 ec 18          	sub    $0x18,%rsp
+  801854:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  801857:	48 89 d3             	mov    %rdx,%rbx
+  80185a:	49 89 cc             	mov    %rcx,%r12
+  80185d:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801860:	48 85 d2             	test   %rdx,%rdx
+  801863:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80186a:	00 00 00 
+  80186d:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801871:	89 f0                	mov    %esi,%eax
+  801873:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801877:	48 89 da             	mov    %rbx,%rdx
+  80187a:	48 89 c6             	mov    %rax,%rsi
+  80187d:	48 b8 d3 14 80 00 00 	movabs $0x8014d3,%rax
+  801884:	00 00 00 
+  801887:	ff d0                	call   *%rax
+    while (res < 0) {
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	79 65                	jns    8018f2 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80188d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801890:	75 33                	jne    8018c5 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  801892:	49 bf d6 11 80 00 00 	movabs $0x8011d6,%r15
+  801899:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80189c:	49 be d3 14 80 00 00 	movabs $0x8014d3,%r14
+  8018a3:	00 00 00 
+        sys_yield();
+  8018a6:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8018a9:	45 89 e8             	mov    %r13d,%r8d
+  8018ac:	4c 89 e1             	mov    %r12,%rcx
+  8018af:	48 89 da             	mov    %rbx,%rdx
+  8018b2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8018b6:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8018b9:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	79 32                	jns    8018f2 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8018c0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8018c3:	74 e1                	je     8018a6 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8018c5:	89 c1                	mov    %eax,%ecx
+  8018c7:	48 ba 3b 3e 80 00 00 	movabs $0x803e3b,%rdx
+  8018ce:	00 00 00 
+  8018d1:	be 52 00 00 00       	mov    $0x52,%esi
+  8018d6:	48 bf 4f 3e 80 00 00 	movabs $0x803e4f,%rdi
+  8018dd:	00 00 00 
+  8018e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e5:	49 b8 ec 37 80 00 00 	movabs $0x8037ec,%r8
+  8018ec:	00 00 00 
+  8018ef:	41 ff d0             	call   *%r8
+    }
+}
+  8018f2:	48 83 c4 18          	add    $0x18,%rsp
+  8018f6:	5b                   	pop    %rbx
+  8018f7:	41 5c                	pop    %r12
+  8018f9:	41 5d                	pop    %r13
+  8018fb:	41 5e                	pop    %r14
+  8018fd:	41 5f                	pop    %r15
+  8018ff:	5d                   	pop    %rbp
+  801900:	c3                   	ret
+
+0000000000801901 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801906:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80190d:	00 00 00 
+  801910:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801914:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801918:	48 c1 e2 04          	shl    $0x4,%rdx
+  80191c:	48 01 ca             	add    %rcx,%rdx
+  80191f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801925:	39 fa                	cmp    %edi,%edx
+  801927:	74 12                	je     80193b <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  801929:	48 83 c0 01          	add    $0x1,%rax
+  80192d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801933:	75 db                	jne    801910 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801935:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193a:	c3                   	ret
+            return envs[i].env_id;
+  80193b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80193f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801943:	48 c1 e2 04          	shl    $0x4,%rdx
+  801947:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80194e:	00 00 00 
+  801951:	48 01 d0             	add    %rdx,%rax
+  801954:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80195a:	c3                   	ret
+
+000000000080195b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80195b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801962:	ff ff ff 
+  801965:	48 01 f8             	add    %rdi,%rax
+  801968:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80196c:	c3                   	ret
+
+000000000080196d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80196d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801974:	ff ff ff 
+  801977:	48 01 f8             	add    %rdi,%rax
+  80197a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80197e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801984:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801988:	c3                   	ret
+
+0000000000801989 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	41 57                	push   %r15
+  80198f:	41 56                	push   %r14
+  801991:	41 55                	push   %r13
+  801993:	41 54                	push   %r12
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 08          	sub    $0x8,%rsp
+  80199a:	49 89 ff             	mov    %rdi,%r15
+  80199d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019a2:	49 bd a8 34 80 00 00 	movabs $0x8034a8,%r13
+  8019a9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019ac:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019b2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b5:	48 89 df             	mov    %rbx,%rdi
+  8019b8:	41 ff d5             	call   *%r13
+  8019bb:	83 e0 04             	and    $0x4,%eax
+  8019be:	74 17                	je     8019d7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019c0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019c7:	4c 39 f3             	cmp    %r14,%rbx
+  8019ca:	75 e6                	jne    8019b2 <fd_alloc+0x29>
+  8019cc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019d2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019d7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019da:	48 83 c4 08          	add    $0x8,%rsp
+  8019de:	5b                   	pop    %rbx
+  8019df:	41 5c                	pop    %r12
+  8019e1:	41 5d                	pop    %r13
+  8019e3:	41 5e                	pop    %r14
+  8019e5:	41 5f                	pop    %r15
+  8019e7:	5d                   	pop    %rbp
+  8019e8:	c3                   	ret
+
+00000000008019e9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019e9:	83 ff 1f             	cmp    $0x1f,%edi
+  8019ec:	77 39                	ja     801a27 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019ee:	55                   	push   %rbp
+  8019ef:	48 89 e5             	mov    %rsp,%rbp
+  8019f2:	41 54                	push   %r12
+  8019f4:	53                   	push   %rbx
+  8019f5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019f8:	48 63 df             	movslq %edi,%rbx
+  8019fb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a02:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a06:	48 89 df             	mov    %rbx,%rdi
+  801a09:	48 b8 a8 34 80 00 00 	movabs $0x8034a8,%rax
+  801a10:	00 00 00 
+  801a13:	ff d0                	call   *%rax
+  801a15:	a8 04                	test   $0x4,%al
+  801a17:	74 14                	je     801a2d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a19:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a22:	5b                   	pop    %rbx
+  801a23:	41 5c                	pop    %r12
+  801a25:	5d                   	pop    %rbp
+  801a26:	c3                   	ret
+        return -E_INVAL;
+  801a27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a2c:	c3                   	ret
+        return -E_INVAL;
+  801a2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a32:	eb ee                	jmp    801a22 <fd_lookup+0x39>
+
+0000000000801a34 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a34:	55                   	push   %rbp
+  801a35:	48 89 e5             	mov    %rsp,%rbp
+  801a38:	41 54                	push   %r12
+  801a3a:	53                   	push   %rbx
+  801a3b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a3e:	48 b8 00 3f 80 00 00 	movabs $0x803f00,%rax
+  801a45:	00 00 00 
+  801a48:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a4f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a52:	39 3b                	cmp    %edi,(%rbx)
+  801a54:	74 47                	je     801a9d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a56:	48 83 c0 08          	add    $0x8,%rax
+  801a5a:	48 8b 18             	mov    (%rax),%rbx
+  801a5d:	48 85 db             	test   %rbx,%rbx
+  801a60:	75 f0                	jne    801a52 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a62:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a69:	00 00 00 
+  801a6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a72:	89 fa                	mov    %edi,%edx
+  801a74:	48 bf 60 3e 80 00 00 	movabs $0x803e60,%rdi
+  801a7b:	00 00 00 
+  801a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a83:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  801a8a:	00 00 00 
+  801a8d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a94:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a98:	5b                   	pop    %rbx
+  801a99:	41 5c                	pop    %r12
+  801a9b:	5d                   	pop    %rbp
+  801a9c:	c3                   	ret
+            return 0;
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa2:	eb f0                	jmp    801a94 <dev_lookup+0x60>
+
+0000000000801aa4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	41 55                	push   %r13
+  801aaa:	41 54                	push   %r12
+  801aac:	53                   	push   %rbx
+  801aad:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab1:	48 89 fb             	mov    %rdi,%rbx
+  801ab4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ab7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801abe:	ff ff ff 
+  801ac1:	48 01 df             	add    %rbx,%rdi
+  801ac4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ac8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801acc:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+  801ad8:	41 89 c5             	mov    %eax,%r13d
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	78 06                	js     801ae5 <fd_close+0x41>
+  801adf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ae3:	74 1a                	je     801aff <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ae5:	45 84 e4             	test   %r12b,%r12b
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801af1:	44 89 e8             	mov    %r13d,%eax
+  801af4:	48 83 c4 18          	add    $0x18,%rsp
+  801af8:	5b                   	pop    %rbx
+  801af9:	41 5c                	pop    %r12
+  801afb:	41 5d                	pop    %r13
+  801afd:	5d                   	pop    %rbp
+  801afe:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aff:	8b 3b                	mov    (%rbx),%edi
+  801b01:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b05:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801b0c:	00 00 00 
+  801b0f:	ff d0                	call   *%rax
+  801b11:	41 89 c5             	mov    %eax,%r13d
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 1b                	js     801b33 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b1c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b20:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b26:	48 85 c0             	test   %rax,%rax
+  801b29:	74 08                	je     801b33 <fd_close+0x8f>
+  801b2b:	48 89 df             	mov    %rbx,%rdi
+  801b2e:	ff d0                	call   *%rax
+  801b30:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b38:	48 89 de             	mov    %rbx,%rsi
+  801b3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b40:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+    return res;
+  801b4c:	eb a3                	jmp    801af1 <fd_close+0x4d>
+
+0000000000801b4e <close>:
+
+int
+close(int fdnum) {
+  801b4e:	55                   	push   %rbp
+  801b4f:	48 89 e5             	mov    %rsp,%rbp
+  801b52:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b56:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b5a:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801b61:	00 00 00 
+  801b64:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	78 15                	js     801b7f <close+0x31>
+
+    return fd_close(fd, 1);
+  801b6a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b6f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b73:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+}
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+
+0000000000801b81 <close_all>:
+
+void
+close_all(void) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	41 54                	push   %r12
+  801b87:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b8d:	49 bc 4e 1b 80 00 00 	movabs $0x801b4e,%r12
+  801b94:	00 00 00 
+  801b97:	89 df                	mov    %ebx,%edi
+  801b99:	41 ff d4             	call   *%r12
+  801b9c:	83 c3 01             	add    $0x1,%ebx
+  801b9f:	83 fb 20             	cmp    $0x20,%ebx
+  801ba2:	75 f3                	jne    801b97 <close_all+0x16>
+}
+  801ba4:	5b                   	pop    %rbx
+  801ba5:	41 5c                	pop    %r12
+  801ba7:	5d                   	pop    %rbp
+  801ba8:	c3                   	ret
+
+0000000000801ba9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ba9:	55                   	push   %rbp
+  801baa:	48 89 e5             	mov    %rsp,%rbp
+  801bad:	41 57                	push   %r15
+  801baf:	41 56                	push   %r14
+  801bb1:	41 55                	push   %r13
+  801bb3:	41 54                	push   %r12
+  801bb5:	53                   	push   %rbx
+  801bb6:	48 83 ec 18          	sub    $0x18,%rsp
+  801bba:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bbd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bc1:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	89 c3                	mov    %eax,%ebx
+  801bcf:	85 c0                	test   %eax,%eax
+  801bd1:	0f 88 b8 00 00 00    	js     801c8f <dup+0xe6>
+    close(newfdnum);
+  801bd7:	44 89 e7             	mov    %r12d,%edi
+  801bda:	48 b8 4e 1b 80 00 00 	movabs $0x801b4e,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801be6:	4d 63 ec             	movslq %r12d,%r13
+  801be9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801bf0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bf4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bf8:	4c 89 ff             	mov    %r15,%rdi
+  801bfb:	49 be 6d 19 80 00 00 	movabs $0x80196d,%r14
+  801c02:	00 00 00 
+  801c05:	41 ff d6             	call   *%r14
+  801c08:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c0b:	4c 89 ef             	mov    %r13,%rdi
+  801c0e:	41 ff d6             	call   *%r14
+  801c11:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c14:	48 89 df             	mov    %rbx,%rdi
+  801c17:	48 b8 a8 34 80 00 00 	movabs $0x8034a8,%rax
+  801c1e:	00 00 00 
+  801c21:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c23:	a8 04                	test   $0x4,%al
+  801c25:	74 2b                	je     801c52 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c27:	41 89 c1             	mov    %eax,%r9d
+  801c2a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c30:	4c 89 f1             	mov    %r14,%rcx
+  801c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c38:	48 89 de             	mov    %rbx,%rsi
+  801c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c40:	48 b8 cc 12 80 00 00 	movabs $0x8012cc,%rax
+  801c47:	00 00 00 
+  801c4a:	ff d0                	call   *%rax
+  801c4c:	89 c3                	mov    %eax,%ebx
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	78 4e                	js     801ca0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c52:	4c 89 ff             	mov    %r15,%rdi
+  801c55:	48 b8 a8 34 80 00 00 	movabs $0x8034a8,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c64:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c6a:	4c 89 e9             	mov    %r13,%rcx
+  801c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c72:	4c 89 fe             	mov    %r15,%rsi
+  801c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7a:	48 b8 cc 12 80 00 00 	movabs $0x8012cc,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	89 c3                	mov    %eax,%ebx
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	78 14                	js     801ca0 <dup+0xf7>
+
+    return newfdnum;
+  801c8c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c8f:	89 d8                	mov    %ebx,%eax
+  801c91:	48 83 c4 18          	add    $0x18,%rsp
+  801c95:	5b                   	pop    %rbx
+  801c96:	41 5c                	pop    %r12
+  801c98:	41 5d                	pop    %r13
+  801c9a:	41 5e                	pop    %r14
+  801c9c:	41 5f                	pop    %r15
+  801c9e:	5d                   	pop    %rbp
+  801c9f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ca0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ca5:	4c 89 ee             	mov    %r13,%rsi
+  801ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cad:	49 bc 31 13 80 00 00 	movabs $0x801331,%r12
+  801cb4:	00 00 00 
+  801cb7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cbf:	4c 89 f6             	mov    %r14,%rsi
+  801cc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc7:	41 ff d4             	call   *%r12
+    return res;
+  801cca:	eb c3                	jmp    801c8f <dup+0xe6>
+
+0000000000801ccc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+  801cd0:	41 56                	push   %r14
+  801cd2:	41 55                	push   %r13
+  801cd4:	41 54                	push   %r12
+  801cd6:	53                   	push   %rbx
+  801cd7:	48 83 ec 10          	sub    $0x10,%rsp
+  801cdb:	89 fb                	mov    %edi,%ebx
+  801cdd:	49 89 f4             	mov    %rsi,%r12
+  801ce0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce7:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 4c                	js     801d43 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cfb:	41 8b 3e             	mov    (%r14),%edi
+  801cfe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d02:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+  801d0e:	85 c0                	test   %eax,%eax
+  801d10:	78 35                	js     801d47 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d12:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d16:	83 e0 03             	and    $0x3,%eax
+  801d19:	83 f8 01             	cmp    $0x1,%eax
+  801d1c:	74 2d                	je     801d4b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d22:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d26:	48 85 c0             	test   %rax,%rax
+  801d29:	74 56                	je     801d81 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d2b:	4c 89 ea             	mov    %r13,%rdx
+  801d2e:	4c 89 e6             	mov    %r12,%rsi
+  801d31:	4c 89 f7             	mov    %r14,%rdi
+  801d34:	ff d0                	call   *%rax
+}
+  801d36:	48 83 c4 10          	add    $0x10,%rsp
+  801d3a:	5b                   	pop    %rbx
+  801d3b:	41 5c                	pop    %r12
+  801d3d:	41 5d                	pop    %r13
+  801d3f:	41 5e                	pop    %r14
+  801d41:	5d                   	pop    %rbp
+  801d42:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d43:	48 98                	cltq
+  801d45:	eb ef                	jmp    801d36 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d47:	48 98                	cltq
+  801d49:	eb eb                	jmp    801d36 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d4b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d52:	00 00 00 
+  801d55:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d5b:	89 da                	mov    %ebx,%edx
+  801d5d:	48 bf c1 3e 80 00 00 	movabs $0x803ec1,%rdi
+  801d64:	00 00 00 
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  801d73:	00 00 00 
+  801d76:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d78:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d7f:	eb b5                	jmp    801d36 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d81:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d88:	eb ac                	jmp    801d36 <read+0x6a>
+
+0000000000801d8a <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801d8a:	55                   	push   %rbp
+  801d8b:	48 89 e5             	mov    %rsp,%rbp
+  801d8e:	41 56                	push   %r14
+  801d90:	41 55                	push   %r13
+  801d92:	41 54                	push   %r12
+  801d94:	53                   	push   %rbx
+  801d95:	48 83 ec 10          	sub    $0x10,%rsp
+  801d99:	89 fb                	mov    %edi,%ebx
+  801d9b:	49 89 f4             	mov    %rsi,%r12
+  801d9e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801da5:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801dac:	00 00 00 
+  801daf:	ff d0                	call   *%rax
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	78 41                	js     801df6 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801db5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801db9:	41 8b 3e             	mov    (%r14),%edi
+  801dbc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dc0:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	78 35                	js     801e05 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dd0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dd4:	83 e0 03             	and    $0x3,%eax
+  801dd7:	83 f8 01             	cmp    $0x1,%eax
+  801dda:	74 2d                	je     801e09 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ddc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801de4:	48 85 c0             	test   %rax,%rax
+  801de7:	74 56                	je     801e3f <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801de9:	4c 89 ea             	mov    %r13,%rdx
+  801dec:	4c 89 e6             	mov    %r12,%rsi
+  801def:	4c 89 f7             	mov    %r14,%rdi
+  801df2:	ff d0                	call   *%rax
+  801df4:	eb 02                	jmp    801df8 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df6:	48 98                	cltq
+}
+  801df8:	48 83 c4 10          	add    $0x10,%rsp
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	41 5e                	pop    %r14
+  801e03:	5d                   	pop    %rbp
+  801e04:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e05:	48 98                	cltq
+  801e07:	eb ef                	jmp    801df8 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e09:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e10:	00 00 00 
+  801e13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e19:	89 da                	mov    %ebx,%edx
+  801e1b:	48 bf 80 3e 80 00 00 	movabs $0x803e80,%rdi
+  801e22:	00 00 00 
+  801e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2a:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  801e31:	00 00 00 
+  801e34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e36:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e3d:	eb b9                	jmp    801df8 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e3f:	4c 89 ea             	mov    %r13,%rdx
+  801e42:	4c 89 e6             	mov    %r12,%rsi
+  801e45:	89 df                	mov    %ebx,%edi
+  801e47:	48 b8 cc 1c 80 00 00 	movabs $0x801ccc,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	eb a3                	jmp    801df8 <readmap+0x6e>
+
+0000000000801e55 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e55:	55                   	push   %rbp
+  801e56:	48 89 e5             	mov    %rsp,%rbp
+  801e59:	41 57                	push   %r15
+  801e5b:	41 56                	push   %r14
+  801e5d:	41 55                	push   %r13
+  801e5f:	41 54                	push   %r12
+  801e61:	53                   	push   %rbx
+  801e62:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e66:	48 85 d2             	test   %rdx,%rdx
+  801e69:	74 54                	je     801ebf <readn+0x6a>
+  801e6b:	41 89 fd             	mov    %edi,%r13d
+  801e6e:	49 89 f6             	mov    %rsi,%r14
+  801e71:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e74:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e79:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e7e:	49 bf cc 1c 80 00 00 	movabs $0x801ccc,%r15
+  801e85:	00 00 00 
+  801e88:	4c 89 e2             	mov    %r12,%rdx
+  801e8b:	48 29 f2             	sub    %rsi,%rdx
+  801e8e:	4c 01 f6             	add    %r14,%rsi
+  801e91:	44 89 ef             	mov    %r13d,%edi
+  801e94:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 20                	js     801ebb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e9b:	01 c3                	add    %eax,%ebx
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	74 08                	je     801ea9 <readn+0x54>
+  801ea1:	48 63 f3             	movslq %ebx,%rsi
+  801ea4:	4c 39 e6             	cmp    %r12,%rsi
+  801ea7:	72 df                	jb     801e88 <readn+0x33>
+    }
+    return res;
+  801ea9:	48 63 c3             	movslq %ebx,%rax
+}
+  801eac:	48 83 c4 08          	add    $0x8,%rsp
+  801eb0:	5b                   	pop    %rbx
+  801eb1:	41 5c                	pop    %r12
+  801eb3:	41 5d                	pop    %r13
+  801eb5:	41 5e                	pop    %r14
+  801eb7:	41 5f                	pop    %r15
+  801eb9:	5d                   	pop    %rbp
+  801eba:	c3                   	ret
+        if (inc < 0) return inc;
+  801ebb:	48 98                	cltq
+  801ebd:	eb ed                	jmp    801eac <readn+0x57>
+    int inc = 1, res = 0;
+  801ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ec4:	eb e3                	jmp    801ea9 <readn+0x54>
+
+0000000000801ec6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ec6:	55                   	push   %rbp
+  801ec7:	48 89 e5             	mov    %rsp,%rbp
+  801eca:	41 56                	push   %r14
+  801ecc:	41 55                	push   %r13
+  801ece:	41 54                	push   %r12
+  801ed0:	53                   	push   %rbx
+  801ed1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed5:	89 fb                	mov    %edi,%ebx
+  801ed7:	49 89 f4             	mov    %rsi,%r12
+  801eda:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801edd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ee1:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801ee8:	00 00 00 
+  801eeb:	ff d0                	call   *%rax
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 47                	js     801f38 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ef5:	41 8b 3e             	mov    (%r14),%edi
+  801ef8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801efc:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801f03:	00 00 00 
+  801f06:	ff d0                	call   *%rax
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	78 30                	js     801f3c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f0c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f11:	74 2d                	je     801f40 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f17:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f1b:	48 85 c0             	test   %rax,%rax
+  801f1e:	74 56                	je     801f76 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f20:	4c 89 ea             	mov    %r13,%rdx
+  801f23:	4c 89 e6             	mov    %r12,%rsi
+  801f26:	4c 89 f7             	mov    %r14,%rdi
+  801f29:	ff d0                	call   *%rax
+}
+  801f2b:	48 83 c4 10          	add    $0x10,%rsp
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	41 5d                	pop    %r13
+  801f34:	41 5e                	pop    %r14
+  801f36:	5d                   	pop    %rbp
+  801f37:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f38:	48 98                	cltq
+  801f3a:	eb ef                	jmp    801f2b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f3c:	48 98                	cltq
+  801f3e:	eb eb                	jmp    801f2b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f40:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f47:	00 00 00 
+  801f4a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f50:	89 da                	mov    %ebx,%edx
+  801f52:	48 bf dd 3e 80 00 00 	movabs $0x803edd,%rdi
+  801f59:	00 00 00 
+  801f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f61:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  801f68:	00 00 00 
+  801f6b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f6d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f74:	eb b5                	jmp    801f2b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f76:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f7d:	eb ac                	jmp    801f2b <write+0x65>
+
+0000000000801f7f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f7f:	55                   	push   %rbp
+  801f80:	48 89 e5             	mov    %rsp,%rbp
+  801f83:	53                   	push   %rbx
+  801f84:	48 83 ec 18          	sub    $0x18,%rsp
+  801f88:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f8e:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	78 0c                	js     801faa <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fa2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801faa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+0000000000801fb0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	41 55                	push   %r13
+  801fb6:	41 54                	push   %r12
+  801fb8:	53                   	push   %rbx
+  801fb9:	48 83 ec 18          	sub    $0x18,%rsp
+  801fbd:	89 fb                	mov    %edi,%ebx
+  801fbf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc6:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	78 38                	js     80200e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fd6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fda:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fe2:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	78 1c                	js     80200e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ff2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ff7:	74 20                	je     802019 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ff9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ffd:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802001:	48 85 c0             	test   %rax,%rax
+  802004:	74 47                	je     80204d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802006:	44 89 e6             	mov    %r12d,%esi
+  802009:	4c 89 ef             	mov    %r13,%rdi
+  80200c:	ff d0                	call   *%rax
+}
+  80200e:	48 83 c4 18          	add    $0x18,%rsp
+  802012:	5b                   	pop    %rbx
+  802013:	41 5c                	pop    %r12
+  802015:	41 5d                	pop    %r13
+  802017:	5d                   	pop    %rbp
+  802018:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802019:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802020:	00 00 00 
+  802023:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802029:	89 da                	mov    %ebx,%edx
+  80202b:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  802032:	00 00 00 
+  802035:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203a:	48 b9 b4 02 80 00 00 	movabs $0x8002b4,%rcx
+  802041:	00 00 00 
+  802044:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802046:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80204b:	eb c1                	jmp    80200e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80204d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802052:	eb ba                	jmp    80200e <ftruncate+0x5e>
+
+0000000000802054 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802054:	55                   	push   %rbp
+  802055:	48 89 e5             	mov    %rsp,%rbp
+  802058:	41 54                	push   %r12
+  80205a:	53                   	push   %rbx
+  80205b:	48 83 ec 10          	sub    $0x10,%rsp
+  80205f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802062:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802066:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+  802072:	85 c0                	test   %eax,%eax
+  802074:	78 4e                	js     8020c4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802076:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80207a:	41 8b 3c 24          	mov    (%r12),%edi
+  80207e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802082:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 32                	js     8020c4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802092:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802096:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  80209b:	74 30                	je     8020cd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80209d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020a0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020a7:	00 00 00 
+    stat->st_isdir = 0;
+  8020aa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020b1:	00 00 00 
+    stat->st_dev = dev;
+  8020b4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020bb:	48 89 de             	mov    %rbx,%rsi
+  8020be:	4c 89 e7             	mov    %r12,%rdi
+  8020c1:	ff 50 30             	call   *0x30(%rax)
+}
+  8020c4:	48 83 c4 10          	add    $0x10,%rsp
+  8020c8:	5b                   	pop    %rbx
+  8020c9:	41 5c                	pop    %r12
+  8020cb:	5d                   	pop    %rbp
+  8020cc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020d2:	eb f0                	jmp    8020c4 <fstat+0x70>
+
+00000000008020d4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020d4:	55                   	push   %rbp
+  8020d5:	48 89 e5             	mov    %rsp,%rbp
+  8020d8:	41 54                	push   %r12
+  8020da:	53                   	push   %rbx
+  8020db:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020de:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e3:	48 b8 2b 2e 80 00 00 	movabs $0x802e2b,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+  8020ef:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020f1:	85 c0                	test   %eax,%eax
+  8020f3:	78 25                	js     80211a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020f5:	4c 89 e6             	mov    %r12,%rsi
+  8020f8:	89 c7                	mov    %eax,%edi
+  8020fa:	48 b8 54 20 80 00 00 	movabs $0x802054,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802109:	89 df                	mov    %ebx,%edi
+  80210b:	48 b8 4e 1b 80 00 00 	movabs $0x801b4e,%rax
+  802112:	00 00 00 
+  802115:	ff d0                	call   *%rax
+
+    return res;
+  802117:	44 89 e3             	mov    %r12d,%ebx
+}
+  80211a:	89 d8                	mov    %ebx,%eax
+  80211c:	5b                   	pop    %rbx
+  80211d:	41 5c                	pop    %r12
+  80211f:	5d                   	pop    %rbp
+  802120:	c3                   	ret
+
+0000000000802121 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+  802125:	41 54                	push   %r12
+  802127:	53                   	push   %rbx
+  802128:	48 83 ec 10          	sub    $0x10,%rsp
+  80212c:	48 89 fb             	mov    %rdi,%rbx
+  80212f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802132:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802136:	bf 66 00 00 00       	mov    $0x66,%edi
+  80213b:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802142:	00 00 00 
+  802145:	ff d0                	call   *%rax
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 1f                	js     80216a <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80214b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80214f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802153:	48 85 c0             	test   %rax,%rax
+  802156:	74 1b                	je     802173 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802158:	4c 89 e6             	mov    %r12,%rsi
+  80215b:	48 89 df             	mov    %rbx,%rdi
+  80215e:	ff d0                	call   *%rax
+    if (res < 0) {
+  802160:	85 c0                	test   %eax,%eax
+  802162:	ba 00 00 00 00       	mov    $0x0,%edx
+  802167:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80216a:	48 83 c4 10          	add    $0x10,%rsp
+  80216e:	5b                   	pop    %rbx
+  80216f:	41 5c                	pop    %r12
+  802171:	5d                   	pop    %rbp
+  802172:	c3                   	ret
+        return -E_NOT_SUPP;
+  802173:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802178:	eb f0                	jmp    80216a <create_snapshot+0x49>
+
+000000000080217a <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  80217a:	55                   	push   %rbp
+  80217b:	48 89 e5             	mov    %rsp,%rbp
+  80217e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802182:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802186:	bf 66 00 00 00       	mov    $0x66,%edi
+  80218b:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802192:	00 00 00 
+  802195:	ff d0                	call   *%rax
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 1e                	js     8021b9 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  80219b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80219f:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021a3:	48 85 d2             	test   %rdx,%rdx
+  8021a6:	74 13                	je     8021bb <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ad:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021b9:	c9                   	leave
+  8021ba:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021bb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c0:	eb f7                	jmp    8021b9 <print_snapshot_list+0x3f>
+
+00000000008021c2 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	53                   	push   %rbx
+  8021c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8021cb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021ce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021d2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021d7:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	85 c0                	test   %eax,%eax
+  8021e5:	78 1c                	js     802203 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8021e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021eb:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8021ef:	48 85 c0             	test   %rax,%rax
+  8021f2:	74 15                	je     802209 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8021f4:	48 89 df             	mov    %rbx,%rdi
+  8021f7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802200:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802203:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+        return -E_NOT_SUPP;
+  802209:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80220e:	eb f3                	jmp    802203 <accept_snapshot+0x41>
+
+0000000000802210 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+  802214:	53                   	push   %rbx
+  802215:	48 83 ec 18          	sub    $0x18,%rsp
+  802219:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80221c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802220:	bf 66 00 00 00       	mov    $0x66,%edi
+  802225:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  80222c:	00 00 00 
+  80222f:	ff d0                	call   *%rax
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 1c                	js     802251 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802239:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80223d:	48 85 c0             	test   %rax,%rax
+  802240:	74 15                	je     802257 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802242:	48 89 df             	mov    %rbx,%rdi
+  802245:	ff d0                	call   *%rax
+    if (res < 0) {
+  802247:	85 c0                	test   %eax,%eax
+  802249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802251:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+        return -E_NOT_SUPP;
+  802257:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80225c:	eb f3                	jmp    802251 <delete_snapshot+0x41>
+
+000000000080225e <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80225e:	55                   	push   %rbp
+  80225f:	48 89 e5             	mov    %rsp,%rbp
+  802262:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802266:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80226a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80226f:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 14                	js     802293 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80227f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802283:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802287:	48 85 d2             	test   %rdx,%rdx
+  80228a:	74 09                	je     802295 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80228c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802291:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+        return -E_NOT_SUPP;
+  802295:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80229a:	eb f7                	jmp    802293 <gc_snapshots+0x35>
+
+000000000080229c <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80229c:	55                   	push   %rbp
+  80229d:	48 89 e5             	mov    %rsp,%rbp
+  8022a0:	41 56                	push   %r14
+  8022a2:	41 55                	push   %r13
+  8022a4:	41 54                	push   %r12
+  8022a6:	53                   	push   %rbx
+  8022a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ab:	48 89 fb             	mov    %rdi,%rbx
+  8022ae:	49 89 f4             	mov    %rsi,%r12
+  8022b1:	49 89 d5             	mov    %rdx,%r13
+  8022b4:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022bb:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022c0:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+  8022cc:	85 c0                	test   %eax,%eax
+  8022ce:	78 1b                	js     8022eb <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8022d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d4:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8022d8:	48 85 c0             	test   %rax,%rax
+  8022db:	74 1b                	je     8022f8 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8022dd:	4c 89 f1             	mov    %r14,%rcx
+  8022e0:	4c 89 ea             	mov    %r13,%rdx
+  8022e3:	4c 89 e6             	mov    %r12,%rsi
+  8022e6:	48 89 df             	mov    %rbx,%rdi
+  8022e9:	ff d0                	call   *%rax
+
+    return res;
+}
+  8022eb:	48 83 c4 10          	add    $0x10,%rsp
+  8022ef:	5b                   	pop    %rbx
+  8022f0:	41 5c                	pop    %r12
+  8022f2:	41 5d                	pop    %r13
+  8022f4:	41 5e                	pop    %r14
+  8022f6:	5d                   	pop    %rbp
+  8022f7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022f8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022fd:	eb ec                	jmp    8022eb <diff_snapshots+0x4f>
+
+00000000008022ff <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8022ff:	55                   	push   %rbp
+  802300:	48 89 e5             	mov    %rsp,%rbp
+  802303:	41 55                	push   %r13
+  802305:	41 54                	push   %r12
+  802307:	53                   	push   %rbx
+  802308:	48 83 ec 18          	sub    $0x18,%rsp
+  80230c:	48 89 fb             	mov    %rdi,%rbx
+  80230f:	49 89 f4             	mov    %rsi,%r12
+  802312:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802315:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802319:	bf 66 00 00 00       	mov    $0x66,%edi
+  80231e:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	78 18                	js     802346 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80232e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802332:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802336:	48 85 c0             	test   %rax,%rax
+  802339:	74 16                	je     802351 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80233b:	4c 89 ea             	mov    %r13,%rdx
+  80233e:	4c 89 e6             	mov    %r12,%rsi
+  802341:	48 89 df             	mov    %rbx,%rdi
+  802344:	ff d0                	call   *%rax
+
+    return res;
+}
+  802346:	48 83 c4 18          	add    $0x18,%rsp
+  80234a:	5b                   	pop    %rbx
+  80234b:	41 5c                	pop    %r12
+  80234d:	41 5d                	pop    %r13
+  80234f:	5d                   	pop    %rbp
+  802350:	c3                   	ret
+        return -E_NOT_SUPP;
+  802351:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802356:	eb ee                	jmp    802346 <send_snapshot+0x47>
+
+0000000000802358 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802358:	55                   	push   %rbp
+  802359:	48 89 e5             	mov    %rsp,%rbp
+  80235c:	53                   	push   %rbx
+  80235d:	48 83 ec 18          	sub    $0x18,%rsp
+  802361:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802364:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802368:	bf 66 00 00 00       	mov    $0x66,%edi
+  80236d:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	78 12                	js     80238f <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80237d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802381:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802385:	48 85 c0             	test   %rax,%rax
+  802388:	74 0b                	je     802395 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80238a:	48 89 df             	mov    %rbx,%rdi
+  80238d:	ff d0                	call   *%rax
+
+    return res;
+}
+  80238f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802393:	c9                   	leave
+  802394:	c3                   	ret
+        return -E_NOT_SUPP;
+  802395:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80239a:	eb f3                	jmp    80238f <receive_snapshot+0x37>
+
+000000000080239c <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023a8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023ad:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 17                	js     8023d4 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8023bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023c1:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8023c8:	48 85 d2             	test   %rdx,%rdx
+  8023cb:	74 09                	je     8023d6 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8023cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8023d4:	c9                   	leave
+  8023d5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023d6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023db:	eb f7                	jmp    8023d4 <free_space_bytes+0x38>
+
+00000000008023dd <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8023dd:	55                   	push   %rbp
+  8023de:	48 89 e5             	mov    %rsp,%rbp
+  8023e1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023e9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023ee:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	78 17                	js     802415 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8023fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802402:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802409:	48 85 d2             	test   %rdx,%rdx
+  80240c:	74 09                	je     802417 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+        return -E_NOT_SUPP;
+  802417:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80241c:	eb f7                	jmp    802415 <busy_space_bytes+0x38>
+
+000000000080241e <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80241e:	55                   	push   %rbp
+  80241f:	48 89 e5             	mov    %rsp,%rbp
+  802422:	41 54                	push   %r12
+  802424:	53                   	push   %rbx
+  802425:	48 83 ec 10          	sub    $0x10,%rsp
+  802429:	89 fb                	mov    %edi,%ebx
+  80242b:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80242e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802432:	bf 66 00 00 00       	mov    $0x66,%edi
+  802437:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+  802443:	85 c0                	test   %eax,%eax
+  802445:	78 17                	js     80245e <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802447:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244b:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802452:	48 85 c0             	test   %rax,%rax
+  802455:	74 10                	je     802467 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802457:	4c 89 e6             	mov    %r12,%rsi
+  80245a:	89 df                	mov    %ebx,%edi
+  80245c:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80245e:	48 83 c4 10          	add    $0x10,%rsp
+  802462:	5b                   	pop    %rbx
+  802463:	41 5c                	pop    %r12
+  802465:	5d                   	pop    %rbp
+  802466:	c3                   	ret
+        return -E_NOT_SUPP;
+  802467:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80246c:	eb f0                	jmp    80245e <snapshots_space+0x40>
+
+000000000080246e <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80246e:	55                   	push   %rbp
+  80246f:	48 89 e5             	mov    %rsp,%rbp
+  802472:	41 55                	push   %r13
+  802474:	41 54                	push   %r12
+  802476:	53                   	push   %rbx
+  802477:	48 83 ec 08          	sub    $0x8,%rsp
+  80247b:	41 89 fd             	mov    %edi,%r13d
+  80247e:	48 89 f3             	mov    %rsi,%rbx
+  802481:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802484:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80248b:	00 00 00 
+  80248e:	83 38 00             	cmpl   $0x0,(%rax)
+  802491:	74 57                	je     8024ea <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802493:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802499:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80249e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8024a5:	00 00 00 
+  8024a8:	44 89 ee             	mov    %r13d,%esi
+  8024ab:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8024b2:	00 00 00 
+  8024b5:	8b 38                	mov    (%rax),%edi
+  8024b7:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8024c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c8:	4c 89 e2             	mov    %r12,%rdx
+  8024cb:	48 89 de             	mov    %rbx,%rsi
+  8024ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d3:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+}
+  8024df:	48 83 c4 08          	add    $0x8,%rsp
+  8024e3:	5b                   	pop    %rbx
+  8024e4:	41 5c                	pop    %r12
+  8024e6:	41 5d                	pop    %r13
+  8024e8:	5d                   	pop    %rbp
+  8024e9:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024ef:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+  8024fb:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802502:	00 00 
+  802504:	eb 8d                	jmp    802493 <fsipc_region+0x25>
+
+0000000000802506 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80250e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802515:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802516:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80251a:	48 b8 6e 24 80 00 00 	movabs $0x80246e,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+}
+  802526:	c9                   	leave
+  802527:	c3                   	ret
+
+0000000000802528 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802528:	85 ff                	test   %edi,%edi
+  80252a:	78 6d                	js     802599 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80252c:	55                   	push   %rbp
+  80252d:	48 89 e5             	mov    %rsp,%rbp
+  802530:	41 54                	push   %r12
+  802532:	53                   	push   %rbx
+  802533:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802536:	48 85 f6             	test   %rsi,%rsi
+  802539:	74 57                	je     802592 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80253b:	89 f8                	mov    %edi,%eax
+  80253d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802544:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802546:	be 00 00 00 00       	mov    $0x0,%esi
+  80254b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802550:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80255c:	85 c0                	test   %eax,%eax
+  80255e:	78 2d                	js     80258d <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802560:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802567:	00 00 00 
+  80256a:	49 63 14 24          	movslq (%r12),%rdx
+  80256e:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802575:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80257a:	48 89 df             	mov    %rbx,%rdi
+  80257d:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802589:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80258d:	5b                   	pop    %rbx
+  80258e:	41 5c                	pop    %r12
+  802590:	5d                   	pop    %rbp
+  802591:	c3                   	ret
+        return -E_INVAL;
+  802592:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802597:	eb f4                	jmp    80258d <devfile_df_snapshots+0x65>
+  802599:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80259e:	c3                   	ret
+
+000000000080259f <devfile_df_busy>:
+devfile_df_busy() {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025ad:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8025b4:	00 00 00 
+  8025b7:	ff d0                	call   *%rax
+}
+  8025b9:	5d                   	pop    %rbp
+  8025ba:	c3                   	ret
+
+00000000008025bb <devfile_df_free>:
+devfile_df_free() {
+  8025bb:	55                   	push   %rbp
+  8025bc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8025bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025c9:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+}
+  8025d5:	5d                   	pop    %rbp
+  8025d6:	c3                   	ret
+
+00000000008025d7 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8025d7:	55                   	push   %rbp
+  8025d8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8025db:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025e5:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+}
+  8025f1:	5d                   	pop    %rbp
+  8025f2:	c3                   	ret
+
+00000000008025f3 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8025f3:	55                   	push   %rbp
+  8025f4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8025f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025fc:	bf 09 00 00 00       	mov    $0x9,%edi
+  802601:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802608:	00 00 00 
+  80260b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802614:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802617:	5d                   	pop    %rbp
+  802618:	c3                   	ret
+
+0000000000802619 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80261d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802624:	00 00 00 
+  802627:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80262a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80262c:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80262f:	be 00 00 00 00       	mov    $0x0,%esi
+  802634:	bf 02 00 00 00       	mov    $0x2,%edi
+  802639:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+}
+  802645:	5d                   	pop    %rbp
+  802646:	c3                   	ret
+
+0000000000802647 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802647:	55                   	push   %rbp
+  802648:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80264b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80264e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802655:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802657:	be 00 00 00 00       	mov    $0x0,%esi
+  80265c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802661:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802668:	00 00 00 
+  80266b:	ff d0                	call   *%rax
+}
+  80266d:	5d                   	pop    %rbp
+  80266e:	c3                   	ret
+
+000000000080266f <devfile_write>:
+    if (!fd || !buf) {
+  80266f:	48 85 ff             	test   %rdi,%rdi
+  802672:	0f 84 c1 00 00 00    	je     802739 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802678:	55                   	push   %rbp
+  802679:	48 89 e5             	mov    %rsp,%rbp
+  80267c:	41 57                	push   %r15
+  80267e:	41 56                	push   %r14
+  802680:	41 55                	push   %r13
+  802682:	41 54                	push   %r12
+  802684:	53                   	push   %rbx
+  802685:	48 83 ec 18          	sub    $0x18,%rsp
+  802689:	49 89 ff             	mov    %rdi,%r15
+  80268c:	49 89 f5             	mov    %rsi,%r13
+  80268f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802692:	48 85 f6             	test   %rsi,%rsi
+  802695:	0f 84 95 00 00 00    	je     802730 <devfile_write+0xc1>
+    while (n) {
+  80269b:	48 85 d2             	test   %rdx,%rdx
+  80269e:	0f 84 83 00 00 00    	je     802727 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026a4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026ab:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8026b2:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026b5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026ba:	49 39 dc             	cmp    %rbx,%r12
+  8026bd:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8026c1:	48 89 da             	mov    %rbx,%rdx
+  8026c4:	4c 89 ee             	mov    %r13,%rsi
+  8026c7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8026ce:	00 00 00 
+  8026d1:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  8026d8:	00 00 00 
+  8026db:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026dd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026e1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8026e4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8026e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026f2:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+        if (write < 0) {
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	78 21                	js     802723 <devfile_write+0xb4>
+        buf += write;
+  802702:	48 63 d0             	movslq %eax,%rdx
+  802705:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802708:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80270b:	49 29 d4             	sub    %rdx,%r12
+  80270e:	75 a5                	jne    8026b5 <devfile_write+0x46>
+    return totalWrite;
+  802710:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802714:	48 83 c4 18          	add    $0x18,%rsp
+  802718:	5b                   	pop    %rbx
+  802719:	41 5c                	pop    %r12
+  80271b:	41 5d                	pop    %r13
+  80271d:	41 5e                	pop    %r14
+  80271f:	41 5f                	pop    %r15
+  802721:	5d                   	pop    %rbp
+  802722:	c3                   	ret
+            return write;
+  802723:	48 98                	cltq
+  802725:	eb ed                	jmp    802714 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802727:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80272e:	eb e0                	jmp    802710 <devfile_write+0xa1>
+        return -E_INVAL;
+  802730:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802737:	eb db                	jmp    802714 <devfile_write+0xa5>
+  802739:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802740:	c3                   	ret
+
+0000000000802741 <devfile_read>:
+    if (!fd || !buf) {
+  802741:	48 85 ff             	test   %rdi,%rdi
+  802744:	0f 84 c0 00 00 00    	je     80280a <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80274a:	55                   	push   %rbp
+  80274b:	48 89 e5             	mov    %rsp,%rbp
+  80274e:	41 57                	push   %r15
+  802750:	41 56                	push   %r14
+  802752:	41 55                	push   %r13
+  802754:	41 54                	push   %r12
+  802756:	53                   	push   %rbx
+  802757:	48 83 ec 18          	sub    $0x18,%rsp
+  80275b:	49 89 ff             	mov    %rdi,%r15
+  80275e:	49 89 f5             	mov    %rsi,%r13
+  802761:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802764:	48 85 f6             	test   %rsi,%rsi
+  802767:	0f 84 96 00 00 00    	je     802803 <devfile_read+0xc2>
+    while (n) {
+  80276d:	48 85 d2             	test   %rdx,%rdx
+  802770:	0f 84 87 00 00 00    	je     8027fd <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802776:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80277d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80277e:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802785:	00 00 00 
+  802788:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80278c:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80278f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802794:	49 39 c4             	cmp    %rax,%r12
+  802797:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80279b:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80279f:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027a9:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8027b0:	00 00 00 
+  8027b3:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8027b5:	85 c0                	test   %eax,%eax
+  8027b7:	7e 37                	jle    8027f0 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8027b9:	48 63 d8             	movslq %eax,%rbx
+  8027bc:	48 89 da             	mov    %rbx,%rdx
+  8027bf:	4c 89 f6             	mov    %r14,%rsi
+  8027c2:	4c 89 ef             	mov    %r13,%rdi
+  8027c5:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  8027cc:	00 00 00 
+  8027cf:	ff d0                	call   *%rax
+        buf += read;
+  8027d1:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8027d4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8027d8:	49 29 dc             	sub    %rbx,%r12
+  8027db:	75 ab                	jne    802788 <devfile_read+0x47>
+  return totalRead;
+  8027dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8027e1:	48 83 c4 18          	add    $0x18,%rsp
+  8027e5:	5b                   	pop    %rbx
+  8027e6:	41 5c                	pop    %r12
+  8027e8:	41 5d                	pop    %r13
+  8027ea:	41 5e                	pop    %r14
+  8027ec:	41 5f                	pop    %r15
+  8027ee:	5d                   	pop    %rbp
+  8027ef:	c3                   	ret
+            return read ? read : totalRead;
+  8027f0:	48 63 d0             	movslq %eax,%rdx
+  8027f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027f7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8027fb:	eb e4                	jmp    8027e1 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8027fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802801:	eb da                	jmp    8027dd <devfile_read+0x9c>
+        return E_INVAL;
+  802803:	b8 03 00 00 00       	mov    $0x3,%eax
+  802808:	eb d7                	jmp    8027e1 <devfile_read+0xa0>
+  80280a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80280f:	c3                   	ret
+
+0000000000802810 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802810:	48 85 ff             	test   %rdi,%rdi
+  802813:	74 5f                	je     802874 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	53                   	push   %rbx
+  80281a:	48 83 ec 08          	sub    $0x8,%rsp
+  80281e:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802821:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802828:	00 00 00 
+  80282b:	ff d0                	call   *%rax
+  80282d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802833:	77 45                	ja     80287a <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802835:	48 89 de             	mov    %rbx,%rsi
+  802838:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80283f:	00 00 00 
+  802842:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80284e:	be 00 00 00 00       	mov    $0x0,%esi
+  802853:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802858:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802864:	85 c0                	test   %eax,%eax
+  802866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80286e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802872:	c9                   	leave
+  802873:	c3                   	ret
+        return -E_INVAL;
+  802874:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802879:	c3                   	ret
+        return -E_INVAL;
+  80287a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287f:	eb ed                	jmp    80286e <devfile_receive_snapshot+0x5e>
+
+0000000000802881 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	41 55                	push   %r13
+  802887:	41 54                	push   %r12
+  802889:	53                   	push   %rbx
+  80288a:	48 83 ec 08          	sub    $0x8,%rsp
+  80288e:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802891:	48 85 f6             	test   %rsi,%rsi
+  802894:	0f 94 c0             	sete   %al
+  802897:	48 85 d2             	test   %rdx,%rdx
+  80289a:	0f 94 c2             	sete   %dl
+  80289d:	08 d0                	or     %dl,%al
+  80289f:	0f 85 ad 00 00 00    	jne    802952 <devfile_send_snapshot+0xd1>
+  8028a5:	48 89 fb             	mov    %rdi,%rbx
+  8028a8:	49 89 f4             	mov    %rsi,%r12
+  8028ab:	48 85 ff             	test   %rdi,%rdi
+  8028ae:	0f 84 9e 00 00 00    	je     802952 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8028b4:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+  8028c0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028c6:	0f 87 8d 00 00 00    	ja     802959 <devfile_send_snapshot+0xd8>
+  8028cc:	4c 89 e7             	mov    %r12,%rdi
+  8028cf:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+  8028db:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028e1:	77 7d                	ja     802960 <devfile_send_snapshot+0xdf>
+  8028e3:	4c 89 ef             	mov    %r13,%rdi
+  8028e6:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028f8:	77 6d                	ja     802967 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8028fa:	48 89 de             	mov    %rbx,%rsi
+  8028fd:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802904:	00 00 00 
+  802907:	48 bb d9 0b 80 00 00 	movabs $0x800bd9,%rbx
+  80290e:	00 00 00 
+  802911:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802913:	4c 89 e6             	mov    %r12,%rsi
+  802916:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80291d:	00 00 00 
+  802920:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802922:	4c 89 ee             	mov    %r13,%rsi
+  802925:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80292c:	00 00 00 
+  80292f:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802931:	be 00 00 00 00       	mov    $0x0,%esi
+  802936:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80293b:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802942:	00 00 00 
+  802945:	ff d0                	call   *%rax
+}
+  802947:	48 83 c4 08          	add    $0x8,%rsp
+  80294b:	5b                   	pop    %rbx
+  80294c:	41 5c                	pop    %r12
+  80294e:	41 5d                	pop    %r13
+  802950:	5d                   	pop    %rbp
+  802951:	c3                   	ret
+        return -E_INVAL;
+  802952:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802957:	eb ee                	jmp    802947 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802959:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80295e:	eb e7                	jmp    802947 <devfile_send_snapshot+0xc6>
+  802960:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802965:	eb e0                	jmp    802947 <devfile_send_snapshot+0xc6>
+  802967:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80296c:	eb d9                	jmp    802947 <devfile_send_snapshot+0xc6>
+
+000000000080296e <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80296e:	48 85 ff             	test   %rdi,%rdi
+  802971:	0f 84 41 01 00 00    	je     802ab8 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802977:	55                   	push   %rbp
+  802978:	48 89 e5             	mov    %rsp,%rbp
+  80297b:	41 57                	push   %r15
+  80297d:	41 56                	push   %r14
+  80297f:	41 55                	push   %r13
+  802981:	41 54                	push   %r12
+  802983:	53                   	push   %rbx
+  802984:	48 83 ec 08          	sub    $0x8,%rsp
+  802988:	49 89 fc             	mov    %rdi,%r12
+  80298b:	49 89 f5             	mov    %rsi,%r13
+  80298e:	48 89 d3             	mov    %rdx,%rbx
+  802991:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802994:	48 85 f6             	test   %rsi,%rsi
+  802997:	0f 84 ff 00 00 00    	je     802a9c <devfile_diff_snapshots+0x12e>
+  80299d:	48 85 d2             	test   %rdx,%rdx
+  8029a0:	0f 84 fd 00 00 00    	je     802aa3 <devfile_diff_snapshots+0x135>
+  8029a6:	48 85 c9             	test   %rcx,%rcx
+  8029a9:	0f 84 f4 00 00 00    	je     802aa3 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8029af:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8029b6:	00 00 00 
+  8029b9:	ff d0                	call   *%rax
+  8029bb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029c1:	0f 87 e3 00 00 00    	ja     802aaa <devfile_diff_snapshots+0x13c>
+  8029c7:	4c 89 ef             	mov    %r13,%rdi
+  8029ca:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+  8029d6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029dc:	0f 87 cf 00 00 00    	ja     802ab1 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8029e2:	4c 89 e6             	mov    %r12,%rsi
+  8029e5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8029ec:	00 00 00 
+  8029ef:	4c 89 e7             	mov    %r12,%rdi
+  8029f2:	49 bf d9 0b 80 00 00 	movabs $0x800bd9,%r15
+  8029f9:	00 00 00 
+  8029fc:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8029ff:	4c 89 ee             	mov    %r13,%rsi
+  802a02:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a09:	00 
+  802a0a:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a0d:	48 8b 03             	mov    (%rbx),%rax
+  802a10:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a17:	00 
+  802a18:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a1c:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a23:	00 
+  802a24:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a28:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a2f:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a30:	be 00 00 00 00       	mov    $0x0,%esi
+  802a35:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a3a:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a46:	85 c0                	test   %eax,%eax
+  802a48:	78 43                	js     802a8d <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a4a:	49 8b 04 24          	mov    (%r12),%rax
+  802a4e:	48 89 03             	mov    %rax,(%rbx)
+  802a51:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a56:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a5a:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802a5f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802a63:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802a68:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802a6c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802a70:	48 c1 e2 03          	shl    $0x3,%rdx
+  802a74:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802a79:	4c 89 f7             	mov    %r14,%rdi
+  802a7c:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  802a83:	00 00 00 
+  802a86:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802a88:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802a8d:	48 83 c4 08          	add    $0x8,%rsp
+  802a91:	5b                   	pop    %rbx
+  802a92:	41 5c                	pop    %r12
+  802a94:	41 5d                	pop    %r13
+  802a96:	41 5e                	pop    %r14
+  802a98:	41 5f                	pop    %r15
+  802a9a:	5d                   	pop    %rbp
+  802a9b:	c3                   	ret
+        return -E_INVAL;
+  802a9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aa1:	eb ea                	jmp    802a8d <devfile_diff_snapshots+0x11f>
+  802aa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aa8:	eb e3                	jmp    802a8d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802aaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aaf:	eb dc                	jmp    802a8d <devfile_diff_snapshots+0x11f>
+  802ab1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ab6:	eb d5                	jmp    802a8d <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802ab8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802abd:	c3                   	ret
+
+0000000000802abe <devfile_delete_snapshot>:
+    if (!name) {
+  802abe:	48 85 ff             	test   %rdi,%rdi
+  802ac1:	74 5f                	je     802b22 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802ac3:	55                   	push   %rbp
+  802ac4:	48 89 e5             	mov    %rsp,%rbp
+  802ac7:	53                   	push   %rbx
+  802ac8:	48 83 ec 08          	sub    $0x8,%rsp
+  802acc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802acf:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  802adb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ae1:	77 45                	ja     802b28 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802ae3:	48 89 de             	mov    %rbx,%rsi
+  802ae6:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802aed:	00 00 00 
+  802af0:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802afc:	be 00 00 00 00       	mov    $0x0,%esi
+  802b01:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b06:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802b0d:	00 00 00 
+  802b10:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b19:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b20:	c9                   	leave
+  802b21:	c3                   	ret
+        return -E_INVAL;
+  802b22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b27:	c3                   	ret
+        return -E_INVAL;
+  802b28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b2d:	eb ed                	jmp    802b1c <devfile_delete_snapshot+0x5e>
+
+0000000000802b2f <devfile_accept_snapshot>:
+    if (!name) {
+  802b2f:	48 85 ff             	test   %rdi,%rdi
+  802b32:	74 5f                	je     802b93 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	53                   	push   %rbx
+  802b39:	48 83 ec 08          	sub    $0x8,%rsp
+  802b3d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b40:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802b47:	00 00 00 
+  802b4a:	ff d0                	call   *%rax
+  802b4c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b52:	77 45                	ja     802b99 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b54:	48 89 de             	mov    %rbx,%rsi
+  802b57:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802b5e:	00 00 00 
+  802b61:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802b6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b72:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b77:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802b7e:	00 00 00 
+  802b81:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b91:	c9                   	leave
+  802b92:	c3                   	ret
+        return -E_INVAL;
+  802b93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b98:	c3                   	ret
+        return -E_INVAL;
+  802b99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b9e:	eb ed                	jmp    802b8d <devfile_accept_snapshot+0x5e>
+
+0000000000802ba0 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802ba0:	48 85 ff             	test   %rdi,%rdi
+  802ba3:	0f 84 9f 00 00 00    	je     802c48 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802ba9:	55                   	push   %rbp
+  802baa:	48 89 e5             	mov    %rsp,%rbp
+  802bad:	41 54                	push   %r12
+  802baf:	53                   	push   %rbx
+  802bb0:	48 89 fb             	mov    %rdi,%rbx
+  802bb3:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802bb6:	48 85 f6             	test   %rsi,%rsi
+  802bb9:	74 78                	je     802c33 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802bbb:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+  802bc7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bcd:	77 6b                	ja     802c3a <devfile_create_snapshot+0x9a>
+  802bcf:	4c 89 e7             	mov    %r12,%rdi
+  802bd2:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+  802bde:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802be4:	77 5b                	ja     802c41 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802be6:	48 89 de             	mov    %rbx,%rsi
+  802be9:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802bf0:	00 00 00 
+  802bf3:	48 bb d9 0b 80 00 00 	movabs $0x800bd9,%rbx
+  802bfa:	00 00 00 
+  802bfd:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802bff:	4c 89 e6             	mov    %r12,%rsi
+  802c02:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802c09:	00 00 00 
+  802c0c:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c13:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c18:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802c1f:	00 00 00 
+  802c22:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c24:	85 c0                	test   %eax,%eax
+  802c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c2b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c2e:	5b                   	pop    %rbx
+  802c2f:	41 5c                	pop    %r12
+  802c31:	5d                   	pop    %rbp
+  802c32:	c3                   	ret
+        return -E_INVAL;
+  802c33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c38:	eb f4                	jmp    802c2e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c3f:	eb ed                	jmp    802c2e <devfile_create_snapshot+0x8e>
+  802c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c46:	eb e6                	jmp    802c2e <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c4d:	c3                   	ret
+
+0000000000802c4e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c4e:	55                   	push   %rbp
+  802c4f:	48 89 e5             	mov    %rsp,%rbp
+  802c52:	41 54                	push   %r12
+  802c54:	53                   	push   %rbx
+  802c55:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c58:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c5b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802c62:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c64:	be 00 00 00 00       	mov    $0x0,%esi
+  802c69:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c6e:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	78 3d                	js     802cbb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c7e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802c85:	00 00 00 
+  802c88:	4c 89 e6             	mov    %r12,%rsi
+  802c8b:	48 89 df             	mov    %rbx,%rdi
+  802c8e:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802c95:	00 00 00 
+  802c98:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c9a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ca1:	00 
+  802ca2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ca8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802caf:	00 
+  802cb0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbb:	5b                   	pop    %rbx
+  802cbc:	41 5c                	pop    %r12
+  802cbe:	5d                   	pop    %rbp
+  802cbf:	c3                   	ret
+
+0000000000802cc0 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802cc0:	55                   	push   %rbp
+  802cc1:	48 89 e5             	mov    %rsp,%rbp
+  802cc4:	41 57                	push   %r15
+  802cc6:	41 56                	push   %r14
+  802cc8:	41 55                	push   %r13
+  802cca:	41 54                	push   %r12
+  802ccc:	53                   	push   %rbx
+  802ccd:	48 83 ec 38          	sub    $0x38,%rsp
+  802cd1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802cd5:	49 89 f5             	mov    %rsi,%r13
+  802cd8:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802cdb:	48 89 f0             	mov    %rsi,%rax
+  802cde:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ce3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ce7:	75 4f                	jne    802d38 <devfile_readmap+0x78>
+  802ce9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ced:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cf3:	75 1f                	jne    802d14 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802cf5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cf9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cfd:	49 be a8 34 80 00 00 	movabs $0x8034a8,%r14
+  802d04:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d07:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d0e:	0f 87 9d 00 00 00    	ja     802db1 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d14:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d18:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d1c:	4d 85 ff             	test   %r15,%r15
+  802d1f:	0f 85 cf 00 00 00    	jne    802df4 <devfile_readmap+0x134>
+  802d25:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d29:	48 83 c4 38          	add    $0x38,%rsp
+  802d2d:	5b                   	pop    %rbx
+  802d2e:	41 5c                	pop    %r12
+  802d30:	41 5d                	pop    %r13
+  802d32:	41 5e                	pop    %r14
+  802d34:	41 5f                	pop    %r15
+  802d36:	5d                   	pop    %rbp
+  802d37:	c3                   	ret
+    size_t totalRead = 0;
+  802d38:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d3f:	00 
+  802d40:	eb da                	jmp    802d1c <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d42:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d46:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d49:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802d50:	00 00 00 
+  802d53:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d59:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802d5d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d61:	4c 89 ee             	mov    %r13,%rsi
+  802d64:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d69:	48 b8 6e 24 80 00 00 	movabs $0x80246e,%rax
+  802d70:	00 00 00 
+  802d73:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802d75:	85 c0                	test   %eax,%eax
+  802d77:	7e a3                	jle    802d1c <devfile_readmap+0x5c>
+  802d79:	48 98                	cltq
+  802d7b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802d7f:	72 9b                	jb     802d1c <devfile_readmap+0x5c>
+        buf += read;
+  802d81:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802d84:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802d87:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d8b:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802d92:	75 88                	jne    802d1c <devfile_readmap+0x5c>
+  802d94:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d98:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d9e:	0f 85 78 ff ff ff    	jne    802d1c <devfile_readmap+0x5c>
+  802da4:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802dab:	0f 86 6b ff ff ff    	jbe    802d1c <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802db1:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802db7:	4d 39 e7             	cmp    %r12,%r15
+  802dba:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802dbe:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802dc5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802dc9:	0f 84 73 ff ff ff    	je     802d42 <devfile_readmap+0x82>
+  802dcf:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802dd3:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802dd8:	41 ff d6             	call   *%r14
+  802ddb:	a8 40                	test   $0x40,%al
+  802ddd:	0f 85 39 ff ff ff    	jne    802d1c <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802de3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dea:	4c 39 e3             	cmp    %r12,%rbx
+  802ded:	72 e4                	jb     802dd3 <devfile_readmap+0x113>
+  802def:	e9 4e ff ff ff       	jmp    802d42 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802df4:	4c 89 fa             	mov    %r15,%rdx
+  802df7:	4c 89 ee             	mov    %r13,%rsi
+  802dfa:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802dfe:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e0a:	48 85 c0             	test   %rax,%rax
+  802e0d:	78 0c                	js     802e1b <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e0f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e13:	48 01 f0             	add    %rsi,%rax
+  802e16:	e9 0e ff ff ff       	jmp    802d29 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e1b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e1f:	48 85 f6             	test   %rsi,%rsi
+  802e22:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e26:	e9 fe fe ff ff       	jmp    802d29 <devfile_readmap+0x69>
+
+0000000000802e2b <open>:
+open(const char *path, int mode) {
+  802e2b:	55                   	push   %rbp
+  802e2c:	48 89 e5             	mov    %rsp,%rbp
+  802e2f:	41 55                	push   %r13
+  802e31:	41 54                	push   %r12
+  802e33:	53                   	push   %rbx
+  802e34:	48 83 ec 18          	sub    $0x18,%rsp
+  802e38:	49 89 fc             	mov    %rdi,%r12
+  802e3b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e3e:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802e45:	00 00 00 
+  802e48:	ff d0                	call   *%rax
+  802e4a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e50:	0f 87 8a 00 00 00    	ja     802ee0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e56:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e5a:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+  802e66:	89 c3                	mov    %eax,%ebx
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	78 50                	js     802ebc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e6c:	4c 89 e6             	mov    %r12,%rsi
+  802e6f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802e76:	00 00 00 
+  802e79:	48 89 df             	mov    %rbx,%rdi
+  802e7c:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e88:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802e8f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e93:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e98:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802e9f:	00 00 00 
+  802ea2:	ff d0                	call   *%rax
+  802ea4:	89 c3                	mov    %eax,%ebx
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	78 1f                	js     802ec9 <open+0x9e>
+    return fd2num(fd);
+  802eaa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802eae:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  802eb5:	00 00 00 
+  802eb8:	ff d0                	call   *%rax
+  802eba:	89 c3                	mov    %eax,%ebx
+}
+  802ebc:	89 d8                	mov    %ebx,%eax
+  802ebe:	48 83 c4 18          	add    $0x18,%rsp
+  802ec2:	5b                   	pop    %rbx
+  802ec3:	41 5c                	pop    %r12
+  802ec5:	41 5d                	pop    %r13
+  802ec7:	5d                   	pop    %rbp
+  802ec8:	c3                   	ret
+        fd_close(fd, 0);
+  802ec9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ece:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ed2:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  802ed9:	00 00 00 
+  802edc:	ff d0                	call   *%rax
+        return res;
+  802ede:	eb dc                	jmp    802ebc <open+0x91>
+        return -E_BAD_PATH;
+  802ee0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ee5:	eb d5                	jmp    802ebc <open+0x91>
+
+0000000000802ee7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802ee7:	55                   	push   %rbp
+  802ee8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef0:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ef5:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+}
+  802f01:	5d                   	pop    %rbp
+  802f02:	c3                   	ret
+
+0000000000802f03 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f03:	55                   	push   %rbp
+  802f04:	48 89 e5             	mov    %rsp,%rbp
+  802f07:	41 54                	push   %r12
+  802f09:	53                   	push   %rbx
+  802f0a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f0d:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+  802f19:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f1c:	48 be 20 3f 80 00 00 	movabs $0x803f20,%rsi
+  802f23:	00 00 00 
+  802f26:	48 89 df             	mov    %rbx,%rdi
+  802f29:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  802f30:	00 00 00 
+  802f33:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f35:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f3a:	41 2b 04 24          	sub    (%r12),%eax
+  802f3e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f44:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f4b:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f4e:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802f55:	00 00 00 
+  802f58:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f64:	5b                   	pop    %rbx
+  802f65:	41 5c                	pop    %r12
+  802f67:	5d                   	pop    %rbp
+  802f68:	c3                   	ret
+
+0000000000802f69 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f69:	55                   	push   %rbp
+  802f6a:	48 89 e5             	mov    %rsp,%rbp
+  802f6d:	41 54                	push   %r12
+  802f6f:	53                   	push   %rbx
+  802f70:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f78:	48 89 fe             	mov    %rdi,%rsi
+  802f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f80:	49 bc 31 13 80 00 00 	movabs $0x801331,%r12
+  802f87:	00 00 00 
+  802f8a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802f8d:	48 89 df             	mov    %rbx,%rdi
+  802f90:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  802f97:	00 00 00 
+  802f9a:	ff d0                	call   *%rax
+  802f9c:	48 89 c6             	mov    %rax,%rsi
+  802f9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa9:	41 ff d4             	call   *%r12
+}
+  802fac:	5b                   	pop    %rbx
+  802fad:	41 5c                	pop    %r12
+  802faf:	5d                   	pop    %rbp
+  802fb0:	c3                   	ret
+
+0000000000802fb1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	41 57                	push   %r15
+  802fb7:	41 56                	push   %r14
+  802fb9:	41 55                	push   %r13
+  802fbb:	41 54                	push   %r12
+  802fbd:	53                   	push   %rbx
+  802fbe:	48 83 ec 18          	sub    $0x18,%rsp
+  802fc2:	49 89 fc             	mov    %rdi,%r12
+  802fc5:	49 89 f5             	mov    %rsi,%r13
+  802fc8:	49 89 d7             	mov    %rdx,%r15
+  802fcb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fcf:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  802fd6:	00 00 00 
+  802fd9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802fdb:	4d 85 ff             	test   %r15,%r15
+  802fde:	0f 84 af 00 00 00    	je     803093 <devpipe_write+0xe2>
+  802fe4:	48 89 c3             	mov    %rax,%rbx
+  802fe7:	4c 89 f8             	mov    %r15,%rax
+  802fea:	4d 89 ef             	mov    %r13,%r15
+  802fed:	4c 01 e8             	add    %r13,%rax
+  802ff0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ff4:	49 bd 39 12 80 00 00 	movabs $0x801239,%r13
+  802ffb:	00 00 00 
+            sys_yield();
+  802ffe:	49 be d6 11 80 00 00 	movabs $0x8011d6,%r14
+  803005:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803008:	8b 73 04             	mov    0x4(%rbx),%esi
+  80300b:	48 63 ce             	movslq %esi,%rcx
+  80300e:	48 63 03             	movslq (%rbx),%rax
+  803011:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803017:	48 39 c1             	cmp    %rax,%rcx
+  80301a:	72 2e                	jb     80304a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80301c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803021:	48 89 da             	mov    %rbx,%rdx
+  803024:	be 00 10 00 00       	mov    $0x1000,%esi
+  803029:	4c 89 e7             	mov    %r12,%rdi
+  80302c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	74 66                	je     803099 <devpipe_write+0xe8>
+            sys_yield();
+  803033:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803036:	8b 73 04             	mov    0x4(%rbx),%esi
+  803039:	48 63 ce             	movslq %esi,%rcx
+  80303c:	48 63 03             	movslq (%rbx),%rax
+  80303f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803045:	48 39 c1             	cmp    %rax,%rcx
+  803048:	73 d2                	jae    80301c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80304a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80304e:	48 89 ca             	mov    %rcx,%rdx
+  803051:	48 c1 ea 03          	shr    $0x3,%rdx
+  803055:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80305c:	08 10 20 
+  80305f:	48 f7 e2             	mul    %rdx
+  803062:	48 c1 ea 06          	shr    $0x6,%rdx
+  803066:	48 89 d0             	mov    %rdx,%rax
+  803069:	48 c1 e0 09          	shl    $0x9,%rax
+  80306d:	48 29 d0             	sub    %rdx,%rax
+  803070:	48 c1 e0 03          	shl    $0x3,%rax
+  803074:	48 29 c1             	sub    %rax,%rcx
+  803077:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80307c:	83 c6 01             	add    $0x1,%esi
+  80307f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803082:	49 83 c7 01          	add    $0x1,%r15
+  803086:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80308a:	49 39 c7             	cmp    %rax,%r15
+  80308d:	0f 85 75 ff ff ff    	jne    803008 <devpipe_write+0x57>
+    return n;
+  803093:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803097:	eb 05                	jmp    80309e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803099:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309e:	48 83 c4 18          	add    $0x18,%rsp
+  8030a2:	5b                   	pop    %rbx
+  8030a3:	41 5c                	pop    %r12
+  8030a5:	41 5d                	pop    %r13
+  8030a7:	41 5e                	pop    %r14
+  8030a9:	41 5f                	pop    %r15
+  8030ab:	5d                   	pop    %rbp
+  8030ac:	c3                   	ret
+
+00000000008030ad <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030ad:	55                   	push   %rbp
+  8030ae:	48 89 e5             	mov    %rsp,%rbp
+  8030b1:	41 57                	push   %r15
+  8030b3:	41 56                	push   %r14
+  8030b5:	41 55                	push   %r13
+  8030b7:	41 54                	push   %r12
+  8030b9:	53                   	push   %rbx
+  8030ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8030be:	49 89 fc             	mov    %rdi,%r12
+  8030c1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030c9:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  8030d0:	00 00 00 
+  8030d3:	ff d0                	call   *%rax
+  8030d5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8030d8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030de:	49 bd 39 12 80 00 00 	movabs $0x801239,%r13
+  8030e5:	00 00 00 
+            sys_yield();
+  8030e8:	49 be d6 11 80 00 00 	movabs $0x8011d6,%r14
+  8030ef:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8030f2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030f7:	74 7d                	je     803176 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030f9:	8b 03                	mov    (%rbx),%eax
+  8030fb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030fe:	75 26                	jne    803126 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803100:	4d 85 ff             	test   %r15,%r15
+  803103:	75 77                	jne    80317c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803105:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80310a:	48 89 da             	mov    %rbx,%rdx
+  80310d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803112:	4c 89 e7             	mov    %r12,%rdi
+  803115:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803118:	85 c0                	test   %eax,%eax
+  80311a:	74 72                	je     80318e <devpipe_read+0xe1>
+            sys_yield();
+  80311c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80311f:	8b 03                	mov    (%rbx),%eax
+  803121:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803124:	74 df                	je     803105 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803126:	48 63 c8             	movslq %eax,%rcx
+  803129:	48 89 ca             	mov    %rcx,%rdx
+  80312c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803130:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803137:	08 10 20 
+  80313a:	48 89 d0             	mov    %rdx,%rax
+  80313d:	48 f7 e6             	mul    %rsi
+  803140:	48 c1 ea 06          	shr    $0x6,%rdx
+  803144:	48 89 d0             	mov    %rdx,%rax
+  803147:	48 c1 e0 09          	shl    $0x9,%rax
+  80314b:	48 29 d0             	sub    %rdx,%rax
+  80314e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803155:	00 
+  803156:	48 89 c8             	mov    %rcx,%rax
+  803159:	48 29 d0             	sub    %rdx,%rax
+  80315c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803161:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803165:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803169:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80316c:	49 83 c7 01          	add    $0x1,%r15
+  803170:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803174:	75 83                	jne    8030f9 <devpipe_read+0x4c>
+    return n;
+  803176:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80317a:	eb 03                	jmp    80317f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80317c:	4c 89 f8             	mov    %r15,%rax
+}
+  80317f:	48 83 c4 18          	add    $0x18,%rsp
+  803183:	5b                   	pop    %rbx
+  803184:	41 5c                	pop    %r12
+  803186:	41 5d                	pop    %r13
+  803188:	41 5e                	pop    %r14
+  80318a:	41 5f                	pop    %r15
+  80318c:	5d                   	pop    %rbp
+  80318d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80318e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803193:	eb ea                	jmp    80317f <devpipe_read+0xd2>
+
+0000000000803195 <pipe>:
+pipe(int pfd[2]) {
+  803195:	55                   	push   %rbp
+  803196:	48 89 e5             	mov    %rsp,%rbp
+  803199:	41 55                	push   %r13
+  80319b:	41 54                	push   %r12
+  80319d:	53                   	push   %rbx
+  80319e:	48 83 ec 18          	sub    $0x18,%rsp
+  8031a2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031a5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031a9:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  8031b0:	00 00 00 
+  8031b3:	ff d0                	call   *%rax
+  8031b5:	89 c3                	mov    %eax,%ebx
+  8031b7:	85 c0                	test   %eax,%eax
+  8031b9:	0f 88 a0 01 00 00    	js     80335f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8031bf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d2:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  8031d9:	00 00 00 
+  8031dc:	ff d0                	call   *%rax
+  8031de:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031e0:	85 c0                	test   %eax,%eax
+  8031e2:	0f 88 77 01 00 00    	js     80335f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8031e8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8031ec:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  8031f3:	00 00 00 
+  8031f6:	ff d0                	call   *%rax
+  8031f8:	89 c3                	mov    %eax,%ebx
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	0f 88 43 01 00 00    	js     803345 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803202:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803207:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80320c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803210:	bf 00 00 00 00       	mov    $0x0,%edi
+  803215:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  80321c:	00 00 00 
+  80321f:	ff d0                	call   *%rax
+  803221:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803223:	85 c0                	test   %eax,%eax
+  803225:	0f 88 1a 01 00 00    	js     803345 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80322b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80322f:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  803236:	00 00 00 
+  803239:	ff d0                	call   *%rax
+  80323b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80323e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803243:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803248:	48 89 c6             	mov    %rax,%rsi
+  80324b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803250:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+  80325c:	89 c3                	mov    %eax,%ebx
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	0f 88 c5 00 00 00    	js     80332b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803266:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80326a:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+  803276:	48 89 c1             	mov    %rax,%rcx
+  803279:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80327f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803285:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328a:	4c 89 ee             	mov    %r13,%rsi
+  80328d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803292:	48 b8 cc 12 80 00 00 	movabs $0x8012cc,%rax
+  803299:	00 00 00 
+  80329c:	ff d0                	call   *%rax
+  80329e:	89 c3                	mov    %eax,%ebx
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	78 6e                	js     803312 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032a9:	4c 89 ef             	mov    %r13,%rdi
+  8032ac:	48 b8 07 12 80 00 00 	movabs $0x801207,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+  8032b8:	83 f8 02             	cmp    $0x2,%eax
+  8032bb:	0f 85 ab 00 00 00    	jne    80336c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8032c1:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  8032c8:	00 00 
+  8032ca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032ce:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8032d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032d4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8032db:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8032df:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8032e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032e5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8032ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032f0:	48 bb 5b 19 80 00 00 	movabs $0x80195b,%rbx
+  8032f7:	00 00 00 
+  8032fa:	ff d3                	call   *%rbx
+  8032fc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803300:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803304:	ff d3                	call   *%rbx
+  803306:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80330b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803310:	eb 4d                	jmp    80335f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803312:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803317:	4c 89 ee             	mov    %r13,%rsi
+  80331a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331f:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  803326:	00 00 00 
+  803329:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80332b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803330:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803334:	bf 00 00 00 00       	mov    $0x0,%edi
+  803339:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  803340:	00 00 00 
+  803343:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803345:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80334a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80334e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803353:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  80335a:	00 00 00 
+  80335d:	ff d0                	call   *%rax
+}
+  80335f:	89 d8                	mov    %ebx,%eax
+  803361:	48 83 c4 18          	add    $0x18,%rsp
+  803365:	5b                   	pop    %rbx
+  803366:	41 5c                	pop    %r12
+  803368:	41 5d                	pop    %r13
+  80336a:	5d                   	pop    %rbp
+  80336b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80336c:	48 b9 50 3f 80 00 00 	movabs $0x803f50,%rcx
+  803373:	00 00 00 
+  803376:	48 ba 27 3f 80 00 00 	movabs $0x803f27,%rdx
+  80337d:	00 00 00 
+  803380:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803385:	48 bf 3c 3f 80 00 00 	movabs $0x803f3c,%rdi
+  80338c:	00 00 00 
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	49 b8 ec 37 80 00 00 	movabs $0x8037ec,%r8
+  80339b:	00 00 00 
+  80339e:	41 ff d0             	call   *%r8
+
+00000000008033a1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033a1:	55                   	push   %rbp
+  8033a2:	48 89 e5             	mov    %rsp,%rbp
+  8033a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033ad:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	78 35                	js     8033f2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8033bd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033c1:	48 b8 6d 19 80 00 00 	movabs $0x80196d,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+  8033cd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033da:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033de:	48 b8 39 12 80 00 00 	movabs $0x801239,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	85 c0                	test   %eax,%eax
+  8033ec:	0f 94 c0             	sete   %al
+  8033ef:	0f b6 c0             	movzbl %al,%eax
+}
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+
+00000000008033f4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033f4:	48 89 f8             	mov    %rdi,%rax
+  8033f7:	48 c1 e8 27          	shr    $0x27,%rax
+  8033fb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803402:	01 00 00 
+  803405:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803409:	f6 c2 01             	test   $0x1,%dl
+  80340c:	74 6d                	je     80347b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80340e:	48 89 f8             	mov    %rdi,%rax
+  803411:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803415:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80341c:	01 00 00 
+  80341f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803423:	f6 c2 01             	test   $0x1,%dl
+  803426:	74 62                	je     80348a <get_uvpt_entry+0x96>
+  803428:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80342f:	01 00 00 
+  803432:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803436:	f6 c2 80             	test   $0x80,%dl
+  803439:	75 4f                	jne    80348a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80343b:	48 89 f8             	mov    %rdi,%rax
+  80343e:	48 c1 e8 15          	shr    $0x15,%rax
+  803442:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803449:	01 00 00 
+  80344c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803450:	f6 c2 01             	test   $0x1,%dl
+  803453:	74 44                	je     803499 <get_uvpt_entry+0xa5>
+  803455:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80345c:	01 00 00 
+  80345f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803463:	f6 c2 80             	test   $0x80,%dl
+  803466:	75 31                	jne    803499 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803468:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80346c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803473:	01 00 00 
+  803476:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80347a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80347b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803482:	01 00 00 
+  803485:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803489:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80348a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803491:	01 00 00 
+  803494:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803498:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803499:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034a0:	01 00 00 
+  8034a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034a7:	c3                   	ret
+
+00000000008034a8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034ac:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  8034b3:	00 00 00 
+  8034b6:	ff d0                	call   *%rax
+  8034b8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034bb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034c0:	89 c1                	mov    %eax,%ecx
+  8034c2:	83 c9 04             	or     $0x4,%ecx
+  8034c5:	f6 c2 01             	test   $0x1,%dl
+  8034c8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034cb:	89 c1                	mov    %eax,%ecx
+  8034cd:	83 c9 02             	or     $0x2,%ecx
+  8034d0:	f6 c2 02             	test   $0x2,%dl
+  8034d3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8034d6:	89 c1                	mov    %eax,%ecx
+  8034d8:	83 c9 01             	or     $0x1,%ecx
+  8034db:	48 85 d2             	test   %rdx,%rdx
+  8034de:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8034e1:	89 c1                	mov    %eax,%ecx
+  8034e3:	83 c9 40             	or     $0x40,%ecx
+  8034e6:	f6 c6 04             	test   $0x4,%dh
+  8034e9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8034ec:	5d                   	pop    %rbp
+  8034ed:	c3                   	ret
+
+00000000008034ee <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8034ee:	55                   	push   %rbp
+  8034ef:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034f2:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  8034f9:	00 00 00 
+  8034fc:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8034fe:	48 c1 e8 06          	shr    $0x6,%rax
+  803502:	83 e0 01             	and    $0x1,%eax
+}
+  803505:	5d                   	pop    %rbp
+  803506:	c3                   	ret
+
+0000000000803507 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80350b:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803517:	48 c1 e8 05          	shr    $0x5,%rax
+  80351b:	83 e0 01             	and    $0x1,%eax
+}
+  80351e:	5d                   	pop    %rbp
+  80351f:	c3                   	ret
+
+0000000000803520 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803524:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  80352b:	00 00 00 
+  80352e:	ff d0                	call   *%rax
+  803530:	83 e0 01             	and    $0x1,%eax
+}
+  803533:	5d                   	pop    %rbp
+  803534:	c3                   	ret
+
+0000000000803535 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803535:	55                   	push   %rbp
+  803536:	48 89 e5             	mov    %rsp,%rbp
+  803539:	41 57                	push   %r15
+  80353b:	41 56                	push   %r14
+  80353d:	41 55                	push   %r13
+  80353f:	41 54                	push   %r12
+  803541:	53                   	push   %rbx
+  803542:	48 83 ec 18          	sub    $0x18,%rsp
+  803546:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80354a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80354e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803553:	49 bd 20 35 80 00 00 	movabs $0x803520,%r13
+  80355a:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80355d:	49 bf a8 34 80 00 00 	movabs $0x8034a8,%r15
+  803564:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803567:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80356e:	00 00 00 
+  803571:	eb 0c                	jmp    80357f <foreach_shared_region+0x4a>
+  803573:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80357a:	4c 39 f3             	cmp    %r14,%rbx
+  80357d:	74 2e                	je     8035ad <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80357f:	48 89 df             	mov    %rbx,%rdi
+  803582:	41 ff d5             	call   *%r13
+  803585:	84 c0                	test   %al,%al
+  803587:	74 ea                	je     803573 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803589:	48 89 df             	mov    %rbx,%rdi
+  80358c:	41 ff d7             	call   *%r15
+  80358f:	a8 40                	test   $0x40,%al
+  803591:	74 e0                	je     803573 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803593:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80359a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80359e:	48 89 df             	mov    %rbx,%rdi
+  8035a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035a5:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035a7:	85 c0                	test   %eax,%eax
+  8035a9:	79 c8                	jns    803573 <foreach_shared_region+0x3e>
+  8035ab:	eb 05                	jmp    8035b2 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035b2:	48 83 c4 18          	add    $0x18,%rsp
+  8035b6:	5b                   	pop    %rbx
+  8035b7:	41 5c                	pop    %r12
+  8035b9:	41 5d                	pop    %r13
+  8035bb:	41 5e                	pop    %r14
+  8035bd:	41 5f                	pop    %r15
+  8035bf:	5d                   	pop    %rbp
+  8035c0:	c3                   	ret
+
+00000000008035c1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8035c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c6:	c3                   	ret
+
+00000000008035c7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8035c7:	55                   	push   %rbp
+  8035c8:	48 89 e5             	mov    %rsp,%rbp
+  8035cb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8035ce:	48 be 74 3f 80 00 00 	movabs $0x803f74,%rsi
+  8035d5:	00 00 00 
+  8035d8:	48 b8 d9 0b 80 00 00 	movabs $0x800bd9,%rax
+  8035df:	00 00 00 
+  8035e2:	ff d0                	call   *%rax
+    return 0;
+}
+  8035e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e9:	5d                   	pop    %rbp
+  8035ea:	c3                   	ret
+
+00000000008035eb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035eb:	55                   	push   %rbp
+  8035ec:	48 89 e5             	mov    %rsp,%rbp
+  8035ef:	41 57                	push   %r15
+  8035f1:	41 56                	push   %r14
+  8035f3:	41 55                	push   %r13
+  8035f5:	41 54                	push   %r12
+  8035f7:	53                   	push   %rbx
+  8035f8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8035ff:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803606:	48 85 d2             	test   %rdx,%rdx
+  803609:	74 7a                	je     803685 <devcons_write+0x9a>
+  80360b:	49 89 d6             	mov    %rdx,%r14
+  80360e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803614:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803619:	49 bf d3 0d 80 00 00 	movabs $0x800dd3,%r15
+  803620:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803623:	4c 89 f3             	mov    %r14,%rbx
+  803626:	48 29 f3             	sub    %rsi,%rbx
+  803629:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80362e:	48 39 c3             	cmp    %rax,%rbx
+  803631:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803635:	4c 63 eb             	movslq %ebx,%r13
+  803638:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80363f:	48 01 c6             	add    %rax,%rsi
+  803642:	4c 89 ea             	mov    %r13,%rdx
+  803645:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80364c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80364f:	4c 89 ee             	mov    %r13,%rsi
+  803652:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803659:	48 b8 dc 10 80 00 00 	movabs $0x8010dc,%rax
+  803660:	00 00 00 
+  803663:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803665:	41 01 dc             	add    %ebx,%r12d
+  803668:	49 63 f4             	movslq %r12d,%rsi
+  80366b:	4c 39 f6             	cmp    %r14,%rsi
+  80366e:	72 b3                	jb     803623 <devcons_write+0x38>
+    return res;
+  803670:	49 63 c4             	movslq %r12d,%rax
+}
+  803673:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80367a:	5b                   	pop    %rbx
+  80367b:	41 5c                	pop    %r12
+  80367d:	41 5d                	pop    %r13
+  80367f:	41 5e                	pop    %r14
+  803681:	41 5f                	pop    %r15
+  803683:	5d                   	pop    %rbp
+  803684:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803685:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80368b:	eb e3                	jmp    803670 <devcons_write+0x85>
+
+000000000080368d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80368d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803690:	ba 00 00 00 00       	mov    $0x0,%edx
+  803695:	48 85 c0             	test   %rax,%rax
+  803698:	74 55                	je     8036ef <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80369a:	55                   	push   %rbp
+  80369b:	48 89 e5             	mov    %rsp,%rbp
+  80369e:	41 55                	push   %r13
+  8036a0:	41 54                	push   %r12
+  8036a2:	53                   	push   %rbx
+  8036a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8036a7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036aa:	48 bb 09 11 80 00 00 	movabs $0x801109,%rbx
+  8036b1:	00 00 00 
+  8036b4:	49 bc d6 11 80 00 00 	movabs $0x8011d6,%r12
+  8036bb:	00 00 00 
+  8036be:	eb 03                	jmp    8036c3 <devcons_read+0x36>
+  8036c0:	41 ff d4             	call   *%r12
+  8036c3:	ff d3                	call   *%rbx
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	74 f7                	je     8036c0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8036c9:	48 63 d0             	movslq %eax,%rdx
+  8036cc:	78 13                	js     8036e1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8036ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036d3:	83 f8 04             	cmp    $0x4,%eax
+  8036d6:	74 09                	je     8036e1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8036d8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8036dc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8036e1:	48 89 d0             	mov    %rdx,%rax
+  8036e4:	48 83 c4 08          	add    $0x8,%rsp
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	41 5d                	pop    %r13
+  8036ed:	5d                   	pop    %rbp
+  8036ee:	c3                   	ret
+  8036ef:	48 89 d0             	mov    %rdx,%rax
+  8036f2:	c3                   	ret
+
+00000000008036f3 <cputchar>:
+cputchar(int ch) {
+  8036f3:	55                   	push   %rbp
+  8036f4:	48 89 e5             	mov    %rsp,%rbp
+  8036f7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8036fb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8036ff:	be 01 00 00 00       	mov    $0x1,%esi
+  803704:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803708:	48 b8 dc 10 80 00 00 	movabs $0x8010dc,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+}
+  803714:	c9                   	leave
+  803715:	c3                   	ret
+
+0000000000803716 <getchar>:
+getchar(void) {
+  803716:	55                   	push   %rbp
+  803717:	48 89 e5             	mov    %rsp,%rbp
+  80371a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80371e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803723:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372c:	48 b8 cc 1c 80 00 00 	movabs $0x801ccc,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+  803738:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80373a:	85 c0                	test   %eax,%eax
+  80373c:	78 06                	js     803744 <getchar+0x2e>
+  80373e:	74 08                	je     803748 <getchar+0x32>
+  803740:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803744:	89 d0                	mov    %edx,%eax
+  803746:	c9                   	leave
+  803747:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803748:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80374d:	eb f5                	jmp    803744 <getchar+0x2e>
+
+000000000080374f <iscons>:
+iscons(int fdnum) {
+  80374f:	55                   	push   %rbp
+  803750:	48 89 e5             	mov    %rsp,%rbp
+  803753:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803757:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80375b:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  803762:	00 00 00 
+  803765:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803767:	85 c0                	test   %eax,%eax
+  803769:	78 18                	js     803783 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80376b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80376f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803776:	00 00 00 
+  803779:	8b 00                	mov    (%rax),%eax
+  80377b:	39 02                	cmp    %eax,(%rdx)
+  80377d:	0f 94 c0             	sete   %al
+  803780:	0f b6 c0             	movzbl %al,%eax
+}
+  803783:	c9                   	leave
+  803784:	c3                   	ret
+
+0000000000803785 <opencons>:
+opencons(void) {
+  803785:	55                   	push   %rbp
+  803786:	48 89 e5             	mov    %rsp,%rbp
+  803789:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80378d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803791:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  803798:	00 00 00 
+  80379b:	ff d0                	call   *%rax
+  80379d:	85 c0                	test   %eax,%eax
+  80379f:	78 49                	js     8037ea <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ab:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b4:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  8037bb:	00 00 00 
+  8037be:	ff d0                	call   *%rax
+  8037c0:	85 c0                	test   %eax,%eax
+  8037c2:	78 26                	js     8037ea <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8037c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037c8:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8037cf:	00 00 
+  8037d1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8037d3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037d7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8037de:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+}
+  8037ea:	c9                   	leave
+  8037eb:	c3                   	ret
+
+00000000008037ec <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	41 56                	push   %r14
+  8037f2:	41 55                	push   %r13
+  8037f4:	41 54                	push   %r12
+  8037f6:	53                   	push   %rbx
+  8037f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8037fb:	49 89 fc             	mov    %rdi,%r12
+  8037fe:	41 89 f5             	mov    %esi,%r13d
+  803801:	48 89 d3             	mov    %rdx,%rbx
+  803804:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803808:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80380c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803810:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803817:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80381b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80381f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803823:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803827:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80382e:	00 00 00 
+  803831:	4c 8b 30             	mov    (%rax),%r14
+  803834:	48 b8 a5 11 80 00 00 	movabs $0x8011a5,%rax
+  80383b:	00 00 00 
+  80383e:	ff d0                	call   *%rax
+  803840:	89 c6                	mov    %eax,%esi
+  803842:	45 89 e8             	mov    %r13d,%r8d
+  803845:	4c 89 e1             	mov    %r12,%rcx
+  803848:	4c 89 f2             	mov    %r14,%rdx
+  80384b:	48 bf 80 3f 80 00 00 	movabs $0x803f80,%rdi
+  803852:	00 00 00 
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385a:	49 bc b4 02 80 00 00 	movabs $0x8002b4,%r12
+  803861:	00 00 00 
+  803864:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803867:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80386b:	48 89 df             	mov    %rbx,%rdi
+  80386e:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+    cprintf("\n");
+  80387a:	48 bf db 3e 80 00 00 	movabs $0x803edb,%rdi
+  803881:	00 00 00 
+  803884:	b8 00 00 00 00       	mov    $0x0,%eax
+  803889:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80388c:	cc                   	int3
+  80388d:	eb fd                	jmp    80388c <_panic+0xa0>
+  80388f:	90                   	nop
+
+0000000000803890 <__rodata_start>:
+  803890:	73 65                	jae    8038f7 <__rodata_start+0x67>
+  803892:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803893:	64 20 30             	and    %dh,%fs:(%rax)
+  803896:	20 66 72             	and    %ah,0x72(%rsi)
+  803899:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80389a:	6d                   	insl   (%dx),%es:(%rdi)
+  80389b:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff45919 <__bss_end+0x6f73d919>
+  8038a1:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 2580431f <__bss_end+0x24ffc31f>
+  8038a7:	78 20                	js     8038c9 <__rodata_start+0x39>
+  8038a9:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8038ab:	74 20                	je     8038cd <__rodata_start+0x3d>
+  8038ad:	25 64 20 66 72       	and    $0x72662064,%eax
+  8038b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038b3:	6d                   	insl   (%dx),%es:(%rdi)
+  8038b4:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c804332 <__bss_end+0x3bffc332>
+  8038ba:	75 6e                	jne    80392a <__rodata_start+0x9a>
+  8038bc:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8038c0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c1:	3e 00 30             	ds add %dh,(%rax)
+  8038c4:	31 32                	xor    %esi,(%rdx)
+  8038c6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038cd:	41                   	rex.B
+  8038ce:	42                   	rex.X
+  8038cf:	43                   	rex.XB
+  8038d0:	44                   	rex.R
+  8038d1:	45                   	rex.RB
+  8038d2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038d5:	31 32                	xor    %esi,(%rdx)
+  8038d7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038de:	61                   	(bad)
+  8038df:	62 63 64 65 66       	(bad)
+  8038e4:	00 28                	add    %ch,(%rax)
+  8038e6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e7:	75 6c                	jne    803955 <__rodata_start+0xc5>
+  8038e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8038ea:	29 00                	sub    %eax,(%rax)
+  8038ec:	65 72 72             	gs jb  803961 <__rodata_start+0xd1>
+  8038ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038f0:	72 20                	jb     803912 <__rodata_start+0x82>
+  8038f2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038f7:	73 70                	jae    803969 <__rodata_start+0xd9>
+  8038f9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038fd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803904:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803905:	72 00                	jb     803907 <__rodata_start+0x77>
+  803907:	62 61 64 20 65       	(bad)
+  80390c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80390d:	76 69                	jbe    803978 <__rodata_start+0xe8>
+  80390f:	72 6f                	jb     803980 <__rodata_start+0xf0>
+  803911:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803912:	6d                   	insl   (%dx),%es:(%rdi)
+  803913:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803915:	74 00                	je     803917 <__rodata_start+0x87>
+  803917:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80391e:	20 70 61             	and    %dh,0x61(%rax)
+  803921:	72 61                	jb     803984 <__rodata_start+0xf4>
+  803923:	6d                   	insl   (%dx),%es:(%rdi)
+  803924:	65 74 65             	gs je  80398c <__rodata_start+0xfc>
+  803927:	72 00                	jb     803929 <__rodata_start+0x99>
+  803929:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80392a:	75 74                	jne    8039a0 <__rodata_start+0x110>
+  80392c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80392f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803932:	6d                   	insl   (%dx),%es:(%rdi)
+  803933:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803934:	72 79                	jb     8039af <__rodata_start+0x11f>
+  803936:	00 6f 75             	add    %ch,0x75(%rdi)
+  803939:	74 20                	je     80395b <__rodata_start+0xcb>
+  80393b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803940:	76 69                	jbe    8039ab <__rodata_start+0x11b>
+  803942:	72 6f                	jb     8039b3 <__rodata_start+0x123>
+  803944:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803945:	6d                   	insl   (%dx),%es:(%rdi)
+  803946:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803948:	74 73                	je     8039bd <__rodata_start+0x12d>
+  80394a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80394d:	72 72                	jb     8039c1 <__rodata_start+0x131>
+  80394f:	75 70                	jne    8039c1 <__rodata_start+0x131>
+  803951:	74 65                	je     8039b8 <__rodata_start+0x128>
+  803953:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803958:	75 67                	jne    8039c1 <__rodata_start+0x131>
+  80395a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80395d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80395f:	00 73 65             	add    %dh,0x65(%rbx)
+  803962:	67 6d                	insl   (%dx),%es:(%edi)
+  803964:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803966:	74 61                	je     8039c9 <__rodata_start+0x139>
+  803968:	74 69                	je     8039d3 <__rodata_start+0x143>
+  80396a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80396b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80396c:	20 66 61             	and    %ah,0x61(%rsi)
+  80396f:	75 6c                	jne    8039dd <__rodata_start+0x14d>
+  803971:	74 00                	je     803973 <__rodata_start+0xe3>
+  803973:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80397a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80397d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803981:	61                   	(bad)
+  803982:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803987:	20 73 75             	and    %dh,0x75(%rbx)
+  80398a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80398d:	73 79                	jae    803a08 <__rodata_start+0x178>
+  80398f:	73 74                	jae    803a05 <__rodata_start+0x175>
+  803991:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803993:	20 63 61             	and    %ah,0x61(%rbx)
+  803996:	6c                   	insb   (%dx),%es:(%rdi)
+  803997:	6c                   	insb   (%dx),%es:(%rdi)
+  803998:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80399b:	74 72                	je     803a0f <__rodata_start+0x17f>
+  80399d:	79 20                	jns    8039bf <__rodata_start+0x12f>
+  80399f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039a1:	74 20                	je     8039c3 <__rodata_start+0x133>
+  8039a3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039a5:	75 6e                	jne    803a15 <__rodata_start+0x185>
+  8039a7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8039ab:	76 20                	jbe    8039cd <__rodata_start+0x13d>
+  8039ad:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8039b4:	72 65                	jb     803a1b <__rodata_start+0x18b>
+  8039b6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8039b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8039be:	65 78 70             	gs js  803a31 <__rodata_start+0x1a1>
+  8039c1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8039c6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8039c9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8039cd:	20 66 69             	and    %ah,0x69(%rsi)
+  8039d0:	6c                   	insb   (%dx),%es:(%rdi)
+  8039d1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039d5:	20 66 72             	and    %ah,0x72(%rsi)
+  8039d8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039dd:	61                   	(bad)
+  8039de:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039e3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8039e7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ec:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039f0:	79 20                	jns    803a12 <__rodata_start+0x182>
+  8039f2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039f9:	72 65                	jb     803a60 <__rodata_start+0x1d0>
+  8039fb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a00:	00 66 69             	add    %ah,0x69(%rsi)
+  803a03:	6c                   	insb   (%dx),%es:(%rdi)
+  803a04:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a08:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a0c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a11:	74 20                	je     803a33 <__rodata_start+0x1a3>
+  803a13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a15:	75 6e                	jne    803a85 <__rodata_start+0x1f5>
+  803a17:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a1b:	76 61                	jbe    803a7e <__rodata_start+0x1ee>
+  803a1d:	6c                   	insb   (%dx),%es:(%rdi)
+  803a1e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a25:	00 
+  803a26:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a2d:	72 65                	jb     803a94 <__rodata_start+0x204>
+  803a2f:	61                   	(bad)
+  803a30:	64 79 20             	fs jns 803a53 <__rodata_start+0x1c3>
+  803a33:	65 78 69             	gs js  803a9f <__rodata_start+0x20f>
+  803a36:	73 74                	jae    803aac <__rodata_start+0x21c>
+  803a38:	73 00                	jae    803a3a <__rodata_start+0x1aa>
+  803a3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a3b:	70 65                	jo     803aa2 <__rodata_start+0x212>
+  803a3d:	72 61                	jb     803aa0 <__rodata_start+0x210>
+  803a3f:	74 69                	je     803aaa <__rodata_start+0x21a>
+  803a41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a43:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a46:	74 20                	je     803a68 <__rodata_start+0x1d8>
+  803a48:	73 75                	jae    803abf <__rodata_start+0x22f>
+  803a4a:	70 70                	jo     803abc <__rodata_start+0x22c>
+  803a4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a4d:	72 74                	jb     803ac3 <__rodata_start+0x233>
+  803a4f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a55:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a5a:	74 00                	je     803a5c <__rodata_start+0x1cc>
+  803a5c:	0f 1f 40 00          	nopl   0x0(%rax)
+  803a60:	a1 04 80 00 00 00 00 	movabs 0xe200000000008004,%eax
+  803a67:	00 e2 
+  803a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a6f:	00 d2                	add    %dl,%dl
+  803a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a77:	00 e2                	add    %ah,%dl
+  803a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a7f:	00 e2                	add    %ah,%dl
+  803a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a87:	00 e2                	add    %ah,%dl
+  803a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a8f:	00 e2                	add    %ah,%dl
+  803a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a97:	00 c0                	add    %al,%al
+  803a99:	04 80                	add    $0x80,%al
+  803a9b:	00 00                	add    %al,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 e2                	add    %ah,%dl
+  803aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aa7:	00 e2                	add    %ah,%dl
+  803aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aaf:	00 b4 04 80 00 00 00 	add    %dh,0x80(%rsp,%rax,1)
+  803ab6:	00 00                	add    %al,(%rax)
+  803ab8:	2e 05 80 00 00 00    	cs add $0x80,%eax
+  803abe:	00 00                	add    %al,(%rax)
+  803ac0:	e2 0a                	loop   803acc <__rodata_start+0x23c>
+  803ac2:	80 00 00             	addb   $0x0,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 b4 04 80 00 00 00 	add    %dh,0x80(%rsp,%rax,1)
+  803ace:	00 00                	add    %al,(%rax)
+  803ad0:	fa                   	cli
+  803ad1:	04 80                	add    $0x80,%al
+  803ad3:	00 00                	add    %al,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 fa                	add    %bh,%dl
+  803ad9:	04 80                	add    $0x80,%al
+  803adb:	00 00                	add    %al,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 fa                	add    %bh,%dl
+  803ae1:	04 80                	add    $0x80,%al
+  803ae3:	00 00                	add    %al,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 fa                	add    %bh,%dl
+  803ae9:	04 80                	add    $0x80,%al
+  803aeb:	00 00                	add    %al,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 fa                	add    %bh,%dl
+  803af1:	04 80                	add    $0x80,%al
+  803af3:	00 00                	add    %al,(%rax)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 fa                	add    %bh,%dl
+  803af9:	04 80                	add    $0x80,%al
+  803afb:	00 00                	add    %al,(%rax)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 fa                	add    %bh,%dl
+  803b01:	04 80                	add    $0x80,%al
+  803b03:	00 00                	add    %al,(%rax)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 fa                	add    %bh,%dl
+  803b09:	04 80                	add    $0x80,%al
+  803b0b:	00 00                	add    %al,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 fa                	add    %bh,%dl
+  803b11:	04 80                	add    $0x80,%al
+  803b13:	00 00                	add    %al,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 e2                	add    %ah,%dl
+  803b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b1f:	00 e2                	add    %ah,%dl
+  803b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b27:	00 e2                	add    %ah,%dl
+  803b29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b2f:	00 e2                	add    %ah,%dl
+  803b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b37:	00 e2                	add    %ah,%dl
+  803b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b3f:	00 e2                	add    %ah,%dl
+  803b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b47:	00 e2                	add    %ah,%dl
+  803b49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b4f:	00 e2                	add    %ah,%dl
+  803b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b57:	00 e2                	add    %ah,%dl
+  803b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b5f:	00 e2                	add    %ah,%dl
+  803b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b67:	00 e2                	add    %ah,%dl
+  803b69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b6f:	00 e2                	add    %ah,%dl
+  803b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b77:	00 e2                	add    %ah,%dl
+  803b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b7f:	00 e2                	add    %ah,%dl
+  803b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b87:	00 e2                	add    %ah,%dl
+  803b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b8f:	00 e2                	add    %ah,%dl
+  803b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b97:	00 e2                	add    %ah,%dl
+  803b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b9f:	00 e2                	add    %ah,%dl
+  803ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ba7:	00 e2                	add    %ah,%dl
+  803ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803baf:	00 e2                	add    %ah,%dl
+  803bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bb7:	00 e2                	add    %ah,%dl
+  803bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bbf:	00 e2                	add    %ah,%dl
+  803bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bc7:	00 e2                	add    %ah,%dl
+  803bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bcf:	00 e2                	add    %ah,%dl
+  803bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bd7:	00 e2                	add    %ah,%dl
+  803bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bdf:	00 e2                	add    %ah,%dl
+  803be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803be7:	00 e2                	add    %ah,%dl
+  803be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bef:	00 e2                	add    %ah,%dl
+  803bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bf7:	00 e2                	add    %ah,%dl
+  803bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bff:	00 e2                	add    %ah,%dl
+  803c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c07:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80bc17 <__bss_end+0x3c17>
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 e2                	add    %ah,%dl
+  803c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c17:	00 e2                	add    %ah,%dl
+  803c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c1f:	00 e2                	add    %ah,%dl
+  803c21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c27:	00 e2                	add    %ah,%dl
+  803c29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c2f:	00 e2                	add    %ah,%dl
+  803c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c37:	00 e2                	add    %ah,%dl
+  803c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c3f:	00 e2                	add    %ah,%dl
+  803c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c47:	00 e2                	add    %ah,%dl
+  803c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c4f:	00 e2                	add    %ah,%dl
+  803c51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c57:	00 e2                	add    %ah,%dl
+  803c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c5f:	00 51 05             	add    %dl,0x5(%rcx)
+  803c62:	80 00 00             	addb   $0x0,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 20                	add    %ah,(%rax)
+  803c69:	07                   	(bad)
+  803c6a:	80 00 00             	addb   $0x0,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 e2                	add    %ah,%dl
+  803c71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c77:	00 e2                	add    %ah,%dl
+  803c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c7f:	00 e2                	add    %ah,%dl
+  803c81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c87:	00 e2                	add    %ah,%dl
+  803c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c8f:	00 80 05 80 00 00    	add    %al,0x8005(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 e2                	add    %ah,%dl
+  803c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c9f:	00 e2                	add    %ah,%dl
+  803ca1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ca7:	00 46 05             	add    %al,0x5(%rsi)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 e2                	add    %ah,%dl
+  803cb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cb7:	00 e2                	add    %ah,%dl
+  803cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cbf:	00 c8                	add    %cl,%al
+  803cc1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803cc7:	00 92 09 80 00 00    	add    %dl,0x8009(%rdx)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 e2                	add    %ah,%dl
+  803cd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cd7:	00 e2                	add    %ah,%dl
+  803cd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cdf:	00 17                	add    %dl,(%rdi)
+  803ce1:	06                   	(bad)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 e2                	add    %ah,%dl
+  803ce9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cef:	00 f4                	add    %dh,%ah
+  803cf1:	07                   	(bad)
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 e2                	add    %ah,%dl
+  803cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cff:	00 e2                	add    %ah,%dl
+  803d01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d07:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80bd17 <__bss_end+0x3d17>
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 e2                	add    %ah,%dl
+  803d11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d17:	00 aa 04 80 00 00    	add    %ch,0x8004(%rdx)
+  803d1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d20 <error_string>:
+	...
+  803d28:	f5 38 80 00 00 00 00 00 07 39 80 00 00 00 00 00     .8.......9......
+  803d38:	17 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803d48:	37 39 80 00 00 00 00 00 4b 39 80 00 00 00 00 00     79......K9......
+  803d58:	60 39 80 00 00 00 00 00 73 39 80 00 00 00 00 00     `9......s9......
+  803d68:	85 39 80 00 00 00 00 00 99 39 80 00 00 00 00 00     .9.......9......
+  803d78:	a9 39 80 00 00 00 00 00 bc 39 80 00 00 00 00 00     .9.......9......
+  803d88:	d3 39 80 00 00 00 00 00 e9 39 80 00 00 00 00 00     .9.......9......
+  803d98:	01 3a 80 00 00 00 00 00 19 3a 80 00 00 00 00 00     .:.......:......
+  803da8:	26 3a 80 00 00 00 00 00 c8 3d 80 00 00 00 00 00     &:.......=......
+  803db8:	3a 3a 80 00 00 00 00 00 52 3a 80 00 00 00 00 00     ::......R:......
+  803dc8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803dd8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803de8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803df8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803e08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803e18:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803e28:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803e38:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  803e48:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803e58:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  803e68:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803e78:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803e88:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803e98:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803ea8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803eb8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803ec8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803ed8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803ee8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803ef8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803f00 <devtab>:
+  803f00:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803f10:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803f20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803f30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803f40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803f50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803f60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803f70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803f90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803fa0:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
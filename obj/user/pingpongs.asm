@@ -0,0 +1,7387 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  800036:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 c3 00 00 00    	jne    800110 <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  800054:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800061:	be 00 00 00 00       	mov    $0x0,%esi
+  800066:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006a:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800076:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80007d:	00 00 00 
+  800080:	4c 8b 20             	mov    (%rax),%r12
+  800083:	45 8b bc 24 c8 00 00 	mov    0xc8(%r12),%r15d
+  80008a:	00 
+  80008b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80008f:	44 8b 2b             	mov    (%rbx),%r13d
+  800092:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	45 89 f9             	mov    %r15d,%r9d
+  8000a3:	4d 89 e0             	mov    %r12,%r8
+  8000a6:	44 89 f1             	mov    %r14d,%ecx
+  8000a9:	44 89 ea             	mov    %r13d,%edx
+  8000ac:	48 bf 20 39 80 00 00 	movabs $0x803920,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 ba 0e 03 80 00 00 	movabs $0x80030e,%r10
+  8000c2:	00 00 00 
+  8000c5:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8000c8:	8b 03                	mov    (%rbx),%eax
+  8000ca:	83 f8 0a             	cmp    $0xa,%eax
+  8000cd:	74 32                	je     800101 <umain+0xdc>
+        ++val;
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8000d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000ec:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8000f8:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8000fb:	0f 85 56 ff ff ff    	jne    800057 <umain+0x32>
+    }
+}
+  800101:	48 83 c4 18          	add    $0x18,%rsp
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	41 5f                	pop    %r15
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800110:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800117:	00 00 00 
+  80011a:	48 8b 18             	mov    (%rax),%rbx
+  80011d:	49 bc ff 11 80 00 00 	movabs $0x8011ff,%r12
+  800124:	00 00 00 
+  800127:	41 ff d4             	call   *%r12
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 89 da             	mov    %rbx,%rdx
+  80012f:	48 bf f0 38 80 00 00 	movabs $0x8038f0,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 bb 0e 03 80 00 00 	movabs $0x80030e,%rbx
+  800145:	00 00 00 
+  800148:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014a:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80014e:	41 ff d4             	call   *%r12
+  800151:	89 c6                	mov    %eax,%esi
+  800153:	44 89 ea             	mov    %r13d,%edx
+  800156:	48 bf 0a 39 80 00 00 	movabs $0x80390a,%rdi
+  80015d:	00 00 00 
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80017f:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+  80018b:	e9 bd fe ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	41 89 fd             	mov    %edi,%r13d
+  80019e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a1:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8001a8:	00 00 00 
+  8001ab:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 39 c2             	cmp    %rax,%rdx
+  8001b8:	73 17                	jae    8001d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bd:	49 89 c4             	mov    %rax,%r12
+  8001c0:	48 83 c3 08          	add    $0x8,%rbx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cc:	4c 39 e3             	cmp    %r12,%rbx
+  8001cf:	72 ef                	jb     8001c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001d1:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+  8001dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001e6:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001ea:	48 c1 e0 04          	shl    $0x4,%rax
+  8001ee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f5:	00 00 00 
+  8001f8:	48 01 d0             	add    %rdx,%rax
+  8001fb:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800202:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800205:	45 85 ed             	test   %r13d,%r13d
+  800208:	7e 0d                	jle    800217 <libmain+0x87>
+  80020a:	49 8b 06             	mov    (%r14),%rax
+  80020d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800214:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800217:	4c 89 f6             	mov    %r14,%rsi
+  80021a:	44 89 ef             	mov    %r13d,%edi
+  80021d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800224:	00 00 00 
+  800227:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800229:	48 b8 3e 02 80 00 00 	movabs $0x80023e,%rax
+  800230:	00 00 00 
+  800233:	ff d0                	call   *%rax
+#endif
+}
+  800235:	5b                   	pop    %rbx
+  800236:	41 5c                	pop    %r12
+  800238:	41 5d                	pop    %r13
+  80023a:	41 5e                	pop    %r14
+  80023c:	5d                   	pop    %rbp
+  80023d:	c3                   	ret
+
+000000000080023e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80023e:	55                   	push   %rbp
+  80023f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800242:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800253:	48 b8 94 11 80 00 00 	movabs $0x801194,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+}
+  80025f:	5d                   	pop    %rbp
+  800260:	c3                   	ret
+
+0000000000800261 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800261:	55                   	push   %rbp
+  800262:	48 89 e5             	mov    %rsp,%rbp
+  800265:	53                   	push   %rbx
+  800266:	48 83 ec 08          	sub    $0x8,%rsp
+  80026a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80026d:	8b 06                	mov    (%rsi),%eax
+  80026f:	8d 50 01             	lea    0x1(%rax),%edx
+  800272:	89 16                	mov    %edx,(%rsi)
+  800274:	48 98                	cltq
+  800276:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80027b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800281:	74 0a                	je     80028d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800283:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800287:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80028d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800291:	be ff 00 00 00       	mov    $0xff,%esi
+  800296:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  80029d:	00 00 00 
+  8002a0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a8:	eb d9                	jmp    800283 <putch+0x22>
+
+00000000008002aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002aa:	55                   	push   %rbp
+  8002ab:	48 89 e5             	mov    %rsp,%rbp
+  8002ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002b5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002bf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002cc:	48 89 f1             	mov    %rsi,%rcx
+  8002cf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002d6:	48 bf 61 02 80 00 00 	movabs $0x800261,%rdi
+  8002dd:	00 00 00 
+  8002e0:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  8002e7:	00 00 00 
+  8002ea:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002ec:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002f3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002fa:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800306:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80030c:	c9                   	leave
+  80030d:	c3                   	ret
+
+000000000080030e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80030e:	55                   	push   %rbp
+  80030f:	48 89 e5             	mov    %rsp,%rbp
+  800312:	48 83 ec 50          	sub    $0x50,%rsp
+  800316:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80031a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80031e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800322:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800326:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80032a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800331:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800335:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800339:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80033d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800341:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800345:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  80034c:	00 00 00 
+  80034f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800351:	c9                   	leave
+  800352:	c3                   	ret
+
+0000000000800353 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800353:	55                   	push   %rbp
+  800354:	48 89 e5             	mov    %rsp,%rbp
+  800357:	41 57                	push   %r15
+  800359:	41 56                	push   %r14
+  80035b:	41 55                	push   %r13
+  80035d:	41 54                	push   %r12
+  80035f:	53                   	push   %rbx
+  800360:	48 83 ec 18          	sub    $0x18,%rsp
+  800364:	49 89 fc             	mov    %rdi,%r12
+  800367:	49 89 f5             	mov    %rsi,%r13
+  80036a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80036e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800371:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800374:	41 89 cf             	mov    %ecx,%r15d
+  800377:	4c 39 fa             	cmp    %r15,%rdx
+  80037a:	73 5b                	jae    8003d7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80037c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800380:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800384:	85 db                	test   %ebx,%ebx
+  800386:	7e 0e                	jle    800396 <print_num+0x43>
+            putch(padc, put_arg);
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	44 89 f7             	mov    %r14d,%edi
+  80038e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800391:	83 eb 01             	sub    $0x1,%ebx
+  800394:	75 f2                	jne    800388 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800396:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80039a:	48 b9 61 39 80 00 00 	movabs $0x803961,%rcx
+  8003a1:	00 00 00 
+  8003a4:	48 b8 50 39 80 00 00 	movabs $0x803950,%rax
+  8003ab:	00 00 00 
+  8003ae:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003bb:	49 f7 f7             	div    %r15
+  8003be:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003c2:	4c 89 ee             	mov    %r13,%rsi
+  8003c5:	41 ff d4             	call   *%r12
+}
+  8003c8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003cc:	5b                   	pop    %rbx
+  8003cd:	41 5c                	pop    %r12
+  8003cf:	41 5d                	pop    %r13
+  8003d1:	41 5e                	pop    %r14
+  8003d3:	41 5f                	pop    %r15
+  8003d5:	5d                   	pop    %rbp
+  8003d6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e0:	49 f7 f7             	div    %r15
+  8003e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003eb:	52                   	push   %rdx
+  8003ec:	45 0f be c9          	movsbl %r9b,%r9d
+  8003f0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003f4:	48 89 c2             	mov    %rax,%rdx
+  8003f7:	48 b8 53 03 80 00 00 	movabs $0x800353,%rax
+  8003fe:	00 00 00 
+  800401:	ff d0                	call   *%rax
+  800403:	48 83 c4 10          	add    $0x10,%rsp
+  800407:	eb 8d                	jmp    800396 <print_num+0x43>
+
+0000000000800409 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800409:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80040d:	48 8b 06             	mov    (%rsi),%rax
+  800410:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800414:	73 0a                	jae    800420 <sprintputch+0x17>
+        *state->start++ = ch;
+  800416:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80041a:	48 89 16             	mov    %rdx,(%rsi)
+  80041d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800420:	c3                   	ret
+
+0000000000800421 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800421:	55                   	push   %rbp
+  800422:	48 89 e5             	mov    %rsp,%rbp
+  800425:	48 83 ec 50          	sub    $0x50,%rsp
+  800429:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800431:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800435:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80043c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800440:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800444:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800448:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80044c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800450:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800457:	00 00 00 
+  80045a:	ff d0                	call   *%rax
+}
+  80045c:	c9                   	leave
+  80045d:	c3                   	ret
+
+000000000080045e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	41 57                	push   %r15
+  800464:	41 56                	push   %r14
+  800466:	41 55                	push   %r13
+  800468:	41 54                	push   %r12
+  80046a:	53                   	push   %rbx
+  80046b:	48 83 ec 38          	sub    $0x38,%rsp
+  80046f:	49 89 fe             	mov    %rdi,%r14
+  800472:	49 89 f5             	mov    %rsi,%r13
+  800475:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800478:	48 8b 01             	mov    (%rcx),%rax
+  80047b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80047f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800483:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800487:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80048b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80048f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800493:	0f b6 3b             	movzbl (%rbx),%edi
+  800496:	40 80 ff 25          	cmp    $0x25,%dil
+  80049a:	74 18                	je     8004b4 <vprintfmt+0x56>
+            if (!ch) return;
+  80049c:	40 84 ff             	test   %dil,%dil
+  80049f:	0f 84 b1 06 00 00    	je     800b56 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004a5:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a9:	4c 89 ee             	mov    %r13,%rsi
+  8004ac:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004af:	4c 89 e3             	mov    %r12,%rbx
+  8004b2:	eb db                	jmp    80048f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004c2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004cf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004dd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004e0:	83 e8 23             	sub    $0x23,%eax
+  8004e3:	3c 57                	cmp    $0x57,%al
+  8004e5:	0f 87 51 06 00 00    	ja     800b3c <vprintfmt+0x6de>
+  8004eb:	0f b6 c0             	movzbl %al,%eax
+  8004ee:	48 b9 00 3b 80 00 00 	movabs $0x803b00,%rcx
+  8004f5:	00 00 00 
+  8004f8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004fb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004fe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800502:	eb cf                	jmp    8004d3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800504:	49 89 dc             	mov    %rbx,%r12
+  800507:	be 01 00 00 00       	mov    $0x1,%esi
+  80050c:	eb c5                	jmp    8004d3 <vprintfmt+0x75>
+            padc = ch;
+  80050e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800512:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800515:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800518:	eb b9                	jmp    8004d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80051a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051d:	83 f8 2f             	cmp    $0x2f,%eax
+  800520:	77 24                	ja     800546 <vprintfmt+0xe8>
+  800522:	89 c1                	mov    %eax,%ecx
+  800524:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800528:	83 c0 08             	add    $0x8,%eax
+  80052b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800531:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800534:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800538:	79 99                	jns    8004d3 <vprintfmt+0x75>
+                width = precision;
+  80053a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80053e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800544:	eb 8d                	jmp    8004d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800546:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80054a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80054e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800552:	eb da                	jmp    80052e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800554:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800559:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80055d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800563:	3c 39                	cmp    $0x39,%al
+  800565:	77 1c                	ja     800583 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800567:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80056b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80056f:	0f b6 c0             	movzbl %al,%eax
+  800572:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800577:	0f b6 03             	movzbl (%rbx),%eax
+  80057a:	3c 39                	cmp    $0x39,%al
+  80057c:	76 e9                	jbe    800567 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80057e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800581:	eb b1                	jmp    800534 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800583:	49 89 dc             	mov    %rbx,%r12
+  800586:	eb ac                	jmp    800534 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800588:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800592:	0f 49 c1             	cmovns %ecx,%eax
+  800595:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800598:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80059b:	e9 33 ff ff ff       	jmp    8004d3 <vprintfmt+0x75>
+            lflag++;
+  8005a0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a6:	e9 28 ff ff ff       	jmp    8004d3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b1:	77 19                	ja     8005cc <vprintfmt+0x16e>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b9:	83 c0 08             	add    $0x8,%eax
+  8005bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005bf:	8b 3a                	mov    (%rdx),%edi
+  8005c1:	4c 89 ee             	mov    %r13,%rsi
+  8005c4:	41 ff d6             	call   *%r14
+            break;
+  8005c7:	e9 c3 fe ff ff       	jmp    80048f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d8:	eb e5                	jmp    8005bf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e0:	77 5a                	ja     80063c <vprintfmt+0x1de>
+  8005e2:	89 c2                	mov    %eax,%edx
+  8005e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e8:	83 c0 08             	add    $0x8,%eax
+  8005eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005ee:	8b 02                	mov    (%rdx),%eax
+  8005f0:	89 c1                	mov    %eax,%ecx
+  8005f2:	f7 d9                	neg    %ecx
+  8005f4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f7:	83 f9 14             	cmp    $0x14,%ecx
+  8005fa:	7f 4e                	jg     80064a <vprintfmt+0x1ec>
+  8005fc:	48 63 c1             	movslq %ecx,%rax
+  8005ff:	48 ba c0 3d 80 00 00 	movabs $0x803dc0,%rdx
+  800606:	00 00 00 
+  800609:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80060d:	48 85 c0             	test   %rax,%rax
+  800610:	74 38                	je     80064a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800612:	48 89 c1             	mov    %rax,%rcx
+  800615:	48 ba d9 3f 80 00 00 	movabs $0x803fd9,%rdx
+  80061c:	00 00 00 
+  80061f:	4c 89 ee             	mov    %r13,%rsi
+  800622:	4c 89 f7             	mov    %r14,%rdi
+  800625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062a:	49 b8 21 04 80 00 00 	movabs $0x800421,%r8
+  800631:	00 00 00 
+  800634:	41 ff d0             	call   *%r8
+  800637:	e9 53 fe ff ff       	jmp    80048f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80063c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800640:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800644:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800648:	eb a4                	jmp    8005ee <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80064a:	48 ba 79 39 80 00 00 	movabs $0x803979,%rdx
+  800651:	00 00 00 
+  800654:	4c 89 ee             	mov    %r13,%rsi
+  800657:	4c 89 f7             	mov    %r14,%rdi
+  80065a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065f:	49 b8 21 04 80 00 00 	movabs $0x800421,%r8
+  800666:	00 00 00 
+  800669:	41 ff d0             	call   *%r8
+  80066c:	e9 1e fe ff ff       	jmp    80048f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800671:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800674:	83 f8 2f             	cmp    $0x2f,%eax
+  800677:	77 6c                	ja     8006e5 <vprintfmt+0x287>
+  800679:	89 c2                	mov    %eax,%edx
+  80067b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067f:	83 c0 08             	add    $0x8,%eax
+  800682:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800685:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800688:	48 85 d2             	test   %rdx,%rdx
+  80068b:	48 b8 72 39 80 00 00 	movabs $0x803972,%rax
+  800692:	00 00 00 
+  800695:	48 0f 45 c2          	cmovne %rdx,%rax
+  800699:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80069d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a1:	7e 06                	jle    8006a9 <vprintfmt+0x24b>
+  8006a3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a7:	75 4a                	jne    8006f3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006ad:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006b1:	0f b6 00             	movzbl (%rax),%eax
+  8006b4:	84 c0                	test   %al,%al
+  8006b6:	0f 85 9a 00 00 00    	jne    800756 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006bc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006bf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006c3:	85 c0                	test   %eax,%eax
+  8006c5:	0f 8e c4 fd ff ff    	jle    80048f <vprintfmt+0x31>
+  8006cb:	4c 89 ee             	mov    %r13,%rsi
+  8006ce:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d3:	41 ff d6             	call   *%r14
+  8006d6:	41 83 ec 01          	sub    $0x1,%r12d
+  8006da:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006de:	75 eb                	jne    8006cb <vprintfmt+0x26d>
+  8006e0:	e9 aa fd ff ff       	jmp    80048f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f1:	eb 92                	jmp    800685 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006f3:	49 63 f7             	movslq %r15d,%rsi
+  8006f6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006fa:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  800701:	00 00 00 
+  800704:	ff d0                	call   *%rax
+  800706:	48 89 c2             	mov    %rax,%rdx
+  800709:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80070c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80070e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800711:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800714:	85 c0                	test   %eax,%eax
+  800716:	7e 91                	jle    8006a9 <vprintfmt+0x24b>
+  800718:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80071d:	4c 89 ee             	mov    %r13,%rsi
+  800720:	44 89 e7             	mov    %r12d,%edi
+  800723:	41 ff d6             	call   *%r14
+  800726:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80072a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800730:	75 eb                	jne    80071d <vprintfmt+0x2bf>
+  800732:	e9 72 ff ff ff       	jmp    8006a9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800737:	0f b6 f8             	movzbl %al,%edi
+  80073a:	4c 89 ee             	mov    %r13,%rsi
+  80073d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800740:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800744:	49 83 c4 01          	add    $0x1,%r12
+  800748:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80074e:	84 c0                	test   %al,%al
+  800750:	0f 84 66 ff ff ff    	je     8006bc <vprintfmt+0x25e>
+  800756:	45 85 ff             	test   %r15d,%r15d
+  800759:	78 0a                	js     800765 <vprintfmt+0x307>
+  80075b:	41 83 ef 01          	sub    $0x1,%r15d
+  80075f:	0f 88 57 ff ff ff    	js     8006bc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800765:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800769:	74 cc                	je     800737 <vprintfmt+0x2d9>
+  80076b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80076e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800773:	80 fa 5e             	cmp    $0x5e,%dl
+  800776:	77 c2                	ja     80073a <vprintfmt+0x2dc>
+  800778:	eb bd                	jmp    800737 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80077a:	40 84 f6             	test   %sil,%sil
+  80077d:	75 26                	jne    8007a5 <vprintfmt+0x347>
+    switch (lflag) {
+  80077f:	85 d2                	test   %edx,%edx
+  800781:	74 59                	je     8007dc <vprintfmt+0x37e>
+  800783:	83 fa 01             	cmp    $0x1,%edx
+  800786:	74 7b                	je     800803 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078b:	83 f8 2f             	cmp    $0x2f,%eax
+  80078e:	0f 87 96 00 00 00    	ja     80082a <vprintfmt+0x3cc>
+  800794:	89 c2                	mov    %eax,%edx
+  800796:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079a:	83 c0 08             	add    $0x8,%eax
+  80079d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a0:	4c 8b 22             	mov    (%rdx),%r12
+  8007a3:	eb 17                	jmp    8007bc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ab:	77 21                	ja     8007ce <vprintfmt+0x370>
+  8007ad:	89 c2                	mov    %eax,%edx
+  8007af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b3:	83 c0 08             	add    $0x8,%eax
+  8007b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007bc:	4d 85 e4             	test   %r12,%r12
+  8007bf:	78 7a                	js     80083b <vprintfmt+0x3dd>
+            num = i;
+  8007c1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007c9:	e9 50 02 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	eb dd                	jmp    8007b9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	77 11                	ja     8007f5 <vprintfmt+0x397>
+  8007e4:	89 c2                	mov    %eax,%edx
+  8007e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ea:	83 c0 08             	add    $0x8,%eax
+  8007ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f0:	4c 63 22             	movslq (%rdx),%r12
+  8007f3:	eb c7                	jmp    8007bc <vprintfmt+0x35e>
+  8007f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800801:	eb ed                	jmp    8007f0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800803:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800806:	83 f8 2f             	cmp    $0x2f,%eax
+  800809:	77 11                	ja     80081c <vprintfmt+0x3be>
+  80080b:	89 c2                	mov    %eax,%edx
+  80080d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800811:	83 c0 08             	add    $0x8,%eax
+  800814:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800817:	4c 8b 22             	mov    (%rdx),%r12
+  80081a:	eb a0                	jmp    8007bc <vprintfmt+0x35e>
+  80081c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800820:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800824:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800828:	eb ed                	jmp    800817 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80082a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800832:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800836:	e9 65 ff ff ff       	jmp    8007a0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80083b:	4c 89 ee             	mov    %r13,%rsi
+  80083e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800843:	41 ff d6             	call   *%r14
+                i = -i;
+  800846:	49 f7 dc             	neg    %r12
+  800849:	e9 73 ff ff ff       	jmp    8007c1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80084e:	40 84 f6             	test   %sil,%sil
+  800851:	75 32                	jne    800885 <vprintfmt+0x427>
+    switch (lflag) {
+  800853:	85 d2                	test   %edx,%edx
+  800855:	74 5d                	je     8008b4 <vprintfmt+0x456>
+  800857:	83 fa 01             	cmp    $0x1,%edx
+  80085a:	0f 84 82 00 00 00    	je     8008e2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800860:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800863:	83 f8 2f             	cmp    $0x2f,%eax
+  800866:	0f 87 a5 00 00 00    	ja     800911 <vprintfmt+0x4b3>
+  80086c:	89 c2                	mov    %eax,%edx
+  80086e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800872:	83 c0 08             	add    $0x8,%eax
+  800875:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800878:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80087b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800880:	e9 99 01 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	77 19                	ja     8008a6 <vprintfmt+0x448>
+  80088d:	89 c2                	mov    %eax,%edx
+  80088f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800893:	83 c0 08             	add    $0x8,%eax
+  800896:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800899:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008a1:	e9 78 01 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+  8008a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b2:	eb e5                	jmp    800899 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	77 18                	ja     8008d4 <vprintfmt+0x476>
+  8008bc:	89 c2                	mov    %eax,%edx
+  8008be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c2:	83 c0 08             	add    $0x8,%eax
+  8008c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008cf:	e9 4a 01 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	eb e6                	jmp    8008c8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 19                	ja     800903 <vprintfmt+0x4a5>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008fe:	e9 1b 01 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+  800903:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800907:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090f:	eb e5                	jmp    8008f6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	e9 56 ff ff ff       	jmp    800878 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800922:	40 84 f6             	test   %sil,%sil
+  800925:	75 2e                	jne    800955 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800927:	85 d2                	test   %edx,%edx
+  800929:	74 59                	je     800984 <vprintfmt+0x526>
+  80092b:	83 fa 01             	cmp    $0x1,%edx
+  80092e:	74 7f                	je     8009af <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800930:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800933:	83 f8 2f             	cmp    $0x2f,%eax
+  800936:	0f 87 9f 00 00 00    	ja     8009db <vprintfmt+0x57d>
+  80093c:	89 c2                	mov    %eax,%edx
+  80093e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800942:	83 c0 08             	add    $0x8,%eax
+  800945:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800948:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80094b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800950:	e9 c9 00 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 19                	ja     800976 <vprintfmt+0x518>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80096c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800971:	e9 a8 00 00 00       	jmp    800a1e <vprintfmt+0x5c0>
+  800976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800982:	eb e5                	jmp    800969 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800987:	83 f8 2f             	cmp    $0x2f,%eax
+  80098a:	77 15                	ja     8009a1 <vprintfmt+0x543>
+  80098c:	89 c2                	mov    %eax,%edx
+  80098e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800992:	83 c0 08             	add    $0x8,%eax
+  800995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800998:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80099a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80099f:	eb 7d                	jmp    800a1e <vprintfmt+0x5c0>
+  8009a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ad:	eb e9                	jmp    800998 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	77 16                	ja     8009cd <vprintfmt+0x56f>
+  8009b7:	89 c2                	mov    %eax,%edx
+  8009b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bd:	83 c0 08             	add    $0x8,%eax
+  8009c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009cb:	eb 51                	jmp    800a1e <vprintfmt+0x5c0>
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	eb e8                	jmp    8009c3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e7:	e9 5c ff ff ff       	jmp    800948 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009ec:	4c 89 ee             	mov    %r13,%rsi
+  8009ef:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009f4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009ff:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 47                	ja     800a51 <vprintfmt+0x5f3>
+  800a0a:	89 c2                	mov    %eax,%edx
+  800a0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a10:	83 c0 08             	add    $0x8,%eax
+  800a13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a19:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a22:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a26:	0f 94 c0             	sete   %al
+  800a29:	0f b6 c0             	movzbl %al,%eax
+  800a2c:	50                   	push   %rax
+  800a2d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a32:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a36:	4c 89 ee             	mov    %r13,%rsi
+  800a39:	4c 89 f7             	mov    %r14,%rdi
+  800a3c:	48 b8 53 03 80 00 00 	movabs $0x800353,%rax
+  800a43:	00 00 00 
+  800a46:	ff d0                	call   *%rax
+            break;
+  800a48:	48 83 c4 10          	add    $0x10,%rsp
+  800a4c:	e9 3e fa ff ff       	jmp    80048f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb b7                	jmp    800a16 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5f:	40 84 f6             	test   %sil,%sil
+  800a62:	75 2b                	jne    800a8f <vprintfmt+0x631>
+    switch (lflag) {
+  800a64:	85 d2                	test   %edx,%edx
+  800a66:	74 56                	je     800abe <vprintfmt+0x660>
+  800a68:	83 fa 01             	cmp    $0x1,%edx
+  800a6b:	74 7f                	je     800aec <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	0f 87 a2 00 00 00    	ja     800b1b <vprintfmt+0x6bd>
+  800a79:	89 c2                	mov    %eax,%edx
+  800a7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7f:	83 c0 08             	add    $0x8,%eax
+  800a82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8d:	eb 8f                	jmp    800a1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a92:	83 f8 2f             	cmp    $0x2f,%eax
+  800a95:	77 19                	ja     800ab0 <vprintfmt+0x652>
+  800a97:	89 c2                	mov    %eax,%edx
+  800a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9d:	83 c0 08             	add    $0x8,%eax
+  800aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aab:	e9 6e ff ff ff       	jmp    800a1e <vprintfmt+0x5c0>
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	eb e5                	jmp    800aa3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	77 18                	ja     800ade <vprintfmt+0x680>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ad4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad9:	e9 40 ff ff ff       	jmp    800a1e <vprintfmt+0x5c0>
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb e6                	jmp    800ad2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 19                	ja     800b0d <vprintfmt+0x6af>
+  800af4:	89 c2                	mov    %eax,%edx
+  800af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afa:	83 c0 08             	add    $0x8,%eax
+  800afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b00:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b03:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b08:	e9 11 ff ff ff       	jmp    800a1e <vprintfmt+0x5c0>
+  800b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b19:	eb e5                	jmp    800b00 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	e9 59 ff ff ff       	jmp    800a85 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b2c:	4c 89 ee             	mov    %r13,%rsi
+  800b2f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b34:	41 ff d6             	call   *%r14
+            break;
+  800b37:	e9 53 f9 ff ff       	jmp    80048f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b3c:	4c 89 ee             	mov    %r13,%rsi
+  800b3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b44:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b47:	48 83 eb 01          	sub    $0x1,%rbx
+  800b4b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b4f:	75 f6                	jne    800b47 <vprintfmt+0x6e9>
+  800b51:	e9 39 f9 ff ff       	jmp    80048f <vprintfmt+0x31>
+}
+  800b56:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b5a:	5b                   	pop    %rbx
+  800b5b:	41 5c                	pop    %r12
+  800b5d:	41 5d                	pop    %r13
+  800b5f:	41 5e                	pop    %r14
+  800b61:	41 5f                	pop    %r15
+  800b63:	5d                   	pop    %rbp
+  800b64:	c3                   	ret
+
+0000000000800b65 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b65:	55                   	push   %rbp
+  800b66:	48 89 e5             	mov    %rsp,%rbp
+  800b69:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b71:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b7a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b81:	48 85 ff             	test   %rdi,%rdi
+  800b84:	74 2b                	je     800bb1 <vsnprintf+0x4c>
+  800b86:	48 85 f6             	test   %rsi,%rsi
+  800b89:	74 26                	je     800bb1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b8b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b8f:	48 bf 09 04 80 00 00 	movabs $0x800409,%rdi
+  800b96:	00 00 00 
+  800b99:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800ba0:	00 00 00 
+  800ba3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ba5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800baf:	c9                   	leave
+  800bb0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb6:	eb f7                	jmp    800baf <vsnprintf+0x4a>
+
+0000000000800bb8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bb8:	55                   	push   %rbp
+  800bb9:	48 89 e5             	mov    %rsp,%rbp
+  800bbc:	48 83 ec 50          	sub    $0x50,%rsp
+  800bc0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bc4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bc8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bcc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bd3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bdf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800be3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be7:	48 b8 65 0b 80 00 00 	movabs $0x800b65,%rax
+  800bee:	00 00 00 
+  800bf1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bf3:	c9                   	leave
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bf5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bf8:	74 10                	je     800c0a <strlen+0x15>
+    size_t n = 0;
+  800bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bff:	48 83 c0 01          	add    $0x1,%rax
+  800c03:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c07:	75 f6                	jne    800bff <strlen+0xa>
+  800c09:	c3                   	ret
+    size_t n = 0;
+  800c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c0f:	c3                   	ret
+
+0000000000800c10 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c10:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c18:	48 85 f6             	test   %rsi,%rsi
+  800c1b:	74 11                	je     800c2e <strnlen+0x1e>
+  800c1d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c21:	74 0c                	je     800c2f <strnlen+0x1f>
+  800c23:	48 83 c2 01          	add    $0x1,%rdx
+  800c27:	48 39 d0             	cmp    %rdx,%rax
+  800c2a:	75 f1                	jne    800c1d <strnlen+0xd>
+  800c2c:	eb 04                	jmp    800c32 <strnlen+0x22>
+  800c2e:	c3                   	ret
+  800c2f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c32:	c3                   	ret
+
+0000000000800c33 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c33:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c3f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c42:	48 83 c2 01          	add    $0x1,%rdx
+  800c46:	84 c9                	test   %cl,%cl
+  800c48:	75 f1                	jne    800c3b <strcpy+0x8>
+        ;
+    return res;
+}
+  800c4a:	c3                   	ret
+
+0000000000800c4b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c4b:	55                   	push   %rbp
+  800c4c:	48 89 e5             	mov    %rsp,%rbp
+  800c4f:	41 54                	push   %r12
+  800c51:	53                   	push   %rbx
+  800c52:	48 89 fb             	mov    %rdi,%rbx
+  800c55:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c58:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800c5f:	00 00 00 
+  800c62:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c64:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c68:	4c 89 e6             	mov    %r12,%rsi
+  800c6b:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  800c72:	00 00 00 
+  800c75:	ff d0                	call   *%rax
+    return dst;
+}
+  800c77:	48 89 d8             	mov    %rbx,%rax
+  800c7a:	5b                   	pop    %rbx
+  800c7b:	41 5c                	pop    %r12
+  800c7d:	5d                   	pop    %rbp
+  800c7e:	c3                   	ret
+
+0000000000800c7f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c7f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c82:	48 85 d2             	test   %rdx,%rdx
+  800c85:	74 1f                	je     800ca6 <strncpy+0x27>
+  800c87:	48 01 fa             	add    %rdi,%rdx
+  800c8a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c8d:	48 83 c1 01          	add    $0x1,%rcx
+  800c91:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c95:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c99:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c9d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ca1:	48 39 ca             	cmp    %rcx,%rdx
+  800ca4:	75 e7                	jne    800c8d <strncpy+0xe>
+    }
+    return ret;
+}
+  800ca6:	c3                   	ret
+
+0000000000800ca7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ca7:	48 89 f8             	mov    %rdi,%rax
+  800caa:	48 85 d2             	test   %rdx,%rdx
+  800cad:	74 24                	je     800cd3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800caf:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb3:	74 1b                	je     800cd0 <strlcpy+0x29>
+  800cb5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cb9:	0f b6 16             	movzbl (%rsi),%edx
+  800cbc:	84 d2                	test   %dl,%dl
+  800cbe:	74 10                	je     800cd0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cc0:	48 83 c6 01          	add    $0x1,%rsi
+  800cc4:	48 83 c0 01          	add    $0x1,%rax
+  800cc8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ccb:	48 39 c8             	cmp    %rcx,%rax
+  800cce:	75 e9                	jne    800cb9 <strlcpy+0x12>
+        *dst = '\0';
+  800cd0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cd3:	48 29 f8             	sub    %rdi,%rax
+}
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cd7:	0f b6 07             	movzbl (%rdi),%eax
+  800cda:	84 c0                	test   %al,%al
+  800cdc:	74 13                	je     800cf1 <strcmp+0x1a>
+  800cde:	38 06                	cmp    %al,(%rsi)
+  800ce0:	75 0f                	jne    800cf1 <strcmp+0x1a>
+  800ce2:	48 83 c7 01          	add    $0x1,%rdi
+  800ce6:	48 83 c6 01          	add    $0x1,%rsi
+  800cea:	0f b6 07             	movzbl (%rdi),%eax
+  800ced:	84 c0                	test   %al,%al
+  800cef:	75 ed                	jne    800cde <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cf1:	0f b6 c0             	movzbl %al,%eax
+  800cf4:	0f b6 16             	movzbl (%rsi),%edx
+  800cf7:	29 d0                	sub    %edx,%eax
+}
+  800cf9:	c3                   	ret
+
+0000000000800cfa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cfa:	48 85 d2             	test   %rdx,%rdx
+  800cfd:	74 1f                	je     800d1e <strncmp+0x24>
+  800cff:	0f b6 07             	movzbl (%rdi),%eax
+  800d02:	84 c0                	test   %al,%al
+  800d04:	74 1e                	je     800d24 <strncmp+0x2a>
+  800d06:	3a 06                	cmp    (%rsi),%al
+  800d08:	75 1a                	jne    800d24 <strncmp+0x2a>
+  800d0a:	48 83 c7 01          	add    $0x1,%rdi
+  800d0e:	48 83 c6 01          	add    $0x1,%rsi
+  800d12:	48 83 ea 01          	sub    $0x1,%rdx
+  800d16:	75 e7                	jne    800cff <strncmp+0x5>
+
+    if (!n) return 0;
+  800d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1d:	c3                   	ret
+  800d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d23:	c3                   	ret
+  800d24:	48 85 d2             	test   %rdx,%rdx
+  800d27:	74 09                	je     800d32 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d29:	0f b6 07             	movzbl (%rdi),%eax
+  800d2c:	0f b6 16             	movzbl (%rsi),%edx
+  800d2f:	29 d0                	sub    %edx,%eax
+  800d31:	c3                   	ret
+    if (!n) return 0;
+  800d32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d37:	c3                   	ret
+
+0000000000800d38 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d38:	0f b6 17             	movzbl (%rdi),%edx
+  800d3b:	84 d2                	test   %dl,%dl
+  800d3d:	74 18                	je     800d57 <strchr+0x1f>
+        if (*str == c) {
+  800d3f:	0f be d2             	movsbl %dl,%edx
+  800d42:	39 f2                	cmp    %esi,%edx
+  800d44:	74 17                	je     800d5d <strchr+0x25>
+    for (; *str; str++) {
+  800d46:	48 83 c7 01          	add    $0x1,%rdi
+  800d4a:	0f b6 17             	movzbl (%rdi),%edx
+  800d4d:	84 d2                	test   %dl,%dl
+  800d4f:	75 ee                	jne    800d3f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d56:	c3                   	ret
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5c:	c3                   	ret
+  800d5d:	48 89 f8             	mov    %rdi,%rax
+}
+  800d60:	c3                   	ret
+
+0000000000800d61 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d61:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d64:	0f b6 17             	movzbl (%rdi),%edx
+  800d67:	84 d2                	test   %dl,%dl
+  800d69:	74 13                	je     800d7e <strfind+0x1d>
+  800d6b:	0f be d2             	movsbl %dl,%edx
+  800d6e:	39 f2                	cmp    %esi,%edx
+  800d70:	74 0b                	je     800d7d <strfind+0x1c>
+  800d72:	48 83 c0 01          	add    $0x1,%rax
+  800d76:	0f b6 10             	movzbl (%rax),%edx
+  800d79:	84 d2                	test   %dl,%dl
+  800d7b:	75 ee                	jne    800d6b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d7d:	c3                   	ret
+  800d7e:	c3                   	ret
+
+0000000000800d7f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d7f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d82:	48 89 f8             	mov    %rdi,%rax
+  800d85:	48 f7 d8             	neg    %rax
+  800d88:	83 e0 07             	and    $0x7,%eax
+  800d8b:	49 89 d1             	mov    %rdx,%r9
+  800d8e:	49 29 c1             	sub    %rax,%r9
+  800d91:	78 36                	js     800dc9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d93:	40 0f b6 c6          	movzbl %sil,%eax
+  800d97:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d9e:	01 01 01 
+  800da1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800da5:	40 f6 c7 07          	test   $0x7,%dil
+  800da9:	75 38                	jne    800de3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dab:	4c 89 c9             	mov    %r9,%rcx
+  800dae:	48 c1 f9 03          	sar    $0x3,%rcx
+  800db2:	74 0c                	je     800dc0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800db4:	fc                   	cld
+  800db5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800db8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dbc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dc0:	4d 85 c9             	test   %r9,%r9
+  800dc3:	75 45                	jne    800e0a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dc5:	4c 89 c0             	mov    %r8,%rax
+  800dc8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dc9:	48 85 d2             	test   %rdx,%rdx
+  800dcc:	74 f7                	je     800dc5 <memset+0x46>
+  800dce:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dd1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dd4:	48 83 c0 01          	add    $0x1,%rax
+  800dd8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ddc:	48 39 c2             	cmp    %rax,%rdx
+  800ddf:	75 f3                	jne    800dd4 <memset+0x55>
+  800de1:	eb e2                	jmp    800dc5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800de3:	40 f6 c7 01          	test   $0x1,%dil
+  800de7:	74 06                	je     800def <memset+0x70>
+  800de9:	88 07                	mov    %al,(%rdi)
+  800deb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800def:	40 f6 c7 02          	test   $0x2,%dil
+  800df3:	74 07                	je     800dfc <memset+0x7d>
+  800df5:	66 89 07             	mov    %ax,(%rdi)
+  800df8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dfc:	40 f6 c7 04          	test   $0x4,%dil
+  800e00:	74 a9                	je     800dab <memset+0x2c>
+  800e02:	89 07                	mov    %eax,(%rdi)
+  800e04:	48 83 c7 04          	add    $0x4,%rdi
+  800e08:	eb a1                	jmp    800dab <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e0a:	41 f6 c1 04          	test   $0x4,%r9b
+  800e0e:	74 06                	je     800e16 <memset+0x97>
+  800e10:	89 07                	mov    %eax,(%rdi)
+  800e12:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e16:	41 f6 c1 02          	test   $0x2,%r9b
+  800e1a:	74 07                	je     800e23 <memset+0xa4>
+  800e1c:	66 89 07             	mov    %ax,(%rdi)
+  800e1f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e23:	41 f6 c1 01          	test   $0x1,%r9b
+  800e27:	74 9c                	je     800dc5 <memset+0x46>
+  800e29:	88 07                	mov    %al,(%rdi)
+  800e2b:	eb 98                	jmp    800dc5 <memset+0x46>
+
+0000000000800e2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e2d:	48 89 f8             	mov    %rdi,%rax
+  800e30:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e33:	48 39 fe             	cmp    %rdi,%rsi
+  800e36:	73 3b                	jae    800e73 <memmove+0x46>
+  800e38:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e3c:	48 39 d7             	cmp    %rdx,%rdi
+  800e3f:	73 32                	jae    800e73 <memmove+0x46>
+        s += n;
+        d += n;
+  800e41:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e45:	48 89 d6             	mov    %rdx,%rsi
+  800e48:	48 09 fe             	or     %rdi,%rsi
+  800e4b:	48 09 ce             	or     %rcx,%rsi
+  800e4e:	40 f6 c6 07          	test   $0x7,%sil
+  800e52:	75 12                	jne    800e66 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e54:	48 83 ef 08          	sub    $0x8,%rdi
+  800e58:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e5c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e60:	fd                   	std
+  800e61:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e64:	fc                   	cld
+  800e65:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e66:	48 83 ef 01          	sub    $0x1,%rdi
+  800e6a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e6e:	fd                   	std
+  800e6f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e71:	eb f1                	jmp    800e64 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e73:	48 89 f2             	mov    %rsi,%rdx
+  800e76:	48 09 c2             	or     %rax,%rdx
+  800e79:	48 09 ca             	or     %rcx,%rdx
+  800e7c:	f6 c2 07             	test   $0x7,%dl
+  800e7f:	75 0c                	jne    800e8d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e81:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e85:	48 89 c7             	mov    %rax,%rdi
+  800e88:	fc                   	cld
+  800e89:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e8c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e8d:	48 89 c7             	mov    %rax,%rdi
+  800e90:	fc                   	cld
+  800e91:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e93:	c3                   	ret
+
+0000000000800e94 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e98:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+}
+  800ea4:	5d                   	pop    %rbp
+  800ea5:	c3                   	ret
+
+0000000000800ea6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ea6:	55                   	push   %rbp
+  800ea7:	48 89 e5             	mov    %rsp,%rbp
+  800eaa:	41 57                	push   %r15
+  800eac:	41 56                	push   %r14
+  800eae:	41 55                	push   %r13
+  800eb0:	41 54                	push   %r12
+  800eb2:	53                   	push   %rbx
+  800eb3:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb7:	49 89 fe             	mov    %rdi,%r14
+  800eba:	49 89 f7             	mov    %rsi,%r15
+  800ebd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ec0:	48 89 f7             	mov    %rsi,%rdi
+  800ec3:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800eca:	00 00 00 
+  800ecd:	ff d0                	call   *%rax
+  800ecf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ed2:	48 89 de             	mov    %rbx,%rsi
+  800ed5:	4c 89 f7             	mov    %r14,%rdi
+  800ed8:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  800edf:	00 00 00 
+  800ee2:	ff d0                	call   *%rax
+  800ee4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee7:	48 39 c3             	cmp    %rax,%rbx
+  800eea:	74 36                	je     800f22 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800eec:	48 89 d8             	mov    %rbx,%rax
+  800eef:	4c 29 e8             	sub    %r13,%rax
+  800ef2:	49 39 c4             	cmp    %rax,%r12
+  800ef5:	73 31                	jae    800f28 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ef7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800efc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f00:	4c 89 fe             	mov    %r15,%rsi
+  800f03:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f0f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f13:	48 83 c4 08          	add    $0x8,%rsp
+  800f17:	5b                   	pop    %rbx
+  800f18:	41 5c                	pop    %r12
+  800f1a:	41 5d                	pop    %r13
+  800f1c:	41 5e                	pop    %r14
+  800f1e:	41 5f                	pop    %r15
+  800f20:	5d                   	pop    %rbp
+  800f21:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f22:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f26:	eb eb                	jmp    800f13 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f28:	48 83 eb 01          	sub    $0x1,%rbx
+  800f2c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f30:	48 89 da             	mov    %rbx,%rdx
+  800f33:	4c 89 fe             	mov    %r15,%rsi
+  800f36:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  800f3d:	00 00 00 
+  800f40:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f42:	49 01 de             	add    %rbx,%r14
+  800f45:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f4a:	eb c3                	jmp    800f0f <strlcat+0x69>
+
+0000000000800f4c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f4c:	48 85 d2             	test   %rdx,%rdx
+  800f4f:	74 2d                	je     800f7e <memcmp+0x32>
+  800f51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f56:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f5a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f5f:	44 38 c1             	cmp    %r8b,%cl
+  800f62:	75 0f                	jne    800f73 <memcmp+0x27>
+    while (n-- > 0) {
+  800f64:	48 83 c0 01          	add    $0x1,%rax
+  800f68:	48 39 c2             	cmp    %rax,%rdx
+  800f6b:	75 e9                	jne    800f56 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f72:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f73:	0f b6 c1             	movzbl %cl,%eax
+  800f76:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f7a:	44 29 c0             	sub    %r8d,%eax
+  800f7d:	c3                   	ret
+    return 0;
+  800f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f83:	c3                   	ret
+
+0000000000800f84 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f84:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f88:	48 39 c7             	cmp    %rax,%rdi
+  800f8b:	73 0f                	jae    800f9c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f8d:	40 38 37             	cmp    %sil,(%rdi)
+  800f90:	74 0e                	je     800fa0 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f92:	48 83 c7 01          	add    $0x1,%rdi
+  800f96:	48 39 f8             	cmp    %rdi,%rax
+  800f99:	75 f2                	jne    800f8d <memfind+0x9>
+  800f9b:	c3                   	ret
+  800f9c:	48 89 f8             	mov    %rdi,%rax
+  800f9f:	c3                   	ret
+  800fa0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fa4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fa7:	0f b6 37             	movzbl (%rdi),%esi
+  800faa:	40 80 fe 20          	cmp    $0x20,%sil
+  800fae:	74 06                	je     800fb6 <strtol+0x12>
+  800fb0:	40 80 fe 09          	cmp    $0x9,%sil
+  800fb4:	75 13                	jne    800fc9 <strtol+0x25>
+  800fb6:	48 83 c7 01          	add    $0x1,%rdi
+  800fba:	0f b6 37             	movzbl (%rdi),%esi
+  800fbd:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc1:	74 f3                	je     800fb6 <strtol+0x12>
+  800fc3:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc7:	74 ed                	je     800fb6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fc9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fcc:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fcf:	3c 01                	cmp    $0x1,%al
+  800fd1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fdb:	75 0f                	jne    800fec <strtol+0x48>
+  800fdd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fe0:	74 14                	je     800ff6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fe2:	85 d2                	test   %edx,%edx
+  800fe4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ff1:	4c 63 ca             	movslq %edx,%r9
+  800ff4:	eb 36                	jmp    80102c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ffa:	74 0f                	je     80100b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ffc:	85 d2                	test   %edx,%edx
+  800ffe:	75 ec                	jne    800fec <strtol+0x48>
+        s++;
+  801000:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801004:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801009:	eb e1                	jmp    800fec <strtol+0x48>
+        s += 2;
+  80100b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80100f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801014:	eb d6                	jmp    800fec <strtol+0x48>
+            dig -= '0';
+  801016:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801019:	44 0f b6 c1          	movzbl %cl,%r8d
+  80101d:	41 39 d0             	cmp    %edx,%r8d
+  801020:	7d 21                	jge    801043 <strtol+0x9f>
+        val = val * base + dig;
+  801022:	49 0f af c1          	imul   %r9,%rax
+  801026:	0f b6 c9             	movzbl %cl,%ecx
+  801029:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80102c:	48 83 c7 01          	add    $0x1,%rdi
+  801030:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801034:	80 f9 39             	cmp    $0x39,%cl
+  801037:	76 dd                	jbe    801016 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801039:	80 f9 7b             	cmp    $0x7b,%cl
+  80103c:	77 05                	ja     801043 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80103e:	83 e9 57             	sub    $0x57,%ecx
+  801041:	eb d6                	jmp    801019 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801043:	4d 85 d2             	test   %r10,%r10
+  801046:	74 03                	je     80104b <strtol+0xa7>
+  801048:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80104b:	48 89 c2             	mov    %rax,%rdx
+  80104e:	48 f7 da             	neg    %rdx
+  801051:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801055:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801059:	c3                   	ret
+
+000000000080105a <strrev>:
+
+void
+strrev(char *str)
+{
+  80105a:	55                   	push   %rbp
+  80105b:	48 89 e5             	mov    %rsp,%rbp
+  80105e:	53                   	push   %rbx
+  80105f:	48 83 ec 08          	sub    $0x8,%rsp
+  801063:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801066:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  80106d:	00 00 00 
+  801070:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801072:	83 e8 01             	sub    $0x1,%eax
+  801075:	85 c0                	test   %eax,%eax
+  801077:	7e 22                	jle    80109b <strrev+0x41>
+  801079:	48 98                	cltq
+  80107b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801080:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801084:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801088:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80108c:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80108f:	48 83 c2 01          	add    $0x1,%rdx
+  801093:	48 83 e8 01          	sub    $0x1,%rax
+  801097:	39 c2                	cmp    %eax,%edx
+  801099:	7c e5                	jl     801080 <strrev+0x26>
+	}
+}
+  80109b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109f:	c9                   	leave
+  8010a0:	c3                   	ret
+
+00000000008010a1 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8010a1:	85 d2                	test   %edx,%edx
+  8010a3:	0f 84 80 00 00 00    	je     801129 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8010a9:	55                   	push   %rbp
+  8010aa:	48 89 e5             	mov    %rsp,%rbp
+  8010ad:	53                   	push   %rbx
+  8010ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b2:	49 89 f2             	mov    %rsi,%r10
+  8010b5:	41 89 d3             	mov    %edx,%r11d
+  8010b8:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8010bb:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8010c0:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8010c3:	eb 20                	jmp    8010e5 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8010c5:	41 89 f1             	mov    %esi,%r9d
+  8010c8:	83 c2 30             	add    $0x30,%edx
+  8010cb:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8010ce:	89 f8                	mov    %edi,%eax
+  8010d0:	99                   	cltd
+  8010d1:	f7 f9                	idiv   %ecx
+  8010d3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	74 2e                	je     801107 <itoa+0x66>
+  8010d9:	83 c6 01             	add    $0x1,%esi
+  8010dc:	49 83 c0 01          	add    $0x1,%r8
+  8010e0:	44 39 cb             	cmp    %r9d,%ebx
+  8010e3:	7e 15                	jle    8010fa <itoa+0x59>
+		digit = sum % base;
+  8010e5:	89 f8                	mov    %edi,%eax
+  8010e7:	99                   	cltd
+  8010e8:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8010ea:	83 fa 09             	cmp    $0x9,%edx
+  8010ed:	7e d6                	jle    8010c5 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8010ef:	41 89 f1             	mov    %esi,%r9d
+  8010f2:	83 c2 37             	add    $0x37,%edx
+  8010f5:	41 88 10             	mov    %dl,(%r8)
+  8010f8:	eb d4                	jmp    8010ce <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8010fa:	41 83 eb 01          	sub    $0x1,%r11d
+  8010fe:	45 39 cb             	cmp    %r9d,%r11d
+  801101:	75 04                	jne    801107 <itoa+0x66>
+  801103:	85 c0                	test   %eax,%eax
+  801105:	75 28                	jne    80112f <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801107:	4d 63 c9             	movslq %r9d,%r9
+  80110a:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80110f:	4c 89 d7             	mov    %r10,%rdi
+  801112:	48 b8 5a 10 80 00 00 	movabs $0x80105a,%rax
+  801119:	00 00 00 
+  80111c:	ff d0                	call   *%rax
+	return 0;
+  80111e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801123:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801127:	c9                   	leave
+  801128:	c3                   	ret
+		return -1;
+  801129:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80112e:	c3                   	ret
+		return -1;
+  80112f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801134:	eb ed                	jmp    801123 <itoa+0x82>
+
+0000000000801136 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801136:	55                   	push   %rbp
+  801137:	48 89 e5             	mov    %rsp,%rbp
+  80113a:	53                   	push   %rbx
+  80113b:	48 89 fa             	mov    %rdi,%rdx
+  80113e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801141:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801146:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801150:	be 00 00 00 00       	mov    $0x0,%esi
+  801155:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80115d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801161:	c9                   	leave
+  801162:	c3                   	ret
+
+0000000000801163 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801163:	55                   	push   %rbp
+  801164:	48 89 e5             	mov    %rsp,%rbp
+  801167:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801168:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801172:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801177:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801181:	be 00 00 00 00       	mov    $0x0,%esi
+  801186:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80118e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+
+0000000000801194 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+  801198:	53                   	push   %rbx
+  801199:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80119d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c1:	48 85 c0             	test   %rax,%rax
+  8011c4:	7f 06                	jg     8011cc <sys_env_destroy+0x38>
+}
+  8011c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011cc:	49 89 c0             	mov    %rax,%r8
+  8011cf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011d4:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  8011db:	00 00 00 
+  8011de:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e3:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  8011ea:	00 00 00 
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f2:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  8011f9:	00 00 00 
+  8011fc:	41 ff d1             	call   *%r9
+
+00000000008011ff <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011ff:	55                   	push   %rbp
+  801200:	48 89 e5             	mov    %rsp,%rbp
+  801203:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801204:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801218:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121d:	be 00 00 00 00       	mov    $0x0,%esi
+  801222:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801228:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80122a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122e:	c9                   	leave
+  80122f:	c3                   	ret
+
+0000000000801230 <sys_yield>:
+
+void
+sys_yield(void) {
+  801230:	55                   	push   %rbp
+  801231:	48 89 e5             	mov    %rsp,%rbp
+  801234:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801235:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80123f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801249:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124e:	be 00 00 00 00       	mov    $0x0,%esi
+  801253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801259:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80125b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+0000000000801261 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	53                   	push   %rbx
+  801266:	48 89 fa             	mov    %rdi,%rdx
+  801269:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80126c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801271:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801278:	00 00 00 
+  80127b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+  801285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80128d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801291:	c9                   	leave
+  801292:	c3                   	ret
+
+0000000000801293 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801293:	55                   	push   %rbp
+  801294:	48 89 e5             	mov    %rsp,%rbp
+  801297:	53                   	push   %rbx
+  801298:	49 89 f8             	mov    %rdi,%r8
+  80129b:	48 89 d3             	mov    %rdx,%rbx
+  80129e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a6:	4c 89 c2             	mov    %r8,%rdx
+  8012a9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bd:	c9                   	leave
+  8012be:	c3                   	ret
+
+00000000008012bf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012bf:	55                   	push   %rbp
+  8012c0:	48 89 e5             	mov    %rsp,%rbp
+  8012c3:	53                   	push   %rbx
+  8012c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c8:	89 f8                	mov    %edi,%eax
+  8012ca:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012cd:	48 63 f9             	movslq %ecx,%rdi
+  8012d0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012db:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e8:	48 85 c0             	test   %rax,%rax
+  8012eb:	7f 06                	jg     8012f3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f1:	c9                   	leave
+  8012f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f3:	49 89 c0             	mov    %rax,%r8
+  8012f6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012fb:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  801302:	00 00 00 
+  801305:	be 26 00 00 00       	mov    $0x26,%esi
+  80130a:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  801311:	00 00 00 
+  801314:	b8 00 00 00 00       	mov    $0x0,%eax
+  801319:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  801320:	00 00 00 
+  801323:	41 ff d1             	call   *%r9
+
+0000000000801326 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+  80132a:	53                   	push   %rbx
+  80132b:	48 83 ec 08          	sub    $0x8,%rsp
+  80132f:	89 f8                	mov    %edi,%eax
+  801331:	49 89 f2             	mov    %rsi,%r10
+  801334:	48 89 cf             	mov    %rcx,%rdi
+  801337:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80133a:	48 63 da             	movslq %edx,%rbx
+  80133d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801340:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801345:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801348:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80134b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134d:	48 85 c0             	test   %rax,%rax
+  801350:	7f 06                	jg     801358 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801352:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801356:	c9                   	leave
+  801357:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801358:	49 89 c0             	mov    %rax,%r8
+  80135b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801360:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  801367:	00 00 00 
+  80136a:	be 26 00 00 00       	mov    $0x26,%esi
+  80136f:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  801376:	00 00 00 
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137e:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  801385:	00 00 00 
+  801388:	41 ff d1             	call   *%r9
+
+000000000080138b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80138b:	55                   	push   %rbp
+  80138c:	48 89 e5             	mov    %rsp,%rbp
+  80138f:	53                   	push   %rbx
+  801390:	48 83 ec 08          	sub    $0x8,%rsp
+  801394:	48 89 f1             	mov    %rsi,%rcx
+  801397:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80139a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80139d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b4:	48 85 c0             	test   %rax,%rax
+  8013b7:	7f 06                	jg     8013bf <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bf:	49 89 c0             	mov    %rax,%r8
+  8013c2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013c7:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  8013ce:	00 00 00 
+  8013d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d6:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  8013dd:	00 00 00 
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e5:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  8013ec:	00 00 00 
+  8013ef:	41 ff d1             	call   *%r9
+
+00000000008013f2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	53                   	push   %rbx
+  8013f7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013fb:	48 63 ce             	movslq %esi,%rcx
+  8013fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801401:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801406:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141d:	48 85 c0             	test   %rax,%rax
+  801420:	7f 06                	jg     801428 <sys_env_set_status+0x36>
+}
+  801422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801428:	49 89 c0             	mov    %rax,%r8
+  80142b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801430:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  801437:	00 00 00 
+  80143a:	be 26 00 00 00       	mov    $0x26,%esi
+  80143f:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  801446:	00 00 00 
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  801455:	00 00 00 
+  801458:	41 ff d1             	call   *%r9
+
+000000000080145b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80145b:	55                   	push   %rbp
+  80145c:	48 89 e5             	mov    %rsp,%rbp
+  80145f:	53                   	push   %rbx
+  801460:	48 83 ec 08          	sub    $0x8,%rsp
+  801464:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801467:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801474:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801479:	be 00 00 00 00       	mov    $0x0,%esi
+  80147e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801484:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801486:	48 85 c0             	test   %rax,%rax
+  801489:	7f 06                	jg     801491 <sys_env_set_trapframe+0x36>
+}
+  80148b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801491:	49 89 c0             	mov    %rax,%r8
+  801494:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801499:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  8014a0:	00 00 00 
+  8014a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a8:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  8014af:	00 00 00 
+  8014b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b7:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  8014be:	00 00 00 
+  8014c1:	41 ff d1             	call   *%r9
+
+00000000008014c4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	53                   	push   %rbx
+  8014c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ef:	48 85 c0             	test   %rax,%rax
+  8014f2:	7f 06                	jg     8014fa <sys_env_set_pgfault_upcall+0x36>
+}
+  8014f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f8:	c9                   	leave
+  8014f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fa:	49 89 c0             	mov    %rax,%r8
+  8014fd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801502:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  801509:	00 00 00 
+  80150c:	be 26 00 00 00       	mov    $0x26,%esi
+  801511:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  801518:	00 00 00 
+  80151b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801520:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  801527:	00 00 00 
+  80152a:	41 ff d1             	call   *%r9
+
+000000000080152d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	53                   	push   %rbx
+  801532:	89 f8                	mov    %edi,%eax
+  801534:	49 89 f1             	mov    %rsi,%r9
+  801537:	48 89 d3             	mov    %rdx,%rbx
+  80153a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80153d:	49 63 f0             	movslq %r8d,%rsi
+  801540:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801548:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801551:	cd 30                	int    $0x30
+}
+  801553:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801557:	c9                   	leave
+  801558:	c3                   	ret
+
+0000000000801559 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801559:	55                   	push   %rbp
+  80155a:	48 89 e5             	mov    %rsp,%rbp
+  80155d:	53                   	push   %rbx
+  80155e:	48 83 ec 08          	sub    $0x8,%rsp
+  801562:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801565:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801568:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801570:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801575:	be 00 00 00 00       	mov    $0x0,%esi
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801580:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801582:	48 85 c0             	test   %rax,%rax
+  801585:	7f 06                	jg     80158d <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158b:	c9                   	leave
+  80158c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158d:	49 89 c0             	mov    %rax,%r8
+  801590:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801595:	48 ba 88 3e 80 00 00 	movabs $0x803e88,%rdx
+  80159c:	00 00 00 
+  80159f:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a4:	48 bf a7 3e 80 00 00 	movabs $0x803ea7,%rdi
+  8015ab:	00 00 00 
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	49 b9 46 38 80 00 00 	movabs $0x803846,%r9
+  8015ba:	00 00 00 
+  8015bd:	41 ff d1             	call   *%r9
+
+00000000008015c0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8015c0:	55                   	push   %rbp
+  8015c1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8015c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c9:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  8015d0:	00 00 00 
+  8015d3:	ff d0                	call   *%rax
+}
+  8015d5:	5d                   	pop    %rbp
+  8015d6:	c3                   	ret
+
+00000000008015d7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801600:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+
+0000000000801608 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801608:	55                   	push   %rbp
+  801609:	48 89 e5             	mov    %rsp,%rbp
+  80160c:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80160d:	48 63 ce             	movslq %esi,%rcx
+  801610:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+}
+  801630:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801634:	c9                   	leave
+  801635:	c3                   	ret
+
+0000000000801636 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+  80163a:	53                   	push   %rbx
+  80163b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80163e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801642:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801651:	be 00 00 00 00       	mov    $0x0,%esi
+  801656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165c:	cd 30                	int    $0x30
+}
+  80165e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+
+0000000000801664 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	53                   	push   %rbx
+  801669:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80166c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80166f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801674:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801677:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167c:	be 00 00 00 00       	mov    $0x0,%esi
+  801681:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801687:	cd 30                	int    $0x30
+}
+  801689:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168d:	c9                   	leave
+  80168e:	c3                   	ret
+
+000000000080168f <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80168f:	55                   	push   %rbp
+  801690:	48 89 e5             	mov    %rsp,%rbp
+  801693:	41 54                	push   %r12
+  801695:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801696:	b8 08 00 00 00       	mov    $0x8,%eax
+  80169b:	cd 30                	int    $0x30
+  80169d:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	78 7e                	js     801722 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  8016a4:	0f 84 80 00 00 00    	je     80172a <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8016aa:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8016b0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8016b7:	00 00 00 
+  8016ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bf:	89 c2                	mov    %eax,%edx
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016cb:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  8016d2:	00 00 00 
+  8016d5:	ff d0                	call   *%rax
+  8016d7:	85 c0                	test   %eax,%eax
+  8016d9:	0f 88 81 00 00 00    	js     801760 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8016df:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8016e6:	00 00 00 
+  8016e9:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  8016f0:	44 89 e7             	mov    %r12d,%edi
+  8016f3:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  8016fa:	00 00 00 
+  8016fd:	ff d0                	call   *%rax
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 65                	js     801768 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801703:	be 02 00 00 00       	mov    $0x2,%esi
+  801708:	44 89 e7             	mov    %r12d,%edi
+  80170b:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+        return -1;
+  801717:	85 c0                	test   %eax,%eax
+  801719:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80171e:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801722:	44 89 e0             	mov    %r12d,%eax
+  801725:	5b                   	pop    %rbx
+  801726:	41 5c                	pop    %r12
+  801728:	5d                   	pop    %rbp
+  801729:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80172a:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+  801736:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80173b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80173f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801743:	48 c1 e0 04          	shl    $0x4,%rax
+  801747:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80174e:	00 00 00 
+  801751:	48 01 d0             	add    %rdx,%rax
+  801754:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  80175b:	00 00 00 
+        return 0;
+  80175e:	eb c2                	jmp    801722 <fork+0x93>
+        return -1;
+  801760:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801766:	eb ba                	jmp    801722 <fork+0x93>
+        return -1;
+  801768:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80176e:	eb b2                	jmp    801722 <fork+0x93>
+
+0000000000801770 <sfork>:
+
+envid_t
+sfork() {
+  801770:	55                   	push   %rbp
+  801771:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801774:	48 ba b5 3e 80 00 00 	movabs $0x803eb5,%rdx
+  80177b:	00 00 00 
+  80177e:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801783:	48 bf d0 3e 80 00 00 	movabs $0x803ed0,%rdi
+  80178a:	00 00 00 
+  80178d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801792:	48 b9 46 38 80 00 00 	movabs $0x803846,%rcx
+  801799:	00 00 00 
+  80179c:	ff d1                	call   *%rcx
+
+000000000080179e <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	41 55                	push   %r13
+  8017a4:	41 54                	push   %r12
+  8017a6:	53                   	push   %rbx
+  8017a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ab:	49 89 fc             	mov    %rdi,%r12
+  8017ae:	48 89 f7             	mov    %rsi,%rdi
+  8017b1:	48 89 d3             	mov    %rdx,%rbx
+  8017b4:	49 89 cd             	mov    %rcx,%r13
+  8017b7:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8017ba:	48 85 f6             	test   %rsi,%rsi
+  8017bd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017c4:	00 00 00 
+  8017c7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8017cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017d0:	48 85 db             	test   %rbx,%rbx
+  8017d3:	74 03                	je     8017d8 <ipc_recv_timed+0x3a>
+  8017d5:	48 8b 33             	mov    (%rbx),%rsi
+  8017d8:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  8017df:	00 00 00 
+  8017e2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	78 75                	js     80185d <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8017e8:	4d 85 e4             	test   %r12,%r12
+  8017eb:	74 14                	je     801801 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8017ed:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017f4:	00 00 00 
+  8017f7:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8017fd:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  801801:	4d 85 ed             	test   %r13,%r13
+  801804:	74 14                	je     80181a <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  801806:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80180d:	00 00 00 
+  801810:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  801816:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80181a:	48 85 db             	test   %rbx,%rbx
+  80181d:	74 23                	je     801842 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80181f:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801826:	00 00 00 
+  801829:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80182f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801834:	85 c9                	test   %ecx,%ecx
+  801836:	74 07                	je     80183f <ipc_recv_timed+0xa1>
+  801838:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80183f:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801842:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801849:	00 00 00 
+  80184c:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  801852:	48 83 c4 08          	add    $0x8,%rsp
+  801856:	5b                   	pop    %rbx
+  801857:	41 5c                	pop    %r12
+  801859:	41 5d                	pop    %r13
+  80185b:	5d                   	pop    %rbp
+  80185c:	c3                   	ret
+        if (from_env_store != NULL) {
+  80185d:	4d 85 e4             	test   %r12,%r12
+  801860:	74 08                	je     80186a <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  801862:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801869:	00 
+        if (perm_store != NULL) {
+  80186a:	4d 85 ed             	test   %r13,%r13
+  80186d:	74 08                	je     801877 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80186f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801876:	00 
+        if (size != NULL) {
+  801877:	48 85 db             	test   %rbx,%rbx
+  80187a:	74 d6                	je     801852 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80187c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801883:	eb cd                	jmp    801852 <ipc_recv_timed+0xb4>
+
+0000000000801885 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801885:	55                   	push   %rbp
+  801886:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  801889:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80188f:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  801896:	00 00 00 
+  801899:	ff d0                	call   *%rax
+}
+  80189b:	5d                   	pop    %rbp
+  80189c:	c3                   	ret
+
+000000000080189d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80189d:	55                   	push   %rbp
+  80189e:	48 89 e5             	mov    %rsp,%rbp
+  8018a1:	41 57                	push   %r15
+  8018a3:	41 56                	push   %r14
+  8018a5:	41 55                	push   %r13
+  8018a7:	41 54                	push   %r12
+  8018a9:	53                   	push   %rbx
+  8018aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ae:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8018b1:	48 89 d3             	mov    %rdx,%rbx
+  8018b4:	49 89 cc             	mov    %rcx,%r12
+  8018b7:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8018ba:	48 85 d2             	test   %rdx,%rdx
+  8018bd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018c4:	00 00 00 
+  8018c7:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8018cb:	89 f0                	mov    %esi,%eax
+  8018cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018d1:	48 89 da             	mov    %rbx,%rdx
+  8018d4:	48 89 c6             	mov    %rax,%rsi
+  8018d7:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  8018de:	00 00 00 
+  8018e1:	ff d0                	call   *%rax
+    while (res < 0) {
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	79 65                	jns    80194c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8018e7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8018ea:	75 33                	jne    80191f <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8018ec:	49 bf 30 12 80 00 00 	movabs $0x801230,%r15
+  8018f3:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8018f6:	49 be 2d 15 80 00 00 	movabs $0x80152d,%r14
+  8018fd:	00 00 00 
+        sys_yield();
+  801900:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801903:	45 89 e8             	mov    %r13d,%r8d
+  801906:	4c 89 e1             	mov    %r12,%rcx
+  801909:	48 89 da             	mov    %rbx,%rdx
+  80190c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801910:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  801913:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  801916:	85 c0                	test   %eax,%eax
+  801918:	79 32                	jns    80194c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80191a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80191d:	74 e1                	je     801900 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80191f:	89 c1                	mov    %eax,%ecx
+  801921:	48 ba db 3e 80 00 00 	movabs $0x803edb,%rdx
+  801928:	00 00 00 
+  80192b:	be 52 00 00 00       	mov    $0x52,%esi
+  801930:	48 bf ef 3e 80 00 00 	movabs $0x803eef,%rdi
+  801937:	00 00 00 
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193f:	49 b8 46 38 80 00 00 	movabs $0x803846,%r8
+  801946:	00 00 00 
+  801949:	41 ff d0             	call   *%r8
+    }
+}
+  80194c:	48 83 c4 18          	add    $0x18,%rsp
+  801950:	5b                   	pop    %rbx
+  801951:	41 5c                	pop    %r12
+  801953:	41 5d                	pop    %r13
+  801955:	41 5e                	pop    %r14
+  801957:	41 5f                	pop    %r15
+  801959:	5d                   	pop    %rbp
+  80195a:	c3                   	ret
+
+000000000080195b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801960:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801967:	00 00 00 
+  80196a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80196e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801972:	48 c1 e2 04          	shl    $0x4,%rdx
+  801976:	48 01 ca             	add    %rcx,%rdx
+  801979:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80197f:	39 fa                	cmp    %edi,%edx
+  801981:	74 12                	je     801995 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  801983:	48 83 c0 01          	add    $0x1,%rax
+  801987:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80198d:	75 db                	jne    80196a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801994:	c3                   	ret
+            return envs[i].env_id;
+  801995:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801999:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80199d:	48 c1 e2 04          	shl    $0x4,%rdx
+  8019a1:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8019a8:	00 00 00 
+  8019ab:	48 01 d0             	add    %rdx,%rax
+  8019ae:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8019b4:	c3                   	ret
+
+00000000008019b5 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019bc:	ff ff ff 
+  8019bf:	48 01 f8             	add    %rdi,%rax
+  8019c2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019c6:	c3                   	ret
+
+00000000008019c7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019c7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019ce:	ff ff ff 
+  8019d1:	48 01 f8             	add    %rdi,%rax
+  8019d4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019d8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019de:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019e2:	c3                   	ret
+
+00000000008019e3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019e3:	55                   	push   %rbp
+  8019e4:	48 89 e5             	mov    %rsp,%rbp
+  8019e7:	41 57                	push   %r15
+  8019e9:	41 56                	push   %r14
+  8019eb:	41 55                	push   %r13
+  8019ed:	41 54                	push   %r12
+  8019ef:	53                   	push   %rbx
+  8019f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019f4:	49 89 ff             	mov    %rdi,%r15
+  8019f7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019fc:	49 bd 02 35 80 00 00 	movabs $0x803502,%r13
+  801a03:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a06:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a0c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a0f:	48 89 df             	mov    %rbx,%rdi
+  801a12:	41 ff d5             	call   *%r13
+  801a15:	83 e0 04             	and    $0x4,%eax
+  801a18:	74 17                	je     801a31 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a1a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a21:	4c 39 f3             	cmp    %r14,%rbx
+  801a24:	75 e6                	jne    801a0c <fd_alloc+0x29>
+  801a26:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a2c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a31:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a34:	48 83 c4 08          	add    $0x8,%rsp
+  801a38:	5b                   	pop    %rbx
+  801a39:	41 5c                	pop    %r12
+  801a3b:	41 5d                	pop    %r13
+  801a3d:	41 5e                	pop    %r14
+  801a3f:	41 5f                	pop    %r15
+  801a41:	5d                   	pop    %rbp
+  801a42:	c3                   	ret
+
+0000000000801a43 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a43:	83 ff 1f             	cmp    $0x1f,%edi
+  801a46:	77 39                	ja     801a81 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	41 54                	push   %r12
+  801a4e:	53                   	push   %rbx
+  801a4f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a52:	48 63 df             	movslq %edi,%rbx
+  801a55:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a5c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a60:	48 89 df             	mov    %rbx,%rdi
+  801a63:	48 b8 02 35 80 00 00 	movabs $0x803502,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+  801a6f:	a8 04                	test   $0x4,%al
+  801a71:	74 14                	je     801a87 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a73:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a7c:	5b                   	pop    %rbx
+  801a7d:	41 5c                	pop    %r12
+  801a7f:	5d                   	pop    %rbp
+  801a80:	c3                   	ret
+        return -E_INVAL;
+  801a81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a86:	c3                   	ret
+        return -E_INVAL;
+  801a87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8c:	eb ee                	jmp    801a7c <fd_lookup+0x39>
+
+0000000000801a8e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a8e:	55                   	push   %rbp
+  801a8f:	48 89 e5             	mov    %rsp,%rbp
+  801a92:	41 54                	push   %r12
+  801a94:	53                   	push   %rbx
+  801a95:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a98:	48 b8 a0 3f 80 00 00 	movabs $0x803fa0,%rax
+  801a9f:	00 00 00 
+  801aa2:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801aa9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801aac:	39 3b                	cmp    %edi,(%rbx)
+  801aae:	74 47                	je     801af7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ab0:	48 83 c0 08          	add    $0x8,%rax
+  801ab4:	48 8b 18             	mov    (%rax),%rbx
+  801ab7:	48 85 db             	test   %rbx,%rbx
+  801aba:	75 f0                	jne    801aac <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801abc:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801ac3:	00 00 00 
+  801ac6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801acc:	89 fa                	mov    %edi,%edx
+  801ace:	48 bf 00 3f 80 00 00 	movabs $0x803f00,%rdi
+  801ad5:	00 00 00 
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	48 b9 0e 03 80 00 00 	movabs $0x80030e,%rcx
+  801ae4:	00 00 00 
+  801ae7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aee:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801af2:	5b                   	pop    %rbx
+  801af3:	41 5c                	pop    %r12
+  801af5:	5d                   	pop    %rbp
+  801af6:	c3                   	ret
+            return 0;
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afc:	eb f0                	jmp    801aee <dev_lookup+0x60>
+
+0000000000801afe <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	41 55                	push   %r13
+  801b04:	41 54                	push   %r12
+  801b06:	53                   	push   %rbx
+  801b07:	48 83 ec 18          	sub    $0x18,%rsp
+  801b0b:	48 89 fb             	mov    %rdi,%rbx
+  801b0e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b11:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b18:	ff ff ff 
+  801b1b:	48 01 df             	add    %rbx,%rdi
+  801b1e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b26:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+  801b32:	41 89 c5             	mov    %eax,%r13d
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 06                	js     801b3f <fd_close+0x41>
+  801b39:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b3d:	74 1a                	je     801b59 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b3f:	45 84 e4             	test   %r12b,%r12b
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b4b:	44 89 e8             	mov    %r13d,%eax
+  801b4e:	48 83 c4 18          	add    $0x18,%rsp
+  801b52:	5b                   	pop    %rbx
+  801b53:	41 5c                	pop    %r12
+  801b55:	41 5d                	pop    %r13
+  801b57:	5d                   	pop    %rbp
+  801b58:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b59:	8b 3b                	mov    (%rbx),%edi
+  801b5b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b5f:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	41 89 c5             	mov    %eax,%r13d
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 1b                	js     801b8d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b76:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b7a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b80:	48 85 c0             	test   %rax,%rax
+  801b83:	74 08                	je     801b8d <fd_close+0x8f>
+  801b85:	48 89 df             	mov    %rbx,%rdi
+  801b88:	ff d0                	call   *%rax
+  801b8a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b92:	48 89 de             	mov    %rbx,%rsi
+  801b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9a:	48 b8 8b 13 80 00 00 	movabs $0x80138b,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+    return res;
+  801ba6:	eb a3                	jmp    801b4b <fd_close+0x4d>
+
+0000000000801ba8 <close>:
+
+int
+close(int fdnum) {
+  801ba8:	55                   	push   %rbp
+  801ba9:	48 89 e5             	mov    %rsp,%rbp
+  801bac:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bb0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bb4:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801bbb:	00 00 00 
+  801bbe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 15                	js     801bd9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bc4:	be 01 00 00 00       	mov    $0x1,%esi
+  801bc9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bcd:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+}
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+
+0000000000801bdb <close_all>:
+
+void
+close_all(void) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 54                	push   %r12
+  801be1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801be2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be7:	49 bc a8 1b 80 00 00 	movabs $0x801ba8,%r12
+  801bee:	00 00 00 
+  801bf1:	89 df                	mov    %ebx,%edi
+  801bf3:	41 ff d4             	call   *%r12
+  801bf6:	83 c3 01             	add    $0x1,%ebx
+  801bf9:	83 fb 20             	cmp    $0x20,%ebx
+  801bfc:	75 f3                	jne    801bf1 <close_all+0x16>
+}
+  801bfe:	5b                   	pop    %rbx
+  801bff:	41 5c                	pop    %r12
+  801c01:	5d                   	pop    %rbp
+  801c02:	c3                   	ret
+
+0000000000801c03 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c03:	55                   	push   %rbp
+  801c04:	48 89 e5             	mov    %rsp,%rbp
+  801c07:	41 57                	push   %r15
+  801c09:	41 56                	push   %r14
+  801c0b:	41 55                	push   %r13
+  801c0d:	41 54                	push   %r12
+  801c0f:	53                   	push   %rbx
+  801c10:	48 83 ec 18          	sub    $0x18,%rsp
+  801c14:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c17:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c1b:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	89 c3                	mov    %eax,%ebx
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	0f 88 b8 00 00 00    	js     801ce9 <dup+0xe6>
+    close(newfdnum);
+  801c31:	44 89 e7             	mov    %r12d,%edi
+  801c34:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c40:	4d 63 ec             	movslq %r12d,%r13
+  801c43:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c4a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c4e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c52:	4c 89 ff             	mov    %r15,%rdi
+  801c55:	49 be c7 19 80 00 00 	movabs $0x8019c7,%r14
+  801c5c:	00 00 00 
+  801c5f:	41 ff d6             	call   *%r14
+  801c62:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c65:	4c 89 ef             	mov    %r13,%rdi
+  801c68:	41 ff d6             	call   *%r14
+  801c6b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c6e:	48 89 df             	mov    %rbx,%rdi
+  801c71:	48 b8 02 35 80 00 00 	movabs $0x803502,%rax
+  801c78:	00 00 00 
+  801c7b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c7d:	a8 04                	test   $0x4,%al
+  801c7f:	74 2b                	je     801cac <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c81:	41 89 c1             	mov    %eax,%r9d
+  801c84:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c8a:	4c 89 f1             	mov    %r14,%rcx
+  801c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c92:	48 89 de             	mov    %rbx,%rsi
+  801c95:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9a:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	89 c3                	mov    %eax,%ebx
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 4e                	js     801cfa <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cac:	4c 89 ff             	mov    %r15,%rdi
+  801caf:	48 b8 02 35 80 00 00 	movabs $0x803502,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+  801cbb:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cbe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cc4:	4c 89 e9             	mov    %r13,%rcx
+  801cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ccc:	4c 89 fe             	mov    %r15,%rsi
+  801ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd4:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+  801ce0:	89 c3                	mov    %eax,%ebx
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 14                	js     801cfa <dup+0xf7>
+
+    return newfdnum;
+  801ce6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ce9:	89 d8                	mov    %ebx,%eax
+  801ceb:	48 83 c4 18          	add    $0x18,%rsp
+  801cef:	5b                   	pop    %rbx
+  801cf0:	41 5c                	pop    %r12
+  801cf2:	41 5d                	pop    %r13
+  801cf4:	41 5e                	pop    %r14
+  801cf6:	41 5f                	pop    %r15
+  801cf8:	5d                   	pop    %rbp
+  801cf9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cfa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cff:	4c 89 ee             	mov    %r13,%rsi
+  801d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d07:	49 bc 8b 13 80 00 00 	movabs $0x80138b,%r12
+  801d0e:	00 00 00 
+  801d11:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d19:	4c 89 f6             	mov    %r14,%rsi
+  801d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d21:	41 ff d4             	call   *%r12
+    return res;
+  801d24:	eb c3                	jmp    801ce9 <dup+0xe6>
+
+0000000000801d26 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	41 56                	push   %r14
+  801d2c:	41 55                	push   %r13
+  801d2e:	41 54                	push   %r12
+  801d30:	53                   	push   %rbx
+  801d31:	48 83 ec 10          	sub    $0x10,%rsp
+  801d35:	89 fb                	mov    %edi,%ebx
+  801d37:	49 89 f4             	mov    %rsi,%r12
+  801d3a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d41:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801d48:	00 00 00 
+  801d4b:	ff d0                	call   *%rax
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 4c                	js     801d9d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d51:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d55:	41 8b 3e             	mov    (%r14),%edi
+  801d58:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d5c:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801d63:	00 00 00 
+  801d66:	ff d0                	call   *%rax
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 35                	js     801da1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d6c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d70:	83 e0 03             	and    $0x3,%eax
+  801d73:	83 f8 01             	cmp    $0x1,%eax
+  801d76:	74 2d                	je     801da5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d80:	48 85 c0             	test   %rax,%rax
+  801d83:	74 56                	je     801ddb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d85:	4c 89 ea             	mov    %r13,%rdx
+  801d88:	4c 89 e6             	mov    %r12,%rsi
+  801d8b:	4c 89 f7             	mov    %r14,%rdi
+  801d8e:	ff d0                	call   *%rax
+}
+  801d90:	48 83 c4 10          	add    $0x10,%rsp
+  801d94:	5b                   	pop    %rbx
+  801d95:	41 5c                	pop    %r12
+  801d97:	41 5d                	pop    %r13
+  801d99:	41 5e                	pop    %r14
+  801d9b:	5d                   	pop    %rbp
+  801d9c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d9d:	48 98                	cltq
+  801d9f:	eb ef                	jmp    801d90 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da1:	48 98                	cltq
+  801da3:	eb eb                	jmp    801d90 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801da5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801dac:	00 00 00 
+  801daf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801db5:	89 da                	mov    %ebx,%edx
+  801db7:	48 bf 61 3f 80 00 00 	movabs $0x803f61,%rdi
+  801dbe:	00 00 00 
+  801dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc6:	48 b9 0e 03 80 00 00 	movabs $0x80030e,%rcx
+  801dcd:	00 00 00 
+  801dd0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dd9:	eb b5                	jmp    801d90 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ddb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801de2:	eb ac                	jmp    801d90 <read+0x6a>
+
+0000000000801de4 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801de4:	55                   	push   %rbp
+  801de5:	48 89 e5             	mov    %rsp,%rbp
+  801de8:	41 56                	push   %r14
+  801dea:	41 55                	push   %r13
+  801dec:	41 54                	push   %r12
+  801dee:	53                   	push   %rbx
+  801def:	48 83 ec 10          	sub    $0x10,%rsp
+  801df3:	89 fb                	mov    %edi,%ebx
+  801df5:	49 89 f4             	mov    %rsi,%r12
+  801df8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dfb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dff:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801e06:	00 00 00 
+  801e09:	ff d0                	call   *%rax
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	78 41                	js     801e50 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e0f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e13:	41 8b 3e             	mov    (%r14),%edi
+  801e16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e1a:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 35                	js     801e5f <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e2a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e2e:	83 e0 03             	and    $0x3,%eax
+  801e31:	83 f8 01             	cmp    $0x1,%eax
+  801e34:	74 2d                	je     801e63 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e3a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e3e:	48 85 c0             	test   %rax,%rax
+  801e41:	74 56                	je     801e99 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e43:	4c 89 ea             	mov    %r13,%rdx
+  801e46:	4c 89 e6             	mov    %r12,%rsi
+  801e49:	4c 89 f7             	mov    %r14,%rdi
+  801e4c:	ff d0                	call   *%rax
+  801e4e:	eb 02                	jmp    801e52 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e50:	48 98                	cltq
+}
+  801e52:	48 83 c4 10          	add    $0x10,%rsp
+  801e56:	5b                   	pop    %rbx
+  801e57:	41 5c                	pop    %r12
+  801e59:	41 5d                	pop    %r13
+  801e5b:	41 5e                	pop    %r14
+  801e5d:	5d                   	pop    %rbp
+  801e5e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e5f:	48 98                	cltq
+  801e61:	eb ef                	jmp    801e52 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e63:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801e6a:	00 00 00 
+  801e6d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e73:	89 da                	mov    %ebx,%edx
+  801e75:	48 bf 20 3f 80 00 00 	movabs $0x803f20,%rdi
+  801e7c:	00 00 00 
+  801e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e84:	48 b9 0e 03 80 00 00 	movabs $0x80030e,%rcx
+  801e8b:	00 00 00 
+  801e8e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e90:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e97:	eb b9                	jmp    801e52 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e99:	4c 89 ea             	mov    %r13,%rdx
+  801e9c:	4c 89 e6             	mov    %r12,%rsi
+  801e9f:	89 df                	mov    %ebx,%edi
+  801ea1:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+  801ead:	eb a3                	jmp    801e52 <readmap+0x6e>
+
+0000000000801eaf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	41 57                	push   %r15
+  801eb5:	41 56                	push   %r14
+  801eb7:	41 55                	push   %r13
+  801eb9:	41 54                	push   %r12
+  801ebb:	53                   	push   %rbx
+  801ebc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ec0:	48 85 d2             	test   %rdx,%rdx
+  801ec3:	74 54                	je     801f19 <readn+0x6a>
+  801ec5:	41 89 fd             	mov    %edi,%r13d
+  801ec8:	49 89 f6             	mov    %rsi,%r14
+  801ecb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ed3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ed8:	49 bf 26 1d 80 00 00 	movabs $0x801d26,%r15
+  801edf:	00 00 00 
+  801ee2:	4c 89 e2             	mov    %r12,%rdx
+  801ee5:	48 29 f2             	sub    %rsi,%rdx
+  801ee8:	4c 01 f6             	add    %r14,%rsi
+  801eeb:	44 89 ef             	mov    %r13d,%edi
+  801eee:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 20                	js     801f15 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ef5:	01 c3                	add    %eax,%ebx
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	74 08                	je     801f03 <readn+0x54>
+  801efb:	48 63 f3             	movslq %ebx,%rsi
+  801efe:	4c 39 e6             	cmp    %r12,%rsi
+  801f01:	72 df                	jb     801ee2 <readn+0x33>
+    }
+    return res;
+  801f03:	48 63 c3             	movslq %ebx,%rax
+}
+  801f06:	48 83 c4 08          	add    $0x8,%rsp
+  801f0a:	5b                   	pop    %rbx
+  801f0b:	41 5c                	pop    %r12
+  801f0d:	41 5d                	pop    %r13
+  801f0f:	41 5e                	pop    %r14
+  801f11:	41 5f                	pop    %r15
+  801f13:	5d                   	pop    %rbp
+  801f14:	c3                   	ret
+        if (inc < 0) return inc;
+  801f15:	48 98                	cltq
+  801f17:	eb ed                	jmp    801f06 <readn+0x57>
+    int inc = 1, res = 0;
+  801f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f1e:	eb e3                	jmp    801f03 <readn+0x54>
+
+0000000000801f20 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f20:	55                   	push   %rbp
+  801f21:	48 89 e5             	mov    %rsp,%rbp
+  801f24:	41 56                	push   %r14
+  801f26:	41 55                	push   %r13
+  801f28:	41 54                	push   %r12
+  801f2a:	53                   	push   %rbx
+  801f2b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f2f:	89 fb                	mov    %edi,%ebx
+  801f31:	49 89 f4             	mov    %rsi,%r12
+  801f34:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f37:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3b:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 47                	js     801f92 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f4f:	41 8b 3e             	mov    (%r14),%edi
+  801f52:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f56:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	78 30                	js     801f96 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f66:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f6b:	74 2d                	je     801f9a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f71:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f75:	48 85 c0             	test   %rax,%rax
+  801f78:	74 56                	je     801fd0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f7a:	4c 89 ea             	mov    %r13,%rdx
+  801f7d:	4c 89 e6             	mov    %r12,%rsi
+  801f80:	4c 89 f7             	mov    %r14,%rdi
+  801f83:	ff d0                	call   *%rax
+}
+  801f85:	48 83 c4 10          	add    $0x10,%rsp
+  801f89:	5b                   	pop    %rbx
+  801f8a:	41 5c                	pop    %r12
+  801f8c:	41 5d                	pop    %r13
+  801f8e:	41 5e                	pop    %r14
+  801f90:	5d                   	pop    %rbp
+  801f91:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f92:	48 98                	cltq
+  801f94:	eb ef                	jmp    801f85 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f96:	48 98                	cltq
+  801f98:	eb eb                	jmp    801f85 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9a:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801fa1:	00 00 00 
+  801fa4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801faa:	89 da                	mov    %ebx,%edx
+  801fac:	48 bf 7d 3f 80 00 00 	movabs $0x803f7d,%rdi
+  801fb3:	00 00 00 
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbb:	48 b9 0e 03 80 00 00 	movabs $0x80030e,%rcx
+  801fc2:	00 00 00 
+  801fc5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fce:	eb b5                	jmp    801f85 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fd0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fd7:	eb ac                	jmp    801f85 <write+0x65>
+
+0000000000801fd9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	53                   	push   %rbx
+  801fde:	48 83 ec 18          	sub    $0x18,%rsp
+  801fe2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe8:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	78 0c                	js     802004 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ff8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ffc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802004:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+000000000080200a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80200a:	55                   	push   %rbp
+  80200b:	48 89 e5             	mov    %rsp,%rbp
+  80200e:	41 55                	push   %r13
+  802010:	41 54                	push   %r12
+  802012:	53                   	push   %rbx
+  802013:	48 83 ec 18          	sub    $0x18,%rsp
+  802017:	89 fb                	mov    %edi,%ebx
+  802019:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80201c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802020:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  802027:	00 00 00 
+  80202a:	ff d0                	call   *%rax
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	78 38                	js     802068 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802030:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802034:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802038:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80203c:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	78 1c                	js     802068 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80204c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802051:	74 20                	je     802073 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802053:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802057:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80205b:	48 85 c0             	test   %rax,%rax
+  80205e:	74 47                	je     8020a7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802060:	44 89 e6             	mov    %r12d,%esi
+  802063:	4c 89 ef             	mov    %r13,%rdi
+  802066:	ff d0                	call   *%rax
+}
+  802068:	48 83 c4 18          	add    $0x18,%rsp
+  80206c:	5b                   	pop    %rbx
+  80206d:	41 5c                	pop    %r12
+  80206f:	41 5d                	pop    %r13
+  802071:	5d                   	pop    %rbp
+  802072:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802073:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80207a:	00 00 00 
+  80207d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802083:	89 da                	mov    %ebx,%edx
+  802085:	48 bf 40 3f 80 00 00 	movabs $0x803f40,%rdi
+  80208c:	00 00 00 
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802094:	48 b9 0e 03 80 00 00 	movabs $0x80030e,%rcx
+  80209b:	00 00 00 
+  80209e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a5:	eb c1                	jmp    802068 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ac:	eb ba                	jmp    802068 <ftruncate+0x5e>
+
+00000000008020ae <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020ae:	55                   	push   %rbp
+  8020af:	48 89 e5             	mov    %rsp,%rbp
+  8020b2:	41 54                	push   %r12
+  8020b4:	53                   	push   %rbx
+  8020b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020bc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c0:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	78 4e                	js     80211e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020d0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020d4:	41 8b 3c 24          	mov    (%r12),%edi
+  8020d8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020dc:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	78 32                	js     80211e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020f0:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8020f5:	74 30                	je     802127 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020f7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020fa:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802101:	00 00 00 
+    stat->st_isdir = 0;
+  802104:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80210b:	00 00 00 
+    stat->st_dev = dev;
+  80210e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802115:	48 89 de             	mov    %rbx,%rsi
+  802118:	4c 89 e7             	mov    %r12,%rdi
+  80211b:	ff 50 30             	call   *0x30(%rax)
+}
+  80211e:	48 83 c4 10          	add    $0x10,%rsp
+  802122:	5b                   	pop    %rbx
+  802123:	41 5c                	pop    %r12
+  802125:	5d                   	pop    %rbp
+  802126:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802127:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80212c:	eb f0                	jmp    80211e <fstat+0x70>
+
+000000000080212e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80212e:	55                   	push   %rbp
+  80212f:	48 89 e5             	mov    %rsp,%rbp
+  802132:	41 54                	push   %r12
+  802134:	53                   	push   %rbx
+  802135:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802138:	be 00 00 00 00       	mov    $0x0,%esi
+  80213d:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  802144:	00 00 00 
+  802147:	ff d0                	call   *%rax
+  802149:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	78 25                	js     802174 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80214f:	4c 89 e6             	mov    %r12,%rsi
+  802152:	89 c7                	mov    %eax,%edi
+  802154:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+  802160:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802163:	89 df                	mov    %ebx,%edi
+  802165:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  80216c:	00 00 00 
+  80216f:	ff d0                	call   *%rax
+
+    return res;
+  802171:	44 89 e3             	mov    %r12d,%ebx
+}
+  802174:	89 d8                	mov    %ebx,%eax
+  802176:	5b                   	pop    %rbx
+  802177:	41 5c                	pop    %r12
+  802179:	5d                   	pop    %rbp
+  80217a:	c3                   	ret
+
+000000000080217b <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  80217b:	55                   	push   %rbp
+  80217c:	48 89 e5             	mov    %rsp,%rbp
+  80217f:	41 54                	push   %r12
+  802181:	53                   	push   %rbx
+  802182:	48 83 ec 10          	sub    $0x10,%rsp
+  802186:	48 89 fb             	mov    %rdi,%rbx
+  802189:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80218c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802190:	bf 66 00 00 00       	mov    $0x66,%edi
+  802195:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 1f                	js     8021c4 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  8021a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a9:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8021ad:	48 85 c0             	test   %rax,%rax
+  8021b0:	74 1b                	je     8021cd <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  8021b2:	4c 89 e6             	mov    %r12,%rsi
+  8021b5:	48 89 df             	mov    %rbx,%rdi
+  8021b8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021c4:	48 83 c4 10          	add    $0x10,%rsp
+  8021c8:	5b                   	pop    %rbx
+  8021c9:	41 5c                	pop    %r12
+  8021cb:	5d                   	pop    %rbp
+  8021cc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021d2:	eb f0                	jmp    8021c4 <create_snapshot+0x49>
+
+00000000008021d4 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  8021d4:	55                   	push   %rbp
+  8021d5:	48 89 e5             	mov    %rsp,%rbp
+  8021d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021e0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021e5:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+  8021f1:	85 c0                	test   %eax,%eax
+  8021f3:	78 1e                	js     802213 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8021f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021f9:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021fd:	48 85 d2             	test   %rdx,%rdx
+  802200:	74 13                	je     802215 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802202:	b8 00 00 00 00       	mov    $0x0,%eax
+  802207:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802210:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802213:	c9                   	leave
+  802214:	c3                   	ret
+        return -E_NOT_SUPP;
+  802215:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80221a:	eb f7                	jmp    802213 <print_snapshot_list+0x3f>
+
+000000000080221c <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+  802220:	53                   	push   %rbx
+  802221:	48 83 ec 18          	sub    $0x18,%rsp
+  802225:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802228:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80222c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802231:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+  80223d:	85 c0                	test   %eax,%eax
+  80223f:	78 1c                	js     80225d <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802245:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802249:	48 85 c0             	test   %rax,%rax
+  80224c:	74 15                	je     802263 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  80224e:	48 89 df             	mov    %rbx,%rdi
+  802251:	ff d0                	call   *%rax
+    if (res < 0) {
+  802253:	85 c0                	test   %eax,%eax
+  802255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80225d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802261:	c9                   	leave
+  802262:	c3                   	ret
+        return -E_NOT_SUPP;
+  802263:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802268:	eb f3                	jmp    80225d <accept_snapshot+0x41>
+
+000000000080226a <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	53                   	push   %rbx
+  80226f:	48 83 ec 18          	sub    $0x18,%rsp
+  802273:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802276:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80227a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80227f:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	78 1c                	js     8022ab <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80228f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802293:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802297:	48 85 c0             	test   %rax,%rax
+  80229a:	74 15                	je     8022b1 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80229c:	48 89 df             	mov    %rbx,%rdi
+  80229f:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a8:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022af:	c9                   	leave
+  8022b0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022b1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022b6:	eb f3                	jmp    8022ab <delete_snapshot+0x41>
+
+00000000008022b8 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  8022b8:	55                   	push   %rbp
+  8022b9:	48 89 e5             	mov    %rsp,%rbp
+  8022bc:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022c0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022c4:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022c9:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+  8022d5:	85 c0                	test   %eax,%eax
+  8022d7:	78 14                	js     8022ed <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8022d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022dd:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8022e1:	48 85 d2             	test   %rdx,%rdx
+  8022e4:	74 09                	je     8022ef <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8022e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022eb:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8022ed:	c9                   	leave
+  8022ee:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022f4:	eb f7                	jmp    8022ed <gc_snapshots+0x35>
+
+00000000008022f6 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	41 56                	push   %r14
+  8022fc:	41 55                	push   %r13
+  8022fe:	41 54                	push   %r12
+  802300:	53                   	push   %rbx
+  802301:	48 83 ec 10          	sub    $0x10,%rsp
+  802305:	48 89 fb             	mov    %rdi,%rbx
+  802308:	49 89 f4             	mov    %rsi,%r12
+  80230b:	49 89 d5             	mov    %rdx,%r13
+  80230e:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802311:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802315:	bf 66 00 00 00       	mov    $0x66,%edi
+  80231a:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+  802326:	85 c0                	test   %eax,%eax
+  802328:	78 1b                	js     802345 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80232a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80232e:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802332:	48 85 c0             	test   %rax,%rax
+  802335:	74 1b                	je     802352 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802337:	4c 89 f1             	mov    %r14,%rcx
+  80233a:	4c 89 ea             	mov    %r13,%rdx
+  80233d:	4c 89 e6             	mov    %r12,%rsi
+  802340:	48 89 df             	mov    %rbx,%rdi
+  802343:	ff d0                	call   *%rax
+
+    return res;
+}
+  802345:	48 83 c4 10          	add    $0x10,%rsp
+  802349:	5b                   	pop    %rbx
+  80234a:	41 5c                	pop    %r12
+  80234c:	41 5d                	pop    %r13
+  80234e:	41 5e                	pop    %r14
+  802350:	5d                   	pop    %rbp
+  802351:	c3                   	ret
+        return -E_NOT_SUPP;
+  802352:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802357:	eb ec                	jmp    802345 <diff_snapshots+0x4f>
+
+0000000000802359 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802359:	55                   	push   %rbp
+  80235a:	48 89 e5             	mov    %rsp,%rbp
+  80235d:	41 55                	push   %r13
+  80235f:	41 54                	push   %r12
+  802361:	53                   	push   %rbx
+  802362:	48 83 ec 18          	sub    $0x18,%rsp
+  802366:	48 89 fb             	mov    %rdi,%rbx
+  802369:	49 89 f4             	mov    %rsi,%r12
+  80236c:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80236f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802373:	bf 66 00 00 00       	mov    $0x66,%edi
+  802378:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+  802384:	85 c0                	test   %eax,%eax
+  802386:	78 18                	js     8023a0 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802388:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80238c:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802390:	48 85 c0             	test   %rax,%rax
+  802393:	74 16                	je     8023ab <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802395:	4c 89 ea             	mov    %r13,%rdx
+  802398:	4c 89 e6             	mov    %r12,%rsi
+  80239b:	48 89 df             	mov    %rbx,%rdi
+  80239e:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023a0:	48 83 c4 18          	add    $0x18,%rsp
+  8023a4:	5b                   	pop    %rbx
+  8023a5:	41 5c                	pop    %r12
+  8023a7:	41 5d                	pop    %r13
+  8023a9:	5d                   	pop    %rbp
+  8023aa:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023ab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023b0:	eb ee                	jmp    8023a0 <send_snapshot+0x47>
+
+00000000008023b2 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	53                   	push   %rbx
+  8023b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bb:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023be:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023c2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023c7:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8023ce:	00 00 00 
+  8023d1:	ff d0                	call   *%rax
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	78 12                	js     8023e9 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8023d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023db:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8023df:	48 85 c0             	test   %rax,%rax
+  8023e2:	74 0b                	je     8023ef <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8023e4:	48 89 df             	mov    %rbx,%rdi
+  8023e7:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023ed:	c9                   	leave
+  8023ee:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023f4:	eb f3                	jmp    8023e9 <receive_snapshot+0x37>
+
+00000000008023f6 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8023f6:	55                   	push   %rbp
+  8023f7:	48 89 e5             	mov    %rsp,%rbp
+  8023fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802402:	bf 66 00 00 00       	mov    $0x66,%edi
+  802407:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+  802413:	85 c0                	test   %eax,%eax
+  802415:	78 17                	js     80242e <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802417:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80241b:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802422:	48 85 d2             	test   %rdx,%rdx
+  802425:	74 09                	je     802430 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242c:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802430:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802435:	eb f7                	jmp    80242e <free_space_bytes+0x38>
+
+0000000000802437 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802437:	55                   	push   %rbp
+  802438:	48 89 e5             	mov    %rsp,%rbp
+  80243b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80243f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802443:	bf 66 00 00 00       	mov    $0x66,%edi
+  802448:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	85 c0                	test   %eax,%eax
+  802456:	78 17                	js     80246f <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80245c:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802463:	48 85 d2             	test   %rdx,%rdx
+  802466:	74 09                	je     802471 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80246f:	c9                   	leave
+  802470:	c3                   	ret
+        return -E_NOT_SUPP;
+  802471:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802476:	eb f7                	jmp    80246f <busy_space_bytes+0x38>
+
+0000000000802478 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	41 54                	push   %r12
+  80247e:	53                   	push   %rbx
+  80247f:	48 83 ec 10          	sub    $0x10,%rsp
+  802483:	89 fb                	mov    %edi,%ebx
+  802485:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802488:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80248c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802491:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 17                	js     8024b8 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8024a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024a5:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8024ac:	48 85 c0             	test   %rax,%rax
+  8024af:	74 10                	je     8024c1 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8024b1:	4c 89 e6             	mov    %r12,%rsi
+  8024b4:	89 df                	mov    %ebx,%edi
+  8024b6:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8024b8:	48 83 c4 10          	add    $0x10,%rsp
+  8024bc:	5b                   	pop    %rbx
+  8024bd:	41 5c                	pop    %r12
+  8024bf:	5d                   	pop    %rbp
+  8024c0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024c6:	eb f0                	jmp    8024b8 <snapshots_space+0x40>
+
+00000000008024c8 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	41 55                	push   %r13
+  8024ce:	41 54                	push   %r12
+  8024d0:	53                   	push   %rbx
+  8024d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d5:	41 89 fd             	mov    %edi,%r13d
+  8024d8:	48 89 f3             	mov    %rsi,%rbx
+  8024db:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024e5:	00 00 00 
+  8024e8:	83 38 00             	cmpl   $0x0,(%rax)
+  8024eb:	74 57                	je     802544 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024ed:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024f3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024f8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024ff:	00 00 00 
+  802502:	44 89 ee             	mov    %r13d,%esi
+  802505:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80250c:	00 00 00 
+  80250f:	8b 38                	mov    (%rax),%edi
+  802511:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80251d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802522:	4c 89 e2             	mov    %r12,%rdx
+  802525:	48 89 de             	mov    %rbx,%rsi
+  802528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252d:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+}
+  802539:	48 83 c4 08          	add    $0x8,%rsp
+  80253d:	5b                   	pop    %rbx
+  80253e:	41 5c                	pop    %r12
+  802540:	41 5d                	pop    %r13
+  802542:	5d                   	pop    %rbp
+  802543:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802544:	bf 03 00 00 00       	mov    $0x3,%edi
+  802549:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80255c:	00 00 
+  80255e:	eb 8d                	jmp    8024ed <fsipc_region+0x25>
+
+0000000000802560 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802560:	55                   	push   %rbp
+  802561:	48 89 e5             	mov    %rsp,%rbp
+  802564:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802568:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80256f:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802570:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802574:	48 b8 c8 24 80 00 00 	movabs $0x8024c8,%rax
+  80257b:	00 00 00 
+  80257e:	ff d0                	call   *%rax
+}
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+
+0000000000802582 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802582:	85 ff                	test   %edi,%edi
+  802584:	78 6d                	js     8025f3 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802586:	55                   	push   %rbp
+  802587:	48 89 e5             	mov    %rsp,%rbp
+  80258a:	41 54                	push   %r12
+  80258c:	53                   	push   %rbx
+  80258d:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802590:	48 85 f6             	test   %rsi,%rsi
+  802593:	74 57                	je     8025ec <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802595:	89 f8                	mov    %edi,%eax
+  802597:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80259e:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8025a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a5:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025aa:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 2d                	js     8025e7 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8025ba:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8025c1:	00 00 00 
+  8025c4:	49 63 14 24          	movslq (%r12),%rdx
+  8025c8:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8025cf:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8025d4:	48 89 df             	mov    %rbx,%rdi
+  8025d7:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8025e3:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8025e7:	5b                   	pop    %rbx
+  8025e8:	41 5c                	pop    %r12
+  8025ea:	5d                   	pop    %rbp
+  8025eb:	c3                   	ret
+        return -E_INVAL;
+  8025ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f1:	eb f4                	jmp    8025e7 <devfile_df_snapshots+0x65>
+  8025f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025f8:	c3                   	ret
+
+00000000008025f9 <devfile_df_busy>:
+devfile_df_busy() {
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802602:	bf 11 00 00 00       	mov    $0x11,%edi
+  802607:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80260e:	00 00 00 
+  802611:	ff d0                	call   *%rax
+}
+  802613:	5d                   	pop    %rbp
+  802614:	c3                   	ret
+
+0000000000802615 <devfile_df_free>:
+devfile_df_free() {
+  802615:	55                   	push   %rbp
+  802616:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802619:	be 00 00 00 00       	mov    $0x0,%esi
+  80261e:	bf 10 00 00 00       	mov    $0x10,%edi
+  802623:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+}
+  80262f:	5d                   	pop    %rbp
+  802630:	c3                   	ret
+
+0000000000802631 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802631:	55                   	push   %rbp
+  802632:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802635:	be 00 00 00 00       	mov    $0x0,%esi
+  80263a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80263f:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+}
+  80264b:	5d                   	pop    %rbp
+  80264c:	c3                   	ret
+
+000000000080264d <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80264d:	55                   	push   %rbp
+  80264e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802651:	be 00 00 00 00       	mov    $0x0,%esi
+  802656:	bf 09 00 00 00       	mov    $0x9,%edi
+  80265b:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802667:	85 c0                	test   %eax,%eax
+  802669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802671:	5d                   	pop    %rbp
+  802672:	c3                   	ret
+
+0000000000802673 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802673:	55                   	push   %rbp
+  802674:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802677:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80267e:	00 00 00 
+  802681:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802684:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802686:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802689:	be 00 00 00 00       	mov    $0x0,%esi
+  80268e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802693:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+}
+  80269f:	5d                   	pop    %rbp
+  8026a0:	c3                   	ret
+
+00000000008026a1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8026a5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8026a8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8026af:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8026b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8026bb:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+}
+  8026c7:	5d                   	pop    %rbp
+  8026c8:	c3                   	ret
+
+00000000008026c9 <devfile_write>:
+    if (!fd || !buf) {
+  8026c9:	48 85 ff             	test   %rdi,%rdi
+  8026cc:	0f 84 c1 00 00 00    	je     802793 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	41 57                	push   %r15
+  8026d8:	41 56                	push   %r14
+  8026da:	41 55                	push   %r13
+  8026dc:	41 54                	push   %r12
+  8026de:	53                   	push   %rbx
+  8026df:	48 83 ec 18          	sub    $0x18,%rsp
+  8026e3:	49 89 ff             	mov    %rdi,%r15
+  8026e6:	49 89 f5             	mov    %rsi,%r13
+  8026e9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026ec:	48 85 f6             	test   %rsi,%rsi
+  8026ef:	0f 84 95 00 00 00    	je     80278a <devfile_write+0xc1>
+    while (n) {
+  8026f5:	48 85 d2             	test   %rdx,%rdx
+  8026f8:	0f 84 83 00 00 00    	je     802781 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026fe:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802705:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80270c:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80270f:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802714:	49 39 dc             	cmp    %rbx,%r12
+  802717:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80271b:	48 89 da             	mov    %rbx,%rdx
+  80271e:	4c 89 ee             	mov    %r13,%rsi
+  802721:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802728:	00 00 00 
+  80272b:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802737:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80273b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80273e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802742:	be 00 00 00 00       	mov    $0x0,%esi
+  802747:	bf 04 00 00 00       	mov    $0x4,%edi
+  80274c:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802753:	00 00 00 
+  802756:	ff d0                	call   *%rax
+        if (write < 0) {
+  802758:	85 c0                	test   %eax,%eax
+  80275a:	78 21                	js     80277d <devfile_write+0xb4>
+        buf += write;
+  80275c:	48 63 d0             	movslq %eax,%rdx
+  80275f:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802762:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802765:	49 29 d4             	sub    %rdx,%r12
+  802768:	75 a5                	jne    80270f <devfile_write+0x46>
+    return totalWrite;
+  80276a:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80276e:	48 83 c4 18          	add    $0x18,%rsp
+  802772:	5b                   	pop    %rbx
+  802773:	41 5c                	pop    %r12
+  802775:	41 5d                	pop    %r13
+  802777:	41 5e                	pop    %r14
+  802779:	41 5f                	pop    %r15
+  80277b:	5d                   	pop    %rbp
+  80277c:	c3                   	ret
+            return write;
+  80277d:	48 98                	cltq
+  80277f:	eb ed                	jmp    80276e <devfile_write+0xa5>
+    int totalWrite = 0;
+  802781:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802788:	eb e0                	jmp    80276a <devfile_write+0xa1>
+        return -E_INVAL;
+  80278a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802791:	eb db                	jmp    80276e <devfile_write+0xa5>
+  802793:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80279a:	c3                   	ret
+
+000000000080279b <devfile_read>:
+    if (!fd || !buf) {
+  80279b:	48 85 ff             	test   %rdi,%rdi
+  80279e:	0f 84 c0 00 00 00    	je     802864 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8027a4:	55                   	push   %rbp
+  8027a5:	48 89 e5             	mov    %rsp,%rbp
+  8027a8:	41 57                	push   %r15
+  8027aa:	41 56                	push   %r14
+  8027ac:	41 55                	push   %r13
+  8027ae:	41 54                	push   %r12
+  8027b0:	53                   	push   %rbx
+  8027b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027b5:	49 89 ff             	mov    %rdi,%r15
+  8027b8:	49 89 f5             	mov    %rsi,%r13
+  8027bb:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8027be:	48 85 f6             	test   %rsi,%rsi
+  8027c1:	0f 84 96 00 00 00    	je     80285d <devfile_read+0xc2>
+    while (n) {
+  8027c7:	48 85 d2             	test   %rdx,%rdx
+  8027ca:	0f 84 87 00 00 00    	je     802857 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8027d0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027d7:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027d8:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027df:	00 00 00 
+  8027e2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027e6:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8027e9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027ee:	49 39 c4             	cmp    %rax,%r12
+  8027f1:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8027f5:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8027f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802803:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	7e 37                	jle    80284a <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802813:	48 63 d8             	movslq %eax,%rbx
+  802816:	48 89 da             	mov    %rbx,%rdx
+  802819:	4c 89 f6             	mov    %r14,%rsi
+  80281c:	4c 89 ef             	mov    %r13,%rdi
+  80281f:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  802826:	00 00 00 
+  802829:	ff d0                	call   *%rax
+        buf += read;
+  80282b:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80282e:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802832:	49 29 dc             	sub    %rbx,%r12
+  802835:	75 ab                	jne    8027e2 <devfile_read+0x47>
+  return totalRead;
+  802837:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80283b:	48 83 c4 18          	add    $0x18,%rsp
+  80283f:	5b                   	pop    %rbx
+  802840:	41 5c                	pop    %r12
+  802842:	41 5d                	pop    %r13
+  802844:	41 5e                	pop    %r14
+  802846:	41 5f                	pop    %r15
+  802848:	5d                   	pop    %rbp
+  802849:	c3                   	ret
+            return read ? read : totalRead;
+  80284a:	48 63 d0             	movslq %eax,%rdx
+  80284d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802851:	48 0f 45 c2          	cmovne %rdx,%rax
+  802855:	eb e4                	jmp    80283b <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802857:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80285b:	eb da                	jmp    802837 <devfile_read+0x9c>
+        return E_INVAL;
+  80285d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802862:	eb d7                	jmp    80283b <devfile_read+0xa0>
+  802864:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802869:	c3                   	ret
+
+000000000080286a <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80286a:	48 85 ff             	test   %rdi,%rdi
+  80286d:	74 5f                	je     8028ce <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	53                   	push   %rbx
+  802874:	48 83 ec 08          	sub    $0x8,%rsp
+  802878:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80287b:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+  802887:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80288d:	77 45                	ja     8028d4 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80288f:	48 89 de             	mov    %rbx,%rsi
+  802892:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802899:	00 00 00 
+  80289c:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8028a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ad:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8028b2:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028cc:	c9                   	leave
+  8028cd:	c3                   	ret
+        return -E_INVAL;
+  8028ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028d3:	c3                   	ret
+        return -E_INVAL;
+  8028d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d9:	eb ed                	jmp    8028c8 <devfile_receive_snapshot+0x5e>
+
+00000000008028db <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8028db:	55                   	push   %rbp
+  8028dc:	48 89 e5             	mov    %rsp,%rbp
+  8028df:	41 55                	push   %r13
+  8028e1:	41 54                	push   %r12
+  8028e3:	53                   	push   %rbx
+  8028e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e8:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8028eb:	48 85 f6             	test   %rsi,%rsi
+  8028ee:	0f 94 c0             	sete   %al
+  8028f1:	48 85 d2             	test   %rdx,%rdx
+  8028f4:	0f 94 c2             	sete   %dl
+  8028f7:	08 d0                	or     %dl,%al
+  8028f9:	0f 85 ad 00 00 00    	jne    8029ac <devfile_send_snapshot+0xd1>
+  8028ff:	48 89 fb             	mov    %rdi,%rbx
+  802902:	49 89 f4             	mov    %rsi,%r12
+  802905:	48 85 ff             	test   %rdi,%rdi
+  802908:	0f 84 9e 00 00 00    	je     8029ac <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80290e:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802915:	00 00 00 
+  802918:	ff d0                	call   *%rax
+  80291a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802920:	0f 87 8d 00 00 00    	ja     8029b3 <devfile_send_snapshot+0xd8>
+  802926:	4c 89 e7             	mov    %r12,%rdi
+  802929:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+  802935:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80293b:	77 7d                	ja     8029ba <devfile_send_snapshot+0xdf>
+  80293d:	4c 89 ef             	mov    %r13,%rdi
+  802940:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+  80294c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802952:	77 6d                	ja     8029c1 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802954:	48 89 de             	mov    %rbx,%rsi
+  802957:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80295e:	00 00 00 
+  802961:	48 bb 33 0c 80 00 00 	movabs $0x800c33,%rbx
+  802968:	00 00 00 
+  80296b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80296d:	4c 89 e6             	mov    %r12,%rsi
+  802970:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802977:	00 00 00 
+  80297a:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80297c:	4c 89 ee             	mov    %r13,%rsi
+  80297f:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802986:	00 00 00 
+  802989:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  80298b:	be 00 00 00 00       	mov    $0x0,%esi
+  802990:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802995:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+}
+  8029a1:	48 83 c4 08          	add    $0x8,%rsp
+  8029a5:	5b                   	pop    %rbx
+  8029a6:	41 5c                	pop    %r12
+  8029a8:	41 5d                	pop    %r13
+  8029aa:	5d                   	pop    %rbp
+  8029ab:	c3                   	ret
+        return -E_INVAL;
+  8029ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b1:	eb ee                	jmp    8029a1 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8029b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b8:	eb e7                	jmp    8029a1 <devfile_send_snapshot+0xc6>
+  8029ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029bf:	eb e0                	jmp    8029a1 <devfile_send_snapshot+0xc6>
+  8029c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c6:	eb d9                	jmp    8029a1 <devfile_send_snapshot+0xc6>
+
+00000000008029c8 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8029c8:	48 85 ff             	test   %rdi,%rdi
+  8029cb:	0f 84 41 01 00 00    	je     802b12 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8029d1:	55                   	push   %rbp
+  8029d2:	48 89 e5             	mov    %rsp,%rbp
+  8029d5:	41 57                	push   %r15
+  8029d7:	41 56                	push   %r14
+  8029d9:	41 55                	push   %r13
+  8029db:	41 54                	push   %r12
+  8029dd:	53                   	push   %rbx
+  8029de:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e2:	49 89 fc             	mov    %rdi,%r12
+  8029e5:	49 89 f5             	mov    %rsi,%r13
+  8029e8:	48 89 d3             	mov    %rdx,%rbx
+  8029eb:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8029ee:	48 85 f6             	test   %rsi,%rsi
+  8029f1:	0f 84 ff 00 00 00    	je     802af6 <devfile_diff_snapshots+0x12e>
+  8029f7:	48 85 d2             	test   %rdx,%rdx
+  8029fa:	0f 84 fd 00 00 00    	je     802afd <devfile_diff_snapshots+0x135>
+  802a00:	48 85 c9             	test   %rcx,%rcx
+  802a03:	0f 84 f4 00 00 00    	je     802afd <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802a09:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a1b:	0f 87 e3 00 00 00    	ja     802b04 <devfile_diff_snapshots+0x13c>
+  802a21:	4c 89 ef             	mov    %r13,%rdi
+  802a24:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+  802a30:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a36:	0f 87 cf 00 00 00    	ja     802b0b <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a3c:	4c 89 e6             	mov    %r12,%rsi
+  802a3f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a46:	00 00 00 
+  802a49:	4c 89 e7             	mov    %r12,%rdi
+  802a4c:	49 bf 33 0c 80 00 00 	movabs $0x800c33,%r15
+  802a53:	00 00 00 
+  802a56:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802a59:	4c 89 ee             	mov    %r13,%rsi
+  802a5c:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a63:	00 
+  802a64:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a67:	48 8b 03             	mov    (%rbx),%rax
+  802a6a:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a71:	00 
+  802a72:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a76:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a7d:	00 
+  802a7e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a82:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a89:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a8f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a94:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	78 43                	js     802ae7 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802aa4:	49 8b 04 24          	mov    (%r12),%rax
+  802aa8:	48 89 03             	mov    %rax,(%rbx)
+  802aab:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802ab0:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802ab4:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802ab9:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802abd:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802ac2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802ac6:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802aca:	48 c1 e2 03          	shl    $0x3,%rdx
+  802ace:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802ad3:	4c 89 f7             	mov    %r14,%rdi
+  802ad6:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802ae2:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802ae7:	48 83 c4 08          	add    $0x8,%rsp
+  802aeb:	5b                   	pop    %rbx
+  802aec:	41 5c                	pop    %r12
+  802aee:	41 5d                	pop    %r13
+  802af0:	41 5e                	pop    %r14
+  802af2:	41 5f                	pop    %r15
+  802af4:	5d                   	pop    %rbp
+  802af5:	c3                   	ret
+        return -E_INVAL;
+  802af6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802afb:	eb ea                	jmp    802ae7 <devfile_diff_snapshots+0x11f>
+  802afd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b02:	eb e3                	jmp    802ae7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b09:	eb dc                	jmp    802ae7 <devfile_diff_snapshots+0x11f>
+  802b0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b10:	eb d5                	jmp    802ae7 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b17:	c3                   	ret
+
+0000000000802b18 <devfile_delete_snapshot>:
+    if (!name) {
+  802b18:	48 85 ff             	test   %rdi,%rdi
+  802b1b:	74 5f                	je     802b7c <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802b1d:	55                   	push   %rbp
+  802b1e:	48 89 e5             	mov    %rsp,%rbp
+  802b21:	53                   	push   %rbx
+  802b22:	48 83 ec 08          	sub    $0x8,%rsp
+  802b26:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b29:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802b30:	00 00 00 
+  802b33:	ff d0                	call   *%rax
+  802b35:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b3b:	77 45                	ja     802b82 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b3d:	48 89 de             	mov    %rbx,%rsi
+  802b40:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b47:	00 00 00 
+  802b4a:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802b56:	be 00 00 00 00       	mov    $0x0,%esi
+  802b5b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b60:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802b67:	00 00 00 
+  802b6a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b73:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+        return -E_INVAL;
+  802b7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b81:	c3                   	ret
+        return -E_INVAL;
+  802b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b87:	eb ed                	jmp    802b76 <devfile_delete_snapshot+0x5e>
+
+0000000000802b89 <devfile_accept_snapshot>:
+    if (!name) {
+  802b89:	48 85 ff             	test   %rdi,%rdi
+  802b8c:	74 5f                	je     802bed <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	53                   	push   %rbx
+  802b93:	48 83 ec 08          	sub    $0x8,%rsp
+  802b97:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b9a:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bac:	77 45                	ja     802bf3 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802bae:	48 89 de             	mov    %rbx,%rsi
+  802bb1:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802bb8:	00 00 00 
+  802bbb:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bcc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bd1:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+        return -E_INVAL;
+  802bed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bf2:	c3                   	ret
+        return -E_INVAL;
+  802bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf8:	eb ed                	jmp    802be7 <devfile_accept_snapshot+0x5e>
+
+0000000000802bfa <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802bfa:	48 85 ff             	test   %rdi,%rdi
+  802bfd:	0f 84 9f 00 00 00    	je     802ca2 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802c03:	55                   	push   %rbp
+  802c04:	48 89 e5             	mov    %rsp,%rbp
+  802c07:	41 54                	push   %r12
+  802c09:	53                   	push   %rbx
+  802c0a:	48 89 fb             	mov    %rdi,%rbx
+  802c0d:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802c10:	48 85 f6             	test   %rsi,%rsi
+  802c13:	74 78                	je     802c8d <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802c15:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+  802c21:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c27:	77 6b                	ja     802c94 <devfile_create_snapshot+0x9a>
+  802c29:	4c 89 e7             	mov    %r12,%rdi
+  802c2c:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+  802c38:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c3e:	77 5b                	ja     802c9b <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c40:	48 89 de             	mov    %rbx,%rsi
+  802c43:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c4a:	00 00 00 
+  802c4d:	48 bb 33 0c 80 00 00 	movabs $0x800c33,%rbx
+  802c54:	00 00 00 
+  802c57:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802c59:	4c 89 e6             	mov    %r12,%rsi
+  802c5c:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802c63:	00 00 00 
+  802c66:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c68:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c72:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c85:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c88:	5b                   	pop    %rbx
+  802c89:	41 5c                	pop    %r12
+  802c8b:	5d                   	pop    %rbp
+  802c8c:	c3                   	ret
+        return -E_INVAL;
+  802c8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c92:	eb f4                	jmp    802c88 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c99:	eb ed                	jmp    802c88 <devfile_create_snapshot+0x8e>
+  802c9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca0:	eb e6                	jmp    802c88 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802ca2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ca7:	c3                   	ret
+
+0000000000802ca8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ca8:	55                   	push   %rbp
+  802ca9:	48 89 e5             	mov    %rsp,%rbp
+  802cac:	41 54                	push   %r12
+  802cae:	53                   	push   %rbx
+  802caf:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802cb2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802cb5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802cbc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc3:	bf 05 00 00 00       	mov    $0x5,%edi
+  802cc8:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	78 3d                	js     802d15 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802cd8:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802cdf:	00 00 00 
+  802ce2:	4c 89 e6             	mov    %r12,%rsi
+  802ce5:	48 89 df             	mov    %rbx,%rdi
+  802ce8:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  802cef:	00 00 00 
+  802cf2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802cf4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802cfb:	00 
+  802cfc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d02:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802d09:	00 
+  802d0a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d15:	5b                   	pop    %rbx
+  802d16:	41 5c                	pop    %r12
+  802d18:	5d                   	pop    %rbp
+  802d19:	c3                   	ret
+
+0000000000802d1a <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+  802d1e:	41 57                	push   %r15
+  802d20:	41 56                	push   %r14
+  802d22:	41 55                	push   %r13
+  802d24:	41 54                	push   %r12
+  802d26:	53                   	push   %rbx
+  802d27:	48 83 ec 38          	sub    $0x38,%rsp
+  802d2b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802d2f:	49 89 f5             	mov    %rsi,%r13
+  802d32:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d35:	48 89 f0             	mov    %rsi,%rax
+  802d38:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d3d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d41:	75 4f                	jne    802d92 <devfile_readmap+0x78>
+  802d43:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d47:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d4d:	75 1f                	jne    802d6e <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802d4f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d53:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d57:	49 be 02 35 80 00 00 	movabs $0x803502,%r14
+  802d5e:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d61:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d68:	0f 87 9d 00 00 00    	ja     802e0b <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d6e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d72:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d76:	4d 85 ff             	test   %r15,%r15
+  802d79:	0f 85 cf 00 00 00    	jne    802e4e <devfile_readmap+0x134>
+  802d7f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d83:	48 83 c4 38          	add    $0x38,%rsp
+  802d87:	5b                   	pop    %rbx
+  802d88:	41 5c                	pop    %r12
+  802d8a:	41 5d                	pop    %r13
+  802d8c:	41 5e                	pop    %r14
+  802d8e:	41 5f                	pop    %r15
+  802d90:	5d                   	pop    %rbp
+  802d91:	c3                   	ret
+    size_t totalRead = 0;
+  802d92:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d99:	00 
+  802d9a:	eb da                	jmp    802d76 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d9c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802da0:	8b 40 0c             	mov    0xc(%rax),%eax
+  802da3:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802daa:	00 00 00 
+  802dad:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802daf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802db3:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802db7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802dbb:	4c 89 ee             	mov    %r13,%rsi
+  802dbe:	bf 14 00 00 00       	mov    $0x14,%edi
+  802dc3:	48 b8 c8 24 80 00 00 	movabs $0x8024c8,%rax
+  802dca:	00 00 00 
+  802dcd:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	7e a3                	jle    802d76 <devfile_readmap+0x5c>
+  802dd3:	48 98                	cltq
+  802dd5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802dd9:	72 9b                	jb     802d76 <devfile_readmap+0x5c>
+        buf += read;
+  802ddb:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802dde:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802de1:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802de5:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802dec:	75 88                	jne    802d76 <devfile_readmap+0x5c>
+  802dee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802df2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802df8:	0f 85 78 ff ff ff    	jne    802d76 <devfile_readmap+0x5c>
+  802dfe:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802e05:	0f 86 6b ff ff ff    	jbe    802d76 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802e0b:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802e11:	4d 39 e7             	cmp    %r12,%r15
+  802e14:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802e18:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802e1f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e23:	0f 84 73 ff ff ff    	je     802d9c <devfile_readmap+0x82>
+  802e29:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e2d:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802e32:	41 ff d6             	call   *%r14
+  802e35:	a8 40                	test   $0x40,%al
+  802e37:	0f 85 39 ff ff ff    	jne    802d76 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e3d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e44:	4c 39 e3             	cmp    %r12,%rbx
+  802e47:	72 e4                	jb     802e2d <devfile_readmap+0x113>
+  802e49:	e9 4e ff ff ff       	jmp    802d9c <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802e4e:	4c 89 fa             	mov    %r15,%rdx
+  802e51:	4c 89 ee             	mov    %r13,%rsi
+  802e54:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e58:	48 b8 9b 27 80 00 00 	movabs $0x80279b,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e64:	48 85 c0             	test   %rax,%rax
+  802e67:	78 0c                	js     802e75 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e69:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e6d:	48 01 f0             	add    %rsi,%rax
+  802e70:	e9 0e ff ff ff       	jmp    802d83 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e75:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e79:	48 85 f6             	test   %rsi,%rsi
+  802e7c:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e80:	e9 fe fe ff ff       	jmp    802d83 <devfile_readmap+0x69>
+
+0000000000802e85 <open>:
+open(const char *path, int mode) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	41 55                	push   %r13
+  802e8b:	41 54                	push   %r12
+  802e8d:	53                   	push   %rbx
+  802e8e:	48 83 ec 18          	sub    $0x18,%rsp
+  802e92:	49 89 fc             	mov    %rdi,%r12
+  802e95:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e98:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802e9f:	00 00 00 
+  802ea2:	ff d0                	call   *%rax
+  802ea4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802eaa:	0f 87 8a 00 00 00    	ja     802f3a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802eb0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802eb4:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  802ebb:	00 00 00 
+  802ebe:	ff d0                	call   *%rax
+  802ec0:	89 c3                	mov    %eax,%ebx
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	78 50                	js     802f16 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ec6:	4c 89 e6             	mov    %r12,%rsi
+  802ec9:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ed0:	00 00 00 
+  802ed3:	48 89 df             	mov    %rbx,%rdi
+  802ed6:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  802edd:	00 00 00 
+  802ee0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ee2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ee9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802eed:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ef2:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802ef9:	00 00 00 
+  802efc:	ff d0                	call   *%rax
+  802efe:	89 c3                	mov    %eax,%ebx
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 1f                	js     802f23 <open+0x9e>
+    return fd2num(fd);
+  802f04:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f08:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+  802f14:	89 c3                	mov    %eax,%ebx
+}
+  802f16:	89 d8                	mov    %ebx,%eax
+  802f18:	48 83 c4 18          	add    $0x18,%rsp
+  802f1c:	5b                   	pop    %rbx
+  802f1d:	41 5c                	pop    %r12
+  802f1f:	41 5d                	pop    %r13
+  802f21:	5d                   	pop    %rbp
+  802f22:	c3                   	ret
+        fd_close(fd, 0);
+  802f23:	be 00 00 00 00       	mov    $0x0,%esi
+  802f28:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f2c:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+        return res;
+  802f38:	eb dc                	jmp    802f16 <open+0x91>
+        return -E_BAD_PATH;
+  802f3a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f3f:	eb d5                	jmp    802f16 <open+0x91>
+
+0000000000802f41 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f41:	55                   	push   %rbp
+  802f42:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f45:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4a:	bf 13 00 00 00       	mov    $0x13,%edi
+  802f4f:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+}
+  802f5b:	5d                   	pop    %rbp
+  802f5c:	c3                   	ret
+
+0000000000802f5d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f5d:	55                   	push   %rbp
+  802f5e:	48 89 e5             	mov    %rsp,%rbp
+  802f61:	41 54                	push   %r12
+  802f63:	53                   	push   %rbx
+  802f64:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f67:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+  802f73:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f76:	48 be c0 3f 80 00 00 	movabs $0x803fc0,%rsi
+  802f7d:	00 00 00 
+  802f80:	48 89 df             	mov    %rbx,%rdi
+  802f83:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f8f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f94:	41 2b 04 24          	sub    (%r12),%eax
+  802f98:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f9e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802fa5:	00 00 00 
+    stat->st_dev = &devpipe;
+  802fa8:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802faf:	00 00 00 
+  802fb2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbe:	5b                   	pop    %rbx
+  802fbf:	41 5c                	pop    %r12
+  802fc1:	5d                   	pop    %rbp
+  802fc2:	c3                   	ret
+
+0000000000802fc3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802fc3:	55                   	push   %rbp
+  802fc4:	48 89 e5             	mov    %rsp,%rbp
+  802fc7:	41 54                	push   %r12
+  802fc9:	53                   	push   %rbx
+  802fca:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd2:	48 89 fe             	mov    %rdi,%rsi
+  802fd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fda:	49 bc 8b 13 80 00 00 	movabs $0x80138b,%r12
+  802fe1:	00 00 00 
+  802fe4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fe7:	48 89 df             	mov    %rbx,%rdi
+  802fea:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	48 89 c6             	mov    %rax,%rsi
+  802ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ffe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803003:	41 ff d4             	call   *%r12
+}
+  803006:	5b                   	pop    %rbx
+  803007:	41 5c                	pop    %r12
+  803009:	5d                   	pop    %rbp
+  80300a:	c3                   	ret
+
+000000000080300b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80300b:	55                   	push   %rbp
+  80300c:	48 89 e5             	mov    %rsp,%rbp
+  80300f:	41 57                	push   %r15
+  803011:	41 56                	push   %r14
+  803013:	41 55                	push   %r13
+  803015:	41 54                	push   %r12
+  803017:	53                   	push   %rbx
+  803018:	48 83 ec 18          	sub    $0x18,%rsp
+  80301c:	49 89 fc             	mov    %rdi,%r12
+  80301f:	49 89 f5             	mov    %rsi,%r13
+  803022:	49 89 d7             	mov    %rdx,%r15
+  803025:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803029:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  803030:	00 00 00 
+  803033:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803035:	4d 85 ff             	test   %r15,%r15
+  803038:	0f 84 af 00 00 00    	je     8030ed <devpipe_write+0xe2>
+  80303e:	48 89 c3             	mov    %rax,%rbx
+  803041:	4c 89 f8             	mov    %r15,%rax
+  803044:	4d 89 ef             	mov    %r13,%r15
+  803047:	4c 01 e8             	add    %r13,%rax
+  80304a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80304e:	49 bd 93 12 80 00 00 	movabs $0x801293,%r13
+  803055:	00 00 00 
+            sys_yield();
+  803058:	49 be 30 12 80 00 00 	movabs $0x801230,%r14
+  80305f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803062:	8b 73 04             	mov    0x4(%rbx),%esi
+  803065:	48 63 ce             	movslq %esi,%rcx
+  803068:	48 63 03             	movslq (%rbx),%rax
+  80306b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803071:	48 39 c1             	cmp    %rax,%rcx
+  803074:	72 2e                	jb     8030a4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803076:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80307b:	48 89 da             	mov    %rbx,%rdx
+  80307e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803083:	4c 89 e7             	mov    %r12,%rdi
+  803086:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	74 66                	je     8030f3 <devpipe_write+0xe8>
+            sys_yield();
+  80308d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803090:	8b 73 04             	mov    0x4(%rbx),%esi
+  803093:	48 63 ce             	movslq %esi,%rcx
+  803096:	48 63 03             	movslq (%rbx),%rax
+  803099:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80309f:	48 39 c1             	cmp    %rax,%rcx
+  8030a2:	73 d2                	jae    803076 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030a4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8030a8:	48 89 ca             	mov    %rcx,%rdx
+  8030ab:	48 c1 ea 03          	shr    $0x3,%rdx
+  8030af:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8030b6:	08 10 20 
+  8030b9:	48 f7 e2             	mul    %rdx
+  8030bc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030c0:	48 89 d0             	mov    %rdx,%rax
+  8030c3:	48 c1 e0 09          	shl    $0x9,%rax
+  8030c7:	48 29 d0             	sub    %rdx,%rax
+  8030ca:	48 c1 e0 03          	shl    $0x3,%rax
+  8030ce:	48 29 c1             	sub    %rax,%rcx
+  8030d1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030d6:	83 c6 01             	add    $0x1,%esi
+  8030d9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030dc:	49 83 c7 01          	add    $0x1,%r15
+  8030e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e4:	49 39 c7             	cmp    %rax,%r15
+  8030e7:	0f 85 75 ff ff ff    	jne    803062 <devpipe_write+0x57>
+    return n;
+  8030ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030f1:	eb 05                	jmp    8030f8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f8:	48 83 c4 18          	add    $0x18,%rsp
+  8030fc:	5b                   	pop    %rbx
+  8030fd:	41 5c                	pop    %r12
+  8030ff:	41 5d                	pop    %r13
+  803101:	41 5e                	pop    %r14
+  803103:	41 5f                	pop    %r15
+  803105:	5d                   	pop    %rbp
+  803106:	c3                   	ret
+
+0000000000803107 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803107:	55                   	push   %rbp
+  803108:	48 89 e5             	mov    %rsp,%rbp
+  80310b:	41 57                	push   %r15
+  80310d:	41 56                	push   %r14
+  80310f:	41 55                	push   %r13
+  803111:	41 54                	push   %r12
+  803113:	53                   	push   %rbx
+  803114:	48 83 ec 18          	sub    $0x18,%rsp
+  803118:	49 89 fc             	mov    %rdi,%r12
+  80311b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80311f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803123:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+  80312f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803132:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803138:	49 bd 93 12 80 00 00 	movabs $0x801293,%r13
+  80313f:	00 00 00 
+            sys_yield();
+  803142:	49 be 30 12 80 00 00 	movabs $0x801230,%r14
+  803149:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80314c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803151:	74 7d                	je     8031d0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803153:	8b 03                	mov    (%rbx),%eax
+  803155:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803158:	75 26                	jne    803180 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80315a:	4d 85 ff             	test   %r15,%r15
+  80315d:	75 77                	jne    8031d6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80315f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803164:	48 89 da             	mov    %rbx,%rdx
+  803167:	be 00 10 00 00       	mov    $0x1000,%esi
+  80316c:	4c 89 e7             	mov    %r12,%rdi
+  80316f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803172:	85 c0                	test   %eax,%eax
+  803174:	74 72                	je     8031e8 <devpipe_read+0xe1>
+            sys_yield();
+  803176:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803179:	8b 03                	mov    (%rbx),%eax
+  80317b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80317e:	74 df                	je     80315f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803180:	48 63 c8             	movslq %eax,%rcx
+  803183:	48 89 ca             	mov    %rcx,%rdx
+  803186:	48 c1 ea 03          	shr    $0x3,%rdx
+  80318a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803191:	08 10 20 
+  803194:	48 89 d0             	mov    %rdx,%rax
+  803197:	48 f7 e6             	mul    %rsi
+  80319a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80319e:	48 89 d0             	mov    %rdx,%rax
+  8031a1:	48 c1 e0 09          	shl    $0x9,%rax
+  8031a5:	48 29 d0             	sub    %rdx,%rax
+  8031a8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8031af:	00 
+  8031b0:	48 89 c8             	mov    %rcx,%rax
+  8031b3:	48 29 d0             	sub    %rdx,%rax
+  8031b6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8031bb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8031bf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8031c3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8031c6:	49 83 c7 01          	add    $0x1,%r15
+  8031ca:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8031ce:	75 83                	jne    803153 <devpipe_read+0x4c>
+    return n;
+  8031d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d4:	eb 03                	jmp    8031d9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031d6:	4c 89 f8             	mov    %r15,%rax
+}
+  8031d9:	48 83 c4 18          	add    $0x18,%rsp
+  8031dd:	5b                   	pop    %rbx
+  8031de:	41 5c                	pop    %r12
+  8031e0:	41 5d                	pop    %r13
+  8031e2:	41 5e                	pop    %r14
+  8031e4:	41 5f                	pop    %r15
+  8031e6:	5d                   	pop    %rbp
+  8031e7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ed:	eb ea                	jmp    8031d9 <devpipe_read+0xd2>
+
+00000000008031ef <pipe>:
+pipe(int pfd[2]) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+  8031f3:	41 55                	push   %r13
+  8031f5:	41 54                	push   %r12
+  8031f7:	53                   	push   %rbx
+  8031f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8031fc:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031ff:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803203:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	89 c3                	mov    %eax,%ebx
+  803211:	85 c0                	test   %eax,%eax
+  803213:	0f 88 a0 01 00 00    	js     8033b9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803219:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80321e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803223:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322c:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  803233:	00 00 00 
+  803236:	ff d0                	call   *%rax
+  803238:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	0f 88 77 01 00 00    	js     8033b9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803242:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803246:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+  803252:	89 c3                	mov    %eax,%ebx
+  803254:	85 c0                	test   %eax,%eax
+  803256:	0f 88 43 01 00 00    	js     80339f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80325c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803261:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803266:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80326a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326f:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+  80327b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80327d:	85 c0                	test   %eax,%eax
+  80327f:	0f 88 1a 01 00 00    	js     80339f <pipe+0x1b0>
+    va = fd2data(fd0);
+  803285:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803289:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  803290:	00 00 00 
+  803293:	ff d0                	call   *%rax
+  803295:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803298:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80329d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032a2:	48 89 c6             	mov    %rax,%rsi
+  8032a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032aa:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+  8032b6:	89 c3                	mov    %eax,%ebx
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	0f 88 c5 00 00 00    	js     803385 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8032c0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032c4:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  8032cb:	00 00 00 
+  8032ce:	ff d0                	call   *%rax
+  8032d0:	48 89 c1             	mov    %rax,%rcx
+  8032d3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032d9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e4:	4c 89 ee             	mov    %r13,%rsi
+  8032e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ec:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	89 c3                	mov    %eax,%ebx
+  8032fa:	85 c0                	test   %eax,%eax
+  8032fc:	78 6e                	js     80336c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032fe:	be 00 10 00 00       	mov    $0x1000,%esi
+  803303:	4c 89 ef             	mov    %r13,%rdi
+  803306:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  80330d:	00 00 00 
+  803310:	ff d0                	call   *%rax
+  803312:	83 f8 02             	cmp    $0x2,%eax
+  803315:	0f 85 ab 00 00 00    	jne    8033c6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80331b:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803322:	00 00 
+  803324:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803328:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80332a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80332e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803335:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803339:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80333b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80333f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803346:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80334a:	48 bb b5 19 80 00 00 	movabs $0x8019b5,%rbx
+  803351:	00 00 00 
+  803354:	ff d3                	call   *%rbx
+  803356:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80335a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80335e:	ff d3                	call   *%rbx
+  803360:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803365:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80336a:	eb 4d                	jmp    8033b9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80336c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803371:	4c 89 ee             	mov    %r13,%rsi
+  803374:	bf 00 00 00 00       	mov    $0x0,%edi
+  803379:	48 b8 8b 13 80 00 00 	movabs $0x80138b,%rax
+  803380:	00 00 00 
+  803383:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803385:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80338a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80338e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803393:	48 b8 8b 13 80 00 00 	movabs $0x80138b,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80339f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033a4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ad:	48 b8 8b 13 80 00 00 	movabs $0x80138b,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+}
+  8033b9:	89 d8                	mov    %ebx,%eax
+  8033bb:	48 83 c4 18          	add    $0x18,%rsp
+  8033bf:	5b                   	pop    %rbx
+  8033c0:	41 5c                	pop    %r12
+  8033c2:	41 5d                	pop    %r13
+  8033c4:	5d                   	pop    %rbp
+  8033c5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8033c6:	48 b9 f0 3f 80 00 00 	movabs $0x803ff0,%rcx
+  8033cd:	00 00 00 
+  8033d0:	48 ba c7 3f 80 00 00 	movabs $0x803fc7,%rdx
+  8033d7:	00 00 00 
+  8033da:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033df:	48 bf dc 3f 80 00 00 	movabs $0x803fdc,%rdi
+  8033e6:	00 00 00 
+  8033e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ee:	49 b8 46 38 80 00 00 	movabs $0x803846,%r8
+  8033f5:	00 00 00 
+  8033f8:	41 ff d0             	call   *%r8
+
+00000000008033fb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033fb:	55                   	push   %rbp
+  8033fc:	48 89 e5             	mov    %rsp,%rbp
+  8033ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803403:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803407:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803413:	85 c0                	test   %eax,%eax
+  803415:	78 35                	js     80344c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803417:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80341b:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+  803427:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80342a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80342f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803434:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803438:	48 b8 93 12 80 00 00 	movabs $0x801293,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+  803444:	85 c0                	test   %eax,%eax
+  803446:	0f 94 c0             	sete   %al
+  803449:	0f b6 c0             	movzbl %al,%eax
+}
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+
+000000000080344e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80344e:	48 89 f8             	mov    %rdi,%rax
+  803451:	48 c1 e8 27          	shr    $0x27,%rax
+  803455:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80345c:	01 00 00 
+  80345f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803463:	f6 c2 01             	test   $0x1,%dl
+  803466:	74 6d                	je     8034d5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803468:	48 89 f8             	mov    %rdi,%rax
+  80346b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80346f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803476:	01 00 00 
+  803479:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80347d:	f6 c2 01             	test   $0x1,%dl
+  803480:	74 62                	je     8034e4 <get_uvpt_entry+0x96>
+  803482:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803489:	01 00 00 
+  80348c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803490:	f6 c2 80             	test   $0x80,%dl
+  803493:	75 4f                	jne    8034e4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803495:	48 89 f8             	mov    %rdi,%rax
+  803498:	48 c1 e8 15          	shr    $0x15,%rax
+  80349c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034a3:	01 00 00 
+  8034a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034aa:	f6 c2 01             	test   $0x1,%dl
+  8034ad:	74 44                	je     8034f3 <get_uvpt_entry+0xa5>
+  8034af:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034b6:	01 00 00 
+  8034b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034bd:	f6 c2 80             	test   $0x80,%dl
+  8034c0:	75 31                	jne    8034f3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8034c2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8034c6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034cd:	01 00 00 
+  8034d0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034d4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034d5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034dc:	01 00 00 
+  8034df:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034e3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034e4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034eb:	01 00 00 
+  8034ee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034f2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034f3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034fa:	01 00 00 
+  8034fd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803501:	c3                   	ret
+
+0000000000803502 <get_prot>:
+
+int
+get_prot(void *va) {
+  803502:	55                   	push   %rbp
+  803503:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803506:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+  803512:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803515:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80351a:	89 c1                	mov    %eax,%ecx
+  80351c:	83 c9 04             	or     $0x4,%ecx
+  80351f:	f6 c2 01             	test   $0x1,%dl
+  803522:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803525:	89 c1                	mov    %eax,%ecx
+  803527:	83 c9 02             	or     $0x2,%ecx
+  80352a:	f6 c2 02             	test   $0x2,%dl
+  80352d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803530:	89 c1                	mov    %eax,%ecx
+  803532:	83 c9 01             	or     $0x1,%ecx
+  803535:	48 85 d2             	test   %rdx,%rdx
+  803538:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80353b:	89 c1                	mov    %eax,%ecx
+  80353d:	83 c9 40             	or     $0x40,%ecx
+  803540:	f6 c6 04             	test   $0x4,%dh
+  803543:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803546:	5d                   	pop    %rbp
+  803547:	c3                   	ret
+
+0000000000803548 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803548:	55                   	push   %rbp
+  803549:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80354c:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803558:	48 c1 e8 06          	shr    $0x6,%rax
+  80355c:	83 e0 01             	and    $0x1,%eax
+}
+  80355f:	5d                   	pop    %rbp
+  803560:	c3                   	ret
+
+0000000000803561 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803561:	55                   	push   %rbp
+  803562:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803565:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803571:	48 c1 e8 05          	shr    $0x5,%rax
+  803575:	83 e0 01             	and    $0x1,%eax
+}
+  803578:	5d                   	pop    %rbp
+  803579:	c3                   	ret
+
+000000000080357a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80357a:	55                   	push   %rbp
+  80357b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80357e:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  803585:	00 00 00 
+  803588:	ff d0                	call   *%rax
+  80358a:	83 e0 01             	and    $0x1,%eax
+}
+  80358d:	5d                   	pop    %rbp
+  80358e:	c3                   	ret
+
+000000000080358f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80358f:	55                   	push   %rbp
+  803590:	48 89 e5             	mov    %rsp,%rbp
+  803593:	41 57                	push   %r15
+  803595:	41 56                	push   %r14
+  803597:	41 55                	push   %r13
+  803599:	41 54                	push   %r12
+  80359b:	53                   	push   %rbx
+  80359c:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8035a4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8035a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8035ad:	49 bd 7a 35 80 00 00 	movabs $0x80357a,%r13
+  8035b4:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035b7:	49 bf 02 35 80 00 00 	movabs $0x803502,%r15
+  8035be:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8035c1:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8035c8:	00 00 00 
+  8035cb:	eb 0c                	jmp    8035d9 <foreach_shared_region+0x4a>
+  8035cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035d4:	4c 39 f3             	cmp    %r14,%rbx
+  8035d7:	74 2e                	je     803607 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035d9:	48 89 df             	mov    %rbx,%rdi
+  8035dc:	41 ff d5             	call   *%r13
+  8035df:	84 c0                	test   %al,%al
+  8035e1:	74 ea                	je     8035cd <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035e3:	48 89 df             	mov    %rbx,%rdi
+  8035e6:	41 ff d7             	call   *%r15
+  8035e9:	a8 40                	test   $0x40,%al
+  8035eb:	74 e0                	je     8035cd <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035ed:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035f8:	48 89 df             	mov    %rbx,%rdi
+  8035fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035ff:	ff d0                	call   *%rax
+				if (res < 0) {
+  803601:	85 c0                	test   %eax,%eax
+  803603:	79 c8                	jns    8035cd <foreach_shared_region+0x3e>
+  803605:	eb 05                	jmp    80360c <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803607:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80360c:	48 83 c4 18          	add    $0x18,%rsp
+  803610:	5b                   	pop    %rbx
+  803611:	41 5c                	pop    %r12
+  803613:	41 5d                	pop    %r13
+  803615:	41 5e                	pop    %r14
+  803617:	41 5f                	pop    %r15
+  803619:	5d                   	pop    %rbp
+  80361a:	c3                   	ret
+
+000000000080361b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80361b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803620:	c3                   	ret
+
+0000000000803621 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803621:	55                   	push   %rbp
+  803622:	48 89 e5             	mov    %rsp,%rbp
+  803625:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803628:	48 be 14 40 80 00 00 	movabs $0x804014,%rsi
+  80362f:	00 00 00 
+  803632:	48 b8 33 0c 80 00 00 	movabs $0x800c33,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+    return 0;
+}
+  80363e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803643:	5d                   	pop    %rbp
+  803644:	c3                   	ret
+
+0000000000803645 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+  803649:	41 57                	push   %r15
+  80364b:	41 56                	push   %r14
+  80364d:	41 55                	push   %r13
+  80364f:	41 54                	push   %r12
+  803651:	53                   	push   %rbx
+  803652:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803659:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803660:	48 85 d2             	test   %rdx,%rdx
+  803663:	74 7a                	je     8036df <devcons_write+0x9a>
+  803665:	49 89 d6             	mov    %rdx,%r14
+  803668:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80366e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803673:	49 bf 2d 0e 80 00 00 	movabs $0x800e2d,%r15
+  80367a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80367d:	4c 89 f3             	mov    %r14,%rbx
+  803680:	48 29 f3             	sub    %rsi,%rbx
+  803683:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803688:	48 39 c3             	cmp    %rax,%rbx
+  80368b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80368f:	4c 63 eb             	movslq %ebx,%r13
+  803692:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803699:	48 01 c6             	add    %rax,%rsi
+  80369c:	4c 89 ea             	mov    %r13,%rdx
+  80369f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8036a6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8036a9:	4c 89 ee             	mov    %r13,%rsi
+  8036ac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8036b3:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8036bf:	41 01 dc             	add    %ebx,%r12d
+  8036c2:	49 63 f4             	movslq %r12d,%rsi
+  8036c5:	4c 39 f6             	cmp    %r14,%rsi
+  8036c8:	72 b3                	jb     80367d <devcons_write+0x38>
+    return res;
+  8036ca:	49 63 c4             	movslq %r12d,%rax
+}
+  8036cd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8036d4:	5b                   	pop    %rbx
+  8036d5:	41 5c                	pop    %r12
+  8036d7:	41 5d                	pop    %r13
+  8036d9:	41 5e                	pop    %r14
+  8036db:	41 5f                	pop    %r15
+  8036dd:	5d                   	pop    %rbp
+  8036de:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036df:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036e5:	eb e3                	jmp    8036ca <devcons_write+0x85>
+
+00000000008036e7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036e7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036ef:	48 85 c0             	test   %rax,%rax
+  8036f2:	74 55                	je     803749 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036f4:	55                   	push   %rbp
+  8036f5:	48 89 e5             	mov    %rsp,%rbp
+  8036f8:	41 55                	push   %r13
+  8036fa:	41 54                	push   %r12
+  8036fc:	53                   	push   %rbx
+  8036fd:	48 83 ec 08          	sub    $0x8,%rsp
+  803701:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803704:	48 bb 63 11 80 00 00 	movabs $0x801163,%rbx
+  80370b:	00 00 00 
+  80370e:	49 bc 30 12 80 00 00 	movabs $0x801230,%r12
+  803715:	00 00 00 
+  803718:	eb 03                	jmp    80371d <devcons_read+0x36>
+  80371a:	41 ff d4             	call   *%r12
+  80371d:	ff d3                	call   *%rbx
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	74 f7                	je     80371a <devcons_read+0x33>
+    if (c < 0) return c;
+  803723:	48 63 d0             	movslq %eax,%rdx
+  803726:	78 13                	js     80373b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372d:	83 f8 04             	cmp    $0x4,%eax
+  803730:	74 09                	je     80373b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803732:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803736:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80373b:	48 89 d0             	mov    %rdx,%rax
+  80373e:	48 83 c4 08          	add    $0x8,%rsp
+  803742:	5b                   	pop    %rbx
+  803743:	41 5c                	pop    %r12
+  803745:	41 5d                	pop    %r13
+  803747:	5d                   	pop    %rbp
+  803748:	c3                   	ret
+  803749:	48 89 d0             	mov    %rdx,%rax
+  80374c:	c3                   	ret
+
+000000000080374d <cputchar>:
+cputchar(int ch) {
+  80374d:	55                   	push   %rbp
+  80374e:	48 89 e5             	mov    %rsp,%rbp
+  803751:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803755:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803759:	be 01 00 00 00       	mov    $0x1,%esi
+  80375e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803762:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+}
+  80376e:	c9                   	leave
+  80376f:	c3                   	ret
+
+0000000000803770 <getchar>:
+getchar(void) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+  803774:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803778:	ba 01 00 00 00       	mov    $0x1,%edx
+  80377d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803781:	bf 00 00 00 00       	mov    $0x0,%edi
+  803786:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+  803792:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803794:	85 c0                	test   %eax,%eax
+  803796:	78 06                	js     80379e <getchar+0x2e>
+  803798:	74 08                	je     8037a2 <getchar+0x32>
+  80379a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80379e:	89 d0                	mov    %edx,%eax
+  8037a0:	c9                   	leave
+  8037a1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8037a2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8037a7:	eb f5                	jmp    80379e <getchar+0x2e>
+
+00000000008037a9 <iscons>:
+iscons(int fdnum) {
+  8037a9:	55                   	push   %rbp
+  8037aa:	48 89 e5             	mov    %rsp,%rbp
+  8037ad:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8037b1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037b5:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  8037bc:	00 00 00 
+  8037bf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037c1:	85 c0                	test   %eax,%eax
+  8037c3:	78 18                	js     8037dd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8037c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037c9:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8037d0:	00 00 00 
+  8037d3:	8b 00                	mov    (%rax),%eax
+  8037d5:	39 02                	cmp    %eax,(%rdx)
+  8037d7:	0f 94 c0             	sete   %al
+  8037da:	0f b6 c0             	movzbl %al,%eax
+}
+  8037dd:	c9                   	leave
+  8037de:	c3                   	ret
+
+00000000008037df <opencons>:
+opencons(void) {
+  8037df:	55                   	push   %rbp
+  8037e0:	48 89 e5             	mov    %rsp,%rbp
+  8037e3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037e7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037eb:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+  8037f7:	85 c0                	test   %eax,%eax
+  8037f9:	78 49                	js     803844 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037fb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803800:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803805:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803809:	bf 00 00 00 00       	mov    $0x0,%edi
+  80380e:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  803815:	00 00 00 
+  803818:	ff d0                	call   *%rax
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	78 26                	js     803844 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80381e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803822:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803829:	00 00 
+  80382b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80382d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803831:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803838:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+}
+  803844:	c9                   	leave
+  803845:	c3                   	ret
+
+0000000000803846 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803846:	55                   	push   %rbp
+  803847:	48 89 e5             	mov    %rsp,%rbp
+  80384a:	41 56                	push   %r14
+  80384c:	41 55                	push   %r13
+  80384e:	41 54                	push   %r12
+  803850:	53                   	push   %rbx
+  803851:	48 83 ec 50          	sub    $0x50,%rsp
+  803855:	49 89 fc             	mov    %rdi,%r12
+  803858:	41 89 f5             	mov    %esi,%r13d
+  80385b:	48 89 d3             	mov    %rdx,%rbx
+  80385e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803862:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803866:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80386a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803871:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803875:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803879:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80387d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803881:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803888:	00 00 00 
+  80388b:	4c 8b 30             	mov    (%rax),%r14
+  80388e:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  803895:	00 00 00 
+  803898:	ff d0                	call   *%rax
+  80389a:	89 c6                	mov    %eax,%esi
+  80389c:	45 89 e8             	mov    %r13d,%r8d
+  80389f:	4c 89 e1             	mov    %r12,%rcx
+  8038a2:	4c 89 f2             	mov    %r14,%rdx
+  8038a5:	48 bf 20 40 80 00 00 	movabs $0x804020,%rdi
+  8038ac:	00 00 00 
+  8038af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b4:	49 bc 0e 03 80 00 00 	movabs $0x80030e,%r12
+  8038bb:	00 00 00 
+  8038be:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8038c1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8038c5:	48 89 df             	mov    %rbx,%rdi
+  8038c8:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  8038cf:	00 00 00 
+  8038d2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8038d4:	48 bf 7b 3f 80 00 00 	movabs $0x803f7b,%rdi
+  8038db:	00 00 00 
+  8038de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8038e6:	cc                   	int3
+  8038e7:	eb fd                	jmp    8038e6 <_panic+0xa0>
+  8038e9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008038f0 <__rodata_start>:
+  8038f0:	69 20 61 6d 20 25    	imul   $0x25206d61,(%rax),%esp
+  8038f6:	30 38                	xor    %bh,(%rax)
+  8038f8:	78 3b                	js     803935 <__rodata_start+0x45>
+  8038fa:	20 74 68 69          	and    %dh,0x69(%rax,%rbp,2)
+  8038fe:	73 65                	jae    803965 <__rodata_start+0x75>
+  803900:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803901:	76 20                	jbe    803923 <__rodata_start+0x33>
+  803903:	69 73 20 25 70 0a 00 	imul   $0xa7025,0x20(%rbx),%esi
+  80390a:	73 65                	jae    803971 <__rodata_start+0x81>
+  80390c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80390d:	64 20 30             	and    %dh,%fs:(%rax)
+  803910:	20 66 72             	and    %ah,0x72(%rsi)
+  803913:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803914:	6d                   	insl   (%dx),%es:(%rdi)
+  803915:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff45993 <__bss_end+0x6f73c993>
+  80391b:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25804399 <__bss_end+0x24ffb399>
+  803921:	78 20                	js     803943 <__rodata_start+0x53>
+  803923:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803925:	74 20                	je     803947 <__rodata_start+0x57>
+  803927:	25 64 20 66 72       	and    $0x72662064,%eax
+  80392c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80392d:	6d                   	insl   (%dx),%es:(%rdi)
+  80392e:	20 25 78 20 28 74    	and    %ah,0x74282078(%rip)        # 74a859ac <__bss_end+0x7427c9ac>
+  803934:	68 69 73 65 6e       	push   $0x6e657369
+  803939:	76 20                	jbe    80395b <__rodata_start+0x6b>
+  80393b:	69 73 20 25 70 20 25 	imul   $0x25207025,0x20(%rbx),%esi
+  803942:	78 29                	js     80396d <__rodata_start+0x7d>
+  803944:	0a 00                	or     (%rax),%al
+  803946:	3c 75                	cmp    $0x75,%al
+  803948:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803949:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80394d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80394e:	3e 00 30             	ds add %dh,(%rax)
+  803951:	31 32                	xor    %esi,(%rdx)
+  803953:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80395a:	41                   	rex.B
+  80395b:	42                   	rex.X
+  80395c:	43                   	rex.XB
+  80395d:	44                   	rex.R
+  80395e:	45                   	rex.RB
+  80395f:	46 00 30             	rex.RX add %r14b,(%rax)
+  803962:	31 32                	xor    %esi,(%rdx)
+  803964:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80396b:	61                   	(bad)
+  80396c:	62 63 64 65 66       	(bad)
+  803971:	00 28                	add    %ch,(%rax)
+  803973:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803974:	75 6c                	jne    8039e2 <__rodata_start+0xf2>
+  803976:	6c                   	insb   (%dx),%es:(%rdi)
+  803977:	29 00                	sub    %eax,(%rax)
+  803979:	65 72 72             	gs jb  8039ee <__rodata_start+0xfe>
+  80397c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80397d:	72 20                	jb     80399f <__rodata_start+0xaf>
+  80397f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803984:	73 70                	jae    8039f6 <__rodata_start+0x106>
+  803986:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80398a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803991:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803992:	72 00                	jb     803994 <__rodata_start+0xa4>
+  803994:	62 61 64 20 65       	(bad)
+  803999:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80399a:	76 69                	jbe    803a05 <__rodata_start+0x115>
+  80399c:	72 6f                	jb     803a0d <__rodata_start+0x11d>
+  80399e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80399f:	6d                   	insl   (%dx),%es:(%rdi)
+  8039a0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039a2:	74 00                	je     8039a4 <__rodata_start+0xb4>
+  8039a4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8039ab:	20 70 61             	and    %dh,0x61(%rax)
+  8039ae:	72 61                	jb     803a11 <__rodata_start+0x121>
+  8039b0:	6d                   	insl   (%dx),%es:(%rdi)
+  8039b1:	65 74 65             	gs je  803a19 <__rodata_start+0x129>
+  8039b4:	72 00                	jb     8039b6 <__rodata_start+0xc6>
+  8039b6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b7:	75 74                	jne    803a2d <__rodata_start+0x13d>
+  8039b9:	20 6f 66             	and    %ch,0x66(%rdi)
+  8039bc:	20 6d 65             	and    %ch,0x65(%rbp)
+  8039bf:	6d                   	insl   (%dx),%es:(%rdi)
+  8039c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c1:	72 79                	jb     803a3c <__rodata_start+0x14c>
+  8039c3:	00 6f 75             	add    %ch,0x75(%rdi)
+  8039c6:	74 20                	je     8039e8 <__rodata_start+0xf8>
+  8039c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c9:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8039cd:	76 69                	jbe    803a38 <__rodata_start+0x148>
+  8039cf:	72 6f                	jb     803a40 <__rodata_start+0x150>
+  8039d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039d2:	6d                   	insl   (%dx),%es:(%rdi)
+  8039d3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039d5:	74 73                	je     803a4a <__rodata_start+0x15a>
+  8039d7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8039da:	72 72                	jb     803a4e <__rodata_start+0x15e>
+  8039dc:	75 70                	jne    803a4e <__rodata_start+0x15e>
+  8039de:	74 65                	je     803a45 <__rodata_start+0x155>
+  8039e0:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8039e5:	75 67                	jne    803a4e <__rodata_start+0x15e>
+  8039e7:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8039ea:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039ec:	00 73 65             	add    %dh,0x65(%rbx)
+  8039ef:	67 6d                	insl   (%dx),%es:(%edi)
+  8039f1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039f3:	74 61                	je     803a56 <__rodata_start+0x166>
+  8039f5:	74 69                	je     803a60 <__rodata_start+0x170>
+  8039f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039f8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039f9:	20 66 61             	and    %ah,0x61(%rsi)
+  8039fc:	75 6c                	jne    803a6a <__rodata_start+0x17a>
+  8039fe:	74 00                	je     803a00 <__rodata_start+0x110>
+  803a00:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803a07:	20 45 4c             	and    %al,0x4c(%rbp)
+  803a0a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803a0e:	61                   	(bad)
+  803a0f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803a14:	20 73 75             	and    %dh,0x75(%rbx)
+  803a17:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803a1a:	73 79                	jae    803a95 <__rodata_start+0x1a5>
+  803a1c:	73 74                	jae    803a92 <__rodata_start+0x1a2>
+  803a1e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a20:	20 63 61             	and    %ah,0x61(%rbx)
+  803a23:	6c                   	insb   (%dx),%es:(%rdi)
+  803a24:	6c                   	insb   (%dx),%es:(%rdi)
+  803a25:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803a28:	74 72                	je     803a9c <__rodata_start+0x1ac>
+  803a2a:	79 20                	jns    803a4c <__rodata_start+0x15c>
+  803a2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a2e:	74 20                	je     803a50 <__rodata_start+0x160>
+  803a30:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a32:	75 6e                	jne    803aa2 <__rodata_start+0x1b2>
+  803a34:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803a38:	76 20                	jbe    803a5a <__rodata_start+0x16a>
+  803a3a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803a41:	72 65                	jb     803aa8 <__rodata_start+0x1b8>
+  803a43:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803a46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a47:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803a4b:	65 78 70             	gs js  803abe <__rodata_start+0x1ce>
+  803a4e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803a53:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803a56:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803a5a:	20 66 69             	and    %ah,0x69(%rsi)
+  803a5d:	6c                   	insb   (%dx),%es:(%rdi)
+  803a5e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803a62:	20 66 72             	and    %ah,0x72(%rsi)
+  803a65:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803a6a:	61                   	(bad)
+  803a6b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803a6e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a70:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803a74:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803a77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a79:	20 6d 61             	and    %ch,0x61(%rbp)
+  803a7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a7d:	79 20                	jns    803a9f <__rodata_start+0x1af>
+  803a7f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803a86:	72 65                	jb     803aed <__rodata_start+0x1fd>
+  803a88:	20 6f 70             	and    %ch,0x70(%rdi)
+  803a8b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a8d:	00 66 69             	add    %ah,0x69(%rsi)
+  803a90:	6c                   	insb   (%dx),%es:(%rdi)
+  803a91:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a95:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a99:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a9d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a9e:	74 20                	je     803ac0 <__rodata_start+0x1d0>
+  803aa0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803aa2:	75 6e                	jne    803b12 <__rodata_start+0x222>
+  803aa4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803aa8:	76 61                	jbe    803b0b <__rodata_start+0x21b>
+  803aaa:	6c                   	insb   (%dx),%es:(%rdi)
+  803aab:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ab2:	00 
+  803ab3:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803aba:	72 65                	jb     803b21 <__rodata_start+0x231>
+  803abc:	61                   	(bad)
+  803abd:	64 79 20             	fs jns 803ae0 <__rodata_start+0x1f0>
+  803ac0:	65 78 69             	gs js  803b2c <__rodata_start+0x23c>
+  803ac3:	73 74                	jae    803b39 <__rodata_start+0x249>
+  803ac5:	73 00                	jae    803ac7 <__rodata_start+0x1d7>
+  803ac7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ac8:	70 65                	jo     803b2f <__rodata_start+0x23f>
+  803aca:	72 61                	jb     803b2d <__rodata_start+0x23d>
+  803acc:	74 69                	je     803b37 <__rodata_start+0x247>
+  803ace:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ad0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803ad3:	74 20                	je     803af5 <__rodata_start+0x205>
+  803ad5:	73 75                	jae    803b4c <__rodata_start+0x25c>
+  803ad7:	70 70                	jo     803b49 <__rodata_start+0x259>
+  803ad9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ada:	72 74                	jb     803b50 <__rodata_start+0x260>
+  803adc:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803ae2:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803ae7:	74 00                	je     803ae9 <__rodata_start+0x1f9>
+  803ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803af0:	00 00 00 
+  803af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803afa:	00 00 00 
+  803afd:	0f 1f 00             	nopl   (%rax)
+  803b00:	fb                   	sti
+  803b01:	04 80                	add    $0x80,%al
+  803b03:	00 00                	add    %al,(%rax)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 2c 0b             	add    %ch,(%rbx,%rcx,1)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b1a:	80 00 00             	addb   $0x0,(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b22:	80 00 00             	addb   $0x0,(%rax)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b2a:	80 00 00             	addb   $0x0,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b32:	80 00 00             	addb   $0x0,(%rax)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 1a                	add    %bl,(%rdx)
+  803b39:	05 80 00 00 00       	add    $0x80,%eax
+  803b3e:	00 00                	add    %al,(%rax)
+  803b40:	3c 0b                	cmp    $0xb,%al
+  803b42:	80 00 00             	addb   $0x0,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803b4a:	80 00 00             	addb   $0x0,(%rax)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 0e                	add    %cl,(%rsi)
+  803b51:	05 80 00 00 00       	add    $0x80,%eax
+  803b56:	00 00                	add    %al,(%rax)
+  803b58:	88 05 80 00 00 00    	mov    %al,0x80(%rip)        # 803bde <__rodata_start+0x2ee>
+  803b5e:	00 00                	add    %al,(%rax)
+  803b60:	3c 0b                	cmp    $0xb,%al
+  803b62:	80 00 00             	addb   $0x0,(%rax)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 0e                	add    %cl,(%rsi)
+  803b69:	05 80 00 00 00       	add    $0x80,%eax
+  803b6e:	00 00                	add    %al,(%rax)
+  803b70:	54                   	push   %rsp
+  803b71:	05 80 00 00 00       	add    $0x80,%eax
+  803b76:	00 00                	add    %al,(%rax)
+  803b78:	54                   	push   %rsp
+  803b79:	05 80 00 00 00       	add    $0x80,%eax
+  803b7e:	00 00                	add    %al,(%rax)
+  803b80:	54                   	push   %rsp
+  803b81:	05 80 00 00 00       	add    $0x80,%eax
+  803b86:	00 00                	add    %al,(%rax)
+  803b88:	54                   	push   %rsp
+  803b89:	05 80 00 00 00       	add    $0x80,%eax
+  803b8e:	00 00                	add    %al,(%rax)
+  803b90:	54                   	push   %rsp
+  803b91:	05 80 00 00 00       	add    $0x80,%eax
+  803b96:	00 00                	add    %al,(%rax)
+  803b98:	54                   	push   %rsp
+  803b99:	05 80 00 00 00       	add    $0x80,%eax
+  803b9e:	00 00                	add    %al,(%rax)
+  803ba0:	54                   	push   %rsp
+  803ba1:	05 80 00 00 00       	add    $0x80,%eax
+  803ba6:	00 00                	add    %al,(%rax)
+  803ba8:	54                   	push   %rsp
+  803ba9:	05 80 00 00 00       	add    $0x80,%eax
+  803bae:	00 00                	add    %al,(%rax)
+  803bb0:	54                   	push   %rsp
+  803bb1:	05 80 00 00 00       	add    $0x80,%eax
+  803bb6:	00 00                	add    %al,(%rax)
+  803bb8:	3c 0b                	cmp    $0xb,%al
+  803bba:	80 00 00             	addb   $0x0,(%rax)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bca:	80 00 00             	addb   $0x0,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bd2:	80 00 00             	addb   $0x0,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bda:	80 00 00             	addb   $0x0,(%rax)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803be2:	80 00 00             	addb   $0x0,(%rax)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bea:	80 00 00             	addb   $0x0,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bf2:	80 00 00             	addb   $0x0,(%rax)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803bfa:	80 00 00             	addb   $0x0,(%rax)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c02:	80 00 00             	addb   $0x0,(%rax)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c0a:	80 00 00             	addb   $0x0,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c12:	80 00 00             	addb   $0x0,(%rax)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c1a:	80 00 00             	addb   $0x0,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c22:	80 00 00             	addb   $0x0,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c2a:	80 00 00             	addb   $0x0,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c3a:	80 00 00             	addb   $0x0,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c52:	80 00 00             	addb   $0x0,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c62:	80 00 00             	addb   $0x0,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c6a:	80 00 00             	addb   $0x0,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c7a:	80 00 00             	addb   $0x0,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c92:	80 00 00             	addb   $0x0,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803ca2:	80 00 00             	addb   $0x0,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 5f 0a             	add    %bl,0xa(%rdi)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cda:	80 00 00             	addb   $0x0,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 ab 05 80 00 00    	add    %ch,0x8005(%rbx)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 7a 07             	add    %bh,0x7(%rdx)
+  803d0a:	80 00 00             	addb   $0x0,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d22:	80 00 00             	addb   $0x0,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 da                	add    %bl,%dl
+  803d31:	05 80 00 00 00       	add    $0x80,%eax
+  803d36:	00 00                	add    %al,(%rax)
+  803d38:	3c 0b                	cmp    $0xb,%al
+  803d3a:	80 00 00             	addb   $0x0,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d42:	80 00 00             	addb   $0x0,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 a0 05 80 00 00    	add    %ah,0x8005(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d52:	80 00 00             	addb   $0x0,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d5a:	80 00 00             	addb   $0x0,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 22                	add    %ah,(%rdx)
+  803d61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803d67:	00 ec                	add    %ch,%ah
+  803d69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803d6f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d72:	80 00 00             	addb   $0x0,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 71 06             	add    %dh,0x6(%rcx)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 4e 08             	add    %cl,0x8(%rsi)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 5f 0a             	add    %bl,0xa(%rdi)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 3c 0b             	add    %bh,(%rbx,%rcx,1)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 04 05 80 00 00 00 	add    %al,0x80(,%rax,1)
+	...
+
+0000000000803dc0 <error_string>:
+	...
+  803dc8:	82 39 80 00 00 00 00 00 94 39 80 00 00 00 00 00     .9.......9......
+  803dd8:	a4 39 80 00 00 00 00 00 b6 39 80 00 00 00 00 00     .9.......9......
+  803de8:	c4 39 80 00 00 00 00 00 d8 39 80 00 00 00 00 00     .9.......9......
+  803df8:	ed 39 80 00 00 00 00 00 00 3a 80 00 00 00 00 00     .9.......:......
+  803e08:	12 3a 80 00 00 00 00 00 26 3a 80 00 00 00 00 00     .:......&:......
+  803e18:	36 3a 80 00 00 00 00 00 49 3a 80 00 00 00 00 00     6:......I:......
+  803e28:	60 3a 80 00 00 00 00 00 76 3a 80 00 00 00 00 00     `:......v:......
+  803e38:	8e 3a 80 00 00 00 00 00 a6 3a 80 00 00 00 00 00     .:.......:......
+  803e48:	b3 3a 80 00 00 00 00 00 68 3e 80 00 00 00 00 00     .:......h>......
+  803e58:	c7 3a 80 00 00 00 00 00 df 3a 80 00 00 00 00 00     .:.......:......
+  803e68:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803e78:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803e88:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803e98:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803ea8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803eb8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803ec8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803ed8:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  803ee8:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803ef8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  803f08:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803f18:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803f28:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803f38:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803f48:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803f58:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803f68:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803f78:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803f88:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803f98:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803fa0 <devtab>:
+  803fa0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  803fb0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  803fc0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803fd0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803fe0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803ff0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804000:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804010:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804020:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804030:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804040:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  804050:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804060:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804070:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804080:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804090:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8040a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8040b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8040c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8040d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8040e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8040f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804100:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804110:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804120:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804130:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804140:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804150:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804160:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804170:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804180:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804190:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804200:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804210:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804220:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804230:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804240:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804250:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804260:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804270:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804280:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804290:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804300:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804310:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804320:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804330:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804340:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804350:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804360:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804370:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804380:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804390:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
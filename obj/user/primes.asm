@@ -0,0 +1,7083 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf 23 19 80 00 00 	movabs $0x801923,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be ac 03 80 00 00 	movabs $0x8003ac,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd 2d 17 80 00 00 	movabs $0x80172d,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf e8 38 80 00 00 	movabs $0x8038e8,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd 23 19 80 00 00 	movabs $0x801923,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be 3b 19 80 00 00 	movabs $0x80193b,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba ec 38 80 00 00 	movabs $0x8038ec,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf f5 38 80 00 00 	movabs $0x8038f5,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 5c 02 80 00 00 	movabs $0x80025c,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 2d 17 80 00 00 	movabs $0x80172d,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd 3b 19 80 00 00 	movabs $0x80193b,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba ec 38 80 00 00 	movabs $0x8038ec,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf f5 38 80 00 00 	movabs $0x8038f5,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 5c 02 80 00 00 	movabs $0x80025c,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	41 89 fd             	mov    %edi,%r13d
+  800199:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019c:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  8001a3:	00 00 00 
+  8001a6:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 39 c2             	cmp    %rax,%rdx
+  8001b3:	73 17                	jae    8001cc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b8:	49 89 c4             	mov    %rax,%r12
+  8001bb:	48 83 c3 08          	add    $0x8,%rbx
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ca:	72 ef                	jb     8001bb <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001cc:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001dd:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001e1:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001e5:	48 c1 e0 04          	shl    $0x4,%rax
+  8001e9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f0:	00 00 00 
+  8001f3:	48 01 d0             	add    %rdx,%rax
+  8001f6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001fd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800200:	45 85 ed             	test   %r13d,%r13d
+  800203:	7e 0d                	jle    800212 <libmain+0x87>
+  800205:	49 8b 06             	mov    (%r14),%rax
+  800208:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80020f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800212:	4c 89 f6             	mov    %r14,%rsi
+  800215:	44 89 ef             	mov    %r13d,%edi
+  800218:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  80021f:	00 00 00 
+  800222:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800224:	48 b8 39 02 80 00 00 	movabs $0x800239,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+#endif
+}
+  800230:	5b                   	pop    %rbx
+  800231:	41 5c                	pop    %r12
+  800233:	41 5d                	pop    %r13
+  800235:	41 5e                	pop    %r14
+  800237:	5d                   	pop    %rbp
+  800238:	c3                   	ret
+
+0000000000800239 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800239:	55                   	push   %rbp
+  80023a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80023d:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80024e:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+}
+  80025a:	5d                   	pop    %rbp
+  80025b:	c3                   	ret
+
+000000000080025c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80025c:	55                   	push   %rbp
+  80025d:	48 89 e5             	mov    %rsp,%rbp
+  800260:	41 56                	push   %r14
+  800262:	41 55                	push   %r13
+  800264:	41 54                	push   %r12
+  800266:	53                   	push   %rbx
+  800267:	48 83 ec 50          	sub    $0x50,%rsp
+  80026b:	49 89 fc             	mov    %rdi,%r12
+  80026e:	41 89 f5             	mov    %esi,%r13d
+  800271:	48 89 d3             	mov    %rdx,%rbx
+  800274:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800278:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80027c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800280:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800287:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80028f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800293:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800297:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80029e:	00 00 00 
+  8002a1:	4c 8b 30             	mov    (%rax),%r14
+  8002a4:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  8002ab:	00 00 00 
+  8002ae:	ff d0                	call   *%rax
+  8002b0:	89 c6                	mov    %eax,%esi
+  8002b2:	45 89 e8             	mov    %r13d,%r8d
+  8002b5:	4c 89 e1             	mov    %r12,%rcx
+  8002b8:	4c 89 f2             	mov    %r14,%rdx
+  8002bb:	48 bf 10 39 80 00 00 	movabs $0x803910,%rdi
+  8002c2:	00 00 00 
+  8002c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ca:	49 bc ac 03 80 00 00 	movabs $0x8003ac,%r12
+  8002d1:	00 00 00 
+  8002d4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002d7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002db:	48 89 df             	mov    %rbx,%rdi
+  8002de:	48 b8 48 03 80 00 00 	movabs $0x800348,%rax
+  8002e5:	00 00 00 
+  8002e8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002ea:	48 bf 5b 3f 80 00 00 	movabs $0x803f5b,%rdi
+  8002f1:	00 00 00 
+  8002f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002fc:	cc                   	int3
+  8002fd:	eb fd                	jmp    8002fc <_panic+0xa0>
+
+00000000008002ff <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	53                   	push   %rbx
+  800304:	48 83 ec 08          	sub    $0x8,%rsp
+  800308:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80030b:	8b 06                	mov    (%rsi),%eax
+  80030d:	8d 50 01             	lea    0x1(%rax),%edx
+  800310:	89 16                	mov    %edx,(%rsi)
+  800312:	48 98                	cltq
+  800314:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800319:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80031f:	74 0a                	je     80032b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800321:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800325:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80032b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80032f:	be ff 00 00 00       	mov    $0xff,%esi
+  800334:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  80033b:	00 00 00 
+  80033e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800340:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800346:	eb d9                	jmp    800321 <putch+0x22>
+
+0000000000800348 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800353:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800356:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80035d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800362:	b8 00 00 00 00       	mov    $0x0,%eax
+  800367:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80036a:	48 89 f1             	mov    %rsi,%rcx
+  80036d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800374:	48 bf ff 02 80 00 00 	movabs $0x8002ff,%rdi
+  80037b:	00 00 00 
+  80037e:	48 b8 fc 04 80 00 00 	movabs $0x8004fc,%rax
+  800385:	00 00 00 
+  800388:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80038a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800391:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800398:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003a4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+
+00000000008003ac <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003ac:	55                   	push   %rbp
+  8003ad:	48 89 e5             	mov    %rsp,%rbp
+  8003b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003b8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003bc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003c4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003c8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003db:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003df:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003e3:	48 b8 48 03 80 00 00 	movabs $0x800348,%rax
+  8003ea:	00 00 00 
+  8003ed:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003ef:	c9                   	leave
+  8003f0:	c3                   	ret
+
+00000000008003f1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003f1:	55                   	push   %rbp
+  8003f2:	48 89 e5             	mov    %rsp,%rbp
+  8003f5:	41 57                	push   %r15
+  8003f7:	41 56                	push   %r14
+  8003f9:	41 55                	push   %r13
+  8003fb:	41 54                	push   %r12
+  8003fd:	53                   	push   %rbx
+  8003fe:	48 83 ec 18          	sub    $0x18,%rsp
+  800402:	49 89 fc             	mov    %rdi,%r12
+  800405:	49 89 f5             	mov    %rsi,%r13
+  800408:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80040c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80040f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800412:	41 89 cf             	mov    %ecx,%r15d
+  800415:	4c 39 fa             	cmp    %r15,%rdx
+  800418:	73 5b                	jae    800475 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80041a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80041e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800422:	85 db                	test   %ebx,%ebx
+  800424:	7e 0e                	jle    800434 <print_num+0x43>
+            putch(padc, put_arg);
+  800426:	4c 89 ee             	mov    %r13,%rsi
+  800429:	44 89 f7             	mov    %r14d,%edi
+  80042c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80042f:	83 eb 01             	sub    $0x1,%ebx
+  800432:	75 f2                	jne    800426 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800434:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800438:	48 b9 44 39 80 00 00 	movabs $0x803944,%rcx
+  80043f:	00 00 00 
+  800442:	48 b8 33 39 80 00 00 	movabs $0x803933,%rax
+  800449:	00 00 00 
+  80044c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800450:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800454:	ba 00 00 00 00       	mov    $0x0,%edx
+  800459:	49 f7 f7             	div    %r15
+  80045c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800460:	4c 89 ee             	mov    %r13,%rsi
+  800463:	41 ff d4             	call   *%r12
+}
+  800466:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80046a:	5b                   	pop    %rbx
+  80046b:	41 5c                	pop    %r12
+  80046d:	41 5d                	pop    %r13
+  80046f:	41 5e                	pop    %r14
+  800471:	41 5f                	pop    %r15
+  800473:	5d                   	pop    %rbp
+  800474:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800475:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047e:	49 f7 f7             	div    %r15
+  800481:	48 83 ec 08          	sub    $0x8,%rsp
+  800485:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800489:	52                   	push   %rdx
+  80048a:	45 0f be c9          	movsbl %r9b,%r9d
+  80048e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800492:	48 89 c2             	mov    %rax,%rdx
+  800495:	48 b8 f1 03 80 00 00 	movabs $0x8003f1,%rax
+  80049c:	00 00 00 
+  80049f:	ff d0                	call   *%rax
+  8004a1:	48 83 c4 10          	add    $0x10,%rsp
+  8004a5:	eb 8d                	jmp    800434 <print_num+0x43>
+
+00000000008004a7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004a7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004ab:	48 8b 06             	mov    (%rsi),%rax
+  8004ae:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004b2:	73 0a                	jae    8004be <sprintputch+0x17>
+        *state->start++ = ch;
+  8004b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b8:	48 89 16             	mov    %rdx,(%rsi)
+  8004bb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004be:	c3                   	ret
+
+00000000008004bf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004bf:	55                   	push   %rbp
+  8004c0:	48 89 e5             	mov    %rsp,%rbp
+  8004c3:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004cb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004cf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004d3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004ea:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004ee:	48 b8 fc 04 80 00 00 	movabs $0x8004fc,%rax
+  8004f5:	00 00 00 
+  8004f8:	ff d0                	call   *%rax
+}
+  8004fa:	c9                   	leave
+  8004fb:	c3                   	ret
+
+00000000008004fc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004fc:	55                   	push   %rbp
+  8004fd:	48 89 e5             	mov    %rsp,%rbp
+  800500:	41 57                	push   %r15
+  800502:	41 56                	push   %r14
+  800504:	41 55                	push   %r13
+  800506:	41 54                	push   %r12
+  800508:	53                   	push   %rbx
+  800509:	48 83 ec 38          	sub    $0x38,%rsp
+  80050d:	49 89 fe             	mov    %rdi,%r14
+  800510:	49 89 f5             	mov    %rsi,%r13
+  800513:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800516:	48 8b 01             	mov    (%rcx),%rax
+  800519:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80051d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800521:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800525:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800529:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80052d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800531:	0f b6 3b             	movzbl (%rbx),%edi
+  800534:	40 80 ff 25          	cmp    $0x25,%dil
+  800538:	74 18                	je     800552 <vprintfmt+0x56>
+            if (!ch) return;
+  80053a:	40 84 ff             	test   %dil,%dil
+  80053d:	0f 84 b1 06 00 00    	je     800bf4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800543:	40 0f b6 ff          	movzbl %dil,%edi
+  800547:	4c 89 ee             	mov    %r13,%rsi
+  80054a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80054d:	4c 89 e3             	mov    %r12,%rbx
+  800550:	eb db                	jmp    80052d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800552:	be 00 00 00 00       	mov    $0x0,%esi
+  800557:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80055b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800560:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800566:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80056d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800571:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800576:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80057b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80057e:	83 e8 23             	sub    $0x23,%eax
+  800581:	3c 57                	cmp    $0x57,%al
+  800583:	0f 87 51 06 00 00    	ja     800bda <vprintfmt+0x6de>
+  800589:	0f b6 c0             	movzbl %al,%eax
+  80058c:	48 b9 e0 3a 80 00 00 	movabs $0x803ae0,%rcx
+  800593:	00 00 00 
+  800596:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800599:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80059c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005a0:	eb cf                	jmp    800571 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005a2:	49 89 dc             	mov    %rbx,%r12
+  8005a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8005aa:	eb c5                	jmp    800571 <vprintfmt+0x75>
+            padc = ch;
+  8005ac:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005b0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b6:	eb b9                	jmp    800571 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005be:	77 24                	ja     8005e4 <vprintfmt+0xe8>
+  8005c0:	89 c1                	mov    %eax,%ecx
+  8005c2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005c6:	83 c0 08             	add    $0x8,%eax
+  8005c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005cc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005cf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005d2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005d6:	79 99                	jns    800571 <vprintfmt+0x75>
+                width = precision;
+  8005d8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005dc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e2:	eb 8d                	jmp    800571 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005e8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f0:	eb da                	jmp    8005cc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005f2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005f7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005fb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800601:	3c 39                	cmp    $0x39,%al
+  800603:	77 1c                	ja     800621 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800605:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800609:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80060d:	0f b6 c0             	movzbl %al,%eax
+  800610:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800615:	0f b6 03             	movzbl (%rbx),%eax
+  800618:	3c 39                	cmp    $0x39,%al
+  80061a:	76 e9                	jbe    800605 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80061c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80061f:	eb b1                	jmp    8005d2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800621:	49 89 dc             	mov    %rbx,%r12
+  800624:	eb ac                	jmp    8005d2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800626:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800630:	0f 49 c1             	cmovns %ecx,%eax
+  800633:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800636:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800639:	e9 33 ff ff ff       	jmp    800571 <vprintfmt+0x75>
+            lflag++;
+  80063e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800641:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800644:	e9 28 ff ff ff       	jmp    800571 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800649:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064c:	83 f8 2f             	cmp    $0x2f,%eax
+  80064f:	77 19                	ja     80066a <vprintfmt+0x16e>
+  800651:	89 c2                	mov    %eax,%edx
+  800653:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800657:	83 c0 08             	add    $0x8,%eax
+  80065a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065d:	8b 3a                	mov    (%rdx),%edi
+  80065f:	4c 89 ee             	mov    %r13,%rsi
+  800662:	41 ff d6             	call   *%r14
+            break;
+  800665:	e9 c3 fe ff ff       	jmp    80052d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80066a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80066e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800672:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800676:	eb e5                	jmp    80065d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800678:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80067b:	83 f8 2f             	cmp    $0x2f,%eax
+  80067e:	77 5a                	ja     8006da <vprintfmt+0x1de>
+  800680:	89 c2                	mov    %eax,%edx
+  800682:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800686:	83 c0 08             	add    $0x8,%eax
+  800689:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80068c:	8b 02                	mov    (%rdx),%eax
+  80068e:	89 c1                	mov    %eax,%ecx
+  800690:	f7 d9                	neg    %ecx
+  800692:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800695:	83 f9 14             	cmp    $0x14,%ecx
+  800698:	7f 4e                	jg     8006e8 <vprintfmt+0x1ec>
+  80069a:	48 63 c1             	movslq %ecx,%rax
+  80069d:	48 ba a0 3d 80 00 00 	movabs $0x803da0,%rdx
+  8006a4:	00 00 00 
+  8006a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006ab:	48 85 c0             	test   %rax,%rax
+  8006ae:	74 38                	je     8006e8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006b0:	48 89 c1             	mov    %rax,%rcx
+  8006b3:	48 ba b9 3f 80 00 00 	movabs $0x803fb9,%rdx
+  8006ba:	00 00 00 
+  8006bd:	4c 89 ee             	mov    %r13,%rsi
+  8006c0:	4c 89 f7             	mov    %r14,%rdi
+  8006c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c8:	49 b8 bf 04 80 00 00 	movabs $0x8004bf,%r8
+  8006cf:	00 00 00 
+  8006d2:	41 ff d0             	call   *%r8
+  8006d5:	e9 53 fe ff ff       	jmp    80052d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e6:	eb a4                	jmp    80068c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006e8:	48 ba 5c 39 80 00 00 	movabs $0x80395c,%rdx
+  8006ef:	00 00 00 
+  8006f2:	4c 89 ee             	mov    %r13,%rsi
+  8006f5:	4c 89 f7             	mov    %r14,%rdi
+  8006f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fd:	49 b8 bf 04 80 00 00 	movabs $0x8004bf,%r8
+  800704:	00 00 00 
+  800707:	41 ff d0             	call   *%r8
+  80070a:	e9 1e fe ff ff       	jmp    80052d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80070f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800712:	83 f8 2f             	cmp    $0x2f,%eax
+  800715:	77 6c                	ja     800783 <vprintfmt+0x287>
+  800717:	89 c2                	mov    %eax,%edx
+  800719:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071d:	83 c0 08             	add    $0x8,%eax
+  800720:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800723:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800726:	48 85 d2             	test   %rdx,%rdx
+  800729:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  800730:	00 00 00 
+  800733:	48 0f 45 c2          	cmovne %rdx,%rax
+  800737:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80073b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80073f:	7e 06                	jle    800747 <vprintfmt+0x24b>
+  800741:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800745:	75 4a                	jne    800791 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800747:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80074b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80074f:	0f b6 00             	movzbl (%rax),%eax
+  800752:	84 c0                	test   %al,%al
+  800754:	0f 85 9a 00 00 00    	jne    8007f4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80075a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80075d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800761:	85 c0                	test   %eax,%eax
+  800763:	0f 8e c4 fd ff ff    	jle    80052d <vprintfmt+0x31>
+  800769:	4c 89 ee             	mov    %r13,%rsi
+  80076c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800771:	41 ff d6             	call   *%r14
+  800774:	41 83 ec 01          	sub    $0x1,%r12d
+  800778:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80077c:	75 eb                	jne    800769 <vprintfmt+0x26d>
+  80077e:	e9 aa fd ff ff       	jmp    80052d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800783:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800787:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078f:	eb 92                	jmp    800723 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800791:	49 63 f7             	movslq %r15d,%rsi
+  800794:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800798:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  80079f:	00 00 00 
+  8007a2:	ff d0                	call   *%rax
+  8007a4:	48 89 c2             	mov    %rax,%rdx
+  8007a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007aa:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007ac:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007af:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007b2:	85 c0                	test   %eax,%eax
+  8007b4:	7e 91                	jle    800747 <vprintfmt+0x24b>
+  8007b6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007bb:	4c 89 ee             	mov    %r13,%rsi
+  8007be:	44 89 e7             	mov    %r12d,%edi
+  8007c1:	41 ff d6             	call   *%r14
+  8007c4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007c8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007ce:	75 eb                	jne    8007bb <vprintfmt+0x2bf>
+  8007d0:	e9 72 ff ff ff       	jmp    800747 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d5:	0f b6 f8             	movzbl %al,%edi
+  8007d8:	4c 89 ee             	mov    %r13,%rsi
+  8007db:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007e2:	49 83 c4 01          	add    $0x1,%r12
+  8007e6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007ec:	84 c0                	test   %al,%al
+  8007ee:	0f 84 66 ff ff ff    	je     80075a <vprintfmt+0x25e>
+  8007f4:	45 85 ff             	test   %r15d,%r15d
+  8007f7:	78 0a                	js     800803 <vprintfmt+0x307>
+  8007f9:	41 83 ef 01          	sub    $0x1,%r15d
+  8007fd:	0f 88 57 ff ff ff    	js     80075a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800803:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800807:	74 cc                	je     8007d5 <vprintfmt+0x2d9>
+  800809:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80080c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800811:	80 fa 5e             	cmp    $0x5e,%dl
+  800814:	77 c2                	ja     8007d8 <vprintfmt+0x2dc>
+  800816:	eb bd                	jmp    8007d5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800818:	40 84 f6             	test   %sil,%sil
+  80081b:	75 26                	jne    800843 <vprintfmt+0x347>
+    switch (lflag) {
+  80081d:	85 d2                	test   %edx,%edx
+  80081f:	74 59                	je     80087a <vprintfmt+0x37e>
+  800821:	83 fa 01             	cmp    $0x1,%edx
+  800824:	74 7b                	je     8008a1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	0f 87 96 00 00 00    	ja     8008c8 <vprintfmt+0x3cc>
+  800832:	89 c2                	mov    %eax,%edx
+  800834:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800838:	83 c0 08             	add    $0x8,%eax
+  80083b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083e:	4c 8b 22             	mov    (%rdx),%r12
+  800841:	eb 17                	jmp    80085a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800843:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800846:	83 f8 2f             	cmp    $0x2f,%eax
+  800849:	77 21                	ja     80086c <vprintfmt+0x370>
+  80084b:	89 c2                	mov    %eax,%edx
+  80084d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800851:	83 c0 08             	add    $0x8,%eax
+  800854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800857:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80085a:	4d 85 e4             	test   %r12,%r12
+  80085d:	78 7a                	js     8008d9 <vprintfmt+0x3dd>
+            num = i;
+  80085f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800862:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800867:	e9 50 02 00 00       	jmp    800abc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	eb dd                	jmp    800857 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	77 11                	ja     800893 <vprintfmt+0x397>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088e:	4c 63 22             	movslq (%rdx),%r12
+  800891:	eb c7                	jmp    80085a <vprintfmt+0x35e>
+  800893:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800897:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089f:	eb ed                	jmp    80088e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a7:	77 11                	ja     8008ba <vprintfmt+0x3be>
+  8008a9:	89 c2                	mov    %eax,%edx
+  8008ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008af:	83 c0 08             	add    $0x8,%eax
+  8008b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b5:	4c 8b 22             	mov    (%rdx),%r12
+  8008b8:	eb a0                	jmp    80085a <vprintfmt+0x35e>
+  8008ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c6:	eb ed                	jmp    8008b5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d4:	e9 65 ff ff ff       	jmp    80083e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008d9:	4c 89 ee             	mov    %r13,%rsi
+  8008dc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e1:	41 ff d6             	call   *%r14
+                i = -i;
+  8008e4:	49 f7 dc             	neg    %r12
+  8008e7:	e9 73 ff ff ff       	jmp    80085f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ec:	40 84 f6             	test   %sil,%sil
+  8008ef:	75 32                	jne    800923 <vprintfmt+0x427>
+    switch (lflag) {
+  8008f1:	85 d2                	test   %edx,%edx
+  8008f3:	74 5d                	je     800952 <vprintfmt+0x456>
+  8008f5:	83 fa 01             	cmp    $0x1,%edx
+  8008f8:	0f 84 82 00 00 00    	je     800980 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800901:	83 f8 2f             	cmp    $0x2f,%eax
+  800904:	0f 87 a5 00 00 00    	ja     8009af <vprintfmt+0x4b3>
+  80090a:	89 c2                	mov    %eax,%edx
+  80090c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800910:	83 c0 08             	add    $0x8,%eax
+  800913:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800916:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800919:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80091e:	e9 99 01 00 00       	jmp    800abc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800923:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	77 19                	ja     800944 <vprintfmt+0x448>
+  80092b:	89 c2                	mov    %eax,%edx
+  80092d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800931:	83 c0 08             	add    $0x8,%eax
+  800934:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800937:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80093a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80093f:	e9 78 01 00 00       	jmp    800abc <vprintfmt+0x5c0>
+  800944:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800948:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800950:	eb e5                	jmp    800937 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 18                	ja     800972 <vprintfmt+0x476>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800968:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80096d:	e9 4a 01 00 00       	jmp    800abc <vprintfmt+0x5c0>
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	eb e6                	jmp    800966 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 19                	ja     8009a1 <vprintfmt+0x4a5>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800997:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80099c:	e9 1b 01 00 00       	jmp    800abc <vprintfmt+0x5c0>
+  8009a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ad:	eb e5                	jmp    800994 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bb:	e9 56 ff ff ff       	jmp    800916 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c0:	40 84 f6             	test   %sil,%sil
+  8009c3:	75 2e                	jne    8009f3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009c5:	85 d2                	test   %edx,%edx
+  8009c7:	74 59                	je     800a22 <vprintfmt+0x526>
+  8009c9:	83 fa 01             	cmp    $0x1,%edx
+  8009cc:	74 7f                	je     800a4d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d4:	0f 87 9f 00 00 00    	ja     800a79 <vprintfmt+0x57d>
+  8009da:	89 c2                	mov    %eax,%edx
+  8009dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e0:	83 c0 08             	add    $0x8,%eax
+  8009e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ee:	e9 c9 00 00 00       	jmp    800abc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f9:	77 19                	ja     800a14 <vprintfmt+0x518>
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a01:	83 c0 08             	add    $0x8,%eax
+  800a04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a0a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a0f:	e9 a8 00 00 00       	jmp    800abc <vprintfmt+0x5c0>
+  800a14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a20:	eb e5                	jmp    800a07 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a25:	83 f8 2f             	cmp    $0x2f,%eax
+  800a28:	77 15                	ja     800a3f <vprintfmt+0x543>
+  800a2a:	89 c2                	mov    %eax,%edx
+  800a2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a30:	83 c0 08             	add    $0x8,%eax
+  800a33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a36:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a38:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a3d:	eb 7d                	jmp    800abc <vprintfmt+0x5c0>
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	eb e9                	jmp    800a36 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 16                	ja     800a6b <vprintfmt+0x56f>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a64:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a69:	eb 51                	jmp    800abc <vprintfmt+0x5c0>
+  800a6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a77:	eb e8                	jmp    800a61 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	e9 5c ff ff ff       	jmp    8009e6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a8a:	4c 89 ee             	mov    %r13,%rsi
+  800a8d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a92:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a95:	4c 89 ee             	mov    %r13,%rsi
+  800a98:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a9d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa3:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa6:	77 47                	ja     800aef <vprintfmt+0x5f3>
+  800aa8:	89 c2                	mov    %eax,%edx
+  800aaa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aae:	83 c0 08             	add    $0x8,%eax
+  800ab1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800abc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ac4:	0f 94 c0             	sete   %al
+  800ac7:	0f b6 c0             	movzbl %al,%eax
+  800aca:	50                   	push   %rax
+  800acb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ad0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ad4:	4c 89 ee             	mov    %r13,%rsi
+  800ad7:	4c 89 f7             	mov    %r14,%rdi
+  800ada:	48 b8 f1 03 80 00 00 	movabs $0x8003f1,%rax
+  800ae1:	00 00 00 
+  800ae4:	ff d0                	call   *%rax
+            break;
+  800ae6:	48 83 c4 10          	add    $0x10,%rsp
+  800aea:	e9 3e fa ff ff       	jmp    80052d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800aef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afb:	eb b7                	jmp    800ab4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800afd:	40 84 f6             	test   %sil,%sil
+  800b00:	75 2b                	jne    800b2d <vprintfmt+0x631>
+    switch (lflag) {
+  800b02:	85 d2                	test   %edx,%edx
+  800b04:	74 56                	je     800b5c <vprintfmt+0x660>
+  800b06:	83 fa 01             	cmp    $0x1,%edx
+  800b09:	74 7f                	je     800b8a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b11:	0f 87 a2 00 00 00    	ja     800bb9 <vprintfmt+0x6bd>
+  800b17:	89 c2                	mov    %eax,%edx
+  800b19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1d:	83 c0 08             	add    $0x8,%eax
+  800b20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b23:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b2b:	eb 8f                	jmp    800abc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b30:	83 f8 2f             	cmp    $0x2f,%eax
+  800b33:	77 19                	ja     800b4e <vprintfmt+0x652>
+  800b35:	89 c2                	mov    %eax,%edx
+  800b37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3b:	83 c0 08             	add    $0x8,%eax
+  800b3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b44:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b49:	e9 6e ff ff ff       	jmp    800abc <vprintfmt+0x5c0>
+  800b4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5a:	eb e5                	jmp    800b41 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b62:	77 18                	ja     800b7c <vprintfmt+0x680>
+  800b64:	89 c2                	mov    %eax,%edx
+  800b66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6a:	83 c0 08             	add    $0x8,%eax
+  800b6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b70:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b72:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b77:	e9 40 ff ff ff       	jmp    800abc <vprintfmt+0x5c0>
+  800b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b88:	eb e6                	jmp    800b70 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	77 19                	ja     800bab <vprintfmt+0x6af>
+  800b92:	89 c2                	mov    %eax,%edx
+  800b94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b98:	83 c0 08             	add    $0x8,%eax
+  800b9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba6:	e9 11 ff ff ff       	jmp    800abc <vprintfmt+0x5c0>
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	eb e5                	jmp    800b9e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc5:	e9 59 ff ff ff       	jmp    800b23 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bca:	4c 89 ee             	mov    %r13,%rsi
+  800bcd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bd2:	41 ff d6             	call   *%r14
+            break;
+  800bd5:	e9 53 f9 ff ff       	jmp    80052d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bda:	4c 89 ee             	mov    %r13,%rsi
+  800bdd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800be5:	48 83 eb 01          	sub    $0x1,%rbx
+  800be9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bed:	75 f6                	jne    800be5 <vprintfmt+0x6e9>
+  800bef:	e9 39 f9 ff ff       	jmp    80052d <vprintfmt+0x31>
+}
+  800bf4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bf8:	5b                   	pop    %rbx
+  800bf9:	41 5c                	pop    %r12
+  800bfb:	41 5d                	pop    %r13
+  800bfd:	41 5e                	pop    %r14
+  800bff:	41 5f                	pop    %r15
+  800c01:	5d                   	pop    %rbp
+  800c02:	c3                   	ret
+
+0000000000800c03 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c03:	55                   	push   %rbp
+  800c04:	48 89 e5             	mov    %rsp,%rbp
+  800c07:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c0f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c14:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c18:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c1f:	48 85 ff             	test   %rdi,%rdi
+  800c22:	74 2b                	je     800c4f <vsnprintf+0x4c>
+  800c24:	48 85 f6             	test   %rsi,%rsi
+  800c27:	74 26                	je     800c4f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c29:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c2d:	48 bf a7 04 80 00 00 	movabs $0x8004a7,%rdi
+  800c34:	00 00 00 
+  800c37:	48 b8 fc 04 80 00 00 	movabs $0x8004fc,%rax
+  800c3e:	00 00 00 
+  800c41:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c47:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c4d:	c9                   	leave
+  800c4e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c54:	eb f7                	jmp    800c4d <vsnprintf+0x4a>
+
+0000000000800c56 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+  800c5a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c5e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c62:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c66:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c6a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c71:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c79:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c81:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c85:	48 b8 03 0c 80 00 00 	movabs $0x800c03,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+
+0000000000800c93 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c93:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c96:	74 10                	je     800ca8 <strlen+0x15>
+    size_t n = 0;
+  800c98:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c9d:	48 83 c0 01          	add    $0x1,%rax
+  800ca1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ca5:	75 f6                	jne    800c9d <strlen+0xa>
+  800ca7:	c3                   	ret
+    size_t n = 0;
+  800ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cad:	c3                   	ret
+
+0000000000800cae <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cae:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cb1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cb6:	48 85 f6             	test   %rsi,%rsi
+  800cb9:	74 11                	je     800ccc <strnlen+0x1e>
+  800cbb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cbf:	74 0c                	je     800ccd <strnlen+0x1f>
+  800cc1:	48 83 c2 01          	add    $0x1,%rdx
+  800cc5:	48 39 d0             	cmp    %rdx,%rax
+  800cc8:	75 f1                	jne    800cbb <strnlen+0xd>
+  800cca:	eb 04                	jmp    800cd0 <strnlen+0x22>
+  800ccc:	c3                   	ret
+  800ccd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cd0:	c3                   	ret
+
+0000000000800cd1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cd1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cdd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ce0:	48 83 c2 01          	add    $0x1,%rdx
+  800ce4:	84 c9                	test   %cl,%cl
+  800ce6:	75 f1                	jne    800cd9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ce9:	55                   	push   %rbp
+  800cea:	48 89 e5             	mov    %rsp,%rbp
+  800ced:	41 54                	push   %r12
+  800cef:	53                   	push   %rbx
+  800cf0:	48 89 fb             	mov    %rdi,%rbx
+  800cf3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cf6:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  800cfd:	00 00 00 
+  800d00:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d02:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d06:	4c 89 e6             	mov    %r12,%rsi
+  800d09:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  800d10:	00 00 00 
+  800d13:	ff d0                	call   *%rax
+    return dst;
+}
+  800d15:	48 89 d8             	mov    %rbx,%rax
+  800d18:	5b                   	pop    %rbx
+  800d19:	41 5c                	pop    %r12
+  800d1b:	5d                   	pop    %rbp
+  800d1c:	c3                   	ret
+
+0000000000800d1d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d1d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d20:	48 85 d2             	test   %rdx,%rdx
+  800d23:	74 1f                	je     800d44 <strncpy+0x27>
+  800d25:	48 01 fa             	add    %rdi,%rdx
+  800d28:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d2b:	48 83 c1 01          	add    $0x1,%rcx
+  800d2f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d33:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d37:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d3b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d3f:	48 39 ca             	cmp    %rcx,%rdx
+  800d42:	75 e7                	jne    800d2b <strncpy+0xe>
+    }
+    return ret;
+}
+  800d44:	c3                   	ret
+
+0000000000800d45 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d45:	48 89 f8             	mov    %rdi,%rax
+  800d48:	48 85 d2             	test   %rdx,%rdx
+  800d4b:	74 24                	je     800d71 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d4d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d51:	74 1b                	je     800d6e <strlcpy+0x29>
+  800d53:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d57:	0f b6 16             	movzbl (%rsi),%edx
+  800d5a:	84 d2                	test   %dl,%dl
+  800d5c:	74 10                	je     800d6e <strlcpy+0x29>
+            *dst++ = *src++;
+  800d5e:	48 83 c6 01          	add    $0x1,%rsi
+  800d62:	48 83 c0 01          	add    $0x1,%rax
+  800d66:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d69:	48 39 c8             	cmp    %rcx,%rax
+  800d6c:	75 e9                	jne    800d57 <strlcpy+0x12>
+        *dst = '\0';
+  800d6e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d71:	48 29 f8             	sub    %rdi,%rax
+}
+  800d74:	c3                   	ret
+
+0000000000800d75 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d75:	0f b6 07             	movzbl (%rdi),%eax
+  800d78:	84 c0                	test   %al,%al
+  800d7a:	74 13                	je     800d8f <strcmp+0x1a>
+  800d7c:	38 06                	cmp    %al,(%rsi)
+  800d7e:	75 0f                	jne    800d8f <strcmp+0x1a>
+  800d80:	48 83 c7 01          	add    $0x1,%rdi
+  800d84:	48 83 c6 01          	add    $0x1,%rsi
+  800d88:	0f b6 07             	movzbl (%rdi),%eax
+  800d8b:	84 c0                	test   %al,%al
+  800d8d:	75 ed                	jne    800d7c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d8f:	0f b6 c0             	movzbl %al,%eax
+  800d92:	0f b6 16             	movzbl (%rsi),%edx
+  800d95:	29 d0                	sub    %edx,%eax
+}
+  800d97:	c3                   	ret
+
+0000000000800d98 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d98:	48 85 d2             	test   %rdx,%rdx
+  800d9b:	74 1f                	je     800dbc <strncmp+0x24>
+  800d9d:	0f b6 07             	movzbl (%rdi),%eax
+  800da0:	84 c0                	test   %al,%al
+  800da2:	74 1e                	je     800dc2 <strncmp+0x2a>
+  800da4:	3a 06                	cmp    (%rsi),%al
+  800da6:	75 1a                	jne    800dc2 <strncmp+0x2a>
+  800da8:	48 83 c7 01          	add    $0x1,%rdi
+  800dac:	48 83 c6 01          	add    $0x1,%rsi
+  800db0:	48 83 ea 01          	sub    $0x1,%rdx
+  800db4:	75 e7                	jne    800d9d <strncmp+0x5>
+
+    if (!n) return 0;
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	c3                   	ret
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	c3                   	ret
+  800dc2:	48 85 d2             	test   %rdx,%rdx
+  800dc5:	74 09                	je     800dd0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dc7:	0f b6 07             	movzbl (%rdi),%eax
+  800dca:	0f b6 16             	movzbl (%rsi),%edx
+  800dcd:	29 d0                	sub    %edx,%eax
+  800dcf:	c3                   	ret
+    if (!n) return 0;
+  800dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dd5:	c3                   	ret
+
+0000000000800dd6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dd6:	0f b6 17             	movzbl (%rdi),%edx
+  800dd9:	84 d2                	test   %dl,%dl
+  800ddb:	74 18                	je     800df5 <strchr+0x1f>
+        if (*str == c) {
+  800ddd:	0f be d2             	movsbl %dl,%edx
+  800de0:	39 f2                	cmp    %esi,%edx
+  800de2:	74 17                	je     800dfb <strchr+0x25>
+    for (; *str; str++) {
+  800de4:	48 83 c7 01          	add    $0x1,%rdi
+  800de8:	0f b6 17             	movzbl (%rdi),%edx
+  800deb:	84 d2                	test   %dl,%dl
+  800ded:	75 ee                	jne    800ddd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df4:	c3                   	ret
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	c3                   	ret
+  800dfb:	48 89 f8             	mov    %rdi,%rax
+}
+  800dfe:	c3                   	ret
+
+0000000000800dff <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dff:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e02:	0f b6 17             	movzbl (%rdi),%edx
+  800e05:	84 d2                	test   %dl,%dl
+  800e07:	74 13                	je     800e1c <strfind+0x1d>
+  800e09:	0f be d2             	movsbl %dl,%edx
+  800e0c:	39 f2                	cmp    %esi,%edx
+  800e0e:	74 0b                	je     800e1b <strfind+0x1c>
+  800e10:	48 83 c0 01          	add    $0x1,%rax
+  800e14:	0f b6 10             	movzbl (%rax),%edx
+  800e17:	84 d2                	test   %dl,%dl
+  800e19:	75 ee                	jne    800e09 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e1b:	c3                   	ret
+  800e1c:	c3                   	ret
+
+0000000000800e1d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e1d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e20:	48 89 f8             	mov    %rdi,%rax
+  800e23:	48 f7 d8             	neg    %rax
+  800e26:	83 e0 07             	and    $0x7,%eax
+  800e29:	49 89 d1             	mov    %rdx,%r9
+  800e2c:	49 29 c1             	sub    %rax,%r9
+  800e2f:	78 36                	js     800e67 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e31:	40 0f b6 c6          	movzbl %sil,%eax
+  800e35:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e3c:	01 01 01 
+  800e3f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e43:	40 f6 c7 07          	test   $0x7,%dil
+  800e47:	75 38                	jne    800e81 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e49:	4c 89 c9             	mov    %r9,%rcx
+  800e4c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e50:	74 0c                	je     800e5e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e52:	fc                   	cld
+  800e53:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e56:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e5a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e5e:	4d 85 c9             	test   %r9,%r9
+  800e61:	75 45                	jne    800ea8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e63:	4c 89 c0             	mov    %r8,%rax
+  800e66:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e67:	48 85 d2             	test   %rdx,%rdx
+  800e6a:	74 f7                	je     800e63 <memset+0x46>
+  800e6c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e6f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e72:	48 83 c0 01          	add    $0x1,%rax
+  800e76:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e7a:	48 39 c2             	cmp    %rax,%rdx
+  800e7d:	75 f3                	jne    800e72 <memset+0x55>
+  800e7f:	eb e2                	jmp    800e63 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e81:	40 f6 c7 01          	test   $0x1,%dil
+  800e85:	74 06                	je     800e8d <memset+0x70>
+  800e87:	88 07                	mov    %al,(%rdi)
+  800e89:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e8d:	40 f6 c7 02          	test   $0x2,%dil
+  800e91:	74 07                	je     800e9a <memset+0x7d>
+  800e93:	66 89 07             	mov    %ax,(%rdi)
+  800e96:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e9a:	40 f6 c7 04          	test   $0x4,%dil
+  800e9e:	74 a9                	je     800e49 <memset+0x2c>
+  800ea0:	89 07                	mov    %eax,(%rdi)
+  800ea2:	48 83 c7 04          	add    $0x4,%rdi
+  800ea6:	eb a1                	jmp    800e49 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea8:	41 f6 c1 04          	test   $0x4,%r9b
+  800eac:	74 06                	je     800eb4 <memset+0x97>
+  800eae:	89 07                	mov    %eax,(%rdi)
+  800eb0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb4:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb8:	74 07                	je     800ec1 <memset+0xa4>
+  800eba:	66 89 07             	mov    %ax,(%rdi)
+  800ebd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec1:	41 f6 c1 01          	test   $0x1,%r9b
+  800ec5:	74 9c                	je     800e63 <memset+0x46>
+  800ec7:	88 07                	mov    %al,(%rdi)
+  800ec9:	eb 98                	jmp    800e63 <memset+0x46>
+
+0000000000800ecb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ecb:	48 89 f8             	mov    %rdi,%rax
+  800ece:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed1:	48 39 fe             	cmp    %rdi,%rsi
+  800ed4:	73 3b                	jae    800f11 <memmove+0x46>
+  800ed6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eda:	48 39 d7             	cmp    %rdx,%rdi
+  800edd:	73 32                	jae    800f11 <memmove+0x46>
+        s += n;
+        d += n;
+  800edf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee3:	48 89 d6             	mov    %rdx,%rsi
+  800ee6:	48 09 fe             	or     %rdi,%rsi
+  800ee9:	48 09 ce             	or     %rcx,%rsi
+  800eec:	40 f6 c6 07          	test   $0x7,%sil
+  800ef0:	75 12                	jne    800f04 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef2:	48 83 ef 08          	sub    $0x8,%rdi
+  800ef6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800efa:	48 c1 e9 03          	shr    $0x3,%rcx
+  800efe:	fd                   	std
+  800eff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f02:	fc                   	cld
+  800f03:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f04:	48 83 ef 01          	sub    $0x1,%rdi
+  800f08:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f0c:	fd                   	std
+  800f0d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f0f:	eb f1                	jmp    800f02 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f11:	48 89 f2             	mov    %rsi,%rdx
+  800f14:	48 09 c2             	or     %rax,%rdx
+  800f17:	48 09 ca             	or     %rcx,%rdx
+  800f1a:	f6 c2 07             	test   $0x7,%dl
+  800f1d:	75 0c                	jne    800f2b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f1f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f23:	48 89 c7             	mov    %rax,%rdi
+  800f26:	fc                   	cld
+  800f27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f2a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f2b:	48 89 c7             	mov    %rax,%rdi
+  800f2e:	fc                   	cld
+  800f2f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f31:	c3                   	ret
+
+0000000000800f32 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f32:	55                   	push   %rbp
+  800f33:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f36:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  800f3d:	00 00 00 
+  800f40:	ff d0                	call   *%rax
+}
+  800f42:	5d                   	pop    %rbp
+  800f43:	c3                   	ret
+
+0000000000800f44 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f44:	55                   	push   %rbp
+  800f45:	48 89 e5             	mov    %rsp,%rbp
+  800f48:	41 57                	push   %r15
+  800f4a:	41 56                	push   %r14
+  800f4c:	41 55                	push   %r13
+  800f4e:	41 54                	push   %r12
+  800f50:	53                   	push   %rbx
+  800f51:	48 83 ec 08          	sub    $0x8,%rsp
+  800f55:	49 89 fe             	mov    %rdi,%r14
+  800f58:	49 89 f7             	mov    %rsi,%r15
+  800f5b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f5e:	48 89 f7             	mov    %rsi,%rdi
+  800f61:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  800f68:	00 00 00 
+  800f6b:	ff d0                	call   *%rax
+  800f6d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f70:	48 89 de             	mov    %rbx,%rsi
+  800f73:	4c 89 f7             	mov    %r14,%rdi
+  800f76:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  800f7d:	00 00 00 
+  800f80:	ff d0                	call   *%rax
+  800f82:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f85:	48 39 c3             	cmp    %rax,%rbx
+  800f88:	74 36                	je     800fc0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f8a:	48 89 d8             	mov    %rbx,%rax
+  800f8d:	4c 29 e8             	sub    %r13,%rax
+  800f90:	49 39 c4             	cmp    %rax,%r12
+  800f93:	73 31                	jae    800fc6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f95:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f9a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9e:	4c 89 fe             	mov    %r15,%rsi
+  800fa1:	48 b8 32 0f 80 00 00 	movabs $0x800f32,%rax
+  800fa8:	00 00 00 
+  800fab:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fad:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb1:	48 83 c4 08          	add    $0x8,%rsp
+  800fb5:	5b                   	pop    %rbx
+  800fb6:	41 5c                	pop    %r12
+  800fb8:	41 5d                	pop    %r13
+  800fba:	41 5e                	pop    %r14
+  800fbc:	41 5f                	pop    %r15
+  800fbe:	5d                   	pop    %rbp
+  800fbf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc4:	eb eb                	jmp    800fb1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fc6:	48 83 eb 01          	sub    $0x1,%rbx
+  800fca:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fce:	48 89 da             	mov    %rbx,%rdx
+  800fd1:	4c 89 fe             	mov    %r15,%rsi
+  800fd4:	48 b8 32 0f 80 00 00 	movabs $0x800f32,%rax
+  800fdb:	00 00 00 
+  800fde:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fe0:	49 01 de             	add    %rbx,%r14
+  800fe3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe8:	eb c3                	jmp    800fad <strlcat+0x69>
+
+0000000000800fea <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fea:	48 85 d2             	test   %rdx,%rdx
+  800fed:	74 2d                	je     80101c <memcmp+0x32>
+  800fef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ff4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ffd:	44 38 c1             	cmp    %r8b,%cl
+  801000:	75 0f                	jne    801011 <memcmp+0x27>
+    while (n-- > 0) {
+  801002:	48 83 c0 01          	add    $0x1,%rax
+  801006:	48 39 c2             	cmp    %rax,%rdx
+  801009:	75 e9                	jne    800ff4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80100b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801010:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801011:	0f b6 c1             	movzbl %cl,%eax
+  801014:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801018:	44 29 c0             	sub    %r8d,%eax
+  80101b:	c3                   	ret
+    return 0;
+  80101c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801021:	c3                   	ret
+
+0000000000801022 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801022:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801026:	48 39 c7             	cmp    %rax,%rdi
+  801029:	73 0f                	jae    80103a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80102b:	40 38 37             	cmp    %sil,(%rdi)
+  80102e:	74 0e                	je     80103e <memfind+0x1c>
+    for (; src < end; src++) {
+  801030:	48 83 c7 01          	add    $0x1,%rdi
+  801034:	48 39 f8             	cmp    %rdi,%rax
+  801037:	75 f2                	jne    80102b <memfind+0x9>
+  801039:	c3                   	ret
+  80103a:	48 89 f8             	mov    %rdi,%rax
+  80103d:	c3                   	ret
+  80103e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801041:	c3                   	ret
+
+0000000000801042 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801042:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801045:	0f b6 37             	movzbl (%rdi),%esi
+  801048:	40 80 fe 20          	cmp    $0x20,%sil
+  80104c:	74 06                	je     801054 <strtol+0x12>
+  80104e:	40 80 fe 09          	cmp    $0x9,%sil
+  801052:	75 13                	jne    801067 <strtol+0x25>
+  801054:	48 83 c7 01          	add    $0x1,%rdi
+  801058:	0f b6 37             	movzbl (%rdi),%esi
+  80105b:	40 80 fe 20          	cmp    $0x20,%sil
+  80105f:	74 f3                	je     801054 <strtol+0x12>
+  801061:	40 80 fe 09          	cmp    $0x9,%sil
+  801065:	74 ed                	je     801054 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801067:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80106a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80106d:	3c 01                	cmp    $0x1,%al
+  80106f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801073:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801079:	75 0f                	jne    80108a <strtol+0x48>
+  80107b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80107e:	74 14                	je     801094 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801080:	85 d2                	test   %edx,%edx
+  801082:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801087:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80108a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80108f:	4c 63 ca             	movslq %edx,%r9
+  801092:	eb 36                	jmp    8010ca <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801094:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801098:	74 0f                	je     8010a9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80109a:	85 d2                	test   %edx,%edx
+  80109c:	75 ec                	jne    80108a <strtol+0x48>
+        s++;
+  80109e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a7:	eb e1                	jmp    80108a <strtol+0x48>
+        s += 2;
+  8010a9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010ad:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b2:	eb d6                	jmp    80108a <strtol+0x48>
+            dig -= '0';
+  8010b4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010bb:	41 39 d0             	cmp    %edx,%r8d
+  8010be:	7d 21                	jge    8010e1 <strtol+0x9f>
+        val = val * base + dig;
+  8010c0:	49 0f af c1          	imul   %r9,%rax
+  8010c4:	0f b6 c9             	movzbl %cl,%ecx
+  8010c7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010ca:	48 83 c7 01          	add    $0x1,%rdi
+  8010ce:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d2:	80 f9 39             	cmp    $0x39,%cl
+  8010d5:	76 dd                	jbe    8010b4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d7:	80 f9 7b             	cmp    $0x7b,%cl
+  8010da:	77 05                	ja     8010e1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010dc:	83 e9 57             	sub    $0x57,%ecx
+  8010df:	eb d6                	jmp    8010b7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e1:	4d 85 d2             	test   %r10,%r10
+  8010e4:	74 03                	je     8010e9 <strtol+0xa7>
+  8010e6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010e9:	48 89 c2             	mov    %rax,%rdx
+  8010ec:	48 f7 da             	neg    %rdx
+  8010ef:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f7:	c3                   	ret
+
+00000000008010f8 <strrev>:
+
+void
+strrev(char *str)
+{
+  8010f8:	55                   	push   %rbp
+  8010f9:	48 89 e5             	mov    %rsp,%rbp
+  8010fc:	53                   	push   %rbx
+  8010fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801101:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801104:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  80110b:	00 00 00 
+  80110e:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801110:	83 e8 01             	sub    $0x1,%eax
+  801113:	85 c0                	test   %eax,%eax
+  801115:	7e 22                	jle    801139 <strrev+0x41>
+  801117:	48 98                	cltq
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80111e:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801122:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801126:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80112a:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80112d:	48 83 c2 01          	add    $0x1,%rdx
+  801131:	48 83 e8 01          	sub    $0x1,%rax
+  801135:	39 c2                	cmp    %eax,%edx
+  801137:	7c e5                	jl     80111e <strrev+0x26>
+	}
+}
+  801139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113d:	c9                   	leave
+  80113e:	c3                   	ret
+
+000000000080113f <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80113f:	85 d2                	test   %edx,%edx
+  801141:	0f 84 80 00 00 00    	je     8011c7 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801147:	55                   	push   %rbp
+  801148:	48 89 e5             	mov    %rsp,%rbp
+  80114b:	53                   	push   %rbx
+  80114c:	48 83 ec 08          	sub    $0x8,%rsp
+  801150:	49 89 f2             	mov    %rsi,%r10
+  801153:	41 89 d3             	mov    %edx,%r11d
+  801156:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801159:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80115e:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801161:	eb 20                	jmp    801183 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801163:	41 89 f1             	mov    %esi,%r9d
+  801166:	83 c2 30             	add    $0x30,%edx
+  801169:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80116c:	89 f8                	mov    %edi,%eax
+  80116e:	99                   	cltd
+  80116f:	f7 f9                	idiv   %ecx
+  801171:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801173:	85 c0                	test   %eax,%eax
+  801175:	74 2e                	je     8011a5 <itoa+0x66>
+  801177:	83 c6 01             	add    $0x1,%esi
+  80117a:	49 83 c0 01          	add    $0x1,%r8
+  80117e:	44 39 cb             	cmp    %r9d,%ebx
+  801181:	7e 15                	jle    801198 <itoa+0x59>
+		digit = sum % base;
+  801183:	89 f8                	mov    %edi,%eax
+  801185:	99                   	cltd
+  801186:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801188:	83 fa 09             	cmp    $0x9,%edx
+  80118b:	7e d6                	jle    801163 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80118d:	41 89 f1             	mov    %esi,%r9d
+  801190:	83 c2 37             	add    $0x37,%edx
+  801193:	41 88 10             	mov    %dl,(%r8)
+  801196:	eb d4                	jmp    80116c <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801198:	41 83 eb 01          	sub    $0x1,%r11d
+  80119c:	45 39 cb             	cmp    %r9d,%r11d
+  80119f:	75 04                	jne    8011a5 <itoa+0x66>
+  8011a1:	85 c0                	test   %eax,%eax
+  8011a3:	75 28                	jne    8011cd <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8011a5:	4d 63 c9             	movslq %r9d,%r9
+  8011a8:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8011ad:	4c 89 d7             	mov    %r10,%rdi
+  8011b0:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  8011b7:	00 00 00 
+  8011ba:	ff d0                	call   *%rax
+	return 0;
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c5:	c9                   	leave
+  8011c6:	c3                   	ret
+		return -1;
+  8011c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8011cc:	c3                   	ret
+		return -1;
+  8011cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8011d2:	eb ed                	jmp    8011c1 <itoa+0x82>
+
+00000000008011d4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011d4:	55                   	push   %rbp
+  8011d5:	48 89 e5             	mov    %rsp,%rbp
+  8011d8:	53                   	push   %rbx
+  8011d9:	48 89 fa             	mov    %rdi,%rdx
+  8011dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ff:	c9                   	leave
+  801200:	c3                   	ret
+
+0000000000801201 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801206:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801210:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121f:	be 00 00 00 00       	mov    $0x0,%esi
+  801224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	53                   	push   %rbx
+  801237:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80123b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80123e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801243:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801248:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801252:	be 00 00 00 00       	mov    $0x0,%esi
+  801257:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80125f:	48 85 c0             	test   %rax,%rax
+  801262:	7f 06                	jg     80126a <sys_env_destroy+0x38>
+}
+  801264:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801268:	c9                   	leave
+  801269:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126a:	49 89 c0             	mov    %rax,%r8
+  80126d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801272:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  801279:	00 00 00 
+  80127c:	be 26 00 00 00       	mov    $0x26,%esi
+  801281:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  801288:	00 00 00 
+  80128b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801290:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  801297:	00 00 00 
+  80129a:	41 ff d1             	call   *%r9
+
+000000000080129d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80129d:	55                   	push   %rbp
+  80129e:	48 89 e5             	mov    %rsp,%rbp
+  8012a1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012cc:	c9                   	leave
+  8012cd:	c3                   	ret
+
+00000000008012ce <sys_yield>:
+
+void
+sys_yield(void) {
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+  8012d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fd:	c9                   	leave
+  8012fe:	c3                   	ret
+
+00000000008012ff <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012ff:	55                   	push   %rbp
+  801300:	48 89 e5             	mov    %rsp,%rbp
+  801303:	53                   	push   %rbx
+  801304:	48 89 fa             	mov    %rdi,%rdx
+  801307:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80130a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80130f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801316:	00 00 00 
+  801319:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131e:	be 00 00 00 00       	mov    $0x0,%esi
+  801323:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801329:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80132b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132f:	c9                   	leave
+  801330:	c3                   	ret
+
+0000000000801331 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801331:	55                   	push   %rbp
+  801332:	48 89 e5             	mov    %rsp,%rbp
+  801335:	53                   	push   %rbx
+  801336:	49 89 f8             	mov    %rdi,%r8
+  801339:	48 89 d3             	mov    %rdx,%rbx
+  80133c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801344:	4c 89 c2             	mov    %r8,%rdx
+  801347:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134a:	be 00 00 00 00       	mov    $0x0,%esi
+  80134f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801355:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135b:	c9                   	leave
+  80135c:	c3                   	ret
+
+000000000080135d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80135d:	55                   	push   %rbp
+  80135e:	48 89 e5             	mov    %rsp,%rbp
+  801361:	53                   	push   %rbx
+  801362:	48 83 ec 08          	sub    $0x8,%rsp
+  801366:	89 f8                	mov    %edi,%eax
+  801368:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80136b:	48 63 f9             	movslq %ecx,%rdi
+  80136e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801371:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801376:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801379:	be 00 00 00 00       	mov    $0x0,%esi
+  80137e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801384:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801386:	48 85 c0             	test   %rax,%rax
+  801389:	7f 06                	jg     801391 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80138b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138f:	c9                   	leave
+  801390:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801391:	49 89 c0             	mov    %rax,%r8
+  801394:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801399:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  8013a0:	00 00 00 
+  8013a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a8:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  8013af:	00 00 00 
+  8013b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b7:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  8013be:	00 00 00 
+  8013c1:	41 ff d1             	call   *%r9
+
+00000000008013c4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013c4:	55                   	push   %rbp
+  8013c5:	48 89 e5             	mov    %rsp,%rbp
+  8013c8:	53                   	push   %rbx
+  8013c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013cd:	89 f8                	mov    %edi,%eax
+  8013cf:	49 89 f2             	mov    %rsi,%r10
+  8013d2:	48 89 cf             	mov    %rcx,%rdi
+  8013d5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013d8:	48 63 da             	movslq %edx,%rbx
+  8013db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013de:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013eb:	48 85 c0             	test   %rax,%rax
+  8013ee:	7f 06                	jg     8013f6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f4:	c9                   	leave
+  8013f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f6:	49 89 c0             	mov    %rax,%r8
+  8013f9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013fe:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  801405:	00 00 00 
+  801408:	be 26 00 00 00       	mov    $0x26,%esi
+  80140d:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  801414:	00 00 00 
+  801417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141c:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  801423:	00 00 00 
+  801426:	41 ff d1             	call   *%r9
+
+0000000000801429 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801429:	55                   	push   %rbp
+  80142a:	48 89 e5             	mov    %rsp,%rbp
+  80142d:	53                   	push   %rbx
+  80142e:	48 83 ec 08          	sub    $0x8,%rsp
+  801432:	48 89 f1             	mov    %rsi,%rcx
+  801435:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801438:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801445:	be 00 00 00 00       	mov    $0x0,%esi
+  80144a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801450:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801452:	48 85 c0             	test   %rax,%rax
+  801455:	7f 06                	jg     80145d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145b:	c9                   	leave
+  80145c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145d:	49 89 c0             	mov    %rax,%r8
+  801460:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801465:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  80146c:	00 00 00 
+  80146f:	be 26 00 00 00       	mov    $0x26,%esi
+  801474:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  80147b:	00 00 00 
+  80147e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801483:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  80148a:	00 00 00 
+  80148d:	41 ff d1             	call   *%r9
+
+0000000000801490 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801490:	55                   	push   %rbp
+  801491:	48 89 e5             	mov    %rsp,%rbp
+  801494:	53                   	push   %rbx
+  801495:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801499:	48 63 ce             	movslq %esi,%rcx
+  80149c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014bb:	48 85 c0             	test   %rax,%rax
+  8014be:	7f 06                	jg     8014c6 <sys_env_set_status+0x36>
+}
+  8014c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c6:	49 89 c0             	mov    %rax,%r8
+  8014c9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014ce:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  8014d5:	00 00 00 
+  8014d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dd:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  8014e4:	00 00 00 
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ec:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  8014f3:	00 00 00 
+  8014f6:	41 ff d1             	call   *%r9
+
+00000000008014f9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014f9:	55                   	push   %rbp
+  8014fa:	48 89 e5             	mov    %rsp,%rbp
+  8014fd:	53                   	push   %rbx
+  8014fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801502:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801505:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801508:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801512:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801517:	be 00 00 00 00       	mov    $0x0,%esi
+  80151c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801522:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801524:	48 85 c0             	test   %rax,%rax
+  801527:	7f 06                	jg     80152f <sys_env_set_trapframe+0x36>
+}
+  801529:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152d:	c9                   	leave
+  80152e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152f:	49 89 c0             	mov    %rax,%r8
+  801532:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801537:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  80153e:	00 00 00 
+  801541:	be 26 00 00 00       	mov    $0x26,%esi
+  801546:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  80154d:	00 00 00 
+  801550:	b8 00 00 00 00       	mov    $0x0,%eax
+  801555:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  80155c:	00 00 00 
+  80155f:	41 ff d1             	call   *%r9
+
+0000000000801562 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801562:	55                   	push   %rbp
+  801563:	48 89 e5             	mov    %rsp,%rbp
+  801566:	53                   	push   %rbx
+  801567:	48 83 ec 08          	sub    $0x8,%rsp
+  80156b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80156e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801571:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801576:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801580:	be 00 00 00 00       	mov    $0x0,%esi
+  801585:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158d:	48 85 c0             	test   %rax,%rax
+  801590:	7f 06                	jg     801598 <sys_env_set_pgfault_upcall+0x36>
+}
+  801592:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801598:	49 89 c0             	mov    %rax,%r8
+  80159b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015a0:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  8015a7:	00 00 00 
+  8015aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8015af:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  8015b6:	00 00 00 
+  8015b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015be:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  8015c5:	00 00 00 
+  8015c8:	41 ff d1             	call   *%r9
+
+00000000008015cb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015cb:	55                   	push   %rbp
+  8015cc:	48 89 e5             	mov    %rsp,%rbp
+  8015cf:	53                   	push   %rbx
+  8015d0:	89 f8                	mov    %edi,%eax
+  8015d2:	49 89 f1             	mov    %rsi,%r9
+  8015d5:	48 89 d3             	mov    %rdx,%rbx
+  8015d8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015db:	49 63 f0             	movslq %r8d,%rsi
+  8015de:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ef:	cd 30                	int    $0x30
+}
+  8015f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+
+00000000008015f7 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801600:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801603:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801606:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80160b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801613:	be 00 00 00 00       	mov    $0x0,%esi
+  801618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801620:	48 85 c0             	test   %rax,%rax
+  801623:	7f 06                	jg     80162b <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162b:	49 89 c0             	mov    %rax,%r8
+  80162e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801633:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  80163a:	00 00 00 
+  80163d:	be 26 00 00 00       	mov    $0x26,%esi
+  801642:	48 bf 87 3e 80 00 00 	movabs $0x803e87,%rdi
+  801649:	00 00 00 
+  80164c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801651:	49 b9 5c 02 80 00 00 	movabs $0x80025c,%r9
+  801658:	00 00 00 
+  80165b:	41 ff d1             	call   *%r9
+
+000000000080165e <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801662:	ba 00 00 00 00       	mov    $0x0,%edx
+  801667:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  80166e:	00 00 00 
+  801671:	ff d0                	call   *%rax
+}
+  801673:	5d                   	pop    %rbp
+  801674:	c3                   	ret
+
+0000000000801675 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801675:	55                   	push   %rbp
+  801676:	48 89 e5             	mov    %rsp,%rbp
+  801679:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80167a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80167f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801684:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+00000000008016a6 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8016ab:	48 63 ce             	movslq %esi,%rcx
+  8016ae:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+}
+  8016ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+
+00000000008016d4 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8016d4:	55                   	push   %rbp
+  8016d5:	48 89 e5             	mov    %rsp,%rbp
+  8016d8:	53                   	push   %rbx
+  8016d9:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8016dc:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fa:	cd 30                	int    $0x30
+}
+  8016fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+
+0000000000801702 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+  801706:	53                   	push   %rbx
+  801707:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80170a:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80170d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801712:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801715:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171a:	be 00 00 00 00       	mov    $0x0,%esi
+  80171f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801725:	cd 30                	int    $0x30
+}
+  801727:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172b:	c9                   	leave
+  80172c:	c3                   	ret
+
+000000000080172d <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	41 54                	push   %r12
+  801733:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801734:	b8 08 00 00 00       	mov    $0x8,%eax
+  801739:	cd 30                	int    $0x30
+  80173b:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 7e                	js     8017c0 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801742:	0f 84 80 00 00 00    	je     8017c8 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801748:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80174e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801755:	00 00 00 
+  801758:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80175d:	89 c2                	mov    %eax,%edx
+  80175f:	be 00 00 00 00       	mov    $0x0,%esi
+  801764:	bf 00 00 00 00       	mov    $0x0,%edi
+  801769:	48 b8 c4 13 80 00 00 	movabs $0x8013c4,%rax
+  801770:	00 00 00 
+  801773:	ff d0                	call   *%rax
+  801775:	85 c0                	test   %eax,%eax
+  801777:	0f 88 81 00 00 00    	js     8017fe <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80177d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801784:	00 00 00 
+  801787:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  80178e:	44 89 e7             	mov    %r12d,%edi
+  801791:	48 b8 62 15 80 00 00 	movabs $0x801562,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 65                	js     801806 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8017a1:	be 02 00 00 00       	mov    $0x2,%esi
+  8017a6:	44 89 e7             	mov    %r12d,%edi
+  8017a9:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  8017b0:	00 00 00 
+  8017b3:	ff d0                	call   *%rax
+        return -1;
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017bc:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  8017c0:	44 89 e0             	mov    %r12d,%eax
+  8017c3:	5b                   	pop    %rbx
+  8017c4:	41 5c                	pop    %r12
+  8017c6:	5d                   	pop    %rbp
+  8017c7:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8017c8:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  8017cf:	00 00 00 
+  8017d2:	ff d0                	call   *%rax
+  8017d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017d9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017dd:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8017e1:	48 c1 e0 04          	shl    $0x4,%rax
+  8017e5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017ec:	00 00 00 
+  8017ef:	48 01 d0             	add    %rdx,%rax
+  8017f2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8017f9:	00 00 00 
+        return 0;
+  8017fc:	eb c2                	jmp    8017c0 <fork+0x93>
+        return -1;
+  8017fe:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801804:	eb ba                	jmp    8017c0 <fork+0x93>
+        return -1;
+  801806:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80180c:	eb b2                	jmp    8017c0 <fork+0x93>
+
+000000000080180e <sfork>:
+
+envid_t
+sfork() {
+  80180e:	55                   	push   %rbp
+  80180f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801812:	48 ba 95 3e 80 00 00 	movabs $0x803e95,%rdx
+  801819:	00 00 00 
+  80181c:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801821:	48 bf b0 3e 80 00 00 	movabs $0x803eb0,%rdi
+  801828:	00 00 00 
+  80182b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801830:	48 b9 5c 02 80 00 00 	movabs $0x80025c,%rcx
+  801837:	00 00 00 
+  80183a:	ff d1                	call   *%rcx
+
+000000000080183c <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	41 55                	push   %r13
+  801842:	41 54                	push   %r12
+  801844:	53                   	push   %rbx
+  801845:	48 83 ec 08          	sub    $0x8,%rsp
+  801849:	49 89 fc             	mov    %rdi,%r12
+  80184c:	48 89 f7             	mov    %rsi,%rdi
+  80184f:	48 89 d3             	mov    %rdx,%rbx
+  801852:	49 89 cd             	mov    %rcx,%r13
+  801855:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801858:	48 85 f6             	test   %rsi,%rsi
+  80185b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801862:	00 00 00 
+  801865:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  801869:	be 00 10 00 00       	mov    $0x1000,%esi
+  80186e:	48 85 db             	test   %rbx,%rbx
+  801871:	74 03                	je     801876 <ipc_recv_timed+0x3a>
+  801873:	48 8b 33             	mov    (%rbx),%rsi
+  801876:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+    if (res < 0) {
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 75                	js     8018fb <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  801886:	4d 85 e4             	test   %r12,%r12
+  801889:	74 14                	je     80189f <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80188b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801892:	00 00 00 
+  801895:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80189b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80189f:	4d 85 ed             	test   %r13,%r13
+  8018a2:	74 14                	je     8018b8 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8018a4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018ab:	00 00 00 
+  8018ae:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8018b4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8018b8:	48 85 db             	test   %rbx,%rbx
+  8018bb:	74 23                	je     8018e0 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8018bd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018c4:	00 00 00 
+  8018c7:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8018cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d2:	85 c9                	test   %ecx,%ecx
+  8018d4:	74 07                	je     8018dd <ipc_recv_timed+0xa1>
+  8018d6:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8018dd:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8018e0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018e7:	00 00 00 
+  8018ea:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8018f0:	48 83 c4 08          	add    $0x8,%rsp
+  8018f4:	5b                   	pop    %rbx
+  8018f5:	41 5c                	pop    %r12
+  8018f7:	41 5d                	pop    %r13
+  8018f9:	5d                   	pop    %rbp
+  8018fa:	c3                   	ret
+        if (from_env_store != NULL) {
+  8018fb:	4d 85 e4             	test   %r12,%r12
+  8018fe:	74 08                	je     801908 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  801900:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801907:	00 
+        if (perm_store != NULL) {
+  801908:	4d 85 ed             	test   %r13,%r13
+  80190b:	74 08                	je     801915 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80190d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801914:	00 
+        if (size != NULL) {
+  801915:	48 85 db             	test   %rbx,%rbx
+  801918:	74 d6                	je     8018f0 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80191a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801921:	eb cd                	jmp    8018f0 <ipc_recv_timed+0xb4>
+
+0000000000801923 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  801927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80192d:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  801934:	00 00 00 
+  801937:	ff d0                	call   *%rax
+}
+  801939:	5d                   	pop    %rbp
+  80193a:	c3                   	ret
+
+000000000080193b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80193b:	55                   	push   %rbp
+  80193c:	48 89 e5             	mov    %rsp,%rbp
+  80193f:	41 57                	push   %r15
+  801941:	41 56                	push   %r14
+  801943:	41 55                	push   %r13
+  801945:	41 54                	push   %r12
+  801947:	53                   	push   %rbx
+  801948:	48 83 ec 18          	sub    $0x18,%rsp
+  80194c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80194f:	48 89 d3             	mov    %rdx,%rbx
+  801952:	49 89 cc             	mov    %rcx,%r12
+  801955:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801958:	48 85 d2             	test   %rdx,%rdx
+  80195b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801962:	00 00 00 
+  801965:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801969:	89 f0                	mov    %esi,%eax
+  80196b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80196f:	48 89 da             	mov    %rbx,%rdx
+  801972:	48 89 c6             	mov    %rax,%rsi
+  801975:	48 b8 cb 15 80 00 00 	movabs $0x8015cb,%rax
+  80197c:	00 00 00 
+  80197f:	ff d0                	call   *%rax
+    while (res < 0) {
+  801981:	85 c0                	test   %eax,%eax
+  801983:	79 65                	jns    8019ea <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  801985:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801988:	75 33                	jne    8019bd <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80198a:	49 bf ce 12 80 00 00 	movabs $0x8012ce,%r15
+  801991:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801994:	49 be cb 15 80 00 00 	movabs $0x8015cb,%r14
+  80199b:	00 00 00 
+        sys_yield();
+  80199e:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8019a1:	45 89 e8             	mov    %r13d,%r8d
+  8019a4:	4c 89 e1             	mov    %r12,%rcx
+  8019a7:	48 89 da             	mov    %rbx,%rdx
+  8019aa:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8019ae:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8019b1:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	79 32                	jns    8019ea <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8019b8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8019bb:	74 e1                	je     80199e <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8019bd:	89 c1                	mov    %eax,%ecx
+  8019bf:	48 ba bb 3e 80 00 00 	movabs $0x803ebb,%rdx
+  8019c6:	00 00 00 
+  8019c9:	be 52 00 00 00       	mov    $0x52,%esi
+  8019ce:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  8019d5:	00 00 00 
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	49 b8 5c 02 80 00 00 	movabs $0x80025c,%r8
+  8019e4:	00 00 00 
+  8019e7:	41 ff d0             	call   *%r8
+    }
+}
+  8019ea:	48 83 c4 18          	add    $0x18,%rsp
+  8019ee:	5b                   	pop    %rbx
+  8019ef:	41 5c                	pop    %r12
+  8019f1:	41 5d                	pop    %r13
+  8019f3:	41 5e                	pop    %r14
+  8019f5:	41 5f                	pop    %r15
+  8019f7:	5d                   	pop    %rbp
+  8019f8:	c3                   	ret
+
+00000000008019f9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8019f9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8019fe:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a05:	00 00 00 
+  801a08:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801a0c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801a10:	48 c1 e2 04          	shl    $0x4,%rdx
+  801a14:	48 01 ca             	add    %rcx,%rdx
+  801a17:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801a1d:	39 fa                	cmp    %edi,%edx
+  801a1f:	74 12                	je     801a33 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  801a21:	48 83 c0 01          	add    $0x1,%rax
+  801a25:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801a2b:	75 db                	jne    801a08 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a32:	c3                   	ret
+            return envs[i].env_id;
+  801a33:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801a37:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801a3b:	48 c1 e2 04          	shl    $0x4,%rdx
+  801a3f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  801a46:	00 00 00 
+  801a49:	48 01 d0             	add    %rdx,%rax
+  801a4c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801a52:	c3                   	ret
+
+0000000000801a53 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a53:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a5a:	ff ff ff 
+  801a5d:	48 01 f8             	add    %rdi,%rax
+  801a60:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a64:	c3                   	ret
+
+0000000000801a65 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a65:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a6c:	ff ff ff 
+  801a6f:	48 01 f8             	add    %rdi,%rax
+  801a72:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a76:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a7c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a80:	c3                   	ret
+
+0000000000801a81 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	41 57                	push   %r15
+  801a87:	41 56                	push   %r14
+  801a89:	41 55                	push   %r13
+  801a8b:	41 54                	push   %r12
+  801a8d:	53                   	push   %rbx
+  801a8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801a92:	49 89 ff             	mov    %rdi,%r15
+  801a95:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a9a:	49 bd a0 35 80 00 00 	movabs $0x8035a0,%r13
+  801aa1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801aa4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801aaa:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801aad:	48 89 df             	mov    %rbx,%rdi
+  801ab0:	41 ff d5             	call   *%r13
+  801ab3:	83 e0 04             	and    $0x4,%eax
+  801ab6:	74 17                	je     801acf <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ab8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801abf:	4c 39 f3             	cmp    %r14,%rbx
+  801ac2:	75 e6                	jne    801aaa <fd_alloc+0x29>
+  801ac4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801aca:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801acf:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ad2:	48 83 c4 08          	add    $0x8,%rsp
+  801ad6:	5b                   	pop    %rbx
+  801ad7:	41 5c                	pop    %r12
+  801ad9:	41 5d                	pop    %r13
+  801adb:	41 5e                	pop    %r14
+  801add:	41 5f                	pop    %r15
+  801adf:	5d                   	pop    %rbp
+  801ae0:	c3                   	ret
+
+0000000000801ae1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ae1:	83 ff 1f             	cmp    $0x1f,%edi
+  801ae4:	77 39                	ja     801b1f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ae6:	55                   	push   %rbp
+  801ae7:	48 89 e5             	mov    %rsp,%rbp
+  801aea:	41 54                	push   %r12
+  801aec:	53                   	push   %rbx
+  801aed:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801af0:	48 63 df             	movslq %edi,%rbx
+  801af3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801afa:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801afe:	48 89 df             	mov    %rbx,%rdi
+  801b01:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  801b08:	00 00 00 
+  801b0b:	ff d0                	call   *%rax
+  801b0d:	a8 04                	test   $0x4,%al
+  801b0f:	74 14                	je     801b25 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b11:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b1a:	5b                   	pop    %rbx
+  801b1b:	41 5c                	pop    %r12
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+        return -E_INVAL;
+  801b1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b24:	c3                   	ret
+        return -E_INVAL;
+  801b25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2a:	eb ee                	jmp    801b1a <fd_lookup+0x39>
+
+0000000000801b2c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b2c:	55                   	push   %rbp
+  801b2d:	48 89 e5             	mov    %rsp,%rbp
+  801b30:	41 54                	push   %r12
+  801b32:	53                   	push   %rbx
+  801b33:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b36:	48 b8 80 3f 80 00 00 	movabs $0x803f80,%rax
+  801b3d:	00 00 00 
+  801b40:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b47:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b4a:	39 3b                	cmp    %edi,(%rbx)
+  801b4c:	74 47                	je     801b95 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b4e:	48 83 c0 08          	add    $0x8,%rax
+  801b52:	48 8b 18             	mov    (%rax),%rbx
+  801b55:	48 85 db             	test   %rbx,%rbx
+  801b58:	75 f0                	jne    801b4a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b5a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b61:	00 00 00 
+  801b64:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b6a:	89 fa                	mov    %edi,%edx
+  801b6c:	48 bf e0 3e 80 00 00 	movabs $0x803ee0,%rdi
+  801b73:	00 00 00 
+  801b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7b:	48 b9 ac 03 80 00 00 	movabs $0x8003ac,%rcx
+  801b82:	00 00 00 
+  801b85:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b8c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b90:	5b                   	pop    %rbx
+  801b91:	41 5c                	pop    %r12
+  801b93:	5d                   	pop    %rbp
+  801b94:	c3                   	ret
+            return 0;
+  801b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9a:	eb f0                	jmp    801b8c <dev_lookup+0x60>
+
+0000000000801b9c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	41 55                	push   %r13
+  801ba2:	41 54                	push   %r12
+  801ba4:	53                   	push   %rbx
+  801ba5:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba9:	48 89 fb             	mov    %rdi,%rbx
+  801bac:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801baf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bb6:	ff ff ff 
+  801bb9:	48 01 df             	add    %rbx,%rdi
+  801bbc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bc0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bc4:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+  801bd0:	41 89 c5             	mov    %eax,%r13d
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	78 06                	js     801bdd <fd_close+0x41>
+  801bd7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bdb:	74 1a                	je     801bf7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bdd:	45 84 e4             	test   %r12b,%r12b
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801be9:	44 89 e8             	mov    %r13d,%eax
+  801bec:	48 83 c4 18          	add    $0x18,%rsp
+  801bf0:	5b                   	pop    %rbx
+  801bf1:	41 5c                	pop    %r12
+  801bf3:	41 5d                	pop    %r13
+  801bf5:	5d                   	pop    %rbp
+  801bf6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bf7:	8b 3b                	mov    (%rbx),%edi
+  801bf9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bfd:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  801c04:	00 00 00 
+  801c07:	ff d0                	call   *%rax
+  801c09:	41 89 c5             	mov    %eax,%r13d
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 1b                	js     801c2b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c14:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801c18:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c1e:	48 85 c0             	test   %rax,%rax
+  801c21:	74 08                	je     801c2b <fd_close+0x8f>
+  801c23:	48 89 df             	mov    %rbx,%rdi
+  801c26:	ff d0                	call   *%rax
+  801c28:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c2b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c30:	48 89 de             	mov    %rbx,%rsi
+  801c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c38:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+    return res;
+  801c44:	eb a3                	jmp    801be9 <fd_close+0x4d>
+
+0000000000801c46 <close>:
+
+int
+close(int fdnum) {
+  801c46:	55                   	push   %rbp
+  801c47:	48 89 e5             	mov    %rsp,%rbp
+  801c4a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c4e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c52:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 15                	js     801c77 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c62:	be 01 00 00 00       	mov    $0x1,%esi
+  801c67:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c6b:	48 b8 9c 1b 80 00 00 	movabs $0x801b9c,%rax
+  801c72:	00 00 00 
+  801c75:	ff d0                	call   *%rax
+}
+  801c77:	c9                   	leave
+  801c78:	c3                   	ret
+
+0000000000801c79 <close_all>:
+
+void
+close_all(void) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 54                	push   %r12
+  801c7f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c85:	49 bc 46 1c 80 00 00 	movabs $0x801c46,%r12
+  801c8c:	00 00 00 
+  801c8f:	89 df                	mov    %ebx,%edi
+  801c91:	41 ff d4             	call   *%r12
+  801c94:	83 c3 01             	add    $0x1,%ebx
+  801c97:	83 fb 20             	cmp    $0x20,%ebx
+  801c9a:	75 f3                	jne    801c8f <close_all+0x16>
+}
+  801c9c:	5b                   	pop    %rbx
+  801c9d:	41 5c                	pop    %r12
+  801c9f:	5d                   	pop    %rbp
+  801ca0:	c3                   	ret
+
+0000000000801ca1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	41 57                	push   %r15
+  801ca7:	41 56                	push   %r14
+  801ca9:	41 55                	push   %r13
+  801cab:	41 54                	push   %r12
+  801cad:	53                   	push   %rbx
+  801cae:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cb5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801cb9:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+  801cc5:	89 c3                	mov    %eax,%ebx
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	0f 88 b8 00 00 00    	js     801d87 <dup+0xe6>
+    close(newfdnum);
+  801ccf:	44 89 e7             	mov    %r12d,%edi
+  801cd2:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cde:	4d 63 ec             	movslq %r12d,%r13
+  801ce1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ce8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cec:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cf0:	4c 89 ff             	mov    %r15,%rdi
+  801cf3:	49 be 65 1a 80 00 00 	movabs $0x801a65,%r14
+  801cfa:	00 00 00 
+  801cfd:	41 ff d6             	call   *%r14
+  801d00:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d03:	4c 89 ef             	mov    %r13,%rdi
+  801d06:	41 ff d6             	call   *%r14
+  801d09:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d0c:	48 89 df             	mov    %rbx,%rdi
+  801d0f:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d1b:	a8 04                	test   $0x4,%al
+  801d1d:	74 2b                	je     801d4a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d1f:	41 89 c1             	mov    %eax,%r9d
+  801d22:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d28:	4c 89 f1             	mov    %r14,%rcx
+  801d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d30:	48 89 de             	mov    %rbx,%rsi
+  801d33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d38:	48 b8 c4 13 80 00 00 	movabs $0x8013c4,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+  801d44:	89 c3                	mov    %eax,%ebx
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	78 4e                	js     801d98 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d4a:	4c 89 ff             	mov    %r15,%rdi
+  801d4d:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  801d54:	00 00 00 
+  801d57:	ff d0                	call   *%rax
+  801d59:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d5c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d62:	4c 89 e9             	mov    %r13,%rcx
+  801d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6a:	4c 89 fe             	mov    %r15,%rsi
+  801d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d72:	48 b8 c4 13 80 00 00 	movabs $0x8013c4,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	89 c3                	mov    %eax,%ebx
+  801d80:	85 c0                	test   %eax,%eax
+  801d82:	78 14                	js     801d98 <dup+0xf7>
+
+    return newfdnum;
+  801d84:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d87:	89 d8                	mov    %ebx,%eax
+  801d89:	48 83 c4 18          	add    $0x18,%rsp
+  801d8d:	5b                   	pop    %rbx
+  801d8e:	41 5c                	pop    %r12
+  801d90:	41 5d                	pop    %r13
+  801d92:	41 5e                	pop    %r14
+  801d94:	41 5f                	pop    %r15
+  801d96:	5d                   	pop    %rbp
+  801d97:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d9d:	4c 89 ee             	mov    %r13,%rsi
+  801da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da5:	49 bc 29 14 80 00 00 	movabs $0x801429,%r12
+  801dac:	00 00 00 
+  801daf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801db2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801db7:	4c 89 f6             	mov    %r14,%rsi
+  801dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbf:	41 ff d4             	call   *%r12
+    return res;
+  801dc2:	eb c3                	jmp    801d87 <dup+0xe6>
+
+0000000000801dc4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dc4:	55                   	push   %rbp
+  801dc5:	48 89 e5             	mov    %rsp,%rbp
+  801dc8:	41 56                	push   %r14
+  801dca:	41 55                	push   %r13
+  801dcc:	41 54                	push   %r12
+  801dce:	53                   	push   %rbx
+  801dcf:	48 83 ec 10          	sub    $0x10,%rsp
+  801dd3:	89 fb                	mov    %edi,%ebx
+  801dd5:	49 89 f4             	mov    %rsi,%r12
+  801dd8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ddb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ddf:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	85 c0                	test   %eax,%eax
+  801ded:	78 4c                	js     801e3b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801def:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801df3:	41 8b 3e             	mov    (%r14),%edi
+  801df6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dfa:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 35                	js     801e3f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e0a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e0e:	83 e0 03             	and    $0x3,%eax
+  801e11:	83 f8 01             	cmp    $0x1,%eax
+  801e14:	74 2d                	je     801e43 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e1a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e1e:	48 85 c0             	test   %rax,%rax
+  801e21:	74 56                	je     801e79 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e23:	4c 89 ea             	mov    %r13,%rdx
+  801e26:	4c 89 e6             	mov    %r12,%rsi
+  801e29:	4c 89 f7             	mov    %r14,%rdi
+  801e2c:	ff d0                	call   *%rax
+}
+  801e2e:	48 83 c4 10          	add    $0x10,%rsp
+  801e32:	5b                   	pop    %rbx
+  801e33:	41 5c                	pop    %r12
+  801e35:	41 5d                	pop    %r13
+  801e37:	41 5e                	pop    %r14
+  801e39:	5d                   	pop    %rbp
+  801e3a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3b:	48 98                	cltq
+  801e3d:	eb ef                	jmp    801e2e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3f:	48 98                	cltq
+  801e41:	eb eb                	jmp    801e2e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e43:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e4a:	00 00 00 
+  801e4d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e53:	89 da                	mov    %ebx,%edx
+  801e55:	48 bf 41 3f 80 00 00 	movabs $0x803f41,%rdi
+  801e5c:	00 00 00 
+  801e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e64:	48 b9 ac 03 80 00 00 	movabs $0x8003ac,%rcx
+  801e6b:	00 00 00 
+  801e6e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e70:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e77:	eb b5                	jmp    801e2e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e79:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e80:	eb ac                	jmp    801e2e <read+0x6a>
+
+0000000000801e82 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801e82:	55                   	push   %rbp
+  801e83:	48 89 e5             	mov    %rsp,%rbp
+  801e86:	41 56                	push   %r14
+  801e88:	41 55                	push   %r13
+  801e8a:	41 54                	push   %r12
+  801e8c:	53                   	push   %rbx
+  801e8d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e91:	89 fb                	mov    %edi,%ebx
+  801e93:	49 89 f4             	mov    %rsi,%r12
+  801e96:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e99:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e9d:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801ea4:	00 00 00 
+  801ea7:	ff d0                	call   *%rax
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 41                	js     801eee <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ead:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801eb1:	41 8b 3e             	mov    (%r14),%edi
+  801eb4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eb8:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	85 c0                	test   %eax,%eax
+  801ec6:	78 35                	js     801efd <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ec8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ecc:	83 e0 03             	and    $0x3,%eax
+  801ecf:	83 f8 01             	cmp    $0x1,%eax
+  801ed2:	74 2d                	je     801f01 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ed4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801edc:	48 85 c0             	test   %rax,%rax
+  801edf:	74 56                	je     801f37 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801ee1:	4c 89 ea             	mov    %r13,%rdx
+  801ee4:	4c 89 e6             	mov    %r12,%rsi
+  801ee7:	4c 89 f7             	mov    %r14,%rdi
+  801eea:	ff d0                	call   *%rax
+  801eec:	eb 02                	jmp    801ef0 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eee:	48 98                	cltq
+}
+  801ef0:	48 83 c4 10          	add    $0x10,%rsp
+  801ef4:	5b                   	pop    %rbx
+  801ef5:	41 5c                	pop    %r12
+  801ef7:	41 5d                	pop    %r13
+  801ef9:	41 5e                	pop    %r14
+  801efb:	5d                   	pop    %rbp
+  801efc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801efd:	48 98                	cltq
+  801eff:	eb ef                	jmp    801ef0 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f01:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f08:	00 00 00 
+  801f0b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f11:	89 da                	mov    %ebx,%edx
+  801f13:	48 bf 00 3f 80 00 00 	movabs $0x803f00,%rdi
+  801f1a:	00 00 00 
+  801f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f22:	48 b9 ac 03 80 00 00 	movabs $0x8003ac,%rcx
+  801f29:	00 00 00 
+  801f2c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f2e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f35:	eb b9                	jmp    801ef0 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f37:	4c 89 ea             	mov    %r13,%rdx
+  801f3a:	4c 89 e6             	mov    %r12,%rsi
+  801f3d:	89 df                	mov    %ebx,%edi
+  801f3f:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	eb a3                	jmp    801ef0 <readmap+0x6e>
+
+0000000000801f4d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f4d:	55                   	push   %rbp
+  801f4e:	48 89 e5             	mov    %rsp,%rbp
+  801f51:	41 57                	push   %r15
+  801f53:	41 56                	push   %r14
+  801f55:	41 55                	push   %r13
+  801f57:	41 54                	push   %r12
+  801f59:	53                   	push   %rbx
+  801f5a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f5e:	48 85 d2             	test   %rdx,%rdx
+  801f61:	74 54                	je     801fb7 <readn+0x6a>
+  801f63:	41 89 fd             	mov    %edi,%r13d
+  801f66:	49 89 f6             	mov    %rsi,%r14
+  801f69:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f71:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f76:	49 bf c4 1d 80 00 00 	movabs $0x801dc4,%r15
+  801f7d:	00 00 00 
+  801f80:	4c 89 e2             	mov    %r12,%rdx
+  801f83:	48 29 f2             	sub    %rsi,%rdx
+  801f86:	4c 01 f6             	add    %r14,%rsi
+  801f89:	44 89 ef             	mov    %r13d,%edi
+  801f8c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	78 20                	js     801fb3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f93:	01 c3                	add    %eax,%ebx
+  801f95:	85 c0                	test   %eax,%eax
+  801f97:	74 08                	je     801fa1 <readn+0x54>
+  801f99:	48 63 f3             	movslq %ebx,%rsi
+  801f9c:	4c 39 e6             	cmp    %r12,%rsi
+  801f9f:	72 df                	jb     801f80 <readn+0x33>
+    }
+    return res;
+  801fa1:	48 63 c3             	movslq %ebx,%rax
+}
+  801fa4:	48 83 c4 08          	add    $0x8,%rsp
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	41 5d                	pop    %r13
+  801fad:	41 5e                	pop    %r14
+  801faf:	41 5f                	pop    %r15
+  801fb1:	5d                   	pop    %rbp
+  801fb2:	c3                   	ret
+        if (inc < 0) return inc;
+  801fb3:	48 98                	cltq
+  801fb5:	eb ed                	jmp    801fa4 <readn+0x57>
+    int inc = 1, res = 0;
+  801fb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fbc:	eb e3                	jmp    801fa1 <readn+0x54>
+
+0000000000801fbe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	41 56                	push   %r14
+  801fc4:	41 55                	push   %r13
+  801fc6:	41 54                	push   %r12
+  801fc8:	53                   	push   %rbx
+  801fc9:	48 83 ec 10          	sub    $0x10,%rsp
+  801fcd:	89 fb                	mov    %edi,%ebx
+  801fcf:	49 89 f4             	mov    %rsi,%r12
+  801fd2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd9:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	78 47                	js     802030 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fed:	41 8b 3e             	mov    (%r14),%edi
+  801ff0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff4:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 30                	js     802034 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802004:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802009:	74 2d                	je     802038 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80200b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80200f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802013:	48 85 c0             	test   %rax,%rax
+  802016:	74 56                	je     80206e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802018:	4c 89 ea             	mov    %r13,%rdx
+  80201b:	4c 89 e6             	mov    %r12,%rsi
+  80201e:	4c 89 f7             	mov    %r14,%rdi
+  802021:	ff d0                	call   *%rax
+}
+  802023:	48 83 c4 10          	add    $0x10,%rsp
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	41 5d                	pop    %r13
+  80202c:	41 5e                	pop    %r14
+  80202e:	5d                   	pop    %rbp
+  80202f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802030:	48 98                	cltq
+  802032:	eb ef                	jmp    802023 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802034:	48 98                	cltq
+  802036:	eb eb                	jmp    802023 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802038:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80203f:	00 00 00 
+  802042:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802048:	89 da                	mov    %ebx,%edx
+  80204a:	48 bf 5d 3f 80 00 00 	movabs $0x803f5d,%rdi
+  802051:	00 00 00 
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+  802059:	48 b9 ac 03 80 00 00 	movabs $0x8003ac,%rcx
+  802060:	00 00 00 
+  802063:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802065:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80206c:	eb b5                	jmp    802023 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80206e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802075:	eb ac                	jmp    802023 <write+0x65>
+
+0000000000802077 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	53                   	push   %rbx
+  80207c:	48 83 ec 18          	sub    $0x18,%rsp
+  802080:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802082:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802086:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+  802092:	85 c0                	test   %eax,%eax
+  802094:	78 0c                	js     8020a2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802096:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80209a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80209d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020a6:	c9                   	leave
+  8020a7:	c3                   	ret
+
+00000000008020a8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020a8:	55                   	push   %rbp
+  8020a9:	48 89 e5             	mov    %rsp,%rbp
+  8020ac:	41 55                	push   %r13
+  8020ae:	41 54                	push   %r12
+  8020b0:	53                   	push   %rbx
+  8020b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8020b5:	89 fb                	mov    %edi,%ebx
+  8020b7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020ba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020be:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	78 38                	js     802106 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ce:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020d2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020da:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	78 1c                	js     802106 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020ea:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020ef:	74 20                	je     802111 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020f5:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8020f9:	48 85 c0             	test   %rax,%rax
+  8020fc:	74 47                	je     802145 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020fe:	44 89 e6             	mov    %r12d,%esi
+  802101:	4c 89 ef             	mov    %r13,%rdi
+  802104:	ff d0                	call   *%rax
+}
+  802106:	48 83 c4 18          	add    $0x18,%rsp
+  80210a:	5b                   	pop    %rbx
+  80210b:	41 5c                	pop    %r12
+  80210d:	41 5d                	pop    %r13
+  80210f:	5d                   	pop    %rbp
+  802110:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802111:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802118:	00 00 00 
+  80211b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802121:	89 da                	mov    %ebx,%edx
+  802123:	48 bf 20 3f 80 00 00 	movabs $0x803f20,%rdi
+  80212a:	00 00 00 
+  80212d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802132:	48 b9 ac 03 80 00 00 	movabs $0x8003ac,%rcx
+  802139:	00 00 00 
+  80213c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80213e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802143:	eb c1                	jmp    802106 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802145:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80214a:	eb ba                	jmp    802106 <ftruncate+0x5e>
+
+000000000080214c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80214c:	55                   	push   %rbp
+  80214d:	48 89 e5             	mov    %rsp,%rbp
+  802150:	41 54                	push   %r12
+  802152:	53                   	push   %rbx
+  802153:	48 83 ec 10          	sub    $0x10,%rsp
+  802157:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80215a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80215e:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	78 4e                	js     8021bc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80216e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802172:	41 8b 3c 24          	mov    (%r12),%edi
+  802176:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80217a:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 32                	js     8021bc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80218a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80218e:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802193:	74 30                	je     8021c5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802195:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802198:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80219f:	00 00 00 
+    stat->st_isdir = 0;
+  8021a2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021a9:	00 00 00 
+    stat->st_dev = dev;
+  8021ac:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021b3:	48 89 de             	mov    %rbx,%rsi
+  8021b6:	4c 89 e7             	mov    %r12,%rdi
+  8021b9:	ff 50 30             	call   *0x30(%rax)
+}
+  8021bc:	48 83 c4 10          	add    $0x10,%rsp
+  8021c0:	5b                   	pop    %rbx
+  8021c1:	41 5c                	pop    %r12
+  8021c3:	5d                   	pop    %rbp
+  8021c4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021ca:	eb f0                	jmp    8021bc <fstat+0x70>
+
+00000000008021cc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021cc:	55                   	push   %rbp
+  8021cd:	48 89 e5             	mov    %rsp,%rbp
+  8021d0:	41 54                	push   %r12
+  8021d2:	53                   	push   %rbx
+  8021d3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021db:	48 b8 23 2f 80 00 00 	movabs $0x802f23,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 25                	js     802212 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021ed:	4c 89 e6             	mov    %r12,%rsi
+  8021f0:	89 c7                	mov    %eax,%edi
+  8021f2:	48 b8 4c 21 80 00 00 	movabs $0x80214c,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802201:	89 df                	mov    %ebx,%edi
+  802203:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  80220a:	00 00 00 
+  80220d:	ff d0                	call   *%rax
+
+    return res;
+  80220f:	44 89 e3             	mov    %r12d,%ebx
+}
+  802212:	89 d8                	mov    %ebx,%eax
+  802214:	5b                   	pop    %rbx
+  802215:	41 5c                	pop    %r12
+  802217:	5d                   	pop    %rbp
+  802218:	c3                   	ret
+
+0000000000802219 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802219:	55                   	push   %rbp
+  80221a:	48 89 e5             	mov    %rsp,%rbp
+  80221d:	41 54                	push   %r12
+  80221f:	53                   	push   %rbx
+  802220:	48 83 ec 10          	sub    $0x10,%rsp
+  802224:	48 89 fb             	mov    %rdi,%rbx
+  802227:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80222a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80222e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802233:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	78 1f                	js     802262 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802247:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80224b:	48 85 c0             	test   %rax,%rax
+  80224e:	74 1b                	je     80226b <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802250:	4c 89 e6             	mov    %r12,%rsi
+  802253:	48 89 df             	mov    %rbx,%rdi
+  802256:	ff d0                	call   *%rax
+    if (res < 0) {
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802262:	48 83 c4 10          	add    $0x10,%rsp
+  802266:	5b                   	pop    %rbx
+  802267:	41 5c                	pop    %r12
+  802269:	5d                   	pop    %rbp
+  80226a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80226b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802270:	eb f0                	jmp    802262 <create_snapshot+0x49>
+
+0000000000802272 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802272:	55                   	push   %rbp
+  802273:	48 89 e5             	mov    %rsp,%rbp
+  802276:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80227a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80227e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802283:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 1e                	js     8022b1 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802297:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80229b:	48 85 d2             	test   %rdx,%rdx
+  80229e:	74 13                	je     8022b3 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8022a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a5:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ae:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022b1:	c9                   	leave
+  8022b2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022b3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022b8:	eb f7                	jmp    8022b1 <print_snapshot_list+0x3f>
+
+00000000008022ba <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8022ba:	55                   	push   %rbp
+  8022bb:	48 89 e5             	mov    %rsp,%rbp
+  8022be:	53                   	push   %rbx
+  8022bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c3:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022ca:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022cf:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	78 1c                	js     8022fb <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8022df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022e3:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8022e7:	48 85 c0             	test   %rax,%rax
+  8022ea:	74 15                	je     802301 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8022ec:	48 89 df             	mov    %rbx,%rdi
+  8022ef:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f8:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022ff:	c9                   	leave
+  802300:	c3                   	ret
+        return -E_NOT_SUPP;
+  802301:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802306:	eb f3                	jmp    8022fb <accept_snapshot+0x41>
+
+0000000000802308 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802308:	55                   	push   %rbp
+  802309:	48 89 e5             	mov    %rsp,%rbp
+  80230c:	53                   	push   %rbx
+  80230d:	48 83 ec 18          	sub    $0x18,%rsp
+  802311:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802314:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802318:	bf 66 00 00 00       	mov    $0x66,%edi
+  80231d:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	78 1c                	js     802349 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80232d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802331:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802335:	48 85 c0             	test   %rax,%rax
+  802338:	74 15                	je     80234f <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80233a:	48 89 df             	mov    %rbx,%rdi
+  80233d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	ba 00 00 00 00       	mov    $0x0,%edx
+  802346:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80234f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802354:	eb f3                	jmp    802349 <delete_snapshot+0x41>
+
+0000000000802356 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80235e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802362:	bf 66 00 00 00       	mov    $0x66,%edi
+  802367:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+  802373:	85 c0                	test   %eax,%eax
+  802375:	78 14                	js     80238b <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80237b:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80237f:	48 85 d2             	test   %rdx,%rdx
+  802382:	74 09                	je     80238d <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802384:	b8 00 00 00 00       	mov    $0x0,%eax
+  802389:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80238b:	c9                   	leave
+  80238c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80238d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802392:	eb f7                	jmp    80238b <gc_snapshots+0x35>
+
+0000000000802394 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	41 56                	push   %r14
+  80239a:	41 55                	push   %r13
+  80239c:	41 54                	push   %r12
+  80239e:	53                   	push   %rbx
+  80239f:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a3:	48 89 fb             	mov    %rdi,%rbx
+  8023a6:	49 89 f4             	mov    %rsi,%r12
+  8023a9:	49 89 d5             	mov    %rdx,%r13
+  8023ac:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023af:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023b3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023b8:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	78 1b                	js     8023e3 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8023c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023cc:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8023d0:	48 85 c0             	test   %rax,%rax
+  8023d3:	74 1b                	je     8023f0 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8023d5:	4c 89 f1             	mov    %r14,%rcx
+  8023d8:	4c 89 ea             	mov    %r13,%rdx
+  8023db:	4c 89 e6             	mov    %r12,%rsi
+  8023de:	48 89 df             	mov    %rbx,%rdi
+  8023e1:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023e3:	48 83 c4 10          	add    $0x10,%rsp
+  8023e7:	5b                   	pop    %rbx
+  8023e8:	41 5c                	pop    %r12
+  8023ea:	41 5d                	pop    %r13
+  8023ec:	41 5e                	pop    %r14
+  8023ee:	5d                   	pop    %rbp
+  8023ef:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023f5:	eb ec                	jmp    8023e3 <diff_snapshots+0x4f>
+
+00000000008023f7 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8023f7:	55                   	push   %rbp
+  8023f8:	48 89 e5             	mov    %rsp,%rbp
+  8023fb:	41 55                	push   %r13
+  8023fd:	41 54                	push   %r12
+  8023ff:	53                   	push   %rbx
+  802400:	48 83 ec 18          	sub    $0x18,%rsp
+  802404:	48 89 fb             	mov    %rdi,%rbx
+  802407:	49 89 f4             	mov    %rsi,%r12
+  80240a:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80240d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802411:	bf 66 00 00 00       	mov    $0x66,%edi
+  802416:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+  802422:	85 c0                	test   %eax,%eax
+  802424:	78 18                	js     80243e <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802426:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80242a:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80242e:	48 85 c0             	test   %rax,%rax
+  802431:	74 16                	je     802449 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802433:	4c 89 ea             	mov    %r13,%rdx
+  802436:	4c 89 e6             	mov    %r12,%rsi
+  802439:	48 89 df             	mov    %rbx,%rdi
+  80243c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80243e:	48 83 c4 18          	add    $0x18,%rsp
+  802442:	5b                   	pop    %rbx
+  802443:	41 5c                	pop    %r12
+  802445:	41 5d                	pop    %r13
+  802447:	5d                   	pop    %rbp
+  802448:	c3                   	ret
+        return -E_NOT_SUPP;
+  802449:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80244e:	eb ee                	jmp    80243e <send_snapshot+0x47>
+
+0000000000802450 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802450:	55                   	push   %rbp
+  802451:	48 89 e5             	mov    %rsp,%rbp
+  802454:	53                   	push   %rbx
+  802455:	48 83 ec 18          	sub    $0x18,%rsp
+  802459:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80245c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802460:	bf 66 00 00 00       	mov    $0x66,%edi
+  802465:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+  802471:	85 c0                	test   %eax,%eax
+  802473:	78 12                	js     802487 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802475:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802479:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80247d:	48 85 c0             	test   %rax,%rax
+  802480:	74 0b                	je     80248d <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802482:	48 89 df             	mov    %rbx,%rdi
+  802485:	ff d0                	call   *%rax
+
+    return res;
+}
+  802487:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80248b:	c9                   	leave
+  80248c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80248d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802492:	eb f3                	jmp    802487 <receive_snapshot+0x37>
+
+0000000000802494 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802494:	55                   	push   %rbp
+  802495:	48 89 e5             	mov    %rsp,%rbp
+  802498:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80249c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024a0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024a5:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	78 17                	js     8024cc <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8024b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b9:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8024c0:	48 85 d2             	test   %rdx,%rdx
+  8024c3:	74 09                	je     8024ce <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024ce:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024d3:	eb f7                	jmp    8024cc <free_space_bytes+0x38>
+
+00000000008024d5 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8024d5:	55                   	push   %rbp
+  8024d6:	48 89 e5             	mov    %rsp,%rbp
+  8024d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024e1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024e6:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	78 17                	js     80250d <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8024f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024fa:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802501:	48 85 d2             	test   %rdx,%rdx
+  802504:	74 09                	je     80250f <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250b:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80250d:	c9                   	leave
+  80250e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80250f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802514:	eb f7                	jmp    80250d <busy_space_bytes+0x38>
+
+0000000000802516 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	41 54                	push   %r12
+  80251c:	53                   	push   %rbx
+  80251d:	48 83 ec 10          	sub    $0x10,%rsp
+  802521:	89 fb                	mov    %edi,%ebx
+  802523:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802526:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80252a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80252f:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	78 17                	js     802556 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80253f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802543:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80254a:	48 85 c0             	test   %rax,%rax
+  80254d:	74 10                	je     80255f <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80254f:	4c 89 e6             	mov    %r12,%rsi
+  802552:	89 df                	mov    %ebx,%edi
+  802554:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802556:	48 83 c4 10          	add    $0x10,%rsp
+  80255a:	5b                   	pop    %rbx
+  80255b:	41 5c                	pop    %r12
+  80255d:	5d                   	pop    %rbp
+  80255e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80255f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802564:	eb f0                	jmp    802556 <snapshots_space+0x40>
+
+0000000000802566 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	41 55                	push   %r13
+  80256c:	41 54                	push   %r12
+  80256e:	53                   	push   %rbx
+  80256f:	48 83 ec 08          	sub    $0x8,%rsp
+  802573:	41 89 fd             	mov    %edi,%r13d
+  802576:	48 89 f3             	mov    %rsi,%rbx
+  802579:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80257c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802583:	00 00 00 
+  802586:	83 38 00             	cmpl   $0x0,(%rax)
+  802589:	74 57                	je     8025e2 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80258b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802591:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802596:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80259d:	00 00 00 
+  8025a0:	44 89 ee             	mov    %r13d,%esi
+  8025a3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8025aa:	00 00 00 
+  8025ad:	8b 38                	mov    (%rax),%edi
+  8025af:	48 b8 3b 19 80 00 00 	movabs $0x80193b,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8025bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c0:	4c 89 e2             	mov    %r12,%rdx
+  8025c3:	48 89 de             	mov    %rbx,%rsi
+  8025c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025cb:	48 b8 23 19 80 00 00 	movabs $0x801923,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+}
+  8025d7:	48 83 c4 08          	add    $0x8,%rsp
+  8025db:	5b                   	pop    %rbx
+  8025dc:	41 5c                	pop    %r12
+  8025de:	41 5d                	pop    %r13
+  8025e0:	5d                   	pop    %rbp
+  8025e1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025e7:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8025fa:	00 00 
+  8025fc:	eb 8d                	jmp    80258b <fsipc_region+0x25>
+
+00000000008025fe <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8025fe:	55                   	push   %rbp
+  8025ff:	48 89 e5             	mov    %rsp,%rbp
+  802602:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802606:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80260d:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80260e:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802612:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  802619:	00 00 00 
+  80261c:	ff d0                	call   *%rax
+}
+  80261e:	c9                   	leave
+  80261f:	c3                   	ret
+
+0000000000802620 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802620:	85 ff                	test   %edi,%edi
+  802622:	78 6d                	js     802691 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802624:	55                   	push   %rbp
+  802625:	48 89 e5             	mov    %rsp,%rbp
+  802628:	41 54                	push   %r12
+  80262a:	53                   	push   %rbx
+  80262b:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80262e:	48 85 f6             	test   %rsi,%rsi
+  802631:	74 57                	je     80268a <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802633:	89 f8                	mov    %edi,%eax
+  802635:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80263c:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80263e:	be 00 00 00 00       	mov    $0x0,%esi
+  802643:	bf 12 00 00 00       	mov    $0x12,%edi
+  802648:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 2d                	js     802685 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802658:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80265f:	00 00 00 
+  802662:	49 63 14 24          	movslq (%r12),%rdx
+  802666:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80266d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802672:	48 89 df             	mov    %rbx,%rdi
+  802675:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802681:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802685:	5b                   	pop    %rbx
+  802686:	41 5c                	pop    %r12
+  802688:	5d                   	pop    %rbp
+  802689:	c3                   	ret
+        return -E_INVAL;
+  80268a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80268f:	eb f4                	jmp    802685 <devfile_df_snapshots+0x65>
+  802691:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802696:	c3                   	ret
+
+0000000000802697 <devfile_df_busy>:
+devfile_df_busy() {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80269b:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a0:	bf 11 00 00 00       	mov    $0x11,%edi
+  8026a5:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  8026ac:	00 00 00 
+  8026af:	ff d0                	call   *%rax
+}
+  8026b1:	5d                   	pop    %rbp
+  8026b2:	c3                   	ret
+
+00000000008026b3 <devfile_df_free>:
+devfile_df_free() {
+  8026b3:	55                   	push   %rbp
+  8026b4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8026b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026bc:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026c1:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  8026c8:	00 00 00 
+  8026cb:	ff d0                	call   *%rax
+}
+  8026cd:	5d                   	pop    %rbp
+  8026ce:	c3                   	ret
+
+00000000008026cf <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8026cf:	55                   	push   %rbp
+  8026d0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8026d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8026dd:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  8026e4:	00 00 00 
+  8026e7:	ff d0                	call   *%rax
+}
+  8026e9:	5d                   	pop    %rbp
+  8026ea:	c3                   	ret
+
+00000000008026eb <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8026eb:	55                   	push   %rbp
+  8026ec:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8026ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8026f9:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802700:	00 00 00 
+  802703:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802705:	85 c0                	test   %eax,%eax
+  802707:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80270f:	5d                   	pop    %rbp
+  802710:	c3                   	ret
+
+0000000000802711 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802715:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80271c:	00 00 00 
+  80271f:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802722:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802724:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802727:	be 00 00 00 00       	mov    $0x0,%esi
+  80272c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802731:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802738:	00 00 00 
+  80273b:	ff d0                	call   *%rax
+}
+  80273d:	5d                   	pop    %rbp
+  80273e:	c3                   	ret
+
+000000000080273f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802743:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802746:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80274d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80274f:	be 00 00 00 00       	mov    $0x0,%esi
+  802754:	bf 06 00 00 00       	mov    $0x6,%edi
+  802759:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+}
+  802765:	5d                   	pop    %rbp
+  802766:	c3                   	ret
+
+0000000000802767 <devfile_write>:
+    if (!fd || !buf) {
+  802767:	48 85 ff             	test   %rdi,%rdi
+  80276a:	0f 84 c1 00 00 00    	je     802831 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802770:	55                   	push   %rbp
+  802771:	48 89 e5             	mov    %rsp,%rbp
+  802774:	41 57                	push   %r15
+  802776:	41 56                	push   %r14
+  802778:	41 55                	push   %r13
+  80277a:	41 54                	push   %r12
+  80277c:	53                   	push   %rbx
+  80277d:	48 83 ec 18          	sub    $0x18,%rsp
+  802781:	49 89 ff             	mov    %rdi,%r15
+  802784:	49 89 f5             	mov    %rsi,%r13
+  802787:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80278a:	48 85 f6             	test   %rsi,%rsi
+  80278d:	0f 84 95 00 00 00    	je     802828 <devfile_write+0xc1>
+    while (n) {
+  802793:	48 85 d2             	test   %rdx,%rdx
+  802796:	0f 84 83 00 00 00    	je     80281f <devfile_write+0xb8>
+    int totalWrite = 0;
+  80279c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027a3:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8027aa:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8027ad:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8027b2:	49 39 dc             	cmp    %rbx,%r12
+  8027b5:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8027b9:	48 89 da             	mov    %rbx,%rdx
+  8027bc:	4c 89 ee             	mov    %r13,%rsi
+  8027bf:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8027c6:	00 00 00 
+  8027c9:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027d5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027d9:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8027dc:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8027e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027ea:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+        if (write < 0) {
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 21                	js     80281b <devfile_write+0xb4>
+        buf += write;
+  8027fa:	48 63 d0             	movslq %eax,%rdx
+  8027fd:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802800:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802803:	49 29 d4             	sub    %rdx,%r12
+  802806:	75 a5                	jne    8027ad <devfile_write+0x46>
+    return totalWrite;
+  802808:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80280c:	48 83 c4 18          	add    $0x18,%rsp
+  802810:	5b                   	pop    %rbx
+  802811:	41 5c                	pop    %r12
+  802813:	41 5d                	pop    %r13
+  802815:	41 5e                	pop    %r14
+  802817:	41 5f                	pop    %r15
+  802819:	5d                   	pop    %rbp
+  80281a:	c3                   	ret
+            return write;
+  80281b:	48 98                	cltq
+  80281d:	eb ed                	jmp    80280c <devfile_write+0xa5>
+    int totalWrite = 0;
+  80281f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802826:	eb e0                	jmp    802808 <devfile_write+0xa1>
+        return -E_INVAL;
+  802828:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80282f:	eb db                	jmp    80280c <devfile_write+0xa5>
+  802831:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802838:	c3                   	ret
+
+0000000000802839 <devfile_read>:
+    if (!fd || !buf) {
+  802839:	48 85 ff             	test   %rdi,%rdi
+  80283c:	0f 84 c0 00 00 00    	je     802902 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802842:	55                   	push   %rbp
+  802843:	48 89 e5             	mov    %rsp,%rbp
+  802846:	41 57                	push   %r15
+  802848:	41 56                	push   %r14
+  80284a:	41 55                	push   %r13
+  80284c:	41 54                	push   %r12
+  80284e:	53                   	push   %rbx
+  80284f:	48 83 ec 18          	sub    $0x18,%rsp
+  802853:	49 89 ff             	mov    %rdi,%r15
+  802856:	49 89 f5             	mov    %rsi,%r13
+  802859:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80285c:	48 85 f6             	test   %rsi,%rsi
+  80285f:	0f 84 96 00 00 00    	je     8028fb <devfile_read+0xc2>
+    while (n) {
+  802865:	48 85 d2             	test   %rdx,%rdx
+  802868:	0f 84 87 00 00 00    	je     8028f5 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80286e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802875:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802876:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80287d:	00 00 00 
+  802880:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802884:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802887:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80288c:	49 39 c4             	cmp    %rax,%r12
+  80288f:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802893:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802897:	be 00 00 00 00       	mov    $0x0,%esi
+  80289c:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028a1:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  8028a8:	00 00 00 
+  8028ab:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	7e 37                	jle    8028e8 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8028b1:	48 63 d8             	movslq %eax,%rbx
+  8028b4:	48 89 da             	mov    %rbx,%rdx
+  8028b7:	4c 89 f6             	mov    %r14,%rsi
+  8028ba:	4c 89 ef             	mov    %r13,%rdi
+  8028bd:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+        buf += read;
+  8028c9:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8028cc:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8028d0:	49 29 dc             	sub    %rbx,%r12
+  8028d3:	75 ab                	jne    802880 <devfile_read+0x47>
+  return totalRead;
+  8028d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8028d9:	48 83 c4 18          	add    $0x18,%rsp
+  8028dd:	5b                   	pop    %rbx
+  8028de:	41 5c                	pop    %r12
+  8028e0:	41 5d                	pop    %r13
+  8028e2:	41 5e                	pop    %r14
+  8028e4:	41 5f                	pop    %r15
+  8028e6:	5d                   	pop    %rbp
+  8028e7:	c3                   	ret
+            return read ? read : totalRead;
+  8028e8:	48 63 d0             	movslq %eax,%rdx
+  8028eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028ef:	48 0f 45 c2          	cmovne %rdx,%rax
+  8028f3:	eb e4                	jmp    8028d9 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8028f5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028f9:	eb da                	jmp    8028d5 <devfile_read+0x9c>
+        return E_INVAL;
+  8028fb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802900:	eb d7                	jmp    8028d9 <devfile_read+0xa0>
+  802902:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802907:	c3                   	ret
+
+0000000000802908 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802908:	48 85 ff             	test   %rdi,%rdi
+  80290b:	74 5f                	je     80296c <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80290d:	55                   	push   %rbp
+  80290e:	48 89 e5             	mov    %rsp,%rbp
+  802911:	53                   	push   %rbx
+  802912:	48 83 ec 08          	sub    $0x8,%rsp
+  802916:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802919:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+  802925:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80292b:	77 45                	ja     802972 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80292d:	48 89 de             	mov    %rbx,%rsi
+  802930:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802937:	00 00 00 
+  80293a:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802946:	be 00 00 00 00       	mov    $0x0,%esi
+  80294b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802950:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802957:	00 00 00 
+  80295a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802963:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802966:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80296a:	c9                   	leave
+  80296b:	c3                   	ret
+        return -E_INVAL;
+  80296c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802971:	c3                   	ret
+        return -E_INVAL;
+  802972:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802977:	eb ed                	jmp    802966 <devfile_receive_snapshot+0x5e>
+
+0000000000802979 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802979:	55                   	push   %rbp
+  80297a:	48 89 e5             	mov    %rsp,%rbp
+  80297d:	41 55                	push   %r13
+  80297f:	41 54                	push   %r12
+  802981:	53                   	push   %rbx
+  802982:	48 83 ec 08          	sub    $0x8,%rsp
+  802986:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802989:	48 85 f6             	test   %rsi,%rsi
+  80298c:	0f 94 c0             	sete   %al
+  80298f:	48 85 d2             	test   %rdx,%rdx
+  802992:	0f 94 c2             	sete   %dl
+  802995:	08 d0                	or     %dl,%al
+  802997:	0f 85 ad 00 00 00    	jne    802a4a <devfile_send_snapshot+0xd1>
+  80299d:	48 89 fb             	mov    %rdi,%rbx
+  8029a0:	49 89 f4             	mov    %rsi,%r12
+  8029a3:	48 85 ff             	test   %rdi,%rdi
+  8029a6:	0f 84 9e 00 00 00    	je     802a4a <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8029ac:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029be:	0f 87 8d 00 00 00    	ja     802a51 <devfile_send_snapshot+0xd8>
+  8029c4:	4c 89 e7             	mov    %r12,%rdi
+  8029c7:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+  8029d3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029d9:	77 7d                	ja     802a58 <devfile_send_snapshot+0xdf>
+  8029db:	4c 89 ef             	mov    %r13,%rdi
+  8029de:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8029e5:	00 00 00 
+  8029e8:	ff d0                	call   *%rax
+  8029ea:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029f0:	77 6d                	ja     802a5f <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8029f2:	48 89 de             	mov    %rbx,%rsi
+  8029f5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8029fc:	00 00 00 
+  8029ff:	48 bb d1 0c 80 00 00 	movabs $0x800cd1,%rbx
+  802a06:	00 00 00 
+  802a09:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802a0b:	4c 89 e6             	mov    %r12,%rsi
+  802a0e:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802a15:	00 00 00 
+  802a18:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802a1a:	4c 89 ee             	mov    %r13,%rsi
+  802a1d:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  802a24:	00 00 00 
+  802a27:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802a29:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2e:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802a33:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+}
+  802a3f:	48 83 c4 08          	add    $0x8,%rsp
+  802a43:	5b                   	pop    %rbx
+  802a44:	41 5c                	pop    %r12
+  802a46:	41 5d                	pop    %r13
+  802a48:	5d                   	pop    %rbp
+  802a49:	c3                   	ret
+        return -E_INVAL;
+  802a4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a4f:	eb ee                	jmp    802a3f <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802a51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a56:	eb e7                	jmp    802a3f <devfile_send_snapshot+0xc6>
+  802a58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a5d:	eb e0                	jmp    802a3f <devfile_send_snapshot+0xc6>
+  802a5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a64:	eb d9                	jmp    802a3f <devfile_send_snapshot+0xc6>
+
+0000000000802a66 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802a66:	48 85 ff             	test   %rdi,%rdi
+  802a69:	0f 84 41 01 00 00    	je     802bb0 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802a6f:	55                   	push   %rbp
+  802a70:	48 89 e5             	mov    %rsp,%rbp
+  802a73:	41 57                	push   %r15
+  802a75:	41 56                	push   %r14
+  802a77:	41 55                	push   %r13
+  802a79:	41 54                	push   %r12
+  802a7b:	53                   	push   %rbx
+  802a7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a80:	49 89 fc             	mov    %rdi,%r12
+  802a83:	49 89 f5             	mov    %rsi,%r13
+  802a86:	48 89 d3             	mov    %rdx,%rbx
+  802a89:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802a8c:	48 85 f6             	test   %rsi,%rsi
+  802a8f:	0f 84 ff 00 00 00    	je     802b94 <devfile_diff_snapshots+0x12e>
+  802a95:	48 85 d2             	test   %rdx,%rdx
+  802a98:	0f 84 fd 00 00 00    	je     802b9b <devfile_diff_snapshots+0x135>
+  802a9e:	48 85 c9             	test   %rcx,%rcx
+  802aa1:	0f 84 f4 00 00 00    	je     802b9b <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802aa7:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802aae:	00 00 00 
+  802ab1:	ff d0                	call   *%rax
+  802ab3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ab9:	0f 87 e3 00 00 00    	ja     802ba2 <devfile_diff_snapshots+0x13c>
+  802abf:	4c 89 ef             	mov    %r13,%rdi
+  802ac2:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ad4:	0f 87 cf 00 00 00    	ja     802ba9 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802ada:	4c 89 e6             	mov    %r12,%rsi
+  802add:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802ae4:	00 00 00 
+  802ae7:	4c 89 e7             	mov    %r12,%rdi
+  802aea:	49 bf d1 0c 80 00 00 	movabs $0x800cd1,%r15
+  802af1:	00 00 00 
+  802af4:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802af7:	4c 89 ee             	mov    %r13,%rsi
+  802afa:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802b01:	00 
+  802b02:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802b05:	48 8b 03             	mov    (%rbx),%rax
+  802b08:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802b0f:	00 
+  802b10:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802b14:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802b1b:	00 
+  802b1c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802b20:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802b27:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802b28:	be 00 00 00 00       	mov    $0x0,%esi
+  802b2d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802b32:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802b39:	00 00 00 
+  802b3c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b3e:	85 c0                	test   %eax,%eax
+  802b40:	78 43                	js     802b85 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802b42:	49 8b 04 24          	mov    (%r12),%rax
+  802b46:	48 89 03             	mov    %rax,(%rbx)
+  802b49:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802b4e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802b52:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802b57:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802b5b:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802b60:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802b64:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802b68:	48 c1 e2 03          	shl    $0x3,%rdx
+  802b6c:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802b71:	4c 89 f7             	mov    %r14,%rdi
+  802b74:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802b80:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802b85:	48 83 c4 08          	add    $0x8,%rsp
+  802b89:	5b                   	pop    %rbx
+  802b8a:	41 5c                	pop    %r12
+  802b8c:	41 5d                	pop    %r13
+  802b8e:	41 5e                	pop    %r14
+  802b90:	41 5f                	pop    %r15
+  802b92:	5d                   	pop    %rbp
+  802b93:	c3                   	ret
+        return -E_INVAL;
+  802b94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b99:	eb ea                	jmp    802b85 <devfile_diff_snapshots+0x11f>
+  802b9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba0:	eb e3                	jmp    802b85 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802ba2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba7:	eb dc                	jmp    802b85 <devfile_diff_snapshots+0x11f>
+  802ba9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bae:	eb d5                	jmp    802b85 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802bb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bb5:	c3                   	ret
+
+0000000000802bb6 <devfile_delete_snapshot>:
+    if (!name) {
+  802bb6:	48 85 ff             	test   %rdi,%rdi
+  802bb9:	74 5f                	je     802c1a <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	53                   	push   %rbx
+  802bc0:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802bc7:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802bce:	00 00 00 
+  802bd1:	ff d0                	call   *%rax
+  802bd3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bd9:	77 45                	ja     802c20 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802bdb:	48 89 de             	mov    %rbx,%rsi
+  802bde:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802be5:	00 00 00 
+  802be8:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802bf4:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802bfe:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c0a:	85 c0                	test   %eax,%eax
+  802c0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c11:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c18:	c9                   	leave
+  802c19:	c3                   	ret
+        return -E_INVAL;
+  802c1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c1f:	c3                   	ret
+        return -E_INVAL;
+  802c20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c25:	eb ed                	jmp    802c14 <devfile_delete_snapshot+0x5e>
+
+0000000000802c27 <devfile_accept_snapshot>:
+    if (!name) {
+  802c27:	48 85 ff             	test   %rdi,%rdi
+  802c2a:	74 5f                	je     802c8b <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802c2c:	55                   	push   %rbp
+  802c2d:	48 89 e5             	mov    %rsp,%rbp
+  802c30:	53                   	push   %rbx
+  802c31:	48 83 ec 08          	sub    $0x8,%rsp
+  802c35:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802c38:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+  802c44:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c4a:	77 45                	ja     802c91 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802c4c:	48 89 de             	mov    %rbx,%rsi
+  802c4f:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802c56:	00 00 00 
+  802c59:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802c65:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c6f:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802c76:	00 00 00 
+  802c79:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c82:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+        return -E_INVAL;
+  802c8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c90:	c3                   	ret
+        return -E_INVAL;
+  802c91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c96:	eb ed                	jmp    802c85 <devfile_accept_snapshot+0x5e>
+
+0000000000802c98 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802c98:	48 85 ff             	test   %rdi,%rdi
+  802c9b:	0f 84 9f 00 00 00    	je     802d40 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802ca1:	55                   	push   %rbp
+  802ca2:	48 89 e5             	mov    %rsp,%rbp
+  802ca5:	41 54                	push   %r12
+  802ca7:	53                   	push   %rbx
+  802ca8:	48 89 fb             	mov    %rdi,%rbx
+  802cab:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802cae:	48 85 f6             	test   %rsi,%rsi
+  802cb1:	74 78                	je     802d2b <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802cb3:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+  802cbf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cc5:	77 6b                	ja     802d32 <devfile_create_snapshot+0x9a>
+  802cc7:	4c 89 e7             	mov    %r12,%rdi
+  802cca:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cdc:	77 5b                	ja     802d39 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802cde:	48 89 de             	mov    %rbx,%rsi
+  802ce1:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802ce8:	00 00 00 
+  802ceb:	48 bb d1 0c 80 00 00 	movabs $0x800cd1,%rbx
+  802cf2:	00 00 00 
+  802cf5:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802cf7:	4c 89 e6             	mov    %r12,%rsi
+  802cfa:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802d01:	00 00 00 
+  802d04:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802d06:	be 00 00 00 00       	mov    $0x0,%esi
+  802d0b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d10:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802d17:	00 00 00 
+  802d1a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d1c:	85 c0                	test   %eax,%eax
+  802d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d23:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d26:	5b                   	pop    %rbx
+  802d27:	41 5c                	pop    %r12
+  802d29:	5d                   	pop    %rbp
+  802d2a:	c3                   	ret
+        return -E_INVAL;
+  802d2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d30:	eb f4                	jmp    802d26 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d37:	eb ed                	jmp    802d26 <devfile_create_snapshot+0x8e>
+  802d39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d3e:	eb e6                	jmp    802d26 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d45:	c3                   	ret
+
+0000000000802d46 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d46:	55                   	push   %rbp
+  802d47:	48 89 e5             	mov    %rsp,%rbp
+  802d4a:	41 54                	push   %r12
+  802d4c:	53                   	push   %rbx
+  802d4d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d50:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d53:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802d5a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d61:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d66:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d72:	85 c0                	test   %eax,%eax
+  802d74:	78 3d                	js     802db3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d76:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802d7d:	00 00 00 
+  802d80:	4c 89 e6             	mov    %r12,%rsi
+  802d83:	48 89 df             	mov    %rbx,%rdi
+  802d86:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d92:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802d99:	00 
+  802d9a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802da0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802da7:	00 
+  802da8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802dae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802db3:	5b                   	pop    %rbx
+  802db4:	41 5c                	pop    %r12
+  802db6:	5d                   	pop    %rbp
+  802db7:	c3                   	ret
+
+0000000000802db8 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802db8:	55                   	push   %rbp
+  802db9:	48 89 e5             	mov    %rsp,%rbp
+  802dbc:	41 57                	push   %r15
+  802dbe:	41 56                	push   %r14
+  802dc0:	41 55                	push   %r13
+  802dc2:	41 54                	push   %r12
+  802dc4:	53                   	push   %rbx
+  802dc5:	48 83 ec 38          	sub    $0x38,%rsp
+  802dc9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802dcd:	49 89 f5             	mov    %rsi,%r13
+  802dd0:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dd3:	48 89 f0             	mov    %rsi,%rax
+  802dd6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ddb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ddf:	75 4f                	jne    802e30 <devfile_readmap+0x78>
+  802de1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802de5:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802deb:	75 1f                	jne    802e0c <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802ded:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802df1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802df5:	49 be a0 35 80 00 00 	movabs $0x8035a0,%r14
+  802dfc:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dff:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802e06:	0f 87 9d 00 00 00    	ja     802ea9 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802e0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e10:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802e14:	4d 85 ff             	test   %r15,%r15
+  802e17:	0f 85 cf 00 00 00    	jne    802eec <devfile_readmap+0x134>
+  802e1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802e21:	48 83 c4 38          	add    $0x38,%rsp
+  802e25:	5b                   	pop    %rbx
+  802e26:	41 5c                	pop    %r12
+  802e28:	41 5d                	pop    %r13
+  802e2a:	41 5e                	pop    %r14
+  802e2c:	41 5f                	pop    %r15
+  802e2e:	5d                   	pop    %rbp
+  802e2f:	c3                   	ret
+    size_t totalRead = 0;
+  802e30:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802e37:	00 
+  802e38:	eb da                	jmp    802e14 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e3a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e3e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e41:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802e48:	00 00 00 
+  802e4b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802e4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e51:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802e55:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e59:	4c 89 ee             	mov    %r13,%rsi
+  802e5c:	bf 14 00 00 00       	mov    $0x14,%edi
+  802e61:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  802e68:	00 00 00 
+  802e6b:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	7e a3                	jle    802e14 <devfile_readmap+0x5c>
+  802e71:	48 98                	cltq
+  802e73:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802e77:	72 9b                	jb     802e14 <devfile_readmap+0x5c>
+        buf += read;
+  802e79:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802e7c:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802e7f:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e83:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802e8a:	75 88                	jne    802e14 <devfile_readmap+0x5c>
+  802e8c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e90:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e96:	0f 85 78 ff ff ff    	jne    802e14 <devfile_readmap+0x5c>
+  802e9c:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802ea3:	0f 86 6b ff ff ff    	jbe    802e14 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802ea9:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802eaf:	4d 39 e7             	cmp    %r12,%r15
+  802eb2:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802eb6:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802ebd:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ec1:	0f 84 73 ff ff ff    	je     802e3a <devfile_readmap+0x82>
+  802ec7:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ecb:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802ed0:	41 ff d6             	call   *%r14
+  802ed3:	a8 40                	test   $0x40,%al
+  802ed5:	0f 85 39 ff ff ff    	jne    802e14 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802edb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ee2:	4c 39 e3             	cmp    %r12,%rbx
+  802ee5:	72 e4                	jb     802ecb <devfile_readmap+0x113>
+  802ee7:	e9 4e ff ff ff       	jmp    802e3a <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802eec:	4c 89 fa             	mov    %r15,%rdx
+  802eef:	4c 89 ee             	mov    %r13,%rsi
+  802ef2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ef6:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802f02:	48 85 c0             	test   %rax,%rax
+  802f05:	78 0c                	js     802f13 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802f07:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f0b:	48 01 f0             	add    %rsi,%rax
+  802f0e:	e9 0e ff ff ff       	jmp    802e21 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802f13:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f17:	48 85 f6             	test   %rsi,%rsi
+  802f1a:	48 0f 45 c6          	cmovne %rsi,%rax
+  802f1e:	e9 fe fe ff ff       	jmp    802e21 <devfile_readmap+0x69>
+
+0000000000802f23 <open>:
+open(const char *path, int mode) {
+  802f23:	55                   	push   %rbp
+  802f24:	48 89 e5             	mov    %rsp,%rbp
+  802f27:	41 55                	push   %r13
+  802f29:	41 54                	push   %r12
+  802f2b:	53                   	push   %rbx
+  802f2c:	48 83 ec 18          	sub    $0x18,%rsp
+  802f30:	49 89 fc             	mov    %rdi,%r12
+  802f33:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f36:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+  802f42:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f48:	0f 87 8a 00 00 00    	ja     802fd8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f4e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f52:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  802f59:	00 00 00 
+  802f5c:	ff d0                	call   *%rax
+  802f5e:	89 c3                	mov    %eax,%ebx
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 50                	js     802fb4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f64:	4c 89 e6             	mov    %r12,%rsi
+  802f67:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802f6e:	00 00 00 
+  802f71:	48 89 df             	mov    %rbx,%rdi
+  802f74:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  802f7b:	00 00 00 
+  802f7e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f80:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f87:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f90:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802f97:	00 00 00 
+  802f9a:	ff d0                	call   *%rax
+  802f9c:	89 c3                	mov    %eax,%ebx
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	78 1f                	js     802fc1 <open+0x9e>
+    return fd2num(fd);
+  802fa2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa6:	48 b8 53 1a 80 00 00 	movabs $0x801a53,%rax
+  802fad:	00 00 00 
+  802fb0:	ff d0                	call   *%rax
+  802fb2:	89 c3                	mov    %eax,%ebx
+}
+  802fb4:	89 d8                	mov    %ebx,%eax
+  802fb6:	48 83 c4 18          	add    $0x18,%rsp
+  802fba:	5b                   	pop    %rbx
+  802fbb:	41 5c                	pop    %r12
+  802fbd:	41 5d                	pop    %r13
+  802fbf:	5d                   	pop    %rbp
+  802fc0:	c3                   	ret
+        fd_close(fd, 0);
+  802fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fca:	48 b8 9c 1b 80 00 00 	movabs $0x801b9c,%rax
+  802fd1:	00 00 00 
+  802fd4:	ff d0                	call   *%rax
+        return res;
+  802fd6:	eb dc                	jmp    802fb4 <open+0x91>
+        return -E_BAD_PATH;
+  802fd8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fdd:	eb d5                	jmp    802fb4 <open+0x91>
+
+0000000000802fdf <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802fdf:	55                   	push   %rbp
+  802fe0:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe8:	bf 13 00 00 00       	mov    $0x13,%edi
+  802fed:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802ff4:	00 00 00 
+  802ff7:	ff d0                	call   *%rax
+}
+  802ff9:	5d                   	pop    %rbp
+  802ffa:	c3                   	ret
+
+0000000000802ffb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	41 54                	push   %r12
+  803001:	53                   	push   %rbx
+  803002:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803005:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+  803011:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803014:	48 be a0 3f 80 00 00 	movabs $0x803fa0,%rsi
+  80301b:	00 00 00 
+  80301e:	48 89 df             	mov    %rbx,%rdi
+  803021:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  803028:	00 00 00 
+  80302b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80302d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803032:	41 2b 04 24          	sub    (%r12),%eax
+  803036:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80303c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803043:	00 00 00 
+    stat->st_dev = &devpipe;
+  803046:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  80304d:	00 00 00 
+  803050:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	5b                   	pop    %rbx
+  80305d:	41 5c                	pop    %r12
+  80305f:	5d                   	pop    %rbp
+  803060:	c3                   	ret
+
+0000000000803061 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803061:	55                   	push   %rbp
+  803062:	48 89 e5             	mov    %rsp,%rbp
+  803065:	41 54                	push   %r12
+  803067:	53                   	push   %rbx
+  803068:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80306b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803070:	48 89 fe             	mov    %rdi,%rsi
+  803073:	bf 00 00 00 00       	mov    $0x0,%edi
+  803078:	49 bc 29 14 80 00 00 	movabs $0x801429,%r12
+  80307f:	00 00 00 
+  803082:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803085:	48 89 df             	mov    %rbx,%rdi
+  803088:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  80308f:	00 00 00 
+  803092:	ff d0                	call   *%rax
+  803094:	48 89 c6             	mov    %rax,%rsi
+  803097:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80309c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a1:	41 ff d4             	call   *%r12
+}
+  8030a4:	5b                   	pop    %rbx
+  8030a5:	41 5c                	pop    %r12
+  8030a7:	5d                   	pop    %rbp
+  8030a8:	c3                   	ret
+
+00000000008030a9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8030a9:	55                   	push   %rbp
+  8030aa:	48 89 e5             	mov    %rsp,%rbp
+  8030ad:	41 57                	push   %r15
+  8030af:	41 56                	push   %r14
+  8030b1:	41 55                	push   %r13
+  8030b3:	41 54                	push   %r12
+  8030b5:	53                   	push   %rbx
+  8030b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8030ba:	49 89 fc             	mov    %rdi,%r12
+  8030bd:	49 89 f5             	mov    %rsi,%r13
+  8030c0:	49 89 d7             	mov    %rdx,%r15
+  8030c3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030c7:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8030d3:	4d 85 ff             	test   %r15,%r15
+  8030d6:	0f 84 af 00 00 00    	je     80318b <devpipe_write+0xe2>
+  8030dc:	48 89 c3             	mov    %rax,%rbx
+  8030df:	4c 89 f8             	mov    %r15,%rax
+  8030e2:	4d 89 ef             	mov    %r13,%r15
+  8030e5:	4c 01 e8             	add    %r13,%rax
+  8030e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030ec:	49 bd 31 13 80 00 00 	movabs $0x801331,%r13
+  8030f3:	00 00 00 
+            sys_yield();
+  8030f6:	49 be ce 12 80 00 00 	movabs $0x8012ce,%r14
+  8030fd:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803100:	8b 73 04             	mov    0x4(%rbx),%esi
+  803103:	48 63 ce             	movslq %esi,%rcx
+  803106:	48 63 03             	movslq (%rbx),%rax
+  803109:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80310f:	48 39 c1             	cmp    %rax,%rcx
+  803112:	72 2e                	jb     803142 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803114:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803119:	48 89 da             	mov    %rbx,%rdx
+  80311c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803121:	4c 89 e7             	mov    %r12,%rdi
+  803124:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803127:	85 c0                	test   %eax,%eax
+  803129:	74 66                	je     803191 <devpipe_write+0xe8>
+            sys_yield();
+  80312b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80312e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803131:	48 63 ce             	movslq %esi,%rcx
+  803134:	48 63 03             	movslq (%rbx),%rax
+  803137:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80313d:	48 39 c1             	cmp    %rax,%rcx
+  803140:	73 d2                	jae    803114 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803142:	41 0f b6 3f          	movzbl (%r15),%edi
+  803146:	48 89 ca             	mov    %rcx,%rdx
+  803149:	48 c1 ea 03          	shr    $0x3,%rdx
+  80314d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803154:	08 10 20 
+  803157:	48 f7 e2             	mul    %rdx
+  80315a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80315e:	48 89 d0             	mov    %rdx,%rax
+  803161:	48 c1 e0 09          	shl    $0x9,%rax
+  803165:	48 29 d0             	sub    %rdx,%rax
+  803168:	48 c1 e0 03          	shl    $0x3,%rax
+  80316c:	48 29 c1             	sub    %rax,%rcx
+  80316f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803174:	83 c6 01             	add    $0x1,%esi
+  803177:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80317a:	49 83 c7 01          	add    $0x1,%r15
+  80317e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803182:	49 39 c7             	cmp    %rax,%r15
+  803185:	0f 85 75 ff ff ff    	jne    803100 <devpipe_write+0x57>
+    return n;
+  80318b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80318f:	eb 05                	jmp    803196 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803196:	48 83 c4 18          	add    $0x18,%rsp
+  80319a:	5b                   	pop    %rbx
+  80319b:	41 5c                	pop    %r12
+  80319d:	41 5d                	pop    %r13
+  80319f:	41 5e                	pop    %r14
+  8031a1:	41 5f                	pop    %r15
+  8031a3:	5d                   	pop    %rbp
+  8031a4:	c3                   	ret
+
+00000000008031a5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031a5:	55                   	push   %rbp
+  8031a6:	48 89 e5             	mov    %rsp,%rbp
+  8031a9:	41 57                	push   %r15
+  8031ab:	41 56                	push   %r14
+  8031ad:	41 55                	push   %r13
+  8031af:	41 54                	push   %r12
+  8031b1:	53                   	push   %rbx
+  8031b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8031b6:	49 89 fc             	mov    %rdi,%r12
+  8031b9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031c1:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+  8031cd:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8031d0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031d6:	49 bd 31 13 80 00 00 	movabs $0x801331,%r13
+  8031dd:	00 00 00 
+            sys_yield();
+  8031e0:	49 be ce 12 80 00 00 	movabs $0x8012ce,%r14
+  8031e7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8031ea:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031ef:	74 7d                	je     80326e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8031f1:	8b 03                	mov    (%rbx),%eax
+  8031f3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8031f6:	75 26                	jne    80321e <devpipe_read+0x79>
+            if (i > 0) return i;
+  8031f8:	4d 85 ff             	test   %r15,%r15
+  8031fb:	75 77                	jne    803274 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031fd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803202:	48 89 da             	mov    %rbx,%rdx
+  803205:	be 00 10 00 00       	mov    $0x1000,%esi
+  80320a:	4c 89 e7             	mov    %r12,%rdi
+  80320d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803210:	85 c0                	test   %eax,%eax
+  803212:	74 72                	je     803286 <devpipe_read+0xe1>
+            sys_yield();
+  803214:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803217:	8b 03                	mov    (%rbx),%eax
+  803219:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80321c:	74 df                	je     8031fd <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80321e:	48 63 c8             	movslq %eax,%rcx
+  803221:	48 89 ca             	mov    %rcx,%rdx
+  803224:	48 c1 ea 03          	shr    $0x3,%rdx
+  803228:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80322f:	08 10 20 
+  803232:	48 89 d0             	mov    %rdx,%rax
+  803235:	48 f7 e6             	mul    %rsi
+  803238:	48 c1 ea 06          	shr    $0x6,%rdx
+  80323c:	48 89 d0             	mov    %rdx,%rax
+  80323f:	48 c1 e0 09          	shl    $0x9,%rax
+  803243:	48 29 d0             	sub    %rdx,%rax
+  803246:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80324d:	00 
+  80324e:	48 89 c8             	mov    %rcx,%rax
+  803251:	48 29 d0             	sub    %rdx,%rax
+  803254:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803259:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80325d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803261:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803264:	49 83 c7 01          	add    $0x1,%r15
+  803268:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80326c:	75 83                	jne    8031f1 <devpipe_read+0x4c>
+    return n;
+  80326e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803272:	eb 03                	jmp    803277 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803274:	4c 89 f8             	mov    %r15,%rax
+}
+  803277:	48 83 c4 18          	add    $0x18,%rsp
+  80327b:	5b                   	pop    %rbx
+  80327c:	41 5c                	pop    %r12
+  80327e:	41 5d                	pop    %r13
+  803280:	41 5e                	pop    %r14
+  803282:	41 5f                	pop    %r15
+  803284:	5d                   	pop    %rbp
+  803285:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328b:	eb ea                	jmp    803277 <devpipe_read+0xd2>
+
+000000000080328d <pipe>:
+pipe(int pfd[2]) {
+  80328d:	55                   	push   %rbp
+  80328e:	48 89 e5             	mov    %rsp,%rbp
+  803291:	41 55                	push   %r13
+  803293:	41 54                	push   %r12
+  803295:	53                   	push   %rbx
+  803296:	48 83 ec 18          	sub    $0x18,%rsp
+  80329a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80329d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8032a1:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+  8032ad:	89 c3                	mov    %eax,%ebx
+  8032af:	85 c0                	test   %eax,%eax
+  8032b1:	0f 88 a0 01 00 00    	js     803457 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8032b7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032c1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ca:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  8032d1:	00 00 00 
+  8032d4:	ff d0                	call   *%rax
+  8032d6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8032d8:	85 c0                	test   %eax,%eax
+  8032da:	0f 88 77 01 00 00    	js     803457 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032e0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8032e4:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+  8032f0:	89 c3                	mov    %eax,%ebx
+  8032f2:	85 c0                	test   %eax,%eax
+  8032f4:	0f 88 43 01 00 00    	js     80343d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032fa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803304:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330d:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  803314:	00 00 00 
+  803317:	ff d0                	call   *%rax
+  803319:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80331b:	85 c0                	test   %eax,%eax
+  80331d:	0f 88 1a 01 00 00    	js     80343d <pipe+0x1b0>
+    va = fd2data(fd0);
+  803323:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803327:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+  803333:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803336:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80333b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803340:	48 89 c6             	mov    %rax,%rsi
+  803343:	bf 00 00 00 00       	mov    $0x0,%edi
+  803348:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  80334f:	00 00 00 
+  803352:	ff d0                	call   *%rax
+  803354:	89 c3                	mov    %eax,%ebx
+  803356:	85 c0                	test   %eax,%eax
+  803358:	0f 88 c5 00 00 00    	js     803423 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80335e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803362:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  803369:	00 00 00 
+  80336c:	ff d0                	call   *%rax
+  80336e:	48 89 c1             	mov    %rax,%rcx
+  803371:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803377:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80337d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803382:	4c 89 ee             	mov    %r13,%rsi
+  803385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80338a:	48 b8 c4 13 80 00 00 	movabs $0x8013c4,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+  803396:	89 c3                	mov    %eax,%ebx
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	78 6e                	js     80340a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80339c:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033a1:	4c 89 ef             	mov    %r13,%rdi
+  8033a4:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  8033ab:	00 00 00 
+  8033ae:	ff d0                	call   *%rax
+  8033b0:	83 f8 02             	cmp    $0x2,%eax
+  8033b3:	0f 85 ab 00 00 00    	jne    803464 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8033b9:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  8033c0:	00 00 
+  8033c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8033c6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8033c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8033cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8033d3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033d7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8033d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033dd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8033e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033e8:	48 bb 53 1a 80 00 00 	movabs $0x801a53,%rbx
+  8033ef:	00 00 00 
+  8033f2:	ff d3                	call   *%rbx
+  8033f4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8033f8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8033fc:	ff d3                	call   *%rbx
+  8033fe:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803408:	eb 4d                	jmp    803457 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80340a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80340f:	4c 89 ee             	mov    %r13,%rsi
+  803412:	bf 00 00 00 00       	mov    $0x0,%edi
+  803417:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  80341e:	00 00 00 
+  803421:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803423:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803428:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80342c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803431:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80343d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803442:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803446:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344b:	48 b8 29 14 80 00 00 	movabs $0x801429,%rax
+  803452:	00 00 00 
+  803455:	ff d0                	call   *%rax
+}
+  803457:	89 d8                	mov    %ebx,%eax
+  803459:	48 83 c4 18          	add    $0x18,%rsp
+  80345d:	5b                   	pop    %rbx
+  80345e:	41 5c                	pop    %r12
+  803460:	41 5d                	pop    %r13
+  803462:	5d                   	pop    %rbp
+  803463:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803464:	48 b9 d0 3f 80 00 00 	movabs $0x803fd0,%rcx
+  80346b:	00 00 00 
+  80346e:	48 ba a7 3f 80 00 00 	movabs $0x803fa7,%rdx
+  803475:	00 00 00 
+  803478:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80347d:	48 bf bc 3f 80 00 00 	movabs $0x803fbc,%rdi
+  803484:	00 00 00 
+  803487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348c:	49 b8 5c 02 80 00 00 	movabs $0x80025c,%r8
+  803493:	00 00 00 
+  803496:	41 ff d0             	call   *%r8
+
+0000000000803499 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803499:	55                   	push   %rbp
+  80349a:	48 89 e5             	mov    %rsp,%rbp
+  80349d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034a5:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b1:	85 c0                	test   %eax,%eax
+  8034b3:	78 35                	js     8034ea <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8034b5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034b9:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  8034c0:	00 00 00 
+  8034c3:	ff d0                	call   *%rax
+  8034c5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8034c8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8034cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034d6:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  8034dd:	00 00 00 
+  8034e0:	ff d0                	call   *%rax
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	0f 94 c0             	sete   %al
+  8034e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8034ea:	c9                   	leave
+  8034eb:	c3                   	ret
+
+00000000008034ec <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034ec:	48 89 f8             	mov    %rdi,%rax
+  8034ef:	48 c1 e8 27          	shr    $0x27,%rax
+  8034f3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034fa:	01 00 00 
+  8034fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803501:	f6 c2 01             	test   $0x1,%dl
+  803504:	74 6d                	je     803573 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803506:	48 89 f8             	mov    %rdi,%rax
+  803509:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80350d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803514:	01 00 00 
+  803517:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80351b:	f6 c2 01             	test   $0x1,%dl
+  80351e:	74 62                	je     803582 <get_uvpt_entry+0x96>
+  803520:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803527:	01 00 00 
+  80352a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80352e:	f6 c2 80             	test   $0x80,%dl
+  803531:	75 4f                	jne    803582 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803533:	48 89 f8             	mov    %rdi,%rax
+  803536:	48 c1 e8 15          	shr    $0x15,%rax
+  80353a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803541:	01 00 00 
+  803544:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803548:	f6 c2 01             	test   $0x1,%dl
+  80354b:	74 44                	je     803591 <get_uvpt_entry+0xa5>
+  80354d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803554:	01 00 00 
+  803557:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80355b:	f6 c2 80             	test   $0x80,%dl
+  80355e:	75 31                	jne    803591 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803560:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803564:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80356b:	01 00 00 
+  80356e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803572:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803573:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80357a:	01 00 00 
+  80357d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803581:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803582:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803589:	01 00 00 
+  80358c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803590:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803591:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803598:	01 00 00 
+  80359b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80359f:	c3                   	ret
+
+00000000008035a0 <get_prot>:
+
+int
+get_prot(void *va) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035a4:	48 b8 ec 34 80 00 00 	movabs $0x8034ec,%rax
+  8035ab:	00 00 00 
+  8035ae:	ff d0                	call   *%rax
+  8035b0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8035b3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8035b8:	89 c1                	mov    %eax,%ecx
+  8035ba:	83 c9 04             	or     $0x4,%ecx
+  8035bd:	f6 c2 01             	test   $0x1,%dl
+  8035c0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8035c3:	89 c1                	mov    %eax,%ecx
+  8035c5:	83 c9 02             	or     $0x2,%ecx
+  8035c8:	f6 c2 02             	test   $0x2,%dl
+  8035cb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8035ce:	89 c1                	mov    %eax,%ecx
+  8035d0:	83 c9 01             	or     $0x1,%ecx
+  8035d3:	48 85 d2             	test   %rdx,%rdx
+  8035d6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8035d9:	89 c1                	mov    %eax,%ecx
+  8035db:	83 c9 40             	or     $0x40,%ecx
+  8035de:	f6 c6 04             	test   $0x4,%dh
+  8035e1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8035e4:	5d                   	pop    %rbp
+  8035e5:	c3                   	ret
+
+00000000008035e6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8035e6:	55                   	push   %rbp
+  8035e7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035ea:	48 b8 ec 34 80 00 00 	movabs $0x8034ec,%rax
+  8035f1:	00 00 00 
+  8035f4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8035f6:	48 c1 e8 06          	shr    $0x6,%rax
+  8035fa:	83 e0 01             	and    $0x1,%eax
+}
+  8035fd:	5d                   	pop    %rbp
+  8035fe:	c3                   	ret
+
+00000000008035ff <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8035ff:	55                   	push   %rbp
+  803600:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803603:	48 b8 ec 34 80 00 00 	movabs $0x8034ec,%rax
+  80360a:	00 00 00 
+  80360d:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80360f:	48 c1 e8 05          	shr    $0x5,%rax
+  803613:	83 e0 01             	and    $0x1,%eax
+}
+  803616:	5d                   	pop    %rbp
+  803617:	c3                   	ret
+
+0000000000803618 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803618:	55                   	push   %rbp
+  803619:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80361c:	48 b8 ec 34 80 00 00 	movabs $0x8034ec,%rax
+  803623:	00 00 00 
+  803626:	ff d0                	call   *%rax
+  803628:	83 e0 01             	and    $0x1,%eax
+}
+  80362b:	5d                   	pop    %rbp
+  80362c:	c3                   	ret
+
+000000000080362d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80362d:	55                   	push   %rbp
+  80362e:	48 89 e5             	mov    %rsp,%rbp
+  803631:	41 57                	push   %r15
+  803633:	41 56                	push   %r14
+  803635:	41 55                	push   %r13
+  803637:	41 54                	push   %r12
+  803639:	53                   	push   %rbx
+  80363a:	48 83 ec 18          	sub    $0x18,%rsp
+  80363e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803642:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803646:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80364b:	49 bd 18 36 80 00 00 	movabs $0x803618,%r13
+  803652:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803655:	49 bf a0 35 80 00 00 	movabs $0x8035a0,%r15
+  80365c:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80365f:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803666:	00 00 00 
+  803669:	eb 0c                	jmp    803677 <foreach_shared_region+0x4a>
+  80366b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803672:	4c 39 f3             	cmp    %r14,%rbx
+  803675:	74 2e                	je     8036a5 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803677:	48 89 df             	mov    %rbx,%rdi
+  80367a:	41 ff d5             	call   *%r13
+  80367d:	84 c0                	test   %al,%al
+  80367f:	74 ea                	je     80366b <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803681:	48 89 df             	mov    %rbx,%rdi
+  803684:	41 ff d7             	call   *%r15
+  803687:	a8 40                	test   $0x40,%al
+  803689:	74 e0                	je     80366b <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80368b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803692:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803696:	48 89 df             	mov    %rbx,%rdi
+  803699:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80369d:	ff d0                	call   *%rax
+				if (res < 0) {
+  80369f:	85 c0                	test   %eax,%eax
+  8036a1:	79 c8                	jns    80366b <foreach_shared_region+0x3e>
+  8036a3:	eb 05                	jmp    8036aa <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8036a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036aa:	48 83 c4 18          	add    $0x18,%rsp
+  8036ae:	5b                   	pop    %rbx
+  8036af:	41 5c                	pop    %r12
+  8036b1:	41 5d                	pop    %r13
+  8036b3:	41 5e                	pop    %r14
+  8036b5:	41 5f                	pop    %r15
+  8036b7:	5d                   	pop    %rbp
+  8036b8:	c3                   	ret
+
+00000000008036b9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8036b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036be:	c3                   	ret
+
+00000000008036bf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8036bf:	55                   	push   %rbp
+  8036c0:	48 89 e5             	mov    %rsp,%rbp
+  8036c3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8036c6:	48 be f4 3f 80 00 00 	movabs $0x803ff4,%rsi
+  8036cd:	00 00 00 
+  8036d0:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+    return 0;
+}
+  8036dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e1:	5d                   	pop    %rbp
+  8036e2:	c3                   	ret
+
+00000000008036e3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036e3:	55                   	push   %rbp
+  8036e4:	48 89 e5             	mov    %rsp,%rbp
+  8036e7:	41 57                	push   %r15
+  8036e9:	41 56                	push   %r14
+  8036eb:	41 55                	push   %r13
+  8036ed:	41 54                	push   %r12
+  8036ef:	53                   	push   %rbx
+  8036f0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8036f7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8036fe:	48 85 d2             	test   %rdx,%rdx
+  803701:	74 7a                	je     80377d <devcons_write+0x9a>
+  803703:	49 89 d6             	mov    %rdx,%r14
+  803706:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80370c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803711:	49 bf cb 0e 80 00 00 	movabs $0x800ecb,%r15
+  803718:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80371b:	4c 89 f3             	mov    %r14,%rbx
+  80371e:	48 29 f3             	sub    %rsi,%rbx
+  803721:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803726:	48 39 c3             	cmp    %rax,%rbx
+  803729:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80372d:	4c 63 eb             	movslq %ebx,%r13
+  803730:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803737:	48 01 c6             	add    %rax,%rsi
+  80373a:	4c 89 ea             	mov    %r13,%rdx
+  80373d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803744:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803747:	4c 89 ee             	mov    %r13,%rsi
+  80374a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803751:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80375d:	41 01 dc             	add    %ebx,%r12d
+  803760:	49 63 f4             	movslq %r12d,%rsi
+  803763:	4c 39 f6             	cmp    %r14,%rsi
+  803766:	72 b3                	jb     80371b <devcons_write+0x38>
+    return res;
+  803768:	49 63 c4             	movslq %r12d,%rax
+}
+  80376b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803772:	5b                   	pop    %rbx
+  803773:	41 5c                	pop    %r12
+  803775:	41 5d                	pop    %r13
+  803777:	41 5e                	pop    %r14
+  803779:	41 5f                	pop    %r15
+  80377b:	5d                   	pop    %rbp
+  80377c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80377d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803783:	eb e3                	jmp    803768 <devcons_write+0x85>
+
+0000000000803785 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803785:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80378d:	48 85 c0             	test   %rax,%rax
+  803790:	74 55                	je     8037e7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803792:	55                   	push   %rbp
+  803793:	48 89 e5             	mov    %rsp,%rbp
+  803796:	41 55                	push   %r13
+  803798:	41 54                	push   %r12
+  80379a:	53                   	push   %rbx
+  80379b:	48 83 ec 08          	sub    $0x8,%rsp
+  80379f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8037a2:	48 bb 01 12 80 00 00 	movabs $0x801201,%rbx
+  8037a9:	00 00 00 
+  8037ac:	49 bc ce 12 80 00 00 	movabs $0x8012ce,%r12
+  8037b3:	00 00 00 
+  8037b6:	eb 03                	jmp    8037bb <devcons_read+0x36>
+  8037b8:	41 ff d4             	call   *%r12
+  8037bb:	ff d3                	call   *%rbx
+  8037bd:	85 c0                	test   %eax,%eax
+  8037bf:	74 f7                	je     8037b8 <devcons_read+0x33>
+    if (c < 0) return c;
+  8037c1:	48 63 d0             	movslq %eax,%rdx
+  8037c4:	78 13                	js     8037d9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8037c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037cb:	83 f8 04             	cmp    $0x4,%eax
+  8037ce:	74 09                	je     8037d9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8037d0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8037d4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8037d9:	48 89 d0             	mov    %rdx,%rax
+  8037dc:	48 83 c4 08          	add    $0x8,%rsp
+  8037e0:	5b                   	pop    %rbx
+  8037e1:	41 5c                	pop    %r12
+  8037e3:	41 5d                	pop    %r13
+  8037e5:	5d                   	pop    %rbp
+  8037e6:	c3                   	ret
+  8037e7:	48 89 d0             	mov    %rdx,%rax
+  8037ea:	c3                   	ret
+
+00000000008037eb <cputchar>:
+cputchar(int ch) {
+  8037eb:	55                   	push   %rbp
+  8037ec:	48 89 e5             	mov    %rsp,%rbp
+  8037ef:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8037f3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8037f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8037fc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803800:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  803807:	00 00 00 
+  80380a:	ff d0                	call   *%rax
+}
+  80380c:	c9                   	leave
+  80380d:	c3                   	ret
+
+000000000080380e <getchar>:
+getchar(void) {
+  80380e:	55                   	push   %rbp
+  80380f:	48 89 e5             	mov    %rsp,%rbp
+  803812:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803816:	ba 01 00 00 00       	mov    $0x1,%edx
+  80381b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80381f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803824:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  80382b:	00 00 00 
+  80382e:	ff d0                	call   *%rax
+  803830:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803832:	85 c0                	test   %eax,%eax
+  803834:	78 06                	js     80383c <getchar+0x2e>
+  803836:	74 08                	je     803840 <getchar+0x32>
+  803838:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80383c:	89 d0                	mov    %edx,%eax
+  80383e:	c9                   	leave
+  80383f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803840:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803845:	eb f5                	jmp    80383c <getchar+0x2e>
+
+0000000000803847 <iscons>:
+iscons(int fdnum) {
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80384f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803853:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  80385a:	00 00 00 
+  80385d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80385f:	85 c0                	test   %eax,%eax
+  803861:	78 18                	js     80387b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803863:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803867:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80386e:	00 00 00 
+  803871:	8b 00                	mov    (%rax),%eax
+  803873:	39 02                	cmp    %eax,(%rdx)
+  803875:	0f 94 c0             	sete   %al
+  803878:	0f b6 c0             	movzbl %al,%eax
+}
+  80387b:	c9                   	leave
+  80387c:	c3                   	ret
+
+000000000080387d <opencons>:
+opencons(void) {
+  80387d:	55                   	push   %rbp
+  80387e:	48 89 e5             	mov    %rsp,%rbp
+  803881:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803885:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803889:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  803890:	00 00 00 
+  803893:	ff d0                	call   *%rax
+  803895:	85 c0                	test   %eax,%eax
+  803897:	78 49                	js     8038e2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803899:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80389e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038a3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8038a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ac:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	78 26                	js     8038e2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8038bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038c0:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8038c7:	00 00 
+  8038c9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8038cb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038cf:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8038d6:	48 b8 53 1a 80 00 00 	movabs $0x801a53,%rax
+  8038dd:	00 00 00 
+  8038e0:	ff d0                	call   *%rax
+}
+  8038e2:	c9                   	leave
+  8038e3:	c3                   	ret
+  8038e4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008038e8 <__rodata_start>:
+  8038e8:	25 64 20 00 66       	and    $0x66002064,%eax
+  8038ed:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ee:	72 6b                	jb     80395b <__rodata_start+0x73>
+  8038f0:	3a 20                	cmp    (%rax),%ah
+  8038f2:	25 69 00 75 73       	and    $0x73750069,%eax
+  8038f7:	65 72 2f             	gs jb  803929 <__rodata_start+0x41>
+  8038fa:	70 72                	jo     80396e <__rodata_start+0x86>
+  8038fc:	69 6d 65 73 2e 63 00 	imul   $0x632e73,0x65(%rbp),%ebp
+  803903:	3c 75                	cmp    $0x75,%al
+  803905:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803906:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80390a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80390b:	3e 00 0f             	ds add %cl,(%rdi)
+  80390e:	1f                   	(bad)
+  80390f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803912:	30 38                	xor    %bh,(%rax)
+  803914:	78 5d                	js     803973 <__rodata_start+0x8b>
+  803916:	20 75 73             	and    %dh,0x73(%rbp)
+  803919:	65 72 20             	gs jb  80393c <__rodata_start+0x54>
+  80391c:	70 61                	jo     80397f <__rodata_start+0x97>
+  80391e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80391f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803926:	73 20                	jae    803948 <__rodata_start+0x60>
+  803928:	61                   	(bad)
+  803929:	74 20                	je     80394b <__rodata_start+0x63>
+  80392b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803930:	3a 20                	cmp    (%rax),%ah
+  803932:	00 30                	add    %dh,(%rax)
+  803934:	31 32                	xor    %esi,(%rdx)
+  803936:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80393d:	41                   	rex.B
+  80393e:	42                   	rex.X
+  80393f:	43                   	rex.XB
+  803940:	44                   	rex.R
+  803941:	45                   	rex.RB
+  803942:	46 00 30             	rex.RX add %r14b,(%rax)
+  803945:	31 32                	xor    %esi,(%rdx)
+  803947:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80394e:	61                   	(bad)
+  80394f:	62 63 64 65 66       	(bad)
+  803954:	00 28                	add    %ch,(%rax)
+  803956:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803957:	75 6c                	jne    8039c5 <__rodata_start+0xdd>
+  803959:	6c                   	insb   (%dx),%es:(%rdi)
+  80395a:	29 00                	sub    %eax,(%rax)
+  80395c:	65 72 72             	gs jb  8039d1 <__rodata_start+0xe9>
+  80395f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803960:	72 20                	jb     803982 <__rodata_start+0x9a>
+  803962:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803967:	73 70                	jae    8039d9 <__rodata_start+0xf1>
+  803969:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80396d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803974:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803975:	72 00                	jb     803977 <__rodata_start+0x8f>
+  803977:	62 61 64 20 65       	(bad)
+  80397c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80397d:	76 69                	jbe    8039e8 <__rodata_start+0x100>
+  80397f:	72 6f                	jb     8039f0 <__rodata_start+0x108>
+  803981:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803982:	6d                   	insl   (%dx),%es:(%rdi)
+  803983:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803985:	74 00                	je     803987 <__rodata_start+0x9f>
+  803987:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80398e:	20 70 61             	and    %dh,0x61(%rax)
+  803991:	72 61                	jb     8039f4 <__rodata_start+0x10c>
+  803993:	6d                   	insl   (%dx),%es:(%rdi)
+  803994:	65 74 65             	gs je  8039fc <__rodata_start+0x114>
+  803997:	72 00                	jb     803999 <__rodata_start+0xb1>
+  803999:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80399a:	75 74                	jne    803a10 <__rodata_start+0x128>
+  80399c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80399f:	20 6d 65             	and    %ch,0x65(%rbp)
+  8039a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8039a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039a4:	72 79                	jb     803a1f <__rodata_start+0x137>
+  8039a6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8039a9:	74 20                	je     8039cb <__rodata_start+0xe3>
+  8039ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ac:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8039b0:	76 69                	jbe    803a1b <__rodata_start+0x133>
+  8039b2:	72 6f                	jb     803a23 <__rodata_start+0x13b>
+  8039b4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039b5:	6d                   	insl   (%dx),%es:(%rdi)
+  8039b6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039b8:	74 73                	je     803a2d <__rodata_start+0x145>
+  8039ba:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8039bd:	72 72                	jb     803a31 <__rodata_start+0x149>
+  8039bf:	75 70                	jne    803a31 <__rodata_start+0x149>
+  8039c1:	74 65                	je     803a28 <__rodata_start+0x140>
+  8039c3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8039c8:	75 67                	jne    803a31 <__rodata_start+0x149>
+  8039ca:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8039cd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039cf:	00 73 65             	add    %dh,0x65(%rbx)
+  8039d2:	67 6d                	insl   (%dx),%es:(%edi)
+  8039d4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039d6:	74 61                	je     803a39 <__rodata_start+0x151>
+  8039d8:	74 69                	je     803a43 <__rodata_start+0x15b>
+  8039da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039dc:	20 66 61             	and    %ah,0x61(%rsi)
+  8039df:	75 6c                	jne    803a4d <__rodata_start+0x165>
+  8039e1:	74 00                	je     8039e3 <__rodata_start+0xfb>
+  8039e3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8039ea:	20 45 4c             	and    %al,0x4c(%rbp)
+  8039ed:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8039f1:	61                   	(bad)
+  8039f2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8039f7:	20 73 75             	and    %dh,0x75(%rbx)
+  8039fa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8039fd:	73 79                	jae    803a78 <__rodata_start+0x190>
+  8039ff:	73 74                	jae    803a75 <__rodata_start+0x18d>
+  803a01:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a03:	20 63 61             	and    %ah,0x61(%rbx)
+  803a06:	6c                   	insb   (%dx),%es:(%rdi)
+  803a07:	6c                   	insb   (%dx),%es:(%rdi)
+  803a08:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803a0b:	74 72                	je     803a7f <__rodata_start+0x197>
+  803a0d:	79 20                	jns    803a2f <__rodata_start+0x147>
+  803a0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a11:	74 20                	je     803a33 <__rodata_start+0x14b>
+  803a13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a15:	75 6e                	jne    803a85 <__rodata_start+0x19d>
+  803a17:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803a1b:	76 20                	jbe    803a3d <__rodata_start+0x155>
+  803a1d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803a24:	72 65                	jb     803a8b <__rodata_start+0x1a3>
+  803a26:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803a29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803a2e:	65 78 70             	gs js  803aa1 <__rodata_start+0x1b9>
+  803a31:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803a36:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803a39:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803a3d:	20 66 69             	and    %ah,0x69(%rsi)
+  803a40:	6c                   	insb   (%dx),%es:(%rdi)
+  803a41:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803a45:	20 66 72             	and    %ah,0x72(%rsi)
+  803a48:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803a4d:	61                   	(bad)
+  803a4e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803a51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a53:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803a57:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803a5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a5c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803a5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a60:	79 20                	jns    803a82 <__rodata_start+0x19a>
+  803a62:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803a69:	72 65                	jb     803ad0 <__rodata_start+0x1e8>
+  803a6b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803a6e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a70:	00 66 69             	add    %ah,0x69(%rsi)
+  803a73:	6c                   	insb   (%dx),%es:(%rdi)
+  803a74:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a78:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a7c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a81:	74 20                	je     803aa3 <__rodata_start+0x1bb>
+  803a83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a85:	75 6e                	jne    803af5 <__rodata_start+0x20d>
+  803a87:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a8b:	76 61                	jbe    803aee <__rodata_start+0x206>
+  803a8d:	6c                   	insb   (%dx),%es:(%rdi)
+  803a8e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a95:	00 
+  803a96:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a9d:	72 65                	jb     803b04 <__rodata_start+0x21c>
+  803a9f:	61                   	(bad)
+  803aa0:	64 79 20             	fs jns 803ac3 <__rodata_start+0x1db>
+  803aa3:	65 78 69             	gs js  803b0f <__rodata_start+0x227>
+  803aa6:	73 74                	jae    803b1c <__rodata_start+0x234>
+  803aa8:	73 00                	jae    803aaa <__rodata_start+0x1c2>
+  803aaa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aab:	70 65                	jo     803b12 <__rodata_start+0x22a>
+  803aad:	72 61                	jb     803b10 <__rodata_start+0x228>
+  803aaf:	74 69                	je     803b1a <__rodata_start+0x232>
+  803ab1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ab2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ab3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803ab6:	74 20                	je     803ad8 <__rodata_start+0x1f0>
+  803ab8:	73 75                	jae    803b2f <__rodata_start+0x247>
+  803aba:	70 70                	jo     803b2c <__rodata_start+0x244>
+  803abc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803abd:	72 74                	jb     803b33 <__rodata_start+0x24b>
+  803abf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803ac5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803aca:	74 00                	je     803acc <__rodata_start+0x1e4>
+  803acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ad3:	00 00 00 
+  803ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803add:	00 00 00 
+  803ae0:	99                   	cltd
+  803ae1:	05 80 00 00 00       	add    $0x80,%eax
+  803ae6:	00 00                	add    %al,(%rax)
+  803ae8:	da 0b                	fimull (%rbx)
+  803aea:	80 00 00             	addb   $0x0,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 ca                	add    %cl,%dl
+  803af1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803af7:	00 da                	add    %bl,%dl
+  803af9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803aff:	00 da                	add    %bl,%dl
+  803b01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b07:	00 da                	add    %bl,%dl
+  803b09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b0f:	00 da                	add    %bl,%dl
+  803b11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b17:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 da                	add    %bl,%dl
+  803b21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b27:	00 da                	add    %bl,%dl
+  803b29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b2f:	00 ac 05 80 00 00 00 	add    %ch,0x80(%rbp,%rax,1)
+  803b36:	00 00                	add    %al,(%rax)
+  803b38:	26 06                	es (bad)
+  803b3a:	80 00 00             	addb   $0x0,(%rax)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 da                	add    %bl,%dl
+  803b41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b47:	00 ac 05 80 00 00 00 	add    %ch,0x80(%rbp,%rax,1)
+  803b4e:	00 00                	add    %al,(%rax)
+  803b50:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b56:	00 00                	add    %al,(%rax)
+  803b58:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b5e:	00 00                	add    %al,(%rax)
+  803b60:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b66:	00 00                	add    %al,(%rax)
+  803b68:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b6e:	00 00                	add    %al,(%rax)
+  803b70:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b76:	00 00                	add    %al,(%rax)
+  803b78:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b7e:	00 00                	add    %al,(%rax)
+  803b80:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b86:	00 00                	add    %al,(%rax)
+  803b88:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b8e:	00 00                	add    %al,(%rax)
+  803b90:	f2 05 80 00 00 00    	repnz add $0x80,%eax
+  803b96:	00 00                	add    %al,(%rax)
+  803b98:	da 0b                	fimull (%rbx)
+  803b9a:	80 00 00             	addb   $0x0,(%rax)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 da                	add    %bl,%dl
+  803ba1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ba7:	00 da                	add    %bl,%dl
+  803ba9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803baf:	00 da                	add    %bl,%dl
+  803bb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bb7:	00 da                	add    %bl,%dl
+  803bb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bbf:	00 da                	add    %bl,%dl
+  803bc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bc7:	00 da                	add    %bl,%dl
+  803bc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bcf:	00 da                	add    %bl,%dl
+  803bd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bd7:	00 da                	add    %bl,%dl
+  803bd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bdf:	00 da                	add    %bl,%dl
+  803be1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803be7:	00 da                	add    %bl,%dl
+  803be9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bef:	00 da                	add    %bl,%dl
+  803bf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bf7:	00 da                	add    %bl,%dl
+  803bf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803bff:	00 da                	add    %bl,%dl
+  803c01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c07:	00 da                	add    %bl,%dl
+  803c09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c0f:	00 da                	add    %bl,%dl
+  803c11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c17:	00 da                	add    %bl,%dl
+  803c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c1f:	00 da                	add    %bl,%dl
+  803c21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c27:	00 da                	add    %bl,%dl
+  803c29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c2f:	00 da                	add    %bl,%dl
+  803c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c37:	00 da                	add    %bl,%dl
+  803c39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c3f:	00 da                	add    %bl,%dl
+  803c41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c47:	00 da                	add    %bl,%dl
+  803c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c4f:	00 da                	add    %bl,%dl
+  803c51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c57:	00 da                	add    %bl,%dl
+  803c59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c5f:	00 da                	add    %bl,%dl
+  803c61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c67:	00 da                	add    %bl,%dl
+  803c69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c6f:	00 da                	add    %bl,%dl
+  803c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c77:	00 da                	add    %bl,%dl
+  803c79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c7f:	00 da                	add    %bl,%dl
+  803c81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c87:	00 fd                	add    %bh,%ch
+  803c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c8f:	00 da                	add    %bl,%dl
+  803c91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c97:	00 da                	add    %bl,%dl
+  803c99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c9f:	00 da                	add    %bl,%dl
+  803ca1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ca7:	00 da                	add    %bl,%dl
+  803ca9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803caf:	00 da                	add    %bl,%dl
+  803cb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cb7:	00 da                	add    %bl,%dl
+  803cb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cbf:	00 da                	add    %bl,%dl
+  803cc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cc7:	00 da                	add    %bl,%dl
+  803cc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803ccf:	00 da                	add    %bl,%dl
+  803cd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cd7:	00 da                	add    %bl,%dl
+  803cd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cdf:	00 49 06             	add    %cl,0x6(%rcx)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 18                	add    %bl,(%rax)
+  803ce9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803cef:	00 da                	add    %bl,%dl
+  803cf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cf7:	00 da                	add    %bl,%dl
+  803cf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803cff:	00 da                	add    %bl,%dl
+  803d01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d07:	00 da                	add    %bl,%dl
+  803d09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d0f:	00 78 06             	add    %bh,0x6(%rax)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 da                	add    %bl,%dl
+  803d19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d1f:	00 da                	add    %bl,%dl
+  803d21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d27:	00 3e                	add    %bh,(%rsi)
+  803d29:	06                   	(bad)
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 da                	add    %bl,%dl
+  803d31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d37:	00 da                	add    %bl,%dl
+  803d39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d3f:	00 c0                	add    %al,%al
+  803d41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803d47:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 da                	add    %bl,%dl
+  803d51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d57:	00 da                	add    %bl,%dl
+  803d59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d5f:	00 0f                	add    %cl,(%rdi)
+  803d61:	07                   	(bad)
+  803d62:	80 00 00             	addb   $0x0,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 da                	add    %bl,%dl
+  803d69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d6f:	00 ec                	add    %ch,%ah
+  803d71:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803d77:	00 da                	add    %bl,%dl
+  803d79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d7f:	00 da                	add    %bl,%dl
+  803d81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d87:	00 fd                	add    %bh,%ch
+  803d89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d8f:	00 da                	add    %bl,%dl
+  803d91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d97:	00 a2 05 80 00 00    	add    %ah,0x8005(%rdx)
+  803d9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803da0 <error_string>:
+	...
+  803da8:	65 39 80 00 00 00 00 00 77 39 80 00 00 00 00 00     e9......w9......
+  803db8:	87 39 80 00 00 00 00 00 99 39 80 00 00 00 00 00     .9.......9......
+  803dc8:	a7 39 80 00 00 00 00 00 bb 39 80 00 00 00 00 00     .9.......9......
+  803dd8:	d0 39 80 00 00 00 00 00 e3 39 80 00 00 00 00 00     .9.......9......
+  803de8:	f5 39 80 00 00 00 00 00 09 3a 80 00 00 00 00 00     .9.......:......
+  803df8:	19 3a 80 00 00 00 00 00 2c 3a 80 00 00 00 00 00     .:......,:......
+  803e08:	43 3a 80 00 00 00 00 00 59 3a 80 00 00 00 00 00     C:......Y:......
+  803e18:	71 3a 80 00 00 00 00 00 89 3a 80 00 00 00 00 00     q:.......:......
+  803e28:	96 3a 80 00 00 00 00 00 48 3e 80 00 00 00 00 00     .:......H>......
+  803e38:	aa 3a 80 00 00 00 00 00 c2 3a 80 00 00 00 00 00     .:.......:......
+  803e48:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803e58:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803e68:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803e78:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803e88:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803e98:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803ea8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803eb8:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  803ec8:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803ed8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  803ee8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803ef8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803f08:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803f18:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803f28:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803f38:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803f48:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803f58:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803f68:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803f78:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803f80 <devtab>:
+  803f80:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803f90:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803fa0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803fb0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803fc0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803fd0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803fe0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803ff0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
@@ -0,0 +1,7495 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc 04 1f 80 00 00 	movabs $0x801f04,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf f9 3a 80 00 00 	movabs $0x803af9,%r15
+  800049:	00 00 00 
+  80004c:	49 be 7a 05 80 00 00 	movabs $0x80057a,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 44 32 80 00 00 	movabs $0x803244,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb fd 1b 80 00 00 	movabs $0x801bfd,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba b8 3a 80 00 00 	movabs $0x803ab8,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba fd 3a 80 00 00 	movabs $0x803afd,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 06 3b 80 00 00 	movabs $0x803b06,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc 04 1f 80 00 00 	movabs $0x801f04,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba 2b 3b 80 00 00 	movabs $0x803b2b,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 2a 04 80 00 00 	movabs $0x80042a,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 0f 3b 80 00 00 	movabs $0x803b0f,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 2a 04 80 00 00 	movabs $0x80042a,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 45 3b 80 00 00 	movabs $0x803b45,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 44 32 80 00 00 	movabs $0x803244,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba fd 3a 80 00 00 	movabs $0x803afd,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 06 3b 80 00 00 	movabs $0x803b06,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb 75 1f 80 00 00 	movabs $0x801f75,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba 50 3b 80 00 00 	movabs $0x803b50,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf e7 3a 80 00 00 	movabs $0x803ae7,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036a:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800371:	00 00 00 
+  800374:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80037b:	00 00 00 
+  80037e:	48 39 c2             	cmp    %rax,%rdx
+  800381:	73 17                	jae    80039a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	49 89 c4             	mov    %rax,%r12
+  800389:	48 83 c3 08          	add    $0x8,%rbx
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	ff 53 f8             	call   *-0x8(%rbx)
+  800395:	4c 39 e3             	cmp    %r12,%rbx
+  800398:	72 ef                	jb     800389 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80039a:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ab:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8003af:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8003b3:	48 c1 e0 04          	shl    $0x4,%rax
+  8003b7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003be:	00 00 00 
+  8003c1:	48 01 d0             	add    %rdx,%rax
+  8003c4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003cb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003ce:	45 85 ed             	test   %r13d,%r13d
+  8003d1:	7e 0d                	jle    8003e0 <libmain+0x87>
+  8003d3:	49 8b 06             	mov    (%r14),%rax
+  8003d6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003dd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003e0:	4c 89 f6             	mov    %r14,%rsi
+  8003e3:	44 89 ef             	mov    %r13d,%edi
+  8003e6:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8003ed:	00 00 00 
+  8003f0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003f2:	48 b8 07 04 80 00 00 	movabs $0x800407,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+#endif
+}
+  8003fe:	5b                   	pop    %rbx
+  8003ff:	41 5c                	pop    %r12
+  800401:	41 5d                	pop    %r13
+  800403:	41 5e                	pop    %r14
+  800405:	5d                   	pop    %rbp
+  800406:	c3                   	ret
+
+0000000000800407 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800407:	55                   	push   %rbp
+  800408:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80040b:	48 b8 30 1c 80 00 00 	movabs $0x801c30,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800417:	bf 00 00 00 00       	mov    $0x0,%edi
+  80041c:	48 b8 00 14 80 00 00 	movabs $0x801400,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+}
+  800428:	5d                   	pop    %rbp
+  800429:	c3                   	ret
+
+000000000080042a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80042a:	55                   	push   %rbp
+  80042b:	48 89 e5             	mov    %rsp,%rbp
+  80042e:	41 56                	push   %r14
+  800430:	41 55                	push   %r13
+  800432:	41 54                	push   %r12
+  800434:	53                   	push   %rbx
+  800435:	48 83 ec 50          	sub    $0x50,%rsp
+  800439:	49 89 fc             	mov    %rdi,%r12
+  80043c:	41 89 f5             	mov    %esi,%r13d
+  80043f:	48 89 d3             	mov    %rdx,%rbx
+  800442:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800446:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80044a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80044e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800455:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800459:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80045d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800461:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800465:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80046c:	00 00 00 
+  80046f:	4c 8b 30             	mov    (%rax),%r14
+  800472:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  800479:	00 00 00 
+  80047c:	ff d0                	call   *%rax
+  80047e:	89 c6                	mov    %eax,%esi
+  800480:	45 89 e8             	mov    %r13d,%r8d
+  800483:	4c 89 e1             	mov    %r12,%rcx
+  800486:	4c 89 f2             	mov    %r14,%rdx
+  800489:	48 bf 78 3b 80 00 00 	movabs $0x803b78,%rdi
+  800490:	00 00 00 
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	49 bc 7a 05 80 00 00 	movabs $0x80057a,%r12
+  80049f:	00 00 00 
+  8004a2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004a5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004a9:	48 89 df             	mov    %rbx,%rdi
+  8004ac:	48 b8 16 05 80 00 00 	movabs $0x800516,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004b8:	48 bf fb 3a 80 00 00 	movabs $0x803afb,%rdi
+  8004bf:	00 00 00 
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004ca:	cc                   	int3
+  8004cb:	eb fd                	jmp    8004ca <_panic+0xa0>
+
+00000000008004cd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004cd:	55                   	push   %rbp
+  8004ce:	48 89 e5             	mov    %rsp,%rbp
+  8004d1:	53                   	push   %rbx
+  8004d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004d9:	8b 06                	mov    (%rsi),%eax
+  8004db:	8d 50 01             	lea    0x1(%rax),%edx
+  8004de:	89 16                	mov    %edx,(%rsi)
+  8004e0:	48 98                	cltq
+  8004e2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004e7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004ed:	74 0a                	je     8004f9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004ef:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f7:	c9                   	leave
+  8004f8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004f9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004fd:	be ff 00 00 00       	mov    $0xff,%esi
+  800502:	48 b8 a2 13 80 00 00 	movabs $0x8013a2,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80050e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800514:	eb d9                	jmp    8004ef <putch+0x22>
+
+0000000000800516 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800516:	55                   	push   %rbp
+  800517:	48 89 e5             	mov    %rsp,%rbp
+  80051a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800521:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800524:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80052b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800530:	b8 00 00 00 00       	mov    $0x0,%eax
+  800535:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800538:	48 89 f1             	mov    %rsi,%rcx
+  80053b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800542:	48 bf cd 04 80 00 00 	movabs $0x8004cd,%rdi
+  800549:	00 00 00 
+  80054c:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  800553:	00 00 00 
+  800556:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800558:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80055f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800566:	48 b8 a2 13 80 00 00 	movabs $0x8013a2,%rax
+  80056d:	00 00 00 
+  800570:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800572:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800578:	c9                   	leave
+  800579:	c3                   	ret
+
+000000000080057a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80057a:	55                   	push   %rbp
+  80057b:	48 89 e5             	mov    %rsp,%rbp
+  80057e:	48 83 ec 50          	sub    $0x50,%rsp
+  800582:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800586:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80058a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80058e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800592:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800596:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80059d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005ad:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005b1:	48 b8 16 05 80 00 00 	movabs $0x800516,%rax
+  8005b8:	00 00 00 
+  8005bb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005bd:	c9                   	leave
+  8005be:	c3                   	ret
+
+00000000008005bf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005bf:	55                   	push   %rbp
+  8005c0:	48 89 e5             	mov    %rsp,%rbp
+  8005c3:	41 57                	push   %r15
+  8005c5:	41 56                	push   %r14
+  8005c7:	41 55                	push   %r13
+  8005c9:	41 54                	push   %r12
+  8005cb:	53                   	push   %rbx
+  8005cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8005d0:	49 89 fc             	mov    %rdi,%r12
+  8005d3:	49 89 f5             	mov    %rsi,%r13
+  8005d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005da:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005dd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005e0:	41 89 cf             	mov    %ecx,%r15d
+  8005e3:	4c 39 fa             	cmp    %r15,%rdx
+  8005e6:	73 5b                	jae    800643 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005e8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005ec:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005f0:	85 db                	test   %ebx,%ebx
+  8005f2:	7e 0e                	jle    800602 <print_num+0x43>
+            putch(padc, put_arg);
+  8005f4:	4c 89 ee             	mov    %r13,%rsi
+  8005f7:	44 89 f7             	mov    %r14d,%edi
+  8005fa:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005fd:	83 eb 01             	sub    $0x1,%ebx
+  800600:	75 f2                	jne    8005f4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800602:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800606:	48 b9 ac 3b 80 00 00 	movabs $0x803bac,%rcx
+  80060d:	00 00 00 
+  800610:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  800617:	00 00 00 
+  80061a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80061e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800622:	ba 00 00 00 00       	mov    $0x0,%edx
+  800627:	49 f7 f7             	div    %r15
+  80062a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80062e:	4c 89 ee             	mov    %r13,%rsi
+  800631:	41 ff d4             	call   *%r12
+}
+  800634:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800638:	5b                   	pop    %rbx
+  800639:	41 5c                	pop    %r12
+  80063b:	41 5d                	pop    %r13
+  80063d:	41 5e                	pop    %r14
+  80063f:	41 5f                	pop    %r15
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800643:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800647:	ba 00 00 00 00       	mov    $0x0,%edx
+  80064c:	49 f7 f7             	div    %r15
+  80064f:	48 83 ec 08          	sub    $0x8,%rsp
+  800653:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800657:	52                   	push   %rdx
+  800658:	45 0f be c9          	movsbl %r9b,%r9d
+  80065c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800660:	48 89 c2             	mov    %rax,%rdx
+  800663:	48 b8 bf 05 80 00 00 	movabs $0x8005bf,%rax
+  80066a:	00 00 00 
+  80066d:	ff d0                	call   *%rax
+  80066f:	48 83 c4 10          	add    $0x10,%rsp
+  800673:	eb 8d                	jmp    800602 <print_num+0x43>
+
+0000000000800675 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800675:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800679:	48 8b 06             	mov    (%rsi),%rax
+  80067c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800680:	73 0a                	jae    80068c <sprintputch+0x17>
+        *state->start++ = ch;
+  800682:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800686:	48 89 16             	mov    %rdx,(%rsi)
+  800689:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80068c:	c3                   	ret
+
+000000000080068d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+  800691:	48 83 ec 50          	sub    $0x50,%rsp
+  800695:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800699:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80069d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006a1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006b8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006bc:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  8006c3:	00 00 00 
+  8006c6:	ff d0                	call   *%rax
+}
+  8006c8:	c9                   	leave
+  8006c9:	c3                   	ret
+
+00000000008006ca <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006ca:	55                   	push   %rbp
+  8006cb:	48 89 e5             	mov    %rsp,%rbp
+  8006ce:	41 57                	push   %r15
+  8006d0:	41 56                	push   %r14
+  8006d2:	41 55                	push   %r13
+  8006d4:	41 54                	push   %r12
+  8006d6:	53                   	push   %rbx
+  8006d7:	48 83 ec 38          	sub    $0x38,%rsp
+  8006db:	49 89 fe             	mov    %rdi,%r14
+  8006de:	49 89 f5             	mov    %rsi,%r13
+  8006e1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006e4:	48 8b 01             	mov    (%rcx),%rax
+  8006e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006eb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006fb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006ff:	0f b6 3b             	movzbl (%rbx),%edi
+  800702:	40 80 ff 25          	cmp    $0x25,%dil
+  800706:	74 18                	je     800720 <vprintfmt+0x56>
+            if (!ch) return;
+  800708:	40 84 ff             	test   %dil,%dil
+  80070b:	0f 84 b1 06 00 00    	je     800dc2 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800711:	40 0f b6 ff          	movzbl %dil,%edi
+  800715:	4c 89 ee             	mov    %r13,%rsi
+  800718:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80071b:	4c 89 e3             	mov    %r12,%rbx
+  80071e:	eb db                	jmp    8006fb <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800720:	be 00 00 00 00       	mov    $0x0,%esi
+  800725:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800729:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80072e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800734:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80073b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80073f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800744:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800749:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80074c:	83 e8 23             	sub    $0x23,%eax
+  80074f:	3c 57                	cmp    $0x57,%al
+  800751:	0f 87 51 06 00 00    	ja     800da8 <vprintfmt+0x6de>
+  800757:	0f b6 c0             	movzbl %al,%eax
+  80075a:	48 b9 40 3d 80 00 00 	movabs $0x803d40,%rcx
+  800761:	00 00 00 
+  800764:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800767:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80076a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80076e:	eb cf                	jmp    80073f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800770:	49 89 dc             	mov    %rbx,%r12
+  800773:	be 01 00 00 00       	mov    $0x1,%esi
+  800778:	eb c5                	jmp    80073f <vprintfmt+0x75>
+            padc = ch;
+  80077a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80077e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800781:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800784:	eb b9                	jmp    80073f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800786:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800789:	83 f8 2f             	cmp    $0x2f,%eax
+  80078c:	77 24                	ja     8007b2 <vprintfmt+0xe8>
+  80078e:	89 c1                	mov    %eax,%ecx
+  800790:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800794:	83 c0 08             	add    $0x8,%eax
+  800797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80079d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007a0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a4:	79 99                	jns    80073f <vprintfmt+0x75>
+                width = precision;
+  8007a6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007b0:	eb 8d                	jmp    80073f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007b6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007be:	eb da                	jmp    80079a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007c0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007c5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007c9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007cf:	3c 39                	cmp    $0x39,%al
+  8007d1:	77 1c                	ja     8007ef <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007d3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007d7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007db:	0f b6 c0             	movzbl %al,%eax
+  8007de:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e3:	0f b6 03             	movzbl (%rbx),%eax
+  8007e6:	3c 39                	cmp    $0x39,%al
+  8007e8:	76 e9                	jbe    8007d3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007ea:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007ed:	eb b1                	jmp    8007a0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007ef:	49 89 dc             	mov    %rbx,%r12
+  8007f2:	eb ac                	jmp    8007a0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007f4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f7:	85 c9                	test   %ecx,%ecx
+  8007f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fe:	0f 49 c1             	cmovns %ecx,%eax
+  800801:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800804:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800807:	e9 33 ff ff ff       	jmp    80073f <vprintfmt+0x75>
+            lflag++;
+  80080c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80080f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800812:	e9 28 ff ff ff       	jmp    80073f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 19                	ja     800838 <vprintfmt+0x16e>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	8b 3a                	mov    (%rdx),%edi
+  80082d:	4c 89 ee             	mov    %r13,%rsi
+  800830:	41 ff d6             	call   *%r14
+            break;
+  800833:	e9 c3 fe ff ff       	jmp    8006fb <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800844:	eb e5                	jmp    80082b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 5a                	ja     8008a8 <vprintfmt+0x1de>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80085a:	8b 02                	mov    (%rdx),%eax
+  80085c:	89 c1                	mov    %eax,%ecx
+  80085e:	f7 d9                	neg    %ecx
+  800860:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800863:	83 f9 14             	cmp    $0x14,%ecx
+  800866:	7f 4e                	jg     8008b6 <vprintfmt+0x1ec>
+  800868:	48 63 c1             	movslq %ecx,%rax
+  80086b:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800872:	00 00 00 
+  800875:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800879:	48 85 c0             	test   %rax,%rax
+  80087c:	74 38                	je     8008b6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80087e:	48 89 c1             	mov    %rax,%rcx
+  800881:	48 ba f9 41 80 00 00 	movabs $0x8041f9,%rdx
+  800888:	00 00 00 
+  80088b:	4c 89 ee             	mov    %r13,%rsi
+  80088e:	4c 89 f7             	mov    %r14,%rdi
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+  800896:	49 b8 8d 06 80 00 00 	movabs $0x80068d,%r8
+  80089d:	00 00 00 
+  8008a0:	41 ff d0             	call   *%r8
+  8008a3:	e9 53 fe ff ff       	jmp    8006fb <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	eb a4                	jmp    80085a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008b6:	48 ba c4 3b 80 00 00 	movabs $0x803bc4,%rdx
+  8008bd:	00 00 00 
+  8008c0:	4c 89 ee             	mov    %r13,%rsi
+  8008c3:	4c 89 f7             	mov    %r14,%rdi
+  8008c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cb:	49 b8 8d 06 80 00 00 	movabs $0x80068d,%r8
+  8008d2:	00 00 00 
+  8008d5:	41 ff d0             	call   *%r8
+  8008d8:	e9 1e fe ff ff       	jmp    8006fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 6c                	ja     800951 <vprintfmt+0x287>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008f4:	48 85 d2             	test   %rdx,%rdx
+  8008f7:	48 b8 bd 3b 80 00 00 	movabs $0x803bbd,%rax
+  8008fe:	00 00 00 
+  800901:	48 0f 45 c2          	cmovne %rdx,%rax
+  800905:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800909:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80090d:	7e 06                	jle    800915 <vprintfmt+0x24b>
+  80090f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800913:	75 4a                	jne    80095f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800915:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800919:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80091d:	0f b6 00             	movzbl (%rax),%eax
+  800920:	84 c0                	test   %al,%al
+  800922:	0f 85 9a 00 00 00    	jne    8009c2 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800928:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80092f:	85 c0                	test   %eax,%eax
+  800931:	0f 8e c4 fd ff ff    	jle    8006fb <vprintfmt+0x31>
+  800937:	4c 89 ee             	mov    %r13,%rsi
+  80093a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80093f:	41 ff d6             	call   *%r14
+  800942:	41 83 ec 01          	sub    $0x1,%r12d
+  800946:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80094a:	75 eb                	jne    800937 <vprintfmt+0x26d>
+  80094c:	e9 aa fd ff ff       	jmp    8006fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb 92                	jmp    8008f1 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80095f:	49 63 f7             	movslq %r15d,%rsi
+  800962:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800966:	48 b8 7c 0e 80 00 00 	movabs $0x800e7c,%rax
+  80096d:	00 00 00 
+  800970:	ff d0                	call   *%rax
+  800972:	48 89 c2             	mov    %rax,%rdx
+  800975:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800978:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80097a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80097d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800980:	85 c0                	test   %eax,%eax
+  800982:	7e 91                	jle    800915 <vprintfmt+0x24b>
+  800984:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800989:	4c 89 ee             	mov    %r13,%rsi
+  80098c:	44 89 e7             	mov    %r12d,%edi
+  80098f:	41 ff d6             	call   *%r14
+  800992:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800996:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800999:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80099c:	75 eb                	jne    800989 <vprintfmt+0x2bf>
+  80099e:	e9 72 ff ff ff       	jmp    800915 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a3:	0f b6 f8             	movzbl %al,%edi
+  8009a6:	4c 89 ee             	mov    %r13,%rsi
+  8009a9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009ac:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b0:	49 83 c4 01          	add    $0x1,%r12
+  8009b4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009ba:	84 c0                	test   %al,%al
+  8009bc:	0f 84 66 ff ff ff    	je     800928 <vprintfmt+0x25e>
+  8009c2:	45 85 ff             	test   %r15d,%r15d
+  8009c5:	78 0a                	js     8009d1 <vprintfmt+0x307>
+  8009c7:	41 83 ef 01          	sub    $0x1,%r15d
+  8009cb:	0f 88 57 ff ff ff    	js     800928 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009d5:	74 cc                	je     8009a3 <vprintfmt+0x2d9>
+  8009d7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009da:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009df:	80 fa 5e             	cmp    $0x5e,%dl
+  8009e2:	77 c2                	ja     8009a6 <vprintfmt+0x2dc>
+  8009e4:	eb bd                	jmp    8009a3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e6:	40 84 f6             	test   %sil,%sil
+  8009e9:	75 26                	jne    800a11 <vprintfmt+0x347>
+    switch (lflag) {
+  8009eb:	85 d2                	test   %edx,%edx
+  8009ed:	74 59                	je     800a48 <vprintfmt+0x37e>
+  8009ef:	83 fa 01             	cmp    $0x1,%edx
+  8009f2:	74 7b                	je     800a6f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fa:	0f 87 96 00 00 00    	ja     800a96 <vprintfmt+0x3cc>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	4c 8b 22             	mov    (%rdx),%r12
+  800a0f:	eb 17                	jmp    800a28 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a14:	83 f8 2f             	cmp    $0x2f,%eax
+  800a17:	77 21                	ja     800a3a <vprintfmt+0x370>
+  800a19:	89 c2                	mov    %eax,%edx
+  800a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1f:	83 c0 08             	add    $0x8,%eax
+  800a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a25:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a28:	4d 85 e4             	test   %r12,%r12
+  800a2b:	78 7a                	js     800aa7 <vprintfmt+0x3dd>
+            num = i;
+  800a2d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a30:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a35:	e9 50 02 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a46:	eb dd                	jmp    800a25 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4e:	77 11                	ja     800a61 <vprintfmt+0x397>
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a56:	83 c0 08             	add    $0x8,%eax
+  800a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5c:	4c 63 22             	movslq (%rdx),%r12
+  800a5f:	eb c7                	jmp    800a28 <vprintfmt+0x35e>
+  800a61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6d:	eb ed                	jmp    800a5c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a72:	83 f8 2f             	cmp    $0x2f,%eax
+  800a75:	77 11                	ja     800a88 <vprintfmt+0x3be>
+  800a77:	89 c2                	mov    %eax,%edx
+  800a79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7d:	83 c0 08             	add    $0x8,%eax
+  800a80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a83:	4c 8b 22             	mov    (%rdx),%r12
+  800a86:	eb a0                	jmp    800a28 <vprintfmt+0x35e>
+  800a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a94:	eb ed                	jmp    800a83 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	e9 65 ff ff ff       	jmp    800a0c <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aa7:	4c 89 ee             	mov    %r13,%rsi
+  800aaa:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aaf:	41 ff d6             	call   *%r14
+                i = -i;
+  800ab2:	49 f7 dc             	neg    %r12
+  800ab5:	e9 73 ff ff ff       	jmp    800a2d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800aba:	40 84 f6             	test   %sil,%sil
+  800abd:	75 32                	jne    800af1 <vprintfmt+0x427>
+    switch (lflag) {
+  800abf:	85 d2                	test   %edx,%edx
+  800ac1:	74 5d                	je     800b20 <vprintfmt+0x456>
+  800ac3:	83 fa 01             	cmp    $0x1,%edx
+  800ac6:	0f 84 82 00 00 00    	je     800b4e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	0f 87 a5 00 00 00    	ja     800b7d <vprintfmt+0x4b3>
+  800ad8:	89 c2                	mov    %eax,%edx
+  800ada:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ade:	83 c0 08             	add    $0x8,%eax
+  800ae1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aec:	e9 99 01 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af4:	83 f8 2f             	cmp    $0x2f,%eax
+  800af7:	77 19                	ja     800b12 <vprintfmt+0x448>
+  800af9:	89 c2                	mov    %eax,%edx
+  800afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aff:	83 c0 08             	add    $0x8,%eax
+  800b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b0d:	e9 78 01 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb e5                	jmp    800b05 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b23:	83 f8 2f             	cmp    $0x2f,%eax
+  800b26:	77 18                	ja     800b40 <vprintfmt+0x476>
+  800b28:	89 c2                	mov    %eax,%edx
+  800b2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2e:	83 c0 08             	add    $0x8,%eax
+  800b31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b34:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b3b:	e9 4a 01 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+  800b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4c:	eb e6                	jmp    800b34 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b51:	83 f8 2f             	cmp    $0x2f,%eax
+  800b54:	77 19                	ja     800b6f <vprintfmt+0x4a5>
+  800b56:	89 c2                	mov    %eax,%edx
+  800b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5c:	83 c0 08             	add    $0x8,%eax
+  800b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b62:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b65:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6a:	e9 1b 01 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+  800b6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7b:	eb e5                	jmp    800b62 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b89:	e9 56 ff ff ff       	jmp    800ae4 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8e:	40 84 f6             	test   %sil,%sil
+  800b91:	75 2e                	jne    800bc1 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b93:	85 d2                	test   %edx,%edx
+  800b95:	74 59                	je     800bf0 <vprintfmt+0x526>
+  800b97:	83 fa 01             	cmp    $0x1,%edx
+  800b9a:	74 7f                	je     800c1b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba2:	0f 87 9f 00 00 00    	ja     800c47 <vprintfmt+0x57d>
+  800ba8:	89 c2                	mov    %eax,%edx
+  800baa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bae:	83 c0 08             	add    $0x8,%eax
+  800bb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bbc:	e9 c9 00 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc7:	77 19                	ja     800be2 <vprintfmt+0x518>
+  800bc9:	89 c2                	mov    %eax,%edx
+  800bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcf:	83 c0 08             	add    $0x8,%eax
+  800bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bdd:	e9 a8 00 00 00       	jmp    800c8a <vprintfmt+0x5c0>
+  800be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bee:	eb e5                	jmp    800bd5 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	77 15                	ja     800c0d <vprintfmt+0x543>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfe:	83 c0 08             	add    $0x8,%eax
+  800c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c04:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c0b:	eb 7d                	jmp    800c8a <vprintfmt+0x5c0>
+  800c0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c19:	eb e9                	jmp    800c04 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c21:	77 16                	ja     800c39 <vprintfmt+0x56f>
+  800c23:	89 c2                	mov    %eax,%edx
+  800c25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c29:	83 c0 08             	add    $0x8,%eax
+  800c2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c32:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c37:	eb 51                	jmp    800c8a <vprintfmt+0x5c0>
+  800c39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c45:	eb e8                	jmp    800c2f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c53:	e9 5c ff ff ff       	jmp    800bb4 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c58:	4c 89 ee             	mov    %r13,%rsi
+  800c5b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c60:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c63:	4c 89 ee             	mov    %r13,%rsi
+  800c66:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c6b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c71:	83 f8 2f             	cmp    $0x2f,%eax
+  800c74:	77 47                	ja     800cbd <vprintfmt+0x5f3>
+  800c76:	89 c2                	mov    %eax,%edx
+  800c78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7c:	83 c0 08             	add    $0x8,%eax
+  800c7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c85:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c8a:	48 83 ec 08          	sub    $0x8,%rsp
+  800c8e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c92:	0f 94 c0             	sete   %al
+  800c95:	0f b6 c0             	movzbl %al,%eax
+  800c98:	50                   	push   %rax
+  800c99:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c9e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ca2:	4c 89 ee             	mov    %r13,%rsi
+  800ca5:	4c 89 f7             	mov    %r14,%rdi
+  800ca8:	48 b8 bf 05 80 00 00 	movabs $0x8005bf,%rax
+  800caf:	00 00 00 
+  800cb2:	ff d0                	call   *%rax
+            break;
+  800cb4:	48 83 c4 10          	add    $0x10,%rsp
+  800cb8:	e9 3e fa ff ff       	jmp    8006fb <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc9:	eb b7                	jmp    800c82 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ccb:	40 84 f6             	test   %sil,%sil
+  800cce:	75 2b                	jne    800cfb <vprintfmt+0x631>
+    switch (lflag) {
+  800cd0:	85 d2                	test   %edx,%edx
+  800cd2:	74 56                	je     800d2a <vprintfmt+0x660>
+  800cd4:	83 fa 01             	cmp    $0x1,%edx
+  800cd7:	74 7f                	je     800d58 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdf:	0f 87 a2 00 00 00    	ja     800d87 <vprintfmt+0x6bd>
+  800ce5:	89 c2                	mov    %eax,%edx
+  800ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ceb:	83 c0 08             	add    $0x8,%eax
+  800cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf9:	eb 8f                	jmp    800c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800d01:	77 19                	ja     800d1c <vprintfmt+0x652>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d09:	83 c0 08             	add    $0x8,%eax
+  800d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d12:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d17:	e9 6e ff ff ff       	jmp    800c8a <vprintfmt+0x5c0>
+  800d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	eb e5                	jmp    800d0f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d30:	77 18                	ja     800d4a <vprintfmt+0x680>
+  800d32:	89 c2                	mov    %eax,%edx
+  800d34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d38:	83 c0 08             	add    $0x8,%eax
+  800d3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d40:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d45:	e9 40 ff ff ff       	jmp    800c8a <vprintfmt+0x5c0>
+  800d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d56:	eb e6                	jmp    800d3e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5e:	77 19                	ja     800d79 <vprintfmt+0x6af>
+  800d60:	89 c2                	mov    %eax,%edx
+  800d62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d66:	83 c0 08             	add    $0x8,%eax
+  800d69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d74:	e9 11 ff ff ff       	jmp    800c8a <vprintfmt+0x5c0>
+  800d79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d85:	eb e5                	jmp    800d6c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d93:	e9 59 ff ff ff       	jmp    800cf1 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d98:	4c 89 ee             	mov    %r13,%rsi
+  800d9b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800da0:	41 ff d6             	call   *%r14
+            break;
+  800da3:	e9 53 f9 ff ff       	jmp    8006fb <vprintfmt+0x31>
+            putch('%', put_arg);
+  800da8:	4c 89 ee             	mov    %r13,%rsi
+  800dab:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db0:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800db3:	48 83 eb 01          	sub    $0x1,%rbx
+  800db7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dbb:	75 f6                	jne    800db3 <vprintfmt+0x6e9>
+  800dbd:	e9 39 f9 ff ff       	jmp    8006fb <vprintfmt+0x31>
+}
+  800dc2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dc6:	5b                   	pop    %rbx
+  800dc7:	41 5c                	pop    %r12
+  800dc9:	41 5d                	pop    %r13
+  800dcb:	41 5e                	pop    %r14
+  800dcd:	41 5f                	pop    %r15
+  800dcf:	5d                   	pop    %rbp
+  800dd0:	c3                   	ret
+
+0000000000800dd1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dd1:	55                   	push   %rbp
+  800dd2:	48 89 e5             	mov    %rsp,%rbp
+  800dd5:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ddd:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800de2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800de6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ded:	48 85 ff             	test   %rdi,%rdi
+  800df0:	74 2b                	je     800e1d <vsnprintf+0x4c>
+  800df2:	48 85 f6             	test   %rsi,%rsi
+  800df5:	74 26                	je     800e1d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800df7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dfb:	48 bf 75 06 80 00 00 	movabs $0x800675,%rdi
+  800e02:	00 00 00 
+  800e05:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  800e0c:	00 00 00 
+  800e0f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e15:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e18:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e1b:	c9                   	leave
+  800e1c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e22:	eb f7                	jmp    800e1b <vsnprintf+0x4a>
+
+0000000000800e24 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e24:	55                   	push   %rbp
+  800e25:	48 89 e5             	mov    %rsp,%rbp
+  800e28:	48 83 ec 50          	sub    $0x50,%rsp
+  800e2c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e30:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e34:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e38:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e47:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e4f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e53:	48 b8 d1 0d 80 00 00 	movabs $0x800dd1,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e5f:	c9                   	leave
+  800e60:	c3                   	ret
+
+0000000000800e61 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e61:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e64:	74 10                	je     800e76 <strlen+0x15>
+    size_t n = 0;
+  800e66:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e6b:	48 83 c0 01          	add    $0x1,%rax
+  800e6f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e73:	75 f6                	jne    800e6b <strlen+0xa>
+  800e75:	c3                   	ret
+    size_t n = 0;
+  800e76:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e7b:	c3                   	ret
+
+0000000000800e7c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e7c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e84:	48 85 f6             	test   %rsi,%rsi
+  800e87:	74 11                	je     800e9a <strnlen+0x1e>
+  800e89:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e8d:	74 0c                	je     800e9b <strnlen+0x1f>
+  800e8f:	48 83 c2 01          	add    $0x1,%rdx
+  800e93:	48 39 d0             	cmp    %rdx,%rax
+  800e96:	75 f1                	jne    800e89 <strnlen+0xd>
+  800e98:	eb 04                	jmp    800e9e <strnlen+0x22>
+  800e9a:	c3                   	ret
+  800e9b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e9e:	c3                   	ret
+
+0000000000800e9f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e9f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eab:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eae:	48 83 c2 01          	add    $0x1,%rdx
+  800eb2:	84 c9                	test   %cl,%cl
+  800eb4:	75 f1                	jne    800ea7 <strcpy+0x8>
+        ;
+    return res;
+}
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eb7:	55                   	push   %rbp
+  800eb8:	48 89 e5             	mov    %rsp,%rbp
+  800ebb:	41 54                	push   %r12
+  800ebd:	53                   	push   %rbx
+  800ebe:	48 89 fb             	mov    %rdi,%rbx
+  800ec1:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ec4:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  800ecb:	00 00 00 
+  800ece:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ed0:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ed4:	4c 89 e6             	mov    %r12,%rsi
+  800ed7:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  800ede:	00 00 00 
+  800ee1:	ff d0                	call   *%rax
+    return dst;
+}
+  800ee3:	48 89 d8             	mov    %rbx,%rax
+  800ee6:	5b                   	pop    %rbx
+  800ee7:	41 5c                	pop    %r12
+  800ee9:	5d                   	pop    %rbp
+  800eea:	c3                   	ret
+
+0000000000800eeb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eeb:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800eee:	48 85 d2             	test   %rdx,%rdx
+  800ef1:	74 1f                	je     800f12 <strncpy+0x27>
+  800ef3:	48 01 fa             	add    %rdi,%rdx
+  800ef6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ef9:	48 83 c1 01          	add    $0x1,%rcx
+  800efd:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f01:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f05:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f09:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f0d:	48 39 ca             	cmp    %rcx,%rdx
+  800f10:	75 e7                	jne    800ef9 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f12:	c3                   	ret
+
+0000000000800f13 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f13:	48 89 f8             	mov    %rdi,%rax
+  800f16:	48 85 d2             	test   %rdx,%rdx
+  800f19:	74 24                	je     800f3f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f1b:	48 83 ea 01          	sub    $0x1,%rdx
+  800f1f:	74 1b                	je     800f3c <strlcpy+0x29>
+  800f21:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f25:	0f b6 16             	movzbl (%rsi),%edx
+  800f28:	84 d2                	test   %dl,%dl
+  800f2a:	74 10                	je     800f3c <strlcpy+0x29>
+            *dst++ = *src++;
+  800f2c:	48 83 c6 01          	add    $0x1,%rsi
+  800f30:	48 83 c0 01          	add    $0x1,%rax
+  800f34:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f37:	48 39 c8             	cmp    %rcx,%rax
+  800f3a:	75 e9                	jne    800f25 <strlcpy+0x12>
+        *dst = '\0';
+  800f3c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f3f:	48 29 f8             	sub    %rdi,%rax
+}
+  800f42:	c3                   	ret
+
+0000000000800f43 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f43:	0f b6 07             	movzbl (%rdi),%eax
+  800f46:	84 c0                	test   %al,%al
+  800f48:	74 13                	je     800f5d <strcmp+0x1a>
+  800f4a:	38 06                	cmp    %al,(%rsi)
+  800f4c:	75 0f                	jne    800f5d <strcmp+0x1a>
+  800f4e:	48 83 c7 01          	add    $0x1,%rdi
+  800f52:	48 83 c6 01          	add    $0x1,%rsi
+  800f56:	0f b6 07             	movzbl (%rdi),%eax
+  800f59:	84 c0                	test   %al,%al
+  800f5b:	75 ed                	jne    800f4a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f5d:	0f b6 c0             	movzbl %al,%eax
+  800f60:	0f b6 16             	movzbl (%rsi),%edx
+  800f63:	29 d0                	sub    %edx,%eax
+}
+  800f65:	c3                   	ret
+
+0000000000800f66 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f66:	48 85 d2             	test   %rdx,%rdx
+  800f69:	74 1f                	je     800f8a <strncmp+0x24>
+  800f6b:	0f b6 07             	movzbl (%rdi),%eax
+  800f6e:	84 c0                	test   %al,%al
+  800f70:	74 1e                	je     800f90 <strncmp+0x2a>
+  800f72:	3a 06                	cmp    (%rsi),%al
+  800f74:	75 1a                	jne    800f90 <strncmp+0x2a>
+  800f76:	48 83 c7 01          	add    $0x1,%rdi
+  800f7a:	48 83 c6 01          	add    $0x1,%rsi
+  800f7e:	48 83 ea 01          	sub    $0x1,%rdx
+  800f82:	75 e7                	jne    800f6b <strncmp+0x5>
+
+    if (!n) return 0;
+  800f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f89:	c3                   	ret
+  800f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8f:	c3                   	ret
+  800f90:	48 85 d2             	test   %rdx,%rdx
+  800f93:	74 09                	je     800f9e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f95:	0f b6 07             	movzbl (%rdi),%eax
+  800f98:	0f b6 16             	movzbl (%rsi),%edx
+  800f9b:	29 d0                	sub    %edx,%eax
+  800f9d:	c3                   	ret
+    if (!n) return 0;
+  800f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fa4:	0f b6 17             	movzbl (%rdi),%edx
+  800fa7:	84 d2                	test   %dl,%dl
+  800fa9:	74 18                	je     800fc3 <strchr+0x1f>
+        if (*str == c) {
+  800fab:	0f be d2             	movsbl %dl,%edx
+  800fae:	39 f2                	cmp    %esi,%edx
+  800fb0:	74 17                	je     800fc9 <strchr+0x25>
+    for (; *str; str++) {
+  800fb2:	48 83 c7 01          	add    $0x1,%rdi
+  800fb6:	0f b6 17             	movzbl (%rdi),%edx
+  800fb9:	84 d2                	test   %dl,%dl
+  800fbb:	75 ee                	jne    800fab <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc2:	c3                   	ret
+  800fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc8:	c3                   	ret
+  800fc9:	48 89 f8             	mov    %rdi,%rax
+}
+  800fcc:	c3                   	ret
+
+0000000000800fcd <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fcd:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fd0:	0f b6 17             	movzbl (%rdi),%edx
+  800fd3:	84 d2                	test   %dl,%dl
+  800fd5:	74 13                	je     800fea <strfind+0x1d>
+  800fd7:	0f be d2             	movsbl %dl,%edx
+  800fda:	39 f2                	cmp    %esi,%edx
+  800fdc:	74 0b                	je     800fe9 <strfind+0x1c>
+  800fde:	48 83 c0 01          	add    $0x1,%rax
+  800fe2:	0f b6 10             	movzbl (%rax),%edx
+  800fe5:	84 d2                	test   %dl,%dl
+  800fe7:	75 ee                	jne    800fd7 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fe9:	c3                   	ret
+  800fea:	c3                   	ret
+
+0000000000800feb <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800feb:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fee:	48 89 f8             	mov    %rdi,%rax
+  800ff1:	48 f7 d8             	neg    %rax
+  800ff4:	83 e0 07             	and    $0x7,%eax
+  800ff7:	49 89 d1             	mov    %rdx,%r9
+  800ffa:	49 29 c1             	sub    %rax,%r9
+  800ffd:	78 36                	js     801035 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fff:	40 0f b6 c6          	movzbl %sil,%eax
+  801003:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80100a:	01 01 01 
+  80100d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801011:	40 f6 c7 07          	test   $0x7,%dil
+  801015:	75 38                	jne    80104f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801017:	4c 89 c9             	mov    %r9,%rcx
+  80101a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80101e:	74 0c                	je     80102c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801020:	fc                   	cld
+  801021:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801024:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801028:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80102c:	4d 85 c9             	test   %r9,%r9
+  80102f:	75 45                	jne    801076 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801031:	4c 89 c0             	mov    %r8,%rax
+  801034:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801035:	48 85 d2             	test   %rdx,%rdx
+  801038:	74 f7                	je     801031 <memset+0x46>
+  80103a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80103d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801040:	48 83 c0 01          	add    $0x1,%rax
+  801044:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801048:	48 39 c2             	cmp    %rax,%rdx
+  80104b:	75 f3                	jne    801040 <memset+0x55>
+  80104d:	eb e2                	jmp    801031 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80104f:	40 f6 c7 01          	test   $0x1,%dil
+  801053:	74 06                	je     80105b <memset+0x70>
+  801055:	88 07                	mov    %al,(%rdi)
+  801057:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80105b:	40 f6 c7 02          	test   $0x2,%dil
+  80105f:	74 07                	je     801068 <memset+0x7d>
+  801061:	66 89 07             	mov    %ax,(%rdi)
+  801064:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801068:	40 f6 c7 04          	test   $0x4,%dil
+  80106c:	74 a9                	je     801017 <memset+0x2c>
+  80106e:	89 07                	mov    %eax,(%rdi)
+  801070:	48 83 c7 04          	add    $0x4,%rdi
+  801074:	eb a1                	jmp    801017 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801076:	41 f6 c1 04          	test   $0x4,%r9b
+  80107a:	74 06                	je     801082 <memset+0x97>
+  80107c:	89 07                	mov    %eax,(%rdi)
+  80107e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801082:	41 f6 c1 02          	test   $0x2,%r9b
+  801086:	74 07                	je     80108f <memset+0xa4>
+  801088:	66 89 07             	mov    %ax,(%rdi)
+  80108b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80108f:	41 f6 c1 01          	test   $0x1,%r9b
+  801093:	74 9c                	je     801031 <memset+0x46>
+  801095:	88 07                	mov    %al,(%rdi)
+  801097:	eb 98                	jmp    801031 <memset+0x46>
+
+0000000000801099 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801099:	48 89 f8             	mov    %rdi,%rax
+  80109c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80109f:	48 39 fe             	cmp    %rdi,%rsi
+  8010a2:	73 3b                	jae    8010df <memmove+0x46>
+  8010a4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010a8:	48 39 d7             	cmp    %rdx,%rdi
+  8010ab:	73 32                	jae    8010df <memmove+0x46>
+        s += n;
+        d += n;
+  8010ad:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010b1:	48 89 d6             	mov    %rdx,%rsi
+  8010b4:	48 09 fe             	or     %rdi,%rsi
+  8010b7:	48 09 ce             	or     %rcx,%rsi
+  8010ba:	40 f6 c6 07          	test   $0x7,%sil
+  8010be:	75 12                	jne    8010d2 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010c0:	48 83 ef 08          	sub    $0x8,%rdi
+  8010c4:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010c8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010cc:	fd                   	std
+  8010cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010d0:	fc                   	cld
+  8010d1:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010d2:	48 83 ef 01          	sub    $0x1,%rdi
+  8010d6:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010da:	fd                   	std
+  8010db:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010dd:	eb f1                	jmp    8010d0 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010df:	48 89 f2             	mov    %rsi,%rdx
+  8010e2:	48 09 c2             	or     %rax,%rdx
+  8010e5:	48 09 ca             	or     %rcx,%rdx
+  8010e8:	f6 c2 07             	test   $0x7,%dl
+  8010eb:	75 0c                	jne    8010f9 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010ed:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010f1:	48 89 c7             	mov    %rax,%rdi
+  8010f4:	fc                   	cld
+  8010f5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010f8:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010f9:	48 89 c7             	mov    %rax,%rdi
+  8010fc:	fc                   	cld
+  8010fd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010ff:	c3                   	ret
+
+0000000000801100 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801100:	55                   	push   %rbp
+  801101:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801104:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  80110b:	00 00 00 
+  80110e:	ff d0                	call   *%rax
+}
+  801110:	5d                   	pop    %rbp
+  801111:	c3                   	ret
+
+0000000000801112 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801112:	55                   	push   %rbp
+  801113:	48 89 e5             	mov    %rsp,%rbp
+  801116:	41 57                	push   %r15
+  801118:	41 56                	push   %r14
+  80111a:	41 55                	push   %r13
+  80111c:	41 54                	push   %r12
+  80111e:	53                   	push   %rbx
+  80111f:	48 83 ec 08          	sub    $0x8,%rsp
+  801123:	49 89 fe             	mov    %rdi,%r14
+  801126:	49 89 f7             	mov    %rsi,%r15
+  801129:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80112c:	48 89 f7             	mov    %rsi,%rdi
+  80112f:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  801136:	00 00 00 
+  801139:	ff d0                	call   *%rax
+  80113b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80113e:	48 89 de             	mov    %rbx,%rsi
+  801141:	4c 89 f7             	mov    %r14,%rdi
+  801144:	48 b8 7c 0e 80 00 00 	movabs $0x800e7c,%rax
+  80114b:	00 00 00 
+  80114e:	ff d0                	call   *%rax
+  801150:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801153:	48 39 c3             	cmp    %rax,%rbx
+  801156:	74 36                	je     80118e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801158:	48 89 d8             	mov    %rbx,%rax
+  80115b:	4c 29 e8             	sub    %r13,%rax
+  80115e:	49 39 c4             	cmp    %rax,%r12
+  801161:	73 31                	jae    801194 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801163:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801168:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80116c:	4c 89 fe             	mov    %r15,%rsi
+  80116f:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  801176:	00 00 00 
+  801179:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80117b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80117f:	48 83 c4 08          	add    $0x8,%rsp
+  801183:	5b                   	pop    %rbx
+  801184:	41 5c                	pop    %r12
+  801186:	41 5d                	pop    %r13
+  801188:	41 5e                	pop    %r14
+  80118a:	41 5f                	pop    %r15
+  80118c:	5d                   	pop    %rbp
+  80118d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80118e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801192:	eb eb                	jmp    80117f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801194:	48 83 eb 01          	sub    $0x1,%rbx
+  801198:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80119c:	48 89 da             	mov    %rbx,%rdx
+  80119f:	4c 89 fe             	mov    %r15,%rsi
+  8011a2:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  8011a9:	00 00 00 
+  8011ac:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011ae:	49 01 de             	add    %rbx,%r14
+  8011b1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011b6:	eb c3                	jmp    80117b <strlcat+0x69>
+
+00000000008011b8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011b8:	48 85 d2             	test   %rdx,%rdx
+  8011bb:	74 2d                	je     8011ea <memcmp+0x32>
+  8011bd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011c2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011c6:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011cb:	44 38 c1             	cmp    %r8b,%cl
+  8011ce:	75 0f                	jne    8011df <memcmp+0x27>
+    while (n-- > 0) {
+  8011d0:	48 83 c0 01          	add    $0x1,%rax
+  8011d4:	48 39 c2             	cmp    %rax,%rdx
+  8011d7:	75 e9                	jne    8011c2 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011de:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011df:	0f b6 c1             	movzbl %cl,%eax
+  8011e2:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011e6:	44 29 c0             	sub    %r8d,%eax
+  8011e9:	c3                   	ret
+    return 0;
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ef:	c3                   	ret
+
+00000000008011f0 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011f0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011f4:	48 39 c7             	cmp    %rax,%rdi
+  8011f7:	73 0f                	jae    801208 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011f9:	40 38 37             	cmp    %sil,(%rdi)
+  8011fc:	74 0e                	je     80120c <memfind+0x1c>
+    for (; src < end; src++) {
+  8011fe:	48 83 c7 01          	add    $0x1,%rdi
+  801202:	48 39 f8             	cmp    %rdi,%rax
+  801205:	75 f2                	jne    8011f9 <memfind+0x9>
+  801207:	c3                   	ret
+  801208:	48 89 f8             	mov    %rdi,%rax
+  80120b:	c3                   	ret
+  80120c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80120f:	c3                   	ret
+
+0000000000801210 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801210:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801213:	0f b6 37             	movzbl (%rdi),%esi
+  801216:	40 80 fe 20          	cmp    $0x20,%sil
+  80121a:	74 06                	je     801222 <strtol+0x12>
+  80121c:	40 80 fe 09          	cmp    $0x9,%sil
+  801220:	75 13                	jne    801235 <strtol+0x25>
+  801222:	48 83 c7 01          	add    $0x1,%rdi
+  801226:	0f b6 37             	movzbl (%rdi),%esi
+  801229:	40 80 fe 20          	cmp    $0x20,%sil
+  80122d:	74 f3                	je     801222 <strtol+0x12>
+  80122f:	40 80 fe 09          	cmp    $0x9,%sil
+  801233:	74 ed                	je     801222 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801235:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801238:	83 e0 fd             	and    $0xfffffffd,%eax
+  80123b:	3c 01                	cmp    $0x1,%al
+  80123d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801241:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801247:	75 0f                	jne    801258 <strtol+0x48>
+  801249:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80124c:	74 14                	je     801262 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80124e:	85 d2                	test   %edx,%edx
+  801250:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801255:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801258:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80125d:	4c 63 ca             	movslq %edx,%r9
+  801260:	eb 36                	jmp    801298 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801262:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801266:	74 0f                	je     801277 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801268:	85 d2                	test   %edx,%edx
+  80126a:	75 ec                	jne    801258 <strtol+0x48>
+        s++;
+  80126c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801270:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801275:	eb e1                	jmp    801258 <strtol+0x48>
+        s += 2;
+  801277:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80127b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801280:	eb d6                	jmp    801258 <strtol+0x48>
+            dig -= '0';
+  801282:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801285:	44 0f b6 c1          	movzbl %cl,%r8d
+  801289:	41 39 d0             	cmp    %edx,%r8d
+  80128c:	7d 21                	jge    8012af <strtol+0x9f>
+        val = val * base + dig;
+  80128e:	49 0f af c1          	imul   %r9,%rax
+  801292:	0f b6 c9             	movzbl %cl,%ecx
+  801295:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801298:	48 83 c7 01          	add    $0x1,%rdi
+  80129c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012a0:	80 f9 39             	cmp    $0x39,%cl
+  8012a3:	76 dd                	jbe    801282 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012a5:	80 f9 7b             	cmp    $0x7b,%cl
+  8012a8:	77 05                	ja     8012af <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012aa:	83 e9 57             	sub    $0x57,%ecx
+  8012ad:	eb d6                	jmp    801285 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012af:	4d 85 d2             	test   %r10,%r10
+  8012b2:	74 03                	je     8012b7 <strtol+0xa7>
+  8012b4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012b7:	48 89 c2             	mov    %rax,%rdx
+  8012ba:	48 f7 da             	neg    %rdx
+  8012bd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012c1:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012c5:	c3                   	ret
+
+00000000008012c6 <strrev>:
+
+void
+strrev(char *str)
+{
+  8012c6:	55                   	push   %rbp
+  8012c7:	48 89 e5             	mov    %rsp,%rbp
+  8012ca:	53                   	push   %rbx
+  8012cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8012cf:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8012d2:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  8012d9:	00 00 00 
+  8012dc:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8012de:	83 e8 01             	sub    $0x1,%eax
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	7e 22                	jle    801307 <strrev+0x41>
+  8012e5:	48 98                	cltq
+  8012e7:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8012ec:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8012f0:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8012f4:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8012f8:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8012fb:	48 83 c2 01          	add    $0x1,%rdx
+  8012ff:	48 83 e8 01          	sub    $0x1,%rax
+  801303:	39 c2                	cmp    %eax,%edx
+  801305:	7c e5                	jl     8012ec <strrev+0x26>
+	}
+}
+  801307:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+
+000000000080130d <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80130d:	85 d2                	test   %edx,%edx
+  80130f:	0f 84 80 00 00 00    	je     801395 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	53                   	push   %rbx
+  80131a:	48 83 ec 08          	sub    $0x8,%rsp
+  80131e:	49 89 f2             	mov    %rsi,%r10
+  801321:	41 89 d3             	mov    %edx,%r11d
+  801324:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801327:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80132c:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80132f:	eb 20                	jmp    801351 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801331:	41 89 f1             	mov    %esi,%r9d
+  801334:	83 c2 30             	add    $0x30,%edx
+  801337:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80133a:	89 f8                	mov    %edi,%eax
+  80133c:	99                   	cltd
+  80133d:	f7 f9                	idiv   %ecx
+  80133f:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801341:	85 c0                	test   %eax,%eax
+  801343:	74 2e                	je     801373 <itoa+0x66>
+  801345:	83 c6 01             	add    $0x1,%esi
+  801348:	49 83 c0 01          	add    $0x1,%r8
+  80134c:	44 39 cb             	cmp    %r9d,%ebx
+  80134f:	7e 15                	jle    801366 <itoa+0x59>
+		digit = sum % base;
+  801351:	89 f8                	mov    %edi,%eax
+  801353:	99                   	cltd
+  801354:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801356:	83 fa 09             	cmp    $0x9,%edx
+  801359:	7e d6                	jle    801331 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80135b:	41 89 f1             	mov    %esi,%r9d
+  80135e:	83 c2 37             	add    $0x37,%edx
+  801361:	41 88 10             	mov    %dl,(%r8)
+  801364:	eb d4                	jmp    80133a <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801366:	41 83 eb 01          	sub    $0x1,%r11d
+  80136a:	45 39 cb             	cmp    %r9d,%r11d
+  80136d:	75 04                	jne    801373 <itoa+0x66>
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	75 28                	jne    80139b <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801373:	4d 63 c9             	movslq %r9d,%r9
+  801376:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80137b:	4c 89 d7             	mov    %r10,%rdi
+  80137e:	48 b8 c6 12 80 00 00 	movabs $0x8012c6,%rax
+  801385:	00 00 00 
+  801388:	ff d0                	call   *%rax
+	return 0;
+  80138a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801393:	c9                   	leave
+  801394:	c3                   	ret
+		return -1;
+  801395:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80139a:	c3                   	ret
+		return -1;
+  80139b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013a0:	eb ed                	jmp    80138f <itoa+0x82>
+
+00000000008013a2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013a2:	55                   	push   %rbp
+  8013a3:	48 89 e5             	mov    %rsp,%rbp
+  8013a6:	53                   	push   %rbx
+  8013a7:	48 89 fa             	mov    %rdi,%rdx
+  8013aa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c7:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cd:	c9                   	leave
+  8013ce:	c3                   	ret
+
+00000000008013cf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013cf:	55                   	push   %rbp
+  8013d0:	48 89 e5             	mov    %rsp,%rbp
+  8013d3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013de:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+
+0000000000801400 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801400:	55                   	push   %rbp
+  801401:	48 89 e5             	mov    %rsp,%rbp
+  801404:	53                   	push   %rbx
+  801405:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801409:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801411:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801416:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801420:	be 00 00 00 00       	mov    $0x0,%esi
+  801425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142d:	48 85 c0             	test   %rax,%rax
+  801430:	7f 06                	jg     801438 <sys_env_destroy+0x38>
+}
+  801432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801436:	c9                   	leave
+  801437:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801438:	49 89 c0             	mov    %rax,%r8
+  80143b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801440:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  801447:	00 00 00 
+  80144a:	be 26 00 00 00       	mov    $0x26,%esi
+  80144f:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  801456:	00 00 00 
+  801459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145e:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  801465:	00 00 00 
+  801468:	41 ff d1             	call   *%r9
+
+000000000080146b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801470:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801475:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801484:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801489:	be 00 00 00 00       	mov    $0x0,%esi
+  80148e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801494:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801496:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149a:	c9                   	leave
+  80149b:	c3                   	ret
+
+000000000080149c <sys_yield>:
+
+void
+sys_yield(void) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cb:	c9                   	leave
+  8014cc:	c3                   	ret
+
+00000000008014cd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014cd:	55                   	push   %rbp
+  8014ce:	48 89 e5             	mov    %rsp,%rbp
+  8014d1:	53                   	push   %rbx
+  8014d2:	48 89 fa             	mov    %rdi,%rdx
+  8014d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014dd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014e4:	00 00 00 
+  8014e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+00000000008014ff <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	53                   	push   %rbx
+  801504:	49 89 f8             	mov    %rdi,%r8
+  801507:	48 89 d3             	mov    %rdx,%rbx
+  80150a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80150d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801512:	4c 89 c2             	mov    %r8,%rdx
+  801515:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801518:	be 00 00 00 00       	mov    $0x0,%esi
+  80151d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801523:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801529:	c9                   	leave
+  80152a:	c3                   	ret
+
+000000000080152b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80152b:	55                   	push   %rbp
+  80152c:	48 89 e5             	mov    %rsp,%rbp
+  80152f:	53                   	push   %rbx
+  801530:	48 83 ec 08          	sub    $0x8,%rsp
+  801534:	89 f8                	mov    %edi,%eax
+  801536:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801539:	48 63 f9             	movslq %ecx,%rdi
+  80153c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801544:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801547:	be 00 00 00 00       	mov    $0x0,%esi
+  80154c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801552:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801554:	48 85 c0             	test   %rax,%rax
+  801557:	7f 06                	jg     80155f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801559:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155d:	c9                   	leave
+  80155e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155f:	49 89 c0             	mov    %rax,%r8
+  801562:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801567:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  80156e:	00 00 00 
+  801571:	be 26 00 00 00       	mov    $0x26,%esi
+  801576:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  80157d:	00 00 00 
+  801580:	b8 00 00 00 00       	mov    $0x0,%eax
+  801585:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  80158c:	00 00 00 
+  80158f:	41 ff d1             	call   *%r9
+
+0000000000801592 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801592:	55                   	push   %rbp
+  801593:	48 89 e5             	mov    %rsp,%rbp
+  801596:	53                   	push   %rbx
+  801597:	48 83 ec 08          	sub    $0x8,%rsp
+  80159b:	89 f8                	mov    %edi,%eax
+  80159d:	49 89 f2             	mov    %rsi,%r10
+  8015a0:	48 89 cf             	mov    %rcx,%rdi
+  8015a3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015a6:	48 63 da             	movslq %edx,%rbx
+  8015a9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ac:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b9:	48 85 c0             	test   %rax,%rax
+  8015bc:	7f 06                	jg     8015c4 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c4:	49 89 c0             	mov    %rax,%r8
+  8015c7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015cc:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  8015d3:	00 00 00 
+  8015d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015db:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  8015e2:	00 00 00 
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  8015f1:	00 00 00 
+  8015f4:	41 ff d1             	call   *%r9
+
+00000000008015f7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801600:	48 89 f1             	mov    %rsi,%rcx
+  801603:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801606:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801609:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801613:	be 00 00 00 00       	mov    $0x0,%esi
+  801618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801620:	48 85 c0             	test   %rax,%rax
+  801623:	7f 06                	jg     80162b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162b:	49 89 c0             	mov    %rax,%r8
+  80162e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801633:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  80163a:	00 00 00 
+  80163d:	be 26 00 00 00       	mov    $0x26,%esi
+  801642:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  801649:	00 00 00 
+  80164c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801651:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  801658:	00 00 00 
+  80165b:	41 ff d1             	call   *%r9
+
+000000000080165e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+  801662:	53                   	push   %rbx
+  801663:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801667:	48 63 ce             	movslq %esi,%rcx
+  80166a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801677:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167c:	be 00 00 00 00       	mov    $0x0,%esi
+  801681:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801687:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801689:	48 85 c0             	test   %rax,%rax
+  80168c:	7f 06                	jg     801694 <sys_env_set_status+0x36>
+}
+  80168e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801692:	c9                   	leave
+  801693:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801694:	49 89 c0             	mov    %rax,%r8
+  801697:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80169c:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  8016a3:	00 00 00 
+  8016a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ab:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  8016b2:	00 00 00 
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  8016c1:	00 00 00 
+  8016c4:	41 ff d1             	call   *%r9
+
+00000000008016c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016c7:	55                   	push   %rbp
+  8016c8:	48 89 e5             	mov    %rsp,%rbp
+  8016cb:	53                   	push   %rbx
+  8016cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f2:	48 85 c0             	test   %rax,%rax
+  8016f5:	7f 06                	jg     8016fd <sys_env_set_trapframe+0x36>
+}
+  8016f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fb:	c9                   	leave
+  8016fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fd:	49 89 c0             	mov    %rax,%r8
+  801700:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801705:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  80170c:	00 00 00 
+  80170f:	be 26 00 00 00       	mov    $0x26,%esi
+  801714:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  80171b:	00 00 00 
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  80172a:	00 00 00 
+  80172d:	41 ff d1             	call   *%r9
+
+0000000000801730 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801730:	55                   	push   %rbp
+  801731:	48 89 e5             	mov    %rsp,%rbp
+  801734:	53                   	push   %rbx
+  801735:	48 83 ec 08          	sub    $0x8,%rsp
+  801739:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80173c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801744:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801749:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174e:	be 00 00 00 00       	mov    $0x0,%esi
+  801753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801759:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175b:	48 85 c0             	test   %rax,%rax
+  80175e:	7f 06                	jg     801766 <sys_env_set_pgfault_upcall+0x36>
+}
+  801760:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801764:	c9                   	leave
+  801765:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801766:	49 89 c0             	mov    %rax,%r8
+  801769:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80176e:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  801775:	00 00 00 
+  801778:	be 26 00 00 00       	mov    $0x26,%esi
+  80177d:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  801784:	00 00 00 
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178c:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  801793:	00 00 00 
+  801796:	41 ff d1             	call   *%r9
+
+0000000000801799 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	53                   	push   %rbx
+  80179e:	89 f8                	mov    %edi,%eax
+  8017a0:	49 89 f1             	mov    %rsi,%r9
+  8017a3:	48 89 d3             	mov    %rdx,%rbx
+  8017a6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017a9:	49 63 f0             	movslq %r8d,%rsi
+  8017ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017af:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bd:	cd 30                	int    $0x30
+}
+  8017bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+
+00000000008017c5 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+  8017c9:	53                   	push   %rbx
+  8017ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ce:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8017d1:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d9:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ee:	48 85 c0             	test   %rax,%rax
+  8017f1:	7f 06                	jg     8017f9 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f9:	49 89 c0             	mov    %rax,%r8
+  8017fc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801801:	48 ba c8 40 80 00 00 	movabs $0x8040c8,%rdx
+  801808:	00 00 00 
+  80180b:	be 26 00 00 00       	mov    $0x26,%esi
+  801810:	48 bf e7 40 80 00 00 	movabs $0x8040e7,%rdi
+  801817:	00 00 00 
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181f:	49 b9 2a 04 80 00 00 	movabs $0x80042a,%r9
+  801826:	00 00 00 
+  801829:	41 ff d1             	call   *%r9
+
+000000000080182c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801830:	ba 00 00 00 00       	mov    $0x0,%edx
+  801835:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+}
+  801841:	5d                   	pop    %rbp
+  801842:	c3                   	ret
+
+0000000000801843 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+  801847:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801852:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801857:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801861:	be 00 00 00 00       	mov    $0x0,%esi
+  801866:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80186e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+
+0000000000801874 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801874:	55                   	push   %rbp
+  801875:	48 89 e5             	mov    %rsp,%rbp
+  801878:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801879:	48 63 ce             	movslq %esi,%rcx
+  80187c:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801880:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801885:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188f:	be 00 00 00 00       	mov    $0x0,%esi
+  801894:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189a:	cd 30                	int    $0x30
+}
+  80189c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+
+00000000008018a2 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8018aa:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ae:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c8:	cd 30                	int    $0x30
+}
+  8018ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ce:	c9                   	leave
+  8018cf:	c3                   	ret
+
+00000000008018d0 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	53                   	push   %rbx
+  8018d5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8018d8:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018db:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f3:	cd 30                	int    $0x30
+}
+  8018f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f9:	c9                   	leave
+  8018fa:	c3                   	ret
+
+00000000008018fb <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8018fb:	55                   	push   %rbp
+  8018fc:	48 89 e5             	mov    %rsp,%rbp
+  8018ff:	41 54                	push   %r12
+  801901:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801902:	b8 08 00 00 00       	mov    $0x8,%eax
+  801907:	cd 30                	int    $0x30
+  801909:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	78 7e                	js     80198e <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801910:	0f 84 80 00 00 00    	je     801996 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801916:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80191c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801923:	00 00 00 
+  801926:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192b:	89 c2                	mov    %eax,%edx
+  80192d:	be 00 00 00 00       	mov    $0x0,%esi
+  801932:	bf 00 00 00 00       	mov    $0x0,%edi
+  801937:	48 b8 92 15 80 00 00 	movabs $0x801592,%rax
+  80193e:	00 00 00 
+  801941:	ff d0                	call   *%rax
+  801943:	85 c0                	test   %eax,%eax
+  801945:	0f 88 81 00 00 00    	js     8019cc <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80194b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801952:	00 00 00 
+  801955:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  80195c:	44 89 e7             	mov    %r12d,%edi
+  80195f:	48 b8 30 17 80 00 00 	movabs $0x801730,%rax
+  801966:	00 00 00 
+  801969:	ff d0                	call   *%rax
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	78 65                	js     8019d4 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80196f:	be 02 00 00 00       	mov    $0x2,%esi
+  801974:	44 89 e7             	mov    %r12d,%edi
+  801977:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  80197e:	00 00 00 
+  801981:	ff d0                	call   *%rax
+        return -1;
+  801983:	85 c0                	test   %eax,%eax
+  801985:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80198a:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  80198e:	44 89 e0             	mov    %r12d,%eax
+  801991:	5b                   	pop    %rbx
+  801992:	41 5c                	pop    %r12
+  801994:	5d                   	pop    %rbp
+  801995:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801996:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+  8019a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019a7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8019ab:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8019af:	48 c1 e0 04          	shl    $0x4,%rax
+  8019b3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019ba:	00 00 00 
+  8019bd:	48 01 d0             	add    %rdx,%rax
+  8019c0:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8019c7:	00 00 00 
+        return 0;
+  8019ca:	eb c2                	jmp    80198e <fork+0x93>
+        return -1;
+  8019cc:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019d2:	eb ba                	jmp    80198e <fork+0x93>
+        return -1;
+  8019d4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019da:	eb b2                	jmp    80198e <fork+0x93>
+
+00000000008019dc <sfork>:
+
+envid_t
+sfork() {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019e0:	48 ba f5 40 80 00 00 	movabs $0x8040f5,%rdx
+  8019e7:	00 00 00 
+  8019ea:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8019ef:	48 bf 10 41 80 00 00 	movabs $0x804110,%rdi
+  8019f6:	00 00 00 
+  8019f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fe:	48 b9 2a 04 80 00 00 	movabs $0x80042a,%rcx
+  801a05:	00 00 00 
+  801a08:	ff d1                	call   *%rcx
+
+0000000000801a0a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a0a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a11:	ff ff ff 
+  801a14:	48 01 f8             	add    %rdi,%rax
+  801a17:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a1b:	c3                   	ret
+
+0000000000801a1c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a1c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a23:	ff ff ff 
+  801a26:	48 01 f8             	add    %rdi,%rax
+  801a29:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a2d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a33:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a37:	c3                   	ret
+
+0000000000801a38 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	41 57                	push   %r15
+  801a3e:	41 56                	push   %r14
+  801a40:	41 55                	push   %r13
+  801a42:	41 54                	push   %r12
+  801a44:	53                   	push   %rbx
+  801a45:	48 83 ec 08          	sub    $0x8,%rsp
+  801a49:	49 89 ff             	mov    %rdi,%r15
+  801a4c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a51:	49 bd 57 35 80 00 00 	movabs $0x803557,%r13
+  801a58:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a5b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a61:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a64:	48 89 df             	mov    %rbx,%rdi
+  801a67:	41 ff d5             	call   *%r13
+  801a6a:	83 e0 04             	and    $0x4,%eax
+  801a6d:	74 17                	je     801a86 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a6f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a76:	4c 39 f3             	cmp    %r14,%rbx
+  801a79:	75 e6                	jne    801a61 <fd_alloc+0x29>
+  801a7b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a81:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a86:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a89:	48 83 c4 08          	add    $0x8,%rsp
+  801a8d:	5b                   	pop    %rbx
+  801a8e:	41 5c                	pop    %r12
+  801a90:	41 5d                	pop    %r13
+  801a92:	41 5e                	pop    %r14
+  801a94:	41 5f                	pop    %r15
+  801a96:	5d                   	pop    %rbp
+  801a97:	c3                   	ret
+
+0000000000801a98 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a98:	83 ff 1f             	cmp    $0x1f,%edi
+  801a9b:	77 39                	ja     801ad6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a9d:	55                   	push   %rbp
+  801a9e:	48 89 e5             	mov    %rsp,%rbp
+  801aa1:	41 54                	push   %r12
+  801aa3:	53                   	push   %rbx
+  801aa4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aa7:	48 63 df             	movslq %edi,%rbx
+  801aaa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ab1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ab5:	48 89 df             	mov    %rbx,%rdi
+  801ab8:	48 b8 57 35 80 00 00 	movabs $0x803557,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	a8 04                	test   $0x4,%al
+  801ac6:	74 14                	je     801adc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ac8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801acc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad1:	5b                   	pop    %rbx
+  801ad2:	41 5c                	pop    %r12
+  801ad4:	5d                   	pop    %rbp
+  801ad5:	c3                   	ret
+        return -E_INVAL;
+  801ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801adb:	c3                   	ret
+        return -E_INVAL;
+  801adc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae1:	eb ee                	jmp    801ad1 <fd_lookup+0x39>
+
+0000000000801ae3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ae3:	55                   	push   %rbp
+  801ae4:	48 89 e5             	mov    %rsp,%rbp
+  801ae7:	41 54                	push   %r12
+  801ae9:	53                   	push   %rbx
+  801aea:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aed:	48 b8 c0 41 80 00 00 	movabs $0x8041c0,%rax
+  801af4:	00 00 00 
+  801af7:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801afe:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b01:	39 3b                	cmp    %edi,(%rbx)
+  801b03:	74 47                	je     801b4c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b05:	48 83 c0 08          	add    $0x8,%rax
+  801b09:	48 8b 18             	mov    (%rax),%rbx
+  801b0c:	48 85 db             	test   %rbx,%rbx
+  801b0f:	75 f0                	jne    801b01 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b11:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b18:	00 00 00 
+  801b1b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b21:	89 fa                	mov    %edi,%edx
+  801b23:	48 bf 20 41 80 00 00 	movabs $0x804120,%rdi
+  801b2a:	00 00 00 
+  801b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b32:	48 b9 7a 05 80 00 00 	movabs $0x80057a,%rcx
+  801b39:	00 00 00 
+  801b3c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b43:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b47:	5b                   	pop    %rbx
+  801b48:	41 5c                	pop    %r12
+  801b4a:	5d                   	pop    %rbp
+  801b4b:	c3                   	ret
+            return 0;
+  801b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b51:	eb f0                	jmp    801b43 <dev_lookup+0x60>
+
+0000000000801b53 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	41 55                	push   %r13
+  801b59:	41 54                	push   %r12
+  801b5b:	53                   	push   %rbx
+  801b5c:	48 83 ec 18          	sub    $0x18,%rsp
+  801b60:	48 89 fb             	mov    %rdi,%rbx
+  801b63:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b66:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b6d:	ff ff ff 
+  801b70:	48 01 df             	add    %rbx,%rdi
+  801b73:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b77:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b7b:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+  801b87:	41 89 c5             	mov    %eax,%r13d
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 06                	js     801b94 <fd_close+0x41>
+  801b8e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b92:	74 1a                	je     801bae <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b94:	45 84 e4             	test   %r12b,%r12b
+  801b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ba0:	44 89 e8             	mov    %r13d,%eax
+  801ba3:	48 83 c4 18          	add    $0x18,%rsp
+  801ba7:	5b                   	pop    %rbx
+  801ba8:	41 5c                	pop    %r12
+  801baa:	41 5d                	pop    %r13
+  801bac:	5d                   	pop    %rbp
+  801bad:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bae:	8b 3b                	mov    (%rbx),%edi
+  801bb0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb4:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  801bbb:	00 00 00 
+  801bbe:	ff d0                	call   *%rax
+  801bc0:	41 89 c5             	mov    %eax,%r13d
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 1b                	js     801be2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bcb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801bcf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bd5:	48 85 c0             	test   %rax,%rax
+  801bd8:	74 08                	je     801be2 <fd_close+0x8f>
+  801bda:	48 89 df             	mov    %rbx,%rdi
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801be2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be7:	48 89 de             	mov    %rbx,%rsi
+  801bea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bef:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+    return res;
+  801bfb:	eb a3                	jmp    801ba0 <fd_close+0x4d>
+
+0000000000801bfd <close>:
+
+int
+close(int fdnum) {
+  801bfd:	55                   	push   %rbp
+  801bfe:	48 89 e5             	mov    %rsp,%rbp
+  801c01:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c05:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c09:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 15                	js     801c2e <close+0x31>
+
+    return fd_close(fd, 1);
+  801c19:	be 01 00 00 00       	mov    $0x1,%esi
+  801c1e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c22:	48 b8 53 1b 80 00 00 	movabs $0x801b53,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+}
+  801c2e:	c9                   	leave
+  801c2f:	c3                   	ret
+
+0000000000801c30 <close_all>:
+
+void
+close_all(void) {
+  801c30:	55                   	push   %rbp
+  801c31:	48 89 e5             	mov    %rsp,%rbp
+  801c34:	41 54                	push   %r12
+  801c36:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c3c:	49 bc fd 1b 80 00 00 	movabs $0x801bfd,%r12
+  801c43:	00 00 00 
+  801c46:	89 df                	mov    %ebx,%edi
+  801c48:	41 ff d4             	call   *%r12
+  801c4b:	83 c3 01             	add    $0x1,%ebx
+  801c4e:	83 fb 20             	cmp    $0x20,%ebx
+  801c51:	75 f3                	jne    801c46 <close_all+0x16>
+}
+  801c53:	5b                   	pop    %rbx
+  801c54:	41 5c                	pop    %r12
+  801c56:	5d                   	pop    %rbp
+  801c57:	c3                   	ret
+
+0000000000801c58 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c58:	55                   	push   %rbp
+  801c59:	48 89 e5             	mov    %rsp,%rbp
+  801c5c:	41 57                	push   %r15
+  801c5e:	41 56                	push   %r14
+  801c60:	41 55                	push   %r13
+  801c62:	41 54                	push   %r12
+  801c64:	53                   	push   %rbx
+  801c65:	48 83 ec 18          	sub    $0x18,%rsp
+  801c69:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c6c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c70:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801c77:	00 00 00 
+  801c7a:	ff d0                	call   *%rax
+  801c7c:	89 c3                	mov    %eax,%ebx
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	0f 88 b8 00 00 00    	js     801d3e <dup+0xe6>
+    close(newfdnum);
+  801c86:	44 89 e7             	mov    %r12d,%edi
+  801c89:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801c90:	00 00 00 
+  801c93:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c95:	4d 63 ec             	movslq %r12d,%r13
+  801c98:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c9f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ca3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ca7:	4c 89 ff             	mov    %r15,%rdi
+  801caa:	49 be 1c 1a 80 00 00 	movabs $0x801a1c,%r14
+  801cb1:	00 00 00 
+  801cb4:	41 ff d6             	call   *%r14
+  801cb7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cba:	4c 89 ef             	mov    %r13,%rdi
+  801cbd:	41 ff d6             	call   *%r14
+  801cc0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cc3:	48 89 df             	mov    %rbx,%rdi
+  801cc6:	48 b8 57 35 80 00 00 	movabs $0x803557,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cd2:	a8 04                	test   $0x4,%al
+  801cd4:	74 2b                	je     801d01 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801cd6:	41 89 c1             	mov    %eax,%r9d
+  801cd9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cdf:	4c 89 f1             	mov    %r14,%rcx
+  801ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce7:	48 89 de             	mov    %rbx,%rsi
+  801cea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cef:	48 b8 92 15 80 00 00 	movabs $0x801592,%rax
+  801cf6:	00 00 00 
+  801cf9:	ff d0                	call   *%rax
+  801cfb:	89 c3                	mov    %eax,%ebx
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	78 4e                	js     801d4f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d01:	4c 89 ff             	mov    %r15,%rdi
+  801d04:	48 b8 57 35 80 00 00 	movabs $0x803557,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d13:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d19:	4c 89 e9             	mov    %r13,%rcx
+  801d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d21:	4c 89 fe             	mov    %r15,%rsi
+  801d24:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d29:	48 b8 92 15 80 00 00 	movabs $0x801592,%rax
+  801d30:	00 00 00 
+  801d33:	ff d0                	call   *%rax
+  801d35:	89 c3                	mov    %eax,%ebx
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 14                	js     801d4f <dup+0xf7>
+
+    return newfdnum;
+  801d3b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d3e:	89 d8                	mov    %ebx,%eax
+  801d40:	48 83 c4 18          	add    $0x18,%rsp
+  801d44:	5b                   	pop    %rbx
+  801d45:	41 5c                	pop    %r12
+  801d47:	41 5d                	pop    %r13
+  801d49:	41 5e                	pop    %r14
+  801d4b:	41 5f                	pop    %r15
+  801d4d:	5d                   	pop    %rbp
+  801d4e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d54:	4c 89 ee             	mov    %r13,%rsi
+  801d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5c:	49 bc f7 15 80 00 00 	movabs $0x8015f7,%r12
+  801d63:	00 00 00 
+  801d66:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d6e:	4c 89 f6             	mov    %r14,%rsi
+  801d71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d76:	41 ff d4             	call   *%r12
+    return res;
+  801d79:	eb c3                	jmp    801d3e <dup+0xe6>
+
+0000000000801d7b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	41 56                	push   %r14
+  801d81:	41 55                	push   %r13
+  801d83:	41 54                	push   %r12
+  801d85:	53                   	push   %rbx
+  801d86:	48 83 ec 10          	sub    $0x10,%rsp
+  801d8a:	89 fb                	mov    %edi,%ebx
+  801d8c:	49 89 f4             	mov    %rsi,%r12
+  801d8f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d92:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d96:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 4c                	js     801df2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801daa:	41 8b 3e             	mov    (%r14),%edi
+  801dad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db1:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 35                	js     801df6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dc1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dc5:	83 e0 03             	and    $0x3,%eax
+  801dc8:	83 f8 01             	cmp    $0x1,%eax
+  801dcb:	74 2d                	je     801dfa <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dcd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dd5:	48 85 c0             	test   %rax,%rax
+  801dd8:	74 56                	je     801e30 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dda:	4c 89 ea             	mov    %r13,%rdx
+  801ddd:	4c 89 e6             	mov    %r12,%rsi
+  801de0:	4c 89 f7             	mov    %r14,%rdi
+  801de3:	ff d0                	call   *%rax
+}
+  801de5:	48 83 c4 10          	add    $0x10,%rsp
+  801de9:	5b                   	pop    %rbx
+  801dea:	41 5c                	pop    %r12
+  801dec:	41 5d                	pop    %r13
+  801dee:	41 5e                	pop    %r14
+  801df0:	5d                   	pop    %rbp
+  801df1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df2:	48 98                	cltq
+  801df4:	eb ef                	jmp    801de5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df6:	48 98                	cltq
+  801df8:	eb eb                	jmp    801de5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dfa:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e01:	00 00 00 
+  801e04:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e0a:	89 da                	mov    %ebx,%edx
+  801e0c:	48 bf 81 41 80 00 00 	movabs $0x804181,%rdi
+  801e13:	00 00 00 
+  801e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1b:	48 b9 7a 05 80 00 00 	movabs $0x80057a,%rcx
+  801e22:	00 00 00 
+  801e25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e27:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e2e:	eb b5                	jmp    801de5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e30:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e37:	eb ac                	jmp    801de5 <read+0x6a>
+
+0000000000801e39 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	41 56                	push   %r14
+  801e3f:	41 55                	push   %r13
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	48 83 ec 10          	sub    $0x10,%rsp
+  801e48:	89 fb                	mov    %edi,%ebx
+  801e4a:	49 89 f4             	mov    %rsi,%r12
+  801e4d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e50:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e54:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 41                	js     801ea5 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e64:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e68:	41 8b 3e             	mov    (%r14),%edi
+  801e6b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6f:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+  801e7b:	85 c0                	test   %eax,%eax
+  801e7d:	78 35                	js     801eb4 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e7f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e83:	83 e0 03             	and    $0x3,%eax
+  801e86:	83 f8 01             	cmp    $0x1,%eax
+  801e89:	74 2d                	je     801eb8 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e8b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e8f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e93:	48 85 c0             	test   %rax,%rax
+  801e96:	74 56                	je     801eee <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e98:	4c 89 ea             	mov    %r13,%rdx
+  801e9b:	4c 89 e6             	mov    %r12,%rsi
+  801e9e:	4c 89 f7             	mov    %r14,%rdi
+  801ea1:	ff d0                	call   *%rax
+  801ea3:	eb 02                	jmp    801ea7 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea5:	48 98                	cltq
+}
+  801ea7:	48 83 c4 10          	add    $0x10,%rsp
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	41 5d                	pop    %r13
+  801eb0:	41 5e                	pop    %r14
+  801eb2:	5d                   	pop    %rbp
+  801eb3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb4:	48 98                	cltq
+  801eb6:	eb ef                	jmp    801ea7 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eb8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ebf:	00 00 00 
+  801ec2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ec8:	89 da                	mov    %ebx,%edx
+  801eca:	48 bf 40 41 80 00 00 	movabs $0x804140,%rdi
+  801ed1:	00 00 00 
+  801ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed9:	48 b9 7a 05 80 00 00 	movabs $0x80057a,%rcx
+  801ee0:	00 00 00 
+  801ee3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ee5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801eec:	eb b9                	jmp    801ea7 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801eee:	4c 89 ea             	mov    %r13,%rdx
+  801ef1:	4c 89 e6             	mov    %r12,%rsi
+  801ef4:	89 df                	mov    %ebx,%edi
+  801ef6:	48 b8 7b 1d 80 00 00 	movabs $0x801d7b,%rax
+  801efd:	00 00 00 
+  801f00:	ff d0                	call   *%rax
+  801f02:	eb a3                	jmp    801ea7 <readmap+0x6e>
+
+0000000000801f04 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 57                	push   %r15
+  801f0a:	41 56                	push   %r14
+  801f0c:	41 55                	push   %r13
+  801f0e:	41 54                	push   %r12
+  801f10:	53                   	push   %rbx
+  801f11:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f15:	48 85 d2             	test   %rdx,%rdx
+  801f18:	74 54                	je     801f6e <readn+0x6a>
+  801f1a:	41 89 fd             	mov    %edi,%r13d
+  801f1d:	49 89 f6             	mov    %rsi,%r14
+  801f20:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f28:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f2d:	49 bf 7b 1d 80 00 00 	movabs $0x801d7b,%r15
+  801f34:	00 00 00 
+  801f37:	4c 89 e2             	mov    %r12,%rdx
+  801f3a:	48 29 f2             	sub    %rsi,%rdx
+  801f3d:	4c 01 f6             	add    %r14,%rsi
+  801f40:	44 89 ef             	mov    %r13d,%edi
+  801f43:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f46:	85 c0                	test   %eax,%eax
+  801f48:	78 20                	js     801f6a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f4a:	01 c3                	add    %eax,%ebx
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	74 08                	je     801f58 <readn+0x54>
+  801f50:	48 63 f3             	movslq %ebx,%rsi
+  801f53:	4c 39 e6             	cmp    %r12,%rsi
+  801f56:	72 df                	jb     801f37 <readn+0x33>
+    }
+    return res;
+  801f58:	48 63 c3             	movslq %ebx,%rax
+}
+  801f5b:	48 83 c4 08          	add    $0x8,%rsp
+  801f5f:	5b                   	pop    %rbx
+  801f60:	41 5c                	pop    %r12
+  801f62:	41 5d                	pop    %r13
+  801f64:	41 5e                	pop    %r14
+  801f66:	41 5f                	pop    %r15
+  801f68:	5d                   	pop    %rbp
+  801f69:	c3                   	ret
+        if (inc < 0) return inc;
+  801f6a:	48 98                	cltq
+  801f6c:	eb ed                	jmp    801f5b <readn+0x57>
+    int inc = 1, res = 0;
+  801f6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f73:	eb e3                	jmp    801f58 <readn+0x54>
+
+0000000000801f75 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f75:	55                   	push   %rbp
+  801f76:	48 89 e5             	mov    %rsp,%rbp
+  801f79:	41 56                	push   %r14
+  801f7b:	41 55                	push   %r13
+  801f7d:	41 54                	push   %r12
+  801f7f:	53                   	push   %rbx
+  801f80:	48 83 ec 10          	sub    $0x10,%rsp
+  801f84:	89 fb                	mov    %edi,%ebx
+  801f86:	49 89 f4             	mov    %rsi,%r12
+  801f89:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f8c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f90:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 47                	js     801fe7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fa0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fa4:	41 8b 3e             	mov    (%r14),%edi
+  801fa7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fab:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 30                	js     801feb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fbb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801fc0:	74 2d                	je     801fef <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fc6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fca:	48 85 c0             	test   %rax,%rax
+  801fcd:	74 56                	je     802025 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801fcf:	4c 89 ea             	mov    %r13,%rdx
+  801fd2:	4c 89 e6             	mov    %r12,%rsi
+  801fd5:	4c 89 f7             	mov    %r14,%rdi
+  801fd8:	ff d0                	call   *%rax
+}
+  801fda:	48 83 c4 10          	add    $0x10,%rsp
+  801fde:	5b                   	pop    %rbx
+  801fdf:	41 5c                	pop    %r12
+  801fe1:	41 5d                	pop    %r13
+  801fe3:	41 5e                	pop    %r14
+  801fe5:	5d                   	pop    %rbp
+  801fe6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe7:	48 98                	cltq
+  801fe9:	eb ef                	jmp    801fda <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801feb:	48 98                	cltq
+  801fed:	eb eb                	jmp    801fda <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fef:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ff6:	00 00 00 
+  801ff9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fff:	89 da                	mov    %ebx,%edx
+  802001:	48 bf 9d 41 80 00 00 	movabs $0x80419d,%rdi
+  802008:	00 00 00 
+  80200b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802010:	48 b9 7a 05 80 00 00 	movabs $0x80057a,%rcx
+  802017:	00 00 00 
+  80201a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80201c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802023:	eb b5                	jmp    801fda <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802025:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80202c:	eb ac                	jmp    801fda <write+0x65>
+
+000000000080202e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80202e:	55                   	push   %rbp
+  80202f:	48 89 e5             	mov    %rsp,%rbp
+  802032:	53                   	push   %rbx
+  802033:	48 83 ec 18          	sub    $0x18,%rsp
+  802037:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802039:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80203d:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  802044:	00 00 00 
+  802047:	ff d0                	call   *%rax
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	78 0c                	js     802059 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80204d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802051:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802059:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+000000000080205f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80205f:	55                   	push   %rbp
+  802060:	48 89 e5             	mov    %rsp,%rbp
+  802063:	41 55                	push   %r13
+  802065:	41 54                	push   %r12
+  802067:	53                   	push   %rbx
+  802068:	48 83 ec 18          	sub    $0x18,%rsp
+  80206c:	89 fb                	mov    %edi,%ebx
+  80206e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802071:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802075:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  80207c:	00 00 00 
+  80207f:	ff d0                	call   *%rax
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 38                	js     8020bd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802085:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802089:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80208d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802091:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 1c                	js     8020bd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020a1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020a6:	74 20                	je     8020c8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ac:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8020b0:	48 85 c0             	test   %rax,%rax
+  8020b3:	74 47                	je     8020fc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020b5:	44 89 e6             	mov    %r12d,%esi
+  8020b8:	4c 89 ef             	mov    %r13,%rdi
+  8020bb:	ff d0                	call   *%rax
+}
+  8020bd:	48 83 c4 18          	add    $0x18,%rsp
+  8020c1:	5b                   	pop    %rbx
+  8020c2:	41 5c                	pop    %r12
+  8020c4:	41 5d                	pop    %r13
+  8020c6:	5d                   	pop    %rbp
+  8020c7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020c8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8020cf:	00 00 00 
+  8020d2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020d8:	89 da                	mov    %ebx,%edx
+  8020da:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  8020e1:	00 00 00 
+  8020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e9:	48 b9 7a 05 80 00 00 	movabs $0x80057a,%rcx
+  8020f0:	00 00 00 
+  8020f3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020fa:	eb c1                	jmp    8020bd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020fc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802101:	eb ba                	jmp    8020bd <ftruncate+0x5e>
+
+0000000000802103 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	41 54                	push   %r12
+  802109:	53                   	push   %rbx
+  80210a:	48 83 ec 10          	sub    $0x10,%rsp
+  80210e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802111:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802115:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 4e                	js     802173 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802125:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802129:	41 8b 3c 24          	mov    (%r12),%edi
+  80212d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802131:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 32                	js     802173 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802141:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802145:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  80214a:	74 30                	je     80217c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80214c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80214f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802156:	00 00 00 
+    stat->st_isdir = 0;
+  802159:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802160:	00 00 00 
+    stat->st_dev = dev;
+  802163:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80216a:	48 89 de             	mov    %rbx,%rsi
+  80216d:	4c 89 e7             	mov    %r12,%rdi
+  802170:	ff 50 30             	call   *0x30(%rax)
+}
+  802173:	48 83 c4 10          	add    $0x10,%rsp
+  802177:	5b                   	pop    %rbx
+  802178:	41 5c                	pop    %r12
+  80217a:	5d                   	pop    %rbp
+  80217b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80217c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802181:	eb f0                	jmp    802173 <fstat+0x70>
+
+0000000000802183 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802183:	55                   	push   %rbp
+  802184:	48 89 e5             	mov    %rsp,%rbp
+  802187:	41 54                	push   %r12
+  802189:	53                   	push   %rbx
+  80218a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80218d:	be 00 00 00 00       	mov    $0x0,%esi
+  802192:	48 b8 da 2e 80 00 00 	movabs $0x802eda,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+  80219e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	78 25                	js     8021c9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021a4:	4c 89 e6             	mov    %r12,%rsi
+  8021a7:	89 c7                	mov    %eax,%edi
+  8021a9:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+  8021b5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021b8:	89 df                	mov    %ebx,%edi
+  8021ba:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  8021c1:	00 00 00 
+  8021c4:	ff d0                	call   *%rax
+
+    return res;
+  8021c6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021c9:	89 d8                	mov    %ebx,%eax
+  8021cb:	5b                   	pop    %rbx
+  8021cc:	41 5c                	pop    %r12
+  8021ce:	5d                   	pop    %rbp
+  8021cf:	c3                   	ret
+
+00000000008021d0 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	41 54                	push   %r12
+  8021d6:	53                   	push   %rbx
+  8021d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8021db:	48 89 fb             	mov    %rdi,%rbx
+  8021de:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021e1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021e5:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021ea:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  8021f1:	00 00 00 
+  8021f4:	ff d0                	call   *%rax
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 1f                	js     802219 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  8021fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021fe:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802202:	48 85 c0             	test   %rax,%rax
+  802205:	74 1b                	je     802222 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802207:	4c 89 e6             	mov    %r12,%rsi
+  80220a:	48 89 df             	mov    %rbx,%rdi
+  80220d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	ba 00 00 00 00       	mov    $0x0,%edx
+  802216:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802219:	48 83 c4 10          	add    $0x10,%rsp
+  80221d:	5b                   	pop    %rbx
+  80221e:	41 5c                	pop    %r12
+  802220:	5d                   	pop    %rbp
+  802221:	c3                   	ret
+        return -E_NOT_SUPP;
+  802222:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802227:	eb f0                	jmp    802219 <create_snapshot+0x49>
+
+0000000000802229 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802229:	55                   	push   %rbp
+  80222a:	48 89 e5             	mov    %rsp,%rbp
+  80222d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802231:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802235:	bf 66 00 00 00       	mov    $0x66,%edi
+  80223a:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 1e                	js     802268 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  80224a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80224e:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802252:	48 85 d2             	test   %rdx,%rdx
+  802255:	74 13                	je     80226a <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225c:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	ba 00 00 00 00       	mov    $0x0,%edx
+  802265:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+        return -E_NOT_SUPP;
+  80226a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80226f:	eb f7                	jmp    802268 <print_snapshot_list+0x3f>
+
+0000000000802271 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802271:	55                   	push   %rbp
+  802272:	48 89 e5             	mov    %rsp,%rbp
+  802275:	53                   	push   %rbx
+  802276:	48 83 ec 18          	sub    $0x18,%rsp
+  80227a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80227d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802281:	bf 66 00 00 00       	mov    $0x66,%edi
+  802286:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 1c                	js     8022b2 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802296:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80229a:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80229e:	48 85 c0             	test   %rax,%rax
+  8022a1:	74 15                	je     8022b8 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8022a3:	48 89 df             	mov    %rbx,%rdi
+  8022a6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022af:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022b8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022bd:	eb f3                	jmp    8022b2 <accept_snapshot+0x41>
+
+00000000008022bf <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8022bf:	55                   	push   %rbp
+  8022c0:	48 89 e5             	mov    %rsp,%rbp
+  8022c3:	53                   	push   %rbx
+  8022c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c8:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022cb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022cf:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022d4:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	85 c0                	test   %eax,%eax
+  8022e2:	78 1c                	js     802300 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8022e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022e8:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8022ec:	48 85 c0             	test   %rax,%rax
+  8022ef:	74 15                	je     802306 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8022f1:	48 89 df             	mov    %rbx,%rdi
+  8022f4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fd:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802300:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+        return -E_NOT_SUPP;
+  802306:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80230b:	eb f3                	jmp    802300 <delete_snapshot+0x41>
+
+000000000080230d <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80230d:	55                   	push   %rbp
+  80230e:	48 89 e5             	mov    %rsp,%rbp
+  802311:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802315:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802319:	bf 66 00 00 00       	mov    $0x66,%edi
+  80231e:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	78 14                	js     802342 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80232e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802332:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802336:	48 85 d2             	test   %rdx,%rdx
+  802339:	74 09                	je     802344 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80233b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802340:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+        return -E_NOT_SUPP;
+  802344:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802349:	eb f7                	jmp    802342 <gc_snapshots+0x35>
+
+000000000080234b <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80234b:	55                   	push   %rbp
+  80234c:	48 89 e5             	mov    %rsp,%rbp
+  80234f:	41 56                	push   %r14
+  802351:	41 55                	push   %r13
+  802353:	41 54                	push   %r12
+  802355:	53                   	push   %rbx
+  802356:	48 83 ec 10          	sub    $0x10,%rsp
+  80235a:	48 89 fb             	mov    %rdi,%rbx
+  80235d:	49 89 f4             	mov    %rsi,%r12
+  802360:	49 89 d5             	mov    %rdx,%r13
+  802363:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802366:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80236a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80236f:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 1b                	js     80239a <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80237f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802383:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802387:	48 85 c0             	test   %rax,%rax
+  80238a:	74 1b                	je     8023a7 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  80238c:	4c 89 f1             	mov    %r14,%rcx
+  80238f:	4c 89 ea             	mov    %r13,%rdx
+  802392:	4c 89 e6             	mov    %r12,%rsi
+  802395:	48 89 df             	mov    %rbx,%rdi
+  802398:	ff d0                	call   *%rax
+
+    return res;
+}
+  80239a:	48 83 c4 10          	add    $0x10,%rsp
+  80239e:	5b                   	pop    %rbx
+  80239f:	41 5c                	pop    %r12
+  8023a1:	41 5d                	pop    %r13
+  8023a3:	41 5e                	pop    %r14
+  8023a5:	5d                   	pop    %rbp
+  8023a6:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023ac:	eb ec                	jmp    80239a <diff_snapshots+0x4f>
+
+00000000008023ae <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8023ae:	55                   	push   %rbp
+  8023af:	48 89 e5             	mov    %rsp,%rbp
+  8023b2:	41 55                	push   %r13
+  8023b4:	41 54                	push   %r12
+  8023b6:	53                   	push   %rbx
+  8023b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bb:	48 89 fb             	mov    %rdi,%rbx
+  8023be:	49 89 f4             	mov    %rsi,%r12
+  8023c1:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023c4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023c8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023cd:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	78 18                	js     8023f5 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8023dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023e1:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8023e5:	48 85 c0             	test   %rax,%rax
+  8023e8:	74 16                	je     802400 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8023ea:	4c 89 ea             	mov    %r13,%rdx
+  8023ed:	4c 89 e6             	mov    %r12,%rsi
+  8023f0:	48 89 df             	mov    %rbx,%rdi
+  8023f3:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023f5:	48 83 c4 18          	add    $0x18,%rsp
+  8023f9:	5b                   	pop    %rbx
+  8023fa:	41 5c                	pop    %r12
+  8023fc:	41 5d                	pop    %r13
+  8023fe:	5d                   	pop    %rbp
+  8023ff:	c3                   	ret
+        return -E_NOT_SUPP;
+  802400:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802405:	eb ee                	jmp    8023f5 <send_snapshot+0x47>
+
+0000000000802407 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	53                   	push   %rbx
+  80240c:	48 83 ec 18          	sub    $0x18,%rsp
+  802410:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802413:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802417:	bf 66 00 00 00       	mov    $0x66,%edi
+  80241c:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 12                	js     80243e <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80242c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802430:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802434:	48 85 c0             	test   %rax,%rax
+  802437:	74 0b                	je     802444 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802439:	48 89 df             	mov    %rbx,%rdi
+  80243c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80243e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802442:	c9                   	leave
+  802443:	c3                   	ret
+        return -E_NOT_SUPP;
+  802444:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802449:	eb f3                	jmp    80243e <receive_snapshot+0x37>
+
+000000000080244b <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80244b:	55                   	push   %rbp
+  80244c:	48 89 e5             	mov    %rsp,%rbp
+  80244f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802453:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802457:	bf 66 00 00 00       	mov    $0x66,%edi
+  80245c:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 17                	js     802483 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80246c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802470:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802477:	48 85 d2             	test   %rdx,%rdx
+  80247a:	74 09                	je     802485 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80247c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802481:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802483:	c9                   	leave
+  802484:	c3                   	ret
+        return -E_NOT_SUPP;
+  802485:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80248a:	eb f7                	jmp    802483 <free_space_bytes+0x38>
+
+000000000080248c <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80248c:	55                   	push   %rbp
+  80248d:	48 89 e5             	mov    %rsp,%rbp
+  802490:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802494:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802498:	bf 66 00 00 00       	mov    $0x66,%edi
+  80249d:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	85 c0                	test   %eax,%eax
+  8024ab:	78 17                	js     8024c4 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8024ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b1:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8024b8:	48 85 d2             	test   %rdx,%rdx
+  8024bb:	74 09                	je     8024c6 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8024bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8024c4:	c9                   	leave
+  8024c5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024c6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024cb:	eb f7                	jmp    8024c4 <busy_space_bytes+0x38>
+
+00000000008024cd <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8024cd:	55                   	push   %rbp
+  8024ce:	48 89 e5             	mov    %rsp,%rbp
+  8024d1:	41 54                	push   %r12
+  8024d3:	53                   	push   %rbx
+  8024d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d8:	89 fb                	mov    %edi,%ebx
+  8024da:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024dd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024e1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024e6:	48 b8 e3 1a 80 00 00 	movabs $0x801ae3,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	78 17                	js     80250d <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8024f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024fa:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802501:	48 85 c0             	test   %rax,%rax
+  802504:	74 10                	je     802516 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802506:	4c 89 e6             	mov    %r12,%rsi
+  802509:	89 df                	mov    %ebx,%edi
+  80250b:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80250d:	48 83 c4 10          	add    $0x10,%rsp
+  802511:	5b                   	pop    %rbx
+  802512:	41 5c                	pop    %r12
+  802514:	5d                   	pop    %rbp
+  802515:	c3                   	ret
+        return -E_NOT_SUPP;
+  802516:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80251b:	eb f0                	jmp    80250d <snapshots_space+0x40>
+
+000000000080251d <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80251d:	55                   	push   %rbp
+  80251e:	48 89 e5             	mov    %rsp,%rbp
+  802521:	41 55                	push   %r13
+  802523:	41 54                	push   %r12
+  802525:	53                   	push   %rbx
+  802526:	48 83 ec 08          	sub    $0x8,%rsp
+  80252a:	41 89 fd             	mov    %edi,%r13d
+  80252d:	48 89 f3             	mov    %rsi,%rbx
+  802530:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802533:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80253a:	00 00 00 
+  80253d:	83 38 00             	cmpl   $0x0,(%rax)
+  802540:	74 57                	je     802599 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802542:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802548:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80254d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802554:	00 00 00 
+  802557:	44 89 ee             	mov    %r13d,%esi
+  80255a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802561:	00 00 00 
+  802564:	8b 38                	mov    (%rax),%edi
+  802566:	48 b8 9a 39 80 00 00 	movabs $0x80399a,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802577:	4c 89 e2             	mov    %r12,%rdx
+  80257a:	48 89 de             	mov    %rbx,%rsi
+  80257d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802582:	48 b8 82 39 80 00 00 	movabs $0x803982,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+}
+  80258e:	48 83 c4 08          	add    $0x8,%rsp
+  802592:	5b                   	pop    %rbx
+  802593:	41 5c                	pop    %r12
+  802595:	41 5d                	pop    %r13
+  802597:	5d                   	pop    %rbp
+  802598:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802599:	bf 03 00 00 00       	mov    $0x3,%edi
+  80259e:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  8025a5:	00 00 00 
+  8025a8:	ff d0                	call   *%rax
+  8025aa:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8025b1:	00 00 
+  8025b3:	eb 8d                	jmp    802542 <fsipc_region+0x25>
+
+00000000008025b5 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8025b5:	55                   	push   %rbp
+  8025b6:	48 89 e5             	mov    %rsp,%rbp
+  8025b9:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8025bd:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8025c4:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8025c5:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8025c9:	48 b8 1d 25 80 00 00 	movabs $0x80251d,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+}
+  8025d5:	c9                   	leave
+  8025d6:	c3                   	ret
+
+00000000008025d7 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8025d7:	85 ff                	test   %edi,%edi
+  8025d9:	78 6d                	js     802648 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8025db:	55                   	push   %rbp
+  8025dc:	48 89 e5             	mov    %rsp,%rbp
+  8025df:	41 54                	push   %r12
+  8025e1:	53                   	push   %rbx
+  8025e2:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8025e5:	48 85 f6             	test   %rsi,%rsi
+  8025e8:	74 57                	je     802641 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8025ea:	89 f8                	mov    %edi,%eax
+  8025ec:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8025f3:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8025f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025fa:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025ff:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802606:	00 00 00 
+  802609:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	78 2d                	js     80263c <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80260f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802616:	00 00 00 
+  802619:	49 63 14 24          	movslq (%r12),%rdx
+  80261d:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802624:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802629:	48 89 df             	mov    %rbx,%rdi
+  80262c:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802638:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80263c:	5b                   	pop    %rbx
+  80263d:	41 5c                	pop    %r12
+  80263f:	5d                   	pop    %rbp
+  802640:	c3                   	ret
+        return -E_INVAL;
+  802641:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802646:	eb f4                	jmp    80263c <devfile_df_snapshots+0x65>
+  802648:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80264d:	c3                   	ret
+
+000000000080264e <devfile_df_busy>:
+devfile_df_busy() {
+  80264e:	55                   	push   %rbp
+  80264f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802652:	be 00 00 00 00       	mov    $0x0,%esi
+  802657:	bf 11 00 00 00       	mov    $0x11,%edi
+  80265c:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+}
+  802668:	5d                   	pop    %rbp
+  802669:	c3                   	ret
+
+000000000080266a <devfile_df_free>:
+devfile_df_free() {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80266e:	be 00 00 00 00       	mov    $0x0,%esi
+  802673:	bf 10 00 00 00       	mov    $0x10,%edi
+  802678:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+}
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+
+0000000000802686 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80268a:	be 00 00 00 00       	mov    $0x0,%esi
+  80268f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802694:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+}
+  8026a0:	5d                   	pop    %rbp
+  8026a1:	c3                   	ret
+
+00000000008026a2 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8026a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ab:	bf 09 00 00 00       	mov    $0x9,%edi
+  8026b0:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026bc:	85 c0                	test   %eax,%eax
+  8026be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026c6:	5d                   	pop    %rbp
+  8026c7:	c3                   	ret
+
+00000000008026c8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8026c8:	55                   	push   %rbp
+  8026c9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8026cc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8026d3:	00 00 00 
+  8026d6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8026d9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8026db:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8026de:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8026e8:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+}
+  8026f4:	5d                   	pop    %rbp
+  8026f5:	c3                   	ret
+
+00000000008026f6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8026f6:	55                   	push   %rbp
+  8026f7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8026fa:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8026fd:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802704:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802706:	be 00 00 00 00       	mov    $0x0,%esi
+  80270b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802710:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+}
+  80271c:	5d                   	pop    %rbp
+  80271d:	c3                   	ret
+
+000000000080271e <devfile_write>:
+    if (!fd || !buf) {
+  80271e:	48 85 ff             	test   %rdi,%rdi
+  802721:	0f 84 c1 00 00 00    	je     8027e8 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802727:	55                   	push   %rbp
+  802728:	48 89 e5             	mov    %rsp,%rbp
+  80272b:	41 57                	push   %r15
+  80272d:	41 56                	push   %r14
+  80272f:	41 55                	push   %r13
+  802731:	41 54                	push   %r12
+  802733:	53                   	push   %rbx
+  802734:	48 83 ec 18          	sub    $0x18,%rsp
+  802738:	49 89 ff             	mov    %rdi,%r15
+  80273b:	49 89 f5             	mov    %rsi,%r13
+  80273e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802741:	48 85 f6             	test   %rsi,%rsi
+  802744:	0f 84 95 00 00 00    	je     8027df <devfile_write+0xc1>
+    while (n) {
+  80274a:	48 85 d2             	test   %rdx,%rdx
+  80274d:	0f 84 83 00 00 00    	je     8027d6 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802753:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80275a:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802761:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802764:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802769:	49 39 dc             	cmp    %rbx,%r12
+  80276c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802770:	48 89 da             	mov    %rbx,%rdx
+  802773:	4c 89 ee             	mov    %r13,%rsi
+  802776:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80277d:	00 00 00 
+  802780:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80278c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802790:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802793:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802797:	be 00 00 00 00       	mov    $0x0,%esi
+  80279c:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027a1:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8027a8:	00 00 00 
+  8027ab:	ff d0                	call   *%rax
+        if (write < 0) {
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 21                	js     8027d2 <devfile_write+0xb4>
+        buf += write;
+  8027b1:	48 63 d0             	movslq %eax,%rdx
+  8027b4:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8027b7:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8027ba:	49 29 d4             	sub    %rdx,%r12
+  8027bd:	75 a5                	jne    802764 <devfile_write+0x46>
+    return totalWrite;
+  8027bf:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8027c3:	48 83 c4 18          	add    $0x18,%rsp
+  8027c7:	5b                   	pop    %rbx
+  8027c8:	41 5c                	pop    %r12
+  8027ca:	41 5d                	pop    %r13
+  8027cc:	41 5e                	pop    %r14
+  8027ce:	41 5f                	pop    %r15
+  8027d0:	5d                   	pop    %rbp
+  8027d1:	c3                   	ret
+            return write;
+  8027d2:	48 98                	cltq
+  8027d4:	eb ed                	jmp    8027c3 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8027d6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8027dd:	eb e0                	jmp    8027bf <devfile_write+0xa1>
+        return -E_INVAL;
+  8027df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027e6:	eb db                	jmp    8027c3 <devfile_write+0xa5>
+  8027e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8027ef:	c3                   	ret
+
+00000000008027f0 <devfile_read>:
+    if (!fd || !buf) {
+  8027f0:	48 85 ff             	test   %rdi,%rdi
+  8027f3:	0f 84 c0 00 00 00    	je     8028b9 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	41 57                	push   %r15
+  8027ff:	41 56                	push   %r14
+  802801:	41 55                	push   %r13
+  802803:	41 54                	push   %r12
+  802805:	53                   	push   %rbx
+  802806:	48 83 ec 18          	sub    $0x18,%rsp
+  80280a:	49 89 ff             	mov    %rdi,%r15
+  80280d:	49 89 f5             	mov    %rsi,%r13
+  802810:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802813:	48 85 f6             	test   %rsi,%rsi
+  802816:	0f 84 96 00 00 00    	je     8028b2 <devfile_read+0xc2>
+    while (n) {
+  80281c:	48 85 d2             	test   %rdx,%rdx
+  80281f:	0f 84 87 00 00 00    	je     8028ac <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802825:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80282c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80282d:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802834:	00 00 00 
+  802837:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80283b:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80283e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802843:	49 39 c4             	cmp    %rax,%r12
+  802846:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80284a:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80284e:	be 00 00 00 00       	mov    $0x0,%esi
+  802853:	bf 03 00 00 00       	mov    $0x3,%edi
+  802858:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802864:	85 c0                	test   %eax,%eax
+  802866:	7e 37                	jle    80289f <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802868:	48 63 d8             	movslq %eax,%rbx
+  80286b:	48 89 da             	mov    %rbx,%rdx
+  80286e:	4c 89 f6             	mov    %r14,%rsi
+  802871:	4c 89 ef             	mov    %r13,%rdi
+  802874:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+        buf += read;
+  802880:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802883:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802887:	49 29 dc             	sub    %rbx,%r12
+  80288a:	75 ab                	jne    802837 <devfile_read+0x47>
+  return totalRead;
+  80288c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802890:	48 83 c4 18          	add    $0x18,%rsp
+  802894:	5b                   	pop    %rbx
+  802895:	41 5c                	pop    %r12
+  802897:	41 5d                	pop    %r13
+  802899:	41 5e                	pop    %r14
+  80289b:	41 5f                	pop    %r15
+  80289d:	5d                   	pop    %rbp
+  80289e:	c3                   	ret
+            return read ? read : totalRead;
+  80289f:	48 63 d0             	movslq %eax,%rdx
+  8028a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8028aa:	eb e4                	jmp    802890 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8028ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028b0:	eb da                	jmp    80288c <devfile_read+0x9c>
+        return E_INVAL;
+  8028b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028b7:	eb d7                	jmp    802890 <devfile_read+0xa0>
+  8028b9:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8028be:	c3                   	ret
+
+00000000008028bf <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8028bf:	48 85 ff             	test   %rdi,%rdi
+  8028c2:	74 5f                	je     802923 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	53                   	push   %rbx
+  8028c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cd:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8028d0:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+  8028dc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028e2:	77 45                	ja     802929 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8028e4:	48 89 de             	mov    %rbx,%rsi
+  8028e7:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8028ee:	00 00 00 
+  8028f1:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8028fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802902:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802907:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80290e:	00 00 00 
+  802911:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802913:	85 c0                	test   %eax,%eax
+  802915:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80291d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+        return -E_INVAL;
+  802923:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802928:	c3                   	ret
+        return -E_INVAL;
+  802929:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80292e:	eb ed                	jmp    80291d <devfile_receive_snapshot+0x5e>
+
+0000000000802930 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802930:	55                   	push   %rbp
+  802931:	48 89 e5             	mov    %rsp,%rbp
+  802934:	41 55                	push   %r13
+  802936:	41 54                	push   %r12
+  802938:	53                   	push   %rbx
+  802939:	48 83 ec 08          	sub    $0x8,%rsp
+  80293d:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802940:	48 85 f6             	test   %rsi,%rsi
+  802943:	0f 94 c0             	sete   %al
+  802946:	48 85 d2             	test   %rdx,%rdx
+  802949:	0f 94 c2             	sete   %dl
+  80294c:	08 d0                	or     %dl,%al
+  80294e:	0f 85 ad 00 00 00    	jne    802a01 <devfile_send_snapshot+0xd1>
+  802954:	48 89 fb             	mov    %rdi,%rbx
+  802957:	49 89 f4             	mov    %rsi,%r12
+  80295a:	48 85 ff             	test   %rdi,%rdi
+  80295d:	0f 84 9e 00 00 00    	je     802a01 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802963:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  80296a:	00 00 00 
+  80296d:	ff d0                	call   *%rax
+  80296f:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802975:	0f 87 8d 00 00 00    	ja     802a08 <devfile_send_snapshot+0xd8>
+  80297b:	4c 89 e7             	mov    %r12,%rdi
+  80297e:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+  80298a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802990:	77 7d                	ja     802a0f <devfile_send_snapshot+0xdf>
+  802992:	4c 89 ef             	mov    %r13,%rdi
+  802995:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+  8029a1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029a7:	77 6d                	ja     802a16 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8029a9:	48 89 de             	mov    %rbx,%rsi
+  8029ac:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8029b3:	00 00 00 
+  8029b6:	48 bb 9f 0e 80 00 00 	movabs $0x800e9f,%rbx
+  8029bd:	00 00 00 
+  8029c0:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8029c2:	4c 89 e6             	mov    %r12,%rsi
+  8029c5:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8029cc:	00 00 00 
+  8029cf:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8029d1:	4c 89 ee             	mov    %r13,%rsi
+  8029d4:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8029db:	00 00 00 
+  8029de:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8029e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8029ea:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8029f1:	00 00 00 
+  8029f4:	ff d0                	call   *%rax
+}
+  8029f6:	48 83 c4 08          	add    $0x8,%rsp
+  8029fa:	5b                   	pop    %rbx
+  8029fb:	41 5c                	pop    %r12
+  8029fd:	41 5d                	pop    %r13
+  8029ff:	5d                   	pop    %rbp
+  802a00:	c3                   	ret
+        return -E_INVAL;
+  802a01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a06:	eb ee                	jmp    8029f6 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802a08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a0d:	eb e7                	jmp    8029f6 <devfile_send_snapshot+0xc6>
+  802a0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a14:	eb e0                	jmp    8029f6 <devfile_send_snapshot+0xc6>
+  802a16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a1b:	eb d9                	jmp    8029f6 <devfile_send_snapshot+0xc6>
+
+0000000000802a1d <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802a1d:	48 85 ff             	test   %rdi,%rdi
+  802a20:	0f 84 41 01 00 00    	je     802b67 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802a26:	55                   	push   %rbp
+  802a27:	48 89 e5             	mov    %rsp,%rbp
+  802a2a:	41 57                	push   %r15
+  802a2c:	41 56                	push   %r14
+  802a2e:	41 55                	push   %r13
+  802a30:	41 54                	push   %r12
+  802a32:	53                   	push   %rbx
+  802a33:	48 83 ec 08          	sub    $0x8,%rsp
+  802a37:	49 89 fc             	mov    %rdi,%r12
+  802a3a:	49 89 f5             	mov    %rsi,%r13
+  802a3d:	48 89 d3             	mov    %rdx,%rbx
+  802a40:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802a43:	48 85 f6             	test   %rsi,%rsi
+  802a46:	0f 84 ff 00 00 00    	je     802b4b <devfile_diff_snapshots+0x12e>
+  802a4c:	48 85 d2             	test   %rdx,%rdx
+  802a4f:	0f 84 fd 00 00 00    	je     802b52 <devfile_diff_snapshots+0x135>
+  802a55:	48 85 c9             	test   %rcx,%rcx
+  802a58:	0f 84 f4 00 00 00    	je     802b52 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802a5e:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+  802a6a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a70:	0f 87 e3 00 00 00    	ja     802b59 <devfile_diff_snapshots+0x13c>
+  802a76:	4c 89 ef             	mov    %r13,%rdi
+  802a79:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+  802a85:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a8b:	0f 87 cf 00 00 00    	ja     802b60 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a91:	4c 89 e6             	mov    %r12,%rsi
+  802a94:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a9b:	00 00 00 
+  802a9e:	4c 89 e7             	mov    %r12,%rdi
+  802aa1:	49 bf 9f 0e 80 00 00 	movabs $0x800e9f,%r15
+  802aa8:	00 00 00 
+  802aab:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802aae:	4c 89 ee             	mov    %r13,%rsi
+  802ab1:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802ab8:	00 
+  802ab9:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802abc:	48 8b 03             	mov    (%rbx),%rax
+  802abf:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802ac6:	00 
+  802ac7:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802acb:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802ad2:	00 
+  802ad3:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802ad7:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802ade:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802adf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802ae9:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	78 43                	js     802b3c <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802af9:	49 8b 04 24          	mov    (%r12),%rax
+  802afd:	48 89 03             	mov    %rax,(%rbx)
+  802b00:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802b05:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802b09:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802b0e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802b12:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802b17:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802b1b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802b1f:	48 c1 e2 03          	shl    $0x3,%rdx
+  802b23:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802b28:	4c 89 f7             	mov    %r14,%rdi
+  802b2b:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802b37:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802b3c:	48 83 c4 08          	add    $0x8,%rsp
+  802b40:	5b                   	pop    %rbx
+  802b41:	41 5c                	pop    %r12
+  802b43:	41 5d                	pop    %r13
+  802b45:	41 5e                	pop    %r14
+  802b47:	41 5f                	pop    %r15
+  802b49:	5d                   	pop    %rbp
+  802b4a:	c3                   	ret
+        return -E_INVAL;
+  802b4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b50:	eb ea                	jmp    802b3c <devfile_diff_snapshots+0x11f>
+  802b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b57:	eb e3                	jmp    802b3c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b5e:	eb dc                	jmp    802b3c <devfile_diff_snapshots+0x11f>
+  802b60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b65:	eb d5                	jmp    802b3c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b6c:	c3                   	ret
+
+0000000000802b6d <devfile_delete_snapshot>:
+    if (!name) {
+  802b6d:	48 85 ff             	test   %rdi,%rdi
+  802b70:	74 5f                	je     802bd1 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802b72:	55                   	push   %rbp
+  802b73:	48 89 e5             	mov    %rsp,%rbp
+  802b76:	53                   	push   %rbx
+  802b77:	48 83 ec 08          	sub    $0x8,%rsp
+  802b7b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b7e:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802b85:	00 00 00 
+  802b88:	ff d0                	call   *%rax
+  802b8a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b90:	77 45                	ja     802bd7 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b92:	48 89 de             	mov    %rbx,%rsi
+  802b95:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b9c:	00 00 00 
+  802b9f:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802bab:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802bb5:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bcf:	c9                   	leave
+  802bd0:	c3                   	ret
+        return -E_INVAL;
+  802bd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bd6:	c3                   	ret
+        return -E_INVAL;
+  802bd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bdc:	eb ed                	jmp    802bcb <devfile_delete_snapshot+0x5e>
+
+0000000000802bde <devfile_accept_snapshot>:
+    if (!name) {
+  802bde:	48 85 ff             	test   %rdi,%rdi
+  802be1:	74 5f                	je     802c42 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802be3:	55                   	push   %rbp
+  802be4:	48 89 e5             	mov    %rsp,%rbp
+  802be7:	53                   	push   %rbx
+  802be8:	48 83 ec 08          	sub    $0x8,%rsp
+  802bec:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802bef:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+  802bfb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c01:	77 45                	ja     802c48 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802c03:	48 89 de             	mov    %rbx,%rsi
+  802c06:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c0d:	00 00 00 
+  802c10:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802c1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c21:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c26:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802c2d:	00 00 00 
+  802c30:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c32:	85 c0                	test   %eax,%eax
+  802c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c39:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+        return -E_INVAL;
+  802c42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c47:	c3                   	ret
+        return -E_INVAL;
+  802c48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c4d:	eb ed                	jmp    802c3c <devfile_accept_snapshot+0x5e>
+
+0000000000802c4f <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802c4f:	48 85 ff             	test   %rdi,%rdi
+  802c52:	0f 84 9f 00 00 00    	je     802cf7 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802c58:	55                   	push   %rbp
+  802c59:	48 89 e5             	mov    %rsp,%rbp
+  802c5c:	41 54                	push   %r12
+  802c5e:	53                   	push   %rbx
+  802c5f:	48 89 fb             	mov    %rdi,%rbx
+  802c62:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802c65:	48 85 f6             	test   %rsi,%rsi
+  802c68:	74 78                	je     802ce2 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802c6a:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+  802c76:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c7c:	77 6b                	ja     802ce9 <devfile_create_snapshot+0x9a>
+  802c7e:	4c 89 e7             	mov    %r12,%rdi
+  802c81:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+  802c8d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c93:	77 5b                	ja     802cf0 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c95:	48 89 de             	mov    %rbx,%rsi
+  802c98:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c9f:	00 00 00 
+  802ca2:	48 bb 9f 0e 80 00 00 	movabs $0x800e9f,%rbx
+  802ca9:	00 00 00 
+  802cac:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802cae:	4c 89 e6             	mov    %r12,%rsi
+  802cb1:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802cb8:	00 00 00 
+  802cbb:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc2:	bf 08 00 00 00       	mov    $0x8,%edi
+  802cc7:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cd3:	85 c0                	test   %eax,%eax
+  802cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cda:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802cdd:	5b                   	pop    %rbx
+  802cde:	41 5c                	pop    %r12
+  802ce0:	5d                   	pop    %rbp
+  802ce1:	c3                   	ret
+        return -E_INVAL;
+  802ce2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ce7:	eb f4                	jmp    802cdd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802ce9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cee:	eb ed                	jmp    802cdd <devfile_create_snapshot+0x8e>
+  802cf0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cf5:	eb e6                	jmp    802cdd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802cf7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cfc:	c3                   	ret
+
+0000000000802cfd <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802cfd:	55                   	push   %rbp
+  802cfe:	48 89 e5             	mov    %rsp,%rbp
+  802d01:	41 54                	push   %r12
+  802d03:	53                   	push   %rbx
+  802d04:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d07:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d0a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d11:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d13:	be 00 00 00 00       	mov    $0x0,%esi
+  802d18:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d1d:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d29:	85 c0                	test   %eax,%eax
+  802d2b:	78 3d                	js     802d6a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d2d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802d34:	00 00 00 
+  802d37:	4c 89 e6             	mov    %r12,%rsi
+  802d3a:	48 89 df             	mov    %rbx,%rdi
+  802d3d:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  802d44:	00 00 00 
+  802d47:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d49:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802d50:	00 
+  802d51:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d57:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802d5e:	00 
+  802d5f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802d65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d6a:	5b                   	pop    %rbx
+  802d6b:	41 5c                	pop    %r12
+  802d6d:	5d                   	pop    %rbp
+  802d6e:	c3                   	ret
+
+0000000000802d6f <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802d6f:	55                   	push   %rbp
+  802d70:	48 89 e5             	mov    %rsp,%rbp
+  802d73:	41 57                	push   %r15
+  802d75:	41 56                	push   %r14
+  802d77:	41 55                	push   %r13
+  802d79:	41 54                	push   %r12
+  802d7b:	53                   	push   %rbx
+  802d7c:	48 83 ec 38          	sub    $0x38,%rsp
+  802d80:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802d84:	49 89 f5             	mov    %rsi,%r13
+  802d87:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d8a:	48 89 f0             	mov    %rsi,%rax
+  802d8d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d92:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d96:	75 4f                	jne    802de7 <devfile_readmap+0x78>
+  802d98:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d9c:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802da2:	75 1f                	jne    802dc3 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802da4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802da8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802dac:	49 be 57 35 80 00 00 	movabs $0x803557,%r14
+  802db3:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802db6:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802dbd:	0f 87 9d 00 00 00    	ja     802e60 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802dc3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802dc7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802dcb:	4d 85 ff             	test   %r15,%r15
+  802dce:	0f 85 cf 00 00 00    	jne    802ea3 <devfile_readmap+0x134>
+  802dd4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802dd8:	48 83 c4 38          	add    $0x38,%rsp
+  802ddc:	5b                   	pop    %rbx
+  802ddd:	41 5c                	pop    %r12
+  802ddf:	41 5d                	pop    %r13
+  802de1:	41 5e                	pop    %r14
+  802de3:	41 5f                	pop    %r15
+  802de5:	5d                   	pop    %rbp
+  802de6:	c3                   	ret
+    size_t totalRead = 0;
+  802de7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802dee:	00 
+  802def:	eb da                	jmp    802dcb <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802df1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802df5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802df8:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802dff:	00 00 00 
+  802e02:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802e04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e08:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802e0c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e10:	4c 89 ee             	mov    %r13,%rsi
+  802e13:	bf 14 00 00 00       	mov    $0x14,%edi
+  802e18:	48 b8 1d 25 80 00 00 	movabs $0x80251d,%rax
+  802e1f:	00 00 00 
+  802e22:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	7e a3                	jle    802dcb <devfile_readmap+0x5c>
+  802e28:	48 98                	cltq
+  802e2a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802e2e:	72 9b                	jb     802dcb <devfile_readmap+0x5c>
+        buf += read;
+  802e30:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802e33:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802e36:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e3a:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802e41:	75 88                	jne    802dcb <devfile_readmap+0x5c>
+  802e43:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e47:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e4d:	0f 85 78 ff ff ff    	jne    802dcb <devfile_readmap+0x5c>
+  802e53:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802e5a:	0f 86 6b ff ff ff    	jbe    802dcb <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802e60:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802e66:	4d 39 e7             	cmp    %r12,%r15
+  802e69:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802e6d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802e74:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e78:	0f 84 73 ff ff ff    	je     802df1 <devfile_readmap+0x82>
+  802e7e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e82:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802e87:	41 ff d6             	call   *%r14
+  802e8a:	a8 40                	test   $0x40,%al
+  802e8c:	0f 85 39 ff ff ff    	jne    802dcb <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e92:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e99:	4c 39 e3             	cmp    %r12,%rbx
+  802e9c:	72 e4                	jb     802e82 <devfile_readmap+0x113>
+  802e9e:	e9 4e ff ff ff       	jmp    802df1 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ea3:	4c 89 fa             	mov    %r15,%rdx
+  802ea6:	4c 89 ee             	mov    %r13,%rsi
+  802ea9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ead:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802eb9:	48 85 c0             	test   %rax,%rax
+  802ebc:	78 0c                	js     802eca <devfile_readmap+0x15b>
+    return totalRead + read;
+  802ebe:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ec2:	48 01 f0             	add    %rsi,%rax
+  802ec5:	e9 0e ff ff ff       	jmp    802dd8 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802eca:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ece:	48 85 f6             	test   %rsi,%rsi
+  802ed1:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ed5:	e9 fe fe ff ff       	jmp    802dd8 <devfile_readmap+0x69>
+
+0000000000802eda <open>:
+open(const char *path, int mode) {
+  802eda:	55                   	push   %rbp
+  802edb:	48 89 e5             	mov    %rsp,%rbp
+  802ede:	41 55                	push   %r13
+  802ee0:	41 54                	push   %r12
+  802ee2:	53                   	push   %rbx
+  802ee3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ee7:	49 89 fc             	mov    %rdi,%r12
+  802eea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802eed:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+  802ef9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802eff:	0f 87 8a 00 00 00    	ja     802f8f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f09:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+  802f15:	89 c3                	mov    %eax,%ebx
+  802f17:	85 c0                	test   %eax,%eax
+  802f19:	78 50                	js     802f6b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f1b:	4c 89 e6             	mov    %r12,%rsi
+  802f1e:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802f25:	00 00 00 
+  802f28:	48 89 df             	mov    %rbx,%rdi
+  802f2b:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f3e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f42:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f47:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	89 c3                	mov    %eax,%ebx
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	78 1f                	js     802f78 <open+0x9e>
+    return fd2num(fd);
+  802f59:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f5d:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  802f64:	00 00 00 
+  802f67:	ff d0                	call   *%rax
+  802f69:	89 c3                	mov    %eax,%ebx
+}
+  802f6b:	89 d8                	mov    %ebx,%eax
+  802f6d:	48 83 c4 18          	add    $0x18,%rsp
+  802f71:	5b                   	pop    %rbx
+  802f72:	41 5c                	pop    %r12
+  802f74:	41 5d                	pop    %r13
+  802f76:	5d                   	pop    %rbp
+  802f77:	c3                   	ret
+        fd_close(fd, 0);
+  802f78:	be 00 00 00 00       	mov    $0x0,%esi
+  802f7d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f81:	48 b8 53 1b 80 00 00 	movabs $0x801b53,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+        return res;
+  802f8d:	eb dc                	jmp    802f6b <open+0x91>
+        return -E_BAD_PATH;
+  802f8f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f94:	eb d5                	jmp    802f6b <open+0x91>
+
+0000000000802f96 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f96:	55                   	push   %rbp
+  802f97:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f9a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f9f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802fa4:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+}
+  802fb0:	5d                   	pop    %rbp
+  802fb1:	c3                   	ret
+
+0000000000802fb2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+  802fb6:	41 54                	push   %r12
+  802fb8:	53                   	push   %rbx
+  802fb9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fbc:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802fc3:	00 00 00 
+  802fc6:	ff d0                	call   *%rax
+  802fc8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802fcb:	48 be e0 41 80 00 00 	movabs $0x8041e0,%rsi
+  802fd2:	00 00 00 
+  802fd5:	48 89 df             	mov    %rbx,%rdi
+  802fd8:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802fe4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802fe9:	41 2b 04 24          	sub    (%r12),%eax
+  802fed:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ff3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ffa:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ffd:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803004:	00 00 00 
+  803007:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80300e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803013:	5b                   	pop    %rbx
+  803014:	41 5c                	pop    %r12
+  803016:	5d                   	pop    %rbp
+  803017:	c3                   	ret
+
+0000000000803018 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803018:	55                   	push   %rbp
+  803019:	48 89 e5             	mov    %rsp,%rbp
+  80301c:	41 54                	push   %r12
+  80301e:	53                   	push   %rbx
+  80301f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803022:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803027:	48 89 fe             	mov    %rdi,%rsi
+  80302a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80302f:	49 bc f7 15 80 00 00 	movabs $0x8015f7,%r12
+  803036:	00 00 00 
+  803039:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80303c:	48 89 df             	mov    %rbx,%rdi
+  80303f:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+  80304b:	48 89 c6             	mov    %rax,%rsi
+  80304e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803053:	bf 00 00 00 00       	mov    $0x0,%edi
+  803058:	41 ff d4             	call   *%r12
+}
+  80305b:	5b                   	pop    %rbx
+  80305c:	41 5c                	pop    %r12
+  80305e:	5d                   	pop    %rbp
+  80305f:	c3                   	ret
+
+0000000000803060 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803060:	55                   	push   %rbp
+  803061:	48 89 e5             	mov    %rsp,%rbp
+  803064:	41 57                	push   %r15
+  803066:	41 56                	push   %r14
+  803068:	41 55                	push   %r13
+  80306a:	41 54                	push   %r12
+  80306c:	53                   	push   %rbx
+  80306d:	48 83 ec 18          	sub    $0x18,%rsp
+  803071:	49 89 fc             	mov    %rdi,%r12
+  803074:	49 89 f5             	mov    %rsi,%r13
+  803077:	49 89 d7             	mov    %rdx,%r15
+  80307a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80307e:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  803085:	00 00 00 
+  803088:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80308a:	4d 85 ff             	test   %r15,%r15
+  80308d:	0f 84 af 00 00 00    	je     803142 <devpipe_write+0xe2>
+  803093:	48 89 c3             	mov    %rax,%rbx
+  803096:	4c 89 f8             	mov    %r15,%rax
+  803099:	4d 89 ef             	mov    %r13,%r15
+  80309c:	4c 01 e8             	add    %r13,%rax
+  80309f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030a3:	49 bd ff 14 80 00 00 	movabs $0x8014ff,%r13
+  8030aa:	00 00 00 
+            sys_yield();
+  8030ad:	49 be 9c 14 80 00 00 	movabs $0x80149c,%r14
+  8030b4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8030b7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030ba:	48 63 ce             	movslq %esi,%rcx
+  8030bd:	48 63 03             	movslq (%rbx),%rax
+  8030c0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8030c6:	48 39 c1             	cmp    %rax,%rcx
+  8030c9:	72 2e                	jb     8030f9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030cb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030d0:	48 89 da             	mov    %rbx,%rdx
+  8030d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030d8:	4c 89 e7             	mov    %r12,%rdi
+  8030db:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8030de:	85 c0                	test   %eax,%eax
+  8030e0:	74 66                	je     803148 <devpipe_write+0xe8>
+            sys_yield();
+  8030e2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8030e5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030e8:	48 63 ce             	movslq %esi,%rcx
+  8030eb:	48 63 03             	movslq (%rbx),%rax
+  8030ee:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8030f4:	48 39 c1             	cmp    %rax,%rcx
+  8030f7:	73 d2                	jae    8030cb <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030f9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8030fd:	48 89 ca             	mov    %rcx,%rdx
+  803100:	48 c1 ea 03          	shr    $0x3,%rdx
+  803104:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80310b:	08 10 20 
+  80310e:	48 f7 e2             	mul    %rdx
+  803111:	48 c1 ea 06          	shr    $0x6,%rdx
+  803115:	48 89 d0             	mov    %rdx,%rax
+  803118:	48 c1 e0 09          	shl    $0x9,%rax
+  80311c:	48 29 d0             	sub    %rdx,%rax
+  80311f:	48 c1 e0 03          	shl    $0x3,%rax
+  803123:	48 29 c1             	sub    %rax,%rcx
+  803126:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80312b:	83 c6 01             	add    $0x1,%esi
+  80312e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803131:	49 83 c7 01          	add    $0x1,%r15
+  803135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803139:	49 39 c7             	cmp    %rax,%r15
+  80313c:	0f 85 75 ff ff ff    	jne    8030b7 <devpipe_write+0x57>
+    return n;
+  803142:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803146:	eb 05                	jmp    80314d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80314d:	48 83 c4 18          	add    $0x18,%rsp
+  803151:	5b                   	pop    %rbx
+  803152:	41 5c                	pop    %r12
+  803154:	41 5d                	pop    %r13
+  803156:	41 5e                	pop    %r14
+  803158:	41 5f                	pop    %r15
+  80315a:	5d                   	pop    %rbp
+  80315b:	c3                   	ret
+
+000000000080315c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80315c:	55                   	push   %rbp
+  80315d:	48 89 e5             	mov    %rsp,%rbp
+  803160:	41 57                	push   %r15
+  803162:	41 56                	push   %r14
+  803164:	41 55                	push   %r13
+  803166:	41 54                	push   %r12
+  803168:	53                   	push   %rbx
+  803169:	48 83 ec 18          	sub    $0x18,%rsp
+  80316d:	49 89 fc             	mov    %rdi,%r12
+  803170:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803174:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803178:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  80317f:	00 00 00 
+  803182:	ff d0                	call   *%rax
+  803184:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803187:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80318d:	49 bd ff 14 80 00 00 	movabs $0x8014ff,%r13
+  803194:	00 00 00 
+            sys_yield();
+  803197:	49 be 9c 14 80 00 00 	movabs $0x80149c,%r14
+  80319e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8031a1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031a6:	74 7d                	je     803225 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8031a8:	8b 03                	mov    (%rbx),%eax
+  8031aa:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8031ad:	75 26                	jne    8031d5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8031af:	4d 85 ff             	test   %r15,%r15
+  8031b2:	75 77                	jne    80322b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031b4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031b9:	48 89 da             	mov    %rbx,%rdx
+  8031bc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031c1:	4c 89 e7             	mov    %r12,%rdi
+  8031c4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	74 72                	je     80323d <devpipe_read+0xe1>
+            sys_yield();
+  8031cb:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8031ce:	8b 03                	mov    (%rbx),%eax
+  8031d0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8031d3:	74 df                	je     8031b4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031d5:	48 63 c8             	movslq %eax,%rcx
+  8031d8:	48 89 ca             	mov    %rcx,%rdx
+  8031db:	48 c1 ea 03          	shr    $0x3,%rdx
+  8031df:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8031e6:	08 10 20 
+  8031e9:	48 89 d0             	mov    %rdx,%rax
+  8031ec:	48 f7 e6             	mul    %rsi
+  8031ef:	48 c1 ea 06          	shr    $0x6,%rdx
+  8031f3:	48 89 d0             	mov    %rdx,%rax
+  8031f6:	48 c1 e0 09          	shl    $0x9,%rax
+  8031fa:	48 29 d0             	sub    %rdx,%rax
+  8031fd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803204:	00 
+  803205:	48 89 c8             	mov    %rcx,%rax
+  803208:	48 29 d0             	sub    %rdx,%rax
+  80320b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803210:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803214:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803218:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80321b:	49 83 c7 01          	add    $0x1,%r15
+  80321f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803223:	75 83                	jne    8031a8 <devpipe_read+0x4c>
+    return n;
+  803225:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803229:	eb 03                	jmp    80322e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80322b:	4c 89 f8             	mov    %r15,%rax
+}
+  80322e:	48 83 c4 18          	add    $0x18,%rsp
+  803232:	5b                   	pop    %rbx
+  803233:	41 5c                	pop    %r12
+  803235:	41 5d                	pop    %r13
+  803237:	41 5e                	pop    %r14
+  803239:	41 5f                	pop    %r15
+  80323b:	5d                   	pop    %rbp
+  80323c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80323d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803242:	eb ea                	jmp    80322e <devpipe_read+0xd2>
+
+0000000000803244 <pipe>:
+pipe(int pfd[2]) {
+  803244:	55                   	push   %rbp
+  803245:	48 89 e5             	mov    %rsp,%rbp
+  803248:	41 55                	push   %r13
+  80324a:	41 54                	push   %r12
+  80324c:	53                   	push   %rbx
+  80324d:	48 83 ec 18          	sub    $0x18,%rsp
+  803251:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803254:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803258:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  80325f:	00 00 00 
+  803262:	ff d0                	call   *%rax
+  803264:	89 c3                	mov    %eax,%ebx
+  803266:	85 c0                	test   %eax,%eax
+  803268:	0f 88 a0 01 00 00    	js     80340e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80326e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803273:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803278:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80327c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803281:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  803288:	00 00 00 
+  80328b:	ff d0                	call   *%rax
+  80328d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80328f:	85 c0                	test   %eax,%eax
+  803291:	0f 88 77 01 00 00    	js     80340e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803297:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80329b:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  8032a2:	00 00 00 
+  8032a5:	ff d0                	call   *%rax
+  8032a7:	89 c3                	mov    %eax,%ebx
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	0f 88 43 01 00 00    	js     8033f4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8032b1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032bb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8032bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c4:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  8032cb:	00 00 00 
+  8032ce:	ff d0                	call   *%rax
+  8032d0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8032d2:	85 c0                	test   %eax,%eax
+  8032d4:	0f 88 1a 01 00 00    	js     8033f4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8032da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032de:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  8032e5:	00 00 00 
+  8032e8:	ff d0                	call   *%rax
+  8032ea:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8032ed:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8032f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032f7:	48 89 c6             	mov    %rax,%rsi
+  8032fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ff:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  803306:	00 00 00 
+  803309:	ff d0                	call   *%rax
+  80330b:	89 c3                	mov    %eax,%ebx
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	0f 88 c5 00 00 00    	js     8033da <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803315:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803319:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  803320:	00 00 00 
+  803323:	ff d0                	call   *%rax
+  803325:	48 89 c1             	mov    %rax,%rcx
+  803328:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80332e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803334:	ba 00 00 00 00       	mov    $0x0,%edx
+  803339:	4c 89 ee             	mov    %r13,%rsi
+  80333c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803341:	48 b8 92 15 80 00 00 	movabs $0x801592,%rax
+  803348:	00 00 00 
+  80334b:	ff d0                	call   *%rax
+  80334d:	89 c3                	mov    %eax,%ebx
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	78 6e                	js     8033c1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803353:	be 00 10 00 00       	mov    $0x1000,%esi
+  803358:	4c 89 ef             	mov    %r13,%rdi
+  80335b:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+  803367:	83 f8 02             	cmp    $0x2,%eax
+  80336a:	0f 85 ab 00 00 00    	jne    80341b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803370:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803377:	00 00 
+  803379:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80337d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80337f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803383:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80338a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80338e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803390:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803394:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80339b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80339f:	48 bb 0a 1a 80 00 00 	movabs $0x801a0a,%rbx
+  8033a6:	00 00 00 
+  8033a9:	ff d3                	call   *%rbx
+  8033ab:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8033af:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8033b3:	ff d3                	call   *%rbx
+  8033b5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8033ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033bf:	eb 4d                	jmp    80340e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8033c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033c6:	4c 89 ee             	mov    %r13,%rsi
+  8033c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ce:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8033d5:	00 00 00 
+  8033d8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8033da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033df:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8033e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e8:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8033f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803402:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+}
+  80340e:	89 d8                	mov    %ebx,%eax
+  803410:	48 83 c4 18          	add    $0x18,%rsp
+  803414:	5b                   	pop    %rbx
+  803415:	41 5c                	pop    %r12
+  803417:	41 5d                	pop    %r13
+  803419:	5d                   	pop    %rbp
+  80341a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80341b:	48 b9 08 42 80 00 00 	movabs $0x804208,%rcx
+  803422:	00 00 00 
+  803425:	48 ba e7 41 80 00 00 	movabs $0x8041e7,%rdx
+  80342c:	00 00 00 
+  80342f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803434:	48 bf fc 41 80 00 00 	movabs $0x8041fc,%rdi
+  80343b:	00 00 00 
+  80343e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803443:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  80344a:	00 00 00 
+  80344d:	41 ff d0             	call   *%r8
+
+0000000000803450 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803450:	55                   	push   %rbp
+  803451:	48 89 e5             	mov    %rsp,%rbp
+  803454:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803458:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80345c:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  803463:	00 00 00 
+  803466:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	78 35                	js     8034a1 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80346c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803470:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+  80347c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80347f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803484:	be 00 10 00 00       	mov    $0x1000,%esi
+  803489:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80348d:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  803494:	00 00 00 
+  803497:	ff d0                	call   *%rax
+  803499:	85 c0                	test   %eax,%eax
+  80349b:	0f 94 c0             	sete   %al
+  80349e:	0f b6 c0             	movzbl %al,%eax
+}
+  8034a1:	c9                   	leave
+  8034a2:	c3                   	ret
+
+00000000008034a3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034a3:	48 89 f8             	mov    %rdi,%rax
+  8034a6:	48 c1 e8 27          	shr    $0x27,%rax
+  8034aa:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034b1:	01 00 00 
+  8034b4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034b8:	f6 c2 01             	test   $0x1,%dl
+  8034bb:	74 6d                	je     80352a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034bd:	48 89 f8             	mov    %rdi,%rax
+  8034c0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034c4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034cb:	01 00 00 
+  8034ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034d2:	f6 c2 01             	test   $0x1,%dl
+  8034d5:	74 62                	je     803539 <get_uvpt_entry+0x96>
+  8034d7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034de:	01 00 00 
+  8034e1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034e5:	f6 c2 80             	test   $0x80,%dl
+  8034e8:	75 4f                	jne    803539 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034ea:	48 89 f8             	mov    %rdi,%rax
+  8034ed:	48 c1 e8 15          	shr    $0x15,%rax
+  8034f1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034f8:	01 00 00 
+  8034fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034ff:	f6 c2 01             	test   $0x1,%dl
+  803502:	74 44                	je     803548 <get_uvpt_entry+0xa5>
+  803504:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80350b:	01 00 00 
+  80350e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803512:	f6 c2 80             	test   $0x80,%dl
+  803515:	75 31                	jne    803548 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803517:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80351b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803522:	01 00 00 
+  803525:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803529:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80352a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803531:	01 00 00 
+  803534:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803538:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803539:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803540:	01 00 00 
+  803543:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803547:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803548:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80354f:	01 00 00 
+  803552:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803556:	c3                   	ret
+
+0000000000803557 <get_prot>:
+
+int
+get_prot(void *va) {
+  803557:	55                   	push   %rbp
+  803558:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80355b:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80356a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80356f:	89 c1                	mov    %eax,%ecx
+  803571:	83 c9 04             	or     $0x4,%ecx
+  803574:	f6 c2 01             	test   $0x1,%dl
+  803577:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80357a:	89 c1                	mov    %eax,%ecx
+  80357c:	83 c9 02             	or     $0x2,%ecx
+  80357f:	f6 c2 02             	test   $0x2,%dl
+  803582:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803585:	89 c1                	mov    %eax,%ecx
+  803587:	83 c9 01             	or     $0x1,%ecx
+  80358a:	48 85 d2             	test   %rdx,%rdx
+  80358d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803590:	89 c1                	mov    %eax,%ecx
+  803592:	83 c9 40             	or     $0x40,%ecx
+  803595:	f6 c6 04             	test   $0x4,%dh
+  803598:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80359b:	5d                   	pop    %rbp
+  80359c:	c3                   	ret
+
+000000000080359d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80359d:	55                   	push   %rbp
+  80359e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035a1:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  8035a8:	00 00 00 
+  8035ab:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8035ad:	48 c1 e8 06          	shr    $0x6,%rax
+  8035b1:	83 e0 01             	and    $0x1,%eax
+}
+  8035b4:	5d                   	pop    %rbp
+  8035b5:	c3                   	ret
+
+00000000008035b6 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8035b6:	55                   	push   %rbp
+  8035b7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035ba:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  8035c1:	00 00 00 
+  8035c4:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8035c6:	48 c1 e8 05          	shr    $0x5,%rax
+  8035ca:	83 e0 01             	and    $0x1,%eax
+}
+  8035cd:	5d                   	pop    %rbp
+  8035ce:	c3                   	ret
+
+00000000008035cf <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8035cf:	55                   	push   %rbp
+  8035d0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8035d3:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	83 e0 01             	and    $0x1,%eax
+}
+  8035e2:	5d                   	pop    %rbp
+  8035e3:	c3                   	ret
+
+00000000008035e4 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8035e4:	55                   	push   %rbp
+  8035e5:	48 89 e5             	mov    %rsp,%rbp
+  8035e8:	41 57                	push   %r15
+  8035ea:	41 56                	push   %r14
+  8035ec:	41 55                	push   %r13
+  8035ee:	41 54                	push   %r12
+  8035f0:	53                   	push   %rbx
+  8035f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8035f5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8035f9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8035fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803602:	49 bd cf 35 80 00 00 	movabs $0x8035cf,%r13
+  803609:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80360c:	49 bf 57 35 80 00 00 	movabs $0x803557,%r15
+  803613:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803616:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80361d:	00 00 00 
+  803620:	eb 0c                	jmp    80362e <foreach_shared_region+0x4a>
+  803622:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803629:	4c 39 f3             	cmp    %r14,%rbx
+  80362c:	74 2e                	je     80365c <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80362e:	48 89 df             	mov    %rbx,%rdi
+  803631:	41 ff d5             	call   *%r13
+  803634:	84 c0                	test   %al,%al
+  803636:	74 ea                	je     803622 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803638:	48 89 df             	mov    %rbx,%rdi
+  80363b:	41 ff d7             	call   *%r15
+  80363e:	a8 40                	test   $0x40,%al
+  803640:	74 e0                	je     803622 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803642:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803649:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80364d:	48 89 df             	mov    %rbx,%rdi
+  803650:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803654:	ff d0                	call   *%rax
+				if (res < 0) {
+  803656:	85 c0                	test   %eax,%eax
+  803658:	79 c8                	jns    803622 <foreach_shared_region+0x3e>
+  80365a:	eb 05                	jmp    803661 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80365c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803661:	48 83 c4 18          	add    $0x18,%rsp
+  803665:	5b                   	pop    %rbx
+  803666:	41 5c                	pop    %r12
+  803668:	41 5d                	pop    %r13
+  80366a:	41 5e                	pop    %r14
+  80366c:	41 5f                	pop    %r15
+  80366e:	5d                   	pop    %rbp
+  80366f:	c3                   	ret
+
+0000000000803670 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803670:	b8 00 00 00 00       	mov    $0x0,%eax
+  803675:	c3                   	ret
+
+0000000000803676 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80367d:	48 be 2c 42 80 00 00 	movabs $0x80422c,%rsi
+  803684:	00 00 00 
+  803687:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  80368e:	00 00 00 
+  803691:	ff d0                	call   *%rax
+    return 0;
+}
+  803693:	b8 00 00 00 00       	mov    $0x0,%eax
+  803698:	5d                   	pop    %rbp
+  803699:	c3                   	ret
+
+000000000080369a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80369a:	55                   	push   %rbp
+  80369b:	48 89 e5             	mov    %rsp,%rbp
+  80369e:	41 57                	push   %r15
+  8036a0:	41 56                	push   %r14
+  8036a2:	41 55                	push   %r13
+  8036a4:	41 54                	push   %r12
+  8036a6:	53                   	push   %rbx
+  8036a7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8036ae:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8036b5:	48 85 d2             	test   %rdx,%rdx
+  8036b8:	74 7a                	je     803734 <devcons_write+0x9a>
+  8036ba:	49 89 d6             	mov    %rdx,%r14
+  8036bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036c3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8036c8:	49 bf 99 10 80 00 00 	movabs $0x801099,%r15
+  8036cf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8036d2:	4c 89 f3             	mov    %r14,%rbx
+  8036d5:	48 29 f3             	sub    %rsi,%rbx
+  8036d8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8036dd:	48 39 c3             	cmp    %rax,%rbx
+  8036e0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8036e4:	4c 63 eb             	movslq %ebx,%r13
+  8036e7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8036ee:	48 01 c6             	add    %rax,%rsi
+  8036f1:	4c 89 ea             	mov    %r13,%rdx
+  8036f4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8036fb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8036fe:	4c 89 ee             	mov    %r13,%rsi
+  803701:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803708:	48 b8 a2 13 80 00 00 	movabs $0x8013a2,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803714:	41 01 dc             	add    %ebx,%r12d
+  803717:	49 63 f4             	movslq %r12d,%rsi
+  80371a:	4c 39 f6             	cmp    %r14,%rsi
+  80371d:	72 b3                	jb     8036d2 <devcons_write+0x38>
+    return res;
+  80371f:	49 63 c4             	movslq %r12d,%rax
+}
+  803722:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803729:	5b                   	pop    %rbx
+  80372a:	41 5c                	pop    %r12
+  80372c:	41 5d                	pop    %r13
+  80372e:	41 5e                	pop    %r14
+  803730:	41 5f                	pop    %r15
+  803732:	5d                   	pop    %rbp
+  803733:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803734:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80373a:	eb e3                	jmp    80371f <devcons_write+0x85>
+
+000000000080373c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80373c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80373f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803744:	48 85 c0             	test   %rax,%rax
+  803747:	74 55                	je     80379e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803749:	55                   	push   %rbp
+  80374a:	48 89 e5             	mov    %rsp,%rbp
+  80374d:	41 55                	push   %r13
+  80374f:	41 54                	push   %r12
+  803751:	53                   	push   %rbx
+  803752:	48 83 ec 08          	sub    $0x8,%rsp
+  803756:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803759:	48 bb cf 13 80 00 00 	movabs $0x8013cf,%rbx
+  803760:	00 00 00 
+  803763:	49 bc 9c 14 80 00 00 	movabs $0x80149c,%r12
+  80376a:	00 00 00 
+  80376d:	eb 03                	jmp    803772 <devcons_read+0x36>
+  80376f:	41 ff d4             	call   *%r12
+  803772:	ff d3                	call   *%rbx
+  803774:	85 c0                	test   %eax,%eax
+  803776:	74 f7                	je     80376f <devcons_read+0x33>
+    if (c < 0) return c;
+  803778:	48 63 d0             	movslq %eax,%rdx
+  80377b:	78 13                	js     803790 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80377d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803782:	83 f8 04             	cmp    $0x4,%eax
+  803785:	74 09                	je     803790 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803787:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80378b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803790:	48 89 d0             	mov    %rdx,%rax
+  803793:	48 83 c4 08          	add    $0x8,%rsp
+  803797:	5b                   	pop    %rbx
+  803798:	41 5c                	pop    %r12
+  80379a:	41 5d                	pop    %r13
+  80379c:	5d                   	pop    %rbp
+  80379d:	c3                   	ret
+  80379e:	48 89 d0             	mov    %rdx,%rax
+  8037a1:	c3                   	ret
+
+00000000008037a2 <cputchar>:
+cputchar(int ch) {
+  8037a2:	55                   	push   %rbp
+  8037a3:	48 89 e5             	mov    %rsp,%rbp
+  8037a6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8037aa:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8037ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8037b3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8037b7:	48 b8 a2 13 80 00 00 	movabs $0x8013a2,%rax
+  8037be:	00 00 00 
+  8037c1:	ff d0                	call   *%rax
+}
+  8037c3:	c9                   	leave
+  8037c4:	c3                   	ret
+
+00000000008037c5 <getchar>:
+getchar(void) {
+  8037c5:	55                   	push   %rbp
+  8037c6:	48 89 e5             	mov    %rsp,%rbp
+  8037c9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8037cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037d2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8037d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037db:	48 b8 7b 1d 80 00 00 	movabs $0x801d7b,%rax
+  8037e2:	00 00 00 
+  8037e5:	ff d0                	call   *%rax
+  8037e7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8037e9:	85 c0                	test   %eax,%eax
+  8037eb:	78 06                	js     8037f3 <getchar+0x2e>
+  8037ed:	74 08                	je     8037f7 <getchar+0x32>
+  8037ef:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8037f3:	89 d0                	mov    %edx,%eax
+  8037f5:	c9                   	leave
+  8037f6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8037f7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8037fc:	eb f5                	jmp    8037f3 <getchar+0x2e>
+
+00000000008037fe <iscons>:
+iscons(int fdnum) {
+  8037fe:	55                   	push   %rbp
+  8037ff:	48 89 e5             	mov    %rsp,%rbp
+  803802:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803806:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80380a:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  803811:	00 00 00 
+  803814:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803816:	85 c0                	test   %eax,%eax
+  803818:	78 18                	js     803832 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80381a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80381e:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803825:	00 00 00 
+  803828:	8b 00                	mov    (%rax),%eax
+  80382a:	39 02                	cmp    %eax,(%rdx)
+  80382c:	0f 94 c0             	sete   %al
+  80382f:	0f b6 c0             	movzbl %al,%eax
+}
+  803832:	c9                   	leave
+  803833:	c3                   	ret
+
+0000000000803834 <opencons>:
+opencons(void) {
+  803834:	55                   	push   %rbp
+  803835:	48 89 e5             	mov    %rsp,%rbp
+  803838:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80383c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803840:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  803847:	00 00 00 
+  80384a:	ff d0                	call   *%rax
+  80384c:	85 c0                	test   %eax,%eax
+  80384e:	78 49                	js     803899 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803850:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803855:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80385a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80385e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803863:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  80386a:	00 00 00 
+  80386d:	ff d0                	call   *%rax
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	78 26                	js     803899 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803873:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803877:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  80387e:	00 00 
+  803880:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803882:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803886:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80388d:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  803894:	00 00 00 
+  803897:	ff d0                	call   *%rax
+}
+  803899:	c9                   	leave
+  80389a:	c3                   	ret
+
+000000000080389b <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80389b:	55                   	push   %rbp
+  80389c:	48 89 e5             	mov    %rsp,%rbp
+  80389f:	41 55                	push   %r13
+  8038a1:	41 54                	push   %r12
+  8038a3:	53                   	push   %rbx
+  8038a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8038a8:	49 89 fc             	mov    %rdi,%r12
+  8038ab:	48 89 f7             	mov    %rsi,%rdi
+  8038ae:	48 89 d3             	mov    %rdx,%rbx
+  8038b1:	49 89 cd             	mov    %rcx,%r13
+  8038b4:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038b7:	48 85 f6             	test   %rsi,%rsi
+  8038ba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038c1:	00 00 00 
+  8038c4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8038c8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038cd:	48 85 db             	test   %rbx,%rbx
+  8038d0:	74 03                	je     8038d5 <ipc_recv_timed+0x3a>
+  8038d2:	48 8b 33             	mov    (%rbx),%rsi
+  8038d5:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  8038dc:	00 00 00 
+  8038df:	ff d0                	call   *%rax
+    if (res < 0) {
+  8038e1:	85 c0                	test   %eax,%eax
+  8038e3:	78 75                	js     80395a <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8038e5:	4d 85 e4             	test   %r12,%r12
+  8038e8:	74 14                	je     8038fe <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8038ea:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038f1:	00 00 00 
+  8038f4:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8038fa:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8038fe:	4d 85 ed             	test   %r13,%r13
+  803901:	74 14                	je     803917 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803903:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80390a:	00 00 00 
+  80390d:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803913:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803917:	48 85 db             	test   %rbx,%rbx
+  80391a:	74 23                	je     80393f <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80391c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803923:	00 00 00 
+  803926:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80392c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803931:	85 c9                	test   %ecx,%ecx
+  803933:	74 07                	je     80393c <ipc_recv_timed+0xa1>
+  803935:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80393c:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80393f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803946:	00 00 00 
+  803949:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80394f:	48 83 c4 08          	add    $0x8,%rsp
+  803953:	5b                   	pop    %rbx
+  803954:	41 5c                	pop    %r12
+  803956:	41 5d                	pop    %r13
+  803958:	5d                   	pop    %rbp
+  803959:	c3                   	ret
+        if (from_env_store != NULL) {
+  80395a:	4d 85 e4             	test   %r12,%r12
+  80395d:	74 08                	je     803967 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80395f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803966:	00 
+        if (perm_store != NULL) {
+  803967:	4d 85 ed             	test   %r13,%r13
+  80396a:	74 08                	je     803974 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80396c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803973:	00 
+        if (size != NULL) {
+  803974:	48 85 db             	test   %rbx,%rbx
+  803977:	74 d6                	je     80394f <ipc_recv_timed+0xb4>
+            *size = 0;
+  803979:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803980:	eb cd                	jmp    80394f <ipc_recv_timed+0xb4>
+
+0000000000803982 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803982:	55                   	push   %rbp
+  803983:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803986:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80398c:	48 b8 9b 38 80 00 00 	movabs $0x80389b,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+}
+  803998:	5d                   	pop    %rbp
+  803999:	c3                   	ret
+
+000000000080399a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80399a:	55                   	push   %rbp
+  80399b:	48 89 e5             	mov    %rsp,%rbp
+  80399e:	41 57                	push   %r15
+  8039a0:	41 56                	push   %r14
+  8039a2:	41 55                	push   %r13
+  8039a4:	41 54                	push   %r12
+  8039a6:	53                   	push   %rbx
+  8039a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ab:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8039ae:	48 89 d3             	mov    %rdx,%rbx
+  8039b1:	49 89 cc             	mov    %rcx,%r12
+  8039b4:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8039b7:	48 85 d2             	test   %rdx,%rdx
+  8039ba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039c1:	00 00 00 
+  8039c4:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039c8:	89 f0                	mov    %esi,%eax
+  8039ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039ce:	48 89 da             	mov    %rbx,%rdx
+  8039d1:	48 89 c6             	mov    %rax,%rsi
+  8039d4:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+    while (res < 0) {
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	79 65                	jns    803a49 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8039e4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8039e7:	75 33                	jne    803a1c <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8039e9:	49 bf 9c 14 80 00 00 	movabs $0x80149c,%r15
+  8039f0:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039f3:	49 be 99 17 80 00 00 	movabs $0x801799,%r14
+  8039fa:	00 00 00 
+        sys_yield();
+  8039fd:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a00:	45 89 e8             	mov    %r13d,%r8d
+  803a03:	4c 89 e1             	mov    %r12,%rcx
+  803a06:	48 89 da             	mov    %rbx,%rdx
+  803a09:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a0d:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803a10:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803a13:	85 c0                	test   %eax,%eax
+  803a15:	79 32                	jns    803a49 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a17:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a1a:	74 e1                	je     8039fd <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803a1c:	89 c1                	mov    %eax,%ecx
+  803a1e:	48 ba 38 42 80 00 00 	movabs $0x804238,%rdx
+  803a25:	00 00 00 
+  803a28:	be 52 00 00 00       	mov    $0x52,%esi
+  803a2d:	48 bf 4c 42 80 00 00 	movabs $0x80424c,%rdi
+  803a34:	00 00 00 
+  803a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3c:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  803a43:	00 00 00 
+  803a46:	41 ff d0             	call   *%r8
+    }
+}
+  803a49:	48 83 c4 18          	add    $0x18,%rsp
+  803a4d:	5b                   	pop    %rbx
+  803a4e:	41 5c                	pop    %r12
+  803a50:	41 5d                	pop    %r13
+  803a52:	41 5e                	pop    %r14
+  803a54:	41 5f                	pop    %r15
+  803a56:	5d                   	pop    %rbp
+  803a57:	c3                   	ret
+
+0000000000803a58 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a58:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803a5d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803a64:	00 00 00 
+  803a67:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a6b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a6f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a73:	48 01 ca             	add    %rcx,%rdx
+  803a76:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a7c:	39 fa                	cmp    %edi,%edx
+  803a7e:	74 12                	je     803a92 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a80:	48 83 c0 01          	add    $0x1,%rax
+  803a84:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a8a:	75 db                	jne    803a67 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a91:	c3                   	ret
+            return envs[i].env_id;
+  803a92:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a96:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a9a:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a9e:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803aa5:	00 00 00 
+  803aa8:	48 01 d0             	add    %rdx,%rax
+  803aab:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ab1:	c3                   	ret
+  803ab2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803ab8 <__rodata_start>:
+  803ab8:	70 72                	jo     803b2c <__rodata_start+0x74>
+  803aba:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803ac1:	20 63 6f             	and    %ah,0x6f(%rbx)
+  803ac4:	75 6c                	jne    803b32 <__rodata_start+0x7a>
+  803ac6:	64 20 6e 6f          	and    %ch,%fs:0x6f(%rsi)
+  803aca:	74 20                	je     803aec <__rodata_start+0x34>
+  803acc:	72 65                	jb     803b33 <__rodata_start+0x7b>
+  803ace:	61                   	(bad)
+  803acf:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803ad3:	69 74 69 61 6c 20 70 	imul   $0x7270206c,0x61(%rcx,%rbp,2),%esi
+  803ada:	72 
+  803adb:	69 6d 65 3a 20 25 64 	imul   $0x6425203a,0x65(%rbp),%ebp
+  803ae2:	2c 20                	sub    $0x20,%al
+  803ae4:	25 69 00 75 73       	and    $0x73750069,%eax
+  803ae9:	65 72 2f             	gs jb  803b1b <__rodata_start+0x63>
+  803aec:	70 72                	jo     803b60 <__rodata_start+0xa8>
+  803aee:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  803af5:	65 2e 63 00          	gs movsxd %gs:(%rax),%eax
+  803af9:	25 64 0a 00 70       	and    $0x70000a64,%eax
+  803afe:	69 70 65 3a 20 25 69 	imul   $0x6925203a,0x65(%rax),%esi
+  803b05:	00 66 6f             	add    %ah,0x6f(%rsi)
+  803b08:	72 6b                	jb     803b75 <__rodata_start+0xbd>
+  803b0a:	3a 20                	cmp    (%rax),%ah
+  803b0c:	25 69 00 70 72       	and    $0x72700069,%eax
+  803b11:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803b18:	20 25 64 20 72 65    	and    %ah,0x65722064(%rip)        # 65f25b82 <__bss_end+0x6571cb82>
+  803b1e:	61                   	(bad)
+  803b1f:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  803b21:	20 25 64 20 25 64    	and    %ah,0x64252064(%rip)        # 64a55b8b <__bss_end+0x6424cb8b>
+  803b27:	20 25 69 00 70 72    	and    %ah,0x72700069(%rip)        # 72f03b96 <__bss_end+0x726fab96>
+  803b2d:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803b34:	20 25 64 20 77 72    	and    %ah,0x72772064(%rip)        # 72f75b9e <__bss_end+0x7276cb9e>
+  803b3a:	69 74 65 3a 20 25 64 	imul   $0x20642520,0x3a(%rbp,%riz,2),%esi
+  803b41:	20 
+  803b42:	25 69 00 70 72       	and    $0x72700069,%eax
+  803b47:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  803b4e:	65 00 67 65          	add    %ah,%gs:0x65(%rdi)
+  803b52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b53:	65 72 61             	gs jb  803bb7 <__rodata_start+0xff>
+  803b56:	74 6f                	je     803bc7 <__rodata_start+0x10f>
+  803b58:	72 20                	jb     803b7a <__rodata_start+0xc2>
+  803b5a:	77 72                	ja     803bce <__rodata_start+0x116>
+  803b5c:	69 74 65 3a 20 25 64 	imul   $0x2c642520,0x3a(%rbp,%riz,2),%esi
+  803b63:	2c 
+  803b64:	20 25 69 00 3c 75    	and    %ah,0x753c0069(%rip)        # 75bc3bd3 <__bss_end+0x753babd3>
+  803b6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b6b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803b6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b70:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803b74:	1f                   	(bad)
+  803b75:	44 00 00             	add    %r8b,(%rax)
+  803b78:	5b                   	pop    %rbx
+  803b79:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803b7e:	20 75 73             	and    %dh,0x73(%rbp)
+  803b81:	65 72 20             	gs jb  803ba4 <__rodata_start+0xec>
+  803b84:	70 61                	jo     803be7 <__rodata_start+0x12f>
+  803b86:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b87:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803b8e:	73 20                	jae    803bb0 <__rodata_start+0xf8>
+  803b90:	61                   	(bad)
+  803b91:	74 20                	je     803bb3 <__rodata_start+0xfb>
+  803b93:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b98:	3a 20                	cmp    (%rax),%ah
+  803b9a:	00 30                	add    %dh,(%rax)
+  803b9c:	31 32                	xor    %esi,(%rdx)
+  803b9e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ba5:	41                   	rex.B
+  803ba6:	42                   	rex.X
+  803ba7:	43                   	rex.XB
+  803ba8:	44                   	rex.R
+  803ba9:	45                   	rex.RB
+  803baa:	46 00 30             	rex.RX add %r14b,(%rax)
+  803bad:	31 32                	xor    %esi,(%rdx)
+  803baf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803bb6:	61                   	(bad)
+  803bb7:	62 63 64 65 66       	(bad)
+  803bbc:	00 28                	add    %ch,(%rax)
+  803bbe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bbf:	75 6c                	jne    803c2d <__rodata_start+0x175>
+  803bc1:	6c                   	insb   (%dx),%es:(%rdi)
+  803bc2:	29 00                	sub    %eax,(%rax)
+  803bc4:	65 72 72             	gs jb  803c39 <__rodata_start+0x181>
+  803bc7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bc8:	72 20                	jb     803bea <__rodata_start+0x132>
+  803bca:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803bcf:	73 70                	jae    803c41 <__rodata_start+0x189>
+  803bd1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803bd5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803bdc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bdd:	72 00                	jb     803bdf <__rodata_start+0x127>
+  803bdf:	62 61 64 20 65       	(bad)
+  803be4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803be5:	76 69                	jbe    803c50 <__rodata_start+0x198>
+  803be7:	72 6f                	jb     803c58 <__rodata_start+0x1a0>
+  803be9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bea:	6d                   	insl   (%dx),%es:(%rdi)
+  803beb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bed:	74 00                	je     803bef <__rodata_start+0x137>
+  803bef:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bf6:	20 70 61             	and    %dh,0x61(%rax)
+  803bf9:	72 61                	jb     803c5c <__rodata_start+0x1a4>
+  803bfb:	6d                   	insl   (%dx),%es:(%rdi)
+  803bfc:	65 74 65             	gs je  803c64 <__rodata_start+0x1ac>
+  803bff:	72 00                	jb     803c01 <__rodata_start+0x149>
+  803c01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c02:	75 74                	jne    803c78 <__rodata_start+0x1c0>
+  803c04:	20 6f 66             	and    %ch,0x66(%rdi)
+  803c07:	20 6d 65             	and    %ch,0x65(%rbp)
+  803c0a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c0c:	72 79                	jb     803c87 <__rodata_start+0x1cf>
+  803c0e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803c11:	74 20                	je     803c33 <__rodata_start+0x17b>
+  803c13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c14:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803c18:	76 69                	jbe    803c83 <__rodata_start+0x1cb>
+  803c1a:	72 6f                	jb     803c8b <__rodata_start+0x1d3>
+  803c1c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c1d:	6d                   	insl   (%dx),%es:(%rdi)
+  803c1e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c20:	74 73                	je     803c95 <__rodata_start+0x1dd>
+  803c22:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803c25:	72 72                	jb     803c99 <__rodata_start+0x1e1>
+  803c27:	75 70                	jne    803c99 <__rodata_start+0x1e1>
+  803c29:	74 65                	je     803c90 <__rodata_start+0x1d8>
+  803c2b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803c30:	75 67                	jne    803c99 <__rodata_start+0x1e1>
+  803c32:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c35:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c37:	00 73 65             	add    %dh,0x65(%rbx)
+  803c3a:	67 6d                	insl   (%dx),%es:(%edi)
+  803c3c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c3e:	74 61                	je     803ca1 <__rodata_start+0x1e9>
+  803c40:	74 69                	je     803cab <__rodata_start+0x1f3>
+  803c42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c44:	20 66 61             	and    %ah,0x61(%rsi)
+  803c47:	75 6c                	jne    803cb5 <__rodata_start+0x1fd>
+  803c49:	74 00                	je     803c4b <__rodata_start+0x193>
+  803c4b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c52:	20 45 4c             	and    %al,0x4c(%rbp)
+  803c55:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c59:	61                   	(bad)
+  803c5a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c5f:	20 73 75             	and    %dh,0x75(%rbx)
+  803c62:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c65:	73 79                	jae    803ce0 <__rodata_start+0x228>
+  803c67:	73 74                	jae    803cdd <__rodata_start+0x225>
+  803c69:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c6b:	20 63 61             	and    %ah,0x61(%rbx)
+  803c6e:	6c                   	insb   (%dx),%es:(%rdi)
+  803c6f:	6c                   	insb   (%dx),%es:(%rdi)
+  803c70:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803c73:	74 72                	je     803ce7 <__rodata_start+0x22f>
+  803c75:	79 20                	jns    803c97 <__rodata_start+0x1df>
+  803c77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c79:	74 20                	je     803c9b <__rodata_start+0x1e3>
+  803c7b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c7d:	75 6e                	jne    803ced <__rodata_start+0x235>
+  803c7f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803c83:	76 20                	jbe    803ca5 <__rodata_start+0x1ed>
+  803c85:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803c8c:	72 65                	jb     803cf3 <__rodata_start+0x23b>
+  803c8e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803c91:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c92:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803c96:	65 78 70             	gs js  803d09 <__rodata_start+0x251>
+  803c99:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c9e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803ca1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803ca5:	20 66 69             	and    %ah,0x69(%rsi)
+  803ca8:	6c                   	insb   (%dx),%es:(%rdi)
+  803ca9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803cad:	20 66 72             	and    %ah,0x72(%rsi)
+  803cb0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803cb5:	61                   	(bad)
+  803cb6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803cb9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cbb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803cbf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803cc2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc4:	20 6d 61             	and    %ch,0x61(%rbp)
+  803cc7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cc8:	79 20                	jns    803cea <__rodata_start+0x232>
+  803cca:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803cd1:	72 65                	jb     803d38 <__rodata_start+0x280>
+  803cd3:	20 6f 70             	and    %ch,0x70(%rdi)
+  803cd6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cd8:	00 66 69             	add    %ah,0x69(%rsi)
+  803cdb:	6c                   	insb   (%dx),%es:(%rdi)
+  803cdc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803ce0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803ce3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ce4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803ce7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ce8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ce9:	74 20                	je     803d0b <__rodata_start+0x253>
+  803ceb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ced:	75 6e                	jne    803d5d <__rodata_start+0x2a5>
+  803cef:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803cf3:	76 61                	jbe    803d56 <__rodata_start+0x29e>
+  803cf5:	6c                   	insb   (%dx),%es:(%rdi)
+  803cf6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803cfd:	00 
+  803cfe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803d05:	72 65                	jb     803d6c <__rodata_start+0x2b4>
+  803d07:	61                   	(bad)
+  803d08:	64 79 20             	fs jns 803d2b <__rodata_start+0x273>
+  803d0b:	65 78 69             	gs js  803d77 <__rodata_start+0x2bf>
+  803d0e:	73 74                	jae    803d84 <__rodata_start+0x2cc>
+  803d10:	73 00                	jae    803d12 <__rodata_start+0x25a>
+  803d12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d13:	70 65                	jo     803d7a <__rodata_start+0x2c2>
+  803d15:	72 61                	jb     803d78 <__rodata_start+0x2c0>
+  803d17:	74 69                	je     803d82 <__rodata_start+0x2ca>
+  803d19:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d1b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803d1e:	74 20                	je     803d40 <__rodata_start+0x288>
+  803d20:	73 75                	jae    803d97 <__rodata_start+0x2df>
+  803d22:	70 70                	jo     803d94 <__rodata_start+0x2dc>
+  803d24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d25:	72 74                	jb     803d9b <__rodata_start+0x2e3>
+  803d27:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803d2d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803d32:	74 00                	je     803d34 <__rodata_start+0x27c>
+  803d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803d3b:	00 00 00 
+  803d3e:	66 90                	xchg   %ax,%ax
+  803d40:	67 07                	addr32 (bad)
+  803d42:	80 00 00             	addb   $0x0,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 98 0d 80 00 00    	add    %bl,0x800d(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 86 07 80 00 00    	add    %al,0x8007(%rsi)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 7a 07             	add    %bh,0x7(%rdx)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 f4                	add    %dh,%ah
+  803d99:	07                   	(bad)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 7a 07             	add    %bh,0x7(%rdx)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 c0                	add    %al,%al
+  803db1:	07                   	(bad)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 c0                	add    %al,%al
+  803db9:	07                   	(bad)
+  803dba:	80 00 00             	addb   $0x0,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 c0                	add    %al,%al
+  803dc1:	07                   	(bad)
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 c0                	add    %al,%al
+  803dc9:	07                   	(bad)
+  803dca:	80 00 00             	addb   $0x0,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 c0                	add    %al,%al
+  803dd1:	07                   	(bad)
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 c0                	add    %al,%al
+  803dd9:	07                   	(bad)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 c0                	add    %al,%al
+  803de1:	07                   	(bad)
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 c0                	add    %al,%al
+  803de9:	07                   	(bad)
+  803dea:	80 00 00             	addb   $0x0,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 c0                	add    %al,%al
+  803df1:	07                   	(bad)
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 cb                	add    %cl,%bl
+  803ee9:	0c 80                	or     $0x80,%al
+  803eeb:	00 00                	add    %al,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 17                	add    %dl,(%rdi)
+  803f41:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803f47:	00 e6                	add    %ah,%dh
+  803f49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f4f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 46 08             	add    %al,0x8(%rsi)
+  803f72:	80 00 00             	addb   $0x0,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 0c 08             	add    %cl,(%rax,%rcx,1)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 8e 0b 80 00 00    	add    %cl,0x800b(%rsi)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 58 0c             	add    %bl,0xc(%rax)
+  803faa:	80 00 00             	addb   $0x0,(%rax)
+  803fad:	00 00                	add    %al,(%rax)
+  803faf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803fbd:	00 00                	add    %al,(%rax)
+  803fbf:	00 dd                	add    %bl,%ch
+  803fc1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803fc7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803fcd:	00 00                	add    %al,(%rax)
+  803fcf:	00 ba 0a 80 00 00    	add    %bh,0x800a(%rdx)
+  803fd5:	00 00                	add    %al,(%rax)
+  803fd7:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803fdd:	00 00                	add    %al,(%rax)
+  803fdf:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 cb                	add    %cl,%bl
+  803fe9:	0c 80                	or     $0x80,%al
+  803feb:	00 00                	add    %al,(%rax)
+  803fed:	00 00                	add    %al,(%rax)
+  803fef:	00 a8 0d 80 00 00    	add    %ch,0x800d(%rax)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 70 07             	add    %dh,0x7(%rax)
+  803ffa:	80 00 00             	addb   $0x0,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804000 <error_string>:
+	...
+  804008:	cd 3b 80 00 00 00 00 00 df 3b 80 00 00 00 00 00     .;.......;......
+  804018:	ef 3b 80 00 00 00 00 00 01 3c 80 00 00 00 00 00     .;.......<......
+  804028:	0f 3c 80 00 00 00 00 00 23 3c 80 00 00 00 00 00     .<......#<......
+  804038:	38 3c 80 00 00 00 00 00 4b 3c 80 00 00 00 00 00     8<......K<......
+  804048:	5d 3c 80 00 00 00 00 00 71 3c 80 00 00 00 00 00     ]<......q<......
+  804058:	81 3c 80 00 00 00 00 00 94 3c 80 00 00 00 00 00     .<.......<......
+  804068:	ab 3c 80 00 00 00 00 00 c1 3c 80 00 00 00 00 00     .<.......<......
+  804078:	d9 3c 80 00 00 00 00 00 f1 3c 80 00 00 00 00 00     .<.......<......
+  804088:	fe 3c 80 00 00 00 00 00 a8 40 80 00 00 00 00 00     .<.......@......
+  804098:	12 3d 80 00 00 00 00 00 2a 3d 80 00 00 00 00 00     .=......*=......
+  8040a8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8040b8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8040c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8040d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8040e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8040f8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804108:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804118:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804128:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804138:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804148:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804158:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804168:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804178:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804188:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804198:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8041a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8041b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008041c0 <devtab>:
+  8041c0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  8041d0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8041e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8041f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804200:	70 69 70 65 2e 63 00 90 73 79 73 5f 72 65 67 69     pipe.c..sys_regi
+  804210:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804220:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804230:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  804240:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804250:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
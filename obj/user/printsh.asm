@@ -0,0 +1,6896 @@
+
+obj/user/printsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+
+    int res = print_snapshot_list();
+  800029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80002e:	48 ba 7b 1d 80 00 00 	movabs $0x801d7b,%rdx
+  800035:	00 00 00 
+  800038:	ff d2                	call   *%rdx
+
+    if (res < 0) {
+  80003a:	85 c0                	test   %eax,%eax
+  80003c:	78 02                	js     800040 <umain+0x1b>
+        cprintf("Snapshot list cannot be printed\n");
+    }
+    
+    return;
+  80003e:	5d                   	pop    %rbp
+  80003f:	c3                   	ret
+        cprintf("Snapshot list cannot be printed\n");
+  800040:	48 bf a8 36 80 00 00 	movabs $0x8036a8,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba db 01 80 00 00 	movabs $0x8001db,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+    return;
+  80005b:	eb e1                	jmp    80003e <umain+0x19>
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	41 89 fd             	mov    %edi,%r13d
+  80006b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800075:	00 00 00 
+  800078:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	73 17                	jae    80009e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800087:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008a:	49 89 c4             	mov    %rax,%r12
+  80008d:	48 83 c3 08          	add    $0x8,%rbx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff 53 f8             	call   *-0x8(%rbx)
+  800099:	4c 39 e3             	cmp    %r12,%rbx
+  80009c:	72 ef                	jb     80008d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80009e:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000b3:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000b7:	48 c1 e0 04          	shl    $0x4,%rax
+  8000bb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 01 d0             	add    %rdx,%rax
+  8000c8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000cf:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d2:	45 85 ed             	test   %r13d,%r13d
+  8000d5:	7e 0d                	jle    8000e4 <libmain+0x87>
+  8000d7:	49 8b 06             	mov    (%r14),%rax
+  8000da:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000e1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e4:	4c 89 f6             	mov    %r14,%rsi
+  8000e7:	44 89 ef             	mov    %r13d,%edi
+  8000ea:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f6:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  8000fd:	00 00 00 
+  800100:	ff d0                	call   *%rax
+#endif
+}
+  800102:	5b                   	pop    %rbx
+  800103:	41 5c                	pop    %r12
+  800105:	41 5d                	pop    %r13
+  800107:	41 5e                	pop    %r14
+  800109:	5d                   	pop    %rbp
+  80010a:	c3                   	ret
+
+000000000080010b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80010b:	55                   	push   %rbp
+  80010c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010f:	48 b8 82 17 80 00 00 	movabs $0x801782,%rax
+  800116:	00 00 00 
+  800119:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80011b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800120:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+}
+  80012c:	5d                   	pop    %rbp
+  80012d:	c3                   	ret
+
+000000000080012e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80012e:	55                   	push   %rbp
+  80012f:	48 89 e5             	mov    %rsp,%rbp
+  800132:	53                   	push   %rbx
+  800133:	48 83 ec 08          	sub    $0x8,%rsp
+  800137:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80013a:	8b 06                	mov    (%rsi),%eax
+  80013c:	8d 50 01             	lea    0x1(%rax),%edx
+  80013f:	89 16                	mov    %edx,(%rsi)
+  800141:	48 98                	cltq
+  800143:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800148:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80014e:	74 0a                	je     80015a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800150:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800154:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80015a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80015e:	be ff 00 00 00       	mov    $0xff,%esi
+  800163:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800175:	eb d9                	jmp    800150 <putch+0x22>
+
+0000000000800177 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800177:	55                   	push   %rbp
+  800178:	48 89 e5             	mov    %rsp,%rbp
+  80017b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800182:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800185:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80018c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800199:	48 89 f1             	mov    %rsi,%rcx
+  80019c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001a3:	48 bf 2e 01 80 00 00 	movabs $0x80012e,%rdi
+  8001aa:	00 00 00 
+  8001ad:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001c0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c7:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  8001ce:	00 00 00 
+  8001d1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001d3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+00000000008001db <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001db:	55                   	push   %rbp
+  8001dc:	48 89 e5             	mov    %rsp,%rbp
+  8001df:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800202:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800206:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80020a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80020e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800212:	48 b8 77 01 80 00 00 	movabs $0x800177,%rax
+  800219:	00 00 00 
+  80021c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80021e:	c9                   	leave
+  80021f:	c3                   	ret
+
+0000000000800220 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800220:	55                   	push   %rbp
+  800221:	48 89 e5             	mov    %rsp,%rbp
+  800224:	41 57                	push   %r15
+  800226:	41 56                	push   %r14
+  800228:	41 55                	push   %r13
+  80022a:	41 54                	push   %r12
+  80022c:	53                   	push   %rbx
+  80022d:	48 83 ec 18          	sub    $0x18,%rsp
+  800231:	49 89 fc             	mov    %rdi,%r12
+  800234:	49 89 f5             	mov    %rsi,%r13
+  800237:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80023b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80023e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800241:	41 89 cf             	mov    %ecx,%r15d
+  800244:	4c 39 fa             	cmp    %r15,%rdx
+  800247:	73 5b                	jae    8002a4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800249:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80024d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800251:	85 db                	test   %ebx,%ebx
+  800253:	7e 0e                	jle    800263 <print_num+0x43>
+            putch(padc, put_arg);
+  800255:	4c 89 ee             	mov    %r13,%rsi
+  800258:	44 89 f7             	mov    %r14d,%edi
+  80025b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80025e:	83 eb 01             	sub    $0x1,%ebx
+  800261:	75 f2                	jne    800255 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800263:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800267:	48 b9 e4 36 80 00 00 	movabs $0x8036e4,%rcx
+  80026e:	00 00 00 
+  800271:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  800278:	00 00 00 
+  80027b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800283:	ba 00 00 00 00       	mov    $0x0,%edx
+  800288:	49 f7 f7             	div    %r15
+  80028b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028f:	4c 89 ee             	mov    %r13,%rsi
+  800292:	41 ff d4             	call   *%r12
+}
+  800295:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800299:	5b                   	pop    %rbx
+  80029a:	41 5c                	pop    %r12
+  80029c:	41 5d                	pop    %r13
+  80029e:	41 5e                	pop    %r14
+  8002a0:	41 5f                	pop    %r15
+  8002a2:	5d                   	pop    %rbp
+  8002a3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ad:	49 f7 f7             	div    %r15
+  8002b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b8:	52                   	push   %rdx
+  8002b9:	45 0f be c9          	movsbl %r9b,%r9d
+  8002bd:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002c1:	48 89 c2             	mov    %rax,%rdx
+  8002c4:	48 b8 20 02 80 00 00 	movabs $0x800220,%rax
+  8002cb:	00 00 00 
+  8002ce:	ff d0                	call   *%rax
+  8002d0:	48 83 c4 10          	add    $0x10,%rsp
+  8002d4:	eb 8d                	jmp    800263 <print_num+0x43>
+
+00000000008002d6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002da:	48 8b 06             	mov    (%rsi),%rax
+  8002dd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002e1:	73 0a                	jae    8002ed <sprintputch+0x17>
+        *state->start++ = ch;
+  8002e3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e7:	48 89 16             	mov    %rdx,(%rsi)
+  8002ea:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002ed:	c3                   	ret
+
+00000000008002ee <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002ee:	55                   	push   %rbp
+  8002ef:	48 89 e5             	mov    %rsp,%rbp
+  8002f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002fa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002fe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800302:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800309:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800311:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800315:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800319:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80031d:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+}
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+
+000000000080032b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	41 57                	push   %r15
+  800331:	41 56                	push   %r14
+  800333:	41 55                	push   %r13
+  800335:	41 54                	push   %r12
+  800337:	53                   	push   %rbx
+  800338:	48 83 ec 38          	sub    $0x38,%rsp
+  80033c:	49 89 fe             	mov    %rdi,%r14
+  80033f:	49 89 f5             	mov    %rsi,%r13
+  800342:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800345:	48 8b 01             	mov    (%rcx),%rax
+  800348:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80034c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800354:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800358:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80035c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800360:	0f b6 3b             	movzbl (%rbx),%edi
+  800363:	40 80 ff 25          	cmp    $0x25,%dil
+  800367:	74 18                	je     800381 <vprintfmt+0x56>
+            if (!ch) return;
+  800369:	40 84 ff             	test   %dil,%dil
+  80036c:	0f 84 b1 06 00 00    	je     800a23 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800372:	40 0f b6 ff          	movzbl %dil,%edi
+  800376:	4c 89 ee             	mov    %r13,%rsi
+  800379:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80037c:	4c 89 e3             	mov    %r12,%rbx
+  80037f:	eb db                	jmp    80035c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800381:	be 00 00 00 00       	mov    $0x0,%esi
+  800386:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80038a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800395:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80039c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003a0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003aa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ad:	83 e8 23             	sub    $0x23,%eax
+  8003b0:	3c 57                	cmp    $0x57,%al
+  8003b2:	0f 87 51 06 00 00    	ja     800a09 <vprintfmt+0x6de>
+  8003b8:	0f b6 c0             	movzbl %al,%eax
+  8003bb:	48 b9 80 38 80 00 00 	movabs $0x803880,%rcx
+  8003c2:	00 00 00 
+  8003c5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003cb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003cf:	eb cf                	jmp    8003a0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003d1:	49 89 dc             	mov    %rbx,%r12
+  8003d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d9:	eb c5                	jmp    8003a0 <vprintfmt+0x75>
+            padc = ch;
+  8003db:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003df:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e5:	eb b9                	jmp    8003a0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8003ed:	77 24                	ja     800413 <vprintfmt+0xe8>
+  8003ef:	89 c1                	mov    %eax,%ecx
+  8003f1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f5:	83 c0 08             	add    $0x8,%eax
+  8003f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003fb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003fe:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800401:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800405:	79 99                	jns    8003a0 <vprintfmt+0x75>
+                width = precision;
+  800407:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80040b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800411:	eb 8d                	jmp    8003a0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800413:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800417:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80041b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041f:	eb da                	jmp    8003fb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800421:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800426:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800430:	3c 39                	cmp    $0x39,%al
+  800432:	77 1c                	ja     800450 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800434:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800438:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80043c:	0f b6 c0             	movzbl %al,%eax
+  80043f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800444:	0f b6 03             	movzbl (%rbx),%eax
+  800447:	3c 39                	cmp    $0x39,%al
+  800449:	76 e9                	jbe    800434 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80044b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80044e:	eb b1                	jmp    800401 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800450:	49 89 dc             	mov    %rbx,%r12
+  800453:	eb ac                	jmp    800401 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800455:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800458:	85 c9                	test   %ecx,%ecx
+  80045a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045f:	0f 49 c1             	cmovns %ecx,%eax
+  800462:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800465:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800468:	e9 33 ff ff ff       	jmp    8003a0 <vprintfmt+0x75>
+            lflag++;
+  80046d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800470:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800473:	e9 28 ff ff ff       	jmp    8003a0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800478:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80047b:	83 f8 2f             	cmp    $0x2f,%eax
+  80047e:	77 19                	ja     800499 <vprintfmt+0x16e>
+  800480:	89 c2                	mov    %eax,%edx
+  800482:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800486:	83 c0 08             	add    $0x8,%eax
+  800489:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80048c:	8b 3a                	mov    (%rdx),%edi
+  80048e:	4c 89 ee             	mov    %r13,%rsi
+  800491:	41 ff d6             	call   *%r14
+            break;
+  800494:	e9 c3 fe ff ff       	jmp    80035c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800499:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80049d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a5:	eb e5                	jmp    80048c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ad:	77 5a                	ja     800509 <vprintfmt+0x1de>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b5:	83 c0 08             	add    $0x8,%eax
+  8004b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004bb:	8b 02                	mov    (%rdx),%eax
+  8004bd:	89 c1                	mov    %eax,%ecx
+  8004bf:	f7 d9                	neg    %ecx
+  8004c1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c4:	83 f9 14             	cmp    $0x14,%ecx
+  8004c7:	7f 4e                	jg     800517 <vprintfmt+0x1ec>
+  8004c9:	48 63 c1             	movslq %ecx,%rax
+  8004cc:	48 ba 40 3b 80 00 00 	movabs $0x803b40,%rdx
+  8004d3:	00 00 00 
+  8004d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004da:	48 85 c0             	test   %rax,%rax
+  8004dd:	74 38                	je     800517 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004df:	48 89 c1             	mov    %rax,%rcx
+  8004e2:	48 ba 19 3d 80 00 00 	movabs $0x803d19,%rdx
+  8004e9:	00 00 00 
+  8004ec:	4c 89 ee             	mov    %r13,%rsi
+  8004ef:	4c 89 f7             	mov    %r14,%rdi
+  8004f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f7:	49 b8 ee 02 80 00 00 	movabs $0x8002ee,%r8
+  8004fe:	00 00 00 
+  800501:	41 ff d0             	call   *%r8
+  800504:	e9 53 fe ff ff       	jmp    80035c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800509:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80050d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800511:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800515:	eb a4                	jmp    8004bb <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800517:	48 ba fc 36 80 00 00 	movabs $0x8036fc,%rdx
+  80051e:	00 00 00 
+  800521:	4c 89 ee             	mov    %r13,%rsi
+  800524:	4c 89 f7             	mov    %r14,%rdi
+  800527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052c:	49 b8 ee 02 80 00 00 	movabs $0x8002ee,%r8
+  800533:	00 00 00 
+  800536:	41 ff d0             	call   *%r8
+  800539:	e9 1e fe ff ff       	jmp    80035c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80053e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800541:	83 f8 2f             	cmp    $0x2f,%eax
+  800544:	77 6c                	ja     8005b2 <vprintfmt+0x287>
+  800546:	89 c2                	mov    %eax,%edx
+  800548:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054c:	83 c0 08             	add    $0x8,%eax
+  80054f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800552:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800555:	48 85 d2             	test   %rdx,%rdx
+  800558:	48 b8 f5 36 80 00 00 	movabs $0x8036f5,%rax
+  80055f:	00 00 00 
+  800562:	48 0f 45 c2          	cmovne %rdx,%rax
+  800566:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80056a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80056e:	7e 06                	jle    800576 <vprintfmt+0x24b>
+  800570:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800574:	75 4a                	jne    8005c0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800576:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80057a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80057e:	0f b6 00             	movzbl (%rax),%eax
+  800581:	84 c0                	test   %al,%al
+  800583:	0f 85 9a 00 00 00    	jne    800623 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800589:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80058c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800590:	85 c0                	test   %eax,%eax
+  800592:	0f 8e c4 fd ff ff    	jle    80035c <vprintfmt+0x31>
+  800598:	4c 89 ee             	mov    %r13,%rsi
+  80059b:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005a0:	41 ff d6             	call   *%r14
+  8005a3:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005ab:	75 eb                	jne    800598 <vprintfmt+0x26d>
+  8005ad:	e9 aa fd ff ff       	jmp    80035c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005be:	eb 92                	jmp    800552 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005c0:	49 63 f7             	movslq %r15d,%rsi
+  8005c3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c7:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  8005ce:	00 00 00 
+  8005d1:	ff d0                	call   *%rax
+  8005d3:	48 89 c2             	mov    %rax,%rdx
+  8005d6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005db:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005de:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	7e 91                	jle    800576 <vprintfmt+0x24b>
+  8005e5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005ea:	4c 89 ee             	mov    %r13,%rsi
+  8005ed:	44 89 e7             	mov    %r12d,%edi
+  8005f0:	41 ff d6             	call   *%r14
+  8005f3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005fd:	75 eb                	jne    8005ea <vprintfmt+0x2bf>
+  8005ff:	e9 72 ff ff ff       	jmp    800576 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800604:	0f b6 f8             	movzbl %al,%edi
+  800607:	4c 89 ee             	mov    %r13,%rsi
+  80060a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80060d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800611:	49 83 c4 01          	add    $0x1,%r12
+  800615:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80061b:	84 c0                	test   %al,%al
+  80061d:	0f 84 66 ff ff ff    	je     800589 <vprintfmt+0x25e>
+  800623:	45 85 ff             	test   %r15d,%r15d
+  800626:	78 0a                	js     800632 <vprintfmt+0x307>
+  800628:	41 83 ef 01          	sub    $0x1,%r15d
+  80062c:	0f 88 57 ff ff ff    	js     800589 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800632:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800636:	74 cc                	je     800604 <vprintfmt+0x2d9>
+  800638:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80063b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800640:	80 fa 5e             	cmp    $0x5e,%dl
+  800643:	77 c2                	ja     800607 <vprintfmt+0x2dc>
+  800645:	eb bd                	jmp    800604 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800647:	40 84 f6             	test   %sil,%sil
+  80064a:	75 26                	jne    800672 <vprintfmt+0x347>
+    switch (lflag) {
+  80064c:	85 d2                	test   %edx,%edx
+  80064e:	74 59                	je     8006a9 <vprintfmt+0x37e>
+  800650:	83 fa 01             	cmp    $0x1,%edx
+  800653:	74 7b                	je     8006d0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800655:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800658:	83 f8 2f             	cmp    $0x2f,%eax
+  80065b:	0f 87 96 00 00 00    	ja     8006f7 <vprintfmt+0x3cc>
+  800661:	89 c2                	mov    %eax,%edx
+  800663:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800667:	83 c0 08             	add    $0x8,%eax
+  80066a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066d:	4c 8b 22             	mov    (%rdx),%r12
+  800670:	eb 17                	jmp    800689 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800672:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800675:	83 f8 2f             	cmp    $0x2f,%eax
+  800678:	77 21                	ja     80069b <vprintfmt+0x370>
+  80067a:	89 c2                	mov    %eax,%edx
+  80067c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800680:	83 c0 08             	add    $0x8,%eax
+  800683:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800686:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800689:	4d 85 e4             	test   %r12,%r12
+  80068c:	78 7a                	js     800708 <vprintfmt+0x3dd>
+            num = i;
+  80068e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800691:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800696:	e9 50 02 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80069b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a7:	eb dd                	jmp    800686 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8006af:	77 11                	ja     8006c2 <vprintfmt+0x397>
+  8006b1:	89 c2                	mov    %eax,%edx
+  8006b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b7:	83 c0 08             	add    $0x8,%eax
+  8006ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bd:	4c 63 22             	movslq (%rdx),%r12
+  8006c0:	eb c7                	jmp    800689 <vprintfmt+0x35e>
+  8006c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ce:	eb ed                	jmp    8006bd <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d6:	77 11                	ja     8006e9 <vprintfmt+0x3be>
+  8006d8:	89 c2                	mov    %eax,%edx
+  8006da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006de:	83 c0 08             	add    $0x8,%eax
+  8006e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e4:	4c 8b 22             	mov    (%rdx),%r12
+  8006e7:	eb a0                	jmp    800689 <vprintfmt+0x35e>
+  8006e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f5:	eb ed                	jmp    8006e4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800703:	e9 65 ff ff ff       	jmp    80066d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800708:	4c 89 ee             	mov    %r13,%rsi
+  80070b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800710:	41 ff d6             	call   *%r14
+                i = -i;
+  800713:	49 f7 dc             	neg    %r12
+  800716:	e9 73 ff ff ff       	jmp    80068e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80071b:	40 84 f6             	test   %sil,%sil
+  80071e:	75 32                	jne    800752 <vprintfmt+0x427>
+    switch (lflag) {
+  800720:	85 d2                	test   %edx,%edx
+  800722:	74 5d                	je     800781 <vprintfmt+0x456>
+  800724:	83 fa 01             	cmp    $0x1,%edx
+  800727:	0f 84 82 00 00 00    	je     8007af <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80072d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800730:	83 f8 2f             	cmp    $0x2f,%eax
+  800733:	0f 87 a5 00 00 00    	ja     8007de <vprintfmt+0x4b3>
+  800739:	89 c2                	mov    %eax,%edx
+  80073b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073f:	83 c0 08             	add    $0x8,%eax
+  800742:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800745:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800748:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80074d:	e9 99 01 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800752:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800755:	83 f8 2f             	cmp    $0x2f,%eax
+  800758:	77 19                	ja     800773 <vprintfmt+0x448>
+  80075a:	89 c2                	mov    %eax,%edx
+  80075c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800760:	83 c0 08             	add    $0x8,%eax
+  800763:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800766:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800769:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80076e:	e9 78 01 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+  800773:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800777:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077f:	eb e5                	jmp    800766 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	77 18                	ja     8007a1 <vprintfmt+0x476>
+  800789:	89 c2                	mov    %eax,%edx
+  80078b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078f:	83 c0 08             	add    $0x8,%eax
+  800792:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800795:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800797:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80079c:	e9 4a 01 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+  8007a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ad:	eb e6                	jmp    800795 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b5:	77 19                	ja     8007d0 <vprintfmt+0x4a5>
+  8007b7:	89 c2                	mov    %eax,%edx
+  8007b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bd:	83 c0 08             	add    $0x8,%eax
+  8007c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007cb:	e9 1b 01 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+  8007d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dc:	eb e5                	jmp    8007c3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	e9 56 ff ff ff       	jmp    800745 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ef:	40 84 f6             	test   %sil,%sil
+  8007f2:	75 2e                	jne    800822 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007f4:	85 d2                	test   %edx,%edx
+  8007f6:	74 59                	je     800851 <vprintfmt+0x526>
+  8007f8:	83 fa 01             	cmp    $0x1,%edx
+  8007fb:	74 7f                	je     80087c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800800:	83 f8 2f             	cmp    $0x2f,%eax
+  800803:	0f 87 9f 00 00 00    	ja     8008a8 <vprintfmt+0x57d>
+  800809:	89 c2                	mov    %eax,%edx
+  80080b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080f:	83 c0 08             	add    $0x8,%eax
+  800812:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800815:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800818:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80081d:	e9 c9 00 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800822:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800825:	83 f8 2f             	cmp    $0x2f,%eax
+  800828:	77 19                	ja     800843 <vprintfmt+0x518>
+  80082a:	89 c2                	mov    %eax,%edx
+  80082c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800830:	83 c0 08             	add    $0x8,%eax
+  800833:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800836:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800839:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80083e:	e9 a8 00 00 00       	jmp    8008eb <vprintfmt+0x5c0>
+  800843:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800847:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084f:	eb e5                	jmp    800836 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800851:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 15                	ja     80086e <vprintfmt+0x543>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800867:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80086c:	eb 7d                	jmp    8008eb <vprintfmt+0x5c0>
+  80086e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800872:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800876:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087a:	eb e9                	jmp    800865 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80087c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087f:	83 f8 2f             	cmp    $0x2f,%eax
+  800882:	77 16                	ja     80089a <vprintfmt+0x56f>
+  800884:	89 c2                	mov    %eax,%edx
+  800886:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088a:	83 c0 08             	add    $0x8,%eax
+  80088d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800890:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800893:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800898:	eb 51                	jmp    8008eb <vprintfmt+0x5c0>
+  80089a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a6:	eb e8                	jmp    800890 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	e9 5c ff ff ff       	jmp    800815 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008c1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008c4:	4c 89 ee             	mov    %r13,%rsi
+  8008c7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008cc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d5:	77 47                	ja     80091e <vprintfmt+0x5f3>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ef:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008f3:	0f 94 c0             	sete   %al
+  8008f6:	0f b6 c0             	movzbl %al,%eax
+  8008f9:	50                   	push   %rax
+  8008fa:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ff:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800903:	4c 89 ee             	mov    %r13,%rsi
+  800906:	4c 89 f7             	mov    %r14,%rdi
+  800909:	48 b8 20 02 80 00 00 	movabs $0x800220,%rax
+  800910:	00 00 00 
+  800913:	ff d0                	call   *%rax
+            break;
+  800915:	48 83 c4 10          	add    $0x10,%rsp
+  800919:	e9 3e fa ff ff       	jmp    80035c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80091e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800922:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800926:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092a:	eb b7                	jmp    8008e3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80092c:	40 84 f6             	test   %sil,%sil
+  80092f:	75 2b                	jne    80095c <vprintfmt+0x631>
+    switch (lflag) {
+  800931:	85 d2                	test   %edx,%edx
+  800933:	74 56                	je     80098b <vprintfmt+0x660>
+  800935:	83 fa 01             	cmp    $0x1,%edx
+  800938:	74 7f                	je     8009b9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80093a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093d:	83 f8 2f             	cmp    $0x2f,%eax
+  800940:	0f 87 a2 00 00 00    	ja     8009e8 <vprintfmt+0x6bd>
+  800946:	89 c2                	mov    %eax,%edx
+  800948:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094c:	83 c0 08             	add    $0x8,%eax
+  80094f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800952:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800955:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80095a:	eb 8f                	jmp    8008eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095f:	83 f8 2f             	cmp    $0x2f,%eax
+  800962:	77 19                	ja     80097d <vprintfmt+0x652>
+  800964:	89 c2                	mov    %eax,%edx
+  800966:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096a:	83 c0 08             	add    $0x8,%eax
+  80096d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800970:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800973:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800978:	e9 6e ff ff ff       	jmp    8008eb <vprintfmt+0x5c0>
+  80097d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800981:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800989:	eb e5                	jmp    800970 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	77 18                	ja     8009ab <vprintfmt+0x680>
+  800993:	89 c2                	mov    %eax,%edx
+  800995:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800999:	83 c0 08             	add    $0x8,%eax
+  80099c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a6:	e9 40 ff ff ff       	jmp    8008eb <vprintfmt+0x5c0>
+  8009ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b7:	eb e6                	jmp    80099f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bf:	77 19                	ja     8009da <vprintfmt+0x6af>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c7:	83 c0 08             	add    $0x8,%eax
+  8009ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d5:	e9 11 ff ff ff       	jmp    8008eb <vprintfmt+0x5c0>
+  8009da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e6:	eb e5                	jmp    8009cd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	e9 59 ff ff ff       	jmp    800952 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f9:	4c 89 ee             	mov    %r13,%rsi
+  8009fc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a01:	41 ff d6             	call   *%r14
+            break;
+  800a04:	e9 53 f9 ff ff       	jmp    80035c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a09:	4c 89 ee             	mov    %r13,%rsi
+  800a0c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a11:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a14:	48 83 eb 01          	sub    $0x1,%rbx
+  800a18:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a1c:	75 f6                	jne    800a14 <vprintfmt+0x6e9>
+  800a1e:	e9 39 f9 ff ff       	jmp    80035c <vprintfmt+0x31>
+}
+  800a23:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a27:	5b                   	pop    %rbx
+  800a28:	41 5c                	pop    %r12
+  800a2a:	41 5d                	pop    %r13
+  800a2c:	41 5e                	pop    %r14
+  800a2e:	41 5f                	pop    %r15
+  800a30:	5d                   	pop    %rbp
+  800a31:	c3                   	ret
+
+0000000000800a32 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a32:	55                   	push   %rbp
+  800a33:	48 89 e5             	mov    %rsp,%rbp
+  800a36:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a47:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a4e:	48 85 ff             	test   %rdi,%rdi
+  800a51:	74 2b                	je     800a7e <vsnprintf+0x4c>
+  800a53:	48 85 f6             	test   %rsi,%rsi
+  800a56:	74 26                	je     800a7e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a5c:	48 bf d6 02 80 00 00 	movabs $0x8002d6,%rdi
+  800a63:	00 00 00 
+  800a66:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  800a6d:	00 00 00 
+  800a70:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a76:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a79:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a83:	eb f7                	jmp    800a7c <vsnprintf+0x4a>
+
+0000000000800a85 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a85:	55                   	push   %rbp
+  800a86:	48 89 e5             	mov    %rsp,%rbp
+  800a89:	48 83 ec 50          	sub    $0x50,%rsp
+  800a8d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a91:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a95:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a99:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ab0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab4:	48 b8 32 0a 80 00 00 	movabs $0x800a32,%rax
+  800abb:	00 00 00 
+  800abe:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ac0:	c9                   	leave
+  800ac1:	c3                   	ret
+
+0000000000800ac2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ac2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ac5:	74 10                	je     800ad7 <strlen+0x15>
+    size_t n = 0;
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800acc:	48 83 c0 01          	add    $0x1,%rax
+  800ad0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad4:	75 f6                	jne    800acc <strlen+0xa>
+  800ad6:	c3                   	ret
+    size_t n = 0;
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800adc:	c3                   	ret
+
+0000000000800add <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800add:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ae5:	48 85 f6             	test   %rsi,%rsi
+  800ae8:	74 11                	je     800afb <strnlen+0x1e>
+  800aea:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800aee:	74 0c                	je     800afc <strnlen+0x1f>
+  800af0:	48 83 c2 01          	add    $0x1,%rdx
+  800af4:	48 39 d0             	cmp    %rdx,%rax
+  800af7:	75 f1                	jne    800aea <strnlen+0xd>
+  800af9:	eb 04                	jmp    800aff <strnlen+0x22>
+  800afb:	c3                   	ret
+  800afc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aff:	c3                   	ret
+
+0000000000800b00 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b00:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b08:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b0c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b0f:	48 83 c2 01          	add    $0x1,%rdx
+  800b13:	84 c9                	test   %cl,%cl
+  800b15:	75 f1                	jne    800b08 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b17:	c3                   	ret
+
+0000000000800b18 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b18:	55                   	push   %rbp
+  800b19:	48 89 e5             	mov    %rsp,%rbp
+  800b1c:	41 54                	push   %r12
+  800b1e:	53                   	push   %rbx
+  800b1f:	48 89 fb             	mov    %rdi,%rbx
+  800b22:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b25:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  800b2c:	00 00 00 
+  800b2f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b31:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b35:	4c 89 e6             	mov    %r12,%rsi
+  800b38:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  800b3f:	00 00 00 
+  800b42:	ff d0                	call   *%rax
+    return dst;
+}
+  800b44:	48 89 d8             	mov    %rbx,%rax
+  800b47:	5b                   	pop    %rbx
+  800b48:	41 5c                	pop    %r12
+  800b4a:	5d                   	pop    %rbp
+  800b4b:	c3                   	ret
+
+0000000000800b4c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b4c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b4f:	48 85 d2             	test   %rdx,%rdx
+  800b52:	74 1f                	je     800b73 <strncpy+0x27>
+  800b54:	48 01 fa             	add    %rdi,%rdx
+  800b57:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b5a:	48 83 c1 01          	add    $0x1,%rcx
+  800b5e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b62:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b66:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b6a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b6e:	48 39 ca             	cmp    %rcx,%rdx
+  800b71:	75 e7                	jne    800b5a <strncpy+0xe>
+    }
+    return ret;
+}
+  800b73:	c3                   	ret
+
+0000000000800b74 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b74:	48 89 f8             	mov    %rdi,%rax
+  800b77:	48 85 d2             	test   %rdx,%rdx
+  800b7a:	74 24                	je     800ba0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b7c:	48 83 ea 01          	sub    $0x1,%rdx
+  800b80:	74 1b                	je     800b9d <strlcpy+0x29>
+  800b82:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b86:	0f b6 16             	movzbl (%rsi),%edx
+  800b89:	84 d2                	test   %dl,%dl
+  800b8b:	74 10                	je     800b9d <strlcpy+0x29>
+            *dst++ = *src++;
+  800b8d:	48 83 c6 01          	add    $0x1,%rsi
+  800b91:	48 83 c0 01          	add    $0x1,%rax
+  800b95:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b98:	48 39 c8             	cmp    %rcx,%rax
+  800b9b:	75 e9                	jne    800b86 <strlcpy+0x12>
+        *dst = '\0';
+  800b9d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ba0:	48 29 f8             	sub    %rdi,%rax
+}
+  800ba3:	c3                   	ret
+
+0000000000800ba4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ba4:	0f b6 07             	movzbl (%rdi),%eax
+  800ba7:	84 c0                	test   %al,%al
+  800ba9:	74 13                	je     800bbe <strcmp+0x1a>
+  800bab:	38 06                	cmp    %al,(%rsi)
+  800bad:	75 0f                	jne    800bbe <strcmp+0x1a>
+  800baf:	48 83 c7 01          	add    $0x1,%rdi
+  800bb3:	48 83 c6 01          	add    $0x1,%rsi
+  800bb7:	0f b6 07             	movzbl (%rdi),%eax
+  800bba:	84 c0                	test   %al,%al
+  800bbc:	75 ed                	jne    800bab <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bbe:	0f b6 c0             	movzbl %al,%eax
+  800bc1:	0f b6 16             	movzbl (%rsi),%edx
+  800bc4:	29 d0                	sub    %edx,%eax
+}
+  800bc6:	c3                   	ret
+
+0000000000800bc7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc7:	48 85 d2             	test   %rdx,%rdx
+  800bca:	74 1f                	je     800beb <strncmp+0x24>
+  800bcc:	0f b6 07             	movzbl (%rdi),%eax
+  800bcf:	84 c0                	test   %al,%al
+  800bd1:	74 1e                	je     800bf1 <strncmp+0x2a>
+  800bd3:	3a 06                	cmp    (%rsi),%al
+  800bd5:	75 1a                	jne    800bf1 <strncmp+0x2a>
+  800bd7:	48 83 c7 01          	add    $0x1,%rdi
+  800bdb:	48 83 c6 01          	add    $0x1,%rsi
+  800bdf:	48 83 ea 01          	sub    $0x1,%rdx
+  800be3:	75 e7                	jne    800bcc <strncmp+0x5>
+
+    if (!n) return 0;
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	c3                   	ret
+  800beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf0:	c3                   	ret
+  800bf1:	48 85 d2             	test   %rdx,%rdx
+  800bf4:	74 09                	je     800bff <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf6:	0f b6 07             	movzbl (%rdi),%eax
+  800bf9:	0f b6 16             	movzbl (%rsi),%edx
+  800bfc:	29 d0                	sub    %edx,%eax
+  800bfe:	c3                   	ret
+    if (!n) return 0;
+  800bff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c04:	c3                   	ret
+
+0000000000800c05 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c05:	0f b6 17             	movzbl (%rdi),%edx
+  800c08:	84 d2                	test   %dl,%dl
+  800c0a:	74 18                	je     800c24 <strchr+0x1f>
+        if (*str == c) {
+  800c0c:	0f be d2             	movsbl %dl,%edx
+  800c0f:	39 f2                	cmp    %esi,%edx
+  800c11:	74 17                	je     800c2a <strchr+0x25>
+    for (; *str; str++) {
+  800c13:	48 83 c7 01          	add    $0x1,%rdi
+  800c17:	0f b6 17             	movzbl (%rdi),%edx
+  800c1a:	84 d2                	test   %dl,%dl
+  800c1c:	75 ee                	jne    800c0c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c23:	c3                   	ret
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	c3                   	ret
+  800c2a:	48 89 f8             	mov    %rdi,%rax
+}
+  800c2d:	c3                   	ret
+
+0000000000800c2e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c2e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c31:	0f b6 17             	movzbl (%rdi),%edx
+  800c34:	84 d2                	test   %dl,%dl
+  800c36:	74 13                	je     800c4b <strfind+0x1d>
+  800c38:	0f be d2             	movsbl %dl,%edx
+  800c3b:	39 f2                	cmp    %esi,%edx
+  800c3d:	74 0b                	je     800c4a <strfind+0x1c>
+  800c3f:	48 83 c0 01          	add    $0x1,%rax
+  800c43:	0f b6 10             	movzbl (%rax),%edx
+  800c46:	84 d2                	test   %dl,%dl
+  800c48:	75 ee                	jne    800c38 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c4a:	c3                   	ret
+  800c4b:	c3                   	ret
+
+0000000000800c4c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c4c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c4f:	48 89 f8             	mov    %rdi,%rax
+  800c52:	48 f7 d8             	neg    %rax
+  800c55:	83 e0 07             	and    $0x7,%eax
+  800c58:	49 89 d1             	mov    %rdx,%r9
+  800c5b:	49 29 c1             	sub    %rax,%r9
+  800c5e:	78 36                	js     800c96 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c60:	40 0f b6 c6          	movzbl %sil,%eax
+  800c64:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c6b:	01 01 01 
+  800c6e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c72:	40 f6 c7 07          	test   $0x7,%dil
+  800c76:	75 38                	jne    800cb0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c78:	4c 89 c9             	mov    %r9,%rcx
+  800c7b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c7f:	74 0c                	je     800c8d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c81:	fc                   	cld
+  800c82:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c85:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c89:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c8d:	4d 85 c9             	test   %r9,%r9
+  800c90:	75 45                	jne    800cd7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c92:	4c 89 c0             	mov    %r8,%rax
+  800c95:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c96:	48 85 d2             	test   %rdx,%rdx
+  800c99:	74 f7                	je     800c92 <memset+0x46>
+  800c9b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c9e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ca1:	48 83 c0 01          	add    $0x1,%rax
+  800ca5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca9:	48 39 c2             	cmp    %rax,%rdx
+  800cac:	75 f3                	jne    800ca1 <memset+0x55>
+  800cae:	eb e2                	jmp    800c92 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cb0:	40 f6 c7 01          	test   $0x1,%dil
+  800cb4:	74 06                	je     800cbc <memset+0x70>
+  800cb6:	88 07                	mov    %al,(%rdi)
+  800cb8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cbc:	40 f6 c7 02          	test   $0x2,%dil
+  800cc0:	74 07                	je     800cc9 <memset+0x7d>
+  800cc2:	66 89 07             	mov    %ax,(%rdi)
+  800cc5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc9:	40 f6 c7 04          	test   $0x4,%dil
+  800ccd:	74 a9                	je     800c78 <memset+0x2c>
+  800ccf:	89 07                	mov    %eax,(%rdi)
+  800cd1:	48 83 c7 04          	add    $0x4,%rdi
+  800cd5:	eb a1                	jmp    800c78 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd7:	41 f6 c1 04          	test   $0x4,%r9b
+  800cdb:	74 06                	je     800ce3 <memset+0x97>
+  800cdd:	89 07                	mov    %eax,(%rdi)
+  800cdf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ce3:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce7:	74 07                	je     800cf0 <memset+0xa4>
+  800ce9:	66 89 07             	mov    %ax,(%rdi)
+  800cec:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cf0:	41 f6 c1 01          	test   $0x1,%r9b
+  800cf4:	74 9c                	je     800c92 <memset+0x46>
+  800cf6:	88 07                	mov    %al,(%rdi)
+  800cf8:	eb 98                	jmp    800c92 <memset+0x46>
+
+0000000000800cfa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cfa:	48 89 f8             	mov    %rdi,%rax
+  800cfd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d00:	48 39 fe             	cmp    %rdi,%rsi
+  800d03:	73 3b                	jae    800d40 <memmove+0x46>
+  800d05:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d09:	48 39 d7             	cmp    %rdx,%rdi
+  800d0c:	73 32                	jae    800d40 <memmove+0x46>
+        s += n;
+        d += n;
+  800d0e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d12:	48 89 d6             	mov    %rdx,%rsi
+  800d15:	48 09 fe             	or     %rdi,%rsi
+  800d18:	48 09 ce             	or     %rcx,%rsi
+  800d1b:	40 f6 c6 07          	test   $0x7,%sil
+  800d1f:	75 12                	jne    800d33 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d21:	48 83 ef 08          	sub    $0x8,%rdi
+  800d25:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d29:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d2d:	fd                   	std
+  800d2e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d31:	fc                   	cld
+  800d32:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d33:	48 83 ef 01          	sub    $0x1,%rdi
+  800d37:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d3b:	fd                   	std
+  800d3c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d3e:	eb f1                	jmp    800d31 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d40:	48 89 f2             	mov    %rsi,%rdx
+  800d43:	48 09 c2             	or     %rax,%rdx
+  800d46:	48 09 ca             	or     %rcx,%rdx
+  800d49:	f6 c2 07             	test   $0x7,%dl
+  800d4c:	75 0c                	jne    800d5a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d4e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d52:	48 89 c7             	mov    %rax,%rdi
+  800d55:	fc                   	cld
+  800d56:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d59:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d5a:	48 89 c7             	mov    %rax,%rdi
+  800d5d:	fc                   	cld
+  800d5e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d60:	c3                   	ret
+
+0000000000800d61 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d61:	55                   	push   %rbp
+  800d62:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d65:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+}
+  800d71:	5d                   	pop    %rbp
+  800d72:	c3                   	ret
+
+0000000000800d73 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d73:	55                   	push   %rbp
+  800d74:	48 89 e5             	mov    %rsp,%rbp
+  800d77:	41 57                	push   %r15
+  800d79:	41 56                	push   %r14
+  800d7b:	41 55                	push   %r13
+  800d7d:	41 54                	push   %r12
+  800d7f:	53                   	push   %rbx
+  800d80:	48 83 ec 08          	sub    $0x8,%rsp
+  800d84:	49 89 fe             	mov    %rdi,%r14
+  800d87:	49 89 f7             	mov    %rsi,%r15
+  800d8a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d8d:	48 89 f7             	mov    %rsi,%rdi
+  800d90:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  800d97:	00 00 00 
+  800d9a:	ff d0                	call   *%rax
+  800d9c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d9f:	48 89 de             	mov    %rbx,%rsi
+  800da2:	4c 89 f7             	mov    %r14,%rdi
+  800da5:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  800dac:	00 00 00 
+  800daf:	ff d0                	call   *%rax
+  800db1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800db4:	48 39 c3             	cmp    %rax,%rbx
+  800db7:	74 36                	je     800def <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db9:	48 89 d8             	mov    %rbx,%rax
+  800dbc:	4c 29 e8             	sub    %r13,%rax
+  800dbf:	49 39 c4             	cmp    %rax,%r12
+  800dc2:	73 31                	jae    800df5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dc4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dcd:	4c 89 fe             	mov    %r15,%rsi
+  800dd0:	48 b8 61 0d 80 00 00 	movabs $0x800d61,%rax
+  800dd7:	00 00 00 
+  800dda:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ddc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800de0:	48 83 c4 08          	add    $0x8,%rsp
+  800de4:	5b                   	pop    %rbx
+  800de5:	41 5c                	pop    %r12
+  800de7:	41 5d                	pop    %r13
+  800de9:	41 5e                	pop    %r14
+  800deb:	41 5f                	pop    %r15
+  800ded:	5d                   	pop    %rbp
+  800dee:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800def:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800df3:	eb eb                	jmp    800de0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800df5:	48 83 eb 01          	sub    $0x1,%rbx
+  800df9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dfd:	48 89 da             	mov    %rbx,%rdx
+  800e00:	4c 89 fe             	mov    %r15,%rsi
+  800e03:	48 b8 61 0d 80 00 00 	movabs $0x800d61,%rax
+  800e0a:	00 00 00 
+  800e0d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e0f:	49 01 de             	add    %rbx,%r14
+  800e12:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e17:	eb c3                	jmp    800ddc <strlcat+0x69>
+
+0000000000800e19 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e19:	48 85 d2             	test   %rdx,%rdx
+  800e1c:	74 2d                	je     800e4b <memcmp+0x32>
+  800e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e23:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e27:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e2c:	44 38 c1             	cmp    %r8b,%cl
+  800e2f:	75 0f                	jne    800e40 <memcmp+0x27>
+    while (n-- > 0) {
+  800e31:	48 83 c0 01          	add    $0x1,%rax
+  800e35:	48 39 c2             	cmp    %rax,%rdx
+  800e38:	75 e9                	jne    800e23 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e40:	0f b6 c1             	movzbl %cl,%eax
+  800e43:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e47:	44 29 c0             	sub    %r8d,%eax
+  800e4a:	c3                   	ret
+    return 0;
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e50:	c3                   	ret
+
+0000000000800e51 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e51:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e55:	48 39 c7             	cmp    %rax,%rdi
+  800e58:	73 0f                	jae    800e69 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e5a:	40 38 37             	cmp    %sil,(%rdi)
+  800e5d:	74 0e                	je     800e6d <memfind+0x1c>
+    for (; src < end; src++) {
+  800e5f:	48 83 c7 01          	add    $0x1,%rdi
+  800e63:	48 39 f8             	cmp    %rdi,%rax
+  800e66:	75 f2                	jne    800e5a <memfind+0x9>
+  800e68:	c3                   	ret
+  800e69:	48 89 f8             	mov    %rdi,%rax
+  800e6c:	c3                   	ret
+  800e6d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e70:	c3                   	ret
+
+0000000000800e71 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e71:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e74:	0f b6 37             	movzbl (%rdi),%esi
+  800e77:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7b:	74 06                	je     800e83 <strtol+0x12>
+  800e7d:	40 80 fe 09          	cmp    $0x9,%sil
+  800e81:	75 13                	jne    800e96 <strtol+0x25>
+  800e83:	48 83 c7 01          	add    $0x1,%rdi
+  800e87:	0f b6 37             	movzbl (%rdi),%esi
+  800e8a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e8e:	74 f3                	je     800e83 <strtol+0x12>
+  800e90:	40 80 fe 09          	cmp    $0x9,%sil
+  800e94:	74 ed                	je     800e83 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e96:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e99:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e9c:	3c 01                	cmp    $0x1,%al
+  800e9e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ea2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea8:	75 0f                	jne    800eb9 <strtol+0x48>
+  800eaa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ead:	74 14                	je     800ec3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eaf:	85 d2                	test   %edx,%edx
+  800eb1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ebe:	4c 63 ca             	movslq %edx,%r9
+  800ec1:	eb 36                	jmp    800ef9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ec3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec7:	74 0f                	je     800ed8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec9:	85 d2                	test   %edx,%edx
+  800ecb:	75 ec                	jne    800eb9 <strtol+0x48>
+        s++;
+  800ecd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ed1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed6:	eb e1                	jmp    800eb9 <strtol+0x48>
+        s += 2;
+  800ed8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800edc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ee1:	eb d6                	jmp    800eb9 <strtol+0x48>
+            dig -= '0';
+  800ee3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee6:	44 0f b6 c1          	movzbl %cl,%r8d
+  800eea:	41 39 d0             	cmp    %edx,%r8d
+  800eed:	7d 21                	jge    800f10 <strtol+0x9f>
+        val = val * base + dig;
+  800eef:	49 0f af c1          	imul   %r9,%rax
+  800ef3:	0f b6 c9             	movzbl %cl,%ecx
+  800ef6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef9:	48 83 c7 01          	add    $0x1,%rdi
+  800efd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f01:	80 f9 39             	cmp    $0x39,%cl
+  800f04:	76 dd                	jbe    800ee3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f06:	80 f9 7b             	cmp    $0x7b,%cl
+  800f09:	77 05                	ja     800f10 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f0b:	83 e9 57             	sub    $0x57,%ecx
+  800f0e:	eb d6                	jmp    800ee6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f10:	4d 85 d2             	test   %r10,%r10
+  800f13:	74 03                	je     800f18 <strtol+0xa7>
+  800f15:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f18:	48 89 c2             	mov    %rax,%rdx
+  800f1b:	48 f7 da             	neg    %rdx
+  800f1e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f22:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f26:	c3                   	ret
+
+0000000000800f27 <strrev>:
+
+void
+strrev(char *str)
+{
+  800f27:	55                   	push   %rbp
+  800f28:	48 89 e5             	mov    %rsp,%rbp
+  800f2b:	53                   	push   %rbx
+  800f2c:	48 83 ec 08          	sub    $0x8,%rsp
+  800f30:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f33:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f3f:	83 e8 01             	sub    $0x1,%eax
+  800f42:	85 c0                	test   %eax,%eax
+  800f44:	7e 22                	jle    800f68 <strrev+0x41>
+  800f46:	48 98                	cltq
+  800f48:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f4d:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f51:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f55:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f59:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f5c:	48 83 c2 01          	add    $0x1,%rdx
+  800f60:	48 83 e8 01          	sub    $0x1,%rax
+  800f64:	39 c2                	cmp    %eax,%edx
+  800f66:	7c e5                	jl     800f4d <strrev+0x26>
+	}
+}
+  800f68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6c:	c9                   	leave
+  800f6d:	c3                   	ret
+
+0000000000800f6e <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f6e:	85 d2                	test   %edx,%edx
+  800f70:	0f 84 80 00 00 00    	je     800ff6 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f76:	55                   	push   %rbp
+  800f77:	48 89 e5             	mov    %rsp,%rbp
+  800f7a:	53                   	push   %rbx
+  800f7b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f7f:	49 89 f2             	mov    %rsi,%r10
+  800f82:	41 89 d3             	mov    %edx,%r11d
+  800f85:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f88:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800f8d:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800f90:	eb 20                	jmp    800fb2 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800f92:	41 89 f1             	mov    %esi,%r9d
+  800f95:	83 c2 30             	add    $0x30,%edx
+  800f98:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800f9b:	89 f8                	mov    %edi,%eax
+  800f9d:	99                   	cltd
+  800f9e:	f7 f9                	idiv   %ecx
+  800fa0:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800fa2:	85 c0                	test   %eax,%eax
+  800fa4:	74 2e                	je     800fd4 <itoa+0x66>
+  800fa6:	83 c6 01             	add    $0x1,%esi
+  800fa9:	49 83 c0 01          	add    $0x1,%r8
+  800fad:	44 39 cb             	cmp    %r9d,%ebx
+  800fb0:	7e 15                	jle    800fc7 <itoa+0x59>
+		digit = sum % base;
+  800fb2:	89 f8                	mov    %edi,%eax
+  800fb4:	99                   	cltd
+  800fb5:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fb7:	83 fa 09             	cmp    $0x9,%edx
+  800fba:	7e d6                	jle    800f92 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800fbc:	41 89 f1             	mov    %esi,%r9d
+  800fbf:	83 c2 37             	add    $0x37,%edx
+  800fc2:	41 88 10             	mov    %dl,(%r8)
+  800fc5:	eb d4                	jmp    800f9b <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fc7:	41 83 eb 01          	sub    $0x1,%r11d
+  800fcb:	45 39 cb             	cmp    %r9d,%r11d
+  800fce:	75 04                	jne    800fd4 <itoa+0x66>
+  800fd0:	85 c0                	test   %eax,%eax
+  800fd2:	75 28                	jne    800ffc <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fd4:	4d 63 c9             	movslq %r9d,%r9
+  800fd7:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fdc:	4c 89 d7             	mov    %r10,%rdi
+  800fdf:	48 b8 27 0f 80 00 00 	movabs $0x800f27,%rax
+  800fe6:	00 00 00 
+  800fe9:	ff d0                	call   *%rax
+	return 0;
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff4:	c9                   	leave
+  800ff5:	c3                   	ret
+		return -1;
+  800ff6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800ffb:	c3                   	ret
+		return -1;
+  800ffc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801001:	eb ed                	jmp    800ff0 <itoa+0x82>
+
+0000000000801003 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801003:	55                   	push   %rbp
+  801004:	48 89 e5             	mov    %rsp,%rbp
+  801007:	53                   	push   %rbx
+  801008:	48 89 fa             	mov    %rdi,%rdx
+  80100b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80100e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801013:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801018:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80101d:	be 00 00 00 00       	mov    $0x0,%esi
+  801022:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801028:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80102a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80102e:	c9                   	leave
+  80102f:	c3                   	ret
+
+0000000000801030 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801035:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80103a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801049:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80104e:	be 00 00 00 00       	mov    $0x0,%esi
+  801053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801059:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80105b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105f:	c9                   	leave
+  801060:	c3                   	ret
+
+0000000000801061 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801061:	55                   	push   %rbp
+  801062:	48 89 e5             	mov    %rsp,%rbp
+  801065:	53                   	push   %rbx
+  801066:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80106a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80106d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801072:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801081:	be 00 00 00 00       	mov    $0x0,%esi
+  801086:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80108c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80108e:	48 85 c0             	test   %rax,%rax
+  801091:	7f 06                	jg     801099 <sys_env_destroy+0x38>
+}
+  801093:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801099:	49 89 c0             	mov    %rax,%r8
+  80109c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010a1:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8010a8:	00 00 00 
+  8010ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8010b0:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8010b7:	00 00 00 
+  8010ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bf:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  8010c6:	00 00 00 
+  8010c9:	41 ff d1             	call   *%r9
+
+00000000008010cc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010cc:	55                   	push   %rbp
+  8010cd:	48 89 e5             	mov    %rsp,%rbp
+  8010d0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010db:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fb:	c9                   	leave
+  8010fc:	c3                   	ret
+
+00000000008010fd <sys_yield>:
+
+void
+sys_yield(void) {
+  8010fd:	55                   	push   %rbp
+  8010fe:	48 89 e5             	mov    %rsp,%rbp
+  801101:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801102:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801111:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801116:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111b:	be 00 00 00 00       	mov    $0x0,%esi
+  801120:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801126:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801128:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112c:	c9                   	leave
+  80112d:	c3                   	ret
+
+000000000080112e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80112e:	55                   	push   %rbp
+  80112f:	48 89 e5             	mov    %rsp,%rbp
+  801132:	53                   	push   %rbx
+  801133:	48 89 fa             	mov    %rdi,%rdx
+  801136:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801139:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80113e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801145:	00 00 00 
+  801148:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80114d:	be 00 00 00 00       	mov    $0x0,%esi
+  801152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801158:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80115a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115e:	c9                   	leave
+  80115f:	c3                   	ret
+
+0000000000801160 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801160:	55                   	push   %rbp
+  801161:	48 89 e5             	mov    %rsp,%rbp
+  801164:	53                   	push   %rbx
+  801165:	49 89 f8             	mov    %rdi,%r8
+  801168:	48 89 d3             	mov    %rdx,%rbx
+  80116b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80116e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801173:	4c 89 c2             	mov    %r8,%rdx
+  801176:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801179:	be 00 00 00 00       	mov    $0x0,%esi
+  80117e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801184:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801186:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118a:	c9                   	leave
+  80118b:	c3                   	ret
+
+000000000080118c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80118c:	55                   	push   %rbp
+  80118d:	48 89 e5             	mov    %rsp,%rbp
+  801190:	53                   	push   %rbx
+  801191:	48 83 ec 08          	sub    $0x8,%rsp
+  801195:	89 f8                	mov    %edi,%eax
+  801197:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80119a:	48 63 f9             	movslq %ecx,%rdi
+  80119d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b5:	48 85 c0             	test   %rax,%rax
+  8011b8:	7f 06                	jg     8011c0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011be:	c9                   	leave
+  8011bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c0:	49 89 c0             	mov    %rax,%r8
+  8011c3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011c8:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8011cf:	00 00 00 
+  8011d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011d7:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8011de:	00 00 00 
+  8011e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e6:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  8011ed:	00 00 00 
+  8011f0:	41 ff d1             	call   *%r9
+
+00000000008011f3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011f3:	55                   	push   %rbp
+  8011f4:	48 89 e5             	mov    %rsp,%rbp
+  8011f7:	53                   	push   %rbx
+  8011f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fc:	89 f8                	mov    %edi,%eax
+  8011fe:	49 89 f2             	mov    %rsi,%r10
+  801201:	48 89 cf             	mov    %rcx,%rdi
+  801204:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801207:	48 63 da             	movslq %edx,%rbx
+  80120a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801212:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801215:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801218:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80121a:	48 85 c0             	test   %rax,%rax
+  80121d:	7f 06                	jg     801225 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80121f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801225:	49 89 c0             	mov    %rax,%r8
+  801228:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80122d:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801234:	00 00 00 
+  801237:	be 26 00 00 00       	mov    $0x26,%esi
+  80123c:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801243:	00 00 00 
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124b:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  801252:	00 00 00 
+  801255:	41 ff d1             	call   *%r9
+
+0000000000801258 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+  80125c:	53                   	push   %rbx
+  80125d:	48 83 ec 08          	sub    $0x8,%rsp
+  801261:	48 89 f1             	mov    %rsi,%rcx
+  801264:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801267:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80126a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801281:	48 85 c0             	test   %rax,%rax
+  801284:	7f 06                	jg     80128c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128a:	c9                   	leave
+  80128b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80128c:	49 89 c0             	mov    %rax,%r8
+  80128f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801294:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80129b:	00 00 00 
+  80129e:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a3:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8012aa:	00 00 00 
+  8012ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b2:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  8012b9:	00 00 00 
+  8012bc:	41 ff d1             	call   *%r9
+
+00000000008012bf <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012bf:	55                   	push   %rbp
+  8012c0:	48 89 e5             	mov    %rsp,%rbp
+  8012c3:	53                   	push   %rbx
+  8012c4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012c8:	48 63 ce             	movslq %esi,%rcx
+  8012cb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ce:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ea:	48 85 c0             	test   %rax,%rax
+  8012ed:	7f 06                	jg     8012f5 <sys_env_set_status+0x36>
+}
+  8012ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f5:	49 89 c0             	mov    %rax,%r8
+  8012f8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012fd:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801304:	00 00 00 
+  801307:	be 26 00 00 00       	mov    $0x26,%esi
+  80130c:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801313:	00 00 00 
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131b:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  801322:	00 00 00 
+  801325:	41 ff d1             	call   *%r9
+
+0000000000801328 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	53                   	push   %rbx
+  80132d:	48 83 ec 08          	sub    $0x8,%rsp
+  801331:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801334:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801337:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80133c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801341:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801346:	be 00 00 00 00       	mov    $0x0,%esi
+  80134b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801351:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801353:	48 85 c0             	test   %rax,%rax
+  801356:	7f 06                	jg     80135e <sys_env_set_trapframe+0x36>
+}
+  801358:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135e:	49 89 c0             	mov    %rax,%r8
+  801361:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801366:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  80136d:	00 00 00 
+  801370:	be 26 00 00 00       	mov    $0x26,%esi
+  801375:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  80137c:	00 00 00 
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801384:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  80138b:	00 00 00 
+  80138e:	41 ff d1             	call   *%r9
+
+0000000000801391 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801391:	55                   	push   %rbp
+  801392:	48 89 e5             	mov    %rsp,%rbp
+  801395:	53                   	push   %rbx
+  801396:	48 83 ec 08          	sub    $0x8,%rsp
+  80139a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80139d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013af:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013bc:	48 85 c0             	test   %rax,%rax
+  8013bf:	7f 06                	jg     8013c7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c5:	c9                   	leave
+  8013c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c7:	49 89 c0             	mov    %rax,%r8
+  8013ca:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013cf:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  8013d6:	00 00 00 
+  8013d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013de:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  8013e5:	00 00 00 
+  8013e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ed:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  8013f4:	00 00 00 
+  8013f7:	41 ff d1             	call   *%r9
+
+00000000008013fa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+  8013fe:	53                   	push   %rbx
+  8013ff:	89 f8                	mov    %edi,%eax
+  801401:	49 89 f1             	mov    %rsi,%r9
+  801404:	48 89 d3             	mov    %rdx,%rbx
+  801407:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80140a:	49 63 f0             	movslq %r8d,%rsi
+  80140d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801410:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801415:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141e:	cd 30                	int    $0x30
+}
+  801420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+
+0000000000801426 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801432:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801435:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 06                	jg     80145a <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801454:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801458:	c9                   	leave
+  801459:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145a:	49 89 c0             	mov    %rax,%r8
+  80145d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801462:	48 ba 08 3c 80 00 00 	movabs $0x803c08,%rdx
+  801469:	00 00 00 
+  80146c:	be 26 00 00 00       	mov    $0x26,%esi
+  801471:	48 bf 27 3c 80 00 00 	movabs $0x803c27,%rdi
+  801478:	00 00 00 
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801480:	49 b9 ed 33 80 00 00 	movabs $0x8033ed,%r9
+  801487:	00 00 00 
+  80148a:	41 ff d1             	call   *%r9
+
+000000000080148d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80148d:	55                   	push   %rbp
+  80148e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801491:	ba 00 00 00 00       	mov    $0x0,%edx
+  801496:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  80149d:	00 00 00 
+  8014a0:	ff d0                	call   *%rax
+}
+  8014a2:	5d                   	pop    %rbp
+  8014a3:	c3                   	ret
+
+00000000008014a4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d3:	c9                   	leave
+  8014d4:	c3                   	ret
+
+00000000008014d5 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014d5:	55                   	push   %rbp
+  8014d6:	48 89 e5             	mov    %rsp,%rbp
+  8014d9:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014da:	48 63 ce             	movslq %esi,%rcx
+  8014dd:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fb:	cd 30                	int    $0x30
+}
+  8014fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801501:	c9                   	leave
+  801502:	c3                   	ret
+
+0000000000801503 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801503:	55                   	push   %rbp
+  801504:	48 89 e5             	mov    %rsp,%rbp
+  801507:	53                   	push   %rbx
+  801508:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80150b:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80150f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801519:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+  801523:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801529:	cd 30                	int    $0x30
+}
+  80152b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+0000000000801531 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	53                   	push   %rbx
+  801536:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801539:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80153c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801541:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801544:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801554:	cd 30                	int    $0x30
+}
+  801556:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155a:	c9                   	leave
+  80155b:	c3                   	ret
+
+000000000080155c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80155c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801563:	ff ff ff 
+  801566:	48 01 f8             	add    %rdi,%rax
+  801569:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80156d:	c3                   	ret
+
+000000000080156e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80156e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801575:	ff ff ff 
+  801578:	48 01 f8             	add    %rdi,%rax
+  80157b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80157f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801585:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801589:	c3                   	ret
+
+000000000080158a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80158a:	55                   	push   %rbp
+  80158b:	48 89 e5             	mov    %rsp,%rbp
+  80158e:	41 57                	push   %r15
+  801590:	41 56                	push   %r14
+  801592:	41 55                	push   %r13
+  801594:	41 54                	push   %r12
+  801596:	53                   	push   %rbx
+  801597:	48 83 ec 08          	sub    $0x8,%rsp
+  80159b:	49 89 ff             	mov    %rdi,%r15
+  80159e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8015a3:	49 bd a9 30 80 00 00 	movabs $0x8030a9,%r13
+  8015aa:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8015ad:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015b3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015b6:	48 89 df             	mov    %rbx,%rdi
+  8015b9:	41 ff d5             	call   *%r13
+  8015bc:	83 e0 04             	and    $0x4,%eax
+  8015bf:	74 17                	je     8015d8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015c1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015c8:	4c 39 f3             	cmp    %r14,%rbx
+  8015cb:	75 e6                	jne    8015b3 <fd_alloc+0x29>
+  8015cd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015d3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015d8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015db:	48 83 c4 08          	add    $0x8,%rsp
+  8015df:	5b                   	pop    %rbx
+  8015e0:	41 5c                	pop    %r12
+  8015e2:	41 5d                	pop    %r13
+  8015e4:	41 5e                	pop    %r14
+  8015e6:	41 5f                	pop    %r15
+  8015e8:	5d                   	pop    %rbp
+  8015e9:	c3                   	ret
+
+00000000008015ea <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015ea:	83 ff 1f             	cmp    $0x1f,%edi
+  8015ed:	77 39                	ja     801628 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015ef:	55                   	push   %rbp
+  8015f0:	48 89 e5             	mov    %rsp,%rbp
+  8015f3:	41 54                	push   %r12
+  8015f5:	53                   	push   %rbx
+  8015f6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015f9:	48 63 df             	movslq %edi,%rbx
+  8015fc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801603:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801607:	48 89 df             	mov    %rbx,%rdi
+  80160a:	48 b8 a9 30 80 00 00 	movabs $0x8030a9,%rax
+  801611:	00 00 00 
+  801614:	ff d0                	call   *%rax
+  801616:	a8 04                	test   $0x4,%al
+  801618:	74 14                	je     80162e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80161a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801623:	5b                   	pop    %rbx
+  801624:	41 5c                	pop    %r12
+  801626:	5d                   	pop    %rbp
+  801627:	c3                   	ret
+        return -E_INVAL;
+  801628:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80162d:	c3                   	ret
+        return -E_INVAL;
+  80162e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801633:	eb ee                	jmp    801623 <fd_lookup+0x39>
+
+0000000000801635 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	41 54                	push   %r12
+  80163b:	53                   	push   %rbx
+  80163c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80163f:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  801646:	00 00 00 
+  801649:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801650:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801653:	39 3b                	cmp    %edi,(%rbx)
+  801655:	74 47                	je     80169e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801657:	48 83 c0 08          	add    $0x8,%rax
+  80165b:	48 8b 18             	mov    (%rax),%rbx
+  80165e:	48 85 db             	test   %rbx,%rbx
+  801661:	75 f0                	jne    801653 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801663:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80166a:	00 00 00 
+  80166d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801673:	89 fa                	mov    %edi,%edx
+  801675:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  80167c:	00 00 00 
+  80167f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801684:	48 b9 db 01 80 00 00 	movabs $0x8001db,%rcx
+  80168b:	00 00 00 
+  80168e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801690:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801695:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801699:	5b                   	pop    %rbx
+  80169a:	41 5c                	pop    %r12
+  80169c:	5d                   	pop    %rbp
+  80169d:	c3                   	ret
+            return 0;
+  80169e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a3:	eb f0                	jmp    801695 <dev_lookup+0x60>
+
+00000000008016a5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	41 55                	push   %r13
+  8016ab:	41 54                	push   %r12
+  8016ad:	53                   	push   %rbx
+  8016ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8016b2:	48 89 fb             	mov    %rdi,%rbx
+  8016b5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016b8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016bf:	ff ff ff 
+  8016c2:	48 01 df             	add    %rbx,%rdi
+  8016c5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016c9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016cd:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+  8016d9:	41 89 c5             	mov    %eax,%r13d
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 06                	js     8016e6 <fd_close+0x41>
+  8016e0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016e4:	74 1a                	je     801700 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016e6:	45 84 e4             	test   %r12b,%r12b
+  8016e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ee:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016f2:	44 89 e8             	mov    %r13d,%eax
+  8016f5:	48 83 c4 18          	add    $0x18,%rsp
+  8016f9:	5b                   	pop    %rbx
+  8016fa:	41 5c                	pop    %r12
+  8016fc:	41 5d                	pop    %r13
+  8016fe:	5d                   	pop    %rbp
+  8016ff:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801700:	8b 3b                	mov    (%rbx),%edi
+  801702:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801706:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  80170d:	00 00 00 
+  801710:	ff d0                	call   *%rax
+  801712:	41 89 c5             	mov    %eax,%r13d
+  801715:	85 c0                	test   %eax,%eax
+  801717:	78 1b                	js     801734 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801719:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80171d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801721:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801727:	48 85 c0             	test   %rax,%rax
+  80172a:	74 08                	je     801734 <fd_close+0x8f>
+  80172c:	48 89 df             	mov    %rbx,%rdi
+  80172f:	ff d0                	call   *%rax
+  801731:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801734:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801739:	48 89 de             	mov    %rbx,%rsi
+  80173c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801741:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  801748:	00 00 00 
+  80174b:	ff d0                	call   *%rax
+    return res;
+  80174d:	eb a3                	jmp    8016f2 <fd_close+0x4d>
+
+000000000080174f <close>:
+
+int
+close(int fdnum) {
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+  801753:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801757:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80175b:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801762:	00 00 00 
+  801765:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 15                	js     801780 <close+0x31>
+
+    return fd_close(fd, 1);
+  80176b:	be 01 00 00 00       	mov    $0x1,%esi
+  801770:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801774:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  80177b:	00 00 00 
+  80177e:	ff d0                	call   *%rax
+}
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+
+0000000000801782 <close_all>:
+
+void
+close_all(void) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	41 54                	push   %r12
+  801788:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801789:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178e:	49 bc 4f 17 80 00 00 	movabs $0x80174f,%r12
+  801795:	00 00 00 
+  801798:	89 df                	mov    %ebx,%edi
+  80179a:	41 ff d4             	call   *%r12
+  80179d:	83 c3 01             	add    $0x1,%ebx
+  8017a0:	83 fb 20             	cmp    $0x20,%ebx
+  8017a3:	75 f3                	jne    801798 <close_all+0x16>
+}
+  8017a5:	5b                   	pop    %rbx
+  8017a6:	41 5c                	pop    %r12
+  8017a8:	5d                   	pop    %rbp
+  8017a9:	c3                   	ret
+
+00000000008017aa <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8017aa:	55                   	push   %rbp
+  8017ab:	48 89 e5             	mov    %rsp,%rbp
+  8017ae:	41 57                	push   %r15
+  8017b0:	41 56                	push   %r14
+  8017b2:	41 55                	push   %r13
+  8017b4:	41 54                	push   %r12
+  8017b6:	53                   	push   %rbx
+  8017b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8017bb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017be:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017c2:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+  8017ce:	89 c3                	mov    %eax,%ebx
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	0f 88 b8 00 00 00    	js     801890 <dup+0xe6>
+    close(newfdnum);
+  8017d8:	44 89 e7             	mov    %r12d,%edi
+  8017db:	48 b8 4f 17 80 00 00 	movabs $0x80174f,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017e7:	4d 63 ec             	movslq %r12d,%r13
+  8017ea:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017f1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017f5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017f9:	4c 89 ff             	mov    %r15,%rdi
+  8017fc:	49 be 6e 15 80 00 00 	movabs $0x80156e,%r14
+  801803:	00 00 00 
+  801806:	41 ff d6             	call   *%r14
+  801809:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80180c:	4c 89 ef             	mov    %r13,%rdi
+  80180f:	41 ff d6             	call   *%r14
+  801812:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801815:	48 89 df             	mov    %rbx,%rdi
+  801818:	48 b8 a9 30 80 00 00 	movabs $0x8030a9,%rax
+  80181f:	00 00 00 
+  801822:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801824:	a8 04                	test   $0x4,%al
+  801826:	74 2b                	je     801853 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801828:	41 89 c1             	mov    %eax,%r9d
+  80182b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801831:	4c 89 f1             	mov    %r14,%rcx
+  801834:	ba 00 00 00 00       	mov    $0x0,%edx
+  801839:	48 89 de             	mov    %rbx,%rsi
+  80183c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801841:	48 b8 f3 11 80 00 00 	movabs $0x8011f3,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+  80184d:	89 c3                	mov    %eax,%ebx
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	78 4e                	js     8018a1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801853:	4c 89 ff             	mov    %r15,%rdi
+  801856:	48 b8 a9 30 80 00 00 	movabs $0x8030a9,%rax
+  80185d:	00 00 00 
+  801860:	ff d0                	call   *%rax
+  801862:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801865:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80186b:	4c 89 e9             	mov    %r13,%rcx
+  80186e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801873:	4c 89 fe             	mov    %r15,%rsi
+  801876:	bf 00 00 00 00       	mov    $0x0,%edi
+  80187b:	48 b8 f3 11 80 00 00 	movabs $0x8011f3,%rax
+  801882:	00 00 00 
+  801885:	ff d0                	call   *%rax
+  801887:	89 c3                	mov    %eax,%ebx
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	78 14                	js     8018a1 <dup+0xf7>
+
+    return newfdnum;
+  80188d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801890:	89 d8                	mov    %ebx,%eax
+  801892:	48 83 c4 18          	add    $0x18,%rsp
+  801896:	5b                   	pop    %rbx
+  801897:	41 5c                	pop    %r12
+  801899:	41 5d                	pop    %r13
+  80189b:	41 5e                	pop    %r14
+  80189d:	41 5f                	pop    %r15
+  80189f:	5d                   	pop    %rbp
+  8018a0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8018a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018a6:	4c 89 ee             	mov    %r13,%rsi
+  8018a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ae:	49 bc 58 12 80 00 00 	movabs $0x801258,%r12
+  8018b5:	00 00 00 
+  8018b8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018c0:	4c 89 f6             	mov    %r14,%rsi
+  8018c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c8:	41 ff d4             	call   *%r12
+    return res;
+  8018cb:	eb c3                	jmp    801890 <dup+0xe6>
+
+00000000008018cd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018cd:	55                   	push   %rbp
+  8018ce:	48 89 e5             	mov    %rsp,%rbp
+  8018d1:	41 56                	push   %r14
+  8018d3:	41 55                	push   %r13
+  8018d5:	41 54                	push   %r12
+  8018d7:	53                   	push   %rbx
+  8018d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018dc:	89 fb                	mov    %edi,%ebx
+  8018de:	49 89 f4             	mov    %rsi,%r12
+  8018e1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018e4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018e8:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8018ef:	00 00 00 
+  8018f2:	ff d0                	call   *%rax
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 4c                	js     801944 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018f8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018fc:	41 8b 3e             	mov    (%r14),%edi
+  8018ff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801903:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  80190a:	00 00 00 
+  80190d:	ff d0                	call   *%rax
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 35                	js     801948 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801913:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801917:	83 e0 03             	and    $0x3,%eax
+  80191a:	83 f8 01             	cmp    $0x1,%eax
+  80191d:	74 2d                	je     80194c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80191f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801923:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801927:	48 85 c0             	test   %rax,%rax
+  80192a:	74 56                	je     801982 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80192c:	4c 89 ea             	mov    %r13,%rdx
+  80192f:	4c 89 e6             	mov    %r12,%rsi
+  801932:	4c 89 f7             	mov    %r14,%rdi
+  801935:	ff d0                	call   *%rax
+}
+  801937:	48 83 c4 10          	add    $0x10,%rsp
+  80193b:	5b                   	pop    %rbx
+  80193c:	41 5c                	pop    %r12
+  80193e:	41 5d                	pop    %r13
+  801940:	41 5e                	pop    %r14
+  801942:	5d                   	pop    %rbp
+  801943:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801944:	48 98                	cltq
+  801946:	eb ef                	jmp    801937 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801948:	48 98                	cltq
+  80194a:	eb eb                	jmp    801937 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80194c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801953:	00 00 00 
+  801956:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80195c:	89 da                	mov    %ebx,%edx
+  80195e:	48 bf 99 3c 80 00 00 	movabs $0x803c99,%rdi
+  801965:	00 00 00 
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196d:	48 b9 db 01 80 00 00 	movabs $0x8001db,%rcx
+  801974:	00 00 00 
+  801977:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801979:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801980:	eb b5                	jmp    801937 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801982:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801989:	eb ac                	jmp    801937 <read+0x6a>
+
+000000000080198b <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  80198b:	55                   	push   %rbp
+  80198c:	48 89 e5             	mov    %rsp,%rbp
+  80198f:	41 56                	push   %r14
+  801991:	41 55                	push   %r13
+  801993:	41 54                	push   %r12
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 10          	sub    $0x10,%rsp
+  80199a:	89 fb                	mov    %edi,%ebx
+  80199c:	49 89 f4             	mov    %rsi,%r12
+  80199f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019a2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a6:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	78 41                	js     8019f7 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019b6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019ba:	41 8b 3e             	mov    (%r14),%edi
+  8019bd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019c1:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 35                	js     801a06 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019d1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019d5:	83 e0 03             	and    $0x3,%eax
+  8019d8:	83 f8 01             	cmp    $0x1,%eax
+  8019db:	74 2d                	je     801a0a <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019e5:	48 85 c0             	test   %rax,%rax
+  8019e8:	74 56                	je     801a40 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019ea:	4c 89 ea             	mov    %r13,%rdx
+  8019ed:	4c 89 e6             	mov    %r12,%rsi
+  8019f0:	4c 89 f7             	mov    %r14,%rdi
+  8019f3:	ff d0                	call   *%rax
+  8019f5:	eb 02                	jmp    8019f9 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019f7:	48 98                	cltq
+}
+  8019f9:	48 83 c4 10          	add    $0x10,%rsp
+  8019fd:	5b                   	pop    %rbx
+  8019fe:	41 5c                	pop    %r12
+  801a00:	41 5d                	pop    %r13
+  801a02:	41 5e                	pop    %r14
+  801a04:	5d                   	pop    %rbp
+  801a05:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a06:	48 98                	cltq
+  801a08:	eb ef                	jmp    8019f9 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a0a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a11:	00 00 00 
+  801a14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a1a:	89 da                	mov    %ebx,%edx
+  801a1c:	48 bf 58 3c 80 00 00 	movabs $0x803c58,%rdi
+  801a23:	00 00 00 
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	48 b9 db 01 80 00 00 	movabs $0x8001db,%rcx
+  801a32:	00 00 00 
+  801a35:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a37:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a3e:	eb b9                	jmp    8019f9 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a40:	4c 89 ea             	mov    %r13,%rdx
+  801a43:	4c 89 e6             	mov    %r12,%rsi
+  801a46:	89 df                	mov    %ebx,%edi
+  801a48:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  801a4f:	00 00 00 
+  801a52:	ff d0                	call   *%rax
+  801a54:	eb a3                	jmp    8019f9 <readmap+0x6e>
+
+0000000000801a56 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	41 57                	push   %r15
+  801a5c:	41 56                	push   %r14
+  801a5e:	41 55                	push   %r13
+  801a60:	41 54                	push   %r12
+  801a62:	53                   	push   %rbx
+  801a63:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a67:	48 85 d2             	test   %rdx,%rdx
+  801a6a:	74 54                	je     801ac0 <readn+0x6a>
+  801a6c:	41 89 fd             	mov    %edi,%r13d
+  801a6f:	49 89 f6             	mov    %rsi,%r14
+  801a72:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a7a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a7f:	49 bf cd 18 80 00 00 	movabs $0x8018cd,%r15
+  801a86:	00 00 00 
+  801a89:	4c 89 e2             	mov    %r12,%rdx
+  801a8c:	48 29 f2             	sub    %rsi,%rdx
+  801a8f:	4c 01 f6             	add    %r14,%rsi
+  801a92:	44 89 ef             	mov    %r13d,%edi
+  801a95:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 20                	js     801abc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a9c:	01 c3                	add    %eax,%ebx
+  801a9e:	85 c0                	test   %eax,%eax
+  801aa0:	74 08                	je     801aaa <readn+0x54>
+  801aa2:	48 63 f3             	movslq %ebx,%rsi
+  801aa5:	4c 39 e6             	cmp    %r12,%rsi
+  801aa8:	72 df                	jb     801a89 <readn+0x33>
+    }
+    return res;
+  801aaa:	48 63 c3             	movslq %ebx,%rax
+}
+  801aad:	48 83 c4 08          	add    $0x8,%rsp
+  801ab1:	5b                   	pop    %rbx
+  801ab2:	41 5c                	pop    %r12
+  801ab4:	41 5d                	pop    %r13
+  801ab6:	41 5e                	pop    %r14
+  801ab8:	41 5f                	pop    %r15
+  801aba:	5d                   	pop    %rbp
+  801abb:	c3                   	ret
+        if (inc < 0) return inc;
+  801abc:	48 98                	cltq
+  801abe:	eb ed                	jmp    801aad <readn+0x57>
+    int inc = 1, res = 0;
+  801ac0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac5:	eb e3                	jmp    801aaa <readn+0x54>
+
+0000000000801ac7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ac7:	55                   	push   %rbp
+  801ac8:	48 89 e5             	mov    %rsp,%rbp
+  801acb:	41 56                	push   %r14
+  801acd:	41 55                	push   %r13
+  801acf:	41 54                	push   %r12
+  801ad1:	53                   	push   %rbx
+  801ad2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ad6:	89 fb                	mov    %edi,%ebx
+  801ad8:	49 89 f4             	mov    %rsi,%r12
+  801adb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ade:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae2:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 47                	js     801b39 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801af2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801af6:	41 8b 3e             	mov    (%r14),%edi
+  801af9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801afd:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	78 30                	js     801b3d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b0d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b12:	74 2d                	je     801b41 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b18:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b1c:	48 85 c0             	test   %rax,%rax
+  801b1f:	74 56                	je     801b77 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b21:	4c 89 ea             	mov    %r13,%rdx
+  801b24:	4c 89 e6             	mov    %r12,%rsi
+  801b27:	4c 89 f7             	mov    %r14,%rdi
+  801b2a:	ff d0                	call   *%rax
+}
+  801b2c:	48 83 c4 10          	add    $0x10,%rsp
+  801b30:	5b                   	pop    %rbx
+  801b31:	41 5c                	pop    %r12
+  801b33:	41 5d                	pop    %r13
+  801b35:	41 5e                	pop    %r14
+  801b37:	5d                   	pop    %rbp
+  801b38:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b39:	48 98                	cltq
+  801b3b:	eb ef                	jmp    801b2c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b3d:	48 98                	cltq
+  801b3f:	eb eb                	jmp    801b2c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b41:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b48:	00 00 00 
+  801b4b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b51:	89 da                	mov    %ebx,%edx
+  801b53:	48 bf b5 3c 80 00 00 	movabs $0x803cb5,%rdi
+  801b5a:	00 00 00 
+  801b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b62:	48 b9 db 01 80 00 00 	movabs $0x8001db,%rcx
+  801b69:	00 00 00 
+  801b6c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b6e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b75:	eb b5                	jmp    801b2c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b77:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b7e:	eb ac                	jmp    801b2c <write+0x65>
+
+0000000000801b80 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b80:	55                   	push   %rbp
+  801b81:	48 89 e5             	mov    %rsp,%rbp
+  801b84:	53                   	push   %rbx
+  801b85:	48 83 ec 18          	sub    $0x18,%rsp
+  801b89:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b8b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b8f:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801b96:	00 00 00 
+  801b99:	ff d0                	call   *%rax
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 0c                	js     801bab <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ba3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+0000000000801bb1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	41 55                	push   %r13
+  801bb7:	41 54                	push   %r12
+  801bb9:	53                   	push   %rbx
+  801bba:	48 83 ec 18          	sub    $0x18,%rsp
+  801bbe:	89 fb                	mov    %edi,%ebx
+  801bc0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bc7:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801bce:	00 00 00 
+  801bd1:	ff d0                	call   *%rax
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	78 38                	js     801c0f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bd7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bdb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bdf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801be3:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801bea:	00 00 00 
+  801bed:	ff d0                	call   *%rax
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 1c                	js     801c0f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bf3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801bf8:	74 20                	je     801c1a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bfe:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c02:	48 85 c0             	test   %rax,%rax
+  801c05:	74 47                	je     801c4e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c07:	44 89 e6             	mov    %r12d,%esi
+  801c0a:	4c 89 ef             	mov    %r13,%rdi
+  801c0d:	ff d0                	call   *%rax
+}
+  801c0f:	48 83 c4 18          	add    $0x18,%rsp
+  801c13:	5b                   	pop    %rbx
+  801c14:	41 5c                	pop    %r12
+  801c16:	41 5d                	pop    %r13
+  801c18:	5d                   	pop    %rbp
+  801c19:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c1a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c21:	00 00 00 
+  801c24:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c2a:	89 da                	mov    %ebx,%edx
+  801c2c:	48 bf 78 3c 80 00 00 	movabs $0x803c78,%rdi
+  801c33:	00 00 00 
+  801c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3b:	48 b9 db 01 80 00 00 	movabs $0x8001db,%rcx
+  801c42:	00 00 00 
+  801c45:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4c:	eb c1                	jmp    801c0f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c4e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c53:	eb ba                	jmp    801c0f <ftruncate+0x5e>
+
+0000000000801c55 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c55:	55                   	push   %rbp
+  801c56:	48 89 e5             	mov    %rsp,%rbp
+  801c59:	41 54                	push   %r12
+  801c5b:	53                   	push   %rbx
+  801c5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801c60:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c63:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c67:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801c6e:	00 00 00 
+  801c71:	ff d0                	call   *%rax
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 4e                	js     801cc5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c77:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c7b:	41 8b 3c 24          	mov    (%r12),%edi
+  801c7f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c83:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	78 32                	js     801cc5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c97:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801c9c:	74 30                	je     801cce <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c9e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ca1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ca8:	00 00 00 
+    stat->st_isdir = 0;
+  801cab:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cb2:	00 00 00 
+    stat->st_dev = dev;
+  801cb5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cbc:	48 89 de             	mov    %rbx,%rsi
+  801cbf:	4c 89 e7             	mov    %r12,%rdi
+  801cc2:	ff 50 30             	call   *0x30(%rax)
+}
+  801cc5:	48 83 c4 10          	add    $0x10,%rsp
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5c                	pop    %r12
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cce:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cd3:	eb f0                	jmp    801cc5 <fstat+0x70>
+
+0000000000801cd5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cd5:	55                   	push   %rbp
+  801cd6:	48 89 e5             	mov    %rsp,%rbp
+  801cd9:	41 54                	push   %r12
+  801cdb:	53                   	push   %rbx
+  801cdc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce4:	48 b8 2c 2a 80 00 00 	movabs $0x802a2c,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+  801cf0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 25                	js     801d1b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801cf6:	4c 89 e6             	mov    %r12,%rsi
+  801cf9:	89 c7                	mov    %eax,%edi
+  801cfb:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  801d02:	00 00 00 
+  801d05:	ff d0                	call   *%rax
+  801d07:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d0a:	89 df                	mov    %ebx,%edi
+  801d0c:	48 b8 4f 17 80 00 00 	movabs $0x80174f,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+
+    return res;
+  801d18:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d1b:	89 d8                	mov    %ebx,%eax
+  801d1d:	5b                   	pop    %rbx
+  801d1e:	41 5c                	pop    %r12
+  801d20:	5d                   	pop    %rbp
+  801d21:	c3                   	ret
+
+0000000000801d22 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d22:	55                   	push   %rbp
+  801d23:	48 89 e5             	mov    %rsp,%rbp
+  801d26:	41 54                	push   %r12
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 10          	sub    $0x10,%rsp
+  801d2d:	48 89 fb             	mov    %rdi,%rbx
+  801d30:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d33:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d37:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d3c:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 1f                	js     801d6b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d50:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d54:	48 85 c0             	test   %rax,%rax
+  801d57:	74 1b                	je     801d74 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d59:	4c 89 e6             	mov    %r12,%rsi
+  801d5c:	48 89 df             	mov    %rbx,%rdi
+  801d5f:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d68:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d6b:	48 83 c4 10          	add    $0x10,%rsp
+  801d6f:	5b                   	pop    %rbx
+  801d70:	41 5c                	pop    %r12
+  801d72:	5d                   	pop    %rbp
+  801d73:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d74:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d79:	eb f0                	jmp    801d6b <create_snapshot+0x49>
+
+0000000000801d7b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d83:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d87:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d8c:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801d93:	00 00 00 
+  801d96:	ff d0                	call   *%rax
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 1e                	js     801dba <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801d9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da0:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801da4:	48 85 d2             	test   %rdx,%rdx
+  801da7:	74 13                	je     801dbc <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dae:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+        return -E_NOT_SUPP;
+  801dbc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dc1:	eb f7                	jmp    801dba <print_snapshot_list+0x3f>
+
+0000000000801dc3 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801dc3:	55                   	push   %rbp
+  801dc4:	48 89 e5             	mov    %rsp,%rbp
+  801dc7:	53                   	push   %rbx
+  801dc8:	48 83 ec 18          	sub    $0x18,%rsp
+  801dcc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dcf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dd3:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dd8:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 1c                	js     801e04 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801de8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dec:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801df0:	48 85 c0             	test   %rax,%rax
+  801df3:	74 15                	je     801e0a <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801df5:	48 89 df             	mov    %rbx,%rdi
+  801df8:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e01:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e0a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e0f:	eb f3                	jmp    801e04 <accept_snapshot+0x41>
+
+0000000000801e11 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e11:	55                   	push   %rbp
+  801e12:	48 89 e5             	mov    %rsp,%rbp
+  801e15:	53                   	push   %rbx
+  801e16:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e1d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e21:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e26:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 1c                	js     801e52 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e3a:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e3e:	48 85 c0             	test   %rax,%rax
+  801e41:	74 15                	je     801e58 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e43:	48 89 df             	mov    %rbx,%rdi
+  801e46:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e58:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e5d:	eb f3                	jmp    801e52 <delete_snapshot+0x41>
+
+0000000000801e5f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e5f:	55                   	push   %rbp
+  801e60:	48 89 e5             	mov    %rsp,%rbp
+  801e63:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e67:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e6b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e70:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 14                	js     801e94 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e84:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e88:	48 85 d2             	test   %rdx,%rdx
+  801e8b:	74 09                	je     801e96 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e92:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e96:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9b:	eb f7                	jmp    801e94 <gc_snapshots+0x35>
+
+0000000000801e9d <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	41 56                	push   %r14
+  801ea3:	41 55                	push   %r13
+  801ea5:	41 54                	push   %r12
+  801ea7:	53                   	push   %rbx
+  801ea8:	48 83 ec 10          	sub    $0x10,%rsp
+  801eac:	48 89 fb             	mov    %rdi,%rbx
+  801eaf:	49 89 f4             	mov    %rsi,%r12
+  801eb2:	49 89 d5             	mov    %rdx,%r13
+  801eb5:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801eb8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebc:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ec1:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	78 1b                	js     801eec <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ed1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801ed9:	48 85 c0             	test   %rax,%rax
+  801edc:	74 1b                	je     801ef9 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ede:	4c 89 f1             	mov    %r14,%rcx
+  801ee1:	4c 89 ea             	mov    %r13,%rdx
+  801ee4:	4c 89 e6             	mov    %r12,%rsi
+  801ee7:	48 89 df             	mov    %rbx,%rdi
+  801eea:	ff d0                	call   *%rax
+
+    return res;
+}
+  801eec:	48 83 c4 10          	add    $0x10,%rsp
+  801ef0:	5b                   	pop    %rbx
+  801ef1:	41 5c                	pop    %r12
+  801ef3:	41 5d                	pop    %r13
+  801ef5:	41 5e                	pop    %r14
+  801ef7:	5d                   	pop    %rbp
+  801ef8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ef9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801efe:	eb ec                	jmp    801eec <diff_snapshots+0x4f>
+
+0000000000801f00 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 55                	push   %r13
+  801f06:	41 54                	push   %r12
+  801f08:	53                   	push   %rbx
+  801f09:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0d:	48 89 fb             	mov    %rdi,%rbx
+  801f10:	49 89 f4             	mov    %rsi,%r12
+  801f13:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f16:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f1a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f1f:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801f26:	00 00 00 
+  801f29:	ff d0                	call   *%rax
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 18                	js     801f47 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f33:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f37:	48 85 c0             	test   %rax,%rax
+  801f3a:	74 16                	je     801f52 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f3c:	4c 89 ea             	mov    %r13,%rdx
+  801f3f:	4c 89 e6             	mov    %r12,%rsi
+  801f42:	48 89 df             	mov    %rbx,%rdi
+  801f45:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f47:	48 83 c4 18          	add    $0x18,%rsp
+  801f4b:	5b                   	pop    %rbx
+  801f4c:	41 5c                	pop    %r12
+  801f4e:	41 5d                	pop    %r13
+  801f50:	5d                   	pop    %rbp
+  801f51:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f52:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f57:	eb ee                	jmp    801f47 <send_snapshot+0x47>
+
+0000000000801f59 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+  801f5d:	53                   	push   %rbx
+  801f5e:	48 83 ec 18          	sub    $0x18,%rsp
+  801f62:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f65:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f69:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f6e:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801f75:	00 00 00 
+  801f78:	ff d0                	call   *%rax
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 12                	js     801f90 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f82:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f86:	48 85 c0             	test   %rax,%rax
+  801f89:	74 0b                	je     801f96 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f8b:	48 89 df             	mov    %rbx,%rdi
+  801f8e:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f94:	c9                   	leave
+  801f95:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f96:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f9b:	eb f3                	jmp    801f90 <receive_snapshot+0x37>
+
+0000000000801f9d <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801f9d:	55                   	push   %rbp
+  801f9e:	48 89 e5             	mov    %rsp,%rbp
+  801fa1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fa5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fa9:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fae:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 17                	js     801fd5 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc2:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fc9:	48 85 d2             	test   %rdx,%rdx
+  801fcc:	74 09                	je     801fd7 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd3:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fd5:	c9                   	leave
+  801fd6:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fd7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fdc:	eb f7                	jmp    801fd5 <free_space_bytes+0x38>
+
+0000000000801fde <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801fde:	55                   	push   %rbp
+  801fdf:	48 89 e5             	mov    %rsp,%rbp
+  801fe2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fe6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fea:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fef:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	78 17                	js     802016 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801fff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802003:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80200a:	48 85 d2             	test   %rdx,%rdx
+  80200d:	74 09                	je     802018 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80200f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802014:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+        return -E_NOT_SUPP;
+  802018:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80201d:	eb f7                	jmp    802016 <busy_space_bytes+0x38>
+
+000000000080201f <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	41 54                	push   %r12
+  802025:	53                   	push   %rbx
+  802026:	48 83 ec 10          	sub    $0x10,%rsp
+  80202a:	89 fb                	mov    %edi,%ebx
+  80202c:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80202f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802033:	bf 66 00 00 00       	mov    $0x66,%edi
+  802038:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 17                	js     80205f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802053:	48 85 c0             	test   %rax,%rax
+  802056:	74 10                	je     802068 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802058:	4c 89 e6             	mov    %r12,%rsi
+  80205b:	89 df                	mov    %ebx,%edi
+  80205d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80205f:	48 83 c4 10          	add    $0x10,%rsp
+  802063:	5b                   	pop    %rbx
+  802064:	41 5c                	pop    %r12
+  802066:	5d                   	pop    %rbp
+  802067:	c3                   	ret
+        return -E_NOT_SUPP;
+  802068:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206d:	eb f0                	jmp    80205f <snapshots_space+0x40>
+
+000000000080206f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80206f:	55                   	push   %rbp
+  802070:	48 89 e5             	mov    %rsp,%rbp
+  802073:	41 55                	push   %r13
+  802075:	41 54                	push   %r12
+  802077:	53                   	push   %rbx
+  802078:	48 83 ec 08          	sub    $0x8,%rsp
+  80207c:	41 89 fd             	mov    %edi,%r13d
+  80207f:	48 89 f3             	mov    %rsi,%rbx
+  802082:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802085:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80208c:	00 00 00 
+  80208f:	83 38 00             	cmpl   $0x0,(%rax)
+  802092:	74 57                	je     8020eb <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802094:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80209a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80209f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020a6:	00 00 00 
+  8020a9:	44 89 ee             	mov    %r13d,%esi
+  8020ac:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020b3:	00 00 00 
+  8020b6:	8b 38                	mov    (%rax),%edi
+  8020b8:	48 b8 8f 35 80 00 00 	movabs $0x80358f,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c9:	4c 89 e2             	mov    %r12,%rdx
+  8020cc:	48 89 de             	mov    %rbx,%rsi
+  8020cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d4:	48 b8 77 35 80 00 00 	movabs $0x803577,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+}
+  8020e0:	48 83 c4 08          	add    $0x8,%rsp
+  8020e4:	5b                   	pop    %rbx
+  8020e5:	41 5c                	pop    %r12
+  8020e7:	41 5d                	pop    %r13
+  8020e9:	5d                   	pop    %rbp
+  8020ea:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020eb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020f0:	48 b8 4d 36 80 00 00 	movabs $0x80364d,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+  8020fc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802103:	00 00 
+  802105:	eb 8d                	jmp    802094 <fsipc_region+0x25>
+
+0000000000802107 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802107:	55                   	push   %rbp
+  802108:	48 89 e5             	mov    %rsp,%rbp
+  80210b:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80210f:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802116:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802117:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80211b:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802122:	00 00 00 
+  802125:	ff d0                	call   *%rax
+}
+  802127:	c9                   	leave
+  802128:	c3                   	ret
+
+0000000000802129 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802129:	85 ff                	test   %edi,%edi
+  80212b:	78 6d                	js     80219a <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+  802131:	41 54                	push   %r12
+  802133:	53                   	push   %rbx
+  802134:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802137:	48 85 f6             	test   %rsi,%rsi
+  80213a:	74 57                	je     802193 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80213c:	89 f8                	mov    %edi,%eax
+  80213e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802145:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802147:	be 00 00 00 00       	mov    $0x0,%esi
+  80214c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802151:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 2d                	js     80218e <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802161:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802168:	00 00 00 
+  80216b:	49 63 14 24          	movslq (%r12),%rdx
+  80216f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802176:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80217b:	48 89 df             	mov    %rbx,%rdi
+  80217e:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80218a:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80218e:	5b                   	pop    %rbx
+  80218f:	41 5c                	pop    %r12
+  802191:	5d                   	pop    %rbp
+  802192:	c3                   	ret
+        return -E_INVAL;
+  802193:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802198:	eb f4                	jmp    80218e <devfile_df_snapshots+0x65>
+  80219a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80219f:	c3                   	ret
+
+00000000008021a0 <devfile_df_busy>:
+devfile_df_busy() {
+  8021a0:	55                   	push   %rbp
+  8021a1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8021a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a9:	bf 11 00 00 00       	mov    $0x11,%edi
+  8021ae:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+}
+  8021ba:	5d                   	pop    %rbp
+  8021bb:	c3                   	ret
+
+00000000008021bc <devfile_df_free>:
+devfile_df_free() {
+  8021bc:	55                   	push   %rbp
+  8021bd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021ca:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  8021d1:	00 00 00 
+  8021d4:	ff d0                	call   *%rax
+}
+  8021d6:	5d                   	pop    %rbp
+  8021d7:	c3                   	ret
+
+00000000008021d8 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021e6:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+}
+  8021f2:	5d                   	pop    %rbp
+  8021f3:	c3                   	ret
+
+00000000008021f4 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8021f4:	55                   	push   %rbp
+  8021f5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8021f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fd:	bf 09 00 00 00       	mov    $0x9,%edi
+  802202:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802209:	00 00 00 
+  80220c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	ba 00 00 00 00       	mov    $0x0,%edx
+  802215:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802218:	5d                   	pop    %rbp
+  802219:	c3                   	ret
+
+000000000080221a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80221a:	55                   	push   %rbp
+  80221b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80221e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802225:	00 00 00 
+  802228:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80222b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80222d:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802230:	be 00 00 00 00       	mov    $0x0,%esi
+  802235:	bf 02 00 00 00       	mov    $0x2,%edi
+  80223a:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+}
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+
+0000000000802248 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802248:	55                   	push   %rbp
+  802249:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80224c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80224f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802256:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802258:	be 00 00 00 00       	mov    $0x0,%esi
+  80225d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802262:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802269:	00 00 00 
+  80226c:	ff d0                	call   *%rax
+}
+  80226e:	5d                   	pop    %rbp
+  80226f:	c3                   	ret
+
+0000000000802270 <devfile_write>:
+    if (!fd || !buf) {
+  802270:	48 85 ff             	test   %rdi,%rdi
+  802273:	0f 84 c1 00 00 00    	je     80233a <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802279:	55                   	push   %rbp
+  80227a:	48 89 e5             	mov    %rsp,%rbp
+  80227d:	41 57                	push   %r15
+  80227f:	41 56                	push   %r14
+  802281:	41 55                	push   %r13
+  802283:	41 54                	push   %r12
+  802285:	53                   	push   %rbx
+  802286:	48 83 ec 18          	sub    $0x18,%rsp
+  80228a:	49 89 ff             	mov    %rdi,%r15
+  80228d:	49 89 f5             	mov    %rsi,%r13
+  802290:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802293:	48 85 f6             	test   %rsi,%rsi
+  802296:	0f 84 95 00 00 00    	je     802331 <devfile_write+0xc1>
+    while (n) {
+  80229c:	48 85 d2             	test   %rdx,%rdx
+  80229f:	0f 84 83 00 00 00    	je     802328 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8022a5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022ac:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022b3:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022b6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022bb:	49 39 dc             	cmp    %rbx,%r12
+  8022be:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022c2:	48 89 da             	mov    %rbx,%rdx
+  8022c5:	4c 89 ee             	mov    %r13,%rsi
+  8022c8:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022cf:	00 00 00 
+  8022d2:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022de:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022e2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022e5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022f3:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+        if (write < 0) {
+  8022ff:	85 c0                	test   %eax,%eax
+  802301:	78 21                	js     802324 <devfile_write+0xb4>
+        buf += write;
+  802303:	48 63 d0             	movslq %eax,%rdx
+  802306:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802309:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80230c:	49 29 d4             	sub    %rdx,%r12
+  80230f:	75 a5                	jne    8022b6 <devfile_write+0x46>
+    return totalWrite;
+  802311:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802315:	48 83 c4 18          	add    $0x18,%rsp
+  802319:	5b                   	pop    %rbx
+  80231a:	41 5c                	pop    %r12
+  80231c:	41 5d                	pop    %r13
+  80231e:	41 5e                	pop    %r14
+  802320:	41 5f                	pop    %r15
+  802322:	5d                   	pop    %rbp
+  802323:	c3                   	ret
+            return write;
+  802324:	48 98                	cltq
+  802326:	eb ed                	jmp    802315 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802328:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80232f:	eb e0                	jmp    802311 <devfile_write+0xa1>
+        return -E_INVAL;
+  802331:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802338:	eb db                	jmp    802315 <devfile_write+0xa5>
+  80233a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802341:	c3                   	ret
+
+0000000000802342 <devfile_read>:
+    if (!fd || !buf) {
+  802342:	48 85 ff             	test   %rdi,%rdi
+  802345:	0f 84 c0 00 00 00    	je     80240b <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80234b:	55                   	push   %rbp
+  80234c:	48 89 e5             	mov    %rsp,%rbp
+  80234f:	41 57                	push   %r15
+  802351:	41 56                	push   %r14
+  802353:	41 55                	push   %r13
+  802355:	41 54                	push   %r12
+  802357:	53                   	push   %rbx
+  802358:	48 83 ec 18          	sub    $0x18,%rsp
+  80235c:	49 89 ff             	mov    %rdi,%r15
+  80235f:	49 89 f5             	mov    %rsi,%r13
+  802362:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802365:	48 85 f6             	test   %rsi,%rsi
+  802368:	0f 84 96 00 00 00    	je     802404 <devfile_read+0xc2>
+    while (n) {
+  80236e:	48 85 d2             	test   %rdx,%rdx
+  802371:	0f 84 87 00 00 00    	je     8023fe <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802377:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80237e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80237f:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802386:	00 00 00 
+  802389:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80238d:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802390:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802395:	49 39 c4             	cmp    %rax,%r12
+  802398:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80239c:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8023a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023aa:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	7e 37                	jle    8023f1 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023ba:	48 63 d8             	movslq %eax,%rbx
+  8023bd:	48 89 da             	mov    %rbx,%rdx
+  8023c0:	4c 89 f6             	mov    %r14,%rsi
+  8023c3:	4c 89 ef             	mov    %r13,%rdi
+  8023c6:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+        buf += read;
+  8023d2:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023d5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023d9:	49 29 dc             	sub    %rbx,%r12
+  8023dc:	75 ab                	jne    802389 <devfile_read+0x47>
+  return totalRead;
+  8023de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023e2:	48 83 c4 18          	add    $0x18,%rsp
+  8023e6:	5b                   	pop    %rbx
+  8023e7:	41 5c                	pop    %r12
+  8023e9:	41 5d                	pop    %r13
+  8023eb:	41 5e                	pop    %r14
+  8023ed:	41 5f                	pop    %r15
+  8023ef:	5d                   	pop    %rbp
+  8023f0:	c3                   	ret
+            return read ? read : totalRead;
+  8023f1:	48 63 d0             	movslq %eax,%rdx
+  8023f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023f8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8023fc:	eb e4                	jmp    8023e2 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8023fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802402:	eb da                	jmp    8023de <devfile_read+0x9c>
+        return E_INVAL;
+  802404:	b8 03 00 00 00       	mov    $0x3,%eax
+  802409:	eb d7                	jmp    8023e2 <devfile_read+0xa0>
+  80240b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802410:	c3                   	ret
+
+0000000000802411 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802411:	48 85 ff             	test   %rdi,%rdi
+  802414:	74 5f                	je     802475 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	53                   	push   %rbx
+  80241b:	48 83 ec 08          	sub    $0x8,%rsp
+  80241f:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802422:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+  80242e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802434:	77 45                	ja     80247b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802436:	48 89 de             	mov    %rbx,%rsi
+  802439:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802440:	00 00 00 
+  802443:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80244f:	be 00 00 00 00       	mov    $0x0,%esi
+  802454:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802459:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802465:	85 c0                	test   %eax,%eax
+  802467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80246f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+        return -E_INVAL;
+  802475:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80247a:	c3                   	ret
+        return -E_INVAL;
+  80247b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802480:	eb ed                	jmp    80246f <devfile_receive_snapshot+0x5e>
+
+0000000000802482 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802482:	55                   	push   %rbp
+  802483:	48 89 e5             	mov    %rsp,%rbp
+  802486:	41 55                	push   %r13
+  802488:	41 54                	push   %r12
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 08          	sub    $0x8,%rsp
+  80248f:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802492:	48 85 f6             	test   %rsi,%rsi
+  802495:	0f 94 c0             	sete   %al
+  802498:	48 85 d2             	test   %rdx,%rdx
+  80249b:	0f 94 c2             	sete   %dl
+  80249e:	08 d0                	or     %dl,%al
+  8024a0:	0f 85 ad 00 00 00    	jne    802553 <devfile_send_snapshot+0xd1>
+  8024a6:	48 89 fb             	mov    %rdi,%rbx
+  8024a9:	49 89 f4             	mov    %rsi,%r12
+  8024ac:	48 85 ff             	test   %rdi,%rdi
+  8024af:	0f 84 9e 00 00 00    	je     802553 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024b5:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+  8024c1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024c7:	0f 87 8d 00 00 00    	ja     80255a <devfile_send_snapshot+0xd8>
+  8024cd:	4c 89 e7             	mov    %r12,%rdi
+  8024d0:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024e2:	77 7d                	ja     802561 <devfile_send_snapshot+0xdf>
+  8024e4:	4c 89 ef             	mov    %r13,%rdi
+  8024e7:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+  8024f3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024f9:	77 6d                	ja     802568 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8024fb:	48 89 de             	mov    %rbx,%rsi
+  8024fe:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802505:	00 00 00 
+  802508:	48 bb 00 0b 80 00 00 	movabs $0x800b00,%rbx
+  80250f:	00 00 00 
+  802512:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802514:	4c 89 e6             	mov    %r12,%rsi
+  802517:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80251e:	00 00 00 
+  802521:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802523:	4c 89 ee             	mov    %r13,%rsi
+  802526:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80252d:	00 00 00 
+  802530:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802532:	be 00 00 00 00       	mov    $0x0,%esi
+  802537:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80253c:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802543:	00 00 00 
+  802546:	ff d0                	call   *%rax
+}
+  802548:	48 83 c4 08          	add    $0x8,%rsp
+  80254c:	5b                   	pop    %rbx
+  80254d:	41 5c                	pop    %r12
+  80254f:	41 5d                	pop    %r13
+  802551:	5d                   	pop    %rbp
+  802552:	c3                   	ret
+        return -E_INVAL;
+  802553:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802558:	eb ee                	jmp    802548 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80255a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255f:	eb e7                	jmp    802548 <devfile_send_snapshot+0xc6>
+  802561:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802566:	eb e0                	jmp    802548 <devfile_send_snapshot+0xc6>
+  802568:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256d:	eb d9                	jmp    802548 <devfile_send_snapshot+0xc6>
+
+000000000080256f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80256f:	48 85 ff             	test   %rdi,%rdi
+  802572:	0f 84 41 01 00 00    	je     8026b9 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802578:	55                   	push   %rbp
+  802579:	48 89 e5             	mov    %rsp,%rbp
+  80257c:	41 57                	push   %r15
+  80257e:	41 56                	push   %r14
+  802580:	41 55                	push   %r13
+  802582:	41 54                	push   %r12
+  802584:	53                   	push   %rbx
+  802585:	48 83 ec 08          	sub    $0x8,%rsp
+  802589:	49 89 fc             	mov    %rdi,%r12
+  80258c:	49 89 f5             	mov    %rsi,%r13
+  80258f:	48 89 d3             	mov    %rdx,%rbx
+  802592:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802595:	48 85 f6             	test   %rsi,%rsi
+  802598:	0f 84 ff 00 00 00    	je     80269d <devfile_diff_snapshots+0x12e>
+  80259e:	48 85 d2             	test   %rdx,%rdx
+  8025a1:	0f 84 fd 00 00 00    	je     8026a4 <devfile_diff_snapshots+0x135>
+  8025a7:	48 85 c9             	test   %rcx,%rcx
+  8025aa:	0f 84 f4 00 00 00    	je     8026a4 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8025b0:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8025b7:	00 00 00 
+  8025ba:	ff d0                	call   *%rax
+  8025bc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025c2:	0f 87 e3 00 00 00    	ja     8026ab <devfile_diff_snapshots+0x13c>
+  8025c8:	4c 89 ef             	mov    %r13,%rdi
+  8025cb:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+  8025d7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025dd:	0f 87 cf 00 00 00    	ja     8026b2 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025e3:	4c 89 e6             	mov    %r12,%rsi
+  8025e6:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8025ed:	00 00 00 
+  8025f0:	4c 89 e7             	mov    %r12,%rdi
+  8025f3:	49 bf 00 0b 80 00 00 	movabs $0x800b00,%r15
+  8025fa:	00 00 00 
+  8025fd:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802600:	4c 89 ee             	mov    %r13,%rsi
+  802603:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80260a:	00 
+  80260b:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80260e:	48 8b 03             	mov    (%rbx),%rax
+  802611:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802618:	00 
+  802619:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80261d:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802624:	00 
+  802625:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802629:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802630:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802631:	be 00 00 00 00       	mov    $0x0,%esi
+  802636:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80263b:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802647:	85 c0                	test   %eax,%eax
+  802649:	78 43                	js     80268e <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80264b:	49 8b 04 24          	mov    (%r12),%rax
+  80264f:	48 89 03             	mov    %rax,(%rbx)
+  802652:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802657:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80265b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802660:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802664:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802669:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80266d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802671:	48 c1 e2 03          	shl    $0x3,%rdx
+  802675:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80267a:	4c 89 f7             	mov    %r14,%rdi
+  80267d:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  802684:	00 00 00 
+  802687:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802689:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80268e:	48 83 c4 08          	add    $0x8,%rsp
+  802692:	5b                   	pop    %rbx
+  802693:	41 5c                	pop    %r12
+  802695:	41 5d                	pop    %r13
+  802697:	41 5e                	pop    %r14
+  802699:	41 5f                	pop    %r15
+  80269b:	5d                   	pop    %rbp
+  80269c:	c3                   	ret
+        return -E_INVAL;
+  80269d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a2:	eb ea                	jmp    80268e <devfile_diff_snapshots+0x11f>
+  8026a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a9:	eb e3                	jmp    80268e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b0:	eb dc                	jmp    80268e <devfile_diff_snapshots+0x11f>
+  8026b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b7:	eb d5                	jmp    80268e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026be:	c3                   	ret
+
+00000000008026bf <devfile_delete_snapshot>:
+    if (!name) {
+  8026bf:	48 85 ff             	test   %rdi,%rdi
+  8026c2:	74 5f                	je     802723 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026c4:	55                   	push   %rbp
+  8026c5:	48 89 e5             	mov    %rsp,%rbp
+  8026c8:	53                   	push   %rbx
+  8026c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026d0:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+  8026dc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026e2:	77 45                	ja     802729 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026e4:	48 89 de             	mov    %rbx,%rsi
+  8026e7:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026ee:	00 00 00 
+  8026f1:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8026fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802702:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802707:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802713:	85 c0                	test   %eax,%eax
+  802715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80271d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802721:	c9                   	leave
+  802722:	c3                   	ret
+        return -E_INVAL;
+  802723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802728:	c3                   	ret
+        return -E_INVAL;
+  802729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272e:	eb ed                	jmp    80271d <devfile_delete_snapshot+0x5e>
+
+0000000000802730 <devfile_accept_snapshot>:
+    if (!name) {
+  802730:	48 85 ff             	test   %rdi,%rdi
+  802733:	74 5f                	je     802794 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802735:	55                   	push   %rbp
+  802736:	48 89 e5             	mov    %rsp,%rbp
+  802739:	53                   	push   %rbx
+  80273a:	48 83 ec 08          	sub    $0x8,%rsp
+  80273e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802741:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  802748:	00 00 00 
+  80274b:	ff d0                	call   *%rax
+  80274d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802753:	77 45                	ja     80279a <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802755:	48 89 de             	mov    %rbx,%rsi
+  802758:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80275f:	00 00 00 
+  802762:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80276e:	be 00 00 00 00       	mov    $0x0,%esi
+  802773:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802778:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  80277f:	00 00 00 
+  802782:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802784:	85 c0                	test   %eax,%eax
+  802786:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80278e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802792:	c9                   	leave
+  802793:	c3                   	ret
+        return -E_INVAL;
+  802794:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802799:	c3                   	ret
+        return -E_INVAL;
+  80279a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80279f:	eb ed                	jmp    80278e <devfile_accept_snapshot+0x5e>
+
+00000000008027a1 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8027a1:	48 85 ff             	test   %rdi,%rdi
+  8027a4:	0f 84 9f 00 00 00    	je     802849 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8027aa:	55                   	push   %rbp
+  8027ab:	48 89 e5             	mov    %rsp,%rbp
+  8027ae:	41 54                	push   %r12
+  8027b0:	53                   	push   %rbx
+  8027b1:	48 89 fb             	mov    %rdi,%rbx
+  8027b4:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027b7:	48 85 f6             	test   %rsi,%rsi
+  8027ba:	74 78                	je     802834 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027bc:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027ce:	77 6b                	ja     80283b <devfile_create_snapshot+0x9a>
+  8027d0:	4c 89 e7             	mov    %r12,%rdi
+  8027d3:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  8027da:	00 00 00 
+  8027dd:	ff d0                	call   *%rax
+  8027df:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027e5:	77 5b                	ja     802842 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027e7:	48 89 de             	mov    %rbx,%rsi
+  8027ea:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027f1:	00 00 00 
+  8027f4:	48 bb 00 0b 80 00 00 	movabs $0x800b00,%rbx
+  8027fb:	00 00 00 
+  8027fe:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802800:	4c 89 e6             	mov    %r12,%rsi
+  802803:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80280a:	00 00 00 
+  80280d:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80280f:	be 00 00 00 00       	mov    $0x0,%esi
+  802814:	bf 08 00 00 00       	mov    $0x8,%edi
+  802819:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802825:	85 c0                	test   %eax,%eax
+  802827:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80282f:	5b                   	pop    %rbx
+  802830:	41 5c                	pop    %r12
+  802832:	5d                   	pop    %rbp
+  802833:	c3                   	ret
+        return -E_INVAL;
+  802834:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802839:	eb f4                	jmp    80282f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80283b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802840:	eb ed                	jmp    80282f <devfile_create_snapshot+0x8e>
+  802842:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802847:	eb e6                	jmp    80282f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80284e:	c3                   	ret
+
+000000000080284f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+  802853:	41 54                	push   %r12
+  802855:	53                   	push   %rbx
+  802856:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802859:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80285c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802863:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802865:	be 00 00 00 00       	mov    $0x0,%esi
+  80286a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80286f:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	78 3d                	js     8028bc <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80287f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802886:	00 00 00 
+  802889:	4c 89 e6             	mov    %r12,%rsi
+  80288c:	48 89 df             	mov    %rbx,%rdi
+  80288f:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80289b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8028a2:	00 
+  8028a3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028a9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8028b0:	00 
+  8028b1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028bc:	5b                   	pop    %rbx
+  8028bd:	41 5c                	pop    %r12
+  8028bf:	5d                   	pop    %rbp
+  8028c0:	c3                   	ret
+
+00000000008028c1 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028c1:	55                   	push   %rbp
+  8028c2:	48 89 e5             	mov    %rsp,%rbp
+  8028c5:	41 57                	push   %r15
+  8028c7:	41 56                	push   %r14
+  8028c9:	41 55                	push   %r13
+  8028cb:	41 54                	push   %r12
+  8028cd:	53                   	push   %rbx
+  8028ce:	48 83 ec 38          	sub    $0x38,%rsp
+  8028d2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028d6:	49 89 f5             	mov    %rsi,%r13
+  8028d9:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028dc:	48 89 f0             	mov    %rsi,%rax
+  8028df:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028e4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028e8:	75 4f                	jne    802939 <devfile_readmap+0x78>
+  8028ea:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028ee:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028f4:	75 1f                	jne    802915 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8028f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028fa:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8028fe:	49 be a9 30 80 00 00 	movabs $0x8030a9,%r14
+  802905:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802908:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  80290f:	0f 87 9d 00 00 00    	ja     8029b2 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802915:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802919:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80291d:	4d 85 ff             	test   %r15,%r15
+  802920:	0f 85 cf 00 00 00    	jne    8029f5 <devfile_readmap+0x134>
+  802926:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80292a:	48 83 c4 38          	add    $0x38,%rsp
+  80292e:	5b                   	pop    %rbx
+  80292f:	41 5c                	pop    %r12
+  802931:	41 5d                	pop    %r13
+  802933:	41 5e                	pop    %r14
+  802935:	41 5f                	pop    %r15
+  802937:	5d                   	pop    %rbp
+  802938:	c3                   	ret
+    size_t totalRead = 0;
+  802939:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802940:	00 
+  802941:	eb da                	jmp    80291d <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802943:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802947:	8b 40 0c             	mov    0xc(%rax),%eax
+  80294a:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802951:	00 00 00 
+  802954:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802956:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80295a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  80295e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802962:	4c 89 ee             	mov    %r13,%rsi
+  802965:	bf 14 00 00 00       	mov    $0x14,%edi
+  80296a:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802976:	85 c0                	test   %eax,%eax
+  802978:	7e a3                	jle    80291d <devfile_readmap+0x5c>
+  80297a:	48 98                	cltq
+  80297c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802980:	72 9b                	jb     80291d <devfile_readmap+0x5c>
+        buf += read;
+  802982:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802985:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802988:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80298c:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802993:	75 88                	jne    80291d <devfile_readmap+0x5c>
+  802995:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802999:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80299f:	0f 85 78 ff ff ff    	jne    80291d <devfile_readmap+0x5c>
+  8029a5:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  8029ac:	0f 86 6b ff ff ff    	jbe    80291d <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029b2:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029b8:	4d 39 e7             	cmp    %r12,%r15
+  8029bb:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029bf:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029c6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029ca:	0f 84 73 ff ff ff    	je     802943 <devfile_readmap+0x82>
+  8029d0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029d4:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029d9:	41 ff d6             	call   *%r14
+  8029dc:	a8 40                	test   $0x40,%al
+  8029de:	0f 85 39 ff ff ff    	jne    80291d <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029e4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029eb:	4c 39 e3             	cmp    %r12,%rbx
+  8029ee:	72 e4                	jb     8029d4 <devfile_readmap+0x113>
+  8029f0:	e9 4e ff ff ff       	jmp    802943 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8029f5:	4c 89 fa             	mov    %r15,%rdx
+  8029f8:	4c 89 ee             	mov    %r13,%rsi
+  8029fb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029ff:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802a06:	00 00 00 
+  802a09:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a0b:	48 85 c0             	test   %rax,%rax
+  802a0e:	78 0c                	js     802a1c <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a10:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a14:	48 01 f0             	add    %rsi,%rax
+  802a17:	e9 0e ff ff ff       	jmp    80292a <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a1c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a20:	48 85 f6             	test   %rsi,%rsi
+  802a23:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a27:	e9 fe fe ff ff       	jmp    80292a <devfile_readmap+0x69>
+
+0000000000802a2c <open>:
+open(const char *path, int mode) {
+  802a2c:	55                   	push   %rbp
+  802a2d:	48 89 e5             	mov    %rsp,%rbp
+  802a30:	41 55                	push   %r13
+  802a32:	41 54                	push   %r12
+  802a34:	53                   	push   %rbx
+  802a35:	48 83 ec 18          	sub    $0x18,%rsp
+  802a39:	49 89 fc             	mov    %rdi,%r12
+  802a3c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a3f:	48 b8 c2 0a 80 00 00 	movabs $0x800ac2,%rax
+  802a46:	00 00 00 
+  802a49:	ff d0                	call   *%rax
+  802a4b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a51:	0f 87 8a 00 00 00    	ja     802ae1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a57:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a5b:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+  802a67:	89 c3                	mov    %eax,%ebx
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	78 50                	js     802abd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a6d:	4c 89 e6             	mov    %r12,%rsi
+  802a70:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a77:	00 00 00 
+  802a7a:	48 89 df             	mov    %rbx,%rdi
+  802a7d:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a89:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a90:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a94:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a99:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802aa0:	00 00 00 
+  802aa3:	ff d0                	call   *%rax
+  802aa5:	89 c3                	mov    %eax,%ebx
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	78 1f                	js     802aca <open+0x9e>
+    return fd2num(fd);
+  802aab:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802aaf:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802ab6:	00 00 00 
+  802ab9:	ff d0                	call   *%rax
+  802abb:	89 c3                	mov    %eax,%ebx
+}
+  802abd:	89 d8                	mov    %ebx,%eax
+  802abf:	48 83 c4 18          	add    $0x18,%rsp
+  802ac3:	5b                   	pop    %rbx
+  802ac4:	41 5c                	pop    %r12
+  802ac6:	41 5d                	pop    %r13
+  802ac8:	5d                   	pop    %rbp
+  802ac9:	c3                   	ret
+        fd_close(fd, 0);
+  802aca:	be 00 00 00 00       	mov    $0x0,%esi
+  802acf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ad3:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  802ada:	00 00 00 
+  802add:	ff d0                	call   *%rax
+        return res;
+  802adf:	eb dc                	jmp    802abd <open+0x91>
+        return -E_BAD_PATH;
+  802ae1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ae6:	eb d5                	jmp    802abd <open+0x91>
+
+0000000000802ae8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802aec:	be 00 00 00 00       	mov    $0x0,%esi
+  802af1:	bf 13 00 00 00       	mov    $0x13,%edi
+  802af6:	48 b8 07 21 80 00 00 	movabs $0x802107,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+}
+  802b02:	5d                   	pop    %rbp
+  802b03:	c3                   	ret
+
+0000000000802b04 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b04:	55                   	push   %rbp
+  802b05:	48 89 e5             	mov    %rsp,%rbp
+  802b08:	41 54                	push   %r12
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b0e:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802b15:	00 00 00 
+  802b18:	ff d0                	call   *%rax
+  802b1a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b1d:	48 be 00 3d 80 00 00 	movabs $0x803d00,%rsi
+  802b24:	00 00 00 
+  802b27:	48 89 df             	mov    %rbx,%rdi
+  802b2a:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b36:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b3b:	41 2b 04 24          	sub    (%r12),%eax
+  802b3f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b4c:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b4f:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b56:	00 00 00 
+  802b59:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b65:	5b                   	pop    %rbx
+  802b66:	41 5c                	pop    %r12
+  802b68:	5d                   	pop    %rbp
+  802b69:	c3                   	ret
+
+0000000000802b6a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b6a:	55                   	push   %rbp
+  802b6b:	48 89 e5             	mov    %rsp,%rbp
+  802b6e:	41 54                	push   %r12
+  802b70:	53                   	push   %rbx
+  802b71:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b79:	48 89 fe             	mov    %rdi,%rsi
+  802b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b81:	49 bc 58 12 80 00 00 	movabs $0x801258,%r12
+  802b88:	00 00 00 
+  802b8b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b8e:	48 89 df             	mov    %rbx,%rdi
+  802b91:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	48 89 c6             	mov    %rax,%rsi
+  802ba0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802baa:	41 ff d4             	call   *%r12
+}
+  802bad:	5b                   	pop    %rbx
+  802bae:	41 5c                	pop    %r12
+  802bb0:	5d                   	pop    %rbp
+  802bb1:	c3                   	ret
+
+0000000000802bb2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	41 57                	push   %r15
+  802bb8:	41 56                	push   %r14
+  802bba:	41 55                	push   %r13
+  802bbc:	41 54                	push   %r12
+  802bbe:	53                   	push   %rbx
+  802bbf:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc3:	49 89 fc             	mov    %rdi,%r12
+  802bc6:	49 89 f5             	mov    %rsi,%r13
+  802bc9:	49 89 d7             	mov    %rdx,%r15
+  802bcc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bd0:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bdc:	4d 85 ff             	test   %r15,%r15
+  802bdf:	0f 84 af 00 00 00    	je     802c94 <devpipe_write+0xe2>
+  802be5:	48 89 c3             	mov    %rax,%rbx
+  802be8:	4c 89 f8             	mov    %r15,%rax
+  802beb:	4d 89 ef             	mov    %r13,%r15
+  802bee:	4c 01 e8             	add    %r13,%rax
+  802bf1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bf5:	49 bd 60 11 80 00 00 	movabs $0x801160,%r13
+  802bfc:	00 00 00 
+            sys_yield();
+  802bff:	49 be fd 10 80 00 00 	movabs $0x8010fd,%r14
+  802c06:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c09:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c0c:	48 63 ce             	movslq %esi,%rcx
+  802c0f:	48 63 03             	movslq (%rbx),%rax
+  802c12:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c18:	48 39 c1             	cmp    %rax,%rcx
+  802c1b:	72 2e                	jb     802c4b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c1d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c22:	48 89 da             	mov    %rbx,%rdx
+  802c25:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c2a:	4c 89 e7             	mov    %r12,%rdi
+  802c2d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	74 66                	je     802c9a <devpipe_write+0xe8>
+            sys_yield();
+  802c34:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c37:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c3a:	48 63 ce             	movslq %esi,%rcx
+  802c3d:	48 63 03             	movslq (%rbx),%rax
+  802c40:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c46:	48 39 c1             	cmp    %rax,%rcx
+  802c49:	73 d2                	jae    802c1d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c4b:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c4f:	48 89 ca             	mov    %rcx,%rdx
+  802c52:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c56:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c5d:	08 10 20 
+  802c60:	48 f7 e2             	mul    %rdx
+  802c63:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c67:	48 89 d0             	mov    %rdx,%rax
+  802c6a:	48 c1 e0 09          	shl    $0x9,%rax
+  802c6e:	48 29 d0             	sub    %rdx,%rax
+  802c71:	48 c1 e0 03          	shl    $0x3,%rax
+  802c75:	48 29 c1             	sub    %rax,%rcx
+  802c78:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c7d:	83 c6 01             	add    $0x1,%esi
+  802c80:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c83:	49 83 c7 01          	add    $0x1,%r15
+  802c87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8b:	49 39 c7             	cmp    %rax,%r15
+  802c8e:	0f 85 75 ff ff ff    	jne    802c09 <devpipe_write+0x57>
+    return n;
+  802c94:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c98:	eb 05                	jmp    802c9f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9f:	48 83 c4 18          	add    $0x18,%rsp
+  802ca3:	5b                   	pop    %rbx
+  802ca4:	41 5c                	pop    %r12
+  802ca6:	41 5d                	pop    %r13
+  802ca8:	41 5e                	pop    %r14
+  802caa:	41 5f                	pop    %r15
+  802cac:	5d                   	pop    %rbp
+  802cad:	c3                   	ret
+
+0000000000802cae <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cae:	55                   	push   %rbp
+  802caf:	48 89 e5             	mov    %rsp,%rbp
+  802cb2:	41 57                	push   %r15
+  802cb4:	41 56                	push   %r14
+  802cb6:	41 55                	push   %r13
+  802cb8:	41 54                	push   %r12
+  802cba:	53                   	push   %rbx
+  802cbb:	48 83 ec 18          	sub    $0x18,%rsp
+  802cbf:	49 89 fc             	mov    %rdi,%r12
+  802cc2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cc6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cca:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cd9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cdf:	49 bd 60 11 80 00 00 	movabs $0x801160,%r13
+  802ce6:	00 00 00 
+            sys_yield();
+  802ce9:	49 be fd 10 80 00 00 	movabs $0x8010fd,%r14
+  802cf0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802cf3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802cf8:	74 7d                	je     802d77 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802cfa:	8b 03                	mov    (%rbx),%eax
+  802cfc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802cff:	75 26                	jne    802d27 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d01:	4d 85 ff             	test   %r15,%r15
+  802d04:	75 77                	jne    802d7d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d06:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d0b:	48 89 da             	mov    %rbx,%rdx
+  802d0e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d13:	4c 89 e7             	mov    %r12,%rdi
+  802d16:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	74 72                	je     802d8f <devpipe_read+0xe1>
+            sys_yield();
+  802d1d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d20:	8b 03                	mov    (%rbx),%eax
+  802d22:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d25:	74 df                	je     802d06 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d27:	48 63 c8             	movslq %eax,%rcx
+  802d2a:	48 89 ca             	mov    %rcx,%rdx
+  802d2d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d31:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d38:	08 10 20 
+  802d3b:	48 89 d0             	mov    %rdx,%rax
+  802d3e:	48 f7 e6             	mul    %rsi
+  802d41:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d45:	48 89 d0             	mov    %rdx,%rax
+  802d48:	48 c1 e0 09          	shl    $0x9,%rax
+  802d4c:	48 29 d0             	sub    %rdx,%rax
+  802d4f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d56:	00 
+  802d57:	48 89 c8             	mov    %rcx,%rax
+  802d5a:	48 29 d0             	sub    %rdx,%rax
+  802d5d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d62:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d66:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d6a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d6d:	49 83 c7 01          	add    $0x1,%r15
+  802d71:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d75:	75 83                	jne    802cfa <devpipe_read+0x4c>
+    return n;
+  802d77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d7b:	eb 03                	jmp    802d80 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d7d:	4c 89 f8             	mov    %r15,%rax
+}
+  802d80:	48 83 c4 18          	add    $0x18,%rsp
+  802d84:	5b                   	pop    %rbx
+  802d85:	41 5c                	pop    %r12
+  802d87:	41 5d                	pop    %r13
+  802d89:	41 5e                	pop    %r14
+  802d8b:	41 5f                	pop    %r15
+  802d8d:	5d                   	pop    %rbp
+  802d8e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d94:	eb ea                	jmp    802d80 <devpipe_read+0xd2>
+
+0000000000802d96 <pipe>:
+pipe(int pfd[2]) {
+  802d96:	55                   	push   %rbp
+  802d97:	48 89 e5             	mov    %rsp,%rbp
+  802d9a:	41 55                	push   %r13
+  802d9c:	41 54                	push   %r12
+  802d9e:	53                   	push   %rbx
+  802d9f:	48 83 ec 18          	sub    $0x18,%rsp
+  802da3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802da6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802daa:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+  802db6:	89 c3                	mov    %eax,%ebx
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	0f 88 a0 01 00 00    	js     802f60 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802dc0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dca:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dce:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd3:	48 b8 8c 11 80 00 00 	movabs $0x80118c,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+  802ddf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802de1:	85 c0                	test   %eax,%eax
+  802de3:	0f 88 77 01 00 00    	js     802f60 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802de9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ded:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+  802df9:	89 c3                	mov    %eax,%ebx
+  802dfb:	85 c0                	test   %eax,%eax
+  802dfd:	0f 88 43 01 00 00    	js     802f46 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e03:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e0d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e16:	48 b8 8c 11 80 00 00 	movabs $0x80118c,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+  802e22:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	0f 88 1a 01 00 00    	js     802f46 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e30:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802e37:	00 00 00 
+  802e3a:	ff d0                	call   *%rax
+  802e3c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e3f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e44:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e49:	48 89 c6             	mov    %rax,%rsi
+  802e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e51:	48 b8 8c 11 80 00 00 	movabs $0x80118c,%rax
+  802e58:	00 00 00 
+  802e5b:	ff d0                	call   *%rax
+  802e5d:	89 c3                	mov    %eax,%ebx
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	0f 88 c5 00 00 00    	js     802f2c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e67:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e6b:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802e72:	00 00 00 
+  802e75:	ff d0                	call   *%rax
+  802e77:	48 89 c1             	mov    %rax,%rcx
+  802e7a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e80:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8b:	4c 89 ee             	mov    %r13,%rsi
+  802e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e93:	48 b8 f3 11 80 00 00 	movabs $0x8011f3,%rax
+  802e9a:	00 00 00 
+  802e9d:	ff d0                	call   *%rax
+  802e9f:	89 c3                	mov    %eax,%ebx
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	78 6e                	js     802f13 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ea5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eaa:	4c 89 ef             	mov    %r13,%rdi
+  802ead:	48 b8 2e 11 80 00 00 	movabs $0x80112e,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+  802eb9:	83 f8 02             	cmp    $0x2,%eax
+  802ebc:	0f 85 ab 00 00 00    	jne    802f6d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802ec2:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802ec9:	00 00 
+  802ecb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ecf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ed1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ed5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802edc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ee0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ee2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ee6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802eed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef1:	48 bb 5c 15 80 00 00 	movabs $0x80155c,%rbx
+  802ef8:	00 00 00 
+  802efb:	ff d3                	call   *%rbx
+  802efd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f01:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f05:	ff d3                	call   *%rbx
+  802f07:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f11:	eb 4d                	jmp    802f60 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f18:	4c 89 ee             	mov    %r13,%rsi
+  802f1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f20:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f31:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3a:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f4b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f54:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802f5b:	00 00 00 
+  802f5e:	ff d0                	call   *%rax
+}
+  802f60:	89 d8                	mov    %ebx,%eax
+  802f62:	48 83 c4 18          	add    $0x18,%rsp
+  802f66:	5b                   	pop    %rbx
+  802f67:	41 5c                	pop    %r12
+  802f69:	41 5d                	pop    %r13
+  802f6b:	5d                   	pop    %rbp
+  802f6c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f6d:	48 b9 30 3d 80 00 00 	movabs $0x803d30,%rcx
+  802f74:	00 00 00 
+  802f77:	48 ba 07 3d 80 00 00 	movabs $0x803d07,%rdx
+  802f7e:	00 00 00 
+  802f81:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f86:	48 bf 1c 3d 80 00 00 	movabs $0x803d1c,%rdi
+  802f8d:	00 00 00 
+  802f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f95:	49 b8 ed 33 80 00 00 	movabs $0x8033ed,%r8
+  802f9c:	00 00 00 
+  802f9f:	41 ff d0             	call   *%r8
+
+0000000000802fa2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802fa2:	55                   	push   %rbp
+  802fa3:	48 89 e5             	mov    %rsp,%rbp
+  802fa6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802faa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fae:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	78 35                	js     802ff3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fbe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fc2:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+  802fce:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fd1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fd6:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fdb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fdf:	48 b8 60 11 80 00 00 	movabs $0x801160,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	0f 94 c0             	sete   %al
+  802ff0:	0f b6 c0             	movzbl %al,%eax
+}
+  802ff3:	c9                   	leave
+  802ff4:	c3                   	ret
+
+0000000000802ff5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ff5:	48 89 f8             	mov    %rdi,%rax
+  802ff8:	48 c1 e8 27          	shr    $0x27,%rax
+  802ffc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803003:	01 00 00 
+  803006:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80300a:	f6 c2 01             	test   $0x1,%dl
+  80300d:	74 6d                	je     80307c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80300f:	48 89 f8             	mov    %rdi,%rax
+  803012:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803016:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80301d:	01 00 00 
+  803020:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803024:	f6 c2 01             	test   $0x1,%dl
+  803027:	74 62                	je     80308b <get_uvpt_entry+0x96>
+  803029:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803030:	01 00 00 
+  803033:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803037:	f6 c2 80             	test   $0x80,%dl
+  80303a:	75 4f                	jne    80308b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80303c:	48 89 f8             	mov    %rdi,%rax
+  80303f:	48 c1 e8 15          	shr    $0x15,%rax
+  803043:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80304a:	01 00 00 
+  80304d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803051:	f6 c2 01             	test   $0x1,%dl
+  803054:	74 44                	je     80309a <get_uvpt_entry+0xa5>
+  803056:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80305d:	01 00 00 
+  803060:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803064:	f6 c2 80             	test   $0x80,%dl
+  803067:	75 31                	jne    80309a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803069:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80306d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803074:	01 00 00 
+  803077:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80307b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80307c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803083:	01 00 00 
+  803086:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80308a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80308b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803092:	01 00 00 
+  803095:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803099:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80309a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030a1:	01 00 00 
+  8030a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030a8:	c3                   	ret
+
+00000000008030a9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8030a9:	55                   	push   %rbp
+  8030aa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030ad:	48 b8 f5 2f 80 00 00 	movabs $0x802ff5,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+  8030b9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030bc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030c1:	89 c1                	mov    %eax,%ecx
+  8030c3:	83 c9 04             	or     $0x4,%ecx
+  8030c6:	f6 c2 01             	test   $0x1,%dl
+  8030c9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030cc:	89 c1                	mov    %eax,%ecx
+  8030ce:	83 c9 02             	or     $0x2,%ecx
+  8030d1:	f6 c2 02             	test   $0x2,%dl
+  8030d4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030d7:	89 c1                	mov    %eax,%ecx
+  8030d9:	83 c9 01             	or     $0x1,%ecx
+  8030dc:	48 85 d2             	test   %rdx,%rdx
+  8030df:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030e2:	89 c1                	mov    %eax,%ecx
+  8030e4:	83 c9 40             	or     $0x40,%ecx
+  8030e7:	f6 c6 04             	test   $0x4,%dh
+  8030ea:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+
+00000000008030ef <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030f3:	48 b8 f5 2f 80 00 00 	movabs $0x802ff5,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8030ff:	48 c1 e8 06          	shr    $0x6,%rax
+  803103:	83 e0 01             	and    $0x1,%eax
+}
+  803106:	5d                   	pop    %rbp
+  803107:	c3                   	ret
+
+0000000000803108 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803108:	55                   	push   %rbp
+  803109:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80310c:	48 b8 f5 2f 80 00 00 	movabs $0x802ff5,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803118:	48 c1 e8 05          	shr    $0x5,%rax
+  80311c:	83 e0 01             	and    $0x1,%eax
+}
+  80311f:	5d                   	pop    %rbp
+  803120:	c3                   	ret
+
+0000000000803121 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803121:	55                   	push   %rbp
+  803122:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803125:	48 b8 f5 2f 80 00 00 	movabs $0x802ff5,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+  803131:	83 e0 01             	and    $0x1,%eax
+}
+  803134:	5d                   	pop    %rbp
+  803135:	c3                   	ret
+
+0000000000803136 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803136:	55                   	push   %rbp
+  803137:	48 89 e5             	mov    %rsp,%rbp
+  80313a:	41 57                	push   %r15
+  80313c:	41 56                	push   %r14
+  80313e:	41 55                	push   %r13
+  803140:	41 54                	push   %r12
+  803142:	53                   	push   %rbx
+  803143:	48 83 ec 18          	sub    $0x18,%rsp
+  803147:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80314b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80314f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803154:	49 bd 21 31 80 00 00 	movabs $0x803121,%r13
+  80315b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80315e:	49 bf a9 30 80 00 00 	movabs $0x8030a9,%r15
+  803165:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803168:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80316f:	00 00 00 
+  803172:	eb 0c                	jmp    803180 <foreach_shared_region+0x4a>
+  803174:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80317b:	4c 39 f3             	cmp    %r14,%rbx
+  80317e:	74 2e                	je     8031ae <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803180:	48 89 df             	mov    %rbx,%rdi
+  803183:	41 ff d5             	call   *%r13
+  803186:	84 c0                	test   %al,%al
+  803188:	74 ea                	je     803174 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80318a:	48 89 df             	mov    %rbx,%rdi
+  80318d:	41 ff d7             	call   *%r15
+  803190:	a8 40                	test   $0x40,%al
+  803192:	74 e0                	je     803174 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803194:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80319b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80319f:	48 89 df             	mov    %rbx,%rdi
+  8031a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031a6:	ff d0                	call   *%rax
+				if (res < 0) {
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	79 c8                	jns    803174 <foreach_shared_region+0x3e>
+  8031ac:	eb 05                	jmp    8031b3 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b3:	48 83 c4 18          	add    $0x18,%rsp
+  8031b7:	5b                   	pop    %rbx
+  8031b8:	41 5c                	pop    %r12
+  8031ba:	41 5d                	pop    %r13
+  8031bc:	41 5e                	pop    %r14
+  8031be:	41 5f                	pop    %r15
+  8031c0:	5d                   	pop    %rbp
+  8031c1:	c3                   	ret
+
+00000000008031c2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c7:	c3                   	ret
+
+00000000008031c8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031c8:	55                   	push   %rbp
+  8031c9:	48 89 e5             	mov    %rsp,%rbp
+  8031cc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031cf:	48 be 54 3d 80 00 00 	movabs $0x803d54,%rsi
+  8031d6:	00 00 00 
+  8031d9:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+    return 0;
+}
+  8031e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ea:	5d                   	pop    %rbp
+  8031eb:	c3                   	ret
+
+00000000008031ec <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031ec:	55                   	push   %rbp
+  8031ed:	48 89 e5             	mov    %rsp,%rbp
+  8031f0:	41 57                	push   %r15
+  8031f2:	41 56                	push   %r14
+  8031f4:	41 55                	push   %r13
+  8031f6:	41 54                	push   %r12
+  8031f8:	53                   	push   %rbx
+  8031f9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803200:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803207:	48 85 d2             	test   %rdx,%rdx
+  80320a:	74 7a                	je     803286 <devcons_write+0x9a>
+  80320c:	49 89 d6             	mov    %rdx,%r14
+  80320f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803215:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80321a:	49 bf fa 0c 80 00 00 	movabs $0x800cfa,%r15
+  803221:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803224:	4c 89 f3             	mov    %r14,%rbx
+  803227:	48 29 f3             	sub    %rsi,%rbx
+  80322a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80322f:	48 39 c3             	cmp    %rax,%rbx
+  803232:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803236:	4c 63 eb             	movslq %ebx,%r13
+  803239:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803240:	48 01 c6             	add    %rax,%rsi
+  803243:	4c 89 ea             	mov    %r13,%rdx
+  803246:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80324d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803250:	4c 89 ee             	mov    %r13,%rsi
+  803253:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80325a:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803266:	41 01 dc             	add    %ebx,%r12d
+  803269:	49 63 f4             	movslq %r12d,%rsi
+  80326c:	4c 39 f6             	cmp    %r14,%rsi
+  80326f:	72 b3                	jb     803224 <devcons_write+0x38>
+    return res;
+  803271:	49 63 c4             	movslq %r12d,%rax
+}
+  803274:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80327b:	5b                   	pop    %rbx
+  80327c:	41 5c                	pop    %r12
+  80327e:	41 5d                	pop    %r13
+  803280:	41 5e                	pop    %r14
+  803282:	41 5f                	pop    %r15
+  803284:	5d                   	pop    %rbp
+  803285:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803286:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80328c:	eb e3                	jmp    803271 <devcons_write+0x85>
+
+000000000080328e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80328e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803291:	ba 00 00 00 00       	mov    $0x0,%edx
+  803296:	48 85 c0             	test   %rax,%rax
+  803299:	74 55                	je     8032f0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80329b:	55                   	push   %rbp
+  80329c:	48 89 e5             	mov    %rsp,%rbp
+  80329f:	41 55                	push   %r13
+  8032a1:	41 54                	push   %r12
+  8032a3:	53                   	push   %rbx
+  8032a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8032a8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8032ab:	48 bb 30 10 80 00 00 	movabs $0x801030,%rbx
+  8032b2:	00 00 00 
+  8032b5:	49 bc fd 10 80 00 00 	movabs $0x8010fd,%r12
+  8032bc:	00 00 00 
+  8032bf:	eb 03                	jmp    8032c4 <devcons_read+0x36>
+  8032c1:	41 ff d4             	call   *%r12
+  8032c4:	ff d3                	call   *%rbx
+  8032c6:	85 c0                	test   %eax,%eax
+  8032c8:	74 f7                	je     8032c1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8032ca:	48 63 d0             	movslq %eax,%rdx
+  8032cd:	78 13                	js     8032e2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d4:	83 f8 04             	cmp    $0x4,%eax
+  8032d7:	74 09                	je     8032e2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032d9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032dd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032e2:	48 89 d0             	mov    %rdx,%rax
+  8032e5:	48 83 c4 08          	add    $0x8,%rsp
+  8032e9:	5b                   	pop    %rbx
+  8032ea:	41 5c                	pop    %r12
+  8032ec:	41 5d                	pop    %r13
+  8032ee:	5d                   	pop    %rbp
+  8032ef:	c3                   	ret
+  8032f0:	48 89 d0             	mov    %rdx,%rax
+  8032f3:	c3                   	ret
+
+00000000008032f4 <cputchar>:
+cputchar(int ch) {
+  8032f4:	55                   	push   %rbp
+  8032f5:	48 89 e5             	mov    %rsp,%rbp
+  8032f8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032fc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803300:	be 01 00 00 00       	mov    $0x1,%esi
+  803305:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803309:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  803310:	00 00 00 
+  803313:	ff d0                	call   *%rax
+}
+  803315:	c9                   	leave
+  803316:	c3                   	ret
+
+0000000000803317 <getchar>:
+getchar(void) {
+  803317:	55                   	push   %rbp
+  803318:	48 89 e5             	mov    %rsp,%rbp
+  80331b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80331f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803324:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803328:	bf 00 00 00 00       	mov    $0x0,%edi
+  80332d:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+  803339:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	78 06                	js     803345 <getchar+0x2e>
+  80333f:	74 08                	je     803349 <getchar+0x32>
+  803341:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803345:	89 d0                	mov    %edx,%eax
+  803347:	c9                   	leave
+  803348:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803349:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80334e:	eb f5                	jmp    803345 <getchar+0x2e>
+
+0000000000803350 <iscons>:
+iscons(int fdnum) {
+  803350:	55                   	push   %rbp
+  803351:	48 89 e5             	mov    %rsp,%rbp
+  803354:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803358:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80335c:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  803363:	00 00 00 
+  803366:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	78 18                	js     803384 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80336c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803370:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803377:	00 00 00 
+  80337a:	8b 00                	mov    (%rax),%eax
+  80337c:	39 02                	cmp    %eax,(%rdx)
+  80337e:	0f 94 c0             	sete   %al
+  803381:	0f b6 c0             	movzbl %al,%eax
+}
+  803384:	c9                   	leave
+  803385:	c3                   	ret
+
+0000000000803386 <opencons>:
+opencons(void) {
+  803386:	55                   	push   %rbp
+  803387:	48 89 e5             	mov    %rsp,%rbp
+  80338a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80338e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803392:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	78 49                	js     8033eb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8033a2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033ac:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8033b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b5:	48 b8 8c 11 80 00 00 	movabs $0x80118c,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	85 c0                	test   %eax,%eax
+  8033c3:	78 26                	js     8033eb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c9:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033d0:	00 00 
+  8033d2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033d4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033d8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033df:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+}
+  8033eb:	c9                   	leave
+  8033ec:	c3                   	ret
+
+00000000008033ed <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033ed:	55                   	push   %rbp
+  8033ee:	48 89 e5             	mov    %rsp,%rbp
+  8033f1:	41 56                	push   %r14
+  8033f3:	41 55                	push   %r13
+  8033f5:	41 54                	push   %r12
+  8033f7:	53                   	push   %rbx
+  8033f8:	48 83 ec 50          	sub    $0x50,%rsp
+  8033fc:	49 89 fc             	mov    %rdi,%r12
+  8033ff:	41 89 f5             	mov    %esi,%r13d
+  803402:	48 89 d3             	mov    %rdx,%rbx
+  803405:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803409:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80340d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803411:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803418:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80341c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803420:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803424:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803428:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80342f:	00 00 00 
+  803432:	4c 8b 30             	mov    (%rax),%r14
+  803435:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  80343c:	00 00 00 
+  80343f:	ff d0                	call   *%rax
+  803441:	89 c6                	mov    %eax,%esi
+  803443:	45 89 e8             	mov    %r13d,%r8d
+  803446:	4c 89 e1             	mov    %r12,%rcx
+  803449:	4c 89 f2             	mov    %r14,%rdx
+  80344c:	48 bf 60 3d 80 00 00 	movabs $0x803d60,%rdi
+  803453:	00 00 00 
+  803456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345b:	49 bc db 01 80 00 00 	movabs $0x8001db,%r12
+  803462:	00 00 00 
+  803465:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803468:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80346c:	48 89 df             	mov    %rbx,%rdi
+  80346f:	48 b8 77 01 80 00 00 	movabs $0x800177,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+    cprintf("\n");
+  80347b:	48 bf b3 3c 80 00 00 	movabs $0x803cb3,%rdi
+  803482:	00 00 00 
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80348d:	cc                   	int3
+  80348e:	eb fd                	jmp    80348d <_panic+0xa0>
+
+0000000000803490 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803490:	55                   	push   %rbp
+  803491:	48 89 e5             	mov    %rsp,%rbp
+  803494:	41 55                	push   %r13
+  803496:	41 54                	push   %r12
+  803498:	53                   	push   %rbx
+  803499:	48 83 ec 08          	sub    $0x8,%rsp
+  80349d:	49 89 fc             	mov    %rdi,%r12
+  8034a0:	48 89 f7             	mov    %rsi,%rdi
+  8034a3:	48 89 d3             	mov    %rdx,%rbx
+  8034a6:	49 89 cd             	mov    %rcx,%r13
+  8034a9:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8034ac:	48 85 f6             	test   %rsi,%rsi
+  8034af:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034b6:	00 00 00 
+  8034b9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034c2:	48 85 db             	test   %rbx,%rbx
+  8034c5:	74 03                	je     8034ca <ipc_recv_timed+0x3a>
+  8034c7:	48 8b 33             	mov    (%rbx),%rsi
+  8034ca:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  8034d1:	00 00 00 
+  8034d4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	78 75                	js     80354f <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034da:	4d 85 e4             	test   %r12,%r12
+  8034dd:	74 14                	je     8034f3 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034df:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e6:	00 00 00 
+  8034e9:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034ef:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034f3:	4d 85 ed             	test   %r13,%r13
+  8034f6:	74 14                	je     80350c <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034f8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ff:	00 00 00 
+  803502:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803508:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80350c:	48 85 db             	test   %rbx,%rbx
+  80350f:	74 23                	je     803534 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803511:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803518:	00 00 00 
+  80351b:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803521:	ba 00 00 00 00       	mov    $0x0,%edx
+  803526:	85 c9                	test   %ecx,%ecx
+  803528:	74 07                	je     803531 <ipc_recv_timed+0xa1>
+  80352a:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803531:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803534:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80353b:	00 00 00 
+  80353e:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803544:	48 83 c4 08          	add    $0x8,%rsp
+  803548:	5b                   	pop    %rbx
+  803549:	41 5c                	pop    %r12
+  80354b:	41 5d                	pop    %r13
+  80354d:	5d                   	pop    %rbp
+  80354e:	c3                   	ret
+        if (from_env_store != NULL) {
+  80354f:	4d 85 e4             	test   %r12,%r12
+  803552:	74 08                	je     80355c <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803554:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80355b:	00 
+        if (perm_store != NULL) {
+  80355c:	4d 85 ed             	test   %r13,%r13
+  80355f:	74 08                	je     803569 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803561:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803568:	00 
+        if (size != NULL) {
+  803569:	48 85 db             	test   %rbx,%rbx
+  80356c:	74 d6                	je     803544 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80356e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803575:	eb cd                	jmp    803544 <ipc_recv_timed+0xb4>
+
+0000000000803577 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803577:	55                   	push   %rbp
+  803578:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80357b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803581:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+}
+  80358d:	5d                   	pop    %rbp
+  80358e:	c3                   	ret
+
+000000000080358f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80358f:	55                   	push   %rbp
+  803590:	48 89 e5             	mov    %rsp,%rbp
+  803593:	41 57                	push   %r15
+  803595:	41 56                	push   %r14
+  803597:	41 55                	push   %r13
+  803599:	41 54                	push   %r12
+  80359b:	53                   	push   %rbx
+  80359c:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a0:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8035a3:	48 89 d3             	mov    %rdx,%rbx
+  8035a6:	49 89 cc             	mov    %rcx,%r12
+  8035a9:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035ac:	48 85 d2             	test   %rdx,%rdx
+  8035af:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035b6:	00 00 00 
+  8035b9:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035bd:	89 f0                	mov    %esi,%eax
+  8035bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035c3:	48 89 da             	mov    %rbx,%rdx
+  8035c6:	48 89 c6             	mov    %rax,%rsi
+  8035c9:	48 b8 fa 13 80 00 00 	movabs $0x8013fa,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035d5:	85 c0                	test   %eax,%eax
+  8035d7:	79 65                	jns    80363e <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035d9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035dc:	75 33                	jne    803611 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035de:	49 bf fd 10 80 00 00 	movabs $0x8010fd,%r15
+  8035e5:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035e8:	49 be fa 13 80 00 00 	movabs $0x8013fa,%r14
+  8035ef:	00 00 00 
+        sys_yield();
+  8035f2:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035f5:	45 89 e8             	mov    %r13d,%r8d
+  8035f8:	4c 89 e1             	mov    %r12,%rcx
+  8035fb:	48 89 da             	mov    %rbx,%rdx
+  8035fe:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803602:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803605:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	79 32                	jns    80363e <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80360c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80360f:	74 e1                	je     8035f2 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803611:	89 c1                	mov    %eax,%ecx
+  803613:	48 ba 83 3d 80 00 00 	movabs $0x803d83,%rdx
+  80361a:	00 00 00 
+  80361d:	be 52 00 00 00       	mov    $0x52,%esi
+  803622:	48 bf 97 3d 80 00 00 	movabs $0x803d97,%rdi
+  803629:	00 00 00 
+  80362c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803631:	49 b8 ed 33 80 00 00 	movabs $0x8033ed,%r8
+  803638:	00 00 00 
+  80363b:	41 ff d0             	call   *%r8
+    }
+}
+  80363e:	48 83 c4 18          	add    $0x18,%rsp
+  803642:	5b                   	pop    %rbx
+  803643:	41 5c                	pop    %r12
+  803645:	41 5d                	pop    %r13
+  803647:	41 5e                	pop    %r14
+  803649:	41 5f                	pop    %r15
+  80364b:	5d                   	pop    %rbp
+  80364c:	c3                   	ret
+
+000000000080364d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80364d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803652:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803659:	00 00 00 
+  80365c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803660:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803664:	48 c1 e2 04          	shl    $0x4,%rdx
+  803668:	48 01 ca             	add    %rcx,%rdx
+  80366b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803671:	39 fa                	cmp    %edi,%edx
+  803673:	74 12                	je     803687 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803675:	48 83 c0 01          	add    $0x1,%rax
+  803679:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80367f:	75 db                	jne    80365c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803681:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803686:	c3                   	ret
+            return envs[i].env_id;
+  803687:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80368b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80368f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803693:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  80369a:	00 00 00 
+  80369d:	48 01 d0             	add    %rdx,%rax
+  8036a0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036a6:	c3                   	ret
+  8036a7:	90                   	nop
+
+00000000008036a8 <__rodata_start>:
+  8036a8:	53                   	push   %rbx
+  8036a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036aa:	61                   	(bad)
+  8036ab:	70 73                	jo     803720 <__rodata_start+0x78>
+  8036ad:	68 6f 74 20 6c       	push   $0x6c20746f
+  8036b2:	69 73 74 20 63 61 6e 	imul   $0x6e616320,0x74(%rbx),%esi
+  8036b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036bb:	74 20                	je     8036dd <__rodata_start+0x35>
+  8036bd:	62 65                	(bad)
+  8036bf:	20 70 72             	and    %dh,0x72(%rax)
+  8036c2:	69 6e 74 65 64 0a 00 	imul   $0xa6465,0x74(%rsi),%ebp
+  8036c9:	3c 75                	cmp    $0x75,%al
+  8036cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036cc:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036d0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036d1:	3e 00 30             	ds add %dh,(%rax)
+  8036d4:	31 32                	xor    %esi,(%rdx)
+  8036d6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036dd:	41                   	rex.B
+  8036de:	42                   	rex.X
+  8036df:	43                   	rex.XB
+  8036e0:	44                   	rex.R
+  8036e1:	45                   	rex.RB
+  8036e2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036e5:	31 32                	xor    %esi,(%rdx)
+  8036e7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036ee:	61                   	(bad)
+  8036ef:	62 63 64 65 66       	(bad)
+  8036f4:	00 28                	add    %ch,(%rax)
+  8036f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f7:	75 6c                	jne    803765 <__rodata_start+0xbd>
+  8036f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036fa:	29 00                	sub    %eax,(%rax)
+  8036fc:	65 72 72             	gs jb  803771 <__rodata_start+0xc9>
+  8036ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803700:	72 20                	jb     803722 <__rodata_start+0x7a>
+  803702:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803707:	73 70                	jae    803779 <__rodata_start+0xd1>
+  803709:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80370d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803714:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803715:	72 00                	jb     803717 <__rodata_start+0x6f>
+  803717:	62 61 64 20 65       	(bad)
+  80371c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371d:	76 69                	jbe    803788 <__rodata_start+0xe0>
+  80371f:	72 6f                	jb     803790 <__rodata_start+0xe8>
+  803721:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803722:	6d                   	insl   (%dx),%es:(%rdi)
+  803723:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803725:	74 00                	je     803727 <__rodata_start+0x7f>
+  803727:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80372e:	20 70 61             	and    %dh,0x61(%rax)
+  803731:	72 61                	jb     803794 <__rodata_start+0xec>
+  803733:	6d                   	insl   (%dx),%es:(%rdi)
+  803734:	65 74 65             	gs je  80379c <__rodata_start+0xf4>
+  803737:	72 00                	jb     803739 <__rodata_start+0x91>
+  803739:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373a:	75 74                	jne    8037b0 <__rodata_start+0x108>
+  80373c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80373f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803742:	6d                   	insl   (%dx),%es:(%rdi)
+  803743:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803744:	72 79                	jb     8037bf <__rodata_start+0x117>
+  803746:	00 6f 75             	add    %ch,0x75(%rdi)
+  803749:	74 20                	je     80376b <__rodata_start+0xc3>
+  80374b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803750:	76 69                	jbe    8037bb <__rodata_start+0x113>
+  803752:	72 6f                	jb     8037c3 <__rodata_start+0x11b>
+  803754:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803755:	6d                   	insl   (%dx),%es:(%rdi)
+  803756:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803758:	74 73                	je     8037cd <__rodata_start+0x125>
+  80375a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80375d:	72 72                	jb     8037d1 <__rodata_start+0x129>
+  80375f:	75 70                	jne    8037d1 <__rodata_start+0x129>
+  803761:	74 65                	je     8037c8 <__rodata_start+0x120>
+  803763:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803768:	75 67                	jne    8037d1 <__rodata_start+0x129>
+  80376a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80376d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80376f:	00 73 65             	add    %dh,0x65(%rbx)
+  803772:	67 6d                	insl   (%dx),%es:(%edi)
+  803774:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803776:	74 61                	je     8037d9 <__rodata_start+0x131>
+  803778:	74 69                	je     8037e3 <__rodata_start+0x13b>
+  80377a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80377b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377c:	20 66 61             	and    %ah,0x61(%rsi)
+  80377f:	75 6c                	jne    8037ed <__rodata_start+0x145>
+  803781:	74 00                	je     803783 <__rodata_start+0xdb>
+  803783:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80378a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80378d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803791:	61                   	(bad)
+  803792:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803797:	20 73 75             	and    %dh,0x75(%rbx)
+  80379a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80379d:	73 79                	jae    803818 <__rodata_start+0x170>
+  80379f:	73 74                	jae    803815 <__rodata_start+0x16d>
+  8037a1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8037a3:	20 63 61             	and    %ah,0x61(%rbx)
+  8037a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8037a8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8037ab:	74 72                	je     80381f <__rodata_start+0x177>
+  8037ad:	79 20                	jns    8037cf <__rodata_start+0x127>
+  8037af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037b1:	74 20                	je     8037d3 <__rodata_start+0x12b>
+  8037b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037b5:	75 6e                	jne    803825 <__rodata_start+0x17d>
+  8037b7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8037bb:	76 20                	jbe    8037dd <__rodata_start+0x135>
+  8037bd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8037c4:	72 65                	jb     80382b <__rodata_start+0x183>
+  8037c6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8037c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ca:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037ce:	65 78 70             	gs js  803841 <__rodata_start+0x199>
+  8037d1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037d6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037d9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037dd:	20 66 69             	and    %ah,0x69(%rsi)
+  8037e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8037e1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037e5:	20 66 72             	and    %ah,0x72(%rsi)
+  8037e8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037ed:	61                   	(bad)
+  8037ee:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037f7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803800:	79 20                	jns    803822 <__rodata_start+0x17a>
+  803802:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803809:	72 65                	jb     803870 <__rodata_start+0x1c8>
+  80380b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80380e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803810:	00 66 69             	add    %ah,0x69(%rsi)
+  803813:	6c                   	insb   (%dx),%es:(%rdi)
+  803814:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803818:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80381b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80381c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80381f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803820:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803821:	74 20                	je     803843 <__rodata_start+0x19b>
+  803823:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803825:	75 6e                	jne    803895 <__rodata_start+0x1ed>
+  803827:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80382b:	76 61                	jbe    80388e <__rodata_start+0x1e6>
+  80382d:	6c                   	insb   (%dx),%es:(%rdi)
+  80382e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803835:	00 
+  803836:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80383d:	72 65                	jb     8038a4 <__rodata_start+0x1fc>
+  80383f:	61                   	(bad)
+  803840:	64 79 20             	fs jns 803863 <__rodata_start+0x1bb>
+  803843:	65 78 69             	gs js  8038af <__rodata_start+0x207>
+  803846:	73 74                	jae    8038bc <__rodata_start+0x214>
+  803848:	73 00                	jae    80384a <__rodata_start+0x1a2>
+  80384a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80384b:	70 65                	jo     8038b2 <__rodata_start+0x20a>
+  80384d:	72 61                	jb     8038b0 <__rodata_start+0x208>
+  80384f:	74 69                	je     8038ba <__rodata_start+0x212>
+  803851:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803852:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803853:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803856:	74 20                	je     803878 <__rodata_start+0x1d0>
+  803858:	73 75                	jae    8038cf <__rodata_start+0x227>
+  80385a:	70 70                	jo     8038cc <__rodata_start+0x224>
+  80385c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80385d:	72 74                	jb     8038d3 <__rodata_start+0x22b>
+  80385f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803865:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80386a:	74 00                	je     80386c <__rodata_start+0x1c4>
+  80386c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803873:	00 00 00 
+  803876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80387d:	00 00 00 
+  803880:	c8 03 80 00          	enter  $0x8003,$0x0
+  803884:	00 00                	add    %al,(%rax)
+  803886:	00 00                	add    %al,(%rax)
+  803888:	09 0a                	or     %ecx,(%rdx)
+  80388a:	80 00 00             	addb   $0x0,(%rax)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 f9                	add    %bh,%cl
+  803891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803897:	00 09                	add    %cl,(%rcx)
+  803899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80389f:	00 09                	add    %cl,(%rcx)
+  8038a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038a7:	00 09                	add    %cl,(%rcx)
+  8038a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038af:	00 09                	add    %cl,(%rcx)
+  8038b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038b7:	00 e7                	add    %ah,%bh
+  8038b9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038bf:	00 09                	add    %cl,(%rcx)
+  8038c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038c7:	00 09                	add    %cl,(%rcx)
+  8038c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038cf:	00 db                	add    %bl,%bl
+  8038d1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038d7:	00 55 04             	add    %dl,0x4(%rbp)
+  8038da:	80 00 00             	addb   $0x0,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 09                	add    %cl,(%rcx)
+  8038e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038e7:	00 db                	add    %bl,%bl
+  8038e9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038ef:	00 21                	add    %ah,(%rcx)
+  8038f1:	04 80                	add    $0x80,%al
+  8038f3:	00 00                	add    %al,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 21                	add    %ah,(%rcx)
+  8038f9:	04 80                	add    $0x80,%al
+  8038fb:	00 00                	add    %al,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 21                	add    %ah,(%rcx)
+  803901:	04 80                	add    $0x80,%al
+  803903:	00 00                	add    %al,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 21                	add    %ah,(%rcx)
+  803909:	04 80                	add    $0x80,%al
+  80390b:	00 00                	add    %al,(%rax)
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 21                	add    %ah,(%rcx)
+  803911:	04 80                	add    $0x80,%al
+  803913:	00 00                	add    %al,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 21                	add    %ah,(%rcx)
+  803919:	04 80                	add    $0x80,%al
+  80391b:	00 00                	add    %al,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 21                	add    %ah,(%rcx)
+  803921:	04 80                	add    $0x80,%al
+  803923:	00 00                	add    %al,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 21                	add    %ah,(%rcx)
+  803929:	04 80                	add    $0x80,%al
+  80392b:	00 00                	add    %al,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 21                	add    %ah,(%rcx)
+  803931:	04 80                	add    $0x80,%al
+  803933:	00 00                	add    %al,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 09                	add    %cl,(%rcx)
+  803939:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80393f:	00 09                	add    %cl,(%rcx)
+  803941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803947:	00 09                	add    %cl,(%rcx)
+  803949:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80394f:	00 09                	add    %cl,(%rcx)
+  803951:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803957:	00 09                	add    %cl,(%rcx)
+  803959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80395f:	00 09                	add    %cl,(%rcx)
+  803961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803967:	00 09                	add    %cl,(%rcx)
+  803969:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80396f:	00 09                	add    %cl,(%rcx)
+  803971:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803977:	00 09                	add    %cl,(%rcx)
+  803979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80397f:	00 09                	add    %cl,(%rcx)
+  803981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803987:	00 09                	add    %cl,(%rcx)
+  803989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80398f:	00 09                	add    %cl,(%rcx)
+  803991:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803997:	00 09                	add    %cl,(%rcx)
+  803999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80399f:	00 09                	add    %cl,(%rcx)
+  8039a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039a7:	00 09                	add    %cl,(%rcx)
+  8039a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039af:	00 09                	add    %cl,(%rcx)
+  8039b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039b7:	00 09                	add    %cl,(%rcx)
+  8039b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039bf:	00 09                	add    %cl,(%rcx)
+  8039c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039c7:	00 09                	add    %cl,(%rcx)
+  8039c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039cf:	00 09                	add    %cl,(%rcx)
+  8039d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039d7:	00 09                	add    %cl,(%rcx)
+  8039d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039df:	00 09                	add    %cl,(%rcx)
+  8039e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039e7:	00 09                	add    %cl,(%rcx)
+  8039e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039ef:	00 09                	add    %cl,(%rcx)
+  8039f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039f7:	00 09                	add    %cl,(%rcx)
+  8039f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039ff:	00 09                	add    %cl,(%rcx)
+  803a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a07:	00 09                	add    %cl,(%rcx)
+  803a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a0f:	00 09                	add    %cl,(%rcx)
+  803a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a17:	00 09                	add    %cl,(%rcx)
+  803a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a1f:	00 09                	add    %cl,(%rcx)
+  803a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a27:	00 2c 09             	add    %ch,(%rcx,%rcx,1)
+  803a2a:	80 00 00             	addb   $0x0,(%rax)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 09                	add    %cl,(%rcx)
+  803a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a37:	00 09                	add    %cl,(%rcx)
+  803a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a3f:	00 09                	add    %cl,(%rcx)
+  803a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a47:	00 09                	add    %cl,(%rcx)
+  803a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a4f:	00 09                	add    %cl,(%rcx)
+  803a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a57:	00 09                	add    %cl,(%rcx)
+  803a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a5f:	00 09                	add    %cl,(%rcx)
+  803a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a67:	00 09                	add    %cl,(%rcx)
+  803a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a6f:	00 09                	add    %cl,(%rcx)
+  803a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a77:	00 09                	add    %cl,(%rcx)
+  803a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a7f:	00 78 04             	add    %bh,0x4(%rax)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 47 06             	add    %al,0x6(%rdi)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 09                	add    %cl,(%rcx)
+  803a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a97:	00 09                	add    %cl,(%rcx)
+  803a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a9f:	00 09                	add    %cl,(%rcx)
+  803aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aa7:	00 09                	add    %cl,(%rcx)
+  803aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aaf:	00 a7 04 80 00 00    	add    %ah,0x8004(%rdi)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 09                	add    %cl,(%rcx)
+  803ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803abf:	00 09                	add    %cl,(%rcx)
+  803ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ac7:	00 6d 04             	add    %ch,0x4(%rbp)
+  803aca:	80 00 00             	addb   $0x0,(%rax)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 09                	add    %cl,(%rcx)
+  803ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ad7:	00 09                	add    %cl,(%rcx)
+  803ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803adf:	00 ef                	add    %ch,%bh
+  803ae1:	07                   	(bad)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 b9 08 80 00 00    	add    %bh,0x8008(%rcx)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 09                	add    %cl,(%rcx)
+  803af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803af7:	00 09                	add    %cl,(%rcx)
+  803af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aff:	00 3e                	add    %bh,(%rsi)
+  803b01:	05 80 00 00 00       	add    $0x80,%eax
+  803b06:	00 00                	add    %al,(%rax)
+  803b08:	09 0a                	or     %ecx,(%rdx)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 1b                	add    %bl,(%rbx)
+  803b11:	07                   	(bad)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 09                	add    %cl,(%rcx)
+  803b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b1f:	00 09                	add    %cl,(%rcx)
+  803b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b27:	00 2c 09             	add    %ch,(%rcx,%rcx,1)
+  803b2a:	80 00 00             	addb   $0x0,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 09                	add    %cl,(%rcx)
+  803b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b37:	00 d1                	add    %dl,%cl
+  803b39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803b40 <error_string>:
+	...
+  803b48:	05 37 80 00 00 00 00 00 17 37 80 00 00 00 00 00     .7.......7......
+  803b58:	27 37 80 00 00 00 00 00 39 37 80 00 00 00 00 00     '7......97......
+  803b68:	47 37 80 00 00 00 00 00 5b 37 80 00 00 00 00 00     G7......[7......
+  803b78:	70 37 80 00 00 00 00 00 83 37 80 00 00 00 00 00     p7.......7......
+  803b88:	95 37 80 00 00 00 00 00 a9 37 80 00 00 00 00 00     .7.......7......
+  803b98:	b9 37 80 00 00 00 00 00 cc 37 80 00 00 00 00 00     .7.......7......
+  803ba8:	e3 37 80 00 00 00 00 00 f9 37 80 00 00 00 00 00     .7.......7......
+  803bb8:	11 38 80 00 00 00 00 00 29 38 80 00 00 00 00 00     .8......)8......
+  803bc8:	36 38 80 00 00 00 00 00 e8 3b 80 00 00 00 00 00     68.......;......
+  803bd8:	4a 38 80 00 00 00 00 00 62 38 80 00 00 00 00 00     J8......b8......
+  803be8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803bf8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803c08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803c18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803c28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803c38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c58:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c68:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c78:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c88:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c98:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803ca8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803cb8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803cc8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cd8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ce0 <devtab>:
+  803ce0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803cf0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803d00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803d10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803d20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803d30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803d80:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803d90:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
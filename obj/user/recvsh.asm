@@ -0,0 +1,6941 @@
+
+obj/user/recvsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b7 00 00 00       	call   8000da <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 f5             	mov    %rsi,%r13
+
+    if (argc != 2) {
+  800039:	83 ff 02             	cmp    $0x2,%edi
+  80003c:	74 69                	je     8000a7 <umain+0x82>
+  80003e:	41 89 fc             	mov    %edi,%r12d
+        cprintf("Usage: recvsh <stream file>\n");
+  800041:	48 bf 28 37 80 00 00 	movabs $0x803728,%rdi
+  800048:	00 00 00 
+  80004b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800050:	48 ba 58 02 80 00 00 	movabs $0x800258,%rdx
+  800057:	00 00 00 
+  80005a:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  80005c:	45 85 e4             	test   %r12d,%r12d
+  80005f:	7e 37                	jle    800098 <umain+0x73>
+  800061:	4d 63 e4             	movslq %r12d,%r12
+  800064:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  800069:	49 bf 48 37 80 00 00 	movabs $0x803748,%r15
+  800070:	00 00 00 
+  800073:	49 be 58 02 80 00 00 	movabs $0x800258,%r14
+  80007a:	00 00 00 
+  80007d:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  800082:	89 de                	mov    %ebx,%esi
+  800084:	4c 89 ff             	mov    %r15,%rdi
+  800087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008c:	41 ff d6             	call   *%r14
+        for(int i = 0; i < argc; ++i) {
+  80008f:	48 83 c3 01          	add    $0x1,%rbx
+  800093:	4c 39 e3             	cmp    %r12,%rbx
+  800096:	75 e5                	jne    80007d <umain+0x58>
+    if (res < 0) {
+        cprintf("Snapshot cannot be received: %i\n", res);
+    }
+
+    return;
+}
+  800098:	48 83 c4 08          	add    $0x8,%rsp
+  80009c:	5b                   	pop    %rbx
+  80009d:	41 5c                	pop    %r12
+  80009f:	41 5d                	pop    %r13
+  8000a1:	41 5e                	pop    %r14
+  8000a3:	41 5f                	pop    %r15
+  8000a5:	5d                   	pop    %rbp
+  8000a6:	c3                   	ret
+    int res = receive_snapshot(argv[1]);
+  8000a7:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  8000ab:	48 b8 d6 1f 80 00 00 	movabs $0x801fd6,%rax
+  8000b2:	00 00 00 
+  8000b5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	79 dd                	jns    800098 <umain+0x73>
+        cprintf("Snapshot cannot be received: %i\n", res);
+  8000bb:	89 c6                	mov    %eax,%esi
+  8000bd:	48 bf 70 37 80 00 00 	movabs $0x803770,%rdi
+  8000c4:	00 00 00 
+  8000c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cc:	48 ba 58 02 80 00 00 	movabs $0x800258,%rdx
+  8000d3:	00 00 00 
+  8000d6:	ff d2                	call   *%rdx
+  8000d8:	eb be                	jmp    800098 <umain+0x73>
+
+00000000008000da <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000da:	55                   	push   %rbp
+  8000db:	48 89 e5             	mov    %rsp,%rbp
+  8000de:	41 56                	push   %r14
+  8000e0:	41 55                	push   %r13
+  8000e2:	41 54                	push   %r12
+  8000e4:	53                   	push   %rbx
+  8000e5:	41 89 fd             	mov    %edi,%r13d
+  8000e8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000eb:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  8000f2:	00 00 00 
+  8000f5:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  8000fc:	00 00 00 
+  8000ff:	48 39 c2             	cmp    %rax,%rdx
+  800102:	73 17                	jae    80011b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800104:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800107:	49 89 c4             	mov    %rax,%r12
+  80010a:	48 83 c3 08          	add    $0x8,%rbx
+  80010e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800113:	ff 53 f8             	call   *-0x8(%rbx)
+  800116:	4c 39 e3             	cmp    %r12,%rbx
+  800119:	72 ef                	jb     80010a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80011b:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80012c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800130:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800134:	48 c1 e0 04          	shl    $0x4,%rax
+  800138:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80013f:	00 00 00 
+  800142:	48 01 d0             	add    %rdx,%rax
+  800145:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80014c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80014f:	45 85 ed             	test   %r13d,%r13d
+  800152:	7e 0d                	jle    800161 <libmain+0x87>
+  800154:	49 8b 06             	mov    (%r14),%rax
+  800157:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80015e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800161:	4c 89 f6             	mov    %r14,%rsi
+  800164:	44 89 ef             	mov    %r13d,%edi
+  800167:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80016e:	00 00 00 
+  800171:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800173:	48 b8 88 01 80 00 00 	movabs $0x800188,%rax
+  80017a:	00 00 00 
+  80017d:	ff d0                	call   *%rax
+#endif
+}
+  80017f:	5b                   	pop    %rbx
+  800180:	41 5c                	pop    %r12
+  800182:	41 5d                	pop    %r13
+  800184:	41 5e                	pop    %r14
+  800186:	5d                   	pop    %rbp
+  800187:	c3                   	ret
+
+0000000000800188 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800188:	55                   	push   %rbp
+  800189:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80018c:	48 b8 ff 17 80 00 00 	movabs $0x8017ff,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800198:	bf 00 00 00 00       	mov    $0x0,%edi
+  80019d:	48 b8 de 10 80 00 00 	movabs $0x8010de,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+}
+  8001a9:	5d                   	pop    %rbp
+  8001aa:	c3                   	ret
+
+00000000008001ab <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ab:	55                   	push   %rbp
+  8001ac:	48 89 e5             	mov    %rsp,%rbp
+  8001af:	53                   	push   %rbx
+  8001b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001b4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001b7:	8b 06                	mov    (%rsi),%eax
+  8001b9:	8d 50 01             	lea    0x1(%rax),%edx
+  8001bc:	89 16                	mov    %edx,(%rsi)
+  8001be:	48 98                	cltq
+  8001c0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001c5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001cb:	74 0a                	je     8001d7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001cd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001d7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001db:	be ff 00 00 00       	mov    $0xff,%esi
+  8001e0:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001ec:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001f2:	eb d9                	jmp    8001cd <putch+0x22>
+
+00000000008001f4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001f4:	55                   	push   %rbp
+  8001f5:	48 89 e5             	mov    %rsp,%rbp
+  8001f8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001ff:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800202:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800209:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800216:	48 89 f1             	mov    %rsi,%rcx
+  800219:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800220:	48 bf ab 01 80 00 00 	movabs $0x8001ab,%rdi
+  800227:	00 00 00 
+  80022a:	48 b8 a8 03 80 00 00 	movabs $0x8003a8,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800236:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80023d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800244:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  80024b:	00 00 00 
+  80024e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800250:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800256:	c9                   	leave
+  800257:	c3                   	ret
+
+0000000000800258 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800258:	55                   	push   %rbp
+  800259:	48 89 e5             	mov    %rsp,%rbp
+  80025c:	48 83 ec 50          	sub    $0x50,%rsp
+  800260:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800264:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800268:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80026c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800270:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800274:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80027b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80027f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800283:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800287:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80028b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80028f:	48 b8 f4 01 80 00 00 	movabs $0x8001f4,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80029b:	c9                   	leave
+  80029c:	c3                   	ret
+
+000000000080029d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 57                	push   %r15
+  8002a3:	41 56                	push   %r14
+  8002a5:	41 55                	push   %r13
+  8002a7:	41 54                	push   %r12
+  8002a9:	53                   	push   %rbx
+  8002aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ae:	49 89 fc             	mov    %rdi,%r12
+  8002b1:	49 89 f5             	mov    %rsi,%r13
+  8002b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002b8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002bb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002be:	41 89 cf             	mov    %ecx,%r15d
+  8002c1:	4c 39 fa             	cmp    %r15,%rdx
+  8002c4:	73 5b                	jae    800321 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002c6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002ca:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002ce:	85 db                	test   %ebx,%ebx
+  8002d0:	7e 0e                	jle    8002e0 <print_num+0x43>
+            putch(padc, put_arg);
+  8002d2:	4c 89 ee             	mov    %r13,%rsi
+  8002d5:	44 89 f7             	mov    %r14d,%edi
+  8002d8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002db:	83 eb 01             	sub    $0x1,%ebx
+  8002de:	75 f2                	jne    8002d2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002e0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002e4:	48 b9 ac 37 80 00 00 	movabs $0x8037ac,%rcx
+  8002eb:	00 00 00 
+  8002ee:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  8002f5:	00 00 00 
+  8002f8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800300:	ba 00 00 00 00       	mov    $0x0,%edx
+  800305:	49 f7 f7             	div    %r15
+  800308:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80030c:	4c 89 ee             	mov    %r13,%rsi
+  80030f:	41 ff d4             	call   *%r12
+}
+  800312:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800316:	5b                   	pop    %rbx
+  800317:	41 5c                	pop    %r12
+  800319:	41 5d                	pop    %r13
+  80031b:	41 5e                	pop    %r14
+  80031d:	41 5f                	pop    %r15
+  80031f:	5d                   	pop    %rbp
+  800320:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800321:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032a:	49 f7 f7             	div    %r15
+  80032d:	48 83 ec 08          	sub    $0x8,%rsp
+  800331:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800335:	52                   	push   %rdx
+  800336:	45 0f be c9          	movsbl %r9b,%r9d
+  80033a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80033e:	48 89 c2             	mov    %rax,%rdx
+  800341:	48 b8 9d 02 80 00 00 	movabs $0x80029d,%rax
+  800348:	00 00 00 
+  80034b:	ff d0                	call   *%rax
+  80034d:	48 83 c4 10          	add    $0x10,%rsp
+  800351:	eb 8d                	jmp    8002e0 <print_num+0x43>
+
+0000000000800353 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800353:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800357:	48 8b 06             	mov    (%rsi),%rax
+  80035a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80035e:	73 0a                	jae    80036a <sprintputch+0x17>
+        *state->start++ = ch;
+  800360:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800364:	48 89 16             	mov    %rdx,(%rsi)
+  800367:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80036a:	c3                   	ret
+
+000000000080036b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80036b:	55                   	push   %rbp
+  80036c:	48 89 e5             	mov    %rsp,%rbp
+  80036f:	48 83 ec 50          	sub    $0x50,%rsp
+  800373:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800377:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80037b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80037f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800386:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80038a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80038e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800392:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800396:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80039a:	48 b8 a8 03 80 00 00 	movabs $0x8003a8,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+}
+  8003a6:	c9                   	leave
+  8003a7:	c3                   	ret
+
+00000000008003a8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003a8:	55                   	push   %rbp
+  8003a9:	48 89 e5             	mov    %rsp,%rbp
+  8003ac:	41 57                	push   %r15
+  8003ae:	41 56                	push   %r14
+  8003b0:	41 55                	push   %r13
+  8003b2:	41 54                	push   %r12
+  8003b4:	53                   	push   %rbx
+  8003b5:	48 83 ec 38          	sub    $0x38,%rsp
+  8003b9:	49 89 fe             	mov    %rdi,%r14
+  8003bc:	49 89 f5             	mov    %rsi,%r13
+  8003bf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003c2:	48 8b 01             	mov    (%rcx),%rax
+  8003c5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003c9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003d9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003dd:	0f b6 3b             	movzbl (%rbx),%edi
+  8003e0:	40 80 ff 25          	cmp    $0x25,%dil
+  8003e4:	74 18                	je     8003fe <vprintfmt+0x56>
+            if (!ch) return;
+  8003e6:	40 84 ff             	test   %dil,%dil
+  8003e9:	0f 84 b1 06 00 00    	je     800aa0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003ef:	40 0f b6 ff          	movzbl %dil,%edi
+  8003f3:	4c 89 ee             	mov    %r13,%rsi
+  8003f6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003f9:	4c 89 e3             	mov    %r12,%rbx
+  8003fc:	eb db                	jmp    8003d9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003fe:	be 00 00 00 00       	mov    $0x0,%esi
+  800403:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800407:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80040c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800412:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800419:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80041d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800422:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800427:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80042a:	83 e8 23             	sub    $0x23,%eax
+  80042d:	3c 57                	cmp    $0x57,%al
+  80042f:	0f 87 51 06 00 00    	ja     800a86 <vprintfmt+0x6de>
+  800435:	0f b6 c0             	movzbl %al,%eax
+  800438:	48 b9 40 39 80 00 00 	movabs $0x803940,%rcx
+  80043f:	00 00 00 
+  800442:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800445:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800448:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80044c:	eb cf                	jmp    80041d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+  800451:	be 01 00 00 00       	mov    $0x1,%esi
+  800456:	eb c5                	jmp    80041d <vprintfmt+0x75>
+            padc = ch;
+  800458:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80045c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80045f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800462:	eb b9                	jmp    80041d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800464:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800467:	83 f8 2f             	cmp    $0x2f,%eax
+  80046a:	77 24                	ja     800490 <vprintfmt+0xe8>
+  80046c:	89 c1                	mov    %eax,%ecx
+  80046e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800472:	83 c0 08             	add    $0x8,%eax
+  800475:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800478:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80047b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80047e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800482:	79 99                	jns    80041d <vprintfmt+0x75>
+                width = precision;
+  800484:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800488:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80048e:	eb 8d                	jmp    80041d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800490:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800494:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800498:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049c:	eb da                	jmp    800478 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80049e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004a3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004a7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004ad:	3c 39                	cmp    $0x39,%al
+  8004af:	77 1c                	ja     8004cd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004b1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004b5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004b9:	0f b6 c0             	movzbl %al,%eax
+  8004bc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c1:	0f b6 03             	movzbl (%rbx),%eax
+  8004c4:	3c 39                	cmp    $0x39,%al
+  8004c6:	76 e9                	jbe    8004b1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004c8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004cb:	eb b1                	jmp    80047e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004cd:	49 89 dc             	mov    %rbx,%r12
+  8004d0:	eb ac                	jmp    80047e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004d2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004d5:	85 c9                	test   %ecx,%ecx
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	0f 49 c1             	cmovns %ecx,%eax
+  8004df:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004e2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004e5:	e9 33 ff ff ff       	jmp    80041d <vprintfmt+0x75>
+            lflag++;
+  8004ea:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f0:	e9 28 ff ff ff       	jmp    80041d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004fb:	77 19                	ja     800516 <vprintfmt+0x16e>
+  8004fd:	89 c2                	mov    %eax,%edx
+  8004ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800503:	83 c0 08             	add    $0x8,%eax
+  800506:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800509:	8b 3a                	mov    (%rdx),%edi
+  80050b:	4c 89 ee             	mov    %r13,%rsi
+  80050e:	41 ff d6             	call   *%r14
+            break;
+  800511:	e9 c3 fe ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800516:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80051e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800522:	eb e5                	jmp    800509 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800524:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800527:	83 f8 2f             	cmp    $0x2f,%eax
+  80052a:	77 5a                	ja     800586 <vprintfmt+0x1de>
+  80052c:	89 c2                	mov    %eax,%edx
+  80052e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800532:	83 c0 08             	add    $0x8,%eax
+  800535:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800538:	8b 02                	mov    (%rdx),%eax
+  80053a:	89 c1                	mov    %eax,%ecx
+  80053c:	f7 d9                	neg    %ecx
+  80053e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800541:	83 f9 14             	cmp    $0x14,%ecx
+  800544:	7f 4e                	jg     800594 <vprintfmt+0x1ec>
+  800546:	48 63 c1             	movslq %ecx,%rax
+  800549:	48 ba 00 3c 80 00 00 	movabs $0x803c00,%rdx
+  800550:	00 00 00 
+  800553:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800557:	48 85 c0             	test   %rax,%rax
+  80055a:	74 38                	je     800594 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80055c:	48 89 c1             	mov    %rax,%rcx
+  80055f:	48 ba d9 3d 80 00 00 	movabs $0x803dd9,%rdx
+  800566:	00 00 00 
+  800569:	4c 89 ee             	mov    %r13,%rsi
+  80056c:	4c 89 f7             	mov    %r14,%rdi
+  80056f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800574:	49 b8 6b 03 80 00 00 	movabs $0x80036b,%r8
+  80057b:	00 00 00 
+  80057e:	41 ff d0             	call   *%r8
+  800581:	e9 53 fe ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800586:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80058a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80058e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800592:	eb a4                	jmp    800538 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800594:	48 ba c4 37 80 00 00 	movabs $0x8037c4,%rdx
+  80059b:	00 00 00 
+  80059e:	4c 89 ee             	mov    %r13,%rsi
+  8005a1:	4c 89 f7             	mov    %r14,%rdi
+  8005a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a9:	49 b8 6b 03 80 00 00 	movabs $0x80036b,%r8
+  8005b0:	00 00 00 
+  8005b3:	41 ff d0             	call   *%r8
+  8005b6:	e9 1e fe ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005be:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c1:	77 6c                	ja     80062f <vprintfmt+0x287>
+  8005c3:	89 c2                	mov    %eax,%edx
+  8005c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005c9:	83 c0 08             	add    $0x8,%eax
+  8005cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005cf:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005d2:	48 85 d2             	test   %rdx,%rdx
+  8005d5:	48 b8 bd 37 80 00 00 	movabs $0x8037bd,%rax
+  8005dc:	00 00 00 
+  8005df:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005e3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005e7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005eb:	7e 06                	jle    8005f3 <vprintfmt+0x24b>
+  8005ed:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005f1:	75 4a                	jne    80063d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005f7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005fb:	0f b6 00             	movzbl (%rax),%eax
+  8005fe:	84 c0                	test   %al,%al
+  800600:	0f 85 9a 00 00 00    	jne    8006a0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800606:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800609:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80060d:	85 c0                	test   %eax,%eax
+  80060f:	0f 8e c4 fd ff ff    	jle    8003d9 <vprintfmt+0x31>
+  800615:	4c 89 ee             	mov    %r13,%rsi
+  800618:	bf 20 00 00 00       	mov    $0x20,%edi
+  80061d:	41 ff d6             	call   *%r14
+  800620:	41 83 ec 01          	sub    $0x1,%r12d
+  800624:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800628:	75 eb                	jne    800615 <vprintfmt+0x26d>
+  80062a:	e9 aa fd ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80062f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800633:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800637:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063b:	eb 92                	jmp    8005cf <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80063d:	49 63 f7             	movslq %r15d,%rsi
+  800640:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800644:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  80064b:	00 00 00 
+  80064e:	ff d0                	call   *%rax
+  800650:	48 89 c2             	mov    %rax,%rdx
+  800653:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800656:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800658:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80065b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80065e:	85 c0                	test   %eax,%eax
+  800660:	7e 91                	jle    8005f3 <vprintfmt+0x24b>
+  800662:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800667:	4c 89 ee             	mov    %r13,%rsi
+  80066a:	44 89 e7             	mov    %r12d,%edi
+  80066d:	41 ff d6             	call   *%r14
+  800670:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800674:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800677:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80067a:	75 eb                	jne    800667 <vprintfmt+0x2bf>
+  80067c:	e9 72 ff ff ff       	jmp    8005f3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800681:	0f b6 f8             	movzbl %al,%edi
+  800684:	4c 89 ee             	mov    %r13,%rsi
+  800687:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80068a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80068e:	49 83 c4 01          	add    $0x1,%r12
+  800692:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800698:	84 c0                	test   %al,%al
+  80069a:	0f 84 66 ff ff ff    	je     800606 <vprintfmt+0x25e>
+  8006a0:	45 85 ff             	test   %r15d,%r15d
+  8006a3:	78 0a                	js     8006af <vprintfmt+0x307>
+  8006a5:	41 83 ef 01          	sub    $0x1,%r15d
+  8006a9:	0f 88 57 ff ff ff    	js     800606 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006af:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006b3:	74 cc                	je     800681 <vprintfmt+0x2d9>
+  8006b5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006b8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006bd:	80 fa 5e             	cmp    $0x5e,%dl
+  8006c0:	77 c2                	ja     800684 <vprintfmt+0x2dc>
+  8006c2:	eb bd                	jmp    800681 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006c4:	40 84 f6             	test   %sil,%sil
+  8006c7:	75 26                	jne    8006ef <vprintfmt+0x347>
+    switch (lflag) {
+  8006c9:	85 d2                	test   %edx,%edx
+  8006cb:	74 59                	je     800726 <vprintfmt+0x37e>
+  8006cd:	83 fa 01             	cmp    $0x1,%edx
+  8006d0:	74 7b                	je     80074d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d8:	0f 87 96 00 00 00    	ja     800774 <vprintfmt+0x3cc>
+  8006de:	89 c2                	mov    %eax,%edx
+  8006e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e4:	83 c0 08             	add    $0x8,%eax
+  8006e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ea:	4c 8b 22             	mov    (%rdx),%r12
+  8006ed:	eb 17                	jmp    800706 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f5:	77 21                	ja     800718 <vprintfmt+0x370>
+  8006f7:	89 c2                	mov    %eax,%edx
+  8006f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006fd:	83 c0 08             	add    $0x8,%eax
+  800700:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800703:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800706:	4d 85 e4             	test   %r12,%r12
+  800709:	78 7a                	js     800785 <vprintfmt+0x3dd>
+            num = i;
+  80070b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80070e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800713:	e9 50 02 00 00       	jmp    800968 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800718:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800720:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800724:	eb dd                	jmp    800703 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800726:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800729:	83 f8 2f             	cmp    $0x2f,%eax
+  80072c:	77 11                	ja     80073f <vprintfmt+0x397>
+  80072e:	89 c2                	mov    %eax,%edx
+  800730:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800734:	83 c0 08             	add    $0x8,%eax
+  800737:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073a:	4c 63 22             	movslq (%rdx),%r12
+  80073d:	eb c7                	jmp    800706 <vprintfmt+0x35e>
+  80073f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800743:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800747:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074b:	eb ed                	jmp    80073a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80074d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800750:	83 f8 2f             	cmp    $0x2f,%eax
+  800753:	77 11                	ja     800766 <vprintfmt+0x3be>
+  800755:	89 c2                	mov    %eax,%edx
+  800757:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075b:	83 c0 08             	add    $0x8,%eax
+  80075e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800761:	4c 8b 22             	mov    (%rdx),%r12
+  800764:	eb a0                	jmp    800706 <vprintfmt+0x35e>
+  800766:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800772:	eb ed                	jmp    800761 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800774:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800778:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800780:	e9 65 ff ff ff       	jmp    8006ea <vprintfmt+0x342>
+                putch('-', put_arg);
+  800785:	4c 89 ee             	mov    %r13,%rsi
+  800788:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80078d:	41 ff d6             	call   *%r14
+                i = -i;
+  800790:	49 f7 dc             	neg    %r12
+  800793:	e9 73 ff ff ff       	jmp    80070b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800798:	40 84 f6             	test   %sil,%sil
+  80079b:	75 32                	jne    8007cf <vprintfmt+0x427>
+    switch (lflag) {
+  80079d:	85 d2                	test   %edx,%edx
+  80079f:	74 5d                	je     8007fe <vprintfmt+0x456>
+  8007a1:	83 fa 01             	cmp    $0x1,%edx
+  8007a4:	0f 84 82 00 00 00    	je     80082c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b0:	0f 87 a5 00 00 00    	ja     80085b <vprintfmt+0x4b3>
+  8007b6:	89 c2                	mov    %eax,%edx
+  8007b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bc:	83 c0 08             	add    $0x8,%eax
+  8007bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007ca:	e9 99 01 00 00       	jmp    800968 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d5:	77 19                	ja     8007f0 <vprintfmt+0x448>
+  8007d7:	89 c2                	mov    %eax,%edx
+  8007d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007dd:	83 c0 08             	add    $0x8,%eax
+  8007e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007eb:	e9 78 01 00 00       	jmp    800968 <vprintfmt+0x5c0>
+  8007f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fc:	eb e5                	jmp    8007e3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800801:	83 f8 2f             	cmp    $0x2f,%eax
+  800804:	77 18                	ja     80081e <vprintfmt+0x476>
+  800806:	89 c2                	mov    %eax,%edx
+  800808:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080c:	83 c0 08             	add    $0x8,%eax
+  80080f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800812:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800814:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800819:	e9 4a 01 00 00       	jmp    800968 <vprintfmt+0x5c0>
+  80081e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800822:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800826:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082a:	eb e6                	jmp    800812 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	77 19                	ja     80084d <vprintfmt+0x4a5>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083a:	83 c0 08             	add    $0x8,%eax
+  80083d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800840:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800843:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800848:	e9 1b 01 00 00       	jmp    800968 <vprintfmt+0x5c0>
+  80084d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800851:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800855:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800859:	eb e5                	jmp    800840 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80085b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800867:	e9 56 ff ff ff       	jmp    8007c2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80086c:	40 84 f6             	test   %sil,%sil
+  80086f:	75 2e                	jne    80089f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800871:	85 d2                	test   %edx,%edx
+  800873:	74 59                	je     8008ce <vprintfmt+0x526>
+  800875:	83 fa 01             	cmp    $0x1,%edx
+  800878:	74 7f                	je     8008f9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	0f 87 9f 00 00 00    	ja     800925 <vprintfmt+0x57d>
+  800886:	89 c2                	mov    %eax,%edx
+  800888:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088c:	83 c0 08             	add    $0x8,%eax
+  80088f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800892:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800895:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80089a:	e9 c9 00 00 00       	jmp    800968 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80089f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a5:	77 19                	ja     8008c0 <vprintfmt+0x518>
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ad:	83 c0 08             	add    $0x8,%eax
+  8008b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008bb:	e9 a8 00 00 00       	jmp    800968 <vprintfmt+0x5c0>
+  8008c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cc:	eb e5                	jmp    8008b3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d4:	77 15                	ja     8008eb <vprintfmt+0x543>
+  8008d6:	89 c2                	mov    %eax,%edx
+  8008d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dc:	83 c0 08             	add    $0x8,%eax
+  8008df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008e9:	eb 7d                	jmp    800968 <vprintfmt+0x5c0>
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb e9                	jmp    8008e2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 16                	ja     800917 <vprintfmt+0x56f>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800910:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800915:	eb 51                	jmp    800968 <vprintfmt+0x5c0>
+  800917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800923:	eb e8                	jmp    80090d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800925:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800929:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800931:	e9 5c ff ff ff       	jmp    800892 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800936:	4c 89 ee             	mov    %r13,%rsi
+  800939:	bf 30 00 00 00       	mov    $0x30,%edi
+  80093e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800941:	4c 89 ee             	mov    %r13,%rsi
+  800944:	bf 78 00 00 00       	mov    $0x78,%edi
+  800949:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80094c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094f:	83 f8 2f             	cmp    $0x2f,%eax
+  800952:	77 47                	ja     80099b <vprintfmt+0x5f3>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800963:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800970:	0f 94 c0             	sete   %al
+  800973:	0f b6 c0             	movzbl %al,%eax
+  800976:	50                   	push   %rax
+  800977:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80097c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800980:	4c 89 ee             	mov    %r13,%rsi
+  800983:	4c 89 f7             	mov    %r14,%rdi
+  800986:	48 b8 9d 02 80 00 00 	movabs $0x80029d,%rax
+  80098d:	00 00 00 
+  800990:	ff d0                	call   *%rax
+            break;
+  800992:	48 83 c4 10          	add    $0x10,%rsp
+  800996:	e9 3e fa ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb b7                	jmp    800960 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	40 84 f6             	test   %sil,%sil
+  8009ac:	75 2b                	jne    8009d9 <vprintfmt+0x631>
+    switch (lflag) {
+  8009ae:	85 d2                	test   %edx,%edx
+  8009b0:	74 56                	je     800a08 <vprintfmt+0x660>
+  8009b2:	83 fa 01             	cmp    $0x1,%edx
+  8009b5:	74 7f                	je     800a36 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bd:	0f 87 a2 00 00 00    	ja     800a65 <vprintfmt+0x6bd>
+  8009c3:	89 c2                	mov    %eax,%edx
+  8009c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c9:	83 c0 08             	add    $0x8,%eax
+  8009cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009d7:	eb 8f                	jmp    800968 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 19                	ja     8009fa <vprintfmt+0x652>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f5:	e9 6e ff ff ff       	jmp    800968 <vprintfmt+0x5c0>
+  8009fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a06:	eb e5                	jmp    8009ed <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 18                	ja     800a28 <vprintfmt+0x680>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a23:	e9 40 ff ff ff       	jmp    800968 <vprintfmt+0x5c0>
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb e6                	jmp    800a1c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 19                	ja     800a57 <vprintfmt+0x6af>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a52:	e9 11 ff ff ff       	jmp    800968 <vprintfmt+0x5c0>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e5                	jmp    800a4a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a71:	e9 59 ff ff ff       	jmp    8009cf <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a76:	4c 89 ee             	mov    %r13,%rsi
+  800a79:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a7e:	41 ff d6             	call   *%r14
+            break;
+  800a81:	e9 53 f9 ff ff       	jmp    8003d9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a86:	4c 89 ee             	mov    %r13,%rsi
+  800a89:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a8e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a91:	48 83 eb 01          	sub    $0x1,%rbx
+  800a95:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a99:	75 f6                	jne    800a91 <vprintfmt+0x6e9>
+  800a9b:	e9 39 f9 ff ff       	jmp    8003d9 <vprintfmt+0x31>
+}
+  800aa0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aa4:	5b                   	pop    %rbx
+  800aa5:	41 5c                	pop    %r12
+  800aa7:	41 5d                	pop    %r13
+  800aa9:	41 5e                	pop    %r14
+  800aab:	41 5f                	pop    %r15
+  800aad:	5d                   	pop    %rbp
+  800aae:	c3                   	ret
+
+0000000000800aaf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800aaf:	55                   	push   %rbp
+  800ab0:	48 89 e5             	mov    %rsp,%rbp
+  800ab3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ab7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800abb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ac0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ac4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800acb:	48 85 ff             	test   %rdi,%rdi
+  800ace:	74 2b                	je     800afb <vsnprintf+0x4c>
+  800ad0:	48 85 f6             	test   %rsi,%rsi
+  800ad3:	74 26                	je     800afb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ad5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ad9:	48 bf 53 03 80 00 00 	movabs $0x800353,%rdi
+  800ae0:	00 00 00 
+  800ae3:	48 b8 a8 03 80 00 00 	movabs $0x8003a8,%rax
+  800aea:	00 00 00 
+  800aed:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800af6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800af9:	c9                   	leave
+  800afa:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b00:	eb f7                	jmp    800af9 <vsnprintf+0x4a>
+
+0000000000800b02 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b02:	55                   	push   %rbp
+  800b03:	48 89 e5             	mov    %rsp,%rbp
+  800b06:	48 83 ec 50          	sub    $0x50,%rsp
+  800b0a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b0e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b12:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b16:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b1d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b25:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b29:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b2d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b31:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800b38:	00 00 00 
+  800b3b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b3d:	c9                   	leave
+  800b3e:	c3                   	ret
+
+0000000000800b3f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b3f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b42:	74 10                	je     800b54 <strlen+0x15>
+    size_t n = 0;
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b49:	48 83 c0 01          	add    $0x1,%rax
+  800b4d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b51:	75 f6                	jne    800b49 <strlen+0xa>
+  800b53:	c3                   	ret
+    size_t n = 0;
+  800b54:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b59:	c3                   	ret
+
+0000000000800b5a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b5a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b5d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b62:	48 85 f6             	test   %rsi,%rsi
+  800b65:	74 11                	je     800b78 <strnlen+0x1e>
+  800b67:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b6b:	74 0c                	je     800b79 <strnlen+0x1f>
+  800b6d:	48 83 c2 01          	add    $0x1,%rdx
+  800b71:	48 39 d0             	cmp    %rdx,%rax
+  800b74:	75 f1                	jne    800b67 <strnlen+0xd>
+  800b76:	eb 04                	jmp    800b7c <strnlen+0x22>
+  800b78:	c3                   	ret
+  800b79:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b7c:	c3                   	ret
+
+0000000000800b7d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b7d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b85:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b89:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b8c:	48 83 c2 01          	add    $0x1,%rdx
+  800b90:	84 c9                	test   %cl,%cl
+  800b92:	75 f1                	jne    800b85 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b94:	c3                   	ret
+
+0000000000800b95 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b95:	55                   	push   %rbp
+  800b96:	48 89 e5             	mov    %rsp,%rbp
+  800b99:	41 54                	push   %r12
+  800b9b:	53                   	push   %rbx
+  800b9c:	48 89 fb             	mov    %rdi,%rbx
+  800b9f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ba2:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  800ba9:	00 00 00 
+  800bac:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bae:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bb2:	4c 89 e6             	mov    %r12,%rsi
+  800bb5:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  800bbc:	00 00 00 
+  800bbf:	ff d0                	call   *%rax
+    return dst;
+}
+  800bc1:	48 89 d8             	mov    %rbx,%rax
+  800bc4:	5b                   	pop    %rbx
+  800bc5:	41 5c                	pop    %r12
+  800bc7:	5d                   	pop    %rbp
+  800bc8:	c3                   	ret
+
+0000000000800bc9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bc9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bcc:	48 85 d2             	test   %rdx,%rdx
+  800bcf:	74 1f                	je     800bf0 <strncpy+0x27>
+  800bd1:	48 01 fa             	add    %rdi,%rdx
+  800bd4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bd7:	48 83 c1 01          	add    $0x1,%rcx
+  800bdb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bdf:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800be3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800be7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800beb:	48 39 ca             	cmp    %rcx,%rdx
+  800bee:	75 e7                	jne    800bd7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bf0:	c3                   	ret
+
+0000000000800bf1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bf1:	48 89 f8             	mov    %rdi,%rax
+  800bf4:	48 85 d2             	test   %rdx,%rdx
+  800bf7:	74 24                	je     800c1d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bf9:	48 83 ea 01          	sub    $0x1,%rdx
+  800bfd:	74 1b                	je     800c1a <strlcpy+0x29>
+  800bff:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c03:	0f b6 16             	movzbl (%rsi),%edx
+  800c06:	84 d2                	test   %dl,%dl
+  800c08:	74 10                	je     800c1a <strlcpy+0x29>
+            *dst++ = *src++;
+  800c0a:	48 83 c6 01          	add    $0x1,%rsi
+  800c0e:	48 83 c0 01          	add    $0x1,%rax
+  800c12:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c15:	48 39 c8             	cmp    %rcx,%rax
+  800c18:	75 e9                	jne    800c03 <strlcpy+0x12>
+        *dst = '\0';
+  800c1a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c1d:	48 29 f8             	sub    %rdi,%rax
+}
+  800c20:	c3                   	ret
+
+0000000000800c21 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c21:	0f b6 07             	movzbl (%rdi),%eax
+  800c24:	84 c0                	test   %al,%al
+  800c26:	74 13                	je     800c3b <strcmp+0x1a>
+  800c28:	38 06                	cmp    %al,(%rsi)
+  800c2a:	75 0f                	jne    800c3b <strcmp+0x1a>
+  800c2c:	48 83 c7 01          	add    $0x1,%rdi
+  800c30:	48 83 c6 01          	add    $0x1,%rsi
+  800c34:	0f b6 07             	movzbl (%rdi),%eax
+  800c37:	84 c0                	test   %al,%al
+  800c39:	75 ed                	jne    800c28 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c3b:	0f b6 c0             	movzbl %al,%eax
+  800c3e:	0f b6 16             	movzbl (%rsi),%edx
+  800c41:	29 d0                	sub    %edx,%eax
+}
+  800c43:	c3                   	ret
+
+0000000000800c44 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c44:	48 85 d2             	test   %rdx,%rdx
+  800c47:	74 1f                	je     800c68 <strncmp+0x24>
+  800c49:	0f b6 07             	movzbl (%rdi),%eax
+  800c4c:	84 c0                	test   %al,%al
+  800c4e:	74 1e                	je     800c6e <strncmp+0x2a>
+  800c50:	3a 06                	cmp    (%rsi),%al
+  800c52:	75 1a                	jne    800c6e <strncmp+0x2a>
+  800c54:	48 83 c7 01          	add    $0x1,%rdi
+  800c58:	48 83 c6 01          	add    $0x1,%rsi
+  800c5c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c60:	75 e7                	jne    800c49 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c67:	c3                   	ret
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	c3                   	ret
+  800c6e:	48 85 d2             	test   %rdx,%rdx
+  800c71:	74 09                	je     800c7c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c73:	0f b6 07             	movzbl (%rdi),%eax
+  800c76:	0f b6 16             	movzbl (%rsi),%edx
+  800c79:	29 d0                	sub    %edx,%eax
+  800c7b:	c3                   	ret
+    if (!n) return 0;
+  800c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c81:	c3                   	ret
+
+0000000000800c82 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c82:	0f b6 17             	movzbl (%rdi),%edx
+  800c85:	84 d2                	test   %dl,%dl
+  800c87:	74 18                	je     800ca1 <strchr+0x1f>
+        if (*str == c) {
+  800c89:	0f be d2             	movsbl %dl,%edx
+  800c8c:	39 f2                	cmp    %esi,%edx
+  800c8e:	74 17                	je     800ca7 <strchr+0x25>
+    for (; *str; str++) {
+  800c90:	48 83 c7 01          	add    $0x1,%rdi
+  800c94:	0f b6 17             	movzbl (%rdi),%edx
+  800c97:	84 d2                	test   %dl,%dl
+  800c99:	75 ee                	jne    800c89 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca0:	c3                   	ret
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	c3                   	ret
+  800ca7:	48 89 f8             	mov    %rdi,%rax
+}
+  800caa:	c3                   	ret
+
+0000000000800cab <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cab:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cae:	0f b6 17             	movzbl (%rdi),%edx
+  800cb1:	84 d2                	test   %dl,%dl
+  800cb3:	74 13                	je     800cc8 <strfind+0x1d>
+  800cb5:	0f be d2             	movsbl %dl,%edx
+  800cb8:	39 f2                	cmp    %esi,%edx
+  800cba:	74 0b                	je     800cc7 <strfind+0x1c>
+  800cbc:	48 83 c0 01          	add    $0x1,%rax
+  800cc0:	0f b6 10             	movzbl (%rax),%edx
+  800cc3:	84 d2                	test   %dl,%dl
+  800cc5:	75 ee                	jne    800cb5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cc7:	c3                   	ret
+  800cc8:	c3                   	ret
+
+0000000000800cc9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cc9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ccc:	48 89 f8             	mov    %rdi,%rax
+  800ccf:	48 f7 d8             	neg    %rax
+  800cd2:	83 e0 07             	and    $0x7,%eax
+  800cd5:	49 89 d1             	mov    %rdx,%r9
+  800cd8:	49 29 c1             	sub    %rax,%r9
+  800cdb:	78 36                	js     800d13 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cdd:	40 0f b6 c6          	movzbl %sil,%eax
+  800ce1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ce8:	01 01 01 
+  800ceb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cef:	40 f6 c7 07          	test   $0x7,%dil
+  800cf3:	75 38                	jne    800d2d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cf5:	4c 89 c9             	mov    %r9,%rcx
+  800cf8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cfc:	74 0c                	je     800d0a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cfe:	fc                   	cld
+  800cff:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d02:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d06:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d0a:	4d 85 c9             	test   %r9,%r9
+  800d0d:	75 45                	jne    800d54 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d0f:	4c 89 c0             	mov    %r8,%rax
+  800d12:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d13:	48 85 d2             	test   %rdx,%rdx
+  800d16:	74 f7                	je     800d0f <memset+0x46>
+  800d18:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d1b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d1e:	48 83 c0 01          	add    $0x1,%rax
+  800d22:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d26:	48 39 c2             	cmp    %rax,%rdx
+  800d29:	75 f3                	jne    800d1e <memset+0x55>
+  800d2b:	eb e2                	jmp    800d0f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d2d:	40 f6 c7 01          	test   $0x1,%dil
+  800d31:	74 06                	je     800d39 <memset+0x70>
+  800d33:	88 07                	mov    %al,(%rdi)
+  800d35:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d39:	40 f6 c7 02          	test   $0x2,%dil
+  800d3d:	74 07                	je     800d46 <memset+0x7d>
+  800d3f:	66 89 07             	mov    %ax,(%rdi)
+  800d42:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d46:	40 f6 c7 04          	test   $0x4,%dil
+  800d4a:	74 a9                	je     800cf5 <memset+0x2c>
+  800d4c:	89 07                	mov    %eax,(%rdi)
+  800d4e:	48 83 c7 04          	add    $0x4,%rdi
+  800d52:	eb a1                	jmp    800cf5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d54:	41 f6 c1 04          	test   $0x4,%r9b
+  800d58:	74 06                	je     800d60 <memset+0x97>
+  800d5a:	89 07                	mov    %eax,(%rdi)
+  800d5c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d60:	41 f6 c1 02          	test   $0x2,%r9b
+  800d64:	74 07                	je     800d6d <memset+0xa4>
+  800d66:	66 89 07             	mov    %ax,(%rdi)
+  800d69:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d6d:	41 f6 c1 01          	test   $0x1,%r9b
+  800d71:	74 9c                	je     800d0f <memset+0x46>
+  800d73:	88 07                	mov    %al,(%rdi)
+  800d75:	eb 98                	jmp    800d0f <memset+0x46>
+
+0000000000800d77 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d77:	48 89 f8             	mov    %rdi,%rax
+  800d7a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d7d:	48 39 fe             	cmp    %rdi,%rsi
+  800d80:	73 3b                	jae    800dbd <memmove+0x46>
+  800d82:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d86:	48 39 d7             	cmp    %rdx,%rdi
+  800d89:	73 32                	jae    800dbd <memmove+0x46>
+        s += n;
+        d += n;
+  800d8b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d8f:	48 89 d6             	mov    %rdx,%rsi
+  800d92:	48 09 fe             	or     %rdi,%rsi
+  800d95:	48 09 ce             	or     %rcx,%rsi
+  800d98:	40 f6 c6 07          	test   $0x7,%sil
+  800d9c:	75 12                	jne    800db0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d9e:	48 83 ef 08          	sub    $0x8,%rdi
+  800da2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800da6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800daa:	fd                   	std
+  800dab:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dae:	fc                   	cld
+  800daf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800db0:	48 83 ef 01          	sub    $0x1,%rdi
+  800db4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800db8:	fd                   	std
+  800db9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dbb:	eb f1                	jmp    800dae <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dbd:	48 89 f2             	mov    %rsi,%rdx
+  800dc0:	48 09 c2             	or     %rax,%rdx
+  800dc3:	48 09 ca             	or     %rcx,%rdx
+  800dc6:	f6 c2 07             	test   $0x7,%dl
+  800dc9:	75 0c                	jne    800dd7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dcb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dcf:	48 89 c7             	mov    %rax,%rdi
+  800dd2:	fc                   	cld
+  800dd3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dd6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800dd7:	48 89 c7             	mov    %rax,%rdi
+  800dda:	fc                   	cld
+  800ddb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ddd:	c3                   	ret
+
+0000000000800dde <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dde:	55                   	push   %rbp
+  800ddf:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800de2:	48 b8 77 0d 80 00 00 	movabs $0x800d77,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+}
+  800dee:	5d                   	pop    %rbp
+  800def:	c3                   	ret
+
+0000000000800df0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800df0:	55                   	push   %rbp
+  800df1:	48 89 e5             	mov    %rsp,%rbp
+  800df4:	41 57                	push   %r15
+  800df6:	41 56                	push   %r14
+  800df8:	41 55                	push   %r13
+  800dfa:	41 54                	push   %r12
+  800dfc:	53                   	push   %rbx
+  800dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  800e01:	49 89 fe             	mov    %rdi,%r14
+  800e04:	49 89 f7             	mov    %rsi,%r15
+  800e07:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e0a:	48 89 f7             	mov    %rsi,%rdi
+  800e0d:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  800e14:	00 00 00 
+  800e17:	ff d0                	call   *%rax
+  800e19:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e1c:	48 89 de             	mov    %rbx,%rsi
+  800e1f:	4c 89 f7             	mov    %r14,%rdi
+  800e22:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800e29:	00 00 00 
+  800e2c:	ff d0                	call   *%rax
+  800e2e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e31:	48 39 c3             	cmp    %rax,%rbx
+  800e34:	74 36                	je     800e6c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e36:	48 89 d8             	mov    %rbx,%rax
+  800e39:	4c 29 e8             	sub    %r13,%rax
+  800e3c:	49 39 c4             	cmp    %rax,%r12
+  800e3f:	73 31                	jae    800e72 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e41:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e46:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e4a:	4c 89 fe             	mov    %r15,%rsi
+  800e4d:	48 b8 de 0d 80 00 00 	movabs $0x800dde,%rax
+  800e54:	00 00 00 
+  800e57:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e59:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e5d:	48 83 c4 08          	add    $0x8,%rsp
+  800e61:	5b                   	pop    %rbx
+  800e62:	41 5c                	pop    %r12
+  800e64:	41 5d                	pop    %r13
+  800e66:	41 5e                	pop    %r14
+  800e68:	41 5f                	pop    %r15
+  800e6a:	5d                   	pop    %rbp
+  800e6b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e6c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e70:	eb eb                	jmp    800e5d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e72:	48 83 eb 01          	sub    $0x1,%rbx
+  800e76:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e7a:	48 89 da             	mov    %rbx,%rdx
+  800e7d:	4c 89 fe             	mov    %r15,%rsi
+  800e80:	48 b8 de 0d 80 00 00 	movabs $0x800dde,%rax
+  800e87:	00 00 00 
+  800e8a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e8c:	49 01 de             	add    %rbx,%r14
+  800e8f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e94:	eb c3                	jmp    800e59 <strlcat+0x69>
+
+0000000000800e96 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e96:	48 85 d2             	test   %rdx,%rdx
+  800e99:	74 2d                	je     800ec8 <memcmp+0x32>
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ea0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ea4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ea9:	44 38 c1             	cmp    %r8b,%cl
+  800eac:	75 0f                	jne    800ebd <memcmp+0x27>
+    while (n-- > 0) {
+  800eae:	48 83 c0 01          	add    $0x1,%rax
+  800eb2:	48 39 c2             	cmp    %rax,%rdx
+  800eb5:	75 e9                	jne    800ea0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ebd:	0f b6 c1             	movzbl %cl,%eax
+  800ec0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ec4:	44 29 c0             	sub    %r8d,%eax
+  800ec7:	c3                   	ret
+    return 0;
+  800ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ecd:	c3                   	ret
+
+0000000000800ece <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ece:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ed2:	48 39 c7             	cmp    %rax,%rdi
+  800ed5:	73 0f                	jae    800ee6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ed7:	40 38 37             	cmp    %sil,(%rdi)
+  800eda:	74 0e                	je     800eea <memfind+0x1c>
+    for (; src < end; src++) {
+  800edc:	48 83 c7 01          	add    $0x1,%rdi
+  800ee0:	48 39 f8             	cmp    %rdi,%rax
+  800ee3:	75 f2                	jne    800ed7 <memfind+0x9>
+  800ee5:	c3                   	ret
+  800ee6:	48 89 f8             	mov    %rdi,%rax
+  800ee9:	c3                   	ret
+  800eea:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800eed:	c3                   	ret
+
+0000000000800eee <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800eee:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ef1:	0f b6 37             	movzbl (%rdi),%esi
+  800ef4:	40 80 fe 20          	cmp    $0x20,%sil
+  800ef8:	74 06                	je     800f00 <strtol+0x12>
+  800efa:	40 80 fe 09          	cmp    $0x9,%sil
+  800efe:	75 13                	jne    800f13 <strtol+0x25>
+  800f00:	48 83 c7 01          	add    $0x1,%rdi
+  800f04:	0f b6 37             	movzbl (%rdi),%esi
+  800f07:	40 80 fe 20          	cmp    $0x20,%sil
+  800f0b:	74 f3                	je     800f00 <strtol+0x12>
+  800f0d:	40 80 fe 09          	cmp    $0x9,%sil
+  800f11:	74 ed                	je     800f00 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f13:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f16:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f19:	3c 01                	cmp    $0x1,%al
+  800f1b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f1f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f25:	75 0f                	jne    800f36 <strtol+0x48>
+  800f27:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f2a:	74 14                	je     800f40 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f2c:	85 d2                	test   %edx,%edx
+  800f2e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f33:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f3b:	4c 63 ca             	movslq %edx,%r9
+  800f3e:	eb 36                	jmp    800f76 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f40:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f44:	74 0f                	je     800f55 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f46:	85 d2                	test   %edx,%edx
+  800f48:	75 ec                	jne    800f36 <strtol+0x48>
+        s++;
+  800f4a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f4e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f53:	eb e1                	jmp    800f36 <strtol+0x48>
+        s += 2;
+  800f55:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f59:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f5e:	eb d6                	jmp    800f36 <strtol+0x48>
+            dig -= '0';
+  800f60:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f63:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f67:	41 39 d0             	cmp    %edx,%r8d
+  800f6a:	7d 21                	jge    800f8d <strtol+0x9f>
+        val = val * base + dig;
+  800f6c:	49 0f af c1          	imul   %r9,%rax
+  800f70:	0f b6 c9             	movzbl %cl,%ecx
+  800f73:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f76:	48 83 c7 01          	add    $0x1,%rdi
+  800f7a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f7e:	80 f9 39             	cmp    $0x39,%cl
+  800f81:	76 dd                	jbe    800f60 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f83:	80 f9 7b             	cmp    $0x7b,%cl
+  800f86:	77 05                	ja     800f8d <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f88:	83 e9 57             	sub    $0x57,%ecx
+  800f8b:	eb d6                	jmp    800f63 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f8d:	4d 85 d2             	test   %r10,%r10
+  800f90:	74 03                	je     800f95 <strtol+0xa7>
+  800f92:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f95:	48 89 c2             	mov    %rax,%rdx
+  800f98:	48 f7 da             	neg    %rdx
+  800f9b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f9f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <strrev>:
+
+void
+strrev(char *str)
+{
+  800fa4:	55                   	push   %rbp
+  800fa5:	48 89 e5             	mov    %rsp,%rbp
+  800fa8:	53                   	push   %rbx
+  800fa9:	48 83 ec 08          	sub    $0x8,%rsp
+  800fad:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fb0:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  800fb7:	00 00 00 
+  800fba:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fbc:	83 e8 01             	sub    $0x1,%eax
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7e 22                	jle    800fe5 <strrev+0x41>
+  800fc3:	48 98                	cltq
+  800fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800fca:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800fce:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800fd2:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800fd6:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fd9:	48 83 c2 01          	add    $0x1,%rdx
+  800fdd:	48 83 e8 01          	sub    $0x1,%rax
+  800fe1:	39 c2                	cmp    %eax,%edx
+  800fe3:	7c e5                	jl     800fca <strrev+0x26>
+	}
+}
+  800fe5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe9:	c9                   	leave
+  800fea:	c3                   	ret
+
+0000000000800feb <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800feb:	85 d2                	test   %edx,%edx
+  800fed:	0f 84 80 00 00 00    	je     801073 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800ff3:	55                   	push   %rbp
+  800ff4:	48 89 e5             	mov    %rsp,%rbp
+  800ff7:	53                   	push   %rbx
+  800ff8:	48 83 ec 08          	sub    $0x8,%rsp
+  800ffc:	49 89 f2             	mov    %rsi,%r10
+  800fff:	41 89 d3             	mov    %edx,%r11d
+  801002:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801005:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80100a:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80100d:	eb 20                	jmp    80102f <itoa+0x44>
+			str[i++] = '0' + digit;
+  80100f:	41 89 f1             	mov    %esi,%r9d
+  801012:	83 c2 30             	add    $0x30,%edx
+  801015:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801018:	89 f8                	mov    %edi,%eax
+  80101a:	99                   	cltd
+  80101b:	f7 f9                	idiv   %ecx
+  80101d:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	74 2e                	je     801051 <itoa+0x66>
+  801023:	83 c6 01             	add    $0x1,%esi
+  801026:	49 83 c0 01          	add    $0x1,%r8
+  80102a:	44 39 cb             	cmp    %r9d,%ebx
+  80102d:	7e 15                	jle    801044 <itoa+0x59>
+		digit = sum % base;
+  80102f:	89 f8                	mov    %edi,%eax
+  801031:	99                   	cltd
+  801032:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801034:	83 fa 09             	cmp    $0x9,%edx
+  801037:	7e d6                	jle    80100f <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801039:	41 89 f1             	mov    %esi,%r9d
+  80103c:	83 c2 37             	add    $0x37,%edx
+  80103f:	41 88 10             	mov    %dl,(%r8)
+  801042:	eb d4                	jmp    801018 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801044:	41 83 eb 01          	sub    $0x1,%r11d
+  801048:	45 39 cb             	cmp    %r9d,%r11d
+  80104b:	75 04                	jne    801051 <itoa+0x66>
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	75 28                	jne    801079 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801051:	4d 63 c9             	movslq %r9d,%r9
+  801054:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801059:	4c 89 d7             	mov    %r10,%rdi
+  80105c:	48 b8 a4 0f 80 00 00 	movabs $0x800fa4,%rax
+  801063:	00 00 00 
+  801066:	ff d0                	call   *%rax
+	return 0;
+  801068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801071:	c9                   	leave
+  801072:	c3                   	ret
+		return -1;
+  801073:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801078:	c3                   	ret
+		return -1;
+  801079:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80107e:	eb ed                	jmp    80106d <itoa+0x82>
+
+0000000000801080 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+  801084:	53                   	push   %rbx
+  801085:	48 89 fa             	mov    %rdi,%rdx
+  801088:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801090:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801095:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80109a:	be 00 00 00 00       	mov    $0x0,%esi
+  80109f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ab:	c9                   	leave
+  8010ac:	c3                   	ret
+
+00000000008010ad <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010ad:	55                   	push   %rbp
+  8010ae:	48 89 e5             	mov    %rsp,%rbp
+  8010b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010dc:	c9                   	leave
+  8010dd:	c3                   	ret
+
+00000000008010de <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010de:	55                   	push   %rbp
+  8010df:	48 89 e5             	mov    %rsp,%rbp
+  8010e2:	53                   	push   %rbx
+  8010e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ea:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801103:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801109:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80110b:	48 85 c0             	test   %rax,%rax
+  80110e:	7f 06                	jg     801116 <sys_env_destroy+0x38>
+}
+  801110:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801114:	c9                   	leave
+  801115:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801116:	49 89 c0             	mov    %rax,%r8
+  801119:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80111e:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  801125:	00 00 00 
+  801128:	be 26 00 00 00       	mov    $0x26,%esi
+  80112d:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  801134:	00 00 00 
+  801137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113c:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  801143:	00 00 00 
+  801146:	41 ff d1             	call   *%r9
+
+0000000000801149 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801149:	55                   	push   %rbp
+  80114a:	48 89 e5             	mov    %rsp,%rbp
+  80114d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80114e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801153:	ba 00 00 00 00       	mov    $0x0,%edx
+  801158:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80115d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801162:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801167:	be 00 00 00 00       	mov    $0x0,%esi
+  80116c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801172:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+
+000000000080117a <sys_yield>:
+
+void
+sys_yield(void) {
+  80117a:	55                   	push   %rbp
+  80117b:	48 89 e5             	mov    %rsp,%rbp
+  80117e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80117f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801184:	ba 00 00 00 00       	mov    $0x0,%edx
+  801189:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801193:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801198:	be 00 00 00 00       	mov    $0x0,%esi
+  80119d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a9:	c9                   	leave
+  8011aa:	c3                   	ret
+
+00000000008011ab <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011ab:	55                   	push   %rbp
+  8011ac:	48 89 e5             	mov    %rsp,%rbp
+  8011af:	53                   	push   %rbx
+  8011b0:	48 89 fa             	mov    %rdi,%rdx
+  8011b3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011bb:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011c2:	00 00 00 
+  8011c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011db:	c9                   	leave
+  8011dc:	c3                   	ret
+
+00000000008011dd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011dd:	55                   	push   %rbp
+  8011de:	48 89 e5             	mov    %rsp,%rbp
+  8011e1:	53                   	push   %rbx
+  8011e2:	49 89 f8             	mov    %rdi,%r8
+  8011e5:	48 89 d3             	mov    %rdx,%rbx
+  8011e8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011eb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f0:	4c 89 c2             	mov    %r8,%rdx
+  8011f3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801201:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801203:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801207:	c9                   	leave
+  801208:	c3                   	ret
+
+0000000000801209 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801209:	55                   	push   %rbp
+  80120a:	48 89 e5             	mov    %rsp,%rbp
+  80120d:	53                   	push   %rbx
+  80120e:	48 83 ec 08          	sub    $0x8,%rsp
+  801212:	89 f8                	mov    %edi,%eax
+  801214:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801217:	48 63 f9             	movslq %ecx,%rdi
+  80121a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80121d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801222:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801230:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801232:	48 85 c0             	test   %rax,%rax
+  801235:	7f 06                	jg     80123d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80123d:	49 89 c0             	mov    %rax,%r8
+  801240:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801245:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  80124c:	00 00 00 
+  80124f:	be 26 00 00 00       	mov    $0x26,%esi
+  801254:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  80125b:	00 00 00 
+  80125e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801263:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  80126a:	00 00 00 
+  80126d:	41 ff d1             	call   *%r9
+
+0000000000801270 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	53                   	push   %rbx
+  801275:	48 83 ec 08          	sub    $0x8,%rsp
+  801279:	89 f8                	mov    %edi,%eax
+  80127b:	49 89 f2             	mov    %rsi,%r10
+  80127e:	48 89 cf             	mov    %rcx,%rdi
+  801281:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801284:	48 63 da             	movslq %edx,%rbx
+  801287:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801292:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801295:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801297:	48 85 c0             	test   %rax,%rax
+  80129a:	7f 06                	jg     8012a2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80129c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a0:	c9                   	leave
+  8012a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a2:	49 89 c0             	mov    %rax,%r8
+  8012a5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012aa:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  8012b1:	00 00 00 
+  8012b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b9:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  8012c0:	00 00 00 
+  8012c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c8:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  8012cf:	00 00 00 
+  8012d2:	41 ff d1             	call   *%r9
+
+00000000008012d5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012d5:	55                   	push   %rbp
+  8012d6:	48 89 e5             	mov    %rsp,%rbp
+  8012d9:	53                   	push   %rbx
+  8012da:	48 83 ec 08          	sub    $0x8,%rsp
+  8012de:	48 89 f1             	mov    %rsi,%rcx
+  8012e1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fe:	48 85 c0             	test   %rax,%rax
+  801301:	7f 06                	jg     801309 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801303:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801307:	c9                   	leave
+  801308:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801309:	49 89 c0             	mov    %rax,%r8
+  80130c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801311:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  801318:	00 00 00 
+  80131b:	be 26 00 00 00       	mov    $0x26,%esi
+  801320:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  801327:	00 00 00 
+  80132a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132f:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  801336:	00 00 00 
+  801339:	41 ff d1             	call   *%r9
+
+000000000080133c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80133c:	55                   	push   %rbp
+  80133d:	48 89 e5             	mov    %rsp,%rbp
+  801340:	53                   	push   %rbx
+  801341:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801345:	48 63 ce             	movslq %esi,%rcx
+  801348:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801350:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801355:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135a:	be 00 00 00 00       	mov    $0x0,%esi
+  80135f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801365:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801367:	48 85 c0             	test   %rax,%rax
+  80136a:	7f 06                	jg     801372 <sys_env_set_status+0x36>
+}
+  80136c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801372:	49 89 c0             	mov    %rax,%r8
+  801375:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80137a:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  801381:	00 00 00 
+  801384:	be 26 00 00 00       	mov    $0x26,%esi
+  801389:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  801390:	00 00 00 
+  801393:	b8 00 00 00 00       	mov    $0x0,%eax
+  801398:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  80139f:	00 00 00 
+  8013a2:	41 ff d1             	call   *%r9
+
+00000000008013a5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013a5:	55                   	push   %rbp
+  8013a6:	48 89 e5             	mov    %rsp,%rbp
+  8013a9:	53                   	push   %rbx
+  8013aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ae:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d0:	48 85 c0             	test   %rax,%rax
+  8013d3:	7f 06                	jg     8013db <sys_env_set_trapframe+0x36>
+}
+  8013d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d9:	c9                   	leave
+  8013da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013db:	49 89 c0             	mov    %rax,%r8
+  8013de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013e3:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  8013ea:	00 00 00 
+  8013ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f2:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  8013f9:	00 00 00 
+  8013fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801401:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  801408:	00 00 00 
+  80140b:	41 ff d1             	call   *%r9
+
+000000000080140e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	53                   	push   %rbx
+  801413:	48 83 ec 08          	sub    $0x8,%rsp
+  801417:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80141a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801427:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+  801431:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801437:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801439:	48 85 c0             	test   %rax,%rax
+  80143c:	7f 06                	jg     801444 <sys_env_set_pgfault_upcall+0x36>
+}
+  80143e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801442:	c9                   	leave
+  801443:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801444:	49 89 c0             	mov    %rax,%r8
+  801447:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80144c:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  801453:	00 00 00 
+  801456:	be 26 00 00 00       	mov    $0x26,%esi
+  80145b:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  801462:	00 00 00 
+  801465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146a:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  801471:	00 00 00 
+  801474:	41 ff d1             	call   *%r9
+
+0000000000801477 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801477:	55                   	push   %rbp
+  801478:	48 89 e5             	mov    %rsp,%rbp
+  80147b:	53                   	push   %rbx
+  80147c:	89 f8                	mov    %edi,%eax
+  80147e:	49 89 f1             	mov    %rsi,%r9
+  801481:	48 89 d3             	mov    %rdx,%rbx
+  801484:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801487:	49 63 f0             	movslq %r8d,%rsi
+  80148a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801492:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801495:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149b:	cd 30                	int    $0x30
+}
+  80149d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a1:	c9                   	leave
+  8014a2:	c3                   	ret
+
+00000000008014a3 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014a3:	55                   	push   %rbp
+  8014a4:	48 89 e5             	mov    %rsp,%rbp
+  8014a7:	53                   	push   %rbx
+  8014a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ac:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014af:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cc:	48 85 c0             	test   %rax,%rax
+  8014cf:	7f 06                	jg     8014d7 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d5:	c9                   	leave
+  8014d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d7:	49 89 c0             	mov    %rax,%r8
+  8014da:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014df:	48 ba c8 3c 80 00 00 	movabs $0x803cc8,%rdx
+  8014e6:	00 00 00 
+  8014e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ee:	48 bf e7 3c 80 00 00 	movabs $0x803ce7,%rdi
+  8014f5:	00 00 00 
+  8014f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fd:	49 b9 6a 34 80 00 00 	movabs $0x80346a,%r9
+  801504:	00 00 00 
+  801507:	41 ff d1             	call   *%r9
+
+000000000080150a <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80150a:	55                   	push   %rbp
+  80150b:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80150e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801513:	48 b8 a3 14 80 00 00 	movabs $0x8014a3,%rax
+  80151a:	00 00 00 
+  80151d:	ff d0                	call   *%rax
+}
+  80151f:	5d                   	pop    %rbp
+  801520:	c3                   	ret
+
+0000000000801521 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801530:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801535:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153f:	be 00 00 00 00       	mov    $0x0,%esi
+  801544:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80154c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801550:	c9                   	leave
+  801551:	c3                   	ret
+
+0000000000801552 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801552:	55                   	push   %rbp
+  801553:	48 89 e5             	mov    %rsp,%rbp
+  801556:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801557:	48 63 ce             	movslq %esi,%rcx
+  80155a:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80155e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801568:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156d:	be 00 00 00 00       	mov    $0x0,%esi
+  801572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801578:	cd 30                	int    $0x30
+}
+  80157a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157e:	c9                   	leave
+  80157f:	c3                   	ret
+
+0000000000801580 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801588:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80158c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801596:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159b:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a6:	cd 30                	int    $0x30
+}
+  8015a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ac:	c9                   	leave
+  8015ad:	c3                   	ret
+
+00000000008015ae <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015b6:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015be:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d1:	cd 30                	int    $0x30
+}
+  8015d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d7:	c9                   	leave
+  8015d8:	c3                   	ret
+
+00000000008015d9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015d9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015e0:	ff ff ff 
+  8015e3:	48 01 f8             	add    %rdi,%rax
+  8015e6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8015ea:	c3                   	ret
+
+00000000008015eb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015eb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015f2:	ff ff ff 
+  8015f5:	48 01 f8             	add    %rdi,%rax
+  8015f8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8015fc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801602:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801606:	c3                   	ret
+
+0000000000801607 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801607:	55                   	push   %rbp
+  801608:	48 89 e5             	mov    %rsp,%rbp
+  80160b:	41 57                	push   %r15
+  80160d:	41 56                	push   %r14
+  80160f:	41 55                	push   %r13
+  801611:	41 54                	push   %r12
+  801613:	53                   	push   %rbx
+  801614:	48 83 ec 08          	sub    $0x8,%rsp
+  801618:	49 89 ff             	mov    %rdi,%r15
+  80161b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801620:	49 bd 26 31 80 00 00 	movabs $0x803126,%r13
+  801627:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80162a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801630:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801633:	48 89 df             	mov    %rbx,%rdi
+  801636:	41 ff d5             	call   *%r13
+  801639:	83 e0 04             	and    $0x4,%eax
+  80163c:	74 17                	je     801655 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80163e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801645:	4c 39 f3             	cmp    %r14,%rbx
+  801648:	75 e6                	jne    801630 <fd_alloc+0x29>
+  80164a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801650:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801655:	4d 89 27             	mov    %r12,(%r15)
+}
+  801658:	48 83 c4 08          	add    $0x8,%rsp
+  80165c:	5b                   	pop    %rbx
+  80165d:	41 5c                	pop    %r12
+  80165f:	41 5d                	pop    %r13
+  801661:	41 5e                	pop    %r14
+  801663:	41 5f                	pop    %r15
+  801665:	5d                   	pop    %rbp
+  801666:	c3                   	ret
+
+0000000000801667 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801667:	83 ff 1f             	cmp    $0x1f,%edi
+  80166a:	77 39                	ja     8016a5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	41 54                	push   %r12
+  801672:	53                   	push   %rbx
+  801673:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801676:	48 63 df             	movslq %edi,%rbx
+  801679:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801680:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801684:	48 89 df             	mov    %rbx,%rdi
+  801687:	48 b8 26 31 80 00 00 	movabs $0x803126,%rax
+  80168e:	00 00 00 
+  801691:	ff d0                	call   *%rax
+  801693:	a8 04                	test   $0x4,%al
+  801695:	74 14                	je     8016ab <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801697:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80169b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a0:	5b                   	pop    %rbx
+  8016a1:	41 5c                	pop    %r12
+  8016a3:	5d                   	pop    %rbp
+  8016a4:	c3                   	ret
+        return -E_INVAL;
+  8016a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016aa:	c3                   	ret
+        return -E_INVAL;
+  8016ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b0:	eb ee                	jmp    8016a0 <fd_lookup+0x39>
+
+00000000008016b2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	41 54                	push   %r12
+  8016b8:	53                   	push   %rbx
+  8016b9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016bc:	48 b8 a0 3d 80 00 00 	movabs $0x803da0,%rax
+  8016c3:	00 00 00 
+  8016c6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8016cd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8016d0:	39 3b                	cmp    %edi,(%rbx)
+  8016d2:	74 47                	je     80171b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8016d4:	48 83 c0 08          	add    $0x8,%rax
+  8016d8:	48 8b 18             	mov    (%rax),%rbx
+  8016db:	48 85 db             	test   %rbx,%rbx
+  8016de:	75 f0                	jne    8016d0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016e0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8016e7:	00 00 00 
+  8016ea:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8016f0:	89 fa                	mov    %edi,%edx
+  8016f2:	48 bf f8 3c 80 00 00 	movabs $0x803cf8,%rdi
+  8016f9:	00 00 00 
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	48 b9 58 02 80 00 00 	movabs $0x800258,%rcx
+  801708:	00 00 00 
+  80170b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80170d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801712:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801716:	5b                   	pop    %rbx
+  801717:	41 5c                	pop    %r12
+  801719:	5d                   	pop    %rbp
+  80171a:	c3                   	ret
+            return 0;
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	eb f0                	jmp    801712 <dev_lookup+0x60>
+
+0000000000801722 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801722:	55                   	push   %rbp
+  801723:	48 89 e5             	mov    %rsp,%rbp
+  801726:	41 55                	push   %r13
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	48 83 ec 18          	sub    $0x18,%rsp
+  80172f:	48 89 fb             	mov    %rdi,%rbx
+  801732:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801735:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80173c:	ff ff ff 
+  80173f:	48 01 df             	add    %rbx,%rdi
+  801742:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801746:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80174a:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801751:	00 00 00 
+  801754:	ff d0                	call   *%rax
+  801756:	41 89 c5             	mov    %eax,%r13d
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	78 06                	js     801763 <fd_close+0x41>
+  80175d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801761:	74 1a                	je     80177d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801763:	45 84 e4             	test   %r12b,%r12b
+  801766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80176f:	44 89 e8             	mov    %r13d,%eax
+  801772:	48 83 c4 18          	add    $0x18,%rsp
+  801776:	5b                   	pop    %rbx
+  801777:	41 5c                	pop    %r12
+  801779:	41 5d                	pop    %r13
+  80177b:	5d                   	pop    %rbp
+  80177c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80177d:	8b 3b                	mov    (%rbx),%edi
+  80177f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801783:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  80178a:	00 00 00 
+  80178d:	ff d0                	call   *%rax
+  80178f:	41 89 c5             	mov    %eax,%r13d
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 1b                	js     8017b1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801796:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80179a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80179e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017a4:	48 85 c0             	test   %rax,%rax
+  8017a7:	74 08                	je     8017b1 <fd_close+0x8f>
+  8017a9:	48 89 df             	mov    %rbx,%rdi
+  8017ac:	ff d0                	call   *%rax
+  8017ae:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017b6:	48 89 de             	mov    %rbx,%rsi
+  8017b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017be:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+    return res;
+  8017ca:	eb a3                	jmp    80176f <fd_close+0x4d>
+
+00000000008017cc <close>:
+
+int
+close(int fdnum) {
+  8017cc:	55                   	push   %rbp
+  8017cd:	48 89 e5             	mov    %rsp,%rbp
+  8017d0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8017d4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017d8:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  8017df:	00 00 00 
+  8017e2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	78 15                	js     8017fd <close+0x31>
+
+    return fd_close(fd, 1);
+  8017e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8017ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8017f1:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  8017f8:	00 00 00 
+  8017fb:	ff d0                	call   *%rax
+}
+  8017fd:	c9                   	leave
+  8017fe:	c3                   	ret
+
+00000000008017ff <close_all>:
+
+void
+close_all(void) {
+  8017ff:	55                   	push   %rbp
+  801800:	48 89 e5             	mov    %rsp,%rbp
+  801803:	41 54                	push   %r12
+  801805:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801806:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180b:	49 bc cc 17 80 00 00 	movabs $0x8017cc,%r12
+  801812:	00 00 00 
+  801815:	89 df                	mov    %ebx,%edi
+  801817:	41 ff d4             	call   *%r12
+  80181a:	83 c3 01             	add    $0x1,%ebx
+  80181d:	83 fb 20             	cmp    $0x20,%ebx
+  801820:	75 f3                	jne    801815 <close_all+0x16>
+}
+  801822:	5b                   	pop    %rbx
+  801823:	41 5c                	pop    %r12
+  801825:	5d                   	pop    %rbp
+  801826:	c3                   	ret
+
+0000000000801827 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  80182b:	41 57                	push   %r15
+  80182d:	41 56                	push   %r14
+  80182f:	41 55                	push   %r13
+  801831:	41 54                	push   %r12
+  801833:	53                   	push   %rbx
+  801834:	48 83 ec 18          	sub    $0x18,%rsp
+  801838:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80183b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80183f:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801846:	00 00 00 
+  801849:	ff d0                	call   *%rax
+  80184b:	89 c3                	mov    %eax,%ebx
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	0f 88 b8 00 00 00    	js     80190d <dup+0xe6>
+    close(newfdnum);
+  801855:	44 89 e7             	mov    %r12d,%edi
+  801858:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801864:	4d 63 ec             	movslq %r12d,%r13
+  801867:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80186e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801872:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801876:	4c 89 ff             	mov    %r15,%rdi
+  801879:	49 be eb 15 80 00 00 	movabs $0x8015eb,%r14
+  801880:	00 00 00 
+  801883:	41 ff d6             	call   *%r14
+  801886:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801889:	4c 89 ef             	mov    %r13,%rdi
+  80188c:	41 ff d6             	call   *%r14
+  80188f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801892:	48 89 df             	mov    %rbx,%rdi
+  801895:	48 b8 26 31 80 00 00 	movabs $0x803126,%rax
+  80189c:	00 00 00 
+  80189f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018a1:	a8 04                	test   $0x4,%al
+  8018a3:	74 2b                	je     8018d0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018a5:	41 89 c1             	mov    %eax,%r9d
+  8018a8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018ae:	4c 89 f1             	mov    %r14,%rcx
+  8018b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b6:	48 89 de             	mov    %rbx,%rsi
+  8018b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018be:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+  8018ca:	89 c3                	mov    %eax,%ebx
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	78 4e                	js     80191e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8018d0:	4c 89 ff             	mov    %r15,%rdi
+  8018d3:	48 b8 26 31 80 00 00 	movabs $0x803126,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+  8018df:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8018e2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018e8:	4c 89 e9             	mov    %r13,%rcx
+  8018eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f0:	4c 89 fe             	mov    %r15,%rsi
+  8018f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018f8:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+  801904:	89 c3                	mov    %eax,%ebx
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 14                	js     80191e <dup+0xf7>
+
+    return newfdnum;
+  80190a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80190d:	89 d8                	mov    %ebx,%eax
+  80190f:	48 83 c4 18          	add    $0x18,%rsp
+  801913:	5b                   	pop    %rbx
+  801914:	41 5c                	pop    %r12
+  801916:	41 5d                	pop    %r13
+  801918:	41 5e                	pop    %r14
+  80191a:	41 5f                	pop    %r15
+  80191c:	5d                   	pop    %rbp
+  80191d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80191e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801923:	4c 89 ee             	mov    %r13,%rsi
+  801926:	bf 00 00 00 00       	mov    $0x0,%edi
+  80192b:	49 bc d5 12 80 00 00 	movabs $0x8012d5,%r12
+  801932:	00 00 00 
+  801935:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801938:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80193d:	4c 89 f6             	mov    %r14,%rsi
+  801940:	bf 00 00 00 00       	mov    $0x0,%edi
+  801945:	41 ff d4             	call   *%r12
+    return res;
+  801948:	eb c3                	jmp    80190d <dup+0xe6>
+
+000000000080194a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	41 56                	push   %r14
+  801950:	41 55                	push   %r13
+  801952:	41 54                	push   %r12
+  801954:	53                   	push   %rbx
+  801955:	48 83 ec 10          	sub    $0x10,%rsp
+  801959:	89 fb                	mov    %edi,%ebx
+  80195b:	49 89 f4             	mov    %rsi,%r12
+  80195e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801961:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801965:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  80196c:	00 00 00 
+  80196f:	ff d0                	call   *%rax
+  801971:	85 c0                	test   %eax,%eax
+  801973:	78 4c                	js     8019c1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801975:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801979:	41 8b 3e             	mov    (%r14),%edi
+  80197c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801980:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801987:	00 00 00 
+  80198a:	ff d0                	call   *%rax
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 35                	js     8019c5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801990:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801994:	83 e0 03             	and    $0x3,%eax
+  801997:	83 f8 01             	cmp    $0x1,%eax
+  80199a:	74 2d                	je     8019c9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80199c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019a0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019a4:	48 85 c0             	test   %rax,%rax
+  8019a7:	74 56                	je     8019ff <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019a9:	4c 89 ea             	mov    %r13,%rdx
+  8019ac:	4c 89 e6             	mov    %r12,%rsi
+  8019af:	4c 89 f7             	mov    %r14,%rdi
+  8019b2:	ff d0                	call   *%rax
+}
+  8019b4:	48 83 c4 10          	add    $0x10,%rsp
+  8019b8:	5b                   	pop    %rbx
+  8019b9:	41 5c                	pop    %r12
+  8019bb:	41 5d                	pop    %r13
+  8019bd:	41 5e                	pop    %r14
+  8019bf:	5d                   	pop    %rbp
+  8019c0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c1:	48 98                	cltq
+  8019c3:	eb ef                	jmp    8019b4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019c5:	48 98                	cltq
+  8019c7:	eb eb                	jmp    8019b4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019c9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019d0:	00 00 00 
+  8019d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019d9:	89 da                	mov    %ebx,%edx
+  8019db:	48 bf 59 3d 80 00 00 	movabs $0x803d59,%rdi
+  8019e2:	00 00 00 
+  8019e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ea:	48 b9 58 02 80 00 00 	movabs $0x800258,%rcx
+  8019f1:	00 00 00 
+  8019f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019f6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019fd:	eb b5                	jmp    8019b4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019ff:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a06:	eb ac                	jmp    8019b4 <read+0x6a>
+
+0000000000801a08 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a08:	55                   	push   %rbp
+  801a09:	48 89 e5             	mov    %rsp,%rbp
+  801a0c:	41 56                	push   %r14
+  801a0e:	41 55                	push   %r13
+  801a10:	41 54                	push   %r12
+  801a12:	53                   	push   %rbx
+  801a13:	48 83 ec 10          	sub    $0x10,%rsp
+  801a17:	89 fb                	mov    %edi,%ebx
+  801a19:	49 89 f4             	mov    %rsi,%r12
+  801a1c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a23:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801a2a:	00 00 00 
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 41                	js     801a74 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a33:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a37:	41 8b 3e             	mov    (%r14),%edi
+  801a3a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a3e:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	78 35                	js     801a83 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a4e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a52:	83 e0 03             	and    $0x3,%eax
+  801a55:	83 f8 01             	cmp    $0x1,%eax
+  801a58:	74 2d                	je     801a87 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a62:	48 85 c0             	test   %rax,%rax
+  801a65:	74 56                	je     801abd <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801a67:	4c 89 ea             	mov    %r13,%rdx
+  801a6a:	4c 89 e6             	mov    %r12,%rsi
+  801a6d:	4c 89 f7             	mov    %r14,%rdi
+  801a70:	ff d0                	call   *%rax
+  801a72:	eb 02                	jmp    801a76 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a74:	48 98                	cltq
+}
+  801a76:	48 83 c4 10          	add    $0x10,%rsp
+  801a7a:	5b                   	pop    %rbx
+  801a7b:	41 5c                	pop    %r12
+  801a7d:	41 5d                	pop    %r13
+  801a7f:	41 5e                	pop    %r14
+  801a81:	5d                   	pop    %rbp
+  801a82:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a83:	48 98                	cltq
+  801a85:	eb ef                	jmp    801a76 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a87:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a8e:	00 00 00 
+  801a91:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a97:	89 da                	mov    %ebx,%edx
+  801a99:	48 bf 18 3d 80 00 00 	movabs $0x803d18,%rdi
+  801aa0:	00 00 00 
+  801aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa8:	48 b9 58 02 80 00 00 	movabs $0x800258,%rcx
+  801aaf:	00 00 00 
+  801ab2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ab4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801abb:	eb b9                	jmp    801a76 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801abd:	4c 89 ea             	mov    %r13,%rdx
+  801ac0:	4c 89 e6             	mov    %r12,%rsi
+  801ac3:	89 df                	mov    %ebx,%edi
+  801ac5:	48 b8 4a 19 80 00 00 	movabs $0x80194a,%rax
+  801acc:	00 00 00 
+  801acf:	ff d0                	call   *%rax
+  801ad1:	eb a3                	jmp    801a76 <readmap+0x6e>
+
+0000000000801ad3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ad3:	55                   	push   %rbp
+  801ad4:	48 89 e5             	mov    %rsp,%rbp
+  801ad7:	41 57                	push   %r15
+  801ad9:	41 56                	push   %r14
+  801adb:	41 55                	push   %r13
+  801add:	41 54                	push   %r12
+  801adf:	53                   	push   %rbx
+  801ae0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ae4:	48 85 d2             	test   %rdx,%rdx
+  801ae7:	74 54                	je     801b3d <readn+0x6a>
+  801ae9:	41 89 fd             	mov    %edi,%r13d
+  801aec:	49 89 f6             	mov    %rsi,%r14
+  801aef:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801af2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801af7:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801afc:	49 bf 4a 19 80 00 00 	movabs $0x80194a,%r15
+  801b03:	00 00 00 
+  801b06:	4c 89 e2             	mov    %r12,%rdx
+  801b09:	48 29 f2             	sub    %rsi,%rdx
+  801b0c:	4c 01 f6             	add    %r14,%rsi
+  801b0f:	44 89 ef             	mov    %r13d,%edi
+  801b12:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	78 20                	js     801b39 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b19:	01 c3                	add    %eax,%ebx
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	74 08                	je     801b27 <readn+0x54>
+  801b1f:	48 63 f3             	movslq %ebx,%rsi
+  801b22:	4c 39 e6             	cmp    %r12,%rsi
+  801b25:	72 df                	jb     801b06 <readn+0x33>
+    }
+    return res;
+  801b27:	48 63 c3             	movslq %ebx,%rax
+}
+  801b2a:	48 83 c4 08          	add    $0x8,%rsp
+  801b2e:	5b                   	pop    %rbx
+  801b2f:	41 5c                	pop    %r12
+  801b31:	41 5d                	pop    %r13
+  801b33:	41 5e                	pop    %r14
+  801b35:	41 5f                	pop    %r15
+  801b37:	5d                   	pop    %rbp
+  801b38:	c3                   	ret
+        if (inc < 0) return inc;
+  801b39:	48 98                	cltq
+  801b3b:	eb ed                	jmp    801b2a <readn+0x57>
+    int inc = 1, res = 0;
+  801b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b42:	eb e3                	jmp    801b27 <readn+0x54>
+
+0000000000801b44 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b44:	55                   	push   %rbp
+  801b45:	48 89 e5             	mov    %rsp,%rbp
+  801b48:	41 56                	push   %r14
+  801b4a:	41 55                	push   %r13
+  801b4c:	41 54                	push   %r12
+  801b4e:	53                   	push   %rbx
+  801b4f:	48 83 ec 10          	sub    $0x10,%rsp
+  801b53:	89 fb                	mov    %edi,%ebx
+  801b55:	49 89 f4             	mov    %rsi,%r12
+  801b58:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b5b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b5f:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 47                	js     801bb6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b6f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b73:	41 8b 3e             	mov    (%r14),%edi
+  801b76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7a:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 30                	js     801bba <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b8a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b8f:	74 2d                	je     801bbe <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b95:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b99:	48 85 c0             	test   %rax,%rax
+  801b9c:	74 56                	je     801bf4 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b9e:	4c 89 ea             	mov    %r13,%rdx
+  801ba1:	4c 89 e6             	mov    %r12,%rsi
+  801ba4:	4c 89 f7             	mov    %r14,%rdi
+  801ba7:	ff d0                	call   *%rax
+}
+  801ba9:	48 83 c4 10          	add    $0x10,%rsp
+  801bad:	5b                   	pop    %rbx
+  801bae:	41 5c                	pop    %r12
+  801bb0:	41 5d                	pop    %r13
+  801bb2:	41 5e                	pop    %r14
+  801bb4:	5d                   	pop    %rbp
+  801bb5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb6:	48 98                	cltq
+  801bb8:	eb ef                	jmp    801ba9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bba:	48 98                	cltq
+  801bbc:	eb eb                	jmp    801ba9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bbe:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bc5:	00 00 00 
+  801bc8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bce:	89 da                	mov    %ebx,%edx
+  801bd0:	48 bf 75 3d 80 00 00 	movabs $0x803d75,%rdi
+  801bd7:	00 00 00 
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdf:	48 b9 58 02 80 00 00 	movabs $0x800258,%rcx
+  801be6:	00 00 00 
+  801be9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801beb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bf2:	eb b5                	jmp    801ba9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bf4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bfb:	eb ac                	jmp    801ba9 <write+0x65>
+
+0000000000801bfd <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801bfd:	55                   	push   %rbp
+  801bfe:	48 89 e5             	mov    %rsp,%rbp
+  801c01:	53                   	push   %rbx
+  801c02:	48 83 ec 18          	sub    $0x18,%rsp
+  801c06:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c08:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c0c:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801c13:	00 00 00 
+  801c16:	ff d0                	call   *%rax
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	78 0c                	js     801c28 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c20:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+0000000000801c2e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c2e:	55                   	push   %rbp
+  801c2f:	48 89 e5             	mov    %rsp,%rbp
+  801c32:	41 55                	push   %r13
+  801c34:	41 54                	push   %r12
+  801c36:	53                   	push   %rbx
+  801c37:	48 83 ec 18          	sub    $0x18,%rsp
+  801c3b:	89 fb                	mov    %edi,%ebx
+  801c3d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c40:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c44:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801c4b:	00 00 00 
+  801c4e:	ff d0                	call   *%rax
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	78 38                	js     801c8c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c54:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c58:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c5c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c60:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801c67:	00 00 00 
+  801c6a:	ff d0                	call   *%rax
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 1c                	js     801c8c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c70:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c75:	74 20                	je     801c97 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c7b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c7f:	48 85 c0             	test   %rax,%rax
+  801c82:	74 47                	je     801ccb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c84:	44 89 e6             	mov    %r12d,%esi
+  801c87:	4c 89 ef             	mov    %r13,%rdi
+  801c8a:	ff d0                	call   *%rax
+}
+  801c8c:	48 83 c4 18          	add    $0x18,%rsp
+  801c90:	5b                   	pop    %rbx
+  801c91:	41 5c                	pop    %r12
+  801c93:	41 5d                	pop    %r13
+  801c95:	5d                   	pop    %rbp
+  801c96:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c97:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c9e:	00 00 00 
+  801ca1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ca7:	89 da                	mov    %ebx,%edx
+  801ca9:	48 bf 38 3d 80 00 00 	movabs $0x803d38,%rdi
+  801cb0:	00 00 00 
+  801cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb8:	48 b9 58 02 80 00 00 	movabs $0x800258,%rcx
+  801cbf:	00 00 00 
+  801cc2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cc9:	eb c1                	jmp    801c8c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ccb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cd0:	eb ba                	jmp    801c8c <ftruncate+0x5e>
+
+0000000000801cd2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801cd2:	55                   	push   %rbp
+  801cd3:	48 89 e5             	mov    %rsp,%rbp
+  801cd6:	41 54                	push   %r12
+  801cd8:	53                   	push   %rbx
+  801cd9:	48 83 ec 10          	sub    $0x10,%rsp
+  801cdd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ce4:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 4e                	js     801d42 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cf8:	41 8b 3c 24          	mov    (%r12),%edi
+  801cfc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d00:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 32                	js     801d42 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d14:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d19:	74 30                	je     801d4b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d1b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d1e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d25:	00 00 00 
+    stat->st_isdir = 0;
+  801d28:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d2f:	00 00 00 
+    stat->st_dev = dev;
+  801d32:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d39:	48 89 de             	mov    %rbx,%rsi
+  801d3c:	4c 89 e7             	mov    %r12,%rdi
+  801d3f:	ff 50 30             	call   *0x30(%rax)
+}
+  801d42:	48 83 c4 10          	add    $0x10,%rsp
+  801d46:	5b                   	pop    %rbx
+  801d47:	41 5c                	pop    %r12
+  801d49:	5d                   	pop    %rbp
+  801d4a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d4b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d50:	eb f0                	jmp    801d42 <fstat+0x70>
+
+0000000000801d52 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d52:	55                   	push   %rbp
+  801d53:	48 89 e5             	mov    %rsp,%rbp
+  801d56:	41 54                	push   %r12
+  801d58:	53                   	push   %rbx
+  801d59:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	48 b8 a9 2a 80 00 00 	movabs $0x802aa9,%rax
+  801d68:	00 00 00 
+  801d6b:	ff d0                	call   *%rax
+  801d6d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 25                	js     801d98 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d73:	4c 89 e6             	mov    %r12,%rsi
+  801d76:	89 c7                	mov    %eax,%edi
+  801d78:	48 b8 d2 1c 80 00 00 	movabs $0x801cd2,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+  801d84:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d87:	89 df                	mov    %ebx,%edi
+  801d89:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+
+    return res;
+  801d95:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d98:	89 d8                	mov    %ebx,%eax
+  801d9a:	5b                   	pop    %rbx
+  801d9b:	41 5c                	pop    %r12
+  801d9d:	5d                   	pop    %rbp
+  801d9e:	c3                   	ret
+
+0000000000801d9f <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d9f:	55                   	push   %rbp
+  801da0:	48 89 e5             	mov    %rsp,%rbp
+  801da3:	41 54                	push   %r12
+  801da5:	53                   	push   %rbx
+  801da6:	48 83 ec 10          	sub    $0x10,%rsp
+  801daa:	48 89 fb             	mov    %rdi,%rbx
+  801dad:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801db0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801db4:	bf 66 00 00 00       	mov    $0x66,%edi
+  801db9:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801dc0:	00 00 00 
+  801dc3:	ff d0                	call   *%rax
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 1f                	js     801de8 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801dc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dcd:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801dd1:	48 85 c0             	test   %rax,%rax
+  801dd4:	74 1b                	je     801df1 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801dd6:	4c 89 e6             	mov    %r12,%rsi
+  801dd9:	48 89 df             	mov    %rbx,%rdi
+  801ddc:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de5:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801de8:	48 83 c4 10          	add    $0x10,%rsp
+  801dec:	5b                   	pop    %rbx
+  801ded:	41 5c                	pop    %r12
+  801def:	5d                   	pop    %rbp
+  801df0:	c3                   	ret
+        return -E_NOT_SUPP;
+  801df1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801df6:	eb f0                	jmp    801de8 <create_snapshot+0x49>
+
+0000000000801df8 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801df8:	55                   	push   %rbp
+  801df9:	48 89 e5             	mov    %rsp,%rbp
+  801dfc:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e00:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e04:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e09:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	78 1e                	js     801e37 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1d:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e21:	48 85 d2             	test   %rdx,%rdx
+  801e24:	74 13                	je     801e39 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2b:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e34:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e39:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e3e:	eb f7                	jmp    801e37 <print_snapshot_list+0x3f>
+
+0000000000801e40 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801e40:	55                   	push   %rbp
+  801e41:	48 89 e5             	mov    %rsp,%rbp
+  801e44:	53                   	push   %rbx
+  801e45:	48 83 ec 18          	sub    $0x18,%rsp
+  801e49:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e4c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e50:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e55:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+  801e61:	85 c0                	test   %eax,%eax
+  801e63:	78 1c                	js     801e81 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801e65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e69:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801e6d:	48 85 c0             	test   %rax,%rax
+  801e70:	74 15                	je     801e87 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801e72:	48 89 df             	mov    %rbx,%rdi
+  801e75:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e85:	c9                   	leave
+  801e86:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e87:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e8c:	eb f3                	jmp    801e81 <accept_snapshot+0x41>
+
+0000000000801e8e <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e8e:	55                   	push   %rbp
+  801e8f:	48 89 e5             	mov    %rsp,%rbp
+  801e92:	53                   	push   %rbx
+  801e93:	48 83 ec 18          	sub    $0x18,%rsp
+  801e97:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e9e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ea3:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 1c                	js     801ecf <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801eb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb7:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801ebb:	48 85 c0             	test   %rax,%rax
+  801ebe:	74 15                	je     801ed5 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801ec0:	48 89 df             	mov    %rbx,%rdi
+  801ec3:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecc:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ecf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ed5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eda:	eb f3                	jmp    801ecf <delete_snapshot+0x41>
+
+0000000000801edc <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ee4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ee8:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eed:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 14                	js     801f11 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801efd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f01:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f05:	48 85 d2             	test   %rdx,%rdx
+  801f08:	74 09                	je     801f13 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0f:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f11:	c9                   	leave
+  801f12:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f13:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f18:	eb f7                	jmp    801f11 <gc_snapshots+0x35>
+
+0000000000801f1a <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f1a:	55                   	push   %rbp
+  801f1b:	48 89 e5             	mov    %rsp,%rbp
+  801f1e:	41 56                	push   %r14
+  801f20:	41 55                	push   %r13
+  801f22:	41 54                	push   %r12
+  801f24:	53                   	push   %rbx
+  801f25:	48 83 ec 10          	sub    $0x10,%rsp
+  801f29:	48 89 fb             	mov    %rdi,%rbx
+  801f2c:	49 89 f4             	mov    %rsi,%r12
+  801f2f:	49 89 d5             	mov    %rdx,%r13
+  801f32:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f35:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f39:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f3e:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 1b                	js     801f69 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801f4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f52:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801f56:	48 85 c0             	test   %rax,%rax
+  801f59:	74 1b                	je     801f76 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801f5b:	4c 89 f1             	mov    %r14,%rcx
+  801f5e:	4c 89 ea             	mov    %r13,%rdx
+  801f61:	4c 89 e6             	mov    %r12,%rsi
+  801f64:	48 89 df             	mov    %rbx,%rdi
+  801f67:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f69:	48 83 c4 10          	add    $0x10,%rsp
+  801f6d:	5b                   	pop    %rbx
+  801f6e:	41 5c                	pop    %r12
+  801f70:	41 5d                	pop    %r13
+  801f72:	41 5e                	pop    %r14
+  801f74:	5d                   	pop    %rbp
+  801f75:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f76:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f7b:	eb ec                	jmp    801f69 <diff_snapshots+0x4f>
+
+0000000000801f7d <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	41 55                	push   %r13
+  801f83:	41 54                	push   %r12
+  801f85:	53                   	push   %rbx
+  801f86:	48 83 ec 18          	sub    $0x18,%rsp
+  801f8a:	48 89 fb             	mov    %rdi,%rbx
+  801f8d:	49 89 f4             	mov    %rsi,%r12
+  801f90:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f93:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f97:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f9c:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801fa3:	00 00 00 
+  801fa6:	ff d0                	call   *%rax
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 18                	js     801fc4 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801fac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb0:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801fb4:	48 85 c0             	test   %rax,%rax
+  801fb7:	74 16                	je     801fcf <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801fb9:	4c 89 ea             	mov    %r13,%rdx
+  801fbc:	4c 89 e6             	mov    %r12,%rsi
+  801fbf:	48 89 df             	mov    %rbx,%rdi
+  801fc2:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fc4:	48 83 c4 18          	add    $0x18,%rsp
+  801fc8:	5b                   	pop    %rbx
+  801fc9:	41 5c                	pop    %r12
+  801fcb:	41 5d                	pop    %r13
+  801fcd:	5d                   	pop    %rbp
+  801fce:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fcf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd4:	eb ee                	jmp    801fc4 <send_snapshot+0x47>
+
+0000000000801fd6 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801fd6:	55                   	push   %rbp
+  801fd7:	48 89 e5             	mov    %rsp,%rbp
+  801fda:	53                   	push   %rbx
+  801fdb:	48 83 ec 18          	sub    $0x18,%rsp
+  801fdf:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fe2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe6:	bf 66 00 00 00       	mov    $0x66,%edi
+  801feb:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 12                	js     80200d <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801ffb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fff:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802003:	48 85 c0             	test   %rax,%rax
+  802006:	74 0b                	je     802013 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802008:	48 89 df             	mov    %rbx,%rdi
+  80200b:	ff d0                	call   *%rax
+
+    return res;
+}
+  80200d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+        return -E_NOT_SUPP;
+  802013:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802018:	eb f3                	jmp    80200d <receive_snapshot+0x37>
+
+000000000080201a <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80201a:	55                   	push   %rbp
+  80201b:	48 89 e5             	mov    %rsp,%rbp
+  80201e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802022:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802026:	bf 66 00 00 00       	mov    $0x66,%edi
+  80202b:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+  802037:	85 c0                	test   %eax,%eax
+  802039:	78 17                	js     802052 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80203b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80203f:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802046:	48 85 d2             	test   %rdx,%rdx
+  802049:	74 09                	je     802054 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802050:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+        return -E_NOT_SUPP;
+  802054:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802059:	eb f7                	jmp    802052 <free_space_bytes+0x38>
+
+000000000080205b <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+  80205f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802063:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802067:	bf 66 00 00 00       	mov    $0x66,%edi
+  80206c:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  802073:	00 00 00 
+  802076:	ff d0                	call   *%rax
+  802078:	85 c0                	test   %eax,%eax
+  80207a:	78 17                	js     802093 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80207c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802080:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802087:	48 85 d2             	test   %rdx,%rdx
+  80208a:	74 09                	je     802095 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802091:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802093:	c9                   	leave
+  802094:	c3                   	ret
+        return -E_NOT_SUPP;
+  802095:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209a:	eb f7                	jmp    802093 <busy_space_bytes+0x38>
+
+000000000080209c <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80209c:	55                   	push   %rbp
+  80209d:	48 89 e5             	mov    %rsp,%rbp
+  8020a0:	41 54                	push   %r12
+  8020a2:	53                   	push   %rbx
+  8020a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a7:	89 fb                	mov    %edi,%ebx
+  8020a9:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ac:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020b0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020b5:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  8020bc:	00 00 00 
+  8020bf:	ff d0                	call   *%rax
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 17                	js     8020dc <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8020c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020c9:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8020d0:	48 85 c0             	test   %rax,%rax
+  8020d3:	74 10                	je     8020e5 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8020d5:	4c 89 e6             	mov    %r12,%rsi
+  8020d8:	89 df                	mov    %ebx,%edi
+  8020da:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8020dc:	48 83 c4 10          	add    $0x10,%rsp
+  8020e0:	5b                   	pop    %rbx
+  8020e1:	41 5c                	pop    %r12
+  8020e3:	5d                   	pop    %rbp
+  8020e4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ea:	eb f0                	jmp    8020dc <snapshots_space+0x40>
+
+00000000008020ec <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8020ec:	55                   	push   %rbp
+  8020ed:	48 89 e5             	mov    %rsp,%rbp
+  8020f0:	41 55                	push   %r13
+  8020f2:	41 54                	push   %r12
+  8020f4:	53                   	push   %rbx
+  8020f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f9:	41 89 fd             	mov    %edi,%r13d
+  8020fc:	48 89 f3             	mov    %rsi,%rbx
+  8020ff:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802102:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802109:	00 00 00 
+  80210c:	83 38 00             	cmpl   $0x0,(%rax)
+  80210f:	74 57                	je     802168 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802111:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802117:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80211c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802123:	00 00 00 
+  802126:	44 89 ee             	mov    %r13d,%esi
+  802129:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802130:	00 00 00 
+  802133:	8b 38                	mov    (%rax),%edi
+  802135:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802141:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802146:	4c 89 e2             	mov    %r12,%rdx
+  802149:	48 89 de             	mov    %rbx,%rsi
+  80214c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802151:	48 b8 f4 35 80 00 00 	movabs $0x8035f4,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+}
+  80215d:	48 83 c4 08          	add    $0x8,%rsp
+  802161:	5b                   	pop    %rbx
+  802162:	41 5c                	pop    %r12
+  802164:	41 5d                	pop    %r13
+  802166:	5d                   	pop    %rbp
+  802167:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802168:	bf 03 00 00 00       	mov    $0x3,%edi
+  80216d:	48 b8 ca 36 80 00 00 	movabs $0x8036ca,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+  802179:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802180:	00 00 
+  802182:	eb 8d                	jmp    802111 <fsipc_region+0x25>
+
+0000000000802184 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80218c:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802193:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802194:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802198:	48 b8 ec 20 80 00 00 	movabs $0x8020ec,%rax
+  80219f:	00 00 00 
+  8021a2:	ff d0                	call   *%rax
+}
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+00000000008021a6 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8021a6:	85 ff                	test   %edi,%edi
+  8021a8:	78 6d                	js     802217 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8021aa:	55                   	push   %rbp
+  8021ab:	48 89 e5             	mov    %rsp,%rbp
+  8021ae:	41 54                	push   %r12
+  8021b0:	53                   	push   %rbx
+  8021b1:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8021b4:	48 85 f6             	test   %rsi,%rsi
+  8021b7:	74 57                	je     802210 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8021b9:	89 f8                	mov    %edi,%eax
+  8021bb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021c2:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8021c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c9:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021ce:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021da:	85 c0                	test   %eax,%eax
+  8021dc:	78 2d                	js     80220b <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8021de:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021e5:	00 00 00 
+  8021e8:	49 63 14 24          	movslq (%r12),%rdx
+  8021ec:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8021f3:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8021f8:	48 89 df             	mov    %rbx,%rdi
+  8021fb:	48 b8 77 0d 80 00 00 	movabs $0x800d77,%rax
+  802202:	00 00 00 
+  802205:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802207:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80220b:	5b                   	pop    %rbx
+  80220c:	41 5c                	pop    %r12
+  80220e:	5d                   	pop    %rbp
+  80220f:	c3                   	ret
+        return -E_INVAL;
+  802210:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802215:	eb f4                	jmp    80220b <devfile_df_snapshots+0x65>
+  802217:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80221c:	c3                   	ret
+
+000000000080221d <devfile_df_busy>:
+devfile_df_busy() {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802221:	be 00 00 00 00       	mov    $0x0,%esi
+  802226:	bf 11 00 00 00       	mov    $0x11,%edi
+  80222b:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+}
+  802237:	5d                   	pop    %rbp
+  802238:	c3                   	ret
+
+0000000000802239 <devfile_df_free>:
+devfile_df_free() {
+  802239:	55                   	push   %rbp
+  80223a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80223d:	be 00 00 00 00       	mov    $0x0,%esi
+  802242:	bf 10 00 00 00       	mov    $0x10,%edi
+  802247:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80224e:	00 00 00 
+  802251:	ff d0                	call   *%rax
+}
+  802253:	5d                   	pop    %rbp
+  802254:	c3                   	ret
+
+0000000000802255 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802259:	be 00 00 00 00       	mov    $0x0,%esi
+  80225e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802263:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80226a:	00 00 00 
+  80226d:	ff d0                	call   *%rax
+}
+  80226f:	5d                   	pop    %rbp
+  802270:	c3                   	ret
+
+0000000000802271 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802271:	55                   	push   %rbp
+  802272:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802275:	be 00 00 00 00       	mov    $0x0,%esi
+  80227a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80227f:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802292:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802295:	5d                   	pop    %rbp
+  802296:	c3                   	ret
+
+0000000000802297 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802297:	55                   	push   %rbp
+  802298:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80229b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022a2:	00 00 00 
+  8022a5:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022a8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022aa:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022b7:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8022be:	00 00 00 
+  8022c1:	ff d0                	call   *%rax
+}
+  8022c3:	5d                   	pop    %rbp
+  8022c4:	c3                   	ret
+
+00000000008022c5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022c9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022cc:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022d3:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8022da:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022df:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+}
+  8022eb:	5d                   	pop    %rbp
+  8022ec:	c3                   	ret
+
+00000000008022ed <devfile_write>:
+    if (!fd || !buf) {
+  8022ed:	48 85 ff             	test   %rdi,%rdi
+  8022f0:	0f 84 c1 00 00 00    	je     8023b7 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	41 57                	push   %r15
+  8022fc:	41 56                	push   %r14
+  8022fe:	41 55                	push   %r13
+  802300:	41 54                	push   %r12
+  802302:	53                   	push   %rbx
+  802303:	48 83 ec 18          	sub    $0x18,%rsp
+  802307:	49 89 ff             	mov    %rdi,%r15
+  80230a:	49 89 f5             	mov    %rsi,%r13
+  80230d:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802310:	48 85 f6             	test   %rsi,%rsi
+  802313:	0f 84 95 00 00 00    	je     8023ae <devfile_write+0xc1>
+    while (n) {
+  802319:	48 85 d2             	test   %rdx,%rdx
+  80231c:	0f 84 83 00 00 00    	je     8023a5 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802322:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802329:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802330:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802333:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802338:	49 39 dc             	cmp    %rbx,%r12
+  80233b:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80233f:	48 89 da             	mov    %rbx,%rdx
+  802342:	4c 89 ee             	mov    %r13,%rsi
+  802345:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80234c:	00 00 00 
+  80234f:	48 b8 77 0d 80 00 00 	movabs $0x800d77,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80235b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80235f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802362:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802366:	be 00 00 00 00       	mov    $0x0,%esi
+  80236b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802370:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+        if (write < 0) {
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 21                	js     8023a1 <devfile_write+0xb4>
+        buf += write;
+  802380:	48 63 d0             	movslq %eax,%rdx
+  802383:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802386:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802389:	49 29 d4             	sub    %rdx,%r12
+  80238c:	75 a5                	jne    802333 <devfile_write+0x46>
+    return totalWrite;
+  80238e:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802392:	48 83 c4 18          	add    $0x18,%rsp
+  802396:	5b                   	pop    %rbx
+  802397:	41 5c                	pop    %r12
+  802399:	41 5d                	pop    %r13
+  80239b:	41 5e                	pop    %r14
+  80239d:	41 5f                	pop    %r15
+  80239f:	5d                   	pop    %rbp
+  8023a0:	c3                   	ret
+            return write;
+  8023a1:	48 98                	cltq
+  8023a3:	eb ed                	jmp    802392 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8023a5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8023ac:	eb e0                	jmp    80238e <devfile_write+0xa1>
+        return -E_INVAL;
+  8023ae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b5:	eb db                	jmp    802392 <devfile_write+0xa5>
+  8023b7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023be:	c3                   	ret
+
+00000000008023bf <devfile_read>:
+    if (!fd || !buf) {
+  8023bf:	48 85 ff             	test   %rdi,%rdi
+  8023c2:	0f 84 c0 00 00 00    	je     802488 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023c8:	55                   	push   %rbp
+  8023c9:	48 89 e5             	mov    %rsp,%rbp
+  8023cc:	41 57                	push   %r15
+  8023ce:	41 56                	push   %r14
+  8023d0:	41 55                	push   %r13
+  8023d2:	41 54                	push   %r12
+  8023d4:	53                   	push   %rbx
+  8023d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d9:	49 89 ff             	mov    %rdi,%r15
+  8023dc:	49 89 f5             	mov    %rsi,%r13
+  8023df:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023e2:	48 85 f6             	test   %rsi,%rsi
+  8023e5:	0f 84 96 00 00 00    	je     802481 <devfile_read+0xc2>
+    while (n) {
+  8023eb:	48 85 d2             	test   %rdx,%rdx
+  8023ee:	0f 84 87 00 00 00    	je     80247b <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8023f4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8023fb:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023fc:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802403:	00 00 00 
+  802406:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80240a:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80240d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802412:	49 39 c4             	cmp    %rax,%r12
+  802415:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802419:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80241d:	be 00 00 00 00       	mov    $0x0,%esi
+  802422:	bf 03 00 00 00       	mov    $0x3,%edi
+  802427:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802433:	85 c0                	test   %eax,%eax
+  802435:	7e 37                	jle    80246e <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802437:	48 63 d8             	movslq %eax,%rbx
+  80243a:	48 89 da             	mov    %rbx,%rdx
+  80243d:	4c 89 f6             	mov    %r14,%rsi
+  802440:	4c 89 ef             	mov    %r13,%rdi
+  802443:	48 b8 77 0d 80 00 00 	movabs $0x800d77,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+        buf += read;
+  80244f:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802452:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802456:	49 29 dc             	sub    %rbx,%r12
+  802459:	75 ab                	jne    802406 <devfile_read+0x47>
+  return totalRead;
+  80245b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80245f:	48 83 c4 18          	add    $0x18,%rsp
+  802463:	5b                   	pop    %rbx
+  802464:	41 5c                	pop    %r12
+  802466:	41 5d                	pop    %r13
+  802468:	41 5e                	pop    %r14
+  80246a:	41 5f                	pop    %r15
+  80246c:	5d                   	pop    %rbp
+  80246d:	c3                   	ret
+            return read ? read : totalRead;
+  80246e:	48 63 d0             	movslq %eax,%rdx
+  802471:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802475:	48 0f 45 c2          	cmovne %rdx,%rax
+  802479:	eb e4                	jmp    80245f <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80247b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80247f:	eb da                	jmp    80245b <devfile_read+0x9c>
+        return E_INVAL;
+  802481:	b8 03 00 00 00       	mov    $0x3,%eax
+  802486:	eb d7                	jmp    80245f <devfile_read+0xa0>
+  802488:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80248d:	c3                   	ret
+
+000000000080248e <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80248e:	48 85 ff             	test   %rdi,%rdi
+  802491:	74 5f                	je     8024f2 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802493:	55                   	push   %rbp
+  802494:	48 89 e5             	mov    %rsp,%rbp
+  802497:	53                   	push   %rbx
+  802498:	48 83 ec 08          	sub    $0x8,%rsp
+  80249c:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80249f:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024b1:	77 45                	ja     8024f8 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8024b3:	48 89 de             	mov    %rbx,%rsi
+  8024b6:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024bd:	00 00 00 
+  8024c0:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8024cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d1:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024d6:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8024ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+        return -E_INVAL;
+  8024f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024f7:	c3                   	ret
+        return -E_INVAL;
+  8024f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024fd:	eb ed                	jmp    8024ec <devfile_receive_snapshot+0x5e>
+
+00000000008024ff <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8024ff:	55                   	push   %rbp
+  802500:	48 89 e5             	mov    %rsp,%rbp
+  802503:	41 55                	push   %r13
+  802505:	41 54                	push   %r12
+  802507:	53                   	push   %rbx
+  802508:	48 83 ec 08          	sub    $0x8,%rsp
+  80250c:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80250f:	48 85 f6             	test   %rsi,%rsi
+  802512:	0f 94 c0             	sete   %al
+  802515:	48 85 d2             	test   %rdx,%rdx
+  802518:	0f 94 c2             	sete   %dl
+  80251b:	08 d0                	or     %dl,%al
+  80251d:	0f 85 ad 00 00 00    	jne    8025d0 <devfile_send_snapshot+0xd1>
+  802523:	48 89 fb             	mov    %rdi,%rbx
+  802526:	49 89 f4             	mov    %rsi,%r12
+  802529:	48 85 ff             	test   %rdi,%rdi
+  80252c:	0f 84 9e 00 00 00    	je     8025d0 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802532:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802539:	00 00 00 
+  80253c:	ff d0                	call   *%rax
+  80253e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802544:	0f 87 8d 00 00 00    	ja     8025d7 <devfile_send_snapshot+0xd8>
+  80254a:	4c 89 e7             	mov    %r12,%rdi
+  80254d:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80255f:	77 7d                	ja     8025de <devfile_send_snapshot+0xdf>
+  802561:	4c 89 ef             	mov    %r13,%rdi
+  802564:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  80256b:	00 00 00 
+  80256e:	ff d0                	call   *%rax
+  802570:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802576:	77 6d                	ja     8025e5 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802578:	48 89 de             	mov    %rbx,%rsi
+  80257b:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802582:	00 00 00 
+  802585:	48 bb 7d 0b 80 00 00 	movabs $0x800b7d,%rbx
+  80258c:	00 00 00 
+  80258f:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802591:	4c 89 e6             	mov    %r12,%rsi
+  802594:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80259b:	00 00 00 
+  80259e:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8025a0:	4c 89 ee             	mov    %r13,%rsi
+  8025a3:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8025aa:	00 00 00 
+  8025ad:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8025af:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025b9:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+}
+  8025c5:	48 83 c4 08          	add    $0x8,%rsp
+  8025c9:	5b                   	pop    %rbx
+  8025ca:	41 5c                	pop    %r12
+  8025cc:	41 5d                	pop    %r13
+  8025ce:	5d                   	pop    %rbp
+  8025cf:	c3                   	ret
+        return -E_INVAL;
+  8025d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025d5:	eb ee                	jmp    8025c5 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8025d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025dc:	eb e7                	jmp    8025c5 <devfile_send_snapshot+0xc6>
+  8025de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e3:	eb e0                	jmp    8025c5 <devfile_send_snapshot+0xc6>
+  8025e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025ea:	eb d9                	jmp    8025c5 <devfile_send_snapshot+0xc6>
+
+00000000008025ec <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8025ec:	48 85 ff             	test   %rdi,%rdi
+  8025ef:	0f 84 41 01 00 00    	je     802736 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8025f5:	55                   	push   %rbp
+  8025f6:	48 89 e5             	mov    %rsp,%rbp
+  8025f9:	41 57                	push   %r15
+  8025fb:	41 56                	push   %r14
+  8025fd:	41 55                	push   %r13
+  8025ff:	41 54                	push   %r12
+  802601:	53                   	push   %rbx
+  802602:	48 83 ec 08          	sub    $0x8,%rsp
+  802606:	49 89 fc             	mov    %rdi,%r12
+  802609:	49 89 f5             	mov    %rsi,%r13
+  80260c:	48 89 d3             	mov    %rdx,%rbx
+  80260f:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802612:	48 85 f6             	test   %rsi,%rsi
+  802615:	0f 84 ff 00 00 00    	je     80271a <devfile_diff_snapshots+0x12e>
+  80261b:	48 85 d2             	test   %rdx,%rdx
+  80261e:	0f 84 fd 00 00 00    	je     802721 <devfile_diff_snapshots+0x135>
+  802624:	48 85 c9             	test   %rcx,%rcx
+  802627:	0f 84 f4 00 00 00    	je     802721 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80262d:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+  802639:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80263f:	0f 87 e3 00 00 00    	ja     802728 <devfile_diff_snapshots+0x13c>
+  802645:	4c 89 ef             	mov    %r13,%rdi
+  802648:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80265a:	0f 87 cf 00 00 00    	ja     80272f <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802660:	4c 89 e6             	mov    %r12,%rsi
+  802663:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80266a:	00 00 00 
+  80266d:	4c 89 e7             	mov    %r12,%rdi
+  802670:	49 bf 7d 0b 80 00 00 	movabs $0x800b7d,%r15
+  802677:	00 00 00 
+  80267a:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80267d:	4c 89 ee             	mov    %r13,%rsi
+  802680:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802687:	00 
+  802688:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80268b:	48 8b 03             	mov    (%rbx),%rax
+  80268e:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802695:	00 
+  802696:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80269a:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8026a1:	00 
+  8026a2:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8026a6:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8026ad:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8026ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b3:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026b8:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8026bf:	00 00 00 
+  8026c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	78 43                	js     80270b <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8026c8:	49 8b 04 24          	mov    (%r12),%rax
+  8026cc:	48 89 03             	mov    %rax,(%rbx)
+  8026cf:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8026d4:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8026d8:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8026dd:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8026e1:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8026e6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8026ea:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8026ee:	48 c1 e2 03          	shl    $0x3,%rdx
+  8026f2:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  8026f7:	4c 89 f7             	mov    %r14,%rdi
+  8026fa:	48 b8 77 0d 80 00 00 	movabs $0x800d77,%rax
+  802701:	00 00 00 
+  802704:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802706:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80270b:	48 83 c4 08          	add    $0x8,%rsp
+  80270f:	5b                   	pop    %rbx
+  802710:	41 5c                	pop    %r12
+  802712:	41 5d                	pop    %r13
+  802714:	41 5e                	pop    %r14
+  802716:	41 5f                	pop    %r15
+  802718:	5d                   	pop    %rbp
+  802719:	c3                   	ret
+        return -E_INVAL;
+  80271a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80271f:	eb ea                	jmp    80270b <devfile_diff_snapshots+0x11f>
+  802721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802726:	eb e3                	jmp    80270b <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272d:	eb dc                	jmp    80270b <devfile_diff_snapshots+0x11f>
+  80272f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802734:	eb d5                	jmp    80270b <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80273b:	c3                   	ret
+
+000000000080273c <devfile_delete_snapshot>:
+    if (!name) {
+  80273c:	48 85 ff             	test   %rdi,%rdi
+  80273f:	74 5f                	je     8027a0 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	53                   	push   %rbx
+  802746:	48 83 ec 08          	sub    $0x8,%rsp
+  80274a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80274d:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802754:	00 00 00 
+  802757:	ff d0                	call   *%rax
+  802759:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80275f:	77 45                	ja     8027a6 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802761:	48 89 de             	mov    %rbx,%rsi
+  802764:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80276b:	00 00 00 
+  80276e:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80277a:	be 00 00 00 00       	mov    $0x0,%esi
+  80277f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802784:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802790:	85 c0                	test   %eax,%eax
+  802792:	ba 00 00 00 00       	mov    $0x0,%edx
+  802797:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80279a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+        return -E_INVAL;
+  8027a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027a5:	c3                   	ret
+        return -E_INVAL;
+  8027a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ab:	eb ed                	jmp    80279a <devfile_delete_snapshot+0x5e>
+
+00000000008027ad <devfile_accept_snapshot>:
+    if (!name) {
+  8027ad:	48 85 ff             	test   %rdi,%rdi
+  8027b0:	74 5f                	je     802811 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8027b2:	55                   	push   %rbp
+  8027b3:	48 89 e5             	mov    %rsp,%rbp
+  8027b6:	53                   	push   %rbx
+  8027b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8027be:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  8027c5:	00 00 00 
+  8027c8:	ff d0                	call   *%rax
+  8027ca:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027d0:	77 45                	ja     802817 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8027d2:	48 89 de             	mov    %rbx,%rsi
+  8027d5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027dc:	00 00 00 
+  8027df:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8027eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8027f5:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802801:	85 c0                	test   %eax,%eax
+  802803:	ba 00 00 00 00       	mov    $0x0,%edx
+  802808:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80280b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80280f:	c9                   	leave
+  802810:	c3                   	ret
+        return -E_INVAL;
+  802811:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802816:	c3                   	ret
+        return -E_INVAL;
+  802817:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80281c:	eb ed                	jmp    80280b <devfile_accept_snapshot+0x5e>
+
+000000000080281e <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80281e:	48 85 ff             	test   %rdi,%rdi
+  802821:	0f 84 9f 00 00 00    	je     8028c6 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	41 54                	push   %r12
+  80282d:	53                   	push   %rbx
+  80282e:	48 89 fb             	mov    %rdi,%rbx
+  802831:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802834:	48 85 f6             	test   %rsi,%rsi
+  802837:	74 78                	je     8028b1 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802839:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80284b:	77 6b                	ja     8028b8 <devfile_create_snapshot+0x9a>
+  80284d:	4c 89 e7             	mov    %r12,%rdi
+  802850:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802862:	77 5b                	ja     8028bf <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802864:	48 89 de             	mov    %rbx,%rsi
+  802867:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80286e:	00 00 00 
+  802871:	48 bb 7d 0b 80 00 00 	movabs $0x800b7d,%rbx
+  802878:	00 00 00 
+  80287b:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80287d:	4c 89 e6             	mov    %r12,%rsi
+  802880:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802887:	00 00 00 
+  80288a:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80288c:	be 00 00 00 00       	mov    $0x0,%esi
+  802891:	bf 08 00 00 00       	mov    $0x8,%edi
+  802896:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028ac:	5b                   	pop    %rbx
+  8028ad:	41 5c                	pop    %r12
+  8028af:	5d                   	pop    %rbp
+  8028b0:	c3                   	ret
+        return -E_INVAL;
+  8028b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b6:	eb f4                	jmp    8028ac <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028bd:	eb ed                	jmp    8028ac <devfile_create_snapshot+0x8e>
+  8028bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c4:	eb e6                	jmp    8028ac <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028cb:	c3                   	ret
+
+00000000008028cc <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028cc:	55                   	push   %rbp
+  8028cd:	48 89 e5             	mov    %rsp,%rbp
+  8028d0:	41 54                	push   %r12
+  8028d2:	53                   	push   %rbx
+  8028d3:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8028d6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8028d9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8028e0:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8028e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8028ec:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 3d                	js     802939 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028fc:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802903:	00 00 00 
+  802906:	4c 89 e6             	mov    %r12,%rsi
+  802909:	48 89 df             	mov    %rbx,%rdi
+  80290c:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802918:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80291f:	00 
+  802920:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802926:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80292d:	00 
+  80292e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802939:	5b                   	pop    %rbx
+  80293a:	41 5c                	pop    %r12
+  80293c:	5d                   	pop    %rbp
+  80293d:	c3                   	ret
+
+000000000080293e <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  80293e:	55                   	push   %rbp
+  80293f:	48 89 e5             	mov    %rsp,%rbp
+  802942:	41 57                	push   %r15
+  802944:	41 56                	push   %r14
+  802946:	41 55                	push   %r13
+  802948:	41 54                	push   %r12
+  80294a:	53                   	push   %rbx
+  80294b:	48 83 ec 38          	sub    $0x38,%rsp
+  80294f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802953:	49 89 f5             	mov    %rsi,%r13
+  802956:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802959:	48 89 f0             	mov    %rsi,%rax
+  80295c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802961:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802965:	75 4f                	jne    8029b6 <devfile_readmap+0x78>
+  802967:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80296b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802971:	75 1f                	jne    802992 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802973:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802977:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  80297b:	49 be 26 31 80 00 00 	movabs $0x803126,%r14
+  802982:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802985:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  80298c:	0f 87 9d 00 00 00    	ja     802a2f <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802992:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802996:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80299a:	4d 85 ff             	test   %r15,%r15
+  80299d:	0f 85 cf 00 00 00    	jne    802a72 <devfile_readmap+0x134>
+  8029a3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8029a7:	48 83 c4 38          	add    $0x38,%rsp
+  8029ab:	5b                   	pop    %rbx
+  8029ac:	41 5c                	pop    %r12
+  8029ae:	41 5d                	pop    %r13
+  8029b0:	41 5e                	pop    %r14
+  8029b2:	41 5f                	pop    %r15
+  8029b4:	5d                   	pop    %rbp
+  8029b5:	c3                   	ret
+    size_t totalRead = 0;
+  8029b6:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8029bd:	00 
+  8029be:	eb da                	jmp    80299a <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029c0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029c4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029c7:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8029ce:	00 00 00 
+  8029d1:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  8029d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029d7:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  8029db:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029df:	4c 89 ee             	mov    %r13,%rsi
+  8029e2:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029e7:	48 b8 ec 20 80 00 00 	movabs $0x8020ec,%rax
+  8029ee:	00 00 00 
+  8029f1:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  8029f3:	85 c0                	test   %eax,%eax
+  8029f5:	7e a3                	jle    80299a <devfile_readmap+0x5c>
+  8029f7:	48 98                	cltq
+  8029f9:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8029fd:	72 9b                	jb     80299a <devfile_readmap+0x5c>
+        buf += read;
+  8029ff:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a02:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a05:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a09:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a10:	75 88                	jne    80299a <devfile_readmap+0x5c>
+  802a12:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a16:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a1c:	0f 85 78 ff ff ff    	jne    80299a <devfile_readmap+0x5c>
+  802a22:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a29:	0f 86 6b ff ff ff    	jbe    80299a <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802a2f:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802a35:	4d 39 e7             	cmp    %r12,%r15
+  802a38:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802a3c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802a43:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a47:	0f 84 73 ff ff ff    	je     8029c0 <devfile_readmap+0x82>
+  802a4d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a51:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802a56:	41 ff d6             	call   *%r14
+  802a59:	a8 40                	test   $0x40,%al
+  802a5b:	0f 85 39 ff ff ff    	jne    80299a <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a61:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a68:	4c 39 e3             	cmp    %r12,%rbx
+  802a6b:	72 e4                	jb     802a51 <devfile_readmap+0x113>
+  802a6d:	e9 4e ff ff ff       	jmp    8029c0 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802a72:	4c 89 fa             	mov    %r15,%rdx
+  802a75:	4c 89 ee             	mov    %r13,%rsi
+  802a78:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a7c:	48 b8 bf 23 80 00 00 	movabs $0x8023bf,%rax
+  802a83:	00 00 00 
+  802a86:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a88:	48 85 c0             	test   %rax,%rax
+  802a8b:	78 0c                	js     802a99 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a8d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a91:	48 01 f0             	add    %rsi,%rax
+  802a94:	e9 0e ff ff ff       	jmp    8029a7 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a99:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a9d:	48 85 f6             	test   %rsi,%rsi
+  802aa0:	48 0f 45 c6          	cmovne %rsi,%rax
+  802aa4:	e9 fe fe ff ff       	jmp    8029a7 <devfile_readmap+0x69>
+
+0000000000802aa9 <open>:
+open(const char *path, int mode) {
+  802aa9:	55                   	push   %rbp
+  802aaa:	48 89 e5             	mov    %rsp,%rbp
+  802aad:	41 55                	push   %r13
+  802aaf:	41 54                	push   %r12
+  802ab1:	53                   	push   %rbx
+  802ab2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ab6:	49 89 fc             	mov    %rdi,%r12
+  802ab9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802abc:	48 b8 3f 0b 80 00 00 	movabs $0x800b3f,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+  802ac8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ace:	0f 87 8a 00 00 00    	ja     802b5e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ad4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ad8:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+  802ae4:	89 c3                	mov    %eax,%ebx
+  802ae6:	85 c0                	test   %eax,%eax
+  802ae8:	78 50                	js     802b3a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802aea:	4c 89 e6             	mov    %r12,%rsi
+  802aed:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802af4:	00 00 00 
+  802af7:	48 89 df             	mov    %rbx,%rdi
+  802afa:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b06:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b0d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b11:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b16:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  802b1d:	00 00 00 
+  802b20:	ff d0                	call   *%rax
+  802b22:	89 c3                	mov    %eax,%ebx
+  802b24:	85 c0                	test   %eax,%eax
+  802b26:	78 1f                	js     802b47 <open+0x9e>
+    return fd2num(fd);
+  802b28:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b2c:	48 b8 d9 15 80 00 00 	movabs $0x8015d9,%rax
+  802b33:	00 00 00 
+  802b36:	ff d0                	call   *%rax
+  802b38:	89 c3                	mov    %eax,%ebx
+}
+  802b3a:	89 d8                	mov    %ebx,%eax
+  802b3c:	48 83 c4 18          	add    $0x18,%rsp
+  802b40:	5b                   	pop    %rbx
+  802b41:	41 5c                	pop    %r12
+  802b43:	41 5d                	pop    %r13
+  802b45:	5d                   	pop    %rbp
+  802b46:	c3                   	ret
+        fd_close(fd, 0);
+  802b47:	be 00 00 00 00       	mov    $0x0,%esi
+  802b4c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b50:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+        return res;
+  802b5c:	eb dc                	jmp    802b3a <open+0x91>
+        return -E_BAD_PATH;
+  802b5e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b63:	eb d5                	jmp    802b3a <open+0x91>
+
+0000000000802b65 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802b65:	55                   	push   %rbp
+  802b66:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802b69:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6e:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b73:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  802b7a:	00 00 00 
+  802b7d:	ff d0                	call   *%rax
+}
+  802b7f:	5d                   	pop    %rbp
+  802b80:	c3                   	ret
+
+0000000000802b81 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b81:	55                   	push   %rbp
+  802b82:	48 89 e5             	mov    %rsp,%rbp
+  802b85:	41 54                	push   %r12
+  802b87:	53                   	push   %rbx
+  802b88:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b8b:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+  802b97:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b9a:	48 be c0 3d 80 00 00 	movabs $0x803dc0,%rsi
+  802ba1:	00 00 00 
+  802ba4:	48 89 df             	mov    %rbx,%rdi
+  802ba7:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bb3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802bb8:	41 2b 04 24          	sub    (%r12),%eax
+  802bbc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802bc2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bc9:	00 00 00 
+    stat->st_dev = &devpipe;
+  802bcc:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802bd3:	00 00 00 
+  802bd6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	5b                   	pop    %rbx
+  802be3:	41 5c                	pop    %r12
+  802be5:	5d                   	pop    %rbp
+  802be6:	c3                   	ret
+
+0000000000802be7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802be7:	55                   	push   %rbp
+  802be8:	48 89 e5             	mov    %rsp,%rbp
+  802beb:	41 54                	push   %r12
+  802bed:	53                   	push   %rbx
+  802bee:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802bf1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bf6:	48 89 fe             	mov    %rdi,%rsi
+  802bf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfe:	49 bc d5 12 80 00 00 	movabs $0x8012d5,%r12
+  802c05:	00 00 00 
+  802c08:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c0b:	48 89 df             	mov    %rbx,%rdi
+  802c0e:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802c15:	00 00 00 
+  802c18:	ff d0                	call   *%rax
+  802c1a:	48 89 c6             	mov    %rax,%rsi
+  802c1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c27:	41 ff d4             	call   *%r12
+}
+  802c2a:	5b                   	pop    %rbx
+  802c2b:	41 5c                	pop    %r12
+  802c2d:	5d                   	pop    %rbp
+  802c2e:	c3                   	ret
+
+0000000000802c2f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c2f:	55                   	push   %rbp
+  802c30:	48 89 e5             	mov    %rsp,%rbp
+  802c33:	41 57                	push   %r15
+  802c35:	41 56                	push   %r14
+  802c37:	41 55                	push   %r13
+  802c39:	41 54                	push   %r12
+  802c3b:	53                   	push   %rbx
+  802c3c:	48 83 ec 18          	sub    $0x18,%rsp
+  802c40:	49 89 fc             	mov    %rdi,%r12
+  802c43:	49 89 f5             	mov    %rsi,%r13
+  802c46:	49 89 d7             	mov    %rdx,%r15
+  802c49:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c4d:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c59:	4d 85 ff             	test   %r15,%r15
+  802c5c:	0f 84 af 00 00 00    	je     802d11 <devpipe_write+0xe2>
+  802c62:	48 89 c3             	mov    %rax,%rbx
+  802c65:	4c 89 f8             	mov    %r15,%rax
+  802c68:	4d 89 ef             	mov    %r13,%r15
+  802c6b:	4c 01 e8             	add    %r13,%rax
+  802c6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c72:	49 bd dd 11 80 00 00 	movabs $0x8011dd,%r13
+  802c79:	00 00 00 
+            sys_yield();
+  802c7c:	49 be 7a 11 80 00 00 	movabs $0x80117a,%r14
+  802c83:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c86:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c89:	48 63 ce             	movslq %esi,%rcx
+  802c8c:	48 63 03             	movslq (%rbx),%rax
+  802c8f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c95:	48 39 c1             	cmp    %rax,%rcx
+  802c98:	72 2e                	jb     802cc8 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c9a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c9f:	48 89 da             	mov    %rbx,%rdx
+  802ca2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ca7:	4c 89 e7             	mov    %r12,%rdi
+  802caa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	74 66                	je     802d17 <devpipe_write+0xe8>
+            sys_yield();
+  802cb1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cb4:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cb7:	48 63 ce             	movslq %esi,%rcx
+  802cba:	48 63 03             	movslq (%rbx),%rax
+  802cbd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cc3:	48 39 c1             	cmp    %rax,%rcx
+  802cc6:	73 d2                	jae    802c9a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cc8:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ccc:	48 89 ca             	mov    %rcx,%rdx
+  802ccf:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cd3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802cda:	08 10 20 
+  802cdd:	48 f7 e2             	mul    %rdx
+  802ce0:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ce4:	48 89 d0             	mov    %rdx,%rax
+  802ce7:	48 c1 e0 09          	shl    $0x9,%rax
+  802ceb:	48 29 d0             	sub    %rdx,%rax
+  802cee:	48 c1 e0 03          	shl    $0x3,%rax
+  802cf2:	48 29 c1             	sub    %rax,%rcx
+  802cf5:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802cfa:	83 c6 01             	add    $0x1,%esi
+  802cfd:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d00:	49 83 c7 01          	add    $0x1,%r15
+  802d04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d08:	49 39 c7             	cmp    %rax,%r15
+  802d0b:	0f 85 75 ff ff ff    	jne    802c86 <devpipe_write+0x57>
+    return n;
+  802d11:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d15:	eb 05                	jmp    802d1c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d1c:	48 83 c4 18          	add    $0x18,%rsp
+  802d20:	5b                   	pop    %rbx
+  802d21:	41 5c                	pop    %r12
+  802d23:	41 5d                	pop    %r13
+  802d25:	41 5e                	pop    %r14
+  802d27:	41 5f                	pop    %r15
+  802d29:	5d                   	pop    %rbp
+  802d2a:	c3                   	ret
+
+0000000000802d2b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d2b:	55                   	push   %rbp
+  802d2c:	48 89 e5             	mov    %rsp,%rbp
+  802d2f:	41 57                	push   %r15
+  802d31:	41 56                	push   %r14
+  802d33:	41 55                	push   %r13
+  802d35:	41 54                	push   %r12
+  802d37:	53                   	push   %rbx
+  802d38:	48 83 ec 18          	sub    $0x18,%rsp
+  802d3c:	49 89 fc             	mov    %rdi,%r12
+  802d3f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d43:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d47:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+  802d53:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d56:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d5c:	49 bd dd 11 80 00 00 	movabs $0x8011dd,%r13
+  802d63:	00 00 00 
+            sys_yield();
+  802d66:	49 be 7a 11 80 00 00 	movabs $0x80117a,%r14
+  802d6d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d70:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d75:	74 7d                	je     802df4 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d77:	8b 03                	mov    (%rbx),%eax
+  802d79:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d7c:	75 26                	jne    802da4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d7e:	4d 85 ff             	test   %r15,%r15
+  802d81:	75 77                	jne    802dfa <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d83:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d88:	48 89 da             	mov    %rbx,%rdx
+  802d8b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d90:	4c 89 e7             	mov    %r12,%rdi
+  802d93:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d96:	85 c0                	test   %eax,%eax
+  802d98:	74 72                	je     802e0c <devpipe_read+0xe1>
+            sys_yield();
+  802d9a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d9d:	8b 03                	mov    (%rbx),%eax
+  802d9f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802da2:	74 df                	je     802d83 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802da4:	48 63 c8             	movslq %eax,%rcx
+  802da7:	48 89 ca             	mov    %rcx,%rdx
+  802daa:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dae:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802db5:	08 10 20 
+  802db8:	48 89 d0             	mov    %rdx,%rax
+  802dbb:	48 f7 e6             	mul    %rsi
+  802dbe:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dc2:	48 89 d0             	mov    %rdx,%rax
+  802dc5:	48 c1 e0 09          	shl    $0x9,%rax
+  802dc9:	48 29 d0             	sub    %rdx,%rax
+  802dcc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802dd3:	00 
+  802dd4:	48 89 c8             	mov    %rcx,%rax
+  802dd7:	48 29 d0             	sub    %rdx,%rax
+  802dda:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802ddf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802de3:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802de7:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802dea:	49 83 c7 01          	add    $0x1,%r15
+  802dee:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802df2:	75 83                	jne    802d77 <devpipe_read+0x4c>
+    return n;
+  802df4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df8:	eb 03                	jmp    802dfd <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802dfa:	4c 89 f8             	mov    %r15,%rax
+}
+  802dfd:	48 83 c4 18          	add    $0x18,%rsp
+  802e01:	5b                   	pop    %rbx
+  802e02:	41 5c                	pop    %r12
+  802e04:	41 5d                	pop    %r13
+  802e06:	41 5e                	pop    %r14
+  802e08:	41 5f                	pop    %r15
+  802e0a:	5d                   	pop    %rbp
+  802e0b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e11:	eb ea                	jmp    802dfd <devpipe_read+0xd2>
+
+0000000000802e13 <pipe>:
+pipe(int pfd[2]) {
+  802e13:	55                   	push   %rbp
+  802e14:	48 89 e5             	mov    %rsp,%rbp
+  802e17:	41 55                	push   %r13
+  802e19:	41 54                	push   %r12
+  802e1b:	53                   	push   %rbx
+  802e1c:	48 83 ec 18          	sub    $0x18,%rsp
+  802e20:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e23:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e27:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  802e2e:	00 00 00 
+  802e31:	ff d0                	call   *%rax
+  802e33:	89 c3                	mov    %eax,%ebx
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	0f 88 a0 01 00 00    	js     802fdd <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e3d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e50:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+  802e5c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	0f 88 77 01 00 00    	js     802fdd <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e66:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e6a:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	89 c3                	mov    %eax,%ebx
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	0f 88 43 01 00 00    	js     802fc3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e80:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e8a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e93:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  802e9a:	00 00 00 
+  802e9d:	ff d0                	call   *%rax
+  802e9f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	0f 88 1a 01 00 00    	js     802fc3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802ea9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ead:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+  802eb9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802ebc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ec1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ec6:	48 89 c6             	mov    %rax,%rsi
+  802ec9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ece:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  802ed5:	00 00 00 
+  802ed8:	ff d0                	call   *%rax
+  802eda:	89 c3                	mov    %eax,%ebx
+  802edc:	85 c0                	test   %eax,%eax
+  802ede:	0f 88 c5 00 00 00    	js     802fa9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802ee4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ee8:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  802eef:	00 00 00 
+  802ef2:	ff d0                	call   *%rax
+  802ef4:	48 89 c1             	mov    %rax,%rcx
+  802ef7:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802efd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f08:	4c 89 ee             	mov    %r13,%rsi
+  802f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f10:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	89 c3                	mov    %eax,%ebx
+  802f1e:	85 c0                	test   %eax,%eax
+  802f20:	78 6e                	js     802f90 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f22:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f27:	4c 89 ef             	mov    %r13,%rdi
+  802f2a:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+  802f36:	83 f8 02             	cmp    $0x2,%eax
+  802f39:	0f 85 ab 00 00 00    	jne    802fea <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f3f:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802f46:	00 00 
+  802f48:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f4c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f4e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f52:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f59:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f5d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f63:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f6e:	48 bb d9 15 80 00 00 	movabs $0x8015d9,%rbx
+  802f75:	00 00 00 
+  802f78:	ff d3                	call   *%rbx
+  802f7a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f7e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f82:	ff d3                	call   *%rbx
+  802f84:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f8e:	eb 4d                	jmp    802fdd <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f95:	4c 89 ee             	mov    %r13,%rsi
+  802f98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9d:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802fa9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fae:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb7:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802fc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fc8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd1:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+}
+  802fdd:	89 d8                	mov    %ebx,%eax
+  802fdf:	48 83 c4 18          	add    $0x18,%rsp
+  802fe3:	5b                   	pop    %rbx
+  802fe4:	41 5c                	pop    %r12
+  802fe6:	41 5d                	pop    %r13
+  802fe8:	5d                   	pop    %rbp
+  802fe9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802fea:	48 b9 f0 3d 80 00 00 	movabs $0x803df0,%rcx
+  802ff1:	00 00 00 
+  802ff4:	48 ba c7 3d 80 00 00 	movabs $0x803dc7,%rdx
+  802ffb:	00 00 00 
+  802ffe:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803003:	48 bf dc 3d 80 00 00 	movabs $0x803ddc,%rdi
+  80300a:	00 00 00 
+  80300d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803012:	49 b8 6a 34 80 00 00 	movabs $0x80346a,%r8
+  803019:	00 00 00 
+  80301c:	41 ff d0             	call   *%r8
+
+000000000080301f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80301f:	55                   	push   %rbp
+  803020:	48 89 e5             	mov    %rsp,%rbp
+  803023:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803027:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80302b:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803037:	85 c0                	test   %eax,%eax
+  803039:	78 35                	js     803070 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80303b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80303f:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+  80304b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80304e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803053:	be 00 10 00 00       	mov    $0x1000,%esi
+  803058:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80305c:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+  803068:	85 c0                	test   %eax,%eax
+  80306a:	0f 94 c0             	sete   %al
+  80306d:	0f b6 c0             	movzbl %al,%eax
+}
+  803070:	c9                   	leave
+  803071:	c3                   	ret
+
+0000000000803072 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803072:	48 89 f8             	mov    %rdi,%rax
+  803075:	48 c1 e8 27          	shr    $0x27,%rax
+  803079:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803080:	01 00 00 
+  803083:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803087:	f6 c2 01             	test   $0x1,%dl
+  80308a:	74 6d                	je     8030f9 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80308c:	48 89 f8             	mov    %rdi,%rax
+  80308f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803093:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80309a:	01 00 00 
+  80309d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030a1:	f6 c2 01             	test   $0x1,%dl
+  8030a4:	74 62                	je     803108 <get_uvpt_entry+0x96>
+  8030a6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030ad:	01 00 00 
+  8030b0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030b4:	f6 c2 80             	test   $0x80,%dl
+  8030b7:	75 4f                	jne    803108 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030b9:	48 89 f8             	mov    %rdi,%rax
+  8030bc:	48 c1 e8 15          	shr    $0x15,%rax
+  8030c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030c7:	01 00 00 
+  8030ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030ce:	f6 c2 01             	test   $0x1,%dl
+  8030d1:	74 44                	je     803117 <get_uvpt_entry+0xa5>
+  8030d3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030da:	01 00 00 
+  8030dd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030e1:	f6 c2 80             	test   $0x80,%dl
+  8030e4:	75 31                	jne    803117 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8030e6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8030ea:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030f1:	01 00 00 
+  8030f4:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8030f8:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8030f9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803100:	01 00 00 
+  803103:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803107:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803108:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80310f:	01 00 00 
+  803112:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803116:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803117:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80311e:	01 00 00 
+  803121:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803125:	c3                   	ret
+
+0000000000803126 <get_prot>:
+
+int
+get_prot(void *va) {
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80312a:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  803131:	00 00 00 
+  803134:	ff d0                	call   *%rax
+  803136:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803139:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80313e:	89 c1                	mov    %eax,%ecx
+  803140:	83 c9 04             	or     $0x4,%ecx
+  803143:	f6 c2 01             	test   $0x1,%dl
+  803146:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803149:	89 c1                	mov    %eax,%ecx
+  80314b:	83 c9 02             	or     $0x2,%ecx
+  80314e:	f6 c2 02             	test   $0x2,%dl
+  803151:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803154:	89 c1                	mov    %eax,%ecx
+  803156:	83 c9 01             	or     $0x1,%ecx
+  803159:	48 85 d2             	test   %rdx,%rdx
+  80315c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80315f:	89 c1                	mov    %eax,%ecx
+  803161:	83 c9 40             	or     $0x40,%ecx
+  803164:	f6 c6 04             	test   $0x4,%dh
+  803167:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80316a:	5d                   	pop    %rbp
+  80316b:	c3                   	ret
+
+000000000080316c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80316c:	55                   	push   %rbp
+  80316d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803170:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  803177:	00 00 00 
+  80317a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80317c:	48 c1 e8 06          	shr    $0x6,%rax
+  803180:	83 e0 01             	and    $0x1,%eax
+}
+  803183:	5d                   	pop    %rbp
+  803184:	c3                   	ret
+
+0000000000803185 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803185:	55                   	push   %rbp
+  803186:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803189:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803195:	48 c1 e8 05          	shr    $0x5,%rax
+  803199:	83 e0 01             	and    $0x1,%eax
+}
+  80319c:	5d                   	pop    %rbp
+  80319d:	c3                   	ret
+
+000000000080319e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80319e:	55                   	push   %rbp
+  80319f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8031a2:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  8031a9:	00 00 00 
+  8031ac:	ff d0                	call   *%rax
+  8031ae:	83 e0 01             	and    $0x1,%eax
+}
+  8031b1:	5d                   	pop    %rbp
+  8031b2:	c3                   	ret
+
+00000000008031b3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8031b3:	55                   	push   %rbp
+  8031b4:	48 89 e5             	mov    %rsp,%rbp
+  8031b7:	41 57                	push   %r15
+  8031b9:	41 56                	push   %r14
+  8031bb:	41 55                	push   %r13
+  8031bd:	41 54                	push   %r12
+  8031bf:	53                   	push   %rbx
+  8031c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8031c4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031c8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8031d1:	49 bd 9e 31 80 00 00 	movabs $0x80319e,%r13
+  8031d8:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8031db:	49 bf 26 31 80 00 00 	movabs $0x803126,%r15
+  8031e2:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031e5:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8031ec:	00 00 00 
+  8031ef:	eb 0c                	jmp    8031fd <foreach_shared_region+0x4a>
+  8031f1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8031f8:	4c 39 f3             	cmp    %r14,%rbx
+  8031fb:	74 2e                	je     80322b <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8031fd:	48 89 df             	mov    %rbx,%rdi
+  803200:	41 ff d5             	call   *%r13
+  803203:	84 c0                	test   %al,%al
+  803205:	74 ea                	je     8031f1 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803207:	48 89 df             	mov    %rbx,%rdi
+  80320a:	41 ff d7             	call   *%r15
+  80320d:	a8 40                	test   $0x40,%al
+  80320f:	74 e0                	je     8031f1 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803211:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803218:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80321c:	48 89 df             	mov    %rbx,%rdi
+  80321f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803223:	ff d0                	call   *%rax
+				if (res < 0) {
+  803225:	85 c0                	test   %eax,%eax
+  803227:	79 c8                	jns    8031f1 <foreach_shared_region+0x3e>
+  803229:	eb 05                	jmp    803230 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80322b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803230:	48 83 c4 18          	add    $0x18,%rsp
+  803234:	5b                   	pop    %rbx
+  803235:	41 5c                	pop    %r12
+  803237:	41 5d                	pop    %r13
+  803239:	41 5e                	pop    %r14
+  80323b:	41 5f                	pop    %r15
+  80323d:	5d                   	pop    %rbp
+  80323e:	c3                   	ret
+
+000000000080323f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80323f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803244:	c3                   	ret
+
+0000000000803245 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803245:	55                   	push   %rbp
+  803246:	48 89 e5             	mov    %rsp,%rbp
+  803249:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80324c:	48 be 14 3e 80 00 00 	movabs $0x803e14,%rsi
+  803253:	00 00 00 
+  803256:	48 b8 7d 0b 80 00 00 	movabs $0x800b7d,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+    return 0;
+}
+  803262:	b8 00 00 00 00       	mov    $0x0,%eax
+  803267:	5d                   	pop    %rbp
+  803268:	c3                   	ret
+
+0000000000803269 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	41 57                	push   %r15
+  80326f:	41 56                	push   %r14
+  803271:	41 55                	push   %r13
+  803273:	41 54                	push   %r12
+  803275:	53                   	push   %rbx
+  803276:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80327d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803284:	48 85 d2             	test   %rdx,%rdx
+  803287:	74 7a                	je     803303 <devcons_write+0x9a>
+  803289:	49 89 d6             	mov    %rdx,%r14
+  80328c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803292:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803297:	49 bf 77 0d 80 00 00 	movabs $0x800d77,%r15
+  80329e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032a1:	4c 89 f3             	mov    %r14,%rbx
+  8032a4:	48 29 f3             	sub    %rsi,%rbx
+  8032a7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032ac:	48 39 c3             	cmp    %rax,%rbx
+  8032af:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8032b3:	4c 63 eb             	movslq %ebx,%r13
+  8032b6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8032bd:	48 01 c6             	add    %rax,%rsi
+  8032c0:	4c 89 ea             	mov    %r13,%rdx
+  8032c3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032ca:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8032cd:	4c 89 ee             	mov    %r13,%rsi
+  8032d0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032d7:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8032e3:	41 01 dc             	add    %ebx,%r12d
+  8032e6:	49 63 f4             	movslq %r12d,%rsi
+  8032e9:	4c 39 f6             	cmp    %r14,%rsi
+  8032ec:	72 b3                	jb     8032a1 <devcons_write+0x38>
+    return res;
+  8032ee:	49 63 c4             	movslq %r12d,%rax
+}
+  8032f1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8032f8:	5b                   	pop    %rbx
+  8032f9:	41 5c                	pop    %r12
+  8032fb:	41 5d                	pop    %r13
+  8032fd:	41 5e                	pop    %r14
+  8032ff:	41 5f                	pop    %r15
+  803301:	5d                   	pop    %rbp
+  803302:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803303:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803309:	eb e3                	jmp    8032ee <devcons_write+0x85>
+
+000000000080330b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80330b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80330e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803313:	48 85 c0             	test   %rax,%rax
+  803316:	74 55                	je     80336d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803318:	55                   	push   %rbp
+  803319:	48 89 e5             	mov    %rsp,%rbp
+  80331c:	41 55                	push   %r13
+  80331e:	41 54                	push   %r12
+  803320:	53                   	push   %rbx
+  803321:	48 83 ec 08          	sub    $0x8,%rsp
+  803325:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803328:	48 bb ad 10 80 00 00 	movabs $0x8010ad,%rbx
+  80332f:	00 00 00 
+  803332:	49 bc 7a 11 80 00 00 	movabs $0x80117a,%r12
+  803339:	00 00 00 
+  80333c:	eb 03                	jmp    803341 <devcons_read+0x36>
+  80333e:	41 ff d4             	call   *%r12
+  803341:	ff d3                	call   *%rbx
+  803343:	85 c0                	test   %eax,%eax
+  803345:	74 f7                	je     80333e <devcons_read+0x33>
+    if (c < 0) return c;
+  803347:	48 63 d0             	movslq %eax,%rdx
+  80334a:	78 13                	js     80335f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80334c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803351:	83 f8 04             	cmp    $0x4,%eax
+  803354:	74 09                	je     80335f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803356:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80335a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80335f:	48 89 d0             	mov    %rdx,%rax
+  803362:	48 83 c4 08          	add    $0x8,%rsp
+  803366:	5b                   	pop    %rbx
+  803367:	41 5c                	pop    %r12
+  803369:	41 5d                	pop    %r13
+  80336b:	5d                   	pop    %rbp
+  80336c:	c3                   	ret
+  80336d:	48 89 d0             	mov    %rdx,%rax
+  803370:	c3                   	ret
+
+0000000000803371 <cputchar>:
+cputchar(int ch) {
+  803371:	55                   	push   %rbp
+  803372:	48 89 e5             	mov    %rsp,%rbp
+  803375:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803379:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80337d:	be 01 00 00 00       	mov    $0x1,%esi
+  803382:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803386:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  80338d:	00 00 00 
+  803390:	ff d0                	call   *%rax
+}
+  803392:	c9                   	leave
+  803393:	c3                   	ret
+
+0000000000803394 <getchar>:
+getchar(void) {
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+  803398:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80339c:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033a1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033aa:	48 b8 4a 19 80 00 00 	movabs $0x80194a,%rax
+  8033b1:	00 00 00 
+  8033b4:	ff d0                	call   *%rax
+  8033b6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8033b8:	85 c0                	test   %eax,%eax
+  8033ba:	78 06                	js     8033c2 <getchar+0x2e>
+  8033bc:	74 08                	je     8033c6 <getchar+0x32>
+  8033be:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8033c2:	89 d0                	mov    %edx,%eax
+  8033c4:	c9                   	leave
+  8033c5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8033c6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8033cb:	eb f5                	jmp    8033c2 <getchar+0x2e>
+
+00000000008033cd <iscons>:
+iscons(int fdnum) {
+  8033cd:	55                   	push   %rbp
+  8033ce:	48 89 e5             	mov    %rsp,%rbp
+  8033d1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033d9:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  8033e0:	00 00 00 
+  8033e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	78 18                	js     803401 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8033e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ed:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  8033f4:	00 00 00 
+  8033f7:	8b 00                	mov    (%rax),%eax
+  8033f9:	39 02                	cmp    %eax,(%rdx)
+  8033fb:	0f 94 c0             	sete   %al
+  8033fe:	0f b6 c0             	movzbl %al,%eax
+}
+  803401:	c9                   	leave
+  803402:	c3                   	ret
+
+0000000000803403 <opencons>:
+opencons(void) {
+  803403:	55                   	push   %rbp
+  803404:	48 89 e5             	mov    %rsp,%rbp
+  803407:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80340b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80340f:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  803416:	00 00 00 
+  803419:	ff d0                	call   *%rax
+  80341b:	85 c0                	test   %eax,%eax
+  80341d:	78 49                	js     803468 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80341f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803424:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803429:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80342d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803432:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  803439:	00 00 00 
+  80343c:	ff d0                	call   *%rax
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	78 26                	js     803468 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803442:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803446:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80344d:	00 00 
+  80344f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803451:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803455:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80345c:	48 b8 d9 15 80 00 00 	movabs $0x8015d9,%rax
+  803463:	00 00 00 
+  803466:	ff d0                	call   *%rax
+}
+  803468:	c9                   	leave
+  803469:	c3                   	ret
+
+000000000080346a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80346a:	55                   	push   %rbp
+  80346b:	48 89 e5             	mov    %rsp,%rbp
+  80346e:	41 56                	push   %r14
+  803470:	41 55                	push   %r13
+  803472:	41 54                	push   %r12
+  803474:	53                   	push   %rbx
+  803475:	48 83 ec 50          	sub    $0x50,%rsp
+  803479:	49 89 fc             	mov    %rdi,%r12
+  80347c:	41 89 f5             	mov    %esi,%r13d
+  80347f:	48 89 d3             	mov    %rdx,%rbx
+  803482:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803486:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80348a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80348e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803495:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803499:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80349d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8034a1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034a5:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8034ac:	00 00 00 
+  8034af:	4c 8b 30             	mov    (%rax),%r14
+  8034b2:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  8034b9:	00 00 00 
+  8034bc:	ff d0                	call   *%rax
+  8034be:	89 c6                	mov    %eax,%esi
+  8034c0:	45 89 e8             	mov    %r13d,%r8d
+  8034c3:	4c 89 e1             	mov    %r12,%rcx
+  8034c6:	4c 89 f2             	mov    %r14,%rdx
+  8034c9:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  8034d0:	00 00 00 
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d8:	49 bc 58 02 80 00 00 	movabs $0x800258,%r12
+  8034df:	00 00 00 
+  8034e2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8034e5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8034e9:	48 89 df             	mov    %rbx,%rdi
+  8034ec:	48 b8 f4 01 80 00 00 	movabs $0x8001f4,%rax
+  8034f3:	00 00 00 
+  8034f6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8034f8:	48 bf 43 37 80 00 00 	movabs $0x803743,%rdi
+  8034ff:	00 00 00 
+  803502:	b8 00 00 00 00       	mov    $0x0,%eax
+  803507:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80350a:	cc                   	int3
+  80350b:	eb fd                	jmp    80350a <_panic+0xa0>
+
+000000000080350d <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80350d:	55                   	push   %rbp
+  80350e:	48 89 e5             	mov    %rsp,%rbp
+  803511:	41 55                	push   %r13
+  803513:	41 54                	push   %r12
+  803515:	53                   	push   %rbx
+  803516:	48 83 ec 08          	sub    $0x8,%rsp
+  80351a:	49 89 fc             	mov    %rdi,%r12
+  80351d:	48 89 f7             	mov    %rsi,%rdi
+  803520:	48 89 d3             	mov    %rdx,%rbx
+  803523:	49 89 cd             	mov    %rcx,%r13
+  803526:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803529:	48 85 f6             	test   %rsi,%rsi
+  80352c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803533:	00 00 00 
+  803536:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80353a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80353f:	48 85 db             	test   %rbx,%rbx
+  803542:	74 03                	je     803547 <ipc_recv_timed+0x3a>
+  803544:	48 8b 33             	mov    (%rbx),%rsi
+  803547:	48 b8 a3 14 80 00 00 	movabs $0x8014a3,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+    if (res < 0) {
+  803553:	85 c0                	test   %eax,%eax
+  803555:	78 75                	js     8035cc <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803557:	4d 85 e4             	test   %r12,%r12
+  80355a:	74 14                	je     803570 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80355c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803563:	00 00 00 
+  803566:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80356c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803570:	4d 85 ed             	test   %r13,%r13
+  803573:	74 14                	je     803589 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803575:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80357c:	00 00 00 
+  80357f:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803585:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803589:	48 85 db             	test   %rbx,%rbx
+  80358c:	74 23                	je     8035b1 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80358e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803595:	00 00 00 
+  803598:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80359e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035a3:	85 c9                	test   %ecx,%ecx
+  8035a5:	74 07                	je     8035ae <ipc_recv_timed+0xa1>
+  8035a7:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035ae:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8035b1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035b8:	00 00 00 
+  8035bb:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8035c1:	48 83 c4 08          	add    $0x8,%rsp
+  8035c5:	5b                   	pop    %rbx
+  8035c6:	41 5c                	pop    %r12
+  8035c8:	41 5d                	pop    %r13
+  8035ca:	5d                   	pop    %rbp
+  8035cb:	c3                   	ret
+        if (from_env_store != NULL) {
+  8035cc:	4d 85 e4             	test   %r12,%r12
+  8035cf:	74 08                	je     8035d9 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8035d1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8035d8:	00 
+        if (perm_store != NULL) {
+  8035d9:	4d 85 ed             	test   %r13,%r13
+  8035dc:	74 08                	je     8035e6 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8035de:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8035e5:	00 
+        if (size != NULL) {
+  8035e6:	48 85 db             	test   %rbx,%rbx
+  8035e9:	74 d6                	je     8035c1 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8035eb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8035f2:	eb cd                	jmp    8035c1 <ipc_recv_timed+0xb4>
+
+00000000008035f4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8035f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8035fe:	48 b8 0d 35 80 00 00 	movabs $0x80350d,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+}
+  80360a:	5d                   	pop    %rbp
+  80360b:	c3                   	ret
+
+000000000080360c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80360c:	55                   	push   %rbp
+  80360d:	48 89 e5             	mov    %rsp,%rbp
+  803610:	41 57                	push   %r15
+  803612:	41 56                	push   %r14
+  803614:	41 55                	push   %r13
+  803616:	41 54                	push   %r12
+  803618:	53                   	push   %rbx
+  803619:	48 83 ec 18          	sub    $0x18,%rsp
+  80361d:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803620:	48 89 d3             	mov    %rdx,%rbx
+  803623:	49 89 cc             	mov    %rcx,%r12
+  803626:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803629:	48 85 d2             	test   %rdx,%rdx
+  80362c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803633:	00 00 00 
+  803636:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80363a:	89 f0                	mov    %esi,%eax
+  80363c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803640:	48 89 da             	mov    %rbx,%rdx
+  803643:	48 89 c6             	mov    %rax,%rsi
+  803646:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  80364d:	00 00 00 
+  803650:	ff d0                	call   *%rax
+    while (res < 0) {
+  803652:	85 c0                	test   %eax,%eax
+  803654:	79 65                	jns    8036bb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803656:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803659:	75 33                	jne    80368e <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80365b:	49 bf 7a 11 80 00 00 	movabs $0x80117a,%r15
+  803662:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803665:	49 be 77 14 80 00 00 	movabs $0x801477,%r14
+  80366c:	00 00 00 
+        sys_yield();
+  80366f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803672:	45 89 e8             	mov    %r13d,%r8d
+  803675:	4c 89 e1             	mov    %r12,%rcx
+  803678:	48 89 da             	mov    %rbx,%rdx
+  80367b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80367f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803682:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803685:	85 c0                	test   %eax,%eax
+  803687:	79 32                	jns    8036bb <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803689:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80368c:	74 e1                	je     80366f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80368e:	89 c1                	mov    %eax,%ecx
+  803690:	48 ba 43 3e 80 00 00 	movabs $0x803e43,%rdx
+  803697:	00 00 00 
+  80369a:	be 52 00 00 00       	mov    $0x52,%esi
+  80369f:	48 bf 57 3e 80 00 00 	movabs $0x803e57,%rdi
+  8036a6:	00 00 00 
+  8036a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ae:	49 b8 6a 34 80 00 00 	movabs $0x80346a,%r8
+  8036b5:	00 00 00 
+  8036b8:	41 ff d0             	call   *%r8
+    }
+}
+  8036bb:	48 83 c4 18          	add    $0x18,%rsp
+  8036bf:	5b                   	pop    %rbx
+  8036c0:	41 5c                	pop    %r12
+  8036c2:	41 5d                	pop    %r13
+  8036c4:	41 5e                	pop    %r14
+  8036c6:	41 5f                	pop    %r15
+  8036c8:	5d                   	pop    %rbp
+  8036c9:	c3                   	ret
+
+00000000008036ca <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036ca:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036cf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036d6:	00 00 00 
+  8036d9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8036dd:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8036e1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036e5:	48 01 ca             	add    %rcx,%rdx
+  8036e8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8036ee:	39 fa                	cmp    %edi,%edx
+  8036f0:	74 12                	je     803704 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8036f2:	48 83 c0 01          	add    $0x1,%rax
+  8036f6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8036fc:	75 db                	jne    8036d9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803703:	c3                   	ret
+            return envs[i].env_id;
+  803704:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803708:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80370c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803710:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803717:	00 00 00 
+  80371a:	48 01 d0             	add    %rdx,%rax
+  80371d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803723:	c3                   	ret
+  803724:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803728 <__rodata_start>:
+  803728:	55                   	push   %rbp
+  803729:	73 61                	jae    80378c <__rodata_start+0x64>
+  80372b:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  80372f:	72 65                	jb     803796 <__rodata_start+0x6e>
+  803731:	63 76 73             	movsxd 0x73(%rsi),%esi
+  803734:	68 20 3c 73 74       	push   $0x74733c20
+  803739:	72 65                	jb     8037a0 <__rodata_start+0x78>
+  80373b:	61                   	(bad)
+  80373c:	6d                   	insl   (%dx),%es:(%rdi)
+  80373d:	20 66 69             	and    %ah,0x69(%rsi)
+  803740:	6c                   	insb   (%dx),%es:(%rdi)
+  803741:	65 3e 0a 00          	gs or  %gs:(%rax),%al
+  803745:	0f 1f 00             	nopl   (%rax)
+  803748:	20 20                	and    %ah,(%rax)
+  80374a:	20 20                	and    %ah,(%rax)
+  80374c:	20 20                	and    %ah,(%rax)
+  80374e:	20 61 72             	and    %ah,0x72(%rcx)
+  803751:	67 20 70 6f          	and    %dh,0x6f(%eax)
+  803755:	73 69                	jae    8037c0 <__rodata_start+0x98>
+  803757:	74 69                	je     8037c2 <__rodata_start+0x9a>
+  803759:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80375a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80375b:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e157c5 <__bss_end+0x7260d7c5>
+  803761:	67 75 6d             	addr32 jne 8037d1 <__rodata_start+0xa9>
+  803764:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803766:	74 3a                	je     8037a2 <__rodata_start+0x7a>
+  803768:	25 73 0a 00 00       	and    $0xa73,%eax
+  80376d:	00 00                	add    %al,(%rax)
+  80376f:	00 53 6e             	add    %dl,0x6e(%rbx)
+  803772:	61                   	(bad)
+  803773:	70 73                	jo     8037e8 <__rodata_start+0xc0>
+  803775:	68 6f 74 20 63       	push   $0x6320746f
+  80377a:	61                   	(bad)
+  80377b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80377e:	74 20                	je     8037a0 <__rodata_start+0x78>
+  803780:	62 65                	(bad)
+  803782:	20 72 65             	and    %dh,0x65(%rdx)
+  803785:	63 65 69             	movsxd 0x69(%rbp),%esp
+  803788:	76 65                	jbe    8037ef <__rodata_start+0xc7>
+  80378a:	64 3a 20             	cmp    %fs:(%rax),%ah
+  80378d:	25 69 0a 00 3c       	and    $0x3c000a69,%eax
+  803792:	75 6e                	jne    803802 <__rodata_start+0xda>
+  803794:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803798:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803799:	3e 00 30             	ds add %dh,(%rax)
+  80379c:	31 32                	xor    %esi,(%rdx)
+  80379e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8037a5:	41                   	rex.B
+  8037a6:	42                   	rex.X
+  8037a7:	43                   	rex.XB
+  8037a8:	44                   	rex.R
+  8037a9:	45                   	rex.RB
+  8037aa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8037ad:	31 32                	xor    %esi,(%rdx)
+  8037af:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8037b6:	61                   	(bad)
+  8037b7:	62 63 64 65 66       	(bad)
+  8037bc:	00 28                	add    %ch,(%rax)
+  8037be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037bf:	75 6c                	jne    80382d <__rodata_start+0x105>
+  8037c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8037c2:	29 00                	sub    %eax,(%rax)
+  8037c4:	65 72 72             	gs jb  803839 <__rodata_start+0x111>
+  8037c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c8:	72 20                	jb     8037ea <__rodata_start+0xc2>
+  8037ca:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8037cf:	73 70                	jae    803841 <__rodata_start+0x119>
+  8037d1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8037d5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8037dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037dd:	72 00                	jb     8037df <__rodata_start+0xb7>
+  8037df:	62 61 64 20 65       	(bad)
+  8037e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037e5:	76 69                	jbe    803850 <__rodata_start+0x128>
+  8037e7:	72 6f                	jb     803858 <__rodata_start+0x130>
+  8037e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8037eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037ed:	74 00                	je     8037ef <__rodata_start+0xc7>
+  8037ef:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8037f6:	20 70 61             	and    %dh,0x61(%rax)
+  8037f9:	72 61                	jb     80385c <__rodata_start+0x134>
+  8037fb:	6d                   	insl   (%dx),%es:(%rdi)
+  8037fc:	65 74 65             	gs je  803864 <__rodata_start+0x13c>
+  8037ff:	72 00                	jb     803801 <__rodata_start+0xd9>
+  803801:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803802:	75 74                	jne    803878 <__rodata_start+0x150>
+  803804:	20 6f 66             	and    %ch,0x66(%rdi)
+  803807:	20 6d 65             	and    %ch,0x65(%rbp)
+  80380a:	6d                   	insl   (%dx),%es:(%rdi)
+  80380b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80380c:	72 79                	jb     803887 <__rodata_start+0x15f>
+  80380e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803811:	74 20                	je     803833 <__rodata_start+0x10b>
+  803813:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803814:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803818:	76 69                	jbe    803883 <__rodata_start+0x15b>
+  80381a:	72 6f                	jb     80388b <__rodata_start+0x163>
+  80381c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80381d:	6d                   	insl   (%dx),%es:(%rdi)
+  80381e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803820:	74 73                	je     803895 <__rodata_start+0x16d>
+  803822:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803825:	72 72                	jb     803899 <__rodata_start+0x171>
+  803827:	75 70                	jne    803899 <__rodata_start+0x171>
+  803829:	74 65                	je     803890 <__rodata_start+0x168>
+  80382b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803830:	75 67                	jne    803899 <__rodata_start+0x171>
+  803832:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803835:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803837:	00 73 65             	add    %dh,0x65(%rbx)
+  80383a:	67 6d                	insl   (%dx),%es:(%edi)
+  80383c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80383e:	74 61                	je     8038a1 <__rodata_start+0x179>
+  803840:	74 69                	je     8038ab <__rodata_start+0x183>
+  803842:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803843:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803844:	20 66 61             	and    %ah,0x61(%rsi)
+  803847:	75 6c                	jne    8038b5 <__rodata_start+0x18d>
+  803849:	74 00                	je     80384b <__rodata_start+0x123>
+  80384b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803852:	20 45 4c             	and    %al,0x4c(%rbp)
+  803855:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803859:	61                   	(bad)
+  80385a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80385f:	20 73 75             	and    %dh,0x75(%rbx)
+  803862:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803865:	73 79                	jae    8038e0 <__rodata_start+0x1b8>
+  803867:	73 74                	jae    8038dd <__rodata_start+0x1b5>
+  803869:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80386b:	20 63 61             	and    %ah,0x61(%rbx)
+  80386e:	6c                   	insb   (%dx),%es:(%rdi)
+  80386f:	6c                   	insb   (%dx),%es:(%rdi)
+  803870:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803873:	74 72                	je     8038e7 <__rodata_start+0x1bf>
+  803875:	79 20                	jns    803897 <__rodata_start+0x16f>
+  803877:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803878:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803879:	74 20                	je     80389b <__rodata_start+0x173>
+  80387b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80387d:	75 6e                	jne    8038ed <__rodata_start+0x1c5>
+  80387f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803883:	76 20                	jbe    8038a5 <__rodata_start+0x17d>
+  803885:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80388c:	72 65                	jb     8038f3 <__rodata_start+0x1cb>
+  80388e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803891:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803892:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803896:	65 78 70             	gs js  803909 <__rodata_start+0x1e1>
+  803899:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80389e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8038a1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8038a5:	20 66 69             	and    %ah,0x69(%rsi)
+  8038a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8038a9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8038ad:	20 66 72             	and    %ah,0x72(%rsi)
+  8038b0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8038b5:	61                   	(bad)
+  8038b6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8038b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038bb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8038bf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8038c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8038c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c8:	79 20                	jns    8038ea <__rodata_start+0x1c2>
+  8038ca:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8038d1:	72 65                	jb     803938 <__rodata_start+0x210>
+  8038d3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8038d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038d8:	00 66 69             	add    %ah,0x69(%rsi)
+  8038db:	6c                   	insb   (%dx),%es:(%rdi)
+  8038dc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8038e0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8038e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038e4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8038e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038e9:	74 20                	je     80390b <__rodata_start+0x1e3>
+  8038eb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038ed:	75 6e                	jne    80395d <__rodata_start+0x235>
+  8038ef:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8038f3:	76 61                	jbe    803956 <__rodata_start+0x22e>
+  8038f5:	6c                   	insb   (%dx),%es:(%rdi)
+  8038f6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8038fd:	00 
+  8038fe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803905:	72 65                	jb     80396c <__rodata_start+0x244>
+  803907:	61                   	(bad)
+  803908:	64 79 20             	fs jns 80392b <__rodata_start+0x203>
+  80390b:	65 78 69             	gs js  803977 <__rodata_start+0x24f>
+  80390e:	73 74                	jae    803984 <__rodata_start+0x25c>
+  803910:	73 00                	jae    803912 <__rodata_start+0x1ea>
+  803912:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803913:	70 65                	jo     80397a <__rodata_start+0x252>
+  803915:	72 61                	jb     803978 <__rodata_start+0x250>
+  803917:	74 69                	je     803982 <__rodata_start+0x25a>
+  803919:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80391a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80391b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80391e:	74 20                	je     803940 <__rodata_start+0x218>
+  803920:	73 75                	jae    803997 <__rodata_start+0x26f>
+  803922:	70 70                	jo     803994 <__rodata_start+0x26c>
+  803924:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803925:	72 74                	jb     80399b <__rodata_start+0x273>
+  803927:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80392d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803932:	74 00                	je     803934 <__rodata_start+0x20c>
+  803934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80393b:	00 00 00 
+  80393e:	66 90                	xchg   %ax,%ax
+  803940:	45 04 80             	rex.RB add $0x80,%al
+  803943:	00 00                	add    %al,(%rax)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 76 0a             	add    %dh,0xa(%rsi)
+  803952:	80 00 00             	addb   $0x0,(%rax)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 64 04 80          	add    %ah,-0x80(%rsp,%rax,1)
+  80397b:	00 00                	add    %al,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 58 04             	add    %bl,0x4(%rax)
+  803992:	80 00 00             	addb   $0x0,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 d2                	add    %dl,%dl
+  803999:	04 80                	add    $0x80,%al
+  80399b:	00 00                	add    %al,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 58 04             	add    %bl,0x4(%rax)
+  8039aa:	80 00 00             	addb   $0x0,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 a9 09 80 00 00    	add    %ch,0x8009(%rcx)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 f5                	add    %dh,%ch
+  803b41:	04 80                	add    $0x80,%al
+  803b43:	00 00                	add    %al,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 c4                	add    %al,%ah
+  803b49:	06                   	(bad)
+  803b4a:	80 00 00             	addb   $0x0,(%rax)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 24 05 80 00 00 00 	add    %ah,0x80(,%rax,1)
+  803b76:	00 00                	add    %al,(%rax)
+  803b78:	86 0a                	xchg   %cl,(%rdx)
+  803b7a:	80 00 00             	addb   $0x0,(%rax)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 ea                	add    %ch,%dl
+  803b89:	04 80                	add    $0x80,%al
+  803b8b:	00 00                	add    %al,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 6c 08 80          	add    %ch,-0x80(%rax,%rcx,1)
+  803ba3:	00 00                	add    %al,(%rax)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 36                	add    %dh,(%rsi)
+  803ba9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803baf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 bb 05 80 00 00    	add    %bh,0x8005(%rbx)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 98 07 80 00 00    	add    %bl,0x8007(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 a9 09 80 00 00    	add    %ch,0x8009(%rcx)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 4e 04             	add    %cl,0x4(%rsi)
+  803bfa:	80 00 00             	addb   $0x0,(%rax)
+  803bfd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803c00 <error_string>:
+	...
+  803c08:	cd 37 80 00 00 00 00 00 df 37 80 00 00 00 00 00     .7.......7......
+  803c18:	ef 37 80 00 00 00 00 00 01 38 80 00 00 00 00 00     .7.......8......
+  803c28:	0f 38 80 00 00 00 00 00 23 38 80 00 00 00 00 00     .8......#8......
+  803c38:	38 38 80 00 00 00 00 00 4b 38 80 00 00 00 00 00     88......K8......
+  803c48:	5d 38 80 00 00 00 00 00 71 38 80 00 00 00 00 00     ]8......q8......
+  803c58:	81 38 80 00 00 00 00 00 94 38 80 00 00 00 00 00     .8.......8......
+  803c68:	ab 38 80 00 00 00 00 00 c1 38 80 00 00 00 00 00     .8.......8......
+  803c78:	d9 38 80 00 00 00 00 00 f1 38 80 00 00 00 00 00     .8.......8......
+  803c88:	fe 38 80 00 00 00 00 00 a8 3c 80 00 00 00 00 00     .8.......<......
+  803c98:	12 39 80 00 00 00 00 00 2a 39 80 00 00 00 00 00     .9......*9......
+  803ca8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803cb8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803cc8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803cd8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803ce8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803cf8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d18:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803d28:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803d38:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803d48:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803d58:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803d68:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803d78:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803d88:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803d98:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803da0 <devtab>:
+  803da0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803db0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803dc0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803dd0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803de0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803df0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e00:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e10:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803e20:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803e30:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803e40:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803e50:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
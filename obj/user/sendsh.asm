@@ -0,0 +1,6986 @@
+
+obj/user/sendsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e0 00 00 00       	call   800103 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 f5             	mov    %rsi,%r13
+
+    if (argc != 4) {
+  800039:	83 ff 04             	cmp    $0x4,%edi
+  80003c:	74 69                	je     8000a7 <umain+0x82>
+  80003e:	41 89 fc             	mov    %edi,%r12d
+        cprintf("Usage: sendsh <parent snapshot> <snapshot> <stream file>\n");
+  800041:	48 bf 50 37 80 00 00 	movabs $0x803750,%rdi
+  800048:	00 00 00 
+  80004b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800050:	48 ba 81 02 80 00 00 	movabs $0x800281,%rdx
+  800057:	00 00 00 
+  80005a:	ff d2                	call   *%rdx
+        for(int i = 0; i < argc; ++i) {
+  80005c:	45 85 e4             	test   %r12d,%r12d
+  80005f:	7e 37                	jle    800098 <umain+0x73>
+  800061:	4d 63 e4             	movslq %r12d,%r12
+  800064:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+  800069:	49 bf 90 37 80 00 00 	movabs $0x803790,%r15
+  800070:	00 00 00 
+  800073:	49 be 81 02 80 00 00 	movabs $0x800281,%r14
+  80007a:	00 00 00 
+  80007d:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  800082:	89 de                	mov    %ebx,%esi
+  800084:	4c 89 ff             	mov    %r15,%rdi
+  800087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008c:	41 ff d6             	call   *%r14
+        for(int i = 0; i < argc; ++i) {
+  80008f:	48 83 c3 01          	add    $0x1,%rbx
+  800093:	4c 39 e3             	cmp    %r12,%rbx
+  800096:	75 e5                	jne    80007d <umain+0x58>
+    } else {
+        cprintf("sent %d bytes to %s\n", res, argv[3]);
+    }
+
+    return;
+}
+  800098:	48 83 c4 08          	add    $0x8,%rsp
+  80009c:	5b                   	pop    %rbx
+  80009d:	41 5c                	pop    %r12
+  80009f:	41 5d                	pop    %r13
+  8000a1:	41 5e                	pop    %r14
+  8000a3:	41 5f                	pop    %r15
+  8000a5:	5d                   	pop    %rbp
+  8000a6:	c3                   	ret
+    int res = send_snapshot(argv[1], argv[2], argv[3]);
+  8000a7:	48 8b 56 18          	mov    0x18(%rsi),%rdx
+  8000ab:	48 8b 76 10          	mov    0x10(%rsi),%rsi
+  8000af:	49 8b 7d 08          	mov    0x8(%r13),%rdi
+  8000b3:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+  8000bf:	89 c6                	mov    %eax,%esi
+    if (res < 0) {
+  8000c1:	85 c0                	test   %eax,%eax
+  8000c3:	78 21                	js     8000e6 <umain+0xc1>
+        cprintf("sent %d bytes to %s\n", res, argv[3]);
+  8000c5:	49 8b 55 18          	mov    0x18(%r13),%rdx
+  8000c9:	48 bf d1 37 80 00 00 	movabs $0x8037d1,%rdi
+  8000d0:	00 00 00 
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  8000df:	00 00 00 
+  8000e2:	ff d1                	call   *%rcx
+  8000e4:	eb b2                	jmp    800098 <umain+0x73>
+        cprintf("Snapshot cannot be sent: %i\n", res);
+  8000e6:	48 bf b4 37 80 00 00 	movabs $0x8037b4,%rdi
+  8000ed:	00 00 00 
+  8000f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f5:	48 ba 81 02 80 00 00 	movabs $0x800281,%rdx
+  8000fc:	00 00 00 
+  8000ff:	ff d2                	call   *%rdx
+  800101:	eb 95                	jmp    800098 <umain+0x73>
+
+0000000000800103 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800103:	55                   	push   %rbp
+  800104:	48 89 e5             	mov    %rsp,%rbp
+  800107:	41 56                	push   %r14
+  800109:	41 55                	push   %r13
+  80010b:	41 54                	push   %r12
+  80010d:	53                   	push   %rbx
+  80010e:	41 89 fd             	mov    %edi,%r13d
+  800111:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800114:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80011b:	00 00 00 
+  80011e:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800125:	00 00 00 
+  800128:	48 39 c2             	cmp    %rax,%rdx
+  80012b:	73 17                	jae    800144 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80012d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800130:	49 89 c4             	mov    %rax,%r12
+  800133:	48 83 c3 08          	add    $0x8,%rbx
+  800137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013c:	ff 53 f8             	call   *-0x8(%rbx)
+  80013f:	4c 39 e3             	cmp    %r12,%rbx
+  800142:	72 ef                	jb     800133 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800144:	48 b8 72 11 80 00 00 	movabs $0x801172,%rax
+  80014b:	00 00 00 
+  80014e:	ff d0                	call   *%rax
+  800150:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800155:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800159:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80015d:	48 c1 e0 04          	shl    $0x4,%rax
+  800161:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800168:	00 00 00 
+  80016b:	48 01 d0             	add    %rdx,%rax
+  80016e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800175:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800178:	45 85 ed             	test   %r13d,%r13d
+  80017b:	7e 0d                	jle    80018a <libmain+0x87>
+  80017d:	49 8b 06             	mov    (%r14),%rax
+  800180:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800187:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80018a:	4c 89 f6             	mov    %r14,%rsi
+  80018d:	44 89 ef             	mov    %r13d,%edi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80019c:	48 b8 b1 01 80 00 00 	movabs $0x8001b1,%rax
+  8001a3:	00 00 00 
+  8001a6:	ff d0                	call   *%rax
+#endif
+}
+  8001a8:	5b                   	pop    %rbx
+  8001a9:	41 5c                	pop    %r12
+  8001ab:	41 5d                	pop    %r13
+  8001ad:	41 5e                	pop    %r14
+  8001af:	5d                   	pop    %rbp
+  8001b0:	c3                   	ret
+
+00000000008001b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b1:	55                   	push   %rbp
+  8001b2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001b5:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  8001bc:	00 00 00 
+  8001bf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c6:	48 b8 07 11 80 00 00 	movabs $0x801107,%rax
+  8001cd:	00 00 00 
+  8001d0:	ff d0                	call   *%rax
+}
+  8001d2:	5d                   	pop    %rbp
+  8001d3:	c3                   	ret
+
+00000000008001d4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001d4:	55                   	push   %rbp
+  8001d5:	48 89 e5             	mov    %rsp,%rbp
+  8001d8:	53                   	push   %rbx
+  8001d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8001dd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001e0:	8b 06                	mov    (%rsi),%eax
+  8001e2:	8d 50 01             	lea    0x1(%rax),%edx
+  8001e5:	89 16                	mov    %edx,(%rsi)
+  8001e7:	48 98                	cltq
+  8001e9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001ee:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001f4:	74 0a                	je     800200 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001f6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fe:	c9                   	leave
+  8001ff:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800200:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800204:	be ff 00 00 00       	mov    $0xff,%esi
+  800209:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+        state->offset = 0;
+  800215:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80021b:	eb d9                	jmp    8001f6 <putch+0x22>
+
+000000000080021d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800228:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80022b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800232:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80023f:	48 89 f1             	mov    %rsi,%rcx
+  800242:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800249:	48 bf d4 01 80 00 00 	movabs $0x8001d4,%rdi
+  800250:	00 00 00 
+  800253:	48 b8 d1 03 80 00 00 	movabs $0x8003d1,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80025f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800266:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80026d:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800279:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+0000000000800281 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	48 83 ec 50          	sub    $0x50,%rsp
+  800289:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80028d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800291:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800295:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800299:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80029d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002b4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002b8:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+00000000008002c6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+  8002ca:	41 57                	push   %r15
+  8002cc:	41 56                	push   %r14
+  8002ce:	41 55                	push   %r13
+  8002d0:	41 54                	push   %r12
+  8002d2:	53                   	push   %rbx
+  8002d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8002d7:	49 89 fc             	mov    %rdi,%r12
+  8002da:	49 89 f5             	mov    %rsi,%r13
+  8002dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002e1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002e4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002e7:	41 89 cf             	mov    %ecx,%r15d
+  8002ea:	4c 39 fa             	cmp    %r15,%rdx
+  8002ed:	73 5b                	jae    80034a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002ef:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002f3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 0e                	jle    800309 <print_num+0x43>
+            putch(padc, put_arg);
+  8002fb:	4c 89 ee             	mov    %r13,%rsi
+  8002fe:	44 89 f7             	mov    %r14d,%edi
+  800301:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800304:	83 eb 01             	sub    $0x1,%ebx
+  800307:	75 f2                	jne    8002fb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800309:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80030d:	48 b9 01 38 80 00 00 	movabs $0x803801,%rcx
+  800314:	00 00 00 
+  800317:	48 b8 f0 37 80 00 00 	movabs $0x8037f0,%rax
+  80031e:	00 00 00 
+  800321:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800325:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032e:	49 f7 f7             	div    %r15
+  800331:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800335:	4c 89 ee             	mov    %r13,%rsi
+  800338:	41 ff d4             	call   *%r12
+}
+  80033b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80033f:	5b                   	pop    %rbx
+  800340:	41 5c                	pop    %r12
+  800342:	41 5d                	pop    %r13
+  800344:	41 5e                	pop    %r14
+  800346:	41 5f                	pop    %r15
+  800348:	5d                   	pop    %rbp
+  800349:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80034a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80034e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800353:	49 f7 f7             	div    %r15
+  800356:	48 83 ec 08          	sub    $0x8,%rsp
+  80035a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80035e:	52                   	push   %rdx
+  80035f:	45 0f be c9          	movsbl %r9b,%r9d
+  800363:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800367:	48 89 c2             	mov    %rax,%rdx
+  80036a:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+  800376:	48 83 c4 10          	add    $0x10,%rsp
+  80037a:	eb 8d                	jmp    800309 <print_num+0x43>
+
+000000000080037c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80037c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800380:	48 8b 06             	mov    (%rsi),%rax
+  800383:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800387:	73 0a                	jae    800393 <sprintputch+0x17>
+        *state->start++ = ch;
+  800389:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80038d:	48 89 16             	mov    %rdx,(%rsi)
+  800390:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800393:	c3                   	ret
+
+0000000000800394 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	48 83 ec 50          	sub    $0x50,%rsp
+  80039c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003a0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003a4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003a8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003b7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003bf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003c3:	48 b8 d1 03 80 00 00 	movabs $0x8003d1,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+}
+  8003cf:	c9                   	leave
+  8003d0:	c3                   	ret
+
+00000000008003d1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003d1:	55                   	push   %rbp
+  8003d2:	48 89 e5             	mov    %rsp,%rbp
+  8003d5:	41 57                	push   %r15
+  8003d7:	41 56                	push   %r14
+  8003d9:	41 55                	push   %r13
+  8003db:	41 54                	push   %r12
+  8003dd:	53                   	push   %rbx
+  8003de:	48 83 ec 38          	sub    $0x38,%rsp
+  8003e2:	49 89 fe             	mov    %rdi,%r14
+  8003e5:	49 89 f5             	mov    %rsi,%r13
+  8003e8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003eb:	48 8b 01             	mov    (%rcx),%rax
+  8003ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003f2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800402:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800406:	0f b6 3b             	movzbl (%rbx),%edi
+  800409:	40 80 ff 25          	cmp    $0x25,%dil
+  80040d:	74 18                	je     800427 <vprintfmt+0x56>
+            if (!ch) return;
+  80040f:	40 84 ff             	test   %dil,%dil
+  800412:	0f 84 b1 06 00 00    	je     800ac9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800418:	40 0f b6 ff          	movzbl %dil,%edi
+  80041c:	4c 89 ee             	mov    %r13,%rsi
+  80041f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800422:	4c 89 e3             	mov    %r12,%rbx
+  800425:	eb db                	jmp    800402 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800427:	be 00 00 00 00       	mov    $0x0,%esi
+  80042c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800430:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800435:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80043b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800442:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800446:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80044b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800450:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800453:	83 e8 23             	sub    $0x23,%eax
+  800456:	3c 57                	cmp    $0x57,%al
+  800458:	0f 87 51 06 00 00    	ja     800aaf <vprintfmt+0x6de>
+  80045e:	0f b6 c0             	movzbl %al,%eax
+  800461:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  800468:	00 00 00 
+  80046b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80046e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800471:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800475:	eb cf                	jmp    800446 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800477:	49 89 dc             	mov    %rbx,%r12
+  80047a:	be 01 00 00 00       	mov    $0x1,%esi
+  80047f:	eb c5                	jmp    800446 <vprintfmt+0x75>
+            padc = ch;
+  800481:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800485:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800488:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80048b:	eb b9                	jmp    800446 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80048d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800490:	83 f8 2f             	cmp    $0x2f,%eax
+  800493:	77 24                	ja     8004b9 <vprintfmt+0xe8>
+  800495:	89 c1                	mov    %eax,%ecx
+  800497:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80049b:	83 c0 08             	add    $0x8,%eax
+  80049e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004a1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004a4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ab:	79 99                	jns    800446 <vprintfmt+0x75>
+                width = precision;
+  8004ad:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004b1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004b7:	eb 8d                	jmp    800446 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004bd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c5:	eb da                	jmp    8004a1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004c7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004cc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004d0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004d6:	3c 39                	cmp    $0x39,%al
+  8004d8:	77 1c                	ja     8004f6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004da:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004de:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004e2:	0f b6 c0             	movzbl %al,%eax
+  8004e5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ea:	0f b6 03             	movzbl (%rbx),%eax
+  8004ed:	3c 39                	cmp    $0x39,%al
+  8004ef:	76 e9                	jbe    8004da <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004f1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004f4:	eb b1                	jmp    8004a7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004f6:	49 89 dc             	mov    %rbx,%r12
+  8004f9:	eb ac                	jmp    8004a7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004fb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004fe:	85 c9                	test   %ecx,%ecx
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	0f 49 c1             	cmovns %ecx,%eax
+  800508:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80050b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80050e:	e9 33 ff ff ff       	jmp    800446 <vprintfmt+0x75>
+            lflag++;
+  800513:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800516:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800519:	e9 28 ff ff ff       	jmp    800446 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80051e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800521:	83 f8 2f             	cmp    $0x2f,%eax
+  800524:	77 19                	ja     80053f <vprintfmt+0x16e>
+  800526:	89 c2                	mov    %eax,%edx
+  800528:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80052c:	83 c0 08             	add    $0x8,%eax
+  80052f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800532:	8b 3a                	mov    (%rdx),%edi
+  800534:	4c 89 ee             	mov    %r13,%rsi
+  800537:	41 ff d6             	call   *%r14
+            break;
+  80053a:	e9 c3 fe ff ff       	jmp    800402 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80053f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800543:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800547:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054b:	eb e5                	jmp    800532 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80054d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800550:	83 f8 2f             	cmp    $0x2f,%eax
+  800553:	77 5a                	ja     8005af <vprintfmt+0x1de>
+  800555:	89 c2                	mov    %eax,%edx
+  800557:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055b:	83 c0 08             	add    $0x8,%eax
+  80055e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800561:	8b 02                	mov    (%rdx),%eax
+  800563:	89 c1                	mov    %eax,%ecx
+  800565:	f7 d9                	neg    %ecx
+  800567:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80056a:	83 f9 14             	cmp    $0x14,%ecx
+  80056d:	7f 4e                	jg     8005bd <vprintfmt+0x1ec>
+  80056f:	48 63 c1             	movslq %ecx,%rax
+  800572:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  800579:	00 00 00 
+  80057c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800580:	48 85 c0             	test   %rax,%rax
+  800583:	74 38                	je     8005bd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800585:	48 89 c1             	mov    %rax,%rcx
+  800588:	48 ba 39 3e 80 00 00 	movabs $0x803e39,%rdx
+  80058f:	00 00 00 
+  800592:	4c 89 ee             	mov    %r13,%rsi
+  800595:	4c 89 f7             	mov    %r14,%rdi
+  800598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059d:	49 b8 94 03 80 00 00 	movabs $0x800394,%r8
+  8005a4:	00 00 00 
+  8005a7:	41 ff d0             	call   *%r8
+  8005aa:	e9 53 fe ff ff       	jmp    800402 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bb:	eb a4                	jmp    800561 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005bd:	48 ba 19 38 80 00 00 	movabs $0x803819,%rdx
+  8005c4:	00 00 00 
+  8005c7:	4c 89 ee             	mov    %r13,%rsi
+  8005ca:	4c 89 f7             	mov    %r14,%rdi
+  8005cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d2:	49 b8 94 03 80 00 00 	movabs $0x800394,%r8
+  8005d9:	00 00 00 
+  8005dc:	41 ff d0             	call   *%r8
+  8005df:	e9 1e fe ff ff       	jmp    800402 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ea:	77 6c                	ja     800658 <vprintfmt+0x287>
+  8005ec:	89 c2                	mov    %eax,%edx
+  8005ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f2:	83 c0 08             	add    $0x8,%eax
+  8005f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005fb:	48 85 d2             	test   %rdx,%rdx
+  8005fe:	48 b8 12 38 80 00 00 	movabs $0x803812,%rax
+  800605:	00 00 00 
+  800608:	48 0f 45 c2          	cmovne %rdx,%rax
+  80060c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800610:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800614:	7e 06                	jle    80061c <vprintfmt+0x24b>
+  800616:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80061a:	75 4a                	jne    800666 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80061c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800620:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800624:	0f b6 00             	movzbl (%rax),%eax
+  800627:	84 c0                	test   %al,%al
+  800629:	0f 85 9a 00 00 00    	jne    8006c9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80062f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800632:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800636:	85 c0                	test   %eax,%eax
+  800638:	0f 8e c4 fd ff ff    	jle    800402 <vprintfmt+0x31>
+  80063e:	4c 89 ee             	mov    %r13,%rsi
+  800641:	bf 20 00 00 00       	mov    $0x20,%edi
+  800646:	41 ff d6             	call   *%r14
+  800649:	41 83 ec 01          	sub    $0x1,%r12d
+  80064d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800651:	75 eb                	jne    80063e <vprintfmt+0x26d>
+  800653:	e9 aa fd ff ff       	jmp    800402 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800658:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800660:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800664:	eb 92                	jmp    8005f8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800666:	49 63 f7             	movslq %r15d,%rsi
+  800669:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80066d:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  800674:	00 00 00 
+  800677:	ff d0                	call   *%rax
+  800679:	48 89 c2             	mov    %rax,%rdx
+  80067c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800681:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800684:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800687:	85 c0                	test   %eax,%eax
+  800689:	7e 91                	jle    80061c <vprintfmt+0x24b>
+  80068b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800690:	4c 89 ee             	mov    %r13,%rsi
+  800693:	44 89 e7             	mov    %r12d,%edi
+  800696:	41 ff d6             	call   *%r14
+  800699:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80069d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006a3:	75 eb                	jne    800690 <vprintfmt+0x2bf>
+  8006a5:	e9 72 ff ff ff       	jmp    80061c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006aa:	0f b6 f8             	movzbl %al,%edi
+  8006ad:	4c 89 ee             	mov    %r13,%rsi
+  8006b0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006b3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006b7:	49 83 c4 01          	add    $0x1,%r12
+  8006bb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006c1:	84 c0                	test   %al,%al
+  8006c3:	0f 84 66 ff ff ff    	je     80062f <vprintfmt+0x25e>
+  8006c9:	45 85 ff             	test   %r15d,%r15d
+  8006cc:	78 0a                	js     8006d8 <vprintfmt+0x307>
+  8006ce:	41 83 ef 01          	sub    $0x1,%r15d
+  8006d2:	0f 88 57 ff ff ff    	js     80062f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006dc:	74 cc                	je     8006aa <vprintfmt+0x2d9>
+  8006de:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006e1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006e6:	80 fa 5e             	cmp    $0x5e,%dl
+  8006e9:	77 c2                	ja     8006ad <vprintfmt+0x2dc>
+  8006eb:	eb bd                	jmp    8006aa <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ed:	40 84 f6             	test   %sil,%sil
+  8006f0:	75 26                	jne    800718 <vprintfmt+0x347>
+    switch (lflag) {
+  8006f2:	85 d2                	test   %edx,%edx
+  8006f4:	74 59                	je     80074f <vprintfmt+0x37e>
+  8006f6:	83 fa 01             	cmp    $0x1,%edx
+  8006f9:	74 7b                	je     800776 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800701:	0f 87 96 00 00 00    	ja     80079d <vprintfmt+0x3cc>
+  800707:	89 c2                	mov    %eax,%edx
+  800709:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070d:	83 c0 08             	add    $0x8,%eax
+  800710:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800713:	4c 8b 22             	mov    (%rdx),%r12
+  800716:	eb 17                	jmp    80072f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 21                	ja     800741 <vprintfmt+0x370>
+  800720:	89 c2                	mov    %eax,%edx
+  800722:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80072f:	4d 85 e4             	test   %r12,%r12
+  800732:	78 7a                	js     8007ae <vprintfmt+0x3dd>
+            num = i;
+  800734:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800737:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80073c:	e9 50 02 00 00       	jmp    800991 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800741:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800745:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800749:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074d:	eb dd                	jmp    80072c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80074f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800752:	83 f8 2f             	cmp    $0x2f,%eax
+  800755:	77 11                	ja     800768 <vprintfmt+0x397>
+  800757:	89 c2                	mov    %eax,%edx
+  800759:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075d:	83 c0 08             	add    $0x8,%eax
+  800760:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800763:	4c 63 22             	movslq (%rdx),%r12
+  800766:	eb c7                	jmp    80072f <vprintfmt+0x35e>
+  800768:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800770:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800774:	eb ed                	jmp    800763 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800776:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800779:	83 f8 2f             	cmp    $0x2f,%eax
+  80077c:	77 11                	ja     80078f <vprintfmt+0x3be>
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800784:	83 c0 08             	add    $0x8,%eax
+  800787:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078a:	4c 8b 22             	mov    (%rdx),%r12
+  80078d:	eb a0                	jmp    80072f <vprintfmt+0x35e>
+  80078f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079b:	eb ed                	jmp    80078a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80079d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a9:	e9 65 ff ff ff       	jmp    800713 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007ae:	4c 89 ee             	mov    %r13,%rsi
+  8007b1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007b6:	41 ff d6             	call   *%r14
+                i = -i;
+  8007b9:	49 f7 dc             	neg    %r12
+  8007bc:	e9 73 ff ff ff       	jmp    800734 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c1:	40 84 f6             	test   %sil,%sil
+  8007c4:	75 32                	jne    8007f8 <vprintfmt+0x427>
+    switch (lflag) {
+  8007c6:	85 d2                	test   %edx,%edx
+  8007c8:	74 5d                	je     800827 <vprintfmt+0x456>
+  8007ca:	83 fa 01             	cmp    $0x1,%edx
+  8007cd:	0f 84 82 00 00 00    	je     800855 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d9:	0f 87 a5 00 00 00    	ja     800884 <vprintfmt+0x4b3>
+  8007df:	89 c2                	mov    %eax,%edx
+  8007e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e5:	83 c0 08             	add    $0x8,%eax
+  8007e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007f3:	e9 99 01 00 00       	jmp    800991 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	77 19                	ja     800819 <vprintfmt+0x448>
+  800800:	89 c2                	mov    %eax,%edx
+  800802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800806:	83 c0 08             	add    $0x8,%eax
+  800809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80080f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800814:	e9 78 01 00 00       	jmp    800991 <vprintfmt+0x5c0>
+  800819:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800821:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800825:	eb e5                	jmp    80080c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800827:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082a:	83 f8 2f             	cmp    $0x2f,%eax
+  80082d:	77 18                	ja     800847 <vprintfmt+0x476>
+  80082f:	89 c2                	mov    %eax,%edx
+  800831:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800835:	83 c0 08             	add    $0x8,%eax
+  800838:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80083d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800842:	e9 4a 01 00 00       	jmp    800991 <vprintfmt+0x5c0>
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	eb e6                	jmp    80083b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 19                	ja     800876 <vprintfmt+0x4a5>
+  80085d:	89 c2                	mov    %eax,%edx
+  80085f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800863:	83 c0 08             	add    $0x8,%eax
+  800866:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800869:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80086c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800871:	e9 1b 01 00 00       	jmp    800991 <vprintfmt+0x5c0>
+  800876:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800882:	eb e5                	jmp    800869 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800884:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800888:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800890:	e9 56 ff ff ff       	jmp    8007eb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800895:	40 84 f6             	test   %sil,%sil
+  800898:	75 2e                	jne    8008c8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 59                	je     8008f7 <vprintfmt+0x526>
+  80089e:	83 fa 01             	cmp    $0x1,%edx
+  8008a1:	74 7f                	je     800922 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a9:	0f 87 9f 00 00 00    	ja     80094e <vprintfmt+0x57d>
+  8008af:	89 c2                	mov    %eax,%edx
+  8008b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b5:	83 c0 08             	add    $0x8,%eax
+  8008b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008be:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c3:	e9 c9 00 00 00       	jmp    800991 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 19                	ja     8008e9 <vprintfmt+0x518>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008df:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e4:	e9 a8 00 00 00       	jmp    800991 <vprintfmt+0x5c0>
+  8008e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f5:	eb e5                	jmp    8008dc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fd:	77 15                	ja     800914 <vprintfmt+0x543>
+  8008ff:	89 c2                	mov    %eax,%edx
+  800901:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800905:	83 c0 08             	add    $0x8,%eax
+  800908:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80090d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800912:	eb 7d                	jmp    800991 <vprintfmt+0x5c0>
+  800914:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800918:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800920:	eb e9                	jmp    80090b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800922:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800925:	83 f8 2f             	cmp    $0x2f,%eax
+  800928:	77 16                	ja     800940 <vprintfmt+0x56f>
+  80092a:	89 c2                	mov    %eax,%edx
+  80092c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800930:	83 c0 08             	add    $0x8,%eax
+  800933:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800936:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800939:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80093e:	eb 51                	jmp    800991 <vprintfmt+0x5c0>
+  800940:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800944:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800948:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094c:	eb e8                	jmp    800936 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80094e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800952:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800956:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095a:	e9 5c ff ff ff       	jmp    8008bb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80095f:	4c 89 ee             	mov    %r13,%rsi
+  800962:	bf 30 00 00 00       	mov    $0x30,%edi
+  800967:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80096a:	4c 89 ee             	mov    %r13,%rsi
+  80096d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800972:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800975:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800978:	83 f8 2f             	cmp    $0x2f,%eax
+  80097b:	77 47                	ja     8009c4 <vprintfmt+0x5f3>
+  80097d:	89 c2                	mov    %eax,%edx
+  80097f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800983:	83 c0 08             	add    $0x8,%eax
+  800986:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800989:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80098c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800991:	48 83 ec 08          	sub    $0x8,%rsp
+  800995:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800999:	0f 94 c0             	sete   %al
+  80099c:	0f b6 c0             	movzbl %al,%eax
+  80099f:	50                   	push   %rax
+  8009a0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009a5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009a9:	4c 89 ee             	mov    %r13,%rsi
+  8009ac:	4c 89 f7             	mov    %r14,%rdi
+  8009af:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  8009b6:	00 00 00 
+  8009b9:	ff d0                	call   *%rax
+            break;
+  8009bb:	48 83 c4 10          	add    $0x10,%rsp
+  8009bf:	e9 3e fa ff ff       	jmp    800402 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d0:	eb b7                	jmp    800989 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d2:	40 84 f6             	test   %sil,%sil
+  8009d5:	75 2b                	jne    800a02 <vprintfmt+0x631>
+    switch (lflag) {
+  8009d7:	85 d2                	test   %edx,%edx
+  8009d9:	74 56                	je     800a31 <vprintfmt+0x660>
+  8009db:	83 fa 01             	cmp    $0x1,%edx
+  8009de:	74 7f                	je     800a5f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e6:	0f 87 a2 00 00 00    	ja     800a8e <vprintfmt+0x6bd>
+  8009ec:	89 c2                	mov    %eax,%edx
+  8009ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f2:	83 c0 08             	add    $0x8,%eax
+  8009f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a00:	eb 8f                	jmp    800991 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 19                	ja     800a23 <vprintfmt+0x652>
+  800a0a:	89 c2                	mov    %eax,%edx
+  800a0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a10:	83 c0 08             	add    $0x8,%eax
+  800a13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a19:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a1e:	e9 6e ff ff ff       	jmp    800991 <vprintfmt+0x5c0>
+  800a23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2f:	eb e5                	jmp    800a16 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a34:	83 f8 2f             	cmp    $0x2f,%eax
+  800a37:	77 18                	ja     800a51 <vprintfmt+0x680>
+  800a39:	89 c2                	mov    %eax,%edx
+  800a3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3f:	83 c0 08             	add    $0x8,%eax
+  800a42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a45:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a47:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a4c:	e9 40 ff ff ff       	jmp    800991 <vprintfmt+0x5c0>
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb e6                	jmp    800a45 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 19                	ja     800a80 <vprintfmt+0x6af>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a76:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a7b:	e9 11 ff ff ff       	jmp    800991 <vprintfmt+0x5c0>
+  800a80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8c:	eb e5                	jmp    800a73 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9a:	e9 59 ff ff ff       	jmp    8009f8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a9f:	4c 89 ee             	mov    %r13,%rsi
+  800aa2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aa7:	41 ff d6             	call   *%r14
+            break;
+  800aaa:	e9 53 f9 ff ff       	jmp    800402 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800aaf:	4c 89 ee             	mov    %r13,%rsi
+  800ab2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ab7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aba:	48 83 eb 01          	sub    $0x1,%rbx
+  800abe:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ac2:	75 f6                	jne    800aba <vprintfmt+0x6e9>
+  800ac4:	e9 39 f9 ff ff       	jmp    800402 <vprintfmt+0x31>
+}
+  800ac9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800acd:	5b                   	pop    %rbx
+  800ace:	41 5c                	pop    %r12
+  800ad0:	41 5d                	pop    %r13
+  800ad2:	41 5e                	pop    %r14
+  800ad4:	41 5f                	pop    %r15
+  800ad6:	5d                   	pop    %rbp
+  800ad7:	c3                   	ret
+
+0000000000800ad8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ad8:	55                   	push   %rbp
+  800ad9:	48 89 e5             	mov    %rsp,%rbp
+  800adc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ae0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ae4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ae9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800aed:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800af4:	48 85 ff             	test   %rdi,%rdi
+  800af7:	74 2b                	je     800b24 <vsnprintf+0x4c>
+  800af9:	48 85 f6             	test   %rsi,%rsi
+  800afc:	74 26                	je     800b24 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800afe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b02:	48 bf 7c 03 80 00 00 	movabs $0x80037c,%rdi
+  800b09:	00 00 00 
+  800b0c:	48 b8 d1 03 80 00 00 	movabs $0x8003d1,%rax
+  800b13:	00 00 00 
+  800b16:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b22:	c9                   	leave
+  800b23:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b29:	eb f7                	jmp    800b22 <vsnprintf+0x4a>
+
+0000000000800b2b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b2b:	55                   	push   %rbp
+  800b2c:	48 89 e5             	mov    %rsp,%rbp
+  800b2f:	48 83 ec 50          	sub    $0x50,%rsp
+  800b33:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b37:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b3b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b3f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b46:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b56:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b5a:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800b61:	00 00 00 
+  800b64:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b66:	c9                   	leave
+  800b67:	c3                   	ret
+
+0000000000800b68 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b68:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b6b:	74 10                	je     800b7d <strlen+0x15>
+    size_t n = 0;
+  800b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b72:	48 83 c0 01          	add    $0x1,%rax
+  800b76:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b7a:	75 f6                	jne    800b72 <strlen+0xa>
+  800b7c:	c3                   	ret
+    size_t n = 0;
+  800b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b82:	c3                   	ret
+
+0000000000800b83 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b83:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b86:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b8b:	48 85 f6             	test   %rsi,%rsi
+  800b8e:	74 11                	je     800ba1 <strnlen+0x1e>
+  800b90:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b94:	74 0c                	je     800ba2 <strnlen+0x1f>
+  800b96:	48 83 c2 01          	add    $0x1,%rdx
+  800b9a:	48 39 d0             	cmp    %rdx,%rax
+  800b9d:	75 f1                	jne    800b90 <strnlen+0xd>
+  800b9f:	eb 04                	jmp    800ba5 <strnlen+0x22>
+  800ba1:	c3                   	ret
+  800ba2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ba5:	c3                   	ret
+
+0000000000800ba6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ba6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bae:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bb2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bb5:	48 83 c2 01          	add    $0x1,%rdx
+  800bb9:	84 c9                	test   %cl,%cl
+  800bbb:	75 f1                	jne    800bae <strcpy+0x8>
+        ;
+    return res;
+}
+  800bbd:	c3                   	ret
+
+0000000000800bbe <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bbe:	55                   	push   %rbp
+  800bbf:	48 89 e5             	mov    %rsp,%rbp
+  800bc2:	41 54                	push   %r12
+  800bc4:	53                   	push   %rbx
+  800bc5:	48 89 fb             	mov    %rdi,%rbx
+  800bc8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bcb:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  800bd2:	00 00 00 
+  800bd5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bd7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bdb:	4c 89 e6             	mov    %r12,%rsi
+  800bde:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  800be5:	00 00 00 
+  800be8:	ff d0                	call   *%rax
+    return dst;
+}
+  800bea:	48 89 d8             	mov    %rbx,%rax
+  800bed:	5b                   	pop    %rbx
+  800bee:	41 5c                	pop    %r12
+  800bf0:	5d                   	pop    %rbp
+  800bf1:	c3                   	ret
+
+0000000000800bf2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bf2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bf5:	48 85 d2             	test   %rdx,%rdx
+  800bf8:	74 1f                	je     800c19 <strncpy+0x27>
+  800bfa:	48 01 fa             	add    %rdi,%rdx
+  800bfd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c00:	48 83 c1 01          	add    $0x1,%rcx
+  800c04:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c08:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c0c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c10:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c14:	48 39 ca             	cmp    %rcx,%rdx
+  800c17:	75 e7                	jne    800c00 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c19:	c3                   	ret
+
+0000000000800c1a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c1a:	48 89 f8             	mov    %rdi,%rax
+  800c1d:	48 85 d2             	test   %rdx,%rdx
+  800c20:	74 24                	je     800c46 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c22:	48 83 ea 01          	sub    $0x1,%rdx
+  800c26:	74 1b                	je     800c43 <strlcpy+0x29>
+  800c28:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c2c:	0f b6 16             	movzbl (%rsi),%edx
+  800c2f:	84 d2                	test   %dl,%dl
+  800c31:	74 10                	je     800c43 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c33:	48 83 c6 01          	add    $0x1,%rsi
+  800c37:	48 83 c0 01          	add    $0x1,%rax
+  800c3b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c3e:	48 39 c8             	cmp    %rcx,%rax
+  800c41:	75 e9                	jne    800c2c <strlcpy+0x12>
+        *dst = '\0';
+  800c43:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c46:	48 29 f8             	sub    %rdi,%rax
+}
+  800c49:	c3                   	ret
+
+0000000000800c4a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c4a:	0f b6 07             	movzbl (%rdi),%eax
+  800c4d:	84 c0                	test   %al,%al
+  800c4f:	74 13                	je     800c64 <strcmp+0x1a>
+  800c51:	38 06                	cmp    %al,(%rsi)
+  800c53:	75 0f                	jne    800c64 <strcmp+0x1a>
+  800c55:	48 83 c7 01          	add    $0x1,%rdi
+  800c59:	48 83 c6 01          	add    $0x1,%rsi
+  800c5d:	0f b6 07             	movzbl (%rdi),%eax
+  800c60:	84 c0                	test   %al,%al
+  800c62:	75 ed                	jne    800c51 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c64:	0f b6 c0             	movzbl %al,%eax
+  800c67:	0f b6 16             	movzbl (%rsi),%edx
+  800c6a:	29 d0                	sub    %edx,%eax
+}
+  800c6c:	c3                   	ret
+
+0000000000800c6d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c6d:	48 85 d2             	test   %rdx,%rdx
+  800c70:	74 1f                	je     800c91 <strncmp+0x24>
+  800c72:	0f b6 07             	movzbl (%rdi),%eax
+  800c75:	84 c0                	test   %al,%al
+  800c77:	74 1e                	je     800c97 <strncmp+0x2a>
+  800c79:	3a 06                	cmp    (%rsi),%al
+  800c7b:	75 1a                	jne    800c97 <strncmp+0x2a>
+  800c7d:	48 83 c7 01          	add    $0x1,%rdi
+  800c81:	48 83 c6 01          	add    $0x1,%rsi
+  800c85:	48 83 ea 01          	sub    $0x1,%rdx
+  800c89:	75 e7                	jne    800c72 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c90:	c3                   	ret
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c96:	c3                   	ret
+  800c97:	48 85 d2             	test   %rdx,%rdx
+  800c9a:	74 09                	je     800ca5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c9c:	0f b6 07             	movzbl (%rdi),%eax
+  800c9f:	0f b6 16             	movzbl (%rsi),%edx
+  800ca2:	29 d0                	sub    %edx,%eax
+  800ca4:	c3                   	ret
+    if (!n) return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caa:	c3                   	ret
+
+0000000000800cab <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cab:	0f b6 17             	movzbl (%rdi),%edx
+  800cae:	84 d2                	test   %dl,%dl
+  800cb0:	74 18                	je     800cca <strchr+0x1f>
+        if (*str == c) {
+  800cb2:	0f be d2             	movsbl %dl,%edx
+  800cb5:	39 f2                	cmp    %esi,%edx
+  800cb7:	74 17                	je     800cd0 <strchr+0x25>
+    for (; *str; str++) {
+  800cb9:	48 83 c7 01          	add    $0x1,%rdi
+  800cbd:	0f b6 17             	movzbl (%rdi),%edx
+  800cc0:	84 d2                	test   %dl,%dl
+  800cc2:	75 ee                	jne    800cb2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	c3                   	ret
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	c3                   	ret
+  800cd0:	48 89 f8             	mov    %rdi,%rax
+}
+  800cd3:	c3                   	ret
+
+0000000000800cd4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cd4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cd7:	0f b6 17             	movzbl (%rdi),%edx
+  800cda:	84 d2                	test   %dl,%dl
+  800cdc:	74 13                	je     800cf1 <strfind+0x1d>
+  800cde:	0f be d2             	movsbl %dl,%edx
+  800ce1:	39 f2                	cmp    %esi,%edx
+  800ce3:	74 0b                	je     800cf0 <strfind+0x1c>
+  800ce5:	48 83 c0 01          	add    $0x1,%rax
+  800ce9:	0f b6 10             	movzbl (%rax),%edx
+  800cec:	84 d2                	test   %dl,%dl
+  800cee:	75 ee                	jne    800cde <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cf0:	c3                   	ret
+  800cf1:	c3                   	ret
+
+0000000000800cf2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cf2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cf5:	48 89 f8             	mov    %rdi,%rax
+  800cf8:	48 f7 d8             	neg    %rax
+  800cfb:	83 e0 07             	and    $0x7,%eax
+  800cfe:	49 89 d1             	mov    %rdx,%r9
+  800d01:	49 29 c1             	sub    %rax,%r9
+  800d04:	78 36                	js     800d3c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d06:	40 0f b6 c6          	movzbl %sil,%eax
+  800d0a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d11:	01 01 01 
+  800d14:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d18:	40 f6 c7 07          	test   $0x7,%dil
+  800d1c:	75 38                	jne    800d56 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d1e:	4c 89 c9             	mov    %r9,%rcx
+  800d21:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d25:	74 0c                	je     800d33 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d27:	fc                   	cld
+  800d28:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d2b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d2f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d33:	4d 85 c9             	test   %r9,%r9
+  800d36:	75 45                	jne    800d7d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d38:	4c 89 c0             	mov    %r8,%rax
+  800d3b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d3c:	48 85 d2             	test   %rdx,%rdx
+  800d3f:	74 f7                	je     800d38 <memset+0x46>
+  800d41:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d44:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d47:	48 83 c0 01          	add    $0x1,%rax
+  800d4b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d4f:	48 39 c2             	cmp    %rax,%rdx
+  800d52:	75 f3                	jne    800d47 <memset+0x55>
+  800d54:	eb e2                	jmp    800d38 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d56:	40 f6 c7 01          	test   $0x1,%dil
+  800d5a:	74 06                	je     800d62 <memset+0x70>
+  800d5c:	88 07                	mov    %al,(%rdi)
+  800d5e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d62:	40 f6 c7 02          	test   $0x2,%dil
+  800d66:	74 07                	je     800d6f <memset+0x7d>
+  800d68:	66 89 07             	mov    %ax,(%rdi)
+  800d6b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d6f:	40 f6 c7 04          	test   $0x4,%dil
+  800d73:	74 a9                	je     800d1e <memset+0x2c>
+  800d75:	89 07                	mov    %eax,(%rdi)
+  800d77:	48 83 c7 04          	add    $0x4,%rdi
+  800d7b:	eb a1                	jmp    800d1e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d7d:	41 f6 c1 04          	test   $0x4,%r9b
+  800d81:	74 06                	je     800d89 <memset+0x97>
+  800d83:	89 07                	mov    %eax,(%rdi)
+  800d85:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d89:	41 f6 c1 02          	test   $0x2,%r9b
+  800d8d:	74 07                	je     800d96 <memset+0xa4>
+  800d8f:	66 89 07             	mov    %ax,(%rdi)
+  800d92:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d96:	41 f6 c1 01          	test   $0x1,%r9b
+  800d9a:	74 9c                	je     800d38 <memset+0x46>
+  800d9c:	88 07                	mov    %al,(%rdi)
+  800d9e:	eb 98                	jmp    800d38 <memset+0x46>
+
+0000000000800da0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800da0:	48 89 f8             	mov    %rdi,%rax
+  800da3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800da6:	48 39 fe             	cmp    %rdi,%rsi
+  800da9:	73 3b                	jae    800de6 <memmove+0x46>
+  800dab:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800daf:	48 39 d7             	cmp    %rdx,%rdi
+  800db2:	73 32                	jae    800de6 <memmove+0x46>
+        s += n;
+        d += n;
+  800db4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800db8:	48 89 d6             	mov    %rdx,%rsi
+  800dbb:	48 09 fe             	or     %rdi,%rsi
+  800dbe:	48 09 ce             	or     %rcx,%rsi
+  800dc1:	40 f6 c6 07          	test   $0x7,%sil
+  800dc5:	75 12                	jne    800dd9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dc7:	48 83 ef 08          	sub    $0x8,%rdi
+  800dcb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dcf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd3:	fd                   	std
+  800dd4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dd7:	fc                   	cld
+  800dd8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dd9:	48 83 ef 01          	sub    $0x1,%rdi
+  800ddd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800de1:	fd                   	std
+  800de2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800de4:	eb f1                	jmp    800dd7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de6:	48 89 f2             	mov    %rsi,%rdx
+  800de9:	48 09 c2             	or     %rax,%rdx
+  800dec:	48 09 ca             	or     %rcx,%rdx
+  800def:	f6 c2 07             	test   $0x7,%dl
+  800df2:	75 0c                	jne    800e00 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800df4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df8:	48 89 c7             	mov    %rax,%rdi
+  800dfb:	fc                   	cld
+  800dfc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dff:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e00:	48 89 c7             	mov    %rax,%rdi
+  800e03:	fc                   	cld
+  800e04:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e06:	c3                   	ret
+
+0000000000800e07 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e0b:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  800e12:	00 00 00 
+  800e15:	ff d0                	call   *%rax
+}
+  800e17:	5d                   	pop    %rbp
+  800e18:	c3                   	ret
+
+0000000000800e19 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e19:	55                   	push   %rbp
+  800e1a:	48 89 e5             	mov    %rsp,%rbp
+  800e1d:	41 57                	push   %r15
+  800e1f:	41 56                	push   %r14
+  800e21:	41 55                	push   %r13
+  800e23:	41 54                	push   %r12
+  800e25:	53                   	push   %rbx
+  800e26:	48 83 ec 08          	sub    $0x8,%rsp
+  800e2a:	49 89 fe             	mov    %rdi,%r14
+  800e2d:	49 89 f7             	mov    %rsi,%r15
+  800e30:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e33:	48 89 f7             	mov    %rsi,%rdi
+  800e36:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+  800e42:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e45:	48 89 de             	mov    %rbx,%rsi
+  800e48:	4c 89 f7             	mov    %r14,%rdi
+  800e4b:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+  800e57:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e5a:	48 39 c3             	cmp    %rax,%rbx
+  800e5d:	74 36                	je     800e95 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e5f:	48 89 d8             	mov    %rbx,%rax
+  800e62:	4c 29 e8             	sub    %r13,%rax
+  800e65:	49 39 c4             	cmp    %rax,%r12
+  800e68:	73 31                	jae    800e9b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e6a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e6f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e73:	4c 89 fe             	mov    %r15,%rsi
+  800e76:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800e7d:	00 00 00 
+  800e80:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e82:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e86:	48 83 c4 08          	add    $0x8,%rsp
+  800e8a:	5b                   	pop    %rbx
+  800e8b:	41 5c                	pop    %r12
+  800e8d:	41 5d                	pop    %r13
+  800e8f:	41 5e                	pop    %r14
+  800e91:	41 5f                	pop    %r15
+  800e93:	5d                   	pop    %rbp
+  800e94:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e95:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e99:	eb eb                	jmp    800e86 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e9b:	48 83 eb 01          	sub    $0x1,%rbx
+  800e9f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ea3:	48 89 da             	mov    %rbx,%rdx
+  800ea6:	4c 89 fe             	mov    %r15,%rsi
+  800ea9:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eb5:	49 01 de             	add    %rbx,%r14
+  800eb8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ebd:	eb c3                	jmp    800e82 <strlcat+0x69>
+
+0000000000800ebf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ebf:	48 85 d2             	test   %rdx,%rdx
+  800ec2:	74 2d                	je     800ef1 <memcmp+0x32>
+  800ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ec9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ecd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ed2:	44 38 c1             	cmp    %r8b,%cl
+  800ed5:	75 0f                	jne    800ee6 <memcmp+0x27>
+    while (n-- > 0) {
+  800ed7:	48 83 c0 01          	add    $0x1,%rax
+  800edb:	48 39 c2             	cmp    %rax,%rdx
+  800ede:	75 e9                	jne    800ec9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ee6:	0f b6 c1             	movzbl %cl,%eax
+  800ee9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800eed:	44 29 c0             	sub    %r8d,%eax
+  800ef0:	c3                   	ret
+    return 0;
+  800ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef6:	c3                   	ret
+
+0000000000800ef7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ef7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800efb:	48 39 c7             	cmp    %rax,%rdi
+  800efe:	73 0f                	jae    800f0f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f00:	40 38 37             	cmp    %sil,(%rdi)
+  800f03:	74 0e                	je     800f13 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f05:	48 83 c7 01          	add    $0x1,%rdi
+  800f09:	48 39 f8             	cmp    %rdi,%rax
+  800f0c:	75 f2                	jne    800f00 <memfind+0x9>
+  800f0e:	c3                   	ret
+  800f0f:	48 89 f8             	mov    %rdi,%rax
+  800f12:	c3                   	ret
+  800f13:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f16:	c3                   	ret
+
+0000000000800f17 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f17:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f1a:	0f b6 37             	movzbl (%rdi),%esi
+  800f1d:	40 80 fe 20          	cmp    $0x20,%sil
+  800f21:	74 06                	je     800f29 <strtol+0x12>
+  800f23:	40 80 fe 09          	cmp    $0x9,%sil
+  800f27:	75 13                	jne    800f3c <strtol+0x25>
+  800f29:	48 83 c7 01          	add    $0x1,%rdi
+  800f2d:	0f b6 37             	movzbl (%rdi),%esi
+  800f30:	40 80 fe 20          	cmp    $0x20,%sil
+  800f34:	74 f3                	je     800f29 <strtol+0x12>
+  800f36:	40 80 fe 09          	cmp    $0x9,%sil
+  800f3a:	74 ed                	je     800f29 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f3c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f3f:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f42:	3c 01                	cmp    $0x1,%al
+  800f44:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f48:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f4e:	75 0f                	jne    800f5f <strtol+0x48>
+  800f50:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f53:	74 14                	je     800f69 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f55:	85 d2                	test   %edx,%edx
+  800f57:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f5c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f64:	4c 63 ca             	movslq %edx,%r9
+  800f67:	eb 36                	jmp    800f9f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f69:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f6d:	74 0f                	je     800f7e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f6f:	85 d2                	test   %edx,%edx
+  800f71:	75 ec                	jne    800f5f <strtol+0x48>
+        s++;
+  800f73:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f77:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f7c:	eb e1                	jmp    800f5f <strtol+0x48>
+        s += 2;
+  800f7e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f82:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f87:	eb d6                	jmp    800f5f <strtol+0x48>
+            dig -= '0';
+  800f89:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f8c:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f90:	41 39 d0             	cmp    %edx,%r8d
+  800f93:	7d 21                	jge    800fb6 <strtol+0x9f>
+        val = val * base + dig;
+  800f95:	49 0f af c1          	imul   %r9,%rax
+  800f99:	0f b6 c9             	movzbl %cl,%ecx
+  800f9c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f9f:	48 83 c7 01          	add    $0x1,%rdi
+  800fa3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fa7:	80 f9 39             	cmp    $0x39,%cl
+  800faa:	76 dd                	jbe    800f89 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fac:	80 f9 7b             	cmp    $0x7b,%cl
+  800faf:	77 05                	ja     800fb6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fb1:	83 e9 57             	sub    $0x57,%ecx
+  800fb4:	eb d6                	jmp    800f8c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fb6:	4d 85 d2             	test   %r10,%r10
+  800fb9:	74 03                	je     800fbe <strtol+0xa7>
+  800fbb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fbe:	48 89 c2             	mov    %rax,%rdx
+  800fc1:	48 f7 da             	neg    %rdx
+  800fc4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fc8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fcc:	c3                   	ret
+
+0000000000800fcd <strrev>:
+
+void
+strrev(char *str)
+{
+  800fcd:	55                   	push   %rbp
+  800fce:	48 89 e5             	mov    %rsp,%rbp
+  800fd1:	53                   	push   %rbx
+  800fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd6:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fd9:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  800fe0:	00 00 00 
+  800fe3:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fe5:	83 e8 01             	sub    $0x1,%eax
+  800fe8:	85 c0                	test   %eax,%eax
+  800fea:	7e 22                	jle    80100e <strrev+0x41>
+  800fec:	48 98                	cltq
+  800fee:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800ff3:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800ff7:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800ffb:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800fff:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801002:	48 83 c2 01          	add    $0x1,%rdx
+  801006:	48 83 e8 01          	sub    $0x1,%rax
+  80100a:	39 c2                	cmp    %eax,%edx
+  80100c:	7c e5                	jl     800ff3 <strrev+0x26>
+	}
+}
+  80100e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801012:	c9                   	leave
+  801013:	c3                   	ret
+
+0000000000801014 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801014:	85 d2                	test   %edx,%edx
+  801016:	0f 84 80 00 00 00    	je     80109c <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  80101c:	55                   	push   %rbp
+  80101d:	48 89 e5             	mov    %rsp,%rbp
+  801020:	53                   	push   %rbx
+  801021:	48 83 ec 08          	sub    $0x8,%rsp
+  801025:	49 89 f2             	mov    %rsi,%r10
+  801028:	41 89 d3             	mov    %edx,%r11d
+  80102b:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  80102e:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801033:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801036:	eb 20                	jmp    801058 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801038:	41 89 f1             	mov    %esi,%r9d
+  80103b:	83 c2 30             	add    $0x30,%edx
+  80103e:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801041:	89 f8                	mov    %edi,%eax
+  801043:	99                   	cltd
+  801044:	f7 f9                	idiv   %ecx
+  801046:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	74 2e                	je     80107a <itoa+0x66>
+  80104c:	83 c6 01             	add    $0x1,%esi
+  80104f:	49 83 c0 01          	add    $0x1,%r8
+  801053:	44 39 cb             	cmp    %r9d,%ebx
+  801056:	7e 15                	jle    80106d <itoa+0x59>
+		digit = sum % base;
+  801058:	89 f8                	mov    %edi,%eax
+  80105a:	99                   	cltd
+  80105b:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80105d:	83 fa 09             	cmp    $0x9,%edx
+  801060:	7e d6                	jle    801038 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801062:	41 89 f1             	mov    %esi,%r9d
+  801065:	83 c2 37             	add    $0x37,%edx
+  801068:	41 88 10             	mov    %dl,(%r8)
+  80106b:	eb d4                	jmp    801041 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80106d:	41 83 eb 01          	sub    $0x1,%r11d
+  801071:	45 39 cb             	cmp    %r9d,%r11d
+  801074:	75 04                	jne    80107a <itoa+0x66>
+  801076:	85 c0                	test   %eax,%eax
+  801078:	75 28                	jne    8010a2 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80107a:	4d 63 c9             	movslq %r9d,%r9
+  80107d:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801082:	4c 89 d7             	mov    %r10,%rdi
+  801085:	48 b8 cd 0f 80 00 00 	movabs $0x800fcd,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+	return 0;
+  801091:	b8 00 00 00 00       	mov    $0x0,%eax
+  801096:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109a:	c9                   	leave
+  80109b:	c3                   	ret
+		return -1;
+  80109c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010a1:	c3                   	ret
+		return -1;
+  8010a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010a7:	eb ed                	jmp    801096 <itoa+0x82>
+
+00000000008010a9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010a9:	55                   	push   %rbp
+  8010aa:	48 89 e5             	mov    %rsp,%rbp
+  8010ad:	53                   	push   %rbx
+  8010ae:	48 89 fa             	mov    %rdi,%rdx
+  8010b1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ce:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d4:	c9                   	leave
+  8010d5:	c3                   	ret
+
+00000000008010d6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010d6:	55                   	push   %rbp
+  8010d7:	48 89 e5             	mov    %rsp,%rbp
+  8010da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010db:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ff:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801101:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+
+0000000000801107 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801107:	55                   	push   %rbp
+  801108:	48 89 e5             	mov    %rsp,%rbp
+  80110b:	53                   	push   %rbx
+  80110c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801110:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801113:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801118:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80111d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801122:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801127:	be 00 00 00 00       	mov    $0x0,%esi
+  80112c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801132:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801134:	48 85 c0             	test   %rax,%rax
+  801137:	7f 06                	jg     80113f <sys_env_destroy+0x38>
+}
+  801139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113d:	c9                   	leave
+  80113e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80113f:	49 89 c0             	mov    %rax,%r8
+  801142:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801147:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  80114e:	00 00 00 
+  801151:	be 26 00 00 00       	mov    $0x26,%esi
+  801156:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  80115d:	00 00 00 
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+  801165:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  80116c:	00 00 00 
+  80116f:	41 ff d1             	call   *%r9
+
+0000000000801172 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801172:	55                   	push   %rbp
+  801173:	48 89 e5             	mov    %rsp,%rbp
+  801176:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801177:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80117c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801181:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801190:	be 00 00 00 00       	mov    $0x0,%esi
+  801195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80119d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a1:	c9                   	leave
+  8011a2:	c3                   	ret
+
+00000000008011a3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011a3:	55                   	push   %rbp
+  8011a4:	48 89 e5             	mov    %rsp,%rbp
+  8011a7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+00000000008011d4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011d4:	55                   	push   %rbp
+  8011d5:	48 89 e5             	mov    %rsp,%rbp
+  8011d8:	53                   	push   %rbx
+  8011d9:	48 89 fa             	mov    %rdi,%rdx
+  8011dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011df:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011eb:	00 00 00 
+  8011ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fe:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801200:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+0000000000801206 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	53                   	push   %rbx
+  80120b:	49 89 f8             	mov    %rdi,%r8
+  80120e:	48 89 d3             	mov    %rdx,%rbx
+  801211:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801214:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801219:	4c 89 c2             	mov    %r8,%rdx
+  80121c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121f:	be 00 00 00 00       	mov    $0x0,%esi
+  801224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	53                   	push   %rbx
+  801237:	48 83 ec 08          	sub    $0x8,%rsp
+  80123b:	89 f8                	mov    %edi,%eax
+  80123d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801240:	48 63 f9             	movslq %ecx,%rdi
+  801243:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801246:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124e:	be 00 00 00 00       	mov    $0x0,%esi
+  801253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801259:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80125b:	48 85 c0             	test   %rax,%rax
+  80125e:	7f 06                	jg     801266 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801260:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801266:	49 89 c0             	mov    %rax,%r8
+  801269:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80126e:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801275:	00 00 00 
+  801278:	be 26 00 00 00       	mov    $0x26,%esi
+  80127d:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801284:	00 00 00 
+  801287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128c:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  801293:	00 00 00 
+  801296:	41 ff d1             	call   *%r9
+
+0000000000801299 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801299:	55                   	push   %rbp
+  80129a:	48 89 e5             	mov    %rsp,%rbp
+  80129d:	53                   	push   %rbx
+  80129e:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a2:	89 f8                	mov    %edi,%eax
+  8012a4:	49 89 f2             	mov    %rsi,%r10
+  8012a7:	48 89 cf             	mov    %rcx,%rdi
+  8012aa:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012ad:	48 63 da             	movslq %edx,%rbx
+  8012b0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bb:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c0:	48 85 c0             	test   %rax,%rax
+  8012c3:	7f 06                	jg     8012cb <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cb:	49 89 c0             	mov    %rax,%r8
+  8012ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012d3:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  8012da:	00 00 00 
+  8012dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e2:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  8012e9:	00 00 00 
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  8012f8:	00 00 00 
+  8012fb:	41 ff d1             	call   *%r9
+
+00000000008012fe <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+  801302:	53                   	push   %rbx
+  801303:	48 83 ec 08          	sub    $0x8,%rsp
+  801307:	48 89 f1             	mov    %rsi,%rcx
+  80130a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80130d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801310:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801315:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131a:	be 00 00 00 00       	mov    $0x0,%esi
+  80131f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801325:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801327:	48 85 c0             	test   %rax,%rax
+  80132a:	7f 06                	jg     801332 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80132c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801330:	c9                   	leave
+  801331:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801332:	49 89 c0             	mov    %rax,%r8
+  801335:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80133a:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801341:	00 00 00 
+  801344:	be 26 00 00 00       	mov    $0x26,%esi
+  801349:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801350:	00 00 00 
+  801353:	b8 00 00 00 00       	mov    $0x0,%eax
+  801358:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  80135f:	00 00 00 
+  801362:	41 ff d1             	call   *%r9
+
+0000000000801365 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	53                   	push   %rbx
+  80136a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80136e:	48 63 ce             	movslq %esi,%rcx
+  801371:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801374:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801383:	be 00 00 00 00       	mov    $0x0,%esi
+  801388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801390:	48 85 c0             	test   %rax,%rax
+  801393:	7f 06                	jg     80139b <sys_env_set_status+0x36>
+}
+  801395:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801399:	c9                   	leave
+  80139a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139b:	49 89 c0             	mov    %rax,%r8
+  80139e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013a3:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  8013aa:	00 00 00 
+  8013ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b2:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  8013b9:	00 00 00 
+  8013bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c1:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  8013c8:	00 00 00 
+  8013cb:	41 ff d1             	call   *%r9
+
+00000000008013ce <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013ce:	55                   	push   %rbp
+  8013cf:	48 89 e5             	mov    %rsp,%rbp
+  8013d2:	53                   	push   %rbx
+  8013d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f9:	48 85 c0             	test   %rax,%rax
+  8013fc:	7f 06                	jg     801404 <sys_env_set_trapframe+0x36>
+}
+  8013fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801402:	c9                   	leave
+  801403:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801404:	49 89 c0             	mov    %rax,%r8
+  801407:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80140c:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  801413:	00 00 00 
+  801416:	be 26 00 00 00       	mov    $0x26,%esi
+  80141b:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  801422:	00 00 00 
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142a:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  801431:	00 00 00 
+  801434:	41 ff d1             	call   *%r9
+
+0000000000801437 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801437:	55                   	push   %rbp
+  801438:	48 89 e5             	mov    %rsp,%rbp
+  80143b:	53                   	push   %rbx
+  80143c:	48 83 ec 08          	sub    $0x8,%rsp
+  801440:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801443:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801446:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+  80145a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801460:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801462:	48 85 c0             	test   %rax,%rax
+  801465:	7f 06                	jg     80146d <sys_env_set_pgfault_upcall+0x36>
+}
+  801467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146d:	49 89 c0             	mov    %rax,%r8
+  801470:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801475:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  80147c:	00 00 00 
+  80147f:	be 26 00 00 00       	mov    $0x26,%esi
+  801484:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  80148b:	00 00 00 
+  80148e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801493:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  80149a:	00 00 00 
+  80149d:	41 ff d1             	call   *%r9
+
+00000000008014a0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014a0:	55                   	push   %rbp
+  8014a1:	48 89 e5             	mov    %rsp,%rbp
+  8014a4:	53                   	push   %rbx
+  8014a5:	89 f8                	mov    %edi,%eax
+  8014a7:	49 89 f1             	mov    %rsi,%r9
+  8014aa:	48 89 d3             	mov    %rdx,%rbx
+  8014ad:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014b0:	49 63 f0             	movslq %r8d,%rsi
+  8014b3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014bb:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c4:	cd 30                	int    $0x30
+}
+  8014c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+
+00000000008014cc <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014cc:	55                   	push   %rbp
+  8014cd:	48 89 e5             	mov    %rsp,%rbp
+  8014d0:	53                   	push   %rbx
+  8014d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d5:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014d8:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014db:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f5:	48 85 c0             	test   %rax,%rax
+  8014f8:	7f 06                	jg     801500 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801500:	49 89 c0             	mov    %rax,%r8
+  801503:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801508:	48 ba 28 3d 80 00 00 	movabs $0x803d28,%rdx
+  80150f:	00 00 00 
+  801512:	be 26 00 00 00       	mov    $0x26,%esi
+  801517:	48 bf 47 3d 80 00 00 	movabs $0x803d47,%rdi
+  80151e:	00 00 00 
+  801521:	b8 00 00 00 00       	mov    $0x0,%eax
+  801526:	49 b9 93 34 80 00 00 	movabs $0x803493,%r9
+  80152d:	00 00 00 
+  801530:	41 ff d1             	call   *%r9
+
+0000000000801533 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801533:	55                   	push   %rbp
+  801534:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801537:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153c:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  801543:	00 00 00 
+  801546:	ff d0                	call   *%rax
+}
+  801548:	5d                   	pop    %rbp
+  801549:	c3                   	ret
+
+000000000080154a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80154a:	55                   	push   %rbp
+  80154b:	48 89 e5             	mov    %rsp,%rbp
+  80154e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80154f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801554:	ba 00 00 00 00       	mov    $0x0,%edx
+  801559:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801563:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801568:	be 00 00 00 00       	mov    $0x0,%esi
+  80156d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801573:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+
+000000000080157b <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801580:	48 63 ce             	movslq %esi,%rcx
+  801583:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801587:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801591:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801596:	be 00 00 00 00       	mov    $0x0,%esi
+  80159b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a1:	cd 30                	int    $0x30
+}
+  8015a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+00000000008015a9 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	53                   	push   %rbx
+  8015ae:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015b1:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cf:	cd 30                	int    $0x30
+}
+  8015d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+00000000008015d7 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	53                   	push   %rbx
+  8015dc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015df:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fa:	cd 30                	int    $0x30
+}
+  8015fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801600:	c9                   	leave
+  801601:	c3                   	ret
+
+0000000000801602 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801602:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801609:	ff ff ff 
+  80160c:	48 01 f8             	add    %rdi,%rax
+  80160f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801613:	c3                   	ret
+
+0000000000801614 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801614:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80161b:	ff ff ff 
+  80161e:	48 01 f8             	add    %rdi,%rax
+  801621:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801625:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80162b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80162f:	c3                   	ret
+
+0000000000801630 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801630:	55                   	push   %rbp
+  801631:	48 89 e5             	mov    %rsp,%rbp
+  801634:	41 57                	push   %r15
+  801636:	41 56                	push   %r14
+  801638:	41 55                	push   %r13
+  80163a:	41 54                	push   %r12
+  80163c:	53                   	push   %rbx
+  80163d:	48 83 ec 08          	sub    $0x8,%rsp
+  801641:	49 89 ff             	mov    %rdi,%r15
+  801644:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801649:	49 bd 4f 31 80 00 00 	movabs $0x80314f,%r13
+  801650:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801653:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801659:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80165c:	48 89 df             	mov    %rbx,%rdi
+  80165f:	41 ff d5             	call   *%r13
+  801662:	83 e0 04             	and    $0x4,%eax
+  801665:	74 17                	je     80167e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801667:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80166e:	4c 39 f3             	cmp    %r14,%rbx
+  801671:	75 e6                	jne    801659 <fd_alloc+0x29>
+  801673:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801679:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80167e:	4d 89 27             	mov    %r12,(%r15)
+}
+  801681:	48 83 c4 08          	add    $0x8,%rsp
+  801685:	5b                   	pop    %rbx
+  801686:	41 5c                	pop    %r12
+  801688:	41 5d                	pop    %r13
+  80168a:	41 5e                	pop    %r14
+  80168c:	41 5f                	pop    %r15
+  80168e:	5d                   	pop    %rbp
+  80168f:	c3                   	ret
+
+0000000000801690 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801690:	83 ff 1f             	cmp    $0x1f,%edi
+  801693:	77 39                	ja     8016ce <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	41 54                	push   %r12
+  80169b:	53                   	push   %rbx
+  80169c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80169f:	48 63 df             	movslq %edi,%rbx
+  8016a2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016a9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016ad:	48 89 df             	mov    %rbx,%rdi
+  8016b0:	48 b8 4f 31 80 00 00 	movabs $0x80314f,%rax
+  8016b7:	00 00 00 
+  8016ba:	ff d0                	call   *%rax
+  8016bc:	a8 04                	test   $0x4,%al
+  8016be:	74 14                	je     8016d4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016c0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016c9:	5b                   	pop    %rbx
+  8016ca:	41 5c                	pop    %r12
+  8016cc:	5d                   	pop    %rbp
+  8016cd:	c3                   	ret
+        return -E_INVAL;
+  8016ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016d3:	c3                   	ret
+        return -E_INVAL;
+  8016d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d9:	eb ee                	jmp    8016c9 <fd_lookup+0x39>
+
+00000000008016db <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	41 54                	push   %r12
+  8016e1:	53                   	push   %rbx
+  8016e2:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016e5:	48 b8 00 3e 80 00 00 	movabs $0x803e00,%rax
+  8016ec:	00 00 00 
+  8016ef:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8016f6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8016f9:	39 3b                	cmp    %edi,(%rbx)
+  8016fb:	74 47                	je     801744 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8016fd:	48 83 c0 08          	add    $0x8,%rax
+  801701:	48 8b 18             	mov    (%rax),%rbx
+  801704:	48 85 db             	test   %rbx,%rbx
+  801707:	75 f0                	jne    8016f9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801709:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801710:	00 00 00 
+  801713:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801719:	89 fa                	mov    %edi,%edx
+  80171b:	48 bf 58 3d 80 00 00 	movabs $0x803d58,%rdi
+  801722:	00 00 00 
+  801725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172a:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  801731:	00 00 00 
+  801734:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80173b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80173f:	5b                   	pop    %rbx
+  801740:	41 5c                	pop    %r12
+  801742:	5d                   	pop    %rbp
+  801743:	c3                   	ret
+            return 0;
+  801744:	b8 00 00 00 00       	mov    $0x0,%eax
+  801749:	eb f0                	jmp    80173b <dev_lookup+0x60>
+
+000000000080174b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+  80174f:	41 55                	push   %r13
+  801751:	41 54                	push   %r12
+  801753:	53                   	push   %rbx
+  801754:	48 83 ec 18          	sub    $0x18,%rsp
+  801758:	48 89 fb             	mov    %rdi,%rbx
+  80175b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80175e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801765:	ff ff ff 
+  801768:	48 01 df             	add    %rbx,%rdi
+  80176b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80176f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801773:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  80177a:	00 00 00 
+  80177d:	ff d0                	call   *%rax
+  80177f:	41 89 c5             	mov    %eax,%r13d
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 06                	js     80178c <fd_close+0x41>
+  801786:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80178a:	74 1a                	je     8017a6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80178c:	45 84 e4             	test   %r12b,%r12b
+  80178f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801794:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801798:	44 89 e8             	mov    %r13d,%eax
+  80179b:	48 83 c4 18          	add    $0x18,%rsp
+  80179f:	5b                   	pop    %rbx
+  8017a0:	41 5c                	pop    %r12
+  8017a2:	41 5d                	pop    %r13
+  8017a4:	5d                   	pop    %rbp
+  8017a5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017a6:	8b 3b                	mov    (%rbx),%edi
+  8017a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017ac:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+  8017b8:	41 89 c5             	mov    %eax,%r13d
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 1b                	js     8017da <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017c3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8017c7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017cd:	48 85 c0             	test   %rax,%rax
+  8017d0:	74 08                	je     8017da <fd_close+0x8f>
+  8017d2:	48 89 df             	mov    %rbx,%rdi
+  8017d5:	ff d0                	call   *%rax
+  8017d7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017df:	48 89 de             	mov    %rbx,%rsi
+  8017e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e7:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+    return res;
+  8017f3:	eb a3                	jmp    801798 <fd_close+0x4d>
+
+00000000008017f5 <close>:
+
+int
+close(int fdnum) {
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8017fd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801801:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	78 15                	js     801826 <close+0x31>
+
+    return fd_close(fd, 1);
+  801811:	be 01 00 00 00       	mov    $0x1,%esi
+  801816:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80181a:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  801821:	00 00 00 
+  801824:	ff d0                	call   *%rax
+}
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+0000000000801828 <close_all>:
+
+void
+close_all(void) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	41 54                	push   %r12
+  80182e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80182f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801834:	49 bc f5 17 80 00 00 	movabs $0x8017f5,%r12
+  80183b:	00 00 00 
+  80183e:	89 df                	mov    %ebx,%edi
+  801840:	41 ff d4             	call   *%r12
+  801843:	83 c3 01             	add    $0x1,%ebx
+  801846:	83 fb 20             	cmp    $0x20,%ebx
+  801849:	75 f3                	jne    80183e <close_all+0x16>
+}
+  80184b:	5b                   	pop    %rbx
+  80184c:	41 5c                	pop    %r12
+  80184e:	5d                   	pop    %rbp
+  80184f:	c3                   	ret
+
+0000000000801850 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+  801854:	41 57                	push   %r15
+  801856:	41 56                	push   %r14
+  801858:	41 55                	push   %r13
+  80185a:	41 54                	push   %r12
+  80185c:	53                   	push   %rbx
+  80185d:	48 83 ec 18          	sub    $0x18,%rsp
+  801861:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801864:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801868:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  80186f:	00 00 00 
+  801872:	ff d0                	call   *%rax
+  801874:	89 c3                	mov    %eax,%ebx
+  801876:	85 c0                	test   %eax,%eax
+  801878:	0f 88 b8 00 00 00    	js     801936 <dup+0xe6>
+    close(newfdnum);
+  80187e:	44 89 e7             	mov    %r12d,%edi
+  801881:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80188d:	4d 63 ec             	movslq %r12d,%r13
+  801890:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801897:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80189b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80189f:	4c 89 ff             	mov    %r15,%rdi
+  8018a2:	49 be 14 16 80 00 00 	movabs $0x801614,%r14
+  8018a9:	00 00 00 
+  8018ac:	41 ff d6             	call   *%r14
+  8018af:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018b2:	4c 89 ef             	mov    %r13,%rdi
+  8018b5:	41 ff d6             	call   *%r14
+  8018b8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018bb:	48 89 df             	mov    %rbx,%rdi
+  8018be:	48 b8 4f 31 80 00 00 	movabs $0x80314f,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018ca:	a8 04                	test   $0x4,%al
+  8018cc:	74 2b                	je     8018f9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018ce:	41 89 c1             	mov    %eax,%r9d
+  8018d1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018d7:	4c 89 f1             	mov    %r14,%rcx
+  8018da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018df:	48 89 de             	mov    %rbx,%rsi
+  8018e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e7:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  8018ee:	00 00 00 
+  8018f1:	ff d0                	call   *%rax
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	78 4e                	js     801947 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8018f9:	4c 89 ff             	mov    %r15,%rdi
+  8018fc:	48 b8 4f 31 80 00 00 	movabs $0x80314f,%rax
+  801903:	00 00 00 
+  801906:	ff d0                	call   *%rax
+  801908:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80190b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801911:	4c 89 e9             	mov    %r13,%rcx
+  801914:	ba 00 00 00 00       	mov    $0x0,%edx
+  801919:	4c 89 fe             	mov    %r15,%rsi
+  80191c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801921:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  801928:	00 00 00 
+  80192b:	ff d0                	call   *%rax
+  80192d:	89 c3                	mov    %eax,%ebx
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	78 14                	js     801947 <dup+0xf7>
+
+    return newfdnum;
+  801933:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801936:	89 d8                	mov    %ebx,%eax
+  801938:	48 83 c4 18          	add    $0x18,%rsp
+  80193c:	5b                   	pop    %rbx
+  80193d:	41 5c                	pop    %r12
+  80193f:	41 5d                	pop    %r13
+  801941:	41 5e                	pop    %r14
+  801943:	41 5f                	pop    %r15
+  801945:	5d                   	pop    %rbp
+  801946:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801947:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80194c:	4c 89 ee             	mov    %r13,%rsi
+  80194f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801954:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  80195b:	00 00 00 
+  80195e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801961:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801966:	4c 89 f6             	mov    %r14,%rsi
+  801969:	bf 00 00 00 00       	mov    $0x0,%edi
+  80196e:	41 ff d4             	call   *%r12
+    return res;
+  801971:	eb c3                	jmp    801936 <dup+0xe6>
+
+0000000000801973 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+  801977:	41 56                	push   %r14
+  801979:	41 55                	push   %r13
+  80197b:	41 54                	push   %r12
+  80197d:	53                   	push   %rbx
+  80197e:	48 83 ec 10          	sub    $0x10,%rsp
+  801982:	89 fb                	mov    %edi,%ebx
+  801984:	49 89 f4             	mov    %rsi,%r12
+  801987:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80198a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80198e:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	78 4c                	js     8019ea <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80199e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019a2:	41 8b 3e             	mov    (%r14),%edi
+  8019a5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019a9:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 35                	js     8019ee <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019b9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019bd:	83 e0 03             	and    $0x3,%eax
+  8019c0:	83 f8 01             	cmp    $0x1,%eax
+  8019c3:	74 2d                	je     8019f2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019c9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019cd:	48 85 c0             	test   %rax,%rax
+  8019d0:	74 56                	je     801a28 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019d2:	4c 89 ea             	mov    %r13,%rdx
+  8019d5:	4c 89 e6             	mov    %r12,%rsi
+  8019d8:	4c 89 f7             	mov    %r14,%rdi
+  8019db:	ff d0                	call   *%rax
+}
+  8019dd:	48 83 c4 10          	add    $0x10,%rsp
+  8019e1:	5b                   	pop    %rbx
+  8019e2:	41 5c                	pop    %r12
+  8019e4:	41 5d                	pop    %r13
+  8019e6:	41 5e                	pop    %r14
+  8019e8:	5d                   	pop    %rbp
+  8019e9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019ea:	48 98                	cltq
+  8019ec:	eb ef                	jmp    8019dd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ee:	48 98                	cltq
+  8019f0:	eb eb                	jmp    8019dd <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019f2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019f9:	00 00 00 
+  8019fc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a02:	89 da                	mov    %ebx,%edx
+  801a04:	48 bf b9 3d 80 00 00 	movabs $0x803db9,%rdi
+  801a0b:	00 00 00 
+  801a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a13:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  801a1a:	00 00 00 
+  801a1d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a1f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a26:	eb b5                	jmp    8019dd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a28:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a2f:	eb ac                	jmp    8019dd <read+0x6a>
+
+0000000000801a31 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a31:	55                   	push   %rbp
+  801a32:	48 89 e5             	mov    %rsp,%rbp
+  801a35:	41 56                	push   %r14
+  801a37:	41 55                	push   %r13
+  801a39:	41 54                	push   %r12
+  801a3b:	53                   	push   %rbx
+  801a3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a40:	89 fb                	mov    %edi,%ebx
+  801a42:	49 89 f4             	mov    %rsi,%r12
+  801a45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a4c:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	78 41                	js     801a9d <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a60:	41 8b 3e             	mov    (%r14),%edi
+  801a63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a67:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801a6e:	00 00 00 
+  801a71:	ff d0                	call   *%rax
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	78 35                	js     801aac <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a77:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a7b:	83 e0 03             	and    $0x3,%eax
+  801a7e:	83 f8 01             	cmp    $0x1,%eax
+  801a81:	74 2d                	je     801ab0 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a87:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a8b:	48 85 c0             	test   %rax,%rax
+  801a8e:	74 56                	je     801ae6 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801a90:	4c 89 ea             	mov    %r13,%rdx
+  801a93:	4c 89 e6             	mov    %r12,%rsi
+  801a96:	4c 89 f7             	mov    %r14,%rdi
+  801a99:	ff d0                	call   *%rax
+  801a9b:	eb 02                	jmp    801a9f <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a9d:	48 98                	cltq
+}
+  801a9f:	48 83 c4 10          	add    $0x10,%rsp
+  801aa3:	5b                   	pop    %rbx
+  801aa4:	41 5c                	pop    %r12
+  801aa6:	41 5d                	pop    %r13
+  801aa8:	41 5e                	pop    %r14
+  801aaa:	5d                   	pop    %rbp
+  801aab:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aac:	48 98                	cltq
+  801aae:	eb ef                	jmp    801a9f <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ab0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ab7:	00 00 00 
+  801aba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ac0:	89 da                	mov    %ebx,%edx
+  801ac2:	48 bf 78 3d 80 00 00 	movabs $0x803d78,%rdi
+  801ac9:	00 00 00 
+  801acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad1:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  801ad8:	00 00 00 
+  801adb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801add:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ae4:	eb b9                	jmp    801a9f <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801ae6:	4c 89 ea             	mov    %r13,%rdx
+  801ae9:	4c 89 e6             	mov    %r12,%rsi
+  801aec:	89 df                	mov    %ebx,%edi
+  801aee:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+  801afa:	eb a3                	jmp    801a9f <readmap+0x6e>
+
+0000000000801afc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801afc:	55                   	push   %rbp
+  801afd:	48 89 e5             	mov    %rsp,%rbp
+  801b00:	41 57                	push   %r15
+  801b02:	41 56                	push   %r14
+  801b04:	41 55                	push   %r13
+  801b06:	41 54                	push   %r12
+  801b08:	53                   	push   %rbx
+  801b09:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b0d:	48 85 d2             	test   %rdx,%rdx
+  801b10:	74 54                	je     801b66 <readn+0x6a>
+  801b12:	41 89 fd             	mov    %edi,%r13d
+  801b15:	49 89 f6             	mov    %rsi,%r14
+  801b18:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b20:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b25:	49 bf 73 19 80 00 00 	movabs $0x801973,%r15
+  801b2c:	00 00 00 
+  801b2f:	4c 89 e2             	mov    %r12,%rdx
+  801b32:	48 29 f2             	sub    %rsi,%rdx
+  801b35:	4c 01 f6             	add    %r14,%rsi
+  801b38:	44 89 ef             	mov    %r13d,%edi
+  801b3b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	78 20                	js     801b62 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b42:	01 c3                	add    %eax,%ebx
+  801b44:	85 c0                	test   %eax,%eax
+  801b46:	74 08                	je     801b50 <readn+0x54>
+  801b48:	48 63 f3             	movslq %ebx,%rsi
+  801b4b:	4c 39 e6             	cmp    %r12,%rsi
+  801b4e:	72 df                	jb     801b2f <readn+0x33>
+    }
+    return res;
+  801b50:	48 63 c3             	movslq %ebx,%rax
+}
+  801b53:	48 83 c4 08          	add    $0x8,%rsp
+  801b57:	5b                   	pop    %rbx
+  801b58:	41 5c                	pop    %r12
+  801b5a:	41 5d                	pop    %r13
+  801b5c:	41 5e                	pop    %r14
+  801b5e:	41 5f                	pop    %r15
+  801b60:	5d                   	pop    %rbp
+  801b61:	c3                   	ret
+        if (inc < 0) return inc;
+  801b62:	48 98                	cltq
+  801b64:	eb ed                	jmp    801b53 <readn+0x57>
+    int inc = 1, res = 0;
+  801b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6b:	eb e3                	jmp    801b50 <readn+0x54>
+
+0000000000801b6d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b6d:	55                   	push   %rbp
+  801b6e:	48 89 e5             	mov    %rsp,%rbp
+  801b71:	41 56                	push   %r14
+  801b73:	41 55                	push   %r13
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+  801b78:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7c:	89 fb                	mov    %edi,%ebx
+  801b7e:	49 89 f4             	mov    %rsi,%r12
+  801b81:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b84:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b88:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801b8f:	00 00 00 
+  801b92:	ff d0                	call   *%rax
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	78 47                	js     801bdf <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b98:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b9c:	41 8b 3e             	mov    (%r14),%edi
+  801b9f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ba3:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801baa:	00 00 00 
+  801bad:	ff d0                	call   *%rax
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	78 30                	js     801be3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bb3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bb8:	74 2d                	je     801be7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bbe:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bc2:	48 85 c0             	test   %rax,%rax
+  801bc5:	74 56                	je     801c1d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bc7:	4c 89 ea             	mov    %r13,%rdx
+  801bca:	4c 89 e6             	mov    %r12,%rsi
+  801bcd:	4c 89 f7             	mov    %r14,%rdi
+  801bd0:	ff d0                	call   *%rax
+}
+  801bd2:	48 83 c4 10          	add    $0x10,%rsp
+  801bd6:	5b                   	pop    %rbx
+  801bd7:	41 5c                	pop    %r12
+  801bd9:	41 5d                	pop    %r13
+  801bdb:	41 5e                	pop    %r14
+  801bdd:	5d                   	pop    %rbp
+  801bde:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bdf:	48 98                	cltq
+  801be1:	eb ef                	jmp    801bd2 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801be3:	48 98                	cltq
+  801be5:	eb eb                	jmp    801bd2 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bee:	00 00 00 
+  801bf1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bf7:	89 da                	mov    %ebx,%edx
+  801bf9:	48 bf d5 3d 80 00 00 	movabs $0x803dd5,%rdi
+  801c00:	00 00 00 
+  801c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c08:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  801c0f:	00 00 00 
+  801c12:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c14:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c1b:	eb b5                	jmp    801bd2 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c1d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c24:	eb ac                	jmp    801bd2 <write+0x65>
+
+0000000000801c26 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c26:	55                   	push   %rbp
+  801c27:	48 89 e5             	mov    %rsp,%rbp
+  801c2a:	53                   	push   %rbx
+  801c2b:	48 83 ec 18          	sub    $0x18,%rsp
+  801c2f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c35:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	78 0c                	js     801c51 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c49:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c55:	c9                   	leave
+  801c56:	c3                   	ret
+
+0000000000801c57 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c57:	55                   	push   %rbp
+  801c58:	48 89 e5             	mov    %rsp,%rbp
+  801c5b:	41 55                	push   %r13
+  801c5d:	41 54                	push   %r12
+  801c5f:	53                   	push   %rbx
+  801c60:	48 83 ec 18          	sub    $0x18,%rsp
+  801c64:	89 fb                	mov    %edi,%ebx
+  801c66:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c69:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c6d:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 38                	js     801cb5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c7d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c81:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c85:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c89:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801c90:	00 00 00 
+  801c93:	ff d0                	call   *%rax
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	78 1c                	js     801cb5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c99:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c9e:	74 20                	je     801cc0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ca0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ca4:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801ca8:	48 85 c0             	test   %rax,%rax
+  801cab:	74 47                	je     801cf4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cad:	44 89 e6             	mov    %r12d,%esi
+  801cb0:	4c 89 ef             	mov    %r13,%rdi
+  801cb3:	ff d0                	call   *%rax
+}
+  801cb5:	48 83 c4 18          	add    $0x18,%rsp
+  801cb9:	5b                   	pop    %rbx
+  801cba:	41 5c                	pop    %r12
+  801cbc:	41 5d                	pop    %r13
+  801cbe:	5d                   	pop    %rbp
+  801cbf:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cc0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cc7:	00 00 00 
+  801cca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cd0:	89 da                	mov    %ebx,%edx
+  801cd2:	48 bf 98 3d 80 00 00 	movabs $0x803d98,%rdi
+  801cd9:	00 00 00 
+  801cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce1:	48 b9 81 02 80 00 00 	movabs $0x800281,%rcx
+  801ce8:	00 00 00 
+  801ceb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ced:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf2:	eb c1                	jmp    801cb5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cf4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cf9:	eb ba                	jmp    801cb5 <ftruncate+0x5e>
+
+0000000000801cfb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801cfb:	55                   	push   %rbp
+  801cfc:	48 89 e5             	mov    %rsp,%rbp
+  801cff:	41 54                	push   %r12
+  801d01:	53                   	push   %rbx
+  801d02:	48 83 ec 10          	sub    $0x10,%rsp
+  801d06:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d09:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d0d:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  801d14:	00 00 00 
+  801d17:	ff d0                	call   *%rax
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	78 4e                	js     801d6b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d1d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d21:	41 8b 3c 24          	mov    (%r12),%edi
+  801d25:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d29:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801d30:	00 00 00 
+  801d33:	ff d0                	call   *%rax
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 32                	js     801d6b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d3d:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d42:	74 30                	je     801d74 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d44:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d47:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d4e:	00 00 00 
+    stat->st_isdir = 0;
+  801d51:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d58:	00 00 00 
+    stat->st_dev = dev;
+  801d5b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d62:	48 89 de             	mov    %rbx,%rsi
+  801d65:	4c 89 e7             	mov    %r12,%rdi
+  801d68:	ff 50 30             	call   *0x30(%rax)
+}
+  801d6b:	48 83 c4 10          	add    $0x10,%rsp
+  801d6f:	5b                   	pop    %rbx
+  801d70:	41 5c                	pop    %r12
+  801d72:	5d                   	pop    %rbp
+  801d73:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d74:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d79:	eb f0                	jmp    801d6b <fstat+0x70>
+
+0000000000801d7b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	41 54                	push   %r12
+  801d81:	53                   	push   %rbx
+  801d82:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d85:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8a:	48 b8 d2 2a 80 00 00 	movabs $0x802ad2,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+  801d96:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 25                	js     801dc1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d9c:	4c 89 e6             	mov    %r12,%rsi
+  801d9f:	89 c7                	mov    %eax,%edi
+  801da1:	48 b8 fb 1c 80 00 00 	movabs $0x801cfb,%rax
+  801da8:	00 00 00 
+  801dab:	ff d0                	call   *%rax
+  801dad:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801db0:	89 df                	mov    %ebx,%edi
+  801db2:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+
+    return res;
+  801dbe:	44 89 e3             	mov    %r12d,%ebx
+}
+  801dc1:	89 d8                	mov    %ebx,%eax
+  801dc3:	5b                   	pop    %rbx
+  801dc4:	41 5c                	pop    %r12
+  801dc6:	5d                   	pop    %rbp
+  801dc7:	c3                   	ret
+
+0000000000801dc8 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801dc8:	55                   	push   %rbp
+  801dc9:	48 89 e5             	mov    %rsp,%rbp
+  801dcc:	41 54                	push   %r12
+  801dce:	53                   	push   %rbx
+  801dcf:	48 83 ec 10          	sub    $0x10,%rsp
+  801dd3:	48 89 fb             	mov    %rdi,%rbx
+  801dd6:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dd9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ddd:	bf 66 00 00 00       	mov    $0x66,%edi
+  801de2:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801de9:	00 00 00 
+  801dec:	ff d0                	call   *%rax
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	78 1f                	js     801e11 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801df2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801df6:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801dfa:	48 85 c0             	test   %rax,%rax
+  801dfd:	74 1b                	je     801e1a <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801dff:	4c 89 e6             	mov    %r12,%rsi
+  801e02:	48 89 df             	mov    %rbx,%rdi
+  801e05:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e07:	85 c0                	test   %eax,%eax
+  801e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e11:	48 83 c4 10          	add    $0x10,%rsp
+  801e15:	5b                   	pop    %rbx
+  801e16:	41 5c                	pop    %r12
+  801e18:	5d                   	pop    %rbp
+  801e19:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e1a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e1f:	eb f0                	jmp    801e11 <create_snapshot+0x49>
+
+0000000000801e21 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801e21:	55                   	push   %rbp
+  801e22:	48 89 e5             	mov    %rsp,%rbp
+  801e25:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e29:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e2d:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e32:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801e39:	00 00 00 
+  801e3c:	ff d0                	call   *%rax
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 1e                	js     801e60 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e46:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e4a:	48 85 d2             	test   %rdx,%rdx
+  801e4d:	74 13                	je     801e62 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e54:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e60:	c9                   	leave
+  801e61:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e67:	eb f7                	jmp    801e60 <print_snapshot_list+0x3f>
+
+0000000000801e69 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801e69:	55                   	push   %rbp
+  801e6a:	48 89 e5             	mov    %rsp,%rbp
+  801e6d:	53                   	push   %rbx
+  801e6e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e72:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e75:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e79:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e7e:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801e85:	00 00 00 
+  801e88:	ff d0                	call   *%rax
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 1c                	js     801eaa <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801e8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e92:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801e96:	48 85 c0             	test   %rax,%rax
+  801e99:	74 15                	je     801eb0 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801e9b:	48 89 df             	mov    %rbx,%rdi
+  801e9e:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801eaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eae:	c9                   	leave
+  801eaf:	c3                   	ret
+        return -E_NOT_SUPP;
+  801eb0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eb5:	eb f3                	jmp    801eaa <accept_snapshot+0x41>
+
+0000000000801eb7 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	53                   	push   %rbx
+  801ebc:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec0:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ec3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ec7:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ecc:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 1c                	js     801ef8 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801edc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ee0:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801ee4:	48 85 c0             	test   %rax,%rax
+  801ee7:	74 15                	je     801efe <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801ee9:	48 89 df             	mov    %rbx,%rdi
+  801eec:	ff d0                	call   *%rax
+    if (res < 0) {
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef5:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ef8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801efc:	c9                   	leave
+  801efd:	c3                   	ret
+        return -E_NOT_SUPP;
+  801efe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f03:	eb f3                	jmp    801ef8 <delete_snapshot+0x41>
+
+0000000000801f05 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f0d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f11:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f16:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 14                	js     801f3a <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801f26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f2a:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f2e:	48 85 d2             	test   %rdx,%rdx
+  801f31:	74 09                	je     801f3c <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f3a:	c9                   	leave
+  801f3b:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f3c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f41:	eb f7                	jmp    801f3a <gc_snapshots+0x35>
+
+0000000000801f43 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f43:	55                   	push   %rbp
+  801f44:	48 89 e5             	mov    %rsp,%rbp
+  801f47:	41 56                	push   %r14
+  801f49:	41 55                	push   %r13
+  801f4b:	41 54                	push   %r12
+  801f4d:	53                   	push   %rbx
+  801f4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f52:	48 89 fb             	mov    %rdi,%rbx
+  801f55:	49 89 f4             	mov    %rsi,%r12
+  801f58:	49 89 d5             	mov    %rdx,%r13
+  801f5b:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f5e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f62:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f67:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 1b                	js     801f92 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801f77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f7b:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801f7f:	48 85 c0             	test   %rax,%rax
+  801f82:	74 1b                	je     801f9f <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801f84:	4c 89 f1             	mov    %r14,%rcx
+  801f87:	4c 89 ea             	mov    %r13,%rdx
+  801f8a:	4c 89 e6             	mov    %r12,%rsi
+  801f8d:	48 89 df             	mov    %rbx,%rdi
+  801f90:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f92:	48 83 c4 10          	add    $0x10,%rsp
+  801f96:	5b                   	pop    %rbx
+  801f97:	41 5c                	pop    %r12
+  801f99:	41 5d                	pop    %r13
+  801f9b:	41 5e                	pop    %r14
+  801f9d:	5d                   	pop    %rbp
+  801f9e:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f9f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fa4:	eb ec                	jmp    801f92 <diff_snapshots+0x4f>
+
+0000000000801fa6 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+  801faa:	41 55                	push   %r13
+  801fac:	41 54                	push   %r12
+  801fae:	53                   	push   %rbx
+  801faf:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb3:	48 89 fb             	mov    %rdi,%rbx
+  801fb6:	49 89 f4             	mov    %rsi,%r12
+  801fb9:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fbc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc0:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc5:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 18                	js     801fed <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801fd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd9:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801fdd:	48 85 c0             	test   %rax,%rax
+  801fe0:	74 16                	je     801ff8 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801fe2:	4c 89 ea             	mov    %r13,%rdx
+  801fe5:	4c 89 e6             	mov    %r12,%rsi
+  801fe8:	48 89 df             	mov    %rbx,%rdi
+  801feb:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fed:	48 83 c4 18          	add    $0x18,%rsp
+  801ff1:	5b                   	pop    %rbx
+  801ff2:	41 5c                	pop    %r12
+  801ff4:	41 5d                	pop    %r13
+  801ff6:	5d                   	pop    %rbp
+  801ff7:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ff8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ffd:	eb ee                	jmp    801fed <send_snapshot+0x47>
+
+0000000000801fff <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+  802003:	53                   	push   %rbx
+  802004:	48 83 ec 18          	sub    $0x18,%rsp
+  802008:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80200b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80200f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802014:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+  802020:	85 c0                	test   %eax,%eax
+  802022:	78 12                	js     802036 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802024:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802028:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80202c:	48 85 c0             	test   %rax,%rax
+  80202f:	74 0b                	je     80203c <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802031:	48 89 df             	mov    %rbx,%rdi
+  802034:	ff d0                	call   *%rax
+
+    return res;
+}
+  802036:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80203c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802041:	eb f3                	jmp    802036 <receive_snapshot+0x37>
+
+0000000000802043 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  802047:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80204b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80204f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802054:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	85 c0                	test   %eax,%eax
+  802062:	78 17                	js     80207b <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802068:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  80206f:	48 85 d2             	test   %rdx,%rdx
+  802072:	74 09                	je     80207d <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802074:	b8 00 00 00 00       	mov    $0x0,%eax
+  802079:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80207b:	c9                   	leave
+  80207c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80207d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802082:	eb f7                	jmp    80207b <free_space_bytes+0x38>
+
+0000000000802084 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802084:	55                   	push   %rbp
+  802085:	48 89 e5             	mov    %rsp,%rbp
+  802088:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80208c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802090:	bf 66 00 00 00       	mov    $0x66,%edi
+  802095:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80209c:	00 00 00 
+  80209f:	ff d0                	call   *%rax
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 17                	js     8020bc <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8020a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020a9:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8020b0:	48 85 d2             	test   %rdx,%rdx
+  8020b3:	74 09                	je     8020be <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8020b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ba:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020be:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c3:	eb f7                	jmp    8020bc <busy_space_bytes+0x38>
+
+00000000008020c5 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8020c5:	55                   	push   %rbp
+  8020c6:	48 89 e5             	mov    %rsp,%rbp
+  8020c9:	41 54                	push   %r12
+  8020cb:	53                   	push   %rbx
+  8020cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d0:	89 fb                	mov    %edi,%ebx
+  8020d2:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020d5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020de:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	85 c0                	test   %eax,%eax
+  8020ec:	78 17                	js     802105 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8020ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f2:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8020f9:	48 85 c0             	test   %rax,%rax
+  8020fc:	74 10                	je     80210e <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8020fe:	4c 89 e6             	mov    %r12,%rsi
+  802101:	89 df                	mov    %ebx,%edi
+  802103:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802105:	48 83 c4 10          	add    $0x10,%rsp
+  802109:	5b                   	pop    %rbx
+  80210a:	41 5c                	pop    %r12
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80210e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802113:	eb f0                	jmp    802105 <snapshots_space+0x40>
+
+0000000000802115 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802115:	55                   	push   %rbp
+  802116:	48 89 e5             	mov    %rsp,%rbp
+  802119:	41 55                	push   %r13
+  80211b:	41 54                	push   %r12
+  80211d:	53                   	push   %rbx
+  80211e:	48 83 ec 08          	sub    $0x8,%rsp
+  802122:	41 89 fd             	mov    %edi,%r13d
+  802125:	48 89 f3             	mov    %rsi,%rbx
+  802128:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80212b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802132:	00 00 00 
+  802135:	83 38 00             	cmpl   $0x0,(%rax)
+  802138:	74 57                	je     802191 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80213a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802140:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802145:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80214c:	00 00 00 
+  80214f:	44 89 ee             	mov    %r13d,%esi
+  802152:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802159:	00 00 00 
+  80215c:	8b 38                	mov    (%rax),%edi
+  80215e:	48 b8 35 36 80 00 00 	movabs $0x803635,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80216a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216f:	4c 89 e2             	mov    %r12,%rdx
+  802172:	48 89 de             	mov    %rbx,%rsi
+  802175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217a:	48 b8 1d 36 80 00 00 	movabs $0x80361d,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+}
+  802186:	48 83 c4 08          	add    $0x8,%rsp
+  80218a:	5b                   	pop    %rbx
+  80218b:	41 5c                	pop    %r12
+  80218d:	41 5d                	pop    %r13
+  80218f:	5d                   	pop    %rbp
+  802190:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802191:	bf 03 00 00 00       	mov    $0x3,%edi
+  802196:	48 b8 f3 36 80 00 00 	movabs $0x8036f3,%rax
+  80219d:	00 00 00 
+  8021a0:	ff d0                	call   *%rax
+  8021a2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021a9:	00 00 
+  8021ab:	eb 8d                	jmp    80213a <fsipc_region+0x25>
+
+00000000008021ad <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8021ad:	55                   	push   %rbp
+  8021ae:	48 89 e5             	mov    %rsp,%rbp
+  8021b1:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8021b5:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8021bc:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8021bd:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8021c1:	48 b8 15 21 80 00 00 	movabs $0x802115,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+}
+  8021cd:	c9                   	leave
+  8021ce:	c3                   	ret
+
+00000000008021cf <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8021cf:	85 ff                	test   %edi,%edi
+  8021d1:	78 6d                	js     802240 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	41 54                	push   %r12
+  8021d9:	53                   	push   %rbx
+  8021da:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8021dd:	48 85 f6             	test   %rsi,%rsi
+  8021e0:	74 57                	je     802239 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8021e2:	89 f8                	mov    %edi,%eax
+  8021e4:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021eb:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8021ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f2:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021f7:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8021fe:	00 00 00 
+  802201:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 2d                	js     802234 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802207:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80220e:	00 00 00 
+  802211:	49 63 14 24          	movslq (%r12),%rdx
+  802215:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80221c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802221:	48 89 df             	mov    %rbx,%rdi
+  802224:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802230:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802234:	5b                   	pop    %rbx
+  802235:	41 5c                	pop    %r12
+  802237:	5d                   	pop    %rbp
+  802238:	c3                   	ret
+        return -E_INVAL;
+  802239:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223e:	eb f4                	jmp    802234 <devfile_df_snapshots+0x65>
+  802240:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802245:	c3                   	ret
+
+0000000000802246 <devfile_df_busy>:
+devfile_df_busy() {
+  802246:	55                   	push   %rbp
+  802247:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80224a:	be 00 00 00 00       	mov    $0x0,%esi
+  80224f:	bf 11 00 00 00       	mov    $0x11,%edi
+  802254:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+}
+  802260:	5d                   	pop    %rbp
+  802261:	c3                   	ret
+
+0000000000802262 <devfile_df_free>:
+devfile_df_free() {
+  802262:	55                   	push   %rbp
+  802263:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802266:	be 00 00 00 00       	mov    $0x0,%esi
+  80226b:	bf 10 00 00 00       	mov    $0x10,%edi
+  802270:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802277:	00 00 00 
+  80227a:	ff d0                	call   *%rax
+}
+  80227c:	5d                   	pop    %rbp
+  80227d:	c3                   	ret
+
+000000000080227e <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802282:	be 00 00 00 00       	mov    $0x0,%esi
+  802287:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80228c:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+}
+  802298:	5d                   	pop    %rbp
+  802299:	c3                   	ret
+
+000000000080229a <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80229a:	55                   	push   %rbp
+  80229b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80229e:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8022a8:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022bb:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8022be:	5d                   	pop    %rbp
+  8022bf:	c3                   	ret
+
+00000000008022c0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022c0:	55                   	push   %rbp
+  8022c1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022c4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022cb:	00 00 00 
+  8022ce:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022d1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022d3:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022db:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022e0:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8022e7:	00 00 00 
+  8022ea:	ff d0                	call   *%rax
+}
+  8022ec:	5d                   	pop    %rbp
+  8022ed:	c3                   	ret
+
+00000000008022ee <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022ee:	55                   	push   %rbp
+  8022ef:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022f2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022f5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022fc:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802303:	bf 06 00 00 00       	mov    $0x6,%edi
+  802308:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+}
+  802314:	5d                   	pop    %rbp
+  802315:	c3                   	ret
+
+0000000000802316 <devfile_write>:
+    if (!fd || !buf) {
+  802316:	48 85 ff             	test   %rdi,%rdi
+  802319:	0f 84 c1 00 00 00    	je     8023e0 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80231f:	55                   	push   %rbp
+  802320:	48 89 e5             	mov    %rsp,%rbp
+  802323:	41 57                	push   %r15
+  802325:	41 56                	push   %r14
+  802327:	41 55                	push   %r13
+  802329:	41 54                	push   %r12
+  80232b:	53                   	push   %rbx
+  80232c:	48 83 ec 18          	sub    $0x18,%rsp
+  802330:	49 89 ff             	mov    %rdi,%r15
+  802333:	49 89 f5             	mov    %rsi,%r13
+  802336:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802339:	48 85 f6             	test   %rsi,%rsi
+  80233c:	0f 84 95 00 00 00    	je     8023d7 <devfile_write+0xc1>
+    while (n) {
+  802342:	48 85 d2             	test   %rdx,%rdx
+  802345:	0f 84 83 00 00 00    	je     8023ce <devfile_write+0xb8>
+    int totalWrite = 0;
+  80234b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802352:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802359:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80235c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802361:	49 39 dc             	cmp    %rbx,%r12
+  802364:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802368:	48 89 da             	mov    %rbx,%rdx
+  80236b:	4c 89 ee             	mov    %r13,%rsi
+  80236e:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802375:	00 00 00 
+  802378:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802384:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802388:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80238b:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80238f:	be 00 00 00 00       	mov    $0x0,%esi
+  802394:	bf 04 00 00 00       	mov    $0x4,%edi
+  802399:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+        if (write < 0) {
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 21                	js     8023ca <devfile_write+0xb4>
+        buf += write;
+  8023a9:	48 63 d0             	movslq %eax,%rdx
+  8023ac:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8023af:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8023b2:	49 29 d4             	sub    %rdx,%r12
+  8023b5:	75 a5                	jne    80235c <devfile_write+0x46>
+    return totalWrite;
+  8023b7:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8023bb:	48 83 c4 18          	add    $0x18,%rsp
+  8023bf:	5b                   	pop    %rbx
+  8023c0:	41 5c                	pop    %r12
+  8023c2:	41 5d                	pop    %r13
+  8023c4:	41 5e                	pop    %r14
+  8023c6:	41 5f                	pop    %r15
+  8023c8:	5d                   	pop    %rbp
+  8023c9:	c3                   	ret
+            return write;
+  8023ca:	48 98                	cltq
+  8023cc:	eb ed                	jmp    8023bb <devfile_write+0xa5>
+    int totalWrite = 0;
+  8023ce:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8023d5:	eb e0                	jmp    8023b7 <devfile_write+0xa1>
+        return -E_INVAL;
+  8023d7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023de:	eb db                	jmp    8023bb <devfile_write+0xa5>
+  8023e0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023e7:	c3                   	ret
+
+00000000008023e8 <devfile_read>:
+    if (!fd || !buf) {
+  8023e8:	48 85 ff             	test   %rdi,%rdi
+  8023eb:	0f 84 c0 00 00 00    	je     8024b1 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023f1:	55                   	push   %rbp
+  8023f2:	48 89 e5             	mov    %rsp,%rbp
+  8023f5:	41 57                	push   %r15
+  8023f7:	41 56                	push   %r14
+  8023f9:	41 55                	push   %r13
+  8023fb:	41 54                	push   %r12
+  8023fd:	53                   	push   %rbx
+  8023fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802402:	49 89 ff             	mov    %rdi,%r15
+  802405:	49 89 f5             	mov    %rsi,%r13
+  802408:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80240b:	48 85 f6             	test   %rsi,%rsi
+  80240e:	0f 84 96 00 00 00    	je     8024aa <devfile_read+0xc2>
+    while (n) {
+  802414:	48 85 d2             	test   %rdx,%rdx
+  802417:	0f 84 87 00 00 00    	je     8024a4 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80241d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802424:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802425:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80242c:	00 00 00 
+  80242f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802433:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802436:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80243b:	49 39 c4             	cmp    %rax,%r12
+  80243e:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802442:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802446:	be 00 00 00 00       	mov    $0x0,%esi
+  80244b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802450:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	7e 37                	jle    802497 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802460:	48 63 d8             	movslq %eax,%rbx
+  802463:	48 89 da             	mov    %rbx,%rdx
+  802466:	4c 89 f6             	mov    %r14,%rsi
+  802469:	4c 89 ef             	mov    %r13,%rdi
+  80246c:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+        buf += read;
+  802478:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80247b:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80247f:	49 29 dc             	sub    %rbx,%r12
+  802482:	75 ab                	jne    80242f <devfile_read+0x47>
+  return totalRead;
+  802484:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802488:	48 83 c4 18          	add    $0x18,%rsp
+  80248c:	5b                   	pop    %rbx
+  80248d:	41 5c                	pop    %r12
+  80248f:	41 5d                	pop    %r13
+  802491:	41 5e                	pop    %r14
+  802493:	41 5f                	pop    %r15
+  802495:	5d                   	pop    %rbp
+  802496:	c3                   	ret
+            return read ? read : totalRead;
+  802497:	48 63 d0             	movslq %eax,%rdx
+  80249a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80249e:	48 0f 45 c2          	cmovne %rdx,%rax
+  8024a2:	eb e4                	jmp    802488 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8024a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8024a8:	eb da                	jmp    802484 <devfile_read+0x9c>
+        return E_INVAL;
+  8024aa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024af:	eb d7                	jmp    802488 <devfile_read+0xa0>
+  8024b1:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8024b6:	c3                   	ret
+
+00000000008024b7 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024b7:	48 85 ff             	test   %rdi,%rdi
+  8024ba:	74 5f                	je     80251b <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8024bc:	55                   	push   %rbp
+  8024bd:	48 89 e5             	mov    %rsp,%rbp
+  8024c0:	53                   	push   %rbx
+  8024c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c5:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024c8:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024da:	77 45                	ja     802521 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8024dc:	48 89 de             	mov    %rbx,%rsi
+  8024df:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024e6:	00 00 00 
+  8024e9:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8024f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fa:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024ff:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80250b:	85 c0                	test   %eax,%eax
+  80250d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802512:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802515:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+        return -E_INVAL;
+  80251b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802520:	c3                   	ret
+        return -E_INVAL;
+  802521:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802526:	eb ed                	jmp    802515 <devfile_receive_snapshot+0x5e>
+
+0000000000802528 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802528:	55                   	push   %rbp
+  802529:	48 89 e5             	mov    %rsp,%rbp
+  80252c:	41 55                	push   %r13
+  80252e:	41 54                	push   %r12
+  802530:	53                   	push   %rbx
+  802531:	48 83 ec 08          	sub    $0x8,%rsp
+  802535:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802538:	48 85 f6             	test   %rsi,%rsi
+  80253b:	0f 94 c0             	sete   %al
+  80253e:	48 85 d2             	test   %rdx,%rdx
+  802541:	0f 94 c2             	sete   %dl
+  802544:	08 d0                	or     %dl,%al
+  802546:	0f 85 ad 00 00 00    	jne    8025f9 <devfile_send_snapshot+0xd1>
+  80254c:	48 89 fb             	mov    %rdi,%rbx
+  80254f:	49 89 f4             	mov    %rsi,%r12
+  802552:	48 85 ff             	test   %rdi,%rdi
+  802555:	0f 84 9e 00 00 00    	je     8025f9 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80255b:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+  802567:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80256d:	0f 87 8d 00 00 00    	ja     802600 <devfile_send_snapshot+0xd8>
+  802573:	4c 89 e7             	mov    %r12,%rdi
+  802576:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802588:	77 7d                	ja     802607 <devfile_send_snapshot+0xdf>
+  80258a:	4c 89 ef             	mov    %r13,%rdi
+  80258d:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+  802599:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80259f:	77 6d                	ja     80260e <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8025a1:	48 89 de             	mov    %rbx,%rsi
+  8025a4:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8025ab:	00 00 00 
+  8025ae:	48 bb a6 0b 80 00 00 	movabs $0x800ba6,%rbx
+  8025b5:	00 00 00 
+  8025b8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8025ba:	4c 89 e6             	mov    %r12,%rsi
+  8025bd:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8025c4:	00 00 00 
+  8025c7:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8025c9:	4c 89 ee             	mov    %r13,%rsi
+  8025cc:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8025d3:	00 00 00 
+  8025d6:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8025d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025dd:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025e2:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8025e9:	00 00 00 
+  8025ec:	ff d0                	call   *%rax
+}
+  8025ee:	48 83 c4 08          	add    $0x8,%rsp
+  8025f2:	5b                   	pop    %rbx
+  8025f3:	41 5c                	pop    %r12
+  8025f5:	41 5d                	pop    %r13
+  8025f7:	5d                   	pop    %rbp
+  8025f8:	c3                   	ret
+        return -E_INVAL;
+  8025f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025fe:	eb ee                	jmp    8025ee <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802600:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802605:	eb e7                	jmp    8025ee <devfile_send_snapshot+0xc6>
+  802607:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260c:	eb e0                	jmp    8025ee <devfile_send_snapshot+0xc6>
+  80260e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802613:	eb d9                	jmp    8025ee <devfile_send_snapshot+0xc6>
+
+0000000000802615 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802615:	48 85 ff             	test   %rdi,%rdi
+  802618:	0f 84 41 01 00 00    	je     80275f <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80261e:	55                   	push   %rbp
+  80261f:	48 89 e5             	mov    %rsp,%rbp
+  802622:	41 57                	push   %r15
+  802624:	41 56                	push   %r14
+  802626:	41 55                	push   %r13
+  802628:	41 54                	push   %r12
+  80262a:	53                   	push   %rbx
+  80262b:	48 83 ec 08          	sub    $0x8,%rsp
+  80262f:	49 89 fc             	mov    %rdi,%r12
+  802632:	49 89 f5             	mov    %rsi,%r13
+  802635:	48 89 d3             	mov    %rdx,%rbx
+  802638:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80263b:	48 85 f6             	test   %rsi,%rsi
+  80263e:	0f 84 ff 00 00 00    	je     802743 <devfile_diff_snapshots+0x12e>
+  802644:	48 85 d2             	test   %rdx,%rdx
+  802647:	0f 84 fd 00 00 00    	je     80274a <devfile_diff_snapshots+0x135>
+  80264d:	48 85 c9             	test   %rcx,%rcx
+  802650:	0f 84 f4 00 00 00    	je     80274a <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802656:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  80265d:	00 00 00 
+  802660:	ff d0                	call   *%rax
+  802662:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802668:	0f 87 e3 00 00 00    	ja     802751 <devfile_diff_snapshots+0x13c>
+  80266e:	4c 89 ef             	mov    %r13,%rdi
+  802671:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+  80267d:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802683:	0f 87 cf 00 00 00    	ja     802758 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802689:	4c 89 e6             	mov    %r12,%rsi
+  80268c:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802693:	00 00 00 
+  802696:	4c 89 e7             	mov    %r12,%rdi
+  802699:	49 bf a6 0b 80 00 00 	movabs $0x800ba6,%r15
+  8026a0:	00 00 00 
+  8026a3:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8026a6:	4c 89 ee             	mov    %r13,%rsi
+  8026a9:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8026b0:	00 
+  8026b1:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8026b4:	48 8b 03             	mov    (%rbx),%rax
+  8026b7:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8026be:	00 
+  8026bf:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8026c3:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8026ca:	00 
+  8026cb:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8026cf:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8026d6:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8026d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dc:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026e1:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8026e8:	00 00 00 
+  8026eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	78 43                	js     802734 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8026f1:	49 8b 04 24          	mov    (%r12),%rax
+  8026f5:	48 89 03             	mov    %rax,(%rbx)
+  8026f8:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8026fd:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802701:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802706:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80270a:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80270f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802713:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802717:	48 c1 e2 03          	shl    $0x3,%rdx
+  80271b:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802720:	4c 89 f7             	mov    %r14,%rdi
+  802723:	48 b8 a0 0d 80 00 00 	movabs $0x800da0,%rax
+  80272a:	00 00 00 
+  80272d:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80272f:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802734:	48 83 c4 08          	add    $0x8,%rsp
+  802738:	5b                   	pop    %rbx
+  802739:	41 5c                	pop    %r12
+  80273b:	41 5d                	pop    %r13
+  80273d:	41 5e                	pop    %r14
+  80273f:	41 5f                	pop    %r15
+  802741:	5d                   	pop    %rbp
+  802742:	c3                   	ret
+        return -E_INVAL;
+  802743:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802748:	eb ea                	jmp    802734 <devfile_diff_snapshots+0x11f>
+  80274a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80274f:	eb e3                	jmp    802734 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802751:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802756:	eb dc                	jmp    802734 <devfile_diff_snapshots+0x11f>
+  802758:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80275d:	eb d5                	jmp    802734 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80275f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802764:	c3                   	ret
+
+0000000000802765 <devfile_delete_snapshot>:
+    if (!name) {
+  802765:	48 85 ff             	test   %rdi,%rdi
+  802768:	74 5f                	je     8027c9 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80276a:	55                   	push   %rbp
+  80276b:	48 89 e5             	mov    %rsp,%rbp
+  80276e:	53                   	push   %rbx
+  80276f:	48 83 ec 08          	sub    $0x8,%rsp
+  802773:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802776:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802788:	77 45                	ja     8027cf <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80278a:	48 89 de             	mov    %rbx,%rsi
+  80278d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802794:	00 00 00 
+  802797:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8027a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027ad:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c0:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+        return -E_INVAL;
+  8027c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027ce:	c3                   	ret
+        return -E_INVAL;
+  8027cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d4:	eb ed                	jmp    8027c3 <devfile_delete_snapshot+0x5e>
+
+00000000008027d6 <devfile_accept_snapshot>:
+    if (!name) {
+  8027d6:	48 85 ff             	test   %rdi,%rdi
+  8027d9:	74 5f                	je     80283a <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+  8027df:	53                   	push   %rbx
+  8027e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8027e7:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027f9:	77 45                	ja     802840 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8027fb:	48 89 de             	mov    %rbx,%rsi
+  8027fe:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802805:	00 00 00 
+  802808:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802814:	be 00 00 00 00       	mov    $0x0,%esi
+  802819:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80281e:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80282a:	85 c0                	test   %eax,%eax
+  80282c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802831:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802834:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+        return -E_INVAL;
+  80283a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80283f:	c3                   	ret
+        return -E_INVAL;
+  802840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802845:	eb ed                	jmp    802834 <devfile_accept_snapshot+0x5e>
+
+0000000000802847 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802847:	48 85 ff             	test   %rdi,%rdi
+  80284a:	0f 84 9f 00 00 00    	je     8028ef <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802850:	55                   	push   %rbp
+  802851:	48 89 e5             	mov    %rsp,%rbp
+  802854:	41 54                	push   %r12
+  802856:	53                   	push   %rbx
+  802857:	48 89 fb             	mov    %rdi,%rbx
+  80285a:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  80285d:	48 85 f6             	test   %rsi,%rsi
+  802860:	74 78                	je     8028da <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802862:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802869:	00 00 00 
+  80286c:	ff d0                	call   *%rax
+  80286e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802874:	77 6b                	ja     8028e1 <devfile_create_snapshot+0x9a>
+  802876:	4c 89 e7             	mov    %r12,%rdi
+  802879:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+  802885:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80288b:	77 5b                	ja     8028e8 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  80288d:	48 89 de             	mov    %rbx,%rsi
+  802890:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802897:	00 00 00 
+  80289a:	48 bb a6 0b 80 00 00 	movabs $0x800ba6,%rbx
+  8028a1:	00 00 00 
+  8028a4:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8028a6:	4c 89 e6             	mov    %r12,%rsi
+  8028a9:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8028b0:	00 00 00 
+  8028b3:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8028b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ba:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028bf:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  8028c6:	00 00 00 
+  8028c9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028d5:	5b                   	pop    %rbx
+  8028d6:	41 5c                	pop    %r12
+  8028d8:	5d                   	pop    %rbp
+  8028d9:	c3                   	ret
+        return -E_INVAL;
+  8028da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028df:	eb f4                	jmp    8028d5 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e6:	eb ed                	jmp    8028d5 <devfile_create_snapshot+0x8e>
+  8028e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ed:	eb e6                	jmp    8028d5 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028f4:	c3                   	ret
+
+00000000008028f5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	41 54                	push   %r12
+  8028fb:	53                   	push   %rbx
+  8028fc:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8028ff:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802902:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802909:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80290b:	be 00 00 00 00       	mov    $0x0,%esi
+  802910:	bf 05 00 00 00       	mov    $0x5,%edi
+  802915:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  80291c:	00 00 00 
+  80291f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 3d                	js     802962 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802925:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80292c:	00 00 00 
+  80292f:	4c 89 e6             	mov    %r12,%rsi
+  802932:	48 89 df             	mov    %rbx,%rdi
+  802935:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802941:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802948:	00 
+  802949:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80294f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802956:	00 
+  802957:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80295d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802962:	5b                   	pop    %rbx
+  802963:	41 5c                	pop    %r12
+  802965:	5d                   	pop    %rbp
+  802966:	c3                   	ret
+
+0000000000802967 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802967:	55                   	push   %rbp
+  802968:	48 89 e5             	mov    %rsp,%rbp
+  80296b:	41 57                	push   %r15
+  80296d:	41 56                	push   %r14
+  80296f:	41 55                	push   %r13
+  802971:	41 54                	push   %r12
+  802973:	53                   	push   %rbx
+  802974:	48 83 ec 38          	sub    $0x38,%rsp
+  802978:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80297c:	49 89 f5             	mov    %rsi,%r13
+  80297f:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802982:	48 89 f0             	mov    %rsi,%rax
+  802985:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80298a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80298e:	75 4f                	jne    8029df <devfile_readmap+0x78>
+  802990:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802994:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80299a:	75 1f                	jne    8029bb <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  80299c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029a0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029a4:	49 be 4f 31 80 00 00 	movabs $0x80314f,%r14
+  8029ab:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029ae:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8029b5:	0f 87 9d 00 00 00    	ja     802a58 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8029bb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029bf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8029c3:	4d 85 ff             	test   %r15,%r15
+  8029c6:	0f 85 cf 00 00 00    	jne    802a9b <devfile_readmap+0x134>
+  8029cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8029d0:	48 83 c4 38          	add    $0x38,%rsp
+  8029d4:	5b                   	pop    %rbx
+  8029d5:	41 5c                	pop    %r12
+  8029d7:	41 5d                	pop    %r13
+  8029d9:	41 5e                	pop    %r14
+  8029db:	41 5f                	pop    %r15
+  8029dd:	5d                   	pop    %rbp
+  8029de:	c3                   	ret
+    size_t totalRead = 0;
+  8029df:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8029e6:	00 
+  8029e7:	eb da                	jmp    8029c3 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029e9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ed:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029f0:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8029f7:	00 00 00 
+  8029fa:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  8029fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a00:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802a04:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a08:	4c 89 ee             	mov    %r13,%rsi
+  802a0b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a10:	48 b8 15 21 80 00 00 	movabs $0x802115,%rax
+  802a17:	00 00 00 
+  802a1a:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802a1c:	85 c0                	test   %eax,%eax
+  802a1e:	7e a3                	jle    8029c3 <devfile_readmap+0x5c>
+  802a20:	48 98                	cltq
+  802a22:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a26:	72 9b                	jb     8029c3 <devfile_readmap+0x5c>
+        buf += read;
+  802a28:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a2b:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a2e:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a32:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a39:	75 88                	jne    8029c3 <devfile_readmap+0x5c>
+  802a3b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a3f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a45:	0f 85 78 ff ff ff    	jne    8029c3 <devfile_readmap+0x5c>
+  802a4b:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a52:	0f 86 6b ff ff ff    	jbe    8029c3 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802a58:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802a5e:	4d 39 e7             	cmp    %r12,%r15
+  802a61:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802a65:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802a6c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a70:	0f 84 73 ff ff ff    	je     8029e9 <devfile_readmap+0x82>
+  802a76:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a7a:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802a7f:	41 ff d6             	call   *%r14
+  802a82:	a8 40                	test   $0x40,%al
+  802a84:	0f 85 39 ff ff ff    	jne    8029c3 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a8a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a91:	4c 39 e3             	cmp    %r12,%rbx
+  802a94:	72 e4                	jb     802a7a <devfile_readmap+0x113>
+  802a96:	e9 4e ff ff ff       	jmp    8029e9 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802a9b:	4c 89 fa             	mov    %r15,%rdx
+  802a9e:	4c 89 ee             	mov    %r13,%rsi
+  802aa1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802aa5:	48 b8 e8 23 80 00 00 	movabs $0x8023e8,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802ab1:	48 85 c0             	test   %rax,%rax
+  802ab4:	78 0c                	js     802ac2 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802ab6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aba:	48 01 f0             	add    %rsi,%rax
+  802abd:	e9 0e ff ff ff       	jmp    8029d0 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802ac2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ac6:	48 85 f6             	test   %rsi,%rsi
+  802ac9:	48 0f 45 c6          	cmovne %rsi,%rax
+  802acd:	e9 fe fe ff ff       	jmp    8029d0 <devfile_readmap+0x69>
+
+0000000000802ad2 <open>:
+open(const char *path, int mode) {
+  802ad2:	55                   	push   %rbp
+  802ad3:	48 89 e5             	mov    %rsp,%rbp
+  802ad6:	41 55                	push   %r13
+  802ad8:	41 54                	push   %r12
+  802ada:	53                   	push   %rbx
+  802adb:	48 83 ec 18          	sub    $0x18,%rsp
+  802adf:	49 89 fc             	mov    %rdi,%r12
+  802ae2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ae5:	48 b8 68 0b 80 00 00 	movabs $0x800b68,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802af7:	0f 87 8a 00 00 00    	ja     802b87 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802afd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b01:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+  802b0d:	89 c3                	mov    %eax,%ebx
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 50                	js     802b63 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b13:	4c 89 e6             	mov    %r12,%rsi
+  802b16:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802b1d:	00 00 00 
+  802b20:	48 89 df             	mov    %rbx,%rdi
+  802b23:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  802b2a:	00 00 00 
+  802b2d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b2f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b36:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b3f:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+  802b4b:	89 c3                	mov    %eax,%ebx
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	78 1f                	js     802b70 <open+0x9e>
+    return fd2num(fd);
+  802b51:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b55:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+  802b61:	89 c3                	mov    %eax,%ebx
+}
+  802b63:	89 d8                	mov    %ebx,%eax
+  802b65:	48 83 c4 18          	add    $0x18,%rsp
+  802b69:	5b                   	pop    %rbx
+  802b6a:	41 5c                	pop    %r12
+  802b6c:	41 5d                	pop    %r13
+  802b6e:	5d                   	pop    %rbp
+  802b6f:	c3                   	ret
+        fd_close(fd, 0);
+  802b70:	be 00 00 00 00       	mov    $0x0,%esi
+  802b75:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b79:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+        return res;
+  802b85:	eb dc                	jmp    802b63 <open+0x91>
+        return -E_BAD_PATH;
+  802b87:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b8c:	eb d5                	jmp    802b63 <open+0x91>
+
+0000000000802b8e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802b92:	be 00 00 00 00       	mov    $0x0,%esi
+  802b97:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b9c:	48 b8 ad 21 80 00 00 	movabs $0x8021ad,%rax
+  802ba3:	00 00 00 
+  802ba6:	ff d0                	call   *%rax
+}
+  802ba8:	5d                   	pop    %rbp
+  802ba9:	c3                   	ret
+
+0000000000802baa <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802baa:	55                   	push   %rbp
+  802bab:	48 89 e5             	mov    %rsp,%rbp
+  802bae:	41 54                	push   %r12
+  802bb0:	53                   	push   %rbx
+  802bb1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bb4:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+  802bc0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802bc3:	48 be 20 3e 80 00 00 	movabs $0x803e20,%rsi
+  802bca:	00 00 00 
+  802bcd:	48 89 df             	mov    %rbx,%rdi
+  802bd0:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bdc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802be1:	41 2b 04 24          	sub    (%r12),%eax
+  802be5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802beb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bf2:	00 00 00 
+    stat->st_dev = &devpipe;
+  802bf5:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802bfc:	00 00 00 
+  802bff:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0b:	5b                   	pop    %rbx
+  802c0c:	41 5c                	pop    %r12
+  802c0e:	5d                   	pop    %rbp
+  802c0f:	c3                   	ret
+
+0000000000802c10 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802c10:	55                   	push   %rbp
+  802c11:	48 89 e5             	mov    %rsp,%rbp
+  802c14:	41 54                	push   %r12
+  802c16:	53                   	push   %rbx
+  802c17:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c1a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c1f:	48 89 fe             	mov    %rdi,%rsi
+  802c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c27:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  802c2e:	00 00 00 
+  802c31:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c34:	48 89 df             	mov    %rbx,%rdi
+  802c37:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+  802c43:	48 89 c6             	mov    %rax,%rsi
+  802c46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c50:	41 ff d4             	call   *%r12
+}
+  802c53:	5b                   	pop    %rbx
+  802c54:	41 5c                	pop    %r12
+  802c56:	5d                   	pop    %rbp
+  802c57:	c3                   	ret
+
+0000000000802c58 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c58:	55                   	push   %rbp
+  802c59:	48 89 e5             	mov    %rsp,%rbp
+  802c5c:	41 57                	push   %r15
+  802c5e:	41 56                	push   %r14
+  802c60:	41 55                	push   %r13
+  802c62:	41 54                	push   %r12
+  802c64:	53                   	push   %rbx
+  802c65:	48 83 ec 18          	sub    $0x18,%rsp
+  802c69:	49 89 fc             	mov    %rdi,%r12
+  802c6c:	49 89 f5             	mov    %rsi,%r13
+  802c6f:	49 89 d7             	mov    %rdx,%r15
+  802c72:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c76:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c82:	4d 85 ff             	test   %r15,%r15
+  802c85:	0f 84 af 00 00 00    	je     802d3a <devpipe_write+0xe2>
+  802c8b:	48 89 c3             	mov    %rax,%rbx
+  802c8e:	4c 89 f8             	mov    %r15,%rax
+  802c91:	4d 89 ef             	mov    %r13,%r15
+  802c94:	4c 01 e8             	add    %r13,%rax
+  802c97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c9b:	49 bd 06 12 80 00 00 	movabs $0x801206,%r13
+  802ca2:	00 00 00 
+            sys_yield();
+  802ca5:	49 be a3 11 80 00 00 	movabs $0x8011a3,%r14
+  802cac:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802caf:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cb2:	48 63 ce             	movslq %esi,%rcx
+  802cb5:	48 63 03             	movslq (%rbx),%rax
+  802cb8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cbe:	48 39 c1             	cmp    %rax,%rcx
+  802cc1:	72 2e                	jb     802cf1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cc3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cc8:	48 89 da             	mov    %rbx,%rdx
+  802ccb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cd0:	4c 89 e7             	mov    %r12,%rdi
+  802cd3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cd6:	85 c0                	test   %eax,%eax
+  802cd8:	74 66                	je     802d40 <devpipe_write+0xe8>
+            sys_yield();
+  802cda:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cdd:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ce0:	48 63 ce             	movslq %esi,%rcx
+  802ce3:	48 63 03             	movslq (%rbx),%rax
+  802ce6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cec:	48 39 c1             	cmp    %rax,%rcx
+  802cef:	73 d2                	jae    802cc3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cf1:	41 0f b6 3f          	movzbl (%r15),%edi
+  802cf5:	48 89 ca             	mov    %rcx,%rdx
+  802cf8:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cfc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802d03:	08 10 20 
+  802d06:	48 f7 e2             	mul    %rdx
+  802d09:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d0d:	48 89 d0             	mov    %rdx,%rax
+  802d10:	48 c1 e0 09          	shl    $0x9,%rax
+  802d14:	48 29 d0             	sub    %rdx,%rax
+  802d17:	48 c1 e0 03          	shl    $0x3,%rax
+  802d1b:	48 29 c1             	sub    %rax,%rcx
+  802d1e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802d23:	83 c6 01             	add    $0x1,%esi
+  802d26:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d29:	49 83 c7 01          	add    $0x1,%r15
+  802d2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d31:	49 39 c7             	cmp    %rax,%r15
+  802d34:	0f 85 75 ff ff ff    	jne    802caf <devpipe_write+0x57>
+    return n;
+  802d3a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d3e:	eb 05                	jmp    802d45 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d45:	48 83 c4 18          	add    $0x18,%rsp
+  802d49:	5b                   	pop    %rbx
+  802d4a:	41 5c                	pop    %r12
+  802d4c:	41 5d                	pop    %r13
+  802d4e:	41 5e                	pop    %r14
+  802d50:	41 5f                	pop    %r15
+  802d52:	5d                   	pop    %rbp
+  802d53:	c3                   	ret
+
+0000000000802d54 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d54:	55                   	push   %rbp
+  802d55:	48 89 e5             	mov    %rsp,%rbp
+  802d58:	41 57                	push   %r15
+  802d5a:	41 56                	push   %r14
+  802d5c:	41 55                	push   %r13
+  802d5e:	41 54                	push   %r12
+  802d60:	53                   	push   %rbx
+  802d61:	48 83 ec 18          	sub    $0x18,%rsp
+  802d65:	49 89 fc             	mov    %rdi,%r12
+  802d68:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d6c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d70:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+  802d7c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d7f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d85:	49 bd 06 12 80 00 00 	movabs $0x801206,%r13
+  802d8c:	00 00 00 
+            sys_yield();
+  802d8f:	49 be a3 11 80 00 00 	movabs $0x8011a3,%r14
+  802d96:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d99:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d9e:	74 7d                	je     802e1d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802da0:	8b 03                	mov    (%rbx),%eax
+  802da2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802da5:	75 26                	jne    802dcd <devpipe_read+0x79>
+            if (i > 0) return i;
+  802da7:	4d 85 ff             	test   %r15,%r15
+  802daa:	75 77                	jne    802e23 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802db1:	48 89 da             	mov    %rbx,%rdx
+  802db4:	be 00 10 00 00       	mov    $0x1000,%esi
+  802db9:	4c 89 e7             	mov    %r12,%rdi
+  802dbc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	74 72                	je     802e35 <devpipe_read+0xe1>
+            sys_yield();
+  802dc3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dc6:	8b 03                	mov    (%rbx),%eax
+  802dc8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802dcb:	74 df                	je     802dac <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802dcd:	48 63 c8             	movslq %eax,%rcx
+  802dd0:	48 89 ca             	mov    %rcx,%rdx
+  802dd3:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dd7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802dde:	08 10 20 
+  802de1:	48 89 d0             	mov    %rdx,%rax
+  802de4:	48 f7 e6             	mul    %rsi
+  802de7:	48 c1 ea 06          	shr    $0x6,%rdx
+  802deb:	48 89 d0             	mov    %rdx,%rax
+  802dee:	48 c1 e0 09          	shl    $0x9,%rax
+  802df2:	48 29 d0             	sub    %rdx,%rax
+  802df5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802dfc:	00 
+  802dfd:	48 89 c8             	mov    %rcx,%rax
+  802e00:	48 29 d0             	sub    %rdx,%rax
+  802e03:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802e08:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e0c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802e10:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e13:	49 83 c7 01          	add    $0x1,%r15
+  802e17:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802e1b:	75 83                	jne    802da0 <devpipe_read+0x4c>
+    return n;
+  802e1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e21:	eb 03                	jmp    802e26 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802e23:	4c 89 f8             	mov    %r15,%rax
+}
+  802e26:	48 83 c4 18          	add    $0x18,%rsp
+  802e2a:	5b                   	pop    %rbx
+  802e2b:	41 5c                	pop    %r12
+  802e2d:	41 5d                	pop    %r13
+  802e2f:	41 5e                	pop    %r14
+  802e31:	41 5f                	pop    %r15
+  802e33:	5d                   	pop    %rbp
+  802e34:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3a:	eb ea                	jmp    802e26 <devpipe_read+0xd2>
+
+0000000000802e3c <pipe>:
+pipe(int pfd[2]) {
+  802e3c:	55                   	push   %rbp
+  802e3d:	48 89 e5             	mov    %rsp,%rbp
+  802e40:	41 55                	push   %r13
+  802e42:	41 54                	push   %r12
+  802e44:	53                   	push   %rbx
+  802e45:	48 83 ec 18          	sub    $0x18,%rsp
+  802e49:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e4c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e50:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+  802e5c:	89 c3                	mov    %eax,%ebx
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	0f 88 a0 01 00 00    	js     803006 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e66:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e70:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e79:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+  802e85:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	0f 88 77 01 00 00    	js     803006 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e8f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e93:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  802e9a:	00 00 00 
+  802e9d:	ff d0                	call   *%rax
+  802e9f:	89 c3                	mov    %eax,%ebx
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	0f 88 43 01 00 00    	js     802fec <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802ea9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eb3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ebc:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+  802ec8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802eca:	85 c0                	test   %eax,%eax
+  802ecc:	0f 88 1a 01 00 00    	js     802fec <pipe+0x1b0>
+    va = fd2data(fd0);
+  802ed2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ed6:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802edd:	00 00 00 
+  802ee0:	ff d0                	call   *%rax
+  802ee2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802ee5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eef:	48 89 c6             	mov    %rax,%rsi
+  802ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef7:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+  802f03:	89 c3                	mov    %eax,%ebx
+  802f05:	85 c0                	test   %eax,%eax
+  802f07:	0f 88 c5 00 00 00    	js     802fd2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802f0d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f11:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  802f18:	00 00 00 
+  802f1b:	ff d0                	call   *%rax
+  802f1d:	48 89 c1             	mov    %rax,%rcx
+  802f20:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802f26:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f31:	4c 89 ee             	mov    %r13,%rsi
+  802f34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f39:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+  802f45:	89 c3                	mov    %eax,%ebx
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	78 6e                	js     802fb9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f4b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f50:	4c 89 ef             	mov    %r13,%rdi
+  802f53:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  802f5a:	00 00 00 
+  802f5d:	ff d0                	call   *%rax
+  802f5f:	83 f8 02             	cmp    $0x2,%eax
+  802f62:	0f 85 ab 00 00 00    	jne    803013 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f68:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802f6f:	00 00 
+  802f71:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f75:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f77:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f7b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f82:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f86:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f8c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f93:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f97:	48 bb 02 16 80 00 00 	movabs $0x801602,%rbx
+  802f9e:	00 00 00 
+  802fa1:	ff d3                	call   *%rbx
+  802fa3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802fa7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802fab:	ff d3                	call   *%rbx
+  802fad:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb7:	eb 4d                	jmp    803006 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802fb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fbe:	4c 89 ee             	mov    %r13,%rsi
+  802fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc6:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802fd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe0:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802fec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ff1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffa:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803001:	00 00 00 
+  803004:	ff d0                	call   *%rax
+}
+  803006:	89 d8                	mov    %ebx,%eax
+  803008:	48 83 c4 18          	add    $0x18,%rsp
+  80300c:	5b                   	pop    %rbx
+  80300d:	41 5c                	pop    %r12
+  80300f:	41 5d                	pop    %r13
+  803011:	5d                   	pop    %rbp
+  803012:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803013:	48 b9 50 3e 80 00 00 	movabs $0x803e50,%rcx
+  80301a:	00 00 00 
+  80301d:	48 ba 27 3e 80 00 00 	movabs $0x803e27,%rdx
+  803024:	00 00 00 
+  803027:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80302c:	48 bf 3c 3e 80 00 00 	movabs $0x803e3c,%rdi
+  803033:	00 00 00 
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303b:	49 b8 93 34 80 00 00 	movabs $0x803493,%r8
+  803042:	00 00 00 
+  803045:	41 ff d0             	call   *%r8
+
+0000000000803048 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803048:	55                   	push   %rbp
+  803049:	48 89 e5             	mov    %rsp,%rbp
+  80304c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803050:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803054:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  80305b:	00 00 00 
+  80305e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803060:	85 c0                	test   %eax,%eax
+  803062:	78 35                	js     803099 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803064:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803068:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  80306f:	00 00 00 
+  803072:	ff d0                	call   *%rax
+  803074:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80307c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803081:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803085:	48 b8 06 12 80 00 00 	movabs $0x801206,%rax
+  80308c:	00 00 00 
+  80308f:	ff d0                	call   *%rax
+  803091:	85 c0                	test   %eax,%eax
+  803093:	0f 94 c0             	sete   %al
+  803096:	0f b6 c0             	movzbl %al,%eax
+}
+  803099:	c9                   	leave
+  80309a:	c3                   	ret
+
+000000000080309b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80309b:	48 89 f8             	mov    %rdi,%rax
+  80309e:	48 c1 e8 27          	shr    $0x27,%rax
+  8030a2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8030a9:	01 00 00 
+  8030ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030b0:	f6 c2 01             	test   $0x1,%dl
+  8030b3:	74 6d                	je     803122 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8030b5:	48 89 f8             	mov    %rdi,%rax
+  8030b8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030bc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030c3:	01 00 00 
+  8030c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030ca:	f6 c2 01             	test   $0x1,%dl
+  8030cd:	74 62                	je     803131 <get_uvpt_entry+0x96>
+  8030cf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030d6:	01 00 00 
+  8030d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030dd:	f6 c2 80             	test   $0x80,%dl
+  8030e0:	75 4f                	jne    803131 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030e2:	48 89 f8             	mov    %rdi,%rax
+  8030e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8030e9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030f0:	01 00 00 
+  8030f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030f7:	f6 c2 01             	test   $0x1,%dl
+  8030fa:	74 44                	je     803140 <get_uvpt_entry+0xa5>
+  8030fc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803103:	01 00 00 
+  803106:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80310a:	f6 c2 80             	test   $0x80,%dl
+  80310d:	75 31                	jne    803140 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80310f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803113:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80311a:	01 00 00 
+  80311d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803121:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803122:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803129:	01 00 00 
+  80312c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803130:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803131:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803138:	01 00 00 
+  80313b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80313f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803140:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803147:	01 00 00 
+  80314a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80314e:	c3                   	ret
+
+000000000080314f <get_prot>:
+
+int
+get_prot(void *va) {
+  80314f:	55                   	push   %rbp
+  803150:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803153:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  80315a:	00 00 00 
+  80315d:	ff d0                	call   *%rax
+  80315f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803162:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803167:	89 c1                	mov    %eax,%ecx
+  803169:	83 c9 04             	or     $0x4,%ecx
+  80316c:	f6 c2 01             	test   $0x1,%dl
+  80316f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803172:	89 c1                	mov    %eax,%ecx
+  803174:	83 c9 02             	or     $0x2,%ecx
+  803177:	f6 c2 02             	test   $0x2,%dl
+  80317a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80317d:	89 c1                	mov    %eax,%ecx
+  80317f:	83 c9 01             	or     $0x1,%ecx
+  803182:	48 85 d2             	test   %rdx,%rdx
+  803185:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803188:	89 c1                	mov    %eax,%ecx
+  80318a:	83 c9 40             	or     $0x40,%ecx
+  80318d:	f6 c6 04             	test   $0x4,%dh
+  803190:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803193:	5d                   	pop    %rbp
+  803194:	c3                   	ret
+
+0000000000803195 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803195:	55                   	push   %rbp
+  803196:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803199:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8031a5:	48 c1 e8 06          	shr    $0x6,%rax
+  8031a9:	83 e0 01             	and    $0x1,%eax
+}
+  8031ac:	5d                   	pop    %rbp
+  8031ad:	c3                   	ret
+
+00000000008031ae <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8031ae:	55                   	push   %rbp
+  8031af:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8031b2:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8031be:	48 c1 e8 05          	shr    $0x5,%rax
+  8031c2:	83 e0 01             	and    $0x1,%eax
+}
+  8031c5:	5d                   	pop    %rbp
+  8031c6:	c3                   	ret
+
+00000000008031c7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8031c7:	55                   	push   %rbp
+  8031c8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8031cb:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  8031d2:	00 00 00 
+  8031d5:	ff d0                	call   *%rax
+  8031d7:	83 e0 01             	and    $0x1,%eax
+}
+  8031da:	5d                   	pop    %rbp
+  8031db:	c3                   	ret
+
+00000000008031dc <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8031dc:	55                   	push   %rbp
+  8031dd:	48 89 e5             	mov    %rsp,%rbp
+  8031e0:	41 57                	push   %r15
+  8031e2:	41 56                	push   %r14
+  8031e4:	41 55                	push   %r13
+  8031e6:	41 54                	push   %r12
+  8031e8:	53                   	push   %rbx
+  8031e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8031ed:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031f1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8031fa:	49 bd c7 31 80 00 00 	movabs $0x8031c7,%r13
+  803201:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803204:	49 bf 4f 31 80 00 00 	movabs $0x80314f,%r15
+  80320b:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80320e:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803215:	00 00 00 
+  803218:	eb 0c                	jmp    803226 <foreach_shared_region+0x4a>
+  80321a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803221:	4c 39 f3             	cmp    %r14,%rbx
+  803224:	74 2e                	je     803254 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803226:	48 89 df             	mov    %rbx,%rdi
+  803229:	41 ff d5             	call   *%r13
+  80322c:	84 c0                	test   %al,%al
+  80322e:	74 ea                	je     80321a <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803230:	48 89 df             	mov    %rbx,%rdi
+  803233:	41 ff d7             	call   *%r15
+  803236:	a8 40                	test   $0x40,%al
+  803238:	74 e0                	je     80321a <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80323a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803241:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803245:	48 89 df             	mov    %rbx,%rdi
+  803248:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80324c:	ff d0                	call   *%rax
+				if (res < 0) {
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	79 c8                	jns    80321a <foreach_shared_region+0x3e>
+  803252:	eb 05                	jmp    803259 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803259:	48 83 c4 18          	add    $0x18,%rsp
+  80325d:	5b                   	pop    %rbx
+  80325e:	41 5c                	pop    %r12
+  803260:	41 5d                	pop    %r13
+  803262:	41 5e                	pop    %r14
+  803264:	41 5f                	pop    %r15
+  803266:	5d                   	pop    %rbp
+  803267:	c3                   	ret
+
+0000000000803268 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326d:	c3                   	ret
+
+000000000080326e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803275:	48 be 74 3e 80 00 00 	movabs $0x803e74,%rsi
+  80327c:	00 00 00 
+  80327f:	48 b8 a6 0b 80 00 00 	movabs $0x800ba6,%rax
+  803286:	00 00 00 
+  803289:	ff d0                	call   *%rax
+    return 0;
+}
+  80328b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803290:	5d                   	pop    %rbp
+  803291:	c3                   	ret
+
+0000000000803292 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803292:	55                   	push   %rbp
+  803293:	48 89 e5             	mov    %rsp,%rbp
+  803296:	41 57                	push   %r15
+  803298:	41 56                	push   %r14
+  80329a:	41 55                	push   %r13
+  80329c:	41 54                	push   %r12
+  80329e:	53                   	push   %rbx
+  80329f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8032a6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8032ad:	48 85 d2             	test   %rdx,%rdx
+  8032b0:	74 7a                	je     80332c <devcons_write+0x9a>
+  8032b2:	49 89 d6             	mov    %rdx,%r14
+  8032b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032bb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8032c0:	49 bf a0 0d 80 00 00 	movabs $0x800da0,%r15
+  8032c7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032ca:	4c 89 f3             	mov    %r14,%rbx
+  8032cd:	48 29 f3             	sub    %rsi,%rbx
+  8032d0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032d5:	48 39 c3             	cmp    %rax,%rbx
+  8032d8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8032dc:	4c 63 eb             	movslq %ebx,%r13
+  8032df:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8032e6:	48 01 c6             	add    %rax,%rsi
+  8032e9:	4c 89 ea             	mov    %r13,%rdx
+  8032ec:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032f3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8032f6:	4c 89 ee             	mov    %r13,%rsi
+  8032f9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803300:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  803307:	00 00 00 
+  80330a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80330c:	41 01 dc             	add    %ebx,%r12d
+  80330f:	49 63 f4             	movslq %r12d,%rsi
+  803312:	4c 39 f6             	cmp    %r14,%rsi
+  803315:	72 b3                	jb     8032ca <devcons_write+0x38>
+    return res;
+  803317:	49 63 c4             	movslq %r12d,%rax
+}
+  80331a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803321:	5b                   	pop    %rbx
+  803322:	41 5c                	pop    %r12
+  803324:	41 5d                	pop    %r13
+  803326:	41 5e                	pop    %r14
+  803328:	41 5f                	pop    %r15
+  80332a:	5d                   	pop    %rbp
+  80332b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80332c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803332:	eb e3                	jmp    803317 <devcons_write+0x85>
+
+0000000000803334 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803334:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333c:	48 85 c0             	test   %rax,%rax
+  80333f:	74 55                	je     803396 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803341:	55                   	push   %rbp
+  803342:	48 89 e5             	mov    %rsp,%rbp
+  803345:	41 55                	push   %r13
+  803347:	41 54                	push   %r12
+  803349:	53                   	push   %rbx
+  80334a:	48 83 ec 08          	sub    $0x8,%rsp
+  80334e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803351:	48 bb d6 10 80 00 00 	movabs $0x8010d6,%rbx
+  803358:	00 00 00 
+  80335b:	49 bc a3 11 80 00 00 	movabs $0x8011a3,%r12
+  803362:	00 00 00 
+  803365:	eb 03                	jmp    80336a <devcons_read+0x36>
+  803367:	41 ff d4             	call   *%r12
+  80336a:	ff d3                	call   *%rbx
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	74 f7                	je     803367 <devcons_read+0x33>
+    if (c < 0) return c;
+  803370:	48 63 d0             	movslq %eax,%rdx
+  803373:	78 13                	js     803388 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337a:	83 f8 04             	cmp    $0x4,%eax
+  80337d:	74 09                	je     803388 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80337f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803383:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803388:	48 89 d0             	mov    %rdx,%rax
+  80338b:	48 83 c4 08          	add    $0x8,%rsp
+  80338f:	5b                   	pop    %rbx
+  803390:	41 5c                	pop    %r12
+  803392:	41 5d                	pop    %r13
+  803394:	5d                   	pop    %rbp
+  803395:	c3                   	ret
+  803396:	48 89 d0             	mov    %rdx,%rax
+  803399:	c3                   	ret
+
+000000000080339a <cputchar>:
+cputchar(int ch) {
+  80339a:	55                   	push   %rbp
+  80339b:	48 89 e5             	mov    %rsp,%rbp
+  80339e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8033a2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8033a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8033ab:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8033af:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+}
+  8033bb:	c9                   	leave
+  8033bc:	c3                   	ret
+
+00000000008033bd <getchar>:
+getchar(void) {
+  8033bd:	55                   	push   %rbp
+  8033be:	48 89 e5             	mov    %rsp,%rbp
+  8033c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8033c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033ca:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d3:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  8033da:	00 00 00 
+  8033dd:	ff d0                	call   *%rax
+  8033df:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	78 06                	js     8033eb <getchar+0x2e>
+  8033e5:	74 08                	je     8033ef <getchar+0x32>
+  8033e7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8033eb:	89 d0                	mov    %edx,%eax
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8033ef:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8033f4:	eb f5                	jmp    8033eb <getchar+0x2e>
+
+00000000008033f6 <iscons>:
+iscons(int fdnum) {
+  8033f6:	55                   	push   %rbp
+  8033f7:	48 89 e5             	mov    %rsp,%rbp
+  8033fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803402:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	78 18                	js     80342a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803412:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803416:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80341d:	00 00 00 
+  803420:	8b 00                	mov    (%rax),%eax
+  803422:	39 02                	cmp    %eax,(%rdx)
+  803424:	0f 94 c0             	sete   %al
+  803427:	0f b6 c0             	movzbl %al,%eax
+}
+  80342a:	c9                   	leave
+  80342b:	c3                   	ret
+
+000000000080342c <opencons>:
+opencons(void) {
+  80342c:	55                   	push   %rbp
+  80342d:	48 89 e5             	mov    %rsp,%rbp
+  803430:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803434:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803438:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+  803444:	85 c0                	test   %eax,%eax
+  803446:	78 49                	js     803491 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803448:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80344d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803452:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803456:	bf 00 00 00 00       	mov    $0x0,%edi
+  80345b:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  803462:	00 00 00 
+  803465:	ff d0                	call   *%rax
+  803467:	85 c0                	test   %eax,%eax
+  803469:	78 26                	js     803491 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80346b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80346f:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  803476:	00 00 
+  803478:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80347a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80347e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803485:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+}
+  803491:	c9                   	leave
+  803492:	c3                   	ret
+
+0000000000803493 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803493:	55                   	push   %rbp
+  803494:	48 89 e5             	mov    %rsp,%rbp
+  803497:	41 56                	push   %r14
+  803499:	41 55                	push   %r13
+  80349b:	41 54                	push   %r12
+  80349d:	53                   	push   %rbx
+  80349e:	48 83 ec 50          	sub    $0x50,%rsp
+  8034a2:	49 89 fc             	mov    %rdi,%r12
+  8034a5:	41 89 f5             	mov    %esi,%r13d
+  8034a8:	48 89 d3             	mov    %rdx,%rbx
+  8034ab:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8034af:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8034b3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8034b7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8034be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8034c6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8034ca:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034ce:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8034d5:	00 00 00 
+  8034d8:	4c 8b 30             	mov    (%rax),%r14
+  8034db:	48 b8 72 11 80 00 00 	movabs $0x801172,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	89 c6                	mov    %eax,%esi
+  8034e9:	45 89 e8             	mov    %r13d,%r8d
+  8034ec:	4c 89 e1             	mov    %r12,%rcx
+  8034ef:	4c 89 f2             	mov    %r14,%rdx
+  8034f2:	48 bf 80 3e 80 00 00 	movabs $0x803e80,%rdi
+  8034f9:	00 00 00 
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803501:	49 bc 81 02 80 00 00 	movabs $0x800281,%r12
+  803508:	00 00 00 
+  80350b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80350e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803512:	48 89 df             	mov    %rbx,%rdi
+  803515:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+    cprintf("\n");
+  803521:	48 bf d3 3d 80 00 00 	movabs $0x803dd3,%rdi
+  803528:	00 00 00 
+  80352b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803530:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803533:	cc                   	int3
+  803534:	eb fd                	jmp    803533 <_panic+0xa0>
+
+0000000000803536 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803536:	55                   	push   %rbp
+  803537:	48 89 e5             	mov    %rsp,%rbp
+  80353a:	41 55                	push   %r13
+  80353c:	41 54                	push   %r12
+  80353e:	53                   	push   %rbx
+  80353f:	48 83 ec 08          	sub    $0x8,%rsp
+  803543:	49 89 fc             	mov    %rdi,%r12
+  803546:	48 89 f7             	mov    %rsi,%rdi
+  803549:	48 89 d3             	mov    %rdx,%rbx
+  80354c:	49 89 cd             	mov    %rcx,%r13
+  80354f:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803552:	48 85 f6             	test   %rsi,%rsi
+  803555:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80355c:	00 00 00 
+  80355f:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803563:	be 00 10 00 00       	mov    $0x1000,%esi
+  803568:	48 85 db             	test   %rbx,%rbx
+  80356b:	74 03                	je     803570 <ipc_recv_timed+0x3a>
+  80356d:	48 8b 33             	mov    (%rbx),%rsi
+  803570:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80357c:	85 c0                	test   %eax,%eax
+  80357e:	78 75                	js     8035f5 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803580:	4d 85 e4             	test   %r12,%r12
+  803583:	74 14                	je     803599 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803585:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80358c:	00 00 00 
+  80358f:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803595:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803599:	4d 85 ed             	test   %r13,%r13
+  80359c:	74 14                	je     8035b2 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80359e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035a5:	00 00 00 
+  8035a8:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8035ae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8035b2:	48 85 db             	test   %rbx,%rbx
+  8035b5:	74 23                	je     8035da <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8035b7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035be:	00 00 00 
+  8035c1:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8035c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035cc:	85 c9                	test   %ecx,%ecx
+  8035ce:	74 07                	je     8035d7 <ipc_recv_timed+0xa1>
+  8035d0:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035d7:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8035da:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035e1:	00 00 00 
+  8035e4:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8035ea:	48 83 c4 08          	add    $0x8,%rsp
+  8035ee:	5b                   	pop    %rbx
+  8035ef:	41 5c                	pop    %r12
+  8035f1:	41 5d                	pop    %r13
+  8035f3:	5d                   	pop    %rbp
+  8035f4:	c3                   	ret
+        if (from_env_store != NULL) {
+  8035f5:	4d 85 e4             	test   %r12,%r12
+  8035f8:	74 08                	je     803602 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8035fa:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803601:	00 
+        if (perm_store != NULL) {
+  803602:	4d 85 ed             	test   %r13,%r13
+  803605:	74 08                	je     80360f <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803607:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80360e:	00 
+        if (size != NULL) {
+  80360f:	48 85 db             	test   %rbx,%rbx
+  803612:	74 d6                	je     8035ea <ipc_recv_timed+0xb4>
+            *size = 0;
+  803614:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80361b:	eb cd                	jmp    8035ea <ipc_recv_timed+0xb4>
+
+000000000080361d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80361d:	55                   	push   %rbp
+  80361e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803621:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803627:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+}
+  803633:	5d                   	pop    %rbp
+  803634:	c3                   	ret
+
+0000000000803635 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803635:	55                   	push   %rbp
+  803636:	48 89 e5             	mov    %rsp,%rbp
+  803639:	41 57                	push   %r15
+  80363b:	41 56                	push   %r14
+  80363d:	41 55                	push   %r13
+  80363f:	41 54                	push   %r12
+  803641:	53                   	push   %rbx
+  803642:	48 83 ec 18          	sub    $0x18,%rsp
+  803646:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803649:	48 89 d3             	mov    %rdx,%rbx
+  80364c:	49 89 cc             	mov    %rcx,%r12
+  80364f:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803652:	48 85 d2             	test   %rdx,%rdx
+  803655:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80365c:	00 00 00 
+  80365f:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803663:	89 f0                	mov    %esi,%eax
+  803665:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803669:	48 89 da             	mov    %rbx,%rdx
+  80366c:	48 89 c6             	mov    %rax,%rsi
+  80366f:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+    while (res < 0) {
+  80367b:	85 c0                	test   %eax,%eax
+  80367d:	79 65                	jns    8036e4 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80367f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803682:	75 33                	jne    8036b7 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803684:	49 bf a3 11 80 00 00 	movabs $0x8011a3,%r15
+  80368b:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80368e:	49 be a0 14 80 00 00 	movabs $0x8014a0,%r14
+  803695:	00 00 00 
+        sys_yield();
+  803698:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80369b:	45 89 e8             	mov    %r13d,%r8d
+  80369e:	4c 89 e1             	mov    %r12,%rcx
+  8036a1:	48 89 da             	mov    %rbx,%rdx
+  8036a4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036a8:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8036ab:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8036ae:	85 c0                	test   %eax,%eax
+  8036b0:	79 32                	jns    8036e4 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036b2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036b5:	74 e1                	je     803698 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8036b7:	89 c1                	mov    %eax,%ecx
+  8036b9:	48 ba a3 3e 80 00 00 	movabs $0x803ea3,%rdx
+  8036c0:	00 00 00 
+  8036c3:	be 52 00 00 00       	mov    $0x52,%esi
+  8036c8:	48 bf b7 3e 80 00 00 	movabs $0x803eb7,%rdi
+  8036cf:	00 00 00 
+  8036d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d7:	49 b8 93 34 80 00 00 	movabs $0x803493,%r8
+  8036de:	00 00 00 
+  8036e1:	41 ff d0             	call   *%r8
+    }
+}
+  8036e4:	48 83 c4 18          	add    $0x18,%rsp
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	41 5d                	pop    %r13
+  8036ed:	41 5e                	pop    %r14
+  8036ef:	41 5f                	pop    %r15
+  8036f1:	5d                   	pop    %rbp
+  8036f2:	c3                   	ret
+
+00000000008036f3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036f3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036f8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036ff:	00 00 00 
+  803702:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803706:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80370a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80370e:	48 01 ca             	add    %rcx,%rdx
+  803711:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803717:	39 fa                	cmp    %edi,%edx
+  803719:	74 12                	je     80372d <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80371b:	48 83 c0 01          	add    $0x1,%rax
+  80371f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803725:	75 db                	jne    803702 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80372c:	c3                   	ret
+            return envs[i].env_id;
+  80372d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803731:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803735:	48 c1 e2 04          	shl    $0x4,%rdx
+  803739:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803740:	00 00 00 
+  803743:	48 01 d0             	add    %rdx,%rax
+  803746:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80374c:	c3                   	ret
+  80374d:	0f 1f 00             	nopl   (%rax)
+
+0000000000803750 <__rodata_start>:
+  803750:	55                   	push   %rbp
+  803751:	73 61                	jae    8037b4 <__rodata_start+0x64>
+  803753:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  803757:	73 65                	jae    8037be <__rodata_start+0x6e>
+  803759:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80375a:	64 73 68             	fs jae 8037c5 <__rodata_start+0x75>
+  80375d:	20 3c 70             	and    %bh,(%rax,%rsi,2)
+  803760:	61                   	(bad)
+  803761:	72 65                	jb     8037c8 <__rodata_start+0x78>
+  803763:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803764:	74 20                	je     803786 <__rodata_start+0x36>
+  803766:	73 6e                	jae    8037d6 <__rodata_start+0x86>
+  803768:	61                   	(bad)
+  803769:	70 73                	jo     8037de <__rodata_start+0x8e>
+  80376b:	68 6f 74 3e 20       	push   $0x203e746f
+  803770:	3c 73                	cmp    $0x73,%al
+  803772:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803773:	61                   	(bad)
+  803774:	70 73                	jo     8037e9 <__rodata_start+0x99>
+  803776:	68 6f 74 3e 20       	push   $0x203e746f
+  80377b:	3c 73                	cmp    $0x73,%al
+  80377d:	74 72                	je     8037f1 <__rodata_start+0xa1>
+  80377f:	65 61                	gs (bad)
+  803781:	6d                   	insl   (%dx),%es:(%rdi)
+  803782:	20 66 69             	and    %ah,0x69(%rsi)
+  803785:	6c                   	insb   (%dx),%es:(%rdi)
+  803786:	65 3e 0a 00          	gs or  %gs:(%rax),%al
+  80378a:	00 00                	add    %al,(%rax)
+  80378c:	00 00                	add    %al,(%rax)
+  80378e:	00 00                	add    %al,(%rax)
+  803790:	20 20                	and    %ah,(%rax)
+  803792:	20 20                	and    %ah,(%rax)
+  803794:	20 20                	and    %ah,(%rax)
+  803796:	20 61 72             	and    %ah,0x72(%rcx)
+  803799:	67 20 70 6f          	and    %dh,0x6f(%eax)
+  80379d:	73 69                	jae    803808 <__rodata_start+0xb8>
+  80379f:	74 69                	je     80380a <__rodata_start+0xba>
+  8037a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a3:	20 25 64 20 61 72    	and    %ah,0x72612064(%rip)        # 72e1580d <__bss_end+0x7260d80d>
+  8037a9:	67 75 6d             	addr32 jne 803819 <__rodata_start+0xc9>
+  8037ac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037ae:	74 3a                	je     8037ea <__rodata_start+0x9a>
+  8037b0:	25 73 0a 00 53       	and    $0x53000a73,%eax
+  8037b5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037b6:	61                   	(bad)
+  8037b7:	70 73                	jo     80382c <__rodata_start+0xdc>
+  8037b9:	68 6f 74 20 63       	push   $0x6320746f
+  8037be:	61                   	(bad)
+  8037bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c2:	74 20                	je     8037e4 <__rodata_start+0x94>
+  8037c4:	62 65                	(bad)
+  8037c6:	20 73 65             	and    %dh,0x65(%rbx)
+  8037c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ca:	74 3a                	je     803806 <__rodata_start+0xb6>
+  8037cc:	20 25 69 0a 00 73    	and    %ah,0x73000a69(%rip)        # 7380423b <__bss_end+0x72ffc23b>
+  8037d2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037d4:	74 20                	je     8037f6 <__rodata_start+0xa6>
+  8037d6:	25 64 20 62 79       	and    $0x79622064,%eax
+  8037db:	74 65                	je     803842 <__rodata_start+0xf2>
+  8037dd:	73 20                	jae    8037ff <__rodata_start+0xaf>
+  8037df:	74 6f                	je     803850 <__rodata_start+0x100>
+  8037e1:	20 25 73 0a 00 3c    	and    %ah,0x3c000a73(%rip)        # 3c80425a <__bss_end+0x3bffc25a>
+  8037e7:	75 6e                	jne    803857 <__rodata_start+0x107>
+  8037e9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8037ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ee:	3e 00 30             	ds add %dh,(%rax)
+  8037f1:	31 32                	xor    %esi,(%rdx)
+  8037f3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8037fa:	41                   	rex.B
+  8037fb:	42                   	rex.X
+  8037fc:	43                   	rex.XB
+  8037fd:	44                   	rex.R
+  8037fe:	45                   	rex.RB
+  8037ff:	46 00 30             	rex.RX add %r14b,(%rax)
+  803802:	31 32                	xor    %esi,(%rdx)
+  803804:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80380b:	61                   	(bad)
+  80380c:	62 63 64 65 66       	(bad)
+  803811:	00 28                	add    %ch,(%rax)
+  803813:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803814:	75 6c                	jne    803882 <__rodata_start+0x132>
+  803816:	6c                   	insb   (%dx),%es:(%rdi)
+  803817:	29 00                	sub    %eax,(%rax)
+  803819:	65 72 72             	gs jb  80388e <__rodata_start+0x13e>
+  80381c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80381d:	72 20                	jb     80383f <__rodata_start+0xef>
+  80381f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803824:	73 70                	jae    803896 <__rodata_start+0x146>
+  803826:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80382a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803831:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803832:	72 00                	jb     803834 <__rodata_start+0xe4>
+  803834:	62 61 64 20 65       	(bad)
+  803839:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80383a:	76 69                	jbe    8038a5 <__rodata_start+0x155>
+  80383c:	72 6f                	jb     8038ad <__rodata_start+0x15d>
+  80383e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80383f:	6d                   	insl   (%dx),%es:(%rdi)
+  803840:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803842:	74 00                	je     803844 <__rodata_start+0xf4>
+  803844:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80384b:	20 70 61             	and    %dh,0x61(%rax)
+  80384e:	72 61                	jb     8038b1 <__rodata_start+0x161>
+  803850:	6d                   	insl   (%dx),%es:(%rdi)
+  803851:	65 74 65             	gs je  8038b9 <__rodata_start+0x169>
+  803854:	72 00                	jb     803856 <__rodata_start+0x106>
+  803856:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803857:	75 74                	jne    8038cd <__rodata_start+0x17d>
+  803859:	20 6f 66             	and    %ch,0x66(%rdi)
+  80385c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80385f:	6d                   	insl   (%dx),%es:(%rdi)
+  803860:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803861:	72 79                	jb     8038dc <__rodata_start+0x18c>
+  803863:	00 6f 75             	add    %ch,0x75(%rdi)
+  803866:	74 20                	je     803888 <__rodata_start+0x138>
+  803868:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803869:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80386d:	76 69                	jbe    8038d8 <__rodata_start+0x188>
+  80386f:	72 6f                	jb     8038e0 <__rodata_start+0x190>
+  803871:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803872:	6d                   	insl   (%dx),%es:(%rdi)
+  803873:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803875:	74 73                	je     8038ea <__rodata_start+0x19a>
+  803877:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80387a:	72 72                	jb     8038ee <__rodata_start+0x19e>
+  80387c:	75 70                	jne    8038ee <__rodata_start+0x19e>
+  80387e:	74 65                	je     8038e5 <__rodata_start+0x195>
+  803880:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803885:	75 67                	jne    8038ee <__rodata_start+0x19e>
+  803887:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80388a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80388c:	00 73 65             	add    %dh,0x65(%rbx)
+  80388f:	67 6d                	insl   (%dx),%es:(%edi)
+  803891:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803893:	74 61                	je     8038f6 <__rodata_start+0x1a6>
+  803895:	74 69                	je     803900 <__rodata_start+0x1b0>
+  803897:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803898:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803899:	20 66 61             	and    %ah,0x61(%rsi)
+  80389c:	75 6c                	jne    80390a <__rodata_start+0x1ba>
+  80389e:	74 00                	je     8038a0 <__rodata_start+0x150>
+  8038a0:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038a7:	20 45 4c             	and    %al,0x4c(%rbp)
+  8038aa:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8038ae:	61                   	(bad)
+  8038af:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8038b4:	20 73 75             	and    %dh,0x75(%rbx)
+  8038b7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8038ba:	73 79                	jae    803935 <__rodata_start+0x1e5>
+  8038bc:	73 74                	jae    803932 <__rodata_start+0x1e2>
+  8038be:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8038c0:	20 63 61             	and    %ah,0x61(%rbx)
+  8038c3:	6c                   	insb   (%dx),%es:(%rdi)
+  8038c4:	6c                   	insb   (%dx),%es:(%rdi)
+  8038c5:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8038c8:	74 72                	je     80393c <__rodata_start+0x1ec>
+  8038ca:	79 20                	jns    8038ec <__rodata_start+0x19c>
+  8038cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ce:	74 20                	je     8038f0 <__rodata_start+0x1a0>
+  8038d0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038d2:	75 6e                	jne    803942 <__rodata_start+0x1f2>
+  8038d4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8038d8:	76 20                	jbe    8038fa <__rodata_start+0x1aa>
+  8038da:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8038e1:	72 65                	jb     803948 <__rodata_start+0x1f8>
+  8038e3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8038e6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8038eb:	65 78 70             	gs js  80395e <__rodata_start+0x20e>
+  8038ee:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8038f3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8038f6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8038fa:	20 66 69             	and    %ah,0x69(%rsi)
+  8038fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8038fe:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803902:	20 66 72             	and    %ah,0x72(%rsi)
+  803905:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80390a:	61                   	(bad)
+  80390b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80390e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803910:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803914:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803917:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803918:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803919:	20 6d 61             	and    %ch,0x61(%rbp)
+  80391c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80391d:	79 20                	jns    80393f <__rodata_start+0x1ef>
+  80391f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803926:	72 65                	jb     80398d <__rodata_start+0x23d>
+  803928:	20 6f 70             	and    %ch,0x70(%rdi)
+  80392b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80392d:	00 66 69             	add    %ah,0x69(%rsi)
+  803930:	6c                   	insb   (%dx),%es:(%rdi)
+  803931:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803935:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803938:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803939:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80393c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80393d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393e:	74 20                	je     803960 <__rodata_start+0x210>
+  803940:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803942:	75 6e                	jne    8039b2 <__rodata_start+0x262>
+  803944:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803948:	76 61                	jbe    8039ab <__rodata_start+0x25b>
+  80394a:	6c                   	insb   (%dx),%es:(%rdi)
+  80394b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803952:	00 
+  803953:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80395a:	72 65                	jb     8039c1 <__rodata_start+0x271>
+  80395c:	61                   	(bad)
+  80395d:	64 79 20             	fs jns 803980 <__rodata_start+0x230>
+  803960:	65 78 69             	gs js  8039cc <__rodata_start+0x27c>
+  803963:	73 74                	jae    8039d9 <__rodata_start+0x289>
+  803965:	73 00                	jae    803967 <__rodata_start+0x217>
+  803967:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803968:	70 65                	jo     8039cf <__rodata_start+0x27f>
+  80396a:	72 61                	jb     8039cd <__rodata_start+0x27d>
+  80396c:	74 69                	je     8039d7 <__rodata_start+0x287>
+  80396e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80396f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803970:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803973:	74 20                	je     803995 <__rodata_start+0x245>
+  803975:	73 75                	jae    8039ec <__rodata_start+0x29c>
+  803977:	70 70                	jo     8039e9 <__rodata_start+0x299>
+  803979:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80397a:	72 74                	jb     8039f0 <__rodata_start+0x2a0>
+  80397c:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803982:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803987:	74 00                	je     803989 <__rodata_start+0x239>
+  803989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803990:	00 00 00 
+  803993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80399a:	00 00 00 
+  80399d:	0f 1f 00             	nopl   (%rax)
+  8039a0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039a1:	04 80                	add    $0x80,%al
+  8039a3:	00 00                	add    %al,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 9f 0a 80 00 00    	add    %bl,0x800a(%rdi)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 8d 04 80 00 00    	add    %cl,0x8004(%rbp)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 81 04 80 00 00    	add    %al,0x8004(%rcx)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 fb                	add    %bh,%bl
+  8039f9:	04 80                	add    $0x80,%al
+  8039fb:	00 00                	add    %al,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 81 04 80 00 00    	add    %al,0x8004(%rcx)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 c7                	add    %al,%bh
+  803a11:	04 80                	add    $0x80,%al
+  803a13:	00 00                	add    %al,(%rax)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 c7                	add    %al,%bh
+  803a19:	04 80                	add    $0x80,%al
+  803a1b:	00 00                	add    %al,(%rax)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 c7                	add    %al,%bh
+  803a21:	04 80                	add    $0x80,%al
+  803a23:	00 00                	add    %al,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 c7                	add    %al,%bh
+  803a29:	04 80                	add    $0x80,%al
+  803a2b:	00 00                	add    %al,(%rax)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 c7                	add    %al,%bh
+  803a31:	04 80                	add    $0x80,%al
+  803a33:	00 00                	add    %al,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 c7                	add    %al,%bh
+  803a39:	04 80                	add    $0x80,%al
+  803a3b:	00 00                	add    %al,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 c7                	add    %al,%bh
+  803a41:	04 80                	add    $0x80,%al
+  803a43:	00 00                	add    %al,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 c7                	add    %al,%bh
+  803a49:	04 80                	add    $0x80,%al
+  803a4b:	00 00                	add    %al,(%rax)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 c7                	add    %al,%bh
+  803a51:	04 80                	add    $0x80,%al
+  803a53:	00 00                	add    %al,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 d2                	add    %dl,%dl
+  803b49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803b4f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 1e                	add    %bl,(%rsi)
+  803ba1:	05 80 00 00 00       	add    $0x80,%eax
+  803ba6:	00 00                	add    %al,(%rax)
+  803ba8:	ed                   	in     (%dx),%eax
+  803ba9:	06                   	(bad)
+  803baa:	80 00 00             	addb   $0x0,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 4d 05             	add    %cl,0x5(%rbp)
+  803bd2:	80 00 00             	addb   $0x0,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 13                	add    %dl,(%rbx)
+  803be9:	05 80 00 00 00       	add    $0x80,%eax
+  803bee:	00 00                	add    %al,(%rax)
+  803bf0:	af                   	scas   %es:(%rdi),%eax
+  803bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bf7:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 95 08 80 00 00    	add    %dl,0x8008(%rbp)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 5f 09             	add    %bl,0x9(%rdi)
+  803c0a:	80 00 00             	addb   $0x0,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 e4                	add    %ah,%ah
+  803c21:	05 80 00 00 00       	add    $0x80,%eax
+  803c26:	00 00                	add    %al,(%rax)
+  803c28:	af                   	scas   %es:(%rdi),%eax
+  803c29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c2f:	00 c1                	add    %al,%cl
+  803c31:	07                   	(bad)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 d2                	add    %dl,%dl
+  803c49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803c4f:	00 af 0a 80 00 00    	add    %ch,0x800a(%rdi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 77 04             	add    %dh,0x4(%rdi)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	22 38 80 00 00 00 00 00 34 38 80 00 00 00 00 00     "8......48......
+  803c78:	44 38 80 00 00 00 00 00 56 38 80 00 00 00 00 00     D8......V8......
+  803c88:	64 38 80 00 00 00 00 00 78 38 80 00 00 00 00 00     d8......x8......
+  803c98:	8d 38 80 00 00 00 00 00 a0 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	b2 38 80 00 00 00 00 00 c6 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	d6 38 80 00 00 00 00 00 e9 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	00 39 80 00 00 00 00 00 16 39 80 00 00 00 00 00     .9.......9......
+  803cd8:	2e 39 80 00 00 00 00 00 46 39 80 00 00 00 00 00     .9......F9......
+  803ce8:	53 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     S9.......=......
+  803cf8:	67 39 80 00 00 00 00 00 7f 39 80 00 00 00 00 00     g9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803d28:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803d38:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803d48:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803d58:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d68:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d78:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803d88:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803d98:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803da8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803db8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803dc8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803dd8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803de8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803df8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803e00 <devtab>:
+  803e00:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803e10:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803e20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803e30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803e40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803e50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803e80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803e90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803ea0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803eb0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,9334 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8e 0a 00 00       	call   800ab1 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  800025:	48 85 ff             	test   %rdi,%rdi
+  800028:	0f 84 e3 00 00 00    	je     800111 <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80002e:	55                   	push   %rbp
+  80002f:	48 89 e5             	mov    %rsp,%rbp
+  800032:	41 57                	push   %r15
+  800034:	41 56                	push   %r14
+  800036:	41 55                	push   %r13
+  800038:	41 54                	push   %r12
+  80003a:	53                   	push   %rbx
+  80003b:	48 83 ec 08          	sub    $0x8,%rsp
+  80003f:	48 89 fb             	mov    %rdi,%rbx
+  800042:	49 89 f7             	mov    %rsi,%r15
+  800045:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  800048:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80004f:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  800056:	49 bd 18 4e 80 00 00 	movabs $0x804e18,%r13
+  80005d:	00 00 00 
+  800060:	49 bc fc 16 80 00 00 	movabs $0x8016fc,%r12
+  800067:	00 00 00 
+  80006a:	eb 08                	jmp    800074 <_gettoken+0x4f>
+        *s++ = 0;
+  80006c:	48 83 c3 01          	add    $0x1,%rbx
+  800070:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  800074:	0f be 33             	movsbl (%rbx),%esi
+  800077:	4c 89 ef             	mov    %r13,%rdi
+  80007a:	41 ff d4             	call   *%r12
+  80007d:	48 85 c0             	test   %rax,%rax
+  800080:	75 ea                	jne    80006c <_gettoken+0x47>
+    if (*s == 0) {
+  800082:	0f b6 33             	movzbl (%rbx),%esi
+  800085:	40 84 f6             	test   %sil,%sil
+  800088:	75 0f                	jne    800099 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  80008a:	48 83 c4 08          	add    $0x8,%rsp
+  80008e:	5b                   	pop    %rbx
+  80008f:	41 5c                	pop    %r12
+  800091:	41 5d                	pop    %r13
+  800093:	41 5e                	pop    %r14
+  800095:	41 5f                	pop    %r15
+  800097:	5d                   	pop    %rbp
+  800098:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  800099:	40 0f be f6          	movsbl %sil,%esi
+  80009d:	48 bf 21 4e 80 00 00 	movabs $0x804e21,%rdi
+  8000a4:	00 00 00 
+  8000a7:	48 b8 fc 16 80 00 00 	movabs $0x8016fc,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+  8000b3:	48 85 c0             	test   %rax,%rax
+  8000b6:	74 12                	je     8000ca <_gettoken+0xa5>
+        t = *s;
+  8000b8:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  8000bb:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  8000be:	c6 03 00             	movb   $0x0,(%rbx)
+  8000c1:	48 83 c3 01          	add    $0x1,%rbx
+  8000c5:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8000c8:	eb c0                	jmp    80008a <_gettoken+0x65>
+    *p1 = s;
+  8000ca:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000cd:	0f b6 33             	movzbl (%rbx),%esi
+  8000d0:	49 bd 1d 4e 80 00 00 	movabs $0x804e1d,%r13
+  8000d7:	00 00 00 
+  8000da:	49 bc fc 16 80 00 00 	movabs $0x8016fc,%r12
+  8000e1:	00 00 00 
+  8000e4:	40 84 f6             	test   %sil,%sil
+  8000e7:	74 1b                	je     800104 <_gettoken+0xdf>
+  8000e9:	40 0f be f6          	movsbl %sil,%esi
+  8000ed:	4c 89 ef             	mov    %r13,%rdi
+  8000f0:	41 ff d4             	call   *%r12
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	75 0c                	jne    800104 <_gettoken+0xdf>
+        s++;
+  8000f8:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000fc:	0f b6 33             	movzbl (%rbx),%esi
+  8000ff:	40 84 f6             	test   %sil,%sil
+  800102:	75 e5                	jne    8000e9 <_gettoken+0xc4>
+    *p2 = s;
+  800104:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  800107:	b8 77 00 00 00       	mov    $0x77,%eax
+  80010c:	e9 79 ff ff ff       	jmp    80008a <_gettoken+0x65>
+        return 0;
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800116:	c3                   	ret
+
+0000000000800117 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  80011e:	48 85 ff             	test   %rdi,%rdi
+  800121:	74 33                	je     800156 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  800123:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80012a:	00 00 00 
+  80012d:	48 be 10 70 80 00 00 	movabs $0x807010,%rsi
+  800134:	00 00 00 
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	a3 04 70 80 00 00 00 	movabs %eax,0x807004
+  80014a:	00 00 
+        return 0;
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  800151:	5b                   	pop    %rbx
+  800152:	41 5c                	pop    %r12
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+    c = nc;
+  800156:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80015d:	00 00 00 
+  800160:	49 bc 04 70 80 00 00 	movabs $0x807004,%r12
+  800167:	00 00 00 
+  80016a:	41 8b 04 24          	mov    (%r12),%eax
+  80016e:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  800170:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  800177:	00 00 00 
+  80017a:	48 8b 10             	mov    (%rax),%rdx
+  80017d:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  800180:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800187:	00 00 00 
+  80018a:	48 8b 3a             	mov    (%rdx),%rdi
+  80018d:	48 89 c6             	mov    %rax,%rsi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+  80019c:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  8001a0:	8b 03                	mov    (%rbx),%eax
+  8001a2:	eb ad                	jmp    800151 <gettoken+0x3a>
+
+00000000008001a4 <runcmd>:
+runcmd(char *s) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 56                	push   %r14
+  8001aa:	41 55                	push   %r13
+  8001ac:	41 54                	push   %r12
+  8001ae:	53                   	push   %rbx
+  8001af:	48 81 ec 90 04 00 00 	sub    $0x490,%rsp
+    gettoken(s, 0);
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+        switch ((c = gettoken(0, &t))) {
+  8001c7:	49 bd 17 01 80 00 00 	movabs $0x800117,%r13
+  8001ce:	00 00 00 
+    argc = 0;
+  8001d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        switch ((c = gettoken(0, &t))) {
+  8001d7:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8001de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e3:	41 ff d5             	call   *%r13
+  8001e6:	89 c3                	mov    %eax,%ebx
+  8001e8:	83 f8 3e             	cmp    $0x3e,%eax
+  8001eb:	0f 84 93 01 00 00    	je     800384 <runcmd+0x1e0>
+  8001f1:	7f 7f                	jg     800272 <runcmd+0xce>
+  8001f3:	85 c0                	test   %eax,%eax
+  8001f5:	0f 84 c5 02 00 00    	je     8004c0 <runcmd+0x31c>
+  8001fb:	83 f8 3c             	cmp    $0x3c,%eax
+  8001fe:	0f 85 94 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if (gettoken(0, &t) != 'w') {
+  800204:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800210:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+  80021c:	83 f8 77             	cmp    $0x77,%eax
+  80021f:	0f 85 02 01 00 00    	jne    800327 <runcmd+0x183>
+            fd = open(t, O_RDONLY);
+  800225:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  80022c:	be 00 00 00 00       	mov    $0x0,%esi
+  800231:	4c 89 f7             	mov    %r14,%rdi
+  800234:	48 b8 f6 38 80 00 00 	movabs $0x8038f6,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	89 c3                	mov    %eax,%ebx
+            if (fd < 0) {
+  800242:	85 c0                	test   %eax,%eax
+  800244:	0f 88 09 01 00 00    	js     800353 <runcmd+0x1af>
+			} else if (fd != 0) {
+  80024a:	74 8b                	je     8001d7 <runcmd+0x33>
+                dup(fd, 0);
+  80024c:	be 00 00 00 00       	mov    $0x0,%esi
+  800251:	89 c7                	mov    %eax,%edi
+  800253:	48 b8 74 26 80 00 00 	movabs $0x802674,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+                close(fd);
+  80025f:	89 df                	mov    %ebx,%edi
+  800261:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  800268:	00 00 00 
+  80026b:	ff d0                	call   *%rax
+  80026d:	e9 65 ff ff ff       	jmp    8001d7 <runcmd+0x33>
+        switch ((c = gettoken(0, &t))) {
+  800272:	83 f8 77             	cmp    $0x77,%eax
+  800275:	74 65                	je     8002dc <runcmd+0x138>
+  800277:	83 f8 7c             	cmp    $0x7c,%eax
+  80027a:	0f 85 18 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if ((r = pipe(p)) < 0) {
+  800280:	48 8d bd 50 fb ff ff 	lea    -0x4b0(%rbp),%rdi
+  800287:	48 b8 11 47 80 00 00 	movabs $0x804711,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+  800293:	85 c0                	test   %eax,%eax
+  800295:	0f 88 ad 01 00 00    	js     800448 <runcmd+0x2a4>
+            if ((r = fork()) < 0) {
+  80029b:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	89 c3                	mov    %eax,%ebx
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 c5 01 00 00    	js     800476 <runcmd+0x2d2>
+            if (r == 0) {
+  8002b1:	0f 85 e8 01 00 00    	jne    80049f <runcmd+0x2fb>
+                if (p[0] != 0) {
+  8002b7:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  8002bd:	85 ff                	test   %edi,%edi
+  8002bf:	0f 85 83 02 00 00    	jne    800548 <runcmd+0x3a4>
+                close(p[1]);
+  8002c5:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8002cb:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+                goto again;
+  8002d7:	e9 f5 fe ff ff       	jmp    8001d1 <runcmd+0x2d>
+            if (argc == MAXARGS) {
+  8002dc:	41 83 fc 10          	cmp    $0x10,%r12d
+  8002e0:	74 1c                	je     8002fe <runcmd+0x15a>
+            argv[argc++] = t;
+  8002e2:	49 63 c4             	movslq %r12d,%rax
+  8002e5:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  8002ec:	48 89 94 c5 60 ff ff 	mov    %rdx,-0xa0(%rbp,%rax,8)
+  8002f3:	ff 
+  8002f4:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+            break;
+  8002f9:	e9 d9 fe ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("too many arguments\n");
+  8002fe:	48 bf 29 4e 80 00 00 	movabs $0x804e29,%rdi
+  800305:	00 00 00 
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  800314:	00 00 00 
+  800317:	ff d2                	call   *%rdx
+                exit();
+  800319:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+  800325:	eb bb                	jmp    8002e2 <runcmd+0x13e>
+                cprintf("syntax error: < not followed by word\n");
+  800327:	48 bf e0 4e 80 00 00 	movabs $0x804ee0,%rdi
+  80032e:	00 00 00 
+  800331:	b8 00 00 00 00       	mov    $0x0,%eax
+  800336:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  80033d:	00 00 00 
+  800340:	ff d2                	call   *%rdx
+                exit();
+  800342:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800349:	00 00 00 
+  80034c:	ff d0                	call   *%rax
+  80034e:	e9 d2 fe ff ff       	jmp    800225 <runcmd+0x81>
+				cprintf("open %s for read %i", t, fd);
+  800353:	89 c2                	mov    %eax,%edx
+  800355:	4c 89 f6             	mov    %r14,%rsi
+  800358:	48 bf 3d 4e 80 00 00 	movabs $0x804e3d,%rdi
+  80035f:	00 00 00 
+  800362:	b8 00 00 00 00       	mov    $0x0,%eax
+  800367:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  80036e:	00 00 00 
+  800371:	ff d1                	call   *%rcx
+				exit();
+  800373:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+  80037f:	e9 53 fe ff ff       	jmp    8001d7 <runcmd+0x33>
+            if (gettoken(0, &t) != 'w') {
+  800384:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80038b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800390:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+  80039c:	83 f8 77             	cmp    $0x77,%eax
+  80039f:	75 2c                	jne    8003cd <runcmd+0x229>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  8003a1:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  8003a8:	be 01 03 00 00       	mov    $0x301,%esi
+  8003ad:	4c 89 f7             	mov    %r14,%rdi
+  8003b0:	48 b8 f6 38 80 00 00 	movabs $0x8038f6,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+  8003bc:	89 c3                	mov    %eax,%ebx
+  8003be:	85 c0                	test   %eax,%eax
+  8003c0:	78 34                	js     8003f6 <runcmd+0x252>
+            if (fd != 1) {
+  8003c2:	83 f8 01             	cmp    $0x1,%eax
+  8003c5:	0f 84 0c fe ff ff    	je     8001d7 <runcmd+0x33>
+  8003cb:	eb 55                	jmp    800422 <runcmd+0x27e>
+                cprintf("syntax error: > not followed by word\n");
+  8003cd:	48 bf 08 4f 80 00 00 	movabs $0x804f08,%rdi
+  8003d4:	00 00 00 
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  8003e3:	00 00 00 
+  8003e6:	ff d2                	call   *%rdx
+                exit();
+  8003e8:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	eb ab                	jmp    8003a1 <runcmd+0x1fd>
+                cprintf("open %s for write: %i", t, fd);
+  8003f6:	89 c2                	mov    %eax,%edx
+  8003f8:	4c 89 f6             	mov    %r14,%rsi
+  8003fb:	48 bf 51 4e 80 00 00 	movabs $0x804e51,%rdi
+  800402:	00 00 00 
+  800405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040a:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  800411:	00 00 00 
+  800414:	ff d1                	call   *%rcx
+                exit();
+  800416:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+                dup(fd, 1);
+  800422:	be 01 00 00 00       	mov    $0x1,%esi
+  800427:	89 df                	mov    %ebx,%edi
+  800429:	48 b8 74 26 80 00 00 	movabs $0x802674,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+                close(fd);
+  800435:	89 df                	mov    %ebx,%edi
+  800437:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  80043e:	00 00 00 
+  800441:	ff d0                	call   *%rax
+  800443:	e9 8f fd ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("pipe: %i", r);
+  800448:	89 c6                	mov    %eax,%esi
+  80044a:	48 bf 67 4e 80 00 00 	movabs $0x804e67,%rdi
+  800451:	00 00 00 
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  800460:	00 00 00 
+  800463:	ff d2                	call   *%rdx
+                exit();
+  800465:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+  800471:	e9 25 fe ff ff       	jmp    80029b <runcmd+0xf7>
+                cprintf("fork: %i", r);
+  800476:	89 c6                	mov    %eax,%esi
+  800478:	48 bf 70 4e 80 00 00 	movabs $0x804e70,%rdi
+  80047f:	00 00 00 
+  800482:	b8 00 00 00 00       	mov    $0x0,%eax
+  800487:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  80048e:	00 00 00 
+  800491:	ff d2                	call   *%rdx
+                exit();
+  800493:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  80049f:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8004a5:	83 ff 01             	cmp    $0x1,%edi
+  8004a8:	0f 85 c2 00 00 00    	jne    800570 <runcmd+0x3cc>
+                close(p[0]);
+  8004ae:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  8004b4:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+    if (argc == 0) {
+  8004c0:	45 85 e4             	test   %r12d,%r12d
+  8004c3:	74 73                	je     800538 <runcmd+0x394>
+    if (argv[0][0] != '/') {
+  8004c5:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8004cc:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  8004cf:	0f 85 f0 00 00 00    	jne    8005c5 <runcmd+0x421>
+    argv[argc] = 0;
+  8004d5:	4d 63 e4             	movslq %r12d,%r12
+  8004d8:	4a c7 84 e5 60 ff ff 	movq   $0x0,-0xa0(%rbp,%r12,8)
+  8004df:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8004e4:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  8004eb:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  8004f2:	48 b8 c2 3b 80 00 00 	movabs $0x803bc2,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	41 89 c4             	mov    %eax,%r12d
+  800501:	85 c0                	test   %eax,%eax
+  800503:	0f 88 e9 00 00 00    	js     8005f2 <runcmd+0x44e>
+    close_all();
+  800509:	48 b8 4c 26 80 00 00 	movabs $0x80264c,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+        wait(r);
+  800515:	44 89 e7             	mov    %r12d,%edi
+  800518:	48 b8 70 49 80 00 00 	movabs $0x804970,%rax
+  80051f:	00 00 00 
+  800522:	ff d0                	call   *%rax
+    if (pipe_child) {
+  800524:	85 db                	test   %ebx,%ebx
+  800526:	0f 85 fb 00 00 00    	jne    800627 <runcmd+0x483>
+    exit();
+  80052c:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800533:	00 00 00 
+  800536:	ff d0                	call   *%rax
+}
+  800538:	48 81 c4 90 04 00 00 	add    $0x490,%rsp
+  80053f:	5b                   	pop    %rbx
+  800540:	41 5c                	pop    %r12
+  800542:	41 5d                	pop    %r13
+  800544:	41 5e                	pop    %r14
+  800546:	5d                   	pop    %rbp
+  800547:	c3                   	ret
+                    dup(p[0], 0);
+  800548:	be 00 00 00 00       	mov    $0x0,%esi
+  80054d:	48 b8 74 26 80 00 00 	movabs $0x802674,%rax
+  800554:	00 00 00 
+  800557:	ff d0                	call   *%rax
+                    close(p[0]);
+  800559:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  80055f:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+  80056b:	e9 55 fd ff ff       	jmp    8002c5 <runcmd+0x121>
+                    dup(p[1], 1);
+  800570:	be 01 00 00 00       	mov    $0x1,%esi
+  800575:	48 b8 74 26 80 00 00 	movabs $0x802674,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+                    close(p[1]);
+  800581:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  800587:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+  800593:	e9 16 ff ff ff       	jmp    8004ae <runcmd+0x30a>
+            panic("bad return %d from gettoken", c);
+  800598:	89 d9                	mov    %ebx,%ecx
+  80059a:	48 ba 79 4e 80 00 00 	movabs $0x804e79,%rdx
+  8005a1:	00 00 00 
+  8005a4:	be 70 00 00 00       	mov    $0x70,%esi
+  8005a9:	48 bf 95 4e 80 00 00 	movabs $0x804e95,%rdi
+  8005b0:	00 00 00 
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  8005bf:	00 00 00 
+  8005c2:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  8005c5:	c6 85 58 fb ff ff 2f 	movb   $0x2f,-0x4a8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  8005cc:	4c 8d ad 58 fb ff ff 	lea    -0x4a8(%rbp),%r13
+  8005d3:	48 8d bd 59 fb ff ff 	lea    -0x4a7(%rbp),%rdi
+  8005da:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  8005e6:	4c 89 ad 60 ff ff ff 	mov    %r13,-0xa0(%rbp)
+  8005ed:	e9 e3 fe ff ff       	jmp    8004d5 <runcmd+0x331>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  8005f2:	89 c2                	mov    %eax,%edx
+  8005f4:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8005fb:	48 bf 9f 4e 80 00 00 	movabs $0x804e9f,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  800611:	00 00 00 
+  800614:	ff d1                	call   *%rcx
+    close_all();
+  800616:	48 b8 4c 26 80 00 00 	movabs $0x80264c,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+    if (r >= 0) {
+  800622:	e9 fd fe ff ff       	jmp    800524 <runcmd+0x380>
+        wait(pipe_child);
+  800627:	89 df                	mov    %ebx,%edi
+  800629:	48 b8 70 49 80 00 00 	movabs $0x804970,%rax
+  800630:	00 00 00 
+  800633:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800635:	e9 f2 fe ff ff       	jmp    80052c <runcmd+0x388>
+
+000000000080063a <usage>:
+
+void
+usage(void) {
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  80063e:	48 bf 30 4f 80 00 00 	movabs $0x804f30,%rdi
+  800645:	00 00 00 
+  800648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064d:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  800654:	00 00 00 
+  800657:	ff d2                	call   *%rdx
+    exit();
+  800659:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800660:	00 00 00 
+  800663:	ff d0                	call   *%rax
+}
+  800665:	5d                   	pop    %rbp
+  800666:	c3                   	ret
+
+0000000000800667 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800667:	55                   	push   %rbp
+  800668:	48 89 e5             	mov    %rsp,%rbp
+  80066b:	41 57                	push   %r15
+  80066d:	41 56                	push   %r14
+  80066f:	41 55                	push   %r13
+  800671:	41 54                	push   %r12
+  800673:	53                   	push   %rbx
+  800674:	48 83 ec 38          	sub    $0x38,%rsp
+  800678:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  80067b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  80067f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  800683:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800687:	48 b8 ac 22 80 00 00 	movabs $0x8022ac,%rax
+  80068e:	00 00 00 
+  800691:	ff d0                	call   *%rax
+    echocmds = 0;
+  800693:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  800699:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  80069f:	48 bb d9 22 80 00 00 	movabs $0x8022d9,%rbx
+  8006a6:	00 00 00 
+        switch (r) {
+  8006a9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  8006af:	49 bf 3a 06 80 00 00 	movabs $0x80063a,%r15
+  8006b6:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  8006b9:	eb 08                	jmp    8006c3 <umain+0x5c>
+        switch (r) {
+  8006bb:	45 89 e6             	mov    %r12d,%r14d
+  8006be:	eb 03                	jmp    8006c3 <umain+0x5c>
+            echocmds = 1;
+  8006c0:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  8006c3:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8006c7:	ff d3                	call   *%rbx
+  8006c9:	85 c0                	test   %eax,%eax
+  8006cb:	78 14                	js     8006e1 <umain+0x7a>
+        switch (r) {
+  8006cd:	83 f8 69             	cmp    $0x69,%eax
+  8006d0:	74 e9                	je     8006bb <umain+0x54>
+  8006d2:	83 f8 78             	cmp    $0x78,%eax
+  8006d5:	74 e9                	je     8006c0 <umain+0x59>
+  8006d7:	83 f8 64             	cmp    $0x64,%eax
+  8006da:	74 e7                	je     8006c3 <umain+0x5c>
+            usage();
+  8006dc:	41 ff d7             	call   *%r15
+  8006df:	eb e2                	jmp    8006c3 <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  8006e1:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006e5:	7f 3f                	jg     800726 <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  8006e7:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006eb:	74 47                	je     800734 <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  8006ed:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  8006f1:	0f 84 d8 00 00 00    	je     8007cf <umain+0x168>
+  8006f7:	45 85 f6             	test   %r14d,%r14d
+  8006fa:	49 bc d5 4e 80 00 00 	movabs $0x804ed5,%r12
+  800701:	00 00 00 
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  80070d:	49 be fa 1a 80 00 00 	movabs $0x801afa,%r14
+  800714:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  800717:	49 bf 5f 0b 80 00 00 	movabs $0x800b5f,%r15
+  80071e:	00 00 00 
+  800721:	e9 22 01 00 00       	jmp    800848 <umain+0x1e1>
+        usage();
+  800726:	48 b8 3a 06 80 00 00 	movabs $0x80063a,%rax
+  80072d:	00 00 00 
+  800730:	ff d0                	call   *%rax
+  800732:	eb b3                	jmp    8006e7 <umain+0x80>
+        close(0);
+  800734:	bf 00 00 00 00       	mov    $0x0,%edi
+  800739:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  800740:	00 00 00 
+  800743:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  800745:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800749:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80074d:	be 00 00 00 00       	mov    $0x0,%esi
+  800752:	48 b8 f6 38 80 00 00 	movabs $0x8038f6,%rax
+  800759:	00 00 00 
+  80075c:	ff d0                	call   *%rax
+  80075e:	85 c0                	test   %eax,%eax
+  800760:	78 37                	js     800799 <umain+0x132>
+        assert(r == 0);
+  800762:	74 89                	je     8006ed <umain+0x86>
+  800764:	48 b9 b9 4e 80 00 00 	movabs $0x804eb9,%rcx
+  80076b:	00 00 00 
+  80076e:	48 ba c0 4e 80 00 00 	movabs $0x804ec0,%rdx
+  800775:	00 00 00 
+  800778:	be 16 01 00 00       	mov    $0x116,%esi
+  80077d:	48 bf 95 4e 80 00 00 	movabs $0x804e95,%rdi
+  800784:	00 00 00 
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  800793:	00 00 00 
+  800796:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  800799:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80079d:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8007a1:	41 89 c0             	mov    %eax,%r8d
+  8007a4:	48 ba ad 4e 80 00 00 	movabs $0x804ead,%rdx
+  8007ab:	00 00 00 
+  8007ae:	be 15 01 00 00       	mov    $0x115,%esi
+  8007b3:	48 bf 95 4e 80 00 00 	movabs $0x804e95,%rdi
+  8007ba:	00 00 00 
+  8007bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c2:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  8007c9:	00 00 00 
+  8007cc:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  8007cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007d4:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  8007db:	00 00 00 
+  8007de:	ff d0                	call   *%rax
+  8007e0:	41 89 c6             	mov    %eax,%r14d
+  8007e3:	e9 0f ff ff ff       	jmp    8006f7 <umain+0x90>
+            exit(); /* end of file */
+  8007e8:	41 ff d7             	call   *%r15
+  8007eb:	eb 69                	jmp    800856 <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  8007ed:	48 89 de             	mov    %rbx,%rsi
+  8007f0:	48 bf d8 4e 80 00 00 	movabs $0x804ed8,%rdi
+  8007f7:	00 00 00 
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	48 b9 25 3b 80 00 00 	movabs $0x803b25,%rcx
+  800806:	00 00 00 
+  800809:	ff d1                	call   *%rcx
+  80080b:	eb 53                	jmp    800860 <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  80080d:	89 c1                	mov    %eax,%ecx
+  80080f:	48 ba 70 4e 80 00 00 	movabs $0x804e70,%rdx
+  800816:	00 00 00 
+  800819:	be 27 01 00 00       	mov    $0x127,%esi
+  80081e:	48 bf 95 4e 80 00 00 	movabs $0x804e95,%rdi
+  800825:	00 00 00 
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  800834:	00 00 00 
+  800837:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  80083a:	89 c7                	mov    %eax,%edi
+  80083c:	48 b8 70 49 80 00 00 	movabs $0x804970,%rax
+  800843:	00 00 00 
+  800846:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  800848:	4c 89 e7             	mov    %r12,%rdi
+  80084b:	41 ff d6             	call   *%r14
+  80084e:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  800851:	48 85 c0             	test   %rax,%rax
+  800854:	74 92                	je     8007e8 <umain+0x181>
+        if (buf[0] == '#') continue;
+  800856:	80 3b 23             	cmpb   $0x23,(%rbx)
+  800859:	74 ed                	je     800848 <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  80085b:	45 85 ed             	test   %r13d,%r13d
+  80085e:	75 8d                	jne    8007ed <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  800860:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	78 9d                	js     80080d <umain+0x1a6>
+        if (r == 0) {
+  800870:	75 c8                	jne    80083a <umain+0x1d3>
+            runcmd(buf);
+  800872:	48 89 df             	mov    %rbx,%rdi
+  800875:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+            exit();
+  800881:	41 ff d7             	call   *%r15
+  800884:	eb c2                	jmp    800848 <umain+0x1e1>
+
+0000000000800886 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	c3                   	ret
+
+000000000080088c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80088c:	55                   	push   %rbp
+  80088d:	48 89 e5             	mov    %rsp,%rbp
+  800890:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800893:	48 be 51 4f 80 00 00 	movabs $0x804f51,%rsi
+  80089a:	00 00 00 
+  80089d:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8008a4:	00 00 00 
+  8008a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	5d                   	pop    %rbp
+  8008af:	c3                   	ret
+
+00000000008008b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8008b0:	55                   	push   %rbp
+  8008b1:	48 89 e5             	mov    %rsp,%rbp
+  8008b4:	41 57                	push   %r15
+  8008b6:	41 56                	push   %r14
+  8008b8:	41 55                	push   %r13
+  8008ba:	41 54                	push   %r12
+  8008bc:	53                   	push   %rbx
+  8008bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8008c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8008cb:	48 85 d2             	test   %rdx,%rdx
+  8008ce:	74 7a                	je     80094a <devcons_write+0x9a>
+  8008d0:	49 89 d6             	mov    %rdx,%r14
+  8008d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8008d9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8008de:	49 bf f1 17 80 00 00 	movabs $0x8017f1,%r15
+  8008e5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8008e8:	4c 89 f3             	mov    %r14,%rbx
+  8008eb:	48 29 f3             	sub    %rsi,%rbx
+  8008ee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f3:	48 39 c3             	cmp    %rax,%rbx
+  8008f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8008fa:	4c 63 eb             	movslq %ebx,%r13
+  8008fd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800904:	48 01 c6             	add    %rax,%rsi
+  800907:	4c 89 ea             	mov    %r13,%rdx
+  80090a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800911:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  800914:	4c 89 ee             	mov    %r13,%rsi
+  800917:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80091e:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  800925:	00 00 00 
+  800928:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80092a:	41 01 dc             	add    %ebx,%r12d
+  80092d:	49 63 f4             	movslq %r12d,%rsi
+  800930:	4c 39 f6             	cmp    %r14,%rsi
+  800933:	72 b3                	jb     8008e8 <devcons_write+0x38>
+    return res;
+  800935:	49 63 c4             	movslq %r12d,%rax
+}
+  800938:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80093f:	5b                   	pop    %rbx
+  800940:	41 5c                	pop    %r12
+  800942:	41 5d                	pop    %r13
+  800944:	41 5e                	pop    %r14
+  800946:	41 5f                	pop    %r15
+  800948:	5d                   	pop    %rbp
+  800949:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80094a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800950:	eb e3                	jmp    800935 <devcons_write+0x85>
+
+0000000000800952 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800952:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095a:	48 85 c0             	test   %rax,%rax
+  80095d:	74 55                	je     8009b4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80095f:	55                   	push   %rbp
+  800960:	48 89 e5             	mov    %rsp,%rbp
+  800963:	41 55                	push   %r13
+  800965:	41 54                	push   %r12
+  800967:	53                   	push   %rbx
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80096f:	48 bb 71 1c 80 00 00 	movabs $0x801c71,%rbx
+  800976:	00 00 00 
+  800979:	49 bc 3e 1d 80 00 00 	movabs $0x801d3e,%r12
+  800980:	00 00 00 
+  800983:	eb 03                	jmp    800988 <devcons_read+0x36>
+  800985:	41 ff d4             	call   *%r12
+  800988:	ff d3                	call   *%rbx
+  80098a:	85 c0                	test   %eax,%eax
+  80098c:	74 f7                	je     800985 <devcons_read+0x33>
+    if (c < 0) return c;
+  80098e:	48 63 d0             	movslq %eax,%rdx
+  800991:	78 13                	js     8009a6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800993:	ba 00 00 00 00       	mov    $0x0,%edx
+  800998:	83 f8 04             	cmp    $0x4,%eax
+  80099b:	74 09                	je     8009a6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80099d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8009a1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8009a6:	48 89 d0             	mov    %rdx,%rax
+  8009a9:	48 83 c4 08          	add    $0x8,%rsp
+  8009ad:	5b                   	pop    %rbx
+  8009ae:	41 5c                	pop    %r12
+  8009b0:	41 5d                	pop    %r13
+  8009b2:	5d                   	pop    %rbp
+  8009b3:	c3                   	ret
+  8009b4:	48 89 d0             	mov    %rdx,%rax
+  8009b7:	c3                   	ret
+
+00000000008009b8 <cputchar>:
+cputchar(int ch) {
+  8009b8:	55                   	push   %rbp
+  8009b9:	48 89 e5             	mov    %rsp,%rbp
+  8009bc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8009c0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8009c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8009c9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8009cd:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  8009d4:	00 00 00 
+  8009d7:	ff d0                	call   *%rax
+}
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+00000000008009db <getchar>:
+getchar(void) {
+  8009db:	55                   	push   %rbp
+  8009dc:	48 89 e5             	mov    %rsp,%rbp
+  8009df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8009e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8009e8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f1:	48 b8 97 27 80 00 00 	movabs $0x802797,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+  8009fd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 06                	js     800a09 <getchar+0x2e>
+  800a03:	74 08                	je     800a0d <getchar+0x32>
+  800a05:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800a09:	89 d0                	mov    %edx,%eax
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800a0d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800a12:	eb f5                	jmp    800a09 <getchar+0x2e>
+
+0000000000800a14 <iscons>:
+iscons(int fdnum) {
+  800a14:	55                   	push   %rbp
+  800a15:	48 89 e5             	mov    %rsp,%rbp
+  800a18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a20:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a2c:	85 c0                	test   %eax,%eax
+  800a2e:	78 18                	js     800a48 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800a30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a34:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800a3b:	00 00 00 
+  800a3e:	8b 00                	mov    (%rax),%eax
+  800a40:	39 02                	cmp    %eax,(%rdx)
+  800a42:	0f 94 c0             	sete   %al
+  800a45:	0f b6 c0             	movzbl %al,%eax
+}
+  800a48:	c9                   	leave
+  800a49:	c3                   	ret
+
+0000000000800a4a <opencons>:
+opencons(void) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800a52:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800a56:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	78 49                	js     800aaf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800a66:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800a6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a70:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a79:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+  800a85:	85 c0                	test   %eax,%eax
+  800a87:	78 26                	js     800aaf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800a89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a8d:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800a94:	00 00 
+  800a96:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800a98:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a9c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800aa3:	48 b8 26 24 80 00 00 	movabs $0x802426,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+0000000000800ab1 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	41 56                	push   %r14
+  800ab7:	41 55                	push   %r13
+  800ab9:	41 54                	push   %r12
+  800abb:	53                   	push   %rbx
+  800abc:	41 89 fd             	mov    %edi,%r13d
+  800abf:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ac2:	48 ba d8 61 80 00 00 	movabs $0x8061d8,%rdx
+  800ac9:	00 00 00 
+  800acc:	48 b8 d8 61 80 00 00 	movabs $0x8061d8,%rax
+  800ad3:	00 00 00 
+  800ad6:	48 39 c2             	cmp    %rax,%rdx
+  800ad9:	73 17                	jae    800af2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800adb:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ade:	49 89 c4             	mov    %rax,%r12
+  800ae1:	48 83 c3 08          	add    $0x8,%rbx
+  800ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aea:	ff 53 f8             	call   *-0x8(%rbx)
+  800aed:	4c 39 e3             	cmp    %r12,%rbx
+  800af0:	72 ef                	jb     800ae1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800af2:	48 b8 0d 1d 80 00 00 	movabs $0x801d0d,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+  800afe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b03:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800b07:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800b0b:	48 c1 e0 04          	shl    $0x4,%rax
+  800b0f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b16:	00 00 00 
+  800b19:	48 01 d0             	add    %rdx,%rax
+  800b1c:	48 a3 18 70 80 00 00 	movabs %rax,0x807018
+  800b23:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b26:	45 85 ed             	test   %r13d,%r13d
+  800b29:	7e 0d                	jle    800b38 <libmain+0x87>
+  800b2b:	49 8b 06             	mov    (%r14),%rax
+  800b2e:	48 a3 98 60 80 00 00 	movabs %rax,0x806098
+  800b35:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b38:	4c 89 f6             	mov    %r14,%rsi
+  800b3b:	44 89 ef             	mov    %r13d,%edi
+  800b3e:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  800b45:	00 00 00 
+  800b48:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b4a:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800b51:	00 00 00 
+  800b54:	ff d0                	call   *%rax
+#endif
+}
+  800b56:	5b                   	pop    %rbx
+  800b57:	41 5c                	pop    %r12
+  800b59:	41 5d                	pop    %r13
+  800b5b:	41 5e                	pop    %r14
+  800b5d:	5d                   	pop    %rbp
+  800b5e:	c3                   	ret
+
+0000000000800b5f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b5f:	55                   	push   %rbp
+  800b60:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b63:	48 b8 4c 26 80 00 00 	movabs $0x80264c,%rax
+  800b6a:	00 00 00 
+  800b6d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b74:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  800b7b:	00 00 00 
+  800b7e:	ff d0                	call   *%rax
+}
+  800b80:	5d                   	pop    %rbp
+  800b81:	c3                   	ret
+
+0000000000800b82 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b82:	55                   	push   %rbp
+  800b83:	48 89 e5             	mov    %rsp,%rbp
+  800b86:	41 56                	push   %r14
+  800b88:	41 55                	push   %r13
+  800b8a:	41 54                	push   %r12
+  800b8c:	53                   	push   %rbx
+  800b8d:	48 83 ec 50          	sub    $0x50,%rsp
+  800b91:	49 89 fc             	mov    %rdi,%r12
+  800b94:	41 89 f5             	mov    %esi,%r13d
+  800b97:	48 89 d3             	mov    %rdx,%rbx
+  800b9a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800b9e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800ba2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ba6:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800bad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bb5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800bb9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bbd:	48 b8 98 60 80 00 00 	movabs $0x806098,%rax
+  800bc4:	00 00 00 
+  800bc7:	4c 8b 30             	mov    (%rax),%r14
+  800bca:	48 b8 0d 1d 80 00 00 	movabs $0x801d0d,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+  800bd6:	89 c6                	mov    %eax,%esi
+  800bd8:	45 89 e8             	mov    %r13d,%r8d
+  800bdb:	4c 89 e1             	mov    %r12,%rcx
+  800bde:	4c 89 f2             	mov    %r14,%rdx
+  800be1:	48 bf 68 4f 80 00 00 	movabs $0x804f68,%rdi
+  800be8:	00 00 00 
+  800beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf0:	49 bc d2 0c 80 00 00 	movabs $0x800cd2,%r12
+  800bf7:	00 00 00 
+  800bfa:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800bfd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800c01:	48 89 df             	mov    %rbx,%rdi
+  800c04:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  800c0b:	00 00 00 
+  800c0e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c10:	48 bf 1b 4e 80 00 00 	movabs $0x804e1b,%rdi
+  800c17:	00 00 00 
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c22:	cc                   	int3
+  800c23:	eb fd                	jmp    800c22 <_panic+0xa0>
+
+0000000000800c25 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c25:	55                   	push   %rbp
+  800c26:	48 89 e5             	mov    %rsp,%rbp
+  800c29:	53                   	push   %rbx
+  800c2a:	48 83 ec 08          	sub    $0x8,%rsp
+  800c2e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c31:	8b 06                	mov    (%rsi),%eax
+  800c33:	8d 50 01             	lea    0x1(%rax),%edx
+  800c36:	89 16                	mov    %edx,(%rsi)
+  800c38:	48 98                	cltq
+  800c3a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c3f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c45:	74 0a                	je     800c51 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c47:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c4f:	c9                   	leave
+  800c50:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c51:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c55:	be ff 00 00 00       	mov    $0xff,%esi
+  800c5a:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  800c61:	00 00 00 
+  800c64:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c66:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c6c:	eb d9                	jmp    800c47 <putch+0x22>
+
+0000000000800c6e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c6e:	55                   	push   %rbp
+  800c6f:	48 89 e5             	mov    %rsp,%rbp
+  800c72:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c79:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c7c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c83:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c90:	48 89 f1             	mov    %rsi,%rcx
+  800c93:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c9a:	48 bf 25 0c 80 00 00 	movabs $0x800c25,%rdi
+  800ca1:	00 00 00 
+  800ca4:	48 b8 22 0e 80 00 00 	movabs $0x800e22,%rax
+  800cab:	00 00 00 
+  800cae:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800cb0:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800cb7:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cbe:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  800cc5:	00 00 00 
+  800cc8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800cca:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800cd0:	c9                   	leave
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800cd2:	55                   	push   %rbp
+  800cd3:	48 89 e5             	mov    %rsp,%rbp
+  800cd6:	48 83 ec 50          	sub    $0x50,%rsp
+  800cda:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cde:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800ce2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ce6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cea:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800cee:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800cf5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d01:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800d05:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d09:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  800d10:	00 00 00 
+  800d13:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d15:	c9                   	leave
+  800d16:	c3                   	ret
+
+0000000000800d17 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d17:	55                   	push   %rbp
+  800d18:	48 89 e5             	mov    %rsp,%rbp
+  800d1b:	41 57                	push   %r15
+  800d1d:	41 56                	push   %r14
+  800d1f:	41 55                	push   %r13
+  800d21:	41 54                	push   %r12
+  800d23:	53                   	push   %rbx
+  800d24:	48 83 ec 18          	sub    $0x18,%rsp
+  800d28:	49 89 fc             	mov    %rdi,%r12
+  800d2b:	49 89 f5             	mov    %rsi,%r13
+  800d2e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d32:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d35:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d38:	41 89 cf             	mov    %ecx,%r15d
+  800d3b:	4c 39 fa             	cmp    %r15,%rdx
+  800d3e:	73 5b                	jae    800d9b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d40:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d44:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d48:	85 db                	test   %ebx,%ebx
+  800d4a:	7e 0e                	jle    800d5a <print_num+0x43>
+            putch(padc, put_arg);
+  800d4c:	4c 89 ee             	mov    %r13,%rsi
+  800d4f:	44 89 f7             	mov    %r14d,%edi
+  800d52:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d55:	83 eb 01             	sub    $0x1,%ebx
+  800d58:	75 f2                	jne    800d4c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d5a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d5e:	48 b9 9c 4f 80 00 00 	movabs $0x804f9c,%rcx
+  800d65:	00 00 00 
+  800d68:	48 b8 8b 4f 80 00 00 	movabs $0x804f8b,%rax
+  800d6f:	00 00 00 
+  800d72:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	49 f7 f7             	div    %r15
+  800d82:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d86:	4c 89 ee             	mov    %r13,%rsi
+  800d89:	41 ff d4             	call   *%r12
+}
+  800d8c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d90:	5b                   	pop    %rbx
+  800d91:	41 5c                	pop    %r12
+  800d93:	41 5d                	pop    %r13
+  800d95:	41 5e                	pop    %r14
+  800d97:	41 5f                	pop    %r15
+  800d99:	5d                   	pop    %rbp
+  800d9a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800d9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da4:	49 f7 f7             	div    %r15
+  800da7:	48 83 ec 08          	sub    $0x8,%rsp
+  800dab:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800daf:	52                   	push   %rdx
+  800db0:	45 0f be c9          	movsbl %r9b,%r9d
+  800db4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800db8:	48 89 c2             	mov    %rax,%rdx
+  800dbb:	48 b8 17 0d 80 00 00 	movabs $0x800d17,%rax
+  800dc2:	00 00 00 
+  800dc5:	ff d0                	call   *%rax
+  800dc7:	48 83 c4 10          	add    $0x10,%rsp
+  800dcb:	eb 8d                	jmp    800d5a <print_num+0x43>
+
+0000000000800dcd <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dcd:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dd1:	48 8b 06             	mov    (%rsi),%rax
+  800dd4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800dd8:	73 0a                	jae    800de4 <sprintputch+0x17>
+        *state->start++ = ch;
+  800dda:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dde:	48 89 16             	mov    %rdx,(%rsi)
+  800de1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800de4:	c3                   	ret
+
+0000000000800de5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800de5:	55                   	push   %rbp
+  800de6:	48 89 e5             	mov    %rsp,%rbp
+  800de9:	48 83 ec 50          	sub    $0x50,%rsp
+  800ded:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800df1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800df5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800df9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e00:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e08:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e10:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e14:	48 b8 22 0e 80 00 00 	movabs $0x800e22,%rax
+  800e1b:	00 00 00 
+  800e1e:	ff d0                	call   *%rax
+}
+  800e20:	c9                   	leave
+  800e21:	c3                   	ret
+
+0000000000800e22 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e22:	55                   	push   %rbp
+  800e23:	48 89 e5             	mov    %rsp,%rbp
+  800e26:	41 57                	push   %r15
+  800e28:	41 56                	push   %r14
+  800e2a:	41 55                	push   %r13
+  800e2c:	41 54                	push   %r12
+  800e2e:	53                   	push   %rbx
+  800e2f:	48 83 ec 38          	sub    $0x38,%rsp
+  800e33:	49 89 fe             	mov    %rdi,%r14
+  800e36:	49 89 f5             	mov    %rsi,%r13
+  800e39:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e3c:	48 8b 01             	mov    (%rcx),%rax
+  800e3f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e43:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e4f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e53:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e57:	0f b6 3b             	movzbl (%rbx),%edi
+  800e5a:	40 80 ff 25          	cmp    $0x25,%dil
+  800e5e:	74 18                	je     800e78 <vprintfmt+0x56>
+            if (!ch) return;
+  800e60:	40 84 ff             	test   %dil,%dil
+  800e63:	0f 84 b1 06 00 00    	je     80151a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800e69:	40 0f b6 ff          	movzbl %dil,%edi
+  800e6d:	4c 89 ee             	mov    %r13,%rsi
+  800e70:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e73:	4c 89 e3             	mov    %r12,%rbx
+  800e76:	eb db                	jmp    800e53 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e78:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e81:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e86:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e8c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e93:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e97:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800e9c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800ea1:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800ea4:	83 e8 23             	sub    $0x23,%eax
+  800ea7:	3c 57                	cmp    $0x57,%al
+  800ea9:	0f 87 51 06 00 00    	ja     801500 <vprintfmt+0x6de>
+  800eaf:	0f b6 c0             	movzbl %al,%eax
+  800eb2:	48 b9 40 51 80 00 00 	movabs $0x805140,%rcx
+  800eb9:	00 00 00 
+  800ebc:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800ebf:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800ec2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ec6:	eb cf                	jmp    800e97 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ec8:	49 89 dc             	mov    %rbx,%r12
+  800ecb:	be 01 00 00 00       	mov    $0x1,%esi
+  800ed0:	eb c5                	jmp    800e97 <vprintfmt+0x75>
+            padc = ch;
+  800ed2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800ed6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ed9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800edc:	eb b9                	jmp    800e97 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ede:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee4:	77 24                	ja     800f0a <vprintfmt+0xe8>
+  800ee6:	89 c1                	mov    %eax,%ecx
+  800ee8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800eec:	83 c0 08             	add    $0x8,%eax
+  800eef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ef2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800ef5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800ef8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800efc:	79 99                	jns    800e97 <vprintfmt+0x75>
+                width = precision;
+  800efe:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800f02:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f08:	eb 8d                	jmp    800e97 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f0a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f0e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f16:	eb da                	jmp    800ef2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f18:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f1d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f21:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f27:	3c 39                	cmp    $0x39,%al
+  800f29:	77 1c                	ja     800f47 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f2b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f2f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f33:	0f b6 c0             	movzbl %al,%eax
+  800f36:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f3b:	0f b6 03             	movzbl (%rbx),%eax
+  800f3e:	3c 39                	cmp    $0x39,%al
+  800f40:	76 e9                	jbe    800f2b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f42:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f45:	eb b1                	jmp    800ef8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f47:	49 89 dc             	mov    %rbx,%r12
+  800f4a:	eb ac                	jmp    800ef8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f4c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f4f:	85 c9                	test   %ecx,%ecx
+  800f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f56:	0f 49 c1             	cmovns %ecx,%eax
+  800f59:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f5c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f5f:	e9 33 ff ff ff       	jmp    800e97 <vprintfmt+0x75>
+            lflag++;
+  800f64:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f67:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f6a:	e9 28 ff ff ff       	jmp    800e97 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f72:	83 f8 2f             	cmp    $0x2f,%eax
+  800f75:	77 19                	ja     800f90 <vprintfmt+0x16e>
+  800f77:	89 c2                	mov    %eax,%edx
+  800f79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f7d:	83 c0 08             	add    $0x8,%eax
+  800f80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f83:	8b 3a                	mov    (%rdx),%edi
+  800f85:	4c 89 ee             	mov    %r13,%rsi
+  800f88:	41 ff d6             	call   *%r14
+            break;
+  800f8b:	e9 c3 fe ff ff       	jmp    800e53 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9c:	eb e5                	jmp    800f83 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800f9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa4:	77 5a                	ja     801000 <vprintfmt+0x1de>
+  800fa6:	89 c2                	mov    %eax,%edx
+  800fa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fac:	83 c0 08             	add    $0x8,%eax
+  800faf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800fb2:	8b 02                	mov    (%rdx),%eax
+  800fb4:	89 c1                	mov    %eax,%ecx
+  800fb6:	f7 d9                	neg    %ecx
+  800fb8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fbb:	83 f9 14             	cmp    $0x14,%ecx
+  800fbe:	7f 4e                	jg     80100e <vprintfmt+0x1ec>
+  800fc0:	48 63 c1             	movslq %ecx,%rax
+  800fc3:	48 ba 00 54 80 00 00 	movabs $0x805400,%rdx
+  800fca:	00 00 00 
+  800fcd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fd1:	48 85 c0             	test   %rax,%rax
+  800fd4:	74 38                	je     80100e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fd6:	48 89 c1             	mov    %rax,%rcx
+  800fd9:	48 ba d2 4e 80 00 00 	movabs $0x804ed2,%rdx
+  800fe0:	00 00 00 
+  800fe3:	4c 89 ee             	mov    %r13,%rsi
+  800fe6:	4c 89 f7             	mov    %r14,%rdi
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fee:	49 b8 e5 0d 80 00 00 	movabs $0x800de5,%r8
+  800ff5:	00 00 00 
+  800ff8:	41 ff d0             	call   *%r8
+  800ffb:	e9 53 fe ff ff       	jmp    800e53 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801000:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801004:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801008:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80100c:	eb a4                	jmp    800fb2 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80100e:	48 ba b4 4f 80 00 00 	movabs $0x804fb4,%rdx
+  801015:	00 00 00 
+  801018:	4c 89 ee             	mov    %r13,%rsi
+  80101b:	4c 89 f7             	mov    %r14,%rdi
+  80101e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801023:	49 b8 e5 0d 80 00 00 	movabs $0x800de5,%r8
+  80102a:	00 00 00 
+  80102d:	41 ff d0             	call   *%r8
+  801030:	e9 1e fe ff ff       	jmp    800e53 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801035:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801038:	83 f8 2f             	cmp    $0x2f,%eax
+  80103b:	77 6c                	ja     8010a9 <vprintfmt+0x287>
+  80103d:	89 c2                	mov    %eax,%edx
+  80103f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801043:	83 c0 08             	add    $0x8,%eax
+  801046:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801049:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80104c:	48 85 d2             	test   %rdx,%rdx
+  80104f:	48 b8 ad 4f 80 00 00 	movabs $0x804fad,%rax
+  801056:	00 00 00 
+  801059:	48 0f 45 c2          	cmovne %rdx,%rax
+  80105d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801061:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801065:	7e 06                	jle    80106d <vprintfmt+0x24b>
+  801067:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80106b:	75 4a                	jne    8010b7 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80106d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801071:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801075:	0f b6 00             	movzbl (%rax),%eax
+  801078:	84 c0                	test   %al,%al
+  80107a:	0f 85 9a 00 00 00    	jne    80111a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801080:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801083:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801087:	85 c0                	test   %eax,%eax
+  801089:	0f 8e c4 fd ff ff    	jle    800e53 <vprintfmt+0x31>
+  80108f:	4c 89 ee             	mov    %r13,%rsi
+  801092:	bf 20 00 00 00       	mov    $0x20,%edi
+  801097:	41 ff d6             	call   *%r14
+  80109a:	41 83 ec 01          	sub    $0x1,%r12d
+  80109e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8010a2:	75 eb                	jne    80108f <vprintfmt+0x26d>
+  8010a4:	e9 aa fd ff ff       	jmp    800e53 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8010a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010b5:	eb 92                	jmp    801049 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8010b7:	49 63 f7             	movslq %r15d,%rsi
+  8010ba:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8010be:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+  8010ca:	48 89 c2             	mov    %rax,%rdx
+  8010cd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010d0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8010d2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8010d5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8010d8:	85 c0                	test   %eax,%eax
+  8010da:	7e 91                	jle    80106d <vprintfmt+0x24b>
+  8010dc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010e1:	4c 89 ee             	mov    %r13,%rsi
+  8010e4:	44 89 e7             	mov    %r12d,%edi
+  8010e7:	41 ff d6             	call   *%r14
+  8010ea:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010ee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010f1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010f4:	75 eb                	jne    8010e1 <vprintfmt+0x2bf>
+  8010f6:	e9 72 ff ff ff       	jmp    80106d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010fb:	0f b6 f8             	movzbl %al,%edi
+  8010fe:	4c 89 ee             	mov    %r13,%rsi
+  801101:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801104:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801108:	49 83 c4 01          	add    $0x1,%r12
+  80110c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801112:	84 c0                	test   %al,%al
+  801114:	0f 84 66 ff ff ff    	je     801080 <vprintfmt+0x25e>
+  80111a:	45 85 ff             	test   %r15d,%r15d
+  80111d:	78 0a                	js     801129 <vprintfmt+0x307>
+  80111f:	41 83 ef 01          	sub    $0x1,%r15d
+  801123:	0f 88 57 ff ff ff    	js     801080 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801129:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80112d:	74 cc                	je     8010fb <vprintfmt+0x2d9>
+  80112f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801132:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801137:	80 fa 5e             	cmp    $0x5e,%dl
+  80113a:	77 c2                	ja     8010fe <vprintfmt+0x2dc>
+  80113c:	eb bd                	jmp    8010fb <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80113e:	40 84 f6             	test   %sil,%sil
+  801141:	75 26                	jne    801169 <vprintfmt+0x347>
+    switch (lflag) {
+  801143:	85 d2                	test   %edx,%edx
+  801145:	74 59                	je     8011a0 <vprintfmt+0x37e>
+  801147:	83 fa 01             	cmp    $0x1,%edx
+  80114a:	74 7b                	je     8011c7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80114c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80114f:	83 f8 2f             	cmp    $0x2f,%eax
+  801152:	0f 87 96 00 00 00    	ja     8011ee <vprintfmt+0x3cc>
+  801158:	89 c2                	mov    %eax,%edx
+  80115a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80115e:	83 c0 08             	add    $0x8,%eax
+  801161:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801164:	4c 8b 22             	mov    (%rdx),%r12
+  801167:	eb 17                	jmp    801180 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801169:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80116c:	83 f8 2f             	cmp    $0x2f,%eax
+  80116f:	77 21                	ja     801192 <vprintfmt+0x370>
+  801171:	89 c2                	mov    %eax,%edx
+  801173:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801177:	83 c0 08             	add    $0x8,%eax
+  80117a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80117d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801180:	4d 85 e4             	test   %r12,%r12
+  801183:	78 7a                	js     8011ff <vprintfmt+0x3dd>
+            num = i;
+  801185:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801188:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80118d:	e9 50 02 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801192:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801196:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80119a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80119e:	eb dd                	jmp    80117d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8011a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8011a6:	77 11                	ja     8011b9 <vprintfmt+0x397>
+  8011a8:	89 c2                	mov    %eax,%edx
+  8011aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011ae:	83 c0 08             	add    $0x8,%eax
+  8011b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011b4:	4c 63 22             	movslq (%rdx),%r12
+  8011b7:	eb c7                	jmp    801180 <vprintfmt+0x35e>
+  8011b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c5:	eb ed                	jmp    8011b4 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8011c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8011cd:	77 11                	ja     8011e0 <vprintfmt+0x3be>
+  8011cf:	89 c2                	mov    %eax,%edx
+  8011d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d5:	83 c0 08             	add    $0x8,%eax
+  8011d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011db:	4c 8b 22             	mov    (%rdx),%r12
+  8011de:	eb a0                	jmp    801180 <vprintfmt+0x35e>
+  8011e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ec:	eb ed                	jmp    8011db <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8011ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011fa:	e9 65 ff ff ff       	jmp    801164 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8011ff:	4c 89 ee             	mov    %r13,%rsi
+  801202:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801207:	41 ff d6             	call   *%r14
+                i = -i;
+  80120a:	49 f7 dc             	neg    %r12
+  80120d:	e9 73 ff ff ff       	jmp    801185 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801212:	40 84 f6             	test   %sil,%sil
+  801215:	75 32                	jne    801249 <vprintfmt+0x427>
+    switch (lflag) {
+  801217:	85 d2                	test   %edx,%edx
+  801219:	74 5d                	je     801278 <vprintfmt+0x456>
+  80121b:	83 fa 01             	cmp    $0x1,%edx
+  80121e:	0f 84 82 00 00 00    	je     8012a6 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801224:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801227:	83 f8 2f             	cmp    $0x2f,%eax
+  80122a:	0f 87 a5 00 00 00    	ja     8012d5 <vprintfmt+0x4b3>
+  801230:	89 c2                	mov    %eax,%edx
+  801232:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801236:	83 c0 08             	add    $0x8,%eax
+  801239:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80123c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80123f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801244:	e9 99 01 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801249:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80124c:	83 f8 2f             	cmp    $0x2f,%eax
+  80124f:	77 19                	ja     80126a <vprintfmt+0x448>
+  801251:	89 c2                	mov    %eax,%edx
+  801253:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801257:	83 c0 08             	add    $0x8,%eax
+  80125a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80125d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801260:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801265:	e9 78 01 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+  80126a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80126e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801272:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801276:	eb e5                	jmp    80125d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  801278:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80127b:	83 f8 2f             	cmp    $0x2f,%eax
+  80127e:	77 18                	ja     801298 <vprintfmt+0x476>
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801286:	83 c0 08             	add    $0x8,%eax
+  801289:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80128c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80128e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801293:	e9 4a 01 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+  801298:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80129c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012a4:	eb e6                	jmp    80128c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8012a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8012ac:	77 19                	ja     8012c7 <vprintfmt+0x4a5>
+  8012ae:	89 c2                	mov    %eax,%edx
+  8012b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012b4:	83 c0 08             	add    $0x8,%eax
+  8012b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012ba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012c2:	e9 1b 01 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+  8012c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d3:	eb e5                	jmp    8012ba <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8012d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e1:	e9 56 ff ff ff       	jmp    80123c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8012e6:	40 84 f6             	test   %sil,%sil
+  8012e9:	75 2e                	jne    801319 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8012eb:	85 d2                	test   %edx,%edx
+  8012ed:	74 59                	je     801348 <vprintfmt+0x526>
+  8012ef:	83 fa 01             	cmp    $0x1,%edx
+  8012f2:	74 7f                	je     801373 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8012f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8012fa:	0f 87 9f 00 00 00    	ja     80139f <vprintfmt+0x57d>
+  801300:	89 c2                	mov    %eax,%edx
+  801302:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801306:	83 c0 08             	add    $0x8,%eax
+  801309:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80130c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80130f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801314:	e9 c9 00 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801319:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80131c:	83 f8 2f             	cmp    $0x2f,%eax
+  80131f:	77 19                	ja     80133a <vprintfmt+0x518>
+  801321:	89 c2                	mov    %eax,%edx
+  801323:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801327:	83 c0 08             	add    $0x8,%eax
+  80132a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80132d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801330:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801335:	e9 a8 00 00 00       	jmp    8013e2 <vprintfmt+0x5c0>
+  80133a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80133e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801342:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801346:	eb e5                	jmp    80132d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801348:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80134b:	83 f8 2f             	cmp    $0x2f,%eax
+  80134e:	77 15                	ja     801365 <vprintfmt+0x543>
+  801350:	89 c2                	mov    %eax,%edx
+  801352:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801356:	83 c0 08             	add    $0x8,%eax
+  801359:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80135c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80135e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801363:	eb 7d                	jmp    8013e2 <vprintfmt+0x5c0>
+  801365:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801369:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80136d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801371:	eb e9                	jmp    80135c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801373:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801376:	83 f8 2f             	cmp    $0x2f,%eax
+  801379:	77 16                	ja     801391 <vprintfmt+0x56f>
+  80137b:	89 c2                	mov    %eax,%edx
+  80137d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801381:	83 c0 08             	add    $0x8,%eax
+  801384:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801387:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80138a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80138f:	eb 51                	jmp    8013e2 <vprintfmt+0x5c0>
+  801391:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801395:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801399:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80139d:	eb e8                	jmp    801387 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80139f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ab:	e9 5c ff ff ff       	jmp    80130c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8013b0:	4c 89 ee             	mov    %r13,%rsi
+  8013b3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013b8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8013bb:	4c 89 ee             	mov    %r13,%rsi
+  8013be:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013c3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8013c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8013cc:	77 47                	ja     801415 <vprintfmt+0x5f3>
+  8013ce:	89 c2                	mov    %eax,%edx
+  8013d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d4:	83 c0 08             	add    $0x8,%eax
+  8013d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013da:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8013dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8013e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8013ea:	0f 94 c0             	sete   %al
+  8013ed:	0f b6 c0             	movzbl %al,%eax
+  8013f0:	50                   	push   %rax
+  8013f1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8013f6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8013fa:	4c 89 ee             	mov    %r13,%rsi
+  8013fd:	4c 89 f7             	mov    %r14,%rdi
+  801400:	48 b8 17 0d 80 00 00 	movabs $0x800d17,%rax
+  801407:	00 00 00 
+  80140a:	ff d0                	call   *%rax
+            break;
+  80140c:	48 83 c4 10          	add    $0x10,%rsp
+  801410:	e9 3e fa ff ff       	jmp    800e53 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801415:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801419:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80141d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801421:	eb b7                	jmp    8013da <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801423:	40 84 f6             	test   %sil,%sil
+  801426:	75 2b                	jne    801453 <vprintfmt+0x631>
+    switch (lflag) {
+  801428:	85 d2                	test   %edx,%edx
+  80142a:	74 56                	je     801482 <vprintfmt+0x660>
+  80142c:	83 fa 01             	cmp    $0x1,%edx
+  80142f:	74 7f                	je     8014b0 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801431:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801434:	83 f8 2f             	cmp    $0x2f,%eax
+  801437:	0f 87 a2 00 00 00    	ja     8014df <vprintfmt+0x6bd>
+  80143d:	89 c2                	mov    %eax,%edx
+  80143f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801443:	83 c0 08             	add    $0x8,%eax
+  801446:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801449:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80144c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801451:	eb 8f                	jmp    8013e2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801453:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801456:	83 f8 2f             	cmp    $0x2f,%eax
+  801459:	77 19                	ja     801474 <vprintfmt+0x652>
+  80145b:	89 c2                	mov    %eax,%edx
+  80145d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801461:	83 c0 08             	add    $0x8,%eax
+  801464:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801467:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80146a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80146f:	e9 6e ff ff ff       	jmp    8013e2 <vprintfmt+0x5c0>
+  801474:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801478:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80147c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801480:	eb e5                	jmp    801467 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801482:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801485:	83 f8 2f             	cmp    $0x2f,%eax
+  801488:	77 18                	ja     8014a2 <vprintfmt+0x680>
+  80148a:	89 c2                	mov    %eax,%edx
+  80148c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801490:	83 c0 08             	add    $0x8,%eax
+  801493:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801496:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801498:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80149d:	e9 40 ff ff ff       	jmp    8013e2 <vprintfmt+0x5c0>
+  8014a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014ae:	eb e6                	jmp    801496 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8014b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8014b6:	77 19                	ja     8014d1 <vprintfmt+0x6af>
+  8014b8:	89 c2                	mov    %eax,%edx
+  8014ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014be:	83 c0 08             	add    $0x8,%eax
+  8014c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014c7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8014cc:	e9 11 ff ff ff       	jmp    8013e2 <vprintfmt+0x5c0>
+  8014d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014dd:	eb e5                	jmp    8014c4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8014df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014eb:	e9 59 ff ff ff       	jmp    801449 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8014f0:	4c 89 ee             	mov    %r13,%rsi
+  8014f3:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014f8:	41 ff d6             	call   *%r14
+            break;
+  8014fb:	e9 53 f9 ff ff       	jmp    800e53 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801500:	4c 89 ee             	mov    %r13,%rsi
+  801503:	bf 25 00 00 00       	mov    $0x25,%edi
+  801508:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80150b:	48 83 eb 01          	sub    $0x1,%rbx
+  80150f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801513:	75 f6                	jne    80150b <vprintfmt+0x6e9>
+  801515:	e9 39 f9 ff ff       	jmp    800e53 <vprintfmt+0x31>
+}
+  80151a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80151e:	5b                   	pop    %rbx
+  80151f:	41 5c                	pop    %r12
+  801521:	41 5d                	pop    %r13
+  801523:	41 5e                	pop    %r14
+  801525:	41 5f                	pop    %r15
+  801527:	5d                   	pop    %rbp
+  801528:	c3                   	ret
+
+0000000000801529 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801531:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801535:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80153a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80153e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801545:	48 85 ff             	test   %rdi,%rdi
+  801548:	74 2b                	je     801575 <vsnprintf+0x4c>
+  80154a:	48 85 f6             	test   %rsi,%rsi
+  80154d:	74 26                	je     801575 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80154f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801553:	48 bf cd 0d 80 00 00 	movabs $0x800dcd,%rdi
+  80155a:	00 00 00 
+  80155d:	48 b8 22 0e 80 00 00 	movabs $0x800e22,%rax
+  801564:	00 00 00 
+  801567:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801569:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801570:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157a:	eb f7                	jmp    801573 <vsnprintf+0x4a>
+
+000000000080157c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	48 83 ec 50          	sub    $0x50,%rsp
+  801584:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801588:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80158c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801590:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801597:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80159b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80159f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8015a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8015a7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8015ab:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+00000000008015b9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8015b9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8015bc:	74 10                	je     8015ce <strlen+0x15>
+    size_t n = 0;
+  8015be:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8015c3:	48 83 c0 01          	add    $0x1,%rax
+  8015c7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8015cb:	75 f6                	jne    8015c3 <strlen+0xa>
+  8015cd:	c3                   	ret
+    size_t n = 0;
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8015d3:	c3                   	ret
+
+00000000008015d4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8015d4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8015d7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8015dc:	48 85 f6             	test   %rsi,%rsi
+  8015df:	74 11                	je     8015f2 <strnlen+0x1e>
+  8015e1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8015e5:	74 0c                	je     8015f3 <strnlen+0x1f>
+  8015e7:	48 83 c2 01          	add    $0x1,%rdx
+  8015eb:	48 39 d0             	cmp    %rdx,%rax
+  8015ee:	75 f1                	jne    8015e1 <strnlen+0xd>
+  8015f0:	eb 04                	jmp    8015f6 <strnlen+0x22>
+  8015f2:	c3                   	ret
+  8015f3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8015f6:	c3                   	ret
+
+00000000008015f7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8015f7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8015fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ff:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801603:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801606:	48 83 c2 01          	add    $0x1,%rdx
+  80160a:	84 c9                	test   %cl,%cl
+  80160c:	75 f1                	jne    8015ff <strcpy+0x8>
+        ;
+    return res;
+}
+  80160e:	c3                   	ret
+
+000000000080160f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80160f:	55                   	push   %rbp
+  801610:	48 89 e5             	mov    %rsp,%rbp
+  801613:	41 54                	push   %r12
+  801615:	53                   	push   %rbx
+  801616:	48 89 fb             	mov    %rdi,%rbx
+  801619:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80161c:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801623:	00 00 00 
+  801626:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801628:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80162c:	4c 89 e6             	mov    %r12,%rsi
+  80162f:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+    return dst;
+}
+  80163b:	48 89 d8             	mov    %rbx,%rax
+  80163e:	5b                   	pop    %rbx
+  80163f:	41 5c                	pop    %r12
+  801641:	5d                   	pop    %rbp
+  801642:	c3                   	ret
+
+0000000000801643 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801643:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801646:	48 85 d2             	test   %rdx,%rdx
+  801649:	74 1f                	je     80166a <strncpy+0x27>
+  80164b:	48 01 fa             	add    %rdi,%rdx
+  80164e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801651:	48 83 c1 01          	add    $0x1,%rcx
+  801655:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801659:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80165d:	41 80 f8 01          	cmp    $0x1,%r8b
+  801661:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801665:	48 39 ca             	cmp    %rcx,%rdx
+  801668:	75 e7                	jne    801651 <strncpy+0xe>
+    }
+    return ret;
+}
+  80166a:	c3                   	ret
+
+000000000080166b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80166b:	48 89 f8             	mov    %rdi,%rax
+  80166e:	48 85 d2             	test   %rdx,%rdx
+  801671:	74 24                	je     801697 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801673:	48 83 ea 01          	sub    $0x1,%rdx
+  801677:	74 1b                	je     801694 <strlcpy+0x29>
+  801679:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80167d:	0f b6 16             	movzbl (%rsi),%edx
+  801680:	84 d2                	test   %dl,%dl
+  801682:	74 10                	je     801694 <strlcpy+0x29>
+            *dst++ = *src++;
+  801684:	48 83 c6 01          	add    $0x1,%rsi
+  801688:	48 83 c0 01          	add    $0x1,%rax
+  80168c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80168f:	48 39 c8             	cmp    %rcx,%rax
+  801692:	75 e9                	jne    80167d <strlcpy+0x12>
+        *dst = '\0';
+  801694:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801697:	48 29 f8             	sub    %rdi,%rax
+}
+  80169a:	c3                   	ret
+
+000000000080169b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80169b:	0f b6 07             	movzbl (%rdi),%eax
+  80169e:	84 c0                	test   %al,%al
+  8016a0:	74 13                	je     8016b5 <strcmp+0x1a>
+  8016a2:	38 06                	cmp    %al,(%rsi)
+  8016a4:	75 0f                	jne    8016b5 <strcmp+0x1a>
+  8016a6:	48 83 c7 01          	add    $0x1,%rdi
+  8016aa:	48 83 c6 01          	add    $0x1,%rsi
+  8016ae:	0f b6 07             	movzbl (%rdi),%eax
+  8016b1:	84 c0                	test   %al,%al
+  8016b3:	75 ed                	jne    8016a2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016b5:	0f b6 c0             	movzbl %al,%eax
+  8016b8:	0f b6 16             	movzbl (%rsi),%edx
+  8016bb:	29 d0                	sub    %edx,%eax
+}
+  8016bd:	c3                   	ret
+
+00000000008016be <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8016be:	48 85 d2             	test   %rdx,%rdx
+  8016c1:	74 1f                	je     8016e2 <strncmp+0x24>
+  8016c3:	0f b6 07             	movzbl (%rdi),%eax
+  8016c6:	84 c0                	test   %al,%al
+  8016c8:	74 1e                	je     8016e8 <strncmp+0x2a>
+  8016ca:	3a 06                	cmp    (%rsi),%al
+  8016cc:	75 1a                	jne    8016e8 <strncmp+0x2a>
+  8016ce:	48 83 c7 01          	add    $0x1,%rdi
+  8016d2:	48 83 c6 01          	add    $0x1,%rsi
+  8016d6:	48 83 ea 01          	sub    $0x1,%rdx
+  8016da:	75 e7                	jne    8016c3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8016dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e1:	c3                   	ret
+  8016e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e7:	c3                   	ret
+  8016e8:	48 85 d2             	test   %rdx,%rdx
+  8016eb:	74 09                	je     8016f6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016ed:	0f b6 07             	movzbl (%rdi),%eax
+  8016f0:	0f b6 16             	movzbl (%rsi),%edx
+  8016f3:	29 d0                	sub    %edx,%eax
+  8016f5:	c3                   	ret
+    if (!n) return 0;
+  8016f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016fb:	c3                   	ret
+
+00000000008016fc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8016fc:	0f b6 17             	movzbl (%rdi),%edx
+  8016ff:	84 d2                	test   %dl,%dl
+  801701:	74 18                	je     80171b <strchr+0x1f>
+        if (*str == c) {
+  801703:	0f be d2             	movsbl %dl,%edx
+  801706:	39 f2                	cmp    %esi,%edx
+  801708:	74 17                	je     801721 <strchr+0x25>
+    for (; *str; str++) {
+  80170a:	48 83 c7 01          	add    $0x1,%rdi
+  80170e:	0f b6 17             	movzbl (%rdi),%edx
+  801711:	84 d2                	test   %dl,%dl
+  801713:	75 ee                	jne    801703 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171a:	c3                   	ret
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	c3                   	ret
+  801721:	48 89 f8             	mov    %rdi,%rax
+}
+  801724:	c3                   	ret
+
+0000000000801725 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801725:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801728:	0f b6 17             	movzbl (%rdi),%edx
+  80172b:	84 d2                	test   %dl,%dl
+  80172d:	74 13                	je     801742 <strfind+0x1d>
+  80172f:	0f be d2             	movsbl %dl,%edx
+  801732:	39 f2                	cmp    %esi,%edx
+  801734:	74 0b                	je     801741 <strfind+0x1c>
+  801736:	48 83 c0 01          	add    $0x1,%rax
+  80173a:	0f b6 10             	movzbl (%rax),%edx
+  80173d:	84 d2                	test   %dl,%dl
+  80173f:	75 ee                	jne    80172f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801741:	c3                   	ret
+  801742:	c3                   	ret
+
+0000000000801743 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801743:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801746:	48 89 f8             	mov    %rdi,%rax
+  801749:	48 f7 d8             	neg    %rax
+  80174c:	83 e0 07             	and    $0x7,%eax
+  80174f:	49 89 d1             	mov    %rdx,%r9
+  801752:	49 29 c1             	sub    %rax,%r9
+  801755:	78 36                	js     80178d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801757:	40 0f b6 c6          	movzbl %sil,%eax
+  80175b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801762:	01 01 01 
+  801765:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801769:	40 f6 c7 07          	test   $0x7,%dil
+  80176d:	75 38                	jne    8017a7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80176f:	4c 89 c9             	mov    %r9,%rcx
+  801772:	48 c1 f9 03          	sar    $0x3,%rcx
+  801776:	74 0c                	je     801784 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801778:	fc                   	cld
+  801779:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80177c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801780:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801784:	4d 85 c9             	test   %r9,%r9
+  801787:	75 45                	jne    8017ce <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801789:	4c 89 c0             	mov    %r8,%rax
+  80178c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80178d:	48 85 d2             	test   %rdx,%rdx
+  801790:	74 f7                	je     801789 <memset+0x46>
+  801792:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801795:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801798:	48 83 c0 01          	add    $0x1,%rax
+  80179c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8017a0:	48 39 c2             	cmp    %rax,%rdx
+  8017a3:	75 f3                	jne    801798 <memset+0x55>
+  8017a5:	eb e2                	jmp    801789 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8017a7:	40 f6 c7 01          	test   $0x1,%dil
+  8017ab:	74 06                	je     8017b3 <memset+0x70>
+  8017ad:	88 07                	mov    %al,(%rdi)
+  8017af:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017b3:	40 f6 c7 02          	test   $0x2,%dil
+  8017b7:	74 07                	je     8017c0 <memset+0x7d>
+  8017b9:	66 89 07             	mov    %ax,(%rdi)
+  8017bc:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017c0:	40 f6 c7 04          	test   $0x4,%dil
+  8017c4:	74 a9                	je     80176f <memset+0x2c>
+  8017c6:	89 07                	mov    %eax,(%rdi)
+  8017c8:	48 83 c7 04          	add    $0x4,%rdi
+  8017cc:	eb a1                	jmp    80176f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017ce:	41 f6 c1 04          	test   $0x4,%r9b
+  8017d2:	74 06                	je     8017da <memset+0x97>
+  8017d4:	89 07                	mov    %eax,(%rdi)
+  8017d6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017da:	41 f6 c1 02          	test   $0x2,%r9b
+  8017de:	74 07                	je     8017e7 <memset+0xa4>
+  8017e0:	66 89 07             	mov    %ax,(%rdi)
+  8017e3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8017e7:	41 f6 c1 01          	test   $0x1,%r9b
+  8017eb:	74 9c                	je     801789 <memset+0x46>
+  8017ed:	88 07                	mov    %al,(%rdi)
+  8017ef:	eb 98                	jmp    801789 <memset+0x46>
+
+00000000008017f1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8017f1:	48 89 f8             	mov    %rdi,%rax
+  8017f4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8017f7:	48 39 fe             	cmp    %rdi,%rsi
+  8017fa:	73 3b                	jae    801837 <memmove+0x46>
+  8017fc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801800:	48 39 d7             	cmp    %rdx,%rdi
+  801803:	73 32                	jae    801837 <memmove+0x46>
+        s += n;
+        d += n;
+  801805:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801809:	48 89 d6             	mov    %rdx,%rsi
+  80180c:	48 09 fe             	or     %rdi,%rsi
+  80180f:	48 09 ce             	or     %rcx,%rsi
+  801812:	40 f6 c6 07          	test   $0x7,%sil
+  801816:	75 12                	jne    80182a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801818:	48 83 ef 08          	sub    $0x8,%rdi
+  80181c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801820:	48 c1 e9 03          	shr    $0x3,%rcx
+  801824:	fd                   	std
+  801825:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801828:	fc                   	cld
+  801829:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80182a:	48 83 ef 01          	sub    $0x1,%rdi
+  80182e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801832:	fd                   	std
+  801833:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801835:	eb f1                	jmp    801828 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801837:	48 89 f2             	mov    %rsi,%rdx
+  80183a:	48 09 c2             	or     %rax,%rdx
+  80183d:	48 09 ca             	or     %rcx,%rdx
+  801840:	f6 c2 07             	test   $0x7,%dl
+  801843:	75 0c                	jne    801851 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801845:	48 c1 e9 03          	shr    $0x3,%rcx
+  801849:	48 89 c7             	mov    %rax,%rdi
+  80184c:	fc                   	cld
+  80184d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801850:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801851:	48 89 c7             	mov    %rax,%rdi
+  801854:	fc                   	cld
+  801855:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801857:	c3                   	ret
+
+0000000000801858 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801858:	55                   	push   %rbp
+  801859:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80185c:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  801863:	00 00 00 
+  801866:	ff d0                	call   *%rax
+}
+  801868:	5d                   	pop    %rbp
+  801869:	c3                   	ret
+
+000000000080186a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80186a:	55                   	push   %rbp
+  80186b:	48 89 e5             	mov    %rsp,%rbp
+  80186e:	41 57                	push   %r15
+  801870:	41 56                	push   %r14
+  801872:	41 55                	push   %r13
+  801874:	41 54                	push   %r12
+  801876:	53                   	push   %rbx
+  801877:	48 83 ec 08          	sub    $0x8,%rsp
+  80187b:	49 89 fe             	mov    %rdi,%r14
+  80187e:	49 89 f7             	mov    %rsi,%r15
+  801881:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801884:	48 89 f7             	mov    %rsi,%rdi
+  801887:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+  801893:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801896:	48 89 de             	mov    %rbx,%rsi
+  801899:	4c 89 f7             	mov    %r14,%rdi
+  80189c:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  8018a3:	00 00 00 
+  8018a6:	ff d0                	call   *%rax
+  8018a8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018ab:	48 39 c3             	cmp    %rax,%rbx
+  8018ae:	74 36                	je     8018e6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8018b0:	48 89 d8             	mov    %rbx,%rax
+  8018b3:	4c 29 e8             	sub    %r13,%rax
+  8018b6:	49 39 c4             	cmp    %rax,%r12
+  8018b9:	73 31                	jae    8018ec <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8018bb:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8018c0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018c4:	4c 89 fe             	mov    %r15,%rsi
+  8018c7:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8018d3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8018d7:	48 83 c4 08          	add    $0x8,%rsp
+  8018db:	5b                   	pop    %rbx
+  8018dc:	41 5c                	pop    %r12
+  8018de:	41 5d                	pop    %r13
+  8018e0:	41 5e                	pop    %r14
+  8018e2:	41 5f                	pop    %r15
+  8018e4:	5d                   	pop    %rbp
+  8018e5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018e6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018ea:	eb eb                	jmp    8018d7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8018ec:	48 83 eb 01          	sub    $0x1,%rbx
+  8018f0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018f4:	48 89 da             	mov    %rbx,%rdx
+  8018f7:	4c 89 fe             	mov    %r15,%rsi
+  8018fa:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  801901:	00 00 00 
+  801904:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801906:	49 01 de             	add    %rbx,%r14
+  801909:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80190e:	eb c3                	jmp    8018d3 <strlcat+0x69>
+
+0000000000801910 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801910:	48 85 d2             	test   %rdx,%rdx
+  801913:	74 2d                	je     801942 <memcmp+0x32>
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80191a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80191e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801923:	44 38 c1             	cmp    %r8b,%cl
+  801926:	75 0f                	jne    801937 <memcmp+0x27>
+    while (n-- > 0) {
+  801928:	48 83 c0 01          	add    $0x1,%rax
+  80192c:	48 39 c2             	cmp    %rax,%rdx
+  80192f:	75 e9                	jne    80191a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801931:	b8 00 00 00 00       	mov    $0x0,%eax
+  801936:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801937:	0f b6 c1             	movzbl %cl,%eax
+  80193a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80193e:	44 29 c0             	sub    %r8d,%eax
+  801941:	c3                   	ret
+    return 0;
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801947:	c3                   	ret
+
+0000000000801948 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801948:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80194c:	48 39 c7             	cmp    %rax,%rdi
+  80194f:	73 0f                	jae    801960 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801951:	40 38 37             	cmp    %sil,(%rdi)
+  801954:	74 0e                	je     801964 <memfind+0x1c>
+    for (; src < end; src++) {
+  801956:	48 83 c7 01          	add    $0x1,%rdi
+  80195a:	48 39 f8             	cmp    %rdi,%rax
+  80195d:	75 f2                	jne    801951 <memfind+0x9>
+  80195f:	c3                   	ret
+  801960:	48 89 f8             	mov    %rdi,%rax
+  801963:	c3                   	ret
+  801964:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801967:	c3                   	ret
+
+0000000000801968 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801968:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80196b:	0f b6 37             	movzbl (%rdi),%esi
+  80196e:	40 80 fe 20          	cmp    $0x20,%sil
+  801972:	74 06                	je     80197a <strtol+0x12>
+  801974:	40 80 fe 09          	cmp    $0x9,%sil
+  801978:	75 13                	jne    80198d <strtol+0x25>
+  80197a:	48 83 c7 01          	add    $0x1,%rdi
+  80197e:	0f b6 37             	movzbl (%rdi),%esi
+  801981:	40 80 fe 20          	cmp    $0x20,%sil
+  801985:	74 f3                	je     80197a <strtol+0x12>
+  801987:	40 80 fe 09          	cmp    $0x9,%sil
+  80198b:	74 ed                	je     80197a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80198d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801990:	83 e0 fd             	and    $0xfffffffd,%eax
+  801993:	3c 01                	cmp    $0x1,%al
+  801995:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801999:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80199f:	75 0f                	jne    8019b0 <strtol+0x48>
+  8019a1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8019a4:	74 14                	je     8019ba <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8019a6:	85 d2                	test   %edx,%edx
+  8019a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019ad:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8019b0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8019b5:	4c 63 ca             	movslq %edx,%r9
+  8019b8:	eb 36                	jmp    8019f0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8019ba:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8019be:	74 0f                	je     8019cf <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8019c0:	85 d2                	test   %edx,%edx
+  8019c2:	75 ec                	jne    8019b0 <strtol+0x48>
+        s++;
+  8019c4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8019c8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8019cd:	eb e1                	jmp    8019b0 <strtol+0x48>
+        s += 2;
+  8019cf:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8019d3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8019d8:	eb d6                	jmp    8019b0 <strtol+0x48>
+            dig -= '0';
+  8019da:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8019dd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8019e1:	41 39 d0             	cmp    %edx,%r8d
+  8019e4:	7d 21                	jge    801a07 <strtol+0x9f>
+        val = val * base + dig;
+  8019e6:	49 0f af c1          	imul   %r9,%rax
+  8019ea:	0f b6 c9             	movzbl %cl,%ecx
+  8019ed:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8019f0:	48 83 c7 01          	add    $0x1,%rdi
+  8019f4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8019f8:	80 f9 39             	cmp    $0x39,%cl
+  8019fb:	76 dd                	jbe    8019da <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8019fd:	80 f9 7b             	cmp    $0x7b,%cl
+  801a00:	77 05                	ja     801a07 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801a02:	83 e9 57             	sub    $0x57,%ecx
+  801a05:	eb d6                	jmp    8019dd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801a07:	4d 85 d2             	test   %r10,%r10
+  801a0a:	74 03                	je     801a0f <strtol+0xa7>
+  801a0c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a0f:	48 89 c2             	mov    %rax,%rdx
+  801a12:	48 f7 da             	neg    %rdx
+  801a15:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a19:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a1d:	c3                   	ret
+
+0000000000801a1e <strrev>:
+
+void
+strrev(char *str)
+{
+  801a1e:	55                   	push   %rbp
+  801a1f:	48 89 e5             	mov    %rsp,%rbp
+  801a22:	53                   	push   %rbx
+  801a23:	48 83 ec 08          	sub    $0x8,%rsp
+  801a27:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801a2a:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801a36:	83 e8 01             	sub    $0x1,%eax
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	7e 22                	jle    801a5f <strrev+0x41>
+  801a3d:	48 98                	cltq
+  801a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801a44:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801a48:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801a4c:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801a50:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801a53:	48 83 c2 01          	add    $0x1,%rdx
+  801a57:	48 83 e8 01          	sub    $0x1,%rax
+  801a5b:	39 c2                	cmp    %eax,%edx
+  801a5d:	7c e5                	jl     801a44 <strrev+0x26>
+	}
+}
+  801a5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+
+0000000000801a65 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801a65:	85 d2                	test   %edx,%edx
+  801a67:	0f 84 80 00 00 00    	je     801aed <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	53                   	push   %rbx
+  801a72:	48 83 ec 08          	sub    $0x8,%rsp
+  801a76:	49 89 f2             	mov    %rsi,%r10
+  801a79:	41 89 d3             	mov    %edx,%r11d
+  801a7c:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801a7f:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801a84:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801a87:	eb 20                	jmp    801aa9 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801a89:	41 89 f1             	mov    %esi,%r9d
+  801a8c:	83 c2 30             	add    $0x30,%edx
+  801a8f:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801a92:	89 f8                	mov    %edi,%eax
+  801a94:	99                   	cltd
+  801a95:	f7 f9                	idiv   %ecx
+  801a97:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	74 2e                	je     801acb <itoa+0x66>
+  801a9d:	83 c6 01             	add    $0x1,%esi
+  801aa0:	49 83 c0 01          	add    $0x1,%r8
+  801aa4:	44 39 cb             	cmp    %r9d,%ebx
+  801aa7:	7e 15                	jle    801abe <itoa+0x59>
+		digit = sum % base;
+  801aa9:	89 f8                	mov    %edi,%eax
+  801aab:	99                   	cltd
+  801aac:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801aae:	83 fa 09             	cmp    $0x9,%edx
+  801ab1:	7e d6                	jle    801a89 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801ab3:	41 89 f1             	mov    %esi,%r9d
+  801ab6:	83 c2 37             	add    $0x37,%edx
+  801ab9:	41 88 10             	mov    %dl,(%r8)
+  801abc:	eb d4                	jmp    801a92 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801abe:	41 83 eb 01          	sub    $0x1,%r11d
+  801ac2:	45 39 cb             	cmp    %r9d,%r11d
+  801ac5:	75 04                	jne    801acb <itoa+0x66>
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	75 28                	jne    801af3 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801acb:	4d 63 c9             	movslq %r9d,%r9
+  801ace:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801ad3:	4c 89 d7             	mov    %r10,%rdi
+  801ad6:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  801add:	00 00 00 
+  801ae0:	ff d0                	call   *%rax
+	return 0;
+  801ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aeb:	c9                   	leave
+  801aec:	c3                   	ret
+		return -1;
+  801aed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801af2:	c3                   	ret
+		return -1;
+  801af3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801af8:	eb ed                	jmp    801ae7 <itoa+0x82>
+
+0000000000801afa <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801afa:	55                   	push   %rbp
+  801afb:	48 89 e5             	mov    %rsp,%rbp
+  801afe:	41 57                	push   %r15
+  801b00:	41 56                	push   %r14
+  801b02:	41 55                	push   %r13
+  801b04:	41 54                	push   %r12
+  801b06:	53                   	push   %rbx
+  801b07:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801b0b:	48 85 ff             	test   %rdi,%rdi
+  801b0e:	74 23                	je     801b33 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801b10:	48 89 fa             	mov    %rdi,%rdx
+  801b13:	48 be d2 4e 80 00 00 	movabs $0x804ed2,%rsi
+  801b1a:	00 00 00 
+  801b1d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b27:	48 b9 e4 3a 80 00 00 	movabs $0x803ae4,%rcx
+  801b2e:	00 00 00 
+  801b31:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801b33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b38:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801b47:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801b4d:	49 bd db 09 80 00 00 	movabs $0x8009db,%r13
+  801b54:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801b57:	49 bf b8 09 80 00 00 	movabs $0x8009b8,%r15
+  801b5e:	00 00 00 
+  801b61:	eb 46                	jmp    801ba9 <readline+0xaf>
+            return NULL;
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801b68:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801b6b:	75 0f                	jne    801b7c <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801b6d:	48 83 c4 08          	add    $0x8,%rsp
+  801b71:	5b                   	pop    %rbx
+  801b72:	41 5c                	pop    %r12
+  801b74:	41 5d                	pop    %r13
+  801b76:	41 5e                	pop    %r14
+  801b78:	41 5f                	pop    %r15
+  801b7a:	5d                   	pop    %rbp
+  801b7b:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801b7c:	89 de                	mov    %ebx,%esi
+  801b7e:	48 bf c7 54 80 00 00 	movabs $0x8054c7,%rdi
+  801b85:	00 00 00 
+  801b88:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  801b8f:	00 00 00 
+  801b92:	ff d2                	call   *%rdx
+            return NULL;
+  801b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b99:	eb d2                	jmp    801b6d <readline+0x73>
+            if (i) {
+  801b9b:	4d 85 e4             	test   %r12,%r12
+  801b9e:	74 09                	je     801ba9 <readline+0xaf>
+                if (echo) {
+  801ba0:	45 85 f6             	test   %r14d,%r14d
+  801ba3:	75 3f                	jne    801be4 <readline+0xea>
+                i--;
+  801ba5:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  801ba9:	41 ff d5             	call   *%r13
+  801bac:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 b1                	js     801b63 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801bb2:	83 f8 08             	cmp    $0x8,%eax
+  801bb5:	74 e4                	je     801b9b <readline+0xa1>
+  801bb7:	83 f8 7f             	cmp    $0x7f,%eax
+  801bba:	74 df                	je     801b9b <readline+0xa1>
+        } else if (c >= ' ') {
+  801bbc:	83 f8 1f             	cmp    $0x1f,%eax
+  801bbf:	7e 4d                	jle    801c0e <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801bc1:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801bc8:	77 df                	ja     801ba9 <readline+0xaf>
+                if (echo) {
+  801bca:	45 85 f6             	test   %r14d,%r14d
+  801bcd:	75 2f                	jne    801bfe <readline+0x104>
+                buf[i++] = (char)c;
+  801bcf:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801bd6:	00 00 00 
+  801bd9:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  801bdd:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801be2:	eb c5                	jmp    801ba9 <readline+0xaf>
+                    cputchar('\b');
+  801be4:	bf 08 00 00 00       	mov    $0x8,%edi
+  801be9:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  801bec:	bf 20 00 00 00       	mov    $0x20,%edi
+  801bf1:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801bf4:	bf 08 00 00 00       	mov    $0x8,%edi
+  801bf9:	41 ff d7             	call   *%r15
+  801bfc:	eb a7                	jmp    801ba5 <readline+0xab>
+                    cputchar(c);
+  801bfe:	89 c7                	mov    %eax,%edi
+  801c00:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	eb c1                	jmp    801bcf <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801c0e:	83 f8 0a             	cmp    $0xa,%eax
+  801c11:	74 05                	je     801c18 <readline+0x11e>
+  801c13:	83 f8 0d             	cmp    $0xd,%eax
+  801c16:	75 91                	jne    801ba9 <readline+0xaf>
+            if (echo) {
+  801c18:	45 85 f6             	test   %r14d,%r14d
+  801c1b:	75 14                	jne    801c31 <readline+0x137>
+            buf[i] = 0;
+  801c1d:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801c24:	00 00 00 
+  801c27:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801c2c:	e9 3c ff ff ff       	jmp    801b6d <readline+0x73>
+                cputchar('\n');
+  801c31:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801c36:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801c3d:	00 00 00 
+  801c40:	ff d0                	call   *%rax
+  801c42:	eb d9                	jmp    801c1d <readline+0x123>
+
+0000000000801c44 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	53                   	push   %rbx
+  801c49:	48 89 fa             	mov    %rdi,%rdx
+  801c4c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c69:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6f:	c9                   	leave
+  801c70:	c3                   	ret
+
+0000000000801c71 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c71:	55                   	push   %rbp
+  801c72:	48 89 e5             	mov    %rsp,%rbp
+  801c75:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c76:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c80:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c9a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ca0:	c9                   	leave
+  801ca1:	c3                   	ret
+
+0000000000801ca2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ca2:	55                   	push   %rbp
+  801ca3:	48 89 e5             	mov    %rsp,%rbp
+  801ca6:	53                   	push   %rbx
+  801ca7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801cab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cae:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ccd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ccf:	48 85 c0             	test   %rax,%rax
+  801cd2:	7f 06                	jg     801cda <sys_env_destroy+0x38>
+}
+  801cd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cda:	49 89 c0             	mov    %rax,%r8
+  801cdd:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ce2:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801ce9:	00 00 00 
+  801cec:	be 26 00 00 00       	mov    $0x26,%esi
+  801cf1:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801cf8:	00 00 00 
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d00:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801d07:	00 00 00 
+  801d0a:	41 ff d1             	call   *%r9
+
+0000000000801d0d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801d0d:	55                   	push   %rbp
+  801d0e:	48 89 e5             	mov    %rsp,%rbp
+  801d11:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d12:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d26:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d36:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+0000000000801d3e <sys_yield>:
+
+void
+sys_yield(void) {
+  801d3e:	55                   	push   %rbp
+  801d3f:	48 89 e5             	mov    %rsp,%rbp
+  801d42:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d43:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d57:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d67:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+
+0000000000801d6f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+  801d73:	53                   	push   %rbx
+  801d74:	48 89 fa             	mov    %rdi,%rdx
+  801d77:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d7a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d7f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d86:	00 00 00 
+  801d89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d99:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d9f:	c9                   	leave
+  801da0:	c3                   	ret
+
+0000000000801da1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801da1:	55                   	push   %rbp
+  801da2:	48 89 e5             	mov    %rsp,%rbp
+  801da5:	53                   	push   %rbx
+  801da6:	49 89 f8             	mov    %rdi,%r8
+  801da9:	48 89 d3             	mov    %rdx,%rbx
+  801dac:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801daf:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801db4:	4c 89 c2             	mov    %r8,%rdx
+  801db7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dba:	be 00 00 00 00       	mov    $0x0,%esi
+  801dbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dc5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801dc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+
+0000000000801dcd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	53                   	push   %rbx
+  801dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd6:	89 f8                	mov    %edi,%eax
+  801dd8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801ddb:	48 63 f9             	movslq %ecx,%rdi
+  801dde:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801de1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801de6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801de9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801df4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801df6:	48 85 c0             	test   %rax,%rax
+  801df9:	7f 06                	jg     801e01 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801dfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dff:	c9                   	leave
+  801e00:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e01:	49 89 c0             	mov    %rax,%r8
+  801e04:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801e09:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801e10:	00 00 00 
+  801e13:	be 26 00 00 00       	mov    $0x26,%esi
+  801e18:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801e1f:	00 00 00 
+  801e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e27:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801e2e:	00 00 00 
+  801e31:	41 ff d1             	call   *%r9
+
+0000000000801e34 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e34:	55                   	push   %rbp
+  801e35:	48 89 e5             	mov    %rsp,%rbp
+  801e38:	53                   	push   %rbx
+  801e39:	48 83 ec 08          	sub    $0x8,%rsp
+  801e3d:	89 f8                	mov    %edi,%eax
+  801e3f:	49 89 f2             	mov    %rsi,%r10
+  801e42:	48 89 cf             	mov    %rcx,%rdi
+  801e45:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e48:	48 63 da             	movslq %edx,%rbx
+  801e4b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e53:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e56:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e59:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e5b:	48 85 c0             	test   %rax,%rax
+  801e5e:	7f 06                	jg     801e66 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e66:	49 89 c0             	mov    %rax,%r8
+  801e69:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e6e:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801e75:	00 00 00 
+  801e78:	be 26 00 00 00       	mov    $0x26,%esi
+  801e7d:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801e84:	00 00 00 
+  801e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8c:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801e93:	00 00 00 
+  801e96:	41 ff d1             	call   *%r9
+
+0000000000801e99 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	53                   	push   %rbx
+  801e9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea2:	48 89 f1             	mov    %rsi,%rcx
+  801ea5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801ea8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eab:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eb0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ec0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ec2:	48 85 c0             	test   %rax,%rax
+  801ec5:	7f 06                	jg     801ecd <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801ec7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ecb:	c9                   	leave
+  801ecc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ecd:	49 89 c0             	mov    %rax,%r8
+  801ed0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ed5:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801edc:	00 00 00 
+  801edf:	be 26 00 00 00       	mov    $0x26,%esi
+  801ee4:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801eeb:	00 00 00 
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801efa:	00 00 00 
+  801efd:	41 ff d1             	call   *%r9
+
+0000000000801f00 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	53                   	push   %rbx
+  801f05:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801f09:	48 63 ce             	movslq %esi,%rcx
+  801f0c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f0f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f19:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f29:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f2b:	48 85 c0             	test   %rax,%rax
+  801f2e:	7f 06                	jg     801f36 <sys_env_set_status+0x36>
+}
+  801f30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f36:	49 89 c0             	mov    %rax,%r8
+  801f39:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801f3e:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801f45:	00 00 00 
+  801f48:	be 26 00 00 00       	mov    $0x26,%esi
+  801f4d:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801f54:	00 00 00 
+  801f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5c:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801f63:	00 00 00 
+  801f66:	41 ff d1             	call   *%r9
+
+0000000000801f69 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801f69:	55                   	push   %rbp
+  801f6a:	48 89 e5             	mov    %rsp,%rbp
+  801f6d:	53                   	push   %rbx
+  801f6e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f72:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801f75:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f78:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f87:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f94:	48 85 c0             	test   %rax,%rax
+  801f97:	7f 06                	jg     801f9f <sys_env_set_trapframe+0x36>
+}
+  801f99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f9f:	49 89 c0             	mov    %rax,%r8
+  801fa2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801fa7:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  801fae:	00 00 00 
+  801fb1:	be 26 00 00 00       	mov    $0x26,%esi
+  801fb6:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  801fbd:	00 00 00 
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  801fcc:	00 00 00 
+  801fcf:	41 ff d1             	call   *%r9
+
+0000000000801fd2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801fd2:	55                   	push   %rbp
+  801fd3:	48 89 e5             	mov    %rsp,%rbp
+  801fd6:	53                   	push   %rbx
+  801fd7:	48 83 ec 08          	sub    $0x8,%rsp
+  801fdb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801fde:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801feb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ffb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ffd:	48 85 c0             	test   %rax,%rax
+  802000:	7f 06                	jg     802008 <sys_env_set_pgfault_upcall+0x36>
+}
+  802002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802008:	49 89 c0             	mov    %rax,%r8
+  80200b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802010:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  802017:	00 00 00 
+  80201a:	be 26 00 00 00       	mov    $0x26,%esi
+  80201f:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  802026:	00 00 00 
+  802029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202e:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  802035:	00 00 00 
+  802038:	41 ff d1             	call   *%r9
+
+000000000080203b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	53                   	push   %rbx
+  802040:	89 f8                	mov    %edi,%eax
+  802042:	49 89 f1             	mov    %rsi,%r9
+  802045:	48 89 d3             	mov    %rdx,%rbx
+  802048:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80204b:	49 63 f0             	movslq %r8d,%rsi
+  80204e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802051:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802056:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802059:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80205f:	cd 30                	int    $0x30
+}
+  802061:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+
+0000000000802067 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  802067:	55                   	push   %rbp
+  802068:	48 89 e5             	mov    %rsp,%rbp
+  80206b:	53                   	push   %rbx
+  80206c:	48 83 ec 08          	sub    $0x8,%rsp
+  802070:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  802073:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802076:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80207b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80207e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802083:	be 00 00 00 00       	mov    $0x0,%esi
+  802088:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80208e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802090:	48 85 c0             	test   %rax,%rax
+  802093:	7f 06                	jg     80209b <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802095:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802099:	c9                   	leave
+  80209a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80209b:	49 89 c0             	mov    %rax,%r8
+  80209e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8020a3:	48 ba d8 54 80 00 00 	movabs $0x8054d8,%rdx
+  8020aa:	00 00 00 
+  8020ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8020b2:	48 bf f7 54 80 00 00 	movabs $0x8054f7,%rdi
+  8020b9:	00 00 00 
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	49 b9 82 0b 80 00 00 	movabs $0x800b82,%r9
+  8020c8:	00 00 00 
+  8020cb:	41 ff d1             	call   *%r9
+
+00000000008020ce <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8020d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d7:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+}
+  8020e3:	5d                   	pop    %rbp
+  8020e4:	c3                   	ret
+
+00000000008020e5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8020e5:	55                   	push   %rbp
+  8020e6:	48 89 e5             	mov    %rsp,%rbp
+  8020e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8020ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802103:	be 00 00 00 00       	mov    $0x0,%esi
+  802108:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80210e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802110:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802114:	c9                   	leave
+  802115:	c3                   	ret
+
+0000000000802116 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  802116:	55                   	push   %rbp
+  802117:	48 89 e5             	mov    %rsp,%rbp
+  80211a:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80211b:	48 63 ce             	movslq %esi,%rcx
+  80211e:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  802122:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802127:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80212c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802131:	be 00 00 00 00       	mov    $0x0,%esi
+  802136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80213c:	cd 30                	int    $0x30
+}
+  80213e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802142:	c9                   	leave
+  802143:	c3                   	ret
+
+0000000000802144 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	53                   	push   %rbx
+  802149:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80214c:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802150:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80215a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80215f:	be 00 00 00 00       	mov    $0x0,%esi
+  802164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80216a:	cd 30                	int    $0x30
+}
+  80216c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+0000000000802172 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  802172:	55                   	push   %rbp
+  802173:	48 89 e5             	mov    %rsp,%rbp
+  802176:	53                   	push   %rbx
+  802177:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80217a:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80217d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802182:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802185:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80218a:	be 00 00 00 00       	mov    $0x0,%esi
+  80218f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802195:	cd 30                	int    $0x30
+}
+  802197:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+000000000080219d <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8021a4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021a9:	cd 30                	int    $0x30
+  8021ab:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 7e                	js     802230 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  8021b2:	0f 84 80 00 00 00    	je     802238 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8021b8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8021be:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8021c5:	00 00 00 
+  8021c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021cd:	89 c2                	mov    %eax,%edx
+  8021cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d9:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	0f 88 81 00 00 00    	js     80226e <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8021ed:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  8021f4:	00 00 00 
+  8021f7:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  8021fe:	44 89 e7             	mov    %r12d,%edi
+  802201:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 65                	js     802276 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  802211:	be 02 00 00 00       	mov    $0x2,%esi
+  802216:	44 89 e7             	mov    %r12d,%edi
+  802219:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  802220:	00 00 00 
+  802223:	ff d0                	call   *%rax
+        return -1;
+  802225:	85 c0                	test   %eax,%eax
+  802227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80222c:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  802230:	44 89 e0             	mov    %r12d,%eax
+  802233:	5b                   	pop    %rbx
+  802234:	41 5c                	pop    %r12
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802238:	48 b8 0d 1d 80 00 00 	movabs $0x801d0d,%rax
+  80223f:	00 00 00 
+  802242:	ff d0                	call   *%rax
+  802244:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802249:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80224d:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  802251:	48 c1 e0 04          	shl    $0x4,%rax
+  802255:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80225c:	00 00 00 
+  80225f:	48 01 d0             	add    %rdx,%rax
+  802262:	48 a3 18 70 80 00 00 	movabs %rax,0x807018
+  802269:	00 00 00 
+        return 0;
+  80226c:	eb c2                	jmp    802230 <fork+0x93>
+        return -1;
+  80226e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802274:	eb ba                	jmp    802230 <fork+0x93>
+        return -1;
+  802276:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80227c:	eb b2                	jmp    802230 <fork+0x93>
+
+000000000080227e <sfork>:
+
+envid_t
+sfork() {
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802282:	48 ba 05 55 80 00 00 	movabs $0x805505,%rdx
+  802289:	00 00 00 
+  80228c:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802291:	48 bf 20 55 80 00 00 	movabs $0x805520,%rdi
+  802298:	00 00 00 
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a0:	48 b9 82 0b 80 00 00 	movabs $0x800b82,%rcx
+  8022a7:	00 00 00 
+  8022aa:	ff d1                	call   *%rcx
+
+00000000008022ac <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  8022ac:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  8022af:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  8022b3:	83 3f 01             	cmpl   $0x1,(%rdi)
+  8022b6:	7e 0f                	jle    8022c7 <argstart+0x1b>
+  8022b8:	48 b8 1c 4e 80 00 00 	movabs $0x804e1c,%rax
+  8022bf:	00 00 00 
+  8022c2:	48 85 f6             	test   %rsi,%rsi
+  8022c5:	75 05                	jne    8022cc <argstart+0x20>
+  8022c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cc:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  8022d0:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  8022d7:	00 
+}
+  8022d8:	c3                   	ret
+
+00000000008022d9 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  8022d9:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8022e0:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8022e1:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8022e5:	48 85 c0             	test   %rax,%rax
+  8022e8:	0f 84 8f 00 00 00    	je     80237d <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8022ee:	55                   	push   %rbp
+  8022ef:	48 89 e5             	mov    %rsp,%rbp
+  8022f2:	53                   	push   %rbx
+  8022f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f7:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8022fa:	80 38 00             	cmpb   $0x0,(%rax)
+  8022fd:	75 52                	jne    802351 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8022ff:	48 8b 17             	mov    (%rdi),%rdx
+  802302:	83 3a 01             	cmpl   $0x1,(%rdx)
+  802305:	74 67                	je     80236e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802307:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80230b:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80230f:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802312:	75 5a                	jne    80236e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802314:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802318:	74 54                	je     80236e <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  80231a:	48 83 c0 01          	add    $0x1,%rax
+  80231e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802322:	8b 12                	mov    (%rdx),%edx
+  802324:	83 ea 01             	sub    $0x1,%edx
+  802327:	48 63 d2             	movslq %edx,%rdx
+  80232a:	48 c1 e2 03          	shl    $0x3,%rdx
+  80232e:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802332:	48 83 c7 08          	add    $0x8,%rdi
+  802336:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  802342:	48 8b 03             	mov    (%rbx),%rax
+  802345:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802348:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80234c:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80234f:	74 17                	je     802368 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  802351:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802355:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802358:	48 83 c0 01          	add    $0x1,%rax
+  80235c:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  802360:	89 d0                	mov    %edx,%eax
+  802362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802366:	c9                   	leave
+  802367:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802368:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  80236c:	75 e3                	jne    802351 <argnext+0x78>
+    args->curarg = 0;
+  80236e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802375:	00 
+    return -1;
+  802376:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80237b:	eb e3                	jmp    802360 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  80237d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  802382:	89 d0                	mov    %edx,%eax
+  802384:	c3                   	ret
+
+0000000000802385 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802385:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802389:	48 85 c0             	test   %rax,%rax
+  80238c:	74 7b                	je     802409 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+  802392:	53                   	push   %rbx
+  802393:	48 83 ec 08          	sub    $0x8,%rsp
+  802397:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  80239a:	80 38 00             	cmpb   $0x0,(%rax)
+  80239d:	74 1c                	je     8023bb <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80239f:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  8023a3:	48 b8 1c 4e 80 00 00 	movabs $0x804e1c,%rax
+  8023aa:	00 00 00 
+  8023ad:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  8023b1:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8023b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b9:	c9                   	leave
+  8023ba:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8023bb:	48 8b 07             	mov    (%rdi),%rax
+  8023be:	83 38 01             	cmpl   $0x1,(%rax)
+  8023c1:	7f 12                	jg     8023d5 <argnextvalue+0x50>
+        args->argvalue = 0;
+  8023c3:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8023ca:	00 
+        args->curarg = 0;
+  8023cb:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8023d2:	00 
+  8023d3:	eb dc                	jmp    8023b1 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8023d5:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8023d9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8023dd:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8023e1:	8b 10                	mov    (%rax),%edx
+  8023e3:	83 ea 01             	sub    $0x1,%edx
+  8023e6:	48 63 d2             	movslq %edx,%rdx
+  8023e9:	48 c1 e2 03          	shl    $0x3,%rdx
+  8023ed:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8023f1:	48 83 c7 08          	add    $0x8,%rdi
+  8023f5:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  8023fc:	00 00 00 
+  8023ff:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802401:	48 8b 03             	mov    (%rbx),%rax
+  802404:	83 28 01             	subl   $0x1,(%rax)
+  802407:	eb a8                	jmp    8023b1 <argnextvalue+0x2c>
+}
+  802409:	c3                   	ret
+
+000000000080240a <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  80240a:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80240e:	48 85 c0             	test   %rax,%rax
+  802411:	74 01                	je     802414 <argvalue+0xa>
+}
+  802413:	c3                   	ret
+argvalue(struct Argstate *args) {
+  802414:	55                   	push   %rbp
+  802415:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802418:	48 b8 85 23 80 00 00 	movabs $0x802385,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+}
+  802424:	5d                   	pop    %rbp
+  802425:	c3                   	ret
+
+0000000000802426 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802426:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80242d:	ff ff ff 
+  802430:	48 01 f8             	add    %rdi,%rax
+  802433:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802437:	c3                   	ret
+
+0000000000802438 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802438:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80243f:	ff ff ff 
+  802442:	48 01 f8             	add    %rdi,%rax
+  802445:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802449:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80244f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802453:	c3                   	ret
+
+0000000000802454 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+  802458:	41 57                	push   %r15
+  80245a:	41 56                	push   %r14
+  80245c:	41 55                	push   %r13
+  80245e:	41 54                	push   %r12
+  802460:	53                   	push   %rbx
+  802461:	48 83 ec 08          	sub    $0x8,%rsp
+  802465:	49 89 ff             	mov    %rdi,%r15
+  802468:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80246d:	49 bd e7 4a 80 00 00 	movabs $0x804ae7,%r13
+  802474:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802477:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80247d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802480:	48 89 df             	mov    %rbx,%rdi
+  802483:	41 ff d5             	call   *%r13
+  802486:	83 e0 04             	and    $0x4,%eax
+  802489:	74 17                	je     8024a2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80248b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802492:	4c 39 f3             	cmp    %r14,%rbx
+  802495:	75 e6                	jne    80247d <fd_alloc+0x29>
+  802497:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80249d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8024a2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8024a5:	48 83 c4 08          	add    $0x8,%rsp
+  8024a9:	5b                   	pop    %rbx
+  8024aa:	41 5c                	pop    %r12
+  8024ac:	41 5d                	pop    %r13
+  8024ae:	41 5e                	pop    %r14
+  8024b0:	41 5f                	pop    %r15
+  8024b2:	5d                   	pop    %rbp
+  8024b3:	c3                   	ret
+
+00000000008024b4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8024b4:	83 ff 1f             	cmp    $0x1f,%edi
+  8024b7:	77 39                	ja     8024f2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8024b9:	55                   	push   %rbp
+  8024ba:	48 89 e5             	mov    %rsp,%rbp
+  8024bd:	41 54                	push   %r12
+  8024bf:	53                   	push   %rbx
+  8024c0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8024c3:	48 63 df             	movslq %edi,%rbx
+  8024c6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8024cd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8024d1:	48 89 df             	mov    %rbx,%rdi
+  8024d4:	48 b8 e7 4a 80 00 00 	movabs $0x804ae7,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+  8024e0:	a8 04                	test   $0x4,%al
+  8024e2:	74 14                	je     8024f8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8024e4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ed:	5b                   	pop    %rbx
+  8024ee:	41 5c                	pop    %r12
+  8024f0:	5d                   	pop    %rbp
+  8024f1:	c3                   	ret
+        return -E_INVAL;
+  8024f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024f7:	c3                   	ret
+        return -E_INVAL;
+  8024f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024fd:	eb ee                	jmp    8024ed <fd_lookup+0x39>
+
+00000000008024ff <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8024ff:	55                   	push   %rbp
+  802500:	48 89 e5             	mov    %rsp,%rbp
+  802503:	41 54                	push   %r12
+  802505:	53                   	push   %rbx
+  802506:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802509:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  802510:	00 00 00 
+  802513:	48 bb a0 60 80 00 00 	movabs $0x8060a0,%rbx
+  80251a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80251d:	39 3b                	cmp    %edi,(%rbx)
+  80251f:	74 47                	je     802568 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802521:	48 83 c0 08          	add    $0x8,%rax
+  802525:	48 8b 18             	mov    (%rax),%rbx
+  802528:	48 85 db             	test   %rbx,%rbx
+  80252b:	75 f0                	jne    80251d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80252d:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  802534:	00 00 00 
+  802537:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80253d:	89 fa                	mov    %edi,%edx
+  80253f:	48 bf 30 55 80 00 00 	movabs $0x805530,%rdi
+  802546:	00 00 00 
+  802549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80254e:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  802555:	00 00 00 
+  802558:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80255a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80255f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802563:	5b                   	pop    %rbx
+  802564:	41 5c                	pop    %r12
+  802566:	5d                   	pop    %rbp
+  802567:	c3                   	ret
+            return 0;
+  802568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256d:	eb f0                	jmp    80255f <dev_lookup+0x60>
+
+000000000080256f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80256f:	55                   	push   %rbp
+  802570:	48 89 e5             	mov    %rsp,%rbp
+  802573:	41 55                	push   %r13
+  802575:	41 54                	push   %r12
+  802577:	53                   	push   %rbx
+  802578:	48 83 ec 18          	sub    $0x18,%rsp
+  80257c:	48 89 fb             	mov    %rdi,%rbx
+  80257f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802582:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802589:	ff ff ff 
+  80258c:	48 01 df             	add    %rbx,%rdi
+  80258f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802593:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802597:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  80259e:	00 00 00 
+  8025a1:	ff d0                	call   *%rax
+  8025a3:	41 89 c5             	mov    %eax,%r13d
+  8025a6:	85 c0                	test   %eax,%eax
+  8025a8:	78 06                	js     8025b0 <fd_close+0x41>
+  8025aa:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8025ae:	74 1a                	je     8025ca <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8025b0:	45 84 e4             	test   %r12b,%r12b
+  8025b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8025bc:	44 89 e8             	mov    %r13d,%eax
+  8025bf:	48 83 c4 18          	add    $0x18,%rsp
+  8025c3:	5b                   	pop    %rbx
+  8025c4:	41 5c                	pop    %r12
+  8025c6:	41 5d                	pop    %r13
+  8025c8:	5d                   	pop    %rbp
+  8025c9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8025ca:	8b 3b                	mov    (%rbx),%edi
+  8025cc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025d0:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+  8025dc:	41 89 c5             	mov    %eax,%r13d
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	78 1b                	js     8025fe <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8025e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025e7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8025eb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8025f1:	48 85 c0             	test   %rax,%rax
+  8025f4:	74 08                	je     8025fe <fd_close+0x8f>
+  8025f6:	48 89 df             	mov    %rbx,%rdi
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802603:	48 89 de             	mov    %rbx,%rsi
+  802606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260b:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+    return res;
+  802617:	eb a3                	jmp    8025bc <fd_close+0x4d>
+
+0000000000802619 <close>:
+
+int
+close(int fdnum) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802621:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802625:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 15                	js     80264a <close+0x31>
+
+    return fd_close(fd, 1);
+  802635:	be 01 00 00 00       	mov    $0x1,%esi
+  80263a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80263e:	48 b8 6f 25 80 00 00 	movabs $0x80256f,%rax
+  802645:	00 00 00 
+  802648:	ff d0                	call   *%rax
+}
+  80264a:	c9                   	leave
+  80264b:	c3                   	ret
+
+000000000080264c <close_all>:
+
+void
+close_all(void) {
+  80264c:	55                   	push   %rbp
+  80264d:	48 89 e5             	mov    %rsp,%rbp
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802658:	49 bc 19 26 80 00 00 	movabs $0x802619,%r12
+  80265f:	00 00 00 
+  802662:	89 df                	mov    %ebx,%edi
+  802664:	41 ff d4             	call   *%r12
+  802667:	83 c3 01             	add    $0x1,%ebx
+  80266a:	83 fb 20             	cmp    $0x20,%ebx
+  80266d:	75 f3                	jne    802662 <close_all+0x16>
+}
+  80266f:	5b                   	pop    %rbx
+  802670:	41 5c                	pop    %r12
+  802672:	5d                   	pop    %rbp
+  802673:	c3                   	ret
+
+0000000000802674 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802674:	55                   	push   %rbp
+  802675:	48 89 e5             	mov    %rsp,%rbp
+  802678:	41 57                	push   %r15
+  80267a:	41 56                	push   %r14
+  80267c:	41 55                	push   %r13
+  80267e:	41 54                	push   %r12
+  802680:	53                   	push   %rbx
+  802681:	48 83 ec 18          	sub    $0x18,%rsp
+  802685:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802688:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80268c:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	89 c3                	mov    %eax,%ebx
+  80269a:	85 c0                	test   %eax,%eax
+  80269c:	0f 88 b8 00 00 00    	js     80275a <dup+0xe6>
+    close(newfdnum);
+  8026a2:	44 89 e7             	mov    %r12d,%edi
+  8026a5:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  8026ac:	00 00 00 
+  8026af:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8026b1:	4d 63 ec             	movslq %r12d,%r13
+  8026b4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8026bb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8026bf:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8026c3:	4c 89 ff             	mov    %r15,%rdi
+  8026c6:	49 be 38 24 80 00 00 	movabs $0x802438,%r14
+  8026cd:	00 00 00 
+  8026d0:	41 ff d6             	call   *%r14
+  8026d3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8026d6:	4c 89 ef             	mov    %r13,%rdi
+  8026d9:	41 ff d6             	call   *%r14
+  8026dc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8026df:	48 89 df             	mov    %rbx,%rdi
+  8026e2:	48 b8 e7 4a 80 00 00 	movabs $0x804ae7,%rax
+  8026e9:	00 00 00 
+  8026ec:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8026ee:	a8 04                	test   $0x4,%al
+  8026f0:	74 2b                	je     80271d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8026f2:	41 89 c1             	mov    %eax,%r9d
+  8026f5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8026fb:	4c 89 f1             	mov    %r14,%rcx
+  8026fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802703:	48 89 de             	mov    %rbx,%rsi
+  802706:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270b:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  802712:	00 00 00 
+  802715:	ff d0                	call   *%rax
+  802717:	89 c3                	mov    %eax,%ebx
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	78 4e                	js     80276b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80271d:	4c 89 ff             	mov    %r15,%rdi
+  802720:	48 b8 e7 4a 80 00 00 	movabs $0x804ae7,%rax
+  802727:	00 00 00 
+  80272a:	ff d0                	call   *%rax
+  80272c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80272f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802735:	4c 89 e9             	mov    %r13,%rcx
+  802738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273d:	4c 89 fe             	mov    %r15,%rsi
+  802740:	bf 00 00 00 00       	mov    $0x0,%edi
+  802745:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	89 c3                	mov    %eax,%ebx
+  802753:	85 c0                	test   %eax,%eax
+  802755:	78 14                	js     80276b <dup+0xf7>
+
+    return newfdnum;
+  802757:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80275a:	89 d8                	mov    %ebx,%eax
+  80275c:	48 83 c4 18          	add    $0x18,%rsp
+  802760:	5b                   	pop    %rbx
+  802761:	41 5c                	pop    %r12
+  802763:	41 5d                	pop    %r13
+  802765:	41 5e                	pop    %r14
+  802767:	41 5f                	pop    %r15
+  802769:	5d                   	pop    %rbp
+  80276a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80276b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802770:	4c 89 ee             	mov    %r13,%rsi
+  802773:	bf 00 00 00 00       	mov    $0x0,%edi
+  802778:	49 bc 99 1e 80 00 00 	movabs $0x801e99,%r12
+  80277f:	00 00 00 
+  802782:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802785:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278a:	4c 89 f6             	mov    %r14,%rsi
+  80278d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802792:	41 ff d4             	call   *%r12
+    return res;
+  802795:	eb c3                	jmp    80275a <dup+0xe6>
+
+0000000000802797 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802797:	55                   	push   %rbp
+  802798:	48 89 e5             	mov    %rsp,%rbp
+  80279b:	41 56                	push   %r14
+  80279d:	41 55                	push   %r13
+  80279f:	41 54                	push   %r12
+  8027a1:	53                   	push   %rbx
+  8027a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a6:	89 fb                	mov    %edi,%ebx
+  8027a8:	49 89 f4             	mov    %rsi,%r12
+  8027ab:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027ae:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027b2:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  8027b9:	00 00 00 
+  8027bc:	ff d0                	call   *%rax
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	78 4c                	js     80280e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027c2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027c6:	41 8b 3e             	mov    (%r14),%edi
+  8027c9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027cd:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	85 c0                	test   %eax,%eax
+  8027db:	78 35                	js     802812 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8027dd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8027e1:	83 e0 03             	and    $0x3,%eax
+  8027e4:	83 f8 01             	cmp    $0x1,%eax
+  8027e7:	74 2d                	je     802816 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8027e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027f1:	48 85 c0             	test   %rax,%rax
+  8027f4:	74 56                	je     80284c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8027f6:	4c 89 ea             	mov    %r13,%rdx
+  8027f9:	4c 89 e6             	mov    %r12,%rsi
+  8027fc:	4c 89 f7             	mov    %r14,%rdi
+  8027ff:	ff d0                	call   *%rax
+}
+  802801:	48 83 c4 10          	add    $0x10,%rsp
+  802805:	5b                   	pop    %rbx
+  802806:	41 5c                	pop    %r12
+  802808:	41 5d                	pop    %r13
+  80280a:	41 5e                	pop    %r14
+  80280c:	5d                   	pop    %rbp
+  80280d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80280e:	48 98                	cltq
+  802810:	eb ef                	jmp    802801 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802812:	48 98                	cltq
+  802814:	eb eb                	jmp    802801 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802816:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  80281d:	00 00 00 
+  802820:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802826:	89 da                	mov    %ebx,%edx
+  802828:	48 bf 91 55 80 00 00 	movabs $0x805591,%rdi
+  80282f:	00 00 00 
+  802832:	b8 00 00 00 00       	mov    $0x0,%eax
+  802837:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  80283e:	00 00 00 
+  802841:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802843:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80284a:	eb b5                	jmp    802801 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80284c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802853:	eb ac                	jmp    802801 <read+0x6a>
+
+0000000000802855 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  802855:	55                   	push   %rbp
+  802856:	48 89 e5             	mov    %rsp,%rbp
+  802859:	41 56                	push   %r14
+  80285b:	41 55                	push   %r13
+  80285d:	41 54                	push   %r12
+  80285f:	53                   	push   %rbx
+  802860:	48 83 ec 10          	sub    $0x10,%rsp
+  802864:	89 fb                	mov    %edi,%ebx
+  802866:	49 89 f4             	mov    %rsi,%r12
+  802869:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80286c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802870:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802877:	00 00 00 
+  80287a:	ff d0                	call   *%rax
+  80287c:	85 c0                	test   %eax,%eax
+  80287e:	78 41                	js     8028c1 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802880:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802884:	41 8b 3e             	mov    (%r14),%edi
+  802887:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80288b:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	85 c0                	test   %eax,%eax
+  802899:	78 35                	js     8028d0 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80289b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80289f:	83 e0 03             	and    $0x3,%eax
+  8028a2:	83 f8 01             	cmp    $0x1,%eax
+  8028a5:	74 2d                	je     8028d4 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8028a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ab:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8028af:	48 85 c0             	test   %rax,%rax
+  8028b2:	74 56                	je     80290a <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8028b4:	4c 89 ea             	mov    %r13,%rdx
+  8028b7:	4c 89 e6             	mov    %r12,%rsi
+  8028ba:	4c 89 f7             	mov    %r14,%rdi
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	eb 02                	jmp    8028c3 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028c1:	48 98                	cltq
+}
+  8028c3:	48 83 c4 10          	add    $0x10,%rsp
+  8028c7:	5b                   	pop    %rbx
+  8028c8:	41 5c                	pop    %r12
+  8028ca:	41 5d                	pop    %r13
+  8028cc:	41 5e                	pop    %r14
+  8028ce:	5d                   	pop    %rbp
+  8028cf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028d0:	48 98                	cltq
+  8028d2:	eb ef                	jmp    8028c3 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8028d4:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  8028db:	00 00 00 
+  8028de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8028e4:	89 da                	mov    %ebx,%edx
+  8028e6:	48 bf 50 55 80 00 00 	movabs $0x805550,%rdi
+  8028ed:	00 00 00 
+  8028f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f5:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  8028fc:	00 00 00 
+  8028ff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802901:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802908:	eb b9                	jmp    8028c3 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  80290a:	4c 89 ea             	mov    %r13,%rdx
+  80290d:	4c 89 e6             	mov    %r12,%rsi
+  802910:	89 df                	mov    %ebx,%edi
+  802912:	48 b8 97 27 80 00 00 	movabs $0x802797,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+  80291e:	eb a3                	jmp    8028c3 <readmap+0x6e>
+
+0000000000802920 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802920:	55                   	push   %rbp
+  802921:	48 89 e5             	mov    %rsp,%rbp
+  802924:	41 57                	push   %r15
+  802926:	41 56                	push   %r14
+  802928:	41 55                	push   %r13
+  80292a:	41 54                	push   %r12
+  80292c:	53                   	push   %rbx
+  80292d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802931:	48 85 d2             	test   %rdx,%rdx
+  802934:	74 54                	je     80298a <readn+0x6a>
+  802936:	41 89 fd             	mov    %edi,%r13d
+  802939:	49 89 f6             	mov    %rsi,%r14
+  80293c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80293f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802949:	49 bf 97 27 80 00 00 	movabs $0x802797,%r15
+  802950:	00 00 00 
+  802953:	4c 89 e2             	mov    %r12,%rdx
+  802956:	48 29 f2             	sub    %rsi,%rdx
+  802959:	4c 01 f6             	add    %r14,%rsi
+  80295c:	44 89 ef             	mov    %r13d,%edi
+  80295f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 20                	js     802986 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802966:	01 c3                	add    %eax,%ebx
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	74 08                	je     802974 <readn+0x54>
+  80296c:	48 63 f3             	movslq %ebx,%rsi
+  80296f:	4c 39 e6             	cmp    %r12,%rsi
+  802972:	72 df                	jb     802953 <readn+0x33>
+    }
+    return res;
+  802974:	48 63 c3             	movslq %ebx,%rax
+}
+  802977:	48 83 c4 08          	add    $0x8,%rsp
+  80297b:	5b                   	pop    %rbx
+  80297c:	41 5c                	pop    %r12
+  80297e:	41 5d                	pop    %r13
+  802980:	41 5e                	pop    %r14
+  802982:	41 5f                	pop    %r15
+  802984:	5d                   	pop    %rbp
+  802985:	c3                   	ret
+        if (inc < 0) return inc;
+  802986:	48 98                	cltq
+  802988:	eb ed                	jmp    802977 <readn+0x57>
+    int inc = 1, res = 0;
+  80298a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80298f:	eb e3                	jmp    802974 <readn+0x54>
+
+0000000000802991 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802991:	55                   	push   %rbp
+  802992:	48 89 e5             	mov    %rsp,%rbp
+  802995:	41 56                	push   %r14
+  802997:	41 55                	push   %r13
+  802999:	41 54                	push   %r12
+  80299b:	53                   	push   %rbx
+  80299c:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a0:	89 fb                	mov    %edi,%ebx
+  8029a2:	49 89 f4             	mov    %rsi,%r12
+  8029a5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029ac:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	78 47                	js     802a03 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029bc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8029c0:	41 8b 3e             	mov    (%r14),%edi
+  8029c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029c7:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+  8029d3:	85 c0                	test   %eax,%eax
+  8029d5:	78 30                	js     802a07 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8029d7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8029dc:	74 2d                	je     802a0b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8029de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8029e6:	48 85 c0             	test   %rax,%rax
+  8029e9:	74 56                	je     802a41 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8029eb:	4c 89 ea             	mov    %r13,%rdx
+  8029ee:	4c 89 e6             	mov    %r12,%rsi
+  8029f1:	4c 89 f7             	mov    %r14,%rdi
+  8029f4:	ff d0                	call   *%rax
+}
+  8029f6:	48 83 c4 10          	add    $0x10,%rsp
+  8029fa:	5b                   	pop    %rbx
+  8029fb:	41 5c                	pop    %r12
+  8029fd:	41 5d                	pop    %r13
+  8029ff:	41 5e                	pop    %r14
+  802a01:	5d                   	pop    %rbp
+  802a02:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a03:	48 98                	cltq
+  802a05:	eb ef                	jmp    8029f6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a07:	48 98                	cltq
+  802a09:	eb eb                	jmp    8029f6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a0b:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  802a12:	00 00 00 
+  802a15:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a1b:	89 da                	mov    %ebx,%edx
+  802a1d:	48 bf ad 55 80 00 00 	movabs $0x8055ad,%rdi
+  802a24:	00 00 00 
+  802a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2c:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  802a33:	00 00 00 
+  802a36:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a38:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a3f:	eb b5                	jmp    8029f6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a41:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802a48:	eb ac                	jmp    8029f6 <write+0x65>
+
+0000000000802a4a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	53                   	push   %rbx
+  802a4f:	48 83 ec 18          	sub    $0x18,%rsp
+  802a53:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a59:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802a60:	00 00 00 
+  802a63:	ff d0                	call   *%rax
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	78 0c                	js     802a75 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a6d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802a70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+
+0000000000802a7b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+  802a7f:	41 55                	push   %r13
+  802a81:	41 54                	push   %r12
+  802a83:	53                   	push   %rbx
+  802a84:	48 83 ec 18          	sub    $0x18,%rsp
+  802a88:	89 fb                	mov    %edi,%ebx
+  802a8a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a8d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a91:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802a98:	00 00 00 
+  802a9b:	ff d0                	call   *%rax
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	78 38                	js     802ad9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802aa1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802aa5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802aa9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802aad:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802ab4:	00 00 00 
+  802ab7:	ff d0                	call   *%rax
+  802ab9:	85 c0                	test   %eax,%eax
+  802abb:	78 1c                	js     802ad9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802abd:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802ac2:	74 20                	je     802ae4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802ac4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ac8:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802acc:	48 85 c0             	test   %rax,%rax
+  802acf:	74 47                	je     802b18 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802ad1:	44 89 e6             	mov    %r12d,%esi
+  802ad4:	4c 89 ef             	mov    %r13,%rdi
+  802ad7:	ff d0                	call   *%rax
+}
+  802ad9:	48 83 c4 18          	add    $0x18,%rsp
+  802add:	5b                   	pop    %rbx
+  802ade:	41 5c                	pop    %r12
+  802ae0:	41 5d                	pop    %r13
+  802ae2:	5d                   	pop    %rbp
+  802ae3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802ae4:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  802aeb:	00 00 00 
+  802aee:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802af4:	89 da                	mov    %ebx,%edx
+  802af6:	48 bf 70 55 80 00 00 	movabs $0x805570,%rdi
+  802afd:	00 00 00 
+  802b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b05:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  802b0c:	00 00 00 
+  802b0f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b16:	eb c1                	jmp    802ad9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802b18:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b1d:	eb ba                	jmp    802ad9 <ftruncate+0x5e>
+
+0000000000802b1f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802b1f:	55                   	push   %rbp
+  802b20:	48 89 e5             	mov    %rsp,%rbp
+  802b23:	41 54                	push   %r12
+  802b25:	53                   	push   %rbx
+  802b26:	48 83 ec 10          	sub    $0x10,%rsp
+  802b2a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b2d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b31:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  802b38:	00 00 00 
+  802b3b:	ff d0                	call   *%rax
+  802b3d:	85 c0                	test   %eax,%eax
+  802b3f:	78 4e                	js     802b8f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b41:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802b45:	41 8b 3c 24          	mov    (%r12),%edi
+  802b49:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b4d:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	78 32                	js     802b8f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b61:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802b66:	74 30                	je     802b98 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802b68:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802b6b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802b72:	00 00 00 
+    stat->st_isdir = 0;
+  802b75:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b7c:	00 00 00 
+    stat->st_dev = dev;
+  802b7f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802b86:	48 89 de             	mov    %rbx,%rsi
+  802b89:	4c 89 e7             	mov    %r12,%rdi
+  802b8c:	ff 50 30             	call   *0x30(%rax)
+}
+  802b8f:	48 83 c4 10          	add    $0x10,%rsp
+  802b93:	5b                   	pop    %rbx
+  802b94:	41 5c                	pop    %r12
+  802b96:	5d                   	pop    %rbp
+  802b97:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b98:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b9d:	eb f0                	jmp    802b8f <fstat+0x70>
+
+0000000000802b9f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802b9f:	55                   	push   %rbp
+  802ba0:	48 89 e5             	mov    %rsp,%rbp
+  802ba3:	41 54                	push   %r12
+  802ba5:	53                   	push   %rbx
+  802ba6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802ba9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bae:	48 b8 f6 38 80 00 00 	movabs $0x8038f6,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	78 25                	js     802be5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802bc0:	4c 89 e6             	mov    %r12,%rsi
+  802bc3:	89 c7                	mov    %eax,%edi
+  802bc5:	48 b8 1f 2b 80 00 00 	movabs $0x802b1f,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+  802bd1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802bd4:	89 df                	mov    %ebx,%edi
+  802bd6:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+
+    return res;
+  802be2:	44 89 e3             	mov    %r12d,%ebx
+}
+  802be5:	89 d8                	mov    %ebx,%eax
+  802be7:	5b                   	pop    %rbx
+  802be8:	41 5c                	pop    %r12
+  802bea:	5d                   	pop    %rbp
+  802beb:	c3                   	ret
+
+0000000000802bec <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802bec:	55                   	push   %rbp
+  802bed:	48 89 e5             	mov    %rsp,%rbp
+  802bf0:	41 54                	push   %r12
+  802bf2:	53                   	push   %rbx
+  802bf3:	48 83 ec 10          	sub    $0x10,%rsp
+  802bf7:	48 89 fb             	mov    %rdi,%rbx
+  802bfa:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802bfd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c01:	bf 66 00 00 00       	mov    $0x66,%edi
+  802c06:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802c0d:	00 00 00 
+  802c10:	ff d0                	call   *%rax
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	78 1f                	js     802c35 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c1a:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802c1e:	48 85 c0             	test   %rax,%rax
+  802c21:	74 1b                	je     802c3e <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802c23:	4c 89 e6             	mov    %r12,%rsi
+  802c26:	48 89 df             	mov    %rbx,%rdi
+  802c29:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c2b:	85 c0                	test   %eax,%eax
+  802c2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c32:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802c35:	48 83 c4 10          	add    $0x10,%rsp
+  802c39:	5b                   	pop    %rbx
+  802c3a:	41 5c                	pop    %r12
+  802c3c:	5d                   	pop    %rbp
+  802c3d:	c3                   	ret
+        return -E_NOT_SUPP;
+  802c3e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802c43:	eb f0                	jmp    802c35 <create_snapshot+0x49>
+
+0000000000802c45 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802c45:	55                   	push   %rbp
+  802c46:	48 89 e5             	mov    %rsp,%rbp
+  802c49:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802c4d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c51:	bf 66 00 00 00       	mov    $0x66,%edi
+  802c56:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+  802c62:	85 c0                	test   %eax,%eax
+  802c64:	78 1e                	js     802c84 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802c66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c6a:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802c6e:	48 85 d2             	test   %rdx,%rdx
+  802c71:	74 13                	je     802c86 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c78:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c81:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+        return -E_NOT_SUPP;
+  802c86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802c8b:	eb f7                	jmp    802c84 <print_snapshot_list+0x3f>
+
+0000000000802c8d <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802c8d:	55                   	push   %rbp
+  802c8e:	48 89 e5             	mov    %rsp,%rbp
+  802c91:	53                   	push   %rbx
+  802c92:	48 83 ec 18          	sub    $0x18,%rsp
+  802c96:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802c99:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c9d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802ca2:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802ca9:	00 00 00 
+  802cac:	ff d0                	call   *%rax
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	78 1c                	js     802cce <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802cb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb6:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802cba:	48 85 c0             	test   %rax,%rax
+  802cbd:	74 15                	je     802cd4 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802cbf:	48 89 df             	mov    %rbx,%rdi
+  802cc2:	ff d0                	call   *%rax
+    if (res < 0) {
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ccb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802cce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd2:	c9                   	leave
+  802cd3:	c3                   	ret
+        return -E_NOT_SUPP;
+  802cd4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802cd9:	eb f3                	jmp    802cce <accept_snapshot+0x41>
+
+0000000000802cdb <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802cdb:	55                   	push   %rbp
+  802cdc:	48 89 e5             	mov    %rsp,%rbp
+  802cdf:	53                   	push   %rbx
+  802ce0:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce4:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802ce7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ceb:	bf 66 00 00 00       	mov    $0x66,%edi
+  802cf0:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802cf7:	00 00 00 
+  802cfa:	ff d0                	call   *%rax
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	78 1c                	js     802d1c <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d04:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802d08:	48 85 c0             	test   %rax,%rax
+  802d0b:	74 15                	je     802d22 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802d0d:	48 89 df             	mov    %rbx,%rdi
+  802d10:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d12:	85 c0                	test   %eax,%eax
+  802d14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d19:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802d1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d20:	c9                   	leave
+  802d21:	c3                   	ret
+        return -E_NOT_SUPP;
+  802d22:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d27:	eb f3                	jmp    802d1c <delete_snapshot+0x41>
+
+0000000000802d29 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802d31:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d35:	bf 66 00 00 00       	mov    $0x66,%edi
+  802d3a:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	85 c0                	test   %eax,%eax
+  802d48:	78 14                	js     802d5e <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802d4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d4e:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802d52:	48 85 d2             	test   %rdx,%rdx
+  802d55:	74 09                	je     802d60 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5c:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802d5e:	c9                   	leave
+  802d5f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802d60:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d65:	eb f7                	jmp    802d5e <gc_snapshots+0x35>
+
+0000000000802d67 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802d67:	55                   	push   %rbp
+  802d68:	48 89 e5             	mov    %rsp,%rbp
+  802d6b:	41 56                	push   %r14
+  802d6d:	41 55                	push   %r13
+  802d6f:	41 54                	push   %r12
+  802d71:	53                   	push   %rbx
+  802d72:	48 83 ec 10          	sub    $0x10,%rsp
+  802d76:	48 89 fb             	mov    %rdi,%rbx
+  802d79:	49 89 f4             	mov    %rsi,%r12
+  802d7c:	49 89 d5             	mov    %rdx,%r13
+  802d7f:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802d82:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802d86:	bf 66 00 00 00       	mov    $0x66,%edi
+  802d8b:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	78 1b                	js     802db6 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802d9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d9f:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802da3:	48 85 c0             	test   %rax,%rax
+  802da6:	74 1b                	je     802dc3 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802da8:	4c 89 f1             	mov    %r14,%rcx
+  802dab:	4c 89 ea             	mov    %r13,%rdx
+  802dae:	4c 89 e6             	mov    %r12,%rsi
+  802db1:	48 89 df             	mov    %rbx,%rdi
+  802db4:	ff d0                	call   *%rax
+
+    return res;
+}
+  802db6:	48 83 c4 10          	add    $0x10,%rsp
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	41 5d                	pop    %r13
+  802dbf:	41 5e                	pop    %r14
+  802dc1:	5d                   	pop    %rbp
+  802dc2:	c3                   	ret
+        return -E_NOT_SUPP;
+  802dc3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802dc8:	eb ec                	jmp    802db6 <diff_snapshots+0x4f>
+
+0000000000802dca <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	41 55                	push   %r13
+  802dd0:	41 54                	push   %r12
+  802dd2:	53                   	push   %rbx
+  802dd3:	48 83 ec 18          	sub    $0x18,%rsp
+  802dd7:	48 89 fb             	mov    %rdi,%rbx
+  802dda:	49 89 f4             	mov    %rsi,%r12
+  802ddd:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802de0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802de4:	bf 66 00 00 00       	mov    $0x66,%edi
+  802de9:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802df0:	00 00 00 
+  802df3:	ff d0                	call   *%rax
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	78 18                	js     802e11 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802df9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dfd:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802e01:	48 85 c0             	test   %rax,%rax
+  802e04:	74 16                	je     802e1c <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802e06:	4c 89 ea             	mov    %r13,%rdx
+  802e09:	4c 89 e6             	mov    %r12,%rsi
+  802e0c:	48 89 df             	mov    %rbx,%rdi
+  802e0f:	ff d0                	call   *%rax
+
+    return res;
+}
+  802e11:	48 83 c4 18          	add    $0x18,%rsp
+  802e15:	5b                   	pop    %rbx
+  802e16:	41 5c                	pop    %r12
+  802e18:	41 5d                	pop    %r13
+  802e1a:	5d                   	pop    %rbp
+  802e1b:	c3                   	ret
+        return -E_NOT_SUPP;
+  802e1c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e21:	eb ee                	jmp    802e11 <send_snapshot+0x47>
+
+0000000000802e23 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802e23:	55                   	push   %rbp
+  802e24:	48 89 e5             	mov    %rsp,%rbp
+  802e27:	53                   	push   %rbx
+  802e28:	48 83 ec 18          	sub    $0x18,%rsp
+  802e2c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e33:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e38:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+  802e44:	85 c0                	test   %eax,%eax
+  802e46:	78 12                	js     802e5a <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e4c:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802e50:	48 85 c0             	test   %rax,%rax
+  802e53:	74 0b                	je     802e60 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802e55:	48 89 df             	mov    %rbx,%rdi
+  802e58:	ff d0                	call   *%rax
+
+    return res;
+}
+  802e5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802e60:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e65:	eb f3                	jmp    802e5a <receive_snapshot+0x37>
+
+0000000000802e67 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802e67:	55                   	push   %rbp
+  802e68:	48 89 e5             	mov    %rsp,%rbp
+  802e6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e6f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e73:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e78:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802e7f:	00 00 00 
+  802e82:	ff d0                	call   *%rax
+  802e84:	85 c0                	test   %eax,%eax
+  802e86:	78 17                	js     802e9f <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e8c:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802e93:	48 85 d2             	test   %rdx,%rdx
+  802e96:	74 09                	je     802ea1 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9d:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802e9f:	c9                   	leave
+  802ea0:	c3                   	ret
+        return -E_NOT_SUPP;
+  802ea1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802ea6:	eb f7                	jmp    802e9f <free_space_bytes+0x38>
+
+0000000000802ea8 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802ea8:	55                   	push   %rbp
+  802ea9:	48 89 e5             	mov    %rsp,%rbp
+  802eac:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802eb0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eb4:	bf 66 00 00 00       	mov    $0x66,%edi
+  802eb9:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 17                	js     802ee0 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ecd:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802ed4:	48 85 d2             	test   %rdx,%rdx
+  802ed7:	74 09                	je     802ee2 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ede:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802ee0:	c9                   	leave
+  802ee1:	c3                   	ret
+        return -E_NOT_SUPP;
+  802ee2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802ee7:	eb f7                	jmp    802ee0 <busy_space_bytes+0x38>
+
+0000000000802ee9 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802ee9:	55                   	push   %rbp
+  802eea:	48 89 e5             	mov    %rsp,%rbp
+  802eed:	41 54                	push   %r12
+  802eef:	53                   	push   %rbx
+  802ef0:	48 83 ec 10          	sub    $0x10,%rsp
+  802ef4:	89 fb                	mov    %edi,%ebx
+  802ef6:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802ef9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802efd:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f02:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802f09:	00 00 00 
+  802f0c:	ff d0                	call   *%rax
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	78 17                	js     802f29 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802f12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f16:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802f1d:	48 85 c0             	test   %rax,%rax
+  802f20:	74 10                	je     802f32 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802f22:	4c 89 e6             	mov    %r12,%rsi
+  802f25:	89 df                	mov    %ebx,%edi
+  802f27:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802f29:	48 83 c4 10          	add    $0x10,%rsp
+  802f2d:	5b                   	pop    %rbx
+  802f2e:	41 5c                	pop    %r12
+  802f30:	5d                   	pop    %rbp
+  802f31:	c3                   	ret
+        return -E_NOT_SUPP;
+  802f32:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f37:	eb f0                	jmp    802f29 <snapshots_space+0x40>
+
+0000000000802f39 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802f39:	55                   	push   %rbp
+  802f3a:	48 89 e5             	mov    %rsp,%rbp
+  802f3d:	41 55                	push   %r13
+  802f3f:	41 54                	push   %r12
+  802f41:	53                   	push   %rbx
+  802f42:	48 83 ec 08          	sub    $0x8,%rsp
+  802f46:	41 89 fd             	mov    %edi,%r13d
+  802f49:	48 89 f3             	mov    %rsi,%rbx
+  802f4c:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f4f:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802f56:	00 00 00 
+  802f59:	83 38 00             	cmpl   $0x0,(%rax)
+  802f5c:	74 57                	je     802fb5 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802f5e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f64:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f69:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802f70:	00 00 00 
+  802f73:	44 89 ee             	mov    %r13d,%esi
+  802f76:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802f7d:	00 00 00 
+  802f80:	8b 38                	mov    (%rax),%edi
+  802f82:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802f8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f93:	4c 89 e2             	mov    %r12,%rdx
+  802f96:	48 89 de             	mov    %rbx,%rsi
+  802f99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9e:	48 b8 e7 4c 80 00 00 	movabs $0x804ce7,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+}
+  802faa:	48 83 c4 08          	add    $0x8,%rsp
+  802fae:	5b                   	pop    %rbx
+  802faf:	41 5c                	pop    %r12
+  802fb1:	41 5d                	pop    %r13
+  802fb3:	5d                   	pop    %rbp
+  802fb4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802fb5:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fba:	48 b8 bd 4d 80 00 00 	movabs $0x804dbd,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+  802fc6:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  802fcd:	00 00 
+  802fcf:	eb 8d                	jmp    802f5e <fsipc_region+0x25>
+
+0000000000802fd1 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802fd1:	55                   	push   %rbp
+  802fd2:	48 89 e5             	mov    %rsp,%rbp
+  802fd5:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802fd9:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802fe0:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802fe1:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802fe5:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  802fec:	00 00 00 
+  802fef:	ff d0                	call   *%rax
+}
+  802ff1:	c9                   	leave
+  802ff2:	c3                   	ret
+
+0000000000802ff3 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802ff3:	85 ff                	test   %edi,%edi
+  802ff5:	78 6d                	js     803064 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802ff7:	55                   	push   %rbp
+  802ff8:	48 89 e5             	mov    %rsp,%rbp
+  802ffb:	41 54                	push   %r12
+  802ffd:	53                   	push   %rbx
+  802ffe:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  803001:	48 85 f6             	test   %rsi,%rsi
+  803004:	74 57                	je     80305d <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  803006:	89 f8                	mov    %edi,%eax
+  803008:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80300f:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  803011:	be 00 00 00 00       	mov    $0x0,%esi
+  803016:	bf 12 00 00 00       	mov    $0x12,%edi
+  80301b:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803027:	85 c0                	test   %eax,%eax
+  803029:	78 2d                	js     803058 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80302b:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  803032:	00 00 00 
+  803035:	49 63 14 24          	movslq (%r12),%rdx
+  803039:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  803040:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803045:	48 89 df             	mov    %rbx,%rdi
+  803048:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  803054:	41 8b 04 24          	mov    (%r12),%eax
+}
+  803058:	5b                   	pop    %rbx
+  803059:	41 5c                	pop    %r12
+  80305b:	5d                   	pop    %rbp
+  80305c:	c3                   	ret
+        return -E_INVAL;
+  80305d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803062:	eb f4                	jmp    803058 <devfile_df_snapshots+0x65>
+  803064:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803069:	c3                   	ret
+
+000000000080306a <devfile_df_busy>:
+devfile_df_busy() {
+  80306a:	55                   	push   %rbp
+  80306b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80306e:	be 00 00 00 00       	mov    $0x0,%esi
+  803073:	bf 11 00 00 00       	mov    $0x11,%edi
+  803078:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80307f:	00 00 00 
+  803082:	ff d0                	call   *%rax
+}
+  803084:	5d                   	pop    %rbp
+  803085:	c3                   	ret
+
+0000000000803086 <devfile_df_free>:
+devfile_df_free() {
+  803086:	55                   	push   %rbp
+  803087:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80308a:	be 00 00 00 00       	mov    $0x0,%esi
+  80308f:	bf 10 00 00 00       	mov    $0x10,%edi
+  803094:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+}
+  8030a0:	5d                   	pop    %rbp
+  8030a1:	c3                   	ret
+
+00000000008030a2 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8030a2:	55                   	push   %rbp
+  8030a3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8030a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ab:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8030b0:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8030b7:	00 00 00 
+  8030ba:	ff d0                	call   *%rax
+}
+  8030bc:	5d                   	pop    %rbp
+  8030bd:	c3                   	ret
+
+00000000008030be <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8030be:	55                   	push   %rbp
+  8030bf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8030c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8030cc:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8030d3:	00 00 00 
+  8030d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030d8:	85 c0                	test   %eax,%eax
+  8030da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030df:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8030e2:	5d                   	pop    %rbp
+  8030e3:	c3                   	ret
+
+00000000008030e4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8030e4:	55                   	push   %rbp
+  8030e5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8030e8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8030ef:	00 00 00 
+  8030f2:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8030f5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030f7:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8030fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ff:	bf 02 00 00 00       	mov    $0x2,%edi
+  803104:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+}
+  803110:	5d                   	pop    %rbp
+  803111:	c3                   	ret
+
+0000000000803112 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803112:	55                   	push   %rbp
+  803113:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803116:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803119:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  803120:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803122:	be 00 00 00 00       	mov    $0x0,%esi
+  803127:	bf 06 00 00 00       	mov    $0x6,%edi
+  80312c:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+}
+  803138:	5d                   	pop    %rbp
+  803139:	c3                   	ret
+
+000000000080313a <devfile_write>:
+    if (!fd || !buf) {
+  80313a:	48 85 ff             	test   %rdi,%rdi
+  80313d:	0f 84 c1 00 00 00    	je     803204 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803143:	55                   	push   %rbp
+  803144:	48 89 e5             	mov    %rsp,%rbp
+  803147:	41 57                	push   %r15
+  803149:	41 56                	push   %r14
+  80314b:	41 55                	push   %r13
+  80314d:	41 54                	push   %r12
+  80314f:	53                   	push   %rbx
+  803150:	48 83 ec 18          	sub    $0x18,%rsp
+  803154:	49 89 ff             	mov    %rdi,%r15
+  803157:	49 89 f5             	mov    %rsi,%r13
+  80315a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80315d:	48 85 f6             	test   %rsi,%rsi
+  803160:	0f 84 95 00 00 00    	je     8031fb <devfile_write+0xc1>
+    while (n) {
+  803166:	48 85 d2             	test   %rdx,%rdx
+  803169:	0f 84 83 00 00 00    	je     8031f2 <devfile_write+0xb8>
+    int totalWrite = 0;
+  80316f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803176:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80317d:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803180:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803185:	49 39 dc             	cmp    %rbx,%r12
+  803188:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80318c:	48 89 da             	mov    %rbx,%rdx
+  80318f:	4c 89 ee             	mov    %r13,%rsi
+  803192:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  803199:	00 00 00 
+  80319c:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  8031a3:	00 00 00 
+  8031a6:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8031a8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031ac:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8031af:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8031b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8031bd:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8031c4:	00 00 00 
+  8031c7:	ff d0                	call   *%rax
+        if (write < 0) {
+  8031c9:	85 c0                	test   %eax,%eax
+  8031cb:	78 21                	js     8031ee <devfile_write+0xb4>
+        buf += write;
+  8031cd:	48 63 d0             	movslq %eax,%rdx
+  8031d0:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8031d3:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8031d6:	49 29 d4             	sub    %rdx,%r12
+  8031d9:	75 a5                	jne    803180 <devfile_write+0x46>
+    return totalWrite;
+  8031db:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8031df:	48 83 c4 18          	add    $0x18,%rsp
+  8031e3:	5b                   	pop    %rbx
+  8031e4:	41 5c                	pop    %r12
+  8031e6:	41 5d                	pop    %r13
+  8031e8:	41 5e                	pop    %r14
+  8031ea:	41 5f                	pop    %r15
+  8031ec:	5d                   	pop    %rbp
+  8031ed:	c3                   	ret
+            return write;
+  8031ee:	48 98                	cltq
+  8031f0:	eb ed                	jmp    8031df <devfile_write+0xa5>
+    int totalWrite = 0;
+  8031f2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8031f9:	eb e0                	jmp    8031db <devfile_write+0xa1>
+        return -E_INVAL;
+  8031fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803202:	eb db                	jmp    8031df <devfile_write+0xa5>
+  803204:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80320b:	c3                   	ret
+
+000000000080320c <devfile_read>:
+    if (!fd || !buf) {
+  80320c:	48 85 ff             	test   %rdi,%rdi
+  80320f:	0f 84 c0 00 00 00    	je     8032d5 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803215:	55                   	push   %rbp
+  803216:	48 89 e5             	mov    %rsp,%rbp
+  803219:	41 57                	push   %r15
+  80321b:	41 56                	push   %r14
+  80321d:	41 55                	push   %r13
+  80321f:	41 54                	push   %r12
+  803221:	53                   	push   %rbx
+  803222:	48 83 ec 18          	sub    $0x18,%rsp
+  803226:	49 89 ff             	mov    %rdi,%r15
+  803229:	49 89 f5             	mov    %rsi,%r13
+  80322c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80322f:	48 85 f6             	test   %rsi,%rsi
+  803232:	0f 84 96 00 00 00    	je     8032ce <devfile_read+0xc2>
+    while (n) {
+  803238:	48 85 d2             	test   %rdx,%rdx
+  80323b:	0f 84 87 00 00 00    	je     8032c8 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  803241:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803248:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803249:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  803250:	00 00 00 
+  803253:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803257:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80325a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80325f:	49 39 c4             	cmp    %rax,%r12
+  803262:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  803266:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80326a:	be 00 00 00 00       	mov    $0x0,%esi
+  80326f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803274:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+        if (read <= 0) {
+  803280:	85 c0                	test   %eax,%eax
+  803282:	7e 37                	jle    8032bb <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  803284:	48 63 d8             	movslq %eax,%rbx
+  803287:	48 89 da             	mov    %rbx,%rdx
+  80328a:	4c 89 f6             	mov    %r14,%rsi
+  80328d:	4c 89 ef             	mov    %r13,%rdi
+  803290:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  803297:	00 00 00 
+  80329a:	ff d0                	call   *%rax
+        buf += read;
+  80329c:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80329f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8032a3:	49 29 dc             	sub    %rbx,%r12
+  8032a6:	75 ab                	jne    803253 <devfile_read+0x47>
+  return totalRead;
+  8032a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8032ac:	48 83 c4 18          	add    $0x18,%rsp
+  8032b0:	5b                   	pop    %rbx
+  8032b1:	41 5c                	pop    %r12
+  8032b3:	41 5d                	pop    %r13
+  8032b5:	41 5e                	pop    %r14
+  8032b7:	41 5f                	pop    %r15
+  8032b9:	5d                   	pop    %rbp
+  8032ba:	c3                   	ret
+            return read ? read : totalRead;
+  8032bb:	48 63 d0             	movslq %eax,%rdx
+  8032be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032c2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8032c6:	eb e4                	jmp    8032ac <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8032c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8032cc:	eb da                	jmp    8032a8 <devfile_read+0x9c>
+        return E_INVAL;
+  8032ce:	b8 03 00 00 00       	mov    $0x3,%eax
+  8032d3:	eb d7                	jmp    8032ac <devfile_read+0xa0>
+  8032d5:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8032da:	c3                   	ret
+
+00000000008032db <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8032db:	48 85 ff             	test   %rdi,%rdi
+  8032de:	74 5f                	je     80333f <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8032e0:	55                   	push   %rbp
+  8032e1:	48 89 e5             	mov    %rsp,%rbp
+  8032e4:	53                   	push   %rbx
+  8032e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8032e9:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8032ec:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032fe:	77 45                	ja     803345 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  803300:	48 89 de             	mov    %rbx,%rsi
+  803303:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  80330a:	00 00 00 
+  80330d:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  803314:	00 00 00 
+  803317:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  803319:	be 00 00 00 00       	mov    $0x0,%esi
+  80331e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803323:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80332a:	00 00 00 
+  80332d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80332f:	85 c0                	test   %eax,%eax
+  803331:	ba 00 00 00 00       	mov    $0x0,%edx
+  803336:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80333d:	c9                   	leave
+  80333e:	c3                   	ret
+        return -E_INVAL;
+  80333f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803344:	c3                   	ret
+        return -E_INVAL;
+  803345:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80334a:	eb ed                	jmp    803339 <devfile_receive_snapshot+0x5e>
+
+000000000080334c <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80334c:	55                   	push   %rbp
+  80334d:	48 89 e5             	mov    %rsp,%rbp
+  803350:	41 55                	push   %r13
+  803352:	41 54                	push   %r12
+  803354:	53                   	push   %rbx
+  803355:	48 83 ec 08          	sub    $0x8,%rsp
+  803359:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80335c:	48 85 f6             	test   %rsi,%rsi
+  80335f:	0f 94 c0             	sete   %al
+  803362:	48 85 d2             	test   %rdx,%rdx
+  803365:	0f 94 c2             	sete   %dl
+  803368:	08 d0                	or     %dl,%al
+  80336a:	0f 85 ad 00 00 00    	jne    80341d <devfile_send_snapshot+0xd1>
+  803370:	48 89 fb             	mov    %rdi,%rbx
+  803373:	49 89 f4             	mov    %rsi,%r12
+  803376:	48 85 ff             	test   %rdi,%rdi
+  803379:	0f 84 9e 00 00 00    	je     80341d <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80337f:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  803386:	00 00 00 
+  803389:	ff d0                	call   *%rax
+  80338b:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  803391:	0f 87 8d 00 00 00    	ja     803424 <devfile_send_snapshot+0xd8>
+  803397:	4c 89 e7             	mov    %r12,%rdi
+  80339a:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+  8033a6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8033ac:	77 7d                	ja     80342b <devfile_send_snapshot+0xdf>
+  8033ae:	4c 89 ef             	mov    %r13,%rdi
+  8033b1:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8033b8:	00 00 00 
+  8033bb:	ff d0                	call   *%rax
+  8033bd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033c3:	77 6d                	ja     803432 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8033c5:	48 89 de             	mov    %rbx,%rsi
+  8033c8:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8033cf:	00 00 00 
+  8033d2:	48 bb f7 15 80 00 00 	movabs $0x8015f7,%rbx
+  8033d9:	00 00 00 
+  8033dc:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8033de:	4c 89 e6             	mov    %r12,%rsi
+  8033e1:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  8033e8:	00 00 00 
+  8033eb:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8033ed:	4c 89 ee             	mov    %r13,%rsi
+  8033f0:	48 bf 00 82 80 00 00 	movabs $0x808200,%rdi
+  8033f7:	00 00 00 
+  8033fa:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8033fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803401:	bf 0e 00 00 00       	mov    $0xe,%edi
+  803406:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+}
+  803412:	48 83 c4 08          	add    $0x8,%rsp
+  803416:	5b                   	pop    %rbx
+  803417:	41 5c                	pop    %r12
+  803419:	41 5d                	pop    %r13
+  80341b:	5d                   	pop    %rbp
+  80341c:	c3                   	ret
+        return -E_INVAL;
+  80341d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803422:	eb ee                	jmp    803412 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  803424:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803429:	eb e7                	jmp    803412 <devfile_send_snapshot+0xc6>
+  80342b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803430:	eb e0                	jmp    803412 <devfile_send_snapshot+0xc6>
+  803432:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803437:	eb d9                	jmp    803412 <devfile_send_snapshot+0xc6>
+
+0000000000803439 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  803439:	48 85 ff             	test   %rdi,%rdi
+  80343c:	0f 84 41 01 00 00    	je     803583 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  803442:	55                   	push   %rbp
+  803443:	48 89 e5             	mov    %rsp,%rbp
+  803446:	41 57                	push   %r15
+  803448:	41 56                	push   %r14
+  80344a:	41 55                	push   %r13
+  80344c:	41 54                	push   %r12
+  80344e:	53                   	push   %rbx
+  80344f:	48 83 ec 08          	sub    $0x8,%rsp
+  803453:	49 89 fc             	mov    %rdi,%r12
+  803456:	49 89 f5             	mov    %rsi,%r13
+  803459:	48 89 d3             	mov    %rdx,%rbx
+  80345c:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80345f:	48 85 f6             	test   %rsi,%rsi
+  803462:	0f 84 ff 00 00 00    	je     803567 <devfile_diff_snapshots+0x12e>
+  803468:	48 85 d2             	test   %rdx,%rdx
+  80346b:	0f 84 fd 00 00 00    	je     80356e <devfile_diff_snapshots+0x135>
+  803471:	48 85 c9             	test   %rcx,%rcx
+  803474:	0f 84 f4 00 00 00    	je     80356e <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80347a:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  803481:	00 00 00 
+  803484:	ff d0                	call   *%rax
+  803486:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80348c:	0f 87 e3 00 00 00    	ja     803575 <devfile_diff_snapshots+0x13c>
+  803492:	4c 89 ef             	mov    %r13,%rdi
+  803495:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  80349c:	00 00 00 
+  80349f:	ff d0                	call   *%rax
+  8034a1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8034a7:	0f 87 cf 00 00 00    	ja     80357c <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8034ad:	4c 89 e6             	mov    %r12,%rsi
+  8034b0:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  8034b7:	00 00 00 
+  8034ba:	4c 89 e7             	mov    %r12,%rdi
+  8034bd:	49 bf f7 15 80 00 00 	movabs $0x8015f7,%r15
+  8034c4:	00 00 00 
+  8034c7:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8034ca:	4c 89 ee             	mov    %r13,%rsi
+  8034cd:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8034d4:	00 
+  8034d5:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8034d8:	48 8b 03             	mov    (%rbx),%rax
+  8034db:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8034e2:	00 
+  8034e3:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8034e7:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8034ee:	00 
+  8034ef:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8034f3:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8034fa:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8034fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803500:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803505:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803511:	85 c0                	test   %eax,%eax
+  803513:	78 43                	js     803558 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  803515:	49 8b 04 24          	mov    (%r12),%rax
+  803519:	48 89 03             	mov    %rax,(%rbx)
+  80351c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  803521:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  803525:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80352a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80352e:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  803533:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803537:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80353b:	48 c1 e2 03          	shl    $0x3,%rdx
+  80353f:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  803544:	4c 89 f7             	mov    %r14,%rdi
+  803547:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  803553:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  803558:	48 83 c4 08          	add    $0x8,%rsp
+  80355c:	5b                   	pop    %rbx
+  80355d:	41 5c                	pop    %r12
+  80355f:	41 5d                	pop    %r13
+  803561:	41 5e                	pop    %r14
+  803563:	41 5f                	pop    %r15
+  803565:	5d                   	pop    %rbp
+  803566:	c3                   	ret
+        return -E_INVAL;
+  803567:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80356c:	eb ea                	jmp    803558 <devfile_diff_snapshots+0x11f>
+  80356e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803573:	eb e3                	jmp    803558 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  803575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80357a:	eb dc                	jmp    803558 <devfile_diff_snapshots+0x11f>
+  80357c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803581:	eb d5                	jmp    803558 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  803583:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803588:	c3                   	ret
+
+0000000000803589 <devfile_delete_snapshot>:
+    if (!name) {
+  803589:	48 85 ff             	test   %rdi,%rdi
+  80358c:	74 5f                	je     8035ed <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80358e:	55                   	push   %rbp
+  80358f:	48 89 e5             	mov    %rsp,%rbp
+  803592:	53                   	push   %rbx
+  803593:	48 83 ec 08          	sub    $0x8,%rsp
+  803597:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80359a:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8035a1:	00 00 00 
+  8035a4:	ff d0                	call   *%rax
+  8035a6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8035ac:	77 45                	ja     8035f3 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8035ae:	48 89 de             	mov    %rbx,%rsi
+  8035b1:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8035b8:	00 00 00 
+  8035bb:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8035c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8035cc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035d1:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8035d8:	00 00 00 
+  8035db:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035dd:	85 c0                	test   %eax,%eax
+  8035df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8035e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035eb:	c9                   	leave
+  8035ec:	c3                   	ret
+        return -E_INVAL;
+  8035ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8035f2:	c3                   	ret
+        return -E_INVAL;
+  8035f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f8:	eb ed                	jmp    8035e7 <devfile_delete_snapshot+0x5e>
+
+00000000008035fa <devfile_accept_snapshot>:
+    if (!name) {
+  8035fa:	48 85 ff             	test   %rdi,%rdi
+  8035fd:	74 5f                	je     80365e <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8035ff:	55                   	push   %rbp
+  803600:	48 89 e5             	mov    %rsp,%rbp
+  803603:	53                   	push   %rbx
+  803604:	48 83 ec 08          	sub    $0x8,%rsp
+  803608:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80360b:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+  803617:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80361d:	77 45                	ja     803664 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80361f:	48 89 de             	mov    %rbx,%rsi
+  803622:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803629:	00 00 00 
+  80362c:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  803633:	00 00 00 
+  803636:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  803638:	be 00 00 00 00       	mov    $0x0,%esi
+  80363d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803642:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803649:	00 00 00 
+  80364c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80364e:	85 c0                	test   %eax,%eax
+  803650:	ba 00 00 00 00       	mov    $0x0,%edx
+  803655:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803658:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80365c:	c9                   	leave
+  80365d:	c3                   	ret
+        return -E_INVAL;
+  80365e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803663:	c3                   	ret
+        return -E_INVAL;
+  803664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803669:	eb ed                	jmp    803658 <devfile_accept_snapshot+0x5e>
+
+000000000080366b <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80366b:	48 85 ff             	test   %rdi,%rdi
+  80366e:	0f 84 9f 00 00 00    	je     803713 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  803674:	55                   	push   %rbp
+  803675:	48 89 e5             	mov    %rsp,%rbp
+  803678:	41 54                	push   %r12
+  80367a:	53                   	push   %rbx
+  80367b:	48 89 fb             	mov    %rdi,%rbx
+  80367e:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  803681:	48 85 f6             	test   %rsi,%rsi
+  803684:	74 78                	je     8036fe <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  803686:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  80368d:	00 00 00 
+  803690:	ff d0                	call   *%rax
+  803692:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803698:	77 6b                	ja     803705 <devfile_create_snapshot+0x9a>
+  80369a:	4c 89 e7             	mov    %r12,%rdi
+  80369d:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8036a4:	00 00 00 
+  8036a7:	ff d0                	call   *%rax
+  8036a9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8036af:	77 5b                	ja     80370c <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8036b1:	48 89 de             	mov    %rbx,%rsi
+  8036b4:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8036bb:	00 00 00 
+  8036be:	48 bb f7 15 80 00 00 	movabs $0x8015f7,%rbx
+  8036c5:	00 00 00 
+  8036c8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8036ca:	4c 89 e6             	mov    %r12,%rsi
+  8036cd:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  8036d4:	00 00 00 
+  8036d7:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8036d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8036de:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036e3:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036f6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8036f9:	5b                   	pop    %rbx
+  8036fa:	41 5c                	pop    %r12
+  8036fc:	5d                   	pop    %rbp
+  8036fd:	c3                   	ret
+        return -E_INVAL;
+  8036fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803703:	eb f4                	jmp    8036f9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  803705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80370a:	eb ed                	jmp    8036f9 <devfile_create_snapshot+0x8e>
+  80370c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803711:	eb e6                	jmp    8036f9 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  803713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803718:	c3                   	ret
+
+0000000000803719 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803719:	55                   	push   %rbp
+  80371a:	48 89 e5             	mov    %rsp,%rbp
+  80371d:	41 54                	push   %r12
+  80371f:	53                   	push   %rbx
+  803720:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803723:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803726:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80372d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80372f:	be 00 00 00 00       	mov    $0x0,%esi
+  803734:	bf 05 00 00 00       	mov    $0x5,%edi
+  803739:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803745:	85 c0                	test   %eax,%eax
+  803747:	78 3d                	js     803786 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803749:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  803750:	00 00 00 
+  803753:	4c 89 e6             	mov    %r12,%rsi
+  803756:	48 89 df             	mov    %rbx,%rdi
+  803759:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  803760:	00 00 00 
+  803763:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803765:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80376c:	00 
+  80376d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803773:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80377a:	00 
+  80377b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803781:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803786:	5b                   	pop    %rbx
+  803787:	41 5c                	pop    %r12
+  803789:	5d                   	pop    %rbp
+  80378a:	c3                   	ret
+
+000000000080378b <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  80378b:	55                   	push   %rbp
+  80378c:	48 89 e5             	mov    %rsp,%rbp
+  80378f:	41 57                	push   %r15
+  803791:	41 56                	push   %r14
+  803793:	41 55                	push   %r13
+  803795:	41 54                	push   %r12
+  803797:	53                   	push   %rbx
+  803798:	48 83 ec 38          	sub    $0x38,%rsp
+  80379c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8037a0:	49 89 f5             	mov    %rsi,%r13
+  8037a3:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8037a6:	48 89 f0             	mov    %rsi,%rax
+  8037a9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8037ae:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8037b2:	75 4f                	jne    803803 <devfile_readmap+0x78>
+  8037b4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8037b8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8037be:	75 1f                	jne    8037df <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8037c0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037c4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8037c8:	49 be e7 4a 80 00 00 	movabs $0x804ae7,%r14
+  8037cf:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8037d2:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8037d9:	0f 87 9d 00 00 00    	ja     80387c <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8037df:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037e3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8037e7:	4d 85 ff             	test   %r15,%r15
+  8037ea:	0f 85 cf 00 00 00    	jne    8038bf <devfile_readmap+0x134>
+  8037f0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8037f4:	48 83 c4 38          	add    $0x38,%rsp
+  8037f8:	5b                   	pop    %rbx
+  8037f9:	41 5c                	pop    %r12
+  8037fb:	41 5d                	pop    %r13
+  8037fd:	41 5e                	pop    %r14
+  8037ff:	41 5f                	pop    %r15
+  803801:	5d                   	pop    %rbp
+  803802:	c3                   	ret
+    size_t totalRead = 0;
+  803803:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80380a:	00 
+  80380b:	eb da                	jmp    8037e7 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80380d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803811:	8b 40 0c             	mov    0xc(%rax),%eax
+  803814:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  80381b:	00 00 00 
+  80381e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  803820:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803824:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  803828:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80382c:	4c 89 ee             	mov    %r13,%rsi
+  80382f:	bf 14 00 00 00       	mov    $0x14,%edi
+  803834:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  80383b:	00 00 00 
+  80383e:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  803840:	85 c0                	test   %eax,%eax
+  803842:	7e a3                	jle    8037e7 <devfile_readmap+0x5c>
+  803844:	48 98                	cltq
+  803846:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80384a:	72 9b                	jb     8037e7 <devfile_readmap+0x5c>
+        buf += read;
+  80384c:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  80384f:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  803852:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803856:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  80385d:	75 88                	jne    8037e7 <devfile_readmap+0x5c>
+  80385f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803863:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803869:	0f 85 78 ff ff ff    	jne    8037e7 <devfile_readmap+0x5c>
+  80386f:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  803876:	0f 86 6b ff ff ff    	jbe    8037e7 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  80387c:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  803882:	4d 39 e7             	cmp    %r12,%r15
+  803885:	4d 0f 46 e7          	cmovbe %r15,%r12
+  803889:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  803890:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  803894:	0f 84 73 ff ff ff    	je     80380d <devfile_readmap+0x82>
+  80389a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  80389e:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8038a3:	41 ff d6             	call   *%r14
+  8038a6:	a8 40                	test   $0x40,%al
+  8038a8:	0f 85 39 ff ff ff    	jne    8037e7 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8038ae:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8038b5:	4c 39 e3             	cmp    %r12,%rbx
+  8038b8:	72 e4                	jb     80389e <devfile_readmap+0x113>
+  8038ba:	e9 4e ff ff ff       	jmp    80380d <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8038bf:	4c 89 fa             	mov    %r15,%rdx
+  8038c2:	4c 89 ee             	mov    %r13,%rsi
+  8038c5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8038c9:	48 b8 0c 32 80 00 00 	movabs $0x80320c,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8038d5:	48 85 c0             	test   %rax,%rax
+  8038d8:	78 0c                	js     8038e6 <devfile_readmap+0x15b>
+    return totalRead + read;
+  8038da:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8038de:	48 01 f0             	add    %rsi,%rax
+  8038e1:	e9 0e ff ff ff       	jmp    8037f4 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  8038e6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8038ea:	48 85 f6             	test   %rsi,%rsi
+  8038ed:	48 0f 45 c6          	cmovne %rsi,%rax
+  8038f1:	e9 fe fe ff ff       	jmp    8037f4 <devfile_readmap+0x69>
+
+00000000008038f6 <open>:
+open(const char *path, int mode) {
+  8038f6:	55                   	push   %rbp
+  8038f7:	48 89 e5             	mov    %rsp,%rbp
+  8038fa:	41 55                	push   %r13
+  8038fc:	41 54                	push   %r12
+  8038fe:	53                   	push   %rbx
+  8038ff:	48 83 ec 18          	sub    $0x18,%rsp
+  803903:	49 89 fc             	mov    %rdi,%r12
+  803906:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803909:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  803910:	00 00 00 
+  803913:	ff d0                	call   *%rax
+  803915:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80391b:	0f 87 8a 00 00 00    	ja     8039ab <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803921:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803925:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+  803931:	89 c3                	mov    %eax,%ebx
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 50                	js     803987 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803937:	4c 89 e6             	mov    %r12,%rsi
+  80393a:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  803941:	00 00 00 
+  803944:	48 89 df             	mov    %rbx,%rdi
+  803947:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  80394e:	00 00 00 
+  803951:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803953:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80395a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80395e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803963:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+  80396f:	89 c3                	mov    %eax,%ebx
+  803971:	85 c0                	test   %eax,%eax
+  803973:	78 1f                	js     803994 <open+0x9e>
+    return fd2num(fd);
+  803975:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803979:	48 b8 26 24 80 00 00 	movabs $0x802426,%rax
+  803980:	00 00 00 
+  803983:	ff d0                	call   *%rax
+  803985:	89 c3                	mov    %eax,%ebx
+}
+  803987:	89 d8                	mov    %ebx,%eax
+  803989:	48 83 c4 18          	add    $0x18,%rsp
+  80398d:	5b                   	pop    %rbx
+  80398e:	41 5c                	pop    %r12
+  803990:	41 5d                	pop    %r13
+  803992:	5d                   	pop    %rbp
+  803993:	c3                   	ret
+        fd_close(fd, 0);
+  803994:	be 00 00 00 00       	mov    $0x0,%esi
+  803999:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80399d:	48 b8 6f 25 80 00 00 	movabs $0x80256f,%rax
+  8039a4:	00 00 00 
+  8039a7:	ff d0                	call   *%rax
+        return res;
+  8039a9:	eb dc                	jmp    803987 <open+0x91>
+        return -E_BAD_PATH;
+  8039ab:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8039b0:	eb d5                	jmp    803987 <open+0x91>
+
+00000000008039b2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8039b2:	55                   	push   %rbp
+  8039b3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8039b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8039bb:	bf 13 00 00 00       	mov    $0x13,%edi
+  8039c0:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8039c7:	00 00 00 
+  8039ca:	ff d0                	call   *%rax
+}
+  8039cc:	5d                   	pop    %rbp
+  8039cd:	c3                   	ret
+
+00000000008039ce <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8039ce:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8039d2:	7f 01                	jg     8039d5 <writebuf+0x7>
+  8039d4:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8039d5:	55                   	push   %rbp
+  8039d6:	48 89 e5             	mov    %rsp,%rbp
+  8039d9:	53                   	push   %rbx
+  8039da:	48 83 ec 08          	sub    $0x8,%rsp
+  8039de:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8039e1:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8039e5:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8039e9:	8b 3f                	mov    (%rdi),%edi
+  8039eb:	48 b8 91 29 80 00 00 	movabs $0x802991,%rax
+  8039f2:	00 00 00 
+  8039f5:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8039f7:	48 85 c0             	test   %rax,%rax
+  8039fa:	7e 04                	jle    803a00 <writebuf+0x32>
+  8039fc:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803a00:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803a04:	48 39 c2             	cmp    %rax,%rdx
+  803a07:	74 0f                	je     803a18 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803a09:	48 85 c0             	test   %rax,%rax
+  803a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a11:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803a15:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803a18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a1c:	c9                   	leave
+  803a1d:	c3                   	ret
+
+0000000000803a1e <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803a1e:	8b 46 04             	mov    0x4(%rsi),%eax
+  803a21:	8d 50 01             	lea    0x1(%rax),%edx
+  803a24:	89 56 04             	mov    %edx,0x4(%rsi)
+  803a27:	48 98                	cltq
+  803a29:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803a2e:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803a34:	74 01                	je     803a37 <putch+0x19>
+  803a36:	c3                   	ret
+putch(int ch, void *arg) {
+  803a37:	55                   	push   %rbp
+  803a38:	48 89 e5             	mov    %rsp,%rbp
+  803a3b:	53                   	push   %rbx
+  803a3c:	48 83 ec 08          	sub    $0x8,%rsp
+  803a40:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803a43:	48 89 f7             	mov    %rsi,%rdi
+  803a46:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  803a4d:	00 00 00 
+  803a50:	ff d0                	call   *%rax
+        state->offset = 0;
+  803a52:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803a59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a5d:	c9                   	leave
+  803a5e:	c3                   	ret
+
+0000000000803a5f <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803a5f:	55                   	push   %rbp
+  803a60:	48 89 e5             	mov    %rsp,%rbp
+  803a63:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803a6a:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803a6d:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803a73:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803a7a:	00 00 00 
+    state.result = 0;
+  803a7d:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803a84:	00 00 00 00 
+    state.error = 1;
+  803a88:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803a8f:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803a92:	48 89 f2             	mov    %rsi,%rdx
+  803a95:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803a9c:	48 bf 1e 3a 80 00 00 	movabs $0x803a1e,%rdi
+  803aa3:	00 00 00 
+  803aa6:	48 b8 22 0e 80 00 00 	movabs $0x800e22,%rax
+  803aad:	00 00 00 
+  803ab0:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803ab2:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803ab9:	7f 14                	jg     803acf <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803abb:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803ac2:	48 85 c0             	test   %rax,%rax
+  803ac5:	75 06                	jne    803acd <vfprintf+0x6e>
+  803ac7:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803acd:	c9                   	leave
+  803ace:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803acf:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ad6:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  803add:	00 00 00 
+  803ae0:	ff d0                	call   *%rax
+  803ae2:	eb d7                	jmp    803abb <vfprintf+0x5c>
+
+0000000000803ae4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ae4:	55                   	push   %rbp
+  803ae5:	48 89 e5             	mov    %rsp,%rbp
+  803ae8:	48 83 ec 50          	sub    $0x50,%rsp
+  803aec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803af0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803af4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803af8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803afc:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803b03:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b0b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b0f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803b13:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803b17:	48 b8 5f 3a 80 00 00 	movabs $0x803a5f,%rax
+  803b1e:	00 00 00 
+  803b21:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803b23:	c9                   	leave
+  803b24:	c3                   	ret
+
+0000000000803b25 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803b25:	55                   	push   %rbp
+  803b26:	48 89 e5             	mov    %rsp,%rbp
+  803b29:	48 83 ec 50          	sub    $0x50,%rsp
+  803b2d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803b31:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803b35:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803b39:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803b3d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803b41:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803b48:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b50:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803b58:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803b5c:	48 89 fe             	mov    %rdi,%rsi
+  803b5f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b64:	48 b8 5f 3a 80 00 00 	movabs $0x803a5f,%rax
+  803b6b:	00 00 00 
+  803b6e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803b70:	c9                   	leave
+  803b71:	c3                   	ret
+
+0000000000803b72 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803b72:	55                   	push   %rbp
+  803b73:	48 89 e5             	mov    %rsp,%rbp
+  803b76:	41 55                	push   %r13
+  803b78:	41 54                	push   %r12
+  803b7a:	53                   	push   %rbx
+  803b7b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b7f:	48 89 fb             	mov    %rdi,%rbx
+  803b82:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803b85:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803b88:	48 b8 e7 4a 80 00 00 	movabs $0x804ae7,%rax
+  803b8f:	00 00 00 
+  803b92:	ff d0                	call   *%rax
+  803b94:	41 89 c1             	mov    %eax,%r9d
+  803b97:	4d 89 e0             	mov    %r12,%r8
+  803b9a:	49 29 d8             	sub    %rbx,%r8
+  803b9d:	48 89 d9             	mov    %rbx,%rcx
+  803ba0:	44 89 ea             	mov    %r13d,%edx
+  803ba3:	48 89 de             	mov    %rbx,%rsi
+  803ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bab:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+}
+  803bb7:	48 83 c4 08          	add    $0x8,%rsp
+  803bbb:	5b                   	pop    %rbx
+  803bbc:	41 5c                	pop    %r12
+  803bbe:	41 5d                	pop    %r13
+  803bc0:	5d                   	pop    %rbp
+  803bc1:	c3                   	ret
+
+0000000000803bc2 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803bc2:	55                   	push   %rbp
+  803bc3:	48 89 e5             	mov    %rsp,%rbp
+  803bc6:	41 57                	push   %r15
+  803bc8:	41 56                	push   %r14
+  803bca:	41 55                	push   %r13
+  803bcc:	41 54                	push   %r12
+  803bce:	53                   	push   %rbx
+  803bcf:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803bd6:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  803bd9:	be 00 00 00 00       	mov    $0x0,%esi
+  803bde:	48 b8 f6 38 80 00 00 	movabs $0x8038f6,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+  803bea:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  803bf0:	85 c0                	test   %eax,%eax
+  803bf2:	0f 88 10 04 00 00    	js     804008 <spawn+0x446>
+  803bf8:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803bfa:	ba 00 02 00 00       	mov    $0x200,%edx
+  803bff:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803c06:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  803c0d:	00 00 00 
+  803c10:	ff d0                	call   *%rax
+  803c12:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803c14:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803c19:	0f 85 85 02 00 00    	jne    803ea4 <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803c1f:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803c26:	ff ff 00 
+  803c29:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803c30:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803c37:	01 01 00 
+  803c3a:	48 39 d0             	cmp    %rdx,%rax
+  803c3d:	0f 85 9d 02 00 00    	jne    803ee0 <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803c43:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803c4a:	00 3e 00 
+  803c4d:	0f 85 8d 02 00 00    	jne    803ee0 <spawn+0x31e>
+  803c53:	b8 08 00 00 00       	mov    $0x8,%eax
+  803c58:	cd 30                	int    $0x30
+  803c5a:	41 89 c6             	mov    %eax,%r14d
+  803c5d:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803c5f:	85 c0                	test   %eax,%eax
+  803c61:	0f 88 89 03 00 00    	js     803ff0 <spawn+0x42e>
+    envid_t child = res;
+  803c67:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803c6d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c72:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803c76:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  803c7a:	48 c1 e0 04          	shl    $0x4,%rax
+  803c7e:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803c85:	00 00 00 
+  803c88:	48 01 c6             	add    %rax,%rsi
+  803c8b:	48 8b 06             	mov    (%rsi),%rax
+  803c8e:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803c95:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803c9c:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803ca3:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803caa:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  803cb1:	48 29 c6             	sub    %rax,%rsi
+  803cb4:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  803cba:	89 c8                	mov    %ecx,%eax
+  803cbc:	c1 e8 03             	shr    $0x3,%eax
+  803cbf:	89 c1                	mov    %eax,%ecx
+  803cc1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803cc4:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803ccb:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803cd2:	49 8b 3f             	mov    (%r15),%rdi
+  803cd5:	48 85 ff             	test   %rdi,%rdi
+  803cd8:	0f 84 41 06 00 00    	je     80431f <spawn+0x75d>
+  803cde:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  803ce3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803ce9:	49 bc b9 15 80 00 00 	movabs $0x8015b9,%r12
+  803cf0:	00 00 00 
+  803cf3:	41 ff d4             	call   *%r12
+  803cf6:	4c 01 e8             	add    %r13,%rax
+  803cf9:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803cfd:	48 89 da             	mov    %rbx,%rdx
+  803d00:	48 83 c3 01          	add    $0x1,%rbx
+  803d04:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  803d09:	48 85 ff             	test   %rdi,%rdi
+  803d0c:	75 e5                	jne    803cf3 <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803d0e:	48 f7 d0             	not    %rax
+  803d11:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803d18:	4d 89 e5             	mov    %r12,%r13
+  803d1b:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  803d1f:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  803d26:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803d2d:	89 d0                	mov    %edx,%eax
+  803d2f:	83 c0 01             	add    $0x1,%eax
+  803d32:	48 98                	cltq
+  803d34:	48 c1 e0 03          	shl    $0x3,%rax
+  803d38:	49 29 c5             	sub    %rax,%r13
+  803d3b:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803d42:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  803d46:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803d4c:	0f 86 c3 05 00 00    	jbe    804315 <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803d52:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803d57:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803d5c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d61:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  803d68:	00 00 00 
+  803d6b:	ff d0                	call   *%rax
+  803d6d:	89 c3                	mov    %eax,%ebx
+  803d6f:	85 c0                	test   %eax,%eax
+  803d71:	0f 88 67 02 00 00    	js     803fde <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  803d77:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  803d7e:	85 d2                	test   %edx,%edx
+  803d80:	7e 54                	jle    803dd6 <spawn+0x214>
+  803d82:	4c 89 fb             	mov    %r15,%rbx
+  803d85:	48 63 c2             	movslq %edx,%rax
+  803d88:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803d8d:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803d94:	00 00 00 
+  803d97:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803d9e:	ff 
+  803d9f:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803da3:	48 8b 33             	mov    (%rbx),%rsi
+  803da6:	4c 89 e7             	mov    %r12,%rdi
+  803da9:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  803db0:	00 00 00 
+  803db3:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803db5:	48 8b 3b             	mov    (%rbx),%rdi
+  803db8:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  803dbf:	00 00 00 
+  803dc2:	ff d0                	call   *%rax
+  803dc4:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803dc9:	49 83 c5 08          	add    $0x8,%r13
+  803dcd:	48 83 c3 08          	add    $0x8,%rbx
+  803dd1:	4d 39 fd             	cmp    %r15,%r13
+  803dd4:	75 b7                	jne    803d8d <spawn+0x1cb>
+    argv_store[argc] = 0;
+  803dd6:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803ddd:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803de4:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803de5:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803dec:	0f 85 35 01 00 00    	jne    803f27 <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803df2:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803df9:	00 00 00 
+  803dfc:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803e03:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803e0a:	ff 
+  803e0b:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803e0f:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803e16:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803e1a:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803e21:	00 00 00 
+  803e24:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803e2b:	ff 
+  803e2c:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803e33:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803e39:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803e3f:	44 89 f2             	mov    %r14d,%edx
+  803e42:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e47:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4c:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803e58:	48 bb 99 1e 80 00 00 	movabs $0x801e99,%rbx
+  803e5f:	00 00 00 
+  803e62:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803e67:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e71:	ff d3                	call   *%rbx
+  803e73:	85 c0                	test   %eax,%eax
+  803e75:	78 eb                	js     803e62 <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803e77:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803e7e:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  803e85:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803e86:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803e8d:	00 
+  803e8e:	0f 84 7e 03 00 00    	je     804212 <spawn+0x650>
+  803e94:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803e9b:	00 00 00 00 
+  803e9f:	e9 c0 01 00 00       	jmp    804064 <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803ea4:	48 bf 00 56 80 00 00 	movabs $0x805600,%rdi
+  803eab:	00 00 00 
+  803eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb3:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  803eba:	00 00 00 
+  803ebd:	ff d2                	call   *%rdx
+        close(fd);
+  803ebf:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803ec5:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  803ecc:	00 00 00 
+  803ecf:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803ed1:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803ed8:	ff ff ff 
+  803edb:	e9 28 01 00 00       	jmp    804008 <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803ee0:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803ee5:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803eeb:	48 bf 01 57 80 00 00 	movabs $0x805701,%rdi
+  803ef2:	00 00 00 
+  803ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efa:	48 b9 d2 0c 80 00 00 	movabs $0x800cd2,%rcx
+  803f01:	00 00 00 
+  803f04:	ff d1                	call   *%rcx
+        close(fd);
+  803f06:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803f0c:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  803f13:	00 00 00 
+  803f16:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803f18:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803f1f:	ff ff ff 
+  803f22:	e9 e1 00 00 00       	jmp    804008 <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803f27:	48 b9 30 56 80 00 00 	movabs $0x805630,%rcx
+  803f2e:	00 00 00 
+  803f31:	48 ba c0 4e 80 00 00 	movabs $0x804ec0,%rdx
+  803f38:	00 00 00 
+  803f3b:	be f0 00 00 00       	mov    $0xf0,%esi
+  803f40:	48 bf 1b 57 80 00 00 	movabs $0x80571b,%rdi
+  803f47:	00 00 00 
+  803f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4f:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  803f56:	00 00 00 
+  803f59:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  803f5c:	89 c3                	mov    %eax,%ebx
+  803f5e:	89 c6                	mov    %eax,%esi
+  803f60:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  803f67:	00 00 00 
+  803f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6f:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  803f76:	00 00 00 
+  803f79:	ff d2                	call   *%rdx
+            return res;
+  803f7b:	eb 61                	jmp    803fde <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  803f7d:	89 c3                	mov    %eax,%ebx
+  803f7f:	89 c6                	mov    %eax,%esi
+  803f81:	48 bf 88 56 80 00 00 	movabs $0x805688,%rdi
+  803f88:	00 00 00 
+  803f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f90:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  803f97:	00 00 00 
+  803f9a:	ff d2                	call   *%rdx
+        return res;
+  803f9c:	eb 40                	jmp    803fde <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  803f9e:	89 c3                	mov    %eax,%ebx
+  803fa0:	89 c6                	mov    %eax,%esi
+  803fa2:	48 bf 27 57 80 00 00 	movabs $0x805727,%rdi
+  803fa9:	00 00 00 
+  803fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb1:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  803fb8:	00 00 00 
+  803fbb:	ff d2                	call   *%rdx
+        return res;
+  803fbd:	eb 1f                	jmp    803fde <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  803fbf:	89 c3                	mov    %eax,%ebx
+  803fc1:	89 c6                	mov    %eax,%esi
+  803fc3:	48 bf 44 57 80 00 00 	movabs $0x805744,%rdi
+  803fca:	00 00 00 
+  803fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd2:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  803fd9:	00 00 00 
+  803fdc:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  803fde:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803fe4:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+    close(fd);
+  803ff0:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803ff6:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+    return res;
+  804002:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  804008:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  80400e:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  804015:	5b                   	pop    %rbx
+  804016:	41 5c                	pop    %r12
+  804018:	41 5d                	pop    %r13
+  80401a:	41 5e                	pop    %r14
+  80401c:	41 5f                	pop    %r15
+  80401e:	5d                   	pop    %rbp
+  80401f:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  804020:	89 c3                	mov    %eax,%ebx
+  804022:	89 c6                	mov    %eax,%esi
+  804024:	48 bf b0 56 80 00 00 	movabs $0x8056b0,%rdi
+  80402b:	00 00 00 
+  80402e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804033:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  80403a:	00 00 00 
+  80403d:	ff d2                	call   *%rdx
+        return res;
+  80403f:	eb 9d                	jmp    803fde <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804041:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  804048:	01 
+  804049:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  804050:	48 83 c3 38          	add    $0x38,%rbx
+  804054:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80405b:	48 39 c1             	cmp    %rax,%rcx
+  80405e:	0f 83 ae 01 00 00    	jae    804212 <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  804064:	83 3b 01             	cmpl   $0x1,(%rbx)
+  804067:	75 d8                	jne    804041 <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  804069:	8b 43 04             	mov    0x4(%rbx),%eax
+  80406c:	41 89 c6             	mov    %eax,%r14d
+  80406f:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804073:	44 89 f2             	mov    %r14d,%edx
+  804076:	83 ca 04             	or     $0x4,%edx
+  804079:	a8 04                	test   $0x4,%al
+  80407b:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80407f:	44 89 f2             	mov    %r14d,%edx
+  804082:	83 ca 01             	or     $0x1,%edx
+  804085:	a8 01                	test   $0x1,%al
+  804087:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80408b:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80408f:	41 89 cc             	mov    %ecx,%r12d
+  804092:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  804096:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  80409a:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  80409e:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8040a4:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  8040aa:	44 89 fe             	mov    %r15d,%esi
+  8040ad:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8040b3:	74 0f                	je     8040c4 <spawn+0x502>
+        va -= res;
+  8040b5:	48 63 fe             	movslq %esi,%rdi
+  8040b8:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  8040bb:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  8040be:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  8040c1:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  8040c4:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  8040cb:	00 
+  8040cc:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8040d3:	49 89 f5             	mov    %rsi,%r13
+  8040d6:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  8040d9:	49 39 d5             	cmp    %rdx,%r13
+  8040dc:	73 23                	jae    804101 <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  8040de:	4c 01 fa             	add    %r15,%rdx
+  8040e1:	48 29 f2             	sub    %rsi,%rdx
+  8040e4:	44 89 f1             	mov    %r14d,%ecx
+  8040e7:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8040ed:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+        if (res < 0) {
+  8040f9:	85 c0                	test   %eax,%eax
+  8040fb:	0f 88 5b fe ff ff    	js     803f5c <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  804101:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804106:	4c 89 ea             	mov    %r13,%rdx
+  804109:	be 00 00 40 00       	mov    $0x400000,%esi
+  80410e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804113:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80411f:	85 c0                	test   %eax,%eax
+  804121:	0f 88 56 fe ff ff    	js     803f7d <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  804127:	44 89 e6             	mov    %r12d,%esi
+  80412a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  804130:	48 b8 4a 2a 80 00 00 	movabs $0x802a4a,%rax
+  804137:	00 00 00 
+  80413a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80413c:	85 c0                	test   %eax,%eax
+  80413e:	0f 88 5a fe ff ff    	js     803f9e <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  804144:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80414a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414f:	4d 85 ed             	test   %r13,%r13
+  804152:	74 48                	je     80419c <spawn+0x5da>
+  804154:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  80415b:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  804161:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  804168:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416d:	89 df                	mov    %ebx,%edi
+  80416f:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+        if (res < 0) {
+  80417b:	85 c0                	test   %eax,%eax
+  80417d:	0f 88 3c fe ff ff    	js     803fbf <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  804183:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  80418a:	00 
+  80418b:	41 89 c4             	mov    %eax,%r12d
+  80418e:	48 98                	cltq
+  804190:	4c 39 e8             	cmp    %r13,%rax
+  804193:	72 cc                	jb     804161 <spawn+0x59f>
+  804195:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  80419c:	45 89 f1             	mov    %r14d,%r9d
+  80419f:	41 80 c9 80          	or     $0x80,%r9b
+  8041a3:	4d 89 e8             	mov    %r13,%r8
+  8041a6:	4c 89 f9             	mov    %r15,%rcx
+  8041a9:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8041af:	be 00 00 40 00       	mov    $0x400000,%esi
+  8041b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b9:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  8041c0:	00 00 00 
+  8041c3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8041c5:	85 c0                	test   %eax,%eax
+  8041c7:	0f 88 53 fe ff ff    	js     804020 <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  8041cd:	4c 89 ea             	mov    %r13,%rdx
+  8041d0:	be 00 00 40 00       	mov    $0x400000,%esi
+  8041d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041da:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  8041e1:	00 00 00 
+  8041e4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8041e6:	85 c0                	test   %eax,%eax
+  8041e8:	0f 89 53 fe ff ff    	jns    804041 <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  8041ee:	89 c3                	mov    %eax,%ebx
+  8041f0:	89 c6                	mov    %eax,%esi
+  8041f2:	48 bf d8 56 80 00 00 	movabs $0x8056d8,%rdi
+  8041f9:	00 00 00 
+  8041fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804201:	48 ba d2 0c 80 00 00 	movabs $0x800cd2,%rdx
+  804208:	00 00 00 
+  80420b:	ff d2                	call   *%rdx
+        return res;
+  80420d:	e9 cc fd ff ff       	jmp    803fde <spawn+0x41c>
+    close(fd);
+  804212:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  804218:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  804224:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80422b:	48 bf 72 3b 80 00 00 	movabs $0x803b72,%rdi
+  804232:	00 00 00 
+  804235:	48 b8 74 4b 80 00 00 	movabs $0x804b74,%rax
+  80423c:	00 00 00 
+  80423f:	ff d0                	call   *%rax
+  804241:	85 c0                	test   %eax,%eax
+  804243:	78 49                	js     80428e <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804245:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80424c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804252:	48 b8 69 1f 80 00 00 	movabs $0x801f69,%rax
+  804259:	00 00 00 
+  80425c:	ff d0                	call   *%rax
+  80425e:	85 c0                	test   %eax,%eax
+  804260:	78 59                	js     8042bb <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804262:	be 02 00 00 00       	mov    $0x2,%esi
+  804267:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80426d:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  804274:	00 00 00 
+  804277:	ff d0                	call   *%rax
+  804279:	85 c0                	test   %eax,%eax
+  80427b:	78 6b                	js     8042e8 <spawn+0x726>
+    return child;
+  80427d:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804283:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  804289:	e9 7a fd ff ff       	jmp    804008 <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  80428e:	89 c1                	mov    %eax,%ecx
+  804290:	48 ba 62 57 80 00 00 	movabs $0x805762,%rdx
+  804297:	00 00 00 
+  80429a:	be 84 00 00 00       	mov    $0x84,%esi
+  80429f:	48 bf 1b 57 80 00 00 	movabs $0x80571b,%rdi
+  8042a6:	00 00 00 
+  8042a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ae:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  8042b5:	00 00 00 
+  8042b8:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8042bb:	89 c1                	mov    %eax,%ecx
+  8042bd:	48 ba 79 57 80 00 00 	movabs $0x805779,%rdx
+  8042c4:	00 00 00 
+  8042c7:	be 87 00 00 00       	mov    $0x87,%esi
+  8042cc:	48 bf 1b 57 80 00 00 	movabs $0x80571b,%rdi
+  8042d3:	00 00 00 
+  8042d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042db:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  8042e2:	00 00 00 
+  8042e5:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8042e8:	89 c1                	mov    %eax,%ecx
+  8042ea:	48 ba 93 57 80 00 00 	movabs $0x805793,%rdx
+  8042f1:	00 00 00 
+  8042f4:	be 8a 00 00 00       	mov    $0x8a,%esi
+  8042f9:	48 bf 1b 57 80 00 00 	movabs $0x80571b,%rdi
+  804300:	00 00 00 
+  804303:	b8 00 00 00 00       	mov    $0x0,%eax
+  804308:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  80430f:	00 00 00 
+  804312:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804315:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  80431a:	e9 bf fc ff ff       	jmp    803fde <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80431f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804324:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804329:	be 00 00 40 00       	mov    $0x400000,%esi
+  80432e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804333:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  80433a:	00 00 00 
+  80433d:	ff d0                	call   *%rax
+  80433f:	89 c3                	mov    %eax,%ebx
+  804341:	85 c0                	test   %eax,%eax
+  804343:	0f 88 95 fc ff ff    	js     803fde <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804349:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804350:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804354:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  80435b:	f8 ff 40 00 
+  80435f:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  804366:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80436a:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  804370:	e9 61 fa ff ff       	jmp    803dd6 <spawn+0x214>
+
+0000000000804375 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804375:	55                   	push   %rbp
+  804376:	48 89 e5             	mov    %rsp,%rbp
+  804379:	48 83 ec 50          	sub    $0x50,%rsp
+  80437d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804381:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804385:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804389:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80438d:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804394:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804398:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80439c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8043a0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8043a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8043a9:	eb 15                	jmp    8043c0 <spawnl+0x4b>
+  8043ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8043b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043b7:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8043bb:	74 1c                	je     8043d9 <spawnl+0x64>
+  8043bd:	83 c1 01             	add    $0x1,%ecx
+  8043c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8043c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8043c6:	77 e3                	ja     8043ab <spawnl+0x36>
+  8043c8:	89 c2                	mov    %eax,%edx
+  8043ca:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8043ce:	4c 01 d2             	add    %r10,%rdx
+  8043d1:	83 c0 08             	add    $0x8,%eax
+  8043d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8043d7:	eb de                	jmp    8043b7 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8043d9:	8d 41 02             	lea    0x2(%rcx),%eax
+  8043dc:	48 98                	cltq
+  8043de:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8043e5:	00 
+  8043e6:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8043ea:	48 29 c4             	sub    %rax,%rsp
+  8043ed:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8043f2:	4c 89 c0             	mov    %r8,%rax
+  8043f5:	48 c1 e8 03          	shr    $0x3,%rax
+  8043f9:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8043fd:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804404:	00 
+    argv[argc + 1] = NULL;
+  804405:	8d 41 01             	lea    0x1(%rcx),%eax
+  804408:	48 98                	cltq
+  80440a:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804411:	00 
+    va_start(vl, arg0);
+  804412:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804419:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80441d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804421:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804425:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804429:	85 c9                	test   %ecx,%ecx
+  80442b:	74 41                	je     80446e <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80442d:	49 89 c1             	mov    %rax,%r9
+  804430:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804434:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804437:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80443c:	eb 1b                	jmp    804459 <spawnl+0xe4>
+  80443e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804442:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804446:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80444a:	48 8b 11             	mov    (%rcx),%rdx
+  80444d:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804450:	48 83 c0 08          	add    $0x8,%rax
+  804454:	48 39 f0             	cmp    %rsi,%rax
+  804457:	74 15                	je     80446e <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804459:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80445c:	83 fa 2f             	cmp    $0x2f,%edx
+  80445f:	77 dd                	ja     80443e <spawnl+0xc9>
+  804461:	89 d1                	mov    %edx,%ecx
+  804463:	4c 01 c9             	add    %r9,%rcx
+  804466:	83 c2 08             	add    $0x8,%edx
+  804469:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80446c:	eb dc                	jmp    80444a <spawnl+0xd5>
+    return spawn(prog, argv);
+  80446e:	4c 89 c6             	mov    %r8,%rsi
+  804471:	48 b8 c2 3b 80 00 00 	movabs $0x803bc2,%rax
+  804478:	00 00 00 
+  80447b:	ff d0                	call   *%rax
+}
+  80447d:	c9                   	leave
+  80447e:	c3                   	ret
+
+000000000080447f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80447f:	55                   	push   %rbp
+  804480:	48 89 e5             	mov    %rsp,%rbp
+  804483:	41 54                	push   %r12
+  804485:	53                   	push   %rbx
+  804486:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804489:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  804490:	00 00 00 
+  804493:	ff d0                	call   *%rax
+  804495:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804498:	48 be aa 57 80 00 00 	movabs $0x8057aa,%rsi
+  80449f:	00 00 00 
+  8044a2:	48 89 df             	mov    %rbx,%rdi
+  8044a5:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  8044ac:	00 00 00 
+  8044af:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8044b1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8044b6:	41 2b 04 24          	sub    (%r12),%eax
+  8044ba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8044c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8044c7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8044ca:	48 b8 40 61 80 00 00 	movabs $0x806140,%rax
+  8044d1:	00 00 00 
+  8044d4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8044db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e0:	5b                   	pop    %rbx
+  8044e1:	41 5c                	pop    %r12
+  8044e3:	5d                   	pop    %rbp
+  8044e4:	c3                   	ret
+
+00000000008044e5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8044e5:	55                   	push   %rbp
+  8044e6:	48 89 e5             	mov    %rsp,%rbp
+  8044e9:	41 54                	push   %r12
+  8044eb:	53                   	push   %rbx
+  8044ec:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8044ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044f4:	48 89 fe             	mov    %rdi,%rsi
+  8044f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044fc:	49 bc 99 1e 80 00 00 	movabs $0x801e99,%r12
+  804503:	00 00 00 
+  804506:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804509:	48 89 df             	mov    %rbx,%rdi
+  80450c:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+  804518:	48 89 c6             	mov    %rax,%rsi
+  80451b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804520:	bf 00 00 00 00       	mov    $0x0,%edi
+  804525:	41 ff d4             	call   *%r12
+}
+  804528:	5b                   	pop    %rbx
+  804529:	41 5c                	pop    %r12
+  80452b:	5d                   	pop    %rbp
+  80452c:	c3                   	ret
+
+000000000080452d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80452d:	55                   	push   %rbp
+  80452e:	48 89 e5             	mov    %rsp,%rbp
+  804531:	41 57                	push   %r15
+  804533:	41 56                	push   %r14
+  804535:	41 55                	push   %r13
+  804537:	41 54                	push   %r12
+  804539:	53                   	push   %rbx
+  80453a:	48 83 ec 18          	sub    $0x18,%rsp
+  80453e:	49 89 fc             	mov    %rdi,%r12
+  804541:	49 89 f5             	mov    %rsi,%r13
+  804544:	49 89 d7             	mov    %rdx,%r15
+  804547:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80454b:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  804552:	00 00 00 
+  804555:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804557:	4d 85 ff             	test   %r15,%r15
+  80455a:	0f 84 af 00 00 00    	je     80460f <devpipe_write+0xe2>
+  804560:	48 89 c3             	mov    %rax,%rbx
+  804563:	4c 89 f8             	mov    %r15,%rax
+  804566:	4d 89 ef             	mov    %r13,%r15
+  804569:	4c 01 e8             	add    %r13,%rax
+  80456c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804570:	49 bd a1 1d 80 00 00 	movabs $0x801da1,%r13
+  804577:	00 00 00 
+            sys_yield();
+  80457a:	49 be 3e 1d 80 00 00 	movabs $0x801d3e,%r14
+  804581:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804584:	8b 73 04             	mov    0x4(%rbx),%esi
+  804587:	48 63 ce             	movslq %esi,%rcx
+  80458a:	48 63 03             	movslq (%rbx),%rax
+  80458d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804593:	48 39 c1             	cmp    %rax,%rcx
+  804596:	72 2e                	jb     8045c6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804598:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80459d:	48 89 da             	mov    %rbx,%rdx
+  8045a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045a5:	4c 89 e7             	mov    %r12,%rdi
+  8045a8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8045ab:	85 c0                	test   %eax,%eax
+  8045ad:	74 66                	je     804615 <devpipe_write+0xe8>
+            sys_yield();
+  8045af:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8045b2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8045b5:	48 63 ce             	movslq %esi,%rcx
+  8045b8:	48 63 03             	movslq (%rbx),%rax
+  8045bb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8045c1:	48 39 c1             	cmp    %rax,%rcx
+  8045c4:	73 d2                	jae    804598 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8045c6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8045ca:	48 89 ca             	mov    %rcx,%rdx
+  8045cd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8045d1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8045d8:	08 10 20 
+  8045db:	48 f7 e2             	mul    %rdx
+  8045de:	48 c1 ea 06          	shr    $0x6,%rdx
+  8045e2:	48 89 d0             	mov    %rdx,%rax
+  8045e5:	48 c1 e0 09          	shl    $0x9,%rax
+  8045e9:	48 29 d0             	sub    %rdx,%rax
+  8045ec:	48 c1 e0 03          	shl    $0x3,%rax
+  8045f0:	48 29 c1             	sub    %rax,%rcx
+  8045f3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8045f8:	83 c6 01             	add    $0x1,%esi
+  8045fb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8045fe:	49 83 c7 01          	add    $0x1,%r15
+  804602:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804606:	49 39 c7             	cmp    %rax,%r15
+  804609:	0f 85 75 ff ff ff    	jne    804584 <devpipe_write+0x57>
+    return n;
+  80460f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804613:	eb 05                	jmp    80461a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804615:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80461a:	48 83 c4 18          	add    $0x18,%rsp
+  80461e:	5b                   	pop    %rbx
+  80461f:	41 5c                	pop    %r12
+  804621:	41 5d                	pop    %r13
+  804623:	41 5e                	pop    %r14
+  804625:	41 5f                	pop    %r15
+  804627:	5d                   	pop    %rbp
+  804628:	c3                   	ret
+
+0000000000804629 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804629:	55                   	push   %rbp
+  80462a:	48 89 e5             	mov    %rsp,%rbp
+  80462d:	41 57                	push   %r15
+  80462f:	41 56                	push   %r14
+  804631:	41 55                	push   %r13
+  804633:	41 54                	push   %r12
+  804635:	53                   	push   %rbx
+  804636:	48 83 ec 18          	sub    $0x18,%rsp
+  80463a:	49 89 fc             	mov    %rdi,%r12
+  80463d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804641:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804645:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  80464c:	00 00 00 
+  80464f:	ff d0                	call   *%rax
+  804651:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804654:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80465a:	49 bd a1 1d 80 00 00 	movabs $0x801da1,%r13
+  804661:	00 00 00 
+            sys_yield();
+  804664:	49 be 3e 1d 80 00 00 	movabs $0x801d3e,%r14
+  80466b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80466e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804673:	74 7d                	je     8046f2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804675:	8b 03                	mov    (%rbx),%eax
+  804677:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80467a:	75 26                	jne    8046a2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80467c:	4d 85 ff             	test   %r15,%r15
+  80467f:	75 77                	jne    8046f8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804681:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804686:	48 89 da             	mov    %rbx,%rdx
+  804689:	be 00 10 00 00       	mov    $0x1000,%esi
+  80468e:	4c 89 e7             	mov    %r12,%rdi
+  804691:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804694:	85 c0                	test   %eax,%eax
+  804696:	74 72                	je     80470a <devpipe_read+0xe1>
+            sys_yield();
+  804698:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80469b:	8b 03                	mov    (%rbx),%eax
+  80469d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8046a0:	74 df                	je     804681 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8046a2:	48 63 c8             	movslq %eax,%rcx
+  8046a5:	48 89 ca             	mov    %rcx,%rdx
+  8046a8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8046ac:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8046b3:	08 10 20 
+  8046b6:	48 89 d0             	mov    %rdx,%rax
+  8046b9:	48 f7 e6             	mul    %rsi
+  8046bc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8046c0:	48 89 d0             	mov    %rdx,%rax
+  8046c3:	48 c1 e0 09          	shl    $0x9,%rax
+  8046c7:	48 29 d0             	sub    %rdx,%rax
+  8046ca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8046d1:	00 
+  8046d2:	48 89 c8             	mov    %rcx,%rax
+  8046d5:	48 29 d0             	sub    %rdx,%rax
+  8046d8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8046dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8046e1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8046e5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8046e8:	49 83 c7 01          	add    $0x1,%r15
+  8046ec:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8046f0:	75 83                	jne    804675 <devpipe_read+0x4c>
+    return n;
+  8046f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046f6:	eb 03                	jmp    8046fb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8046f8:	4c 89 f8             	mov    %r15,%rax
+}
+  8046fb:	48 83 c4 18          	add    $0x18,%rsp
+  8046ff:	5b                   	pop    %rbx
+  804700:	41 5c                	pop    %r12
+  804702:	41 5d                	pop    %r13
+  804704:	41 5e                	pop    %r14
+  804706:	41 5f                	pop    %r15
+  804708:	5d                   	pop    %rbp
+  804709:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80470a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470f:	eb ea                	jmp    8046fb <devpipe_read+0xd2>
+
+0000000000804711 <pipe>:
+pipe(int pfd[2]) {
+  804711:	55                   	push   %rbp
+  804712:	48 89 e5             	mov    %rsp,%rbp
+  804715:	41 55                	push   %r13
+  804717:	41 54                	push   %r12
+  804719:	53                   	push   %rbx
+  80471a:	48 83 ec 18          	sub    $0x18,%rsp
+  80471e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804721:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804725:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  80472c:	00 00 00 
+  80472f:	ff d0                	call   *%rax
+  804731:	89 c3                	mov    %eax,%ebx
+  804733:	85 c0                	test   %eax,%eax
+  804735:	0f 88 a0 01 00 00    	js     8048db <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80473b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804740:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804745:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804749:	bf 00 00 00 00       	mov    $0x0,%edi
+  80474e:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  804755:	00 00 00 
+  804758:	ff d0                	call   *%rax
+  80475a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80475c:	85 c0                	test   %eax,%eax
+  80475e:	0f 88 77 01 00 00    	js     8048db <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804764:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804768:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  80476f:	00 00 00 
+  804772:	ff d0                	call   *%rax
+  804774:	89 c3                	mov    %eax,%ebx
+  804776:	85 c0                	test   %eax,%eax
+  804778:	0f 88 43 01 00 00    	js     8048c1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80477e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804783:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804788:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80478c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804791:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  804798:	00 00 00 
+  80479b:	ff d0                	call   *%rax
+  80479d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80479f:	85 c0                	test   %eax,%eax
+  8047a1:	0f 88 1a 01 00 00    	js     8048c1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8047a7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8047ab:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  8047b2:	00 00 00 
+  8047b5:	ff d0                	call   *%rax
+  8047b7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8047ba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c4:	48 89 c6             	mov    %rax,%rsi
+  8047c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047cc:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  8047d3:	00 00 00 
+  8047d6:	ff d0                	call   *%rax
+  8047d8:	89 c3                	mov    %eax,%ebx
+  8047da:	85 c0                	test   %eax,%eax
+  8047dc:	0f 88 c5 00 00 00    	js     8048a7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8047e2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8047e6:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  8047ed:	00 00 00 
+  8047f0:	ff d0                	call   *%rax
+  8047f2:	48 89 c1             	mov    %rax,%rcx
+  8047f5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8047fb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804801:	ba 00 00 00 00       	mov    $0x0,%edx
+  804806:	4c 89 ee             	mov    %r13,%rsi
+  804809:	bf 00 00 00 00       	mov    $0x0,%edi
+  80480e:	48 b8 34 1e 80 00 00 	movabs $0x801e34,%rax
+  804815:	00 00 00 
+  804818:	ff d0                	call   *%rax
+  80481a:	89 c3                	mov    %eax,%ebx
+  80481c:	85 c0                	test   %eax,%eax
+  80481e:	78 6e                	js     80488e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804820:	be 00 10 00 00       	mov    $0x1000,%esi
+  804825:	4c 89 ef             	mov    %r13,%rdi
+  804828:	48 b8 6f 1d 80 00 00 	movabs $0x801d6f,%rax
+  80482f:	00 00 00 
+  804832:	ff d0                	call   *%rax
+  804834:	83 f8 02             	cmp    $0x2,%eax
+  804837:	0f 85 ab 00 00 00    	jne    8048e8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80483d:	a1 40 61 80 00 00 00 	movabs 0x806140,%eax
+  804844:	00 00 
+  804846:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80484a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80484c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804850:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804857:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80485b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80485d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804861:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804868:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80486c:	48 bb 26 24 80 00 00 	movabs $0x802426,%rbx
+  804873:	00 00 00 
+  804876:	ff d3                	call   *%rbx
+  804878:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80487c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804880:	ff d3                	call   *%rbx
+  804882:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804887:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80488c:	eb 4d                	jmp    8048db <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80488e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804893:	4c 89 ee             	mov    %r13,%rsi
+  804896:	bf 00 00 00 00       	mov    $0x0,%edi
+  80489b:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  8048a2:	00 00 00 
+  8048a5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8048a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048ac:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8048b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b5:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  8048bc:	00 00 00 
+  8048bf:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8048c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048c6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8048ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048cf:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  8048d6:	00 00 00 
+  8048d9:	ff d0                	call   *%rax
+}
+  8048db:	89 d8                	mov    %ebx,%eax
+  8048dd:	48 83 c4 18          	add    $0x18,%rsp
+  8048e1:	5b                   	pop    %rbx
+  8048e2:	41 5c                	pop    %r12
+  8048e4:	41 5d                	pop    %r13
+  8048e6:	5d                   	pop    %rbp
+  8048e7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8048e8:	48 b9 c8 57 80 00 00 	movabs $0x8057c8,%rcx
+  8048ef:	00 00 00 
+  8048f2:	48 ba c0 4e 80 00 00 	movabs $0x804ec0,%rdx
+  8048f9:	00 00 00 
+  8048fc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804901:	48 bf b1 57 80 00 00 	movabs $0x8057b1,%rdi
+  804908:	00 00 00 
+  80490b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804910:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  804917:	00 00 00 
+  80491a:	41 ff d0             	call   *%r8
+
+000000000080491d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80491d:	55                   	push   %rbp
+  80491e:	48 89 e5             	mov    %rsp,%rbp
+  804921:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804925:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804929:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  804930:	00 00 00 
+  804933:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804935:	85 c0                	test   %eax,%eax
+  804937:	78 35                	js     80496e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804939:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80493d:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  804944:	00 00 00 
+  804947:	ff d0                	call   *%rax
+  804949:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80494c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804951:	be 00 10 00 00       	mov    $0x1000,%esi
+  804956:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80495a:	48 b8 a1 1d 80 00 00 	movabs $0x801da1,%rax
+  804961:	00 00 00 
+  804964:	ff d0                	call   *%rax
+  804966:	85 c0                	test   %eax,%eax
+  804968:	0f 94 c0             	sete   %al
+  80496b:	0f b6 c0             	movzbl %al,%eax
+}
+  80496e:	c9                   	leave
+  80496f:	c3                   	ret
+
+0000000000804970 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804970:	55                   	push   %rbp
+  804971:	48 89 e5             	mov    %rsp,%rbp
+  804974:	41 55                	push   %r13
+  804976:	41 54                	push   %r12
+  804978:	53                   	push   %rbx
+  804979:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80497d:	85 ff                	test   %edi,%edi
+  80497f:	74 7d                	je     8049fe <wait+0x8e>
+  804981:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804984:	89 f8                	mov    %edi,%eax
+  804986:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80498b:	89 fa                	mov    %edi,%edx
+  80498d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804993:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  804997:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  80499b:	48 c1 e1 04          	shl    $0x4,%rcx
+  80499f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049a6:	00 00 00 
+  8049a9:	48 01 ca             	add    %rcx,%rdx
+  8049ac:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8049b2:	39 d7                	cmp    %edx,%edi
+  8049b4:	75 3d                	jne    8049f3 <wait+0x83>
+           env->env_status != ENV_FREE) {
+  8049b6:	48 98                	cltq
+  8049b8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8049bc:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8049c0:	48 c1 e0 04          	shl    $0x4,%rax
+  8049c4:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8049cb:	00 00 00 
+  8049ce:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8049d1:	49 bd 3e 1d 80 00 00 	movabs $0x801d3e,%r13
+  8049d8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8049db:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8049e1:	85 c0                	test   %eax,%eax
+  8049e3:	74 0e                	je     8049f3 <wait+0x83>
+        sys_yield();
+  8049e5:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8049e8:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8049ee:	44 39 e0             	cmp    %r12d,%eax
+  8049f1:	74 e8                	je     8049db <wait+0x6b>
+    }
+}
+  8049f3:	48 83 c4 08          	add    $0x8,%rsp
+  8049f7:	5b                   	pop    %rbx
+  8049f8:	41 5c                	pop    %r12
+  8049fa:	41 5d                	pop    %r13
+  8049fc:	5d                   	pop    %rbp
+  8049fd:	c3                   	ret
+    assert(envid != 0);
+  8049fe:	48 b9 ec 57 80 00 00 	movabs $0x8057ec,%rcx
+  804a05:	00 00 00 
+  804a08:	48 ba c0 4e 80 00 00 	movabs $0x804ec0,%rdx
+  804a0f:	00 00 00 
+  804a12:	be 06 00 00 00       	mov    $0x6,%esi
+  804a17:	48 bf f7 57 80 00 00 	movabs $0x8057f7,%rdi
+  804a1e:	00 00 00 
+  804a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a26:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  804a2d:	00 00 00 
+  804a30:	41 ff d0             	call   *%r8
+
+0000000000804a33 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804a33:	48 89 f8             	mov    %rdi,%rax
+  804a36:	48 c1 e8 27          	shr    $0x27,%rax
+  804a3a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804a41:	01 00 00 
+  804a44:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a48:	f6 c2 01             	test   $0x1,%dl
+  804a4b:	74 6d                	je     804aba <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a4d:	48 89 f8             	mov    %rdi,%rax
+  804a50:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804a54:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a5b:	01 00 00 
+  804a5e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a62:	f6 c2 01             	test   $0x1,%dl
+  804a65:	74 62                	je     804ac9 <get_uvpt_entry+0x96>
+  804a67:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a6e:	01 00 00 
+  804a71:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a75:	f6 c2 80             	test   $0x80,%dl
+  804a78:	75 4f                	jne    804ac9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a7a:	48 89 f8             	mov    %rdi,%rax
+  804a7d:	48 c1 e8 15          	shr    $0x15,%rax
+  804a81:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a88:	01 00 00 
+  804a8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a8f:	f6 c2 01             	test   $0x1,%dl
+  804a92:	74 44                	je     804ad8 <get_uvpt_entry+0xa5>
+  804a94:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a9b:	01 00 00 
+  804a9e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804aa2:	f6 c2 80             	test   $0x80,%dl
+  804aa5:	75 31                	jne    804ad8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804aa7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804aab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804ab2:	01 00 00 
+  804ab5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804ab9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804aba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804ac1:	01 00 00 
+  804ac4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ac8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804ac9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804ad0:	01 00 00 
+  804ad3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ad7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804ad8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804adf:	01 00 00 
+  804ae2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ae6:	c3                   	ret
+
+0000000000804ae7 <get_prot>:
+
+int
+get_prot(void *va) {
+  804ae7:	55                   	push   %rbp
+  804ae8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804aeb:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  804af2:	00 00 00 
+  804af5:	ff d0                	call   *%rax
+  804af7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804afa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804aff:	89 c1                	mov    %eax,%ecx
+  804b01:	83 c9 04             	or     $0x4,%ecx
+  804b04:	f6 c2 01             	test   $0x1,%dl
+  804b07:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804b0a:	89 c1                	mov    %eax,%ecx
+  804b0c:	83 c9 02             	or     $0x2,%ecx
+  804b0f:	f6 c2 02             	test   $0x2,%dl
+  804b12:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804b15:	89 c1                	mov    %eax,%ecx
+  804b17:	83 c9 01             	or     $0x1,%ecx
+  804b1a:	48 85 d2             	test   %rdx,%rdx
+  804b1d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804b20:	89 c1                	mov    %eax,%ecx
+  804b22:	83 c9 40             	or     $0x40,%ecx
+  804b25:	f6 c6 04             	test   $0x4,%dh
+  804b28:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804b2b:	5d                   	pop    %rbp
+  804b2c:	c3                   	ret
+
+0000000000804b2d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804b2d:	55                   	push   %rbp
+  804b2e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804b31:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  804b38:	00 00 00 
+  804b3b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804b3d:	48 c1 e8 06          	shr    $0x6,%rax
+  804b41:	83 e0 01             	and    $0x1,%eax
+}
+  804b44:	5d                   	pop    %rbp
+  804b45:	c3                   	ret
+
+0000000000804b46 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  804b46:	55                   	push   %rbp
+  804b47:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804b4a:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  804b51:	00 00 00 
+  804b54:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  804b56:	48 c1 e8 05          	shr    $0x5,%rax
+  804b5a:	83 e0 01             	and    $0x1,%eax
+}
+  804b5d:	5d                   	pop    %rbp
+  804b5e:	c3                   	ret
+
+0000000000804b5f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804b5f:	55                   	push   %rbp
+  804b60:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804b63:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  804b6a:	00 00 00 
+  804b6d:	ff d0                	call   *%rax
+  804b6f:	83 e0 01             	and    $0x1,%eax
+}
+  804b72:	5d                   	pop    %rbp
+  804b73:	c3                   	ret
+
+0000000000804b74 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804b74:	55                   	push   %rbp
+  804b75:	48 89 e5             	mov    %rsp,%rbp
+  804b78:	41 57                	push   %r15
+  804b7a:	41 56                	push   %r14
+  804b7c:	41 55                	push   %r13
+  804b7e:	41 54                	push   %r12
+  804b80:	53                   	push   %rbx
+  804b81:	48 83 ec 18          	sub    $0x18,%rsp
+  804b85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804b89:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  804b8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  804b92:	49 bd 5f 4b 80 00 00 	movabs $0x804b5f,%r13
+  804b99:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  804b9c:	49 bf e7 4a 80 00 00 	movabs $0x804ae7,%r15
+  804ba3:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  804ba6:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  804bad:	00 00 00 
+  804bb0:	eb 0c                	jmp    804bbe <foreach_shared_region+0x4a>
+  804bb2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804bb9:	4c 39 f3             	cmp    %r14,%rbx
+  804bbc:	74 2e                	je     804bec <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  804bbe:	48 89 df             	mov    %rbx,%rdi
+  804bc1:	41 ff d5             	call   *%r13
+  804bc4:	84 c0                	test   %al,%al
+  804bc6:	74 ea                	je     804bb2 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  804bc8:	48 89 df             	mov    %rbx,%rdi
+  804bcb:	41 ff d7             	call   *%r15
+  804bce:	a8 40                	test   $0x40,%al
+  804bd0:	74 e0                	je     804bb2 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  804bd2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804bdd:	48 89 df             	mov    %rbx,%rdi
+  804be0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804be4:	ff d0                	call   *%rax
+				if (res < 0) {
+  804be6:	85 c0                	test   %eax,%eax
+  804be8:	79 c8                	jns    804bb2 <foreach_shared_region+0x3e>
+  804bea:	eb 05                	jmp    804bf1 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  804bec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bf1:	48 83 c4 18          	add    $0x18,%rsp
+  804bf5:	5b                   	pop    %rbx
+  804bf6:	41 5c                	pop    %r12
+  804bf8:	41 5d                	pop    %r13
+  804bfa:	41 5e                	pop    %r14
+  804bfc:	41 5f                	pop    %r15
+  804bfe:	5d                   	pop    %rbp
+  804bff:	c3                   	ret
+
+0000000000804c00 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  804c00:	55                   	push   %rbp
+  804c01:	48 89 e5             	mov    %rsp,%rbp
+  804c04:	41 55                	push   %r13
+  804c06:	41 54                	push   %r12
+  804c08:	53                   	push   %rbx
+  804c09:	48 83 ec 08          	sub    $0x8,%rsp
+  804c0d:	49 89 fc             	mov    %rdi,%r12
+  804c10:	48 89 f7             	mov    %rsi,%rdi
+  804c13:	48 89 d3             	mov    %rdx,%rbx
+  804c16:	49 89 cd             	mov    %rcx,%r13
+  804c19:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c1c:	48 85 f6             	test   %rsi,%rsi
+  804c1f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c26:	00 00 00 
+  804c29:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  804c2d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c32:	48 85 db             	test   %rbx,%rbx
+  804c35:	74 03                	je     804c3a <ipc_recv_timed+0x3a>
+  804c37:	48 8b 33             	mov    (%rbx),%rsi
+  804c3a:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  804c41:	00 00 00 
+  804c44:	ff d0                	call   *%rax
+    if (res < 0) {
+  804c46:	85 c0                	test   %eax,%eax
+  804c48:	78 75                	js     804cbf <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804c4a:	4d 85 e4             	test   %r12,%r12
+  804c4d:	74 14                	je     804c63 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  804c4f:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  804c56:	00 00 00 
+  804c59:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  804c5f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  804c63:	4d 85 ed             	test   %r13,%r13
+  804c66:	74 14                	je     804c7c <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  804c68:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  804c6f:	00 00 00 
+  804c72:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  804c78:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  804c7c:	48 85 db             	test   %rbx,%rbx
+  804c7f:	74 23                	je     804ca4 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804c81:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  804c88:	00 00 00 
+  804c8b:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  804c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c96:	85 c9                	test   %ecx,%ecx
+  804c98:	74 07                	je     804ca1 <ipc_recv_timed+0xa1>
+  804c9a:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  804ca1:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804ca4:	48 a1 18 70 80 00 00 	movabs 0x807018,%rax
+  804cab:	00 00 00 
+  804cae:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  804cb4:	48 83 c4 08          	add    $0x8,%rsp
+  804cb8:	5b                   	pop    %rbx
+  804cb9:	41 5c                	pop    %r12
+  804cbb:	41 5d                	pop    %r13
+  804cbd:	5d                   	pop    %rbp
+  804cbe:	c3                   	ret
+        if (from_env_store != NULL) {
+  804cbf:	4d 85 e4             	test   %r12,%r12
+  804cc2:	74 08                	je     804ccc <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  804cc4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804ccb:	00 
+        if (perm_store != NULL) {
+  804ccc:	4d 85 ed             	test   %r13,%r13
+  804ccf:	74 08                	je     804cd9 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  804cd1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804cd8:	00 
+        if (size != NULL) {
+  804cd9:	48 85 db             	test   %rbx,%rbx
+  804cdc:	74 d6                	je     804cb4 <ipc_recv_timed+0xb4>
+            *size = 0;
+  804cde:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804ce5:	eb cd                	jmp    804cb4 <ipc_recv_timed+0xb4>
+
+0000000000804ce7 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ce7:	55                   	push   %rbp
+  804ce8:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  804ceb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804cf1:	48 b8 00 4c 80 00 00 	movabs $0x804c00,%rax
+  804cf8:	00 00 00 
+  804cfb:	ff d0                	call   *%rax
+}
+  804cfd:	5d                   	pop    %rbp
+  804cfe:	c3                   	ret
+
+0000000000804cff <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804cff:	55                   	push   %rbp
+  804d00:	48 89 e5             	mov    %rsp,%rbp
+  804d03:	41 57                	push   %r15
+  804d05:	41 56                	push   %r14
+  804d07:	41 55                	push   %r13
+  804d09:	41 54                	push   %r12
+  804d0b:	53                   	push   %rbx
+  804d0c:	48 83 ec 18          	sub    $0x18,%rsp
+  804d10:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804d13:	48 89 d3             	mov    %rdx,%rbx
+  804d16:	49 89 cc             	mov    %rcx,%r12
+  804d19:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804d1c:	48 85 d2             	test   %rdx,%rdx
+  804d1f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d26:	00 00 00 
+  804d29:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804d2d:	89 f0                	mov    %esi,%eax
+  804d2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d33:	48 89 da             	mov    %rbx,%rdx
+  804d36:	48 89 c6             	mov    %rax,%rsi
+  804d39:	48 b8 3b 20 80 00 00 	movabs $0x80203b,%rax
+  804d40:	00 00 00 
+  804d43:	ff d0                	call   *%rax
+    while (res < 0) {
+  804d45:	85 c0                	test   %eax,%eax
+  804d47:	79 65                	jns    804dae <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804d49:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804d4c:	75 33                	jne    804d81 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  804d4e:	49 bf 3e 1d 80 00 00 	movabs $0x801d3e,%r15
+  804d55:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804d58:	49 be 3b 20 80 00 00 	movabs $0x80203b,%r14
+  804d5f:	00 00 00 
+        sys_yield();
+  804d62:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804d65:	45 89 e8             	mov    %r13d,%r8d
+  804d68:	4c 89 e1             	mov    %r12,%rcx
+  804d6b:	48 89 da             	mov    %rbx,%rdx
+  804d6e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804d72:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804d75:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  804d78:	85 c0                	test   %eax,%eax
+  804d7a:	79 32                	jns    804dae <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804d7c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804d7f:	74 e1                	je     804d62 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  804d81:	89 c1                	mov    %eax,%ecx
+  804d83:	48 ba 02 58 80 00 00 	movabs $0x805802,%rdx
+  804d8a:	00 00 00 
+  804d8d:	be 52 00 00 00       	mov    $0x52,%esi
+  804d92:	48 bf 16 58 80 00 00 	movabs $0x805816,%rdi
+  804d99:	00 00 00 
+  804d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da1:	49 b8 82 0b 80 00 00 	movabs $0x800b82,%r8
+  804da8:	00 00 00 
+  804dab:	41 ff d0             	call   *%r8
+    }
+}
+  804dae:	48 83 c4 18          	add    $0x18,%rsp
+  804db2:	5b                   	pop    %rbx
+  804db3:	41 5c                	pop    %r12
+  804db5:	41 5d                	pop    %r13
+  804db7:	41 5e                	pop    %r14
+  804db9:	41 5f                	pop    %r15
+  804dbb:	5d                   	pop    %rbp
+  804dbc:	c3                   	ret
+
+0000000000804dbd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804dc2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804dc9:	00 00 00 
+  804dcc:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804dd0:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804dd4:	48 c1 e2 04          	shl    $0x4,%rdx
+  804dd8:	48 01 ca             	add    %rcx,%rdx
+  804ddb:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804de1:	39 fa                	cmp    %edi,%edx
+  804de3:	74 12                	je     804df7 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  804de5:	48 83 c0 01          	add    $0x1,%rax
+  804de9:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804def:	75 db                	jne    804dcc <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804df1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804df6:	c3                   	ret
+            return envs[i].env_id;
+  804df7:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804dfb:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804dff:	48 c1 e2 04          	shl    $0x4,%rdx
+  804e03:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  804e0a:	00 00 00 
+  804e0d:	48 01 d0             	add    %rdx,%rax
+  804e10:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804e16:	c3                   	ret
+  804e17:	90                   	nop
+
+0000000000804e18 <__rodata_start>:
+  804e18:	20 09                	and    %cl,(%rcx)
+  804e1a:	0d 0a 00 20 09       	or     $0x920000a,%eax
+  804e1f:	0d 0a 3c 7c 3e       	or     $0x3e7c3c0a,%eax
+  804e24:	26 3b 28             	es cmp (%rax),%ebp
+  804e27:	29 00                	sub    %eax,(%rax)
+  804e29:	74 6f                	je     804e9a <__rodata_start+0x82>
+  804e2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e2c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804e2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e30:	79 20                	jns    804e52 <__rodata_start+0x3a>
+  804e32:	61                   	(bad)
+  804e33:	72 67                	jb     804e9c <__rodata_start+0x84>
+  804e35:	75 6d                	jne    804ea4 <__rodata_start+0x8c>
+  804e37:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e39:	74 73                	je     804eae <__rodata_start+0x96>
+  804e3b:	0a 00                	or     (%rax),%al
+  804e3d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e3e:	70 65                	jo     804ea5 <__rodata_start+0x8d>
+  804e40:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e41:	20 25 73 20 66 6f    	and    %ah,0x6f662073(%rip)        # 6fe66eba <__bss_end+0x6f65ceba>
+  804e47:	72 20                	jb     804e69 <__rodata_start+0x51>
+  804e49:	72 65                	jb     804eb0 <__rodata_start+0x98>
+  804e4b:	61                   	(bad)
+  804e4c:	64 20 25 69 00 6f 70 	and    %ah,%fs:0x706f0069(%rip)        # 70ef4ebc <__bss_end+0x706eaebc>
+  804e53:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e55:	20 25 73 20 66 6f    	and    %ah,0x6f662073(%rip)        # 6fe66ece <__bss_end+0x6f65cece>
+  804e5b:	72 20                	jb     804e7d <__rodata_start+0x65>
+  804e5d:	77 72                	ja     804ed1 <__rodata_start+0xb9>
+  804e5f:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  804e66:	00 
+  804e67:	70 69                	jo     804ed2 <__rodata_start+0xba>
+  804e69:	70 65                	jo     804ed0 <__rodata_start+0xb8>
+  804e6b:	3a 20                	cmp    (%rax),%ah
+  804e6d:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  804e72:	72 6b                	jb     804edf <__rodata_start+0xc7>
+  804e74:	3a 20                	cmp    (%rax),%ah
+  804e76:	25 69 00 62 61       	and    $0x61620069,%eax
+  804e7b:	64 20 72 65          	and    %dh,%fs:0x65(%rdx)
+  804e7f:	74 75                	je     804ef6 <__rodata_start+0xde>
+  804e81:	72 6e                	jb     804ef1 <__rodata_start+0xd9>
+  804e83:	20 25 64 20 66 72    	and    %ah,0x72662064(%rip)        # 72e66eed <__bss_end+0x7265ceed>
+  804e89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e8a:	6d                   	insl   (%dx),%es:(%rdi)
+  804e8b:	20 67 65             	and    %ah,0x65(%rdi)
+  804e8e:	74 74                	je     804f04 <__rodata_start+0xec>
+  804e90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e91:	6b 65 6e 00          	imul   $0x0,0x6e(%rbp),%esp
+  804e95:	75 73                	jne    804f0a <__rodata_start+0xf2>
+  804e97:	65 72 2f             	gs jb  804ec9 <__rodata_start+0xb1>
+  804e9a:	73 68                	jae    804f04 <__rodata_start+0xec>
+  804e9c:	2e 63 00             	cs movsxd (%rax),%eax
+  804e9f:	73 70                	jae    804f11 <__rodata_start+0xf9>
+  804ea1:	61                   	(bad)
+  804ea2:	77 6e                	ja     804f12 <__rodata_start+0xfa>
+  804ea4:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0891d <__bss_end+0x251fe91d>
+  804eaa:	69 0a 00 6f 70 65    	imul   $0x65706f00,(%rdx),%ecx
+  804eb0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eb1:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0892a <__bss_end+0x251fe92a>
+  804eb7:	69 00 72 20 3d 3d    	imul   $0x3d3d2072,(%rax),%eax
+  804ebd:	20 30                	and    %dh,(%rax)
+  804ebf:	00 61 73             	add    %ah,0x73(%rcx)
+  804ec2:	73 65                	jae    804f29 <__rodata_start+0x111>
+  804ec4:	72 74                	jb     804f3a <__rodata_start+0x122>
+  804ec6:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  804ecd:	6c                   	insb   (%dx),%es:(%rdi)
+  804ece:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  804ed2:	25 73 00 24 20       	and    $0x20240073,%eax
+  804ed7:	00 23                	add    %ah,(%rbx)
+  804ed9:	20 25 73 0a 00 66    	and    %ah,0x66000a73(%rip)        # 66805952 <__bss_end+0x65ffb952>
+  804edf:	90                   	nop
+  804ee0:	73 79                	jae    804f5b <__rodata_start+0x143>
+  804ee2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ee3:	74 61                	je     804f46 <__rodata_start+0x12e>
+  804ee5:	78 20                	js     804f07 <__rodata_start+0xef>
+  804ee7:	65 72 72             	gs jb  804f5c <__rodata_start+0x144>
+  804eea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eeb:	72 3a                	jb     804f27 <__rodata_start+0x10f>
+  804eed:	20 3c 20             	and    %bh,(%rax,%riz,1)
+  804ef0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ef1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ef2:	74 20                	je     804f14 <__rodata_start+0xfc>
+  804ef4:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ef6:	6c                   	insb   (%dx),%es:(%rdi)
+  804ef7:	6c                   	insb   (%dx),%es:(%rdi)
+  804ef8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ef9:	77 65                	ja     804f60 <__rodata_start+0x148>
+  804efb:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  804eff:	20 77 6f             	and    %dh,0x6f(%rdi)
+  804f02:	72 64                	jb     804f68 <__rodata_start+0x150>
+  804f04:	0a 00                	or     (%rax),%al
+  804f06:	00 00                	add    %al,(%rax)
+  804f08:	73 79                	jae    804f83 <__rodata_start+0x16b>
+  804f0a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f0b:	74 61                	je     804f6e <__rodata_start+0x156>
+  804f0d:	78 20                	js     804f2f <__rodata_start+0x117>
+  804f0f:	65 72 72             	gs jb  804f84 <__rodata_start+0x16c>
+  804f12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f13:	72 3a                	jb     804f4f <__rodata_start+0x137>
+  804f15:	20 3e                	and    %bh,(%rsi)
+  804f17:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804f1a:	74 20                	je     804f3c <__rodata_start+0x124>
+  804f1c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f1e:	6c                   	insb   (%dx),%es:(%rdi)
+  804f1f:	6c                   	insb   (%dx),%es:(%rdi)
+  804f20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f21:	77 65                	ja     804f88 <__rodata_start+0x170>
+  804f23:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  804f27:	20 77 6f             	and    %dh,0x6f(%rdi)
+  804f2a:	72 64                	jb     804f90 <__rodata_start+0x178>
+  804f2c:	0a 00                	or     (%rax),%al
+  804f2e:	00 00                	add    %al,(%rax)
+  804f30:	75 73                	jne    804fa5 <__rodata_start+0x18d>
+  804f32:	61                   	(bad)
+  804f33:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  804f37:	73 68                	jae    804fa1 <__rodata_start+0x189>
+  804f39:	20 5b 2d             	and    %bl,0x2d(%rbx)
+  804f3c:	64 69 78 5d 20 5b 63 	imul   $0x6f635b20,%fs:0x5d(%rax),%edi
+  804f43:	6f 
+  804f44:	6d                   	insl   (%dx),%es:(%rdi)
+  804f45:	6d                   	insl   (%dx),%es:(%rdi)
+  804f46:	61                   	(bad)
+  804f47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f48:	64 2d 66 69 6c 65    	fs sub $0x656c6966,%eax
+  804f4e:	5d                   	pop    %rbp
+  804f4f:	0a 00                	or     (%rax),%al
+  804f51:	3c 63                	cmp    $0x63,%al
+  804f53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f54:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f55:	73 3e                	jae    804f95 <__rodata_start+0x17d>
+  804f57:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804f5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f5b:	73 00                	jae    804f5d <__rodata_start+0x145>
+  804f5d:	3c 75                	cmp    $0x75,%al
+  804f5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f60:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804f64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f65:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  804f6c:	78 5d                	js     804fcb <__rodata_start+0x1b3>
+  804f6e:	20 75 73             	and    %dh,0x73(%rbp)
+  804f71:	65 72 20             	gs jb  804f94 <__rodata_start+0x17c>
+  804f74:	70 61                	jo     804fd7 <__rodata_start+0x1bf>
+  804f76:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f77:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804f7e:	73 20                	jae    804fa0 <__rodata_start+0x188>
+  804f80:	61                   	(bad)
+  804f81:	74 20                	je     804fa3 <__rodata_start+0x18b>
+  804f83:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804f88:	3a 20                	cmp    (%rax),%ah
+  804f8a:	00 30                	add    %dh,(%rax)
+  804f8c:	31 32                	xor    %esi,(%rdx)
+  804f8e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804f95:	41                   	rex.B
+  804f96:	42                   	rex.X
+  804f97:	43                   	rex.XB
+  804f98:	44                   	rex.R
+  804f99:	45                   	rex.RB
+  804f9a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804f9d:	31 32                	xor    %esi,(%rdx)
+  804f9f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804fa6:	61                   	(bad)
+  804fa7:	62 63 64 65 66       	(bad)
+  804fac:	00 28                	add    %ch,(%rax)
+  804fae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804faf:	75 6c                	jne    80501d <__rodata_start+0x205>
+  804fb1:	6c                   	insb   (%dx),%es:(%rdi)
+  804fb2:	29 00                	sub    %eax,(%rax)
+  804fb4:	65 72 72             	gs jb  805029 <__rodata_start+0x211>
+  804fb7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fb8:	72 20                	jb     804fda <__rodata_start+0x1c2>
+  804fba:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804fbf:	73 70                	jae    805031 <__rodata_start+0x219>
+  804fc1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804fc5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804fcc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fcd:	72 00                	jb     804fcf <__rodata_start+0x1b7>
+  804fcf:	62 61 64 20 65       	(bad)
+  804fd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fd5:	76 69                	jbe    805040 <__rodata_start+0x228>
+  804fd7:	72 6f                	jb     805048 <__rodata_start+0x230>
+  804fd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fda:	6d                   	insl   (%dx),%es:(%rdi)
+  804fdb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804fdd:	74 00                	je     804fdf <__rodata_start+0x1c7>
+  804fdf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804fe6:	20 70 61             	and    %dh,0x61(%rax)
+  804fe9:	72 61                	jb     80504c <__rodata_start+0x234>
+  804feb:	6d                   	insl   (%dx),%es:(%rdi)
+  804fec:	65 74 65             	gs je  805054 <__rodata_start+0x23c>
+  804fef:	72 00                	jb     804ff1 <__rodata_start+0x1d9>
+  804ff1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ff2:	75 74                	jne    805068 <__rodata_start+0x250>
+  804ff4:	20 6f 66             	and    %ch,0x66(%rdi)
+  804ff7:	20 6d 65             	and    %ch,0x65(%rbp)
+  804ffa:	6d                   	insl   (%dx),%es:(%rdi)
+  804ffb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ffc:	72 79                	jb     805077 <__rodata_start+0x25f>
+  804ffe:	00 6f 75             	add    %ch,0x75(%rdi)
+  805001:	74 20                	je     805023 <__rodata_start+0x20b>
+  805003:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805004:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805008:	76 69                	jbe    805073 <__rodata_start+0x25b>
+  80500a:	72 6f                	jb     80507b <__rodata_start+0x263>
+  80500c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80500d:	6d                   	insl   (%dx),%es:(%rdi)
+  80500e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805010:	74 73                	je     805085 <__rodata_start+0x26d>
+  805012:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805015:	72 72                	jb     805089 <__rodata_start+0x271>
+  805017:	75 70                	jne    805089 <__rodata_start+0x271>
+  805019:	74 65                	je     805080 <__rodata_start+0x268>
+  80501b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805020:	75 67                	jne    805089 <__rodata_start+0x271>
+  805022:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805025:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805027:	00 73 65             	add    %dh,0x65(%rbx)
+  80502a:	67 6d                	insl   (%dx),%es:(%edi)
+  80502c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80502e:	74 61                	je     805091 <__rodata_start+0x279>
+  805030:	74 69                	je     80509b <__rodata_start+0x283>
+  805032:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805033:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805034:	20 66 61             	and    %ah,0x61(%rsi)
+  805037:	75 6c                	jne    8050a5 <__rodata_start+0x28d>
+  805039:	74 00                	je     80503b <__rodata_start+0x223>
+  80503b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805042:	20 45 4c             	and    %al,0x4c(%rbp)
+  805045:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805049:	61                   	(bad)
+  80504a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80504f:	20 73 75             	and    %dh,0x75(%rbx)
+  805052:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805055:	73 79                	jae    8050d0 <__rodata_start+0x2b8>
+  805057:	73 74                	jae    8050cd <__rodata_start+0x2b5>
+  805059:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80505b:	20 63 61             	and    %ah,0x61(%rbx)
+  80505e:	6c                   	insb   (%dx),%es:(%rdi)
+  80505f:	6c                   	insb   (%dx),%es:(%rdi)
+  805060:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805063:	74 72                	je     8050d7 <__rodata_start+0x2bf>
+  805065:	79 20                	jns    805087 <__rodata_start+0x26f>
+  805067:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805068:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805069:	74 20                	je     80508b <__rodata_start+0x273>
+  80506b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80506d:	75 6e                	jne    8050dd <__rodata_start+0x2c5>
+  80506f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805073:	76 20                	jbe    805095 <__rodata_start+0x27d>
+  805075:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80507c:	72 65                	jb     8050e3 <__rodata_start+0x2cb>
+  80507e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805081:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805082:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805086:	65 78 70             	gs js  8050f9 <__rodata_start+0x2e1>
+  805089:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80508e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805091:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805095:	20 66 69             	and    %ah,0x69(%rsi)
+  805098:	6c                   	insb   (%dx),%es:(%rdi)
+  805099:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80509d:	20 66 72             	and    %ah,0x72(%rsi)
+  8050a0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8050a5:	61                   	(bad)
+  8050a6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8050a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050ab:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8050af:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8050b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050b4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8050b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050b8:	79 20                	jns    8050da <__rodata_start+0x2c2>
+  8050ba:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8050c1:	72 65                	jb     805128 <__rodata_start+0x310>
+  8050c3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8050c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8050c8:	00 66 69             	add    %ah,0x69(%rsi)
+  8050cb:	6c                   	insb   (%dx),%es:(%rdi)
+  8050cc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8050d0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8050d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050d4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8050d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050d9:	74 20                	je     8050fb <__rodata_start+0x2e3>
+  8050db:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8050dd:	75 6e                	jne    80514d <__rodata_start+0x335>
+  8050df:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8050e3:	76 61                	jbe    805146 <__rodata_start+0x32e>
+  8050e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8050e6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8050ed:	00 
+  8050ee:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8050f5:	72 65                	jb     80515c <__rodata_start+0x344>
+  8050f7:	61                   	(bad)
+  8050f8:	64 79 20             	fs jns 80511b <__rodata_start+0x303>
+  8050fb:	65 78 69             	gs js  805167 <__rodata_start+0x34f>
+  8050fe:	73 74                	jae    805174 <__rodata_start+0x35c>
+  805100:	73 00                	jae    805102 <__rodata_start+0x2ea>
+  805102:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805103:	70 65                	jo     80516a <__rodata_start+0x352>
+  805105:	72 61                	jb     805168 <__rodata_start+0x350>
+  805107:	74 69                	je     805172 <__rodata_start+0x35a>
+  805109:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80510a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80510b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80510e:	74 20                	je     805130 <__rodata_start+0x318>
+  805110:	73 75                	jae    805187 <__rodata_start+0x36f>
+  805112:	70 70                	jo     805184 <__rodata_start+0x36c>
+  805114:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805115:	72 74                	jb     80518b <__rodata_start+0x373>
+  805117:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80511d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  805122:	74 00                	je     805124 <__rodata_start+0x30c>
+  805124:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80512b:	00 00 00 
+  80512e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805135:	00 00 00 
+  805138:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80513f:	00 
+  805140:	bf 0e 80 00 00       	mov    $0x800e,%edi
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 00                	add    %al,(%rax)
+  805149:	15 80 00 00 00       	adc    $0x80,%eax
+  80514e:	00 00                	add    %al,(%rax)
+  805150:	f0 14 80             	lock adc $0x80,%al
+  805153:	00 00                	add    %al,(%rax)
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 00                	add    %al,(%rax)
+  805159:	15 80 00 00 00       	adc    $0x80,%eax
+  80515e:	00 00                	add    %al,(%rax)
+  805160:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8051e6 <__rodata_start+0x3ce>
+  805166:	00 00                	add    %al,(%rax)
+  805168:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8051ee <__rodata_start+0x3d6>
+  80516e:	00 00                	add    %al,(%rax)
+  805170:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8051f6 <__rodata_start+0x3de>
+  805176:	00 00                	add    %al,(%rax)
+  805178:	de 0e                	fimuls (%rsi)
+  80517a:	80 00 00             	addb   $0x0,(%rax)
+  80517d:	00 00                	add    %al,(%rax)
+  80517f:	00 00                	add    %al,(%rax)
+  805181:	15 80 00 00 00       	adc    $0x80,%eax
+  805186:	00 00                	add    %al,(%rax)
+  805188:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80520e <__rodata_start+0x3f6>
+  80518e:	00 00                	add    %al,(%rax)
+  805190:	d2 0e                	rorb   %cl,(%rsi)
+  805192:	80 00 00             	addb   $0x0,(%rax)
+  805195:	00 00                	add    %al,(%rax)
+  805197:	00 4c 0f 80          	add    %cl,-0x80(%rdi,%rcx,1)
+  80519b:	00 00                	add    %al,(%rax)
+  80519d:	00 00                	add    %al,(%rax)
+  80519f:	00 00                	add    %al,(%rax)
+  8051a1:	15 80 00 00 00       	adc    $0x80,%eax
+  8051a6:	00 00                	add    %al,(%rax)
+  8051a8:	d2 0e                	rorb   %cl,(%rsi)
+  8051aa:	80 00 00             	addb   $0x0,(%rax)
+  8051ad:	00 00                	add    %al,(%rax)
+  8051af:	00 18                	add    %bl,(%rax)
+  8051b1:	0f 80 00 00 00 00    	jo     8051b7 <__rodata_start+0x39f>
+  8051b7:	00 18                	add    %bl,(%rax)
+  8051b9:	0f 80 00 00 00 00    	jo     8051bf <__rodata_start+0x3a7>
+  8051bf:	00 18                	add    %bl,(%rax)
+  8051c1:	0f 80 00 00 00 00    	jo     8051c7 <__rodata_start+0x3af>
+  8051c7:	00 18                	add    %bl,(%rax)
+  8051c9:	0f 80 00 00 00 00    	jo     8051cf <__rodata_start+0x3b7>
+  8051cf:	00 18                	add    %bl,(%rax)
+  8051d1:	0f 80 00 00 00 00    	jo     8051d7 <__rodata_start+0x3bf>
+  8051d7:	00 18                	add    %bl,(%rax)
+  8051d9:	0f 80 00 00 00 00    	jo     8051df <__rodata_start+0x3c7>
+  8051df:	00 18                	add    %bl,(%rax)
+  8051e1:	0f 80 00 00 00 00    	jo     8051e7 <__rodata_start+0x3cf>
+  8051e7:	00 18                	add    %bl,(%rax)
+  8051e9:	0f 80 00 00 00 00    	jo     8051ef <__rodata_start+0x3d7>
+  8051ef:	00 18                	add    %bl,(%rax)
+  8051f1:	0f 80 00 00 00 00    	jo     8051f7 <__rodata_start+0x3df>
+  8051f7:	00 00                	add    %al,(%rax)
+  8051f9:	15 80 00 00 00       	adc    $0x80,%eax
+  8051fe:	00 00                	add    %al,(%rax)
+  805200:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805286 <__rodata_start+0x46e>
+  805206:	00 00                	add    %al,(%rax)
+  805208:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80528e <__rodata_start+0x476>
+  80520e:	00 00                	add    %al,(%rax)
+  805210:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805296 <__rodata_start+0x47e>
+  805216:	00 00                	add    %al,(%rax)
+  805218:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80529e <__rodata_start+0x486>
+  80521e:	00 00                	add    %al,(%rax)
+  805220:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052a6 <__rodata_start+0x48e>
+  805226:	00 00                	add    %al,(%rax)
+  805228:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052ae <__rodata_start+0x496>
+  80522e:	00 00                	add    %al,(%rax)
+  805230:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052b6 <__rodata_start+0x49e>
+  805236:	00 00                	add    %al,(%rax)
+  805238:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052be <__rodata_start+0x4a6>
+  80523e:	00 00                	add    %al,(%rax)
+  805240:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052c6 <__rodata_start+0x4ae>
+  805246:	00 00                	add    %al,(%rax)
+  805248:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052ce <__rodata_start+0x4b6>
+  80524e:	00 00                	add    %al,(%rax)
+  805250:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052d6 <__rodata_start+0x4be>
+  805256:	00 00                	add    %al,(%rax)
+  805258:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052de <__rodata_start+0x4c6>
+  80525e:	00 00                	add    %al,(%rax)
+  805260:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052e6 <__rodata_start+0x4ce>
+  805266:	00 00                	add    %al,(%rax)
+  805268:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052ee <__rodata_start+0x4d6>
+  80526e:	00 00                	add    %al,(%rax)
+  805270:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052f6 <__rodata_start+0x4de>
+  805276:	00 00                	add    %al,(%rax)
+  805278:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8052fe <__rodata_start+0x4e6>
+  80527e:	00 00                	add    %al,(%rax)
+  805280:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805306 <__rodata_start+0x4ee>
+  805286:	00 00                	add    %al,(%rax)
+  805288:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80530e <__rodata_start+0x4f6>
+  80528e:	00 00                	add    %al,(%rax)
+  805290:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805316 <__rodata_start+0x4fe>
+  805296:	00 00                	add    %al,(%rax)
+  805298:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80531e <__rodata_start+0x506>
+  80529e:	00 00                	add    %al,(%rax)
+  8052a0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805326 <__rodata_start+0x50e>
+  8052a6:	00 00                	add    %al,(%rax)
+  8052a8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80532e <__rodata_start+0x516>
+  8052ae:	00 00                	add    %al,(%rax)
+  8052b0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805336 <__rodata_start+0x51e>
+  8052b6:	00 00                	add    %al,(%rax)
+  8052b8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80533e <__rodata_start+0x526>
+  8052be:	00 00                	add    %al,(%rax)
+  8052c0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805346 <__rodata_start+0x52e>
+  8052c6:	00 00                	add    %al,(%rax)
+  8052c8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80534e <__rodata_start+0x536>
+  8052ce:	00 00                	add    %al,(%rax)
+  8052d0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805356 <__rodata_start+0x53e>
+  8052d6:	00 00                	add    %al,(%rax)
+  8052d8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80535e <__rodata_start+0x546>
+  8052de:	00 00                	add    %al,(%rax)
+  8052e0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805366 <__rodata_start+0x54e>
+  8052e6:	00 00                	add    %al,(%rax)
+  8052e8:	23 14 80             	and    (%rax,%rax,4),%edx
+  8052eb:	00 00                	add    %al,(%rax)
+  8052ed:	00 00                	add    %al,(%rax)
+  8052ef:	00 00                	add    %al,(%rax)
+  8052f1:	15 80 00 00 00       	adc    $0x80,%eax
+  8052f6:	00 00                	add    %al,(%rax)
+  8052f8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80537e <__rodata_start+0x566>
+  8052fe:	00 00                	add    %al,(%rax)
+  805300:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805386 <__rodata_start+0x56e>
+  805306:	00 00                	add    %al,(%rax)
+  805308:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80538e <__rodata_start+0x576>
+  80530e:	00 00                	add    %al,(%rax)
+  805310:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805396 <__rodata_start+0x57e>
+  805316:	00 00                	add    %al,(%rax)
+  805318:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80539e <__rodata_start+0x586>
+  80531e:	00 00                	add    %al,(%rax)
+  805320:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053a6 <__rodata_start+0x58e>
+  805326:	00 00                	add    %al,(%rax)
+  805328:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053ae <__rodata_start+0x596>
+  80532e:	00 00                	add    %al,(%rax)
+  805330:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053b6 <__rodata_start+0x59e>
+  805336:	00 00                	add    %al,(%rax)
+  805338:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053be <__rodata_start+0x5a6>
+  80533e:	00 00                	add    %al,(%rax)
+  805340:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805341:	0f 80 00 00 00 00    	jo     805347 <__rodata_start+0x52f>
+  805347:	00 3e                	add    %bh,(%rsi)
+  805349:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80534f:	00 00                	add    %al,(%rax)
+  805351:	15 80 00 00 00       	adc    $0x80,%eax
+  805356:	00 00                	add    %al,(%rax)
+  805358:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053de <__rodata_start+0x5c6>
+  80535e:	00 00                	add    %al,(%rax)
+  805360:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053e6 <__rodata_start+0x5ce>
+  805366:	00 00                	add    %al,(%rax)
+  805368:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 8053ee <__rodata_start+0x5d6>
+  80536e:	00 00                	add    %al,(%rax)
+  805370:	9e                   	sahf
+  805371:	0f 80 00 00 00 00    	jo     805377 <__rodata_start+0x55f>
+  805377:	00 00                	add    %al,(%rax)
+  805379:	15 80 00 00 00       	adc    $0x80,%eax
+  80537e:	00 00                	add    %al,(%rax)
+  805380:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805406 <error_string+0x6>
+  805386:	00 00                	add    %al,(%rax)
+  805388:	64 0f 80 00 00 00 00 	fs jo  80538f <__rodata_start+0x577>
+  80538f:	00 00                	add    %al,(%rax)
+  805391:	15 80 00 00 00       	adc    $0x80,%eax
+  805396:	00 00                	add    %al,(%rax)
+  805398:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80541e <error_string+0x1e>
+  80539e:	00 00                	add    %al,(%rax)
+  8053a0:	e6 12                	out    %al,$0x12
+  8053a2:	80 00 00             	addb   $0x0,(%rax)
+  8053a5:	00 00                	add    %al,(%rax)
+  8053a7:	00 b0 13 80 00 00    	add    %dh,0x8013(%rax)
+  8053ad:	00 00                	add    %al,(%rax)
+  8053af:	00 00                	add    %al,(%rax)
+  8053b1:	15 80 00 00 00       	adc    $0x80,%eax
+  8053b6:	00 00                	add    %al,(%rax)
+  8053b8:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 80543e <error_string+0x3e>
+  8053be:	00 00                	add    %al,(%rax)
+  8053c0:	35 10 80 00 00       	xor    $0x8010,%eax
+  8053c5:	00 00                	add    %al,(%rax)
+  8053c7:	00 00                	add    %al,(%rax)
+  8053c9:	15 80 00 00 00       	adc    $0x80,%eax
+  8053ce:	00 00                	add    %al,(%rax)
+  8053d0:	12 12                	adc    (%rdx),%dl
+  8053d2:	80 00 00             	addb   $0x0,(%rax)
+  8053d5:	00 00                	add    %al,(%rax)
+  8053d7:	00 00                	add    %al,(%rax)
+  8053d9:	15 80 00 00 00       	adc    $0x80,%eax
+  8053de:	00 00                	add    %al,(%rax)
+  8053e0:	00 15 80 00 00 00    	add    %dl,0x80(%rip)        # 805466 <error_string+0x66>
+  8053e6:	00 00                	add    %al,(%rax)
+  8053e8:	23 14 80             	and    (%rax,%rax,4),%edx
+  8053eb:	00 00                	add    %al,(%rax)
+  8053ed:	00 00                	add    %al,(%rax)
+  8053ef:	00 00                	add    %al,(%rax)
+  8053f1:	15 80 00 00 00       	adc    $0x80,%eax
+  8053f6:	00 00                	add    %al,(%rax)
+  8053f8:	c8 0e 80 00          	enter  $0x800e,$0x0
+  8053fc:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805400 <error_string>:
+	...
+  805408:	bd 4f 80 00 00 00 00 00 cf 4f 80 00 00 00 00 00     .O.......O......
+  805418:	df 4f 80 00 00 00 00 00 f1 4f 80 00 00 00 00 00     .O.......O......
+  805428:	ff 4f 80 00 00 00 00 00 13 50 80 00 00 00 00 00     .O.......P......
+  805438:	28 50 80 00 00 00 00 00 3b 50 80 00 00 00 00 00     (P......;P......
+  805448:	4d 50 80 00 00 00 00 00 61 50 80 00 00 00 00 00     MP......aP......
+  805458:	71 50 80 00 00 00 00 00 84 50 80 00 00 00 00 00     qP.......P......
+  805468:	9b 50 80 00 00 00 00 00 b1 50 80 00 00 00 00 00     .P.......P......
+  805478:	c9 50 80 00 00 00 00 00 e1 50 80 00 00 00 00 00     .P.......P......
+  805488:	ee 50 80 00 00 00 00 00 a8 54 80 00 00 00 00 00     .P.......T......
+  805498:	02 51 80 00 00 00 00 00 1a 51 80 00 00 00 00 00     .Q.......Q......
+  8054a8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8054b8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 72     lid executable.r
+  8054c8:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 90     ead error: %i...
+  8054d8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8054e8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8054f8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805508:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805518:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805528:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805538:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805548:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  805558:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  805568:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  805578:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805588:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805598:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8055a8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8055b8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8055c8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d8:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008055e0 <devtab>:
+  8055e0:	a0 60 80 00 00 00 00 00 40 61 80 00 00 00 00 00     .`......@a......
+  8055f0:	00 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805600:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805610:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805620:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805630:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805640:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805650:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805660:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  805670:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  805680:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  805690:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  8056a0:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  8056b0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  8056c0:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  8056d0:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  8056e0:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  8056f0:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  805700:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  805710:	77 61 6e 74 20 25 30 38 78 0a 00 6c 69 62 2f 73     want %08x..lib/s
+  805720:	70 61 77 6e 2e 63 00 6d 61 70 5f 73 65 67 6d 65     pawn.c.map_segme
+  805730:	6e 74 2e 73 65 65 6b 20 66 61 69 6c 65 64 3a 20     nt.seek failed: 
+  805740:	25 69 0a 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e     %i..map_segment.
+  805750:	72 65 61 64 6e 20 66 61 69 6c 65 64 3a 20 25 69     readn failed: %i
+  805760:	0a 00 63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65     ..copy_shared_re
+  805770:	67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76     gion: %i.sys_env
+  805780:	5f 73 65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20     _set_trapframe: 
+  805790:	25 69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73     %i.sys_env_set_s
+  8057a0:	74 61 74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e     tatus: %i.<pipe>
+  8057b0:	00 6c 69 62 2f 70 69 70 65 2e 63 00 70 69 70 65     .lib/pipe.c.pipe
+  8057c0:	00 0f 1f 80 00 00 00 00 73 79 73 5f 72 65 67 69     ........sys_regi
+  8057d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8057e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  8057f0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805800:	63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72     c.ipc_send error
+  805810:	3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00     : %i..lib/ipc.c.
+  805820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
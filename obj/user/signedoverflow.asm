@@ -0,0 +1,6870 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf 98 36 80 00 00 	movabs $0x803698,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba c9 01 80 00 00 	movabs $0x8001c9,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	41 89 fd             	mov    %edi,%r13d
+  800059:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005c:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800063:	00 00 00 
+  800066:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80006d:	00 00 00 
+  800070:	48 39 c2             	cmp    %rax,%rdx
+  800073:	73 17                	jae    80008c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800075:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800078:	49 89 c4             	mov    %rax,%r12
+  80007b:	48 83 c3 08          	add    $0x8,%rbx
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	ff 53 f8             	call   *-0x8(%rbx)
+  800087:	4c 39 e3             	cmp    %r12,%rbx
+  80008a:	72 ef                	jb     80007b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008c:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  800093:	00 00 00 
+  800096:	ff d0                	call   *%rax
+  800098:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000a1:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000a5:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 01 d0             	add    %rdx,%rax
+  8000b6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c0:	45 85 ed             	test   %r13d,%r13d
+  8000c3:	7e 0d                	jle    8000d2 <libmain+0x87>
+  8000c5:	49 8b 06             	mov    (%r14),%rax
+  8000c8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000cf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d2:	4c 89 f6             	mov    %r14,%rsi
+  8000d5:	44 89 ef             	mov    %r13d,%edi
+  8000d8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e4:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	5b                   	pop    %rbx
+  8000f1:	41 5c                	pop    %r12
+  8000f3:	41 5d                	pop    %r13
+  8000f5:	41 5e                	pop    %r14
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fd:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 4f 10 80 00 00 	movabs $0x80104f,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+
+000000000080011c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80011c:	55                   	push   %rbp
+  80011d:	48 89 e5             	mov    %rsp,%rbp
+  800120:	53                   	push   %rbx
+  800121:	48 83 ec 08          	sub    $0x8,%rsp
+  800125:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800128:	8b 06                	mov    (%rsi),%eax
+  80012a:	8d 50 01             	lea    0x1(%rax),%edx
+  80012d:	89 16                	mov    %edx,(%rsi)
+  80012f:	48 98                	cltq
+  800131:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800136:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80013c:	74 0a                	je     800148 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80013e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800142:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800146:	c9                   	leave
+  800147:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800148:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80014c:	be ff 00 00 00       	mov    $0xff,%esi
+  800151:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800163:	eb d9                	jmp    80013e <putch+0x22>
+
+0000000000800165 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800165:	55                   	push   %rbp
+  800166:	48 89 e5             	mov    %rsp,%rbp
+  800169:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800170:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800173:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800184:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800187:	48 89 f1             	mov    %rsi,%rcx
+  80018a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800191:	48 bf 1c 01 80 00 00 	movabs $0x80011c,%rdi
+  800198:	00 00 00 
+  80019b:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ae:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b5:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  8001bc:	00 00 00 
+  8001bf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c7:	c9                   	leave
+  8001c8:	c3                   	ret
+
+00000000008001c9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001fc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800200:	48 b8 65 01 80 00 00 	movabs $0x800165,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	41 57                	push   %r15
+  800214:	41 56                	push   %r14
+  800216:	41 55                	push   %r13
+  800218:	41 54                	push   %r12
+  80021a:	53                   	push   %rbx
+  80021b:	48 83 ec 18          	sub    $0x18,%rsp
+  80021f:	49 89 fc             	mov    %rdi,%r12
+  800222:	49 89 f5             	mov    %rsi,%r13
+  800225:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800229:	8b 45 10             	mov    0x10(%rbp),%eax
+  80022c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022f:	41 89 cf             	mov    %ecx,%r15d
+  800232:	4c 39 fa             	cmp    %r15,%rdx
+  800235:	73 5b                	jae    800292 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800237:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80023b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023f:	85 db                	test   %ebx,%ebx
+  800241:	7e 0e                	jle    800251 <print_num+0x43>
+            putch(padc, put_arg);
+  800243:	4c 89 ee             	mov    %r13,%rsi
+  800246:	44 89 f7             	mov    %r14d,%edi
+  800249:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80024c:	83 eb 01             	sub    $0x1,%ebx
+  80024f:	75 f2                	jne    800243 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800251:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800255:	48 b9 b7 36 80 00 00 	movabs $0x8036b7,%rcx
+  80025c:	00 00 00 
+  80025f:	48 b8 a6 36 80 00 00 	movabs $0x8036a6,%rax
+  800266:	00 00 00 
+  800269:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800271:	ba 00 00 00 00       	mov    $0x0,%edx
+  800276:	49 f7 f7             	div    %r15
+  800279:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027d:	4c 89 ee             	mov    %r13,%rsi
+  800280:	41 ff d4             	call   *%r12
+}
+  800283:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800287:	5b                   	pop    %rbx
+  800288:	41 5c                	pop    %r12
+  80028a:	41 5d                	pop    %r13
+  80028c:	41 5e                	pop    %r14
+  80028e:	41 5f                	pop    %r15
+  800290:	5d                   	pop    %rbp
+  800291:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800292:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029b:	49 f7 f7             	div    %r15
+  80029e:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a6:	52                   	push   %rdx
+  8002a7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ab:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002af:	48 89 c2             	mov    %rax,%rdx
+  8002b2:	48 b8 0e 02 80 00 00 	movabs $0x80020e,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+  8002be:	48 83 c4 10          	add    $0x10,%rsp
+  8002c2:	eb 8d                	jmp    800251 <print_num+0x43>
+
+00000000008002c4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c8:	48 8b 06             	mov    (%rsi),%rax
+  8002cb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002cf:	73 0a                	jae    8002db <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d5:	48 89 16             	mov    %rdx,(%rsi)
+  8002d8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002db:	c3                   	ret
+
+00000000008002dc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002dc:	55                   	push   %rbp
+  8002dd:	48 89 e5             	mov    %rsp,%rbp
+  8002e0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800303:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800307:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80030b:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  800312:	00 00 00 
+  800315:	ff d0                	call   *%rax
+}
+  800317:	c9                   	leave
+  800318:	c3                   	ret
+
+0000000000800319 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800319:	55                   	push   %rbp
+  80031a:	48 89 e5             	mov    %rsp,%rbp
+  80031d:	41 57                	push   %r15
+  80031f:	41 56                	push   %r14
+  800321:	41 55                	push   %r13
+  800323:	41 54                	push   %r12
+  800325:	53                   	push   %rbx
+  800326:	48 83 ec 38          	sub    $0x38,%rsp
+  80032a:	49 89 fe             	mov    %rdi,%r14
+  80032d:	49 89 f5             	mov    %rsi,%r13
+  800330:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800333:	48 8b 01             	mov    (%rcx),%rax
+  800336:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80033e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800342:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800346:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80034e:	0f b6 3b             	movzbl (%rbx),%edi
+  800351:	40 80 ff 25          	cmp    $0x25,%dil
+  800355:	74 18                	je     80036f <vprintfmt+0x56>
+            if (!ch) return;
+  800357:	40 84 ff             	test   %dil,%dil
+  80035a:	0f 84 b1 06 00 00    	je     800a11 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800360:	40 0f b6 ff          	movzbl %dil,%edi
+  800364:	4c 89 ee             	mov    %r13,%rsi
+  800367:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036a:	4c 89 e3             	mov    %r12,%rbx
+  80036d:	eb db                	jmp    80034a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036f:	be 00 00 00 00       	mov    $0x0,%esi
+  800374:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800378:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800383:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80038e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800393:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800398:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80039b:	83 e8 23             	sub    $0x23,%eax
+  80039e:	3c 57                	cmp    $0x57,%al
+  8003a0:	0f 87 51 06 00 00    	ja     8009f7 <vprintfmt+0x6de>
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+  8003a9:	48 b9 40 38 80 00 00 	movabs $0x803840,%rcx
+  8003b0:	00 00 00 
+  8003b3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003bd:	eb cf                	jmp    80038e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003bf:	49 89 dc             	mov    %rbx,%r12
+  8003c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c7:	eb c5                	jmp    80038e <vprintfmt+0x75>
+            padc = ch;
+  8003c9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003cd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d3:	eb b9                	jmp    80038e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003db:	77 24                	ja     800401 <vprintfmt+0xe8>
+  8003dd:	89 c1                	mov    %eax,%ecx
+  8003df:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e3:	83 c0 08             	add    $0x8,%eax
+  8003e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003ec:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f3:	79 99                	jns    80038e <vprintfmt+0x75>
+                width = precision;
+  8003f5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003ff:	eb 8d                	jmp    80038e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800401:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800405:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800409:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040d:	eb da                	jmp    8003e9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800414:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800418:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80041e:	3c 39                	cmp    $0x39,%al
+  800420:	77 1c                	ja     80043e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800422:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800426:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042a:	0f b6 c0             	movzbl %al,%eax
+  80042d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800432:	0f b6 03             	movzbl (%rbx),%eax
+  800435:	3c 39                	cmp    $0x39,%al
+  800437:	76 e9                	jbe    800422 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800439:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80043c:	eb b1                	jmp    8003ef <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80043e:	49 89 dc             	mov    %rbx,%r12
+  800441:	eb ac                	jmp    8003ef <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800443:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800446:	85 c9                	test   %ecx,%ecx
+  800448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044d:	0f 49 c1             	cmovns %ecx,%eax
+  800450:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800453:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800456:	e9 33 ff ff ff       	jmp    80038e <vprintfmt+0x75>
+            lflag++;
+  80045b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800461:	e9 28 ff ff ff       	jmp    80038e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800466:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800469:	83 f8 2f             	cmp    $0x2f,%eax
+  80046c:	77 19                	ja     800487 <vprintfmt+0x16e>
+  80046e:	89 c2                	mov    %eax,%edx
+  800470:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800474:	83 c0 08             	add    $0x8,%eax
+  800477:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047a:	8b 3a                	mov    (%rdx),%edi
+  80047c:	4c 89 ee             	mov    %r13,%rsi
+  80047f:	41 ff d6             	call   *%r14
+            break;
+  800482:	e9 c3 fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800487:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80048b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800493:	eb e5                	jmp    80047a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800495:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800498:	83 f8 2f             	cmp    $0x2f,%eax
+  80049b:	77 5a                	ja     8004f7 <vprintfmt+0x1de>
+  80049d:	89 c2                	mov    %eax,%edx
+  80049f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a3:	83 c0 08             	add    $0x8,%eax
+  8004a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a9:	8b 02                	mov    (%rdx),%eax
+  8004ab:	89 c1                	mov    %eax,%ecx
+  8004ad:	f7 d9                	neg    %ecx
+  8004af:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b2:	83 f9 14             	cmp    $0x14,%ecx
+  8004b5:	7f 4e                	jg     800505 <vprintfmt+0x1ec>
+  8004b7:	48 63 c1             	movslq %ecx,%rax
+  8004ba:	48 ba 00 3b 80 00 00 	movabs $0x803b00,%rdx
+  8004c1:	00 00 00 
+  8004c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c8:	48 85 c0             	test   %rax,%rax
+  8004cb:	74 38                	je     800505 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004cd:	48 89 c1             	mov    %rax,%rcx
+  8004d0:	48 ba d9 3c 80 00 00 	movabs $0x803cd9,%rdx
+  8004d7:	00 00 00 
+  8004da:	4c 89 ee             	mov    %r13,%rsi
+  8004dd:	4c 89 f7             	mov    %r14,%rdi
+  8004e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e5:	49 b8 dc 02 80 00 00 	movabs $0x8002dc,%r8
+  8004ec:	00 00 00 
+  8004ef:	41 ff d0             	call   *%r8
+  8004f2:	e9 53 fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800503:	eb a4                	jmp    8004a9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800505:	48 ba cf 36 80 00 00 	movabs $0x8036cf,%rdx
+  80050c:	00 00 00 
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	4c 89 f7             	mov    %r14,%rdi
+  800515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051a:	49 b8 dc 02 80 00 00 	movabs $0x8002dc,%r8
+  800521:	00 00 00 
+  800524:	41 ff d0             	call   *%r8
+  800527:	e9 1e fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80052c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052f:	83 f8 2f             	cmp    $0x2f,%eax
+  800532:	77 6c                	ja     8005a0 <vprintfmt+0x287>
+  800534:	89 c2                	mov    %eax,%edx
+  800536:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053a:	83 c0 08             	add    $0x8,%eax
+  80053d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800540:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800543:	48 85 d2             	test   %rdx,%rdx
+  800546:	48 b8 c8 36 80 00 00 	movabs $0x8036c8,%rax
+  80054d:	00 00 00 
+  800550:	48 0f 45 c2          	cmovne %rdx,%rax
+  800554:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800558:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055c:	7e 06                	jle    800564 <vprintfmt+0x24b>
+  80055e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800562:	75 4a                	jne    8005ae <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800564:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800568:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80056c:	0f b6 00             	movzbl (%rax),%eax
+  80056f:	84 c0                	test   %al,%al
+  800571:	0f 85 9a 00 00 00    	jne    800611 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800577:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80057a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80057e:	85 c0                	test   %eax,%eax
+  800580:	0f 8e c4 fd ff ff    	jle    80034a <vprintfmt+0x31>
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	bf 20 00 00 00       	mov    $0x20,%edi
+  80058e:	41 ff d6             	call   *%r14
+  800591:	41 83 ec 01          	sub    $0x1,%r12d
+  800595:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800599:	75 eb                	jne    800586 <vprintfmt+0x26d>
+  80059b:	e9 aa fd ff ff       	jmp    80034a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ac:	eb 92                	jmp    800540 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ae:	49 63 f7             	movslq %r15d,%rsi
+  8005b1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b5:	48 b8 cb 0a 80 00 00 	movabs $0x800acb,%rax
+  8005bc:	00 00 00 
+  8005bf:	ff d0                	call   *%rax
+  8005c1:	48 89 c2             	mov    %rax,%rdx
+  8005c4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005cc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005cf:	85 c0                	test   %eax,%eax
+  8005d1:	7e 91                	jle    800564 <vprintfmt+0x24b>
+  8005d3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d8:	4c 89 ee             	mov    %r13,%rsi
+  8005db:	44 89 e7             	mov    %r12d,%edi
+  8005de:	41 ff d6             	call   *%r14
+  8005e1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005eb:	75 eb                	jne    8005d8 <vprintfmt+0x2bf>
+  8005ed:	e9 72 ff ff ff       	jmp    800564 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f2:	0f b6 f8             	movzbl %al,%edi
+  8005f5:	4c 89 ee             	mov    %r13,%rsi
+  8005f8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ff:	49 83 c4 01          	add    $0x1,%r12
+  800603:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800609:	84 c0                	test   %al,%al
+  80060b:	0f 84 66 ff ff ff    	je     800577 <vprintfmt+0x25e>
+  800611:	45 85 ff             	test   %r15d,%r15d
+  800614:	78 0a                	js     800620 <vprintfmt+0x307>
+  800616:	41 83 ef 01          	sub    $0x1,%r15d
+  80061a:	0f 88 57 ff ff ff    	js     800577 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800620:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800624:	74 cc                	je     8005f2 <vprintfmt+0x2d9>
+  800626:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800629:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80062e:	80 fa 5e             	cmp    $0x5e,%dl
+  800631:	77 c2                	ja     8005f5 <vprintfmt+0x2dc>
+  800633:	eb bd                	jmp    8005f2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800635:	40 84 f6             	test   %sil,%sil
+  800638:	75 26                	jne    800660 <vprintfmt+0x347>
+    switch (lflag) {
+  80063a:	85 d2                	test   %edx,%edx
+  80063c:	74 59                	je     800697 <vprintfmt+0x37e>
+  80063e:	83 fa 01             	cmp    $0x1,%edx
+  800641:	74 7b                	je     8006be <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800643:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800646:	83 f8 2f             	cmp    $0x2f,%eax
+  800649:	0f 87 96 00 00 00    	ja     8006e5 <vprintfmt+0x3cc>
+  80064f:	89 c2                	mov    %eax,%edx
+  800651:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800655:	83 c0 08             	add    $0x8,%eax
+  800658:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065b:	4c 8b 22             	mov    (%rdx),%r12
+  80065e:	eb 17                	jmp    800677 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800660:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800663:	83 f8 2f             	cmp    $0x2f,%eax
+  800666:	77 21                	ja     800689 <vprintfmt+0x370>
+  800668:	89 c2                	mov    %eax,%edx
+  80066a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066e:	83 c0 08             	add    $0x8,%eax
+  800671:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800674:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800677:	4d 85 e4             	test   %r12,%r12
+  80067a:	78 7a                	js     8006f6 <vprintfmt+0x3dd>
+            num = i;
+  80067c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800684:	e9 50 02 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800689:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800691:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800695:	eb dd                	jmp    800674 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800697:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069a:	83 f8 2f             	cmp    $0x2f,%eax
+  80069d:	77 11                	ja     8006b0 <vprintfmt+0x397>
+  80069f:	89 c2                	mov    %eax,%edx
+  8006a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a5:	83 c0 08             	add    $0x8,%eax
+  8006a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ab:	4c 63 22             	movslq (%rdx),%r12
+  8006ae:	eb c7                	jmp    800677 <vprintfmt+0x35e>
+  8006b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bc:	eb ed                	jmp    8006ab <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c4:	77 11                	ja     8006d7 <vprintfmt+0x3be>
+  8006c6:	89 c2                	mov    %eax,%edx
+  8006c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006cc:	83 c0 08             	add    $0x8,%eax
+  8006cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d2:	4c 8b 22             	mov    (%rdx),%r12
+  8006d5:	eb a0                	jmp    800677 <vprintfmt+0x35e>
+  8006d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e3:	eb ed                	jmp    8006d2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f1:	e9 65 ff ff ff       	jmp    80065b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f6:	4c 89 ee             	mov    %r13,%rsi
+  8006f9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006fe:	41 ff d6             	call   *%r14
+                i = -i;
+  800701:	49 f7 dc             	neg    %r12
+  800704:	e9 73 ff ff ff       	jmp    80067c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800709:	40 84 f6             	test   %sil,%sil
+  80070c:	75 32                	jne    800740 <vprintfmt+0x427>
+    switch (lflag) {
+  80070e:	85 d2                	test   %edx,%edx
+  800710:	74 5d                	je     80076f <vprintfmt+0x456>
+  800712:	83 fa 01             	cmp    $0x1,%edx
+  800715:	0f 84 82 00 00 00    	je     80079d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80071b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071e:	83 f8 2f             	cmp    $0x2f,%eax
+  800721:	0f 87 a5 00 00 00    	ja     8007cc <vprintfmt+0x4b3>
+  800727:	89 c2                	mov    %eax,%edx
+  800729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072d:	83 c0 08             	add    $0x8,%eax
+  800730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800733:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80073b:	e9 99 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	77 19                	ja     800761 <vprintfmt+0x448>
+  800748:	89 c2                	mov    %eax,%edx
+  80074a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074e:	83 c0 08             	add    $0x8,%eax
+  800751:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800754:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800757:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80075c:	e9 78 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  800761:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800765:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076d:	eb e5                	jmp    800754 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80076f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800772:	83 f8 2f             	cmp    $0x2f,%eax
+  800775:	77 18                	ja     80078f <vprintfmt+0x476>
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077d:	83 c0 08             	add    $0x8,%eax
+  800780:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800783:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800785:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80078a:	e9 4a 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  80078f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079b:	eb e6                	jmp    800783 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80079d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a3:	77 19                	ja     8007be <vprintfmt+0x4a5>
+  8007a5:	89 c2                	mov    %eax,%edx
+  8007a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ab:	83 c0 08             	add    $0x8,%eax
+  8007ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b9:	e9 1b 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  8007be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ca:	eb e5                	jmp    8007b1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	e9 56 ff ff ff       	jmp    800733 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007dd:	40 84 f6             	test   %sil,%sil
+  8007e0:	75 2e                	jne    800810 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e2:	85 d2                	test   %edx,%edx
+  8007e4:	74 59                	je     80083f <vprintfmt+0x526>
+  8007e6:	83 fa 01             	cmp    $0x1,%edx
+  8007e9:	74 7f                	je     80086a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f1:	0f 87 9f 00 00 00    	ja     800896 <vprintfmt+0x57d>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fd:	83 c0 08             	add    $0x8,%eax
+  800800:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800803:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800806:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080b:	e9 c9 00 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 19                	ja     800831 <vprintfmt+0x518>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800827:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	e9 a8 00 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  800831:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800835:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	eb e5                	jmp    800824 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80083f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800842:	83 f8 2f             	cmp    $0x2f,%eax
+  800845:	77 15                	ja     80085c <vprintfmt+0x543>
+  800847:	89 c2                	mov    %eax,%edx
+  800849:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084d:	83 c0 08             	add    $0x8,%eax
+  800850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800853:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800855:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80085a:	eb 7d                	jmp    8008d9 <vprintfmt+0x5c0>
+  80085c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800860:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800864:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800868:	eb e9                	jmp    800853 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 16                	ja     800888 <vprintfmt+0x56f>
+  800872:	89 c2                	mov    %eax,%edx
+  800874:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800878:	83 c0 08             	add    $0x8,%eax
+  80087b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800881:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800886:	eb 51                	jmp    8008d9 <vprintfmt+0x5c0>
+  800888:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800890:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800894:	eb e8                	jmp    80087e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	e9 5c ff ff ff       	jmp    800803 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a7:	4c 89 ee             	mov    %r13,%rsi
+  8008aa:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008af:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b2:	4c 89 ee             	mov    %r13,%rsi
+  8008b5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008ba:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 47                	ja     80090c <vprintfmt+0x5f3>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008dd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e1:	0f 94 c0             	sete   %al
+  8008e4:	0f b6 c0             	movzbl %al,%eax
+  8008e7:	50                   	push   %rax
+  8008e8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ed:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f1:	4c 89 ee             	mov    %r13,%rsi
+  8008f4:	4c 89 f7             	mov    %r14,%rdi
+  8008f7:	48 b8 0e 02 80 00 00 	movabs $0x80020e,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+            break;
+  800903:	48 83 c4 10          	add    $0x10,%rsp
+  800907:	e9 3e fa ff ff       	jmp    80034a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	eb b7                	jmp    8008d1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80091a:	40 84 f6             	test   %sil,%sil
+  80091d:	75 2b                	jne    80094a <vprintfmt+0x631>
+    switch (lflag) {
+  80091f:	85 d2                	test   %edx,%edx
+  800921:	74 56                	je     800979 <vprintfmt+0x660>
+  800923:	83 fa 01             	cmp    $0x1,%edx
+  800926:	74 7f                	je     8009a7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	0f 87 a2 00 00 00    	ja     8009d6 <vprintfmt+0x6bd>
+  800934:	89 c2                	mov    %eax,%edx
+  800936:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093a:	83 c0 08             	add    $0x8,%eax
+  80093d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800940:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800943:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800948:	eb 8f                	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094d:	83 f8 2f             	cmp    $0x2f,%eax
+  800950:	77 19                	ja     80096b <vprintfmt+0x652>
+  800952:	89 c2                	mov    %eax,%edx
+  800954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800958:	83 c0 08             	add    $0x8,%eax
+  80095b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800961:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800966:	e9 6e ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb e5                	jmp    80095e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 18                	ja     800999 <vprintfmt+0x680>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80098f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800994:	e9 40 ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  800999:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a5:	eb e6                	jmp    80098d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 19                	ja     8009c8 <vprintfmt+0x6af>
+  8009af:	89 c2                	mov    %eax,%edx
+  8009b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b5:	83 c0 08             	add    $0x8,%eax
+  8009b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009be:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c3:	e9 11 ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  8009c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d4:	eb e5                	jmp    8009bb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	e9 59 ff ff ff       	jmp    800940 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e7:	4c 89 ee             	mov    %r13,%rsi
+  8009ea:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ef:	41 ff d6             	call   *%r14
+            break;
+  8009f2:	e9 53 f9 ff ff       	jmp    80034a <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ff:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a02:	48 83 eb 01          	sub    $0x1,%rbx
+  800a06:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a0a:	75 f6                	jne    800a02 <vprintfmt+0x6e9>
+  800a0c:	e9 39 f9 ff ff       	jmp    80034a <vprintfmt+0x31>
+}
+  800a11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a15:	5b                   	pop    %rbx
+  800a16:	41 5c                	pop    %r12
+  800a18:	41 5d                	pop    %r13
+  800a1a:	41 5e                	pop    %r14
+  800a1c:	41 5f                	pop    %r15
+  800a1e:	5d                   	pop    %rbp
+  800a1f:	c3                   	ret
+
+0000000000800a20 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a20:	55                   	push   %rbp
+  800a21:	48 89 e5             	mov    %rsp,%rbp
+  800a24:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a2c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a31:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a35:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a3c:	48 85 ff             	test   %rdi,%rdi
+  800a3f:	74 2b                	je     800a6c <vsnprintf+0x4c>
+  800a41:	48 85 f6             	test   %rsi,%rsi
+  800a44:	74 26                	je     800a6c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a46:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a4a:	48 bf c4 02 80 00 00 	movabs $0x8002c4,%rdi
+  800a51:	00 00 00 
+  800a54:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  800a5b:	00 00 00 
+  800a5e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a64:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a67:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a6a:	c9                   	leave
+  800a6b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a71:	eb f7                	jmp    800a6a <vsnprintf+0x4a>
+
+0000000000800a73 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a73:	55                   	push   %rbp
+  800a74:	48 89 e5             	mov    %rsp,%rbp
+  800a77:	48 83 ec 50          	sub    $0x50,%rsp
+  800a7b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a7f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a83:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a87:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a8e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a96:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a9a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a9e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa2:	48 b8 20 0a 80 00 00 	movabs $0x800a20,%rax
+  800aa9:	00 00 00 
+  800aac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+
+0000000000800ab0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab3:	74 10                	je     800ac5 <strlen+0x15>
+    size_t n = 0;
+  800ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800aba:	48 83 c0 01          	add    $0x1,%rax
+  800abe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac2:	75 f6                	jne    800aba <strlen+0xa>
+  800ac4:	c3                   	ret
+    size_t n = 0;
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800aca:	c3                   	ret
+
+0000000000800acb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800acb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ace:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad3:	48 85 f6             	test   %rsi,%rsi
+  800ad6:	74 11                	je     800ae9 <strnlen+0x1e>
+  800ad8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800adc:	74 0c                	je     800aea <strnlen+0x1f>
+  800ade:	48 83 c2 01          	add    $0x1,%rdx
+  800ae2:	48 39 d0             	cmp    %rdx,%rax
+  800ae5:	75 f1                	jne    800ad8 <strnlen+0xd>
+  800ae7:	eb 04                	jmp    800aed <strnlen+0x22>
+  800ae9:	c3                   	ret
+  800aea:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aed:	c3                   	ret
+
+0000000000800aee <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800aee:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800afa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800afd:	48 83 c2 01          	add    $0x1,%rdx
+  800b01:	84 c9                	test   %cl,%cl
+  800b03:	75 f1                	jne    800af6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b05:	c3                   	ret
+
+0000000000800b06 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b06:	55                   	push   %rbp
+  800b07:	48 89 e5             	mov    %rsp,%rbp
+  800b0a:	41 54                	push   %r12
+  800b0c:	53                   	push   %rbx
+  800b0d:	48 89 fb             	mov    %rdi,%rbx
+  800b10:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b13:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800b1a:	00 00 00 
+  800b1d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b1f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b23:	4c 89 e6             	mov    %r12,%rsi
+  800b26:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  800b2d:	00 00 00 
+  800b30:	ff d0                	call   *%rax
+    return dst;
+}
+  800b32:	48 89 d8             	mov    %rbx,%rax
+  800b35:	5b                   	pop    %rbx
+  800b36:	41 5c                	pop    %r12
+  800b38:	5d                   	pop    %rbp
+  800b39:	c3                   	ret
+
+0000000000800b3a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b3d:	48 85 d2             	test   %rdx,%rdx
+  800b40:	74 1f                	je     800b61 <strncpy+0x27>
+  800b42:	48 01 fa             	add    %rdi,%rdx
+  800b45:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b48:	48 83 c1 01          	add    $0x1,%rcx
+  800b4c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b50:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b54:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b58:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b5c:	48 39 ca             	cmp    %rcx,%rdx
+  800b5f:	75 e7                	jne    800b48 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b61:	c3                   	ret
+
+0000000000800b62 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b62:	48 89 f8             	mov    %rdi,%rax
+  800b65:	48 85 d2             	test   %rdx,%rdx
+  800b68:	74 24                	je     800b8e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b6a:	48 83 ea 01          	sub    $0x1,%rdx
+  800b6e:	74 1b                	je     800b8b <strlcpy+0x29>
+  800b70:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b74:	0f b6 16             	movzbl (%rsi),%edx
+  800b77:	84 d2                	test   %dl,%dl
+  800b79:	74 10                	je     800b8b <strlcpy+0x29>
+            *dst++ = *src++;
+  800b7b:	48 83 c6 01          	add    $0x1,%rsi
+  800b7f:	48 83 c0 01          	add    $0x1,%rax
+  800b83:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b86:	48 39 c8             	cmp    %rcx,%rax
+  800b89:	75 e9                	jne    800b74 <strlcpy+0x12>
+        *dst = '\0';
+  800b8b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b8e:	48 29 f8             	sub    %rdi,%rax
+}
+  800b91:	c3                   	ret
+
+0000000000800b92 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b92:	0f b6 07             	movzbl (%rdi),%eax
+  800b95:	84 c0                	test   %al,%al
+  800b97:	74 13                	je     800bac <strcmp+0x1a>
+  800b99:	38 06                	cmp    %al,(%rsi)
+  800b9b:	75 0f                	jne    800bac <strcmp+0x1a>
+  800b9d:	48 83 c7 01          	add    $0x1,%rdi
+  800ba1:	48 83 c6 01          	add    $0x1,%rsi
+  800ba5:	0f b6 07             	movzbl (%rdi),%eax
+  800ba8:	84 c0                	test   %al,%al
+  800baa:	75 ed                	jne    800b99 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bac:	0f b6 c0             	movzbl %al,%eax
+  800baf:	0f b6 16             	movzbl (%rsi),%edx
+  800bb2:	29 d0                	sub    %edx,%eax
+}
+  800bb4:	c3                   	ret
+
+0000000000800bb5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb5:	48 85 d2             	test   %rdx,%rdx
+  800bb8:	74 1f                	je     800bd9 <strncmp+0x24>
+  800bba:	0f b6 07             	movzbl (%rdi),%eax
+  800bbd:	84 c0                	test   %al,%al
+  800bbf:	74 1e                	je     800bdf <strncmp+0x2a>
+  800bc1:	3a 06                	cmp    (%rsi),%al
+  800bc3:	75 1a                	jne    800bdf <strncmp+0x2a>
+  800bc5:	48 83 c7 01          	add    $0x1,%rdi
+  800bc9:	48 83 c6 01          	add    $0x1,%rsi
+  800bcd:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd1:	75 e7                	jne    800bba <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd8:	c3                   	ret
+  800bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bde:	c3                   	ret
+  800bdf:	48 85 d2             	test   %rdx,%rdx
+  800be2:	74 09                	je     800bed <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be4:	0f b6 07             	movzbl (%rdi),%eax
+  800be7:	0f b6 16             	movzbl (%rsi),%edx
+  800bea:	29 d0                	sub    %edx,%eax
+  800bec:	c3                   	ret
+    if (!n) return 0;
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf3:	0f b6 17             	movzbl (%rdi),%edx
+  800bf6:	84 d2                	test   %dl,%dl
+  800bf8:	74 18                	je     800c12 <strchr+0x1f>
+        if (*str == c) {
+  800bfa:	0f be d2             	movsbl %dl,%edx
+  800bfd:	39 f2                	cmp    %esi,%edx
+  800bff:	74 17                	je     800c18 <strchr+0x25>
+    for (; *str; str++) {
+  800c01:	48 83 c7 01          	add    $0x1,%rdi
+  800c05:	0f b6 17             	movzbl (%rdi),%edx
+  800c08:	84 d2                	test   %dl,%dl
+  800c0a:	75 ee                	jne    800bfa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c11:	c3                   	ret
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	c3                   	ret
+  800c18:	48 89 f8             	mov    %rdi,%rax
+}
+  800c1b:	c3                   	ret
+
+0000000000800c1c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c1c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c1f:	0f b6 17             	movzbl (%rdi),%edx
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	74 13                	je     800c39 <strfind+0x1d>
+  800c26:	0f be d2             	movsbl %dl,%edx
+  800c29:	39 f2                	cmp    %esi,%edx
+  800c2b:	74 0b                	je     800c38 <strfind+0x1c>
+  800c2d:	48 83 c0 01          	add    $0x1,%rax
+  800c31:	0f b6 10             	movzbl (%rax),%edx
+  800c34:	84 d2                	test   %dl,%dl
+  800c36:	75 ee                	jne    800c26 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c38:	c3                   	ret
+  800c39:	c3                   	ret
+
+0000000000800c3a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c3a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c3d:	48 89 f8             	mov    %rdi,%rax
+  800c40:	48 f7 d8             	neg    %rax
+  800c43:	83 e0 07             	and    $0x7,%eax
+  800c46:	49 89 d1             	mov    %rdx,%r9
+  800c49:	49 29 c1             	sub    %rax,%r9
+  800c4c:	78 36                	js     800c84 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c4e:	40 0f b6 c6          	movzbl %sil,%eax
+  800c52:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c59:	01 01 01 
+  800c5c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c60:	40 f6 c7 07          	test   $0x7,%dil
+  800c64:	75 38                	jne    800c9e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c66:	4c 89 c9             	mov    %r9,%rcx
+  800c69:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c6d:	74 0c                	je     800c7b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c6f:	fc                   	cld
+  800c70:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c73:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c77:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c7b:	4d 85 c9             	test   %r9,%r9
+  800c7e:	75 45                	jne    800cc5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c80:	4c 89 c0             	mov    %r8,%rax
+  800c83:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c84:	48 85 d2             	test   %rdx,%rdx
+  800c87:	74 f7                	je     800c80 <memset+0x46>
+  800c89:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c8c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c8f:	48 83 c0 01          	add    $0x1,%rax
+  800c93:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c97:	48 39 c2             	cmp    %rax,%rdx
+  800c9a:	75 f3                	jne    800c8f <memset+0x55>
+  800c9c:	eb e2                	jmp    800c80 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c9e:	40 f6 c7 01          	test   $0x1,%dil
+  800ca2:	74 06                	je     800caa <memset+0x70>
+  800ca4:	88 07                	mov    %al,(%rdi)
+  800ca6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800caa:	40 f6 c7 02          	test   $0x2,%dil
+  800cae:	74 07                	je     800cb7 <memset+0x7d>
+  800cb0:	66 89 07             	mov    %ax,(%rdi)
+  800cb3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb7:	40 f6 c7 04          	test   $0x4,%dil
+  800cbb:	74 a9                	je     800c66 <memset+0x2c>
+  800cbd:	89 07                	mov    %eax,(%rdi)
+  800cbf:	48 83 c7 04          	add    $0x4,%rdi
+  800cc3:	eb a1                	jmp    800c66 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc5:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc9:	74 06                	je     800cd1 <memset+0x97>
+  800ccb:	89 07                	mov    %eax,(%rdi)
+  800ccd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd1:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd5:	74 07                	je     800cde <memset+0xa4>
+  800cd7:	66 89 07             	mov    %ax,(%rdi)
+  800cda:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cde:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce2:	74 9c                	je     800c80 <memset+0x46>
+  800ce4:	88 07                	mov    %al,(%rdi)
+  800ce6:	eb 98                	jmp    800c80 <memset+0x46>
+
+0000000000800ce8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce8:	48 89 f8             	mov    %rdi,%rax
+  800ceb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cee:	48 39 fe             	cmp    %rdi,%rsi
+  800cf1:	73 3b                	jae    800d2e <memmove+0x46>
+  800cf3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf7:	48 39 d7             	cmp    %rdx,%rdi
+  800cfa:	73 32                	jae    800d2e <memmove+0x46>
+        s += n;
+        d += n;
+  800cfc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d00:	48 89 d6             	mov    %rdx,%rsi
+  800d03:	48 09 fe             	or     %rdi,%rsi
+  800d06:	48 09 ce             	or     %rcx,%rsi
+  800d09:	40 f6 c6 07          	test   $0x7,%sil
+  800d0d:	75 12                	jne    800d21 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d0f:	48 83 ef 08          	sub    $0x8,%rdi
+  800d13:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d17:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d1b:	fd                   	std
+  800d1c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d1f:	fc                   	cld
+  800d20:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d21:	48 83 ef 01          	sub    $0x1,%rdi
+  800d25:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d29:	fd                   	std
+  800d2a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d2c:	eb f1                	jmp    800d1f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d2e:	48 89 f2             	mov    %rsi,%rdx
+  800d31:	48 09 c2             	or     %rax,%rdx
+  800d34:	48 09 ca             	or     %rcx,%rdx
+  800d37:	f6 c2 07             	test   $0x7,%dl
+  800d3a:	75 0c                	jne    800d48 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d3c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d40:	48 89 c7             	mov    %rax,%rdi
+  800d43:	fc                   	cld
+  800d44:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d47:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d48:	48 89 c7             	mov    %rax,%rdi
+  800d4b:	fc                   	cld
+  800d4c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d4e:	c3                   	ret
+
+0000000000800d4f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d4f:	55                   	push   %rbp
+  800d50:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d53:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  800d5a:	00 00 00 
+  800d5d:	ff d0                	call   *%rax
+}
+  800d5f:	5d                   	pop    %rbp
+  800d60:	c3                   	ret
+
+0000000000800d61 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d61:	55                   	push   %rbp
+  800d62:	48 89 e5             	mov    %rsp,%rbp
+  800d65:	41 57                	push   %r15
+  800d67:	41 56                	push   %r14
+  800d69:	41 55                	push   %r13
+  800d6b:	41 54                	push   %r12
+  800d6d:	53                   	push   %rbx
+  800d6e:	48 83 ec 08          	sub    $0x8,%rsp
+  800d72:	49 89 fe             	mov    %rdi,%r14
+  800d75:	49 89 f7             	mov    %rsi,%r15
+  800d78:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d7b:	48 89 f7             	mov    %rsi,%rdi
+  800d7e:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800d85:	00 00 00 
+  800d88:	ff d0                	call   *%rax
+  800d8a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d8d:	48 89 de             	mov    %rbx,%rsi
+  800d90:	4c 89 f7             	mov    %r14,%rdi
+  800d93:	48 b8 cb 0a 80 00 00 	movabs $0x800acb,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+  800d9f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da2:	48 39 c3             	cmp    %rax,%rbx
+  800da5:	74 36                	je     800ddd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da7:	48 89 d8             	mov    %rbx,%rax
+  800daa:	4c 29 e8             	sub    %r13,%rax
+  800dad:	49 39 c4             	cmp    %rax,%r12
+  800db0:	73 31                	jae    800de3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dbb:	4c 89 fe             	mov    %r15,%rsi
+  800dbe:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800dc5:	00 00 00 
+  800dc8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dca:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dce:	48 83 c4 08          	add    $0x8,%rsp
+  800dd2:	5b                   	pop    %rbx
+  800dd3:	41 5c                	pop    %r12
+  800dd5:	41 5d                	pop    %r13
+  800dd7:	41 5e                	pop    %r14
+  800dd9:	41 5f                	pop    %r15
+  800ddb:	5d                   	pop    %rbp
+  800ddc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ddd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de1:	eb eb                	jmp    800dce <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de3:	48 83 eb 01          	sub    $0x1,%rbx
+  800de7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800deb:	48 89 da             	mov    %rbx,%rdx
+  800dee:	4c 89 fe             	mov    %r15,%rsi
+  800df1:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800dfd:	49 01 de             	add    %rbx,%r14
+  800e00:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e05:	eb c3                	jmp    800dca <strlcat+0x69>
+
+0000000000800e07 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e07:	48 85 d2             	test   %rdx,%rdx
+  800e0a:	74 2d                	je     800e39 <memcmp+0x32>
+  800e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e11:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e15:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e1a:	44 38 c1             	cmp    %r8b,%cl
+  800e1d:	75 0f                	jne    800e2e <memcmp+0x27>
+    while (n-- > 0) {
+  800e1f:	48 83 c0 01          	add    $0x1,%rax
+  800e23:	48 39 c2             	cmp    %rax,%rdx
+  800e26:	75 e9                	jne    800e11 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e2e:	0f b6 c1             	movzbl %cl,%eax
+  800e31:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e35:	44 29 c0             	sub    %r8d,%eax
+  800e38:	c3                   	ret
+    return 0;
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3e:	c3                   	ret
+
+0000000000800e3f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e3f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e43:	48 39 c7             	cmp    %rax,%rdi
+  800e46:	73 0f                	jae    800e57 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e48:	40 38 37             	cmp    %sil,(%rdi)
+  800e4b:	74 0e                	je     800e5b <memfind+0x1c>
+    for (; src < end; src++) {
+  800e4d:	48 83 c7 01          	add    $0x1,%rdi
+  800e51:	48 39 f8             	cmp    %rdi,%rax
+  800e54:	75 f2                	jne    800e48 <memfind+0x9>
+  800e56:	c3                   	ret
+  800e57:	48 89 f8             	mov    %rdi,%rax
+  800e5a:	c3                   	ret
+  800e5b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e5e:	c3                   	ret
+
+0000000000800e5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e5f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e62:	0f b6 37             	movzbl (%rdi),%esi
+  800e65:	40 80 fe 20          	cmp    $0x20,%sil
+  800e69:	74 06                	je     800e71 <strtol+0x12>
+  800e6b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e6f:	75 13                	jne    800e84 <strtol+0x25>
+  800e71:	48 83 c7 01          	add    $0x1,%rdi
+  800e75:	0f b6 37             	movzbl (%rdi),%esi
+  800e78:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7c:	74 f3                	je     800e71 <strtol+0x12>
+  800e7e:	40 80 fe 09          	cmp    $0x9,%sil
+  800e82:	74 ed                	je     800e71 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e84:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e87:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e8a:	3c 01                	cmp    $0x1,%al
+  800e8c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e90:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e96:	75 0f                	jne    800ea7 <strtol+0x48>
+  800e98:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e9b:	74 14                	je     800eb1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e9d:	85 d2                	test   %edx,%edx
+  800e9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eac:	4c 63 ca             	movslq %edx,%r9
+  800eaf:	eb 36                	jmp    800ee7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb5:	74 0f                	je     800ec6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb7:	85 d2                	test   %edx,%edx
+  800eb9:	75 ec                	jne    800ea7 <strtol+0x48>
+        s++;
+  800ebb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ebf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec4:	eb e1                	jmp    800ea7 <strtol+0x48>
+        s += 2;
+  800ec6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800eca:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ecf:	eb d6                	jmp    800ea7 <strtol+0x48>
+            dig -= '0';
+  800ed1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed8:	41 39 d0             	cmp    %edx,%r8d
+  800edb:	7d 21                	jge    800efe <strtol+0x9f>
+        val = val * base + dig;
+  800edd:	49 0f af c1          	imul   %r9,%rax
+  800ee1:	0f b6 c9             	movzbl %cl,%ecx
+  800ee4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee7:	48 83 c7 01          	add    $0x1,%rdi
+  800eeb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eef:	80 f9 39             	cmp    $0x39,%cl
+  800ef2:	76 dd                	jbe    800ed1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef4:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef7:	77 05                	ja     800efe <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef9:	83 e9 57             	sub    $0x57,%ecx
+  800efc:	eb d6                	jmp    800ed4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800efe:	4d 85 d2             	test   %r10,%r10
+  800f01:	74 03                	je     800f06 <strtol+0xa7>
+  800f03:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f06:	48 89 c2             	mov    %rax,%rdx
+  800f09:	48 f7 da             	neg    %rdx
+  800f0c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f10:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f14:	c3                   	ret
+
+0000000000800f15 <strrev>:
+
+void
+strrev(char *str)
+{
+  800f15:	55                   	push   %rbp
+  800f16:	48 89 e5             	mov    %rsp,%rbp
+  800f19:	53                   	push   %rbx
+  800f1a:	48 83 ec 08          	sub    $0x8,%rsp
+  800f1e:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800f21:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800f28:	00 00 00 
+  800f2b:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f2d:	83 e8 01             	sub    $0x1,%eax
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	7e 22                	jle    800f56 <strrev+0x41>
+  800f34:	48 98                	cltq
+  800f36:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800f3b:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800f3f:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800f43:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800f47:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800f4a:	48 83 c2 01          	add    $0x1,%rdx
+  800f4e:	48 83 e8 01          	sub    $0x1,%rax
+  800f52:	39 c2                	cmp    %eax,%edx
+  800f54:	7c e5                	jl     800f3b <strrev+0x26>
+	}
+}
+  800f56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+
+0000000000800f5c <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800f5c:	85 d2                	test   %edx,%edx
+  800f5e:	0f 84 80 00 00 00    	je     800fe4 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800f64:	55                   	push   %rbp
+  800f65:	48 89 e5             	mov    %rsp,%rbp
+  800f68:	53                   	push   %rbx
+  800f69:	48 83 ec 08          	sub    $0x8,%rsp
+  800f6d:	49 89 f2             	mov    %rsi,%r10
+  800f70:	41 89 d3             	mov    %edx,%r11d
+  800f73:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  800f76:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  800f7b:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  800f7e:	eb 20                	jmp    800fa0 <itoa+0x44>
+			str[i++] = '0' + digit;
+  800f80:	41 89 f1             	mov    %esi,%r9d
+  800f83:	83 c2 30             	add    $0x30,%edx
+  800f86:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  800f89:	89 f8                	mov    %edi,%eax
+  800f8b:	99                   	cltd
+  800f8c:	f7 f9                	idiv   %ecx
+  800f8e:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	74 2e                	je     800fc2 <itoa+0x66>
+  800f94:	83 c6 01             	add    $0x1,%esi
+  800f97:	49 83 c0 01          	add    $0x1,%r8
+  800f9b:	44 39 cb             	cmp    %r9d,%ebx
+  800f9e:	7e 15                	jle    800fb5 <itoa+0x59>
+		digit = sum % base;
+  800fa0:	89 f8                	mov    %edi,%eax
+  800fa2:	99                   	cltd
+  800fa3:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  800fa5:	83 fa 09             	cmp    $0x9,%edx
+  800fa8:	7e d6                	jle    800f80 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  800faa:	41 89 f1             	mov    %esi,%r9d
+  800fad:	83 c2 37             	add    $0x37,%edx
+  800fb0:	41 88 10             	mov    %dl,(%r8)
+  800fb3:	eb d4                	jmp    800f89 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  800fb5:	41 83 eb 01          	sub    $0x1,%r11d
+  800fb9:	45 39 cb             	cmp    %r9d,%r11d
+  800fbc:	75 04                	jne    800fc2 <itoa+0x66>
+  800fbe:	85 c0                	test   %eax,%eax
+  800fc0:	75 28                	jne    800fea <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  800fc2:	4d 63 c9             	movslq %r9d,%r9
+  800fc5:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  800fca:	4c 89 d7             	mov    %r10,%rdi
+  800fcd:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  800fd4:	00 00 00 
+  800fd7:	ff d0                	call   *%rax
+	return 0;
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fe2:	c9                   	leave
+  800fe3:	c3                   	ret
+		return -1;
+  800fe4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fe9:	c3                   	ret
+		return -1;
+  800fea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fef:	eb ed                	jmp    800fde <itoa+0x82>
+
+0000000000800ff1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ff1:	55                   	push   %rbp
+  800ff2:	48 89 e5             	mov    %rsp,%rbp
+  800ff5:	53                   	push   %rbx
+  800ff6:	48 89 fa             	mov    %rdi,%rdx
+  800ff9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100b:	be 00 00 00 00       	mov    $0x0,%esi
+  801010:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801016:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801018:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101c:	c9                   	leave
+  80101d:	c3                   	ret
+
+000000000080101e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80101e:	55                   	push   %rbp
+  80101f:	48 89 e5             	mov    %rsp,%rbp
+  801022:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801023:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801028:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801032:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801037:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103c:	be 00 00 00 00       	mov    $0x0,%esi
+  801041:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801047:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801049:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104d:	c9                   	leave
+  80104e:	c3                   	ret
+
+000000000080104f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80104f:	55                   	push   %rbp
+  801050:	48 89 e5             	mov    %rsp,%rbp
+  801053:	53                   	push   %rbx
+  801054:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801058:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80105b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801060:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106f:	be 00 00 00 00       	mov    $0x0,%esi
+  801074:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80107c:	48 85 c0             	test   %rax,%rax
+  80107f:	7f 06                	jg     801087 <sys_env_destroy+0x38>
+}
+  801081:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801085:	c9                   	leave
+  801086:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801087:	49 89 c0             	mov    %rax,%r8
+  80108a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80108f:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  801096:	00 00 00 
+  801099:	be 26 00 00 00       	mov    $0x26,%esi
+  80109e:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  8010a5:	00 00 00 
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ad:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  8010b4:	00 00 00 
+  8010b7:	41 ff d1             	call   *%r9
+
+00000000008010ba <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010ba:	55                   	push   %rbp
+  8010bb:	48 89 e5             	mov    %rsp,%rbp
+  8010be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bf:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+
+00000000008010eb <sys_yield>:
+
+void
+sys_yield(void) {
+  8010eb:	55                   	push   %rbp
+  8010ec:	48 89 e5             	mov    %rsp,%rbp
+  8010ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801109:	be 00 00 00 00       	mov    $0x0,%esi
+  80110e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801114:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801116:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111a:	c9                   	leave
+  80111b:	c3                   	ret
+
+000000000080111c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+  801120:	53                   	push   %rbx
+  801121:	48 89 fa             	mov    %rdi,%rdx
+  801124:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801127:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80112c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801133:	00 00 00 
+  801136:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113b:	be 00 00 00 00       	mov    $0x0,%esi
+  801140:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801146:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114c:	c9                   	leave
+  80114d:	c3                   	ret
+
+000000000080114e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80114e:	55                   	push   %rbp
+  80114f:	48 89 e5             	mov    %rsp,%rbp
+  801152:	53                   	push   %rbx
+  801153:	49 89 f8             	mov    %rdi,%r8
+  801156:	48 89 d3             	mov    %rdx,%rbx
+  801159:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80115c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801161:	4c 89 c2             	mov    %r8,%rdx
+  801164:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801167:	be 00 00 00 00       	mov    $0x0,%esi
+  80116c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801172:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+
+000000000080117a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80117a:	55                   	push   %rbp
+  80117b:	48 89 e5             	mov    %rsp,%rbp
+  80117e:	53                   	push   %rbx
+  80117f:	48 83 ec 08          	sub    $0x8,%rsp
+  801183:	89 f8                	mov    %edi,%eax
+  801185:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801188:	48 63 f9             	movslq %ecx,%rdi
+  80118b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80118e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801193:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801196:	be 00 00 00 00       	mov    $0x0,%esi
+  80119b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a3:	48 85 c0             	test   %rax,%rax
+  8011a6:	7f 06                	jg     8011ae <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ac:	c9                   	leave
+  8011ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ae:	49 89 c0             	mov    %rax,%r8
+  8011b1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011b6:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  8011bd:	00 00 00 
+  8011c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c5:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  8011cc:	00 00 00 
+  8011cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d4:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  8011db:	00 00 00 
+  8011de:	41 ff d1             	call   *%r9
+
+00000000008011e1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e1:	55                   	push   %rbp
+  8011e2:	48 89 e5             	mov    %rsp,%rbp
+  8011e5:	53                   	push   %rbx
+  8011e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ea:	89 f8                	mov    %edi,%eax
+  8011ec:	49 89 f2             	mov    %rsi,%r10
+  8011ef:	48 89 cf             	mov    %rcx,%rdi
+  8011f2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011f5:	48 63 da             	movslq %edx,%rbx
+  8011f8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801200:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801203:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801206:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801208:	48 85 c0             	test   %rax,%rax
+  80120b:	7f 06                	jg     801213 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80120d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801213:	49 89 c0             	mov    %rax,%r8
+  801216:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80121b:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  801222:	00 00 00 
+  801225:	be 26 00 00 00       	mov    $0x26,%esi
+  80122a:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  801231:	00 00 00 
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+  801239:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  801240:	00 00 00 
+  801243:	41 ff d1             	call   *%r9
+
+0000000000801246 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	53                   	push   %rbx
+  80124b:	48 83 ec 08          	sub    $0x8,%rsp
+  80124f:	48 89 f1             	mov    %rsi,%rcx
+  801252:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801255:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801258:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801262:	be 00 00 00 00       	mov    $0x0,%esi
+  801267:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126f:	48 85 c0             	test   %rax,%rax
+  801272:	7f 06                	jg     80127a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801274:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801278:	c9                   	leave
+  801279:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127a:	49 89 c0             	mov    %rax,%r8
+  80127d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801282:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  801289:	00 00 00 
+  80128c:	be 26 00 00 00       	mov    $0x26,%esi
+  801291:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  801298:	00 00 00 
+  80129b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a0:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  8012a7:	00 00 00 
+  8012aa:	41 ff d1             	call   *%r9
+
+00000000008012ad <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012ad:	55                   	push   %rbp
+  8012ae:	48 89 e5             	mov    %rsp,%rbp
+  8012b1:	53                   	push   %rbx
+  8012b2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012b6:	48 63 ce             	movslq %esi,%rcx
+  8012b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bc:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d8:	48 85 c0             	test   %rax,%rax
+  8012db:	7f 06                	jg     8012e3 <sys_env_set_status+0x36>
+}
+  8012dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e1:	c9                   	leave
+  8012e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e3:	49 89 c0             	mov    %rax,%r8
+  8012e6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012eb:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  8012f2:	00 00 00 
+  8012f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fa:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  801301:	00 00 00 
+  801304:	b8 00 00 00 00       	mov    $0x0,%eax
+  801309:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  801310:	00 00 00 
+  801313:	41 ff d1             	call   *%r9
+
+0000000000801316 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801316:	55                   	push   %rbp
+  801317:	48 89 e5             	mov    %rsp,%rbp
+  80131a:	53                   	push   %rbx
+  80131b:	48 83 ec 08          	sub    $0x8,%rsp
+  80131f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801322:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801325:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801334:	be 00 00 00 00       	mov    $0x0,%esi
+  801339:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801341:	48 85 c0             	test   %rax,%rax
+  801344:	7f 06                	jg     80134c <sys_env_set_trapframe+0x36>
+}
+  801346:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134a:	c9                   	leave
+  80134b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134c:	49 89 c0             	mov    %rax,%r8
+  80134f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801354:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  80135b:	00 00 00 
+  80135e:	be 26 00 00 00       	mov    $0x26,%esi
+  801363:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  80136a:	00 00 00 
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801372:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  801379:	00 00 00 
+  80137c:	41 ff d1             	call   *%r9
+
+000000000080137f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	53                   	push   %rbx
+  801384:	48 83 ec 08          	sub    $0x8,%rsp
+  801388:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80138b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801398:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139d:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013aa:	48 85 c0             	test   %rax,%rax
+  8013ad:	7f 06                	jg     8013b5 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b5:	49 89 c0             	mov    %rax,%r8
+  8013b8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013bd:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  8013c4:	00 00 00 
+  8013c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cc:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  8013d3:	00 00 00 
+  8013d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013db:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  8013e2:	00 00 00 
+  8013e5:	41 ff d1             	call   *%r9
+
+00000000008013e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013e8:	55                   	push   %rbp
+  8013e9:	48 89 e5             	mov    %rsp,%rbp
+  8013ec:	53                   	push   %rbx
+  8013ed:	89 f8                	mov    %edi,%eax
+  8013ef:	49 89 f1             	mov    %rsi,%r9
+  8013f2:	48 89 d3             	mov    %rdx,%rbx
+  8013f5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013f8:	49 63 f0             	movslq %r8d,%rsi
+  8013fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801403:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140c:	cd 30                	int    $0x30
+}
+  80140e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+
+0000000000801414 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+  801418:	53                   	push   %rbx
+  801419:	48 83 ec 08          	sub    $0x8,%rsp
+  80141d:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801420:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801423:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801428:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143d:	48 85 c0             	test   %rax,%rax
+  801440:	7f 06                	jg     801448 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801448:	49 89 c0             	mov    %rax,%r8
+  80144b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801450:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  801457:	00 00 00 
+  80145a:	be 26 00 00 00       	mov    $0x26,%esi
+  80145f:	48 bf e7 3b 80 00 00 	movabs $0x803be7,%rdi
+  801466:	00 00 00 
+  801469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146e:	49 b9 db 33 80 00 00 	movabs $0x8033db,%r9
+  801475:	00 00 00 
+  801478:	41 ff d1             	call   *%r9
+
+000000000080147b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80147f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801484:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  80148b:	00 00 00 
+  80148e:	ff d0                	call   *%rax
+}
+  801490:	5d                   	pop    %rbp
+  801491:	c3                   	ret
+
+0000000000801492 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801492:	55                   	push   %rbp
+  801493:	48 89 e5             	mov    %rsp,%rbp
+  801496:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801497:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bb:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c1:	c9                   	leave
+  8014c2:	c3                   	ret
+
+00000000008014c3 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8014c3:	55                   	push   %rbp
+  8014c4:	48 89 e5             	mov    %rsp,%rbp
+  8014c7:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8014c8:	48 63 ce             	movslq %esi,%rcx
+  8014cb:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e9:	cd 30                	int    $0x30
+}
+  8014eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ef:	c9                   	leave
+  8014f0:	c3                   	ret
+
+00000000008014f1 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	53                   	push   %rbx
+  8014f6:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8014f9:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801502:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801507:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150c:	be 00 00 00 00       	mov    $0x0,%esi
+  801511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801517:	cd 30                	int    $0x30
+}
+  801519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+
+000000000080151f <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	53                   	push   %rbx
+  801524:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801527:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80152a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801532:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801537:	be 00 00 00 00       	mov    $0x0,%esi
+  80153c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801542:	cd 30                	int    $0x30
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+
+000000000080154a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80154a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801551:	ff ff ff 
+  801554:	48 01 f8             	add    %rdi,%rax
+  801557:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80155b:	c3                   	ret
+
+000000000080155c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80155c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801563:	ff ff ff 
+  801566:	48 01 f8             	add    %rdi,%rax
+  801569:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80156d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801573:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801577:	c3                   	ret
+
+0000000000801578 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	41 57                	push   %r15
+  80157e:	41 56                	push   %r14
+  801580:	41 55                	push   %r13
+  801582:	41 54                	push   %r12
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+  801589:	49 89 ff             	mov    %rdi,%r15
+  80158c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801591:	49 bd 97 30 80 00 00 	movabs $0x803097,%r13
+  801598:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80159b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015a1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015a4:	48 89 df             	mov    %rbx,%rdi
+  8015a7:	41 ff d5             	call   *%r13
+  8015aa:	83 e0 04             	and    $0x4,%eax
+  8015ad:	74 17                	je     8015c6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015af:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015b6:	4c 39 f3             	cmp    %r14,%rbx
+  8015b9:	75 e6                	jne    8015a1 <fd_alloc+0x29>
+  8015bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015c1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8015c6:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015c9:	48 83 c4 08          	add    $0x8,%rsp
+  8015cd:	5b                   	pop    %rbx
+  8015ce:	41 5c                	pop    %r12
+  8015d0:	41 5d                	pop    %r13
+  8015d2:	41 5e                	pop    %r14
+  8015d4:	41 5f                	pop    %r15
+  8015d6:	5d                   	pop    %rbp
+  8015d7:	c3                   	ret
+
+00000000008015d8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015d8:	83 ff 1f             	cmp    $0x1f,%edi
+  8015db:	77 39                	ja     801616 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015dd:	55                   	push   %rbp
+  8015de:	48 89 e5             	mov    %rsp,%rbp
+  8015e1:	41 54                	push   %r12
+  8015e3:	53                   	push   %rbx
+  8015e4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015e7:	48 63 df             	movslq %edi,%rbx
+  8015ea:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015f1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015f5:	48 89 df             	mov    %rbx,%rdi
+  8015f8:	48 b8 97 30 80 00 00 	movabs $0x803097,%rax
+  8015ff:	00 00 00 
+  801602:	ff d0                	call   *%rax
+  801604:	a8 04                	test   $0x4,%al
+  801606:	74 14                	je     80161c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801608:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80160c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801611:	5b                   	pop    %rbx
+  801612:	41 5c                	pop    %r12
+  801614:	5d                   	pop    %rbp
+  801615:	c3                   	ret
+        return -E_INVAL;
+  801616:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80161b:	c3                   	ret
+        return -E_INVAL;
+  80161c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801621:	eb ee                	jmp    801611 <fd_lookup+0x39>
+
+0000000000801623 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801623:	55                   	push   %rbp
+  801624:	48 89 e5             	mov    %rsp,%rbp
+  801627:	41 54                	push   %r12
+  801629:	53                   	push   %rbx
+  80162a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80162d:	48 b8 a0 3c 80 00 00 	movabs $0x803ca0,%rax
+  801634:	00 00 00 
+  801637:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80163e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801641:	39 3b                	cmp    %edi,(%rbx)
+  801643:	74 47                	je     80168c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801645:	48 83 c0 08          	add    $0x8,%rax
+  801649:	48 8b 18             	mov    (%rax),%rbx
+  80164c:	48 85 db             	test   %rbx,%rbx
+  80164f:	75 f0                	jne    801641 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801651:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801658:	00 00 00 
+  80165b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801661:	89 fa                	mov    %edi,%edx
+  801663:	48 bf f8 3b 80 00 00 	movabs $0x803bf8,%rdi
+  80166a:	00 00 00 
+  80166d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801672:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801679:	00 00 00 
+  80167c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80167e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801683:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801687:	5b                   	pop    %rbx
+  801688:	41 5c                	pop    %r12
+  80168a:	5d                   	pop    %rbp
+  80168b:	c3                   	ret
+            return 0;
+  80168c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801691:	eb f0                	jmp    801683 <dev_lookup+0x60>
+
+0000000000801693 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801693:	55                   	push   %rbp
+  801694:	48 89 e5             	mov    %rsp,%rbp
+  801697:	41 55                	push   %r13
+  801699:	41 54                	push   %r12
+  80169b:	53                   	push   %rbx
+  80169c:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a0:	48 89 fb             	mov    %rdi,%rbx
+  8016a3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016a6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016ad:	ff ff ff 
+  8016b0:	48 01 df             	add    %rbx,%rdi
+  8016b3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016bb:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  8016c2:	00 00 00 
+  8016c5:	ff d0                	call   *%rax
+  8016c7:	41 89 c5             	mov    %eax,%r13d
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 06                	js     8016d4 <fd_close+0x41>
+  8016ce:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016d2:	74 1a                	je     8016ee <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016d4:	45 84 e4             	test   %r12b,%r12b
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016e0:	44 89 e8             	mov    %r13d,%eax
+  8016e3:	48 83 c4 18          	add    $0x18,%rsp
+  8016e7:	5b                   	pop    %rbx
+  8016e8:	41 5c                	pop    %r12
+  8016ea:	41 5d                	pop    %r13
+  8016ec:	5d                   	pop    %rbp
+  8016ed:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016ee:	8b 3b                	mov    (%rbx),%edi
+  8016f0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016f4:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  8016fb:	00 00 00 
+  8016fe:	ff d0                	call   *%rax
+  801700:	41 89 c5             	mov    %eax,%r13d
+  801703:	85 c0                	test   %eax,%eax
+  801705:	78 1b                	js     801722 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801707:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80170b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80170f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801715:	48 85 c0             	test   %rax,%rax
+  801718:	74 08                	je     801722 <fd_close+0x8f>
+  80171a:	48 89 df             	mov    %rbx,%rdi
+  80171d:	ff d0                	call   *%rax
+  80171f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801722:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801727:	48 89 de             	mov    %rbx,%rsi
+  80172a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172f:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801736:	00 00 00 
+  801739:	ff d0                	call   *%rax
+    return res;
+  80173b:	eb a3                	jmp    8016e0 <fd_close+0x4d>
+
+000000000080173d <close>:
+
+int
+close(int fdnum) {
+  80173d:	55                   	push   %rbp
+  80173e:	48 89 e5             	mov    %rsp,%rbp
+  801741:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801745:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801749:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801750:	00 00 00 
+  801753:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 15                	js     80176e <close+0x31>
+
+    return fd_close(fd, 1);
+  801759:	be 01 00 00 00       	mov    $0x1,%esi
+  80175e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801762:	48 b8 93 16 80 00 00 	movabs $0x801693,%rax
+  801769:	00 00 00 
+  80176c:	ff d0                	call   *%rax
+}
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+
+0000000000801770 <close_all>:
+
+void
+close_all(void) {
+  801770:	55                   	push   %rbp
+  801771:	48 89 e5             	mov    %rsp,%rbp
+  801774:	41 54                	push   %r12
+  801776:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801777:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177c:	49 bc 3d 17 80 00 00 	movabs $0x80173d,%r12
+  801783:	00 00 00 
+  801786:	89 df                	mov    %ebx,%edi
+  801788:	41 ff d4             	call   *%r12
+  80178b:	83 c3 01             	add    $0x1,%ebx
+  80178e:	83 fb 20             	cmp    $0x20,%ebx
+  801791:	75 f3                	jne    801786 <close_all+0x16>
+}
+  801793:	5b                   	pop    %rbx
+  801794:	41 5c                	pop    %r12
+  801796:	5d                   	pop    %rbp
+  801797:	c3                   	ret
+
+0000000000801798 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	41 57                	push   %r15
+  80179e:	41 56                	push   %r14
+  8017a0:	41 55                	push   %r13
+  8017a2:	41 54                	push   %r12
+  8017a4:	53                   	push   %rbx
+  8017a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8017a9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017ac:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017b0:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  8017b7:	00 00 00 
+  8017ba:	ff d0                	call   *%rax
+  8017bc:	89 c3                	mov    %eax,%ebx
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	0f 88 b8 00 00 00    	js     80187e <dup+0xe6>
+    close(newfdnum);
+  8017c6:	44 89 e7             	mov    %r12d,%edi
+  8017c9:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  8017d0:	00 00 00 
+  8017d3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017d5:	4d 63 ec             	movslq %r12d,%r13
+  8017d8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017df:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017e3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017e7:	4c 89 ff             	mov    %r15,%rdi
+  8017ea:	49 be 5c 15 80 00 00 	movabs $0x80155c,%r14
+  8017f1:	00 00 00 
+  8017f4:	41 ff d6             	call   *%r14
+  8017f7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017fa:	4c 89 ef             	mov    %r13,%rdi
+  8017fd:	41 ff d6             	call   *%r14
+  801800:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801803:	48 89 df             	mov    %rbx,%rdi
+  801806:	48 b8 97 30 80 00 00 	movabs $0x803097,%rax
+  80180d:	00 00 00 
+  801810:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801812:	a8 04                	test   $0x4,%al
+  801814:	74 2b                	je     801841 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801816:	41 89 c1             	mov    %eax,%r9d
+  801819:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80181f:	4c 89 f1             	mov    %r14,%rcx
+  801822:	ba 00 00 00 00       	mov    $0x0,%edx
+  801827:	48 89 de             	mov    %rbx,%rsi
+  80182a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80182f:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+  80183b:	89 c3                	mov    %eax,%ebx
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	78 4e                	js     80188f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801841:	4c 89 ff             	mov    %r15,%rdi
+  801844:	48 b8 97 30 80 00 00 	movabs $0x803097,%rax
+  80184b:	00 00 00 
+  80184e:	ff d0                	call   *%rax
+  801850:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801853:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801859:	4c 89 e9             	mov    %r13,%rcx
+  80185c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801861:	4c 89 fe             	mov    %r15,%rsi
+  801864:	bf 00 00 00 00       	mov    $0x0,%edi
+  801869:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+  801875:	89 c3                	mov    %eax,%ebx
+  801877:	85 c0                	test   %eax,%eax
+  801879:	78 14                	js     80188f <dup+0xf7>
+
+    return newfdnum;
+  80187b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80187e:	89 d8                	mov    %ebx,%eax
+  801880:	48 83 c4 18          	add    $0x18,%rsp
+  801884:	5b                   	pop    %rbx
+  801885:	41 5c                	pop    %r12
+  801887:	41 5d                	pop    %r13
+  801889:	41 5e                	pop    %r14
+  80188b:	41 5f                	pop    %r15
+  80188d:	5d                   	pop    %rbp
+  80188e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80188f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801894:	4c 89 ee             	mov    %r13,%rsi
+  801897:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189c:	49 bc 46 12 80 00 00 	movabs $0x801246,%r12
+  8018a3:	00 00 00 
+  8018a6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ae:	4c 89 f6             	mov    %r14,%rsi
+  8018b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b6:	41 ff d4             	call   *%r12
+    return res;
+  8018b9:	eb c3                	jmp    80187e <dup+0xe6>
+
+00000000008018bb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	41 56                	push   %r14
+  8018c1:	41 55                	push   %r13
+  8018c3:	41 54                	push   %r12
+  8018c5:	53                   	push   %rbx
+  8018c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ca:	89 fb                	mov    %edi,%ebx
+  8018cc:	49 89 f4             	mov    %rsi,%r12
+  8018cf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018d6:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  8018dd:	00 00 00 
+  8018e0:	ff d0                	call   *%rax
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	78 4c                	js     801932 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018e6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018ea:	41 8b 3e             	mov    (%r14),%edi
+  8018ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018f1:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	78 35                	js     801936 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801901:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801905:	83 e0 03             	and    $0x3,%eax
+  801908:	83 f8 01             	cmp    $0x1,%eax
+  80190b:	74 2d                	je     80193a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80190d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801911:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801915:	48 85 c0             	test   %rax,%rax
+  801918:	74 56                	je     801970 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80191a:	4c 89 ea             	mov    %r13,%rdx
+  80191d:	4c 89 e6             	mov    %r12,%rsi
+  801920:	4c 89 f7             	mov    %r14,%rdi
+  801923:	ff d0                	call   *%rax
+}
+  801925:	48 83 c4 10          	add    $0x10,%rsp
+  801929:	5b                   	pop    %rbx
+  80192a:	41 5c                	pop    %r12
+  80192c:	41 5d                	pop    %r13
+  80192e:	41 5e                	pop    %r14
+  801930:	5d                   	pop    %rbp
+  801931:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801932:	48 98                	cltq
+  801934:	eb ef                	jmp    801925 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801936:	48 98                	cltq
+  801938:	eb eb                	jmp    801925 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80193a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801941:	00 00 00 
+  801944:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80194a:	89 da                	mov    %ebx,%edx
+  80194c:	48 bf 59 3c 80 00 00 	movabs $0x803c59,%rdi
+  801953:	00 00 00 
+  801956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195b:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801962:	00 00 00 
+  801965:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801967:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80196e:	eb b5                	jmp    801925 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801970:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801977:	eb ac                	jmp    801925 <read+0x6a>
+
+0000000000801979 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	41 56                	push   %r14
+  80197f:	41 55                	push   %r13
+  801981:	41 54                	push   %r12
+  801983:	53                   	push   %rbx
+  801984:	48 83 ec 10          	sub    $0x10,%rsp
+  801988:	89 fb                	mov    %edi,%ebx
+  80198a:	49 89 f4             	mov    %rsi,%r12
+  80198d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801990:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801994:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  80199b:	00 00 00 
+  80199e:	ff d0                	call   *%rax
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 41                	js     8019e5 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019a4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019a8:	41 8b 3e             	mov    (%r14),%edi
+  8019ab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019af:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+  8019bb:	85 c0                	test   %eax,%eax
+  8019bd:	78 35                	js     8019f4 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019bf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019c3:	83 e0 03             	and    $0x3,%eax
+  8019c6:	83 f8 01             	cmp    $0x1,%eax
+  8019c9:	74 2d                	je     8019f8 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8019cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019cf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019d3:	48 85 c0             	test   %rax,%rax
+  8019d6:	74 56                	je     801a2e <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8019d8:	4c 89 ea             	mov    %r13,%rdx
+  8019db:	4c 89 e6             	mov    %r12,%rsi
+  8019de:	4c 89 f7             	mov    %r14,%rdi
+  8019e1:	ff d0                	call   *%rax
+  8019e3:	eb 02                	jmp    8019e7 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019e5:	48 98                	cltq
+}
+  8019e7:	48 83 c4 10          	add    $0x10,%rsp
+  8019eb:	5b                   	pop    %rbx
+  8019ec:	41 5c                	pop    %r12
+  8019ee:	41 5d                	pop    %r13
+  8019f0:	41 5e                	pop    %r14
+  8019f2:	5d                   	pop    %rbp
+  8019f3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019f4:	48 98                	cltq
+  8019f6:	eb ef                	jmp    8019e7 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019f8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019ff:	00 00 00 
+  801a02:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a08:	89 da                	mov    %ebx,%edx
+  801a0a:	48 bf 18 3c 80 00 00 	movabs $0x803c18,%rdi
+  801a11:	00 00 00 
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a19:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801a20:	00 00 00 
+  801a23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a25:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a2c:	eb b9                	jmp    8019e7 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a2e:	4c 89 ea             	mov    %r13,%rdx
+  801a31:	4c 89 e6             	mov    %r12,%rsi
+  801a34:	89 df                	mov    %ebx,%edi
+  801a36:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  801a3d:	00 00 00 
+  801a40:	ff d0                	call   *%rax
+  801a42:	eb a3                	jmp    8019e7 <readmap+0x6e>
+
+0000000000801a44 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a44:	55                   	push   %rbp
+  801a45:	48 89 e5             	mov    %rsp,%rbp
+  801a48:	41 57                	push   %r15
+  801a4a:	41 56                	push   %r14
+  801a4c:	41 55                	push   %r13
+  801a4e:	41 54                	push   %r12
+  801a50:	53                   	push   %rbx
+  801a51:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a55:	48 85 d2             	test   %rdx,%rdx
+  801a58:	74 54                	je     801aae <readn+0x6a>
+  801a5a:	41 89 fd             	mov    %edi,%r13d
+  801a5d:	49 89 f6             	mov    %rsi,%r14
+  801a60:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a63:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a68:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a6d:	49 bf bb 18 80 00 00 	movabs $0x8018bb,%r15
+  801a74:	00 00 00 
+  801a77:	4c 89 e2             	mov    %r12,%rdx
+  801a7a:	48 29 f2             	sub    %rsi,%rdx
+  801a7d:	4c 01 f6             	add    %r14,%rsi
+  801a80:	44 89 ef             	mov    %r13d,%edi
+  801a83:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	78 20                	js     801aaa <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a8a:	01 c3                	add    %eax,%ebx
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	74 08                	je     801a98 <readn+0x54>
+  801a90:	48 63 f3             	movslq %ebx,%rsi
+  801a93:	4c 39 e6             	cmp    %r12,%rsi
+  801a96:	72 df                	jb     801a77 <readn+0x33>
+    }
+    return res;
+  801a98:	48 63 c3             	movslq %ebx,%rax
+}
+  801a9b:	48 83 c4 08          	add    $0x8,%rsp
+  801a9f:	5b                   	pop    %rbx
+  801aa0:	41 5c                	pop    %r12
+  801aa2:	41 5d                	pop    %r13
+  801aa4:	41 5e                	pop    %r14
+  801aa6:	41 5f                	pop    %r15
+  801aa8:	5d                   	pop    %rbp
+  801aa9:	c3                   	ret
+        if (inc < 0) return inc;
+  801aaa:	48 98                	cltq
+  801aac:	eb ed                	jmp    801a9b <readn+0x57>
+    int inc = 1, res = 0;
+  801aae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab3:	eb e3                	jmp    801a98 <readn+0x54>
+
+0000000000801ab5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ab5:	55                   	push   %rbp
+  801ab6:	48 89 e5             	mov    %rsp,%rbp
+  801ab9:	41 56                	push   %r14
+  801abb:	41 55                	push   %r13
+  801abd:	41 54                	push   %r12
+  801abf:	53                   	push   %rbx
+  801ac0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ac4:	89 fb                	mov    %edi,%ebx
+  801ac6:	49 89 f4             	mov    %rsi,%r12
+  801ac9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801acc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad0:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801ad7:	00 00 00 
+  801ada:	ff d0                	call   *%rax
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 47                	js     801b27 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ae4:	41 8b 3e             	mov    (%r14),%edi
+  801ae7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aeb:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+  801af7:	85 c0                	test   %eax,%eax
+  801af9:	78 30                	js     801b2b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801afb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b00:	74 2d                	je     801b2f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b06:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b0a:	48 85 c0             	test   %rax,%rax
+  801b0d:	74 56                	je     801b65 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b0f:	4c 89 ea             	mov    %r13,%rdx
+  801b12:	4c 89 e6             	mov    %r12,%rsi
+  801b15:	4c 89 f7             	mov    %r14,%rdi
+  801b18:	ff d0                	call   *%rax
+}
+  801b1a:	48 83 c4 10          	add    $0x10,%rsp
+  801b1e:	5b                   	pop    %rbx
+  801b1f:	41 5c                	pop    %r12
+  801b21:	41 5d                	pop    %r13
+  801b23:	41 5e                	pop    %r14
+  801b25:	5d                   	pop    %rbp
+  801b26:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b27:	48 98                	cltq
+  801b29:	eb ef                	jmp    801b1a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b2b:	48 98                	cltq
+  801b2d:	eb eb                	jmp    801b1a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b2f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b36:	00 00 00 
+  801b39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b3f:	89 da                	mov    %ebx,%edx
+  801b41:	48 bf 75 3c 80 00 00 	movabs $0x803c75,%rdi
+  801b48:	00 00 00 
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b50:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801b57:	00 00 00 
+  801b5a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b5c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b63:	eb b5                	jmp    801b1a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b65:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b6c:	eb ac                	jmp    801b1a <write+0x65>
+
+0000000000801b6e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b6e:	55                   	push   %rbp
+  801b6f:	48 89 e5             	mov    %rsp,%rbp
+  801b72:	53                   	push   %rbx
+  801b73:	48 83 ec 18          	sub    $0x18,%rsp
+  801b77:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b79:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b7d:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801b84:	00 00 00 
+  801b87:	ff d0                	call   *%rax
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 0c                	js     801b99 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b91:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801b94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+0000000000801b9f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801b9f:	55                   	push   %rbp
+  801ba0:	48 89 e5             	mov    %rsp,%rbp
+  801ba3:	41 55                	push   %r13
+  801ba5:	41 54                	push   %r12
+  801ba7:	53                   	push   %rbx
+  801ba8:	48 83 ec 18          	sub    $0x18,%rsp
+  801bac:	89 fb                	mov    %edi,%ebx
+  801bae:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb5:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 38                	js     801bfd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bc5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bc9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bcd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd1:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	85 c0                	test   %eax,%eax
+  801bdf:	78 1c                	js     801bfd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801be6:	74 20                	je     801c08 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801be8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bec:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bf0:	48 85 c0             	test   %rax,%rax
+  801bf3:	74 47                	je     801c3c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801bf5:	44 89 e6             	mov    %r12d,%esi
+  801bf8:	4c 89 ef             	mov    %r13,%rdi
+  801bfb:	ff d0                	call   *%rax
+}
+  801bfd:	48 83 c4 18          	add    $0x18,%rsp
+  801c01:	5b                   	pop    %rbx
+  801c02:	41 5c                	pop    %r12
+  801c04:	41 5d                	pop    %r13
+  801c06:	5d                   	pop    %rbp
+  801c07:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c08:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c0f:	00 00 00 
+  801c12:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c18:	89 da                	mov    %ebx,%edx
+  801c1a:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  801c21:	00 00 00 
+  801c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c29:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801c30:	00 00 00 
+  801c33:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3a:	eb c1                	jmp    801bfd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c3c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c41:	eb ba                	jmp    801bfd <ftruncate+0x5e>
+
+0000000000801c43 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	41 54                	push   %r12
+  801c49:	53                   	push   %rbx
+  801c4a:	48 83 ec 10          	sub    $0x10,%rsp
+  801c4e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c51:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c55:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	78 4e                	js     801cb3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c65:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c69:	41 8b 3c 24          	mov    (%r12),%edi
+  801c6d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c71:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801c78:	00 00 00 
+  801c7b:	ff d0                	call   *%rax
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	78 32                	js     801cb3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c85:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801c8a:	74 30                	je     801cbc <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c8c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c8f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c96:	00 00 00 
+    stat->st_isdir = 0;
+  801c99:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ca0:	00 00 00 
+    stat->st_dev = dev;
+  801ca3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801caa:	48 89 de             	mov    %rbx,%rsi
+  801cad:	4c 89 e7             	mov    %r12,%rdi
+  801cb0:	ff 50 30             	call   *0x30(%rax)
+}
+  801cb3:	48 83 c4 10          	add    $0x10,%rsp
+  801cb7:	5b                   	pop    %rbx
+  801cb8:	41 5c                	pop    %r12
+  801cba:	5d                   	pop    %rbp
+  801cbb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cbc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cc1:	eb f0                	jmp    801cb3 <fstat+0x70>
+
+0000000000801cc3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cc3:	55                   	push   %rbp
+  801cc4:	48 89 e5             	mov    %rsp,%rbp
+  801cc7:	41 54                	push   %r12
+  801cc9:	53                   	push   %rbx
+  801cca:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd2:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+  801cde:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	78 25                	js     801d09 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ce4:	4c 89 e6             	mov    %r12,%rsi
+  801ce7:	89 c7                	mov    %eax,%edi
+  801ce9:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+  801cf5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801cf8:	89 df                	mov    %ebx,%edi
+  801cfa:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  801d01:	00 00 00 
+  801d04:	ff d0                	call   *%rax
+
+    return res;
+  801d06:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d09:	89 d8                	mov    %ebx,%eax
+  801d0b:	5b                   	pop    %rbx
+  801d0c:	41 5c                	pop    %r12
+  801d0e:	5d                   	pop    %rbp
+  801d0f:	c3                   	ret
+
+0000000000801d10 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801d10:	55                   	push   %rbp
+  801d11:	48 89 e5             	mov    %rsp,%rbp
+  801d14:	41 54                	push   %r12
+  801d16:	53                   	push   %rbx
+  801d17:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1b:	48 89 fb             	mov    %rdi,%rbx
+  801d1e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d21:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d25:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d2a:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801d31:	00 00 00 
+  801d34:	ff d0                	call   *%rax
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 1f                	js     801d59 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801d3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d3e:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801d42:	48 85 c0             	test   %rax,%rax
+  801d45:	74 1b                	je     801d62 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801d47:	4c 89 e6             	mov    %r12,%rsi
+  801d4a:	48 89 df             	mov    %rbx,%rdi
+  801d4d:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d56:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801d59:	48 83 c4 10          	add    $0x10,%rsp
+  801d5d:	5b                   	pop    %rbx
+  801d5e:	41 5c                	pop    %r12
+  801d60:	5d                   	pop    %rbp
+  801d61:	c3                   	ret
+        return -E_NOT_SUPP;
+  801d62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d67:	eb f0                	jmp    801d59 <create_snapshot+0x49>
+
+0000000000801d69 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801d71:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d75:	bf 66 00 00 00       	mov    $0x66,%edi
+  801d7a:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801d81:	00 00 00 
+  801d84:	ff d0                	call   *%rax
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 1e                	js     801da8 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801d8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d8e:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801d92:	48 85 d2             	test   %rdx,%rdx
+  801d95:	74 13                	je     801daa <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9c:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da5:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801da8:	c9                   	leave
+  801da9:	c3                   	ret
+        return -E_NOT_SUPP;
+  801daa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801daf:	eb f7                	jmp    801da8 <print_snapshot_list+0x3f>
+
+0000000000801db1 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	53                   	push   %rbx
+  801db6:	48 83 ec 18          	sub    $0x18,%rsp
+  801dba:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dbd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc1:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dc6:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 1c                	js     801df2 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801dd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dda:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801dde:	48 85 c0             	test   %rax,%rax
+  801de1:	74 15                	je     801df8 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801de3:	48 89 df             	mov    %rbx,%rdi
+  801de6:	ff d0                	call   *%rax
+    if (res < 0) {
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801def:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801df2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df6:	c9                   	leave
+  801df7:	c3                   	ret
+        return -E_NOT_SUPP;
+  801df8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dfd:	eb f3                	jmp    801df2 <accept_snapshot+0x41>
+
+0000000000801dff <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801dff:	55                   	push   %rbp
+  801e00:	48 89 e5             	mov    %rsp,%rbp
+  801e03:	53                   	push   %rbx
+  801e04:	48 83 ec 18          	sub    $0x18,%rsp
+  801e08:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e0b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e0f:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e14:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 1c                	js     801e40 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801e24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e28:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801e2c:	48 85 c0             	test   %rax,%rax
+  801e2f:	74 15                	je     801e46 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801e31:	48 89 df             	mov    %rbx,%rdi
+  801e34:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e36:	85 c0                	test   %eax,%eax
+  801e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e44:	c9                   	leave
+  801e45:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e46:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e4b:	eb f3                	jmp    801e40 <delete_snapshot+0x41>
+
+0000000000801e4d <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801e4d:	55                   	push   %rbp
+  801e4e:	48 89 e5             	mov    %rsp,%rbp
+  801e51:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e55:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e59:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e5e:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	78 14                	js     801e82 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801e6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e72:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801e76:	48 85 d2             	test   %rdx,%rdx
+  801e79:	74 09                	je     801e84 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e80:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801e82:	c9                   	leave
+  801e83:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e84:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e89:	eb f7                	jmp    801e82 <gc_snapshots+0x35>
+
+0000000000801e8b <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801e8b:	55                   	push   %rbp
+  801e8c:	48 89 e5             	mov    %rsp,%rbp
+  801e8f:	41 56                	push   %r14
+  801e91:	41 55                	push   %r13
+  801e93:	41 54                	push   %r12
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9a:	48 89 fb             	mov    %rdi,%rbx
+  801e9d:	49 89 f4             	mov    %rsi,%r12
+  801ea0:	49 89 d5             	mov    %rdx,%r13
+  801ea3:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ea6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eaa:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eaf:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+  801ebb:	85 c0                	test   %eax,%eax
+  801ebd:	78 1b                	js     801eda <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801ebf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ec3:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801ec7:	48 85 c0             	test   %rax,%rax
+  801eca:	74 1b                	je     801ee7 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801ecc:	4c 89 f1             	mov    %r14,%rcx
+  801ecf:	4c 89 ea             	mov    %r13,%rdx
+  801ed2:	4c 89 e6             	mov    %r12,%rsi
+  801ed5:	48 89 df             	mov    %rbx,%rdi
+  801ed8:	ff d0                	call   *%rax
+
+    return res;
+}
+  801eda:	48 83 c4 10          	add    $0x10,%rsp
+  801ede:	5b                   	pop    %rbx
+  801edf:	41 5c                	pop    %r12
+  801ee1:	41 5d                	pop    %r13
+  801ee3:	41 5e                	pop    %r14
+  801ee5:	5d                   	pop    %rbp
+  801ee6:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ee7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eec:	eb ec                	jmp    801eda <diff_snapshots+0x4f>
+
+0000000000801eee <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	41 55                	push   %r13
+  801ef4:	41 54                	push   %r12
+  801ef6:	53                   	push   %rbx
+  801ef7:	48 83 ec 18          	sub    $0x18,%rsp
+  801efb:	48 89 fb             	mov    %rdi,%rbx
+  801efe:	49 89 f4             	mov    %rsi,%r12
+  801f01:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f08:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f0d:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	78 18                	js     801f35 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f21:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801f25:	48 85 c0             	test   %rax,%rax
+  801f28:	74 16                	je     801f40 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801f2a:	4c 89 ea             	mov    %r13,%rdx
+  801f2d:	4c 89 e6             	mov    %r12,%rsi
+  801f30:	48 89 df             	mov    %rbx,%rdi
+  801f33:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f35:	48 83 c4 18          	add    $0x18,%rsp
+  801f39:	5b                   	pop    %rbx
+  801f3a:	41 5c                	pop    %r12
+  801f3c:	41 5d                	pop    %r13
+  801f3e:	5d                   	pop    %rbp
+  801f3f:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f40:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f45:	eb ee                	jmp    801f35 <send_snapshot+0x47>
+
+0000000000801f47 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801f47:	55                   	push   %rbp
+  801f48:	48 89 e5             	mov    %rsp,%rbp
+  801f4b:	53                   	push   %rbx
+  801f4c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f50:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f57:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f5c:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	78 12                	js     801f7e <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801f6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f70:	48 8b 40 78          	mov    0x78(%rax),%rax
+  801f74:	48 85 c0             	test   %rax,%rax
+  801f77:	74 0b                	je     801f84 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801f79:	48 89 df             	mov    %rbx,%rdi
+  801f7c:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f84:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f89:	eb f3                	jmp    801f7e <receive_snapshot+0x37>
+
+0000000000801f8b <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801f8b:	55                   	push   %rbp
+  801f8c:	48 89 e5             	mov    %rsp,%rbp
+  801f8f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f93:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f97:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f9c:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801fa3:	00 00 00 
+  801fa6:	ff d0                	call   *%rax
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 17                	js     801fc3 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  801fac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb0:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  801fb7:	48 85 d2             	test   %rdx,%rdx
+  801fba:	74 09                	je     801fc5 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  801fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc1:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  801fc3:	c9                   	leave
+  801fc4:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fc5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fca:	eb f7                	jmp    801fc3 <free_space_bytes+0x38>
+
+0000000000801fcc <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fd4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fd8:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fdd:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  801fe4:	00 00 00 
+  801fe7:	ff d0                	call   *%rax
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 17                	js     802004 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  801fed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff1:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801ff8:	48 85 d2             	test   %rdx,%rdx
+  801ffb:	74 09                	je     802006 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802002:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802004:	c9                   	leave
+  802005:	c3                   	ret
+        return -E_NOT_SUPP;
+  802006:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80200b:	eb f7                	jmp    802004 <busy_space_bytes+0x38>
+
+000000000080200d <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80200d:	55                   	push   %rbp
+  80200e:	48 89 e5             	mov    %rsp,%rbp
+  802011:	41 54                	push   %r12
+  802013:	53                   	push   %rbx
+  802014:	48 83 ec 10          	sub    $0x10,%rsp
+  802018:	89 fb                	mov    %edi,%ebx
+  80201a:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80201d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802021:	bf 66 00 00 00       	mov    $0x66,%edi
+  802026:	48 b8 23 16 80 00 00 	movabs $0x801623,%rax
+  80202d:	00 00 00 
+  802030:	ff d0                	call   *%rax
+  802032:	85 c0                	test   %eax,%eax
+  802034:	78 17                	js     80204d <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802036:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80203a:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802041:	48 85 c0             	test   %rax,%rax
+  802044:	74 10                	je     802056 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802046:	4c 89 e6             	mov    %r12,%rsi
+  802049:	89 df                	mov    %ebx,%edi
+  80204b:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80204d:	48 83 c4 10          	add    $0x10,%rsp
+  802051:	5b                   	pop    %rbx
+  802052:	41 5c                	pop    %r12
+  802054:	5d                   	pop    %rbp
+  802055:	c3                   	ret
+        return -E_NOT_SUPP;
+  802056:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80205b:	eb f0                	jmp    80204d <snapshots_space+0x40>
+
+000000000080205d <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80205d:	55                   	push   %rbp
+  80205e:	48 89 e5             	mov    %rsp,%rbp
+  802061:	41 55                	push   %r13
+  802063:	41 54                	push   %r12
+  802065:	53                   	push   %rbx
+  802066:	48 83 ec 08          	sub    $0x8,%rsp
+  80206a:	41 89 fd             	mov    %edi,%r13d
+  80206d:	48 89 f3             	mov    %rsi,%rbx
+  802070:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802073:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80207a:	00 00 00 
+  80207d:	83 38 00             	cmpl   $0x0,(%rax)
+  802080:	74 57                	je     8020d9 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802082:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802088:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80208d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802094:	00 00 00 
+  802097:	44 89 ee             	mov    %r13d,%esi
+  80209a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a1:	00 00 00 
+  8020a4:	8b 38                	mov    (%rax),%edi
+  8020a6:	48 b8 7d 35 80 00 00 	movabs $0x80357d,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8020b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b7:	4c 89 e2             	mov    %r12,%rdx
+  8020ba:	48 89 de             	mov    %rbx,%rsi
+  8020bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c2:	48 b8 65 35 80 00 00 	movabs $0x803565,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+}
+  8020ce:	48 83 c4 08          	add    $0x8,%rsp
+  8020d2:	5b                   	pop    %rbx
+  8020d3:	41 5c                	pop    %r12
+  8020d5:	41 5d                	pop    %r13
+  8020d7:	5d                   	pop    %rbp
+  8020d8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020d9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020de:	48 b8 3b 36 80 00 00 	movabs $0x80363b,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020f1:	00 00 
+  8020f3:	eb 8d                	jmp    802082 <fsipc_region+0x25>
+
+00000000008020f5 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  8020f9:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8020fd:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802104:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802105:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802109:	48 b8 5d 20 80 00 00 	movabs $0x80205d,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+}
+  802115:	c9                   	leave
+  802116:	c3                   	ret
+
+0000000000802117 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802117:	85 ff                	test   %edi,%edi
+  802119:	78 6d                	js     802188 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80211b:	55                   	push   %rbp
+  80211c:	48 89 e5             	mov    %rsp,%rbp
+  80211f:	41 54                	push   %r12
+  802121:	53                   	push   %rbx
+  802122:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802125:	48 85 f6             	test   %rsi,%rsi
+  802128:	74 57                	je     802181 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80212a:	89 f8                	mov    %edi,%eax
+  80212c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802133:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802135:	be 00 00 00 00       	mov    $0x0,%esi
+  80213a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80213f:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	78 2d                	js     80217c <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80214f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802156:	00 00 00 
+  802159:	49 63 14 24          	movslq (%r12),%rdx
+  80215d:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802164:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802169:	48 89 df             	mov    %rbx,%rdi
+  80216c:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  802173:	00 00 00 
+  802176:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802178:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80217c:	5b                   	pop    %rbx
+  80217d:	41 5c                	pop    %r12
+  80217f:	5d                   	pop    %rbp
+  802180:	c3                   	ret
+        return -E_INVAL;
+  802181:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802186:	eb f4                	jmp    80217c <devfile_df_snapshots+0x65>
+  802188:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80218d:	c3                   	ret
+
+000000000080218e <devfile_df_busy>:
+devfile_df_busy() {
+  80218e:	55                   	push   %rbp
+  80218f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802192:	be 00 00 00 00       	mov    $0x0,%esi
+  802197:	bf 11 00 00 00       	mov    $0x11,%edi
+  80219c:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8021a3:	00 00 00 
+  8021a6:	ff d0                	call   *%rax
+}
+  8021a8:	5d                   	pop    %rbp
+  8021a9:	c3                   	ret
+
+00000000008021aa <devfile_df_free>:
+devfile_df_free() {
+  8021aa:	55                   	push   %rbp
+  8021ab:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8021b8:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+}
+  8021c4:	5d                   	pop    %rbp
+  8021c5:	c3                   	ret
+
+00000000008021c6 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8021c6:	55                   	push   %rbp
+  8021c7:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8021ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cf:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021d4:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+}
+  8021e0:	5d                   	pop    %rbp
+  8021e1:	c3                   	ret
+
+00000000008021e2 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8021e2:	55                   	push   %rbp
+  8021e3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8021e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021eb:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021f0:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021fc:	85 c0                	test   %eax,%eax
+  8021fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802203:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802206:	5d                   	pop    %rbp
+  802207:	c3                   	ret
+
+0000000000802208 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802208:	55                   	push   %rbp
+  802209:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80220c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802213:	00 00 00 
+  802216:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802219:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80221b:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80221e:	be 00 00 00 00       	mov    $0x0,%esi
+  802223:	bf 02 00 00 00       	mov    $0x2,%edi
+  802228:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  80222f:	00 00 00 
+  802232:	ff d0                	call   *%rax
+}
+  802234:	5d                   	pop    %rbp
+  802235:	c3                   	ret
+
+0000000000802236 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802236:	55                   	push   %rbp
+  802237:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80223a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80223d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802244:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802246:	be 00 00 00 00       	mov    $0x0,%esi
+  80224b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802250:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+}
+  80225c:	5d                   	pop    %rbp
+  80225d:	c3                   	ret
+
+000000000080225e <devfile_write>:
+    if (!fd || !buf) {
+  80225e:	48 85 ff             	test   %rdi,%rdi
+  802261:	0f 84 c1 00 00 00    	je     802328 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	41 57                	push   %r15
+  80226d:	41 56                	push   %r14
+  80226f:	41 55                	push   %r13
+  802271:	41 54                	push   %r12
+  802273:	53                   	push   %rbx
+  802274:	48 83 ec 18          	sub    $0x18,%rsp
+  802278:	49 89 ff             	mov    %rdi,%r15
+  80227b:	49 89 f5             	mov    %rsi,%r13
+  80227e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802281:	48 85 f6             	test   %rsi,%rsi
+  802284:	0f 84 95 00 00 00    	je     80231f <devfile_write+0xc1>
+    while (n) {
+  80228a:	48 85 d2             	test   %rdx,%rdx
+  80228d:	0f 84 83 00 00 00    	je     802316 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802293:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80229a:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8022a1:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8022a4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022a9:	49 39 dc             	cmp    %rbx,%r12
+  8022ac:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8022b0:	48 89 da             	mov    %rbx,%rdx
+  8022b3:	4c 89 ee             	mov    %r13,%rsi
+  8022b6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022bd:	00 00 00 
+  8022c0:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022cc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8022d0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8022d3:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8022d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022dc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e1:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+        if (write < 0) {
+  8022ed:	85 c0                	test   %eax,%eax
+  8022ef:	78 21                	js     802312 <devfile_write+0xb4>
+        buf += write;
+  8022f1:	48 63 d0             	movslq %eax,%rdx
+  8022f4:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8022f7:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8022fa:	49 29 d4             	sub    %rdx,%r12
+  8022fd:	75 a5                	jne    8022a4 <devfile_write+0x46>
+    return totalWrite;
+  8022ff:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802303:	48 83 c4 18          	add    $0x18,%rsp
+  802307:	5b                   	pop    %rbx
+  802308:	41 5c                	pop    %r12
+  80230a:	41 5d                	pop    %r13
+  80230c:	41 5e                	pop    %r14
+  80230e:	41 5f                	pop    %r15
+  802310:	5d                   	pop    %rbp
+  802311:	c3                   	ret
+            return write;
+  802312:	48 98                	cltq
+  802314:	eb ed                	jmp    802303 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802316:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80231d:	eb e0                	jmp    8022ff <devfile_write+0xa1>
+        return -E_INVAL;
+  80231f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802326:	eb db                	jmp    802303 <devfile_write+0xa5>
+  802328:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80232f:	c3                   	ret
+
+0000000000802330 <devfile_read>:
+    if (!fd || !buf) {
+  802330:	48 85 ff             	test   %rdi,%rdi
+  802333:	0f 84 c0 00 00 00    	je     8023f9 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  80233d:	41 57                	push   %r15
+  80233f:	41 56                	push   %r14
+  802341:	41 55                	push   %r13
+  802343:	41 54                	push   %r12
+  802345:	53                   	push   %rbx
+  802346:	48 83 ec 18          	sub    $0x18,%rsp
+  80234a:	49 89 ff             	mov    %rdi,%r15
+  80234d:	49 89 f5             	mov    %rsi,%r13
+  802350:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802353:	48 85 f6             	test   %rsi,%rsi
+  802356:	0f 84 96 00 00 00    	je     8023f2 <devfile_read+0xc2>
+    while (n) {
+  80235c:	48 85 d2             	test   %rdx,%rdx
+  80235f:	0f 84 87 00 00 00    	je     8023ec <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802365:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80236c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80236d:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802374:	00 00 00 
+  802377:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80237b:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80237e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802383:	49 39 c4             	cmp    %rax,%r12
+  802386:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80238a:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80238e:	be 00 00 00 00       	mov    $0x0,%esi
+  802393:	bf 03 00 00 00       	mov    $0x3,%edi
+  802398:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	7e 37                	jle    8023df <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8023a8:	48 63 d8             	movslq %eax,%rbx
+  8023ab:	48 89 da             	mov    %rbx,%rdx
+  8023ae:	4c 89 f6             	mov    %r14,%rsi
+  8023b1:	4c 89 ef             	mov    %r13,%rdi
+  8023b4:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+        buf += read;
+  8023c0:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8023c3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8023c7:	49 29 dc             	sub    %rbx,%r12
+  8023ca:	75 ab                	jne    802377 <devfile_read+0x47>
+  return totalRead;
+  8023cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8023d0:	48 83 c4 18          	add    $0x18,%rsp
+  8023d4:	5b                   	pop    %rbx
+  8023d5:	41 5c                	pop    %r12
+  8023d7:	41 5d                	pop    %r13
+  8023d9:	41 5e                	pop    %r14
+  8023db:	41 5f                	pop    %r15
+  8023dd:	5d                   	pop    %rbp
+  8023de:	c3                   	ret
+            return read ? read : totalRead;
+  8023df:	48 63 d0             	movslq %eax,%rdx
+  8023e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023e6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8023ea:	eb e4                	jmp    8023d0 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8023ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8023f0:	eb da                	jmp    8023cc <devfile_read+0x9c>
+        return E_INVAL;
+  8023f2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023f7:	eb d7                	jmp    8023d0 <devfile_read+0xa0>
+  8023f9:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8023fe:	c3                   	ret
+
+00000000008023ff <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8023ff:	48 85 ff             	test   %rdi,%rdi
+  802402:	74 5f                	je     802463 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802404:	55                   	push   %rbp
+  802405:	48 89 e5             	mov    %rsp,%rbp
+  802408:	53                   	push   %rbx
+  802409:	48 83 ec 08          	sub    $0x8,%rsp
+  80240d:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802410:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802417:	00 00 00 
+  80241a:	ff d0                	call   *%rax
+  80241c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802422:	77 45                	ja     802469 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802424:	48 89 de             	mov    %rbx,%rsi
+  802427:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80242e:	00 00 00 
+  802431:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80243d:	be 00 00 00 00       	mov    $0x0,%esi
+  802442:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802447:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802453:	85 c0                	test   %eax,%eax
+  802455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80245d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802461:	c9                   	leave
+  802462:	c3                   	ret
+        return -E_INVAL;
+  802463:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802468:	c3                   	ret
+        return -E_INVAL;
+  802469:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80246e:	eb ed                	jmp    80245d <devfile_receive_snapshot+0x5e>
+
+0000000000802470 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	41 55                	push   %r13
+  802476:	41 54                	push   %r12
+  802478:	53                   	push   %rbx
+  802479:	48 83 ec 08          	sub    $0x8,%rsp
+  80247d:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802480:	48 85 f6             	test   %rsi,%rsi
+  802483:	0f 94 c0             	sete   %al
+  802486:	48 85 d2             	test   %rdx,%rdx
+  802489:	0f 94 c2             	sete   %dl
+  80248c:	08 d0                	or     %dl,%al
+  80248e:	0f 85 ad 00 00 00    	jne    802541 <devfile_send_snapshot+0xd1>
+  802494:	48 89 fb             	mov    %rdi,%rbx
+  802497:	49 89 f4             	mov    %rsi,%r12
+  80249a:	48 85 ff             	test   %rdi,%rdi
+  80249d:	0f 84 9e 00 00 00    	je     802541 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8024a3:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+  8024af:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024b5:	0f 87 8d 00 00 00    	ja     802548 <devfile_send_snapshot+0xd8>
+  8024bb:	4c 89 e7             	mov    %r12,%rdi
+  8024be:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8024d0:	77 7d                	ja     80254f <devfile_send_snapshot+0xdf>
+  8024d2:	4c 89 ef             	mov    %r13,%rdi
+  8024d5:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+  8024e1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024e7:	77 6d                	ja     802556 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8024e9:	48 89 de             	mov    %rbx,%rsi
+  8024ec:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024f3:	00 00 00 
+  8024f6:	48 bb ee 0a 80 00 00 	movabs $0x800aee,%rbx
+  8024fd:	00 00 00 
+  802500:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802502:	4c 89 e6             	mov    %r12,%rsi
+  802505:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  80250c:	00 00 00 
+  80250f:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802511:	4c 89 ee             	mov    %r13,%rsi
+  802514:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  80251b:	00 00 00 
+  80251e:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802520:	be 00 00 00 00       	mov    $0x0,%esi
+  802525:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80252a:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+}
+  802536:	48 83 c4 08          	add    $0x8,%rsp
+  80253a:	5b                   	pop    %rbx
+  80253b:	41 5c                	pop    %r12
+  80253d:	41 5d                	pop    %r13
+  80253f:	5d                   	pop    %rbp
+  802540:	c3                   	ret
+        return -E_INVAL;
+  802541:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802546:	eb ee                	jmp    802536 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802548:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80254d:	eb e7                	jmp    802536 <devfile_send_snapshot+0xc6>
+  80254f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802554:	eb e0                	jmp    802536 <devfile_send_snapshot+0xc6>
+  802556:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255b:	eb d9                	jmp    802536 <devfile_send_snapshot+0xc6>
+
+000000000080255d <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80255d:	48 85 ff             	test   %rdi,%rdi
+  802560:	0f 84 41 01 00 00    	je     8026a7 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	41 57                	push   %r15
+  80256c:	41 56                	push   %r14
+  80256e:	41 55                	push   %r13
+  802570:	41 54                	push   %r12
+  802572:	53                   	push   %rbx
+  802573:	48 83 ec 08          	sub    $0x8,%rsp
+  802577:	49 89 fc             	mov    %rdi,%r12
+  80257a:	49 89 f5             	mov    %rsi,%r13
+  80257d:	48 89 d3             	mov    %rdx,%rbx
+  802580:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802583:	48 85 f6             	test   %rsi,%rsi
+  802586:	0f 84 ff 00 00 00    	je     80268b <devfile_diff_snapshots+0x12e>
+  80258c:	48 85 d2             	test   %rdx,%rdx
+  80258f:	0f 84 fd 00 00 00    	je     802692 <devfile_diff_snapshots+0x135>
+  802595:	48 85 c9             	test   %rcx,%rcx
+  802598:	0f 84 f4 00 00 00    	je     802692 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80259e:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8025a5:	00 00 00 
+  8025a8:	ff d0                	call   *%rax
+  8025aa:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025b0:	0f 87 e3 00 00 00    	ja     802699 <devfile_diff_snapshots+0x13c>
+  8025b6:	4c 89 ef             	mov    %r13,%rdi
+  8025b9:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+  8025c5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025cb:	0f 87 cf 00 00 00    	ja     8026a0 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8025d1:	4c 89 e6             	mov    %r12,%rsi
+  8025d4:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8025db:	00 00 00 
+  8025de:	4c 89 e7             	mov    %r12,%rdi
+  8025e1:	49 bf ee 0a 80 00 00 	movabs $0x800aee,%r15
+  8025e8:	00 00 00 
+  8025eb:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8025ee:	4c 89 ee             	mov    %r13,%rsi
+  8025f1:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8025f8:	00 
+  8025f9:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8025fc:	48 8b 03             	mov    (%rbx),%rax
+  8025ff:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802606:	00 
+  802607:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80260b:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802612:	00 
+  802613:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802617:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  80261e:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  80261f:	be 00 00 00 00       	mov    $0x0,%esi
+  802624:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802629:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802635:	85 c0                	test   %eax,%eax
+  802637:	78 43                	js     80267c <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802639:	49 8b 04 24          	mov    (%r12),%rax
+  80263d:	48 89 03             	mov    %rax,(%rbx)
+  802640:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802645:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802649:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80264e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802652:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802657:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80265b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80265f:	48 c1 e2 03          	shl    $0x3,%rdx
+  802663:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802668:	4c 89 f7             	mov    %r14,%rdi
+  80266b:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  802672:	00 00 00 
+  802675:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802677:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80267c:	48 83 c4 08          	add    $0x8,%rsp
+  802680:	5b                   	pop    %rbx
+  802681:	41 5c                	pop    %r12
+  802683:	41 5d                	pop    %r13
+  802685:	41 5e                	pop    %r14
+  802687:	41 5f                	pop    %r15
+  802689:	5d                   	pop    %rbp
+  80268a:	c3                   	ret
+        return -E_INVAL;
+  80268b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802690:	eb ea                	jmp    80267c <devfile_diff_snapshots+0x11f>
+  802692:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802697:	eb e3                	jmp    80267c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802699:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80269e:	eb dc                	jmp    80267c <devfile_diff_snapshots+0x11f>
+  8026a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a5:	eb d5                	jmp    80267c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8026a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026ac:	c3                   	ret
+
+00000000008026ad <devfile_delete_snapshot>:
+    if (!name) {
+  8026ad:	48 85 ff             	test   %rdi,%rdi
+  8026b0:	74 5f                	je     802711 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8026b2:	55                   	push   %rbp
+  8026b3:	48 89 e5             	mov    %rsp,%rbp
+  8026b6:	53                   	push   %rbx
+  8026b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026bb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8026be:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8026c5:	00 00 00 
+  8026c8:	ff d0                	call   *%rax
+  8026ca:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8026d0:	77 45                	ja     802717 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8026d2:	48 89 de             	mov    %rbx,%rsi
+  8026d5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026dc:	00 00 00 
+  8026df:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8026eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026f5:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8026fc:	00 00 00 
+  8026ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802701:	85 c0                	test   %eax,%eax
+  802703:	ba 00 00 00 00       	mov    $0x0,%edx
+  802708:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80270b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270f:	c9                   	leave
+  802710:	c3                   	ret
+        return -E_INVAL;
+  802711:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802716:	c3                   	ret
+        return -E_INVAL;
+  802717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80271c:	eb ed                	jmp    80270b <devfile_delete_snapshot+0x5e>
+
+000000000080271e <devfile_accept_snapshot>:
+    if (!name) {
+  80271e:	48 85 ff             	test   %rdi,%rdi
+  802721:	74 5f                	je     802782 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802723:	55                   	push   %rbp
+  802724:	48 89 e5             	mov    %rsp,%rbp
+  802727:	53                   	push   %rbx
+  802728:	48 83 ec 08          	sub    $0x8,%rsp
+  80272c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80272f:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+  80273b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802741:	77 45                	ja     802788 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802743:	48 89 de             	mov    %rbx,%rsi
+  802746:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80274d:	00 00 00 
+  802750:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80275c:	be 00 00 00 00       	mov    $0x0,%esi
+  802761:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802766:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  80276d:	00 00 00 
+  802770:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802772:	85 c0                	test   %eax,%eax
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80277c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802780:	c9                   	leave
+  802781:	c3                   	ret
+        return -E_INVAL;
+  802782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802787:	c3                   	ret
+        return -E_INVAL;
+  802788:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80278d:	eb ed                	jmp    80277c <devfile_accept_snapshot+0x5e>
+
+000000000080278f <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80278f:	48 85 ff             	test   %rdi,%rdi
+  802792:	0f 84 9f 00 00 00    	je     802837 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802798:	55                   	push   %rbp
+  802799:	48 89 e5             	mov    %rsp,%rbp
+  80279c:	41 54                	push   %r12
+  80279e:	53                   	push   %rbx
+  80279f:	48 89 fb             	mov    %rdi,%rbx
+  8027a2:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8027a5:	48 85 f6             	test   %rsi,%rsi
+  8027a8:	74 78                	je     802822 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8027aa:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8027b1:	00 00 00 
+  8027b4:	ff d0                	call   *%rax
+  8027b6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027bc:	77 6b                	ja     802829 <devfile_create_snapshot+0x9a>
+  8027be:	4c 89 e7             	mov    %r12,%rdi
+  8027c1:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8027c8:	00 00 00 
+  8027cb:	ff d0                	call   *%rax
+  8027cd:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027d3:	77 5b                	ja     802830 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8027d5:	48 89 de             	mov    %rbx,%rsi
+  8027d8:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027df:	00 00 00 
+  8027e2:	48 bb ee 0a 80 00 00 	movabs $0x800aee,%rbx
+  8027e9:	00 00 00 
+  8027ec:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8027ee:	4c 89 e6             	mov    %r12,%rsi
+  8027f1:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8027f8:	00 00 00 
+  8027fb:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8027fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802802:	bf 08 00 00 00       	mov    $0x8,%edi
+  802807:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802813:	85 c0                	test   %eax,%eax
+  802815:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80281d:	5b                   	pop    %rbx
+  80281e:	41 5c                	pop    %r12
+  802820:	5d                   	pop    %rbp
+  802821:	c3                   	ret
+        return -E_INVAL;
+  802822:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802827:	eb f4                	jmp    80281d <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80282e:	eb ed                	jmp    80281d <devfile_create_snapshot+0x8e>
+  802830:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802835:	eb e6                	jmp    80281d <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80283c:	c3                   	ret
+
+000000000080283d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80283d:	55                   	push   %rbp
+  80283e:	48 89 e5             	mov    %rsp,%rbp
+  802841:	41 54                	push   %r12
+  802843:	53                   	push   %rbx
+  802844:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802847:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80284a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802851:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802853:	be 00 00 00 00       	mov    $0x0,%esi
+  802858:	bf 05 00 00 00       	mov    $0x5,%edi
+  80285d:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	78 3d                	js     8028aa <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80286d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802874:	00 00 00 
+  802877:	4c 89 e6             	mov    %r12,%rsi
+  80287a:	48 89 df             	mov    %rbx,%rdi
+  80287d:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802889:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802890:	00 
+  802891:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802897:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80289e:	00 
+  80289f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8028a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028aa:	5b                   	pop    %rbx
+  8028ab:	41 5c                	pop    %r12
+  8028ad:	5d                   	pop    %rbp
+  8028ae:	c3                   	ret
+
+00000000008028af <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8028af:	55                   	push   %rbp
+  8028b0:	48 89 e5             	mov    %rsp,%rbp
+  8028b3:	41 57                	push   %r15
+  8028b5:	41 56                	push   %r14
+  8028b7:	41 55                	push   %r13
+  8028b9:	41 54                	push   %r12
+  8028bb:	53                   	push   %rbx
+  8028bc:	48 83 ec 38          	sub    $0x38,%rsp
+  8028c0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8028c4:	49 89 f5             	mov    %rsi,%r13
+  8028c7:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028ca:	48 89 f0             	mov    %rsi,%rax
+  8028cd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028d2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8028d6:	75 4f                	jne    802927 <devfile_readmap+0x78>
+  8028d8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028dc:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028e2:	75 1f                	jne    802903 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8028e4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028e8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8028ec:	49 be 97 30 80 00 00 	movabs $0x803097,%r14
+  8028f3:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8028f6:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8028fd:	0f 87 9d 00 00 00    	ja     8029a0 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802903:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802907:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  80290b:	4d 85 ff             	test   %r15,%r15
+  80290e:	0f 85 cf 00 00 00    	jne    8029e3 <devfile_readmap+0x134>
+  802914:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802918:	48 83 c4 38          	add    $0x38,%rsp
+  80291c:	5b                   	pop    %rbx
+  80291d:	41 5c                	pop    %r12
+  80291f:	41 5d                	pop    %r13
+  802921:	41 5e                	pop    %r14
+  802923:	41 5f                	pop    %r15
+  802925:	5d                   	pop    %rbp
+  802926:	c3                   	ret
+    size_t totalRead = 0;
+  802927:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80292e:	00 
+  80292f:	eb da                	jmp    80290b <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802931:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802935:	8b 40 0c             	mov    0xc(%rax),%eax
+  802938:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  80293f:	00 00 00 
+  802942:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802944:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802948:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  80294c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802950:	4c 89 ee             	mov    %r13,%rsi
+  802953:	bf 14 00 00 00       	mov    $0x14,%edi
+  802958:	48 b8 5d 20 80 00 00 	movabs $0x80205d,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802964:	85 c0                	test   %eax,%eax
+  802966:	7e a3                	jle    80290b <devfile_readmap+0x5c>
+  802968:	48 98                	cltq
+  80296a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80296e:	72 9b                	jb     80290b <devfile_readmap+0x5c>
+        buf += read;
+  802970:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802973:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802976:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  80297a:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802981:	75 88                	jne    80290b <devfile_readmap+0x5c>
+  802983:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802987:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80298d:	0f 85 78 ff ff ff    	jne    80290b <devfile_readmap+0x5c>
+  802993:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  80299a:	0f 86 6b ff ff ff    	jbe    80290b <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  8029a0:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  8029a6:	4d 39 e7             	cmp    %r12,%r15
+  8029a9:	4d 0f 46 e7          	cmovbe %r15,%r12
+  8029ad:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  8029b4:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029b8:	0f 84 73 ff ff ff    	je     802931 <devfile_readmap+0x82>
+  8029be:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029c2:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8029c7:	41 ff d6             	call   *%r14
+  8029ca:	a8 40                	test   $0x40,%al
+  8029cc:	0f 85 39 ff ff ff    	jne    80290b <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8029d2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029d9:	4c 39 e3             	cmp    %r12,%rbx
+  8029dc:	72 e4                	jb     8029c2 <devfile_readmap+0x113>
+  8029de:	e9 4e ff ff ff       	jmp    802931 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8029e3:	4c 89 fa             	mov    %r15,%rdx
+  8029e6:	4c 89 ee             	mov    %r13,%rsi
+  8029e9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029ed:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8029f9:	48 85 c0             	test   %rax,%rax
+  8029fc:	78 0c                	js     802a0a <devfile_readmap+0x15b>
+    return totalRead + read;
+  8029fe:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a02:	48 01 f0             	add    %rsi,%rax
+  802a05:	e9 0e ff ff ff       	jmp    802918 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802a0a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a0e:	48 85 f6             	test   %rsi,%rsi
+  802a11:	48 0f 45 c6          	cmovne %rsi,%rax
+  802a15:	e9 fe fe ff ff       	jmp    802918 <devfile_readmap+0x69>
+
+0000000000802a1a <open>:
+open(const char *path, int mode) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	41 55                	push   %r13
+  802a20:	41 54                	push   %r12
+  802a22:	53                   	push   %rbx
+  802a23:	48 83 ec 18          	sub    $0x18,%rsp
+  802a27:	49 89 fc             	mov    %rdi,%r12
+  802a2a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a2d:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+  802a39:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a3f:	0f 87 8a 00 00 00    	ja     802acf <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a45:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a49:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	89 c3                	mov    %eax,%ebx
+  802a57:	85 c0                	test   %eax,%eax
+  802a59:	78 50                	js     802aab <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a5b:	4c 89 e6             	mov    %r12,%rsi
+  802a5e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802a65:	00 00 00 
+  802a68:	48 89 df             	mov    %rbx,%rdi
+  802a6b:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802a77:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a7e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a82:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a87:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+  802a93:	89 c3                	mov    %eax,%ebx
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	78 1f                	js     802ab8 <open+0x9e>
+    return fd2num(fd);
+  802a99:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a9d:	48 b8 4a 15 80 00 00 	movabs $0x80154a,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+  802aa9:	89 c3                	mov    %eax,%ebx
+}
+  802aab:	89 d8                	mov    %ebx,%eax
+  802aad:	48 83 c4 18          	add    $0x18,%rsp
+  802ab1:	5b                   	pop    %rbx
+  802ab2:	41 5c                	pop    %r12
+  802ab4:	41 5d                	pop    %r13
+  802ab6:	5d                   	pop    %rbp
+  802ab7:	c3                   	ret
+        fd_close(fd, 0);
+  802ab8:	be 00 00 00 00       	mov    $0x0,%esi
+  802abd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ac1:	48 b8 93 16 80 00 00 	movabs $0x801693,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+        return res;
+  802acd:	eb dc                	jmp    802aab <open+0x91>
+        return -E_BAD_PATH;
+  802acf:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ad4:	eb d5                	jmp    802aab <open+0x91>
+
+0000000000802ad6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802ad6:	55                   	push   %rbp
+  802ad7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802ada:	be 00 00 00 00       	mov    $0x0,%esi
+  802adf:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ae4:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+}
+  802af0:	5d                   	pop    %rbp
+  802af1:	c3                   	ret
+
+0000000000802af2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802af2:	55                   	push   %rbp
+  802af3:	48 89 e5             	mov    %rsp,%rbp
+  802af6:	41 54                	push   %r12
+  802af8:	53                   	push   %rbx
+  802af9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802afc:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802b03:	00 00 00 
+  802b06:	ff d0                	call   *%rax
+  802b08:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b0b:	48 be c0 3c 80 00 00 	movabs $0x803cc0,%rsi
+  802b12:	00 00 00 
+  802b15:	48 89 df             	mov    %rbx,%rdi
+  802b18:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802b24:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b29:	41 2b 04 24          	sub    (%r12),%eax
+  802b2d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b33:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b3a:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b3d:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802b44:	00 00 00 
+  802b47:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b53:	5b                   	pop    %rbx
+  802b54:	41 5c                	pop    %r12
+  802b56:	5d                   	pop    %rbp
+  802b57:	c3                   	ret
+
+0000000000802b58 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b58:	55                   	push   %rbp
+  802b59:	48 89 e5             	mov    %rsp,%rbp
+  802b5c:	41 54                	push   %r12
+  802b5e:	53                   	push   %rbx
+  802b5f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b67:	48 89 fe             	mov    %rdi,%rsi
+  802b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6f:	49 bc 46 12 80 00 00 	movabs $0x801246,%r12
+  802b76:	00 00 00 
+  802b79:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b7c:	48 89 df             	mov    %rbx,%rdi
+  802b7f:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	48 89 c6             	mov    %rax,%rsi
+  802b8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b93:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b98:	41 ff d4             	call   *%r12
+}
+  802b9b:	5b                   	pop    %rbx
+  802b9c:	41 5c                	pop    %r12
+  802b9e:	5d                   	pop    %rbp
+  802b9f:	c3                   	ret
+
+0000000000802ba0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ba0:	55                   	push   %rbp
+  802ba1:	48 89 e5             	mov    %rsp,%rbp
+  802ba4:	41 57                	push   %r15
+  802ba6:	41 56                	push   %r14
+  802ba8:	41 55                	push   %r13
+  802baa:	41 54                	push   %r12
+  802bac:	53                   	push   %rbx
+  802bad:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb1:	49 89 fc             	mov    %rdi,%r12
+  802bb4:	49 89 f5             	mov    %rsi,%r13
+  802bb7:	49 89 d7             	mov    %rdx,%r15
+  802bba:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bbe:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802bca:	4d 85 ff             	test   %r15,%r15
+  802bcd:	0f 84 af 00 00 00    	je     802c82 <devpipe_write+0xe2>
+  802bd3:	48 89 c3             	mov    %rax,%rbx
+  802bd6:	4c 89 f8             	mov    %r15,%rax
+  802bd9:	4d 89 ef             	mov    %r13,%r15
+  802bdc:	4c 01 e8             	add    %r13,%rax
+  802bdf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802be3:	49 bd 4e 11 80 00 00 	movabs $0x80114e,%r13
+  802bea:	00 00 00 
+            sys_yield();
+  802bed:	49 be eb 10 80 00 00 	movabs $0x8010eb,%r14
+  802bf4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802bf7:	8b 73 04             	mov    0x4(%rbx),%esi
+  802bfa:	48 63 ce             	movslq %esi,%rcx
+  802bfd:	48 63 03             	movslq (%rbx),%rax
+  802c00:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c06:	48 39 c1             	cmp    %rax,%rcx
+  802c09:	72 2e                	jb     802c39 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c0b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c10:	48 89 da             	mov    %rbx,%rdx
+  802c13:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c18:	4c 89 e7             	mov    %r12,%rdi
+  802c1b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	74 66                	je     802c88 <devpipe_write+0xe8>
+            sys_yield();
+  802c22:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c25:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c28:	48 63 ce             	movslq %esi,%rcx
+  802c2b:	48 63 03             	movslq (%rbx),%rax
+  802c2e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c34:	48 39 c1             	cmp    %rax,%rcx
+  802c37:	73 d2                	jae    802c0b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c39:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c3d:	48 89 ca             	mov    %rcx,%rdx
+  802c40:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c44:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c4b:	08 10 20 
+  802c4e:	48 f7 e2             	mul    %rdx
+  802c51:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c55:	48 89 d0             	mov    %rdx,%rax
+  802c58:	48 c1 e0 09          	shl    $0x9,%rax
+  802c5c:	48 29 d0             	sub    %rdx,%rax
+  802c5f:	48 c1 e0 03          	shl    $0x3,%rax
+  802c63:	48 29 c1             	sub    %rax,%rcx
+  802c66:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c6b:	83 c6 01             	add    $0x1,%esi
+  802c6e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c71:	49 83 c7 01          	add    $0x1,%r15
+  802c75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c79:	49 39 c7             	cmp    %rax,%r15
+  802c7c:	0f 85 75 ff ff ff    	jne    802bf7 <devpipe_write+0x57>
+    return n;
+  802c82:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c86:	eb 05                	jmp    802c8d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8d:	48 83 c4 18          	add    $0x18,%rsp
+  802c91:	5b                   	pop    %rbx
+  802c92:	41 5c                	pop    %r12
+  802c94:	41 5d                	pop    %r13
+  802c96:	41 5e                	pop    %r14
+  802c98:	41 5f                	pop    %r15
+  802c9a:	5d                   	pop    %rbp
+  802c9b:	c3                   	ret
+
+0000000000802c9c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c9c:	55                   	push   %rbp
+  802c9d:	48 89 e5             	mov    %rsp,%rbp
+  802ca0:	41 57                	push   %r15
+  802ca2:	41 56                	push   %r14
+  802ca4:	41 55                	push   %r13
+  802ca6:	41 54                	push   %r12
+  802ca8:	53                   	push   %rbx
+  802ca9:	48 83 ec 18          	sub    $0x18,%rsp
+  802cad:	49 89 fc             	mov    %rdi,%r12
+  802cb0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802cb4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cb8:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802cbf:	00 00 00 
+  802cc2:	ff d0                	call   *%rax
+  802cc4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802cc7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ccd:	49 bd 4e 11 80 00 00 	movabs $0x80114e,%r13
+  802cd4:	00 00 00 
+            sys_yield();
+  802cd7:	49 be eb 10 80 00 00 	movabs $0x8010eb,%r14
+  802cde:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802ce1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ce6:	74 7d                	je     802d65 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ce8:	8b 03                	mov    (%rbx),%eax
+  802cea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ced:	75 26                	jne    802d15 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802cef:	4d 85 ff             	test   %r15,%r15
+  802cf2:	75 77                	jne    802d6b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cf4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cf9:	48 89 da             	mov    %rbx,%rdx
+  802cfc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d01:	4c 89 e7             	mov    %r12,%rdi
+  802d04:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d07:	85 c0                	test   %eax,%eax
+  802d09:	74 72                	je     802d7d <devpipe_read+0xe1>
+            sys_yield();
+  802d0b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d0e:	8b 03                	mov    (%rbx),%eax
+  802d10:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d13:	74 df                	je     802cf4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d15:	48 63 c8             	movslq %eax,%rcx
+  802d18:	48 89 ca             	mov    %rcx,%rdx
+  802d1b:	48 c1 ea 03          	shr    $0x3,%rdx
+  802d1f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d26:	08 10 20 
+  802d29:	48 89 d0             	mov    %rdx,%rax
+  802d2c:	48 f7 e6             	mul    %rsi
+  802d2f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d33:	48 89 d0             	mov    %rdx,%rax
+  802d36:	48 c1 e0 09          	shl    $0x9,%rax
+  802d3a:	48 29 d0             	sub    %rdx,%rax
+  802d3d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d44:	00 
+  802d45:	48 89 c8             	mov    %rcx,%rax
+  802d48:	48 29 d0             	sub    %rdx,%rax
+  802d4b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d50:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d54:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d58:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d5b:	49 83 c7 01          	add    $0x1,%r15
+  802d5f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d63:	75 83                	jne    802ce8 <devpipe_read+0x4c>
+    return n;
+  802d65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d69:	eb 03                	jmp    802d6e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d6b:	4c 89 f8             	mov    %r15,%rax
+}
+  802d6e:	48 83 c4 18          	add    $0x18,%rsp
+  802d72:	5b                   	pop    %rbx
+  802d73:	41 5c                	pop    %r12
+  802d75:	41 5d                	pop    %r13
+  802d77:	41 5e                	pop    %r14
+  802d79:	41 5f                	pop    %r15
+  802d7b:	5d                   	pop    %rbp
+  802d7c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d82:	eb ea                	jmp    802d6e <devpipe_read+0xd2>
+
+0000000000802d84 <pipe>:
+pipe(int pfd[2]) {
+  802d84:	55                   	push   %rbp
+  802d85:	48 89 e5             	mov    %rsp,%rbp
+  802d88:	41 55                	push   %r13
+  802d8a:	41 54                	push   %r12
+  802d8c:	53                   	push   %rbx
+  802d8d:	48 83 ec 18          	sub    $0x18,%rsp
+  802d91:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802d94:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d98:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+  802da4:	89 c3                	mov    %eax,%ebx
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	0f 88 a0 01 00 00    	js     802f4e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802dae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802db3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802db8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc1:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+  802dcd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	0f 88 77 01 00 00    	js     802f4e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dd7:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ddb:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	89 c3                	mov    %eax,%ebx
+  802de9:	85 c0                	test   %eax,%eax
+  802deb:	0f 88 43 01 00 00    	js     802f34 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802df1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802df6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dfb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802dff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e04:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+  802e10:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	0f 88 1a 01 00 00    	js     802f34 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802e1a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e1e:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802e25:	00 00 00 
+  802e28:	ff d0                	call   *%rax
+  802e2a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e2d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e37:	48 89 c6             	mov    %rax,%rsi
+  802e3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e3f:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  802e46:	00 00 00 
+  802e49:	ff d0                	call   *%rax
+  802e4b:	89 c3                	mov    %eax,%ebx
+  802e4d:	85 c0                	test   %eax,%eax
+  802e4f:	0f 88 c5 00 00 00    	js     802f1a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e55:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e59:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	48 89 c1             	mov    %rax,%rcx
+  802e68:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e6e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e79:	4c 89 ee             	mov    %r13,%rsi
+  802e7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e81:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+  802e8d:	89 c3                	mov    %eax,%ebx
+  802e8f:	85 c0                	test   %eax,%eax
+  802e91:	78 6e                	js     802f01 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802e93:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e98:	4c 89 ef             	mov    %r13,%rdi
+  802e9b:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+  802ea7:	83 f8 02             	cmp    $0x2,%eax
+  802eaa:	0f 85 ab 00 00 00    	jne    802f5b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802eb0:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802eb7:	00 00 
+  802eb9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ebd:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ebf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ec3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802eca:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ece:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ed0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ed4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802edb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802edf:	48 bb 4a 15 80 00 00 	movabs $0x80154a,%rbx
+  802ee6:	00 00 00 
+  802ee9:	ff d3                	call   *%rbx
+  802eeb:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802eef:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ef3:	ff d3                	call   *%rbx
+  802ef5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802efa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eff:	eb 4d                	jmp    802f4e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f06:	4c 89 ee             	mov    %r13,%rsi
+  802f09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0e:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802f1a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f1f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f28:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f39:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f42:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+}
+  802f4e:	89 d8                	mov    %ebx,%eax
+  802f50:	48 83 c4 18          	add    $0x18,%rsp
+  802f54:	5b                   	pop    %rbx
+  802f55:	41 5c                	pop    %r12
+  802f57:	41 5d                	pop    %r13
+  802f59:	5d                   	pop    %rbp
+  802f5a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f5b:	48 b9 f0 3c 80 00 00 	movabs $0x803cf0,%rcx
+  802f62:	00 00 00 
+  802f65:	48 ba c7 3c 80 00 00 	movabs $0x803cc7,%rdx
+  802f6c:	00 00 00 
+  802f6f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f74:	48 bf dc 3c 80 00 00 	movabs $0x803cdc,%rdi
+  802f7b:	00 00 00 
+  802f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f83:	49 b8 db 33 80 00 00 	movabs $0x8033db,%r8
+  802f8a:	00 00 00 
+  802f8d:	41 ff d0             	call   *%r8
+
+0000000000802f90 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802f90:	55                   	push   %rbp
+  802f91:	48 89 e5             	mov    %rsp,%rbp
+  802f94:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f98:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f9c:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	78 35                	js     802fe1 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802fac:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb0:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  802fb7:	00 00 00 
+  802fba:	ff d0                	call   *%rax
+  802fbc:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fbf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fc4:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fc9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fcd:	48 b8 4e 11 80 00 00 	movabs $0x80114e,%rax
+  802fd4:	00 00 00 
+  802fd7:	ff d0                	call   *%rax
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	0f 94 c0             	sete   %al
+  802fde:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe1:	c9                   	leave
+  802fe2:	c3                   	ret
+
+0000000000802fe3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802fe3:	48 89 f8             	mov    %rdi,%rax
+  802fe6:	48 c1 e8 27          	shr    $0x27,%rax
+  802fea:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ff1:	01 00 00 
+  802ff4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ff8:	f6 c2 01             	test   $0x1,%dl
+  802ffb:	74 6d                	je     80306a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ffd:	48 89 f8             	mov    %rdi,%rax
+  803000:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803004:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80300b:	01 00 00 
+  80300e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803012:	f6 c2 01             	test   $0x1,%dl
+  803015:	74 62                	je     803079 <get_uvpt_entry+0x96>
+  803017:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80301e:	01 00 00 
+  803021:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803025:	f6 c2 80             	test   $0x80,%dl
+  803028:	75 4f                	jne    803079 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80302a:	48 89 f8             	mov    %rdi,%rax
+  80302d:	48 c1 e8 15          	shr    $0x15,%rax
+  803031:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803038:	01 00 00 
+  80303b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80303f:	f6 c2 01             	test   $0x1,%dl
+  803042:	74 44                	je     803088 <get_uvpt_entry+0xa5>
+  803044:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80304b:	01 00 00 
+  80304e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803052:	f6 c2 80             	test   $0x80,%dl
+  803055:	75 31                	jne    803088 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803057:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80305b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803062:	01 00 00 
+  803065:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803069:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80306a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803071:	01 00 00 
+  803074:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803078:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803079:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803080:	01 00 00 
+  803083:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803087:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803088:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80308f:	01 00 00 
+  803092:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803096:	c3                   	ret
+
+0000000000803097 <get_prot>:
+
+int
+get_prot(void *va) {
+  803097:	55                   	push   %rbp
+  803098:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80309b:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8030aa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8030af:	89 c1                	mov    %eax,%ecx
+  8030b1:	83 c9 04             	or     $0x4,%ecx
+  8030b4:	f6 c2 01             	test   $0x1,%dl
+  8030b7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8030ba:	89 c1                	mov    %eax,%ecx
+  8030bc:	83 c9 02             	or     $0x2,%ecx
+  8030bf:	f6 c2 02             	test   $0x2,%dl
+  8030c2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8030c5:	89 c1                	mov    %eax,%ecx
+  8030c7:	83 c9 01             	or     $0x1,%ecx
+  8030ca:	48 85 d2             	test   %rdx,%rdx
+  8030cd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030d0:	89 c1                	mov    %eax,%ecx
+  8030d2:	83 c9 40             	or     $0x40,%ecx
+  8030d5:	f6 c6 04             	test   $0x4,%dh
+  8030d8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030db:	5d                   	pop    %rbp
+  8030dc:	c3                   	ret
+
+00000000008030dd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030dd:	55                   	push   %rbp
+  8030de:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030e1:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  8030e8:	00 00 00 
+  8030eb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8030ed:	48 c1 e8 06          	shr    $0x6,%rax
+  8030f1:	83 e0 01             	and    $0x1,%eax
+}
+  8030f4:	5d                   	pop    %rbp
+  8030f5:	c3                   	ret
+
+00000000008030f6 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8030f6:	55                   	push   %rbp
+  8030f7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030fa:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  803101:	00 00 00 
+  803104:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803106:	48 c1 e8 05          	shr    $0x5,%rax
+  80310a:	83 e0 01             	and    $0x1,%eax
+}
+  80310d:	5d                   	pop    %rbp
+  80310e:	c3                   	ret
+
+000000000080310f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80310f:	55                   	push   %rbp
+  803110:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803113:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+  80311f:	83 e0 01             	and    $0x1,%eax
+}
+  803122:	5d                   	pop    %rbp
+  803123:	c3                   	ret
+
+0000000000803124 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	41 57                	push   %r15
+  80312a:	41 56                	push   %r14
+  80312c:	41 55                	push   %r13
+  80312e:	41 54                	push   %r12
+  803130:	53                   	push   %rbx
+  803131:	48 83 ec 18          	sub    $0x18,%rsp
+  803135:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803139:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80313d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803142:	49 bd 0f 31 80 00 00 	movabs $0x80310f,%r13
+  803149:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80314c:	49 bf 97 30 80 00 00 	movabs $0x803097,%r15
+  803153:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803156:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80315d:	00 00 00 
+  803160:	eb 0c                	jmp    80316e <foreach_shared_region+0x4a>
+  803162:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803169:	4c 39 f3             	cmp    %r14,%rbx
+  80316c:	74 2e                	je     80319c <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80316e:	48 89 df             	mov    %rbx,%rdi
+  803171:	41 ff d5             	call   *%r13
+  803174:	84 c0                	test   %al,%al
+  803176:	74 ea                	je     803162 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803178:	48 89 df             	mov    %rbx,%rdi
+  80317b:	41 ff d7             	call   *%r15
+  80317e:	a8 40                	test   $0x40,%al
+  803180:	74 e0                	je     803162 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803182:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803189:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80318d:	48 89 df             	mov    %rbx,%rdi
+  803190:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803194:	ff d0                	call   *%rax
+				if (res < 0) {
+  803196:	85 c0                	test   %eax,%eax
+  803198:	79 c8                	jns    803162 <foreach_shared_region+0x3e>
+  80319a:	eb 05                	jmp    8031a1 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80319c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031a1:	48 83 c4 18          	add    $0x18,%rsp
+  8031a5:	5b                   	pop    %rbx
+  8031a6:	41 5c                	pop    %r12
+  8031a8:	41 5d                	pop    %r13
+  8031aa:	41 5e                	pop    %r14
+  8031ac:	41 5f                	pop    %r15
+  8031ae:	5d                   	pop    %rbp
+  8031af:	c3                   	ret
+
+00000000008031b0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b5:	c3                   	ret
+
+00000000008031b6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031b6:	55                   	push   %rbp
+  8031b7:	48 89 e5             	mov    %rsp,%rbp
+  8031ba:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031bd:	48 be 14 3d 80 00 00 	movabs $0x803d14,%rsi
+  8031c4:	00 00 00 
+  8031c7:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  8031ce:	00 00 00 
+  8031d1:	ff d0                	call   *%rax
+    return 0;
+}
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	5d                   	pop    %rbp
+  8031d9:	c3                   	ret
+
+00000000008031da <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031da:	55                   	push   %rbp
+  8031db:	48 89 e5             	mov    %rsp,%rbp
+  8031de:	41 57                	push   %r15
+  8031e0:	41 56                	push   %r14
+  8031e2:	41 55                	push   %r13
+  8031e4:	41 54                	push   %r12
+  8031e6:	53                   	push   %rbx
+  8031e7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031ee:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031f5:	48 85 d2             	test   %rdx,%rdx
+  8031f8:	74 7a                	je     803274 <devcons_write+0x9a>
+  8031fa:	49 89 d6             	mov    %rdx,%r14
+  8031fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803203:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803208:	49 bf e8 0c 80 00 00 	movabs $0x800ce8,%r15
+  80320f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803212:	4c 89 f3             	mov    %r14,%rbx
+  803215:	48 29 f3             	sub    %rsi,%rbx
+  803218:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80321d:	48 39 c3             	cmp    %rax,%rbx
+  803220:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803224:	4c 63 eb             	movslq %ebx,%r13
+  803227:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80322e:	48 01 c6             	add    %rax,%rsi
+  803231:	4c 89 ea             	mov    %r13,%rdx
+  803234:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80323b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80323e:	4c 89 ee             	mov    %r13,%rsi
+  803241:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803248:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  80324f:	00 00 00 
+  803252:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803254:	41 01 dc             	add    %ebx,%r12d
+  803257:	49 63 f4             	movslq %r12d,%rsi
+  80325a:	4c 39 f6             	cmp    %r14,%rsi
+  80325d:	72 b3                	jb     803212 <devcons_write+0x38>
+    return res;
+  80325f:	49 63 c4             	movslq %r12d,%rax
+}
+  803262:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803269:	5b                   	pop    %rbx
+  80326a:	41 5c                	pop    %r12
+  80326c:	41 5d                	pop    %r13
+  80326e:	41 5e                	pop    %r14
+  803270:	41 5f                	pop    %r15
+  803272:	5d                   	pop    %rbp
+  803273:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803274:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80327a:	eb e3                	jmp    80325f <devcons_write+0x85>
+
+000000000080327c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80327c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80327f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803284:	48 85 c0             	test   %rax,%rax
+  803287:	74 55                	je     8032de <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803289:	55                   	push   %rbp
+  80328a:	48 89 e5             	mov    %rsp,%rbp
+  80328d:	41 55                	push   %r13
+  80328f:	41 54                	push   %r12
+  803291:	53                   	push   %rbx
+  803292:	48 83 ec 08          	sub    $0x8,%rsp
+  803296:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803299:	48 bb 1e 10 80 00 00 	movabs $0x80101e,%rbx
+  8032a0:	00 00 00 
+  8032a3:	49 bc eb 10 80 00 00 	movabs $0x8010eb,%r12
+  8032aa:	00 00 00 
+  8032ad:	eb 03                	jmp    8032b2 <devcons_read+0x36>
+  8032af:	41 ff d4             	call   *%r12
+  8032b2:	ff d3                	call   *%rbx
+  8032b4:	85 c0                	test   %eax,%eax
+  8032b6:	74 f7                	je     8032af <devcons_read+0x33>
+    if (c < 0) return c;
+  8032b8:	48 63 d0             	movslq %eax,%rdx
+  8032bb:	78 13                	js     8032d0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c2:	83 f8 04             	cmp    $0x4,%eax
+  8032c5:	74 09                	je     8032d0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032c7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032cb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032d0:	48 89 d0             	mov    %rdx,%rax
+  8032d3:	48 83 c4 08          	add    $0x8,%rsp
+  8032d7:	5b                   	pop    %rbx
+  8032d8:	41 5c                	pop    %r12
+  8032da:	41 5d                	pop    %r13
+  8032dc:	5d                   	pop    %rbp
+  8032dd:	c3                   	ret
+  8032de:	48 89 d0             	mov    %rdx,%rax
+  8032e1:	c3                   	ret
+
+00000000008032e2 <cputchar>:
+cputchar(int ch) {
+  8032e2:	55                   	push   %rbp
+  8032e3:	48 89 e5             	mov    %rsp,%rbp
+  8032e6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032ea:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8032f3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032f7:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+}
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+
+0000000000803305 <getchar>:
+getchar(void) {
+  803305:	55                   	push   %rbp
+  803306:	48 89 e5             	mov    %rsp,%rbp
+  803309:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80330d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803312:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331b:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	78 06                	js     803333 <getchar+0x2e>
+  80332d:	74 08                	je     803337 <getchar+0x32>
+  80332f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803333:	89 d0                	mov    %edx,%eax
+  803335:	c9                   	leave
+  803336:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803337:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80333c:	eb f5                	jmp    803333 <getchar+0x2e>
+
+000000000080333e <iscons>:
+iscons(int fdnum) {
+  80333e:	55                   	push   %rbp
+  80333f:	48 89 e5             	mov    %rsp,%rbp
+  803342:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803346:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80334a:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803356:	85 c0                	test   %eax,%eax
+  803358:	78 18                	js     803372 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80335a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335e:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803365:	00 00 00 
+  803368:	8b 00                	mov    (%rax),%eax
+  80336a:	39 02                	cmp    %eax,(%rdx)
+  80336c:	0f 94 c0             	sete   %al
+  80336f:	0f b6 c0             	movzbl %al,%eax
+}
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+0000000000803374 <opencons>:
+opencons(void) {
+  803374:	55                   	push   %rbp
+  803375:	48 89 e5             	mov    %rsp,%rbp
+  803378:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80337c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803380:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  803387:	00 00 00 
+  80338a:	ff d0                	call   *%rax
+  80338c:	85 c0                	test   %eax,%eax
+  80338e:	78 49                	js     8033d9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803390:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803395:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80339a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80339e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a3:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	78 26                	js     8033d9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b7:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8033be:	00 00 
+  8033c0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033c6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033cd:	48 b8 4a 15 80 00 00 	movabs $0x80154a,%rax
+  8033d4:	00 00 00 
+  8033d7:	ff d0                	call   *%rax
+}
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+
+00000000008033db <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033db:	55                   	push   %rbp
+  8033dc:	48 89 e5             	mov    %rsp,%rbp
+  8033df:	41 56                	push   %r14
+  8033e1:	41 55                	push   %r13
+  8033e3:	41 54                	push   %r12
+  8033e5:	53                   	push   %rbx
+  8033e6:	48 83 ec 50          	sub    $0x50,%rsp
+  8033ea:	49 89 fc             	mov    %rdi,%r12
+  8033ed:	41 89 f5             	mov    %esi,%r13d
+  8033f0:	48 89 d3             	mov    %rdx,%rbx
+  8033f3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033f7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8033fb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8033ff:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803406:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80340a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80340e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803412:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803416:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80341d:	00 00 00 
+  803420:	4c 8b 30             	mov    (%rax),%r14
+  803423:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  80342a:	00 00 00 
+  80342d:	ff d0                	call   *%rax
+  80342f:	89 c6                	mov    %eax,%esi
+  803431:	45 89 e8             	mov    %r13d,%r8d
+  803434:	4c 89 e1             	mov    %r12,%rcx
+  803437:	4c 89 f2             	mov    %r14,%rdx
+  80343a:	48 bf 20 3d 80 00 00 	movabs $0x803d20,%rdi
+  803441:	00 00 00 
+  803444:	b8 00 00 00 00       	mov    $0x0,%eax
+  803449:	49 bc c9 01 80 00 00 	movabs $0x8001c9,%r12
+  803450:	00 00 00 
+  803453:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803456:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80345a:	48 89 df             	mov    %rbx,%rdi
+  80345d:	48 b8 65 01 80 00 00 	movabs $0x800165,%rax
+  803464:	00 00 00 
+  803467:	ff d0                	call   *%rax
+    cprintf("\n");
+  803469:	48 bf 9a 36 80 00 00 	movabs $0x80369a,%rdi
+  803470:	00 00 00 
+  803473:	b8 00 00 00 00       	mov    $0x0,%eax
+  803478:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80347b:	cc                   	int3
+  80347c:	eb fd                	jmp    80347b <_panic+0xa0>
+
+000000000080347e <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80347e:	55                   	push   %rbp
+  80347f:	48 89 e5             	mov    %rsp,%rbp
+  803482:	41 55                	push   %r13
+  803484:	41 54                	push   %r12
+  803486:	53                   	push   %rbx
+  803487:	48 83 ec 08          	sub    $0x8,%rsp
+  80348b:	49 89 fc             	mov    %rdi,%r12
+  80348e:	48 89 f7             	mov    %rsi,%rdi
+  803491:	48 89 d3             	mov    %rdx,%rbx
+  803494:	49 89 cd             	mov    %rcx,%r13
+  803497:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80349a:	48 85 f6             	test   %rsi,%rsi
+  80349d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034a4:	00 00 00 
+  8034a7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8034ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034b0:	48 85 db             	test   %rbx,%rbx
+  8034b3:	74 03                	je     8034b8 <ipc_recv_timed+0x3a>
+  8034b5:	48 8b 33             	mov    (%rbx),%rsi
+  8034b8:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 75                	js     80353d <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034c8:	4d 85 e4             	test   %r12,%r12
+  8034cb:	74 14                	je     8034e1 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034cd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034d4:	00 00 00 
+  8034d7:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034dd:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034e1:	4d 85 ed             	test   %r13,%r13
+  8034e4:	74 14                	je     8034fa <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034e6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ed:	00 00 00 
+  8034f0:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034f6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034fa:	48 85 db             	test   %rbx,%rbx
+  8034fd:	74 23                	je     803522 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034ff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803506:	00 00 00 
+  803509:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80350f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803514:	85 c9                	test   %ecx,%ecx
+  803516:	74 07                	je     80351f <ipc_recv_timed+0xa1>
+  803518:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80351f:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803522:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803529:	00 00 00 
+  80352c:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803532:	48 83 c4 08          	add    $0x8,%rsp
+  803536:	5b                   	pop    %rbx
+  803537:	41 5c                	pop    %r12
+  803539:	41 5d                	pop    %r13
+  80353b:	5d                   	pop    %rbp
+  80353c:	c3                   	ret
+        if (from_env_store != NULL) {
+  80353d:	4d 85 e4             	test   %r12,%r12
+  803540:	74 08                	je     80354a <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803542:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803549:	00 
+        if (perm_store != NULL) {
+  80354a:	4d 85 ed             	test   %r13,%r13
+  80354d:	74 08                	je     803557 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80354f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803556:	00 
+        if (size != NULL) {
+  803557:	48 85 db             	test   %rbx,%rbx
+  80355a:	74 d6                	je     803532 <ipc_recv_timed+0xb4>
+            *size = 0;
+  80355c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803563:	eb cd                	jmp    803532 <ipc_recv_timed+0xb4>
+
+0000000000803565 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803565:	55                   	push   %rbp
+  803566:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80356f:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  803576:	00 00 00 
+  803579:	ff d0                	call   *%rax
+}
+  80357b:	5d                   	pop    %rbp
+  80357c:	c3                   	ret
+
+000000000080357d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80357d:	55                   	push   %rbp
+  80357e:	48 89 e5             	mov    %rsp,%rbp
+  803581:	41 57                	push   %r15
+  803583:	41 56                	push   %r14
+  803585:	41 55                	push   %r13
+  803587:	41 54                	push   %r12
+  803589:	53                   	push   %rbx
+  80358a:	48 83 ec 18          	sub    $0x18,%rsp
+  80358e:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803591:	48 89 d3             	mov    %rdx,%rbx
+  803594:	49 89 cc             	mov    %rcx,%r12
+  803597:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80359a:	48 85 d2             	test   %rdx,%rdx
+  80359d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035a4:	00 00 00 
+  8035a7:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035ab:	89 f0                	mov    %esi,%eax
+  8035ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8035b1:	48 89 da             	mov    %rbx,%rdx
+  8035b4:	48 89 c6             	mov    %rax,%rsi
+  8035b7:	48 b8 e8 13 80 00 00 	movabs $0x8013e8,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	79 65                	jns    80362c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035c7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035ca:	75 33                	jne    8035ff <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035cc:	49 bf eb 10 80 00 00 	movabs $0x8010eb,%r15
+  8035d3:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035d6:	49 be e8 13 80 00 00 	movabs $0x8013e8,%r14
+  8035dd:	00 00 00 
+        sys_yield();
+  8035e0:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035e3:	45 89 e8             	mov    %r13d,%r8d
+  8035e6:	4c 89 e1             	mov    %r12,%rcx
+  8035e9:	48 89 da             	mov    %rbx,%rdx
+  8035ec:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035f0:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035f3:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	79 32                	jns    80362c <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035fa:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035fd:	74 e1                	je     8035e0 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035ff:	89 c1                	mov    %eax,%ecx
+  803601:	48 ba 43 3d 80 00 00 	movabs $0x803d43,%rdx
+  803608:	00 00 00 
+  80360b:	be 52 00 00 00       	mov    $0x52,%esi
+  803610:	48 bf 57 3d 80 00 00 	movabs $0x803d57,%rdi
+  803617:	00 00 00 
+  80361a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361f:	49 b8 db 33 80 00 00 	movabs $0x8033db,%r8
+  803626:	00 00 00 
+  803629:	41 ff d0             	call   *%r8
+    }
+}
+  80362c:	48 83 c4 18          	add    $0x18,%rsp
+  803630:	5b                   	pop    %rbx
+  803631:	41 5c                	pop    %r12
+  803633:	41 5d                	pop    %r13
+  803635:	41 5e                	pop    %r14
+  803637:	41 5f                	pop    %r15
+  803639:	5d                   	pop    %rbp
+  80363a:	c3                   	ret
+
+000000000080363b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80363b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803640:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803647:	00 00 00 
+  80364a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80364e:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803652:	48 c1 e2 04          	shl    $0x4,%rdx
+  803656:	48 01 ca             	add    %rcx,%rdx
+  803659:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80365f:	39 fa                	cmp    %edi,%edx
+  803661:	74 12                	je     803675 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803663:	48 83 c0 01          	add    $0x1,%rax
+  803667:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80366d:	75 db                	jne    80364a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80366f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803674:	c3                   	ret
+            return envs[i].env_id;
+  803675:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803679:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80367d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803681:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803688:	00 00 00 
+  80368b:	48 01 d0             	add    %rdx,%rax
+  80368e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803694:	c3                   	ret
+  803695:	0f 1f 00             	nopl   (%rax)
+
+0000000000803698 <__rodata_start>:
+  803698:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  80369d:	75 6e                	jne    80370d <__rodata_start+0x75>
+  80369f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036a3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036a4:	3e 00 30             	ds add %dh,(%rax)
+  8036a7:	31 32                	xor    %esi,(%rdx)
+  8036a9:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036b0:	41                   	rex.B
+  8036b1:	42                   	rex.X
+  8036b2:	43                   	rex.XB
+  8036b3:	44                   	rex.R
+  8036b4:	45                   	rex.RB
+  8036b5:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036b8:	31 32                	xor    %esi,(%rdx)
+  8036ba:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036c1:	61                   	(bad)
+  8036c2:	62 63 64 65 66       	(bad)
+  8036c7:	00 28                	add    %ch,(%rax)
+  8036c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ca:	75 6c                	jne    803738 <__rodata_start+0xa0>
+  8036cc:	6c                   	insb   (%dx),%es:(%rdi)
+  8036cd:	29 00                	sub    %eax,(%rax)
+  8036cf:	65 72 72             	gs jb  803744 <__rodata_start+0xac>
+  8036d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036d3:	72 20                	jb     8036f5 <__rodata_start+0x5d>
+  8036d5:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8036da:	73 70                	jae    80374c <__rodata_start+0xb4>
+  8036dc:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8036e0:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8036e7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036e8:	72 00                	jb     8036ea <__rodata_start+0x52>
+  8036ea:	62 61 64 20 65       	(bad)
+  8036ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f0:	76 69                	jbe    80375b <__rodata_start+0xc3>
+  8036f2:	72 6f                	jb     803763 <__rodata_start+0xcb>
+  8036f4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f5:	6d                   	insl   (%dx),%es:(%rdi)
+  8036f6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8036f8:	74 00                	je     8036fa <__rodata_start+0x62>
+  8036fa:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803701:	20 70 61             	and    %dh,0x61(%rax)
+  803704:	72 61                	jb     803767 <__rodata_start+0xcf>
+  803706:	6d                   	insl   (%dx),%es:(%rdi)
+  803707:	65 74 65             	gs je  80376f <__rodata_start+0xd7>
+  80370a:	72 00                	jb     80370c <__rodata_start+0x74>
+  80370c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80370d:	75 74                	jne    803783 <__rodata_start+0xeb>
+  80370f:	20 6f 66             	and    %ch,0x66(%rdi)
+  803712:	20 6d 65             	and    %ch,0x65(%rbp)
+  803715:	6d                   	insl   (%dx),%es:(%rdi)
+  803716:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803717:	72 79                	jb     803792 <__rodata_start+0xfa>
+  803719:	00 6f 75             	add    %ch,0x75(%rdi)
+  80371c:	74 20                	je     80373e <__rodata_start+0xa6>
+  80371e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80371f:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803723:	76 69                	jbe    80378e <__rodata_start+0xf6>
+  803725:	72 6f                	jb     803796 <__rodata_start+0xfe>
+  803727:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803728:	6d                   	insl   (%dx),%es:(%rdi)
+  803729:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80372b:	74 73                	je     8037a0 <__rodata_start+0x108>
+  80372d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803730:	72 72                	jb     8037a4 <__rodata_start+0x10c>
+  803732:	75 70                	jne    8037a4 <__rodata_start+0x10c>
+  803734:	74 65                	je     80379b <__rodata_start+0x103>
+  803736:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80373b:	75 67                	jne    8037a4 <__rodata_start+0x10c>
+  80373d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803740:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803742:	00 73 65             	add    %dh,0x65(%rbx)
+  803745:	67 6d                	insl   (%dx),%es:(%edi)
+  803747:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803749:	74 61                	je     8037ac <__rodata_start+0x114>
+  80374b:	74 69                	je     8037b6 <__rodata_start+0x11e>
+  80374d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80374f:	20 66 61             	and    %ah,0x61(%rsi)
+  803752:	75 6c                	jne    8037c0 <__rodata_start+0x128>
+  803754:	74 00                	je     803756 <__rodata_start+0xbe>
+  803756:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80375d:	20 45 4c             	and    %al,0x4c(%rbp)
+  803760:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803764:	61                   	(bad)
+  803765:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80376a:	20 73 75             	and    %dh,0x75(%rbx)
+  80376d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803770:	73 79                	jae    8037eb <__rodata_start+0x153>
+  803772:	73 74                	jae    8037e8 <__rodata_start+0x150>
+  803774:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803776:	20 63 61             	and    %ah,0x61(%rbx)
+  803779:	6c                   	insb   (%dx),%es:(%rdi)
+  80377a:	6c                   	insb   (%dx),%es:(%rdi)
+  80377b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80377e:	74 72                	je     8037f2 <__rodata_start+0x15a>
+  803780:	79 20                	jns    8037a2 <__rodata_start+0x10a>
+  803782:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803783:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803784:	74 20                	je     8037a6 <__rodata_start+0x10e>
+  803786:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803788:	75 6e                	jne    8037f8 <__rodata_start+0x160>
+  80378a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80378e:	76 20                	jbe    8037b0 <__rodata_start+0x118>
+  803790:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803797:	72 65                	jb     8037fe <__rodata_start+0x166>
+  803799:	63 76 69             	movsxd 0x69(%rsi),%esi
+  80379c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379d:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8037a1:	65 78 70             	gs js  803814 <__rodata_start+0x17c>
+  8037a4:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037a9:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037ac:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037b0:	20 66 69             	and    %ah,0x69(%rsi)
+  8037b3:	6c                   	insb   (%dx),%es:(%rdi)
+  8037b4:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037b8:	20 66 72             	and    %ah,0x72(%rsi)
+  8037bb:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037c0:	61                   	(bad)
+  8037c1:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c6:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037ca:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037cf:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037d3:	79 20                	jns    8037f5 <__rodata_start+0x15d>
+  8037d5:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8037dc:	72 65                	jb     803843 <__rodata_start+0x1ab>
+  8037de:	20 6f 70             	and    %ch,0x70(%rdi)
+  8037e1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037e3:	00 66 69             	add    %ah,0x69(%rsi)
+  8037e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8037e7:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8037eb:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8037ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ef:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8037f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f4:	74 20                	je     803816 <__rodata_start+0x17e>
+  8037f6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037f8:	75 6e                	jne    803868 <__rodata_start+0x1d0>
+  8037fa:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8037fe:	76 61                	jbe    803861 <__rodata_start+0x1c9>
+  803800:	6c                   	insb   (%dx),%es:(%rdi)
+  803801:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803808:	00 
+  803809:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803810:	72 65                	jb     803877 <__rodata_start+0x1df>
+  803812:	61                   	(bad)
+  803813:	64 79 20             	fs jns 803836 <__rodata_start+0x19e>
+  803816:	65 78 69             	gs js  803882 <__rodata_start+0x1ea>
+  803819:	73 74                	jae    80388f <__rodata_start+0x1f7>
+  80381b:	73 00                	jae    80381d <__rodata_start+0x185>
+  80381d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80381e:	70 65                	jo     803885 <__rodata_start+0x1ed>
+  803820:	72 61                	jb     803883 <__rodata_start+0x1eb>
+  803822:	74 69                	je     80388d <__rodata_start+0x1f5>
+  803824:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803825:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803826:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803829:	74 20                	je     80384b <__rodata_start+0x1b3>
+  80382b:	73 75                	jae    8038a2 <__rodata_start+0x20a>
+  80382d:	70 70                	jo     80389f <__rodata_start+0x207>
+  80382f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803830:	72 74                	jb     8038a6 <__rodata_start+0x20e>
+  803832:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803838:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80383d:	74 00                	je     80383f <__rodata_start+0x1a7>
+  80383f:	90                   	nop
+  803840:	b6 03                	mov    $0x3,%dh
+  803842:	80 00 00             	addb   $0x0,(%rax)
+  803845:	00 00                	add    %al,(%rax)
+  803847:	00 f7                	add    %dh,%bh
+  803849:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80384f:	00 e7                	add    %ah,%bh
+  803851:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803857:	00 f7                	add    %dh,%bh
+  803859:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80385f:	00 f7                	add    %dh,%bh
+  803861:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803867:	00 f7                	add    %dh,%bh
+  803869:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80386f:	00 f7                	add    %dh,%bh
+  803871:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803877:	00 d5                	add    %dl,%ch
+  803879:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80387f:	00 f7                	add    %dh,%bh
+  803881:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803887:	00 f7                	add    %dh,%bh
+  803889:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80388f:	00 c9                	add    %cl,%cl
+  803891:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  803897:	00 43 04             	add    %al,0x4(%rbx)
+  80389a:	80 00 00             	addb   $0x0,(%rax)
+  80389d:	00 00                	add    %al,(%rax)
+  80389f:	00 f7                	add    %dh,%bh
+  8038a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038a7:	00 c9                	add    %cl,%cl
+  8038a9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8038af:	00 0f                	add    %cl,(%rdi)
+  8038b1:	04 80                	add    $0x80,%al
+  8038b3:	00 00                	add    %al,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 0f                	add    %cl,(%rdi)
+  8038b9:	04 80                	add    $0x80,%al
+  8038bb:	00 00                	add    %al,(%rax)
+  8038bd:	00 00                	add    %al,(%rax)
+  8038bf:	00 0f                	add    %cl,(%rdi)
+  8038c1:	04 80                	add    $0x80,%al
+  8038c3:	00 00                	add    %al,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 0f                	add    %cl,(%rdi)
+  8038c9:	04 80                	add    $0x80,%al
+  8038cb:	00 00                	add    %al,(%rax)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 0f                	add    %cl,(%rdi)
+  8038d1:	04 80                	add    $0x80,%al
+  8038d3:	00 00                	add    %al,(%rax)
+  8038d5:	00 00                	add    %al,(%rax)
+  8038d7:	00 0f                	add    %cl,(%rdi)
+  8038d9:	04 80                	add    $0x80,%al
+  8038db:	00 00                	add    %al,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 0f                	add    %cl,(%rdi)
+  8038e1:	04 80                	add    $0x80,%al
+  8038e3:	00 00                	add    %al,(%rax)
+  8038e5:	00 00                	add    %al,(%rax)
+  8038e7:	00 0f                	add    %cl,(%rdi)
+  8038e9:	04 80                	add    $0x80,%al
+  8038eb:	00 00                	add    %al,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 0f                	add    %cl,(%rdi)
+  8038f1:	04 80                	add    $0x80,%al
+  8038f3:	00 00                	add    %al,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 f7                	add    %dh,%bh
+  8038f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038ff:	00 f7                	add    %dh,%bh
+  803901:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803907:	00 f7                	add    %dh,%bh
+  803909:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80390f:	00 f7                	add    %dh,%bh
+  803911:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803917:	00 f7                	add    %dh,%bh
+  803919:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80391f:	00 f7                	add    %dh,%bh
+  803921:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803927:	00 f7                	add    %dh,%bh
+  803929:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80392f:	00 f7                	add    %dh,%bh
+  803931:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803937:	00 f7                	add    %dh,%bh
+  803939:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80393f:	00 f7                	add    %dh,%bh
+  803941:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803947:	00 f7                	add    %dh,%bh
+  803949:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80394f:	00 f7                	add    %dh,%bh
+  803951:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803957:	00 f7                	add    %dh,%bh
+  803959:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80395f:	00 f7                	add    %dh,%bh
+  803961:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803967:	00 f7                	add    %dh,%bh
+  803969:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80396f:	00 f7                	add    %dh,%bh
+  803971:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803977:	00 f7                	add    %dh,%bh
+  803979:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80397f:	00 f7                	add    %dh,%bh
+  803981:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803987:	00 f7                	add    %dh,%bh
+  803989:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80398f:	00 f7                	add    %dh,%bh
+  803991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803997:	00 f7                	add    %dh,%bh
+  803999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80399f:	00 f7                	add    %dh,%bh
+  8039a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039a7:	00 f7                	add    %dh,%bh
+  8039a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039af:	00 f7                	add    %dh,%bh
+  8039b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039b7:	00 f7                	add    %dh,%bh
+  8039b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039bf:	00 f7                	add    %dh,%bh
+  8039c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039c7:	00 f7                	add    %dh,%bh
+  8039c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039cf:	00 f7                	add    %dh,%bh
+  8039d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039d7:	00 f7                	add    %dh,%bh
+  8039d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039df:	00 f7                	add    %dh,%bh
+  8039e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039e7:	00 1a                	add    %bl,(%rdx)
+  8039e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ef:	00 f7                	add    %dh,%bh
+  8039f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039f7:	00 f7                	add    %dh,%bh
+  8039f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8039ff:	00 f7                	add    %dh,%bh
+  803a01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a07:	00 f7                	add    %dh,%bh
+  803a09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a0f:	00 f7                	add    %dh,%bh
+  803a11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a17:	00 f7                	add    %dh,%bh
+  803a19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a1f:	00 f7                	add    %dh,%bh
+  803a21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a27:	00 f7                	add    %dh,%bh
+  803a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a2f:	00 f7                	add    %dh,%bh
+  803a31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a37:	00 f7                	add    %dh,%bh
+  803a39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a3f:	00 66 04             	add    %ah,0x4(%rsi)
+  803a42:	80 00 00             	addb   $0x0,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ba53 <__bss_end+0x3a53>
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 f7                	add    %dh,%bh
+  803a51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a57:	00 f7                	add    %dh,%bh
+  803a59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a5f:	00 f7                	add    %dh,%bh
+  803a61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a67:	00 f7                	add    %dh,%bh
+  803a69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a6f:	00 95 04 80 00 00    	add    %dl,0x8004(%rbp)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 f7                	add    %dh,%bh
+  803a79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a7f:	00 f7                	add    %dh,%bh
+  803a81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a87:	00 5b 04             	add    %bl,0x4(%rbx)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 f7                	add    %dh,%bh
+  803a91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a97:	00 f7                	add    %dh,%bh
+  803a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a9f:	00 dd                	add    %bl,%ch
+  803aa1:	07                   	(bad)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 a7 08 80 00 00    	add    %ah,0x8008(%rdi)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 f7                	add    %dh,%bh
+  803ab1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ab7:	00 f7                	add    %dh,%bh
+  803ab9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803abf:	00 2c 05 80 00 00 00 	add    %ch,0x80(,%rax,1)
+  803ac6:	00 00                	add    %al,(%rax)
+  803ac8:	f7 09 80 00 00 00    	testl  $0x80,(%rcx)
+  803ace:	00 00                	add    %al,(%rax)
+  803ad0:	09 07                	or     %eax,(%rdi)
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 f7                	add    %dh,%bh
+  803ad9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803adf:	00 f7                	add    %dh,%bh
+  803ae1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ae7:	00 1a                	add    %bl,(%rdx)
+  803ae9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aef:	00 f7                	add    %dh,%bh
+  803af1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803af7:	00 bf 03 80 00 00    	add    %bh,0x8003(%rdi)
+  803afd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803b00 <error_string>:
+	...
+  803b08:	d8 36 80 00 00 00 00 00 ea 36 80 00 00 00 00 00     .6.......6......
+  803b18:	fa 36 80 00 00 00 00 00 0c 37 80 00 00 00 00 00     .6.......7......
+  803b28:	1a 37 80 00 00 00 00 00 2e 37 80 00 00 00 00 00     .7.......7......
+  803b38:	43 37 80 00 00 00 00 00 56 37 80 00 00 00 00 00     C7......V7......
+  803b48:	68 37 80 00 00 00 00 00 7c 37 80 00 00 00 00 00     h7......|7......
+  803b58:	8c 37 80 00 00 00 00 00 9f 37 80 00 00 00 00 00     .7.......7......
+  803b68:	b6 37 80 00 00 00 00 00 cc 37 80 00 00 00 00 00     .7.......7......
+  803b78:	e4 37 80 00 00 00 00 00 fc 37 80 00 00 00 00 00     .7.......7......
+  803b88:	09 38 80 00 00 00 00 00 a8 3b 80 00 00 00 00 00     .8.......;......
+  803b98:	1d 38 80 00 00 00 00 00 35 38 80 00 00 00 00 00     .8......58......
+  803ba8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803bb8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803bc8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803bd8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803be8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803bf8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c18:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803c28:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803c38:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c48:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c58:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803c68:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803c78:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803c88:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803c98:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ca0 <devtab>:
+  803ca0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803cb0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803cc0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803cd0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803ce0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803cf0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d00:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d10:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d20:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803d30:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803d40:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803d50:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,6616 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $14"); /* page fault */
+  800025:	cd 0e                	int    $0xe
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	41 89 fd             	mov    %edi,%r13d
+  800036:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800039:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800040:	00 00 00 
+  800043:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80004a:	00 00 00 
+  80004d:	48 39 c2             	cmp    %rax,%rdx
+  800050:	73 17                	jae    800069 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800052:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800055:	49 89 c4             	mov    %rax,%r12
+  800058:	48 83 c3 08          	add    $0x8,%rbx
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	ff 53 f8             	call   *-0x8(%rbx)
+  800064:	4c 39 e3             	cmp    %r12,%rbx
+  800067:	72 ef                	jb     800058 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80007e:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800082:	48 c1 e0 04          	shl    $0x4,%rax
+  800086:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008d:	00 00 00 
+  800090:	48 01 d0             	add    %rdx,%rax
+  800093:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80009a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009d:	45 85 ed             	test   %r13d,%r13d
+  8000a0:	7e 0d                	jle    8000af <libmain+0x87>
+  8000a2:	49 8b 06             	mov    (%r14),%rax
+  8000a5:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ac:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000af:	4c 89 f6             	mov    %r14,%rsi
+  8000b2:	44 89 ef             	mov    %r13d,%edi
+  8000b5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000bc:	00 00 00 
+  8000bf:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c1:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  8000c8:	00 00 00 
+  8000cb:	ff d0                	call   *%rax
+#endif
+}
+  8000cd:	5b                   	pop    %rbx
+  8000ce:	41 5c                	pop    %r12
+  8000d0:	41 5d                	pop    %r13
+  8000d2:	41 5e                	pop    %r14
+  8000d4:	5d                   	pop    %rbp
+  8000d5:	c3                   	ret
+
+00000000008000d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d6:	55                   	push   %rbp
+  8000d7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000da:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000eb:	48 b8 57 01 80 00 00 	movabs $0x800157,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+}
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+  8000fd:	53                   	push   %rbx
+  8000fe:	48 89 fa             	mov    %rdi,%rdx
+  800101:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80010e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+  800118:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80011e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800120:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800124:	c9                   	leave
+  800125:	c3                   	ret
+
+0000000000800126 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800126:	55                   	push   %rbp
+  800127:	48 89 e5             	mov    %rsp,%rbp
+  80012a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800130:	ba 00 00 00 00       	mov    $0x0,%edx
+  800135:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80013a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800144:	be 00 00 00 00       	mov    $0x0,%esi
+  800149:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800151:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+0000000000800157 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800157:	55                   	push   %rbp
+  800158:	48 89 e5             	mov    %rsp,%rbp
+  80015b:	53                   	push   %rbx
+  80015c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800160:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800163:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800168:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800182:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800184:	48 85 c0             	test   %rax,%rax
+  800187:	7f 06                	jg     80018f <sys_env_destroy+0x38>
+}
+  800189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018d:	c9                   	leave
+  80018e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018f:	49 89 c0             	mov    %rax,%r8
+  800192:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800197:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80019e:	00 00 00 
+  8001a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a6:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8001ad:	00 00 00 
+  8001b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b5:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  8001bc:	00 00 00 
+  8001bf:	41 ff d1             	call   *%r9
+
+00000000008001c2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c2:	55                   	push   %rbp
+  8001c3:	48 89 e5             	mov    %rsp,%rbp
+  8001c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001eb:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+00000000008001f3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f3:	55                   	push   %rbp
+  8001f4:	48 89 e5             	mov    %rsp,%rbp
+  8001f7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800202:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800211:	be 00 00 00 00       	mov    $0x0,%esi
+  800216:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80021c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800222:	c9                   	leave
+  800223:	c3                   	ret
+
+0000000000800224 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800224:	55                   	push   %rbp
+  800225:	48 89 e5             	mov    %rsp,%rbp
+  800228:	53                   	push   %rbx
+  800229:	48 89 fa             	mov    %rdi,%rdx
+  80022c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800234:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023b:	00 00 00 
+  80023e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800243:	be 00 00 00 00       	mov    $0x0,%esi
+  800248:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800250:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800254:	c9                   	leave
+  800255:	c3                   	ret
+
+0000000000800256 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800256:	55                   	push   %rbp
+  800257:	48 89 e5             	mov    %rsp,%rbp
+  80025a:	53                   	push   %rbx
+  80025b:	49 89 f8             	mov    %rdi,%r8
+  80025e:	48 89 d3             	mov    %rdx,%rbx
+  800261:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800264:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800269:	4c 89 c2             	mov    %r8,%rdx
+  80026c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026f:	be 00 00 00 00       	mov    $0x0,%esi
+  800274:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+0000000000800282 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800282:	55                   	push   %rbp
+  800283:	48 89 e5             	mov    %rsp,%rbp
+  800286:	53                   	push   %rbx
+  800287:	48 83 ec 08          	sub    $0x8,%rsp
+  80028b:	89 f8                	mov    %edi,%eax
+  80028d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800290:	48 63 f9             	movslq %ecx,%rdi
+  800293:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800296:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029e:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ab:	48 85 c0             	test   %rax,%rax
+  8002ae:	7f 06                	jg     8002b6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b4:	c9                   	leave
+  8002b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b6:	49 89 c0             	mov    %rax,%r8
+  8002b9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002be:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8002c5:	00 00 00 
+  8002c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8002cd:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8002d4:	00 00 00 
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  8002e3:	00 00 00 
+  8002e6:	41 ff d1             	call   *%r9
+
+00000000008002e9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	53                   	push   %rbx
+  8002ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f2:	89 f8                	mov    %edi,%eax
+  8002f4:	49 89 f2             	mov    %rsi,%r10
+  8002f7:	48 89 cf             	mov    %rcx,%rdi
+  8002fa:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002fd:	48 63 da             	movslq %edx,%rbx
+  800300:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800303:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800308:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80030e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800310:	48 85 c0             	test   %rax,%rax
+  800313:	7f 06                	jg     80031b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800315:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031b:	49 89 c0             	mov    %rax,%r8
+  80031e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800323:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80032a:	00 00 00 
+  80032d:	be 26 00 00 00       	mov    $0x26,%esi
+  800332:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800339:	00 00 00 
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  800348:	00 00 00 
+  80034b:	41 ff d1             	call   *%r9
+
+000000000080034e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80034e:	55                   	push   %rbp
+  80034f:	48 89 e5             	mov    %rsp,%rbp
+  800352:	53                   	push   %rbx
+  800353:	48 83 ec 08          	sub    $0x8,%rsp
+  800357:	48 89 f1             	mov    %rsi,%rcx
+  80035a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80035d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800360:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800365:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036a:	be 00 00 00 00       	mov    $0x0,%esi
+  80036f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800375:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800377:	48 85 c0             	test   %rax,%rax
+  80037a:	7f 06                	jg     800382 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80037c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800380:	c9                   	leave
+  800381:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800382:	49 89 c0             	mov    %rax,%r8
+  800385:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038a:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800391:	00 00 00 
+  800394:	be 26 00 00 00       	mov    $0x26,%esi
+  800399:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8003a0:	00 00 00 
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  8003af:	00 00 00 
+  8003b2:	41 ff d1             	call   *%r9
+
+00000000008003b5 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8003b5:	55                   	push   %rbp
+  8003b6:	48 89 e5             	mov    %rsp,%rbp
+  8003b9:	53                   	push   %rbx
+  8003ba:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8003be:	48 63 ce             	movslq %esi,%rcx
+  8003c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e0:	48 85 c0             	test   %rax,%rax
+  8003e3:	7f 06                	jg     8003eb <sys_env_set_status+0x36>
+}
+  8003e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003eb:	49 89 c0             	mov    %rax,%r8
+  8003ee:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8003f3:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8003fa:	00 00 00 
+  8003fd:	be 26 00 00 00       	mov    $0x26,%esi
+  800402:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800409:	00 00 00 
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  800418:	00 00 00 
+  80041b:	41 ff d1             	call   *%r9
+
+000000000080041e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 08          	sub    $0x8,%rsp
+  800427:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80042a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800432:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800437:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043c:	be 00 00 00 00       	mov    $0x0,%esi
+  800441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800447:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800449:	48 85 c0             	test   %rax,%rax
+  80044c:	7f 06                	jg     800454 <sys_env_set_trapframe+0x36>
+}
+  80044e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800454:	49 89 c0             	mov    %rax,%r8
+  800457:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80045c:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  800463:	00 00 00 
+  800466:	be 26 00 00 00       	mov    $0x26,%esi
+  80046b:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  800481:	00 00 00 
+  800484:	41 ff d1             	call   *%r9
+
+0000000000800487 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	53                   	push   %rbx
+  80048c:	48 83 ec 08          	sub    $0x8,%rsp
+  800490:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800493:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800496:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b2:	48 85 c0             	test   %rax,%rax
+  8004b5:	7f 06                	jg     8004bd <sys_env_set_pgfault_upcall+0x36>
+}
+  8004b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bb:	c9                   	leave
+  8004bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004bd:	49 89 c0             	mov    %rax,%r8
+  8004c0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8004c5:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  8004cc:	00 00 00 
+  8004cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d4:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8004db:	00 00 00 
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e3:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  8004ea:	00 00 00 
+  8004ed:	41 ff d1             	call   *%r9
+
+00000000008004f0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004f0:	55                   	push   %rbp
+  8004f1:	48 89 e5             	mov    %rsp,%rbp
+  8004f4:	53                   	push   %rbx
+  8004f5:	89 f8                	mov    %edi,%eax
+  8004f7:	49 89 f1             	mov    %rsi,%r9
+  8004fa:	48 89 d3             	mov    %rdx,%rbx
+  8004fd:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800500:	49 63 f0             	movslq %r8d,%rsi
+  800503:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800506:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80050b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800514:	cd 30                	int    $0x30
+}
+  800516:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051a:	c9                   	leave
+  80051b:	c3                   	ret
+
+000000000080051c <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80051c:	55                   	push   %rbp
+  80051d:	48 89 e5             	mov    %rsp,%rbp
+  800520:	53                   	push   %rbx
+  800521:	48 83 ec 08          	sub    $0x8,%rsp
+  800525:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  800528:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80052b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800530:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800533:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800538:	be 00 00 00 00       	mov    $0x0,%esi
+  80053d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800543:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800545:	48 85 c0             	test   %rax,%rax
+  800548:	7f 06                	jg     800550 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80054a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80054e:	c9                   	leave
+  80054f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800550:	49 89 c0             	mov    %rax,%r8
+  800553:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800558:	48 ba 88 36 80 00 00 	movabs $0x803688,%rdx
+  80055f:	00 00 00 
+  800562:	be 26 00 00 00       	mov    $0x26,%esi
+  800567:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  80056e:	00 00 00 
+  800571:	b8 00 00 00 00       	mov    $0x0,%eax
+  800576:	49 b9 e3 24 80 00 00 	movabs $0x8024e3,%r9
+  80057d:	00 00 00 
+  800580:	41 ff d1             	call   *%r9
+
+0000000000800583 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800583:	55                   	push   %rbp
+  800584:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  800587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058c:	48 b8 1c 05 80 00 00 	movabs $0x80051c,%rax
+  800593:	00 00 00 
+  800596:	ff d0                	call   *%rax
+}
+  800598:	5d                   	pop    %rbp
+  800599:	c3                   	ret
+
+000000000080059a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80059a:	55                   	push   %rbp
+  80059b:	48 89 e5             	mov    %rsp,%rbp
+  80059e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80059f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+
+00000000008005cb <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8005cb:	55                   	push   %rbp
+  8005cc:	48 89 e5             	mov    %rsp,%rbp
+  8005cf:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8005d0:	48 63 ce             	movslq %esi,%rcx
+  8005d3:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f1:	cd 30                	int    $0x30
+}
+  8005f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f7:	c9                   	leave
+  8005f8:	c3                   	ret
+
+00000000008005f9 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8005f9:	55                   	push   %rbp
+  8005fa:	48 89 e5             	mov    %rsp,%rbp
+  8005fd:	53                   	push   %rbx
+  8005fe:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  800601:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800605:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80060a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800614:	be 00 00 00 00       	mov    $0x0,%esi
+  800619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80061f:	cd 30                	int    $0x30
+}
+  800621:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+0000000000800627 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	53                   	push   %rbx
+  80062c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80062f:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800632:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800637:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80063a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063f:	be 00 00 00 00       	mov    $0x0,%esi
+  800644:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80064a:	cd 30                	int    $0x30
+}
+  80064c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800650:	c9                   	leave
+  800651:	c3                   	ret
+
+0000000000800652 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800652:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800659:	ff ff ff 
+  80065c:	48 01 f8             	add    %rdi,%rax
+  80065f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800663:	c3                   	ret
+
+0000000000800664 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800664:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80066b:	ff ff ff 
+  80066e:	48 01 f8             	add    %rdi,%rax
+  800671:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800675:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80067b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80067f:	c3                   	ret
+
+0000000000800680 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800680:	55                   	push   %rbp
+  800681:	48 89 e5             	mov    %rsp,%rbp
+  800684:	41 57                	push   %r15
+  800686:	41 56                	push   %r14
+  800688:	41 55                	push   %r13
+  80068a:	41 54                	push   %r12
+  80068c:	53                   	push   %rbx
+  80068d:	48 83 ec 08          	sub    $0x8,%rsp
+  800691:	49 89 ff             	mov    %rdi,%r15
+  800694:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800699:	49 bd 9f 21 80 00 00 	movabs $0x80219f,%r13
+  8006a0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006a3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006a9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ac:	48 89 df             	mov    %rbx,%rdi
+  8006af:	41 ff d5             	call   *%r13
+  8006b2:	83 e0 04             	and    $0x4,%eax
+  8006b5:	74 17                	je     8006ce <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006be:	4c 39 f3             	cmp    %r14,%rbx
+  8006c1:	75 e6                	jne    8006a9 <fd_alloc+0x29>
+  8006c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006c9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006ce:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006d1:	48 83 c4 08          	add    $0x8,%rsp
+  8006d5:	5b                   	pop    %rbx
+  8006d6:	41 5c                	pop    %r12
+  8006d8:	41 5d                	pop    %r13
+  8006da:	41 5e                	pop    %r14
+  8006dc:	41 5f                	pop    %r15
+  8006de:	5d                   	pop    %rbp
+  8006df:	c3                   	ret
+
+00000000008006e0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e0:	83 ff 1f             	cmp    $0x1f,%edi
+  8006e3:	77 39                	ja     80071e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006e5:	55                   	push   %rbp
+  8006e6:	48 89 e5             	mov    %rsp,%rbp
+  8006e9:	41 54                	push   %r12
+  8006eb:	53                   	push   %rbx
+  8006ec:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8006ef:	48 63 df             	movslq %edi,%rbx
+  8006f2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8006f9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8006fd:	48 89 df             	mov    %rbx,%rdi
+  800700:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  800707:	00 00 00 
+  80070a:	ff d0                	call   *%rax
+  80070c:	a8 04                	test   $0x4,%al
+  80070e:	74 14                	je     800724 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800710:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800719:	5b                   	pop    %rbx
+  80071a:	41 5c                	pop    %r12
+  80071c:	5d                   	pop    %rbp
+  80071d:	c3                   	ret
+        return -E_INVAL;
+  80071e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800723:	c3                   	ret
+        return -E_INVAL;
+  800724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800729:	eb ee                	jmp    800719 <fd_lookup+0x39>
+
+000000000080072b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80072b:	55                   	push   %rbp
+  80072c:	48 89 e5             	mov    %rsp,%rbp
+  80072f:	41 54                	push   %r12
+  800731:	53                   	push   %rbx
+  800732:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800735:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  80073c:	00 00 00 
+  80073f:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800746:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800749:	39 3b                	cmp    %edi,(%rbx)
+  80074b:	74 47                	je     800794 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80074d:	48 83 c0 08          	add    $0x8,%rax
+  800751:	48 8b 18             	mov    (%rax),%rbx
+  800754:	48 85 db             	test   %rbx,%rbx
+  800757:	75 f0                	jne    800749 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800759:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800760:	00 00 00 
+  800763:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800769:	89 fa                	mov    %edi,%edx
+  80076b:	48 bf b8 36 80 00 00 	movabs $0x8036b8,%rdi
+  800772:	00 00 00 
+  800775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077a:	48 b9 33 26 80 00 00 	movabs $0x802633,%rcx
+  800781:	00 00 00 
+  800784:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800786:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80078b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80078f:	5b                   	pop    %rbx
+  800790:	41 5c                	pop    %r12
+  800792:	5d                   	pop    %rbp
+  800793:	c3                   	ret
+            return 0;
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	eb f0                	jmp    80078b <dev_lookup+0x60>
+
+000000000080079b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80079b:	55                   	push   %rbp
+  80079c:	48 89 e5             	mov    %rsp,%rbp
+  80079f:	41 55                	push   %r13
+  8007a1:	41 54                	push   %r12
+  8007a3:	53                   	push   %rbx
+  8007a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8007a8:	48 89 fb             	mov    %rdi,%rbx
+  8007ab:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007ae:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007b5:	ff ff ff 
+  8007b8:	48 01 df             	add    %rbx,%rdi
+  8007bb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007bf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007c3:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  8007ca:	00 00 00 
+  8007cd:	ff d0                	call   *%rax
+  8007cf:	41 89 c5             	mov    %eax,%r13d
+  8007d2:	85 c0                	test   %eax,%eax
+  8007d4:	78 06                	js     8007dc <fd_close+0x41>
+  8007d6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007da:	74 1a                	je     8007f6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007dc:	45 84 e4             	test   %r12b,%r12b
+  8007df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007e8:	44 89 e8             	mov    %r13d,%eax
+  8007eb:	48 83 c4 18          	add    $0x18,%rsp
+  8007ef:	5b                   	pop    %rbx
+  8007f0:	41 5c                	pop    %r12
+  8007f2:	41 5d                	pop    %r13
+  8007f4:	5d                   	pop    %rbp
+  8007f5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007f6:	8b 3b                	mov    (%rbx),%edi
+  8007f8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8007fc:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800803:	00 00 00 
+  800806:	ff d0                	call   *%rax
+  800808:	41 89 c5             	mov    %eax,%r13d
+  80080b:	85 c0                	test   %eax,%eax
+  80080d:	78 1b                	js     80082a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80080f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800813:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800817:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80081d:	48 85 c0             	test   %rax,%rax
+  800820:	74 08                	je     80082a <fd_close+0x8f>
+  800822:	48 89 df             	mov    %rbx,%rdi
+  800825:	ff d0                	call   *%rax
+  800827:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80082a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80082f:	48 89 de             	mov    %rbx,%rsi
+  800832:	bf 00 00 00 00       	mov    $0x0,%edi
+  800837:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  80083e:	00 00 00 
+  800841:	ff d0                	call   *%rax
+    return res;
+  800843:	eb a3                	jmp    8007e8 <fd_close+0x4d>
+
+0000000000800845 <close>:
+
+int
+close(int fdnum) {
+  800845:	55                   	push   %rbp
+  800846:	48 89 e5             	mov    %rsp,%rbp
+  800849:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80084d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800851:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800858:	00 00 00 
+  80085b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80085d:	85 c0                	test   %eax,%eax
+  80085f:	78 15                	js     800876 <close+0x31>
+
+    return fd_close(fd, 1);
+  800861:	be 01 00 00 00       	mov    $0x1,%esi
+  800866:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80086a:	48 b8 9b 07 80 00 00 	movabs $0x80079b,%rax
+  800871:	00 00 00 
+  800874:	ff d0                	call   *%rax
+}
+  800876:	c9                   	leave
+  800877:	c3                   	ret
+
+0000000000800878 <close_all>:
+
+void
+close_all(void) {
+  800878:	55                   	push   %rbp
+  800879:	48 89 e5             	mov    %rsp,%rbp
+  80087c:	41 54                	push   %r12
+  80087e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80087f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800884:	49 bc 45 08 80 00 00 	movabs $0x800845,%r12
+  80088b:	00 00 00 
+  80088e:	89 df                	mov    %ebx,%edi
+  800890:	41 ff d4             	call   *%r12
+  800893:	83 c3 01             	add    $0x1,%ebx
+  800896:	83 fb 20             	cmp    $0x20,%ebx
+  800899:	75 f3                	jne    80088e <close_all+0x16>
+}
+  80089b:	5b                   	pop    %rbx
+  80089c:	41 5c                	pop    %r12
+  80089e:	5d                   	pop    %rbp
+  80089f:	c3                   	ret
+
+00000000008008a0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008a0:	55                   	push   %rbp
+  8008a1:	48 89 e5             	mov    %rsp,%rbp
+  8008a4:	41 57                	push   %r15
+  8008a6:	41 56                	push   %r14
+  8008a8:	41 55                	push   %r13
+  8008aa:	41 54                	push   %r12
+  8008ac:	53                   	push   %rbx
+  8008ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8008b1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008b4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008b8:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  8008bf:	00 00 00 
+  8008c2:	ff d0                	call   *%rax
+  8008c4:	89 c3                	mov    %eax,%ebx
+  8008c6:	85 c0                	test   %eax,%eax
+  8008c8:	0f 88 b8 00 00 00    	js     800986 <dup+0xe6>
+    close(newfdnum);
+  8008ce:	44 89 e7             	mov    %r12d,%edi
+  8008d1:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  8008d8:	00 00 00 
+  8008db:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008dd:	4d 63 ec             	movslq %r12d,%r13
+  8008e0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008e7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8008eb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8008ef:	4c 89 ff             	mov    %r15,%rdi
+  8008f2:	49 be 64 06 80 00 00 	movabs $0x800664,%r14
+  8008f9:	00 00 00 
+  8008fc:	41 ff d6             	call   *%r14
+  8008ff:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800902:	4c 89 ef             	mov    %r13,%rdi
+  800905:	41 ff d6             	call   *%r14
+  800908:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80090b:	48 89 df             	mov    %rbx,%rdi
+  80090e:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  800915:	00 00 00 
+  800918:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80091a:	a8 04                	test   $0x4,%al
+  80091c:	74 2b                	je     800949 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80091e:	41 89 c1             	mov    %eax,%r9d
+  800921:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800927:	4c 89 f1             	mov    %r14,%rcx
+  80092a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80092f:	48 89 de             	mov    %rbx,%rsi
+  800932:	bf 00 00 00 00       	mov    $0x0,%edi
+  800937:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  80093e:	00 00 00 
+  800941:	ff d0                	call   *%rax
+  800943:	89 c3                	mov    %eax,%ebx
+  800945:	85 c0                	test   %eax,%eax
+  800947:	78 4e                	js     800997 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800949:	4c 89 ff             	mov    %r15,%rdi
+  80094c:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  800953:	00 00 00 
+  800956:	ff d0                	call   *%rax
+  800958:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80095b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800961:	4c 89 e9             	mov    %r13,%rcx
+  800964:	ba 00 00 00 00       	mov    $0x0,%edx
+  800969:	4c 89 fe             	mov    %r15,%rsi
+  80096c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800971:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  800978:	00 00 00 
+  80097b:	ff d0                	call   *%rax
+  80097d:	89 c3                	mov    %eax,%ebx
+  80097f:	85 c0                	test   %eax,%eax
+  800981:	78 14                	js     800997 <dup+0xf7>
+
+    return newfdnum;
+  800983:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800986:	89 d8                	mov    %ebx,%eax
+  800988:	48 83 c4 18          	add    $0x18,%rsp
+  80098c:	5b                   	pop    %rbx
+  80098d:	41 5c                	pop    %r12
+  80098f:	41 5d                	pop    %r13
+  800991:	41 5e                	pop    %r14
+  800993:	41 5f                	pop    %r15
+  800995:	5d                   	pop    %rbp
+  800996:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800997:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80099c:	4c 89 ee             	mov    %r13,%rsi
+  80099f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a4:	49 bc 4e 03 80 00 00 	movabs $0x80034e,%r12
+  8009ab:	00 00 00 
+  8009ae:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b6:	4c 89 f6             	mov    %r14,%rsi
+  8009b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009be:	41 ff d4             	call   *%r12
+    return res;
+  8009c1:	eb c3                	jmp    800986 <dup+0xe6>
+
+00000000008009c3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009c3:	55                   	push   %rbp
+  8009c4:	48 89 e5             	mov    %rsp,%rbp
+  8009c7:	41 56                	push   %r14
+  8009c9:	41 55                	push   %r13
+  8009cb:	41 54                	push   %r12
+  8009cd:	53                   	push   %rbx
+  8009ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8009d2:	89 fb                	mov    %edi,%ebx
+  8009d4:	49 89 f4             	mov    %rsi,%r12
+  8009d7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009de:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  8009e5:	00 00 00 
+  8009e8:	ff d0                	call   *%rax
+  8009ea:	85 c0                	test   %eax,%eax
+  8009ec:	78 4c                	js     800a3a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8009ee:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8009f2:	41 8b 3e             	mov    (%r14),%edi
+  8009f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009f9:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800a00:	00 00 00 
+  800a03:	ff d0                	call   *%rax
+  800a05:	85 c0                	test   %eax,%eax
+  800a07:	78 35                	js     800a3e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a09:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a0d:	83 e0 03             	and    $0x3,%eax
+  800a10:	83 f8 01             	cmp    $0x1,%eax
+  800a13:	74 2d                	je     800a42 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a19:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a1d:	48 85 c0             	test   %rax,%rax
+  800a20:	74 56                	je     800a78 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a22:	4c 89 ea             	mov    %r13,%rdx
+  800a25:	4c 89 e6             	mov    %r12,%rsi
+  800a28:	4c 89 f7             	mov    %r14,%rdi
+  800a2b:	ff d0                	call   *%rax
+}
+  800a2d:	48 83 c4 10          	add    $0x10,%rsp
+  800a31:	5b                   	pop    %rbx
+  800a32:	41 5c                	pop    %r12
+  800a34:	41 5d                	pop    %r13
+  800a36:	41 5e                	pop    %r14
+  800a38:	5d                   	pop    %rbp
+  800a39:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a3a:	48 98                	cltq
+  800a3c:	eb ef                	jmp    800a2d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a3e:	48 98                	cltq
+  800a40:	eb eb                	jmp    800a2d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a42:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a49:	00 00 00 
+  800a4c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a52:	89 da                	mov    %ebx,%edx
+  800a54:	48 bf 19 37 80 00 00 	movabs $0x803719,%rdi
+  800a5b:	00 00 00 
+  800a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a63:	48 b9 33 26 80 00 00 	movabs $0x802633,%rcx
+  800a6a:	00 00 00 
+  800a6d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a6f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a76:	eb b5                	jmp    800a2d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a78:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a7f:	eb ac                	jmp    800a2d <read+0x6a>
+
+0000000000800a81 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  800a81:	55                   	push   %rbp
+  800a82:	48 89 e5             	mov    %rsp,%rbp
+  800a85:	41 56                	push   %r14
+  800a87:	41 55                	push   %r13
+  800a89:	41 54                	push   %r12
+  800a8b:	53                   	push   %rbx
+  800a8c:	48 83 ec 10          	sub    $0x10,%rsp
+  800a90:	89 fb                	mov    %edi,%ebx
+  800a92:	49 89 f4             	mov    %rsi,%r12
+  800a95:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a98:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a9c:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800aa3:	00 00 00 
+  800aa6:	ff d0                	call   *%rax
+  800aa8:	85 c0                	test   %eax,%eax
+  800aaa:	78 41                	js     800aed <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aac:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ab0:	41 8b 3e             	mov    (%r14),%edi
+  800ab3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ab7:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800abe:	00 00 00 
+  800ac1:	ff d0                	call   *%rax
+  800ac3:	85 c0                	test   %eax,%eax
+  800ac5:	78 35                	js     800afc <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ac7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800acb:	83 e0 03             	and    $0x3,%eax
+  800ace:	83 f8 01             	cmp    $0x1,%eax
+  800ad1:	74 2d                	je     800b00 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800ad3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ad7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800adb:	48 85 c0             	test   %rax,%rax
+  800ade:	74 56                	je     800b36 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  800ae0:	4c 89 ea             	mov    %r13,%rdx
+  800ae3:	4c 89 e6             	mov    %r12,%rsi
+  800ae6:	4c 89 f7             	mov    %r14,%rdi
+  800ae9:	ff d0                	call   *%rax
+  800aeb:	eb 02                	jmp    800aef <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aed:	48 98                	cltq
+}
+  800aef:	48 83 c4 10          	add    $0x10,%rsp
+  800af3:	5b                   	pop    %rbx
+  800af4:	41 5c                	pop    %r12
+  800af6:	41 5d                	pop    %r13
+  800af8:	41 5e                	pop    %r14
+  800afa:	5d                   	pop    %rbp
+  800afb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800afc:	48 98                	cltq
+  800afe:	eb ef                	jmp    800aef <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b00:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b07:	00 00 00 
+  800b0a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b10:	89 da                	mov    %ebx,%edx
+  800b12:	48 bf d8 36 80 00 00 	movabs $0x8036d8,%rdi
+  800b19:	00 00 00 
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	48 b9 33 26 80 00 00 	movabs $0x802633,%rcx
+  800b28:	00 00 00 
+  800b2b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b2d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b34:	eb b9                	jmp    800aef <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  800b36:	4c 89 ea             	mov    %r13,%rdx
+  800b39:	4c 89 e6             	mov    %r12,%rsi
+  800b3c:	89 df                	mov    %ebx,%edi
+  800b3e:	48 b8 c3 09 80 00 00 	movabs $0x8009c3,%rax
+  800b45:	00 00 00 
+  800b48:	ff d0                	call   *%rax
+  800b4a:	eb a3                	jmp    800aef <readmap+0x6e>
+
+0000000000800b4c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b4c:	55                   	push   %rbp
+  800b4d:	48 89 e5             	mov    %rsp,%rbp
+  800b50:	41 57                	push   %r15
+  800b52:	41 56                	push   %r14
+  800b54:	41 55                	push   %r13
+  800b56:	41 54                	push   %r12
+  800b58:	53                   	push   %rbx
+  800b59:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b5d:	48 85 d2             	test   %rdx,%rdx
+  800b60:	74 54                	je     800bb6 <readn+0x6a>
+  800b62:	41 89 fd             	mov    %edi,%r13d
+  800b65:	49 89 f6             	mov    %rsi,%r14
+  800b68:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b70:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b75:	49 bf c3 09 80 00 00 	movabs $0x8009c3,%r15
+  800b7c:	00 00 00 
+  800b7f:	4c 89 e2             	mov    %r12,%rdx
+  800b82:	48 29 f2             	sub    %rsi,%rdx
+  800b85:	4c 01 f6             	add    %r14,%rsi
+  800b88:	44 89 ef             	mov    %r13d,%edi
+  800b8b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b8e:	85 c0                	test   %eax,%eax
+  800b90:	78 20                	js     800bb2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b92:	01 c3                	add    %eax,%ebx
+  800b94:	85 c0                	test   %eax,%eax
+  800b96:	74 08                	je     800ba0 <readn+0x54>
+  800b98:	48 63 f3             	movslq %ebx,%rsi
+  800b9b:	4c 39 e6             	cmp    %r12,%rsi
+  800b9e:	72 df                	jb     800b7f <readn+0x33>
+    }
+    return res;
+  800ba0:	48 63 c3             	movslq %ebx,%rax
+}
+  800ba3:	48 83 c4 08          	add    $0x8,%rsp
+  800ba7:	5b                   	pop    %rbx
+  800ba8:	41 5c                	pop    %r12
+  800baa:	41 5d                	pop    %r13
+  800bac:	41 5e                	pop    %r14
+  800bae:	41 5f                	pop    %r15
+  800bb0:	5d                   	pop    %rbp
+  800bb1:	c3                   	ret
+        if (inc < 0) return inc;
+  800bb2:	48 98                	cltq
+  800bb4:	eb ed                	jmp    800ba3 <readn+0x57>
+    int inc = 1, res = 0;
+  800bb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bbb:	eb e3                	jmp    800ba0 <readn+0x54>
+
+0000000000800bbd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bbd:	55                   	push   %rbp
+  800bbe:	48 89 e5             	mov    %rsp,%rbp
+  800bc1:	41 56                	push   %r14
+  800bc3:	41 55                	push   %r13
+  800bc5:	41 54                	push   %r12
+  800bc7:	53                   	push   %rbx
+  800bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  800bcc:	89 fb                	mov    %edi,%ebx
+  800bce:	49 89 f4             	mov    %rsi,%r12
+  800bd1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bd8:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800bdf:	00 00 00 
+  800be2:	ff d0                	call   *%rax
+  800be4:	85 c0                	test   %eax,%eax
+  800be6:	78 47                	js     800c2f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bec:	41 8b 3e             	mov    (%r14),%edi
+  800bef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bf3:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800bfa:	00 00 00 
+  800bfd:	ff d0                	call   *%rax
+  800bff:	85 c0                	test   %eax,%eax
+  800c01:	78 30                	js     800c33 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c03:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c08:	74 2d                	je     800c37 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c0e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800c12:	48 85 c0             	test   %rax,%rax
+  800c15:	74 56                	je     800c6d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c17:	4c 89 ea             	mov    %r13,%rdx
+  800c1a:	4c 89 e6             	mov    %r12,%rsi
+  800c1d:	4c 89 f7             	mov    %r14,%rdi
+  800c20:	ff d0                	call   *%rax
+}
+  800c22:	48 83 c4 10          	add    $0x10,%rsp
+  800c26:	5b                   	pop    %rbx
+  800c27:	41 5c                	pop    %r12
+  800c29:	41 5d                	pop    %r13
+  800c2b:	41 5e                	pop    %r14
+  800c2d:	5d                   	pop    %rbp
+  800c2e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c2f:	48 98                	cltq
+  800c31:	eb ef                	jmp    800c22 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c33:	48 98                	cltq
+  800c35:	eb eb                	jmp    800c22 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c37:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c3e:	00 00 00 
+  800c41:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c47:	89 da                	mov    %ebx,%edx
+  800c49:	48 bf 35 37 80 00 00 	movabs $0x803735,%rdi
+  800c50:	00 00 00 
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c58:	48 b9 33 26 80 00 00 	movabs $0x802633,%rcx
+  800c5f:	00 00 00 
+  800c62:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c64:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c6b:	eb b5                	jmp    800c22 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c6d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c74:	eb ac                	jmp    800c22 <write+0x65>
+
+0000000000800c76 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c76:	55                   	push   %rbp
+  800c77:	48 89 e5             	mov    %rsp,%rbp
+  800c7a:	53                   	push   %rbx
+  800c7b:	48 83 ec 18          	sub    $0x18,%rsp
+  800c7f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c85:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+  800c91:	85 c0                	test   %eax,%eax
+  800c93:	78 0c                	js     800ca1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c99:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ca5:	c9                   	leave
+  800ca6:	c3                   	ret
+
+0000000000800ca7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800ca7:	55                   	push   %rbp
+  800ca8:	48 89 e5             	mov    %rsp,%rbp
+  800cab:	41 55                	push   %r13
+  800cad:	41 54                	push   %r12
+  800caf:	53                   	push   %rbx
+  800cb0:	48 83 ec 18          	sub    $0x18,%rsp
+  800cb4:	89 fb                	mov    %edi,%ebx
+  800cb6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cb9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cbd:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800cc4:	00 00 00 
+  800cc7:	ff d0                	call   *%rax
+  800cc9:	85 c0                	test   %eax,%eax
+  800ccb:	78 38                	js     800d05 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ccd:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cd1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cd5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cd9:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800ce0:	00 00 00 
+  800ce3:	ff d0                	call   *%rax
+  800ce5:	85 c0                	test   %eax,%eax
+  800ce7:	78 1c                	js     800d05 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ce9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cee:	74 20                	je     800d10 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cf0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cf4:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800cf8:	48 85 c0             	test   %rax,%rax
+  800cfb:	74 47                	je     800d44 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cfd:	44 89 e6             	mov    %r12d,%esi
+  800d00:	4c 89 ef             	mov    %r13,%rdi
+  800d03:	ff d0                	call   *%rax
+}
+  800d05:	48 83 c4 18          	add    $0x18,%rsp
+  800d09:	5b                   	pop    %rbx
+  800d0a:	41 5c                	pop    %r12
+  800d0c:	41 5d                	pop    %r13
+  800d0e:	5d                   	pop    %rbp
+  800d0f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d10:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d17:	00 00 00 
+  800d1a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d20:	89 da                	mov    %ebx,%edx
+  800d22:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  800d29:	00 00 00 
+  800d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d31:	48 b9 33 26 80 00 00 	movabs $0x802633,%rcx
+  800d38:	00 00 00 
+  800d3b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d42:	eb c1                	jmp    800d05 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d44:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d49:	eb ba                	jmp    800d05 <ftruncate+0x5e>
+
+0000000000800d4b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d4b:	55                   	push   %rbp
+  800d4c:	48 89 e5             	mov    %rsp,%rbp
+  800d4f:	41 54                	push   %r12
+  800d51:	53                   	push   %rbx
+  800d52:	48 83 ec 10          	sub    $0x10,%rsp
+  800d56:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d59:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d5d:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  800d64:	00 00 00 
+  800d67:	ff d0                	call   *%rax
+  800d69:	85 c0                	test   %eax,%eax
+  800d6b:	78 4e                	js     800dbb <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d6d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d71:	41 8b 3c 24          	mov    (%r12),%edi
+  800d75:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d79:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800d80:	00 00 00 
+  800d83:	ff d0                	call   *%rax
+  800d85:	85 c0                	test   %eax,%eax
+  800d87:	78 32                	js     800dbb <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d8d:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  800d92:	74 30                	je     800dc4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d94:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d97:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d9e:	00 00 00 
+    stat->st_isdir = 0;
+  800da1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800da8:	00 00 00 
+    stat->st_dev = dev;
+  800dab:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800db2:	48 89 de             	mov    %rbx,%rsi
+  800db5:	4c 89 e7             	mov    %r12,%rdi
+  800db8:	ff 50 30             	call   *0x30(%rax)
+}
+  800dbb:	48 83 c4 10          	add    $0x10,%rsp
+  800dbf:	5b                   	pop    %rbx
+  800dc0:	41 5c                	pop    %r12
+  800dc2:	5d                   	pop    %rbp
+  800dc3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dc4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dc9:	eb f0                	jmp    800dbb <fstat+0x70>
+
+0000000000800dcb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dcb:	55                   	push   %rbp
+  800dcc:	48 89 e5             	mov    %rsp,%rbp
+  800dcf:	41 54                	push   %r12
+  800dd1:	53                   	push   %rbx
+  800dd2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dda:	48 b8 22 1b 80 00 00 	movabs $0x801b22,%rax
+  800de1:	00 00 00 
+  800de4:	ff d0                	call   *%rax
+  800de6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	78 25                	js     800e11 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dec:	4c 89 e6             	mov    %r12,%rsi
+  800def:	89 c7                	mov    %eax,%edi
+  800df1:	48 b8 4b 0d 80 00 00 	movabs $0x800d4b,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+  800dfd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e00:	89 df                	mov    %ebx,%edi
+  800e02:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  800e09:	00 00 00 
+  800e0c:	ff d0                	call   *%rax
+
+    return res;
+  800e0e:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e11:	89 d8                	mov    %ebx,%eax
+  800e13:	5b                   	pop    %rbx
+  800e14:	41 5c                	pop    %r12
+  800e16:	5d                   	pop    %rbp
+  800e17:	c3                   	ret
+
+0000000000800e18 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  800e18:	55                   	push   %rbp
+  800e19:	48 89 e5             	mov    %rsp,%rbp
+  800e1c:	41 54                	push   %r12
+  800e1e:	53                   	push   %rbx
+  800e1f:	48 83 ec 10          	sub    $0x10,%rsp
+  800e23:	48 89 fb             	mov    %rdi,%rbx
+  800e26:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e29:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e2d:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e32:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800e39:	00 00 00 
+  800e3c:	ff d0                	call   *%rax
+  800e3e:	85 c0                	test   %eax,%eax
+  800e40:	78 1f                	js     800e61 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  800e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e46:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800e4a:	48 85 c0             	test   %rax,%rax
+  800e4d:	74 1b                	je     800e6a <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  800e4f:	4c 89 e6             	mov    %r12,%rsi
+  800e52:	48 89 df             	mov    %rbx,%rdi
+  800e55:	ff d0                	call   *%rax
+    if (res < 0) {
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800e61:	48 83 c4 10          	add    $0x10,%rsp
+  800e65:	5b                   	pop    %rbx
+  800e66:	41 5c                	pop    %r12
+  800e68:	5d                   	pop    %rbp
+  800e69:	c3                   	ret
+        return -E_NOT_SUPP;
+  800e6a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e6f:	eb f0                	jmp    800e61 <create_snapshot+0x49>
+
+0000000000800e71 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  800e71:	55                   	push   %rbp
+  800e72:	48 89 e5             	mov    %rsp,%rbp
+  800e75:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800e79:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e7d:	bf 66 00 00 00       	mov    $0x66,%edi
+  800e82:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	78 1e                	js     800eb0 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  800e92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e96:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800e9a:	48 85 d2             	test   %rdx,%rdx
+  800e9d:	74 13                	je     800eb2 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  800e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea4:	ff d2                	call   *%rdx
+    if (res < 0) {
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ead:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800eb0:	c9                   	leave
+  800eb1:	c3                   	ret
+        return -E_NOT_SUPP;
+  800eb2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800eb7:	eb f7                	jmp    800eb0 <print_snapshot_list+0x3f>
+
+0000000000800eb9 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+  800ebd:	53                   	push   %rbx
+  800ebe:	48 83 ec 18          	sub    $0x18,%rsp
+  800ec2:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800ec5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ec9:	bf 66 00 00 00       	mov    $0x66,%edi
+  800ece:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800ed5:	00 00 00 
+  800ed8:	ff d0                	call   *%rax
+  800eda:	85 c0                	test   %eax,%eax
+  800edc:	78 1c                	js     800efa <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  800ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ee2:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800ee6:	48 85 c0             	test   %rax,%rax
+  800ee9:	74 15                	je     800f00 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  800eeb:	48 89 df             	mov    %rbx,%rdi
+  800eee:	ff d0                	call   *%rax
+    if (res < 0) {
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800efa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800efe:	c9                   	leave
+  800eff:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f00:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f05:	eb f3                	jmp    800efa <accept_snapshot+0x41>
+
+0000000000800f07 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  800f07:	55                   	push   %rbp
+  800f08:	48 89 e5             	mov    %rsp,%rbp
+  800f0b:	53                   	push   %rbx
+  800f0c:	48 83 ec 18          	sub    $0x18,%rsp
+  800f10:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f13:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f17:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f1c:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800f23:	00 00 00 
+  800f26:	ff d0                	call   *%rax
+  800f28:	85 c0                	test   %eax,%eax
+  800f2a:	78 1c                	js     800f48 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  800f2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f30:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800f34:	48 85 c0             	test   %rax,%rax
+  800f37:	74 15                	je     800f4e <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  800f39:	48 89 df             	mov    %rbx,%rdi
+  800f3c:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f3e:	85 c0                	test   %eax,%eax
+  800f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f45:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  800f48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f4c:	c9                   	leave
+  800f4d:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f4e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f53:	eb f3                	jmp    800f48 <delete_snapshot+0x41>
+
+0000000000800f55 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800f5d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f61:	bf 66 00 00 00       	mov    $0x66,%edi
+  800f66:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800f6d:	00 00 00 
+  800f70:	ff d0                	call   *%rax
+  800f72:	85 c0                	test   %eax,%eax
+  800f74:	78 14                	js     800f8a <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  800f76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f7a:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800f7e:	48 85 d2             	test   %rdx,%rdx
+  800f81:	74 09                	je     800f8c <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f88:	ff d2                	call   *%rdx
+
+    return res;
+}
+  800f8a:	c9                   	leave
+  800f8b:	c3                   	ret
+        return -E_NOT_SUPP;
+  800f8c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f91:	eb f7                	jmp    800f8a <gc_snapshots+0x35>
+
+0000000000800f93 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+  800f97:	41 56                	push   %r14
+  800f99:	41 55                	push   %r13
+  800f9b:	41 54                	push   %r12
+  800f9d:	53                   	push   %rbx
+  800f9e:	48 83 ec 10          	sub    $0x10,%rsp
+  800fa2:	48 89 fb             	mov    %rdi,%rbx
+  800fa5:	49 89 f4             	mov    %rsi,%r12
+  800fa8:	49 89 d5             	mov    %rdx,%r13
+  800fab:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  800fae:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800fb2:	bf 66 00 00 00       	mov    $0x66,%edi
+  800fb7:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  800fbe:	00 00 00 
+  800fc1:	ff d0                	call   *%rax
+  800fc3:	85 c0                	test   %eax,%eax
+  800fc5:	78 1b                	js     800fe2 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  800fc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fcb:	48 8b 40 68          	mov    0x68(%rax),%rax
+  800fcf:	48 85 c0             	test   %rax,%rax
+  800fd2:	74 1b                	je     800fef <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  800fd4:	4c 89 f1             	mov    %r14,%rcx
+  800fd7:	4c 89 ea             	mov    %r13,%rdx
+  800fda:	4c 89 e6             	mov    %r12,%rsi
+  800fdd:	48 89 df             	mov    %rbx,%rdi
+  800fe0:	ff d0                	call   *%rax
+
+    return res;
+}
+  800fe2:	48 83 c4 10          	add    $0x10,%rsp
+  800fe6:	5b                   	pop    %rbx
+  800fe7:	41 5c                	pop    %r12
+  800fe9:	41 5d                	pop    %r13
+  800feb:	41 5e                	pop    %r14
+  800fed:	5d                   	pop    %rbp
+  800fee:	c3                   	ret
+        return -E_NOT_SUPP;
+  800fef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ff4:	eb ec                	jmp    800fe2 <diff_snapshots+0x4f>
+
+0000000000800ff6 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  800ff6:	55                   	push   %rbp
+  800ff7:	48 89 e5             	mov    %rsp,%rbp
+  800ffa:	41 55                	push   %r13
+  800ffc:	41 54                	push   %r12
+  800ffe:	53                   	push   %rbx
+  800fff:	48 83 ec 18          	sub    $0x18,%rsp
+  801003:	48 89 fb             	mov    %rdi,%rbx
+  801006:	49 89 f4             	mov    %rsi,%r12
+  801009:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80100c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801010:	bf 66 00 00 00       	mov    $0x66,%edi
+  801015:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  80101c:	00 00 00 
+  80101f:	ff d0                	call   *%rax
+  801021:	85 c0                	test   %eax,%eax
+  801023:	78 18                	js     80103d <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801025:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801029:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80102d:	48 85 c0             	test   %rax,%rax
+  801030:	74 16                	je     801048 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801032:	4c 89 ea             	mov    %r13,%rdx
+  801035:	4c 89 e6             	mov    %r12,%rsi
+  801038:	48 89 df             	mov    %rbx,%rdi
+  80103b:	ff d0                	call   *%rax
+
+    return res;
+}
+  80103d:	48 83 c4 18          	add    $0x18,%rsp
+  801041:	5b                   	pop    %rbx
+  801042:	41 5c                	pop    %r12
+  801044:	41 5d                	pop    %r13
+  801046:	5d                   	pop    %rbp
+  801047:	c3                   	ret
+        return -E_NOT_SUPP;
+  801048:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80104d:	eb ee                	jmp    80103d <send_snapshot+0x47>
+
+000000000080104f <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80104f:	55                   	push   %rbp
+  801050:	48 89 e5             	mov    %rsp,%rbp
+  801053:	53                   	push   %rbx
+  801054:	48 83 ec 18          	sub    $0x18,%rsp
+  801058:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80105b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80105f:	bf 66 00 00 00       	mov    $0x66,%edi
+  801064:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  80106b:	00 00 00 
+  80106e:	ff d0                	call   *%rax
+  801070:	85 c0                	test   %eax,%eax
+  801072:	78 12                	js     801086 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  801074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801078:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80107c:	48 85 c0             	test   %rax,%rax
+  80107f:	74 0b                	je     80108c <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  801081:	48 89 df             	mov    %rbx,%rdi
+  801084:	ff d0                	call   *%rax
+
+    return res;
+}
+  801086:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108a:	c9                   	leave
+  80108b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80108c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801091:	eb f3                	jmp    801086 <receive_snapshot+0x37>
+
+0000000000801093 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  801093:	55                   	push   %rbp
+  801094:	48 89 e5             	mov    %rsp,%rbp
+  801097:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80109b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80109f:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010a4:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  8010ab:	00 00 00 
+  8010ae:	ff d0                	call   *%rax
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	78 17                	js     8010cb <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8010b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010b8:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8010bf:	48 85 d2             	test   %rdx,%rdx
+  8010c2:	74 09                	je     8010cd <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8010c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c9:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8010cb:	c9                   	leave
+  8010cc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8010cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8010d2:	eb f7                	jmp    8010cb <free_space_bytes+0x38>
+
+00000000008010d4 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8010d4:	55                   	push   %rbp
+  8010d5:	48 89 e5             	mov    %rsp,%rbp
+  8010d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8010dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8010e0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8010e5:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+  8010f1:	85 c0                	test   %eax,%eax
+  8010f3:	78 17                	js     80110c <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8010f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010f9:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  801100:	48 85 d2             	test   %rdx,%rdx
+  801103:	74 09                	je     80110e <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  801105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80110c:	c9                   	leave
+  80110d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80110e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801113:	eb f7                	jmp    80110c <busy_space_bytes+0x38>
+
+0000000000801115 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	41 54                	push   %r12
+  80111b:	53                   	push   %rbx
+  80111c:	48 83 ec 10          	sub    $0x10,%rsp
+  801120:	89 fb                	mov    %edi,%ebx
+  801122:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801125:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801129:	bf 66 00 00 00       	mov    $0x66,%edi
+  80112e:	48 b8 2b 07 80 00 00 	movabs $0x80072b,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	78 17                	js     801155 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80113e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801142:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  801149:	48 85 c0             	test   %rax,%rax
+  80114c:	74 10                	je     80115e <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80114e:	4c 89 e6             	mov    %r12,%rsi
+  801151:	89 df                	mov    %ebx,%edi
+  801153:	ff d0                	call   *%rax
+    
+    return res;
+}
+  801155:	48 83 c4 10          	add    $0x10,%rsp
+  801159:	5b                   	pop    %rbx
+  80115a:	41 5c                	pop    %r12
+  80115c:	5d                   	pop    %rbp
+  80115d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80115e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801163:	eb f0                	jmp    801155 <snapshots_space+0x40>
+
+0000000000801165 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	41 55                	push   %r13
+  80116b:	41 54                	push   %r12
+  80116d:	53                   	push   %rbx
+  80116e:	48 83 ec 08          	sub    $0x8,%rsp
+  801172:	41 89 fd             	mov    %edi,%r13d
+  801175:	48 89 f3             	mov    %rsi,%rbx
+  801178:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80117b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801182:	00 00 00 
+  801185:	83 38 00             	cmpl   $0x0,(%rax)
+  801188:	74 57                	je     8011e1 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80118a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801190:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801195:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80119c:	00 00 00 
+  80119f:	44 89 ee             	mov    %r13d,%esi
+  8011a2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8011a9:	00 00 00 
+  8011ac:	8b 38                	mov    (%rax),%edi
+  8011ae:	48 b8 5a 35 80 00 00 	movabs $0x80355a,%rax
+  8011b5:	00 00 00 
+  8011b8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8011ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011bf:	4c 89 e2             	mov    %r12,%rdx
+  8011c2:	48 89 de             	mov    %rbx,%rsi
+  8011c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011ca:	48 b8 42 35 80 00 00 	movabs $0x803542,%rax
+  8011d1:	00 00 00 
+  8011d4:	ff d0                	call   *%rax
+}
+  8011d6:	48 83 c4 08          	add    $0x8,%rsp
+  8011da:	5b                   	pop    %rbx
+  8011db:	41 5c                	pop    %r12
+  8011dd:	41 5d                	pop    %r13
+  8011df:	5d                   	pop    %rbp
+  8011e0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011e1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011e6:	48 b8 18 36 80 00 00 	movabs $0x803618,%rax
+  8011ed:	00 00 00 
+  8011f0:	ff d0                	call   *%rax
+  8011f2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8011f9:	00 00 
+  8011fb:	eb 8d                	jmp    80118a <fsipc_region+0x25>
+
+00000000008011fd <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8011fd:	55                   	push   %rbp
+  8011fe:	48 89 e5             	mov    %rsp,%rbp
+  801201:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  801205:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80120c:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80120d:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801211:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  801218:	00 00 00 
+  80121b:	ff d0                	call   *%rax
+}
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+
+000000000080121f <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80121f:	85 ff                	test   %edi,%edi
+  801221:	78 6d                	js     801290 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  801223:	55                   	push   %rbp
+  801224:	48 89 e5             	mov    %rsp,%rbp
+  801227:	41 54                	push   %r12
+  801229:	53                   	push   %rbx
+  80122a:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80122d:	48 85 f6             	test   %rsi,%rsi
+  801230:	74 57                	je     801289 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  801232:	89 f8                	mov    %edi,%eax
+  801234:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80123b:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	bf 12 00 00 00       	mov    $0x12,%edi
+  801247:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80124e:	00 00 00 
+  801251:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801253:	85 c0                	test   %eax,%eax
+  801255:	78 2d                	js     801284 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  801257:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80125e:	00 00 00 
+  801261:	49 63 14 24          	movslq (%r12),%rdx
+  801265:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80126c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  801271:	48 89 df             	mov    %rbx,%rdi
+  801274:	48 b8 52 31 80 00 00 	movabs $0x803152,%rax
+  80127b:	00 00 00 
+  80127e:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  801280:	41 8b 04 24          	mov    (%r12),%eax
+}
+  801284:	5b                   	pop    %rbx
+  801285:	41 5c                	pop    %r12
+  801287:	5d                   	pop    %rbp
+  801288:	c3                   	ret
+        return -E_INVAL;
+  801289:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128e:	eb f4                	jmp    801284 <devfile_df_snapshots+0x65>
+  801290:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801295:	c3                   	ret
+
+0000000000801296 <devfile_df_busy>:
+devfile_df_busy() {
+  801296:	55                   	push   %rbp
+  801297:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80129a:	be 00 00 00 00       	mov    $0x0,%esi
+  80129f:	bf 11 00 00 00       	mov    $0x11,%edi
+  8012a4:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8012ab:	00 00 00 
+  8012ae:	ff d0                	call   *%rax
+}
+  8012b0:	5d                   	pop    %rbp
+  8012b1:	c3                   	ret
+
+00000000008012b2 <devfile_df_free>:
+devfile_df_free() {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8012b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bb:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012c0:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8012c7:	00 00 00 
+  8012ca:	ff d0                	call   *%rax
+}
+  8012cc:	5d                   	pop    %rbp
+  8012cd:	c3                   	ret
+
+00000000008012ce <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8012d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012dc:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8012e3:	00 00 00 
+  8012e6:	ff d0                	call   *%rax
+}
+  8012e8:	5d                   	pop    %rbp
+  8012e9:	c3                   	ret
+
+00000000008012ea <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8012ea:	55                   	push   %rbp
+  8012eb:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8012ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8012f8:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8012ff:	00 00 00 
+  801302:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801304:	85 c0                	test   %eax,%eax
+  801306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80130e:	5d                   	pop    %rbp
+  80130f:	c3                   	ret
+
+0000000000801310 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801310:	55                   	push   %rbp
+  801311:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801314:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80131b:	00 00 00 
+  80131e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801321:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801323:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801326:	be 00 00 00 00       	mov    $0x0,%esi
+  80132b:	bf 02 00 00 00       	mov    $0x2,%edi
+  801330:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+}
+  80133c:	5d                   	pop    %rbp
+  80133d:	c3                   	ret
+
+000000000080133e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80133e:	55                   	push   %rbp
+  80133f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801342:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801345:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80134c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	bf 06 00 00 00       	mov    $0x6,%edi
+  801358:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80135f:	00 00 00 
+  801362:	ff d0                	call   *%rax
+}
+  801364:	5d                   	pop    %rbp
+  801365:	c3                   	ret
+
+0000000000801366 <devfile_write>:
+    if (!fd || !buf) {
+  801366:	48 85 ff             	test   %rdi,%rdi
+  801369:	0f 84 c1 00 00 00    	je     801430 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80136f:	55                   	push   %rbp
+  801370:	48 89 e5             	mov    %rsp,%rbp
+  801373:	41 57                	push   %r15
+  801375:	41 56                	push   %r14
+  801377:	41 55                	push   %r13
+  801379:	41 54                	push   %r12
+  80137b:	53                   	push   %rbx
+  80137c:	48 83 ec 18          	sub    $0x18,%rsp
+  801380:	49 89 ff             	mov    %rdi,%r15
+  801383:	49 89 f5             	mov    %rsi,%r13
+  801386:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  801389:	48 85 f6             	test   %rsi,%rsi
+  80138c:	0f 84 95 00 00 00    	je     801427 <devfile_write+0xc1>
+    while (n) {
+  801392:	48 85 d2             	test   %rdx,%rdx
+  801395:	0f 84 83 00 00 00    	je     80141e <devfile_write+0xb8>
+    int totalWrite = 0;
+  80139b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013a2:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  8013a9:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8013ac:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013b1:	49 39 dc             	cmp    %rbx,%r12
+  8013b4:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8013b8:	48 89 da             	mov    %rbx,%rdx
+  8013bb:	4c 89 ee             	mov    %r13,%rsi
+  8013be:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8013c5:	00 00 00 
+  8013c8:	48 b8 52 31 80 00 00 	movabs $0x803152,%rax
+  8013cf:	00 00 00 
+  8013d2:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8013d4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8013d8:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8013db:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013e9:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8013f0:	00 00 00 
+  8013f3:	ff d0                	call   *%rax
+        if (write < 0) {
+  8013f5:	85 c0                	test   %eax,%eax
+  8013f7:	78 21                	js     80141a <devfile_write+0xb4>
+        buf += write;
+  8013f9:	48 63 d0             	movslq %eax,%rdx
+  8013fc:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8013ff:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  801402:	49 29 d4             	sub    %rdx,%r12
+  801405:	75 a5                	jne    8013ac <devfile_write+0x46>
+    return totalWrite;
+  801407:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80140b:	48 83 c4 18          	add    $0x18,%rsp
+  80140f:	5b                   	pop    %rbx
+  801410:	41 5c                	pop    %r12
+  801412:	41 5d                	pop    %r13
+  801414:	41 5e                	pop    %r14
+  801416:	41 5f                	pop    %r15
+  801418:	5d                   	pop    %rbp
+  801419:	c3                   	ret
+            return write;
+  80141a:	48 98                	cltq
+  80141c:	eb ed                	jmp    80140b <devfile_write+0xa5>
+    int totalWrite = 0;
+  80141e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801425:	eb e0                	jmp    801407 <devfile_write+0xa1>
+        return -E_INVAL;
+  801427:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80142e:	eb db                	jmp    80140b <devfile_write+0xa5>
+  801430:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  801437:	c3                   	ret
+
+0000000000801438 <devfile_read>:
+    if (!fd || !buf) {
+  801438:	48 85 ff             	test   %rdi,%rdi
+  80143b:	0f 84 c0 00 00 00    	je     801501 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801441:	55                   	push   %rbp
+  801442:	48 89 e5             	mov    %rsp,%rbp
+  801445:	41 57                	push   %r15
+  801447:	41 56                	push   %r14
+  801449:	41 55                	push   %r13
+  80144b:	41 54                	push   %r12
+  80144d:	53                   	push   %rbx
+  80144e:	48 83 ec 18          	sub    $0x18,%rsp
+  801452:	49 89 ff             	mov    %rdi,%r15
+  801455:	49 89 f5             	mov    %rsi,%r13
+  801458:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80145b:	48 85 f6             	test   %rsi,%rsi
+  80145e:	0f 84 96 00 00 00    	je     8014fa <devfile_read+0xc2>
+    while (n) {
+  801464:	48 85 d2             	test   %rdx,%rdx
+  801467:	0f 84 87 00 00 00    	je     8014f4 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80146d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801474:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801475:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80147c:	00 00 00 
+  80147f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801483:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  801486:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80148b:	49 39 c4             	cmp    %rax,%r12
+  80148e:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  801492:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  801496:	be 00 00 00 00       	mov    $0x0,%esi
+  80149b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014a0:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8014a7:	00 00 00 
+  8014aa:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	7e 37                	jle    8014e7 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8014b0:	48 63 d8             	movslq %eax,%rbx
+  8014b3:	48 89 da             	mov    %rbx,%rdx
+  8014b6:	4c 89 f6             	mov    %r14,%rsi
+  8014b9:	4c 89 ef             	mov    %r13,%rdi
+  8014bc:	48 b8 52 31 80 00 00 	movabs $0x803152,%rax
+  8014c3:	00 00 00 
+  8014c6:	ff d0                	call   *%rax
+        buf += read;
+  8014c8:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8014cb:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8014cf:	49 29 dc             	sub    %rbx,%r12
+  8014d2:	75 ab                	jne    80147f <devfile_read+0x47>
+  return totalRead;
+  8014d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8014d8:	48 83 c4 18          	add    $0x18,%rsp
+  8014dc:	5b                   	pop    %rbx
+  8014dd:	41 5c                	pop    %r12
+  8014df:	41 5d                	pop    %r13
+  8014e1:	41 5e                	pop    %r14
+  8014e3:	41 5f                	pop    %r15
+  8014e5:	5d                   	pop    %rbp
+  8014e6:	c3                   	ret
+            return read ? read : totalRead;
+  8014e7:	48 63 d0             	movslq %eax,%rdx
+  8014ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ee:	48 0f 45 c2          	cmovne %rdx,%rax
+  8014f2:	eb e4                	jmp    8014d8 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8014f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8014f8:	eb da                	jmp    8014d4 <devfile_read+0x9c>
+        return E_INVAL;
+  8014fa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014ff:	eb d7                	jmp    8014d8 <devfile_read+0xa0>
+  801501:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801506:	c3                   	ret
+
+0000000000801507 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801507:	48 85 ff             	test   %rdi,%rdi
+  80150a:	74 5f                	je     80156b <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80150c:	55                   	push   %rbp
+  80150d:	48 89 e5             	mov    %rsp,%rbp
+  801510:	53                   	push   %rbx
+  801511:	48 83 ec 08          	sub    $0x8,%rsp
+  801515:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  801518:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  80151f:	00 00 00 
+  801522:	ff d0                	call   *%rax
+  801524:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80152a:	77 45                	ja     801571 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80152c:	48 89 de             	mov    %rbx,%rsi
+  80152f:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801536:	00 00 00 
+  801539:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  801540:	00 00 00 
+  801543:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  801545:	be 00 00 00 00       	mov    $0x0,%esi
+  80154a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80154f:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801556:	00 00 00 
+  801559:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801562:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+        return -E_INVAL;
+  80156b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801570:	c3                   	ret
+        return -E_INVAL;
+  801571:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801576:	eb ed                	jmp    801565 <devfile_receive_snapshot+0x5e>
+
+0000000000801578 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	41 55                	push   %r13
+  80157e:	41 54                	push   %r12
+  801580:	53                   	push   %rbx
+  801581:	48 83 ec 08          	sub    $0x8,%rsp
+  801585:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  801588:	48 85 f6             	test   %rsi,%rsi
+  80158b:	0f 94 c0             	sete   %al
+  80158e:	48 85 d2             	test   %rdx,%rdx
+  801591:	0f 94 c2             	sete   %dl
+  801594:	08 d0                	or     %dl,%al
+  801596:	0f 85 ad 00 00 00    	jne    801649 <devfile_send_snapshot+0xd1>
+  80159c:	48 89 fb             	mov    %rdi,%rbx
+  80159f:	49 89 f4             	mov    %rsi,%r12
+  8015a2:	48 85 ff             	test   %rdi,%rdi
+  8015a5:	0f 84 9e 00 00 00    	je     801649 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8015ab:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+  8015b7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015bd:	0f 87 8d 00 00 00    	ja     801650 <devfile_send_snapshot+0xd8>
+  8015c3:	4c 89 e7             	mov    %r12,%rdi
+  8015c6:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8015d8:	77 7d                	ja     801657 <devfile_send_snapshot+0xdf>
+  8015da:	4c 89 ef             	mov    %r13,%rdi
+  8015dd:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8015e4:	00 00 00 
+  8015e7:	ff d0                	call   *%rax
+  8015e9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8015ef:	77 6d                	ja     80165e <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8015f1:	48 89 de             	mov    %rbx,%rsi
+  8015f4:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8015fb:	00 00 00 
+  8015fe:	48 bb 58 2f 80 00 00 	movabs $0x802f58,%rbx
+  801605:	00 00 00 
+  801608:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80160a:	4c 89 e6             	mov    %r12,%rsi
+  80160d:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801614:	00 00 00 
+  801617:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  801619:	4c 89 ee             	mov    %r13,%rsi
+  80161c:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801623:	00 00 00 
+  801626:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  801628:	be 00 00 00 00       	mov    $0x0,%esi
+  80162d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801632:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801639:	00 00 00 
+  80163c:	ff d0                	call   *%rax
+}
+  80163e:	48 83 c4 08          	add    $0x8,%rsp
+  801642:	5b                   	pop    %rbx
+  801643:	41 5c                	pop    %r12
+  801645:	41 5d                	pop    %r13
+  801647:	5d                   	pop    %rbp
+  801648:	c3                   	ret
+        return -E_INVAL;
+  801649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164e:	eb ee                	jmp    80163e <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  801650:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801655:	eb e7                	jmp    80163e <devfile_send_snapshot+0xc6>
+  801657:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165c:	eb e0                	jmp    80163e <devfile_send_snapshot+0xc6>
+  80165e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801663:	eb d9                	jmp    80163e <devfile_send_snapshot+0xc6>
+
+0000000000801665 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  801665:	48 85 ff             	test   %rdi,%rdi
+  801668:	0f 84 41 01 00 00    	je     8017af <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	41 57                	push   %r15
+  801674:	41 56                	push   %r14
+  801676:	41 55                	push   %r13
+  801678:	41 54                	push   %r12
+  80167a:	53                   	push   %rbx
+  80167b:	48 83 ec 08          	sub    $0x8,%rsp
+  80167f:	49 89 fc             	mov    %rdi,%r12
+  801682:	49 89 f5             	mov    %rsi,%r13
+  801685:	48 89 d3             	mov    %rdx,%rbx
+  801688:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80168b:	48 85 f6             	test   %rsi,%rsi
+  80168e:	0f 84 ff 00 00 00    	je     801793 <devfile_diff_snapshots+0x12e>
+  801694:	48 85 d2             	test   %rdx,%rdx
+  801697:	0f 84 fd 00 00 00    	je     80179a <devfile_diff_snapshots+0x135>
+  80169d:	48 85 c9             	test   %rcx,%rcx
+  8016a0:	0f 84 f4 00 00 00    	je     80179a <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8016a6:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8016ad:	00 00 00 
+  8016b0:	ff d0                	call   *%rax
+  8016b2:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016b8:	0f 87 e3 00 00 00    	ja     8017a1 <devfile_diff_snapshots+0x13c>
+  8016be:	4c 89 ef             	mov    %r13,%rdi
+  8016c1:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+  8016cd:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8016d3:	0f 87 cf 00 00 00    	ja     8017a8 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8016d9:	4c 89 e6             	mov    %r12,%rsi
+  8016dc:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8016e3:	00 00 00 
+  8016e6:	4c 89 e7             	mov    %r12,%rdi
+  8016e9:	49 bf 58 2f 80 00 00 	movabs $0x802f58,%r15
+  8016f0:	00 00 00 
+  8016f3:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8016f6:	4c 89 ee             	mov    %r13,%rsi
+  8016f9:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  801700:	00 
+  801701:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  801704:	48 8b 03             	mov    (%rbx),%rax
+  801707:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80170e:	00 
+  80170f:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  801713:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  80171a:	00 
+  80171b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80171f:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  801726:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  801727:	be 00 00 00 00       	mov    $0x0,%esi
+  80172c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801731:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801738:	00 00 00 
+  80173b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	78 43                	js     801784 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  801741:	49 8b 04 24          	mov    (%r12),%rax
+  801745:	48 89 03             	mov    %rax,(%rbx)
+  801748:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80174d:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  801751:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  801756:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  80175a:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80175f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801763:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801767:	48 c1 e2 03          	shl    $0x3,%rdx
+  80176b:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  801770:	4c 89 f7             	mov    %r14,%rdi
+  801773:	48 b8 52 31 80 00 00 	movabs $0x803152,%rax
+  80177a:	00 00 00 
+  80177d:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80177f:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  801784:	48 83 c4 08          	add    $0x8,%rsp
+  801788:	5b                   	pop    %rbx
+  801789:	41 5c                	pop    %r12
+  80178b:	41 5d                	pop    %r13
+  80178d:	41 5e                	pop    %r14
+  80178f:	41 5f                	pop    %r15
+  801791:	5d                   	pop    %rbp
+  801792:	c3                   	ret
+        return -E_INVAL;
+  801793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801798:	eb ea                	jmp    801784 <devfile_diff_snapshots+0x11f>
+  80179a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179f:	eb e3                	jmp    801784 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a6:	eb dc                	jmp    801784 <devfile_diff_snapshots+0x11f>
+  8017a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ad:	eb d5                	jmp    801784 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8017af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017b4:	c3                   	ret
+
+00000000008017b5 <devfile_delete_snapshot>:
+    if (!name) {
+  8017b5:	48 85 ff             	test   %rdi,%rdi
+  8017b8:	74 5f                	je     801819 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8017ba:	55                   	push   %rbp
+  8017bb:	48 89 e5             	mov    %rsp,%rbp
+  8017be:	53                   	push   %rbx
+  8017bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8017c6:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+  8017d2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8017d8:	77 45                	ja     80181f <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8017da:	48 89 de             	mov    %rbx,%rsi
+  8017dd:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8017e4:	00 00 00 
+  8017e7:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8017f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8017fd:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801804:	00 00 00 
+  801807:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801810:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+        return -E_INVAL;
+  801819:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80181e:	c3                   	ret
+        return -E_INVAL;
+  80181f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801824:	eb ed                	jmp    801813 <devfile_delete_snapshot+0x5e>
+
+0000000000801826 <devfile_accept_snapshot>:
+    if (!name) {
+  801826:	48 85 ff             	test   %rdi,%rdi
+  801829:	74 5f                	je     80188a <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	53                   	push   %rbx
+  801830:	48 83 ec 08          	sub    $0x8,%rsp
+  801834:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  801837:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  80183e:	00 00 00 
+  801841:	ff d0                	call   *%rax
+  801843:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801849:	77 45                	ja     801890 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  80184b:	48 89 de             	mov    %rbx,%rsi
+  80184e:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  801855:	00 00 00 
+  801858:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  801864:	be 00 00 00 00       	mov    $0x0,%esi
+  801869:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80186e:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801875:	00 00 00 
+  801878:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801881:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801884:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801888:	c9                   	leave
+  801889:	c3                   	ret
+        return -E_INVAL;
+  80188a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80188f:	c3                   	ret
+        return -E_INVAL;
+  801890:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801895:	eb ed                	jmp    801884 <devfile_accept_snapshot+0x5e>
+
+0000000000801897 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  801897:	48 85 ff             	test   %rdi,%rdi
+  80189a:	0f 84 9f 00 00 00    	je     80193f <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+  8018a4:	41 54                	push   %r12
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 89 fb             	mov    %rdi,%rbx
+  8018aa:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8018ad:	48 85 f6             	test   %rsi,%rsi
+  8018b0:	74 78                	je     80192a <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8018b2:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8018b9:	00 00 00 
+  8018bc:	ff d0                	call   *%rax
+  8018be:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018c4:	77 6b                	ja     801931 <devfile_create_snapshot+0x9a>
+  8018c6:	4c 89 e7             	mov    %r12,%rdi
+  8018c9:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8018d0:	00 00 00 
+  8018d3:	ff d0                	call   *%rax
+  8018d5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8018db:	77 5b                	ja     801938 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8018dd:	48 89 de             	mov    %rbx,%rsi
+  8018e0:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018e7:	00 00 00 
+  8018ea:	48 bb 58 2f 80 00 00 	movabs $0x802f58,%rbx
+  8018f1:	00 00 00 
+  8018f4:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8018f6:	4c 89 e6             	mov    %r12,%rsi
+  8018f9:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  801900:	00 00 00 
+  801903:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  801905:	be 00 00 00 00       	mov    $0x0,%esi
+  80190a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80190f:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801925:	5b                   	pop    %rbx
+  801926:	41 5c                	pop    %r12
+  801928:	5d                   	pop    %rbp
+  801929:	c3                   	ret
+        return -E_INVAL;
+  80192a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192f:	eb f4                	jmp    801925 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  801931:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801936:	eb ed                	jmp    801925 <devfile_create_snapshot+0x8e>
+  801938:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193d:	eb e6                	jmp    801925 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80193f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801944:	c3                   	ret
+
+0000000000801945 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801945:	55                   	push   %rbp
+  801946:	48 89 e5             	mov    %rsp,%rbp
+  801949:	41 54                	push   %r12
+  80194b:	53                   	push   %rbx
+  80194c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80194f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801952:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801959:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80195b:	be 00 00 00 00       	mov    $0x0,%esi
+  801960:	bf 05 00 00 00       	mov    $0x5,%edi
+  801965:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80196c:	00 00 00 
+  80196f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801971:	85 c0                	test   %eax,%eax
+  801973:	78 3d                	js     8019b2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801975:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80197c:	00 00 00 
+  80197f:	4c 89 e6             	mov    %r12,%rsi
+  801982:	48 89 df             	mov    %rbx,%rdi
+  801985:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801991:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801998:	00 
+  801999:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80199f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8019a6:	00 
+  8019a7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b2:	5b                   	pop    %rbx
+  8019b3:	41 5c                	pop    %r12
+  8019b5:	5d                   	pop    %rbp
+  8019b6:	c3                   	ret
+
+00000000008019b7 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8019b7:	55                   	push   %rbp
+  8019b8:	48 89 e5             	mov    %rsp,%rbp
+  8019bb:	41 57                	push   %r15
+  8019bd:	41 56                	push   %r14
+  8019bf:	41 55                	push   %r13
+  8019c1:	41 54                	push   %r12
+  8019c3:	53                   	push   %rbx
+  8019c4:	48 83 ec 38          	sub    $0x38,%rsp
+  8019c8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8019cc:	49 89 f5             	mov    %rsi,%r13
+  8019cf:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019d2:	48 89 f0             	mov    %rsi,%rax
+  8019d5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019da:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8019de:	75 4f                	jne    801a2f <devfile_readmap+0x78>
+  8019e0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019e4:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8019ea:	75 1f                	jne    801a0b <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8019ec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019f0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8019f4:	49 be 9f 21 80 00 00 	movabs $0x80219f,%r14
+  8019fb:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8019fe:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  801a05:	0f 87 9d 00 00 00    	ja     801aa8 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  801a0b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a0f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  801a13:	4d 85 ff             	test   %r15,%r15
+  801a16:	0f 85 cf 00 00 00    	jne    801aeb <devfile_readmap+0x134>
+  801a1c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  801a20:	48 83 c4 38          	add    $0x38,%rsp
+  801a24:	5b                   	pop    %rbx
+  801a25:	41 5c                	pop    %r12
+  801a27:	41 5d                	pop    %r13
+  801a29:	41 5e                	pop    %r14
+  801a2b:	41 5f                	pop    %r15
+  801a2d:	5d                   	pop    %rbp
+  801a2e:	c3                   	ret
+    size_t totalRead = 0;
+  801a2f:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a36:	00 
+  801a37:	eb da                	jmp    801a13 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a39:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a40:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a47:	00 00 00 
+  801a4a:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  801a4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a50:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  801a54:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801a58:	4c 89 ee             	mov    %r13,%rsi
+  801a5b:	bf 14 00 00 00       	mov    $0x14,%edi
+  801a60:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	7e a3                	jle    801a13 <devfile_readmap+0x5c>
+  801a70:	48 98                	cltq
+  801a72:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801a76:	72 9b                	jb     801a13 <devfile_readmap+0x5c>
+        buf += read;
+  801a78:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  801a7b:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  801a7e:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  801a82:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  801a89:	75 88                	jne    801a13 <devfile_readmap+0x5c>
+  801a8b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a8f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a95:	0f 85 78 ff ff ff    	jne    801a13 <devfile_readmap+0x5c>
+  801a9b:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  801aa2:	0f 86 6b ff ff ff    	jbe    801a13 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  801aa8:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  801aae:	4d 39 e7             	cmp    %r12,%r15
+  801ab1:	4d 0f 46 e7          	cmovbe %r15,%r12
+  801ab5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  801abc:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ac0:	0f 84 73 ff ff ff    	je     801a39 <devfile_readmap+0x82>
+  801ac6:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  801aca:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  801acf:	41 ff d6             	call   *%r14
+  801ad2:	a8 40                	test   $0x40,%al
+  801ad4:	0f 85 39 ff ff ff    	jne    801a13 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  801ada:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ae1:	4c 39 e3             	cmp    %r12,%rbx
+  801ae4:	72 e4                	jb     801aca <devfile_readmap+0x113>
+  801ae6:	e9 4e ff ff ff       	jmp    801a39 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  801aeb:	4c 89 fa             	mov    %r15,%rdx
+  801aee:	4c 89 ee             	mov    %r13,%rsi
+  801af1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801af5:	48 b8 38 14 80 00 00 	movabs $0x801438,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  801b01:	48 85 c0             	test   %rax,%rax
+  801b04:	78 0c                	js     801b12 <devfile_readmap+0x15b>
+    return totalRead + read;
+  801b06:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b0a:	48 01 f0             	add    %rsi,%rax
+  801b0d:	e9 0e ff ff ff       	jmp    801a20 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  801b12:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b16:	48 85 f6             	test   %rsi,%rsi
+  801b19:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b1d:	e9 fe fe ff ff       	jmp    801a20 <devfile_readmap+0x69>
+
+0000000000801b22 <open>:
+open(const char *path, int mode) {
+  801b22:	55                   	push   %rbp
+  801b23:	48 89 e5             	mov    %rsp,%rbp
+  801b26:	41 55                	push   %r13
+  801b28:	41 54                	push   %r12
+  801b2a:	53                   	push   %rbx
+  801b2b:	48 83 ec 18          	sub    $0x18,%rsp
+  801b2f:	49 89 fc             	mov    %rdi,%r12
+  801b32:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801b35:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801b47:	0f 87 8a 00 00 00    	ja     801bd7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801b4d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801b51:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+  801b5d:	89 c3                	mov    %eax,%ebx
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 50                	js     801bb3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801b63:	4c 89 e6             	mov    %r12,%rsi
+  801b66:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801b6d:	00 00 00 
+  801b70:	48 89 df             	mov    %rbx,%rdi
+  801b73:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801b7f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b86:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801b8a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b8f:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801b96:	00 00 00 
+  801b99:	ff d0                	call   *%rax
+  801b9b:	89 c3                	mov    %eax,%ebx
+  801b9d:	85 c0                	test   %eax,%eax
+  801b9f:	78 1f                	js     801bc0 <open+0x9e>
+    return fd2num(fd);
+  801ba1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ba5:	48 b8 52 06 80 00 00 	movabs $0x800652,%rax
+  801bac:	00 00 00 
+  801baf:	ff d0                	call   *%rax
+  801bb1:	89 c3                	mov    %eax,%ebx
+}
+  801bb3:	89 d8                	mov    %ebx,%eax
+  801bb5:	48 83 c4 18          	add    $0x18,%rsp
+  801bb9:	5b                   	pop    %rbx
+  801bba:	41 5c                	pop    %r12
+  801bbc:	41 5d                	pop    %r13
+  801bbe:	5d                   	pop    %rbp
+  801bbf:	c3                   	ret
+        fd_close(fd, 0);
+  801bc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801bc9:	48 b8 9b 07 80 00 00 	movabs $0x80079b,%rax
+  801bd0:	00 00 00 
+  801bd3:	ff d0                	call   *%rax
+        return res;
+  801bd5:	eb dc                	jmp    801bb3 <open+0x91>
+        return -E_BAD_PATH;
+  801bd7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801bdc:	eb d5                	jmp    801bb3 <open+0x91>
+
+0000000000801bde <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801bde:	55                   	push   %rbp
+  801bdf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801be2:	be 00 00 00 00       	mov    $0x0,%esi
+  801be7:	bf 13 00 00 00       	mov    $0x13,%edi
+  801bec:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+}
+  801bf8:	5d                   	pop    %rbp
+  801bf9:	c3                   	ret
+
+0000000000801bfa <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+  801bfe:	41 54                	push   %r12
+  801c00:	53                   	push   %rbx
+  801c01:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801c04:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801c0b:	00 00 00 
+  801c0e:	ff d0                	call   *%rax
+  801c10:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801c13:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  801c1a:	00 00 00 
+  801c1d:	48 89 df             	mov    %rbx,%rdi
+  801c20:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  801c27:	00 00 00 
+  801c2a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801c2c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801c31:	41 2b 04 24          	sub    (%r12),%eax
+  801c35:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801c3b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c42:	00 00 00 
+    stat->st_dev = &devpipe;
+  801c45:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  801c4c:	00 00 00 
+  801c4f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5b:	5b                   	pop    %rbx
+  801c5c:	41 5c                	pop    %r12
+  801c5e:	5d                   	pop    %rbp
+  801c5f:	c3                   	ret
+
+0000000000801c60 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801c60:	55                   	push   %rbp
+  801c61:	48 89 e5             	mov    %rsp,%rbp
+  801c64:	41 54                	push   %r12
+  801c66:	53                   	push   %rbx
+  801c67:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c6f:	48 89 fe             	mov    %rdi,%rsi
+  801c72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c77:	49 bc 4e 03 80 00 00 	movabs $0x80034e,%r12
+  801c7e:	00 00 00 
+  801c81:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801c84:	48 89 df             	mov    %rbx,%rdi
+  801c87:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801c8e:	00 00 00 
+  801c91:	ff d0                	call   *%rax
+  801c93:	48 89 c6             	mov    %rax,%rsi
+  801c96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca0:	41 ff d4             	call   *%r12
+}
+  801ca3:	5b                   	pop    %rbx
+  801ca4:	41 5c                	pop    %r12
+  801ca6:	5d                   	pop    %rbp
+  801ca7:	c3                   	ret
+
+0000000000801ca8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801ca8:	55                   	push   %rbp
+  801ca9:	48 89 e5             	mov    %rsp,%rbp
+  801cac:	41 57                	push   %r15
+  801cae:	41 56                	push   %r14
+  801cb0:	41 55                	push   %r13
+  801cb2:	41 54                	push   %r12
+  801cb4:	53                   	push   %rbx
+  801cb5:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb9:	49 89 fc             	mov    %rdi,%r12
+  801cbc:	49 89 f5             	mov    %rsi,%r13
+  801cbf:	49 89 d7             	mov    %rdx,%r15
+  801cc2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801cc6:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801cd2:	4d 85 ff             	test   %r15,%r15
+  801cd5:	0f 84 af 00 00 00    	je     801d8a <devpipe_write+0xe2>
+  801cdb:	48 89 c3             	mov    %rax,%rbx
+  801cde:	4c 89 f8             	mov    %r15,%rax
+  801ce1:	4d 89 ef             	mov    %r13,%r15
+  801ce4:	4c 01 e8             	add    %r13,%rax
+  801ce7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801ceb:	49 bd 56 02 80 00 00 	movabs $0x800256,%r13
+  801cf2:	00 00 00 
+            sys_yield();
+  801cf5:	49 be f3 01 80 00 00 	movabs $0x8001f3,%r14
+  801cfc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801cff:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d02:	48 63 ce             	movslq %esi,%rcx
+  801d05:	48 63 03             	movslq (%rbx),%rax
+  801d08:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d0e:	48 39 c1             	cmp    %rax,%rcx
+  801d11:	72 2e                	jb     801d41 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801d13:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d18:	48 89 da             	mov    %rbx,%rdx
+  801d1b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d20:	4c 89 e7             	mov    %r12,%rdi
+  801d23:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	74 66                	je     801d90 <devpipe_write+0xe8>
+            sys_yield();
+  801d2a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801d2d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801d30:	48 63 ce             	movslq %esi,%rcx
+  801d33:	48 63 03             	movslq (%rbx),%rax
+  801d36:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801d3c:	48 39 c1             	cmp    %rax,%rcx
+  801d3f:	73 d2                	jae    801d13 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d41:	41 0f b6 3f          	movzbl (%r15),%edi
+  801d45:	48 89 ca             	mov    %rcx,%rdx
+  801d48:	48 c1 ea 03          	shr    $0x3,%rdx
+  801d4c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801d53:	08 10 20 
+  801d56:	48 f7 e2             	mul    %rdx
+  801d59:	48 c1 ea 06          	shr    $0x6,%rdx
+  801d5d:	48 89 d0             	mov    %rdx,%rax
+  801d60:	48 c1 e0 09          	shl    $0x9,%rax
+  801d64:	48 29 d0             	sub    %rdx,%rax
+  801d67:	48 c1 e0 03          	shl    $0x3,%rax
+  801d6b:	48 29 c1             	sub    %rax,%rcx
+  801d6e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801d73:	83 c6 01             	add    $0x1,%esi
+  801d76:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801d79:	49 83 c7 01          	add    $0x1,%r15
+  801d7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d81:	49 39 c7             	cmp    %rax,%r15
+  801d84:	0f 85 75 ff ff ff    	jne    801cff <devpipe_write+0x57>
+    return n;
+  801d8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d8e:	eb 05                	jmp    801d95 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801d90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d95:	48 83 c4 18          	add    $0x18,%rsp
+  801d99:	5b                   	pop    %rbx
+  801d9a:	41 5c                	pop    %r12
+  801d9c:	41 5d                	pop    %r13
+  801d9e:	41 5e                	pop    %r14
+  801da0:	41 5f                	pop    %r15
+  801da2:	5d                   	pop    %rbp
+  801da3:	c3                   	ret
+
+0000000000801da4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	41 57                	push   %r15
+  801daa:	41 56                	push   %r14
+  801dac:	41 55                	push   %r13
+  801dae:	41 54                	push   %r12
+  801db0:	53                   	push   %rbx
+  801db1:	48 83 ec 18          	sub    $0x18,%rsp
+  801db5:	49 89 fc             	mov    %rdi,%r12
+  801db8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801dbc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801dc0:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801dcf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dd5:	49 bd 56 02 80 00 00 	movabs $0x800256,%r13
+  801ddc:	00 00 00 
+            sys_yield();
+  801ddf:	49 be f3 01 80 00 00 	movabs $0x8001f3,%r14
+  801de6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801de9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dee:	74 7d                	je     801e6d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801df0:	8b 03                	mov    (%rbx),%eax
+  801df2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801df5:	75 26                	jne    801e1d <devpipe_read+0x79>
+            if (i > 0) return i;
+  801df7:	4d 85 ff             	test   %r15,%r15
+  801dfa:	75 77                	jne    801e73 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801dfc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e01:	48 89 da             	mov    %rbx,%rdx
+  801e04:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e09:	4c 89 e7             	mov    %r12,%rdi
+  801e0c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	74 72                	je     801e85 <devpipe_read+0xe1>
+            sys_yield();
+  801e13:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801e16:	8b 03                	mov    (%rbx),%eax
+  801e18:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801e1b:	74 df                	je     801dfc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e1d:	48 63 c8             	movslq %eax,%rcx
+  801e20:	48 89 ca             	mov    %rcx,%rdx
+  801e23:	48 c1 ea 03          	shr    $0x3,%rdx
+  801e27:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801e2e:	08 10 20 
+  801e31:	48 89 d0             	mov    %rdx,%rax
+  801e34:	48 f7 e6             	mul    %rsi
+  801e37:	48 c1 ea 06          	shr    $0x6,%rdx
+  801e3b:	48 89 d0             	mov    %rdx,%rax
+  801e3e:	48 c1 e0 09          	shl    $0x9,%rax
+  801e42:	48 29 d0             	sub    %rdx,%rax
+  801e45:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801e4c:	00 
+  801e4d:	48 89 c8             	mov    %rcx,%rax
+  801e50:	48 29 d0             	sub    %rdx,%rax
+  801e53:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801e58:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e5c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801e60:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801e63:	49 83 c7 01          	add    $0x1,%r15
+  801e67:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801e6b:	75 83                	jne    801df0 <devpipe_read+0x4c>
+    return n;
+  801e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e71:	eb 03                	jmp    801e76 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801e73:	4c 89 f8             	mov    %r15,%rax
+}
+  801e76:	48 83 c4 18          	add    $0x18,%rsp
+  801e7a:	5b                   	pop    %rbx
+  801e7b:	41 5c                	pop    %r12
+  801e7d:	41 5d                	pop    %r13
+  801e7f:	41 5e                	pop    %r14
+  801e81:	41 5f                	pop    %r15
+  801e83:	5d                   	pop    %rbp
+  801e84:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8a:	eb ea                	jmp    801e76 <devpipe_read+0xd2>
+
+0000000000801e8c <pipe>:
+pipe(int pfd[2]) {
+  801e8c:	55                   	push   %rbp
+  801e8d:	48 89 e5             	mov    %rsp,%rbp
+  801e90:	41 55                	push   %r13
+  801e92:	41 54                	push   %r12
+  801e94:	53                   	push   %rbx
+  801e95:	48 83 ec 18          	sub    $0x18,%rsp
+  801e99:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801e9c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ea0:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  801ea7:	00 00 00 
+  801eaa:	ff d0                	call   *%rax
+  801eac:	89 c3                	mov    %eax,%ebx
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	0f 88 a0 01 00 00    	js     802056 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801eb6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ebb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ec0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ec4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec9:	48 b8 82 02 80 00 00 	movabs $0x800282,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	0f 88 77 01 00 00    	js     802056 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801edf:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801ee3:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  801eea:	00 00 00 
+  801eed:	ff d0                	call   *%rax
+  801eef:	89 c3                	mov    %eax,%ebx
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	0f 88 43 01 00 00    	js     80203c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801ef9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801efe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f03:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0c:	48 b8 82 02 80 00 00 	movabs $0x800282,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	0f 88 1a 01 00 00    	js     80203c <pipe+0x1b0>
+    va = fd2data(fd0);
+  801f22:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f26:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801f2d:	00 00 00 
+  801f30:	ff d0                	call   *%rax
+  801f32:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801f35:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f3a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f3f:	48 89 c6             	mov    %rax,%rsi
+  801f42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f47:	48 b8 82 02 80 00 00 	movabs $0x800282,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	0f 88 c5 00 00 00    	js     802022 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801f5d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801f61:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  801f68:	00 00 00 
+  801f6b:	ff d0                	call   *%rax
+  801f6d:	48 89 c1             	mov    %rax,%rcx
+  801f70:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801f76:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f81:	4c 89 ee             	mov    %r13,%rsi
+  801f84:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f89:	48 b8 e9 02 80 00 00 	movabs $0x8002e9,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+  801f95:	89 c3                	mov    %eax,%ebx
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	78 6e                	js     802009 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801f9b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fa0:	4c 89 ef             	mov    %r13,%rdi
+  801fa3:	48 b8 24 02 80 00 00 	movabs $0x800224,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	83 f8 02             	cmp    $0x2,%eax
+  801fb2:	0f 85 ab 00 00 00    	jne    802063 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801fb8:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  801fbf:	00 00 
+  801fc1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fc5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801fc7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fcb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801fd2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fd6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801fd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801fe3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fe7:	48 bb 52 06 80 00 00 	movabs $0x800652,%rbx
+  801fee:	00 00 00 
+  801ff1:	ff d3                	call   *%rbx
+  801ff3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801ff7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801ffb:	ff d3                	call   *%rbx
+  801ffd:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802007:	eb 4d                	jmp    802056 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802009:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80200e:	4c 89 ee             	mov    %r13,%rsi
+  802011:	bf 00 00 00 00       	mov    $0x0,%edi
+  802016:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802022:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802027:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80202b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802030:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80203c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802041:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802045:	bf 00 00 00 00       	mov    $0x0,%edi
+  80204a:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+}
+  802056:	89 d8                	mov    %ebx,%eax
+  802058:	48 83 c4 18          	add    $0x18,%rsp
+  80205c:	5b                   	pop    %rbx
+  80205d:	41 5c                	pop    %r12
+  80205f:	41 5d                	pop    %r13
+  802061:	5d                   	pop    %rbp
+  802062:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802063:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  80206a:	00 00 00 
+  80206d:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  802074:	00 00 00 
+  802077:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80207c:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  802083:	00 00 00 
+  802086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208b:	49 b8 e3 24 80 00 00 	movabs $0x8024e3,%r8
+  802092:	00 00 00 
+  802095:	41 ff d0             	call   *%r8
+
+0000000000802098 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802098:	55                   	push   %rbp
+  802099:	48 89 e5             	mov    %rsp,%rbp
+  80209c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8020a0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020a4:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020b0:	85 c0                	test   %eax,%eax
+  8020b2:	78 35                	js     8020e9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8020b4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020b8:	48 b8 64 06 80 00 00 	movabs $0x800664,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+  8020c4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8020c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020d5:	48 b8 56 02 80 00 00 	movabs $0x800256,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	0f 94 c0             	sete   %al
+  8020e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8020e9:	c9                   	leave
+  8020ea:	c3                   	ret
+
+00000000008020eb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8020eb:	48 89 f8             	mov    %rdi,%rax
+  8020ee:	48 c1 e8 27          	shr    $0x27,%rax
+  8020f2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8020f9:	01 00 00 
+  8020fc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802100:	f6 c2 01             	test   $0x1,%dl
+  802103:	74 6d                	je     802172 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802105:	48 89 f8             	mov    %rdi,%rax
+  802108:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80210c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802113:	01 00 00 
+  802116:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80211a:	f6 c2 01             	test   $0x1,%dl
+  80211d:	74 62                	je     802181 <get_uvpt_entry+0x96>
+  80211f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802126:	01 00 00 
+  802129:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80212d:	f6 c2 80             	test   $0x80,%dl
+  802130:	75 4f                	jne    802181 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802132:	48 89 f8             	mov    %rdi,%rax
+  802135:	48 c1 e8 15          	shr    $0x15,%rax
+  802139:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802140:	01 00 00 
+  802143:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802147:	f6 c2 01             	test   $0x1,%dl
+  80214a:	74 44                	je     802190 <get_uvpt_entry+0xa5>
+  80214c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802153:	01 00 00 
+  802156:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80215a:	f6 c2 80             	test   $0x80,%dl
+  80215d:	75 31                	jne    802190 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80215f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802163:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80216a:	01 00 00 
+  80216d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802171:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802172:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802179:	01 00 00 
+  80217c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802180:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802181:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802188:	01 00 00 
+  80218b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80218f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802190:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802197:	01 00 00 
+  80219a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80219e:	c3                   	ret
+
+000000000080219f <get_prot>:
+
+int
+get_prot(void *va) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021a3:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+  8021af:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8021b2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8021b7:	89 c1                	mov    %eax,%ecx
+  8021b9:	83 c9 04             	or     $0x4,%ecx
+  8021bc:	f6 c2 01             	test   $0x1,%dl
+  8021bf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8021c2:	89 c1                	mov    %eax,%ecx
+  8021c4:	83 c9 02             	or     $0x2,%ecx
+  8021c7:	f6 c2 02             	test   $0x2,%dl
+  8021ca:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8021cd:	89 c1                	mov    %eax,%ecx
+  8021cf:	83 c9 01             	or     $0x1,%ecx
+  8021d2:	48 85 d2             	test   %rdx,%rdx
+  8021d5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8021d8:	89 c1                	mov    %eax,%ecx
+  8021da:	83 c9 40             	or     $0x40,%ecx
+  8021dd:	f6 c6 04             	test   $0x4,%dh
+  8021e0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8021e3:	5d                   	pop    %rbp
+  8021e4:	c3                   	ret
+
+00000000008021e5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8021e5:	55                   	push   %rbp
+  8021e6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8021e9:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8021f5:	48 c1 e8 06          	shr    $0x6,%rax
+  8021f9:	83 e0 01             	and    $0x1,%eax
+}
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+
+00000000008021fe <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8021fe:	55                   	push   %rbp
+  8021ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802202:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  802209:	00 00 00 
+  80220c:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80220e:	48 c1 e8 05          	shr    $0x5,%rax
+  802212:	83 e0 01             	and    $0x1,%eax
+}
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+
+0000000000802217 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80221b:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  802222:	00 00 00 
+  802225:	ff d0                	call   *%rax
+  802227:	83 e0 01             	and    $0x1,%eax
+}
+  80222a:	5d                   	pop    %rbp
+  80222b:	c3                   	ret
+
+000000000080222c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80222c:	55                   	push   %rbp
+  80222d:	48 89 e5             	mov    %rsp,%rbp
+  802230:	41 57                	push   %r15
+  802232:	41 56                	push   %r14
+  802234:	41 55                	push   %r13
+  802236:	41 54                	push   %r12
+  802238:	53                   	push   %rbx
+  802239:	48 83 ec 18          	sub    $0x18,%rsp
+  80223d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802241:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  802245:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80224a:	49 bd 17 22 80 00 00 	movabs $0x802217,%r13
+  802251:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802254:	49 bf 9f 21 80 00 00 	movabs $0x80219f,%r15
+  80225b:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80225e:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  802265:	00 00 00 
+  802268:	eb 0c                	jmp    802276 <foreach_shared_region+0x4a>
+  80226a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802271:	4c 39 f3             	cmp    %r14,%rbx
+  802274:	74 2e                	je     8022a4 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  802276:	48 89 df             	mov    %rbx,%rdi
+  802279:	41 ff d5             	call   *%r13
+  80227c:	84 c0                	test   %al,%al
+  80227e:	74 ea                	je     80226a <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  802280:	48 89 df             	mov    %rbx,%rdi
+  802283:	41 ff d7             	call   *%r15
+  802286:	a8 40                	test   $0x40,%al
+  802288:	74 e0                	je     80226a <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80228a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802291:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802295:	48 89 df             	mov    %rbx,%rdi
+  802298:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80229c:	ff d0                	call   *%rax
+				if (res < 0) {
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	79 c8                	jns    80226a <foreach_shared_region+0x3e>
+  8022a2:	eb 05                	jmp    8022a9 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8022a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a9:	48 83 c4 18          	add    $0x18,%rsp
+  8022ad:	5b                   	pop    %rbx
+  8022ae:	41 5c                	pop    %r12
+  8022b0:	41 5d                	pop    %r13
+  8022b2:	41 5e                	pop    %r14
+  8022b4:	41 5f                	pop    %r15
+  8022b6:	5d                   	pop    %rbp
+  8022b7:	c3                   	ret
+
+00000000008022b8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bd:	c3                   	ret
+
+00000000008022be <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8022be:	55                   	push   %rbp
+  8022bf:	48 89 e5             	mov    %rsp,%rbp
+  8022c2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8022c5:	48 be d4 37 80 00 00 	movabs $0x8037d4,%rsi
+  8022cc:	00 00 00 
+  8022cf:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+    return 0;
+}
+  8022db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e0:	5d                   	pop    %rbp
+  8022e1:	c3                   	ret
+
+00000000008022e2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022e2:	55                   	push   %rbp
+  8022e3:	48 89 e5             	mov    %rsp,%rbp
+  8022e6:	41 57                	push   %r15
+  8022e8:	41 56                	push   %r14
+  8022ea:	41 55                	push   %r13
+  8022ec:	41 54                	push   %r12
+  8022ee:	53                   	push   %rbx
+  8022ef:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8022f6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8022fd:	48 85 d2             	test   %rdx,%rdx
+  802300:	74 7a                	je     80237c <devcons_write+0x9a>
+  802302:	49 89 d6             	mov    %rdx,%r14
+  802305:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80230b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802310:	49 bf 52 31 80 00 00 	movabs $0x803152,%r15
+  802317:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80231a:	4c 89 f3             	mov    %r14,%rbx
+  80231d:	48 29 f3             	sub    %rsi,%rbx
+  802320:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802325:	48 39 c3             	cmp    %rax,%rbx
+  802328:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80232c:	4c 63 eb             	movslq %ebx,%r13
+  80232f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802336:	48 01 c6             	add    %rax,%rsi
+  802339:	4c 89 ea             	mov    %r13,%rdx
+  80233c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802343:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802346:	4c 89 ee             	mov    %r13,%rsi
+  802349:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802350:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80235c:	41 01 dc             	add    %ebx,%r12d
+  80235f:	49 63 f4             	movslq %r12d,%rsi
+  802362:	4c 39 f6             	cmp    %r14,%rsi
+  802365:	72 b3                	jb     80231a <devcons_write+0x38>
+    return res;
+  802367:	49 63 c4             	movslq %r12d,%rax
+}
+  80236a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802371:	5b                   	pop    %rbx
+  802372:	41 5c                	pop    %r12
+  802374:	41 5d                	pop    %r13
+  802376:	41 5e                	pop    %r14
+  802378:	41 5f                	pop    %r15
+  80237a:	5d                   	pop    %rbp
+  80237b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80237c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802382:	eb e3                	jmp    802367 <devcons_write+0x85>
+
+0000000000802384 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802384:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238c:	48 85 c0             	test   %rax,%rax
+  80238f:	74 55                	je     8023e6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802391:	55                   	push   %rbp
+  802392:	48 89 e5             	mov    %rsp,%rbp
+  802395:	41 55                	push   %r13
+  802397:	41 54                	push   %r12
+  802399:	53                   	push   %rbx
+  80239a:	48 83 ec 08          	sub    $0x8,%rsp
+  80239e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8023a1:	48 bb 26 01 80 00 00 	movabs $0x800126,%rbx
+  8023a8:	00 00 00 
+  8023ab:	49 bc f3 01 80 00 00 	movabs $0x8001f3,%r12
+  8023b2:	00 00 00 
+  8023b5:	eb 03                	jmp    8023ba <devcons_read+0x36>
+  8023b7:	41 ff d4             	call   *%r12
+  8023ba:	ff d3                	call   *%rbx
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	74 f7                	je     8023b7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8023c0:	48 63 d0             	movslq %eax,%rdx
+  8023c3:	78 13                	js     8023d8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8023c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ca:	83 f8 04             	cmp    $0x4,%eax
+  8023cd:	74 09                	je     8023d8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8023cf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8023d3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8023d8:	48 89 d0             	mov    %rdx,%rax
+  8023db:	48 83 c4 08          	add    $0x8,%rsp
+  8023df:	5b                   	pop    %rbx
+  8023e0:	41 5c                	pop    %r12
+  8023e2:	41 5d                	pop    %r13
+  8023e4:	5d                   	pop    %rbp
+  8023e5:	c3                   	ret
+  8023e6:	48 89 d0             	mov    %rdx,%rax
+  8023e9:	c3                   	ret
+
+00000000008023ea <cputchar>:
+cputchar(int ch) {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+  8023ee:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8023f2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8023f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8023fb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8023ff:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+000000000080240d <getchar>:
+getchar(void) {
+  80240d:	55                   	push   %rbp
+  80240e:	48 89 e5             	mov    %rsp,%rbp
+  802411:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802415:	ba 01 00 00 00       	mov    $0x1,%edx
+  80241a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80241e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802423:	48 b8 c3 09 80 00 00 	movabs $0x8009c3,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+  80242f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802431:	85 c0                	test   %eax,%eax
+  802433:	78 06                	js     80243b <getchar+0x2e>
+  802435:	74 08                	je     80243f <getchar+0x32>
+  802437:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80243b:	89 d0                	mov    %edx,%eax
+  80243d:	c9                   	leave
+  80243e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80243f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802444:	eb f5                	jmp    80243b <getchar+0x2e>
+
+0000000000802446 <iscons>:
+iscons(int fdnum) {
+  802446:	55                   	push   %rbp
+  802447:	48 89 e5             	mov    %rsp,%rbp
+  80244a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80244e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802452:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	78 18                	js     80247a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802462:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802466:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80246d:	00 00 00 
+  802470:	8b 00                	mov    (%rax),%eax
+  802472:	39 02                	cmp    %eax,(%rdx)
+  802474:	0f 94 c0             	sete   %al
+  802477:	0f b6 c0             	movzbl %al,%eax
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+000000000080247c <opencons>:
+opencons(void) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802484:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802488:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+  802494:	85 c0                	test   %eax,%eax
+  802496:	78 49                	js     8024e1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802498:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80249d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8024a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ab:	48 b8 82 02 80 00 00 	movabs $0x800282,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	78 26                	js     8024e1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8024bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024bf:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  8024c6:	00 00 
+  8024c8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8024ca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024ce:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8024d5:	48 b8 52 06 80 00 00 	movabs $0x800652,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+}
+  8024e1:	c9                   	leave
+  8024e2:	c3                   	ret
+
+00000000008024e3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8024e3:	55                   	push   %rbp
+  8024e4:	48 89 e5             	mov    %rsp,%rbp
+  8024e7:	41 56                	push   %r14
+  8024e9:	41 55                	push   %r13
+  8024eb:	41 54                	push   %r12
+  8024ed:	53                   	push   %rbx
+  8024ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f2:	49 89 fc             	mov    %rdi,%r12
+  8024f5:	41 89 f5             	mov    %esi,%r13d
+  8024f8:	48 89 d3             	mov    %rdx,%rbx
+  8024fb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8024ff:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802503:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802507:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80250e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802512:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802516:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80251a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80251e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802525:	00 00 00 
+  802528:	4c 8b 30             	mov    (%rax),%r14
+  80252b:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	89 c6                	mov    %eax,%esi
+  802539:	45 89 e8             	mov    %r13d,%r8d
+  80253c:	4c 89 e1             	mov    %r12,%rcx
+  80253f:	4c 89 f2             	mov    %r14,%rdx
+  802542:	48 bf e0 37 80 00 00 	movabs $0x8037e0,%rdi
+  802549:	00 00 00 
+  80254c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802551:	49 bc 33 26 80 00 00 	movabs $0x802633,%r12
+  802558:	00 00 00 
+  80255b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80255e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802562:	48 89 df             	mov    %rbx,%rdi
+  802565:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+    cprintf("\n");
+  802571:	48 bf 33 37 80 00 00 	movabs $0x803733,%rdi
+  802578:	00 00 00 
+  80257b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802580:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802583:	cc                   	int3
+  802584:	eb fd                	jmp    802583 <_panic+0xa0>
+
+0000000000802586 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802586:	55                   	push   %rbp
+  802587:	48 89 e5             	mov    %rsp,%rbp
+  80258a:	53                   	push   %rbx
+  80258b:	48 83 ec 08          	sub    $0x8,%rsp
+  80258f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802592:	8b 06                	mov    (%rsi),%eax
+  802594:	8d 50 01             	lea    0x1(%rax),%edx
+  802597:	89 16                	mov    %edx,(%rsi)
+  802599:	48 98                	cltq
+  80259b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8025a0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8025a6:	74 0a                	je     8025b2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8025a8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8025ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b0:	c9                   	leave
+  8025b1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8025b2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8025b6:	be ff 00 00 00       	mov    $0xff,%esi
+  8025bb:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025c7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8025cd:	eb d9                	jmp    8025a8 <putch+0x22>
+
+00000000008025cf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+  8025d3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8025da:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8025dd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8025e4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ee:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8025f1:	48 89 f1             	mov    %rsi,%rcx
+  8025f4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8025fb:	48 bf 86 25 80 00 00 	movabs $0x802586,%rdi
+  802602:	00 00 00 
+  802605:	48 b8 83 27 80 00 00 	movabs $0x802783,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802611:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802618:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80261f:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  802626:	00 00 00 
+  802629:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80262b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802631:	c9                   	leave
+  802632:	c3                   	ret
+
+0000000000802633 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802633:	55                   	push   %rbp
+  802634:	48 89 e5             	mov    %rsp,%rbp
+  802637:	48 83 ec 50          	sub    $0x50,%rsp
+  80263b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80263f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802643:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802647:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80264b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80264f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802656:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80265a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80265e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802662:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802666:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80266a:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802676:	c9                   	leave
+  802677:	c3                   	ret
+
+0000000000802678 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802678:	55                   	push   %rbp
+  802679:	48 89 e5             	mov    %rsp,%rbp
+  80267c:	41 57                	push   %r15
+  80267e:	41 56                	push   %r14
+  802680:	41 55                	push   %r13
+  802682:	41 54                	push   %r12
+  802684:	53                   	push   %rbx
+  802685:	48 83 ec 18          	sub    $0x18,%rsp
+  802689:	49 89 fc             	mov    %rdi,%r12
+  80268c:	49 89 f5             	mov    %rsi,%r13
+  80268f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802693:	8b 45 10             	mov    0x10(%rbp),%eax
+  802696:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802699:	41 89 cf             	mov    %ecx,%r15d
+  80269c:	4c 39 fa             	cmp    %r15,%rdx
+  80269f:	73 5b                	jae    8026fc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8026a1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8026a5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8026a9:	85 db                	test   %ebx,%ebx
+  8026ab:	7e 0e                	jle    8026bb <print_num+0x43>
+            putch(padc, put_arg);
+  8026ad:	4c 89 ee             	mov    %r13,%rsi
+  8026b0:	44 89 f7             	mov    %r14d,%edi
+  8026b3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8026b6:	83 eb 01             	sub    $0x1,%ebx
+  8026b9:	75 f2                	jne    8026ad <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8026bb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8026bf:	48 b9 14 38 80 00 00 	movabs $0x803814,%rcx
+  8026c6:	00 00 00 
+  8026c9:	48 b8 03 38 80 00 00 	movabs $0x803803,%rax
+  8026d0:	00 00 00 
+  8026d3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8026d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e0:	49 f7 f7             	div    %r15
+  8026e3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8026e7:	4c 89 ee             	mov    %r13,%rsi
+  8026ea:	41 ff d4             	call   *%r12
+}
+  8026ed:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8026f1:	5b                   	pop    %rbx
+  8026f2:	41 5c                	pop    %r12
+  8026f4:	41 5d                	pop    %r13
+  8026f6:	41 5e                	pop    %r14
+  8026f8:	41 5f                	pop    %r15
+  8026fa:	5d                   	pop    %rbp
+  8026fb:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8026fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802700:	ba 00 00 00 00       	mov    $0x0,%edx
+  802705:	49 f7 f7             	div    %r15
+  802708:	48 83 ec 08          	sub    $0x8,%rsp
+  80270c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802710:	52                   	push   %rdx
+  802711:	45 0f be c9          	movsbl %r9b,%r9d
+  802715:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802719:	48 89 c2             	mov    %rax,%rdx
+  80271c:	48 b8 78 26 80 00 00 	movabs $0x802678,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+  802728:	48 83 c4 10          	add    $0x10,%rsp
+  80272c:	eb 8d                	jmp    8026bb <print_num+0x43>
+
+000000000080272e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80272e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802732:	48 8b 06             	mov    (%rsi),%rax
+  802735:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802739:	73 0a                	jae    802745 <sprintputch+0x17>
+        *state->start++ = ch;
+  80273b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80273f:	48 89 16             	mov    %rdx,(%rsi)
+  802742:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802745:	c3                   	ret
+
+0000000000802746 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	48 83 ec 50          	sub    $0x50,%rsp
+  80274e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802752:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802756:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80275a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802761:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802765:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802769:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80276d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802771:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802775:	48 b8 83 27 80 00 00 	movabs $0x802783,%rax
+  80277c:	00 00 00 
+  80277f:	ff d0                	call   *%rax
+}
+  802781:	c9                   	leave
+  802782:	c3                   	ret
+
+0000000000802783 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802783:	55                   	push   %rbp
+  802784:	48 89 e5             	mov    %rsp,%rbp
+  802787:	41 57                	push   %r15
+  802789:	41 56                	push   %r14
+  80278b:	41 55                	push   %r13
+  80278d:	41 54                	push   %r12
+  80278f:	53                   	push   %rbx
+  802790:	48 83 ec 38          	sub    $0x38,%rsp
+  802794:	49 89 fe             	mov    %rdi,%r14
+  802797:	49 89 f5             	mov    %rsi,%r13
+  80279a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80279d:	48 8b 01             	mov    (%rcx),%rax
+  8027a0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027a4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8027a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ac:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8027b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8027b4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8027b8:	0f b6 3b             	movzbl (%rbx),%edi
+  8027bb:	40 80 ff 25          	cmp    $0x25,%dil
+  8027bf:	74 18                	je     8027d9 <vprintfmt+0x56>
+            if (!ch) return;
+  8027c1:	40 84 ff             	test   %dil,%dil
+  8027c4:	0f 84 b1 06 00 00    	je     802e7b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8027ca:	40 0f b6 ff          	movzbl %dil,%edi
+  8027ce:	4c 89 ee             	mov    %r13,%rsi
+  8027d1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8027d4:	4c 89 e3             	mov    %r12,%rbx
+  8027d7:	eb db                	jmp    8027b4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8027d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027de:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8027e2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8027e7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027ed:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8027f4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8027f8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8027fd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802802:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802805:	83 e8 23             	sub    $0x23,%eax
+  802808:	3c 57                	cmp    $0x57,%al
+  80280a:	0f 87 51 06 00 00    	ja     802e61 <vprintfmt+0x6de>
+  802810:	0f b6 c0             	movzbl %al,%eax
+  802813:	48 b9 a0 39 80 00 00 	movabs $0x8039a0,%rcx
+  80281a:	00 00 00 
+  80281d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802820:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802823:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802827:	eb cf                	jmp    8027f8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802829:	49 89 dc             	mov    %rbx,%r12
+  80282c:	be 01 00 00 00       	mov    $0x1,%esi
+  802831:	eb c5                	jmp    8027f8 <vprintfmt+0x75>
+            padc = ch;
+  802833:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802837:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80283a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80283d:	eb b9                	jmp    8027f8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80283f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802842:	83 f8 2f             	cmp    $0x2f,%eax
+  802845:	77 24                	ja     80286b <vprintfmt+0xe8>
+  802847:	89 c1                	mov    %eax,%ecx
+  802849:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80284d:	83 c0 08             	add    $0x8,%eax
+  802850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802853:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802856:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802859:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80285d:	79 99                	jns    8027f8 <vprintfmt+0x75>
+                width = precision;
+  80285f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802863:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802869:	eb 8d                	jmp    8027f8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80286b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80286f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802877:	eb da                	jmp    802853 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802879:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80287e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802882:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802888:	3c 39                	cmp    $0x39,%al
+  80288a:	77 1c                	ja     8028a8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80288c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802890:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802894:	0f b6 c0             	movzbl %al,%eax
+  802897:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80289c:	0f b6 03             	movzbl (%rbx),%eax
+  80289f:	3c 39                	cmp    $0x39,%al
+  8028a1:	76 e9                	jbe    80288c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8028a3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8028a6:	eb b1                	jmp    802859 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8028a8:	49 89 dc             	mov    %rbx,%r12
+  8028ab:	eb ac                	jmp    802859 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8028ad:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8028b0:	85 c9                	test   %ecx,%ecx
+  8028b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b7:	0f 49 c1             	cmovns %ecx,%eax
+  8028ba:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8028bd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028c0:	e9 33 ff ff ff       	jmp    8027f8 <vprintfmt+0x75>
+            lflag++;
+  8028c5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8028c8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8028cb:	e9 28 ff ff ff       	jmp    8027f8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8028d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8028d6:	77 19                	ja     8028f1 <vprintfmt+0x16e>
+  8028d8:	89 c2                	mov    %eax,%edx
+  8028da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028de:	83 c0 08             	add    $0x8,%eax
+  8028e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028e4:	8b 3a                	mov    (%rdx),%edi
+  8028e6:	4c 89 ee             	mov    %r13,%rsi
+  8028e9:	41 ff d6             	call   *%r14
+            break;
+  8028ec:	e9 c3 fe ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8028f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028fd:	eb e5                	jmp    8028e4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8028ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802902:	83 f8 2f             	cmp    $0x2f,%eax
+  802905:	77 5a                	ja     802961 <vprintfmt+0x1de>
+  802907:	89 c2                	mov    %eax,%edx
+  802909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80290d:	83 c0 08             	add    $0x8,%eax
+  802910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802913:	8b 02                	mov    (%rdx),%eax
+  802915:	89 c1                	mov    %eax,%ecx
+  802917:	f7 d9                	neg    %ecx
+  802919:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80291c:	83 f9 14             	cmp    $0x14,%ecx
+  80291f:	7f 4e                	jg     80296f <vprintfmt+0x1ec>
+  802921:	48 63 c1             	movslq %ecx,%rax
+  802924:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  80292b:	00 00 00 
+  80292e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802932:	48 85 c0             	test   %rax,%rax
+  802935:	74 38                	je     80296f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802937:	48 89 c1             	mov    %rax,%rcx
+  80293a:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  802941:	00 00 00 
+  802944:	4c 89 ee             	mov    %r13,%rsi
+  802947:	4c 89 f7             	mov    %r14,%rdi
+  80294a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294f:	49 b8 46 27 80 00 00 	movabs $0x802746,%r8
+  802956:	00 00 00 
+  802959:	41 ff d0             	call   *%r8
+  80295c:	e9 53 fe ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802961:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802965:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802969:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80296d:	eb a4                	jmp    802913 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80296f:	48 ba 2c 38 80 00 00 	movabs $0x80382c,%rdx
+  802976:	00 00 00 
+  802979:	4c 89 ee             	mov    %r13,%rsi
+  80297c:	4c 89 f7             	mov    %r14,%rdi
+  80297f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802984:	49 b8 46 27 80 00 00 	movabs $0x802746,%r8
+  80298b:	00 00 00 
+  80298e:	41 ff d0             	call   *%r8
+  802991:	e9 1e fe ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802996:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802999:	83 f8 2f             	cmp    $0x2f,%eax
+  80299c:	77 6c                	ja     802a0a <vprintfmt+0x287>
+  80299e:	89 c2                	mov    %eax,%edx
+  8029a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029a4:	83 c0 08             	add    $0x8,%eax
+  8029a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029aa:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8029ad:	48 85 d2             	test   %rdx,%rdx
+  8029b0:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8029b7:	00 00 00 
+  8029ba:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029be:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8029c2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029c6:	7e 06                	jle    8029ce <vprintfmt+0x24b>
+  8029c8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8029cc:	75 4a                	jne    802a18 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029ce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8029d2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8029d6:	0f b6 00             	movzbl (%rax),%eax
+  8029d9:	84 c0                	test   %al,%al
+  8029db:	0f 85 9a 00 00 00    	jne    802a7b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8029e1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8029e4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	0f 8e c4 fd ff ff    	jle    8027b4 <vprintfmt+0x31>
+  8029f0:	4c 89 ee             	mov    %r13,%rsi
+  8029f3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8029f8:	41 ff d6             	call   *%r14
+  8029fb:	41 83 ec 01          	sub    $0x1,%r12d
+  8029ff:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a03:	75 eb                	jne    8029f0 <vprintfmt+0x26d>
+  802a05:	e9 aa fd ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a16:	eb 92                	jmp    8029aa <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802a18:	49 63 f7             	movslq %r15d,%rsi
+  802a1b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802a1f:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  802a26:	00 00 00 
+  802a29:	ff d0                	call   *%rax
+  802a2b:	48 89 c2             	mov    %rax,%rdx
+  802a2e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a31:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802a33:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802a36:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	7e 91                	jle    8029ce <vprintfmt+0x24b>
+  802a3d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802a42:	4c 89 ee             	mov    %r13,%rsi
+  802a45:	44 89 e7             	mov    %r12d,%edi
+  802a48:	41 ff d6             	call   *%r14
+  802a4b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802a52:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802a55:	75 eb                	jne    802a42 <vprintfmt+0x2bf>
+  802a57:	e9 72 ff ff ff       	jmp    8029ce <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a5c:	0f b6 f8             	movzbl %al,%edi
+  802a5f:	4c 89 ee             	mov    %r13,%rsi
+  802a62:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802a65:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802a69:	49 83 c4 01          	add    $0x1,%r12
+  802a6d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802a73:	84 c0                	test   %al,%al
+  802a75:	0f 84 66 ff ff ff    	je     8029e1 <vprintfmt+0x25e>
+  802a7b:	45 85 ff             	test   %r15d,%r15d
+  802a7e:	78 0a                	js     802a8a <vprintfmt+0x307>
+  802a80:	41 83 ef 01          	sub    $0x1,%r15d
+  802a84:	0f 88 57 ff ff ff    	js     8029e1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802a8a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802a8e:	74 cc                	je     802a5c <vprintfmt+0x2d9>
+  802a90:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802a93:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802a98:	80 fa 5e             	cmp    $0x5e,%dl
+  802a9b:	77 c2                	ja     802a5f <vprintfmt+0x2dc>
+  802a9d:	eb bd                	jmp    802a5c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802a9f:	40 84 f6             	test   %sil,%sil
+  802aa2:	75 26                	jne    802aca <vprintfmt+0x347>
+    switch (lflag) {
+  802aa4:	85 d2                	test   %edx,%edx
+  802aa6:	74 59                	je     802b01 <vprintfmt+0x37e>
+  802aa8:	83 fa 01             	cmp    $0x1,%edx
+  802aab:	74 7b                	je     802b28 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802aad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ab0:	83 f8 2f             	cmp    $0x2f,%eax
+  802ab3:	0f 87 96 00 00 00    	ja     802b4f <vprintfmt+0x3cc>
+  802ab9:	89 c2                	mov    %eax,%edx
+  802abb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802abf:	83 c0 08             	add    $0x8,%eax
+  802ac2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ac5:	4c 8b 22             	mov    (%rdx),%r12
+  802ac8:	eb 17                	jmp    802ae1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802acd:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad0:	77 21                	ja     802af3 <vprintfmt+0x370>
+  802ad2:	89 c2                	mov    %eax,%edx
+  802ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ad8:	83 c0 08             	add    $0x8,%eax
+  802adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ade:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802ae1:	4d 85 e4             	test   %r12,%r12
+  802ae4:	78 7a                	js     802b60 <vprintfmt+0x3dd>
+            num = i;
+  802ae6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802ae9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802aee:	e9 50 02 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802af3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802af7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802afb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aff:	eb dd                	jmp    802ade <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802b01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b04:	83 f8 2f             	cmp    $0x2f,%eax
+  802b07:	77 11                	ja     802b1a <vprintfmt+0x397>
+  802b09:	89 c2                	mov    %eax,%edx
+  802b0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b0f:	83 c0 08             	add    $0x8,%eax
+  802b12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b15:	4c 63 22             	movslq (%rdx),%r12
+  802b18:	eb c7                	jmp    802ae1 <vprintfmt+0x35e>
+  802b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b26:	eb ed                	jmp    802b15 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  802b2e:	77 11                	ja     802b41 <vprintfmt+0x3be>
+  802b30:	89 c2                	mov    %eax,%edx
+  802b32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b36:	83 c0 08             	add    $0x8,%eax
+  802b39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b3c:	4c 8b 22             	mov    (%rdx),%r12
+  802b3f:	eb a0                	jmp    802ae1 <vprintfmt+0x35e>
+  802b41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b4d:	eb ed                	jmp    802b3c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802b4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b5b:	e9 65 ff ff ff       	jmp    802ac5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802b60:	4c 89 ee             	mov    %r13,%rsi
+  802b63:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802b68:	41 ff d6             	call   *%r14
+                i = -i;
+  802b6b:	49 f7 dc             	neg    %r12
+  802b6e:	e9 73 ff ff ff       	jmp    802ae6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802b73:	40 84 f6             	test   %sil,%sil
+  802b76:	75 32                	jne    802baa <vprintfmt+0x427>
+    switch (lflag) {
+  802b78:	85 d2                	test   %edx,%edx
+  802b7a:	74 5d                	je     802bd9 <vprintfmt+0x456>
+  802b7c:	83 fa 01             	cmp    $0x1,%edx
+  802b7f:	0f 84 82 00 00 00    	je     802c07 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802b85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b88:	83 f8 2f             	cmp    $0x2f,%eax
+  802b8b:	0f 87 a5 00 00 00    	ja     802c36 <vprintfmt+0x4b3>
+  802b91:	89 c2                	mov    %eax,%edx
+  802b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b97:	83 c0 08             	add    $0x8,%eax
+  802b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b9d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802ba0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802ba5:	e9 99 01 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bad:	83 f8 2f             	cmp    $0x2f,%eax
+  802bb0:	77 19                	ja     802bcb <vprintfmt+0x448>
+  802bb2:	89 c2                	mov    %eax,%edx
+  802bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb8:	83 c0 08             	add    $0x8,%eax
+  802bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bbe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802bc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bc6:	e9 78 01 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+  802bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bd7:	eb e5                	jmp    802bbe <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  802bdf:	77 18                	ja     802bf9 <vprintfmt+0x476>
+  802be1:	89 c2                	mov    %eax,%edx
+  802be3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802be7:	83 c0 08             	add    $0x8,%eax
+  802bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bed:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802bef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802bf4:	e9 4a 01 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+  802bf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c05:	eb e6                	jmp    802bed <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  802c0d:	77 19                	ja     802c28 <vprintfmt+0x4a5>
+  802c0f:	89 c2                	mov    %eax,%edx
+  802c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c15:	83 c0 08             	add    $0x8,%eax
+  802c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c1b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802c1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802c23:	e9 1b 01 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+  802c28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c34:	eb e5                	jmp    802c1b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802c36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c42:	e9 56 ff ff ff       	jmp    802b9d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802c47:	40 84 f6             	test   %sil,%sil
+  802c4a:	75 2e                	jne    802c7a <vprintfmt+0x4f7>
+    switch (lflag) {
+  802c4c:	85 d2                	test   %edx,%edx
+  802c4e:	74 59                	je     802ca9 <vprintfmt+0x526>
+  802c50:	83 fa 01             	cmp    $0x1,%edx
+  802c53:	74 7f                	je     802cd4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802c55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c58:	83 f8 2f             	cmp    $0x2f,%eax
+  802c5b:	0f 87 9f 00 00 00    	ja     802d00 <vprintfmt+0x57d>
+  802c61:	89 c2                	mov    %eax,%edx
+  802c63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c67:	83 c0 08             	add    $0x8,%eax
+  802c6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c6d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c70:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802c75:	e9 c9 00 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c7d:	83 f8 2f             	cmp    $0x2f,%eax
+  802c80:	77 19                	ja     802c9b <vprintfmt+0x518>
+  802c82:	89 c2                	mov    %eax,%edx
+  802c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c88:	83 c0 08             	add    $0x8,%eax
+  802c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c91:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802c96:	e9 a8 00 00 00       	jmp    802d43 <vprintfmt+0x5c0>
+  802c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ca7:	eb e5                	jmp    802c8e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802ca9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cac:	83 f8 2f             	cmp    $0x2f,%eax
+  802caf:	77 15                	ja     802cc6 <vprintfmt+0x543>
+  802cb1:	89 c2                	mov    %eax,%edx
+  802cb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cb7:	83 c0 08             	add    $0x8,%eax
+  802cba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cbd:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802cbf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802cc4:	eb 7d                	jmp    802d43 <vprintfmt+0x5c0>
+  802cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cd2:	eb e9                	jmp    802cbd <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802cd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cd7:	83 f8 2f             	cmp    $0x2f,%eax
+  802cda:	77 16                	ja     802cf2 <vprintfmt+0x56f>
+  802cdc:	89 c2                	mov    %eax,%edx
+  802cde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ce2:	83 c0 08             	add    $0x8,%eax
+  802ce5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ce8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802ceb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802cf0:	eb 51                	jmp    802d43 <vprintfmt+0x5c0>
+  802cf2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cf6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cfe:	eb e8                	jmp    802ce8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802d00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d0c:	e9 5c ff ff ff       	jmp    802c6d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802d11:	4c 89 ee             	mov    %r13,%rsi
+  802d14:	bf 30 00 00 00       	mov    $0x30,%edi
+  802d19:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802d1c:	4c 89 ee             	mov    %r13,%rsi
+  802d1f:	bf 78 00 00 00       	mov    $0x78,%edi
+  802d24:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802d27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  802d2d:	77 47                	ja     802d76 <vprintfmt+0x5f3>
+  802d2f:	89 c2                	mov    %eax,%edx
+  802d31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d35:	83 c0 08             	add    $0x8,%eax
+  802d38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802d43:	48 83 ec 08          	sub    $0x8,%rsp
+  802d47:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802d4b:	0f 94 c0             	sete   %al
+  802d4e:	0f b6 c0             	movzbl %al,%eax
+  802d51:	50                   	push   %rax
+  802d52:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802d57:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802d5b:	4c 89 ee             	mov    %r13,%rsi
+  802d5e:	4c 89 f7             	mov    %r14,%rdi
+  802d61:	48 b8 78 26 80 00 00 	movabs $0x802678,%rax
+  802d68:	00 00 00 
+  802d6b:	ff d0                	call   *%rax
+            break;
+  802d6d:	48 83 c4 10          	add    $0x10,%rsp
+  802d71:	e9 3e fa ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802d76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d82:	eb b7                	jmp    802d3b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802d84:	40 84 f6             	test   %sil,%sil
+  802d87:	75 2b                	jne    802db4 <vprintfmt+0x631>
+    switch (lflag) {
+  802d89:	85 d2                	test   %edx,%edx
+  802d8b:	74 56                	je     802de3 <vprintfmt+0x660>
+  802d8d:	83 fa 01             	cmp    $0x1,%edx
+  802d90:	74 7f                	je     802e11 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802d92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d95:	83 f8 2f             	cmp    $0x2f,%eax
+  802d98:	0f 87 a2 00 00 00    	ja     802e40 <vprintfmt+0x6bd>
+  802d9e:	89 c2                	mov    %eax,%edx
+  802da0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802da4:	83 c0 08             	add    $0x8,%eax
+  802da7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802daa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802db2:	eb 8f                	jmp    802d43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802db4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802db7:	83 f8 2f             	cmp    $0x2f,%eax
+  802dba:	77 19                	ja     802dd5 <vprintfmt+0x652>
+  802dbc:	89 c2                	mov    %eax,%edx
+  802dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dc2:	83 c0 08             	add    $0x8,%eax
+  802dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802dc8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802dcb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802dd0:	e9 6e ff ff ff       	jmp    802d43 <vprintfmt+0x5c0>
+  802dd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ddd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802de1:	eb e5                	jmp    802dc8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802de3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802de6:	83 f8 2f             	cmp    $0x2f,%eax
+  802de9:	77 18                	ja     802e03 <vprintfmt+0x680>
+  802deb:	89 c2                	mov    %eax,%edx
+  802ded:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802df1:	83 c0 08             	add    $0x8,%eax
+  802df4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802df7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802df9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802dfe:	e9 40 ff ff ff       	jmp    802d43 <vprintfmt+0x5c0>
+  802e03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e0f:	eb e6                	jmp    802df7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802e11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e14:	83 f8 2f             	cmp    $0x2f,%eax
+  802e17:	77 19                	ja     802e32 <vprintfmt+0x6af>
+  802e19:	89 c2                	mov    %eax,%edx
+  802e1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e1f:	83 c0 08             	add    $0x8,%eax
+  802e22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802e28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802e2d:	e9 11 ff ff ff       	jmp    802d43 <vprintfmt+0x5c0>
+  802e32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e3e:	eb e5                	jmp    802e25 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802e40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e4c:	e9 59 ff ff ff       	jmp    802daa <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802e51:	4c 89 ee             	mov    %r13,%rsi
+  802e54:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e59:	41 ff d6             	call   *%r14
+            break;
+  802e5c:	e9 53 f9 ff ff       	jmp    8027b4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802e61:	4c 89 ee             	mov    %r13,%rsi
+  802e64:	bf 25 00 00 00       	mov    $0x25,%edi
+  802e69:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802e6c:	48 83 eb 01          	sub    $0x1,%rbx
+  802e70:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802e74:	75 f6                	jne    802e6c <vprintfmt+0x6e9>
+  802e76:	e9 39 f9 ff ff       	jmp    8027b4 <vprintfmt+0x31>
+}
+  802e7b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802e7f:	5b                   	pop    %rbx
+  802e80:	41 5c                	pop    %r12
+  802e82:	41 5d                	pop    %r13
+  802e84:	41 5e                	pop    %r14
+  802e86:	41 5f                	pop    %r15
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+
+0000000000802e8a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802e8a:	55                   	push   %rbp
+  802e8b:	48 89 e5             	mov    %rsp,%rbp
+  802e8e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802e92:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e96:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802e9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802e9f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ea6:	48 85 ff             	test   %rdi,%rdi
+  802ea9:	74 2b                	je     802ed6 <vsnprintf+0x4c>
+  802eab:	48 85 f6             	test   %rsi,%rsi
+  802eae:	74 26                	je     802ed6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802eb0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802eb4:	48 bf 2e 27 80 00 00 	movabs $0x80272e,%rdi
+  802ebb:	00 00 00 
+  802ebe:	48 b8 83 27 80 00 00 	movabs $0x802783,%rax
+  802ec5:	00 00 00 
+  802ec8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802eca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ece:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802ed1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802ed4:	c9                   	leave
+  802ed5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802ed6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802edb:	eb f7                	jmp    802ed4 <vsnprintf+0x4a>
+
+0000000000802edd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802edd:	55                   	push   %rbp
+  802ede:	48 89 e5             	mov    %rsp,%rbp
+  802ee1:	48 83 ec 50          	sub    $0x50,%rsp
+  802ee5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ee9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802eed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ef1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802ef8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f00:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802f04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802f08:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802f0c:	48 b8 8a 2e 80 00 00 	movabs $0x802e8a,%rax
+  802f13:	00 00 00 
+  802f16:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802f18:	c9                   	leave
+  802f19:	c3                   	ret
+
+0000000000802f1a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802f1a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802f1d:	74 10                	je     802f2f <strlen+0x15>
+    size_t n = 0;
+  802f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802f24:	48 83 c0 01          	add    $0x1,%rax
+  802f28:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802f2c:	75 f6                	jne    802f24 <strlen+0xa>
+  802f2e:	c3                   	ret
+    size_t n = 0;
+  802f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802f34:	c3                   	ret
+
+0000000000802f35 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802f35:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802f38:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802f3d:	48 85 f6             	test   %rsi,%rsi
+  802f40:	74 11                	je     802f53 <strnlen+0x1e>
+  802f42:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802f46:	74 0c                	je     802f54 <strnlen+0x1f>
+  802f48:	48 83 c2 01          	add    $0x1,%rdx
+  802f4c:	48 39 d0             	cmp    %rdx,%rax
+  802f4f:	75 f1                	jne    802f42 <strnlen+0xd>
+  802f51:	eb 04                	jmp    802f57 <strnlen+0x22>
+  802f53:	c3                   	ret
+  802f54:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802f57:	c3                   	ret
+
+0000000000802f58 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802f58:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f60:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802f64:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802f67:	48 83 c2 01          	add    $0x1,%rdx
+  802f6b:	84 c9                	test   %cl,%cl
+  802f6d:	75 f1                	jne    802f60 <strcpy+0x8>
+        ;
+    return res;
+}
+  802f6f:	c3                   	ret
+
+0000000000802f70 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802f70:	55                   	push   %rbp
+  802f71:	48 89 e5             	mov    %rsp,%rbp
+  802f74:	41 54                	push   %r12
+  802f76:	53                   	push   %rbx
+  802f77:	48 89 fb             	mov    %rdi,%rbx
+  802f7a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802f7d:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  802f84:	00 00 00 
+  802f87:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802f89:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802f8d:	4c 89 e6             	mov    %r12,%rsi
+  802f90:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  802f97:	00 00 00 
+  802f9a:	ff d0                	call   *%rax
+    return dst;
+}
+  802f9c:	48 89 d8             	mov    %rbx,%rax
+  802f9f:	5b                   	pop    %rbx
+  802fa0:	41 5c                	pop    %r12
+  802fa2:	5d                   	pop    %rbp
+  802fa3:	c3                   	ret
+
+0000000000802fa4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802fa4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802fa7:	48 85 d2             	test   %rdx,%rdx
+  802faa:	74 1f                	je     802fcb <strncpy+0x27>
+  802fac:	48 01 fa             	add    %rdi,%rdx
+  802faf:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802fb2:	48 83 c1 01          	add    $0x1,%rcx
+  802fb6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802fba:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802fbe:	41 80 f8 01          	cmp    $0x1,%r8b
+  802fc2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802fc6:	48 39 ca             	cmp    %rcx,%rdx
+  802fc9:	75 e7                	jne    802fb2 <strncpy+0xe>
+    }
+    return ret;
+}
+  802fcb:	c3                   	ret
+
+0000000000802fcc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802fcc:	48 89 f8             	mov    %rdi,%rax
+  802fcf:	48 85 d2             	test   %rdx,%rdx
+  802fd2:	74 24                	je     802ff8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802fd4:	48 83 ea 01          	sub    $0x1,%rdx
+  802fd8:	74 1b                	je     802ff5 <strlcpy+0x29>
+  802fda:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802fde:	0f b6 16             	movzbl (%rsi),%edx
+  802fe1:	84 d2                	test   %dl,%dl
+  802fe3:	74 10                	je     802ff5 <strlcpy+0x29>
+            *dst++ = *src++;
+  802fe5:	48 83 c6 01          	add    $0x1,%rsi
+  802fe9:	48 83 c0 01          	add    $0x1,%rax
+  802fed:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802ff0:	48 39 c8             	cmp    %rcx,%rax
+  802ff3:	75 e9                	jne    802fde <strlcpy+0x12>
+        *dst = '\0';
+  802ff5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802ff8:	48 29 f8             	sub    %rdi,%rax
+}
+  802ffb:	c3                   	ret
+
+0000000000802ffc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802ffc:	0f b6 07             	movzbl (%rdi),%eax
+  802fff:	84 c0                	test   %al,%al
+  803001:	74 13                	je     803016 <strcmp+0x1a>
+  803003:	38 06                	cmp    %al,(%rsi)
+  803005:	75 0f                	jne    803016 <strcmp+0x1a>
+  803007:	48 83 c7 01          	add    $0x1,%rdi
+  80300b:	48 83 c6 01          	add    $0x1,%rsi
+  80300f:	0f b6 07             	movzbl (%rdi),%eax
+  803012:	84 c0                	test   %al,%al
+  803014:	75 ed                	jne    803003 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803016:	0f b6 c0             	movzbl %al,%eax
+  803019:	0f b6 16             	movzbl (%rsi),%edx
+  80301c:	29 d0                	sub    %edx,%eax
+}
+  80301e:	c3                   	ret
+
+000000000080301f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80301f:	48 85 d2             	test   %rdx,%rdx
+  803022:	74 1f                	je     803043 <strncmp+0x24>
+  803024:	0f b6 07             	movzbl (%rdi),%eax
+  803027:	84 c0                	test   %al,%al
+  803029:	74 1e                	je     803049 <strncmp+0x2a>
+  80302b:	3a 06                	cmp    (%rsi),%al
+  80302d:	75 1a                	jne    803049 <strncmp+0x2a>
+  80302f:	48 83 c7 01          	add    $0x1,%rdi
+  803033:	48 83 c6 01          	add    $0x1,%rsi
+  803037:	48 83 ea 01          	sub    $0x1,%rdx
+  80303b:	75 e7                	jne    803024 <strncmp+0x5>
+
+    if (!n) return 0;
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803042:	c3                   	ret
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	c3                   	ret
+  803049:	48 85 d2             	test   %rdx,%rdx
+  80304c:	74 09                	je     803057 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80304e:	0f b6 07             	movzbl (%rdi),%eax
+  803051:	0f b6 16             	movzbl (%rsi),%edx
+  803054:	29 d0                	sub    %edx,%eax
+  803056:	c3                   	ret
+    if (!n) return 0;
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80305c:	c3                   	ret
+
+000000000080305d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80305d:	0f b6 17             	movzbl (%rdi),%edx
+  803060:	84 d2                	test   %dl,%dl
+  803062:	74 18                	je     80307c <strchr+0x1f>
+        if (*str == c) {
+  803064:	0f be d2             	movsbl %dl,%edx
+  803067:	39 f2                	cmp    %esi,%edx
+  803069:	74 17                	je     803082 <strchr+0x25>
+    for (; *str; str++) {
+  80306b:	48 83 c7 01          	add    $0x1,%rdi
+  80306f:	0f b6 17             	movzbl (%rdi),%edx
+  803072:	84 d2                	test   %dl,%dl
+  803074:	75 ee                	jne    803064 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307b:	c3                   	ret
+  80307c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803081:	c3                   	ret
+  803082:	48 89 f8             	mov    %rdi,%rax
+}
+  803085:	c3                   	ret
+
+0000000000803086 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803086:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803089:	0f b6 17             	movzbl (%rdi),%edx
+  80308c:	84 d2                	test   %dl,%dl
+  80308e:	74 13                	je     8030a3 <strfind+0x1d>
+  803090:	0f be d2             	movsbl %dl,%edx
+  803093:	39 f2                	cmp    %esi,%edx
+  803095:	74 0b                	je     8030a2 <strfind+0x1c>
+  803097:	48 83 c0 01          	add    $0x1,%rax
+  80309b:	0f b6 10             	movzbl (%rax),%edx
+  80309e:	84 d2                	test   %dl,%dl
+  8030a0:	75 ee                	jne    803090 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8030a2:	c3                   	ret
+  8030a3:	c3                   	ret
+
+00000000008030a4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8030a4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8030a7:	48 89 f8             	mov    %rdi,%rax
+  8030aa:	48 f7 d8             	neg    %rax
+  8030ad:	83 e0 07             	and    $0x7,%eax
+  8030b0:	49 89 d1             	mov    %rdx,%r9
+  8030b3:	49 29 c1             	sub    %rax,%r9
+  8030b6:	78 36                	js     8030ee <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8030b8:	40 0f b6 c6          	movzbl %sil,%eax
+  8030bc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8030c3:	01 01 01 
+  8030c6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8030ca:	40 f6 c7 07          	test   $0x7,%dil
+  8030ce:	75 38                	jne    803108 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8030d0:	4c 89 c9             	mov    %r9,%rcx
+  8030d3:	48 c1 f9 03          	sar    $0x3,%rcx
+  8030d7:	74 0c                	je     8030e5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8030d9:	fc                   	cld
+  8030da:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8030dd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8030e1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8030e5:	4d 85 c9             	test   %r9,%r9
+  8030e8:	75 45                	jne    80312f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8030ea:	4c 89 c0             	mov    %r8,%rax
+  8030ed:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8030ee:	48 85 d2             	test   %rdx,%rdx
+  8030f1:	74 f7                	je     8030ea <memset+0x46>
+  8030f3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8030f6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8030f9:	48 83 c0 01          	add    $0x1,%rax
+  8030fd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803101:	48 39 c2             	cmp    %rax,%rdx
+  803104:	75 f3                	jne    8030f9 <memset+0x55>
+  803106:	eb e2                	jmp    8030ea <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803108:	40 f6 c7 01          	test   $0x1,%dil
+  80310c:	74 06                	je     803114 <memset+0x70>
+  80310e:	88 07                	mov    %al,(%rdi)
+  803110:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803114:	40 f6 c7 02          	test   $0x2,%dil
+  803118:	74 07                	je     803121 <memset+0x7d>
+  80311a:	66 89 07             	mov    %ax,(%rdi)
+  80311d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803121:	40 f6 c7 04          	test   $0x4,%dil
+  803125:	74 a9                	je     8030d0 <memset+0x2c>
+  803127:	89 07                	mov    %eax,(%rdi)
+  803129:	48 83 c7 04          	add    $0x4,%rdi
+  80312d:	eb a1                	jmp    8030d0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80312f:	41 f6 c1 04          	test   $0x4,%r9b
+  803133:	74 06                	je     80313b <memset+0x97>
+  803135:	89 07                	mov    %eax,(%rdi)
+  803137:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80313b:	41 f6 c1 02          	test   $0x2,%r9b
+  80313f:	74 07                	je     803148 <memset+0xa4>
+  803141:	66 89 07             	mov    %ax,(%rdi)
+  803144:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803148:	41 f6 c1 01          	test   $0x1,%r9b
+  80314c:	74 9c                	je     8030ea <memset+0x46>
+  80314e:	88 07                	mov    %al,(%rdi)
+  803150:	eb 98                	jmp    8030ea <memset+0x46>
+
+0000000000803152 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803152:	48 89 f8             	mov    %rdi,%rax
+  803155:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803158:	48 39 fe             	cmp    %rdi,%rsi
+  80315b:	73 3b                	jae    803198 <memmove+0x46>
+  80315d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803161:	48 39 d7             	cmp    %rdx,%rdi
+  803164:	73 32                	jae    803198 <memmove+0x46>
+        s += n;
+        d += n;
+  803166:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80316a:	48 89 d6             	mov    %rdx,%rsi
+  80316d:	48 09 fe             	or     %rdi,%rsi
+  803170:	48 09 ce             	or     %rcx,%rsi
+  803173:	40 f6 c6 07          	test   $0x7,%sil
+  803177:	75 12                	jne    80318b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803179:	48 83 ef 08          	sub    $0x8,%rdi
+  80317d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803181:	48 c1 e9 03          	shr    $0x3,%rcx
+  803185:	fd                   	std
+  803186:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803189:	fc                   	cld
+  80318a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80318b:	48 83 ef 01          	sub    $0x1,%rdi
+  80318f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803193:	fd                   	std
+  803194:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803196:	eb f1                	jmp    803189 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803198:	48 89 f2             	mov    %rsi,%rdx
+  80319b:	48 09 c2             	or     %rax,%rdx
+  80319e:	48 09 ca             	or     %rcx,%rdx
+  8031a1:	f6 c2 07             	test   $0x7,%dl
+  8031a4:	75 0c                	jne    8031b2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8031a6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8031aa:	48 89 c7             	mov    %rax,%rdi
+  8031ad:	fc                   	cld
+  8031ae:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8031b1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8031b2:	48 89 c7             	mov    %rax,%rdi
+  8031b5:	fc                   	cld
+  8031b6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8031b8:	c3                   	ret
+
+00000000008031b9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8031b9:	55                   	push   %rbp
+  8031ba:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8031bd:	48 b8 52 31 80 00 00 	movabs $0x803152,%rax
+  8031c4:	00 00 00 
+  8031c7:	ff d0                	call   *%rax
+}
+  8031c9:	5d                   	pop    %rbp
+  8031ca:	c3                   	ret
+
+00000000008031cb <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	41 57                	push   %r15
+  8031d1:	41 56                	push   %r14
+  8031d3:	41 55                	push   %r13
+  8031d5:	41 54                	push   %r12
+  8031d7:	53                   	push   %rbx
+  8031d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8031dc:	49 89 fe             	mov    %rdi,%r14
+  8031df:	49 89 f7             	mov    %rsi,%r15
+  8031e2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8031e5:	48 89 f7             	mov    %rsi,%rdi
+  8031e8:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+  8031f4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8031f7:	48 89 de             	mov    %rbx,%rsi
+  8031fa:	4c 89 f7             	mov    %r14,%rdi
+  8031fd:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  803204:	00 00 00 
+  803207:	ff d0                	call   *%rax
+  803209:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80320c:	48 39 c3             	cmp    %rax,%rbx
+  80320f:	74 36                	je     803247 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803211:	48 89 d8             	mov    %rbx,%rax
+  803214:	4c 29 e8             	sub    %r13,%rax
+  803217:	49 39 c4             	cmp    %rax,%r12
+  80321a:	73 31                	jae    80324d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80321c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803221:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803225:	4c 89 fe             	mov    %r15,%rsi
+  803228:	48 b8 b9 31 80 00 00 	movabs $0x8031b9,%rax
+  80322f:	00 00 00 
+  803232:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803234:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803238:	48 83 c4 08          	add    $0x8,%rsp
+  80323c:	5b                   	pop    %rbx
+  80323d:	41 5c                	pop    %r12
+  80323f:	41 5d                	pop    %r13
+  803241:	41 5e                	pop    %r14
+  803243:	41 5f                	pop    %r15
+  803245:	5d                   	pop    %rbp
+  803246:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803247:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80324b:	eb eb                	jmp    803238 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80324d:	48 83 eb 01          	sub    $0x1,%rbx
+  803251:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803255:	48 89 da             	mov    %rbx,%rdx
+  803258:	4c 89 fe             	mov    %r15,%rsi
+  80325b:	48 b8 b9 31 80 00 00 	movabs $0x8031b9,%rax
+  803262:	00 00 00 
+  803265:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803267:	49 01 de             	add    %rbx,%r14
+  80326a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80326f:	eb c3                	jmp    803234 <strlcat+0x69>
+
+0000000000803271 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803271:	48 85 d2             	test   %rdx,%rdx
+  803274:	74 2d                	je     8032a3 <memcmp+0x32>
+  803276:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80327b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80327f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803284:	44 38 c1             	cmp    %r8b,%cl
+  803287:	75 0f                	jne    803298 <memcmp+0x27>
+    while (n-- > 0) {
+  803289:	48 83 c0 01          	add    $0x1,%rax
+  80328d:	48 39 c2             	cmp    %rax,%rdx
+  803290:	75 e9                	jne    80327b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803292:	b8 00 00 00 00       	mov    $0x0,%eax
+  803297:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803298:	0f b6 c1             	movzbl %cl,%eax
+  80329b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80329f:	44 29 c0             	sub    %r8d,%eax
+  8032a2:	c3                   	ret
+    return 0;
+  8032a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a8:	c3                   	ret
+
+00000000008032a9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8032a9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8032ad:	48 39 c7             	cmp    %rax,%rdi
+  8032b0:	73 0f                	jae    8032c1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8032b2:	40 38 37             	cmp    %sil,(%rdi)
+  8032b5:	74 0e                	je     8032c5 <memfind+0x1c>
+    for (; src < end; src++) {
+  8032b7:	48 83 c7 01          	add    $0x1,%rdi
+  8032bb:	48 39 f8             	cmp    %rdi,%rax
+  8032be:	75 f2                	jne    8032b2 <memfind+0x9>
+  8032c0:	c3                   	ret
+  8032c1:	48 89 f8             	mov    %rdi,%rax
+  8032c4:	c3                   	ret
+  8032c5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8032c8:	c3                   	ret
+
+00000000008032c9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8032c9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8032cc:	0f b6 37             	movzbl (%rdi),%esi
+  8032cf:	40 80 fe 20          	cmp    $0x20,%sil
+  8032d3:	74 06                	je     8032db <strtol+0x12>
+  8032d5:	40 80 fe 09          	cmp    $0x9,%sil
+  8032d9:	75 13                	jne    8032ee <strtol+0x25>
+  8032db:	48 83 c7 01          	add    $0x1,%rdi
+  8032df:	0f b6 37             	movzbl (%rdi),%esi
+  8032e2:	40 80 fe 20          	cmp    $0x20,%sil
+  8032e6:	74 f3                	je     8032db <strtol+0x12>
+  8032e8:	40 80 fe 09          	cmp    $0x9,%sil
+  8032ec:	74 ed                	je     8032db <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8032ee:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8032f1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032f4:	3c 01                	cmp    $0x1,%al
+  8032f6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8032fa:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803300:	75 0f                	jne    803311 <strtol+0x48>
+  803302:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803305:	74 14                	je     80331b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803307:	85 d2                	test   %edx,%edx
+  803309:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80330e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803311:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803316:	4c 63 ca             	movslq %edx,%r9
+  803319:	eb 36                	jmp    803351 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80331b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80331f:	74 0f                	je     803330 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803321:	85 d2                	test   %edx,%edx
+  803323:	75 ec                	jne    803311 <strtol+0x48>
+        s++;
+  803325:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803329:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80332e:	eb e1                	jmp    803311 <strtol+0x48>
+        s += 2;
+  803330:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803334:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803339:	eb d6                	jmp    803311 <strtol+0x48>
+            dig -= '0';
+  80333b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80333e:	44 0f b6 c1          	movzbl %cl,%r8d
+  803342:	41 39 d0             	cmp    %edx,%r8d
+  803345:	7d 21                	jge    803368 <strtol+0x9f>
+        val = val * base + dig;
+  803347:	49 0f af c1          	imul   %r9,%rax
+  80334b:	0f b6 c9             	movzbl %cl,%ecx
+  80334e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803351:	48 83 c7 01          	add    $0x1,%rdi
+  803355:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803359:	80 f9 39             	cmp    $0x39,%cl
+  80335c:	76 dd                	jbe    80333b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80335e:	80 f9 7b             	cmp    $0x7b,%cl
+  803361:	77 05                	ja     803368 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803363:	83 e9 57             	sub    $0x57,%ecx
+  803366:	eb d6                	jmp    80333e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803368:	4d 85 d2             	test   %r10,%r10
+  80336b:	74 03                	je     803370 <strtol+0xa7>
+  80336d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803370:	48 89 c2             	mov    %rax,%rdx
+  803373:	48 f7 da             	neg    %rdx
+  803376:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80337a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80337e:	c3                   	ret
+
+000000000080337f <strrev>:
+
+void
+strrev(char *str)
+{
+  80337f:	55                   	push   %rbp
+  803380:	48 89 e5             	mov    %rsp,%rbp
+  803383:	53                   	push   %rbx
+  803384:	48 83 ec 08          	sub    $0x8,%rsp
+  803388:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80338b:	48 b8 1a 2f 80 00 00 	movabs $0x802f1a,%rax
+  803392:	00 00 00 
+  803395:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  803397:	83 e8 01             	sub    $0x1,%eax
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	7e 22                	jle    8033c0 <strrev+0x41>
+  80339e:	48 98                	cltq
+  8033a0:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8033a5:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8033a9:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8033ad:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8033b1:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8033b4:	48 83 c2 01          	add    $0x1,%rdx
+  8033b8:	48 83 e8 01          	sub    $0x1,%rax
+  8033bc:	39 c2                	cmp    %eax,%edx
+  8033be:	7c e5                	jl     8033a5 <strrev+0x26>
+	}
+}
+  8033c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c4:	c9                   	leave
+  8033c5:	c3                   	ret
+
+00000000008033c6 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8033c6:	85 d2                	test   %edx,%edx
+  8033c8:	0f 84 80 00 00 00    	je     80344e <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+  8033d2:	53                   	push   %rbx
+  8033d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8033d7:	49 89 f2             	mov    %rsi,%r10
+  8033da:	41 89 d3             	mov    %edx,%r11d
+  8033dd:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8033e0:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8033e5:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8033e8:	eb 20                	jmp    80340a <itoa+0x44>
+			str[i++] = '0' + digit;
+  8033ea:	41 89 f1             	mov    %esi,%r9d
+  8033ed:	83 c2 30             	add    $0x30,%edx
+  8033f0:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8033f3:	89 f8                	mov    %edi,%eax
+  8033f5:	99                   	cltd
+  8033f6:	f7 f9                	idiv   %ecx
+  8033f8:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8033fa:	85 c0                	test   %eax,%eax
+  8033fc:	74 2e                	je     80342c <itoa+0x66>
+  8033fe:	83 c6 01             	add    $0x1,%esi
+  803401:	49 83 c0 01          	add    $0x1,%r8
+  803405:	44 39 cb             	cmp    %r9d,%ebx
+  803408:	7e 15                	jle    80341f <itoa+0x59>
+		digit = sum % base;
+  80340a:	89 f8                	mov    %edi,%eax
+  80340c:	99                   	cltd
+  80340d:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80340f:	83 fa 09             	cmp    $0x9,%edx
+  803412:	7e d6                	jle    8033ea <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  803414:	41 89 f1             	mov    %esi,%r9d
+  803417:	83 c2 37             	add    $0x37,%edx
+  80341a:	41 88 10             	mov    %dl,(%r8)
+  80341d:	eb d4                	jmp    8033f3 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80341f:	41 83 eb 01          	sub    $0x1,%r11d
+  803423:	45 39 cb             	cmp    %r9d,%r11d
+  803426:	75 04                	jne    80342c <itoa+0x66>
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	75 28                	jne    803454 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80342c:	4d 63 c9             	movslq %r9d,%r9
+  80342f:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  803434:	4c 89 d7             	mov    %r10,%rdi
+  803437:	48 b8 7f 33 80 00 00 	movabs $0x80337f,%rax
+  80343e:	00 00 00 
+  803441:	ff d0                	call   *%rax
+	return 0;
+  803443:	b8 00 00 00 00       	mov    $0x0,%eax
+  803448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+		return -1;
+  80344e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803453:	c3                   	ret
+		return -1;
+  803454:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803459:	eb ed                	jmp    803448 <itoa+0x82>
+
+000000000080345b <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	41 55                	push   %r13
+  803461:	41 54                	push   %r12
+  803463:	53                   	push   %rbx
+  803464:	48 83 ec 08          	sub    $0x8,%rsp
+  803468:	49 89 fc             	mov    %rdi,%r12
+  80346b:	48 89 f7             	mov    %rsi,%rdi
+  80346e:	48 89 d3             	mov    %rdx,%rbx
+  803471:	49 89 cd             	mov    %rcx,%r13
+  803474:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803477:	48 85 f6             	test   %rsi,%rsi
+  80347a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803481:	00 00 00 
+  803484:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803488:	be 00 10 00 00       	mov    $0x1000,%esi
+  80348d:	48 85 db             	test   %rbx,%rbx
+  803490:	74 03                	je     803495 <ipc_recv_timed+0x3a>
+  803492:	48 8b 33             	mov    (%rbx),%rsi
+  803495:	48 b8 1c 05 80 00 00 	movabs $0x80051c,%rax
+  80349c:	00 00 00 
+  80349f:	ff d0                	call   *%rax
+    if (res < 0) {
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	78 75                	js     80351a <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8034a5:	4d 85 e4             	test   %r12,%r12
+  8034a8:	74 14                	je     8034be <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8034aa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034b1:	00 00 00 
+  8034b4:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8034ba:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8034be:	4d 85 ed             	test   %r13,%r13
+  8034c1:	74 14                	je     8034d7 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8034c3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034ca:	00 00 00 
+  8034cd:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8034d3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8034d7:	48 85 db             	test   %rbx,%rbx
+  8034da:	74 23                	je     8034ff <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8034dc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8034e3:	00 00 00 
+  8034e6:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8034ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f1:	85 c9                	test   %ecx,%ecx
+  8034f3:	74 07                	je     8034fc <ipc_recv_timed+0xa1>
+  8034f5:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8034fc:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8034ff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803506:	00 00 00 
+  803509:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80350f:	48 83 c4 08          	add    $0x8,%rsp
+  803513:	5b                   	pop    %rbx
+  803514:	41 5c                	pop    %r12
+  803516:	41 5d                	pop    %r13
+  803518:	5d                   	pop    %rbp
+  803519:	c3                   	ret
+        if (from_env_store != NULL) {
+  80351a:	4d 85 e4             	test   %r12,%r12
+  80351d:	74 08                	je     803527 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80351f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803526:	00 
+        if (perm_store != NULL) {
+  803527:	4d 85 ed             	test   %r13,%r13
+  80352a:	74 08                	je     803534 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80352c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803533:	00 
+        if (size != NULL) {
+  803534:	48 85 db             	test   %rbx,%rbx
+  803537:	74 d6                	je     80350f <ipc_recv_timed+0xb4>
+            *size = 0;
+  803539:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803540:	eb cd                	jmp    80350f <ipc_recv_timed+0xb4>
+
+0000000000803542 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803542:	55                   	push   %rbp
+  803543:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803546:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80354c:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+}
+  803558:	5d                   	pop    %rbp
+  803559:	c3                   	ret
+
+000000000080355a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80355a:	55                   	push   %rbp
+  80355b:	48 89 e5             	mov    %rsp,%rbp
+  80355e:	41 57                	push   %r15
+  803560:	41 56                	push   %r14
+  803562:	41 55                	push   %r13
+  803564:	41 54                	push   %r12
+  803566:	53                   	push   %rbx
+  803567:	48 83 ec 18          	sub    $0x18,%rsp
+  80356b:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80356e:	48 89 d3             	mov    %rdx,%rbx
+  803571:	49 89 cc             	mov    %rcx,%r12
+  803574:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803577:	48 85 d2             	test   %rdx,%rdx
+  80357a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803581:	00 00 00 
+  803584:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803588:	89 f0                	mov    %esi,%eax
+  80358a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80358e:	48 89 da             	mov    %rbx,%rdx
+  803591:	48 89 c6             	mov    %rax,%rsi
+  803594:	48 b8 f0 04 80 00 00 	movabs $0x8004f0,%rax
+  80359b:	00 00 00 
+  80359e:	ff d0                	call   *%rax
+    while (res < 0) {
+  8035a0:	85 c0                	test   %eax,%eax
+  8035a2:	79 65                	jns    803609 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035a4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035a7:	75 33                	jne    8035dc <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8035a9:	49 bf f3 01 80 00 00 	movabs $0x8001f3,%r15
+  8035b0:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035b3:	49 be f0 04 80 00 00 	movabs $0x8004f0,%r14
+  8035ba:	00 00 00 
+        sys_yield();
+  8035bd:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8035c0:	45 89 e8             	mov    %r13d,%r8d
+  8035c3:	4c 89 e1             	mov    %r12,%rcx
+  8035c6:	48 89 da             	mov    %rbx,%rdx
+  8035c9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8035cd:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8035d0:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	79 32                	jns    803609 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8035d7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8035da:	74 e1                	je     8035bd <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8035dc:	89 c1                	mov    %eax,%ecx
+  8035de:	48 ba 27 3d 80 00 00 	movabs $0x803d27,%rdx
+  8035e5:	00 00 00 
+  8035e8:	be 52 00 00 00       	mov    $0x52,%esi
+  8035ed:	48 bf 3b 3d 80 00 00 	movabs $0x803d3b,%rdi
+  8035f4:	00 00 00 
+  8035f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035fc:	49 b8 e3 24 80 00 00 	movabs $0x8024e3,%r8
+  803603:	00 00 00 
+  803606:	41 ff d0             	call   *%r8
+    }
+}
+  803609:	48 83 c4 18          	add    $0x18,%rsp
+  80360d:	5b                   	pop    %rbx
+  80360e:	41 5c                	pop    %r12
+  803610:	41 5d                	pop    %r13
+  803612:	41 5e                	pop    %r14
+  803614:	41 5f                	pop    %r15
+  803616:	5d                   	pop    %rbp
+  803617:	c3                   	ret
+
+0000000000803618 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803618:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80361d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803624:	00 00 00 
+  803627:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80362b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80362f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803633:	48 01 ca             	add    %rcx,%rdx
+  803636:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80363c:	39 fa                	cmp    %edi,%edx
+  80363e:	74 12                	je     803652 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803640:	48 83 c0 01          	add    $0x1,%rax
+  803644:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80364a:	75 db                	jne    803627 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80364c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803651:	c3                   	ret
+            return envs[i].env_id;
+  803652:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803656:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80365a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80365e:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803665:	00 00 00 
+  803668:	48 01 d0             	add    %rdx,%rax
+  80366b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803671:	c3                   	ret
+  803672:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803678 <__rodata_start>:
+  803678:	3c 75                	cmp    $0x75,%al
+  80367a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80367b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80367f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803680:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803684:	1f                   	(bad)
+  803685:	44 00 00             	add    %r8b,(%rax)
+  803688:	73 79                	jae    803703 <__rodata_start+0x8b>
+  80368a:	73 63                	jae    8036ef <__rodata_start+0x77>
+  80368c:	61                   	(bad)
+  80368d:	6c                   	insb   (%dx),%es:(%rdi)
+  80368e:	6c                   	insb   (%dx),%es:(%rdi)
+  80368f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09b0f <__bss_end+0x72201b0f>
+  803695:	65 74 75             	gs je  80370d <__rodata_start+0x95>
+  803698:	72 6e                	jb     803708 <__rodata_start+0x90>
+  80369a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09b1c <__bss_end+0x28201b1c>
+  8036a1:	28 
+  8036a2:	3e 20 30             	ds and %dh,(%rax)
+  8036a5:	29 00                	sub    %eax,(%rax)
+  8036a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8036a8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8036af:	61                   	(bad)
+  8036b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8036b2:	2e 63 00             	cs movsxd (%rax),%eax
+  8036b5:	0f 1f 00             	nopl   (%rax)
+  8036b8:	5b                   	pop    %rbx
+  8036b9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036be:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8036c1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8036c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8036ca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8036d1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80413c <devpipe+0x7c>
+  8036d8:	5b                   	pop    %rbx
+  8036d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8036de:	20 72 65             	and    %dh,0x65(%rdx)
+  8036e1:	61                   	(bad)
+  8036e2:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8036e4:	61                   	(bad)
+  8036e5:	70 20                	jo     803707 <__rodata_start+0x8f>
+  8036e7:	25 64 20 2d 2d       	and    $0x2d2d2064,%eax
+  8036ec:	20 62 61             	and    %ah,0x61(%rdx)
+  8036ef:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8036f3:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8036f7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8036fa:	30 38                	xor    %bh,(%rax)
+  8036fc:	78 5d                	js     80375b <__rodata_start+0xe3>
+  8036fe:	20 66 74             	and    %ah,0x74(%rsi)
+  803701:	72 75                	jb     803778 <devtab+0x18>
+  803703:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803704:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803707:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad5772 <__bss_end+0x2d2cd772>
+  80370e:	20 62 61             	and    %ah,0x61(%rdx)
+  803711:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803715:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803719:	5b                   	pop    %rbx
+  80371a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80371f:	20 72 65             	and    %dh,0x65(%rdx)
+  803722:	61                   	(bad)
+  803723:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad578e <__bss_end+0x2d2cd78e>
+  80372a:	20 62 61             	and    %ah,0x61(%rdx)
+  80372d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803731:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803735:	5b                   	pop    %rbx
+  803736:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80373b:	20 77 72             	and    %dh,0x72(%rdi)
+  80373e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  803745:	2d 
+  803746:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80374b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80374e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803759:	00 00 00 
+  80375c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803770:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8037e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8037f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8038a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8038b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8038c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8038d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8038e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8038f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803990:	64 00 74 69 6d 65 64 20 6f 75 74 00 0f 1f 40 00     d.timed out...@.
+  8039a0:	20 28 80 00 00 00 00 00 61 2e 80 00 00 00 00 00      (......a.......
+  8039b0:	51 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     Q.......a.......
+  8039c0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  8039d0:	61 2e 80 00 00 00 00 00 3f 28 80 00 00 00 00 00     a.......?(......
+  8039e0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  8039f0:	33 28 80 00 00 00 00 00 ad 28 80 00 00 00 00 00     3(.......(......
+  803a00:	61 2e 80 00 00 00 00 00 33 28 80 00 00 00 00 00     a.......3(......
+  803a10:	79 28 80 00 00 00 00 00 79 28 80 00 00 00 00 00     y(......y(......
+  803a20:	79 28 80 00 00 00 00 00 79 28 80 00 00 00 00 00     y(......y(......
+  803a30:	79 28 80 00 00 00 00 00 79 28 80 00 00 00 00 00     y(......y(......
+  803a40:	79 28 80 00 00 00 00 00 79 28 80 00 00 00 00 00     y(......y(......
+  803a50:	79 28 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     y(......a.......
+  803a60:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803a70:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803a80:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803a90:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803aa0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803ab0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803ac0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803ad0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803ae0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803af0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b00:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b10:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b20:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b30:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b40:	61 2e 80 00 00 00 00 00 84 2d 80 00 00 00 00 00     a........-......
+  803b50:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b60:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b70:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b80:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803b90:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803ba0:	d0 28 80 00 00 00 00 00 9f 2a 80 00 00 00 00 00     .(.......*......
+  803bb0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803bc0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803bd0:	ff 28 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     .(......a.......
+  803be0:	61 2e 80 00 00 00 00 00 c5 28 80 00 00 00 00 00     a........(......
+  803bf0:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803c00:	47 2c 80 00 00 00 00 00 11 2d 80 00 00 00 00 00     G,.......-......
+  803c10:	61 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     a.......a.......
+  803c20:	96 29 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     .)......a.......
+  803c30:	73 2b 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     s+......a.......
+  803c40:	61 2e 80 00 00 00 00 00 84 2d 80 00 00 00 00 00     a........-......
+  803c50:	61 2e 80 00 00 00 00 00 29 28 80 00 00 00 00 00     a.......)(......
+
+0000000000803c60 <error_string>:
+	...
+  803c68:	35 38 80 00 00 00 00 00 47 38 80 00 00 00 00 00     58......G8......
+  803c78:	57 38 80 00 00 00 00 00 69 38 80 00 00 00 00 00     W8......i8......
+  803c88:	77 38 80 00 00 00 00 00 8b 38 80 00 00 00 00 00     w8.......8......
+  803c98:	a0 38 80 00 00 00 00 00 b3 38 80 00 00 00 00 00     .8.......8......
+  803ca8:	c5 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803cb8:	e9 38 80 00 00 00 00 00 fc 38 80 00 00 00 00 00     .8.......8......
+  803cc8:	13 39 80 00 00 00 00 00 29 39 80 00 00 00 00 00     .9......)9......
+  803cd8:	41 39 80 00 00 00 00 00 59 39 80 00 00 00 00 00     A9......Y9......
+  803ce8:	66 39 80 00 00 00 00 00 08 3d 80 00 00 00 00 00     f9.......=......
+  803cf8:	7a 39 80 00 00 00 00 00 92 39 80 00 00 00 00 00     z9.......9......
+  803d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 69     lid executable.i
+  803d28:	70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25     pc_send error: %
+  803d38:	69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     i..lib/ipc.c.f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,7756 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 87 00 00 00       	call   8000aa <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800029:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800030:	00 00 00 
+  800033:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800039:	48 bf 08 40 80 00 00 	movabs $0x804008,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800054:	ba 00 00 00 00       	mov    $0x0,%edx
+  800059:	48 bf 26 40 80 00 00 	movabs $0x804026,%rdi
+  800060:	00 00 00 
+  800063:	48 89 fe             	mov    %rdi,%rsi
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 f7 33 80 00 00 	movabs $0x8033f7,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 02                	js     80007d <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007b:	5d                   	pop    %rbp
+  80007c:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	48 ba 2c 40 80 00 00 	movabs $0x80402c,%rdx
+  800086:	00 00 00 
+  800089:	be 08 00 00 00       	mov    $0x8,%esi
+  80008e:	48 bf 44 40 80 00 00 	movabs $0x804044,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  8000a4:	00 00 00 
+  8000a7:	41 ff d0             	call   *%r8
+
+00000000008000aa <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 56                	push   %r14
+  8000b0:	41 55                	push   %r13
+  8000b2:	41 54                	push   %r12
+  8000b4:	53                   	push   %rbx
+  8000b5:	41 89 fd             	mov    %edi,%r13d
+  8000b8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8000cc:	00 00 00 
+  8000cf:	48 39 c2             	cmp    %rax,%rdx
+  8000d2:	73 17                	jae    8000eb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000d7:	49 89 c4             	mov    %rax,%r12
+  8000da:	48 83 c3 08          	add    $0x8,%rbx
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000e6:	4c 39 e3             	cmp    %r12,%rbx
+  8000e9:	72 ef                	jb     8000da <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000eb:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+  8000f7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fc:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800100:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800104:	48 c1 e0 04          	shl    $0x4,%rax
+  800108:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80010f:	00 00 00 
+  800112:	48 01 d0             	add    %rdx,%rax
+  800115:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80011c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80011f:	45 85 ed             	test   %r13d,%r13d
+  800122:	7e 0d                	jle    800131 <libmain+0x87>
+  800124:	49 8b 06             	mov    (%r14),%rax
+  800127:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80012e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800131:	4c 89 f6             	mov    %r14,%rsi
+  800134:	44 89 ef             	mov    %r13d,%edi
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800143:	48 b8 58 01 80 00 00 	movabs $0x800158,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+#endif
+}
+  80014f:	5b                   	pop    %rbx
+  800150:	41 5c                	pop    %r12
+  800152:	41 5d                	pop    %r13
+  800154:	41 5e                	pop    %r14
+  800156:	5d                   	pop    %rbp
+  800157:	c3                   	ret
+
+0000000000800158 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80015c:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  800163:	00 00 00 
+  800166:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800168:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016d:	48 b8 51 11 80 00 00 	movabs $0x801151,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+}
+  800179:	5d                   	pop    %rbp
+  80017a:	c3                   	ret
+
+000000000080017b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80017b:	55                   	push   %rbp
+  80017c:	48 89 e5             	mov    %rsp,%rbp
+  80017f:	41 56                	push   %r14
+  800181:	41 55                	push   %r13
+  800183:	41 54                	push   %r12
+  800185:	53                   	push   %rbx
+  800186:	48 83 ec 50          	sub    $0x50,%rsp
+  80018a:	49 89 fc             	mov    %rdi,%r12
+  80018d:	41 89 f5             	mov    %esi,%r13d
+  800190:	48 89 d3             	mov    %rdx,%rbx
+  800193:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800197:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80019b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80019f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8001a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001aa:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001ae:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001b2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001b6:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8001bd:	00 00 00 
+  8001c0:	4c 8b 30             	mov    (%rax),%r14
+  8001c3:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+  8001cf:	89 c6                	mov    %eax,%esi
+  8001d1:	45 89 e8             	mov    %r13d,%r8d
+  8001d4:	4c 89 e1             	mov    %r12,%rcx
+  8001d7:	4c 89 f2             	mov    %r14,%rdx
+  8001da:	48 bf 60 40 80 00 00 	movabs $0x804060,%rdi
+  8001e1:	00 00 00 
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	49 bc cb 02 80 00 00 	movabs $0x8002cb,%r12
+  8001f0:	00 00 00 
+  8001f3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8001f6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8001fa:	48 89 df             	mov    %rbx,%rdi
+  8001fd:	48 b8 67 02 80 00 00 	movabs $0x800267,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+    cprintf("\n");
+  800209:	48 bf 53 46 80 00 00 	movabs $0x804653,%rdi
+  800210:	00 00 00 
+  800213:	b8 00 00 00 00       	mov    $0x0,%eax
+  800218:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80021b:	cc                   	int3
+  80021c:	eb fd                	jmp    80021b <_panic+0xa0>
+
+000000000080021e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	53                   	push   %rbx
+  800223:	48 83 ec 08          	sub    $0x8,%rsp
+  800227:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80022a:	8b 06                	mov    (%rsi),%eax
+  80022c:	8d 50 01             	lea    0x1(%rax),%edx
+  80022f:	89 16                	mov    %edx,(%rsi)
+  800231:	48 98                	cltq
+  800233:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800238:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80023e:	74 0a                	je     80024a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800240:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800244:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800248:	c9                   	leave
+  800249:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80024a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80024e:	be ff 00 00 00       	mov    $0xff,%esi
+  800253:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80025f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800265:	eb d9                	jmp    800240 <putch+0x22>
+
+0000000000800267 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800267:	55                   	push   %rbp
+  800268:	48 89 e5             	mov    %rsp,%rbp
+  80026b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800272:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800275:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80027c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800289:	48 89 f1             	mov    %rsi,%rcx
+  80028c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800293:	48 bf 1e 02 80 00 00 	movabs $0x80021e,%rdi
+  80029a:	00 00 00 
+  80029d:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  8002a4:	00 00 00 
+  8002a7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002a9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002b0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002b7:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  8002be:	00 00 00 
+  8002c1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002c3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002c9:	c9                   	leave
+  8002ca:	c3                   	ret
+
+00000000008002cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002cb:	55                   	push   %rbp
+  8002cc:	48 89 e5             	mov    %rsp,%rbp
+  8002cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8002d3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002d7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002e7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002fe:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800302:	48 b8 67 02 80 00 00 	movabs $0x800267,%rax
+  800309:	00 00 00 
+  80030c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+0000000000800310 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800310:	55                   	push   %rbp
+  800311:	48 89 e5             	mov    %rsp,%rbp
+  800314:	41 57                	push   %r15
+  800316:	41 56                	push   %r14
+  800318:	41 55                	push   %r13
+  80031a:	41 54                	push   %r12
+  80031c:	53                   	push   %rbx
+  80031d:	48 83 ec 18          	sub    $0x18,%rsp
+  800321:	49 89 fc             	mov    %rdi,%r12
+  800324:	49 89 f5             	mov    %rsi,%r13
+  800327:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80032b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80032e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800331:	41 89 cf             	mov    %ecx,%r15d
+  800334:	4c 39 fa             	cmp    %r15,%rdx
+  800337:	73 5b                	jae    800394 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800339:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80033d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800341:	85 db                	test   %ebx,%ebx
+  800343:	7e 0e                	jle    800353 <print_num+0x43>
+            putch(padc, put_arg);
+  800345:	4c 89 ee             	mov    %r13,%rsi
+  800348:	44 89 f7             	mov    %r14d,%edi
+  80034b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80034e:	83 eb 01             	sub    $0x1,%ebx
+  800351:	75 f2                	jne    800345 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800353:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800357:	48 b9 94 40 80 00 00 	movabs $0x804094,%rcx
+  80035e:	00 00 00 
+  800361:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  800368:	00 00 00 
+  80036b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80036f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800373:	ba 00 00 00 00       	mov    $0x0,%edx
+  800378:	49 f7 f7             	div    %r15
+  80037b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80037f:	4c 89 ee             	mov    %r13,%rsi
+  800382:	41 ff d4             	call   *%r12
+}
+  800385:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800389:	5b                   	pop    %rbx
+  80038a:	41 5c                	pop    %r12
+  80038c:	41 5d                	pop    %r13
+  80038e:	41 5e                	pop    %r14
+  800390:	41 5f                	pop    %r15
+  800392:	5d                   	pop    %rbp
+  800393:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800394:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039d:	49 f7 f7             	div    %r15
+  8003a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003a8:	52                   	push   %rdx
+  8003a9:	45 0f be c9          	movsbl %r9b,%r9d
+  8003ad:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003b1:	48 89 c2             	mov    %rax,%rdx
+  8003b4:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  8003bb:	00 00 00 
+  8003be:	ff d0                	call   *%rax
+  8003c0:	48 83 c4 10          	add    $0x10,%rsp
+  8003c4:	eb 8d                	jmp    800353 <print_num+0x43>
+
+00000000008003c6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003c6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003ca:	48 8b 06             	mov    (%rsi),%rax
+  8003cd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003d1:	73 0a                	jae    8003dd <sprintputch+0x17>
+        *state->start++ = ch;
+  8003d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003d7:	48 89 16             	mov    %rdx,(%rsi)
+  8003da:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003dd:	c3                   	ret
+
+00000000008003de <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003de:	55                   	push   %rbp
+  8003df:	48 89 e5             	mov    %rsp,%rbp
+  8003e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8003e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003f2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800401:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800405:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800409:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80040d:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  800414:	00 00 00 
+  800417:	ff d0                	call   *%rax
+}
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+
+000000000080041b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80041b:	55                   	push   %rbp
+  80041c:	48 89 e5             	mov    %rsp,%rbp
+  80041f:	41 57                	push   %r15
+  800421:	41 56                	push   %r14
+  800423:	41 55                	push   %r13
+  800425:	41 54                	push   %r12
+  800427:	53                   	push   %rbx
+  800428:	48 83 ec 38          	sub    $0x38,%rsp
+  80042c:	49 89 fe             	mov    %rdi,%r14
+  80042f:	49 89 f5             	mov    %rsi,%r13
+  800432:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800435:	48 8b 01             	mov    (%rcx),%rax
+  800438:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80043c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800440:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800444:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800448:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80044c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800450:	0f b6 3b             	movzbl (%rbx),%edi
+  800453:	40 80 ff 25          	cmp    $0x25,%dil
+  800457:	74 18                	je     800471 <vprintfmt+0x56>
+            if (!ch) return;
+  800459:	40 84 ff             	test   %dil,%dil
+  80045c:	0f 84 b1 06 00 00    	je     800b13 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800462:	40 0f b6 ff          	movzbl %dil,%edi
+  800466:	4c 89 ee             	mov    %r13,%rsi
+  800469:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80046c:	4c 89 e3             	mov    %r12,%rbx
+  80046f:	eb db                	jmp    80044c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800471:	be 00 00 00 00       	mov    $0x0,%esi
+  800476:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80047a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80047f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800485:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80048c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800490:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800495:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80049a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80049d:	83 e8 23             	sub    $0x23,%eax
+  8004a0:	3c 57                	cmp    $0x57,%al
+  8004a2:	0f 87 51 06 00 00    	ja     800af9 <vprintfmt+0x6de>
+  8004a8:	0f b6 c0             	movzbl %al,%eax
+  8004ab:	48 b9 20 42 80 00 00 	movabs $0x804220,%rcx
+  8004b2:	00 00 00 
+  8004b5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004b8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004bb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004bf:	eb cf                	jmp    800490 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004c1:	49 89 dc             	mov    %rbx,%r12
+  8004c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8004c9:	eb c5                	jmp    800490 <vprintfmt+0x75>
+            padc = ch;
+  8004cb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004cf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004d5:	eb b9                	jmp    800490 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004da:	83 f8 2f             	cmp    $0x2f,%eax
+  8004dd:	77 24                	ja     800503 <vprintfmt+0xe8>
+  8004df:	89 c1                	mov    %eax,%ecx
+  8004e1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004e5:	83 c0 08             	add    $0x8,%eax
+  8004e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004eb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004ee:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004f5:	79 99                	jns    800490 <vprintfmt+0x75>
+                width = precision;
+  8004f7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004fb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800501:	eb 8d                	jmp    800490 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800503:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800507:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80050b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050f:	eb da                	jmp    8004eb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800511:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800516:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80051a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800520:	3c 39                	cmp    $0x39,%al
+  800522:	77 1c                	ja     800540 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800524:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800528:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80052c:	0f b6 c0             	movzbl %al,%eax
+  80052f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800534:	0f b6 03             	movzbl (%rbx),%eax
+  800537:	3c 39                	cmp    $0x39,%al
+  800539:	76 e9                	jbe    800524 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80053b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80053e:	eb b1                	jmp    8004f1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800540:	49 89 dc             	mov    %rbx,%r12
+  800543:	eb ac                	jmp    8004f1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800545:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054f:	0f 49 c1             	cmovns %ecx,%eax
+  800552:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800555:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800558:	e9 33 ff ff ff       	jmp    800490 <vprintfmt+0x75>
+            lflag++;
+  80055d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800560:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800563:	e9 28 ff ff ff       	jmp    800490 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800568:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80056b:	83 f8 2f             	cmp    $0x2f,%eax
+  80056e:	77 19                	ja     800589 <vprintfmt+0x16e>
+  800570:	89 c2                	mov    %eax,%edx
+  800572:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800576:	83 c0 08             	add    $0x8,%eax
+  800579:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80057c:	8b 3a                	mov    (%rdx),%edi
+  80057e:	4c 89 ee             	mov    %r13,%rsi
+  800581:	41 ff d6             	call   *%r14
+            break;
+  800584:	e9 c3 fe ff ff       	jmp    80044c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800589:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80058d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800591:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800595:	eb e5                	jmp    80057c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800597:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80059a:	83 f8 2f             	cmp    $0x2f,%eax
+  80059d:	77 5a                	ja     8005f9 <vprintfmt+0x1de>
+  80059f:	89 c2                	mov    %eax,%edx
+  8005a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005a5:	83 c0 08             	add    $0x8,%eax
+  8005a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005ab:	8b 02                	mov    (%rdx),%eax
+  8005ad:	89 c1                	mov    %eax,%ecx
+  8005af:	f7 d9                	neg    %ecx
+  8005b1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005b4:	83 f9 14             	cmp    $0x14,%ecx
+  8005b7:	7f 4e                	jg     800607 <vprintfmt+0x1ec>
+  8005b9:	48 63 c1             	movslq %ecx,%rax
+  8005bc:	48 ba e0 44 80 00 00 	movabs $0x8044e0,%rdx
+  8005c3:	00 00 00 
+  8005c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005ca:	48 85 c0             	test   %rax,%rax
+  8005cd:	74 38                	je     800607 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005cf:	48 89 c1             	mov    %rax,%rcx
+  8005d2:	48 ba cd 47 80 00 00 	movabs $0x8047cd,%rdx
+  8005d9:	00 00 00 
+  8005dc:	4c 89 ee             	mov    %r13,%rsi
+  8005df:	4c 89 f7             	mov    %r14,%rdi
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	49 b8 de 03 80 00 00 	movabs $0x8003de,%r8
+  8005ee:	00 00 00 
+  8005f1:	41 ff d0             	call   *%r8
+  8005f4:	e9 53 fe ff ff       	jmp    80044c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800601:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800605:	eb a4                	jmp    8005ab <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800607:	48 ba ac 40 80 00 00 	movabs $0x8040ac,%rdx
+  80060e:	00 00 00 
+  800611:	4c 89 ee             	mov    %r13,%rsi
+  800614:	4c 89 f7             	mov    %r14,%rdi
+  800617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061c:	49 b8 de 03 80 00 00 	movabs $0x8003de,%r8
+  800623:	00 00 00 
+  800626:	41 ff d0             	call   *%r8
+  800629:	e9 1e fe ff ff       	jmp    80044c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80062e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800631:	83 f8 2f             	cmp    $0x2f,%eax
+  800634:	77 6c                	ja     8006a2 <vprintfmt+0x287>
+  800636:	89 c2                	mov    %eax,%edx
+  800638:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063c:	83 c0 08             	add    $0x8,%eax
+  80063f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800642:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800645:	48 85 d2             	test   %rdx,%rdx
+  800648:	48 b8 a5 40 80 00 00 	movabs $0x8040a5,%rax
+  80064f:	00 00 00 
+  800652:	48 0f 45 c2          	cmovne %rdx,%rax
+  800656:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80065a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80065e:	7e 06                	jle    800666 <vprintfmt+0x24b>
+  800660:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800664:	75 4a                	jne    8006b0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800666:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80066a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80066e:	0f b6 00             	movzbl (%rax),%eax
+  800671:	84 c0                	test   %al,%al
+  800673:	0f 85 9a 00 00 00    	jne    800713 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800679:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800680:	85 c0                	test   %eax,%eax
+  800682:	0f 8e c4 fd ff ff    	jle    80044c <vprintfmt+0x31>
+  800688:	4c 89 ee             	mov    %r13,%rsi
+  80068b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800690:	41 ff d6             	call   *%r14
+  800693:	41 83 ec 01          	sub    $0x1,%r12d
+  800697:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80069b:	75 eb                	jne    800688 <vprintfmt+0x26d>
+  80069d:	e9 aa fd ff ff       	jmp    80044c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ae:	eb 92                	jmp    800642 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006b0:	49 63 f7             	movslq %r15d,%rsi
+  8006b3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006b7:	48 b8 cd 0b 80 00 00 	movabs $0x800bcd,%rax
+  8006be:	00 00 00 
+  8006c1:	ff d0                	call   *%rax
+  8006c3:	48 89 c2             	mov    %rax,%rdx
+  8006c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006cb:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006ce:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006d1:	85 c0                	test   %eax,%eax
+  8006d3:	7e 91                	jle    800666 <vprintfmt+0x24b>
+  8006d5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006da:	4c 89 ee             	mov    %r13,%rsi
+  8006dd:	44 89 e7             	mov    %r12d,%edi
+  8006e0:	41 ff d6             	call   *%r14
+  8006e3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006ed:	75 eb                	jne    8006da <vprintfmt+0x2bf>
+  8006ef:	e9 72 ff ff ff       	jmp    800666 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f4:	0f b6 f8             	movzbl %al,%edi
+  8006f7:	4c 89 ee             	mov    %r13,%rsi
+  8006fa:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006fd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800701:	49 83 c4 01          	add    $0x1,%r12
+  800705:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80070b:	84 c0                	test   %al,%al
+  80070d:	0f 84 66 ff ff ff    	je     800679 <vprintfmt+0x25e>
+  800713:	45 85 ff             	test   %r15d,%r15d
+  800716:	78 0a                	js     800722 <vprintfmt+0x307>
+  800718:	41 83 ef 01          	sub    $0x1,%r15d
+  80071c:	0f 88 57 ff ff ff    	js     800679 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800722:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800726:	74 cc                	je     8006f4 <vprintfmt+0x2d9>
+  800728:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80072b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800730:	80 fa 5e             	cmp    $0x5e,%dl
+  800733:	77 c2                	ja     8006f7 <vprintfmt+0x2dc>
+  800735:	eb bd                	jmp    8006f4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800737:	40 84 f6             	test   %sil,%sil
+  80073a:	75 26                	jne    800762 <vprintfmt+0x347>
+    switch (lflag) {
+  80073c:	85 d2                	test   %edx,%edx
+  80073e:	74 59                	je     800799 <vprintfmt+0x37e>
+  800740:	83 fa 01             	cmp    $0x1,%edx
+  800743:	74 7b                	je     8007c0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800745:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800748:	83 f8 2f             	cmp    $0x2f,%eax
+  80074b:	0f 87 96 00 00 00    	ja     8007e7 <vprintfmt+0x3cc>
+  800751:	89 c2                	mov    %eax,%edx
+  800753:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800757:	83 c0 08             	add    $0x8,%eax
+  80075a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075d:	4c 8b 22             	mov    (%rdx),%r12
+  800760:	eb 17                	jmp    800779 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800762:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800765:	83 f8 2f             	cmp    $0x2f,%eax
+  800768:	77 21                	ja     80078b <vprintfmt+0x370>
+  80076a:	89 c2                	mov    %eax,%edx
+  80076c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800770:	83 c0 08             	add    $0x8,%eax
+  800773:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800776:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800779:	4d 85 e4             	test   %r12,%r12
+  80077c:	78 7a                	js     8007f8 <vprintfmt+0x3dd>
+            num = i;
+  80077e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800781:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800786:	e9 50 02 00 00       	jmp    8009db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80078b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	eb dd                	jmp    800776 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800799:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079c:	83 f8 2f             	cmp    $0x2f,%eax
+  80079f:	77 11                	ja     8007b2 <vprintfmt+0x397>
+  8007a1:	89 c2                	mov    %eax,%edx
+  8007a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a7:	83 c0 08             	add    $0x8,%eax
+  8007aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ad:	4c 63 22             	movslq (%rdx),%r12
+  8007b0:	eb c7                	jmp    800779 <vprintfmt+0x35e>
+  8007b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007be:	eb ed                	jmp    8007ad <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 11                	ja     8007d9 <vprintfmt+0x3be>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d4:	4c 8b 22             	mov    (%rdx),%r12
+  8007d7:	eb a0                	jmp    800779 <vprintfmt+0x35e>
+  8007d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e5:	eb ed                	jmp    8007d4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f3:	e9 65 ff ff ff       	jmp    80075d <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007f8:	4c 89 ee             	mov    %r13,%rsi
+  8007fb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800800:	41 ff d6             	call   *%r14
+                i = -i;
+  800803:	49 f7 dc             	neg    %r12
+  800806:	e9 73 ff ff ff       	jmp    80077e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	40 84 f6             	test   %sil,%sil
+  80080e:	75 32                	jne    800842 <vprintfmt+0x427>
+    switch (lflag) {
+  800810:	85 d2                	test   %edx,%edx
+  800812:	74 5d                	je     800871 <vprintfmt+0x456>
+  800814:	83 fa 01             	cmp    $0x1,%edx
+  800817:	0f 84 82 00 00 00    	je     80089f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80081d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800820:	83 f8 2f             	cmp    $0x2f,%eax
+  800823:	0f 87 a5 00 00 00    	ja     8008ce <vprintfmt+0x4b3>
+  800829:	89 c2                	mov    %eax,%edx
+  80082b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082f:	83 c0 08             	add    $0x8,%eax
+  800832:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800835:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800838:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80083d:	e9 99 01 00 00       	jmp    8009db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800842:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800845:	83 f8 2f             	cmp    $0x2f,%eax
+  800848:	77 19                	ja     800863 <vprintfmt+0x448>
+  80084a:	89 c2                	mov    %eax,%edx
+  80084c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800850:	83 c0 08             	add    $0x8,%eax
+  800853:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800856:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800859:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80085e:	e9 78 01 00 00       	jmp    8009db <vprintfmt+0x5c0>
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb e5                	jmp    800856 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 18                	ja     800891 <vprintfmt+0x476>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800887:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80088c:	e9 4a 01 00 00       	jmp    8009db <vprintfmt+0x5c0>
+  800891:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800895:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089d:	eb e6                	jmp    800885 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80089f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a5:	77 19                	ja     8008c0 <vprintfmt+0x4a5>
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ad:	83 c0 08             	add    $0x8,%eax
+  8008b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008bb:	e9 1b 01 00 00       	jmp    8009db <vprintfmt+0x5c0>
+  8008c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cc:	eb e5                	jmp    8008b3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008da:	e9 56 ff ff ff       	jmp    800835 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008df:	40 84 f6             	test   %sil,%sil
+  8008e2:	75 2e                	jne    800912 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008e4:	85 d2                	test   %edx,%edx
+  8008e6:	74 59                	je     800941 <vprintfmt+0x526>
+  8008e8:	83 fa 01             	cmp    $0x1,%edx
+  8008eb:	74 7f                	je     80096c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f3:	0f 87 9f 00 00 00    	ja     800998 <vprintfmt+0x57d>
+  8008f9:	89 c2                	mov    %eax,%edx
+  8008fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ff:	83 c0 08             	add    $0x8,%eax
+  800902:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800905:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800908:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80090d:	e9 c9 00 00 00       	jmp    8009db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800912:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800915:	83 f8 2f             	cmp    $0x2f,%eax
+  800918:	77 19                	ja     800933 <vprintfmt+0x518>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800920:	83 c0 08             	add    $0x8,%eax
+  800923:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800926:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800929:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80092e:	e9 a8 00 00 00       	jmp    8009db <vprintfmt+0x5c0>
+  800933:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800937:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093f:	eb e5                	jmp    800926 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	77 15                	ja     80095e <vprintfmt+0x543>
+  800949:	89 c2                	mov    %eax,%edx
+  80094b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094f:	83 c0 08             	add    $0x8,%eax
+  800952:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800955:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800957:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80095c:	eb 7d                	jmp    8009db <vprintfmt+0x5c0>
+  80095e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800962:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800966:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096a:	eb e9                	jmp    800955 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80096c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096f:	83 f8 2f             	cmp    $0x2f,%eax
+  800972:	77 16                	ja     80098a <vprintfmt+0x56f>
+  800974:	89 c2                	mov    %eax,%edx
+  800976:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097a:	83 c0 08             	add    $0x8,%eax
+  80097d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800980:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800983:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800988:	eb 51                	jmp    8009db <vprintfmt+0x5c0>
+  80098a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800992:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800996:	eb e8                	jmp    800980 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800998:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a4:	e9 5c ff ff ff       	jmp    800905 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009a9:	4c 89 ee             	mov    %r13,%rsi
+  8009ac:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009b1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009b4:	4c 89 ee             	mov    %r13,%rsi
+  8009b7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009bc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 47                	ja     800a0e <vprintfmt+0x5f3>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009db:	48 83 ec 08          	sub    $0x8,%rsp
+  8009df:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009e3:	0f 94 c0             	sete   %al
+  8009e6:	0f b6 c0             	movzbl %al,%eax
+  8009e9:	50                   	push   %rax
+  8009ea:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009ef:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009f3:	4c 89 ee             	mov    %r13,%rsi
+  8009f6:	4c 89 f7             	mov    %r14,%rdi
+  8009f9:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  800a00:	00 00 00 
+  800a03:	ff d0                	call   *%rax
+            break;
+  800a05:	48 83 c4 10          	add    $0x10,%rsp
+  800a09:	e9 3e fa ff ff       	jmp    80044c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb b7                	jmp    8009d3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1c:	40 84 f6             	test   %sil,%sil
+  800a1f:	75 2b                	jne    800a4c <vprintfmt+0x631>
+    switch (lflag) {
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	74 56                	je     800a7b <vprintfmt+0x660>
+  800a25:	83 fa 01             	cmp    $0x1,%edx
+  800a28:	74 7f                	je     800aa9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	0f 87 a2 00 00 00    	ja     800ad8 <vprintfmt+0x6bd>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4a:	eb 8f                	jmp    8009db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a52:	77 19                	ja     800a6d <vprintfmt+0x652>
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5a:	83 c0 08             	add    $0x8,%eax
+  800a5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a60:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a63:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a68:	e9 6e ff ff ff       	jmp    8009db <vprintfmt+0x5c0>
+  800a6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a79:	eb e5                	jmp    800a60 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a81:	77 18                	ja     800a9b <vprintfmt+0x680>
+  800a83:	89 c2                	mov    %eax,%edx
+  800a85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a89:	83 c0 08             	add    $0x8,%eax
+  800a8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a96:	e9 40 ff ff ff       	jmp    8009db <vprintfmt+0x5c0>
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	eb e6                	jmp    800a8f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aac:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaf:	77 19                	ja     800aca <vprintfmt+0x6af>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac5:	e9 11 ff ff ff       	jmp    8009db <vprintfmt+0x5c0>
+  800aca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ace:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad6:	eb e5                	jmp    800abd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ad8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae4:	e9 59 ff ff ff       	jmp    800a42 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ae9:	4c 89 ee             	mov    %r13,%rsi
+  800aec:	bf 25 00 00 00       	mov    $0x25,%edi
+  800af1:	41 ff d6             	call   *%r14
+            break;
+  800af4:	e9 53 f9 ff ff       	jmp    80044c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800af9:	4c 89 ee             	mov    %r13,%rsi
+  800afc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b01:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b04:	48 83 eb 01          	sub    $0x1,%rbx
+  800b08:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b0c:	75 f6                	jne    800b04 <vprintfmt+0x6e9>
+  800b0e:	e9 39 f9 ff ff       	jmp    80044c <vprintfmt+0x31>
+}
+  800b13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b17:	5b                   	pop    %rbx
+  800b18:	41 5c                	pop    %r12
+  800b1a:	41 5d                	pop    %r13
+  800b1c:	41 5e                	pop    %r14
+  800b1e:	41 5f                	pop    %r15
+  800b20:	5d                   	pop    %rbp
+  800b21:	c3                   	ret
+
+0000000000800b22 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b22:	55                   	push   %rbp
+  800b23:	48 89 e5             	mov    %rsp,%rbp
+  800b26:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b2e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b33:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b37:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b3e:	48 85 ff             	test   %rdi,%rdi
+  800b41:	74 2b                	je     800b6e <vsnprintf+0x4c>
+  800b43:	48 85 f6             	test   %rsi,%rsi
+  800b46:	74 26                	je     800b6e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b4c:	48 bf c6 03 80 00 00 	movabs $0x8003c6,%rdi
+  800b53:	00 00 00 
+  800b56:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  800b5d:	00 00 00 
+  800b60:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b66:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b6c:	c9                   	leave
+  800b6d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b73:	eb f7                	jmp    800b6c <vsnprintf+0x4a>
+
+0000000000800b75 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b75:	55                   	push   %rbp
+  800b76:	48 89 e5             	mov    %rsp,%rbp
+  800b79:	48 83 ec 50          	sub    $0x50,%rsp
+  800b7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ba0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ba4:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  800bab:	00 00 00 
+  800bae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bb0:	c9                   	leave
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bb2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bb5:	74 10                	je     800bc7 <strlen+0x15>
+    size_t n = 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bbc:	48 83 c0 01          	add    $0x1,%rax
+  800bc0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bc4:	75 f6                	jne    800bbc <strlen+0xa>
+  800bc6:	c3                   	ret
+    size_t n = 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bcc:	c3                   	ret
+
+0000000000800bcd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bcd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bd5:	48 85 f6             	test   %rsi,%rsi
+  800bd8:	74 11                	je     800beb <strnlen+0x1e>
+  800bda:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bde:	74 0c                	je     800bec <strnlen+0x1f>
+  800be0:	48 83 c2 01          	add    $0x1,%rdx
+  800be4:	48 39 d0             	cmp    %rdx,%rax
+  800be7:	75 f1                	jne    800bda <strnlen+0xd>
+  800be9:	eb 04                	jmp    800bef <strnlen+0x22>
+  800beb:	c3                   	ret
+  800bec:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bef:	c3                   	ret
+
+0000000000800bf0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bf0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bfc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bff:	48 83 c2 01          	add    $0x1,%rdx
+  800c03:	84 c9                	test   %cl,%cl
+  800c05:	75 f1                	jne    800bf8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c07:	c3                   	ret
+
+0000000000800c08 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c08:	55                   	push   %rbp
+  800c09:	48 89 e5             	mov    %rsp,%rbp
+  800c0c:	41 54                	push   %r12
+  800c0e:	53                   	push   %rbx
+  800c0f:	48 89 fb             	mov    %rdi,%rbx
+  800c12:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c15:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  800c1c:	00 00 00 
+  800c1f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c21:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c25:	4c 89 e6             	mov    %r12,%rsi
+  800c28:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  800c2f:	00 00 00 
+  800c32:	ff d0                	call   *%rax
+    return dst;
+}
+  800c34:	48 89 d8             	mov    %rbx,%rax
+  800c37:	5b                   	pop    %rbx
+  800c38:	41 5c                	pop    %r12
+  800c3a:	5d                   	pop    %rbp
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c3c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c3f:	48 85 d2             	test   %rdx,%rdx
+  800c42:	74 1f                	je     800c63 <strncpy+0x27>
+  800c44:	48 01 fa             	add    %rdi,%rdx
+  800c47:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c4a:	48 83 c1 01          	add    $0x1,%rcx
+  800c4e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c52:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c56:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c5a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c5e:	48 39 ca             	cmp    %rcx,%rdx
+  800c61:	75 e7                	jne    800c4a <strncpy+0xe>
+    }
+    return ret;
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c64:	48 89 f8             	mov    %rdi,%rax
+  800c67:	48 85 d2             	test   %rdx,%rdx
+  800c6a:	74 24                	je     800c90 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c70:	74 1b                	je     800c8d <strlcpy+0x29>
+  800c72:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c76:	0f b6 16             	movzbl (%rsi),%edx
+  800c79:	84 d2                	test   %dl,%dl
+  800c7b:	74 10                	je     800c8d <strlcpy+0x29>
+            *dst++ = *src++;
+  800c7d:	48 83 c6 01          	add    $0x1,%rsi
+  800c81:	48 83 c0 01          	add    $0x1,%rax
+  800c85:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c88:	48 39 c8             	cmp    %rcx,%rax
+  800c8b:	75 e9                	jne    800c76 <strlcpy+0x12>
+        *dst = '\0';
+  800c8d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c90:	48 29 f8             	sub    %rdi,%rax
+}
+  800c93:	c3                   	ret
+
+0000000000800c94 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c94:	0f b6 07             	movzbl (%rdi),%eax
+  800c97:	84 c0                	test   %al,%al
+  800c99:	74 13                	je     800cae <strcmp+0x1a>
+  800c9b:	38 06                	cmp    %al,(%rsi)
+  800c9d:	75 0f                	jne    800cae <strcmp+0x1a>
+  800c9f:	48 83 c7 01          	add    $0x1,%rdi
+  800ca3:	48 83 c6 01          	add    $0x1,%rsi
+  800ca7:	0f b6 07             	movzbl (%rdi),%eax
+  800caa:	84 c0                	test   %al,%al
+  800cac:	75 ed                	jne    800c9b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cae:	0f b6 c0             	movzbl %al,%eax
+  800cb1:	0f b6 16             	movzbl (%rsi),%edx
+  800cb4:	29 d0                	sub    %edx,%eax
+}
+  800cb6:	c3                   	ret
+
+0000000000800cb7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cb7:	48 85 d2             	test   %rdx,%rdx
+  800cba:	74 1f                	je     800cdb <strncmp+0x24>
+  800cbc:	0f b6 07             	movzbl (%rdi),%eax
+  800cbf:	84 c0                	test   %al,%al
+  800cc1:	74 1e                	je     800ce1 <strncmp+0x2a>
+  800cc3:	3a 06                	cmp    (%rsi),%al
+  800cc5:	75 1a                	jne    800ce1 <strncmp+0x2a>
+  800cc7:	48 83 c7 01          	add    $0x1,%rdi
+  800ccb:	48 83 c6 01          	add    $0x1,%rsi
+  800ccf:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd3:	75 e7                	jne    800cbc <strncmp+0x5>
+
+    if (!n) return 0;
+  800cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cda:	c3                   	ret
+  800cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce0:	c3                   	ret
+  800ce1:	48 85 d2             	test   %rdx,%rdx
+  800ce4:	74 09                	je     800cef <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ce6:	0f b6 07             	movzbl (%rdi),%eax
+  800ce9:	0f b6 16             	movzbl (%rsi),%edx
+  800cec:	29 d0                	sub    %edx,%eax
+  800cee:	c3                   	ret
+    if (!n) return 0;
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cf5:	0f b6 17             	movzbl (%rdi),%edx
+  800cf8:	84 d2                	test   %dl,%dl
+  800cfa:	74 18                	je     800d14 <strchr+0x1f>
+        if (*str == c) {
+  800cfc:	0f be d2             	movsbl %dl,%edx
+  800cff:	39 f2                	cmp    %esi,%edx
+  800d01:	74 17                	je     800d1a <strchr+0x25>
+    for (; *str; str++) {
+  800d03:	48 83 c7 01          	add    $0x1,%rdi
+  800d07:	0f b6 17             	movzbl (%rdi),%edx
+  800d0a:	84 d2                	test   %dl,%dl
+  800d0c:	75 ee                	jne    800cfc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	c3                   	ret
+  800d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d19:	c3                   	ret
+  800d1a:	48 89 f8             	mov    %rdi,%rax
+}
+  800d1d:	c3                   	ret
+
+0000000000800d1e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d1e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d21:	0f b6 17             	movzbl (%rdi),%edx
+  800d24:	84 d2                	test   %dl,%dl
+  800d26:	74 13                	je     800d3b <strfind+0x1d>
+  800d28:	0f be d2             	movsbl %dl,%edx
+  800d2b:	39 f2                	cmp    %esi,%edx
+  800d2d:	74 0b                	je     800d3a <strfind+0x1c>
+  800d2f:	48 83 c0 01          	add    $0x1,%rax
+  800d33:	0f b6 10             	movzbl (%rax),%edx
+  800d36:	84 d2                	test   %dl,%dl
+  800d38:	75 ee                	jne    800d28 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d3a:	c3                   	ret
+  800d3b:	c3                   	ret
+
+0000000000800d3c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d3c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d3f:	48 89 f8             	mov    %rdi,%rax
+  800d42:	48 f7 d8             	neg    %rax
+  800d45:	83 e0 07             	and    $0x7,%eax
+  800d48:	49 89 d1             	mov    %rdx,%r9
+  800d4b:	49 29 c1             	sub    %rax,%r9
+  800d4e:	78 36                	js     800d86 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d50:	40 0f b6 c6          	movzbl %sil,%eax
+  800d54:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d5b:	01 01 01 
+  800d5e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d62:	40 f6 c7 07          	test   $0x7,%dil
+  800d66:	75 38                	jne    800da0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d68:	4c 89 c9             	mov    %r9,%rcx
+  800d6b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d6f:	74 0c                	je     800d7d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d71:	fc                   	cld
+  800d72:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d75:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d79:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d7d:	4d 85 c9             	test   %r9,%r9
+  800d80:	75 45                	jne    800dc7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d82:	4c 89 c0             	mov    %r8,%rax
+  800d85:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d86:	48 85 d2             	test   %rdx,%rdx
+  800d89:	74 f7                	je     800d82 <memset+0x46>
+  800d8b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d8e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d91:	48 83 c0 01          	add    $0x1,%rax
+  800d95:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d99:	48 39 c2             	cmp    %rax,%rdx
+  800d9c:	75 f3                	jne    800d91 <memset+0x55>
+  800d9e:	eb e2                	jmp    800d82 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800da0:	40 f6 c7 01          	test   $0x1,%dil
+  800da4:	74 06                	je     800dac <memset+0x70>
+  800da6:	88 07                	mov    %al,(%rdi)
+  800da8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dac:	40 f6 c7 02          	test   $0x2,%dil
+  800db0:	74 07                	je     800db9 <memset+0x7d>
+  800db2:	66 89 07             	mov    %ax,(%rdi)
+  800db5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db9:	40 f6 c7 04          	test   $0x4,%dil
+  800dbd:	74 a9                	je     800d68 <memset+0x2c>
+  800dbf:	89 07                	mov    %eax,(%rdi)
+  800dc1:	48 83 c7 04          	add    $0x4,%rdi
+  800dc5:	eb a1                	jmp    800d68 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dc7:	41 f6 c1 04          	test   $0x4,%r9b
+  800dcb:	74 06                	je     800dd3 <memset+0x97>
+  800dcd:	89 07                	mov    %eax,(%rdi)
+  800dcf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dd3:	41 f6 c1 02          	test   $0x2,%r9b
+  800dd7:	74 07                	je     800de0 <memset+0xa4>
+  800dd9:	66 89 07             	mov    %ax,(%rdi)
+  800ddc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800de0:	41 f6 c1 01          	test   $0x1,%r9b
+  800de4:	74 9c                	je     800d82 <memset+0x46>
+  800de6:	88 07                	mov    %al,(%rdi)
+  800de8:	eb 98                	jmp    800d82 <memset+0x46>
+
+0000000000800dea <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dea:	48 89 f8             	mov    %rdi,%rax
+  800ded:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800df0:	48 39 fe             	cmp    %rdi,%rsi
+  800df3:	73 3b                	jae    800e30 <memmove+0x46>
+  800df5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800df9:	48 39 d7             	cmp    %rdx,%rdi
+  800dfc:	73 32                	jae    800e30 <memmove+0x46>
+        s += n;
+        d += n;
+  800dfe:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e02:	48 89 d6             	mov    %rdx,%rsi
+  800e05:	48 09 fe             	or     %rdi,%rsi
+  800e08:	48 09 ce             	or     %rcx,%rsi
+  800e0b:	40 f6 c6 07          	test   $0x7,%sil
+  800e0f:	75 12                	jne    800e23 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e11:	48 83 ef 08          	sub    $0x8,%rdi
+  800e15:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e19:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e1d:	fd                   	std
+  800e1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e21:	fc                   	cld
+  800e22:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e23:	48 83 ef 01          	sub    $0x1,%rdi
+  800e27:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e2b:	fd                   	std
+  800e2c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e2e:	eb f1                	jmp    800e21 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e30:	48 89 f2             	mov    %rsi,%rdx
+  800e33:	48 09 c2             	or     %rax,%rdx
+  800e36:	48 09 ca             	or     %rcx,%rdx
+  800e39:	f6 c2 07             	test   $0x7,%dl
+  800e3c:	75 0c                	jne    800e4a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e3e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e42:	48 89 c7             	mov    %rax,%rdi
+  800e45:	fc                   	cld
+  800e46:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e49:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e4a:	48 89 c7             	mov    %rax,%rdi
+  800e4d:	fc                   	cld
+  800e4e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e50:	c3                   	ret
+
+0000000000800e51 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e51:	55                   	push   %rbp
+  800e52:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e55:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800e5c:	00 00 00 
+  800e5f:	ff d0                	call   *%rax
+}
+  800e61:	5d                   	pop    %rbp
+  800e62:	c3                   	ret
+
+0000000000800e63 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e63:	55                   	push   %rbp
+  800e64:	48 89 e5             	mov    %rsp,%rbp
+  800e67:	41 57                	push   %r15
+  800e69:	41 56                	push   %r14
+  800e6b:	41 55                	push   %r13
+  800e6d:	41 54                	push   %r12
+  800e6f:	53                   	push   %rbx
+  800e70:	48 83 ec 08          	sub    $0x8,%rsp
+  800e74:	49 89 fe             	mov    %rdi,%r14
+  800e77:	49 89 f7             	mov    %rsi,%r15
+  800e7a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e7d:	48 89 f7             	mov    %rsi,%rdi
+  800e80:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  800e87:	00 00 00 
+  800e8a:	ff d0                	call   *%rax
+  800e8c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e8f:	48 89 de             	mov    %rbx,%rsi
+  800e92:	4c 89 f7             	mov    %r14,%rdi
+  800e95:	48 b8 cd 0b 80 00 00 	movabs $0x800bcd,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+  800ea1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ea4:	48 39 c3             	cmp    %rax,%rbx
+  800ea7:	74 36                	je     800edf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ea9:	48 89 d8             	mov    %rbx,%rax
+  800eac:	4c 29 e8             	sub    %r13,%rax
+  800eaf:	49 39 c4             	cmp    %rax,%r12
+  800eb2:	73 31                	jae    800ee5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800eb4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800eb9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ebd:	4c 89 fe             	mov    %r15,%rsi
+  800ec0:	48 b8 51 0e 80 00 00 	movabs $0x800e51,%rax
+  800ec7:	00 00 00 
+  800eca:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ecc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ed0:	48 83 c4 08          	add    $0x8,%rsp
+  800ed4:	5b                   	pop    %rbx
+  800ed5:	41 5c                	pop    %r12
+  800ed7:	41 5d                	pop    %r13
+  800ed9:	41 5e                	pop    %r14
+  800edb:	41 5f                	pop    %r15
+  800edd:	5d                   	pop    %rbp
+  800ede:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800edf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ee3:	eb eb                	jmp    800ed0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ee5:	48 83 eb 01          	sub    $0x1,%rbx
+  800ee9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eed:	48 89 da             	mov    %rbx,%rdx
+  800ef0:	4c 89 fe             	mov    %r15,%rsi
+  800ef3:	48 b8 51 0e 80 00 00 	movabs $0x800e51,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eff:	49 01 de             	add    %rbx,%r14
+  800f02:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f07:	eb c3                	jmp    800ecc <strlcat+0x69>
+
+0000000000800f09 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f09:	48 85 d2             	test   %rdx,%rdx
+  800f0c:	74 2d                	je     800f3b <memcmp+0x32>
+  800f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f13:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f17:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f1c:	44 38 c1             	cmp    %r8b,%cl
+  800f1f:	75 0f                	jne    800f30 <memcmp+0x27>
+    while (n-- > 0) {
+  800f21:	48 83 c0 01          	add    $0x1,%rax
+  800f25:	48 39 c2             	cmp    %rax,%rdx
+  800f28:	75 e9                	jne    800f13 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f30:	0f b6 c1             	movzbl %cl,%eax
+  800f33:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f37:	44 29 c0             	sub    %r8d,%eax
+  800f3a:	c3                   	ret
+    return 0;
+  800f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f40:	c3                   	ret
+
+0000000000800f41 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f41:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f45:	48 39 c7             	cmp    %rax,%rdi
+  800f48:	73 0f                	jae    800f59 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f4a:	40 38 37             	cmp    %sil,(%rdi)
+  800f4d:	74 0e                	je     800f5d <memfind+0x1c>
+    for (; src < end; src++) {
+  800f4f:	48 83 c7 01          	add    $0x1,%rdi
+  800f53:	48 39 f8             	cmp    %rdi,%rax
+  800f56:	75 f2                	jne    800f4a <memfind+0x9>
+  800f58:	c3                   	ret
+  800f59:	48 89 f8             	mov    %rdi,%rax
+  800f5c:	c3                   	ret
+  800f5d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f60:	c3                   	ret
+
+0000000000800f61 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f61:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f64:	0f b6 37             	movzbl (%rdi),%esi
+  800f67:	40 80 fe 20          	cmp    $0x20,%sil
+  800f6b:	74 06                	je     800f73 <strtol+0x12>
+  800f6d:	40 80 fe 09          	cmp    $0x9,%sil
+  800f71:	75 13                	jne    800f86 <strtol+0x25>
+  800f73:	48 83 c7 01          	add    $0x1,%rdi
+  800f77:	0f b6 37             	movzbl (%rdi),%esi
+  800f7a:	40 80 fe 20          	cmp    $0x20,%sil
+  800f7e:	74 f3                	je     800f73 <strtol+0x12>
+  800f80:	40 80 fe 09          	cmp    $0x9,%sil
+  800f84:	74 ed                	je     800f73 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f86:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f89:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f8c:	3c 01                	cmp    $0x1,%al
+  800f8e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f92:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f98:	75 0f                	jne    800fa9 <strtol+0x48>
+  800f9a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f9d:	74 14                	je     800fb3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f9f:	85 d2                	test   %edx,%edx
+  800fa1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fae:	4c 63 ca             	movslq %edx,%r9
+  800fb1:	eb 36                	jmp    800fe9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fb3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fb7:	74 0f                	je     800fc8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fb9:	85 d2                	test   %edx,%edx
+  800fbb:	75 ec                	jne    800fa9 <strtol+0x48>
+        s++;
+  800fbd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fc1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fc6:	eb e1                	jmp    800fa9 <strtol+0x48>
+        s += 2;
+  800fc8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fcc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fd1:	eb d6                	jmp    800fa9 <strtol+0x48>
+            dig -= '0';
+  800fd3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fd6:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fda:	41 39 d0             	cmp    %edx,%r8d
+  800fdd:	7d 21                	jge    801000 <strtol+0x9f>
+        val = val * base + dig;
+  800fdf:	49 0f af c1          	imul   %r9,%rax
+  800fe3:	0f b6 c9             	movzbl %cl,%ecx
+  800fe6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fe9:	48 83 c7 01          	add    $0x1,%rdi
+  800fed:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ff1:	80 f9 39             	cmp    $0x39,%cl
+  800ff4:	76 dd                	jbe    800fd3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ff6:	80 f9 7b             	cmp    $0x7b,%cl
+  800ff9:	77 05                	ja     801000 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ffb:	83 e9 57             	sub    $0x57,%ecx
+  800ffe:	eb d6                	jmp    800fd6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801000:	4d 85 d2             	test   %r10,%r10
+  801003:	74 03                	je     801008 <strtol+0xa7>
+  801005:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801008:	48 89 c2             	mov    %rax,%rdx
+  80100b:	48 f7 da             	neg    %rdx
+  80100e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801012:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801016:	c3                   	ret
+
+0000000000801017 <strrev>:
+
+void
+strrev(char *str)
+{
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+  80101b:	53                   	push   %rbx
+  80101c:	48 83 ec 08          	sub    $0x8,%rsp
+  801020:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801023:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  80102a:	00 00 00 
+  80102d:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80102f:	83 e8 01             	sub    $0x1,%eax
+  801032:	85 c0                	test   %eax,%eax
+  801034:	7e 22                	jle    801058 <strrev+0x41>
+  801036:	48 98                	cltq
+  801038:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80103d:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801041:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801045:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801049:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80104c:	48 83 c2 01          	add    $0x1,%rdx
+  801050:	48 83 e8 01          	sub    $0x1,%rax
+  801054:	39 c2                	cmp    %eax,%edx
+  801056:	7c e5                	jl     80103d <strrev+0x26>
+	}
+}
+  801058:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105c:	c9                   	leave
+  80105d:	c3                   	ret
+
+000000000080105e <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80105e:	85 d2                	test   %edx,%edx
+  801060:	0f 84 80 00 00 00    	je     8010e6 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+  80106a:	53                   	push   %rbx
+  80106b:	48 83 ec 08          	sub    $0x8,%rsp
+  80106f:	49 89 f2             	mov    %rsi,%r10
+  801072:	41 89 d3             	mov    %edx,%r11d
+  801075:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801078:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80107d:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801080:	eb 20                	jmp    8010a2 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801082:	41 89 f1             	mov    %esi,%r9d
+  801085:	83 c2 30             	add    $0x30,%edx
+  801088:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80108b:	89 f8                	mov    %edi,%eax
+  80108d:	99                   	cltd
+  80108e:	f7 f9                	idiv   %ecx
+  801090:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801092:	85 c0                	test   %eax,%eax
+  801094:	74 2e                	je     8010c4 <itoa+0x66>
+  801096:	83 c6 01             	add    $0x1,%esi
+  801099:	49 83 c0 01          	add    $0x1,%r8
+  80109d:	44 39 cb             	cmp    %r9d,%ebx
+  8010a0:	7e 15                	jle    8010b7 <itoa+0x59>
+		digit = sum % base;
+  8010a2:	89 f8                	mov    %edi,%eax
+  8010a4:	99                   	cltd
+  8010a5:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8010a7:	83 fa 09             	cmp    $0x9,%edx
+  8010aa:	7e d6                	jle    801082 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8010ac:	41 89 f1             	mov    %esi,%r9d
+  8010af:	83 c2 37             	add    $0x37,%edx
+  8010b2:	41 88 10             	mov    %dl,(%r8)
+  8010b5:	eb d4                	jmp    80108b <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8010b7:	41 83 eb 01          	sub    $0x1,%r11d
+  8010bb:	45 39 cb             	cmp    %r9d,%r11d
+  8010be:	75 04                	jne    8010c4 <itoa+0x66>
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	75 28                	jne    8010ec <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8010c4:	4d 63 c9             	movslq %r9d,%r9
+  8010c7:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8010cc:	4c 89 d7             	mov    %r10,%rdi
+  8010cf:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  8010d6:	00 00 00 
+  8010d9:	ff d0                	call   *%rax
+	return 0;
+  8010db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e4:	c9                   	leave
+  8010e5:	c3                   	ret
+		return -1;
+  8010e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010eb:	c3                   	ret
+		return -1;
+  8010ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8010f1:	eb ed                	jmp    8010e0 <itoa+0x82>
+
+00000000008010f3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	53                   	push   %rbx
+  8010f8:	48 89 fa             	mov    %rdi,%rdx
+  8010fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801108:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110d:	be 00 00 00 00       	mov    $0x0,%esi
+  801112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801118:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80111a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111e:	c9                   	leave
+  80111f:	c3                   	ret
+
+0000000000801120 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801120:	55                   	push   %rbp
+  801121:	48 89 e5             	mov    %rsp,%rbp
+  801124:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801125:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113e:	be 00 00 00 00       	mov    $0x0,%esi
+  801143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801149:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80114b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+0000000000801151 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	53                   	push   %rbx
+  801156:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80115a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801162:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80117e:	48 85 c0             	test   %rax,%rax
+  801181:	7f 06                	jg     801189 <sys_env_destroy+0x38>
+}
+  801183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801189:	49 89 c0             	mov    %rax,%r8
+  80118c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801191:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  801198:	00 00 00 
+  80119b:	be 26 00 00 00       	mov    $0x26,%esi
+  8011a0:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  8011a7:	00 00 00 
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011af:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  8011b6:	00 00 00 
+  8011b9:	41 ff d1             	call   *%r9
+
+00000000008011bc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011bc:	55                   	push   %rbp
+  8011bd:	48 89 e5             	mov    %rsp,%rbp
+  8011c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011da:	be 00 00 00 00       	mov    $0x0,%esi
+  8011df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011eb:	c9                   	leave
+  8011ec:	c3                   	ret
+
+00000000008011ed <sys_yield>:
+
+void
+sys_yield(void) {
+  8011ed:	55                   	push   %rbp
+  8011ee:	48 89 e5             	mov    %rsp,%rbp
+  8011f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801216:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121c:	c9                   	leave
+  80121d:	c3                   	ret
+
+000000000080121e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	53                   	push   %rbx
+  801223:	48 89 fa             	mov    %rdi,%rdx
+  801226:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801229:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801235:	00 00 00 
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	49 89 f8             	mov    %rdi,%r8
+  801258:	48 89 d3             	mov    %rdx,%rbx
+  80125b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801263:	4c 89 c2             	mov    %r8,%rdx
+  801266:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801269:	be 00 00 00 00       	mov    $0x0,%esi
+  80126e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801274:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127a:	c9                   	leave
+  80127b:	c3                   	ret
+
+000000000080127c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80127c:	55                   	push   %rbp
+  80127d:	48 89 e5             	mov    %rsp,%rbp
+  801280:	53                   	push   %rbx
+  801281:	48 83 ec 08          	sub    $0x8,%rsp
+  801285:	89 f8                	mov    %edi,%eax
+  801287:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80128a:	48 63 f9             	movslq %ecx,%rdi
+  80128d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801290:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801295:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801298:	be 00 00 00 00       	mov    $0x0,%esi
+  80129d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a5:	48 85 c0             	test   %rax,%rax
+  8012a8:	7f 06                	jg     8012b0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ae:	c9                   	leave
+  8012af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b0:	49 89 c0             	mov    %rax,%r8
+  8012b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012b8:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  8012bf:	00 00 00 
+  8012c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c7:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  8012ce:	00 00 00 
+  8012d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d6:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  8012dd:	00 00 00 
+  8012e0:	41 ff d1             	call   *%r9
+
+00000000008012e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012e3:	55                   	push   %rbp
+  8012e4:	48 89 e5             	mov    %rsp,%rbp
+  8012e7:	53                   	push   %rbx
+  8012e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ec:	89 f8                	mov    %edi,%eax
+  8012ee:	49 89 f2             	mov    %rsi,%r10
+  8012f1:	48 89 cf             	mov    %rcx,%rdi
+  8012f4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012f7:	48 63 da             	movslq %edx,%rbx
+  8012fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801302:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801305:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801308:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130a:	48 85 c0             	test   %rax,%rax
+  80130d:	7f 06                	jg     801315 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80130f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801315:	49 89 c0             	mov    %rax,%r8
+  801318:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80131d:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  801324:	00 00 00 
+  801327:	be 26 00 00 00       	mov    $0x26,%esi
+  80132c:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  801333:	00 00 00 
+  801336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133b:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  801342:	00 00 00 
+  801345:	41 ff d1             	call   *%r9
+
+0000000000801348 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801348:	55                   	push   %rbp
+  801349:	48 89 e5             	mov    %rsp,%rbp
+  80134c:	53                   	push   %rbx
+  80134d:	48 83 ec 08          	sub    $0x8,%rsp
+  801351:	48 89 f1             	mov    %rsi,%rcx
+  801354:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801357:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801364:	be 00 00 00 00       	mov    $0x0,%esi
+  801369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801371:	48 85 c0             	test   %rax,%rax
+  801374:	7f 06                	jg     80137c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801376:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137a:	c9                   	leave
+  80137b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137c:	49 89 c0             	mov    %rax,%r8
+  80137f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801384:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  80138b:	00 00 00 
+  80138e:	be 26 00 00 00       	mov    $0x26,%esi
+  801393:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  80139a:	00 00 00 
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a2:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  8013a9:	00 00 00 
+  8013ac:	41 ff d1             	call   *%r9
+
+00000000008013af <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013af:	55                   	push   %rbp
+  8013b0:	48 89 e5             	mov    %rsp,%rbp
+  8013b3:	53                   	push   %rbx
+  8013b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013b8:	48 63 ce             	movslq %esi,%rcx
+  8013bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013be:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013da:	48 85 c0             	test   %rax,%rax
+  8013dd:	7f 06                	jg     8013e5 <sys_env_set_status+0x36>
+}
+  8013df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e5:	49 89 c0             	mov    %rax,%r8
+  8013e8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013ed:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  8013f4:	00 00 00 
+  8013f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013fc:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  801403:	00 00 00 
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  801412:	00 00 00 
+  801415:	41 ff d1             	call   *%r9
+
+0000000000801418 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801418:	55                   	push   %rbp
+  801419:	48 89 e5             	mov    %rsp,%rbp
+  80141c:	53                   	push   %rbx
+  80141d:	48 83 ec 08          	sub    $0x8,%rsp
+  801421:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801424:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801427:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801431:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801436:	be 00 00 00 00       	mov    $0x0,%esi
+  80143b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801441:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801443:	48 85 c0             	test   %rax,%rax
+  801446:	7f 06                	jg     80144e <sys_env_set_trapframe+0x36>
+}
+  801448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144c:	c9                   	leave
+  80144d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144e:	49 89 c0             	mov    %rax,%r8
+  801451:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801456:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  80145d:	00 00 00 
+  801460:	be 26 00 00 00       	mov    $0x26,%esi
+  801465:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  80146c:	00 00 00 
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  80147b:	00 00 00 
+  80147e:	41 ff d1             	call   *%r9
+
+0000000000801481 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801481:	55                   	push   %rbp
+  801482:	48 89 e5             	mov    %rsp,%rbp
+  801485:	53                   	push   %rbx
+  801486:	48 83 ec 08          	sub    $0x8,%rsp
+  80148a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80148d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801490:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ac:	48 85 c0             	test   %rax,%rax
+  8014af:	7f 06                	jg     8014b7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b5:	c9                   	leave
+  8014b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b7:	49 89 c0             	mov    %rax,%r8
+  8014ba:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014bf:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  8014c6:	00 00 00 
+  8014c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ce:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  8014d5:	00 00 00 
+  8014d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dd:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  8014e4:	00 00 00 
+  8014e7:	41 ff d1             	call   *%r9
+
+00000000008014ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014ea:	55                   	push   %rbp
+  8014eb:	48 89 e5             	mov    %rsp,%rbp
+  8014ee:	53                   	push   %rbx
+  8014ef:	89 f8                	mov    %edi,%eax
+  8014f1:	49 89 f1             	mov    %rsi,%r9
+  8014f4:	48 89 d3             	mov    %rdx,%rbx
+  8014f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014fa:	49 63 f0             	movslq %r8d,%rsi
+  8014fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801500:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801505:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801508:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150e:	cd 30                	int    $0x30
+}
+  801510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+0000000000801516 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 83 ec 08          	sub    $0x8,%rsp
+  80151f:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801522:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801525:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 06                	jg     80154a <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154a:	49 89 c0             	mov    %rax,%r8
+  80154d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801552:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  801559:	00 00 00 
+  80155c:	be 26 00 00 00       	mov    $0x26,%esi
+  801561:	48 bf c7 45 80 00 00 	movabs $0x8045c7,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	49 b9 7b 01 80 00 00 	movabs $0x80017b,%r9
+  801577:	00 00 00 
+  80157a:	41 ff d1             	call   *%r9
+
+000000000080157d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801581:	ba 00 00 00 00       	mov    $0x0,%edx
+  801586:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  80158d:	00 00 00 
+  801590:	ff d0                	call   *%rax
+}
+  801592:	5d                   	pop    %rbp
+  801593:	c3                   	ret
+
+0000000000801594 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801599:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80159e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c3:	c9                   	leave
+  8015c4:	c3                   	ret
+
+00000000008015c5 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8015c5:	55                   	push   %rbp
+  8015c6:	48 89 e5             	mov    %rsp,%rbp
+  8015c9:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8015ca:	48 63 ce             	movslq %esi,%rcx
+  8015cd:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015eb:	cd 30                	int    $0x30
+}
+  8015ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f1:	c9                   	leave
+  8015f2:	c3                   	ret
+
+00000000008015f3 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8015f3:	55                   	push   %rbp
+  8015f4:	48 89 e5             	mov    %rsp,%rbp
+  8015f7:	53                   	push   %rbx
+  8015f8:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8015fb:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ff:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	53                   	push   %rbx
+  801626:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801629:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80162c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801631:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801644:	cd 30                	int    $0x30
+}
+  801646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164a:	c9                   	leave
+  80164b:	c3                   	ret
+
+000000000080164c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80164c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801653:	ff ff ff 
+  801656:	48 01 f8             	add    %rdi,%rax
+  801659:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80165d:	c3                   	ret
+
+000000000080165e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80165e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801665:	ff ff ff 
+  801668:	48 01 f8             	add    %rdi,%rax
+  80166b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80166f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801675:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801679:	c3                   	ret
+
+000000000080167a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	41 57                	push   %r15
+  801680:	41 56                	push   %r14
+  801682:	41 55                	push   %r13
+  801684:	41 54                	push   %r12
+  801686:	53                   	push   %rbx
+  801687:	48 83 ec 08          	sub    $0x8,%rsp
+  80168b:	49 89 ff             	mov    %rdi,%r15
+  80168e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801693:	49 bd a6 3a 80 00 00 	movabs $0x803aa6,%r13
+  80169a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80169d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016a3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016a6:	48 89 df             	mov    %rbx,%rdi
+  8016a9:	41 ff d5             	call   *%r13
+  8016ac:	83 e0 04             	and    $0x4,%eax
+  8016af:	74 17                	je     8016c8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016b1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016b8:	4c 39 f3             	cmp    %r14,%rbx
+  8016bb:	75 e6                	jne    8016a3 <fd_alloc+0x29>
+  8016bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016c3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016c8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016cb:	48 83 c4 08          	add    $0x8,%rsp
+  8016cf:	5b                   	pop    %rbx
+  8016d0:	41 5c                	pop    %r12
+  8016d2:	41 5d                	pop    %r13
+  8016d4:	41 5e                	pop    %r14
+  8016d6:	41 5f                	pop    %r15
+  8016d8:	5d                   	pop    %rbp
+  8016d9:	c3                   	ret
+
+00000000008016da <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016da:	83 ff 1f             	cmp    $0x1f,%edi
+  8016dd:	77 39                	ja     801718 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016df:	55                   	push   %rbp
+  8016e0:	48 89 e5             	mov    %rsp,%rbp
+  8016e3:	41 54                	push   %r12
+  8016e5:	53                   	push   %rbx
+  8016e6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016e9:	48 63 df             	movslq %edi,%rbx
+  8016ec:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016f3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016f7:	48 89 df             	mov    %rbx,%rdi
+  8016fa:	48 b8 a6 3a 80 00 00 	movabs $0x803aa6,%rax
+  801701:	00 00 00 
+  801704:	ff d0                	call   *%rax
+  801706:	a8 04                	test   $0x4,%al
+  801708:	74 14                	je     80171e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80170a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801713:	5b                   	pop    %rbx
+  801714:	41 5c                	pop    %r12
+  801716:	5d                   	pop    %rbp
+  801717:	c3                   	ret
+        return -E_INVAL;
+  801718:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80171d:	c3                   	ret
+        return -E_INVAL;
+  80171e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801723:	eb ee                	jmp    801713 <fd_lookup+0x39>
+
+0000000000801725 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801725:	55                   	push   %rbp
+  801726:	48 89 e5             	mov    %rsp,%rbp
+  801729:	41 54                	push   %r12
+  80172b:	53                   	push   %rbx
+  80172c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80172f:	48 b8 80 46 80 00 00 	movabs $0x804680,%rax
+  801736:	00 00 00 
+  801739:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801740:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801743:	39 3b                	cmp    %edi,(%rbx)
+  801745:	74 47                	je     80178e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801747:	48 83 c0 08          	add    $0x8,%rax
+  80174b:	48 8b 18             	mov    (%rax),%rbx
+  80174e:	48 85 db             	test   %rbx,%rbx
+  801751:	75 f0                	jne    801743 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801753:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80175a:	00 00 00 
+  80175d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801763:	89 fa                	mov    %edi,%edx
+  801765:	48 bf d8 45 80 00 00 	movabs $0x8045d8,%rdi
+  80176c:	00 00 00 
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  80177b:	00 00 00 
+  80177e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801780:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801785:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801789:	5b                   	pop    %rbx
+  80178a:	41 5c                	pop    %r12
+  80178c:	5d                   	pop    %rbp
+  80178d:	c3                   	ret
+            return 0;
+  80178e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801793:	eb f0                	jmp    801785 <dev_lookup+0x60>
+
+0000000000801795 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	41 55                	push   %r13
+  80179b:	41 54                	push   %r12
+  80179d:	53                   	push   %rbx
+  80179e:	48 83 ec 18          	sub    $0x18,%rsp
+  8017a2:	48 89 fb             	mov    %rdi,%rbx
+  8017a5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017a8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017af:	ff ff ff 
+  8017b2:	48 01 df             	add    %rbx,%rdi
+  8017b5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017b9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017bd:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  8017c4:	00 00 00 
+  8017c7:	ff d0                	call   *%rax
+  8017c9:	41 89 c5             	mov    %eax,%r13d
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 06                	js     8017d6 <fd_close+0x41>
+  8017d0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017d4:	74 1a                	je     8017f0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017d6:	45 84 e4             	test   %r12b,%r12b
+  8017d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017de:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017e2:	44 89 e8             	mov    %r13d,%eax
+  8017e5:	48 83 c4 18          	add    $0x18,%rsp
+  8017e9:	5b                   	pop    %rbx
+  8017ea:	41 5c                	pop    %r12
+  8017ec:	41 5d                	pop    %r13
+  8017ee:	5d                   	pop    %rbp
+  8017ef:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017f0:	8b 3b                	mov    (%rbx),%edi
+  8017f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017f6:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  8017fd:	00 00 00 
+  801800:	ff d0                	call   *%rax
+  801802:	41 89 c5             	mov    %eax,%r13d
+  801805:	85 c0                	test   %eax,%eax
+  801807:	78 1b                	js     801824 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801809:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80180d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801811:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801817:	48 85 c0             	test   %rax,%rax
+  80181a:	74 08                	je     801824 <fd_close+0x8f>
+  80181c:	48 89 df             	mov    %rbx,%rdi
+  80181f:	ff d0                	call   *%rax
+  801821:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801824:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801829:	48 89 de             	mov    %rbx,%rsi
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801831:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+    return res;
+  80183d:	eb a3                	jmp    8017e2 <fd_close+0x4d>
+
+000000000080183f <close>:
+
+int
+close(int fdnum) {
+  80183f:	55                   	push   %rbp
+  801840:	48 89 e5             	mov    %rsp,%rbp
+  801843:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801847:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80184b:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801852:	00 00 00 
+  801855:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 15                	js     801870 <close+0x31>
+
+    return fd_close(fd, 1);
+  80185b:	be 01 00 00 00       	mov    $0x1,%esi
+  801860:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801864:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  80186b:	00 00 00 
+  80186e:	ff d0                	call   *%rax
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+
+0000000000801872 <close_all>:
+
+void
+close_all(void) {
+  801872:	55                   	push   %rbp
+  801873:	48 89 e5             	mov    %rsp,%rbp
+  801876:	41 54                	push   %r12
+  801878:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801879:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187e:	49 bc 3f 18 80 00 00 	movabs $0x80183f,%r12
+  801885:	00 00 00 
+  801888:	89 df                	mov    %ebx,%edi
+  80188a:	41 ff d4             	call   *%r12
+  80188d:	83 c3 01             	add    $0x1,%ebx
+  801890:	83 fb 20             	cmp    $0x20,%ebx
+  801893:	75 f3                	jne    801888 <close_all+0x16>
+}
+  801895:	5b                   	pop    %rbx
+  801896:	41 5c                	pop    %r12
+  801898:	5d                   	pop    %rbp
+  801899:	c3                   	ret
+
+000000000080189a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80189a:	55                   	push   %rbp
+  80189b:	48 89 e5             	mov    %rsp,%rbp
+  80189e:	41 57                	push   %r15
+  8018a0:	41 56                	push   %r14
+  8018a2:	41 55                	push   %r13
+  8018a4:	41 54                	push   %r12
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ab:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018b2:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  8018b9:	00 00 00 
+  8018bc:	ff d0                	call   *%rax
+  8018be:	89 c3                	mov    %eax,%ebx
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	0f 88 b8 00 00 00    	js     801980 <dup+0xe6>
+    close(newfdnum);
+  8018c8:	44 89 e7             	mov    %r12d,%edi
+  8018cb:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  8018d2:	00 00 00 
+  8018d5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018d7:	4d 63 ec             	movslq %r12d,%r13
+  8018da:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018e1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018e5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018e9:	4c 89 ff             	mov    %r15,%rdi
+  8018ec:	49 be 5e 16 80 00 00 	movabs $0x80165e,%r14
+  8018f3:	00 00 00 
+  8018f6:	41 ff d6             	call   *%r14
+  8018f9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018fc:	4c 89 ef             	mov    %r13,%rdi
+  8018ff:	41 ff d6             	call   *%r14
+  801902:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801905:	48 89 df             	mov    %rbx,%rdi
+  801908:	48 b8 a6 3a 80 00 00 	movabs $0x803aa6,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801914:	a8 04                	test   $0x4,%al
+  801916:	74 2b                	je     801943 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801918:	41 89 c1             	mov    %eax,%r9d
+  80191b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801921:	4c 89 f1             	mov    %r14,%rcx
+  801924:	ba 00 00 00 00       	mov    $0x0,%edx
+  801929:	48 89 de             	mov    %rbx,%rsi
+  80192c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801931:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  801938:	00 00 00 
+  80193b:	ff d0                	call   *%rax
+  80193d:	89 c3                	mov    %eax,%ebx
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 4e                	js     801991 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801943:	4c 89 ff             	mov    %r15,%rdi
+  801946:	48 b8 a6 3a 80 00 00 	movabs $0x803aa6,%rax
+  80194d:	00 00 00 
+  801950:	ff d0                	call   *%rax
+  801952:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801955:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80195b:	4c 89 e9             	mov    %r13,%rcx
+  80195e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801963:	4c 89 fe             	mov    %r15,%rsi
+  801966:	bf 00 00 00 00       	mov    $0x0,%edi
+  80196b:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  801972:	00 00 00 
+  801975:	ff d0                	call   *%rax
+  801977:	89 c3                	mov    %eax,%ebx
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 14                	js     801991 <dup+0xf7>
+
+    return newfdnum;
+  80197d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801980:	89 d8                	mov    %ebx,%eax
+  801982:	48 83 c4 18          	add    $0x18,%rsp
+  801986:	5b                   	pop    %rbx
+  801987:	41 5c                	pop    %r12
+  801989:	41 5d                	pop    %r13
+  80198b:	41 5e                	pop    %r14
+  80198d:	41 5f                	pop    %r15
+  80198f:	5d                   	pop    %rbp
+  801990:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801991:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801996:	4c 89 ee             	mov    %r13,%rsi
+  801999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199e:	49 bc 48 13 80 00 00 	movabs $0x801348,%r12
+  8019a5:	00 00 00 
+  8019a8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019b0:	4c 89 f6             	mov    %r14,%rsi
+  8019b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b8:	41 ff d4             	call   *%r12
+    return res;
+  8019bb:	eb c3                	jmp    801980 <dup+0xe6>
+
+00000000008019bd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	41 56                	push   %r14
+  8019c3:	41 55                	push   %r13
+  8019c5:	41 54                	push   %r12
+  8019c7:	53                   	push   %rbx
+  8019c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8019cc:	89 fb                	mov    %edi,%ebx
+  8019ce:	49 89 f4             	mov    %rsi,%r12
+  8019d1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d8:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 4c                	js     801a34 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019e8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019ec:	41 8b 3e             	mov    (%r14),%edi
+  8019ef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f3:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  8019fa:	00 00 00 
+  8019fd:	ff d0                	call   *%rax
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	78 35                	js     801a38 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a03:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a07:	83 e0 03             	and    $0x3,%eax
+  801a0a:	83 f8 01             	cmp    $0x1,%eax
+  801a0d:	74 2d                	je     801a3c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a13:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a17:	48 85 c0             	test   %rax,%rax
+  801a1a:	74 56                	je     801a72 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a1c:	4c 89 ea             	mov    %r13,%rdx
+  801a1f:	4c 89 e6             	mov    %r12,%rsi
+  801a22:	4c 89 f7             	mov    %r14,%rdi
+  801a25:	ff d0                	call   *%rax
+}
+  801a27:	48 83 c4 10          	add    $0x10,%rsp
+  801a2b:	5b                   	pop    %rbx
+  801a2c:	41 5c                	pop    %r12
+  801a2e:	41 5d                	pop    %r13
+  801a30:	41 5e                	pop    %r14
+  801a32:	5d                   	pop    %rbp
+  801a33:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a34:	48 98                	cltq
+  801a36:	eb ef                	jmp    801a27 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a38:	48 98                	cltq
+  801a3a:	eb eb                	jmp    801a27 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a3c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a43:	00 00 00 
+  801a46:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a4c:	89 da                	mov    %ebx,%edx
+  801a4e:	48 bf 39 46 80 00 00 	movabs $0x804639,%rdi
+  801a55:	00 00 00 
+  801a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5d:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  801a64:	00 00 00 
+  801a67:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a69:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a70:	eb b5                	jmp    801a27 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a72:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a79:	eb ac                	jmp    801a27 <read+0x6a>
+
+0000000000801a7b <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	41 56                	push   %r14
+  801a81:	41 55                	push   %r13
+  801a83:	41 54                	push   %r12
+  801a85:	53                   	push   %rbx
+  801a86:	48 83 ec 10          	sub    $0x10,%rsp
+  801a8a:	89 fb                	mov    %edi,%ebx
+  801a8c:	49 89 f4             	mov    %rsi,%r12
+  801a8f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a92:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a96:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 41                	js     801ae7 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aa6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aaa:	41 8b 3e             	mov    (%r14),%edi
+  801aad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ab1:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801ab8:	00 00 00 
+  801abb:	ff d0                	call   *%rax
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 35                	js     801af6 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ac1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ac5:	83 e0 03             	and    $0x3,%eax
+  801ac8:	83 f8 01             	cmp    $0x1,%eax
+  801acb:	74 2d                	je     801afa <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801acd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ad1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ad5:	48 85 c0             	test   %rax,%rax
+  801ad8:	74 56                	je     801b30 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801ada:	4c 89 ea             	mov    %r13,%rdx
+  801add:	4c 89 e6             	mov    %r12,%rsi
+  801ae0:	4c 89 f7             	mov    %r14,%rdi
+  801ae3:	ff d0                	call   *%rax
+  801ae5:	eb 02                	jmp    801ae9 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ae7:	48 98                	cltq
+}
+  801ae9:	48 83 c4 10          	add    $0x10,%rsp
+  801aed:	5b                   	pop    %rbx
+  801aee:	41 5c                	pop    %r12
+  801af0:	41 5d                	pop    %r13
+  801af2:	41 5e                	pop    %r14
+  801af4:	5d                   	pop    %rbp
+  801af5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801af6:	48 98                	cltq
+  801af8:	eb ef                	jmp    801ae9 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801afa:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b01:	00 00 00 
+  801b04:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b0a:	89 da                	mov    %ebx,%edx
+  801b0c:	48 bf f8 45 80 00 00 	movabs $0x8045f8,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  801b22:	00 00 00 
+  801b25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b27:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b2e:	eb b9                	jmp    801ae9 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b30:	4c 89 ea             	mov    %r13,%rdx
+  801b33:	4c 89 e6             	mov    %r12,%rsi
+  801b36:	89 df                	mov    %ebx,%edi
+  801b38:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	eb a3                	jmp    801ae9 <readmap+0x6e>
+
+0000000000801b46 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b46:	55                   	push   %rbp
+  801b47:	48 89 e5             	mov    %rsp,%rbp
+  801b4a:	41 57                	push   %r15
+  801b4c:	41 56                	push   %r14
+  801b4e:	41 55                	push   %r13
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b57:	48 85 d2             	test   %rdx,%rdx
+  801b5a:	74 54                	je     801bb0 <readn+0x6a>
+  801b5c:	41 89 fd             	mov    %edi,%r13d
+  801b5f:	49 89 f6             	mov    %rsi,%r14
+  801b62:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b65:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b6a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b6f:	49 bf bd 19 80 00 00 	movabs $0x8019bd,%r15
+  801b76:	00 00 00 
+  801b79:	4c 89 e2             	mov    %r12,%rdx
+  801b7c:	48 29 f2             	sub    %rsi,%rdx
+  801b7f:	4c 01 f6             	add    %r14,%rsi
+  801b82:	44 89 ef             	mov    %r13d,%edi
+  801b85:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 20                	js     801bac <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b8c:	01 c3                	add    %eax,%ebx
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	74 08                	je     801b9a <readn+0x54>
+  801b92:	48 63 f3             	movslq %ebx,%rsi
+  801b95:	4c 39 e6             	cmp    %r12,%rsi
+  801b98:	72 df                	jb     801b79 <readn+0x33>
+    }
+    return res;
+  801b9a:	48 63 c3             	movslq %ebx,%rax
+}
+  801b9d:	48 83 c4 08          	add    $0x8,%rsp
+  801ba1:	5b                   	pop    %rbx
+  801ba2:	41 5c                	pop    %r12
+  801ba4:	41 5d                	pop    %r13
+  801ba6:	41 5e                	pop    %r14
+  801ba8:	41 5f                	pop    %r15
+  801baa:	5d                   	pop    %rbp
+  801bab:	c3                   	ret
+        if (inc < 0) return inc;
+  801bac:	48 98                	cltq
+  801bae:	eb ed                	jmp    801b9d <readn+0x57>
+    int inc = 1, res = 0;
+  801bb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb5:	eb e3                	jmp    801b9a <readn+0x54>
+
+0000000000801bb7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	41 56                	push   %r14
+  801bbd:	41 55                	push   %r13
+  801bbf:	41 54                	push   %r12
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 83 ec 10          	sub    $0x10,%rsp
+  801bc6:	89 fb                	mov    %edi,%ebx
+  801bc8:	49 89 f4             	mov    %rsi,%r12
+  801bcb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd2:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	78 47                	js     801c29 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801be2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801be6:	41 8b 3e             	mov    (%r14),%edi
+  801be9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bed:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801bf4:	00 00 00 
+  801bf7:	ff d0                	call   *%rax
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 30                	js     801c2d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bfd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c02:	74 2d                	je     801c31 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c08:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c0c:	48 85 c0             	test   %rax,%rax
+  801c0f:	74 56                	je     801c67 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c11:	4c 89 ea             	mov    %r13,%rdx
+  801c14:	4c 89 e6             	mov    %r12,%rsi
+  801c17:	4c 89 f7             	mov    %r14,%rdi
+  801c1a:	ff d0                	call   *%rax
+}
+  801c1c:	48 83 c4 10          	add    $0x10,%rsp
+  801c20:	5b                   	pop    %rbx
+  801c21:	41 5c                	pop    %r12
+  801c23:	41 5d                	pop    %r13
+  801c25:	41 5e                	pop    %r14
+  801c27:	5d                   	pop    %rbp
+  801c28:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c29:	48 98                	cltq
+  801c2b:	eb ef                	jmp    801c1c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c2d:	48 98                	cltq
+  801c2f:	eb eb                	jmp    801c1c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c31:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c38:	00 00 00 
+  801c3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c41:	89 da                	mov    %ebx,%edx
+  801c43:	48 bf 55 46 80 00 00 	movabs $0x804655,%rdi
+  801c4a:	00 00 00 
+  801c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c52:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  801c59:	00 00 00 
+  801c5c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c5e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c65:	eb b5                	jmp    801c1c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c67:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c6e:	eb ac                	jmp    801c1c <write+0x65>
+
+0000000000801c70 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c70:	55                   	push   %rbp
+  801c71:	48 89 e5             	mov    %rsp,%rbp
+  801c74:	53                   	push   %rbx
+  801c75:	48 83 ec 18          	sub    $0x18,%rsp
+  801c79:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c7f:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 0c                	js     801c9b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c93:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9f:	c9                   	leave
+  801ca0:	c3                   	ret
+
+0000000000801ca1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	41 55                	push   %r13
+  801ca7:	41 54                	push   %r12
+  801ca9:	53                   	push   %rbx
+  801caa:	48 83 ec 18          	sub    $0x18,%rsp
+  801cae:	89 fb                	mov    %edi,%ebx
+  801cb0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cb7:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 38                	js     801cff <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ccb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ccf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cd3:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801cda:	00 00 00 
+  801cdd:	ff d0                	call   *%rax
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 1c                	js     801cff <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ce8:	74 20                	je     801d0a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cee:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801cf2:	48 85 c0             	test   %rax,%rax
+  801cf5:	74 47                	je     801d3e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cf7:	44 89 e6             	mov    %r12d,%esi
+  801cfa:	4c 89 ef             	mov    %r13,%rdi
+  801cfd:	ff d0                	call   *%rax
+}
+  801cff:	48 83 c4 18          	add    $0x18,%rsp
+  801d03:	5b                   	pop    %rbx
+  801d04:	41 5c                	pop    %r12
+  801d06:	41 5d                	pop    %r13
+  801d08:	5d                   	pop    %rbp
+  801d09:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d0a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d11:	00 00 00 
+  801d14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d1a:	89 da                	mov    %ebx,%edx
+  801d1c:	48 bf 18 46 80 00 00 	movabs $0x804618,%rdi
+  801d23:	00 00 00 
+  801d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2b:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  801d32:	00 00 00 
+  801d35:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d3c:	eb c1                	jmp    801cff <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d3e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d43:	eb ba                	jmp    801cff <ftruncate+0x5e>
+
+0000000000801d45 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	41 54                	push   %r12
+  801d4b:	53                   	push   %rbx
+  801d4c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d50:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d57:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801d5e:	00 00 00 
+  801d61:	ff d0                	call   *%rax
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 4e                	js     801db5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d67:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d6b:	41 8b 3c 24          	mov    (%r12),%edi
+  801d6f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d73:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801d7a:	00 00 00 
+  801d7d:	ff d0                	call   *%rax
+  801d7f:	85 c0                	test   %eax,%eax
+  801d81:	78 32                	js     801db5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d87:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d8c:	74 30                	je     801dbe <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d8e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d91:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d98:	00 00 00 
+    stat->st_isdir = 0;
+  801d9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801da2:	00 00 00 
+    stat->st_dev = dev;
+  801da5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dac:	48 89 de             	mov    %rbx,%rsi
+  801daf:	4c 89 e7             	mov    %r12,%rdi
+  801db2:	ff 50 30             	call   *0x30(%rax)
+}
+  801db5:	48 83 c4 10          	add    $0x10,%rsp
+  801db9:	5b                   	pop    %rbx
+  801dba:	41 5c                	pop    %r12
+  801dbc:	5d                   	pop    %rbp
+  801dbd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dbe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dc3:	eb f0                	jmp    801db5 <fstat+0x70>
+
+0000000000801dc5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801dc5:	55                   	push   %rbp
+  801dc6:	48 89 e5             	mov    %rsp,%rbp
+  801dc9:	41 54                	push   %r12
+  801dcb:	53                   	push   %rbx
+  801dcc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd4:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+  801de0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 25                	js     801e0b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801de6:	4c 89 e6             	mov    %r12,%rsi
+  801de9:	89 c7                	mov    %eax,%edi
+  801deb:	48 b8 45 1d 80 00 00 	movabs $0x801d45,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dfa:	89 df                	mov    %ebx,%edi
+  801dfc:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+
+    return res;
+  801e08:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e0b:	89 d8                	mov    %ebx,%eax
+  801e0d:	5b                   	pop    %rbx
+  801e0e:	41 5c                	pop    %r12
+  801e10:	5d                   	pop    %rbp
+  801e11:	c3                   	ret
+
+0000000000801e12 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 54                	push   %r12
+  801e18:	53                   	push   %rbx
+  801e19:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1d:	48 89 fb             	mov    %rdi,%rbx
+  801e20:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e23:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e27:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e2c:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	78 1f                	js     801e5b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801e3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e40:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801e44:	48 85 c0             	test   %rax,%rax
+  801e47:	74 1b                	je     801e64 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801e49:	4c 89 e6             	mov    %r12,%rsi
+  801e4c:	48 89 df             	mov    %rbx,%rdi
+  801e4f:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e58:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e5b:	48 83 c4 10          	add    $0x10,%rsp
+  801e5f:	5b                   	pop    %rbx
+  801e60:	41 5c                	pop    %r12
+  801e62:	5d                   	pop    %rbp
+  801e63:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e64:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e69:	eb f0                	jmp    801e5b <create_snapshot+0x49>
+
+0000000000801e6b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801e6b:	55                   	push   %rbp
+  801e6c:	48 89 e5             	mov    %rsp,%rbp
+  801e6f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e73:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e77:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e7c:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801e83:	00 00 00 
+  801e86:	ff d0                	call   *%rax
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 1e                	js     801eaa <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e90:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e94:	48 85 d2             	test   %rdx,%rdx
+  801e97:	74 13                	je     801eac <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9e:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+        return -E_NOT_SUPP;
+  801eac:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eb1:	eb f7                	jmp    801eaa <print_snapshot_list+0x3f>
+
+0000000000801eb3 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801eb3:	55                   	push   %rbp
+  801eb4:	48 89 e5             	mov    %rsp,%rbp
+  801eb7:	53                   	push   %rbx
+  801eb8:	48 83 ec 18          	sub    $0x18,%rsp
+  801ebc:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ebf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ec3:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ec8:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 1c                	js     801ef4 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801ed8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801edc:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801ee0:	48 85 c0             	test   %rax,%rax
+  801ee3:	74 15                	je     801efa <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801ee5:	48 89 df             	mov    %rbx,%rdi
+  801ee8:	ff d0                	call   *%rax
+    if (res < 0) {
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ef4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef8:	c9                   	leave
+  801ef9:	c3                   	ret
+        return -E_NOT_SUPP;
+  801efa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eff:	eb f3                	jmp    801ef4 <accept_snapshot+0x41>
+
+0000000000801f01 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	53                   	push   %rbx
+  801f06:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f11:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f16:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 1c                	js     801f42 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f2a:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801f2e:	48 85 c0             	test   %rax,%rax
+  801f31:	74 15                	je     801f48 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801f33:	48 89 df             	mov    %rbx,%rdi
+  801f36:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f4d:	eb f3                	jmp    801f42 <delete_snapshot+0x41>
+
+0000000000801f4f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801f4f:	55                   	push   %rbp
+  801f50:	48 89 e5             	mov    %rsp,%rbp
+  801f53:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f5b:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f60:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 14                	js     801f84 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f74:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f78:	48 85 d2             	test   %rdx,%rdx
+  801f7b:	74 09                	je     801f86 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f82:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f8b:	eb f7                	jmp    801f84 <gc_snapshots+0x35>
+
+0000000000801f8d <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	41 56                	push   %r14
+  801f93:	41 55                	push   %r13
+  801f95:	41 54                	push   %r12
+  801f97:	53                   	push   %rbx
+  801f98:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9c:	48 89 fb             	mov    %rdi,%rbx
+  801f9f:	49 89 f4             	mov    %rsi,%r12
+  801fa2:	49 89 d5             	mov    %rdx,%r13
+  801fa5:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fa8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fac:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fb1:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 1b                	js     801fdc <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801fc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801fc9:	48 85 c0             	test   %rax,%rax
+  801fcc:	74 1b                	je     801fe9 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801fce:	4c 89 f1             	mov    %r14,%rcx
+  801fd1:	4c 89 ea             	mov    %r13,%rdx
+  801fd4:	4c 89 e6             	mov    %r12,%rsi
+  801fd7:	48 89 df             	mov    %rbx,%rdi
+  801fda:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fdc:	48 83 c4 10          	add    $0x10,%rsp
+  801fe0:	5b                   	pop    %rbx
+  801fe1:	41 5c                	pop    %r12
+  801fe3:	41 5d                	pop    %r13
+  801fe5:	41 5e                	pop    %r14
+  801fe7:	5d                   	pop    %rbp
+  801fe8:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fe9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fee:	eb ec                	jmp    801fdc <diff_snapshots+0x4f>
+
+0000000000801ff0 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+  801ff4:	41 55                	push   %r13
+  801ff6:	41 54                	push   %r12
+  801ff8:	53                   	push   %rbx
+  801ff9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ffd:	48 89 fb             	mov    %rdi,%rbx
+  802000:	49 89 f4             	mov    %rsi,%r12
+  802003:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802006:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80200a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80200f:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 18                	js     802037 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80201f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802023:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802027:	48 85 c0             	test   %rax,%rax
+  80202a:	74 16                	je     802042 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80202c:	4c 89 ea             	mov    %r13,%rdx
+  80202f:	4c 89 e6             	mov    %r12,%rsi
+  802032:	48 89 df             	mov    %rbx,%rdi
+  802035:	ff d0                	call   *%rax
+
+    return res;
+}
+  802037:	48 83 c4 18          	add    $0x18,%rsp
+  80203b:	5b                   	pop    %rbx
+  80203c:	41 5c                	pop    %r12
+  80203e:	41 5d                	pop    %r13
+  802040:	5d                   	pop    %rbp
+  802041:	c3                   	ret
+        return -E_NOT_SUPP;
+  802042:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802047:	eb ee                	jmp    802037 <send_snapshot+0x47>
+
+0000000000802049 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802049:	55                   	push   %rbp
+  80204a:	48 89 e5             	mov    %rsp,%rbp
+  80204d:	53                   	push   %rbx
+  80204e:	48 83 ec 18          	sub    $0x18,%rsp
+  802052:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802055:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802059:	bf 66 00 00 00       	mov    $0x66,%edi
+  80205e:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	78 12                	js     802080 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80206e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802072:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802076:	48 85 c0             	test   %rax,%rax
+  802079:	74 0b                	je     802086 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80207b:	48 89 df             	mov    %rbx,%rdi
+  80207e:	ff d0                	call   *%rax
+
+    return res;
+}
+  802080:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802084:	c9                   	leave
+  802085:	c3                   	ret
+        return -E_NOT_SUPP;
+  802086:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80208b:	eb f3                	jmp    802080 <receive_snapshot+0x37>
+
+000000000080208d <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80208d:	55                   	push   %rbp
+  80208e:	48 89 e5             	mov    %rsp,%rbp
+  802091:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802095:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802099:	bf 66 00 00 00       	mov    $0x66,%edi
+  80209e:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  8020a5:	00 00 00 
+  8020a8:	ff d0                	call   *%rax
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 17                	js     8020c5 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8020ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020b2:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8020b9:	48 85 d2             	test   %rdx,%rdx
+  8020bc:	74 09                	je     8020c7 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020c7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020cc:	eb f7                	jmp    8020c5 <free_space_bytes+0x38>
+
+00000000008020ce <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020d6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020da:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020df:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 17                	js     802106 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8020ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020f3:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8020fa:	48 85 d2             	test   %rdx,%rdx
+  8020fd:	74 09                	je     802108 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802104:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+        return -E_NOT_SUPP;
+  802108:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80210d:	eb f7                	jmp    802106 <busy_space_bytes+0x38>
+
+000000000080210f <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80210f:	55                   	push   %rbp
+  802110:	48 89 e5             	mov    %rsp,%rbp
+  802113:	41 54                	push   %r12
+  802115:	53                   	push   %rbx
+  802116:	48 83 ec 10          	sub    $0x10,%rsp
+  80211a:	89 fb                	mov    %edi,%ebx
+  80211c:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80211f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802123:	bf 66 00 00 00       	mov    $0x66,%edi
+  802128:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 17                	js     80214f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80213c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802143:	48 85 c0             	test   %rax,%rax
+  802146:	74 10                	je     802158 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802148:	4c 89 e6             	mov    %r12,%rsi
+  80214b:	89 df                	mov    %ebx,%edi
+  80214d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80214f:	48 83 c4 10          	add    $0x10,%rsp
+  802153:	5b                   	pop    %rbx
+  802154:	41 5c                	pop    %r12
+  802156:	5d                   	pop    %rbp
+  802157:	c3                   	ret
+        return -E_NOT_SUPP;
+  802158:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80215d:	eb f0                	jmp    80214f <snapshots_space+0x40>
+
+000000000080215f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80215f:	55                   	push   %rbp
+  802160:	48 89 e5             	mov    %rsp,%rbp
+  802163:	41 55                	push   %r13
+  802165:	41 54                	push   %r12
+  802167:	53                   	push   %rbx
+  802168:	48 83 ec 08          	sub    $0x8,%rsp
+  80216c:	41 89 fd             	mov    %edi,%r13d
+  80216f:	48 89 f3             	mov    %rsi,%rbx
+  802172:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802175:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80217c:	00 00 00 
+  80217f:	83 38 00             	cmpl   $0x0,(%rax)
+  802182:	74 57                	je     8021db <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802184:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80218a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80218f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802196:	00 00 00 
+  802199:	44 89 ee             	mov    %r13d,%esi
+  80219c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8021a3:	00 00 00 
+  8021a6:	8b 38                	mov    (%rax),%edi
+  8021a8:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  8021af:	00 00 00 
+  8021b2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8021b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021b9:	4c 89 e2             	mov    %r12,%rdx
+  8021bc:	48 89 de             	mov    %rbx,%rsi
+  8021bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c4:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+}
+  8021d0:	48 83 c4 08          	add    $0x8,%rsp
+  8021d4:	5b                   	pop    %rbx
+  8021d5:	41 5c                	pop    %r12
+  8021d7:	41 5d                	pop    %r13
+  8021d9:	5d                   	pop    %rbp
+  8021da:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021e0:	48 b8 a7 3f 80 00 00 	movabs $0x803fa7,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8021f3:	00 00 
+  8021f5:	eb 8d                	jmp    802184 <fsipc_region+0x25>
+
+00000000008021f7 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8021f7:	55                   	push   %rbp
+  8021f8:	48 89 e5             	mov    %rsp,%rbp
+  8021fb:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8021ff:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802206:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802207:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80220b:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+}
+  802217:	c9                   	leave
+  802218:	c3                   	ret
+
+0000000000802219 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802219:	85 ff                	test   %edi,%edi
+  80221b:	78 6d                	js     80228a <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	41 54                	push   %r12
+  802223:	53                   	push   %rbx
+  802224:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802227:	48 85 f6             	test   %rsi,%rsi
+  80222a:	74 57                	je     802283 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80222c:	89 f8                	mov    %edi,%eax
+  80222e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802235:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802237:	be 00 00 00 00       	mov    $0x0,%esi
+  80223c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802241:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 2d                	js     80227e <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802251:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802258:	00 00 00 
+  80225b:	49 63 14 24          	movslq (%r12),%rdx
+  80225f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802266:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80226b:	48 89 df             	mov    %rbx,%rdi
+  80226e:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80227a:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80227e:	5b                   	pop    %rbx
+  80227f:	41 5c                	pop    %r12
+  802281:	5d                   	pop    %rbp
+  802282:	c3                   	ret
+        return -E_INVAL;
+  802283:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802288:	eb f4                	jmp    80227e <devfile_df_snapshots+0x65>
+  80228a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80228f:	c3                   	ret
+
+0000000000802290 <devfile_df_busy>:
+devfile_df_busy() {
+  802290:	55                   	push   %rbp
+  802291:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802294:	be 00 00 00 00       	mov    $0x0,%esi
+  802299:	bf 11 00 00 00       	mov    $0x11,%edi
+  80229e:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8022a5:	00 00 00 
+  8022a8:	ff d0                	call   *%rax
+}
+  8022aa:	5d                   	pop    %rbp
+  8022ab:	c3                   	ret
+
+00000000008022ac <devfile_df_free>:
+devfile_df_free() {
+  8022ac:	55                   	push   %rbp
+  8022ad:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8022b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8022ba:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8022c1:	00 00 00 
+  8022c4:	ff d0                	call   *%rax
+}
+  8022c6:	5d                   	pop    %rbp
+  8022c7:	c3                   	ret
+
+00000000008022c8 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8022c8:	55                   	push   %rbp
+  8022c9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8022cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022d6:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8022dd:	00 00 00 
+  8022e0:	ff d0                	call   *%rax
+}
+  8022e2:	5d                   	pop    %rbp
+  8022e3:	c3                   	ret
+
+00000000008022e4 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8022e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ed:	bf 09 00 00 00       	mov    $0x9,%edi
+  8022f2:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022fe:	85 c0                	test   %eax,%eax
+  802300:	ba 00 00 00 00       	mov    $0x0,%edx
+  802305:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802308:	5d                   	pop    %rbp
+  802309:	c3                   	ret
+
+000000000080230a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80230a:	55                   	push   %rbp
+  80230b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80230e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802315:	00 00 00 
+  802318:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80231b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80231d:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802320:	be 00 00 00 00       	mov    $0x0,%esi
+  802325:	bf 02 00 00 00       	mov    $0x2,%edi
+  80232a:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+}
+  802336:	5d                   	pop    %rbp
+  802337:	c3                   	ret
+
+0000000000802338 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802338:	55                   	push   %rbp
+  802339:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80233c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80233f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802346:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802348:	be 00 00 00 00       	mov    $0x0,%esi
+  80234d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802352:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+}
+  80235e:	5d                   	pop    %rbp
+  80235f:	c3                   	ret
+
+0000000000802360 <devfile_write>:
+    if (!fd || !buf) {
+  802360:	48 85 ff             	test   %rdi,%rdi
+  802363:	0f 84 c1 00 00 00    	je     80242a <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	41 57                	push   %r15
+  80236f:	41 56                	push   %r14
+  802371:	41 55                	push   %r13
+  802373:	41 54                	push   %r12
+  802375:	53                   	push   %rbx
+  802376:	48 83 ec 18          	sub    $0x18,%rsp
+  80237a:	49 89 ff             	mov    %rdi,%r15
+  80237d:	49 89 f5             	mov    %rsi,%r13
+  802380:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802383:	48 85 f6             	test   %rsi,%rsi
+  802386:	0f 84 95 00 00 00    	je     802421 <devfile_write+0xc1>
+    while (n) {
+  80238c:	48 85 d2             	test   %rdx,%rdx
+  80238f:	0f 84 83 00 00 00    	je     802418 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802395:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80239c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8023a3:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8023a6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8023ab:	49 39 dc             	cmp    %rbx,%r12
+  8023ae:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8023b2:	48 89 da             	mov    %rbx,%rdx
+  8023b5:	4c 89 ee             	mov    %r13,%rsi
+  8023b8:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8023bf:	00 00 00 
+  8023c2:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8023d2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8023d5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8023d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023de:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023e3:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+        if (write < 0) {
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 21                	js     802414 <devfile_write+0xb4>
+        buf += write;
+  8023f3:	48 63 d0             	movslq %eax,%rdx
+  8023f6:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8023f9:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8023fc:	49 29 d4             	sub    %rdx,%r12
+  8023ff:	75 a5                	jne    8023a6 <devfile_write+0x46>
+    return totalWrite;
+  802401:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802405:	48 83 c4 18          	add    $0x18,%rsp
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	41 5d                	pop    %r13
+  80240e:	41 5e                	pop    %r14
+  802410:	41 5f                	pop    %r15
+  802412:	5d                   	pop    %rbp
+  802413:	c3                   	ret
+            return write;
+  802414:	48 98                	cltq
+  802416:	eb ed                	jmp    802405 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802418:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80241f:	eb e0                	jmp    802401 <devfile_write+0xa1>
+        return -E_INVAL;
+  802421:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802428:	eb db                	jmp    802405 <devfile_write+0xa5>
+  80242a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802431:	c3                   	ret
+
+0000000000802432 <devfile_read>:
+    if (!fd || !buf) {
+  802432:	48 85 ff             	test   %rdi,%rdi
+  802435:	0f 84 c0 00 00 00    	je     8024fb <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	41 57                	push   %r15
+  802441:	41 56                	push   %r14
+  802443:	41 55                	push   %r13
+  802445:	41 54                	push   %r12
+  802447:	53                   	push   %rbx
+  802448:	48 83 ec 18          	sub    $0x18,%rsp
+  80244c:	49 89 ff             	mov    %rdi,%r15
+  80244f:	49 89 f5             	mov    %rsi,%r13
+  802452:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802455:	48 85 f6             	test   %rsi,%rsi
+  802458:	0f 84 96 00 00 00    	je     8024f4 <devfile_read+0xc2>
+    while (n) {
+  80245e:	48 85 d2             	test   %rdx,%rdx
+  802461:	0f 84 87 00 00 00    	je     8024ee <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802467:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80246e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80246f:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802476:	00 00 00 
+  802479:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80247d:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802480:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802485:	49 39 c4             	cmp    %rax,%r12
+  802488:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80248c:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+  802495:	bf 03 00 00 00       	mov    $0x3,%edi
+  80249a:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	7e 37                	jle    8024e1 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8024aa:	48 63 d8             	movslq %eax,%rbx
+  8024ad:	48 89 da             	mov    %rbx,%rdx
+  8024b0:	4c 89 f6             	mov    %r14,%rsi
+  8024b3:	4c 89 ef             	mov    %r13,%rdi
+  8024b6:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+        buf += read;
+  8024c2:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8024c5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8024c9:	49 29 dc             	sub    %rbx,%r12
+  8024cc:	75 ab                	jne    802479 <devfile_read+0x47>
+  return totalRead;
+  8024ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024d2:	48 83 c4 18          	add    $0x18,%rsp
+  8024d6:	5b                   	pop    %rbx
+  8024d7:	41 5c                	pop    %r12
+  8024d9:	41 5d                	pop    %r13
+  8024db:	41 5e                	pop    %r14
+  8024dd:	41 5f                	pop    %r15
+  8024df:	5d                   	pop    %rbp
+  8024e0:	c3                   	ret
+            return read ? read : totalRead;
+  8024e1:	48 63 d0             	movslq %eax,%rdx
+  8024e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024e8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8024ec:	eb e4                	jmp    8024d2 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8024ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8024f2:	eb da                	jmp    8024ce <devfile_read+0x9c>
+        return E_INVAL;
+  8024f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024f9:	eb d7                	jmp    8024d2 <devfile_read+0xa0>
+  8024fb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802500:	c3                   	ret
+
+0000000000802501 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802501:	48 85 ff             	test   %rdi,%rdi
+  802504:	74 5f                	je     802565 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	53                   	push   %rbx
+  80250b:	48 83 ec 08          	sub    $0x8,%rsp
+  80250f:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802512:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+  80251e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802524:	77 45                	ja     80256b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802526:	48 89 de             	mov    %rbx,%rsi
+  802529:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802530:	00 00 00 
+  802533:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80253f:	be 00 00 00 00       	mov    $0x0,%esi
+  802544:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802549:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802555:	85 c0                	test   %eax,%eax
+  802557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80255f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802563:	c9                   	leave
+  802564:	c3                   	ret
+        return -E_INVAL;
+  802565:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80256a:	c3                   	ret
+        return -E_INVAL;
+  80256b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802570:	eb ed                	jmp    80255f <devfile_receive_snapshot+0x5e>
+
+0000000000802572 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	41 55                	push   %r13
+  802578:	41 54                	push   %r12
+  80257a:	53                   	push   %rbx
+  80257b:	48 83 ec 08          	sub    $0x8,%rsp
+  80257f:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802582:	48 85 f6             	test   %rsi,%rsi
+  802585:	0f 94 c0             	sete   %al
+  802588:	48 85 d2             	test   %rdx,%rdx
+  80258b:	0f 94 c2             	sete   %dl
+  80258e:	08 d0                	or     %dl,%al
+  802590:	0f 85 ad 00 00 00    	jne    802643 <devfile_send_snapshot+0xd1>
+  802596:	48 89 fb             	mov    %rdi,%rbx
+  802599:	49 89 f4             	mov    %rsi,%r12
+  80259c:	48 85 ff             	test   %rdi,%rdi
+  80259f:	0f 84 9e 00 00 00    	je     802643 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8025a5:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+  8025b1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025b7:	0f 87 8d 00 00 00    	ja     80264a <devfile_send_snapshot+0xd8>
+  8025bd:	4c 89 e7             	mov    %r12,%rdi
+  8025c0:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+  8025cc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8025d2:	77 7d                	ja     802651 <devfile_send_snapshot+0xdf>
+  8025d4:	4c 89 ef             	mov    %r13,%rdi
+  8025d7:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025e9:	77 6d                	ja     802658 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8025eb:	48 89 de             	mov    %rbx,%rsi
+  8025ee:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8025f5:	00 00 00 
+  8025f8:	48 bb f0 0b 80 00 00 	movabs $0x800bf0,%rbx
+  8025ff:	00 00 00 
+  802602:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802604:	4c 89 e6             	mov    %r12,%rsi
+  802607:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  80260e:	00 00 00 
+  802611:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802613:	4c 89 ee             	mov    %r13,%rsi
+  802616:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80261d:	00 00 00 
+  802620:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802622:	be 00 00 00 00       	mov    $0x0,%esi
+  802627:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80262c:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+}
+  802638:	48 83 c4 08          	add    $0x8,%rsp
+  80263c:	5b                   	pop    %rbx
+  80263d:	41 5c                	pop    %r12
+  80263f:	41 5d                	pop    %r13
+  802641:	5d                   	pop    %rbp
+  802642:	c3                   	ret
+        return -E_INVAL;
+  802643:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802648:	eb ee                	jmp    802638 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80264a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80264f:	eb e7                	jmp    802638 <devfile_send_snapshot+0xc6>
+  802651:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802656:	eb e0                	jmp    802638 <devfile_send_snapshot+0xc6>
+  802658:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80265d:	eb d9                	jmp    802638 <devfile_send_snapshot+0xc6>
+
+000000000080265f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80265f:	48 85 ff             	test   %rdi,%rdi
+  802662:	0f 84 41 01 00 00    	je     8027a9 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	41 57                	push   %r15
+  80266e:	41 56                	push   %r14
+  802670:	41 55                	push   %r13
+  802672:	41 54                	push   %r12
+  802674:	53                   	push   %rbx
+  802675:	48 83 ec 08          	sub    $0x8,%rsp
+  802679:	49 89 fc             	mov    %rdi,%r12
+  80267c:	49 89 f5             	mov    %rsi,%r13
+  80267f:	48 89 d3             	mov    %rdx,%rbx
+  802682:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802685:	48 85 f6             	test   %rsi,%rsi
+  802688:	0f 84 ff 00 00 00    	je     80278d <devfile_diff_snapshots+0x12e>
+  80268e:	48 85 d2             	test   %rdx,%rdx
+  802691:	0f 84 fd 00 00 00    	je     802794 <devfile_diff_snapshots+0x135>
+  802697:	48 85 c9             	test   %rcx,%rcx
+  80269a:	0f 84 f4 00 00 00    	je     802794 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8026a0:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  8026ac:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026b2:	0f 87 e3 00 00 00    	ja     80279b <devfile_diff_snapshots+0x13c>
+  8026b8:	4c 89 ef             	mov    %r13,%rdi
+  8026bb:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+  8026c7:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8026cd:	0f 87 cf 00 00 00    	ja     8027a2 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8026d3:	4c 89 e6             	mov    %r12,%rsi
+  8026d6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8026dd:	00 00 00 
+  8026e0:	4c 89 e7             	mov    %r12,%rdi
+  8026e3:	49 bf f0 0b 80 00 00 	movabs $0x800bf0,%r15
+  8026ea:	00 00 00 
+  8026ed:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8026f0:	4c 89 ee             	mov    %r13,%rsi
+  8026f3:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8026fa:	00 
+  8026fb:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8026fe:	48 8b 03             	mov    (%rbx),%rax
+  802701:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802708:	00 
+  802709:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80270d:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802714:	00 
+  802715:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802719:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802720:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802721:	be 00 00 00 00       	mov    $0x0,%esi
+  802726:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80272b:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802737:	85 c0                	test   %eax,%eax
+  802739:	78 43                	js     80277e <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80273b:	49 8b 04 24          	mov    (%r12),%rax
+  80273f:	48 89 03             	mov    %rax,(%rbx)
+  802742:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802747:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80274b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802750:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802754:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802759:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80275d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802761:	48 c1 e2 03          	shl    $0x3,%rdx
+  802765:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80276a:	4c 89 f7             	mov    %r14,%rdi
+  80276d:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  802774:	00 00 00 
+  802777:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802779:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80277e:	48 83 c4 08          	add    $0x8,%rsp
+  802782:	5b                   	pop    %rbx
+  802783:	41 5c                	pop    %r12
+  802785:	41 5d                	pop    %r13
+  802787:	41 5e                	pop    %r14
+  802789:	41 5f                	pop    %r15
+  80278b:	5d                   	pop    %rbp
+  80278c:	c3                   	ret
+        return -E_INVAL;
+  80278d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802792:	eb ea                	jmp    80277e <devfile_diff_snapshots+0x11f>
+  802794:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802799:	eb e3                	jmp    80277e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  80279b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027a0:	eb dc                	jmp    80277e <devfile_diff_snapshots+0x11f>
+  8027a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027a7:	eb d5                	jmp    80277e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8027a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027ae:	c3                   	ret
+
+00000000008027af <devfile_delete_snapshot>:
+    if (!name) {
+  8027af:	48 85 ff             	test   %rdi,%rdi
+  8027b2:	74 5f                	je     802813 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+  8027b8:	53                   	push   %rbx
+  8027b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8027c0:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027d2:	77 45                	ja     802819 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8027d4:	48 89 de             	mov    %rbx,%rsi
+  8027d7:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8027de:	00 00 00 
+  8027e1:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8027ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027f7:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802803:	85 c0                	test   %eax,%eax
+  802805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80280d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+        return -E_INVAL;
+  802813:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802818:	c3                   	ret
+        return -E_INVAL;
+  802819:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80281e:	eb ed                	jmp    80280d <devfile_delete_snapshot+0x5e>
+
+0000000000802820 <devfile_accept_snapshot>:
+    if (!name) {
+  802820:	48 85 ff             	test   %rdi,%rdi
+  802823:	74 5f                	je     802884 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802825:	55                   	push   %rbp
+  802826:	48 89 e5             	mov    %rsp,%rbp
+  802829:	53                   	push   %rbx
+  80282a:	48 83 ec 08          	sub    $0x8,%rsp
+  80282e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802831:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802843:	77 45                	ja     80288a <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802845:	48 89 de             	mov    %rbx,%rsi
+  802848:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80284f:	00 00 00 
+  802852:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80285e:	be 00 00 00 00       	mov    $0x0,%esi
+  802863:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802868:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802874:	85 c0                	test   %eax,%eax
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80287e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802882:	c9                   	leave
+  802883:	c3                   	ret
+        return -E_INVAL;
+  802884:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802889:	c3                   	ret
+        return -E_INVAL;
+  80288a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80288f:	eb ed                	jmp    80287e <devfile_accept_snapshot+0x5e>
+
+0000000000802891 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802891:	48 85 ff             	test   %rdi,%rdi
+  802894:	0f 84 9f 00 00 00    	je     802939 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  80289a:	55                   	push   %rbp
+  80289b:	48 89 e5             	mov    %rsp,%rbp
+  80289e:	41 54                	push   %r12
+  8028a0:	53                   	push   %rbx
+  8028a1:	48 89 fb             	mov    %rdi,%rbx
+  8028a4:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8028a7:	48 85 f6             	test   %rsi,%rsi
+  8028aa:	74 78                	je     802924 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8028ac:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028be:	77 6b                	ja     80292b <devfile_create_snapshot+0x9a>
+  8028c0:	4c 89 e7             	mov    %r12,%rdi
+  8028c3:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+  8028cf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028d5:	77 5b                	ja     802932 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8028d7:	48 89 de             	mov    %rbx,%rsi
+  8028da:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8028e1:	00 00 00 
+  8028e4:	48 bb f0 0b 80 00 00 	movabs $0x800bf0,%rbx
+  8028eb:	00 00 00 
+  8028ee:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8028f0:	4c 89 e6             	mov    %r12,%rsi
+  8028f3:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8028fa:	00 00 00 
+  8028fd:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8028ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802904:	bf 08 00 00 00       	mov    $0x8,%edi
+  802909:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802915:	85 c0                	test   %eax,%eax
+  802917:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80291f:	5b                   	pop    %rbx
+  802920:	41 5c                	pop    %r12
+  802922:	5d                   	pop    %rbp
+  802923:	c3                   	ret
+        return -E_INVAL;
+  802924:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802929:	eb f4                	jmp    80291f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80292b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802930:	eb ed                	jmp    80291f <devfile_create_snapshot+0x8e>
+  802932:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802937:	eb e6                	jmp    80291f <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802939:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80293e:	c3                   	ret
+
+000000000080293f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80293f:	55                   	push   %rbp
+  802940:	48 89 e5             	mov    %rsp,%rbp
+  802943:	41 54                	push   %r12
+  802945:	53                   	push   %rbx
+  802946:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802949:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80294c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802953:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802955:	be 00 00 00 00       	mov    $0x0,%esi
+  80295a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80295f:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802966:	00 00 00 
+  802969:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80296b:	85 c0                	test   %eax,%eax
+  80296d:	78 3d                	js     8029ac <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80296f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802976:	00 00 00 
+  802979:	4c 89 e6             	mov    %r12,%rsi
+  80297c:	48 89 df             	mov    %rbx,%rdi
+  80297f:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802986:	00 00 00 
+  802989:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80298b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802992:	00 
+  802993:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802999:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8029a0:	00 
+  8029a1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ac:	5b                   	pop    %rbx
+  8029ad:	41 5c                	pop    %r12
+  8029af:	5d                   	pop    %rbp
+  8029b0:	c3                   	ret
+
+00000000008029b1 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8029b1:	55                   	push   %rbp
+  8029b2:	48 89 e5             	mov    %rsp,%rbp
+  8029b5:	41 57                	push   %r15
+  8029b7:	41 56                	push   %r14
+  8029b9:	41 55                	push   %r13
+  8029bb:	41 54                	push   %r12
+  8029bd:	53                   	push   %rbx
+  8029be:	48 83 ec 38          	sub    $0x38,%rsp
+  8029c2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8029c6:	49 89 f5             	mov    %rsi,%r13
+  8029c9:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029cc:	48 89 f0             	mov    %rsi,%rax
+  8029cf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8029d4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8029d8:	75 4f                	jne    802a29 <devfile_readmap+0x78>
+  8029da:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029de:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8029e4:	75 1f                	jne    802a05 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  8029e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029ea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8029ee:	49 be a6 3a 80 00 00 	movabs $0x803aa6,%r14
+  8029f5:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8029f8:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8029ff:	0f 87 9d 00 00 00    	ja     802aa2 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802a05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a09:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802a0d:	4d 85 ff             	test   %r15,%r15
+  802a10:	0f 85 cf 00 00 00    	jne    802ae5 <devfile_readmap+0x134>
+  802a16:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802a1a:	48 83 c4 38          	add    $0x38,%rsp
+  802a1e:	5b                   	pop    %rbx
+  802a1f:	41 5c                	pop    %r12
+  802a21:	41 5d                	pop    %r13
+  802a23:	41 5e                	pop    %r14
+  802a25:	41 5f                	pop    %r15
+  802a27:	5d                   	pop    %rbp
+  802a28:	c3                   	ret
+    size_t totalRead = 0;
+  802a29:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802a30:	00 
+  802a31:	eb da                	jmp    802a0d <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a33:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a37:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a3a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802a41:	00 00 00 
+  802a44:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802a46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a4a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802a4e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a52:	4c 89 ee             	mov    %r13,%rsi
+  802a55:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a5a:	48 b8 5f 21 80 00 00 	movabs $0x80215f,%rax
+  802a61:	00 00 00 
+  802a64:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	7e a3                	jle    802a0d <devfile_readmap+0x5c>
+  802a6a:	48 98                	cltq
+  802a6c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a70:	72 9b                	jb     802a0d <devfile_readmap+0x5c>
+        buf += read;
+  802a72:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a75:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a78:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a7c:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a83:	75 88                	jne    802a0d <devfile_readmap+0x5c>
+  802a85:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a89:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a8f:	0f 85 78 ff ff ff    	jne    802a0d <devfile_readmap+0x5c>
+  802a95:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a9c:	0f 86 6b ff ff ff    	jbe    802a0d <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802aa2:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802aa8:	4d 39 e7             	cmp    %r12,%r15
+  802aab:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802aaf:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802ab6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802aba:	0f 84 73 ff ff ff    	je     802a33 <devfile_readmap+0x82>
+  802ac0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ac4:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802ac9:	41 ff d6             	call   *%r14
+  802acc:	a8 40                	test   $0x40,%al
+  802ace:	0f 85 39 ff ff ff    	jne    802a0d <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802ad4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802adb:	4c 39 e3             	cmp    %r12,%rbx
+  802ade:	72 e4                	jb     802ac4 <devfile_readmap+0x113>
+  802ae0:	e9 4e ff ff ff       	jmp    802a33 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ae5:	4c 89 fa             	mov    %r15,%rdx
+  802ae8:	4c 89 ee             	mov    %r13,%rsi
+  802aeb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802aef:	48 b8 32 24 80 00 00 	movabs $0x802432,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802afb:	48 85 c0             	test   %rax,%rax
+  802afe:	78 0c                	js     802b0c <devfile_readmap+0x15b>
+    return totalRead + read;
+  802b00:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b04:	48 01 f0             	add    %rsi,%rax
+  802b07:	e9 0e ff ff ff       	jmp    802a1a <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802b0c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b10:	48 85 f6             	test   %rsi,%rsi
+  802b13:	48 0f 45 c6          	cmovne %rsi,%rax
+  802b17:	e9 fe fe ff ff       	jmp    802a1a <devfile_readmap+0x69>
+
+0000000000802b1c <open>:
+open(const char *path, int mode) {
+  802b1c:	55                   	push   %rbp
+  802b1d:	48 89 e5             	mov    %rsp,%rbp
+  802b20:	41 55                	push   %r13
+  802b22:	41 54                	push   %r12
+  802b24:	53                   	push   %rbx
+  802b25:	48 83 ec 18          	sub    $0x18,%rsp
+  802b29:	49 89 fc             	mov    %rdi,%r12
+  802b2c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b2f:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+  802b3b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b41:	0f 87 8a 00 00 00    	ja     802bd1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b4b:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  802b52:	00 00 00 
+  802b55:	ff d0                	call   *%rax
+  802b57:	89 c3                	mov    %eax,%ebx
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	78 50                	js     802bad <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b5d:	4c 89 e6             	mov    %r12,%rsi
+  802b60:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802b67:	00 00 00 
+  802b6a:	48 89 df             	mov    %rbx,%rdi
+  802b6d:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b79:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b80:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b84:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b89:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802b90:	00 00 00 
+  802b93:	ff d0                	call   *%rax
+  802b95:	89 c3                	mov    %eax,%ebx
+  802b97:	85 c0                	test   %eax,%eax
+  802b99:	78 1f                	js     802bba <open+0x9e>
+    return fd2num(fd);
+  802b9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b9f:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+  802bab:	89 c3                	mov    %eax,%ebx
+}
+  802bad:	89 d8                	mov    %ebx,%eax
+  802baf:	48 83 c4 18          	add    $0x18,%rsp
+  802bb3:	5b                   	pop    %rbx
+  802bb4:	41 5c                	pop    %r12
+  802bb6:	41 5d                	pop    %r13
+  802bb8:	5d                   	pop    %rbp
+  802bb9:	c3                   	ret
+        fd_close(fd, 0);
+  802bba:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bc3:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+        return res;
+  802bcf:	eb dc                	jmp    802bad <open+0x91>
+        return -E_BAD_PATH;
+  802bd1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bd6:	eb d5                	jmp    802bad <open+0x91>
+
+0000000000802bd8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802bdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802be1:	bf 13 00 00 00       	mov    $0x13,%edi
+  802be6:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+}
+  802bf2:	5d                   	pop    %rbp
+  802bf3:	c3                   	ret
+
+0000000000802bf4 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802bf4:	55                   	push   %rbp
+  802bf5:	48 89 e5             	mov    %rsp,%rbp
+  802bf8:	41 55                	push   %r13
+  802bfa:	41 54                	push   %r12
+  802bfc:	53                   	push   %rbx
+  802bfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802c01:	48 89 fb             	mov    %rdi,%rbx
+  802c04:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802c07:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802c0a:	48 b8 a6 3a 80 00 00 	movabs $0x803aa6,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+  802c16:	41 89 c1             	mov    %eax,%r9d
+  802c19:	4d 89 e0             	mov    %r12,%r8
+  802c1c:	49 29 d8             	sub    %rbx,%r8
+  802c1f:	48 89 d9             	mov    %rbx,%rcx
+  802c22:	44 89 ea             	mov    %r13d,%edx
+  802c25:	48 89 de             	mov    %rbx,%rsi
+  802c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2d:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+}
+  802c39:	48 83 c4 08          	add    $0x8,%rsp
+  802c3d:	5b                   	pop    %rbx
+  802c3e:	41 5c                	pop    %r12
+  802c40:	41 5d                	pop    %r13
+  802c42:	5d                   	pop    %rbp
+  802c43:	c3                   	ret
+
+0000000000802c44 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802c44:	55                   	push   %rbp
+  802c45:	48 89 e5             	mov    %rsp,%rbp
+  802c48:	41 57                	push   %r15
+  802c4a:	41 56                	push   %r14
+  802c4c:	41 55                	push   %r13
+  802c4e:	41 54                	push   %r12
+  802c50:	53                   	push   %rbx
+  802c51:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802c58:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  802c5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802c60:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+  802c6c:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	0f 88 10 04 00 00    	js     80308a <spawn+0x446>
+  802c7a:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802c7c:	ba 00 02 00 00       	mov    $0x200,%edx
+  802c81:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802c88:	48 b8 46 1b 80 00 00 	movabs $0x801b46,%rax
+  802c8f:	00 00 00 
+  802c92:	ff d0                	call   *%rax
+  802c94:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802c96:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802c9b:	0f 85 85 02 00 00    	jne    802f26 <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802ca1:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802ca8:	ff ff 00 
+  802cab:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802cb2:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802cb9:	01 01 00 
+  802cbc:	48 39 d0             	cmp    %rdx,%rax
+  802cbf:	0f 85 9d 02 00 00    	jne    802f62 <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802cc5:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802ccc:	00 3e 00 
+  802ccf:	0f 85 8d 02 00 00    	jne    802f62 <spawn+0x31e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802cd5:	b8 08 00 00 00       	mov    $0x8,%eax
+  802cda:	cd 30                	int    $0x30
+  802cdc:	41 89 c6             	mov    %eax,%r14d
+  802cdf:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	0f 88 89 03 00 00    	js     803072 <spawn+0x42e>
+    envid_t child = res;
+  802ce9:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802cef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cf4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802cf8:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  802cfc:	48 c1 e0 04          	shl    $0x4,%rax
+  802d00:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802d07:	00 00 00 
+  802d0a:	48 01 c6             	add    %rax,%rsi
+  802d0d:	48 8b 06             	mov    (%rsi),%rax
+  802d10:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802d17:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802d1e:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802d25:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802d2c:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802d33:	48 29 c6             	sub    %rax,%rsi
+  802d36:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  802d3c:	89 c8                	mov    %ecx,%eax
+  802d3e:	c1 e8 03             	shr    $0x3,%eax
+  802d41:	89 c1                	mov    %eax,%ecx
+  802d43:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802d46:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  802d4d:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802d54:	49 8b 3f             	mov    (%r15),%rdi
+  802d57:	48 85 ff             	test   %rdi,%rdi
+  802d5a:	0f 84 41 06 00 00    	je     8033a1 <spawn+0x75d>
+  802d60:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  802d65:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  802d6b:	49 bc b2 0b 80 00 00 	movabs $0x800bb2,%r12
+  802d72:	00 00 00 
+  802d75:	41 ff d4             	call   *%r12
+  802d78:	4c 01 e8             	add    %r13,%rax
+  802d7b:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  802d7f:	48 89 da             	mov    %rbx,%rdx
+  802d82:	48 83 c3 01          	add    $0x1,%rbx
+  802d86:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  802d8b:	48 85 ff             	test   %rdi,%rdi
+  802d8e:	75 e5                	jne    802d75 <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802d90:	48 f7 d0             	not    %rax
+  802d93:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802d9a:	4d 89 e5             	mov    %r12,%r13
+  802d9d:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  802da1:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  802da8:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  802daf:	89 d0                	mov    %edx,%eax
+  802db1:	83 c0 01             	add    $0x1,%eax
+  802db4:	48 98                	cltq
+  802db6:	48 c1 e0 03          	shl    $0x3,%rax
+  802dba:	49 29 c5             	sub    %rax,%r13
+  802dbd:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802dc4:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  802dc8:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802dce:	0f 86 c3 05 00 00    	jbe    803397 <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802dd4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802dd9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802dde:	be 00 00 40 00       	mov    $0x400000,%esi
+  802de3:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  802dea:	00 00 00 
+  802ded:	ff d0                	call   *%rax
+  802def:	89 c3                	mov    %eax,%ebx
+  802df1:	85 c0                	test   %eax,%eax
+  802df3:	0f 88 67 02 00 00    	js     803060 <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  802df9:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  802e00:	85 d2                	test   %edx,%edx
+  802e02:	7e 54                	jle    802e58 <spawn+0x214>
+  802e04:	4c 89 fb             	mov    %r15,%rbx
+  802e07:	48 63 c2             	movslq %edx,%rax
+  802e0a:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802e0f:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802e16:	00 00 00 
+  802e19:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  802e20:	ff 
+  802e21:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802e25:	48 8b 33             	mov    (%rbx),%rsi
+  802e28:	4c 89 e7             	mov    %r12,%rdi
+  802e2b:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802e37:	48 8b 3b             	mov    (%rbx),%rdi
+  802e3a:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  802e41:	00 00 00 
+  802e44:	ff d0                	call   *%rax
+  802e46:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  802e4b:	49 83 c5 08          	add    $0x8,%r13
+  802e4f:	48 83 c3 08          	add    $0x8,%rbx
+  802e53:	4d 39 fd             	cmp    %r15,%r13
+  802e56:	75 b7                	jne    802e0f <spawn+0x1cb>
+    argv_store[argc] = 0;
+  802e58:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802e5f:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802e66:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802e67:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  802e6e:	0f 85 35 01 00 00    	jne    802fa9 <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802e74:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  802e7b:	00 00 00 
+  802e7e:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  802e85:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  802e8c:	ff 
+  802e8d:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802e91:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  802e98:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  802e9c:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802ea3:	00 00 00 
+  802ea6:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802ead:	ff 
+  802eae:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  802eb5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  802ebb:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  802ec1:	44 89 f2             	mov    %r14d,%edx
+  802ec4:	be 00 00 40 00       	mov    $0x400000,%esi
+  802ec9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ece:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  802ed5:	00 00 00 
+  802ed8:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  802eda:	48 bb 48 13 80 00 00 	movabs $0x801348,%rbx
+  802ee1:	00 00 00 
+  802ee4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802ee9:	be 00 00 40 00       	mov    $0x400000,%esi
+  802eee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef3:	ff d3                	call   *%rbx
+  802ef5:	85 c0                	test   %eax,%eax
+  802ef7:	78 eb                	js     802ee4 <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  802ef9:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802f00:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  802f07:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802f08:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802f0f:	00 
+  802f10:	0f 84 7e 03 00 00    	je     803294 <spawn+0x650>
+  802f16:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  802f1d:	00 00 00 00 
+  802f21:	e9 c0 01 00 00       	jmp    8030e6 <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802f26:	48 bf a0 46 80 00 00 	movabs $0x8046a0,%rdi
+  802f2d:	00 00 00 
+  802f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f35:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  802f3c:	00 00 00 
+  802f3f:	ff d2                	call   *%rdx
+        close(fd);
+  802f41:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802f47:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802f53:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  802f5a:	ff ff ff 
+  802f5d:	e9 28 01 00 00       	jmp    80308a <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802f62:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802f67:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802f6d:	48 bf a1 47 80 00 00 	movabs $0x8047a1,%rdi
+  802f74:	00 00 00 
+  802f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7c:	48 b9 cb 02 80 00 00 	movabs $0x8002cb,%rcx
+  802f83:	00 00 00 
+  802f86:	ff d1                	call   *%rcx
+        close(fd);
+  802f88:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  802f8e:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802f9a:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  802fa1:	ff ff ff 
+  802fa4:	e9 e1 00 00 00       	jmp    80308a <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802fa9:	48 b9 d0 46 80 00 00 	movabs $0x8046d0,%rcx
+  802fb0:	00 00 00 
+  802fb3:	48 ba bb 47 80 00 00 	movabs $0x8047bb,%rdx
+  802fba:	00 00 00 
+  802fbd:	be f0 00 00 00       	mov    $0xf0,%esi
+  802fc2:	48 bf d0 47 80 00 00 	movabs $0x8047d0,%rdi
+  802fc9:	00 00 00 
+  802fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd1:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  802fd8:	00 00 00 
+  802fdb:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  802fde:	89 c3                	mov    %eax,%ebx
+  802fe0:	89 c6                	mov    %eax,%esi
+  802fe2:	48 bf 00 47 80 00 00 	movabs $0x804700,%rdi
+  802fe9:	00 00 00 
+  802fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff1:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  802ff8:	00 00 00 
+  802ffb:	ff d2                	call   *%rdx
+            return res;
+  802ffd:	eb 61                	jmp    803060 <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  802fff:	89 c3                	mov    %eax,%ebx
+  803001:	89 c6                	mov    %eax,%esi
+  803003:	48 bf 28 47 80 00 00 	movabs $0x804728,%rdi
+  80300a:	00 00 00 
+  80300d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803012:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  803019:	00 00 00 
+  80301c:	ff d2                	call   *%rdx
+        return res;
+  80301e:	eb 40                	jmp    803060 <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  803020:	89 c3                	mov    %eax,%ebx
+  803022:	89 c6                	mov    %eax,%esi
+  803024:	48 bf dc 47 80 00 00 	movabs $0x8047dc,%rdi
+  80302b:	00 00 00 
+  80302e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803033:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  80303a:	00 00 00 
+  80303d:	ff d2                	call   *%rdx
+        return res;
+  80303f:	eb 1f                	jmp    803060 <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  803041:	89 c3                	mov    %eax,%ebx
+  803043:	89 c6                	mov    %eax,%esi
+  803045:	48 bf f9 47 80 00 00 	movabs $0x8047f9,%rdi
+  80304c:	00 00 00 
+  80304f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803054:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  80305b:	00 00 00 
+  80305e:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  803060:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803066:	48 b8 51 11 80 00 00 	movabs $0x801151,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+    close(fd);
+  803072:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803078:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  80307f:	00 00 00 
+  803082:	ff d0                	call   *%rax
+    return res;
+  803084:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  80308a:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803090:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803097:	5b                   	pop    %rbx
+  803098:	41 5c                	pop    %r12
+  80309a:	41 5d                	pop    %r13
+  80309c:	41 5e                	pop    %r14
+  80309e:	41 5f                	pop    %r15
+  8030a0:	5d                   	pop    %rbp
+  8030a1:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  8030a2:	89 c3                	mov    %eax,%ebx
+  8030a4:	89 c6                	mov    %eax,%esi
+  8030a6:	48 bf 50 47 80 00 00 	movabs $0x804750,%rdi
+  8030ad:	00 00 00 
+  8030b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b5:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  8030bc:	00 00 00 
+  8030bf:	ff d2                	call   *%rdx
+        return res;
+  8030c1:	eb 9d                	jmp    803060 <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8030c3:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  8030ca:	01 
+  8030cb:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  8030d2:	48 83 c3 38          	add    $0x38,%rbx
+  8030d6:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8030dd:	48 39 c1             	cmp    %rax,%rcx
+  8030e0:	0f 83 ae 01 00 00    	jae    803294 <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8030e6:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8030e9:	75 d8                	jne    8030c3 <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8030eb:	8b 43 04             	mov    0x4(%rbx),%eax
+  8030ee:	41 89 c6             	mov    %eax,%r14d
+  8030f1:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8030f5:	44 89 f2             	mov    %r14d,%edx
+  8030f8:	83 ca 04             	or     $0x4,%edx
+  8030fb:	a8 04                	test   $0x4,%al
+  8030fd:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803101:	44 89 f2             	mov    %r14d,%edx
+  803104:	83 ca 01             	or     $0x1,%edx
+  803107:	a8 01                	test   $0x1,%al
+  803109:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80310d:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  803111:	41 89 cc             	mov    %ecx,%r12d
+  803114:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803118:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  80311c:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  803120:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803126:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  80312c:	44 89 fe             	mov    %r15d,%esi
+  80312f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803135:	74 0f                	je     803146 <spawn+0x502>
+        va -= res;
+  803137:	48 63 fe             	movslq %esi,%rdi
+  80313a:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  80313d:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  803140:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  803143:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803146:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  80314d:	00 
+  80314e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803155:	49 89 f5             	mov    %rsi,%r13
+  803158:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  80315b:	49 39 d5             	cmp    %rdx,%r13
+  80315e:	73 23                	jae    803183 <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  803160:	4c 01 fa             	add    %r15,%rdx
+  803163:	48 29 f2             	sub    %rsi,%rdx
+  803166:	44 89 f1             	mov    %r14d,%ecx
+  803169:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  80316f:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  803176:	00 00 00 
+  803179:	ff d0                	call   *%rax
+        if (res < 0) {
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	0f 88 5b fe ff ff    	js     802fde <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  803183:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803188:	4c 89 ea             	mov    %r13,%rdx
+  80318b:	be 00 00 40 00       	mov    $0x400000,%esi
+  803190:	bf 00 00 00 00       	mov    $0x0,%edi
+  803195:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+    if (res < 0) {
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	0f 88 56 fe ff ff    	js     802fff <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  8031a9:	44 89 e6             	mov    %r12d,%esi
+  8031ac:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8031b2:	48 b8 70 1c 80 00 00 	movabs $0x801c70,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	0f 88 5a fe ff ff    	js     803020 <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  8031c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d1:	4d 85 ed             	test   %r13,%r13
+  8031d4:	74 48                	je     80321e <spawn+0x5da>
+  8031d6:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  8031dd:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  8031e3:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8031ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ef:	89 df                	mov    %ebx,%edi
+  8031f1:	48 b8 46 1b 80 00 00 	movabs $0x801b46,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+        if (res < 0) {
+  8031fd:	85 c0                	test   %eax,%eax
+  8031ff:	0f 88 3c fe ff ff    	js     803041 <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  803205:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  80320c:	00 
+  80320d:	41 89 c4             	mov    %eax,%r12d
+  803210:	48 98                	cltq
+  803212:	4c 39 e8             	cmp    %r13,%rax
+  803215:	72 cc                	jb     8031e3 <spawn+0x59f>
+  803217:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  80321e:	45 89 f1             	mov    %r14d,%r9d
+  803221:	41 80 c9 80          	or     $0x80,%r9b
+  803225:	4d 89 e8             	mov    %r13,%r8
+  803228:	4c 89 f9             	mov    %r15,%rcx
+  80322b:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803231:	be 00 00 40 00       	mov    $0x400000,%esi
+  803236:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323b:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+    if (res < 0) {
+  803247:	85 c0                	test   %eax,%eax
+  803249:	0f 88 53 fe ff ff    	js     8030a2 <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  80324f:	4c 89 ea             	mov    %r13,%rdx
+  803252:	be 00 00 40 00       	mov    $0x400000,%esi
+  803257:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325c:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+    if (res < 0) {
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	0f 89 53 fe ff ff    	jns    8030c3 <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  803270:	89 c3                	mov    %eax,%ebx
+  803272:	89 c6                	mov    %eax,%esi
+  803274:	48 bf 78 47 80 00 00 	movabs $0x804778,%rdi
+  80327b:	00 00 00 
+  80327e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803283:	48 ba cb 02 80 00 00 	movabs $0x8002cb,%rdx
+  80328a:	00 00 00 
+  80328d:	ff d2                	call   *%rdx
+        return res;
+  80328f:	e9 cc fd ff ff       	jmp    803060 <spawn+0x41c>
+    close(fd);
+  803294:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80329a:	48 b8 3f 18 80 00 00 	movabs $0x80183f,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8032a6:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8032ad:	48 bf f4 2b 80 00 00 	movabs $0x802bf4,%rdi
+  8032b4:	00 00 00 
+  8032b7:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 49                	js     803310 <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8032c7:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8032ce:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8032d4:	48 b8 18 14 80 00 00 	movabs $0x801418,%rax
+  8032db:	00 00 00 
+  8032de:	ff d0                	call   *%rax
+  8032e0:	85 c0                	test   %eax,%eax
+  8032e2:	78 59                	js     80333d <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8032e4:	be 02 00 00 00       	mov    $0x2,%esi
+  8032e9:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8032ef:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	78 6b                	js     80336a <spawn+0x726>
+    return child;
+  8032ff:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803305:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  80330b:	e9 7a fd ff ff       	jmp    80308a <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  803310:	89 c1                	mov    %eax,%ecx
+  803312:	48 ba 17 48 80 00 00 	movabs $0x804817,%rdx
+  803319:	00 00 00 
+  80331c:	be 84 00 00 00       	mov    $0x84,%esi
+  803321:	48 bf d0 47 80 00 00 	movabs $0x8047d0,%rdi
+  803328:	00 00 00 
+  80332b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803330:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  803337:	00 00 00 
+  80333a:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  80333d:	89 c1                	mov    %eax,%ecx
+  80333f:	48 ba 2e 48 80 00 00 	movabs $0x80482e,%rdx
+  803346:	00 00 00 
+  803349:	be 87 00 00 00       	mov    $0x87,%esi
+  80334e:	48 bf d0 47 80 00 00 	movabs $0x8047d0,%rdi
+  803355:	00 00 00 
+  803358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335d:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  803364:	00 00 00 
+  803367:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80336a:	89 c1                	mov    %eax,%ecx
+  80336c:	48 ba 48 48 80 00 00 	movabs $0x804848,%rdx
+  803373:	00 00 00 
+  803376:	be 8a 00 00 00       	mov    $0x8a,%esi
+  80337b:	48 bf d0 47 80 00 00 	movabs $0x8047d0,%rdi
+  803382:	00 00 00 
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338a:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  803391:	00 00 00 
+  803394:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803397:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  80339c:	e9 bf fc ff ff       	jmp    803060 <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8033a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8033a6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8033ab:	be 00 00 40 00       	mov    $0x400000,%esi
+  8033b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b5:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	89 c3                	mov    %eax,%ebx
+  8033c3:	85 c0                	test   %eax,%eax
+  8033c5:	0f 88 95 fc ff ff    	js     803060 <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8033cb:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8033d2:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8033d6:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  8033dd:	f8 ff 40 00 
+  8033e1:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8033e8:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8033ec:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  8033f2:	e9 61 fa ff ff       	jmp    802e58 <spawn+0x214>
+
+00000000008033f7 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8033f7:	55                   	push   %rbp
+  8033f8:	48 89 e5             	mov    %rsp,%rbp
+  8033fb:	48 83 ec 50          	sub    $0x50,%rsp
+  8033ff:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803403:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803407:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80340b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80340f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803416:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80341a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803422:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803426:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80342b:	eb 15                	jmp    803442 <spawnl+0x4b>
+  80342d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803431:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803435:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803439:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80343d:	74 1c                	je     80345b <spawnl+0x64>
+  80343f:	83 c1 01             	add    $0x1,%ecx
+  803442:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803445:	83 f8 2f             	cmp    $0x2f,%eax
+  803448:	77 e3                	ja     80342d <spawnl+0x36>
+  80344a:	89 c2                	mov    %eax,%edx
+  80344c:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803450:	4c 01 d2             	add    %r10,%rdx
+  803453:	83 c0 08             	add    $0x8,%eax
+  803456:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803459:	eb de                	jmp    803439 <spawnl+0x42>
+    const char *argv[argc + 2];
+  80345b:	8d 41 02             	lea    0x2(%rcx),%eax
+  80345e:	48 98                	cltq
+  803460:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803467:	00 
+  803468:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  80346c:	48 29 c4             	sub    %rax,%rsp
+  80346f:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803474:	4c 89 c0             	mov    %r8,%rax
+  803477:	48 c1 e8 03          	shr    $0x3,%rax
+  80347b:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80347f:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803486:	00 
+    argv[argc + 1] = NULL;
+  803487:	8d 41 01             	lea    0x1(%rcx),%eax
+  80348a:	48 98                	cltq
+  80348c:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803493:	00 
+    va_start(vl, arg0);
+  803494:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80349b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80349f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034a3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8034ab:	85 c9                	test   %ecx,%ecx
+  8034ad:	74 41                	je     8034f0 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8034af:	49 89 c1             	mov    %rax,%r9
+  8034b2:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8034b6:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8034b9:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8034be:	eb 1b                	jmp    8034db <spawnl+0xe4>
+  8034c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8034c4:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8034c8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8034cc:	48 8b 11             	mov    (%rcx),%rdx
+  8034cf:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8034d2:	48 83 c0 08          	add    $0x8,%rax
+  8034d6:	48 39 f0             	cmp    %rsi,%rax
+  8034d9:	74 15                	je     8034f0 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8034db:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8034de:	83 fa 2f             	cmp    $0x2f,%edx
+  8034e1:	77 dd                	ja     8034c0 <spawnl+0xc9>
+  8034e3:	89 d1                	mov    %edx,%ecx
+  8034e5:	4c 01 c9             	add    %r9,%rcx
+  8034e8:	83 c2 08             	add    $0x8,%edx
+  8034eb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8034ee:	eb dc                	jmp    8034cc <spawnl+0xd5>
+    return spawn(prog, argv);
+  8034f0:	4c 89 c6             	mov    %r8,%rsi
+  8034f3:	48 b8 44 2c 80 00 00 	movabs $0x802c44,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+}
+  8034ff:	c9                   	leave
+  803500:	c3                   	ret
+
+0000000000803501 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803501:	55                   	push   %rbp
+  803502:	48 89 e5             	mov    %rsp,%rbp
+  803505:	41 54                	push   %r12
+  803507:	53                   	push   %rbx
+  803508:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80350b:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80351a:	48 be 5f 48 80 00 00 	movabs $0x80485f,%rsi
+  803521:	00 00 00 
+  803524:	48 89 df             	mov    %rbx,%rdi
+  803527:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803533:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803538:	41 2b 04 24          	sub    (%r12),%eax
+  80353c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803542:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803549:	00 00 00 
+    stat->st_dev = &devpipe;
+  80354c:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803553:	00 00 00 
+  803556:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80355d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803562:	5b                   	pop    %rbx
+  803563:	41 5c                	pop    %r12
+  803565:	5d                   	pop    %rbp
+  803566:	c3                   	ret
+
+0000000000803567 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803567:	55                   	push   %rbp
+  803568:	48 89 e5             	mov    %rsp,%rbp
+  80356b:	41 54                	push   %r12
+  80356d:	53                   	push   %rbx
+  80356e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803571:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803576:	48 89 fe             	mov    %rdi,%rsi
+  803579:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357e:	49 bc 48 13 80 00 00 	movabs $0x801348,%r12
+  803585:	00 00 00 
+  803588:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80358b:	48 89 df             	mov    %rbx,%rdi
+  80358e:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803595:	00 00 00 
+  803598:	ff d0                	call   *%rax
+  80359a:	48 89 c6             	mov    %rax,%rsi
+  80359d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035a7:	41 ff d4             	call   *%r12
+}
+  8035aa:	5b                   	pop    %rbx
+  8035ab:	41 5c                	pop    %r12
+  8035ad:	5d                   	pop    %rbp
+  8035ae:	c3                   	ret
+
+00000000008035af <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035af:	55                   	push   %rbp
+  8035b0:	48 89 e5             	mov    %rsp,%rbp
+  8035b3:	41 57                	push   %r15
+  8035b5:	41 56                	push   %r14
+  8035b7:	41 55                	push   %r13
+  8035b9:	41 54                	push   %r12
+  8035bb:	53                   	push   %rbx
+  8035bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8035c0:	49 89 fc             	mov    %rdi,%r12
+  8035c3:	49 89 f5             	mov    %rsi,%r13
+  8035c6:	49 89 d7             	mov    %rdx,%r15
+  8035c9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035cd:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  8035d4:	00 00 00 
+  8035d7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035d9:	4d 85 ff             	test   %r15,%r15
+  8035dc:	0f 84 af 00 00 00    	je     803691 <devpipe_write+0xe2>
+  8035e2:	48 89 c3             	mov    %rax,%rbx
+  8035e5:	4c 89 f8             	mov    %r15,%rax
+  8035e8:	4d 89 ef             	mov    %r13,%r15
+  8035eb:	4c 01 e8             	add    %r13,%rax
+  8035ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035f2:	49 bd 50 12 80 00 00 	movabs $0x801250,%r13
+  8035f9:	00 00 00 
+            sys_yield();
+  8035fc:	49 be ed 11 80 00 00 	movabs $0x8011ed,%r14
+  803603:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803606:	8b 73 04             	mov    0x4(%rbx),%esi
+  803609:	48 63 ce             	movslq %esi,%rcx
+  80360c:	48 63 03             	movslq (%rbx),%rax
+  80360f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803615:	48 39 c1             	cmp    %rax,%rcx
+  803618:	72 2e                	jb     803648 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80361a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80361f:	48 89 da             	mov    %rbx,%rdx
+  803622:	be 00 10 00 00       	mov    $0x1000,%esi
+  803627:	4c 89 e7             	mov    %r12,%rdi
+  80362a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	74 66                	je     803697 <devpipe_write+0xe8>
+            sys_yield();
+  803631:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803634:	8b 73 04             	mov    0x4(%rbx),%esi
+  803637:	48 63 ce             	movslq %esi,%rcx
+  80363a:	48 63 03             	movslq (%rbx),%rax
+  80363d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803643:	48 39 c1             	cmp    %rax,%rcx
+  803646:	73 d2                	jae    80361a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803648:	41 0f b6 3f          	movzbl (%r15),%edi
+  80364c:	48 89 ca             	mov    %rcx,%rdx
+  80364f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803653:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80365a:	08 10 20 
+  80365d:	48 f7 e2             	mul    %rdx
+  803660:	48 c1 ea 06          	shr    $0x6,%rdx
+  803664:	48 89 d0             	mov    %rdx,%rax
+  803667:	48 c1 e0 09          	shl    $0x9,%rax
+  80366b:	48 29 d0             	sub    %rdx,%rax
+  80366e:	48 c1 e0 03          	shl    $0x3,%rax
+  803672:	48 29 c1             	sub    %rax,%rcx
+  803675:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80367a:	83 c6 01             	add    $0x1,%esi
+  80367d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803680:	49 83 c7 01          	add    $0x1,%r15
+  803684:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803688:	49 39 c7             	cmp    %rax,%r15
+  80368b:	0f 85 75 ff ff ff    	jne    803606 <devpipe_write+0x57>
+    return n;
+  803691:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803695:	eb 05                	jmp    80369c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803697:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80369c:	48 83 c4 18          	add    $0x18,%rsp
+  8036a0:	5b                   	pop    %rbx
+  8036a1:	41 5c                	pop    %r12
+  8036a3:	41 5d                	pop    %r13
+  8036a5:	41 5e                	pop    %r14
+  8036a7:	41 5f                	pop    %r15
+  8036a9:	5d                   	pop    %rbp
+  8036aa:	c3                   	ret
+
+00000000008036ab <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036ab:	55                   	push   %rbp
+  8036ac:	48 89 e5             	mov    %rsp,%rbp
+  8036af:	41 57                	push   %r15
+  8036b1:	41 56                	push   %r14
+  8036b3:	41 55                	push   %r13
+  8036b5:	41 54                	push   %r12
+  8036b7:	53                   	push   %rbx
+  8036b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8036bc:	49 89 fc             	mov    %rdi,%r12
+  8036bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036c7:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  8036ce:	00 00 00 
+  8036d1:	ff d0                	call   *%rax
+  8036d3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036d6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036dc:	49 bd 50 12 80 00 00 	movabs $0x801250,%r13
+  8036e3:	00 00 00 
+            sys_yield();
+  8036e6:	49 be ed 11 80 00 00 	movabs $0x8011ed,%r14
+  8036ed:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036f0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036f5:	74 7d                	je     803774 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036f7:	8b 03                	mov    (%rbx),%eax
+  8036f9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036fc:	75 26                	jne    803724 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036fe:	4d 85 ff             	test   %r15,%r15
+  803701:	75 77                	jne    80377a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803703:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803708:	48 89 da             	mov    %rbx,%rdx
+  80370b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803710:	4c 89 e7             	mov    %r12,%rdi
+  803713:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803716:	85 c0                	test   %eax,%eax
+  803718:	74 72                	je     80378c <devpipe_read+0xe1>
+            sys_yield();
+  80371a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80371d:	8b 03                	mov    (%rbx),%eax
+  80371f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803722:	74 df                	je     803703 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803724:	48 63 c8             	movslq %eax,%rcx
+  803727:	48 89 ca             	mov    %rcx,%rdx
+  80372a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80372e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803735:	08 10 20 
+  803738:	48 89 d0             	mov    %rdx,%rax
+  80373b:	48 f7 e6             	mul    %rsi
+  80373e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803742:	48 89 d0             	mov    %rdx,%rax
+  803745:	48 c1 e0 09          	shl    $0x9,%rax
+  803749:	48 29 d0             	sub    %rdx,%rax
+  80374c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803753:	00 
+  803754:	48 89 c8             	mov    %rcx,%rax
+  803757:	48 29 d0             	sub    %rdx,%rax
+  80375a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80375f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803763:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803767:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80376a:	49 83 c7 01          	add    $0x1,%r15
+  80376e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803772:	75 83                	jne    8036f7 <devpipe_read+0x4c>
+    return n;
+  803774:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803778:	eb 03                	jmp    80377d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80377a:	4c 89 f8             	mov    %r15,%rax
+}
+  80377d:	48 83 c4 18          	add    $0x18,%rsp
+  803781:	5b                   	pop    %rbx
+  803782:	41 5c                	pop    %r12
+  803784:	41 5d                	pop    %r13
+  803786:	41 5e                	pop    %r14
+  803788:	41 5f                	pop    %r15
+  80378a:	5d                   	pop    %rbp
+  80378b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	eb ea                	jmp    80377d <devpipe_read+0xd2>
+
+0000000000803793 <pipe>:
+pipe(int pfd[2]) {
+  803793:	55                   	push   %rbp
+  803794:	48 89 e5             	mov    %rsp,%rbp
+  803797:	41 55                	push   %r13
+  803799:	41 54                	push   %r12
+  80379b:	53                   	push   %rbx
+  80379c:	48 83 ec 18          	sub    $0x18,%rsp
+  8037a0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037a3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8037a7:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  8037ae:	00 00 00 
+  8037b1:	ff d0                	call   *%rax
+  8037b3:	89 c3                	mov    %eax,%ebx
+  8037b5:	85 c0                	test   %eax,%eax
+  8037b7:	0f 88 a0 01 00 00    	js     80395d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8037bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037c7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8037cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d0:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  8037d7:	00 00 00 
+  8037da:	ff d0                	call   *%rax
+  8037dc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037de:	85 c0                	test   %eax,%eax
+  8037e0:	0f 88 77 01 00 00    	js     80395d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037e6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037ea:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  8037f1:	00 00 00 
+  8037f4:	ff d0                	call   *%rax
+  8037f6:	89 c3                	mov    %eax,%ebx
+  8037f8:	85 c0                	test   %eax,%eax
+  8037fa:	0f 88 43 01 00 00    	js     803943 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803800:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803805:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80380a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80380e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803813:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+  80381f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803821:	85 c0                	test   %eax,%eax
+  803823:	0f 88 1a 01 00 00    	js     803943 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803829:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80382d:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803834:	00 00 00 
+  803837:	ff d0                	call   *%rax
+  803839:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80383c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803841:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803846:	48 89 c6             	mov    %rax,%rsi
+  803849:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384e:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  803855:	00 00 00 
+  803858:	ff d0                	call   *%rax
+  80385a:	89 c3                	mov    %eax,%ebx
+  80385c:	85 c0                	test   %eax,%eax
+  80385e:	0f 88 c5 00 00 00    	js     803929 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803864:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803868:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  80386f:	00 00 00 
+  803872:	ff d0                	call   *%rax
+  803874:	48 89 c1             	mov    %rax,%rcx
+  803877:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80387d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803883:	ba 00 00 00 00       	mov    $0x0,%edx
+  803888:	4c 89 ee             	mov    %r13,%rsi
+  80388b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803890:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	89 c3                	mov    %eax,%ebx
+  80389e:	85 c0                	test   %eax,%eax
+  8038a0:	78 6e                	js     803910 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8038a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038a7:	4c 89 ef             	mov    %r13,%rdi
+  8038aa:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+  8038b6:	83 f8 02             	cmp    $0x2,%eax
+  8038b9:	0f 85 ab 00 00 00    	jne    80396a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8038bf:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8038c6:	00 00 
+  8038c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038cc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8038ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038d2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038d9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038dd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038e3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038ea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038ee:	48 bb 4c 16 80 00 00 	movabs $0x80164c,%rbx
+  8038f5:	00 00 00 
+  8038f8:	ff d3                	call   *%rbx
+  8038fa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038fe:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803902:	ff d3                	call   *%rbx
+  803904:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803909:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80390e:	eb 4d                	jmp    80395d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803910:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803915:	4c 89 ee             	mov    %r13,%rsi
+  803918:	bf 00 00 00 00       	mov    $0x0,%edi
+  80391d:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803929:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80392e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803932:	bf 00 00 00 00       	mov    $0x0,%edi
+  803937:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  80393e:	00 00 00 
+  803941:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803943:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803948:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80394c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803951:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  803958:	00 00 00 
+  80395b:	ff d0                	call   *%rax
+}
+  80395d:	89 d8                	mov    %ebx,%eax
+  80395f:	48 83 c4 18          	add    $0x18,%rsp
+  803963:	5b                   	pop    %rbx
+  803964:	41 5c                	pop    %r12
+  803966:	41 5d                	pop    %r13
+  803968:	5d                   	pop    %rbp
+  803969:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80396a:	48 b9 78 48 80 00 00 	movabs $0x804878,%rcx
+  803971:	00 00 00 
+  803974:	48 ba bb 47 80 00 00 	movabs $0x8047bb,%rdx
+  80397b:	00 00 00 
+  80397e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803983:	48 bf 66 48 80 00 00 	movabs $0x804866,%rdi
+  80398a:	00 00 00 
+  80398d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803992:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  803999:	00 00 00 
+  80399c:	41 ff d0             	call   *%r8
+
+000000000080399f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80399f:	55                   	push   %rbp
+  8039a0:	48 89 e5             	mov    %rsp,%rbp
+  8039a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8039a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8039ab:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039b7:	85 c0                	test   %eax,%eax
+  8039b9:	78 35                	js     8039f0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8039bb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039bf:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+  8039cb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039dc:	48 b8 50 12 80 00 00 	movabs $0x801250,%rax
+  8039e3:	00 00 00 
+  8039e6:	ff d0                	call   *%rax
+  8039e8:	85 c0                	test   %eax,%eax
+  8039ea:	0f 94 c0             	sete   %al
+  8039ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8039f0:	c9                   	leave
+  8039f1:	c3                   	ret
+
+00000000008039f2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039f2:	48 89 f8             	mov    %rdi,%rax
+  8039f5:	48 c1 e8 27          	shr    $0x27,%rax
+  8039f9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803a00:	01 00 00 
+  803a03:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a07:	f6 c2 01             	test   $0x1,%dl
+  803a0a:	74 6d                	je     803a79 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a0c:	48 89 f8             	mov    %rdi,%rax
+  803a0f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a13:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803a1a:	01 00 00 
+  803a1d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a21:	f6 c2 01             	test   $0x1,%dl
+  803a24:	74 62                	je     803a88 <get_uvpt_entry+0x96>
+  803a26:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803a2d:	01 00 00 
+  803a30:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a34:	f6 c2 80             	test   $0x80,%dl
+  803a37:	75 4f                	jne    803a88 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a39:	48 89 f8             	mov    %rdi,%rax
+  803a3c:	48 c1 e8 15          	shr    $0x15,%rax
+  803a40:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803a47:	01 00 00 
+  803a4a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a4e:	f6 c2 01             	test   $0x1,%dl
+  803a51:	74 44                	je     803a97 <get_uvpt_entry+0xa5>
+  803a53:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803a5a:	01 00 00 
+  803a5d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a61:	f6 c2 80             	test   $0x80,%dl
+  803a64:	75 31                	jne    803a97 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a66:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a6a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a71:	01 00 00 
+  803a74:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a78:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a79:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803a80:	01 00 00 
+  803a83:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a87:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a88:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803a8f:	01 00 00 
+  803a92:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a96:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a97:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803a9e:	01 00 00 
+  803aa1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803aa5:	c3                   	ret
+
+0000000000803aa6 <get_prot>:
+
+int
+get_prot(void *va) {
+  803aa6:	55                   	push   %rbp
+  803aa7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803aaa:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  803ab1:	00 00 00 
+  803ab4:	ff d0                	call   *%rax
+  803ab6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ab9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803abe:	89 c1                	mov    %eax,%ecx
+  803ac0:	83 c9 04             	or     $0x4,%ecx
+  803ac3:	f6 c2 01             	test   $0x1,%dl
+  803ac6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ac9:	89 c1                	mov    %eax,%ecx
+  803acb:	83 c9 02             	or     $0x2,%ecx
+  803ace:	f6 c2 02             	test   $0x2,%dl
+  803ad1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ad4:	89 c1                	mov    %eax,%ecx
+  803ad6:	83 c9 01             	or     $0x1,%ecx
+  803ad9:	48 85 d2             	test   %rdx,%rdx
+  803adc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803adf:	89 c1                	mov    %eax,%ecx
+  803ae1:	83 c9 40             	or     $0x40,%ecx
+  803ae4:	f6 c6 04             	test   $0x4,%dh
+  803ae7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803aea:	5d                   	pop    %rbp
+  803aeb:	c3                   	ret
+
+0000000000803aec <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803aec:	55                   	push   %rbp
+  803aed:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803af0:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  803af7:	00 00 00 
+  803afa:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803afc:	48 c1 e8 06          	shr    $0x6,%rax
+  803b00:	83 e0 01             	and    $0x1,%eax
+}
+  803b03:	5d                   	pop    %rbp
+  803b04:	c3                   	ret
+
+0000000000803b05 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803b05:	55                   	push   %rbp
+  803b06:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b09:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  803b10:	00 00 00 
+  803b13:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803b15:	48 c1 e8 05          	shr    $0x5,%rax
+  803b19:	83 e0 01             	and    $0x1,%eax
+}
+  803b1c:	5d                   	pop    %rbp
+  803b1d:	c3                   	ret
+
+0000000000803b1e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803b1e:	55                   	push   %rbp
+  803b1f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803b22:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	83 e0 01             	and    $0x1,%eax
+}
+  803b31:	5d                   	pop    %rbp
+  803b32:	c3                   	ret
+
+0000000000803b33 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803b33:	55                   	push   %rbp
+  803b34:	48 89 e5             	mov    %rsp,%rbp
+  803b37:	41 57                	push   %r15
+  803b39:	41 56                	push   %r14
+  803b3b:	41 55                	push   %r13
+  803b3d:	41 54                	push   %r12
+  803b3f:	53                   	push   %rbx
+  803b40:	48 83 ec 18          	sub    $0x18,%rsp
+  803b44:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b48:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803b51:	49 bd 1e 3b 80 00 00 	movabs $0x803b1e,%r13
+  803b58:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803b5b:	49 bf a6 3a 80 00 00 	movabs $0x803aa6,%r15
+  803b62:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803b65:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803b6c:	00 00 00 
+  803b6f:	eb 0c                	jmp    803b7d <foreach_shared_region+0x4a>
+  803b71:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b78:	4c 39 f3             	cmp    %r14,%rbx
+  803b7b:	74 2e                	je     803bab <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803b7d:	48 89 df             	mov    %rbx,%rdi
+  803b80:	41 ff d5             	call   *%r13
+  803b83:	84 c0                	test   %al,%al
+  803b85:	74 ea                	je     803b71 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803b87:	48 89 df             	mov    %rbx,%rdi
+  803b8a:	41 ff d7             	call   *%r15
+  803b8d:	a8 40                	test   $0x40,%al
+  803b8f:	74 e0                	je     803b71 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803b91:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803b98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b9c:	48 89 df             	mov    %rbx,%rdi
+  803b9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ba3:	ff d0                	call   *%rax
+				if (res < 0) {
+  803ba5:	85 c0                	test   %eax,%eax
+  803ba7:	79 c8                	jns    803b71 <foreach_shared_region+0x3e>
+  803ba9:	eb 05                	jmp    803bb0 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803bab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bb0:	48 83 c4 18          	add    $0x18,%rsp
+  803bb4:	5b                   	pop    %rbx
+  803bb5:	41 5c                	pop    %r12
+  803bb7:	41 5d                	pop    %r13
+  803bb9:	41 5e                	pop    %r14
+  803bbb:	41 5f                	pop    %r15
+  803bbd:	5d                   	pop    %rbp
+  803bbe:	c3                   	ret
+
+0000000000803bbf <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc4:	c3                   	ret
+
+0000000000803bc5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803bc5:	55                   	push   %rbp
+  803bc6:	48 89 e5             	mov    %rsp,%rbp
+  803bc9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803bcc:	48 be 9c 48 80 00 00 	movabs $0x80489c,%rsi
+  803bd3:	00 00 00 
+  803bd6:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  803bdd:	00 00 00 
+  803be0:	ff d0                	call   *%rax
+    return 0;
+}
+  803be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be7:	5d                   	pop    %rbp
+  803be8:	c3                   	ret
+
+0000000000803be9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803be9:	55                   	push   %rbp
+  803bea:	48 89 e5             	mov    %rsp,%rbp
+  803bed:	41 57                	push   %r15
+  803bef:	41 56                	push   %r14
+  803bf1:	41 55                	push   %r13
+  803bf3:	41 54                	push   %r12
+  803bf5:	53                   	push   %rbx
+  803bf6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803bfd:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803c04:	48 85 d2             	test   %rdx,%rdx
+  803c07:	74 7a                	je     803c83 <devcons_write+0x9a>
+  803c09:	49 89 d6             	mov    %rdx,%r14
+  803c0c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c12:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803c17:	49 bf ea 0d 80 00 00 	movabs $0x800dea,%r15
+  803c1e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803c21:	4c 89 f3             	mov    %r14,%rbx
+  803c24:	48 29 f3             	sub    %rsi,%rbx
+  803c27:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c2c:	48 39 c3             	cmp    %rax,%rbx
+  803c2f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803c33:	4c 63 eb             	movslq %ebx,%r13
+  803c36:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803c3d:	48 01 c6             	add    %rax,%rsi
+  803c40:	4c 89 ea             	mov    %r13,%rdx
+  803c43:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c4a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803c4d:	4c 89 ee             	mov    %r13,%rsi
+  803c50:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c57:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803c63:	41 01 dc             	add    %ebx,%r12d
+  803c66:	49 63 f4             	movslq %r12d,%rsi
+  803c69:	4c 39 f6             	cmp    %r14,%rsi
+  803c6c:	72 b3                	jb     803c21 <devcons_write+0x38>
+    return res;
+  803c6e:	49 63 c4             	movslq %r12d,%rax
+}
+  803c71:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803c78:	5b                   	pop    %rbx
+  803c79:	41 5c                	pop    %r12
+  803c7b:	41 5d                	pop    %r13
+  803c7d:	41 5e                	pop    %r14
+  803c7f:	41 5f                	pop    %r15
+  803c81:	5d                   	pop    %rbp
+  803c82:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803c83:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c89:	eb e3                	jmp    803c6e <devcons_write+0x85>
+
+0000000000803c8b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c8b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c93:	48 85 c0             	test   %rax,%rax
+  803c96:	74 55                	je     803ced <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c98:	55                   	push   %rbp
+  803c99:	48 89 e5             	mov    %rsp,%rbp
+  803c9c:	41 55                	push   %r13
+  803c9e:	41 54                	push   %r12
+  803ca0:	53                   	push   %rbx
+  803ca1:	48 83 ec 08          	sub    $0x8,%rsp
+  803ca5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803ca8:	48 bb 20 11 80 00 00 	movabs $0x801120,%rbx
+  803caf:	00 00 00 
+  803cb2:	49 bc ed 11 80 00 00 	movabs $0x8011ed,%r12
+  803cb9:	00 00 00 
+  803cbc:	eb 03                	jmp    803cc1 <devcons_read+0x36>
+  803cbe:	41 ff d4             	call   *%r12
+  803cc1:	ff d3                	call   *%rbx
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	74 f7                	je     803cbe <devcons_read+0x33>
+    if (c < 0) return c;
+  803cc7:	48 63 d0             	movslq %eax,%rdx
+  803cca:	78 13                	js     803cdf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd1:	83 f8 04             	cmp    $0x4,%eax
+  803cd4:	74 09                	je     803cdf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803cd6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803cda:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803cdf:	48 89 d0             	mov    %rdx,%rax
+  803ce2:	48 83 c4 08          	add    $0x8,%rsp
+  803ce6:	5b                   	pop    %rbx
+  803ce7:	41 5c                	pop    %r12
+  803ce9:	41 5d                	pop    %r13
+  803ceb:	5d                   	pop    %rbp
+  803cec:	c3                   	ret
+  803ced:	48 89 d0             	mov    %rdx,%rax
+  803cf0:	c3                   	ret
+
+0000000000803cf1 <cputchar>:
+cputchar(int ch) {
+  803cf1:	55                   	push   %rbp
+  803cf2:	48 89 e5             	mov    %rsp,%rbp
+  803cf5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803cf9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803cfd:	be 01 00 00 00       	mov    $0x1,%esi
+  803d02:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803d06:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  803d0d:	00 00 00 
+  803d10:	ff d0                	call   *%rax
+}
+  803d12:	c9                   	leave
+  803d13:	c3                   	ret
+
+0000000000803d14 <getchar>:
+getchar(void) {
+  803d14:	55                   	push   %rbp
+  803d15:	48 89 e5             	mov    %rsp,%rbp
+  803d18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803d1c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d21:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803d25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d2a:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+  803d36:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803d38:	85 c0                	test   %eax,%eax
+  803d3a:	78 06                	js     803d42 <getchar+0x2e>
+  803d3c:	74 08                	je     803d46 <getchar+0x32>
+  803d3e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803d42:	89 d0                	mov    %edx,%eax
+  803d44:	c9                   	leave
+  803d45:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803d46:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803d4b:	eb f5                	jmp    803d42 <getchar+0x2e>
+
+0000000000803d4d <iscons>:
+iscons(int fdnum) {
+  803d4d:	55                   	push   %rbp
+  803d4e:	48 89 e5             	mov    %rsp,%rbp
+  803d51:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d55:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d59:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d65:	85 c0                	test   %eax,%eax
+  803d67:	78 18                	js     803d81 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803d69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d6d:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803d74:	00 00 00 
+  803d77:	8b 00                	mov    (%rax),%eax
+  803d79:	39 02                	cmp    %eax,(%rdx)
+  803d7b:	0f 94 c0             	sete   %al
+  803d7e:	0f b6 c0             	movzbl %al,%eax
+}
+  803d81:	c9                   	leave
+  803d82:	c3                   	ret
+
+0000000000803d83 <opencons>:
+opencons(void) {
+  803d83:	55                   	push   %rbp
+  803d84:	48 89 e5             	mov    %rsp,%rbp
+  803d87:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d8b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803d8f:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+  803d9b:	85 c0                	test   %eax,%eax
+  803d9d:	78 49                	js     803de8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803d9f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803da4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803dad:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db2:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  803db9:	00 00 00 
+  803dbc:	ff d0                	call   *%rax
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	78 26                	js     803de8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803dc2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803dc6:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803dcd:	00 00 
+  803dcf:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803dd1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dd5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803ddc:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+}
+  803de8:	c9                   	leave
+  803de9:	c3                   	ret
+
+0000000000803dea <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803dea:	55                   	push   %rbp
+  803deb:	48 89 e5             	mov    %rsp,%rbp
+  803dee:	41 55                	push   %r13
+  803df0:	41 54                	push   %r12
+  803df2:	53                   	push   %rbx
+  803df3:	48 83 ec 08          	sub    $0x8,%rsp
+  803df7:	49 89 fc             	mov    %rdi,%r12
+  803dfa:	48 89 f7             	mov    %rsi,%rdi
+  803dfd:	48 89 d3             	mov    %rdx,%rbx
+  803e00:	49 89 cd             	mov    %rcx,%r13
+  803e03:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803e06:	48 85 f6             	test   %rsi,%rsi
+  803e09:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e10:	00 00 00 
+  803e13:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803e17:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e1c:	48 85 db             	test   %rbx,%rbx
+  803e1f:	74 03                	je     803e24 <ipc_recv_timed+0x3a>
+  803e21:	48 8b 33             	mov    (%rbx),%rsi
+  803e24:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  803e2b:	00 00 00 
+  803e2e:	ff d0                	call   *%rax
+    if (res < 0) {
+  803e30:	85 c0                	test   %eax,%eax
+  803e32:	78 75                	js     803ea9 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803e34:	4d 85 e4             	test   %r12,%r12
+  803e37:	74 14                	je     803e4d <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803e39:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803e40:	00 00 00 
+  803e43:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803e49:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803e4d:	4d 85 ed             	test   %r13,%r13
+  803e50:	74 14                	je     803e66 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803e52:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803e59:	00 00 00 
+  803e5c:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803e62:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803e66:	48 85 db             	test   %rbx,%rbx
+  803e69:	74 23                	je     803e8e <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803e6b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803e72:	00 00 00 
+  803e75:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e80:	85 c9                	test   %ecx,%ecx
+  803e82:	74 07                	je     803e8b <ipc_recv_timed+0xa1>
+  803e84:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803e8b:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803e8e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803e95:	00 00 00 
+  803e98:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803e9e:	48 83 c4 08          	add    $0x8,%rsp
+  803ea2:	5b                   	pop    %rbx
+  803ea3:	41 5c                	pop    %r12
+  803ea5:	41 5d                	pop    %r13
+  803ea7:	5d                   	pop    %rbp
+  803ea8:	c3                   	ret
+        if (from_env_store != NULL) {
+  803ea9:	4d 85 e4             	test   %r12,%r12
+  803eac:	74 08                	je     803eb6 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803eae:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803eb5:	00 
+        if (perm_store != NULL) {
+  803eb6:	4d 85 ed             	test   %r13,%r13
+  803eb9:	74 08                	je     803ec3 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803ebb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803ec2:	00 
+        if (size != NULL) {
+  803ec3:	48 85 db             	test   %rbx,%rbx
+  803ec6:	74 d6                	je     803e9e <ipc_recv_timed+0xb4>
+            *size = 0;
+  803ec8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803ecf:	eb cd                	jmp    803e9e <ipc_recv_timed+0xb4>
+
+0000000000803ed1 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ed1:	55                   	push   %rbp
+  803ed2:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803ed5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803edb:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  803ee2:	00 00 00 
+  803ee5:	ff d0                	call   *%rax
+}
+  803ee7:	5d                   	pop    %rbp
+  803ee8:	c3                   	ret
+
+0000000000803ee9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ee9:	55                   	push   %rbp
+  803eea:	48 89 e5             	mov    %rsp,%rbp
+  803eed:	41 57                	push   %r15
+  803eef:	41 56                	push   %r14
+  803ef1:	41 55                	push   %r13
+  803ef3:	41 54                	push   %r12
+  803ef5:	53                   	push   %rbx
+  803ef6:	48 83 ec 18          	sub    $0x18,%rsp
+  803efa:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803efd:	48 89 d3             	mov    %rdx,%rbx
+  803f00:	49 89 cc             	mov    %rcx,%r12
+  803f03:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803f06:	48 85 d2             	test   %rdx,%rdx
+  803f09:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f10:	00 00 00 
+  803f13:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803f17:	89 f0                	mov    %esi,%eax
+  803f19:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803f1d:	48 89 da             	mov    %rbx,%rdx
+  803f20:	48 89 c6             	mov    %rax,%rsi
+  803f23:	48 b8 ea 14 80 00 00 	movabs $0x8014ea,%rax
+  803f2a:	00 00 00 
+  803f2d:	ff d0                	call   *%rax
+    while (res < 0) {
+  803f2f:	85 c0                	test   %eax,%eax
+  803f31:	79 65                	jns    803f98 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803f33:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803f36:	75 33                	jne    803f6b <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803f38:	49 bf ed 11 80 00 00 	movabs $0x8011ed,%r15
+  803f3f:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803f42:	49 be ea 14 80 00 00 	movabs $0x8014ea,%r14
+  803f49:	00 00 00 
+        sys_yield();
+  803f4c:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803f4f:	45 89 e8             	mov    %r13d,%r8d
+  803f52:	4c 89 e1             	mov    %r12,%rcx
+  803f55:	48 89 da             	mov    %rbx,%rdx
+  803f58:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803f5c:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803f5f:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803f62:	85 c0                	test   %eax,%eax
+  803f64:	79 32                	jns    803f98 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803f66:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803f69:	74 e1                	je     803f4c <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803f6b:	89 c1                	mov    %eax,%ecx
+  803f6d:	48 ba a8 48 80 00 00 	movabs $0x8048a8,%rdx
+  803f74:	00 00 00 
+  803f77:	be 52 00 00 00       	mov    $0x52,%esi
+  803f7c:	48 bf bc 48 80 00 00 	movabs $0x8048bc,%rdi
+  803f83:	00 00 00 
+  803f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8b:	49 b8 7b 01 80 00 00 	movabs $0x80017b,%r8
+  803f92:	00 00 00 
+  803f95:	41 ff d0             	call   *%r8
+    }
+}
+  803f98:	48 83 c4 18          	add    $0x18,%rsp
+  803f9c:	5b                   	pop    %rbx
+  803f9d:	41 5c                	pop    %r12
+  803f9f:	41 5d                	pop    %r13
+  803fa1:	41 5e                	pop    %r14
+  803fa3:	41 5f                	pop    %r15
+  803fa5:	5d                   	pop    %rbp
+  803fa6:	c3                   	ret
+
+0000000000803fa7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803fac:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803fb3:	00 00 00 
+  803fb6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803fba:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803fbe:	48 c1 e2 04          	shl    $0x4,%rdx
+  803fc2:	48 01 ca             	add    %rcx,%rdx
+  803fc5:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803fcb:	39 fa                	cmp    %edi,%edx
+  803fcd:	74 12                	je     803fe1 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803fcf:	48 83 c0 01          	add    $0x1,%rax
+  803fd3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803fd9:	75 db                	jne    803fb6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fe0:	c3                   	ret
+            return envs[i].env_id;
+  803fe1:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803fe5:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803fe9:	48 c1 e2 04          	shl    $0x4,%rdx
+  803fed:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803ff4:	00 00 00 
+  803ff7:	48 01 d0             	add    %rdx,%rax
+  803ffa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804000:	c3                   	ret
+  804001:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804008 <__rodata_start>:
+  804008:	69 20 61 6d 20 70    	imul   $0x70206d61,(%rax),%esp
+  80400e:	61                   	(bad)
+  80400f:	72 65                	jb     804076 <__rodata_start+0x6e>
+  804011:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804012:	74 20                	je     804034 <__rodata_start+0x2c>
+  804014:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804016:	76 69                	jbe    804081 <__rodata_start+0x79>
+  804018:	72 6f                	jb     804089 <__rodata_start+0x81>
+  80401a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80401b:	6d                   	insl   (%dx),%es:(%rdi)
+  80401c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80401e:	74 20                	je     804040 <__rodata_start+0x38>
+  804020:	25 30 38 78 0a       	and    $0xa783830,%eax
+  804025:	00 68 65             	add    %ch,0x65(%rax)
+  804028:	6c                   	insb   (%dx),%es:(%rdi)
+  804029:	6c                   	insb   (%dx),%es:(%rdi)
+  80402a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80402b:	00 73 70             	add    %dh,0x70(%rbx)
+  80402e:	61                   	(bad)
+  80402f:	77 6e                	ja     80409f <__rodata_start+0x97>
+  804031:	28 68 65             	sub    %ch,0x65(%rax)
+  804034:	6c                   	insb   (%dx),%es:(%rdi)
+  804035:	6c                   	insb   (%dx),%es:(%rdi)
+  804036:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804037:	29 20                	sub    %esp,(%rax)
+  804039:	66 61                	data16 (bad)
+  80403b:	69 6c 65 64 3a 20 25 	imul   $0x6925203a,0x64(%rbp,%riz,2),%ebp
+  804042:	69 
+  804043:	00 75 73             	add    %dh,0x73(%rbp)
+  804046:	65 72 2f             	gs jb  804078 <__rodata_start+0x70>
+  804049:	73 70                	jae    8040bb <__rodata_start+0xb3>
+  80404b:	61                   	(bad)
+  80404c:	77 6e                	ja     8040bc <__rodata_start+0xb4>
+  80404e:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  804053:	2e 63 00             	cs movsxd (%rax),%eax
+  804056:	3c 75                	cmp    $0x75,%al
+  804058:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804059:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80405d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80405e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  804062:	30 38                	xor    %bh,(%rax)
+  804064:	78 5d                	js     8040c3 <__rodata_start+0xbb>
+  804066:	20 75 73             	and    %dh,0x73(%rbp)
+  804069:	65 72 20             	gs jb  80408c <__rodata_start+0x84>
+  80406c:	70 61                	jo     8040cf <__rodata_start+0xc7>
+  80406e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80406f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804076:	73 20                	jae    804098 <__rodata_start+0x90>
+  804078:	61                   	(bad)
+  804079:	74 20                	je     80409b <__rodata_start+0x93>
+  80407b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804080:	3a 20                	cmp    (%rax),%ah
+  804082:	00 30                	add    %dh,(%rax)
+  804084:	31 32                	xor    %esi,(%rdx)
+  804086:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80408d:	41                   	rex.B
+  80408e:	42                   	rex.X
+  80408f:	43                   	rex.XB
+  804090:	44                   	rex.R
+  804091:	45                   	rex.RB
+  804092:	46 00 30             	rex.RX add %r14b,(%rax)
+  804095:	31 32                	xor    %esi,(%rdx)
+  804097:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80409e:	61                   	(bad)
+  80409f:	62 63 64 65 66       	(bad)
+  8040a4:	00 28                	add    %ch,(%rax)
+  8040a6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8040a7:	75 6c                	jne    804115 <__rodata_start+0x10d>
+  8040a9:	6c                   	insb   (%dx),%es:(%rdi)
+  8040aa:	29 00                	sub    %eax,(%rax)
+  8040ac:	65 72 72             	gs jb  804121 <__rodata_start+0x119>
+  8040af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040b0:	72 20                	jb     8040d2 <__rodata_start+0xca>
+  8040b2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8040b7:	73 70                	jae    804129 <__rodata_start+0x121>
+  8040b9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8040bd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8040c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040c5:	72 00                	jb     8040c7 <__rodata_start+0xbf>
+  8040c7:	62 61 64 20 65       	(bad)
+  8040cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8040cd:	76 69                	jbe    804138 <__rodata_start+0x130>
+  8040cf:	72 6f                	jb     804140 <__rodata_start+0x138>
+  8040d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8040d2:	6d                   	insl   (%dx),%es:(%rdi)
+  8040d3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8040d5:	74 00                	je     8040d7 <__rodata_start+0xcf>
+  8040d7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8040de:	20 70 61             	and    %dh,0x61(%rax)
+  8040e1:	72 61                	jb     804144 <__rodata_start+0x13c>
+  8040e3:	6d                   	insl   (%dx),%es:(%rdi)
+  8040e4:	65 74 65             	gs je  80414c <__rodata_start+0x144>
+  8040e7:	72 00                	jb     8040e9 <__rodata_start+0xe1>
+  8040e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040ea:	75 74                	jne    804160 <__rodata_start+0x158>
+  8040ec:	20 6f 66             	and    %ch,0x66(%rdi)
+  8040ef:	20 6d 65             	and    %ch,0x65(%rbp)
+  8040f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8040f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040f4:	72 79                	jb     80416f <__rodata_start+0x167>
+  8040f6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8040f9:	74 20                	je     80411b <__rodata_start+0x113>
+  8040fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040fc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804100:	76 69                	jbe    80416b <__rodata_start+0x163>
+  804102:	72 6f                	jb     804173 <__rodata_start+0x16b>
+  804104:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804105:	6d                   	insl   (%dx),%es:(%rdi)
+  804106:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804108:	74 73                	je     80417d <__rodata_start+0x175>
+  80410a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80410d:	72 72                	jb     804181 <__rodata_start+0x179>
+  80410f:	75 70                	jne    804181 <__rodata_start+0x179>
+  804111:	74 65                	je     804178 <__rodata_start+0x170>
+  804113:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804118:	75 67                	jne    804181 <__rodata_start+0x179>
+  80411a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80411d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80411f:	00 73 65             	add    %dh,0x65(%rbx)
+  804122:	67 6d                	insl   (%dx),%es:(%edi)
+  804124:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804126:	74 61                	je     804189 <__rodata_start+0x181>
+  804128:	74 69                	je     804193 <__rodata_start+0x18b>
+  80412a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80412b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80412c:	20 66 61             	and    %ah,0x61(%rsi)
+  80412f:	75 6c                	jne    80419d <__rodata_start+0x195>
+  804131:	74 00                	je     804133 <__rodata_start+0x12b>
+  804133:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80413a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80413d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804141:	61                   	(bad)
+  804142:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804147:	20 73 75             	and    %dh,0x75(%rbx)
+  80414a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80414d:	73 79                	jae    8041c8 <__rodata_start+0x1c0>
+  80414f:	73 74                	jae    8041c5 <__rodata_start+0x1bd>
+  804151:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804153:	20 63 61             	and    %ah,0x61(%rbx)
+  804156:	6c                   	insb   (%dx),%es:(%rdi)
+  804157:	6c                   	insb   (%dx),%es:(%rdi)
+  804158:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80415b:	74 72                	je     8041cf <__rodata_start+0x1c7>
+  80415d:	79 20                	jns    80417f <__rodata_start+0x177>
+  80415f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804160:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804161:	74 20                	je     804183 <__rodata_start+0x17b>
+  804163:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804165:	75 6e                	jne    8041d5 <__rodata_start+0x1cd>
+  804167:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80416b:	76 20                	jbe    80418d <__rodata_start+0x185>
+  80416d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804174:	72 65                	jb     8041db <__rodata_start+0x1d3>
+  804176:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804179:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80417a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80417e:	65 78 70             	gs js  8041f1 <__rodata_start+0x1e9>
+  804181:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804186:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804189:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80418d:	20 66 69             	and    %ah,0x69(%rsi)
+  804190:	6c                   	insb   (%dx),%es:(%rdi)
+  804191:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804195:	20 66 72             	and    %ah,0x72(%rsi)
+  804198:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80419d:	61                   	(bad)
+  80419e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8041a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041a3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8041a7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8041aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041ac:	20 6d 61             	and    %ch,0x61(%rbp)
+  8041af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041b0:	79 20                	jns    8041d2 <__rodata_start+0x1ca>
+  8041b2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8041b9:	72 65                	jb     804220 <__rodata_start+0x218>
+  8041bb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8041be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8041c0:	00 66 69             	add    %ah,0x69(%rsi)
+  8041c3:	6c                   	insb   (%dx),%es:(%rdi)
+  8041c4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8041c8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8041cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041cc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8041cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041d1:	74 20                	je     8041f3 <__rodata_start+0x1eb>
+  8041d3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8041d5:	75 6e                	jne    804245 <__rodata_start+0x23d>
+  8041d7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8041db:	76 61                	jbe    80423e <__rodata_start+0x236>
+  8041dd:	6c                   	insb   (%dx),%es:(%rdi)
+  8041de:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8041e5:	00 
+  8041e6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8041ed:	72 65                	jb     804254 <__rodata_start+0x24c>
+  8041ef:	61                   	(bad)
+  8041f0:	64 79 20             	fs jns 804213 <__rodata_start+0x20b>
+  8041f3:	65 78 69             	gs js  80425f <__rodata_start+0x257>
+  8041f6:	73 74                	jae    80426c <__rodata_start+0x264>
+  8041f8:	73 00                	jae    8041fa <__rodata_start+0x1f2>
+  8041fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041fb:	70 65                	jo     804262 <__rodata_start+0x25a>
+  8041fd:	72 61                	jb     804260 <__rodata_start+0x258>
+  8041ff:	74 69                	je     80426a <__rodata_start+0x262>
+  804201:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804202:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804203:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804206:	74 20                	je     804228 <__rodata_start+0x220>
+  804208:	73 75                	jae    80427f <__rodata_start+0x277>
+  80420a:	70 70                	jo     80427c <__rodata_start+0x274>
+  80420c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80420d:	72 74                	jb     804283 <__rodata_start+0x27b>
+  80420f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  804215:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  80421a:	74 00                	je     80421c <__rodata_start+0x214>
+  80421c:	0f 1f 40 00          	nopl   0x0(%rax)
+  804220:	b8 04 80 00 00       	mov    $0x8004,%eax
+  804225:	00 00                	add    %al,(%rax)
+  804227:	00 f9                	add    %bh,%cl
+  804229:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80422f:	00 e9                	add    %ch,%cl
+  804231:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804237:	00 f9                	add    %bh,%cl
+  804239:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80423f:	00 f9                	add    %bh,%cl
+  804241:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804247:	00 f9                	add    %bh,%cl
+  804249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80424f:	00 f9                	add    %bh,%cl
+  804251:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804257:	00 d7                	add    %dl,%bh
+  804259:	04 80                	add    $0x80,%al
+  80425b:	00 00                	add    %al,(%rax)
+  80425d:	00 00                	add    %al,(%rax)
+  80425f:	00 f9                	add    %bh,%cl
+  804261:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804267:	00 f9                	add    %bh,%cl
+  804269:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80426f:	00 cb                	add    %cl,%bl
+  804271:	04 80                	add    $0x80,%al
+  804273:	00 00                	add    %al,(%rax)
+  804275:	00 00                	add    %al,(%rax)
+  804277:	00 45 05             	add    %al,0x5(%rbp)
+  80427a:	80 00 00             	addb   $0x0,(%rax)
+  80427d:	00 00                	add    %al,(%rax)
+  80427f:	00 f9                	add    %bh,%cl
+  804281:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804287:	00 cb                	add    %cl,%bl
+  804289:	04 80                	add    $0x80,%al
+  80428b:	00 00                	add    %al,(%rax)
+  80428d:	00 00                	add    %al,(%rax)
+  80428f:	00 11                	add    %dl,(%rcx)
+  804291:	05 80 00 00 00       	add    $0x80,%eax
+  804296:	00 00                	add    %al,(%rax)
+  804298:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 80431e <__rodata_start+0x316>
+  80429e:	00 00                	add    %al,(%rax)
+  8042a0:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 804326 <__rodata_start+0x31e>
+  8042a6:	00 00                	add    %al,(%rax)
+  8042a8:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 80432e <__rodata_start+0x326>
+  8042ae:	00 00                	add    %al,(%rax)
+  8042b0:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 804336 <__rodata_start+0x32e>
+  8042b6:	00 00                	add    %al,(%rax)
+  8042b8:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 80433e <__rodata_start+0x336>
+  8042be:	00 00                	add    %al,(%rax)
+  8042c0:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 804346 <__rodata_start+0x33e>
+  8042c6:	00 00                	add    %al,(%rax)
+  8042c8:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 80434e <__rodata_start+0x346>
+  8042ce:	00 00                	add    %al,(%rax)
+  8042d0:	11 05 80 00 00 00    	adc    %eax,0x80(%rip)        # 804356 <__rodata_start+0x34e>
+  8042d6:	00 00                	add    %al,(%rax)
+  8042d8:	f9                   	stc
+  8042d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8042df:	00 f9                	add    %bh,%cl
+  8042e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8042e7:	00 f9                	add    %bh,%cl
+  8042e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8042ef:	00 f9                	add    %bh,%cl
+  8042f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8042f7:	00 f9                	add    %bh,%cl
+  8042f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8042ff:	00 f9                	add    %bh,%cl
+  804301:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804307:	00 f9                	add    %bh,%cl
+  804309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80430f:	00 f9                	add    %bh,%cl
+  804311:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804317:	00 f9                	add    %bh,%cl
+  804319:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80431f:	00 f9                	add    %bh,%cl
+  804321:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804327:	00 f9                	add    %bh,%cl
+  804329:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80432f:	00 f9                	add    %bh,%cl
+  804331:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804337:	00 f9                	add    %bh,%cl
+  804339:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80433f:	00 f9                	add    %bh,%cl
+  804341:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804347:	00 f9                	add    %bh,%cl
+  804349:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80434f:	00 f9                	add    %bh,%cl
+  804351:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804357:	00 f9                	add    %bh,%cl
+  804359:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80435f:	00 f9                	add    %bh,%cl
+  804361:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804367:	00 f9                	add    %bh,%cl
+  804369:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80436f:	00 f9                	add    %bh,%cl
+  804371:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804377:	00 f9                	add    %bh,%cl
+  804379:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80437f:	00 f9                	add    %bh,%cl
+  804381:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804387:	00 f9                	add    %bh,%cl
+  804389:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80438f:	00 f9                	add    %bh,%cl
+  804391:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804397:	00 f9                	add    %bh,%cl
+  804399:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80439f:	00 f9                	add    %bh,%cl
+  8043a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043a7:	00 f9                	add    %bh,%cl
+  8043a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043af:	00 f9                	add    %bh,%cl
+  8043b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043b7:	00 f9                	add    %bh,%cl
+  8043b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043bf:	00 f9                	add    %bh,%cl
+  8043c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043c7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8043ca:	80 00 00             	addb   $0x0,(%rax)
+  8043cd:	00 00                	add    %al,(%rax)
+  8043cf:	00 f9                	add    %bh,%cl
+  8043d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043d7:	00 f9                	add    %bh,%cl
+  8043d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043df:	00 f9                	add    %bh,%cl
+  8043e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043e7:	00 f9                	add    %bh,%cl
+  8043e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043ef:	00 f9                	add    %bh,%cl
+  8043f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043f7:	00 f9                	add    %bh,%cl
+  8043f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8043ff:	00 f9                	add    %bh,%cl
+  804401:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804407:	00 f9                	add    %bh,%cl
+  804409:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80440f:	00 f9                	add    %bh,%cl
+  804411:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804417:	00 f9                	add    %bh,%cl
+  804419:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80441f:	00 68 05             	add    %ch,0x5(%rax)
+  804422:	80 00 00             	addb   $0x0,(%rax)
+  804425:	00 00                	add    %al,(%rax)
+  804427:	00 37                	add    %dh,(%rdi)
+  804429:	07                   	(bad)
+  80442a:	80 00 00             	addb   $0x0,(%rax)
+  80442d:	00 00                	add    %al,(%rax)
+  80442f:	00 f9                	add    %bh,%cl
+  804431:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804437:	00 f9                	add    %bh,%cl
+  804439:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80443f:	00 f9                	add    %bh,%cl
+  804441:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804447:	00 f9                	add    %bh,%cl
+  804449:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80444f:	00 97 05 80 00 00    	add    %dl,0x8005(%rdi)
+  804455:	00 00                	add    %al,(%rax)
+  804457:	00 f9                	add    %bh,%cl
+  804459:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80445f:	00 f9                	add    %bh,%cl
+  804461:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804467:	00 5d 05             	add    %bl,0x5(%rbp)
+  80446a:	80 00 00             	addb   $0x0,(%rax)
+  80446d:	00 00                	add    %al,(%rax)
+  80446f:	00 f9                	add    %bh,%cl
+  804471:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804477:	00 f9                	add    %bh,%cl
+  804479:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80447f:	00 df                	add    %bl,%bh
+  804481:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804487:	00 a9 09 80 00 00    	add    %ch,0x8009(%rcx)
+  80448d:	00 00                	add    %al,(%rax)
+  80448f:	00 f9                	add    %bh,%cl
+  804491:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804497:	00 f9                	add    %bh,%cl
+  804499:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80449f:	00 2e                	add    %ch,(%rsi)
+  8044a1:	06                   	(bad)
+  8044a2:	80 00 00             	addb   $0x0,(%rax)
+  8044a5:	00 00                	add    %al,(%rax)
+  8044a7:	00 f9                	add    %bh,%cl
+  8044a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8044af:	00 0b                	add    %cl,(%rbx)
+  8044b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8044b7:	00 f9                	add    %bh,%cl
+  8044b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8044bf:	00 f9                	add    %bh,%cl
+  8044c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8044c7:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  8044ca:	80 00 00             	addb   $0x0,(%rax)
+  8044cd:	00 00                	add    %al,(%rax)
+  8044cf:	00 f9                	add    %bh,%cl
+  8044d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8044d7:	00 c1                	add    %al,%cl
+  8044d9:	04 80                	add    $0x80,%al
+  8044db:	00 00                	add    %al,(%rax)
+  8044dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008044e0 <error_string>:
+	...
+  8044e8:	b5 40 80 00 00 00 00 00 c7 40 80 00 00 00 00 00     .@.......@......
+  8044f8:	d7 40 80 00 00 00 00 00 e9 40 80 00 00 00 00 00     .@.......@......
+  804508:	f7 40 80 00 00 00 00 00 0b 41 80 00 00 00 00 00     .@.......A......
+  804518:	20 41 80 00 00 00 00 00 33 41 80 00 00 00 00 00      A......3A......
+  804528:	45 41 80 00 00 00 00 00 59 41 80 00 00 00 00 00     EA......YA......
+  804538:	69 41 80 00 00 00 00 00 7c 41 80 00 00 00 00 00     iA......|A......
+  804548:	93 41 80 00 00 00 00 00 a9 41 80 00 00 00 00 00     .A.......A......
+  804558:	c1 41 80 00 00 00 00 00 d9 41 80 00 00 00 00 00     .A.......A......
+  804568:	e6 41 80 00 00 00 00 00 88 45 80 00 00 00 00 00     .A.......E......
+  804578:	fa 41 80 00 00 00 00 00 12 42 80 00 00 00 00 00     .A.......B......
+  804588:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804598:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8045a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8045b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8045c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8045d8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8045e8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8045f8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804608:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804618:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804628:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804638:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804648:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804658:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804668:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804678:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804680 <devtab>:
+  804680:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804690:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8046a0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  8046b0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8046c0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  8046d0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8046e0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8046f0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804700:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  804710:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  804720:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804730:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  804740:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  804750:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  804760:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  804770:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804780:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  804790:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  8047a0:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  8047b0:	77 61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72     want %08x..asser
+  8047c0:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  8047d0:	6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70 5f     lib/spawn.c.map_
+  8047e0:	73 65 67 6d 65 6e 74 2e 73 65 65 6b 20 66 61 69     segment.seek fai
+  8047f0:	6c 65 64 3a 20 25 69 0a 00 6d 61 70 5f 73 65 67     led: %i..map_seg
+  804800:	6d 65 6e 74 2e 72 65 61 64 6e 20 66 61 69 6c 65     ment.readn faile
+  804810:	64 3a 20 25 69 0a 00 63 6f 70 79 5f 73 68 61 72     d: %i..copy_shar
+  804820:	65 64 5f 72 65 67 69 6f 6e 3a 20 25 69 00 73 79     ed_region: %i.sy
+  804830:	73 5f 65 6e 76 5f 73 65 74 5f 74 72 61 70 66 72     s_env_set_trapfr
+  804840:	61 6d 65 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f     ame: %i.sys_env_
+  804850:	73 65 74 5f 73 74 61 74 75 73 3a 20 25 69 00 3c     set_status: %i.<
+  804860:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  804870:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  804880:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804890:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8048a0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  8048b0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8048c0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8048d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,7047 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba 63 02 80 00 00 	movabs $0x800263,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf b8 38 80 00 00 	movabs $0x8038b8,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba 63 02 80 00 00 	movabs $0x800263,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf 68 38 80 00 00 	movabs $0x803868,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd 63 02 80 00 00 	movabs $0x800263,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc 85 11 80 00 00 	movabs $0x801185,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf 90 38 80 00 00 	movabs $0x803890,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 e9 10 80 00 00 	movabs $0x8010e9,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	41 89 fd             	mov    %edi,%r13d
+  8000f3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000f6:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  8000fd:	00 00 00 
+  800100:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800107:	00 00 00 
+  80010a:	48 39 c2             	cmp    %rax,%rdx
+  80010d:	73 17                	jae    800126 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80010f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800112:	49 89 c4             	mov    %rax,%r12
+  800115:	48 83 c3 08          	add    $0x8,%rbx
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	ff 53 f8             	call   *-0x8(%rbx)
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	72 ef                	jb     800115 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800126:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+  800132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800137:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80013b:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80013f:	48 c1 e0 04          	shl    $0x4,%rax
+  800143:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80014a:	00 00 00 
+  80014d:	48 01 d0             	add    %rdx,%rax
+  800150:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800157:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80015a:	45 85 ed             	test   %r13d,%r13d
+  80015d:	7e 0d                	jle    80016c <libmain+0x87>
+  80015f:	49 8b 06             	mov    (%r14),%rax
+  800162:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800169:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80016c:	4c 89 f6             	mov    %r14,%rsi
+  80016f:	44 89 ef             	mov    %r13d,%edi
+  800172:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800179:	00 00 00 
+  80017c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80017e:	48 b8 93 01 80 00 00 	movabs $0x800193,%rax
+  800185:	00 00 00 
+  800188:	ff d0                	call   *%rax
+#endif
+}
+  80018a:	5b                   	pop    %rbx
+  80018b:	41 5c                	pop    %r12
+  80018d:	41 5d                	pop    %r13
+  80018f:	41 5e                	pop    %r14
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800197:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a8:	48 b8 e9 10 80 00 00 	movabs $0x8010e9,%rax
+  8001af:	00 00 00 
+  8001b2:	ff d0                	call   *%rax
+}
+  8001b4:	5d                   	pop    %rbp
+  8001b5:	c3                   	ret
+
+00000000008001b6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b6:	55                   	push   %rbp
+  8001b7:	48 89 e5             	mov    %rsp,%rbp
+  8001ba:	53                   	push   %rbx
+  8001bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8001bf:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001c2:	8b 06                	mov    (%rsi),%eax
+  8001c4:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c7:	89 16                	mov    %edx,(%rsi)
+  8001c9:	48 98                	cltq
+  8001cb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001d0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d6:	74 0a                	je     8001e2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e0:	c9                   	leave
+  8001e1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001e2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e6:	be ff 00 00 00       	mov    $0xff,%esi
+  8001eb:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001fd:	eb d9                	jmp    8001d8 <putch+0x22>
+
+00000000008001ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001ff:	55                   	push   %rbp
+  800200:	48 89 e5             	mov    %rsp,%rbp
+  800203:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80020a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80020d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800214:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800221:	48 89 f1             	mov    %rsi,%rcx
+  800224:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80022b:	48 bf b6 01 80 00 00 	movabs $0x8001b6,%rdi
+  800232:	00 00 00 
+  800235:	48 b8 b3 03 80 00 00 	movabs $0x8003b3,%rax
+  80023c:	00 00 00 
+  80023f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800241:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800248:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024f:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80025b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+
+0000000000800263 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800263:	55                   	push   %rbp
+  800264:	48 89 e5             	mov    %rsp,%rbp
+  800267:	48 83 ec 50          	sub    $0x50,%rsp
+  80026b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800273:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800277:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80027b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800286:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80028e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800292:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800296:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80029a:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  8002a1:	00 00 00 
+  8002a4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+
+00000000008002a8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a8:	55                   	push   %rbp
+  8002a9:	48 89 e5             	mov    %rsp,%rbp
+  8002ac:	41 57                	push   %r15
+  8002ae:	41 56                	push   %r14
+  8002b0:	41 55                	push   %r13
+  8002b2:	41 54                	push   %r12
+  8002b4:	53                   	push   %rbx
+  8002b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b9:	49 89 fc             	mov    %rdi,%r12
+  8002bc:	49 89 f5             	mov    %rsi,%r13
+  8002bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c9:	41 89 cf             	mov    %ecx,%r15d
+  8002cc:	4c 39 fa             	cmp    %r15,%rdx
+  8002cf:	73 5b                	jae    80032c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002d1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d9:	85 db                	test   %ebx,%ebx
+  8002db:	7e 0e                	jle    8002eb <print_num+0x43>
+            putch(padc, put_arg);
+  8002dd:	4c 89 ee             	mov    %r13,%rsi
+  8002e0:	44 89 f7             	mov    %r14d,%edi
+  8002e3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e6:	83 eb 01             	sub    $0x1,%ebx
+  8002e9:	75 f2                	jne    8002dd <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002eb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ef:	48 b9 f1 38 80 00 00 	movabs $0x8038f1,%rcx
+  8002f6:	00 00 00 
+  8002f9:	48 b8 e0 38 80 00 00 	movabs $0x8038e0,%rax
+  800300:	00 00 00 
+  800303:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800307:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80030b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800310:	49 f7 f7             	div    %r15
+  800313:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800317:	4c 89 ee             	mov    %r13,%rsi
+  80031a:	41 ff d4             	call   *%r12
+}
+  80031d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800321:	5b                   	pop    %rbx
+  800322:	41 5c                	pop    %r12
+  800324:	41 5d                	pop    %r13
+  800326:	41 5e                	pop    %r14
+  800328:	41 5f                	pop    %r15
+  80032a:	5d                   	pop    %rbp
+  80032b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80032c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800330:	ba 00 00 00 00       	mov    $0x0,%edx
+  800335:	49 f7 f7             	div    %r15
+  800338:	48 83 ec 08          	sub    $0x8,%rsp
+  80033c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800340:	52                   	push   %rdx
+  800341:	45 0f be c9          	movsbl %r9b,%r9d
+  800345:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800349:	48 89 c2             	mov    %rax,%rdx
+  80034c:	48 b8 a8 02 80 00 00 	movabs $0x8002a8,%rax
+  800353:	00 00 00 
+  800356:	ff d0                	call   *%rax
+  800358:	48 83 c4 10          	add    $0x10,%rsp
+  80035c:	eb 8d                	jmp    8002eb <print_num+0x43>
+
+000000000080035e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80035e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800362:	48 8b 06             	mov    (%rsi),%rax
+  800365:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800369:	73 0a                	jae    800375 <sprintputch+0x17>
+        *state->start++ = ch;
+  80036b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036f:	48 89 16             	mov    %rdx,(%rsi)
+  800372:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800375:	c3                   	ret
+
+0000000000800376 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800376:	55                   	push   %rbp
+  800377:	48 89 e5             	mov    %rsp,%rbp
+  80037a:	48 83 ec 50          	sub    $0x50,%rsp
+  80037e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800382:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800386:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80038a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800391:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800395:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800399:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80039d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003a1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a5:	48 b8 b3 03 80 00 00 	movabs $0x8003b3,%rax
+  8003ac:	00 00 00 
+  8003af:	ff d0                	call   *%rax
+}
+  8003b1:	c9                   	leave
+  8003b2:	c3                   	ret
+
+00000000008003b3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b3:	55                   	push   %rbp
+  8003b4:	48 89 e5             	mov    %rsp,%rbp
+  8003b7:	41 57                	push   %r15
+  8003b9:	41 56                	push   %r14
+  8003bb:	41 55                	push   %r13
+  8003bd:	41 54                	push   %r12
+  8003bf:	53                   	push   %rbx
+  8003c0:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c4:	49 89 fe             	mov    %rdi,%r14
+  8003c7:	49 89 f5             	mov    %rsi,%r13
+  8003ca:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003cd:	48 8b 01             	mov    (%rcx),%rax
+  8003d0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003dc:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e8:	0f b6 3b             	movzbl (%rbx),%edi
+  8003eb:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ef:	74 18                	je     800409 <vprintfmt+0x56>
+            if (!ch) return;
+  8003f1:	40 84 ff             	test   %dil,%dil
+  8003f4:	0f 84 b1 06 00 00    	je     800aab <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003fa:	40 0f b6 ff          	movzbl %dil,%edi
+  8003fe:	4c 89 ee             	mov    %r13,%rsi
+  800401:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800404:	4c 89 e3             	mov    %r12,%rbx
+  800407:	eb db                	jmp    8003e4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800409:	be 00 00 00 00       	mov    $0x0,%esi
+  80040e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800412:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800417:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800424:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800428:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80042d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800432:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800435:	83 e8 23             	sub    $0x23,%eax
+  800438:	3c 57                	cmp    $0x57,%al
+  80043a:	0f 87 51 06 00 00    	ja     800a91 <vprintfmt+0x6de>
+  800440:	0f b6 c0             	movzbl %al,%eax
+  800443:	48 b9 80 3a 80 00 00 	movabs $0x803a80,%rcx
+  80044a:	00 00 00 
+  80044d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800450:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800453:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800457:	eb cf                	jmp    800428 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+  80045c:	be 01 00 00 00       	mov    $0x1,%esi
+  800461:	eb c5                	jmp    800428 <vprintfmt+0x75>
+            padc = ch;
+  800463:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800467:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80046a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046d:	eb b9                	jmp    800428 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800472:	83 f8 2f             	cmp    $0x2f,%eax
+  800475:	77 24                	ja     80049b <vprintfmt+0xe8>
+  800477:	89 c1                	mov    %eax,%ecx
+  800479:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80047d:	83 c0 08             	add    $0x8,%eax
+  800480:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800483:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800486:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800489:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80048d:	79 99                	jns    800428 <vprintfmt+0x75>
+                width = precision;
+  80048f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800493:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800499:	eb 8d                	jmp    800428 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80049b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a7:	eb da                	jmp    800483 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ae:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004b2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b8:	3c 39                	cmp    $0x39,%al
+  8004ba:	77 1c                	ja     8004d8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004bc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004c0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c4:	0f b6 c0             	movzbl %al,%eax
+  8004c7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004cc:	0f b6 03             	movzbl (%rbx),%eax
+  8004cf:	3c 39                	cmp    $0x39,%al
+  8004d1:	76 e9                	jbe    8004bc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d6:	eb b1                	jmp    800489 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d8:	49 89 dc             	mov    %rbx,%r12
+  8004db:	eb ac                	jmp    800489 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004dd:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004e0:	85 c9                	test   %ecx,%ecx
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	0f 49 c1             	cmovns %ecx,%eax
+  8004ea:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f0:	e9 33 ff ff ff       	jmp    800428 <vprintfmt+0x75>
+            lflag++;
+  8004f5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004fb:	e9 28 ff ff ff       	jmp    800428 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800500:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800503:	83 f8 2f             	cmp    $0x2f,%eax
+  800506:	77 19                	ja     800521 <vprintfmt+0x16e>
+  800508:	89 c2                	mov    %eax,%edx
+  80050a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80050e:	83 c0 08             	add    $0x8,%eax
+  800511:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800514:	8b 3a                	mov    (%rdx),%edi
+  800516:	4c 89 ee             	mov    %r13,%rsi
+  800519:	41 ff d6             	call   *%r14
+            break;
+  80051c:	e9 c3 fe ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800521:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800525:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800529:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052d:	eb e5                	jmp    800514 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800532:	83 f8 2f             	cmp    $0x2f,%eax
+  800535:	77 5a                	ja     800591 <vprintfmt+0x1de>
+  800537:	89 c2                	mov    %eax,%edx
+  800539:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053d:	83 c0 08             	add    $0x8,%eax
+  800540:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800543:	8b 02                	mov    (%rdx),%eax
+  800545:	89 c1                	mov    %eax,%ecx
+  800547:	f7 d9                	neg    %ecx
+  800549:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80054c:	83 f9 14             	cmp    $0x14,%ecx
+  80054f:	7f 4e                	jg     80059f <vprintfmt+0x1ec>
+  800551:	48 63 c1             	movslq %ecx,%rax
+  800554:	48 ba 40 3d 80 00 00 	movabs $0x803d40,%rdx
+  80055b:	00 00 00 
+  80055e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800562:	48 85 c0             	test   %rax,%rax
+  800565:	74 38                	je     80059f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800567:	48 89 c1             	mov    %rax,%rcx
+  80056a:	48 ba 39 3f 80 00 00 	movabs $0x803f39,%rdx
+  800571:	00 00 00 
+  800574:	4c 89 ee             	mov    %r13,%rsi
+  800577:	4c 89 f7             	mov    %r14,%rdi
+  80057a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057f:	49 b8 76 03 80 00 00 	movabs $0x800376,%r8
+  800586:	00 00 00 
+  800589:	41 ff d0             	call   *%r8
+  80058c:	e9 53 fe ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800591:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800595:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800599:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059d:	eb a4                	jmp    800543 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059f:	48 ba 09 39 80 00 00 	movabs $0x803909,%rdx
+  8005a6:	00 00 00 
+  8005a9:	4c 89 ee             	mov    %r13,%rsi
+  8005ac:	4c 89 f7             	mov    %r14,%rdi
+  8005af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b4:	49 b8 76 03 80 00 00 	movabs $0x800376,%r8
+  8005bb:	00 00 00 
+  8005be:	41 ff d0             	call   *%r8
+  8005c1:	e9 1e fe ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cc:	77 6c                	ja     80063a <vprintfmt+0x287>
+  8005ce:	89 c2                	mov    %eax,%edx
+  8005d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d4:	83 c0 08             	add    $0x8,%eax
+  8005d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005da:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005dd:	48 85 d2             	test   %rdx,%rdx
+  8005e0:	48 b8 02 39 80 00 00 	movabs $0x803902,%rax
+  8005e7:	00 00 00 
+  8005ea:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005ee:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005f2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f6:	7e 06                	jle    8005fe <vprintfmt+0x24b>
+  8005f8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005fc:	75 4a                	jne    800648 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fe:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800602:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800606:	0f b6 00             	movzbl (%rax),%eax
+  800609:	84 c0                	test   %al,%al
+  80060b:	0f 85 9a 00 00 00    	jne    8006ab <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800611:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800614:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800618:	85 c0                	test   %eax,%eax
+  80061a:	0f 8e c4 fd ff ff    	jle    8003e4 <vprintfmt+0x31>
+  800620:	4c 89 ee             	mov    %r13,%rsi
+  800623:	bf 20 00 00 00       	mov    $0x20,%edi
+  800628:	41 ff d6             	call   *%r14
+  80062b:	41 83 ec 01          	sub    $0x1,%r12d
+  80062f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800633:	75 eb                	jne    800620 <vprintfmt+0x26d>
+  800635:	e9 aa fd ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80063a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800642:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800646:	eb 92                	jmp    8005da <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800648:	49 63 f7             	movslq %r15d,%rsi
+  80064b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80064f:	48 b8 65 0b 80 00 00 	movabs $0x800b65,%rax
+  800656:	00 00 00 
+  800659:	ff d0                	call   *%rax
+  80065b:	48 89 c2             	mov    %rax,%rdx
+  80065e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800661:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800663:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800666:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800669:	85 c0                	test   %eax,%eax
+  80066b:	7e 91                	jle    8005fe <vprintfmt+0x24b>
+  80066d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800672:	4c 89 ee             	mov    %r13,%rsi
+  800675:	44 89 e7             	mov    %r12d,%edi
+  800678:	41 ff d6             	call   *%r14
+  80067b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80067f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800682:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800685:	75 eb                	jne    800672 <vprintfmt+0x2bf>
+  800687:	e9 72 ff ff ff       	jmp    8005fe <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80068c:	0f b6 f8             	movzbl %al,%edi
+  80068f:	4c 89 ee             	mov    %r13,%rsi
+  800692:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800695:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800699:	49 83 c4 01          	add    $0x1,%r12
+  80069d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a3:	84 c0                	test   %al,%al
+  8006a5:	0f 84 66 ff ff ff    	je     800611 <vprintfmt+0x25e>
+  8006ab:	45 85 ff             	test   %r15d,%r15d
+  8006ae:	78 0a                	js     8006ba <vprintfmt+0x307>
+  8006b0:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b4:	0f 88 57 ff ff ff    	js     800611 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ba:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006be:	74 cc                	je     80068c <vprintfmt+0x2d9>
+  8006c0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006c3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006c8:	80 fa 5e             	cmp    $0x5e,%dl
+  8006cb:	77 c2                	ja     80068f <vprintfmt+0x2dc>
+  8006cd:	eb bd                	jmp    80068c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006cf:	40 84 f6             	test   %sil,%sil
+  8006d2:	75 26                	jne    8006fa <vprintfmt+0x347>
+    switch (lflag) {
+  8006d4:	85 d2                	test   %edx,%edx
+  8006d6:	74 59                	je     800731 <vprintfmt+0x37e>
+  8006d8:	83 fa 01             	cmp    $0x1,%edx
+  8006db:	74 7b                	je     800758 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e3:	0f 87 96 00 00 00    	ja     80077f <vprintfmt+0x3cc>
+  8006e9:	89 c2                	mov    %eax,%edx
+  8006eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ef:	83 c0 08             	add    $0x8,%eax
+  8006f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f5:	4c 8b 22             	mov    (%rdx),%r12
+  8006f8:	eb 17                	jmp    800711 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800700:	77 21                	ja     800723 <vprintfmt+0x370>
+  800702:	89 c2                	mov    %eax,%edx
+  800704:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800708:	83 c0 08             	add    $0x8,%eax
+  80070b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800711:	4d 85 e4             	test   %r12,%r12
+  800714:	78 7a                	js     800790 <vprintfmt+0x3dd>
+            num = i;
+  800716:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800719:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80071e:	e9 50 02 00 00       	jmp    800973 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800723:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800727:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072f:	eb dd                	jmp    80070e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800731:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800734:	83 f8 2f             	cmp    $0x2f,%eax
+  800737:	77 11                	ja     80074a <vprintfmt+0x397>
+  800739:	89 c2                	mov    %eax,%edx
+  80073b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073f:	83 c0 08             	add    $0x8,%eax
+  800742:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800745:	4c 63 22             	movslq (%rdx),%r12
+  800748:	eb c7                	jmp    800711 <vprintfmt+0x35e>
+  80074a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800752:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800756:	eb ed                	jmp    800745 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800758:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075b:	83 f8 2f             	cmp    $0x2f,%eax
+  80075e:	77 11                	ja     800771 <vprintfmt+0x3be>
+  800760:	89 c2                	mov    %eax,%edx
+  800762:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800766:	83 c0 08             	add    $0x8,%eax
+  800769:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076c:	4c 8b 22             	mov    (%rdx),%r12
+  80076f:	eb a0                	jmp    800711 <vprintfmt+0x35e>
+  800771:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800775:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800779:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077d:	eb ed                	jmp    80076c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80077f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800783:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800787:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078b:	e9 65 ff ff ff       	jmp    8006f5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800790:	4c 89 ee             	mov    %r13,%rsi
+  800793:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800798:	41 ff d6             	call   *%r14
+                i = -i;
+  80079b:	49 f7 dc             	neg    %r12
+  80079e:	e9 73 ff ff ff       	jmp    800716 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a3:	40 84 f6             	test   %sil,%sil
+  8007a6:	75 32                	jne    8007da <vprintfmt+0x427>
+    switch (lflag) {
+  8007a8:	85 d2                	test   %edx,%edx
+  8007aa:	74 5d                	je     800809 <vprintfmt+0x456>
+  8007ac:	83 fa 01             	cmp    $0x1,%edx
+  8007af:	0f 84 82 00 00 00    	je     800837 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bb:	0f 87 a5 00 00 00    	ja     800866 <vprintfmt+0x4b3>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d5:	e9 99 01 00 00       	jmp    800973 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e0:	77 19                	ja     8007fb <vprintfmt+0x448>
+  8007e2:	89 c2                	mov    %eax,%edx
+  8007e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e8:	83 c0 08             	add    $0x8,%eax
+  8007eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007f6:	e9 78 01 00 00       	jmp    800973 <vprintfmt+0x5c0>
+  8007fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800803:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800807:	eb e5                	jmp    8007ee <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	77 18                	ja     800829 <vprintfmt+0x476>
+  800811:	89 c2                	mov    %eax,%edx
+  800813:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800817:	83 c0 08             	add    $0x8,%eax
+  80081a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80081f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800824:	e9 4a 01 00 00       	jmp    800973 <vprintfmt+0x5c0>
+  800829:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800831:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800835:	eb e6                	jmp    80081d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800837:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083a:	83 f8 2f             	cmp    $0x2f,%eax
+  80083d:	77 19                	ja     800858 <vprintfmt+0x4a5>
+  80083f:	89 c2                	mov    %eax,%edx
+  800841:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800845:	83 c0 08             	add    $0x8,%eax
+  800848:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80084e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800853:	e9 1b 01 00 00       	jmp    800973 <vprintfmt+0x5c0>
+  800858:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800860:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800864:	eb e5                	jmp    80084b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800866:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800872:	e9 56 ff ff ff       	jmp    8007cd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800877:	40 84 f6             	test   %sil,%sil
+  80087a:	75 2e                	jne    8008aa <vprintfmt+0x4f7>
+    switch (lflag) {
+  80087c:	85 d2                	test   %edx,%edx
+  80087e:	74 59                	je     8008d9 <vprintfmt+0x526>
+  800880:	83 fa 01             	cmp    $0x1,%edx
+  800883:	74 7f                	je     800904 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	0f 87 9f 00 00 00    	ja     800930 <vprintfmt+0x57d>
+  800891:	89 c2                	mov    %eax,%edx
+  800893:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800897:	83 c0 08             	add    $0x8,%eax
+  80089a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a5:	e9 c9 00 00 00       	jmp    800973 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b0:	77 19                	ja     8008cb <vprintfmt+0x518>
+  8008b2:	89 c2                	mov    %eax,%edx
+  8008b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b8:	83 c0 08             	add    $0x8,%eax
+  8008bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008be:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c6:	e9 a8 00 00 00       	jmp    800973 <vprintfmt+0x5c0>
+  8008cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d7:	eb e5                	jmp    8008be <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008df:	77 15                	ja     8008f6 <vprintfmt+0x543>
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e7:	83 c0 08             	add    $0x8,%eax
+  8008ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ed:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008ef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f4:	eb 7d                	jmp    800973 <vprintfmt+0x5c0>
+  8008f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800902:	eb e9                	jmp    8008ed <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800904:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800907:	83 f8 2f             	cmp    $0x2f,%eax
+  80090a:	77 16                	ja     800922 <vprintfmt+0x56f>
+  80090c:	89 c2                	mov    %eax,%edx
+  80090e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800912:	83 c0 08             	add    $0x8,%eax
+  800915:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800918:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80091b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800920:	eb 51                	jmp    800973 <vprintfmt+0x5c0>
+  800922:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800926:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092e:	eb e8                	jmp    800918 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800930:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800934:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800938:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093c:	e9 5c ff ff ff       	jmp    80089d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800941:	4c 89 ee             	mov    %r13,%rsi
+  800944:	bf 30 00 00 00       	mov    $0x30,%edi
+  800949:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80094c:	4c 89 ee             	mov    %r13,%rsi
+  80094f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800954:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800957:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095a:	83 f8 2f             	cmp    $0x2f,%eax
+  80095d:	77 47                	ja     8009a6 <vprintfmt+0x5f3>
+  80095f:	89 c2                	mov    %eax,%edx
+  800961:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800965:	83 c0 08             	add    $0x8,%eax
+  800968:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800973:	48 83 ec 08          	sub    $0x8,%rsp
+  800977:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80097b:	0f 94 c0             	sete   %al
+  80097e:	0f b6 c0             	movzbl %al,%eax
+  800981:	50                   	push   %rax
+  800982:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800987:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80098b:	4c 89 ee             	mov    %r13,%rsi
+  80098e:	4c 89 f7             	mov    %r14,%rdi
+  800991:	48 b8 a8 02 80 00 00 	movabs $0x8002a8,%rax
+  800998:	00 00 00 
+  80099b:	ff d0                	call   *%rax
+            break;
+  80099d:	48 83 c4 10          	add    $0x10,%rsp
+  8009a1:	e9 3e fa ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb b7                	jmp    80096b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b4:	40 84 f6             	test   %sil,%sil
+  8009b7:	75 2b                	jne    8009e4 <vprintfmt+0x631>
+    switch (lflag) {
+  8009b9:	85 d2                	test   %edx,%edx
+  8009bb:	74 56                	je     800a13 <vprintfmt+0x660>
+  8009bd:	83 fa 01             	cmp    $0x1,%edx
+  8009c0:	74 7f                	je     800a41 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c8:	0f 87 a2 00 00 00    	ja     800a70 <vprintfmt+0x6bd>
+  8009ce:	89 c2                	mov    %eax,%edx
+  8009d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d4:	83 c0 08             	add    $0x8,%eax
+  8009d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009da:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e2:	eb 8f                	jmp    800973 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ea:	77 19                	ja     800a05 <vprintfmt+0x652>
+  8009ec:	89 c2                	mov    %eax,%edx
+  8009ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f2:	83 c0 08             	add    $0x8,%eax
+  8009f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a00:	e9 6e ff ff ff       	jmp    800973 <vprintfmt+0x5c0>
+  800a05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a11:	eb e5                	jmp    8009f8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	77 18                	ja     800a33 <vprintfmt+0x680>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a27:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a29:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a2e:	e9 40 ff ff ff       	jmp    800973 <vprintfmt+0x5c0>
+  800a33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3f:	eb e6                	jmp    800a27 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a44:	83 f8 2f             	cmp    $0x2f,%eax
+  800a47:	77 19                	ja     800a62 <vprintfmt+0x6af>
+  800a49:	89 c2                	mov    %eax,%edx
+  800a4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4f:	83 c0 08             	add    $0x8,%eax
+  800a52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a55:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a58:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a5d:	e9 11 ff ff ff       	jmp    800973 <vprintfmt+0x5c0>
+  800a62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6e:	eb e5                	jmp    800a55 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	e9 59 ff ff ff       	jmp    8009da <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a81:	4c 89 ee             	mov    %r13,%rsi
+  800a84:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a89:	41 ff d6             	call   *%r14
+            break;
+  800a8c:	e9 53 f9 ff ff       	jmp    8003e4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a91:	4c 89 ee             	mov    %r13,%rsi
+  800a94:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a99:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a9c:	48 83 eb 01          	sub    $0x1,%rbx
+  800aa0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa4:	75 f6                	jne    800a9c <vprintfmt+0x6e9>
+  800aa6:	e9 39 f9 ff ff       	jmp    8003e4 <vprintfmt+0x31>
+}
+  800aab:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aaf:	5b                   	pop    %rbx
+  800ab0:	41 5c                	pop    %r12
+  800ab2:	41 5d                	pop    %r13
+  800ab4:	41 5e                	pop    %r14
+  800ab6:	41 5f                	pop    %r15
+  800ab8:	5d                   	pop    %rbp
+  800ab9:	c3                   	ret
+
+0000000000800aba <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800aba:	55                   	push   %rbp
+  800abb:	48 89 e5             	mov    %rsp,%rbp
+  800abe:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ac2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800acb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800acf:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ad6:	48 85 ff             	test   %rdi,%rdi
+  800ad9:	74 2b                	je     800b06 <vsnprintf+0x4c>
+  800adb:	48 85 f6             	test   %rsi,%rsi
+  800ade:	74 26                	je     800b06 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ae0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae4:	48 bf 5e 03 80 00 00 	movabs $0x80035e,%rdi
+  800aeb:	00 00 00 
+  800aee:	48 b8 b3 03 80 00 00 	movabs $0x8003b3,%rax
+  800af5:	00 00 00 
+  800af8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800afa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afe:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b01:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0b:	eb f7                	jmp    800b04 <vsnprintf+0x4a>
+
+0000000000800b0d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b0d:	55                   	push   %rbp
+  800b0e:	48 89 e5             	mov    %rsp,%rbp
+  800b11:	48 83 ec 50          	sub    $0x50,%rsp
+  800b15:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b19:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b1d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b21:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b28:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b30:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b34:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b38:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b3c:	48 b8 ba 0a 80 00 00 	movabs $0x800aba,%rax
+  800b43:	00 00 00 
+  800b46:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b48:	c9                   	leave
+  800b49:	c3                   	ret
+
+0000000000800b4a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b4a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b4d:	74 10                	je     800b5f <strlen+0x15>
+    size_t n = 0;
+  800b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b54:	48 83 c0 01          	add    $0x1,%rax
+  800b58:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b5c:	75 f6                	jne    800b54 <strlen+0xa>
+  800b5e:	c3                   	ret
+    size_t n = 0;
+  800b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b64:	c3                   	ret
+
+0000000000800b65 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b65:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b68:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b6d:	48 85 f6             	test   %rsi,%rsi
+  800b70:	74 11                	je     800b83 <strnlen+0x1e>
+  800b72:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b76:	74 0c                	je     800b84 <strnlen+0x1f>
+  800b78:	48 83 c2 01          	add    $0x1,%rdx
+  800b7c:	48 39 d0             	cmp    %rdx,%rax
+  800b7f:	75 f1                	jne    800b72 <strnlen+0xd>
+  800b81:	eb 04                	jmp    800b87 <strnlen+0x22>
+  800b83:	c3                   	ret
+  800b84:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b87:	c3                   	ret
+
+0000000000800b88 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b88:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b90:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b94:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b97:	48 83 c2 01          	add    $0x1,%rdx
+  800b9b:	84 c9                	test   %cl,%cl
+  800b9d:	75 f1                	jne    800b90 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b9f:	c3                   	ret
+
+0000000000800ba0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ba0:	55                   	push   %rbp
+  800ba1:	48 89 e5             	mov    %rsp,%rbp
+  800ba4:	41 54                	push   %r12
+  800ba6:	53                   	push   %rbx
+  800ba7:	48 89 fb             	mov    %rdi,%rbx
+  800baa:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bad:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  800bb4:	00 00 00 
+  800bb7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bbd:	4c 89 e6             	mov    %r12,%rsi
+  800bc0:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  800bc7:	00 00 00 
+  800bca:	ff d0                	call   *%rax
+    return dst;
+}
+  800bcc:	48 89 d8             	mov    %rbx,%rax
+  800bcf:	5b                   	pop    %rbx
+  800bd0:	41 5c                	pop    %r12
+  800bd2:	5d                   	pop    %rbp
+  800bd3:	c3                   	ret
+
+0000000000800bd4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd7:	48 85 d2             	test   %rdx,%rdx
+  800bda:	74 1f                	je     800bfb <strncpy+0x27>
+  800bdc:	48 01 fa             	add    %rdi,%rdx
+  800bdf:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800be2:	48 83 c1 01          	add    $0x1,%rcx
+  800be6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bea:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bee:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bf2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bf6:	48 39 ca             	cmp    %rcx,%rdx
+  800bf9:	75 e7                	jne    800be2 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bfb:	c3                   	ret
+
+0000000000800bfc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bfc:	48 89 f8             	mov    %rdi,%rax
+  800bff:	48 85 d2             	test   %rdx,%rdx
+  800c02:	74 24                	je     800c28 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c04:	48 83 ea 01          	sub    $0x1,%rdx
+  800c08:	74 1b                	je     800c25 <strlcpy+0x29>
+  800c0a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c0e:	0f b6 16             	movzbl (%rsi),%edx
+  800c11:	84 d2                	test   %dl,%dl
+  800c13:	74 10                	je     800c25 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c15:	48 83 c6 01          	add    $0x1,%rsi
+  800c19:	48 83 c0 01          	add    $0x1,%rax
+  800c1d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c20:	48 39 c8             	cmp    %rcx,%rax
+  800c23:	75 e9                	jne    800c0e <strlcpy+0x12>
+        *dst = '\0';
+  800c25:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c28:	48 29 f8             	sub    %rdi,%rax
+}
+  800c2b:	c3                   	ret
+
+0000000000800c2c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c2c:	0f b6 07             	movzbl (%rdi),%eax
+  800c2f:	84 c0                	test   %al,%al
+  800c31:	74 13                	je     800c46 <strcmp+0x1a>
+  800c33:	38 06                	cmp    %al,(%rsi)
+  800c35:	75 0f                	jne    800c46 <strcmp+0x1a>
+  800c37:	48 83 c7 01          	add    $0x1,%rdi
+  800c3b:	48 83 c6 01          	add    $0x1,%rsi
+  800c3f:	0f b6 07             	movzbl (%rdi),%eax
+  800c42:	84 c0                	test   %al,%al
+  800c44:	75 ed                	jne    800c33 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c46:	0f b6 c0             	movzbl %al,%eax
+  800c49:	0f b6 16             	movzbl (%rsi),%edx
+  800c4c:	29 d0                	sub    %edx,%eax
+}
+  800c4e:	c3                   	ret
+
+0000000000800c4f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c4f:	48 85 d2             	test   %rdx,%rdx
+  800c52:	74 1f                	je     800c73 <strncmp+0x24>
+  800c54:	0f b6 07             	movzbl (%rdi),%eax
+  800c57:	84 c0                	test   %al,%al
+  800c59:	74 1e                	je     800c79 <strncmp+0x2a>
+  800c5b:	3a 06                	cmp    (%rsi),%al
+  800c5d:	75 1a                	jne    800c79 <strncmp+0x2a>
+  800c5f:	48 83 c7 01          	add    $0x1,%rdi
+  800c63:	48 83 c6 01          	add    $0x1,%rsi
+  800c67:	48 83 ea 01          	sub    $0x1,%rdx
+  800c6b:	75 e7                	jne    800c54 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c72:	c3                   	ret
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c78:	c3                   	ret
+  800c79:	48 85 d2             	test   %rdx,%rdx
+  800c7c:	74 09                	je     800c87 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7e:	0f b6 07             	movzbl (%rdi),%eax
+  800c81:	0f b6 16             	movzbl (%rsi),%edx
+  800c84:	29 d0                	sub    %edx,%eax
+  800c86:	c3                   	ret
+    if (!n) return 0;
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8c:	c3                   	ret
+
+0000000000800c8d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c8d:	0f b6 17             	movzbl (%rdi),%edx
+  800c90:	84 d2                	test   %dl,%dl
+  800c92:	74 18                	je     800cac <strchr+0x1f>
+        if (*str == c) {
+  800c94:	0f be d2             	movsbl %dl,%edx
+  800c97:	39 f2                	cmp    %esi,%edx
+  800c99:	74 17                	je     800cb2 <strchr+0x25>
+    for (; *str; str++) {
+  800c9b:	48 83 c7 01          	add    $0x1,%rdi
+  800c9f:	0f b6 17             	movzbl (%rdi),%edx
+  800ca2:	84 d2                	test   %dl,%dl
+  800ca4:	75 ee                	jne    800c94 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cab:	c3                   	ret
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb1:	c3                   	ret
+  800cb2:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb5:	c3                   	ret
+
+0000000000800cb6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cb6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb9:	0f b6 17             	movzbl (%rdi),%edx
+  800cbc:	84 d2                	test   %dl,%dl
+  800cbe:	74 13                	je     800cd3 <strfind+0x1d>
+  800cc0:	0f be d2             	movsbl %dl,%edx
+  800cc3:	39 f2                	cmp    %esi,%edx
+  800cc5:	74 0b                	je     800cd2 <strfind+0x1c>
+  800cc7:	48 83 c0 01          	add    $0x1,%rax
+  800ccb:	0f b6 10             	movzbl (%rax),%edx
+  800cce:	84 d2                	test   %dl,%dl
+  800cd0:	75 ee                	jne    800cc0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cd2:	c3                   	ret
+  800cd3:	c3                   	ret
+
+0000000000800cd4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cd4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cd7:	48 89 f8             	mov    %rdi,%rax
+  800cda:	48 f7 d8             	neg    %rax
+  800cdd:	83 e0 07             	and    $0x7,%eax
+  800ce0:	49 89 d1             	mov    %rdx,%r9
+  800ce3:	49 29 c1             	sub    %rax,%r9
+  800ce6:	78 36                	js     800d1e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ce8:	40 0f b6 c6          	movzbl %sil,%eax
+  800cec:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cf3:	01 01 01 
+  800cf6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cfa:	40 f6 c7 07          	test   $0x7,%dil
+  800cfe:	75 38                	jne    800d38 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d00:	4c 89 c9             	mov    %r9,%rcx
+  800d03:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d07:	74 0c                	je     800d15 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d09:	fc                   	cld
+  800d0a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d0d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d11:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d15:	4d 85 c9             	test   %r9,%r9
+  800d18:	75 45                	jne    800d5f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d1a:	4c 89 c0             	mov    %r8,%rax
+  800d1d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d1e:	48 85 d2             	test   %rdx,%rdx
+  800d21:	74 f7                	je     800d1a <memset+0x46>
+  800d23:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d26:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d29:	48 83 c0 01          	add    $0x1,%rax
+  800d2d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d31:	48 39 c2             	cmp    %rax,%rdx
+  800d34:	75 f3                	jne    800d29 <memset+0x55>
+  800d36:	eb e2                	jmp    800d1a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d38:	40 f6 c7 01          	test   $0x1,%dil
+  800d3c:	74 06                	je     800d44 <memset+0x70>
+  800d3e:	88 07                	mov    %al,(%rdi)
+  800d40:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d44:	40 f6 c7 02          	test   $0x2,%dil
+  800d48:	74 07                	je     800d51 <memset+0x7d>
+  800d4a:	66 89 07             	mov    %ax,(%rdi)
+  800d4d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d51:	40 f6 c7 04          	test   $0x4,%dil
+  800d55:	74 a9                	je     800d00 <memset+0x2c>
+  800d57:	89 07                	mov    %eax,(%rdi)
+  800d59:	48 83 c7 04          	add    $0x4,%rdi
+  800d5d:	eb a1                	jmp    800d00 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d5f:	41 f6 c1 04          	test   $0x4,%r9b
+  800d63:	74 06                	je     800d6b <memset+0x97>
+  800d65:	89 07                	mov    %eax,(%rdi)
+  800d67:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d6b:	41 f6 c1 02          	test   $0x2,%r9b
+  800d6f:	74 07                	je     800d78 <memset+0xa4>
+  800d71:	66 89 07             	mov    %ax,(%rdi)
+  800d74:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d78:	41 f6 c1 01          	test   $0x1,%r9b
+  800d7c:	74 9c                	je     800d1a <memset+0x46>
+  800d7e:	88 07                	mov    %al,(%rdi)
+  800d80:	eb 98                	jmp    800d1a <memset+0x46>
+
+0000000000800d82 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d82:	48 89 f8             	mov    %rdi,%rax
+  800d85:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d88:	48 39 fe             	cmp    %rdi,%rsi
+  800d8b:	73 3b                	jae    800dc8 <memmove+0x46>
+  800d8d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d91:	48 39 d7             	cmp    %rdx,%rdi
+  800d94:	73 32                	jae    800dc8 <memmove+0x46>
+        s += n;
+        d += n;
+  800d96:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d9a:	48 89 d6             	mov    %rdx,%rsi
+  800d9d:	48 09 fe             	or     %rdi,%rsi
+  800da0:	48 09 ce             	or     %rcx,%rsi
+  800da3:	40 f6 c6 07          	test   $0x7,%sil
+  800da7:	75 12                	jne    800dbb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800da9:	48 83 ef 08          	sub    $0x8,%rdi
+  800dad:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800db1:	48 c1 e9 03          	shr    $0x3,%rcx
+  800db5:	fd                   	std
+  800db6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800db9:	fc                   	cld
+  800dba:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dbb:	48 83 ef 01          	sub    $0x1,%rdi
+  800dbf:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dc3:	fd                   	std
+  800dc4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dc6:	eb f1                	jmp    800db9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dc8:	48 89 f2             	mov    %rsi,%rdx
+  800dcb:	48 09 c2             	or     %rax,%rdx
+  800dce:	48 09 ca             	or     %rcx,%rdx
+  800dd1:	f6 c2 07             	test   $0x7,%dl
+  800dd4:	75 0c                	jne    800de2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dd6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dda:	48 89 c7             	mov    %rax,%rdi
+  800ddd:	fc                   	cld
+  800dde:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800de1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800de2:	48 89 c7             	mov    %rax,%rdi
+  800de5:	fc                   	cld
+  800de6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800de8:	c3                   	ret
+
+0000000000800de9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800de9:	55                   	push   %rbp
+  800dea:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ded:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800df4:	00 00 00 
+  800df7:	ff d0                	call   *%rax
+}
+  800df9:	5d                   	pop    %rbp
+  800dfa:	c3                   	ret
+
+0000000000800dfb <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dfb:	55                   	push   %rbp
+  800dfc:	48 89 e5             	mov    %rsp,%rbp
+  800dff:	41 57                	push   %r15
+  800e01:	41 56                	push   %r14
+  800e03:	41 55                	push   %r13
+  800e05:	41 54                	push   %r12
+  800e07:	53                   	push   %rbx
+  800e08:	48 83 ec 08          	sub    $0x8,%rsp
+  800e0c:	49 89 fe             	mov    %rdi,%r14
+  800e0f:	49 89 f7             	mov    %rsi,%r15
+  800e12:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e15:	48 89 f7             	mov    %rsi,%rdi
+  800e18:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  800e1f:	00 00 00 
+  800e22:	ff d0                	call   *%rax
+  800e24:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e27:	48 89 de             	mov    %rbx,%rsi
+  800e2a:	4c 89 f7             	mov    %r14,%rdi
+  800e2d:	48 b8 65 0b 80 00 00 	movabs $0x800b65,%rax
+  800e34:	00 00 00 
+  800e37:	ff d0                	call   *%rax
+  800e39:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e3c:	48 39 c3             	cmp    %rax,%rbx
+  800e3f:	74 36                	je     800e77 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e41:	48 89 d8             	mov    %rbx,%rax
+  800e44:	4c 29 e8             	sub    %r13,%rax
+  800e47:	49 39 c4             	cmp    %rax,%r12
+  800e4a:	73 31                	jae    800e7d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e4c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e51:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e55:	4c 89 fe             	mov    %r15,%rsi
+  800e58:	48 b8 e9 0d 80 00 00 	movabs $0x800de9,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e64:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e68:	48 83 c4 08          	add    $0x8,%rsp
+  800e6c:	5b                   	pop    %rbx
+  800e6d:	41 5c                	pop    %r12
+  800e6f:	41 5d                	pop    %r13
+  800e71:	41 5e                	pop    %r14
+  800e73:	41 5f                	pop    %r15
+  800e75:	5d                   	pop    %rbp
+  800e76:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e77:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e7b:	eb eb                	jmp    800e68 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e7d:	48 83 eb 01          	sub    $0x1,%rbx
+  800e81:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e85:	48 89 da             	mov    %rbx,%rdx
+  800e88:	4c 89 fe             	mov    %r15,%rsi
+  800e8b:	48 b8 e9 0d 80 00 00 	movabs $0x800de9,%rax
+  800e92:	00 00 00 
+  800e95:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e97:	49 01 de             	add    %rbx,%r14
+  800e9a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e9f:	eb c3                	jmp    800e64 <strlcat+0x69>
+
+0000000000800ea1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ea1:	48 85 d2             	test   %rdx,%rdx
+  800ea4:	74 2d                	je     800ed3 <memcmp+0x32>
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eab:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eaf:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eb4:	44 38 c1             	cmp    %r8b,%cl
+  800eb7:	75 0f                	jne    800ec8 <memcmp+0x27>
+    while (n-- > 0) {
+  800eb9:	48 83 c0 01          	add    $0x1,%rax
+  800ebd:	48 39 c2             	cmp    %rax,%rdx
+  800ec0:	75 e9                	jne    800eab <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ec8:	0f b6 c1             	movzbl %cl,%eax
+  800ecb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ecf:	44 29 c0             	sub    %r8d,%eax
+  800ed2:	c3                   	ret
+    return 0;
+  800ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed8:	c3                   	ret
+
+0000000000800ed9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ed9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800edd:	48 39 c7             	cmp    %rax,%rdi
+  800ee0:	73 0f                	jae    800ef1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ee2:	40 38 37             	cmp    %sil,(%rdi)
+  800ee5:	74 0e                	je     800ef5 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ee7:	48 83 c7 01          	add    $0x1,%rdi
+  800eeb:	48 39 f8             	cmp    %rdi,%rax
+  800eee:	75 f2                	jne    800ee2 <memfind+0x9>
+  800ef0:	c3                   	ret
+  800ef1:	48 89 f8             	mov    %rdi,%rax
+  800ef4:	c3                   	ret
+  800ef5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ef8:	c3                   	ret
+
+0000000000800ef9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ef9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800efc:	0f b6 37             	movzbl (%rdi),%esi
+  800eff:	40 80 fe 20          	cmp    $0x20,%sil
+  800f03:	74 06                	je     800f0b <strtol+0x12>
+  800f05:	40 80 fe 09          	cmp    $0x9,%sil
+  800f09:	75 13                	jne    800f1e <strtol+0x25>
+  800f0b:	48 83 c7 01          	add    $0x1,%rdi
+  800f0f:	0f b6 37             	movzbl (%rdi),%esi
+  800f12:	40 80 fe 20          	cmp    $0x20,%sil
+  800f16:	74 f3                	je     800f0b <strtol+0x12>
+  800f18:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1c:	74 ed                	je     800f0b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f1e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f21:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f24:	3c 01                	cmp    $0x1,%al
+  800f26:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f2a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f30:	75 0f                	jne    800f41 <strtol+0x48>
+  800f32:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f35:	74 14                	je     800f4b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f37:	85 d2                	test   %edx,%edx
+  800f39:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f3e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f41:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f46:	4c 63 ca             	movslq %edx,%r9
+  800f49:	eb 36                	jmp    800f81 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f4b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f4f:	74 0f                	je     800f60 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f51:	85 d2                	test   %edx,%edx
+  800f53:	75 ec                	jne    800f41 <strtol+0x48>
+        s++;
+  800f55:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f59:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f5e:	eb e1                	jmp    800f41 <strtol+0x48>
+        s += 2;
+  800f60:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f64:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f69:	eb d6                	jmp    800f41 <strtol+0x48>
+            dig -= '0';
+  800f6b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f6e:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f72:	41 39 d0             	cmp    %edx,%r8d
+  800f75:	7d 21                	jge    800f98 <strtol+0x9f>
+        val = val * base + dig;
+  800f77:	49 0f af c1          	imul   %r9,%rax
+  800f7b:	0f b6 c9             	movzbl %cl,%ecx
+  800f7e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f81:	48 83 c7 01          	add    $0x1,%rdi
+  800f85:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f89:	80 f9 39             	cmp    $0x39,%cl
+  800f8c:	76 dd                	jbe    800f6b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f8e:	80 f9 7b             	cmp    $0x7b,%cl
+  800f91:	77 05                	ja     800f98 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f93:	83 e9 57             	sub    $0x57,%ecx
+  800f96:	eb d6                	jmp    800f6e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f98:	4d 85 d2             	test   %r10,%r10
+  800f9b:	74 03                	je     800fa0 <strtol+0xa7>
+  800f9d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fa0:	48 89 c2             	mov    %rax,%rdx
+  800fa3:	48 f7 da             	neg    %rdx
+  800fa6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800faa:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fae:	c3                   	ret
+
+0000000000800faf <strrev>:
+
+void
+strrev(char *str)
+{
+  800faf:	55                   	push   %rbp
+  800fb0:	48 89 e5             	mov    %rsp,%rbp
+  800fb3:	53                   	push   %rbx
+  800fb4:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb8:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fbb:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fc7:	83 e8 01             	sub    $0x1,%eax
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	7e 22                	jle    800ff0 <strrev+0x41>
+  800fce:	48 98                	cltq
+  800fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800fd5:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800fd9:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800fdd:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800fe1:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fe4:	48 83 c2 01          	add    $0x1,%rdx
+  800fe8:	48 83 e8 01          	sub    $0x1,%rax
+  800fec:	39 c2                	cmp    %eax,%edx
+  800fee:	7c e5                	jl     800fd5 <strrev+0x26>
+	}
+}
+  800ff0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff4:	c9                   	leave
+  800ff5:	c3                   	ret
+
+0000000000800ff6 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800ff6:	85 d2                	test   %edx,%edx
+  800ff8:	0f 84 80 00 00 00    	je     80107e <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  800ffe:	55                   	push   %rbp
+  800fff:	48 89 e5             	mov    %rsp,%rbp
+  801002:	53                   	push   %rbx
+  801003:	48 83 ec 08          	sub    $0x8,%rsp
+  801007:	49 89 f2             	mov    %rsi,%r10
+  80100a:	41 89 d3             	mov    %edx,%r11d
+  80100d:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801010:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801015:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801018:	eb 20                	jmp    80103a <itoa+0x44>
+			str[i++] = '0' + digit;
+  80101a:	41 89 f1             	mov    %esi,%r9d
+  80101d:	83 c2 30             	add    $0x30,%edx
+  801020:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801023:	89 f8                	mov    %edi,%eax
+  801025:	99                   	cltd
+  801026:	f7 f9                	idiv   %ecx
+  801028:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	74 2e                	je     80105c <itoa+0x66>
+  80102e:	83 c6 01             	add    $0x1,%esi
+  801031:	49 83 c0 01          	add    $0x1,%r8
+  801035:	44 39 cb             	cmp    %r9d,%ebx
+  801038:	7e 15                	jle    80104f <itoa+0x59>
+		digit = sum % base;
+  80103a:	89 f8                	mov    %edi,%eax
+  80103c:	99                   	cltd
+  80103d:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  80103f:	83 fa 09             	cmp    $0x9,%edx
+  801042:	7e d6                	jle    80101a <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801044:	41 89 f1             	mov    %esi,%r9d
+  801047:	83 c2 37             	add    $0x37,%edx
+  80104a:	41 88 10             	mov    %dl,(%r8)
+  80104d:	eb d4                	jmp    801023 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  80104f:	41 83 eb 01          	sub    $0x1,%r11d
+  801053:	45 39 cb             	cmp    %r9d,%r11d
+  801056:	75 04                	jne    80105c <itoa+0x66>
+  801058:	85 c0                	test   %eax,%eax
+  80105a:	75 28                	jne    801084 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80105c:	4d 63 c9             	movslq %r9d,%r9
+  80105f:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801064:	4c 89 d7             	mov    %r10,%rdi
+  801067:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  80106e:	00 00 00 
+  801071:	ff d0                	call   *%rax
+	return 0;
+  801073:	b8 00 00 00 00       	mov    $0x0,%eax
+  801078:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107c:	c9                   	leave
+  80107d:	c3                   	ret
+		return -1;
+  80107e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801083:	c3                   	ret
+		return -1;
+  801084:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801089:	eb ed                	jmp    801078 <itoa+0x82>
+
+000000000080108b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80108b:	55                   	push   %rbp
+  80108c:	48 89 e5             	mov    %rsp,%rbp
+  80108f:	53                   	push   %rbx
+  801090:	48 89 fa             	mov    %rdi,%rdx
+  801093:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801096:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80109b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b6:	c9                   	leave
+  8010b7:	c3                   	ret
+
+00000000008010b8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010b8:	55                   	push   %rbp
+  8010b9:	48 89 e5             	mov    %rsp,%rbp
+  8010bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e7:	c9                   	leave
+  8010e8:	c3                   	ret
+
+00000000008010e9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010e9:	55                   	push   %rbp
+  8010ea:	48 89 e5             	mov    %rsp,%rbp
+  8010ed:	53                   	push   %rbx
+  8010ee:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801109:	be 00 00 00 00       	mov    $0x0,%esi
+  80110e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801114:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801116:	48 85 c0             	test   %rax,%rax
+  801119:	7f 06                	jg     801121 <sys_env_destroy+0x38>
+}
+  80111b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111f:	c9                   	leave
+  801120:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801121:	49 89 c0             	mov    %rax,%r8
+  801124:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801129:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  801130:	00 00 00 
+  801133:	be 26 00 00 00       	mov    $0x26,%esi
+  801138:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  80113f:	00 00 00 
+  801142:	b8 00 00 00 00       	mov    $0x0,%eax
+  801147:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  80114e:	00 00 00 
+  801151:	41 ff d1             	call   *%r9
+
+0000000000801154 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801159:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80115e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801163:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801172:	be 00 00 00 00       	mov    $0x0,%esi
+  801177:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80117f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801183:	c9                   	leave
+  801184:	c3                   	ret
+
+0000000000801185 <sys_yield>:
+
+void
+sys_yield(void) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801194:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801199:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ae:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b4:	c9                   	leave
+  8011b5:	c3                   	ret
+
+00000000008011b6 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011b6:	55                   	push   %rbp
+  8011b7:	48 89 e5             	mov    %rsp,%rbp
+  8011ba:	53                   	push   %rbx
+  8011bb:	48 89 fa             	mov    %rdi,%rdx
+  8011be:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c6:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011cd:	00 00 00 
+  8011d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e6:	c9                   	leave
+  8011e7:	c3                   	ret
+
+00000000008011e8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011e8:	55                   	push   %rbp
+  8011e9:	48 89 e5             	mov    %rsp,%rbp
+  8011ec:	53                   	push   %rbx
+  8011ed:	49 89 f8             	mov    %rdi,%r8
+  8011f0:	48 89 d3             	mov    %rdx,%rbx
+  8011f3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fb:	4c 89 c2             	mov    %r8,%rdx
+  8011fe:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801201:	be 00 00 00 00       	mov    $0x0,%esi
+  801206:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80120e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801212:	c9                   	leave
+  801213:	c3                   	ret
+
+0000000000801214 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801214:	55                   	push   %rbp
+  801215:	48 89 e5             	mov    %rsp,%rbp
+  801218:	53                   	push   %rbx
+  801219:	48 83 ec 08          	sub    $0x8,%rsp
+  80121d:	89 f8                	mov    %edi,%eax
+  80121f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801222:	48 63 f9             	movslq %ecx,%rdi
+  801225:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801228:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80122d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801230:	be 00 00 00 00       	mov    $0x0,%esi
+  801235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80123d:	48 85 c0             	test   %rax,%rax
+  801240:	7f 06                	jg     801248 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801246:	c9                   	leave
+  801247:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801248:	49 89 c0             	mov    %rax,%r8
+  80124b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801250:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  801257:	00 00 00 
+  80125a:	be 26 00 00 00       	mov    $0x26,%esi
+  80125f:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  801266:	00 00 00 
+  801269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126e:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  801275:	00 00 00 
+  801278:	41 ff d1             	call   *%r9
+
+000000000080127b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80127b:	55                   	push   %rbp
+  80127c:	48 89 e5             	mov    %rsp,%rbp
+  80127f:	53                   	push   %rbx
+  801280:	48 83 ec 08          	sub    $0x8,%rsp
+  801284:	89 f8                	mov    %edi,%eax
+  801286:	49 89 f2             	mov    %rsi,%r10
+  801289:	48 89 cf             	mov    %rcx,%rdi
+  80128c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80128f:	48 63 da             	movslq %edx,%rbx
+  801292:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801295:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a2:	48 85 c0             	test   %rax,%rax
+  8012a5:	7f 06                	jg     8012ad <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ab:	c9                   	leave
+  8012ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ad:	49 89 c0             	mov    %rax,%r8
+  8012b0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012b5:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  8012bc:	00 00 00 
+  8012bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c4:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  8012cb:	00 00 00 
+  8012ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d3:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  8012da:	00 00 00 
+  8012dd:	41 ff d1             	call   *%r9
+
+00000000008012e0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012e0:	55                   	push   %rbp
+  8012e1:	48 89 e5             	mov    %rsp,%rbp
+  8012e4:	53                   	push   %rbx
+  8012e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e9:	48 89 f1             	mov    %rsi,%rcx
+  8012ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801307:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801309:	48 85 c0             	test   %rax,%rax
+  80130c:	7f 06                	jg     801314 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80130e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801314:	49 89 c0             	mov    %rax,%r8
+  801317:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80131c:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  801323:	00 00 00 
+  801326:	be 26 00 00 00       	mov    $0x26,%esi
+  80132b:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  801332:	00 00 00 
+  801335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133a:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  801341:	00 00 00 
+  801344:	41 ff d1             	call   *%r9
+
+0000000000801347 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801347:	55                   	push   %rbp
+  801348:	48 89 e5             	mov    %rsp,%rbp
+  80134b:	53                   	push   %rbx
+  80134c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801350:	48 63 ce             	movslq %esi,%rcx
+  801353:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801356:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801360:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801365:	be 00 00 00 00       	mov    $0x0,%esi
+  80136a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801370:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801372:	48 85 c0             	test   %rax,%rax
+  801375:	7f 06                	jg     80137d <sys_env_set_status+0x36>
+}
+  801377:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137b:	c9                   	leave
+  80137c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137d:	49 89 c0             	mov    %rax,%r8
+  801380:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801385:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  80138c:	00 00 00 
+  80138f:	be 26 00 00 00       	mov    $0x26,%esi
+  801394:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  80139b:	00 00 00 
+  80139e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a3:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  8013aa:	00 00 00 
+  8013ad:	41 ff d1             	call   *%r9
+
+00000000008013b0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013b0:	55                   	push   %rbp
+  8013b1:	48 89 e5             	mov    %rsp,%rbp
+  8013b4:	53                   	push   %rbx
+  8013b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013db:	48 85 c0             	test   %rax,%rax
+  8013de:	7f 06                	jg     8013e6 <sys_env_set_trapframe+0x36>
+}
+  8013e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e4:	c9                   	leave
+  8013e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e6:	49 89 c0             	mov    %rax,%r8
+  8013e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013ee:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  8013f5:	00 00 00 
+  8013f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8013fd:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  801404:	00 00 00 
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  801413:	00 00 00 
+  801416:	41 ff d1             	call   *%r9
+
+0000000000801419 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801419:	55                   	push   %rbp
+  80141a:	48 89 e5             	mov    %rsp,%rbp
+  80141d:	53                   	push   %rbx
+  80141e:	48 83 ec 08          	sub    $0x8,%rsp
+  801422:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801428:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801432:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801442:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801444:	48 85 c0             	test   %rax,%rax
+  801447:	7f 06                	jg     80144f <sys_env_set_pgfault_upcall+0x36>
+}
+  801449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144f:	49 89 c0             	mov    %rax,%r8
+  801452:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801457:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  80145e:	00 00 00 
+  801461:	be 26 00 00 00       	mov    $0x26,%esi
+  801466:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  80146d:	00 00 00 
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  80147c:	00 00 00 
+  80147f:	41 ff d1             	call   *%r9
+
+0000000000801482 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801482:	55                   	push   %rbp
+  801483:	48 89 e5             	mov    %rsp,%rbp
+  801486:	53                   	push   %rbx
+  801487:	89 f8                	mov    %edi,%eax
+  801489:	49 89 f1             	mov    %rsi,%r9
+  80148c:	48 89 d3             	mov    %rdx,%rbx
+  80148f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801492:	49 63 f0             	movslq %r8d,%rsi
+  801495:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801498:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a6:	cd 30                	int    $0x30
+}
+  8014a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ac:	c9                   	leave
+  8014ad:	c3                   	ret
+
+00000000008014ae <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014ae:	55                   	push   %rbp
+  8014af:	48 89 e5             	mov    %rsp,%rbp
+  8014b2:	53                   	push   %rbx
+  8014b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b7:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014ba:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c2:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d7:	48 85 c0             	test   %rax,%rax
+  8014da:	7f 06                	jg     8014e2 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e2:	49 89 c0             	mov    %rax,%r8
+  8014e5:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014ea:	48 ba 08 3e 80 00 00 	movabs $0x803e08,%rdx
+  8014f1:	00 00 00 
+  8014f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f9:	48 bf 27 3e 80 00 00 	movabs $0x803e27,%rdi
+  801500:	00 00 00 
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+  801508:	49 b9 84 35 80 00 00 	movabs $0x803584,%r9
+  80150f:	00 00 00 
+  801512:	41 ff d1             	call   *%r9
+
+0000000000801515 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151e:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  801525:	00 00 00 
+  801528:	ff d0                	call   *%rax
+}
+  80152a:	5d                   	pop    %rbp
+  80152b:	c3                   	ret
+
+000000000080152c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80152c:	55                   	push   %rbp
+  80152d:	48 89 e5             	mov    %rsp,%rbp
+  801530:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801531:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801545:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154a:	be 00 00 00 00       	mov    $0x0,%esi
+  80154f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801555:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+
+000000000080155d <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80155d:	55                   	push   %rbp
+  80155e:	48 89 e5             	mov    %rsp,%rbp
+  801561:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801562:	48 63 ce             	movslq %esi,%rcx
+  801565:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801569:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801578:	be 00 00 00 00       	mov    $0x0,%esi
+  80157d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801583:	cd 30                	int    $0x30
+}
+  801585:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+
+000000000080158b <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80158b:	55                   	push   %rbp
+  80158c:	48 89 e5             	mov    %rsp,%rbp
+  80158f:	53                   	push   %rbx
+  801590:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801593:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801597:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b1:	cd 30                	int    $0x30
+}
+  8015b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+00000000008015b9 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	53                   	push   %rbx
+  8015be:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015c1:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015c9:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015dc:	cd 30                	int    $0x30
+}
+  8015de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+
+00000000008015e4 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	41 54                	push   %r12
+  8015ea:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8015eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015f0:	cd 30                	int    $0x30
+  8015f2:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 7e                	js     801677 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  8015f9:	0f 84 80 00 00 00    	je     80167f <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8015ff:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801605:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80160c:	00 00 00 
+  80160f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801614:	89 c2                	mov    %eax,%edx
+  801616:	be 00 00 00 00       	mov    $0x0,%esi
+  80161b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801620:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	0f 88 81 00 00 00    	js     8016b5 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801634:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80163b:	00 00 00 
+  80163e:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801645:	44 89 e7             	mov    %r12d,%edi
+  801648:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+  801654:	85 c0                	test   %eax,%eax
+  801656:	78 65                	js     8016bd <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801658:	be 02 00 00 00       	mov    $0x2,%esi
+  80165d:	44 89 e7             	mov    %r12d,%edi
+  801660:	48 b8 47 13 80 00 00 	movabs $0x801347,%rax
+  801667:	00 00 00 
+  80166a:	ff d0                	call   *%rax
+        return -1;
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801673:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801677:	44 89 e0             	mov    %r12d,%eax
+  80167a:	5b                   	pop    %rbx
+  80167b:	41 5c                	pop    %r12
+  80167d:	5d                   	pop    %rbp
+  80167e:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80167f:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  801686:	00 00 00 
+  801689:	ff d0                	call   *%rax
+  80168b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801690:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801694:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801698:	48 c1 e0 04          	shl    $0x4,%rax
+  80169c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016a3:	00 00 00 
+  8016a6:	48 01 d0             	add    %rdx,%rax
+  8016a9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8016b0:	00 00 00 
+        return 0;
+  8016b3:	eb c2                	jmp    801677 <fork+0x93>
+        return -1;
+  8016b5:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016bb:	eb ba                	jmp    801677 <fork+0x93>
+        return -1;
+  8016bd:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016c3:	eb b2                	jmp    801677 <fork+0x93>
+
+00000000008016c5 <sfork>:
+
+envid_t
+sfork() {
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016c9:	48 ba 35 3e 80 00 00 	movabs $0x803e35,%rdx
+  8016d0:	00 00 00 
+  8016d3:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8016d8:	48 bf 50 3e 80 00 00 	movabs $0x803e50,%rdi
+  8016df:	00 00 00 
+  8016e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e7:	48 b9 84 35 80 00 00 	movabs $0x803584,%rcx
+  8016ee:	00 00 00 
+  8016f1:	ff d1                	call   *%rcx
+
+00000000008016f3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016f3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016fa:	ff ff ff 
+  8016fd:	48 01 f8             	add    %rdi,%rax
+  801700:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801704:	c3                   	ret
+
+0000000000801705 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801705:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80170c:	ff ff ff 
+  80170f:	48 01 f8             	add    %rdi,%rax
+  801712:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801716:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80171c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801720:	c3                   	ret
+
+0000000000801721 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801721:	55                   	push   %rbp
+  801722:	48 89 e5             	mov    %rsp,%rbp
+  801725:	41 57                	push   %r15
+  801727:	41 56                	push   %r14
+  801729:	41 55                	push   %r13
+  80172b:	41 54                	push   %r12
+  80172d:	53                   	push   %rbx
+  80172e:	48 83 ec 08          	sub    $0x8,%rsp
+  801732:	49 89 ff             	mov    %rdi,%r15
+  801735:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80173a:	49 bd 40 32 80 00 00 	movabs $0x803240,%r13
+  801741:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801744:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80174a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80174d:	48 89 df             	mov    %rbx,%rdi
+  801750:	41 ff d5             	call   *%r13
+  801753:	83 e0 04             	and    $0x4,%eax
+  801756:	74 17                	je     80176f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801758:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80175f:	4c 39 f3             	cmp    %r14,%rbx
+  801762:	75 e6                	jne    80174a <fd_alloc+0x29>
+  801764:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80176a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80176f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801772:	48 83 c4 08          	add    $0x8,%rsp
+  801776:	5b                   	pop    %rbx
+  801777:	41 5c                	pop    %r12
+  801779:	41 5d                	pop    %r13
+  80177b:	41 5e                	pop    %r14
+  80177d:	41 5f                	pop    %r15
+  80177f:	5d                   	pop    %rbp
+  801780:	c3                   	ret
+
+0000000000801781 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801781:	83 ff 1f             	cmp    $0x1f,%edi
+  801784:	77 39                	ja     8017bf <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801786:	55                   	push   %rbp
+  801787:	48 89 e5             	mov    %rsp,%rbp
+  80178a:	41 54                	push   %r12
+  80178c:	53                   	push   %rbx
+  80178d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801790:	48 63 df             	movslq %edi,%rbx
+  801793:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80179a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80179e:	48 89 df             	mov    %rbx,%rdi
+  8017a1:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	a8 04                	test   $0x4,%al
+  8017af:	74 14                	je     8017c5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017b1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ba:	5b                   	pop    %rbx
+  8017bb:	41 5c                	pop    %r12
+  8017bd:	5d                   	pop    %rbp
+  8017be:	c3                   	ret
+        return -E_INVAL;
+  8017bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017c4:	c3                   	ret
+        return -E_INVAL;
+  8017c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ca:	eb ee                	jmp    8017ba <fd_lookup+0x39>
+
+00000000008017cc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017cc:	55                   	push   %rbp
+  8017cd:	48 89 e5             	mov    %rsp,%rbp
+  8017d0:	41 54                	push   %r12
+  8017d2:	53                   	push   %rbx
+  8017d3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017d6:	48 b8 00 3f 80 00 00 	movabs $0x803f00,%rax
+  8017dd:	00 00 00 
+  8017e0:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017e7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017ea:	39 3b                	cmp    %edi,(%rbx)
+  8017ec:	74 47                	je     801835 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017ee:	48 83 c0 08          	add    $0x8,%rax
+  8017f2:	48 8b 18             	mov    (%rax),%rbx
+  8017f5:	48 85 db             	test   %rbx,%rbx
+  8017f8:	75 f0                	jne    8017ea <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017fa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801801:	00 00 00 
+  801804:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80180a:	89 fa                	mov    %edi,%edx
+  80180c:	48 bf 60 3e 80 00 00 	movabs $0x803e60,%rdi
+  801813:	00 00 00 
+  801816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181b:	48 b9 63 02 80 00 00 	movabs $0x800263,%rcx
+  801822:	00 00 00 
+  801825:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801827:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80182c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801830:	5b                   	pop    %rbx
+  801831:	41 5c                	pop    %r12
+  801833:	5d                   	pop    %rbp
+  801834:	c3                   	ret
+            return 0;
+  801835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183a:	eb f0                	jmp    80182c <dev_lookup+0x60>
+
+000000000080183c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	41 55                	push   %r13
+  801842:	41 54                	push   %r12
+  801844:	53                   	push   %rbx
+  801845:	48 83 ec 18          	sub    $0x18,%rsp
+  801849:	48 89 fb             	mov    %rdi,%rbx
+  80184c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80184f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801856:	ff ff ff 
+  801859:	48 01 df             	add    %rbx,%rdi
+  80185c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801860:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801864:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  80186b:	00 00 00 
+  80186e:	ff d0                	call   *%rax
+  801870:	41 89 c5             	mov    %eax,%r13d
+  801873:	85 c0                	test   %eax,%eax
+  801875:	78 06                	js     80187d <fd_close+0x41>
+  801877:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80187b:	74 1a                	je     801897 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80187d:	45 84 e4             	test   %r12b,%r12b
+  801880:	b8 00 00 00 00       	mov    $0x0,%eax
+  801885:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801889:	44 89 e8             	mov    %r13d,%eax
+  80188c:	48 83 c4 18          	add    $0x18,%rsp
+  801890:	5b                   	pop    %rbx
+  801891:	41 5c                	pop    %r12
+  801893:	41 5d                	pop    %r13
+  801895:	5d                   	pop    %rbp
+  801896:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801897:	8b 3b                	mov    (%rbx),%edi
+  801899:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80189d:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  8018a4:	00 00 00 
+  8018a7:	ff d0                	call   *%rax
+  8018a9:	41 89 c5             	mov    %eax,%r13d
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	78 1b                	js     8018cb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018b4:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8018b8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018be:	48 85 c0             	test   %rax,%rax
+  8018c1:	74 08                	je     8018cb <fd_close+0x8f>
+  8018c3:	48 89 df             	mov    %rbx,%rdi
+  8018c6:	ff d0                	call   *%rax
+  8018c8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d0:	48 89 de             	mov    %rbx,%rsi
+  8018d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018d8:	48 b8 e0 12 80 00 00 	movabs $0x8012e0,%rax
+  8018df:	00 00 00 
+  8018e2:	ff d0                	call   *%rax
+    return res;
+  8018e4:	eb a3                	jmp    801889 <fd_close+0x4d>
+
+00000000008018e6 <close>:
+
+int
+close(int fdnum) {
+  8018e6:	55                   	push   %rbp
+  8018e7:	48 89 e5             	mov    %rsp,%rbp
+  8018ea:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018ee:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018f2:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	78 15                	js     801917 <close+0x31>
+
+    return fd_close(fd, 1);
+  801902:	be 01 00 00 00       	mov    $0x1,%esi
+  801907:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80190b:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  801912:	00 00 00 
+  801915:	ff d0                	call   *%rax
+}
+  801917:	c9                   	leave
+  801918:	c3                   	ret
+
+0000000000801919 <close_all>:
+
+void
+close_all(void) {
+  801919:	55                   	push   %rbp
+  80191a:	48 89 e5             	mov    %rsp,%rbp
+  80191d:	41 54                	push   %r12
+  80191f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801925:	49 bc e6 18 80 00 00 	movabs $0x8018e6,%r12
+  80192c:	00 00 00 
+  80192f:	89 df                	mov    %ebx,%edi
+  801931:	41 ff d4             	call   *%r12
+  801934:	83 c3 01             	add    $0x1,%ebx
+  801937:	83 fb 20             	cmp    $0x20,%ebx
+  80193a:	75 f3                	jne    80192f <close_all+0x16>
+}
+  80193c:	5b                   	pop    %rbx
+  80193d:	41 5c                	pop    %r12
+  80193f:	5d                   	pop    %rbp
+  801940:	c3                   	ret
+
+0000000000801941 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801941:	55                   	push   %rbp
+  801942:	48 89 e5             	mov    %rsp,%rbp
+  801945:	41 57                	push   %r15
+  801947:	41 56                	push   %r14
+  801949:	41 55                	push   %r13
+  80194b:	41 54                	push   %r12
+  80194d:	53                   	push   %rbx
+  80194e:	48 83 ec 18          	sub    $0x18,%rsp
+  801952:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801955:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801959:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801960:	00 00 00 
+  801963:	ff d0                	call   *%rax
+  801965:	89 c3                	mov    %eax,%ebx
+  801967:	85 c0                	test   %eax,%eax
+  801969:	0f 88 b8 00 00 00    	js     801a27 <dup+0xe6>
+    close(newfdnum);
+  80196f:	44 89 e7             	mov    %r12d,%edi
+  801972:	48 b8 e6 18 80 00 00 	movabs $0x8018e6,%rax
+  801979:	00 00 00 
+  80197c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80197e:	4d 63 ec             	movslq %r12d,%r13
+  801981:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801988:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80198c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801990:	4c 89 ff             	mov    %r15,%rdi
+  801993:	49 be 05 17 80 00 00 	movabs $0x801705,%r14
+  80199a:	00 00 00 
+  80199d:	41 ff d6             	call   *%r14
+  8019a0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019a3:	4c 89 ef             	mov    %r13,%rdi
+  8019a6:	41 ff d6             	call   *%r14
+  8019a9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019ac:	48 89 df             	mov    %rbx,%rdi
+  8019af:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019bb:	a8 04                	test   $0x4,%al
+  8019bd:	74 2b                	je     8019ea <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019bf:	41 89 c1             	mov    %eax,%r9d
+  8019c2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019c8:	4c 89 f1             	mov    %r14,%rcx
+  8019cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d0:	48 89 de             	mov    %rbx,%rsi
+  8019d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d8:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+  8019e4:	89 c3                	mov    %eax,%ebx
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	78 4e                	js     801a38 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019ea:	4c 89 ff             	mov    %r15,%rdi
+  8019ed:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  8019f4:	00 00 00 
+  8019f7:	ff d0                	call   *%rax
+  8019f9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019fc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a02:	4c 89 e9             	mov    %r13,%rcx
+  801a05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0a:	4c 89 fe             	mov    %r15,%rsi
+  801a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a12:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  801a19:	00 00 00 
+  801a1c:	ff d0                	call   *%rax
+  801a1e:	89 c3                	mov    %eax,%ebx
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 14                	js     801a38 <dup+0xf7>
+
+    return newfdnum;
+  801a24:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a27:	89 d8                	mov    %ebx,%eax
+  801a29:	48 83 c4 18          	add    $0x18,%rsp
+  801a2d:	5b                   	pop    %rbx
+  801a2e:	41 5c                	pop    %r12
+  801a30:	41 5d                	pop    %r13
+  801a32:	41 5e                	pop    %r14
+  801a34:	41 5f                	pop    %r15
+  801a36:	5d                   	pop    %rbp
+  801a37:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a3d:	4c 89 ee             	mov    %r13,%rsi
+  801a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a45:	49 bc e0 12 80 00 00 	movabs $0x8012e0,%r12
+  801a4c:	00 00 00 
+  801a4f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a57:	4c 89 f6             	mov    %r14,%rsi
+  801a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a5f:	41 ff d4             	call   *%r12
+    return res;
+  801a62:	eb c3                	jmp    801a27 <dup+0xe6>
+
+0000000000801a64 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	41 56                	push   %r14
+  801a6a:	41 55                	push   %r13
+  801a6c:	41 54                	push   %r12
+  801a6e:	53                   	push   %rbx
+  801a6f:	48 83 ec 10          	sub    $0x10,%rsp
+  801a73:	89 fb                	mov    %edi,%ebx
+  801a75:	49 89 f4             	mov    %rsi,%r12
+  801a78:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a7b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a7f:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 4c                	js     801adb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a8f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a93:	41 8b 3e             	mov    (%r14),%edi
+  801a96:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a9a:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801aa1:	00 00 00 
+  801aa4:	ff d0                	call   *%rax
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 35                	js     801adf <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801aaa:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801aae:	83 e0 03             	and    $0x3,%eax
+  801ab1:	83 f8 01             	cmp    $0x1,%eax
+  801ab4:	74 2d                	je     801ae3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ab6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aba:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801abe:	48 85 c0             	test   %rax,%rax
+  801ac1:	74 56                	je     801b19 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ac3:	4c 89 ea             	mov    %r13,%rdx
+  801ac6:	4c 89 e6             	mov    %r12,%rsi
+  801ac9:	4c 89 f7             	mov    %r14,%rdi
+  801acc:	ff d0                	call   *%rax
+}
+  801ace:	48 83 c4 10          	add    $0x10,%rsp
+  801ad2:	5b                   	pop    %rbx
+  801ad3:	41 5c                	pop    %r12
+  801ad5:	41 5d                	pop    %r13
+  801ad7:	41 5e                	pop    %r14
+  801ad9:	5d                   	pop    %rbp
+  801ada:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801adb:	48 98                	cltq
+  801add:	eb ef                	jmp    801ace <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801adf:	48 98                	cltq
+  801ae1:	eb eb                	jmp    801ace <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ae3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801aea:	00 00 00 
+  801aed:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801af3:	89 da                	mov    %ebx,%edx
+  801af5:	48 bf c1 3e 80 00 00 	movabs $0x803ec1,%rdi
+  801afc:	00 00 00 
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b04:	48 b9 63 02 80 00 00 	movabs $0x800263,%rcx
+  801b0b:	00 00 00 
+  801b0e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b10:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b17:	eb b5                	jmp    801ace <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b19:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b20:	eb ac                	jmp    801ace <read+0x6a>
+
+0000000000801b22 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801b22:	55                   	push   %rbp
+  801b23:	48 89 e5             	mov    %rsp,%rbp
+  801b26:	41 56                	push   %r14
+  801b28:	41 55                	push   %r13
+  801b2a:	41 54                	push   %r12
+  801b2c:	53                   	push   %rbx
+  801b2d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b31:	89 fb                	mov    %edi,%ebx
+  801b33:	49 89 f4             	mov    %rsi,%r12
+  801b36:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b39:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b3d:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 41                	js     801b8e <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b4d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b51:	41 8b 3e             	mov    (%r14),%edi
+  801b54:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b58:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801b5f:	00 00 00 
+  801b62:	ff d0                	call   *%rax
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	78 35                	js     801b9d <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b68:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b6c:	83 e0 03             	and    $0x3,%eax
+  801b6f:	83 f8 01             	cmp    $0x1,%eax
+  801b72:	74 2d                	je     801ba1 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b78:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b7c:	48 85 c0             	test   %rax,%rax
+  801b7f:	74 56                	je     801bd7 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801b81:	4c 89 ea             	mov    %r13,%rdx
+  801b84:	4c 89 e6             	mov    %r12,%rsi
+  801b87:	4c 89 f7             	mov    %r14,%rdi
+  801b8a:	ff d0                	call   *%rax
+  801b8c:	eb 02                	jmp    801b90 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b8e:	48 98                	cltq
+}
+  801b90:	48 83 c4 10          	add    $0x10,%rsp
+  801b94:	5b                   	pop    %rbx
+  801b95:	41 5c                	pop    %r12
+  801b97:	41 5d                	pop    %r13
+  801b99:	41 5e                	pop    %r14
+  801b9b:	5d                   	pop    %rbp
+  801b9c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b9d:	48 98                	cltq
+  801b9f:	eb ef                	jmp    801b90 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ba1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ba8:	00 00 00 
+  801bab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bb1:	89 da                	mov    %ebx,%edx
+  801bb3:	48 bf 80 3e 80 00 00 	movabs $0x803e80,%rdi
+  801bba:	00 00 00 
+  801bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc2:	48 b9 63 02 80 00 00 	movabs $0x800263,%rcx
+  801bc9:	00 00 00 
+  801bcc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bd5:	eb b9                	jmp    801b90 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801bd7:	4c 89 ea             	mov    %r13,%rdx
+  801bda:	4c 89 e6             	mov    %r12,%rsi
+  801bdd:	89 df                	mov    %ebx,%edi
+  801bdf:	48 b8 64 1a 80 00 00 	movabs $0x801a64,%rax
+  801be6:	00 00 00 
+  801be9:	ff d0                	call   *%rax
+  801beb:	eb a3                	jmp    801b90 <readmap+0x6e>
+
+0000000000801bed <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bed:	55                   	push   %rbp
+  801bee:	48 89 e5             	mov    %rsp,%rbp
+  801bf1:	41 57                	push   %r15
+  801bf3:	41 56                	push   %r14
+  801bf5:	41 55                	push   %r13
+  801bf7:	41 54                	push   %r12
+  801bf9:	53                   	push   %rbx
+  801bfa:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bfe:	48 85 d2             	test   %rdx,%rdx
+  801c01:	74 54                	je     801c57 <readn+0x6a>
+  801c03:	41 89 fd             	mov    %edi,%r13d
+  801c06:	49 89 f6             	mov    %rsi,%r14
+  801c09:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c11:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c16:	49 bf 64 1a 80 00 00 	movabs $0x801a64,%r15
+  801c1d:	00 00 00 
+  801c20:	4c 89 e2             	mov    %r12,%rdx
+  801c23:	48 29 f2             	sub    %rsi,%rdx
+  801c26:	4c 01 f6             	add    %r14,%rsi
+  801c29:	44 89 ef             	mov    %r13d,%edi
+  801c2c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c2f:	85 c0                	test   %eax,%eax
+  801c31:	78 20                	js     801c53 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c33:	01 c3                	add    %eax,%ebx
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	74 08                	je     801c41 <readn+0x54>
+  801c39:	48 63 f3             	movslq %ebx,%rsi
+  801c3c:	4c 39 e6             	cmp    %r12,%rsi
+  801c3f:	72 df                	jb     801c20 <readn+0x33>
+    }
+    return res;
+  801c41:	48 63 c3             	movslq %ebx,%rax
+}
+  801c44:	48 83 c4 08          	add    $0x8,%rsp
+  801c48:	5b                   	pop    %rbx
+  801c49:	41 5c                	pop    %r12
+  801c4b:	41 5d                	pop    %r13
+  801c4d:	41 5e                	pop    %r14
+  801c4f:	41 5f                	pop    %r15
+  801c51:	5d                   	pop    %rbp
+  801c52:	c3                   	ret
+        if (inc < 0) return inc;
+  801c53:	48 98                	cltq
+  801c55:	eb ed                	jmp    801c44 <readn+0x57>
+    int inc = 1, res = 0;
+  801c57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5c:	eb e3                	jmp    801c41 <readn+0x54>
+
+0000000000801c5e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	41 56                	push   %r14
+  801c64:	41 55                	push   %r13
+  801c66:	41 54                	push   %r12
+  801c68:	53                   	push   %rbx
+  801c69:	48 83 ec 10          	sub    $0x10,%rsp
+  801c6d:	89 fb                	mov    %edi,%ebx
+  801c6f:	49 89 f4             	mov    %rsi,%r12
+  801c72:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c75:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c79:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801c80:	00 00 00 
+  801c83:	ff d0                	call   *%rax
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 47                	js     801cd0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c89:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c8d:	41 8b 3e             	mov    (%r14),%edi
+  801c90:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c94:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801c9b:	00 00 00 
+  801c9e:	ff d0                	call   *%rax
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	78 30                	js     801cd4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ca9:	74 2d                	je     801cd8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801caf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801cb3:	48 85 c0             	test   %rax,%rax
+  801cb6:	74 56                	je     801d0e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cb8:	4c 89 ea             	mov    %r13,%rdx
+  801cbb:	4c 89 e6             	mov    %r12,%rsi
+  801cbe:	4c 89 f7             	mov    %r14,%rdi
+  801cc1:	ff d0                	call   *%rax
+}
+  801cc3:	48 83 c4 10          	add    $0x10,%rsp
+  801cc7:	5b                   	pop    %rbx
+  801cc8:	41 5c                	pop    %r12
+  801cca:	41 5d                	pop    %r13
+  801ccc:	41 5e                	pop    %r14
+  801cce:	5d                   	pop    %rbp
+  801ccf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd0:	48 98                	cltq
+  801cd2:	eb ef                	jmp    801cc3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd4:	48 98                	cltq
+  801cd6:	eb eb                	jmp    801cc3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cdf:	00 00 00 
+  801ce2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ce8:	89 da                	mov    %ebx,%edx
+  801cea:	48 bf dd 3e 80 00 00 	movabs $0x803edd,%rdi
+  801cf1:	00 00 00 
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	48 b9 63 02 80 00 00 	movabs $0x800263,%rcx
+  801d00:	00 00 00 
+  801d03:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d05:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d0c:	eb b5                	jmp    801cc3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d0e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d15:	eb ac                	jmp    801cc3 <write+0x65>
+
+0000000000801d17 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d17:	55                   	push   %rbp
+  801d18:	48 89 e5             	mov    %rsp,%rbp
+  801d1b:	53                   	push   %rbx
+  801d1c:	48 83 ec 18          	sub    $0x18,%rsp
+  801d20:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d26:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801d2d:	00 00 00 
+  801d30:	ff d0                	call   *%rax
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 0c                	js     801d42 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d3a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d46:	c9                   	leave
+  801d47:	c3                   	ret
+
+0000000000801d48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d48:	55                   	push   %rbp
+  801d49:	48 89 e5             	mov    %rsp,%rbp
+  801d4c:	41 55                	push   %r13
+  801d4e:	41 54                	push   %r12
+  801d50:	53                   	push   %rbx
+  801d51:	48 83 ec 18          	sub    $0x18,%rsp
+  801d55:	89 fb                	mov    %edi,%ebx
+  801d57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d5e:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801d65:	00 00 00 
+  801d68:	ff d0                	call   *%rax
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 38                	js     801da6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d7a:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801d81:	00 00 00 
+  801d84:	ff d0                	call   *%rax
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 1c                	js     801da6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d8f:	74 20                	je     801db1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d95:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801d99:	48 85 c0             	test   %rax,%rax
+  801d9c:	74 47                	je     801de5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d9e:	44 89 e6             	mov    %r12d,%esi
+  801da1:	4c 89 ef             	mov    %r13,%rdi
+  801da4:	ff d0                	call   *%rax
+}
+  801da6:	48 83 c4 18          	add    $0x18,%rsp
+  801daa:	5b                   	pop    %rbx
+  801dab:	41 5c                	pop    %r12
+  801dad:	41 5d                	pop    %r13
+  801daf:	5d                   	pop    %rbp
+  801db0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801db1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801db8:	00 00 00 
+  801dbb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dc1:	89 da                	mov    %ebx,%edx
+  801dc3:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  801dca:	00 00 00 
+  801dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd2:	48 b9 63 02 80 00 00 	movabs $0x800263,%rcx
+  801dd9:	00 00 00 
+  801ddc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de3:	eb c1                	jmp    801da6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801de5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dea:	eb ba                	jmp    801da6 <ftruncate+0x5e>
+
+0000000000801dec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801dec:	55                   	push   %rbp
+  801ded:	48 89 e5             	mov    %rsp,%rbp
+  801df0:	41 54                	push   %r12
+  801df2:	53                   	push   %rbx
+  801df3:	48 83 ec 10          	sub    $0x10,%rsp
+  801df7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dfa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dfe:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 4e                	js     801e5c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e0e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e12:	41 8b 3c 24          	mov    (%r12),%edi
+  801e16:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e1a:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 32                	js     801e5c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e2e:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801e33:	74 30                	je     801e65 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e35:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e3f:	00 00 00 
+    stat->st_isdir = 0;
+  801e42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e49:	00 00 00 
+    stat->st_dev = dev;
+  801e4c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e53:	48 89 de             	mov    %rbx,%rsi
+  801e56:	4c 89 e7             	mov    %r12,%rdi
+  801e59:	ff 50 30             	call   *0x30(%rax)
+}
+  801e5c:	48 83 c4 10          	add    $0x10,%rsp
+  801e60:	5b                   	pop    %rbx
+  801e61:	41 5c                	pop    %r12
+  801e63:	5d                   	pop    %rbp
+  801e64:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e6a:	eb f0                	jmp    801e5c <fstat+0x70>
+
+0000000000801e6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e6c:	55                   	push   %rbp
+  801e6d:	48 89 e5             	mov    %rsp,%rbp
+  801e70:	41 54                	push   %r12
+  801e72:	53                   	push   %rbx
+  801e73:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e76:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7b:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  801e82:	00 00 00 
+  801e85:	ff d0                	call   *%rax
+  801e87:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 25                	js     801eb2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e8d:	4c 89 e6             	mov    %r12,%rsi
+  801e90:	89 c7                	mov    %eax,%edi
+  801e92:	48 b8 ec 1d 80 00 00 	movabs $0x801dec,%rax
+  801e99:	00 00 00 
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ea1:	89 df                	mov    %ebx,%edi
+  801ea3:	48 b8 e6 18 80 00 00 	movabs $0x8018e6,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+
+    return res;
+  801eaf:	44 89 e3             	mov    %r12d,%ebx
+}
+  801eb2:	89 d8                	mov    %ebx,%eax
+  801eb4:	5b                   	pop    %rbx
+  801eb5:	41 5c                	pop    %r12
+  801eb7:	5d                   	pop    %rbp
+  801eb8:	c3                   	ret
+
+0000000000801eb9 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801eb9:	55                   	push   %rbp
+  801eba:	48 89 e5             	mov    %rsp,%rbp
+  801ebd:	41 54                	push   %r12
+  801ebf:	53                   	push   %rbx
+  801ec0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec4:	48 89 fb             	mov    %rdi,%rbx
+  801ec7:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801eca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ece:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ed3:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	78 1f                	js     801f02 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ee7:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801eeb:	48 85 c0             	test   %rax,%rax
+  801eee:	74 1b                	je     801f0b <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801ef0:	4c 89 e6             	mov    %r12,%rsi
+  801ef3:	48 89 df             	mov    %rbx,%rdi
+  801ef6:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eff:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f02:	48 83 c4 10          	add    $0x10,%rsp
+  801f06:	5b                   	pop    %rbx
+  801f07:	41 5c                	pop    %r12
+  801f09:	5d                   	pop    %rbp
+  801f0a:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f0b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f10:	eb f0                	jmp    801f02 <create_snapshot+0x49>
+
+0000000000801f12 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801f12:	55                   	push   %rbp
+  801f13:	48 89 e5             	mov    %rsp,%rbp
+  801f16:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f1a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f1e:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f23:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+  801f2f:	85 c0                	test   %eax,%eax
+  801f31:	78 1e                	js     801f51 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801f33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f37:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801f3b:	48 85 d2             	test   %rdx,%rdx
+  801f3e:	74 13                	je     801f53 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801f40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f45:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f58:	eb f7                	jmp    801f51 <print_snapshot_list+0x3f>
+
+0000000000801f5a <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801f5a:	55                   	push   %rbp
+  801f5b:	48 89 e5             	mov    %rsp,%rbp
+  801f5e:	53                   	push   %rbx
+  801f5f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f63:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6a:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f6f:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	78 1c                	js     801f9b <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801f7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f83:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801f87:	48 85 c0             	test   %rax,%rax
+  801f8a:	74 15                	je     801fa1 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801f8c:	48 89 df             	mov    %rbx,%rdi
+  801f8f:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f98:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fa1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fa6:	eb f3                	jmp    801f9b <accept_snapshot+0x41>
+
+0000000000801fa8 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801fa8:	55                   	push   %rbp
+  801fa9:	48 89 e5             	mov    %rsp,%rbp
+  801fac:	53                   	push   %rbx
+  801fad:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fb4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fb8:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fbd:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801fc4:	00 00 00 
+  801fc7:	ff d0                	call   *%rax
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	78 1c                	js     801fe9 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801fcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fd1:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801fd5:	48 85 c0             	test   %rax,%rax
+  801fd8:	74 15                	je     801fef <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801fda:	48 89 df             	mov    %rbx,%rdi
+  801fdd:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe6:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff4:	eb f3                	jmp    801fe9 <delete_snapshot+0x41>
+
+0000000000801ff6 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  801ffa:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ffe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802002:	bf 66 00 00 00       	mov    $0x66,%edi
+  802007:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80200e:	00 00 00 
+  802011:	ff d0                	call   *%rax
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 14                	js     80202b <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80201b:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80201f:	48 85 d2             	test   %rdx,%rdx
+  802022:	74 09                	je     80202d <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80202b:	c9                   	leave
+  80202c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80202d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802032:	eb f7                	jmp    80202b <gc_snapshots+0x35>
+
+0000000000802034 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802034:	55                   	push   %rbp
+  802035:	48 89 e5             	mov    %rsp,%rbp
+  802038:	41 56                	push   %r14
+  80203a:	41 55                	push   %r13
+  80203c:	41 54                	push   %r12
+  80203e:	53                   	push   %rbx
+  80203f:	48 83 ec 10          	sub    $0x10,%rsp
+  802043:	48 89 fb             	mov    %rdi,%rbx
+  802046:	49 89 f4             	mov    %rsi,%r12
+  802049:	49 89 d5             	mov    %rdx,%r13
+  80204c:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80204f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802053:	bf 66 00 00 00       	mov    $0x66,%edi
+  802058:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+  802064:	85 c0                	test   %eax,%eax
+  802066:	78 1b                	js     802083 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802068:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206c:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802070:	48 85 c0             	test   %rax,%rax
+  802073:	74 1b                	je     802090 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802075:	4c 89 f1             	mov    %r14,%rcx
+  802078:	4c 89 ea             	mov    %r13,%rdx
+  80207b:	4c 89 e6             	mov    %r12,%rsi
+  80207e:	48 89 df             	mov    %rbx,%rdi
+  802081:	ff d0                	call   *%rax
+
+    return res;
+}
+  802083:	48 83 c4 10          	add    $0x10,%rsp
+  802087:	5b                   	pop    %rbx
+  802088:	41 5c                	pop    %r12
+  80208a:	41 5d                	pop    %r13
+  80208c:	41 5e                	pop    %r14
+  80208e:	5d                   	pop    %rbp
+  80208f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802090:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802095:	eb ec                	jmp    802083 <diff_snapshots+0x4f>
+
+0000000000802097 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	41 55                	push   %r13
+  80209d:	41 54                	push   %r12
+  80209f:	53                   	push   %rbx
+  8020a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8020a4:	48 89 fb             	mov    %rdi,%rbx
+  8020a7:	49 89 f4             	mov    %rsi,%r12
+  8020aa:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020b1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020b6:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  8020bd:	00 00 00 
+  8020c0:	ff d0                	call   *%rax
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 18                	js     8020de <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8020c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ca:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8020ce:	48 85 c0             	test   %rax,%rax
+  8020d1:	74 16                	je     8020e9 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8020d3:	4c 89 ea             	mov    %r13,%rdx
+  8020d6:	4c 89 e6             	mov    %r12,%rsi
+  8020d9:	48 89 df             	mov    %rbx,%rdi
+  8020dc:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020de:	48 83 c4 18          	add    $0x18,%rsp
+  8020e2:	5b                   	pop    %rbx
+  8020e3:	41 5c                	pop    %r12
+  8020e5:	41 5d                	pop    %r13
+  8020e7:	5d                   	pop    %rbp
+  8020e8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ee:	eb ee                	jmp    8020de <send_snapshot+0x47>
+
+00000000008020f0 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8020f0:	55                   	push   %rbp
+  8020f1:	48 89 e5             	mov    %rsp,%rbp
+  8020f4:	53                   	push   %rbx
+  8020f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f9:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020fc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802100:	bf 66 00 00 00       	mov    $0x66,%edi
+  802105:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80210c:	00 00 00 
+  80210f:	ff d0                	call   *%rax
+  802111:	85 c0                	test   %eax,%eax
+  802113:	78 12                	js     802127 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802119:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80211d:	48 85 c0             	test   %rax,%rax
+  802120:	74 0b                	je     80212d <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802122:	48 89 df             	mov    %rbx,%rdi
+  802125:	ff d0                	call   *%rax
+
+    return res;
+}
+  802127:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80212b:	c9                   	leave
+  80212c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80212d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802132:	eb f3                	jmp    802127 <receive_snapshot+0x37>
+
+0000000000802134 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80213c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802140:	bf 66 00 00 00       	mov    $0x66,%edi
+  802145:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+  802151:	85 c0                	test   %eax,%eax
+  802153:	78 17                	js     80216c <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802159:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802160:	48 85 d2             	test   %rdx,%rdx
+  802163:	74 09                	je     80216e <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80216e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802173:	eb f7                	jmp    80216c <free_space_bytes+0x38>
+
+0000000000802175 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802175:	55                   	push   %rbp
+  802176:	48 89 e5             	mov    %rsp,%rbp
+  802179:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80217d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802181:	bf 66 00 00 00       	mov    $0x66,%edi
+  802186:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+  802192:	85 c0                	test   %eax,%eax
+  802194:	78 17                	js     8021ad <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802196:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80219a:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8021a1:	48 85 d2             	test   %rdx,%rdx
+  8021a4:	74 09                	je     8021af <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ab:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021ad:	c9                   	leave
+  8021ae:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021b4:	eb f7                	jmp    8021ad <busy_space_bytes+0x38>
+
+00000000008021b6 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8021b6:	55                   	push   %rbp
+  8021b7:	48 89 e5             	mov    %rsp,%rbp
+  8021ba:	41 54                	push   %r12
+  8021bc:	53                   	push   %rbx
+  8021bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c1:	89 fb                	mov    %edi,%ebx
+  8021c3:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021ca:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021cf:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+  8021db:	85 c0                	test   %eax,%eax
+  8021dd:	78 17                	js     8021f6 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8021df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021e3:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8021ea:	48 85 c0             	test   %rax,%rax
+  8021ed:	74 10                	je     8021ff <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8021ef:	4c 89 e6             	mov    %r12,%rsi
+  8021f2:	89 df                	mov    %ebx,%edi
+  8021f4:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8021f6:	48 83 c4 10          	add    $0x10,%rsp
+  8021fa:	5b                   	pop    %rbx
+  8021fb:	41 5c                	pop    %r12
+  8021fd:	5d                   	pop    %rbp
+  8021fe:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021ff:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802204:	eb f0                	jmp    8021f6 <snapshots_space+0x40>
+
+0000000000802206 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+  80220a:	41 55                	push   %r13
+  80220c:	41 54                	push   %r12
+  80220e:	53                   	push   %rbx
+  80220f:	48 83 ec 08          	sub    $0x8,%rsp
+  802213:	41 89 fd             	mov    %edi,%r13d
+  802216:	48 89 f3             	mov    %rsi,%rbx
+  802219:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80221c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802223:	00 00 00 
+  802226:	83 38 00             	cmpl   $0x0,(%rax)
+  802229:	74 57                	je     802282 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80222b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802231:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802236:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80223d:	00 00 00 
+  802240:	44 89 ee             	mov    %r13d,%esi
+  802243:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80224a:	00 00 00 
+  80224d:	8b 38                	mov    (%rax),%edi
+  80224f:	48 b8 26 37 80 00 00 	movabs $0x803726,%rax
+  802256:	00 00 00 
+  802259:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80225b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802260:	4c 89 e2             	mov    %r12,%rdx
+  802263:	48 89 de             	mov    %rbx,%rsi
+  802266:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226b:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+}
+  802277:	48 83 c4 08          	add    $0x8,%rsp
+  80227b:	5b                   	pop    %rbx
+  80227c:	41 5c                	pop    %r12
+  80227e:	41 5d                	pop    %r13
+  802280:	5d                   	pop    %rbp
+  802281:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802282:	bf 03 00 00 00       	mov    $0x3,%edi
+  802287:	48 b8 e4 37 80 00 00 	movabs $0x8037e4,%rax
+  80228e:	00 00 00 
+  802291:	ff d0                	call   *%rax
+  802293:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80229a:	00 00 
+  80229c:	eb 8d                	jmp    80222b <fsipc_region+0x25>
+
+000000000080229e <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80229e:	55                   	push   %rbp
+  80229f:	48 89 e5             	mov    %rsp,%rbp
+  8022a2:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8022a6:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8022ad:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8022ae:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8022b2:	48 b8 06 22 80 00 00 	movabs $0x802206,%rax
+  8022b9:	00 00 00 
+  8022bc:	ff d0                	call   *%rax
+}
+  8022be:	c9                   	leave
+  8022bf:	c3                   	ret
+
+00000000008022c0 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8022c0:	85 ff                	test   %edi,%edi
+  8022c2:	78 6d                	js     802331 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8022c4:	55                   	push   %rbp
+  8022c5:	48 89 e5             	mov    %rsp,%rbp
+  8022c8:	41 54                	push   %r12
+  8022ca:	53                   	push   %rbx
+  8022cb:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8022ce:	48 85 f6             	test   %rsi,%rsi
+  8022d1:	74 57                	je     80232a <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8022d3:	89 f8                	mov    %edi,%eax
+  8022d5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022dc:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8022de:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e3:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022e8:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	78 2d                	js     802325 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8022f8:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8022ff:	00 00 00 
+  802302:	49 63 14 24          	movslq (%r12),%rdx
+  802306:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80230d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802312:	48 89 df             	mov    %rbx,%rdi
+  802315:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802321:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802325:	5b                   	pop    %rbx
+  802326:	41 5c                	pop    %r12
+  802328:	5d                   	pop    %rbp
+  802329:	c3                   	ret
+        return -E_INVAL;
+  80232a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80232f:	eb f4                	jmp    802325 <devfile_df_snapshots+0x65>
+  802331:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802336:	c3                   	ret
+
+0000000000802337 <devfile_df_busy>:
+devfile_df_busy() {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80233b:	be 00 00 00 00       	mov    $0x0,%esi
+  802340:	bf 11 00 00 00       	mov    $0x11,%edi
+  802345:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+}
+  802351:	5d                   	pop    %rbp
+  802352:	c3                   	ret
+
+0000000000802353 <devfile_df_free>:
+devfile_df_free() {
+  802353:	55                   	push   %rbp
+  802354:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802357:	be 00 00 00 00       	mov    $0x0,%esi
+  80235c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802361:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+}
+  80236d:	5d                   	pop    %rbp
+  80236e:	c3                   	ret
+
+000000000080236f <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80236f:	55                   	push   %rbp
+  802370:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802373:	be 00 00 00 00       	mov    $0x0,%esi
+  802378:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80237d:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+}
+  802389:	5d                   	pop    %rbp
+  80238a:	c3                   	ret
+
+000000000080238b <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80238f:	be 00 00 00 00       	mov    $0x0,%esi
+  802394:	bf 09 00 00 00       	mov    $0x9,%edi
+  802399:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ac:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8023af:	5d                   	pop    %rbp
+  8023b0:	c3                   	ret
+
+00000000008023b1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023b1:	55                   	push   %rbp
+  8023b2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023b5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023bc:	00 00 00 
+  8023bf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023c2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8023c4:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cc:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023d1:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+}
+  8023dd:	5d                   	pop    %rbp
+  8023de:	c3                   	ret
+
+00000000008023df <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023df:	55                   	push   %rbp
+  8023e0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023e3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023e6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023ed:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023f9:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+}
+  802405:	5d                   	pop    %rbp
+  802406:	c3                   	ret
+
+0000000000802407 <devfile_write>:
+    if (!fd || !buf) {
+  802407:	48 85 ff             	test   %rdi,%rdi
+  80240a:	0f 84 c1 00 00 00    	je     8024d1 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	41 57                	push   %r15
+  802416:	41 56                	push   %r14
+  802418:	41 55                	push   %r13
+  80241a:	41 54                	push   %r12
+  80241c:	53                   	push   %rbx
+  80241d:	48 83 ec 18          	sub    $0x18,%rsp
+  802421:	49 89 ff             	mov    %rdi,%r15
+  802424:	49 89 f5             	mov    %rsi,%r13
+  802427:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80242a:	48 85 f6             	test   %rsi,%rsi
+  80242d:	0f 84 95 00 00 00    	je     8024c8 <devfile_write+0xc1>
+    while (n) {
+  802433:	48 85 d2             	test   %rdx,%rdx
+  802436:	0f 84 83 00 00 00    	je     8024bf <devfile_write+0xb8>
+    int totalWrite = 0;
+  80243c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802443:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80244a:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80244d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802452:	49 39 dc             	cmp    %rbx,%r12
+  802455:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802459:	48 89 da             	mov    %rbx,%rdx
+  80245c:	4c 89 ee             	mov    %r13,%rsi
+  80245f:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802466:	00 00 00 
+  802469:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802475:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802479:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80247c:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802480:	be 00 00 00 00       	mov    $0x0,%esi
+  802485:	bf 04 00 00 00       	mov    $0x4,%edi
+  80248a:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+        if (write < 0) {
+  802496:	85 c0                	test   %eax,%eax
+  802498:	78 21                	js     8024bb <devfile_write+0xb4>
+        buf += write;
+  80249a:	48 63 d0             	movslq %eax,%rdx
+  80249d:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8024a0:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8024a3:	49 29 d4             	sub    %rdx,%r12
+  8024a6:	75 a5                	jne    80244d <devfile_write+0x46>
+    return totalWrite;
+  8024a8:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8024ac:	48 83 c4 18          	add    $0x18,%rsp
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	41 5d                	pop    %r13
+  8024b5:	41 5e                	pop    %r14
+  8024b7:	41 5f                	pop    %r15
+  8024b9:	5d                   	pop    %rbp
+  8024ba:	c3                   	ret
+            return write;
+  8024bb:	48 98                	cltq
+  8024bd:	eb ed                	jmp    8024ac <devfile_write+0xa5>
+    int totalWrite = 0;
+  8024bf:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8024c6:	eb e0                	jmp    8024a8 <devfile_write+0xa1>
+        return -E_INVAL;
+  8024c8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024cf:	eb db                	jmp    8024ac <devfile_write+0xa5>
+  8024d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8024d8:	c3                   	ret
+
+00000000008024d9 <devfile_read>:
+    if (!fd || !buf) {
+  8024d9:	48 85 ff             	test   %rdi,%rdi
+  8024dc:	0f 84 c0 00 00 00    	je     8025a2 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	41 57                	push   %r15
+  8024e8:	41 56                	push   %r14
+  8024ea:	41 55                	push   %r13
+  8024ec:	41 54                	push   %r12
+  8024ee:	53                   	push   %rbx
+  8024ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8024f3:	49 89 ff             	mov    %rdi,%r15
+  8024f6:	49 89 f5             	mov    %rsi,%r13
+  8024f9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8024fc:	48 85 f6             	test   %rsi,%rsi
+  8024ff:	0f 84 96 00 00 00    	je     80259b <devfile_read+0xc2>
+    while (n) {
+  802505:	48 85 d2             	test   %rdx,%rdx
+  802508:	0f 84 87 00 00 00    	je     802595 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80250e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802515:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802516:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80251d:	00 00 00 
+  802520:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802524:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802527:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80252c:	49 39 c4             	cmp    %rax,%r12
+  80252f:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802533:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802537:	be 00 00 00 00       	mov    $0x0,%esi
+  80253c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802541:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+        if (read <= 0) {
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	7e 37                	jle    802588 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802551:	48 63 d8             	movslq %eax,%rbx
+  802554:	48 89 da             	mov    %rbx,%rdx
+  802557:	4c 89 f6             	mov    %r14,%rsi
+  80255a:	4c 89 ef             	mov    %r13,%rdi
+  80255d:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  802564:	00 00 00 
+  802567:	ff d0                	call   *%rax
+        buf += read;
+  802569:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80256c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802570:	49 29 dc             	sub    %rbx,%r12
+  802573:	75 ab                	jne    802520 <devfile_read+0x47>
+  return totalRead;
+  802575:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802579:	48 83 c4 18          	add    $0x18,%rsp
+  80257d:	5b                   	pop    %rbx
+  80257e:	41 5c                	pop    %r12
+  802580:	41 5d                	pop    %r13
+  802582:	41 5e                	pop    %r14
+  802584:	41 5f                	pop    %r15
+  802586:	5d                   	pop    %rbp
+  802587:	c3                   	ret
+            return read ? read : totalRead;
+  802588:	48 63 d0             	movslq %eax,%rdx
+  80258b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80258f:	48 0f 45 c2          	cmovne %rdx,%rax
+  802593:	eb e4                	jmp    802579 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802595:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802599:	eb da                	jmp    802575 <devfile_read+0x9c>
+        return E_INVAL;
+  80259b:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025a0:	eb d7                	jmp    802579 <devfile_read+0xa0>
+  8025a2:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8025a7:	c3                   	ret
+
+00000000008025a8 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025a8:	48 85 ff             	test   %rdi,%rdi
+  8025ab:	74 5f                	je     80260c <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8025ad:	55                   	push   %rbp
+  8025ae:	48 89 e5             	mov    %rsp,%rbp
+  8025b1:	53                   	push   %rbx
+  8025b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b6:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025b9:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+  8025c5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025cb:	77 45                	ja     802612 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8025cd:	48 89 de             	mov    %rbx,%rsi
+  8025d0:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8025d7:	00 00 00 
+  8025da:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8025e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025eb:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025f0:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8025f7:	00 00 00 
+  8025fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802603:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802606:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+        return -E_INVAL;
+  80260c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802611:	c3                   	ret
+        return -E_INVAL;
+  802612:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802617:	eb ed                	jmp    802606 <devfile_receive_snapshot+0x5e>
+
+0000000000802619 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	41 55                	push   %r13
+  80261f:	41 54                	push   %r12
+  802621:	53                   	push   %rbx
+  802622:	48 83 ec 08          	sub    $0x8,%rsp
+  802626:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802629:	48 85 f6             	test   %rsi,%rsi
+  80262c:	0f 94 c0             	sete   %al
+  80262f:	48 85 d2             	test   %rdx,%rdx
+  802632:	0f 94 c2             	sete   %dl
+  802635:	08 d0                	or     %dl,%al
+  802637:	0f 85 ad 00 00 00    	jne    8026ea <devfile_send_snapshot+0xd1>
+  80263d:	48 89 fb             	mov    %rdi,%rbx
+  802640:	49 89 f4             	mov    %rsi,%r12
+  802643:	48 85 ff             	test   %rdi,%rdi
+  802646:	0f 84 9e 00 00 00    	je     8026ea <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  80264c:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80265e:	0f 87 8d 00 00 00    	ja     8026f1 <devfile_send_snapshot+0xd8>
+  802664:	4c 89 e7             	mov    %r12,%rdi
+  802667:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802679:	77 7d                	ja     8026f8 <devfile_send_snapshot+0xdf>
+  80267b:	4c 89 ef             	mov    %r13,%rdi
+  80267e:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802690:	77 6d                	ja     8026ff <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802692:	48 89 de             	mov    %rbx,%rsi
+  802695:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80269c:	00 00 00 
+  80269f:	48 bb 88 0b 80 00 00 	movabs $0x800b88,%rbx
+  8026a6:	00 00 00 
+  8026a9:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8026ab:	4c 89 e6             	mov    %r12,%rsi
+  8026ae:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8026b5:	00 00 00 
+  8026b8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8026ba:	4c 89 ee             	mov    %r13,%rsi
+  8026bd:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8026c4:	00 00 00 
+  8026c7:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8026c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ce:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026d3:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8026da:	00 00 00 
+  8026dd:	ff d0                	call   *%rax
+}
+  8026df:	48 83 c4 08          	add    $0x8,%rsp
+  8026e3:	5b                   	pop    %rbx
+  8026e4:	41 5c                	pop    %r12
+  8026e6:	41 5d                	pop    %r13
+  8026e8:	5d                   	pop    %rbp
+  8026e9:	c3                   	ret
+        return -E_INVAL;
+  8026ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ef:	eb ee                	jmp    8026df <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8026f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026f6:	eb e7                	jmp    8026df <devfile_send_snapshot+0xc6>
+  8026f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026fd:	eb e0                	jmp    8026df <devfile_send_snapshot+0xc6>
+  8026ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802704:	eb d9                	jmp    8026df <devfile_send_snapshot+0xc6>
+
+0000000000802706 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802706:	48 85 ff             	test   %rdi,%rdi
+  802709:	0f 84 41 01 00 00    	je     802850 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80270f:	55                   	push   %rbp
+  802710:	48 89 e5             	mov    %rsp,%rbp
+  802713:	41 57                	push   %r15
+  802715:	41 56                	push   %r14
+  802717:	41 55                	push   %r13
+  802719:	41 54                	push   %r12
+  80271b:	53                   	push   %rbx
+  80271c:	48 83 ec 08          	sub    $0x8,%rsp
+  802720:	49 89 fc             	mov    %rdi,%r12
+  802723:	49 89 f5             	mov    %rsi,%r13
+  802726:	48 89 d3             	mov    %rdx,%rbx
+  802729:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  80272c:	48 85 f6             	test   %rsi,%rsi
+  80272f:	0f 84 ff 00 00 00    	je     802834 <devfile_diff_snapshots+0x12e>
+  802735:	48 85 d2             	test   %rdx,%rdx
+  802738:	0f 84 fd 00 00 00    	je     80283b <devfile_diff_snapshots+0x135>
+  80273e:	48 85 c9             	test   %rcx,%rcx
+  802741:	0f 84 f4 00 00 00    	je     80283b <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802747:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+  802753:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802759:	0f 87 e3 00 00 00    	ja     802842 <devfile_diff_snapshots+0x13c>
+  80275f:	4c 89 ef             	mov    %r13,%rdi
+  802762:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+  80276e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802774:	0f 87 cf 00 00 00    	ja     802849 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80277a:	4c 89 e6             	mov    %r12,%rsi
+  80277d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802784:	00 00 00 
+  802787:	4c 89 e7             	mov    %r12,%rdi
+  80278a:	49 bf 88 0b 80 00 00 	movabs $0x800b88,%r15
+  802791:	00 00 00 
+  802794:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802797:	4c 89 ee             	mov    %r13,%rsi
+  80279a:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8027a1:	00 
+  8027a2:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8027a5:	48 8b 03             	mov    (%rbx),%rax
+  8027a8:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8027af:	00 
+  8027b0:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8027b4:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8027bb:	00 
+  8027bc:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8027c0:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8027c7:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8027c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8027d2:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 43                	js     802825 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8027e2:	49 8b 04 24          	mov    (%r12),%rax
+  8027e6:	48 89 03             	mov    %rax,(%rbx)
+  8027e9:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8027ee:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8027f2:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8027f7:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8027fb:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802800:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802804:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802808:	48 c1 e2 03          	shl    $0x3,%rdx
+  80280c:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802811:	4c 89 f7             	mov    %r14,%rdi
+  802814:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802820:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802825:	48 83 c4 08          	add    $0x8,%rsp
+  802829:	5b                   	pop    %rbx
+  80282a:	41 5c                	pop    %r12
+  80282c:	41 5d                	pop    %r13
+  80282e:	41 5e                	pop    %r14
+  802830:	41 5f                	pop    %r15
+  802832:	5d                   	pop    %rbp
+  802833:	c3                   	ret
+        return -E_INVAL;
+  802834:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802839:	eb ea                	jmp    802825 <devfile_diff_snapshots+0x11f>
+  80283b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802840:	eb e3                	jmp    802825 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802842:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802847:	eb dc                	jmp    802825 <devfile_diff_snapshots+0x11f>
+  802849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284e:	eb d5                	jmp    802825 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802850:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802855:	c3                   	ret
+
+0000000000802856 <devfile_delete_snapshot>:
+    if (!name) {
+  802856:	48 85 ff             	test   %rdi,%rdi
+  802859:	74 5f                	je     8028ba <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  80285b:	55                   	push   %rbp
+  80285c:	48 89 e5             	mov    %rsp,%rbp
+  80285f:	53                   	push   %rbx
+  802860:	48 83 ec 08          	sub    $0x8,%rsp
+  802864:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802867:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  80286e:	00 00 00 
+  802871:	ff d0                	call   *%rax
+  802873:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802879:	77 45                	ja     8028c0 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  80287b:	48 89 de             	mov    %rbx,%rsi
+  80287e:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802885:	00 00 00 
+  802888:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802894:	be 00 00 00 00       	mov    $0x0,%esi
+  802899:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80289e:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+        return -E_INVAL;
+  8028ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028bf:	c3                   	ret
+        return -E_INVAL;
+  8028c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c5:	eb ed                	jmp    8028b4 <devfile_delete_snapshot+0x5e>
+
+00000000008028c7 <devfile_accept_snapshot>:
+    if (!name) {
+  8028c7:	48 85 ff             	test   %rdi,%rdi
+  8028ca:	74 5f                	je     80292b <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8028cc:	55                   	push   %rbp
+  8028cd:	48 89 e5             	mov    %rsp,%rbp
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d5:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8028d8:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028ea:	77 45                	ja     802931 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8028ec:	48 89 de             	mov    %rbx,%rsi
+  8028ef:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8028f6:	00 00 00 
+  8028f9:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  802900:	00 00 00 
+  802903:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802905:	be 00 00 00 00       	mov    $0x0,%esi
+  80290a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80290f:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802922:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802925:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+        return -E_INVAL;
+  80292b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802930:	c3                   	ret
+        return -E_INVAL;
+  802931:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802936:	eb ed                	jmp    802925 <devfile_accept_snapshot+0x5e>
+
+0000000000802938 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802938:	48 85 ff             	test   %rdi,%rdi
+  80293b:	0f 84 9f 00 00 00    	je     8029e0 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802941:	55                   	push   %rbp
+  802942:	48 89 e5             	mov    %rsp,%rbp
+  802945:	41 54                	push   %r12
+  802947:	53                   	push   %rbx
+  802948:	48 89 fb             	mov    %rdi,%rbx
+  80294b:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  80294e:	48 85 f6             	test   %rsi,%rsi
+  802951:	74 78                	je     8029cb <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802953:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+  80295f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802965:	77 6b                	ja     8029d2 <devfile_create_snapshot+0x9a>
+  802967:	4c 89 e7             	mov    %r12,%rdi
+  80296a:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80297c:	77 5b                	ja     8029d9 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  80297e:	48 89 de             	mov    %rbx,%rsi
+  802981:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802988:	00 00 00 
+  80298b:	48 bb 88 0b 80 00 00 	movabs $0x800b88,%rbx
+  802992:	00 00 00 
+  802995:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802997:	4c 89 e6             	mov    %r12,%rsi
+  80299a:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8029a1:	00 00 00 
+  8029a4:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8029a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ab:	bf 08 00 00 00       	mov    $0x8,%edi
+  8029b0:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029c6:	5b                   	pop    %rbx
+  8029c7:	41 5c                	pop    %r12
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+        return -E_INVAL;
+  8029cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d0:	eb f4                	jmp    8029c6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8029d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d7:	eb ed                	jmp    8029c6 <devfile_create_snapshot+0x8e>
+  8029d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029de:	eb e6                	jmp    8029c6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8029e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029e5:	c3                   	ret
+
+00000000008029e6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	41 54                	push   %r12
+  8029ec:	53                   	push   %rbx
+  8029ed:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029f0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8029f3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8029fa:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8029fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802a01:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a06:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a12:	85 c0                	test   %eax,%eax
+  802a14:	78 3d                	js     802a53 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a16:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802a1d:	00 00 00 
+  802a20:	4c 89 e6             	mov    %r12,%rsi
+  802a23:	48 89 df             	mov    %rbx,%rdi
+  802a26:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a32:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a39:	00 
+  802a3a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a40:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a47:	00 
+  802a48:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a53:	5b                   	pop    %rbx
+  802a54:	41 5c                	pop    %r12
+  802a56:	5d                   	pop    %rbp
+  802a57:	c3                   	ret
+
+0000000000802a58 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802a58:	55                   	push   %rbp
+  802a59:	48 89 e5             	mov    %rsp,%rbp
+  802a5c:	41 57                	push   %r15
+  802a5e:	41 56                	push   %r14
+  802a60:	41 55                	push   %r13
+  802a62:	41 54                	push   %r12
+  802a64:	53                   	push   %rbx
+  802a65:	48 83 ec 38          	sub    $0x38,%rsp
+  802a69:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802a6d:	49 89 f5             	mov    %rsi,%r13
+  802a70:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a73:	48 89 f0             	mov    %rsi,%rax
+  802a76:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a7b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a7f:	75 4f                	jne    802ad0 <devfile_readmap+0x78>
+  802a81:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a85:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a8b:	75 1f                	jne    802aac <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802a8d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a91:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a95:	49 be 40 32 80 00 00 	movabs $0x803240,%r14
+  802a9c:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a9f:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802aa6:	0f 87 9d 00 00 00    	ja     802b49 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802aac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ab0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802ab4:	4d 85 ff             	test   %r15,%r15
+  802ab7:	0f 85 cf 00 00 00    	jne    802b8c <devfile_readmap+0x134>
+  802abd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802ac1:	48 83 c4 38          	add    $0x38,%rsp
+  802ac5:	5b                   	pop    %rbx
+  802ac6:	41 5c                	pop    %r12
+  802ac8:	41 5d                	pop    %r13
+  802aca:	41 5e                	pop    %r14
+  802acc:	41 5f                	pop    %r15
+  802ace:	5d                   	pop    %rbp
+  802acf:	c3                   	ret
+    size_t totalRead = 0;
+  802ad0:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802ad7:	00 
+  802ad8:	eb da                	jmp    802ab4 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ada:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ade:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ae1:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802ae8:	00 00 00 
+  802aeb:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802aed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802af1:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802af5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802af9:	4c 89 ee             	mov    %r13,%rsi
+  802afc:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b01:	48 b8 06 22 80 00 00 	movabs $0x802206,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802b0d:	85 c0                	test   %eax,%eax
+  802b0f:	7e a3                	jle    802ab4 <devfile_readmap+0x5c>
+  802b11:	48 98                	cltq
+  802b13:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b17:	72 9b                	jb     802ab4 <devfile_readmap+0x5c>
+        buf += read;
+  802b19:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802b1c:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802b1f:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b23:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802b2a:	75 88                	jne    802ab4 <devfile_readmap+0x5c>
+  802b2c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b30:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b36:	0f 85 78 ff ff ff    	jne    802ab4 <devfile_readmap+0x5c>
+  802b3c:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802b43:	0f 86 6b ff ff ff    	jbe    802ab4 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802b49:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802b4f:	4d 39 e7             	cmp    %r12,%r15
+  802b52:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802b56:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802b5d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b61:	0f 84 73 ff ff ff    	je     802ada <devfile_readmap+0x82>
+  802b67:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b6b:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802b70:	41 ff d6             	call   *%r14
+  802b73:	a8 40                	test   $0x40,%al
+  802b75:	0f 85 39 ff ff ff    	jne    802ab4 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b7b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b82:	4c 39 e3             	cmp    %r12,%rbx
+  802b85:	72 e4                	jb     802b6b <devfile_readmap+0x113>
+  802b87:	e9 4e ff ff ff       	jmp    802ada <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802b8c:	4c 89 fa             	mov    %r15,%rdx
+  802b8f:	4c 89 ee             	mov    %r13,%rsi
+  802b92:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b96:	48 b8 d9 24 80 00 00 	movabs $0x8024d9,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802ba2:	48 85 c0             	test   %rax,%rax
+  802ba5:	78 0c                	js     802bb3 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802ba7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bab:	48 01 f0             	add    %rsi,%rax
+  802bae:	e9 0e ff ff ff       	jmp    802ac1 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802bb3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bb7:	48 85 f6             	test   %rsi,%rsi
+  802bba:	48 0f 45 c6          	cmovne %rsi,%rax
+  802bbe:	e9 fe fe ff ff       	jmp    802ac1 <devfile_readmap+0x69>
+
+0000000000802bc3 <open>:
+open(const char *path, int mode) {
+  802bc3:	55                   	push   %rbp
+  802bc4:	48 89 e5             	mov    %rsp,%rbp
+  802bc7:	41 55                	push   %r13
+  802bc9:	41 54                	push   %r12
+  802bcb:	53                   	push   %rbx
+  802bcc:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd0:	49 89 fc             	mov    %rdi,%r12
+  802bd3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802bd6:	48 b8 4a 0b 80 00 00 	movabs $0x800b4a,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+  802be2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802be8:	0f 87 8a 00 00 00    	ja     802c78 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bee:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bf2:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+  802bfe:	89 c3                	mov    %eax,%ebx
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 50                	js     802c54 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c04:	4c 89 e6             	mov    %r12,%rsi
+  802c07:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802c0e:	00 00 00 
+  802c11:	48 89 df             	mov    %rbx,%rdi
+  802c14:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  802c1b:	00 00 00 
+  802c1e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c20:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c27:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c30:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+  802c3c:	89 c3                	mov    %eax,%ebx
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	78 1f                	js     802c61 <open+0x9e>
+    return fd2num(fd);
+  802c42:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c46:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  802c52:	89 c3                	mov    %eax,%ebx
+}
+  802c54:	89 d8                	mov    %ebx,%eax
+  802c56:	48 83 c4 18          	add    $0x18,%rsp
+  802c5a:	5b                   	pop    %rbx
+  802c5b:	41 5c                	pop    %r12
+  802c5d:	41 5d                	pop    %r13
+  802c5f:	5d                   	pop    %rbp
+  802c60:	c3                   	ret
+        fd_close(fd, 0);
+  802c61:	be 00 00 00 00       	mov    $0x0,%esi
+  802c66:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c6a:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+        return res;
+  802c76:	eb dc                	jmp    802c54 <open+0x91>
+        return -E_BAD_PATH;
+  802c78:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802c7d:	eb d5                	jmp    802c54 <open+0x91>
+
+0000000000802c7f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802c7f:	55                   	push   %rbp
+  802c80:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802c83:	be 00 00 00 00       	mov    $0x0,%esi
+  802c88:	bf 13 00 00 00       	mov    $0x13,%edi
+  802c8d:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+}
+  802c99:	5d                   	pop    %rbp
+  802c9a:	c3                   	ret
+
+0000000000802c9b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c9b:	55                   	push   %rbp
+  802c9c:	48 89 e5             	mov    %rsp,%rbp
+  802c9f:	41 54                	push   %r12
+  802ca1:	53                   	push   %rbx
+  802ca2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ca5:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802cac:	00 00 00 
+  802caf:	ff d0                	call   *%rax
+  802cb1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cb4:	48 be 20 3f 80 00 00 	movabs $0x803f20,%rsi
+  802cbb:	00 00 00 
+  802cbe:	48 89 df             	mov    %rbx,%rdi
+  802cc1:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802ccd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cd2:	41 2b 04 24          	sub    (%r12),%eax
+  802cd6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cdc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ce3:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ce6:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802ced:	00 00 00 
+  802cf0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfc:	5b                   	pop    %rbx
+  802cfd:	41 5c                	pop    %r12
+  802cff:	5d                   	pop    %rbp
+  802d00:	c3                   	ret
+
+0000000000802d01 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d01:	55                   	push   %rbp
+  802d02:	48 89 e5             	mov    %rsp,%rbp
+  802d05:	41 54                	push   %r12
+  802d07:	53                   	push   %rbx
+  802d08:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d10:	48 89 fe             	mov    %rdi,%rsi
+  802d13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d18:	49 bc e0 12 80 00 00 	movabs $0x8012e0,%r12
+  802d1f:	00 00 00 
+  802d22:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d25:	48 89 df             	mov    %rbx,%rdi
+  802d28:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802d2f:	00 00 00 
+  802d32:	ff d0                	call   *%rax
+  802d34:	48 89 c6             	mov    %rax,%rsi
+  802d37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d41:	41 ff d4             	call   *%r12
+}
+  802d44:	5b                   	pop    %rbx
+  802d45:	41 5c                	pop    %r12
+  802d47:	5d                   	pop    %rbp
+  802d48:	c3                   	ret
+
+0000000000802d49 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	41 57                	push   %r15
+  802d4f:	41 56                	push   %r14
+  802d51:	41 55                	push   %r13
+  802d53:	41 54                	push   %r12
+  802d55:	53                   	push   %rbx
+  802d56:	48 83 ec 18          	sub    $0x18,%rsp
+  802d5a:	49 89 fc             	mov    %rdi,%r12
+  802d5d:	49 89 f5             	mov    %rsi,%r13
+  802d60:	49 89 d7             	mov    %rdx,%r15
+  802d63:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d67:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802d6e:	00 00 00 
+  802d71:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802d73:	4d 85 ff             	test   %r15,%r15
+  802d76:	0f 84 af 00 00 00    	je     802e2b <devpipe_write+0xe2>
+  802d7c:	48 89 c3             	mov    %rax,%rbx
+  802d7f:	4c 89 f8             	mov    %r15,%rax
+  802d82:	4d 89 ef             	mov    %r13,%r15
+  802d85:	4c 01 e8             	add    %r13,%rax
+  802d88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d8c:	49 bd e8 11 80 00 00 	movabs $0x8011e8,%r13
+  802d93:	00 00 00 
+            sys_yield();
+  802d96:	49 be 85 11 80 00 00 	movabs $0x801185,%r14
+  802d9d:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802da0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802da3:	48 63 ce             	movslq %esi,%rcx
+  802da6:	48 63 03             	movslq (%rbx),%rax
+  802da9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802daf:	48 39 c1             	cmp    %rax,%rcx
+  802db2:	72 2e                	jb     802de2 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802db4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802db9:	48 89 da             	mov    %rbx,%rdx
+  802dbc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dc1:	4c 89 e7             	mov    %r12,%rdi
+  802dc4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802dc7:	85 c0                	test   %eax,%eax
+  802dc9:	74 66                	je     802e31 <devpipe_write+0xe8>
+            sys_yield();
+  802dcb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802dce:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dd1:	48 63 ce             	movslq %esi,%rcx
+  802dd4:	48 63 03             	movslq (%rbx),%rax
+  802dd7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ddd:	48 39 c1             	cmp    %rax,%rcx
+  802de0:	73 d2                	jae    802db4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802de2:	41 0f b6 3f          	movzbl (%r15),%edi
+  802de6:	48 89 ca             	mov    %rcx,%rdx
+  802de9:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ded:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802df4:	08 10 20 
+  802df7:	48 f7 e2             	mul    %rdx
+  802dfa:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dfe:	48 89 d0             	mov    %rdx,%rax
+  802e01:	48 c1 e0 09          	shl    $0x9,%rax
+  802e05:	48 29 d0             	sub    %rdx,%rax
+  802e08:	48 c1 e0 03          	shl    $0x3,%rax
+  802e0c:	48 29 c1             	sub    %rax,%rcx
+  802e0f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e14:	83 c6 01             	add    $0x1,%esi
+  802e17:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e1a:	49 83 c7 01          	add    $0x1,%r15
+  802e1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e22:	49 39 c7             	cmp    %rax,%r15
+  802e25:	0f 85 75 ff ff ff    	jne    802da0 <devpipe_write+0x57>
+    return n;
+  802e2b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e2f:	eb 05                	jmp    802e36 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e36:	48 83 c4 18          	add    $0x18,%rsp
+  802e3a:	5b                   	pop    %rbx
+  802e3b:	41 5c                	pop    %r12
+  802e3d:	41 5d                	pop    %r13
+  802e3f:	41 5e                	pop    %r14
+  802e41:	41 5f                	pop    %r15
+  802e43:	5d                   	pop    %rbp
+  802e44:	c3                   	ret
+
+0000000000802e45 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e45:	55                   	push   %rbp
+  802e46:	48 89 e5             	mov    %rsp,%rbp
+  802e49:	41 57                	push   %r15
+  802e4b:	41 56                	push   %r14
+  802e4d:	41 55                	push   %r13
+  802e4f:	41 54                	push   %r12
+  802e51:	53                   	push   %rbx
+  802e52:	48 83 ec 18          	sub    $0x18,%rsp
+  802e56:	49 89 fc             	mov    %rdi,%r12
+  802e59:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e5d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e61:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802e68:	00 00 00 
+  802e6b:	ff d0                	call   *%rax
+  802e6d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e70:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e76:	49 bd e8 11 80 00 00 	movabs $0x8011e8,%r13
+  802e7d:	00 00 00 
+            sys_yield();
+  802e80:	49 be 85 11 80 00 00 	movabs $0x801185,%r14
+  802e87:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802e8a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802e8f:	74 7d                	je     802f0e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e91:	8b 03                	mov    (%rbx),%eax
+  802e93:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e96:	75 26                	jne    802ebe <devpipe_read+0x79>
+            if (i > 0) return i;
+  802e98:	4d 85 ff             	test   %r15,%r15
+  802e9b:	75 77                	jne    802f14 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e9d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ea2:	48 89 da             	mov    %rbx,%rdx
+  802ea5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eaa:	4c 89 e7             	mov    %r12,%rdi
+  802ead:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	74 72                	je     802f26 <devpipe_read+0xe1>
+            sys_yield();
+  802eb4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802eb7:	8b 03                	mov    (%rbx),%eax
+  802eb9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ebc:	74 df                	je     802e9d <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ebe:	48 63 c8             	movslq %eax,%rcx
+  802ec1:	48 89 ca             	mov    %rcx,%rdx
+  802ec4:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ec8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802ecf:	08 10 20 
+  802ed2:	48 89 d0             	mov    %rdx,%rax
+  802ed5:	48 f7 e6             	mul    %rsi
+  802ed8:	48 c1 ea 06          	shr    $0x6,%rdx
+  802edc:	48 89 d0             	mov    %rdx,%rax
+  802edf:	48 c1 e0 09          	shl    $0x9,%rax
+  802ee3:	48 29 d0             	sub    %rdx,%rax
+  802ee6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802eed:	00 
+  802eee:	48 89 c8             	mov    %rcx,%rax
+  802ef1:	48 29 d0             	sub    %rdx,%rax
+  802ef4:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802ef9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802efd:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f01:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f04:	49 83 c7 01          	add    $0x1,%r15
+  802f08:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f0c:	75 83                	jne    802e91 <devpipe_read+0x4c>
+    return n;
+  802f0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f12:	eb 03                	jmp    802f17 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f14:	4c 89 f8             	mov    %r15,%rax
+}
+  802f17:	48 83 c4 18          	add    $0x18,%rsp
+  802f1b:	5b                   	pop    %rbx
+  802f1c:	41 5c                	pop    %r12
+  802f1e:	41 5d                	pop    %r13
+  802f20:	41 5e                	pop    %r14
+  802f22:	41 5f                	pop    %r15
+  802f24:	5d                   	pop    %rbp
+  802f25:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2b:	eb ea                	jmp    802f17 <devpipe_read+0xd2>
+
+0000000000802f2d <pipe>:
+pipe(int pfd[2]) {
+  802f2d:	55                   	push   %rbp
+  802f2e:	48 89 e5             	mov    %rsp,%rbp
+  802f31:	41 55                	push   %r13
+  802f33:	41 54                	push   %r12
+  802f35:	53                   	push   %rbx
+  802f36:	48 83 ec 18          	sub    $0x18,%rsp
+  802f3a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f3d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f41:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  802f48:	00 00 00 
+  802f4b:	ff d0                	call   *%rax
+  802f4d:	89 c3                	mov    %eax,%ebx
+  802f4f:	85 c0                	test   %eax,%eax
+  802f51:	0f 88 a0 01 00 00    	js     8030f7 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f57:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f5c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f61:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6a:	48 b8 14 12 80 00 00 	movabs $0x801214,%rax
+  802f71:	00 00 00 
+  802f74:	ff d0                	call   *%rax
+  802f76:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	0f 88 77 01 00 00    	js     8030f7 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f80:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802f84:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  802f8b:	00 00 00 
+  802f8e:	ff d0                	call   *%rax
+  802f90:	89 c3                	mov    %eax,%ebx
+  802f92:	85 c0                	test   %eax,%eax
+  802f94:	0f 88 43 01 00 00    	js     8030dd <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802f9a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fa8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fad:	48 b8 14 12 80 00 00 	movabs $0x801214,%rax
+  802fb4:	00 00 00 
+  802fb7:	ff d0                	call   *%rax
+  802fb9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	0f 88 1a 01 00 00    	js     8030dd <pipe+0x1b0>
+    va = fd2data(fd0);
+  802fc3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fc7:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+  802fd3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802fd6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe0:	48 89 c6             	mov    %rax,%rsi
+  802fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe8:	48 b8 14 12 80 00 00 	movabs $0x801214,%rax
+  802fef:	00 00 00 
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	89 c3                	mov    %eax,%ebx
+  802ff6:	85 c0                	test   %eax,%eax
+  802ff8:	0f 88 c5 00 00 00    	js     8030c3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802ffe:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803002:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+  80300e:	48 89 c1             	mov    %rax,%rcx
+  803011:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803017:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80301d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803022:	4c 89 ee             	mov    %r13,%rsi
+  803025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80302a:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	89 c3                	mov    %eax,%ebx
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	78 6e                	js     8030aa <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80303c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803041:	4c 89 ef             	mov    %r13,%rdi
+  803044:	48 b8 b6 11 80 00 00 	movabs $0x8011b6,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  803050:	83 f8 02             	cmp    $0x2,%eax
+  803053:	0f 85 ab 00 00 00    	jne    803104 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803059:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  803060:	00 00 
+  803062:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803066:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803068:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80306c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803073:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803077:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803079:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80307d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803084:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803088:	48 bb f3 16 80 00 00 	movabs $0x8016f3,%rbx
+  80308f:	00 00 00 
+  803092:	ff d3                	call   *%rbx
+  803094:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803098:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80309c:	ff d3                	call   *%rbx
+  80309e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030a8:	eb 4d                	jmp    8030f7 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8030aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030af:	4c 89 ee             	mov    %r13,%rsi
+  8030b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b7:	48 b8 e0 12 80 00 00 	movabs $0x8012e0,%rax
+  8030be:	00 00 00 
+  8030c1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8030c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d1:	48 b8 e0 12 80 00 00 	movabs $0x8012e0,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8030dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030eb:	48 b8 e0 12 80 00 00 	movabs $0x8012e0,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+}
+  8030f7:	89 d8                	mov    %ebx,%eax
+  8030f9:	48 83 c4 18          	add    $0x18,%rsp
+  8030fd:	5b                   	pop    %rbx
+  8030fe:	41 5c                	pop    %r12
+  803100:	41 5d                	pop    %r13
+  803102:	5d                   	pop    %rbp
+  803103:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803104:	48 b9 50 3f 80 00 00 	movabs $0x803f50,%rcx
+  80310b:	00 00 00 
+  80310e:	48 ba 27 3f 80 00 00 	movabs $0x803f27,%rdx
+  803115:	00 00 00 
+  803118:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80311d:	48 bf 3c 3f 80 00 00 	movabs $0x803f3c,%rdi
+  803124:	00 00 00 
+  803127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312c:	49 b8 84 35 80 00 00 	movabs $0x803584,%r8
+  803133:	00 00 00 
+  803136:	41 ff d0             	call   *%r8
+
+0000000000803139 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803139:	55                   	push   %rbp
+  80313a:	48 89 e5             	mov    %rsp,%rbp
+  80313d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803141:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803145:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  80314c:	00 00 00 
+  80314f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803151:	85 c0                	test   %eax,%eax
+  803153:	78 35                	js     80318a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803155:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803159:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  803160:	00 00 00 
+  803163:	ff d0                	call   *%rax
+  803165:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803168:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80316d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803172:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803176:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	85 c0                	test   %eax,%eax
+  803184:	0f 94 c0             	sete   %al
+  803187:	0f b6 c0             	movzbl %al,%eax
+}
+  80318a:	c9                   	leave
+  80318b:	c3                   	ret
+
+000000000080318c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80318c:	48 89 f8             	mov    %rdi,%rax
+  80318f:	48 c1 e8 27          	shr    $0x27,%rax
+  803193:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80319a:	01 00 00 
+  80319d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031a1:	f6 c2 01             	test   $0x1,%dl
+  8031a4:	74 6d                	je     803213 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031a6:	48 89 f8             	mov    %rdi,%rax
+  8031a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031ad:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031b4:	01 00 00 
+  8031b7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031bb:	f6 c2 01             	test   $0x1,%dl
+  8031be:	74 62                	je     803222 <get_uvpt_entry+0x96>
+  8031c0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031c7:	01 00 00 
+  8031ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031ce:	f6 c2 80             	test   $0x80,%dl
+  8031d1:	75 4f                	jne    803222 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8031d3:	48 89 f8             	mov    %rdi,%rax
+  8031d6:	48 c1 e8 15          	shr    $0x15,%rax
+  8031da:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031e1:	01 00 00 
+  8031e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031e8:	f6 c2 01             	test   $0x1,%dl
+  8031eb:	74 44                	je     803231 <get_uvpt_entry+0xa5>
+  8031ed:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031f4:	01 00 00 
+  8031f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031fb:	f6 c2 80             	test   $0x80,%dl
+  8031fe:	75 31                	jne    803231 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803200:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803204:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80320b:	01 00 00 
+  80320e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803212:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803213:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80321a:	01 00 00 
+  80321d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803221:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803222:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803229:	01 00 00 
+  80322c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803230:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803231:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803238:	01 00 00 
+  80323b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80323f:	c3                   	ret
+
+0000000000803240 <get_prot>:
+
+int
+get_prot(void *va) {
+  803240:	55                   	push   %rbp
+  803241:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803244:	48 b8 8c 31 80 00 00 	movabs $0x80318c,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+  803250:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803253:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803258:	89 c1                	mov    %eax,%ecx
+  80325a:	83 c9 04             	or     $0x4,%ecx
+  80325d:	f6 c2 01             	test   $0x1,%dl
+  803260:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803263:	89 c1                	mov    %eax,%ecx
+  803265:	83 c9 02             	or     $0x2,%ecx
+  803268:	f6 c2 02             	test   $0x2,%dl
+  80326b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80326e:	89 c1                	mov    %eax,%ecx
+  803270:	83 c9 01             	or     $0x1,%ecx
+  803273:	48 85 d2             	test   %rdx,%rdx
+  803276:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803279:	89 c1                	mov    %eax,%ecx
+  80327b:	83 c9 40             	or     $0x40,%ecx
+  80327e:	f6 c6 04             	test   $0x4,%dh
+  803281:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803284:	5d                   	pop    %rbp
+  803285:	c3                   	ret
+
+0000000000803286 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80328a:	48 b8 8c 31 80 00 00 	movabs $0x80318c,%rax
+  803291:	00 00 00 
+  803294:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803296:	48 c1 e8 06          	shr    $0x6,%rax
+  80329a:	83 e0 01             	and    $0x1,%eax
+}
+  80329d:	5d                   	pop    %rbp
+  80329e:	c3                   	ret
+
+000000000080329f <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80329f:	55                   	push   %rbp
+  8032a0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032a3:	48 b8 8c 31 80 00 00 	movabs $0x80318c,%rax
+  8032aa:	00 00 00 
+  8032ad:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8032af:	48 c1 e8 05          	shr    $0x5,%rax
+  8032b3:	83 e0 01             	and    $0x1,%eax
+}
+  8032b6:	5d                   	pop    %rbp
+  8032b7:	c3                   	ret
+
+00000000008032b8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032b8:	55                   	push   %rbp
+  8032b9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032bc:	48 b8 8c 31 80 00 00 	movabs $0x80318c,%rax
+  8032c3:	00 00 00 
+  8032c6:	ff d0                	call   *%rax
+  8032c8:	83 e0 01             	and    $0x1,%eax
+}
+  8032cb:	5d                   	pop    %rbp
+  8032cc:	c3                   	ret
+
+00000000008032cd <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8032cd:	55                   	push   %rbp
+  8032ce:	48 89 e5             	mov    %rsp,%rbp
+  8032d1:	41 57                	push   %r15
+  8032d3:	41 56                	push   %r14
+  8032d5:	41 55                	push   %r13
+  8032d7:	41 54                	push   %r12
+  8032d9:	53                   	push   %rbx
+  8032da:	48 83 ec 18          	sub    $0x18,%rsp
+  8032de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032e2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8032e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8032eb:	49 bd b8 32 80 00 00 	movabs $0x8032b8,%r13
+  8032f2:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8032f5:	49 bf 40 32 80 00 00 	movabs $0x803240,%r15
+  8032fc:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8032ff:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803306:	00 00 00 
+  803309:	eb 0c                	jmp    803317 <foreach_shared_region+0x4a>
+  80330b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803312:	4c 39 f3             	cmp    %r14,%rbx
+  803315:	74 2e                	je     803345 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803317:	48 89 df             	mov    %rbx,%rdi
+  80331a:	41 ff d5             	call   *%r13
+  80331d:	84 c0                	test   %al,%al
+  80331f:	74 ea                	je     80330b <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803321:	48 89 df             	mov    %rbx,%rdi
+  803324:	41 ff d7             	call   *%r15
+  803327:	a8 40                	test   $0x40,%al
+  803329:	74 e0                	je     80330b <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80332b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803332:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803336:	48 89 df             	mov    %rbx,%rdi
+  803339:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80333d:	ff d0                	call   *%rax
+				if (res < 0) {
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	79 c8                	jns    80330b <foreach_shared_region+0x3e>
+  803343:	eb 05                	jmp    80334a <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803345:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80334a:	48 83 c4 18          	add    $0x18,%rsp
+  80334e:	5b                   	pop    %rbx
+  80334f:	41 5c                	pop    %r12
+  803351:	41 5d                	pop    %r13
+  803353:	41 5e                	pop    %r14
+  803355:	41 5f                	pop    %r15
+  803357:	5d                   	pop    %rbp
+  803358:	c3                   	ret
+
+0000000000803359 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335e:	c3                   	ret
+
+000000000080335f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80335f:	55                   	push   %rbp
+  803360:	48 89 e5             	mov    %rsp,%rbp
+  803363:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803366:	48 be 74 3f 80 00 00 	movabs $0x803f74,%rsi
+  80336d:	00 00 00 
+  803370:	48 b8 88 0b 80 00 00 	movabs $0x800b88,%rax
+  803377:	00 00 00 
+  80337a:	ff d0                	call   *%rax
+    return 0;
+}
+  80337c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803381:	5d                   	pop    %rbp
+  803382:	c3                   	ret
+
+0000000000803383 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803383:	55                   	push   %rbp
+  803384:	48 89 e5             	mov    %rsp,%rbp
+  803387:	41 57                	push   %r15
+  803389:	41 56                	push   %r14
+  80338b:	41 55                	push   %r13
+  80338d:	41 54                	push   %r12
+  80338f:	53                   	push   %rbx
+  803390:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803397:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80339e:	48 85 d2             	test   %rdx,%rdx
+  8033a1:	74 7a                	je     80341d <devcons_write+0x9a>
+  8033a3:	49 89 d6             	mov    %rdx,%r14
+  8033a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033ac:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8033b1:	49 bf 82 0d 80 00 00 	movabs $0x800d82,%r15
+  8033b8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8033bb:	4c 89 f3             	mov    %r14,%rbx
+  8033be:	48 29 f3             	sub    %rsi,%rbx
+  8033c1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033c6:	48 39 c3             	cmp    %rax,%rbx
+  8033c9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8033cd:	4c 63 eb             	movslq %ebx,%r13
+  8033d0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8033d7:	48 01 c6             	add    %rax,%rsi
+  8033da:	4c 89 ea             	mov    %r13,%rdx
+  8033dd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033e4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8033e7:	4c 89 ee             	mov    %r13,%rsi
+  8033ea:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033f1:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  8033f8:	00 00 00 
+  8033fb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8033fd:	41 01 dc             	add    %ebx,%r12d
+  803400:	49 63 f4             	movslq %r12d,%rsi
+  803403:	4c 39 f6             	cmp    %r14,%rsi
+  803406:	72 b3                	jb     8033bb <devcons_write+0x38>
+    return res;
+  803408:	49 63 c4             	movslq %r12d,%rax
+}
+  80340b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803412:	5b                   	pop    %rbx
+  803413:	41 5c                	pop    %r12
+  803415:	41 5d                	pop    %r13
+  803417:	41 5e                	pop    %r14
+  803419:	41 5f                	pop    %r15
+  80341b:	5d                   	pop    %rbp
+  80341c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80341d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803423:	eb e3                	jmp    803408 <devcons_write+0x85>
+
+0000000000803425 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803425:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803428:	ba 00 00 00 00       	mov    $0x0,%edx
+  80342d:	48 85 c0             	test   %rax,%rax
+  803430:	74 55                	je     803487 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803432:	55                   	push   %rbp
+  803433:	48 89 e5             	mov    %rsp,%rbp
+  803436:	41 55                	push   %r13
+  803438:	41 54                	push   %r12
+  80343a:	53                   	push   %rbx
+  80343b:	48 83 ec 08          	sub    $0x8,%rsp
+  80343f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803442:	48 bb b8 10 80 00 00 	movabs $0x8010b8,%rbx
+  803449:	00 00 00 
+  80344c:	49 bc 85 11 80 00 00 	movabs $0x801185,%r12
+  803453:	00 00 00 
+  803456:	eb 03                	jmp    80345b <devcons_read+0x36>
+  803458:	41 ff d4             	call   *%r12
+  80345b:	ff d3                	call   *%rbx
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	74 f7                	je     803458 <devcons_read+0x33>
+    if (c < 0) return c;
+  803461:	48 63 d0             	movslq %eax,%rdx
+  803464:	78 13                	js     803479 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803466:	ba 00 00 00 00       	mov    $0x0,%edx
+  80346b:	83 f8 04             	cmp    $0x4,%eax
+  80346e:	74 09                	je     803479 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803470:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803474:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803479:	48 89 d0             	mov    %rdx,%rax
+  80347c:	48 83 c4 08          	add    $0x8,%rsp
+  803480:	5b                   	pop    %rbx
+  803481:	41 5c                	pop    %r12
+  803483:	41 5d                	pop    %r13
+  803485:	5d                   	pop    %rbp
+  803486:	c3                   	ret
+  803487:	48 89 d0             	mov    %rdx,%rax
+  80348a:	c3                   	ret
+
+000000000080348b <cputchar>:
+cputchar(int ch) {
+  80348b:	55                   	push   %rbp
+  80348c:	48 89 e5             	mov    %rsp,%rbp
+  80348f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803493:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803497:	be 01 00 00 00       	mov    $0x1,%esi
+  80349c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034a0:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  8034a7:	00 00 00 
+  8034aa:	ff d0                	call   *%rax
+}
+  8034ac:	c9                   	leave
+  8034ad:	c3                   	ret
+
+00000000008034ae <getchar>:
+getchar(void) {
+  8034ae:	55                   	push   %rbp
+  8034af:	48 89 e5             	mov    %rsp,%rbp
+  8034b2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8034b6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034bb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8034bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c4:	48 b8 64 1a 80 00 00 	movabs $0x801a64,%rax
+  8034cb:	00 00 00 
+  8034ce:	ff d0                	call   *%rax
+  8034d0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	78 06                	js     8034dc <getchar+0x2e>
+  8034d6:	74 08                	je     8034e0 <getchar+0x32>
+  8034d8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8034dc:	89 d0                	mov    %edx,%eax
+  8034de:	c9                   	leave
+  8034df:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8034e0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8034e5:	eb f5                	jmp    8034dc <getchar+0x2e>
+
+00000000008034e7 <iscons>:
+iscons(int fdnum) {
+  8034e7:	55                   	push   %rbp
+  8034e8:	48 89 e5             	mov    %rsp,%rbp
+  8034eb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034ef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034f3:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034ff:	85 c0                	test   %eax,%eax
+  803501:	78 18                	js     80351b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803503:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803507:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80350e:	00 00 00 
+  803511:	8b 00                	mov    (%rax),%eax
+  803513:	39 02                	cmp    %eax,(%rdx)
+  803515:	0f 94 c0             	sete   %al
+  803518:	0f b6 c0             	movzbl %al,%eax
+}
+  80351b:	c9                   	leave
+  80351c:	c3                   	ret
+
+000000000080351d <opencons>:
+opencons(void) {
+  80351d:	55                   	push   %rbp
+  80351e:	48 89 e5             	mov    %rsp,%rbp
+  803521:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803525:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803529:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  803530:	00 00 00 
+  803533:	ff d0                	call   *%rax
+  803535:	85 c0                	test   %eax,%eax
+  803537:	78 49                	js     803582 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803539:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80353e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803543:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354c:	48 b8 14 12 80 00 00 	movabs $0x801214,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+  803558:	85 c0                	test   %eax,%eax
+  80355a:	78 26                	js     803582 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80355c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803560:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  803567:	00 00 
+  803569:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80356b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80356f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803576:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+}
+  803582:	c9                   	leave
+  803583:	c3                   	ret
+
+0000000000803584 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+  803588:	41 56                	push   %r14
+  80358a:	41 55                	push   %r13
+  80358c:	41 54                	push   %r12
+  80358e:	53                   	push   %rbx
+  80358f:	48 83 ec 50          	sub    $0x50,%rsp
+  803593:	49 89 fc             	mov    %rdi,%r12
+  803596:	41 89 f5             	mov    %esi,%r13d
+  803599:	48 89 d3             	mov    %rdx,%rbx
+  80359c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8035a0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8035a4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8035a8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8035af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035b3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035b7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8035bb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8035bf:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8035c6:	00 00 00 
+  8035c9:	4c 8b 30             	mov    (%rax),%r14
+  8035cc:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+  8035d8:	89 c6                	mov    %eax,%esi
+  8035da:	45 89 e8             	mov    %r13d,%r8d
+  8035dd:	4c 89 e1             	mov    %r12,%rcx
+  8035e0:	4c 89 f2             	mov    %r14,%rdx
+  8035e3:	48 bf 80 3f 80 00 00 	movabs $0x803f80,%rdi
+  8035ea:	00 00 00 
+  8035ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f2:	49 bc 63 02 80 00 00 	movabs $0x800263,%r12
+  8035f9:	00 00 00 
+  8035fc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8035ff:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803603:	48 89 df             	mov    %rbx,%rdi
+  803606:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  80360d:	00 00 00 
+  803610:	ff d0                	call   *%rax
+    cprintf("\n");
+  803612:	48 bf d4 38 80 00 00 	movabs $0x8038d4,%rdi
+  803619:	00 00 00 
+  80361c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803621:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803624:	cc                   	int3
+  803625:	eb fd                	jmp    803624 <_panic+0xa0>
+
+0000000000803627 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803627:	55                   	push   %rbp
+  803628:	48 89 e5             	mov    %rsp,%rbp
+  80362b:	41 55                	push   %r13
+  80362d:	41 54                	push   %r12
+  80362f:	53                   	push   %rbx
+  803630:	48 83 ec 08          	sub    $0x8,%rsp
+  803634:	49 89 fc             	mov    %rdi,%r12
+  803637:	48 89 f7             	mov    %rsi,%rdi
+  80363a:	48 89 d3             	mov    %rdx,%rbx
+  80363d:	49 89 cd             	mov    %rcx,%r13
+  803640:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803643:	48 85 f6             	test   %rsi,%rsi
+  803646:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80364d:	00 00 00 
+  803650:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803654:	be 00 10 00 00       	mov    $0x1000,%esi
+  803659:	48 85 db             	test   %rbx,%rbx
+  80365c:	74 03                	je     803661 <ipc_recv_timed+0x3a>
+  80365e:	48 8b 33             	mov    (%rbx),%rsi
+  803661:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80366d:	85 c0                	test   %eax,%eax
+  80366f:	78 75                	js     8036e6 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803671:	4d 85 e4             	test   %r12,%r12
+  803674:	74 14                	je     80368a <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803676:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80367d:	00 00 00 
+  803680:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803686:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80368a:	4d 85 ed             	test   %r13,%r13
+  80368d:	74 14                	je     8036a3 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80368f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803696:	00 00 00 
+  803699:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80369f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8036a3:	48 85 db             	test   %rbx,%rbx
+  8036a6:	74 23                	je     8036cb <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8036a8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8036af:	00 00 00 
+  8036b2:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8036b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036bd:	85 c9                	test   %ecx,%ecx
+  8036bf:	74 07                	je     8036c8 <ipc_recv_timed+0xa1>
+  8036c1:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8036c8:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8036cb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8036d2:	00 00 00 
+  8036d5:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8036db:	48 83 c4 08          	add    $0x8,%rsp
+  8036df:	5b                   	pop    %rbx
+  8036e0:	41 5c                	pop    %r12
+  8036e2:	41 5d                	pop    %r13
+  8036e4:	5d                   	pop    %rbp
+  8036e5:	c3                   	ret
+        if (from_env_store != NULL) {
+  8036e6:	4d 85 e4             	test   %r12,%r12
+  8036e9:	74 08                	je     8036f3 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8036eb:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8036f2:	00 
+        if (perm_store != NULL) {
+  8036f3:	4d 85 ed             	test   %r13,%r13
+  8036f6:	74 08                	je     803700 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8036f8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8036ff:	00 
+        if (size != NULL) {
+  803700:	48 85 db             	test   %rbx,%rbx
+  803703:	74 d6                	je     8036db <ipc_recv_timed+0xb4>
+            *size = 0;
+  803705:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80370c:	eb cd                	jmp    8036db <ipc_recv_timed+0xb4>
+
+000000000080370e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80370e:	55                   	push   %rbp
+  80370f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803712:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803718:	48 b8 27 36 80 00 00 	movabs $0x803627,%rax
+  80371f:	00 00 00 
+  803722:	ff d0                	call   *%rax
+}
+  803724:	5d                   	pop    %rbp
+  803725:	c3                   	ret
+
+0000000000803726 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803726:	55                   	push   %rbp
+  803727:	48 89 e5             	mov    %rsp,%rbp
+  80372a:	41 57                	push   %r15
+  80372c:	41 56                	push   %r14
+  80372e:	41 55                	push   %r13
+  803730:	41 54                	push   %r12
+  803732:	53                   	push   %rbx
+  803733:	48 83 ec 18          	sub    $0x18,%rsp
+  803737:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80373a:	48 89 d3             	mov    %rdx,%rbx
+  80373d:	49 89 cc             	mov    %rcx,%r12
+  803740:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803743:	48 85 d2             	test   %rdx,%rdx
+  803746:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80374d:	00 00 00 
+  803750:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803754:	89 f0                	mov    %esi,%eax
+  803756:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80375a:	48 89 da             	mov    %rbx,%rdx
+  80375d:	48 89 c6             	mov    %rax,%rsi
+  803760:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  803767:	00 00 00 
+  80376a:	ff d0                	call   *%rax
+    while (res < 0) {
+  80376c:	85 c0                	test   %eax,%eax
+  80376e:	79 65                	jns    8037d5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803770:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803773:	75 33                	jne    8037a8 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803775:	49 bf 85 11 80 00 00 	movabs $0x801185,%r15
+  80377c:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80377f:	49 be 82 14 80 00 00 	movabs $0x801482,%r14
+  803786:	00 00 00 
+        sys_yield();
+  803789:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80378c:	45 89 e8             	mov    %r13d,%r8d
+  80378f:	4c 89 e1             	mov    %r12,%rcx
+  803792:	48 89 da             	mov    %rbx,%rdx
+  803795:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803799:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80379c:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80379f:	85 c0                	test   %eax,%eax
+  8037a1:	79 32                	jns    8037d5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8037a3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8037a6:	74 e1                	je     803789 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8037a8:	89 c1                	mov    %eax,%ecx
+  8037aa:	48 ba a3 3f 80 00 00 	movabs $0x803fa3,%rdx
+  8037b1:	00 00 00 
+  8037b4:	be 52 00 00 00       	mov    $0x52,%esi
+  8037b9:	48 bf b7 3f 80 00 00 	movabs $0x803fb7,%rdi
+  8037c0:	00 00 00 
+  8037c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c8:	49 b8 84 35 80 00 00 	movabs $0x803584,%r8
+  8037cf:	00 00 00 
+  8037d2:	41 ff d0             	call   *%r8
+    }
+}
+  8037d5:	48 83 c4 18          	add    $0x18,%rsp
+  8037d9:	5b                   	pop    %rbx
+  8037da:	41 5c                	pop    %r12
+  8037dc:	41 5d                	pop    %r13
+  8037de:	41 5e                	pop    %r14
+  8037e0:	41 5f                	pop    %r15
+  8037e2:	5d                   	pop    %rbp
+  8037e3:	c3                   	ret
+
+00000000008037e4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8037e4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8037e9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8037f0:	00 00 00 
+  8037f3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8037f7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8037fb:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037ff:	48 01 ca             	add    %rcx,%rdx
+  803802:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803808:	39 fa                	cmp    %edi,%edx
+  80380a:	74 12                	je     80381e <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80380c:	48 83 c0 01          	add    $0x1,%rax
+  803810:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803816:	75 db                	jne    8037f3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803818:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80381d:	c3                   	ret
+            return envs[i].env_id;
+  80381e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803822:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803826:	48 c1 e2 04          	shl    $0x4,%rdx
+  80382a:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803831:	00 00 00 
+  803834:	48 01 d0             	add    %rdx,%rax
+  803837:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80383d:	c3                   	ret
+  80383e:	66 90                	xchg   %ax,%ax
+
+0000000000803840 <__rodata_start>:
+  803840:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  803844:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803848:	20 70 61             	and    %dh,0x61(%rax)
+  80384b:	72 65                	jb     8038b2 <__rodata_start+0x72>
+  80384d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80384e:	74 2e                	je     80387e <__rodata_start+0x3e>
+  803850:	20 20                	and    %ah,(%rax)
+  803852:	46 6f                	rex.RX outsl %ds:(%rsi),(%dx)
+  803854:	72 6b                	jb     8038c1 <__rodata_start+0x81>
+  803856:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  80385d:	20 63 68             	and    %ah,0x68(%rbx)
+  803860:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  803867:	00 
+  803868:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  80386c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803870:	20 70 61             	and    %dh,0x61(%rax)
+  803873:	72 65                	jb     8038da <__rodata_start+0x9a>
+  803875:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803876:	74 2e                	je     8038a6 <__rodata_start+0x66>
+  803878:	20 20                	and    %ah,(%rax)
+  80387a:	52                   	push   %rdx
+  80387b:	75 6e                	jne    8038eb <__rodata_start+0xab>
+  80387d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80387e:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  803885:	20 63 68             	and    %ah,0x68(%rbx)
+  803888:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  80388f:	00 
+  803890:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  803894:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803898:	20 70 61             	and    %dh,0x61(%rax)
+  80389b:	72 65                	jb     803902 <__rodata_start+0xc2>
+  80389d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80389e:	74 2e                	je     8038ce <__rodata_start+0x8e>
+  8038a0:	20 20                	and    %ah,(%rax)
+  8038a2:	4b 69 6c 6c 69 6e 67 	imul   $0x7420676e,0x69(%r12,%r13,2),%rbp
+  8038a9:	20 74 
+  8038ab:	68 65 20 63 68       	push   $0x68632065
+  8038b0:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  8038b7:	00 
+  8038b8:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  8038bc:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  8038c0:	20 63 68             	and    %ah,0x68(%rbx)
+  8038c3:	69 6c 64 2e 20 20 53 	imul   $0x70532020,0x2e(%rsp,%riz,2),%ebp
+  8038ca:	70 
+  8038cb:	69 6e 6e 69 6e 67 2e 	imul   $0x2e676e69,0x6e(%rsi),%ebp
+  8038d2:	2e 2e 0a 00          	cs cs or (%rax),%al
+  8038d6:	3c 75                	cmp    $0x75,%al
+  8038d8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8038dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038de:	3e 00 30             	ds add %dh,(%rax)
+  8038e1:	31 32                	xor    %esi,(%rdx)
+  8038e3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038ea:	41                   	rex.B
+  8038eb:	42                   	rex.X
+  8038ec:	43                   	rex.XB
+  8038ed:	44                   	rex.R
+  8038ee:	45                   	rex.RB
+  8038ef:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038f2:	31 32                	xor    %esi,(%rdx)
+  8038f4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038fb:	61                   	(bad)
+  8038fc:	62 63 64 65 66       	(bad)
+  803901:	00 28                	add    %ch,(%rax)
+  803903:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803904:	75 6c                	jne    803972 <__rodata_start+0x132>
+  803906:	6c                   	insb   (%dx),%es:(%rdi)
+  803907:	29 00                	sub    %eax,(%rax)
+  803909:	65 72 72             	gs jb  80397e <__rodata_start+0x13e>
+  80390c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390d:	72 20                	jb     80392f <__rodata_start+0xef>
+  80390f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803914:	73 70                	jae    803986 <__rodata_start+0x146>
+  803916:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80391a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803921:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803922:	72 00                	jb     803924 <__rodata_start+0xe4>
+  803924:	62 61 64 20 65       	(bad)
+  803929:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80392a:	76 69                	jbe    803995 <__rodata_start+0x155>
+  80392c:	72 6f                	jb     80399d <__rodata_start+0x15d>
+  80392e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80392f:	6d                   	insl   (%dx),%es:(%rdi)
+  803930:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803932:	74 00                	je     803934 <__rodata_start+0xf4>
+  803934:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80393b:	20 70 61             	and    %dh,0x61(%rax)
+  80393e:	72 61                	jb     8039a1 <__rodata_start+0x161>
+  803940:	6d                   	insl   (%dx),%es:(%rdi)
+  803941:	65 74 65             	gs je  8039a9 <__rodata_start+0x169>
+  803944:	72 00                	jb     803946 <__rodata_start+0x106>
+  803946:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803947:	75 74                	jne    8039bd <__rodata_start+0x17d>
+  803949:	20 6f 66             	and    %ch,0x66(%rdi)
+  80394c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80394f:	6d                   	insl   (%dx),%es:(%rdi)
+  803950:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803951:	72 79                	jb     8039cc <__rodata_start+0x18c>
+  803953:	00 6f 75             	add    %ch,0x75(%rdi)
+  803956:	74 20                	je     803978 <__rodata_start+0x138>
+  803958:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803959:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80395d:	76 69                	jbe    8039c8 <__rodata_start+0x188>
+  80395f:	72 6f                	jb     8039d0 <__rodata_start+0x190>
+  803961:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803962:	6d                   	insl   (%dx),%es:(%rdi)
+  803963:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803965:	74 73                	je     8039da <__rodata_start+0x19a>
+  803967:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80396a:	72 72                	jb     8039de <__rodata_start+0x19e>
+  80396c:	75 70                	jne    8039de <__rodata_start+0x19e>
+  80396e:	74 65                	je     8039d5 <__rodata_start+0x195>
+  803970:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803975:	75 67                	jne    8039de <__rodata_start+0x19e>
+  803977:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80397a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80397c:	00 73 65             	add    %dh,0x65(%rbx)
+  80397f:	67 6d                	insl   (%dx),%es:(%edi)
+  803981:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803983:	74 61                	je     8039e6 <__rodata_start+0x1a6>
+  803985:	74 69                	je     8039f0 <__rodata_start+0x1b0>
+  803987:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803988:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803989:	20 66 61             	and    %ah,0x61(%rsi)
+  80398c:	75 6c                	jne    8039fa <__rodata_start+0x1ba>
+  80398e:	74 00                	je     803990 <__rodata_start+0x150>
+  803990:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803997:	20 45 4c             	and    %al,0x4c(%rbp)
+  80399a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80399e:	61                   	(bad)
+  80399f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8039a4:	20 73 75             	and    %dh,0x75(%rbx)
+  8039a7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8039aa:	73 79                	jae    803a25 <__rodata_start+0x1e5>
+  8039ac:	73 74                	jae    803a22 <__rodata_start+0x1e2>
+  8039ae:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8039b0:	20 63 61             	and    %ah,0x61(%rbx)
+  8039b3:	6c                   	insb   (%dx),%es:(%rdi)
+  8039b4:	6c                   	insb   (%dx),%es:(%rdi)
+  8039b5:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8039b8:	74 72                	je     803a2c <__rodata_start+0x1ec>
+  8039ba:	79 20                	jns    8039dc <__rodata_start+0x19c>
+  8039bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039bd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039be:	74 20                	je     8039e0 <__rodata_start+0x1a0>
+  8039c0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039c2:	75 6e                	jne    803a32 <__rodata_start+0x1f2>
+  8039c4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8039c8:	76 20                	jbe    8039ea <__rodata_start+0x1aa>
+  8039ca:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8039d1:	72 65                	jb     803a38 <__rodata_start+0x1f8>
+  8039d3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8039d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039d7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8039db:	65 78 70             	gs js  803a4e <__rodata_start+0x20e>
+  8039de:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8039e3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8039e6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8039ea:	20 66 69             	and    %ah,0x69(%rsi)
+  8039ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ee:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039f2:	20 66 72             	and    %ah,0x72(%rsi)
+  8039f5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039fa:	61                   	(bad)
+  8039fb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039fe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a00:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803a04:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803a07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a09:	20 6d 61             	and    %ch,0x61(%rbp)
+  803a0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a0d:	79 20                	jns    803a2f <__rodata_start+0x1ef>
+  803a0f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803a16:	72 65                	jb     803a7d <__rodata_start+0x23d>
+  803a18:	20 6f 70             	and    %ch,0x70(%rdi)
+  803a1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a1d:	00 66 69             	add    %ah,0x69(%rsi)
+  803a20:	6c                   	insb   (%dx),%es:(%rdi)
+  803a21:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a25:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a29:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a2e:	74 20                	je     803a50 <__rodata_start+0x210>
+  803a30:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a32:	75 6e                	jne    803aa2 <__rodata_start+0x262>
+  803a34:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a38:	76 61                	jbe    803a9b <__rodata_start+0x25b>
+  803a3a:	6c                   	insb   (%dx),%es:(%rdi)
+  803a3b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a42:	00 
+  803a43:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a4a:	72 65                	jb     803ab1 <__rodata_start+0x271>
+  803a4c:	61                   	(bad)
+  803a4d:	64 79 20             	fs jns 803a70 <__rodata_start+0x230>
+  803a50:	65 78 69             	gs js  803abc <__rodata_start+0x27c>
+  803a53:	73 74                	jae    803ac9 <__rodata_start+0x289>
+  803a55:	73 00                	jae    803a57 <__rodata_start+0x217>
+  803a57:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a58:	70 65                	jo     803abf <__rodata_start+0x27f>
+  803a5a:	72 61                	jb     803abd <__rodata_start+0x27d>
+  803a5c:	74 69                	je     803ac7 <__rodata_start+0x287>
+  803a5e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a60:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a63:	74 20                	je     803a85 <__rodata_start+0x245>
+  803a65:	73 75                	jae    803adc <__rodata_start+0x29c>
+  803a67:	70 70                	jo     803ad9 <__rodata_start+0x299>
+  803a69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a6a:	72 74                	jb     803ae0 <__rodata_start+0x2a0>
+  803a6c:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a72:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a77:	74 00                	je     803a79 <__rodata_start+0x239>
+  803a79:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  803a80:	50                   	push   %rax
+  803a81:	04 80                	add    $0x80,%al
+  803a83:	00 00                	add    %al,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 81 0a 80 00 00    	add    %al,0x800a(%rcx)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 6f 04             	add    %ch,0x4(%rdi)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 63 04             	add    %ah,0x4(%rbx)
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 dd                	add    %bl,%ch
+  803ad9:	04 80                	add    $0x80,%al
+  803adb:	00 00                	add    %al,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 63 04             	add    %ah,0x4(%rbx)
+  803aea:	80 00 00             	addb   $0x0,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 b4 09 80 00 00 00 	add    %dh,0x80(%rcx,%rcx,1)
+  803c2e:	00 00                	add    %al,(%rax)
+  803c30:	91                   	xchg   %eax,%ecx
+  803c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c37:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 00                	add    %al,(%rax)
+  803c81:	05 80 00 00 00       	add    $0x80,%eax
+  803c86:	00 00                	add    %al,(%rax)
+  803c88:	cf                   	iret
+  803c89:	06                   	(bad)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 2f                	add    %ch,(%rdi)
+  803cb1:	05 80 00 00 00       	add    $0x80,%eax
+  803cb6:	00 00                	add    %al,(%rax)
+  803cb8:	91                   	xchg   %eax,%ecx
+  803cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cbf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 f5                	add    %dh,%ch
+  803cc9:	04 80                	add    $0x80,%al
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 77 08             	add    %dh,0x8(%rdi)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 41 09             	add    %al,0x9(%rcx)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 c6                	add    %al,%dh
+  803d01:	05 80 00 00 00       	add    $0x80,%eax
+  803d06:	00 00                	add    %al,(%rax)
+  803d08:	91                   	xchg   %eax,%ecx
+  803d09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d0f:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 91 0a 80 00 00    	add    %dl,0x800a(%rcx)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 b4 09 80 00 00 00 	add    %dh,0x80(%rcx,%rcx,1)
+  803d2e:	00 00                	add    %al,(%rax)
+  803d30:	91                   	xchg   %eax,%ecx
+  803d31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d37:	00 59 04             	add    %bl,0x4(%rcx)
+  803d3a:	80 00 00             	addb   $0x0,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d40 <error_string>:
+	...
+  803d48:	12 39 80 00 00 00 00 00 24 39 80 00 00 00 00 00     .9......$9......
+  803d58:	34 39 80 00 00 00 00 00 46 39 80 00 00 00 00 00     49......F9......
+  803d68:	54 39 80 00 00 00 00 00 68 39 80 00 00 00 00 00     T9......h9......
+  803d78:	7d 39 80 00 00 00 00 00 90 39 80 00 00 00 00 00     }9.......9......
+  803d88:	a2 39 80 00 00 00 00 00 b6 39 80 00 00 00 00 00     .9.......9......
+  803d98:	c6 39 80 00 00 00 00 00 d9 39 80 00 00 00 00 00     .9.......9......
+  803da8:	f0 39 80 00 00 00 00 00 06 3a 80 00 00 00 00 00     .9.......:......
+  803db8:	1e 3a 80 00 00 00 00 00 36 3a 80 00 00 00 00 00     .:......6:......
+  803dc8:	43 3a 80 00 00 00 00 00 e8 3d 80 00 00 00 00 00     C:.......=......
+  803dd8:	57 3a 80 00 00 00 00 00 6f 3a 80 00 00 00 00 00     W:......o:......
+  803de8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803df8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803e08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803e18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803e28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803e38:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803e48:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803e58:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803e68:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803e78:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803e88:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803e98:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803ea8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803eb8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803ec8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803ed8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803ee8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803ef8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803f00 <devtab>:
+  803f00:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803f10:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803f20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803f30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803f40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803f50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803f60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803f70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803f90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803fa0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803fb0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
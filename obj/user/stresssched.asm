@@ -0,0 +1,7075 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 34 01 00 00       	call   800157 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc f9 16 80 00 00 	movabs $0x8016f9,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 a5 00 00 00       	jmp    800115 <umain+0xf0>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	44 89 ea             	mov    %r13d,%edx
+  800078:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007e:	44 89 e8             	mov    %r13d,%eax
+  800081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800086:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  80008a:	48 8d 0c 48          	lea    (%rax,%rcx,2),%rcx
+  80008e:	48 c1 e1 04          	shl    $0x4,%rcx
+  800092:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800099:	00 00 00 
+  80009c:	48 01 c8             	add    %rcx,%rax
+  80009f:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	74 28                	je     8000d1 <umain+0xac>
+  8000a9:	48 63 c2             	movslq %edx,%rax
+  8000ac:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000b0:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000b4:	48 c1 e0 04          	shl    $0x4,%rax
+  8000b8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bf:	00 00 00 
+  8000c2:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000c5:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000c7:	8b 82 d4 00 00 00    	mov    0xd4(%rdx),%eax
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	75 f4                	jne    8000c5 <umain+0xa0>
+    for (i = 0; i < 20; i++)
+  8000d1:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000d7:	49 bd 9a 12 80 00 00 	movabs $0x80129a,%r13
+  8000de:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000e1:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  8000e8:	00 00 00 
+        sys_yield();
+  8000eb:	41 ff d5             	call   *%r13
+  8000ee:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000f3:	8b 03                	mov    (%rbx),%eax
+  8000f5:	83 c0 01             	add    $0x1,%eax
+  8000f8:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000fa:	83 ea 01             	sub    $0x1,%edx
+  8000fd:	75 f4                	jne    8000f3 <umain+0xce>
+    for (i = 0; i < 10; i++) {
+  8000ff:	41 83 ec 01          	sub    $0x1,%r12d
+  800103:	75 e6                	jne    8000eb <umain+0xc6>
+    }
+
+    if (counter != 10 * 10000)
+  800105:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  80010c:	00 00 
+  80010e:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  800113:	75 0b                	jne    800120 <umain+0xfb>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    //cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  800115:	48 83 c4 08          	add    $0x8,%rsp
+  800119:	5b                   	pop    %rbx
+  80011a:	41 5c                	pop    %r12
+  80011c:	41 5d                	pop    %r13
+  80011e:	5d                   	pop    %rbp
+  80011f:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  800120:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800127:	00 00 00 
+  80012a:	8b 08                	mov    (%rax),%ecx
+  80012c:	48 ba b0 38 80 00 00 	movabs $0x8038b0,%rdx
+  800133:	00 00 00 
+  800136:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80013b:	48 bf d8 38 80 00 00 	movabs $0x8038d8,%rdi
+  800142:	00 00 00 
+  800145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014a:	49 b8 28 02 80 00 00 	movabs $0x800228,%r8
+  800151:	00 00 00 
+  800154:	41 ff d0             	call   *%r8
+
+0000000000800157 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800157:	55                   	push   %rbp
+  800158:	48 89 e5             	mov    %rsp,%rbp
+  80015b:	41 56                	push   %r14
+  80015d:	41 55                	push   %r13
+  80015f:	41 54                	push   %r12
+  800161:	53                   	push   %rbx
+  800162:	41 89 fd             	mov    %edi,%r13d
+  800165:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800168:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  80016f:	00 00 00 
+  800172:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  800179:	00 00 00 
+  80017c:	48 39 c2             	cmp    %rax,%rdx
+  80017f:	73 17                	jae    800198 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800181:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800184:	49 89 c4             	mov    %rax,%r12
+  800187:	48 83 c3 08          	add    $0x8,%rbx
+  80018b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800190:	ff 53 f8             	call   *-0x8(%rbx)
+  800193:	4c 39 e3             	cmp    %r12,%rbx
+  800196:	72 ef                	jb     800187 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800198:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001ad:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001b1:	48 c1 e0 04          	shl    $0x4,%rax
+  8001b5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001bc:	00 00 00 
+  8001bf:	48 01 d0             	add    %rdx,%rax
+  8001c2:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8001c9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001cc:	45 85 ed             	test   %r13d,%r13d
+  8001cf:	7e 0d                	jle    8001de <libmain+0x87>
+  8001d1:	49 8b 06             	mov    (%r14),%rax
+  8001d4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001db:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001de:	4c 89 f6             	mov    %r14,%rsi
+  8001e1:	44 89 ef             	mov    %r13d,%edi
+  8001e4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001eb:	00 00 00 
+  8001ee:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f0:	48 b8 05 02 80 00 00 	movabs $0x800205,%rax
+  8001f7:	00 00 00 
+  8001fa:	ff d0                	call   *%rax
+#endif
+}
+  8001fc:	5b                   	pop    %rbx
+  8001fd:	41 5c                	pop    %r12
+  8001ff:	41 5d                	pop    %r13
+  800201:	41 5e                	pop    %r14
+  800203:	5d                   	pop    %rbp
+  800204:	c3                   	ret
+
+0000000000800205 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800205:	55                   	push   %rbp
+  800206:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800209:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021a:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+}
+  800226:	5d                   	pop    %rbp
+  800227:	c3                   	ret
+
+0000000000800228 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800228:	55                   	push   %rbp
+  800229:	48 89 e5             	mov    %rsp,%rbp
+  80022c:	41 56                	push   %r14
+  80022e:	41 55                	push   %r13
+  800230:	41 54                	push   %r12
+  800232:	53                   	push   %rbx
+  800233:	48 83 ec 50          	sub    $0x50,%rsp
+  800237:	49 89 fc             	mov    %rdi,%r12
+  80023a:	41 89 f5             	mov    %esi,%r13d
+  80023d:	48 89 d3             	mov    %rdx,%rbx
+  800240:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800244:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800248:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80024c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800253:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800257:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80025b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80025f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800263:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80026a:	00 00 00 
+  80026d:	4c 8b 30             	mov    (%rax),%r14
+  800270:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  800277:	00 00 00 
+  80027a:	ff d0                	call   *%rax
+  80027c:	89 c6                	mov    %eax,%esi
+  80027e:	45 89 e8             	mov    %r13d,%r8d
+  800281:	4c 89 e1             	mov    %r12,%rcx
+  800284:	4c 89 f2             	mov    %r14,%rdx
+  800287:	48 bf f8 38 80 00 00 	movabs $0x8038f8,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 bc 78 03 80 00 00 	movabs $0x800378,%r12
+  80029d:	00 00 00 
+  8002a0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002a3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a7:	48 89 df             	mov    %rbx,%rdi
+  8002aa:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b6:	48 bf 1b 3f 80 00 00 	movabs $0x803f1b,%rdi
+  8002bd:	00 00 00 
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c8:	cc                   	int3
+  8002c9:	eb fd                	jmp    8002c8 <_panic+0xa0>
+
+00000000008002cb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002cb:	55                   	push   %rbp
+  8002cc:	48 89 e5             	mov    %rsp,%rbp
+  8002cf:	53                   	push   %rbx
+  8002d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d7:	8b 06                	mov    (%rsi),%eax
+  8002d9:	8d 50 01             	lea    0x1(%rax),%edx
+  8002dc:	89 16                	mov    %edx,(%rsi)
+  8002de:	48 98                	cltq
+  8002e0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002eb:	74 0a                	je     8002f7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002ed:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f5:	c9                   	leave
+  8002f6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002fb:	be ff 00 00 00       	mov    $0xff,%esi
+  800300:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  800307:	00 00 00 
+  80030a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80030c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800312:	eb d9                	jmp    8002ed <putch+0x22>
+
+0000000000800314 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800314:	55                   	push   %rbp
+  800315:	48 89 e5             	mov    %rsp,%rbp
+  800318:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80031f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800322:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800329:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800336:	48 89 f1             	mov    %rsi,%rcx
+  800339:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800340:	48 bf cb 02 80 00 00 	movabs $0x8002cb,%rdi
+  800347:	00 00 00 
+  80034a:	48 b8 c8 04 80 00 00 	movabs $0x8004c8,%rax
+  800351:	00 00 00 
+  800354:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800356:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80035d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800364:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800370:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800376:	c9                   	leave
+  800377:	c3                   	ret
+
+0000000000800378 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800378:	55                   	push   %rbp
+  800379:	48 89 e5             	mov    %rsp,%rbp
+  80037c:	48 83 ec 50          	sub    $0x50,%rsp
+  800380:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800384:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800388:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800390:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800394:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80039b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003ab:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003af:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  8003b6:	00 00 00 
+  8003b9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003bb:	c9                   	leave
+  8003bc:	c3                   	ret
+
+00000000008003bd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003bd:	55                   	push   %rbp
+  8003be:	48 89 e5             	mov    %rsp,%rbp
+  8003c1:	41 57                	push   %r15
+  8003c3:	41 56                	push   %r14
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ce:	49 89 fc             	mov    %rdi,%r12
+  8003d1:	49 89 f5             	mov    %rsi,%r13
+  8003d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003db:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003de:	41 89 cf             	mov    %ecx,%r15d
+  8003e1:	4c 39 fa             	cmp    %r15,%rdx
+  8003e4:	73 5b                	jae    800441 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003ea:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ee:	85 db                	test   %ebx,%ebx
+  8003f0:	7e 0e                	jle    800400 <print_num+0x43>
+            putch(padc, put_arg);
+  8003f2:	4c 89 ee             	mov    %r13,%rsi
+  8003f5:	44 89 f7             	mov    %r14d,%edi
+  8003f8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003fb:	83 eb 01             	sub    $0x1,%ebx
+  8003fe:	75 f2                	jne    8003f2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800400:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800404:	48 b9 2c 39 80 00 00 	movabs $0x80392c,%rcx
+  80040b:	00 00 00 
+  80040e:	48 b8 1b 39 80 00 00 	movabs $0x80391b,%rax
+  800415:	00 00 00 
+  800418:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80041c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800420:	ba 00 00 00 00       	mov    $0x0,%edx
+  800425:	49 f7 f7             	div    %r15
+  800428:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80042c:	4c 89 ee             	mov    %r13,%rsi
+  80042f:	41 ff d4             	call   *%r12
+}
+  800432:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800436:	5b                   	pop    %rbx
+  800437:	41 5c                	pop    %r12
+  800439:	41 5d                	pop    %r13
+  80043b:	41 5e                	pop    %r14
+  80043d:	41 5f                	pop    %r15
+  80043f:	5d                   	pop    %rbp
+  800440:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800441:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044a:	49 f7 f7             	div    %r15
+  80044d:	48 83 ec 08          	sub    $0x8,%rsp
+  800451:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800455:	52                   	push   %rdx
+  800456:	45 0f be c9          	movsbl %r9b,%r9d
+  80045a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045e:	48 89 c2             	mov    %rax,%rdx
+  800461:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  800468:	00 00 00 
+  80046b:	ff d0                	call   *%rax
+  80046d:	48 83 c4 10          	add    $0x10,%rsp
+  800471:	eb 8d                	jmp    800400 <print_num+0x43>
+
+0000000000800473 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800473:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800477:	48 8b 06             	mov    (%rsi),%rax
+  80047a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047e:	73 0a                	jae    80048a <sprintputch+0x17>
+        *state->start++ = ch;
+  800480:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800484:	48 89 16             	mov    %rdx,(%rsi)
+  800487:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80048a:	c3                   	ret
+
+000000000080048b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80048b:	55                   	push   %rbp
+  80048c:	48 89 e5             	mov    %rsp,%rbp
+  80048f:	48 83 ec 50          	sub    $0x50,%rsp
+  800493:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800497:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80049b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80049f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ae:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004ba:	48 b8 c8 04 80 00 00 	movabs $0x8004c8,%rax
+  8004c1:	00 00 00 
+  8004c4:	ff d0                	call   *%rax
+}
+  8004c6:	c9                   	leave
+  8004c7:	c3                   	ret
+
+00000000008004c8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	41 57                	push   %r15
+  8004ce:	41 56                	push   %r14
+  8004d0:	41 55                	push   %r13
+  8004d2:	41 54                	push   %r12
+  8004d4:	53                   	push   %rbx
+  8004d5:	48 83 ec 38          	sub    $0x38,%rsp
+  8004d9:	49 89 fe             	mov    %rdi,%r14
+  8004dc:	49 89 f5             	mov    %rsi,%r13
+  8004df:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004e2:	48 8b 01             	mov    (%rcx),%rax
+  8004e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004e9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004f9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004fd:	0f b6 3b             	movzbl (%rbx),%edi
+  800500:	40 80 ff 25          	cmp    $0x25,%dil
+  800504:	74 18                	je     80051e <vprintfmt+0x56>
+            if (!ch) return;
+  800506:	40 84 ff             	test   %dil,%dil
+  800509:	0f 84 b1 06 00 00    	je     800bc0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80050f:	40 0f b6 ff          	movzbl %dil,%edi
+  800513:	4c 89 ee             	mov    %r13,%rsi
+  800516:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800519:	4c 89 e3             	mov    %r12,%rbx
+  80051c:	eb db                	jmp    8004f9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051e:	be 00 00 00 00       	mov    $0x0,%esi
+  800523:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800527:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80052c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800532:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800539:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800542:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800547:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80054a:	83 e8 23             	sub    $0x23,%eax
+  80054d:	3c 57                	cmp    $0x57,%al
+  80054f:	0f 87 51 06 00 00    	ja     800ba6 <vprintfmt+0x6de>
+  800555:	0f b6 c0             	movzbl %al,%eax
+  800558:	48 b9 c0 3a 80 00 00 	movabs $0x803ac0,%rcx
+  80055f:	00 00 00 
+  800562:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800565:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800568:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80056c:	eb cf                	jmp    80053d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056e:	49 89 dc             	mov    %rbx,%r12
+  800571:	be 01 00 00 00       	mov    $0x1,%esi
+  800576:	eb c5                	jmp    80053d <vprintfmt+0x75>
+            padc = ch;
+  800578:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80057c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80057f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800582:	eb b9                	jmp    80053d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800584:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800587:	83 f8 2f             	cmp    $0x2f,%eax
+  80058a:	77 24                	ja     8005b0 <vprintfmt+0xe8>
+  80058c:	89 c1                	mov    %eax,%ecx
+  80058e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800592:	83 c0 08             	add    $0x8,%eax
+  800595:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800598:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80059b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a2:	79 99                	jns    80053d <vprintfmt+0x75>
+                width = precision;
+  8005a4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005ae:	eb 8d                	jmp    80053d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	eb da                	jmp    800598 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005be:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005c3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005cd:	3c 39                	cmp    $0x39,%al
+  8005cf:	77 1c                	ja     8005ed <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005d1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005d9:	0f b6 c0             	movzbl %al,%eax
+  8005dc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005e1:	0f b6 03             	movzbl (%rbx),%eax
+  8005e4:	3c 39                	cmp    $0x39,%al
+  8005e6:	76 e9                	jbe    8005d1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005eb:	eb b1                	jmp    80059e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005ed:	49 89 dc             	mov    %rbx,%r12
+  8005f0:	eb ac                	jmp    80059e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005f2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f5:	85 c9                	test   %ecx,%ecx
+  8005f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fc:	0f 49 c1             	cmovns %ecx,%eax
+  8005ff:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800602:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800605:	e9 33 ff ff ff       	jmp    80053d <vprintfmt+0x75>
+            lflag++;
+  80060a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80060d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800610:	e9 28 ff ff ff       	jmp    80053d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800615:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800618:	83 f8 2f             	cmp    $0x2f,%eax
+  80061b:	77 19                	ja     800636 <vprintfmt+0x16e>
+  80061d:	89 c2                	mov    %eax,%edx
+  80061f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800623:	83 c0 08             	add    $0x8,%eax
+  800626:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800629:	8b 3a                	mov    (%rdx),%edi
+  80062b:	4c 89 ee             	mov    %r13,%rsi
+  80062e:	41 ff d6             	call   *%r14
+            break;
+  800631:	e9 c3 fe ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800636:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800642:	eb e5                	jmp    800629 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800644:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800647:	83 f8 2f             	cmp    $0x2f,%eax
+  80064a:	77 5a                	ja     8006a6 <vprintfmt+0x1de>
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800652:	83 c0 08             	add    $0x8,%eax
+  800655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800658:	8b 02                	mov    (%rdx),%eax
+  80065a:	89 c1                	mov    %eax,%ecx
+  80065c:	f7 d9                	neg    %ecx
+  80065e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800661:	83 f9 14             	cmp    $0x14,%ecx
+  800664:	7f 4e                	jg     8006b4 <vprintfmt+0x1ec>
+  800666:	48 63 c1             	movslq %ecx,%rax
+  800669:	48 ba 80 3d 80 00 00 	movabs $0x803d80,%rdx
+  800670:	00 00 00 
+  800673:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800677:	48 85 c0             	test   %rax,%rax
+  80067a:	74 38                	je     8006b4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80067c:	48 89 c1             	mov    %rax,%rcx
+  80067f:	48 ba 79 3f 80 00 00 	movabs $0x803f79,%rdx
+  800686:	00 00 00 
+  800689:	4c 89 ee             	mov    %r13,%rsi
+  80068c:	4c 89 f7             	mov    %r14,%rdi
+  80068f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800694:	49 b8 8b 04 80 00 00 	movabs $0x80048b,%r8
+  80069b:	00 00 00 
+  80069e:	41 ff d0             	call   *%r8
+  8006a1:	e9 53 fe ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b2:	eb a4                	jmp    800658 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b4:	48 ba 44 39 80 00 00 	movabs $0x803944,%rdx
+  8006bb:	00 00 00 
+  8006be:	4c 89 ee             	mov    %r13,%rsi
+  8006c1:	4c 89 f7             	mov    %r14,%rdi
+  8006c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c9:	49 b8 8b 04 80 00 00 	movabs $0x80048b,%r8
+  8006d0:	00 00 00 
+  8006d3:	41 ff d0             	call   *%r8
+  8006d6:	e9 1e fe ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006de:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e1:	77 6c                	ja     80074f <vprintfmt+0x287>
+  8006e3:	89 c2                	mov    %eax,%edx
+  8006e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e9:	83 c0 08             	add    $0x8,%eax
+  8006ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ef:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006f2:	48 85 d2             	test   %rdx,%rdx
+  8006f5:	48 b8 3d 39 80 00 00 	movabs $0x80393d,%rax
+  8006fc:	00 00 00 
+  8006ff:	48 0f 45 c2          	cmovne %rdx,%rax
+  800703:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800707:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80070b:	7e 06                	jle    800713 <vprintfmt+0x24b>
+  80070d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800711:	75 4a                	jne    80075d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800713:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800717:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80071b:	0f b6 00             	movzbl (%rax),%eax
+  80071e:	84 c0                	test   %al,%al
+  800720:	0f 85 9a 00 00 00    	jne    8007c0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800726:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800729:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80072d:	85 c0                	test   %eax,%eax
+  80072f:	0f 8e c4 fd ff ff    	jle    8004f9 <vprintfmt+0x31>
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	bf 20 00 00 00       	mov    $0x20,%edi
+  80073d:	41 ff d6             	call   *%r14
+  800740:	41 83 ec 01          	sub    $0x1,%r12d
+  800744:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800748:	75 eb                	jne    800735 <vprintfmt+0x26d>
+  80074a:	e9 aa fd ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80074f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800753:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb 92                	jmp    8006ef <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80075d:	49 63 f7             	movslq %r15d,%rsi
+  800760:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800764:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  80076b:	00 00 00 
+  80076e:	ff d0                	call   *%rax
+  800770:	48 89 c2             	mov    %rax,%rdx
+  800773:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800776:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800778:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80077b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80077e:	85 c0                	test   %eax,%eax
+  800780:	7e 91                	jle    800713 <vprintfmt+0x24b>
+  800782:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800787:	4c 89 ee             	mov    %r13,%rsi
+  80078a:	44 89 e7             	mov    %r12d,%edi
+  80078d:	41 ff d6             	call   *%r14
+  800790:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800794:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800797:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80079a:	75 eb                	jne    800787 <vprintfmt+0x2bf>
+  80079c:	e9 72 ff ff ff       	jmp    800713 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a1:	0f b6 f8             	movzbl %al,%edi
+  8007a4:	4c 89 ee             	mov    %r13,%rsi
+  8007a7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007aa:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ae:	49 83 c4 01          	add    $0x1,%r12
+  8007b2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b8:	84 c0                	test   %al,%al
+  8007ba:	0f 84 66 ff ff ff    	je     800726 <vprintfmt+0x25e>
+  8007c0:	45 85 ff             	test   %r15d,%r15d
+  8007c3:	78 0a                	js     8007cf <vprintfmt+0x307>
+  8007c5:	41 83 ef 01          	sub    $0x1,%r15d
+  8007c9:	0f 88 57 ff ff ff    	js     800726 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007cf:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d3:	74 cc                	je     8007a1 <vprintfmt+0x2d9>
+  8007d5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007dd:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e0:	77 c2                	ja     8007a4 <vprintfmt+0x2dc>
+  8007e2:	eb bd                	jmp    8007a1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e4:	40 84 f6             	test   %sil,%sil
+  8007e7:	75 26                	jne    80080f <vprintfmt+0x347>
+    switch (lflag) {
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	74 59                	je     800846 <vprintfmt+0x37e>
+  8007ed:	83 fa 01             	cmp    $0x1,%edx
+  8007f0:	74 7b                	je     80086d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	0f 87 96 00 00 00    	ja     800894 <vprintfmt+0x3cc>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	4c 8b 22             	mov    (%rdx),%r12
+  80080d:	eb 17                	jmp    800826 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80080f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800812:	83 f8 2f             	cmp    $0x2f,%eax
+  800815:	77 21                	ja     800838 <vprintfmt+0x370>
+  800817:	89 c2                	mov    %eax,%edx
+  800819:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081d:	83 c0 08             	add    $0x8,%eax
+  800820:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800823:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800826:	4d 85 e4             	test   %r12,%r12
+  800829:	78 7a                	js     8008a5 <vprintfmt+0x3dd>
+            num = i;
+  80082b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80082e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800833:	e9 50 02 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800844:	eb dd                	jmp    800823 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 11                	ja     80085f <vprintfmt+0x397>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085a:	4c 63 22             	movslq (%rdx),%r12
+  80085d:	eb c7                	jmp    800826 <vprintfmt+0x35e>
+  80085f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800863:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800867:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086b:	eb ed                	jmp    80085a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80086d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800870:	83 f8 2f             	cmp    $0x2f,%eax
+  800873:	77 11                	ja     800886 <vprintfmt+0x3be>
+  800875:	89 c2                	mov    %eax,%edx
+  800877:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087b:	83 c0 08             	add    $0x8,%eax
+  80087e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800881:	4c 8b 22             	mov    (%rdx),%r12
+  800884:	eb a0                	jmp    800826 <vprintfmt+0x35e>
+  800886:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800892:	eb ed                	jmp    800881 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a0:	e9 65 ff ff ff       	jmp    80080a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008a5:	4c 89 ee             	mov    %r13,%rsi
+  8008a8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ad:	41 ff d6             	call   *%r14
+                i = -i;
+  8008b0:	49 f7 dc             	neg    %r12
+  8008b3:	e9 73 ff ff ff       	jmp    80082b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b8:	40 84 f6             	test   %sil,%sil
+  8008bb:	75 32                	jne    8008ef <vprintfmt+0x427>
+    switch (lflag) {
+  8008bd:	85 d2                	test   %edx,%edx
+  8008bf:	74 5d                	je     80091e <vprintfmt+0x456>
+  8008c1:	83 fa 01             	cmp    $0x1,%edx
+  8008c4:	0f 84 82 00 00 00    	je     80094c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d0:	0f 87 a5 00 00 00    	ja     80097b <vprintfmt+0x4b3>
+  8008d6:	89 c2                	mov    %eax,%edx
+  8008d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dc:	83 c0 08             	add    $0x8,%eax
+  8008df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ea:	e9 99 01 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f5:	77 19                	ja     800910 <vprintfmt+0x448>
+  8008f7:	89 c2                	mov    %eax,%edx
+  8008f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fd:	83 c0 08             	add    $0x8,%eax
+  800900:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800903:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090b:	e9 78 01 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+  800910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800914:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	eb e5                	jmp    800903 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80091e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800921:	83 f8 2f             	cmp    $0x2f,%eax
+  800924:	77 18                	ja     80093e <vprintfmt+0x476>
+  800926:	89 c2                	mov    %eax,%edx
+  800928:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092c:	83 c0 08             	add    $0x8,%eax
+  80092f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800932:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800939:	e9 4a 01 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+  80093e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800942:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800946:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094a:	eb e6                	jmp    800932 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80094c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094f:	83 f8 2f             	cmp    $0x2f,%eax
+  800952:	77 19                	ja     80096d <vprintfmt+0x4a5>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800963:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800968:	e9 1b 01 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb e5                	jmp    800960 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80097b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800987:	e9 56 ff ff ff       	jmp    8008e2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80098c:	40 84 f6             	test   %sil,%sil
+  80098f:	75 2e                	jne    8009bf <vprintfmt+0x4f7>
+    switch (lflag) {
+  800991:	85 d2                	test   %edx,%edx
+  800993:	74 59                	je     8009ee <vprintfmt+0x526>
+  800995:	83 fa 01             	cmp    $0x1,%edx
+  800998:	74 7f                	je     800a19 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80099a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099d:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a0:	0f 87 9f 00 00 00    	ja     800a45 <vprintfmt+0x57d>
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ac:	83 c0 08             	add    $0x8,%eax
+  8009af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ba:	e9 c9 00 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 19                	ja     8009e0 <vprintfmt+0x518>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009db:	e9 a8 00 00 00       	jmp    800a88 <vprintfmt+0x5c0>
+  8009e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ec:	eb e5                	jmp    8009d3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 15                	ja     800a0b <vprintfmt+0x543>
+  8009f6:	89 c2                	mov    %eax,%edx
+  8009f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fc:	83 c0 08             	add    $0x8,%eax
+  8009ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a02:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a04:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a09:	eb 7d                	jmp    800a88 <vprintfmt+0x5c0>
+  800a0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a17:	eb e9                	jmp    800a02 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1f:	77 16                	ja     800a37 <vprintfmt+0x56f>
+  800a21:	89 c2                	mov    %eax,%edx
+  800a23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a27:	83 c0 08             	add    $0x8,%eax
+  800a2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a30:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a35:	eb 51                	jmp    800a88 <vprintfmt+0x5c0>
+  800a37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a43:	eb e8                	jmp    800a2d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	e9 5c ff ff ff       	jmp    8009b2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a56:	4c 89 ee             	mov    %r13,%rsi
+  800a59:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a5e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a61:	4c 89 ee             	mov    %r13,%rsi
+  800a64:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a69:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a72:	77 47                	ja     800abb <vprintfmt+0x5f3>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7a:	83 c0 08             	add    $0x8,%eax
+  800a7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a83:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a88:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a90:	0f 94 c0             	sete   %al
+  800a93:	0f b6 c0             	movzbl %al,%eax
+  800a96:	50                   	push   %rax
+  800a97:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a9c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa0:	4c 89 ee             	mov    %r13,%rsi
+  800aa3:	4c 89 f7             	mov    %r14,%rdi
+  800aa6:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  800aad:	00 00 00 
+  800ab0:	ff d0                	call   *%rax
+            break;
+  800ab2:	48 83 c4 10          	add    $0x10,%rsp
+  800ab6:	e9 3e fa ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800abb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac7:	eb b7                	jmp    800a80 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac9:	40 84 f6             	test   %sil,%sil
+  800acc:	75 2b                	jne    800af9 <vprintfmt+0x631>
+    switch (lflag) {
+  800ace:	85 d2                	test   %edx,%edx
+  800ad0:	74 56                	je     800b28 <vprintfmt+0x660>
+  800ad2:	83 fa 01             	cmp    $0x1,%edx
+  800ad5:	74 7f                	je     800b56 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ada:	83 f8 2f             	cmp    $0x2f,%eax
+  800add:	0f 87 a2 00 00 00    	ja     800b85 <vprintfmt+0x6bd>
+  800ae3:	89 c2                	mov    %eax,%edx
+  800ae5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae9:	83 c0 08             	add    $0x8,%eax
+  800aec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af7:	eb 8f                	jmp    800a88 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afc:	83 f8 2f             	cmp    $0x2f,%eax
+  800aff:	77 19                	ja     800b1a <vprintfmt+0x652>
+  800b01:	89 c2                	mov    %eax,%edx
+  800b03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b07:	83 c0 08             	add    $0x8,%eax
+  800b0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b10:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b15:	e9 6e ff ff ff       	jmp    800a88 <vprintfmt+0x5c0>
+  800b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b26:	eb e5                	jmp    800b0d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2e:	77 18                	ja     800b48 <vprintfmt+0x680>
+  800b30:	89 c2                	mov    %eax,%edx
+  800b32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b36:	83 c0 08             	add    $0x8,%eax
+  800b39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b43:	e9 40 ff ff ff       	jmp    800a88 <vprintfmt+0x5c0>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb e6                	jmp    800b3c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b59:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5c:	77 19                	ja     800b77 <vprintfmt+0x6af>
+  800b5e:	89 c2                	mov    %eax,%edx
+  800b60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b64:	83 c0 08             	add    $0x8,%eax
+  800b67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b72:	e9 11 ff ff ff       	jmp    800a88 <vprintfmt+0x5c0>
+  800b77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b83:	eb e5                	jmp    800b6a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b91:	e9 59 ff ff ff       	jmp    800aef <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b96:	4c 89 ee             	mov    %r13,%rsi
+  800b99:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b9e:	41 ff d6             	call   *%r14
+            break;
+  800ba1:	e9 53 f9 ff ff       	jmp    8004f9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba6:	4c 89 ee             	mov    %r13,%rsi
+  800ba9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bae:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb1:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bb9:	75 f6                	jne    800bb1 <vprintfmt+0x6e9>
+  800bbb:	e9 39 f9 ff ff       	jmp    8004f9 <vprintfmt+0x31>
+}
+  800bc0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc4:	5b                   	pop    %rbx
+  800bc5:	41 5c                	pop    %r12
+  800bc7:	41 5d                	pop    %r13
+  800bc9:	41 5e                	pop    %r14
+  800bcb:	41 5f                	pop    %r15
+  800bcd:	5d                   	pop    %rbp
+  800bce:	c3                   	ret
+
+0000000000800bcf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bcf:	55                   	push   %rbp
+  800bd0:	48 89 e5             	mov    %rsp,%rbp
+  800bd3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800beb:	48 85 ff             	test   %rdi,%rdi
+  800bee:	74 2b                	je     800c1b <vsnprintf+0x4c>
+  800bf0:	48 85 f6             	test   %rsi,%rsi
+  800bf3:	74 26                	je     800c1b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bf9:	48 bf 73 04 80 00 00 	movabs $0x800473,%rdi
+  800c00:	00 00 00 
+  800c03:	48 b8 c8 04 80 00 00 	movabs $0x8004c8,%rax
+  800c0a:	00 00 00 
+  800c0d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c13:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c16:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c20:	eb f7                	jmp    800c19 <vsnprintf+0x4a>
+
+0000000000800c22 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c22:	55                   	push   %rbp
+  800c23:	48 89 e5             	mov    %rsp,%rbp
+  800c26:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c32:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c36:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c45:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c49:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c4d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c51:	48 b8 cf 0b 80 00 00 	movabs $0x800bcf,%rax
+  800c58:	00 00 00 
+  800c5b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c5d:	c9                   	leave
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c5f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c62:	74 10                	je     800c74 <strlen+0x15>
+    size_t n = 0;
+  800c64:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c69:	48 83 c0 01          	add    $0x1,%rax
+  800c6d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c71:	75 f6                	jne    800c69 <strlen+0xa>
+  800c73:	c3                   	ret
+    size_t n = 0;
+  800c74:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c79:	c3                   	ret
+
+0000000000800c7a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c7a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c82:	48 85 f6             	test   %rsi,%rsi
+  800c85:	74 11                	je     800c98 <strnlen+0x1e>
+  800c87:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c8b:	74 0c                	je     800c99 <strnlen+0x1f>
+  800c8d:	48 83 c2 01          	add    $0x1,%rdx
+  800c91:	48 39 d0             	cmp    %rdx,%rax
+  800c94:	75 f1                	jne    800c87 <strnlen+0xd>
+  800c96:	eb 04                	jmp    800c9c <strnlen+0x22>
+  800c98:	c3                   	ret
+  800c99:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c9c:	c3                   	ret
+
+0000000000800c9d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c9d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ca9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cac:	48 83 c2 01          	add    $0x1,%rdx
+  800cb0:	84 c9                	test   %cl,%cl
+  800cb2:	75 f1                	jne    800ca5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb5:	55                   	push   %rbp
+  800cb6:	48 89 e5             	mov    %rsp,%rbp
+  800cb9:	41 54                	push   %r12
+  800cbb:	53                   	push   %rbx
+  800cbc:	48 89 fb             	mov    %rdi,%rbx
+  800cbf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc2:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  800cc9:	00 00 00 
+  800ccc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cce:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd2:	4c 89 e6             	mov    %r12,%rsi
+  800cd5:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  800cdc:	00 00 00 
+  800cdf:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce1:	48 89 d8             	mov    %rbx,%rax
+  800ce4:	5b                   	pop    %rbx
+  800ce5:	41 5c                	pop    %r12
+  800ce7:	5d                   	pop    %rbp
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ce9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cec:	48 85 d2             	test   %rdx,%rdx
+  800cef:	74 1f                	je     800d10 <strncpy+0x27>
+  800cf1:	48 01 fa             	add    %rdi,%rdx
+  800cf4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf7:	48 83 c1 01          	add    $0x1,%rcx
+  800cfb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cff:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d03:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d07:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d0b:	48 39 ca             	cmp    %rcx,%rdx
+  800d0e:	75 e7                	jne    800cf7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d10:	c3                   	ret
+
+0000000000800d11 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d11:	48 89 f8             	mov    %rdi,%rax
+  800d14:	48 85 d2             	test   %rdx,%rdx
+  800d17:	74 24                	je     800d3d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d19:	48 83 ea 01          	sub    $0x1,%rdx
+  800d1d:	74 1b                	je     800d3a <strlcpy+0x29>
+  800d1f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d23:	0f b6 16             	movzbl (%rsi),%edx
+  800d26:	84 d2                	test   %dl,%dl
+  800d28:	74 10                	je     800d3a <strlcpy+0x29>
+            *dst++ = *src++;
+  800d2a:	48 83 c6 01          	add    $0x1,%rsi
+  800d2e:	48 83 c0 01          	add    $0x1,%rax
+  800d32:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d35:	48 39 c8             	cmp    %rcx,%rax
+  800d38:	75 e9                	jne    800d23 <strlcpy+0x12>
+        *dst = '\0';
+  800d3a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d3d:	48 29 f8             	sub    %rdi,%rax
+}
+  800d40:	c3                   	ret
+
+0000000000800d41 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d41:	0f b6 07             	movzbl (%rdi),%eax
+  800d44:	84 c0                	test   %al,%al
+  800d46:	74 13                	je     800d5b <strcmp+0x1a>
+  800d48:	38 06                	cmp    %al,(%rsi)
+  800d4a:	75 0f                	jne    800d5b <strcmp+0x1a>
+  800d4c:	48 83 c7 01          	add    $0x1,%rdi
+  800d50:	48 83 c6 01          	add    $0x1,%rsi
+  800d54:	0f b6 07             	movzbl (%rdi),%eax
+  800d57:	84 c0                	test   %al,%al
+  800d59:	75 ed                	jne    800d48 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d5b:	0f b6 c0             	movzbl %al,%eax
+  800d5e:	0f b6 16             	movzbl (%rsi),%edx
+  800d61:	29 d0                	sub    %edx,%eax
+}
+  800d63:	c3                   	ret
+
+0000000000800d64 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d64:	48 85 d2             	test   %rdx,%rdx
+  800d67:	74 1f                	je     800d88 <strncmp+0x24>
+  800d69:	0f b6 07             	movzbl (%rdi),%eax
+  800d6c:	84 c0                	test   %al,%al
+  800d6e:	74 1e                	je     800d8e <strncmp+0x2a>
+  800d70:	3a 06                	cmp    (%rsi),%al
+  800d72:	75 1a                	jne    800d8e <strncmp+0x2a>
+  800d74:	48 83 c7 01          	add    $0x1,%rdi
+  800d78:	48 83 c6 01          	add    $0x1,%rsi
+  800d7c:	48 83 ea 01          	sub    $0x1,%rdx
+  800d80:	75 e7                	jne    800d69 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d87:	c3                   	ret
+  800d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8d:	c3                   	ret
+  800d8e:	48 85 d2             	test   %rdx,%rdx
+  800d91:	74 09                	je     800d9c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d93:	0f b6 07             	movzbl (%rdi),%eax
+  800d96:	0f b6 16             	movzbl (%rsi),%edx
+  800d99:	29 d0                	sub    %edx,%eax
+  800d9b:	c3                   	ret
+    if (!n) return 0;
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da1:	c3                   	ret
+
+0000000000800da2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da2:	0f b6 17             	movzbl (%rdi),%edx
+  800da5:	84 d2                	test   %dl,%dl
+  800da7:	74 18                	je     800dc1 <strchr+0x1f>
+        if (*str == c) {
+  800da9:	0f be d2             	movsbl %dl,%edx
+  800dac:	39 f2                	cmp    %esi,%edx
+  800dae:	74 17                	je     800dc7 <strchr+0x25>
+    for (; *str; str++) {
+  800db0:	48 83 c7 01          	add    $0x1,%rdi
+  800db4:	0f b6 17             	movzbl (%rdi),%edx
+  800db7:	84 d2                	test   %dl,%dl
+  800db9:	75 ee                	jne    800da9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc0:	c3                   	ret
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc6:	c3                   	ret
+  800dc7:	48 89 f8             	mov    %rdi,%rax
+}
+  800dca:	c3                   	ret
+
+0000000000800dcb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dcb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dce:	0f b6 17             	movzbl (%rdi),%edx
+  800dd1:	84 d2                	test   %dl,%dl
+  800dd3:	74 13                	je     800de8 <strfind+0x1d>
+  800dd5:	0f be d2             	movsbl %dl,%edx
+  800dd8:	39 f2                	cmp    %esi,%edx
+  800dda:	74 0b                	je     800de7 <strfind+0x1c>
+  800ddc:	48 83 c0 01          	add    $0x1,%rax
+  800de0:	0f b6 10             	movzbl (%rax),%edx
+  800de3:	84 d2                	test   %dl,%dl
+  800de5:	75 ee                	jne    800dd5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de7:	c3                   	ret
+  800de8:	c3                   	ret
+
+0000000000800de9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800de9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dec:	48 89 f8             	mov    %rdi,%rax
+  800def:	48 f7 d8             	neg    %rax
+  800df2:	83 e0 07             	and    $0x7,%eax
+  800df5:	49 89 d1             	mov    %rdx,%r9
+  800df8:	49 29 c1             	sub    %rax,%r9
+  800dfb:	78 36                	js     800e33 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dfd:	40 0f b6 c6          	movzbl %sil,%eax
+  800e01:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e08:	01 01 01 
+  800e0b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e0f:	40 f6 c7 07          	test   $0x7,%dil
+  800e13:	75 38                	jne    800e4d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e15:	4c 89 c9             	mov    %r9,%rcx
+  800e18:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e1c:	74 0c                	je     800e2a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e1e:	fc                   	cld
+  800e1f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e22:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e26:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e2a:	4d 85 c9             	test   %r9,%r9
+  800e2d:	75 45                	jne    800e74 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e2f:	4c 89 c0             	mov    %r8,%rax
+  800e32:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e33:	48 85 d2             	test   %rdx,%rdx
+  800e36:	74 f7                	je     800e2f <memset+0x46>
+  800e38:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e3b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e3e:	48 83 c0 01          	add    $0x1,%rax
+  800e42:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e46:	48 39 c2             	cmp    %rax,%rdx
+  800e49:	75 f3                	jne    800e3e <memset+0x55>
+  800e4b:	eb e2                	jmp    800e2f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e4d:	40 f6 c7 01          	test   $0x1,%dil
+  800e51:	74 06                	je     800e59 <memset+0x70>
+  800e53:	88 07                	mov    %al,(%rdi)
+  800e55:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e59:	40 f6 c7 02          	test   $0x2,%dil
+  800e5d:	74 07                	je     800e66 <memset+0x7d>
+  800e5f:	66 89 07             	mov    %ax,(%rdi)
+  800e62:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e66:	40 f6 c7 04          	test   $0x4,%dil
+  800e6a:	74 a9                	je     800e15 <memset+0x2c>
+  800e6c:	89 07                	mov    %eax,(%rdi)
+  800e6e:	48 83 c7 04          	add    $0x4,%rdi
+  800e72:	eb a1                	jmp    800e15 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e74:	41 f6 c1 04          	test   $0x4,%r9b
+  800e78:	74 06                	je     800e80 <memset+0x97>
+  800e7a:	89 07                	mov    %eax,(%rdi)
+  800e7c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e80:	41 f6 c1 02          	test   $0x2,%r9b
+  800e84:	74 07                	je     800e8d <memset+0xa4>
+  800e86:	66 89 07             	mov    %ax,(%rdi)
+  800e89:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e8d:	41 f6 c1 01          	test   $0x1,%r9b
+  800e91:	74 9c                	je     800e2f <memset+0x46>
+  800e93:	88 07                	mov    %al,(%rdi)
+  800e95:	eb 98                	jmp    800e2f <memset+0x46>
+
+0000000000800e97 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e97:	48 89 f8             	mov    %rdi,%rax
+  800e9a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e9d:	48 39 fe             	cmp    %rdi,%rsi
+  800ea0:	73 3b                	jae    800edd <memmove+0x46>
+  800ea2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea6:	48 39 d7             	cmp    %rdx,%rdi
+  800ea9:	73 32                	jae    800edd <memmove+0x46>
+        s += n;
+        d += n;
+  800eab:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eaf:	48 89 d6             	mov    %rdx,%rsi
+  800eb2:	48 09 fe             	or     %rdi,%rsi
+  800eb5:	48 09 ce             	or     %rcx,%rsi
+  800eb8:	40 f6 c6 07          	test   $0x7,%sil
+  800ebc:	75 12                	jne    800ed0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ebe:	48 83 ef 08          	sub    $0x8,%rdi
+  800ec2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eca:	fd                   	std
+  800ecb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ece:	fc                   	cld
+  800ecf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ed0:	48 83 ef 01          	sub    $0x1,%rdi
+  800ed4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed8:	fd                   	std
+  800ed9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800edb:	eb f1                	jmp    800ece <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800edd:	48 89 f2             	mov    %rsi,%rdx
+  800ee0:	48 09 c2             	or     %rax,%rdx
+  800ee3:	48 09 ca             	or     %rcx,%rdx
+  800ee6:	f6 c2 07             	test   $0x7,%dl
+  800ee9:	75 0c                	jne    800ef7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800eeb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eef:	48 89 c7             	mov    %rax,%rdi
+  800ef2:	fc                   	cld
+  800ef3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef7:	48 89 c7             	mov    %rax,%rdi
+  800efa:	fc                   	cld
+  800efb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800efd:	c3                   	ret
+
+0000000000800efe <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800efe:	55                   	push   %rbp
+  800eff:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f02:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+}
+  800f0e:	5d                   	pop    %rbp
+  800f0f:	c3                   	ret
+
+0000000000800f10 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f10:	55                   	push   %rbp
+  800f11:	48 89 e5             	mov    %rsp,%rbp
+  800f14:	41 57                	push   %r15
+  800f16:	41 56                	push   %r14
+  800f18:	41 55                	push   %r13
+  800f1a:	41 54                	push   %r12
+  800f1c:	53                   	push   %rbx
+  800f1d:	48 83 ec 08          	sub    $0x8,%rsp
+  800f21:	49 89 fe             	mov    %rdi,%r14
+  800f24:	49 89 f7             	mov    %rsi,%r15
+  800f27:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f2a:	48 89 f7             	mov    %rsi,%rdi
+  800f2d:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  800f34:	00 00 00 
+  800f37:	ff d0                	call   *%rax
+  800f39:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f3c:	48 89 de             	mov    %rbx,%rsi
+  800f3f:	4c 89 f7             	mov    %r14,%rdi
+  800f42:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  800f49:	00 00 00 
+  800f4c:	ff d0                	call   *%rax
+  800f4e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f51:	48 39 c3             	cmp    %rax,%rbx
+  800f54:	74 36                	je     800f8c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f56:	48 89 d8             	mov    %rbx,%rax
+  800f59:	4c 29 e8             	sub    %r13,%rax
+  800f5c:	49 39 c4             	cmp    %rax,%r12
+  800f5f:	73 31                	jae    800f92 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f61:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f66:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6a:	4c 89 fe             	mov    %r15,%rsi
+  800f6d:	48 b8 fe 0e 80 00 00 	movabs $0x800efe,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f79:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f7d:	48 83 c4 08          	add    $0x8,%rsp
+  800f81:	5b                   	pop    %rbx
+  800f82:	41 5c                	pop    %r12
+  800f84:	41 5d                	pop    %r13
+  800f86:	41 5e                	pop    %r14
+  800f88:	41 5f                	pop    %r15
+  800f8a:	5d                   	pop    %rbp
+  800f8b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f90:	eb eb                	jmp    800f7d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f92:	48 83 eb 01          	sub    $0x1,%rbx
+  800f96:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9a:	48 89 da             	mov    %rbx,%rdx
+  800f9d:	4c 89 fe             	mov    %r15,%rsi
+  800fa0:	48 b8 fe 0e 80 00 00 	movabs $0x800efe,%rax
+  800fa7:	00 00 00 
+  800faa:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fac:	49 01 de             	add    %rbx,%r14
+  800faf:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fb4:	eb c3                	jmp    800f79 <strlcat+0x69>
+
+0000000000800fb6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb6:	48 85 d2             	test   %rdx,%rdx
+  800fb9:	74 2d                	je     800fe8 <memcmp+0x32>
+  800fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fc0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fc4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fc9:	44 38 c1             	cmp    %r8b,%cl
+  800fcc:	75 0f                	jne    800fdd <memcmp+0x27>
+    while (n-- > 0) {
+  800fce:	48 83 c0 01          	add    $0x1,%rax
+  800fd2:	48 39 c2             	cmp    %rax,%rdx
+  800fd5:	75 e9                	jne    800fc0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fdd:	0f b6 c1             	movzbl %cl,%eax
+  800fe0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fe4:	44 29 c0             	sub    %r8d,%eax
+  800fe7:	c3                   	ret
+    return 0;
+  800fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fee:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ff2:	48 39 c7             	cmp    %rax,%rdi
+  800ff5:	73 0f                	jae    801006 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff7:	40 38 37             	cmp    %sil,(%rdi)
+  800ffa:	74 0e                	je     80100a <memfind+0x1c>
+    for (; src < end; src++) {
+  800ffc:	48 83 c7 01          	add    $0x1,%rdi
+  801000:	48 39 f8             	cmp    %rdi,%rax
+  801003:	75 f2                	jne    800ff7 <memfind+0x9>
+  801005:	c3                   	ret
+  801006:	48 89 f8             	mov    %rdi,%rax
+  801009:	c3                   	ret
+  80100a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80100d:	c3                   	ret
+
+000000000080100e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80100e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801011:	0f b6 37             	movzbl (%rdi),%esi
+  801014:	40 80 fe 20          	cmp    $0x20,%sil
+  801018:	74 06                	je     801020 <strtol+0x12>
+  80101a:	40 80 fe 09          	cmp    $0x9,%sil
+  80101e:	75 13                	jne    801033 <strtol+0x25>
+  801020:	48 83 c7 01          	add    $0x1,%rdi
+  801024:	0f b6 37             	movzbl (%rdi),%esi
+  801027:	40 80 fe 20          	cmp    $0x20,%sil
+  80102b:	74 f3                	je     801020 <strtol+0x12>
+  80102d:	40 80 fe 09          	cmp    $0x9,%sil
+  801031:	74 ed                	je     801020 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801033:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801036:	83 e0 fd             	and    $0xfffffffd,%eax
+  801039:	3c 01                	cmp    $0x1,%al
+  80103b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80103f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801045:	75 0f                	jne    801056 <strtol+0x48>
+  801047:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80104a:	74 14                	je     801060 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80104c:	85 d2                	test   %edx,%edx
+  80104e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801053:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801056:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80105b:	4c 63 ca             	movslq %edx,%r9
+  80105e:	eb 36                	jmp    801096 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801060:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801064:	74 0f                	je     801075 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801066:	85 d2                	test   %edx,%edx
+  801068:	75 ec                	jne    801056 <strtol+0x48>
+        s++;
+  80106a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80106e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801073:	eb e1                	jmp    801056 <strtol+0x48>
+        s += 2;
+  801075:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801079:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80107e:	eb d6                	jmp    801056 <strtol+0x48>
+            dig -= '0';
+  801080:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801083:	44 0f b6 c1          	movzbl %cl,%r8d
+  801087:	41 39 d0             	cmp    %edx,%r8d
+  80108a:	7d 21                	jge    8010ad <strtol+0x9f>
+        val = val * base + dig;
+  80108c:	49 0f af c1          	imul   %r9,%rax
+  801090:	0f b6 c9             	movzbl %cl,%ecx
+  801093:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801096:	48 83 c7 01          	add    $0x1,%rdi
+  80109a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80109e:	80 f9 39             	cmp    $0x39,%cl
+  8010a1:	76 dd                	jbe    801080 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010a3:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a6:	77 05                	ja     8010ad <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a8:	83 e9 57             	sub    $0x57,%ecx
+  8010ab:	eb d6                	jmp    801083 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ad:	4d 85 d2             	test   %r10,%r10
+  8010b0:	74 03                	je     8010b5 <strtol+0xa7>
+  8010b2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010b5:	48 89 c2             	mov    %rax,%rdx
+  8010b8:	48 f7 da             	neg    %rdx
+  8010bb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010bf:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010c3:	c3                   	ret
+
+00000000008010c4 <strrev>:
+
+void
+strrev(char *str)
+{
+  8010c4:	55                   	push   %rbp
+  8010c5:	48 89 e5             	mov    %rsp,%rbp
+  8010c8:	53                   	push   %rbx
+  8010c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8010cd:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8010d0:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  8010d7:	00 00 00 
+  8010da:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010dc:	83 e8 01             	sub    $0x1,%eax
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7e 22                	jle    801105 <strrev+0x41>
+  8010e3:	48 98                	cltq
+  8010e5:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010ea:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010ee:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010f2:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010f6:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010f9:	48 83 c2 01          	add    $0x1,%rdx
+  8010fd:	48 83 e8 01          	sub    $0x1,%rax
+  801101:	39 c2                	cmp    %eax,%edx
+  801103:	7c e5                	jl     8010ea <strrev+0x26>
+	}
+}
+  801105:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+
+000000000080110b <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80110b:	85 d2                	test   %edx,%edx
+  80110d:	0f 84 80 00 00 00    	je     801193 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801113:	55                   	push   %rbp
+  801114:	48 89 e5             	mov    %rsp,%rbp
+  801117:	53                   	push   %rbx
+  801118:	48 83 ec 08          	sub    $0x8,%rsp
+  80111c:	49 89 f2             	mov    %rsi,%r10
+  80111f:	41 89 d3             	mov    %edx,%r11d
+  801122:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801125:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80112a:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80112d:	eb 20                	jmp    80114f <itoa+0x44>
+			str[i++] = '0' + digit;
+  80112f:	41 89 f1             	mov    %esi,%r9d
+  801132:	83 c2 30             	add    $0x30,%edx
+  801135:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801138:	89 f8                	mov    %edi,%eax
+  80113a:	99                   	cltd
+  80113b:	f7 f9                	idiv   %ecx
+  80113d:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	74 2e                	je     801171 <itoa+0x66>
+  801143:	83 c6 01             	add    $0x1,%esi
+  801146:	49 83 c0 01          	add    $0x1,%r8
+  80114a:	44 39 cb             	cmp    %r9d,%ebx
+  80114d:	7e 15                	jle    801164 <itoa+0x59>
+		digit = sum % base;
+  80114f:	89 f8                	mov    %edi,%eax
+  801151:	99                   	cltd
+  801152:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801154:	83 fa 09             	cmp    $0x9,%edx
+  801157:	7e d6                	jle    80112f <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801159:	41 89 f1             	mov    %esi,%r9d
+  80115c:	83 c2 37             	add    $0x37,%edx
+  80115f:	41 88 10             	mov    %dl,(%r8)
+  801162:	eb d4                	jmp    801138 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801164:	41 83 eb 01          	sub    $0x1,%r11d
+  801168:	45 39 cb             	cmp    %r9d,%r11d
+  80116b:	75 04                	jne    801171 <itoa+0x66>
+  80116d:	85 c0                	test   %eax,%eax
+  80116f:	75 28                	jne    801199 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801171:	4d 63 c9             	movslq %r9d,%r9
+  801174:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801179:	4c 89 d7             	mov    %r10,%rdi
+  80117c:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  801183:	00 00 00 
+  801186:	ff d0                	call   *%rax
+	return 0;
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801191:	c9                   	leave
+  801192:	c3                   	ret
+		return -1;
+  801193:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801198:	c3                   	ret
+		return -1;
+  801199:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80119e:	eb ed                	jmp    80118d <itoa+0x82>
+
+00000000008011a0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+  8011a4:	53                   	push   %rbx
+  8011a5:	48 89 fa             	mov    %rdi,%rdx
+  8011a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+
+00000000008011cd <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011cd:	55                   	push   %rbp
+  8011ce:	48 89 e5             	mov    %rsp,%rbp
+  8011d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+
+00000000008011fe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+  801202:	53                   	push   %rbx
+  801203:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801207:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801229:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122b:	48 85 c0             	test   %rax,%rax
+  80122e:	7f 06                	jg     801236 <sys_env_destroy+0x38>
+}
+  801230:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801234:	c9                   	leave
+  801235:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801236:	49 89 c0             	mov    %rax,%r8
+  801239:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80123e:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  801245:	00 00 00 
+  801248:	be 26 00 00 00       	mov    $0x26,%esi
+  80124d:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  801254:	00 00 00 
+  801257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125c:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  801263:	00 00 00 
+  801266:	41 ff d1             	call   *%r9
+
+0000000000801269 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801269:	55                   	push   %rbp
+  80126a:	48 89 e5             	mov    %rsp,%rbp
+  80126d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80126e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801273:	ba 00 00 00 00       	mov    $0x0,%edx
+  801278:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801282:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801287:	be 00 00 00 00       	mov    $0x0,%esi
+  80128c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801292:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+000000000080129a <sys_yield>:
+
+void
+sys_yield(void) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80129f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+00000000008012cb <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	53                   	push   %rbx
+  8012d0:	48 89 fa             	mov    %rdi,%rdx
+  8012d3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012db:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012e2:	00 00 00 
+  8012e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fb:	c9                   	leave
+  8012fc:	c3                   	ret
+
+00000000008012fd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012fd:	55                   	push   %rbp
+  8012fe:	48 89 e5             	mov    %rsp,%rbp
+  801301:	53                   	push   %rbx
+  801302:	49 89 f8             	mov    %rdi,%r8
+  801305:	48 89 d3             	mov    %rdx,%rbx
+  801308:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80130b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801310:	4c 89 c2             	mov    %r8,%rdx
+  801313:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801316:	be 00 00 00 00       	mov    $0x0,%esi
+  80131b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801321:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+0000000000801329 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+  80132d:	53                   	push   %rbx
+  80132e:	48 83 ec 08          	sub    $0x8,%rsp
+  801332:	89 f8                	mov    %edi,%eax
+  801334:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801337:	48 63 f9             	movslq %ecx,%rdi
+  80133a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801342:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801345:	be 00 00 00 00       	mov    $0x0,%esi
+  80134a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801350:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801352:	48 85 c0             	test   %rax,%rax
+  801355:	7f 06                	jg     80135d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135b:	c9                   	leave
+  80135c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135d:	49 89 c0             	mov    %rax,%r8
+  801360:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801365:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  80136c:	00 00 00 
+  80136f:	be 26 00 00 00       	mov    $0x26,%esi
+  801374:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  80137b:	00 00 00 
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801383:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  80138a:	00 00 00 
+  80138d:	41 ff d1             	call   *%r9
+
+0000000000801390 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+  801394:	53                   	push   %rbx
+  801395:	48 83 ec 08          	sub    $0x8,%rsp
+  801399:	89 f8                	mov    %edi,%eax
+  80139b:	49 89 f2             	mov    %rsi,%r10
+  80139e:	48 89 cf             	mov    %rcx,%rdi
+  8013a1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013a4:	48 63 da             	movslq %edx,%rbx
+  8013a7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013aa:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013af:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b7:	48 85 c0             	test   %rax,%rax
+  8013ba:	7f 06                	jg     8013c2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c0:	c9                   	leave
+  8013c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c2:	49 89 c0             	mov    %rax,%r8
+  8013c5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013ca:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  8013d1:	00 00 00 
+  8013d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d9:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  8013e0:	00 00 00 
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e8:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  8013ef:	00 00 00 
+  8013f2:	41 ff d1             	call   *%r9
+
+00000000008013f5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013f5:	55                   	push   %rbp
+  8013f6:	48 89 e5             	mov    %rsp,%rbp
+  8013f9:	53                   	push   %rbx
+  8013fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fe:	48 89 f1             	mov    %rsi,%rcx
+  801401:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801404:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801407:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801411:	be 00 00 00 00       	mov    $0x0,%esi
+  801416:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141e:	48 85 c0             	test   %rax,%rax
+  801421:	7f 06                	jg     801429 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801423:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801427:	c9                   	leave
+  801428:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801429:	49 89 c0             	mov    %rax,%r8
+  80142c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801431:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  801438:	00 00 00 
+  80143b:	be 26 00 00 00       	mov    $0x26,%esi
+  801440:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  801447:	00 00 00 
+  80144a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144f:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  801456:	00 00 00 
+  801459:	41 ff d1             	call   *%r9
+
+000000000080145c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80145c:	55                   	push   %rbp
+  80145d:	48 89 e5             	mov    %rsp,%rbp
+  801460:	53                   	push   %rbx
+  801461:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801465:	48 63 ce             	movslq %esi,%rcx
+  801468:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801475:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147a:	be 00 00 00 00       	mov    $0x0,%esi
+  80147f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801485:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801487:	48 85 c0             	test   %rax,%rax
+  80148a:	7f 06                	jg     801492 <sys_env_set_status+0x36>
+}
+  80148c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80149a:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a9:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	53                   	push   %rbx
+  8014ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ce:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f0:	48 85 c0             	test   %rax,%rax
+  8014f3:	7f 06                	jg     8014fb <sys_env_set_trapframe+0x36>
+}
+  8014f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f9:	c9                   	leave
+  8014fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fb:	49 89 c0             	mov    %rax,%r8
+  8014fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801503:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  80150a:	00 00 00 
+  80150d:	be 26 00 00 00       	mov    $0x26,%esi
+  801512:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  801519:	00 00 00 
+  80151c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801521:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  801528:	00 00 00 
+  80152b:	41 ff d1             	call   *%r9
+
+000000000080152e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	53                   	push   %rbx
+  801533:	48 83 ec 08          	sub    $0x8,%rsp
+  801537:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80153a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801542:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801559:	48 85 c0             	test   %rax,%rax
+  80155c:	7f 06                	jg     801564 <sys_env_set_pgfault_upcall+0x36>
+}
+  80155e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801564:	49 89 c0             	mov    %rax,%r8
+  801567:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80156c:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  801573:	00 00 00 
+  801576:	be 26 00 00 00       	mov    $0x26,%esi
+  80157b:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  801582:	00 00 00 
+  801585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158a:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  801591:	00 00 00 
+  801594:	41 ff d1             	call   *%r9
+
+0000000000801597 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801597:	55                   	push   %rbp
+  801598:	48 89 e5             	mov    %rsp,%rbp
+  80159b:	53                   	push   %rbx
+  80159c:	89 f8                	mov    %edi,%eax
+  80159e:	49 89 f1             	mov    %rsi,%r9
+  8015a1:	48 89 d3             	mov    %rdx,%rbx
+  8015a4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015a7:	49 63 f0             	movslq %r8d,%rsi
+  8015aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ad:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bb:	cd 30                	int    $0x30
+}
+  8015bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+00000000008015c3 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cc:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8015cf:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015df:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ec:	48 85 c0             	test   %rax,%rax
+  8015ef:	7f 06                	jg     8015f7 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f7:	49 89 c0             	mov    %rax,%r8
+  8015fa:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015ff:	48 ba 48 3e 80 00 00 	movabs $0x803e48,%rdx
+  801606:	00 00 00 
+  801609:	be 26 00 00 00       	mov    $0x26,%esi
+  80160e:	48 bf 67 3e 80 00 00 	movabs $0x803e67,%rdi
+  801615:	00 00 00 
+  801618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161d:	49 b9 28 02 80 00 00 	movabs $0x800228,%r9
+  801624:	00 00 00 
+  801627:	41 ff d1             	call   *%r9
+
+000000000080162a <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80162a:	55                   	push   %rbp
+  80162b:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80162e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801633:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  80163a:	00 00 00 
+  80163d:	ff d0                	call   *%rax
+}
+  80163f:	5d                   	pop    %rbp
+  801640:	c3                   	ret
+
+0000000000801641 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801641:	55                   	push   %rbp
+  801642:	48 89 e5             	mov    %rsp,%rbp
+  801645:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801646:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801650:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801655:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165f:	be 00 00 00 00       	mov    $0x0,%esi
+  801664:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801670:	c9                   	leave
+  801671:	c3                   	ret
+
+0000000000801672 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+  801676:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801677:	48 63 ce             	movslq %esi,%rcx
+  80167a:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80167e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801683:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801688:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168d:	be 00 00 00 00       	mov    $0x0,%esi
+  801692:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801698:	cd 30                	int    $0x30
+}
+  80169a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+
+00000000008016a0 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8016a0:	55                   	push   %rbp
+  8016a1:	48 89 e5             	mov    %rsp,%rbp
+  8016a4:	53                   	push   %rbx
+  8016a5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8016a8:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ac:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c6:	cd 30                	int    $0x30
+}
+  8016c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cc:	c9                   	leave
+  8016cd:	c3                   	ret
+
+00000000008016ce <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8016ce:	55                   	push   %rbp
+  8016cf:	48 89 e5             	mov    %rsp,%rbp
+  8016d2:	53                   	push   %rbx
+  8016d3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8016d6:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016de:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f1:	cd 30                	int    $0x30
+}
+  8016f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f7:	c9                   	leave
+  8016f8:	c3                   	ret
+
+00000000008016f9 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8016f9:	55                   	push   %rbp
+  8016fa:	48 89 e5             	mov    %rsp,%rbp
+  8016fd:	41 54                	push   %r12
+  8016ff:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801700:	b8 08 00 00 00       	mov    $0x8,%eax
+  801705:	cd 30                	int    $0x30
+  801707:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	78 7e                	js     80178c <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  80170e:	0f 84 80 00 00 00    	je     801794 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801714:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80171a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801721:	00 00 00 
+  801724:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801729:	89 c2                	mov    %eax,%edx
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	bf 00 00 00 00       	mov    $0x0,%edi
+  801735:	48 b8 90 13 80 00 00 	movabs $0x801390,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+  801741:	85 c0                	test   %eax,%eax
+  801743:	0f 88 81 00 00 00    	js     8017ca <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801749:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801750:	00 00 00 
+  801753:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  80175a:	44 89 e7             	mov    %r12d,%edi
+  80175d:	48 b8 2e 15 80 00 00 	movabs $0x80152e,%rax
+  801764:	00 00 00 
+  801767:	ff d0                	call   *%rax
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	78 65                	js     8017d2 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80176d:	be 02 00 00 00       	mov    $0x2,%esi
+  801772:	44 89 e7             	mov    %r12d,%edi
+  801775:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  80177c:	00 00 00 
+  80177f:	ff d0                	call   *%rax
+        return -1;
+  801781:	85 c0                	test   %eax,%eax
+  801783:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801788:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  80178c:	44 89 e0             	mov    %r12d,%eax
+  80178f:	5b                   	pop    %rbx
+  801790:	41 5c                	pop    %r12
+  801792:	5d                   	pop    %rbp
+  801793:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801794:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+  8017a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8017a9:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8017ad:	48 c1 e0 04          	shl    $0x4,%rax
+  8017b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017b8:	00 00 00 
+  8017bb:	48 01 d0             	add    %rdx,%rax
+  8017be:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8017c5:	00 00 00 
+        return 0;
+  8017c8:	eb c2                	jmp    80178c <fork+0x93>
+        return -1;
+  8017ca:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017d0:	eb ba                	jmp    80178c <fork+0x93>
+        return -1;
+  8017d2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017d8:	eb b2                	jmp    80178c <fork+0x93>
+
+00000000008017da <sfork>:
+
+envid_t
+sfork() {
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017de:	48 ba 75 3e 80 00 00 	movabs $0x803e75,%rdx
+  8017e5:	00 00 00 
+  8017e8:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8017ed:	48 bf 90 3e 80 00 00 	movabs $0x803e90,%rdi
+  8017f4:	00 00 00 
+  8017f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fc:	48 b9 28 02 80 00 00 	movabs $0x800228,%rcx
+  801803:	00 00 00 
+  801806:	ff d1                	call   *%rcx
+
+0000000000801808 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801808:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80180f:	ff ff ff 
+  801812:	48 01 f8             	add    %rdi,%rax
+  801815:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801819:	c3                   	ret
+
+000000000080181a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80181a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801821:	ff ff ff 
+  801824:	48 01 f8             	add    %rdi,%rax
+  801827:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80182b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801831:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801835:	c3                   	ret
+
+0000000000801836 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	41 57                	push   %r15
+  80183c:	41 56                	push   %r14
+  80183e:	41 55                	push   %r13
+  801840:	41 54                	push   %r12
+  801842:	53                   	push   %rbx
+  801843:	48 83 ec 08          	sub    $0x8,%rsp
+  801847:	49 89 ff             	mov    %rdi,%r15
+  80184a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80184f:	49 bd 55 33 80 00 00 	movabs $0x803355,%r13
+  801856:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801859:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80185f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801862:	48 89 df             	mov    %rbx,%rdi
+  801865:	41 ff d5             	call   *%r13
+  801868:	83 e0 04             	and    $0x4,%eax
+  80186b:	74 17                	je     801884 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80186d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801874:	4c 39 f3             	cmp    %r14,%rbx
+  801877:	75 e6                	jne    80185f <fd_alloc+0x29>
+  801879:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80187f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801884:	4d 89 27             	mov    %r12,(%r15)
+}
+  801887:	48 83 c4 08          	add    $0x8,%rsp
+  80188b:	5b                   	pop    %rbx
+  80188c:	41 5c                	pop    %r12
+  80188e:	41 5d                	pop    %r13
+  801890:	41 5e                	pop    %r14
+  801892:	41 5f                	pop    %r15
+  801894:	5d                   	pop    %rbp
+  801895:	c3                   	ret
+
+0000000000801896 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801896:	83 ff 1f             	cmp    $0x1f,%edi
+  801899:	77 39                	ja     8018d4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80189b:	55                   	push   %rbp
+  80189c:	48 89 e5             	mov    %rsp,%rbp
+  80189f:	41 54                	push   %r12
+  8018a1:	53                   	push   %rbx
+  8018a2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018a5:	48 63 df             	movslq %edi,%rbx
+  8018a8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018af:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018b3:	48 89 df             	mov    %rbx,%rdi
+  8018b6:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+  8018c2:	a8 04                	test   $0x4,%al
+  8018c4:	74 14                	je     8018da <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018c6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018cf:	5b                   	pop    %rbx
+  8018d0:	41 5c                	pop    %r12
+  8018d2:	5d                   	pop    %rbp
+  8018d3:	c3                   	ret
+        return -E_INVAL;
+  8018d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018d9:	c3                   	ret
+        return -E_INVAL;
+  8018da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018df:	eb ee                	jmp    8018cf <fd_lookup+0x39>
+
+00000000008018e1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018e1:	55                   	push   %rbp
+  8018e2:	48 89 e5             	mov    %rsp,%rbp
+  8018e5:	41 54                	push   %r12
+  8018e7:	53                   	push   %rbx
+  8018e8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018eb:	48 b8 40 3f 80 00 00 	movabs $0x803f40,%rax
+  8018f2:	00 00 00 
+  8018f5:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8018fc:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018ff:	39 3b                	cmp    %edi,(%rbx)
+  801901:	74 47                	je     80194a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801903:	48 83 c0 08          	add    $0x8,%rax
+  801907:	48 8b 18             	mov    (%rax),%rbx
+  80190a:	48 85 db             	test   %rbx,%rbx
+  80190d:	75 f0                	jne    8018ff <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80190f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801916:	00 00 00 
+  801919:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80191f:	89 fa                	mov    %edi,%edx
+  801921:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  801928:	00 00 00 
+  80192b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801930:	48 b9 78 03 80 00 00 	movabs $0x800378,%rcx
+  801937:	00 00 00 
+  80193a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80193c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801941:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801945:	5b                   	pop    %rbx
+  801946:	41 5c                	pop    %r12
+  801948:	5d                   	pop    %rbp
+  801949:	c3                   	ret
+            return 0;
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194f:	eb f0                	jmp    801941 <dev_lookup+0x60>
+
+0000000000801951 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801951:	55                   	push   %rbp
+  801952:	48 89 e5             	mov    %rsp,%rbp
+  801955:	41 55                	push   %r13
+  801957:	41 54                	push   %r12
+  801959:	53                   	push   %rbx
+  80195a:	48 83 ec 18          	sub    $0x18,%rsp
+  80195e:	48 89 fb             	mov    %rdi,%rbx
+  801961:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801964:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80196b:	ff ff ff 
+  80196e:	48 01 df             	add    %rbx,%rdi
+  801971:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801975:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801979:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801980:	00 00 00 
+  801983:	ff d0                	call   *%rax
+  801985:	41 89 c5             	mov    %eax,%r13d
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	78 06                	js     801992 <fd_close+0x41>
+  80198c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801990:	74 1a                	je     8019ac <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801992:	45 84 e4             	test   %r12b,%r12b
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80199e:	44 89 e8             	mov    %r13d,%eax
+  8019a1:	48 83 c4 18          	add    $0x18,%rsp
+  8019a5:	5b                   	pop    %rbx
+  8019a6:	41 5c                	pop    %r12
+  8019a8:	41 5d                	pop    %r13
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019ac:	8b 3b                	mov    (%rbx),%edi
+  8019ae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019b2:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8019b9:	00 00 00 
+  8019bc:	ff d0                	call   *%rax
+  8019be:	41 89 c5             	mov    %eax,%r13d
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	78 1b                	js     8019e0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019c9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8019cd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019d3:	48 85 c0             	test   %rax,%rax
+  8019d6:	74 08                	je     8019e0 <fd_close+0x8f>
+  8019d8:	48 89 df             	mov    %rbx,%rdi
+  8019db:	ff d0                	call   *%rax
+  8019dd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e5:	48 89 de             	mov    %rbx,%rsi
+  8019e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ed:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  8019f4:	00 00 00 
+  8019f7:	ff d0                	call   *%rax
+    return res;
+  8019f9:	eb a3                	jmp    80199e <fd_close+0x4d>
+
+00000000008019fb <close>:
+
+int
+close(int fdnum) {
+  8019fb:	55                   	push   %rbp
+  8019fc:	48 89 e5             	mov    %rsp,%rbp
+  8019ff:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a03:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a07:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	78 15                	js     801a2c <close+0x31>
+
+    return fd_close(fd, 1);
+  801a17:	be 01 00 00 00       	mov    $0x1,%esi
+  801a1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a20:	48 b8 51 19 80 00 00 	movabs $0x801951,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+}
+  801a2c:	c9                   	leave
+  801a2d:	c3                   	ret
+
+0000000000801a2e <close_all>:
+
+void
+close_all(void) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	41 54                	push   %r12
+  801a34:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3a:	49 bc fb 19 80 00 00 	movabs $0x8019fb,%r12
+  801a41:	00 00 00 
+  801a44:	89 df                	mov    %ebx,%edi
+  801a46:	41 ff d4             	call   *%r12
+  801a49:	83 c3 01             	add    $0x1,%ebx
+  801a4c:	83 fb 20             	cmp    $0x20,%ebx
+  801a4f:	75 f3                	jne    801a44 <close_all+0x16>
+}
+  801a51:	5b                   	pop    %rbx
+  801a52:	41 5c                	pop    %r12
+  801a54:	5d                   	pop    %rbp
+  801a55:	c3                   	ret
+
+0000000000801a56 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	41 57                	push   %r15
+  801a5c:	41 56                	push   %r14
+  801a5e:	41 55                	push   %r13
+  801a60:	41 54                	push   %r12
+  801a62:	53                   	push   %rbx
+  801a63:	48 83 ec 18          	sub    $0x18,%rsp
+  801a67:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a6a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a6e:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+  801a7a:	89 c3                	mov    %eax,%ebx
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	0f 88 b8 00 00 00    	js     801b3c <dup+0xe6>
+    close(newfdnum);
+  801a84:	44 89 e7             	mov    %r12d,%edi
+  801a87:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a93:	4d 63 ec             	movslq %r12d,%r13
+  801a96:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a9d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801aa1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801aa5:	4c 89 ff             	mov    %r15,%rdi
+  801aa8:	49 be 1a 18 80 00 00 	movabs $0x80181a,%r14
+  801aaf:	00 00 00 
+  801ab2:	41 ff d6             	call   *%r14
+  801ab5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ab8:	4c 89 ef             	mov    %r13,%rdi
+  801abb:	41 ff d6             	call   *%r14
+  801abe:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ac1:	48 89 df             	mov    %rbx,%rdi
+  801ac4:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ad0:	a8 04                	test   $0x4,%al
+  801ad2:	74 2b                	je     801aff <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ad4:	41 89 c1             	mov    %eax,%r9d
+  801ad7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801add:	4c 89 f1             	mov    %r14,%rcx
+  801ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae5:	48 89 de             	mov    %rbx,%rsi
+  801ae8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aed:	48 b8 90 13 80 00 00 	movabs $0x801390,%rax
+  801af4:	00 00 00 
+  801af7:	ff d0                	call   *%rax
+  801af9:	89 c3                	mov    %eax,%ebx
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 4e                	js     801b4d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801aff:	4c 89 ff             	mov    %r15,%rdi
+  801b02:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  801b09:	00 00 00 
+  801b0c:	ff d0                	call   *%rax
+  801b0e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b11:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b17:	4c 89 e9             	mov    %r13,%rcx
+  801b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1f:	4c 89 fe             	mov    %r15,%rsi
+  801b22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b27:	48 b8 90 13 80 00 00 	movabs $0x801390,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	89 c3                	mov    %eax,%ebx
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 14                	js     801b4d <dup+0xf7>
+
+    return newfdnum;
+  801b39:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b3c:	89 d8                	mov    %ebx,%eax
+  801b3e:	48 83 c4 18          	add    $0x18,%rsp
+  801b42:	5b                   	pop    %rbx
+  801b43:	41 5c                	pop    %r12
+  801b45:	41 5d                	pop    %r13
+  801b47:	41 5e                	pop    %r14
+  801b49:	41 5f                	pop    %r15
+  801b4b:	5d                   	pop    %rbp
+  801b4c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b52:	4c 89 ee             	mov    %r13,%rsi
+  801b55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5a:	49 bc f5 13 80 00 00 	movabs $0x8013f5,%r12
+  801b61:	00 00 00 
+  801b64:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b6c:	4c 89 f6             	mov    %r14,%rsi
+  801b6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b74:	41 ff d4             	call   *%r12
+    return res;
+  801b77:	eb c3                	jmp    801b3c <dup+0xe6>
+
+0000000000801b79 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b79:	55                   	push   %rbp
+  801b7a:	48 89 e5             	mov    %rsp,%rbp
+  801b7d:	41 56                	push   %r14
+  801b7f:	41 55                	push   %r13
+  801b81:	41 54                	push   %r12
+  801b83:	53                   	push   %rbx
+  801b84:	48 83 ec 10          	sub    $0x10,%rsp
+  801b88:	89 fb                	mov    %edi,%ebx
+  801b8a:	49 89 f4             	mov    %rsi,%r12
+  801b8d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b94:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	78 4c                	js     801bf0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ba8:	41 8b 3e             	mov    (%r14),%edi
+  801bab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801baf:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 35                	js     801bf4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bbf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bc3:	83 e0 03             	and    $0x3,%eax
+  801bc6:	83 f8 01             	cmp    $0x1,%eax
+  801bc9:	74 2d                	je     801bf8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bcb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bcf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bd3:	48 85 c0             	test   %rax,%rax
+  801bd6:	74 56                	je     801c2e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801bd8:	4c 89 ea             	mov    %r13,%rdx
+  801bdb:	4c 89 e6             	mov    %r12,%rsi
+  801bde:	4c 89 f7             	mov    %r14,%rdi
+  801be1:	ff d0                	call   *%rax
+}
+  801be3:	48 83 c4 10          	add    $0x10,%rsp
+  801be7:	5b                   	pop    %rbx
+  801be8:	41 5c                	pop    %r12
+  801bea:	41 5d                	pop    %r13
+  801bec:	41 5e                	pop    %r14
+  801bee:	5d                   	pop    %rbp
+  801bef:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf0:	48 98                	cltq
+  801bf2:	eb ef                	jmp    801be3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf4:	48 98                	cltq
+  801bf6:	eb eb                	jmp    801be3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf8:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801bff:	00 00 00 
+  801c02:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c08:	89 da                	mov    %ebx,%edx
+  801c0a:	48 bf 01 3f 80 00 00 	movabs $0x803f01,%rdi
+  801c11:	00 00 00 
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	48 b9 78 03 80 00 00 	movabs $0x800378,%rcx
+  801c20:	00 00 00 
+  801c23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c25:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c2c:	eb b5                	jmp    801be3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c2e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c35:	eb ac                	jmp    801be3 <read+0x6a>
+
+0000000000801c37 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801c37:	55                   	push   %rbp
+  801c38:	48 89 e5             	mov    %rsp,%rbp
+  801c3b:	41 56                	push   %r14
+  801c3d:	41 55                	push   %r13
+  801c3f:	41 54                	push   %r12
+  801c41:	53                   	push   %rbx
+  801c42:	48 83 ec 10          	sub    $0x10,%rsp
+  801c46:	89 fb                	mov    %edi,%ebx
+  801c48:	49 89 f4             	mov    %rsi,%r12
+  801c4b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c52:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 41                	js     801ca3 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c62:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c66:	41 8b 3e             	mov    (%r14),%edi
+  801c69:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c6d:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 35                	js     801cb2 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c7d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c81:	83 e0 03             	and    $0x3,%eax
+  801c84:	83 f8 01             	cmp    $0x1,%eax
+  801c87:	74 2d                	je     801cb6 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801c89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c91:	48 85 c0             	test   %rax,%rax
+  801c94:	74 56                	je     801cec <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801c96:	4c 89 ea             	mov    %r13,%rdx
+  801c99:	4c 89 e6             	mov    %r12,%rsi
+  801c9c:	4c 89 f7             	mov    %r14,%rdi
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	eb 02                	jmp    801ca5 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca3:	48 98                	cltq
+}
+  801ca5:	48 83 c4 10          	add    $0x10,%rsp
+  801ca9:	5b                   	pop    %rbx
+  801caa:	41 5c                	pop    %r12
+  801cac:	41 5d                	pop    %r13
+  801cae:	41 5e                	pop    %r14
+  801cb0:	5d                   	pop    %rbp
+  801cb1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb2:	48 98                	cltq
+  801cb4:	eb ef                	jmp    801ca5 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cb6:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801cbd:	00 00 00 
+  801cc0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cc6:	89 da                	mov    %ebx,%edx
+  801cc8:	48 bf c0 3e 80 00 00 	movabs $0x803ec0,%rdi
+  801ccf:	00 00 00 
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd7:	48 b9 78 03 80 00 00 	movabs $0x800378,%rcx
+  801cde:	00 00 00 
+  801ce1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ce3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cea:	eb b9                	jmp    801ca5 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801cec:	4c 89 ea             	mov    %r13,%rdx
+  801cef:	4c 89 e6             	mov    %r12,%rsi
+  801cf2:	89 df                	mov    %ebx,%edi
+  801cf4:	48 b8 79 1b 80 00 00 	movabs $0x801b79,%rax
+  801cfb:	00 00 00 
+  801cfe:	ff d0                	call   *%rax
+  801d00:	eb a3                	jmp    801ca5 <readmap+0x6e>
+
+0000000000801d02 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d02:	55                   	push   %rbp
+  801d03:	48 89 e5             	mov    %rsp,%rbp
+  801d06:	41 57                	push   %r15
+  801d08:	41 56                	push   %r14
+  801d0a:	41 55                	push   %r13
+  801d0c:	41 54                	push   %r12
+  801d0e:	53                   	push   %rbx
+  801d0f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d13:	48 85 d2             	test   %rdx,%rdx
+  801d16:	74 54                	je     801d6c <readn+0x6a>
+  801d18:	41 89 fd             	mov    %edi,%r13d
+  801d1b:	49 89 f6             	mov    %rsi,%r14
+  801d1e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d26:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d2b:	49 bf 79 1b 80 00 00 	movabs $0x801b79,%r15
+  801d32:	00 00 00 
+  801d35:	4c 89 e2             	mov    %r12,%rdx
+  801d38:	48 29 f2             	sub    %rsi,%rdx
+  801d3b:	4c 01 f6             	add    %r14,%rsi
+  801d3e:	44 89 ef             	mov    %r13d,%edi
+  801d41:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 20                	js     801d68 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d48:	01 c3                	add    %eax,%ebx
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	74 08                	je     801d56 <readn+0x54>
+  801d4e:	48 63 f3             	movslq %ebx,%rsi
+  801d51:	4c 39 e6             	cmp    %r12,%rsi
+  801d54:	72 df                	jb     801d35 <readn+0x33>
+    }
+    return res;
+  801d56:	48 63 c3             	movslq %ebx,%rax
+}
+  801d59:	48 83 c4 08          	add    $0x8,%rsp
+  801d5d:	5b                   	pop    %rbx
+  801d5e:	41 5c                	pop    %r12
+  801d60:	41 5d                	pop    %r13
+  801d62:	41 5e                	pop    %r14
+  801d64:	41 5f                	pop    %r15
+  801d66:	5d                   	pop    %rbp
+  801d67:	c3                   	ret
+        if (inc < 0) return inc;
+  801d68:	48 98                	cltq
+  801d6a:	eb ed                	jmp    801d59 <readn+0x57>
+    int inc = 1, res = 0;
+  801d6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d71:	eb e3                	jmp    801d56 <readn+0x54>
+
+0000000000801d73 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	41 56                	push   %r14
+  801d79:	41 55                	push   %r13
+  801d7b:	41 54                	push   %r12
+  801d7d:	53                   	push   %rbx
+  801d7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d82:	89 fb                	mov    %edi,%ebx
+  801d84:	49 89 f4             	mov    %rsi,%r12
+  801d87:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8e:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801d95:	00 00 00 
+  801d98:	ff d0                	call   *%rax
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 47                	js     801de5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da2:	41 8b 3e             	mov    (%r14),%edi
+  801da5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da9:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 30                	js     801de9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dbe:	74 2d                	je     801ded <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dc8:	48 85 c0             	test   %rax,%rax
+  801dcb:	74 56                	je     801e23 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dcd:	4c 89 ea             	mov    %r13,%rdx
+  801dd0:	4c 89 e6             	mov    %r12,%rsi
+  801dd3:	4c 89 f7             	mov    %r14,%rdi
+  801dd6:	ff d0                	call   *%rax
+}
+  801dd8:	48 83 c4 10          	add    $0x10,%rsp
+  801ddc:	5b                   	pop    %rbx
+  801ddd:	41 5c                	pop    %r12
+  801ddf:	41 5d                	pop    %r13
+  801de1:	41 5e                	pop    %r14
+  801de3:	5d                   	pop    %rbp
+  801de4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de5:	48 98                	cltq
+  801de7:	eb ef                	jmp    801dd8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de9:	48 98                	cltq
+  801deb:	eb eb                	jmp    801dd8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ded:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801df4:	00 00 00 
+  801df7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dfd:	89 da                	mov    %ebx,%edx
+  801dff:	48 bf 1d 3f 80 00 00 	movabs $0x803f1d,%rdi
+  801e06:	00 00 00 
+  801e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0e:	48 b9 78 03 80 00 00 	movabs $0x800378,%rcx
+  801e15:	00 00 00 
+  801e18:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e1a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e21:	eb b5                	jmp    801dd8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e23:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e2a:	eb ac                	jmp    801dd8 <write+0x65>
+
+0000000000801e2c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e2c:	55                   	push   %rbp
+  801e2d:	48 89 e5             	mov    %rsp,%rbp
+  801e30:	53                   	push   %rbx
+  801e31:	48 83 ec 18          	sub    $0x18,%rsp
+  801e35:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e3b:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	78 0c                	js     801e57 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e4f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e5b:	c9                   	leave
+  801e5c:	c3                   	ret
+
+0000000000801e5d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e5d:	55                   	push   %rbp
+  801e5e:	48 89 e5             	mov    %rsp,%rbp
+  801e61:	41 55                	push   %r13
+  801e63:	41 54                	push   %r12
+  801e65:	53                   	push   %rbx
+  801e66:	48 83 ec 18          	sub    $0x18,%rsp
+  801e6a:	89 fb                	mov    %edi,%ebx
+  801e6c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e73:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 38                	js     801ebb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e83:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e87:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e8b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e8f:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 1c                	js     801ebb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e9f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ea4:	74 20                	je     801ec6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ea6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eaa:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801eae:	48 85 c0             	test   %rax,%rax
+  801eb1:	74 47                	je     801efa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801eb3:	44 89 e6             	mov    %r12d,%esi
+  801eb6:	4c 89 ef             	mov    %r13,%rdi
+  801eb9:	ff d0                	call   *%rax
+}
+  801ebb:	48 83 c4 18          	add    $0x18,%rsp
+  801ebf:	5b                   	pop    %rbx
+  801ec0:	41 5c                	pop    %r12
+  801ec2:	41 5d                	pop    %r13
+  801ec4:	5d                   	pop    %rbp
+  801ec5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ec6:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801ecd:	00 00 00 
+  801ed0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ed6:	89 da                	mov    %ebx,%edx
+  801ed8:	48 bf e0 3e 80 00 00 	movabs $0x803ee0,%rdi
+  801edf:	00 00 00 
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee7:	48 b9 78 03 80 00 00 	movabs $0x800378,%rcx
+  801eee:	00 00 00 
+  801ef1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef8:	eb c1                	jmp    801ebb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801efa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eff:	eb ba                	jmp    801ebb <ftruncate+0x5e>
+
+0000000000801f01 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	41 54                	push   %r12
+  801f07:	53                   	push   %rbx
+  801f08:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f0f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f13:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  801f1a:	00 00 00 
+  801f1d:	ff d0                	call   *%rax
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	78 4e                	js     801f71 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f23:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f27:	41 8b 3c 24          	mov    (%r12),%edi
+  801f2b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f2f:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 32                	js     801f71 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f43:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801f48:	74 30                	je     801f7a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f4a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f54:	00 00 00 
+    stat->st_isdir = 0;
+  801f57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f5e:	00 00 00 
+    stat->st_dev = dev;
+  801f61:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f68:	48 89 de             	mov    %rbx,%rsi
+  801f6b:	4c 89 e7             	mov    %r12,%rdi
+  801f6e:	ff 50 30             	call   *0x30(%rax)
+}
+  801f71:	48 83 c4 10          	add    $0x10,%rsp
+  801f75:	5b                   	pop    %rbx
+  801f76:	41 5c                	pop    %r12
+  801f78:	5d                   	pop    %rbp
+  801f79:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f7a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f7f:	eb f0                	jmp    801f71 <fstat+0x70>
+
+0000000000801f81 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f81:	55                   	push   %rbp
+  801f82:	48 89 e5             	mov    %rsp,%rbp
+  801f85:	41 54                	push   %r12
+  801f87:	53                   	push   %rbx
+  801f88:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f90:	48 b8 d8 2c 80 00 00 	movabs $0x802cd8,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	78 25                	js     801fc7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fa2:	4c 89 e6             	mov    %r12,%rsi
+  801fa5:	89 c7                	mov    %eax,%edi
+  801fa7:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fb6:	89 df                	mov    %ebx,%edi
+  801fb8:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801fbf:	00 00 00 
+  801fc2:	ff d0                	call   *%rax
+
+    return res;
+  801fc4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fc7:	89 d8                	mov    %ebx,%eax
+  801fc9:	5b                   	pop    %rbx
+  801fca:	41 5c                	pop    %r12
+  801fcc:	5d                   	pop    %rbp
+  801fcd:	c3                   	ret
+
+0000000000801fce <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801fce:	55                   	push   %rbp
+  801fcf:	48 89 e5             	mov    %rsp,%rbp
+  801fd2:	41 54                	push   %r12
+  801fd4:	53                   	push   %rbx
+  801fd5:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd9:	48 89 fb             	mov    %rdi,%rbx
+  801fdc:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fdf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe3:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fe8:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	78 1f                	js     802017 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801ff8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ffc:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802000:	48 85 c0             	test   %rax,%rax
+  802003:	74 1b                	je     802020 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802005:	4c 89 e6             	mov    %r12,%rsi
+  802008:	48 89 df             	mov    %rbx,%rdi
+  80200b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802014:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802017:	48 83 c4 10          	add    $0x10,%rsp
+  80201b:	5b                   	pop    %rbx
+  80201c:	41 5c                	pop    %r12
+  80201e:	5d                   	pop    %rbp
+  80201f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802020:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802025:	eb f0                	jmp    802017 <create_snapshot+0x49>
+
+0000000000802027 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802027:	55                   	push   %rbp
+  802028:	48 89 e5             	mov    %rsp,%rbp
+  80202b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80202f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802033:	bf 66 00 00 00       	mov    $0x66,%edi
+  802038:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 1e                	js     802066 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802048:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80204c:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802050:	48 85 d2             	test   %rdx,%rdx
+  802053:	74 13                	je     802068 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205a:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802063:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802066:	c9                   	leave
+  802067:	c3                   	ret
+        return -E_NOT_SUPP;
+  802068:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206d:	eb f7                	jmp    802066 <print_snapshot_list+0x3f>
+
+000000000080206f <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80206f:	55                   	push   %rbp
+  802070:	48 89 e5             	mov    %rsp,%rbp
+  802073:	53                   	push   %rbx
+  802074:	48 83 ec 18          	sub    $0x18,%rsp
+  802078:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80207b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80207f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802084:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	85 c0                	test   %eax,%eax
+  802092:	78 1c                	js     8020b0 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802094:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802098:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80209c:	48 85 c0             	test   %rax,%rax
+  80209f:	74 15                	je     8020b6 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8020a1:	48 89 df             	mov    %rbx,%rdi
+  8020a4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ad:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020b6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020bb:	eb f3                	jmp    8020b0 <accept_snapshot+0x41>
+
+00000000008020bd <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+  8020c1:	53                   	push   %rbx
+  8020c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c6:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020c9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020cd:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020d2:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 1c                	js     8020fe <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8020e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e6:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8020ea:	48 85 c0             	test   %rax,%rax
+  8020ed:	74 15                	je     802104 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8020ef:	48 89 df             	mov    %rbx,%rdi
+  8020f2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020f4:	85 c0                	test   %eax,%eax
+  8020f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+        return -E_NOT_SUPP;
+  802104:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802109:	eb f3                	jmp    8020fe <delete_snapshot+0x41>
+
+000000000080210b <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80210b:	55                   	push   %rbp
+  80210c:	48 89 e5             	mov    %rsp,%rbp
+  80210f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802113:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802117:	bf 66 00 00 00       	mov    $0x66,%edi
+  80211c:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 14                	js     802140 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80212c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802130:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802134:	48 85 d2             	test   %rdx,%rdx
+  802137:	74 09                	je     802142 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213e:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+        return -E_NOT_SUPP;
+  802142:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802147:	eb f7                	jmp    802140 <gc_snapshots+0x35>
+
+0000000000802149 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	41 56                	push   %r14
+  80214f:	41 55                	push   %r13
+  802151:	41 54                	push   %r12
+  802153:	53                   	push   %rbx
+  802154:	48 83 ec 10          	sub    $0x10,%rsp
+  802158:	48 89 fb             	mov    %rdi,%rbx
+  80215b:	49 89 f4             	mov    %rsi,%r12
+  80215e:	49 89 d5             	mov    %rdx,%r13
+  802161:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802164:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802168:	bf 66 00 00 00       	mov    $0x66,%edi
+  80216d:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+  802179:	85 c0                	test   %eax,%eax
+  80217b:	78 1b                	js     802198 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80217d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802181:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802185:	48 85 c0             	test   %rax,%rax
+  802188:	74 1b                	je     8021a5 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  80218a:	4c 89 f1             	mov    %r14,%rcx
+  80218d:	4c 89 ea             	mov    %r13,%rdx
+  802190:	4c 89 e6             	mov    %r12,%rsi
+  802193:	48 89 df             	mov    %rbx,%rdi
+  802196:	ff d0                	call   *%rax
+
+    return res;
+}
+  802198:	48 83 c4 10          	add    $0x10,%rsp
+  80219c:	5b                   	pop    %rbx
+  80219d:	41 5c                	pop    %r12
+  80219f:	41 5d                	pop    %r13
+  8021a1:	41 5e                	pop    %r14
+  8021a3:	5d                   	pop    %rbp
+  8021a4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021a5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021aa:	eb ec                	jmp    802198 <diff_snapshots+0x4f>
+
+00000000008021ac <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	41 55                	push   %r13
+  8021b2:	41 54                	push   %r12
+  8021b4:	53                   	push   %rbx
+  8021b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b9:	48 89 fb             	mov    %rdi,%rbx
+  8021bc:	49 89 f4             	mov    %rsi,%r12
+  8021bf:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021c2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021c6:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021cb:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 18                	js     8021f3 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8021db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021df:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8021e3:	48 85 c0             	test   %rax,%rax
+  8021e6:	74 16                	je     8021fe <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8021e8:	4c 89 ea             	mov    %r13,%rdx
+  8021eb:	4c 89 e6             	mov    %r12,%rsi
+  8021ee:	48 89 df             	mov    %rbx,%rdi
+  8021f1:	ff d0                	call   *%rax
+
+    return res;
+}
+  8021f3:	48 83 c4 18          	add    $0x18,%rsp
+  8021f7:	5b                   	pop    %rbx
+  8021f8:	41 5c                	pop    %r12
+  8021fa:	41 5d                	pop    %r13
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802203:	eb ee                	jmp    8021f3 <send_snapshot+0x47>
+
+0000000000802205 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	53                   	push   %rbx
+  80220a:	48 83 ec 18          	sub    $0x18,%rsp
+  80220e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802211:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802215:	bf 66 00 00 00       	mov    $0x66,%edi
+  80221a:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 12                	js     80223c <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80222a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80222e:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802232:	48 85 c0             	test   %rax,%rax
+  802235:	74 0b                	je     802242 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802237:	48 89 df             	mov    %rbx,%rdi
+  80223a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80223c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+        return -E_NOT_SUPP;
+  802242:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802247:	eb f3                	jmp    80223c <receive_snapshot+0x37>
+
+0000000000802249 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802251:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802255:	bf 66 00 00 00       	mov    $0x66,%edi
+  80225a:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 17                	js     802281 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80226a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80226e:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802275:	48 85 d2             	test   %rdx,%rdx
+  802278:	74 09                	je     802283 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80227a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227f:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+        return -E_NOT_SUPP;
+  802283:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802288:	eb f7                	jmp    802281 <free_space_bytes+0x38>
+
+000000000080228a <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80228a:	55                   	push   %rbp
+  80228b:	48 89 e5             	mov    %rsp,%rbp
+  80228e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802292:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802296:	bf 66 00 00 00       	mov    $0x66,%edi
+  80229b:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8022a2:	00 00 00 
+  8022a5:	ff d0                	call   *%rax
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	78 17                	js     8022c2 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8022ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022af:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8022b6:	48 85 d2             	test   %rdx,%rdx
+  8022b9:	74 09                	je     8022c4 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8022bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c0:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022c2:	c9                   	leave
+  8022c3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022c4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022c9:	eb f7                	jmp    8022c2 <busy_space_bytes+0x38>
+
+00000000008022cb <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8022cb:	55                   	push   %rbp
+  8022cc:	48 89 e5             	mov    %rsp,%rbp
+  8022cf:	41 54                	push   %r12
+  8022d1:	53                   	push   %rbx
+  8022d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d6:	89 fb                	mov    %edi,%ebx
+  8022d8:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022df:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022e4:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8022eb:	00 00 00 
+  8022ee:	ff d0                	call   *%rax
+  8022f0:	85 c0                	test   %eax,%eax
+  8022f2:	78 17                	js     80230b <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8022f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022f8:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8022ff:	48 85 c0             	test   %rax,%rax
+  802302:	74 10                	je     802314 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802304:	4c 89 e6             	mov    %r12,%rsi
+  802307:	89 df                	mov    %ebx,%edi
+  802309:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80230b:	48 83 c4 10          	add    $0x10,%rsp
+  80230f:	5b                   	pop    %rbx
+  802310:	41 5c                	pop    %r12
+  802312:	5d                   	pop    %rbp
+  802313:	c3                   	ret
+        return -E_NOT_SUPP;
+  802314:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802319:	eb f0                	jmp    80230b <snapshots_space+0x40>
+
+000000000080231b <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80231b:	55                   	push   %rbp
+  80231c:	48 89 e5             	mov    %rsp,%rbp
+  80231f:	41 55                	push   %r13
+  802321:	41 54                	push   %r12
+  802323:	53                   	push   %rbx
+  802324:	48 83 ec 08          	sub    $0x8,%rsp
+  802328:	41 89 fd             	mov    %edi,%r13d
+  80232b:	48 89 f3             	mov    %rsi,%rbx
+  80232e:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802331:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802338:	00 00 00 
+  80233b:	83 38 00             	cmpl   $0x0,(%rax)
+  80233e:	74 57                	je     802397 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802340:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802346:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80234b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802352:	00 00 00 
+  802355:	44 89 ee             	mov    %r13d,%esi
+  802358:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80235f:	00 00 00 
+  802362:	8b 38                	mov    (%rax),%edi
+  802364:	48 b8 98 37 80 00 00 	movabs $0x803798,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802375:	4c 89 e2             	mov    %r12,%rdx
+  802378:	48 89 de             	mov    %rbx,%rsi
+  80237b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802380:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  802387:	00 00 00 
+  80238a:	ff d0                	call   *%rax
+}
+  80238c:	48 83 c4 08          	add    $0x8,%rsp
+  802390:	5b                   	pop    %rbx
+  802391:	41 5c                	pop    %r12
+  802393:	41 5d                	pop    %r13
+  802395:	5d                   	pop    %rbp
+  802396:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802397:	bf 03 00 00 00       	mov    $0x3,%edi
+  80239c:	48 b8 56 38 80 00 00 	movabs $0x803856,%rax
+  8023a3:	00 00 00 
+  8023a6:	ff d0                	call   *%rax
+  8023a8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023af:	00 00 
+  8023b1:	eb 8d                	jmp    802340 <fsipc_region+0x25>
+
+00000000008023b3 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8023b3:	55                   	push   %rbp
+  8023b4:	48 89 e5             	mov    %rsp,%rbp
+  8023b7:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8023bb:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8023c2:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8023c3:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8023c7:	48 b8 1b 23 80 00 00 	movabs $0x80231b,%rax
+  8023ce:	00 00 00 
+  8023d1:	ff d0                	call   *%rax
+}
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+
+00000000008023d5 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8023d5:	85 ff                	test   %edi,%edi
+  8023d7:	78 6d                	js     802446 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8023d9:	55                   	push   %rbp
+  8023da:	48 89 e5             	mov    %rsp,%rbp
+  8023dd:	41 54                	push   %r12
+  8023df:	53                   	push   %rbx
+  8023e0:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8023e3:	48 85 f6             	test   %rsi,%rsi
+  8023e6:	74 57                	je     80243f <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8023e8:	89 f8                	mov    %edi,%eax
+  8023ea:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023f1:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8023f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f8:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023fd:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802404:	00 00 00 
+  802407:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	78 2d                	js     80243a <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80240d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802414:	00 00 00 
+  802417:	49 63 14 24          	movslq (%r12),%rdx
+  80241b:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802422:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802427:	48 89 df             	mov    %rbx,%rdi
+  80242a:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802436:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80243a:	5b                   	pop    %rbx
+  80243b:	41 5c                	pop    %r12
+  80243d:	5d                   	pop    %rbp
+  80243e:	c3                   	ret
+        return -E_INVAL;
+  80243f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802444:	eb f4                	jmp    80243a <devfile_df_snapshots+0x65>
+  802446:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80244b:	c3                   	ret
+
+000000000080244c <devfile_df_busy>:
+devfile_df_busy() {
+  80244c:	55                   	push   %rbp
+  80244d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802450:	be 00 00 00 00       	mov    $0x0,%esi
+  802455:	bf 11 00 00 00       	mov    $0x11,%edi
+  80245a:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+}
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+
+0000000000802468 <devfile_df_free>:
+devfile_df_free() {
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80246c:	be 00 00 00 00       	mov    $0x0,%esi
+  802471:	bf 10 00 00 00       	mov    $0x10,%edi
+  802476:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+}
+  802482:	5d                   	pop    %rbp
+  802483:	c3                   	ret
+
+0000000000802484 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802484:	55                   	push   %rbp
+  802485:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802488:	be 00 00 00 00       	mov    $0x0,%esi
+  80248d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802492:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+}
+  80249e:	5d                   	pop    %rbp
+  80249f:	c3                   	ret
+
+00000000008024a0 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8024a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a9:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024ae:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8024b5:	00 00 00 
+  8024b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8024c4:	5d                   	pop    %rbp
+  8024c5:	c3                   	ret
+
+00000000008024c6 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8024c6:	55                   	push   %rbp
+  8024c7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8024ca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024d1:	00 00 00 
+  8024d4:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8024d7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8024d9:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8024dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024e6:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+}
+  8024f2:	5d                   	pop    %rbp
+  8024f3:	c3                   	ret
+
+00000000008024f4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8024f4:	55                   	push   %rbp
+  8024f5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8024f8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024fb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802502:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802504:	be 00 00 00 00       	mov    $0x0,%esi
+  802509:	bf 06 00 00 00       	mov    $0x6,%edi
+  80250e:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+}
+  80251a:	5d                   	pop    %rbp
+  80251b:	c3                   	ret
+
+000000000080251c <devfile_write>:
+    if (!fd || !buf) {
+  80251c:	48 85 ff             	test   %rdi,%rdi
+  80251f:	0f 84 c1 00 00 00    	je     8025e6 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802525:	55                   	push   %rbp
+  802526:	48 89 e5             	mov    %rsp,%rbp
+  802529:	41 57                	push   %r15
+  80252b:	41 56                	push   %r14
+  80252d:	41 55                	push   %r13
+  80252f:	41 54                	push   %r12
+  802531:	53                   	push   %rbx
+  802532:	48 83 ec 18          	sub    $0x18,%rsp
+  802536:	49 89 ff             	mov    %rdi,%r15
+  802539:	49 89 f5             	mov    %rsi,%r13
+  80253c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80253f:	48 85 f6             	test   %rsi,%rsi
+  802542:	0f 84 95 00 00 00    	je     8025dd <devfile_write+0xc1>
+    while (n) {
+  802548:	48 85 d2             	test   %rdx,%rdx
+  80254b:	0f 84 83 00 00 00    	je     8025d4 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802551:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802558:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80255f:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802562:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802567:	49 39 dc             	cmp    %rbx,%r12
+  80256a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80256e:	48 89 da             	mov    %rbx,%rdx
+  802571:	4c 89 ee             	mov    %r13,%rsi
+  802574:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80257b:	00 00 00 
+  80257e:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80258a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80258e:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802591:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802595:	be 00 00 00 00       	mov    $0x0,%esi
+  80259a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80259f:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+        if (write < 0) {
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	78 21                	js     8025d0 <devfile_write+0xb4>
+        buf += write;
+  8025af:	48 63 d0             	movslq %eax,%rdx
+  8025b2:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8025b5:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8025b8:	49 29 d4             	sub    %rdx,%r12
+  8025bb:	75 a5                	jne    802562 <devfile_write+0x46>
+    return totalWrite;
+  8025bd:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8025c1:	48 83 c4 18          	add    $0x18,%rsp
+  8025c5:	5b                   	pop    %rbx
+  8025c6:	41 5c                	pop    %r12
+  8025c8:	41 5d                	pop    %r13
+  8025ca:	41 5e                	pop    %r14
+  8025cc:	41 5f                	pop    %r15
+  8025ce:	5d                   	pop    %rbp
+  8025cf:	c3                   	ret
+            return write;
+  8025d0:	48 98                	cltq
+  8025d2:	eb ed                	jmp    8025c1 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8025d4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8025db:	eb e0                	jmp    8025bd <devfile_write+0xa1>
+        return -E_INVAL;
+  8025dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025e4:	eb db                	jmp    8025c1 <devfile_write+0xa5>
+  8025e6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025ed:	c3                   	ret
+
+00000000008025ee <devfile_read>:
+    if (!fd || !buf) {
+  8025ee:	48 85 ff             	test   %rdi,%rdi
+  8025f1:	0f 84 c0 00 00 00    	je     8026b7 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	41 57                	push   %r15
+  8025fd:	41 56                	push   %r14
+  8025ff:	41 55                	push   %r13
+  802601:	41 54                	push   %r12
+  802603:	53                   	push   %rbx
+  802604:	48 83 ec 18          	sub    $0x18,%rsp
+  802608:	49 89 ff             	mov    %rdi,%r15
+  80260b:	49 89 f5             	mov    %rsi,%r13
+  80260e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802611:	48 85 f6             	test   %rsi,%rsi
+  802614:	0f 84 96 00 00 00    	je     8026b0 <devfile_read+0xc2>
+    while (n) {
+  80261a:	48 85 d2             	test   %rdx,%rdx
+  80261d:	0f 84 87 00 00 00    	je     8026aa <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802623:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80262a:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80262b:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802632:	00 00 00 
+  802635:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802639:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80263c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802641:	49 39 c4             	cmp    %rax,%r12
+  802644:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802648:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80264c:	be 00 00 00 00       	mov    $0x0,%esi
+  802651:	bf 03 00 00 00       	mov    $0x3,%edi
+  802656:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  80265d:	00 00 00 
+  802660:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802662:	85 c0                	test   %eax,%eax
+  802664:	7e 37                	jle    80269d <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802666:	48 63 d8             	movslq %eax,%rbx
+  802669:	48 89 da             	mov    %rbx,%rdx
+  80266c:	4c 89 f6             	mov    %r14,%rsi
+  80266f:	4c 89 ef             	mov    %r13,%rdi
+  802672:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+        buf += read;
+  80267e:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802681:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802685:	49 29 dc             	sub    %rbx,%r12
+  802688:	75 ab                	jne    802635 <devfile_read+0x47>
+  return totalRead;
+  80268a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80268e:	48 83 c4 18          	add    $0x18,%rsp
+  802692:	5b                   	pop    %rbx
+  802693:	41 5c                	pop    %r12
+  802695:	41 5d                	pop    %r13
+  802697:	41 5e                	pop    %r14
+  802699:	41 5f                	pop    %r15
+  80269b:	5d                   	pop    %rbp
+  80269c:	c3                   	ret
+            return read ? read : totalRead;
+  80269d:	48 63 d0             	movslq %eax,%rdx
+  8026a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026a4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8026a8:	eb e4                	jmp    80268e <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8026aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026ae:	eb da                	jmp    80268a <devfile_read+0x9c>
+        return E_INVAL;
+  8026b0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026b5:	eb d7                	jmp    80268e <devfile_read+0xa0>
+  8026b7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8026bc:	c3                   	ret
+
+00000000008026bd <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026bd:	48 85 ff             	test   %rdi,%rdi
+  8026c0:	74 5f                	je     802721 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8026c2:	55                   	push   %rbp
+  8026c3:	48 89 e5             	mov    %rsp,%rbp
+  8026c6:	53                   	push   %rbx
+  8026c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cb:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8026ce:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  8026d5:	00 00 00 
+  8026d8:	ff d0                	call   *%rax
+  8026da:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8026e0:	77 45                	ja     802727 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8026e2:	48 89 de             	mov    %rbx,%rsi
+  8026e5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8026ec:	00 00 00 
+  8026ef:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8026fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802700:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802705:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  80270c:	00 00 00 
+  80270f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802711:	85 c0                	test   %eax,%eax
+  802713:	ba 00 00 00 00       	mov    $0x0,%edx
+  802718:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80271b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271f:	c9                   	leave
+  802720:	c3                   	ret
+        return -E_INVAL;
+  802721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802726:	c3                   	ret
+        return -E_INVAL;
+  802727:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272c:	eb ed                	jmp    80271b <devfile_receive_snapshot+0x5e>
+
+000000000080272e <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80272e:	55                   	push   %rbp
+  80272f:	48 89 e5             	mov    %rsp,%rbp
+  802732:	41 55                	push   %r13
+  802734:	41 54                	push   %r12
+  802736:	53                   	push   %rbx
+  802737:	48 83 ec 08          	sub    $0x8,%rsp
+  80273b:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80273e:	48 85 f6             	test   %rsi,%rsi
+  802741:	0f 94 c0             	sete   %al
+  802744:	48 85 d2             	test   %rdx,%rdx
+  802747:	0f 94 c2             	sete   %dl
+  80274a:	08 d0                	or     %dl,%al
+  80274c:	0f 85 ad 00 00 00    	jne    8027ff <devfile_send_snapshot+0xd1>
+  802752:	48 89 fb             	mov    %rdi,%rbx
+  802755:	49 89 f4             	mov    %rsi,%r12
+  802758:	48 85 ff             	test   %rdi,%rdi
+  80275b:	0f 84 9e 00 00 00    	je     8027ff <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802761:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802773:	0f 87 8d 00 00 00    	ja     802806 <devfile_send_snapshot+0xd8>
+  802779:	4c 89 e7             	mov    %r12,%rdi
+  80277c:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802783:	00 00 00 
+  802786:	ff d0                	call   *%rax
+  802788:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80278e:	77 7d                	ja     80280d <devfile_send_snapshot+0xdf>
+  802790:	4c 89 ef             	mov    %r13,%rdi
+  802793:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027a5:	77 6d                	ja     802814 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8027a7:	48 89 de             	mov    %rbx,%rsi
+  8027aa:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027b1:	00 00 00 
+  8027b4:	48 bb 9d 0c 80 00 00 	movabs $0x800c9d,%rbx
+  8027bb:	00 00 00 
+  8027be:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8027c0:	4c 89 e6             	mov    %r12,%rsi
+  8027c3:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8027ca:	00 00 00 
+  8027cd:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8027cf:	4c 89 ee             	mov    %r13,%rsi
+  8027d2:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8027d9:	00 00 00 
+  8027dc:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8027de:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027e8:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8027ef:	00 00 00 
+  8027f2:	ff d0                	call   *%rax
+}
+  8027f4:	48 83 c4 08          	add    $0x8,%rsp
+  8027f8:	5b                   	pop    %rbx
+  8027f9:	41 5c                	pop    %r12
+  8027fb:	41 5d                	pop    %r13
+  8027fd:	5d                   	pop    %rbp
+  8027fe:	c3                   	ret
+        return -E_INVAL;
+  8027ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802804:	eb ee                	jmp    8027f4 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802806:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80280b:	eb e7                	jmp    8027f4 <devfile_send_snapshot+0xc6>
+  80280d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802812:	eb e0                	jmp    8027f4 <devfile_send_snapshot+0xc6>
+  802814:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802819:	eb d9                	jmp    8027f4 <devfile_send_snapshot+0xc6>
+
+000000000080281b <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80281b:	48 85 ff             	test   %rdi,%rdi
+  80281e:	0f 84 41 01 00 00    	je     802965 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	41 57                	push   %r15
+  80282a:	41 56                	push   %r14
+  80282c:	41 55                	push   %r13
+  80282e:	41 54                	push   %r12
+  802830:	53                   	push   %rbx
+  802831:	48 83 ec 08          	sub    $0x8,%rsp
+  802835:	49 89 fc             	mov    %rdi,%r12
+  802838:	49 89 f5             	mov    %rsi,%r13
+  80283b:	48 89 d3             	mov    %rdx,%rbx
+  80283e:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802841:	48 85 f6             	test   %rsi,%rsi
+  802844:	0f 84 ff 00 00 00    	je     802949 <devfile_diff_snapshots+0x12e>
+  80284a:	48 85 d2             	test   %rdx,%rdx
+  80284d:	0f 84 fd 00 00 00    	je     802950 <devfile_diff_snapshots+0x135>
+  802853:	48 85 c9             	test   %rcx,%rcx
+  802856:	0f 84 f4 00 00 00    	je     802950 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80285c:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802863:	00 00 00 
+  802866:	ff d0                	call   *%rax
+  802868:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80286e:	0f 87 e3 00 00 00    	ja     802957 <devfile_diff_snapshots+0x13c>
+  802874:	4c 89 ef             	mov    %r13,%rdi
+  802877:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+  802883:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802889:	0f 87 cf 00 00 00    	ja     80295e <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80288f:	4c 89 e6             	mov    %r12,%rsi
+  802892:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802899:	00 00 00 
+  80289c:	4c 89 e7             	mov    %r12,%rdi
+  80289f:	49 bf 9d 0c 80 00 00 	movabs $0x800c9d,%r15
+  8028a6:	00 00 00 
+  8028a9:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8028ac:	4c 89 ee             	mov    %r13,%rsi
+  8028af:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8028b6:	00 
+  8028b7:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8028ba:	48 8b 03             	mov    (%rbx),%rax
+  8028bd:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8028c4:	00 
+  8028c5:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8028c9:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8028d0:	00 
+  8028d1:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8028d5:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8028dc:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8028dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028e7:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 43                	js     80293a <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8028f7:	49 8b 04 24          	mov    (%r12),%rax
+  8028fb:	48 89 03             	mov    %rax,(%rbx)
+  8028fe:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802903:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802907:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  80290c:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802910:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802915:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802919:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80291d:	48 c1 e2 03          	shl    $0x3,%rdx
+  802921:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802926:	4c 89 f7             	mov    %r14,%rdi
+  802929:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802935:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80293a:	48 83 c4 08          	add    $0x8,%rsp
+  80293e:	5b                   	pop    %rbx
+  80293f:	41 5c                	pop    %r12
+  802941:	41 5d                	pop    %r13
+  802943:	41 5e                	pop    %r14
+  802945:	41 5f                	pop    %r15
+  802947:	5d                   	pop    %rbp
+  802948:	c3                   	ret
+        return -E_INVAL;
+  802949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80294e:	eb ea                	jmp    80293a <devfile_diff_snapshots+0x11f>
+  802950:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802955:	eb e3                	jmp    80293a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802957:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80295c:	eb dc                	jmp    80293a <devfile_diff_snapshots+0x11f>
+  80295e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802963:	eb d5                	jmp    80293a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802965:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80296a:	c3                   	ret
+
+000000000080296b <devfile_delete_snapshot>:
+    if (!name) {
+  80296b:	48 85 ff             	test   %rdi,%rdi
+  80296e:	74 5f                	je     8029cf <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802970:	55                   	push   %rbp
+  802971:	48 89 e5             	mov    %rsp,%rbp
+  802974:	53                   	push   %rbx
+  802975:	48 83 ec 08          	sub    $0x8,%rsp
+  802979:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80297c:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80298e:	77 45                	ja     8029d5 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802990:	48 89 de             	mov    %rbx,%rsi
+  802993:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80299a:	00 00 00 
+  80299d:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  8029a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ae:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8029b3:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8029ba:	00 00 00 
+  8029bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+        return -E_INVAL;
+  8029cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029d4:	c3                   	ret
+        return -E_INVAL;
+  8029d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029da:	eb ed                	jmp    8029c9 <devfile_delete_snapshot+0x5e>
+
+00000000008029dc <devfile_accept_snapshot>:
+    if (!name) {
+  8029dc:	48 85 ff             	test   %rdi,%rdi
+  8029df:	74 5f                	je     802a40 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8029e1:	55                   	push   %rbp
+  8029e2:	48 89 e5             	mov    %rsp,%rbp
+  8029e5:	53                   	push   %rbx
+  8029e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ea:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029ed:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+  8029f9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8029ff:	77 45                	ja     802a46 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802a01:	48 89 de             	mov    %rbx,%rsi
+  802a04:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802a0b:	00 00 00 
+  802a0e:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802a1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a1f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a24:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a37:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3e:	c9                   	leave
+  802a3f:	c3                   	ret
+        return -E_INVAL;
+  802a40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a45:	c3                   	ret
+        return -E_INVAL;
+  802a46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a4b:	eb ed                	jmp    802a3a <devfile_accept_snapshot+0x5e>
+
+0000000000802a4d <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802a4d:	48 85 ff             	test   %rdi,%rdi
+  802a50:	0f 84 9f 00 00 00    	je     802af5 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802a56:	55                   	push   %rbp
+  802a57:	48 89 e5             	mov    %rsp,%rbp
+  802a5a:	41 54                	push   %r12
+  802a5c:	53                   	push   %rbx
+  802a5d:	48 89 fb             	mov    %rdi,%rbx
+  802a60:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802a63:	48 85 f6             	test   %rsi,%rsi
+  802a66:	74 78                	je     802ae0 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802a68:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+  802a74:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a7a:	77 6b                	ja     802ae7 <devfile_create_snapshot+0x9a>
+  802a7c:	4c 89 e7             	mov    %r12,%rdi
+  802a7f:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802a86:	00 00 00 
+  802a89:	ff d0                	call   *%rax
+  802a8b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a91:	77 5b                	ja     802aee <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802a93:	48 89 de             	mov    %rbx,%rsi
+  802a96:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802a9d:	00 00 00 
+  802aa0:	48 bb 9d 0c 80 00 00 	movabs $0x800c9d,%rbx
+  802aa7:	00 00 00 
+  802aaa:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802aac:	4c 89 e6             	mov    %r12,%rsi
+  802aaf:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802ab6:	00 00 00 
+  802ab9:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802abb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac0:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ac5:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802acc:	00 00 00 
+  802acf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802adb:	5b                   	pop    %rbx
+  802adc:	41 5c                	pop    %r12
+  802ade:	5d                   	pop    %rbp
+  802adf:	c3                   	ret
+        return -E_INVAL;
+  802ae0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae5:	eb f4                	jmp    802adb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aec:	eb ed                	jmp    802adb <devfile_create_snapshot+0x8e>
+  802aee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af3:	eb e6                	jmp    802adb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802af5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802afa:	c3                   	ret
+
+0000000000802afb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802afb:	55                   	push   %rbp
+  802afc:	48 89 e5             	mov    %rsp,%rbp
+  802aff:	41 54                	push   %r12
+  802b01:	53                   	push   %rbx
+  802b02:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b05:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b08:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802b0f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b11:	be 00 00 00 00       	mov    $0x0,%esi
+  802b16:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b1b:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	78 3d                	js     802b68 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b2b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802b32:	00 00 00 
+  802b35:	4c 89 e6             	mov    %r12,%rsi
+  802b38:	48 89 df             	mov    %rbx,%rdi
+  802b3b:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  802b42:	00 00 00 
+  802b45:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b47:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b4e:	00 
+  802b4f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b55:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b5c:	00 
+  802b5d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b68:	5b                   	pop    %rbx
+  802b69:	41 5c                	pop    %r12
+  802b6b:	5d                   	pop    %rbp
+  802b6c:	c3                   	ret
+
+0000000000802b6d <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802b6d:	55                   	push   %rbp
+  802b6e:	48 89 e5             	mov    %rsp,%rbp
+  802b71:	41 57                	push   %r15
+  802b73:	41 56                	push   %r14
+  802b75:	41 55                	push   %r13
+  802b77:	41 54                	push   %r12
+  802b79:	53                   	push   %rbx
+  802b7a:	48 83 ec 38          	sub    $0x38,%rsp
+  802b7e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802b82:	49 89 f5             	mov    %rsi,%r13
+  802b85:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b88:	48 89 f0             	mov    %rsi,%rax
+  802b8b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b90:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b94:	75 4f                	jne    802be5 <devfile_readmap+0x78>
+  802b96:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b9a:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ba0:	75 1f                	jne    802bc1 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802ba2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ba6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802baa:	49 be 55 33 80 00 00 	movabs $0x803355,%r14
+  802bb1:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802bb4:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802bbb:	0f 87 9d 00 00 00    	ja     802c5e <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802bc1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bc5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802bc9:	4d 85 ff             	test   %r15,%r15
+  802bcc:	0f 85 cf 00 00 00    	jne    802ca1 <devfile_readmap+0x134>
+  802bd2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802bd6:	48 83 c4 38          	add    $0x38,%rsp
+  802bda:	5b                   	pop    %rbx
+  802bdb:	41 5c                	pop    %r12
+  802bdd:	41 5d                	pop    %r13
+  802bdf:	41 5e                	pop    %r14
+  802be1:	41 5f                	pop    %r15
+  802be3:	5d                   	pop    %rbp
+  802be4:	c3                   	ret
+    size_t totalRead = 0;
+  802be5:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802bec:	00 
+  802bed:	eb da                	jmp    802bc9 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bef:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bf3:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bf6:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  802bfd:	00 00 00 
+  802c00:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802c02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c06:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802c0a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c0e:	4c 89 ee             	mov    %r13,%rsi
+  802c11:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c16:	48 b8 1b 23 80 00 00 	movabs $0x80231b,%rax
+  802c1d:	00 00 00 
+  802c20:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	7e a3                	jle    802bc9 <devfile_readmap+0x5c>
+  802c26:	48 98                	cltq
+  802c28:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c2c:	72 9b                	jb     802bc9 <devfile_readmap+0x5c>
+        buf += read;
+  802c2e:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802c31:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802c34:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c38:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802c3f:	75 88                	jne    802bc9 <devfile_readmap+0x5c>
+  802c41:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c45:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c4b:	0f 85 78 ff ff ff    	jne    802bc9 <devfile_readmap+0x5c>
+  802c51:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802c58:	0f 86 6b ff ff ff    	jbe    802bc9 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802c5e:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802c64:	4d 39 e7             	cmp    %r12,%r15
+  802c67:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802c6b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802c72:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c76:	0f 84 73 ff ff ff    	je     802bef <devfile_readmap+0x82>
+  802c7c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c80:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802c85:	41 ff d6             	call   *%r14
+  802c88:	a8 40                	test   $0x40,%al
+  802c8a:	0f 85 39 ff ff ff    	jne    802bc9 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802c90:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c97:	4c 39 e3             	cmp    %r12,%rbx
+  802c9a:	72 e4                	jb     802c80 <devfile_readmap+0x113>
+  802c9c:	e9 4e ff ff ff       	jmp    802bef <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ca1:	4c 89 fa             	mov    %r15,%rdx
+  802ca4:	4c 89 ee             	mov    %r13,%rsi
+  802ca7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802cab:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  802cb2:	00 00 00 
+  802cb5:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802cb7:	48 85 c0             	test   %rax,%rax
+  802cba:	78 0c                	js     802cc8 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802cbc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cc0:	48 01 f0             	add    %rsi,%rax
+  802cc3:	e9 0e ff ff ff       	jmp    802bd6 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802cc8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ccc:	48 85 f6             	test   %rsi,%rsi
+  802ccf:	48 0f 45 c6          	cmovne %rsi,%rax
+  802cd3:	e9 fe fe ff ff       	jmp    802bd6 <devfile_readmap+0x69>
+
+0000000000802cd8 <open>:
+open(const char *path, int mode) {
+  802cd8:	55                   	push   %rbp
+  802cd9:	48 89 e5             	mov    %rsp,%rbp
+  802cdc:	41 55                	push   %r13
+  802cde:	41 54                	push   %r12
+  802ce0:	53                   	push   %rbx
+  802ce1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce5:	49 89 fc             	mov    %rdi,%r12
+  802ce8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ceb:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+  802cf7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cfd:	0f 87 8a 00 00 00    	ja     802d8d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d03:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d07:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+  802d13:	89 c3                	mov    %eax,%ebx
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	78 50                	js     802d69 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d19:	4c 89 e6             	mov    %r12,%rsi
+  802d1c:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802d23:	00 00 00 
+  802d26:	48 89 df             	mov    %rbx,%rdi
+  802d29:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  802d30:	00 00 00 
+  802d33:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d35:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802d3c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d40:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d45:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+  802d51:	89 c3                	mov    %eax,%ebx
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	78 1f                	js     802d76 <open+0x9e>
+    return fd2num(fd);
+  802d57:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d5b:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  802d62:	00 00 00 
+  802d65:	ff d0                	call   *%rax
+  802d67:	89 c3                	mov    %eax,%ebx
+}
+  802d69:	89 d8                	mov    %ebx,%eax
+  802d6b:	48 83 c4 18          	add    $0x18,%rsp
+  802d6f:	5b                   	pop    %rbx
+  802d70:	41 5c                	pop    %r12
+  802d72:	41 5d                	pop    %r13
+  802d74:	5d                   	pop    %rbp
+  802d75:	c3                   	ret
+        fd_close(fd, 0);
+  802d76:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d7f:	48 b8 51 19 80 00 00 	movabs $0x801951,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+        return res;
+  802d8b:	eb dc                	jmp    802d69 <open+0x91>
+        return -E_BAD_PATH;
+  802d8d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d92:	eb d5                	jmp    802d69 <open+0x91>
+
+0000000000802d94 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802d94:	55                   	push   %rbp
+  802d95:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802d98:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802da2:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+}
+  802dae:	5d                   	pop    %rbp
+  802daf:	c3                   	ret
+
+0000000000802db0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+  802db4:	41 54                	push   %r12
+  802db6:	53                   	push   %rbx
+  802db7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802dba:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  802dc1:	00 00 00 
+  802dc4:	ff d0                	call   *%rax
+  802dc6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802dc9:	48 be 60 3f 80 00 00 	movabs $0x803f60,%rsi
+  802dd0:	00 00 00 
+  802dd3:	48 89 df             	mov    %rbx,%rdi
+  802dd6:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802de2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802de7:	41 2b 04 24          	sub    (%r12),%eax
+  802deb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802df1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802df8:	00 00 00 
+    stat->st_dev = &devpipe;
+  802dfb:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802e02:	00 00 00 
+  802e05:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e11:	5b                   	pop    %rbx
+  802e12:	41 5c                	pop    %r12
+  802e14:	5d                   	pop    %rbp
+  802e15:	c3                   	ret
+
+0000000000802e16 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802e16:	55                   	push   %rbp
+  802e17:	48 89 e5             	mov    %rsp,%rbp
+  802e1a:	41 54                	push   %r12
+  802e1c:	53                   	push   %rbx
+  802e1d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e25:	48 89 fe             	mov    %rdi,%rsi
+  802e28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e2d:	49 bc f5 13 80 00 00 	movabs $0x8013f5,%r12
+  802e34:	00 00 00 
+  802e37:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802e3a:	48 89 df             	mov    %rbx,%rdi
+  802e3d:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  802e44:	00 00 00 
+  802e47:	ff d0                	call   *%rax
+  802e49:	48 89 c6             	mov    %rax,%rsi
+  802e4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e56:	41 ff d4             	call   *%r12
+}
+  802e59:	5b                   	pop    %rbx
+  802e5a:	41 5c                	pop    %r12
+  802e5c:	5d                   	pop    %rbp
+  802e5d:	c3                   	ret
+
+0000000000802e5e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e5e:	55                   	push   %rbp
+  802e5f:	48 89 e5             	mov    %rsp,%rbp
+  802e62:	41 57                	push   %r15
+  802e64:	41 56                	push   %r14
+  802e66:	41 55                	push   %r13
+  802e68:	41 54                	push   %r12
+  802e6a:	53                   	push   %rbx
+  802e6b:	48 83 ec 18          	sub    $0x18,%rsp
+  802e6f:	49 89 fc             	mov    %rdi,%r12
+  802e72:	49 89 f5             	mov    %rsi,%r13
+  802e75:	49 89 d7             	mov    %rdx,%r15
+  802e78:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e7c:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802e88:	4d 85 ff             	test   %r15,%r15
+  802e8b:	0f 84 af 00 00 00    	je     802f40 <devpipe_write+0xe2>
+  802e91:	48 89 c3             	mov    %rax,%rbx
+  802e94:	4c 89 f8             	mov    %r15,%rax
+  802e97:	4d 89 ef             	mov    %r13,%r15
+  802e9a:	4c 01 e8             	add    %r13,%rax
+  802e9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ea1:	49 bd fd 12 80 00 00 	movabs $0x8012fd,%r13
+  802ea8:	00 00 00 
+            sys_yield();
+  802eab:	49 be 9a 12 80 00 00 	movabs $0x80129a,%r14
+  802eb2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802eb5:	8b 73 04             	mov    0x4(%rbx),%esi
+  802eb8:	48 63 ce             	movslq %esi,%rcx
+  802ebb:	48 63 03             	movslq (%rbx),%rax
+  802ebe:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ec4:	48 39 c1             	cmp    %rax,%rcx
+  802ec7:	72 2e                	jb     802ef7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ec9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ece:	48 89 da             	mov    %rbx,%rdx
+  802ed1:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ed6:	4c 89 e7             	mov    %r12,%rdi
+  802ed9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802edc:	85 c0                	test   %eax,%eax
+  802ede:	74 66                	je     802f46 <devpipe_write+0xe8>
+            sys_yield();
+  802ee0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802ee3:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ee6:	48 63 ce             	movslq %esi,%rcx
+  802ee9:	48 63 03             	movslq (%rbx),%rax
+  802eec:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ef2:	48 39 c1             	cmp    %rax,%rcx
+  802ef5:	73 d2                	jae    802ec9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ef7:	41 0f b6 3f          	movzbl (%r15),%edi
+  802efb:	48 89 ca             	mov    %rcx,%rdx
+  802efe:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f02:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f09:	08 10 20 
+  802f0c:	48 f7 e2             	mul    %rdx
+  802f0f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f13:	48 89 d0             	mov    %rdx,%rax
+  802f16:	48 c1 e0 09          	shl    $0x9,%rax
+  802f1a:	48 29 d0             	sub    %rdx,%rax
+  802f1d:	48 c1 e0 03          	shl    $0x3,%rax
+  802f21:	48 29 c1             	sub    %rax,%rcx
+  802f24:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802f29:	83 c6 01             	add    $0x1,%esi
+  802f2c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f2f:	49 83 c7 01          	add    $0x1,%r15
+  802f33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f37:	49 39 c7             	cmp    %rax,%r15
+  802f3a:	0f 85 75 ff ff ff    	jne    802eb5 <devpipe_write+0x57>
+    return n;
+  802f40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f44:	eb 05                	jmp    802f4b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f4b:	48 83 c4 18          	add    $0x18,%rsp
+  802f4f:	5b                   	pop    %rbx
+  802f50:	41 5c                	pop    %r12
+  802f52:	41 5d                	pop    %r13
+  802f54:	41 5e                	pop    %r14
+  802f56:	41 5f                	pop    %r15
+  802f58:	5d                   	pop    %rbp
+  802f59:	c3                   	ret
+
+0000000000802f5a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f5a:	55                   	push   %rbp
+  802f5b:	48 89 e5             	mov    %rsp,%rbp
+  802f5e:	41 57                	push   %r15
+  802f60:	41 56                	push   %r14
+  802f62:	41 55                	push   %r13
+  802f64:	41 54                	push   %r12
+  802f66:	53                   	push   %rbx
+  802f67:	48 83 ec 18          	sub    $0x18,%rsp
+  802f6b:	49 89 fc             	mov    %rdi,%r12
+  802f6e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f72:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f76:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+  802f82:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802f85:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f8b:	49 bd fd 12 80 00 00 	movabs $0x8012fd,%r13
+  802f92:	00 00 00 
+            sys_yield();
+  802f95:	49 be 9a 12 80 00 00 	movabs $0x80129a,%r14
+  802f9c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802f9f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fa4:	74 7d                	je     803023 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802fa6:	8b 03                	mov    (%rbx),%eax
+  802fa8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802fab:	75 26                	jne    802fd3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802fad:	4d 85 ff             	test   %r15,%r15
+  802fb0:	75 77                	jne    803029 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fb2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fb7:	48 89 da             	mov    %rbx,%rdx
+  802fba:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fbf:	4c 89 e7             	mov    %r12,%rdi
+  802fc2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802fc5:	85 c0                	test   %eax,%eax
+  802fc7:	74 72                	je     80303b <devpipe_read+0xe1>
+            sys_yield();
+  802fc9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802fcc:	8b 03                	mov    (%rbx),%eax
+  802fce:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802fd1:	74 df                	je     802fb2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fd3:	48 63 c8             	movslq %eax,%rcx
+  802fd6:	48 89 ca             	mov    %rcx,%rdx
+  802fd9:	48 c1 ea 03          	shr    $0x3,%rdx
+  802fdd:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802fe4:	08 10 20 
+  802fe7:	48 89 d0             	mov    %rdx,%rax
+  802fea:	48 f7 e6             	mul    %rsi
+  802fed:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ff1:	48 89 d0             	mov    %rdx,%rax
+  802ff4:	48 c1 e0 09          	shl    $0x9,%rax
+  802ff8:	48 29 d0             	sub    %rdx,%rax
+  802ffb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803002:	00 
+  803003:	48 89 c8             	mov    %rcx,%rax
+  803006:	48 29 d0             	sub    %rdx,%rax
+  803009:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80300e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803012:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803016:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803019:	49 83 c7 01          	add    $0x1,%r15
+  80301d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803021:	75 83                	jne    802fa6 <devpipe_read+0x4c>
+    return n;
+  803023:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803027:	eb 03                	jmp    80302c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803029:	4c 89 f8             	mov    %r15,%rax
+}
+  80302c:	48 83 c4 18          	add    $0x18,%rsp
+  803030:	5b                   	pop    %rbx
+  803031:	41 5c                	pop    %r12
+  803033:	41 5d                	pop    %r13
+  803035:	41 5e                	pop    %r14
+  803037:	41 5f                	pop    %r15
+  803039:	5d                   	pop    %rbp
+  80303a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80303b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803040:	eb ea                	jmp    80302c <devpipe_read+0xd2>
+
+0000000000803042 <pipe>:
+pipe(int pfd[2]) {
+  803042:	55                   	push   %rbp
+  803043:	48 89 e5             	mov    %rsp,%rbp
+  803046:	41 55                	push   %r13
+  803048:	41 54                	push   %r12
+  80304a:	53                   	push   %rbx
+  80304b:	48 83 ec 18          	sub    $0x18,%rsp
+  80304f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803052:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803056:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  80305d:	00 00 00 
+  803060:	ff d0                	call   *%rax
+  803062:	89 c3                	mov    %eax,%ebx
+  803064:	85 c0                	test   %eax,%eax
+  803066:	0f 88 a0 01 00 00    	js     80320c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80306c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803071:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803076:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80307a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307f:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+  80308b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	0f 88 77 01 00 00    	js     80320c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803095:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803099:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  8030a0:	00 00 00 
+  8030a3:	ff d0                	call   *%rax
+  8030a5:	89 c3                	mov    %eax,%ebx
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	0f 88 43 01 00 00    	js     8031f2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030b9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c2:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  8030c9:	00 00 00 
+  8030cc:	ff d0                	call   *%rax
+  8030ce:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	0f 88 1a 01 00 00    	js     8031f2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8030d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030dc:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+  8030e8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8030eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f5:	48 89 c6             	mov    %rax,%rsi
+  8030f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fd:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  803104:	00 00 00 
+  803107:	ff d0                	call   *%rax
+  803109:	89 c3                	mov    %eax,%ebx
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	0f 88 c5 00 00 00    	js     8031d8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803113:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803117:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+  803123:	48 89 c1             	mov    %rax,%rcx
+  803126:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80312c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803132:	ba 00 00 00 00       	mov    $0x0,%edx
+  803137:	4c 89 ee             	mov    %r13,%rsi
+  80313a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313f:	48 b8 90 13 80 00 00 	movabs $0x801390,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	89 c3                	mov    %eax,%ebx
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	78 6e                	js     8031bf <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803151:	be 00 10 00 00       	mov    $0x1000,%esi
+  803156:	4c 89 ef             	mov    %r13,%rdi
+  803159:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  803160:	00 00 00 
+  803163:	ff d0                	call   *%rax
+  803165:	83 f8 02             	cmp    $0x2,%eax
+  803168:	0f 85 ab 00 00 00    	jne    803219 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80316e:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  803175:	00 00 
+  803177:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80317b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80317d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803181:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803188:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80318c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80318e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803192:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803199:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80319d:	48 bb 08 18 80 00 00 	movabs $0x801808,%rbx
+  8031a4:	00 00 00 
+  8031a7:	ff d3                	call   *%rbx
+  8031a9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8031ad:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8031b1:	ff d3                	call   *%rbx
+  8031b3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8031b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031bd:	eb 4d                	jmp    80320c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8031bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c4:	4c 89 ee             	mov    %r13,%rsi
+  8031c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cc:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  8031d3:	00 00 00 
+  8031d6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8031d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031dd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8031e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e6:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8031f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031f7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803200:	48 b8 f5 13 80 00 00 	movabs $0x8013f5,%rax
+  803207:	00 00 00 
+  80320a:	ff d0                	call   *%rax
+}
+  80320c:	89 d8                	mov    %ebx,%eax
+  80320e:	48 83 c4 18          	add    $0x18,%rsp
+  803212:	5b                   	pop    %rbx
+  803213:	41 5c                	pop    %r12
+  803215:	41 5d                	pop    %r13
+  803217:	5d                   	pop    %rbp
+  803218:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803219:	48 b9 90 3f 80 00 00 	movabs $0x803f90,%rcx
+  803220:	00 00 00 
+  803223:	48 ba 67 3f 80 00 00 	movabs $0x803f67,%rdx
+  80322a:	00 00 00 
+  80322d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803232:	48 bf 7c 3f 80 00 00 	movabs $0x803f7c,%rdi
+  803239:	00 00 00 
+  80323c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803241:	49 b8 28 02 80 00 00 	movabs $0x800228,%r8
+  803248:	00 00 00 
+  80324b:	41 ff d0             	call   *%r8
+
+000000000080324e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80324e:	55                   	push   %rbp
+  80324f:	48 89 e5             	mov    %rsp,%rbp
+  803252:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803256:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80325a:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 35                	js     80329f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80326a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80326e:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+  80327a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80327d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803282:	be 00 10 00 00       	mov    $0x1000,%esi
+  803287:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80328b:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+  803297:	85 c0                	test   %eax,%eax
+  803299:	0f 94 c0             	sete   %al
+  80329c:	0f b6 c0             	movzbl %al,%eax
+}
+  80329f:	c9                   	leave
+  8032a0:	c3                   	ret
+
+00000000008032a1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032a1:	48 89 f8             	mov    %rdi,%rax
+  8032a4:	48 c1 e8 27          	shr    $0x27,%rax
+  8032a8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032af:	01 00 00 
+  8032b2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032b6:	f6 c2 01             	test   $0x1,%dl
+  8032b9:	74 6d                	je     803328 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8032bb:	48 89 f8             	mov    %rdi,%rax
+  8032be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032c2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032c9:	01 00 00 
+  8032cc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032d0:	f6 c2 01             	test   $0x1,%dl
+  8032d3:	74 62                	je     803337 <get_uvpt_entry+0x96>
+  8032d5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032dc:	01 00 00 
+  8032df:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032e3:	f6 c2 80             	test   $0x80,%dl
+  8032e6:	75 4f                	jne    803337 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8032e8:	48 89 f8             	mov    %rdi,%rax
+  8032eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8032ef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8032f6:	01 00 00 
+  8032f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032fd:	f6 c2 01             	test   $0x1,%dl
+  803300:	74 44                	je     803346 <get_uvpt_entry+0xa5>
+  803302:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803309:	01 00 00 
+  80330c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803310:	f6 c2 80             	test   $0x80,%dl
+  803313:	75 31                	jne    803346 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803315:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803319:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803320:	01 00 00 
+  803323:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803327:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803328:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80332f:	01 00 00 
+  803332:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803336:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803337:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80333e:	01 00 00 
+  803341:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803345:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803346:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80334d:	01 00 00 
+  803350:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803354:	c3                   	ret
+
+0000000000803355 <get_prot>:
+
+int
+get_prot(void *va) {
+  803355:	55                   	push   %rbp
+  803356:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803359:	48 b8 a1 32 80 00 00 	movabs $0x8032a1,%rax
+  803360:	00 00 00 
+  803363:	ff d0                	call   *%rax
+  803365:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803368:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80336d:	89 c1                	mov    %eax,%ecx
+  80336f:	83 c9 04             	or     $0x4,%ecx
+  803372:	f6 c2 01             	test   $0x1,%dl
+  803375:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803378:	89 c1                	mov    %eax,%ecx
+  80337a:	83 c9 02             	or     $0x2,%ecx
+  80337d:	f6 c2 02             	test   $0x2,%dl
+  803380:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803383:	89 c1                	mov    %eax,%ecx
+  803385:	83 c9 01             	or     $0x1,%ecx
+  803388:	48 85 d2             	test   %rdx,%rdx
+  80338b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80338e:	89 c1                	mov    %eax,%ecx
+  803390:	83 c9 40             	or     $0x40,%ecx
+  803393:	f6 c6 04             	test   $0x4,%dh
+  803396:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803399:	5d                   	pop    %rbp
+  80339a:	c3                   	ret
+
+000000000080339b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80339b:	55                   	push   %rbp
+  80339c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80339f:	48 b8 a1 32 80 00 00 	movabs $0x8032a1,%rax
+  8033a6:	00 00 00 
+  8033a9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8033ab:	48 c1 e8 06          	shr    $0x6,%rax
+  8033af:	83 e0 01             	and    $0x1,%eax
+}
+  8033b2:	5d                   	pop    %rbp
+  8033b3:	c3                   	ret
+
+00000000008033b4 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8033b4:	55                   	push   %rbp
+  8033b5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033b8:	48 b8 a1 32 80 00 00 	movabs $0x8032a1,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8033c4:	48 c1 e8 05          	shr    $0x5,%rax
+  8033c8:	83 e0 01             	and    $0x1,%eax
+}
+  8033cb:	5d                   	pop    %rbp
+  8033cc:	c3                   	ret
+
+00000000008033cd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8033cd:	55                   	push   %rbp
+  8033ce:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8033d1:	48 b8 a1 32 80 00 00 	movabs $0x8032a1,%rax
+  8033d8:	00 00 00 
+  8033db:	ff d0                	call   *%rax
+  8033dd:	83 e0 01             	and    $0x1,%eax
+}
+  8033e0:	5d                   	pop    %rbp
+  8033e1:	c3                   	ret
+
+00000000008033e2 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8033e2:	55                   	push   %rbp
+  8033e3:	48 89 e5             	mov    %rsp,%rbp
+  8033e6:	41 57                	push   %r15
+  8033e8:	41 56                	push   %r14
+  8033ea:	41 55                	push   %r13
+  8033ec:	41 54                	push   %r12
+  8033ee:	53                   	push   %rbx
+  8033ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8033f3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033f7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8033fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803400:	49 bd cd 33 80 00 00 	movabs $0x8033cd,%r13
+  803407:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80340a:	49 bf 55 33 80 00 00 	movabs $0x803355,%r15
+  803411:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803414:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80341b:	00 00 00 
+  80341e:	eb 0c                	jmp    80342c <foreach_shared_region+0x4a>
+  803420:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803427:	4c 39 f3             	cmp    %r14,%rbx
+  80342a:	74 2e                	je     80345a <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80342c:	48 89 df             	mov    %rbx,%rdi
+  80342f:	41 ff d5             	call   *%r13
+  803432:	84 c0                	test   %al,%al
+  803434:	74 ea                	je     803420 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803436:	48 89 df             	mov    %rbx,%rdi
+  803439:	41 ff d7             	call   *%r15
+  80343c:	a8 40                	test   $0x40,%al
+  80343e:	74 e0                	je     803420 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803440:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803447:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80344b:	48 89 df             	mov    %rbx,%rdi
+  80344e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803452:	ff d0                	call   *%rax
+				if (res < 0) {
+  803454:	85 c0                	test   %eax,%eax
+  803456:	79 c8                	jns    803420 <foreach_shared_region+0x3e>
+  803458:	eb 05                	jmp    80345f <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80345a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345f:	48 83 c4 18          	add    $0x18,%rsp
+  803463:	5b                   	pop    %rbx
+  803464:	41 5c                	pop    %r12
+  803466:	41 5d                	pop    %r13
+  803468:	41 5e                	pop    %r14
+  80346a:	41 5f                	pop    %r15
+  80346c:	5d                   	pop    %rbp
+  80346d:	c3                   	ret
+
+000000000080346e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80346e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803473:	c3                   	ret
+
+0000000000803474 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803474:	55                   	push   %rbp
+  803475:	48 89 e5             	mov    %rsp,%rbp
+  803478:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80347b:	48 be b4 3f 80 00 00 	movabs $0x803fb4,%rsi
+  803482:	00 00 00 
+  803485:	48 b8 9d 0c 80 00 00 	movabs $0x800c9d,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+    return 0;
+}
+  803491:	b8 00 00 00 00       	mov    $0x0,%eax
+  803496:	5d                   	pop    %rbp
+  803497:	c3                   	ret
+
+0000000000803498 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803498:	55                   	push   %rbp
+  803499:	48 89 e5             	mov    %rsp,%rbp
+  80349c:	41 57                	push   %r15
+  80349e:	41 56                	push   %r14
+  8034a0:	41 55                	push   %r13
+  8034a2:	41 54                	push   %r12
+  8034a4:	53                   	push   %rbx
+  8034a5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8034ac:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8034b3:	48 85 d2             	test   %rdx,%rdx
+  8034b6:	74 7a                	je     803532 <devcons_write+0x9a>
+  8034b8:	49 89 d6             	mov    %rdx,%r14
+  8034bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8034c1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8034c6:	49 bf 97 0e 80 00 00 	movabs $0x800e97,%r15
+  8034cd:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8034d0:	4c 89 f3             	mov    %r14,%rbx
+  8034d3:	48 29 f3             	sub    %rsi,%rbx
+  8034d6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034db:	48 39 c3             	cmp    %rax,%rbx
+  8034de:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8034e2:	4c 63 eb             	movslq %ebx,%r13
+  8034e5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8034ec:	48 01 c6             	add    %rax,%rsi
+  8034ef:	4c 89 ea             	mov    %r13,%rdx
+  8034f2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8034f9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8034fc:	4c 89 ee             	mov    %r13,%rsi
+  8034ff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803506:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803512:	41 01 dc             	add    %ebx,%r12d
+  803515:	49 63 f4             	movslq %r12d,%rsi
+  803518:	4c 39 f6             	cmp    %r14,%rsi
+  80351b:	72 b3                	jb     8034d0 <devcons_write+0x38>
+    return res;
+  80351d:	49 63 c4             	movslq %r12d,%rax
+}
+  803520:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803527:	5b                   	pop    %rbx
+  803528:	41 5c                	pop    %r12
+  80352a:	41 5d                	pop    %r13
+  80352c:	41 5e                	pop    %r14
+  80352e:	41 5f                	pop    %r15
+  803530:	5d                   	pop    %rbp
+  803531:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803532:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803538:	eb e3                	jmp    80351d <devcons_write+0x85>
+
+000000000080353a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80353a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80353d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803542:	48 85 c0             	test   %rax,%rax
+  803545:	74 55                	je     80359c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803547:	55                   	push   %rbp
+  803548:	48 89 e5             	mov    %rsp,%rbp
+  80354b:	41 55                	push   %r13
+  80354d:	41 54                	push   %r12
+  80354f:	53                   	push   %rbx
+  803550:	48 83 ec 08          	sub    $0x8,%rsp
+  803554:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803557:	48 bb cd 11 80 00 00 	movabs $0x8011cd,%rbx
+  80355e:	00 00 00 
+  803561:	49 bc 9a 12 80 00 00 	movabs $0x80129a,%r12
+  803568:	00 00 00 
+  80356b:	eb 03                	jmp    803570 <devcons_read+0x36>
+  80356d:	41 ff d4             	call   *%r12
+  803570:	ff d3                	call   *%rbx
+  803572:	85 c0                	test   %eax,%eax
+  803574:	74 f7                	je     80356d <devcons_read+0x33>
+    if (c < 0) return c;
+  803576:	48 63 d0             	movslq %eax,%rdx
+  803579:	78 13                	js     80358e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80357b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803580:	83 f8 04             	cmp    $0x4,%eax
+  803583:	74 09                	je     80358e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803585:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803589:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80358e:	48 89 d0             	mov    %rdx,%rax
+  803591:	48 83 c4 08          	add    $0x8,%rsp
+  803595:	5b                   	pop    %rbx
+  803596:	41 5c                	pop    %r12
+  803598:	41 5d                	pop    %r13
+  80359a:	5d                   	pop    %rbp
+  80359b:	c3                   	ret
+  80359c:	48 89 d0             	mov    %rdx,%rax
+  80359f:	c3                   	ret
+
+00000000008035a0 <cputchar>:
+cputchar(int ch) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8035a8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8035ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8035b1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8035b5:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+}
+  8035c1:	c9                   	leave
+  8035c2:	c3                   	ret
+
+00000000008035c3 <getchar>:
+getchar(void) {
+  8035c3:	55                   	push   %rbp
+  8035c4:	48 89 e5             	mov    %rsp,%rbp
+  8035c7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8035cb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035d0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8035d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d9:	48 b8 79 1b 80 00 00 	movabs $0x801b79,%rax
+  8035e0:	00 00 00 
+  8035e3:	ff d0                	call   *%rax
+  8035e5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	78 06                	js     8035f1 <getchar+0x2e>
+  8035eb:	74 08                	je     8035f5 <getchar+0x32>
+  8035ed:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8035f1:	89 d0                	mov    %edx,%eax
+  8035f3:	c9                   	leave
+  8035f4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8035f5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8035fa:	eb f5                	jmp    8035f1 <getchar+0x2e>
+
+00000000008035fc <iscons>:
+iscons(int fdnum) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+  803600:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803604:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803608:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803614:	85 c0                	test   %eax,%eax
+  803616:	78 18                	js     803630 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803618:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80361c:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803623:	00 00 00 
+  803626:	8b 00                	mov    (%rax),%eax
+  803628:	39 02                	cmp    %eax,(%rdx)
+  80362a:	0f 94 c0             	sete   %al
+  80362d:	0f b6 c0             	movzbl %al,%eax
+}
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+
+0000000000803632 <opencons>:
+opencons(void) {
+  803632:	55                   	push   %rbp
+  803633:	48 89 e5             	mov    %rsp,%rbp
+  803636:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80363a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80363e:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  803645:	00 00 00 
+  803648:	ff d0                	call   *%rax
+  80364a:	85 c0                	test   %eax,%eax
+  80364c:	78 49                	js     803697 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80364e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803653:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803658:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80365c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803661:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+  80366d:	85 c0                	test   %eax,%eax
+  80366f:	78 26                	js     803697 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803671:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803675:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80367c:	00 00 
+  80367e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803680:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803684:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80368b:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+}
+  803697:	c9                   	leave
+  803698:	c3                   	ret
+
+0000000000803699 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803699:	55                   	push   %rbp
+  80369a:	48 89 e5             	mov    %rsp,%rbp
+  80369d:	41 55                	push   %r13
+  80369f:	41 54                	push   %r12
+  8036a1:	53                   	push   %rbx
+  8036a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8036a6:	49 89 fc             	mov    %rdi,%r12
+  8036a9:	48 89 f7             	mov    %rsi,%rdi
+  8036ac:	48 89 d3             	mov    %rdx,%rbx
+  8036af:	49 89 cd             	mov    %rcx,%r13
+  8036b2:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8036b5:	48 85 f6             	test   %rsi,%rsi
+  8036b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8036bf:	00 00 00 
+  8036c2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8036c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036cb:	48 85 db             	test   %rbx,%rbx
+  8036ce:	74 03                	je     8036d3 <ipc_recv_timed+0x3a>
+  8036d0:	48 8b 33             	mov    (%rbx),%rsi
+  8036d3:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  8036da:	00 00 00 
+  8036dd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8036df:	85 c0                	test   %eax,%eax
+  8036e1:	78 75                	js     803758 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8036e3:	4d 85 e4             	test   %r12,%r12
+  8036e6:	74 14                	je     8036fc <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8036e8:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8036ef:	00 00 00 
+  8036f2:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8036f8:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8036fc:	4d 85 ed             	test   %r13,%r13
+  8036ff:	74 14                	je     803715 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803701:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  803708:	00 00 00 
+  80370b:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803711:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803715:	48 85 db             	test   %rbx,%rbx
+  803718:	74 23                	je     80373d <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80371a:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  803721:	00 00 00 
+  803724:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80372a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372f:	85 c9                	test   %ecx,%ecx
+  803731:	74 07                	je     80373a <ipc_recv_timed+0xa1>
+  803733:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80373a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80373d:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  803744:	00 00 00 
+  803747:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80374d:	48 83 c4 08          	add    $0x8,%rsp
+  803751:	5b                   	pop    %rbx
+  803752:	41 5c                	pop    %r12
+  803754:	41 5d                	pop    %r13
+  803756:	5d                   	pop    %rbp
+  803757:	c3                   	ret
+        if (from_env_store != NULL) {
+  803758:	4d 85 e4             	test   %r12,%r12
+  80375b:	74 08                	je     803765 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80375d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803764:	00 
+        if (perm_store != NULL) {
+  803765:	4d 85 ed             	test   %r13,%r13
+  803768:	74 08                	je     803772 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80376a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803771:	00 
+        if (size != NULL) {
+  803772:	48 85 db             	test   %rbx,%rbx
+  803775:	74 d6                	je     80374d <ipc_recv_timed+0xb4>
+            *size = 0;
+  803777:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80377e:	eb cd                	jmp    80374d <ipc_recv_timed+0xb4>
+
+0000000000803780 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803780:	55                   	push   %rbp
+  803781:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80378a:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+}
+  803796:	5d                   	pop    %rbp
+  803797:	c3                   	ret
+
+0000000000803798 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803798:	55                   	push   %rbp
+  803799:	48 89 e5             	mov    %rsp,%rbp
+  80379c:	41 57                	push   %r15
+  80379e:	41 56                	push   %r14
+  8037a0:	41 55                	push   %r13
+  8037a2:	41 54                	push   %r12
+  8037a4:	53                   	push   %rbx
+  8037a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8037a9:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8037ac:	48 89 d3             	mov    %rdx,%rbx
+  8037af:	49 89 cc             	mov    %rcx,%r12
+  8037b2:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8037b5:	48 85 d2             	test   %rdx,%rdx
+  8037b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037bf:	00 00 00 
+  8037c2:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8037c6:	89 f0                	mov    %esi,%eax
+  8037c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8037cc:	48 89 da             	mov    %rbx,%rdx
+  8037cf:	48 89 c6             	mov    %rax,%rsi
+  8037d2:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  8037d9:	00 00 00 
+  8037dc:	ff d0                	call   *%rax
+    while (res < 0) {
+  8037de:	85 c0                	test   %eax,%eax
+  8037e0:	79 65                	jns    803847 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8037e2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8037e5:	75 33                	jne    80381a <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8037e7:	49 bf 9a 12 80 00 00 	movabs $0x80129a,%r15
+  8037ee:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8037f1:	49 be 97 15 80 00 00 	movabs $0x801597,%r14
+  8037f8:	00 00 00 
+        sys_yield();
+  8037fb:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8037fe:	45 89 e8             	mov    %r13d,%r8d
+  803801:	4c 89 e1             	mov    %r12,%rcx
+  803804:	48 89 da             	mov    %rbx,%rdx
+  803807:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80380b:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80380e:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803811:	85 c0                	test   %eax,%eax
+  803813:	79 32                	jns    803847 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803815:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803818:	74 e1                	je     8037fb <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80381a:	89 c1                	mov    %eax,%ecx
+  80381c:	48 ba c0 3f 80 00 00 	movabs $0x803fc0,%rdx
+  803823:	00 00 00 
+  803826:	be 52 00 00 00       	mov    $0x52,%esi
+  80382b:	48 bf d4 3f 80 00 00 	movabs $0x803fd4,%rdi
+  803832:	00 00 00 
+  803835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383a:	49 b8 28 02 80 00 00 	movabs $0x800228,%r8
+  803841:	00 00 00 
+  803844:	41 ff d0             	call   *%r8
+    }
+}
+  803847:	48 83 c4 18          	add    $0x18,%rsp
+  80384b:	5b                   	pop    %rbx
+  80384c:	41 5c                	pop    %r12
+  80384e:	41 5d                	pop    %r13
+  803850:	41 5e                	pop    %r14
+  803852:	41 5f                	pop    %r15
+  803854:	5d                   	pop    %rbp
+  803855:	c3                   	ret
+
+0000000000803856 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80385b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803862:	00 00 00 
+  803865:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803869:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80386d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803871:	48 01 ca             	add    %rcx,%rdx
+  803874:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80387a:	39 fa                	cmp    %edi,%edx
+  80387c:	74 12                	je     803890 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80387e:	48 83 c0 01          	add    $0x1,%rax
+  803882:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803888:	75 db                	jne    803865 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80388a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80388f:	c3                   	ret
+            return envs[i].env_id;
+  803890:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803894:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803898:	48 c1 e2 04          	shl    $0x4,%rdx
+  80389c:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8038a3:	00 00 00 
+  8038a6:	48 01 d0             	add    %rdx,%rax
+  8038a9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8038af:	c3                   	ret
+
+00000000008038b0 <__rodata_start>:
+  8038b0:	72 61                	jb     803913 <__rodata_start+0x63>
+  8038b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038b3:	20 6f 6e             	and    %ch,0x6e(%rdi)
+  8038b6:	20 74 77 6f          	and    %dh,0x6f(%rdi,%rsi,2)
+  8038ba:	20 43 50             	and    %al,0x50(%rbx)
+  8038bd:	55                   	push   %rbp
+  8038be:	73 20                	jae    8038e0 <__rodata_start+0x30>
+  8038c0:	61                   	(bad)
+  8038c1:	74 20                	je     8038e3 <__rodata_start+0x33>
+  8038c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038c5:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8038c8:	28 63 6f             	sub    %ah,0x6f(%rbx)
+  8038cb:	75 6e                	jne    80393b <__rodata_start+0x8b>
+  8038cd:	74 65                	je     803934 <__rodata_start+0x84>
+  8038cf:	72 20                	jb     8038f1 <__rodata_start+0x41>
+  8038d1:	69 73 20 25 64 29 00 	imul   $0x296425,0x20(%rbx),%esi
+  8038d8:	75 73                	jne    80394d <__rodata_start+0x9d>
+  8038da:	65 72 2f             	gs jb  80390c <__rodata_start+0x5c>
+  8038dd:	73 74                	jae    803953 <__rodata_start+0xa3>
+  8038df:	72 65                	jb     803946 <__rodata_start+0x96>
+  8038e1:	73 73                	jae    803956 <__rodata_start+0xa6>
+  8038e3:	73 63                	jae    803948 <__rodata_start+0x98>
+  8038e5:	68 65 64 2e 63       	push   $0x632e6465
+  8038ea:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8038f1:	77 6e                	ja     803961 <__rodata_start+0xb1>
+  8038f3:	3e 00 0f             	ds add %cl,(%rdi)
+  8038f6:	1f                   	(bad)
+  8038f7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8038fa:	30 38                	xor    %bh,(%rax)
+  8038fc:	78 5d                	js     80395b <__rodata_start+0xab>
+  8038fe:	20 75 73             	and    %dh,0x73(%rbp)
+  803901:	65 72 20             	gs jb  803924 <__rodata_start+0x74>
+  803904:	70 61                	jo     803967 <__rodata_start+0xb7>
+  803906:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803907:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80390e:	73 20                	jae    803930 <__rodata_start+0x80>
+  803910:	61                   	(bad)
+  803911:	74 20                	je     803933 <__rodata_start+0x83>
+  803913:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803918:	3a 20                	cmp    (%rax),%ah
+  80391a:	00 30                	add    %dh,(%rax)
+  80391c:	31 32                	xor    %esi,(%rdx)
+  80391e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803925:	41                   	rex.B
+  803926:	42                   	rex.X
+  803927:	43                   	rex.XB
+  803928:	44                   	rex.R
+  803929:	45                   	rex.RB
+  80392a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80392d:	31 32                	xor    %esi,(%rdx)
+  80392f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803936:	61                   	(bad)
+  803937:	62 63 64 65 66       	(bad)
+  80393c:	00 28                	add    %ch,(%rax)
+  80393e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80393f:	75 6c                	jne    8039ad <__rodata_start+0xfd>
+  803941:	6c                   	insb   (%dx),%es:(%rdi)
+  803942:	29 00                	sub    %eax,(%rax)
+  803944:	65 72 72             	gs jb  8039b9 <__rodata_start+0x109>
+  803947:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803948:	72 20                	jb     80396a <__rodata_start+0xba>
+  80394a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80394f:	73 70                	jae    8039c1 <__rodata_start+0x111>
+  803951:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803955:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80395c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80395d:	72 00                	jb     80395f <__rodata_start+0xaf>
+  80395f:	62 61 64 20 65       	(bad)
+  803964:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803965:	76 69                	jbe    8039d0 <__rodata_start+0x120>
+  803967:	72 6f                	jb     8039d8 <__rodata_start+0x128>
+  803969:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80396a:	6d                   	insl   (%dx),%es:(%rdi)
+  80396b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80396d:	74 00                	je     80396f <__rodata_start+0xbf>
+  80396f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803976:	20 70 61             	and    %dh,0x61(%rax)
+  803979:	72 61                	jb     8039dc <__rodata_start+0x12c>
+  80397b:	6d                   	insl   (%dx),%es:(%rdi)
+  80397c:	65 74 65             	gs je  8039e4 <__rodata_start+0x134>
+  80397f:	72 00                	jb     803981 <__rodata_start+0xd1>
+  803981:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803982:	75 74                	jne    8039f8 <__rodata_start+0x148>
+  803984:	20 6f 66             	and    %ch,0x66(%rdi)
+  803987:	20 6d 65             	and    %ch,0x65(%rbp)
+  80398a:	6d                   	insl   (%dx),%es:(%rdi)
+  80398b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80398c:	72 79                	jb     803a07 <__rodata_start+0x157>
+  80398e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803991:	74 20                	je     8039b3 <__rodata_start+0x103>
+  803993:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803994:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803998:	76 69                	jbe    803a03 <__rodata_start+0x153>
+  80399a:	72 6f                	jb     803a0b <__rodata_start+0x15b>
+  80399c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80399d:	6d                   	insl   (%dx),%es:(%rdi)
+  80399e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039a0:	74 73                	je     803a15 <__rodata_start+0x165>
+  8039a2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8039a5:	72 72                	jb     803a19 <__rodata_start+0x169>
+  8039a7:	75 70                	jne    803a19 <__rodata_start+0x169>
+  8039a9:	74 65                	je     803a10 <__rodata_start+0x160>
+  8039ab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8039b0:	75 67                	jne    803a19 <__rodata_start+0x169>
+  8039b2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8039b5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039b7:	00 73 65             	add    %dh,0x65(%rbx)
+  8039ba:	67 6d                	insl   (%dx),%es:(%edi)
+  8039bc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039be:	74 61                	je     803a21 <__rodata_start+0x171>
+  8039c0:	74 69                	je     803a2b <__rodata_start+0x17b>
+  8039c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c4:	20 66 61             	and    %ah,0x61(%rsi)
+  8039c7:	75 6c                	jne    803a35 <__rodata_start+0x185>
+  8039c9:	74 00                	je     8039cb <__rodata_start+0x11b>
+  8039cb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8039d2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8039d5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8039d9:	61                   	(bad)
+  8039da:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8039df:	20 73 75             	and    %dh,0x75(%rbx)
+  8039e2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8039e5:	73 79                	jae    803a60 <__rodata_start+0x1b0>
+  8039e7:	73 74                	jae    803a5d <__rodata_start+0x1ad>
+  8039e9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8039eb:	20 63 61             	and    %ah,0x61(%rbx)
+  8039ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ef:	6c                   	insb   (%dx),%es:(%rdi)
+  8039f0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8039f3:	74 72                	je     803a67 <__rodata_start+0x1b7>
+  8039f5:	79 20                	jns    803a17 <__rodata_start+0x167>
+  8039f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039f8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039f9:	74 20                	je     803a1b <__rodata_start+0x16b>
+  8039fb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039fd:	75 6e                	jne    803a6d <__rodata_start+0x1bd>
+  8039ff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803a03:	76 20                	jbe    803a25 <__rodata_start+0x175>
+  803a05:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803a0c:	72 65                	jb     803a73 <__rodata_start+0x1c3>
+  803a0e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803a11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a12:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803a16:	65 78 70             	gs js  803a89 <__rodata_start+0x1d9>
+  803a19:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803a1e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803a21:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803a25:	20 66 69             	and    %ah,0x69(%rsi)
+  803a28:	6c                   	insb   (%dx),%es:(%rdi)
+  803a29:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803a2d:	20 66 72             	and    %ah,0x72(%rsi)
+  803a30:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803a35:	61                   	(bad)
+  803a36:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803a39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a3b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803a3f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803a42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a44:	20 6d 61             	and    %ch,0x61(%rbp)
+  803a47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a48:	79 20                	jns    803a6a <__rodata_start+0x1ba>
+  803a4a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803a51:	72 65                	jb     803ab8 <__rodata_start+0x208>
+  803a53:	20 6f 70             	and    %ch,0x70(%rdi)
+  803a56:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a58:	00 66 69             	add    %ah,0x69(%rsi)
+  803a5b:	6c                   	insb   (%dx),%es:(%rdi)
+  803a5c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a60:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a64:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a67:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a69:	74 20                	je     803a8b <__rodata_start+0x1db>
+  803a6b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a6d:	75 6e                	jne    803add <__rodata_start+0x22d>
+  803a6f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a73:	76 61                	jbe    803ad6 <__rodata_start+0x226>
+  803a75:	6c                   	insb   (%dx),%es:(%rdi)
+  803a76:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803a7d:	00 
+  803a7e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803a85:	72 65                	jb     803aec <__rodata_start+0x23c>
+  803a87:	61                   	(bad)
+  803a88:	64 79 20             	fs jns 803aab <__rodata_start+0x1fb>
+  803a8b:	65 78 69             	gs js  803af7 <__rodata_start+0x247>
+  803a8e:	73 74                	jae    803b04 <__rodata_start+0x254>
+  803a90:	73 00                	jae    803a92 <__rodata_start+0x1e2>
+  803a92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a93:	70 65                	jo     803afa <__rodata_start+0x24a>
+  803a95:	72 61                	jb     803af8 <__rodata_start+0x248>
+  803a97:	74 69                	je     803b02 <__rodata_start+0x252>
+  803a99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a9b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a9e:	74 20                	je     803ac0 <__rodata_start+0x210>
+  803aa0:	73 75                	jae    803b17 <__rodata_start+0x267>
+  803aa2:	70 70                	jo     803b14 <__rodata_start+0x264>
+  803aa4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aa5:	72 74                	jb     803b1b <__rodata_start+0x26b>
+  803aa7:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803aad:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803ab2:	74 00                	je     803ab4 <__rodata_start+0x204>
+  803ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803abb:	00 00 00 
+  803abe:	66 90                	xchg   %ax,%ax
+  803ac0:	65 05 80 00 00 00    	gs add $0x80,%eax
+  803ac6:	00 00                	add    %al,(%rax)
+  803ac8:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  803ac9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803acf:	00 96 0b 80 00 00    	add    %dl,0x800b(%rsi)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 84 05 80 00 00 00 	add    %al,0x80(%rbp,%rax,1)
+  803afe:	00 00                	add    %al,(%rax)
+  803b00:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  803b01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b07:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 78 05             	add    %bh,0x5(%rax)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 f2                	add    %dh,%dl
+  803b19:	05 80 00 00 00       	add    $0x80,%eax
+  803b1e:	00 00                	add    %al,(%rax)
+  803b20:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  803b21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803b27:	00 78 05             	add    %bh,0x5(%rax)
+  803b2a:	80 00 00             	addb   $0x0,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 be 05 80 00 00    	add    %bh,0x8005(%rsi)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 c9                	add    %cl,%cl
+  803c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c6f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 15 06 80 00 00    	add    %dl,0x8006(%rip)        # 80bccb <__bss_end+0x3ccb>
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 e4                	add    %ah,%ah
+  803cc9:	07                   	(bad)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 44 06 80          	add    %al,-0x80(%rsi,%rax,1)
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 0a                	add    %cl,(%rdx)
+  803d09:	06                   	(bad)
+  803d0a:	80 00 00             	addb   $0x0,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 8c 09 80 00 00 00 	add    %cl,0x80(%rcx,%rcx,1)
+  803d26:	00 00                	add    %al,(%rax)
+  803d28:	56                   	push   %rsi
+  803d29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d2f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 db                	add    %bl,%bl
+  803d41:	06                   	(bad)
+  803d42:	80 00 00             	addb   $0x0,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 b8 08 80 00 00    	add    %bh,0x8008(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 c9                	add    %cl,%cl
+  803d69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d6f:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 6e 05             	add    %ch,0x5(%rsi)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d80 <error_string>:
+	...
+  803d88:	4d 39 80 00 00 00 00 00 5f 39 80 00 00 00 00 00     M9......_9......
+  803d98:	6f 39 80 00 00 00 00 00 81 39 80 00 00 00 00 00     o9.......9......
+  803da8:	8f 39 80 00 00 00 00 00 a3 39 80 00 00 00 00 00     .9.......9......
+  803db8:	b8 39 80 00 00 00 00 00 cb 39 80 00 00 00 00 00     .9.......9......
+  803dc8:	dd 39 80 00 00 00 00 00 f1 39 80 00 00 00 00 00     .9.......9......
+  803dd8:	01 3a 80 00 00 00 00 00 14 3a 80 00 00 00 00 00     .:.......:......
+  803de8:	2b 3a 80 00 00 00 00 00 41 3a 80 00 00 00 00 00     +:......A:......
+  803df8:	59 3a 80 00 00 00 00 00 71 3a 80 00 00 00 00 00     Y:......q:......
+  803e08:	7e 3a 80 00 00 00 00 00 28 3e 80 00 00 00 00 00     ~:......(>......
+  803e18:	92 3a 80 00 00 00 00 00 aa 3a 80 00 00 00 00 00     .:.......:......
+  803e28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803e38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803e48:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803e58:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803e68:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  803e78:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  803e88:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  803e98:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803ea8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803eb8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  803ec8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  803ed8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  803ee8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803ef8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803f08:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803f18:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803f28:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803f38:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803f40 <devtab>:
+  803f40:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803f50:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803f60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803f70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803f80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803f90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803fa0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803fb0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803fc0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  803fd0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
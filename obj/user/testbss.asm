@@ -0,0 +1,6987 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf a8 37 80 00 00 	movabs $0x8037a8,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf f0 37 80 00 00 	movabs $0x8037f0,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 50 c0 02 00 	movabs $0x2c05000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba 4f 38 80 00 00 	movabs $0x80384f,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 29 02 80 00 00 	movabs $0x800229,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba 23 38 80 00 00 	movabs $0x803823,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba c8 37 80 00 00 	movabs $0x8037c8,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	41 89 fd             	mov    %edi,%r13d
+  800166:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800169:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800170:	00 00 00 
+  800173:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80017a:	00 00 00 
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	73 17                	jae    800199 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800182:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800185:	49 89 c4             	mov    %rax,%r12
+  800188:	48 83 c3 08          	add    $0x8,%rbx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	ff 53 f8             	call   *-0x8(%rbx)
+  800194:	4c 39 e3             	cmp    %r12,%rbx
+  800197:	72 ef                	jb     800188 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800199:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+  8001a5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001aa:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8001ae:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8001b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8001b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001bd:	00 00 00 
+  8001c0:	48 01 d0             	add    %rdx,%rax
+  8001c3:	48 a3 00 50 c0 00 00 	movabs %rax,0xc05000
+  8001ca:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001cd:	45 85 ed             	test   %r13d,%r13d
+  8001d0:	7e 0d                	jle    8001df <libmain+0x87>
+  8001d2:	49 8b 06             	mov    (%r14),%rax
+  8001d5:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001dc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001df:	4c 89 f6             	mov    %r14,%rsi
+  8001e2:	44 89 ef             	mov    %r13d,%edi
+  8001e5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f1:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+#endif
+}
+  8001fd:	5b                   	pop    %rbx
+  8001fe:	41 5c                	pop    %r12
+  800200:	41 5d                	pop    %r13
+  800202:	41 5e                	pop    %r14
+  800204:	5d                   	pop    %rbp
+  800205:	c3                   	ret
+
+0000000000800206 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800206:	55                   	push   %rbp
+  800207:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80020a:	48 b8 20 19 80 00 00 	movabs $0x801920,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021b:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+}
+  800227:	5d                   	pop    %rbp
+  800228:	c3                   	ret
+
+0000000000800229 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	41 56                	push   %r14
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 50          	sub    $0x50,%rsp
+  800238:	49 89 fc             	mov    %rdi,%r12
+  80023b:	41 89 f5             	mov    %esi,%r13d
+  80023e:	48 89 d3             	mov    %rdx,%rbx
+  800241:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800245:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800249:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80024d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800254:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800258:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80025c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800260:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800264:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80026b:	00 00 00 
+  80026e:	4c 8b 30             	mov    (%rax),%r14
+  800271:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  800278:	00 00 00 
+  80027b:	ff d0                	call   *%rax
+  80027d:	89 c6                	mov    %eax,%esi
+  80027f:	45 89 e8             	mov    %r13d,%r8d
+  800282:	4c 89 e1             	mov    %r12,%rcx
+  800285:	4c 89 f2             	mov    %r14,%rdx
+  800288:	48 bf 70 38 80 00 00 	movabs $0x803870,%rdi
+  80028f:	00 00 00 
+  800292:	b8 00 00 00 00       	mov    $0x0,%eax
+  800297:	49 bc 79 03 80 00 00 	movabs $0x800379,%r12
+  80029e:	00 00 00 
+  8002a1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002a4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a8:	48 89 df             	mov    %rbx,%rdi
+  8002ab:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b7:	48 bf 3e 38 80 00 00 	movabs $0x80383e,%rdi
+  8002be:	00 00 00 
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c9:	cc                   	int3
+  8002ca:	eb fd                	jmp    8002c9 <_panic+0xa0>
+
+00000000008002cc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002cc:	55                   	push   %rbp
+  8002cd:	48 89 e5             	mov    %rsp,%rbp
+  8002d0:	53                   	push   %rbx
+  8002d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d8:	8b 06                	mov    (%rsi),%eax
+  8002da:	8d 50 01             	lea    0x1(%rax),%edx
+  8002dd:	89 16                	mov    %edx,(%rsi)
+  8002df:	48 98                	cltq
+  8002e1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002ec:	74 0a                	je     8002f8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002ee:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f6:	c9                   	leave
+  8002f7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002fc:	be ff 00 00 00       	mov    $0xff,%esi
+  800301:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80030d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800313:	eb d9                	jmp    8002ee <putch+0x22>
+
+0000000000800315 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800315:	55                   	push   %rbp
+  800316:	48 89 e5             	mov    %rsp,%rbp
+  800319:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800320:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800323:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80032a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800337:	48 89 f1             	mov    %rsi,%rcx
+  80033a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800341:	48 bf cc 02 80 00 00 	movabs $0x8002cc,%rdi
+  800348:	00 00 00 
+  80034b:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800357:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80035e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800365:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800371:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800377:	c9                   	leave
+  800378:	c3                   	ret
+
+0000000000800379 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	48 83 ec 50          	sub    $0x50,%rsp
+  800381:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800385:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800389:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800391:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800395:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80039c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003ac:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003b0:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003bc:	c9                   	leave
+  8003bd:	c3                   	ret
+
+00000000008003be <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	41 57                	push   %r15
+  8003c4:	41 56                	push   %r14
+  8003c6:	41 55                	push   %r13
+  8003c8:	41 54                	push   %r12
+  8003ca:	53                   	push   %rbx
+  8003cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8003cf:	49 89 fc             	mov    %rdi,%r12
+  8003d2:	49 89 f5             	mov    %rsi,%r13
+  8003d5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003dc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003df:	41 89 cf             	mov    %ecx,%r15d
+  8003e2:	4c 39 fa             	cmp    %r15,%rdx
+  8003e5:	73 5b                	jae    800442 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003eb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ef:	85 db                	test   %ebx,%ebx
+  8003f1:	7e 0e                	jle    800401 <print_num+0x43>
+            putch(padc, put_arg);
+  8003f3:	4c 89 ee             	mov    %r13,%rsi
+  8003f6:	44 89 f7             	mov    %r14d,%edi
+  8003f9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003fc:	83 eb 01             	sub    $0x1,%ebx
+  8003ff:	75 f2                	jne    8003f3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800401:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800405:	48 b9 a4 38 80 00 00 	movabs $0x8038a4,%rcx
+  80040c:	00 00 00 
+  80040f:	48 b8 93 38 80 00 00 	movabs $0x803893,%rax
+  800416:	00 00 00 
+  800419:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80041d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800421:	ba 00 00 00 00       	mov    $0x0,%edx
+  800426:	49 f7 f7             	div    %r15
+  800429:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80042d:	4c 89 ee             	mov    %r13,%rsi
+  800430:	41 ff d4             	call   *%r12
+}
+  800433:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800437:	5b                   	pop    %rbx
+  800438:	41 5c                	pop    %r12
+  80043a:	41 5d                	pop    %r13
+  80043c:	41 5e                	pop    %r14
+  80043e:	41 5f                	pop    %r15
+  800440:	5d                   	pop    %rbp
+  800441:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800442:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044b:	49 f7 f7             	div    %r15
+  80044e:	48 83 ec 08          	sub    $0x8,%rsp
+  800452:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800456:	52                   	push   %rdx
+  800457:	45 0f be c9          	movsbl %r9b,%r9d
+  80045b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045f:	48 89 c2             	mov    %rax,%rdx
+  800462:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+  80046e:	48 83 c4 10          	add    $0x10,%rsp
+  800472:	eb 8d                	jmp    800401 <print_num+0x43>
+
+0000000000800474 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800474:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800478:	48 8b 06             	mov    (%rsi),%rax
+  80047b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047f:	73 0a                	jae    80048b <sprintputch+0x17>
+        *state->start++ = ch;
+  800481:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800485:	48 89 16             	mov    %rdx,(%rsi)
+  800488:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80048b:	c3                   	ret
+
+000000000080048c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	48 83 ec 50          	sub    $0x50,%rsp
+  800494:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800498:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80049c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004a0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004af:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004bb:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  8004c2:	00 00 00 
+  8004c5:	ff d0                	call   *%rax
+}
+  8004c7:	c9                   	leave
+  8004c8:	c3                   	ret
+
+00000000008004c9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c9:	55                   	push   %rbp
+  8004ca:	48 89 e5             	mov    %rsp,%rbp
+  8004cd:	41 57                	push   %r15
+  8004cf:	41 56                	push   %r14
+  8004d1:	41 55                	push   %r13
+  8004d3:	41 54                	push   %r12
+  8004d5:	53                   	push   %rbx
+  8004d6:	48 83 ec 38          	sub    $0x38,%rsp
+  8004da:	49 89 fe             	mov    %rdi,%r14
+  8004dd:	49 89 f5             	mov    %rsi,%r13
+  8004e0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004e3:	48 8b 01             	mov    (%rcx),%rax
+  8004e6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004ea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004fa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004fe:	0f b6 3b             	movzbl (%rbx),%edi
+  800501:	40 80 ff 25          	cmp    $0x25,%dil
+  800505:	74 18                	je     80051f <vprintfmt+0x56>
+            if (!ch) return;
+  800507:	40 84 ff             	test   %dil,%dil
+  80050a:	0f 84 b1 06 00 00    	je     800bc1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800510:	40 0f b6 ff          	movzbl %dil,%edi
+  800514:	4c 89 ee             	mov    %r13,%rsi
+  800517:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80051a:	4c 89 e3             	mov    %r12,%rbx
+  80051d:	eb db                	jmp    8004fa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051f:	be 00 00 00 00       	mov    $0x0,%esi
+  800524:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80052d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800533:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80053a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800543:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800548:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80054b:	83 e8 23             	sub    $0x23,%eax
+  80054e:	3c 57                	cmp    $0x57,%al
+  800550:	0f 87 51 06 00 00    	ja     800ba7 <vprintfmt+0x6de>
+  800556:	0f b6 c0             	movzbl %al,%eax
+  800559:	48 b9 40 3a 80 00 00 	movabs $0x803a40,%rcx
+  800560:	00 00 00 
+  800563:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800566:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800569:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80056d:	eb cf                	jmp    80053e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056f:	49 89 dc             	mov    %rbx,%r12
+  800572:	be 01 00 00 00       	mov    $0x1,%esi
+  800577:	eb c5                	jmp    80053e <vprintfmt+0x75>
+            padc = ch;
+  800579:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80057d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800580:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800583:	eb b9                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800585:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800588:	83 f8 2f             	cmp    $0x2f,%eax
+  80058b:	77 24                	ja     8005b1 <vprintfmt+0xe8>
+  80058d:	89 c1                	mov    %eax,%ecx
+  80058f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800593:	83 c0 08             	add    $0x8,%eax
+  800596:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800599:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a3:	79 99                	jns    80053e <vprintfmt+0x75>
+                width = precision;
+  8005a5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005af:	eb 8d                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bd:	eb da                	jmp    800599 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005bf:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005c4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005ce:	3c 39                	cmp    $0x39,%al
+  8005d0:	77 1c                	ja     8005ee <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005d2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005da:	0f b6 c0             	movzbl %al,%eax
+  8005dd:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005e2:	0f b6 03             	movzbl (%rbx),%eax
+  8005e5:	3c 39                	cmp    $0x39,%al
+  8005e7:	76 e9                	jbe    8005d2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005ec:	eb b1                	jmp    80059f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005ee:	49 89 dc             	mov    %rbx,%r12
+  8005f1:	eb ac                	jmp    80059f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005f3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f6:	85 c9                	test   %ecx,%ecx
+  8005f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fd:	0f 49 c1             	cmovns %ecx,%eax
+  800600:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800603:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800606:	e9 33 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            lflag++;
+  80060b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800611:	e9 28 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800616:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800619:	83 f8 2f             	cmp    $0x2f,%eax
+  80061c:	77 19                	ja     800637 <vprintfmt+0x16e>
+  80061e:	89 c2                	mov    %eax,%edx
+  800620:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800624:	83 c0 08             	add    $0x8,%eax
+  800627:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062a:	8b 3a                	mov    (%rdx),%edi
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	41 ff d6             	call   *%r14
+            break;
+  800632:	e9 c3 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb e5                	jmp    80062a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	77 5a                	ja     8006a7 <vprintfmt+0x1de>
+  80064d:	89 c2                	mov    %eax,%edx
+  80064f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800653:	83 c0 08             	add    $0x8,%eax
+  800656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800659:	8b 02                	mov    (%rdx),%eax
+  80065b:	89 c1                	mov    %eax,%ecx
+  80065d:	f7 d9                	neg    %ecx
+  80065f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800662:	83 f9 14             	cmp    $0x14,%ecx
+  800665:	7f 4e                	jg     8006b5 <vprintfmt+0x1ec>
+  800667:	48 63 c1             	movslq %ecx,%rax
+  80066a:	48 ba 00 3d 80 00 00 	movabs $0x803d00,%rdx
+  800671:	00 00 00 
+  800674:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800678:	48 85 c0             	test   %rax,%rax
+  80067b:	74 38                	je     8006b5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80067d:	48 89 c1             	mov    %rax,%rcx
+  800680:	48 ba d9 3e 80 00 00 	movabs $0x803ed9,%rdx
+  800687:	00 00 00 
+  80068a:	4c 89 ee             	mov    %r13,%rsi
+  80068d:	4c 89 f7             	mov    %r14,%rdi
+  800690:	b8 00 00 00 00       	mov    $0x0,%eax
+  800695:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80069c:	00 00 00 
+  80069f:	41 ff d0             	call   *%r8
+  8006a2:	e9 53 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b3:	eb a4                	jmp    800659 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b5:	48 ba bc 38 80 00 00 	movabs $0x8038bc,%rdx
+  8006bc:	00 00 00 
+  8006bf:	4c 89 ee             	mov    %r13,%rsi
+  8006c2:	4c 89 f7             	mov    %r14,%rdi
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  8006d1:	00 00 00 
+  8006d4:	41 ff d0             	call   *%r8
+  8006d7:	e9 1e fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	77 6c                	ja     800750 <vprintfmt+0x287>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006f3:	48 85 d2             	test   %rdx,%rdx
+  8006f6:	48 b8 b5 38 80 00 00 	movabs $0x8038b5,%rax
+  8006fd:	00 00 00 
+  800700:	48 0f 45 c2          	cmovne %rdx,%rax
+  800704:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800708:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80070c:	7e 06                	jle    800714 <vprintfmt+0x24b>
+  80070e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800712:	75 4a                	jne    80075e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800714:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800718:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80071c:	0f b6 00             	movzbl (%rax),%eax
+  80071f:	84 c0                	test   %al,%al
+  800721:	0f 85 9a 00 00 00    	jne    8007c1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800727:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80072e:	85 c0                	test   %eax,%eax
+  800730:	0f 8e c4 fd ff ff    	jle    8004fa <vprintfmt+0x31>
+  800736:	4c 89 ee             	mov    %r13,%rsi
+  800739:	bf 20 00 00 00       	mov    $0x20,%edi
+  80073e:	41 ff d6             	call   *%r14
+  800741:	41 83 ec 01          	sub    $0x1,%r12d
+  800745:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800749:	75 eb                	jne    800736 <vprintfmt+0x26d>
+  80074b:	e9 aa fd ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800750:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800754:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075c:	eb 92                	jmp    8006f0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80075e:	49 63 f7             	movslq %r15d,%rsi
+  800761:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800765:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  80076c:	00 00 00 
+  80076f:	ff d0                	call   *%rax
+  800771:	48 89 c2             	mov    %rax,%rdx
+  800774:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800777:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800779:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80077c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	7e 91                	jle    800714 <vprintfmt+0x24b>
+  800783:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800788:	4c 89 ee             	mov    %r13,%rsi
+  80078b:	44 89 e7             	mov    %r12d,%edi
+  80078e:	41 ff d6             	call   *%r14
+  800791:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800795:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800798:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80079b:	75 eb                	jne    800788 <vprintfmt+0x2bf>
+  80079d:	e9 72 ff ff ff       	jmp    800714 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a2:	0f b6 f8             	movzbl %al,%edi
+  8007a5:	4c 89 ee             	mov    %r13,%rsi
+  8007a8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007af:	49 83 c4 01          	add    $0x1,%r12
+  8007b3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b9:	84 c0                	test   %al,%al
+  8007bb:	0f 84 66 ff ff ff    	je     800727 <vprintfmt+0x25e>
+  8007c1:	45 85 ff             	test   %r15d,%r15d
+  8007c4:	78 0a                	js     8007d0 <vprintfmt+0x307>
+  8007c6:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ca:	0f 88 57 ff ff ff    	js     800727 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d4:	74 cc                	je     8007a2 <vprintfmt+0x2d9>
+  8007d6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007de:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e1:	77 c2                	ja     8007a5 <vprintfmt+0x2dc>
+  8007e3:	eb bd                	jmp    8007a2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e5:	40 84 f6             	test   %sil,%sil
+  8007e8:	75 26                	jne    800810 <vprintfmt+0x347>
+    switch (lflag) {
+  8007ea:	85 d2                	test   %edx,%edx
+  8007ec:	74 59                	je     800847 <vprintfmt+0x37e>
+  8007ee:	83 fa 01             	cmp    $0x1,%edx
+  8007f1:	74 7b                	je     80086e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f9:	0f 87 96 00 00 00    	ja     800895 <vprintfmt+0x3cc>
+  8007ff:	89 c2                	mov    %eax,%edx
+  800801:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800805:	83 c0 08             	add    $0x8,%eax
+  800808:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080b:	4c 8b 22             	mov    (%rdx),%r12
+  80080e:	eb 17                	jmp    800827 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 21                	ja     800839 <vprintfmt+0x370>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800827:	4d 85 e4             	test   %r12,%r12
+  80082a:	78 7a                	js     8008a6 <vprintfmt+0x3dd>
+            num = i;
+  80082c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80082f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800834:	e9 50 02 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb dd                	jmp    800824 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800847:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084a:	83 f8 2f             	cmp    $0x2f,%eax
+  80084d:	77 11                	ja     800860 <vprintfmt+0x397>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	4c 63 22             	movslq (%rdx),%r12
+  80085e:	eb c7                	jmp    800827 <vprintfmt+0x35e>
+  800860:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800864:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800868:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086c:	eb ed                	jmp    80085b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80086e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800871:	83 f8 2f             	cmp    $0x2f,%eax
+  800874:	77 11                	ja     800887 <vprintfmt+0x3be>
+  800876:	89 c2                	mov    %eax,%edx
+  800878:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087c:	83 c0 08             	add    $0x8,%eax
+  80087f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800882:	4c 8b 22             	mov    (%rdx),%r12
+  800885:	eb a0                	jmp    800827 <vprintfmt+0x35e>
+  800887:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800893:	eb ed                	jmp    800882 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	e9 65 ff ff ff       	jmp    80080b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008a6:	4c 89 ee             	mov    %r13,%rsi
+  8008a9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ae:	41 ff d6             	call   *%r14
+                i = -i;
+  8008b1:	49 f7 dc             	neg    %r12
+  8008b4:	e9 73 ff ff ff       	jmp    80082c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b9:	40 84 f6             	test   %sil,%sil
+  8008bc:	75 32                	jne    8008f0 <vprintfmt+0x427>
+    switch (lflag) {
+  8008be:	85 d2                	test   %edx,%edx
+  8008c0:	74 5d                	je     80091f <vprintfmt+0x456>
+  8008c2:	83 fa 01             	cmp    $0x1,%edx
+  8008c5:	0f 84 82 00 00 00    	je     80094d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	0f 87 a5 00 00 00    	ja     80097c <vprintfmt+0x4b3>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008eb:	e9 99 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f6:	77 19                	ja     800911 <vprintfmt+0x448>
+  8008f8:	89 c2                	mov    %eax,%edx
+  8008fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fe:	83 c0 08             	add    $0x8,%eax
+  800901:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800904:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800907:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	e9 78 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e5                	jmp    800904 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 18                	ja     80093f <vprintfmt+0x476>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80093a:	e9 4a 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e6                	jmp    800933 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 19                	ja     80096e <vprintfmt+0x4a5>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800964:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800969:	e9 1b 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80096e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800972:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800976:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097a:	eb e5                	jmp    800961 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80097c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800980:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800984:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800988:	e9 56 ff ff ff       	jmp    8008e3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80098d:	40 84 f6             	test   %sil,%sil
+  800990:	75 2e                	jne    8009c0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800992:	85 d2                	test   %edx,%edx
+  800994:	74 59                	je     8009ef <vprintfmt+0x526>
+  800996:	83 fa 01             	cmp    $0x1,%edx
+  800999:	74 7f                	je     800a1a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	0f 87 9f 00 00 00    	ja     800a46 <vprintfmt+0x57d>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009bb:	e9 c9 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c6:	77 19                	ja     8009e1 <vprintfmt+0x518>
+  8009c8:	89 c2                	mov    %eax,%edx
+  8009ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ce:	83 c0 08             	add    $0x8,%eax
+  8009d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009dc:	e9 a8 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  8009e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ed:	eb e5                	jmp    8009d4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	77 15                	ja     800a0c <vprintfmt+0x543>
+  8009f7:	89 c2                	mov    %eax,%edx
+  8009f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fd:	83 c0 08             	add    $0x8,%eax
+  800a00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a03:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a05:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a0a:	eb 7d                	jmp    800a89 <vprintfmt+0x5c0>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb e9                	jmp    800a03 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 16                	ja     800a38 <vprintfmt+0x56f>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a31:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a36:	eb 51                	jmp    800a89 <vprintfmt+0x5c0>
+  800a38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a44:	eb e8                	jmp    800a2e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a52:	e9 5c ff ff ff       	jmp    8009b3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a5f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a62:	4c 89 ee             	mov    %r13,%rsi
+  800a65:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a6a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 47                	ja     800abc <vprintfmt+0x5f3>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a84:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a89:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a91:	0f 94 c0             	sete   %al
+  800a94:	0f b6 c0             	movzbl %al,%eax
+  800a97:	50                   	push   %rax
+  800a98:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a9d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa1:	4c 89 ee             	mov    %r13,%rsi
+  800aa4:	4c 89 f7             	mov    %r14,%rdi
+  800aa7:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800aae:	00 00 00 
+  800ab1:	ff d0                	call   *%rax
+            break;
+  800ab3:	48 83 c4 10          	add    $0x10,%rsp
+  800ab7:	e9 3e fa ff ff       	jmp    8004fa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb b7                	jmp    800a81 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aca:	40 84 f6             	test   %sil,%sil
+  800acd:	75 2b                	jne    800afa <vprintfmt+0x631>
+    switch (lflag) {
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 56                	je     800b29 <vprintfmt+0x660>
+  800ad3:	83 fa 01             	cmp    $0x1,%edx
+  800ad6:	74 7f                	je     800b57 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	0f 87 a2 00 00 00    	ja     800b86 <vprintfmt+0x6bd>
+  800ae4:	89 c2                	mov    %eax,%edx
+  800ae6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aea:	83 c0 08             	add    $0x8,%eax
+  800aed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af8:	eb 8f                	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 19                	ja     800b1b <vprintfmt+0x652>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b11:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b16:	e9 6e ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	eb e5                	jmp    800b0e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 18                	ja     800b49 <vprintfmt+0x680>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b44:	e9 40 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb e6                	jmp    800b3d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	77 19                	ja     800b78 <vprintfmt+0x6af>
+  800b5f:	89 c2                	mov    %eax,%edx
+  800b61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b65:	83 c0 08             	add    $0x8,%eax
+  800b68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b73:	e9 11 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b84:	eb e5                	jmp    800b6b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	e9 59 ff ff ff       	jmp    800af0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b97:	4c 89 ee             	mov    %r13,%rsi
+  800b9a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b9f:	41 ff d6             	call   *%r14
+            break;
+  800ba2:	e9 53 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	bf 25 00 00 00       	mov    $0x25,%edi
+  800baf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb2:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bba:	75 f6                	jne    800bb2 <vprintfmt+0x6e9>
+  800bbc:	e9 39 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+}
+  800bc1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc5:	5b                   	pop    %rbx
+  800bc6:	41 5c                	pop    %r12
+  800bc8:	41 5d                	pop    %r13
+  800bca:	41 5e                	pop    %r14
+  800bcc:	41 5f                	pop    %r15
+  800bce:	5d                   	pop    %rbp
+  800bcf:	c3                   	ret
+
+0000000000800bd0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdc:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bec:	48 85 ff             	test   %rdi,%rdi
+  800bef:	74 2b                	je     800c1c <vsnprintf+0x4c>
+  800bf1:	48 85 f6             	test   %rsi,%rsi
+  800bf4:	74 26                	je     800c1c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bfa:	48 bf 74 04 80 00 00 	movabs $0x800474,%rdi
+  800c01:	00 00 00 
+  800c04:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800c0b:	00 00 00 
+  800c0e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c14:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c21:	eb f7                	jmp    800c1a <vsnprintf+0x4a>
+
+0000000000800c23 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c23:	55                   	push   %rbp
+  800c24:	48 89 e5             	mov    %rsp,%rbp
+  800c27:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c33:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c37:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c3e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c46:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c4e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c52:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c5e:	c9                   	leave
+  800c5f:	c3                   	ret
+
+0000000000800c60 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c60:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c63:	74 10                	je     800c75 <strlen+0x15>
+    size_t n = 0;
+  800c65:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c6a:	48 83 c0 01          	add    $0x1,%rax
+  800c6e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c72:	75 f6                	jne    800c6a <strlen+0xa>
+  800c74:	c3                   	ret
+    size_t n = 0;
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c7a:	c3                   	ret
+
+0000000000800c7b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c7b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c83:	48 85 f6             	test   %rsi,%rsi
+  800c86:	74 11                	je     800c99 <strnlen+0x1e>
+  800c88:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c8c:	74 0c                	je     800c9a <strnlen+0x1f>
+  800c8e:	48 83 c2 01          	add    $0x1,%rdx
+  800c92:	48 39 d0             	cmp    %rdx,%rax
+  800c95:	75 f1                	jne    800c88 <strnlen+0xd>
+  800c97:	eb 04                	jmp    800c9d <strnlen+0x22>
+  800c99:	c3                   	ret
+  800c9a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c9e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800caa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cad:	48 83 c2 01          	add    $0x1,%rdx
+  800cb1:	84 c9                	test   %cl,%cl
+  800cb3:	75 f1                	jne    800ca6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb5:	c3                   	ret
+
+0000000000800cb6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb6:	55                   	push   %rbp
+  800cb7:	48 89 e5             	mov    %rsp,%rbp
+  800cba:	41 54                	push   %r12
+  800cbc:	53                   	push   %rbx
+  800cbd:	48 89 fb             	mov    %rdi,%rbx
+  800cc0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc3:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ccf:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd3:	4c 89 e6             	mov    %r12,%rsi
+  800cd6:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce2:	48 89 d8             	mov    %rbx,%rax
+  800ce5:	5b                   	pop    %rbx
+  800ce6:	41 5c                	pop    %r12
+  800ce8:	5d                   	pop    %rbp
+  800ce9:	c3                   	ret
+
+0000000000800cea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ced:	48 85 d2             	test   %rdx,%rdx
+  800cf0:	74 1f                	je     800d11 <strncpy+0x27>
+  800cf2:	48 01 fa             	add    %rdi,%rdx
+  800cf5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf8:	48 83 c1 01          	add    $0x1,%rcx
+  800cfc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d00:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d04:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d08:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d0c:	48 39 ca             	cmp    %rcx,%rdx
+  800d0f:	75 e7                	jne    800cf8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d11:	c3                   	ret
+
+0000000000800d12 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d12:	48 89 f8             	mov    %rdi,%rax
+  800d15:	48 85 d2             	test   %rdx,%rdx
+  800d18:	74 24                	je     800d3e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d1a:	48 83 ea 01          	sub    $0x1,%rdx
+  800d1e:	74 1b                	je     800d3b <strlcpy+0x29>
+  800d20:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d24:	0f b6 16             	movzbl (%rsi),%edx
+  800d27:	84 d2                	test   %dl,%dl
+  800d29:	74 10                	je     800d3b <strlcpy+0x29>
+            *dst++ = *src++;
+  800d2b:	48 83 c6 01          	add    $0x1,%rsi
+  800d2f:	48 83 c0 01          	add    $0x1,%rax
+  800d33:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d36:	48 39 c8             	cmp    %rcx,%rax
+  800d39:	75 e9                	jne    800d24 <strlcpy+0x12>
+        *dst = '\0';
+  800d3b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d3e:	48 29 f8             	sub    %rdi,%rax
+}
+  800d41:	c3                   	ret
+
+0000000000800d42 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d42:	0f b6 07             	movzbl (%rdi),%eax
+  800d45:	84 c0                	test   %al,%al
+  800d47:	74 13                	je     800d5c <strcmp+0x1a>
+  800d49:	38 06                	cmp    %al,(%rsi)
+  800d4b:	75 0f                	jne    800d5c <strcmp+0x1a>
+  800d4d:	48 83 c7 01          	add    $0x1,%rdi
+  800d51:	48 83 c6 01          	add    $0x1,%rsi
+  800d55:	0f b6 07             	movzbl (%rdi),%eax
+  800d58:	84 c0                	test   %al,%al
+  800d5a:	75 ed                	jne    800d49 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d5c:	0f b6 c0             	movzbl %al,%eax
+  800d5f:	0f b6 16             	movzbl (%rsi),%edx
+  800d62:	29 d0                	sub    %edx,%eax
+}
+  800d64:	c3                   	ret
+
+0000000000800d65 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d65:	48 85 d2             	test   %rdx,%rdx
+  800d68:	74 1f                	je     800d89 <strncmp+0x24>
+  800d6a:	0f b6 07             	movzbl (%rdi),%eax
+  800d6d:	84 c0                	test   %al,%al
+  800d6f:	74 1e                	je     800d8f <strncmp+0x2a>
+  800d71:	3a 06                	cmp    (%rsi),%al
+  800d73:	75 1a                	jne    800d8f <strncmp+0x2a>
+  800d75:	48 83 c7 01          	add    $0x1,%rdi
+  800d79:	48 83 c6 01          	add    $0x1,%rsi
+  800d7d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d81:	75 e7                	jne    800d6a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	c3                   	ret
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8e:	c3                   	ret
+  800d8f:	48 85 d2             	test   %rdx,%rdx
+  800d92:	74 09                	je     800d9d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d94:	0f b6 07             	movzbl (%rdi),%eax
+  800d97:	0f b6 16             	movzbl (%rsi),%edx
+  800d9a:	29 d0                	sub    %edx,%eax
+  800d9c:	c3                   	ret
+    if (!n) return 0;
+  800d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da2:	c3                   	ret
+
+0000000000800da3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da3:	0f b6 17             	movzbl (%rdi),%edx
+  800da6:	84 d2                	test   %dl,%dl
+  800da8:	74 18                	je     800dc2 <strchr+0x1f>
+        if (*str == c) {
+  800daa:	0f be d2             	movsbl %dl,%edx
+  800dad:	39 f2                	cmp    %esi,%edx
+  800daf:	74 17                	je     800dc8 <strchr+0x25>
+    for (; *str; str++) {
+  800db1:	48 83 c7 01          	add    $0x1,%rdi
+  800db5:	0f b6 17             	movzbl (%rdi),%edx
+  800db8:	84 d2                	test   %dl,%dl
+  800dba:	75 ee                	jne    800daa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	c3                   	ret
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	c3                   	ret
+  800dc8:	48 89 f8             	mov    %rdi,%rax
+}
+  800dcb:	c3                   	ret
+
+0000000000800dcc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dcf:	0f b6 17             	movzbl (%rdi),%edx
+  800dd2:	84 d2                	test   %dl,%dl
+  800dd4:	74 13                	je     800de9 <strfind+0x1d>
+  800dd6:	0f be d2             	movsbl %dl,%edx
+  800dd9:	39 f2                	cmp    %esi,%edx
+  800ddb:	74 0b                	je     800de8 <strfind+0x1c>
+  800ddd:	48 83 c0 01          	add    $0x1,%rax
+  800de1:	0f b6 10             	movzbl (%rax),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	75 ee                	jne    800dd6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de8:	c3                   	ret
+  800de9:	c3                   	ret
+
+0000000000800dea <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dea:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ded:	48 89 f8             	mov    %rdi,%rax
+  800df0:	48 f7 d8             	neg    %rax
+  800df3:	83 e0 07             	and    $0x7,%eax
+  800df6:	49 89 d1             	mov    %rdx,%r9
+  800df9:	49 29 c1             	sub    %rax,%r9
+  800dfc:	78 36                	js     800e34 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dfe:	40 0f b6 c6          	movzbl %sil,%eax
+  800e02:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e09:	01 01 01 
+  800e0c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e10:	40 f6 c7 07          	test   $0x7,%dil
+  800e14:	75 38                	jne    800e4e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e16:	4c 89 c9             	mov    %r9,%rcx
+  800e19:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e1d:	74 0c                	je     800e2b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e1f:	fc                   	cld
+  800e20:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e23:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e27:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e2b:	4d 85 c9             	test   %r9,%r9
+  800e2e:	75 45                	jne    800e75 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e30:	4c 89 c0             	mov    %r8,%rax
+  800e33:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e34:	48 85 d2             	test   %rdx,%rdx
+  800e37:	74 f7                	je     800e30 <memset+0x46>
+  800e39:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e3c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e47:	48 39 c2             	cmp    %rax,%rdx
+  800e4a:	75 f3                	jne    800e3f <memset+0x55>
+  800e4c:	eb e2                	jmp    800e30 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e4e:	40 f6 c7 01          	test   $0x1,%dil
+  800e52:	74 06                	je     800e5a <memset+0x70>
+  800e54:	88 07                	mov    %al,(%rdi)
+  800e56:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5a:	40 f6 c7 02          	test   $0x2,%dil
+  800e5e:	74 07                	je     800e67 <memset+0x7d>
+  800e60:	66 89 07             	mov    %ax,(%rdi)
+  800e63:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e67:	40 f6 c7 04          	test   $0x4,%dil
+  800e6b:	74 a9                	je     800e16 <memset+0x2c>
+  800e6d:	89 07                	mov    %eax,(%rdi)
+  800e6f:	48 83 c7 04          	add    $0x4,%rdi
+  800e73:	eb a1                	jmp    800e16 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e75:	41 f6 c1 04          	test   $0x4,%r9b
+  800e79:	74 06                	je     800e81 <memset+0x97>
+  800e7b:	89 07                	mov    %eax,(%rdi)
+  800e7d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e81:	41 f6 c1 02          	test   $0x2,%r9b
+  800e85:	74 07                	je     800e8e <memset+0xa4>
+  800e87:	66 89 07             	mov    %ax,(%rdi)
+  800e8a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e8e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e92:	74 9c                	je     800e30 <memset+0x46>
+  800e94:	88 07                	mov    %al,(%rdi)
+  800e96:	eb 98                	jmp    800e30 <memset+0x46>
+
+0000000000800e98 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e98:	48 89 f8             	mov    %rdi,%rax
+  800e9b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e9e:	48 39 fe             	cmp    %rdi,%rsi
+  800ea1:	73 3b                	jae    800ede <memmove+0x46>
+  800ea3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea7:	48 39 d7             	cmp    %rdx,%rdi
+  800eaa:	73 32                	jae    800ede <memmove+0x46>
+        s += n;
+        d += n;
+  800eac:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb0:	48 89 d6             	mov    %rdx,%rsi
+  800eb3:	48 09 fe             	or     %rdi,%rsi
+  800eb6:	48 09 ce             	or     %rcx,%rsi
+  800eb9:	40 f6 c6 07          	test   $0x7,%sil
+  800ebd:	75 12                	jne    800ed1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ebf:	48 83 ef 08          	sub    $0x8,%rdi
+  800ec3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ecb:	fd                   	std
+  800ecc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ecf:	fc                   	cld
+  800ed0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ed1:	48 83 ef 01          	sub    $0x1,%rdi
+  800ed5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed9:	fd                   	std
+  800eda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800edc:	eb f1                	jmp    800ecf <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ede:	48 89 f2             	mov    %rsi,%rdx
+  800ee1:	48 09 c2             	or     %rax,%rdx
+  800ee4:	48 09 ca             	or     %rcx,%rdx
+  800ee7:	f6 c2 07             	test   $0x7,%dl
+  800eea:	75 0c                	jne    800ef8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800eec:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	fc                   	cld
+  800ef4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef8:	48 89 c7             	mov    %rax,%rdi
+  800efb:	fc                   	cld
+  800efc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800efe:	c3                   	ret
+
+0000000000800eff <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eff:	55                   	push   %rbp
+  800f00:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f03:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+}
+  800f0f:	5d                   	pop    %rbp
+  800f10:	c3                   	ret
+
+0000000000800f11 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f11:	55                   	push   %rbp
+  800f12:	48 89 e5             	mov    %rsp,%rbp
+  800f15:	41 57                	push   %r15
+  800f17:	41 56                	push   %r14
+  800f19:	41 55                	push   %r13
+  800f1b:	41 54                	push   %r12
+  800f1d:	53                   	push   %rbx
+  800f1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800f22:	49 89 fe             	mov    %rdi,%r14
+  800f25:	49 89 f7             	mov    %rsi,%r15
+  800f28:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f2b:	48 89 f7             	mov    %rsi,%rdi
+  800f2e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+  800f3a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f3d:	48 89 de             	mov    %rbx,%rsi
+  800f40:	4c 89 f7             	mov    %r14,%rdi
+  800f43:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  800f4a:	00 00 00 
+  800f4d:	ff d0                	call   *%rax
+  800f4f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f52:	48 39 c3             	cmp    %rax,%rbx
+  800f55:	74 36                	je     800f8d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f57:	48 89 d8             	mov    %rbx,%rax
+  800f5a:	4c 29 e8             	sub    %r13,%rax
+  800f5d:	49 39 c4             	cmp    %rax,%r12
+  800f60:	73 31                	jae    800f93 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f62:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f67:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6b:	4c 89 fe             	mov    %r15,%rsi
+  800f6e:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800f75:	00 00 00 
+  800f78:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f7a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f7e:	48 83 c4 08          	add    $0x8,%rsp
+  800f82:	5b                   	pop    %rbx
+  800f83:	41 5c                	pop    %r12
+  800f85:	41 5d                	pop    %r13
+  800f87:	41 5e                	pop    %r14
+  800f89:	41 5f                	pop    %r15
+  800f8b:	5d                   	pop    %rbp
+  800f8c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f91:	eb eb                	jmp    800f7e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f93:	48 83 eb 01          	sub    $0x1,%rbx
+  800f97:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9b:	48 89 da             	mov    %rbx,%rdx
+  800f9e:	4c 89 fe             	mov    %r15,%rsi
+  800fa1:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800fa8:	00 00 00 
+  800fab:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fad:	49 01 de             	add    %rbx,%r14
+  800fb0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fb5:	eb c3                	jmp    800f7a <strlcat+0x69>
+
+0000000000800fb7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb7:	48 85 d2             	test   %rdx,%rdx
+  800fba:	74 2d                	je     800fe9 <memcmp+0x32>
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fc1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fc5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fca:	44 38 c1             	cmp    %r8b,%cl
+  800fcd:	75 0f                	jne    800fde <memcmp+0x27>
+    while (n-- > 0) {
+  800fcf:	48 83 c0 01          	add    $0x1,%rax
+  800fd3:	48 39 c2             	cmp    %rax,%rdx
+  800fd6:	75 e9                	jne    800fc1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fde:	0f b6 c1             	movzbl %cl,%eax
+  800fe1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fe5:	44 29 c0             	sub    %r8d,%eax
+  800fe8:	c3                   	ret
+    return 0;
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fee:	c3                   	ret
+
+0000000000800fef <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fef:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ff3:	48 39 c7             	cmp    %rax,%rdi
+  800ff6:	73 0f                	jae    801007 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff8:	40 38 37             	cmp    %sil,(%rdi)
+  800ffb:	74 0e                	je     80100b <memfind+0x1c>
+    for (; src < end; src++) {
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+  801001:	48 39 f8             	cmp    %rdi,%rax
+  801004:	75 f2                	jne    800ff8 <memfind+0x9>
+  801006:	c3                   	ret
+  801007:	48 89 f8             	mov    %rdi,%rax
+  80100a:	c3                   	ret
+  80100b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80100e:	c3                   	ret
+
+000000000080100f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80100f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801012:	0f b6 37             	movzbl (%rdi),%esi
+  801015:	40 80 fe 20          	cmp    $0x20,%sil
+  801019:	74 06                	je     801021 <strtol+0x12>
+  80101b:	40 80 fe 09          	cmp    $0x9,%sil
+  80101f:	75 13                	jne    801034 <strtol+0x25>
+  801021:	48 83 c7 01          	add    $0x1,%rdi
+  801025:	0f b6 37             	movzbl (%rdi),%esi
+  801028:	40 80 fe 20          	cmp    $0x20,%sil
+  80102c:	74 f3                	je     801021 <strtol+0x12>
+  80102e:	40 80 fe 09          	cmp    $0x9,%sil
+  801032:	74 ed                	je     801021 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801034:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801037:	83 e0 fd             	and    $0xfffffffd,%eax
+  80103a:	3c 01                	cmp    $0x1,%al
+  80103c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801040:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801046:	75 0f                	jne    801057 <strtol+0x48>
+  801048:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80104b:	74 14                	je     801061 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80104d:	85 d2                	test   %edx,%edx
+  80104f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801054:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801057:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80105c:	4c 63 ca             	movslq %edx,%r9
+  80105f:	eb 36                	jmp    801097 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801061:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801065:	74 0f                	je     801076 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801067:	85 d2                	test   %edx,%edx
+  801069:	75 ec                	jne    801057 <strtol+0x48>
+        s++;
+  80106b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80106f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801074:	eb e1                	jmp    801057 <strtol+0x48>
+        s += 2;
+  801076:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80107a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80107f:	eb d6                	jmp    801057 <strtol+0x48>
+            dig -= '0';
+  801081:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801084:	44 0f b6 c1          	movzbl %cl,%r8d
+  801088:	41 39 d0             	cmp    %edx,%r8d
+  80108b:	7d 21                	jge    8010ae <strtol+0x9f>
+        val = val * base + dig;
+  80108d:	49 0f af c1          	imul   %r9,%rax
+  801091:	0f b6 c9             	movzbl %cl,%ecx
+  801094:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801097:	48 83 c7 01          	add    $0x1,%rdi
+  80109b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80109f:	80 f9 39             	cmp    $0x39,%cl
+  8010a2:	76 dd                	jbe    801081 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010a4:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a7:	77 05                	ja     8010ae <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a9:	83 e9 57             	sub    $0x57,%ecx
+  8010ac:	eb d6                	jmp    801084 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ae:	4d 85 d2             	test   %r10,%r10
+  8010b1:	74 03                	je     8010b6 <strtol+0xa7>
+  8010b3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010b6:	48 89 c2             	mov    %rax,%rdx
+  8010b9:	48 f7 da             	neg    %rdx
+  8010bc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010c0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010c4:	c3                   	ret
+
+00000000008010c5 <strrev>:
+
+void
+strrev(char *str)
+{
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	53                   	push   %rbx
+  8010ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ce:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8010d1:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  8010d8:	00 00 00 
+  8010db:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010dd:	83 e8 01             	sub    $0x1,%eax
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	7e 22                	jle    801106 <strrev+0x41>
+  8010e4:	48 98                	cltq
+  8010e6:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8010eb:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8010ef:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8010f3:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8010f7:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8010fa:	48 83 c2 01          	add    $0x1,%rdx
+  8010fe:	48 83 e8 01          	sub    $0x1,%rax
+  801102:	39 c2                	cmp    %eax,%edx
+  801104:	7c e5                	jl     8010eb <strrev+0x26>
+	}
+}
+  801106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110a:	c9                   	leave
+  80110b:	c3                   	ret
+
+000000000080110c <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80110c:	85 d2                	test   %edx,%edx
+  80110e:	0f 84 80 00 00 00    	je     801194 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	53                   	push   %rbx
+  801119:	48 83 ec 08          	sub    $0x8,%rsp
+  80111d:	49 89 f2             	mov    %rsi,%r10
+  801120:	41 89 d3             	mov    %edx,%r11d
+  801123:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801126:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80112b:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80112e:	eb 20                	jmp    801150 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801130:	41 89 f1             	mov    %esi,%r9d
+  801133:	83 c2 30             	add    $0x30,%edx
+  801136:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801139:	89 f8                	mov    %edi,%eax
+  80113b:	99                   	cltd
+  80113c:	f7 f9                	idiv   %ecx
+  80113e:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801140:	85 c0                	test   %eax,%eax
+  801142:	74 2e                	je     801172 <itoa+0x66>
+  801144:	83 c6 01             	add    $0x1,%esi
+  801147:	49 83 c0 01          	add    $0x1,%r8
+  80114b:	44 39 cb             	cmp    %r9d,%ebx
+  80114e:	7e 15                	jle    801165 <itoa+0x59>
+		digit = sum % base;
+  801150:	89 f8                	mov    %edi,%eax
+  801152:	99                   	cltd
+  801153:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801155:	83 fa 09             	cmp    $0x9,%edx
+  801158:	7e d6                	jle    801130 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80115a:	41 89 f1             	mov    %esi,%r9d
+  80115d:	83 c2 37             	add    $0x37,%edx
+  801160:	41 88 10             	mov    %dl,(%r8)
+  801163:	eb d4                	jmp    801139 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801165:	41 83 eb 01          	sub    $0x1,%r11d
+  801169:	45 39 cb             	cmp    %r9d,%r11d
+  80116c:	75 04                	jne    801172 <itoa+0x66>
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	75 28                	jne    80119a <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801172:	4d 63 c9             	movslq %r9d,%r9
+  801175:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80117a:	4c 89 d7             	mov    %r10,%rdi
+  80117d:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  801184:	00 00 00 
+  801187:	ff d0                	call   *%rax
+	return 0;
+  801189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+		return -1;
+  801194:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801199:	c3                   	ret
+		return -1;
+  80119a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80119f:	eb ed                	jmp    80118e <itoa+0x82>
+
+00000000008011a1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011a1:	55                   	push   %rbp
+  8011a2:	48 89 e5             	mov    %rsp,%rbp
+  8011a5:	53                   	push   %rbx
+  8011a6:	48 89 fa             	mov    %rdi,%rdx
+  8011a9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ac:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cc:	c9                   	leave
+  8011cd:	c3                   	ret
+
+00000000008011ce <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+  8011d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fd:	c9                   	leave
+  8011fe:	c3                   	ret
+
+00000000008011ff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011ff:	55                   	push   %rbp
+  801200:	48 89 e5             	mov    %rsp,%rbp
+  801203:	53                   	push   %rbx
+  801204:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801208:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801210:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121f:	be 00 00 00 00       	mov    $0x0,%esi
+  801224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122c:	48 85 c0             	test   %rax,%rax
+  80122f:	7f 06                	jg     801237 <sys_env_destroy+0x38>
+}
+  801231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801237:	49 89 c0             	mov    %rax,%r8
+  80123a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80123f:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801246:	00 00 00 
+  801249:	be 26 00 00 00       	mov    $0x26,%esi
+  80124e:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801255:	00 00 00 
+  801258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125d:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801264:	00 00 00 
+  801267:	41 ff d1             	call   *%r9
+
+000000000080126a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+  80126e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80126f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801274:	ba 00 00 00 00       	mov    $0x0,%edx
+  801279:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801288:	be 00 00 00 00       	mov    $0x0,%esi
+  80128d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801293:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801299:	c9                   	leave
+  80129a:	c3                   	ret
+
+000000000080129b <sys_yield>:
+
+void
+sys_yield(void) {
+  80129b:	55                   	push   %rbp
+  80129c:	48 89 e5             	mov    %rsp,%rbp
+  80129f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ca:	c9                   	leave
+  8012cb:	c3                   	ret
+
+00000000008012cc <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012cc:	55                   	push   %rbp
+  8012cd:	48 89 e5             	mov    %rsp,%rbp
+  8012d0:	53                   	push   %rbx
+  8012d1:	48 89 fa             	mov    %rdi,%rdx
+  8012d4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012dc:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012e3:	00 00 00 
+  8012e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+
+00000000008012fe <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+  801302:	53                   	push   %rbx
+  801303:	49 89 f8             	mov    %rdi,%r8
+  801306:	48 89 d3             	mov    %rdx,%rbx
+  801309:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80130c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801311:	4c 89 c2             	mov    %r8,%rdx
+  801314:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801317:	be 00 00 00 00       	mov    $0x0,%esi
+  80131c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801322:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801324:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801328:	c9                   	leave
+  801329:	c3                   	ret
+
+000000000080132a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	53                   	push   %rbx
+  80132f:	48 83 ec 08          	sub    $0x8,%rsp
+  801333:	89 f8                	mov    %edi,%eax
+  801335:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801338:	48 63 f9             	movslq %ecx,%rdi
+  80133b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801343:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801346:	be 00 00 00 00       	mov    $0x0,%esi
+  80134b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801351:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801353:	48 85 c0             	test   %rax,%rax
+  801356:	7f 06                	jg     80135e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801358:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135e:	49 89 c0             	mov    %rax,%r8
+  801361:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801366:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  80136d:	00 00 00 
+  801370:	be 26 00 00 00       	mov    $0x26,%esi
+  801375:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  80137c:	00 00 00 
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801384:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80138b:	00 00 00 
+  80138e:	41 ff d1             	call   *%r9
+
+0000000000801391 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801391:	55                   	push   %rbp
+  801392:	48 89 e5             	mov    %rsp,%rbp
+  801395:	53                   	push   %rbx
+  801396:	48 83 ec 08          	sub    $0x8,%rsp
+  80139a:	89 f8                	mov    %edi,%eax
+  80139c:	49 89 f2             	mov    %rsi,%r10
+  80139f:	48 89 cf             	mov    %rcx,%rdi
+  8013a2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013a5:	48 63 da             	movslq %edx,%rbx
+  8013a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b8:	48 85 c0             	test   %rax,%rax
+  8013bb:	7f 06                	jg     8013c3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c1:	c9                   	leave
+  8013c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c3:	49 89 c0             	mov    %rax,%r8
+  8013c6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013cb:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  8013d2:	00 00 00 
+  8013d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8013da:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  8013e1:	00 00 00 
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e9:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8013f0:	00 00 00 
+  8013f3:	41 ff d1             	call   *%r9
+
+00000000008013f6 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013f6:	55                   	push   %rbp
+  8013f7:	48 89 e5             	mov    %rsp,%rbp
+  8013fa:	53                   	push   %rbx
+  8013fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ff:	48 89 f1             	mov    %rsi,%rcx
+  801402:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801405:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801412:	be 00 00 00 00       	mov    $0x0,%esi
+  801417:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141f:	48 85 c0             	test   %rax,%rax
+  801422:	7f 06                	jg     80142a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801424:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801428:	c9                   	leave
+  801429:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142a:	49 89 c0             	mov    %rax,%r8
+  80142d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801432:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801439:	00 00 00 
+  80143c:	be 26 00 00 00       	mov    $0x26,%esi
+  801441:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801448:	00 00 00 
+  80144b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801450:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801457:	00 00 00 
+  80145a:	41 ff d1             	call   *%r9
+
+000000000080145d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80145d:	55                   	push   %rbp
+  80145e:	48 89 e5             	mov    %rsp,%rbp
+  801461:	53                   	push   %rbx
+  801462:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801466:	48 63 ce             	movslq %esi,%rcx
+  801469:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801471:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801476:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801486:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801488:	48 85 c0             	test   %rax,%rax
+  80148b:	7f 06                	jg     801493 <sys_env_set_status+0x36>
+}
+  80148d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801493:	49 89 c0             	mov    %rax,%r8
+  801496:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80149b:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  8014a2:	00 00 00 
+  8014a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014aa:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  8014b1:	00 00 00 
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8014c0:	00 00 00 
+  8014c3:	41 ff d1             	call   *%r9
+
+00000000008014c6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014c6:	55                   	push   %rbp
+  8014c7:	48 89 e5             	mov    %rsp,%rbp
+  8014ca:	53                   	push   %rbx
+  8014cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f1:	48 85 c0             	test   %rax,%rax
+  8014f4:	7f 06                	jg     8014fc <sys_env_set_trapframe+0x36>
+}
+  8014f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fc:	49 89 c0             	mov    %rax,%r8
+  8014ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801504:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  80150b:	00 00 00 
+  80150e:	be 26 00 00 00       	mov    $0x26,%esi
+  801513:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  80151a:	00 00 00 
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801522:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801529:	00 00 00 
+  80152c:	41 ff d1             	call   *%r9
+
+000000000080152f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	53                   	push   %rbx
+  801534:	48 83 ec 08          	sub    $0x8,%rsp
+  801538:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80153b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801548:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154d:	be 00 00 00 00       	mov    $0x0,%esi
+  801552:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801558:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155a:	48 85 c0             	test   %rax,%rax
+  80155d:	7f 06                	jg     801565 <sys_env_set_pgfault_upcall+0x36>
+}
+  80155f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801563:	c9                   	leave
+  801564:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801565:	49 89 c0             	mov    %rax,%r8
+  801568:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80156d:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801574:	00 00 00 
+  801577:	be 26 00 00 00       	mov    $0x26,%esi
+  80157c:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801583:	00 00 00 
+  801586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158b:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801592:	00 00 00 
+  801595:	41 ff d1             	call   *%r9
+
+0000000000801598 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801598:	55                   	push   %rbp
+  801599:	48 89 e5             	mov    %rsp,%rbp
+  80159c:	53                   	push   %rbx
+  80159d:	89 f8                	mov    %edi,%eax
+  80159f:	49 89 f1             	mov    %rsi,%r9
+  8015a2:	48 89 d3             	mov    %rdx,%rbx
+  8015a5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015a8:	49 63 f0             	movslq %r8d,%rsi
+  8015ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bc:	cd 30                	int    $0x30
+}
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+00000000008015c4 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8015c4:	55                   	push   %rbp
+  8015c5:	48 89 e5             	mov    %rsp,%rbp
+  8015c8:	53                   	push   %rbx
+  8015c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cd:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8015d0:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d8:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ed:	48 85 c0             	test   %rax,%rax
+  8015f0:	7f 06                	jg     8015f8 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f8:	49 89 c0             	mov    %rax,%r8
+  8015fb:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801600:	48 ba c8 3d 80 00 00 	movabs $0x803dc8,%rdx
+  801607:	00 00 00 
+  80160a:	be 26 00 00 00       	mov    $0x26,%esi
+  80160f:	48 bf e7 3d 80 00 00 	movabs $0x803de7,%rdi
+  801616:	00 00 00 
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801625:	00 00 00 
+  801628:	41 ff d1             	call   *%r9
+
+000000000080162b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80162b:	55                   	push   %rbp
+  80162c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80162f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801634:	48 b8 c4 15 80 00 00 	movabs $0x8015c4,%rax
+  80163b:	00 00 00 
+  80163e:	ff d0                	call   *%rax
+}
+  801640:	5d                   	pop    %rbp
+  801641:	c3                   	ret
+
+0000000000801642 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801651:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801656:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801660:	be 00 00 00 00       	mov    $0x0,%esi
+  801665:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+
+0000000000801673 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801673:	55                   	push   %rbp
+  801674:	48 89 e5             	mov    %rsp,%rbp
+  801677:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801678:	48 63 ce             	movslq %esi,%rcx
+  80167b:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80167f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168e:	be 00 00 00 00       	mov    $0x0,%esi
+  801693:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801699:	cd 30                	int    $0x30
+}
+  80169b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169f:	c9                   	leave
+  8016a0:	c3                   	ret
+
+00000000008016a1 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8016a1:	55                   	push   %rbp
+  8016a2:	48 89 e5             	mov    %rsp,%rbp
+  8016a5:	53                   	push   %rbx
+  8016a6:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8016a9:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ad:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c7:	cd 30                	int    $0x30
+}
+  8016c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+
+00000000008016cf <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8016cf:	55                   	push   %rbp
+  8016d0:	48 89 e5             	mov    %rsp,%rbp
+  8016d3:	53                   	push   %rbx
+  8016d4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8016d7:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016da:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016df:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f2:	cd 30                	int    $0x30
+}
+  8016f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+
+00000000008016fa <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016fa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801701:	ff ff ff 
+  801704:	48 01 f8             	add    %rdi,%rax
+  801707:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80170b:	c3                   	ret
+
+000000000080170c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80170c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801713:	ff ff ff 
+  801716:	48 01 f8             	add    %rdi,%rax
+  801719:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80171d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801723:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801727:	c3                   	ret
+
+0000000000801728 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801728:	55                   	push   %rbp
+  801729:	48 89 e5             	mov    %rsp,%rbp
+  80172c:	41 57                	push   %r15
+  80172e:	41 56                	push   %r14
+  801730:	41 55                	push   %r13
+  801732:	41 54                	push   %r12
+  801734:	53                   	push   %rbx
+  801735:	48 83 ec 08          	sub    $0x8,%rsp
+  801739:	49 89 ff             	mov    %rdi,%r15
+  80173c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801741:	49 bd 47 32 80 00 00 	movabs $0x803247,%r13
+  801748:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80174b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801751:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801754:	48 89 df             	mov    %rbx,%rdi
+  801757:	41 ff d5             	call   *%r13
+  80175a:	83 e0 04             	and    $0x4,%eax
+  80175d:	74 17                	je     801776 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80175f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801766:	4c 39 f3             	cmp    %r14,%rbx
+  801769:	75 e6                	jne    801751 <fd_alloc+0x29>
+  80176b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801771:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801776:	4d 89 27             	mov    %r12,(%r15)
+}
+  801779:	48 83 c4 08          	add    $0x8,%rsp
+  80177d:	5b                   	pop    %rbx
+  80177e:	41 5c                	pop    %r12
+  801780:	41 5d                	pop    %r13
+  801782:	41 5e                	pop    %r14
+  801784:	41 5f                	pop    %r15
+  801786:	5d                   	pop    %rbp
+  801787:	c3                   	ret
+
+0000000000801788 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801788:	83 ff 1f             	cmp    $0x1f,%edi
+  80178b:	77 39                	ja     8017c6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80178d:	55                   	push   %rbp
+  80178e:	48 89 e5             	mov    %rsp,%rbp
+  801791:	41 54                	push   %r12
+  801793:	53                   	push   %rbx
+  801794:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801797:	48 63 df             	movslq %edi,%rbx
+  80179a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017a1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017a5:	48 89 df             	mov    %rbx,%rdi
+  8017a8:	48 b8 47 32 80 00 00 	movabs $0x803247,%rax
+  8017af:	00 00 00 
+  8017b2:	ff d0                	call   *%rax
+  8017b4:	a8 04                	test   $0x4,%al
+  8017b6:	74 14                	je     8017cc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017b8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c1:	5b                   	pop    %rbx
+  8017c2:	41 5c                	pop    %r12
+  8017c4:	5d                   	pop    %rbp
+  8017c5:	c3                   	ret
+        return -E_INVAL;
+  8017c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017cb:	c3                   	ret
+        return -E_INVAL;
+  8017cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d1:	eb ee                	jmp    8017c1 <fd_lookup+0x39>
+
+00000000008017d3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017d3:	55                   	push   %rbp
+  8017d4:	48 89 e5             	mov    %rsp,%rbp
+  8017d7:	41 54                	push   %r12
+  8017d9:	53                   	push   %rbx
+  8017da:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017dd:	48 b8 a0 3e 80 00 00 	movabs $0x803ea0,%rax
+  8017e4:	00 00 00 
+  8017e7:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017ee:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017f1:	39 3b                	cmp    %edi,(%rbx)
+  8017f3:	74 47                	je     80183c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017f5:	48 83 c0 08          	add    $0x8,%rax
+  8017f9:	48 8b 18             	mov    (%rax),%rbx
+  8017fc:	48 85 db             	test   %rbx,%rbx
+  8017ff:	75 f0                	jne    8017f1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801801:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801808:	00 00 00 
+  80180b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801811:	89 fa                	mov    %edi,%edx
+  801813:	48 bf f8 3d 80 00 00 	movabs $0x803df8,%rdi
+  80181a:	00 00 00 
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801822:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801829:	00 00 00 
+  80182c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80182e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801833:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801837:	5b                   	pop    %rbx
+  801838:	41 5c                	pop    %r12
+  80183a:	5d                   	pop    %rbp
+  80183b:	c3                   	ret
+            return 0;
+  80183c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801841:	eb f0                	jmp    801833 <dev_lookup+0x60>
+
+0000000000801843 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+  801847:	41 55                	push   %r13
+  801849:	41 54                	push   %r12
+  80184b:	53                   	push   %rbx
+  80184c:	48 83 ec 18          	sub    $0x18,%rsp
+  801850:	48 89 fb             	mov    %rdi,%rbx
+  801853:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801856:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80185d:	ff ff ff 
+  801860:	48 01 df             	add    %rbx,%rdi
+  801863:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801867:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80186b:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801872:	00 00 00 
+  801875:	ff d0                	call   *%rax
+  801877:	41 89 c5             	mov    %eax,%r13d
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 06                	js     801884 <fd_close+0x41>
+  80187e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801882:	74 1a                	je     80189e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801884:	45 84 e4             	test   %r12b,%r12b
+  801887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801890:	44 89 e8             	mov    %r13d,%eax
+  801893:	48 83 c4 18          	add    $0x18,%rsp
+  801897:	5b                   	pop    %rbx
+  801898:	41 5c                	pop    %r12
+  80189a:	41 5d                	pop    %r13
+  80189c:	5d                   	pop    %rbp
+  80189d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80189e:	8b 3b                	mov    (%rbx),%edi
+  8018a0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018a4:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  8018ab:	00 00 00 
+  8018ae:	ff d0                	call   *%rax
+  8018b0:	41 89 c5             	mov    %eax,%r13d
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	78 1b                	js     8018d2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018bb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8018bf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018c5:	48 85 c0             	test   %rax,%rax
+  8018c8:	74 08                	je     8018d2 <fd_close+0x8f>
+  8018ca:	48 89 df             	mov    %rbx,%rdi
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d7:	48 89 de             	mov    %rbx,%rsi
+  8018da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018df:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+    return res;
+  8018eb:	eb a3                	jmp    801890 <fd_close+0x4d>
+
+00000000008018ed <close>:
+
+int
+close(int fdnum) {
+  8018ed:	55                   	push   %rbp
+  8018ee:	48 89 e5             	mov    %rsp,%rbp
+  8018f1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018f5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018f9:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801900:	00 00 00 
+  801903:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801905:	85 c0                	test   %eax,%eax
+  801907:	78 15                	js     80191e <close+0x31>
+
+    return fd_close(fd, 1);
+  801909:	be 01 00 00 00       	mov    $0x1,%esi
+  80190e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801912:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  801919:	00 00 00 
+  80191c:	ff d0                	call   *%rax
+}
+  80191e:	c9                   	leave
+  80191f:	c3                   	ret
+
+0000000000801920 <close_all>:
+
+void
+close_all(void) {
+  801920:	55                   	push   %rbp
+  801921:	48 89 e5             	mov    %rsp,%rbp
+  801924:	41 54                	push   %r12
+  801926:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192c:	49 bc ed 18 80 00 00 	movabs $0x8018ed,%r12
+  801933:	00 00 00 
+  801936:	89 df                	mov    %ebx,%edi
+  801938:	41 ff d4             	call   *%r12
+  80193b:	83 c3 01             	add    $0x1,%ebx
+  80193e:	83 fb 20             	cmp    $0x20,%ebx
+  801941:	75 f3                	jne    801936 <close_all+0x16>
+}
+  801943:	5b                   	pop    %rbx
+  801944:	41 5c                	pop    %r12
+  801946:	5d                   	pop    %rbp
+  801947:	c3                   	ret
+
+0000000000801948 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801948:	55                   	push   %rbp
+  801949:	48 89 e5             	mov    %rsp,%rbp
+  80194c:	41 57                	push   %r15
+  80194e:	41 56                	push   %r14
+  801950:	41 55                	push   %r13
+  801952:	41 54                	push   %r12
+  801954:	53                   	push   %rbx
+  801955:	48 83 ec 18          	sub    $0x18,%rsp
+  801959:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80195c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801960:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801967:	00 00 00 
+  80196a:	ff d0                	call   *%rax
+  80196c:	89 c3                	mov    %eax,%ebx
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	0f 88 b8 00 00 00    	js     801a2e <dup+0xe6>
+    close(newfdnum);
+  801976:	44 89 e7             	mov    %r12d,%edi
+  801979:	48 b8 ed 18 80 00 00 	movabs $0x8018ed,%rax
+  801980:	00 00 00 
+  801983:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801985:	4d 63 ec             	movslq %r12d,%r13
+  801988:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80198f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801993:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801997:	4c 89 ff             	mov    %r15,%rdi
+  80199a:	49 be 0c 17 80 00 00 	movabs $0x80170c,%r14
+  8019a1:	00 00 00 
+  8019a4:	41 ff d6             	call   *%r14
+  8019a7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019aa:	4c 89 ef             	mov    %r13,%rdi
+  8019ad:	41 ff d6             	call   *%r14
+  8019b0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019b3:	48 89 df             	mov    %rbx,%rdi
+  8019b6:	48 b8 47 32 80 00 00 	movabs $0x803247,%rax
+  8019bd:	00 00 00 
+  8019c0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019c2:	a8 04                	test   $0x4,%al
+  8019c4:	74 2b                	je     8019f1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019c6:	41 89 c1             	mov    %eax,%r9d
+  8019c9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019cf:	4c 89 f1             	mov    %r14,%rcx
+  8019d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d7:	48 89 de             	mov    %rbx,%rsi
+  8019da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019df:	48 b8 91 13 80 00 00 	movabs $0x801391,%rax
+  8019e6:	00 00 00 
+  8019e9:	ff d0                	call   *%rax
+  8019eb:	89 c3                	mov    %eax,%ebx
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	78 4e                	js     801a3f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019f1:	4c 89 ff             	mov    %r15,%rdi
+  8019f4:	48 b8 47 32 80 00 00 	movabs $0x803247,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+  801a00:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a03:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a09:	4c 89 e9             	mov    %r13,%rcx
+  801a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a11:	4c 89 fe             	mov    %r15,%rsi
+  801a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a19:	48 b8 91 13 80 00 00 	movabs $0x801391,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+  801a25:	89 c3                	mov    %eax,%ebx
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	78 14                	js     801a3f <dup+0xf7>
+
+    return newfdnum;
+  801a2b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a2e:	89 d8                	mov    %ebx,%eax
+  801a30:	48 83 c4 18          	add    $0x18,%rsp
+  801a34:	5b                   	pop    %rbx
+  801a35:	41 5c                	pop    %r12
+  801a37:	41 5d                	pop    %r13
+  801a39:	41 5e                	pop    %r14
+  801a3b:	41 5f                	pop    %r15
+  801a3d:	5d                   	pop    %rbp
+  801a3e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a44:	4c 89 ee             	mov    %r13,%rsi
+  801a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a4c:	49 bc f6 13 80 00 00 	movabs $0x8013f6,%r12
+  801a53:	00 00 00 
+  801a56:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a5e:	4c 89 f6             	mov    %r14,%rsi
+  801a61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a66:	41 ff d4             	call   *%r12
+    return res;
+  801a69:	eb c3                	jmp    801a2e <dup+0xe6>
+
+0000000000801a6b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	41 56                	push   %r14
+  801a71:	41 55                	push   %r13
+  801a73:	41 54                	push   %r12
+  801a75:	53                   	push   %rbx
+  801a76:	48 83 ec 10          	sub    $0x10,%rsp
+  801a7a:	89 fb                	mov    %edi,%ebx
+  801a7c:	49 89 f4             	mov    %rsi,%r12
+  801a7f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a82:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a86:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 4c                	js     801ae2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a96:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a9a:	41 8b 3e             	mov    (%r14),%edi
+  801a9d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aa1:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801aa8:	00 00 00 
+  801aab:	ff d0                	call   *%rax
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	78 35                	js     801ae6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ab1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ab5:	83 e0 03             	and    $0x3,%eax
+  801ab8:	83 f8 01             	cmp    $0x1,%eax
+  801abb:	74 2d                	je     801aea <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801abd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ac5:	48 85 c0             	test   %rax,%rax
+  801ac8:	74 56                	je     801b20 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801aca:	4c 89 ea             	mov    %r13,%rdx
+  801acd:	4c 89 e6             	mov    %r12,%rsi
+  801ad0:	4c 89 f7             	mov    %r14,%rdi
+  801ad3:	ff d0                	call   *%rax
+}
+  801ad5:	48 83 c4 10          	add    $0x10,%rsp
+  801ad9:	5b                   	pop    %rbx
+  801ada:	41 5c                	pop    %r12
+  801adc:	41 5d                	pop    %r13
+  801ade:	41 5e                	pop    %r14
+  801ae0:	5d                   	pop    %rbp
+  801ae1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ae2:	48 98                	cltq
+  801ae4:	eb ef                	jmp    801ad5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae6:	48 98                	cltq
+  801ae8:	eb eb                	jmp    801ad5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aea:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801af1:	00 00 00 
+  801af4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801afa:	89 da                	mov    %ebx,%edx
+  801afc:	48 bf 59 3e 80 00 00 	movabs $0x803e59,%rdi
+  801b03:	00 00 00 
+  801b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801b12:	00 00 00 
+  801b15:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b17:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b1e:	eb b5                	jmp    801ad5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b20:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b27:	eb ac                	jmp    801ad5 <read+0x6a>
+
+0000000000801b29 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801b29:	55                   	push   %rbp
+  801b2a:	48 89 e5             	mov    %rsp,%rbp
+  801b2d:	41 56                	push   %r14
+  801b2f:	41 55                	push   %r13
+  801b31:	41 54                	push   %r12
+  801b33:	53                   	push   %rbx
+  801b34:	48 83 ec 10          	sub    $0x10,%rsp
+  801b38:	89 fb                	mov    %edi,%ebx
+  801b3a:	49 89 f4             	mov    %rsi,%r12
+  801b3d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b40:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b44:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801b4b:	00 00 00 
+  801b4e:	ff d0                	call   *%rax
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	78 41                	js     801b95 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b54:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b58:	41 8b 3e             	mov    (%r14),%edi
+  801b5b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b5f:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 35                	js     801ba4 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b6f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b73:	83 e0 03             	and    $0x3,%eax
+  801b76:	83 f8 01             	cmp    $0x1,%eax
+  801b79:	74 2d                	je     801ba8 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801b7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b7f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b83:	48 85 c0             	test   %rax,%rax
+  801b86:	74 56                	je     801bde <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801b88:	4c 89 ea             	mov    %r13,%rdx
+  801b8b:	4c 89 e6             	mov    %r12,%rsi
+  801b8e:	4c 89 f7             	mov    %r14,%rdi
+  801b91:	ff d0                	call   *%rax
+  801b93:	eb 02                	jmp    801b97 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b95:	48 98                	cltq
+}
+  801b97:	48 83 c4 10          	add    $0x10,%rsp
+  801b9b:	5b                   	pop    %rbx
+  801b9c:	41 5c                	pop    %r12
+  801b9e:	41 5d                	pop    %r13
+  801ba0:	41 5e                	pop    %r14
+  801ba2:	5d                   	pop    %rbp
+  801ba3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba4:	48 98                	cltq
+  801ba6:	eb ef                	jmp    801b97 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ba8:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801baf:	00 00 00 
+  801bb2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bb8:	89 da                	mov    %ebx,%edx
+  801bba:	48 bf 18 3e 80 00 00 	movabs $0x803e18,%rdi
+  801bc1:	00 00 00 
+  801bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc9:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801bd0:	00 00 00 
+  801bd3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bd5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bdc:	eb b9                	jmp    801b97 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801bde:	4c 89 ea             	mov    %r13,%rdx
+  801be1:	4c 89 e6             	mov    %r12,%rsi
+  801be4:	89 df                	mov    %ebx,%edi
+  801be6:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	eb a3                	jmp    801b97 <readmap+0x6e>
+
+0000000000801bf4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bf4:	55                   	push   %rbp
+  801bf5:	48 89 e5             	mov    %rsp,%rbp
+  801bf8:	41 57                	push   %r15
+  801bfa:	41 56                	push   %r14
+  801bfc:	41 55                	push   %r13
+  801bfe:	41 54                	push   %r12
+  801c00:	53                   	push   %rbx
+  801c01:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c05:	48 85 d2             	test   %rdx,%rdx
+  801c08:	74 54                	je     801c5e <readn+0x6a>
+  801c0a:	41 89 fd             	mov    %edi,%r13d
+  801c0d:	49 89 f6             	mov    %rsi,%r14
+  801c10:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c13:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c18:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c1d:	49 bf 6b 1a 80 00 00 	movabs $0x801a6b,%r15
+  801c24:	00 00 00 
+  801c27:	4c 89 e2             	mov    %r12,%rdx
+  801c2a:	48 29 f2             	sub    %rsi,%rdx
+  801c2d:	4c 01 f6             	add    %r14,%rsi
+  801c30:	44 89 ef             	mov    %r13d,%edi
+  801c33:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c36:	85 c0                	test   %eax,%eax
+  801c38:	78 20                	js     801c5a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c3a:	01 c3                	add    %eax,%ebx
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	74 08                	je     801c48 <readn+0x54>
+  801c40:	48 63 f3             	movslq %ebx,%rsi
+  801c43:	4c 39 e6             	cmp    %r12,%rsi
+  801c46:	72 df                	jb     801c27 <readn+0x33>
+    }
+    return res;
+  801c48:	48 63 c3             	movslq %ebx,%rax
+}
+  801c4b:	48 83 c4 08          	add    $0x8,%rsp
+  801c4f:	5b                   	pop    %rbx
+  801c50:	41 5c                	pop    %r12
+  801c52:	41 5d                	pop    %r13
+  801c54:	41 5e                	pop    %r14
+  801c56:	41 5f                	pop    %r15
+  801c58:	5d                   	pop    %rbp
+  801c59:	c3                   	ret
+        if (inc < 0) return inc;
+  801c5a:	48 98                	cltq
+  801c5c:	eb ed                	jmp    801c4b <readn+0x57>
+    int inc = 1, res = 0;
+  801c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c63:	eb e3                	jmp    801c48 <readn+0x54>
+
+0000000000801c65 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c65:	55                   	push   %rbp
+  801c66:	48 89 e5             	mov    %rsp,%rbp
+  801c69:	41 56                	push   %r14
+  801c6b:	41 55                	push   %r13
+  801c6d:	41 54                	push   %r12
+  801c6f:	53                   	push   %rbx
+  801c70:	48 83 ec 10          	sub    $0x10,%rsp
+  801c74:	89 fb                	mov    %edi,%ebx
+  801c76:	49 89 f4             	mov    %rsi,%r12
+  801c79:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c80:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 47                	js     801cd7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c90:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c94:	41 8b 3e             	mov    (%r14),%edi
+  801c97:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c9b:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+  801ca7:	85 c0                	test   %eax,%eax
+  801ca9:	78 30                	js     801cdb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cab:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cb0:	74 2d                	je     801cdf <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801cba:	48 85 c0             	test   %rax,%rax
+  801cbd:	74 56                	je     801d15 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cbf:	4c 89 ea             	mov    %r13,%rdx
+  801cc2:	4c 89 e6             	mov    %r12,%rsi
+  801cc5:	4c 89 f7             	mov    %r14,%rdi
+  801cc8:	ff d0                	call   *%rax
+}
+  801cca:	48 83 c4 10          	add    $0x10,%rsp
+  801cce:	5b                   	pop    %rbx
+  801ccf:	41 5c                	pop    %r12
+  801cd1:	41 5d                	pop    %r13
+  801cd3:	41 5e                	pop    %r14
+  801cd5:	5d                   	pop    %rbp
+  801cd6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd7:	48 98                	cltq
+  801cd9:	eb ef                	jmp    801cca <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cdb:	48 98                	cltq
+  801cdd:	eb eb                	jmp    801cca <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cdf:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801ce6:	00 00 00 
+  801ce9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cef:	89 da                	mov    %ebx,%edx
+  801cf1:	48 bf 75 3e 80 00 00 	movabs $0x803e75,%rdi
+  801cf8:	00 00 00 
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d00:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801d07:	00 00 00 
+  801d0a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d0c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d13:	eb b5                	jmp    801cca <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d15:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d1c:	eb ac                	jmp    801cca <write+0x65>
+
+0000000000801d1e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d1e:	55                   	push   %rbp
+  801d1f:	48 89 e5             	mov    %rsp,%rbp
+  801d22:	53                   	push   %rbx
+  801d23:	48 83 ec 18          	sub    $0x18,%rsp
+  801d27:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d29:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d2d:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801d34:	00 00 00 
+  801d37:	ff d0                	call   *%rax
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 0c                	js     801d49 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d41:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+
+0000000000801d4f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d4f:	55                   	push   %rbp
+  801d50:	48 89 e5             	mov    %rsp,%rbp
+  801d53:	41 55                	push   %r13
+  801d55:	41 54                	push   %r12
+  801d57:	53                   	push   %rbx
+  801d58:	48 83 ec 18          	sub    $0x18,%rsp
+  801d5c:	89 fb                	mov    %edi,%ebx
+  801d5e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d61:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d65:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 38                	js     801dad <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d75:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d79:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d7d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d81:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 1c                	js     801dad <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d91:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d96:	74 20                	je     801db8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d98:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801da0:	48 85 c0             	test   %rax,%rax
+  801da3:	74 47                	je     801dec <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801da5:	44 89 e6             	mov    %r12d,%esi
+  801da8:	4c 89 ef             	mov    %r13,%rdi
+  801dab:	ff d0                	call   *%rax
+}
+  801dad:	48 83 c4 18          	add    $0x18,%rsp
+  801db1:	5b                   	pop    %rbx
+  801db2:	41 5c                	pop    %r12
+  801db4:	41 5d                	pop    %r13
+  801db6:	5d                   	pop    %rbp
+  801db7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801db8:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801dbf:	00 00 00 
+  801dc2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dc8:	89 da                	mov    %ebx,%edx
+  801dca:	48 bf 38 3e 80 00 00 	movabs $0x803e38,%rdi
+  801dd1:	00 00 00 
+  801dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd9:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801de0:	00 00 00 
+  801de3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801de5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dea:	eb c1                	jmp    801dad <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801df1:	eb ba                	jmp    801dad <ftruncate+0x5e>
+
+0000000000801df3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801df3:	55                   	push   %rbp
+  801df4:	48 89 e5             	mov    %rsp,%rbp
+  801df7:	41 54                	push   %r12
+  801df9:	53                   	push   %rbx
+  801dfa:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfe:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e01:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e05:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 4e                	js     801e63 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e15:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e19:	41 8b 3c 24          	mov    (%r12),%edi
+  801e1d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e21:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801e28:	00 00 00 
+  801e2b:	ff d0                	call   *%rax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 32                	js     801e63 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e35:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801e3a:	74 30                	je     801e6c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e3c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e3f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e46:	00 00 00 
+    stat->st_isdir = 0;
+  801e49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e50:	00 00 00 
+    stat->st_dev = dev;
+  801e53:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e5a:	48 89 de             	mov    %rbx,%rsi
+  801e5d:	4c 89 e7             	mov    %r12,%rdi
+  801e60:	ff 50 30             	call   *0x30(%rax)
+}
+  801e63:	48 83 c4 10          	add    $0x10,%rsp
+  801e67:	5b                   	pop    %rbx
+  801e68:	41 5c                	pop    %r12
+  801e6a:	5d                   	pop    %rbp
+  801e6b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e6c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e71:	eb f0                	jmp    801e63 <fstat+0x70>
+
+0000000000801e73 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e73:	55                   	push   %rbp
+  801e74:	48 89 e5             	mov    %rsp,%rbp
+  801e77:	41 54                	push   %r12
+  801e79:	53                   	push   %rbx
+  801e7a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e82:	48 b8 ca 2b 80 00 00 	movabs $0x802bca,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 25                	js     801eb9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e94:	4c 89 e6             	mov    %r12,%rsi
+  801e97:	89 c7                	mov    %eax,%edi
+  801e99:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+  801ea5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ea8:	89 df                	mov    %ebx,%edi
+  801eaa:	48 b8 ed 18 80 00 00 	movabs $0x8018ed,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+
+    return res;
+  801eb6:	44 89 e3             	mov    %r12d,%ebx
+}
+  801eb9:	89 d8                	mov    %ebx,%eax
+  801ebb:	5b                   	pop    %rbx
+  801ebc:	41 5c                	pop    %r12
+  801ebe:	5d                   	pop    %rbp
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	41 54                	push   %r12
+  801ec6:	53                   	push   %rbx
+  801ec7:	48 83 ec 10          	sub    $0x10,%rsp
+  801ecb:	48 89 fb             	mov    %rdi,%rbx
+  801ece:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ed1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ed5:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eda:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 1f                	js     801f09 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801eea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eee:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801ef2:	48 85 c0             	test   %rax,%rax
+  801ef5:	74 1b                	je     801f12 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801ef7:	4c 89 e6             	mov    %r12,%rsi
+  801efa:	48 89 df             	mov    %rbx,%rdi
+  801efd:	ff d0                	call   *%rax
+    if (res < 0) {
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f06:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f09:	48 83 c4 10          	add    $0x10,%rsp
+  801f0d:	5b                   	pop    %rbx
+  801f0e:	41 5c                	pop    %r12
+  801f10:	5d                   	pop    %rbp
+  801f11:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f12:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f17:	eb f0                	jmp    801f09 <create_snapshot+0x49>
+
+0000000000801f19 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801f19:	55                   	push   %rbp
+  801f1a:	48 89 e5             	mov    %rsp,%rbp
+  801f1d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f25:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f2a:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	78 1e                	js     801f58 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801f3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f3e:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801f42:	48 85 d2             	test   %rdx,%rdx
+  801f45:	74 13                	je     801f5a <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4c:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f55:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f5a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f5f:	eb f7                	jmp    801f58 <print_snapshot_list+0x3f>
+
+0000000000801f61 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	53                   	push   %rbx
+  801f66:	48 83 ec 18          	sub    $0x18,%rsp
+  801f6a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f71:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f76:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	78 1c                	js     801fa2 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f8a:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801f8e:	48 85 c0             	test   %rax,%rax
+  801f91:	74 15                	je     801fa8 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801f93:	48 89 df             	mov    %rbx,%rdi
+  801f96:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801fa2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fa8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fad:	eb f3                	jmp    801fa2 <accept_snapshot+0x41>
+
+0000000000801faf <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801faf:	55                   	push   %rbp
+  801fb0:	48 89 e5             	mov    %rsp,%rbp
+  801fb3:	53                   	push   %rbx
+  801fb4:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb8:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fbb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fbf:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fc4:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 1c                	js     801ff0 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fd8:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801fdc:	48 85 c0             	test   %rax,%rax
+  801fdf:	74 15                	je     801ff6 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801fe1:	48 89 df             	mov    %rbx,%rdi
+  801fe4:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fed:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ff0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff4:	c9                   	leave
+  801ff5:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ff6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ffb:	eb f3                	jmp    801ff0 <delete_snapshot+0x41>
+
+0000000000801ffd <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801ffd:	55                   	push   %rbp
+  801ffe:	48 89 e5             	mov    %rsp,%rbp
+  802001:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802005:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802009:	bf 66 00 00 00       	mov    $0x66,%edi
+  80200e:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 14                	js     802032 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80201e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802022:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802026:	48 85 d2             	test   %rdx,%rdx
+  802029:	74 09                	je     802034 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+        return -E_NOT_SUPP;
+  802034:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802039:	eb f7                	jmp    802032 <gc_snapshots+0x35>
+
+000000000080203b <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	41 56                	push   %r14
+  802041:	41 55                	push   %r13
+  802043:	41 54                	push   %r12
+  802045:	53                   	push   %rbx
+  802046:	48 83 ec 10          	sub    $0x10,%rsp
+  80204a:	48 89 fb             	mov    %rdi,%rbx
+  80204d:	49 89 f4             	mov    %rsi,%r12
+  802050:	49 89 d5             	mov    %rdx,%r13
+  802053:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802056:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80205a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80205f:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 1b                	js     80208a <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80206f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802073:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802077:	48 85 c0             	test   %rax,%rax
+  80207a:	74 1b                	je     802097 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  80207c:	4c 89 f1             	mov    %r14,%rcx
+  80207f:	4c 89 ea             	mov    %r13,%rdx
+  802082:	4c 89 e6             	mov    %r12,%rsi
+  802085:	48 89 df             	mov    %rbx,%rdi
+  802088:	ff d0                	call   *%rax
+
+    return res;
+}
+  80208a:	48 83 c4 10          	add    $0x10,%rsp
+  80208e:	5b                   	pop    %rbx
+  80208f:	41 5c                	pop    %r12
+  802091:	41 5d                	pop    %r13
+  802093:	41 5e                	pop    %r14
+  802095:	5d                   	pop    %rbp
+  802096:	c3                   	ret
+        return -E_NOT_SUPP;
+  802097:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209c:	eb ec                	jmp    80208a <diff_snapshots+0x4f>
+
+000000000080209e <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  80209e:	55                   	push   %rbp
+  80209f:	48 89 e5             	mov    %rsp,%rbp
+  8020a2:	41 55                	push   %r13
+  8020a4:	41 54                	push   %r12
+  8020a6:	53                   	push   %rbx
+  8020a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8020ab:	48 89 fb             	mov    %rdi,%rbx
+  8020ae:	49 89 f4             	mov    %rsi,%r12
+  8020b1:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020b4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020b8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020bd:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	78 18                	js     8020e5 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8020cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d1:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8020d5:	48 85 c0             	test   %rax,%rax
+  8020d8:	74 16                	je     8020f0 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8020da:	4c 89 ea             	mov    %r13,%rdx
+  8020dd:	4c 89 e6             	mov    %r12,%rsi
+  8020e0:	48 89 df             	mov    %rbx,%rdi
+  8020e3:	ff d0                	call   *%rax
+
+    return res;
+}
+  8020e5:	48 83 c4 18          	add    $0x18,%rsp
+  8020e9:	5b                   	pop    %rbx
+  8020ea:	41 5c                	pop    %r12
+  8020ec:	41 5d                	pop    %r13
+  8020ee:	5d                   	pop    %rbp
+  8020ef:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020f0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f5:	eb ee                	jmp    8020e5 <send_snapshot+0x47>
+
+00000000008020f7 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8020f7:	55                   	push   %rbp
+  8020f8:	48 89 e5             	mov    %rsp,%rbp
+  8020fb:	53                   	push   %rbx
+  8020fc:	48 83 ec 18          	sub    $0x18,%rsp
+  802100:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802103:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802107:	bf 66 00 00 00       	mov    $0x66,%edi
+  80210c:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802113:	00 00 00 
+  802116:	ff d0                	call   *%rax
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 12                	js     80212e <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80211c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802120:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802124:	48 85 c0             	test   %rax,%rax
+  802127:	74 0b                	je     802134 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802129:	48 89 df             	mov    %rbx,%rdi
+  80212c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80212e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+        return -E_NOT_SUPP;
+  802134:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802139:	eb f3                	jmp    80212e <receive_snapshot+0x37>
+
+000000000080213b <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+  80213f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802143:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802147:	bf 66 00 00 00       	mov    $0x66,%edi
+  80214c:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802153:	00 00 00 
+  802156:	ff d0                	call   *%rax
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 17                	js     802173 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80215c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802160:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802167:	48 85 d2             	test   %rdx,%rdx
+  80216a:	74 09                	je     802175 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80216c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802171:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+        return -E_NOT_SUPP;
+  802175:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80217a:	eb f7                	jmp    802173 <free_space_bytes+0x38>
+
+000000000080217c <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80217c:	55                   	push   %rbp
+  80217d:	48 89 e5             	mov    %rsp,%rbp
+  802180:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802184:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802188:	bf 66 00 00 00       	mov    $0x66,%edi
+  80218d:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802194:	00 00 00 
+  802197:	ff d0                	call   *%rax
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 17                	js     8021b4 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80219d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021a1:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8021a8:	48 85 d2             	test   %rdx,%rdx
+  8021ab:	74 09                	je     8021b6 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b2:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021b6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021bb:	eb f7                	jmp    8021b4 <busy_space_bytes+0x38>
+
+00000000008021bd <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	41 54                	push   %r12
+  8021c3:	53                   	push   %rbx
+  8021c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c8:	89 fb                	mov    %edi,%ebx
+  8021ca:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021cd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021d1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021d6:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	78 17                	js     8021fd <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8021e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021ea:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8021f1:	48 85 c0             	test   %rax,%rax
+  8021f4:	74 10                	je     802206 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8021f6:	4c 89 e6             	mov    %r12,%rsi
+  8021f9:	89 df                	mov    %ebx,%edi
+  8021fb:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8021fd:	48 83 c4 10          	add    $0x10,%rsp
+  802201:	5b                   	pop    %rbx
+  802202:	41 5c                	pop    %r12
+  802204:	5d                   	pop    %rbp
+  802205:	c3                   	ret
+        return -E_NOT_SUPP;
+  802206:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80220b:	eb f0                	jmp    8021fd <snapshots_space+0x40>
+
+000000000080220d <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80220d:	55                   	push   %rbp
+  80220e:	48 89 e5             	mov    %rsp,%rbp
+  802211:	41 55                	push   %r13
+  802213:	41 54                	push   %r12
+  802215:	53                   	push   %rbx
+  802216:	48 83 ec 08          	sub    $0x8,%rsp
+  80221a:	41 89 fd             	mov    %edi,%r13d
+  80221d:	48 89 f3             	mov    %rsi,%rbx
+  802220:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802223:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  80222a:	00 00 00 
+  80222d:	83 38 00             	cmpl   $0x0,(%rax)
+  802230:	74 57                	je     802289 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802232:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802238:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80223d:	48 ba 00 60 c0 00 00 	movabs $0xc06000,%rdx
+  802244:	00 00 00 
+  802247:	44 89 ee             	mov    %r13d,%esi
+  80224a:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  802251:	00 00 00 
+  802254:	8b 38                	mov    (%rax),%edi
+  802256:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802262:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802267:	4c 89 e2             	mov    %r12,%rdx
+  80226a:	48 89 de             	mov    %rbx,%rsi
+  80226d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802272:	48 b8 72 36 80 00 00 	movabs $0x803672,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+}
+  80227e:	48 83 c4 08          	add    $0x8,%rsp
+  802282:	5b                   	pop    %rbx
+  802283:	41 5c                	pop    %r12
+  802285:	41 5d                	pop    %r13
+  802287:	5d                   	pop    %rbp
+  802288:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802289:	bf 03 00 00 00       	mov    $0x3,%edi
+  80228e:	48 b8 48 37 80 00 00 	movabs $0x803748,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	a3 00 70 c0 00 00 00 	movabs %eax,0xc07000
+  8022a1:	00 00 
+  8022a3:	eb 8d                	jmp    802232 <fsipc_region+0x25>
+
+00000000008022a5 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8022a5:	55                   	push   %rbp
+  8022a6:	48 89 e5             	mov    %rsp,%rbp
+  8022a9:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8022ad:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8022b4:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8022b5:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8022b9:	48 b8 0d 22 80 00 00 	movabs $0x80220d,%rax
+  8022c0:	00 00 00 
+  8022c3:	ff d0                	call   *%rax
+}
+  8022c5:	c9                   	leave
+  8022c6:	c3                   	ret
+
+00000000008022c7 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8022c7:	85 ff                	test   %edi,%edi
+  8022c9:	78 6d                	js     802338 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8022cb:	55                   	push   %rbp
+  8022cc:	48 89 e5             	mov    %rsp,%rbp
+  8022cf:	41 54                	push   %r12
+  8022d1:	53                   	push   %rbx
+  8022d2:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8022d5:	48 85 f6             	test   %rsi,%rsi
+  8022d8:	74 57                	je     802331 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8022da:	89 f8                	mov    %edi,%eax
+  8022dc:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  8022e3:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8022e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ea:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022ef:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8022f6:	00 00 00 
+  8022f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 2d                	js     80232c <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8022ff:	49 bc 00 60 c0 00 00 	movabs $0xc06000,%r12
+  802306:	00 00 00 
+  802309:	49 63 14 24          	movslq (%r12),%rdx
+  80230d:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802314:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802319:	48 89 df             	mov    %rbx,%rdi
+  80231c:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802328:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80232c:	5b                   	pop    %rbx
+  80232d:	41 5c                	pop    %r12
+  80232f:	5d                   	pop    %rbp
+  802330:	c3                   	ret
+        return -E_INVAL;
+  802331:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802336:	eb f4                	jmp    80232c <devfile_df_snapshots+0x65>
+  802338:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80233d:	c3                   	ret
+
+000000000080233e <devfile_df_busy>:
+devfile_df_busy() {
+  80233e:	55                   	push   %rbp
+  80233f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802342:	be 00 00 00 00       	mov    $0x0,%esi
+  802347:	bf 11 00 00 00       	mov    $0x11,%edi
+  80234c:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802353:	00 00 00 
+  802356:	ff d0                	call   *%rax
+}
+  802358:	5d                   	pop    %rbp
+  802359:	c3                   	ret
+
+000000000080235a <devfile_df_free>:
+devfile_df_free() {
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80235e:	be 00 00 00 00       	mov    $0x0,%esi
+  802363:	bf 10 00 00 00       	mov    $0x10,%edi
+  802368:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  80236f:	00 00 00 
+  802372:	ff d0                	call   *%rax
+}
+  802374:	5d                   	pop    %rbp
+  802375:	c3                   	ret
+
+0000000000802376 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802376:	55                   	push   %rbp
+  802377:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80237a:	be 00 00 00 00       	mov    $0x0,%esi
+  80237f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802384:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+}
+  802390:	5d                   	pop    %rbp
+  802391:	c3                   	ret
+
+0000000000802392 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802396:	be 00 00 00 00       	mov    $0x0,%esi
+  80239b:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023a0:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8023b6:	5d                   	pop    %rbp
+  8023b7:	c3                   	ret
+
+00000000008023b8 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023bc:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  8023c3:	00 00 00 
+  8023c6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023c9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8023cb:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023d8:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+}
+  8023e4:	5d                   	pop    %rbp
+  8023e5:	c3                   	ret
+
+00000000008023e6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023ea:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023ed:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  8023f4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fb:	bf 06 00 00 00       	mov    $0x6,%edi
+  802400:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+}
+  80240c:	5d                   	pop    %rbp
+  80240d:	c3                   	ret
+
+000000000080240e <devfile_write>:
+    if (!fd || !buf) {
+  80240e:	48 85 ff             	test   %rdi,%rdi
+  802411:	0f 84 c1 00 00 00    	je     8024d8 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802417:	55                   	push   %rbp
+  802418:	48 89 e5             	mov    %rsp,%rbp
+  80241b:	41 57                	push   %r15
+  80241d:	41 56                	push   %r14
+  80241f:	41 55                	push   %r13
+  802421:	41 54                	push   %r12
+  802423:	53                   	push   %rbx
+  802424:	48 83 ec 18          	sub    $0x18,%rsp
+  802428:	49 89 ff             	mov    %rdi,%r15
+  80242b:	49 89 f5             	mov    %rsi,%r13
+  80242e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802431:	48 85 f6             	test   %rsi,%rsi
+  802434:	0f 84 95 00 00 00    	je     8024cf <devfile_write+0xc1>
+    while (n) {
+  80243a:	48 85 d2             	test   %rdx,%rdx
+  80243d:	0f 84 83 00 00 00    	je     8024c6 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802443:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80244a:	49 be 00 60 c0 00 00 	movabs $0xc06000,%r14
+  802451:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802454:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802459:	49 39 dc             	cmp    %rbx,%r12
+  80245c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802460:	48 89 da             	mov    %rbx,%rdx
+  802463:	4c 89 ee             	mov    %r13,%rsi
+  802466:	48 bf 10 60 c0 00 00 	movabs $0xc06010,%rdi
+  80246d:	00 00 00 
+  802470:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80247c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802480:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802483:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802491:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+        if (write < 0) {
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 21                	js     8024c2 <devfile_write+0xb4>
+        buf += write;
+  8024a1:	48 63 d0             	movslq %eax,%rdx
+  8024a4:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8024a7:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8024aa:	49 29 d4             	sub    %rdx,%r12
+  8024ad:	75 a5                	jne    802454 <devfile_write+0x46>
+    return totalWrite;
+  8024af:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8024b3:	48 83 c4 18          	add    $0x18,%rsp
+  8024b7:	5b                   	pop    %rbx
+  8024b8:	41 5c                	pop    %r12
+  8024ba:	41 5d                	pop    %r13
+  8024bc:	41 5e                	pop    %r14
+  8024be:	41 5f                	pop    %r15
+  8024c0:	5d                   	pop    %rbp
+  8024c1:	c3                   	ret
+            return write;
+  8024c2:	48 98                	cltq
+  8024c4:	eb ed                	jmp    8024b3 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8024c6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8024cd:	eb e0                	jmp    8024af <devfile_write+0xa1>
+        return -E_INVAL;
+  8024cf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024d6:	eb db                	jmp    8024b3 <devfile_write+0xa5>
+  8024d8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8024df:	c3                   	ret
+
+00000000008024e0 <devfile_read>:
+    if (!fd || !buf) {
+  8024e0:	48 85 ff             	test   %rdi,%rdi
+  8024e3:	0f 84 c0 00 00 00    	je     8025a9 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024e9:	55                   	push   %rbp
+  8024ea:	48 89 e5             	mov    %rsp,%rbp
+  8024ed:	41 57                	push   %r15
+  8024ef:	41 56                	push   %r14
+  8024f1:	41 55                	push   %r13
+  8024f3:	41 54                	push   %r12
+  8024f5:	53                   	push   %rbx
+  8024f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8024fa:	49 89 ff             	mov    %rdi,%r15
+  8024fd:	49 89 f5             	mov    %rsi,%r13
+  802500:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802503:	48 85 f6             	test   %rsi,%rsi
+  802506:	0f 84 96 00 00 00    	je     8025a2 <devfile_read+0xc2>
+    while (n) {
+  80250c:	48 85 d2             	test   %rdx,%rdx
+  80250f:	0f 84 87 00 00 00    	je     80259c <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802515:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80251c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80251d:	49 be 00 60 c0 00 00 	movabs $0xc06000,%r14
+  802524:	00 00 00 
+  802527:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80252b:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80252e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802533:	49 39 c4             	cmp    %rax,%r12
+  802536:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80253a:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80253e:	be 00 00 00 00       	mov    $0x0,%esi
+  802543:	bf 03 00 00 00       	mov    $0x3,%edi
+  802548:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802554:	85 c0                	test   %eax,%eax
+  802556:	7e 37                	jle    80258f <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802558:	48 63 d8             	movslq %eax,%rbx
+  80255b:	48 89 da             	mov    %rbx,%rdx
+  80255e:	4c 89 f6             	mov    %r14,%rsi
+  802561:	4c 89 ef             	mov    %r13,%rdi
+  802564:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  80256b:	00 00 00 
+  80256e:	ff d0                	call   *%rax
+        buf += read;
+  802570:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802573:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802577:	49 29 dc             	sub    %rbx,%r12
+  80257a:	75 ab                	jne    802527 <devfile_read+0x47>
+  return totalRead;
+  80257c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802580:	48 83 c4 18          	add    $0x18,%rsp
+  802584:	5b                   	pop    %rbx
+  802585:	41 5c                	pop    %r12
+  802587:	41 5d                	pop    %r13
+  802589:	41 5e                	pop    %r14
+  80258b:	41 5f                	pop    %r15
+  80258d:	5d                   	pop    %rbp
+  80258e:	c3                   	ret
+            return read ? read : totalRead;
+  80258f:	48 63 d0             	movslq %eax,%rdx
+  802592:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802596:	48 0f 45 c2          	cmovne %rdx,%rax
+  80259a:	eb e4                	jmp    802580 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80259c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8025a0:	eb da                	jmp    80257c <devfile_read+0x9c>
+        return E_INVAL;
+  8025a2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025a7:	eb d7                	jmp    802580 <devfile_read+0xa0>
+  8025a9:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8025ae:	c3                   	ret
+
+00000000008025af <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025af:	48 85 ff             	test   %rdi,%rdi
+  8025b2:	74 5f                	je     802613 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	53                   	push   %rbx
+  8025b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bd:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8025c0:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+  8025cc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025d2:	77 45                	ja     802619 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8025d4:	48 89 de             	mov    %rbx,%rsi
+  8025d7:	48 bf 00 60 c0 00 00 	movabs $0xc06000,%rdi
+  8025de:	00 00 00 
+  8025e1:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8025ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f2:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025f7:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802603:	85 c0                	test   %eax,%eax
+  802605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80260d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802611:	c9                   	leave
+  802612:	c3                   	ret
+        return -E_INVAL;
+  802613:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802618:	c3                   	ret
+        return -E_INVAL;
+  802619:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80261e:	eb ed                	jmp    80260d <devfile_receive_snapshot+0x5e>
+
+0000000000802620 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+  802624:	41 55                	push   %r13
+  802626:	41 54                	push   %r12
+  802628:	53                   	push   %rbx
+  802629:	48 83 ec 08          	sub    $0x8,%rsp
+  80262d:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802630:	48 85 f6             	test   %rsi,%rsi
+  802633:	0f 94 c0             	sete   %al
+  802636:	48 85 d2             	test   %rdx,%rdx
+  802639:	0f 94 c2             	sete   %dl
+  80263c:	08 d0                	or     %dl,%al
+  80263e:	0f 85 ad 00 00 00    	jne    8026f1 <devfile_send_snapshot+0xd1>
+  802644:	48 89 fb             	mov    %rdi,%rbx
+  802647:	49 89 f4             	mov    %rsi,%r12
+  80264a:	48 85 ff             	test   %rdi,%rdi
+  80264d:	0f 84 9e 00 00 00    	je     8026f1 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802653:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+  80265f:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802665:	0f 87 8d 00 00 00    	ja     8026f8 <devfile_send_snapshot+0xd8>
+  80266b:	4c 89 e7             	mov    %r12,%rdi
+  80266e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802680:	77 7d                	ja     8026ff <devfile_send_snapshot+0xdf>
+  802682:	4c 89 ef             	mov    %r13,%rdi
+  802685:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  80268c:	00 00 00 
+  80268f:	ff d0                	call   *%rax
+  802691:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802697:	77 6d                	ja     802706 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802699:	48 89 de             	mov    %rbx,%rsi
+  80269c:	48 bf 00 60 c0 00 00 	movabs $0xc06000,%rdi
+  8026a3:	00 00 00 
+  8026a6:	48 bb 9e 0c 80 00 00 	movabs $0x800c9e,%rbx
+  8026ad:	00 00 00 
+  8026b0:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8026b2:	4c 89 e6             	mov    %r12,%rsi
+  8026b5:	48 bf 00 61 c0 00 00 	movabs $0xc06100,%rdi
+  8026bc:	00 00 00 
+  8026bf:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8026c1:	4c 89 ee             	mov    %r13,%rsi
+  8026c4:	48 bf 00 62 c0 00 00 	movabs $0xc06200,%rdi
+  8026cb:	00 00 00 
+  8026ce:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8026d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026da:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+}
+  8026e6:	48 83 c4 08          	add    $0x8,%rsp
+  8026ea:	5b                   	pop    %rbx
+  8026eb:	41 5c                	pop    %r12
+  8026ed:	41 5d                	pop    %r13
+  8026ef:	5d                   	pop    %rbp
+  8026f0:	c3                   	ret
+        return -E_INVAL;
+  8026f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026f6:	eb ee                	jmp    8026e6 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8026f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026fd:	eb e7                	jmp    8026e6 <devfile_send_snapshot+0xc6>
+  8026ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802704:	eb e0                	jmp    8026e6 <devfile_send_snapshot+0xc6>
+  802706:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80270b:	eb d9                	jmp    8026e6 <devfile_send_snapshot+0xc6>
+
+000000000080270d <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80270d:	48 85 ff             	test   %rdi,%rdi
+  802710:	0f 84 41 01 00 00    	je     802857 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802716:	55                   	push   %rbp
+  802717:	48 89 e5             	mov    %rsp,%rbp
+  80271a:	41 57                	push   %r15
+  80271c:	41 56                	push   %r14
+  80271e:	41 55                	push   %r13
+  802720:	41 54                	push   %r12
+  802722:	53                   	push   %rbx
+  802723:	48 83 ec 08          	sub    $0x8,%rsp
+  802727:	49 89 fc             	mov    %rdi,%r12
+  80272a:	49 89 f5             	mov    %rsi,%r13
+  80272d:	48 89 d3             	mov    %rdx,%rbx
+  802730:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802733:	48 85 f6             	test   %rsi,%rsi
+  802736:	0f 84 ff 00 00 00    	je     80283b <devfile_diff_snapshots+0x12e>
+  80273c:	48 85 d2             	test   %rdx,%rdx
+  80273f:	0f 84 fd 00 00 00    	je     802842 <devfile_diff_snapshots+0x135>
+  802745:	48 85 c9             	test   %rcx,%rcx
+  802748:	0f 84 f4 00 00 00    	je     802842 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80274e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802755:	00 00 00 
+  802758:	ff d0                	call   *%rax
+  80275a:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802760:	0f 87 e3 00 00 00    	ja     802849 <devfile_diff_snapshots+0x13c>
+  802766:	4c 89 ef             	mov    %r13,%rdi
+  802769:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+  802775:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80277b:	0f 87 cf 00 00 00    	ja     802850 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802781:	4c 89 e6             	mov    %r12,%rsi
+  802784:	49 bc 00 60 c0 00 00 	movabs $0xc06000,%r12
+  80278b:	00 00 00 
+  80278e:	4c 89 e7             	mov    %r12,%rdi
+  802791:	49 bf 9e 0c 80 00 00 	movabs $0x800c9e,%r15
+  802798:	00 00 00 
+  80279b:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80279e:	4c 89 ee             	mov    %r13,%rsi
+  8027a1:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8027a8:	00 
+  8027a9:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8027ac:	48 8b 03             	mov    (%rbx),%rax
+  8027af:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8027b6:	00 
+  8027b7:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8027bb:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8027c2:	00 
+  8027c3:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8027c7:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8027ce:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8027cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8027d9:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8027e0:	00 00 00 
+  8027e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027e5:	85 c0                	test   %eax,%eax
+  8027e7:	78 43                	js     80282c <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8027e9:	49 8b 04 24          	mov    (%r12),%rax
+  8027ed:	48 89 03             	mov    %rax,(%rbx)
+  8027f0:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8027f5:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8027f9:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8027fe:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802802:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802807:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80280b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80280f:	48 c1 e2 03          	shl    $0x3,%rdx
+  802813:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802818:	4c 89 f7             	mov    %r14,%rdi
+  80281b:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  802822:	00 00 00 
+  802825:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802827:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80282c:	48 83 c4 08          	add    $0x8,%rsp
+  802830:	5b                   	pop    %rbx
+  802831:	41 5c                	pop    %r12
+  802833:	41 5d                	pop    %r13
+  802835:	41 5e                	pop    %r14
+  802837:	41 5f                	pop    %r15
+  802839:	5d                   	pop    %rbp
+  80283a:	c3                   	ret
+        return -E_INVAL;
+  80283b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802840:	eb ea                	jmp    80282c <devfile_diff_snapshots+0x11f>
+  802842:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802847:	eb e3                	jmp    80282c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284e:	eb dc                	jmp    80282c <devfile_diff_snapshots+0x11f>
+  802850:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802855:	eb d5                	jmp    80282c <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802857:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80285c:	c3                   	ret
+
+000000000080285d <devfile_delete_snapshot>:
+    if (!name) {
+  80285d:	48 85 ff             	test   %rdi,%rdi
+  802860:	74 5f                	je     8028c1 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802862:	55                   	push   %rbp
+  802863:	48 89 e5             	mov    %rsp,%rbp
+  802866:	53                   	push   %rbx
+  802867:	48 83 ec 08          	sub    $0x8,%rsp
+  80286b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80286e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802875:	00 00 00 
+  802878:	ff d0                	call   *%rax
+  80287a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802880:	77 45                	ja     8028c7 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802882:	48 89 de             	mov    %rbx,%rsi
+  802885:	48 bf 00 60 c0 00 00 	movabs $0xc06000,%rdi
+  80288c:	00 00 00 
+  80288f:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  80289b:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8028a5:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8028ac:	00 00 00 
+  8028af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028bf:	c9                   	leave
+  8028c0:	c3                   	ret
+        return -E_INVAL;
+  8028c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028c6:	c3                   	ret
+        return -E_INVAL;
+  8028c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028cc:	eb ed                	jmp    8028bb <devfile_delete_snapshot+0x5e>
+
+00000000008028ce <devfile_accept_snapshot>:
+    if (!name) {
+  8028ce:	48 85 ff             	test   %rdi,%rdi
+  8028d1:	74 5f                	je     802932 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8028d3:	55                   	push   %rbp
+  8028d4:	48 89 e5             	mov    %rsp,%rbp
+  8028d7:	53                   	push   %rbx
+  8028d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028dc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8028df:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+  8028eb:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8028f1:	77 45                	ja     802938 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8028f3:	48 89 de             	mov    %rbx,%rsi
+  8028f6:	48 bf 00 60 c0 00 00 	movabs $0xc06000,%rdi
+  8028fd:	00 00 00 
+  802900:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  80290c:	be 00 00 00 00       	mov    $0x0,%esi
+  802911:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802916:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  80291d:	00 00 00 
+  802920:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802922:	85 c0                	test   %eax,%eax
+  802924:	ba 00 00 00 00       	mov    $0x0,%edx
+  802929:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80292c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802930:	c9                   	leave
+  802931:	c3                   	ret
+        return -E_INVAL;
+  802932:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802937:	c3                   	ret
+        return -E_INVAL;
+  802938:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80293d:	eb ed                	jmp    80292c <devfile_accept_snapshot+0x5e>
+
+000000000080293f <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80293f:	48 85 ff             	test   %rdi,%rdi
+  802942:	0f 84 9f 00 00 00    	je     8029e7 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802948:	55                   	push   %rbp
+  802949:	48 89 e5             	mov    %rsp,%rbp
+  80294c:	41 54                	push   %r12
+  80294e:	53                   	push   %rbx
+  80294f:	48 89 fb             	mov    %rdi,%rbx
+  802952:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802955:	48 85 f6             	test   %rsi,%rsi
+  802958:	74 78                	je     8029d2 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  80295a:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802961:	00 00 00 
+  802964:	ff d0                	call   *%rax
+  802966:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80296c:	77 6b                	ja     8029d9 <devfile_create_snapshot+0x9a>
+  80296e:	4c 89 e7             	mov    %r12,%rdi
+  802971:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+  80297d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802983:	77 5b                	ja     8029e0 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802985:	48 89 de             	mov    %rbx,%rsi
+  802988:	48 bf 00 60 c0 00 00 	movabs $0xc06000,%rdi
+  80298f:	00 00 00 
+  802992:	48 bb 9e 0c 80 00 00 	movabs $0x800c9e,%rbx
+  802999:	00 00 00 
+  80299c:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80299e:	4c 89 e6             	mov    %r12,%rsi
+  8029a1:	48 bf 00 61 c0 00 00 	movabs $0xc06100,%rdi
+  8029a8:	00 00 00 
+  8029ab:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8029ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8029b7:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8029be:	00 00 00 
+  8029c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ca:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8029cd:	5b                   	pop    %rbx
+  8029ce:	41 5c                	pop    %r12
+  8029d0:	5d                   	pop    %rbp
+  8029d1:	c3                   	ret
+        return -E_INVAL;
+  8029d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d7:	eb f4                	jmp    8029cd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8029d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029de:	eb ed                	jmp    8029cd <devfile_create_snapshot+0x8e>
+  8029e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029e5:	eb e6                	jmp    8029cd <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8029e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029ec:	c3                   	ret
+
+00000000008029ed <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	41 54                	push   %r12
+  8029f3:	53                   	push   %rbx
+  8029f4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029f7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8029fa:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  802a01:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802a03:	be 00 00 00 00       	mov    $0x0,%esi
+  802a08:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a0d:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a19:	85 c0                	test   %eax,%eax
+  802a1b:	78 3d                	js     802a5a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a1d:	49 bc 00 60 c0 00 00 	movabs $0xc06000,%r12
+  802a24:	00 00 00 
+  802a27:	4c 89 e6             	mov    %r12,%rsi
+  802a2a:	48 89 df             	mov    %rbx,%rdi
+  802a2d:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a39:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a40:	00 
+  802a41:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a47:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a4e:	00 
+  802a4f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a5a:	5b                   	pop    %rbx
+  802a5b:	41 5c                	pop    %r12
+  802a5d:	5d                   	pop    %rbp
+  802a5e:	c3                   	ret
+
+0000000000802a5f <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802a5f:	55                   	push   %rbp
+  802a60:	48 89 e5             	mov    %rsp,%rbp
+  802a63:	41 57                	push   %r15
+  802a65:	41 56                	push   %r14
+  802a67:	41 55                	push   %r13
+  802a69:	41 54                	push   %r12
+  802a6b:	53                   	push   %rbx
+  802a6c:	48 83 ec 38          	sub    $0x38,%rsp
+  802a70:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802a74:	49 89 f5             	mov    %rsi,%r13
+  802a77:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a7a:	48 89 f0             	mov    %rsi,%rax
+  802a7d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a82:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a86:	75 4f                	jne    802ad7 <devfile_readmap+0x78>
+  802a88:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a8c:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a92:	75 1f                	jne    802ab3 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802a94:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a98:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a9c:	49 be 47 32 80 00 00 	movabs $0x803247,%r14
+  802aa3:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802aa6:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802aad:	0f 87 9d 00 00 00    	ja     802b50 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ab3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ab7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802abb:	4d 85 ff             	test   %r15,%r15
+  802abe:	0f 85 cf 00 00 00    	jne    802b93 <devfile_readmap+0x134>
+  802ac4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802ac8:	48 83 c4 38          	add    $0x38,%rsp
+  802acc:	5b                   	pop    %rbx
+  802acd:	41 5c                	pop    %r12
+  802acf:	41 5d                	pop    %r13
+  802ad1:	41 5e                	pop    %r14
+  802ad3:	41 5f                	pop    %r15
+  802ad5:	5d                   	pop    %rbp
+  802ad6:	c3                   	ret
+    size_t totalRead = 0;
+  802ad7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802ade:	00 
+  802adf:	eb da                	jmp    802abb <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ae1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ae5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ae8:	48 b9 00 60 c0 00 00 	movabs $0xc06000,%rcx
+  802aef:	00 00 00 
+  802af2:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802af4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802af8:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802afc:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b00:	4c 89 ee             	mov    %r13,%rsi
+  802b03:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b08:	48 b8 0d 22 80 00 00 	movabs $0x80220d,%rax
+  802b0f:	00 00 00 
+  802b12:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	7e a3                	jle    802abb <devfile_readmap+0x5c>
+  802b18:	48 98                	cltq
+  802b1a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b1e:	72 9b                	jb     802abb <devfile_readmap+0x5c>
+        buf += read;
+  802b20:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802b23:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802b26:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802b2a:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802b31:	75 88                	jne    802abb <devfile_readmap+0x5c>
+  802b33:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b37:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b3d:	0f 85 78 ff ff ff    	jne    802abb <devfile_readmap+0x5c>
+  802b43:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802b4a:	0f 86 6b ff ff ff    	jbe    802abb <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802b50:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802b56:	4d 39 e7             	cmp    %r12,%r15
+  802b59:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802b5d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802b64:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b68:	0f 84 73 ff ff ff    	je     802ae1 <devfile_readmap+0x82>
+  802b6e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802b72:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802b77:	41 ff d6             	call   *%r14
+  802b7a:	a8 40                	test   $0x40,%al
+  802b7c:	0f 85 39 ff ff ff    	jne    802abb <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802b82:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b89:	4c 39 e3             	cmp    %r12,%rbx
+  802b8c:	72 e4                	jb     802b72 <devfile_readmap+0x113>
+  802b8e:	e9 4e ff ff ff       	jmp    802ae1 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802b93:	4c 89 fa             	mov    %r15,%rdx
+  802b96:	4c 89 ee             	mov    %r13,%rsi
+  802b99:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b9d:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802ba9:	48 85 c0             	test   %rax,%rax
+  802bac:	78 0c                	js     802bba <devfile_readmap+0x15b>
+    return totalRead + read;
+  802bae:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bb2:	48 01 f0             	add    %rsi,%rax
+  802bb5:	e9 0e ff ff ff       	jmp    802ac8 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802bba:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bbe:	48 85 f6             	test   %rsi,%rsi
+  802bc1:	48 0f 45 c6          	cmovne %rsi,%rax
+  802bc5:	e9 fe fe ff ff       	jmp    802ac8 <devfile_readmap+0x69>
+
+0000000000802bca <open>:
+open(const char *path, int mode) {
+  802bca:	55                   	push   %rbp
+  802bcb:	48 89 e5             	mov    %rsp,%rbp
+  802bce:	41 55                	push   %r13
+  802bd0:	41 54                	push   %r12
+  802bd2:	53                   	push   %rbx
+  802bd3:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd7:	49 89 fc             	mov    %rdi,%r12
+  802bda:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802bdd:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+  802be9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802bef:	0f 87 8a 00 00 00    	ja     802c7f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bf5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bf9:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+  802c05:	89 c3                	mov    %eax,%ebx
+  802c07:	85 c0                	test   %eax,%eax
+  802c09:	78 50                	js     802c5b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c0b:	4c 89 e6             	mov    %r12,%rsi
+  802c0e:	48 bb 00 60 c0 00 00 	movabs $0xc06000,%rbx
+  802c15:	00 00 00 
+  802c18:	48 89 df             	mov    %rbx,%rdi
+  802c1b:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c27:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c2e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c32:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c37:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+  802c43:	89 c3                	mov    %eax,%ebx
+  802c45:	85 c0                	test   %eax,%eax
+  802c47:	78 1f                	js     802c68 <open+0x9e>
+    return fd2num(fd);
+  802c49:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c4d:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+  802c59:	89 c3                	mov    %eax,%ebx
+}
+  802c5b:	89 d8                	mov    %ebx,%eax
+  802c5d:	48 83 c4 18          	add    $0x18,%rsp
+  802c61:	5b                   	pop    %rbx
+  802c62:	41 5c                	pop    %r12
+  802c64:	41 5d                	pop    %r13
+  802c66:	5d                   	pop    %rbp
+  802c67:	c3                   	ret
+        fd_close(fd, 0);
+  802c68:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c71:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  802c78:	00 00 00 
+  802c7b:	ff d0                	call   *%rax
+        return res;
+  802c7d:	eb dc                	jmp    802c5b <open+0x91>
+        return -E_BAD_PATH;
+  802c7f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802c84:	eb d5                	jmp    802c5b <open+0x91>
+
+0000000000802c86 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802c86:	55                   	push   %rbp
+  802c87:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802c94:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+}
+  802ca0:	5d                   	pop    %rbp
+  802ca1:	c3                   	ret
+
+0000000000802ca2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ca2:	55                   	push   %rbp
+  802ca3:	48 89 e5             	mov    %rsp,%rbp
+  802ca6:	41 54                	push   %r12
+  802ca8:	53                   	push   %rbx
+  802ca9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cac:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802cb3:	00 00 00 
+  802cb6:	ff d0                	call   *%rax
+  802cb8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cbb:	48 be c0 3e 80 00 00 	movabs $0x803ec0,%rsi
+  802cc2:	00 00 00 
+  802cc5:	48 89 df             	mov    %rbx,%rdi
+  802cc8:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cd4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cd9:	41 2b 04 24          	sub    (%r12),%eax
+  802cdd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ce3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802cea:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ced:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802cf4:	00 00 00 
+  802cf7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d03:	5b                   	pop    %rbx
+  802d04:	41 5c                	pop    %r12
+  802d06:	5d                   	pop    %rbp
+  802d07:	c3                   	ret
+
+0000000000802d08 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d08:	55                   	push   %rbp
+  802d09:	48 89 e5             	mov    %rsp,%rbp
+  802d0c:	41 54                	push   %r12
+  802d0e:	53                   	push   %rbx
+  802d0f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d17:	48 89 fe             	mov    %rdi,%rsi
+  802d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1f:	49 bc f6 13 80 00 00 	movabs $0x8013f6,%r12
+  802d26:	00 00 00 
+  802d29:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d2c:	48 89 df             	mov    %rbx,%rdi
+  802d2f:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802d36:	00 00 00 
+  802d39:	ff d0                	call   *%rax
+  802d3b:	48 89 c6             	mov    %rax,%rsi
+  802d3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d43:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d48:	41 ff d4             	call   *%r12
+}
+  802d4b:	5b                   	pop    %rbx
+  802d4c:	41 5c                	pop    %r12
+  802d4e:	5d                   	pop    %rbp
+  802d4f:	c3                   	ret
+
+0000000000802d50 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	41 57                	push   %r15
+  802d56:	41 56                	push   %r14
+  802d58:	41 55                	push   %r13
+  802d5a:	41 54                	push   %r12
+  802d5c:	53                   	push   %rbx
+  802d5d:	48 83 ec 18          	sub    $0x18,%rsp
+  802d61:	49 89 fc             	mov    %rdi,%r12
+  802d64:	49 89 f5             	mov    %rsi,%r13
+  802d67:	49 89 d7             	mov    %rdx,%r15
+  802d6a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d6e:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802d7a:	4d 85 ff             	test   %r15,%r15
+  802d7d:	0f 84 af 00 00 00    	je     802e32 <devpipe_write+0xe2>
+  802d83:	48 89 c3             	mov    %rax,%rbx
+  802d86:	4c 89 f8             	mov    %r15,%rax
+  802d89:	4d 89 ef             	mov    %r13,%r15
+  802d8c:	4c 01 e8             	add    %r13,%rax
+  802d8f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d93:	49 bd fe 12 80 00 00 	movabs $0x8012fe,%r13
+  802d9a:	00 00 00 
+            sys_yield();
+  802d9d:	49 be 9b 12 80 00 00 	movabs $0x80129b,%r14
+  802da4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802da7:	8b 73 04             	mov    0x4(%rbx),%esi
+  802daa:	48 63 ce             	movslq %esi,%rcx
+  802dad:	48 63 03             	movslq (%rbx),%rax
+  802db0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802db6:	48 39 c1             	cmp    %rax,%rcx
+  802db9:	72 2e                	jb     802de9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dbb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802dc0:	48 89 da             	mov    %rbx,%rdx
+  802dc3:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dc8:	4c 89 e7             	mov    %r12,%rdi
+  802dcb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802dce:	85 c0                	test   %eax,%eax
+  802dd0:	74 66                	je     802e38 <devpipe_write+0xe8>
+            sys_yield();
+  802dd2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802dd5:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dd8:	48 63 ce             	movslq %esi,%rcx
+  802ddb:	48 63 03             	movslq (%rbx),%rax
+  802dde:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802de4:	48 39 c1             	cmp    %rax,%rcx
+  802de7:	73 d2                	jae    802dbb <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802de9:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ded:	48 89 ca             	mov    %rcx,%rdx
+  802df0:	48 c1 ea 03          	shr    $0x3,%rdx
+  802df4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802dfb:	08 10 20 
+  802dfe:	48 f7 e2             	mul    %rdx
+  802e01:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e05:	48 89 d0             	mov    %rdx,%rax
+  802e08:	48 c1 e0 09          	shl    $0x9,%rax
+  802e0c:	48 29 d0             	sub    %rdx,%rax
+  802e0f:	48 c1 e0 03          	shl    $0x3,%rax
+  802e13:	48 29 c1             	sub    %rax,%rcx
+  802e16:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e1b:	83 c6 01             	add    $0x1,%esi
+  802e1e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e21:	49 83 c7 01          	add    $0x1,%r15
+  802e25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e29:	49 39 c7             	cmp    %rax,%r15
+  802e2c:	0f 85 75 ff ff ff    	jne    802da7 <devpipe_write+0x57>
+    return n;
+  802e32:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e36:	eb 05                	jmp    802e3d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3d:	48 83 c4 18          	add    $0x18,%rsp
+  802e41:	5b                   	pop    %rbx
+  802e42:	41 5c                	pop    %r12
+  802e44:	41 5d                	pop    %r13
+  802e46:	41 5e                	pop    %r14
+  802e48:	41 5f                	pop    %r15
+  802e4a:	5d                   	pop    %rbp
+  802e4b:	c3                   	ret
+
+0000000000802e4c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e4c:	55                   	push   %rbp
+  802e4d:	48 89 e5             	mov    %rsp,%rbp
+  802e50:	41 57                	push   %r15
+  802e52:	41 56                	push   %r14
+  802e54:	41 55                	push   %r13
+  802e56:	41 54                	push   %r12
+  802e58:	53                   	push   %rbx
+  802e59:	48 83 ec 18          	sub    $0x18,%rsp
+  802e5d:	49 89 fc             	mov    %rdi,%r12
+  802e60:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e64:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e68:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802e6f:	00 00 00 
+  802e72:	ff d0                	call   *%rax
+  802e74:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e77:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e7d:	49 bd fe 12 80 00 00 	movabs $0x8012fe,%r13
+  802e84:	00 00 00 
+            sys_yield();
+  802e87:	49 be 9b 12 80 00 00 	movabs $0x80129b,%r14
+  802e8e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802e91:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802e96:	74 7d                	je     802f15 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e98:	8b 03                	mov    (%rbx),%eax
+  802e9a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e9d:	75 26                	jne    802ec5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802e9f:	4d 85 ff             	test   %r15,%r15
+  802ea2:	75 77                	jne    802f1b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ea4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ea9:	48 89 da             	mov    %rbx,%rdx
+  802eac:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eb1:	4c 89 e7             	mov    %r12,%rdi
+  802eb4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802eb7:	85 c0                	test   %eax,%eax
+  802eb9:	74 72                	je     802f2d <devpipe_read+0xe1>
+            sys_yield();
+  802ebb:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ebe:	8b 03                	mov    (%rbx),%eax
+  802ec0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ec3:	74 df                	je     802ea4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ec5:	48 63 c8             	movslq %eax,%rcx
+  802ec8:	48 89 ca             	mov    %rcx,%rdx
+  802ecb:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ecf:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802ed6:	08 10 20 
+  802ed9:	48 89 d0             	mov    %rdx,%rax
+  802edc:	48 f7 e6             	mul    %rsi
+  802edf:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ee3:	48 89 d0             	mov    %rdx,%rax
+  802ee6:	48 c1 e0 09          	shl    $0x9,%rax
+  802eea:	48 29 d0             	sub    %rdx,%rax
+  802eed:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802ef4:	00 
+  802ef5:	48 89 c8             	mov    %rcx,%rax
+  802ef8:	48 29 d0             	sub    %rdx,%rax
+  802efb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f00:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f04:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f08:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f0b:	49 83 c7 01          	add    $0x1,%r15
+  802f0f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f13:	75 83                	jne    802e98 <devpipe_read+0x4c>
+    return n;
+  802f15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f19:	eb 03                	jmp    802f1e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f1b:	4c 89 f8             	mov    %r15,%rax
+}
+  802f1e:	48 83 c4 18          	add    $0x18,%rsp
+  802f22:	5b                   	pop    %rbx
+  802f23:	41 5c                	pop    %r12
+  802f25:	41 5d                	pop    %r13
+  802f27:	41 5e                	pop    %r14
+  802f29:	41 5f                	pop    %r15
+  802f2b:	5d                   	pop    %rbp
+  802f2c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f32:	eb ea                	jmp    802f1e <devpipe_read+0xd2>
+
+0000000000802f34 <pipe>:
+pipe(int pfd[2]) {
+  802f34:	55                   	push   %rbp
+  802f35:	48 89 e5             	mov    %rsp,%rbp
+  802f38:	41 55                	push   %r13
+  802f3a:	41 54                	push   %r12
+  802f3c:	53                   	push   %rbx
+  802f3d:	48 83 ec 18          	sub    $0x18,%rsp
+  802f41:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f44:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f48:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	89 c3                	mov    %eax,%ebx
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	0f 88 a0 01 00 00    	js     8030fe <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f5e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f68:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f71:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  802f78:	00 00 00 
+  802f7b:	ff d0                	call   *%rax
+  802f7d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	0f 88 77 01 00 00    	js     8030fe <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f87:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802f8b:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  802f92:	00 00 00 
+  802f95:	ff d0                	call   *%rax
+  802f97:	89 c3                	mov    %eax,%ebx
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	0f 88 43 01 00 00    	js     8030e4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802fa1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fa6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fab:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802faf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb4:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  802fbb:	00 00 00 
+  802fbe:	ff d0                	call   *%rax
+  802fc0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	0f 88 1a 01 00 00    	js     8030e4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802fca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fce:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  802fd5:	00 00 00 
+  802fd8:	ff d0                	call   *%rax
+  802fda:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802fdd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fe2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe7:	48 89 c6             	mov    %rax,%rsi
+  802fea:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fef:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+  802ffb:	89 c3                	mov    %eax,%ebx
+  802ffd:	85 c0                	test   %eax,%eax
+  802fff:	0f 88 c5 00 00 00    	js     8030ca <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803005:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803009:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  803010:	00 00 00 
+  803013:	ff d0                	call   *%rax
+  803015:	48 89 c1             	mov    %rax,%rcx
+  803018:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80301e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803024:	ba 00 00 00 00       	mov    $0x0,%edx
+  803029:	4c 89 ee             	mov    %r13,%rsi
+  80302c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803031:	48 b8 91 13 80 00 00 	movabs $0x801391,%rax
+  803038:	00 00 00 
+  80303b:	ff d0                	call   *%rax
+  80303d:	89 c3                	mov    %eax,%ebx
+  80303f:	85 c0                	test   %eax,%eax
+  803041:	78 6e                	js     8030b1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803043:	be 00 10 00 00       	mov    $0x1000,%esi
+  803048:	4c 89 ef             	mov    %r13,%rdi
+  80304b:	48 b8 cc 12 80 00 00 	movabs $0x8012cc,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+  803057:	83 f8 02             	cmp    $0x2,%eax
+  80305a:	0f 85 ab 00 00 00    	jne    80310b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803060:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  803067:	00 00 
+  803069:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80306d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80306f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803073:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80307a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80307e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803080:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803084:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80308b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80308f:	48 bb fa 16 80 00 00 	movabs $0x8016fa,%rbx
+  803096:	00 00 00 
+  803099:	ff d3                	call   *%rbx
+  80309b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80309f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8030a3:	ff d3                	call   *%rbx
+  8030a5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030af:	eb 4d                	jmp    8030fe <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8030b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030b6:	4c 89 ee             	mov    %r13,%rsi
+  8030b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030be:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8030ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030cf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d8:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  8030df:	00 00 00 
+  8030e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8030e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f2:	48 b8 f6 13 80 00 00 	movabs $0x8013f6,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+}
+  8030fe:	89 d8                	mov    %ebx,%eax
+  803100:	48 83 c4 18          	add    $0x18,%rsp
+  803104:	5b                   	pop    %rbx
+  803105:	41 5c                	pop    %r12
+  803107:	41 5d                	pop    %r13
+  803109:	5d                   	pop    %rbp
+  80310a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80310b:	48 b9 f0 3e 80 00 00 	movabs $0x803ef0,%rcx
+  803112:	00 00 00 
+  803115:	48 ba c7 3e 80 00 00 	movabs $0x803ec7,%rdx
+  80311c:	00 00 00 
+  80311f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803124:	48 bf dc 3e 80 00 00 	movabs $0x803edc,%rdi
+  80312b:	00 00 00 
+  80312e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803133:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  80313a:	00 00 00 
+  80313d:	41 ff d0             	call   *%r8
+
+0000000000803140 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803140:	55                   	push   %rbp
+  803141:	48 89 e5             	mov    %rsp,%rbp
+  803144:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803148:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80314c:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	78 35                	js     803191 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80315c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803160:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  803167:	00 00 00 
+  80316a:	ff d0                	call   *%rax
+  80316c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80316f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803174:	be 00 10 00 00       	mov    $0x1000,%esi
+  803179:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80317d:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+  803189:	85 c0                	test   %eax,%eax
+  80318b:	0f 94 c0             	sete   %al
+  80318e:	0f b6 c0             	movzbl %al,%eax
+}
+  803191:	c9                   	leave
+  803192:	c3                   	ret
+
+0000000000803193 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803193:	48 89 f8             	mov    %rdi,%rax
+  803196:	48 c1 e8 27          	shr    $0x27,%rax
+  80319a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031a1:	01 00 00 
+  8031a4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031a8:	f6 c2 01             	test   $0x1,%dl
+  8031ab:	74 6d                	je     80321a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031ad:	48 89 f8             	mov    %rdi,%rax
+  8031b0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031b4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031bb:	01 00 00 
+  8031be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031c2:	f6 c2 01             	test   $0x1,%dl
+  8031c5:	74 62                	je     803229 <get_uvpt_entry+0x96>
+  8031c7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031ce:	01 00 00 
+  8031d1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031d5:	f6 c2 80             	test   $0x80,%dl
+  8031d8:	75 4f                	jne    803229 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8031da:	48 89 f8             	mov    %rdi,%rax
+  8031dd:	48 c1 e8 15          	shr    $0x15,%rax
+  8031e1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031e8:	01 00 00 
+  8031eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031ef:	f6 c2 01             	test   $0x1,%dl
+  8031f2:	74 44                	je     803238 <get_uvpt_entry+0xa5>
+  8031f4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8031fb:	01 00 00 
+  8031fe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803202:	f6 c2 80             	test   $0x80,%dl
+  803205:	75 31                	jne    803238 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803207:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80320b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803212:	01 00 00 
+  803215:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803219:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80321a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803221:	01 00 00 
+  803224:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803228:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803229:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803230:	01 00 00 
+  803233:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803237:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803238:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80323f:	01 00 00 
+  803242:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803246:	c3                   	ret
+
+0000000000803247 <get_prot>:
+
+int
+get_prot(void *va) {
+  803247:	55                   	push   %rbp
+  803248:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80324b:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+  803257:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80325a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80325f:	89 c1                	mov    %eax,%ecx
+  803261:	83 c9 04             	or     $0x4,%ecx
+  803264:	f6 c2 01             	test   $0x1,%dl
+  803267:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80326a:	89 c1                	mov    %eax,%ecx
+  80326c:	83 c9 02             	or     $0x2,%ecx
+  80326f:	f6 c2 02             	test   $0x2,%dl
+  803272:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803275:	89 c1                	mov    %eax,%ecx
+  803277:	83 c9 01             	or     $0x1,%ecx
+  80327a:	48 85 d2             	test   %rdx,%rdx
+  80327d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803280:	89 c1                	mov    %eax,%ecx
+  803282:	83 c9 40             	or     $0x40,%ecx
+  803285:	f6 c6 04             	test   $0x4,%dh
+  803288:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80328b:	5d                   	pop    %rbp
+  80328c:	c3                   	ret
+
+000000000080328d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80328d:	55                   	push   %rbp
+  80328e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803291:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80329d:	48 c1 e8 06          	shr    $0x6,%rax
+  8032a1:	83 e0 01             	and    $0x1,%eax
+}
+  8032a4:	5d                   	pop    %rbp
+  8032a5:	c3                   	ret
+
+00000000008032a6 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8032a6:	55                   	push   %rbp
+  8032a7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032aa:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8032b6:	48 c1 e8 05          	shr    $0x5,%rax
+  8032ba:	83 e0 01             	and    $0x1,%eax
+}
+  8032bd:	5d                   	pop    %rbp
+  8032be:	c3                   	ret
+
+00000000008032bf <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032bf:	55                   	push   %rbp
+  8032c0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032c3:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  8032ca:	00 00 00 
+  8032cd:	ff d0                	call   *%rax
+  8032cf:	83 e0 01             	and    $0x1,%eax
+}
+  8032d2:	5d                   	pop    %rbp
+  8032d3:	c3                   	ret
+
+00000000008032d4 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	41 57                	push   %r15
+  8032da:	41 56                	push   %r14
+  8032dc:	41 55                	push   %r13
+  8032de:	41 54                	push   %r12
+  8032e0:	53                   	push   %rbx
+  8032e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032e9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8032ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8032f2:	49 bd bf 32 80 00 00 	movabs $0x8032bf,%r13
+  8032f9:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8032fc:	49 bf 47 32 80 00 00 	movabs $0x803247,%r15
+  803303:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803306:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80330d:	00 00 00 
+  803310:	eb 0c                	jmp    80331e <foreach_shared_region+0x4a>
+  803312:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803319:	4c 39 f3             	cmp    %r14,%rbx
+  80331c:	74 2e                	je     80334c <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80331e:	48 89 df             	mov    %rbx,%rdi
+  803321:	41 ff d5             	call   *%r13
+  803324:	84 c0                	test   %al,%al
+  803326:	74 ea                	je     803312 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803328:	48 89 df             	mov    %rbx,%rdi
+  80332b:	41 ff d7             	call   *%r15
+  80332e:	a8 40                	test   $0x40,%al
+  803330:	74 e0                	je     803312 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803332:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803339:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333d:	48 89 df             	mov    %rbx,%rdi
+  803340:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803344:	ff d0                	call   *%rax
+				if (res < 0) {
+  803346:	85 c0                	test   %eax,%eax
+  803348:	79 c8                	jns    803312 <foreach_shared_region+0x3e>
+  80334a:	eb 05                	jmp    803351 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80334c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803351:	48 83 c4 18          	add    $0x18,%rsp
+  803355:	5b                   	pop    %rbx
+  803356:	41 5c                	pop    %r12
+  803358:	41 5d                	pop    %r13
+  80335a:	41 5e                	pop    %r14
+  80335c:	41 5f                	pop    %r15
+  80335e:	5d                   	pop    %rbp
+  80335f:	c3                   	ret
+
+0000000000803360 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803360:	b8 00 00 00 00       	mov    $0x0,%eax
+  803365:	c3                   	ret
+
+0000000000803366 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803366:	55                   	push   %rbp
+  803367:	48 89 e5             	mov    %rsp,%rbp
+  80336a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80336d:	48 be 14 3f 80 00 00 	movabs $0x803f14,%rsi
+  803374:	00 00 00 
+  803377:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  80337e:	00 00 00 
+  803381:	ff d0                	call   *%rax
+    return 0;
+}
+  803383:	b8 00 00 00 00       	mov    $0x0,%eax
+  803388:	5d                   	pop    %rbp
+  803389:	c3                   	ret
+
+000000000080338a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80338a:	55                   	push   %rbp
+  80338b:	48 89 e5             	mov    %rsp,%rbp
+  80338e:	41 57                	push   %r15
+  803390:	41 56                	push   %r14
+  803392:	41 55                	push   %r13
+  803394:	41 54                	push   %r12
+  803396:	53                   	push   %rbx
+  803397:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80339e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8033a5:	48 85 d2             	test   %rdx,%rdx
+  8033a8:	74 7a                	je     803424 <devcons_write+0x9a>
+  8033aa:	49 89 d6             	mov    %rdx,%r14
+  8033ad:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033b3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8033b8:	49 bf 98 0e 80 00 00 	movabs $0x800e98,%r15
+  8033bf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8033c2:	4c 89 f3             	mov    %r14,%rbx
+  8033c5:	48 29 f3             	sub    %rsi,%rbx
+  8033c8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033cd:	48 39 c3             	cmp    %rax,%rbx
+  8033d0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8033d4:	4c 63 eb             	movslq %ebx,%r13
+  8033d7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8033de:	48 01 c6             	add    %rax,%rsi
+  8033e1:	4c 89 ea             	mov    %r13,%rdx
+  8033e4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033eb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8033ee:	4c 89 ee             	mov    %r13,%rsi
+  8033f1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033f8:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803404:	41 01 dc             	add    %ebx,%r12d
+  803407:	49 63 f4             	movslq %r12d,%rsi
+  80340a:	4c 39 f6             	cmp    %r14,%rsi
+  80340d:	72 b3                	jb     8033c2 <devcons_write+0x38>
+    return res;
+  80340f:	49 63 c4             	movslq %r12d,%rax
+}
+  803412:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803419:	5b                   	pop    %rbx
+  80341a:	41 5c                	pop    %r12
+  80341c:	41 5d                	pop    %r13
+  80341e:	41 5e                	pop    %r14
+  803420:	41 5f                	pop    %r15
+  803422:	5d                   	pop    %rbp
+  803423:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803424:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80342a:	eb e3                	jmp    80340f <devcons_write+0x85>
+
+000000000080342c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80342c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80342f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803434:	48 85 c0             	test   %rax,%rax
+  803437:	74 55                	je     80348e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803439:	55                   	push   %rbp
+  80343a:	48 89 e5             	mov    %rsp,%rbp
+  80343d:	41 55                	push   %r13
+  80343f:	41 54                	push   %r12
+  803441:	53                   	push   %rbx
+  803442:	48 83 ec 08          	sub    $0x8,%rsp
+  803446:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803449:	48 bb ce 11 80 00 00 	movabs $0x8011ce,%rbx
+  803450:	00 00 00 
+  803453:	49 bc 9b 12 80 00 00 	movabs $0x80129b,%r12
+  80345a:	00 00 00 
+  80345d:	eb 03                	jmp    803462 <devcons_read+0x36>
+  80345f:	41 ff d4             	call   *%r12
+  803462:	ff d3                	call   *%rbx
+  803464:	85 c0                	test   %eax,%eax
+  803466:	74 f7                	je     80345f <devcons_read+0x33>
+    if (c < 0) return c;
+  803468:	48 63 d0             	movslq %eax,%rdx
+  80346b:	78 13                	js     803480 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80346d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803472:	83 f8 04             	cmp    $0x4,%eax
+  803475:	74 09                	je     803480 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803477:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80347b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803480:	48 89 d0             	mov    %rdx,%rax
+  803483:	48 83 c4 08          	add    $0x8,%rsp
+  803487:	5b                   	pop    %rbx
+  803488:	41 5c                	pop    %r12
+  80348a:	41 5d                	pop    %r13
+  80348c:	5d                   	pop    %rbp
+  80348d:	c3                   	ret
+  80348e:	48 89 d0             	mov    %rdx,%rax
+  803491:	c3                   	ret
+
+0000000000803492 <cputchar>:
+cputchar(int ch) {
+  803492:	55                   	push   %rbp
+  803493:	48 89 e5             	mov    %rsp,%rbp
+  803496:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80349a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80349e:	be 01 00 00 00       	mov    $0x1,%esi
+  8034a3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034a7:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  8034ae:	00 00 00 
+  8034b1:	ff d0                	call   *%rax
+}
+  8034b3:	c9                   	leave
+  8034b4:	c3                   	ret
+
+00000000008034b5 <getchar>:
+getchar(void) {
+  8034b5:	55                   	push   %rbp
+  8034b6:	48 89 e5             	mov    %rsp,%rbp
+  8034b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8034bd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034c2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8034c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cb:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  8034d2:	00 00 00 
+  8034d5:	ff d0                	call   *%rax
+  8034d7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 06                	js     8034e3 <getchar+0x2e>
+  8034dd:	74 08                	je     8034e7 <getchar+0x32>
+  8034df:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8034e3:	89 d0                	mov    %edx,%eax
+  8034e5:	c9                   	leave
+  8034e6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8034e7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8034ec:	eb f5                	jmp    8034e3 <getchar+0x2e>
+
+00000000008034ee <iscons>:
+iscons(int fdnum) {
+  8034ee:	55                   	push   %rbp
+  8034ef:	48 89 e5             	mov    %rsp,%rbp
+  8034f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034f6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034fa:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  803501:	00 00 00 
+  803504:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803506:	85 c0                	test   %eax,%eax
+  803508:	78 18                	js     803522 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80350a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80350e:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803515:	00 00 00 
+  803518:	8b 00                	mov    (%rax),%eax
+  80351a:	39 02                	cmp    %eax,(%rdx)
+  80351c:	0f 94 c0             	sete   %al
+  80351f:	0f b6 c0             	movzbl %al,%eax
+}
+  803522:	c9                   	leave
+  803523:	c3                   	ret
+
+0000000000803524 <opencons>:
+opencons(void) {
+  803524:	55                   	push   %rbp
+  803525:	48 89 e5             	mov    %rsp,%rbp
+  803528:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80352c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803530:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+  80353c:	85 c0                	test   %eax,%eax
+  80353e:	78 49                	js     803589 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803540:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803545:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80354a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80354e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803553:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  80355a:	00 00 00 
+  80355d:	ff d0                	call   *%rax
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	78 26                	js     803589 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803563:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803567:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80356e:	00 00 
+  803570:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803572:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803576:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80357d:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  803584:	00 00 00 
+  803587:	ff d0                	call   *%rax
+}
+  803589:	c9                   	leave
+  80358a:	c3                   	ret
+
+000000000080358b <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80358b:	55                   	push   %rbp
+  80358c:	48 89 e5             	mov    %rsp,%rbp
+  80358f:	41 55                	push   %r13
+  803591:	41 54                	push   %r12
+  803593:	53                   	push   %rbx
+  803594:	48 83 ec 08          	sub    $0x8,%rsp
+  803598:	49 89 fc             	mov    %rdi,%r12
+  80359b:	48 89 f7             	mov    %rsi,%rdi
+  80359e:	48 89 d3             	mov    %rdx,%rbx
+  8035a1:	49 89 cd             	mov    %rcx,%r13
+  8035a4:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8035a7:	48 85 f6             	test   %rsi,%rsi
+  8035aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035b1:	00 00 00 
+  8035b4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8035b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035bd:	48 85 db             	test   %rbx,%rbx
+  8035c0:	74 03                	je     8035c5 <ipc_recv_timed+0x3a>
+  8035c2:	48 8b 33             	mov    (%rbx),%rsi
+  8035c5:	48 b8 c4 15 80 00 00 	movabs $0x8015c4,%rax
+  8035cc:	00 00 00 
+  8035cf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	78 75                	js     80364a <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8035d5:	4d 85 e4             	test   %r12,%r12
+  8035d8:	74 14                	je     8035ee <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8035da:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  8035e1:	00 00 00 
+  8035e4:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8035ea:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8035ee:	4d 85 ed             	test   %r13,%r13
+  8035f1:	74 14                	je     803607 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8035f3:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  8035fa:	00 00 00 
+  8035fd:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803603:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803607:	48 85 db             	test   %rbx,%rbx
+  80360a:	74 23                	je     80362f <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80360c:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  803613:	00 00 00 
+  803616:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80361c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803621:	85 c9                	test   %ecx,%ecx
+  803623:	74 07                	je     80362c <ipc_recv_timed+0xa1>
+  803625:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80362c:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80362f:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  803636:	00 00 00 
+  803639:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80363f:	48 83 c4 08          	add    $0x8,%rsp
+  803643:	5b                   	pop    %rbx
+  803644:	41 5c                	pop    %r12
+  803646:	41 5d                	pop    %r13
+  803648:	5d                   	pop    %rbp
+  803649:	c3                   	ret
+        if (from_env_store != NULL) {
+  80364a:	4d 85 e4             	test   %r12,%r12
+  80364d:	74 08                	je     803657 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80364f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803656:	00 
+        if (perm_store != NULL) {
+  803657:	4d 85 ed             	test   %r13,%r13
+  80365a:	74 08                	je     803664 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80365c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803663:	00 
+        if (size != NULL) {
+  803664:	48 85 db             	test   %rbx,%rbx
+  803667:	74 d6                	je     80363f <ipc_recv_timed+0xb4>
+            *size = 0;
+  803669:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803670:	eb cd                	jmp    80363f <ipc_recv_timed+0xb4>
+
+0000000000803672 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803672:	55                   	push   %rbp
+  803673:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80367c:	48 b8 8b 35 80 00 00 	movabs $0x80358b,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+}
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+
+000000000080368a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 57                	push   %r15
+  803690:	41 56                	push   %r14
+  803692:	41 55                	push   %r13
+  803694:	41 54                	push   %r12
+  803696:	53                   	push   %rbx
+  803697:	48 83 ec 18          	sub    $0x18,%rsp
+  80369b:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80369e:	48 89 d3             	mov    %rdx,%rbx
+  8036a1:	49 89 cc             	mov    %rcx,%r12
+  8036a4:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8036a7:	48 85 d2             	test   %rdx,%rdx
+  8036aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8036b1:	00 00 00 
+  8036b4:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036b8:	89 f0                	mov    %esi,%eax
+  8036ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8036be:	48 89 da             	mov    %rbx,%rdx
+  8036c1:	48 89 c6             	mov    %rax,%rsi
+  8036c4:	48 b8 98 15 80 00 00 	movabs $0x801598,%rax
+  8036cb:	00 00 00 
+  8036ce:	ff d0                	call   *%rax
+    while (res < 0) {
+  8036d0:	85 c0                	test   %eax,%eax
+  8036d2:	79 65                	jns    803739 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8036d4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036d7:	75 33                	jne    80370c <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8036d9:	49 bf 9b 12 80 00 00 	movabs $0x80129b,%r15
+  8036e0:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036e3:	49 be 98 15 80 00 00 	movabs $0x801598,%r14
+  8036ea:	00 00 00 
+        sys_yield();
+  8036ed:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036f0:	45 89 e8             	mov    %r13d,%r8d
+  8036f3:	4c 89 e1             	mov    %r12,%rcx
+  8036f6:	48 89 da             	mov    %rbx,%rdx
+  8036f9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036fd:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803700:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803703:	85 c0                	test   %eax,%eax
+  803705:	79 32                	jns    803739 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803707:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80370a:	74 e1                	je     8036ed <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80370c:	89 c1                	mov    %eax,%ecx
+  80370e:	48 ba 20 3f 80 00 00 	movabs $0x803f20,%rdx
+  803715:	00 00 00 
+  803718:	be 52 00 00 00       	mov    $0x52,%esi
+  80371d:	48 bf 34 3f 80 00 00 	movabs $0x803f34,%rdi
+  803724:	00 00 00 
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372c:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  803733:	00 00 00 
+  803736:	41 ff d0             	call   *%r8
+    }
+}
+  803739:	48 83 c4 18          	add    $0x18,%rsp
+  80373d:	5b                   	pop    %rbx
+  80373e:	41 5c                	pop    %r12
+  803740:	41 5d                	pop    %r13
+  803742:	41 5e                	pop    %r14
+  803744:	41 5f                	pop    %r15
+  803746:	5d                   	pop    %rbp
+  803747:	c3                   	ret
+
+0000000000803748 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803748:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80374d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803754:	00 00 00 
+  803757:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80375b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80375f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803763:	48 01 ca             	add    %rcx,%rdx
+  803766:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80376c:	39 fa                	cmp    %edi,%edx
+  80376e:	74 12                	je     803782 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803770:	48 83 c0 01          	add    $0x1,%rax
+  803774:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80377a:	75 db                	jne    803757 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80377c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803781:	c3                   	ret
+            return envs[i].env_id;
+  803782:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803786:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80378a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80378e:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803795:	00 00 00 
+  803798:	48 01 d0             	add    %rdx,%rax
+  80379b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8037a1:	c3                   	ret
+  8037a2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008037a8 <__rodata_start>:
+  8037a8:	4d 61                	rex.WRB (bad)
+  8037aa:	6b 69 6e 67          	imul   $0x67,0x6e(%rcx),%ebp
+  8037ae:	20 73 75             	and    %dh,0x75(%rbx)
+  8037b1:	72 65                	jb     803818 <__rodata_start+0x70>
+  8037b3:	20 62 73             	and    %ah,0x73(%rdx)
+  8037b6:	73 20                	jae    8037d8 <__rodata_start+0x30>
+  8037b8:	77 6f                	ja     803829 <__rodata_start+0x81>
+  8037ba:	72 6b                	jb     803827 <__rodata_start+0x7f>
+  8037bc:	73 20                	jae    8037de <__rodata_start+0x36>
+  8037be:	72 69                	jb     803829 <__rodata_start+0x81>
+  8037c0:	67 68 74 2e 2e 2e    	addr32 push $0x2e2e2e74
+  8037c6:	0a 00                	or     (%rax),%al
+  8037c8:	62                   	(bad)
+  8037c9:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  8037d0:	5b                   	pop    %rbx
+  8037d1:	25 64 5d 20 64       	and    $0x64205d64,%eax
+  8037d6:	69 64 6e 27 74 20 68 	imul   $0x6f682074,0x27(%rsi,%rbp,2),%esp
+  8037dd:	6f 
+  8037de:	6c                   	insb   (%dx),%es:(%rdi)
+  8037df:	64 20 69 74          	and    %ch,%fs:0x74(%rcx)
+  8037e3:	73 20                	jae    803805 <__rodata_start+0x5d>
+  8037e5:	76 61                	jbe    803848 <__rodata_start+0xa0>
+  8037e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8037e8:	75 65                	jne    80384f <__rodata_start+0xa7>
+  8037ea:	21 0a                	and    %ecx,(%rdx)
+  8037ec:	00 00                	add    %al,(%rax)
+  8037ee:	00 00                	add    %al,(%rax)
+  8037f0:	59                   	pop    %rcx
+  8037f1:	65 73 2c             	gs jae 803820 <__rodata_start+0x78>
+  8037f4:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8037f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f8:	64 2e 20 20          	fs and %ah,%fs:(%rax)
+  8037fc:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  8037fe:	77 20                	ja     803820 <__rodata_start+0x78>
+  803800:	64 6f                	outsl  %fs:(%rsi),(%dx)
+  803802:	69 6e 67 20 61 20 77 	imul   $0x77206120,0x67(%rsi),%ebp
+  803809:	69 6c 64 20 77 72 69 	imul   $0x74697277,0x20(%rsp,%riz,2),%ebp
+  803810:	74 
+  803811:	65 20 6f 66          	and    %ch,%gs:0x66(%rdi)
+  803815:	66 20 74 68 65       	data16 and %dh,0x65(%rax,%rbp,2)
+  80381a:	20 65 6e             	and    %ah,0x6e(%rbp)
+  80381d:	64 2e 2e 2e 0a 00    	fs cs cs or %fs:(%rax),%al
+  803823:	62                   	(bad)
+  803824:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  80382b:	5b                   	pop    %rbx
+  80382c:	25 64 5d 20 69       	and    $0x69205d64,%eax
+  803831:	73 6e                	jae    8038a1 <__rodata_start+0xf9>
+  803833:	27                   	(bad)
+  803834:	74 20                	je     803856 <__rodata_start+0xae>
+  803836:	63 6c 65 61          	movsxd 0x61(%rbp,%riz,2),%ebp
+  80383a:	72 65                	jb     8038a1 <__rodata_start+0xf9>
+  80383c:	64 21 0a             	and    %ecx,%fs:(%rdx)
+  80383f:	00 75 73             	add    %dh,0x73(%rbp)
+  803842:	65 72 2f             	gs jb  803874 <__rodata_start+0xcc>
+  803845:	74 65                	je     8038ac <__rodata_start+0x104>
+  803847:	73 74                	jae    8038bd <__rodata_start+0x115>
+  803849:	62 73                	(bad)
+  80384b:	73 2e                	jae    80387b <__rodata_start+0xd3>
+  80384d:	63 00                	movsxd (%rax),%eax
+  80384f:	53                   	push   %rbx
+  803850:	48                   	rex.W
+  803851:	4f 55                	rex.WRXB push %r13
+  803853:	4c                   	rex.WR
+  803854:	44 20 48 41          	and    %r9b,0x41(%rax)
+  803858:	56                   	push   %rsi
+  803859:	45 20 54 52 41       	and    %r10b,0x41(%r10,%rdx,2)
+  80385e:	50                   	push   %rax
+  80385f:	50                   	push   %rax
+  803860:	45                   	rex.RB
+  803861:	44 21 21             	and    %r12d,(%rcx)
+  803864:	21 00                	and    %eax,(%rax)
+  803866:	3c 75                	cmp    $0x75,%al
+  803868:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803869:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80386d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80386e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803872:	30 38                	xor    %bh,(%rax)
+  803874:	78 5d                	js     8038d3 <__rodata_start+0x12b>
+  803876:	20 75 73             	and    %dh,0x73(%rbp)
+  803879:	65 72 20             	gs jb  80389c <__rodata_start+0xf4>
+  80387c:	70 61                	jo     8038df <__rodata_start+0x137>
+  80387e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80387f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803886:	73 20                	jae    8038a8 <__rodata_start+0x100>
+  803888:	61                   	(bad)
+  803889:	74 20                	je     8038ab <__rodata_start+0x103>
+  80388b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803890:	3a 20                	cmp    (%rax),%ah
+  803892:	00 30                	add    %dh,(%rax)
+  803894:	31 32                	xor    %esi,(%rdx)
+  803896:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80389d:	41                   	rex.B
+  80389e:	42                   	rex.X
+  80389f:	43                   	rex.XB
+  8038a0:	44                   	rex.R
+  8038a1:	45                   	rex.RB
+  8038a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038a5:	31 32                	xor    %esi,(%rdx)
+  8038a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038ae:	61                   	(bad)
+  8038af:	62 63 64 65 66       	(bad)
+  8038b4:	00 28                	add    %ch,(%rax)
+  8038b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038b7:	75 6c                	jne    803925 <__rodata_start+0x17d>
+  8038b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8038ba:	29 00                	sub    %eax,(%rax)
+  8038bc:	65 72 72             	gs jb  803931 <__rodata_start+0x189>
+  8038bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c0:	72 20                	jb     8038e2 <__rodata_start+0x13a>
+  8038c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038c7:	73 70                	jae    803939 <__rodata_start+0x191>
+  8038c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8038d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d5:	72 00                	jb     8038d7 <__rodata_start+0x12f>
+  8038d7:	62 61 64 20 65       	(bad)
+  8038dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038dd:	76 69                	jbe    803948 <__rodata_start+0x1a0>
+  8038df:	72 6f                	jb     803950 <__rodata_start+0x1a8>
+  8038e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8038e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038e5:	74 00                	je     8038e7 <__rodata_start+0x13f>
+  8038e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038ee:	20 70 61             	and    %dh,0x61(%rax)
+  8038f1:	72 61                	jb     803954 <__rodata_start+0x1ac>
+  8038f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8038f4:	65 74 65             	gs je  80395c <__rodata_start+0x1b4>
+  8038f7:	72 00                	jb     8038f9 <__rodata_start+0x151>
+  8038f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fa:	75 74                	jne    803970 <__rodata_start+0x1c8>
+  8038fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8038ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  803902:	6d                   	insl   (%dx),%es:(%rdi)
+  803903:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803904:	72 79                	jb     80397f <__rodata_start+0x1d7>
+  803906:	00 6f 75             	add    %ch,0x75(%rdi)
+  803909:	74 20                	je     80392b <__rodata_start+0x183>
+  80390b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803910:	76 69                	jbe    80397b <__rodata_start+0x1d3>
+  803912:	72 6f                	jb     803983 <__rodata_start+0x1db>
+  803914:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803915:	6d                   	insl   (%dx),%es:(%rdi)
+  803916:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803918:	74 73                	je     80398d <__rodata_start+0x1e5>
+  80391a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80391d:	72 72                	jb     803991 <__rodata_start+0x1e9>
+  80391f:	75 70                	jne    803991 <__rodata_start+0x1e9>
+  803921:	74 65                	je     803988 <__rodata_start+0x1e0>
+  803923:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803928:	75 67                	jne    803991 <__rodata_start+0x1e9>
+  80392a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80392d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80392f:	00 73 65             	add    %dh,0x65(%rbx)
+  803932:	67 6d                	insl   (%dx),%es:(%edi)
+  803934:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803936:	74 61                	je     803999 <__rodata_start+0x1f1>
+  803938:	74 69                	je     8039a3 <__rodata_start+0x1fb>
+  80393a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80393c:	20 66 61             	and    %ah,0x61(%rsi)
+  80393f:	75 6c                	jne    8039ad <__rodata_start+0x205>
+  803941:	74 00                	je     803943 <__rodata_start+0x19b>
+  803943:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80394a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80394d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803951:	61                   	(bad)
+  803952:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803957:	20 73 75             	and    %dh,0x75(%rbx)
+  80395a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80395d:	73 79                	jae    8039d8 <__rodata_start+0x230>
+  80395f:	73 74                	jae    8039d5 <__rodata_start+0x22d>
+  803961:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803963:	20 63 61             	and    %ah,0x61(%rbx)
+  803966:	6c                   	insb   (%dx),%es:(%rdi)
+  803967:	6c                   	insb   (%dx),%es:(%rdi)
+  803968:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80396b:	74 72                	je     8039df <__rodata_start+0x237>
+  80396d:	79 20                	jns    80398f <__rodata_start+0x1e7>
+  80396f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803970:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803971:	74 20                	je     803993 <__rodata_start+0x1eb>
+  803973:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803975:	75 6e                	jne    8039e5 <__rodata_start+0x23d>
+  803977:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80397b:	76 20                	jbe    80399d <__rodata_start+0x1f5>
+  80397d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803984:	72 65                	jb     8039eb <__rodata_start+0x243>
+  803986:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803989:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80398a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80398e:	65 78 70             	gs js  803a01 <__rodata_start+0x259>
+  803991:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803996:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803999:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80399d:	20 66 69             	and    %ah,0x69(%rsi)
+  8039a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8039a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8039a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039ad:	61                   	(bad)
+  8039ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8039b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c0:	79 20                	jns    8039e2 <__rodata_start+0x23a>
+  8039c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039c9:	72 65                	jb     803a30 <__rodata_start+0x288>
+  8039cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8039d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8039d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8039d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8039db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8039df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e1:	74 20                	je     803a03 <__rodata_start+0x25b>
+  8039e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039e5:	75 6e                	jne    803a55 <__rodata_start+0x2ad>
+  8039e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8039eb:	76 61                	jbe    803a4e <__rodata_start+0x2a6>
+  8039ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8039f5:	00 
+  8039f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8039fd:	72 65                	jb     803a64 <__rodata_start+0x2bc>
+  8039ff:	61                   	(bad)
+  803a00:	64 79 20             	fs jns 803a23 <__rodata_start+0x27b>
+  803a03:	65 78 69             	gs js  803a6f <__rodata_start+0x2c7>
+  803a06:	73 74                	jae    803a7c <__rodata_start+0x2d4>
+  803a08:	73 00                	jae    803a0a <__rodata_start+0x262>
+  803a0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a0b:	70 65                	jo     803a72 <__rodata_start+0x2ca>
+  803a0d:	72 61                	jb     803a70 <__rodata_start+0x2c8>
+  803a0f:	74 69                	je     803a7a <__rodata_start+0x2d2>
+  803a11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a13:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a16:	74 20                	je     803a38 <__rodata_start+0x290>
+  803a18:	73 75                	jae    803a8f <__rodata_start+0x2e7>
+  803a1a:	70 70                	jo     803a8c <__rodata_start+0x2e4>
+  803a1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a1d:	72 74                	jb     803a93 <__rodata_start+0x2eb>
+  803a1f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803a25:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803a2a:	74 00                	je     803a2c <__rodata_start+0x284>
+  803a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a33:	00 00 00 
+  803a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803a3d:	00 00 00 
+  803a40:	66 05 80 00          	add    $0x80,%ax
+  803a44:	00 00                	add    %al,(%rax)
+  803a46:	00 00                	add    %al,(%rax)
+  803a48:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  803a49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803a4f:	00 97 0b 80 00 00    	add    %dl,0x800b(%rdi)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 85 05 80 00 00    	add    %al,0x8005(%rbp)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 79 05             	add    %bh,0x5(%rcx)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 f3                	add    %dh,%bl
+  803a99:	05 80 00 00 00       	add    $0x80,%eax
+  803a9e:	00 00                	add    %al,(%rax)
+  803aa0:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  803aa1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803aa7:	00 79 05             	add    %bh,0x5(%rcx)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 ca                	add    %cl,%dl
+  803be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bef:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 16                	add    %dl,(%rsi)
+  803c41:	06                   	(bad)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 e5                	add    %ah,%ch
+  803c49:	07                   	(bad)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 45 06             	add    %al,0x6(%rbp)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 0b                	add    %cl,(%rbx)
+  803c89:	06                   	(bad)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 8d 09 80 00 00    	add    %cl,0x8009(%rbp)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 57 0a             	add    %dl,0xa(%rdi)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 dc                	add    %bl,%ah
+  803cc1:	06                   	(bad)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 b9 08 80 00 00    	add    %bh,0x8008(%rcx)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 ca                	add    %cl,%dl
+  803ce9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cef:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 6f 05             	add    %ch,0x5(%rdi)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d00 <error_string>:
+	...
+  803d08:	c5 38 80 00 00 00 00 00 d7 38 80 00 00 00 00 00     .8.......8......
+  803d18:	e7 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803d28:	07 39 80 00 00 00 00 00 1b 39 80 00 00 00 00 00     .9.......9......
+  803d38:	30 39 80 00 00 00 00 00 43 39 80 00 00 00 00 00     09......C9......
+  803d48:	55 39 80 00 00 00 00 00 69 39 80 00 00 00 00 00     U9......i9......
+  803d58:	79 39 80 00 00 00 00 00 8c 39 80 00 00 00 00 00     y9.......9......
+  803d68:	a3 39 80 00 00 00 00 00 b9 39 80 00 00 00 00 00     .9.......9......
+  803d78:	d1 39 80 00 00 00 00 00 e9 39 80 00 00 00 00 00     .9.......9......
+  803d88:	f6 39 80 00 00 00 00 00 a8 3d 80 00 00 00 00 00     .9.......=......
+  803d98:	0a 3a 80 00 00 00 00 00 22 3a 80 00 00 00 00 00     .:......":......
+  803da8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803db8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803dc8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803dd8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803de8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803df8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803e08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803e18:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803e28:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803e38:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803e48:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803e58:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803e68:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803e78:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803e88:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803e98:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ea0 <devtab>:
+  803ea0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803eb0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803ec0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803ed0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803ee0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803ef0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803f00:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803f10:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803f20:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  803f30:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,7616 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 10 3b 80 00 00 	movabs $0x803b10,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 c7 1f 80 00 00 	movabs $0x801fc7,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 62 80 00 00 	movabs $0x806200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 9d 1e 80 00 00 	movabs $0x801e9d,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 c7 1f 80 00 00 	movabs $0x801fc7,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf 80 3b 80 00 00 	movabs $0x803b80,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 13 05 80 00 00 	movabs $0x800513,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 9d 1e 80 00 00 	movabs $0x801e9d,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 51 11 80 00 00 	movabs $0x801151,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf 4b 3b 80 00 00 	movabs $0x803b4b,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 13 05 80 00 00 	movabs $0x800513,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 c7 1f 80 00 00 	movabs $0x801fc7,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 a0 03 80 00 00 	movabs $0x8003a0,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 3c 34 80 00 00 	movabs $0x80343c,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 9d 1e 80 00 00 	movabs $0x801e9d,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf 64 3b 80 00 00 	movabs $0x803b64,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 13 05 80 00 00 	movabs $0x800513,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 15 3b 80 00 00 	movabs $0x803b15,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 38 3b 80 00 00 	movabs $0x803b38,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba 42 3b 80 00 00 	movabs $0x803b42,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba c8 3b 80 00 00 	movabs $0x803bc8,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba f8 3b 80 00 00 	movabs $0x803bf8,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 c3 03 80 00 00 	movabs $0x8003c3,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba 30 3c 80 00 00 	movabs $0x803c30,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf 23 3b 80 00 00 	movabs $0x803b23,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	41 89 fd             	mov    %edi,%r13d
+  800300:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800303:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  80030a:	00 00 00 
+  80030d:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800314:	00 00 00 
+  800317:	48 39 c2             	cmp    %rax,%rdx
+  80031a:	73 17                	jae    800333 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80031c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80031f:	49 89 c4             	mov    %rax,%r12
+  800322:	48 83 c3 08          	add    $0x8,%rbx
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	ff 53 f8             	call   *-0x8(%rbx)
+  80032e:	4c 39 e3             	cmp    %r12,%rbx
+  800331:	72 ef                	jb     800322 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800333:	48 b8 04 14 80 00 00 	movabs $0x801404,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+  80033f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800344:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800348:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80034c:	48 c1 e0 04          	shl    $0x4,%rax
+  800350:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800357:	00 00 00 
+  80035a:	48 01 d0             	add    %rdx,%rax
+  80035d:	48 a3 00 64 80 00 00 	movabs %rax,0x806400
+  800364:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800367:	45 85 ed             	test   %r13d,%r13d
+  80036a:	7e 0d                	jle    800379 <libmain+0x87>
+  80036c:	49 8b 06             	mov    (%r14),%rax
+  80036f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800376:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800379:	4c 89 f6             	mov    %r14,%rsi
+  80037c:	44 89 ef             	mov    %r13d,%edi
+  80037f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800386:	00 00 00 
+  800389:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80038b:	48 b8 a0 03 80 00 00 	movabs $0x8003a0,%rax
+  800392:	00 00 00 
+  800395:	ff d0                	call   *%rax
+#endif
+}
+  800397:	5b                   	pop    %rbx
+  800398:	41 5c                	pop    %r12
+  80039a:	41 5d                	pop    %r13
+  80039c:	41 5e                	pop    %r14
+  80039e:	5d                   	pop    %rbp
+  80039f:	c3                   	ret
+
+00000000008003a0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003a0:	55                   	push   %rbp
+  8003a1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003a4:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b5:	48 b8 99 13 80 00 00 	movabs $0x801399,%rax
+  8003bc:	00 00 00 
+  8003bf:	ff d0                	call   *%rax
+}
+  8003c1:	5d                   	pop    %rbp
+  8003c2:	c3                   	ret
+
+00000000008003c3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003c3:	55                   	push   %rbp
+  8003c4:	48 89 e5             	mov    %rsp,%rbp
+  8003c7:	41 56                	push   %r14
+  8003c9:	41 55                	push   %r13
+  8003cb:	41 54                	push   %r12
+  8003cd:	53                   	push   %rbx
+  8003ce:	48 83 ec 50          	sub    $0x50,%rsp
+  8003d2:	49 89 fc             	mov    %rdi,%r12
+  8003d5:	41 89 f5             	mov    %esi,%r13d
+  8003d8:	48 89 d3             	mov    %rdx,%rbx
+  8003db:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003df:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003e3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003e7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003f6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003fa:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003fe:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800405:	00 00 00 
+  800408:	4c 8b 30             	mov    (%rax),%r14
+  80040b:	48 b8 04 14 80 00 00 	movabs $0x801404,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+  800417:	89 c6                	mov    %eax,%esi
+  800419:	45 89 e8             	mov    %r13d,%r8d
+  80041c:	4c 89 e1             	mov    %r12,%rcx
+  80041f:	4c 89 f2             	mov    %r14,%rdx
+  800422:	48 bf 60 3c 80 00 00 	movabs $0x803c60,%rdi
+  800429:	00 00 00 
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	49 bc 13 05 80 00 00 	movabs $0x800513,%r12
+  800438:	00 00 00 
+  80043b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80043e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800442:	48 89 df             	mov    %rbx,%rdi
+  800445:	48 b8 af 04 80 00 00 	movabs $0x8004af,%rax
+  80044c:	00 00 00 
+  80044f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800451:	48 bf 62 3b 80 00 00 	movabs $0x803b62,%rdi
+  800458:	00 00 00 
+  80045b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800460:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800463:	cc                   	int3
+  800464:	eb fd                	jmp    800463 <_panic+0xa0>
+
+0000000000800466 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800466:	55                   	push   %rbp
+  800467:	48 89 e5             	mov    %rsp,%rbp
+  80046a:	53                   	push   %rbx
+  80046b:	48 83 ec 08          	sub    $0x8,%rsp
+  80046f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800472:	8b 06                	mov    (%rsi),%eax
+  800474:	8d 50 01             	lea    0x1(%rax),%edx
+  800477:	89 16                	mov    %edx,(%rsi)
+  800479:	48 98                	cltq
+  80047b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800480:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800486:	74 0a                	je     800492 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800488:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80048c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800490:	c9                   	leave
+  800491:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800492:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800496:	be ff 00 00 00       	mov    $0xff,%esi
+  80049b:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  8004a2:	00 00 00 
+  8004a5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004a7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004ad:	eb d9                	jmp    800488 <putch+0x22>
+
+00000000008004af <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004af:	55                   	push   %rbp
+  8004b0:	48 89 e5             	mov    %rsp,%rbp
+  8004b3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004ba:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004bd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004c4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004d1:	48 89 f1             	mov    %rsi,%rcx
+  8004d4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004db:	48 bf 66 04 80 00 00 	movabs $0x800466,%rdi
+  8004e2:	00 00 00 
+  8004e5:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004f1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004f8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004ff:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  800506:	00 00 00 
+  800509:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80050b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800511:	c9                   	leave
+  800512:	c3                   	ret
+
+0000000000800513 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800513:	55                   	push   %rbp
+  800514:	48 89 e5             	mov    %rsp,%rbp
+  800517:	48 83 ec 50          	sub    $0x50,%rsp
+  80051b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80051f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800523:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800527:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80052f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800536:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800542:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800546:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80054a:	48 b8 af 04 80 00 00 	movabs $0x8004af,%rax
+  800551:	00 00 00 
+  800554:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800556:	c9                   	leave
+  800557:	c3                   	ret
+
+0000000000800558 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800558:	55                   	push   %rbp
+  800559:	48 89 e5             	mov    %rsp,%rbp
+  80055c:	41 57                	push   %r15
+  80055e:	41 56                	push   %r14
+  800560:	41 55                	push   %r13
+  800562:	41 54                	push   %r12
+  800564:	53                   	push   %rbx
+  800565:	48 83 ec 18          	sub    $0x18,%rsp
+  800569:	49 89 fc             	mov    %rdi,%r12
+  80056c:	49 89 f5             	mov    %rsi,%r13
+  80056f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800573:	8b 45 10             	mov    0x10(%rbp),%eax
+  800576:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800579:	41 89 cf             	mov    %ecx,%r15d
+  80057c:	4c 39 fa             	cmp    %r15,%rdx
+  80057f:	73 5b                	jae    8005dc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800581:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800585:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800589:	85 db                	test   %ebx,%ebx
+  80058b:	7e 0e                	jle    80059b <print_num+0x43>
+            putch(padc, put_arg);
+  80058d:	4c 89 ee             	mov    %r13,%rsi
+  800590:	44 89 f7             	mov    %r14d,%edi
+  800593:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800596:	83 eb 01             	sub    $0x1,%ebx
+  800599:	75 f2                	jne    80058d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80059b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80059f:	48 b9 94 3c 80 00 00 	movabs $0x803c94,%rcx
+  8005a6:	00 00 00 
+  8005a9:	48 b8 83 3c 80 00 00 	movabs $0x803c83,%rax
+  8005b0:	00 00 00 
+  8005b3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c0:	49 f7 f7             	div    %r15
+  8005c3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005c7:	4c 89 ee             	mov    %r13,%rsi
+  8005ca:	41 ff d4             	call   *%r12
+}
+  8005cd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005d1:	5b                   	pop    %rbx
+  8005d2:	41 5c                	pop    %r12
+  8005d4:	41 5d                	pop    %r13
+  8005d6:	41 5e                	pop    %r14
+  8005d8:	41 5f                	pop    %r15
+  8005da:	5d                   	pop    %rbp
+  8005db:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e5:	49 f7 f7             	div    %r15
+  8005e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ec:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005f0:	52                   	push   %rdx
+  8005f1:	45 0f be c9          	movsbl %r9b,%r9d
+  8005f5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005f9:	48 89 c2             	mov    %rax,%rdx
+  8005fc:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	48 83 c4 10          	add    $0x10,%rsp
+  80060c:	eb 8d                	jmp    80059b <print_num+0x43>
+
+000000000080060e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80060e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800612:	48 8b 06             	mov    (%rsi),%rax
+  800615:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800619:	73 0a                	jae    800625 <sprintputch+0x17>
+        *state->start++ = ch;
+  80061b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80061f:	48 89 16             	mov    %rdx,(%rsi)
+  800622:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800625:	c3                   	ret
+
+0000000000800626 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800626:	55                   	push   %rbp
+  800627:	48 89 e5             	mov    %rsp,%rbp
+  80062a:	48 83 ec 50          	sub    $0x50,%rsp
+  80062e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800632:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800636:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80063a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800641:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800645:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800649:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80064d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800651:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800655:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  80065c:	00 00 00 
+  80065f:	ff d0                	call   *%rax
+}
+  800661:	c9                   	leave
+  800662:	c3                   	ret
+
+0000000000800663 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800663:	55                   	push   %rbp
+  800664:	48 89 e5             	mov    %rsp,%rbp
+  800667:	41 57                	push   %r15
+  800669:	41 56                	push   %r14
+  80066b:	41 55                	push   %r13
+  80066d:	41 54                	push   %r12
+  80066f:	53                   	push   %rbx
+  800670:	48 83 ec 38          	sub    $0x38,%rsp
+  800674:	49 89 fe             	mov    %rdi,%r14
+  800677:	49 89 f5             	mov    %rsi,%r13
+  80067a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80067d:	48 8b 01             	mov    (%rcx),%rax
+  800680:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800684:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800688:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800690:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800694:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800698:	0f b6 3b             	movzbl (%rbx),%edi
+  80069b:	40 80 ff 25          	cmp    $0x25,%dil
+  80069f:	74 18                	je     8006b9 <vprintfmt+0x56>
+            if (!ch) return;
+  8006a1:	40 84 ff             	test   %dil,%dil
+  8006a4:	0f 84 b1 06 00 00    	je     800d5b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006aa:	40 0f b6 ff          	movzbl %dil,%edi
+  8006ae:	4c 89 ee             	mov    %r13,%rsi
+  8006b1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006b4:	4c 89 e3             	mov    %r12,%rbx
+  8006b7:	eb db                	jmp    800694 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006be:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006c2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006c7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006cd:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006d4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006dd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006e2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006e5:	83 e8 23             	sub    $0x23,%eax
+  8006e8:	3c 57                	cmp    $0x57,%al
+  8006ea:	0f 87 51 06 00 00    	ja     800d41 <vprintfmt+0x6de>
+  8006f0:	0f b6 c0             	movzbl %al,%eax
+  8006f3:	48 b9 20 3e 80 00 00 	movabs $0x803e20,%rcx
+  8006fa:	00 00 00 
+  8006fd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800700:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800703:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800707:	eb cf                	jmp    8006d8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800709:	49 89 dc             	mov    %rbx,%r12
+  80070c:	be 01 00 00 00       	mov    $0x1,%esi
+  800711:	eb c5                	jmp    8006d8 <vprintfmt+0x75>
+            padc = ch;
+  800713:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800717:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80071a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80071d:	eb b9                	jmp    8006d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80071f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800722:	83 f8 2f             	cmp    $0x2f,%eax
+  800725:	77 24                	ja     80074b <vprintfmt+0xe8>
+  800727:	89 c1                	mov    %eax,%ecx
+  800729:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80072d:	83 c0 08             	add    $0x8,%eax
+  800730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800733:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800736:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800739:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80073d:	79 99                	jns    8006d8 <vprintfmt+0x75>
+                width = precision;
+  80073f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800743:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800749:	eb 8d                	jmp    8006d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80074b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80074f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800753:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800757:	eb da                	jmp    800733 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800759:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80075e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800762:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800768:	3c 39                	cmp    $0x39,%al
+  80076a:	77 1c                	ja     800788 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80076c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800770:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800774:	0f b6 c0             	movzbl %al,%eax
+  800777:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80077c:	0f b6 03             	movzbl (%rbx),%eax
+  80077f:	3c 39                	cmp    $0x39,%al
+  800781:	76 e9                	jbe    80076c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800786:	eb b1                	jmp    800739 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800788:	49 89 dc             	mov    %rbx,%r12
+  80078b:	eb ac                	jmp    800739 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80078d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800790:	85 c9                	test   %ecx,%ecx
+  800792:	b8 00 00 00 00       	mov    $0x0,%eax
+  800797:	0f 49 c1             	cmovns %ecx,%eax
+  80079a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80079d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a0:	e9 33 ff ff ff       	jmp    8006d8 <vprintfmt+0x75>
+            lflag++;
+  8007a5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ab:	e9 28 ff ff ff       	jmp    8006d8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 19                	ja     8007d1 <vprintfmt+0x16e>
+  8007b8:	89 c2                	mov    %eax,%edx
+  8007ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007be:	83 c0 08             	add    $0x8,%eax
+  8007c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c4:	8b 3a                	mov    (%rdx),%edi
+  8007c6:	4c 89 ee             	mov    %r13,%rsi
+  8007c9:	41 ff d6             	call   *%r14
+            break;
+  8007cc:	e9 c3 fe ff ff       	jmp    800694 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dd:	eb e5                	jmp    8007c4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e5:	77 5a                	ja     800841 <vprintfmt+0x1de>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007f3:	8b 02                	mov    (%rdx),%eax
+  8007f5:	89 c1                	mov    %eax,%ecx
+  8007f7:	f7 d9                	neg    %ecx
+  8007f9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007fc:	83 f9 14             	cmp    $0x14,%ecx
+  8007ff:	7f 4e                	jg     80084f <vprintfmt+0x1ec>
+  800801:	48 63 c1             	movslq %ecx,%rax
+  800804:	48 ba e0 40 80 00 00 	movabs $0x8040e0,%rdx
+  80080b:	00 00 00 
+  80080e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800812:	48 85 c0             	test   %rax,%rax
+  800815:	74 38                	je     80084f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800817:	48 89 c1             	mov    %rax,%rcx
+  80081a:	48 ba d9 42 80 00 00 	movabs $0x8042d9,%rdx
+  800821:	00 00 00 
+  800824:	4c 89 ee             	mov    %r13,%rsi
+  800827:	4c 89 f7             	mov    %r14,%rdi
+  80082a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082f:	49 b8 26 06 80 00 00 	movabs $0x800626,%r8
+  800836:	00 00 00 
+  800839:	41 ff d0             	call   *%r8
+  80083c:	e9 53 fe ff ff       	jmp    800694 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb a4                	jmp    8007f3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80084f:	48 ba ac 3c 80 00 00 	movabs $0x803cac,%rdx
+  800856:	00 00 00 
+  800859:	4c 89 ee             	mov    %r13,%rsi
+  80085c:	4c 89 f7             	mov    %r14,%rdi
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	49 b8 26 06 80 00 00 	movabs $0x800626,%r8
+  80086b:	00 00 00 
+  80086e:	41 ff d0             	call   *%r8
+  800871:	e9 1e fe ff ff       	jmp    800694 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 6c                	ja     8008ea <vprintfmt+0x287>
+  80087e:	89 c2                	mov    %eax,%edx
+  800880:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800884:	83 c0 08             	add    $0x8,%eax
+  800887:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80088d:	48 85 d2             	test   %rdx,%rdx
+  800890:	48 b8 a5 3c 80 00 00 	movabs $0x803ca5,%rax
+  800897:	00 00 00 
+  80089a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80089e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008a6:	7e 06                	jle    8008ae <vprintfmt+0x24b>
+  8008a8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008ac:	75 4a                	jne    8008f8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008b2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008b6:	0f b6 00             	movzbl (%rax),%eax
+  8008b9:	84 c0                	test   %al,%al
+  8008bb:	0f 85 9a 00 00 00    	jne    80095b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008c4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008c8:	85 c0                	test   %eax,%eax
+  8008ca:	0f 8e c4 fd ff ff    	jle    800694 <vprintfmt+0x31>
+  8008d0:	4c 89 ee             	mov    %r13,%rsi
+  8008d3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d8:	41 ff d6             	call   *%r14
+  8008db:	41 83 ec 01          	sub    $0x1,%r12d
+  8008df:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008e3:	75 eb                	jne    8008d0 <vprintfmt+0x26d>
+  8008e5:	e9 aa fd ff ff       	jmp    800694 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f6:	eb 92                	jmp    80088a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008f8:	49 63 f7             	movslq %r15d,%rsi
+  8008fb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008ff:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  800906:	00 00 00 
+  800909:	ff d0                	call   *%rax
+  80090b:	48 89 c2             	mov    %rax,%rdx
+  80090e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800911:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800913:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800916:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800919:	85 c0                	test   %eax,%eax
+  80091b:	7e 91                	jle    8008ae <vprintfmt+0x24b>
+  80091d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800922:	4c 89 ee             	mov    %r13,%rsi
+  800925:	44 89 e7             	mov    %r12d,%edi
+  800928:	41 ff d6             	call   *%r14
+  80092b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80092f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800932:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800935:	75 eb                	jne    800922 <vprintfmt+0x2bf>
+  800937:	e9 72 ff ff ff       	jmp    8008ae <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80093c:	0f b6 f8             	movzbl %al,%edi
+  80093f:	4c 89 ee             	mov    %r13,%rsi
+  800942:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800945:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800949:	49 83 c4 01          	add    $0x1,%r12
+  80094d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800953:	84 c0                	test   %al,%al
+  800955:	0f 84 66 ff ff ff    	je     8008c1 <vprintfmt+0x25e>
+  80095b:	45 85 ff             	test   %r15d,%r15d
+  80095e:	78 0a                	js     80096a <vprintfmt+0x307>
+  800960:	41 83 ef 01          	sub    $0x1,%r15d
+  800964:	0f 88 57 ff ff ff    	js     8008c1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80096a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80096e:	74 cc                	je     80093c <vprintfmt+0x2d9>
+  800970:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800973:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800978:	80 fa 5e             	cmp    $0x5e,%dl
+  80097b:	77 c2                	ja     80093f <vprintfmt+0x2dc>
+  80097d:	eb bd                	jmp    80093c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80097f:	40 84 f6             	test   %sil,%sil
+  800982:	75 26                	jne    8009aa <vprintfmt+0x347>
+    switch (lflag) {
+  800984:	85 d2                	test   %edx,%edx
+  800986:	74 59                	je     8009e1 <vprintfmt+0x37e>
+  800988:	83 fa 01             	cmp    $0x1,%edx
+  80098b:	74 7b                	je     800a08 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	0f 87 96 00 00 00    	ja     800a2f <vprintfmt+0x3cc>
+  800999:	89 c2                	mov    %eax,%edx
+  80099b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099f:	83 c0 08             	add    $0x8,%eax
+  8009a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a5:	4c 8b 22             	mov    (%rdx),%r12
+  8009a8:	eb 17                	jmp    8009c1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	77 21                	ja     8009d3 <vprintfmt+0x370>
+  8009b2:	89 c2                	mov    %eax,%edx
+  8009b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b8:	83 c0 08             	add    $0x8,%eax
+  8009bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009be:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009c1:	4d 85 e4             	test   %r12,%r12
+  8009c4:	78 7a                	js     800a40 <vprintfmt+0x3dd>
+            num = i;
+  8009c6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009ce:	e9 50 02 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb dd                	jmp    8009be <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 11                	ja     8009fa <vprintfmt+0x397>
+  8009e9:	89 c2                	mov    %eax,%edx
+  8009eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	4c 63 22             	movslq (%rdx),%r12
+  8009f8:	eb c7                	jmp    8009c1 <vprintfmt+0x35e>
+  8009fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a06:	eb ed                	jmp    8009f5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 11                	ja     800a21 <vprintfmt+0x3be>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	4c 8b 22             	mov    (%rdx),%r12
+  800a1f:	eb a0                	jmp    8009c1 <vprintfmt+0x35e>
+  800a21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2d:	eb ed                	jmp    800a1c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	e9 65 ff ff ff       	jmp    8009a5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a40:	4c 89 ee             	mov    %r13,%rsi
+  800a43:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a48:	41 ff d6             	call   *%r14
+                i = -i;
+  800a4b:	49 f7 dc             	neg    %r12
+  800a4e:	e9 73 ff ff ff       	jmp    8009c6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a53:	40 84 f6             	test   %sil,%sil
+  800a56:	75 32                	jne    800a8a <vprintfmt+0x427>
+    switch (lflag) {
+  800a58:	85 d2                	test   %edx,%edx
+  800a5a:	74 5d                	je     800ab9 <vprintfmt+0x456>
+  800a5c:	83 fa 01             	cmp    $0x1,%edx
+  800a5f:	0f 84 82 00 00 00    	je     800ae7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	0f 87 a5 00 00 00    	ja     800b16 <vprintfmt+0x4b3>
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a77:	83 c0 08             	add    $0x8,%eax
+  800a7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a80:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a85:	e9 99 01 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	77 19                	ja     800aab <vprintfmt+0x448>
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a98:	83 c0 08             	add    $0x8,%eax
+  800a9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aa1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aa6:	e9 78 01 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+  800aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab7:	eb e5                	jmp    800a9e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ab9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abc:	83 f8 2f             	cmp    $0x2f,%eax
+  800abf:	77 18                	ja     800ad9 <vprintfmt+0x476>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800acf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad4:	e9 4a 01 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+  800ad9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800add:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae5:	eb e6                	jmp    800acd <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ae7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aea:	83 f8 2f             	cmp    $0x2f,%eax
+  800aed:	77 19                	ja     800b08 <vprintfmt+0x4a5>
+  800aef:	89 c2                	mov    %eax,%edx
+  800af1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af5:	83 c0 08             	add    $0x8,%eax
+  800af8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800afe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b03:	e9 1b 01 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+  800b08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b14:	eb e5                	jmp    800afb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b22:	e9 56 ff ff ff       	jmp    800a7d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b27:	40 84 f6             	test   %sil,%sil
+  800b2a:	75 2e                	jne    800b5a <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b2c:	85 d2                	test   %edx,%edx
+  800b2e:	74 59                	je     800b89 <vprintfmt+0x526>
+  800b30:	83 fa 01             	cmp    $0x1,%edx
+  800b33:	74 7f                	je     800bb4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b38:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3b:	0f 87 9f 00 00 00    	ja     800be0 <vprintfmt+0x57d>
+  800b41:	89 c2                	mov    %eax,%edx
+  800b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b47:	83 c0 08             	add    $0x8,%eax
+  800b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b50:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b55:	e9 c9 00 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b60:	77 19                	ja     800b7b <vprintfmt+0x518>
+  800b62:	89 c2                	mov    %eax,%edx
+  800b64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b68:	83 c0 08             	add    $0x8,%eax
+  800b6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b71:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b76:	e9 a8 00 00 00       	jmp    800c23 <vprintfmt+0x5c0>
+  800b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b87:	eb e5                	jmp    800b6e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 15                	ja     800ba6 <vprintfmt+0x543>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b9f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ba4:	eb 7d                	jmp    800c23 <vprintfmt+0x5c0>
+  800ba6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb2:	eb e9                	jmp    800b9d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bb4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bba:	77 16                	ja     800bd2 <vprintfmt+0x56f>
+  800bbc:	89 c2                	mov    %eax,%edx
+  800bbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc2:	83 c0 08             	add    $0x8,%eax
+  800bc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bcb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bd0:	eb 51                	jmp    800c23 <vprintfmt+0x5c0>
+  800bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bde:	eb e8                	jmp    800bc8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bec:	e9 5c ff ff ff       	jmp    800b4d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bf1:	4c 89 ee             	mov    %r13,%rsi
+  800bf4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bf9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bfc:	4c 89 ee             	mov    %r13,%rsi
+  800bff:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c04:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0d:	77 47                	ja     800c56 <vprintfmt+0x5f3>
+  800c0f:	89 c2                	mov    %eax,%edx
+  800c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c15:	83 c0 08             	add    $0x8,%eax
+  800c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c23:	48 83 ec 08          	sub    $0x8,%rsp
+  800c27:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c2b:	0f 94 c0             	sete   %al
+  800c2e:	0f b6 c0             	movzbl %al,%eax
+  800c31:	50                   	push   %rax
+  800c32:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c37:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c3b:	4c 89 ee             	mov    %r13,%rsi
+  800c3e:	4c 89 f7             	mov    %r14,%rdi
+  800c41:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800c48:	00 00 00 
+  800c4b:	ff d0                	call   *%rax
+            break;
+  800c4d:	48 83 c4 10          	add    $0x10,%rsp
+  800c51:	e9 3e fa ff ff       	jmp    800694 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c62:	eb b7                	jmp    800c1b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c64:	40 84 f6             	test   %sil,%sil
+  800c67:	75 2b                	jne    800c94 <vprintfmt+0x631>
+    switch (lflag) {
+  800c69:	85 d2                	test   %edx,%edx
+  800c6b:	74 56                	je     800cc3 <vprintfmt+0x660>
+  800c6d:	83 fa 01             	cmp    $0x1,%edx
+  800c70:	74 7f                	je     800cf1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c75:	83 f8 2f             	cmp    $0x2f,%eax
+  800c78:	0f 87 a2 00 00 00    	ja     800d20 <vprintfmt+0x6bd>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c92:	eb 8f                	jmp    800c23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c97:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9a:	77 19                	ja     800cb5 <vprintfmt+0x652>
+  800c9c:	89 c2                	mov    %eax,%edx
+  800c9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca2:	83 c0 08             	add    $0x8,%eax
+  800ca5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cab:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cb0:	e9 6e ff ff ff       	jmp    800c23 <vprintfmt+0x5c0>
+  800cb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc1:	eb e5                	jmp    800ca8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc9:	77 18                	ja     800ce3 <vprintfmt+0x680>
+  800ccb:	89 c2                	mov    %eax,%edx
+  800ccd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd1:	83 c0 08             	add    $0x8,%eax
+  800cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cde:	e9 40 ff ff ff       	jmp    800c23 <vprintfmt+0x5c0>
+  800ce3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ceb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cef:	eb e6                	jmp    800cd7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf7:	77 19                	ja     800d12 <vprintfmt+0x6af>
+  800cf9:	89 c2                	mov    %eax,%edx
+  800cfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cff:	83 c0 08             	add    $0x8,%eax
+  800d02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d08:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d0d:	e9 11 ff ff ff       	jmp    800c23 <vprintfmt+0x5c0>
+  800d12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1e:	eb e5                	jmp    800d05 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2c:	e9 59 ff ff ff       	jmp    800c8a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d31:	4c 89 ee             	mov    %r13,%rsi
+  800d34:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d39:	41 ff d6             	call   *%r14
+            break;
+  800d3c:	e9 53 f9 ff ff       	jmp    800694 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d41:	4c 89 ee             	mov    %r13,%rsi
+  800d44:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d49:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d4c:	48 83 eb 01          	sub    $0x1,%rbx
+  800d50:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d54:	75 f6                	jne    800d4c <vprintfmt+0x6e9>
+  800d56:	e9 39 f9 ff ff       	jmp    800694 <vprintfmt+0x31>
+}
+  800d5b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d5f:	5b                   	pop    %rbx
+  800d60:	41 5c                	pop    %r12
+  800d62:	41 5d                	pop    %r13
+  800d64:	41 5e                	pop    %r14
+  800d66:	41 5f                	pop    %r15
+  800d68:	5d                   	pop    %rbp
+  800d69:	c3                   	ret
+
+0000000000800d6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d6a:	55                   	push   %rbp
+  800d6b:	48 89 e5             	mov    %rsp,%rbp
+  800d6e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d76:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d7b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d86:	48 85 ff             	test   %rdi,%rdi
+  800d89:	74 2b                	je     800db6 <vsnprintf+0x4c>
+  800d8b:	48 85 f6             	test   %rsi,%rsi
+  800d8e:	74 26                	je     800db6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d94:	48 bf 0e 06 80 00 00 	movabs $0x80060e,%rdi
+  800d9b:	00 00 00 
+  800d9e:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800daa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dae:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800db1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800db4:	c9                   	leave
+  800db5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800db6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dbb:	eb f7                	jmp    800db4 <vsnprintf+0x4a>
+
+0000000000800dbd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dbd:	55                   	push   %rbp
+  800dbe:	48 89 e5             	mov    %rsp,%rbp
+  800dc1:	48 83 ec 50          	sub    $0x50,%rsp
+  800dc5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dc9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dcd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dd1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dd8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ddc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800de4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800de8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dec:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800df8:	c9                   	leave
+  800df9:	c3                   	ret
+
+0000000000800dfa <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dfa:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dfd:	74 10                	je     800e0f <strlen+0x15>
+    size_t n = 0;
+  800dff:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e04:	48 83 c0 01          	add    $0x1,%rax
+  800e08:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e0c:	75 f6                	jne    800e04 <strlen+0xa>
+  800e0e:	c3                   	ret
+    size_t n = 0;
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e15:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e1d:	48 85 f6             	test   %rsi,%rsi
+  800e20:	74 11                	je     800e33 <strnlen+0x1e>
+  800e22:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e26:	74 0c                	je     800e34 <strnlen+0x1f>
+  800e28:	48 83 c2 01          	add    $0x1,%rdx
+  800e2c:	48 39 d0             	cmp    %rdx,%rax
+  800e2f:	75 f1                	jne    800e22 <strnlen+0xd>
+  800e31:	eb 04                	jmp    800e37 <strnlen+0x22>
+  800e33:	c3                   	ret
+  800e34:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e37:	c3                   	ret
+
+0000000000800e38 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e38:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e40:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e44:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e47:	48 83 c2 01          	add    $0x1,%rdx
+  800e4b:	84 c9                	test   %cl,%cl
+  800e4d:	75 f1                	jne    800e40 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e4f:	c3                   	ret
+
+0000000000800e50 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e50:	55                   	push   %rbp
+  800e51:	48 89 e5             	mov    %rsp,%rbp
+  800e54:	41 54                	push   %r12
+  800e56:	53                   	push   %rbx
+  800e57:	48 89 fb             	mov    %rdi,%rbx
+  800e5a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e5d:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  800e64:	00 00 00 
+  800e67:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e69:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e6d:	4c 89 e6             	mov    %r12,%rsi
+  800e70:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  800e77:	00 00 00 
+  800e7a:	ff d0                	call   *%rax
+    return dst;
+}
+  800e7c:	48 89 d8             	mov    %rbx,%rax
+  800e7f:	5b                   	pop    %rbx
+  800e80:	41 5c                	pop    %r12
+  800e82:	5d                   	pop    %rbp
+  800e83:	c3                   	ret
+
+0000000000800e84 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e84:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e87:	48 85 d2             	test   %rdx,%rdx
+  800e8a:	74 1f                	je     800eab <strncpy+0x27>
+  800e8c:	48 01 fa             	add    %rdi,%rdx
+  800e8f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e92:	48 83 c1 01          	add    $0x1,%rcx
+  800e96:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e9a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e9e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ea2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ea6:	48 39 ca             	cmp    %rcx,%rdx
+  800ea9:	75 e7                	jne    800e92 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eab:	c3                   	ret
+
+0000000000800eac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eac:	48 89 f8             	mov    %rdi,%rax
+  800eaf:	48 85 d2             	test   %rdx,%rdx
+  800eb2:	74 24                	je     800ed8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eb4:	48 83 ea 01          	sub    $0x1,%rdx
+  800eb8:	74 1b                	je     800ed5 <strlcpy+0x29>
+  800eba:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ebe:	0f b6 16             	movzbl (%rsi),%edx
+  800ec1:	84 d2                	test   %dl,%dl
+  800ec3:	74 10                	je     800ed5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ec5:	48 83 c6 01          	add    $0x1,%rsi
+  800ec9:	48 83 c0 01          	add    $0x1,%rax
+  800ecd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ed0:	48 39 c8             	cmp    %rcx,%rax
+  800ed3:	75 e9                	jne    800ebe <strlcpy+0x12>
+        *dst = '\0';
+  800ed5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ed8:	48 29 f8             	sub    %rdi,%rax
+}
+  800edb:	c3                   	ret
+
+0000000000800edc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800edc:	0f b6 07             	movzbl (%rdi),%eax
+  800edf:	84 c0                	test   %al,%al
+  800ee1:	74 13                	je     800ef6 <strcmp+0x1a>
+  800ee3:	38 06                	cmp    %al,(%rsi)
+  800ee5:	75 0f                	jne    800ef6 <strcmp+0x1a>
+  800ee7:	48 83 c7 01          	add    $0x1,%rdi
+  800eeb:	48 83 c6 01          	add    $0x1,%rsi
+  800eef:	0f b6 07             	movzbl (%rdi),%eax
+  800ef2:	84 c0                	test   %al,%al
+  800ef4:	75 ed                	jne    800ee3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ef6:	0f b6 c0             	movzbl %al,%eax
+  800ef9:	0f b6 16             	movzbl (%rsi),%edx
+  800efc:	29 d0                	sub    %edx,%eax
+}
+  800efe:	c3                   	ret
+
+0000000000800eff <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800eff:	48 85 d2             	test   %rdx,%rdx
+  800f02:	74 1f                	je     800f23 <strncmp+0x24>
+  800f04:	0f b6 07             	movzbl (%rdi),%eax
+  800f07:	84 c0                	test   %al,%al
+  800f09:	74 1e                	je     800f29 <strncmp+0x2a>
+  800f0b:	3a 06                	cmp    (%rsi),%al
+  800f0d:	75 1a                	jne    800f29 <strncmp+0x2a>
+  800f0f:	48 83 c7 01          	add    $0x1,%rdi
+  800f13:	48 83 c6 01          	add    $0x1,%rsi
+  800f17:	48 83 ea 01          	sub    $0x1,%rdx
+  800f1b:	75 e7                	jne    800f04 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f22:	c3                   	ret
+  800f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f28:	c3                   	ret
+  800f29:	48 85 d2             	test   %rdx,%rdx
+  800f2c:	74 09                	je     800f37 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f2e:	0f b6 07             	movzbl (%rdi),%eax
+  800f31:	0f b6 16             	movzbl (%rsi),%edx
+  800f34:	29 d0                	sub    %edx,%eax
+  800f36:	c3                   	ret
+    if (!n) return 0;
+  800f37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f3c:	c3                   	ret
+
+0000000000800f3d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f3d:	0f b6 17             	movzbl (%rdi),%edx
+  800f40:	84 d2                	test   %dl,%dl
+  800f42:	74 18                	je     800f5c <strchr+0x1f>
+        if (*str == c) {
+  800f44:	0f be d2             	movsbl %dl,%edx
+  800f47:	39 f2                	cmp    %esi,%edx
+  800f49:	74 17                	je     800f62 <strchr+0x25>
+    for (; *str; str++) {
+  800f4b:	48 83 c7 01          	add    $0x1,%rdi
+  800f4f:	0f b6 17             	movzbl (%rdi),%edx
+  800f52:	84 d2                	test   %dl,%dl
+  800f54:	75 ee                	jne    800f44 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5b:	c3                   	ret
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f61:	c3                   	ret
+  800f62:	48 89 f8             	mov    %rdi,%rax
+}
+  800f65:	c3                   	ret
+
+0000000000800f66 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f66:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f69:	0f b6 17             	movzbl (%rdi),%edx
+  800f6c:	84 d2                	test   %dl,%dl
+  800f6e:	74 13                	je     800f83 <strfind+0x1d>
+  800f70:	0f be d2             	movsbl %dl,%edx
+  800f73:	39 f2                	cmp    %esi,%edx
+  800f75:	74 0b                	je     800f82 <strfind+0x1c>
+  800f77:	48 83 c0 01          	add    $0x1,%rax
+  800f7b:	0f b6 10             	movzbl (%rax),%edx
+  800f7e:	84 d2                	test   %dl,%dl
+  800f80:	75 ee                	jne    800f70 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f82:	c3                   	ret
+  800f83:	c3                   	ret
+
+0000000000800f84 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f84:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f87:	48 89 f8             	mov    %rdi,%rax
+  800f8a:	48 f7 d8             	neg    %rax
+  800f8d:	83 e0 07             	and    $0x7,%eax
+  800f90:	49 89 d1             	mov    %rdx,%r9
+  800f93:	49 29 c1             	sub    %rax,%r9
+  800f96:	78 36                	js     800fce <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f98:	40 0f b6 c6          	movzbl %sil,%eax
+  800f9c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fa3:	01 01 01 
+  800fa6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800faa:	40 f6 c7 07          	test   $0x7,%dil
+  800fae:	75 38                	jne    800fe8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fb0:	4c 89 c9             	mov    %r9,%rcx
+  800fb3:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fb7:	74 0c                	je     800fc5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fb9:	fc                   	cld
+  800fba:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fbd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fc1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fc5:	4d 85 c9             	test   %r9,%r9
+  800fc8:	75 45                	jne    80100f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fca:	4c 89 c0             	mov    %r8,%rax
+  800fcd:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fce:	48 85 d2             	test   %rdx,%rdx
+  800fd1:	74 f7                	je     800fca <memset+0x46>
+  800fd3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fd6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fd9:	48 83 c0 01          	add    $0x1,%rax
+  800fdd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fe1:	48 39 c2             	cmp    %rax,%rdx
+  800fe4:	75 f3                	jne    800fd9 <memset+0x55>
+  800fe6:	eb e2                	jmp    800fca <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fe8:	40 f6 c7 01          	test   $0x1,%dil
+  800fec:	74 06                	je     800ff4 <memset+0x70>
+  800fee:	88 07                	mov    %al,(%rdi)
+  800ff0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff4:	40 f6 c7 02          	test   $0x2,%dil
+  800ff8:	74 07                	je     801001 <memset+0x7d>
+  800ffa:	66 89 07             	mov    %ax,(%rdi)
+  800ffd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801001:	40 f6 c7 04          	test   $0x4,%dil
+  801005:	74 a9                	je     800fb0 <memset+0x2c>
+  801007:	89 07                	mov    %eax,(%rdi)
+  801009:	48 83 c7 04          	add    $0x4,%rdi
+  80100d:	eb a1                	jmp    800fb0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80100f:	41 f6 c1 04          	test   $0x4,%r9b
+  801013:	74 06                	je     80101b <memset+0x97>
+  801015:	89 07                	mov    %eax,(%rdi)
+  801017:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80101b:	41 f6 c1 02          	test   $0x2,%r9b
+  80101f:	74 07                	je     801028 <memset+0xa4>
+  801021:	66 89 07             	mov    %ax,(%rdi)
+  801024:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801028:	41 f6 c1 01          	test   $0x1,%r9b
+  80102c:	74 9c                	je     800fca <memset+0x46>
+  80102e:	88 07                	mov    %al,(%rdi)
+  801030:	eb 98                	jmp    800fca <memset+0x46>
+
+0000000000801032 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801032:	48 89 f8             	mov    %rdi,%rax
+  801035:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801038:	48 39 fe             	cmp    %rdi,%rsi
+  80103b:	73 3b                	jae    801078 <memmove+0x46>
+  80103d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801041:	48 39 d7             	cmp    %rdx,%rdi
+  801044:	73 32                	jae    801078 <memmove+0x46>
+        s += n;
+        d += n;
+  801046:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80104a:	48 89 d6             	mov    %rdx,%rsi
+  80104d:	48 09 fe             	or     %rdi,%rsi
+  801050:	48 09 ce             	or     %rcx,%rsi
+  801053:	40 f6 c6 07          	test   $0x7,%sil
+  801057:	75 12                	jne    80106b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801059:	48 83 ef 08          	sub    $0x8,%rdi
+  80105d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801061:	48 c1 e9 03          	shr    $0x3,%rcx
+  801065:	fd                   	std
+  801066:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801069:	fc                   	cld
+  80106a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80106b:	48 83 ef 01          	sub    $0x1,%rdi
+  80106f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801073:	fd                   	std
+  801074:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801076:	eb f1                	jmp    801069 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801078:	48 89 f2             	mov    %rsi,%rdx
+  80107b:	48 09 c2             	or     %rax,%rdx
+  80107e:	48 09 ca             	or     %rcx,%rdx
+  801081:	f6 c2 07             	test   $0x7,%dl
+  801084:	75 0c                	jne    801092 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801086:	48 c1 e9 03          	shr    $0x3,%rcx
+  80108a:	48 89 c7             	mov    %rax,%rdi
+  80108d:	fc                   	cld
+  80108e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801091:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801092:	48 89 c7             	mov    %rax,%rdi
+  801095:	fc                   	cld
+  801096:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801098:	c3                   	ret
+
+0000000000801099 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801099:	55                   	push   %rbp
+  80109a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80109d:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  8010a4:	00 00 00 
+  8010a7:	ff d0                	call   *%rax
+}
+  8010a9:	5d                   	pop    %rbp
+  8010aa:	c3                   	ret
+
+00000000008010ab <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010ab:	55                   	push   %rbp
+  8010ac:	48 89 e5             	mov    %rsp,%rbp
+  8010af:	41 57                	push   %r15
+  8010b1:	41 56                	push   %r14
+  8010b3:	41 55                	push   %r13
+  8010b5:	41 54                	push   %r12
+  8010b7:	53                   	push   %rbx
+  8010b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8010bc:	49 89 fe             	mov    %rdi,%r14
+  8010bf:	49 89 f7             	mov    %rsi,%r15
+  8010c2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010c5:	48 89 f7             	mov    %rsi,%rdi
+  8010c8:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  8010cf:	00 00 00 
+  8010d2:	ff d0                	call   *%rax
+  8010d4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010d7:	48 89 de             	mov    %rbx,%rsi
+  8010da:	4c 89 f7             	mov    %r14,%rdi
+  8010dd:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  8010e4:	00 00 00 
+  8010e7:	ff d0                	call   *%rax
+  8010e9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010ec:	48 39 c3             	cmp    %rax,%rbx
+  8010ef:	74 36                	je     801127 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010f1:	48 89 d8             	mov    %rbx,%rax
+  8010f4:	4c 29 e8             	sub    %r13,%rax
+  8010f7:	49 39 c4             	cmp    %rax,%r12
+  8010fa:	73 31                	jae    80112d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010fc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801101:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801105:	4c 89 fe             	mov    %r15,%rsi
+  801108:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  80110f:	00 00 00 
+  801112:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801114:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801118:	48 83 c4 08          	add    $0x8,%rsp
+  80111c:	5b                   	pop    %rbx
+  80111d:	41 5c                	pop    %r12
+  80111f:	41 5d                	pop    %r13
+  801121:	41 5e                	pop    %r14
+  801123:	41 5f                	pop    %r15
+  801125:	5d                   	pop    %rbp
+  801126:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801127:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80112b:	eb eb                	jmp    801118 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80112d:	48 83 eb 01          	sub    $0x1,%rbx
+  801131:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801135:	48 89 da             	mov    %rbx,%rdx
+  801138:	4c 89 fe             	mov    %r15,%rsi
+  80113b:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  801142:	00 00 00 
+  801145:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801147:	49 01 de             	add    %rbx,%r14
+  80114a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80114f:	eb c3                	jmp    801114 <strlcat+0x69>
+
+0000000000801151 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801151:	48 85 d2             	test   %rdx,%rdx
+  801154:	74 2d                	je     801183 <memcmp+0x32>
+  801156:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80115b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80115f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801164:	44 38 c1             	cmp    %r8b,%cl
+  801167:	75 0f                	jne    801178 <memcmp+0x27>
+    while (n-- > 0) {
+  801169:	48 83 c0 01          	add    $0x1,%rax
+  80116d:	48 39 c2             	cmp    %rax,%rdx
+  801170:	75 e9                	jne    80115b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801172:	b8 00 00 00 00       	mov    $0x0,%eax
+  801177:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801178:	0f b6 c1             	movzbl %cl,%eax
+  80117b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80117f:	44 29 c0             	sub    %r8d,%eax
+  801182:	c3                   	ret
+    return 0;
+  801183:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801188:	c3                   	ret
+
+0000000000801189 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801189:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80118d:	48 39 c7             	cmp    %rax,%rdi
+  801190:	73 0f                	jae    8011a1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801192:	40 38 37             	cmp    %sil,(%rdi)
+  801195:	74 0e                	je     8011a5 <memfind+0x1c>
+    for (; src < end; src++) {
+  801197:	48 83 c7 01          	add    $0x1,%rdi
+  80119b:	48 39 f8             	cmp    %rdi,%rax
+  80119e:	75 f2                	jne    801192 <memfind+0x9>
+  8011a0:	c3                   	ret
+  8011a1:	48 89 f8             	mov    %rdi,%rax
+  8011a4:	c3                   	ret
+  8011a5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011a8:	c3                   	ret
+
+00000000008011a9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011a9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011ac:	0f b6 37             	movzbl (%rdi),%esi
+  8011af:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b3:	74 06                	je     8011bb <strtol+0x12>
+  8011b5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b9:	75 13                	jne    8011ce <strtol+0x25>
+  8011bb:	48 83 c7 01          	add    $0x1,%rdi
+  8011bf:	0f b6 37             	movzbl (%rdi),%esi
+  8011c2:	40 80 fe 20          	cmp    $0x20,%sil
+  8011c6:	74 f3                	je     8011bb <strtol+0x12>
+  8011c8:	40 80 fe 09          	cmp    $0x9,%sil
+  8011cc:	74 ed                	je     8011bb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011ce:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011d1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011d4:	3c 01                	cmp    $0x1,%al
+  8011d6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011da:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011e0:	75 0f                	jne    8011f1 <strtol+0x48>
+  8011e2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011e5:	74 14                	je     8011fb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011e7:	85 d2                	test   %edx,%edx
+  8011e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011ee:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011f6:	4c 63 ca             	movslq %edx,%r9
+  8011f9:	eb 36                	jmp    801231 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011fb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011ff:	74 0f                	je     801210 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801201:	85 d2                	test   %edx,%edx
+  801203:	75 ec                	jne    8011f1 <strtol+0x48>
+        s++;
+  801205:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801209:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80120e:	eb e1                	jmp    8011f1 <strtol+0x48>
+        s += 2;
+  801210:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801214:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801219:	eb d6                	jmp    8011f1 <strtol+0x48>
+            dig -= '0';
+  80121b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80121e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801222:	41 39 d0             	cmp    %edx,%r8d
+  801225:	7d 21                	jge    801248 <strtol+0x9f>
+        val = val * base + dig;
+  801227:	49 0f af c1          	imul   %r9,%rax
+  80122b:	0f b6 c9             	movzbl %cl,%ecx
+  80122e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801231:	48 83 c7 01          	add    $0x1,%rdi
+  801235:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801239:	80 f9 39             	cmp    $0x39,%cl
+  80123c:	76 dd                	jbe    80121b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80123e:	80 f9 7b             	cmp    $0x7b,%cl
+  801241:	77 05                	ja     801248 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801243:	83 e9 57             	sub    $0x57,%ecx
+  801246:	eb d6                	jmp    80121e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801248:	4d 85 d2             	test   %r10,%r10
+  80124b:	74 03                	je     801250 <strtol+0xa7>
+  80124d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801250:	48 89 c2             	mov    %rax,%rdx
+  801253:	48 f7 da             	neg    %rdx
+  801256:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80125a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80125e:	c3                   	ret
+
+000000000080125f <strrev>:
+
+void
+strrev(char *str)
+{
+  80125f:	55                   	push   %rbp
+  801260:	48 89 e5             	mov    %rsp,%rbp
+  801263:	53                   	push   %rbx
+  801264:	48 83 ec 08          	sub    $0x8,%rsp
+  801268:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80126b:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  801272:	00 00 00 
+  801275:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801277:	83 e8 01             	sub    $0x1,%eax
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	7e 22                	jle    8012a0 <strrev+0x41>
+  80127e:	48 98                	cltq
+  801280:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801285:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801289:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  80128d:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801291:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801294:	48 83 c2 01          	add    $0x1,%rdx
+  801298:	48 83 e8 01          	sub    $0x1,%rax
+  80129c:	39 c2                	cmp    %eax,%edx
+  80129e:	7c e5                	jl     801285 <strrev+0x26>
+	}
+}
+  8012a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a4:	c9                   	leave
+  8012a5:	c3                   	ret
+
+00000000008012a6 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  8012a6:	85 d2                	test   %edx,%edx
+  8012a8:	0f 84 80 00 00 00    	je     80132e <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	53                   	push   %rbx
+  8012b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b7:	49 89 f2             	mov    %rsi,%r10
+  8012ba:	41 89 d3             	mov    %edx,%r11d
+  8012bd:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8012c0:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8012c5:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8012c8:	eb 20                	jmp    8012ea <itoa+0x44>
+			str[i++] = '0' + digit;
+  8012ca:	41 89 f1             	mov    %esi,%r9d
+  8012cd:	83 c2 30             	add    $0x30,%edx
+  8012d0:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8012d3:	89 f8                	mov    %edi,%eax
+  8012d5:	99                   	cltd
+  8012d6:	f7 f9                	idiv   %ecx
+  8012d8:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	74 2e                	je     80130c <itoa+0x66>
+  8012de:	83 c6 01             	add    $0x1,%esi
+  8012e1:	49 83 c0 01          	add    $0x1,%r8
+  8012e5:	44 39 cb             	cmp    %r9d,%ebx
+  8012e8:	7e 15                	jle    8012ff <itoa+0x59>
+		digit = sum % base;
+  8012ea:	89 f8                	mov    %edi,%eax
+  8012ec:	99                   	cltd
+  8012ed:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8012ef:	83 fa 09             	cmp    $0x9,%edx
+  8012f2:	7e d6                	jle    8012ca <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8012f4:	41 89 f1             	mov    %esi,%r9d
+  8012f7:	83 c2 37             	add    $0x37,%edx
+  8012fa:	41 88 10             	mov    %dl,(%r8)
+  8012fd:	eb d4                	jmp    8012d3 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8012ff:	41 83 eb 01          	sub    $0x1,%r11d
+  801303:	45 39 cb             	cmp    %r9d,%r11d
+  801306:	75 04                	jne    80130c <itoa+0x66>
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	75 28                	jne    801334 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80130c:	4d 63 c9             	movslq %r9d,%r9
+  80130f:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801314:	4c 89 d7             	mov    %r10,%rdi
+  801317:	48 b8 5f 12 80 00 00 	movabs $0x80125f,%rax
+  80131e:	00 00 00 
+  801321:	ff d0                	call   *%rax
+	return 0;
+  801323:	b8 00 00 00 00       	mov    $0x0,%eax
+  801328:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+		return -1;
+  80132e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801333:	c3                   	ret
+		return -1;
+  801334:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801339:	eb ed                	jmp    801328 <itoa+0x82>
+
+000000000080133b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	53                   	push   %rbx
+  801340:	48 89 fa             	mov    %rdi,%rdx
+  801343:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801346:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801355:	be 00 00 00 00       	mov    $0x0,%esi
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801360:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+
+0000000000801368 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80136d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801372:	ba 00 00 00 00       	mov    $0x0,%edx
+  801377:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801381:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801386:	be 00 00 00 00       	mov    $0x0,%esi
+  80138b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801391:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801393:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801397:	c9                   	leave
+  801398:	c3                   	ret
+
+0000000000801399 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801399:	55                   	push   %rbp
+  80139a:	48 89 e5             	mov    %rsp,%rbp
+  80139d:	53                   	push   %rbx
+  80139e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c6:	48 85 c0             	test   %rax,%rax
+  8013c9:	7f 06                	jg     8013d1 <sys_env_destroy+0x38>
+}
+  8013cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cf:	c9                   	leave
+  8013d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d1:	49 89 c0             	mov    %rax,%r8
+  8013d4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013d9:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  8013e0:	00 00 00 
+  8013e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e8:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  8013ef:	00 00 00 
+  8013f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f7:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  8013fe:	00 00 00 
+  801401:	41 ff d1             	call   *%r9
+
+0000000000801404 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801404:	55                   	push   %rbp
+  801405:	48 89 e5             	mov    %rsp,%rbp
+  801408:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801409:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801413:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801418:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801422:	be 00 00 00 00       	mov    $0x0,%esi
+  801427:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80142f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801433:	c9                   	leave
+  801434:	c3                   	ret
+
+0000000000801435 <sys_yield>:
+
+void
+sys_yield(void) {
+  801435:	55                   	push   %rbp
+  801436:	48 89 e5             	mov    %rsp,%rbp
+  801439:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80143a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801444:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801449:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+
+0000000000801466 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801466:	55                   	push   %rbp
+  801467:	48 89 e5             	mov    %rsp,%rbp
+  80146a:	53                   	push   %rbx
+  80146b:	48 89 fa             	mov    %rdi,%rdx
+  80146e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801471:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801476:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80147d:	00 00 00 
+  801480:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801485:	be 00 00 00 00       	mov    $0x0,%esi
+  80148a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801490:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+0000000000801498 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801498:	55                   	push   %rbp
+  801499:	48 89 e5             	mov    %rsp,%rbp
+  80149c:	53                   	push   %rbx
+  80149d:	49 89 f8             	mov    %rdi,%r8
+  8014a0:	48 89 d3             	mov    %rdx,%rbx
+  8014a3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014a6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ab:	4c 89 c2             	mov    %r8,%rdx
+  8014ae:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c2:	c9                   	leave
+  8014c3:	c3                   	ret
+
+00000000008014c4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	53                   	push   %rbx
+  8014c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cd:	89 f8                	mov    %edi,%eax
+  8014cf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014d2:	48 63 f9             	movslq %ecx,%rdi
+  8014d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ed:	48 85 c0             	test   %rax,%rax
+  8014f0:	7f 06                	jg     8014f8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f8:	49 89 c0             	mov    %rax,%r8
+  8014fb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801500:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  801507:	00 00 00 
+  80150a:	be 26 00 00 00       	mov    $0x26,%esi
+  80150f:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  801516:	00 00 00 
+  801519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151e:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  801525:	00 00 00 
+  801528:	41 ff d1             	call   *%r9
+
+000000000080152b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80152b:	55                   	push   %rbp
+  80152c:	48 89 e5             	mov    %rsp,%rbp
+  80152f:	53                   	push   %rbx
+  801530:	48 83 ec 08          	sub    $0x8,%rsp
+  801534:	89 f8                	mov    %edi,%eax
+  801536:	49 89 f2             	mov    %rsi,%r10
+  801539:	48 89 cf             	mov    %rcx,%rdi
+  80153c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80153f:	48 63 da             	movslq %edx,%rbx
+  801542:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801545:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801550:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801552:	48 85 c0             	test   %rax,%rax
+  801555:	7f 06                	jg     80155d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155d:	49 89 c0             	mov    %rax,%r8
+  801560:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801565:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  80156c:	00 00 00 
+  80156f:	be 26 00 00 00       	mov    $0x26,%esi
+  801574:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  80157b:	00 00 00 
+  80157e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801583:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  80158a:	00 00 00 
+  80158d:	41 ff d1             	call   *%r9
+
+0000000000801590 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801590:	55                   	push   %rbp
+  801591:	48 89 e5             	mov    %rsp,%rbp
+  801594:	53                   	push   %rbx
+  801595:	48 83 ec 08          	sub    $0x8,%rsp
+  801599:	48 89 f1             	mov    %rsi,%rcx
+  80159c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80159f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b9:	48 85 c0             	test   %rax,%rax
+  8015bc:	7f 06                	jg     8015c4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c4:	49 89 c0             	mov    %rax,%r8
+  8015c7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015cc:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  8015d3:	00 00 00 
+  8015d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015db:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  8015e2:	00 00 00 
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  8015f1:	00 00 00 
+  8015f4:	41 ff d1             	call   *%r9
+
+00000000008015f7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801600:	48 63 ce             	movslq %esi,%rcx
+  801603:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801606:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801610:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801615:	be 00 00 00 00       	mov    $0x0,%esi
+  80161a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801620:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801622:	48 85 c0             	test   %rax,%rax
+  801625:	7f 06                	jg     80162d <sys_env_set_status+0x36>
+}
+  801627:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162d:	49 89 c0             	mov    %rax,%r8
+  801630:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801635:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  80163c:	00 00 00 
+  80163f:	be 26 00 00 00       	mov    $0x26,%esi
+  801644:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  80164b:	00 00 00 
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  80165a:	00 00 00 
+  80165d:	41 ff d1             	call   *%r9
+
+0000000000801660 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801660:	55                   	push   %rbp
+  801661:	48 89 e5             	mov    %rsp,%rbp
+  801664:	53                   	push   %rbx
+  801665:	48 83 ec 08          	sub    $0x8,%rsp
+  801669:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80166c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801674:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801679:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167e:	be 00 00 00 00       	mov    $0x0,%esi
+  801683:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801689:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168b:	48 85 c0             	test   %rax,%rax
+  80168e:	7f 06                	jg     801696 <sys_env_set_trapframe+0x36>
+}
+  801690:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801696:	49 89 c0             	mov    %rax,%r8
+  801699:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80169e:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  8016a5:	00 00 00 
+  8016a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ad:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  8016b4:	00 00 00 
+  8016b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bc:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  8016c3:	00 00 00 
+  8016c6:	41 ff d1             	call   *%r9
+
+00000000008016c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016c9:	55                   	push   %rbp
+  8016ca:	48 89 e5             	mov    %rsp,%rbp
+  8016cd:	53                   	push   %rbx
+  8016ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f4:	48 85 c0             	test   %rax,%rax
+  8016f7:	7f 06                	jg     8016ff <sys_env_set_pgfault_upcall+0x36>
+}
+  8016f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fd:	c9                   	leave
+  8016fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ff:	49 89 c0             	mov    %rax,%r8
+  801702:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801707:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  80170e:	00 00 00 
+  801711:	be 26 00 00 00       	mov    $0x26,%esi
+  801716:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  80171d:	00 00 00 
+  801720:	b8 00 00 00 00       	mov    $0x0,%eax
+  801725:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  80172c:	00 00 00 
+  80172f:	41 ff d1             	call   *%r9
+
+0000000000801732 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801732:	55                   	push   %rbp
+  801733:	48 89 e5             	mov    %rsp,%rbp
+  801736:	53                   	push   %rbx
+  801737:	89 f8                	mov    %edi,%eax
+  801739:	49 89 f1             	mov    %rsi,%r9
+  80173c:	48 89 d3             	mov    %rdx,%rbx
+  80173f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801742:	49 63 f0             	movslq %r8d,%rsi
+  801745:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801748:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80174d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801750:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801756:	cd 30                	int    $0x30
+}
+  801758:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	53                   	push   %rbx
+  801763:	48 83 ec 08          	sub    $0x8,%rsp
+  801767:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80176a:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801772:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801775:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177a:	be 00 00 00 00       	mov    $0x0,%esi
+  80177f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801785:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801787:	48 85 c0             	test   %rax,%rax
+  80178a:	7f 06                	jg     801792 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80178c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801792:	49 89 c0             	mov    %rax,%r8
+  801795:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80179a:	48 ba a8 41 80 00 00 	movabs $0x8041a8,%rdx
+  8017a1:	00 00 00 
+  8017a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8017a9:	48 bf c7 41 80 00 00 	movabs $0x8041c7,%rdi
+  8017b0:	00 00 00 
+  8017b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b8:	49 b9 c3 03 80 00 00 	movabs $0x8003c3,%r9
+  8017bf:	00 00 00 
+  8017c2:	41 ff d1             	call   *%r9
+
+00000000008017c5 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8017c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ce:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+}
+  8017da:	5d                   	pop    %rbp
+  8017db:	c3                   	ret
+
+00000000008017dc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801805:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801807:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+
+000000000080180d <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  80180d:	55                   	push   %rbp
+  80180e:	48 89 e5             	mov    %rsp,%rbp
+  801811:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801812:	48 63 ce             	movslq %esi,%rcx
+  801815:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801819:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801823:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801828:	be 00 00 00 00       	mov    $0x0,%esi
+  80182d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801833:	cd 30                	int    $0x30
+}
+  801835:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801839:	c9                   	leave
+  80183a:	c3                   	ret
+
+000000000080183b <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80183b:	55                   	push   %rbp
+  80183c:	48 89 e5             	mov    %rsp,%rbp
+  80183f:	53                   	push   %rbx
+  801840:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801843:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801847:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801851:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801856:	be 00 00 00 00       	mov    $0x0,%esi
+  80185b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801861:	cd 30                	int    $0x30
+}
+  801863:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801867:	c9                   	leave
+  801868:	c3                   	ret
+
+0000000000801869 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801869:	55                   	push   %rbp
+  80186a:	48 89 e5             	mov    %rsp,%rbp
+  80186d:	53                   	push   %rbx
+  80186e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801871:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801874:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801879:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801881:	be 00 00 00 00       	mov    $0x0,%esi
+  801886:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188c:	cd 30                	int    $0x30
+}
+  80188e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801892:	c9                   	leave
+  801893:	c3                   	ret
+
+0000000000801894 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801894:	55                   	push   %rbp
+  801895:	48 89 e5             	mov    %rsp,%rbp
+  801898:	41 54                	push   %r12
+  80189a:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80189b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018a0:	cd 30                	int    $0x30
+  8018a2:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	78 7e                	js     801927 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  8018a9:	0f 84 80 00 00 00    	je     80192f <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8018af:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018b5:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018bc:	00 00 00 
+  8018bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c4:	89 c2                	mov    %eax,%edx
+  8018c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018d0:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  8018d7:	00 00 00 
+  8018da:	ff d0                	call   *%rax
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	0f 88 81 00 00 00    	js     801965 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8018e4:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  8018eb:	00 00 00 
+  8018ee:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  8018f5:	44 89 e7             	mov    %r12d,%edi
+  8018f8:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+  801904:	85 c0                	test   %eax,%eax
+  801906:	78 65                	js     80196d <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801908:	be 02 00 00 00       	mov    $0x2,%esi
+  80190d:	44 89 e7             	mov    %r12d,%edi
+  801910:	48 b8 f7 15 80 00 00 	movabs $0x8015f7,%rax
+  801917:	00 00 00 
+  80191a:	ff d0                	call   *%rax
+        return -1;
+  80191c:	85 c0                	test   %eax,%eax
+  80191e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801923:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801927:	44 89 e0             	mov    %r12d,%eax
+  80192a:	5b                   	pop    %rbx
+  80192b:	41 5c                	pop    %r12
+  80192d:	5d                   	pop    %rbp
+  80192e:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80192f:	48 b8 04 14 80 00 00 	movabs $0x801404,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+  80193b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801940:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801944:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801948:	48 c1 e0 04          	shl    $0x4,%rax
+  80194c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801953:	00 00 00 
+  801956:	48 01 d0             	add    %rdx,%rax
+  801959:	48 a3 00 64 80 00 00 	movabs %rax,0x806400
+  801960:	00 00 00 
+        return 0;
+  801963:	eb c2                	jmp    801927 <fork+0x93>
+        return -1;
+  801965:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80196b:	eb ba                	jmp    801927 <fork+0x93>
+        return -1;
+  80196d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801973:	eb b2                	jmp    801927 <fork+0x93>
+
+0000000000801975 <sfork>:
+
+envid_t
+sfork() {
+  801975:	55                   	push   %rbp
+  801976:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801979:	48 ba d5 41 80 00 00 	movabs $0x8041d5,%rdx
+  801980:	00 00 00 
+  801983:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801988:	48 bf f0 41 80 00 00 	movabs $0x8041f0,%rdi
+  80198f:	00 00 00 
+  801992:	b8 00 00 00 00       	mov    $0x0,%eax
+  801997:	48 b9 c3 03 80 00 00 	movabs $0x8003c3,%rcx
+  80199e:	00 00 00 
+  8019a1:	ff d1                	call   *%rcx
+
+00000000008019a3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019aa:	ff ff ff 
+  8019ad:	48 01 f8             	add    %rdi,%rax
+  8019b0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019b4:	c3                   	ret
+
+00000000008019b5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019bc:	ff ff ff 
+  8019bf:	48 01 f8             	add    %rdi,%rax
+  8019c2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019c6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019cc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019d0:	c3                   	ret
+
+00000000008019d1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	41 57                	push   %r15
+  8019d7:	41 56                	push   %r14
+  8019d9:	41 55                	push   %r13
+  8019db:	41 54                	push   %r12
+  8019dd:	53                   	push   %rbx
+  8019de:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e2:	49 89 ff             	mov    %rdi,%r15
+  8019e5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019ea:	49 bd b3 35 80 00 00 	movabs $0x8035b3,%r13
+  8019f1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019f4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019fa:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019fd:	48 89 df             	mov    %rbx,%rdi
+  801a00:	41 ff d5             	call   *%r13
+  801a03:	83 e0 04             	and    $0x4,%eax
+  801a06:	74 17                	je     801a1f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a08:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a0f:	4c 39 f3             	cmp    %r14,%rbx
+  801a12:	75 e6                	jne    8019fa <fd_alloc+0x29>
+  801a14:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a1a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a1f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a22:	48 83 c4 08          	add    $0x8,%rsp
+  801a26:	5b                   	pop    %rbx
+  801a27:	41 5c                	pop    %r12
+  801a29:	41 5d                	pop    %r13
+  801a2b:	41 5e                	pop    %r14
+  801a2d:	41 5f                	pop    %r15
+  801a2f:	5d                   	pop    %rbp
+  801a30:	c3                   	ret
+
+0000000000801a31 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a31:	83 ff 1f             	cmp    $0x1f,%edi
+  801a34:	77 39                	ja     801a6f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	41 54                	push   %r12
+  801a3c:	53                   	push   %rbx
+  801a3d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a40:	48 63 df             	movslq %edi,%rbx
+  801a43:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a4a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a4e:	48 89 df             	mov    %rbx,%rdi
+  801a51:	48 b8 b3 35 80 00 00 	movabs $0x8035b3,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+  801a5d:	a8 04                	test   $0x4,%al
+  801a5f:	74 14                	je     801a75 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a61:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	5d                   	pop    %rbp
+  801a6e:	c3                   	ret
+        return -E_INVAL;
+  801a6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a74:	c3                   	ret
+        return -E_INVAL;
+  801a75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7a:	eb ee                	jmp    801a6a <fd_lookup+0x39>
+
+0000000000801a7c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a7c:	55                   	push   %rbp
+  801a7d:	48 89 e5             	mov    %rsp,%rbp
+  801a80:	41 54                	push   %r12
+  801a82:	53                   	push   %rbx
+  801a83:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a86:	48 b8 a0 42 80 00 00 	movabs $0x8042a0,%rax
+  801a8d:	00 00 00 
+  801a90:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a97:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a9a:	39 3b                	cmp    %edi,(%rbx)
+  801a9c:	74 47                	je     801ae5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a9e:	48 83 c0 08          	add    $0x8,%rax
+  801aa2:	48 8b 18             	mov    (%rax),%rbx
+  801aa5:	48 85 db             	test   %rbx,%rbx
+  801aa8:	75 f0                	jne    801a9a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aaa:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801ab1:	00 00 00 
+  801ab4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801aba:	89 fa                	mov    %edi,%edx
+  801abc:	48 bf 00 42 80 00 00 	movabs $0x804200,%rdi
+  801ac3:	00 00 00 
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	48 b9 13 05 80 00 00 	movabs $0x800513,%rcx
+  801ad2:	00 00 00 
+  801ad5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ad7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801adc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ae0:	5b                   	pop    %rbx
+  801ae1:	41 5c                	pop    %r12
+  801ae3:	5d                   	pop    %rbp
+  801ae4:	c3                   	ret
+            return 0;
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aea:	eb f0                	jmp    801adc <dev_lookup+0x60>
+
+0000000000801aec <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801aec:	55                   	push   %rbp
+  801aed:	48 89 e5             	mov    %rsp,%rbp
+  801af0:	41 55                	push   %r13
+  801af2:	41 54                	push   %r12
+  801af4:	53                   	push   %rbx
+  801af5:	48 83 ec 18          	sub    $0x18,%rsp
+  801af9:	48 89 fb             	mov    %rdi,%rbx
+  801afc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aff:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b06:	ff ff ff 
+  801b09:	48 01 df             	add    %rbx,%rdi
+  801b0c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b10:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b14:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801b1b:	00 00 00 
+  801b1e:	ff d0                	call   *%rax
+  801b20:	41 89 c5             	mov    %eax,%r13d
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	78 06                	js     801b2d <fd_close+0x41>
+  801b27:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b2b:	74 1a                	je     801b47 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b2d:	45 84 e4             	test   %r12b,%r12b
+  801b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b35:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b39:	44 89 e8             	mov    %r13d,%eax
+  801b3c:	48 83 c4 18          	add    $0x18,%rsp
+  801b40:	5b                   	pop    %rbx
+  801b41:	41 5c                	pop    %r12
+  801b43:	41 5d                	pop    %r13
+  801b45:	5d                   	pop    %rbp
+  801b46:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b47:	8b 3b                	mov    (%rbx),%edi
+  801b49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b4d:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  801b54:	00 00 00 
+  801b57:	ff d0                	call   *%rax
+  801b59:	41 89 c5             	mov    %eax,%r13d
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 1b                	js     801b7b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b64:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b68:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b6e:	48 85 c0             	test   %rax,%rax
+  801b71:	74 08                	je     801b7b <fd_close+0x8f>
+  801b73:	48 89 df             	mov    %rbx,%rdi
+  801b76:	ff d0                	call   *%rax
+  801b78:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b80:	48 89 de             	mov    %rbx,%rsi
+  801b83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b88:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  801b8f:	00 00 00 
+  801b92:	ff d0                	call   *%rax
+    return res;
+  801b94:	eb a3                	jmp    801b39 <fd_close+0x4d>
+
+0000000000801b96 <close>:
+
+int
+close(int fdnum) {
+  801b96:	55                   	push   %rbp
+  801b97:	48 89 e5             	mov    %rsp,%rbp
+  801b9a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b9e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ba2:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801ba9:	00 00 00 
+  801bac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 15                	js     801bc7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bb2:	be 01 00 00 00       	mov    $0x1,%esi
+  801bb7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bbb:	48 b8 ec 1a 80 00 00 	movabs $0x801aec,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+}
+  801bc7:	c9                   	leave
+  801bc8:	c3                   	ret
+
+0000000000801bc9 <close_all>:
+
+void
+close_all(void) {
+  801bc9:	55                   	push   %rbp
+  801bca:	48 89 e5             	mov    %rsp,%rbp
+  801bcd:	41 54                	push   %r12
+  801bcf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd5:	49 bc 96 1b 80 00 00 	movabs $0x801b96,%r12
+  801bdc:	00 00 00 
+  801bdf:	89 df                	mov    %ebx,%edi
+  801be1:	41 ff d4             	call   *%r12
+  801be4:	83 c3 01             	add    $0x1,%ebx
+  801be7:	83 fb 20             	cmp    $0x20,%ebx
+  801bea:	75 f3                	jne    801bdf <close_all+0x16>
+}
+  801bec:	5b                   	pop    %rbx
+  801bed:	41 5c                	pop    %r12
+  801bef:	5d                   	pop    %rbp
+  801bf0:	c3                   	ret
+
+0000000000801bf1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bf1:	55                   	push   %rbp
+  801bf2:	48 89 e5             	mov    %rsp,%rbp
+  801bf5:	41 57                	push   %r15
+  801bf7:	41 56                	push   %r14
+  801bf9:	41 55                	push   %r13
+  801bfb:	41 54                	push   %r12
+  801bfd:	53                   	push   %rbx
+  801bfe:	48 83 ec 18          	sub    $0x18,%rsp
+  801c02:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c05:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c09:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	89 c3                	mov    %eax,%ebx
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	0f 88 b8 00 00 00    	js     801cd7 <dup+0xe6>
+    close(newfdnum);
+  801c1f:	44 89 e7             	mov    %r12d,%edi
+  801c22:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c2e:	4d 63 ec             	movslq %r12d,%r13
+  801c31:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c38:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c3c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c40:	4c 89 ff             	mov    %r15,%rdi
+  801c43:	49 be b5 19 80 00 00 	movabs $0x8019b5,%r14
+  801c4a:	00 00 00 
+  801c4d:	41 ff d6             	call   *%r14
+  801c50:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c53:	4c 89 ef             	mov    %r13,%rdi
+  801c56:	41 ff d6             	call   *%r14
+  801c59:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c5c:	48 89 df             	mov    %rbx,%rdi
+  801c5f:	48 b8 b3 35 80 00 00 	movabs $0x8035b3,%rax
+  801c66:	00 00 00 
+  801c69:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c6b:	a8 04                	test   $0x4,%al
+  801c6d:	74 2b                	je     801c9a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c6f:	41 89 c1             	mov    %eax,%r9d
+  801c72:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c78:	4c 89 f1             	mov    %r14,%rcx
+  801c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c80:	48 89 de             	mov    %rbx,%rsi
+  801c83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c88:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  801c8f:	00 00 00 
+  801c92:	ff d0                	call   *%rax
+  801c94:	89 c3                	mov    %eax,%ebx
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 4e                	js     801ce8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c9a:	4c 89 ff             	mov    %r15,%rdi
+  801c9d:	48 b8 b3 35 80 00 00 	movabs $0x8035b3,%rax
+  801ca4:	00 00 00 
+  801ca7:	ff d0                	call   *%rax
+  801ca9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cac:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cb2:	4c 89 e9             	mov    %r13,%rcx
+  801cb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cba:	4c 89 fe             	mov    %r15,%rsi
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc2:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  801cc9:	00 00 00 
+  801ccc:	ff d0                	call   *%rax
+  801cce:	89 c3                	mov    %eax,%ebx
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 14                	js     801ce8 <dup+0xf7>
+
+    return newfdnum;
+  801cd4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cd7:	89 d8                	mov    %ebx,%eax
+  801cd9:	48 83 c4 18          	add    $0x18,%rsp
+  801cdd:	5b                   	pop    %rbx
+  801cde:	41 5c                	pop    %r12
+  801ce0:	41 5d                	pop    %r13
+  801ce2:	41 5e                	pop    %r14
+  801ce4:	41 5f                	pop    %r15
+  801ce6:	5d                   	pop    %rbp
+  801ce7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ce8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ced:	4c 89 ee             	mov    %r13,%rsi
+  801cf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf5:	49 bc 90 15 80 00 00 	movabs $0x801590,%r12
+  801cfc:	00 00 00 
+  801cff:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d07:	4c 89 f6             	mov    %r14,%rsi
+  801d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0f:	41 ff d4             	call   *%r12
+    return res;
+  801d12:	eb c3                	jmp    801cd7 <dup+0xe6>
+
+0000000000801d14 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	41 56                	push   %r14
+  801d1a:	41 55                	push   %r13
+  801d1c:	41 54                	push   %r12
+  801d1e:	53                   	push   %rbx
+  801d1f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d23:	89 fb                	mov    %edi,%ebx
+  801d25:	49 89 f4             	mov    %rsi,%r12
+  801d28:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d2b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d2f:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 4c                	js     801d8b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d43:	41 8b 3e             	mov    (%r14),%edi
+  801d46:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d4a:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 35                	js     801d8f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d5a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d5e:	83 e0 03             	and    $0x3,%eax
+  801d61:	83 f8 01             	cmp    $0x1,%eax
+  801d64:	74 2d                	je     801d93 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d66:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d6a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d6e:	48 85 c0             	test   %rax,%rax
+  801d71:	74 56                	je     801dc9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d73:	4c 89 ea             	mov    %r13,%rdx
+  801d76:	4c 89 e6             	mov    %r12,%rsi
+  801d79:	4c 89 f7             	mov    %r14,%rdi
+  801d7c:	ff d0                	call   *%rax
+}
+  801d7e:	48 83 c4 10          	add    $0x10,%rsp
+  801d82:	5b                   	pop    %rbx
+  801d83:	41 5c                	pop    %r12
+  801d85:	41 5d                	pop    %r13
+  801d87:	41 5e                	pop    %r14
+  801d89:	5d                   	pop    %rbp
+  801d8a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8b:	48 98                	cltq
+  801d8d:	eb ef                	jmp    801d7e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d8f:	48 98                	cltq
+  801d91:	eb eb                	jmp    801d7e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d93:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801d9a:	00 00 00 
+  801d9d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801da3:	89 da                	mov    %ebx,%edx
+  801da5:	48 bf 61 42 80 00 00 	movabs $0x804261,%rdi
+  801dac:	00 00 00 
+  801daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db4:	48 b9 13 05 80 00 00 	movabs $0x800513,%rcx
+  801dbb:	00 00 00 
+  801dbe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dc0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dc7:	eb b5                	jmp    801d7e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dd0:	eb ac                	jmp    801d7e <read+0x6a>
+
+0000000000801dd2 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801dd2:	55                   	push   %rbp
+  801dd3:	48 89 e5             	mov    %rsp,%rbp
+  801dd6:	41 56                	push   %r14
+  801dd8:	41 55                	push   %r13
+  801dda:	41 54                	push   %r12
+  801ddc:	53                   	push   %rbx
+  801ddd:	48 83 ec 10          	sub    $0x10,%rsp
+  801de1:	89 fb                	mov    %edi,%ebx
+  801de3:	49 89 f4             	mov    %rsi,%r12
+  801de6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ded:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801df4:	00 00 00 
+  801df7:	ff d0                	call   *%rax
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 41                	js     801e3e <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dfd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e01:	41 8b 3e             	mov    (%r14),%edi
+  801e04:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e08:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  801e0f:	00 00 00 
+  801e12:	ff d0                	call   *%rax
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	78 35                	js     801e4d <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e18:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e1c:	83 e0 03             	and    $0x3,%eax
+  801e1f:	83 f8 01             	cmp    $0x1,%eax
+  801e22:	74 2d                	je     801e51 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e28:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e2c:	48 85 c0             	test   %rax,%rax
+  801e2f:	74 56                	je     801e87 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e31:	4c 89 ea             	mov    %r13,%rdx
+  801e34:	4c 89 e6             	mov    %r12,%rsi
+  801e37:	4c 89 f7             	mov    %r14,%rdi
+  801e3a:	ff d0                	call   *%rax
+  801e3c:	eb 02                	jmp    801e40 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3e:	48 98                	cltq
+}
+  801e40:	48 83 c4 10          	add    $0x10,%rsp
+  801e44:	5b                   	pop    %rbx
+  801e45:	41 5c                	pop    %r12
+  801e47:	41 5d                	pop    %r13
+  801e49:	41 5e                	pop    %r14
+  801e4b:	5d                   	pop    %rbp
+  801e4c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e4d:	48 98                	cltq
+  801e4f:	eb ef                	jmp    801e40 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e51:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801e58:	00 00 00 
+  801e5b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e61:	89 da                	mov    %ebx,%edx
+  801e63:	48 bf 20 42 80 00 00 	movabs $0x804220,%rdi
+  801e6a:	00 00 00 
+  801e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e72:	48 b9 13 05 80 00 00 	movabs $0x800513,%rcx
+  801e79:	00 00 00 
+  801e7c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e7e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e85:	eb b9                	jmp    801e40 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e87:	4c 89 ea             	mov    %r13,%rdx
+  801e8a:	4c 89 e6             	mov    %r12,%rsi
+  801e8d:	89 df                	mov    %ebx,%edi
+  801e8f:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	eb a3                	jmp    801e40 <readmap+0x6e>
+
+0000000000801e9d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	41 57                	push   %r15
+  801ea3:	41 56                	push   %r14
+  801ea5:	41 55                	push   %r13
+  801ea7:	41 54                	push   %r12
+  801ea9:	53                   	push   %rbx
+  801eaa:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801eae:	48 85 d2             	test   %rdx,%rdx
+  801eb1:	74 54                	je     801f07 <readn+0x6a>
+  801eb3:	41 89 fd             	mov    %edi,%r13d
+  801eb6:	49 89 f6             	mov    %rsi,%r14
+  801eb9:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ec1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ec6:	49 bf 14 1d 80 00 00 	movabs $0x801d14,%r15
+  801ecd:	00 00 00 
+  801ed0:	4c 89 e2             	mov    %r12,%rdx
+  801ed3:	48 29 f2             	sub    %rsi,%rdx
+  801ed6:	4c 01 f6             	add    %r14,%rsi
+  801ed9:	44 89 ef             	mov    %r13d,%edi
+  801edc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	78 20                	js     801f03 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ee3:	01 c3                	add    %eax,%ebx
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	74 08                	je     801ef1 <readn+0x54>
+  801ee9:	48 63 f3             	movslq %ebx,%rsi
+  801eec:	4c 39 e6             	cmp    %r12,%rsi
+  801eef:	72 df                	jb     801ed0 <readn+0x33>
+    }
+    return res;
+  801ef1:	48 63 c3             	movslq %ebx,%rax
+}
+  801ef4:	48 83 c4 08          	add    $0x8,%rsp
+  801ef8:	5b                   	pop    %rbx
+  801ef9:	41 5c                	pop    %r12
+  801efb:	41 5d                	pop    %r13
+  801efd:	41 5e                	pop    %r14
+  801eff:	41 5f                	pop    %r15
+  801f01:	5d                   	pop    %rbp
+  801f02:	c3                   	ret
+        if (inc < 0) return inc;
+  801f03:	48 98                	cltq
+  801f05:	eb ed                	jmp    801ef4 <readn+0x57>
+    int inc = 1, res = 0;
+  801f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0c:	eb e3                	jmp    801ef1 <readn+0x54>
+
+0000000000801f0e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	41 56                	push   %r14
+  801f14:	41 55                	push   %r13
+  801f16:	41 54                	push   %r12
+  801f18:	53                   	push   %rbx
+  801f19:	48 83 ec 10          	sub    $0x10,%rsp
+  801f1d:	89 fb                	mov    %edi,%ebx
+  801f1f:	49 89 f4             	mov    %rsi,%r12
+  801f22:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f25:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f29:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801f30:	00 00 00 
+  801f33:	ff d0                	call   *%rax
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	78 47                	js     801f80 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f39:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f3d:	41 8b 3e             	mov    (%r14),%edi
+  801f40:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f44:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 30                	js     801f84 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f54:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f59:	74 2d                	je     801f88 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f5f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f63:	48 85 c0             	test   %rax,%rax
+  801f66:	74 56                	je     801fbe <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f68:	4c 89 ea             	mov    %r13,%rdx
+  801f6b:	4c 89 e6             	mov    %r12,%rsi
+  801f6e:	4c 89 f7             	mov    %r14,%rdi
+  801f71:	ff d0                	call   *%rax
+}
+  801f73:	48 83 c4 10          	add    $0x10,%rsp
+  801f77:	5b                   	pop    %rbx
+  801f78:	41 5c                	pop    %r12
+  801f7a:	41 5d                	pop    %r13
+  801f7c:	41 5e                	pop    %r14
+  801f7e:	5d                   	pop    %rbp
+  801f7f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f80:	48 98                	cltq
+  801f82:	eb ef                	jmp    801f73 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f84:	48 98                	cltq
+  801f86:	eb eb                	jmp    801f73 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f88:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  801f8f:	00 00 00 
+  801f92:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f98:	89 da                	mov    %ebx,%edx
+  801f9a:	48 bf 7d 42 80 00 00 	movabs $0x80427d,%rdi
+  801fa1:	00 00 00 
+  801fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa9:	48 b9 13 05 80 00 00 	movabs $0x800513,%rcx
+  801fb0:	00 00 00 
+  801fb3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fbc:	eb b5                	jmp    801f73 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fbe:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fc5:	eb ac                	jmp    801f73 <write+0x65>
+
+0000000000801fc7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fc7:	55                   	push   %rbp
+  801fc8:	48 89 e5             	mov    %rsp,%rbp
+  801fcb:	53                   	push   %rbx
+  801fcc:	48 83 ec 18          	sub    $0x18,%rsp
+  801fd0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd6:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  801fdd:	00 00 00 
+  801fe0:	ff d0                	call   *%rax
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 0c                	js     801ff2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fe6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fea:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff6:	c9                   	leave
+  801ff7:	c3                   	ret
+
+0000000000801ff8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ff8:	55                   	push   %rbp
+  801ff9:	48 89 e5             	mov    %rsp,%rbp
+  801ffc:	41 55                	push   %r13
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	48 83 ec 18          	sub    $0x18,%rsp
+  802005:	89 fb                	mov    %edi,%ebx
+  802007:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80200a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80200e:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 38                	js     802056 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80201e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802022:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802026:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80202a:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 1c                	js     802056 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80203a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80203f:	74 20                	je     802061 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802041:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802045:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802049:	48 85 c0             	test   %rax,%rax
+  80204c:	74 47                	je     802095 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80204e:	44 89 e6             	mov    %r12d,%esi
+  802051:	4c 89 ef             	mov    %r13,%rdi
+  802054:	ff d0                	call   *%rax
+}
+  802056:	48 83 c4 18          	add    $0x18,%rsp
+  80205a:	5b                   	pop    %rbx
+  80205b:	41 5c                	pop    %r12
+  80205d:	41 5d                	pop    %r13
+  80205f:	5d                   	pop    %rbp
+  802060:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802061:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  802068:	00 00 00 
+  80206b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802071:	89 da                	mov    %ebx,%edx
+  802073:	48 bf 40 42 80 00 00 	movabs $0x804240,%rdi
+  80207a:	00 00 00 
+  80207d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802082:	48 b9 13 05 80 00 00 	movabs $0x800513,%rcx
+  802089:	00 00 00 
+  80208c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80208e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802093:	eb c1                	jmp    802056 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802095:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209a:	eb ba                	jmp    802056 <ftruncate+0x5e>
+
+000000000080209c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80209c:	55                   	push   %rbp
+  80209d:	48 89 e5             	mov    %rsp,%rbp
+  8020a0:	41 54                	push   %r12
+  8020a2:	53                   	push   %rbx
+  8020a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020aa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020ae:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	78 4e                	js     80210c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020be:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020c2:	41 8b 3c 24          	mov    (%r12),%edi
+  8020c6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020ca:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8020d1:	00 00 00 
+  8020d4:	ff d0                	call   *%rax
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	78 32                	js     80210c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020de:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8020e3:	74 30                	je     802115 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020e5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020e8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020ef:	00 00 00 
+    stat->st_isdir = 0;
+  8020f2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020f9:	00 00 00 
+    stat->st_dev = dev;
+  8020fc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802103:	48 89 de             	mov    %rbx,%rsi
+  802106:	4c 89 e7             	mov    %r12,%rdi
+  802109:	ff 50 30             	call   *0x30(%rax)
+}
+  80210c:	48 83 c4 10          	add    $0x10,%rsp
+  802110:	5b                   	pop    %rbx
+  802111:	41 5c                	pop    %r12
+  802113:	5d                   	pop    %rbp
+  802114:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802115:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80211a:	eb f0                	jmp    80210c <fstat+0x70>
+
+000000000080211c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80211c:	55                   	push   %rbp
+  80211d:	48 89 e5             	mov    %rsp,%rbp
+  802120:	41 54                	push   %r12
+  802122:	53                   	push   %rbx
+  802123:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802126:	be 00 00 00 00       	mov    $0x0,%esi
+  80212b:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	78 25                	js     802162 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80213d:	4c 89 e6             	mov    %r12,%rsi
+  802140:	89 c7                	mov    %eax,%edi
+  802142:	48 b8 9c 20 80 00 00 	movabs $0x80209c,%rax
+  802149:	00 00 00 
+  80214c:	ff d0                	call   *%rax
+  80214e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802151:	89 df                	mov    %ebx,%edi
+  802153:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+
+    return res;
+  80215f:	44 89 e3             	mov    %r12d,%ebx
+}
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	5b                   	pop    %rbx
+  802165:	41 5c                	pop    %r12
+  802167:	5d                   	pop    %rbp
+  802168:	c3                   	ret
+
+0000000000802169 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802169:	55                   	push   %rbp
+  80216a:	48 89 e5             	mov    %rsp,%rbp
+  80216d:	41 54                	push   %r12
+  80216f:	53                   	push   %rbx
+  802170:	48 83 ec 10          	sub    $0x10,%rsp
+  802174:	48 89 fb             	mov    %rdi,%rbx
+  802177:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80217a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80217e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802183:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  80218a:	00 00 00 
+  80218d:	ff d0                	call   *%rax
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	78 1f                	js     8021b2 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802193:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802197:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80219b:	48 85 c0             	test   %rax,%rax
+  80219e:	74 1b                	je     8021bb <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  8021a0:	4c 89 e6             	mov    %r12,%rsi
+  8021a3:	48 89 df             	mov    %rbx,%rdi
+  8021a6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021af:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021b2:	48 83 c4 10          	add    $0x10,%rsp
+  8021b6:	5b                   	pop    %rbx
+  8021b7:	41 5c                	pop    %r12
+  8021b9:	5d                   	pop    %rbp
+  8021ba:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021bb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c0:	eb f0                	jmp    8021b2 <create_snapshot+0x49>
+
+00000000008021c2 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021ce:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021d3:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 1e                	js     802201 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8021e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e7:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021eb:	48 85 d2             	test   %rdx,%rdx
+  8021ee:	74 13                	je     802203 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8021f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f5:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fe:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802201:	c9                   	leave
+  802202:	c3                   	ret
+        return -E_NOT_SUPP;
+  802203:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802208:	eb f7                	jmp    802201 <print_snapshot_list+0x3f>
+
+000000000080220a <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80220a:	55                   	push   %rbp
+  80220b:	48 89 e5             	mov    %rsp,%rbp
+  80220e:	53                   	push   %rbx
+  80220f:	48 83 ec 18          	sub    $0x18,%rsp
+  802213:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802216:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80221a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80221f:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 1c                	js     80224b <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80222f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802233:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802237:	48 85 c0             	test   %rax,%rax
+  80223a:	74 15                	je     802251 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  80223c:	48 89 df             	mov    %rbx,%rdi
+  80223f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802241:	85 c0                	test   %eax,%eax
+  802243:	ba 00 00 00 00       	mov    $0x0,%edx
+  802248:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80224b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224f:	c9                   	leave
+  802250:	c3                   	ret
+        return -E_NOT_SUPP;
+  802251:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802256:	eb f3                	jmp    80224b <accept_snapshot+0x41>
+
+0000000000802258 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802258:	55                   	push   %rbp
+  802259:	48 89 e5             	mov    %rsp,%rbp
+  80225c:	53                   	push   %rbx
+  80225d:	48 83 ec 18          	sub    $0x18,%rsp
+  802261:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802264:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802268:	bf 66 00 00 00       	mov    $0x66,%edi
+  80226d:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	78 1c                	js     802299 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80227d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802281:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802285:	48 85 c0             	test   %rax,%rax
+  802288:	74 15                	je     80229f <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80228a:	48 89 df             	mov    %rbx,%rdi
+  80228d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	ba 00 00 00 00       	mov    $0x0,%edx
+  802296:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802299:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80229f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022a4:	eb f3                	jmp    802299 <delete_snapshot+0x41>
+
+00000000008022a6 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  8022aa:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022ae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022b2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022b7:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8022be:	00 00 00 
+  8022c1:	ff d0                	call   *%rax
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	78 14                	js     8022db <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8022c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022cb:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8022cf:	48 85 d2             	test   %rdx,%rdx
+  8022d2:	74 09                	je     8022dd <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8022d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d9:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8022db:	c9                   	leave
+  8022dc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022dd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e2:	eb f7                	jmp    8022db <gc_snapshots+0x35>
+
+00000000008022e4 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+  8022e8:	41 56                	push   %r14
+  8022ea:	41 55                	push   %r13
+  8022ec:	41 54                	push   %r12
+  8022ee:	53                   	push   %rbx
+  8022ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f3:	48 89 fb             	mov    %rdi,%rbx
+  8022f6:	49 89 f4             	mov    %rsi,%r12
+  8022f9:	49 89 d5             	mov    %rdx,%r13
+  8022fc:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022ff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802303:	bf 66 00 00 00       	mov    $0x66,%edi
+  802308:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	85 c0                	test   %eax,%eax
+  802316:	78 1b                	js     802333 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802318:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80231c:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802320:	48 85 c0             	test   %rax,%rax
+  802323:	74 1b                	je     802340 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802325:	4c 89 f1             	mov    %r14,%rcx
+  802328:	4c 89 ea             	mov    %r13,%rdx
+  80232b:	4c 89 e6             	mov    %r12,%rsi
+  80232e:	48 89 df             	mov    %rbx,%rdi
+  802331:	ff d0                	call   *%rax
+
+    return res;
+}
+  802333:	48 83 c4 10          	add    $0x10,%rsp
+  802337:	5b                   	pop    %rbx
+  802338:	41 5c                	pop    %r12
+  80233a:	41 5d                	pop    %r13
+  80233c:	41 5e                	pop    %r14
+  80233e:	5d                   	pop    %rbp
+  80233f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802340:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802345:	eb ec                	jmp    802333 <diff_snapshots+0x4f>
+
+0000000000802347 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	41 55                	push   %r13
+  80234d:	41 54                	push   %r12
+  80234f:	53                   	push   %rbx
+  802350:	48 83 ec 18          	sub    $0x18,%rsp
+  802354:	48 89 fb             	mov    %rdi,%rbx
+  802357:	49 89 f4             	mov    %rsi,%r12
+  80235a:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80235d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802361:	bf 66 00 00 00       	mov    $0x66,%edi
+  802366:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 18                	js     80238e <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802376:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80237a:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80237e:	48 85 c0             	test   %rax,%rax
+  802381:	74 16                	je     802399 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802383:	4c 89 ea             	mov    %r13,%rdx
+  802386:	4c 89 e6             	mov    %r12,%rsi
+  802389:	48 89 df             	mov    %rbx,%rdi
+  80238c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80238e:	48 83 c4 18          	add    $0x18,%rsp
+  802392:	5b                   	pop    %rbx
+  802393:	41 5c                	pop    %r12
+  802395:	41 5d                	pop    %r13
+  802397:	5d                   	pop    %rbp
+  802398:	c3                   	ret
+        return -E_NOT_SUPP;
+  802399:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80239e:	eb ee                	jmp    80238e <send_snapshot+0x47>
+
+00000000008023a0 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+  8023a4:	53                   	push   %rbx
+  8023a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a9:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023ac:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023b0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023b5:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 12                	js     8023d7 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8023c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023c9:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8023cd:	48 85 c0             	test   %rax,%rax
+  8023d0:	74 0b                	je     8023dd <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8023d2:	48 89 df             	mov    %rbx,%rdi
+  8023d5:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023db:	c9                   	leave
+  8023dc:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023dd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023e2:	eb f3                	jmp    8023d7 <receive_snapshot+0x37>
+
+00000000008023e4 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023f0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023f5:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8023fc:	00 00 00 
+  8023ff:	ff d0                	call   *%rax
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 17                	js     80241c <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802405:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802409:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802410:	48 85 d2             	test   %rdx,%rdx
+  802413:	74 09                	je     80241e <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80241e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802423:	eb f7                	jmp    80241c <free_space_bytes+0x38>
+
+0000000000802425 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802425:	55                   	push   %rbp
+  802426:	48 89 e5             	mov    %rsp,%rbp
+  802429:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80242d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802431:	bf 66 00 00 00       	mov    $0x66,%edi
+  802436:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	85 c0                	test   %eax,%eax
+  802444:	78 17                	js     80245d <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80244a:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802451:	48 85 d2             	test   %rdx,%rdx
+  802454:	74 09                	je     80245f <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245b:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80245d:	c9                   	leave
+  80245e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80245f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802464:	eb f7                	jmp    80245d <busy_space_bytes+0x38>
+
+0000000000802466 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802466:	55                   	push   %rbp
+  802467:	48 89 e5             	mov    %rsp,%rbp
+  80246a:	41 54                	push   %r12
+  80246c:	53                   	push   %rbx
+  80246d:	48 83 ec 10          	sub    $0x10,%rsp
+  802471:	89 fb                	mov    %edi,%ebx
+  802473:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802476:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80247a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80247f:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  802486:	00 00 00 
+  802489:	ff d0                	call   *%rax
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	78 17                	js     8024a6 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80248f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802493:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80249a:	48 85 c0             	test   %rax,%rax
+  80249d:	74 10                	je     8024af <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80249f:	4c 89 e6             	mov    %r12,%rsi
+  8024a2:	89 df                	mov    %ebx,%edi
+  8024a4:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8024a6:	48 83 c4 10          	add    $0x10,%rsp
+  8024aa:	5b                   	pop    %rbx
+  8024ab:	41 5c                	pop    %r12
+  8024ad:	5d                   	pop    %rbp
+  8024ae:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b4:	eb f0                	jmp    8024a6 <snapshots_space+0x40>
+
+00000000008024b6 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8024b6:	55                   	push   %rbp
+  8024b7:	48 89 e5             	mov    %rsp,%rbp
+  8024ba:	41 55                	push   %r13
+  8024bc:	41 54                	push   %r12
+  8024be:	53                   	push   %rbx
+  8024bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c3:	41 89 fd             	mov    %edi,%r13d
+  8024c6:	48 89 f3             	mov    %rsi,%rbx
+  8024c9:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024cc:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024d3:	00 00 00 
+  8024d6:	83 38 00             	cmpl   $0x0,(%rax)
+  8024d9:	74 57                	je     802532 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024db:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024e6:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024ed:	00 00 00 
+  8024f0:	44 89 ee             	mov    %r13d,%esi
+  8024f3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024fa:	00 00 00 
+  8024fd:	8b 38                	mov    (%rax),%edi
+  8024ff:	48 b8 f6 39 80 00 00 	movabs $0x8039f6,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80250b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802510:	4c 89 e2             	mov    %r12,%rdx
+  802513:	48 89 de             	mov    %rbx,%rsi
+  802516:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251b:	48 b8 de 39 80 00 00 	movabs $0x8039de,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+}
+  802527:	48 83 c4 08          	add    $0x8,%rsp
+  80252b:	5b                   	pop    %rbx
+  80252c:	41 5c                	pop    %r12
+  80252e:	41 5d                	pop    %r13
+  802530:	5d                   	pop    %rbp
+  802531:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802532:	bf 03 00 00 00       	mov    $0x3,%edi
+  802537:	48 b8 b4 3a 80 00 00 	movabs $0x803ab4,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+  802543:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80254a:	00 00 
+  80254c:	eb 8d                	jmp    8024db <fsipc_region+0x25>
+
+000000000080254e <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80254e:	55                   	push   %rbp
+  80254f:	48 89 e5             	mov    %rsp,%rbp
+  802552:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802556:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80255d:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80255e:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802562:	48 b8 b6 24 80 00 00 	movabs $0x8024b6,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+}
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+0000000000802570 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802570:	85 ff                	test   %edi,%edi
+  802572:	78 6d                	js     8025e1 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	41 54                	push   %r12
+  80257a:	53                   	push   %rbx
+  80257b:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80257e:	48 85 f6             	test   %rsi,%rsi
+  802581:	74 57                	je     8025da <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802583:	89 f8                	mov    %edi,%eax
+  802585:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80258c:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80258e:	be 00 00 00 00       	mov    $0x0,%esi
+  802593:	bf 12 00 00 00       	mov    $0x12,%edi
+  802598:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 2d                	js     8025d5 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8025a8:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8025af:	00 00 00 
+  8025b2:	49 63 14 24          	movslq (%r12),%rdx
+  8025b6:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8025bd:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8025c2:	48 89 df             	mov    %rbx,%rdi
+  8025c5:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8025d1:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8025d5:	5b                   	pop    %rbx
+  8025d6:	41 5c                	pop    %r12
+  8025d8:	5d                   	pop    %rbp
+  8025d9:	c3                   	ret
+        return -E_INVAL;
+  8025da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025df:	eb f4                	jmp    8025d5 <devfile_df_snapshots+0x65>
+  8025e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025e6:	c3                   	ret
+
+00000000008025e7 <devfile_df_busy>:
+devfile_df_busy() {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f0:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025f5:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8025fc:	00 00 00 
+  8025ff:	ff d0                	call   *%rax
+}
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+
+0000000000802603 <devfile_df_free>:
+devfile_df_free() {
+  802603:	55                   	push   %rbp
+  802604:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802607:	be 00 00 00 00       	mov    $0x0,%esi
+  80260c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802611:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802618:	00 00 00 
+  80261b:	ff d0                	call   *%rax
+}
+  80261d:	5d                   	pop    %rbp
+  80261e:	c3                   	ret
+
+000000000080261f <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80261f:	55                   	push   %rbp
+  802620:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802623:	be 00 00 00 00       	mov    $0x0,%esi
+  802628:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80262d:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+}
+  802639:	5d                   	pop    %rbp
+  80263a:	c3                   	ret
+
+000000000080263b <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  80263b:	55                   	push   %rbp
+  80263c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80263f:	be 00 00 00 00       	mov    $0x0,%esi
+  802644:	bf 09 00 00 00       	mov    $0x9,%edi
+  802649:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802650:	00 00 00 
+  802653:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802655:	85 c0                	test   %eax,%eax
+  802657:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80265f:	5d                   	pop    %rbp
+  802660:	c3                   	ret
+
+0000000000802661 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802661:	55                   	push   %rbp
+  802662:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802665:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80266c:	00 00 00 
+  80266f:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802672:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802674:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802677:	be 00 00 00 00       	mov    $0x0,%esi
+  80267c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802681:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802688:	00 00 00 
+  80268b:	ff d0                	call   *%rax
+}
+  80268d:	5d                   	pop    %rbp
+  80268e:	c3                   	ret
+
+000000000080268f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80268f:	55                   	push   %rbp
+  802690:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802693:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802696:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80269d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80269f:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8026a9:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8026b0:	00 00 00 
+  8026b3:	ff d0                	call   *%rax
+}
+  8026b5:	5d                   	pop    %rbp
+  8026b6:	c3                   	ret
+
+00000000008026b7 <devfile_write>:
+    if (!fd || !buf) {
+  8026b7:	48 85 ff             	test   %rdi,%rdi
+  8026ba:	0f 84 c1 00 00 00    	je     802781 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026c0:	55                   	push   %rbp
+  8026c1:	48 89 e5             	mov    %rsp,%rbp
+  8026c4:	41 57                	push   %r15
+  8026c6:	41 56                	push   %r14
+  8026c8:	41 55                	push   %r13
+  8026ca:	41 54                	push   %r12
+  8026cc:	53                   	push   %rbx
+  8026cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d1:	49 89 ff             	mov    %rdi,%r15
+  8026d4:	49 89 f5             	mov    %rsi,%r13
+  8026d7:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026da:	48 85 f6             	test   %rsi,%rsi
+  8026dd:	0f 84 95 00 00 00    	je     802778 <devfile_write+0xc1>
+    while (n) {
+  8026e3:	48 85 d2             	test   %rdx,%rdx
+  8026e6:	0f 84 83 00 00 00    	je     80276f <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026ec:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026f3:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026fa:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026fd:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802702:	49 39 dc             	cmp    %rbx,%r12
+  802705:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802709:	48 89 da             	mov    %rbx,%rdx
+  80270c:	4c 89 ee             	mov    %r13,%rsi
+  80270f:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802716:	00 00 00 
+  802719:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802725:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802729:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80272c:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802730:	be 00 00 00 00       	mov    $0x0,%esi
+  802735:	bf 04 00 00 00       	mov    $0x4,%edi
+  80273a:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802741:	00 00 00 
+  802744:	ff d0                	call   *%rax
+        if (write < 0) {
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 21                	js     80276b <devfile_write+0xb4>
+        buf += write;
+  80274a:	48 63 d0             	movslq %eax,%rdx
+  80274d:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802750:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802753:	49 29 d4             	sub    %rdx,%r12
+  802756:	75 a5                	jne    8026fd <devfile_write+0x46>
+    return totalWrite;
+  802758:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80275c:	48 83 c4 18          	add    $0x18,%rsp
+  802760:	5b                   	pop    %rbx
+  802761:	41 5c                	pop    %r12
+  802763:	41 5d                	pop    %r13
+  802765:	41 5e                	pop    %r14
+  802767:	41 5f                	pop    %r15
+  802769:	5d                   	pop    %rbp
+  80276a:	c3                   	ret
+            return write;
+  80276b:	48 98                	cltq
+  80276d:	eb ed                	jmp    80275c <devfile_write+0xa5>
+    int totalWrite = 0;
+  80276f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802776:	eb e0                	jmp    802758 <devfile_write+0xa1>
+        return -E_INVAL;
+  802778:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80277f:	eb db                	jmp    80275c <devfile_write+0xa5>
+  802781:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802788:	c3                   	ret
+
+0000000000802789 <devfile_read>:
+    if (!fd || !buf) {
+  802789:	48 85 ff             	test   %rdi,%rdi
+  80278c:	0f 84 c0 00 00 00    	je     802852 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  802796:	41 57                	push   %r15
+  802798:	41 56                	push   %r14
+  80279a:	41 55                	push   %r13
+  80279c:	41 54                	push   %r12
+  80279e:	53                   	push   %rbx
+  80279f:	48 83 ec 18          	sub    $0x18,%rsp
+  8027a3:	49 89 ff             	mov    %rdi,%r15
+  8027a6:	49 89 f5             	mov    %rsi,%r13
+  8027a9:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8027ac:	48 85 f6             	test   %rsi,%rsi
+  8027af:	0f 84 96 00 00 00    	je     80284b <devfile_read+0xc2>
+    while (n) {
+  8027b5:	48 85 d2             	test   %rdx,%rdx
+  8027b8:	0f 84 87 00 00 00    	je     802845 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8027be:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027c5:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027c6:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027cd:	00 00 00 
+  8027d0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027d4:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8027d7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027dc:	49 39 c4             	cmp    %rax,%r12
+  8027df:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8027e3:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8027e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027f1:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	7e 37                	jle    802838 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802801:	48 63 d8             	movslq %eax,%rbx
+  802804:	48 89 da             	mov    %rbx,%rdx
+  802807:	4c 89 f6             	mov    %r14,%rsi
+  80280a:	4c 89 ef             	mov    %r13,%rdi
+  80280d:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+        buf += read;
+  802819:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  80281c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802820:	49 29 dc             	sub    %rbx,%r12
+  802823:	75 ab                	jne    8027d0 <devfile_read+0x47>
+  return totalRead;
+  802825:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802829:	48 83 c4 18          	add    $0x18,%rsp
+  80282d:	5b                   	pop    %rbx
+  80282e:	41 5c                	pop    %r12
+  802830:	41 5d                	pop    %r13
+  802832:	41 5e                	pop    %r14
+  802834:	41 5f                	pop    %r15
+  802836:	5d                   	pop    %rbp
+  802837:	c3                   	ret
+            return read ? read : totalRead;
+  802838:	48 63 d0             	movslq %eax,%rdx
+  80283b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80283f:	48 0f 45 c2          	cmovne %rdx,%rax
+  802843:	eb e4                	jmp    802829 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802845:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802849:	eb da                	jmp    802825 <devfile_read+0x9c>
+        return E_INVAL;
+  80284b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802850:	eb d7                	jmp    802829 <devfile_read+0xa0>
+  802852:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802857:	c3                   	ret
+
+0000000000802858 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802858:	48 85 ff             	test   %rdi,%rdi
+  80285b:	74 5f                	je     8028bc <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80285d:	55                   	push   %rbp
+  80285e:	48 89 e5             	mov    %rsp,%rbp
+  802861:	53                   	push   %rbx
+  802862:	48 83 ec 08          	sub    $0x8,%rsp
+  802866:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802869:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802870:	00 00 00 
+  802873:	ff d0                	call   *%rax
+  802875:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80287b:	77 45                	ja     8028c2 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80287d:	48 89 de             	mov    %rbx,%rsi
+  802880:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802887:	00 00 00 
+  80288a:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802896:	be 00 00 00 00       	mov    $0x0,%esi
+  80289b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8028a0:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028ac:	85 c0                	test   %eax,%eax
+  8028ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+        return -E_INVAL;
+  8028bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028c1:	c3                   	ret
+        return -E_INVAL;
+  8028c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c7:	eb ed                	jmp    8028b6 <devfile_receive_snapshot+0x5e>
+
+00000000008028c9 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8028c9:	55                   	push   %rbp
+  8028ca:	48 89 e5             	mov    %rsp,%rbp
+  8028cd:	41 55                	push   %r13
+  8028cf:	41 54                	push   %r12
+  8028d1:	53                   	push   %rbx
+  8028d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d6:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8028d9:	48 85 f6             	test   %rsi,%rsi
+  8028dc:	0f 94 c0             	sete   %al
+  8028df:	48 85 d2             	test   %rdx,%rdx
+  8028e2:	0f 94 c2             	sete   %dl
+  8028e5:	08 d0                	or     %dl,%al
+  8028e7:	0f 85 ad 00 00 00    	jne    80299a <devfile_send_snapshot+0xd1>
+  8028ed:	48 89 fb             	mov    %rdi,%rbx
+  8028f0:	49 89 f4             	mov    %rsi,%r12
+  8028f3:	48 85 ff             	test   %rdi,%rdi
+  8028f6:	0f 84 9e 00 00 00    	je     80299a <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8028fc:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802903:	00 00 00 
+  802906:	ff d0                	call   *%rax
+  802908:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80290e:	0f 87 8d 00 00 00    	ja     8029a1 <devfile_send_snapshot+0xd8>
+  802914:	4c 89 e7             	mov    %r12,%rdi
+  802917:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+  802923:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802929:	77 7d                	ja     8029a8 <devfile_send_snapshot+0xdf>
+  80292b:	4c 89 ef             	mov    %r13,%rdi
+  80292e:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802935:	00 00 00 
+  802938:	ff d0                	call   *%rax
+  80293a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802940:	77 6d                	ja     8029af <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802942:	48 89 de             	mov    %rbx,%rsi
+  802945:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80294c:	00 00 00 
+  80294f:	48 bb 38 0e 80 00 00 	movabs $0x800e38,%rbx
+  802956:	00 00 00 
+  802959:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  80295b:	4c 89 e6             	mov    %r12,%rsi
+  80295e:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802965:	00 00 00 
+  802968:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  80296a:	4c 89 ee             	mov    %r13,%rsi
+  80296d:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802974:	00 00 00 
+  802977:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802979:	be 00 00 00 00       	mov    $0x0,%esi
+  80297e:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802983:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+}
+  80298f:	48 83 c4 08          	add    $0x8,%rsp
+  802993:	5b                   	pop    %rbx
+  802994:	41 5c                	pop    %r12
+  802996:	41 5d                	pop    %r13
+  802998:	5d                   	pop    %rbp
+  802999:	c3                   	ret
+        return -E_INVAL;
+  80299a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299f:	eb ee                	jmp    80298f <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8029a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a6:	eb e7                	jmp    80298f <devfile_send_snapshot+0xc6>
+  8029a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ad:	eb e0                	jmp    80298f <devfile_send_snapshot+0xc6>
+  8029af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b4:	eb d9                	jmp    80298f <devfile_send_snapshot+0xc6>
+
+00000000008029b6 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8029b6:	48 85 ff             	test   %rdi,%rdi
+  8029b9:	0f 84 41 01 00 00    	je     802b00 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8029bf:	55                   	push   %rbp
+  8029c0:	48 89 e5             	mov    %rsp,%rbp
+  8029c3:	41 57                	push   %r15
+  8029c5:	41 56                	push   %r14
+  8029c7:	41 55                	push   %r13
+  8029c9:	41 54                	push   %r12
+  8029cb:	53                   	push   %rbx
+  8029cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d0:	49 89 fc             	mov    %rdi,%r12
+  8029d3:	49 89 f5             	mov    %rsi,%r13
+  8029d6:	48 89 d3             	mov    %rdx,%rbx
+  8029d9:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8029dc:	48 85 f6             	test   %rsi,%rsi
+  8029df:	0f 84 ff 00 00 00    	je     802ae4 <devfile_diff_snapshots+0x12e>
+  8029e5:	48 85 d2             	test   %rdx,%rdx
+  8029e8:	0f 84 fd 00 00 00    	je     802aeb <devfile_diff_snapshots+0x135>
+  8029ee:	48 85 c9             	test   %rcx,%rcx
+  8029f1:	0f 84 f4 00 00 00    	je     802aeb <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8029f7:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a09:	0f 87 e3 00 00 00    	ja     802af2 <devfile_diff_snapshots+0x13c>
+  802a0f:	4c 89 ef             	mov    %r13,%rdi
+  802a12:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802a19:	00 00 00 
+  802a1c:	ff d0                	call   *%rax
+  802a1e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a24:	0f 87 cf 00 00 00    	ja     802af9 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a2a:	4c 89 e6             	mov    %r12,%rsi
+  802a2d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a34:	00 00 00 
+  802a37:	4c 89 e7             	mov    %r12,%rdi
+  802a3a:	49 bf 38 0e 80 00 00 	movabs $0x800e38,%r15
+  802a41:	00 00 00 
+  802a44:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802a47:	4c 89 ee             	mov    %r13,%rsi
+  802a4a:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a51:	00 
+  802a52:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a55:	48 8b 03             	mov    (%rbx),%rax
+  802a58:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a5f:	00 
+  802a60:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a64:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a6b:	00 
+  802a6c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a70:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a77:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a78:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a82:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	78 43                	js     802ad5 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a92:	49 8b 04 24          	mov    (%r12),%rax
+  802a96:	48 89 03             	mov    %rax,(%rbx)
+  802a99:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a9e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802aa2:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802aa7:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802aab:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802ab0:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802ab4:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802ab8:	48 c1 e2 03          	shl    $0x3,%rdx
+  802abc:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802ac1:	4c 89 f7             	mov    %r14,%rdi
+  802ac4:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  802acb:	00 00 00 
+  802ace:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802ad0:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802ad5:	48 83 c4 08          	add    $0x8,%rsp
+  802ad9:	5b                   	pop    %rbx
+  802ada:	41 5c                	pop    %r12
+  802adc:	41 5d                	pop    %r13
+  802ade:	41 5e                	pop    %r14
+  802ae0:	41 5f                	pop    %r15
+  802ae2:	5d                   	pop    %rbp
+  802ae3:	c3                   	ret
+        return -E_INVAL;
+  802ae4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae9:	eb ea                	jmp    802ad5 <devfile_diff_snapshots+0x11f>
+  802aeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af0:	eb e3                	jmp    802ad5 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802af2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af7:	eb dc                	jmp    802ad5 <devfile_diff_snapshots+0x11f>
+  802af9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802afe:	eb d5                	jmp    802ad5 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802b00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b05:	c3                   	ret
+
+0000000000802b06 <devfile_delete_snapshot>:
+    if (!name) {
+  802b06:	48 85 ff             	test   %rdi,%rdi
+  802b09:	74 5f                	je     802b6a <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802b0b:	55                   	push   %rbp
+  802b0c:	48 89 e5             	mov    %rsp,%rbp
+  802b0f:	53                   	push   %rbx
+  802b10:	48 83 ec 08          	sub    $0x8,%rsp
+  802b14:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b17:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+  802b23:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b29:	77 45                	ja     802b70 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b2b:	48 89 de             	mov    %rbx,%rsi
+  802b2e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b35:	00 00 00 
+  802b38:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802b3f:	00 00 00 
+  802b42:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802b44:	be 00 00 00 00       	mov    $0x0,%esi
+  802b49:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b4e:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b61:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+        return -E_INVAL;
+  802b6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b6f:	c3                   	ret
+        return -E_INVAL;
+  802b70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b75:	eb ed                	jmp    802b64 <devfile_delete_snapshot+0x5e>
+
+0000000000802b77 <devfile_accept_snapshot>:
+    if (!name) {
+  802b77:	48 85 ff             	test   %rdi,%rdi
+  802b7a:	74 5f                	je     802bdb <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b7c:	55                   	push   %rbp
+  802b7d:	48 89 e5             	mov    %rsp,%rbp
+  802b80:	53                   	push   %rbx
+  802b81:	48 83 ec 08          	sub    $0x8,%rsp
+  802b85:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b88:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802b8f:	00 00 00 
+  802b92:	ff d0                	call   *%rax
+  802b94:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b9a:	77 45                	ja     802be1 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b9c:	48 89 de             	mov    %rbx,%rsi
+  802b9f:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ba6:	00 00 00 
+  802ba9:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802bb5:	be 00 00 00 00       	mov    $0x0,%esi
+  802bba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bbf:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bd9:	c9                   	leave
+  802bda:	c3                   	ret
+        return -E_INVAL;
+  802bdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802be0:	c3                   	ret
+        return -E_INVAL;
+  802be1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be6:	eb ed                	jmp    802bd5 <devfile_accept_snapshot+0x5e>
+
+0000000000802be8 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802be8:	48 85 ff             	test   %rdi,%rdi
+  802beb:	0f 84 9f 00 00 00    	je     802c90 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802bf1:	55                   	push   %rbp
+  802bf2:	48 89 e5             	mov    %rsp,%rbp
+  802bf5:	41 54                	push   %r12
+  802bf7:	53                   	push   %rbx
+  802bf8:	48 89 fb             	mov    %rdi,%rbx
+  802bfb:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802bfe:	48 85 f6             	test   %rsi,%rsi
+  802c01:	74 78                	je     802c7b <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802c03:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+  802c0f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c15:	77 6b                	ja     802c82 <devfile_create_snapshot+0x9a>
+  802c17:	4c 89 e7             	mov    %r12,%rdi
+  802c1a:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+  802c26:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c2c:	77 5b                	ja     802c89 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c2e:	48 89 de             	mov    %rbx,%rsi
+  802c31:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c38:	00 00 00 
+  802c3b:	48 bb 38 0e 80 00 00 	movabs $0x800e38,%rbx
+  802c42:	00 00 00 
+  802c45:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802c47:	4c 89 e6             	mov    %r12,%rsi
+  802c4a:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802c51:	00 00 00 
+  802c54:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c56:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c60:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c73:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c76:	5b                   	pop    %rbx
+  802c77:	41 5c                	pop    %r12
+  802c79:	5d                   	pop    %rbp
+  802c7a:	c3                   	ret
+        return -E_INVAL;
+  802c7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c80:	eb f4                	jmp    802c76 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c87:	eb ed                	jmp    802c76 <devfile_create_snapshot+0x8e>
+  802c89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8e:	eb e6                	jmp    802c76 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c95:	c3                   	ret
+
+0000000000802c96 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c96:	55                   	push   %rbp
+  802c97:	48 89 e5             	mov    %rsp,%rbp
+  802c9a:	41 54                	push   %r12
+  802c9c:	53                   	push   %rbx
+  802c9d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ca0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802ca3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802caa:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802cac:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb1:	bf 05 00 00 00       	mov    $0x5,%edi
+  802cb6:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cc2:	85 c0                	test   %eax,%eax
+  802cc4:	78 3d                	js     802d03 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802cc6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802ccd:	00 00 00 
+  802cd0:	4c 89 e6             	mov    %r12,%rsi
+  802cd3:	48 89 df             	mov    %rbx,%rdi
+  802cd6:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802cdd:	00 00 00 
+  802ce0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ce2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ce9:	00 
+  802cea:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802cf0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802cf7:	00 
+  802cf8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d03:	5b                   	pop    %rbx
+  802d04:	41 5c                	pop    %r12
+  802d06:	5d                   	pop    %rbp
+  802d07:	c3                   	ret
+
+0000000000802d08 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802d08:	55                   	push   %rbp
+  802d09:	48 89 e5             	mov    %rsp,%rbp
+  802d0c:	41 57                	push   %r15
+  802d0e:	41 56                	push   %r14
+  802d10:	41 55                	push   %r13
+  802d12:	41 54                	push   %r12
+  802d14:	53                   	push   %rbx
+  802d15:	48 83 ec 38          	sub    $0x38,%rsp
+  802d19:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802d1d:	49 89 f5             	mov    %rsi,%r13
+  802d20:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d23:	48 89 f0             	mov    %rsi,%rax
+  802d26:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d2b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d2f:	75 4f                	jne    802d80 <devfile_readmap+0x78>
+  802d31:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d35:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d3b:	75 1f                	jne    802d5c <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802d3d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d41:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d45:	49 be b3 35 80 00 00 	movabs $0x8035b3,%r14
+  802d4c:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d4f:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d56:	0f 87 9d 00 00 00    	ja     802df9 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d5c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d60:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d64:	4d 85 ff             	test   %r15,%r15
+  802d67:	0f 85 cf 00 00 00    	jne    802e3c <devfile_readmap+0x134>
+  802d6d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d71:	48 83 c4 38          	add    $0x38,%rsp
+  802d75:	5b                   	pop    %rbx
+  802d76:	41 5c                	pop    %r12
+  802d78:	41 5d                	pop    %r13
+  802d7a:	41 5e                	pop    %r14
+  802d7c:	41 5f                	pop    %r15
+  802d7e:	5d                   	pop    %rbp
+  802d7f:	c3                   	ret
+    size_t totalRead = 0;
+  802d80:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d87:	00 
+  802d88:	eb da                	jmp    802d64 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d8a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d8e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d91:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d98:	00 00 00 
+  802d9b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802da1:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802da5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802da9:	4c 89 ee             	mov    %r13,%rsi
+  802dac:	bf 14 00 00 00       	mov    $0x14,%edi
+  802db1:	48 b8 b6 24 80 00 00 	movabs $0x8024b6,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	7e a3                	jle    802d64 <devfile_readmap+0x5c>
+  802dc1:	48 98                	cltq
+  802dc3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802dc7:	72 9b                	jb     802d64 <devfile_readmap+0x5c>
+        buf += read;
+  802dc9:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802dcc:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802dcf:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dd3:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802dda:	75 88                	jne    802d64 <devfile_readmap+0x5c>
+  802ddc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802de0:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802de6:	0f 85 78 ff ff ff    	jne    802d64 <devfile_readmap+0x5c>
+  802dec:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802df3:	0f 86 6b ff ff ff    	jbe    802d64 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802df9:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802dff:	4d 39 e7             	cmp    %r12,%r15
+  802e02:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802e06:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802e0d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e11:	0f 84 73 ff ff ff    	je     802d8a <devfile_readmap+0x82>
+  802e17:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e1b:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802e20:	41 ff d6             	call   *%r14
+  802e23:	a8 40                	test   $0x40,%al
+  802e25:	0f 85 39 ff ff ff    	jne    802d64 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e2b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e32:	4c 39 e3             	cmp    %r12,%rbx
+  802e35:	72 e4                	jb     802e1b <devfile_readmap+0x113>
+  802e37:	e9 4e ff ff ff       	jmp    802d8a <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802e3c:	4c 89 fa             	mov    %r15,%rdx
+  802e3f:	4c 89 ee             	mov    %r13,%rsi
+  802e42:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e46:	48 b8 89 27 80 00 00 	movabs $0x802789,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e52:	48 85 c0             	test   %rax,%rax
+  802e55:	78 0c                	js     802e63 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e57:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e5b:	48 01 f0             	add    %rsi,%rax
+  802e5e:	e9 0e ff ff ff       	jmp    802d71 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e63:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e67:	48 85 f6             	test   %rsi,%rsi
+  802e6a:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e6e:	e9 fe fe ff ff       	jmp    802d71 <devfile_readmap+0x69>
+
+0000000000802e73 <open>:
+open(const char *path, int mode) {
+  802e73:	55                   	push   %rbp
+  802e74:	48 89 e5             	mov    %rsp,%rbp
+  802e77:	41 55                	push   %r13
+  802e79:	41 54                	push   %r12
+  802e7b:	53                   	push   %rbx
+  802e7c:	48 83 ec 18          	sub    $0x18,%rsp
+  802e80:	49 89 fc             	mov    %rdi,%r12
+  802e83:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e86:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  802e8d:	00 00 00 
+  802e90:	ff d0                	call   *%rax
+  802e92:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e98:	0f 87 8a 00 00 00    	ja     802f28 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e9e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ea2:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  802eae:	89 c3                	mov    %eax,%ebx
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	78 50                	js     802f04 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802eb4:	4c 89 e6             	mov    %r12,%rsi
+  802eb7:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ebe:	00 00 00 
+  802ec1:	48 89 df             	mov    %rbx,%rdi
+  802ec4:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ed0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ed7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802edb:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ee0:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802ee7:	00 00 00 
+  802eea:	ff d0                	call   *%rax
+  802eec:	89 c3                	mov    %eax,%ebx
+  802eee:	85 c0                	test   %eax,%eax
+  802ef0:	78 1f                	js     802f11 <open+0x9e>
+    return fd2num(fd);
+  802ef2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef6:	48 b8 a3 19 80 00 00 	movabs $0x8019a3,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+  802f02:	89 c3                	mov    %eax,%ebx
+}
+  802f04:	89 d8                	mov    %ebx,%eax
+  802f06:	48 83 c4 18          	add    $0x18,%rsp
+  802f0a:	5b                   	pop    %rbx
+  802f0b:	41 5c                	pop    %r12
+  802f0d:	41 5d                	pop    %r13
+  802f0f:	5d                   	pop    %rbp
+  802f10:	c3                   	ret
+        fd_close(fd, 0);
+  802f11:	be 00 00 00 00       	mov    $0x0,%esi
+  802f16:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f1a:	48 b8 ec 1a 80 00 00 	movabs $0x801aec,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+        return res;
+  802f26:	eb dc                	jmp    802f04 <open+0x91>
+        return -E_BAD_PATH;
+  802f28:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f2d:	eb d5                	jmp    802f04 <open+0x91>
+
+0000000000802f2f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f2f:	55                   	push   %rbp
+  802f30:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f33:	be 00 00 00 00       	mov    $0x0,%esi
+  802f38:	bf 13 00 00 00       	mov    $0x13,%edi
+  802f3d:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+}
+  802f49:	5d                   	pop    %rbp
+  802f4a:	c3                   	ret
+
+0000000000802f4b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f4b:	55                   	push   %rbp
+  802f4c:	48 89 e5             	mov    %rsp,%rbp
+  802f4f:	41 54                	push   %r12
+  802f51:	53                   	push   %rbx
+  802f52:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f55:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  802f5c:	00 00 00 
+  802f5f:	ff d0                	call   *%rax
+  802f61:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f64:	48 be c0 42 80 00 00 	movabs $0x8042c0,%rsi
+  802f6b:	00 00 00 
+  802f6e:	48 89 df             	mov    %rbx,%rdi
+  802f71:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  802f78:	00 00 00 
+  802f7b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f7d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f82:	41 2b 04 24          	sub    (%r12),%eax
+  802f86:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f8c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f93:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f96:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f9d:	00 00 00 
+  802fa0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fac:	5b                   	pop    %rbx
+  802fad:	41 5c                	pop    %r12
+  802faf:	5d                   	pop    %rbp
+  802fb0:	c3                   	ret
+
+0000000000802fb1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	41 54                	push   %r12
+  802fb7:	53                   	push   %rbx
+  802fb8:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fc0:	48 89 fe             	mov    %rdi,%rsi
+  802fc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc8:	49 bc 90 15 80 00 00 	movabs $0x801590,%r12
+  802fcf:	00 00 00 
+  802fd2:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fd5:	48 89 df             	mov    %rbx,%rdi
+  802fd8:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	48 89 c6             	mov    %rax,%rsi
+  802fe7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff1:	41 ff d4             	call   *%r12
+}
+  802ff4:	5b                   	pop    %rbx
+  802ff5:	41 5c                	pop    %r12
+  802ff7:	5d                   	pop    %rbp
+  802ff8:	c3                   	ret
+
+0000000000802ff9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ff9:	55                   	push   %rbp
+  802ffa:	48 89 e5             	mov    %rsp,%rbp
+  802ffd:	41 57                	push   %r15
+  802fff:	41 56                	push   %r14
+  803001:	41 55                	push   %r13
+  803003:	41 54                	push   %r12
+  803005:	53                   	push   %rbx
+  803006:	48 83 ec 18          	sub    $0x18,%rsp
+  80300a:	49 89 fc             	mov    %rdi,%r12
+  80300d:	49 89 f5             	mov    %rsi,%r13
+  803010:	49 89 d7             	mov    %rdx,%r15
+  803013:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803017:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  80301e:	00 00 00 
+  803021:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803023:	4d 85 ff             	test   %r15,%r15
+  803026:	0f 84 af 00 00 00    	je     8030db <devpipe_write+0xe2>
+  80302c:	48 89 c3             	mov    %rax,%rbx
+  80302f:	4c 89 f8             	mov    %r15,%rax
+  803032:	4d 89 ef             	mov    %r13,%r15
+  803035:	4c 01 e8             	add    %r13,%rax
+  803038:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80303c:	49 bd 98 14 80 00 00 	movabs $0x801498,%r13
+  803043:	00 00 00 
+            sys_yield();
+  803046:	49 be 35 14 80 00 00 	movabs $0x801435,%r14
+  80304d:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803050:	8b 73 04             	mov    0x4(%rbx),%esi
+  803053:	48 63 ce             	movslq %esi,%rcx
+  803056:	48 63 03             	movslq (%rbx),%rax
+  803059:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80305f:	48 39 c1             	cmp    %rax,%rcx
+  803062:	72 2e                	jb     803092 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803064:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803069:	48 89 da             	mov    %rbx,%rdx
+  80306c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803071:	4c 89 e7             	mov    %r12,%rdi
+  803074:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803077:	85 c0                	test   %eax,%eax
+  803079:	74 66                	je     8030e1 <devpipe_write+0xe8>
+            sys_yield();
+  80307b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80307e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803081:	48 63 ce             	movslq %esi,%rcx
+  803084:	48 63 03             	movslq (%rbx),%rax
+  803087:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80308d:	48 39 c1             	cmp    %rax,%rcx
+  803090:	73 d2                	jae    803064 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803092:	41 0f b6 3f          	movzbl (%r15),%edi
+  803096:	48 89 ca             	mov    %rcx,%rdx
+  803099:	48 c1 ea 03          	shr    $0x3,%rdx
+  80309d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8030a4:	08 10 20 
+  8030a7:	48 f7 e2             	mul    %rdx
+  8030aa:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030ae:	48 89 d0             	mov    %rdx,%rax
+  8030b1:	48 c1 e0 09          	shl    $0x9,%rax
+  8030b5:	48 29 d0             	sub    %rdx,%rax
+  8030b8:	48 c1 e0 03          	shl    $0x3,%rax
+  8030bc:	48 29 c1             	sub    %rax,%rcx
+  8030bf:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030c4:	83 c6 01             	add    $0x1,%esi
+  8030c7:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030ca:	49 83 c7 01          	add    $0x1,%r15
+  8030ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030d2:	49 39 c7             	cmp    %rax,%r15
+  8030d5:	0f 85 75 ff ff ff    	jne    803050 <devpipe_write+0x57>
+    return n;
+  8030db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030df:	eb 05                	jmp    8030e6 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030e6:	48 83 c4 18          	add    $0x18,%rsp
+  8030ea:	5b                   	pop    %rbx
+  8030eb:	41 5c                	pop    %r12
+  8030ed:	41 5d                	pop    %r13
+  8030ef:	41 5e                	pop    %r14
+  8030f1:	41 5f                	pop    %r15
+  8030f3:	5d                   	pop    %rbp
+  8030f4:	c3                   	ret
+
+00000000008030f5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030f5:	55                   	push   %rbp
+  8030f6:	48 89 e5             	mov    %rsp,%rbp
+  8030f9:	41 57                	push   %r15
+  8030fb:	41 56                	push   %r14
+  8030fd:	41 55                	push   %r13
+  8030ff:	41 54                	push   %r12
+  803101:	53                   	push   %rbx
+  803102:	48 83 ec 18          	sub    $0x18,%rsp
+  803106:	49 89 fc             	mov    %rdi,%r12
+  803109:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80310d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803111:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+  80311d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803120:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803126:	49 bd 98 14 80 00 00 	movabs $0x801498,%r13
+  80312d:	00 00 00 
+            sys_yield();
+  803130:	49 be 35 14 80 00 00 	movabs $0x801435,%r14
+  803137:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80313a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80313f:	74 7d                	je     8031be <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803141:	8b 03                	mov    (%rbx),%eax
+  803143:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803146:	75 26                	jne    80316e <devpipe_read+0x79>
+            if (i > 0) return i;
+  803148:	4d 85 ff             	test   %r15,%r15
+  80314b:	75 77                	jne    8031c4 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80314d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803152:	48 89 da             	mov    %rbx,%rdx
+  803155:	be 00 10 00 00       	mov    $0x1000,%esi
+  80315a:	4c 89 e7             	mov    %r12,%rdi
+  80315d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803160:	85 c0                	test   %eax,%eax
+  803162:	74 72                	je     8031d6 <devpipe_read+0xe1>
+            sys_yield();
+  803164:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803167:	8b 03                	mov    (%rbx),%eax
+  803169:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80316c:	74 df                	je     80314d <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80316e:	48 63 c8             	movslq %eax,%rcx
+  803171:	48 89 ca             	mov    %rcx,%rdx
+  803174:	48 c1 ea 03          	shr    $0x3,%rdx
+  803178:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80317f:	08 10 20 
+  803182:	48 89 d0             	mov    %rdx,%rax
+  803185:	48 f7 e6             	mul    %rsi
+  803188:	48 c1 ea 06          	shr    $0x6,%rdx
+  80318c:	48 89 d0             	mov    %rdx,%rax
+  80318f:	48 c1 e0 09          	shl    $0x9,%rax
+  803193:	48 29 d0             	sub    %rdx,%rax
+  803196:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80319d:	00 
+  80319e:	48 89 c8             	mov    %rcx,%rax
+  8031a1:	48 29 d0             	sub    %rdx,%rax
+  8031a4:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8031a9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8031ad:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8031b1:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8031b4:	49 83 c7 01          	add    $0x1,%r15
+  8031b8:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8031bc:	75 83                	jne    803141 <devpipe_read+0x4c>
+    return n;
+  8031be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031c2:	eb 03                	jmp    8031c7 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031c4:	4c 89 f8             	mov    %r15,%rax
+}
+  8031c7:	48 83 c4 18          	add    $0x18,%rsp
+  8031cb:	5b                   	pop    %rbx
+  8031cc:	41 5c                	pop    %r12
+  8031ce:	41 5d                	pop    %r13
+  8031d0:	41 5e                	pop    %r14
+  8031d2:	41 5f                	pop    %r15
+  8031d4:	5d                   	pop    %rbp
+  8031d5:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031db:	eb ea                	jmp    8031c7 <devpipe_read+0xd2>
+
+00000000008031dd <pipe>:
+pipe(int pfd[2]) {
+  8031dd:	55                   	push   %rbp
+  8031de:	48 89 e5             	mov    %rsp,%rbp
+  8031e1:	41 55                	push   %r13
+  8031e3:	41 54                	push   %r12
+  8031e5:	53                   	push   %rbx
+  8031e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8031ea:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031ed:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031f1:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	89 c3                	mov    %eax,%ebx
+  8031ff:	85 c0                	test   %eax,%eax
+  803201:	0f 88 a0 01 00 00    	js     8033a7 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803207:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80320c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803211:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80321a:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+  803226:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803228:	85 c0                	test   %eax,%eax
+  80322a:	0f 88 77 01 00 00    	js     8033a7 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803230:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803234:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  80323b:	00 00 00 
+  80323e:	ff d0                	call   *%rax
+  803240:	89 c3                	mov    %eax,%ebx
+  803242:	85 c0                	test   %eax,%eax
+  803244:	0f 88 43 01 00 00    	js     80338d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80324a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80324f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803254:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803258:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325d:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  803264:	00 00 00 
+  803267:	ff d0                	call   *%rax
+  803269:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	0f 88 1a 01 00 00    	js     80338d <pipe+0x1b0>
+    va = fd2data(fd0);
+  803273:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803277:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803286:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80328b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803290:	48 89 c6             	mov    %rax,%rsi
+  803293:	bf 00 00 00 00       	mov    $0x0,%edi
+  803298:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	89 c3                	mov    %eax,%ebx
+  8032a6:	85 c0                	test   %eax,%eax
+  8032a8:	0f 88 c5 00 00 00    	js     803373 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8032ae:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032b2:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  8032b9:	00 00 00 
+  8032bc:	ff d0                	call   *%rax
+  8032be:	48 89 c1             	mov    %rax,%rcx
+  8032c1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032c7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d2:	4c 89 ee             	mov    %r13,%rsi
+  8032d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032da:	48 b8 2b 15 80 00 00 	movabs $0x80152b,%rax
+  8032e1:	00 00 00 
+  8032e4:	ff d0                	call   *%rax
+  8032e6:	89 c3                	mov    %eax,%ebx
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	78 6e                	js     80335a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032f1:	4c 89 ef             	mov    %r13,%rdi
+  8032f4:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+  803300:	83 f8 02             	cmp    $0x2,%eax
+  803303:	0f 85 ab 00 00 00    	jne    8033b4 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803309:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803310:	00 00 
+  803312:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803316:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803318:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80331c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803323:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803327:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803329:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80332d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803334:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803338:	48 bb a3 19 80 00 00 	movabs $0x8019a3,%rbx
+  80333f:	00 00 00 
+  803342:	ff d3                	call   *%rbx
+  803344:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803348:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80334c:	ff d3                	call   *%rbx
+  80334e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803358:	eb 4d                	jmp    8033a7 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80335a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80335f:	4c 89 ee             	mov    %r13,%rsi
+  803362:	bf 00 00 00 00       	mov    $0x0,%edi
+  803367:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803373:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803378:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80337c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803381:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  803388:	00 00 00 
+  80338b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80338d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803392:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803396:	bf 00 00 00 00       	mov    $0x0,%edi
+  80339b:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+}
+  8033a7:	89 d8                	mov    %ebx,%eax
+  8033a9:	48 83 c4 18          	add    $0x18,%rsp
+  8033ad:	5b                   	pop    %rbx
+  8033ae:	41 5c                	pop    %r12
+  8033b0:	41 5d                	pop    %r13
+  8033b2:	5d                   	pop    %rbp
+  8033b3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8033b4:	48 b9 f0 42 80 00 00 	movabs $0x8042f0,%rcx
+  8033bb:	00 00 00 
+  8033be:	48 ba c7 42 80 00 00 	movabs $0x8042c7,%rdx
+  8033c5:	00 00 00 
+  8033c8:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033cd:	48 bf dc 42 80 00 00 	movabs $0x8042dc,%rdi
+  8033d4:	00 00 00 
+  8033d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033dc:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  8033e3:	00 00 00 
+  8033e6:	41 ff d0             	call   *%r8
+
+00000000008033e9 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033e9:	55                   	push   %rbp
+  8033ea:	48 89 e5             	mov    %rsp,%rbp
+  8033ed:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033f5:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  8033fc:	00 00 00 
+  8033ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803401:	85 c0                	test   %eax,%eax
+  803403:	78 35                	js     80343a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803405:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803409:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  803410:	00 00 00 
+  803413:	ff d0                	call   *%rax
+  803415:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803418:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80341d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803422:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803426:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  80342d:	00 00 00 
+  803430:	ff d0                	call   *%rax
+  803432:	85 c0                	test   %eax,%eax
+  803434:	0f 94 c0             	sete   %al
+  803437:	0f b6 c0             	movzbl %al,%eax
+}
+  80343a:	c9                   	leave
+  80343b:	c3                   	ret
+
+000000000080343c <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80343c:	55                   	push   %rbp
+  80343d:	48 89 e5             	mov    %rsp,%rbp
+  803440:	41 55                	push   %r13
+  803442:	41 54                	push   %r12
+  803444:	53                   	push   %rbx
+  803445:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803449:	85 ff                	test   %edi,%edi
+  80344b:	74 7d                	je     8034ca <wait+0x8e>
+  80344d:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803450:	89 f8                	mov    %edi,%eax
+  803452:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803457:	89 fa                	mov    %edi,%edx
+  803459:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80345f:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  803463:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  803467:	48 c1 e1 04          	shl    $0x4,%rcx
+  80346b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803472:	00 00 00 
+  803475:	48 01 ca             	add    %rcx,%rdx
+  803478:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80347e:	39 d7                	cmp    %edx,%edi
+  803480:	75 3d                	jne    8034bf <wait+0x83>
+           env->env_status != ENV_FREE) {
+  803482:	48 98                	cltq
+  803484:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803488:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80348c:	48 c1 e0 04          	shl    $0x4,%rax
+  803490:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803497:	00 00 00 
+  80349a:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  80349d:	49 bd 35 14 80 00 00 	movabs $0x801435,%r13
+  8034a4:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8034a7:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	74 0e                	je     8034bf <wait+0x83>
+        sys_yield();
+  8034b1:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8034b4:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8034ba:	44 39 e0             	cmp    %r12d,%eax
+  8034bd:	74 e8                	je     8034a7 <wait+0x6b>
+    }
+}
+  8034bf:	48 83 c4 08          	add    $0x8,%rsp
+  8034c3:	5b                   	pop    %rbx
+  8034c4:	41 5c                	pop    %r12
+  8034c6:	41 5d                	pop    %r13
+  8034c8:	5d                   	pop    %rbp
+  8034c9:	c3                   	ret
+    assert(envid != 0);
+  8034ca:	48 b9 14 43 80 00 00 	movabs $0x804314,%rcx
+  8034d1:	00 00 00 
+  8034d4:	48 ba c7 42 80 00 00 	movabs $0x8042c7,%rdx
+  8034db:	00 00 00 
+  8034de:	be 06 00 00 00       	mov    $0x6,%esi
+  8034e3:	48 bf 1f 43 80 00 00 	movabs $0x80431f,%rdi
+  8034ea:	00 00 00 
+  8034ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f2:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  8034f9:	00 00 00 
+  8034fc:	41 ff d0             	call   *%r8
+
+00000000008034ff <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034ff:	48 89 f8             	mov    %rdi,%rax
+  803502:	48 c1 e8 27          	shr    $0x27,%rax
+  803506:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80350d:	01 00 00 
+  803510:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803514:	f6 c2 01             	test   $0x1,%dl
+  803517:	74 6d                	je     803586 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803519:	48 89 f8             	mov    %rdi,%rax
+  80351c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803520:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803527:	01 00 00 
+  80352a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80352e:	f6 c2 01             	test   $0x1,%dl
+  803531:	74 62                	je     803595 <get_uvpt_entry+0x96>
+  803533:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80353a:	01 00 00 
+  80353d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803541:	f6 c2 80             	test   $0x80,%dl
+  803544:	75 4f                	jne    803595 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803546:	48 89 f8             	mov    %rdi,%rax
+  803549:	48 c1 e8 15          	shr    $0x15,%rax
+  80354d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803554:	01 00 00 
+  803557:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80355b:	f6 c2 01             	test   $0x1,%dl
+  80355e:	74 44                	je     8035a4 <get_uvpt_entry+0xa5>
+  803560:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803567:	01 00 00 
+  80356a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80356e:	f6 c2 80             	test   $0x80,%dl
+  803571:	75 31                	jne    8035a4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803573:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803577:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80357e:	01 00 00 
+  803581:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803585:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803586:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80358d:	01 00 00 
+  803590:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803594:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803595:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80359c:	01 00 00 
+  80359f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035a3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035a4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8035ab:	01 00 00 
+  8035ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035b2:	c3                   	ret
+
+00000000008035b3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8035b3:	55                   	push   %rbp
+  8035b4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035b7:	48 b8 ff 34 80 00 00 	movabs $0x8034ff,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+  8035c3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8035c6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8035cb:	89 c1                	mov    %eax,%ecx
+  8035cd:	83 c9 04             	or     $0x4,%ecx
+  8035d0:	f6 c2 01             	test   $0x1,%dl
+  8035d3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8035d6:	89 c1                	mov    %eax,%ecx
+  8035d8:	83 c9 02             	or     $0x2,%ecx
+  8035db:	f6 c2 02             	test   $0x2,%dl
+  8035de:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8035e1:	89 c1                	mov    %eax,%ecx
+  8035e3:	83 c9 01             	or     $0x1,%ecx
+  8035e6:	48 85 d2             	test   %rdx,%rdx
+  8035e9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8035ec:	89 c1                	mov    %eax,%ecx
+  8035ee:	83 c9 40             	or     $0x40,%ecx
+  8035f1:	f6 c6 04             	test   $0x4,%dh
+  8035f4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8035f7:	5d                   	pop    %rbp
+  8035f8:	c3                   	ret
+
+00000000008035f9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8035f9:	55                   	push   %rbp
+  8035fa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035fd:	48 b8 ff 34 80 00 00 	movabs $0x8034ff,%rax
+  803604:	00 00 00 
+  803607:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803609:	48 c1 e8 06          	shr    $0x6,%rax
+  80360d:	83 e0 01             	and    $0x1,%eax
+}
+  803610:	5d                   	pop    %rbp
+  803611:	c3                   	ret
+
+0000000000803612 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803612:	55                   	push   %rbp
+  803613:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803616:	48 b8 ff 34 80 00 00 	movabs $0x8034ff,%rax
+  80361d:	00 00 00 
+  803620:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803622:	48 c1 e8 05          	shr    $0x5,%rax
+  803626:	83 e0 01             	and    $0x1,%eax
+}
+  803629:	5d                   	pop    %rbp
+  80362a:	c3                   	ret
+
+000000000080362b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80362b:	55                   	push   %rbp
+  80362c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80362f:	48 b8 ff 34 80 00 00 	movabs $0x8034ff,%rax
+  803636:	00 00 00 
+  803639:	ff d0                	call   *%rax
+  80363b:	83 e0 01             	and    $0x1,%eax
+}
+  80363e:	5d                   	pop    %rbp
+  80363f:	c3                   	ret
+
+0000000000803640 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	41 57                	push   %r15
+  803646:	41 56                	push   %r14
+  803648:	41 55                	push   %r13
+  80364a:	41 54                	push   %r12
+  80364c:	53                   	push   %rbx
+  80364d:	48 83 ec 18          	sub    $0x18,%rsp
+  803651:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803655:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803659:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80365e:	49 bd 2b 36 80 00 00 	movabs $0x80362b,%r13
+  803665:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803668:	49 bf b3 35 80 00 00 	movabs $0x8035b3,%r15
+  80366f:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803672:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803679:	00 00 00 
+  80367c:	eb 0c                	jmp    80368a <foreach_shared_region+0x4a>
+  80367e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803685:	4c 39 f3             	cmp    %r14,%rbx
+  803688:	74 2e                	je     8036b8 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80368a:	48 89 df             	mov    %rbx,%rdi
+  80368d:	41 ff d5             	call   *%r13
+  803690:	84 c0                	test   %al,%al
+  803692:	74 ea                	je     80367e <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803694:	48 89 df             	mov    %rbx,%rdi
+  803697:	41 ff d7             	call   *%r15
+  80369a:	a8 40                	test   $0x40,%al
+  80369c:	74 e0                	je     80367e <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80369e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8036a9:	48 89 df             	mov    %rbx,%rdi
+  8036ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036b0:	ff d0                	call   *%rax
+				if (res < 0) {
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	79 c8                	jns    80367e <foreach_shared_region+0x3e>
+  8036b6:	eb 05                	jmp    8036bd <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8036b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036bd:	48 83 c4 18          	add    $0x18,%rsp
+  8036c1:	5b                   	pop    %rbx
+  8036c2:	41 5c                	pop    %r12
+  8036c4:	41 5d                	pop    %r13
+  8036c6:	41 5e                	pop    %r14
+  8036c8:	41 5f                	pop    %r15
+  8036ca:	5d                   	pop    %rbp
+  8036cb:	c3                   	ret
+
+00000000008036cc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8036cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d1:	c3                   	ret
+
+00000000008036d2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8036d2:	55                   	push   %rbp
+  8036d3:	48 89 e5             	mov    %rsp,%rbp
+  8036d6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8036d9:	48 be 2a 43 80 00 00 	movabs $0x80432a,%rsi
+  8036e0:	00 00 00 
+  8036e3:	48 b8 38 0e 80 00 00 	movabs $0x800e38,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+    return 0;
+}
+  8036ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f4:	5d                   	pop    %rbp
+  8036f5:	c3                   	ret
+
+00000000008036f6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+  8036fa:	41 57                	push   %r15
+  8036fc:	41 56                	push   %r14
+  8036fe:	41 55                	push   %r13
+  803700:	41 54                	push   %r12
+  803702:	53                   	push   %rbx
+  803703:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80370a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803711:	48 85 d2             	test   %rdx,%rdx
+  803714:	74 7a                	je     803790 <devcons_write+0x9a>
+  803716:	49 89 d6             	mov    %rdx,%r14
+  803719:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80371f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803724:	49 bf 32 10 80 00 00 	movabs $0x801032,%r15
+  80372b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80372e:	4c 89 f3             	mov    %r14,%rbx
+  803731:	48 29 f3             	sub    %rsi,%rbx
+  803734:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803739:	48 39 c3             	cmp    %rax,%rbx
+  80373c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803740:	4c 63 eb             	movslq %ebx,%r13
+  803743:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80374a:	48 01 c6             	add    %rax,%rsi
+  80374d:	4c 89 ea             	mov    %r13,%rdx
+  803750:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803757:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80375a:	4c 89 ee             	mov    %r13,%rsi
+  80375d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803764:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  80376b:	00 00 00 
+  80376e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803770:	41 01 dc             	add    %ebx,%r12d
+  803773:	49 63 f4             	movslq %r12d,%rsi
+  803776:	4c 39 f6             	cmp    %r14,%rsi
+  803779:	72 b3                	jb     80372e <devcons_write+0x38>
+    return res;
+  80377b:	49 63 c4             	movslq %r12d,%rax
+}
+  80377e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803785:	5b                   	pop    %rbx
+  803786:	41 5c                	pop    %r12
+  803788:	41 5d                	pop    %r13
+  80378a:	41 5e                	pop    %r14
+  80378c:	41 5f                	pop    %r15
+  80378e:	5d                   	pop    %rbp
+  80378f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803790:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803796:	eb e3                	jmp    80377b <devcons_write+0x85>
+
+0000000000803798 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803798:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80379b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037a0:	48 85 c0             	test   %rax,%rax
+  8037a3:	74 55                	je     8037fa <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8037a5:	55                   	push   %rbp
+  8037a6:	48 89 e5             	mov    %rsp,%rbp
+  8037a9:	41 55                	push   %r13
+  8037ab:	41 54                	push   %r12
+  8037ad:	53                   	push   %rbx
+  8037ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8037b5:	48 bb 68 13 80 00 00 	movabs $0x801368,%rbx
+  8037bc:	00 00 00 
+  8037bf:	49 bc 35 14 80 00 00 	movabs $0x801435,%r12
+  8037c6:	00 00 00 
+  8037c9:	eb 03                	jmp    8037ce <devcons_read+0x36>
+  8037cb:	41 ff d4             	call   *%r12
+  8037ce:	ff d3                	call   *%rbx
+  8037d0:	85 c0                	test   %eax,%eax
+  8037d2:	74 f7                	je     8037cb <devcons_read+0x33>
+    if (c < 0) return c;
+  8037d4:	48 63 d0             	movslq %eax,%rdx
+  8037d7:	78 13                	js     8037ec <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8037d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037de:	83 f8 04             	cmp    $0x4,%eax
+  8037e1:	74 09                	je     8037ec <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8037e3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8037e7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8037ec:	48 89 d0             	mov    %rdx,%rax
+  8037ef:	48 83 c4 08          	add    $0x8,%rsp
+  8037f3:	5b                   	pop    %rbx
+  8037f4:	41 5c                	pop    %r12
+  8037f6:	41 5d                	pop    %r13
+  8037f8:	5d                   	pop    %rbp
+  8037f9:	c3                   	ret
+  8037fa:	48 89 d0             	mov    %rdx,%rax
+  8037fd:	c3                   	ret
+
+00000000008037fe <cputchar>:
+cputchar(int ch) {
+  8037fe:	55                   	push   %rbp
+  8037ff:	48 89 e5             	mov    %rsp,%rbp
+  803802:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803806:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80380a:	be 01 00 00 00       	mov    $0x1,%esi
+  80380f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803813:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+}
+  80381f:	c9                   	leave
+  803820:	c3                   	ret
+
+0000000000803821 <getchar>:
+getchar(void) {
+  803821:	55                   	push   %rbp
+  803822:	48 89 e5             	mov    %rsp,%rbp
+  803825:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803829:	ba 01 00 00 00       	mov    $0x1,%edx
+  80382e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803832:	bf 00 00 00 00       	mov    $0x0,%edi
+  803837:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  80383e:	00 00 00 
+  803841:	ff d0                	call   *%rax
+  803843:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803845:	85 c0                	test   %eax,%eax
+  803847:	78 06                	js     80384f <getchar+0x2e>
+  803849:	74 08                	je     803853 <getchar+0x32>
+  80384b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80384f:	89 d0                	mov    %edx,%eax
+  803851:	c9                   	leave
+  803852:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803853:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803858:	eb f5                	jmp    80384f <getchar+0x2e>
+
+000000000080385a <iscons>:
+iscons(int fdnum) {
+  80385a:	55                   	push   %rbp
+  80385b:	48 89 e5             	mov    %rsp,%rbp
+  80385e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803862:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803866:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  80386d:	00 00 00 
+  803870:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803872:	85 c0                	test   %eax,%eax
+  803874:	78 18                	js     80388e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803876:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80387a:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803881:	00 00 00 
+  803884:	8b 00                	mov    (%rax),%eax
+  803886:	39 02                	cmp    %eax,(%rdx)
+  803888:	0f 94 c0             	sete   %al
+  80388b:	0f b6 c0             	movzbl %al,%eax
+}
+  80388e:	c9                   	leave
+  80388f:	c3                   	ret
+
+0000000000803890 <opencons>:
+opencons(void) {
+  803890:	55                   	push   %rbp
+  803891:	48 89 e5             	mov    %rsp,%rbp
+  803894:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803898:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80389c:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+  8038a8:	85 c0                	test   %eax,%eax
+  8038aa:	78 49                	js     8038f5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8038ac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038b6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8038ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038bf:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	78 26                	js     8038f5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8038cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038d3:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  8038da:	00 00 
+  8038dc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8038de:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038e2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8038e9:	48 b8 a3 19 80 00 00 	movabs $0x8019a3,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+}
+  8038f5:	c9                   	leave
+  8038f6:	c3                   	ret
+
+00000000008038f7 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+  8038fb:	41 55                	push   %r13
+  8038fd:	41 54                	push   %r12
+  8038ff:	53                   	push   %rbx
+  803900:	48 83 ec 08          	sub    $0x8,%rsp
+  803904:	49 89 fc             	mov    %rdi,%r12
+  803907:	48 89 f7             	mov    %rsi,%rdi
+  80390a:	48 89 d3             	mov    %rdx,%rbx
+  80390d:	49 89 cd             	mov    %rcx,%r13
+  803910:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803913:	48 85 f6             	test   %rsi,%rsi
+  803916:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80391d:	00 00 00 
+  803920:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803924:	be 00 10 00 00       	mov    $0x1000,%esi
+  803929:	48 85 db             	test   %rbx,%rbx
+  80392c:	74 03                	je     803931 <ipc_recv_timed+0x3a>
+  80392e:	48 8b 33             	mov    (%rbx),%rsi
+  803931:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  803938:	00 00 00 
+  80393b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80393d:	85 c0                	test   %eax,%eax
+  80393f:	78 75                	js     8039b6 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803941:	4d 85 e4             	test   %r12,%r12
+  803944:	74 14                	je     80395a <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803946:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  80394d:	00 00 00 
+  803950:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803956:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80395a:	4d 85 ed             	test   %r13,%r13
+  80395d:	74 14                	je     803973 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80395f:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  803966:	00 00 00 
+  803969:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80396f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803973:	48 85 db             	test   %rbx,%rbx
+  803976:	74 23                	je     80399b <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803978:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  80397f:	00 00 00 
+  803982:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80398d:	85 c9                	test   %ecx,%ecx
+  80398f:	74 07                	je     803998 <ipc_recv_timed+0xa1>
+  803991:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803998:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80399b:	48 a1 00 64 80 00 00 	movabs 0x806400,%rax
+  8039a2:	00 00 00 
+  8039a5:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8039ab:	48 83 c4 08          	add    $0x8,%rsp
+  8039af:	5b                   	pop    %rbx
+  8039b0:	41 5c                	pop    %r12
+  8039b2:	41 5d                	pop    %r13
+  8039b4:	5d                   	pop    %rbp
+  8039b5:	c3                   	ret
+        if (from_env_store != NULL) {
+  8039b6:	4d 85 e4             	test   %r12,%r12
+  8039b9:	74 08                	je     8039c3 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8039bb:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8039c2:	00 
+        if (perm_store != NULL) {
+  8039c3:	4d 85 ed             	test   %r13,%r13
+  8039c6:	74 08                	je     8039d0 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8039c8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8039cf:	00 
+        if (size != NULL) {
+  8039d0:	48 85 db             	test   %rbx,%rbx
+  8039d3:	74 d6                	je     8039ab <ipc_recv_timed+0xb4>
+            *size = 0;
+  8039d5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8039dc:	eb cd                	jmp    8039ab <ipc_recv_timed+0xb4>
+
+00000000008039de <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8039de:	55                   	push   %rbp
+  8039df:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8039e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8039e8:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+}
+  8039f4:	5d                   	pop    %rbp
+  8039f5:	c3                   	ret
+
+00000000008039f6 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8039f6:	55                   	push   %rbp
+  8039f7:	48 89 e5             	mov    %rsp,%rbp
+  8039fa:	41 57                	push   %r15
+  8039fc:	41 56                	push   %r14
+  8039fe:	41 55                	push   %r13
+  803a00:	41 54                	push   %r12
+  803a02:	53                   	push   %rbx
+  803a03:	48 83 ec 18          	sub    $0x18,%rsp
+  803a07:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803a0a:	48 89 d3             	mov    %rdx,%rbx
+  803a0d:	49 89 cc             	mov    %rcx,%r12
+  803a10:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803a13:	48 85 d2             	test   %rdx,%rdx
+  803a16:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a1d:	00 00 00 
+  803a20:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a24:	89 f0                	mov    %esi,%eax
+  803a26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803a2a:	48 89 da             	mov    %rbx,%rdx
+  803a2d:	48 89 c6             	mov    %rax,%rsi
+  803a30:	48 b8 32 17 80 00 00 	movabs $0x801732,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+    while (res < 0) {
+  803a3c:	85 c0                	test   %eax,%eax
+  803a3e:	79 65                	jns    803aa5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a40:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a43:	75 33                	jne    803a78 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803a45:	49 bf 35 14 80 00 00 	movabs $0x801435,%r15
+  803a4c:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a4f:	49 be 32 17 80 00 00 	movabs $0x801732,%r14
+  803a56:	00 00 00 
+        sys_yield();
+  803a59:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803a5c:	45 89 e8             	mov    %r13d,%r8d
+  803a5f:	4c 89 e1             	mov    %r12,%rcx
+  803a62:	48 89 da             	mov    %rbx,%rdx
+  803a65:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a69:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803a6c:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803a6f:	85 c0                	test   %eax,%eax
+  803a71:	79 32                	jns    803aa5 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a73:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a76:	74 e1                	je     803a59 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803a78:	89 c1                	mov    %eax,%ecx
+  803a7a:	48 ba 36 43 80 00 00 	movabs $0x804336,%rdx
+  803a81:	00 00 00 
+  803a84:	be 52 00 00 00       	mov    $0x52,%esi
+  803a89:	48 bf 4a 43 80 00 00 	movabs $0x80434a,%rdi
+  803a90:	00 00 00 
+  803a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a98:	49 b8 c3 03 80 00 00 	movabs $0x8003c3,%r8
+  803a9f:	00 00 00 
+  803aa2:	41 ff d0             	call   *%r8
+    }
+}
+  803aa5:	48 83 c4 18          	add    $0x18,%rsp
+  803aa9:	5b                   	pop    %rbx
+  803aaa:	41 5c                	pop    %r12
+  803aac:	41 5d                	pop    %r13
+  803aae:	41 5e                	pop    %r14
+  803ab0:	41 5f                	pop    %r15
+  803ab2:	5d                   	pop    %rbp
+  803ab3:	c3                   	ret
+
+0000000000803ab4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803ab9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803ac0:	00 00 00 
+  803ac3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803ac7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803acb:	48 c1 e2 04          	shl    $0x4,%rdx
+  803acf:	48 01 ca             	add    %rcx,%rdx
+  803ad2:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803ad8:	39 fa                	cmp    %edi,%edx
+  803ada:	74 12                	je     803aee <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803adc:	48 83 c0 01          	add    $0x1,%rax
+  803ae0:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803ae6:	75 db                	jne    803ac3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aed:	c3                   	ret
+            return envs[i].env_id;
+  803aee:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803af2:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803af6:	48 c1 e2 04          	shl    $0x4,%rdx
+  803afa:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803b01:	00 00 00 
+  803b04:	48 01 d0             	add    %rdx,%rax
+  803b07:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803b0d:	c3                   	ret
+  803b0e:	66 90                	xchg   %ax,%ax
+
+0000000000803b10 <__rodata_start>:
+  803b10:	6d                   	insl   (%dx),%es:(%rdi)
+  803b11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b12:	74 64                	je     803b78 <__rodata_start+0x68>
+  803b14:	00 6f 70             	add    %ch,0x70(%rdi)
+  803b17:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b19:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803b1c:	74 64                	je     803b82 <__rodata_start+0x72>
+  803b1e:	3a 20                	cmp    (%rax),%ah
+  803b20:	25 69 00 75 73       	and    $0x73750069,%eax
+  803b25:	65 72 2f             	gs jb  803b57 <__rodata_start+0x47>
+  803b28:	74 65                	je     803b8f <__rodata_start+0x7f>
+  803b2a:	73 74                	jae    803ba0 <__rodata_start+0x90>
+  803b2c:	66 64 73 68          	data16 fs jae 803b98 <__rodata_start+0x88>
+  803b30:	61                   	(bad)
+  803b31:	72 69                	jb     803b9c <__rodata_start+0x8c>
+  803b33:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b34:	67 2e 63 00          	cs movsxd (%eax),%eax
+  803b38:	72 65                	jb     803b9f <__rodata_start+0x8f>
+  803b3a:	61                   	(bad)
+  803b3b:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  803b3d:	3a 20                	cmp    (%rax),%ah
+  803b3f:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  803b44:	72 6b                	jb     803bb1 <__rodata_start+0xa1>
+  803b46:	3a 20                	cmp    (%rax),%ah
+  803b48:	25 69 00 72 65       	and    $0x65720069,%eax
+  803b4d:	61                   	(bad)
+  803b4e:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803b52:	20 63 68             	and    %ah,0x68(%rbx)
+  803b55:	69 6c 64 20 73 75 63 	imul   $0x63637573,0x20(%rsp,%riz,2),%ebp
+  803b5c:	63 
+  803b5d:	65 65 64 65 64 0a 00 	gs gs fs gs or %fs:(%rax),%al
+  803b64:	72 65                	jb     803bcb <__rodata_start+0xbb>
+  803b66:	61                   	(bad)
+  803b67:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803b6b:	20 70 61             	and    %dh,0x61(%rax)
+  803b6e:	72 65                	jb     803bd5 <__rodata_start+0xc5>
+  803b70:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b71:	74 20                	je     803b93 <__rodata_start+0x83>
+  803b73:	73 75                	jae    803bea <__rodata_start+0xda>
+  803b75:	63 63 65             	movsxd 0x65(%rbx),%esp
+  803b78:	65 64 65 64 0a 00    	gs fs gs or %fs:(%rax),%al
+  803b7e:	66 90                	xchg   %ax,%ax
+  803b80:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803b82:	69 6e 67 20 74 6f 20 	imul   $0x206f7420,0x67(%rsi),%ebp
+  803b89:	72 65                	jb     803bf0 <__rodata_start+0xe0>
+  803b8b:	61                   	(bad)
+  803b8c:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803b90:	20 63 68             	and    %ah,0x68(%rbx)
+  803b93:	69 6c 64 20 28 6d 69 	imul   $0x67696d28,0x20(%rsp,%riz,2),%ebp
+  803b9a:	67 
+  803b9b:	68 74 20 70 61       	push   $0x61702074
+  803ba0:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  803ba5:	75 6c                	jne    803c13 <__rodata_start+0x103>
+  803ba7:	74 20                	je     803bc9 <__rodata_start+0xb9>
+  803ba9:	69 66 20 79 6f 75 72 	imul   $0x72756f79,0x20(%rsi),%esp
+  803bb0:	20 73 68             	and    %dh,0x68(%rbx)
+  803bb3:	61                   	(bad)
+  803bb4:	72 69                	jb     803c1f <__rodata_start+0x10f>
+  803bb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb7:	67 20 69 73          	and    %ch,0x73(%ecx)
+  803bbb:	20 62 75             	and    %ah,0x75(%rdx)
+  803bbe:	67 67 79 29          	addr32 addr32 jns 803beb <__rodata_start+0xdb>
+  803bc2:	0a 00                	or     (%rax),%al
+  803bc4:	00 00                	add    %al,(%rax)
+  803bc6:	00 00                	add    %al,(%rax)
+  803bc8:	72 65                	jb     803c2f <__rodata_start+0x11f>
+  803bca:	61                   	(bad)
+  803bcb:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803bcf:	20 70 61             	and    %dh,0x61(%rax)
+  803bd2:	72 65                	jb     803c39 <__rodata_start+0x129>
+  803bd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bd5:	74 20                	je     803bf7 <__rodata_start+0xe7>
+  803bd7:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803bd9:	74 20                	je     803bfb <__rodata_start+0xeb>
+  803bdb:	25 64 2c 20 72       	and    $0x72202c64,%eax
+  803be0:	65 61                	gs (bad)
+  803be2:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803be6:	20 63 68             	and    %ah,0x68(%rbx)
+  803be9:	69 6c 64 20 67 6f 74 	imul   $0x20746f67,0x20(%rsp,%riz,2),%ebp
+  803bf0:	20 
+  803bf1:	25 64 00 00 00       	and    $0x64,%eax
+  803bf6:	00 00                	add    %al,(%rax)
+  803bf8:	72 65                	jb     803c5f <__rodata_start+0x14f>
+  803bfa:	61                   	(bad)
+  803bfb:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803bff:	20 70 61             	and    %dh,0x61(%rax)
+  803c02:	72 65                	jb     803c69 <__rodata_start+0x159>
+  803c04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c05:	74 20                	je     803c27 <__rodata_start+0x117>
+  803c07:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803c09:	74 20                	je     803c2b <__rodata_start+0x11b>
+  803c0b:	64 69 66 66 65 72 65 	imul   $0x6e657265,%fs:0x66(%rsi),%esp
+  803c12:	6e 
+  803c13:	74 20                	je     803c35 <__rodata_start+0x125>
+  803c15:	62                   	(bad)
+  803c16:	79 74                	jns    803c8c <__rodata_start+0x17c>
+  803c18:	65 73 20             	gs jae 803c3b <__rodata_start+0x12b>
+  803c1b:	66 72 6f             	data16 jb 803c8d <__rodata_start+0x17d>
+  803c1e:	6d                   	insl   (%dx),%es:(%rdi)
+  803c1f:	20 72 65             	and    %dh,0x65(%rdx)
+  803c22:	61                   	(bad)
+  803c23:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803c27:	20 63 68             	and    %ah,0x68(%rbx)
+  803c2a:	69 6c 64 00 00 00 72 	imul   $0x65720000,0x0(%rsp,%riz,2),%ebp
+  803c31:	65 
+  803c32:	61                   	(bad)
+  803c33:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803c37:	20 70 61             	and    %dh,0x61(%rax)
+  803c3a:	72 65                	jb     803ca1 <__rodata_start+0x191>
+  803c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c3d:	74 20                	je     803c5f <__rodata_start+0x14f>
+  803c3f:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803c41:	74 20                	je     803c63 <__rodata_start+0x153>
+  803c43:	25 64 2c 20 74       	and    $0x74202c64,%eax
+  803c48:	68 65 6e 20 67       	push   $0x67206e65
+  803c4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4e:	74 20                	je     803c70 <__rodata_start+0x160>
+  803c50:	25 64 00 3c 75       	and    $0x753c0064,%eax
+  803c55:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c56:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803c5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c5b:	3e 00 0f             	ds add %cl,(%rdi)
+  803c5e:	1f                   	(bad)
+  803c5f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803c62:	30 38                	xor    %bh,(%rax)
+  803c64:	78 5d                	js     803cc3 <__rodata_start+0x1b3>
+  803c66:	20 75 73             	and    %dh,0x73(%rbp)
+  803c69:	65 72 20             	gs jb  803c8c <__rodata_start+0x17c>
+  803c6c:	70 61                	jo     803ccf <__rodata_start+0x1bf>
+  803c6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c6f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803c76:	73 20                	jae    803c98 <__rodata_start+0x188>
+  803c78:	61                   	(bad)
+  803c79:	74 20                	je     803c9b <__rodata_start+0x18b>
+  803c7b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803c80:	3a 20                	cmp    (%rax),%ah
+  803c82:	00 30                	add    %dh,(%rax)
+  803c84:	31 32                	xor    %esi,(%rdx)
+  803c86:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c8d:	41                   	rex.B
+  803c8e:	42                   	rex.X
+  803c8f:	43                   	rex.XB
+  803c90:	44                   	rex.R
+  803c91:	45                   	rex.RB
+  803c92:	46 00 30             	rex.RX add %r14b,(%rax)
+  803c95:	31 32                	xor    %esi,(%rdx)
+  803c97:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c9e:	61                   	(bad)
+  803c9f:	62 63 64 65 66       	(bad)
+  803ca4:	00 28                	add    %ch,(%rax)
+  803ca6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ca7:	75 6c                	jne    803d15 <__rodata_start+0x205>
+  803ca9:	6c                   	insb   (%dx),%es:(%rdi)
+  803caa:	29 00                	sub    %eax,(%rax)
+  803cac:	65 72 72             	gs jb  803d21 <__rodata_start+0x211>
+  803caf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cb0:	72 20                	jb     803cd2 <__rodata_start+0x1c2>
+  803cb2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803cb7:	73 70                	jae    803d29 <__rodata_start+0x219>
+  803cb9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803cbd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803cc4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc5:	72 00                	jb     803cc7 <__rodata_start+0x1b7>
+  803cc7:	62 61 64 20 65       	(bad)
+  803ccc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ccd:	76 69                	jbe    803d38 <__rodata_start+0x228>
+  803ccf:	72 6f                	jb     803d40 <__rodata_start+0x230>
+  803cd1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cd2:	6d                   	insl   (%dx),%es:(%rdi)
+  803cd3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cd5:	74 00                	je     803cd7 <__rodata_start+0x1c7>
+  803cd7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803cde:	20 70 61             	and    %dh,0x61(%rax)
+  803ce1:	72 61                	jb     803d44 <__rodata_start+0x234>
+  803ce3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ce4:	65 74 65             	gs je  803d4c <__rodata_start+0x23c>
+  803ce7:	72 00                	jb     803ce9 <__rodata_start+0x1d9>
+  803ce9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cea:	75 74                	jne    803d60 <__rodata_start+0x250>
+  803cec:	20 6f 66             	and    %ch,0x66(%rdi)
+  803cef:	20 6d 65             	and    %ch,0x65(%rbp)
+  803cf2:	6d                   	insl   (%dx),%es:(%rdi)
+  803cf3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cf4:	72 79                	jb     803d6f <__rodata_start+0x25f>
+  803cf6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803cf9:	74 20                	je     803d1b <__rodata_start+0x20b>
+  803cfb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cfc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803d00:	76 69                	jbe    803d6b <__rodata_start+0x25b>
+  803d02:	72 6f                	jb     803d73 <__rodata_start+0x263>
+  803d04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d05:	6d                   	insl   (%dx),%es:(%rdi)
+  803d06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d08:	74 73                	je     803d7d <__rodata_start+0x26d>
+  803d0a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803d0d:	72 72                	jb     803d81 <__rodata_start+0x271>
+  803d0f:	75 70                	jne    803d81 <__rodata_start+0x271>
+  803d11:	74 65                	je     803d78 <__rodata_start+0x268>
+  803d13:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803d18:	75 67                	jne    803d81 <__rodata_start+0x271>
+  803d1a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803d1d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d1f:	00 73 65             	add    %dh,0x65(%rbx)
+  803d22:	67 6d                	insl   (%dx),%es:(%edi)
+  803d24:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d26:	74 61                	je     803d89 <__rodata_start+0x279>
+  803d28:	74 69                	je     803d93 <__rodata_start+0x283>
+  803d2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d2c:	20 66 61             	and    %ah,0x61(%rsi)
+  803d2f:	75 6c                	jne    803d9d <__rodata_start+0x28d>
+  803d31:	74 00                	je     803d33 <__rodata_start+0x223>
+  803d33:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803d3a:	20 45 4c             	and    %al,0x4c(%rbp)
+  803d3d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803d41:	61                   	(bad)
+  803d42:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803d47:	20 73 75             	and    %dh,0x75(%rbx)
+  803d4a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803d4d:	73 79                	jae    803dc8 <__rodata_start+0x2b8>
+  803d4f:	73 74                	jae    803dc5 <__rodata_start+0x2b5>
+  803d51:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803d53:	20 63 61             	and    %ah,0x61(%rbx)
+  803d56:	6c                   	insb   (%dx),%es:(%rdi)
+  803d57:	6c                   	insb   (%dx),%es:(%rdi)
+  803d58:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803d5b:	74 72                	je     803dcf <__rodata_start+0x2bf>
+  803d5d:	79 20                	jns    803d7f <__rodata_start+0x26f>
+  803d5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d61:	74 20                	je     803d83 <__rodata_start+0x273>
+  803d63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d65:	75 6e                	jne    803dd5 <__rodata_start+0x2c5>
+  803d67:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803d6b:	76 20                	jbe    803d8d <__rodata_start+0x27d>
+  803d6d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803d74:	72 65                	jb     803ddb <__rodata_start+0x2cb>
+  803d76:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803d79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d7a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803d7e:	65 78 70             	gs js  803df1 <__rodata_start+0x2e1>
+  803d81:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803d86:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803d89:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803d8d:	20 66 69             	and    %ah,0x69(%rsi)
+  803d90:	6c                   	insb   (%dx),%es:(%rdi)
+  803d91:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803d95:	20 66 72             	and    %ah,0x72(%rsi)
+  803d98:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803d9d:	61                   	(bad)
+  803d9e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803da1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803da2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803da3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803da7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803daa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dac:	20 6d 61             	and    %ch,0x61(%rbp)
+  803daf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803db0:	79 20                	jns    803dd2 <__rodata_start+0x2c2>
+  803db2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803db9:	72 65                	jb     803e20 <__rodata_start+0x310>
+  803dbb:	20 6f 70             	and    %ch,0x70(%rdi)
+  803dbe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803dc0:	00 66 69             	add    %ah,0x69(%rsi)
+  803dc3:	6c                   	insb   (%dx),%es:(%rdi)
+  803dc4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803dc8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803dcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dcc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803dcf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803dd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dd1:	74 20                	je     803df3 <__rodata_start+0x2e3>
+  803dd3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803dd5:	75 6e                	jne    803e45 <__rodata_start+0x335>
+  803dd7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803ddb:	76 61                	jbe    803e3e <__rodata_start+0x32e>
+  803ddd:	6c                   	insb   (%dx),%es:(%rdi)
+  803dde:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803de5:	00 
+  803de6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803ded:	72 65                	jb     803e54 <__rodata_start+0x344>
+  803def:	61                   	(bad)
+  803df0:	64 79 20             	fs jns 803e13 <__rodata_start+0x303>
+  803df3:	65 78 69             	gs js  803e5f <__rodata_start+0x34f>
+  803df6:	73 74                	jae    803e6c <__rodata_start+0x35c>
+  803df8:	73 00                	jae    803dfa <__rodata_start+0x2ea>
+  803dfa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dfb:	70 65                	jo     803e62 <__rodata_start+0x352>
+  803dfd:	72 61                	jb     803e60 <__rodata_start+0x350>
+  803dff:	74 69                	je     803e6a <__rodata_start+0x35a>
+  803e01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e03:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803e06:	74 20                	je     803e28 <__rodata_start+0x318>
+  803e08:	73 75                	jae    803e7f <__rodata_start+0x36f>
+  803e0a:	70 70                	jo     803e7c <__rodata_start+0x36c>
+  803e0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e0d:	72 74                	jb     803e83 <__rodata_start+0x373>
+  803e0f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803e15:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803e1a:	74 00                	je     803e1c <__rodata_start+0x30c>
+  803e1c:	0f 1f 40 00          	nopl   0x0(%rax)
+  803e20:	00 07                	add    %al,(%rdi)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 41 0d             	add    %al,0xd(%rcx)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 31                	add    %dh,(%rcx)
+  803e31:	0d 80 00 00 00       	or     $0x80,%eax
+  803e36:	00 00                	add    %al,(%rax)
+  803e38:	41 0d 80 00 00 00    	rex.B or $0x80,%eax
+  803e3e:	00 00                	add    %al,(%rax)
+  803e40:	41 0d 80 00 00 00    	rex.B or $0x80,%eax
+  803e46:	00 00                	add    %al,(%rax)
+  803e48:	41 0d 80 00 00 00    	rex.B or $0x80,%eax
+  803e4e:	00 00                	add    %al,(%rax)
+  803e50:	41 0d 80 00 00 00    	rex.B or $0x80,%eax
+  803e56:	00 00                	add    %al,(%rax)
+  803e58:	1f                   	(bad)
+  803e59:	07                   	(bad)
+  803e5a:	80 00 00             	addb   $0x0,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 41 0d             	add    %al,0xd(%rcx)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 41 0d             	add    %al,0xd(%rcx)
+  803e6a:	80 00 00             	addb   $0x0,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 13                	add    %dl,(%rbx)
+  803e71:	07                   	(bad)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 8d 07 80 00 00    	add    %cl,0x8007(%rbp)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 41 0d             	add    %al,0xd(%rcx)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 13                	add    %dl,(%rbx)
+  803e89:	07                   	(bad)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 59 07             	add    %bl,0x7(%rcx)
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 59 07             	add    %bl,0x7(%rcx)
+  803e9a:	80 00 00             	addb   $0x0,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 59 07             	add    %bl,0x7(%rcx)
+  803ea2:	80 00 00             	addb   $0x0,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 59 07             	add    %bl,0x7(%rcx)
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 59 07             	add    %bl,0x7(%rcx)
+  803eb2:	80 00 00             	addb   $0x0,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 59 07             	add    %bl,0x7(%rcx)
+  803eba:	80 00 00             	addb   $0x0,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 59 07             	add    %bl,0x7(%rcx)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 59 07             	add    %bl,0x7(%rcx)
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 59 07             	add    %bl,0x7(%rcx)
+  803ed2:	80 00 00             	addb   $0x0,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 41 0d             	add    %al,0xd(%rcx)
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 41 0d             	add    %al,0xd(%rcx)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 41 0d             	add    %al,0xd(%rcx)
+  803eea:	80 00 00             	addb   $0x0,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 41 0d             	add    %al,0xd(%rcx)
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 41 0d             	add    %al,0xd(%rcx)
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 41 0d             	add    %al,0xd(%rcx)
+  803f02:	80 00 00             	addb   $0x0,(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 41 0d             	add    %al,0xd(%rcx)
+  803f0a:	80 00 00             	addb   $0x0,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 41 0d             	add    %al,0xd(%rcx)
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f22:	80 00 00             	addb   $0x0,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 41 0d             	add    %al,0xd(%rcx)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f32:	80 00 00             	addb   $0x0,(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 41 0d             	add    %al,0xd(%rcx)
+  803f3a:	80 00 00             	addb   $0x0,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 41 0d             	add    %al,0xd(%rcx)
+  803f4a:	80 00 00             	addb   $0x0,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f52:	80 00 00             	addb   $0x0,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 41 0d             	add    %al,0xd(%rcx)
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f62:	80 00 00             	addb   $0x0,(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 41 0d             	add    %al,0xd(%rcx)
+  803f6a:	80 00 00             	addb   $0x0,(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f72:	80 00 00             	addb   $0x0,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 41 0d             	add    %al,0xd(%rcx)
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f82:	80 00 00             	addb   $0x0,(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 41 0d             	add    %al,0xd(%rcx)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 41 0d             	add    %al,0xd(%rcx)
+  803f92:	80 00 00             	addb   $0x0,(%rax)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 41 0d             	add    %al,0xd(%rcx)
+  803f9a:	80 00 00             	addb   $0x0,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 41 0d             	add    %al,0xd(%rcx)
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 41 0d             	add    %al,0xd(%rcx)
+  803faa:	80 00 00             	addb   $0x0,(%rax)
+  803fad:	00 00                	add    %al,(%rax)
+  803faf:	00 41 0d             	add    %al,0xd(%rcx)
+  803fb2:	80 00 00             	addb   $0x0,(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 41 0d             	add    %al,0xd(%rcx)
+  803fba:	80 00 00             	addb   $0x0,(%rax)
+  803fbd:	00 00                	add    %al,(%rax)
+  803fbf:	00 41 0d             	add    %al,0xd(%rcx)
+  803fc2:	80 00 00             	addb   $0x0,(%rax)
+  803fc5:	00 00                	add    %al,(%rax)
+  803fc7:	00 64 0c 80          	add    %ah,-0x80(%rsp,%rcx,1)
+  803fcb:	00 00                	add    %al,(%rax)
+  803fcd:	00 00                	add    %al,(%rax)
+  803fcf:	00 41 0d             	add    %al,0xd(%rcx)
+  803fd2:	80 00 00             	addb   $0x0,(%rax)
+  803fd5:	00 00                	add    %al,(%rax)
+  803fd7:	00 41 0d             	add    %al,0xd(%rcx)
+  803fda:	80 00 00             	addb   $0x0,(%rax)
+  803fdd:	00 00                	add    %al,(%rax)
+  803fdf:	00 41 0d             	add    %al,0xd(%rcx)
+  803fe2:	80 00 00             	addb   $0x0,(%rax)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 41 0d             	add    %al,0xd(%rcx)
+  803fea:	80 00 00             	addb   $0x0,(%rax)
+  803fed:	00 00                	add    %al,(%rax)
+  803fef:	00 41 0d             	add    %al,0xd(%rcx)
+  803ff2:	80 00 00             	addb   $0x0,(%rax)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 41 0d             	add    %al,0xd(%rcx)
+  803ffa:	80 00 00             	addb   $0x0,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 41 0d             	add    %al,0xd(%rcx)
+  804002:	80 00 00             	addb   $0x0,(%rax)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 41 0d             	add    %al,0xd(%rcx)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 41 0d             	add    %al,0xd(%rcx)
+  804012:	80 00 00             	addb   $0x0,(%rax)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 41 0d             	add    %al,0xd(%rcx)
+  80401a:	80 00 00             	addb   $0x0,(%rax)
+  80401d:	00 00                	add    %al,(%rax)
+  80401f:	00 b0 07 80 00 00    	add    %dh,0x8007(%rax)
+  804025:	00 00                	add    %al,(%rax)
+  804027:	00 7f 09             	add    %bh,0x9(%rdi)
+  80402a:	80 00 00             	addb   $0x0,(%rax)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 41 0d             	add    %al,0xd(%rcx)
+  804032:	80 00 00             	addb   $0x0,(%rax)
+  804035:	00 00                	add    %al,(%rax)
+  804037:	00 41 0d             	add    %al,0xd(%rcx)
+  80403a:	80 00 00             	addb   $0x0,(%rax)
+  80403d:	00 00                	add    %al,(%rax)
+  80403f:	00 41 0d             	add    %al,0xd(%rcx)
+  804042:	80 00 00             	addb   $0x0,(%rax)
+  804045:	00 00                	add    %al,(%rax)
+  804047:	00 41 0d             	add    %al,0xd(%rcx)
+  80404a:	80 00 00             	addb   $0x0,(%rax)
+  80404d:	00 00                	add    %al,(%rax)
+  80404f:	00 df                	add    %bl,%bh
+  804051:	07                   	(bad)
+  804052:	80 00 00             	addb   $0x0,(%rax)
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 41 0d             	add    %al,0xd(%rcx)
+  80405a:	80 00 00             	addb   $0x0,(%rax)
+  80405d:	00 00                	add    %al,(%rax)
+  80405f:	00 41 0d             	add    %al,0xd(%rcx)
+  804062:	80 00 00             	addb   $0x0,(%rax)
+  804065:	00 00                	add    %al,(%rax)
+  804067:	00 a5 07 80 00 00    	add    %ah,0x8007(%rbp)
+  80406d:	00 00                	add    %al,(%rax)
+  80406f:	00 41 0d             	add    %al,0xd(%rcx)
+  804072:	80 00 00             	addb   $0x0,(%rax)
+  804075:	00 00                	add    %al,(%rax)
+  804077:	00 41 0d             	add    %al,0xd(%rcx)
+  80407a:	80 00 00             	addb   $0x0,(%rax)
+  80407d:	00 00                	add    %al,(%rax)
+  80407f:	00 27                	add    %ah,(%rdi)
+  804081:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804087:	00 f1                	add    %dh,%cl
+  804089:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80408f:	00 41 0d             	add    %al,0xd(%rcx)
+  804092:	80 00 00             	addb   $0x0,(%rax)
+  804095:	00 00                	add    %al,(%rax)
+  804097:	00 41 0d             	add    %al,0xd(%rcx)
+  80409a:	80 00 00             	addb   $0x0,(%rax)
+  80409d:	00 00                	add    %al,(%rax)
+  80409f:	00 76 08             	add    %dh,0x8(%rsi)
+  8040a2:	80 00 00             	addb   $0x0,(%rax)
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 41 0d             	add    %al,0xd(%rcx)
+  8040aa:	80 00 00             	addb   $0x0,(%rax)
+  8040ad:	00 00                	add    %al,(%rax)
+  8040af:	00 53 0a             	add    %dl,0xa(%rbx)
+  8040b2:	80 00 00             	addb   $0x0,(%rax)
+  8040b5:	00 00                	add    %al,(%rax)
+  8040b7:	00 41 0d             	add    %al,0xd(%rcx)
+  8040ba:	80 00 00             	addb   $0x0,(%rax)
+  8040bd:	00 00                	add    %al,(%rax)
+  8040bf:	00 41 0d             	add    %al,0xd(%rcx)
+  8040c2:	80 00 00             	addb   $0x0,(%rax)
+  8040c5:	00 00                	add    %al,(%rax)
+  8040c7:	00 64 0c 80          	add    %ah,-0x80(%rsp,%rcx,1)
+  8040cb:	00 00                	add    %al,(%rax)
+  8040cd:	00 00                	add    %al,(%rax)
+  8040cf:	00 41 0d             	add    %al,0xd(%rcx)
+  8040d2:	80 00 00             	addb   $0x0,(%rax)
+  8040d5:	00 00                	add    %al,(%rax)
+  8040d7:	00 09                	add    %cl,(%rcx)
+  8040d9:	07                   	(bad)
+  8040da:	80 00 00             	addb   $0x0,(%rax)
+  8040dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008040e0 <error_string>:
+	...
+  8040e8:	b5 3c 80 00 00 00 00 00 c7 3c 80 00 00 00 00 00     .<.......<......
+  8040f8:	d7 3c 80 00 00 00 00 00 e9 3c 80 00 00 00 00 00     .<.......<......
+  804108:	f7 3c 80 00 00 00 00 00 0b 3d 80 00 00 00 00 00     .<.......=......
+  804118:	20 3d 80 00 00 00 00 00 33 3d 80 00 00 00 00 00      =......3=......
+  804128:	45 3d 80 00 00 00 00 00 59 3d 80 00 00 00 00 00     E=......Y=......
+  804138:	69 3d 80 00 00 00 00 00 7c 3d 80 00 00 00 00 00     i=......|=......
+  804148:	93 3d 80 00 00 00 00 00 a9 3d 80 00 00 00 00 00     .=.......=......
+  804158:	c1 3d 80 00 00 00 00 00 d9 3d 80 00 00 00 00 00     .=.......=......
+  804168:	e6 3d 80 00 00 00 00 00 88 41 80 00 00 00 00 00     .=.......A......
+  804178:	fa 3d 80 00 00 00 00 00 12 3e 80 00 00 00 00 00     .=.......>......
+  804188:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804198:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8041a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8041b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8041c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8041d8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8041e8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8041f8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804208:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804218:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804228:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804238:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804248:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804258:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804268:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804278:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804288:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804298:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008042a0 <devtab>:
+  8042a0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  8042b0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  8042c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8042d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8042e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8042f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804300:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804310:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  804320:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  804330:	00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64 20 65     .cons.ipc_send e
+  804340:	72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 69 70     rror: %i..lib/ip
+  804350:	63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     c.c.f.........f.
+  804360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
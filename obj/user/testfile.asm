@@ -0,0 +1,8555 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 93 0e 00 00       	call   800eb6 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+
+#define FVA ((struct Fd *)0xA000000)
+#define MAPVA ((char *)0xB000000)
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <check_big>:
+    return ipc_recv(NULL, MAPVA, size, perm);
+}
+
+static void
+check_big(const char *what, const char *data, size_t len) {
+    for (size_t i = 0; i < len; i += 512) {
+  8000b8:	48 85 d2             	test   %rdx,%rdx
+  8000bb:	0f 84 ce 00 00 00    	je     80018f <check_big+0xd7>
+check_big(const char *what, const char *data, size_t len) {
+  8000c1:	55                   	push   %rbp
+  8000c2:	48 89 e5             	mov    %rsp,%rbp
+  8000c5:	41 57                	push   %r15
+  8000c7:	41 56                	push   %r14
+  8000c9:	41 55                	push   %r13
+  8000cb:	41 54                	push   %r12
+  8000cd:	53                   	push   %rbx
+  8000ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8000d2:	49 89 fe             	mov    %rdi,%r14
+  8000d5:	49 89 f5             	mov    %rsi,%r13
+  8000d8:	49 89 d4             	mov    %rdx,%r12
+    for (size_t i = 0; i < len; i += 512) {
+  8000db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+        if (*(int *)(data + i) != i)
+  8000e1:	47 8b 4c 05 00       	mov    0x0(%r13,%r8,1),%r9d
+  8000e6:	49 63 c1             	movslq %r9d,%rax
+  8000e9:	4c 39 c0             	cmp    %r8,%rax
+  8000ec:	75 42                	jne    800130 <check_big+0x78>
+    for (size_t i = 0; i < len; i += 512) {
+  8000ee:	49 81 c0 00 02 00 00 	add    $0x200,%r8
+  8000f5:	4d 39 e0             	cmp    %r12,%r8
+  8000f8:	72 e7                	jb     8000e1 <check_big+0x29>
+            panic("%s /big from %ld returned bad data %d", what, (long)i, *(int *)(data + i));
+    }
+    for (size_t i = 0; i < len; i += PAGE_SIZE) {
+  8000fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (get_prot((void *)(data + i)) & PROT_W)
+  8000ff:	49 bf bc 41 80 00 00 	movabs $0x8041bc,%r15
+  800106:	00 00 00 
+  800109:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  80010e:	41 ff d7             	call   *%r15
+  800111:	a8 02                	test   $0x2,%al
+  800113:	75 49                	jne    80015e <check_big+0xa6>
+    for (size_t i = 0; i < len; i += PAGE_SIZE) {
+  800115:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80011c:	4c 39 e3             	cmp    %r12,%rbx
+  80011f:	72 e8                	jb     800109 <check_big+0x51>
+            panic("%s /big mapped a writable page at %ld", what, (long)i);
+    }
+}
+  800121:	48 83 c4 08          	add    $0x8,%rsp
+  800125:	5b                   	pop    %rbx
+  800126:	41 5c                	pop    %r12
+  800128:	41 5d                	pop    %r13
+  80012a:	41 5e                	pop    %r14
+  80012c:	41 5f                	pop    %r15
+  80012e:	5d                   	pop    %rbp
+  80012f:	c3                   	ret
+            panic("%s /big from %ld returned bad data %d", what, (long)i, *(int *)(data + i));
+  800130:	4c 89 f1             	mov    %r14,%rcx
+  800133:	48 ba 00 45 80 00 00 	movabs $0x804500,%rdx
+  80013a:	00 00 00 
+  80013d:	be 28 00 00 00       	mov    $0x28,%esi
+  800142:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800149:	00 00 00 
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800151:	49 ba 87 0f 80 00 00 	movabs $0x800f87,%r10
+  800158:	00 00 00 
+  80015b:	41 ff d2             	call   *%r10
+            panic("%s /big mapped a writable page at %ld", what, (long)i);
+  80015e:	49 89 d8             	mov    %rbx,%r8
+  800161:	4c 89 f1             	mov    %r14,%rcx
+  800164:	48 ba 28 45 80 00 00 	movabs $0x804528,%rdx
+  80016b:	00 00 00 
+  80016e:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800173:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  80017a:	00 00 00 
+  80017d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800182:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800189:	00 00 00 
+  80018c:	41 ff d1             	call   *%r9
+  80018f:	c3                   	ret
+
+0000000000800190 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 55                	push   %r13
+  800196:	41 54                	push   %r12
+  800198:	53                   	push   %rbx
+  800199:	48 81 ec b8 02 00 00 	sub    $0x2b8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8001a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a5:	48 bf ce 47 80 00 00 	movabs $0x8047ce,%rdi
+  8001ac:	00 00 00 
+  8001af:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	48 63 c8             	movslq %eax,%rcx
+  8001be:	48 85 c9             	test   %rcx,%rcx
+  8001c1:	0f 89 94 07 00 00    	jns    80095b <umain+0x7cb>
+  8001c7:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8001cb:	0f 85 5f 07 00 00    	jne    800930 <umain+0x7a0>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8001d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d6:	48 bf f4 47 80 00 00 	movabs $0x8047f4,%rdi
+  8001dd:	00 00 00 
+  8001e0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+  8001ec:	48 63 c8             	movslq %eax,%rcx
+  8001ef:	48 85 c9             	test   %rcx,%rcx
+  8001f2:	0f 88 8d 07 00 00    	js     800985 <umain+0x7f5>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8001f8:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  8001ff:	66 
+  800200:	0f 85 aa 07 00 00    	jne    8009b0 <umain+0x820>
+  800206:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  80020d:	00 
+  80020e:	0f 85 9c 07 00 00    	jne    8009b0 <umain+0x820>
+  800214:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  80021b:	00 
+  80021c:	0f 85 8e 07 00 00    	jne    8009b0 <umain+0x820>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  800222:	48 bf 16 48 80 00 00 	movabs $0x804816,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  800238:	00 00 00 
+  80023b:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  80023d:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800244:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800249:	48 a1 50 60 80 00 00 	movabs 0x806050,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+  800255:	48 63 c8             	movslq %eax,%rcx
+  800258:	48 85 c9             	test   %rcx,%rcx
+  80025b:	0f 88 79 07 00 00    	js     8009da <umain+0x84a>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  800261:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800268:	00 00 00 
+  80026b:	48 8b 38             	mov    (%rax),%rdi
+  80026e:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  800275:	00 00 00 
+  800278:	ff d0                	call   *%rax
+  80027a:	48 89 c2             	mov    %rax,%rdx
+  80027d:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  800281:	48 39 c2             	cmp    %rax,%rdx
+  800284:	0f 85 7b 07 00 00    	jne    800a05 <umain+0x875>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  80028a:	48 bf 39 48 80 00 00 	movabs $0x804839,%rdi
+  800291:	00 00 00 
+  800294:	b8 00 00 00 00       	mov    $0x0,%eax
+  800299:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  8002a0:	00 00 00 
+  8002a3:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8002a5:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8002af:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8002b6:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002c2:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002c7:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8002ce:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8002d3:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+  8002df:	48 85 c0             	test   %rax,%rax
+  8002e2:	0f 88 68 07 00 00    	js     800a50 <umain+0x8c0>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8002e8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002ef:	00 00 00 
+  8002f2:	48 8b 30             	mov    (%rax),%rsi
+  8002f5:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8002fc:	48 b8 a0 1a 80 00 00 	movabs $0x801aa0,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+  800308:	85 c0                	test   %eax,%eax
+  80030a:	0f 85 6e 07 00 00    	jne    800a7e <umain+0x8ee>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  800310:	48 bf 79 48 80 00 00 	movabs $0x804879,%rdi
+  800317:	00 00 00 
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  800326:	00 00 00 
+  800329:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  80032b:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800330:	48 a1 48 60 80 00 00 	movabs 0x806048,%rax
+  800337:	00 00 00 
+  80033a:	ff d0                	call   *%rax
+  80033c:	48 63 c8             	movslq %eax,%rcx
+  80033f:	48 85 c9             	test   %rcx,%rcx
+  800342:	0f 88 60 07 00 00    	js     800aa8 <umain+0x918>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  800348:	48 bf 9c 48 80 00 00 	movabs $0x80489c,%rdi
+  80034f:	00 00 00 
+  800352:	b8 00 00 00 00       	mov    $0x0,%eax
+  800357:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  80035e:	00 00 00 
+  800361:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  800363:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  80036a:	0a 
+  80036b:	48 8b 14 25 08 00 00 	mov    0xa000008,%rdx
+  800372:	0a 
+  800373:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800377:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  80037b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800380:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80038a:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  800391:	00 00 00 
+  800394:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  800396:	ba 00 02 00 00       	mov    $0x200,%edx
+  80039b:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8003a2:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8003a6:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+  8003b2:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8003b6:	0f 85 17 07 00 00    	jne    800ad3 <umain+0x943>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8003bc:	48 bf b0 48 80 00 00 	movabs $0x8048b0,%rdi
+  8003c3:	00 00 00 
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  8003d2:	00 00 00 
+  8003d5:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  8003d7:	be 02 01 00 00       	mov    $0x102,%esi
+  8003dc:	48 bf c6 48 80 00 00 	movabs $0x8048c6,%rdi
+  8003e3:	00 00 00 
+  8003e6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003ed:	00 00 00 
+  8003f0:	ff d0                	call   *%rax
+  8003f2:	48 63 c8             	movslq %eax,%rcx
+  8003f5:	48 85 c9             	test   %rcx,%rcx
+  8003f8:	0f 88 03 07 00 00    	js     800b01 <umain+0x971>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  8003fe:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  800405:	00 00 00 
+  800408:	48 8b 18             	mov    (%rax),%rbx
+  80040b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800412:	00 00 00 
+  800415:	49 8b 3c 24          	mov    (%r12),%rdi
+  800419:	49 bd be 19 80 00 00 	movabs $0x8019be,%r13
+  800420:	00 00 00 
+  800423:	41 ff d5             	call   *%r13
+  800426:	48 89 c2             	mov    %rax,%rdx
+  800429:	49 8b 34 24          	mov    (%r12),%rsi
+  80042d:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800432:	ff d3                	call   *%rbx
+  800434:	48 89 c3             	mov    %rax,%rbx
+  800437:	49 8b 3c 24          	mov    (%r12),%rdi
+  80043b:	41 ff d5             	call   *%r13
+  80043e:	48 39 c3             	cmp    %rax,%rbx
+  800441:	0f 85 e5 06 00 00    	jne    800b2c <umain+0x99c>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  800447:	48 bf fa 48 80 00 00 	movabs $0x8048fa,%rdi
+  80044e:	00 00 00 
+  800451:	b8 00 00 00 00       	mov    $0x0,%eax
+  800456:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  80045d:	00 00 00 
+  800460:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  800462:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  800469:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  80046d:	ba 00 02 00 00       	mov    $0x200,%edx
+  800472:	be 00 00 00 00       	mov    $0x0,%esi
+  800477:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  80047e:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  800485:	00 00 00 
+  800488:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  80048a:	ba 00 02 00 00       	mov    $0x200,%edx
+  80048f:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800496:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80049b:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8004a2:	00 00 00 
+  8004a5:	ff d0                	call   *%rax
+  8004a7:	48 89 c3             	mov    %rax,%rbx
+  8004aa:	48 85 c0             	test   %rax,%rax
+  8004ad:	0f 88 a7 06 00 00    	js     800b5a <umain+0x9ca>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8004b3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004ba:	00 00 00 
+  8004bd:	48 8b 38             	mov    (%rax),%rdi
+  8004c0:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+  8004cc:	48 39 d8             	cmp    %rbx,%rax
+  8004cf:	0f 85 b3 06 00 00    	jne    800b88 <umain+0x9f8>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8004d5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8004dc:	00 00 00 
+  8004df:	48 8b 30             	mov    (%rax),%rsi
+  8004e2:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8004e9:	48 b8 a0 1a 80 00 00 	movabs $0x801aa0,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	0f 85 b9 06 00 00    	jne    800bb6 <umain+0xa26>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  8004fd:	48 bf 90 46 80 00 00 	movabs $0x804690,%rdi
+  800504:	00 00 00 
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  800513:	00 00 00 
+  800516:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800518:	be 00 00 00 00       	mov    $0x0,%esi
+  80051d:	48 bf ce 47 80 00 00 	movabs $0x8047ce,%rdi
+  800524:	00 00 00 
+  800527:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  80052e:	00 00 00 
+  800531:	ff d0                	call   *%rax
+  800533:	48 63 c8             	movslq %eax,%rcx
+  800536:	48 85 c9             	test   %rcx,%rcx
+  800539:	0f 89 cc 06 00 00    	jns    800c0b <umain+0xa7b>
+  80053f:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  800543:	0f 85 97 06 00 00    	jne    800be0 <umain+0xa50>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800549:	be 00 00 00 00       	mov    $0x0,%esi
+  80054e:	48 bf f4 47 80 00 00 	movabs $0x8047f4,%rdi
+  800555:	00 00 00 
+  800558:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  80055f:	00 00 00 
+  800562:	ff d0                	call   *%rax
+  800564:	48 98                	cltq
+  800566:	48 85 c0             	test   %rax,%rax
+  800569:	0f 88 c6 06 00 00    	js     800c35 <umain+0xaa5>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  80056f:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800575:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800579:	83 38 66             	cmpl   $0x66,(%rax)
+  80057c:	0f 85 e1 06 00 00    	jne    800c63 <umain+0xad3>
+  800582:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  800586:	0f 85 d7 06 00 00    	jne    800c63 <umain+0xad3>
+  80058c:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  800590:	0f 85 cd 06 00 00    	jne    800c63 <umain+0xad3>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  800596:	48 bf 1c 48 80 00 00 	movabs $0x80481c,%rdi
+  80059d:	00 00 00 
+  8005a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a5:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  8005ac:	00 00 00 
+  8005af:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8005b1:	be 01 01 00 00       	mov    $0x101,%esi
+  8005b6:	48 bf 29 49 80 00 00 	movabs $0x804929,%rdi
+  8005bd:	00 00 00 
+  8005c0:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  8005c7:	00 00 00 
+  8005ca:	ff d0                	call   *%rax
+  8005cc:	41 89 c4             	mov    %eax,%r12d
+  8005cf:	48 63 c8             	movslq %eax,%rcx
+  8005d2:	48 85 c9             	test   %rcx,%rcx
+  8005d5:	0f 88 b2 06 00 00    	js     800c8d <umain+0xafd>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  8005db:	ba 00 02 00 00       	mov    $0x200,%edx
+  8005e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e5:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8005ec:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8005f3:	00 00 00 
+  8005f6:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  8005fd:	49 bd da 2b 80 00 00 	movabs $0x802bda,%r13
+  800604:	00 00 00 
+        *(int *)buf = i;
+  800607:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  80060d:	ba 00 02 00 00       	mov    $0x200,%edx
+  800612:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800619:	44 89 e7             	mov    %r12d,%edi
+  80061c:	41 ff d5             	call   *%r13
+  80061f:	48 85 c0             	test   %rax,%rax
+  800622:	0f 88 90 06 00 00    	js     800cb8 <umain+0xb28>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800628:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  80062f:	48 89 c3             	mov    %rax,%rbx
+  800632:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800638:	75 cd                	jne    800607 <umain+0x477>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  80063a:	44 89 e7             	mov    %r12d,%edi
+  80063d:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800649:	be 00 00 00 00       	mov    $0x0,%esi
+  80064e:	48 bf 29 49 80 00 00 	movabs $0x804929,%rdi
+  800655:	00 00 00 
+  800658:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  80065f:	00 00 00 
+  800662:	ff d0                	call   *%rax
+  800664:	41 89 c4             	mov    %eax,%r12d
+  800667:	48 63 c8             	movslq %eax,%rcx
+  80066a:	48 85 c9             	test   %rcx,%rcx
+  80066d:	0f 88 76 06 00 00    	js     800ce9 <umain+0xb59>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800673:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800678:	49 bd 69 2b 80 00 00 	movabs $0x802b69,%r13
+  80067f:	00 00 00 
+        *(int *)buf = i;
+  800682:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800688:	ba 00 02 00 00       	mov    $0x200,%edx
+  80068d:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800694:	44 89 e7             	mov    %r12d,%edi
+  800697:	41 ff d5             	call   *%r13
+  80069a:	48 85 c0             	test   %rax,%rax
+  80069d:	0f 88 71 06 00 00    	js     800d14 <umain+0xb84>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  8006a3:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  8006a9:	0f 85 96 06 00 00    	jne    800d45 <umain+0xbb5>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  8006af:	44 8b 85 40 fd ff ff 	mov    -0x2c0(%rbp),%r8d
+  8006b6:	49 63 c0             	movslq %r8d,%rax
+  8006b9:	48 39 d8             	cmp    %rbx,%rax
+  8006bc:	0f 85 ba 06 00 00    	jne    800d7c <umain+0xbec>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8006c2:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  8006c9:	48 89 c3             	mov    %rax,%rbx
+  8006cc:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  8006d2:	75 ae                	jne    800682 <umain+0x4f2>
+            panic("read /big from %ld returned bad data %d",
+                  (long)i, *(int *)buf);
+    }
+    close(f);
+  8006d4:	44 89 e7             	mov    %r12d,%edi
+  8006d7:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  8006de:	00 00 00 
+  8006e1:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  8006e3:	48 bf 74 49 80 00 00 	movabs $0x804974,%rdi
+  8006ea:	00 00 00 
+  8006ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f2:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  8006f9:	00 00 00 
+  8006fc:	ff d2                	call   *%rdx
+
+    /* All of /big comes back read-only from a single request */
+    size_t bigsize = (NDIRECT * 3) * BLKSIZE;
+    size_t size = FSREQ_BULK_MAX;
+  8006fe:	48 c7 85 38 fd ff ff 	movq   $0x100000,-0x2c8(%rbp)
+  800705:	00 00 10 00 
+    int perm;
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800709:	be 00 00 00 00       	mov    $0x0,%esi
+  80070e:	48 bf 29 49 80 00 00 	movabs $0x804929,%rdi
+  800715:	00 00 00 
+  800718:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  80071f:	00 00 00 
+  800722:	ff d0                	call   *%rax
+  800724:	89 c3                	mov    %eax,%ebx
+  800726:	48 63 c8             	movslq %eax,%rcx
+  800729:	48 85 c9             	test   %rcx,%rcx
+  80072c:	0f 88 78 06 00 00    	js     800daa <umain+0xc1a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800732:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  800739:	00 00 00 
+        panic("open /big: %ld", (long)f);
+    fd = (struct Fd *)(0xD0000000 + f * PAGE_SIZE);
+  80073c:	48 81 c1 00 00 0d 00 	add    $0xd0000,%rcx
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800743:	48 c1 e1 0c          	shl    $0xc,%rcx
+  800747:	8b 41 0c             	mov    0xc(%rcx),%eax
+  80074a:	41 89 04 24          	mov    %eax,(%r12)
+    fsipcbuf.read.req_n = *size;
+  80074e:	48 8b 85 38 fd ff ff 	mov    -0x2c8(%rbp),%rax
+  800755:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80075a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80075f:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  800766:	00 00 00 
+  800769:	ff d0                	call   *%rax
+  80076b:	89 c7                	mov    %eax,%edi
+    ipc_send(fsenv, FSREQ_READ_BULK, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80076d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800773:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800778:	4c 89 e2             	mov    %r12,%rdx
+  80077b:	be 14 00 00 00       	mov    $0x14,%esi
+  800780:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  800787:	00 00 00 
+  80078a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, MAPVA, size, perm);
+  80078c:	48 8d 8d 34 fd ff ff 	lea    -0x2cc(%rbp),%rcx
+  800793:	48 8d 95 38 fd ff ff 	lea    -0x2c8(%rbp),%rdx
+  80079a:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  80079f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007a4:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  8007ab:	00 00 00 
+  8007ae:	ff d0                	call   *%rax
+    if ((r = xreadbulk(fd, &size, &perm)) != bigsize || size != bigsize)
+  8007b0:	48 63 c8             	movslq %eax,%rcx
+  8007b3:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8007b8:	0f 85 17 06 00 00    	jne    800dd5 <umain+0xc45>
+  8007be:	48 81 bd 38 fd ff ff 	cmpq   $0x1e000,-0x2c8(%rbp)
+  8007c5:	00 e0 01 00 
+  8007c9:	0f 85 06 06 00 00    	jne    800dd5 <umain+0xc45>
+        panic("bulk read /big returned %ld bytes in a %ld byte region", (long)r, (long)size);
+    if (perm != (PROT_R | PROT_LAZY))
+  8007cf:	8b 8d 34 fd ff ff    	mov    -0x2cc(%rbp),%ecx
+  8007d5:	81 f9 84 00 00 00    	cmp    $0x84,%ecx
+  8007db:	0f 85 26 06 00 00    	jne    800e07 <umain+0xc77>
+        panic("bulk read /big sent permissions %x", perm);
+    check_big("bulk read", MAPVA, bigsize);
+  8007e1:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  8007e6:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  8007eb:	48 bf 88 49 80 00 00 	movabs $0x804988,%rdi
+  8007f2:	00 00 00 
+  8007f5:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  8007fc:	00 00 00 
+  8007ff:	ff d0                	call   *%rax
+    close(f);
+  800801:	89 df                	mov    %ebx,%edi
+  800803:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  80080a:	00 00 00 
+  80080d:	ff d0                	call   *%rax
+    sys_unmap_region(0, MAPVA, bigsize);
+  80080f:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  800814:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  800819:	bf 00 00 00 00       	mov    $0x0,%edi
+  80081e:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  800825:	00 00 00 
+  800828:	ff d0                	call   *%rax
+    cprintf("bulk read is good\n");
+  80082a:	48 bf 92 49 80 00 00 	movabs $0x804992,%rdi
+  800831:	00 00 00 
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  800840:	00 00 00 
+  800843:	ff d2                	call   *%rdx
+
+    /* readmap() maps the same blocks over the pages it is given */
+    if ((r = sys_alloc_region(0, MAPVA, bigsize, PROT_RW)) < 0)
+  800845:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80084a:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  80084f:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  800854:	bf 00 00 00 00       	mov    $0x0,%edi
+  800859:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  800860:	00 00 00 
+  800863:	ff d0                	call   *%rax
+  800865:	48 63 c8             	movslq %eax,%rcx
+  800868:	48 85 c9             	test   %rcx,%rcx
+  80086b:	0f 88 c1 05 00 00    	js     800e32 <umain+0xca2>
+        panic("sys_alloc_region: %ld", (long)r);
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800871:	be 00 00 00 00       	mov    $0x0,%esi
+  800876:	48 bf 29 49 80 00 00 	movabs $0x804929,%rdi
+  80087d:	00 00 00 
+  800880:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+  80088c:	89 c3                	mov    %eax,%ebx
+  80088e:	48 63 c8             	movslq %eax,%rcx
+  800891:	48 85 c9             	test   %rcx,%rcx
+  800894:	0f 88 c3 05 00 00    	js     800e5d <umain+0xccd>
+        panic("open /big: %ld", (long)f);
+    if ((r = readmap(f, MAPVA, bigsize)) != bigsize)
+  80089a:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  80089f:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  8008a4:	89 c7                	mov    %eax,%edi
+  8008a6:	48 b8 9e 2a 80 00 00 	movabs $0x802a9e,%rax
+  8008ad:	00 00 00 
+  8008b0:	ff d0                	call   *%rax
+  8008b2:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  8008b8:	0f 85 ca 05 00 00    	jne    800e88 <umain+0xcf8>
+        panic("readmap /big: %ld", (long)r);
+    check_big("readmap", MAPVA, bigsize);
+  8008be:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  8008c3:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  8008c8:	48 bf cd 49 80 00 00 	movabs $0x8049cd,%rdi
+  8008cf:	00 00 00 
+  8008d2:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  8008d9:	00 00 00 
+  8008dc:	ff d0                	call   *%rax
+    close(f);
+  8008de:	89 df                	mov    %ebx,%edi
+  8008e0:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  8008e7:	00 00 00 
+  8008ea:	ff d0                	call   *%rax
+    sys_unmap_region(0, MAPVA, bigsize);
+  8008ec:	ba 00 e0 01 00       	mov    $0x1e000,%edx
+  8008f1:	be 00 00 00 0b       	mov    $0xb000000,%esi
+  8008f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008fb:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  800902:	00 00 00 
+  800905:	ff d0                	call   *%rax
+    cprintf("readmap is good\n");
+  800907:	48 bf d5 49 80 00 00 	movabs $0x8049d5,%rdi
+  80090e:	00 00 00 
+  800911:	b8 00 00 00 00       	mov    $0x0,%eax
+  800916:	48 ba d7 10 80 00 00 	movabs $0x8010d7,%rdx
+  80091d:	00 00 00 
+  800920:	ff d2                	call   *%rdx
+}
+  800922:	48 81 c4 b8 02 00 00 	add    $0x2b8,%rsp
+  800929:	5b                   	pop    %rbx
+  80092a:	41 5c                	pop    %r12
+  80092c:	41 5d                	pop    %r13
+  80092e:	5d                   	pop    %rbp
+  80092f:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  800930:	48 ba d9 47 80 00 00 	movabs $0x8047d9,%rdx
+  800937:	00 00 00 
+  80093a:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80093f:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800946:	00 00 00 
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800955:	00 00 00 
+  800958:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  80095b:	48 ba 50 45 80 00 00 	movabs $0x804550,%rdx
+  800962:	00 00 00 
+  800965:	be 3c 00 00 00       	mov    $0x3c,%esi
+  80096a:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800971:	00 00 00 
+  800974:	b8 00 00 00 00       	mov    $0x0,%eax
+  800979:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  800980:	00 00 00 
+  800983:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  800985:	48 ba fd 47 80 00 00 	movabs $0x8047fd,%rdx
+  80098c:	00 00 00 
+  80098f:	be 3f 00 00 00       	mov    $0x3f,%esi
+  800994:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  80099b:	00 00 00 
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a3:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  8009aa:	00 00 00 
+  8009ad:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  8009b0:	48 ba 78 45 80 00 00 	movabs $0x804578,%rdx
+  8009b7:	00 00 00 
+  8009ba:	be 41 00 00 00       	mov    $0x41,%esi
+  8009bf:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  8009c6:	00 00 00 
+  8009c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ce:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  8009d5:	00 00 00 
+  8009d8:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  8009da:	48 ba 2a 48 80 00 00 	movabs $0x80482a,%rdx
+  8009e1:	00 00 00 
+  8009e4:	be 45 00 00 00       	mov    $0x45,%esi
+  8009e9:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  8009f0:	00 00 00 
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f8:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  8009ff:	00 00 00 
+  800a02:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  800a05:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800a0c:	00 00 00 
+  800a0f:	48 8b 38             	mov    (%rax),%rdi
+  800a12:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  800a19:	00 00 00 
+  800a1c:	ff d0                	call   *%rax
+  800a1e:	49 89 c0             	mov    %rax,%r8
+  800a21:	48 63 4d c0          	movslq -0x40(%rbp),%rcx
+  800a25:	48 ba a8 45 80 00 00 	movabs $0x8045a8,%rdx
+  800a2c:	00 00 00 
+  800a2f:	be 47 00 00 00       	mov    $0x47,%esi
+  800a34:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800a3b:	00 00 00 
+  800a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a43:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800a4a:	00 00 00 
+  800a4d:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  800a50:	48 89 c1             	mov    %rax,%rcx
+  800a53:	48 ba 4c 48 80 00 00 	movabs $0x80484c,%rdx
+  800a5a:	00 00 00 
+  800a5d:	be 4c 00 00 00       	mov    $0x4c,%esi
+  800a62:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800a69:	00 00 00 
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a71:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800a78:	00 00 00 
+  800a7b:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  800a7e:	48 ba 5b 48 80 00 00 	movabs $0x80485b,%rdx
+  800a85:	00 00 00 
+  800a88:	be 4e 00 00 00       	mov    $0x4e,%esi
+  800a8d:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800a94:	00 00 00 
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9c:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  800aa3:	00 00 00 
+  800aa6:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  800aa8:	48 ba 8c 48 80 00 00 	movabs $0x80488c,%rdx
+  800aaf:	00 00 00 
+  800ab2:	be 52 00 00 00       	mov    $0x52,%esi
+  800ab7:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800abe:	00 00 00 
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac6:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800acd:	00 00 00 
+  800ad0:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  800ad3:	48 89 c1             	mov    %rax,%rcx
+  800ad6:	48 ba d0 45 80 00 00 	movabs $0x8045d0,%rdx
+  800add:	00 00 00 
+  800ae0:	be 5d 00 00 00       	mov    $0x5d,%esi
+  800ae5:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800aec:	00 00 00 
+  800aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af4:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800afb:	00 00 00 
+  800afe:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  800b01:	48 ba d0 48 80 00 00 	movabs $0x8048d0,%rdx
+  800b08:	00 00 00 
+  800b0b:	be 62 00 00 00       	mov    $0x62,%esi
+  800b10:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800b17:	00 00 00 
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800b26:	00 00 00 
+  800b29:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  800b2c:	48 89 d9             	mov    %rbx,%rcx
+  800b2f:	48 ba ea 48 80 00 00 	movabs $0x8048ea,%rdx
+  800b36:	00 00 00 
+  800b39:	be 65 00 00 00       	mov    $0x65,%esi
+  800b3e:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800b45:	00 00 00 
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4d:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800b54:	00 00 00 
+  800b57:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  800b5a:	48 89 c1             	mov    %rax,%rcx
+  800b5d:	48 ba 08 46 80 00 00 	movabs $0x804608,%rdx
+  800b64:	00 00 00 
+  800b67:	be 6b 00 00 00       	mov    $0x6b,%esi
+  800b6c:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800b73:	00 00 00 
+  800b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7b:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800b82:	00 00 00 
+  800b85:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  800b88:	48 89 d9             	mov    %rbx,%rcx
+  800b8b:	48 ba 28 46 80 00 00 	movabs $0x804628,%rdx
+  800b92:	00 00 00 
+  800b95:	be 6d 00 00 00       	mov    $0x6d,%esi
+  800b9a:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800ba1:	00 00 00 
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800bb0:	00 00 00 
+  800bb3:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  800bb6:	48 ba 60 46 80 00 00 	movabs $0x804660,%rdx
+  800bbd:	00 00 00 
+  800bc0:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800bc5:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800bcc:	00 00 00 
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd4:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  800bdb:	00 00 00 
+  800bde:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  800be0:	48 ba df 47 80 00 00 	movabs $0x8047df,%rdx
+  800be7:	00 00 00 
+  800bea:	be 74 00 00 00       	mov    $0x74,%esi
+  800bef:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800bf6:	00 00 00 
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfe:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800c05:	00 00 00 
+  800c08:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  800c0b:	48 ba 0e 49 80 00 00 	movabs $0x80490e,%rdx
+  800c12:	00 00 00 
+  800c15:	be 76 00 00 00       	mov    $0x76,%esi
+  800c1a:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800c21:	00 00 00 
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  800c30:	00 00 00 
+  800c33:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800c35:	48 89 c1             	mov    %rax,%rcx
+  800c38:	48 ba 03 48 80 00 00 	movabs $0x804803,%rdx
+  800c3f:	00 00 00 
+  800c42:	be 79 00 00 00       	mov    $0x79,%esi
+  800c47:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800c4e:	00 00 00 
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800c5d:	00 00 00 
+  800c60:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800c63:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  800c6a:	00 00 00 
+  800c6d:	be 7c 00 00 00       	mov    $0x7c,%esi
+  800c72:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800c79:	00 00 00 
+  800c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c81:	48 b9 87 0f 80 00 00 	movabs $0x800f87,%rcx
+  800c88:	00 00 00 
+  800c8b:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  800c8d:	48 ba 2e 49 80 00 00 	movabs $0x80492e,%rdx
+  800c94:	00 00 00 
+  800c97:	be 81 00 00 00       	mov    $0x81,%esi
+  800c9c:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800ca3:	00 00 00 
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cab:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800cb2:	00 00 00 
+  800cb5:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  800cb8:	49 89 c0             	mov    %rax,%r8
+  800cbb:	48 89 d9             	mov    %rbx,%rcx
+  800cbe:	48 ba 3e 49 80 00 00 	movabs $0x80493e,%rdx
+  800cc5:	00 00 00 
+  800cc8:	be 86 00 00 00       	mov    $0x86,%esi
+  800ccd:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800cd4:	00 00 00 
+  800cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdc:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800ce3:	00 00 00 
+  800ce6:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  800ce9:	48 ba 52 49 80 00 00 	movabs $0x804952,%rdx
+  800cf0:	00 00 00 
+  800cf3:	be 8b 00 00 00       	mov    $0x8b,%esi
+  800cf8:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800cff:	00 00 00 
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d07:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800d0e:	00 00 00 
+  800d11:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  800d14:	49 89 c0             	mov    %rax,%r8
+  800d17:	48 89 d9             	mov    %rbx,%rcx
+  800d1a:	48 ba 61 49 80 00 00 	movabs $0x804961,%rdx
+  800d21:	00 00 00 
+  800d24:	be 8f 00 00 00       	mov    $0x8f,%esi
+  800d29:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800d30:	00 00 00 
+  800d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d38:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800d3f:	00 00 00 
+  800d42:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  800d45:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800d4b:	49 89 c0             	mov    %rax,%r8
+  800d4e:	48 89 d9             	mov    %rbx,%rcx
+  800d51:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  800d58:	00 00 00 
+  800d5b:	be 91 00 00 00       	mov    $0x91,%esi
+  800d60:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800d67:	00 00 00 
+  800d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6f:	49 ba 87 0f 80 00 00 	movabs $0x800f87,%r10
+  800d76:	00 00 00 
+  800d79:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  800d7c:	48 89 d9             	mov    %rbx,%rcx
+  800d7f:	48 ba 10 47 80 00 00 	movabs $0x804710,%rdx
+  800d86:	00 00 00 
+  800d89:	be 94 00 00 00       	mov    $0x94,%esi
+  800d8e:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800d95:	00 00 00 
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9d:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800da4:	00 00 00 
+  800da7:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  800daa:	48 ba 52 49 80 00 00 	movabs $0x804952,%rdx
+  800db1:	00 00 00 
+  800db4:	be 9f 00 00 00       	mov    $0x9f,%esi
+  800db9:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800dc0:	00 00 00 
+  800dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc8:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800dcf:	00 00 00 
+  800dd2:	41 ff d0             	call   *%r8
+        panic("bulk read /big returned %ld bytes in a %ld byte region", (long)r, (long)size);
+  800dd5:	4c 8b 85 38 fd ff ff 	mov    -0x2c8(%rbp),%r8
+  800ddc:	48 ba 38 47 80 00 00 	movabs $0x804738,%rdx
+  800de3:	00 00 00 
+  800de6:	be a2 00 00 00       	mov    $0xa2,%esi
+  800deb:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800df2:	00 00 00 
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  800e01:	00 00 00 
+  800e04:	41 ff d1             	call   *%r9
+        panic("bulk read /big sent permissions %x", perm);
+  800e07:	48 ba 70 47 80 00 00 	movabs $0x804770,%rdx
+  800e0e:	00 00 00 
+  800e11:	be a4 00 00 00       	mov    $0xa4,%esi
+  800e16:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800e1d:	00 00 00 
+  800e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e25:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800e2c:	00 00 00 
+  800e2f:	41 ff d0             	call   *%r8
+        panic("sys_alloc_region: %ld", (long)r);
+  800e32:	48 ba a5 49 80 00 00 	movabs $0x8049a5,%rdx
+  800e39:	00 00 00 
+  800e3c:	be ac 00 00 00       	mov    $0xac,%esi
+  800e41:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800e48:	00 00 00 
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e50:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800e57:	00 00 00 
+  800e5a:	41 ff d0             	call   *%r8
+        panic("open /big: %ld", (long)f);
+  800e5d:	48 ba 52 49 80 00 00 	movabs $0x804952,%rdx
+  800e64:	00 00 00 
+  800e67:	be ae 00 00 00       	mov    $0xae,%esi
+  800e6c:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800e73:	00 00 00 
+  800e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7b:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800e82:	00 00 00 
+  800e85:	41 ff d0             	call   *%r8
+        panic("readmap /big: %ld", (long)r);
+  800e88:	48 89 c1             	mov    %rax,%rcx
+  800e8b:	48 ba bb 49 80 00 00 	movabs $0x8049bb,%rdx
+  800e92:	00 00 00 
+  800e95:	be b0 00 00 00       	mov    $0xb0,%esi
+  800e9a:	48 bf be 47 80 00 00 	movabs $0x8047be,%rdi
+  800ea1:	00 00 00 
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea9:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  800eb0:	00 00 00 
+  800eb3:	41 ff d0             	call   *%r8
+
+0000000000800eb6 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800eb6:	55                   	push   %rbp
+  800eb7:	48 89 e5             	mov    %rsp,%rbp
+  800eba:	41 56                	push   %r14
+  800ebc:	41 55                	push   %r13
+  800ebe:	41 54                	push   %r12
+  800ec0:	53                   	push   %rbx
+  800ec1:	41 89 fd             	mov    %edi,%r13d
+  800ec4:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ec7:	48 ba f8 61 80 00 00 	movabs $0x8061f8,%rdx
+  800ece:	00 00 00 
+  800ed1:	48 b8 f8 61 80 00 00 	movabs $0x8061f8,%rax
+  800ed8:	00 00 00 
+  800edb:	48 39 c2             	cmp    %rax,%rdx
+  800ede:	73 17                	jae    800ef7 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800ee0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ee3:	49 89 c4             	mov    %rax,%r12
+  800ee6:	48 83 c3 08          	add    $0x8,%rbx
+  800eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eef:	ff 53 f8             	call   *-0x8(%rbx)
+  800ef2:	4c 39 e3             	cmp    %r12,%rbx
+  800ef5:	72 ef                	jb     800ee6 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800ef7:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+  800f03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f08:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800f0c:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800f10:	48 c1 e0 04          	shl    $0x4,%rax
+  800f14:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800f1b:	00 00 00 
+  800f1e:	48 01 d0             	add    %rdx,%rax
+  800f21:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800f28:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800f2b:	45 85 ed             	test   %r13d,%r13d
+  800f2e:	7e 0d                	jle    800f3d <libmain+0x87>
+  800f30:	49 8b 06             	mov    (%r14),%rax
+  800f33:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800f3a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800f3d:	4c 89 f6             	mov    %r14,%rsi
+  800f40:	44 89 ef             	mov    %r13d,%edi
+  800f43:	48 b8 90 01 80 00 00 	movabs $0x800190,%rax
+  800f4a:	00 00 00 
+  800f4d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800f4f:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+#endif
+}
+  800f5b:	5b                   	pop    %rbx
+  800f5c:	41 5c                	pop    %r12
+  800f5e:	41 5d                	pop    %r13
+  800f60:	41 5e                	pop    %r14
+  800f62:	5d                   	pop    %rbp
+  800f63:	c3                   	ret
+
+0000000000800f64 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800f64:	55                   	push   %rbp
+  800f65:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800f68:	48 b8 95 28 80 00 00 	movabs $0x802895,%rax
+  800f6f:	00 00 00 
+  800f72:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f79:	48 b8 5d 1f 80 00 00 	movabs $0x801f5d,%rax
+  800f80:	00 00 00 
+  800f83:	ff d0                	call   *%rax
+}
+  800f85:	5d                   	pop    %rbp
+  800f86:	c3                   	ret
+
+0000000000800f87 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800f87:	55                   	push   %rbp
+  800f88:	48 89 e5             	mov    %rsp,%rbp
+  800f8b:	41 56                	push   %r14
+  800f8d:	41 55                	push   %r13
+  800f8f:	41 54                	push   %r12
+  800f91:	53                   	push   %rbx
+  800f92:	48 83 ec 50          	sub    $0x50,%rsp
+  800f96:	49 89 fc             	mov    %rdi,%r12
+  800f99:	41 89 f5             	mov    %esi,%r13d
+  800f9c:	48 89 d3             	mov    %rdx,%rbx
+  800f9f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fa3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800fa7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800fab:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800fb2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fb6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800fba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800fbe:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800fc2:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fc9:	00 00 00 
+  800fcc:	4c 8b 30             	mov    (%rax),%r14
+  800fcf:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+  800fdb:	89 c6                	mov    %eax,%esi
+  800fdd:	45 89 e8             	mov    %r13d,%r8d
+  800fe0:	4c 89 e1             	mov    %r12,%rcx
+  800fe3:	4c 89 f2             	mov    %r14,%rdx
+  800fe6:	48 bf f0 49 80 00 00 	movabs $0x8049f0,%rdi
+  800fed:	00 00 00 
+  800ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff5:	49 bc d7 10 80 00 00 	movabs $0x8010d7,%r12
+  800ffc:	00 00 00 
+  800fff:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801002:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801006:	48 89 df             	mov    %rbx,%rdi
+  801009:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  801010:	00 00 00 
+  801013:	ff d0                	call   *%rax
+    cprintf("\n");
+  801015:	48 bf a3 49 80 00 00 	movabs $0x8049a3,%rdi
+  80101c:	00 00 00 
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801024:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801027:	cc                   	int3
+  801028:	eb fd                	jmp    801027 <_panic+0xa0>
+
+000000000080102a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80102a:	55                   	push   %rbp
+  80102b:	48 89 e5             	mov    %rsp,%rbp
+  80102e:	53                   	push   %rbx
+  80102f:	48 83 ec 08          	sub    $0x8,%rsp
+  801033:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801036:	8b 06                	mov    (%rsi),%eax
+  801038:	8d 50 01             	lea    0x1(%rax),%edx
+  80103b:	89 16                	mov    %edx,(%rsi)
+  80103d:	48 98                	cltq
+  80103f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801044:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80104a:	74 0a                	je     801056 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80104c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801050:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801054:	c9                   	leave
+  801055:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801056:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80105a:	be ff 00 00 00       	mov    $0xff,%esi
+  80105f:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  801066:	00 00 00 
+  801069:	ff d0                	call   *%rax
+        state->offset = 0;
+  80106b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801071:	eb d9                	jmp    80104c <putch+0x22>
+
+0000000000801073 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80107e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801081:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801088:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80108d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801092:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801095:	48 89 f1             	mov    %rsi,%rcx
+  801098:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80109f:	48 bf 2a 10 80 00 00 	movabs $0x80102a,%rdi
+  8010a6:	00 00 00 
+  8010a9:	48 b8 27 12 80 00 00 	movabs $0x801227,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8010b5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8010bc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8010c3:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8010cf:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+
+00000000008010d7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8010d7:	55                   	push   %rbp
+  8010d8:	48 89 e5             	mov    %rsp,%rbp
+  8010db:	48 83 ec 50          	sub    $0x50,%rsp
+  8010df:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010e3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8010e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010eb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8010ef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8010f3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8010fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801102:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801106:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80110a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80110e:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  801115:	00 00 00 
+  801118:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80111a:	c9                   	leave
+  80111b:	c3                   	ret
+
+000000000080111c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+  801120:	41 57                	push   %r15
+  801122:	41 56                	push   %r14
+  801124:	41 55                	push   %r13
+  801126:	41 54                	push   %r12
+  801128:	53                   	push   %rbx
+  801129:	48 83 ec 18          	sub    $0x18,%rsp
+  80112d:	49 89 fc             	mov    %rdi,%r12
+  801130:	49 89 f5             	mov    %rsi,%r13
+  801133:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801137:	8b 45 10             	mov    0x10(%rbp),%eax
+  80113a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80113d:	41 89 cf             	mov    %ecx,%r15d
+  801140:	4c 39 fa             	cmp    %r15,%rdx
+  801143:	73 5b                	jae    8011a0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801145:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801149:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80114d:	85 db                	test   %ebx,%ebx
+  80114f:	7e 0e                	jle    80115f <print_num+0x43>
+            putch(padc, put_arg);
+  801151:	4c 89 ee             	mov    %r13,%rsi
+  801154:	44 89 f7             	mov    %r14d,%edi
+  801157:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80115a:	83 eb 01             	sub    $0x1,%ebx
+  80115d:	75 f2                	jne    801151 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80115f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801163:	48 b9 24 4a 80 00 00 	movabs $0x804a24,%rcx
+  80116a:	00 00 00 
+  80116d:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  801174:	00 00 00 
+  801177:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80117b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	49 f7 f7             	div    %r15
+  801187:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80118b:	4c 89 ee             	mov    %r13,%rsi
+  80118e:	41 ff d4             	call   *%r12
+}
+  801191:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801195:	5b                   	pop    %rbx
+  801196:	41 5c                	pop    %r12
+  801198:	41 5d                	pop    %r13
+  80119a:	41 5e                	pop    %r14
+  80119c:	41 5f                	pop    %r15
+  80119e:	5d                   	pop    %rbp
+  80119f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8011a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a9:	49 f7 f7             	div    %r15
+  8011ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8011b4:	52                   	push   %rdx
+  8011b5:	45 0f be c9          	movsbl %r9b,%r9d
+  8011b9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8011bd:	48 89 c2             	mov    %rax,%rdx
+  8011c0:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  8011c7:	00 00 00 
+  8011ca:	ff d0                	call   *%rax
+  8011cc:	48 83 c4 10          	add    $0x10,%rsp
+  8011d0:	eb 8d                	jmp    80115f <print_num+0x43>
+
+00000000008011d2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8011d2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8011d6:	48 8b 06             	mov    (%rsi),%rax
+  8011d9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8011dd:	73 0a                	jae    8011e9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8011df:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8011e3:	48 89 16             	mov    %rdx,(%rsi)
+  8011e6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8011e9:	c3                   	ret
+
+00000000008011ea <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8011ea:	55                   	push   %rbp
+  8011eb:	48 89 e5             	mov    %rsp,%rbp
+  8011ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8011f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8011fe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801205:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801209:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80120d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801211:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801215:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801219:	48 b8 27 12 80 00 00 	movabs $0x801227,%rax
+  801220:	00 00 00 
+  801223:	ff d0                	call   *%rax
+}
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+
+0000000000801227 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801227:	55                   	push   %rbp
+  801228:	48 89 e5             	mov    %rsp,%rbp
+  80122b:	41 57                	push   %r15
+  80122d:	41 56                	push   %r14
+  80122f:	41 55                	push   %r13
+  801231:	41 54                	push   %r12
+  801233:	53                   	push   %rbx
+  801234:	48 83 ec 38          	sub    $0x38,%rsp
+  801238:	49 89 fe             	mov    %rdi,%r14
+  80123b:	49 89 f5             	mov    %rsi,%r13
+  80123e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801241:	48 8b 01             	mov    (%rcx),%rax
+  801244:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801248:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80124c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801250:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801254:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801258:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80125c:	0f b6 3b             	movzbl (%rbx),%edi
+  80125f:	40 80 ff 25          	cmp    $0x25,%dil
+  801263:	74 18                	je     80127d <vprintfmt+0x56>
+            if (!ch) return;
+  801265:	40 84 ff             	test   %dil,%dil
+  801268:	0f 84 b1 06 00 00    	je     80191f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80126e:	40 0f b6 ff          	movzbl %dil,%edi
+  801272:	4c 89 ee             	mov    %r13,%rsi
+  801275:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801278:	4c 89 e3             	mov    %r12,%rbx
+  80127b:	eb db                	jmp    801258 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80127d:	be 00 00 00 00       	mov    $0x0,%esi
+  801282:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801286:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80128b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801291:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801298:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80129c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8012a1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8012a6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8012a9:	83 e8 23             	sub    $0x23,%eax
+  8012ac:	3c 57                	cmp    $0x57,%al
+  8012ae:	0f 87 51 06 00 00    	ja     801905 <vprintfmt+0x6de>
+  8012b4:	0f b6 c0             	movzbl %al,%eax
+  8012b7:	48 b9 c0 4b 80 00 00 	movabs $0x804bc0,%rcx
+  8012be:	00 00 00 
+  8012c1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8012c4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8012c7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8012cb:	eb cf                	jmp    80129c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8012cd:	49 89 dc             	mov    %rbx,%r12
+  8012d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8012d5:	eb c5                	jmp    80129c <vprintfmt+0x75>
+            padc = ch;
+  8012d7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8012db:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8012de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8012e1:	eb b9                	jmp    80129c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8012e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8012e9:	77 24                	ja     80130f <vprintfmt+0xe8>
+  8012eb:	89 c1                	mov    %eax,%ecx
+  8012ed:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8012f1:	83 c0 08             	add    $0x8,%eax
+  8012f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012f7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8012fa:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8012fd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801301:	79 99                	jns    80129c <vprintfmt+0x75>
+                width = precision;
+  801303:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801307:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80130d:	eb 8d                	jmp    80129c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80130f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801313:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801317:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80131b:	eb da                	jmp    8012f7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80131d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801322:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801326:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80132c:	3c 39                	cmp    $0x39,%al
+  80132e:	77 1c                	ja     80134c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801330:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801334:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801338:	0f b6 c0             	movzbl %al,%eax
+  80133b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801340:	0f b6 03             	movzbl (%rbx),%eax
+  801343:	3c 39                	cmp    $0x39,%al
+  801345:	76 e9                	jbe    801330 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801347:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80134a:	eb b1                	jmp    8012fd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80134c:	49 89 dc             	mov    %rbx,%r12
+  80134f:	eb ac                	jmp    8012fd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801351:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801354:	85 c9                	test   %ecx,%ecx
+  801356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135b:	0f 49 c1             	cmovns %ecx,%eax
+  80135e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801361:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801364:	e9 33 ff ff ff       	jmp    80129c <vprintfmt+0x75>
+            lflag++;
+  801369:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80136c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80136f:	e9 28 ff ff ff       	jmp    80129c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801374:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801377:	83 f8 2f             	cmp    $0x2f,%eax
+  80137a:	77 19                	ja     801395 <vprintfmt+0x16e>
+  80137c:	89 c2                	mov    %eax,%edx
+  80137e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801382:	83 c0 08             	add    $0x8,%eax
+  801385:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801388:	8b 3a                	mov    (%rdx),%edi
+  80138a:	4c 89 ee             	mov    %r13,%rsi
+  80138d:	41 ff d6             	call   *%r14
+            break;
+  801390:	e9 c3 fe ff ff       	jmp    801258 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801395:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801399:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80139d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013a1:	eb e5                	jmp    801388 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8013a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8013a9:	77 5a                	ja     801405 <vprintfmt+0x1de>
+  8013ab:	89 c2                	mov    %eax,%edx
+  8013ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013b1:	83 c0 08             	add    $0x8,%eax
+  8013b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8013b7:	8b 02                	mov    (%rdx),%eax
+  8013b9:	89 c1                	mov    %eax,%ecx
+  8013bb:	f7 d9                	neg    %ecx
+  8013bd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8013c0:	83 f9 14             	cmp    $0x14,%ecx
+  8013c3:	7f 4e                	jg     801413 <vprintfmt+0x1ec>
+  8013c5:	48 63 c1             	movslq %ecx,%rax
+  8013c8:	48 ba 80 4e 80 00 00 	movabs $0x804e80,%rdx
+  8013cf:	00 00 00 
+  8013d2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8013d6:	48 85 c0             	test   %rax,%rax
+  8013d9:	74 38                	je     801413 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8013db:	48 89 c1             	mov    %rax,%rcx
+  8013de:	48 ba 79 50 80 00 00 	movabs $0x805079,%rdx
+  8013e5:	00 00 00 
+  8013e8:	4c 89 ee             	mov    %r13,%rsi
+  8013eb:	4c 89 f7             	mov    %r14,%rdi
+  8013ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f3:	49 b8 ea 11 80 00 00 	movabs $0x8011ea,%r8
+  8013fa:	00 00 00 
+  8013fd:	41 ff d0             	call   *%r8
+  801400:	e9 53 fe ff ff       	jmp    801258 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801405:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801409:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80140d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801411:	eb a4                	jmp    8013b7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801413:	48 ba 3c 4a 80 00 00 	movabs $0x804a3c,%rdx
+  80141a:	00 00 00 
+  80141d:	4c 89 ee             	mov    %r13,%rsi
+  801420:	4c 89 f7             	mov    %r14,%rdi
+  801423:	b8 00 00 00 00       	mov    $0x0,%eax
+  801428:	49 b8 ea 11 80 00 00 	movabs $0x8011ea,%r8
+  80142f:	00 00 00 
+  801432:	41 ff d0             	call   *%r8
+  801435:	e9 1e fe ff ff       	jmp    801258 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80143a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80143d:	83 f8 2f             	cmp    $0x2f,%eax
+  801440:	77 6c                	ja     8014ae <vprintfmt+0x287>
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801448:	83 c0 08             	add    $0x8,%eax
+  80144b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80144e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801451:	48 85 d2             	test   %rdx,%rdx
+  801454:	48 b8 35 4a 80 00 00 	movabs $0x804a35,%rax
+  80145b:	00 00 00 
+  80145e:	48 0f 45 c2          	cmovne %rdx,%rax
+  801462:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801466:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80146a:	7e 06                	jle    801472 <vprintfmt+0x24b>
+  80146c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801470:	75 4a                	jne    8014bc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801472:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801476:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80147a:	0f b6 00             	movzbl (%rax),%eax
+  80147d:	84 c0                	test   %al,%al
+  80147f:	0f 85 9a 00 00 00    	jne    80151f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801485:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801488:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	0f 8e c4 fd ff ff    	jle    801258 <vprintfmt+0x31>
+  801494:	4c 89 ee             	mov    %r13,%rsi
+  801497:	bf 20 00 00 00       	mov    $0x20,%edi
+  80149c:	41 ff d6             	call   *%r14
+  80149f:	41 83 ec 01          	sub    $0x1,%r12d
+  8014a3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8014a7:	75 eb                	jne    801494 <vprintfmt+0x26d>
+  8014a9:	e9 aa fd ff ff       	jmp    801258 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8014ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014ba:	eb 92                	jmp    80144e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8014bc:	49 63 f7             	movslq %r15d,%rsi
+  8014bf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8014c3:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  8014ca:	00 00 00 
+  8014cd:	ff d0                	call   *%rax
+  8014cf:	48 89 c2             	mov    %rax,%rdx
+  8014d2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014d5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8014d7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8014da:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	7e 91                	jle    801472 <vprintfmt+0x24b>
+  8014e1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8014e6:	4c 89 ee             	mov    %r13,%rsi
+  8014e9:	44 89 e7             	mov    %r12d,%edi
+  8014ec:	41 ff d6             	call   *%r14
+  8014ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8014f3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014f6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8014f9:	75 eb                	jne    8014e6 <vprintfmt+0x2bf>
+  8014fb:	e9 72 ff ff ff       	jmp    801472 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801500:	0f b6 f8             	movzbl %al,%edi
+  801503:	4c 89 ee             	mov    %r13,%rsi
+  801506:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801509:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80150d:	49 83 c4 01          	add    $0x1,%r12
+  801511:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801517:	84 c0                	test   %al,%al
+  801519:	0f 84 66 ff ff ff    	je     801485 <vprintfmt+0x25e>
+  80151f:	45 85 ff             	test   %r15d,%r15d
+  801522:	78 0a                	js     80152e <vprintfmt+0x307>
+  801524:	41 83 ef 01          	sub    $0x1,%r15d
+  801528:	0f 88 57 ff ff ff    	js     801485 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80152e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801532:	74 cc                	je     801500 <vprintfmt+0x2d9>
+  801534:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801537:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80153c:	80 fa 5e             	cmp    $0x5e,%dl
+  80153f:	77 c2                	ja     801503 <vprintfmt+0x2dc>
+  801541:	eb bd                	jmp    801500 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801543:	40 84 f6             	test   %sil,%sil
+  801546:	75 26                	jne    80156e <vprintfmt+0x347>
+    switch (lflag) {
+  801548:	85 d2                	test   %edx,%edx
+  80154a:	74 59                	je     8015a5 <vprintfmt+0x37e>
+  80154c:	83 fa 01             	cmp    $0x1,%edx
+  80154f:	74 7b                	je     8015cc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801551:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801554:	83 f8 2f             	cmp    $0x2f,%eax
+  801557:	0f 87 96 00 00 00    	ja     8015f3 <vprintfmt+0x3cc>
+  80155d:	89 c2                	mov    %eax,%edx
+  80155f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801563:	83 c0 08             	add    $0x8,%eax
+  801566:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801569:	4c 8b 22             	mov    (%rdx),%r12
+  80156c:	eb 17                	jmp    801585 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80156e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801571:	83 f8 2f             	cmp    $0x2f,%eax
+  801574:	77 21                	ja     801597 <vprintfmt+0x370>
+  801576:	89 c2                	mov    %eax,%edx
+  801578:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80157c:	83 c0 08             	add    $0x8,%eax
+  80157f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801582:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801585:	4d 85 e4             	test   %r12,%r12
+  801588:	78 7a                	js     801604 <vprintfmt+0x3dd>
+            num = i;
+  80158a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80158d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801592:	e9 50 02 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801597:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80159b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80159f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015a3:	eb dd                	jmp    801582 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8015a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8015ab:	77 11                	ja     8015be <vprintfmt+0x397>
+  8015ad:	89 c2                	mov    %eax,%edx
+  8015af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015b3:	83 c0 08             	add    $0x8,%eax
+  8015b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015b9:	4c 63 22             	movslq (%rdx),%r12
+  8015bc:	eb c7                	jmp    801585 <vprintfmt+0x35e>
+  8015be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ca:	eb ed                	jmp    8015b9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8015cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8015d2:	77 11                	ja     8015e5 <vprintfmt+0x3be>
+  8015d4:	89 c2                	mov    %eax,%edx
+  8015d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015da:	83 c0 08             	add    $0x8,%eax
+  8015dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015e0:	4c 8b 22             	mov    (%rdx),%r12
+  8015e3:	eb a0                	jmp    801585 <vprintfmt+0x35e>
+  8015e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015f1:	eb ed                	jmp    8015e0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8015f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ff:	e9 65 ff ff ff       	jmp    801569 <vprintfmt+0x342>
+                putch('-', put_arg);
+  801604:	4c 89 ee             	mov    %r13,%rsi
+  801607:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80160c:	41 ff d6             	call   *%r14
+                i = -i;
+  80160f:	49 f7 dc             	neg    %r12
+  801612:	e9 73 ff ff ff       	jmp    80158a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801617:	40 84 f6             	test   %sil,%sil
+  80161a:	75 32                	jne    80164e <vprintfmt+0x427>
+    switch (lflag) {
+  80161c:	85 d2                	test   %edx,%edx
+  80161e:	74 5d                	je     80167d <vprintfmt+0x456>
+  801620:	83 fa 01             	cmp    $0x1,%edx
+  801623:	0f 84 82 00 00 00    	je     8016ab <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801629:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80162c:	83 f8 2f             	cmp    $0x2f,%eax
+  80162f:	0f 87 a5 00 00 00    	ja     8016da <vprintfmt+0x4b3>
+  801635:	89 c2                	mov    %eax,%edx
+  801637:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80163b:	83 c0 08             	add    $0x8,%eax
+  80163e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801641:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801644:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801649:	e9 99 01 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80164e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801651:	83 f8 2f             	cmp    $0x2f,%eax
+  801654:	77 19                	ja     80166f <vprintfmt+0x448>
+  801656:	89 c2                	mov    %eax,%edx
+  801658:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80165c:	83 c0 08             	add    $0x8,%eax
+  80165f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801662:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801665:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80166a:	e9 78 01 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+  80166f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801673:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801677:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80167b:	eb e5                	jmp    801662 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80167d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801680:	83 f8 2f             	cmp    $0x2f,%eax
+  801683:	77 18                	ja     80169d <vprintfmt+0x476>
+  801685:	89 c2                	mov    %eax,%edx
+  801687:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80168b:	83 c0 08             	add    $0x8,%eax
+  80168e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801691:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801693:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801698:	e9 4a 01 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+  80169d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016a9:	eb e6                	jmp    801691 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8016ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8016b1:	77 19                	ja     8016cc <vprintfmt+0x4a5>
+  8016b3:	89 c2                	mov    %eax,%edx
+  8016b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016b9:	83 c0 08             	add    $0x8,%eax
+  8016bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8016c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8016c7:	e9 1b 01 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+  8016cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d8:	eb e5                	jmp    8016bf <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8016da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016e6:	e9 56 ff ff ff       	jmp    801641 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8016eb:	40 84 f6             	test   %sil,%sil
+  8016ee:	75 2e                	jne    80171e <vprintfmt+0x4f7>
+    switch (lflag) {
+  8016f0:	85 d2                	test   %edx,%edx
+  8016f2:	74 59                	je     80174d <vprintfmt+0x526>
+  8016f4:	83 fa 01             	cmp    $0x1,%edx
+  8016f7:	74 7f                	je     801778 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8016f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8016ff:	0f 87 9f 00 00 00    	ja     8017a4 <vprintfmt+0x57d>
+  801705:	89 c2                	mov    %eax,%edx
+  801707:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80170b:	83 c0 08             	add    $0x8,%eax
+  80170e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801711:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801714:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801719:	e9 c9 00 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80171e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801721:	83 f8 2f             	cmp    $0x2f,%eax
+  801724:	77 19                	ja     80173f <vprintfmt+0x518>
+  801726:	89 c2                	mov    %eax,%edx
+  801728:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80172c:	83 c0 08             	add    $0x8,%eax
+  80172f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801732:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801735:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80173a:	e9 a8 00 00 00       	jmp    8017e7 <vprintfmt+0x5c0>
+  80173f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801743:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801747:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80174b:	eb e5                	jmp    801732 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80174d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801750:	83 f8 2f             	cmp    $0x2f,%eax
+  801753:	77 15                	ja     80176a <vprintfmt+0x543>
+  801755:	89 c2                	mov    %eax,%edx
+  801757:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80175b:	83 c0 08             	add    $0x8,%eax
+  80175e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801761:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801763:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801768:	eb 7d                	jmp    8017e7 <vprintfmt+0x5c0>
+  80176a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80176e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801772:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801776:	eb e9                	jmp    801761 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801778:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80177b:	83 f8 2f             	cmp    $0x2f,%eax
+  80177e:	77 16                	ja     801796 <vprintfmt+0x56f>
+  801780:	89 c2                	mov    %eax,%edx
+  801782:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801786:	83 c0 08             	add    $0x8,%eax
+  801789:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80178c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80178f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801794:	eb 51                	jmp    8017e7 <vprintfmt+0x5c0>
+  801796:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80179a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80179e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017a2:	eb e8                	jmp    80178c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8017a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017b0:	e9 5c ff ff ff       	jmp    801711 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8017b5:	4c 89 ee             	mov    %r13,%rsi
+  8017b8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8017bd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8017c0:	4c 89 ee             	mov    %r13,%rsi
+  8017c3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8017c8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8017cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8017d1:	77 47                	ja     80181a <vprintfmt+0x5f3>
+  8017d3:	89 c2                	mov    %eax,%edx
+  8017d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017d9:	83 c0 08             	add    $0x8,%eax
+  8017dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8017df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8017e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8017e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017eb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8017ef:	0f 94 c0             	sete   %al
+  8017f2:	0f b6 c0             	movzbl %al,%eax
+  8017f5:	50                   	push   %rax
+  8017f6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8017fb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8017ff:	4c 89 ee             	mov    %r13,%rsi
+  801802:	4c 89 f7             	mov    %r14,%rdi
+  801805:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  80180c:	00 00 00 
+  80180f:	ff d0                	call   *%rax
+            break;
+  801811:	48 83 c4 10          	add    $0x10,%rsp
+  801815:	e9 3e fa ff ff       	jmp    801258 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80181a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80181e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801822:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801826:	eb b7                	jmp    8017df <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801828:	40 84 f6             	test   %sil,%sil
+  80182b:	75 2b                	jne    801858 <vprintfmt+0x631>
+    switch (lflag) {
+  80182d:	85 d2                	test   %edx,%edx
+  80182f:	74 56                	je     801887 <vprintfmt+0x660>
+  801831:	83 fa 01             	cmp    $0x1,%edx
+  801834:	74 7f                	je     8018b5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801836:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801839:	83 f8 2f             	cmp    $0x2f,%eax
+  80183c:	0f 87 a2 00 00 00    	ja     8018e4 <vprintfmt+0x6bd>
+  801842:	89 c2                	mov    %eax,%edx
+  801844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801848:	83 c0 08             	add    $0x8,%eax
+  80184b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80184e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801851:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801856:	eb 8f                	jmp    8017e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801858:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80185b:	83 f8 2f             	cmp    $0x2f,%eax
+  80185e:	77 19                	ja     801879 <vprintfmt+0x652>
+  801860:	89 c2                	mov    %eax,%edx
+  801862:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801866:	83 c0 08             	add    $0x8,%eax
+  801869:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80186c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80186f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801874:	e9 6e ff ff ff       	jmp    8017e7 <vprintfmt+0x5c0>
+  801879:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80187d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801881:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801885:	eb e5                	jmp    80186c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801887:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80188a:	83 f8 2f             	cmp    $0x2f,%eax
+  80188d:	77 18                	ja     8018a7 <vprintfmt+0x680>
+  80188f:	89 c2                	mov    %eax,%edx
+  801891:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801895:	83 c0 08             	add    $0x8,%eax
+  801898:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80189b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80189d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8018a2:	e9 40 ff ff ff       	jmp    8017e7 <vprintfmt+0x5c0>
+  8018a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018b3:	eb e6                	jmp    80189b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8018b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8018bb:	77 19                	ja     8018d6 <vprintfmt+0x6af>
+  8018bd:	89 c2                	mov    %eax,%edx
+  8018bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8018c3:	83 c0 08             	add    $0x8,%eax
+  8018c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8018cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8018d1:	e9 11 ff ff ff       	jmp    8017e7 <vprintfmt+0x5c0>
+  8018d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018e2:	eb e5                	jmp    8018c9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8018e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f0:	e9 59 ff ff ff       	jmp    80184e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8018f5:	4c 89 ee             	mov    %r13,%rsi
+  8018f8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8018fd:	41 ff d6             	call   *%r14
+            break;
+  801900:	e9 53 f9 ff ff       	jmp    801258 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801905:	4c 89 ee             	mov    %r13,%rsi
+  801908:	bf 25 00 00 00       	mov    $0x25,%edi
+  80190d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801910:	48 83 eb 01          	sub    $0x1,%rbx
+  801914:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801918:	75 f6                	jne    801910 <vprintfmt+0x6e9>
+  80191a:	e9 39 f9 ff ff       	jmp    801258 <vprintfmt+0x31>
+}
+  80191f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801923:	5b                   	pop    %rbx
+  801924:	41 5c                	pop    %r12
+  801926:	41 5d                	pop    %r13
+  801928:	41 5e                	pop    %r14
+  80192a:	41 5f                	pop    %r15
+  80192c:	5d                   	pop    %rbp
+  80192d:	c3                   	ret
+
+000000000080192e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80192e:	55                   	push   %rbp
+  80192f:	48 89 e5             	mov    %rsp,%rbp
+  801932:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801936:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80193a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80193f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801943:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80194a:	48 85 ff             	test   %rdi,%rdi
+  80194d:	74 2b                	je     80197a <vsnprintf+0x4c>
+  80194f:	48 85 f6             	test   %rsi,%rsi
+  801952:	74 26                	je     80197a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801954:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801958:	48 bf d2 11 80 00 00 	movabs $0x8011d2,%rdi
+  80195f:	00 00 00 
+  801962:	48 b8 27 12 80 00 00 	movabs $0x801227,%rax
+  801969:	00 00 00 
+  80196c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80196e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801972:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801975:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80197a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197f:	eb f7                	jmp    801978 <vsnprintf+0x4a>
+
+0000000000801981 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	48 83 ec 50          	sub    $0x50,%rsp
+  801989:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80198d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801991:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801995:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80199c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8019ac:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019b0:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  8019b7:	00 00 00 
+  8019ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+
+00000000008019be <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8019be:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8019c1:	74 10                	je     8019d3 <strlen+0x15>
+    size_t n = 0;
+  8019c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8019c8:	48 83 c0 01          	add    $0x1,%rax
+  8019cc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8019d0:	75 f6                	jne    8019c8 <strlen+0xa>
+  8019d2:	c3                   	ret
+    size_t n = 0;
+  8019d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8019d8:	c3                   	ret
+
+00000000008019d9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8019d9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8019dc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8019e1:	48 85 f6             	test   %rsi,%rsi
+  8019e4:	74 11                	je     8019f7 <strnlen+0x1e>
+  8019e6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8019ea:	74 0c                	je     8019f8 <strnlen+0x1f>
+  8019ec:	48 83 c2 01          	add    $0x1,%rdx
+  8019f0:	48 39 d0             	cmp    %rdx,%rax
+  8019f3:	75 f1                	jne    8019e6 <strnlen+0xd>
+  8019f5:	eb 04                	jmp    8019fb <strnlen+0x22>
+  8019f7:	c3                   	ret
+  8019f8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8019fb:	c3                   	ret
+
+00000000008019fc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8019fc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8019ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a04:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801a08:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801a0b:	48 83 c2 01          	add    $0x1,%rdx
+  801a0f:	84 c9                	test   %cl,%cl
+  801a11:	75 f1                	jne    801a04 <strcpy+0x8>
+        ;
+    return res;
+}
+  801a13:	c3                   	ret
+
+0000000000801a14 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	41 54                	push   %r12
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 89 fb             	mov    %rdi,%rbx
+  801a1e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801a21:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801a2d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801a31:	4c 89 e6             	mov    %r12,%rsi
+  801a34:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+    return dst;
+}
+  801a40:	48 89 d8             	mov    %rbx,%rax
+  801a43:	5b                   	pop    %rbx
+  801a44:	41 5c                	pop    %r12
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+
+0000000000801a48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801a48:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801a4b:	48 85 d2             	test   %rdx,%rdx
+  801a4e:	74 1f                	je     801a6f <strncpy+0x27>
+  801a50:	48 01 fa             	add    %rdi,%rdx
+  801a53:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801a56:	48 83 c1 01          	add    $0x1,%rcx
+  801a5a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801a5e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801a62:	41 80 f8 01          	cmp    $0x1,%r8b
+  801a66:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801a6a:	48 39 ca             	cmp    %rcx,%rdx
+  801a6d:	75 e7                	jne    801a56 <strncpy+0xe>
+    }
+    return ret;
+}
+  801a6f:	c3                   	ret
+
+0000000000801a70 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801a70:	48 89 f8             	mov    %rdi,%rax
+  801a73:	48 85 d2             	test   %rdx,%rdx
+  801a76:	74 24                	je     801a9c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801a78:	48 83 ea 01          	sub    $0x1,%rdx
+  801a7c:	74 1b                	je     801a99 <strlcpy+0x29>
+  801a7e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801a82:	0f b6 16             	movzbl (%rsi),%edx
+  801a85:	84 d2                	test   %dl,%dl
+  801a87:	74 10                	je     801a99 <strlcpy+0x29>
+            *dst++ = *src++;
+  801a89:	48 83 c6 01          	add    $0x1,%rsi
+  801a8d:	48 83 c0 01          	add    $0x1,%rax
+  801a91:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801a94:	48 39 c8             	cmp    %rcx,%rax
+  801a97:	75 e9                	jne    801a82 <strlcpy+0x12>
+        *dst = '\0';
+  801a99:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801a9c:	48 29 f8             	sub    %rdi,%rax
+}
+  801a9f:	c3                   	ret
+
+0000000000801aa0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801aa0:	0f b6 07             	movzbl (%rdi),%eax
+  801aa3:	84 c0                	test   %al,%al
+  801aa5:	74 13                	je     801aba <strcmp+0x1a>
+  801aa7:	38 06                	cmp    %al,(%rsi)
+  801aa9:	75 0f                	jne    801aba <strcmp+0x1a>
+  801aab:	48 83 c7 01          	add    $0x1,%rdi
+  801aaf:	48 83 c6 01          	add    $0x1,%rsi
+  801ab3:	0f b6 07             	movzbl (%rdi),%eax
+  801ab6:	84 c0                	test   %al,%al
+  801ab8:	75 ed                	jne    801aa7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801aba:	0f b6 c0             	movzbl %al,%eax
+  801abd:	0f b6 16             	movzbl (%rsi),%edx
+  801ac0:	29 d0                	sub    %edx,%eax
+}
+  801ac2:	c3                   	ret
+
+0000000000801ac3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801ac3:	48 85 d2             	test   %rdx,%rdx
+  801ac6:	74 1f                	je     801ae7 <strncmp+0x24>
+  801ac8:	0f b6 07             	movzbl (%rdi),%eax
+  801acb:	84 c0                	test   %al,%al
+  801acd:	74 1e                	je     801aed <strncmp+0x2a>
+  801acf:	3a 06                	cmp    (%rsi),%al
+  801ad1:	75 1a                	jne    801aed <strncmp+0x2a>
+  801ad3:	48 83 c7 01          	add    $0x1,%rdi
+  801ad7:	48 83 c6 01          	add    $0x1,%rsi
+  801adb:	48 83 ea 01          	sub    $0x1,%rdx
+  801adf:	75 e7                	jne    801ac8 <strncmp+0x5>
+
+    if (!n) return 0;
+  801ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae6:	c3                   	ret
+  801ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aec:	c3                   	ret
+  801aed:	48 85 d2             	test   %rdx,%rdx
+  801af0:	74 09                	je     801afb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801af2:	0f b6 07             	movzbl (%rdi),%eax
+  801af5:	0f b6 16             	movzbl (%rsi),%edx
+  801af8:	29 d0                	sub    %edx,%eax
+  801afa:	c3                   	ret
+    if (!n) return 0;
+  801afb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b00:	c3                   	ret
+
+0000000000801b01 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801b01:	0f b6 17             	movzbl (%rdi),%edx
+  801b04:	84 d2                	test   %dl,%dl
+  801b06:	74 18                	je     801b20 <strchr+0x1f>
+        if (*str == c) {
+  801b08:	0f be d2             	movsbl %dl,%edx
+  801b0b:	39 f2                	cmp    %esi,%edx
+  801b0d:	74 17                	je     801b26 <strchr+0x25>
+    for (; *str; str++) {
+  801b0f:	48 83 c7 01          	add    $0x1,%rdi
+  801b13:	0f b6 17             	movzbl (%rdi),%edx
+  801b16:	84 d2                	test   %dl,%dl
+  801b18:	75 ee                	jne    801b08 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1f:	c3                   	ret
+  801b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b25:	c3                   	ret
+  801b26:	48 89 f8             	mov    %rdi,%rax
+}
+  801b29:	c3                   	ret
+
+0000000000801b2a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801b2a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801b2d:	0f b6 17             	movzbl (%rdi),%edx
+  801b30:	84 d2                	test   %dl,%dl
+  801b32:	74 13                	je     801b47 <strfind+0x1d>
+  801b34:	0f be d2             	movsbl %dl,%edx
+  801b37:	39 f2                	cmp    %esi,%edx
+  801b39:	74 0b                	je     801b46 <strfind+0x1c>
+  801b3b:	48 83 c0 01          	add    $0x1,%rax
+  801b3f:	0f b6 10             	movzbl (%rax),%edx
+  801b42:	84 d2                	test   %dl,%dl
+  801b44:	75 ee                	jne    801b34 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801b46:	c3                   	ret
+  801b47:	c3                   	ret
+
+0000000000801b48 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801b48:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801b4b:	48 89 f8             	mov    %rdi,%rax
+  801b4e:	48 f7 d8             	neg    %rax
+  801b51:	83 e0 07             	and    $0x7,%eax
+  801b54:	49 89 d1             	mov    %rdx,%r9
+  801b57:	49 29 c1             	sub    %rax,%r9
+  801b5a:	78 36                	js     801b92 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801b5c:	40 0f b6 c6          	movzbl %sil,%eax
+  801b60:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801b67:	01 01 01 
+  801b6a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801b6e:	40 f6 c7 07          	test   $0x7,%dil
+  801b72:	75 38                	jne    801bac <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801b74:	4c 89 c9             	mov    %r9,%rcx
+  801b77:	48 c1 f9 03          	sar    $0x3,%rcx
+  801b7b:	74 0c                	je     801b89 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801b7d:	fc                   	cld
+  801b7e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801b81:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801b85:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801b89:	4d 85 c9             	test   %r9,%r9
+  801b8c:	75 45                	jne    801bd3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801b8e:	4c 89 c0             	mov    %r8,%rax
+  801b91:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801b92:	48 85 d2             	test   %rdx,%rdx
+  801b95:	74 f7                	je     801b8e <memset+0x46>
+  801b97:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801b9a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801b9d:	48 83 c0 01          	add    $0x1,%rax
+  801ba1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801ba5:	48 39 c2             	cmp    %rax,%rdx
+  801ba8:	75 f3                	jne    801b9d <memset+0x55>
+  801baa:	eb e2                	jmp    801b8e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801bac:	40 f6 c7 01          	test   $0x1,%dil
+  801bb0:	74 06                	je     801bb8 <memset+0x70>
+  801bb2:	88 07                	mov    %al,(%rdi)
+  801bb4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801bb8:	40 f6 c7 02          	test   $0x2,%dil
+  801bbc:	74 07                	je     801bc5 <memset+0x7d>
+  801bbe:	66 89 07             	mov    %ax,(%rdi)
+  801bc1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801bc5:	40 f6 c7 04          	test   $0x4,%dil
+  801bc9:	74 a9                	je     801b74 <memset+0x2c>
+  801bcb:	89 07                	mov    %eax,(%rdi)
+  801bcd:	48 83 c7 04          	add    $0x4,%rdi
+  801bd1:	eb a1                	jmp    801b74 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801bd3:	41 f6 c1 04          	test   $0x4,%r9b
+  801bd7:	74 06                	je     801bdf <memset+0x97>
+  801bd9:	89 07                	mov    %eax,(%rdi)
+  801bdb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801bdf:	41 f6 c1 02          	test   $0x2,%r9b
+  801be3:	74 07                	je     801bec <memset+0xa4>
+  801be5:	66 89 07             	mov    %ax,(%rdi)
+  801be8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801bec:	41 f6 c1 01          	test   $0x1,%r9b
+  801bf0:	74 9c                	je     801b8e <memset+0x46>
+  801bf2:	88 07                	mov    %al,(%rdi)
+  801bf4:	eb 98                	jmp    801b8e <memset+0x46>
+
+0000000000801bf6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801bf6:	48 89 f8             	mov    %rdi,%rax
+  801bf9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801bfc:	48 39 fe             	cmp    %rdi,%rsi
+  801bff:	73 3b                	jae    801c3c <memmove+0x46>
+  801c01:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801c05:	48 39 d7             	cmp    %rdx,%rdi
+  801c08:	73 32                	jae    801c3c <memmove+0x46>
+        s += n;
+        d += n;
+  801c0a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c0e:	48 89 d6             	mov    %rdx,%rsi
+  801c11:	48 09 fe             	or     %rdi,%rsi
+  801c14:	48 09 ce             	or     %rcx,%rsi
+  801c17:	40 f6 c6 07          	test   $0x7,%sil
+  801c1b:	75 12                	jne    801c2f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801c1d:	48 83 ef 08          	sub    $0x8,%rdi
+  801c21:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801c25:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c29:	fd                   	std
+  801c2a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801c2d:	fc                   	cld
+  801c2e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801c2f:	48 83 ef 01          	sub    $0x1,%rdi
+  801c33:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801c37:	fd                   	std
+  801c38:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c3a:	eb f1                	jmp    801c2d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c3c:	48 89 f2             	mov    %rsi,%rdx
+  801c3f:	48 09 c2             	or     %rax,%rdx
+  801c42:	48 09 ca             	or     %rcx,%rdx
+  801c45:	f6 c2 07             	test   $0x7,%dl
+  801c48:	75 0c                	jne    801c56 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801c4a:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c4e:	48 89 c7             	mov    %rax,%rdi
+  801c51:	fc                   	cld
+  801c52:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c55:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801c56:	48 89 c7             	mov    %rax,%rdi
+  801c59:	fc                   	cld
+  801c5a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801c5c:	c3                   	ret
+
+0000000000801c5d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c5d:	55                   	push   %rbp
+  801c5e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801c61:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  801c68:	00 00 00 
+  801c6b:	ff d0                	call   *%rax
+}
+  801c6d:	5d                   	pop    %rbp
+  801c6e:	c3                   	ret
+
+0000000000801c6f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	41 57                	push   %r15
+  801c75:	41 56                	push   %r14
+  801c77:	41 55                	push   %r13
+  801c79:	41 54                	push   %r12
+  801c7b:	53                   	push   %rbx
+  801c7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801c80:	49 89 fe             	mov    %rdi,%r14
+  801c83:	49 89 f7             	mov    %rsi,%r15
+  801c86:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801c89:	48 89 f7             	mov    %rsi,%rdi
+  801c8c:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801c9b:	48 89 de             	mov    %rbx,%rsi
+  801c9e:	4c 89 f7             	mov    %r14,%rdi
+  801ca1:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801ca8:	00 00 00 
+  801cab:	ff d0                	call   *%rax
+  801cad:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801cb0:	48 39 c3             	cmp    %rax,%rbx
+  801cb3:	74 36                	je     801ceb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801cb5:	48 89 d8             	mov    %rbx,%rax
+  801cb8:	4c 29 e8             	sub    %r13,%rax
+  801cbb:	49 39 c4             	cmp    %rax,%r12
+  801cbe:	73 31                	jae    801cf1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801cc0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801cc5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801cc9:	4c 89 fe             	mov    %r15,%rsi
+  801ccc:	48 b8 5d 1c 80 00 00 	movabs $0x801c5d,%rax
+  801cd3:	00 00 00 
+  801cd6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801cd8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801cdc:	48 83 c4 08          	add    $0x8,%rsp
+  801ce0:	5b                   	pop    %rbx
+  801ce1:	41 5c                	pop    %r12
+  801ce3:	41 5d                	pop    %r13
+  801ce5:	41 5e                	pop    %r14
+  801ce7:	41 5f                	pop    %r15
+  801ce9:	5d                   	pop    %rbp
+  801cea:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ceb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801cef:	eb eb                	jmp    801cdc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801cf1:	48 83 eb 01          	sub    $0x1,%rbx
+  801cf5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801cf9:	48 89 da             	mov    %rbx,%rdx
+  801cfc:	4c 89 fe             	mov    %r15,%rsi
+  801cff:	48 b8 5d 1c 80 00 00 	movabs $0x801c5d,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801d0b:	49 01 de             	add    %rbx,%r14
+  801d0e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801d13:	eb c3                	jmp    801cd8 <strlcat+0x69>
+
+0000000000801d15 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801d15:	48 85 d2             	test   %rdx,%rdx
+  801d18:	74 2d                	je     801d47 <memcmp+0x32>
+  801d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801d1f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801d23:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801d28:	44 38 c1             	cmp    %r8b,%cl
+  801d2b:	75 0f                	jne    801d3c <memcmp+0x27>
+    while (n-- > 0) {
+  801d2d:	48 83 c0 01          	add    $0x1,%rax
+  801d31:	48 39 c2             	cmp    %rax,%rdx
+  801d34:	75 e9                	jne    801d1f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801d3c:	0f b6 c1             	movzbl %cl,%eax
+  801d3f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801d43:	44 29 c0             	sub    %r8d,%eax
+  801d46:	c3                   	ret
+    return 0;
+  801d47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d4c:	c3                   	ret
+
+0000000000801d4d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801d4d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801d51:	48 39 c7             	cmp    %rax,%rdi
+  801d54:	73 0f                	jae    801d65 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801d56:	40 38 37             	cmp    %sil,(%rdi)
+  801d59:	74 0e                	je     801d69 <memfind+0x1c>
+    for (; src < end; src++) {
+  801d5b:	48 83 c7 01          	add    $0x1,%rdi
+  801d5f:	48 39 f8             	cmp    %rdi,%rax
+  801d62:	75 f2                	jne    801d56 <memfind+0x9>
+  801d64:	c3                   	ret
+  801d65:	48 89 f8             	mov    %rdi,%rax
+  801d68:	c3                   	ret
+  801d69:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801d6c:	c3                   	ret
+
+0000000000801d6d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d6d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801d70:	0f b6 37             	movzbl (%rdi),%esi
+  801d73:	40 80 fe 20          	cmp    $0x20,%sil
+  801d77:	74 06                	je     801d7f <strtol+0x12>
+  801d79:	40 80 fe 09          	cmp    $0x9,%sil
+  801d7d:	75 13                	jne    801d92 <strtol+0x25>
+  801d7f:	48 83 c7 01          	add    $0x1,%rdi
+  801d83:	0f b6 37             	movzbl (%rdi),%esi
+  801d86:	40 80 fe 20          	cmp    $0x20,%sil
+  801d8a:	74 f3                	je     801d7f <strtol+0x12>
+  801d8c:	40 80 fe 09          	cmp    $0x9,%sil
+  801d90:	74 ed                	je     801d7f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801d92:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801d95:	83 e0 fd             	and    $0xfffffffd,%eax
+  801d98:	3c 01                	cmp    $0x1,%al
+  801d9a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801d9e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801da4:	75 0f                	jne    801db5 <strtol+0x48>
+  801da6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801da9:	74 14                	je     801dbf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801dab:	85 d2                	test   %edx,%edx
+  801dad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801db2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801dba:	4c 63 ca             	movslq %edx,%r9
+  801dbd:	eb 36                	jmp    801df5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801dbf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801dc3:	74 0f                	je     801dd4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801dc5:	85 d2                	test   %edx,%edx
+  801dc7:	75 ec                	jne    801db5 <strtol+0x48>
+        s++;
+  801dc9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801dcd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801dd2:	eb e1                	jmp    801db5 <strtol+0x48>
+        s += 2;
+  801dd4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801dd8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801ddd:	eb d6                	jmp    801db5 <strtol+0x48>
+            dig -= '0';
+  801ddf:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801de2:	44 0f b6 c1          	movzbl %cl,%r8d
+  801de6:	41 39 d0             	cmp    %edx,%r8d
+  801de9:	7d 21                	jge    801e0c <strtol+0x9f>
+        val = val * base + dig;
+  801deb:	49 0f af c1          	imul   %r9,%rax
+  801def:	0f b6 c9             	movzbl %cl,%ecx
+  801df2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801df5:	48 83 c7 01          	add    $0x1,%rdi
+  801df9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801dfd:	80 f9 39             	cmp    $0x39,%cl
+  801e00:	76 dd                	jbe    801ddf <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801e02:	80 f9 7b             	cmp    $0x7b,%cl
+  801e05:	77 05                	ja     801e0c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801e07:	83 e9 57             	sub    $0x57,%ecx
+  801e0a:	eb d6                	jmp    801de2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801e0c:	4d 85 d2             	test   %r10,%r10
+  801e0f:	74 03                	je     801e14 <strtol+0xa7>
+  801e11:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801e14:	48 89 c2             	mov    %rax,%rdx
+  801e17:	48 f7 da             	neg    %rdx
+  801e1a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801e1e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801e22:	c3                   	ret
+
+0000000000801e23 <strrev>:
+
+void
+strrev(char *str)
+{
+  801e23:	55                   	push   %rbp
+  801e24:	48 89 e5             	mov    %rsp,%rbp
+  801e27:	53                   	push   %rbx
+  801e28:	48 83 ec 08          	sub    $0x8,%rsp
+  801e2c:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801e2f:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801e3b:	83 e8 01             	sub    $0x1,%eax
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	7e 22                	jle    801e64 <strrev+0x41>
+  801e42:	48 98                	cltq
+  801e44:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801e49:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801e4d:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801e51:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801e55:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801e58:	48 83 c2 01          	add    $0x1,%rdx
+  801e5c:	48 83 e8 01          	sub    $0x1,%rax
+  801e60:	39 c2                	cmp    %eax,%edx
+  801e62:	7c e5                	jl     801e49 <strrev+0x26>
+	}
+}
+  801e64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e68:	c9                   	leave
+  801e69:	c3                   	ret
+
+0000000000801e6a <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801e6a:	85 d2                	test   %edx,%edx
+  801e6c:	0f 84 80 00 00 00    	je     801ef2 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	53                   	push   %rbx
+  801e77:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7b:	49 89 f2             	mov    %rsi,%r10
+  801e7e:	41 89 d3             	mov    %edx,%r11d
+  801e81:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801e84:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801e89:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801e8c:	eb 20                	jmp    801eae <itoa+0x44>
+			str[i++] = '0' + digit;
+  801e8e:	41 89 f1             	mov    %esi,%r9d
+  801e91:	83 c2 30             	add    $0x30,%edx
+  801e94:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801e97:	89 f8                	mov    %edi,%eax
+  801e99:	99                   	cltd
+  801e9a:	f7 f9                	idiv   %ecx
+  801e9c:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	74 2e                	je     801ed0 <itoa+0x66>
+  801ea2:	83 c6 01             	add    $0x1,%esi
+  801ea5:	49 83 c0 01          	add    $0x1,%r8
+  801ea9:	44 39 cb             	cmp    %r9d,%ebx
+  801eac:	7e 15                	jle    801ec3 <itoa+0x59>
+		digit = sum % base;
+  801eae:	89 f8                	mov    %edi,%eax
+  801eb0:	99                   	cltd
+  801eb1:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801eb3:	83 fa 09             	cmp    $0x9,%edx
+  801eb6:	7e d6                	jle    801e8e <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801eb8:	41 89 f1             	mov    %esi,%r9d
+  801ebb:	83 c2 37             	add    $0x37,%edx
+  801ebe:	41 88 10             	mov    %dl,(%r8)
+  801ec1:	eb d4                	jmp    801e97 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801ec3:	41 83 eb 01          	sub    $0x1,%r11d
+  801ec7:	45 39 cb             	cmp    %r9d,%r11d
+  801eca:	75 04                	jne    801ed0 <itoa+0x66>
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	75 28                	jne    801ef8 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801ed0:	4d 63 c9             	movslq %r9d,%r9
+  801ed3:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801ed8:	4c 89 d7             	mov    %r10,%rdi
+  801edb:	48 b8 23 1e 80 00 00 	movabs $0x801e23,%rax
+  801ee2:	00 00 00 
+  801ee5:	ff d0                	call   *%rax
+	return 0;
+  801ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef0:	c9                   	leave
+  801ef1:	c3                   	ret
+		return -1;
+  801ef2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801ef7:	c3                   	ret
+		return -1;
+  801ef8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801efd:	eb ed                	jmp    801eec <itoa+0x82>
+
+0000000000801eff <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801eff:	55                   	push   %rbp
+  801f00:	48 89 e5             	mov    %rsp,%rbp
+  801f03:	53                   	push   %rbx
+  801f04:	48 89 fa             	mov    %rdi,%rdx
+  801f07:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f14:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f19:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f24:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801f26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f2a:	c9                   	leave
+  801f2b:	c3                   	ret
+
+0000000000801f2c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801f2c:	55                   	push   %rbp
+  801f2d:	48 89 e5             	mov    %rsp,%rbp
+  801f30:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f31:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f55:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f5b:	c9                   	leave
+  801f5c:	c3                   	ret
+
+0000000000801f5d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801f5d:	55                   	push   %rbp
+  801f5e:	48 89 e5             	mov    %rsp,%rbp
+  801f61:	53                   	push   %rbx
+  801f62:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801f66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f69:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f88:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f8a:	48 85 c0             	test   %rax,%rax
+  801f8d:	7f 06                	jg     801f95 <sys_env_destroy+0x38>
+}
+  801f8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f93:	c9                   	leave
+  801f94:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f95:	49 89 c0             	mov    %rax,%r8
+  801f98:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801f9d:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  801fa4:	00 00 00 
+  801fa7:	be 26 00 00 00       	mov    $0x26,%esi
+  801fac:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  801fb3:	00 00 00 
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbb:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  801fc2:	00 00 00 
+  801fc5:	41 ff d1             	call   *%r9
+
+0000000000801fc8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801fc8:	55                   	push   %rbp
+  801fc9:	48 89 e5             	mov    %rsp,%rbp
+  801fcc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801fcd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  801feb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ff1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff7:	c9                   	leave
+  801ff8:	c3                   	ret
+
+0000000000801ff9 <sys_yield>:
+
+void
+sys_yield(void) {
+  801ff9:	55                   	push   %rbp
+  801ffa:	48 89 e5             	mov    %rsp,%rbp
+  801ffd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ffe:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802003:	ba 00 00 00 00       	mov    $0x0,%edx
+  802008:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80200d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802012:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802017:	be 00 00 00 00       	mov    $0x0,%esi
+  80201c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802022:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  802024:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+000000000080202a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  80202e:	53                   	push   %rbx
+  80202f:	48 89 fa             	mov    %rdi,%rdx
+  802032:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802035:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80203a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802041:	00 00 00 
+  802044:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802049:	be 00 00 00 00       	mov    $0x0,%esi
+  80204e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802054:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  802056:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80205a:	c9                   	leave
+  80205b:	c3                   	ret
+
+000000000080205c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80205c:	55                   	push   %rbp
+  80205d:	48 89 e5             	mov    %rsp,%rbp
+  802060:	53                   	push   %rbx
+  802061:	49 89 f8             	mov    %rdi,%r8
+  802064:	48 89 d3             	mov    %rdx,%rbx
+  802067:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80206a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80206f:	4c 89 c2             	mov    %r8,%rdx
+  802072:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802075:	be 00 00 00 00       	mov    $0x0,%esi
+  80207a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802080:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  802082:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+0000000000802088 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	53                   	push   %rbx
+  80208d:	48 83 ec 08          	sub    $0x8,%rsp
+  802091:	89 f8                	mov    %edi,%eax
+  802093:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  802096:	48 63 f9             	movslq %ecx,%rdi
+  802099:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80209c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020a1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020b1:	48 85 c0             	test   %rax,%rax
+  8020b4:	7f 06                	jg     8020bc <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8020b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020ba:	c9                   	leave
+  8020bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020bc:	49 89 c0             	mov    %rax,%r8
+  8020bf:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8020c4:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  8020cb:	00 00 00 
+  8020ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8020d3:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  8020da:	00 00 00 
+  8020dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e2:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  8020e9:	00 00 00 
+  8020ec:	41 ff d1             	call   *%r9
+
+00000000008020ef <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8020ef:	55                   	push   %rbp
+  8020f0:	48 89 e5             	mov    %rsp,%rbp
+  8020f3:	53                   	push   %rbx
+  8020f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f8:	89 f8                	mov    %edi,%eax
+  8020fa:	49 89 f2             	mov    %rsi,%r10
+  8020fd:	48 89 cf             	mov    %rcx,%rdi
+  802100:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  802103:	48 63 da             	movslq %edx,%rbx
+  802106:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802109:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80210e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802111:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  802114:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802116:	48 85 c0             	test   %rax,%rax
+  802119:	7f 06                	jg     802121 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80211b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802121:	49 89 c0             	mov    %rax,%r8
+  802124:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802129:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  802130:	00 00 00 
+  802133:	be 26 00 00 00       	mov    $0x26,%esi
+  802138:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  80213f:	00 00 00 
+  802142:	b8 00 00 00 00       	mov    $0x0,%eax
+  802147:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  80214e:	00 00 00 
+  802151:	41 ff d1             	call   *%r9
+
+0000000000802154 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	53                   	push   %rbx
+  802159:	48 83 ec 08          	sub    $0x8,%rsp
+  80215d:	48 89 f1             	mov    %rsi,%rcx
+  802160:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802163:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802166:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80216b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802170:	be 00 00 00 00       	mov    $0x0,%esi
+  802175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80217b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80217d:	48 85 c0             	test   %rax,%rax
+  802180:	7f 06                	jg     802188 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802186:	c9                   	leave
+  802187:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802188:	49 89 c0             	mov    %rax,%r8
+  80218b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802190:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  802197:	00 00 00 
+  80219a:	be 26 00 00 00       	mov    $0x26,%esi
+  80219f:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  8021a6:	00 00 00 
+  8021a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ae:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  8021b5:	00 00 00 
+  8021b8:	41 ff d1             	call   *%r9
+
+00000000008021bb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8021bb:	55                   	push   %rbp
+  8021bc:	48 89 e5             	mov    %rsp,%rbp
+  8021bf:	53                   	push   %rbx
+  8021c0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8021c4:	48 63 ce             	movslq %esi,%rcx
+  8021c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021ca:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021e6:	48 85 c0             	test   %rax,%rax
+  8021e9:	7f 06                	jg     8021f1 <sys_env_set_status+0x36>
+}
+  8021eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021f1:	49 89 c0             	mov    %rax,%r8
+  8021f4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8021f9:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  802200:	00 00 00 
+  802203:	be 26 00 00 00       	mov    $0x26,%esi
+  802208:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  80220f:	00 00 00 
+  802212:	b8 00 00 00 00       	mov    $0x0,%eax
+  802217:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  80221e:	00 00 00 
+  802221:	41 ff d1             	call   *%r9
+
+0000000000802224 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802224:	55                   	push   %rbp
+  802225:	48 89 e5             	mov    %rsp,%rbp
+  802228:	53                   	push   %rbx
+  802229:	48 83 ec 08          	sub    $0x8,%rsp
+  80222d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802230:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802233:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80223d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802242:	be 00 00 00 00       	mov    $0x0,%esi
+  802247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80224d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80224f:	48 85 c0             	test   %rax,%rax
+  802252:	7f 06                	jg     80225a <sys_env_set_trapframe+0x36>
+}
+  802254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80225a:	49 89 c0             	mov    %rax,%r8
+  80225d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802262:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  802269:	00 00 00 
+  80226c:	be 26 00 00 00       	mov    $0x26,%esi
+  802271:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  802278:	00 00 00 
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802280:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  802287:	00 00 00 
+  80228a:	41 ff d1             	call   *%r9
+
+000000000080228d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80228d:	55                   	push   %rbp
+  80228e:	48 89 e5             	mov    %rsp,%rbp
+  802291:	53                   	push   %rbx
+  802292:	48 83 ec 08          	sub    $0x8,%rsp
+  802296:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802299:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80229c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022b8:	48 85 c0             	test   %rax,%rax
+  8022bb:	7f 06                	jg     8022c3 <sys_env_set_pgfault_upcall+0x36>
+}
+  8022bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022c1:	c9                   	leave
+  8022c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022c3:	49 89 c0             	mov    %rax,%r8
+  8022c6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8022cb:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  8022d2:	00 00 00 
+  8022d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8022da:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  8022e1:	00 00 00 
+  8022e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e9:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  8022f0:	00 00 00 
+  8022f3:	41 ff d1             	call   *%r9
+
+00000000008022f6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	53                   	push   %rbx
+  8022fb:	89 f8                	mov    %edi,%eax
+  8022fd:	49 89 f1             	mov    %rsi,%r9
+  802300:	48 89 d3             	mov    %rdx,%rbx
+  802303:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802306:	49 63 f0             	movslq %r8d,%rsi
+  802309:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80230c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802311:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802314:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80231a:	cd 30                	int    $0x30
+}
+  80231c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+0000000000802322 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  802322:	55                   	push   %rbp
+  802323:	48 89 e5             	mov    %rsp,%rbp
+  802326:	53                   	push   %rbx
+  802327:	48 83 ec 08          	sub    $0x8,%rsp
+  80232b:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  80232e:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802331:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802336:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802339:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802349:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80234b:	48 85 c0             	test   %rax,%rax
+  80234e:	7f 06                	jg     802356 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802350:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802356:	49 89 c0             	mov    %rax,%r8
+  802359:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80235e:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  802365:	00 00 00 
+  802368:	be 26 00 00 00       	mov    $0x26,%esi
+  80236d:	48 bf 67 4f 80 00 00 	movabs $0x804f67,%rdi
+  802374:	00 00 00 
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237c:	49 b9 87 0f 80 00 00 	movabs $0x800f87,%r9
+  802383:	00 00 00 
+  802386:	41 ff d1             	call   *%r9
+
+0000000000802389 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  802389:	55                   	push   %rbp
+  80238a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80238d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802392:	48 b8 22 23 80 00 00 	movabs $0x802322,%rax
+  802399:	00 00 00 
+  80239c:	ff d0                	call   *%rax
+}
+  80239e:	5d                   	pop    %rbp
+  80239f:	c3                   	ret
+
+00000000008023a0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+  8023a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8023a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8023aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023be:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023c9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8023cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+00000000008023d1 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8023d1:	55                   	push   %rbp
+  8023d2:	48 89 e5             	mov    %rsp,%rbp
+  8023d5:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8023d6:	48 63 ce             	movslq %esi,%rcx
+  8023d9:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8023dd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023f7:	cd 30                	int    $0x30
+}
+  8023f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+
+00000000008023ff <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8023ff:	55                   	push   %rbp
+  802400:	48 89 e5             	mov    %rsp,%rbp
+  802403:	53                   	push   %rbx
+  802404:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  802407:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80240b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802410:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802415:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80241a:	be 00 00 00 00       	mov    $0x0,%esi
+  80241f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802425:	cd 30                	int    $0x30
+}
+  802427:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80242b:	c9                   	leave
+  80242c:	c3                   	ret
+
+000000000080242d <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  80242d:	55                   	push   %rbp
+  80242e:	48 89 e5             	mov    %rsp,%rbp
+  802431:	53                   	push   %rbx
+  802432:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  802435:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802438:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80243d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802445:	be 00 00 00 00       	mov    $0x0,%esi
+  80244a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802450:	cd 30                	int    $0x30
+}
+  802452:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802456:	c9                   	leave
+  802457:	c3                   	ret
+
+0000000000802458 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  802458:	55                   	push   %rbp
+  802459:	48 89 e5             	mov    %rsp,%rbp
+  80245c:	41 55                	push   %r13
+  80245e:	41 54                	push   %r12
+  802460:	53                   	push   %rbx
+  802461:	48 83 ec 08          	sub    $0x8,%rsp
+  802465:	49 89 fc             	mov    %rdi,%r12
+  802468:	48 89 f7             	mov    %rsi,%rdi
+  80246b:	48 89 d3             	mov    %rdx,%rbx
+  80246e:	49 89 cd             	mov    %rcx,%r13
+  802471:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802474:	48 85 f6             	test   %rsi,%rsi
+  802477:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80247e:	00 00 00 
+  802481:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  802485:	be 00 10 00 00       	mov    $0x1000,%esi
+  80248a:	48 85 db             	test   %rbx,%rbx
+  80248d:	74 03                	je     802492 <ipc_recv_timed+0x3a>
+  80248f:	48 8b 33             	mov    (%rbx),%rsi
+  802492:	48 b8 22 23 80 00 00 	movabs $0x802322,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 75                	js     802517 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8024a2:	4d 85 e4             	test   %r12,%r12
+  8024a5:	74 14                	je     8024bb <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8024a7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024ae:	00 00 00 
+  8024b1:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8024b7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8024bb:	4d 85 ed             	test   %r13,%r13
+  8024be:	74 14                	je     8024d4 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8024c0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024c7:	00 00 00 
+  8024ca:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8024d0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8024d4:	48 85 db             	test   %rbx,%rbx
+  8024d7:	74 23                	je     8024fc <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8024d9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024e0:	00 00 00 
+  8024e3:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8024e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ee:	85 c9                	test   %ecx,%ecx
+  8024f0:	74 07                	je     8024f9 <ipc_recv_timed+0xa1>
+  8024f2:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8024f9:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8024fc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802503:	00 00 00 
+  802506:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80250c:	48 83 c4 08          	add    $0x8,%rsp
+  802510:	5b                   	pop    %rbx
+  802511:	41 5c                	pop    %r12
+  802513:	41 5d                	pop    %r13
+  802515:	5d                   	pop    %rbp
+  802516:	c3                   	ret
+        if (from_env_store != NULL) {
+  802517:	4d 85 e4             	test   %r12,%r12
+  80251a:	74 08                	je     802524 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80251c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802523:	00 
+        if (perm_store != NULL) {
+  802524:	4d 85 ed             	test   %r13,%r13
+  802527:	74 08                	je     802531 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  802529:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802530:	00 
+        if (size != NULL) {
+  802531:	48 85 db             	test   %rbx,%rbx
+  802534:	74 d6                	je     80250c <ipc_recv_timed+0xb4>
+            *size = 0;
+  802536:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80253d:	eb cd                	jmp    80250c <ipc_recv_timed+0xb4>
+
+000000000080253f <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  802543:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802549:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+}
+  802555:	5d                   	pop    %rbp
+  802556:	c3                   	ret
+
+0000000000802557 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+  80255b:	41 57                	push   %r15
+  80255d:	41 56                	push   %r14
+  80255f:	41 55                	push   %r13
+  802561:	41 54                	push   %r12
+  802563:	53                   	push   %rbx
+  802564:	48 83 ec 18          	sub    $0x18,%rsp
+  802568:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80256b:	48 89 d3             	mov    %rdx,%rbx
+  80256e:	49 89 cc             	mov    %rcx,%r12
+  802571:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802574:	48 85 d2             	test   %rdx,%rdx
+  802577:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80257e:	00 00 00 
+  802581:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802585:	89 f0                	mov    %esi,%eax
+  802587:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80258b:	48 89 da             	mov    %rbx,%rdx
+  80258e:	48 89 c6             	mov    %rax,%rsi
+  802591:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+    while (res < 0) {
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	79 65                	jns    802606 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8025a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8025a4:	75 33                	jne    8025d9 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8025a6:	49 bf f9 1f 80 00 00 	movabs $0x801ff9,%r15
+  8025ad:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8025b0:	49 be f6 22 80 00 00 	movabs $0x8022f6,%r14
+  8025b7:	00 00 00 
+        sys_yield();
+  8025ba:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8025bd:	45 89 e8             	mov    %r13d,%r8d
+  8025c0:	4c 89 e1             	mov    %r12,%rcx
+  8025c3:	48 89 da             	mov    %rbx,%rdx
+  8025c6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8025ca:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8025cd:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	79 32                	jns    802606 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8025d4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8025d7:	74 e1                	je     8025ba <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8025d9:	89 c1                	mov    %eax,%ecx
+  8025db:	48 ba 75 4f 80 00 00 	movabs $0x804f75,%rdx
+  8025e2:	00 00 00 
+  8025e5:	be 52 00 00 00       	mov    $0x52,%esi
+  8025ea:	48 bf 89 4f 80 00 00 	movabs $0x804f89,%rdi
+  8025f1:	00 00 00 
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f9:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  802600:	00 00 00 
+  802603:	41 ff d0             	call   *%r8
+    }
+}
+  802606:	48 83 c4 18          	add    $0x18,%rsp
+  80260a:	5b                   	pop    %rbx
+  80260b:	41 5c                	pop    %r12
+  80260d:	41 5d                	pop    %r13
+  80260f:	41 5e                	pop    %r14
+  802611:	41 5f                	pop    %r15
+  802613:	5d                   	pop    %rbp
+  802614:	c3                   	ret
+
+0000000000802615 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802615:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80261a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802621:	00 00 00 
+  802624:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802628:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80262c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802630:	48 01 ca             	add    %rcx,%rdx
+  802633:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802639:	39 fa                	cmp    %edi,%edx
+  80263b:	74 12                	je     80264f <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80263d:	48 83 c0 01          	add    $0x1,%rax
+  802641:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802647:	75 db                	jne    802624 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802649:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264e:	c3                   	ret
+            return envs[i].env_id;
+  80264f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802653:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802657:	48 c1 e2 04          	shl    $0x4,%rdx
+  80265b:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  802662:	00 00 00 
+  802665:	48 01 d0             	add    %rdx,%rax
+  802668:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80266e:	c3                   	ret
+
+000000000080266f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80266f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802676:	ff ff ff 
+  802679:	48 01 f8             	add    %rdi,%rax
+  80267c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802680:	c3                   	ret
+
+0000000000802681 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802681:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802688:	ff ff ff 
+  80268b:	48 01 f8             	add    %rdi,%rax
+  80268e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802692:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802698:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80269c:	c3                   	ret
+
+000000000080269d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80269d:	55                   	push   %rbp
+  80269e:	48 89 e5             	mov    %rsp,%rbp
+  8026a1:	41 57                	push   %r15
+  8026a3:	41 56                	push   %r14
+  8026a5:	41 55                	push   %r13
+  8026a7:	41 54                	push   %r12
+  8026a9:	53                   	push   %rbx
+  8026aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ae:	49 89 ff             	mov    %rdi,%r15
+  8026b1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8026b6:	49 bd bc 41 80 00 00 	movabs $0x8041bc,%r13
+  8026bd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8026c0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8026c6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8026c9:	48 89 df             	mov    %rbx,%rdi
+  8026cc:	41 ff d5             	call   *%r13
+  8026cf:	83 e0 04             	and    $0x4,%eax
+  8026d2:	74 17                	je     8026eb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8026d4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026db:	4c 39 f3             	cmp    %r14,%rbx
+  8026de:	75 e6                	jne    8026c6 <fd_alloc+0x29>
+  8026e0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8026e6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8026eb:	4d 89 27             	mov    %r12,(%r15)
+}
+  8026ee:	48 83 c4 08          	add    $0x8,%rsp
+  8026f2:	5b                   	pop    %rbx
+  8026f3:	41 5c                	pop    %r12
+  8026f5:	41 5d                	pop    %r13
+  8026f7:	41 5e                	pop    %r14
+  8026f9:	41 5f                	pop    %r15
+  8026fb:	5d                   	pop    %rbp
+  8026fc:	c3                   	ret
+
+00000000008026fd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8026fd:	83 ff 1f             	cmp    $0x1f,%edi
+  802700:	77 39                	ja     80273b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802702:	55                   	push   %rbp
+  802703:	48 89 e5             	mov    %rsp,%rbp
+  802706:	41 54                	push   %r12
+  802708:	53                   	push   %rbx
+  802709:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80270c:	48 63 df             	movslq %edi,%rbx
+  80270f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802716:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80271a:	48 89 df             	mov    %rbx,%rdi
+  80271d:	48 b8 bc 41 80 00 00 	movabs $0x8041bc,%rax
+  802724:	00 00 00 
+  802727:	ff d0                	call   *%rax
+  802729:	a8 04                	test   $0x4,%al
+  80272b:	74 14                	je     802741 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80272d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802731:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802736:	5b                   	pop    %rbx
+  802737:	41 5c                	pop    %r12
+  802739:	5d                   	pop    %rbp
+  80273a:	c3                   	ret
+        return -E_INVAL;
+  80273b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802740:	c3                   	ret
+        return -E_INVAL;
+  802741:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802746:	eb ee                	jmp    802736 <fd_lookup+0x39>
+
+0000000000802748 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802748:	55                   	push   %rbp
+  802749:	48 89 e5             	mov    %rsp,%rbp
+  80274c:	41 54                	push   %r12
+  80274e:	53                   	push   %rbx
+  80274f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802752:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  802759:	00 00 00 
+  80275c:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802763:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802766:	39 3b                	cmp    %edi,(%rbx)
+  802768:	74 47                	je     8027b1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80276a:	48 83 c0 08          	add    $0x8,%rax
+  80276e:	48 8b 18             	mov    (%rax),%rbx
+  802771:	48 85 db             	test   %rbx,%rbx
+  802774:	75 f0                	jne    802766 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802776:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80277d:	00 00 00 
+  802780:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802786:	89 fa                	mov    %edi,%edx
+  802788:	48 bf 98 4f 80 00 00 	movabs $0x804f98,%rdi
+  80278f:	00 00 00 
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	48 b9 d7 10 80 00 00 	movabs $0x8010d7,%rcx
+  80279e:	00 00 00 
+  8027a1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8027a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8027a8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8027ac:	5b                   	pop    %rbx
+  8027ad:	41 5c                	pop    %r12
+  8027af:	5d                   	pop    %rbp
+  8027b0:	c3                   	ret
+            return 0;
+  8027b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b6:	eb f0                	jmp    8027a8 <dev_lookup+0x60>
+
+00000000008027b8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8027b8:	55                   	push   %rbp
+  8027b9:	48 89 e5             	mov    %rsp,%rbp
+  8027bc:	41 55                	push   %r13
+  8027be:	41 54                	push   %r12
+  8027c0:	53                   	push   %rbx
+  8027c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c5:	48 89 fb             	mov    %rdi,%rbx
+  8027c8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8027cb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8027d2:	ff ff ff 
+  8027d5:	48 01 df             	add    %rbx,%rdi
+  8027d8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8027dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027e0:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	41 89 c5             	mov    %eax,%r13d
+  8027ef:	85 c0                	test   %eax,%eax
+  8027f1:	78 06                	js     8027f9 <fd_close+0x41>
+  8027f3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8027f7:	74 1a                	je     802813 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8027f9:	45 84 e4             	test   %r12b,%r12b
+  8027fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802801:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802805:	44 89 e8             	mov    %r13d,%eax
+  802808:	48 83 c4 18          	add    $0x18,%rsp
+  80280c:	5b                   	pop    %rbx
+  80280d:	41 5c                	pop    %r12
+  80280f:	41 5d                	pop    %r13
+  802811:	5d                   	pop    %rbp
+  802812:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802813:	8b 3b                	mov    (%rbx),%edi
+  802815:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802819:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+  802825:	41 89 c5             	mov    %eax,%r13d
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	78 1b                	js     802847 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80282c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802830:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802834:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80283a:	48 85 c0             	test   %rax,%rax
+  80283d:	74 08                	je     802847 <fd_close+0x8f>
+  80283f:	48 89 df             	mov    %rbx,%rdi
+  802842:	ff d0                	call   *%rax
+  802844:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802847:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80284c:	48 89 de             	mov    %rbx,%rsi
+  80284f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802854:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+    return res;
+  802860:	eb a3                	jmp    802805 <fd_close+0x4d>
+
+0000000000802862 <close>:
+
+int
+close(int fdnum) {
+  802862:	55                   	push   %rbp
+  802863:	48 89 e5             	mov    %rsp,%rbp
+  802866:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80286a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80286e:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802875:	00 00 00 
+  802878:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	78 15                	js     802893 <close+0x31>
+
+    return fd_close(fd, 1);
+  80287e:	be 01 00 00 00       	mov    $0x1,%esi
+  802883:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802887:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  80288e:	00 00 00 
+  802891:	ff d0                	call   *%rax
+}
+  802893:	c9                   	leave
+  802894:	c3                   	ret
+
+0000000000802895 <close_all>:
+
+void
+close_all(void) {
+  802895:	55                   	push   %rbp
+  802896:	48 89 e5             	mov    %rsp,%rbp
+  802899:	41 54                	push   %r12
+  80289b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80289c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a1:	49 bc 62 28 80 00 00 	movabs $0x802862,%r12
+  8028a8:	00 00 00 
+  8028ab:	89 df                	mov    %ebx,%edi
+  8028ad:	41 ff d4             	call   *%r12
+  8028b0:	83 c3 01             	add    $0x1,%ebx
+  8028b3:	83 fb 20             	cmp    $0x20,%ebx
+  8028b6:	75 f3                	jne    8028ab <close_all+0x16>
+}
+  8028b8:	5b                   	pop    %rbx
+  8028b9:	41 5c                	pop    %r12
+  8028bb:	5d                   	pop    %rbp
+  8028bc:	c3                   	ret
+
+00000000008028bd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8028bd:	55                   	push   %rbp
+  8028be:	48 89 e5             	mov    %rsp,%rbp
+  8028c1:	41 57                	push   %r15
+  8028c3:	41 56                	push   %r14
+  8028c5:	41 55                	push   %r13
+  8028c7:	41 54                	push   %r12
+  8028c9:	53                   	push   %rbx
+  8028ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8028ce:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8028d1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028d5:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+  8028e1:	89 c3                	mov    %eax,%ebx
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	0f 88 b8 00 00 00    	js     8029a3 <dup+0xe6>
+    close(newfdnum);
+  8028eb:	44 89 e7             	mov    %r12d,%edi
+  8028ee:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  8028f5:	00 00 00 
+  8028f8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8028fa:	4d 63 ec             	movslq %r12d,%r13
+  8028fd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802904:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802908:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80290c:	4c 89 ff             	mov    %r15,%rdi
+  80290f:	49 be 81 26 80 00 00 	movabs $0x802681,%r14
+  802916:	00 00 00 
+  802919:	41 ff d6             	call   *%r14
+  80291c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80291f:	4c 89 ef             	mov    %r13,%rdi
+  802922:	41 ff d6             	call   *%r14
+  802925:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802928:	48 89 df             	mov    %rbx,%rdi
+  80292b:	48 b8 bc 41 80 00 00 	movabs $0x8041bc,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802937:	a8 04                	test   $0x4,%al
+  802939:	74 2b                	je     802966 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80293b:	41 89 c1             	mov    %eax,%r9d
+  80293e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802944:	4c 89 f1             	mov    %r14,%rcx
+  802947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294c:	48 89 de             	mov    %rbx,%rsi
+  80294f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802954:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+  802960:	89 c3                	mov    %eax,%ebx
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 4e                	js     8029b4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802966:	4c 89 ff             	mov    %r15,%rdi
+  802969:	48 b8 bc 41 80 00 00 	movabs $0x8041bc,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+  802975:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802978:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80297e:	4c 89 e9             	mov    %r13,%rcx
+  802981:	ba 00 00 00 00       	mov    $0x0,%edx
+  802986:	4c 89 fe             	mov    %r15,%rsi
+  802989:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298e:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+  80299a:	89 c3                	mov    %eax,%ebx
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	78 14                	js     8029b4 <dup+0xf7>
+
+    return newfdnum;
+  8029a0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8029a3:	89 d8                	mov    %ebx,%eax
+  8029a5:	48 83 c4 18          	add    $0x18,%rsp
+  8029a9:	5b                   	pop    %rbx
+  8029aa:	41 5c                	pop    %r12
+  8029ac:	41 5d                	pop    %r13
+  8029ae:	41 5e                	pop    %r14
+  8029b0:	41 5f                	pop    %r15
+  8029b2:	5d                   	pop    %rbp
+  8029b3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8029b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029b9:	4c 89 ee             	mov    %r13,%rsi
+  8029bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c1:	49 bc 54 21 80 00 00 	movabs $0x802154,%r12
+  8029c8:	00 00 00 
+  8029cb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8029ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029d3:	4c 89 f6             	mov    %r14,%rsi
+  8029d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029db:	41 ff d4             	call   *%r12
+    return res;
+  8029de:	eb c3                	jmp    8029a3 <dup+0xe6>
+
+00000000008029e0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	41 56                	push   %r14
+  8029e6:	41 55                	push   %r13
+  8029e8:	41 54                	push   %r12
+  8029ea:	53                   	push   %rbx
+  8029eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ef:	89 fb                	mov    %edi,%ebx
+  8029f1:	49 89 f4             	mov    %rsi,%r12
+  8029f4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029fb:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802a02:	00 00 00 
+  802a05:	ff d0                	call   *%rax
+  802a07:	85 c0                	test   %eax,%eax
+  802a09:	78 4c                	js     802a57 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a0b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a0f:	41 8b 3e             	mov    (%r14),%edi
+  802a12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a16:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	78 35                	js     802a5b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802a26:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802a2a:	83 e0 03             	and    $0x3,%eax
+  802a2d:	83 f8 01             	cmp    $0x1,%eax
+  802a30:	74 2d                	je     802a5f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a36:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802a3a:	48 85 c0             	test   %rax,%rax
+  802a3d:	74 56                	je     802a95 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802a3f:	4c 89 ea             	mov    %r13,%rdx
+  802a42:	4c 89 e6             	mov    %r12,%rsi
+  802a45:	4c 89 f7             	mov    %r14,%rdi
+  802a48:	ff d0                	call   *%rax
+}
+  802a4a:	48 83 c4 10          	add    $0x10,%rsp
+  802a4e:	5b                   	pop    %rbx
+  802a4f:	41 5c                	pop    %r12
+  802a51:	41 5d                	pop    %r13
+  802a53:	41 5e                	pop    %r14
+  802a55:	5d                   	pop    %rbp
+  802a56:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a57:	48 98                	cltq
+  802a59:	eb ef                	jmp    802a4a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a5b:	48 98                	cltq
+  802a5d:	eb eb                	jmp    802a4a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a5f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802a66:	00 00 00 
+  802a69:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a6f:	89 da                	mov    %ebx,%edx
+  802a71:	48 bf f9 4f 80 00 00 	movabs $0x804ff9,%rdi
+  802a78:	00 00 00 
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a80:	48 b9 d7 10 80 00 00 	movabs $0x8010d7,%rcx
+  802a87:	00 00 00 
+  802a8a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a8c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a93:	eb b5                	jmp    802a4a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a95:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802a9c:	eb ac                	jmp    802a4a <read+0x6a>
+
+0000000000802a9e <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  802a9e:	55                   	push   %rbp
+  802a9f:	48 89 e5             	mov    %rsp,%rbp
+  802aa2:	41 56                	push   %r14
+  802aa4:	41 55                	push   %r13
+  802aa6:	41 54                	push   %r12
+  802aa8:	53                   	push   %rbx
+  802aa9:	48 83 ec 10          	sub    $0x10,%rsp
+  802aad:	89 fb                	mov    %edi,%ebx
+  802aaf:	49 89 f4             	mov    %rsi,%r12
+  802ab2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ab5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ab9:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802ac0:	00 00 00 
+  802ac3:	ff d0                	call   *%rax
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	78 41                	js     802b0a <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ac9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802acd:	41 8b 3e             	mov    (%r14),%edi
+  802ad0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802ad4:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	78 35                	js     802b19 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802ae4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802ae8:	83 e0 03             	and    $0x3,%eax
+  802aeb:	83 f8 01             	cmp    $0x1,%eax
+  802aee:	74 2d                	je     802b1d <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802af0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802af4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802af8:	48 85 c0             	test   %rax,%rax
+  802afb:	74 56                	je     802b53 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  802afd:	4c 89 ea             	mov    %r13,%rdx
+  802b00:	4c 89 e6             	mov    %r12,%rsi
+  802b03:	4c 89 f7             	mov    %r14,%rdi
+  802b06:	ff d0                	call   *%rax
+  802b08:	eb 02                	jmp    802b0c <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b0a:	48 98                	cltq
+}
+  802b0c:	48 83 c4 10          	add    $0x10,%rsp
+  802b10:	5b                   	pop    %rbx
+  802b11:	41 5c                	pop    %r12
+  802b13:	41 5d                	pop    %r13
+  802b15:	41 5e                	pop    %r14
+  802b17:	5d                   	pop    %rbp
+  802b18:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b19:	48 98                	cltq
+  802b1b:	eb ef                	jmp    802b0c <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  802b1d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802b24:	00 00 00 
+  802b27:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802b2d:	89 da                	mov    %ebx,%edx
+  802b2f:	48 bf b8 4f 80 00 00 	movabs $0x804fb8,%rdi
+  802b36:	00 00 00 
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	48 b9 d7 10 80 00 00 	movabs $0x8010d7,%rcx
+  802b45:	00 00 00 
+  802b48:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b4a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b51:	eb b9                	jmp    802b0c <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802b53:	4c 89 ea             	mov    %r13,%rdx
+  802b56:	4c 89 e6             	mov    %r12,%rsi
+  802b59:	89 df                	mov    %ebx,%edi
+  802b5b:	48 b8 e0 29 80 00 00 	movabs $0x8029e0,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+  802b67:	eb a3                	jmp    802b0c <readmap+0x6e>
+
+0000000000802b69 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802b69:	55                   	push   %rbp
+  802b6a:	48 89 e5             	mov    %rsp,%rbp
+  802b6d:	41 57                	push   %r15
+  802b6f:	41 56                	push   %r14
+  802b71:	41 55                	push   %r13
+  802b73:	41 54                	push   %r12
+  802b75:	53                   	push   %rbx
+  802b76:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802b7a:	48 85 d2             	test   %rdx,%rdx
+  802b7d:	74 54                	je     802bd3 <readn+0x6a>
+  802b7f:	41 89 fd             	mov    %edi,%r13d
+  802b82:	49 89 f6             	mov    %rsi,%r14
+  802b85:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802b88:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802b8d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802b92:	49 bf e0 29 80 00 00 	movabs $0x8029e0,%r15
+  802b99:	00 00 00 
+  802b9c:	4c 89 e2             	mov    %r12,%rdx
+  802b9f:	48 29 f2             	sub    %rsi,%rdx
+  802ba2:	4c 01 f6             	add    %r14,%rsi
+  802ba5:	44 89 ef             	mov    %r13d,%edi
+  802ba8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 20                	js     802bcf <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802baf:	01 c3                	add    %eax,%ebx
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	74 08                	je     802bbd <readn+0x54>
+  802bb5:	48 63 f3             	movslq %ebx,%rsi
+  802bb8:	4c 39 e6             	cmp    %r12,%rsi
+  802bbb:	72 df                	jb     802b9c <readn+0x33>
+    }
+    return res;
+  802bbd:	48 63 c3             	movslq %ebx,%rax
+}
+  802bc0:	48 83 c4 08          	add    $0x8,%rsp
+  802bc4:	5b                   	pop    %rbx
+  802bc5:	41 5c                	pop    %r12
+  802bc7:	41 5d                	pop    %r13
+  802bc9:	41 5e                	pop    %r14
+  802bcb:	41 5f                	pop    %r15
+  802bcd:	5d                   	pop    %rbp
+  802bce:	c3                   	ret
+        if (inc < 0) return inc;
+  802bcf:	48 98                	cltq
+  802bd1:	eb ed                	jmp    802bc0 <readn+0x57>
+    int inc = 1, res = 0;
+  802bd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd8:	eb e3                	jmp    802bbd <readn+0x54>
+
+0000000000802bda <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802bda:	55                   	push   %rbp
+  802bdb:	48 89 e5             	mov    %rsp,%rbp
+  802bde:	41 56                	push   %r14
+  802be0:	41 55                	push   %r13
+  802be2:	41 54                	push   %r12
+  802be4:	53                   	push   %rbx
+  802be5:	48 83 ec 10          	sub    $0x10,%rsp
+  802be9:	89 fb                	mov    %edi,%ebx
+  802beb:	49 89 f4             	mov    %rsi,%r12
+  802bee:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bf1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802bf5:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	78 47                	js     802c4c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c05:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802c09:	41 8b 3e             	mov    (%r14),%edi
+  802c0c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c10:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+  802c1c:	85 c0                	test   %eax,%eax
+  802c1e:	78 30                	js     802c50 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802c20:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802c25:	74 2d                	je     802c54 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c2b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c2f:	48 85 c0             	test   %rax,%rax
+  802c32:	74 56                	je     802c8a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802c34:	4c 89 ea             	mov    %r13,%rdx
+  802c37:	4c 89 e6             	mov    %r12,%rsi
+  802c3a:	4c 89 f7             	mov    %r14,%rdi
+  802c3d:	ff d0                	call   *%rax
+}
+  802c3f:	48 83 c4 10          	add    $0x10,%rsp
+  802c43:	5b                   	pop    %rbx
+  802c44:	41 5c                	pop    %r12
+  802c46:	41 5d                	pop    %r13
+  802c48:	41 5e                	pop    %r14
+  802c4a:	5d                   	pop    %rbp
+  802c4b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c4c:	48 98                	cltq
+  802c4e:	eb ef                	jmp    802c3f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c50:	48 98                	cltq
+  802c52:	eb eb                	jmp    802c3f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c54:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802c5b:	00 00 00 
+  802c5e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802c64:	89 da                	mov    %ebx,%edx
+  802c66:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  802c6d:	00 00 00 
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	48 b9 d7 10 80 00 00 	movabs $0x8010d7,%rcx
+  802c7c:	00 00 00 
+  802c7f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c81:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c88:	eb b5                	jmp    802c3f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c8a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802c91:	eb ac                	jmp    802c3f <write+0x65>
+
+0000000000802c93 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802c93:	55                   	push   %rbp
+  802c94:	48 89 e5             	mov    %rsp,%rbp
+  802c97:	53                   	push   %rbx
+  802c98:	48 83 ec 18          	sub    $0x18,%rsp
+  802c9c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c9e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ca2:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802ca9:	00 00 00 
+  802cac:	ff d0                	call   *%rax
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	78 0c                	js     802cbe <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802cb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc2:	c9                   	leave
+  802cc3:	c3                   	ret
+
+0000000000802cc4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	41 55                	push   %r13
+  802cca:	41 54                	push   %r12
+  802ccc:	53                   	push   %rbx
+  802ccd:	48 83 ec 18          	sub    $0x18,%rsp
+  802cd1:	89 fb                	mov    %edi,%ebx
+  802cd3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802cd6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cda:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802ce1:	00 00 00 
+  802ce4:	ff d0                	call   *%rax
+  802ce6:	85 c0                	test   %eax,%eax
+  802ce8:	78 38                	js     802d22 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802cea:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802cee:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802cf2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802cf6:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802cfd:	00 00 00 
+  802d00:	ff d0                	call   *%rax
+  802d02:	85 c0                	test   %eax,%eax
+  802d04:	78 1c                	js     802d22 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802d06:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802d0b:	74 20                	je     802d2d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d11:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802d15:	48 85 c0             	test   %rax,%rax
+  802d18:	74 47                	je     802d61 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802d1a:	44 89 e6             	mov    %r12d,%esi
+  802d1d:	4c 89 ef             	mov    %r13,%rdi
+  802d20:	ff d0                	call   *%rax
+}
+  802d22:	48 83 c4 18          	add    $0x18,%rsp
+  802d26:	5b                   	pop    %rbx
+  802d27:	41 5c                	pop    %r12
+  802d29:	41 5d                	pop    %r13
+  802d2b:	5d                   	pop    %rbp
+  802d2c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802d2d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802d34:	00 00 00 
+  802d37:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802d3d:	89 da                	mov    %ebx,%edx
+  802d3f:	48 bf d8 4f 80 00 00 	movabs $0x804fd8,%rdi
+  802d46:	00 00 00 
+  802d49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4e:	48 b9 d7 10 80 00 00 	movabs $0x8010d7,%rcx
+  802d55:	00 00 00 
+  802d58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802d5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5f:	eb c1                	jmp    802d22 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d61:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d66:	eb ba                	jmp    802d22 <ftruncate+0x5e>
+
+0000000000802d68 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802d68:	55                   	push   %rbp
+  802d69:	48 89 e5             	mov    %rsp,%rbp
+  802d6c:	41 54                	push   %r12
+  802d6e:	53                   	push   %rbx
+  802d6f:	48 83 ec 10          	sub    $0x10,%rsp
+  802d73:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d76:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d7a:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	78 4e                	js     802dd8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d8a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802d8e:	41 8b 3c 24          	mov    (%r12),%edi
+  802d92:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802d96:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+  802da2:	85 c0                	test   %eax,%eax
+  802da4:	78 32                	js     802dd8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802da6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802daa:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802daf:	74 30                	je     802de1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802db1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802db4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802dbb:	00 00 00 
+    stat->st_isdir = 0;
+  802dbe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802dc5:	00 00 00 
+    stat->st_dev = dev;
+  802dc8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802dcf:	48 89 de             	mov    %rbx,%rsi
+  802dd2:	4c 89 e7             	mov    %r12,%rdi
+  802dd5:	ff 50 30             	call   *0x30(%rax)
+}
+  802dd8:	48 83 c4 10          	add    $0x10,%rsp
+  802ddc:	5b                   	pop    %rbx
+  802ddd:	41 5c                	pop    %r12
+  802ddf:	5d                   	pop    %rbp
+  802de0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802de1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802de6:	eb f0                	jmp    802dd8 <fstat+0x70>
+
+0000000000802de8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802de8:	55                   	push   %rbp
+  802de9:	48 89 e5             	mov    %rsp,%rbp
+  802dec:	41 54                	push   %r12
+  802dee:	53                   	push   %rbx
+  802def:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802df2:	be 00 00 00 00       	mov    $0x0,%esi
+  802df7:	48 b8 3f 3b 80 00 00 	movabs $0x803b3f,%rax
+  802dfe:	00 00 00 
+  802e01:	ff d0                	call   *%rax
+  802e03:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802e05:	85 c0                	test   %eax,%eax
+  802e07:	78 25                	js     802e2e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802e09:	4c 89 e6             	mov    %r12,%rsi
+  802e0c:	89 c7                	mov    %eax,%edi
+  802e0e:	48 b8 68 2d 80 00 00 	movabs $0x802d68,%rax
+  802e15:	00 00 00 
+  802e18:	ff d0                	call   *%rax
+  802e1a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802e1d:	89 df                	mov    %ebx,%edi
+  802e1f:	48 b8 62 28 80 00 00 	movabs $0x802862,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+
+    return res;
+  802e2b:	44 89 e3             	mov    %r12d,%ebx
+}
+  802e2e:	89 d8                	mov    %ebx,%eax
+  802e30:	5b                   	pop    %rbx
+  802e31:	41 5c                	pop    %r12
+  802e33:	5d                   	pop    %rbp
+  802e34:	c3                   	ret
+
+0000000000802e35 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802e35:	55                   	push   %rbp
+  802e36:	48 89 e5             	mov    %rsp,%rbp
+  802e39:	41 54                	push   %r12
+  802e3b:	53                   	push   %rbx
+  802e3c:	48 83 ec 10          	sub    $0x10,%rsp
+  802e40:	48 89 fb             	mov    %rdi,%rbx
+  802e43:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e46:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e4a:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e4f:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	78 1f                	js     802e7e <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e63:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802e67:	48 85 c0             	test   %rax,%rax
+  802e6a:	74 1b                	je     802e87 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802e6c:	4c 89 e6             	mov    %r12,%rsi
+  802e6f:	48 89 df             	mov    %rbx,%rdi
+  802e72:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e74:	85 c0                	test   %eax,%eax
+  802e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802e7e:	48 83 c4 10          	add    $0x10,%rsp
+  802e82:	5b                   	pop    %rbx
+  802e83:	41 5c                	pop    %r12
+  802e85:	5d                   	pop    %rbp
+  802e86:	c3                   	ret
+        return -E_NOT_SUPP;
+  802e87:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e8c:	eb f0                	jmp    802e7e <create_snapshot+0x49>
+
+0000000000802e8e <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802e8e:	55                   	push   %rbp
+  802e8f:	48 89 e5             	mov    %rsp,%rbp
+  802e92:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802e96:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e9a:	bf 66 00 00 00       	mov    $0x66,%edi
+  802e9f:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802ea6:	00 00 00 
+  802ea9:	ff d0                	call   *%rax
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	78 1e                	js     802ecd <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802eaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb3:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802eb7:	48 85 d2             	test   %rdx,%rdx
+  802eba:	74 13                	je     802ecf <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec1:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eca:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802ecd:	c9                   	leave
+  802ece:	c3                   	ret
+        return -E_NOT_SUPP;
+  802ecf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802ed4:	eb f7                	jmp    802ecd <print_snapshot_list+0x3f>
+
+0000000000802ed6 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802ed6:	55                   	push   %rbp
+  802ed7:	48 89 e5             	mov    %rsp,%rbp
+  802eda:	53                   	push   %rbx
+  802edb:	48 83 ec 18          	sub    $0x18,%rsp
+  802edf:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802ee2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ee6:	bf 66 00 00 00       	mov    $0x66,%edi
+  802eeb:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802ef2:	00 00 00 
+  802ef5:	ff d0                	call   *%rax
+  802ef7:	85 c0                	test   %eax,%eax
+  802ef9:	78 1c                	js     802f17 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802efb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eff:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802f03:	48 85 c0             	test   %rax,%rax
+  802f06:	74 15                	je     802f1d <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802f08:	48 89 df             	mov    %rbx,%rdi
+  802f0b:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f14:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802f17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f1b:	c9                   	leave
+  802f1c:	c3                   	ret
+        return -E_NOT_SUPP;
+  802f1d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f22:	eb f3                	jmp    802f17 <accept_snapshot+0x41>
+
+0000000000802f24 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802f24:	55                   	push   %rbp
+  802f25:	48 89 e5             	mov    %rsp,%rbp
+  802f28:	53                   	push   %rbx
+  802f29:	48 83 ec 18          	sub    $0x18,%rsp
+  802f2d:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802f30:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802f34:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f39:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+  802f45:	85 c0                	test   %eax,%eax
+  802f47:	78 1c                	js     802f65 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f4d:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802f51:	48 85 c0             	test   %rax,%rax
+  802f54:	74 15                	je     802f6b <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802f56:	48 89 df             	mov    %rbx,%rdi
+  802f59:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f5b:	85 c0                	test   %eax,%eax
+  802f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f62:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802f65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+        return -E_NOT_SUPP;
+  802f6b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802f70:	eb f3                	jmp    802f65 <delete_snapshot+0x41>
+
+0000000000802f72 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802f7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f7e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802f83:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	78 14                	js     802fa7 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802f93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f97:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802f9b:	48 85 d2             	test   %rdx,%rdx
+  802f9e:	74 09                	je     802fa9 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa5:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802fa7:	c9                   	leave
+  802fa8:	c3                   	ret
+        return -E_NOT_SUPP;
+  802fa9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802fae:	eb f7                	jmp    802fa7 <gc_snapshots+0x35>
+
+0000000000802fb0 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802fb0:	55                   	push   %rbp
+  802fb1:	48 89 e5             	mov    %rsp,%rbp
+  802fb4:	41 56                	push   %r14
+  802fb6:	41 55                	push   %r13
+  802fb8:	41 54                	push   %r12
+  802fba:	53                   	push   %rbx
+  802fbb:	48 83 ec 10          	sub    $0x10,%rsp
+  802fbf:	48 89 fb             	mov    %rdi,%rbx
+  802fc2:	49 89 f4             	mov    %rsi,%r12
+  802fc5:	49 89 d5             	mov    %rdx,%r13
+  802fc8:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802fcb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fcf:	bf 66 00 00 00       	mov    $0x66,%edi
+  802fd4:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	78 1b                	js     802fff <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802fe4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fe8:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802fec:	48 85 c0             	test   %rax,%rax
+  802fef:	74 1b                	je     80300c <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802ff1:	4c 89 f1             	mov    %r14,%rcx
+  802ff4:	4c 89 ea             	mov    %r13,%rdx
+  802ff7:	4c 89 e6             	mov    %r12,%rsi
+  802ffa:	48 89 df             	mov    %rbx,%rdi
+  802ffd:	ff d0                	call   *%rax
+
+    return res;
+}
+  802fff:	48 83 c4 10          	add    $0x10,%rsp
+  803003:	5b                   	pop    %rbx
+  803004:	41 5c                	pop    %r12
+  803006:	41 5d                	pop    %r13
+  803008:	41 5e                	pop    %r14
+  80300a:	5d                   	pop    %rbp
+  80300b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80300c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803011:	eb ec                	jmp    802fff <diff_snapshots+0x4f>
+
+0000000000803013 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  803013:	55                   	push   %rbp
+  803014:	48 89 e5             	mov    %rsp,%rbp
+  803017:	41 55                	push   %r13
+  803019:	41 54                	push   %r12
+  80301b:	53                   	push   %rbx
+  80301c:	48 83 ec 18          	sub    $0x18,%rsp
+  803020:	48 89 fb             	mov    %rdi,%rbx
+  803023:	49 89 f4             	mov    %rsi,%r12
+  803026:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  803029:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80302d:	bf 66 00 00 00       	mov    $0x66,%edi
+  803032:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  803039:	00 00 00 
+  80303c:	ff d0                	call   *%rax
+  80303e:	85 c0                	test   %eax,%eax
+  803040:	78 18                	js     80305a <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  803042:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803046:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80304a:	48 85 c0             	test   %rax,%rax
+  80304d:	74 16                	je     803065 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80304f:	4c 89 ea             	mov    %r13,%rdx
+  803052:	4c 89 e6             	mov    %r12,%rsi
+  803055:	48 89 df             	mov    %rbx,%rdi
+  803058:	ff d0                	call   *%rax
+
+    return res;
+}
+  80305a:	48 83 c4 18          	add    $0x18,%rsp
+  80305e:	5b                   	pop    %rbx
+  80305f:	41 5c                	pop    %r12
+  803061:	41 5d                	pop    %r13
+  803063:	5d                   	pop    %rbp
+  803064:	c3                   	ret
+        return -E_NOT_SUPP;
+  803065:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80306a:	eb ee                	jmp    80305a <send_snapshot+0x47>
+
+000000000080306c <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80306c:	55                   	push   %rbp
+  80306d:	48 89 e5             	mov    %rsp,%rbp
+  803070:	53                   	push   %rbx
+  803071:	48 83 ec 18          	sub    $0x18,%rsp
+  803075:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  803078:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80307c:	bf 66 00 00 00       	mov    $0x66,%edi
+  803081:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	78 12                	js     8030a3 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  803091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803095:	48 8b 40 78          	mov    0x78(%rax),%rax
+  803099:	48 85 c0             	test   %rax,%rax
+  80309c:	74 0b                	je     8030a9 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80309e:	48 89 df             	mov    %rbx,%rdi
+  8030a1:	ff d0                	call   *%rax
+
+    return res;
+}
+  8030a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a7:	c9                   	leave
+  8030a8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8030a9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8030ae:	eb f3                	jmp    8030a3 <receive_snapshot+0x37>
+
+00000000008030b0 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8030b0:	55                   	push   %rbp
+  8030b1:	48 89 e5             	mov    %rsp,%rbp
+  8030b4:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8030b8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030bc:	bf 66 00 00 00       	mov    $0x66,%edi
+  8030c1:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+  8030cd:	85 c0                	test   %eax,%eax
+  8030cf:	78 17                	js     8030e8 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8030d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030d5:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8030dc:	48 85 d2             	test   %rdx,%rdx
+  8030df:	74 09                	je     8030ea <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8030e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e6:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8030e8:	c9                   	leave
+  8030e9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8030ea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8030ef:	eb f7                	jmp    8030e8 <free_space_bytes+0x38>
+
+00000000008030f1 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8030f1:	55                   	push   %rbp
+  8030f2:	48 89 e5             	mov    %rsp,%rbp
+  8030f5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8030f9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030fd:	bf 66 00 00 00       	mov    $0x66,%edi
+  803102:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	85 c0                	test   %eax,%eax
+  803110:	78 17                	js     803129 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  803112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803116:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80311d:	48 85 d2             	test   %rdx,%rdx
+  803120:	74 09                	je     80312b <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+  803127:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  803129:	c9                   	leave
+  80312a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80312b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803130:	eb f7                	jmp    803129 <busy_space_bytes+0x38>
+
+0000000000803132 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  803132:	55                   	push   %rbp
+  803133:	48 89 e5             	mov    %rsp,%rbp
+  803136:	41 54                	push   %r12
+  803138:	53                   	push   %rbx
+  803139:	48 83 ec 10          	sub    $0x10,%rsp
+  80313d:	89 fb                	mov    %edi,%ebx
+  80313f:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  803142:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803146:	bf 66 00 00 00       	mov    $0x66,%edi
+  80314b:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+  803157:	85 c0                	test   %eax,%eax
+  803159:	78 17                	js     803172 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80315b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80315f:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  803166:	48 85 c0             	test   %rax,%rax
+  803169:	74 10                	je     80317b <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80316b:	4c 89 e6             	mov    %r12,%rsi
+  80316e:	89 df                	mov    %ebx,%edi
+  803170:	ff d0                	call   *%rax
+    
+    return res;
+}
+  803172:	48 83 c4 10          	add    $0x10,%rsp
+  803176:	5b                   	pop    %rbx
+  803177:	41 5c                	pop    %r12
+  803179:	5d                   	pop    %rbp
+  80317a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80317b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803180:	eb f0                	jmp    803172 <snapshots_space+0x40>
+
+0000000000803182 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  803182:	55                   	push   %rbp
+  803183:	48 89 e5             	mov    %rsp,%rbp
+  803186:	41 55                	push   %r13
+  803188:	41 54                	push   %r12
+  80318a:	53                   	push   %rbx
+  80318b:	48 83 ec 08          	sub    $0x8,%rsp
+  80318f:	41 89 fd             	mov    %edi,%r13d
+  803192:	48 89 f3             	mov    %rsi,%rbx
+  803195:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803198:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80319f:	00 00 00 
+  8031a2:	83 38 00             	cmpl   $0x0,(%rax)
+  8031a5:	74 57                	je     8031fe <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8031a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8031ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031b2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8031b9:	00 00 00 
+  8031bc:	44 89 ee             	mov    %r13d,%esi
+  8031bf:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8031c6:	00 00 00 
+  8031c9:	8b 38                	mov    (%rax),%edi
+  8031cb:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  8031d2:	00 00 00 
+  8031d5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8031d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031dc:	4c 89 e2             	mov    %r12,%rdx
+  8031df:	48 89 de             	mov    %rbx,%rsi
+  8031e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e7:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+}
+  8031f3:	48 83 c4 08          	add    $0x8,%rsp
+  8031f7:	5b                   	pop    %rbx
+  8031f8:	41 5c                	pop    %r12
+  8031fa:	41 5d                	pop    %r13
+  8031fc:	5d                   	pop    %rbp
+  8031fd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  803203:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  803216:	00 00 
+  803218:	eb 8d                	jmp    8031a7 <fsipc_region+0x25>
+
+000000000080321a <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80321a:	55                   	push   %rbp
+  80321b:	48 89 e5             	mov    %rsp,%rbp
+  80321e:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  803222:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  803229:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80322a:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80322e:	48 b8 82 31 80 00 00 	movabs $0x803182,%rax
+  803235:	00 00 00 
+  803238:	ff d0                	call   *%rax
+}
+  80323a:	c9                   	leave
+  80323b:	c3                   	ret
+
+000000000080323c <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80323c:	85 ff                	test   %edi,%edi
+  80323e:	78 6d                	js     8032ad <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  803240:	55                   	push   %rbp
+  803241:	48 89 e5             	mov    %rsp,%rbp
+  803244:	41 54                	push   %r12
+  803246:	53                   	push   %rbx
+  803247:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80324a:	48 85 f6             	test   %rsi,%rsi
+  80324d:	74 57                	je     8032a6 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80324f:	89 f8                	mov    %edi,%eax
+  803251:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  803258:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80325a:	be 00 00 00 00       	mov    $0x0,%esi
+  80325f:	bf 12 00 00 00       	mov    $0x12,%edi
+  803264:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  80326b:	00 00 00 
+  80326e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803270:	85 c0                	test   %eax,%eax
+  803272:	78 2d                	js     8032a1 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  803274:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  80327b:	00 00 00 
+  80327e:	49 63 14 24          	movslq (%r12),%rdx
+  803282:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  803289:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80328e:	48 89 df             	mov    %rbx,%rdi
+  803291:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80329d:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8032a1:	5b                   	pop    %rbx
+  8032a2:	41 5c                	pop    %r12
+  8032a4:	5d                   	pop    %rbp
+  8032a5:	c3                   	ret
+        return -E_INVAL;
+  8032a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032ab:	eb f4                	jmp    8032a1 <devfile_df_snapshots+0x65>
+  8032ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032b2:	c3                   	ret
+
+00000000008032b3 <devfile_df_busy>:
+devfile_df_busy() {
+  8032b3:	55                   	push   %rbp
+  8032b4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8032b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8032bc:	bf 11 00 00 00       	mov    $0x11,%edi
+  8032c1:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  8032c8:	00 00 00 
+  8032cb:	ff d0                	call   *%rax
+}
+  8032cd:	5d                   	pop    %rbp
+  8032ce:	c3                   	ret
+
+00000000008032cf <devfile_df_free>:
+devfile_df_free() {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8032d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d8:	bf 10 00 00 00       	mov    $0x10,%edi
+  8032dd:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+}
+  8032e9:	5d                   	pop    %rbp
+  8032ea:	c3                   	ret
+
+00000000008032eb <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8032eb:	55                   	push   %rbp
+  8032ec:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8032ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8032f4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8032f9:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+}
+  803305:	5d                   	pop    %rbp
+  803306:	c3                   	ret
+
+0000000000803307 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  803307:	55                   	push   %rbp
+  803308:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80330b:	be 00 00 00 00       	mov    $0x0,%esi
+  803310:	bf 09 00 00 00       	mov    $0x9,%edi
+  803315:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  80331c:	00 00 00 
+  80331f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803321:	85 c0                	test   %eax,%eax
+  803323:	ba 00 00 00 00       	mov    $0x0,%edx
+  803328:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80332b:	5d                   	pop    %rbp
+  80332c:	c3                   	ret
+
+000000000080332d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80332d:	55                   	push   %rbp
+  80332e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803331:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803338:	00 00 00 
+  80333b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80333e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803340:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  803343:	be 00 00 00 00       	mov    $0x0,%esi
+  803348:	bf 02 00 00 00       	mov    $0x2,%edi
+  80334d:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803354:	00 00 00 
+  803357:	ff d0                	call   *%rax
+}
+  803359:	5d                   	pop    %rbp
+  80335a:	c3                   	ret
+
+000000000080335b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80335b:	55                   	push   %rbp
+  80335c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80335f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803362:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  803369:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80336b:	be 00 00 00 00       	mov    $0x0,%esi
+  803370:	bf 06 00 00 00       	mov    $0x6,%edi
+  803375:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+}
+  803381:	5d                   	pop    %rbp
+  803382:	c3                   	ret
+
+0000000000803383 <devfile_write>:
+    if (!fd || !buf) {
+  803383:	48 85 ff             	test   %rdi,%rdi
+  803386:	0f 84 c1 00 00 00    	je     80344d <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80338c:	55                   	push   %rbp
+  80338d:	48 89 e5             	mov    %rsp,%rbp
+  803390:	41 57                	push   %r15
+  803392:	41 56                	push   %r14
+  803394:	41 55                	push   %r13
+  803396:	41 54                	push   %r12
+  803398:	53                   	push   %rbx
+  803399:	48 83 ec 18          	sub    $0x18,%rsp
+  80339d:	49 89 ff             	mov    %rdi,%r15
+  8033a0:	49 89 f5             	mov    %rsi,%r13
+  8033a3:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8033a6:	48 85 f6             	test   %rsi,%rsi
+  8033a9:	0f 84 95 00 00 00    	je     803444 <devfile_write+0xc1>
+    while (n) {
+  8033af:	48 85 d2             	test   %rdx,%rdx
+  8033b2:	0f 84 83 00 00 00    	je     80343b <devfile_write+0xb8>
+    int totalWrite = 0;
+  8033b8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8033bf:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  8033c6:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8033c9:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8033ce:	49 39 dc             	cmp    %rbx,%r12
+  8033d1:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8033d5:	48 89 da             	mov    %rbx,%rdx
+  8033d8:	4c 89 ee             	mov    %r13,%rsi
+  8033db:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8033e2:	00 00 00 
+  8033e5:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8033f1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033f5:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8033f8:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8033fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803401:	bf 04 00 00 00       	mov    $0x4,%edi
+  803406:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+        if (write < 0) {
+  803412:	85 c0                	test   %eax,%eax
+  803414:	78 21                	js     803437 <devfile_write+0xb4>
+        buf += write;
+  803416:	48 63 d0             	movslq %eax,%rdx
+  803419:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80341c:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80341f:	49 29 d4             	sub    %rdx,%r12
+  803422:	75 a5                	jne    8033c9 <devfile_write+0x46>
+    return totalWrite;
+  803424:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  803428:	48 83 c4 18          	add    $0x18,%rsp
+  80342c:	5b                   	pop    %rbx
+  80342d:	41 5c                	pop    %r12
+  80342f:	41 5d                	pop    %r13
+  803431:	41 5e                	pop    %r14
+  803433:	41 5f                	pop    %r15
+  803435:	5d                   	pop    %rbp
+  803436:	c3                   	ret
+            return write;
+  803437:	48 98                	cltq
+  803439:	eb ed                	jmp    803428 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80343b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  803442:	eb e0                	jmp    803424 <devfile_write+0xa1>
+        return -E_INVAL;
+  803444:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80344b:	eb db                	jmp    803428 <devfile_write+0xa5>
+  80344d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  803454:	c3                   	ret
+
+0000000000803455 <devfile_read>:
+    if (!fd || !buf) {
+  803455:	48 85 ff             	test   %rdi,%rdi
+  803458:	0f 84 c0 00 00 00    	je     80351e <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80345e:	55                   	push   %rbp
+  80345f:	48 89 e5             	mov    %rsp,%rbp
+  803462:	41 57                	push   %r15
+  803464:	41 56                	push   %r14
+  803466:	41 55                	push   %r13
+  803468:	41 54                	push   %r12
+  80346a:	53                   	push   %rbx
+  80346b:	48 83 ec 18          	sub    $0x18,%rsp
+  80346f:	49 89 ff             	mov    %rdi,%r15
+  803472:	49 89 f5             	mov    %rsi,%r13
+  803475:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  803478:	48 85 f6             	test   %rsi,%rsi
+  80347b:	0f 84 96 00 00 00    	je     803517 <devfile_read+0xc2>
+    while (n) {
+  803481:	48 85 d2             	test   %rdx,%rdx
+  803484:	0f 84 87 00 00 00    	je     803511 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80348a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803491:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803492:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  803499:	00 00 00 
+  80349c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8034a0:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8034a3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8034a8:	49 39 c4             	cmp    %rax,%r12
+  8034ab:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8034af:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8034b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034bd:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	7e 37                	jle    803504 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8034cd:	48 63 d8             	movslq %eax,%rbx
+  8034d0:	48 89 da             	mov    %rbx,%rdx
+  8034d3:	4c 89 f6             	mov    %r14,%rsi
+  8034d6:	4c 89 ef             	mov    %r13,%rdi
+  8034d9:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  8034e0:	00 00 00 
+  8034e3:	ff d0                	call   *%rax
+        buf += read;
+  8034e5:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8034e8:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8034ec:	49 29 dc             	sub    %rbx,%r12
+  8034ef:	75 ab                	jne    80349c <devfile_read+0x47>
+  return totalRead;
+  8034f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8034f5:	48 83 c4 18          	add    $0x18,%rsp
+  8034f9:	5b                   	pop    %rbx
+  8034fa:	41 5c                	pop    %r12
+  8034fc:	41 5d                	pop    %r13
+  8034fe:	41 5e                	pop    %r14
+  803500:	41 5f                	pop    %r15
+  803502:	5d                   	pop    %rbp
+  803503:	c3                   	ret
+            return read ? read : totalRead;
+  803504:	48 63 d0             	movslq %eax,%rdx
+  803507:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80350b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80350f:	eb e4                	jmp    8034f5 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  803511:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803515:	eb da                	jmp    8034f1 <devfile_read+0x9c>
+        return E_INVAL;
+  803517:	b8 03 00 00 00       	mov    $0x3,%eax
+  80351c:	eb d7                	jmp    8034f5 <devfile_read+0xa0>
+  80351e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803523:	c3                   	ret
+
+0000000000803524 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  803524:	48 85 ff             	test   %rdi,%rdi
+  803527:	74 5f                	je     803588 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  803529:	55                   	push   %rbp
+  80352a:	48 89 e5             	mov    %rsp,%rbp
+  80352d:	53                   	push   %rbx
+  80352e:	48 83 ec 08          	sub    $0x8,%rsp
+  803532:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  803535:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+  803541:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803547:	77 45                	ja     80358e <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  803549:	48 89 de             	mov    %rbx,%rsi
+  80354c:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803553:	00 00 00 
+  803556:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  80355d:	00 00 00 
+  803560:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  803562:	be 00 00 00 00       	mov    $0x0,%esi
+  803567:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80356c:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803582:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+        return -E_INVAL;
+  803588:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80358d:	c3                   	ret
+        return -E_INVAL;
+  80358e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803593:	eb ed                	jmp    803582 <devfile_receive_snapshot+0x5e>
+
+0000000000803595 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  803595:	55                   	push   %rbp
+  803596:	48 89 e5             	mov    %rsp,%rbp
+  803599:	41 55                	push   %r13
+  80359b:	41 54                	push   %r12
+  80359d:	53                   	push   %rbx
+  80359e:	48 83 ec 08          	sub    $0x8,%rsp
+  8035a2:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8035a5:	48 85 f6             	test   %rsi,%rsi
+  8035a8:	0f 94 c0             	sete   %al
+  8035ab:	48 85 d2             	test   %rdx,%rdx
+  8035ae:	0f 94 c2             	sete   %dl
+  8035b1:	08 d0                	or     %dl,%al
+  8035b3:	0f 85 ad 00 00 00    	jne    803666 <devfile_send_snapshot+0xd1>
+  8035b9:	48 89 fb             	mov    %rdi,%rbx
+  8035bc:	49 89 f4             	mov    %rsi,%r12
+  8035bf:	48 85 ff             	test   %rdi,%rdi
+  8035c2:	0f 84 9e 00 00 00    	je     803666 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8035c8:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8035cf:	00 00 00 
+  8035d2:	ff d0                	call   *%rax
+  8035d4:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8035da:	0f 87 8d 00 00 00    	ja     80366d <devfile_send_snapshot+0xd8>
+  8035e0:	4c 89 e7             	mov    %r12,%rdi
+  8035e3:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8035ea:	00 00 00 
+  8035ed:	ff d0                	call   *%rax
+  8035ef:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8035f5:	77 7d                	ja     803674 <devfile_send_snapshot+0xdf>
+  8035f7:	4c 89 ef             	mov    %r13,%rdi
+  8035fa:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  803601:	00 00 00 
+  803604:	ff d0                	call   *%rax
+  803606:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80360c:	77 6d                	ja     80367b <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80360e:	48 89 de             	mov    %rbx,%rsi
+  803611:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803618:	00 00 00 
+  80361b:	48 bb fc 19 80 00 00 	movabs $0x8019fc,%rbx
+  803622:	00 00 00 
+  803625:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  803627:	4c 89 e6             	mov    %r12,%rsi
+  80362a:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  803631:	00 00 00 
+  803634:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  803636:	4c 89 ee             	mov    %r13,%rsi
+  803639:	48 bf 00 82 80 00 00 	movabs $0x808200,%rdi
+  803640:	00 00 00 
+  803643:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  803645:	be 00 00 00 00       	mov    $0x0,%esi
+  80364a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80364f:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+}
+  80365b:	48 83 c4 08          	add    $0x8,%rsp
+  80365f:	5b                   	pop    %rbx
+  803660:	41 5c                	pop    %r12
+  803662:	41 5d                	pop    %r13
+  803664:	5d                   	pop    %rbp
+  803665:	c3                   	ret
+        return -E_INVAL;
+  803666:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80366b:	eb ee                	jmp    80365b <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80366d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803672:	eb e7                	jmp    80365b <devfile_send_snapshot+0xc6>
+  803674:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803679:	eb e0                	jmp    80365b <devfile_send_snapshot+0xc6>
+  80367b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803680:	eb d9                	jmp    80365b <devfile_send_snapshot+0xc6>
+
+0000000000803682 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  803682:	48 85 ff             	test   %rdi,%rdi
+  803685:	0f 84 41 01 00 00    	je     8037cc <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80368b:	55                   	push   %rbp
+  80368c:	48 89 e5             	mov    %rsp,%rbp
+  80368f:	41 57                	push   %r15
+  803691:	41 56                	push   %r14
+  803693:	41 55                	push   %r13
+  803695:	41 54                	push   %r12
+  803697:	53                   	push   %rbx
+  803698:	48 83 ec 08          	sub    $0x8,%rsp
+  80369c:	49 89 fc             	mov    %rdi,%r12
+  80369f:	49 89 f5             	mov    %rsi,%r13
+  8036a2:	48 89 d3             	mov    %rdx,%rbx
+  8036a5:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8036a8:	48 85 f6             	test   %rsi,%rsi
+  8036ab:	0f 84 ff 00 00 00    	je     8037b0 <devfile_diff_snapshots+0x12e>
+  8036b1:	48 85 d2             	test   %rdx,%rdx
+  8036b4:	0f 84 fd 00 00 00    	je     8037b7 <devfile_diff_snapshots+0x135>
+  8036ba:	48 85 c9             	test   %rcx,%rcx
+  8036bd:	0f 84 f4 00 00 00    	je     8037b7 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8036c3:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+  8036cf:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8036d5:	0f 87 e3 00 00 00    	ja     8037be <devfile_diff_snapshots+0x13c>
+  8036db:	4c 89 ef             	mov    %r13,%rdi
+  8036de:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8036e5:	00 00 00 
+  8036e8:	ff d0                	call   *%rax
+  8036ea:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8036f0:	0f 87 cf 00 00 00    	ja     8037c5 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8036f6:	4c 89 e6             	mov    %r12,%rsi
+  8036f9:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  803700:	00 00 00 
+  803703:	4c 89 e7             	mov    %r12,%rdi
+  803706:	49 bf fc 19 80 00 00 	movabs $0x8019fc,%r15
+  80370d:	00 00 00 
+  803710:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  803713:	4c 89 ee             	mov    %r13,%rsi
+  803716:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80371d:	00 
+  80371e:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  803721:	48 8b 03             	mov    (%rbx),%rax
+  803724:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80372b:	00 
+  80372c:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  803730:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  803737:	00 
+  803738:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80373c:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  803743:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  803744:	be 00 00 00 00       	mov    $0x0,%esi
+  803749:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80374e:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	78 43                	js     8037a1 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  80375e:	49 8b 04 24          	mov    (%r12),%rax
+  803762:	48 89 03             	mov    %rax,(%rbx)
+  803765:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80376a:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  80376e:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  803773:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  803777:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80377c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803780:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803784:	48 c1 e2 03          	shl    $0x3,%rdx
+  803788:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80378d:	4c 89 f7             	mov    %r14,%rdi
+  803790:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  803797:	00 00 00 
+  80379a:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  80379c:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8037a1:	48 83 c4 08          	add    $0x8,%rsp
+  8037a5:	5b                   	pop    %rbx
+  8037a6:	41 5c                	pop    %r12
+  8037a8:	41 5d                	pop    %r13
+  8037aa:	41 5e                	pop    %r14
+  8037ac:	41 5f                	pop    %r15
+  8037ae:	5d                   	pop    %rbp
+  8037af:	c3                   	ret
+        return -E_INVAL;
+  8037b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037b5:	eb ea                	jmp    8037a1 <devfile_diff_snapshots+0x11f>
+  8037b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037bc:	eb e3                	jmp    8037a1 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8037be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037c3:	eb dc                	jmp    8037a1 <devfile_diff_snapshots+0x11f>
+  8037c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037ca:	eb d5                	jmp    8037a1 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8037cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8037d1:	c3                   	ret
+
+00000000008037d2 <devfile_delete_snapshot>:
+    if (!name) {
+  8037d2:	48 85 ff             	test   %rdi,%rdi
+  8037d5:	74 5f                	je     803836 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8037d7:	55                   	push   %rbp
+  8037d8:	48 89 e5             	mov    %rsp,%rbp
+  8037db:	53                   	push   %rbx
+  8037dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8037e0:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8037e3:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8037ea:	00 00 00 
+  8037ed:	ff d0                	call   *%rax
+  8037ef:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8037f5:	77 45                	ja     80383c <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  8037f7:	48 89 de             	mov    %rbx,%rsi
+  8037fa:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803801:	00 00 00 
+  803804:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  80380b:	00 00 00 
+  80380e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  803810:	be 00 00 00 00       	mov    $0x0,%esi
+  803815:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80381a:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803821:	00 00 00 
+  803824:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803826:	85 c0                	test   %eax,%eax
+  803828:	ba 00 00 00 00       	mov    $0x0,%edx
+  80382d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803830:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803834:	c9                   	leave
+  803835:	c3                   	ret
+        return -E_INVAL;
+  803836:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80383b:	c3                   	ret
+        return -E_INVAL;
+  80383c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803841:	eb ed                	jmp    803830 <devfile_delete_snapshot+0x5e>
+
+0000000000803843 <devfile_accept_snapshot>:
+    if (!name) {
+  803843:	48 85 ff             	test   %rdi,%rdi
+  803846:	74 5f                	je     8038a7 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  803848:	55                   	push   %rbp
+  803849:	48 89 e5             	mov    %rsp,%rbp
+  80384c:	53                   	push   %rbx
+  80384d:	48 83 ec 08          	sub    $0x8,%rsp
+  803851:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  803854:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  80385b:	00 00 00 
+  80385e:	ff d0                	call   *%rax
+  803860:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803866:	77 45                	ja     8038ad <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  803868:	48 89 de             	mov    %rbx,%rsi
+  80386b:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803872:	00 00 00 
+  803875:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  803881:	be 00 00 00 00       	mov    $0x0,%esi
+  803886:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80388b:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803892:	00 00 00 
+  803895:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803897:	85 c0                	test   %eax,%eax
+  803899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80389e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8038a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038a5:	c9                   	leave
+  8038a6:	c3                   	ret
+        return -E_INVAL;
+  8038a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038ac:	c3                   	ret
+        return -E_INVAL;
+  8038ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038b2:	eb ed                	jmp    8038a1 <devfile_accept_snapshot+0x5e>
+
+00000000008038b4 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  8038b4:	48 85 ff             	test   %rdi,%rdi
+  8038b7:	0f 84 9f 00 00 00    	je     80395c <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  8038bd:	55                   	push   %rbp
+  8038be:	48 89 e5             	mov    %rsp,%rbp
+  8038c1:	41 54                	push   %r12
+  8038c3:	53                   	push   %rbx
+  8038c4:	48 89 fb             	mov    %rdi,%rbx
+  8038c7:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  8038ca:	48 85 f6             	test   %rsi,%rsi
+  8038cd:	74 78                	je     803947 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  8038cf:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8038d6:	00 00 00 
+  8038d9:	ff d0                	call   *%rax
+  8038db:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8038e1:	77 6b                	ja     80394e <devfile_create_snapshot+0x9a>
+  8038e3:	4c 89 e7             	mov    %r12,%rdi
+  8038e6:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+  8038f2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8038f8:	77 5b                	ja     803955 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  8038fa:	48 89 de             	mov    %rbx,%rsi
+  8038fd:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803904:	00 00 00 
+  803907:	48 bb fc 19 80 00 00 	movabs $0x8019fc,%rbx
+  80390e:	00 00 00 
+  803911:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  803913:	4c 89 e6             	mov    %r12,%rsi
+  803916:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  80391d:	00 00 00 
+  803920:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  803922:	be 00 00 00 00       	mov    $0x0,%esi
+  803927:	bf 08 00 00 00       	mov    $0x8,%edi
+  80392c:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80393f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803942:	5b                   	pop    %rbx
+  803943:	41 5c                	pop    %r12
+  803945:	5d                   	pop    %rbp
+  803946:	c3                   	ret
+        return -E_INVAL;
+  803947:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80394c:	eb f4                	jmp    803942 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80394e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803953:	eb ed                	jmp    803942 <devfile_create_snapshot+0x8e>
+  803955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80395a:	eb e6                	jmp    803942 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  80395c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803961:	c3                   	ret
+
+0000000000803962 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803962:	55                   	push   %rbp
+  803963:	48 89 e5             	mov    %rsp,%rbp
+  803966:	41 54                	push   %r12
+  803968:	53                   	push   %rbx
+  803969:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80396c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80396f:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  803976:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  803978:	be 00 00 00 00       	mov    $0x0,%esi
+  80397d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803982:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803989:	00 00 00 
+  80398c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80398e:	85 c0                	test   %eax,%eax
+  803990:	78 3d                	js     8039cf <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803992:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  803999:	00 00 00 
+  80399c:	4c 89 e6             	mov    %r12,%rsi
+  80399f:	48 89 df             	mov    %rbx,%rdi
+  8039a2:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8039a9:	00 00 00 
+  8039ac:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8039ae:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8039b5:	00 
+  8039b6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039bc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8039c3:	00 
+  8039c4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8039ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039cf:	5b                   	pop    %rbx
+  8039d0:	41 5c                	pop    %r12
+  8039d2:	5d                   	pop    %rbp
+  8039d3:	c3                   	ret
+
+00000000008039d4 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  8039d4:	55                   	push   %rbp
+  8039d5:	48 89 e5             	mov    %rsp,%rbp
+  8039d8:	41 57                	push   %r15
+  8039da:	41 56                	push   %r14
+  8039dc:	41 55                	push   %r13
+  8039de:	41 54                	push   %r12
+  8039e0:	53                   	push   %rbx
+  8039e1:	48 83 ec 38          	sub    $0x38,%rsp
+  8039e5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8039e9:	49 89 f5             	mov    %rsi,%r13
+  8039ec:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8039ef:	48 89 f0             	mov    %rsi,%rax
+  8039f2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8039f7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8039fb:	75 4f                	jne    803a4c <devfile_readmap+0x78>
+  8039fd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a01:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803a07:	75 1f                	jne    803a28 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  803a09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a0d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  803a11:	49 be bc 41 80 00 00 	movabs $0x8041bc,%r14
+  803a18:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803a1b:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  803a22:	0f 87 9d 00 00 00    	ja     803ac5 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  803a28:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a2c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  803a30:	4d 85 ff             	test   %r15,%r15
+  803a33:	0f 85 cf 00 00 00    	jne    803b08 <devfile_readmap+0x134>
+  803a39:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  803a3d:	48 83 c4 38          	add    $0x38,%rsp
+  803a41:	5b                   	pop    %rbx
+  803a42:	41 5c                	pop    %r12
+  803a44:	41 5d                	pop    %r13
+  803a46:	41 5e                	pop    %r14
+  803a48:	41 5f                	pop    %r15
+  803a4a:	5d                   	pop    %rbp
+  803a4b:	c3                   	ret
+    size_t totalRead = 0;
+  803a4c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  803a53:	00 
+  803a54:	eb da                	jmp    803a30 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a56:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a5a:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a5d:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803a64:	00 00 00 
+  803a67:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  803a69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a6d:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  803a71:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a75:	4c 89 ee             	mov    %r13,%rsi
+  803a78:	bf 14 00 00 00       	mov    $0x14,%edi
+  803a7d:	48 b8 82 31 80 00 00 	movabs $0x803182,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  803a89:	85 c0                	test   %eax,%eax
+  803a8b:	7e a3                	jle    803a30 <devfile_readmap+0x5c>
+  803a8d:	48 98                	cltq
+  803a8f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803a93:	72 9b                	jb     803a30 <devfile_readmap+0x5c>
+        buf += read;
+  803a95:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  803a98:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  803a9b:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803a9f:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  803aa6:	75 88                	jne    803a30 <devfile_readmap+0x5c>
+  803aa8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803aac:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803ab2:	0f 85 78 ff ff ff    	jne    803a30 <devfile_readmap+0x5c>
+  803ab8:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  803abf:	0f 86 6b ff ff ff    	jbe    803a30 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  803ac5:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  803acb:	4d 39 e7             	cmp    %r12,%r15
+  803ace:	4d 0f 46 e7          	cmovbe %r15,%r12
+  803ad2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  803ad9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  803add:	0f 84 73 ff ff ff    	je     803a56 <devfile_readmap+0x82>
+  803ae3:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  803ae7:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  803aec:	41 ff d6             	call   *%r14
+  803aef:	a8 40                	test   $0x40,%al
+  803af1:	0f 85 39 ff ff ff    	jne    803a30 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  803af7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803afe:	4c 39 e3             	cmp    %r12,%rbx
+  803b01:	72 e4                	jb     803ae7 <devfile_readmap+0x113>
+  803b03:	e9 4e ff ff ff       	jmp    803a56 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  803b08:	4c 89 fa             	mov    %r15,%rdx
+  803b0b:	4c 89 ee             	mov    %r13,%rsi
+  803b0e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803b12:	48 b8 55 34 80 00 00 	movabs $0x803455,%rax
+  803b19:	00 00 00 
+  803b1c:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  803b1e:	48 85 c0             	test   %rax,%rax
+  803b21:	78 0c                	js     803b2f <devfile_readmap+0x15b>
+    return totalRead + read;
+  803b23:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803b27:	48 01 f0             	add    %rsi,%rax
+  803b2a:	e9 0e ff ff ff       	jmp    803a3d <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  803b2f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803b33:	48 85 f6             	test   %rsi,%rsi
+  803b36:	48 0f 45 c6          	cmovne %rsi,%rax
+  803b3a:	e9 fe fe ff ff       	jmp    803a3d <devfile_readmap+0x69>
+
+0000000000803b3f <open>:
+open(const char *path, int mode) {
+  803b3f:	55                   	push   %rbp
+  803b40:	48 89 e5             	mov    %rsp,%rbp
+  803b43:	41 55                	push   %r13
+  803b45:	41 54                	push   %r12
+  803b47:	53                   	push   %rbx
+  803b48:	48 83 ec 18          	sub    $0x18,%rsp
+  803b4c:	49 89 fc             	mov    %rdi,%r12
+  803b4f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803b52:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+  803b5e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803b64:	0f 87 8a 00 00 00    	ja     803bf4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b6a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b6e:	48 b8 9d 26 80 00 00 	movabs $0x80269d,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+  803b7a:	89 c3                	mov    %eax,%ebx
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	78 50                	js     803bd0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803b80:	4c 89 e6             	mov    %r12,%rsi
+  803b83:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  803b8a:	00 00 00 
+  803b8d:	48 89 df             	mov    %rbx,%rdi
+  803b90:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  803b97:	00 00 00 
+  803b9a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803b9c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ba3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ba7:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bac:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803bb3:	00 00 00 
+  803bb6:	ff d0                	call   *%rax
+  803bb8:	89 c3                	mov    %eax,%ebx
+  803bba:	85 c0                	test   %eax,%eax
+  803bbc:	78 1f                	js     803bdd <open+0x9e>
+    return fd2num(fd);
+  803bbe:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bc2:	48 b8 6f 26 80 00 00 	movabs $0x80266f,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+  803bce:	89 c3                	mov    %eax,%ebx
+}
+  803bd0:	89 d8                	mov    %ebx,%eax
+  803bd2:	48 83 c4 18          	add    $0x18,%rsp
+  803bd6:	5b                   	pop    %rbx
+  803bd7:	41 5c                	pop    %r12
+  803bd9:	41 5d                	pop    %r13
+  803bdb:	5d                   	pop    %rbp
+  803bdc:	c3                   	ret
+        fd_close(fd, 0);
+  803bdd:	be 00 00 00 00       	mov    $0x0,%esi
+  803be2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803be6:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  803bed:	00 00 00 
+  803bf0:	ff d0                	call   *%rax
+        return res;
+  803bf2:	eb dc                	jmp    803bd0 <open+0x91>
+        return -E_BAD_PATH;
+  803bf4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803bf9:	eb d5                	jmp    803bd0 <open+0x91>
+
+0000000000803bfb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803bff:	be 00 00 00 00       	mov    $0x0,%esi
+  803c04:	bf 13 00 00 00       	mov    $0x13,%edi
+  803c09:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803c10:	00 00 00 
+  803c13:	ff d0                	call   *%rax
+}
+  803c15:	5d                   	pop    %rbp
+  803c16:	c3                   	ret
+
+0000000000803c17 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803c17:	55                   	push   %rbp
+  803c18:	48 89 e5             	mov    %rsp,%rbp
+  803c1b:	41 54                	push   %r12
+  803c1d:	53                   	push   %rbx
+  803c1e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c21:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803c28:	00 00 00 
+  803c2b:	ff d0                	call   *%rax
+  803c2d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803c30:	48 be 60 50 80 00 00 	movabs $0x805060,%rsi
+  803c37:	00 00 00 
+  803c3a:	48 89 df             	mov    %rbx,%rdi
+  803c3d:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  803c44:	00 00 00 
+  803c47:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803c49:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803c4e:	41 2b 04 24          	sub    (%r12),%eax
+  803c52:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803c58:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c5f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803c62:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  803c69:	00 00 00 
+  803c6c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c78:	5b                   	pop    %rbx
+  803c79:	41 5c                	pop    %r12
+  803c7b:	5d                   	pop    %rbp
+  803c7c:	c3                   	ret
+
+0000000000803c7d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803c7d:	55                   	push   %rbp
+  803c7e:	48 89 e5             	mov    %rsp,%rbp
+  803c81:	41 54                	push   %r12
+  803c83:	53                   	push   %rbx
+  803c84:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803c87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c8c:	48 89 fe             	mov    %rdi,%rsi
+  803c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c94:	49 bc 54 21 80 00 00 	movabs $0x802154,%r12
+  803c9b:	00 00 00 
+  803c9e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803ca1:	48 89 df             	mov    %rbx,%rdi
+  803ca4:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803cab:	00 00 00 
+  803cae:	ff d0                	call   *%rax
+  803cb0:	48 89 c6             	mov    %rax,%rsi
+  803cb3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cbd:	41 ff d4             	call   *%r12
+}
+  803cc0:	5b                   	pop    %rbx
+  803cc1:	41 5c                	pop    %r12
+  803cc3:	5d                   	pop    %rbp
+  803cc4:	c3                   	ret
+
+0000000000803cc5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803cc5:	55                   	push   %rbp
+  803cc6:	48 89 e5             	mov    %rsp,%rbp
+  803cc9:	41 57                	push   %r15
+  803ccb:	41 56                	push   %r14
+  803ccd:	41 55                	push   %r13
+  803ccf:	41 54                	push   %r12
+  803cd1:	53                   	push   %rbx
+  803cd2:	48 83 ec 18          	sub    $0x18,%rsp
+  803cd6:	49 89 fc             	mov    %rdi,%r12
+  803cd9:	49 89 f5             	mov    %rsi,%r13
+  803cdc:	49 89 d7             	mov    %rdx,%r15
+  803cdf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ce3:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803cef:	4d 85 ff             	test   %r15,%r15
+  803cf2:	0f 84 af 00 00 00    	je     803da7 <devpipe_write+0xe2>
+  803cf8:	48 89 c3             	mov    %rax,%rbx
+  803cfb:	4c 89 f8             	mov    %r15,%rax
+  803cfe:	4d 89 ef             	mov    %r13,%r15
+  803d01:	4c 01 e8             	add    %r13,%rax
+  803d04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d08:	49 bd 5c 20 80 00 00 	movabs $0x80205c,%r13
+  803d0f:	00 00 00 
+            sys_yield();
+  803d12:	49 be f9 1f 80 00 00 	movabs $0x801ff9,%r14
+  803d19:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803d1c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803d1f:	48 63 ce             	movslq %esi,%rcx
+  803d22:	48 63 03             	movslq (%rbx),%rax
+  803d25:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803d2b:	48 39 c1             	cmp    %rax,%rcx
+  803d2e:	72 2e                	jb     803d5e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d30:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803d35:	48 89 da             	mov    %rbx,%rdx
+  803d38:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d3d:	4c 89 e7             	mov    %r12,%rdi
+  803d40:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803d43:	85 c0                	test   %eax,%eax
+  803d45:	74 66                	je     803dad <devpipe_write+0xe8>
+            sys_yield();
+  803d47:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803d4a:	8b 73 04             	mov    0x4(%rbx),%esi
+  803d4d:	48 63 ce             	movslq %esi,%rcx
+  803d50:	48 63 03             	movslq (%rbx),%rax
+  803d53:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803d59:	48 39 c1             	cmp    %rax,%rcx
+  803d5c:	73 d2                	jae    803d30 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d5e:	41 0f b6 3f          	movzbl (%r15),%edi
+  803d62:	48 89 ca             	mov    %rcx,%rdx
+  803d65:	48 c1 ea 03          	shr    $0x3,%rdx
+  803d69:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803d70:	08 10 20 
+  803d73:	48 f7 e2             	mul    %rdx
+  803d76:	48 c1 ea 06          	shr    $0x6,%rdx
+  803d7a:	48 89 d0             	mov    %rdx,%rax
+  803d7d:	48 c1 e0 09          	shl    $0x9,%rax
+  803d81:	48 29 d0             	sub    %rdx,%rax
+  803d84:	48 c1 e0 03          	shl    $0x3,%rax
+  803d88:	48 29 c1             	sub    %rax,%rcx
+  803d8b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d90:	83 c6 01             	add    $0x1,%esi
+  803d93:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d96:	49 83 c7 01          	add    $0x1,%r15
+  803d9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d9e:	49 39 c7             	cmp    %rax,%r15
+  803da1:	0f 85 75 ff ff ff    	jne    803d1c <devpipe_write+0x57>
+    return n;
+  803da7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dab:	eb 05                	jmp    803db2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803dad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803db2:	48 83 c4 18          	add    $0x18,%rsp
+  803db6:	5b                   	pop    %rbx
+  803db7:	41 5c                	pop    %r12
+  803db9:	41 5d                	pop    %r13
+  803dbb:	41 5e                	pop    %r14
+  803dbd:	41 5f                	pop    %r15
+  803dbf:	5d                   	pop    %rbp
+  803dc0:	c3                   	ret
+
+0000000000803dc1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dc1:	55                   	push   %rbp
+  803dc2:	48 89 e5             	mov    %rsp,%rbp
+  803dc5:	41 57                	push   %r15
+  803dc7:	41 56                	push   %r14
+  803dc9:	41 55                	push   %r13
+  803dcb:	41 54                	push   %r12
+  803dcd:	53                   	push   %rbx
+  803dce:	48 83 ec 18          	sub    $0x18,%rsp
+  803dd2:	49 89 fc             	mov    %rdi,%r12
+  803dd5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803dd9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ddd:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+  803de9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803dec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803df2:	49 bd 5c 20 80 00 00 	movabs $0x80205c,%r13
+  803df9:	00 00 00 
+            sys_yield();
+  803dfc:	49 be f9 1f 80 00 00 	movabs $0x801ff9,%r14
+  803e03:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803e06:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803e0b:	74 7d                	je     803e8a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e0d:	8b 03                	mov    (%rbx),%eax
+  803e0f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e12:	75 26                	jne    803e3a <devpipe_read+0x79>
+            if (i > 0) return i;
+  803e14:	4d 85 ff             	test   %r15,%r15
+  803e17:	75 77                	jne    803e90 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e19:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e1e:	48 89 da             	mov    %rbx,%rdx
+  803e21:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e26:	4c 89 e7             	mov    %r12,%rdi
+  803e29:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e2c:	85 c0                	test   %eax,%eax
+  803e2e:	74 72                	je     803ea2 <devpipe_read+0xe1>
+            sys_yield();
+  803e30:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e33:	8b 03                	mov    (%rbx),%eax
+  803e35:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e38:	74 df                	je     803e19 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e3a:	48 63 c8             	movslq %eax,%rcx
+  803e3d:	48 89 ca             	mov    %rcx,%rdx
+  803e40:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e44:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803e4b:	08 10 20 
+  803e4e:	48 89 d0             	mov    %rdx,%rax
+  803e51:	48 f7 e6             	mul    %rsi
+  803e54:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e58:	48 89 d0             	mov    %rdx,%rax
+  803e5b:	48 c1 e0 09          	shl    $0x9,%rax
+  803e5f:	48 29 d0             	sub    %rdx,%rax
+  803e62:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803e69:	00 
+  803e6a:	48 89 c8             	mov    %rcx,%rax
+  803e6d:	48 29 d0             	sub    %rdx,%rax
+  803e70:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803e75:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e79:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803e7d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e80:	49 83 c7 01          	add    $0x1,%r15
+  803e84:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803e88:	75 83                	jne    803e0d <devpipe_read+0x4c>
+    return n;
+  803e8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e8e:	eb 03                	jmp    803e93 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803e90:	4c 89 f8             	mov    %r15,%rax
+}
+  803e93:	48 83 c4 18          	add    $0x18,%rsp
+  803e97:	5b                   	pop    %rbx
+  803e98:	41 5c                	pop    %r12
+  803e9a:	41 5d                	pop    %r13
+  803e9c:	41 5e                	pop    %r14
+  803e9e:	41 5f                	pop    %r15
+  803ea0:	5d                   	pop    %rbp
+  803ea1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea7:	eb ea                	jmp    803e93 <devpipe_read+0xd2>
+
+0000000000803ea9 <pipe>:
+pipe(int pfd[2]) {
+  803ea9:	55                   	push   %rbp
+  803eaa:	48 89 e5             	mov    %rsp,%rbp
+  803ead:	41 55                	push   %r13
+  803eaf:	41 54                	push   %r12
+  803eb1:	53                   	push   %rbx
+  803eb2:	48 83 ec 18          	sub    $0x18,%rsp
+  803eb6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803eb9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ebd:	48 b8 9d 26 80 00 00 	movabs $0x80269d,%rax
+  803ec4:	00 00 00 
+  803ec7:	ff d0                	call   *%rax
+  803ec9:	89 c3                	mov    %eax,%ebx
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	0f 88 a0 01 00 00    	js     804073 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ed3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ed8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803edd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ee1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ee6:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  803eed:	00 00 00 
+  803ef0:	ff d0                	call   *%rax
+  803ef2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ef4:	85 c0                	test   %eax,%eax
+  803ef6:	0f 88 77 01 00 00    	js     804073 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803efc:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f00:	48 b8 9d 26 80 00 00 	movabs $0x80269d,%rax
+  803f07:	00 00 00 
+  803f0a:	ff d0                	call   *%rax
+  803f0c:	89 c3                	mov    %eax,%ebx
+  803f0e:	85 c0                	test   %eax,%eax
+  803f10:	0f 88 43 01 00 00    	js     804059 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f20:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f29:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+  803f35:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f37:	85 c0                	test   %eax,%eax
+  803f39:	0f 88 1a 01 00 00    	js     804059 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f3f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f43:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803f4a:	00 00 00 
+  803f4d:	ff d0                	call   *%rax
+  803f4f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f52:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f5c:	48 89 c6             	mov    %rax,%rsi
+  803f5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f64:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  803f6b:	00 00 00 
+  803f6e:	ff d0                	call   *%rax
+  803f70:	89 c3                	mov    %eax,%ebx
+  803f72:	85 c0                	test   %eax,%eax
+  803f74:	0f 88 c5 00 00 00    	js     80403f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f7a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f7e:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803f85:	00 00 00 
+  803f88:	ff d0                	call   *%rax
+  803f8a:	48 89 c1             	mov    %rax,%rcx
+  803f8d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f93:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f99:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f9e:	4c 89 ee             	mov    %r13,%rsi
+  803fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa6:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  803fad:	00 00 00 
+  803fb0:	ff d0                	call   *%rax
+  803fb2:	89 c3                	mov    %eax,%ebx
+  803fb4:	85 c0                	test   %eax,%eax
+  803fb6:	78 6e                	js     804026 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fb8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fbd:	4c 89 ef             	mov    %r13,%rdi
+  803fc0:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  803fc7:	00 00 00 
+  803fca:	ff d0                	call   *%rax
+  803fcc:	83 f8 02             	cmp    $0x2,%eax
+  803fcf:	0f 85 ab 00 00 00    	jne    804080 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803fd5:	a1 c0 60 80 00 00 00 	movabs 0x8060c0,%eax
+  803fdc:	00 00 
+  803fde:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fe2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803fe4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fe8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803fef:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ff3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ff9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804000:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804004:	48 bb 6f 26 80 00 00 	movabs $0x80266f,%rbx
+  80400b:	00 00 00 
+  80400e:	ff d3                	call   *%rbx
+  804010:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804014:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804018:	ff d3                	call   *%rbx
+  80401a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80401f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804024:	eb 4d                	jmp    804073 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804026:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402b:	4c 89 ee             	mov    %r13,%rsi
+  80402e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804033:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  80403a:	00 00 00 
+  80403d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80403f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804044:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404d:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  804054:	00 00 00 
+  804057:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804059:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80405e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804062:	bf 00 00 00 00       	mov    $0x0,%edi
+  804067:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+}
+  804073:	89 d8                	mov    %ebx,%eax
+  804075:	48 83 c4 18          	add    $0x18,%rsp
+  804079:	5b                   	pop    %rbx
+  80407a:	41 5c                	pop    %r12
+  80407c:	41 5d                	pop    %r13
+  80407e:	5d                   	pop    %rbp
+  80407f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804080:	48 b9 90 50 80 00 00 	movabs $0x805090,%rcx
+  804087:	00 00 00 
+  80408a:	48 ba 67 50 80 00 00 	movabs $0x805067,%rdx
+  804091:	00 00 00 
+  804094:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804099:	48 bf 7c 50 80 00 00 	movabs $0x80507c,%rdi
+  8040a0:	00 00 00 
+  8040a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a8:	49 b8 87 0f 80 00 00 	movabs $0x800f87,%r8
+  8040af:	00 00 00 
+  8040b2:	41 ff d0             	call   *%r8
+
+00000000008040b5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8040b5:	55                   	push   %rbp
+  8040b6:	48 89 e5             	mov    %rsp,%rbp
+  8040b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040bd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040c1:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8040c8:	00 00 00 
+  8040cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040cd:	85 c0                	test   %eax,%eax
+  8040cf:	78 35                	js     804106 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8040d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040d5:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+  8040e1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040e4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040e9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040f2:	48 b8 5c 20 80 00 00 	movabs $0x80205c,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+  8040fe:	85 c0                	test   %eax,%eax
+  804100:	0f 94 c0             	sete   %al
+  804103:	0f b6 c0             	movzbl %al,%eax
+}
+  804106:	c9                   	leave
+  804107:	c3                   	ret
+
+0000000000804108 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804108:	48 89 f8             	mov    %rdi,%rax
+  80410b:	48 c1 e8 27          	shr    $0x27,%rax
+  80410f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804116:	01 00 00 
+  804119:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80411d:	f6 c2 01             	test   $0x1,%dl
+  804120:	74 6d                	je     80418f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804122:	48 89 f8             	mov    %rdi,%rax
+  804125:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804129:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804130:	01 00 00 
+  804133:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804137:	f6 c2 01             	test   $0x1,%dl
+  80413a:	74 62                	je     80419e <get_uvpt_entry+0x96>
+  80413c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804143:	01 00 00 
+  804146:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80414a:	f6 c2 80             	test   $0x80,%dl
+  80414d:	75 4f                	jne    80419e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80414f:	48 89 f8             	mov    %rdi,%rax
+  804152:	48 c1 e8 15          	shr    $0x15,%rax
+  804156:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80415d:	01 00 00 
+  804160:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804164:	f6 c2 01             	test   $0x1,%dl
+  804167:	74 44                	je     8041ad <get_uvpt_entry+0xa5>
+  804169:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804170:	01 00 00 
+  804173:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804177:	f6 c2 80             	test   $0x80,%dl
+  80417a:	75 31                	jne    8041ad <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80417c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804180:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804187:	01 00 00 
+  80418a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80418e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80418f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804196:	01 00 00 
+  804199:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80419d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80419e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8041a5:	01 00 00 
+  8041a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041ac:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8041ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8041b4:	01 00 00 
+  8041b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041bb:	c3                   	ret
+
+00000000008041bc <get_prot>:
+
+int
+get_prot(void *va) {
+  8041bc:	55                   	push   %rbp
+  8041bd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041c0:	48 b8 08 41 80 00 00 	movabs $0x804108,%rax
+  8041c7:	00 00 00 
+  8041ca:	ff d0                	call   *%rax
+  8041cc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8041cf:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8041d4:	89 c1                	mov    %eax,%ecx
+  8041d6:	83 c9 04             	or     $0x4,%ecx
+  8041d9:	f6 c2 01             	test   $0x1,%dl
+  8041dc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8041df:	89 c1                	mov    %eax,%ecx
+  8041e1:	83 c9 02             	or     $0x2,%ecx
+  8041e4:	f6 c2 02             	test   $0x2,%dl
+  8041e7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8041ea:	89 c1                	mov    %eax,%ecx
+  8041ec:	83 c9 01             	or     $0x1,%ecx
+  8041ef:	48 85 d2             	test   %rdx,%rdx
+  8041f2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8041f5:	89 c1                	mov    %eax,%ecx
+  8041f7:	83 c9 40             	or     $0x40,%ecx
+  8041fa:	f6 c6 04             	test   $0x4,%dh
+  8041fd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804200:	5d                   	pop    %rbp
+  804201:	c3                   	ret
+
+0000000000804202 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804202:	55                   	push   %rbp
+  804203:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804206:	48 b8 08 41 80 00 00 	movabs $0x804108,%rax
+  80420d:	00 00 00 
+  804210:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804212:	48 c1 e8 06          	shr    $0x6,%rax
+  804216:	83 e0 01             	and    $0x1,%eax
+}
+  804219:	5d                   	pop    %rbp
+  80421a:	c3                   	ret
+
+000000000080421b <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80421b:	55                   	push   %rbp
+  80421c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80421f:	48 b8 08 41 80 00 00 	movabs $0x804108,%rax
+  804226:	00 00 00 
+  804229:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80422b:	48 c1 e8 05          	shr    $0x5,%rax
+  80422f:	83 e0 01             	and    $0x1,%eax
+}
+  804232:	5d                   	pop    %rbp
+  804233:	c3                   	ret
+
+0000000000804234 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804234:	55                   	push   %rbp
+  804235:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804238:	48 b8 08 41 80 00 00 	movabs $0x804108,%rax
+  80423f:	00 00 00 
+  804242:	ff d0                	call   *%rax
+  804244:	83 e0 01             	and    $0x1,%eax
+}
+  804247:	5d                   	pop    %rbp
+  804248:	c3                   	ret
+
+0000000000804249 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804249:	55                   	push   %rbp
+  80424a:	48 89 e5             	mov    %rsp,%rbp
+  80424d:	41 57                	push   %r15
+  80424f:	41 56                	push   %r14
+  804251:	41 55                	push   %r13
+  804253:	41 54                	push   %r12
+  804255:	53                   	push   %rbx
+  804256:	48 83 ec 18          	sub    $0x18,%rsp
+  80425a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80425e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  804262:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  804267:	49 bd 34 42 80 00 00 	movabs $0x804234,%r13
+  80426e:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  804271:	49 bf bc 41 80 00 00 	movabs $0x8041bc,%r15
+  804278:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80427b:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  804282:	00 00 00 
+  804285:	eb 0c                	jmp    804293 <foreach_shared_region+0x4a>
+  804287:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80428e:	4c 39 f3             	cmp    %r14,%rbx
+  804291:	74 2e                	je     8042c1 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  804293:	48 89 df             	mov    %rbx,%rdi
+  804296:	41 ff d5             	call   *%r13
+  804299:	84 c0                	test   %al,%al
+  80429b:	74 ea                	je     804287 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80429d:	48 89 df             	mov    %rbx,%rdi
+  8042a0:	41 ff d7             	call   *%r15
+  8042a3:	a8 40                	test   $0x40,%al
+  8042a5:	74 e0                	je     804287 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8042a7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8042ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042b2:	48 89 df             	mov    %rbx,%rdi
+  8042b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042b9:	ff d0                	call   *%rax
+				if (res < 0) {
+  8042bb:	85 c0                	test   %eax,%eax
+  8042bd:	79 c8                	jns    804287 <foreach_shared_region+0x3e>
+  8042bf:	eb 05                	jmp    8042c6 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8042c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042c6:	48 83 c4 18          	add    $0x18,%rsp
+  8042ca:	5b                   	pop    %rbx
+  8042cb:	41 5c                	pop    %r12
+  8042cd:	41 5d                	pop    %r13
+  8042cf:	41 5e                	pop    %r14
+  8042d1:	41 5f                	pop    %r15
+  8042d3:	5d                   	pop    %rbp
+  8042d4:	c3                   	ret
+
+00000000008042d5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8042d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042da:	c3                   	ret
+
+00000000008042db <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8042db:	55                   	push   %rbp
+  8042dc:	48 89 e5             	mov    %rsp,%rbp
+  8042df:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8042e2:	48 be b4 50 80 00 00 	movabs $0x8050b4,%rsi
+  8042e9:	00 00 00 
+  8042ec:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8042f3:	00 00 00 
+  8042f6:	ff d0                	call   *%rax
+    return 0;
+}
+  8042f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042fd:	5d                   	pop    %rbp
+  8042fe:	c3                   	ret
+
+00000000008042ff <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042ff:	55                   	push   %rbp
+  804300:	48 89 e5             	mov    %rsp,%rbp
+  804303:	41 57                	push   %r15
+  804305:	41 56                	push   %r14
+  804307:	41 55                	push   %r13
+  804309:	41 54                	push   %r12
+  80430b:	53                   	push   %rbx
+  80430c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804313:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80431a:	48 85 d2             	test   %rdx,%rdx
+  80431d:	74 7a                	je     804399 <devcons_write+0x9a>
+  80431f:	49 89 d6             	mov    %rdx,%r14
+  804322:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804328:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80432d:	49 bf f6 1b 80 00 00 	movabs $0x801bf6,%r15
+  804334:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804337:	4c 89 f3             	mov    %r14,%rbx
+  80433a:	48 29 f3             	sub    %rsi,%rbx
+  80433d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804342:	48 39 c3             	cmp    %rax,%rbx
+  804345:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804349:	4c 63 eb             	movslq %ebx,%r13
+  80434c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804353:	48 01 c6             	add    %rax,%rsi
+  804356:	4c 89 ea             	mov    %r13,%rdx
+  804359:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804360:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804363:	4c 89 ee             	mov    %r13,%rsi
+  804366:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80436d:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  804374:	00 00 00 
+  804377:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804379:	41 01 dc             	add    %ebx,%r12d
+  80437c:	49 63 f4             	movslq %r12d,%rsi
+  80437f:	4c 39 f6             	cmp    %r14,%rsi
+  804382:	72 b3                	jb     804337 <devcons_write+0x38>
+    return res;
+  804384:	49 63 c4             	movslq %r12d,%rax
+}
+  804387:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80438e:	5b                   	pop    %rbx
+  80438f:	41 5c                	pop    %r12
+  804391:	41 5d                	pop    %r13
+  804393:	41 5e                	pop    %r14
+  804395:	41 5f                	pop    %r15
+  804397:	5d                   	pop    %rbp
+  804398:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804399:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80439f:	eb e3                	jmp    804384 <devcons_write+0x85>
+
+00000000008043a1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043a1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8043a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a9:	48 85 c0             	test   %rax,%rax
+  8043ac:	74 55                	je     804403 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+  8043b2:	41 55                	push   %r13
+  8043b4:	41 54                	push   %r12
+  8043b6:	53                   	push   %rbx
+  8043b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8043bb:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8043be:	48 bb 2c 1f 80 00 00 	movabs $0x801f2c,%rbx
+  8043c5:	00 00 00 
+  8043c8:	49 bc f9 1f 80 00 00 	movabs $0x801ff9,%r12
+  8043cf:	00 00 00 
+  8043d2:	eb 03                	jmp    8043d7 <devcons_read+0x36>
+  8043d4:	41 ff d4             	call   *%r12
+  8043d7:	ff d3                	call   *%rbx
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	74 f7                	je     8043d4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8043dd:	48 63 d0             	movslq %eax,%rdx
+  8043e0:	78 13                	js     8043f5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8043e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e7:	83 f8 04             	cmp    $0x4,%eax
+  8043ea:	74 09                	je     8043f5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8043ec:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8043f0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043f5:	48 89 d0             	mov    %rdx,%rax
+  8043f8:	48 83 c4 08          	add    $0x8,%rsp
+  8043fc:	5b                   	pop    %rbx
+  8043fd:	41 5c                	pop    %r12
+  8043ff:	41 5d                	pop    %r13
+  804401:	5d                   	pop    %rbp
+  804402:	c3                   	ret
+  804403:	48 89 d0             	mov    %rdx,%rax
+  804406:	c3                   	ret
+
+0000000000804407 <cputchar>:
+cputchar(int ch) {
+  804407:	55                   	push   %rbp
+  804408:	48 89 e5             	mov    %rsp,%rbp
+  80440b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80440f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804413:	be 01 00 00 00       	mov    $0x1,%esi
+  804418:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80441c:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+}
+  804428:	c9                   	leave
+  804429:	c3                   	ret
+
+000000000080442a <getchar>:
+getchar(void) {
+  80442a:	55                   	push   %rbp
+  80442b:	48 89 e5             	mov    %rsp,%rbp
+  80442e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804432:	ba 01 00 00 00       	mov    $0x1,%edx
+  804437:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80443b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804440:	48 b8 e0 29 80 00 00 	movabs $0x8029e0,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80444e:	85 c0                	test   %eax,%eax
+  804450:	78 06                	js     804458 <getchar+0x2e>
+  804452:	74 08                	je     80445c <getchar+0x32>
+  804454:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804458:	89 d0                	mov    %edx,%eax
+  80445a:	c9                   	leave
+  80445b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80445c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804461:	eb f5                	jmp    804458 <getchar+0x2e>
+
+0000000000804463 <iscons>:
+iscons(int fdnum) {
+  804463:	55                   	push   %rbp
+  804464:	48 89 e5             	mov    %rsp,%rbp
+  804467:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80446b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80446f:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  804476:	00 00 00 
+  804479:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80447b:	85 c0                	test   %eax,%eax
+  80447d:	78 18                	js     804497 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80447f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804483:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  80448a:	00 00 00 
+  80448d:	8b 00                	mov    (%rax),%eax
+  80448f:	39 02                	cmp    %eax,(%rdx)
+  804491:	0f 94 c0             	sete   %al
+  804494:	0f b6 c0             	movzbl %al,%eax
+}
+  804497:	c9                   	leave
+  804498:	c3                   	ret
+
+0000000000804499 <opencons>:
+opencons(void) {
+  804499:	55                   	push   %rbp
+  80449a:	48 89 e5             	mov    %rsp,%rbp
+  80449d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8044a1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8044a5:	48 b8 9d 26 80 00 00 	movabs $0x80269d,%rax
+  8044ac:	00 00 00 
+  8044af:	ff d0                	call   *%rax
+  8044b1:	85 c0                	test   %eax,%eax
+  8044b3:	78 49                	js     8044fe <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8044b5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044bf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8044c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044c8:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8044cf:	00 00 00 
+  8044d2:	ff d0                	call   *%rax
+  8044d4:	85 c0                	test   %eax,%eax
+  8044d6:	78 26                	js     8044fe <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8044d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044dc:	a1 60 61 80 00 00 00 	movabs 0x806160,%eax
+  8044e3:	00 00 
+  8044e5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8044e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044eb:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8044f2:	48 b8 6f 26 80 00 00 	movabs $0x80266f,%rax
+  8044f9:	00 00 00 
+  8044fc:	ff d0                	call   *%rax
+}
+  8044fe:	c9                   	leave
+  8044ff:	c3                   	ret
+
+0000000000804500 <__rodata_start>:
+  804500:	25 73 20 2f 62       	and    $0x622f2073,%eax
+  804505:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  80450c:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a0a97e <__bss_end+0x7220097e>
+  804512:	65 74 75             	gs je  80458a <__rodata_start+0x8a>
+  804515:	72 6e                	jb     804585 <__rodata_start+0x85>
+  804517:	65 64 20 62 61       	gs and %ah,%fs:0x61(%rdx)
+  80451c:	64 20 64 61 74       	and    %ah,%fs:0x74(%rcx,%riz,2)
+  804521:	61                   	(bad)
+  804522:	20 25 64 00 00 00    	and    %ah,0x64(%rip)        # 80458c <__rodata_start+0x8c>
+  804528:	25 73 20 2f 62       	and    $0x622f2073,%eax
+  80452d:	69 67 20 6d 61 70 70 	imul   $0x7070616d,0x20(%rdi),%esp
+  804534:	65 64 20 61 20       	gs and %ah,%fs:0x20(%rcx)
+  804539:	77 72                	ja     8045ad <__rodata_start+0xad>
+  80453b:	69 74 61 62 6c 65 20 	imul   $0x7020656c,0x62(%rcx,%riz,2),%esi
+  804542:	70 
+  804543:	61                   	(bad)
+  804544:	67 65 20 61 74       	and    %ah,%gs:0x74(%ecx)
+  804549:	20 25 6c 64 00 00    	and    %ah,0x646c(%rip)        # 80a9bb <__bss_end+0x9bb>
+  80454f:	00 73 65             	add    %dh,0x65(%rbx)
+  804552:	72 76                	jb     8045ca <__rodata_start+0xca>
+  804554:	65 5f                	gs pop %rdi
+  804556:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804557:	70 65                	jo     8045be <__rodata_start+0xbe>
+  804559:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80455a:	20 2f                	and    %ch,(%rdi)
+  80455c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80455d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80455e:	74 2d                	je     80458d <__rodata_start+0x8d>
+  804560:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804562:	75 6e                	jne    8045d2 <__rodata_start+0xd2>
+  804564:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  804568:	63 63 65             	movsxd 0x65(%rbx),%esp
+  80456b:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  804571:	00 00                	add    %al,(%rax)
+  804573:	00 00                	add    %al,(%rax)
+  804575:	00 00                	add    %al,(%rax)
+  804577:	00 73 65             	add    %dh,0x65(%rbx)
+  80457a:	72 76                	jb     8045f2 <__rodata_start+0xf2>
+  80457c:	65 5f                	gs pop %rdi
+  80457e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80457f:	70 65                	jo     8045e6 <__rodata_start+0xe6>
+  804581:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804582:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  804586:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804589:	74 20                	je     8045ab <__rodata_start+0xab>
+  80458b:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  804592:	72 75                	jb     804609 <__rodata_start+0x109>
+  804594:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  804598:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  80459c:	72 72                	jb     804610 <__rodata_start+0x110>
+  80459e:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8045a3:	0a 00                	or     (%rax),%al
+  8045a5:	00 00                	add    %al,(%rax)
+  8045a7:	00 66 69             	add    %ah,0x69(%rsi)
+  8045aa:	6c                   	insb   (%dx),%es:(%rdi)
+  8045ab:	65 5f                	gs pop %rdi
+  8045ad:	73 74                	jae    804623 <__rodata_start+0x123>
+  8045af:	61                   	(bad)
+  8045b0:	74 20                	je     8045d2 <__rodata_start+0xd2>
+  8045b2:	72 65                	jb     804619 <__rodata_start+0x119>
+  8045b4:	74 75                	je     80462b <__rodata_start+0x12b>
+  8045b6:	72 6e                	jb     804626 <__rodata_start+0x126>
+  8045b8:	65 64 20 73 69       	gs and %dh,%fs:0x69(%rbx)
+  8045bd:	7a 65                	jp     804624 <__rodata_start+0x124>
+  8045bf:	20 25 6c 64 20 77    	and    %ah,0x7720646c(%rip)        # 77a0aa31 <__bss_end+0x77200a31>
+  8045c5:	61                   	(bad)
+  8045c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045c7:	74 65                	je     80462e <__rodata_start+0x12e>
+  8045c9:	64 20 25 7a 64 0a 00 	and    %ah,%fs:0xa647a(%rip)        # 8aaa4a <__bss_end+0xa0a4a>
+  8045d0:	73 65                	jae    804637 <__rodata_start+0x137>
+  8045d2:	72 76                	jb     80464a <__rodata_start+0x14a>
+  8045d4:	65 5f                	gs pop %rdi
+  8045d6:	72 65                	jb     80463d <__rodata_start+0x13d>
+  8045d8:	61                   	(bad)
+  8045d9:	64 20 64 6f 65       	and    %ah,%fs:0x65(%rdi,%rbp,2)
+  8045de:	73 20                	jae    804600 <__rodata_start+0x100>
+  8045e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045e2:	74 20                	je     804604 <__rodata_start+0x104>
+  8045e4:	68 61 6e 64 6c       	push   $0x6c646e61
+  8045e9:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  8045ed:	61                   	(bad)
+  8045ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8045ef:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  8045f3:	6c                   	insb   (%dx),%es:(%rdi)
+  8045f4:	65 69 64 73 20 63 6f 	imul   $0x72726f63,%gs:0x20(%rbx,%rsi,2),%esp
+  8045fb:	72 72 
+  8045fd:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  804602:	3a 20                	cmp    (%rax),%ah
+  804604:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  804609:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  804610:	64 
+  804611:	20 61 66             	and    %ah,0x66(%rcx)
+  804614:	74 65                	je     80467b <__rodata_start+0x17b>
+  804616:	72 20                	jb     804638 <__rodata_start+0x138>
+  804618:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  80461f:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  804626:	64 
+  804627:	00 66 69             	add    %ah,0x69(%rsi)
+  80462a:	6c                   	insb   (%dx),%es:(%rdi)
+  80462b:	65 5f                	gs pop %rdi
+  80462d:	72 65                	jb     804694 <__rodata_start+0x194>
+  80462f:	61                   	(bad)
+  804630:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  804634:	74 65                	je     80469b <__rodata_start+0x19b>
+  804636:	72 20                	jb     804658 <__rodata_start+0x158>
+  804638:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  80463f:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  804646:	75 
+  804647:	72 6e                	jb     8046b7 <__rodata_start+0x1b7>
+  804649:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  80464e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80464f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804650:	67 20 6c 65 6e       	and    %ch,0x6e(%ebp,%eiz,2)
+  804655:	67 74 68             	addr32 je 8046c0 <__rodata_start+0x1c0>
+  804658:	3a 20                	cmp    (%rax),%ah
+  80465a:	25 6c 64 00 00       	and    $0x646c,%eax
+  80465f:	00 66 69             	add    %ah,0x69(%rsi)
+  804662:	6c                   	insb   (%dx),%es:(%rdi)
+  804663:	65 5f                	gs pop %rdi
+  804665:	72 65                	jb     8046cc <__rodata_start+0x1cc>
+  804667:	61                   	(bad)
+  804668:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  80466c:	74 65                	je     8046d3 <__rodata_start+0x1d3>
+  80466e:	72 20                	jb     804690 <__rodata_start+0x190>
+  804670:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  804677:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  80467e:	75 
+  80467f:	72 6e                	jb     8046ef <__rodata_start+0x1ef>
+  804681:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  804686:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804687:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804688:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  80468d:	61                   	(bad)
+  80468e:	00 00                	add    %al,(%rax)
+  804690:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  804697:	61                   	(bad)
+  804698:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  80469c:	74 65                	je     804703 <__rodata_start+0x203>
+  80469e:	72 20                	jb     8046c0 <__rodata_start+0x1c0>
+  8046a0:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8046a7:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  8046ae:	67 
+  8046af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046b1:	64 0a 00             	or     %fs:(%rax),%al
+  8046b4:	00 00                	add    %al,(%rax)
+  8046b6:	00 00                	add    %al,(%rax)
+  8046b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046b9:	70 65                	jo     804720 <__rodata_start+0x220>
+  8046bb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046bc:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  8046c0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8046c3:	74 20                	je     8046e5 <__rodata_start+0x1e5>
+  8046c5:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  8046cc:	72 75                	jb     804743 <__rodata_start+0x243>
+  8046ce:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  8046d2:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  8046d6:	72 72                	jb     80474a <__rodata_start+0x24a>
+  8046d8:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8046dd:	0a 00                	or     (%rax),%al
+  8046df:	00 72 65             	add    %dh,0x65(%rdx)
+  8046e2:	61                   	(bad)
+  8046e3:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8046e6:	62                   	(bad)
+  8046e7:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  8046ee:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a0ab60 <__bss_end+0x72200b60>
+  8046f4:	65 74 75             	gs je  80476c <__rodata_start+0x26c>
+  8046f7:	72 6e                	jb     804767 <__rodata_start+0x267>
+  8046f9:	65 64 20 25 6c 64 20 	gs and %ah,%fs:0x3c20646c(%rip)        # 3ca0ab6d <__bss_end+0x3c200b6d>
+  804700:	3c 
+  804701:	20 25 64 20 62 79    	and    %ah,0x79622064(%rip)        # 79e2676b <__bss_end+0x7961c76b>
+  804707:	74 65                	je     80476e <__rodata_start+0x26e>
+  804709:	73 00                	jae    80470b <__rodata_start+0x20b>
+  80470b:	00 00                	add    %al,(%rax)
+  80470d:	00 00                	add    %al,(%rax)
+  80470f:	00 72 65             	add    %dh,0x65(%rdx)
+  804712:	61                   	(bad)
+  804713:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804716:	62                   	(bad)
+  804717:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  80471e:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a0ab90 <__bss_end+0x72200b90>
+  804724:	65 74 75             	gs je  80479c <__rodata_start+0x29c>
+  804727:	72 6e                	jb     804797 <__rodata_start+0x297>
+  804729:	65 64 20 62 61       	gs and %ah,%fs:0x61(%rdx)
+  80472e:	64 20 64 61 74       	and    %ah,%fs:0x74(%rcx,%riz,2)
+  804733:	61                   	(bad)
+  804734:	20 25 64 00 62 75    	and    %ah,0x75620064(%rip)        # 75e2479e <__bss_end+0x7561a79e>
+  80473a:	6c                   	insb   (%dx),%es:(%rdi)
+  80473b:	6b 20 72             	imul   $0x72,(%rax),%esp
+  80473e:	65 61                	gs (bad)
+  804740:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804743:	62                   	(bad)
+  804744:	69 67 20 72 65 74 75 	imul   $0x75746572,0x20(%rdi),%esp
+  80474b:	72 6e                	jb     8047bb <__rodata_start+0x2bb>
+  80474d:	65 64 20 25 6c 64 20 	gs and %ah,%fs:0x6220646c(%rip)        # 62a0abc1 <__bss_end+0x62200bc1>
+  804754:	62 
+  804755:	79 74                	jns    8047cb <__rodata_start+0x2cb>
+  804757:	65 73 20             	gs jae 80477a <__rodata_start+0x27a>
+  80475a:	69 6e 20 61 20 25 6c 	imul   $0x6c252061,0x20(%rsi),%ebp
+  804761:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  804765:	74 65                	je     8047cc <__rodata_start+0x2cc>
+  804767:	20 72 65             	and    %dh,0x65(%rdx)
+  80476a:	67 69 6f 6e 00 00 62 	imul   $0x75620000,0x6e(%edi),%ebp
+  804771:	75 
+  804772:	6c                   	insb   (%dx),%es:(%rdi)
+  804773:	6b 20 72             	imul   $0x72,(%rax),%esp
+  804776:	65 61                	gs (bad)
+  804778:	64 20 2f             	and    %ch,%fs:(%rdi)
+  80477b:	62                   	(bad)
+  80477c:	69 67 20 73 65 6e 74 	imul   $0x746e6573,0x20(%rdi),%esp
+  804783:	20 70 65             	and    %dh,0x65(%rax)
+  804786:	72 6d                	jb     8047f5 <__rodata_start+0x2f5>
+  804788:	69 73 73 69 6f 6e 73 	imul   $0x736e6f69,0x73(%rbx),%esi
+  80478f:	20 25 78 00 00 00    	and    %ah,0x78(%rip)        # 80480d <__rodata_start+0x30d>
+  804795:	00 00                	add    %al,(%rax)
+  804797:	00 54 68 69          	add    %dl,0x69(%rax,%rbp,2)
+  80479b:	73 20                	jae    8047bd <__rodata_start+0x2bd>
+  80479d:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  8047a4:	4e                   	rex.WRX
+  8047a5:	45 57                	rex.RB push %r15
+  8047a7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8047aa:	73 73                	jae    80481f <__rodata_start+0x31f>
+  8047ac:	61                   	(bad)
+  8047ad:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  8047b2:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  8047b6:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  8047ba:	21 0a                	and    %ecx,(%rdx)
+  8047bc:	0a 00                	or     (%rax),%al
+  8047be:	75 73                	jne    804833 <__rodata_start+0x333>
+  8047c0:	65 72 2f             	gs jb  8047f2 <__rodata_start+0x2f2>
+  8047c3:	74 65                	je     80482a <__rodata_start+0x32a>
+  8047c5:	73 74                	jae    80483b <__rodata_start+0x33b>
+  8047c7:	66 69 6c 65 2e 63 00 	imul   $0x63,0x2e(%rbp,%riz,2),%bp
+  8047ce:	2f                   	(bad)
+  8047cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047d1:	74 2d                	je     804800 <__rodata_start+0x300>
+  8047d3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047d5:	75 6e                	jne    804845 <__rodata_start+0x345>
+  8047d7:	64 00 73 65          	add    %dh,%fs:0x65(%rbx)
+  8047db:	72 76                	jb     804853 <__rodata_start+0x353>
+  8047dd:	65 5f                	gs pop %rdi
+  8047df:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047e0:	70 65                	jo     804847 <__rodata_start+0x347>
+  8047e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047e3:	20 2f                	and    %ch,(%rdi)
+  8047e5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047e6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047e7:	74 2d                	je     804816 <__rodata_start+0x316>
+  8047e9:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047eb:	75 6e                	jne    80485b <__rodata_start+0x35b>
+  8047ed:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8047f0:	25 6c 64 00 2f       	and    $0x2f00646c,%eax
+  8047f5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047f6:	65 77 6d             	gs ja  804866 <__rodata_start+0x366>
+  8047f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047fa:	74 64                	je     804860 <__rodata_start+0x360>
+  8047fc:	00 73 65             	add    %dh,0x65(%rbx)
+  8047ff:	72 76                	jb     804877 <__rodata_start+0x377>
+  804801:	65 5f                	gs pop %rdi
+  804803:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804804:	70 65                	jo     80486b <__rodata_start+0x36b>
+  804806:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804807:	20 2f                	and    %ch,(%rdi)
+  804809:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80480a:	65 77 6d             	gs ja  80487a <__rodata_start+0x37a>
+  80480d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80480e:	74 64                	je     804874 <__rodata_start+0x374>
+  804810:	3a 20                	cmp    (%rax),%ah
+  804812:	25 6c 64 00 73       	and    $0x7300646c,%eax
+  804817:	65 72 76             	gs jb  804890 <__rodata_start+0x390>
+  80481a:	65 5f                	gs pop %rdi
+  80481c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80481d:	70 65                	jo     804884 <__rodata_start+0x384>
+  80481f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804820:	20 69 73             	and    %ch,0x73(%rcx)
+  804823:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804826:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804827:	64 0a 00             	or     %fs:(%rax),%al
+  80482a:	66 69 6c 65 5f 73 74 	imul   $0x7473,0x5f(%rbp,%riz,2),%bp
+  804831:	61                   	(bad)
+  804832:	74 3a                	je     80486e <__rodata_start+0x36e>
+  804834:	20 25 6c 64 00 66    	and    %ah,0x6600646c(%rip)        # 6680aca6 <__bss_end+0x66000ca6>
+  80483a:	69 6c 65 5f 73 74 61 	imul   $0x74617473,0x5f(%rbp,%riz,2),%ebp
+  804841:	74 
+  804842:	20 69 73             	and    %ch,0x73(%rcx)
+  804845:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804848:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804849:	64 0a 00             	or     %fs:(%rax),%al
+  80484c:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  804853:	61                   	(bad)
+  804854:	64 3a 20             	cmp    %fs:(%rax),%ah
+  804857:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  80485c:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  804863:	64 
+  804864:	20 72 65             	and    %dh,0x65(%rdx)
+  804867:	74 75                	je     8048de <__rodata_start+0x3de>
+  804869:	72 6e                	jb     8048d9 <__rodata_start+0x3d9>
+  80486b:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  804870:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804871:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804872:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  804877:	61                   	(bad)
+  804878:	00 66 69             	add    %ah,0x69(%rsi)
+  80487b:	6c                   	insb   (%dx),%es:(%rdi)
+  80487c:	65 5f                	gs pop %rdi
+  80487e:	72 65                	jb     8048e5 <__rodata_start+0x3e5>
+  804880:	61                   	(bad)
+  804881:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  804885:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804888:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804889:	64 0a 00             	or     %fs:(%rax),%al
+  80488c:	66 69 6c 65 5f 63 6c 	imul   $0x6c63,0x5f(%rbp,%riz,2),%bp
+  804893:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804894:	73 65                	jae    8048fb <__rodata_start+0x3fb>
+  804896:	3a 20                	cmp    (%rax),%ah
+  804898:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  80489d:	69 6c 65 5f 63 6c 6f 	imul   $0x736f6c63,0x5f(%rbp,%riz,2),%ebp
+  8048a4:	73 
+  8048a5:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  8048a9:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8048ac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048ad:	64 0a 00             	or     %fs:(%rax),%al
+  8048b0:	73 74                	jae    804926 <__rodata_start+0x426>
+  8048b2:	61                   	(bad)
+  8048b3:	6c                   	insb   (%dx),%es:(%rdi)
+  8048b4:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  8048b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8048b9:	65 69 64 20 69 73 20 	imul   $0x6f672073,%gs:0x69(%rax,%riz,1),%esp
+  8048c0:	67 6f 
+  8048c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048c3:	64 0a 00             	or     %fs:(%rax),%al
+  8048c6:	2f                   	(bad)
+  8048c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c8:	65 77 2d             	gs ja  8048f8 <__rodata_start+0x3f8>
+  8048cb:	66 69 6c 65 00 73 65 	imul   $0x6573,0x0(%rbp,%riz,2),%bp
+  8048d2:	72 76                	jb     80494a <__rodata_start+0x44a>
+  8048d4:	65 5f                	gs pop %rdi
+  8048d6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048d7:	70 65                	jo     80493e <__rodata_start+0x43e>
+  8048d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048da:	20 2f                	and    %ch,(%rdi)
+  8048dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048dd:	65 77 2d             	gs ja  80490d <__rodata_start+0x40d>
+  8048e0:	66 69 6c 65 3a 20 25 	imul   $0x2520,0x3a(%rbp,%riz,2),%bp
+  8048e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8048e8:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  8048ec:	6c                   	insb   (%dx),%es:(%rdi)
+  8048ed:	65 5f                	gs pop %rdi
+  8048ef:	77 72                	ja     804963 <__rodata_start+0x463>
+  8048f1:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  8048f8:	64 
+  8048f9:	00 66 69             	add    %ah,0x69(%rsi)
+  8048fc:	6c                   	insb   (%dx),%es:(%rdi)
+  8048fd:	65 5f                	gs pop %rdi
+  8048ff:	77 72                	ja     804973 <__rodata_start+0x473>
+  804901:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  804908:	67 
+  804909:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490b:	64 0a 00             	or     %fs:(%rax),%al
+  80490e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490f:	70 65                	jo     804976 <__rodata_start+0x476>
+  804911:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804912:	20 2f                	and    %ch,(%rdi)
+  804914:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804915:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804916:	74 2d                	je     804945 <__rodata_start+0x445>
+  804918:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80491a:	75 6e                	jne    80498a <__rodata_start+0x48a>
+  80491c:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  804920:	63 63 65             	movsxd 0x65(%rbx),%esp
+  804923:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  804929:	2f                   	(bad)
+  80492a:	62                   	(bad)
+  80492b:	69 67 00 63 72 65 61 	imul   $0x61657263,0x0(%rdi),%esp
+  804932:	74 20                	je     804954 <__rodata_start+0x454>
+  804934:	2f                   	(bad)
+  804935:	62                   	(bad)
+  804936:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  80493d:	00 77 72             	add    %dh,0x72(%rdi)
+  804940:	69 74 65 20 2f 62 69 	imul   $0x6769622f,0x20(%rbp,%riz,2),%esi
+  804947:	67 
+  804948:	40 25 6c 64 3a 20    	rex and $0x203a646c,%eax
+  80494e:	25 6c 64 00 6f       	and    $0x6f00646c,%eax
+  804953:	70 65                	jo     8049ba <__rodata_start+0x4ba>
+  804955:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804956:	20 2f                	and    %ch,(%rdi)
+  804958:	62                   	(bad)
+  804959:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  804960:	00 72 65             	add    %dh,0x65(%rdx)
+  804963:	61                   	(bad)
+  804964:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804967:	62                   	(bad)
+  804968:	69 67 40 25 6c 64 3a 	imul   $0x3a646c25,0x40(%rdi),%esp
+  80496f:	20 25 6c 64 00 6c    	and    %ah,0x6c00646c(%rip)        # 6c80ade1 <__bss_end+0x6c000de1>
+  804975:	61                   	(bad)
+  804976:	72 67                	jb     8049df <__rodata_start+0x4df>
+  804978:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  80497c:	6c                   	insb   (%dx),%es:(%rdi)
+  80497d:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  804981:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804984:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804985:	64 0a 00             	or     %fs:(%rax),%al
+  804988:	62 75 6c 6b 20       	(bad)
+  80498d:	72 65                	jb     8049f4 <__rodata_start+0x4f4>
+  80498f:	61                   	(bad)
+  804990:	64 00 62 75          	add    %ah,%fs:0x75(%rdx)
+  804994:	6c                   	insb   (%dx),%es:(%rdi)
+  804995:	6b 20 72             	imul   $0x72,(%rax),%esp
+  804998:	65 61                	gs (bad)
+  80499a:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  80499e:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8049a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049a2:	64 0a 00             	or     %fs:(%rax),%al
+  8049a5:	73 79                	jae    804a20 <__rodata_start+0x520>
+  8049a7:	73 5f                	jae    804a08 <__rodata_start+0x508>
+  8049a9:	61                   	(bad)
+  8049aa:	6c                   	insb   (%dx),%es:(%rdi)
+  8049ab:	6c                   	insb   (%dx),%es:(%rdi)
+  8049ac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ad:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  8049b0:	65 67 69 6f 6e 3a 20 	imul   $0x6c25203a,%gs:0x6e(%edi),%ebp
+  8049b7:	25 6c 
+  8049b9:	64 00 72 65          	add    %dh,%fs:0x65(%rdx)
+  8049bd:	61                   	(bad)
+  8049be:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8049c0:	61                   	(bad)
+  8049c1:	70 20                	jo     8049e3 <__rodata_start+0x4e3>
+  8049c3:	2f                   	(bad)
+  8049c4:	62                   	(bad)
+  8049c5:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  8049cc:	00 72 65             	add    %dh,0x65(%rdx)
+  8049cf:	61                   	(bad)
+  8049d0:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8049d2:	61                   	(bad)
+  8049d3:	70 00                	jo     8049d5 <__rodata_start+0x4d5>
+  8049d5:	72 65                	jb     804a3c <__rodata_start+0x53c>
+  8049d7:	61                   	(bad)
+  8049d8:	64 6d                	fs insl (%dx),%es:(%rdi)
+  8049da:	61                   	(bad)
+  8049db:	70 20                	jo     8049fd <__rodata_start+0x4fd>
+  8049dd:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  8049e4:	0a 00                	or     (%rax),%al
+  8049e6:	3c 75                	cmp    $0x75,%al
+  8049e8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8049ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ee:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  8049f2:	30 38                	xor    %bh,(%rax)
+  8049f4:	78 5d                	js     804a53 <__rodata_start+0x553>
+  8049f6:	20 75 73             	and    %dh,0x73(%rbp)
+  8049f9:	65 72 20             	gs jb  804a1c <__rodata_start+0x51c>
+  8049fc:	70 61                	jo     804a5f <__rodata_start+0x55f>
+  8049fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ff:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804a06:	73 20                	jae    804a28 <__rodata_start+0x528>
+  804a08:	61                   	(bad)
+  804a09:	74 20                	je     804a2b <__rodata_start+0x52b>
+  804a0b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804a10:	3a 20                	cmp    (%rax),%ah
+  804a12:	00 30                	add    %dh,(%rax)
+  804a14:	31 32                	xor    %esi,(%rdx)
+  804a16:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a1d:	41                   	rex.B
+  804a1e:	42                   	rex.X
+  804a1f:	43                   	rex.XB
+  804a20:	44                   	rex.R
+  804a21:	45                   	rex.RB
+  804a22:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a25:	31 32                	xor    %esi,(%rdx)
+  804a27:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a2e:	61                   	(bad)
+  804a2f:	62 63 64 65 66       	(bad)
+  804a34:	00 28                	add    %ch,(%rax)
+  804a36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a37:	75 6c                	jne    804aa5 <__rodata_start+0x5a5>
+  804a39:	6c                   	insb   (%dx),%es:(%rdi)
+  804a3a:	29 00                	sub    %eax,(%rax)
+  804a3c:	65 72 72             	gs jb  804ab1 <__rodata_start+0x5b1>
+  804a3f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a40:	72 20                	jb     804a62 <__rodata_start+0x562>
+  804a42:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804a47:	73 70                	jae    804ab9 <__rodata_start+0x5b9>
+  804a49:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804a4d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804a54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a55:	72 00                	jb     804a57 <__rodata_start+0x557>
+  804a57:	62 61 64 20 65       	(bad)
+  804a5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a5d:	76 69                	jbe    804ac8 <__rodata_start+0x5c8>
+  804a5f:	72 6f                	jb     804ad0 <__rodata_start+0x5d0>
+  804a61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a62:	6d                   	insl   (%dx),%es:(%rdi)
+  804a63:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a65:	74 00                	je     804a67 <__rodata_start+0x567>
+  804a67:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a6e:	20 70 61             	and    %dh,0x61(%rax)
+  804a71:	72 61                	jb     804ad4 <__rodata_start+0x5d4>
+  804a73:	6d                   	insl   (%dx),%es:(%rdi)
+  804a74:	65 74 65             	gs je  804adc <__rodata_start+0x5dc>
+  804a77:	72 00                	jb     804a79 <__rodata_start+0x579>
+  804a79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a7a:	75 74                	jne    804af0 <__rodata_start+0x5f0>
+  804a7c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804a7f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804a82:	6d                   	insl   (%dx),%es:(%rdi)
+  804a83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a84:	72 79                	jb     804aff <__rodata_start+0x5ff>
+  804a86:	00 6f 75             	add    %ch,0x75(%rdi)
+  804a89:	74 20                	je     804aab <__rodata_start+0x5ab>
+  804a8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804a90:	76 69                	jbe    804afb <__rodata_start+0x5fb>
+  804a92:	72 6f                	jb     804b03 <__rodata_start+0x603>
+  804a94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a95:	6d                   	insl   (%dx),%es:(%rdi)
+  804a96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a98:	74 73                	je     804b0d <__rodata_start+0x60d>
+  804a9a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804a9d:	72 72                	jb     804b11 <__rodata_start+0x611>
+  804a9f:	75 70                	jne    804b11 <__rodata_start+0x611>
+  804aa1:	74 65                	je     804b08 <__rodata_start+0x608>
+  804aa3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804aa8:	75 67                	jne    804b11 <__rodata_start+0x611>
+  804aaa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804aad:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804aaf:	00 73 65             	add    %dh,0x65(%rbx)
+  804ab2:	67 6d                	insl   (%dx),%es:(%edi)
+  804ab4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ab6:	74 61                	je     804b19 <__rodata_start+0x619>
+  804ab8:	74 69                	je     804b23 <__rodata_start+0x623>
+  804aba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804abb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804abc:	20 66 61             	and    %ah,0x61(%rsi)
+  804abf:	75 6c                	jne    804b2d <__rodata_start+0x62d>
+  804ac1:	74 00                	je     804ac3 <__rodata_start+0x5c3>
+  804ac3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804aca:	20 45 4c             	and    %al,0x4c(%rbp)
+  804acd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804ad1:	61                   	(bad)
+  804ad2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804ad7:	20 73 75             	and    %dh,0x75(%rbx)
+  804ada:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804add:	73 79                	jae    804b58 <__rodata_start+0x658>
+  804adf:	73 74                	jae    804b55 <__rodata_start+0x655>
+  804ae1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804ae3:	20 63 61             	and    %ah,0x61(%rbx)
+  804ae6:	6c                   	insb   (%dx),%es:(%rdi)
+  804ae7:	6c                   	insb   (%dx),%es:(%rdi)
+  804ae8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804aeb:	74 72                	je     804b5f <__rodata_start+0x65f>
+  804aed:	79 20                	jns    804b0f <__rodata_start+0x60f>
+  804aef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804af0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804af1:	74 20                	je     804b13 <__rodata_start+0x613>
+  804af3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804af5:	75 6e                	jne    804b65 <__rodata_start+0x665>
+  804af7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804afb:	76 20                	jbe    804b1d <__rodata_start+0x61d>
+  804afd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b04:	72 65                	jb     804b6b <__rodata_start+0x66b>
+  804b06:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b0a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b0e:	65 78 70             	gs js  804b81 <__rodata_start+0x681>
+  804b11:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b16:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b19:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b1d:	20 66 69             	and    %ah,0x69(%rsi)
+  804b20:	6c                   	insb   (%dx),%es:(%rdi)
+  804b21:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b25:	20 66 72             	and    %ah,0x72(%rsi)
+  804b28:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b2d:	61                   	(bad)
+  804b2e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b33:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b37:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b40:	79 20                	jns    804b62 <__rodata_start+0x662>
+  804b42:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804b49:	72 65                	jb     804bb0 <__rodata_start+0x6b0>
+  804b4b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804b4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b50:	00 66 69             	add    %ah,0x69(%rsi)
+  804b53:	6c                   	insb   (%dx),%es:(%rdi)
+  804b54:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804b58:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804b5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b5c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804b5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b61:	74 20                	je     804b83 <__rodata_start+0x683>
+  804b63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b65:	75 6e                	jne    804bd5 <__rodata_start+0x6d5>
+  804b67:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804b6b:	76 61                	jbe    804bce <__rodata_start+0x6ce>
+  804b6d:	6c                   	insb   (%dx),%es:(%rdi)
+  804b6e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804b75:	00 
+  804b76:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804b7d:	72 65                	jb     804be4 <__rodata_start+0x6e4>
+  804b7f:	61                   	(bad)
+  804b80:	64 79 20             	fs jns 804ba3 <__rodata_start+0x6a3>
+  804b83:	65 78 69             	gs js  804bef <__rodata_start+0x6ef>
+  804b86:	73 74                	jae    804bfc <__rodata_start+0x6fc>
+  804b88:	73 00                	jae    804b8a <__rodata_start+0x68a>
+  804b8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b8b:	70 65                	jo     804bf2 <__rodata_start+0x6f2>
+  804b8d:	72 61                	jb     804bf0 <__rodata_start+0x6f0>
+  804b8f:	74 69                	je     804bfa <__rodata_start+0x6fa>
+  804b91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b93:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804b96:	74 20                	je     804bb8 <__rodata_start+0x6b8>
+  804b98:	73 75                	jae    804c0f <__rodata_start+0x70f>
+  804b9a:	70 70                	jo     804c0c <__rodata_start+0x70c>
+  804b9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9d:	72 74                	jb     804c13 <__rodata_start+0x713>
+  804b9f:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  804ba5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  804baa:	74 00                	je     804bac <__rodata_start+0x6ac>
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	c4                   	(bad)
+  804bc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  804bc7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cbe6 <__bss_end+0x2be6>
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 f5                	add    %dh,%ch
+  804bd1:	18 80 00 00 00 00    	sbb    %al,0x0(%rax)
+  804bd7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cbf6 <__bss_end+0x2bf6>
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cbfe <__bss_end+0x2bfe>
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc06 <__bss_end+0x2c06>
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc0e <__bss_end+0x2c0e>
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 e3                	add    %ah,%bl
+  804bf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  804bff:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc1e <__bss_end+0x2c1e>
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc26 <__bss_end+0x2c26>
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 d7                	add    %dl,%bh
+  804c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  804c17:	00 51 13             	add    %dl,0x13(%rcx)
+  804c1a:	80 00 00             	addb   $0x0,(%rax)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc3e <__bss_end+0x2c3e>
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 d7                	add    %dl,%bh
+  804c29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  804c2f:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc48 <__bss_end+0x2c48>
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc50 <__bss_end+0x2c50>
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc58 <__bss_end+0x2c58>
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc60 <__bss_end+0x2c60>
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc68 <__bss_end+0x2c68>
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc70 <__bss_end+0x2c70>
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc78 <__bss_end+0x2c78>
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc80 <__bss_end+0x2c80>
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 1d 13 80 00 00    	add    %bl,0x8013(%rip)        # 80cc88 <__bss_end+0x2c88>
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc96 <__bss_end+0x2c96>
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cc9e <__bss_end+0x2c9e>
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cca6 <__bss_end+0x2ca6>
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccae <__bss_end+0x2cae>
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccb6 <__bss_end+0x2cb6>
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccbe <__bss_end+0x2cbe>
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccc6 <__bss_end+0x2cc6>
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccce <__bss_end+0x2cce>
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccd6 <__bss_end+0x2cd6>
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccde <__bss_end+0x2cde>
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cce6 <__bss_end+0x2ce6>
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccee <__bss_end+0x2cee>
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccf6 <__bss_end+0x2cf6>
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ccfe <__bss_end+0x2cfe>
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd06 <__bss_end+0x2d06>
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd0e <__bss_end+0x2d0e>
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd16 <__bss_end+0x2d16>
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd1e <__bss_end+0x2d1e>
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd26 <__bss_end+0x2d26>
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd2e <__bss_end+0x2d2e>
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd36 <__bss_end+0x2d36>
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd3e <__bss_end+0x2d3e>
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd46 <__bss_end+0x2d46>
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd4e <__bss_end+0x2d4e>
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd56 <__bss_end+0x2d56>
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd5e <__bss_end+0x2d5e>
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd66 <__bss_end+0x2d66>
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd6e <__bss_end+0x2d6e>
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd76 <__bss_end+0x2d76>
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd7e <__bss_end+0x2d7e>
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 28                	add    %ch,(%rax)
+  804d69:	18 80 00 00 00 00    	sbb    %al,0x0(%rax)
+  804d6f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd8e <__bss_end+0x2d8e>
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd96 <__bss_end+0x2d96>
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cd9e <__bss_end+0x2d9e>
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cda6 <__bss_end+0x2da6>
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdae <__bss_end+0x2dae>
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdb6 <__bss_end+0x2db6>
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdbe <__bss_end+0x2dbe>
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdc6 <__bss_end+0x2dc6>
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdce <__bss_end+0x2dce>
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdd6 <__bss_end+0x2dd6>
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 74 13 80          	add    %dh,-0x80(%rbx,%rdx,1)
+  804dc3:	00 00                	add    %al,(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 43 15             	add    %al,0x15(%rbx)
+  804dca:	80 00 00             	addb   $0x0,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdee <__bss_end+0x2dee>
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdf6 <__bss_end+0x2df6>
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80cdfe <__bss_end+0x2dfe>
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce06 <__bss_end+0x2e06>
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 a3 13 80 00 00    	add    %ah,0x8013(%rbx)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce16 <__bss_end+0x2e16>
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce1e <__bss_end+0x2e1e>
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 69 13             	add    %ch,0x13(%rcx)
+  804e0a:	80 00 00             	addb   $0x0,(%rax)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce2e <__bss_end+0x2e2e>
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce36 <__bss_end+0x2e36>
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 eb                	add    %ch,%bl
+  804e21:	16                   	(bad)
+  804e22:	80 00 00             	addb   $0x0,(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 b5 17 80 00 00    	add    %dh,0x8017(%rbp)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce4e <__bss_end+0x2e4e>
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce56 <__bss_end+0x2e56>
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 3a                	add    %bh,(%rdx)
+  804e41:	14 80                	adc    $0x80,%al
+  804e43:	00 00                	add    %al,(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce66 <__bss_end+0x2e66>
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 17                	add    %dl,(%rdi)
+  804e51:	16                   	(bad)
+  804e52:	80 00 00             	addb   $0x0,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce76 <__bss_end+0x2e76>
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce7e <__bss_end+0x2e7e>
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 28                	add    %ch,(%rax)
+  804e69:	18 80 00 00 00 00    	sbb    %al,0x0(%rax)
+  804e6f:	00 05 19 80 00 00    	add    %al,0x8019(%rip)        # 80ce8e <__bss_end+0x2e8e>
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 cd                	add    %cl,%ch
+  804e79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+	...
+
+0000000000804e80 <error_string>:
+	...
+  804e88:	45 4a 80 00 00 00 00 00 57 4a 80 00 00 00 00 00     EJ......WJ......
+  804e98:	67 4a 80 00 00 00 00 00 79 4a 80 00 00 00 00 00     gJ......yJ......
+  804ea8:	87 4a 80 00 00 00 00 00 9b 4a 80 00 00 00 00 00     .J.......J......
+  804eb8:	b0 4a 80 00 00 00 00 00 c3 4a 80 00 00 00 00 00     .J.......J......
+  804ec8:	d5 4a 80 00 00 00 00 00 e9 4a 80 00 00 00 00 00     .J.......J......
+  804ed8:	f9 4a 80 00 00 00 00 00 0c 4b 80 00 00 00 00 00     .J.......K......
+  804ee8:	23 4b 80 00 00 00 00 00 39 4b 80 00 00 00 00 00     #K......9K......
+  804ef8:	51 4b 80 00 00 00 00 00 69 4b 80 00 00 00 00 00     QK......iK......
+  804f08:	76 4b 80 00 00 00 00 00 28 4f 80 00 00 00 00 00     vK......(O......
+  804f18:	8a 4b 80 00 00 00 00 00 a2 4b 80 00 00 00 00 00     .K.......K......
+  804f28:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804f38:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804f48:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804f58:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804f68:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  804f78:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  804f88:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  804f98:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804fa8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804fb8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  804fc8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804fd8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804fe8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804ff8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805008:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805018:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805028:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805038:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000805040 <devtab>:
+  805040:	20 60 80 00 00 00 00 00 c0 60 80 00 00 00 00 00      `.......`......
+  805050:	60 61 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `a..............
+  805060:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805070:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805080:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805090:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8050a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8050b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8050c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805100:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805110:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805120:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805130:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805140:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805160:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805170:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805180:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
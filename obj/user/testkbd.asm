@@ -0,0 +1,7607 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 71 03 00 00       	call   800394 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 21 16 80 00 00 	movabs $0x801621,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba c4 3a 80 00 00 	movabs $0x803ac4,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf b5 3a 80 00 00 	movabs $0x803ab5,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba a8 3a 80 00 00 	movabs $0x803aa8,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf b5 3a 80 00 00 	movabs $0x803ab5,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc e6 3a 80 00 00 	movabs $0x803ae6,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb dd 13 80 00 00 	movabs $0x8013dd,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be f8 3a 80 00 00 	movabs $0x803af8,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd 3e 31 80 00 00 	movabs $0x80313e,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba de 3a 80 00 00 	movabs $0x803ade,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf b5 3a 80 00 00 	movabs $0x803ab5,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be f4 3a 80 00 00 	movabs $0x803af4,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be 10 3b 80 00 00 	movabs $0x803b10,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf d4 10 80 00 00 	movabs $0x8010d4,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 55                	je     800297 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800252:	48 bb 54 15 80 00 00 	movabs $0x801554,%rbx
+  800259:	00 00 00 
+  80025c:	49 bc 21 16 80 00 00 	movabs $0x801621,%r12
+  800263:	00 00 00 
+  800266:	eb 03                	jmp    80026b <devcons_read+0x36>
+  800268:	41 ff d4             	call   *%r12
+  80026b:	ff d3                	call   *%rbx
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	74 f7                	je     800268 <devcons_read+0x33>
+    if (c < 0) return c;
+  800271:	48 63 d0             	movslq %eax,%rdx
+  800274:	78 13                	js     800289 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	83 f8 04             	cmp    $0x4,%eax
+  80027e:	74 09                	je     800289 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800280:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800284:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800289:	48 89 d0             	mov    %rdx,%rax
+  80028c:	48 83 c4 08          	add    $0x8,%rsp
+  800290:	5b                   	pop    %rbx
+  800291:	41 5c                	pop    %r12
+  800293:	41 5d                	pop    %r13
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+  800297:	48 89 d0             	mov    %rdx,%rax
+  80029a:	c3                   	ret
+
+000000000080029b <cputchar>:
+cputchar(int ch) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002a3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ac:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002b0:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <getchar>:
+getchar(void) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002cb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d4:	48 b8 f1 1d 80 00 00 	movabs $0x801df1,%rax
+  8002db:	00 00 00 
+  8002de:	ff d0                	call   *%rax
+  8002e0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	78 06                	js     8002ec <getchar+0x2e>
+  8002e6:	74 08                	je     8002f0 <getchar+0x32>
+  8002e8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002ec:	89 d0                	mov    %edx,%eax
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002f0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8002f5:	eb f5                	jmp    8002ec <getchar+0x2e>
+
+00000000008002f7 <iscons>:
+iscons(int fdnum) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8002ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800303:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 18                	js     80032b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800317:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80031e:	00 00 00 
+  800321:	8b 00                	mov    (%rax),%eax
+  800323:	39 02                	cmp    %eax,(%rdx)
+  800325:	0f 94 c0             	sete   %al
+  800328:	0f b6 c0             	movzbl %al,%eax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <opencons>:
+opencons(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800335:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800339:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 49                	js     800392 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80034e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800353:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	78 26                	js     800392 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80036c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800370:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  800377:	00 00 
+  800379:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80037b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80037f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800386:	48 b8 80 1a 80 00 00 	movabs $0x801a80,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+}
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 56                	push   %r14
+  80039a:	41 55                	push   %r13
+  80039c:	41 54                	push   %r12
+  80039e:	53                   	push   %rbx
+  80039f:	41 89 fd             	mov    %edi,%r13d
+  8003a2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a5:	48 ba d8 51 80 00 00 	movabs $0x8051d8,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 b8 d8 51 80 00 00 	movabs $0x8051d8,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 39 c2             	cmp    %rax,%rdx
+  8003bc:	73 17                	jae    8003d5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003be:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c1:	49 89 c4             	mov    %rax,%r12
+  8003c4:	48 83 c3 08          	add    $0x8,%rbx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d0:	4c 39 e3             	cmp    %r12,%rbx
+  8003d3:	72 ef                	jb     8003c4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003d5:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003e6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8003ea:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8003ee:	48 c1 e0 04          	shl    $0x4,%rax
+  8003f2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003f9:	00 00 00 
+  8003fc:	48 01 d0             	add    %rdx,%rax
+  8003ff:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800406:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800409:	45 85 ed             	test   %r13d,%r13d
+  80040c:	7e 0d                	jle    80041b <libmain+0x87>
+  80040e:	49 8b 06             	mov    (%r14),%rax
+  800411:	48 a3 98 50 80 00 00 	movabs %rax,0x805098
+  800418:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80041b:	4c 89 f6             	mov    %r14,%rsi
+  80041e:	44 89 ef             	mov    %r13d,%edi
+  800421:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800428:	00 00 00 
+  80042b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80042d:	48 b8 42 04 80 00 00 	movabs $0x800442,%rax
+  800434:	00 00 00 
+  800437:	ff d0                	call   *%rax
+#endif
+}
+  800439:	5b                   	pop    %rbx
+  80043a:	41 5c                	pop    %r12
+  80043c:	41 5d                	pop    %r13
+  80043e:	41 5e                	pop    %r14
+  800440:	5d                   	pop    %rbp
+  800441:	c3                   	ret
+
+0000000000800442 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800442:	55                   	push   %rbp
+  800443:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800446:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  80044d:	00 00 00 
+  800450:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800452:	bf 00 00 00 00       	mov    $0x0,%edi
+  800457:	48 b8 85 15 80 00 00 	movabs $0x801585,%rax
+  80045e:	00 00 00 
+  800461:	ff d0                	call   *%rax
+}
+  800463:	5d                   	pop    %rbp
+  800464:	c3                   	ret
+
+0000000000800465 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800465:	55                   	push   %rbp
+  800466:	48 89 e5             	mov    %rsp,%rbp
+  800469:	41 56                	push   %r14
+  80046b:	41 55                	push   %r13
+  80046d:	41 54                	push   %r12
+  80046f:	53                   	push   %rbx
+  800470:	48 83 ec 50          	sub    $0x50,%rsp
+  800474:	49 89 fc             	mov    %rdi,%r12
+  800477:	41 89 f5             	mov    %esi,%r13d
+  80047a:	48 89 d3             	mov    %rdx,%rbx
+  80047d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800481:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800485:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800489:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800490:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800494:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800498:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80049c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a0:	48 b8 98 50 80 00 00 	movabs $0x805098,%rax
+  8004a7:	00 00 00 
+  8004aa:	4c 8b 30             	mov    (%rax),%r14
+  8004ad:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  8004b4:	00 00 00 
+  8004b7:	ff d0                	call   *%rax
+  8004b9:	89 c6                	mov    %eax,%esi
+  8004bb:	45 89 e8             	mov    %r13d,%r8d
+  8004be:	4c 89 e1             	mov    %r12,%rcx
+  8004c1:	4c 89 f2             	mov    %r14,%rdx
+  8004c4:	48 bf 28 3b 80 00 00 	movabs $0x803b28,%rdi
+  8004cb:	00 00 00 
+  8004ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d3:	49 bc b5 05 80 00 00 	movabs $0x8005b5,%r12
+  8004da:	00 00 00 
+  8004dd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004e0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004e4:	48 89 df             	mov    %rbx,%rdi
+  8004e7:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004f3:	48 bf 0e 3b 80 00 00 	movabs $0x803b0e,%rdi
+  8004fa:	00 00 00 
+  8004fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800502:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800505:	cc                   	int3
+  800506:	eb fd                	jmp    800505 <_panic+0xa0>
+
+0000000000800508 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800508:	55                   	push   %rbp
+  800509:	48 89 e5             	mov    %rsp,%rbp
+  80050c:	53                   	push   %rbx
+  80050d:	48 83 ec 08          	sub    $0x8,%rsp
+  800511:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800514:	8b 06                	mov    (%rsi),%eax
+  800516:	8d 50 01             	lea    0x1(%rax),%edx
+  800519:	89 16                	mov    %edx,(%rsi)
+  80051b:	48 98                	cltq
+  80051d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800522:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800528:	74 0a                	je     800534 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80052a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80052e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800532:	c9                   	leave
+  800533:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800534:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800538:	be ff 00 00 00       	mov    $0xff,%esi
+  80053d:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  800544:	00 00 00 
+  800547:	ff d0                	call   *%rax
+        state->offset = 0;
+  800549:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80054f:	eb d9                	jmp    80052a <putch+0x22>
+
+0000000000800551 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80055c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80055f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800566:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80056b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800570:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800573:	48 89 f1             	mov    %rsi,%rcx
+  800576:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80057d:	48 bf 08 05 80 00 00 	movabs $0x800508,%rdi
+  800584:	00 00 00 
+  800587:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800593:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80059a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005a1:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  8005a8:	00 00 00 
+  8005ab:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005ad:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005b3:	c9                   	leave
+  8005b4:	c3                   	ret
+
+00000000008005b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005b5:	55                   	push   %rbp
+  8005b6:	48 89 e5             	mov    %rsp,%rbp
+  8005b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8005bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005d1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005e8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ec:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8005f3:	00 00 00 
+  8005f6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+
+00000000008005fa <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	41 57                	push   %r15
+  800600:	41 56                	push   %r14
+  800602:	41 55                	push   %r13
+  800604:	41 54                	push   %r12
+  800606:	53                   	push   %rbx
+  800607:	48 83 ec 18          	sub    $0x18,%rsp
+  80060b:	49 89 fc             	mov    %rdi,%r12
+  80060e:	49 89 f5             	mov    %rsi,%r13
+  800611:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800615:	8b 45 10             	mov    0x10(%rbp),%eax
+  800618:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80061b:	41 89 cf             	mov    %ecx,%r15d
+  80061e:	4c 39 fa             	cmp    %r15,%rdx
+  800621:	73 5b                	jae    80067e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800623:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800627:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80062b:	85 db                	test   %ebx,%ebx
+  80062d:	7e 0e                	jle    80063d <print_num+0x43>
+            putch(padc, put_arg);
+  80062f:	4c 89 ee             	mov    %r13,%rsi
+  800632:	44 89 f7             	mov    %r14d,%edi
+  800635:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800638:	83 eb 01             	sub    $0x1,%ebx
+  80063b:	75 f2                	jne    80062f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80063d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800641:	48 b9 5c 3b 80 00 00 	movabs $0x803b5c,%rcx
+  800648:	00 00 00 
+  80064b:	48 b8 4b 3b 80 00 00 	movabs $0x803b4b,%rax
+  800652:	00 00 00 
+  800655:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800659:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80065d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800662:	49 f7 f7             	div    %r15
+  800665:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800669:	4c 89 ee             	mov    %r13,%rsi
+  80066c:	41 ff d4             	call   *%r12
+}
+  80066f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800673:	5b                   	pop    %rbx
+  800674:	41 5c                	pop    %r12
+  800676:	41 5d                	pop    %r13
+  800678:	41 5e                	pop    %r14
+  80067a:	41 5f                	pop    %r15
+  80067c:	5d                   	pop    %rbp
+  80067d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80067e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800682:	ba 00 00 00 00       	mov    $0x0,%edx
+  800687:	49 f7 f7             	div    %r15
+  80068a:	48 83 ec 08          	sub    $0x8,%rsp
+  80068e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800692:	52                   	push   %rdx
+  800693:	45 0f be c9          	movsbl %r9b,%r9d
+  800697:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80069b:	48 89 c2             	mov    %rax,%rdx
+  80069e:	48 b8 fa 05 80 00 00 	movabs $0x8005fa,%rax
+  8006a5:	00 00 00 
+  8006a8:	ff d0                	call   *%rax
+  8006aa:	48 83 c4 10          	add    $0x10,%rsp
+  8006ae:	eb 8d                	jmp    80063d <print_num+0x43>
+
+00000000008006b0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006b0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006b4:	48 8b 06             	mov    (%rsi),%rax
+  8006b7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006bb:	73 0a                	jae    8006c7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c1:	48 89 16             	mov    %rdx,(%rsi)
+  8006c4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006c7:	c3                   	ret
+
+00000000008006c8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006c8:	55                   	push   %rbp
+  8006c9:	48 89 e5             	mov    %rsp,%rbp
+  8006cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006dc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006f3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006f7:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  8006fe:	00 00 00 
+  800701:	ff d0                	call   *%rax
+}
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+
+0000000000800705 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	41 57                	push   %r15
+  80070b:	41 56                	push   %r14
+  80070d:	41 55                	push   %r13
+  80070f:	41 54                	push   %r12
+  800711:	53                   	push   %rbx
+  800712:	48 83 ec 38          	sub    $0x38,%rsp
+  800716:	49 89 fe             	mov    %rdi,%r14
+  800719:	49 89 f5             	mov    %rsi,%r13
+  80071c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80071f:	48 8b 01             	mov    (%rcx),%rax
+  800722:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800726:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80072a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800732:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800736:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80073a:	0f b6 3b             	movzbl (%rbx),%edi
+  80073d:	40 80 ff 25          	cmp    $0x25,%dil
+  800741:	74 18                	je     80075b <vprintfmt+0x56>
+            if (!ch) return;
+  800743:	40 84 ff             	test   %dil,%dil
+  800746:	0f 84 b1 06 00 00    	je     800dfd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80074c:	40 0f b6 ff          	movzbl %dil,%edi
+  800750:	4c 89 ee             	mov    %r13,%rsi
+  800753:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800756:	4c 89 e3             	mov    %r12,%rbx
+  800759:	eb db                	jmp    800736 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80075b:	be 00 00 00 00       	mov    $0x0,%esi
+  800760:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800764:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800769:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800776:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80077f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800784:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800787:	83 e8 23             	sub    $0x23,%eax
+  80078a:	3c 57                	cmp    $0x57,%al
+  80078c:	0f 87 51 06 00 00    	ja     800de3 <vprintfmt+0x6de>
+  800792:	0f b6 c0             	movzbl %al,%eax
+  800795:	48 b9 00 3d 80 00 00 	movabs $0x803d00,%rcx
+  80079c:	00 00 00 
+  80079f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007a5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a9:	eb cf                	jmp    80077a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007ab:	49 89 dc             	mov    %rbx,%r12
+  8007ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8007b3:	eb c5                	jmp    80077a <vprintfmt+0x75>
+            padc = ch;
+  8007b5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007bc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007bf:	eb b9                	jmp    80077a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c7:	77 24                	ja     8007ed <vprintfmt+0xe8>
+  8007c9:	89 c1                	mov    %eax,%ecx
+  8007cb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007cf:	83 c0 08             	add    $0x8,%eax
+  8007d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007d8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007db:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007df:	79 99                	jns    80077a <vprintfmt+0x75>
+                width = precision;
+  8007e1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007e5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007eb:	eb 8d                	jmp    80077a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007f1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f9:	eb da                	jmp    8007d5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007fb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800800:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800804:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80080a:	3c 39                	cmp    $0x39,%al
+  80080c:	77 1c                	ja     80082a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80080e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800812:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800816:	0f b6 c0             	movzbl %al,%eax
+  800819:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80081e:	0f b6 03             	movzbl (%rbx),%eax
+  800821:	3c 39                	cmp    $0x39,%al
+  800823:	76 e9                	jbe    80080e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800828:	eb b1                	jmp    8007db <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80082a:	49 89 dc             	mov    %rbx,%r12
+  80082d:	eb ac                	jmp    8007db <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80082f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800832:	85 c9                	test   %ecx,%ecx
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	0f 49 c1             	cmovns %ecx,%eax
+  80083c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80083f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800842:	e9 33 ff ff ff       	jmp    80077a <vprintfmt+0x75>
+            lflag++;
+  800847:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80084a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80084d:	e9 28 ff ff ff       	jmp    80077a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800852:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800855:	83 f8 2f             	cmp    $0x2f,%eax
+  800858:	77 19                	ja     800873 <vprintfmt+0x16e>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	8b 3a                	mov    (%rdx),%edi
+  800868:	4c 89 ee             	mov    %r13,%rsi
+  80086b:	41 ff d6             	call   *%r14
+            break;
+  80086e:	e9 c3 fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb e5                	jmp    800866 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	77 5a                	ja     8008e3 <vprintfmt+0x1de>
+  800889:	89 c2                	mov    %eax,%edx
+  80088b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088f:	83 c0 08             	add    $0x8,%eax
+  800892:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800895:	8b 02                	mov    (%rdx),%eax
+  800897:	89 c1                	mov    %eax,%ecx
+  800899:	f7 d9                	neg    %ecx
+  80089b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80089e:	83 f9 14             	cmp    $0x14,%ecx
+  8008a1:	7f 4e                	jg     8008f1 <vprintfmt+0x1ec>
+  8008a3:	48 63 c1             	movslq %ecx,%rax
+  8008a6:	48 ba c0 3f 80 00 00 	movabs $0x803fc0,%rdx
+  8008ad:	00 00 00 
+  8008b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008b4:	48 85 c0             	test   %rax,%rax
+  8008b7:	74 38                	je     8008f1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b9:	48 89 c1             	mov    %rax,%rcx
+  8008bc:	48 ba b9 41 80 00 00 	movabs $0x8041b9,%rdx
+  8008c3:	00 00 00 
+  8008c6:	4c 89 ee             	mov    %r13,%rsi
+  8008c9:	4c 89 f7             	mov    %r14,%rdi
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	49 b8 c8 06 80 00 00 	movabs $0x8006c8,%r8
+  8008d8:	00 00 00 
+  8008db:	41 ff d0             	call   *%r8
+  8008de:	e9 53 fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ef:	eb a4                	jmp    800895 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008f1:	48 ba 74 3b 80 00 00 	movabs $0x803b74,%rdx
+  8008f8:	00 00 00 
+  8008fb:	4c 89 ee             	mov    %r13,%rsi
+  8008fe:	4c 89 f7             	mov    %r14,%rdi
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	49 b8 c8 06 80 00 00 	movabs $0x8006c8,%r8
+  80090d:	00 00 00 
+  800910:	41 ff d0             	call   *%r8
+  800913:	e9 1e fe ff ff       	jmp    800736 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 6c                	ja     80098c <vprintfmt+0x287>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80092f:	48 85 d2             	test   %rdx,%rdx
+  800932:	48 b8 6d 3b 80 00 00 	movabs $0x803b6d,%rax
+  800939:	00 00 00 
+  80093c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800940:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800944:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800948:	7e 06                	jle    800950 <vprintfmt+0x24b>
+  80094a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80094e:	75 4a                	jne    80099a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800950:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800954:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800958:	0f b6 00             	movzbl (%rax),%eax
+  80095b:	84 c0                	test   %al,%al
+  80095d:	0f 85 9a 00 00 00    	jne    8009fd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800963:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800966:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80096a:	85 c0                	test   %eax,%eax
+  80096c:	0f 8e c4 fd ff ff    	jle    800736 <vprintfmt+0x31>
+  800972:	4c 89 ee             	mov    %r13,%rsi
+  800975:	bf 20 00 00 00       	mov    $0x20,%edi
+  80097a:	41 ff d6             	call   *%r14
+  80097d:	41 83 ec 01          	sub    $0x1,%r12d
+  800981:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800985:	75 eb                	jne    800972 <vprintfmt+0x26d>
+  800987:	e9 aa fd ff ff       	jmp    800736 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80098c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800998:	eb 92                	jmp    80092c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80099a:	49 63 f7             	movslq %r15d,%rsi
+  80099d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009a1:	48 b8 b7 0e 80 00 00 	movabs $0x800eb7,%rax
+  8009a8:	00 00 00 
+  8009ab:	ff d0                	call   *%rax
+  8009ad:	48 89 c2             	mov    %rax,%rdx
+  8009b0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009b5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009b8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009bb:	85 c0                	test   %eax,%eax
+  8009bd:	7e 91                	jle    800950 <vprintfmt+0x24b>
+  8009bf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009c4:	4c 89 ee             	mov    %r13,%rsi
+  8009c7:	44 89 e7             	mov    %r12d,%edi
+  8009ca:	41 ff d6             	call   *%r14
+  8009cd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009d4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009d7:	75 eb                	jne    8009c4 <vprintfmt+0x2bf>
+  8009d9:	e9 72 ff ff ff       	jmp    800950 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009de:	0f b6 f8             	movzbl %al,%edi
+  8009e1:	4c 89 ee             	mov    %r13,%rsi
+  8009e4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009e7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009eb:	49 83 c4 01          	add    $0x1,%r12
+  8009ef:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009f5:	84 c0                	test   %al,%al
+  8009f7:	0f 84 66 ff ff ff    	je     800963 <vprintfmt+0x25e>
+  8009fd:	45 85 ff             	test   %r15d,%r15d
+  800a00:	78 0a                	js     800a0c <vprintfmt+0x307>
+  800a02:	41 83 ef 01          	sub    $0x1,%r15d
+  800a06:	0f 88 57 ff ff ff    	js     800963 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a0c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a10:	74 cc                	je     8009de <vprintfmt+0x2d9>
+  800a12:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a15:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a1a:	80 fa 5e             	cmp    $0x5e,%dl
+  800a1d:	77 c2                	ja     8009e1 <vprintfmt+0x2dc>
+  800a1f:	eb bd                	jmp    8009de <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a21:	40 84 f6             	test   %sil,%sil
+  800a24:	75 26                	jne    800a4c <vprintfmt+0x347>
+    switch (lflag) {
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 59                	je     800a83 <vprintfmt+0x37e>
+  800a2a:	83 fa 01             	cmp    $0x1,%edx
+  800a2d:	74 7b                	je     800aaa <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	0f 87 96 00 00 00    	ja     800ad1 <vprintfmt+0x3cc>
+  800a3b:	89 c2                	mov    %eax,%edx
+  800a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	4c 8b 22             	mov    (%rdx),%r12
+  800a4a:	eb 17                	jmp    800a63 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a52:	77 21                	ja     800a75 <vprintfmt+0x370>
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5a:	83 c0 08             	add    $0x8,%eax
+  800a5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a60:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a63:	4d 85 e4             	test   %r12,%r12
+  800a66:	78 7a                	js     800ae2 <vprintfmt+0x3dd>
+            num = i;
+  800a68:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a6b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a70:	e9 50 02 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb dd                	jmp    800a60 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 11                	ja     800a9c <vprintfmt+0x397>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	4c 63 22             	movslq (%rdx),%r12
+  800a9a:	eb c7                	jmp    800a63 <vprintfmt+0x35e>
+  800a9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa8:	eb ed                	jmp    800a97 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 11                	ja     800ac3 <vprintfmt+0x3be>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab8:	83 c0 08             	add    $0x8,%eax
+  800abb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abe:	4c 8b 22             	mov    (%rdx),%r12
+  800ac1:	eb a0                	jmp    800a63 <vprintfmt+0x35e>
+  800ac3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acf:	eb ed                	jmp    800abe <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ad1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800add:	e9 65 ff ff ff       	jmp    800a47 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ae2:	4c 89 ee             	mov    %r13,%rsi
+  800ae5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aea:	41 ff d6             	call   *%r14
+                i = -i;
+  800aed:	49 f7 dc             	neg    %r12
+  800af0:	e9 73 ff ff ff       	jmp    800a68 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800af5:	40 84 f6             	test   %sil,%sil
+  800af8:	75 32                	jne    800b2c <vprintfmt+0x427>
+    switch (lflag) {
+  800afa:	85 d2                	test   %edx,%edx
+  800afc:	74 5d                	je     800b5b <vprintfmt+0x456>
+  800afe:	83 fa 01             	cmp    $0x1,%edx
+  800b01:	0f 84 82 00 00 00    	je     800b89 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	0f 87 a5 00 00 00    	ja     800bb8 <vprintfmt+0x4b3>
+  800b13:	89 c2                	mov    %eax,%edx
+  800b15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b19:	83 c0 08             	add    $0x8,%eax
+  800b1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b22:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b27:	e9 99 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 19                	ja     800b4d <vprintfmt+0x448>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b48:	e9 78 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800b4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b59:	eb e5                	jmp    800b40 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b61:	77 18                	ja     800b7b <vprintfmt+0x476>
+  800b63:	89 c2                	mov    %eax,%edx
+  800b65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b69:	83 c0 08             	add    $0x8,%eax
+  800b6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b76:	e9 4a 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b87:	eb e6                	jmp    800b6f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 19                	ja     800baa <vprintfmt+0x4a5>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba5:	e9 1b 01 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb6:	eb e5                	jmp    800b9d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc4:	e9 56 ff ff ff       	jmp    800b1f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc9:	40 84 f6             	test   %sil,%sil
+  800bcc:	75 2e                	jne    800bfc <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bce:	85 d2                	test   %edx,%edx
+  800bd0:	74 59                	je     800c2b <vprintfmt+0x526>
+  800bd2:	83 fa 01             	cmp    $0x1,%edx
+  800bd5:	74 7f                	je     800c56 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	0f 87 9f 00 00 00    	ja     800c82 <vprintfmt+0x57d>
+  800be3:	89 c2                	mov    %eax,%edx
+  800be5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be9:	83 c0 08             	add    $0x8,%eax
+  800bec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bf7:	e9 c9 00 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 19                	ja     800c1d <vprintfmt+0x518>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c13:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c18:	e9 a8 00 00 00       	jmp    800cc5 <vprintfmt+0x5c0>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb e5                	jmp    800c10 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c31:	77 15                	ja     800c48 <vprintfmt+0x543>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c39:	83 c0 08             	add    $0x8,%eax
+  800c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c41:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c46:	eb 7d                	jmp    800cc5 <vprintfmt+0x5c0>
+  800c48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c54:	eb e9                	jmp    800c3f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c59:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5c:	77 16                	ja     800c74 <vprintfmt+0x56f>
+  800c5e:	89 c2                	mov    %eax,%edx
+  800c60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c64:	83 c0 08             	add    $0x8,%eax
+  800c67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c6d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c72:	eb 51                	jmp    800cc5 <vprintfmt+0x5c0>
+  800c74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c80:	eb e8                	jmp    800c6a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8e:	e9 5c ff ff ff       	jmp    800bef <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c93:	4c 89 ee             	mov    %r13,%rsi
+  800c96:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c9b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c9e:	4c 89 ee             	mov    %r13,%rsi
+  800ca1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ca6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cac:	83 f8 2f             	cmp    $0x2f,%eax
+  800caf:	77 47                	ja     800cf8 <vprintfmt+0x5f3>
+  800cb1:	89 c2                	mov    %eax,%edx
+  800cb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb7:	83 c0 08             	add    $0x8,%eax
+  800cba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cc5:	48 83 ec 08          	sub    $0x8,%rsp
+  800cc9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ccd:	0f 94 c0             	sete   %al
+  800cd0:	0f b6 c0             	movzbl %al,%eax
+  800cd3:	50                   	push   %rax
+  800cd4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cd9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cdd:	4c 89 ee             	mov    %r13,%rsi
+  800ce0:	4c 89 f7             	mov    %r14,%rdi
+  800ce3:	48 b8 fa 05 80 00 00 	movabs $0x8005fa,%rax
+  800cea:	00 00 00 
+  800ced:	ff d0                	call   *%rax
+            break;
+  800cef:	48 83 c4 10          	add    $0x10,%rsp
+  800cf3:	e9 3e fa ff ff       	jmp    800736 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d04:	eb b7                	jmp    800cbd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d06:	40 84 f6             	test   %sil,%sil
+  800d09:	75 2b                	jne    800d36 <vprintfmt+0x631>
+    switch (lflag) {
+  800d0b:	85 d2                	test   %edx,%edx
+  800d0d:	74 56                	je     800d65 <vprintfmt+0x660>
+  800d0f:	83 fa 01             	cmp    $0x1,%edx
+  800d12:	74 7f                	je     800d93 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d17:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1a:	0f 87 a2 00 00 00    	ja     800dc2 <vprintfmt+0x6bd>
+  800d20:	89 c2                	mov    %eax,%edx
+  800d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d26:	83 c0 08             	add    $0x8,%eax
+  800d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d34:	eb 8f                	jmp    800cc5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d39:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3c:	77 19                	ja     800d57 <vprintfmt+0x652>
+  800d3e:	89 c2                	mov    %eax,%edx
+  800d40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d44:	83 c0 08             	add    $0x8,%eax
+  800d47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d52:	e9 6e ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800d57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d63:	eb e5                	jmp    800d4a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d68:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6b:	77 18                	ja     800d85 <vprintfmt+0x680>
+  800d6d:	89 c2                	mov    %eax,%edx
+  800d6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d73:	83 c0 08             	add    $0x8,%eax
+  800d76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d79:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d80:	e9 40 ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800d85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d91:	eb e6                	jmp    800d79 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d96:	83 f8 2f             	cmp    $0x2f,%eax
+  800d99:	77 19                	ja     800db4 <vprintfmt+0x6af>
+  800d9b:	89 c2                	mov    %eax,%edx
+  800d9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da1:	83 c0 08             	add    $0x8,%eax
+  800da4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800daa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800daf:	e9 11 ff ff ff       	jmp    800cc5 <vprintfmt+0x5c0>
+  800db4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc0:	eb e5                	jmp    800da7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dce:	e9 59 ff ff ff       	jmp    800d2c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dd3:	4c 89 ee             	mov    %r13,%rsi
+  800dd6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ddb:	41 ff d6             	call   *%r14
+            break;
+  800dde:	e9 53 f9 ff ff       	jmp    800736 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800de3:	4c 89 ee             	mov    %r13,%rsi
+  800de6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800deb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dee:	48 83 eb 01          	sub    $0x1,%rbx
+  800df2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800df6:	75 f6                	jne    800dee <vprintfmt+0x6e9>
+  800df8:	e9 39 f9 ff ff       	jmp    800736 <vprintfmt+0x31>
+}
+  800dfd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e01:	5b                   	pop    %rbx
+  800e02:	41 5c                	pop    %r12
+  800e04:	41 5d                	pop    %r13
+  800e06:	41 5e                	pop    %r14
+  800e08:	41 5f                	pop    %r15
+  800e0a:	5d                   	pop    %rbp
+  800e0b:	c3                   	ret
+
+0000000000800e0c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e0c:	55                   	push   %rbp
+  800e0d:	48 89 e5             	mov    %rsp,%rbp
+  800e10:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e18:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e21:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e28:	48 85 ff             	test   %rdi,%rdi
+  800e2b:	74 2b                	je     800e58 <vsnprintf+0x4c>
+  800e2d:	48 85 f6             	test   %rsi,%rsi
+  800e30:	74 26                	je     800e58 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e32:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e36:	48 bf b0 06 80 00 00 	movabs $0x8006b0,%rdi
+  800e3d:	00 00 00 
+  800e40:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e50:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e56:	c9                   	leave
+  800e57:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e5d:	eb f7                	jmp    800e56 <vsnprintf+0x4a>
+
+0000000000800e5f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e5f:	55                   	push   %rbp
+  800e60:	48 89 e5             	mov    %rsp,%rbp
+  800e63:	48 83 ec 50          	sub    $0x50,%rsp
+  800e67:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e6b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e6f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e73:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e82:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e86:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e8a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e8e:	48 b8 0c 0e 80 00 00 	movabs $0x800e0c,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e9a:	c9                   	leave
+  800e9b:	c3                   	ret
+
+0000000000800e9c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e9c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e9f:	74 10                	je     800eb1 <strlen+0x15>
+    size_t n = 0;
+  800ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ea6:	48 83 c0 01          	add    $0x1,%rax
+  800eaa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eae:	75 f6                	jne    800ea6 <strlen+0xa>
+  800eb0:	c3                   	ret
+    size_t n = 0;
+  800eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eb7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800eba:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ebf:	48 85 f6             	test   %rsi,%rsi
+  800ec2:	74 11                	je     800ed5 <strnlen+0x1e>
+  800ec4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ec8:	74 0c                	je     800ed6 <strnlen+0x1f>
+  800eca:	48 83 c2 01          	add    $0x1,%rdx
+  800ece:	48 39 d0             	cmp    %rdx,%rax
+  800ed1:	75 f1                	jne    800ec4 <strnlen+0xd>
+  800ed3:	eb 04                	jmp    800ed9 <strnlen+0x22>
+  800ed5:	c3                   	ret
+  800ed6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ed9:	c3                   	ret
+
+0000000000800eda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eda:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ee6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ee9:	48 83 c2 01          	add    $0x1,%rdx
+  800eed:	84 c9                	test   %cl,%cl
+  800eef:	75 f1                	jne    800ee2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ef2:	55                   	push   %rbp
+  800ef3:	48 89 e5             	mov    %rsp,%rbp
+  800ef6:	41 54                	push   %r12
+  800ef8:	53                   	push   %rbx
+  800ef9:	48 89 fb             	mov    %rdi,%rbx
+  800efc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800eff:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  800f06:	00 00 00 
+  800f09:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f0b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f0f:	4c 89 e6             	mov    %r12,%rsi
+  800f12:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+    return dst;
+}
+  800f1e:	48 89 d8             	mov    %rbx,%rax
+  800f21:	5b                   	pop    %rbx
+  800f22:	41 5c                	pop    %r12
+  800f24:	5d                   	pop    %rbp
+  800f25:	c3                   	ret
+
+0000000000800f26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f26:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f29:	48 85 d2             	test   %rdx,%rdx
+  800f2c:	74 1f                	je     800f4d <strncpy+0x27>
+  800f2e:	48 01 fa             	add    %rdi,%rdx
+  800f31:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f34:	48 83 c1 01          	add    $0x1,%rcx
+  800f38:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f3c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f40:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f44:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f48:	48 39 ca             	cmp    %rcx,%rdx
+  800f4b:	75 e7                	jne    800f34 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f4d:	c3                   	ret
+
+0000000000800f4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f4e:	48 89 f8             	mov    %rdi,%rax
+  800f51:	48 85 d2             	test   %rdx,%rdx
+  800f54:	74 24                	je     800f7a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f56:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5a:	74 1b                	je     800f77 <strlcpy+0x29>
+  800f5c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f60:	0f b6 16             	movzbl (%rsi),%edx
+  800f63:	84 d2                	test   %dl,%dl
+  800f65:	74 10                	je     800f77 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f67:	48 83 c6 01          	add    $0x1,%rsi
+  800f6b:	48 83 c0 01          	add    $0x1,%rax
+  800f6f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f72:	48 39 c8             	cmp    %rcx,%rax
+  800f75:	75 e9                	jne    800f60 <strlcpy+0x12>
+        *dst = '\0';
+  800f77:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f7a:	48 29 f8             	sub    %rdi,%rax
+}
+  800f7d:	c3                   	ret
+
+0000000000800f7e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f7e:	0f b6 07             	movzbl (%rdi),%eax
+  800f81:	84 c0                	test   %al,%al
+  800f83:	74 13                	je     800f98 <strcmp+0x1a>
+  800f85:	38 06                	cmp    %al,(%rsi)
+  800f87:	75 0f                	jne    800f98 <strcmp+0x1a>
+  800f89:	48 83 c7 01          	add    $0x1,%rdi
+  800f8d:	48 83 c6 01          	add    $0x1,%rsi
+  800f91:	0f b6 07             	movzbl (%rdi),%eax
+  800f94:	84 c0                	test   %al,%al
+  800f96:	75 ed                	jne    800f85 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f98:	0f b6 c0             	movzbl %al,%eax
+  800f9b:	0f b6 16             	movzbl (%rsi),%edx
+  800f9e:	29 d0                	sub    %edx,%eax
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa1:	48 85 d2             	test   %rdx,%rdx
+  800fa4:	74 1f                	je     800fc5 <strncmp+0x24>
+  800fa6:	0f b6 07             	movzbl (%rdi),%eax
+  800fa9:	84 c0                	test   %al,%al
+  800fab:	74 1e                	je     800fcb <strncmp+0x2a>
+  800fad:	3a 06                	cmp    (%rsi),%al
+  800faf:	75 1a                	jne    800fcb <strncmp+0x2a>
+  800fb1:	48 83 c7 01          	add    $0x1,%rdi
+  800fb5:	48 83 c6 01          	add    $0x1,%rsi
+  800fb9:	48 83 ea 01          	sub    $0x1,%rdx
+  800fbd:	75 e7                	jne    800fa6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc4:	c3                   	ret
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	c3                   	ret
+  800fcb:	48 85 d2             	test   %rdx,%rdx
+  800fce:	74 09                	je     800fd9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd0:	0f b6 07             	movzbl (%rdi),%eax
+  800fd3:	0f b6 16             	movzbl (%rsi),%edx
+  800fd6:	29 d0                	sub    %edx,%eax
+  800fd8:	c3                   	ret
+    if (!n) return 0;
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fde:	c3                   	ret
+
+0000000000800fdf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fdf:	0f b6 17             	movzbl (%rdi),%edx
+  800fe2:	84 d2                	test   %dl,%dl
+  800fe4:	74 18                	je     800ffe <strchr+0x1f>
+        if (*str == c) {
+  800fe6:	0f be d2             	movsbl %dl,%edx
+  800fe9:	39 f2                	cmp    %esi,%edx
+  800feb:	74 17                	je     801004 <strchr+0x25>
+    for (; *str; str++) {
+  800fed:	48 83 c7 01          	add    $0x1,%rdi
+  800ff1:	0f b6 17             	movzbl (%rdi),%edx
+  800ff4:	84 d2                	test   %dl,%dl
+  800ff6:	75 ee                	jne    800fe6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffd:	c3                   	ret
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801003:	c3                   	ret
+  801004:	48 89 f8             	mov    %rdi,%rax
+}
+  801007:	c3                   	ret
+
+0000000000801008 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801008:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80100b:	0f b6 17             	movzbl (%rdi),%edx
+  80100e:	84 d2                	test   %dl,%dl
+  801010:	74 13                	je     801025 <strfind+0x1d>
+  801012:	0f be d2             	movsbl %dl,%edx
+  801015:	39 f2                	cmp    %esi,%edx
+  801017:	74 0b                	je     801024 <strfind+0x1c>
+  801019:	48 83 c0 01          	add    $0x1,%rax
+  80101d:	0f b6 10             	movzbl (%rax),%edx
+  801020:	84 d2                	test   %dl,%dl
+  801022:	75 ee                	jne    801012 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801024:	c3                   	ret
+  801025:	c3                   	ret
+
+0000000000801026 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801026:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801029:	48 89 f8             	mov    %rdi,%rax
+  80102c:	48 f7 d8             	neg    %rax
+  80102f:	83 e0 07             	and    $0x7,%eax
+  801032:	49 89 d1             	mov    %rdx,%r9
+  801035:	49 29 c1             	sub    %rax,%r9
+  801038:	78 36                	js     801070 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80103a:	40 0f b6 c6          	movzbl %sil,%eax
+  80103e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801045:	01 01 01 
+  801048:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80104c:	40 f6 c7 07          	test   $0x7,%dil
+  801050:	75 38                	jne    80108a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801052:	4c 89 c9             	mov    %r9,%rcx
+  801055:	48 c1 f9 03          	sar    $0x3,%rcx
+  801059:	74 0c                	je     801067 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80105b:	fc                   	cld
+  80105c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80105f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801063:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801067:	4d 85 c9             	test   %r9,%r9
+  80106a:	75 45                	jne    8010b1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80106c:	4c 89 c0             	mov    %r8,%rax
+  80106f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801070:	48 85 d2             	test   %rdx,%rdx
+  801073:	74 f7                	je     80106c <memset+0x46>
+  801075:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801078:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80107b:	48 83 c0 01          	add    $0x1,%rax
+  80107f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801083:	48 39 c2             	cmp    %rax,%rdx
+  801086:	75 f3                	jne    80107b <memset+0x55>
+  801088:	eb e2                	jmp    80106c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80108a:	40 f6 c7 01          	test   $0x1,%dil
+  80108e:	74 06                	je     801096 <memset+0x70>
+  801090:	88 07                	mov    %al,(%rdi)
+  801092:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801096:	40 f6 c7 02          	test   $0x2,%dil
+  80109a:	74 07                	je     8010a3 <memset+0x7d>
+  80109c:	66 89 07             	mov    %ax,(%rdi)
+  80109f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a3:	40 f6 c7 04          	test   $0x4,%dil
+  8010a7:	74 a9                	je     801052 <memset+0x2c>
+  8010a9:	89 07                	mov    %eax,(%rdi)
+  8010ab:	48 83 c7 04          	add    $0x4,%rdi
+  8010af:	eb a1                	jmp    801052 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010b1:	41 f6 c1 04          	test   $0x4,%r9b
+  8010b5:	74 06                	je     8010bd <memset+0x97>
+  8010b7:	89 07                	mov    %eax,(%rdi)
+  8010b9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010bd:	41 f6 c1 02          	test   $0x2,%r9b
+  8010c1:	74 07                	je     8010ca <memset+0xa4>
+  8010c3:	66 89 07             	mov    %ax,(%rdi)
+  8010c6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010ca:	41 f6 c1 01          	test   $0x1,%r9b
+  8010ce:	74 9c                	je     80106c <memset+0x46>
+  8010d0:	88 07                	mov    %al,(%rdi)
+  8010d2:	eb 98                	jmp    80106c <memset+0x46>
+
+00000000008010d4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010d4:	48 89 f8             	mov    %rdi,%rax
+  8010d7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010da:	48 39 fe             	cmp    %rdi,%rsi
+  8010dd:	73 3b                	jae    80111a <memmove+0x46>
+  8010df:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010e3:	48 39 d7             	cmp    %rdx,%rdi
+  8010e6:	73 32                	jae    80111a <memmove+0x46>
+        s += n;
+        d += n;
+  8010e8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ec:	48 89 d6             	mov    %rdx,%rsi
+  8010ef:	48 09 fe             	or     %rdi,%rsi
+  8010f2:	48 09 ce             	or     %rcx,%rsi
+  8010f5:	40 f6 c6 07          	test   $0x7,%sil
+  8010f9:	75 12                	jne    80110d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010fb:	48 83 ef 08          	sub    $0x8,%rdi
+  8010ff:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801103:	48 c1 e9 03          	shr    $0x3,%rcx
+  801107:	fd                   	std
+  801108:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80110b:	fc                   	cld
+  80110c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80110d:	48 83 ef 01          	sub    $0x1,%rdi
+  801111:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801115:	fd                   	std
+  801116:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801118:	eb f1                	jmp    80110b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80111a:	48 89 f2             	mov    %rsi,%rdx
+  80111d:	48 09 c2             	or     %rax,%rdx
+  801120:	48 09 ca             	or     %rcx,%rdx
+  801123:	f6 c2 07             	test   $0x7,%dl
+  801126:	75 0c                	jne    801134 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801128:	48 c1 e9 03          	shr    $0x3,%rcx
+  80112c:	48 89 c7             	mov    %rax,%rdi
+  80112f:	fc                   	cld
+  801130:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801133:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801134:	48 89 c7             	mov    %rax,%rdi
+  801137:	fc                   	cld
+  801138:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80113a:	c3                   	ret
+
+000000000080113b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80113b:	55                   	push   %rbp
+  80113c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80113f:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+}
+  80114b:	5d                   	pop    %rbp
+  80114c:	c3                   	ret
+
+000000000080114d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80114d:	55                   	push   %rbp
+  80114e:	48 89 e5             	mov    %rsp,%rbp
+  801151:	41 57                	push   %r15
+  801153:	41 56                	push   %r14
+  801155:	41 55                	push   %r13
+  801157:	41 54                	push   %r12
+  801159:	53                   	push   %rbx
+  80115a:	48 83 ec 08          	sub    $0x8,%rsp
+  80115e:	49 89 fe             	mov    %rdi,%r14
+  801161:	49 89 f7             	mov    %rsi,%r15
+  801164:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801167:	48 89 f7             	mov    %rsi,%rdi
+  80116a:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  801171:	00 00 00 
+  801174:	ff d0                	call   *%rax
+  801176:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801179:	48 89 de             	mov    %rbx,%rsi
+  80117c:	4c 89 f7             	mov    %r14,%rdi
+  80117f:	48 b8 b7 0e 80 00 00 	movabs $0x800eb7,%rax
+  801186:	00 00 00 
+  801189:	ff d0                	call   *%rax
+  80118b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80118e:	48 39 c3             	cmp    %rax,%rbx
+  801191:	74 36                	je     8011c9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801193:	48 89 d8             	mov    %rbx,%rax
+  801196:	4c 29 e8             	sub    %r13,%rax
+  801199:	49 39 c4             	cmp    %rax,%r12
+  80119c:	73 31                	jae    8011cf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80119e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011a3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a7:	4c 89 fe             	mov    %r15,%rsi
+  8011aa:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8011b1:	00 00 00 
+  8011b4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011b6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011ba:	48 83 c4 08          	add    $0x8,%rsp
+  8011be:	5b                   	pop    %rbx
+  8011bf:	41 5c                	pop    %r12
+  8011c1:	41 5d                	pop    %r13
+  8011c3:	41 5e                	pop    %r14
+  8011c5:	41 5f                	pop    %r15
+  8011c7:	5d                   	pop    %rbp
+  8011c8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011cd:	eb eb                	jmp    8011ba <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011cf:	48 83 eb 01          	sub    $0x1,%rbx
+  8011d3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011d7:	48 89 da             	mov    %rbx,%rdx
+  8011da:	4c 89 fe             	mov    %r15,%rsi
+  8011dd:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8011e4:	00 00 00 
+  8011e7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011e9:	49 01 de             	add    %rbx,%r14
+  8011ec:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011f1:	eb c3                	jmp    8011b6 <strlcat+0x69>
+
+00000000008011f3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011f3:	48 85 d2             	test   %rdx,%rdx
+  8011f6:	74 2d                	je     801225 <memcmp+0x32>
+  8011f8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011fd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801201:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801206:	44 38 c1             	cmp    %r8b,%cl
+  801209:	75 0f                	jne    80121a <memcmp+0x27>
+    while (n-- > 0) {
+  80120b:	48 83 c0 01          	add    $0x1,%rax
+  80120f:	48 39 c2             	cmp    %rax,%rdx
+  801212:	75 e9                	jne    8011fd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801214:	b8 00 00 00 00       	mov    $0x0,%eax
+  801219:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80121a:	0f b6 c1             	movzbl %cl,%eax
+  80121d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801221:	44 29 c0             	sub    %r8d,%eax
+  801224:	c3                   	ret
+    return 0;
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122a:	c3                   	ret
+
+000000000080122b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80122b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80122f:	48 39 c7             	cmp    %rax,%rdi
+  801232:	73 0f                	jae    801243 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801234:	40 38 37             	cmp    %sil,(%rdi)
+  801237:	74 0e                	je     801247 <memfind+0x1c>
+    for (; src < end; src++) {
+  801239:	48 83 c7 01          	add    $0x1,%rdi
+  80123d:	48 39 f8             	cmp    %rdi,%rax
+  801240:	75 f2                	jne    801234 <memfind+0x9>
+  801242:	c3                   	ret
+  801243:	48 89 f8             	mov    %rdi,%rax
+  801246:	c3                   	ret
+  801247:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80124a:	c3                   	ret
+
+000000000080124b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80124b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80124e:	0f b6 37             	movzbl (%rdi),%esi
+  801251:	40 80 fe 20          	cmp    $0x20,%sil
+  801255:	74 06                	je     80125d <strtol+0x12>
+  801257:	40 80 fe 09          	cmp    $0x9,%sil
+  80125b:	75 13                	jne    801270 <strtol+0x25>
+  80125d:	48 83 c7 01          	add    $0x1,%rdi
+  801261:	0f b6 37             	movzbl (%rdi),%esi
+  801264:	40 80 fe 20          	cmp    $0x20,%sil
+  801268:	74 f3                	je     80125d <strtol+0x12>
+  80126a:	40 80 fe 09          	cmp    $0x9,%sil
+  80126e:	74 ed                	je     80125d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801270:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801273:	83 e0 fd             	and    $0xfffffffd,%eax
+  801276:	3c 01                	cmp    $0x1,%al
+  801278:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80127c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801282:	75 0f                	jne    801293 <strtol+0x48>
+  801284:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801287:	74 14                	je     80129d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801289:	85 d2                	test   %edx,%edx
+  80128b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801290:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801293:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801298:	4c 63 ca             	movslq %edx,%r9
+  80129b:	eb 36                	jmp    8012d3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80129d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012a1:	74 0f                	je     8012b2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012a3:	85 d2                	test   %edx,%edx
+  8012a5:	75 ec                	jne    801293 <strtol+0x48>
+        s++;
+  8012a7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012ab:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012b0:	eb e1                	jmp    801293 <strtol+0x48>
+        s += 2;
+  8012b2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012b6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012bb:	eb d6                	jmp    801293 <strtol+0x48>
+            dig -= '0';
+  8012bd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012c0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012c4:	41 39 d0             	cmp    %edx,%r8d
+  8012c7:	7d 21                	jge    8012ea <strtol+0x9f>
+        val = val * base + dig;
+  8012c9:	49 0f af c1          	imul   %r9,%rax
+  8012cd:	0f b6 c9             	movzbl %cl,%ecx
+  8012d0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012d3:	48 83 c7 01          	add    $0x1,%rdi
+  8012d7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012db:	80 f9 39             	cmp    $0x39,%cl
+  8012de:	76 dd                	jbe    8012bd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012e0:	80 f9 7b             	cmp    $0x7b,%cl
+  8012e3:	77 05                	ja     8012ea <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012e5:	83 e9 57             	sub    $0x57,%ecx
+  8012e8:	eb d6                	jmp    8012c0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012ea:	4d 85 d2             	test   %r10,%r10
+  8012ed:	74 03                	je     8012f2 <strtol+0xa7>
+  8012ef:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012f2:	48 89 c2             	mov    %rax,%rdx
+  8012f5:	48 f7 da             	neg    %rdx
+  8012f8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012fc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801300:	c3                   	ret
+
+0000000000801301 <strrev>:
+
+void
+strrev(char *str)
+{
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	53                   	push   %rbx
+  801306:	48 83 ec 08          	sub    $0x8,%rsp
+  80130a:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  80130d:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801319:	83 e8 01             	sub    $0x1,%eax
+  80131c:	85 c0                	test   %eax,%eax
+  80131e:	7e 22                	jle    801342 <strrev+0x41>
+  801320:	48 98                	cltq
+  801322:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801327:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80132b:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  80132f:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801333:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801336:	48 83 c2 01          	add    $0x1,%rdx
+  80133a:	48 83 e8 01          	sub    $0x1,%rax
+  80133e:	39 c2                	cmp    %eax,%edx
+  801340:	7c e5                	jl     801327 <strrev+0x26>
+	}
+}
+  801342:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801346:	c9                   	leave
+  801347:	c3                   	ret
+
+0000000000801348 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801348:	85 d2                	test   %edx,%edx
+  80134a:	0f 84 80 00 00 00    	je     8013d0 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+  801354:	53                   	push   %rbx
+  801355:	48 83 ec 08          	sub    $0x8,%rsp
+  801359:	49 89 f2             	mov    %rsi,%r10
+  80135c:	41 89 d3             	mov    %edx,%r11d
+  80135f:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801362:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801367:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80136a:	eb 20                	jmp    80138c <itoa+0x44>
+			str[i++] = '0' + digit;
+  80136c:	41 89 f1             	mov    %esi,%r9d
+  80136f:	83 c2 30             	add    $0x30,%edx
+  801372:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801375:	89 f8                	mov    %edi,%eax
+  801377:	99                   	cltd
+  801378:	f7 f9                	idiv   %ecx
+  80137a:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	74 2e                	je     8013ae <itoa+0x66>
+  801380:	83 c6 01             	add    $0x1,%esi
+  801383:	49 83 c0 01          	add    $0x1,%r8
+  801387:	44 39 cb             	cmp    %r9d,%ebx
+  80138a:	7e 15                	jle    8013a1 <itoa+0x59>
+		digit = sum % base;
+  80138c:	89 f8                	mov    %edi,%eax
+  80138e:	99                   	cltd
+  80138f:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801391:	83 fa 09             	cmp    $0x9,%edx
+  801394:	7e d6                	jle    80136c <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801396:	41 89 f1             	mov    %esi,%r9d
+  801399:	83 c2 37             	add    $0x37,%edx
+  80139c:	41 88 10             	mov    %dl,(%r8)
+  80139f:	eb d4                	jmp    801375 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8013a1:	41 83 eb 01          	sub    $0x1,%r11d
+  8013a5:	45 39 cb             	cmp    %r9d,%r11d
+  8013a8:	75 04                	jne    8013ae <itoa+0x66>
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	75 28                	jne    8013d6 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8013ae:	4d 63 c9             	movslq %r9d,%r9
+  8013b1:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8013b6:	4c 89 d7             	mov    %r10,%rdi
+  8013b9:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  8013c0:	00 00 00 
+  8013c3:	ff d0                	call   *%rax
+	return 0;
+  8013c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ce:	c9                   	leave
+  8013cf:	c3                   	ret
+		return -1;
+  8013d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013d5:	c3                   	ret
+		return -1;
+  8013d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013db:	eb ed                	jmp    8013ca <itoa+0x82>
+
+00000000008013dd <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8013dd:	55                   	push   %rbp
+  8013de:	48 89 e5             	mov    %rsp,%rbp
+  8013e1:	41 57                	push   %r15
+  8013e3:	41 56                	push   %r14
+  8013e5:	41 55                	push   %r13
+  8013e7:	41 54                	push   %r12
+  8013e9:	53                   	push   %rbx
+  8013ea:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  8013ee:	48 85 ff             	test   %rdi,%rdi
+  8013f1:	74 23                	je     801416 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  8013f3:	48 89 fa             	mov    %rdi,%rdx
+  8013f6:	48 be b9 41 80 00 00 	movabs $0x8041b9,%rsi
+  8013fd:	00 00 00 
+  801400:	bf 01 00 00 00       	mov    $0x1,%edi
+  801405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140a:	48 b9 3e 31 80 00 00 	movabs $0x80313e,%rcx
+  801411:	00 00 00 
+  801414:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801416:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141b:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  801422:	00 00 00 
+  801425:	ff d0                	call   *%rax
+  801427:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  80142a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801430:	49 bd be 02 80 00 00 	movabs $0x8002be,%r13
+  801437:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  80143a:	49 bf 9b 02 80 00 00 	movabs $0x80029b,%r15
+  801441:	00 00 00 
+  801444:	eb 46                	jmp    80148c <readline+0xaf>
+            return NULL;
+  801446:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  80144b:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  80144e:	75 0f                	jne    80145f <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801450:	48 83 c4 08          	add    $0x8,%rsp
+  801454:	5b                   	pop    %rbx
+  801455:	41 5c                	pop    %r12
+  801457:	41 5d                	pop    %r13
+  801459:	41 5e                	pop    %r14
+  80145b:	41 5f                	pop    %r15
+  80145d:	5d                   	pop    %rbp
+  80145e:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  80145f:	89 de                	mov    %ebx,%esi
+  801461:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  801468:	00 00 00 
+  80146b:	48 ba b5 05 80 00 00 	movabs $0x8005b5,%rdx
+  801472:	00 00 00 
+  801475:	ff d2                	call   *%rdx
+            return NULL;
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	eb d2                	jmp    801450 <readline+0x73>
+            if (i) {
+  80147e:	4d 85 e4             	test   %r12,%r12
+  801481:	74 09                	je     80148c <readline+0xaf>
+                if (echo) {
+  801483:	45 85 f6             	test   %r14d,%r14d
+  801486:	75 3f                	jne    8014c7 <readline+0xea>
+                i--;
+  801488:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  80148c:	41 ff d5             	call   *%r13
+  80148f:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801491:	85 c0                	test   %eax,%eax
+  801493:	78 b1                	js     801446 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801495:	83 f8 08             	cmp    $0x8,%eax
+  801498:	74 e4                	je     80147e <readline+0xa1>
+  80149a:	83 f8 7f             	cmp    $0x7f,%eax
+  80149d:	74 df                	je     80147e <readline+0xa1>
+        } else if (c >= ' ') {
+  80149f:	83 f8 1f             	cmp    $0x1f,%eax
+  8014a2:	7e 4d                	jle    8014f1 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8014a4:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8014ab:	77 df                	ja     80148c <readline+0xaf>
+                if (echo) {
+  8014ad:	45 85 f6             	test   %r14d,%r14d
+  8014b0:	75 2f                	jne    8014e1 <readline+0x104>
+                buf[i++] = (char)c;
+  8014b2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8014b9:	00 00 00 
+  8014bc:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8014c0:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8014c5:	eb c5                	jmp    80148c <readline+0xaf>
+                    cputchar('\b');
+  8014c7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8014cc:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8014cf:	bf 20 00 00 00       	mov    $0x20,%edi
+  8014d4:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  8014d7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8014dc:	41 ff d7             	call   *%r15
+  8014df:	eb a7                	jmp    801488 <readline+0xab>
+                    cputchar(c);
+  8014e1:	89 c7                	mov    %eax,%edi
+  8014e3:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8014ea:	00 00 00 
+  8014ed:	ff d0                	call   *%rax
+  8014ef:	eb c1                	jmp    8014b2 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  8014f1:	83 f8 0a             	cmp    $0xa,%eax
+  8014f4:	74 05                	je     8014fb <readline+0x11e>
+  8014f6:	83 f8 0d             	cmp    $0xd,%eax
+  8014f9:	75 91                	jne    80148c <readline+0xaf>
+            if (echo) {
+  8014fb:	45 85 f6             	test   %r14d,%r14d
+  8014fe:	75 14                	jne    801514 <readline+0x137>
+            buf[i] = 0;
+  801500:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801507:	00 00 00 
+  80150a:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  80150f:	e9 3c ff ff ff       	jmp    801450 <readline+0x73>
+                cputchar('\n');
+  801514:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801519:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801520:	00 00 00 
+  801523:	ff d0                	call   *%rax
+  801525:	eb d9                	jmp    801500 <readline+0x123>
+
+0000000000801527 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801527:	55                   	push   %rbp
+  801528:	48 89 e5             	mov    %rsp,%rbp
+  80152b:	53                   	push   %rbx
+  80152c:	48 89 fa             	mov    %rdi,%rdx
+  80152f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801532:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801537:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801541:	be 00 00 00 00       	mov    $0x0,%esi
+  801546:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80154e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801552:	c9                   	leave
+  801553:	c3                   	ret
+
+0000000000801554 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801554:	55                   	push   %rbp
+  801555:	48 89 e5             	mov    %rsp,%rbp
+  801558:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801559:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80155e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801563:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801572:	be 00 00 00 00       	mov    $0x0,%esi
+  801577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80157f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801583:	c9                   	leave
+  801584:	c3                   	ret
+
+0000000000801585 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801585:	55                   	push   %rbp
+  801586:	48 89 e5             	mov    %rsp,%rbp
+  801589:	53                   	push   %rbx
+  80158a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80158e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801591:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801596:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b2:	48 85 c0             	test   %rax,%rax
+  8015b5:	7f 06                	jg     8015bd <sys_env_destroy+0x38>
+}
+  8015b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015bd:	49 89 c0             	mov    %rax,%r8
+  8015c0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8015c5:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  8015cc:	00 00 00 
+  8015cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d4:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  8015db:	00 00 00 
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e3:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8015ea:	00 00 00 
+  8015ed:	41 ff d1             	call   *%r9
+
+00000000008015f0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <sys_yield>:
+
+void
+sys_yield(void) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801626:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80162b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801630:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163f:	be 00 00 00 00       	mov    $0x0,%esi
+  801644:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80164c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+
+0000000000801652 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	53                   	push   %rbx
+  801657:	48 89 fa             	mov    %rdi,%rdx
+  80165a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801669:	00 00 00 
+  80166c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801671:	be 00 00 00 00       	mov    $0x0,%esi
+  801676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+
+0000000000801684 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+  801688:	53                   	push   %rbx
+  801689:	49 89 f8             	mov    %rdi,%r8
+  80168c:	48 89 d3             	mov    %rdx,%rbx
+  80168f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801692:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801697:	4c 89 c2             	mov    %r8,%rdx
+  80169a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169d:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8016aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ae:	c9                   	leave
+  8016af:	c3                   	ret
+
+00000000008016b0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b9:	89 f8                	mov    %edi,%eax
+  8016bb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8016be:	48 63 f9             	movslq %ecx,%rdi
+  8016c1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d9:	48 85 c0             	test   %rax,%rax
+  8016dc:	7f 06                	jg     8016e4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e2:	c9                   	leave
+  8016e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e4:	49 89 c0             	mov    %rax,%r8
+  8016e7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016ec:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  8016f3:	00 00 00 
+  8016f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fb:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  801702:	00 00 00 
+  801705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170a:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801711:	00 00 00 
+  801714:	41 ff d1             	call   *%r9
+
+0000000000801717 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+  80171b:	53                   	push   %rbx
+  80171c:	48 83 ec 08          	sub    $0x8,%rsp
+  801720:	89 f8                	mov    %edi,%eax
+  801722:	49 89 f2             	mov    %rsi,%r10
+  801725:	48 89 cf             	mov    %rcx,%rdi
+  801728:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80172b:	48 63 da             	movslq %edx,%rbx
+  80172e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801731:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801736:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801739:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80173c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173e:	48 85 c0             	test   %rax,%rax
+  801741:	7f 06                	jg     801749 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801743:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801749:	49 89 c0             	mov    %rax,%r8
+  80174c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801751:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  801758:	00 00 00 
+  80175b:	be 26 00 00 00       	mov    $0x26,%esi
+  801760:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  801767:	00 00 00 
+  80176a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176f:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801776:	00 00 00 
+  801779:	41 ff d1             	call   *%r9
+
+000000000080177c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80177c:	55                   	push   %rbp
+  80177d:	48 89 e5             	mov    %rsp,%rbp
+  801780:	53                   	push   %rbx
+  801781:	48 83 ec 08          	sub    $0x8,%rsp
+  801785:	48 89 f1             	mov    %rsi,%rcx
+  801788:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80178b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80178e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801793:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801798:	be 00 00 00 00       	mov    $0x0,%esi
+  80179d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a5:	48 85 c0             	test   %rax,%rax
+  8017a8:	7f 06                	jg     8017b0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b0:	49 89 c0             	mov    %rax,%r8
+  8017b3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8017b8:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  8017bf:	00 00 00 
+  8017c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c7:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  8017ce:	00 00 00 
+  8017d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d6:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8017dd:	00 00 00 
+  8017e0:	41 ff d1             	call   *%r9
+
+00000000008017e3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017e3:	55                   	push   %rbp
+  8017e4:	48 89 e5             	mov    %rsp,%rbp
+  8017e7:	53                   	push   %rbx
+  8017e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017ec:	48 63 ce             	movslq %esi,%rcx
+  8017ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801801:	be 00 00 00 00       	mov    $0x0,%esi
+  801806:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80180c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180e:	48 85 c0             	test   %rax,%rax
+  801811:	7f 06                	jg     801819 <sys_env_set_status+0x36>
+}
+  801813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801819:	49 89 c0             	mov    %rax,%r8
+  80181c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801821:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  801828:	00 00 00 
+  80182b:	be 26 00 00 00       	mov    $0x26,%esi
+  801830:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  801837:	00 00 00 
+  80183a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183f:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801846:	00 00 00 
+  801849:	41 ff d1             	call   *%r9
+
+000000000080184c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 08          	sub    $0x8,%rsp
+  801855:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801858:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80185b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801860:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801865:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186a:	be 00 00 00 00       	mov    $0x0,%esi
+  80186f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801875:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801877:	48 85 c0             	test   %rax,%rax
+  80187a:	7f 06                	jg     801882 <sys_env_set_trapframe+0x36>
+}
+  80187c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801882:	49 89 c0             	mov    %rax,%r8
+  801885:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80188a:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  801891:	00 00 00 
+  801894:	be 26 00 00 00       	mov    $0x26,%esi
+  801899:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  8018a0:	00 00 00 
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8018af:	00 00 00 
+  8018b2:	41 ff d1             	call   *%r9
+
+00000000008018b5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018b5:	55                   	push   %rbp
+  8018b6:	48 89 e5             	mov    %rsp,%rbp
+  8018b9:	53                   	push   %rbx
+  8018ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8018be:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018e0:	48 85 c0             	test   %rax,%rax
+  8018e3:	7f 06                	jg     8018eb <sys_env_set_pgfault_upcall+0x36>
+}
+  8018e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018eb:	49 89 c0             	mov    %rax,%r8
+  8018ee:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018f3:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  8018fa:	00 00 00 
+  8018fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801902:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  801909:	00 00 00 
+  80190c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801911:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  801918:	00 00 00 
+  80191b:	41 ff d1             	call   *%r9
+
+000000000080191e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80191e:	55                   	push   %rbp
+  80191f:	48 89 e5             	mov    %rsp,%rbp
+  801922:	53                   	push   %rbx
+  801923:	89 f8                	mov    %edi,%eax
+  801925:	49 89 f1             	mov    %rsi,%r9
+  801928:	48 89 d3             	mov    %rdx,%rbx
+  80192b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80192e:	49 63 f0             	movslq %r8d,%rsi
+  801931:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801934:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801939:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80193c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801942:	cd 30                	int    $0x30
+}
+  801944:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+000000000080194a <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	53                   	push   %rbx
+  80194f:	48 83 ec 08          	sub    $0x8,%rsp
+  801953:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801956:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801959:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80195e:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801961:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801966:	be 00 00 00 00       	mov    $0x0,%esi
+  80196b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801971:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801973:	48 85 c0             	test   %rax,%rax
+  801976:	7f 06                	jg     80197e <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801978:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80197e:	49 89 c0             	mov    %rax,%r8
+  801981:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801986:	48 ba 98 40 80 00 00 	movabs $0x804098,%rdx
+  80198d:	00 00 00 
+  801990:	be 26 00 00 00       	mov    $0x26,%esi
+  801995:	48 bf b7 40 80 00 00 	movabs $0x8040b7,%rdi
+  80199c:	00 00 00 
+  80199f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a4:	49 b9 65 04 80 00 00 	movabs $0x800465,%r9
+  8019ab:	00 00 00 
+  8019ae:	41 ff d1             	call   *%r9
+
+00000000008019b1 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8019b1:	55                   	push   %rbp
+  8019b2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8019b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ba:	48 b8 4a 19 80 00 00 	movabs $0x80194a,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+}
+  8019c6:	5d                   	pop    %rbp
+  8019c7:	c3                   	ret
+
+00000000008019c8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019c8:	55                   	push   %rbp
+  8019c9:	48 89 e5             	mov    %rsp,%rbp
+  8019cc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f1:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+00000000008019f9 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8019fe:	48 63 ce             	movslq %esi,%rcx
+  801a01:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801a05:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a14:	be 00 00 00 00       	mov    $0x0,%esi
+  801a19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a1f:	cd 30                	int    $0x30
+}
+  801a21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+
+0000000000801a27 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	53                   	push   %rbx
+  801a2c:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801a2f:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a33:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a42:	be 00 00 00 00       	mov    $0x0,%esi
+  801a47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4d:	cd 30                	int    $0x30
+}
+  801a4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a53:	c9                   	leave
+  801a54:	c3                   	ret
+
+0000000000801a55 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801a55:	55                   	push   %rbp
+  801a56:	48 89 e5             	mov    %rsp,%rbp
+  801a59:	53                   	push   %rbx
+  801a5a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801a5d:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a60:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a65:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a78:	cd 30                	int    $0x30
+}
+  801a7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7e:	c9                   	leave
+  801a7f:	c3                   	ret
+
+0000000000801a80 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a80:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a87:	ff ff ff 
+  801a8a:	48 01 f8             	add    %rdi,%rax
+  801a8d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a91:	c3                   	ret
+
+0000000000801a92 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a92:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a99:	ff ff ff 
+  801a9c:	48 01 f8             	add    %rdi,%rax
+  801a9f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801aa3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801aa9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801aad:	c3                   	ret
+
+0000000000801aae <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801aae:	55                   	push   %rbp
+  801aaf:	48 89 e5             	mov    %rsp,%rbp
+  801ab2:	41 57                	push   %r15
+  801ab4:	41 56                	push   %r14
+  801ab6:	41 55                	push   %r13
+  801ab8:	41 54                	push   %r12
+  801aba:	53                   	push   %rbx
+  801abb:	48 83 ec 08          	sub    $0x8,%rsp
+  801abf:	49 89 ff             	mov    %rdi,%r15
+  801ac2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ac7:	49 bd 71 37 80 00 00 	movabs $0x803771,%r13
+  801ace:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ad1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ad7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ada:	48 89 df             	mov    %rbx,%rdi
+  801add:	41 ff d5             	call   *%r13
+  801ae0:	83 e0 04             	and    $0x4,%eax
+  801ae3:	74 17                	je     801afc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ae5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aec:	4c 39 f3             	cmp    %r14,%rbx
+  801aef:	75 e6                	jne    801ad7 <fd_alloc+0x29>
+  801af1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801af7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801afc:	4d 89 27             	mov    %r12,(%r15)
+}
+  801aff:	48 83 c4 08          	add    $0x8,%rsp
+  801b03:	5b                   	pop    %rbx
+  801b04:	41 5c                	pop    %r12
+  801b06:	41 5d                	pop    %r13
+  801b08:	41 5e                	pop    %r14
+  801b0a:	41 5f                	pop    %r15
+  801b0c:	5d                   	pop    %rbp
+  801b0d:	c3                   	ret
+
+0000000000801b0e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b0e:	83 ff 1f             	cmp    $0x1f,%edi
+  801b11:	77 39                	ja     801b4c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b13:	55                   	push   %rbp
+  801b14:	48 89 e5             	mov    %rsp,%rbp
+  801b17:	41 54                	push   %r12
+  801b19:	53                   	push   %rbx
+  801b1a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b1d:	48 63 df             	movslq %edi,%rbx
+  801b20:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b27:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b2b:	48 89 df             	mov    %rbx,%rdi
+  801b2e:	48 b8 71 37 80 00 00 	movabs $0x803771,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+  801b3a:	a8 04                	test   $0x4,%al
+  801b3c:	74 14                	je     801b52 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b3e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b47:	5b                   	pop    %rbx
+  801b48:	41 5c                	pop    %r12
+  801b4a:	5d                   	pop    %rbp
+  801b4b:	c3                   	ret
+        return -E_INVAL;
+  801b4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b51:	c3                   	ret
+        return -E_INVAL;
+  801b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b57:	eb ee                	jmp    801b47 <fd_lookup+0x39>
+
+0000000000801b59 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	41 54                	push   %r12
+  801b5f:	53                   	push   %rbx
+  801b60:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b63:	48 b8 80 41 80 00 00 	movabs $0x804180,%rax
+  801b6a:	00 00 00 
+  801b6d:	48 bb a0 50 80 00 00 	movabs $0x8050a0,%rbx
+  801b74:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b77:	39 3b                	cmp    %edi,(%rbx)
+  801b79:	74 47                	je     801bc2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b7b:	48 83 c0 08          	add    $0x8,%rax
+  801b7f:	48 8b 18             	mov    (%rax),%rbx
+  801b82:	48 85 db             	test   %rbx,%rbx
+  801b85:	75 f0                	jne    801b77 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b87:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b8e:	00 00 00 
+  801b91:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b97:	89 fa                	mov    %edi,%edx
+  801b99:	48 bf c8 40 80 00 00 	movabs $0x8040c8,%rdi
+  801ba0:	00 00 00 
+  801ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba8:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  801baf:	00 00 00 
+  801bb2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bb9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bbd:	5b                   	pop    %rbx
+  801bbe:	41 5c                	pop    %r12
+  801bc0:	5d                   	pop    %rbp
+  801bc1:	c3                   	ret
+            return 0;
+  801bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc7:	eb f0                	jmp    801bb9 <dev_lookup+0x60>
+
+0000000000801bc9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bc9:	55                   	push   %rbp
+  801bca:	48 89 e5             	mov    %rsp,%rbp
+  801bcd:	41 55                	push   %r13
+  801bcf:	41 54                	push   %r12
+  801bd1:	53                   	push   %rbx
+  801bd2:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd6:	48 89 fb             	mov    %rdi,%rbx
+  801bd9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bdc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801be3:	ff ff ff 
+  801be6:	48 01 df             	add    %rbx,%rdi
+  801be9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bed:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf1:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+  801bfd:	41 89 c5             	mov    %eax,%r13d
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 06                	js     801c0a <fd_close+0x41>
+  801c04:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c08:	74 1a                	je     801c24 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c0a:	45 84 e4             	test   %r12b,%r12b
+  801c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c12:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c16:	44 89 e8             	mov    %r13d,%eax
+  801c19:	48 83 c4 18          	add    $0x18,%rsp
+  801c1d:	5b                   	pop    %rbx
+  801c1e:	41 5c                	pop    %r12
+  801c20:	41 5d                	pop    %r13
+  801c22:	5d                   	pop    %rbp
+  801c23:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c24:	8b 3b                	mov    (%rbx),%edi
+  801c26:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c2a:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  801c31:	00 00 00 
+  801c34:	ff d0                	call   *%rax
+  801c36:	41 89 c5             	mov    %eax,%r13d
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 1b                	js     801c58 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c41:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801c45:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c4b:	48 85 c0             	test   %rax,%rax
+  801c4e:	74 08                	je     801c58 <fd_close+0x8f>
+  801c50:	48 89 df             	mov    %rbx,%rdi
+  801c53:	ff d0                	call   *%rax
+  801c55:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c5d:	48 89 de             	mov    %rbx,%rsi
+  801c60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c65:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+    return res;
+  801c71:	eb a3                	jmp    801c16 <fd_close+0x4d>
+
+0000000000801c73 <close>:
+
+int
+close(int fdnum) {
+  801c73:	55                   	push   %rbp
+  801c74:	48 89 e5             	mov    %rsp,%rbp
+  801c77:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c7b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c7f:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 15                	js     801ca4 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c8f:	be 01 00 00 00       	mov    $0x1,%esi
+  801c94:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c98:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+}
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+
+0000000000801ca6 <close_all>:
+
+void
+close_all(void) {
+  801ca6:	55                   	push   %rbp
+  801ca7:	48 89 e5             	mov    %rsp,%rbp
+  801caa:	41 54                	push   %r12
+  801cac:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb2:	49 bc 73 1c 80 00 00 	movabs $0x801c73,%r12
+  801cb9:	00 00 00 
+  801cbc:	89 df                	mov    %ebx,%edi
+  801cbe:	41 ff d4             	call   *%r12
+  801cc1:	83 c3 01             	add    $0x1,%ebx
+  801cc4:	83 fb 20             	cmp    $0x20,%ebx
+  801cc7:	75 f3                	jne    801cbc <close_all+0x16>
+}
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5c                	pop    %r12
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+
+0000000000801cce <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	41 57                	push   %r15
+  801cd4:	41 56                	push   %r14
+  801cd6:	41 55                	push   %r13
+  801cd8:	41 54                	push   %r12
+  801cda:	53                   	push   %rbx
+  801cdb:	48 83 ec 18          	sub    $0x18,%rsp
+  801cdf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ce2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ce6:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	89 c3                	mov    %eax,%ebx
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	0f 88 b8 00 00 00    	js     801db4 <dup+0xe6>
+    close(newfdnum);
+  801cfc:	44 89 e7             	mov    %r12d,%edi
+  801cff:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d0b:	4d 63 ec             	movslq %r12d,%r13
+  801d0e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d15:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d19:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d1d:	4c 89 ff             	mov    %r15,%rdi
+  801d20:	49 be 92 1a 80 00 00 	movabs $0x801a92,%r14
+  801d27:	00 00 00 
+  801d2a:	41 ff d6             	call   *%r14
+  801d2d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d30:	4c 89 ef             	mov    %r13,%rdi
+  801d33:	41 ff d6             	call   *%r14
+  801d36:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d39:	48 89 df             	mov    %rbx,%rdi
+  801d3c:	48 b8 71 37 80 00 00 	movabs $0x803771,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d48:	a8 04                	test   $0x4,%al
+  801d4a:	74 2b                	je     801d77 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d4c:	41 89 c1             	mov    %eax,%r9d
+  801d4f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d55:	4c 89 f1             	mov    %r14,%rcx
+  801d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5d:	48 89 de             	mov    %rbx,%rsi
+  801d60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d65:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+  801d71:	89 c3                	mov    %eax,%ebx
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 4e                	js     801dc5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d77:	4c 89 ff             	mov    %r15,%rdi
+  801d7a:	48 b8 71 37 80 00 00 	movabs $0x803771,%rax
+  801d81:	00 00 00 
+  801d84:	ff d0                	call   *%rax
+  801d86:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d89:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d8f:	4c 89 e9             	mov    %r13,%rcx
+  801d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d97:	4c 89 fe             	mov    %r15,%rsi
+  801d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9f:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	78 14                	js     801dc5 <dup+0xf7>
+
+    return newfdnum;
+  801db1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801db4:	89 d8                	mov    %ebx,%eax
+  801db6:	48 83 c4 18          	add    $0x18,%rsp
+  801dba:	5b                   	pop    %rbx
+  801dbb:	41 5c                	pop    %r12
+  801dbd:	41 5d                	pop    %r13
+  801dbf:	41 5e                	pop    %r14
+  801dc1:	41 5f                	pop    %r15
+  801dc3:	5d                   	pop    %rbp
+  801dc4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dca:	4c 89 ee             	mov    %r13,%rsi
+  801dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd2:	49 bc 7c 17 80 00 00 	movabs $0x80177c,%r12
+  801dd9:	00 00 00 
+  801ddc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ddf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801de4:	4c 89 f6             	mov    %r14,%rsi
+  801de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dec:	41 ff d4             	call   *%r12
+    return res;
+  801def:	eb c3                	jmp    801db4 <dup+0xe6>
+
+0000000000801df1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+  801df5:	41 56                	push   %r14
+  801df7:	41 55                	push   %r13
+  801df9:	41 54                	push   %r12
+  801dfb:	53                   	push   %rbx
+  801dfc:	48 83 ec 10          	sub    $0x10,%rsp
+  801e00:	89 fb                	mov    %edi,%ebx
+  801e02:	49 89 f4             	mov    %rsi,%r12
+  801e05:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e08:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e0c:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  801e13:	00 00 00 
+  801e16:	ff d0                	call   *%rax
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 4c                	js     801e68 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e20:	41 8b 3e             	mov    (%r14),%edi
+  801e23:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e27:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	78 35                	js     801e6c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e37:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e3b:	83 e0 03             	and    $0x3,%eax
+  801e3e:	83 f8 01             	cmp    $0x1,%eax
+  801e41:	74 2d                	je     801e70 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e47:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e4b:	48 85 c0             	test   %rax,%rax
+  801e4e:	74 56                	je     801ea6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e50:	4c 89 ea             	mov    %r13,%rdx
+  801e53:	4c 89 e6             	mov    %r12,%rsi
+  801e56:	4c 89 f7             	mov    %r14,%rdi
+  801e59:	ff d0                	call   *%rax
+}
+  801e5b:	48 83 c4 10          	add    $0x10,%rsp
+  801e5f:	5b                   	pop    %rbx
+  801e60:	41 5c                	pop    %r12
+  801e62:	41 5d                	pop    %r13
+  801e64:	41 5e                	pop    %r14
+  801e66:	5d                   	pop    %rbp
+  801e67:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e68:	48 98                	cltq
+  801e6a:	eb ef                	jmp    801e5b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e6c:	48 98                	cltq
+  801e6e:	eb eb                	jmp    801e5b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e70:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e77:	00 00 00 
+  801e7a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e80:	89 da                	mov    %ebx,%edx
+  801e82:	48 bf 29 41 80 00 00 	movabs $0x804129,%rdi
+  801e89:	00 00 00 
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  801e98:	00 00 00 
+  801e9b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e9d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ea4:	eb b5                	jmp    801e5b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ea6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ead:	eb ac                	jmp    801e5b <read+0x6a>
+
+0000000000801eaf <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	41 56                	push   %r14
+  801eb5:	41 55                	push   %r13
+  801eb7:	41 54                	push   %r12
+  801eb9:	53                   	push   %rbx
+  801eba:	48 83 ec 10          	sub    $0x10,%rsp
+  801ebe:	89 fb                	mov    %edi,%ebx
+  801ec0:	49 89 f4             	mov    %rsi,%r12
+  801ec3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eca:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  801ed1:	00 00 00 
+  801ed4:	ff d0                	call   *%rax
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 41                	js     801f1b <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eda:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ede:	41 8b 3e             	mov    (%r14),%edi
+  801ee1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee5:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 35                	js     801f2a <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ef5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ef9:	83 e0 03             	and    $0x3,%eax
+  801efc:	83 f8 01             	cmp    $0x1,%eax
+  801eff:	74 2d                	je     801f2e <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f05:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f09:	48 85 c0             	test   %rax,%rax
+  801f0c:	74 56                	je     801f64 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801f0e:	4c 89 ea             	mov    %r13,%rdx
+  801f11:	4c 89 e6             	mov    %r12,%rsi
+  801f14:	4c 89 f7             	mov    %r14,%rdi
+  801f17:	ff d0                	call   *%rax
+  801f19:	eb 02                	jmp    801f1d <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1b:	48 98                	cltq
+}
+  801f1d:	48 83 c4 10          	add    $0x10,%rsp
+  801f21:	5b                   	pop    %rbx
+  801f22:	41 5c                	pop    %r12
+  801f24:	41 5d                	pop    %r13
+  801f26:	41 5e                	pop    %r14
+  801f28:	5d                   	pop    %rbp
+  801f29:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f2a:	48 98                	cltq
+  801f2c:	eb ef                	jmp    801f1d <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f2e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f35:	00 00 00 
+  801f38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f3e:	89 da                	mov    %ebx,%edx
+  801f40:	48 bf e8 40 80 00 00 	movabs $0x8040e8,%rdi
+  801f47:	00 00 00 
+  801f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4f:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  801f56:	00 00 00 
+  801f59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f5b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f62:	eb b9                	jmp    801f1d <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f64:	4c 89 ea             	mov    %r13,%rdx
+  801f67:	4c 89 e6             	mov    %r12,%rsi
+  801f6a:	89 df                	mov    %ebx,%edi
+  801f6c:	48 b8 f1 1d 80 00 00 	movabs $0x801df1,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	eb a3                	jmp    801f1d <readmap+0x6e>
+
+0000000000801f7a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	41 57                	push   %r15
+  801f80:	41 56                	push   %r14
+  801f82:	41 55                	push   %r13
+  801f84:	41 54                	push   %r12
+  801f86:	53                   	push   %rbx
+  801f87:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f8b:	48 85 d2             	test   %rdx,%rdx
+  801f8e:	74 54                	je     801fe4 <readn+0x6a>
+  801f90:	41 89 fd             	mov    %edi,%r13d
+  801f93:	49 89 f6             	mov    %rsi,%r14
+  801f96:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f9e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fa3:	49 bf f1 1d 80 00 00 	movabs $0x801df1,%r15
+  801faa:	00 00 00 
+  801fad:	4c 89 e2             	mov    %r12,%rdx
+  801fb0:	48 29 f2             	sub    %rsi,%rdx
+  801fb3:	4c 01 f6             	add    %r14,%rsi
+  801fb6:	44 89 ef             	mov    %r13d,%edi
+  801fb9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	78 20                	js     801fe0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fc0:	01 c3                	add    %eax,%ebx
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	74 08                	je     801fce <readn+0x54>
+  801fc6:	48 63 f3             	movslq %ebx,%rsi
+  801fc9:	4c 39 e6             	cmp    %r12,%rsi
+  801fcc:	72 df                	jb     801fad <readn+0x33>
+    }
+    return res;
+  801fce:	48 63 c3             	movslq %ebx,%rax
+}
+  801fd1:	48 83 c4 08          	add    $0x8,%rsp
+  801fd5:	5b                   	pop    %rbx
+  801fd6:	41 5c                	pop    %r12
+  801fd8:	41 5d                	pop    %r13
+  801fda:	41 5e                	pop    %r14
+  801fdc:	41 5f                	pop    %r15
+  801fde:	5d                   	pop    %rbp
+  801fdf:	c3                   	ret
+        if (inc < 0) return inc;
+  801fe0:	48 98                	cltq
+  801fe2:	eb ed                	jmp    801fd1 <readn+0x57>
+    int inc = 1, res = 0;
+  801fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe9:	eb e3                	jmp    801fce <readn+0x54>
+
+0000000000801feb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801feb:	55                   	push   %rbp
+  801fec:	48 89 e5             	mov    %rsp,%rbp
+  801fef:	41 56                	push   %r14
+  801ff1:	41 55                	push   %r13
+  801ff3:	41 54                	push   %r12
+  801ff5:	53                   	push   %rbx
+  801ff6:	48 83 ec 10          	sub    $0x10,%rsp
+  801ffa:	89 fb                	mov    %edi,%ebx
+  801ffc:	49 89 f4             	mov    %rsi,%r12
+  801fff:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802002:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802006:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+  802012:	85 c0                	test   %eax,%eax
+  802014:	78 47                	js     80205d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802016:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80201a:	41 8b 3e             	mov    (%r14),%edi
+  80201d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802021:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 30                	js     802061 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802031:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802036:	74 2d                	je     802065 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802038:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80203c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802040:	48 85 c0             	test   %rax,%rax
+  802043:	74 56                	je     80209b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802045:	4c 89 ea             	mov    %r13,%rdx
+  802048:	4c 89 e6             	mov    %r12,%rsi
+  80204b:	4c 89 f7             	mov    %r14,%rdi
+  80204e:	ff d0                	call   *%rax
+}
+  802050:	48 83 c4 10          	add    $0x10,%rsp
+  802054:	5b                   	pop    %rbx
+  802055:	41 5c                	pop    %r12
+  802057:	41 5d                	pop    %r13
+  802059:	41 5e                	pop    %r14
+  80205b:	5d                   	pop    %rbp
+  80205c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80205d:	48 98                	cltq
+  80205f:	eb ef                	jmp    802050 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802061:	48 98                	cltq
+  802063:	eb eb                	jmp    802050 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802065:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80206c:	00 00 00 
+  80206f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802075:	89 da                	mov    %ebx,%edx
+  802077:	48 bf 45 41 80 00 00 	movabs $0x804145,%rdi
+  80207e:	00 00 00 
+  802081:	b8 00 00 00 00       	mov    $0x0,%eax
+  802086:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  80208d:	00 00 00 
+  802090:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802092:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802099:	eb b5                	jmp    802050 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80209b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020a2:	eb ac                	jmp    802050 <write+0x65>
+
+00000000008020a4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020a4:	55                   	push   %rbp
+  8020a5:	48 89 e5             	mov    %rsp,%rbp
+  8020a8:	53                   	push   %rbx
+  8020a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8020ad:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020af:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020b3:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	78 0c                	js     8020cf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020c7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+00000000008020d5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020d5:	55                   	push   %rbp
+  8020d6:	48 89 e5             	mov    %rsp,%rbp
+  8020d9:	41 55                	push   %r13
+  8020db:	41 54                	push   %r12
+  8020dd:	53                   	push   %rbx
+  8020de:	48 83 ec 18          	sub    $0x18,%rsp
+  8020e2:	89 fb                	mov    %edi,%ebx
+  8020e4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020e7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020eb:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  8020f2:	00 00 00 
+  8020f5:	ff d0                	call   *%rax
+  8020f7:	85 c0                	test   %eax,%eax
+  8020f9:	78 38                	js     802133 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020fb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020ff:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802103:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802107:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 1c                	js     802133 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802117:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80211c:	74 20                	je     80213e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80211e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802122:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802126:	48 85 c0             	test   %rax,%rax
+  802129:	74 47                	je     802172 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80212b:	44 89 e6             	mov    %r12d,%esi
+  80212e:	4c 89 ef             	mov    %r13,%rdi
+  802131:	ff d0                	call   *%rax
+}
+  802133:	48 83 c4 18          	add    $0x18,%rsp
+  802137:	5b                   	pop    %rbx
+  802138:	41 5c                	pop    %r12
+  80213a:	41 5d                	pop    %r13
+  80213c:	5d                   	pop    %rbp
+  80213d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80213e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802145:	00 00 00 
+  802148:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80214e:	89 da                	mov    %ebx,%edx
+  802150:	48 bf 08 41 80 00 00 	movabs $0x804108,%rdi
+  802157:	00 00 00 
+  80215a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215f:	48 b9 b5 05 80 00 00 	movabs $0x8005b5,%rcx
+  802166:	00 00 00 
+  802169:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80216b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802170:	eb c1                	jmp    802133 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802172:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802177:	eb ba                	jmp    802133 <ftruncate+0x5e>
+
+0000000000802179 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802179:	55                   	push   %rbp
+  80217a:	48 89 e5             	mov    %rsp,%rbp
+  80217d:	41 54                	push   %r12
+  80217f:	53                   	push   %rbx
+  802180:	48 83 ec 10          	sub    $0x10,%rsp
+  802184:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802187:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80218b:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  802192:	00 00 00 
+  802195:	ff d0                	call   *%rax
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 4e                	js     8021e9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80219b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80219f:	41 8b 3c 24          	mov    (%r12),%edi
+  8021a3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021a7:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	85 c0                	test   %eax,%eax
+  8021b5:	78 32                	js     8021e9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021bb:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8021c0:	74 30                	je     8021f2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021c2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021c5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021cc:	00 00 00 
+    stat->st_isdir = 0;
+  8021cf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021d6:	00 00 00 
+    stat->st_dev = dev;
+  8021d9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021e0:	48 89 de             	mov    %rbx,%rsi
+  8021e3:	4c 89 e7             	mov    %r12,%rdi
+  8021e6:	ff 50 30             	call   *0x30(%rax)
+}
+  8021e9:	48 83 c4 10          	add    $0x10,%rsp
+  8021ed:	5b                   	pop    %rbx
+  8021ee:	41 5c                	pop    %r12
+  8021f0:	5d                   	pop    %rbp
+  8021f1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021f2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021f7:	eb f0                	jmp    8021e9 <fstat+0x70>
+
+00000000008021f9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021f9:	55                   	push   %rbp
+  8021fa:	48 89 e5             	mov    %rsp,%rbp
+  8021fd:	41 54                	push   %r12
+  8021ff:	53                   	push   %rbx
+  802200:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802203:	be 00 00 00 00       	mov    $0x0,%esi
+  802208:	48 b8 50 2f 80 00 00 	movabs $0x802f50,%rax
+  80220f:	00 00 00 
+  802212:	ff d0                	call   *%rax
+  802214:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 25                	js     80223f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80221a:	4c 89 e6             	mov    %r12,%rsi
+  80221d:	89 c7                	mov    %eax,%edi
+  80221f:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80222e:	89 df                	mov    %ebx,%edi
+  802230:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+
+    return res;
+  80223c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80223f:	89 d8                	mov    %ebx,%eax
+  802241:	5b                   	pop    %rbx
+  802242:	41 5c                	pop    %r12
+  802244:	5d                   	pop    %rbp
+  802245:	c3                   	ret
+
+0000000000802246 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802246:	55                   	push   %rbp
+  802247:	48 89 e5             	mov    %rsp,%rbp
+  80224a:	41 54                	push   %r12
+  80224c:	53                   	push   %rbx
+  80224d:	48 83 ec 10          	sub    $0x10,%rsp
+  802251:	48 89 fb             	mov    %rdi,%rbx
+  802254:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802257:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80225b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802260:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	78 1f                	js     80228f <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802274:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802278:	48 85 c0             	test   %rax,%rax
+  80227b:	74 1b                	je     802298 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80227d:	4c 89 e6             	mov    %r12,%rsi
+  802280:	48 89 df             	mov    %rbx,%rdi
+  802283:	ff d0                	call   *%rax
+    if (res < 0) {
+  802285:	85 c0                	test   %eax,%eax
+  802287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80228f:	48 83 c4 10          	add    $0x10,%rsp
+  802293:	5b                   	pop    %rbx
+  802294:	41 5c                	pop    %r12
+  802296:	5d                   	pop    %rbp
+  802297:	c3                   	ret
+        return -E_NOT_SUPP;
+  802298:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80229d:	eb f0                	jmp    80228f <create_snapshot+0x49>
+
+000000000080229f <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  80229f:	55                   	push   %rbp
+  8022a0:	48 89 e5             	mov    %rsp,%rbp
+  8022a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ab:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022b0:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	78 1e                	js     8022de <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8022c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c4:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8022c8:	48 85 d2             	test   %rdx,%rdx
+  8022cb:	74 13                	je     8022e0 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8022cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d2:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022db:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022e0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e5:	eb f7                	jmp    8022de <print_snapshot_list+0x3f>
+
+00000000008022e7 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8022e7:	55                   	push   %rbp
+  8022e8:	48 89 e5             	mov    %rsp,%rbp
+  8022eb:	53                   	push   %rbx
+  8022ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f0:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022f7:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022fc:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 1c                	js     802328 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80230c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802310:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802314:	48 85 c0             	test   %rax,%rax
+  802317:	74 15                	je     80232e <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802319:	48 89 df             	mov    %rbx,%rdi
+  80231c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	ba 00 00 00 00       	mov    $0x0,%edx
+  802325:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802328:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80232e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802333:	eb f3                	jmp    802328 <accept_snapshot+0x41>
+
+0000000000802335 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802335:	55                   	push   %rbp
+  802336:	48 89 e5             	mov    %rsp,%rbp
+  802339:	53                   	push   %rbx
+  80233a:	48 83 ec 18          	sub    $0x18,%rsp
+  80233e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802341:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802345:	bf 66 00 00 00       	mov    $0x66,%edi
+  80234a:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 1c                	js     802376 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80235a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80235e:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802362:	48 85 c0             	test   %rax,%rax
+  802365:	74 15                	je     80237c <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802367:	48 89 df             	mov    %rbx,%rdi
+  80236a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802373:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802376:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80237a:	c9                   	leave
+  80237b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80237c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802381:	eb f3                	jmp    802376 <delete_snapshot+0x41>
+
+0000000000802383 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80238b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80238f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802394:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  80239b:	00 00 00 
+  80239e:	ff d0                	call   *%rax
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	78 14                	js     8023b8 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8023a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a8:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8023ac:	48 85 d2             	test   %rdx,%rdx
+  8023af:	74 09                	je     8023ba <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8023b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b6:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8023b8:	c9                   	leave
+  8023b9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023ba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023bf:	eb f7                	jmp    8023b8 <gc_snapshots+0x35>
+
+00000000008023c1 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8023c1:	55                   	push   %rbp
+  8023c2:	48 89 e5             	mov    %rsp,%rbp
+  8023c5:	41 56                	push   %r14
+  8023c7:	41 55                	push   %r13
+  8023c9:	41 54                	push   %r12
+  8023cb:	53                   	push   %rbx
+  8023cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8023d0:	48 89 fb             	mov    %rdi,%rbx
+  8023d3:	49 89 f4             	mov    %rsi,%r12
+  8023d6:	49 89 d5             	mov    %rdx,%r13
+  8023d9:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023e0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023e5:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8023ec:	00 00 00 
+  8023ef:	ff d0                	call   *%rax
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	78 1b                	js     802410 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8023f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023f9:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8023fd:	48 85 c0             	test   %rax,%rax
+  802400:	74 1b                	je     80241d <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802402:	4c 89 f1             	mov    %r14,%rcx
+  802405:	4c 89 ea             	mov    %r13,%rdx
+  802408:	4c 89 e6             	mov    %r12,%rsi
+  80240b:	48 89 df             	mov    %rbx,%rdi
+  80240e:	ff d0                	call   *%rax
+
+    return res;
+}
+  802410:	48 83 c4 10          	add    $0x10,%rsp
+  802414:	5b                   	pop    %rbx
+  802415:	41 5c                	pop    %r12
+  802417:	41 5d                	pop    %r13
+  802419:	41 5e                	pop    %r14
+  80241b:	5d                   	pop    %rbp
+  80241c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80241d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802422:	eb ec                	jmp    802410 <diff_snapshots+0x4f>
+
+0000000000802424 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802424:	55                   	push   %rbp
+  802425:	48 89 e5             	mov    %rsp,%rbp
+  802428:	41 55                	push   %r13
+  80242a:	41 54                	push   %r12
+  80242c:	53                   	push   %rbx
+  80242d:	48 83 ec 18          	sub    $0x18,%rsp
+  802431:	48 89 fb             	mov    %rdi,%rbx
+  802434:	49 89 f4             	mov    %rsi,%r12
+  802437:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80243a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80243e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802443:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 18                	js     80246b <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802453:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802457:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80245b:	48 85 c0             	test   %rax,%rax
+  80245e:	74 16                	je     802476 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802460:	4c 89 ea             	mov    %r13,%rdx
+  802463:	4c 89 e6             	mov    %r12,%rsi
+  802466:	48 89 df             	mov    %rbx,%rdi
+  802469:	ff d0                	call   *%rax
+
+    return res;
+}
+  80246b:	48 83 c4 18          	add    $0x18,%rsp
+  80246f:	5b                   	pop    %rbx
+  802470:	41 5c                	pop    %r12
+  802472:	41 5d                	pop    %r13
+  802474:	5d                   	pop    %rbp
+  802475:	c3                   	ret
+        return -E_NOT_SUPP;
+  802476:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80247b:	eb ee                	jmp    80246b <send_snapshot+0x47>
+
+000000000080247d <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80247d:	55                   	push   %rbp
+  80247e:	48 89 e5             	mov    %rsp,%rbp
+  802481:	53                   	push   %rbx
+  802482:	48 83 ec 18          	sub    $0x18,%rsp
+  802486:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802489:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80248d:	bf 66 00 00 00       	mov    $0x66,%edi
+  802492:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 12                	js     8024b4 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8024a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024a6:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8024aa:	48 85 c0             	test   %rax,%rax
+  8024ad:	74 0b                	je     8024ba <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8024af:	48 89 df             	mov    %rbx,%rdi
+  8024b2:	ff d0                	call   *%rax
+
+    return res;
+}
+  8024b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024b8:	c9                   	leave
+  8024b9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024ba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024bf:	eb f3                	jmp    8024b4 <receive_snapshot+0x37>
+
+00000000008024c1 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8024c1:	55                   	push   %rbp
+  8024c2:	48 89 e5             	mov    %rsp,%rbp
+  8024c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024cd:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024d2:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	78 17                	js     8024f9 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8024e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e6:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8024ed:	48 85 d2             	test   %rdx,%rdx
+  8024f0:	74 09                	je     8024fb <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8024f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f7:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024fb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802500:	eb f7                	jmp    8024f9 <free_space_bytes+0x38>
+
+0000000000802502 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802502:	55                   	push   %rbp
+  802503:	48 89 e5             	mov    %rsp,%rbp
+  802506:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80250a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80250e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802513:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	78 17                	js     80253a <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802523:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802527:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80252e:	48 85 d2             	test   %rdx,%rdx
+  802531:	74 09                	je     80253c <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802533:	b8 00 00 00 00       	mov    $0x0,%eax
+  802538:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80253c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802541:	eb f7                	jmp    80253a <busy_space_bytes+0x38>
+
+0000000000802543 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802543:	55                   	push   %rbp
+  802544:	48 89 e5             	mov    %rsp,%rbp
+  802547:	41 54                	push   %r12
+  802549:	53                   	push   %rbx
+  80254a:	48 83 ec 10          	sub    $0x10,%rsp
+  80254e:	89 fb                	mov    %edi,%ebx
+  802550:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802553:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802557:	bf 66 00 00 00       	mov    $0x66,%edi
+  80255c:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 17                	js     802583 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80256c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802570:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802577:	48 85 c0             	test   %rax,%rax
+  80257a:	74 10                	je     80258c <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80257c:	4c 89 e6             	mov    %r12,%rsi
+  80257f:	89 df                	mov    %ebx,%edi
+  802581:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802583:	48 83 c4 10          	add    $0x10,%rsp
+  802587:	5b                   	pop    %rbx
+  802588:	41 5c                	pop    %r12
+  80258a:	5d                   	pop    %rbp
+  80258b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80258c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802591:	eb f0                	jmp    802583 <snapshots_space+0x40>
+
+0000000000802593 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802593:	55                   	push   %rbp
+  802594:	48 89 e5             	mov    %rsp,%rbp
+  802597:	41 55                	push   %r13
+  802599:	41 54                	push   %r12
+  80259b:	53                   	push   %rbx
+  80259c:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a0:	41 89 fd             	mov    %edi,%r13d
+  8025a3:	48 89 f3             	mov    %rsi,%rbx
+  8025a6:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025a9:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8025b0:	00 00 00 
+  8025b3:	83 38 00             	cmpl   $0x0,(%rax)
+  8025b6:	74 57                	je     80260f <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8025b8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025c3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8025ca:	00 00 00 
+  8025cd:	44 89 ee             	mov    %r13d,%esi
+  8025d0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8025d7:	00 00 00 
+  8025da:	8b 38                	mov    (%rax),%edi
+  8025dc:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8025e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ed:	4c 89 e2             	mov    %r12,%rdx
+  8025f0:	48 89 de             	mov    %rbx,%rsi
+  8025f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025f8:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+}
+  802604:	48 83 c4 08          	add    $0x8,%rsp
+  802608:	5b                   	pop    %rbx
+  802609:	41 5c                	pop    %r12
+  80260b:	41 5d                	pop    %r13
+  80260d:	5d                   	pop    %rbp
+  80260e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80260f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802614:	48 b8 47 3a 80 00 00 	movabs $0x803a47,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802627:	00 00 
+  802629:	eb 8d                	jmp    8025b8 <fsipc_region+0x25>
+
+000000000080262b <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802633:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80263a:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80263b:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80263f:	48 b8 93 25 80 00 00 	movabs $0x802593,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+}
+  80264b:	c9                   	leave
+  80264c:	c3                   	ret
+
+000000000080264d <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80264d:	85 ff                	test   %edi,%edi
+  80264f:	78 6d                	js     8026be <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+  802655:	41 54                	push   %r12
+  802657:	53                   	push   %rbx
+  802658:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80265b:	48 85 f6             	test   %rsi,%rsi
+  80265e:	74 57                	je     8026b7 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802660:	89 f8                	mov    %edi,%eax
+  802662:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802669:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80266b:	be 00 00 00 00       	mov    $0x0,%esi
+  802670:	bf 12 00 00 00       	mov    $0x12,%edi
+  802675:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802681:	85 c0                	test   %eax,%eax
+  802683:	78 2d                	js     8026b2 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802685:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80268c:	00 00 00 
+  80268f:	49 63 14 24          	movslq (%r12),%rdx
+  802693:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80269a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80269f:	48 89 df             	mov    %rbx,%rdi
+  8026a2:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  8026a9:	00 00 00 
+  8026ac:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8026ae:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8026b2:	5b                   	pop    %rbx
+  8026b3:	41 5c                	pop    %r12
+  8026b5:	5d                   	pop    %rbp
+  8026b6:	c3                   	ret
+        return -E_INVAL;
+  8026b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026bc:	eb f4                	jmp    8026b2 <devfile_df_snapshots+0x65>
+  8026be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8026c3:	c3                   	ret
+
+00000000008026c4 <devfile_df_busy>:
+devfile_df_busy() {
+  8026c4:	55                   	push   %rbp
+  8026c5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	bf 11 00 00 00       	mov    $0x11,%edi
+  8026d2:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  8026d9:	00 00 00 
+  8026dc:	ff d0                	call   *%rax
+}
+  8026de:	5d                   	pop    %rbp
+  8026df:	c3                   	ret
+
+00000000008026e0 <devfile_df_free>:
+devfile_df_free() {
+  8026e0:	55                   	push   %rbp
+  8026e1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8026e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026ee:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+}
+  8026fa:	5d                   	pop    %rbp
+  8026fb:	c3                   	ret
+
+00000000008026fc <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8026fc:	55                   	push   %rbp
+  8026fd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802700:	be 00 00 00 00       	mov    $0x0,%esi
+  802705:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80270a:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+}
+  802716:	5d                   	pop    %rbp
+  802717:	c3                   	ret
+
+0000000000802718 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802718:	55                   	push   %rbp
+  802719:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80271c:	be 00 00 00 00       	mov    $0x0,%esi
+  802721:	bf 09 00 00 00       	mov    $0x9,%edi
+  802726:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802732:	85 c0                	test   %eax,%eax
+  802734:	ba 00 00 00 00       	mov    $0x0,%edx
+  802739:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80273c:	5d                   	pop    %rbp
+  80273d:	c3                   	ret
+
+000000000080273e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80273e:	55                   	push   %rbp
+  80273f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802742:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802749:	00 00 00 
+  80274c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80274f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802751:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802754:	be 00 00 00 00       	mov    $0x0,%esi
+  802759:	bf 02 00 00 00       	mov    $0x2,%edi
+  80275e:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802765:	00 00 00 
+  802768:	ff d0                	call   *%rax
+}
+  80276a:	5d                   	pop    %rbp
+  80276b:	c3                   	ret
+
+000000000080276c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802770:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802773:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80277a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80277c:	be 00 00 00 00       	mov    $0x0,%esi
+  802781:	bf 06 00 00 00       	mov    $0x6,%edi
+  802786:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+}
+  802792:	5d                   	pop    %rbp
+  802793:	c3                   	ret
+
+0000000000802794 <devfile_write>:
+    if (!fd || !buf) {
+  802794:	48 85 ff             	test   %rdi,%rdi
+  802797:	0f 84 c1 00 00 00    	je     80285e <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+  8027a1:	41 57                	push   %r15
+  8027a3:	41 56                	push   %r14
+  8027a5:	41 55                	push   %r13
+  8027a7:	41 54                	push   %r12
+  8027a9:	53                   	push   %rbx
+  8027aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ae:	49 89 ff             	mov    %rdi,%r15
+  8027b1:	49 89 f5             	mov    %rsi,%r13
+  8027b4:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8027b7:	48 85 f6             	test   %rsi,%rsi
+  8027ba:	0f 84 95 00 00 00    	je     802855 <devfile_write+0xc1>
+    while (n) {
+  8027c0:	48 85 d2             	test   %rdx,%rdx
+  8027c3:	0f 84 83 00 00 00    	je     80284c <devfile_write+0xb8>
+    int totalWrite = 0;
+  8027c9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027d0:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027d7:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8027da:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8027df:	49 39 dc             	cmp    %rbx,%r12
+  8027e2:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8027e6:	48 89 da             	mov    %rbx,%rdx
+  8027e9:	4c 89 ee             	mov    %r13,%rsi
+  8027ec:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8027f3:	00 00 00 
+  8027f6:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  8027fd:	00 00 00 
+  802800:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802802:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802806:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802809:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80280d:	be 00 00 00 00       	mov    $0x0,%esi
+  802812:	bf 04 00 00 00       	mov    $0x4,%edi
+  802817:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80281e:	00 00 00 
+  802821:	ff d0                	call   *%rax
+        if (write < 0) {
+  802823:	85 c0                	test   %eax,%eax
+  802825:	78 21                	js     802848 <devfile_write+0xb4>
+        buf += write;
+  802827:	48 63 d0             	movslq %eax,%rdx
+  80282a:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80282d:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802830:	49 29 d4             	sub    %rdx,%r12
+  802833:	75 a5                	jne    8027da <devfile_write+0x46>
+    return totalWrite;
+  802835:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802839:	48 83 c4 18          	add    $0x18,%rsp
+  80283d:	5b                   	pop    %rbx
+  80283e:	41 5c                	pop    %r12
+  802840:	41 5d                	pop    %r13
+  802842:	41 5e                	pop    %r14
+  802844:	41 5f                	pop    %r15
+  802846:	5d                   	pop    %rbp
+  802847:	c3                   	ret
+            return write;
+  802848:	48 98                	cltq
+  80284a:	eb ed                	jmp    802839 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80284c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802853:	eb e0                	jmp    802835 <devfile_write+0xa1>
+        return -E_INVAL;
+  802855:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80285c:	eb db                	jmp    802839 <devfile_write+0xa5>
+  80285e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802865:	c3                   	ret
+
+0000000000802866 <devfile_read>:
+    if (!fd || !buf) {
+  802866:	48 85 ff             	test   %rdi,%rdi
+  802869:	0f 84 c0 00 00 00    	je     80292f <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	41 57                	push   %r15
+  802875:	41 56                	push   %r14
+  802877:	41 55                	push   %r13
+  802879:	41 54                	push   %r12
+  80287b:	53                   	push   %rbx
+  80287c:	48 83 ec 18          	sub    $0x18,%rsp
+  802880:	49 89 ff             	mov    %rdi,%r15
+  802883:	49 89 f5             	mov    %rsi,%r13
+  802886:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802889:	48 85 f6             	test   %rsi,%rsi
+  80288c:	0f 84 96 00 00 00    	je     802928 <devfile_read+0xc2>
+    while (n) {
+  802892:	48 85 d2             	test   %rdx,%rdx
+  802895:	0f 84 87 00 00 00    	je     802922 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80289b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8028a2:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028a3:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8028aa:	00 00 00 
+  8028ad:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028b1:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8028b4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028b9:	49 39 c4             	cmp    %rax,%r12
+  8028bc:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8028c0:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8028c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028ce:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  8028d5:	00 00 00 
+  8028d8:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	7e 37                	jle    802915 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8028de:	48 63 d8             	movslq %eax,%rbx
+  8028e1:	48 89 da             	mov    %rbx,%rdx
+  8028e4:	4c 89 f6             	mov    %r14,%rsi
+  8028e7:	4c 89 ef             	mov    %r13,%rdi
+  8028ea:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+        buf += read;
+  8028f6:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8028f9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8028fd:	49 29 dc             	sub    %rbx,%r12
+  802900:	75 ab                	jne    8028ad <devfile_read+0x47>
+  return totalRead;
+  802902:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802906:	48 83 c4 18          	add    $0x18,%rsp
+  80290a:	5b                   	pop    %rbx
+  80290b:	41 5c                	pop    %r12
+  80290d:	41 5d                	pop    %r13
+  80290f:	41 5e                	pop    %r14
+  802911:	41 5f                	pop    %r15
+  802913:	5d                   	pop    %rbp
+  802914:	c3                   	ret
+            return read ? read : totalRead;
+  802915:	48 63 d0             	movslq %eax,%rdx
+  802918:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80291c:	48 0f 45 c2          	cmovne %rdx,%rax
+  802920:	eb e4                	jmp    802906 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802922:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802926:	eb da                	jmp    802902 <devfile_read+0x9c>
+        return E_INVAL;
+  802928:	b8 03 00 00 00       	mov    $0x3,%eax
+  80292d:	eb d7                	jmp    802906 <devfile_read+0xa0>
+  80292f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802934:	c3                   	ret
+
+0000000000802935 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802935:	48 85 ff             	test   %rdi,%rdi
+  802938:	74 5f                	je     802999 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80293a:	55                   	push   %rbp
+  80293b:	48 89 e5             	mov    %rsp,%rbp
+  80293e:	53                   	push   %rbx
+  80293f:	48 83 ec 08          	sub    $0x8,%rsp
+  802943:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802946:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802958:	77 45                	ja     80299f <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80295a:	48 89 de             	mov    %rbx,%rsi
+  80295d:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802964:	00 00 00 
+  802967:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802973:	be 00 00 00 00       	mov    $0x0,%esi
+  802978:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80297d:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802990:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802993:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+        return -E_INVAL;
+  802999:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80299e:	c3                   	ret
+        return -E_INVAL;
+  80299f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a4:	eb ed                	jmp    802993 <devfile_receive_snapshot+0x5e>
+
+00000000008029a6 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	41 55                	push   %r13
+  8029ac:	41 54                	push   %r12
+  8029ae:	53                   	push   %rbx
+  8029af:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b3:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8029b6:	48 85 f6             	test   %rsi,%rsi
+  8029b9:	0f 94 c0             	sete   %al
+  8029bc:	48 85 d2             	test   %rdx,%rdx
+  8029bf:	0f 94 c2             	sete   %dl
+  8029c2:	08 d0                	or     %dl,%al
+  8029c4:	0f 85 ad 00 00 00    	jne    802a77 <devfile_send_snapshot+0xd1>
+  8029ca:	48 89 fb             	mov    %rdi,%rbx
+  8029cd:	49 89 f4             	mov    %rsi,%r12
+  8029d0:	48 85 ff             	test   %rdi,%rdi
+  8029d3:	0f 84 9e 00 00 00    	je     802a77 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8029d9:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  8029e0:	00 00 00 
+  8029e3:	ff d0                	call   *%rax
+  8029e5:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029eb:	0f 87 8d 00 00 00    	ja     802a7e <devfile_send_snapshot+0xd8>
+  8029f1:	4c 89 e7             	mov    %r12,%rdi
+  8029f4:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a06:	77 7d                	ja     802a85 <devfile_send_snapshot+0xdf>
+  802a08:	4c 89 ef             	mov    %r13,%rdi
+  802a0b:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802a12:	00 00 00 
+  802a15:	ff d0                	call   *%rax
+  802a17:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a1d:	77 6d                	ja     802a8c <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802a1f:	48 89 de             	mov    %rbx,%rsi
+  802a22:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a29:	00 00 00 
+  802a2c:	48 bb da 0e 80 00 00 	movabs $0x800eda,%rbx
+  802a33:	00 00 00 
+  802a36:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802a38:	4c 89 e6             	mov    %r12,%rsi
+  802a3b:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802a42:	00 00 00 
+  802a45:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802a47:	4c 89 ee             	mov    %r13,%rsi
+  802a4a:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802a51:	00 00 00 
+  802a54:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802a56:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802a60:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802a67:	00 00 00 
+  802a6a:	ff d0                	call   *%rax
+}
+  802a6c:	48 83 c4 08          	add    $0x8,%rsp
+  802a70:	5b                   	pop    %rbx
+  802a71:	41 5c                	pop    %r12
+  802a73:	41 5d                	pop    %r13
+  802a75:	5d                   	pop    %rbp
+  802a76:	c3                   	ret
+        return -E_INVAL;
+  802a77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a7c:	eb ee                	jmp    802a6c <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802a7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a83:	eb e7                	jmp    802a6c <devfile_send_snapshot+0xc6>
+  802a85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a8a:	eb e0                	jmp    802a6c <devfile_send_snapshot+0xc6>
+  802a8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a91:	eb d9                	jmp    802a6c <devfile_send_snapshot+0xc6>
+
+0000000000802a93 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802a93:	48 85 ff             	test   %rdi,%rdi
+  802a96:	0f 84 41 01 00 00    	je     802bdd <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+  802aa0:	41 57                	push   %r15
+  802aa2:	41 56                	push   %r14
+  802aa4:	41 55                	push   %r13
+  802aa6:	41 54                	push   %r12
+  802aa8:	53                   	push   %rbx
+  802aa9:	48 83 ec 08          	sub    $0x8,%rsp
+  802aad:	49 89 fc             	mov    %rdi,%r12
+  802ab0:	49 89 f5             	mov    %rsi,%r13
+  802ab3:	48 89 d3             	mov    %rdx,%rbx
+  802ab6:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802ab9:	48 85 f6             	test   %rsi,%rsi
+  802abc:	0f 84 ff 00 00 00    	je     802bc1 <devfile_diff_snapshots+0x12e>
+  802ac2:	48 85 d2             	test   %rdx,%rdx
+  802ac5:	0f 84 fd 00 00 00    	je     802bc8 <devfile_diff_snapshots+0x135>
+  802acb:	48 85 c9             	test   %rcx,%rcx
+  802ace:	0f 84 f4 00 00 00    	je     802bc8 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802ad4:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ae6:	0f 87 e3 00 00 00    	ja     802bcf <devfile_diff_snapshots+0x13c>
+  802aec:	4c 89 ef             	mov    %r13,%rdi
+  802aef:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+  802afb:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b01:	0f 87 cf 00 00 00    	ja     802bd6 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802b07:	4c 89 e6             	mov    %r12,%rsi
+  802b0a:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802b11:	00 00 00 
+  802b14:	4c 89 e7             	mov    %r12,%rdi
+  802b17:	49 bf da 0e 80 00 00 	movabs $0x800eda,%r15
+  802b1e:	00 00 00 
+  802b21:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802b24:	4c 89 ee             	mov    %r13,%rsi
+  802b27:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802b2e:	00 
+  802b2f:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802b32:	48 8b 03             	mov    (%rbx),%rax
+  802b35:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802b3c:	00 
+  802b3d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802b41:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802b48:	00 
+  802b49:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802b4d:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802b54:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802b55:	be 00 00 00 00       	mov    $0x0,%esi
+  802b5a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802b5f:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b6b:	85 c0                	test   %eax,%eax
+  802b6d:	78 43                	js     802bb2 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802b6f:	49 8b 04 24          	mov    (%r12),%rax
+  802b73:	48 89 03             	mov    %rax,(%rbx)
+  802b76:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802b7b:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802b7f:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802b84:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802b88:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802b8d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802b91:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802b95:	48 c1 e2 03          	shl    $0x3,%rdx
+  802b99:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802b9e:	4c 89 f7             	mov    %r14,%rdi
+  802ba1:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802bad:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802bb2:	48 83 c4 08          	add    $0x8,%rsp
+  802bb6:	5b                   	pop    %rbx
+  802bb7:	41 5c                	pop    %r12
+  802bb9:	41 5d                	pop    %r13
+  802bbb:	41 5e                	pop    %r14
+  802bbd:	41 5f                	pop    %r15
+  802bbf:	5d                   	pop    %rbp
+  802bc0:	c3                   	ret
+        return -E_INVAL;
+  802bc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bc6:	eb ea                	jmp    802bb2 <devfile_diff_snapshots+0x11f>
+  802bc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bcd:	eb e3                	jmp    802bb2 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802bcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd4:	eb dc                	jmp    802bb2 <devfile_diff_snapshots+0x11f>
+  802bd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bdb:	eb d5                	jmp    802bb2 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802bdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802be2:	c3                   	ret
+
+0000000000802be3 <devfile_delete_snapshot>:
+    if (!name) {
+  802be3:	48 85 ff             	test   %rdi,%rdi
+  802be6:	74 5f                	je     802c47 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802be8:	55                   	push   %rbp
+  802be9:	48 89 e5             	mov    %rsp,%rbp
+  802bec:	53                   	push   %rbx
+  802bed:	48 83 ec 08          	sub    $0x8,%rsp
+  802bf1:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802bf4:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+  802c00:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c06:	77 45                	ja     802c4d <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802c08:	48 89 de             	mov    %rbx,%rsi
+  802c0b:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c12:	00 00 00 
+  802c15:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802c21:	be 00 00 00 00       	mov    $0x0,%esi
+  802c26:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802c2b:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802c32:	00 00 00 
+  802c35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c37:	85 c0                	test   %eax,%eax
+  802c39:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+        return -E_INVAL;
+  802c47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c4c:	c3                   	ret
+        return -E_INVAL;
+  802c4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c52:	eb ed                	jmp    802c41 <devfile_delete_snapshot+0x5e>
+
+0000000000802c54 <devfile_accept_snapshot>:
+    if (!name) {
+  802c54:	48 85 ff             	test   %rdi,%rdi
+  802c57:	74 5f                	je     802cb8 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802c59:	55                   	push   %rbp
+  802c5a:	48 89 e5             	mov    %rsp,%rbp
+  802c5d:	53                   	push   %rbx
+  802c5e:	48 83 ec 08          	sub    $0x8,%rsp
+  802c62:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802c65:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+  802c71:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c77:	77 45                	ja     802cbe <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802c79:	48 89 de             	mov    %rbx,%rsi
+  802c7c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c83:	00 00 00 
+  802c86:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802c92:	be 00 00 00 00       	mov    $0x0,%esi
+  802c97:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c9c:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802caf:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802cb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+        return -E_INVAL;
+  802cb8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cbd:	c3                   	ret
+        return -E_INVAL;
+  802cbe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cc3:	eb ed                	jmp    802cb2 <devfile_accept_snapshot+0x5e>
+
+0000000000802cc5 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802cc5:	48 85 ff             	test   %rdi,%rdi
+  802cc8:	0f 84 9f 00 00 00    	je     802d6d <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802cce:	55                   	push   %rbp
+  802ccf:	48 89 e5             	mov    %rsp,%rbp
+  802cd2:	41 54                	push   %r12
+  802cd4:	53                   	push   %rbx
+  802cd5:	48 89 fb             	mov    %rdi,%rbx
+  802cd8:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802cdb:	48 85 f6             	test   %rsi,%rsi
+  802cde:	74 78                	je     802d58 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802ce0:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802ce7:	00 00 00 
+  802cea:	ff d0                	call   *%rax
+  802cec:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cf2:	77 6b                	ja     802d5f <devfile_create_snapshot+0x9a>
+  802cf4:	4c 89 e7             	mov    %r12,%rdi
+  802cf7:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802cfe:	00 00 00 
+  802d01:	ff d0                	call   *%rax
+  802d03:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d09:	77 5b                	ja     802d66 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802d0b:	48 89 de             	mov    %rbx,%rsi
+  802d0e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802d15:	00 00 00 
+  802d18:	48 bb da 0e 80 00 00 	movabs $0x800eda,%rbx
+  802d1f:	00 00 00 
+  802d22:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802d24:	4c 89 e6             	mov    %r12,%rsi
+  802d27:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802d2e:	00 00 00 
+  802d31:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802d33:	be 00 00 00 00       	mov    $0x0,%esi
+  802d38:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d3d:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802d44:	00 00 00 
+  802d47:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d49:	85 c0                	test   %eax,%eax
+  802d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d50:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d53:	5b                   	pop    %rbx
+  802d54:	41 5c                	pop    %r12
+  802d56:	5d                   	pop    %rbp
+  802d57:	c3                   	ret
+        return -E_INVAL;
+  802d58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5d:	eb f4                	jmp    802d53 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d64:	eb ed                	jmp    802d53 <devfile_create_snapshot+0x8e>
+  802d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6b:	eb e6                	jmp    802d53 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d72:	c3                   	ret
+
+0000000000802d73 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d73:	55                   	push   %rbp
+  802d74:	48 89 e5             	mov    %rsp,%rbp
+  802d77:	41 54                	push   %r12
+  802d79:	53                   	push   %rbx
+  802d7a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d7d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d80:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d87:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d89:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d93:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d9f:	85 c0                	test   %eax,%eax
+  802da1:	78 3d                	js     802de0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802da3:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802daa:	00 00 00 
+  802dad:	4c 89 e6             	mov    %r12,%rsi
+  802db0:	48 89 df             	mov    %rbx,%rdi
+  802db3:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802dbf:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802dc6:	00 
+  802dc7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802dcd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802dd4:	00 
+  802dd5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de0:	5b                   	pop    %rbx
+  802de1:	41 5c                	pop    %r12
+  802de3:	5d                   	pop    %rbp
+  802de4:	c3                   	ret
+
+0000000000802de5 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802de5:	55                   	push   %rbp
+  802de6:	48 89 e5             	mov    %rsp,%rbp
+  802de9:	41 57                	push   %r15
+  802deb:	41 56                	push   %r14
+  802ded:	41 55                	push   %r13
+  802def:	41 54                	push   %r12
+  802df1:	53                   	push   %rbx
+  802df2:	48 83 ec 38          	sub    $0x38,%rsp
+  802df6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802dfa:	49 89 f5             	mov    %rsi,%r13
+  802dfd:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e00:	48 89 f0             	mov    %rsi,%rax
+  802e03:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e08:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802e0c:	75 4f                	jne    802e5d <devfile_readmap+0x78>
+  802e0e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e12:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e18:	75 1f                	jne    802e39 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802e1a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e1e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e22:	49 be 71 37 80 00 00 	movabs $0x803771,%r14
+  802e29:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e2c:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802e33:	0f 87 9d 00 00 00    	ja     802ed6 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802e39:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e3d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802e41:	4d 85 ff             	test   %r15,%r15
+  802e44:	0f 85 cf 00 00 00    	jne    802f19 <devfile_readmap+0x134>
+  802e4a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802e4e:	48 83 c4 38          	add    $0x38,%rsp
+  802e52:	5b                   	pop    %rbx
+  802e53:	41 5c                	pop    %r12
+  802e55:	41 5d                	pop    %r13
+  802e57:	41 5e                	pop    %r14
+  802e59:	41 5f                	pop    %r15
+  802e5b:	5d                   	pop    %rbp
+  802e5c:	c3                   	ret
+    size_t totalRead = 0;
+  802e5d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802e64:	00 
+  802e65:	eb da                	jmp    802e41 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e67:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e6b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e6e:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802e75:	00 00 00 
+  802e78:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802e7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e7e:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802e82:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e86:	4c 89 ee             	mov    %r13,%rsi
+  802e89:	bf 14 00 00 00       	mov    $0x14,%edi
+  802e8e:	48 b8 93 25 80 00 00 	movabs $0x802593,%rax
+  802e95:	00 00 00 
+  802e98:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802e9a:	85 c0                	test   %eax,%eax
+  802e9c:	7e a3                	jle    802e41 <devfile_readmap+0x5c>
+  802e9e:	48 98                	cltq
+  802ea0:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802ea4:	72 9b                	jb     802e41 <devfile_readmap+0x5c>
+        buf += read;
+  802ea6:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802ea9:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802eac:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802eb0:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802eb7:	75 88                	jne    802e41 <devfile_readmap+0x5c>
+  802eb9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ebd:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ec3:	0f 85 78 ff ff ff    	jne    802e41 <devfile_readmap+0x5c>
+  802ec9:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802ed0:	0f 86 6b ff ff ff    	jbe    802e41 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802ed6:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802edc:	4d 39 e7             	cmp    %r12,%r15
+  802edf:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802ee3:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802eea:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802eee:	0f 84 73 ff ff ff    	je     802e67 <devfile_readmap+0x82>
+  802ef4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ef8:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802efd:	41 ff d6             	call   *%r14
+  802f00:	a8 40                	test   $0x40,%al
+  802f02:	0f 85 39 ff ff ff    	jne    802e41 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802f08:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f0f:	4c 39 e3             	cmp    %r12,%rbx
+  802f12:	72 e4                	jb     802ef8 <devfile_readmap+0x113>
+  802f14:	e9 4e ff ff ff       	jmp    802e67 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802f19:	4c 89 fa             	mov    %r15,%rdx
+  802f1c:	4c 89 ee             	mov    %r13,%rsi
+  802f1f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f23:	48 b8 66 28 80 00 00 	movabs $0x802866,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802f2f:	48 85 c0             	test   %rax,%rax
+  802f32:	78 0c                	js     802f40 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802f34:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f38:	48 01 f0             	add    %rsi,%rax
+  802f3b:	e9 0e ff ff ff       	jmp    802e4e <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802f40:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f44:	48 85 f6             	test   %rsi,%rsi
+  802f47:	48 0f 45 c6          	cmovne %rsi,%rax
+  802f4b:	e9 fe fe ff ff       	jmp    802e4e <devfile_readmap+0x69>
+
+0000000000802f50 <open>:
+open(const char *path, int mode) {
+  802f50:	55                   	push   %rbp
+  802f51:	48 89 e5             	mov    %rsp,%rbp
+  802f54:	41 55                	push   %r13
+  802f56:	41 54                	push   %r12
+  802f58:	53                   	push   %rbx
+  802f59:	48 83 ec 18          	sub    $0x18,%rsp
+  802f5d:	49 89 fc             	mov    %rdi,%r12
+  802f60:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f63:	48 b8 9c 0e 80 00 00 	movabs $0x800e9c,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f75:	0f 87 8a 00 00 00    	ja     803005 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f7b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f7f:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  802f86:	00 00 00 
+  802f89:	ff d0                	call   *%rax
+  802f8b:	89 c3                	mov    %eax,%ebx
+  802f8d:	85 c0                	test   %eax,%eax
+  802f8f:	78 50                	js     802fe1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f91:	4c 89 e6             	mov    %r12,%rsi
+  802f94:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802f9b:	00 00 00 
+  802f9e:	48 89 df             	mov    %rbx,%rdi
+  802fa1:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  802fa8:	00 00 00 
+  802fab:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802fad:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802fb4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fb8:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fbd:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+  802fc9:	89 c3                	mov    %eax,%ebx
+  802fcb:	85 c0                	test   %eax,%eax
+  802fcd:	78 1f                	js     802fee <open+0x9e>
+    return fd2num(fd);
+  802fcf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fd3:	48 b8 80 1a 80 00 00 	movabs $0x801a80,%rax
+  802fda:	00 00 00 
+  802fdd:	ff d0                	call   *%rax
+  802fdf:	89 c3                	mov    %eax,%ebx
+}
+  802fe1:	89 d8                	mov    %ebx,%eax
+  802fe3:	48 83 c4 18          	add    $0x18,%rsp
+  802fe7:	5b                   	pop    %rbx
+  802fe8:	41 5c                	pop    %r12
+  802fea:	41 5d                	pop    %r13
+  802fec:	5d                   	pop    %rbp
+  802fed:	c3                   	ret
+        fd_close(fd, 0);
+  802fee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ff7:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  802ffe:	00 00 00 
+  803001:	ff d0                	call   *%rax
+        return res;
+  803003:	eb dc                	jmp    802fe1 <open+0x91>
+        return -E_BAD_PATH;
+  803005:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80300a:	eb d5                	jmp    802fe1 <open+0x91>
+
+000000000080300c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80300c:	55                   	push   %rbp
+  80300d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803010:	be 00 00 00 00       	mov    $0x0,%esi
+  803015:	bf 13 00 00 00       	mov    $0x13,%edi
+  80301a:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  803021:	00 00 00 
+  803024:	ff d0                	call   *%rax
+}
+  803026:	5d                   	pop    %rbp
+  803027:	c3                   	ret
+
+0000000000803028 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803028:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80302c:	7f 01                	jg     80302f <writebuf+0x7>
+  80302e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80302f:	55                   	push   %rbp
+  803030:	48 89 e5             	mov    %rsp,%rbp
+  803033:	53                   	push   %rbx
+  803034:	48 83 ec 08          	sub    $0x8,%rsp
+  803038:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80303b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80303f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803043:	8b 3f                	mov    (%rdi),%edi
+  803045:	48 b8 eb 1f 80 00 00 	movabs $0x801feb,%rax
+  80304c:	00 00 00 
+  80304f:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803051:	48 85 c0             	test   %rax,%rax
+  803054:	7e 04                	jle    80305a <writebuf+0x32>
+  803056:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80305a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80305e:	48 39 c2             	cmp    %rax,%rdx
+  803061:	74 0f                	je     803072 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803063:	48 85 c0             	test   %rax,%rax
+  803066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80306b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80306f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803072:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+0000000000803078 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803078:	8b 46 04             	mov    0x4(%rsi),%eax
+  80307b:	8d 50 01             	lea    0x1(%rax),%edx
+  80307e:	89 56 04             	mov    %edx,0x4(%rsi)
+  803081:	48 98                	cltq
+  803083:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803088:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80308e:	74 01                	je     803091 <putch+0x19>
+  803090:	c3                   	ret
+putch(int ch, void *arg) {
+  803091:	55                   	push   %rbp
+  803092:	48 89 e5             	mov    %rsp,%rbp
+  803095:	53                   	push   %rbx
+  803096:	48 83 ec 08          	sub    $0x8,%rsp
+  80309a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80309d:	48 89 f7             	mov    %rsi,%rdi
+  8030a0:	48 b8 28 30 80 00 00 	movabs $0x803028,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8030ac:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8030b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030b7:	c9                   	leave
+  8030b8:	c3                   	ret
+
+00000000008030b9 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8030b9:	55                   	push   %rbp
+  8030ba:	48 89 e5             	mov    %rsp,%rbp
+  8030bd:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030c4:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8030c7:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8030cd:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8030d4:	00 00 00 
+    state.result = 0;
+  8030d7:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8030de:	00 00 00 00 
+    state.error = 1;
+  8030e2:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8030e9:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8030ec:	48 89 f2             	mov    %rsi,%rdx
+  8030ef:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8030f6:	48 bf 78 30 80 00 00 	movabs $0x803078,%rdi
+  8030fd:	00 00 00 
+  803100:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  803107:	00 00 00 
+  80310a:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80310c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803113:	7f 14                	jg     803129 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803115:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80311c:	48 85 c0             	test   %rax,%rax
+  80311f:	75 06                	jne    803127 <vfprintf+0x6e>
+  803121:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803127:	c9                   	leave
+  803128:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803129:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803130:	48 b8 28 30 80 00 00 	movabs $0x803028,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	eb d7                	jmp    803115 <vfprintf+0x5c>
+
+000000000080313e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80313e:	55                   	push   %rbp
+  80313f:	48 89 e5             	mov    %rsp,%rbp
+  803142:	48 83 ec 50          	sub    $0x50,%rsp
+  803146:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80314a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80314e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803152:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803156:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80315d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803161:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803165:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803169:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80316d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803171:	48 b8 b9 30 80 00 00 	movabs $0x8030b9,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+000000000080317f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	48 83 ec 50          	sub    $0x50,%rsp
+  803187:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80318b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80318f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803193:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803197:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80319b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8031a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8031b2:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8031b6:	48 89 fe             	mov    %rdi,%rsi
+  8031b9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031be:	48 b8 b9 30 80 00 00 	movabs $0x8030b9,%rax
+  8031c5:	00 00 00 
+  8031c8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+
+00000000008031cc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8031cc:	55                   	push   %rbp
+  8031cd:	48 89 e5             	mov    %rsp,%rbp
+  8031d0:	41 54                	push   %r12
+  8031d2:	53                   	push   %rbx
+  8031d3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031d6:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  8031dd:	00 00 00 
+  8031e0:	ff d0                	call   *%rax
+  8031e2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8031e5:	48 be a0 41 80 00 00 	movabs $0x8041a0,%rsi
+  8031ec:	00 00 00 
+  8031ef:	48 89 df             	mov    %rbx,%rdi
+  8031f2:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8031fe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803203:	41 2b 04 24          	sub    (%r12),%eax
+  803207:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80320d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803214:	00 00 00 
+    stat->st_dev = &devpipe;
+  803217:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  80321e:	00 00 00 
+  803221:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322d:	5b                   	pop    %rbx
+  80322e:	41 5c                	pop    %r12
+  803230:	5d                   	pop    %rbp
+  803231:	c3                   	ret
+
+0000000000803232 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	41 54                	push   %r12
+  803238:	53                   	push   %rbx
+  803239:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80323c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803241:	48 89 fe             	mov    %rdi,%rsi
+  803244:	bf 00 00 00 00       	mov    $0x0,%edi
+  803249:	49 bc 7c 17 80 00 00 	movabs $0x80177c,%r12
+  803250:	00 00 00 
+  803253:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803256:	48 89 df             	mov    %rbx,%rdi
+  803259:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  803260:	00 00 00 
+  803263:	ff d0                	call   *%rax
+  803265:	48 89 c6             	mov    %rax,%rsi
+  803268:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80326d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803272:	41 ff d4             	call   *%r12
+}
+  803275:	5b                   	pop    %rbx
+  803276:	41 5c                	pop    %r12
+  803278:	5d                   	pop    %rbp
+  803279:	c3                   	ret
+
+000000000080327a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80327a:	55                   	push   %rbp
+  80327b:	48 89 e5             	mov    %rsp,%rbp
+  80327e:	41 57                	push   %r15
+  803280:	41 56                	push   %r14
+  803282:	41 55                	push   %r13
+  803284:	41 54                	push   %r12
+  803286:	53                   	push   %rbx
+  803287:	48 83 ec 18          	sub    $0x18,%rsp
+  80328b:	49 89 fc             	mov    %rdi,%r12
+  80328e:	49 89 f5             	mov    %rsi,%r13
+  803291:	49 89 d7             	mov    %rdx,%r15
+  803294:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803298:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8032a4:	4d 85 ff             	test   %r15,%r15
+  8032a7:	0f 84 af 00 00 00    	je     80335c <devpipe_write+0xe2>
+  8032ad:	48 89 c3             	mov    %rax,%rbx
+  8032b0:	4c 89 f8             	mov    %r15,%rax
+  8032b3:	4d 89 ef             	mov    %r13,%r15
+  8032b6:	4c 01 e8             	add    %r13,%rax
+  8032b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032bd:	49 bd 84 16 80 00 00 	movabs $0x801684,%r13
+  8032c4:	00 00 00 
+            sys_yield();
+  8032c7:	49 be 21 16 80 00 00 	movabs $0x801621,%r14
+  8032ce:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8032d1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8032d4:	48 63 ce             	movslq %esi,%rcx
+  8032d7:	48 63 03             	movslq (%rbx),%rax
+  8032da:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8032e0:	48 39 c1             	cmp    %rax,%rcx
+  8032e3:	72 2e                	jb     803313 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032ea:	48 89 da             	mov    %rbx,%rdx
+  8032ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032f2:	4c 89 e7             	mov    %r12,%rdi
+  8032f5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	74 66                	je     803362 <devpipe_write+0xe8>
+            sys_yield();
+  8032fc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8032ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  803302:	48 63 ce             	movslq %esi,%rcx
+  803305:	48 63 03             	movslq (%rbx),%rax
+  803308:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80330e:	48 39 c1             	cmp    %rax,%rcx
+  803311:	73 d2                	jae    8032e5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803313:	41 0f b6 3f          	movzbl (%r15),%edi
+  803317:	48 89 ca             	mov    %rcx,%rdx
+  80331a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80331e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803325:	08 10 20 
+  803328:	48 f7 e2             	mul    %rdx
+  80332b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80332f:	48 89 d0             	mov    %rdx,%rax
+  803332:	48 c1 e0 09          	shl    $0x9,%rax
+  803336:	48 29 d0             	sub    %rdx,%rax
+  803339:	48 c1 e0 03          	shl    $0x3,%rax
+  80333d:	48 29 c1             	sub    %rax,%rcx
+  803340:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803345:	83 c6 01             	add    $0x1,%esi
+  803348:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80334b:	49 83 c7 01          	add    $0x1,%r15
+  80334f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803353:	49 39 c7             	cmp    %rax,%r15
+  803356:	0f 85 75 ff ff ff    	jne    8032d1 <devpipe_write+0x57>
+    return n;
+  80335c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803360:	eb 05                	jmp    803367 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803362:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803367:	48 83 c4 18          	add    $0x18,%rsp
+  80336b:	5b                   	pop    %rbx
+  80336c:	41 5c                	pop    %r12
+  80336e:	41 5d                	pop    %r13
+  803370:	41 5e                	pop    %r14
+  803372:	41 5f                	pop    %r15
+  803374:	5d                   	pop    %rbp
+  803375:	c3                   	ret
+
+0000000000803376 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803376:	55                   	push   %rbp
+  803377:	48 89 e5             	mov    %rsp,%rbp
+  80337a:	41 57                	push   %r15
+  80337c:	41 56                	push   %r14
+  80337e:	41 55                	push   %r13
+  803380:	41 54                	push   %r12
+  803382:	53                   	push   %rbx
+  803383:	48 83 ec 18          	sub    $0x18,%rsp
+  803387:	49 89 fc             	mov    %rdi,%r12
+  80338a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80338e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803392:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8033a1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033a7:	49 bd 84 16 80 00 00 	movabs $0x801684,%r13
+  8033ae:	00 00 00 
+            sys_yield();
+  8033b1:	49 be 21 16 80 00 00 	movabs $0x801621,%r14
+  8033b8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8033bb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033c0:	74 7d                	je     80343f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8033c2:	8b 03                	mov    (%rbx),%eax
+  8033c4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8033c7:	75 26                	jne    8033ef <devpipe_read+0x79>
+            if (i > 0) return i;
+  8033c9:	4d 85 ff             	test   %r15,%r15
+  8033cc:	75 77                	jne    803445 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033d3:	48 89 da             	mov    %rbx,%rdx
+  8033d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033db:	4c 89 e7             	mov    %r12,%rdi
+  8033de:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	74 72                	je     803457 <devpipe_read+0xe1>
+            sys_yield();
+  8033e5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8033e8:	8b 03                	mov    (%rbx),%eax
+  8033ea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8033ed:	74 df                	je     8033ce <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8033ef:	48 63 c8             	movslq %eax,%rcx
+  8033f2:	48 89 ca             	mov    %rcx,%rdx
+  8033f5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8033f9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803400:	08 10 20 
+  803403:	48 89 d0             	mov    %rdx,%rax
+  803406:	48 f7 e6             	mul    %rsi
+  803409:	48 c1 ea 06          	shr    $0x6,%rdx
+  80340d:	48 89 d0             	mov    %rdx,%rax
+  803410:	48 c1 e0 09          	shl    $0x9,%rax
+  803414:	48 29 d0             	sub    %rdx,%rax
+  803417:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80341e:	00 
+  80341f:	48 89 c8             	mov    %rcx,%rax
+  803422:	48 29 d0             	sub    %rdx,%rax
+  803425:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80342a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80342e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803432:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803435:	49 83 c7 01          	add    $0x1,%r15
+  803439:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80343d:	75 83                	jne    8033c2 <devpipe_read+0x4c>
+    return n;
+  80343f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803443:	eb 03                	jmp    803448 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803445:	4c 89 f8             	mov    %r15,%rax
+}
+  803448:	48 83 c4 18          	add    $0x18,%rsp
+  80344c:	5b                   	pop    %rbx
+  80344d:	41 5c                	pop    %r12
+  80344f:	41 5d                	pop    %r13
+  803451:	41 5e                	pop    %r14
+  803453:	41 5f                	pop    %r15
+  803455:	5d                   	pop    %rbp
+  803456:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345c:	eb ea                	jmp    803448 <devpipe_read+0xd2>
+
+000000000080345e <pipe>:
+pipe(int pfd[2]) {
+  80345e:	55                   	push   %rbp
+  80345f:	48 89 e5             	mov    %rsp,%rbp
+  803462:	41 55                	push   %r13
+  803464:	41 54                	push   %r12
+  803466:	53                   	push   %rbx
+  803467:	48 83 ec 18          	sub    $0x18,%rsp
+  80346b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80346e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803472:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+  80347e:	89 c3                	mov    %eax,%ebx
+  803480:	85 c0                	test   %eax,%eax
+  803482:	0f 88 a0 01 00 00    	js     803628 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803488:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80348d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803492:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349b:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+  8034a7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	0f 88 77 01 00 00    	js     803628 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034b1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8034b5:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  8034bc:	00 00 00 
+  8034bf:	ff d0                	call   *%rax
+  8034c1:	89 c3                	mov    %eax,%ebx
+  8034c3:	85 c0                	test   %eax,%eax
+  8034c5:	0f 88 43 01 00 00    	js     80360e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8034cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8034d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034de:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  8034e5:	00 00 00 
+  8034e8:	ff d0                	call   *%rax
+  8034ea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034ec:	85 c0                	test   %eax,%eax
+  8034ee:	0f 88 1a 01 00 00    	js     80360e <pipe+0x1b0>
+    va = fd2data(fd0);
+  8034f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034f8:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+  803504:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803507:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80350c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803511:	48 89 c6             	mov    %rax,%rsi
+  803514:	bf 00 00 00 00       	mov    $0x0,%edi
+  803519:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+  803525:	89 c3                	mov    %eax,%ebx
+  803527:	85 c0                	test   %eax,%eax
+  803529:	0f 88 c5 00 00 00    	js     8035f4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80352f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803533:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  80353a:	00 00 00 
+  80353d:	ff d0                	call   *%rax
+  80353f:	48 89 c1             	mov    %rax,%rcx
+  803542:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803548:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80354e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803553:	4c 89 ee             	mov    %r13,%rsi
+  803556:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355b:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	89 c3                	mov    %eax,%ebx
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	78 6e                	js     8035db <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80356d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803572:	4c 89 ef             	mov    %r13,%rdi
+  803575:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  80357c:	00 00 00 
+  80357f:	ff d0                	call   *%rax
+  803581:	83 f8 02             	cmp    $0x2,%eax
+  803584:	0f 85 ab 00 00 00    	jne    803635 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80358a:	a1 40 51 80 00 00 00 	movabs 0x805140,%eax
+  803591:	00 00 
+  803593:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803597:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803599:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80359d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8035a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8035a8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8035aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8035b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035b9:	48 bb 80 1a 80 00 00 	movabs $0x801a80,%rbx
+  8035c0:	00 00 00 
+  8035c3:	ff d3                	call   *%rbx
+  8035c5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8035c9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8035cd:	ff d3                	call   *%rbx
+  8035cf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8035d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035d9:	eb 4d                	jmp    803628 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8035db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035e0:	4c 89 ee             	mov    %r13,%rsi
+  8035e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e8:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  8035ef:	00 00 00 
+  8035f2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035f9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8035fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803602:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  803609:	00 00 00 
+  80360c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80360e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803613:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803617:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361c:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  803623:	00 00 00 
+  803626:	ff d0                	call   *%rax
+}
+  803628:	89 d8                	mov    %ebx,%eax
+  80362a:	48 83 c4 18          	add    $0x18,%rsp
+  80362e:	5b                   	pop    %rbx
+  80362f:	41 5c                	pop    %r12
+  803631:	41 5d                	pop    %r13
+  803633:	5d                   	pop    %rbp
+  803634:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803635:	48 b9 d0 41 80 00 00 	movabs $0x8041d0,%rcx
+  80363c:	00 00 00 
+  80363f:	48 ba a7 41 80 00 00 	movabs $0x8041a7,%rdx
+  803646:	00 00 00 
+  803649:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80364e:	48 bf bc 41 80 00 00 	movabs $0x8041bc,%rdi
+  803655:	00 00 00 
+  803658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365d:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  803664:	00 00 00 
+  803667:	41 ff d0             	call   *%r8
+
+000000000080366a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80366a:	55                   	push   %rbp
+  80366b:	48 89 e5             	mov    %rsp,%rbp
+  80366e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803672:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803676:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  80367d:	00 00 00 
+  803680:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803682:	85 c0                	test   %eax,%eax
+  803684:	78 35                	js     8036bb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803686:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80368a:	48 b8 92 1a 80 00 00 	movabs $0x801a92,%rax
+  803691:	00 00 00 
+  803694:	ff d0                	call   *%rax
+  803696:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803699:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80369e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036a7:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+  8036b3:	85 c0                	test   %eax,%eax
+  8036b5:	0f 94 c0             	sete   %al
+  8036b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8036bb:	c9                   	leave
+  8036bc:	c3                   	ret
+
+00000000008036bd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036bd:	48 89 f8             	mov    %rdi,%rax
+  8036c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8036c4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8036cb:	01 00 00 
+  8036ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036d2:	f6 c2 01             	test   $0x1,%dl
+  8036d5:	74 6d                	je     803744 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036d7:	48 89 f8             	mov    %rdi,%rax
+  8036da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036de:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036e5:	01 00 00 
+  8036e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ec:	f6 c2 01             	test   $0x1,%dl
+  8036ef:	74 62                	je     803753 <get_uvpt_entry+0x96>
+  8036f1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036f8:	01 00 00 
+  8036fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ff:	f6 c2 80             	test   $0x80,%dl
+  803702:	75 4f                	jne    803753 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803704:	48 89 f8             	mov    %rdi,%rax
+  803707:	48 c1 e8 15          	shr    $0x15,%rax
+  80370b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803712:	01 00 00 
+  803715:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803719:	f6 c2 01             	test   $0x1,%dl
+  80371c:	74 44                	je     803762 <get_uvpt_entry+0xa5>
+  80371e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803725:	01 00 00 
+  803728:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80372c:	f6 c2 80             	test   $0x80,%dl
+  80372f:	75 31                	jne    803762 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803731:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803735:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80373c:	01 00 00 
+  80373f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803743:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803744:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80374b:	01 00 00 
+  80374e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803752:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803753:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80375a:	01 00 00 
+  80375d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803761:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803762:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803769:	01 00 00 
+  80376c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803770:	c3                   	ret
+
+0000000000803771 <get_prot>:
+
+int
+get_prot(void *va) {
+  803771:	55                   	push   %rbp
+  803772:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803775:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  80377c:	00 00 00 
+  80377f:	ff d0                	call   *%rax
+  803781:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803784:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803789:	89 c1                	mov    %eax,%ecx
+  80378b:	83 c9 04             	or     $0x4,%ecx
+  80378e:	f6 c2 01             	test   $0x1,%dl
+  803791:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803794:	89 c1                	mov    %eax,%ecx
+  803796:	83 c9 02             	or     $0x2,%ecx
+  803799:	f6 c2 02             	test   $0x2,%dl
+  80379c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80379f:	89 c1                	mov    %eax,%ecx
+  8037a1:	83 c9 01             	or     $0x1,%ecx
+  8037a4:	48 85 d2             	test   %rdx,%rdx
+  8037a7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8037aa:	89 c1                	mov    %eax,%ecx
+  8037ac:	83 c9 40             	or     $0x40,%ecx
+  8037af:	f6 c6 04             	test   $0x4,%dh
+  8037b2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8037b5:	5d                   	pop    %rbp
+  8037b6:	c3                   	ret
+
+00000000008037b7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8037b7:	55                   	push   %rbp
+  8037b8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037bb:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  8037c2:	00 00 00 
+  8037c5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8037c7:	48 c1 e8 06          	shr    $0x6,%rax
+  8037cb:	83 e0 01             	and    $0x1,%eax
+}
+  8037ce:	5d                   	pop    %rbp
+  8037cf:	c3                   	ret
+
+00000000008037d0 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8037d0:	55                   	push   %rbp
+  8037d1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037d4:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8037e0:	48 c1 e8 05          	shr    $0x5,%rax
+  8037e4:	83 e0 01             	and    $0x1,%eax
+}
+  8037e7:	5d                   	pop    %rbp
+  8037e8:	c3                   	ret
+
+00000000008037e9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8037e9:	55                   	push   %rbp
+  8037ea:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8037ed:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  8037f4:	00 00 00 
+  8037f7:	ff d0                	call   *%rax
+  8037f9:	83 e0 01             	and    $0x1,%eax
+}
+  8037fc:	5d                   	pop    %rbp
+  8037fd:	c3                   	ret
+
+00000000008037fe <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8037fe:	55                   	push   %rbp
+  8037ff:	48 89 e5             	mov    %rsp,%rbp
+  803802:	41 57                	push   %r15
+  803804:	41 56                	push   %r14
+  803806:	41 55                	push   %r13
+  803808:	41 54                	push   %r12
+  80380a:	53                   	push   %rbx
+  80380b:	48 83 ec 18          	sub    $0x18,%rsp
+  80380f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803813:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803817:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80381c:	49 bd e9 37 80 00 00 	movabs $0x8037e9,%r13
+  803823:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803826:	49 bf 71 37 80 00 00 	movabs $0x803771,%r15
+  80382d:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803830:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803837:	00 00 00 
+  80383a:	eb 0c                	jmp    803848 <foreach_shared_region+0x4a>
+  80383c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803843:	4c 39 f3             	cmp    %r14,%rbx
+  803846:	74 2e                	je     803876 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803848:	48 89 df             	mov    %rbx,%rdi
+  80384b:	41 ff d5             	call   *%r13
+  80384e:	84 c0                	test   %al,%al
+  803850:	74 ea                	je     80383c <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803852:	48 89 df             	mov    %rbx,%rdi
+  803855:	41 ff d7             	call   *%r15
+  803858:	a8 40                	test   $0x40,%al
+  80385a:	74 e0                	je     80383c <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80385c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803867:	48 89 df             	mov    %rbx,%rdi
+  80386a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80386e:	ff d0                	call   *%rax
+				if (res < 0) {
+  803870:	85 c0                	test   %eax,%eax
+  803872:	79 c8                	jns    80383c <foreach_shared_region+0x3e>
+  803874:	eb 05                	jmp    80387b <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803876:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80387b:	48 83 c4 18          	add    $0x18,%rsp
+  80387f:	5b                   	pop    %rbx
+  803880:	41 5c                	pop    %r12
+  803882:	41 5d                	pop    %r13
+  803884:	41 5e                	pop    %r14
+  803886:	41 5f                	pop    %r15
+  803888:	5d                   	pop    %rbp
+  803889:	c3                   	ret
+
+000000000080388a <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80388a:	55                   	push   %rbp
+  80388b:	48 89 e5             	mov    %rsp,%rbp
+  80388e:	41 55                	push   %r13
+  803890:	41 54                	push   %r12
+  803892:	53                   	push   %rbx
+  803893:	48 83 ec 08          	sub    $0x8,%rsp
+  803897:	49 89 fc             	mov    %rdi,%r12
+  80389a:	48 89 f7             	mov    %rsi,%rdi
+  80389d:	48 89 d3             	mov    %rdx,%rbx
+  8038a0:	49 89 cd             	mov    %rcx,%r13
+  8038a3:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8038a6:	48 85 f6             	test   %rsi,%rsi
+  8038a9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038b0:	00 00 00 
+  8038b3:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8038b7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038bc:	48 85 db             	test   %rbx,%rbx
+  8038bf:	74 03                	je     8038c4 <ipc_recv_timed+0x3a>
+  8038c1:	48 8b 33             	mov    (%rbx),%rsi
+  8038c4:	48 b8 4a 19 80 00 00 	movabs $0x80194a,%rax
+  8038cb:	00 00 00 
+  8038ce:	ff d0                	call   *%rax
+    if (res < 0) {
+  8038d0:	85 c0                	test   %eax,%eax
+  8038d2:	78 75                	js     803949 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8038d4:	4d 85 e4             	test   %r12,%r12
+  8038d7:	74 14                	je     8038ed <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8038d9:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038e0:	00 00 00 
+  8038e3:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8038e9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8038ed:	4d 85 ed             	test   %r13,%r13
+  8038f0:	74 14                	je     803906 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8038f2:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038f9:	00 00 00 
+  8038fc:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803902:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803906:	48 85 db             	test   %rbx,%rbx
+  803909:	74 23                	je     80392e <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80390b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803912:	00 00 00 
+  803915:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80391b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803920:	85 c9                	test   %ecx,%ecx
+  803922:	74 07                	je     80392b <ipc_recv_timed+0xa1>
+  803924:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80392b:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80392e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803935:	00 00 00 
+  803938:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80393e:	48 83 c4 08          	add    $0x8,%rsp
+  803942:	5b                   	pop    %rbx
+  803943:	41 5c                	pop    %r12
+  803945:	41 5d                	pop    %r13
+  803947:	5d                   	pop    %rbp
+  803948:	c3                   	ret
+        if (from_env_store != NULL) {
+  803949:	4d 85 e4             	test   %r12,%r12
+  80394c:	74 08                	je     803956 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80394e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803955:	00 
+        if (perm_store != NULL) {
+  803956:	4d 85 ed             	test   %r13,%r13
+  803959:	74 08                	je     803963 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80395b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803962:	00 
+        if (size != NULL) {
+  803963:	48 85 db             	test   %rbx,%rbx
+  803966:	74 d6                	je     80393e <ipc_recv_timed+0xb4>
+            *size = 0;
+  803968:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80396f:	eb cd                	jmp    80393e <ipc_recv_timed+0xb4>
+
+0000000000803971 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803971:	55                   	push   %rbp
+  803972:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803975:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80397b:	48 b8 8a 38 80 00 00 	movabs $0x80388a,%rax
+  803982:	00 00 00 
+  803985:	ff d0                	call   *%rax
+}
+  803987:	5d                   	pop    %rbp
+  803988:	c3                   	ret
+
+0000000000803989 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803989:	55                   	push   %rbp
+  80398a:	48 89 e5             	mov    %rsp,%rbp
+  80398d:	41 57                	push   %r15
+  80398f:	41 56                	push   %r14
+  803991:	41 55                	push   %r13
+  803993:	41 54                	push   %r12
+  803995:	53                   	push   %rbx
+  803996:	48 83 ec 18          	sub    $0x18,%rsp
+  80399a:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80399d:	48 89 d3             	mov    %rdx,%rbx
+  8039a0:	49 89 cc             	mov    %rcx,%r12
+  8039a3:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8039a6:	48 85 d2             	test   %rdx,%rdx
+  8039a9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039b0:	00 00 00 
+  8039b3:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039b7:	89 f0                	mov    %esi,%eax
+  8039b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039bd:	48 89 da             	mov    %rbx,%rdx
+  8039c0:	48 89 c6             	mov    %rax,%rsi
+  8039c3:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+    while (res < 0) {
+  8039cf:	85 c0                	test   %eax,%eax
+  8039d1:	79 65                	jns    803a38 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8039d3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8039d6:	75 33                	jne    803a0b <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8039d8:	49 bf 21 16 80 00 00 	movabs $0x801621,%r15
+  8039df:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039e2:	49 be 1e 19 80 00 00 	movabs $0x80191e,%r14
+  8039e9:	00 00 00 
+        sys_yield();
+  8039ec:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8039ef:	45 89 e8             	mov    %r13d,%r8d
+  8039f2:	4c 89 e1             	mov    %r12,%rcx
+  8039f5:	48 89 da             	mov    %rbx,%rdx
+  8039f8:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8039fc:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8039ff:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	79 32                	jns    803a38 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803a06:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a09:	74 e1                	je     8039ec <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803a0b:	89 c1                	mov    %eax,%ecx
+  803a0d:	48 ba f4 41 80 00 00 	movabs $0x8041f4,%rdx
+  803a14:	00 00 00 
+  803a17:	be 52 00 00 00       	mov    $0x52,%esi
+  803a1c:	48 bf 08 42 80 00 00 	movabs $0x804208,%rdi
+  803a23:	00 00 00 
+  803a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2b:	49 b8 65 04 80 00 00 	movabs $0x800465,%r8
+  803a32:	00 00 00 
+  803a35:	41 ff d0             	call   *%r8
+    }
+}
+  803a38:	48 83 c4 18          	add    $0x18,%rsp
+  803a3c:	5b                   	pop    %rbx
+  803a3d:	41 5c                	pop    %r12
+  803a3f:	41 5d                	pop    %r13
+  803a41:	41 5e                	pop    %r14
+  803a43:	41 5f                	pop    %r15
+  803a45:	5d                   	pop    %rbp
+  803a46:	c3                   	ret
+
+0000000000803a47 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a47:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803a4c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803a53:	00 00 00 
+  803a56:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a5a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a5e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a62:	48 01 ca             	add    %rcx,%rdx
+  803a65:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a6b:	39 fa                	cmp    %edi,%edx
+  803a6d:	74 12                	je     803a81 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a6f:	48 83 c0 01          	add    $0x1,%rax
+  803a73:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a79:	75 db                	jne    803a56 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a80:	c3                   	ret
+            return envs[i].env_id;
+  803a81:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a85:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a89:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a8d:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a94:	00 00 00 
+  803a97:	48 01 d0             	add    %rdx,%rax
+  803a9a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803aa0:	c3                   	ret
+  803aa1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803aa8 <__rodata_start>:
+  803aa8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aa9:	70 65                	jo     803b10 <__rodata_start+0x68>
+  803aab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aac:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  803aaf:	73 3a                	jae    803aeb <__rodata_start+0x43>
+  803ab1:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f53b20 <__bss_end+0x7374ab20>
+  803ab7:	65 72 2f             	gs jb  803ae9 <__rodata_start+0x41>
+  803aba:	74 65                	je     803b21 <__rodata_start+0x79>
+  803abc:	73 74                	jae    803b32 <__rodata_start+0x8a>
+  803abe:	6b 62 64 2e          	imul   $0x2e,0x64(%rdx),%esp
+  803ac2:	63 00                	movsxd (%rax),%eax
+  803ac4:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  803aca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acb:	70 65                	jo     803b32 <__rodata_start+0x8a>
+  803acd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ace:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  803ad1:	73 20                	jae    803af3 <__rodata_start+0x4b>
+  803ad3:	75 73                	jne    803b48 <__rodata_start+0xa0>
+  803ad5:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  803ada:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e43b44 <__bss_end+0x7563ab44>
+  803ae0:	70 3a                	jo     803b1c <__rodata_start+0x74>
+  803ae2:	20 25 69 00 54 79    	and    %ah,0x79540069(%rip)        # 79d43b51 <__bss_end+0x7953ab51>
+  803ae8:	70 65                	jo     803b4f <__rodata_start+0xa7>
+  803aea:	20 61 20             	and    %ah,0x20(%rcx)
+  803aed:	6c                   	insb   (%dx),%es:(%rdi)
+  803aee:	69 6e 65 3a 20 00 25 	imul   $0x2500203a,0x65(%rsi),%ebp
+  803af5:	73 0a                	jae    803b01 <__rodata_start+0x59>
+  803af7:	00 28                	add    %ch,(%rax)
+  803af9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803afb:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803aff:	20 66 69             	and    %ah,0x69(%rsi)
+  803b02:	6c                   	insb   (%dx),%es:(%rdi)
+  803b03:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  803b07:	63 65 69             	movsxd 0x69(%rbp),%esp
+  803b0a:	76 65                	jbe    803b71 <__rodata_start+0xc9>
+  803b0c:	64 29 0a             	sub    %ecx,%fs:(%rdx)
+  803b0f:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  803b12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b14:	73 3e                	jae    803b54 <__rodata_start+0xac>
+  803b16:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1a:	73 00                	jae    803b1c <__rodata_start+0x74>
+  803b1c:	3c 75                	cmp    $0x75,%al
+  803b1e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803b23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b24:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  803b28:	5b                   	pop    %rbx
+  803b29:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803b2e:	20 75 73             	and    %dh,0x73(%rbp)
+  803b31:	65 72 20             	gs jb  803b54 <__rodata_start+0xac>
+  803b34:	70 61                	jo     803b97 <__rodata_start+0xef>
+  803b36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b37:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803b3e:	73 20                	jae    803b60 <__rodata_start+0xb8>
+  803b40:	61                   	(bad)
+  803b41:	74 20                	je     803b63 <__rodata_start+0xbb>
+  803b43:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b48:	3a 20                	cmp    (%rax),%ah
+  803b4a:	00 30                	add    %dh,(%rax)
+  803b4c:	31 32                	xor    %esi,(%rdx)
+  803b4e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b55:	41                   	rex.B
+  803b56:	42                   	rex.X
+  803b57:	43                   	rex.XB
+  803b58:	44                   	rex.R
+  803b59:	45                   	rex.RB
+  803b5a:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b5d:	31 32                	xor    %esi,(%rdx)
+  803b5f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b66:	61                   	(bad)
+  803b67:	62 63 64 65 66       	(bad)
+  803b6c:	00 28                	add    %ch,(%rax)
+  803b6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b6f:	75 6c                	jne    803bdd <__rodata_start+0x135>
+  803b71:	6c                   	insb   (%dx),%es:(%rdi)
+  803b72:	29 00                	sub    %eax,(%rax)
+  803b74:	65 72 72             	gs jb  803be9 <__rodata_start+0x141>
+  803b77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b78:	72 20                	jb     803b9a <__rodata_start+0xf2>
+  803b7a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b7f:	73 70                	jae    803bf1 <__rodata_start+0x149>
+  803b81:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b85:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b8d:	72 00                	jb     803b8f <__rodata_start+0xe7>
+  803b8f:	62 61 64 20 65       	(bad)
+  803b94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b95:	76 69                	jbe    803c00 <__rodata_start+0x158>
+  803b97:	72 6f                	jb     803c08 <__rodata_start+0x160>
+  803b99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b9a:	6d                   	insl   (%dx),%es:(%rdi)
+  803b9b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b9d:	74 00                	je     803b9f <__rodata_start+0xf7>
+  803b9f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803ba6:	20 70 61             	and    %dh,0x61(%rax)
+  803ba9:	72 61                	jb     803c0c <__rodata_start+0x164>
+  803bab:	6d                   	insl   (%dx),%es:(%rdi)
+  803bac:	65 74 65             	gs je  803c14 <__rodata_start+0x16c>
+  803baf:	72 00                	jb     803bb1 <__rodata_start+0x109>
+  803bb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb2:	75 74                	jne    803c28 <__rodata_start+0x180>
+  803bb4:	20 6f 66             	and    %ch,0x66(%rdi)
+  803bb7:	20 6d 65             	and    %ch,0x65(%rbp)
+  803bba:	6d                   	insl   (%dx),%es:(%rdi)
+  803bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbc:	72 79                	jb     803c37 <__rodata_start+0x18f>
+  803bbe:	00 6f 75             	add    %ch,0x75(%rdi)
+  803bc1:	74 20                	je     803be3 <__rodata_start+0x13b>
+  803bc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bc4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803bc8:	76 69                	jbe    803c33 <__rodata_start+0x18b>
+  803bca:	72 6f                	jb     803c3b <__rodata_start+0x193>
+  803bcc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bcd:	6d                   	insl   (%dx),%es:(%rdi)
+  803bce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bd0:	74 73                	je     803c45 <__rodata_start+0x19d>
+  803bd2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803bd5:	72 72                	jb     803c49 <__rodata_start+0x1a1>
+  803bd7:	75 70                	jne    803c49 <__rodata_start+0x1a1>
+  803bd9:	74 65                	je     803c40 <__rodata_start+0x198>
+  803bdb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803be0:	75 67                	jne    803c49 <__rodata_start+0x1a1>
+  803be2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803be5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803be7:	00 73 65             	add    %dh,0x65(%rbx)
+  803bea:	67 6d                	insl   (%dx),%es:(%edi)
+  803bec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bee:	74 61                	je     803c51 <__rodata_start+0x1a9>
+  803bf0:	74 69                	je     803c5b <__rodata_start+0x1b3>
+  803bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf4:	20 66 61             	and    %ah,0x61(%rsi)
+  803bf7:	75 6c                	jne    803c65 <__rodata_start+0x1bd>
+  803bf9:	74 00                	je     803bfb <__rodata_start+0x153>
+  803bfb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c02:	20 45 4c             	and    %al,0x4c(%rbp)
+  803c05:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c09:	61                   	(bad)
+  803c0a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c0f:	20 73 75             	and    %dh,0x75(%rbx)
+  803c12:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c15:	73 79                	jae    803c90 <__rodata_start+0x1e8>
+  803c17:	73 74                	jae    803c8d <__rodata_start+0x1e5>
+  803c19:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c1b:	20 63 61             	and    %ah,0x61(%rbx)
+  803c1e:	6c                   	insb   (%dx),%es:(%rdi)
+  803c1f:	6c                   	insb   (%dx),%es:(%rdi)
+  803c20:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803c23:	74 72                	je     803c97 <__rodata_start+0x1ef>
+  803c25:	79 20                	jns    803c47 <__rodata_start+0x19f>
+  803c27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c29:	74 20                	je     803c4b <__rodata_start+0x1a3>
+  803c2b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c2d:	75 6e                	jne    803c9d <__rodata_start+0x1f5>
+  803c2f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803c33:	76 20                	jbe    803c55 <__rodata_start+0x1ad>
+  803c35:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803c3c:	72 65                	jb     803ca3 <__rodata_start+0x1fb>
+  803c3e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803c41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c42:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803c46:	65 78 70             	gs js  803cb9 <__rodata_start+0x211>
+  803c49:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c4e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c51:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c55:	20 66 69             	and    %ah,0x69(%rsi)
+  803c58:	6c                   	insb   (%dx),%es:(%rdi)
+  803c59:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c5d:	20 66 72             	and    %ah,0x72(%rsi)
+  803c60:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c65:	61                   	(bad)
+  803c66:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c6b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c6f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c74:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c78:	79 20                	jns    803c9a <__rodata_start+0x1f2>
+  803c7a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c81:	72 65                	jb     803ce8 <__rodata_start+0x240>
+  803c83:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c88:	00 66 69             	add    %ah,0x69(%rsi)
+  803c8b:	6c                   	insb   (%dx),%es:(%rdi)
+  803c8c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c90:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c94:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c99:	74 20                	je     803cbb <__rodata_start+0x213>
+  803c9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c9d:	75 6e                	jne    803d0d <__rodata_start+0x265>
+  803c9f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803ca3:	76 61                	jbe    803d06 <__rodata_start+0x25e>
+  803ca5:	6c                   	insb   (%dx),%es:(%rdi)
+  803ca6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803cad:	00 
+  803cae:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803cb5:	72 65                	jb     803d1c <__rodata_start+0x274>
+  803cb7:	61                   	(bad)
+  803cb8:	64 79 20             	fs jns 803cdb <__rodata_start+0x233>
+  803cbb:	65 78 69             	gs js  803d27 <__rodata_start+0x27f>
+  803cbe:	73 74                	jae    803d34 <__rodata_start+0x28c>
+  803cc0:	73 00                	jae    803cc2 <__rodata_start+0x21a>
+  803cc2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc3:	70 65                	jo     803d2a <__rodata_start+0x282>
+  803cc5:	72 61                	jb     803d28 <__rodata_start+0x280>
+  803cc7:	74 69                	je     803d32 <__rodata_start+0x28a>
+  803cc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ccb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803cce:	74 20                	je     803cf0 <__rodata_start+0x248>
+  803cd0:	73 75                	jae    803d47 <__rodata_start+0x29f>
+  803cd2:	70 70                	jo     803d44 <__rodata_start+0x29c>
+  803cd4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cd5:	72 74                	jb     803d4b <__rodata_start+0x2a3>
+  803cd7:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803cdd:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803ce2:	74 00                	je     803ce4 <__rodata_start+0x23c>
+  803ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803ceb:	00 00 00 
+  803cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803cf5:	00 00 00 
+  803cf8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803cff:	00 
+  803d00:	a2 07 80 00 00 00 00 	movabs %al,0xe300000000008007
+  803d07:	00 e3 
+  803d09:	0d 80 00 00 00       	or     $0x80,%eax
+  803d0e:	00 00                	add    %al,(%rax)
+  803d10:	d3 0d 80 00 00 00    	rorl   %cl,0x80(%rip)        # 803d96 <__rodata_start+0x2ee>
+  803d16:	00 00                	add    %al,(%rax)
+  803d18:	e3 0d                	jrcxz  803d27 <__rodata_start+0x27f>
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 e3                	add    %ah,%bl
+  803d21:	0d 80 00 00 00       	or     $0x80,%eax
+  803d26:	00 00                	add    %al,(%rax)
+  803d28:	e3 0d                	jrcxz  803d37 <__rodata_start+0x28f>
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 e3                	add    %ah,%bl
+  803d31:	0d 80 00 00 00       	or     $0x80,%eax
+  803d36:	00 00                	add    %al,(%rax)
+  803d38:	c1 07 80             	roll   $0x80,(%rdi)
+  803d3b:	00 00                	add    %al,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 e3                	add    %ah,%bl
+  803d41:	0d 80 00 00 00       	or     $0x80,%eax
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	e3 0d                	jrcxz  803d57 <__rodata_start+0x2af>
+  803d4a:	80 00 00             	addb   $0x0,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 b5 07 80 00 00    	add    %dh,0x8007(%rbp)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 2f                	add    %ch,(%rdi)
+  803d59:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803d5f:	00 e3                	add    %ah,%bl
+  803d61:	0d 80 00 00 00       	or     $0x80,%eax
+  803d66:	00 00                	add    %al,(%rax)
+  803d68:	b5 07                	mov    $0x7,%ch
+  803d6a:	80 00 00             	addb   $0x0,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 fb                	add    %bh,%bl
+  803d71:	07                   	(bad)
+  803d72:	80 00 00             	addb   $0x0,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 fb                	add    %bh,%bl
+  803d79:	07                   	(bad)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 fb                	add    %bh,%bl
+  803d81:	07                   	(bad)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 fb                	add    %bh,%bl
+  803d89:	07                   	(bad)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 fb                	add    %bh,%bl
+  803d91:	07                   	(bad)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 fb                	add    %bh,%bl
+  803d99:	07                   	(bad)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 fb                	add    %bh,%bl
+  803da1:	07                   	(bad)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 fb                	add    %bh,%bl
+  803da9:	07                   	(bad)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 fb                	add    %bh,%bl
+  803db1:	07                   	(bad)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 e3                	add    %ah,%bl
+  803db9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dbe:	00 00                	add    %al,(%rax)
+  803dc0:	e3 0d                	jrcxz  803dcf <__rodata_start+0x327>
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 e3                	add    %ah,%bl
+  803dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dce:	00 00                	add    %al,(%rax)
+  803dd0:	e3 0d                	jrcxz  803ddf <__rodata_start+0x337>
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 e3                	add    %ah,%bl
+  803dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dde:	00 00                	add    %al,(%rax)
+  803de0:	e3 0d                	jrcxz  803def <__rodata_start+0x347>
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 e3                	add    %ah,%bl
+  803de9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dee:	00 00                	add    %al,(%rax)
+  803df0:	e3 0d                	jrcxz  803dff <__rodata_start+0x357>
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 e3                	add    %ah,%bl
+  803df9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dfe:	00 00                	add    %al,(%rax)
+  803e00:	e3 0d                	jrcxz  803e0f <__rodata_start+0x367>
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 e3                	add    %ah,%bl
+  803e09:	0d 80 00 00 00       	or     $0x80,%eax
+  803e0e:	00 00                	add    %al,(%rax)
+  803e10:	e3 0d                	jrcxz  803e1f <__rodata_start+0x377>
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 e3                	add    %ah,%bl
+  803e19:	0d 80 00 00 00       	or     $0x80,%eax
+  803e1e:	00 00                	add    %al,(%rax)
+  803e20:	e3 0d                	jrcxz  803e2f <__rodata_start+0x387>
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 e3                	add    %ah,%bl
+  803e29:	0d 80 00 00 00       	or     $0x80,%eax
+  803e2e:	00 00                	add    %al,(%rax)
+  803e30:	e3 0d                	jrcxz  803e3f <__rodata_start+0x397>
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 e3                	add    %ah,%bl
+  803e39:	0d 80 00 00 00       	or     $0x80,%eax
+  803e3e:	00 00                	add    %al,(%rax)
+  803e40:	e3 0d                	jrcxz  803e4f <__rodata_start+0x3a7>
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 e3                	add    %ah,%bl
+  803e49:	0d 80 00 00 00       	or     $0x80,%eax
+  803e4e:	00 00                	add    %al,(%rax)
+  803e50:	e3 0d                	jrcxz  803e5f <__rodata_start+0x3b7>
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 e3                	add    %ah,%bl
+  803e59:	0d 80 00 00 00       	or     $0x80,%eax
+  803e5e:	00 00                	add    %al,(%rax)
+  803e60:	e3 0d                	jrcxz  803e6f <__rodata_start+0x3c7>
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 e3                	add    %ah,%bl
+  803e69:	0d 80 00 00 00       	or     $0x80,%eax
+  803e6e:	00 00                	add    %al,(%rax)
+  803e70:	e3 0d                	jrcxz  803e7f <__rodata_start+0x3d7>
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 e3                	add    %ah,%bl
+  803e79:	0d 80 00 00 00       	or     $0x80,%eax
+  803e7e:	00 00                	add    %al,(%rax)
+  803e80:	e3 0d                	jrcxz  803e8f <__rodata_start+0x3e7>
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 e3                	add    %ah,%bl
+  803e89:	0d 80 00 00 00       	or     $0x80,%eax
+  803e8e:	00 00                	add    %al,(%rax)
+  803e90:	e3 0d                	jrcxz  803e9f <__rodata_start+0x3f7>
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 e3                	add    %ah,%bl
+  803e99:	0d 80 00 00 00       	or     $0x80,%eax
+  803e9e:	00 00                	add    %al,(%rax)
+  803ea0:	e3 0d                	jrcxz  803eaf <__rodata_start+0x407>
+  803ea2:	80 00 00             	addb   $0x0,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 06                	add    %al,(%rsi)
+  803ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  803eae:	00 00                	add    %al,(%rax)
+  803eb0:	e3 0d                	jrcxz  803ebf <__rodata_start+0x417>
+  803eb2:	80 00 00             	addb   $0x0,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 e3                	add    %ah,%bl
+  803eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ebe:	00 00                	add    %al,(%rax)
+  803ec0:	e3 0d                	jrcxz  803ecf <__rodata_start+0x427>
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 e3                	add    %ah,%bl
+  803ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ece:	00 00                	add    %al,(%rax)
+  803ed0:	e3 0d                	jrcxz  803edf <__rodata_start+0x437>
+  803ed2:	80 00 00             	addb   $0x0,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 e3                	add    %ah,%bl
+  803ed9:	0d 80 00 00 00       	or     $0x80,%eax
+  803ede:	00 00                	add    %al,(%rax)
+  803ee0:	e3 0d                	jrcxz  803eef <__rodata_start+0x447>
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 e3                	add    %ah,%bl
+  803ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  803eee:	00 00                	add    %al,(%rax)
+  803ef0:	e3 0d                	jrcxz  803eff <__rodata_start+0x457>
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 e3                	add    %ah,%bl
+  803ef9:	0d 80 00 00 00       	or     $0x80,%eax
+  803efe:	00 00                	add    %al,(%rax)
+  803f00:	52                   	push   %rdx
+  803f01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803f07:	00 21                	add    %ah,(%rcx)
+  803f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803f0f:	00 e3                	add    %ah,%bl
+  803f11:	0d 80 00 00 00       	or     $0x80,%eax
+  803f16:	00 00                	add    %al,(%rax)
+  803f18:	e3 0d                	jrcxz  803f27 <__rodata_start+0x47f>
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 e3                	add    %ah,%bl
+  803f21:	0d 80 00 00 00       	or     $0x80,%eax
+  803f26:	00 00                	add    %al,(%rax)
+  803f28:	e3 0d                	jrcxz  803f37 <__rodata_start+0x48f>
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 81 08 80 00 00    	add    %al,0x8008(%rcx)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 e3                	add    %ah,%bl
+  803f39:	0d 80 00 00 00       	or     $0x80,%eax
+  803f3e:	00 00                	add    %al,(%rax)
+  803f40:	e3 0d                	jrcxz  803f4f <__rodata_start+0x4a7>
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 47 08             	add    %al,0x8(%rdi)
+  803f4a:	80 00 00             	addb   $0x0,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 e3                	add    %ah,%bl
+  803f51:	0d 80 00 00 00       	or     $0x80,%eax
+  803f56:	00 00                	add    %al,(%rax)
+  803f58:	e3 0d                	jrcxz  803f67 <__rodata_start+0x4bf>
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 c9                	add    %cl,%cl
+  803f61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f67:	00 93 0c 80 00 00    	add    %dl,0x800c(%rbx)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 e3                	add    %ah,%bl
+  803f71:	0d 80 00 00 00       	or     $0x80,%eax
+  803f76:	00 00                	add    %al,(%rax)
+  803f78:	e3 0d                	jrcxz  803f87 <__rodata_start+0x4df>
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 18                	add    %bl,(%rax)
+  803f81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f87:	00 e3                	add    %ah,%bl
+  803f89:	0d 80 00 00 00       	or     $0x80,%eax
+  803f8e:	00 00                	add    %al,(%rax)
+  803f90:	f5                   	cmc
+  803f91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803f97:	00 e3                	add    %ah,%bl
+  803f99:	0d 80 00 00 00       	or     $0x80,%eax
+  803f9e:	00 00                	add    %al,(%rax)
+  803fa0:	e3 0d                	jrcxz  803faf <__rodata_start+0x507>
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 06                	add    %al,(%rsi)
+  803fa9:	0d 80 00 00 00       	or     $0x80,%eax
+  803fae:	00 00                	add    %al,(%rax)
+  803fb0:	e3 0d                	jrcxz  803fbf <__rodata_start+0x517>
+  803fb2:	80 00 00             	addb   $0x0,(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 ab 07 80 00 00    	add    %ch,0x8007(%rbx)
+  803fbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803fc0 <error_string>:
+	...
+  803fc8:	7d 3b 80 00 00 00 00 00 8f 3b 80 00 00 00 00 00     };.......;......
+  803fd8:	9f 3b 80 00 00 00 00 00 b1 3b 80 00 00 00 00 00     .;.......;......
+  803fe8:	bf 3b 80 00 00 00 00 00 d3 3b 80 00 00 00 00 00     .;.......;......
+  803ff8:	e8 3b 80 00 00 00 00 00 fb 3b 80 00 00 00 00 00     .;.......;......
+  804008:	0d 3c 80 00 00 00 00 00 21 3c 80 00 00 00 00 00     .<......!<......
+  804018:	31 3c 80 00 00 00 00 00 44 3c 80 00 00 00 00 00     1<......D<......
+  804028:	5b 3c 80 00 00 00 00 00 71 3c 80 00 00 00 00 00     [<......q<......
+  804038:	89 3c 80 00 00 00 00 00 a1 3c 80 00 00 00 00 00     .<.......<......
+  804048:	ae 3c 80 00 00 00 00 00 68 40 80 00 00 00 00 00     .<......h@......
+  804058:	c2 3c 80 00 00 00 00 00 da 3c 80 00 00 00 00 00     .<.......<......
+  804068:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804078:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 72     lid executable.r
+  804088:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 90     ead error: %i...
+  804098:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8040a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8040b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8040c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8040d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8040e8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  8040f8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  804108:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804118:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804128:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804138:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804148:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804158:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804168:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804178:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804180 <devtab>:
+  804180:	a0 50 80 00 00 00 00 00 40 51 80 00 00 00 00 00     .P......@Q......
+  804190:	00 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8041a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8041b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8041c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8041d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8041e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8041f0:	3d 20 32 00 69 70 63 5f 73 65 6e 64 20 65 72 72     = 2.ipc_send err
+  804200:	6f 72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e     or: %i..lib/ipc.
+  804210:	63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     c.f.........f...
+  804220:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
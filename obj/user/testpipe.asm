@@ -0,0 +1,7758 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 85 04 00 00       	call   8004a8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  800036:	48 b8 c8 3c 80 00 00 	movabs $0x803cc8,%rax
+  80003d:	00 00 00 
+  800040:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  800047:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  80004a:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800051:	48 b8 93 33 80 00 00 	movabs $0x803393,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	41 89 c4             	mov    %eax,%r12d
+  800060:	85 c0                	test   %eax,%eax
+  800062:	0f 88 b3 01 00 00    	js     80021b <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800068:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c3                	mov    %eax,%ebx
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 ca 01 00 00    	js     800248 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80007e:	0f 85 49 02 00 00    	jne    8002cd <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800084:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80008b:	00 00 00 
+  80008e:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800092:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800098:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80009e:	48 bf f6 3c 80 00 00 	movabs $0x803cf6,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	49 bc c9 06 80 00 00 	movabs $0x8006c9,%r12
+  8000b4:	00 00 00 
+  8000b7:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000ba:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000c0:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000cc:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8000d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000d6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8000dc:	48 bf 13 3d 80 00 00 	movabs $0x803d13,%rdi
+  8000e3:	00 00 00 
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8000ee:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000f3:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000fa:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800100:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 5f 01 00 00    	js     800276 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800117:	48 98                	cltq
+  800119:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800120:	00 
+        if (strcmp(buf, msg) == 0)
+  800121:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800128:	00 00 00 
+  80012b:	48 8b 30             	mov    (%rax),%rsi
+  80012e:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800135:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  80013c:	00 00 00 
+  80013f:	ff d0                	call   *%rax
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 85 5a 01 00 00    	jne    8002a3 <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  800149:	48 bf 39 3d 80 00 00 	movabs $0x803d39,%rdi
+  800150:	00 00 00 
+  800153:	48 ba c9 06 80 00 00 	movabs $0x8006c9,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80015f:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  80016b:	89 df                	mov    %ebx,%edi
+  80016d:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  800179:	48 b8 8f 3d 80 00 00 	movabs $0x803d8f,%rax
+  800180:	00 00 00 
+  800183:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  80018a:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80018d:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800194:	48 b8 93 33 80 00 00 	movabs $0x803393,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	41 89 c4             	mov    %eax,%r12d
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 1a 02 00 00    	js     8003c5 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001ab:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	85 c0                	test   %eax,%eax
+  8001bb:	0f 88 31 02 00 00    	js     8003f2 <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001c1:	0f 84 59 02 00 00    	je     800420 <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001c7:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001cd:	49 bc 4c 1d 80 00 00 	movabs $0x801d4c,%r12
+  8001d4:	00 00 00 
+  8001d7:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8001da:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8001e0:	41 ff d4             	call   *%r12
+    wait(pid);
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8001f1:	48 bf bd 3d 80 00 00 	movabs $0x803dbd,%rdi
+  8001f8:	00 00 00 
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	48 ba c9 06 80 00 00 	movabs $0x8006c9,%rdx
+  800207:	00 00 00 
+  80020a:	ff d2                	call   *%rdx
+}
+  80020c:	48 83 c4 78          	add    $0x78,%rsp
+  800210:	5b                   	pop    %rbx
+  800211:	41 5c                	pop    %r12
+  800213:	41 5d                	pop    %r13
+  800215:	41 5e                	pop    %r14
+  800217:	41 5f                	pop    %r15
+  800219:	5d                   	pop    %rbp
+  80021a:	c3                   	ret
+        panic("pipe: %i", i);
+  80021b:	89 c1                	mov    %eax,%ecx
+  80021d:	48 ba d4 3c 80 00 00 	movabs $0x803cd4,%rdx
+  800224:	00 00 00 
+  800227:	be 0d 00 00 00       	mov    $0xd,%esi
+  80022c:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  800233:	00 00 00 
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  800242:	00 00 00 
+  800245:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  800248:	44 89 e1             	mov    %r12d,%ecx
+  80024b:	48 ba ed 3c 80 00 00 	movabs $0x803ced,%rdx
+  800252:	00 00 00 
+  800255:	be 10 00 00 00       	mov    $0x10,%esi
+  80025a:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  800276:	89 c1                	mov    %eax,%ecx
+  800278:	48 ba 30 3d 80 00 00 	movabs $0x803d30,%rdx
+  80027f:	00 00 00 
+  800282:	be 18 00 00 00       	mov    $0x18,%esi
+  800287:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  80029d:	00 00 00 
+  8002a0:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002a3:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  8002aa:	44 89 e6             	mov    %r12d,%esi
+  8002ad:	48 bf 55 3d 80 00 00 	movabs $0x803d55,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  8002c3:	00 00 00 
+  8002c6:	ff d1                	call   *%rcx
+  8002c8:	e9 92 fe ff ff       	jmp    80015f <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002cd:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8002d4:	00 00 00 
+  8002d7:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8002db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8002e1:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8002e7:	48 bf f6 3c 80 00 00 	movabs $0x803cf6,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 bc c9 06 80 00 00 	movabs $0x8006c9,%r12
+  8002fd:	00 00 00 
+  800300:	41 ff d4             	call   *%r12
+        close(p[0]);
+  800303:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800309:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800315:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800319:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80031f:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  800325:	48 bf 68 3d 80 00 00 	movabs $0x803d68,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800337:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  80033e:	00 00 00 
+  800341:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800345:	49 bf b0 0f 80 00 00 	movabs $0x800fb0,%r15
+  80034c:	00 00 00 
+  80034f:	41 ff d7             	call   *%r15
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800359:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80035f:	48 b8 c4 20 80 00 00 	movabs $0x8020c4,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	49 89 c4             	mov    %rax,%r12
+  80036e:	41 89 c6             	mov    %eax,%r14d
+  800371:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800375:	41 ff d7             	call   *%r15
+  800378:	4d 63 e4             	movslq %r12d,%r12
+  80037b:	49 39 c4             	cmp    %rax,%r12
+  80037e:	75 17                	jne    800397 <umain+0x372>
+        close(p[1]);
+  800380:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800386:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+  800392:	e9 d4 fd ff ff       	jmp    80016b <umain+0x146>
+            panic("write: %i", i);
+  800397:	44 89 f1             	mov    %r14d,%ecx
+  80039a:	48 ba 85 3d 80 00 00 	movabs $0x803d85,%rdx
+  8003a1:	00 00 00 
+  8003a4:	be 24 00 00 00       	mov    $0x24,%esi
+  8003a9:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  8003bf:	00 00 00 
+  8003c2:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 ba d4 3c 80 00 00 	movabs $0x803cd4,%rdx
+  8003ce:	00 00 00 
+  8003d1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d6:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  8003ec:	00 00 00 
+  8003ef:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8003f2:	44 89 e1             	mov    %r12d,%ecx
+  8003f5:	48 ba ed 3c 80 00 00 	movabs $0x803ced,%rdx
+  8003fc:	00 00 00 
+  8003ff:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800404:	48 bf dd 3c 80 00 00 	movabs $0x803cdd,%rdi
+  80040b:	00 00 00 
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  80041a:	00 00 00 
+  80041d:	41 ff d0             	call   *%r8
+        close(p[0]);
+  800420:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800426:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+            cprintf(".");
+  800432:	49 bf 9c 3d 80 00 00 	movabs $0x803d9c,%r15
+  800439:	00 00 00 
+  80043c:	49 be c9 06 80 00 00 	movabs $0x8006c9,%r14
+  800443:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  800446:	49 bd 9e 3d 80 00 00 	movabs $0x803d9e,%r13
+  80044d:	00 00 00 
+  800450:	49 bc c4 20 80 00 00 	movabs $0x8020c4,%r12
+  800457:	00 00 00 
+            cprintf(".");
+  80045a:	4c 89 ff             	mov    %r15,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	4c 89 ee             	mov    %r13,%rsi
+  80046d:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800473:	41 ff d4             	call   *%r12
+  800476:	48 83 f8 01          	cmp    $0x1,%rax
+  80047a:	74 de                	je     80045a <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  80047c:	48 bf a0 3d 80 00 00 	movabs $0x803da0,%rdi
+  800483:	00 00 00 
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba c9 06 80 00 00 	movabs $0x8006c9,%rdx
+  800492:	00 00 00 
+  800495:	ff d2                	call   *%rdx
+        exit();
+  800497:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+  8004a3:	e9 1f fd ff ff       	jmp    8001c7 <umain+0x1a2>
+
+00000000008004a8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	41 56                	push   %r14
+  8004ae:	41 55                	push   %r13
+  8004b0:	41 54                	push   %r12
+  8004b2:	53                   	push   %rbx
+  8004b3:	41 89 fd             	mov    %edi,%r13d
+  8004b6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004b9:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8004ca:	00 00 00 
+  8004cd:	48 39 c2             	cmp    %rax,%rdx
+  8004d0:	73 17                	jae    8004e9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004d2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004d5:	49 89 c4             	mov    %rax,%r12
+  8004d8:	48 83 c3 08          	add    $0x8,%rbx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	ff 53 f8             	call   *-0x8(%rbx)
+  8004e4:	4c 39 e3             	cmp    %r12,%rbx
+  8004e7:	72 ef                	jb     8004d8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8004e9:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004fa:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8004fe:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800502:	48 c1 e0 04          	shl    $0x4,%rax
+  800506:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80050d:	00 00 00 
+  800510:	48 01 d0             	add    %rdx,%rax
+  800513:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80051a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80051d:	45 85 ed             	test   %r13d,%r13d
+  800520:	7e 0d                	jle    80052f <libmain+0x87>
+  800522:	49 8b 06             	mov    (%r14),%rax
+  800525:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  80052c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80052f:	4c 89 f6             	mov    %r14,%rsi
+  800532:	44 89 ef             	mov    %r13d,%edi
+  800535:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80053c:	00 00 00 
+  80053f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800541:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  800548:	00 00 00 
+  80054b:	ff d0                	call   *%rax
+#endif
+}
+  80054d:	5b                   	pop    %rbx
+  80054e:	41 5c                	pop    %r12
+  800550:	41 5d                	pop    %r13
+  800552:	41 5e                	pop    %r14
+  800554:	5d                   	pop    %rbp
+  800555:	c3                   	ret
+
+0000000000800556 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800556:	55                   	push   %rbp
+  800557:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80055a:	48 b8 7f 1d 80 00 00 	movabs $0x801d7f,%rax
+  800561:	00 00 00 
+  800564:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800566:	bf 00 00 00 00       	mov    $0x0,%edi
+  80056b:	48 b8 4f 15 80 00 00 	movabs $0x80154f,%rax
+  800572:	00 00 00 
+  800575:	ff d0                	call   *%rax
+}
+  800577:	5d                   	pop    %rbp
+  800578:	c3                   	ret
+
+0000000000800579 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800579:	55                   	push   %rbp
+  80057a:	48 89 e5             	mov    %rsp,%rbp
+  80057d:	41 56                	push   %r14
+  80057f:	41 55                	push   %r13
+  800581:	41 54                	push   %r12
+  800583:	53                   	push   %rbx
+  800584:	48 83 ec 50          	sub    $0x50,%rsp
+  800588:	49 89 fc             	mov    %rdi,%r12
+  80058b:	41 89 f5             	mov    %esi,%r13d
+  80058e:	48 89 d3             	mov    %rdx,%rbx
+  800591:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800595:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800599:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80059d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8005a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005ac:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005b0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005b4:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8005bb:	00 00 00 
+  8005be:	4c 8b 30             	mov    (%rax),%r14
+  8005c1:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+  8005cd:	89 c6                	mov    %eax,%esi
+  8005cf:	45 89 e8             	mov    %r13d,%r8d
+  8005d2:	4c 89 e1             	mov    %r12,%rcx
+  8005d5:	4c 89 f2             	mov    %r14,%rdx
+  8005d8:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  8005df:	00 00 00 
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	49 bc c9 06 80 00 00 	movabs $0x8006c9,%r12
+  8005ee:	00 00 00 
+  8005f1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005f4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005f8:	48 89 df             	mov    %rbx,%rdi
+  8005fb:	48 b8 65 06 80 00 00 	movabs $0x800665,%rax
+  800602:	00 00 00 
+  800605:	ff d0                	call   *%rax
+    cprintf("\n");
+  800607:	48 bf 11 3d 80 00 00 	movabs $0x803d11,%rdi
+  80060e:	00 00 00 
+  800611:	b8 00 00 00 00       	mov    $0x0,%eax
+  800616:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800619:	cc                   	int3
+  80061a:	eb fd                	jmp    800619 <_panic+0xa0>
+
+000000000080061c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80061c:	55                   	push   %rbp
+  80061d:	48 89 e5             	mov    %rsp,%rbp
+  800620:	53                   	push   %rbx
+  800621:	48 83 ec 08          	sub    $0x8,%rsp
+  800625:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800628:	8b 06                	mov    (%rsi),%eax
+  80062a:	8d 50 01             	lea    0x1(%rax),%edx
+  80062d:	89 16                	mov    %edx,(%rsi)
+  80062f:	48 98                	cltq
+  800631:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800636:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80063c:	74 0a                	je     800648 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80063e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800642:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800646:	c9                   	leave
+  800647:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800648:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80064c:	be ff 00 00 00       	mov    $0xff,%esi
+  800651:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  800658:	00 00 00 
+  80065b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80065d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800663:	eb d9                	jmp    80063e <putch+0x22>
+
+0000000000800665 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800665:	55                   	push   %rbp
+  800666:	48 89 e5             	mov    %rsp,%rbp
+  800669:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800670:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800673:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80067a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80067f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800684:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800687:	48 89 f1             	mov    %rsi,%rcx
+  80068a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800691:	48 bf 1c 06 80 00 00 	movabs $0x80061c,%rdi
+  800698:	00 00 00 
+  80069b:	48 b8 19 08 80 00 00 	movabs $0x800819,%rax
+  8006a2:	00 00 00 
+  8006a5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006a7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006ae:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006b5:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  8006bc:	00 00 00 
+  8006bf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006c1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006c7:	c9                   	leave
+  8006c8:	c3                   	ret
+
+00000000008006c9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006c9:	55                   	push   %rbp
+  8006ca:	48 89 e5             	mov    %rsp,%rbp
+  8006cd:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006d5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006e5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006fc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800700:	48 b8 65 06 80 00 00 	movabs $0x800665,%rax
+  800707:	00 00 00 
+  80070a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80070c:	c9                   	leave
+  80070d:	c3                   	ret
+
+000000000080070e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80070e:	55                   	push   %rbp
+  80070f:	48 89 e5             	mov    %rsp,%rbp
+  800712:	41 57                	push   %r15
+  800714:	41 56                	push   %r14
+  800716:	41 55                	push   %r13
+  800718:	41 54                	push   %r12
+  80071a:	53                   	push   %rbx
+  80071b:	48 83 ec 18          	sub    $0x18,%rsp
+  80071f:	49 89 fc             	mov    %rdi,%r12
+  800722:	49 89 f5             	mov    %rsi,%r13
+  800725:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800729:	8b 45 10             	mov    0x10(%rbp),%eax
+  80072c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80072f:	41 89 cf             	mov    %ecx,%r15d
+  800732:	4c 39 fa             	cmp    %r15,%rdx
+  800735:	73 5b                	jae    800792 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800737:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80073b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80073f:	85 db                	test   %ebx,%ebx
+  800741:	7e 0e                	jle    800751 <print_num+0x43>
+            putch(padc, put_arg);
+  800743:	4c 89 ee             	mov    %r13,%rsi
+  800746:	44 89 f7             	mov    %r14d,%edi
+  800749:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80074c:	83 eb 01             	sub    $0x1,%ebx
+  80074f:	75 f2                	jne    800743 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800751:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800755:	48 b9 54 3e 80 00 00 	movabs $0x803e54,%rcx
+  80075c:	00 00 00 
+  80075f:	48 b8 43 3e 80 00 00 	movabs $0x803e43,%rax
+  800766:	00 00 00 
+  800769:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80076d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800771:	ba 00 00 00 00       	mov    $0x0,%edx
+  800776:	49 f7 f7             	div    %r15
+  800779:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80077d:	4c 89 ee             	mov    %r13,%rsi
+  800780:	41 ff d4             	call   *%r12
+}
+  800783:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800787:	5b                   	pop    %rbx
+  800788:	41 5c                	pop    %r12
+  80078a:	41 5d                	pop    %r13
+  80078c:	41 5e                	pop    %r14
+  80078e:	41 5f                	pop    %r15
+  800790:	5d                   	pop    %rbp
+  800791:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800792:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800796:	ba 00 00 00 00       	mov    $0x0,%edx
+  80079b:	49 f7 f7             	div    %r15
+  80079e:	48 83 ec 08          	sub    $0x8,%rsp
+  8007a2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8007a6:	52                   	push   %rdx
+  8007a7:	45 0f be c9          	movsbl %r9b,%r9d
+  8007ab:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007af:	48 89 c2             	mov    %rax,%rdx
+  8007b2:	48 b8 0e 07 80 00 00 	movabs $0x80070e,%rax
+  8007b9:	00 00 00 
+  8007bc:	ff d0                	call   *%rax
+  8007be:	48 83 c4 10          	add    $0x10,%rsp
+  8007c2:	eb 8d                	jmp    800751 <print_num+0x43>
+
+00000000008007c4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007c4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007c8:	48 8b 06             	mov    (%rsi),%rax
+  8007cb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007cf:	73 0a                	jae    8007db <sprintputch+0x17>
+        *state->start++ = ch;
+  8007d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007d5:	48 89 16             	mov    %rdx,(%rsi)
+  8007d8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007db:	c3                   	ret
+
+00000000008007dc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007dc:	55                   	push   %rbp
+  8007dd:	48 89 e5             	mov    %rsp,%rbp
+  8007e0:	48 83 ec 50          	sub    $0x50,%rsp
+  8007e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007f0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800803:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800807:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80080b:	48 b8 19 08 80 00 00 	movabs $0x800819,%rax
+  800812:	00 00 00 
+  800815:	ff d0                	call   *%rax
+}
+  800817:	c9                   	leave
+  800818:	c3                   	ret
+
+0000000000800819 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800819:	55                   	push   %rbp
+  80081a:	48 89 e5             	mov    %rsp,%rbp
+  80081d:	41 57                	push   %r15
+  80081f:	41 56                	push   %r14
+  800821:	41 55                	push   %r13
+  800823:	41 54                	push   %r12
+  800825:	53                   	push   %rbx
+  800826:	48 83 ec 38          	sub    $0x38,%rsp
+  80082a:	49 89 fe             	mov    %rdi,%r14
+  80082d:	49 89 f5             	mov    %rsi,%r13
+  800830:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800833:	48 8b 01             	mov    (%rcx),%rax
+  800836:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80083a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80083e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800842:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800846:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80084a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80084e:	0f b6 3b             	movzbl (%rbx),%edi
+  800851:	40 80 ff 25          	cmp    $0x25,%dil
+  800855:	74 18                	je     80086f <vprintfmt+0x56>
+            if (!ch) return;
+  800857:	40 84 ff             	test   %dil,%dil
+  80085a:	0f 84 b1 06 00 00    	je     800f11 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800860:	40 0f b6 ff          	movzbl %dil,%edi
+  800864:	4c 89 ee             	mov    %r13,%rsi
+  800867:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80086a:	4c 89 e3             	mov    %r12,%rbx
+  80086d:	eb db                	jmp    80084a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80086f:	be 00 00 00 00       	mov    $0x0,%esi
+  800874:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800878:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80087d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800883:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80088a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80088e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800893:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800898:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80089b:	83 e8 23             	sub    $0x23,%eax
+  80089e:	3c 57                	cmp    $0x57,%al
+  8008a0:	0f 87 51 06 00 00    	ja     800ef7 <vprintfmt+0x6de>
+  8008a6:	0f b6 c0             	movzbl %al,%eax
+  8008a9:	48 b9 e0 3f 80 00 00 	movabs $0x803fe0,%rcx
+  8008b0:	00 00 00 
+  8008b3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008b6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008b9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008bd:	eb cf                	jmp    80088e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008bf:	49 89 dc             	mov    %rbx,%r12
+  8008c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8008c7:	eb c5                	jmp    80088e <vprintfmt+0x75>
+            padc = ch;
+  8008c9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008cd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008d0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008d3:	eb b9                	jmp    80088e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008db:	77 24                	ja     800901 <vprintfmt+0xe8>
+  8008dd:	89 c1                	mov    %eax,%ecx
+  8008df:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008e3:	83 c0 08             	add    $0x8,%eax
+  8008e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008ec:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008f3:	79 99                	jns    80088e <vprintfmt+0x75>
+                width = precision;
+  8008f5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008ff:	eb 8d                	jmp    80088e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800901:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800905:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800909:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090d:	eb da                	jmp    8008e9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80090f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800914:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800918:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80091e:	3c 39                	cmp    $0x39,%al
+  800920:	77 1c                	ja     80093e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800922:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800926:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80092a:	0f b6 c0             	movzbl %al,%eax
+  80092d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800932:	0f b6 03             	movzbl (%rbx),%eax
+  800935:	3c 39                	cmp    $0x39,%al
+  800937:	76 e9                	jbe    800922 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800939:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80093c:	eb b1                	jmp    8008ef <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80093e:	49 89 dc             	mov    %rbx,%r12
+  800941:	eb ac                	jmp    8008ef <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800943:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800946:	85 c9                	test   %ecx,%ecx
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	0f 49 c1             	cmovns %ecx,%eax
+  800950:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800953:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800956:	e9 33 ff ff ff       	jmp    80088e <vprintfmt+0x75>
+            lflag++;
+  80095b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80095e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800961:	e9 28 ff ff ff       	jmp    80088e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 19                	ja     800987 <vprintfmt+0x16e>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	8b 3a                	mov    (%rdx),%edi
+  80097c:	4c 89 ee             	mov    %r13,%rsi
+  80097f:	41 ff d6             	call   *%r14
+            break;
+  800982:	e9 c3 fe ff ff       	jmp    80084a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800987:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800993:	eb e5                	jmp    80097a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800998:	83 f8 2f             	cmp    $0x2f,%eax
+  80099b:	77 5a                	ja     8009f7 <vprintfmt+0x1de>
+  80099d:	89 c2                	mov    %eax,%edx
+  80099f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a3:	83 c0 08             	add    $0x8,%eax
+  8009a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009a9:	8b 02                	mov    (%rdx),%eax
+  8009ab:	89 c1                	mov    %eax,%ecx
+  8009ad:	f7 d9                	neg    %ecx
+  8009af:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009b2:	83 f9 14             	cmp    $0x14,%ecx
+  8009b5:	7f 4e                	jg     800a05 <vprintfmt+0x1ec>
+  8009b7:	48 63 c1             	movslq %ecx,%rax
+  8009ba:	48 ba a0 42 80 00 00 	movabs $0x8042a0,%rdx
+  8009c1:	00 00 00 
+  8009c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009c8:	48 85 c0             	test   %rax,%rax
+  8009cb:	74 38                	je     800a05 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009cd:	48 89 c1             	mov    %rax,%rcx
+  8009d0:	48 ba 99 44 80 00 00 	movabs $0x804499,%rdx
+  8009d7:	00 00 00 
+  8009da:	4c 89 ee             	mov    %r13,%rsi
+  8009dd:	4c 89 f7             	mov    %r14,%rdi
+  8009e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e5:	49 b8 dc 07 80 00 00 	movabs $0x8007dc,%r8
+  8009ec:	00 00 00 
+  8009ef:	41 ff d0             	call   *%r8
+  8009f2:	e9 53 fe ff ff       	jmp    80084a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb a4                	jmp    8009a9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800a05:	48 ba 6c 3e 80 00 00 	movabs $0x803e6c,%rdx
+  800a0c:	00 00 00 
+  800a0f:	4c 89 ee             	mov    %r13,%rsi
+  800a12:	4c 89 f7             	mov    %r14,%rdi
+  800a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1a:	49 b8 dc 07 80 00 00 	movabs $0x8007dc,%r8
+  800a21:	00 00 00 
+  800a24:	41 ff d0             	call   *%r8
+  800a27:	e9 1e fe ff ff       	jmp    80084a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a32:	77 6c                	ja     800aa0 <vprintfmt+0x287>
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3a:	83 c0 08             	add    $0x8,%eax
+  800a3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a40:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a43:	48 85 d2             	test   %rdx,%rdx
+  800a46:	48 b8 65 3e 80 00 00 	movabs $0x803e65,%rax
+  800a4d:	00 00 00 
+  800a50:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a54:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a58:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a5c:	7e 06                	jle    800a64 <vprintfmt+0x24b>
+  800a5e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a62:	75 4a                	jne    800aae <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a64:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a68:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a6c:	0f b6 00             	movzbl (%rax),%eax
+  800a6f:	84 c0                	test   %al,%al
+  800a71:	0f 85 9a 00 00 00    	jne    800b11 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a77:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a7a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a7e:	85 c0                	test   %eax,%eax
+  800a80:	0f 8e c4 fd ff ff    	jle    80084a <vprintfmt+0x31>
+  800a86:	4c 89 ee             	mov    %r13,%rsi
+  800a89:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a8e:	41 ff d6             	call   *%r14
+  800a91:	41 83 ec 01          	sub    $0x1,%r12d
+  800a95:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a99:	75 eb                	jne    800a86 <vprintfmt+0x26d>
+  800a9b:	e9 aa fd ff ff       	jmp    80084a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800aa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aac:	eb 92                	jmp    800a40 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800aae:	49 63 f7             	movslq %r15d,%rsi
+  800ab1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800ab5:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  800abc:	00 00 00 
+  800abf:	ff d0                	call   *%rax
+  800ac1:	48 89 c2             	mov    %rax,%rdx
+  800ac4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ac7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ac9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800acc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	7e 91                	jle    800a64 <vprintfmt+0x24b>
+  800ad3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ad8:	4c 89 ee             	mov    %r13,%rsi
+  800adb:	44 89 e7             	mov    %r12d,%edi
+  800ade:	41 ff d6             	call   *%r14
+  800ae1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ae5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ae8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800aeb:	75 eb                	jne    800ad8 <vprintfmt+0x2bf>
+  800aed:	e9 72 ff ff ff       	jmp    800a64 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800af2:	0f b6 f8             	movzbl %al,%edi
+  800af5:	4c 89 ee             	mov    %r13,%rsi
+  800af8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800afb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800aff:	49 83 c4 01          	add    $0x1,%r12
+  800b03:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b09:	84 c0                	test   %al,%al
+  800b0b:	0f 84 66 ff ff ff    	je     800a77 <vprintfmt+0x25e>
+  800b11:	45 85 ff             	test   %r15d,%r15d
+  800b14:	78 0a                	js     800b20 <vprintfmt+0x307>
+  800b16:	41 83 ef 01          	sub    $0x1,%r15d
+  800b1a:	0f 88 57 ff ff ff    	js     800a77 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b20:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b24:	74 cc                	je     800af2 <vprintfmt+0x2d9>
+  800b26:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b29:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b2e:	80 fa 5e             	cmp    $0x5e,%dl
+  800b31:	77 c2                	ja     800af5 <vprintfmt+0x2dc>
+  800b33:	eb bd                	jmp    800af2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b35:	40 84 f6             	test   %sil,%sil
+  800b38:	75 26                	jne    800b60 <vprintfmt+0x347>
+    switch (lflag) {
+  800b3a:	85 d2                	test   %edx,%edx
+  800b3c:	74 59                	je     800b97 <vprintfmt+0x37e>
+  800b3e:	83 fa 01             	cmp    $0x1,%edx
+  800b41:	74 7b                	je     800bbe <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b46:	83 f8 2f             	cmp    $0x2f,%eax
+  800b49:	0f 87 96 00 00 00    	ja     800be5 <vprintfmt+0x3cc>
+  800b4f:	89 c2                	mov    %eax,%edx
+  800b51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b55:	83 c0 08             	add    $0x8,%eax
+  800b58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5b:	4c 8b 22             	mov    (%rdx),%r12
+  800b5e:	eb 17                	jmp    800b77 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b63:	83 f8 2f             	cmp    $0x2f,%eax
+  800b66:	77 21                	ja     800b89 <vprintfmt+0x370>
+  800b68:	89 c2                	mov    %eax,%edx
+  800b6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6e:	83 c0 08             	add    $0x8,%eax
+  800b71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b74:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b77:	4d 85 e4             	test   %r12,%r12
+  800b7a:	78 7a                	js     800bf6 <vprintfmt+0x3dd>
+            num = i;
+  800b7c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b7f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b84:	e9 50 02 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b95:	eb dd                	jmp    800b74 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9d:	77 11                	ja     800bb0 <vprintfmt+0x397>
+  800b9f:	89 c2                	mov    %eax,%edx
+  800ba1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba5:	83 c0 08             	add    $0x8,%eax
+  800ba8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bab:	4c 63 22             	movslq (%rdx),%r12
+  800bae:	eb c7                	jmp    800b77 <vprintfmt+0x35e>
+  800bb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbc:	eb ed                	jmp    800bab <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800bbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc4:	77 11                	ja     800bd7 <vprintfmt+0x3be>
+  800bc6:	89 c2                	mov    %eax,%edx
+  800bc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcc:	83 c0 08             	add    $0x8,%eax
+  800bcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd2:	4c 8b 22             	mov    (%rdx),%r12
+  800bd5:	eb a0                	jmp    800b77 <vprintfmt+0x35e>
+  800bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be3:	eb ed                	jmp    800bd2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800be5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf1:	e9 65 ff ff ff       	jmp    800b5b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bf6:	4c 89 ee             	mov    %r13,%rsi
+  800bf9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bfe:	41 ff d6             	call   *%r14
+                i = -i;
+  800c01:	49 f7 dc             	neg    %r12
+  800c04:	e9 73 ff ff ff       	jmp    800b7c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800c09:	40 84 f6             	test   %sil,%sil
+  800c0c:	75 32                	jne    800c40 <vprintfmt+0x427>
+    switch (lflag) {
+  800c0e:	85 d2                	test   %edx,%edx
+  800c10:	74 5d                	je     800c6f <vprintfmt+0x456>
+  800c12:	83 fa 01             	cmp    $0x1,%edx
+  800c15:	0f 84 82 00 00 00    	je     800c9d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c21:	0f 87 a5 00 00 00    	ja     800ccc <vprintfmt+0x4b3>
+  800c27:	89 c2                	mov    %eax,%edx
+  800c29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2d:	83 c0 08             	add    $0x8,%eax
+  800c30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c33:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c3b:	e9 99 01 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c43:	83 f8 2f             	cmp    $0x2f,%eax
+  800c46:	77 19                	ja     800c61 <vprintfmt+0x448>
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4e:	83 c0 08             	add    $0x8,%eax
+  800c51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c54:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c5c:	e9 78 01 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+  800c61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6d:	eb e5                	jmp    800c54 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c72:	83 f8 2f             	cmp    $0x2f,%eax
+  800c75:	77 18                	ja     800c8f <vprintfmt+0x476>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c8a:	e9 4a 01 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+  800c8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9b:	eb e6                	jmp    800c83 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca3:	77 19                	ja     800cbe <vprintfmt+0x4a5>
+  800ca5:	89 c2                	mov    %eax,%edx
+  800ca7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cab:	83 c0 08             	add    $0x8,%eax
+  800cae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cb4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800cb9:	e9 1b 01 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+  800cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cca:	eb e5                	jmp    800cb1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800ccc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd8:	e9 56 ff ff ff       	jmp    800c33 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cdd:	40 84 f6             	test   %sil,%sil
+  800ce0:	75 2e                	jne    800d10 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ce2:	85 d2                	test   %edx,%edx
+  800ce4:	74 59                	je     800d3f <vprintfmt+0x526>
+  800ce6:	83 fa 01             	cmp    $0x1,%edx
+  800ce9:	74 7f                	je     800d6a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ceb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cee:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf1:	0f 87 9f 00 00 00    	ja     800d96 <vprintfmt+0x57d>
+  800cf7:	89 c2                	mov    %eax,%edx
+  800cf9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cfd:	83 c0 08             	add    $0x8,%eax
+  800d00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d03:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d0b:	e9 c9 00 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d13:	83 f8 2f             	cmp    $0x2f,%eax
+  800d16:	77 19                	ja     800d31 <vprintfmt+0x518>
+  800d18:	89 c2                	mov    %eax,%edx
+  800d1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1e:	83 c0 08             	add    $0x8,%eax
+  800d21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d27:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d2c:	e9 a8 00 00 00       	jmp    800dd9 <vprintfmt+0x5c0>
+  800d31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3d:	eb e5                	jmp    800d24 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d42:	83 f8 2f             	cmp    $0x2f,%eax
+  800d45:	77 15                	ja     800d5c <vprintfmt+0x543>
+  800d47:	89 c2                	mov    %eax,%edx
+  800d49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4d:	83 c0 08             	add    $0x8,%eax
+  800d50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d53:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5a:	eb 7d                	jmp    800dd9 <vprintfmt+0x5c0>
+  800d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d68:	eb e9                	jmp    800d53 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d70:	77 16                	ja     800d88 <vprintfmt+0x56f>
+  800d72:	89 c2                	mov    %eax,%edx
+  800d74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d78:	83 c0 08             	add    $0x8,%eax
+  800d7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d81:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d86:	eb 51                	jmp    800dd9 <vprintfmt+0x5c0>
+  800d88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d94:	eb e8                	jmp    800d7e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da2:	e9 5c ff ff ff       	jmp    800d03 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800da7:	4c 89 ee             	mov    %r13,%rsi
+  800daa:	bf 30 00 00 00       	mov    $0x30,%edi
+  800daf:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800db2:	4c 89 ee             	mov    %r13,%rsi
+  800db5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800dba:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc3:	77 47                	ja     800e0c <vprintfmt+0x5f3>
+  800dc5:	89 c2                	mov    %eax,%edx
+  800dc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dcb:	83 c0 08             	add    $0x8,%eax
+  800dce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dd4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800dd9:	48 83 ec 08          	sub    $0x8,%rsp
+  800ddd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800de1:	0f 94 c0             	sete   %al
+  800de4:	0f b6 c0             	movzbl %al,%eax
+  800de7:	50                   	push   %rax
+  800de8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ded:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800df1:	4c 89 ee             	mov    %r13,%rsi
+  800df4:	4c 89 f7             	mov    %r14,%rdi
+  800df7:	48 b8 0e 07 80 00 00 	movabs $0x80070e,%rax
+  800dfe:	00 00 00 
+  800e01:	ff d0                	call   *%rax
+            break;
+  800e03:	48 83 c4 10          	add    $0x10,%rsp
+  800e07:	e9 3e fa ff ff       	jmp    80084a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e18:	eb b7                	jmp    800dd1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e1a:	40 84 f6             	test   %sil,%sil
+  800e1d:	75 2b                	jne    800e4a <vprintfmt+0x631>
+    switch (lflag) {
+  800e1f:	85 d2                	test   %edx,%edx
+  800e21:	74 56                	je     800e79 <vprintfmt+0x660>
+  800e23:	83 fa 01             	cmp    $0x1,%edx
+  800e26:	74 7f                	je     800ea7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2e:	0f 87 a2 00 00 00    	ja     800ed6 <vprintfmt+0x6bd>
+  800e34:	89 c2                	mov    %eax,%edx
+  800e36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e3a:	83 c0 08             	add    $0x8,%eax
+  800e3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e43:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e48:	eb 8f                	jmp    800dd9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e50:	77 19                	ja     800e6b <vprintfmt+0x652>
+  800e52:	89 c2                	mov    %eax,%edx
+  800e54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e58:	83 c0 08             	add    $0x8,%eax
+  800e5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e61:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e66:	e9 6e ff ff ff       	jmp    800dd9 <vprintfmt+0x5c0>
+  800e6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e77:	eb e5                	jmp    800e5e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7f:	77 18                	ja     800e99 <vprintfmt+0x680>
+  800e81:	89 c2                	mov    %eax,%edx
+  800e83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e87:	83 c0 08             	add    $0x8,%eax
+  800e8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e94:	e9 40 ff ff ff       	jmp    800dd9 <vprintfmt+0x5c0>
+  800e99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea5:	eb e6                	jmp    800e8d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ea7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eaa:	83 f8 2f             	cmp    $0x2f,%eax
+  800ead:	77 19                	ja     800ec8 <vprintfmt+0x6af>
+  800eaf:	89 c2                	mov    %eax,%edx
+  800eb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eb5:	83 c0 08             	add    $0x8,%eax
+  800eb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ebb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ebe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ec3:	e9 11 ff ff ff       	jmp    800dd9 <vprintfmt+0x5c0>
+  800ec8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ecc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed4:	eb e5                	jmp    800ebb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ed6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ede:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee2:	e9 59 ff ff ff       	jmp    800e40 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ee7:	4c 89 ee             	mov    %r13,%rsi
+  800eea:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eef:	41 ff d6             	call   *%r14
+            break;
+  800ef2:	e9 53 f9 ff ff       	jmp    80084a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ef7:	4c 89 ee             	mov    %r13,%rsi
+  800efa:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eff:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800f02:	48 83 eb 01          	sub    $0x1,%rbx
+  800f06:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f0a:	75 f6                	jne    800f02 <vprintfmt+0x6e9>
+  800f0c:	e9 39 f9 ff ff       	jmp    80084a <vprintfmt+0x31>
+}
+  800f11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f15:	5b                   	pop    %rbx
+  800f16:	41 5c                	pop    %r12
+  800f18:	41 5d                	pop    %r13
+  800f1a:	41 5e                	pop    %r14
+  800f1c:	41 5f                	pop    %r15
+  800f1e:	5d                   	pop    %rbp
+  800f1f:	c3                   	ret
+
+0000000000800f20 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f20:	55                   	push   %rbp
+  800f21:	48 89 e5             	mov    %rsp,%rbp
+  800f24:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f2c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f31:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f35:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f3c:	48 85 ff             	test   %rdi,%rdi
+  800f3f:	74 2b                	je     800f6c <vsnprintf+0x4c>
+  800f41:	48 85 f6             	test   %rsi,%rsi
+  800f44:	74 26                	je     800f6c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f46:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f4a:	48 bf c4 07 80 00 00 	movabs $0x8007c4,%rdi
+  800f51:	00 00 00 
+  800f54:	48 b8 19 08 80 00 00 	movabs $0x800819,%rax
+  800f5b:	00 00 00 
+  800f5e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f64:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f67:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f6a:	c9                   	leave
+  800f6b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f71:	eb f7                	jmp    800f6a <vsnprintf+0x4a>
+
+0000000000800f73 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	48 83 ec 50          	sub    $0x50,%rsp
+  800f7b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f7f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f83:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f87:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f8e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f96:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f9a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f9e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800fa2:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800fae:	c9                   	leave
+  800faf:	c3                   	ret
+
+0000000000800fb0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800fb0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800fb3:	74 10                	je     800fc5 <strlen+0x15>
+    size_t n = 0;
+  800fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fba:	48 83 c0 01          	add    $0x1,%rax
+  800fbe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fc2:	75 f6                	jne    800fba <strlen+0xa>
+  800fc4:	c3                   	ret
+    size_t n = 0;
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fca:	c3                   	ret
+
+0000000000800fcb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fcb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fce:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fd3:	48 85 f6             	test   %rsi,%rsi
+  800fd6:	74 11                	je     800fe9 <strnlen+0x1e>
+  800fd8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fdc:	74 0c                	je     800fea <strnlen+0x1f>
+  800fde:	48 83 c2 01          	add    $0x1,%rdx
+  800fe2:	48 39 d0             	cmp    %rdx,%rax
+  800fe5:	75 f1                	jne    800fd8 <strnlen+0xd>
+  800fe7:	eb 04                	jmp    800fed <strnlen+0x22>
+  800fe9:	c3                   	ret
+  800fea:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fee:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ffa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ffd:	48 83 c2 01          	add    $0x1,%rdx
+  801001:	84 c9                	test   %cl,%cl
+  801003:	75 f1                	jne    800ff6 <strcpy+0x8>
+        ;
+    return res;
+}
+  801005:	c3                   	ret
+
+0000000000801006 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801006:	55                   	push   %rbp
+  801007:	48 89 e5             	mov    %rsp,%rbp
+  80100a:	41 54                	push   %r12
+  80100c:	53                   	push   %rbx
+  80100d:	48 89 fb             	mov    %rdi,%rbx
+  801010:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801013:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80101f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801023:	4c 89 e6             	mov    %r12,%rsi
+  801026:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+    return dst;
+}
+  801032:	48 89 d8             	mov    %rbx,%rax
+  801035:	5b                   	pop    %rbx
+  801036:	41 5c                	pop    %r12
+  801038:	5d                   	pop    %rbp
+  801039:	c3                   	ret
+
+000000000080103a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80103a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80103d:	48 85 d2             	test   %rdx,%rdx
+  801040:	74 1f                	je     801061 <strncpy+0x27>
+  801042:	48 01 fa             	add    %rdi,%rdx
+  801045:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801048:	48 83 c1 01          	add    $0x1,%rcx
+  80104c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801050:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801054:	41 80 f8 01          	cmp    $0x1,%r8b
+  801058:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80105c:	48 39 ca             	cmp    %rcx,%rdx
+  80105f:	75 e7                	jne    801048 <strncpy+0xe>
+    }
+    return ret;
+}
+  801061:	c3                   	ret
+
+0000000000801062 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801062:	48 89 f8             	mov    %rdi,%rax
+  801065:	48 85 d2             	test   %rdx,%rdx
+  801068:	74 24                	je     80108e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80106a:	48 83 ea 01          	sub    $0x1,%rdx
+  80106e:	74 1b                	je     80108b <strlcpy+0x29>
+  801070:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801074:	0f b6 16             	movzbl (%rsi),%edx
+  801077:	84 d2                	test   %dl,%dl
+  801079:	74 10                	je     80108b <strlcpy+0x29>
+            *dst++ = *src++;
+  80107b:	48 83 c6 01          	add    $0x1,%rsi
+  80107f:	48 83 c0 01          	add    $0x1,%rax
+  801083:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801086:	48 39 c8             	cmp    %rcx,%rax
+  801089:	75 e9                	jne    801074 <strlcpy+0x12>
+        *dst = '\0';
+  80108b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80108e:	48 29 f8             	sub    %rdi,%rax
+}
+  801091:	c3                   	ret
+
+0000000000801092 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801092:	0f b6 07             	movzbl (%rdi),%eax
+  801095:	84 c0                	test   %al,%al
+  801097:	74 13                	je     8010ac <strcmp+0x1a>
+  801099:	38 06                	cmp    %al,(%rsi)
+  80109b:	75 0f                	jne    8010ac <strcmp+0x1a>
+  80109d:	48 83 c7 01          	add    $0x1,%rdi
+  8010a1:	48 83 c6 01          	add    $0x1,%rsi
+  8010a5:	0f b6 07             	movzbl (%rdi),%eax
+  8010a8:	84 c0                	test   %al,%al
+  8010aa:	75 ed                	jne    801099 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010ac:	0f b6 c0             	movzbl %al,%eax
+  8010af:	0f b6 16             	movzbl (%rsi),%edx
+  8010b2:	29 d0                	sub    %edx,%eax
+}
+  8010b4:	c3                   	ret
+
+00000000008010b5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8010b5:	48 85 d2             	test   %rdx,%rdx
+  8010b8:	74 1f                	je     8010d9 <strncmp+0x24>
+  8010ba:	0f b6 07             	movzbl (%rdi),%eax
+  8010bd:	84 c0                	test   %al,%al
+  8010bf:	74 1e                	je     8010df <strncmp+0x2a>
+  8010c1:	3a 06                	cmp    (%rsi),%al
+  8010c3:	75 1a                	jne    8010df <strncmp+0x2a>
+  8010c5:	48 83 c7 01          	add    $0x1,%rdi
+  8010c9:	48 83 c6 01          	add    $0x1,%rsi
+  8010cd:	48 83 ea 01          	sub    $0x1,%rdx
+  8010d1:	75 e7                	jne    8010ba <strncmp+0x5>
+
+    if (!n) return 0;
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d8:	c3                   	ret
+  8010d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010de:	c3                   	ret
+  8010df:	48 85 d2             	test   %rdx,%rdx
+  8010e2:	74 09                	je     8010ed <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010e4:	0f b6 07             	movzbl (%rdi),%eax
+  8010e7:	0f b6 16             	movzbl (%rsi),%edx
+  8010ea:	29 d0                	sub    %edx,%eax
+  8010ec:	c3                   	ret
+    if (!n) return 0;
+  8010ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f2:	c3                   	ret
+
+00000000008010f3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010f3:	0f b6 17             	movzbl (%rdi),%edx
+  8010f6:	84 d2                	test   %dl,%dl
+  8010f8:	74 18                	je     801112 <strchr+0x1f>
+        if (*str == c) {
+  8010fa:	0f be d2             	movsbl %dl,%edx
+  8010fd:	39 f2                	cmp    %esi,%edx
+  8010ff:	74 17                	je     801118 <strchr+0x25>
+    for (; *str; str++) {
+  801101:	48 83 c7 01          	add    $0x1,%rdi
+  801105:	0f b6 17             	movzbl (%rdi),%edx
+  801108:	84 d2                	test   %dl,%dl
+  80110a:	75 ee                	jne    8010fa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80110c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801111:	c3                   	ret
+  801112:	b8 00 00 00 00       	mov    $0x0,%eax
+  801117:	c3                   	ret
+  801118:	48 89 f8             	mov    %rdi,%rax
+}
+  80111b:	c3                   	ret
+
+000000000080111c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80111c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80111f:	0f b6 17             	movzbl (%rdi),%edx
+  801122:	84 d2                	test   %dl,%dl
+  801124:	74 13                	je     801139 <strfind+0x1d>
+  801126:	0f be d2             	movsbl %dl,%edx
+  801129:	39 f2                	cmp    %esi,%edx
+  80112b:	74 0b                	je     801138 <strfind+0x1c>
+  80112d:	48 83 c0 01          	add    $0x1,%rax
+  801131:	0f b6 10             	movzbl (%rax),%edx
+  801134:	84 d2                	test   %dl,%dl
+  801136:	75 ee                	jne    801126 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801138:	c3                   	ret
+  801139:	c3                   	ret
+
+000000000080113a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80113a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80113d:	48 89 f8             	mov    %rdi,%rax
+  801140:	48 f7 d8             	neg    %rax
+  801143:	83 e0 07             	and    $0x7,%eax
+  801146:	49 89 d1             	mov    %rdx,%r9
+  801149:	49 29 c1             	sub    %rax,%r9
+  80114c:	78 36                	js     801184 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80114e:	40 0f b6 c6          	movzbl %sil,%eax
+  801152:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801159:	01 01 01 
+  80115c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801160:	40 f6 c7 07          	test   $0x7,%dil
+  801164:	75 38                	jne    80119e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801166:	4c 89 c9             	mov    %r9,%rcx
+  801169:	48 c1 f9 03          	sar    $0x3,%rcx
+  80116d:	74 0c                	je     80117b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80116f:	fc                   	cld
+  801170:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801173:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801177:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80117b:	4d 85 c9             	test   %r9,%r9
+  80117e:	75 45                	jne    8011c5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801180:	4c 89 c0             	mov    %r8,%rax
+  801183:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801184:	48 85 d2             	test   %rdx,%rdx
+  801187:	74 f7                	je     801180 <memset+0x46>
+  801189:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80118c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80118f:	48 83 c0 01          	add    $0x1,%rax
+  801193:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801197:	48 39 c2             	cmp    %rax,%rdx
+  80119a:	75 f3                	jne    80118f <memset+0x55>
+  80119c:	eb e2                	jmp    801180 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80119e:	40 f6 c7 01          	test   $0x1,%dil
+  8011a2:	74 06                	je     8011aa <memset+0x70>
+  8011a4:	88 07                	mov    %al,(%rdi)
+  8011a6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011aa:	40 f6 c7 02          	test   $0x2,%dil
+  8011ae:	74 07                	je     8011b7 <memset+0x7d>
+  8011b0:	66 89 07             	mov    %ax,(%rdi)
+  8011b3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011b7:	40 f6 c7 04          	test   $0x4,%dil
+  8011bb:	74 a9                	je     801166 <memset+0x2c>
+  8011bd:	89 07                	mov    %eax,(%rdi)
+  8011bf:	48 83 c7 04          	add    $0x4,%rdi
+  8011c3:	eb a1                	jmp    801166 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011c5:	41 f6 c1 04          	test   $0x4,%r9b
+  8011c9:	74 06                	je     8011d1 <memset+0x97>
+  8011cb:	89 07                	mov    %eax,(%rdi)
+  8011cd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011d1:	41 f6 c1 02          	test   $0x2,%r9b
+  8011d5:	74 07                	je     8011de <memset+0xa4>
+  8011d7:	66 89 07             	mov    %ax,(%rdi)
+  8011da:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011de:	41 f6 c1 01          	test   $0x1,%r9b
+  8011e2:	74 9c                	je     801180 <memset+0x46>
+  8011e4:	88 07                	mov    %al,(%rdi)
+  8011e6:	eb 98                	jmp    801180 <memset+0x46>
+
+00000000008011e8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011e8:	48 89 f8             	mov    %rdi,%rax
+  8011eb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011ee:	48 39 fe             	cmp    %rdi,%rsi
+  8011f1:	73 3b                	jae    80122e <memmove+0x46>
+  8011f3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011f7:	48 39 d7             	cmp    %rdx,%rdi
+  8011fa:	73 32                	jae    80122e <memmove+0x46>
+        s += n;
+        d += n;
+  8011fc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801200:	48 89 d6             	mov    %rdx,%rsi
+  801203:	48 09 fe             	or     %rdi,%rsi
+  801206:	48 09 ce             	or     %rcx,%rsi
+  801209:	40 f6 c6 07          	test   $0x7,%sil
+  80120d:	75 12                	jne    801221 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80120f:	48 83 ef 08          	sub    $0x8,%rdi
+  801213:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801217:	48 c1 e9 03          	shr    $0x3,%rcx
+  80121b:	fd                   	std
+  80121c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80121f:	fc                   	cld
+  801220:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801221:	48 83 ef 01          	sub    $0x1,%rdi
+  801225:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801229:	fd                   	std
+  80122a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80122c:	eb f1                	jmp    80121f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80122e:	48 89 f2             	mov    %rsi,%rdx
+  801231:	48 09 c2             	or     %rax,%rdx
+  801234:	48 09 ca             	or     %rcx,%rdx
+  801237:	f6 c2 07             	test   $0x7,%dl
+  80123a:	75 0c                	jne    801248 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80123c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801240:	48 89 c7             	mov    %rax,%rdi
+  801243:	fc                   	cld
+  801244:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801247:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801248:	48 89 c7             	mov    %rax,%rdi
+  80124b:	fc                   	cld
+  80124c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80124e:	c3                   	ret
+
+000000000080124f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80124f:	55                   	push   %rbp
+  801250:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801253:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80125a:	00 00 00 
+  80125d:	ff d0                	call   *%rax
+}
+  80125f:	5d                   	pop    %rbp
+  801260:	c3                   	ret
+
+0000000000801261 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	41 57                	push   %r15
+  801267:	41 56                	push   %r14
+  801269:	41 55                	push   %r13
+  80126b:	41 54                	push   %r12
+  80126d:	53                   	push   %rbx
+  80126e:	48 83 ec 08          	sub    $0x8,%rsp
+  801272:	49 89 fe             	mov    %rdi,%r14
+  801275:	49 89 f7             	mov    %rsi,%r15
+  801278:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80127b:	48 89 f7             	mov    %rsi,%rdi
+  80127e:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  801285:	00 00 00 
+  801288:	ff d0                	call   *%rax
+  80128a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80128d:	48 89 de             	mov    %rbx,%rsi
+  801290:	4c 89 f7             	mov    %r14,%rdi
+  801293:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  80129a:	00 00 00 
+  80129d:	ff d0                	call   *%rax
+  80129f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012a2:	48 39 c3             	cmp    %rax,%rbx
+  8012a5:	74 36                	je     8012dd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012a7:	48 89 d8             	mov    %rbx,%rax
+  8012aa:	4c 29 e8             	sub    %r13,%rax
+  8012ad:	49 39 c4             	cmp    %rax,%r12
+  8012b0:	73 31                	jae    8012e3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012b2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012b7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012bb:	4c 89 fe             	mov    %r15,%rsi
+  8012be:	48 b8 4f 12 80 00 00 	movabs $0x80124f,%rax
+  8012c5:	00 00 00 
+  8012c8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012ca:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012ce:	48 83 c4 08          	add    $0x8,%rsp
+  8012d2:	5b                   	pop    %rbx
+  8012d3:	41 5c                	pop    %r12
+  8012d5:	41 5d                	pop    %r13
+  8012d7:	41 5e                	pop    %r14
+  8012d9:	41 5f                	pop    %r15
+  8012db:	5d                   	pop    %rbp
+  8012dc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012dd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012e1:	eb eb                	jmp    8012ce <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012e3:	48 83 eb 01          	sub    $0x1,%rbx
+  8012e7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012eb:	48 89 da             	mov    %rbx,%rdx
+  8012ee:	4c 89 fe             	mov    %r15,%rsi
+  8012f1:	48 b8 4f 12 80 00 00 	movabs $0x80124f,%rax
+  8012f8:	00 00 00 
+  8012fb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012fd:	49 01 de             	add    %rbx,%r14
+  801300:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801305:	eb c3                	jmp    8012ca <strlcat+0x69>
+
+0000000000801307 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801307:	48 85 d2             	test   %rdx,%rdx
+  80130a:	74 2d                	je     801339 <memcmp+0x32>
+  80130c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801311:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801315:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80131a:	44 38 c1             	cmp    %r8b,%cl
+  80131d:	75 0f                	jne    80132e <memcmp+0x27>
+    while (n-- > 0) {
+  80131f:	48 83 c0 01          	add    $0x1,%rax
+  801323:	48 39 c2             	cmp    %rax,%rdx
+  801326:	75 e9                	jne    801311 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80132e:	0f b6 c1             	movzbl %cl,%eax
+  801331:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801335:	44 29 c0             	sub    %r8d,%eax
+  801338:	c3                   	ret
+    return 0;
+  801339:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133e:	c3                   	ret
+
+000000000080133f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80133f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801343:	48 39 c7             	cmp    %rax,%rdi
+  801346:	73 0f                	jae    801357 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801348:	40 38 37             	cmp    %sil,(%rdi)
+  80134b:	74 0e                	je     80135b <memfind+0x1c>
+    for (; src < end; src++) {
+  80134d:	48 83 c7 01          	add    $0x1,%rdi
+  801351:	48 39 f8             	cmp    %rdi,%rax
+  801354:	75 f2                	jne    801348 <memfind+0x9>
+  801356:	c3                   	ret
+  801357:	48 89 f8             	mov    %rdi,%rax
+  80135a:	c3                   	ret
+  80135b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80135e:	c3                   	ret
+
+000000000080135f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80135f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801362:	0f b6 37             	movzbl (%rdi),%esi
+  801365:	40 80 fe 20          	cmp    $0x20,%sil
+  801369:	74 06                	je     801371 <strtol+0x12>
+  80136b:	40 80 fe 09          	cmp    $0x9,%sil
+  80136f:	75 13                	jne    801384 <strtol+0x25>
+  801371:	48 83 c7 01          	add    $0x1,%rdi
+  801375:	0f b6 37             	movzbl (%rdi),%esi
+  801378:	40 80 fe 20          	cmp    $0x20,%sil
+  80137c:	74 f3                	je     801371 <strtol+0x12>
+  80137e:	40 80 fe 09          	cmp    $0x9,%sil
+  801382:	74 ed                	je     801371 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801384:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801387:	83 e0 fd             	and    $0xfffffffd,%eax
+  80138a:	3c 01                	cmp    $0x1,%al
+  80138c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801390:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801396:	75 0f                	jne    8013a7 <strtol+0x48>
+  801398:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80139b:	74 14                	je     8013b1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80139d:	85 d2                	test   %edx,%edx
+  80139f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013a4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013a7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013ac:	4c 63 ca             	movslq %edx,%r9
+  8013af:	eb 36                	jmp    8013e7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013b1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013b5:	74 0f                	je     8013c6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013b7:	85 d2                	test   %edx,%edx
+  8013b9:	75 ec                	jne    8013a7 <strtol+0x48>
+        s++;
+  8013bb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013bf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013c4:	eb e1                	jmp    8013a7 <strtol+0x48>
+        s += 2;
+  8013c6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013ca:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013cf:	eb d6                	jmp    8013a7 <strtol+0x48>
+            dig -= '0';
+  8013d1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013d4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013d8:	41 39 d0             	cmp    %edx,%r8d
+  8013db:	7d 21                	jge    8013fe <strtol+0x9f>
+        val = val * base + dig;
+  8013dd:	49 0f af c1          	imul   %r9,%rax
+  8013e1:	0f b6 c9             	movzbl %cl,%ecx
+  8013e4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013e7:	48 83 c7 01          	add    $0x1,%rdi
+  8013eb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013ef:	80 f9 39             	cmp    $0x39,%cl
+  8013f2:	76 dd                	jbe    8013d1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013f4:	80 f9 7b             	cmp    $0x7b,%cl
+  8013f7:	77 05                	ja     8013fe <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013f9:	83 e9 57             	sub    $0x57,%ecx
+  8013fc:	eb d6                	jmp    8013d4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013fe:	4d 85 d2             	test   %r10,%r10
+  801401:	74 03                	je     801406 <strtol+0xa7>
+  801403:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801406:	48 89 c2             	mov    %rax,%rdx
+  801409:	48 f7 da             	neg    %rdx
+  80140c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801410:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801414:	c3                   	ret
+
+0000000000801415 <strrev>:
+
+void
+strrev(char *str)
+{
+  801415:	55                   	push   %rbp
+  801416:	48 89 e5             	mov    %rsp,%rbp
+  801419:	53                   	push   %rbx
+  80141a:	48 83 ec 08          	sub    $0x8,%rsp
+  80141e:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801421:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  801428:	00 00 00 
+  80142b:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80142d:	83 e8 01             	sub    $0x1,%eax
+  801430:	85 c0                	test   %eax,%eax
+  801432:	7e 22                	jle    801456 <strrev+0x41>
+  801434:	48 98                	cltq
+  801436:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80143b:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80143f:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801443:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801447:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80144a:	48 83 c2 01          	add    $0x1,%rdx
+  80144e:	48 83 e8 01          	sub    $0x1,%rax
+  801452:	39 c2                	cmp    %eax,%edx
+  801454:	7c e5                	jl     80143b <strrev+0x26>
+	}
+}
+  801456:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145a:	c9                   	leave
+  80145b:	c3                   	ret
+
+000000000080145c <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80145c:	85 d2                	test   %edx,%edx
+  80145e:	0f 84 80 00 00 00    	je     8014e4 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+  801468:	53                   	push   %rbx
+  801469:	48 83 ec 08          	sub    $0x8,%rsp
+  80146d:	49 89 f2             	mov    %rsi,%r10
+  801470:	41 89 d3             	mov    %edx,%r11d
+  801473:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801476:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80147b:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80147e:	eb 20                	jmp    8014a0 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801480:	41 89 f1             	mov    %esi,%r9d
+  801483:	83 c2 30             	add    $0x30,%edx
+  801486:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801489:	89 f8                	mov    %edi,%eax
+  80148b:	99                   	cltd
+  80148c:	f7 f9                	idiv   %ecx
+  80148e:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801490:	85 c0                	test   %eax,%eax
+  801492:	74 2e                	je     8014c2 <itoa+0x66>
+  801494:	83 c6 01             	add    $0x1,%esi
+  801497:	49 83 c0 01          	add    $0x1,%r8
+  80149b:	44 39 cb             	cmp    %r9d,%ebx
+  80149e:	7e 15                	jle    8014b5 <itoa+0x59>
+		digit = sum % base;
+  8014a0:	89 f8                	mov    %edi,%eax
+  8014a2:	99                   	cltd
+  8014a3:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8014a5:	83 fa 09             	cmp    $0x9,%edx
+  8014a8:	7e d6                	jle    801480 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8014aa:	41 89 f1             	mov    %esi,%r9d
+  8014ad:	83 c2 37             	add    $0x37,%edx
+  8014b0:	41 88 10             	mov    %dl,(%r8)
+  8014b3:	eb d4                	jmp    801489 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8014b5:	41 83 eb 01          	sub    $0x1,%r11d
+  8014b9:	45 39 cb             	cmp    %r9d,%r11d
+  8014bc:	75 04                	jne    8014c2 <itoa+0x66>
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	75 28                	jne    8014ea <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8014c2:	4d 63 c9             	movslq %r9d,%r9
+  8014c5:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8014ca:	4c 89 d7             	mov    %r10,%rdi
+  8014cd:	48 b8 15 14 80 00 00 	movabs $0x801415,%rax
+  8014d4:	00 00 00 
+  8014d7:	ff d0                	call   *%rax
+	return 0;
+  8014d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+		return -1;
+  8014e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8014e9:	c3                   	ret
+		return -1;
+  8014ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8014ef:	eb ed                	jmp    8014de <itoa+0x82>
+
+00000000008014f1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	53                   	push   %rbx
+  8014f6:	48 89 fa             	mov    %rdi,%rdx
+  8014f9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801506:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150b:	be 00 00 00 00       	mov    $0x0,%esi
+  801510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801516:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801518:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151c:	c9                   	leave
+  80151d:	c3                   	ret
+
+000000000080151e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80151e:	55                   	push   %rbp
+  80151f:	48 89 e5             	mov    %rsp,%rbp
+  801522:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801523:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801537:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153c:	be 00 00 00 00       	mov    $0x0,%esi
+  801541:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801547:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154d:	c9                   	leave
+  80154e:	c3                   	ret
+
+000000000080154f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80154f:	55                   	push   %rbp
+  801550:	48 89 e5             	mov    %rsp,%rbp
+  801553:	53                   	push   %rbx
+  801554:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801558:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801560:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801565:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156f:	be 00 00 00 00       	mov    $0x0,%esi
+  801574:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157c:	48 85 c0             	test   %rax,%rax
+  80157f:	7f 06                	jg     801587 <sys_env_destroy+0x38>
+}
+  801581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801587:	49 89 c0             	mov    %rax,%r8
+  80158a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80158f:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  801596:	00 00 00 
+  801599:	be 26 00 00 00       	mov    $0x26,%esi
+  80159e:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  8015a5:	00 00 00 
+  8015a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ad:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  8015b4:	00 00 00 
+  8015b7:	41 ff d1             	call   *%r9
+
+00000000008015ba <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015ba:	55                   	push   %rbp
+  8015bb:	48 89 e5             	mov    %rsp,%rbp
+  8015be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bf:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+00000000008015eb <sys_yield>:
+
+void
+sys_yield(void) {
+  8015eb:	55                   	push   %rbp
+  8015ec:	48 89 e5             	mov    %rsp,%rbp
+  8015ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801604:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801609:	be 00 00 00 00       	mov    $0x0,%esi
+  80160e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801614:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801616:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+
+000000000080161c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80161c:	55                   	push   %rbp
+  80161d:	48 89 e5             	mov    %rsp,%rbp
+  801620:	53                   	push   %rbx
+  801621:	48 89 fa             	mov    %rdi,%rdx
+  801624:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801627:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801633:	00 00 00 
+  801636:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163b:	be 00 00 00 00       	mov    $0x0,%esi
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801646:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801648:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164c:	c9                   	leave
+  80164d:	c3                   	ret
+
+000000000080164e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	53                   	push   %rbx
+  801653:	49 89 f8             	mov    %rdi,%r8
+  801656:	48 89 d3             	mov    %rdx,%rbx
+  801659:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80165c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801661:	4c 89 c2             	mov    %r8,%rdx
+  801664:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801667:	be 00 00 00 00       	mov    $0x0,%esi
+  80166c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801672:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801674:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801678:	c9                   	leave
+  801679:	c3                   	ret
+
+000000000080167a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	53                   	push   %rbx
+  80167f:	48 83 ec 08          	sub    $0x8,%rsp
+  801683:	89 f8                	mov    %edi,%eax
+  801685:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801688:	48 63 f9             	movslq %ecx,%rdi
+  80168b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80168e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801693:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801696:	be 00 00 00 00       	mov    $0x0,%esi
+  80169b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a3:	48 85 c0             	test   %rax,%rax
+  8016a6:	7f 06                	jg     8016ae <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ac:	c9                   	leave
+  8016ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ae:	49 89 c0             	mov    %rax,%r8
+  8016b1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016b6:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  8016bd:	00 00 00 
+  8016c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c5:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  8016cc:	00 00 00 
+  8016cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d4:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  8016db:	00 00 00 
+  8016de:	41 ff d1             	call   *%r9
+
+00000000008016e1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016e1:	55                   	push   %rbp
+  8016e2:	48 89 e5             	mov    %rsp,%rbp
+  8016e5:	53                   	push   %rbx
+  8016e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ea:	89 f8                	mov    %edi,%eax
+  8016ec:	49 89 f2             	mov    %rsi,%r10
+  8016ef:	48 89 cf             	mov    %rcx,%rdi
+  8016f2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016f5:	48 63 da             	movslq %edx,%rbx
+  8016f8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801700:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801703:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801706:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801708:	48 85 c0             	test   %rax,%rax
+  80170b:	7f 06                	jg     801713 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80170d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801713:	49 89 c0             	mov    %rax,%r8
+  801716:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80171b:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  801722:	00 00 00 
+  801725:	be 26 00 00 00       	mov    $0x26,%esi
+  80172a:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  801731:	00 00 00 
+  801734:	b8 00 00 00 00       	mov    $0x0,%eax
+  801739:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  801740:	00 00 00 
+  801743:	41 ff d1             	call   *%r9
+
+0000000000801746 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+  80174b:	48 83 ec 08          	sub    $0x8,%rsp
+  80174f:	48 89 f1             	mov    %rsi,%rcx
+  801752:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801755:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801758:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801762:	be 00 00 00 00       	mov    $0x0,%esi
+  801767:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176f:	48 85 c0             	test   %rax,%rax
+  801772:	7f 06                	jg     80177a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801774:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801778:	c9                   	leave
+  801779:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177a:	49 89 c0             	mov    %rax,%r8
+  80177d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801782:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  801789:	00 00 00 
+  80178c:	be 26 00 00 00       	mov    $0x26,%esi
+  801791:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  801798:	00 00 00 
+  80179b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a0:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  8017a7:	00 00 00 
+  8017aa:	41 ff d1             	call   *%r9
+
+00000000008017ad <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	53                   	push   %rbx
+  8017b2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017b6:	48 63 ce             	movslq %esi,%rcx
+  8017b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bc:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d8:	48 85 c0             	test   %rax,%rax
+  8017db:	7f 06                	jg     8017e3 <sys_env_set_status+0x36>
+}
+  8017dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e1:	c9                   	leave
+  8017e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e3:	49 89 c0             	mov    %rax,%r8
+  8017e6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017eb:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  8017f2:	00 00 00 
+  8017f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017fa:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  801801:	00 00 00 
+  801804:	b8 00 00 00 00       	mov    $0x0,%eax
+  801809:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  801810:	00 00 00 
+  801813:	41 ff d1             	call   *%r9
+
+0000000000801816 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801816:	55                   	push   %rbp
+  801817:	48 89 e5             	mov    %rsp,%rbp
+  80181a:	53                   	push   %rbx
+  80181b:	48 83 ec 08          	sub    $0x8,%rsp
+  80181f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801822:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801825:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801834:	be 00 00 00 00       	mov    $0x0,%esi
+  801839:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801841:	48 85 c0             	test   %rax,%rax
+  801844:	7f 06                	jg     80184c <sys_env_set_trapframe+0x36>
+}
+  801846:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184c:	49 89 c0             	mov    %rax,%r8
+  80184f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801854:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  80185b:	00 00 00 
+  80185e:	be 26 00 00 00       	mov    $0x26,%esi
+  801863:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  80186a:	00 00 00 
+  80186d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801872:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  801879:	00 00 00 
+  80187c:	41 ff d1             	call   *%r9
+
+000000000080187f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80187f:	55                   	push   %rbp
+  801880:	48 89 e5             	mov    %rsp,%rbp
+  801883:	53                   	push   %rbx
+  801884:	48 83 ec 08          	sub    $0x8,%rsp
+  801888:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80188b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80188e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801893:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801898:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189d:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018aa:	48 85 c0             	test   %rax,%rax
+  8018ad:	7f 06                	jg     8018b5 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b3:	c9                   	leave
+  8018b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b5:	49 89 c0             	mov    %rax,%r8
+  8018b8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018bd:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  8018c4:	00 00 00 
+  8018c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018cc:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  8018d3:	00 00 00 
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  8018e2:	00 00 00 
+  8018e5:	41 ff d1             	call   *%r9
+
+00000000008018e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018e8:	55                   	push   %rbp
+  8018e9:	48 89 e5             	mov    %rsp,%rbp
+  8018ec:	53                   	push   %rbx
+  8018ed:	89 f8                	mov    %edi,%eax
+  8018ef:	49 89 f1             	mov    %rsi,%r9
+  8018f2:	48 89 d3             	mov    %rdx,%rbx
+  8018f5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018f8:	49 63 f0             	movslq %r8d,%rsi
+  8018fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801903:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801906:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190c:	cd 30                	int    $0x30
+}
+  80190e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+0000000000801914 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	53                   	push   %rbx
+  801919:	48 83 ec 08          	sub    $0x8,%rsp
+  80191d:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801920:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801923:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801928:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801930:	be 00 00 00 00       	mov    $0x0,%esi
+  801935:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193d:	48 85 c0             	test   %rax,%rax
+  801940:	7f 06                	jg     801948 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801942:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801948:	49 89 c0             	mov    %rax,%r8
+  80194b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801950:	48 ba 68 43 80 00 00 	movabs $0x804368,%rdx
+  801957:	00 00 00 
+  80195a:	be 26 00 00 00       	mov    $0x26,%esi
+  80195f:	48 bf 87 43 80 00 00 	movabs $0x804387,%rdi
+  801966:	00 00 00 
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	49 b9 79 05 80 00 00 	movabs $0x800579,%r9
+  801975:	00 00 00 
+  801978:	41 ff d1             	call   *%r9
+
+000000000080197b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80197f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801984:	48 b8 14 19 80 00 00 	movabs $0x801914,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+}
+  801990:	5d                   	pop    %rbp
+  801991:	c3                   	ret
+
+0000000000801992 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801997:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80199c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bb:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+00000000008019c3 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8019c8:	48 63 ce             	movslq %esi,%rcx
+  8019cb:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019de:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e9:	cd 30                	int    $0x30
+}
+  8019eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+
+00000000008019f1 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8019f1:	55                   	push   %rbp
+  8019f2:	48 89 e5             	mov    %rsp,%rbp
+  8019f5:	53                   	push   %rbx
+  8019f6:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8019f9:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019fd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a07:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a17:	cd 30                	int    $0x30
+}
+  801a19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+0000000000801a1f <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	53                   	push   %rbx
+  801a24:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801a27:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a2f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a37:	be 00 00 00 00       	mov    $0x0,%esi
+  801a3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a42:	cd 30                	int    $0x30
+}
+  801a44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+
+0000000000801a4a <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801a4a:	55                   	push   %rbp
+  801a4b:	48 89 e5             	mov    %rsp,%rbp
+  801a4e:	41 54                	push   %r12
+  801a50:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801a51:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a56:	cd 30                	int    $0x30
+  801a58:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	78 7e                	js     801add <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801a5f:	0f 84 80 00 00 00    	je     801ae5 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801a65:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801a6b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801a72:	00 00 00 
+  801a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a7a:	89 c2                	mov    %eax,%edx
+  801a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a86:	48 b8 e1 16 80 00 00 	movabs $0x8016e1,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	0f 88 81 00 00 00    	js     801b1b <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801a9a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801aa1:	00 00 00 
+  801aa4:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801aab:	44 89 e7             	mov    %r12d,%edi
+  801aae:	48 b8 7f 18 80 00 00 	movabs $0x80187f,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 65                	js     801b23 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801abe:	be 02 00 00 00       	mov    $0x2,%esi
+  801ac3:	44 89 e7             	mov    %r12d,%edi
+  801ac6:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801acd:	00 00 00 
+  801ad0:	ff d0                	call   *%rax
+        return -1;
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801ad9:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801add:	44 89 e0             	mov    %r12d,%eax
+  801ae0:	5b                   	pop    %rbx
+  801ae1:	41 5c                	pop    %r12
+  801ae3:	5d                   	pop    %rbp
+  801ae4:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801ae5:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801af6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801afa:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801afe:	48 c1 e0 04          	shl    $0x4,%rax
+  801b02:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b09:	00 00 00 
+  801b0c:	48 01 d0             	add    %rdx,%rax
+  801b0f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  801b16:	00 00 00 
+        return 0;
+  801b19:	eb c2                	jmp    801add <fork+0x93>
+        return -1;
+  801b1b:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b21:	eb ba                	jmp    801add <fork+0x93>
+        return -1;
+  801b23:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b29:	eb b2                	jmp    801add <fork+0x93>
+
+0000000000801b2b <sfork>:
+
+envid_t
+sfork() {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801b2f:	48 ba 95 43 80 00 00 	movabs $0x804395,%rdx
+  801b36:	00 00 00 
+  801b39:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801b3e:	48 bf b0 43 80 00 00 	movabs $0x8043b0,%rdi
+  801b45:	00 00 00 
+  801b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4d:	48 b9 79 05 80 00 00 	movabs $0x800579,%rcx
+  801b54:	00 00 00 
+  801b57:	ff d1                	call   *%rcx
+
+0000000000801b59 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b59:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b60:	ff ff ff 
+  801b63:	48 01 f8             	add    %rdi,%rax
+  801b66:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b6a:	c3                   	ret
+
+0000000000801b6b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b6b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b72:	ff ff ff 
+  801b75:	48 01 f8             	add    %rdi,%rax
+  801b78:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b7c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b82:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b86:	c3                   	ret
+
+0000000000801b87 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b87:	55                   	push   %rbp
+  801b88:	48 89 e5             	mov    %rsp,%rbp
+  801b8b:	41 57                	push   %r15
+  801b8d:	41 56                	push   %r14
+  801b8f:	41 55                	push   %r13
+  801b91:	41 54                	push   %r12
+  801b93:	53                   	push   %rbx
+  801b94:	48 83 ec 08          	sub    $0x8,%rsp
+  801b98:	49 89 ff             	mov    %rdi,%r15
+  801b9b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ba0:	49 bd 69 37 80 00 00 	movabs $0x803769,%r13
+  801ba7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801baa:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bb0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bb3:	48 89 df             	mov    %rbx,%rdi
+  801bb6:	41 ff d5             	call   *%r13
+  801bb9:	83 e0 04             	and    $0x4,%eax
+  801bbc:	74 17                	je     801bd5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bbe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bc5:	4c 39 f3             	cmp    %r14,%rbx
+  801bc8:	75 e6                	jne    801bb0 <fd_alloc+0x29>
+  801bca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bd0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bd5:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bd8:	48 83 c4 08          	add    $0x8,%rsp
+  801bdc:	5b                   	pop    %rbx
+  801bdd:	41 5c                	pop    %r12
+  801bdf:	41 5d                	pop    %r13
+  801be1:	41 5e                	pop    %r14
+  801be3:	41 5f                	pop    %r15
+  801be5:	5d                   	pop    %rbp
+  801be6:	c3                   	ret
+
+0000000000801be7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801be7:	83 ff 1f             	cmp    $0x1f,%edi
+  801bea:	77 39                	ja     801c25 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bec:	55                   	push   %rbp
+  801bed:	48 89 e5             	mov    %rsp,%rbp
+  801bf0:	41 54                	push   %r12
+  801bf2:	53                   	push   %rbx
+  801bf3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bf6:	48 63 df             	movslq %edi,%rbx
+  801bf9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c00:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c04:	48 89 df             	mov    %rbx,%rdi
+  801c07:	48 b8 69 37 80 00 00 	movabs $0x803769,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+  801c13:	a8 04                	test   $0x4,%al
+  801c15:	74 14                	je     801c2b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c17:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c20:	5b                   	pop    %rbx
+  801c21:	41 5c                	pop    %r12
+  801c23:	5d                   	pop    %rbp
+  801c24:	c3                   	ret
+        return -E_INVAL;
+  801c25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c2a:	c3                   	ret
+        return -E_INVAL;
+  801c2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c30:	eb ee                	jmp    801c20 <fd_lookup+0x39>
+
+0000000000801c32 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c32:	55                   	push   %rbp
+  801c33:	48 89 e5             	mov    %rsp,%rbp
+  801c36:	41 54                	push   %r12
+  801c38:	53                   	push   %rbx
+  801c39:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c3c:	48 b8 60 44 80 00 00 	movabs $0x804460,%rax
+  801c43:	00 00 00 
+  801c46:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801c4d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c50:	39 3b                	cmp    %edi,(%rbx)
+  801c52:	74 47                	je     801c9b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c54:	48 83 c0 08          	add    $0x8,%rax
+  801c58:	48 8b 18             	mov    (%rax),%rbx
+  801c5b:	48 85 db             	test   %rbx,%rbx
+  801c5e:	75 f0                	jne    801c50 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c60:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c67:	00 00 00 
+  801c6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c70:	89 fa                	mov    %edi,%edx
+  801c72:	48 bf c0 43 80 00 00 	movabs $0x8043c0,%rdi
+  801c79:	00 00 00 
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  801c88:	00 00 00 
+  801c8b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c92:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c96:	5b                   	pop    %rbx
+  801c97:	41 5c                	pop    %r12
+  801c99:	5d                   	pop    %rbp
+  801c9a:	c3                   	ret
+            return 0;
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca0:	eb f0                	jmp    801c92 <dev_lookup+0x60>
+
+0000000000801ca2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ca2:	55                   	push   %rbp
+  801ca3:	48 89 e5             	mov    %rsp,%rbp
+  801ca6:	41 55                	push   %r13
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 18          	sub    $0x18,%rsp
+  801caf:	48 89 fb             	mov    %rdi,%rbx
+  801cb2:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb5:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cbc:	ff ff ff 
+  801cbf:	48 01 df             	add    %rbx,%rdi
+  801cc2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cc6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cca:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+  801cd6:	41 89 c5             	mov    %eax,%r13d
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 06                	js     801ce3 <fd_close+0x41>
+  801cdd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ce1:	74 1a                	je     801cfd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ce3:	45 84 e4             	test   %r12b,%r12b
+  801ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ceb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cef:	44 89 e8             	mov    %r13d,%eax
+  801cf2:	48 83 c4 18          	add    $0x18,%rsp
+  801cf6:	5b                   	pop    %rbx
+  801cf7:	41 5c                	pop    %r12
+  801cf9:	41 5d                	pop    %r13
+  801cfb:	5d                   	pop    %rbp
+  801cfc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cfd:	8b 3b                	mov    (%rbx),%edi
+  801cff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d03:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  801d0a:	00 00 00 
+  801d0d:	ff d0                	call   *%rax
+  801d0f:	41 89 c5             	mov    %eax,%r13d
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 1b                	js     801d31 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d1a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801d1e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d24:	48 85 c0             	test   %rax,%rax
+  801d27:	74 08                	je     801d31 <fd_close+0x8f>
+  801d29:	48 89 df             	mov    %rbx,%rdi
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d36:	48 89 de             	mov    %rbx,%rsi
+  801d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3e:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+    return res;
+  801d4a:	eb a3                	jmp    801cef <fd_close+0x4d>
+
+0000000000801d4c <close>:
+
+int
+close(int fdnum) {
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d54:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d58:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  801d5f:	00 00 00 
+  801d62:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	78 15                	js     801d7d <close+0x31>
+
+    return fd_close(fd, 1);
+  801d68:	be 01 00 00 00       	mov    $0x1,%esi
+  801d6d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d71:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+0000000000801d7f <close_all>:
+
+void
+close_all(void) {
+  801d7f:	55                   	push   %rbp
+  801d80:	48 89 e5             	mov    %rsp,%rbp
+  801d83:	41 54                	push   %r12
+  801d85:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8b:	49 bc 4c 1d 80 00 00 	movabs $0x801d4c,%r12
+  801d92:	00 00 00 
+  801d95:	89 df                	mov    %ebx,%edi
+  801d97:	41 ff d4             	call   *%r12
+  801d9a:	83 c3 01             	add    $0x1,%ebx
+  801d9d:	83 fb 20             	cmp    $0x20,%ebx
+  801da0:	75 f3                	jne    801d95 <close_all+0x16>
+}
+  801da2:	5b                   	pop    %rbx
+  801da3:	41 5c                	pop    %r12
+  801da5:	5d                   	pop    %rbp
+  801da6:	c3                   	ret
+
+0000000000801da7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801da7:	55                   	push   %rbp
+  801da8:	48 89 e5             	mov    %rsp,%rbp
+  801dab:	41 57                	push   %r15
+  801dad:	41 56                	push   %r14
+  801daf:	41 55                	push   %r13
+  801db1:	41 54                	push   %r12
+  801db3:	53                   	push   %rbx
+  801db4:	48 83 ec 18          	sub    $0x18,%rsp
+  801db8:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dbb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dbf:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	89 c3                	mov    %eax,%ebx
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	0f 88 b8 00 00 00    	js     801e8d <dup+0xe6>
+    close(newfdnum);
+  801dd5:	44 89 e7             	mov    %r12d,%edi
+  801dd8:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801de4:	4d 63 ec             	movslq %r12d,%r13
+  801de7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801dee:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801df2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801df6:	4c 89 ff             	mov    %r15,%rdi
+  801df9:	49 be 6b 1b 80 00 00 	movabs $0x801b6b,%r14
+  801e00:	00 00 00 
+  801e03:	41 ff d6             	call   *%r14
+  801e06:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e09:	4c 89 ef             	mov    %r13,%rdi
+  801e0c:	41 ff d6             	call   *%r14
+  801e0f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e12:	48 89 df             	mov    %rbx,%rdi
+  801e15:	48 b8 69 37 80 00 00 	movabs $0x803769,%rax
+  801e1c:	00 00 00 
+  801e1f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e21:	a8 04                	test   $0x4,%al
+  801e23:	74 2b                	je     801e50 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e25:	41 89 c1             	mov    %eax,%r9d
+  801e28:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e2e:	4c 89 f1             	mov    %r14,%rcx
+  801e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e36:	48 89 de             	mov    %rbx,%rsi
+  801e39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3e:	48 b8 e1 16 80 00 00 	movabs $0x8016e1,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+  801e4a:	89 c3                	mov    %eax,%ebx
+  801e4c:	85 c0                	test   %eax,%eax
+  801e4e:	78 4e                	js     801e9e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e50:	4c 89 ff             	mov    %r15,%rdi
+  801e53:	48 b8 69 37 80 00 00 	movabs $0x803769,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+  801e5f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e62:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e68:	4c 89 e9             	mov    %r13,%rcx
+  801e6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e70:	4c 89 fe             	mov    %r15,%rsi
+  801e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e78:	48 b8 e1 16 80 00 00 	movabs $0x8016e1,%rax
+  801e7f:	00 00 00 
+  801e82:	ff d0                	call   *%rax
+  801e84:	89 c3                	mov    %eax,%ebx
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 14                	js     801e9e <dup+0xf7>
+
+    return newfdnum;
+  801e8a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e8d:	89 d8                	mov    %ebx,%eax
+  801e8f:	48 83 c4 18          	add    $0x18,%rsp
+  801e93:	5b                   	pop    %rbx
+  801e94:	41 5c                	pop    %r12
+  801e96:	41 5d                	pop    %r13
+  801e98:	41 5e                	pop    %r14
+  801e9a:	41 5f                	pop    %r15
+  801e9c:	5d                   	pop    %rbp
+  801e9d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ea3:	4c 89 ee             	mov    %r13,%rsi
+  801ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eab:	49 bc 46 17 80 00 00 	movabs $0x801746,%r12
+  801eb2:	00 00 00 
+  801eb5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801eb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ebd:	4c 89 f6             	mov    %r14,%rsi
+  801ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec5:	41 ff d4             	call   *%r12
+    return res;
+  801ec8:	eb c3                	jmp    801e8d <dup+0xe6>
+
+0000000000801eca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801eca:	55                   	push   %rbp
+  801ecb:	48 89 e5             	mov    %rsp,%rbp
+  801ece:	41 56                	push   %r14
+  801ed0:	41 55                	push   %r13
+  801ed2:	41 54                	push   %r12
+  801ed4:	53                   	push   %rbx
+  801ed5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed9:	89 fb                	mov    %edi,%ebx
+  801edb:	49 89 f4             	mov    %rsi,%r12
+  801ede:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ee5:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 4c                	js     801f41 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ef9:	41 8b 3e             	mov    (%r14),%edi
+  801efc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f00:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  801f07:	00 00 00 
+  801f0a:	ff d0                	call   *%rax
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 35                	js     801f45 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f10:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f14:	83 e0 03             	and    $0x3,%eax
+  801f17:	83 f8 01             	cmp    $0x1,%eax
+  801f1a:	74 2d                	je     801f49 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f20:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f24:	48 85 c0             	test   %rax,%rax
+  801f27:	74 56                	je     801f7f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f29:	4c 89 ea             	mov    %r13,%rdx
+  801f2c:	4c 89 e6             	mov    %r12,%rsi
+  801f2f:	4c 89 f7             	mov    %r14,%rdi
+  801f32:	ff d0                	call   *%rax
+}
+  801f34:	48 83 c4 10          	add    $0x10,%rsp
+  801f38:	5b                   	pop    %rbx
+  801f39:	41 5c                	pop    %r12
+  801f3b:	41 5d                	pop    %r13
+  801f3d:	41 5e                	pop    %r14
+  801f3f:	5d                   	pop    %rbp
+  801f40:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f41:	48 98                	cltq
+  801f43:	eb ef                	jmp    801f34 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f45:	48 98                	cltq
+  801f47:	eb eb                	jmp    801f34 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f49:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f50:	00 00 00 
+  801f53:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f59:	89 da                	mov    %ebx,%edx
+  801f5b:	48 bf 21 44 80 00 00 	movabs $0x804421,%rdi
+  801f62:	00 00 00 
+  801f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6a:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  801f71:	00 00 00 
+  801f74:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f76:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f7d:	eb b5                	jmp    801f34 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f7f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f86:	eb ac                	jmp    801f34 <read+0x6a>
+
+0000000000801f88 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801f88:	55                   	push   %rbp
+  801f89:	48 89 e5             	mov    %rsp,%rbp
+  801f8c:	41 56                	push   %r14
+  801f8e:	41 55                	push   %r13
+  801f90:	41 54                	push   %r12
+  801f92:	53                   	push   %rbx
+  801f93:	48 83 ec 10          	sub    $0x10,%rsp
+  801f97:	89 fb                	mov    %edi,%ebx
+  801f99:	49 89 f4             	mov    %rsi,%r12
+  801f9c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f9f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa3:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 41                	js     801ff4 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fb7:	41 8b 3e             	mov    (%r14),%edi
+  801fba:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fbe:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 35                	js     802003 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fce:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fd2:	83 e0 03             	and    $0x3,%eax
+  801fd5:	83 f8 01             	cmp    $0x1,%eax
+  801fd8:	74 2d                	je     802007 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801fda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fde:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fe2:	48 85 c0             	test   %rax,%rax
+  801fe5:	74 56                	je     80203d <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801fe7:	4c 89 ea             	mov    %r13,%rdx
+  801fea:	4c 89 e6             	mov    %r12,%rsi
+  801fed:	4c 89 f7             	mov    %r14,%rdi
+  801ff0:	ff d0                	call   *%rax
+  801ff2:	eb 02                	jmp    801ff6 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff4:	48 98                	cltq
+}
+  801ff6:	48 83 c4 10          	add    $0x10,%rsp
+  801ffa:	5b                   	pop    %rbx
+  801ffb:	41 5c                	pop    %r12
+  801ffd:	41 5d                	pop    %r13
+  801fff:	41 5e                	pop    %r14
+  802001:	5d                   	pop    %rbp
+  802002:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802003:	48 98                	cltq
+  802005:	eb ef                	jmp    801ff6 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  802007:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80200e:	00 00 00 
+  802011:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802017:	89 da                	mov    %ebx,%edx
+  802019:	48 bf e0 43 80 00 00 	movabs $0x8043e0,%rdi
+  802020:	00 00 00 
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+  802028:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  80202f:	00 00 00 
+  802032:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802034:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80203b:	eb b9                	jmp    801ff6 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  80203d:	4c 89 ea             	mov    %r13,%rdx
+  802040:	4c 89 e6             	mov    %r12,%rsi
+  802043:	89 df                	mov    %ebx,%edi
+  802045:	48 b8 ca 1e 80 00 00 	movabs $0x801eca,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	eb a3                	jmp    801ff6 <readmap+0x6e>
+
+0000000000802053 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802053:	55                   	push   %rbp
+  802054:	48 89 e5             	mov    %rsp,%rbp
+  802057:	41 57                	push   %r15
+  802059:	41 56                	push   %r14
+  80205b:	41 55                	push   %r13
+  80205d:	41 54                	push   %r12
+  80205f:	53                   	push   %rbx
+  802060:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802064:	48 85 d2             	test   %rdx,%rdx
+  802067:	74 54                	je     8020bd <readn+0x6a>
+  802069:	41 89 fd             	mov    %edi,%r13d
+  80206c:	49 89 f6             	mov    %rsi,%r14
+  80206f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802072:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802077:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80207c:	49 bf ca 1e 80 00 00 	movabs $0x801eca,%r15
+  802083:	00 00 00 
+  802086:	4c 89 e2             	mov    %r12,%rdx
+  802089:	48 29 f2             	sub    %rsi,%rdx
+  80208c:	4c 01 f6             	add    %r14,%rsi
+  80208f:	44 89 ef             	mov    %r13d,%edi
+  802092:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 20                	js     8020b9 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802099:	01 c3                	add    %eax,%ebx
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	74 08                	je     8020a7 <readn+0x54>
+  80209f:	48 63 f3             	movslq %ebx,%rsi
+  8020a2:	4c 39 e6             	cmp    %r12,%rsi
+  8020a5:	72 df                	jb     802086 <readn+0x33>
+    }
+    return res;
+  8020a7:	48 63 c3             	movslq %ebx,%rax
+}
+  8020aa:	48 83 c4 08          	add    $0x8,%rsp
+  8020ae:	5b                   	pop    %rbx
+  8020af:	41 5c                	pop    %r12
+  8020b1:	41 5d                	pop    %r13
+  8020b3:	41 5e                	pop    %r14
+  8020b5:	41 5f                	pop    %r15
+  8020b7:	5d                   	pop    %rbp
+  8020b8:	c3                   	ret
+        if (inc < 0) return inc;
+  8020b9:	48 98                	cltq
+  8020bb:	eb ed                	jmp    8020aa <readn+0x57>
+    int inc = 1, res = 0;
+  8020bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c2:	eb e3                	jmp    8020a7 <readn+0x54>
+
+00000000008020c4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	41 56                	push   %r14
+  8020ca:	41 55                	push   %r13
+  8020cc:	41 54                	push   %r12
+  8020ce:	53                   	push   %rbx
+  8020cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d3:	89 fb                	mov    %edi,%ebx
+  8020d5:	49 89 f4             	mov    %rsi,%r12
+  8020d8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020db:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020df:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 47                	js     802136 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ef:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020f3:	41 8b 3e             	mov    (%r14),%edi
+  8020f6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020fa:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	85 c0                	test   %eax,%eax
+  802108:	78 30                	js     80213a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80210a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80210f:	74 2d                	je     80213e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802111:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802115:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802119:	48 85 c0             	test   %rax,%rax
+  80211c:	74 56                	je     802174 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80211e:	4c 89 ea             	mov    %r13,%rdx
+  802121:	4c 89 e6             	mov    %r12,%rsi
+  802124:	4c 89 f7             	mov    %r14,%rdi
+  802127:	ff d0                	call   *%rax
+}
+  802129:	48 83 c4 10          	add    $0x10,%rsp
+  80212d:	5b                   	pop    %rbx
+  80212e:	41 5c                	pop    %r12
+  802130:	41 5d                	pop    %r13
+  802132:	41 5e                	pop    %r14
+  802134:	5d                   	pop    %rbp
+  802135:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802136:	48 98                	cltq
+  802138:	eb ef                	jmp    802129 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80213a:	48 98                	cltq
+  80213c:	eb eb                	jmp    802129 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80213e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802145:	00 00 00 
+  802148:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80214e:	89 da                	mov    %ebx,%edx
+  802150:	48 bf 3d 44 80 00 00 	movabs $0x80443d,%rdi
+  802157:	00 00 00 
+  80215a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215f:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  802166:	00 00 00 
+  802169:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80216b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802172:	eb b5                	jmp    802129 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802174:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80217b:	eb ac                	jmp    802129 <write+0x65>
+
+000000000080217d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80217d:	55                   	push   %rbp
+  80217e:	48 89 e5             	mov    %rsp,%rbp
+  802181:	53                   	push   %rbx
+  802182:	48 83 ec 18          	sub    $0x18,%rsp
+  802186:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802188:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80218c:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+  802198:	85 c0                	test   %eax,%eax
+  80219a:	78 0c                	js     8021a8 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80219c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021ac:	c9                   	leave
+  8021ad:	c3                   	ret
+
+00000000008021ae <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021ae:	55                   	push   %rbp
+  8021af:	48 89 e5             	mov    %rsp,%rbp
+  8021b2:	41 55                	push   %r13
+  8021b4:	41 54                	push   %r12
+  8021b6:	53                   	push   %rbx
+  8021b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8021bb:	89 fb                	mov    %edi,%ebx
+  8021bd:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021c4:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	78 38                	js     80220c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021d4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021d8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021dc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021e0:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 1c                	js     80220c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021f0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021f5:	74 20                	je     802217 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021fb:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8021ff:	48 85 c0             	test   %rax,%rax
+  802202:	74 47                	je     80224b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802204:	44 89 e6             	mov    %r12d,%esi
+  802207:	4c 89 ef             	mov    %r13,%rdi
+  80220a:	ff d0                	call   *%rax
+}
+  80220c:	48 83 c4 18          	add    $0x18,%rsp
+  802210:	5b                   	pop    %rbx
+  802211:	41 5c                	pop    %r12
+  802213:	41 5d                	pop    %r13
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802217:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80221e:	00 00 00 
+  802221:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802227:	89 da                	mov    %ebx,%edx
+  802229:	48 bf 00 44 80 00 00 	movabs $0x804400,%rdi
+  802230:	00 00 00 
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+  802238:	48 b9 c9 06 80 00 00 	movabs $0x8006c9,%rcx
+  80223f:	00 00 00 
+  802242:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802244:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802249:	eb c1                	jmp    80220c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80224b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802250:	eb ba                	jmp    80220c <ftruncate+0x5e>
+
+0000000000802252 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	41 54                	push   %r12
+  802258:	53                   	push   %rbx
+  802259:	48 83 ec 10          	sub    $0x10,%rsp
+  80225d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802260:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802264:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 4e                	js     8022c2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802274:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802278:	41 8b 3c 24          	mov    (%r12),%edi
+  80227c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802280:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802287:	00 00 00 
+  80228a:	ff d0                	call   *%rax
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	78 32                	js     8022c2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802290:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802294:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802299:	74 30                	je     8022cb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80229b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80229e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022a5:	00 00 00 
+    stat->st_isdir = 0;
+  8022a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022af:	00 00 00 
+    stat->st_dev = dev;
+  8022b2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022b9:	48 89 de             	mov    %rbx,%rsi
+  8022bc:	4c 89 e7             	mov    %r12,%rdi
+  8022bf:	ff 50 30             	call   *0x30(%rax)
+}
+  8022c2:	48 83 c4 10          	add    $0x10,%rsp
+  8022c6:	5b                   	pop    %rbx
+  8022c7:	41 5c                	pop    %r12
+  8022c9:	5d                   	pop    %rbp
+  8022ca:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022cb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022d0:	eb f0                	jmp    8022c2 <fstat+0x70>
+
+00000000008022d2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  8022d6:	41 54                	push   %r12
+  8022d8:	53                   	push   %rbx
+  8022d9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e1:	48 b8 29 30 80 00 00 	movabs $0x803029,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+  8022ed:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 25                	js     802318 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022f3:	4c 89 e6             	mov    %r12,%rsi
+  8022f6:	89 c7                	mov    %eax,%edi
+  8022f8:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+  802304:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802307:	89 df                	mov    %ebx,%edi
+  802309:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+
+    return res;
+  802315:	44 89 e3             	mov    %r12d,%ebx
+}
+  802318:	89 d8                	mov    %ebx,%eax
+  80231a:	5b                   	pop    %rbx
+  80231b:	41 5c                	pop    %r12
+  80231d:	5d                   	pop    %rbp
+  80231e:	c3                   	ret
+
+000000000080231f <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  80231f:	55                   	push   %rbp
+  802320:	48 89 e5             	mov    %rsp,%rbp
+  802323:	41 54                	push   %r12
+  802325:	53                   	push   %rbx
+  802326:	48 83 ec 10          	sub    $0x10,%rsp
+  80232a:	48 89 fb             	mov    %rdi,%rbx
+  80232d:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802330:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802334:	bf 66 00 00 00       	mov    $0x66,%edi
+  802339:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802340:	00 00 00 
+  802343:	ff d0                	call   *%rax
+  802345:	85 c0                	test   %eax,%eax
+  802347:	78 1f                	js     802368 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802349:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80234d:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802351:	48 85 c0             	test   %rax,%rax
+  802354:	74 1b                	je     802371 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802356:	4c 89 e6             	mov    %r12,%rsi
+  802359:	48 89 df             	mov    %rbx,%rdi
+  80235c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	ba 00 00 00 00       	mov    $0x0,%edx
+  802365:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802368:	48 83 c4 10          	add    $0x10,%rsp
+  80236c:	5b                   	pop    %rbx
+  80236d:	41 5c                	pop    %r12
+  80236f:	5d                   	pop    %rbp
+  802370:	c3                   	ret
+        return -E_NOT_SUPP;
+  802371:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802376:	eb f0                	jmp    802368 <create_snapshot+0x49>
+
+0000000000802378 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802378:	55                   	push   %rbp
+  802379:	48 89 e5             	mov    %rsp,%rbp
+  80237c:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802380:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802384:	bf 66 00 00 00       	mov    $0x66,%edi
+  802389:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 1e                	js     8023b7 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802399:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80239d:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8023a1:	48 85 d2             	test   %rdx,%rdx
+  8023a4:	74 13                	je     8023b9 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8023a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ab:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b4:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8023b7:	c9                   	leave
+  8023b8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023b9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023be:	eb f7                	jmp    8023b7 <print_snapshot_list+0x3f>
+
+00000000008023c0 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8023c0:	55                   	push   %rbp
+  8023c1:	48 89 e5             	mov    %rsp,%rbp
+  8023c4:	53                   	push   %rbx
+  8023c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c9:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023cc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023d0:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023d5:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  8023dc:	00 00 00 
+  8023df:	ff d0                	call   *%rax
+  8023e1:	85 c0                	test   %eax,%eax
+  8023e3:	78 1c                	js     802401 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8023e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023e9:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8023ed:	48 85 c0             	test   %rax,%rax
+  8023f0:	74 15                	je     802407 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8023f2:	48 89 df             	mov    %rbx,%rdi
+  8023f5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fe:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802401:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802405:	c9                   	leave
+  802406:	c3                   	ret
+        return -E_NOT_SUPP;
+  802407:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80240c:	eb f3                	jmp    802401 <accept_snapshot+0x41>
+
+000000000080240e <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  80240e:	55                   	push   %rbp
+  80240f:	48 89 e5             	mov    %rsp,%rbp
+  802412:	53                   	push   %rbx
+  802413:	48 83 ec 18          	sub    $0x18,%rsp
+  802417:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80241a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80241e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802423:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	78 1c                	js     80244f <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802433:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802437:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80243b:	48 85 c0             	test   %rax,%rax
+  80243e:	74 15                	je     802455 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802440:	48 89 df             	mov    %rbx,%rdi
+  802443:	ff d0                	call   *%rax
+    if (res < 0) {
+  802445:	85 c0                	test   %eax,%eax
+  802447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244c:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80244f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+        return -E_NOT_SUPP;
+  802455:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80245a:	eb f3                	jmp    80244f <delete_snapshot+0x41>
+
+000000000080245c <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80245c:	55                   	push   %rbp
+  80245d:	48 89 e5             	mov    %rsp,%rbp
+  802460:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802464:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802468:	bf 66 00 00 00       	mov    $0x66,%edi
+  80246d:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 14                	js     802491 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80247d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802481:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802485:	48 85 d2             	test   %rdx,%rdx
+  802488:	74 09                	je     802493 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248f:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+        return -E_NOT_SUPP;
+  802493:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802498:	eb f7                	jmp    802491 <gc_snapshots+0x35>
+
+000000000080249a <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	41 56                	push   %r14
+  8024a0:	41 55                	push   %r13
+  8024a2:	41 54                	push   %r12
+  8024a4:	53                   	push   %rbx
+  8024a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a9:	48 89 fb             	mov    %rdi,%rbx
+  8024ac:	49 89 f4             	mov    %rsi,%r12
+  8024af:	49 89 d5             	mov    %rdx,%r13
+  8024b2:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024b5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024b9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024be:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 1b                	js     8024e9 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8024ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024d2:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8024d6:	48 85 c0             	test   %rax,%rax
+  8024d9:	74 1b                	je     8024f6 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8024db:	4c 89 f1             	mov    %r14,%rcx
+  8024de:	4c 89 ea             	mov    %r13,%rdx
+  8024e1:	4c 89 e6             	mov    %r12,%rsi
+  8024e4:	48 89 df             	mov    %rbx,%rdi
+  8024e7:	ff d0                	call   *%rax
+
+    return res;
+}
+  8024e9:	48 83 c4 10          	add    $0x10,%rsp
+  8024ed:	5b                   	pop    %rbx
+  8024ee:	41 5c                	pop    %r12
+  8024f0:	41 5d                	pop    %r13
+  8024f2:	41 5e                	pop    %r14
+  8024f4:	5d                   	pop    %rbp
+  8024f5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024f6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024fb:	eb ec                	jmp    8024e9 <diff_snapshots+0x4f>
+
+00000000008024fd <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8024fd:	55                   	push   %rbp
+  8024fe:	48 89 e5             	mov    %rsp,%rbp
+  802501:	41 55                	push   %r13
+  802503:	41 54                	push   %r12
+  802505:	53                   	push   %rbx
+  802506:	48 83 ec 18          	sub    $0x18,%rsp
+  80250a:	48 89 fb             	mov    %rdi,%rbx
+  80250d:	49 89 f4             	mov    %rsi,%r12
+  802510:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802513:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802517:	bf 66 00 00 00       	mov    $0x66,%edi
+  80251c:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802523:	00 00 00 
+  802526:	ff d0                	call   *%rax
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	78 18                	js     802544 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  80252c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802530:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802534:	48 85 c0             	test   %rax,%rax
+  802537:	74 16                	je     80254f <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802539:	4c 89 ea             	mov    %r13,%rdx
+  80253c:	4c 89 e6             	mov    %r12,%rsi
+  80253f:	48 89 df             	mov    %rbx,%rdi
+  802542:	ff d0                	call   *%rax
+
+    return res;
+}
+  802544:	48 83 c4 18          	add    $0x18,%rsp
+  802548:	5b                   	pop    %rbx
+  802549:	41 5c                	pop    %r12
+  80254b:	41 5d                	pop    %r13
+  80254d:	5d                   	pop    %rbp
+  80254e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80254f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802554:	eb ee                	jmp    802544 <send_snapshot+0x47>
+
+0000000000802556 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	53                   	push   %rbx
+  80255b:	48 83 ec 18          	sub    $0x18,%rsp
+  80255f:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802562:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802566:	bf 66 00 00 00       	mov    $0x66,%edi
+  80256b:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+  802577:	85 c0                	test   %eax,%eax
+  802579:	78 12                	js     80258d <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80257b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80257f:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802583:	48 85 c0             	test   %rax,%rax
+  802586:	74 0b                	je     802593 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802588:	48 89 df             	mov    %rbx,%rdi
+  80258b:	ff d0                	call   *%rax
+
+    return res;
+}
+  80258d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802591:	c9                   	leave
+  802592:	c3                   	ret
+        return -E_NOT_SUPP;
+  802593:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802598:	eb f3                	jmp    80258d <receive_snapshot+0x37>
+
+000000000080259a <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80259a:	55                   	push   %rbp
+  80259b:	48 89 e5             	mov    %rsp,%rbp
+  80259e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025a2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025a6:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025ab:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 17                	js     8025d2 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8025bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bf:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8025c6:	48 85 d2             	test   %rdx,%rdx
+  8025c9:	74 09                	je     8025d4 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8025cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d0:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8025d2:	c9                   	leave
+  8025d3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025d4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025d9:	eb f7                	jmp    8025d2 <free_space_bytes+0x38>
+
+00000000008025db <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8025db:	55                   	push   %rbp
+  8025dc:	48 89 e5             	mov    %rsp,%rbp
+  8025df:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025e3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025e7:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025ec:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	78 17                	js     802613 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8025fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802600:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802607:	48 85 d2             	test   %rdx,%rdx
+  80260a:	74 09                	je     802615 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80260c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802611:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802613:	c9                   	leave
+  802614:	c3                   	ret
+        return -E_NOT_SUPP;
+  802615:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80261a:	eb f7                	jmp    802613 <busy_space_bytes+0x38>
+
+000000000080261c <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  80261c:	55                   	push   %rbp
+  80261d:	48 89 e5             	mov    %rsp,%rbp
+  802620:	41 54                	push   %r12
+  802622:	53                   	push   %rbx
+  802623:	48 83 ec 10          	sub    $0x10,%rsp
+  802627:	89 fb                	mov    %edi,%ebx
+  802629:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80262c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802630:	bf 66 00 00 00       	mov    $0x66,%edi
+  802635:	48 b8 32 1c 80 00 00 	movabs $0x801c32,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	85 c0                	test   %eax,%eax
+  802643:	78 17                	js     80265c <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802649:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802650:	48 85 c0             	test   %rax,%rax
+  802653:	74 10                	je     802665 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802655:	4c 89 e6             	mov    %r12,%rsi
+  802658:	89 df                	mov    %ebx,%edi
+  80265a:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80265c:	48 83 c4 10          	add    $0x10,%rsp
+  802660:	5b                   	pop    %rbx
+  802661:	41 5c                	pop    %r12
+  802663:	5d                   	pop    %rbp
+  802664:	c3                   	ret
+        return -E_NOT_SUPP;
+  802665:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80266a:	eb f0                	jmp    80265c <snapshots_space+0x40>
+
+000000000080266c <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80266c:	55                   	push   %rbp
+  80266d:	48 89 e5             	mov    %rsp,%rbp
+  802670:	41 55                	push   %r13
+  802672:	41 54                	push   %r12
+  802674:	53                   	push   %rbx
+  802675:	48 83 ec 08          	sub    $0x8,%rsp
+  802679:	41 89 fd             	mov    %edi,%r13d
+  80267c:	48 89 f3             	mov    %rsi,%rbx
+  80267f:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802682:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802689:	00 00 00 
+  80268c:	83 38 00             	cmpl   $0x0,(%rax)
+  80268f:	74 57                	je     8026e8 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802691:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802697:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80269c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8026a3:	00 00 00 
+  8026a6:	44 89 ee             	mov    %r13d,%esi
+  8026a9:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8026b0:	00 00 00 
+  8026b3:	8b 38                	mov    (%rax),%edi
+  8026b5:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  8026bc:	00 00 00 
+  8026bf:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8026c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c6:	4c 89 e2             	mov    %r12,%rdx
+  8026c9:	48 89 de             	mov    %rbx,%rsi
+  8026cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d1:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  8026d8:	00 00 00 
+  8026db:	ff d0                	call   *%rax
+}
+  8026dd:	48 83 c4 08          	add    $0x8,%rsp
+  8026e1:	5b                   	pop    %rbx
+  8026e2:	41 5c                	pop    %r12
+  8026e4:	41 5d                	pop    %r13
+  8026e6:	5d                   	pop    %rbp
+  8026e7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026ed:	48 b8 6a 3c 80 00 00 	movabs $0x803c6a,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802700:	00 00 
+  802702:	eb 8d                	jmp    802691 <fsipc_region+0x25>
+
+0000000000802704 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802704:	55                   	push   %rbp
+  802705:	48 89 e5             	mov    %rsp,%rbp
+  802708:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80270c:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802713:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802714:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802718:	48 b8 6c 26 80 00 00 	movabs $0x80266c,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+}
+  802724:	c9                   	leave
+  802725:	c3                   	ret
+
+0000000000802726 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  802726:	85 ff                	test   %edi,%edi
+  802728:	78 6d                	js     802797 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80272a:	55                   	push   %rbp
+  80272b:	48 89 e5             	mov    %rsp,%rbp
+  80272e:	41 54                	push   %r12
+  802730:	53                   	push   %rbx
+  802731:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802734:	48 85 f6             	test   %rsi,%rsi
+  802737:	74 57                	je     802790 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802739:	89 f8                	mov    %edi,%eax
+  80273b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802742:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802744:	be 00 00 00 00       	mov    $0x0,%esi
+  802749:	bf 12 00 00 00       	mov    $0x12,%edi
+  80274e:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802755:	00 00 00 
+  802758:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	78 2d                	js     80278b <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80275e:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802765:	00 00 00 
+  802768:	49 63 14 24          	movslq (%r12),%rdx
+  80276c:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802773:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802778:	48 89 df             	mov    %rbx,%rdi
+  80277b:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802787:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80278b:	5b                   	pop    %rbx
+  80278c:	41 5c                	pop    %r12
+  80278e:	5d                   	pop    %rbp
+  80278f:	c3                   	ret
+        return -E_INVAL;
+  802790:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802795:	eb f4                	jmp    80278b <devfile_df_snapshots+0x65>
+  802797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80279c:	c3                   	ret
+
+000000000080279d <devfile_df_busy>:
+devfile_df_busy() {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8027a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a6:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027ab:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8027b2:	00 00 00 
+  8027b5:	ff d0                	call   *%rax
+}
+  8027b7:	5d                   	pop    %rbp
+  8027b8:	c3                   	ret
+
+00000000008027b9 <devfile_df_free>:
+devfile_df_free() {
+  8027b9:	55                   	push   %rbp
+  8027ba:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8027bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027c7:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+}
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+
+00000000008027d5 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8027d5:	55                   	push   %rbp
+  8027d6:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8027d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027de:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027e3:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+}
+  8027ef:	5d                   	pop    %rbp
+  8027f0:	c3                   	ret
+
+00000000008027f1 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8027f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fa:	bf 09 00 00 00       	mov    $0x9,%edi
+  8027ff:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802806:	00 00 00 
+  802809:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802812:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802815:	5d                   	pop    %rbp
+  802816:	c3                   	ret
+
+0000000000802817 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80281b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802822:	00 00 00 
+  802825:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802828:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80282a:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80282d:	be 00 00 00 00       	mov    $0x0,%esi
+  802832:	bf 02 00 00 00       	mov    $0x2,%edi
+  802837:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  80283e:	00 00 00 
+  802841:	ff d0                	call   *%rax
+}
+  802843:	5d                   	pop    %rbp
+  802844:	c3                   	ret
+
+0000000000802845 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802845:	55                   	push   %rbp
+  802846:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802849:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80284c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802853:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802855:	be 00 00 00 00       	mov    $0x0,%esi
+  80285a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80285f:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+}
+  80286b:	5d                   	pop    %rbp
+  80286c:	c3                   	ret
+
+000000000080286d <devfile_write>:
+    if (!fd || !buf) {
+  80286d:	48 85 ff             	test   %rdi,%rdi
+  802870:	0f 84 c1 00 00 00    	je     802937 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802876:	55                   	push   %rbp
+  802877:	48 89 e5             	mov    %rsp,%rbp
+  80287a:	41 57                	push   %r15
+  80287c:	41 56                	push   %r14
+  80287e:	41 55                	push   %r13
+  802880:	41 54                	push   %r12
+  802882:	53                   	push   %rbx
+  802883:	48 83 ec 18          	sub    $0x18,%rsp
+  802887:	49 89 ff             	mov    %rdi,%r15
+  80288a:	49 89 f5             	mov    %rsi,%r13
+  80288d:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802890:	48 85 f6             	test   %rsi,%rsi
+  802893:	0f 84 95 00 00 00    	je     80292e <devfile_write+0xc1>
+    while (n) {
+  802899:	48 85 d2             	test   %rdx,%rdx
+  80289c:	0f 84 83 00 00 00    	je     802925 <devfile_write+0xb8>
+    int totalWrite = 0;
+  8028a2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028a9:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8028b0:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8028b3:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8028b8:	49 39 dc             	cmp    %rbx,%r12
+  8028bb:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8028bf:	48 89 da             	mov    %rbx,%rdx
+  8028c2:	4c 89 ee             	mov    %r13,%rsi
+  8028c5:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8028cc:	00 00 00 
+  8028cf:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028db:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028df:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8028e2:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8028e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028eb:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028f0:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+        if (write < 0) {
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 21                	js     802921 <devfile_write+0xb4>
+        buf += write;
+  802900:	48 63 d0             	movslq %eax,%rdx
+  802903:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802906:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802909:	49 29 d4             	sub    %rdx,%r12
+  80290c:	75 a5                	jne    8028b3 <devfile_write+0x46>
+    return totalWrite;
+  80290e:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802912:	48 83 c4 18          	add    $0x18,%rsp
+  802916:	5b                   	pop    %rbx
+  802917:	41 5c                	pop    %r12
+  802919:	41 5d                	pop    %r13
+  80291b:	41 5e                	pop    %r14
+  80291d:	41 5f                	pop    %r15
+  80291f:	5d                   	pop    %rbp
+  802920:	c3                   	ret
+            return write;
+  802921:	48 98                	cltq
+  802923:	eb ed                	jmp    802912 <devfile_write+0xa5>
+    int totalWrite = 0;
+  802925:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  80292c:	eb e0                	jmp    80290e <devfile_write+0xa1>
+        return -E_INVAL;
+  80292e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802935:	eb db                	jmp    802912 <devfile_write+0xa5>
+  802937:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80293e:	c3                   	ret
+
+000000000080293f <devfile_read>:
+    if (!fd || !buf) {
+  80293f:	48 85 ff             	test   %rdi,%rdi
+  802942:	0f 84 c0 00 00 00    	je     802a08 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802948:	55                   	push   %rbp
+  802949:	48 89 e5             	mov    %rsp,%rbp
+  80294c:	41 57                	push   %r15
+  80294e:	41 56                	push   %r14
+  802950:	41 55                	push   %r13
+  802952:	41 54                	push   %r12
+  802954:	53                   	push   %rbx
+  802955:	48 83 ec 18          	sub    $0x18,%rsp
+  802959:	49 89 ff             	mov    %rdi,%r15
+  80295c:	49 89 f5             	mov    %rsi,%r13
+  80295f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802962:	48 85 f6             	test   %rsi,%rsi
+  802965:	0f 84 96 00 00 00    	je     802a01 <devfile_read+0xc2>
+    while (n) {
+  80296b:	48 85 d2             	test   %rdx,%rdx
+  80296e:	0f 84 87 00 00 00    	je     8029fb <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802974:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80297b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80297c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802983:	00 00 00 
+  802986:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80298a:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80298d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802992:	49 39 c4             	cmp    %rax,%r12
+  802995:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802999:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80299d:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029a7:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	7e 37                	jle    8029ee <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8029b7:	48 63 d8             	movslq %eax,%rbx
+  8029ba:	48 89 da             	mov    %rbx,%rdx
+  8029bd:	4c 89 f6             	mov    %r14,%rsi
+  8029c0:	4c 89 ef             	mov    %r13,%rdi
+  8029c3:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+        buf += read;
+  8029cf:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8029d2:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8029d6:	49 29 dc             	sub    %rbx,%r12
+  8029d9:	75 ab                	jne    802986 <devfile_read+0x47>
+  return totalRead;
+  8029db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8029df:	48 83 c4 18          	add    $0x18,%rsp
+  8029e3:	5b                   	pop    %rbx
+  8029e4:	41 5c                	pop    %r12
+  8029e6:	41 5d                	pop    %r13
+  8029e8:	41 5e                	pop    %r14
+  8029ea:	41 5f                	pop    %r15
+  8029ec:	5d                   	pop    %rbp
+  8029ed:	c3                   	ret
+            return read ? read : totalRead;
+  8029ee:	48 63 d0             	movslq %eax,%rdx
+  8029f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029f9:	eb e4                	jmp    8029df <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8029fb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8029ff:	eb da                	jmp    8029db <devfile_read+0x9c>
+        return E_INVAL;
+  802a01:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a06:	eb d7                	jmp    8029df <devfile_read+0xa0>
+  802a08:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a0d:	c3                   	ret
+
+0000000000802a0e <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802a0e:	48 85 ff             	test   %rdi,%rdi
+  802a11:	74 5f                	je     802a72 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802a13:	55                   	push   %rbp
+  802a14:	48 89 e5             	mov    %rsp,%rbp
+  802a17:	53                   	push   %rbx
+  802a18:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1c:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802a1f:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802a26:	00 00 00 
+  802a29:	ff d0                	call   *%rax
+  802a2b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a31:	77 45                	ja     802a78 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802a33:	48 89 de             	mov    %rbx,%rsi
+  802a36:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a3d:	00 00 00 
+  802a40:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a51:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a56:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a62:	85 c0                	test   %eax,%eax
+  802a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a69:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+        return -E_INVAL;
+  802a72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a77:	c3                   	ret
+        return -E_INVAL;
+  802a78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a7d:	eb ed                	jmp    802a6c <devfile_receive_snapshot+0x5e>
+
+0000000000802a7f <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802a7f:	55                   	push   %rbp
+  802a80:	48 89 e5             	mov    %rsp,%rbp
+  802a83:	41 55                	push   %r13
+  802a85:	41 54                	push   %r12
+  802a87:	53                   	push   %rbx
+  802a88:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8c:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802a8f:	48 85 f6             	test   %rsi,%rsi
+  802a92:	0f 94 c0             	sete   %al
+  802a95:	48 85 d2             	test   %rdx,%rdx
+  802a98:	0f 94 c2             	sete   %dl
+  802a9b:	08 d0                	or     %dl,%al
+  802a9d:	0f 85 ad 00 00 00    	jne    802b50 <devfile_send_snapshot+0xd1>
+  802aa3:	48 89 fb             	mov    %rdi,%rbx
+  802aa6:	49 89 f4             	mov    %rsi,%r12
+  802aa9:	48 85 ff             	test   %rdi,%rdi
+  802aac:	0f 84 9e 00 00 00    	je     802b50 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802ab2:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ac4:	0f 87 8d 00 00 00    	ja     802b57 <devfile_send_snapshot+0xd8>
+  802aca:	4c 89 e7             	mov    %r12,%rdi
+  802acd:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802ad4:	00 00 00 
+  802ad7:	ff d0                	call   *%rax
+  802ad9:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802adf:	77 7d                	ja     802b5e <devfile_send_snapshot+0xdf>
+  802ae1:	4c 89 ef             	mov    %r13,%rdi
+  802ae4:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+  802af0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802af6:	77 6d                	ja     802b65 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802af8:	48 89 de             	mov    %rbx,%rsi
+  802afb:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b02:	00 00 00 
+  802b05:	48 bb ee 0f 80 00 00 	movabs $0x800fee,%rbx
+  802b0c:	00 00 00 
+  802b0f:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802b11:	4c 89 e6             	mov    %r12,%rsi
+  802b14:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802b1b:	00 00 00 
+  802b1e:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802b20:	4c 89 ee             	mov    %r13,%rsi
+  802b23:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802b2a:	00 00 00 
+  802b2d:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802b2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b34:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802b39:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+}
+  802b45:	48 83 c4 08          	add    $0x8,%rsp
+  802b49:	5b                   	pop    %rbx
+  802b4a:	41 5c                	pop    %r12
+  802b4c:	41 5d                	pop    %r13
+  802b4e:	5d                   	pop    %rbp
+  802b4f:	c3                   	ret
+        return -E_INVAL;
+  802b50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b55:	eb ee                	jmp    802b45 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802b57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b5c:	eb e7                	jmp    802b45 <devfile_send_snapshot+0xc6>
+  802b5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b63:	eb e0                	jmp    802b45 <devfile_send_snapshot+0xc6>
+  802b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6a:	eb d9                	jmp    802b45 <devfile_send_snapshot+0xc6>
+
+0000000000802b6c <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802b6c:	48 85 ff             	test   %rdi,%rdi
+  802b6f:	0f 84 41 01 00 00    	je     802cb6 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802b75:	55                   	push   %rbp
+  802b76:	48 89 e5             	mov    %rsp,%rbp
+  802b79:	41 57                	push   %r15
+  802b7b:	41 56                	push   %r14
+  802b7d:	41 55                	push   %r13
+  802b7f:	41 54                	push   %r12
+  802b81:	53                   	push   %rbx
+  802b82:	48 83 ec 08          	sub    $0x8,%rsp
+  802b86:	49 89 fc             	mov    %rdi,%r12
+  802b89:	49 89 f5             	mov    %rsi,%r13
+  802b8c:	48 89 d3             	mov    %rdx,%rbx
+  802b8f:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802b92:	48 85 f6             	test   %rsi,%rsi
+  802b95:	0f 84 ff 00 00 00    	je     802c9a <devfile_diff_snapshots+0x12e>
+  802b9b:	48 85 d2             	test   %rdx,%rdx
+  802b9e:	0f 84 fd 00 00 00    	je     802ca1 <devfile_diff_snapshots+0x135>
+  802ba4:	48 85 c9             	test   %rcx,%rcx
+  802ba7:	0f 84 f4 00 00 00    	je     802ca1 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802bad:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+  802bb9:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802bbf:	0f 87 e3 00 00 00    	ja     802ca8 <devfile_diff_snapshots+0x13c>
+  802bc5:	4c 89 ef             	mov    %r13,%rdi
+  802bc8:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802bcf:	00 00 00 
+  802bd2:	ff d0                	call   *%rax
+  802bd4:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802bda:	0f 87 cf 00 00 00    	ja     802caf <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802be0:	4c 89 e6             	mov    %r12,%rsi
+  802be3:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802bea:	00 00 00 
+  802bed:	4c 89 e7             	mov    %r12,%rdi
+  802bf0:	49 bf ee 0f 80 00 00 	movabs $0x800fee,%r15
+  802bf7:	00 00 00 
+  802bfa:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802bfd:	4c 89 ee             	mov    %r13,%rsi
+  802c00:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802c07:	00 
+  802c08:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802c0b:	48 8b 03             	mov    (%rbx),%rax
+  802c0e:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802c15:	00 
+  802c16:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802c1a:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802c21:	00 
+  802c22:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c26:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802c2d:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c33:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802c38:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c44:	85 c0                	test   %eax,%eax
+  802c46:	78 43                	js     802c8b <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802c48:	49 8b 04 24          	mov    (%r12),%rax
+  802c4c:	48 89 03             	mov    %rax,(%rbx)
+  802c4f:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802c54:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802c58:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802c5d:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802c61:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802c66:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802c6a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802c6e:	48 c1 e2 03          	shl    $0x3,%rdx
+  802c72:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802c77:	4c 89 f7             	mov    %r14,%rdi
+  802c7a:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  802c81:	00 00 00 
+  802c84:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802c86:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802c8b:	48 83 c4 08          	add    $0x8,%rsp
+  802c8f:	5b                   	pop    %rbx
+  802c90:	41 5c                	pop    %r12
+  802c92:	41 5d                	pop    %r13
+  802c94:	41 5e                	pop    %r14
+  802c96:	41 5f                	pop    %r15
+  802c98:	5d                   	pop    %rbp
+  802c99:	c3                   	ret
+        return -E_INVAL;
+  802c9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c9f:	eb ea                	jmp    802c8b <devfile_diff_snapshots+0x11f>
+  802ca1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca6:	eb e3                	jmp    802c8b <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802ca8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cad:	eb dc                	jmp    802c8b <devfile_diff_snapshots+0x11f>
+  802caf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cb4:	eb d5                	jmp    802c8b <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802cb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cbb:	c3                   	ret
+
+0000000000802cbc <devfile_delete_snapshot>:
+    if (!name) {
+  802cbc:	48 85 ff             	test   %rdi,%rdi
+  802cbf:	74 5f                	je     802d20 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802cc1:	55                   	push   %rbp
+  802cc2:	48 89 e5             	mov    %rsp,%rbp
+  802cc5:	53                   	push   %rbx
+  802cc6:	48 83 ec 08          	sub    $0x8,%rsp
+  802cca:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802ccd:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+  802cd9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cdf:	77 45                	ja     802d26 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802ce1:	48 89 de             	mov    %rbx,%rsi
+  802ce4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ceb:	00 00 00 
+  802cee:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  802cf5:	00 00 00 
+  802cf8:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802cfa:	be 00 00 00 00       	mov    $0x0,%esi
+  802cff:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802d04:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d10:	85 c0                	test   %eax,%eax
+  802d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d17:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1e:	c9                   	leave
+  802d1f:	c3                   	ret
+        return -E_INVAL;
+  802d20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d25:	c3                   	ret
+        return -E_INVAL;
+  802d26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d2b:	eb ed                	jmp    802d1a <devfile_delete_snapshot+0x5e>
+
+0000000000802d2d <devfile_accept_snapshot>:
+    if (!name) {
+  802d2d:	48 85 ff             	test   %rdi,%rdi
+  802d30:	74 5f                	je     802d91 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802d32:	55                   	push   %rbp
+  802d33:	48 89 e5             	mov    %rsp,%rbp
+  802d36:	53                   	push   %rbx
+  802d37:	48 83 ec 08          	sub    $0x8,%rsp
+  802d3b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802d3e:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+  802d4a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d50:	77 45                	ja     802d97 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802d52:	48 89 de             	mov    %rbx,%rsi
+  802d55:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802d5c:	00 00 00 
+  802d5f:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d70:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d75:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802d7c:	00 00 00 
+  802d7f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d88:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+        return -E_INVAL;
+  802d91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d96:	c3                   	ret
+        return -E_INVAL;
+  802d97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d9c:	eb ed                	jmp    802d8b <devfile_accept_snapshot+0x5e>
+
+0000000000802d9e <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802d9e:	48 85 ff             	test   %rdi,%rdi
+  802da1:	0f 84 9f 00 00 00    	je     802e46 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802da7:	55                   	push   %rbp
+  802da8:	48 89 e5             	mov    %rsp,%rbp
+  802dab:	41 54                	push   %r12
+  802dad:	53                   	push   %rbx
+  802dae:	48 89 fb             	mov    %rdi,%rbx
+  802db1:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802db4:	48 85 f6             	test   %rsi,%rsi
+  802db7:	74 78                	je     802e31 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802db9:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802dc0:	00 00 00 
+  802dc3:	ff d0                	call   *%rax
+  802dc5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802dcb:	77 6b                	ja     802e38 <devfile_create_snapshot+0x9a>
+  802dcd:	4c 89 e7             	mov    %r12,%rdi
+  802dd0:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802de2:	77 5b                	ja     802e3f <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802de4:	48 89 de             	mov    %rbx,%rsi
+  802de7:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802dee:	00 00 00 
+  802df1:	48 bb ee 0f 80 00 00 	movabs $0x800fee,%rbx
+  802df8:	00 00 00 
+  802dfb:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802dfd:	4c 89 e6             	mov    %r12,%rsi
+  802e00:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802e07:	00 00 00 
+  802e0a:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802e0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e11:	bf 08 00 00 00       	mov    $0x8,%edi
+  802e16:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e29:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802e2c:	5b                   	pop    %rbx
+  802e2d:	41 5c                	pop    %r12
+  802e2f:	5d                   	pop    %rbp
+  802e30:	c3                   	ret
+        return -E_INVAL;
+  802e31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e36:	eb f4                	jmp    802e2c <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802e38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3d:	eb ed                	jmp    802e2c <devfile_create_snapshot+0x8e>
+  802e3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e44:	eb e6                	jmp    802e2c <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802e46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e4b:	c3                   	ret
+
+0000000000802e4c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e4c:	55                   	push   %rbp
+  802e4d:	48 89 e5             	mov    %rsp,%rbp
+  802e50:	41 54                	push   %r12
+  802e52:	53                   	push   %rbx
+  802e53:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e56:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e59:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802e60:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802e62:	be 00 00 00 00       	mov    $0x0,%esi
+  802e67:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e6c:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	78 3d                	js     802eb9 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e7c:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802e83:	00 00 00 
+  802e86:	4c 89 e6             	mov    %r12,%rsi
+  802e89:	48 89 df             	mov    %rbx,%rdi
+  802e8c:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  802e93:	00 00 00 
+  802e96:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e98:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802e9f:	00 
+  802ea0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ea6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ead:	00 
+  802eae:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eb9:	5b                   	pop    %rbx
+  802eba:	41 5c                	pop    %r12
+  802ebc:	5d                   	pop    %rbp
+  802ebd:	c3                   	ret
+
+0000000000802ebe <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802ebe:	55                   	push   %rbp
+  802ebf:	48 89 e5             	mov    %rsp,%rbp
+  802ec2:	41 57                	push   %r15
+  802ec4:	41 56                	push   %r14
+  802ec6:	41 55                	push   %r13
+  802ec8:	41 54                	push   %r12
+  802eca:	53                   	push   %rbx
+  802ecb:	48 83 ec 38          	sub    $0x38,%rsp
+  802ecf:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802ed3:	49 89 f5             	mov    %rsi,%r13
+  802ed6:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ed9:	48 89 f0             	mov    %rsi,%rax
+  802edc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ee1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ee5:	75 4f                	jne    802f36 <devfile_readmap+0x78>
+  802ee7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802eeb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ef1:	75 1f                	jne    802f12 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802ef3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ef7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802efb:	49 be 69 37 80 00 00 	movabs $0x803769,%r14
+  802f02:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802f05:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802f0c:	0f 87 9d 00 00 00    	ja     802faf <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802f12:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f16:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802f1a:	4d 85 ff             	test   %r15,%r15
+  802f1d:	0f 85 cf 00 00 00    	jne    802ff2 <devfile_readmap+0x134>
+  802f23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802f27:	48 83 c4 38          	add    $0x38,%rsp
+  802f2b:	5b                   	pop    %rbx
+  802f2c:	41 5c                	pop    %r12
+  802f2e:	41 5d                	pop    %r13
+  802f30:	41 5e                	pop    %r14
+  802f32:	41 5f                	pop    %r15
+  802f34:	5d                   	pop    %rbp
+  802f35:	c3                   	ret
+    size_t totalRead = 0;
+  802f36:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802f3d:	00 
+  802f3e:	eb da                	jmp    802f1a <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f40:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f44:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f47:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802f4e:	00 00 00 
+  802f51:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802f53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f57:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802f5b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f5f:	4c 89 ee             	mov    %r13,%rsi
+  802f62:	bf 14 00 00 00       	mov    $0x14,%edi
+  802f67:	48 b8 6c 26 80 00 00 	movabs $0x80266c,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	7e a3                	jle    802f1a <devfile_readmap+0x5c>
+  802f77:	48 98                	cltq
+  802f79:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802f7d:	72 9b                	jb     802f1a <devfile_readmap+0x5c>
+        buf += read;
+  802f7f:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802f82:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802f85:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802f89:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802f90:	75 88                	jne    802f1a <devfile_readmap+0x5c>
+  802f92:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f96:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f9c:	0f 85 78 ff ff ff    	jne    802f1a <devfile_readmap+0x5c>
+  802fa2:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802fa9:	0f 86 6b ff ff ff    	jbe    802f1a <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802faf:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802fb5:	4d 39 e7             	cmp    %r12,%r15
+  802fb8:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802fbc:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802fc3:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802fc7:	0f 84 73 ff ff ff    	je     802f40 <devfile_readmap+0x82>
+  802fcd:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802fd1:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802fd6:	41 ff d6             	call   *%r14
+  802fd9:	a8 40                	test   $0x40,%al
+  802fdb:	0f 85 39 ff ff ff    	jne    802f1a <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802fe1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802fe8:	4c 39 e3             	cmp    %r12,%rbx
+  802feb:	72 e4                	jb     802fd1 <devfile_readmap+0x113>
+  802fed:	e9 4e ff ff ff       	jmp    802f40 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802ff2:	4c 89 fa             	mov    %r15,%rdx
+  802ff5:	4c 89 ee             	mov    %r13,%rsi
+  802ff8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ffc:	48 b8 3f 29 80 00 00 	movabs $0x80293f,%rax
+  803003:	00 00 00 
+  803006:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  803008:	48 85 c0             	test   %rax,%rax
+  80300b:	78 0c                	js     803019 <devfile_readmap+0x15b>
+    return totalRead + read;
+  80300d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803011:	48 01 f0             	add    %rsi,%rax
+  803014:	e9 0e ff ff ff       	jmp    802f27 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  803019:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80301d:	48 85 f6             	test   %rsi,%rsi
+  803020:	48 0f 45 c6          	cmovne %rsi,%rax
+  803024:	e9 fe fe ff ff       	jmp    802f27 <devfile_readmap+0x69>
+
+0000000000803029 <open>:
+open(const char *path, int mode) {
+  803029:	55                   	push   %rbp
+  80302a:	48 89 e5             	mov    %rsp,%rbp
+  80302d:	41 55                	push   %r13
+  80302f:	41 54                	push   %r12
+  803031:	53                   	push   %rbx
+  803032:	48 83 ec 18          	sub    $0x18,%rsp
+  803036:	49 89 fc             	mov    %rdi,%r12
+  803039:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80303c:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  803043:	00 00 00 
+  803046:	ff d0                	call   *%rax
+  803048:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80304e:	0f 87 8a 00 00 00    	ja     8030de <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803054:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803058:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+  803064:	89 c3                	mov    %eax,%ebx
+  803066:	85 c0                	test   %eax,%eax
+  803068:	78 50                	js     8030ba <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80306a:	4c 89 e6             	mov    %r12,%rsi
+  80306d:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803074:	00 00 00 
+  803077:	48 89 df             	mov    %rbx,%rdi
+  80307a:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803086:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80308d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803091:	bf 01 00 00 00       	mov    $0x1,%edi
+  803096:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+  8030a2:	89 c3                	mov    %eax,%ebx
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 1f                	js     8030c7 <open+0x9e>
+    return fd2num(fd);
+  8030a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030ac:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8030b3:	00 00 00 
+  8030b6:	ff d0                	call   *%rax
+  8030b8:	89 c3                	mov    %eax,%ebx
+}
+  8030ba:	89 d8                	mov    %ebx,%eax
+  8030bc:	48 83 c4 18          	add    $0x18,%rsp
+  8030c0:	5b                   	pop    %rbx
+  8030c1:	41 5c                	pop    %r12
+  8030c3:	41 5d                	pop    %r13
+  8030c5:	5d                   	pop    %rbp
+  8030c6:	c3                   	ret
+        fd_close(fd, 0);
+  8030c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030d0:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  8030d7:	00 00 00 
+  8030da:	ff d0                	call   *%rax
+        return res;
+  8030dc:	eb dc                	jmp    8030ba <open+0x91>
+        return -E_BAD_PATH;
+  8030de:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030e3:	eb d5                	jmp    8030ba <open+0x91>
+
+00000000008030e5 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8030e5:	55                   	push   %rbp
+  8030e6:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8030e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ee:	bf 13 00 00 00       	mov    $0x13,%edi
+  8030f3:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+}
+  8030ff:	5d                   	pop    %rbp
+  803100:	c3                   	ret
+
+0000000000803101 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+  803105:	41 54                	push   %r12
+  803107:	53                   	push   %rbx
+  803108:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80310b:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+  803117:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80311a:	48 be 80 44 80 00 00 	movabs $0x804480,%rsi
+  803121:	00 00 00 
+  803124:	48 89 df             	mov    %rbx,%rdi
+  803127:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803133:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803138:	41 2b 04 24          	sub    (%r12),%eax
+  80313c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803142:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803149:	00 00 00 
+    stat->st_dev = &devpipe;
+  80314c:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  803153:	00 00 00 
+  803156:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80315d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803162:	5b                   	pop    %rbx
+  803163:	41 5c                	pop    %r12
+  803165:	5d                   	pop    %rbp
+  803166:	c3                   	ret
+
+0000000000803167 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803167:	55                   	push   %rbp
+  803168:	48 89 e5             	mov    %rsp,%rbp
+  80316b:	41 54                	push   %r12
+  80316d:	53                   	push   %rbx
+  80316e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803171:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803176:	48 89 fe             	mov    %rdi,%rsi
+  803179:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317e:	49 bc 46 17 80 00 00 	movabs $0x801746,%r12
+  803185:	00 00 00 
+  803188:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80318b:	48 89 df             	mov    %rbx,%rdi
+  80318e:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  803195:	00 00 00 
+  803198:	ff d0                	call   *%rax
+  80319a:	48 89 c6             	mov    %rax,%rsi
+  80319d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a7:	41 ff d4             	call   *%r12
+}
+  8031aa:	5b                   	pop    %rbx
+  8031ab:	41 5c                	pop    %r12
+  8031ad:	5d                   	pop    %rbp
+  8031ae:	c3                   	ret
+
+00000000008031af <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031af:	55                   	push   %rbp
+  8031b0:	48 89 e5             	mov    %rsp,%rbp
+  8031b3:	41 57                	push   %r15
+  8031b5:	41 56                	push   %r14
+  8031b7:	41 55                	push   %r13
+  8031b9:	41 54                	push   %r12
+  8031bb:	53                   	push   %rbx
+  8031bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8031c0:	49 89 fc             	mov    %rdi,%r12
+  8031c3:	49 89 f5             	mov    %rsi,%r13
+  8031c6:	49 89 d7             	mov    %rdx,%r15
+  8031c9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031cd:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8031d4:	00 00 00 
+  8031d7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8031d9:	4d 85 ff             	test   %r15,%r15
+  8031dc:	0f 84 af 00 00 00    	je     803291 <devpipe_write+0xe2>
+  8031e2:	48 89 c3             	mov    %rax,%rbx
+  8031e5:	4c 89 f8             	mov    %r15,%rax
+  8031e8:	4d 89 ef             	mov    %r13,%r15
+  8031eb:	4c 01 e8             	add    %r13,%rax
+  8031ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031f2:	49 bd 4e 16 80 00 00 	movabs $0x80164e,%r13
+  8031f9:	00 00 00 
+            sys_yield();
+  8031fc:	49 be eb 15 80 00 00 	movabs $0x8015eb,%r14
+  803203:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803206:	8b 73 04             	mov    0x4(%rbx),%esi
+  803209:	48 63 ce             	movslq %esi,%rcx
+  80320c:	48 63 03             	movslq (%rbx),%rax
+  80320f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803215:	48 39 c1             	cmp    %rax,%rcx
+  803218:	72 2e                	jb     803248 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80321a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80321f:	48 89 da             	mov    %rbx,%rdx
+  803222:	be 00 10 00 00       	mov    $0x1000,%esi
+  803227:	4c 89 e7             	mov    %r12,%rdi
+  80322a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	74 66                	je     803297 <devpipe_write+0xe8>
+            sys_yield();
+  803231:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803234:	8b 73 04             	mov    0x4(%rbx),%esi
+  803237:	48 63 ce             	movslq %esi,%rcx
+  80323a:	48 63 03             	movslq (%rbx),%rax
+  80323d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803243:	48 39 c1             	cmp    %rax,%rcx
+  803246:	73 d2                	jae    80321a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803248:	41 0f b6 3f          	movzbl (%r15),%edi
+  80324c:	48 89 ca             	mov    %rcx,%rdx
+  80324f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803253:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80325a:	08 10 20 
+  80325d:	48 f7 e2             	mul    %rdx
+  803260:	48 c1 ea 06          	shr    $0x6,%rdx
+  803264:	48 89 d0             	mov    %rdx,%rax
+  803267:	48 c1 e0 09          	shl    $0x9,%rax
+  80326b:	48 29 d0             	sub    %rdx,%rax
+  80326e:	48 c1 e0 03          	shl    $0x3,%rax
+  803272:	48 29 c1             	sub    %rax,%rcx
+  803275:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80327a:	83 c6 01             	add    $0x1,%esi
+  80327d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803280:	49 83 c7 01          	add    $0x1,%r15
+  803284:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803288:	49 39 c7             	cmp    %rax,%r15
+  80328b:	0f 85 75 ff ff ff    	jne    803206 <devpipe_write+0x57>
+    return n;
+  803291:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803295:	eb 05                	jmp    80329c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803297:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80329c:	48 83 c4 18          	add    $0x18,%rsp
+  8032a0:	5b                   	pop    %rbx
+  8032a1:	41 5c                	pop    %r12
+  8032a3:	41 5d                	pop    %r13
+  8032a5:	41 5e                	pop    %r14
+  8032a7:	41 5f                	pop    %r15
+  8032a9:	5d                   	pop    %rbp
+  8032aa:	c3                   	ret
+
+00000000008032ab <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8032ab:	55                   	push   %rbp
+  8032ac:	48 89 e5             	mov    %rsp,%rbp
+  8032af:	41 57                	push   %r15
+  8032b1:	41 56                	push   %r14
+  8032b3:	41 55                	push   %r13
+  8032b5:	41 54                	push   %r12
+  8032b7:	53                   	push   %rbx
+  8032b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032bc:	49 89 fc             	mov    %rdi,%r12
+  8032bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032c7:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+  8032d3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8032d6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032dc:	49 bd 4e 16 80 00 00 	movabs $0x80164e,%r13
+  8032e3:	00 00 00 
+            sys_yield();
+  8032e6:	49 be eb 15 80 00 00 	movabs $0x8015eb,%r14
+  8032ed:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8032f0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032f5:	74 7d                	je     803374 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032f7:	8b 03                	mov    (%rbx),%eax
+  8032f9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032fc:	75 26                	jne    803324 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8032fe:	4d 85 ff             	test   %r15,%r15
+  803301:	75 77                	jne    80337a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803303:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803308:	48 89 da             	mov    %rbx,%rdx
+  80330b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803310:	4c 89 e7             	mov    %r12,%rdi
+  803313:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803316:	85 c0                	test   %eax,%eax
+  803318:	74 72                	je     80338c <devpipe_read+0xe1>
+            sys_yield();
+  80331a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80331d:	8b 03                	mov    (%rbx),%eax
+  80331f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803322:	74 df                	je     803303 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803324:	48 63 c8             	movslq %eax,%rcx
+  803327:	48 89 ca             	mov    %rcx,%rdx
+  80332a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80332e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803335:	08 10 20 
+  803338:	48 89 d0             	mov    %rdx,%rax
+  80333b:	48 f7 e6             	mul    %rsi
+  80333e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803342:	48 89 d0             	mov    %rdx,%rax
+  803345:	48 c1 e0 09          	shl    $0x9,%rax
+  803349:	48 29 d0             	sub    %rdx,%rax
+  80334c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803353:	00 
+  803354:	48 89 c8             	mov    %rcx,%rax
+  803357:	48 29 d0             	sub    %rdx,%rax
+  80335a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80335f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803363:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803367:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80336a:	49 83 c7 01          	add    $0x1,%r15
+  80336e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803372:	75 83                	jne    8032f7 <devpipe_read+0x4c>
+    return n;
+  803374:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803378:	eb 03                	jmp    80337d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80337a:	4c 89 f8             	mov    %r15,%rax
+}
+  80337d:	48 83 c4 18          	add    $0x18,%rsp
+  803381:	5b                   	pop    %rbx
+  803382:	41 5c                	pop    %r12
+  803384:	41 5d                	pop    %r13
+  803386:	41 5e                	pop    %r14
+  803388:	41 5f                	pop    %r15
+  80338a:	5d                   	pop    %rbp
+  80338b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803391:	eb ea                	jmp    80337d <devpipe_read+0xd2>
+
+0000000000803393 <pipe>:
+pipe(int pfd[2]) {
+  803393:	55                   	push   %rbp
+  803394:	48 89 e5             	mov    %rsp,%rbp
+  803397:	41 55                	push   %r13
+  803399:	41 54                	push   %r12
+  80339b:	53                   	push   %rbx
+  80339c:	48 83 ec 18          	sub    $0x18,%rsp
+  8033a0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033a3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8033a7:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  8033ae:	00 00 00 
+  8033b1:	ff d0                	call   *%rax
+  8033b3:	89 c3                	mov    %eax,%ebx
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	0f 88 a0 01 00 00    	js     80355d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033c7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d0:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+  8033dc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	0f 88 77 01 00 00    	js     80355d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033e6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8033ea:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  8033f1:	00 00 00 
+  8033f4:	ff d0                	call   *%rax
+  8033f6:	89 c3                	mov    %eax,%ebx
+  8033f8:	85 c0                	test   %eax,%eax
+  8033fa:	0f 88 43 01 00 00    	js     803543 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803400:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803405:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80340a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80340e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803413:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  80341a:	00 00 00 
+  80341d:	ff d0                	call   *%rax
+  80341f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803421:	85 c0                	test   %eax,%eax
+  803423:	0f 88 1a 01 00 00    	js     803543 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803429:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80342d:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  803434:	00 00 00 
+  803437:	ff d0                	call   *%rax
+  803439:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80343c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803441:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803446:	48 89 c6             	mov    %rax,%rsi
+  803449:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344e:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  803455:	00 00 00 
+  803458:	ff d0                	call   *%rax
+  80345a:	89 c3                	mov    %eax,%ebx
+  80345c:	85 c0                	test   %eax,%eax
+  80345e:	0f 88 c5 00 00 00    	js     803529 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803464:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803468:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  80346f:	00 00 00 
+  803472:	ff d0                	call   *%rax
+  803474:	48 89 c1             	mov    %rax,%rcx
+  803477:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80347d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803483:	ba 00 00 00 00       	mov    $0x0,%edx
+  803488:	4c 89 ee             	mov    %r13,%rsi
+  80348b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803490:	48 b8 e1 16 80 00 00 	movabs $0x8016e1,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+  80349c:	89 c3                	mov    %eax,%ebx
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	78 6e                	js     803510 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034a7:	4c 89 ef             	mov    %r13,%rdi
+  8034aa:	48 b8 1c 16 80 00 00 	movabs $0x80161c,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+  8034b6:	83 f8 02             	cmp    $0x2,%eax
+  8034b9:	0f 85 ab 00 00 00    	jne    80356a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034bf:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8034c6:	00 00 
+  8034c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034cc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8034ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034d2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8034d9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034dd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8034df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034e3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8034ea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034ee:	48 bb 59 1b 80 00 00 	movabs $0x801b59,%rbx
+  8034f5:	00 00 00 
+  8034f8:	ff d3                	call   *%rbx
+  8034fa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8034fe:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803502:	ff d3                	call   *%rbx
+  803504:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80350e:	eb 4d                	jmp    80355d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803510:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803515:	4c 89 ee             	mov    %r13,%rsi
+  803518:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351d:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  803524:	00 00 00 
+  803527:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803529:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80352e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803532:	bf 00 00 00 00       	mov    $0x0,%edi
+  803537:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  80353e:	00 00 00 
+  803541:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803543:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803548:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80354c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803551:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  803558:	00 00 00 
+  80355b:	ff d0                	call   *%rax
+}
+  80355d:	89 d8                	mov    %ebx,%eax
+  80355f:	48 83 c4 18          	add    $0x18,%rsp
+  803563:	5b                   	pop    %rbx
+  803564:	41 5c                	pop    %r12
+  803566:	41 5d                	pop    %r13
+  803568:	5d                   	pop    %rbp
+  803569:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80356a:	48 b9 b0 44 80 00 00 	movabs $0x8044b0,%rcx
+  803571:	00 00 00 
+  803574:	48 ba 87 44 80 00 00 	movabs $0x804487,%rdx
+  80357b:	00 00 00 
+  80357e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803583:	48 bf 9c 44 80 00 00 	movabs $0x80449c,%rdi
+  80358a:	00 00 00 
+  80358d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803592:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  803599:	00 00 00 
+  80359c:	41 ff d0             	call   *%r8
+
+000000000080359f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80359f:	55                   	push   %rbp
+  8035a0:	48 89 e5             	mov    %rsp,%rbp
+  8035a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8035a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ab:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035b7:	85 c0                	test   %eax,%eax
+  8035b9:	78 35                	js     8035f0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8035bb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035bf:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+  8035cb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035dc:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  8035e3:	00 00 00 
+  8035e6:	ff d0                	call   *%rax
+  8035e8:	85 c0                	test   %eax,%eax
+  8035ea:	0f 94 c0             	sete   %al
+  8035ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8035f0:	c9                   	leave
+  8035f1:	c3                   	ret
+
+00000000008035f2 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8035f2:	55                   	push   %rbp
+  8035f3:	48 89 e5             	mov    %rsp,%rbp
+  8035f6:	41 55                	push   %r13
+  8035f8:	41 54                	push   %r12
+  8035fa:	53                   	push   %rbx
+  8035fb:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8035ff:	85 ff                	test   %edi,%edi
+  803601:	74 7d                	je     803680 <wait+0x8e>
+  803603:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803606:	89 f8                	mov    %edi,%eax
+  803608:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80360d:	89 fa                	mov    %edi,%edx
+  80360f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803615:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  803619:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  80361d:	48 c1 e1 04          	shl    $0x4,%rcx
+  803621:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803628:	00 00 00 
+  80362b:	48 01 ca             	add    %rcx,%rdx
+  80362e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803634:	39 d7                	cmp    %edx,%edi
+  803636:	75 3d                	jne    803675 <wait+0x83>
+           env->env_status != ENV_FREE) {
+  803638:	48 98                	cltq
+  80363a:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80363e:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  803642:	48 c1 e0 04          	shl    $0x4,%rax
+  803646:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80364d:	00 00 00 
+  803650:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803653:	49 bd eb 15 80 00 00 	movabs $0x8015eb,%r13
+  80365a:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80365d:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803663:	85 c0                	test   %eax,%eax
+  803665:	74 0e                	je     803675 <wait+0x83>
+        sys_yield();
+  803667:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80366a:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803670:	44 39 e0             	cmp    %r12d,%eax
+  803673:	74 e8                	je     80365d <wait+0x6b>
+    }
+}
+  803675:	48 83 c4 08          	add    $0x8,%rsp
+  803679:	5b                   	pop    %rbx
+  80367a:	41 5c                	pop    %r12
+  80367c:	41 5d                	pop    %r13
+  80367e:	5d                   	pop    %rbp
+  80367f:	c3                   	ret
+    assert(envid != 0);
+  803680:	48 b9 d4 44 80 00 00 	movabs $0x8044d4,%rcx
+  803687:	00 00 00 
+  80368a:	48 ba 87 44 80 00 00 	movabs $0x804487,%rdx
+  803691:	00 00 00 
+  803694:	be 06 00 00 00       	mov    $0x6,%esi
+  803699:	48 bf df 44 80 00 00 	movabs $0x8044df,%rdi
+  8036a0:	00 00 00 
+  8036a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a8:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  8036af:	00 00 00 
+  8036b2:	41 ff d0             	call   *%r8
+
+00000000008036b5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036b5:	48 89 f8             	mov    %rdi,%rax
+  8036b8:	48 c1 e8 27          	shr    $0x27,%rax
+  8036bc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8036c3:	01 00 00 
+  8036c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ca:	f6 c2 01             	test   $0x1,%dl
+  8036cd:	74 6d                	je     80373c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036cf:	48 89 f8             	mov    %rdi,%rax
+  8036d2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036d6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036dd:	01 00 00 
+  8036e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036e4:	f6 c2 01             	test   $0x1,%dl
+  8036e7:	74 62                	je     80374b <get_uvpt_entry+0x96>
+  8036e9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036f0:	01 00 00 
+  8036f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036f7:	f6 c2 80             	test   $0x80,%dl
+  8036fa:	75 4f                	jne    80374b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036fc:	48 89 f8             	mov    %rdi,%rax
+  8036ff:	48 c1 e8 15          	shr    $0x15,%rax
+  803703:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80370a:	01 00 00 
+  80370d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803711:	f6 c2 01             	test   $0x1,%dl
+  803714:	74 44                	je     80375a <get_uvpt_entry+0xa5>
+  803716:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80371d:	01 00 00 
+  803720:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803724:	f6 c2 80             	test   $0x80,%dl
+  803727:	75 31                	jne    80375a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803729:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80372d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803734:	01 00 00 
+  803737:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80373b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80373c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803743:	01 00 00 
+  803746:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80374a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80374b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803752:	01 00 00 
+  803755:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803759:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80375a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803761:	01 00 00 
+  803764:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803768:	c3                   	ret
+
+0000000000803769 <get_prot>:
+
+int
+get_prot(void *va) {
+  803769:	55                   	push   %rbp
+  80376a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80376d:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  803774:	00 00 00 
+  803777:	ff d0                	call   *%rax
+  803779:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80377c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803781:	89 c1                	mov    %eax,%ecx
+  803783:	83 c9 04             	or     $0x4,%ecx
+  803786:	f6 c2 01             	test   $0x1,%dl
+  803789:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80378c:	89 c1                	mov    %eax,%ecx
+  80378e:	83 c9 02             	or     $0x2,%ecx
+  803791:	f6 c2 02             	test   $0x2,%dl
+  803794:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803797:	89 c1                	mov    %eax,%ecx
+  803799:	83 c9 01             	or     $0x1,%ecx
+  80379c:	48 85 d2             	test   %rdx,%rdx
+  80379f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8037a2:	89 c1                	mov    %eax,%ecx
+  8037a4:	83 c9 40             	or     $0x40,%ecx
+  8037a7:	f6 c6 04             	test   $0x4,%dh
+  8037aa:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8037ad:	5d                   	pop    %rbp
+  8037ae:	c3                   	ret
+
+00000000008037af <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8037af:	55                   	push   %rbp
+  8037b0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037b3:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  8037ba:	00 00 00 
+  8037bd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8037bf:	48 c1 e8 06          	shr    $0x6,%rax
+  8037c3:	83 e0 01             	and    $0x1,%eax
+}
+  8037c6:	5d                   	pop    %rbp
+  8037c7:	c3                   	ret
+
+00000000008037c8 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8037c8:	55                   	push   %rbp
+  8037c9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037cc:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  8037d3:	00 00 00 
+  8037d6:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8037d8:	48 c1 e8 05          	shr    $0x5,%rax
+  8037dc:	83 e0 01             	and    $0x1,%eax
+}
+  8037df:	5d                   	pop    %rbp
+  8037e0:	c3                   	ret
+
+00000000008037e1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8037e1:	55                   	push   %rbp
+  8037e2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8037e5:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  8037ec:	00 00 00 
+  8037ef:	ff d0                	call   *%rax
+  8037f1:	83 e0 01             	and    $0x1,%eax
+}
+  8037f4:	5d                   	pop    %rbp
+  8037f5:	c3                   	ret
+
+00000000008037f6 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8037f6:	55                   	push   %rbp
+  8037f7:	48 89 e5             	mov    %rsp,%rbp
+  8037fa:	41 57                	push   %r15
+  8037fc:	41 56                	push   %r14
+  8037fe:	41 55                	push   %r13
+  803800:	41 54                	push   %r12
+  803802:	53                   	push   %rbx
+  803803:	48 83 ec 18          	sub    $0x18,%rsp
+  803807:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80380b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80380f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803814:	49 bd e1 37 80 00 00 	movabs $0x8037e1,%r13
+  80381b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80381e:	49 bf 69 37 80 00 00 	movabs $0x803769,%r15
+  803825:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803828:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80382f:	00 00 00 
+  803832:	eb 0c                	jmp    803840 <foreach_shared_region+0x4a>
+  803834:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80383b:	4c 39 f3             	cmp    %r14,%rbx
+  80383e:	74 2e                	je     80386e <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803840:	48 89 df             	mov    %rbx,%rdi
+  803843:	41 ff d5             	call   *%r13
+  803846:	84 c0                	test   %al,%al
+  803848:	74 ea                	je     803834 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80384a:	48 89 df             	mov    %rbx,%rdi
+  80384d:	41 ff d7             	call   *%r15
+  803850:	a8 40                	test   $0x40,%al
+  803852:	74 e0                	je     803834 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803854:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80385b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80385f:	48 89 df             	mov    %rbx,%rdi
+  803862:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803866:	ff d0                	call   *%rax
+				if (res < 0) {
+  803868:	85 c0                	test   %eax,%eax
+  80386a:	79 c8                	jns    803834 <foreach_shared_region+0x3e>
+  80386c:	eb 05                	jmp    803873 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80386e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803873:	48 83 c4 18          	add    $0x18,%rsp
+  803877:	5b                   	pop    %rbx
+  803878:	41 5c                	pop    %r12
+  80387a:	41 5d                	pop    %r13
+  80387c:	41 5e                	pop    %r14
+  80387e:	41 5f                	pop    %r15
+  803880:	5d                   	pop    %rbp
+  803881:	c3                   	ret
+
+0000000000803882 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803882:	b8 00 00 00 00       	mov    $0x0,%eax
+  803887:	c3                   	ret
+
+0000000000803888 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803888:	55                   	push   %rbp
+  803889:	48 89 e5             	mov    %rsp,%rbp
+  80388c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80388f:	48 be ea 44 80 00 00 	movabs $0x8044ea,%rsi
+  803896:	00 00 00 
+  803899:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  8038a0:	00 00 00 
+  8038a3:	ff d0                	call   *%rax
+    return 0;
+}
+  8038a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038aa:	5d                   	pop    %rbp
+  8038ab:	c3                   	ret
+
+00000000008038ac <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038ac:	55                   	push   %rbp
+  8038ad:	48 89 e5             	mov    %rsp,%rbp
+  8038b0:	41 57                	push   %r15
+  8038b2:	41 56                	push   %r14
+  8038b4:	41 55                	push   %r13
+  8038b6:	41 54                	push   %r12
+  8038b8:	53                   	push   %rbx
+  8038b9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8038c0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8038c7:	48 85 d2             	test   %rdx,%rdx
+  8038ca:	74 7a                	je     803946 <devcons_write+0x9a>
+  8038cc:	49 89 d6             	mov    %rdx,%r14
+  8038cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038d5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8038da:	49 bf e8 11 80 00 00 	movabs $0x8011e8,%r15
+  8038e1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8038e4:	4c 89 f3             	mov    %r14,%rbx
+  8038e7:	48 29 f3             	sub    %rsi,%rbx
+  8038ea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8038ef:	48 39 c3             	cmp    %rax,%rbx
+  8038f2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8038f6:	4c 63 eb             	movslq %ebx,%r13
+  8038f9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803900:	48 01 c6             	add    %rax,%rsi
+  803903:	4c 89 ea             	mov    %r13,%rdx
+  803906:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80390d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803910:	4c 89 ee             	mov    %r13,%rsi
+  803913:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80391a:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803926:	41 01 dc             	add    %ebx,%r12d
+  803929:	49 63 f4             	movslq %r12d,%rsi
+  80392c:	4c 39 f6             	cmp    %r14,%rsi
+  80392f:	72 b3                	jb     8038e4 <devcons_write+0x38>
+    return res;
+  803931:	49 63 c4             	movslq %r12d,%rax
+}
+  803934:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80393b:	5b                   	pop    %rbx
+  80393c:	41 5c                	pop    %r12
+  80393e:	41 5d                	pop    %r13
+  803940:	41 5e                	pop    %r14
+  803942:	41 5f                	pop    %r15
+  803944:	5d                   	pop    %rbp
+  803945:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803946:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80394c:	eb e3                	jmp    803931 <devcons_write+0x85>
+
+000000000080394e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80394e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803951:	ba 00 00 00 00       	mov    $0x0,%edx
+  803956:	48 85 c0             	test   %rax,%rax
+  803959:	74 55                	je     8039b0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80395b:	55                   	push   %rbp
+  80395c:	48 89 e5             	mov    %rsp,%rbp
+  80395f:	41 55                	push   %r13
+  803961:	41 54                	push   %r12
+  803963:	53                   	push   %rbx
+  803964:	48 83 ec 08          	sub    $0x8,%rsp
+  803968:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80396b:	48 bb 1e 15 80 00 00 	movabs $0x80151e,%rbx
+  803972:	00 00 00 
+  803975:	49 bc eb 15 80 00 00 	movabs $0x8015eb,%r12
+  80397c:	00 00 00 
+  80397f:	eb 03                	jmp    803984 <devcons_read+0x36>
+  803981:	41 ff d4             	call   *%r12
+  803984:	ff d3                	call   *%rbx
+  803986:	85 c0                	test   %eax,%eax
+  803988:	74 f7                	je     803981 <devcons_read+0x33>
+    if (c < 0) return c;
+  80398a:	48 63 d0             	movslq %eax,%rdx
+  80398d:	78 13                	js     8039a2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80398f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803994:	83 f8 04             	cmp    $0x4,%eax
+  803997:	74 09                	je     8039a2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803999:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80399d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8039a2:	48 89 d0             	mov    %rdx,%rax
+  8039a5:	48 83 c4 08          	add    $0x8,%rsp
+  8039a9:	5b                   	pop    %rbx
+  8039aa:	41 5c                	pop    %r12
+  8039ac:	41 5d                	pop    %r13
+  8039ae:	5d                   	pop    %rbp
+  8039af:	c3                   	ret
+  8039b0:	48 89 d0             	mov    %rdx,%rax
+  8039b3:	c3                   	ret
+
+00000000008039b4 <cputchar>:
+cputchar(int ch) {
+  8039b4:	55                   	push   %rbp
+  8039b5:	48 89 e5             	mov    %rsp,%rbp
+  8039b8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8039bc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8039c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8039c5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8039c9:	48 b8 f1 14 80 00 00 	movabs $0x8014f1,%rax
+  8039d0:	00 00 00 
+  8039d3:	ff d0                	call   *%rax
+}
+  8039d5:	c9                   	leave
+  8039d6:	c3                   	ret
+
+00000000008039d7 <getchar>:
+getchar(void) {
+  8039d7:	55                   	push   %rbp
+  8039d8:	48 89 e5             	mov    %rsp,%rbp
+  8039db:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8039df:	ba 01 00 00 00       	mov    $0x1,%edx
+  8039e4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8039e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ed:	48 b8 ca 1e 80 00 00 	movabs $0x801eca,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+  8039f9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8039fb:	85 c0                	test   %eax,%eax
+  8039fd:	78 06                	js     803a05 <getchar+0x2e>
+  8039ff:	74 08                	je     803a09 <getchar+0x32>
+  803a01:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803a05:	89 d0                	mov    %edx,%eax
+  803a07:	c9                   	leave
+  803a08:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803a09:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803a0e:	eb f5                	jmp    803a05 <getchar+0x2e>
+
+0000000000803a10 <iscons>:
+iscons(int fdnum) {
+  803a10:	55                   	push   %rbp
+  803a11:	48 89 e5             	mov    %rsp,%rbp
+  803a14:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a18:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a1c:	48 b8 e7 1b 80 00 00 	movabs $0x801be7,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a28:	85 c0                	test   %eax,%eax
+  803a2a:	78 18                	js     803a44 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803a2c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a30:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803a37:	00 00 00 
+  803a3a:	8b 00                	mov    (%rax),%eax
+  803a3c:	39 02                	cmp    %eax,(%rdx)
+  803a3e:	0f 94 c0             	sete   %al
+  803a41:	0f b6 c0             	movzbl %al,%eax
+}
+  803a44:	c9                   	leave
+  803a45:	c3                   	ret
+
+0000000000803a46 <opencons>:
+opencons(void) {
+  803a46:	55                   	push   %rbp
+  803a47:	48 89 e5             	mov    %rsp,%rbp
+  803a4a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a4e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803a52:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  803a59:	00 00 00 
+  803a5c:	ff d0                	call   *%rax
+  803a5e:	85 c0                	test   %eax,%eax
+  803a60:	78 49                	js     803aab <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803a62:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a6c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803a70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a75:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+  803a81:	85 c0                	test   %eax,%eax
+  803a83:	78 26                	js     803aab <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803a85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a89:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803a90:	00 00 
+  803a92:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803a94:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a98:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803a9f:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+}
+  803aab:	c9                   	leave
+  803aac:	c3                   	ret
+
+0000000000803aad <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  803aad:	55                   	push   %rbp
+  803aae:	48 89 e5             	mov    %rsp,%rbp
+  803ab1:	41 55                	push   %r13
+  803ab3:	41 54                	push   %r12
+  803ab5:	53                   	push   %rbx
+  803ab6:	48 83 ec 08          	sub    $0x8,%rsp
+  803aba:	49 89 fc             	mov    %rdi,%r12
+  803abd:	48 89 f7             	mov    %rsi,%rdi
+  803ac0:	48 89 d3             	mov    %rdx,%rbx
+  803ac3:	49 89 cd             	mov    %rcx,%r13
+  803ac6:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ac9:	48 85 f6             	test   %rsi,%rsi
+  803acc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ad3:	00 00 00 
+  803ad6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803ada:	be 00 10 00 00       	mov    $0x1000,%esi
+  803adf:	48 85 db             	test   %rbx,%rbx
+  803ae2:	74 03                	je     803ae7 <ipc_recv_timed+0x3a>
+  803ae4:	48 8b 33             	mov    (%rbx),%rsi
+  803ae7:	48 b8 14 19 80 00 00 	movabs $0x801914,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+    if (res < 0) {
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	78 75                	js     803b6c <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803af7:	4d 85 e4             	test   %r12,%r12
+  803afa:	74 14                	je     803b10 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803afc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803b03:	00 00 00 
+  803b06:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803b0c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803b10:	4d 85 ed             	test   %r13,%r13
+  803b13:	74 14                	je     803b29 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803b15:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803b1c:	00 00 00 
+  803b1f:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803b25:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803b29:	48 85 db             	test   %rbx,%rbx
+  803b2c:	74 23                	je     803b51 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803b2e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803b35:	00 00 00 
+  803b38:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b43:	85 c9                	test   %ecx,%ecx
+  803b45:	74 07                	je     803b4e <ipc_recv_timed+0xa1>
+  803b47:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803b4e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803b51:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803b58:	00 00 00 
+  803b5b:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803b61:	48 83 c4 08          	add    $0x8,%rsp
+  803b65:	5b                   	pop    %rbx
+  803b66:	41 5c                	pop    %r12
+  803b68:	41 5d                	pop    %r13
+  803b6a:	5d                   	pop    %rbp
+  803b6b:	c3                   	ret
+        if (from_env_store != NULL) {
+  803b6c:	4d 85 e4             	test   %r12,%r12
+  803b6f:	74 08                	je     803b79 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803b71:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803b78:	00 
+        if (perm_store != NULL) {
+  803b79:	4d 85 ed             	test   %r13,%r13
+  803b7c:	74 08                	je     803b86 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803b7e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b85:	00 
+        if (size != NULL) {
+  803b86:	48 85 db             	test   %rbx,%rbx
+  803b89:	74 d6                	je     803b61 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803b8b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b92:	eb cd                	jmp    803b61 <ipc_recv_timed+0xb4>
+
+0000000000803b94 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b94:	55                   	push   %rbp
+  803b95:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803b98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b9e:	48 b8 ad 3a 80 00 00 	movabs $0x803aad,%rax
+  803ba5:	00 00 00 
+  803ba8:	ff d0                	call   *%rax
+}
+  803baa:	5d                   	pop    %rbp
+  803bab:	c3                   	ret
+
+0000000000803bac <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803bac:	55                   	push   %rbp
+  803bad:	48 89 e5             	mov    %rsp,%rbp
+  803bb0:	41 57                	push   %r15
+  803bb2:	41 56                	push   %r14
+  803bb4:	41 55                	push   %r13
+  803bb6:	41 54                	push   %r12
+  803bb8:	53                   	push   %rbx
+  803bb9:	48 83 ec 18          	sub    $0x18,%rsp
+  803bbd:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803bc0:	48 89 d3             	mov    %rdx,%rbx
+  803bc3:	49 89 cc             	mov    %rcx,%r12
+  803bc6:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803bc9:	48 85 d2             	test   %rdx,%rdx
+  803bcc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bd3:	00 00 00 
+  803bd6:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803bda:	89 f0                	mov    %esi,%eax
+  803bdc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803be0:	48 89 da             	mov    %rbx,%rdx
+  803be3:	48 89 c6             	mov    %rax,%rsi
+  803be6:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  803bed:	00 00 00 
+  803bf0:	ff d0                	call   *%rax
+    while (res < 0) {
+  803bf2:	85 c0                	test   %eax,%eax
+  803bf4:	79 65                	jns    803c5b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803bf6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803bf9:	75 33                	jne    803c2e <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803bfb:	49 bf eb 15 80 00 00 	movabs $0x8015eb,%r15
+  803c02:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803c05:	49 be e8 18 80 00 00 	movabs $0x8018e8,%r14
+  803c0c:	00 00 00 
+        sys_yield();
+  803c0f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803c12:	45 89 e8             	mov    %r13d,%r8d
+  803c15:	4c 89 e1             	mov    %r12,%rcx
+  803c18:	48 89 da             	mov    %rbx,%rdx
+  803c1b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803c1f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803c22:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803c25:	85 c0                	test   %eax,%eax
+  803c27:	79 32                	jns    803c5b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803c29:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803c2c:	74 e1                	je     803c0f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803c2e:	89 c1                	mov    %eax,%ecx
+  803c30:	48 ba f6 44 80 00 00 	movabs $0x8044f6,%rdx
+  803c37:	00 00 00 
+  803c3a:	be 52 00 00 00       	mov    $0x52,%esi
+  803c3f:	48 bf 0a 45 80 00 00 	movabs $0x80450a,%rdi
+  803c46:	00 00 00 
+  803c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4e:	49 b8 79 05 80 00 00 	movabs $0x800579,%r8
+  803c55:	00 00 00 
+  803c58:	41 ff d0             	call   *%r8
+    }
+}
+  803c5b:	48 83 c4 18          	add    $0x18,%rsp
+  803c5f:	5b                   	pop    %rbx
+  803c60:	41 5c                	pop    %r12
+  803c62:	41 5d                	pop    %r13
+  803c64:	41 5e                	pop    %r14
+  803c66:	41 5f                	pop    %r15
+  803c68:	5d                   	pop    %rbp
+  803c69:	c3                   	ret
+
+0000000000803c6a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803c6f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803c76:	00 00 00 
+  803c79:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803c7d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803c81:	48 c1 e2 04          	shl    $0x4,%rdx
+  803c85:	48 01 ca             	add    %rcx,%rdx
+  803c88:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803c8e:	39 fa                	cmp    %edi,%edx
+  803c90:	74 12                	je     803ca4 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803c92:	48 83 c0 01          	add    $0x1,%rax
+  803c96:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803c9c:	75 db                	jne    803c79 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ca3:	c3                   	ret
+            return envs[i].env_id;
+  803ca4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803ca8:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803cac:	48 c1 e2 04          	shl    $0x4,%rdx
+  803cb0:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803cb7:	00 00 00 
+  803cba:	48 01 d0             	add    %rdx,%rax
+  803cbd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803cc3:	c3                   	ret
+  803cc4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803cc8 <__rodata_start>:
+  803cc8:	70 69                	jo     803d33 <__rodata_start+0x6b>
+  803cca:	70 65                	jo     803d31 <__rodata_start+0x69>
+  803ccc:	72 65                	jb     803d33 <__rodata_start+0x6b>
+  803cce:	61                   	(bad)
+  803ccf:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803cd2:	66 00 70 69          	data16 add %dh,0x69(%rax)
+  803cd6:	70 65                	jo     803d3d <__rodata_start+0x75>
+  803cd8:	3a 20                	cmp    (%rax),%ah
+  803cda:	25 69 00 75 73       	and    $0x73750069,%eax
+  803cdf:	65 72 2f             	gs jb  803d11 <__rodata_start+0x49>
+  803ce2:	74 65                	je     803d49 <__rodata_start+0x81>
+  803ce4:	73 74                	jae    803d5a <__rodata_start+0x92>
+  803ce6:	70 69                	jo     803d51 <__rodata_start+0x89>
+  803ce8:	70 65                	jo     803d4f <__rodata_start+0x87>
+  803cea:	2e 63 00             	cs movsxd (%rax),%eax
+  803ced:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803cef:	72 6b                	jb     803d5c <__rodata_start+0x94>
+  803cf1:	3a 20                	cmp    (%rax),%ah
+  803cf3:	25 69 00 5b 25       	and    $0x255b0069,%eax
+  803cf8:	30 38                	xor    %bh,(%rax)
+  803cfa:	78 5d                	js     803d59 <__rodata_start+0x91>
+  803cfc:	20 70 69             	and    %dh,0x69(%rax)
+  803cff:	70 65                	jo     803d66 <__rodata_start+0x9e>
+  803d01:	72 65                	jb     803d68 <__rodata_start+0xa0>
+  803d03:	61                   	(bad)
+  803d04:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803d07:	66 20 63 6c          	data16 and %ah,0x6c(%rbx)
+  803d0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d0c:	73 65                	jae    803d73 <__rodata_start+0xab>
+  803d0e:	20 25 64 0a 00 5b    	and    %ah,0x5b000a64(%rip)        # 5b804778 <__bss_end+0x5affb778>
+  803d14:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803d19:	20 70 69             	and    %dh,0x69(%rax)
+  803d1c:	70 65                	jo     803d83 <__rodata_start+0xbb>
+  803d1e:	72 65                	jb     803d85 <__rodata_start+0xbd>
+  803d20:	61                   	(bad)
+  803d21:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803d24:	66 20 72 65          	data16 and %dh,0x65(%rdx)
+  803d28:	61                   	(bad)
+  803d29:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  803d2b:	20 25 64 0a 00 72    	and    %ah,0x72000a64(%rip)        # 72804795 <__bss_end+0x71ffb795>
+  803d31:	65 61                	gs (bad)
+  803d33:	64 3a 20             	cmp    %fs:(%rax),%ah
+  803d36:	25 69 00 0a 70       	and    $0x700a0069,%eax
+  803d3b:	69 70 65 20 72 65 61 	imul   $0x61657220,0x65(%rax),%esi
+  803d42:	64 20 63 6c          	and    %ah,%fs:0x6c(%rbx)
+  803d46:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d47:	73 65                	jae    803dae <__rodata_start+0xe6>
+  803d49:	64 20 70 72          	and    %dh,%fs:0x72(%rax)
+  803d4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d4e:	70 65                	jo     803db5 <__rodata_start+0xed>
+  803d50:	72 6c                	jb     803dbe <__rodata_start+0xf6>
+  803d52:	79 0a                	jns    803d5e <__rodata_start+0x96>
+  803d54:	00 0a                	add    %cl,(%rdx)
+  803d56:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803d58:	74 20                	je     803d7a <__rodata_start+0xb2>
+  803d5a:	25 64 20 62 79       	and    $0x79622064,%eax
+  803d5f:	74 65                	je     803dc6 <__rodata_start+0xfe>
+  803d61:	73 3a                	jae    803d9d <__rodata_start+0xd5>
+  803d63:	20 25 73 0a 00 5b    	and    %ah,0x5b000a73(%rip)        # 5b8047dc <__bss_end+0x5affb7dc>
+  803d69:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803d6e:	20 70 69             	and    %dh,0x69(%rax)
+  803d71:	70 65                	jo     803dd8 <__rodata_start+0x110>
+  803d73:	72 65                	jb     803dda <__rodata_start+0x112>
+  803d75:	61                   	(bad)
+  803d76:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803d79:	66 20 77 72          	data16 and %dh,0x72(%rdi)
+  803d7d:	69 74 65 20 25 64 0a 	imul   $0xa6425,0x20(%rbp,%riz,2),%esi
+  803d84:	00 
+  803d85:	77 72                	ja     803df9 <__rodata_start+0x131>
+  803d87:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  803d8e:	00 
+  803d8f:	70 69                	jo     803dfa <__rodata_start+0x132>
+  803d91:	70 65                	jo     803df8 <__rodata_start+0x130>
+  803d93:	77 72                	ja     803e07 <__rodata_start+0x13f>
+  803d95:	69 74 65 65 6f 66 00 	imul   $0x2e00666f,0x65(%rbp,%riz,2),%esi
+  803d9c:	2e 
+  803d9d:	00 78 00             	add    %bh,0x0(%rax)
+  803da0:	0a 70 69             	or     0x69(%rax),%dh
+  803da3:	70 65                	jo     803e0a <__rodata_start+0x142>
+  803da5:	20 77 72             	and    %dh,0x72(%rdi)
+  803da8:	69 74 65 20 63 6c 6f 	imul   $0x736f6c63,0x20(%rbp,%riz,2),%esi
+  803daf:	73 
+  803db0:	65 64 20 70 72       	gs and %dh,%fs:0x72(%rax)
+  803db5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803db6:	70 65                	jo     803e1d <__rodata_start+0x155>
+  803db8:	72 6c                	jb     803e26 <__rodata_start+0x15e>
+  803dba:	79 0a                	jns    803dc6 <__rodata_start+0xfe>
+  803dbc:	00 70 69             	add    %dh,0x69(%rax)
+  803dbf:	70 65                	jo     803e26 <__rodata_start+0x15e>
+  803dc1:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803dc5:	74 73                	je     803e3a <__rodata_start+0x172>
+  803dc7:	20 70 61             	and    %dh,0x61(%rax)
+  803dca:	73 73                	jae    803e3f <__rodata_start+0x177>
+  803dcc:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  803dd0:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  803dd2:	77 20                	ja     803df4 <__rodata_start+0x12c>
+  803dd4:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  803ddb:	74 69                	je     803e46 <__rodata_start+0x17e>
+  803ddd:	6d                   	insl   (%dx),%es:(%rdi)
+  803dde:	65 20 66 6f          	and    %ah,%gs:0x6f(%rsi)
+  803de2:	72 20                	jb     803e04 <__rodata_start+0x13c>
+  803de4:	61                   	(bad)
+  803de5:	6c                   	insb   (%dx),%es:(%rdi)
+  803de6:	6c                   	insb   (%dx),%es:(%rdi)
+  803de7:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803dea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803deb:	64 20 6d 65          	and    %ch,%fs:0x65(%rbp)
+  803def:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803df0:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  803df4:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803df7:	65 20 74 6f 20       	and    %dh,%gs:0x20(%rdi,%rbp,2)
+  803dfc:	74 68                	je     803e66 <__rodata_start+0x19e>
+  803dfe:	65 20 61 69          	and    %ah,%gs:0x69(%rcx)
+  803e02:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803e06:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803e0a:	69 72 20 70 61 72 74 	imul   $0x74726170,0x20(%rdx),%esi
+  803e11:	79 2e                	jns    803e41 <__rodata_start+0x179>
+  803e13:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803e1a:	77 6e                	ja     803e8a <__rodata_start+0x1c2>
+  803e1c:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  803e20:	5b                   	pop    %rbx
+  803e21:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803e26:	20 75 73             	and    %dh,0x73(%rbp)
+  803e29:	65 72 20             	gs jb  803e4c <__rodata_start+0x184>
+  803e2c:	70 61                	jo     803e8f <__rodata_start+0x1c7>
+  803e2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e2f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803e36:	73 20                	jae    803e58 <__rodata_start+0x190>
+  803e38:	61                   	(bad)
+  803e39:	74 20                	je     803e5b <__rodata_start+0x193>
+  803e3b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803e40:	3a 20                	cmp    (%rax),%ah
+  803e42:	00 30                	add    %dh,(%rax)
+  803e44:	31 32                	xor    %esi,(%rdx)
+  803e46:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803e4d:	41                   	rex.B
+  803e4e:	42                   	rex.X
+  803e4f:	43                   	rex.XB
+  803e50:	44                   	rex.R
+  803e51:	45                   	rex.RB
+  803e52:	46 00 30             	rex.RX add %r14b,(%rax)
+  803e55:	31 32                	xor    %esi,(%rdx)
+  803e57:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803e5e:	61                   	(bad)
+  803e5f:	62 63 64 65 66       	(bad)
+  803e64:	00 28                	add    %ch,(%rax)
+  803e66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e67:	75 6c                	jne    803ed5 <__rodata_start+0x20d>
+  803e69:	6c                   	insb   (%dx),%es:(%rdi)
+  803e6a:	29 00                	sub    %eax,(%rax)
+  803e6c:	65 72 72             	gs jb  803ee1 <__rodata_start+0x219>
+  803e6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e70:	72 20                	jb     803e92 <__rodata_start+0x1ca>
+  803e72:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803e77:	73 70                	jae    803ee9 <__rodata_start+0x221>
+  803e79:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803e7d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803e84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e85:	72 00                	jb     803e87 <__rodata_start+0x1bf>
+  803e87:	62 61 64 20 65       	(bad)
+  803e8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e8d:	76 69                	jbe    803ef8 <__rodata_start+0x230>
+  803e8f:	72 6f                	jb     803f00 <__rodata_start+0x238>
+  803e91:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e92:	6d                   	insl   (%dx),%es:(%rdi)
+  803e93:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803e95:	74 00                	je     803e97 <__rodata_start+0x1cf>
+  803e97:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803e9e:	20 70 61             	and    %dh,0x61(%rax)
+  803ea1:	72 61                	jb     803f04 <__rodata_start+0x23c>
+  803ea3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ea4:	65 74 65             	gs je  803f0c <__rodata_start+0x244>
+  803ea7:	72 00                	jb     803ea9 <__rodata_start+0x1e1>
+  803ea9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eaa:	75 74                	jne    803f20 <__rodata_start+0x258>
+  803eac:	20 6f 66             	and    %ch,0x66(%rdi)
+  803eaf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803eb2:	6d                   	insl   (%dx),%es:(%rdi)
+  803eb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eb4:	72 79                	jb     803f2f <__rodata_start+0x267>
+  803eb6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803eb9:	74 20                	je     803edb <__rodata_start+0x213>
+  803ebb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ebc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803ec0:	76 69                	jbe    803f2b <__rodata_start+0x263>
+  803ec2:	72 6f                	jb     803f33 <__rodata_start+0x26b>
+  803ec4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ec5:	6d                   	insl   (%dx),%es:(%rdi)
+  803ec6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ec8:	74 73                	je     803f3d <__rodata_start+0x275>
+  803eca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803ecd:	72 72                	jb     803f41 <__rodata_start+0x279>
+  803ecf:	75 70                	jne    803f41 <__rodata_start+0x279>
+  803ed1:	74 65                	je     803f38 <__rodata_start+0x270>
+  803ed3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803ed8:	75 67                	jne    803f41 <__rodata_start+0x279>
+  803eda:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803edd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803edf:	00 73 65             	add    %dh,0x65(%rbx)
+  803ee2:	67 6d                	insl   (%dx),%es:(%edi)
+  803ee4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ee6:	74 61                	je     803f49 <__rodata_start+0x281>
+  803ee8:	74 69                	je     803f53 <__rodata_start+0x28b>
+  803eea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eeb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eec:	20 66 61             	and    %ah,0x61(%rsi)
+  803eef:	75 6c                	jne    803f5d <__rodata_start+0x295>
+  803ef1:	74 00                	je     803ef3 <__rodata_start+0x22b>
+  803ef3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803efa:	20 45 4c             	and    %al,0x4c(%rbp)
+  803efd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803f01:	61                   	(bad)
+  803f02:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803f07:	20 73 75             	and    %dh,0x75(%rbx)
+  803f0a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803f0d:	73 79                	jae    803f88 <__rodata_start+0x2c0>
+  803f0f:	73 74                	jae    803f85 <__rodata_start+0x2bd>
+  803f11:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803f13:	20 63 61             	and    %ah,0x61(%rbx)
+  803f16:	6c                   	insb   (%dx),%es:(%rdi)
+  803f17:	6c                   	insb   (%dx),%es:(%rdi)
+  803f18:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803f1b:	74 72                	je     803f8f <__rodata_start+0x2c7>
+  803f1d:	79 20                	jns    803f3f <__rodata_start+0x277>
+  803f1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f21:	74 20                	je     803f43 <__rodata_start+0x27b>
+  803f23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f25:	75 6e                	jne    803f95 <__rodata_start+0x2cd>
+  803f27:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803f2b:	76 20                	jbe    803f4d <__rodata_start+0x285>
+  803f2d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803f34:	72 65                	jb     803f9b <__rodata_start+0x2d3>
+  803f36:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803f39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f3a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803f3e:	65 78 70             	gs js  803fb1 <__rodata_start+0x2e9>
+  803f41:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803f46:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803f49:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803f4d:	20 66 69             	and    %ah,0x69(%rsi)
+  803f50:	6c                   	insb   (%dx),%es:(%rdi)
+  803f51:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803f55:	20 66 72             	and    %ah,0x72(%rsi)
+  803f58:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803f5d:	61                   	(bad)
+  803f5e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803f61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f63:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803f67:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803f6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f6c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803f6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f70:	79 20                	jns    803f92 <__rodata_start+0x2ca>
+  803f72:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803f79:	72 65                	jb     803fe0 <__rodata_start+0x318>
+  803f7b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803f7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f80:	00 66 69             	add    %ah,0x69(%rsi)
+  803f83:	6c                   	insb   (%dx),%es:(%rdi)
+  803f84:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803f88:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803f8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f8c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803f8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f91:	74 20                	je     803fb3 <__rodata_start+0x2eb>
+  803f93:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f95:	75 6e                	jne    804005 <__rodata_start+0x33d>
+  803f97:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803f9b:	76 61                	jbe    803ffe <__rodata_start+0x336>
+  803f9d:	6c                   	insb   (%dx),%es:(%rdi)
+  803f9e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803fa5:	00 
+  803fa6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803fad:	72 65                	jb     804014 <__rodata_start+0x34c>
+  803faf:	61                   	(bad)
+  803fb0:	64 79 20             	fs jns 803fd3 <__rodata_start+0x30b>
+  803fb3:	65 78 69             	gs js  80401f <__rodata_start+0x357>
+  803fb6:	73 74                	jae    80402c <__rodata_start+0x364>
+  803fb8:	73 00                	jae    803fba <__rodata_start+0x2f2>
+  803fba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fbb:	70 65                	jo     804022 <__rodata_start+0x35a>
+  803fbd:	72 61                	jb     804020 <__rodata_start+0x358>
+  803fbf:	74 69                	je     80402a <__rodata_start+0x362>
+  803fc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fc3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803fc6:	74 20                	je     803fe8 <__rodata_start+0x320>
+  803fc8:	73 75                	jae    80403f <__rodata_start+0x377>
+  803fca:	70 70                	jo     80403c <__rodata_start+0x374>
+  803fcc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fcd:	72 74                	jb     804043 <__rodata_start+0x37b>
+  803fcf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803fd5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803fda:	74 00                	je     803fdc <__rodata_start+0x314>
+  803fdc:	0f 1f 40 00          	nopl   0x0(%rax)
+  803fe0:	b6 08                	mov    $0x8,%dh
+  803fe2:	80 00 00             	addb   $0x0,(%rax)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 f7                	add    %dh,%bh
+  803fe9:	0e                   	(bad)
+  803fea:	80 00 00             	addb   $0x0,(%rax)
+  803fed:	00 00                	add    %al,(%rax)
+  803fef:	00 e7                	add    %ah,%bh
+  803ff1:	0e                   	(bad)
+  803ff2:	80 00 00             	addb   $0x0,(%rax)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 f7                	add    %dh,%bh
+  803ff9:	0e                   	(bad)
+  803ffa:	80 00 00             	addb   $0x0,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 f7                	add    %dh,%bh
+  804001:	0e                   	(bad)
+  804002:	80 00 00             	addb   $0x0,(%rax)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 f7                	add    %dh,%bh
+  804009:	0e                   	(bad)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 f7                	add    %dh,%bh
+  804011:	0e                   	(bad)
+  804012:	80 00 00             	addb   $0x0,(%rax)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 d5                	add    %dl,%ch
+  804019:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80401f:	00 f7                	add    %dh,%bh
+  804021:	0e                   	(bad)
+  804022:	80 00 00             	addb   $0x0,(%rax)
+  804025:	00 00                	add    %al,(%rax)
+  804027:	00 f7                	add    %dh,%bh
+  804029:	0e                   	(bad)
+  80402a:	80 00 00             	addb   $0x0,(%rax)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 c9                	add    %cl,%cl
+  804031:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804037:	00 43 09             	add    %al,0x9(%rbx)
+  80403a:	80 00 00             	addb   $0x0,(%rax)
+  80403d:	00 00                	add    %al,(%rax)
+  80403f:	00 f7                	add    %dh,%bh
+  804041:	0e                   	(bad)
+  804042:	80 00 00             	addb   $0x0,(%rax)
+  804045:	00 00                	add    %al,(%rax)
+  804047:	00 c9                	add    %cl,%cl
+  804049:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80404f:	00 0f                	add    %cl,(%rdi)
+  804051:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804057:	00 0f                	add    %cl,(%rdi)
+  804059:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80405f:	00 0f                	add    %cl,(%rdi)
+  804061:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804067:	00 0f                	add    %cl,(%rdi)
+  804069:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80406f:	00 0f                	add    %cl,(%rdi)
+  804071:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804077:	00 0f                	add    %cl,(%rdi)
+  804079:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80407f:	00 0f                	add    %cl,(%rdi)
+  804081:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804087:	00 0f                	add    %cl,(%rdi)
+  804089:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80408f:	00 0f                	add    %cl,(%rdi)
+  804091:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804097:	00 f7                	add    %dh,%bh
+  804099:	0e                   	(bad)
+  80409a:	80 00 00             	addb   $0x0,(%rax)
+  80409d:	00 00                	add    %al,(%rax)
+  80409f:	00 f7                	add    %dh,%bh
+  8040a1:	0e                   	(bad)
+  8040a2:	80 00 00             	addb   $0x0,(%rax)
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 f7                	add    %dh,%bh
+  8040a9:	0e                   	(bad)
+  8040aa:	80 00 00             	addb   $0x0,(%rax)
+  8040ad:	00 00                	add    %al,(%rax)
+  8040af:	00 f7                	add    %dh,%bh
+  8040b1:	0e                   	(bad)
+  8040b2:	80 00 00             	addb   $0x0,(%rax)
+  8040b5:	00 00                	add    %al,(%rax)
+  8040b7:	00 f7                	add    %dh,%bh
+  8040b9:	0e                   	(bad)
+  8040ba:	80 00 00             	addb   $0x0,(%rax)
+  8040bd:	00 00                	add    %al,(%rax)
+  8040bf:	00 f7                	add    %dh,%bh
+  8040c1:	0e                   	(bad)
+  8040c2:	80 00 00             	addb   $0x0,(%rax)
+  8040c5:	00 00                	add    %al,(%rax)
+  8040c7:	00 f7                	add    %dh,%bh
+  8040c9:	0e                   	(bad)
+  8040ca:	80 00 00             	addb   $0x0,(%rax)
+  8040cd:	00 00                	add    %al,(%rax)
+  8040cf:	00 f7                	add    %dh,%bh
+  8040d1:	0e                   	(bad)
+  8040d2:	80 00 00             	addb   $0x0,(%rax)
+  8040d5:	00 00                	add    %al,(%rax)
+  8040d7:	00 f7                	add    %dh,%bh
+  8040d9:	0e                   	(bad)
+  8040da:	80 00 00             	addb   $0x0,(%rax)
+  8040dd:	00 00                	add    %al,(%rax)
+  8040df:	00 f7                	add    %dh,%bh
+  8040e1:	0e                   	(bad)
+  8040e2:	80 00 00             	addb   $0x0,(%rax)
+  8040e5:	00 00                	add    %al,(%rax)
+  8040e7:	00 f7                	add    %dh,%bh
+  8040e9:	0e                   	(bad)
+  8040ea:	80 00 00             	addb   $0x0,(%rax)
+  8040ed:	00 00                	add    %al,(%rax)
+  8040ef:	00 f7                	add    %dh,%bh
+  8040f1:	0e                   	(bad)
+  8040f2:	80 00 00             	addb   $0x0,(%rax)
+  8040f5:	00 00                	add    %al,(%rax)
+  8040f7:	00 f7                	add    %dh,%bh
+  8040f9:	0e                   	(bad)
+  8040fa:	80 00 00             	addb   $0x0,(%rax)
+  8040fd:	00 00                	add    %al,(%rax)
+  8040ff:	00 f7                	add    %dh,%bh
+  804101:	0e                   	(bad)
+  804102:	80 00 00             	addb   $0x0,(%rax)
+  804105:	00 00                	add    %al,(%rax)
+  804107:	00 f7                	add    %dh,%bh
+  804109:	0e                   	(bad)
+  80410a:	80 00 00             	addb   $0x0,(%rax)
+  80410d:	00 00                	add    %al,(%rax)
+  80410f:	00 f7                	add    %dh,%bh
+  804111:	0e                   	(bad)
+  804112:	80 00 00             	addb   $0x0,(%rax)
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 f7                	add    %dh,%bh
+  804119:	0e                   	(bad)
+  80411a:	80 00 00             	addb   $0x0,(%rax)
+  80411d:	00 00                	add    %al,(%rax)
+  80411f:	00 f7                	add    %dh,%bh
+  804121:	0e                   	(bad)
+  804122:	80 00 00             	addb   $0x0,(%rax)
+  804125:	00 00                	add    %al,(%rax)
+  804127:	00 f7                	add    %dh,%bh
+  804129:	0e                   	(bad)
+  80412a:	80 00 00             	addb   $0x0,(%rax)
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 f7                	add    %dh,%bh
+  804131:	0e                   	(bad)
+  804132:	80 00 00             	addb   $0x0,(%rax)
+  804135:	00 00                	add    %al,(%rax)
+  804137:	00 f7                	add    %dh,%bh
+  804139:	0e                   	(bad)
+  80413a:	80 00 00             	addb   $0x0,(%rax)
+  80413d:	00 00                	add    %al,(%rax)
+  80413f:	00 f7                	add    %dh,%bh
+  804141:	0e                   	(bad)
+  804142:	80 00 00             	addb   $0x0,(%rax)
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 f7                	add    %dh,%bh
+  804149:	0e                   	(bad)
+  80414a:	80 00 00             	addb   $0x0,(%rax)
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 f7                	add    %dh,%bh
+  804151:	0e                   	(bad)
+  804152:	80 00 00             	addb   $0x0,(%rax)
+  804155:	00 00                	add    %al,(%rax)
+  804157:	00 f7                	add    %dh,%bh
+  804159:	0e                   	(bad)
+  80415a:	80 00 00             	addb   $0x0,(%rax)
+  80415d:	00 00                	add    %al,(%rax)
+  80415f:	00 f7                	add    %dh,%bh
+  804161:	0e                   	(bad)
+  804162:	80 00 00             	addb   $0x0,(%rax)
+  804165:	00 00                	add    %al,(%rax)
+  804167:	00 f7                	add    %dh,%bh
+  804169:	0e                   	(bad)
+  80416a:	80 00 00             	addb   $0x0,(%rax)
+  80416d:	00 00                	add    %al,(%rax)
+  80416f:	00 f7                	add    %dh,%bh
+  804171:	0e                   	(bad)
+  804172:	80 00 00             	addb   $0x0,(%rax)
+  804175:	00 00                	add    %al,(%rax)
+  804177:	00 f7                	add    %dh,%bh
+  804179:	0e                   	(bad)
+  80417a:	80 00 00             	addb   $0x0,(%rax)
+  80417d:	00 00                	add    %al,(%rax)
+  80417f:	00 f7                	add    %dh,%bh
+  804181:	0e                   	(bad)
+  804182:	80 00 00             	addb   $0x0,(%rax)
+  804185:	00 00                	add    %al,(%rax)
+  804187:	00 1a                	add    %bl,(%rdx)
+  804189:	0e                   	(bad)
+  80418a:	80 00 00             	addb   $0x0,(%rax)
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 f7                	add    %dh,%bh
+  804191:	0e                   	(bad)
+  804192:	80 00 00             	addb   $0x0,(%rax)
+  804195:	00 00                	add    %al,(%rax)
+  804197:	00 f7                	add    %dh,%bh
+  804199:	0e                   	(bad)
+  80419a:	80 00 00             	addb   $0x0,(%rax)
+  80419d:	00 00                	add    %al,(%rax)
+  80419f:	00 f7                	add    %dh,%bh
+  8041a1:	0e                   	(bad)
+  8041a2:	80 00 00             	addb   $0x0,(%rax)
+  8041a5:	00 00                	add    %al,(%rax)
+  8041a7:	00 f7                	add    %dh,%bh
+  8041a9:	0e                   	(bad)
+  8041aa:	80 00 00             	addb   $0x0,(%rax)
+  8041ad:	00 00                	add    %al,(%rax)
+  8041af:	00 f7                	add    %dh,%bh
+  8041b1:	0e                   	(bad)
+  8041b2:	80 00 00             	addb   $0x0,(%rax)
+  8041b5:	00 00                	add    %al,(%rax)
+  8041b7:	00 f7                	add    %dh,%bh
+  8041b9:	0e                   	(bad)
+  8041ba:	80 00 00             	addb   $0x0,(%rax)
+  8041bd:	00 00                	add    %al,(%rax)
+  8041bf:	00 f7                	add    %dh,%bh
+  8041c1:	0e                   	(bad)
+  8041c2:	80 00 00             	addb   $0x0,(%rax)
+  8041c5:	00 00                	add    %al,(%rax)
+  8041c7:	00 f7                	add    %dh,%bh
+  8041c9:	0e                   	(bad)
+  8041ca:	80 00 00             	addb   $0x0,(%rax)
+  8041cd:	00 00                	add    %al,(%rax)
+  8041cf:	00 f7                	add    %dh,%bh
+  8041d1:	0e                   	(bad)
+  8041d2:	80 00 00             	addb   $0x0,(%rax)
+  8041d5:	00 00                	add    %al,(%rax)
+  8041d7:	00 f7                	add    %dh,%bh
+  8041d9:	0e                   	(bad)
+  8041da:	80 00 00             	addb   $0x0,(%rax)
+  8041dd:	00 00                	add    %al,(%rax)
+  8041df:	00 66 09             	add    %ah,0x9(%rsi)
+  8041e2:	80 00 00             	addb   $0x0,(%rax)
+  8041e5:	00 00                	add    %al,(%rax)
+  8041e7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80c1f8 <__bss_end+0x31f8>
+  8041ed:	00 00                	add    %al,(%rax)
+  8041ef:	00 f7                	add    %dh,%bh
+  8041f1:	0e                   	(bad)
+  8041f2:	80 00 00             	addb   $0x0,(%rax)
+  8041f5:	00 00                	add    %al,(%rax)
+  8041f7:	00 f7                	add    %dh,%bh
+  8041f9:	0e                   	(bad)
+  8041fa:	80 00 00             	addb   $0x0,(%rax)
+  8041fd:	00 00                	add    %al,(%rax)
+  8041ff:	00 f7                	add    %dh,%bh
+  804201:	0e                   	(bad)
+  804202:	80 00 00             	addb   $0x0,(%rax)
+  804205:	00 00                	add    %al,(%rax)
+  804207:	00 f7                	add    %dh,%bh
+  804209:	0e                   	(bad)
+  80420a:	80 00 00             	addb   $0x0,(%rax)
+  80420d:	00 00                	add    %al,(%rax)
+  80420f:	00 95 09 80 00 00    	add    %dl,0x8009(%rbp)
+  804215:	00 00                	add    %al,(%rax)
+  804217:	00 f7                	add    %dh,%bh
+  804219:	0e                   	(bad)
+  80421a:	80 00 00             	addb   $0x0,(%rax)
+  80421d:	00 00                	add    %al,(%rax)
+  80421f:	00 f7                	add    %dh,%bh
+  804221:	0e                   	(bad)
+  804222:	80 00 00             	addb   $0x0,(%rax)
+  804225:	00 00                	add    %al,(%rax)
+  804227:	00 5b 09             	add    %bl,0x9(%rbx)
+  80422a:	80 00 00             	addb   $0x0,(%rax)
+  80422d:	00 00                	add    %al,(%rax)
+  80422f:	00 f7                	add    %dh,%bh
+  804231:	0e                   	(bad)
+  804232:	80 00 00             	addb   $0x0,(%rax)
+  804235:	00 00                	add    %al,(%rax)
+  804237:	00 f7                	add    %dh,%bh
+  804239:	0e                   	(bad)
+  80423a:	80 00 00             	addb   $0x0,(%rax)
+  80423d:	00 00                	add    %al,(%rax)
+  80423f:	00 dd                	add    %bl,%ch
+  804241:	0c 80                	or     $0x80,%al
+  804243:	00 00                	add    %al,(%rax)
+  804245:	00 00                	add    %al,(%rax)
+  804247:	00 a7 0d 80 00 00    	add    %ah,0x800d(%rdi)
+  80424d:	00 00                	add    %al,(%rax)
+  80424f:	00 f7                	add    %dh,%bh
+  804251:	0e                   	(bad)
+  804252:	80 00 00             	addb   $0x0,(%rax)
+  804255:	00 00                	add    %al,(%rax)
+  804257:	00 f7                	add    %dh,%bh
+  804259:	0e                   	(bad)
+  80425a:	80 00 00             	addb   $0x0,(%rax)
+  80425d:	00 00                	add    %al,(%rax)
+  80425f:	00 2c 0a             	add    %ch,(%rdx,%rcx,1)
+  804262:	80 00 00             	addb   $0x0,(%rax)
+  804265:	00 00                	add    %al,(%rax)
+  804267:	00 f7                	add    %dh,%bh
+  804269:	0e                   	(bad)
+  80426a:	80 00 00             	addb   $0x0,(%rax)
+  80426d:	00 00                	add    %al,(%rax)
+  80426f:	00 09                	add    %cl,(%rcx)
+  804271:	0c 80                	or     $0x80,%al
+  804273:	00 00                	add    %al,(%rax)
+  804275:	00 00                	add    %al,(%rax)
+  804277:	00 f7                	add    %dh,%bh
+  804279:	0e                   	(bad)
+  80427a:	80 00 00             	addb   $0x0,(%rax)
+  80427d:	00 00                	add    %al,(%rax)
+  80427f:	00 f7                	add    %dh,%bh
+  804281:	0e                   	(bad)
+  804282:	80 00 00             	addb   $0x0,(%rax)
+  804285:	00 00                	add    %al,(%rax)
+  804287:	00 1a                	add    %bl,(%rdx)
+  804289:	0e                   	(bad)
+  80428a:	80 00 00             	addb   $0x0,(%rax)
+  80428d:	00 00                	add    %al,(%rax)
+  80428f:	00 f7                	add    %dh,%bh
+  804291:	0e                   	(bad)
+  804292:	80 00 00             	addb   $0x0,(%rax)
+  804295:	00 00                	add    %al,(%rax)
+  804297:	00 bf 08 80 00 00    	add    %bh,0x8008(%rdi)
+  80429d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008042a0 <error_string>:
+	...
+  8042a8:	75 3e 80 00 00 00 00 00 87 3e 80 00 00 00 00 00     u>.......>......
+  8042b8:	97 3e 80 00 00 00 00 00 a9 3e 80 00 00 00 00 00     .>.......>......
+  8042c8:	b7 3e 80 00 00 00 00 00 cb 3e 80 00 00 00 00 00     .>.......>......
+  8042d8:	e0 3e 80 00 00 00 00 00 f3 3e 80 00 00 00 00 00     .>.......>......
+  8042e8:	05 3f 80 00 00 00 00 00 19 3f 80 00 00 00 00 00     .?.......?......
+  8042f8:	29 3f 80 00 00 00 00 00 3c 3f 80 00 00 00 00 00     )?......<?......
+  804308:	53 3f 80 00 00 00 00 00 69 3f 80 00 00 00 00 00     S?......i?......
+  804318:	81 3f 80 00 00 00 00 00 99 3f 80 00 00 00 00 00     .?.......?......
+  804328:	a6 3f 80 00 00 00 00 00 48 43 80 00 00 00 00 00     .?......HC......
+  804338:	ba 3f 80 00 00 00 00 00 d2 3f 80 00 00 00 00 00     .?.......?......
+  804348:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804358:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804368:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804378:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804388:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804398:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8043a8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8043b8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  8043c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8043d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  8043e8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  8043f8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804408:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804418:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804428:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804438:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804448:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804458:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804460 <devtab>:
+  804460:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804470:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804480:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804490:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8044a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8044b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8044c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8044d0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8044e0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8044f0:	00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64 20 65     .cons.ipc_send e
+  804500:	72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 69 70     rror: %i..lib/ip
+  804510:	63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     c.c.f.........f.
+  804520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
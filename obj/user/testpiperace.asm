@@ -0,0 +1,7523 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 38 03 00 00       	call   80035b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf b8 3a 80 00 00 	movabs $0x803ab8,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 7c 05 80 00 00 	movabs $0x80057c,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 5d 34 80 00 00 	movabs $0x80345d,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 8e 01 00 00    	js     8001f7 <umain+0x1d2>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 a4 01 00 00    	js     800224 <umain+0x1ff>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 c7 01 00 00    	je     800251 <umain+0x22c>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 12 3b 80 00 00 	movabs $0x803b12,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 be 7c 05 80 00 00 	movabs $0x80057c,%r14
+  8000a5:	00 00 00 
+  8000a8:	41 ff d6             	call   *%r14
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	41 89 dd             	mov    %ebx,%r13d
+  8000ae:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000b5:	41 89 dc             	mov    %ebx,%r12d
+  8000b8:	41 81 e4 ff 03 00 00 	and    $0x3ff,%r12d
+  8000bf:	4b 8d 1c e4          	lea    (%r12,%r12,8),%rbx
+  8000c3:	48 01 db             	add    %rbx,%rbx
+  8000c6:	4a 8d 34 23          	lea    (%rbx,%r12,1),%rsi
+  8000ca:	69 f6 1b ca 6b 28    	imul   $0x286bca1b,%esi,%esi
+  8000d0:	48 bf 1d 3b 80 00 00 	movabs $0x803b1d,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	41 ff d6             	call   *%r14
+    dup(p[0], 10);
+  8000e2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000e7:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000ea:	48 b8 71 1e 80 00 00 	movabs $0x801e71,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000f6:	4c 01 e3             	add    %r12,%rbx
+  8000f9:	48 c1 e3 04          	shl    $0x4,%rbx
+  8000fd:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800104:	00 00 00 
+  800107:	48 01 d8             	add    %rbx,%rax
+  80010a:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800110:	83 f8 02             	cmp    $0x2,%eax
+  800113:	75 3e                	jne    800153 <umain+0x12e>
+        dup(p[0], 10);
+  800115:	49 bc 71 1e 80 00 00 	movabs $0x801e71,%r12
+  80011c:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  80011f:	4d 63 ed             	movslq %r13d,%r13
+  800122:	4b 8d 44 ed 00       	lea    0x0(%r13,%r13,8),%rax
+  800127:	49 8d 44 45 00       	lea    0x0(%r13,%rax,2),%rax
+  80012c:	48 c1 e0 04          	shl    $0x4,%rax
+  800130:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  800137:	00 00 00 
+  80013a:	48 01 c3             	add    %rax,%rbx
+        dup(p[0], 10);
+  80013d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800142:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800145:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  800148:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  80014e:	83 f8 02             	cmp    $0x2,%eax
+  800151:	74 ea                	je     80013d <umain+0x118>
+
+    cprintf("child done with loop\n");
+  800153:	48 bf 28 3b 80 00 00 	movabs $0x803b28,%rdi
+  80015a:	00 00 00 
+  80015d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800162:	48 ba 7c 05 80 00 00 	movabs $0x80057c,%rdx
+  800169:	00 00 00 
+  80016c:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80016e:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800171:	48 b8 69 36 80 00 00 	movabs $0x803669,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	85 c0                	test   %eax,%eax
+  80017f:	0f 85 5a 01 00 00    	jne    8002df <umain+0x2ba>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800185:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800189:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80018c:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	0f 88 69 01 00 00    	js     800309 <umain+0x2e4>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  8001a0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8001a4:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  8001ab:	00 00 00 
+  8001ae:	ff d0                	call   *%rax
+  8001b0:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  8001b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001b8:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+  8001c4:	83 f8 04             	cmp    $0x4,%eax
+  8001c7:	0f 84 69 01 00 00    	je     800336 <umain+0x311>
+        cprintf("\nchild detected race\n");
+  8001cd:	48 bf 56 3b 80 00 00 	movabs $0x803b56,%rdi
+  8001d4:	00 00 00 
+  8001d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001dc:	48 ba 7c 05 80 00 00 	movabs $0x80057c,%rdx
+  8001e3:	00 00 00 
+  8001e6:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001e8:	48 83 c4 28          	add    $0x28,%rsp
+  8001ec:	5b                   	pop    %rbx
+  8001ed:	41 5c                	pop    %r12
+  8001ef:	41 5d                	pop    %r13
+  8001f1:	41 5e                	pop    %r14
+  8001f3:	41 5f                	pop    %r15
+  8001f5:	5d                   	pop    %rbp
+  8001f6:	c3                   	ret
+        panic("pipe: %i", r);
+  8001f7:	89 c1                	mov    %eax,%ecx
+  8001f9:	48 ba d1 3a 80 00 00 	movabs $0x803ad1,%rdx
+  800200:	00 00 00 
+  800203:	be 0c 00 00 00       	mov    $0xc,%esi
+  800208:	48 bf da 3a 80 00 00 	movabs $0x803ada,%rdi
+  80020f:	00 00 00 
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	49 b8 2c 04 80 00 00 	movabs $0x80042c,%r8
+  80021e:	00 00 00 
+  800221:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800224:	89 c1                	mov    %eax,%ecx
+  800226:	48 ba ee 3a 80 00 00 	movabs $0x803aee,%rdx
+  80022d:	00 00 00 
+  800230:	be 0f 00 00 00       	mov    $0xf,%esi
+  800235:	48 bf da 3a 80 00 00 	movabs $0x803ada,%rdi
+  80023c:	00 00 00 
+  80023f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800244:	49 b8 2c 04 80 00 00 	movabs $0x80042c,%r8
+  80024b:	00 00 00 
+  80024e:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800251:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800254:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  80025b:	00 00 00 
+  80025e:	ff d0                	call   *%rax
+  800260:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  800265:	49 bc 69 36 80 00 00 	movabs $0x803669,%r12
+  80026c:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  80026f:	49 bf f7 3a 80 00 00 	movabs $0x803af7,%r15
+  800276:	00 00 00 
+  800279:	49 be 7c 05 80 00 00 	movabs $0x80057c,%r14
+  800280:	00 00 00 
+                exit();
+  800283:	49 bd 09 04 80 00 00 	movabs $0x800409,%r13
+  80028a:	00 00 00 
+  80028d:	eb 11                	jmp    8002a0 <umain+0x27b>
+            sys_yield();
+  80028f:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  80029b:	83 eb 01             	sub    $0x1,%ebx
+  80029e:	74 1a                	je     8002ba <umain+0x295>
+            if (pipeisclosed(p[0])) {
+  8002a0:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8002a3:	41 ff d4             	call   *%r12
+  8002a6:	85 c0                	test   %eax,%eax
+  8002a8:	74 e5                	je     80028f <umain+0x26a>
+                cprintf("RACE: pipe appears closed\n");
+  8002aa:	4c 89 ff             	mov    %r15,%rdi
+  8002ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b2:	41 ff d6             	call   *%r14
+                exit();
+  8002b5:	41 ff d5             	call   *%r13
+  8002b8:	eb d5                	jmp    80028f <umain+0x26a>
+        ipc_recv(0, 0, 0, 0);
+  8002ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ce:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+  8002da:	e9 ab fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002df:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8002e6:	00 00 00 
+  8002e9:	be 38 00 00 00       	mov    $0x38,%esi
+  8002ee:	48 bf da 3a 80 00 00 	movabs $0x803ada,%rdi
+  8002f5:	00 00 00 
+  8002f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fd:	48 b9 2c 04 80 00 00 	movabs $0x80042c,%rcx
+  800304:	00 00 00 
+  800307:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba 3e 3b 80 00 00 	movabs $0x803b3e,%rdx
+  800312:	00 00 00 
+  800315:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80031a:	48 bf da 3a 80 00 00 	movabs $0x803ada,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 2c 04 80 00 00 	movabs $0x80042c,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  800336:	be c8 00 00 00       	mov    $0xc8,%esi
+  80033b:	48 bf a0 3b 80 00 00 	movabs $0x803ba0,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	48 ba 7c 05 80 00 00 	movabs $0x80057c,%rdx
+  800351:	00 00 00 
+  800354:	ff d2                	call   *%rdx
+}
+  800356:	e9 8d fe ff ff       	jmp    8001e8 <umain+0x1c3>
+
+000000000080035b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80035b:	55                   	push   %rbp
+  80035c:	48 89 e5             	mov    %rsp,%rbp
+  80035f:	41 56                	push   %r14
+  800361:	41 55                	push   %r13
+  800363:	41 54                	push   %r12
+  800365:	53                   	push   %rbx
+  800366:	41 89 fd             	mov    %edi,%r13d
+  800369:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036c:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800373:	00 00 00 
+  800376:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  80037d:	00 00 00 
+  800380:	48 39 c2             	cmp    %rax,%rdx
+  800383:	73 17                	jae    80039c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800385:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800388:	49 89 c4             	mov    %rax,%r12
+  80038b:	48 83 c3 08          	add    $0x8,%rbx
+  80038f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800394:	ff 53 f8             	call   *-0x8(%rbx)
+  800397:	4c 39 e3             	cmp    %r12,%rbx
+  80039a:	72 ef                	jb     80038b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80039c:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  8003a3:	00 00 00 
+  8003a6:	ff d0                	call   *%rax
+  8003a8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ad:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8003b1:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8003b5:	48 c1 e0 04          	shl    $0x4,%rax
+  8003b9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003c0:	00 00 00 
+  8003c3:	48 01 d0             	add    %rdx,%rax
+  8003c6:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003cd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003d0:	45 85 ed             	test   %r13d,%r13d
+  8003d3:	7e 0d                	jle    8003e2 <libmain+0x87>
+  8003d5:	49 8b 06             	mov    (%r14),%rax
+  8003d8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003df:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003e2:	4c 89 f6             	mov    %r14,%rsi
+  8003e5:	44 89 ef             	mov    %r13d,%edi
+  8003e8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003f4:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+#endif
+}
+  800400:	5b                   	pop    %rbx
+  800401:	41 5c                	pop    %r12
+  800403:	41 5d                	pop    %r13
+  800405:	41 5e                	pop    %r14
+  800407:	5d                   	pop    %rbp
+  800408:	c3                   	ret
+
+0000000000800409 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800409:	55                   	push   %rbp
+  80040a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80040d:	48 b8 49 1e 80 00 00 	movabs $0x801e49,%rax
+  800414:	00 00 00 
+  800417:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800419:	bf 00 00 00 00       	mov    $0x0,%edi
+  80041e:	48 b8 02 14 80 00 00 	movabs $0x801402,%rax
+  800425:	00 00 00 
+  800428:	ff d0                	call   *%rax
+}
+  80042a:	5d                   	pop    %rbp
+  80042b:	c3                   	ret
+
+000000000080042c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80042c:	55                   	push   %rbp
+  80042d:	48 89 e5             	mov    %rsp,%rbp
+  800430:	41 56                	push   %r14
+  800432:	41 55                	push   %r13
+  800434:	41 54                	push   %r12
+  800436:	53                   	push   %rbx
+  800437:	48 83 ec 50          	sub    $0x50,%rsp
+  80043b:	49 89 fc             	mov    %rdi,%r12
+  80043e:	41 89 f5             	mov    %esi,%r13d
+  800441:	48 89 d3             	mov    %rdx,%rbx
+  800444:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800448:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80044c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800450:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800457:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80045b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80045f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800463:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800467:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80046e:	00 00 00 
+  800471:	4c 8b 30             	mov    (%rax),%r14
+  800474:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  80047b:	00 00 00 
+  80047e:	ff d0                	call   *%rax
+  800480:	89 c6                	mov    %eax,%esi
+  800482:	45 89 e8             	mov    %r13d,%r8d
+  800485:	4c 89 e1             	mov    %r12,%rcx
+  800488:	4c 89 f2             	mov    %r14,%rdx
+  80048b:	48 bf d8 3b 80 00 00 	movabs $0x803bd8,%rdi
+  800492:	00 00 00 
+  800495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049a:	49 bc 7c 05 80 00 00 	movabs $0x80057c,%r12
+  8004a1:	00 00 00 
+  8004a4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004a7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004ab:	48 89 df             	mov    %rbx,%rdi
+  8004ae:	48 b8 18 05 80 00 00 	movabs $0x800518,%rax
+  8004b5:	00 00 00 
+  8004b8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004ba:	48 bf cf 3a 80 00 00 	movabs $0x803acf,%rdi
+  8004c1:	00 00 00 
+  8004c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004cc:	cc                   	int3
+  8004cd:	eb fd                	jmp    8004cc <_panic+0xa0>
+
+00000000008004cf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004cf:	55                   	push   %rbp
+  8004d0:	48 89 e5             	mov    %rsp,%rbp
+  8004d3:	53                   	push   %rbx
+  8004d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004db:	8b 06                	mov    (%rsi),%eax
+  8004dd:	8d 50 01             	lea    0x1(%rax),%edx
+  8004e0:	89 16                	mov    %edx,(%rsi)
+  8004e2:	48 98                	cltq
+  8004e4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004e9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004ef:	74 0a                	je     8004fb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004f1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f9:	c9                   	leave
+  8004fa:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004fb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004ff:	be ff 00 00 00       	mov    $0xff,%esi
+  800504:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  80050b:	00 00 00 
+  80050e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800510:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800516:	eb d9                	jmp    8004f1 <putch+0x22>
+
+0000000000800518 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800518:	55                   	push   %rbp
+  800519:	48 89 e5             	mov    %rsp,%rbp
+  80051c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800523:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800526:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80052d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800532:	b8 00 00 00 00       	mov    $0x0,%eax
+  800537:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80053a:	48 89 f1             	mov    %rsi,%rcx
+  80053d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800544:	48 bf cf 04 80 00 00 	movabs $0x8004cf,%rdi
+  80054b:	00 00 00 
+  80054e:	48 b8 cc 06 80 00 00 	movabs $0x8006cc,%rax
+  800555:	00 00 00 
+  800558:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80055a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800561:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800568:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  80056f:	00 00 00 
+  800572:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800574:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80057a:	c9                   	leave
+  80057b:	c3                   	ret
+
+000000000080057c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80057c:	55                   	push   %rbp
+  80057d:	48 89 e5             	mov    %rsp,%rbp
+  800580:	48 83 ec 50          	sub    $0x50,%rsp
+  800584:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800588:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80058c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800590:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800594:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800598:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80059f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005af:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005b3:	48 b8 18 05 80 00 00 	movabs $0x800518,%rax
+  8005ba:	00 00 00 
+  8005bd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005bf:	c9                   	leave
+  8005c0:	c3                   	ret
+
+00000000008005c1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005c1:	55                   	push   %rbp
+  8005c2:	48 89 e5             	mov    %rsp,%rbp
+  8005c5:	41 57                	push   %r15
+  8005c7:	41 56                	push   %r14
+  8005c9:	41 55                	push   %r13
+  8005cb:	41 54                	push   %r12
+  8005cd:	53                   	push   %rbx
+  8005ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8005d2:	49 89 fc             	mov    %rdi,%r12
+  8005d5:	49 89 f5             	mov    %rsi,%r13
+  8005d8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005dc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005df:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005e2:	41 89 cf             	mov    %ecx,%r15d
+  8005e5:	4c 39 fa             	cmp    %r15,%rdx
+  8005e8:	73 5b                	jae    800645 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005ea:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005ee:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005f2:	85 db                	test   %ebx,%ebx
+  8005f4:	7e 0e                	jle    800604 <print_num+0x43>
+            putch(padc, put_arg);
+  8005f6:	4c 89 ee             	mov    %r13,%rsi
+  8005f9:	44 89 f7             	mov    %r14d,%edi
+  8005fc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005ff:	83 eb 01             	sub    $0x1,%ebx
+  800602:	75 f2                	jne    8005f6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800604:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800608:	48 b9 0c 3c 80 00 00 	movabs $0x803c0c,%rcx
+  80060f:	00 00 00 
+  800612:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  800619:	00 00 00 
+  80061c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800620:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800624:	ba 00 00 00 00       	mov    $0x0,%edx
+  800629:	49 f7 f7             	div    %r15
+  80062c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800630:	4c 89 ee             	mov    %r13,%rsi
+  800633:	41 ff d4             	call   *%r12
+}
+  800636:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80063a:	5b                   	pop    %rbx
+  80063b:	41 5c                	pop    %r12
+  80063d:	41 5d                	pop    %r13
+  80063f:	41 5e                	pop    %r14
+  800641:	41 5f                	pop    %r15
+  800643:	5d                   	pop    %rbp
+  800644:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800645:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800649:	ba 00 00 00 00       	mov    $0x0,%edx
+  80064e:	49 f7 f7             	div    %r15
+  800651:	48 83 ec 08          	sub    $0x8,%rsp
+  800655:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800659:	52                   	push   %rdx
+  80065a:	45 0f be c9          	movsbl %r9b,%r9d
+  80065e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800662:	48 89 c2             	mov    %rax,%rdx
+  800665:	48 b8 c1 05 80 00 00 	movabs $0x8005c1,%rax
+  80066c:	00 00 00 
+  80066f:	ff d0                	call   *%rax
+  800671:	48 83 c4 10          	add    $0x10,%rsp
+  800675:	eb 8d                	jmp    800604 <print_num+0x43>
+
+0000000000800677 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800677:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80067b:	48 8b 06             	mov    (%rsi),%rax
+  80067e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800682:	73 0a                	jae    80068e <sprintputch+0x17>
+        *state->start++ = ch;
+  800684:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800688:	48 89 16             	mov    %rdx,(%rsi)
+  80068b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80068e:	c3                   	ret
+
+000000000080068f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80068f:	55                   	push   %rbp
+  800690:	48 89 e5             	mov    %rsp,%rbp
+  800693:	48 83 ec 50          	sub    $0x50,%rsp
+  800697:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80069b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80069f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006a3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006aa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006ba:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006be:	48 b8 cc 06 80 00 00 	movabs $0x8006cc,%rax
+  8006c5:	00 00 00 
+  8006c8:	ff d0                	call   *%rax
+}
+  8006ca:	c9                   	leave
+  8006cb:	c3                   	ret
+
+00000000008006cc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006cc:	55                   	push   %rbp
+  8006cd:	48 89 e5             	mov    %rsp,%rbp
+  8006d0:	41 57                	push   %r15
+  8006d2:	41 56                	push   %r14
+  8006d4:	41 55                	push   %r13
+  8006d6:	41 54                	push   %r12
+  8006d8:	53                   	push   %rbx
+  8006d9:	48 83 ec 38          	sub    $0x38,%rsp
+  8006dd:	49 89 fe             	mov    %rdi,%r14
+  8006e0:	49 89 f5             	mov    %rsi,%r13
+  8006e3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006e6:	48 8b 01             	mov    (%rcx),%rax
+  8006e9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006ed:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006fd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800701:	0f b6 3b             	movzbl (%rbx),%edi
+  800704:	40 80 ff 25          	cmp    $0x25,%dil
+  800708:	74 18                	je     800722 <vprintfmt+0x56>
+            if (!ch) return;
+  80070a:	40 84 ff             	test   %dil,%dil
+  80070d:	0f 84 b1 06 00 00    	je     800dc4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800713:	40 0f b6 ff          	movzbl %dil,%edi
+  800717:	4c 89 ee             	mov    %r13,%rsi
+  80071a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80071d:	4c 89 e3             	mov    %r12,%rbx
+  800720:	eb db                	jmp    8006fd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800722:	be 00 00 00 00       	mov    $0x0,%esi
+  800727:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80072b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800730:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800736:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80073d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800741:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800746:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80074b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80074e:	83 e8 23             	sub    $0x23,%eax
+  800751:	3c 57                	cmp    $0x57,%al
+  800753:	0f 87 51 06 00 00    	ja     800daa <vprintfmt+0x6de>
+  800759:	0f b6 c0             	movzbl %al,%eax
+  80075c:	48 b9 a0 3d 80 00 00 	movabs $0x803da0,%rcx
+  800763:	00 00 00 
+  800766:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800769:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80076c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800770:	eb cf                	jmp    800741 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800772:	49 89 dc             	mov    %rbx,%r12
+  800775:	be 01 00 00 00       	mov    $0x1,%esi
+  80077a:	eb c5                	jmp    800741 <vprintfmt+0x75>
+            padc = ch;
+  80077c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800780:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800786:	eb b9                	jmp    800741 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078b:	83 f8 2f             	cmp    $0x2f,%eax
+  80078e:	77 24                	ja     8007b4 <vprintfmt+0xe8>
+  800790:	89 c1                	mov    %eax,%ecx
+  800792:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800796:	83 c0 08             	add    $0x8,%eax
+  800799:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80079f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a6:	79 99                	jns    800741 <vprintfmt+0x75>
+                width = precision;
+  8007a8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007ac:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007b2:	eb 8d                	jmp    800741 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007b4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007b8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c0:	eb da                	jmp    80079c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007c2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007c7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007cb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007d1:	3c 39                	cmp    $0x39,%al
+  8007d3:	77 1c                	ja     8007f1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007d5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007d9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007dd:	0f b6 c0             	movzbl %al,%eax
+  8007e0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e5:	0f b6 03             	movzbl (%rbx),%eax
+  8007e8:	3c 39                	cmp    $0x39,%al
+  8007ea:	76 e9                	jbe    8007d5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007ec:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007ef:	eb b1                	jmp    8007a2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007f1:	49 89 dc             	mov    %rbx,%r12
+  8007f4:	eb ac                	jmp    8007a2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007f6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f9:	85 c9                	test   %ecx,%ecx
+  8007fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800800:	0f 49 c1             	cmovns %ecx,%eax
+  800803:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800806:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800809:	e9 33 ff ff ff       	jmp    800741 <vprintfmt+0x75>
+            lflag++;
+  80080e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800811:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800814:	e9 28 ff ff ff       	jmp    800741 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800819:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081c:	83 f8 2f             	cmp    $0x2f,%eax
+  80081f:	77 19                	ja     80083a <vprintfmt+0x16e>
+  800821:	89 c2                	mov    %eax,%edx
+  800823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800827:	83 c0 08             	add    $0x8,%eax
+  80082a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082d:	8b 3a                	mov    (%rdx),%edi
+  80082f:	4c 89 ee             	mov    %r13,%rsi
+  800832:	41 ff d6             	call   *%r14
+            break;
+  800835:	e9 c3 fe ff ff       	jmp    8006fd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80083a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800842:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800846:	eb e5                	jmp    80082d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800848:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084b:	83 f8 2f             	cmp    $0x2f,%eax
+  80084e:	77 5a                	ja     8008aa <vprintfmt+0x1de>
+  800850:	89 c2                	mov    %eax,%edx
+  800852:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800856:	83 c0 08             	add    $0x8,%eax
+  800859:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80085c:	8b 02                	mov    (%rdx),%eax
+  80085e:	89 c1                	mov    %eax,%ecx
+  800860:	f7 d9                	neg    %ecx
+  800862:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800865:	83 f9 14             	cmp    $0x14,%ecx
+  800868:	7f 4e                	jg     8008b8 <vprintfmt+0x1ec>
+  80086a:	48 63 c1             	movslq %ecx,%rax
+  80086d:	48 ba 60 40 80 00 00 	movabs $0x804060,%rdx
+  800874:	00 00 00 
+  800877:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80087b:	48 85 c0             	test   %rax,%rax
+  80087e:	74 38                	je     8008b8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800880:	48 89 c1             	mov    %rax,%rcx
+  800883:	48 ba 79 42 80 00 00 	movabs $0x804279,%rdx
+  80088a:	00 00 00 
+  80088d:	4c 89 ee             	mov    %r13,%rsi
+  800890:	4c 89 f7             	mov    %r14,%rdi
+  800893:	b8 00 00 00 00       	mov    $0x0,%eax
+  800898:	49 b8 8f 06 80 00 00 	movabs $0x80068f,%r8
+  80089f:	00 00 00 
+  8008a2:	41 ff d0             	call   *%r8
+  8008a5:	e9 53 fe ff ff       	jmp    8006fd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b6:	eb a4                	jmp    80085c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008b8:	48 ba 24 3c 80 00 00 	movabs $0x803c24,%rdx
+  8008bf:	00 00 00 
+  8008c2:	4c 89 ee             	mov    %r13,%rsi
+  8008c5:	4c 89 f7             	mov    %r14,%rdi
+  8008c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cd:	49 b8 8f 06 80 00 00 	movabs $0x80068f,%r8
+  8008d4:	00 00 00 
+  8008d7:	41 ff d0             	call   *%r8
+  8008da:	e9 1e fe ff ff       	jmp    8006fd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e5:	77 6c                	ja     800953 <vprintfmt+0x287>
+  8008e7:	89 c2                	mov    %eax,%edx
+  8008e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ed:	83 c0 08             	add    $0x8,%eax
+  8008f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008f6:	48 85 d2             	test   %rdx,%rdx
+  8008f9:	48 b8 1d 3c 80 00 00 	movabs $0x803c1d,%rax
+  800900:	00 00 00 
+  800903:	48 0f 45 c2          	cmovne %rdx,%rax
+  800907:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80090b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80090f:	7e 06                	jle    800917 <vprintfmt+0x24b>
+  800911:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800915:	75 4a                	jne    800961 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800917:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80091b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80091f:	0f b6 00             	movzbl (%rax),%eax
+  800922:	84 c0                	test   %al,%al
+  800924:	0f 85 9a 00 00 00    	jne    8009c4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80092a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800931:	85 c0                	test   %eax,%eax
+  800933:	0f 8e c4 fd ff ff    	jle    8006fd <vprintfmt+0x31>
+  800939:	4c 89 ee             	mov    %r13,%rsi
+  80093c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800941:	41 ff d6             	call   *%r14
+  800944:	41 83 ec 01          	sub    $0x1,%r12d
+  800948:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80094c:	75 eb                	jne    800939 <vprintfmt+0x26d>
+  80094e:	e9 aa fd ff ff       	jmp    8006fd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800953:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800957:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095f:	eb 92                	jmp    8008f3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800961:	49 63 f7             	movslq %r15d,%rsi
+  800964:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800968:	48 b8 7e 0e 80 00 00 	movabs $0x800e7e,%rax
+  80096f:	00 00 00 
+  800972:	ff d0                	call   *%rax
+  800974:	48 89 c2             	mov    %rax,%rdx
+  800977:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80097a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80097c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80097f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800982:	85 c0                	test   %eax,%eax
+  800984:	7e 91                	jle    800917 <vprintfmt+0x24b>
+  800986:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80098b:	4c 89 ee             	mov    %r13,%rsi
+  80098e:	44 89 e7             	mov    %r12d,%edi
+  800991:	41 ff d6             	call   *%r14
+  800994:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800998:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80099b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80099e:	75 eb                	jne    80098b <vprintfmt+0x2bf>
+  8009a0:	e9 72 ff ff ff       	jmp    800917 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a5:	0f b6 f8             	movzbl %al,%edi
+  8009a8:	4c 89 ee             	mov    %r13,%rsi
+  8009ab:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009ae:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b2:	49 83 c4 01          	add    $0x1,%r12
+  8009b6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009bc:	84 c0                	test   %al,%al
+  8009be:	0f 84 66 ff ff ff    	je     80092a <vprintfmt+0x25e>
+  8009c4:	45 85 ff             	test   %r15d,%r15d
+  8009c7:	78 0a                	js     8009d3 <vprintfmt+0x307>
+  8009c9:	41 83 ef 01          	sub    $0x1,%r15d
+  8009cd:	0f 88 57 ff ff ff    	js     80092a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009d7:	74 cc                	je     8009a5 <vprintfmt+0x2d9>
+  8009d9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009dc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009e1:	80 fa 5e             	cmp    $0x5e,%dl
+  8009e4:	77 c2                	ja     8009a8 <vprintfmt+0x2dc>
+  8009e6:	eb bd                	jmp    8009a5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e8:	40 84 f6             	test   %sil,%sil
+  8009eb:	75 26                	jne    800a13 <vprintfmt+0x347>
+    switch (lflag) {
+  8009ed:	85 d2                	test   %edx,%edx
+  8009ef:	74 59                	je     800a4a <vprintfmt+0x37e>
+  8009f1:	83 fa 01             	cmp    $0x1,%edx
+  8009f4:	74 7b                	je     800a71 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	0f 87 96 00 00 00    	ja     800a98 <vprintfmt+0x3cc>
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a08:	83 c0 08             	add    $0x8,%eax
+  800a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0e:	4c 8b 22             	mov    (%rdx),%r12
+  800a11:	eb 17                	jmp    800a2a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	77 21                	ja     800a3c <vprintfmt+0x370>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a27:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a2a:	4d 85 e4             	test   %r12,%r12
+  800a2d:	78 7a                	js     800aa9 <vprintfmt+0x3dd>
+            num = i;
+  800a2f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a37:	e9 50 02 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a48:	eb dd                	jmp    800a27 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a50:	77 11                	ja     800a63 <vprintfmt+0x397>
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a58:	83 c0 08             	add    $0x8,%eax
+  800a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5e:	4c 63 22             	movslq (%rdx),%r12
+  800a61:	eb c7                	jmp    800a2a <vprintfmt+0x35e>
+  800a63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6f:	eb ed                	jmp    800a5e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a74:	83 f8 2f             	cmp    $0x2f,%eax
+  800a77:	77 11                	ja     800a8a <vprintfmt+0x3be>
+  800a79:	89 c2                	mov    %eax,%edx
+  800a7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7f:	83 c0 08             	add    $0x8,%eax
+  800a82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a85:	4c 8b 22             	mov    (%rdx),%r12
+  800a88:	eb a0                	jmp    800a2a <vprintfmt+0x35e>
+  800a8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a96:	eb ed                	jmp    800a85 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	e9 65 ff ff ff       	jmp    800a0e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aa9:	4c 89 ee             	mov    %r13,%rsi
+  800aac:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ab1:	41 ff d6             	call   *%r14
+                i = -i;
+  800ab4:	49 f7 dc             	neg    %r12
+  800ab7:	e9 73 ff ff ff       	jmp    800a2f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800abc:	40 84 f6             	test   %sil,%sil
+  800abf:	75 32                	jne    800af3 <vprintfmt+0x427>
+    switch (lflag) {
+  800ac1:	85 d2                	test   %edx,%edx
+  800ac3:	74 5d                	je     800b22 <vprintfmt+0x456>
+  800ac5:	83 fa 01             	cmp    $0x1,%edx
+  800ac8:	0f 84 82 00 00 00    	je     800b50 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ace:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad4:	0f 87 a5 00 00 00    	ja     800b7f <vprintfmt+0x4b3>
+  800ada:	89 c2                	mov    %eax,%edx
+  800adc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae0:	83 c0 08             	add    $0x8,%eax
+  800ae3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aee:	e9 99 01 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af6:	83 f8 2f             	cmp    $0x2f,%eax
+  800af9:	77 19                	ja     800b14 <vprintfmt+0x448>
+  800afb:	89 c2                	mov    %eax,%edx
+  800afd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b01:	83 c0 08             	add    $0x8,%eax
+  800b04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b07:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b0f:	e9 78 01 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	eb e5                	jmp    800b07 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	77 18                	ja     800b42 <vprintfmt+0x476>
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b30:	83 c0 08             	add    $0x8,%eax
+  800b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b36:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b38:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b3d:	e9 4a 01 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+  800b42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4e:	eb e6                	jmp    800b36 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b53:	83 f8 2f             	cmp    $0x2f,%eax
+  800b56:	77 19                	ja     800b71 <vprintfmt+0x4a5>
+  800b58:	89 c2                	mov    %eax,%edx
+  800b5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5e:	83 c0 08             	add    $0x8,%eax
+  800b61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b64:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b67:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6c:	e9 1b 01 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+  800b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7d:	eb e5                	jmp    800b64 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8b:	e9 56 ff ff ff       	jmp    800ae6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b90:	40 84 f6             	test   %sil,%sil
+  800b93:	75 2e                	jne    800bc3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b95:	85 d2                	test   %edx,%edx
+  800b97:	74 59                	je     800bf2 <vprintfmt+0x526>
+  800b99:	83 fa 01             	cmp    $0x1,%edx
+  800b9c:	74 7f                	je     800c1d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba4:	0f 87 9f 00 00 00    	ja     800c49 <vprintfmt+0x57d>
+  800baa:	89 c2                	mov    %eax,%edx
+  800bac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb0:	83 c0 08             	add    $0x8,%eax
+  800bb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bbe:	e9 c9 00 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc9:	77 19                	ja     800be4 <vprintfmt+0x518>
+  800bcb:	89 c2                	mov    %eax,%edx
+  800bcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd1:	83 c0 08             	add    $0x8,%eax
+  800bd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bda:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bdf:	e9 a8 00 00 00       	jmp    800c8c <vprintfmt+0x5c0>
+  800be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf0:	eb e5                	jmp    800bd7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf8:	77 15                	ja     800c0f <vprintfmt+0x543>
+  800bfa:	89 c2                	mov    %eax,%edx
+  800bfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c00:	83 c0 08             	add    $0x8,%eax
+  800c03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c06:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c08:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c0d:	eb 7d                	jmp    800c8c <vprintfmt+0x5c0>
+  800c0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1b:	eb e9                	jmp    800c06 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c20:	83 f8 2f             	cmp    $0x2f,%eax
+  800c23:	77 16                	ja     800c3b <vprintfmt+0x56f>
+  800c25:	89 c2                	mov    %eax,%edx
+  800c27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2b:	83 c0 08             	add    $0x8,%eax
+  800c2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c39:	eb 51                	jmp    800c8c <vprintfmt+0x5c0>
+  800c3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c47:	eb e8                	jmp    800c31 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c55:	e9 5c ff ff ff       	jmp    800bb6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c5a:	4c 89 ee             	mov    %r13,%rsi
+  800c5d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c62:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c65:	4c 89 ee             	mov    %r13,%rsi
+  800c68:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c6d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c73:	83 f8 2f             	cmp    $0x2f,%eax
+  800c76:	77 47                	ja     800cbf <vprintfmt+0x5f3>
+  800c78:	89 c2                	mov    %eax,%edx
+  800c7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7e:	83 c0 08             	add    $0x8,%eax
+  800c81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c87:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c8c:	48 83 ec 08          	sub    $0x8,%rsp
+  800c90:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c94:	0f 94 c0             	sete   %al
+  800c97:	0f b6 c0             	movzbl %al,%eax
+  800c9a:	50                   	push   %rax
+  800c9b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ca0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ca4:	4c 89 ee             	mov    %r13,%rsi
+  800ca7:	4c 89 f7             	mov    %r14,%rdi
+  800caa:	48 b8 c1 05 80 00 00 	movabs $0x8005c1,%rax
+  800cb1:	00 00 00 
+  800cb4:	ff d0                	call   *%rax
+            break;
+  800cb6:	48 83 c4 10          	add    $0x10,%rsp
+  800cba:	e9 3e fa ff ff       	jmp    8006fd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccb:	eb b7                	jmp    800c84 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ccd:	40 84 f6             	test   %sil,%sil
+  800cd0:	75 2b                	jne    800cfd <vprintfmt+0x631>
+    switch (lflag) {
+  800cd2:	85 d2                	test   %edx,%edx
+  800cd4:	74 56                	je     800d2c <vprintfmt+0x660>
+  800cd6:	83 fa 01             	cmp    $0x1,%edx
+  800cd9:	74 7f                	je     800d5a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cde:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce1:	0f 87 a2 00 00 00    	ja     800d89 <vprintfmt+0x6bd>
+  800ce7:	89 c2                	mov    %eax,%edx
+  800ce9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ced:	83 c0 08             	add    $0x8,%eax
+  800cf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cfb:	eb 8f                	jmp    800c8c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d00:	83 f8 2f             	cmp    $0x2f,%eax
+  800d03:	77 19                	ja     800d1e <vprintfmt+0x652>
+  800d05:	89 c2                	mov    %eax,%edx
+  800d07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0b:	83 c0 08             	add    $0x8,%eax
+  800d0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d14:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d19:	e9 6e ff ff ff       	jmp    800c8c <vprintfmt+0x5c0>
+  800d1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2a:	eb e5                	jmp    800d11 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d32:	77 18                	ja     800d4c <vprintfmt+0x680>
+  800d34:	89 c2                	mov    %eax,%edx
+  800d36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3a:	83 c0 08             	add    $0x8,%eax
+  800d3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d40:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d42:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d47:	e9 40 ff ff ff       	jmp    800c8c <vprintfmt+0x5c0>
+  800d4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d58:	eb e6                	jmp    800d40 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d60:	77 19                	ja     800d7b <vprintfmt+0x6af>
+  800d62:	89 c2                	mov    %eax,%edx
+  800d64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d68:	83 c0 08             	add    $0x8,%eax
+  800d6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d71:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d76:	e9 11 ff ff ff       	jmp    800c8c <vprintfmt+0x5c0>
+  800d7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d87:	eb e5                	jmp    800d6e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d95:	e9 59 ff ff ff       	jmp    800cf3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d9a:	4c 89 ee             	mov    %r13,%rsi
+  800d9d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800da2:	41 ff d6             	call   *%r14
+            break;
+  800da5:	e9 53 f9 ff ff       	jmp    8006fd <vprintfmt+0x31>
+            putch('%', put_arg);
+  800daa:	4c 89 ee             	mov    %r13,%rsi
+  800dad:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800db5:	48 83 eb 01          	sub    $0x1,%rbx
+  800db9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dbd:	75 f6                	jne    800db5 <vprintfmt+0x6e9>
+  800dbf:	e9 39 f9 ff ff       	jmp    8006fd <vprintfmt+0x31>
+}
+  800dc4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dc8:	5b                   	pop    %rbx
+  800dc9:	41 5c                	pop    %r12
+  800dcb:	41 5d                	pop    %r13
+  800dcd:	41 5e                	pop    %r14
+  800dcf:	41 5f                	pop    %r15
+  800dd1:	5d                   	pop    %rbp
+  800dd2:	c3                   	ret
+
+0000000000800dd3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dd3:	55                   	push   %rbp
+  800dd4:	48 89 e5             	mov    %rsp,%rbp
+  800dd7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ddb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ddf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800de4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800de8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800def:	48 85 ff             	test   %rdi,%rdi
+  800df2:	74 2b                	je     800e1f <vsnprintf+0x4c>
+  800df4:	48 85 f6             	test   %rsi,%rsi
+  800df7:	74 26                	je     800e1f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800df9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dfd:	48 bf 77 06 80 00 00 	movabs $0x800677,%rdi
+  800e04:	00 00 00 
+  800e07:	48 b8 cc 06 80 00 00 	movabs $0x8006cc,%rax
+  800e0e:	00 00 00 
+  800e11:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e17:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e1d:	c9                   	leave
+  800e1e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e24:	eb f7                	jmp    800e1d <vsnprintf+0x4a>
+
+0000000000800e26 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+  800e2a:	48 83 ec 50          	sub    $0x50,%rsp
+  800e2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e32:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e36:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e3a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e49:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e51:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e55:	48 b8 d3 0d 80 00 00 	movabs $0x800dd3,%rax
+  800e5c:	00 00 00 
+  800e5f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e61:	c9                   	leave
+  800e62:	c3                   	ret
+
+0000000000800e63 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e63:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e66:	74 10                	je     800e78 <strlen+0x15>
+    size_t n = 0;
+  800e68:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e6d:	48 83 c0 01          	add    $0x1,%rax
+  800e71:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e75:	75 f6                	jne    800e6d <strlen+0xa>
+  800e77:	c3                   	ret
+    size_t n = 0;
+  800e78:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e7d:	c3                   	ret
+
+0000000000800e7e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e7e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e81:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e86:	48 85 f6             	test   %rsi,%rsi
+  800e89:	74 11                	je     800e9c <strnlen+0x1e>
+  800e8b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e8f:	74 0c                	je     800e9d <strnlen+0x1f>
+  800e91:	48 83 c2 01          	add    $0x1,%rdx
+  800e95:	48 39 d0             	cmp    %rdx,%rax
+  800e98:	75 f1                	jne    800e8b <strnlen+0xd>
+  800e9a:	eb 04                	jmp    800ea0 <strnlen+0x22>
+  800e9c:	c3                   	ret
+  800e9d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ea0:	c3                   	ret
+
+0000000000800ea1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ea1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ea4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ead:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eb0:	48 83 c2 01          	add    $0x1,%rdx
+  800eb4:	84 c9                	test   %cl,%cl
+  800eb6:	75 f1                	jne    800ea9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+  800ebd:	41 54                	push   %r12
+  800ebf:	53                   	push   %rbx
+  800ec0:	48 89 fb             	mov    %rdi,%rbx
+  800ec3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ec6:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  800ecd:	00 00 00 
+  800ed0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ed2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ed6:	4c 89 e6             	mov    %r12,%rsi
+  800ed9:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  800ee0:	00 00 00 
+  800ee3:	ff d0                	call   *%rax
+    return dst;
+}
+  800ee5:	48 89 d8             	mov    %rbx,%rax
+  800ee8:	5b                   	pop    %rbx
+  800ee9:	41 5c                	pop    %r12
+  800eeb:	5d                   	pop    %rbp
+  800eec:	c3                   	ret
+
+0000000000800eed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eed:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ef0:	48 85 d2             	test   %rdx,%rdx
+  800ef3:	74 1f                	je     800f14 <strncpy+0x27>
+  800ef5:	48 01 fa             	add    %rdi,%rdx
+  800ef8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800efb:	48 83 c1 01          	add    $0x1,%rcx
+  800eff:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f03:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f07:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f0b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f0f:	48 39 ca             	cmp    %rcx,%rdx
+  800f12:	75 e7                	jne    800efb <strncpy+0xe>
+    }
+    return ret;
+}
+  800f14:	c3                   	ret
+
+0000000000800f15 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f15:	48 89 f8             	mov    %rdi,%rax
+  800f18:	48 85 d2             	test   %rdx,%rdx
+  800f1b:	74 24                	je     800f41 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f1d:	48 83 ea 01          	sub    $0x1,%rdx
+  800f21:	74 1b                	je     800f3e <strlcpy+0x29>
+  800f23:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f27:	0f b6 16             	movzbl (%rsi),%edx
+  800f2a:	84 d2                	test   %dl,%dl
+  800f2c:	74 10                	je     800f3e <strlcpy+0x29>
+            *dst++ = *src++;
+  800f2e:	48 83 c6 01          	add    $0x1,%rsi
+  800f32:	48 83 c0 01          	add    $0x1,%rax
+  800f36:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f39:	48 39 c8             	cmp    %rcx,%rax
+  800f3c:	75 e9                	jne    800f27 <strlcpy+0x12>
+        *dst = '\0';
+  800f3e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f41:	48 29 f8             	sub    %rdi,%rax
+}
+  800f44:	c3                   	ret
+
+0000000000800f45 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f45:	0f b6 07             	movzbl (%rdi),%eax
+  800f48:	84 c0                	test   %al,%al
+  800f4a:	74 13                	je     800f5f <strcmp+0x1a>
+  800f4c:	38 06                	cmp    %al,(%rsi)
+  800f4e:	75 0f                	jne    800f5f <strcmp+0x1a>
+  800f50:	48 83 c7 01          	add    $0x1,%rdi
+  800f54:	48 83 c6 01          	add    $0x1,%rsi
+  800f58:	0f b6 07             	movzbl (%rdi),%eax
+  800f5b:	84 c0                	test   %al,%al
+  800f5d:	75 ed                	jne    800f4c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f5f:	0f b6 c0             	movzbl %al,%eax
+  800f62:	0f b6 16             	movzbl (%rsi),%edx
+  800f65:	29 d0                	sub    %edx,%eax
+}
+  800f67:	c3                   	ret
+
+0000000000800f68 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f68:	48 85 d2             	test   %rdx,%rdx
+  800f6b:	74 1f                	je     800f8c <strncmp+0x24>
+  800f6d:	0f b6 07             	movzbl (%rdi),%eax
+  800f70:	84 c0                	test   %al,%al
+  800f72:	74 1e                	je     800f92 <strncmp+0x2a>
+  800f74:	3a 06                	cmp    (%rsi),%al
+  800f76:	75 1a                	jne    800f92 <strncmp+0x2a>
+  800f78:	48 83 c7 01          	add    $0x1,%rdi
+  800f7c:	48 83 c6 01          	add    $0x1,%rsi
+  800f80:	48 83 ea 01          	sub    $0x1,%rdx
+  800f84:	75 e7                	jne    800f6d <strncmp+0x5>
+
+    if (!n) return 0;
+  800f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8b:	c3                   	ret
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f91:	c3                   	ret
+  800f92:	48 85 d2             	test   %rdx,%rdx
+  800f95:	74 09                	je     800fa0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f97:	0f b6 07             	movzbl (%rdi),%eax
+  800f9a:	0f b6 16             	movzbl (%rsi),%edx
+  800f9d:	29 d0                	sub    %edx,%eax
+  800f9f:	c3                   	ret
+    if (!n) return 0;
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa5:	c3                   	ret
+
+0000000000800fa6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fa6:	0f b6 17             	movzbl (%rdi),%edx
+  800fa9:	84 d2                	test   %dl,%dl
+  800fab:	74 18                	je     800fc5 <strchr+0x1f>
+        if (*str == c) {
+  800fad:	0f be d2             	movsbl %dl,%edx
+  800fb0:	39 f2                	cmp    %esi,%edx
+  800fb2:	74 17                	je     800fcb <strchr+0x25>
+    for (; *str; str++) {
+  800fb4:	48 83 c7 01          	add    $0x1,%rdi
+  800fb8:	0f b6 17             	movzbl (%rdi),%edx
+  800fbb:	84 d2                	test   %dl,%dl
+  800fbd:	75 ee                	jne    800fad <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc4:	c3                   	ret
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	c3                   	ret
+  800fcb:	48 89 f8             	mov    %rdi,%rax
+}
+  800fce:	c3                   	ret
+
+0000000000800fcf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fcf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fd2:	0f b6 17             	movzbl (%rdi),%edx
+  800fd5:	84 d2                	test   %dl,%dl
+  800fd7:	74 13                	je     800fec <strfind+0x1d>
+  800fd9:	0f be d2             	movsbl %dl,%edx
+  800fdc:	39 f2                	cmp    %esi,%edx
+  800fde:	74 0b                	je     800feb <strfind+0x1c>
+  800fe0:	48 83 c0 01          	add    $0x1,%rax
+  800fe4:	0f b6 10             	movzbl (%rax),%edx
+  800fe7:	84 d2                	test   %dl,%dl
+  800fe9:	75 ee                	jne    800fd9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800feb:	c3                   	ret
+  800fec:	c3                   	ret
+
+0000000000800fed <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fed:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ff0:	48 89 f8             	mov    %rdi,%rax
+  800ff3:	48 f7 d8             	neg    %rax
+  800ff6:	83 e0 07             	and    $0x7,%eax
+  800ff9:	49 89 d1             	mov    %rdx,%r9
+  800ffc:	49 29 c1             	sub    %rax,%r9
+  800fff:	78 36                	js     801037 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801001:	40 0f b6 c6          	movzbl %sil,%eax
+  801005:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80100c:	01 01 01 
+  80100f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801013:	40 f6 c7 07          	test   $0x7,%dil
+  801017:	75 38                	jne    801051 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801019:	4c 89 c9             	mov    %r9,%rcx
+  80101c:	48 c1 f9 03          	sar    $0x3,%rcx
+  801020:	74 0c                	je     80102e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801022:	fc                   	cld
+  801023:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801026:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80102a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80102e:	4d 85 c9             	test   %r9,%r9
+  801031:	75 45                	jne    801078 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801033:	4c 89 c0             	mov    %r8,%rax
+  801036:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801037:	48 85 d2             	test   %rdx,%rdx
+  80103a:	74 f7                	je     801033 <memset+0x46>
+  80103c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80103f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801042:	48 83 c0 01          	add    $0x1,%rax
+  801046:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80104a:	48 39 c2             	cmp    %rax,%rdx
+  80104d:	75 f3                	jne    801042 <memset+0x55>
+  80104f:	eb e2                	jmp    801033 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801051:	40 f6 c7 01          	test   $0x1,%dil
+  801055:	74 06                	je     80105d <memset+0x70>
+  801057:	88 07                	mov    %al,(%rdi)
+  801059:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80105d:	40 f6 c7 02          	test   $0x2,%dil
+  801061:	74 07                	je     80106a <memset+0x7d>
+  801063:	66 89 07             	mov    %ax,(%rdi)
+  801066:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80106a:	40 f6 c7 04          	test   $0x4,%dil
+  80106e:	74 a9                	je     801019 <memset+0x2c>
+  801070:	89 07                	mov    %eax,(%rdi)
+  801072:	48 83 c7 04          	add    $0x4,%rdi
+  801076:	eb a1                	jmp    801019 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801078:	41 f6 c1 04          	test   $0x4,%r9b
+  80107c:	74 06                	je     801084 <memset+0x97>
+  80107e:	89 07                	mov    %eax,(%rdi)
+  801080:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801084:	41 f6 c1 02          	test   $0x2,%r9b
+  801088:	74 07                	je     801091 <memset+0xa4>
+  80108a:	66 89 07             	mov    %ax,(%rdi)
+  80108d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801091:	41 f6 c1 01          	test   $0x1,%r9b
+  801095:	74 9c                	je     801033 <memset+0x46>
+  801097:	88 07                	mov    %al,(%rdi)
+  801099:	eb 98                	jmp    801033 <memset+0x46>
+
+000000000080109b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80109b:	48 89 f8             	mov    %rdi,%rax
+  80109e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010a1:	48 39 fe             	cmp    %rdi,%rsi
+  8010a4:	73 3b                	jae    8010e1 <memmove+0x46>
+  8010a6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010aa:	48 39 d7             	cmp    %rdx,%rdi
+  8010ad:	73 32                	jae    8010e1 <memmove+0x46>
+        s += n;
+        d += n;
+  8010af:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010b3:	48 89 d6             	mov    %rdx,%rsi
+  8010b6:	48 09 fe             	or     %rdi,%rsi
+  8010b9:	48 09 ce             	or     %rcx,%rsi
+  8010bc:	40 f6 c6 07          	test   $0x7,%sil
+  8010c0:	75 12                	jne    8010d4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010c2:	48 83 ef 08          	sub    $0x8,%rdi
+  8010c6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010ca:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ce:	fd                   	std
+  8010cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010d2:	fc                   	cld
+  8010d3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010d4:	48 83 ef 01          	sub    $0x1,%rdi
+  8010d8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010dc:	fd                   	std
+  8010dd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010df:	eb f1                	jmp    8010d2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e1:	48 89 f2             	mov    %rsi,%rdx
+  8010e4:	48 09 c2             	or     %rax,%rdx
+  8010e7:	48 09 ca             	or     %rcx,%rdx
+  8010ea:	f6 c2 07             	test   $0x7,%dl
+  8010ed:	75 0c                	jne    8010fb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010ef:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010f3:	48 89 c7             	mov    %rax,%rdi
+  8010f6:	fc                   	cld
+  8010f7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010fa:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010fb:	48 89 c7             	mov    %rax,%rdi
+  8010fe:	fc                   	cld
+  8010ff:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801101:	c3                   	ret
+
+0000000000801102 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801102:	55                   	push   %rbp
+  801103:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801106:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  80110d:	00 00 00 
+  801110:	ff d0                	call   *%rax
+}
+  801112:	5d                   	pop    %rbp
+  801113:	c3                   	ret
+
+0000000000801114 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	41 57                	push   %r15
+  80111a:	41 56                	push   %r14
+  80111c:	41 55                	push   %r13
+  80111e:	41 54                	push   %r12
+  801120:	53                   	push   %rbx
+  801121:	48 83 ec 08          	sub    $0x8,%rsp
+  801125:	49 89 fe             	mov    %rdi,%r14
+  801128:	49 89 f7             	mov    %rsi,%r15
+  80112b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80112e:	48 89 f7             	mov    %rsi,%rdi
+  801131:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  801138:	00 00 00 
+  80113b:	ff d0                	call   *%rax
+  80113d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801140:	48 89 de             	mov    %rbx,%rsi
+  801143:	4c 89 f7             	mov    %r14,%rdi
+  801146:	48 b8 7e 0e 80 00 00 	movabs $0x800e7e,%rax
+  80114d:	00 00 00 
+  801150:	ff d0                	call   *%rax
+  801152:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801155:	48 39 c3             	cmp    %rax,%rbx
+  801158:	74 36                	je     801190 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80115a:	48 89 d8             	mov    %rbx,%rax
+  80115d:	4c 29 e8             	sub    %r13,%rax
+  801160:	49 39 c4             	cmp    %rax,%r12
+  801163:	73 31                	jae    801196 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801165:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80116a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80116e:	4c 89 fe             	mov    %r15,%rsi
+  801171:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  801178:	00 00 00 
+  80117b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80117d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801181:	48 83 c4 08          	add    $0x8,%rsp
+  801185:	5b                   	pop    %rbx
+  801186:	41 5c                	pop    %r12
+  801188:	41 5d                	pop    %r13
+  80118a:	41 5e                	pop    %r14
+  80118c:	41 5f                	pop    %r15
+  80118e:	5d                   	pop    %rbp
+  80118f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801190:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801194:	eb eb                	jmp    801181 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801196:	48 83 eb 01          	sub    $0x1,%rbx
+  80119a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80119e:	48 89 da             	mov    %rbx,%rdx
+  8011a1:	4c 89 fe             	mov    %r15,%rsi
+  8011a4:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  8011ab:	00 00 00 
+  8011ae:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011b0:	49 01 de             	add    %rbx,%r14
+  8011b3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011b8:	eb c3                	jmp    80117d <strlcat+0x69>
+
+00000000008011ba <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011ba:	48 85 d2             	test   %rdx,%rdx
+  8011bd:	74 2d                	je     8011ec <memcmp+0x32>
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011c4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011c8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011cd:	44 38 c1             	cmp    %r8b,%cl
+  8011d0:	75 0f                	jne    8011e1 <memcmp+0x27>
+    while (n-- > 0) {
+  8011d2:	48 83 c0 01          	add    $0x1,%rax
+  8011d6:	48 39 c2             	cmp    %rax,%rdx
+  8011d9:	75 e9                	jne    8011c4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011e1:	0f b6 c1             	movzbl %cl,%eax
+  8011e4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011e8:	44 29 c0             	sub    %r8d,%eax
+  8011eb:	c3                   	ret
+    return 0;
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f1:	c3                   	ret
+
+00000000008011f2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011f2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011f6:	48 39 c7             	cmp    %rax,%rdi
+  8011f9:	73 0f                	jae    80120a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011fb:	40 38 37             	cmp    %sil,(%rdi)
+  8011fe:	74 0e                	je     80120e <memfind+0x1c>
+    for (; src < end; src++) {
+  801200:	48 83 c7 01          	add    $0x1,%rdi
+  801204:	48 39 f8             	cmp    %rdi,%rax
+  801207:	75 f2                	jne    8011fb <memfind+0x9>
+  801209:	c3                   	ret
+  80120a:	48 89 f8             	mov    %rdi,%rax
+  80120d:	c3                   	ret
+  80120e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801211:	c3                   	ret
+
+0000000000801212 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801212:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801215:	0f b6 37             	movzbl (%rdi),%esi
+  801218:	40 80 fe 20          	cmp    $0x20,%sil
+  80121c:	74 06                	je     801224 <strtol+0x12>
+  80121e:	40 80 fe 09          	cmp    $0x9,%sil
+  801222:	75 13                	jne    801237 <strtol+0x25>
+  801224:	48 83 c7 01          	add    $0x1,%rdi
+  801228:	0f b6 37             	movzbl (%rdi),%esi
+  80122b:	40 80 fe 20          	cmp    $0x20,%sil
+  80122f:	74 f3                	je     801224 <strtol+0x12>
+  801231:	40 80 fe 09          	cmp    $0x9,%sil
+  801235:	74 ed                	je     801224 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801237:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80123a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80123d:	3c 01                	cmp    $0x1,%al
+  80123f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801243:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801249:	75 0f                	jne    80125a <strtol+0x48>
+  80124b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80124e:	74 14                	je     801264 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801250:	85 d2                	test   %edx,%edx
+  801252:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801257:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80125a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80125f:	4c 63 ca             	movslq %edx,%r9
+  801262:	eb 36                	jmp    80129a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801264:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801268:	74 0f                	je     801279 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80126a:	85 d2                	test   %edx,%edx
+  80126c:	75 ec                	jne    80125a <strtol+0x48>
+        s++;
+  80126e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801272:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801277:	eb e1                	jmp    80125a <strtol+0x48>
+        s += 2;
+  801279:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80127d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801282:	eb d6                	jmp    80125a <strtol+0x48>
+            dig -= '0';
+  801284:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801287:	44 0f b6 c1          	movzbl %cl,%r8d
+  80128b:	41 39 d0             	cmp    %edx,%r8d
+  80128e:	7d 21                	jge    8012b1 <strtol+0x9f>
+        val = val * base + dig;
+  801290:	49 0f af c1          	imul   %r9,%rax
+  801294:	0f b6 c9             	movzbl %cl,%ecx
+  801297:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80129a:	48 83 c7 01          	add    $0x1,%rdi
+  80129e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012a2:	80 f9 39             	cmp    $0x39,%cl
+  8012a5:	76 dd                	jbe    801284 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012a7:	80 f9 7b             	cmp    $0x7b,%cl
+  8012aa:	77 05                	ja     8012b1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012ac:	83 e9 57             	sub    $0x57,%ecx
+  8012af:	eb d6                	jmp    801287 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012b1:	4d 85 d2             	test   %r10,%r10
+  8012b4:	74 03                	je     8012b9 <strtol+0xa7>
+  8012b6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012b9:	48 89 c2             	mov    %rax,%rdx
+  8012bc:	48 f7 da             	neg    %rdx
+  8012bf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012c3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012c7:	c3                   	ret
+
+00000000008012c8 <strrev>:
+
+void
+strrev(char *str)
+{
+  8012c8:	55                   	push   %rbp
+  8012c9:	48 89 e5             	mov    %rsp,%rbp
+  8012cc:	53                   	push   %rbx
+  8012cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d1:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8012d4:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8012db:	00 00 00 
+  8012de:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8012e0:	83 e8 01             	sub    $0x1,%eax
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	7e 22                	jle    801309 <strrev+0x41>
+  8012e7:	48 98                	cltq
+  8012e9:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8012ee:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8012f2:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8012f6:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8012fa:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8012fd:	48 83 c2 01          	add    $0x1,%rdx
+  801301:	48 83 e8 01          	sub    $0x1,%rax
+  801305:	39 c2                	cmp    %eax,%edx
+  801307:	7c e5                	jl     8012ee <strrev+0x26>
+	}
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80130f:	85 d2                	test   %edx,%edx
+  801311:	0f 84 80 00 00 00    	je     801397 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801317:	55                   	push   %rbp
+  801318:	48 89 e5             	mov    %rsp,%rbp
+  80131b:	53                   	push   %rbx
+  80131c:	48 83 ec 08          	sub    $0x8,%rsp
+  801320:	49 89 f2             	mov    %rsi,%r10
+  801323:	41 89 d3             	mov    %edx,%r11d
+  801326:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801329:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80132e:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801331:	eb 20                	jmp    801353 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801333:	41 89 f1             	mov    %esi,%r9d
+  801336:	83 c2 30             	add    $0x30,%edx
+  801339:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80133c:	89 f8                	mov    %edi,%eax
+  80133e:	99                   	cltd
+  80133f:	f7 f9                	idiv   %ecx
+  801341:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801343:	85 c0                	test   %eax,%eax
+  801345:	74 2e                	je     801375 <itoa+0x66>
+  801347:	83 c6 01             	add    $0x1,%esi
+  80134a:	49 83 c0 01          	add    $0x1,%r8
+  80134e:	44 39 cb             	cmp    %r9d,%ebx
+  801351:	7e 15                	jle    801368 <itoa+0x59>
+		digit = sum % base;
+  801353:	89 f8                	mov    %edi,%eax
+  801355:	99                   	cltd
+  801356:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801358:	83 fa 09             	cmp    $0x9,%edx
+  80135b:	7e d6                	jle    801333 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80135d:	41 89 f1             	mov    %esi,%r9d
+  801360:	83 c2 37             	add    $0x37,%edx
+  801363:	41 88 10             	mov    %dl,(%r8)
+  801366:	eb d4                	jmp    80133c <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801368:	41 83 eb 01          	sub    $0x1,%r11d
+  80136c:	45 39 cb             	cmp    %r9d,%r11d
+  80136f:	75 04                	jne    801375 <itoa+0x66>
+  801371:	85 c0                	test   %eax,%eax
+  801373:	75 28                	jne    80139d <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801375:	4d 63 c9             	movslq %r9d,%r9
+  801378:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80137d:	4c 89 d7             	mov    %r10,%rdi
+  801380:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  801387:	00 00 00 
+  80138a:	ff d0                	call   *%rax
+	return 0;
+  80138c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+		return -1;
+  801397:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80139c:	c3                   	ret
+		return -1;
+  80139d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8013a2:	eb ed                	jmp    801391 <itoa+0x82>
+
+00000000008013a4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+  8013a9:	48 89 fa             	mov    %rdi,%rdx
+  8013ac:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013af:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013be:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cf:	c9                   	leave
+  8013d0:	c3                   	ret
+
+00000000008013d1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013d1:	55                   	push   %rbp
+  8013d2:	48 89 e5             	mov    %rsp,%rbp
+  8013d5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fa:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801400:	c9                   	leave
+  801401:	c3                   	ret
+
+0000000000801402 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801402:	55                   	push   %rbp
+  801403:	48 89 e5             	mov    %rsp,%rbp
+  801406:	53                   	push   %rbx
+  801407:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80140b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801413:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801418:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801422:	be 00 00 00 00       	mov    $0x0,%esi
+  801427:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142f:	48 85 c0             	test   %rax,%rax
+  801432:	7f 06                	jg     80143a <sys_env_destroy+0x38>
+}
+  801434:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143a:	49 89 c0             	mov    %rax,%r8
+  80143d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801442:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  801449:	00 00 00 
+  80144c:	be 26 00 00 00       	mov    $0x26,%esi
+  801451:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  801458:	00 00 00 
+  80145b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801460:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  801467:	00 00 00 
+  80146a:	41 ff d1             	call   *%r9
+
+000000000080146d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80146d:	55                   	push   %rbp
+  80146e:	48 89 e5             	mov    %rsp,%rbp
+  801471:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801472:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148b:	be 00 00 00 00       	mov    $0x0,%esi
+  801490:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801496:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801498:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149c:	c9                   	leave
+  80149d:	c3                   	ret
+
+000000000080149e <sys_yield>:
+
+void
+sys_yield(void) {
+  80149e:	55                   	push   %rbp
+  80149f:	48 89 e5             	mov    %rsp,%rbp
+  8014a2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+00000000008014cf <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	53                   	push   %rbx
+  8014d4:	48 89 fa             	mov    %rdi,%rdx
+  8014d7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014da:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014df:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014e6:	00 00 00 
+  8014e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ff:	c9                   	leave
+  801500:	c3                   	ret
+
+0000000000801501 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	49 89 f8             	mov    %rdi,%r8
+  801509:	48 89 d3             	mov    %rdx,%rbx
+  80150c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80150f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801514:	4c 89 c2             	mov    %r8,%rdx
+  801517:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151a:	be 00 00 00 00       	mov    $0x0,%esi
+  80151f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801525:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801527:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+000000000080152d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	53                   	push   %rbx
+  801532:	48 83 ec 08          	sub    $0x8,%rsp
+  801536:	89 f8                	mov    %edi,%eax
+  801538:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80153b:	48 63 f9             	movslq %ecx,%rdi
+  80153e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801541:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801546:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801554:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801556:	48 85 c0             	test   %rax,%rax
+  801559:	7f 06                	jg     801561 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80155b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801561:	49 89 c0             	mov    %rax,%r8
+  801564:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801569:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  801570:	00 00 00 
+  801573:	be 26 00 00 00       	mov    $0x26,%esi
+  801578:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  80157f:	00 00 00 
+  801582:	b8 00 00 00 00       	mov    $0x0,%eax
+  801587:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  80158e:	00 00 00 
+  801591:	41 ff d1             	call   *%r9
+
+0000000000801594 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	53                   	push   %rbx
+  801599:	48 83 ec 08          	sub    $0x8,%rsp
+  80159d:	89 f8                	mov    %edi,%eax
+  80159f:	49 89 f2             	mov    %rsi,%r10
+  8015a2:	48 89 cf             	mov    %rcx,%rdi
+  8015a5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015a8:	48 63 da             	movslq %edx,%rbx
+  8015ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015bb:	48 85 c0             	test   %rax,%rax
+  8015be:	7f 06                	jg     8015c6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c6:	49 89 c0             	mov    %rax,%r8
+  8015c9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015ce:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  8015d5:	00 00 00 
+  8015d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015dd:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  8015e4:	00 00 00 
+  8015e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ec:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  8015f3:	00 00 00 
+  8015f6:	41 ff d1             	call   *%r9
+
+00000000008015f9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+  8015fd:	53                   	push   %rbx
+  8015fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801602:	48 89 f1             	mov    %rsi,%rcx
+  801605:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801608:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801610:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801615:	be 00 00 00 00       	mov    $0x0,%esi
+  80161a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801620:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801622:	48 85 c0             	test   %rax,%rax
+  801625:	7f 06                	jg     80162d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801627:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162d:	49 89 c0             	mov    %rax,%r8
+  801630:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801635:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  80163c:	00 00 00 
+  80163f:	be 26 00 00 00       	mov    $0x26,%esi
+  801644:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  80164b:	00 00 00 
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  80165a:	00 00 00 
+  80165d:	41 ff d1             	call   *%r9
+
+0000000000801660 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801660:	55                   	push   %rbp
+  801661:	48 89 e5             	mov    %rsp,%rbp
+  801664:	53                   	push   %rbx
+  801665:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801669:	48 63 ce             	movslq %esi,%rcx
+  80166c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801674:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801679:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167e:	be 00 00 00 00       	mov    $0x0,%esi
+  801683:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801689:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168b:	48 85 c0             	test   %rax,%rax
+  80168e:	7f 06                	jg     801696 <sys_env_set_status+0x36>
+}
+  801690:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801696:	49 89 c0             	mov    %rax,%r8
+  801699:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80169e:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  8016a5:	00 00 00 
+  8016a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ad:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  8016b4:	00 00 00 
+  8016b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bc:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  8016c3:	00 00 00 
+  8016c6:	41 ff d1             	call   *%r9
+
+00000000008016c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016c9:	55                   	push   %rbp
+  8016ca:	48 89 e5             	mov    %rsp,%rbp
+  8016cd:	53                   	push   %rbx
+  8016ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f4:	48 85 c0             	test   %rax,%rax
+  8016f7:	7f 06                	jg     8016ff <sys_env_set_trapframe+0x36>
+}
+  8016f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fd:	c9                   	leave
+  8016fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ff:	49 89 c0             	mov    %rax,%r8
+  801702:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801707:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  80170e:	00 00 00 
+  801711:	be 26 00 00 00       	mov    $0x26,%esi
+  801716:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  80171d:	00 00 00 
+  801720:	b8 00 00 00 00       	mov    $0x0,%eax
+  801725:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  80172c:	00 00 00 
+  80172f:	41 ff d1             	call   *%r9
+
+0000000000801732 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801732:	55                   	push   %rbp
+  801733:	48 89 e5             	mov    %rsp,%rbp
+  801736:	53                   	push   %rbx
+  801737:	48 83 ec 08          	sub    $0x8,%rsp
+  80173b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80173e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801741:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801746:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801750:	be 00 00 00 00       	mov    $0x0,%esi
+  801755:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175d:	48 85 c0             	test   %rax,%rax
+  801760:	7f 06                	jg     801768 <sys_env_set_pgfault_upcall+0x36>
+}
+  801762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801768:	49 89 c0             	mov    %rax,%r8
+  80176b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801770:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  801777:	00 00 00 
+  80177a:	be 26 00 00 00       	mov    $0x26,%esi
+  80177f:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  801786:	00 00 00 
+  801789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178e:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  801795:	00 00 00 
+  801798:	41 ff d1             	call   *%r9
+
+000000000080179b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80179b:	55                   	push   %rbp
+  80179c:	48 89 e5             	mov    %rsp,%rbp
+  80179f:	53                   	push   %rbx
+  8017a0:	89 f8                	mov    %edi,%eax
+  8017a2:	49 89 f1             	mov    %rsi,%r9
+  8017a5:	48 89 d3             	mov    %rdx,%rbx
+  8017a8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017ab:	49 63 f0             	movslq %r8d,%rsi
+  8017ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bf:	cd 30                	int    $0x30
+}
+  8017c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+
+00000000008017c7 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	53                   	push   %rbx
+  8017cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d0:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8017d3:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017db:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f0:	48 85 c0             	test   %rax,%rax
+  8017f3:	7f 06                	jg     8017fb <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fb:	49 89 c0             	mov    %rax,%r8
+  8017fe:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801803:	48 ba 28 41 80 00 00 	movabs $0x804128,%rdx
+  80180a:	00 00 00 
+  80180d:	be 26 00 00 00       	mov    $0x26,%esi
+  801812:	48 bf 47 41 80 00 00 	movabs $0x804147,%rdi
+  801819:	00 00 00 
+  80181c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801821:	49 b9 2c 04 80 00 00 	movabs $0x80042c,%r9
+  801828:	00 00 00 
+  80182b:	41 ff d1             	call   *%r9
+
+000000000080182e <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801832:	ba 00 00 00 00       	mov    $0x0,%edx
+  801837:	48 b8 c7 17 80 00 00 	movabs $0x8017c7,%rax
+  80183e:	00 00 00 
+  801841:	ff d0                	call   *%rax
+}
+  801843:	5d                   	pop    %rbp
+  801844:	c3                   	ret
+
+0000000000801845 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801845:	55                   	push   %rbp
+  801846:	48 89 e5             	mov    %rsp,%rbp
+  801849:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80184a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801854:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801859:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801870:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801874:	c9                   	leave
+  801875:	c3                   	ret
+
+0000000000801876 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801876:	55                   	push   %rbp
+  801877:	48 89 e5             	mov    %rsp,%rbp
+  80187a:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  80187b:	48 63 ce             	movslq %esi,%rcx
+  80187e:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801882:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801887:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801891:	be 00 00 00 00       	mov    $0x0,%esi
+  801896:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189c:	cd 30                	int    $0x30
+}
+  80189e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+00000000008018a4 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8018a4:	55                   	push   %rbp
+  8018a5:	48 89 e5             	mov    %rsp,%rbp
+  8018a8:	53                   	push   %rbx
+  8018a9:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8018ac:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ca:	cd 30                	int    $0x30
+}
+  8018cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+
+00000000008018d2 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8018d2:	55                   	push   %rbp
+  8018d3:	48 89 e5             	mov    %rsp,%rbp
+  8018d6:	53                   	push   %rbx
+  8018d7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8018da:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018dd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e2:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f5:	cd 30                	int    $0x30
+}
+  8018f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fb:	c9                   	leave
+  8018fc:	c3                   	ret
+
+00000000008018fd <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8018fd:	55                   	push   %rbp
+  8018fe:	48 89 e5             	mov    %rsp,%rbp
+  801901:	41 54                	push   %r12
+  801903:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801904:	b8 08 00 00 00       	mov    $0x8,%eax
+  801909:	cd 30                	int    $0x30
+  80190b:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	78 7e                	js     801990 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801912:	0f 84 80 00 00 00    	je     801998 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801918:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80191e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801925:	00 00 00 
+  801928:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192d:	89 c2                	mov    %eax,%edx
+  80192f:	be 00 00 00 00       	mov    $0x0,%esi
+  801934:	bf 00 00 00 00       	mov    $0x0,%edi
+  801939:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  801940:	00 00 00 
+  801943:	ff d0                	call   *%rax
+  801945:	85 c0                	test   %eax,%eax
+  801947:	0f 88 81 00 00 00    	js     8019ce <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80194d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801954:	00 00 00 
+  801957:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  80195e:	44 89 e7             	mov    %r12d,%edi
+  801961:	48 b8 32 17 80 00 00 	movabs $0x801732,%rax
+  801968:	00 00 00 
+  80196b:	ff d0                	call   *%rax
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 65                	js     8019d6 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801971:	be 02 00 00 00       	mov    $0x2,%esi
+  801976:	44 89 e7             	mov    %r12d,%edi
+  801979:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801980:	00 00 00 
+  801983:	ff d0                	call   *%rax
+        return -1;
+  801985:	85 c0                	test   %eax,%eax
+  801987:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80198c:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801990:	44 89 e0             	mov    %r12d,%eax
+  801993:	5b                   	pop    %rbx
+  801994:	41 5c                	pop    %r12
+  801996:	5d                   	pop    %rbp
+  801997:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801998:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  80199f:	00 00 00 
+  8019a2:	ff d0                	call   *%rax
+  8019a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019a9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8019ad:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8019b1:	48 c1 e0 04          	shl    $0x4,%rax
+  8019b5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019bc:	00 00 00 
+  8019bf:	48 01 d0             	add    %rdx,%rax
+  8019c2:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8019c9:	00 00 00 
+        return 0;
+  8019cc:	eb c2                	jmp    801990 <fork+0x93>
+        return -1;
+  8019ce:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019d4:	eb ba                	jmp    801990 <fork+0x93>
+        return -1;
+  8019d6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019dc:	eb b2                	jmp    801990 <fork+0x93>
+
+00000000008019de <sfork>:
+
+envid_t
+sfork() {
+  8019de:	55                   	push   %rbp
+  8019df:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019e2:	48 ba 55 41 80 00 00 	movabs $0x804155,%rdx
+  8019e9:	00 00 00 
+  8019ec:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8019f1:	48 bf 70 41 80 00 00 	movabs $0x804170,%rdi
+  8019f8:	00 00 00 
+  8019fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a00:	48 b9 2c 04 80 00 00 	movabs $0x80042c,%rcx
+  801a07:	00 00 00 
+  801a0a:	ff d1                	call   *%rcx
+
+0000000000801a0c <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  801a0c:	55                   	push   %rbp
+  801a0d:	48 89 e5             	mov    %rsp,%rbp
+  801a10:	41 55                	push   %r13
+  801a12:	41 54                	push   %r12
+  801a14:	53                   	push   %rbx
+  801a15:	48 83 ec 08          	sub    $0x8,%rsp
+  801a19:	49 89 fc             	mov    %rdi,%r12
+  801a1c:	48 89 f7             	mov    %rsi,%rdi
+  801a1f:	48 89 d3             	mov    %rdx,%rbx
+  801a22:	49 89 cd             	mov    %rcx,%r13
+  801a25:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801a28:	48 85 f6             	test   %rsi,%rsi
+  801a2b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801a32:	00 00 00 
+  801a35:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  801a39:	be 00 10 00 00       	mov    $0x1000,%esi
+  801a3e:	48 85 db             	test   %rbx,%rbx
+  801a41:	74 03                	je     801a46 <ipc_recv_timed+0x3a>
+  801a43:	48 8b 33             	mov    (%rbx),%rsi
+  801a46:	48 b8 c7 17 80 00 00 	movabs $0x8017c7,%rax
+  801a4d:	00 00 00 
+  801a50:	ff d0                	call   *%rax
+    if (res < 0) {
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 75                	js     801acb <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  801a56:	4d 85 e4             	test   %r12,%r12
+  801a59:	74 14                	je     801a6f <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  801a5b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a62:	00 00 00 
+  801a65:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  801a6b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  801a6f:	4d 85 ed             	test   %r13,%r13
+  801a72:	74 14                	je     801a88 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  801a74:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a7b:	00 00 00 
+  801a7e:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  801a84:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  801a88:	48 85 db             	test   %rbx,%rbx
+  801a8b:	74 23                	je     801ab0 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801a8d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a94:	00 00 00 
+  801a97:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  801a9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa2:	85 c9                	test   %ecx,%ecx
+  801aa4:	74 07                	je     801aad <ipc_recv_timed+0xa1>
+  801aa6:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  801aad:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801ab0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ab7:	00 00 00 
+  801aba:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  801ac0:	48 83 c4 08          	add    $0x8,%rsp
+  801ac4:	5b                   	pop    %rbx
+  801ac5:	41 5c                	pop    %r12
+  801ac7:	41 5d                	pop    %r13
+  801ac9:	5d                   	pop    %rbp
+  801aca:	c3                   	ret
+        if (from_env_store != NULL) {
+  801acb:	4d 85 e4             	test   %r12,%r12
+  801ace:	74 08                	je     801ad8 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  801ad0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801ad7:	00 
+        if (perm_store != NULL) {
+  801ad8:	4d 85 ed             	test   %r13,%r13
+  801adb:	74 08                	je     801ae5 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  801add:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801ae4:	00 
+        if (size != NULL) {
+  801ae5:	48 85 db             	test   %rbx,%rbx
+  801ae8:	74 d6                	je     801ac0 <ipc_recv_timed+0xb4>
+            *size = 0;
+  801aea:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801af1:	eb cd                	jmp    801ac0 <ipc_recv_timed+0xb4>
+
+0000000000801af3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  801af7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801afd:	48 b8 0c 1a 80 00 00 	movabs $0x801a0c,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+}
+  801b09:	5d                   	pop    %rbp
+  801b0a:	c3                   	ret
+
+0000000000801b0b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801b0b:	55                   	push   %rbp
+  801b0c:	48 89 e5             	mov    %rsp,%rbp
+  801b0f:	41 57                	push   %r15
+  801b11:	41 56                	push   %r14
+  801b13:	41 55                	push   %r13
+  801b15:	41 54                	push   %r12
+  801b17:	53                   	push   %rbx
+  801b18:	48 83 ec 18          	sub    $0x18,%rsp
+  801b1c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  801b1f:	48 89 d3             	mov    %rdx,%rbx
+  801b22:	49 89 cc             	mov    %rcx,%r12
+  801b25:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801b28:	48 85 d2             	test   %rdx,%rdx
+  801b2b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801b32:	00 00 00 
+  801b35:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801b39:	89 f0                	mov    %esi,%eax
+  801b3b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801b3f:	48 89 da             	mov    %rbx,%rdx
+  801b42:	48 89 c6             	mov    %rax,%rsi
+  801b45:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  801b4c:	00 00 00 
+  801b4f:	ff d0                	call   *%rax
+    while (res < 0) {
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	79 65                	jns    801bba <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  801b55:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801b58:	75 33                	jne    801b8d <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  801b5a:	49 bf 9e 14 80 00 00 	movabs $0x80149e,%r15
+  801b61:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801b64:	49 be 9b 17 80 00 00 	movabs $0x80179b,%r14
+  801b6b:	00 00 00 
+        sys_yield();
+  801b6e:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801b71:	45 89 e8             	mov    %r13d,%r8d
+  801b74:	4c 89 e1             	mov    %r12,%rcx
+  801b77:	48 89 da             	mov    %rbx,%rdx
+  801b7a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b7e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  801b81:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	79 32                	jns    801bba <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  801b88:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801b8b:	74 e1                	je     801b6e <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  801b8d:	89 c1                	mov    %eax,%ecx
+  801b8f:	48 ba 7b 41 80 00 00 	movabs $0x80417b,%rdx
+  801b96:	00 00 00 
+  801b99:	be 52 00 00 00       	mov    $0x52,%esi
+  801b9e:	48 bf 8f 41 80 00 00 	movabs $0x80418f,%rdi
+  801ba5:	00 00 00 
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	49 b8 2c 04 80 00 00 	movabs $0x80042c,%r8
+  801bb4:	00 00 00 
+  801bb7:	41 ff d0             	call   *%r8
+    }
+}
+  801bba:	48 83 c4 18          	add    $0x18,%rsp
+  801bbe:	5b                   	pop    %rbx
+  801bbf:	41 5c                	pop    %r12
+  801bc1:	41 5d                	pop    %r13
+  801bc3:	41 5e                	pop    %r14
+  801bc5:	41 5f                	pop    %r15
+  801bc7:	5d                   	pop    %rbp
+  801bc8:	c3                   	ret
+
+0000000000801bc9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801bce:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801bd5:	00 00 00 
+  801bd8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801bdc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801be0:	48 c1 e2 04          	shl    $0x4,%rdx
+  801be4:	48 01 ca             	add    %rcx,%rdx
+  801be7:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801bed:	39 fa                	cmp    %edi,%edx
+  801bef:	74 12                	je     801c03 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  801bf1:	48 83 c0 01          	add    $0x1,%rax
+  801bf5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801bfb:	75 db                	jne    801bd8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c02:	c3                   	ret
+            return envs[i].env_id;
+  801c03:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c07:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c0b:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c0f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  801c16:	00 00 00 
+  801c19:	48 01 d0             	add    %rdx,%rax
+  801c1c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c22:	c3                   	ret
+
+0000000000801c23 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c23:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c2a:	ff ff ff 
+  801c2d:	48 01 f8             	add    %rdi,%rax
+  801c30:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c34:	c3                   	ret
+
+0000000000801c35 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c35:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c3c:	ff ff ff 
+  801c3f:	48 01 f8             	add    %rdi,%rax
+  801c42:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c46:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c4c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c50:	c3                   	ret
+
+0000000000801c51 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c51:	55                   	push   %rbp
+  801c52:	48 89 e5             	mov    %rsp,%rbp
+  801c55:	41 57                	push   %r15
+  801c57:	41 56                	push   %r14
+  801c59:	41 55                	push   %r13
+  801c5b:	41 54                	push   %r12
+  801c5d:	53                   	push   %rbx
+  801c5e:	48 83 ec 08          	sub    $0x8,%rsp
+  801c62:	49 89 ff             	mov    %rdi,%r15
+  801c65:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c6a:	49 bd 70 37 80 00 00 	movabs $0x803770,%r13
+  801c71:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c74:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c7a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c7d:	48 89 df             	mov    %rbx,%rdi
+  801c80:	41 ff d5             	call   *%r13
+  801c83:	83 e0 04             	and    $0x4,%eax
+  801c86:	74 17                	je     801c9f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c88:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c8f:	4c 39 f3             	cmp    %r14,%rbx
+  801c92:	75 e6                	jne    801c7a <fd_alloc+0x29>
+  801c94:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c9a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c9f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ca2:	48 83 c4 08          	add    $0x8,%rsp
+  801ca6:	5b                   	pop    %rbx
+  801ca7:	41 5c                	pop    %r12
+  801ca9:	41 5d                	pop    %r13
+  801cab:	41 5e                	pop    %r14
+  801cad:	41 5f                	pop    %r15
+  801caf:	5d                   	pop    %rbp
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cb1:	83 ff 1f             	cmp    $0x1f,%edi
+  801cb4:	77 39                	ja     801cef <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801cb6:	55                   	push   %rbp
+  801cb7:	48 89 e5             	mov    %rsp,%rbp
+  801cba:	41 54                	push   %r12
+  801cbc:	53                   	push   %rbx
+  801cbd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801cc0:	48 63 df             	movslq %edi,%rbx
+  801cc3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801cca:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801cce:	48 89 df             	mov    %rbx,%rdi
+  801cd1:	48 b8 70 37 80 00 00 	movabs $0x803770,%rax
+  801cd8:	00 00 00 
+  801cdb:	ff d0                	call   *%rax
+  801cdd:	a8 04                	test   $0x4,%al
+  801cdf:	74 14                	je     801cf5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ce1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cea:	5b                   	pop    %rbx
+  801ceb:	41 5c                	pop    %r12
+  801ced:	5d                   	pop    %rbp
+  801cee:	c3                   	ret
+        return -E_INVAL;
+  801cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801cf4:	c3                   	ret
+        return -E_INVAL;
+  801cf5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfa:	eb ee                	jmp    801cea <fd_lookup+0x39>
+
+0000000000801cfc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	41 54                	push   %r12
+  801d02:	53                   	push   %rbx
+  801d03:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d06:	48 b8 40 42 80 00 00 	movabs $0x804240,%rax
+  801d0d:	00 00 00 
+  801d10:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801d17:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d1a:	39 3b                	cmp    %edi,(%rbx)
+  801d1c:	74 47                	je     801d65 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d1e:	48 83 c0 08          	add    $0x8,%rax
+  801d22:	48 8b 18             	mov    (%rax),%rbx
+  801d25:	48 85 db             	test   %rbx,%rbx
+  801d28:	75 f0                	jne    801d1a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d2a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d31:	00 00 00 
+  801d34:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d3a:	89 fa                	mov    %edi,%edx
+  801d3c:	48 bf a0 41 80 00 00 	movabs $0x8041a0,%rdi
+  801d43:	00 00 00 
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	48 b9 7c 05 80 00 00 	movabs $0x80057c,%rcx
+  801d52:	00 00 00 
+  801d55:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d5c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d60:	5b                   	pop    %rbx
+  801d61:	41 5c                	pop    %r12
+  801d63:	5d                   	pop    %rbp
+  801d64:	c3                   	ret
+            return 0;
+  801d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6a:	eb f0                	jmp    801d5c <dev_lookup+0x60>
+
+0000000000801d6c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d6c:	55                   	push   %rbp
+  801d6d:	48 89 e5             	mov    %rsp,%rbp
+  801d70:	41 55                	push   %r13
+  801d72:	41 54                	push   %r12
+  801d74:	53                   	push   %rbx
+  801d75:	48 83 ec 18          	sub    $0x18,%rsp
+  801d79:	48 89 fb             	mov    %rdi,%rbx
+  801d7c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d7f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d86:	ff ff ff 
+  801d89:	48 01 df             	add    %rbx,%rdi
+  801d8c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d94:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	41 89 c5             	mov    %eax,%r13d
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 06                	js     801dad <fd_close+0x41>
+  801da7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801dab:	74 1a                	je     801dc7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801dad:	45 84 e4             	test   %r12b,%r12b
+  801db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801db9:	44 89 e8             	mov    %r13d,%eax
+  801dbc:	48 83 c4 18          	add    $0x18,%rsp
+  801dc0:	5b                   	pop    %rbx
+  801dc1:	41 5c                	pop    %r12
+  801dc3:	41 5d                	pop    %r13
+  801dc5:	5d                   	pop    %rbp
+  801dc6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dc7:	8b 3b                	mov    (%rbx),%edi
+  801dc9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dcd:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	41 89 c5             	mov    %eax,%r13d
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 1b                	js     801dfb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801de0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de4:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801de8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801dee:	48 85 c0             	test   %rax,%rax
+  801df1:	74 08                	je     801dfb <fd_close+0x8f>
+  801df3:	48 89 df             	mov    %rbx,%rdi
+  801df6:	ff d0                	call   *%rax
+  801df8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801dfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e00:	48 89 de             	mov    %rbx,%rsi
+  801e03:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e08:	48 b8 f9 15 80 00 00 	movabs $0x8015f9,%rax
+  801e0f:	00 00 00 
+  801e12:	ff d0                	call   *%rax
+    return res;
+  801e14:	eb a3                	jmp    801db9 <fd_close+0x4d>
+
+0000000000801e16 <close>:
+
+int
+close(int fdnum) {
+  801e16:	55                   	push   %rbp
+  801e17:	48 89 e5             	mov    %rsp,%rbp
+  801e1a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e1e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e22:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  801e29:	00 00 00 
+  801e2c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e2e:	85 c0                	test   %eax,%eax
+  801e30:	78 15                	js     801e47 <close+0x31>
+
+    return fd_close(fd, 1);
+  801e32:	be 01 00 00 00       	mov    $0x1,%esi
+  801e37:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e3b:	48 b8 6c 1d 80 00 00 	movabs $0x801d6c,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+}
+  801e47:	c9                   	leave
+  801e48:	c3                   	ret
+
+0000000000801e49 <close_all>:
+
+void
+close_all(void) {
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+  801e4d:	41 54                	push   %r12
+  801e4f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e55:	49 bc 16 1e 80 00 00 	movabs $0x801e16,%r12
+  801e5c:	00 00 00 
+  801e5f:	89 df                	mov    %ebx,%edi
+  801e61:	41 ff d4             	call   *%r12
+  801e64:	83 c3 01             	add    $0x1,%ebx
+  801e67:	83 fb 20             	cmp    $0x20,%ebx
+  801e6a:	75 f3                	jne    801e5f <close_all+0x16>
+}
+  801e6c:	5b                   	pop    %rbx
+  801e6d:	41 5c                	pop    %r12
+  801e6f:	5d                   	pop    %rbp
+  801e70:	c3                   	ret
+
+0000000000801e71 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e71:	55                   	push   %rbp
+  801e72:	48 89 e5             	mov    %rsp,%rbp
+  801e75:	41 57                	push   %r15
+  801e77:	41 56                	push   %r14
+  801e79:	41 55                	push   %r13
+  801e7b:	41 54                	push   %r12
+  801e7d:	53                   	push   %rbx
+  801e7e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e82:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e85:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e89:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+  801e95:	89 c3                	mov    %eax,%ebx
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	0f 88 b8 00 00 00    	js     801f57 <dup+0xe6>
+    close(newfdnum);
+  801e9f:	44 89 e7             	mov    %r12d,%edi
+  801ea2:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  801ea9:	00 00 00 
+  801eac:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801eae:	4d 63 ec             	movslq %r12d,%r13
+  801eb1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801eb8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ebc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ec0:	4c 89 ff             	mov    %r15,%rdi
+  801ec3:	49 be 35 1c 80 00 00 	movabs $0x801c35,%r14
+  801eca:	00 00 00 
+  801ecd:	41 ff d6             	call   *%r14
+  801ed0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ed3:	4c 89 ef             	mov    %r13,%rdi
+  801ed6:	41 ff d6             	call   *%r14
+  801ed9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801edc:	48 89 df             	mov    %rbx,%rdi
+  801edf:	48 b8 70 37 80 00 00 	movabs $0x803770,%rax
+  801ee6:	00 00 00 
+  801ee9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801eeb:	a8 04                	test   $0x4,%al
+  801eed:	74 2b                	je     801f1a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801eef:	41 89 c1             	mov    %eax,%r9d
+  801ef2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ef8:	4c 89 f1             	mov    %r14,%rcx
+  801efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f00:	48 89 de             	mov    %rbx,%rsi
+  801f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f08:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+  801f14:	89 c3                	mov    %eax,%ebx
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 4e                	js     801f68 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801f1a:	4c 89 ff             	mov    %r15,%rdi
+  801f1d:	48 b8 70 37 80 00 00 	movabs $0x803770,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+  801f29:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f2c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f32:	4c 89 e9             	mov    %r13,%rcx
+  801f35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3a:	4c 89 fe             	mov    %r15,%rsi
+  801f3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f42:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  801f49:	00 00 00 
+  801f4c:	ff d0                	call   *%rax
+  801f4e:	89 c3                	mov    %eax,%ebx
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 14                	js     801f68 <dup+0xf7>
+
+    return newfdnum;
+  801f54:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f57:	89 d8                	mov    %ebx,%eax
+  801f59:	48 83 c4 18          	add    $0x18,%rsp
+  801f5d:	5b                   	pop    %rbx
+  801f5e:	41 5c                	pop    %r12
+  801f60:	41 5d                	pop    %r13
+  801f62:	41 5e                	pop    %r14
+  801f64:	41 5f                	pop    %r15
+  801f66:	5d                   	pop    %rbp
+  801f67:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f6d:	4c 89 ee             	mov    %r13,%rsi
+  801f70:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f75:	49 bc f9 15 80 00 00 	movabs $0x8015f9,%r12
+  801f7c:	00 00 00 
+  801f7f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f87:	4c 89 f6             	mov    %r14,%rsi
+  801f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f8f:	41 ff d4             	call   *%r12
+    return res;
+  801f92:	eb c3                	jmp    801f57 <dup+0xe6>
+
+0000000000801f94 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f94:	55                   	push   %rbp
+  801f95:	48 89 e5             	mov    %rsp,%rbp
+  801f98:	41 56                	push   %r14
+  801f9a:	41 55                	push   %r13
+  801f9c:	41 54                	push   %r12
+  801f9e:	53                   	push   %rbx
+  801f9f:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa3:	89 fb                	mov    %edi,%ebx
+  801fa5:	49 89 f4             	mov    %rsi,%r12
+  801fa8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801faf:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 4c                	js     80200b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fc3:	41 8b 3e             	mov    (%r14),%edi
+  801fc6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fca:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  801fd1:	00 00 00 
+  801fd4:	ff d0                	call   *%rax
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	78 35                	js     80200f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fda:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fde:	83 e0 03             	and    $0x3,%eax
+  801fe1:	83 f8 01             	cmp    $0x1,%eax
+  801fe4:	74 2d                	je     802013 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fe6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fee:	48 85 c0             	test   %rax,%rax
+  801ff1:	74 56                	je     802049 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ff3:	4c 89 ea             	mov    %r13,%rdx
+  801ff6:	4c 89 e6             	mov    %r12,%rsi
+  801ff9:	4c 89 f7             	mov    %r14,%rdi
+  801ffc:	ff d0                	call   *%rax
+}
+  801ffe:	48 83 c4 10          	add    $0x10,%rsp
+  802002:	5b                   	pop    %rbx
+  802003:	41 5c                	pop    %r12
+  802005:	41 5d                	pop    %r13
+  802007:	41 5e                	pop    %r14
+  802009:	5d                   	pop    %rbp
+  80200a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80200b:	48 98                	cltq
+  80200d:	eb ef                	jmp    801ffe <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80200f:	48 98                	cltq
+  802011:	eb eb                	jmp    801ffe <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802013:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80201a:	00 00 00 
+  80201d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802023:	89 da                	mov    %ebx,%edx
+  802025:	48 bf 01 42 80 00 00 	movabs $0x804201,%rdi
+  80202c:	00 00 00 
+  80202f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802034:	48 b9 7c 05 80 00 00 	movabs $0x80057c,%rcx
+  80203b:	00 00 00 
+  80203e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802040:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802047:	eb b5                	jmp    801ffe <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802049:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802050:	eb ac                	jmp    801ffe <read+0x6a>
+
+0000000000802052 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	41 56                	push   %r14
+  802058:	41 55                	push   %r13
+  80205a:	41 54                	push   %r12
+  80205c:	53                   	push   %rbx
+  80205d:	48 83 ec 10          	sub    $0x10,%rsp
+  802061:	89 fb                	mov    %edi,%ebx
+  802063:	49 89 f4             	mov    %rsi,%r12
+  802066:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802069:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80206d:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	78 41                	js     8020be <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80207d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802081:	41 8b 3e             	mov    (%r14),%edi
+  802084:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802088:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 35                	js     8020cd <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802098:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80209c:	83 e0 03             	and    $0x3,%eax
+  80209f:	83 f8 01             	cmp    $0x1,%eax
+  8020a2:	74 2d                	je     8020d1 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8020a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020a8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020ac:	48 85 c0             	test   %rax,%rax
+  8020af:	74 56                	je     802107 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  8020b1:	4c 89 ea             	mov    %r13,%rdx
+  8020b4:	4c 89 e6             	mov    %r12,%rsi
+  8020b7:	4c 89 f7             	mov    %r14,%rdi
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	eb 02                	jmp    8020c0 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020be:	48 98                	cltq
+}
+  8020c0:	48 83 c4 10          	add    $0x10,%rsp
+  8020c4:	5b                   	pop    %rbx
+  8020c5:	41 5c                	pop    %r12
+  8020c7:	41 5d                	pop    %r13
+  8020c9:	41 5e                	pop    %r14
+  8020cb:	5d                   	pop    %rbp
+  8020cc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020cd:	48 98                	cltq
+  8020cf:	eb ef                	jmp    8020c0 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020d1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8020d8:	00 00 00 
+  8020db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020e1:	89 da                	mov    %ebx,%edx
+  8020e3:	48 bf c0 41 80 00 00 	movabs $0x8041c0,%rdi
+  8020ea:	00 00 00 
+  8020ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f2:	48 b9 7c 05 80 00 00 	movabs $0x80057c,%rcx
+  8020f9:	00 00 00 
+  8020fc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020fe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802105:	eb b9                	jmp    8020c0 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802107:	4c 89 ea             	mov    %r13,%rdx
+  80210a:	4c 89 e6             	mov    %r12,%rsi
+  80210d:	89 df                	mov    %ebx,%edi
+  80210f:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	eb a3                	jmp    8020c0 <readmap+0x6e>
+
+000000000080211d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80211d:	55                   	push   %rbp
+  80211e:	48 89 e5             	mov    %rsp,%rbp
+  802121:	41 57                	push   %r15
+  802123:	41 56                	push   %r14
+  802125:	41 55                	push   %r13
+  802127:	41 54                	push   %r12
+  802129:	53                   	push   %rbx
+  80212a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80212e:	48 85 d2             	test   %rdx,%rdx
+  802131:	74 54                	je     802187 <readn+0x6a>
+  802133:	41 89 fd             	mov    %edi,%r13d
+  802136:	49 89 f6             	mov    %rsi,%r14
+  802139:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80213c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802141:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802146:	49 bf 94 1f 80 00 00 	movabs $0x801f94,%r15
+  80214d:	00 00 00 
+  802150:	4c 89 e2             	mov    %r12,%rdx
+  802153:	48 29 f2             	sub    %rsi,%rdx
+  802156:	4c 01 f6             	add    %r14,%rsi
+  802159:	44 89 ef             	mov    %r13d,%edi
+  80215c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 20                	js     802183 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802163:	01 c3                	add    %eax,%ebx
+  802165:	85 c0                	test   %eax,%eax
+  802167:	74 08                	je     802171 <readn+0x54>
+  802169:	48 63 f3             	movslq %ebx,%rsi
+  80216c:	4c 39 e6             	cmp    %r12,%rsi
+  80216f:	72 df                	jb     802150 <readn+0x33>
+    }
+    return res;
+  802171:	48 63 c3             	movslq %ebx,%rax
+}
+  802174:	48 83 c4 08          	add    $0x8,%rsp
+  802178:	5b                   	pop    %rbx
+  802179:	41 5c                	pop    %r12
+  80217b:	41 5d                	pop    %r13
+  80217d:	41 5e                	pop    %r14
+  80217f:	41 5f                	pop    %r15
+  802181:	5d                   	pop    %rbp
+  802182:	c3                   	ret
+        if (inc < 0) return inc;
+  802183:	48 98                	cltq
+  802185:	eb ed                	jmp    802174 <readn+0x57>
+    int inc = 1, res = 0;
+  802187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80218c:	eb e3                	jmp    802171 <readn+0x54>
+
+000000000080218e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80218e:	55                   	push   %rbp
+  80218f:	48 89 e5             	mov    %rsp,%rbp
+  802192:	41 56                	push   %r14
+  802194:	41 55                	push   %r13
+  802196:	41 54                	push   %r12
+  802198:	53                   	push   %rbx
+  802199:	48 83 ec 10          	sub    $0x10,%rsp
+  80219d:	89 fb                	mov    %edi,%ebx
+  80219f:	49 89 f4             	mov    %rsi,%r12
+  8021a2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021a9:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 47                	js     802200 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021b9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021bd:	41 8b 3e             	mov    (%r14),%edi
+  8021c0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021c4:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	78 30                	js     802204 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021d4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021d9:	74 2d                	je     802208 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021db:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021df:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8021e3:	48 85 c0             	test   %rax,%rax
+  8021e6:	74 56                	je     80223e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021e8:	4c 89 ea             	mov    %r13,%rdx
+  8021eb:	4c 89 e6             	mov    %r12,%rsi
+  8021ee:	4c 89 f7             	mov    %r14,%rdi
+  8021f1:	ff d0                	call   *%rax
+}
+  8021f3:	48 83 c4 10          	add    $0x10,%rsp
+  8021f7:	5b                   	pop    %rbx
+  8021f8:	41 5c                	pop    %r12
+  8021fa:	41 5d                	pop    %r13
+  8021fc:	41 5e                	pop    %r14
+  8021fe:	5d                   	pop    %rbp
+  8021ff:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802200:	48 98                	cltq
+  802202:	eb ef                	jmp    8021f3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802204:	48 98                	cltq
+  802206:	eb eb                	jmp    8021f3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802208:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80220f:	00 00 00 
+  802212:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802218:	89 da                	mov    %ebx,%edx
+  80221a:	48 bf 1d 42 80 00 00 	movabs $0x80421d,%rdi
+  802221:	00 00 00 
+  802224:	b8 00 00 00 00       	mov    $0x0,%eax
+  802229:	48 b9 7c 05 80 00 00 	movabs $0x80057c,%rcx
+  802230:	00 00 00 
+  802233:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802235:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80223c:	eb b5                	jmp    8021f3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80223e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802245:	eb ac                	jmp    8021f3 <write+0x65>
+
+0000000000802247 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802247:	55                   	push   %rbp
+  802248:	48 89 e5             	mov    %rsp,%rbp
+  80224b:	53                   	push   %rbx
+  80224c:	48 83 ec 18          	sub    $0x18,%rsp
+  802250:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802252:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802256:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 0c                	js     802272 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802266:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80226a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80226d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802272:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+
+0000000000802278 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802278:	55                   	push   %rbp
+  802279:	48 89 e5             	mov    %rsp,%rbp
+  80227c:	41 55                	push   %r13
+  80227e:	41 54                	push   %r12
+  802280:	53                   	push   %rbx
+  802281:	48 83 ec 18          	sub    $0x18,%rsp
+  802285:	89 fb                	mov    %edi,%ebx
+  802287:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80228a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80228e:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 38                	js     8022d6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80229e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8022a2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022aa:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8022b1:	00 00 00 
+  8022b4:	ff d0                	call   *%rax
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	78 1c                	js     8022d6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022ba:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022bf:	74 20                	je     8022e1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c5:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8022c9:	48 85 c0             	test   %rax,%rax
+  8022cc:	74 47                	je     802315 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022ce:	44 89 e6             	mov    %r12d,%esi
+  8022d1:	4c 89 ef             	mov    %r13,%rdi
+  8022d4:	ff d0                	call   *%rax
+}
+  8022d6:	48 83 c4 18          	add    $0x18,%rsp
+  8022da:	5b                   	pop    %rbx
+  8022db:	41 5c                	pop    %r12
+  8022dd:	41 5d                	pop    %r13
+  8022df:	5d                   	pop    %rbp
+  8022e0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022e1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8022e8:	00 00 00 
+  8022eb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022f1:	89 da                	mov    %ebx,%edx
+  8022f3:	48 bf e0 41 80 00 00 	movabs $0x8041e0,%rdi
+  8022fa:	00 00 00 
+  8022fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802302:	48 b9 7c 05 80 00 00 	movabs $0x80057c,%rcx
+  802309:	00 00 00 
+  80230c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80230e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802313:	eb c1                	jmp    8022d6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802315:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80231a:	eb ba                	jmp    8022d6 <ftruncate+0x5e>
+
+000000000080231c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80231c:	55                   	push   %rbp
+  80231d:	48 89 e5             	mov    %rsp,%rbp
+  802320:	41 54                	push   %r12
+  802322:	53                   	push   %rbx
+  802323:	48 83 ec 10          	sub    $0x10,%rsp
+  802327:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80232a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80232e:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+  80233a:	85 c0                	test   %eax,%eax
+  80233c:	78 4e                	js     80238c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80233e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802342:	41 8b 3c 24          	mov    (%r12),%edi
+  802346:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80234a:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 32                	js     80238c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80235a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80235e:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802363:	74 30                	je     802395 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802365:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802368:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80236f:	00 00 00 
+    stat->st_isdir = 0;
+  802372:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802379:	00 00 00 
+    stat->st_dev = dev;
+  80237c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802383:	48 89 de             	mov    %rbx,%rsi
+  802386:	4c 89 e7             	mov    %r12,%rdi
+  802389:	ff 50 30             	call   *0x30(%rax)
+}
+  80238c:	48 83 c4 10          	add    $0x10,%rsp
+  802390:	5b                   	pop    %rbx
+  802391:	41 5c                	pop    %r12
+  802393:	5d                   	pop    %rbp
+  802394:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802395:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80239a:	eb f0                	jmp    80238c <fstat+0x70>
+
+000000000080239c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	41 54                	push   %r12
+  8023a2:	53                   	push   %rbx
+  8023a3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8023a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ab:	48 b8 f3 30 80 00 00 	movabs $0x8030f3,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 25                	js     8023e2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8023bd:	4c 89 e6             	mov    %r12,%rsi
+  8023c0:	89 c7                	mov    %eax,%edi
+  8023c2:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+  8023ce:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8023d1:	89 df                	mov    %ebx,%edi
+  8023d3:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  8023da:	00 00 00 
+  8023dd:	ff d0                	call   *%rax
+
+    return res;
+  8023df:	44 89 e3             	mov    %r12d,%ebx
+}
+  8023e2:	89 d8                	mov    %ebx,%eax
+  8023e4:	5b                   	pop    %rbx
+  8023e5:	41 5c                	pop    %r12
+  8023e7:	5d                   	pop    %rbp
+  8023e8:	c3                   	ret
+
+00000000008023e9 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	41 54                	push   %r12
+  8023ef:	53                   	push   %rbx
+  8023f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f4:	48 89 fb             	mov    %rdi,%rbx
+  8023f7:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023fa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023fe:	bf 66 00 00 00       	mov    $0x66,%edi
+  802403:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+  80240f:	85 c0                	test   %eax,%eax
+  802411:	78 1f                	js     802432 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802413:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802417:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80241b:	48 85 c0             	test   %rax,%rax
+  80241e:	74 1b                	je     80243b <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802420:	4c 89 e6             	mov    %r12,%rsi
+  802423:	48 89 df             	mov    %rbx,%rdi
+  802426:	ff d0                	call   *%rax
+    if (res < 0) {
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802432:	48 83 c4 10          	add    $0x10,%rsp
+  802436:	5b                   	pop    %rbx
+  802437:	41 5c                	pop    %r12
+  802439:	5d                   	pop    %rbp
+  80243a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80243b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802440:	eb f0                	jmp    802432 <create_snapshot+0x49>
+
+0000000000802442 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802442:	55                   	push   %rbp
+  802443:	48 89 e5             	mov    %rsp,%rbp
+  802446:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80244a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80244e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802453:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+  80245f:	85 c0                	test   %eax,%eax
+  802461:	78 1e                	js     802481 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802463:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802467:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80246b:	48 85 d2             	test   %rdx,%rdx
+  80246e:	74 13                	je     802483 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802470:	b8 00 00 00 00       	mov    $0x0,%eax
+  802475:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802477:	85 c0                	test   %eax,%eax
+  802479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247e:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802481:	c9                   	leave
+  802482:	c3                   	ret
+        return -E_NOT_SUPP;
+  802483:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802488:	eb f7                	jmp    802481 <print_snapshot_list+0x3f>
+
+000000000080248a <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80248a:	55                   	push   %rbp
+  80248b:	48 89 e5             	mov    %rsp,%rbp
+  80248e:	53                   	push   %rbx
+  80248f:	48 83 ec 18          	sub    $0x18,%rsp
+  802493:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802496:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80249a:	bf 66 00 00 00       	mov    $0x66,%edi
+  80249f:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	85 c0                	test   %eax,%eax
+  8024ad:	78 1c                	js     8024cb <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8024af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024b3:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8024b7:	48 85 c0             	test   %rax,%rax
+  8024ba:	74 15                	je     8024d1 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8024bc:	48 89 df             	mov    %rbx,%rdi
+  8024bf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c8:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8024cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024cf:	c9                   	leave
+  8024d0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024d1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024d6:	eb f3                	jmp    8024cb <accept_snapshot+0x41>
+
+00000000008024d8 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8024d8:	55                   	push   %rbp
+  8024d9:	48 89 e5             	mov    %rsp,%rbp
+  8024dc:	53                   	push   %rbx
+  8024dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8024e1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024e4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024e8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024ed:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	78 1c                	js     802519 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8024fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802501:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802505:	48 85 c0             	test   %rax,%rax
+  802508:	74 15                	je     80251f <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80250a:	48 89 df             	mov    %rbx,%rdi
+  80250d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80250f:	85 c0                	test   %eax,%eax
+  802511:	ba 00 00 00 00       	mov    $0x0,%edx
+  802516:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80251d:	c9                   	leave
+  80251e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80251f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802524:	eb f3                	jmp    802519 <delete_snapshot+0x41>
+
+0000000000802526 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80252e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802532:	bf 66 00 00 00       	mov    $0x66,%edi
+  802537:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+  802543:	85 c0                	test   %eax,%eax
+  802545:	78 14                	js     80255b <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254b:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  80254f:	48 85 d2             	test   %rdx,%rdx
+  802552:	74 09                	je     80255d <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802554:	b8 00 00 00 00       	mov    $0x0,%eax
+  802559:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80255b:	c9                   	leave
+  80255c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80255d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802562:	eb f7                	jmp    80255b <gc_snapshots+0x35>
+
+0000000000802564 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802564:	55                   	push   %rbp
+  802565:	48 89 e5             	mov    %rsp,%rbp
+  802568:	41 56                	push   %r14
+  80256a:	41 55                	push   %r13
+  80256c:	41 54                	push   %r12
+  80256e:	53                   	push   %rbx
+  80256f:	48 83 ec 10          	sub    $0x10,%rsp
+  802573:	48 89 fb             	mov    %rdi,%rbx
+  802576:	49 89 f4             	mov    %rsi,%r12
+  802579:	49 89 d5             	mov    %rdx,%r13
+  80257c:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80257f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802583:	bf 66 00 00 00       	mov    $0x66,%edi
+  802588:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 1b                	js     8025b3 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802598:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80259c:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8025a0:	48 85 c0             	test   %rax,%rax
+  8025a3:	74 1b                	je     8025c0 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8025a5:	4c 89 f1             	mov    %r14,%rcx
+  8025a8:	4c 89 ea             	mov    %r13,%rdx
+  8025ab:	4c 89 e6             	mov    %r12,%rsi
+  8025ae:	48 89 df             	mov    %rbx,%rdi
+  8025b1:	ff d0                	call   *%rax
+
+    return res;
+}
+  8025b3:	48 83 c4 10          	add    $0x10,%rsp
+  8025b7:	5b                   	pop    %rbx
+  8025b8:	41 5c                	pop    %r12
+  8025ba:	41 5d                	pop    %r13
+  8025bc:	41 5e                	pop    %r14
+  8025be:	5d                   	pop    %rbp
+  8025bf:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025c0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025c5:	eb ec                	jmp    8025b3 <diff_snapshots+0x4f>
+
+00000000008025c7 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8025c7:	55                   	push   %rbp
+  8025c8:	48 89 e5             	mov    %rsp,%rbp
+  8025cb:	41 55                	push   %r13
+  8025cd:	41 54                	push   %r12
+  8025cf:	53                   	push   %rbx
+  8025d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d4:	48 89 fb             	mov    %rdi,%rbx
+  8025d7:	49 89 f4             	mov    %rsi,%r12
+  8025da:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025dd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025e1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025e6:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8025ed:	00 00 00 
+  8025f0:	ff d0                	call   *%rax
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	78 18                	js     80260e <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8025f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025fa:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8025fe:	48 85 c0             	test   %rax,%rax
+  802601:	74 16                	je     802619 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802603:	4c 89 ea             	mov    %r13,%rdx
+  802606:	4c 89 e6             	mov    %r12,%rsi
+  802609:	48 89 df             	mov    %rbx,%rdi
+  80260c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80260e:	48 83 c4 18          	add    $0x18,%rsp
+  802612:	5b                   	pop    %rbx
+  802613:	41 5c                	pop    %r12
+  802615:	41 5d                	pop    %r13
+  802617:	5d                   	pop    %rbp
+  802618:	c3                   	ret
+        return -E_NOT_SUPP;
+  802619:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80261e:	eb ee                	jmp    80260e <send_snapshot+0x47>
+
+0000000000802620 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+  802624:	53                   	push   %rbx
+  802625:	48 83 ec 18          	sub    $0x18,%rsp
+  802629:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80262c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802630:	bf 66 00 00 00       	mov    $0x66,%edi
+  802635:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	85 c0                	test   %eax,%eax
+  802643:	78 12                	js     802657 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802649:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80264d:	48 85 c0             	test   %rax,%rax
+  802650:	74 0b                	je     80265d <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802652:	48 89 df             	mov    %rbx,%rdi
+  802655:	ff d0                	call   *%rax
+
+    return res;
+}
+  802657:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80265d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802662:	eb f3                	jmp    802657 <receive_snapshot+0x37>
+
+0000000000802664 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802664:	55                   	push   %rbp
+  802665:	48 89 e5             	mov    %rsp,%rbp
+  802668:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80266c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802670:	bf 66 00 00 00       	mov    $0x66,%edi
+  802675:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  802681:	85 c0                	test   %eax,%eax
+  802683:	78 17                	js     80269c <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802689:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802690:	48 85 d2             	test   %rdx,%rdx
+  802693:	74 09                	je     80269e <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269a:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80269c:	c9                   	leave
+  80269d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80269e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026a3:	eb f7                	jmp    80269c <free_space_bytes+0x38>
+
+00000000008026a5 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8026a5:	55                   	push   %rbp
+  8026a6:	48 89 e5             	mov    %rsp,%rbp
+  8026a9:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8026ad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026b1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8026b6:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8026bd:	00 00 00 
+  8026c0:	ff d0                	call   *%rax
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 17                	js     8026dd <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8026c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026ca:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8026d1:	48 85 d2             	test   %rdx,%rdx
+  8026d4:	74 09                	je     8026df <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8026d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026db:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8026dd:	c9                   	leave
+  8026de:	c3                   	ret
+        return -E_NOT_SUPP;
+  8026df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026e4:	eb f7                	jmp    8026dd <busy_space_bytes+0x38>
+
+00000000008026e6 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	41 54                	push   %r12
+  8026ec:	53                   	push   %rbx
+  8026ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f1:	89 fb                	mov    %edi,%ebx
+  8026f3:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8026f6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026fa:	bf 66 00 00 00       	mov    $0x66,%edi
+  8026ff:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	78 17                	js     802726 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80270f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802713:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80271a:	48 85 c0             	test   %rax,%rax
+  80271d:	74 10                	je     80272f <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80271f:	4c 89 e6             	mov    %r12,%rsi
+  802722:	89 df                	mov    %ebx,%edi
+  802724:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802726:	48 83 c4 10          	add    $0x10,%rsp
+  80272a:	5b                   	pop    %rbx
+  80272b:	41 5c                	pop    %r12
+  80272d:	5d                   	pop    %rbp
+  80272e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80272f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802734:	eb f0                	jmp    802726 <snapshots_space+0x40>
+
+0000000000802736 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802736:	55                   	push   %rbp
+  802737:	48 89 e5             	mov    %rsp,%rbp
+  80273a:	41 55                	push   %r13
+  80273c:	41 54                	push   %r12
+  80273e:	53                   	push   %rbx
+  80273f:	48 83 ec 08          	sub    $0x8,%rsp
+  802743:	41 89 fd             	mov    %edi,%r13d
+  802746:	48 89 f3             	mov    %rsi,%rbx
+  802749:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80274c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802753:	00 00 00 
+  802756:	83 38 00             	cmpl   $0x0,(%rax)
+  802759:	74 57                	je     8027b2 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80275b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802761:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802766:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80276d:	00 00 00 
+  802770:	44 89 ee             	mov    %r13d,%esi
+  802773:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80277a:	00 00 00 
+  80277d:	8b 38                	mov    (%rax),%edi
+  80277f:	48 b8 0b 1b 80 00 00 	movabs $0x801b0b,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80278b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802790:	4c 89 e2             	mov    %r12,%rdx
+  802793:	48 89 de             	mov    %rbx,%rsi
+  802796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80279b:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+}
+  8027a7:	48 83 c4 08          	add    $0x8,%rsp
+  8027ab:	5b                   	pop    %rbx
+  8027ac:	41 5c                	pop    %r12
+  8027ae:	41 5d                	pop    %r13
+  8027b0:	5d                   	pop    %rbp
+  8027b1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027b2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027b7:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8027ca:	00 00 
+  8027cc:	eb 8d                	jmp    80275b <fsipc_region+0x25>
+
+00000000008027ce <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8027ce:	55                   	push   %rbp
+  8027cf:	48 89 e5             	mov    %rsp,%rbp
+  8027d2:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8027d6:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8027dd:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8027de:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8027e2:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+}
+  8027ee:	c9                   	leave
+  8027ef:	c3                   	ret
+
+00000000008027f0 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8027f0:	85 ff                	test   %edi,%edi
+  8027f2:	78 6d                	js     802861 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8027f4:	55                   	push   %rbp
+  8027f5:	48 89 e5             	mov    %rsp,%rbp
+  8027f8:	41 54                	push   %r12
+  8027fa:	53                   	push   %rbx
+  8027fb:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8027fe:	48 85 f6             	test   %rsi,%rsi
+  802801:	74 57                	je     80285a <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802803:	89 f8                	mov    %edi,%eax
+  802805:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80280c:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80280e:	be 00 00 00 00       	mov    $0x0,%esi
+  802813:	bf 12 00 00 00       	mov    $0x12,%edi
+  802818:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802824:	85 c0                	test   %eax,%eax
+  802826:	78 2d                	js     802855 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802828:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80282f:	00 00 00 
+  802832:	49 63 14 24          	movslq (%r12),%rdx
+  802836:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80283d:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802842:	48 89 df             	mov    %rbx,%rdi
+  802845:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802851:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802855:	5b                   	pop    %rbx
+  802856:	41 5c                	pop    %r12
+  802858:	5d                   	pop    %rbp
+  802859:	c3                   	ret
+        return -E_INVAL;
+  80285a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80285f:	eb f4                	jmp    802855 <devfile_df_snapshots+0x65>
+  802861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802866:	c3                   	ret
+
+0000000000802867 <devfile_df_busy>:
+devfile_df_busy() {
+  802867:	55                   	push   %rbp
+  802868:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  80286b:	be 00 00 00 00       	mov    $0x0,%esi
+  802870:	bf 11 00 00 00       	mov    $0x11,%edi
+  802875:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+}
+  802881:	5d                   	pop    %rbp
+  802882:	c3                   	ret
+
+0000000000802883 <devfile_df_free>:
+devfile_df_free() {
+  802883:	55                   	push   %rbp
+  802884:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802887:	be 00 00 00 00       	mov    $0x0,%esi
+  80288c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802891:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+}
+  80289d:	5d                   	pop    %rbp
+  80289e:	c3                   	ret
+
+000000000080289f <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8028a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8028ad:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8028b4:	00 00 00 
+  8028b7:	ff d0                	call   *%rax
+}
+  8028b9:	5d                   	pop    %rbp
+  8028ba:	c3                   	ret
+
+00000000008028bb <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8028bb:	55                   	push   %rbp
+  8028bc:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8028bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8028c9:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028dc:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028df:	5d                   	pop    %rbp
+  8028e0:	c3                   	ret
+
+00000000008028e1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8028e1:	55                   	push   %rbp
+  8028e2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8028e5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8028ec:	00 00 00 
+  8028ef:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8028f2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8028f4:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8028f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fc:	bf 02 00 00 00       	mov    $0x2,%edi
+  802901:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802908:	00 00 00 
+  80290b:	ff d0                	call   *%rax
+}
+  80290d:	5d                   	pop    %rbp
+  80290e:	c3                   	ret
+
+000000000080290f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80290f:	55                   	push   %rbp
+  802910:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802913:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802916:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80291d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80291f:	be 00 00 00 00       	mov    $0x0,%esi
+  802924:	bf 06 00 00 00       	mov    $0x6,%edi
+  802929:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+}
+  802935:	5d                   	pop    %rbp
+  802936:	c3                   	ret
+
+0000000000802937 <devfile_write>:
+    if (!fd || !buf) {
+  802937:	48 85 ff             	test   %rdi,%rdi
+  80293a:	0f 84 c1 00 00 00    	je     802a01 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802940:	55                   	push   %rbp
+  802941:	48 89 e5             	mov    %rsp,%rbp
+  802944:	41 57                	push   %r15
+  802946:	41 56                	push   %r14
+  802948:	41 55                	push   %r13
+  80294a:	41 54                	push   %r12
+  80294c:	53                   	push   %rbx
+  80294d:	48 83 ec 18          	sub    $0x18,%rsp
+  802951:	49 89 ff             	mov    %rdi,%r15
+  802954:	49 89 f5             	mov    %rsi,%r13
+  802957:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80295a:	48 85 f6             	test   %rsi,%rsi
+  80295d:	0f 84 95 00 00 00    	je     8029f8 <devfile_write+0xc1>
+    while (n) {
+  802963:	48 85 d2             	test   %rdx,%rdx
+  802966:	0f 84 83 00 00 00    	je     8029ef <devfile_write+0xb8>
+    int totalWrite = 0;
+  80296c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802973:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80297a:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80297d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802982:	49 39 dc             	cmp    %rbx,%r12
+  802985:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802989:	48 89 da             	mov    %rbx,%rdx
+  80298c:	4c 89 ee             	mov    %r13,%rsi
+  80298f:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802996:	00 00 00 
+  802999:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  8029a0:	00 00 00 
+  8029a3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029a5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029a9:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8029ac:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8029b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029ba:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8029c1:	00 00 00 
+  8029c4:	ff d0                	call   *%rax
+        if (write < 0) {
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	78 21                	js     8029eb <devfile_write+0xb4>
+        buf += write;
+  8029ca:	48 63 d0             	movslq %eax,%rdx
+  8029cd:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8029d0:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8029d3:	49 29 d4             	sub    %rdx,%r12
+  8029d6:	75 a5                	jne    80297d <devfile_write+0x46>
+    return totalWrite;
+  8029d8:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8029dc:	48 83 c4 18          	add    $0x18,%rsp
+  8029e0:	5b                   	pop    %rbx
+  8029e1:	41 5c                	pop    %r12
+  8029e3:	41 5d                	pop    %r13
+  8029e5:	41 5e                	pop    %r14
+  8029e7:	41 5f                	pop    %r15
+  8029e9:	5d                   	pop    %rbp
+  8029ea:	c3                   	ret
+            return write;
+  8029eb:	48 98                	cltq
+  8029ed:	eb ed                	jmp    8029dc <devfile_write+0xa5>
+    int totalWrite = 0;
+  8029ef:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8029f6:	eb e0                	jmp    8029d8 <devfile_write+0xa1>
+        return -E_INVAL;
+  8029f8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029ff:	eb db                	jmp    8029dc <devfile_write+0xa5>
+  802a01:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802a08:	c3                   	ret
+
+0000000000802a09 <devfile_read>:
+    if (!fd || !buf) {
+  802a09:	48 85 ff             	test   %rdi,%rdi
+  802a0c:	0f 84 c0 00 00 00    	je     802ad2 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a12:	55                   	push   %rbp
+  802a13:	48 89 e5             	mov    %rsp,%rbp
+  802a16:	41 57                	push   %r15
+  802a18:	41 56                	push   %r14
+  802a1a:	41 55                	push   %r13
+  802a1c:	41 54                	push   %r12
+  802a1e:	53                   	push   %rbx
+  802a1f:	48 83 ec 18          	sub    $0x18,%rsp
+  802a23:	49 89 ff             	mov    %rdi,%r15
+  802a26:	49 89 f5             	mov    %rsi,%r13
+  802a29:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802a2c:	48 85 f6             	test   %rsi,%rsi
+  802a2f:	0f 84 96 00 00 00    	je     802acb <devfile_read+0xc2>
+    while (n) {
+  802a35:	48 85 d2             	test   %rdx,%rdx
+  802a38:	0f 84 87 00 00 00    	je     802ac5 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802a3e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a45:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a46:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802a4d:	00 00 00 
+  802a50:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a54:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802a57:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a5c:	49 39 c4             	cmp    %rax,%r12
+  802a5f:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802a63:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802a67:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a71:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802a7d:	85 c0                	test   %eax,%eax
+  802a7f:	7e 37                	jle    802ab8 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802a81:	48 63 d8             	movslq %eax,%rbx
+  802a84:	48 89 da             	mov    %rbx,%rdx
+  802a87:	4c 89 f6             	mov    %r14,%rsi
+  802a8a:	4c 89 ef             	mov    %r13,%rdi
+  802a8d:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  802a94:	00 00 00 
+  802a97:	ff d0                	call   *%rax
+        buf += read;
+  802a99:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802a9c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802aa0:	49 29 dc             	sub    %rbx,%r12
+  802aa3:	75 ab                	jne    802a50 <devfile_read+0x47>
+  return totalRead;
+  802aa5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802aa9:	48 83 c4 18          	add    $0x18,%rsp
+  802aad:	5b                   	pop    %rbx
+  802aae:	41 5c                	pop    %r12
+  802ab0:	41 5d                	pop    %r13
+  802ab2:	41 5e                	pop    %r14
+  802ab4:	41 5f                	pop    %r15
+  802ab6:	5d                   	pop    %rbp
+  802ab7:	c3                   	ret
+            return read ? read : totalRead;
+  802ab8:	48 63 d0             	movslq %eax,%rdx
+  802abb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802abf:	48 0f 45 c2          	cmovne %rdx,%rax
+  802ac3:	eb e4                	jmp    802aa9 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802ac5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802ac9:	eb da                	jmp    802aa5 <devfile_read+0x9c>
+        return E_INVAL;
+  802acb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ad0:	eb d7                	jmp    802aa9 <devfile_read+0xa0>
+  802ad2:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ad7:	c3                   	ret
+
+0000000000802ad8 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802ad8:	48 85 ff             	test   %rdi,%rdi
+  802adb:	74 5f                	je     802b3c <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+  802ae1:	53                   	push   %rbx
+  802ae2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae6:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802ae9:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+  802af5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802afb:	77 45                	ja     802b42 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802afd:	48 89 de             	mov    %rbx,%rsi
+  802b00:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b07:	00 00 00 
+  802b0a:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802b16:	be 00 00 00 00       	mov    $0x0,%esi
+  802b1b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802b20:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802b27:	00 00 00 
+  802b2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b33:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+        return -E_INVAL;
+  802b3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b41:	c3                   	ret
+        return -E_INVAL;
+  802b42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b47:	eb ed                	jmp    802b36 <devfile_receive_snapshot+0x5e>
+
+0000000000802b49 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802b49:	55                   	push   %rbp
+  802b4a:	48 89 e5             	mov    %rsp,%rbp
+  802b4d:	41 55                	push   %r13
+  802b4f:	41 54                	push   %r12
+  802b51:	53                   	push   %rbx
+  802b52:	48 83 ec 08          	sub    $0x8,%rsp
+  802b56:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802b59:	48 85 f6             	test   %rsi,%rsi
+  802b5c:	0f 94 c0             	sete   %al
+  802b5f:	48 85 d2             	test   %rdx,%rdx
+  802b62:	0f 94 c2             	sete   %dl
+  802b65:	08 d0                	or     %dl,%al
+  802b67:	0f 85 ad 00 00 00    	jne    802c1a <devfile_send_snapshot+0xd1>
+  802b6d:	48 89 fb             	mov    %rdi,%rbx
+  802b70:	49 89 f4             	mov    %rsi,%r12
+  802b73:	48 85 ff             	test   %rdi,%rdi
+  802b76:	0f 84 9e 00 00 00    	je     802c1a <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802b7c:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  802b88:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b8e:	0f 87 8d 00 00 00    	ja     802c21 <devfile_send_snapshot+0xd8>
+  802b94:	4c 89 e7             	mov    %r12,%rdi
+  802b97:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+  802ba3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ba9:	77 7d                	ja     802c28 <devfile_send_snapshot+0xdf>
+  802bab:	4c 89 ef             	mov    %r13,%rdi
+  802bae:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802bc0:	77 6d                	ja     802c2f <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802bc2:	48 89 de             	mov    %rbx,%rsi
+  802bc5:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802bcc:	00 00 00 
+  802bcf:	48 bb a1 0e 80 00 00 	movabs $0x800ea1,%rbx
+  802bd6:	00 00 00 
+  802bd9:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802bdb:	4c 89 e6             	mov    %r12,%rsi
+  802bde:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802be5:	00 00 00 
+  802be8:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802bea:	4c 89 ee             	mov    %r13,%rsi
+  802bed:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802bf4:	00 00 00 
+  802bf7:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802bf9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bfe:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802c03:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+}
+  802c0f:	48 83 c4 08          	add    $0x8,%rsp
+  802c13:	5b                   	pop    %rbx
+  802c14:	41 5c                	pop    %r12
+  802c16:	41 5d                	pop    %r13
+  802c18:	5d                   	pop    %rbp
+  802c19:	c3                   	ret
+        return -E_INVAL;
+  802c1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c1f:	eb ee                	jmp    802c0f <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c26:	eb e7                	jmp    802c0f <devfile_send_snapshot+0xc6>
+  802c28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c2d:	eb e0                	jmp    802c0f <devfile_send_snapshot+0xc6>
+  802c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c34:	eb d9                	jmp    802c0f <devfile_send_snapshot+0xc6>
+
+0000000000802c36 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802c36:	48 85 ff             	test   %rdi,%rdi
+  802c39:	0f 84 41 01 00 00    	je     802d80 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802c3f:	55                   	push   %rbp
+  802c40:	48 89 e5             	mov    %rsp,%rbp
+  802c43:	41 57                	push   %r15
+  802c45:	41 56                	push   %r14
+  802c47:	41 55                	push   %r13
+  802c49:	41 54                	push   %r12
+  802c4b:	53                   	push   %rbx
+  802c4c:	48 83 ec 08          	sub    $0x8,%rsp
+  802c50:	49 89 fc             	mov    %rdi,%r12
+  802c53:	49 89 f5             	mov    %rsi,%r13
+  802c56:	48 89 d3             	mov    %rdx,%rbx
+  802c59:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802c5c:	48 85 f6             	test   %rsi,%rsi
+  802c5f:	0f 84 ff 00 00 00    	je     802d64 <devfile_diff_snapshots+0x12e>
+  802c65:	48 85 d2             	test   %rdx,%rdx
+  802c68:	0f 84 fd 00 00 00    	je     802d6b <devfile_diff_snapshots+0x135>
+  802c6e:	48 85 c9             	test   %rcx,%rcx
+  802c71:	0f 84 f4 00 00 00    	je     802d6b <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802c77:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+  802c83:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802c89:	0f 87 e3 00 00 00    	ja     802d72 <devfile_diff_snapshots+0x13c>
+  802c8f:	4c 89 ef             	mov    %r13,%rdi
+  802c92:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802ca4:	0f 87 cf 00 00 00    	ja     802d79 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802caa:	4c 89 e6             	mov    %r12,%rsi
+  802cad:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802cb4:	00 00 00 
+  802cb7:	4c 89 e7             	mov    %r12,%rdi
+  802cba:	49 bf a1 0e 80 00 00 	movabs $0x800ea1,%r15
+  802cc1:	00 00 00 
+  802cc4:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802cc7:	4c 89 ee             	mov    %r13,%rsi
+  802cca:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802cd1:	00 
+  802cd2:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802cd5:	48 8b 03             	mov    (%rbx),%rax
+  802cd8:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802cdf:	00 
+  802ce0:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802ce4:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802ceb:	00 
+  802cec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802cf0:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802cf7:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802cf8:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802d02:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802d09:	00 00 00 
+  802d0c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	78 43                	js     802d55 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802d12:	49 8b 04 24          	mov    (%r12),%rax
+  802d16:	48 89 03             	mov    %rax,(%rbx)
+  802d19:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802d1e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802d22:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802d27:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802d2b:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802d30:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802d34:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802d38:	48 c1 e2 03          	shl    $0x3,%rdx
+  802d3c:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802d41:	4c 89 f7             	mov    %r14,%rdi
+  802d44:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802d50:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802d55:	48 83 c4 08          	add    $0x8,%rsp
+  802d59:	5b                   	pop    %rbx
+  802d5a:	41 5c                	pop    %r12
+  802d5c:	41 5d                	pop    %r13
+  802d5e:	41 5e                	pop    %r14
+  802d60:	41 5f                	pop    %r15
+  802d62:	5d                   	pop    %rbp
+  802d63:	c3                   	ret
+        return -E_INVAL;
+  802d64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d69:	eb ea                	jmp    802d55 <devfile_diff_snapshots+0x11f>
+  802d6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d70:	eb e3                	jmp    802d55 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802d72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d77:	eb dc                	jmp    802d55 <devfile_diff_snapshots+0x11f>
+  802d79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d7e:	eb d5                	jmp    802d55 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802d80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d85:	c3                   	ret
+
+0000000000802d86 <devfile_delete_snapshot>:
+    if (!name) {
+  802d86:	48 85 ff             	test   %rdi,%rdi
+  802d89:	74 5f                	je     802dea <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	53                   	push   %rbx
+  802d90:	48 83 ec 08          	sub    $0x8,%rsp
+  802d94:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802d97:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+  802da3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802da9:	77 45                	ja     802df0 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802dab:	48 89 de             	mov    %rbx,%rsi
+  802dae:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802db5:	00 00 00 
+  802db8:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  802dbf:	00 00 00 
+  802dc2:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802dc4:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802dce:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802dd5:	00 00 00 
+  802dd8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802de4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de8:	c9                   	leave
+  802de9:	c3                   	ret
+        return -E_INVAL;
+  802dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802def:	c3                   	ret
+        return -E_INVAL;
+  802df0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802df5:	eb ed                	jmp    802de4 <devfile_delete_snapshot+0x5e>
+
+0000000000802df7 <devfile_accept_snapshot>:
+    if (!name) {
+  802df7:	48 85 ff             	test   %rdi,%rdi
+  802dfa:	74 5f                	je     802e5b <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802dfc:	55                   	push   %rbp
+  802dfd:	48 89 e5             	mov    %rsp,%rbp
+  802e00:	53                   	push   %rbx
+  802e01:	48 83 ec 08          	sub    $0x8,%rsp
+  802e05:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802e08:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802e0f:	00 00 00 
+  802e12:	ff d0                	call   *%rax
+  802e14:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802e1a:	77 45                	ja     802e61 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802e1c:	48 89 de             	mov    %rbx,%rsi
+  802e1f:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802e26:	00 00 00 
+  802e29:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802e35:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e3f:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802e46:	00 00 00 
+  802e49:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e52:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802e55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e59:	c9                   	leave
+  802e5a:	c3                   	ret
+        return -E_INVAL;
+  802e5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e60:	c3                   	ret
+        return -E_INVAL;
+  802e61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e66:	eb ed                	jmp    802e55 <devfile_accept_snapshot+0x5e>
+
+0000000000802e68 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802e68:	48 85 ff             	test   %rdi,%rdi
+  802e6b:	0f 84 9f 00 00 00    	je     802f10 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802e71:	55                   	push   %rbp
+  802e72:	48 89 e5             	mov    %rsp,%rbp
+  802e75:	41 54                	push   %r12
+  802e77:	53                   	push   %rbx
+  802e78:	48 89 fb             	mov    %rdi,%rbx
+  802e7b:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802e7e:	48 85 f6             	test   %rsi,%rsi
+  802e81:	74 78                	je     802efb <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802e83:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802e8a:	00 00 00 
+  802e8d:	ff d0                	call   *%rax
+  802e8f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802e95:	77 6b                	ja     802f02 <devfile_create_snapshot+0x9a>
+  802e97:	4c 89 e7             	mov    %r12,%rdi
+  802e9a:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  802ea1:	00 00 00 
+  802ea4:	ff d0                	call   *%rax
+  802ea6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802eac:	77 5b                	ja     802f09 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802eae:	48 89 de             	mov    %rbx,%rsi
+  802eb1:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802eb8:	00 00 00 
+  802ebb:	48 bb a1 0e 80 00 00 	movabs $0x800ea1,%rbx
+  802ec2:	00 00 00 
+  802ec5:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802ec7:	4c 89 e6             	mov    %r12,%rsi
+  802eca:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802ed1:	00 00 00 
+  802ed4:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  802edb:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ee0:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802ee7:	00 00 00 
+  802eea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eec:	85 c0                	test   %eax,%eax
+  802eee:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ef6:	5b                   	pop    %rbx
+  802ef7:	41 5c                	pop    %r12
+  802ef9:	5d                   	pop    %rbp
+  802efa:	c3                   	ret
+        return -E_INVAL;
+  802efb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f00:	eb f4                	jmp    802ef6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802f02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f07:	eb ed                	jmp    802ef6 <devfile_create_snapshot+0x8e>
+  802f09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f0e:	eb e6                	jmp    802ef6 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802f10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f15:	c3                   	ret
+
+0000000000802f16 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802f16:	55                   	push   %rbp
+  802f17:	48 89 e5             	mov    %rsp,%rbp
+  802f1a:	41 54                	push   %r12
+  802f1c:	53                   	push   %rbx
+  802f1d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802f20:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802f23:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802f2a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f31:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f36:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	78 3d                	js     802f83 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f46:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802f4d:	00 00 00 
+  802f50:	4c 89 e6             	mov    %r12,%rsi
+  802f53:	48 89 df             	mov    %rbx,%rdi
+  802f56:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  802f5d:	00 00 00 
+  802f60:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f62:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802f69:	00 
+  802f6a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f70:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802f77:	00 
+  802f78:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f83:	5b                   	pop    %rbx
+  802f84:	41 5c                	pop    %r12
+  802f86:	5d                   	pop    %rbp
+  802f87:	c3                   	ret
+
+0000000000802f88 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802f88:	55                   	push   %rbp
+  802f89:	48 89 e5             	mov    %rsp,%rbp
+  802f8c:	41 57                	push   %r15
+  802f8e:	41 56                	push   %r14
+  802f90:	41 55                	push   %r13
+  802f92:	41 54                	push   %r12
+  802f94:	53                   	push   %rbx
+  802f95:	48 83 ec 38          	sub    $0x38,%rsp
+  802f99:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802f9d:	49 89 f5             	mov    %rsi,%r13
+  802fa0:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802fa3:	48 89 f0             	mov    %rsi,%rax
+  802fa6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802fab:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802faf:	75 4f                	jne    803000 <devfile_readmap+0x78>
+  802fb1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fb5:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802fbb:	75 1f                	jne    802fdc <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802fbd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fc1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802fc5:	49 be 70 37 80 00 00 	movabs $0x803770,%r14
+  802fcc:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802fcf:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802fd6:	0f 87 9d 00 00 00    	ja     803079 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802fdc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fe0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802fe4:	4d 85 ff             	test   %r15,%r15
+  802fe7:	0f 85 cf 00 00 00    	jne    8030bc <devfile_readmap+0x134>
+  802fed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802ff1:	48 83 c4 38          	add    $0x38,%rsp
+  802ff5:	5b                   	pop    %rbx
+  802ff6:	41 5c                	pop    %r12
+  802ff8:	41 5d                	pop    %r13
+  802ffa:	41 5e                	pop    %r14
+  802ffc:	41 5f                	pop    %r15
+  802ffe:	5d                   	pop    %rbp
+  802fff:	c3                   	ret
+    size_t totalRead = 0;
+  803000:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  803007:	00 
+  803008:	eb da                	jmp    802fe4 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80300a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80300e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803011:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803018:	00 00 00 
+  80301b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  80301d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803021:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  803025:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803029:	4c 89 ee             	mov    %r13,%rsi
+  80302c:	bf 14 00 00 00       	mov    $0x14,%edi
+  803031:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  803038:	00 00 00 
+  80303b:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  80303d:	85 c0                	test   %eax,%eax
+  80303f:	7e a3                	jle    802fe4 <devfile_readmap+0x5c>
+  803041:	48 98                	cltq
+  803043:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803047:	72 9b                	jb     802fe4 <devfile_readmap+0x5c>
+        buf += read;
+  803049:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  80304c:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  80304f:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803053:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  80305a:	75 88                	jne    802fe4 <devfile_readmap+0x5c>
+  80305c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803060:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803066:	0f 85 78 ff ff ff    	jne    802fe4 <devfile_readmap+0x5c>
+  80306c:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  803073:	0f 86 6b ff ff ff    	jbe    802fe4 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  803079:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  80307f:	4d 39 e7             	cmp    %r12,%r15
+  803082:	4d 0f 46 e7          	cmovbe %r15,%r12
+  803086:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  80308d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  803091:	0f 84 73 ff ff ff    	je     80300a <devfile_readmap+0x82>
+  803097:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  80309b:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  8030a0:	41 ff d6             	call   *%r14
+  8030a3:	a8 40                	test   $0x40,%al
+  8030a5:	0f 85 39 ff ff ff    	jne    802fe4 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  8030ab:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8030b2:	4c 39 e3             	cmp    %r12,%rbx
+  8030b5:	72 e4                	jb     80309b <devfile_readmap+0x113>
+  8030b7:	e9 4e ff ff ff       	jmp    80300a <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  8030bc:	4c 89 fa             	mov    %r15,%rdx
+  8030bf:	4c 89 ee             	mov    %r13,%rsi
+  8030c2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8030c6:	48 b8 09 2a 80 00 00 	movabs $0x802a09,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8030d2:	48 85 c0             	test   %rax,%rax
+  8030d5:	78 0c                	js     8030e3 <devfile_readmap+0x15b>
+    return totalRead + read;
+  8030d7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8030db:	48 01 f0             	add    %rsi,%rax
+  8030de:	e9 0e ff ff ff       	jmp    802ff1 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  8030e3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8030e7:	48 85 f6             	test   %rsi,%rsi
+  8030ea:	48 0f 45 c6          	cmovne %rsi,%rax
+  8030ee:	e9 fe fe ff ff       	jmp    802ff1 <devfile_readmap+0x69>
+
+00000000008030f3 <open>:
+open(const char *path, int mode) {
+  8030f3:	55                   	push   %rbp
+  8030f4:	48 89 e5             	mov    %rsp,%rbp
+  8030f7:	41 55                	push   %r13
+  8030f9:	41 54                	push   %r12
+  8030fb:	53                   	push   %rbx
+  8030fc:	48 83 ec 18          	sub    $0x18,%rsp
+  803100:	49 89 fc             	mov    %rdi,%r12
+  803103:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803106:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  80310d:	00 00 00 
+  803110:	ff d0                	call   *%rax
+  803112:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803118:	0f 87 8a 00 00 00    	ja     8031a8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80311e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803122:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+  80312e:	89 c3                	mov    %eax,%ebx
+  803130:	85 c0                	test   %eax,%eax
+  803132:	78 50                	js     803184 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803134:	4c 89 e6             	mov    %r12,%rsi
+  803137:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80313e:	00 00 00 
+  803141:	48 89 df             	mov    %rbx,%rdi
+  803144:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803150:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803157:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80315b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803160:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  803167:	00 00 00 
+  80316a:	ff d0                	call   *%rax
+  80316c:	89 c3                	mov    %eax,%ebx
+  80316e:	85 c0                	test   %eax,%eax
+  803170:	78 1f                	js     803191 <open+0x9e>
+    return fd2num(fd);
+  803172:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803176:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	89 c3                	mov    %eax,%ebx
+}
+  803184:	89 d8                	mov    %ebx,%eax
+  803186:	48 83 c4 18          	add    $0x18,%rsp
+  80318a:	5b                   	pop    %rbx
+  80318b:	41 5c                	pop    %r12
+  80318d:	41 5d                	pop    %r13
+  80318f:	5d                   	pop    %rbp
+  803190:	c3                   	ret
+        fd_close(fd, 0);
+  803191:	be 00 00 00 00       	mov    $0x0,%esi
+  803196:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80319a:	48 b8 6c 1d 80 00 00 	movabs $0x801d6c,%rax
+  8031a1:	00 00 00 
+  8031a4:	ff d0                	call   *%rax
+        return res;
+  8031a6:	eb dc                	jmp    803184 <open+0x91>
+        return -E_BAD_PATH;
+  8031a8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031ad:	eb d5                	jmp    803184 <open+0x91>
+
+00000000008031af <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8031af:	55                   	push   %rbp
+  8031b0:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8031b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b8:	bf 13 00 00 00       	mov    $0x13,%edi
+  8031bd:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8031c4:	00 00 00 
+  8031c7:	ff d0                	call   *%rax
+}
+  8031c9:	5d                   	pop    %rbp
+  8031ca:	c3                   	ret
+
+00000000008031cb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	41 54                	push   %r12
+  8031d1:	53                   	push   %rbx
+  8031d2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031d5:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  8031dc:	00 00 00 
+  8031df:	ff d0                	call   *%rax
+  8031e1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8031e4:	48 be 60 42 80 00 00 	movabs $0x804260,%rsi
+  8031eb:	00 00 00 
+  8031ee:	48 89 df             	mov    %rbx,%rdi
+  8031f1:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8031fd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803202:	41 2b 04 24          	sub    (%r12),%eax
+  803206:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80320c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803213:	00 00 00 
+    stat->st_dev = &devpipe;
+  803216:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  80321d:	00 00 00 
+  803220:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322c:	5b                   	pop    %rbx
+  80322d:	41 5c                	pop    %r12
+  80322f:	5d                   	pop    %rbp
+  803230:	c3                   	ret
+
+0000000000803231 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803231:	55                   	push   %rbp
+  803232:	48 89 e5             	mov    %rsp,%rbp
+  803235:	41 54                	push   %r12
+  803237:	53                   	push   %rbx
+  803238:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80323b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803240:	48 89 fe             	mov    %rdi,%rsi
+  803243:	bf 00 00 00 00       	mov    $0x0,%edi
+  803248:	49 bc f9 15 80 00 00 	movabs $0x8015f9,%r12
+  80324f:	00 00 00 
+  803252:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803255:	48 89 df             	mov    %rbx,%rdi
+  803258:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  80325f:	00 00 00 
+  803262:	ff d0                	call   *%rax
+  803264:	48 89 c6             	mov    %rax,%rsi
+  803267:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80326c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803271:	41 ff d4             	call   *%r12
+}
+  803274:	5b                   	pop    %rbx
+  803275:	41 5c                	pop    %r12
+  803277:	5d                   	pop    %rbp
+  803278:	c3                   	ret
+
+0000000000803279 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803279:	55                   	push   %rbp
+  80327a:	48 89 e5             	mov    %rsp,%rbp
+  80327d:	41 57                	push   %r15
+  80327f:	41 56                	push   %r14
+  803281:	41 55                	push   %r13
+  803283:	41 54                	push   %r12
+  803285:	53                   	push   %rbx
+  803286:	48 83 ec 18          	sub    $0x18,%rsp
+  80328a:	49 89 fc             	mov    %rdi,%r12
+  80328d:	49 89 f5             	mov    %rsi,%r13
+  803290:	49 89 d7             	mov    %rdx,%r15
+  803293:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803297:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  80329e:	00 00 00 
+  8032a1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8032a3:	4d 85 ff             	test   %r15,%r15
+  8032a6:	0f 84 af 00 00 00    	je     80335b <devpipe_write+0xe2>
+  8032ac:	48 89 c3             	mov    %rax,%rbx
+  8032af:	4c 89 f8             	mov    %r15,%rax
+  8032b2:	4d 89 ef             	mov    %r13,%r15
+  8032b5:	4c 01 e8             	add    %r13,%rax
+  8032b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032bc:	49 bd 01 15 80 00 00 	movabs $0x801501,%r13
+  8032c3:	00 00 00 
+            sys_yield();
+  8032c6:	49 be 9e 14 80 00 00 	movabs $0x80149e,%r14
+  8032cd:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8032d0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8032d3:	48 63 ce             	movslq %esi,%rcx
+  8032d6:	48 63 03             	movslq (%rbx),%rax
+  8032d9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8032df:	48 39 c1             	cmp    %rax,%rcx
+  8032e2:	72 2e                	jb     803312 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032e4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032e9:	48 89 da             	mov    %rbx,%rdx
+  8032ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032f1:	4c 89 e7             	mov    %r12,%rdi
+  8032f4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	74 66                	je     803361 <devpipe_write+0xe8>
+            sys_yield();
+  8032fb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8032fe:	8b 73 04             	mov    0x4(%rbx),%esi
+  803301:	48 63 ce             	movslq %esi,%rcx
+  803304:	48 63 03             	movslq (%rbx),%rax
+  803307:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80330d:	48 39 c1             	cmp    %rax,%rcx
+  803310:	73 d2                	jae    8032e4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803312:	41 0f b6 3f          	movzbl (%r15),%edi
+  803316:	48 89 ca             	mov    %rcx,%rdx
+  803319:	48 c1 ea 03          	shr    $0x3,%rdx
+  80331d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803324:	08 10 20 
+  803327:	48 f7 e2             	mul    %rdx
+  80332a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80332e:	48 89 d0             	mov    %rdx,%rax
+  803331:	48 c1 e0 09          	shl    $0x9,%rax
+  803335:	48 29 d0             	sub    %rdx,%rax
+  803338:	48 c1 e0 03          	shl    $0x3,%rax
+  80333c:	48 29 c1             	sub    %rax,%rcx
+  80333f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803344:	83 c6 01             	add    $0x1,%esi
+  803347:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80334a:	49 83 c7 01          	add    $0x1,%r15
+  80334e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803352:	49 39 c7             	cmp    %rax,%r15
+  803355:	0f 85 75 ff ff ff    	jne    8032d0 <devpipe_write+0x57>
+    return n;
+  80335b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80335f:	eb 05                	jmp    803366 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803366:	48 83 c4 18          	add    $0x18,%rsp
+  80336a:	5b                   	pop    %rbx
+  80336b:	41 5c                	pop    %r12
+  80336d:	41 5d                	pop    %r13
+  80336f:	41 5e                	pop    %r14
+  803371:	41 5f                	pop    %r15
+  803373:	5d                   	pop    %rbp
+  803374:	c3                   	ret
+
+0000000000803375 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803375:	55                   	push   %rbp
+  803376:	48 89 e5             	mov    %rsp,%rbp
+  803379:	41 57                	push   %r15
+  80337b:	41 56                	push   %r14
+  80337d:	41 55                	push   %r13
+  80337f:	41 54                	push   %r12
+  803381:	53                   	push   %rbx
+  803382:	48 83 ec 18          	sub    $0x18,%rsp
+  803386:	49 89 fc             	mov    %rdi,%r12
+  803389:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80338d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803391:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803398:	00 00 00 
+  80339b:	ff d0                	call   *%rax
+  80339d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8033a0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033a6:	49 bd 01 15 80 00 00 	movabs $0x801501,%r13
+  8033ad:	00 00 00 
+            sys_yield();
+  8033b0:	49 be 9e 14 80 00 00 	movabs $0x80149e,%r14
+  8033b7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8033ba:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033bf:	74 7d                	je     80343e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8033c1:	8b 03                	mov    (%rbx),%eax
+  8033c3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8033c6:	75 26                	jne    8033ee <devpipe_read+0x79>
+            if (i > 0) return i;
+  8033c8:	4d 85 ff             	test   %r15,%r15
+  8033cb:	75 77                	jne    803444 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8033cd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8033d2:	48 89 da             	mov    %rbx,%rdx
+  8033d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033da:	4c 89 e7             	mov    %r12,%rdi
+  8033dd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8033e0:	85 c0                	test   %eax,%eax
+  8033e2:	74 72                	je     803456 <devpipe_read+0xe1>
+            sys_yield();
+  8033e4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8033e7:	8b 03                	mov    (%rbx),%eax
+  8033e9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8033ec:	74 df                	je     8033cd <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8033ee:	48 63 c8             	movslq %eax,%rcx
+  8033f1:	48 89 ca             	mov    %rcx,%rdx
+  8033f4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8033f8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8033ff:	08 10 20 
+  803402:	48 89 d0             	mov    %rdx,%rax
+  803405:	48 f7 e6             	mul    %rsi
+  803408:	48 c1 ea 06          	shr    $0x6,%rdx
+  80340c:	48 89 d0             	mov    %rdx,%rax
+  80340f:	48 c1 e0 09          	shl    $0x9,%rax
+  803413:	48 29 d0             	sub    %rdx,%rax
+  803416:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80341d:	00 
+  80341e:	48 89 c8             	mov    %rcx,%rax
+  803421:	48 29 d0             	sub    %rdx,%rax
+  803424:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803429:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80342d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803431:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803434:	49 83 c7 01          	add    $0x1,%r15
+  803438:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80343c:	75 83                	jne    8033c1 <devpipe_read+0x4c>
+    return n;
+  80343e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803442:	eb 03                	jmp    803447 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803444:	4c 89 f8             	mov    %r15,%rax
+}
+  803447:	48 83 c4 18          	add    $0x18,%rsp
+  80344b:	5b                   	pop    %rbx
+  80344c:	41 5c                	pop    %r12
+  80344e:	41 5d                	pop    %r13
+  803450:	41 5e                	pop    %r14
+  803452:	41 5f                	pop    %r15
+  803454:	5d                   	pop    %rbp
+  803455:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345b:	eb ea                	jmp    803447 <devpipe_read+0xd2>
+
+000000000080345d <pipe>:
+pipe(int pfd[2]) {
+  80345d:	55                   	push   %rbp
+  80345e:	48 89 e5             	mov    %rsp,%rbp
+  803461:	41 55                	push   %r13
+  803463:	41 54                	push   %r12
+  803465:	53                   	push   %rbx
+  803466:	48 83 ec 18          	sub    $0x18,%rsp
+  80346a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80346d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803471:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	89 c3                	mov    %eax,%ebx
+  80347f:	85 c0                	test   %eax,%eax
+  803481:	0f 88 a0 01 00 00    	js     803627 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803487:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80348c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803491:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803495:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349a:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+  8034a6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8034a8:	85 c0                	test   %eax,%eax
+  8034aa:	0f 88 77 01 00 00    	js     803627 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034b0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8034b4:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  8034bb:	00 00 00 
+  8034be:	ff d0                	call   *%rax
+  8034c0:	89 c3                	mov    %eax,%ebx
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	0f 88 43 01 00 00    	js     80360d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8034ca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034d4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8034d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034dd:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+  8034e9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	0f 88 1a 01 00 00    	js     80360d <pipe+0x1b0>
+    va = fd2data(fd0);
+  8034f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034f7:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+  803503:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803506:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80350b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803510:	48 89 c6             	mov    %rax,%rsi
+  803513:	bf 00 00 00 00       	mov    $0x0,%edi
+  803518:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+  803524:	89 c3                	mov    %eax,%ebx
+  803526:	85 c0                	test   %eax,%eax
+  803528:	0f 88 c5 00 00 00    	js     8035f3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80352e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803532:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803539:	00 00 00 
+  80353c:	ff d0                	call   *%rax
+  80353e:	48 89 c1             	mov    %rax,%rcx
+  803541:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803547:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80354d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803552:	4c 89 ee             	mov    %r13,%rsi
+  803555:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355a:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+  803566:	89 c3                	mov    %eax,%ebx
+  803568:	85 c0                	test   %eax,%eax
+  80356a:	78 6e                	js     8035da <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80356c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803571:	4c 89 ef             	mov    %r13,%rdi
+  803574:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+  803580:	83 f8 02             	cmp    $0x2,%eax
+  803583:	0f 85 ab 00 00 00    	jne    803634 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803589:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803590:	00 00 
+  803592:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803596:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803598:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80359c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8035a3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8035a7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8035a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035ad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8035b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035b8:	48 bb 23 1c 80 00 00 	movabs $0x801c23,%rbx
+  8035bf:	00 00 00 
+  8035c2:	ff d3                	call   *%rbx
+  8035c4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8035c8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8035cc:	ff d3                	call   *%rbx
+  8035ce:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8035d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035d8:	eb 4d                	jmp    803627 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8035da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035df:	4c 89 ee             	mov    %r13,%rsi
+  8035e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e7:	48 b8 f9 15 80 00 00 	movabs $0x8015f9,%rax
+  8035ee:	00 00 00 
+  8035f1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035f8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8035fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803601:	48 b8 f9 15 80 00 00 	movabs $0x8015f9,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80360d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803612:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803616:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361b:	48 b8 f9 15 80 00 00 	movabs $0x8015f9,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+}
+  803627:	89 d8                	mov    %ebx,%eax
+  803629:	48 83 c4 18          	add    $0x18,%rsp
+  80362d:	5b                   	pop    %rbx
+  80362e:	41 5c                	pop    %r12
+  803630:	41 5d                	pop    %r13
+  803632:	5d                   	pop    %rbp
+  803633:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803634:	48 b9 90 42 80 00 00 	movabs $0x804290,%rcx
+  80363b:	00 00 00 
+  80363e:	48 ba 67 42 80 00 00 	movabs $0x804267,%rdx
+  803645:	00 00 00 
+  803648:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80364d:	48 bf 7c 42 80 00 00 	movabs $0x80427c,%rdi
+  803654:	00 00 00 
+  803657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365c:	49 b8 2c 04 80 00 00 	movabs $0x80042c,%r8
+  803663:	00 00 00 
+  803666:	41 ff d0             	call   *%r8
+
+0000000000803669 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+  80366d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803671:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803675:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803681:	85 c0                	test   %eax,%eax
+  803683:	78 35                	js     8036ba <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803685:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803689:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+  803695:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803698:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80369d:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036a6:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8036ad:	00 00 00 
+  8036b0:	ff d0                	call   *%rax
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	0f 94 c0             	sete   %al
+  8036b7:	0f b6 c0             	movzbl %al,%eax
+}
+  8036ba:	c9                   	leave
+  8036bb:	c3                   	ret
+
+00000000008036bc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036bc:	48 89 f8             	mov    %rdi,%rax
+  8036bf:	48 c1 e8 27          	shr    $0x27,%rax
+  8036c3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8036ca:	01 00 00 
+  8036cd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036d1:	f6 c2 01             	test   $0x1,%dl
+  8036d4:	74 6d                	je     803743 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036d6:	48 89 f8             	mov    %rdi,%rax
+  8036d9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036dd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036e4:	01 00 00 
+  8036e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036eb:	f6 c2 01             	test   $0x1,%dl
+  8036ee:	74 62                	je     803752 <get_uvpt_entry+0x96>
+  8036f0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036f7:	01 00 00 
+  8036fa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036fe:	f6 c2 80             	test   $0x80,%dl
+  803701:	75 4f                	jne    803752 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803703:	48 89 f8             	mov    %rdi,%rax
+  803706:	48 c1 e8 15          	shr    $0x15,%rax
+  80370a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803711:	01 00 00 
+  803714:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803718:	f6 c2 01             	test   $0x1,%dl
+  80371b:	74 44                	je     803761 <get_uvpt_entry+0xa5>
+  80371d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803724:	01 00 00 
+  803727:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80372b:	f6 c2 80             	test   $0x80,%dl
+  80372e:	75 31                	jne    803761 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803730:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803734:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80373b:	01 00 00 
+  80373e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803742:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803743:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80374a:	01 00 00 
+  80374d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803751:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803752:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803759:	01 00 00 
+  80375c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803760:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803761:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803768:	01 00 00 
+  80376b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80376f:	c3                   	ret
+
+0000000000803770 <get_prot>:
+
+int
+get_prot(void *va) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803774:	48 b8 bc 36 80 00 00 	movabs $0x8036bc,%rax
+  80377b:	00 00 00 
+  80377e:	ff d0                	call   *%rax
+  803780:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803783:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803788:	89 c1                	mov    %eax,%ecx
+  80378a:	83 c9 04             	or     $0x4,%ecx
+  80378d:	f6 c2 01             	test   $0x1,%dl
+  803790:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803793:	89 c1                	mov    %eax,%ecx
+  803795:	83 c9 02             	or     $0x2,%ecx
+  803798:	f6 c2 02             	test   $0x2,%dl
+  80379b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80379e:	89 c1                	mov    %eax,%ecx
+  8037a0:	83 c9 01             	or     $0x1,%ecx
+  8037a3:	48 85 d2             	test   %rdx,%rdx
+  8037a6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8037a9:	89 c1                	mov    %eax,%ecx
+  8037ab:	83 c9 40             	or     $0x40,%ecx
+  8037ae:	f6 c6 04             	test   $0x4,%dh
+  8037b1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8037b4:	5d                   	pop    %rbp
+  8037b5:	c3                   	ret
+
+00000000008037b6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8037b6:	55                   	push   %rbp
+  8037b7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037ba:	48 b8 bc 36 80 00 00 	movabs $0x8036bc,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8037c6:	48 c1 e8 06          	shr    $0x6,%rax
+  8037ca:	83 e0 01             	and    $0x1,%eax
+}
+  8037cd:	5d                   	pop    %rbp
+  8037ce:	c3                   	ret
+
+00000000008037cf <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8037cf:	55                   	push   %rbp
+  8037d0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8037d3:	48 b8 bc 36 80 00 00 	movabs $0x8036bc,%rax
+  8037da:	00 00 00 
+  8037dd:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8037df:	48 c1 e8 05          	shr    $0x5,%rax
+  8037e3:	83 e0 01             	and    $0x1,%eax
+}
+  8037e6:	5d                   	pop    %rbp
+  8037e7:	c3                   	ret
+
+00000000008037e8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8037e8:	55                   	push   %rbp
+  8037e9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8037ec:	48 b8 bc 36 80 00 00 	movabs $0x8036bc,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+  8037f8:	83 e0 01             	and    $0x1,%eax
+}
+  8037fb:	5d                   	pop    %rbp
+  8037fc:	c3                   	ret
+
+00000000008037fd <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8037fd:	55                   	push   %rbp
+  8037fe:	48 89 e5             	mov    %rsp,%rbp
+  803801:	41 57                	push   %r15
+  803803:	41 56                	push   %r14
+  803805:	41 55                	push   %r13
+  803807:	41 54                	push   %r12
+  803809:	53                   	push   %rbx
+  80380a:	48 83 ec 18          	sub    $0x18,%rsp
+  80380e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803812:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803816:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  80381b:	49 bd e8 37 80 00 00 	movabs $0x8037e8,%r13
+  803822:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803825:	49 bf 70 37 80 00 00 	movabs $0x803770,%r15
+  80382c:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80382f:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803836:	00 00 00 
+  803839:	eb 0c                	jmp    803847 <foreach_shared_region+0x4a>
+  80383b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803842:	4c 39 f3             	cmp    %r14,%rbx
+  803845:	74 2e                	je     803875 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803847:	48 89 df             	mov    %rbx,%rdi
+  80384a:	41 ff d5             	call   *%r13
+  80384d:	84 c0                	test   %al,%al
+  80384f:	74 ea                	je     80383b <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803851:	48 89 df             	mov    %rbx,%rdi
+  803854:	41 ff d7             	call   *%r15
+  803857:	a8 40                	test   $0x40,%al
+  803859:	74 e0                	je     80383b <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80385b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803862:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803866:	48 89 df             	mov    %rbx,%rdi
+  803869:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80386d:	ff d0                	call   *%rax
+				if (res < 0) {
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	79 c8                	jns    80383b <foreach_shared_region+0x3e>
+  803873:	eb 05                	jmp    80387a <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803875:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80387a:	48 83 c4 18          	add    $0x18,%rsp
+  80387e:	5b                   	pop    %rbx
+  80387f:	41 5c                	pop    %r12
+  803881:	41 5d                	pop    %r13
+  803883:	41 5e                	pop    %r14
+  803885:	41 5f                	pop    %r15
+  803887:	5d                   	pop    %rbp
+  803888:	c3                   	ret
+
+0000000000803889 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388e:	c3                   	ret
+
+000000000080388f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80388f:	55                   	push   %rbp
+  803890:	48 89 e5             	mov    %rsp,%rbp
+  803893:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803896:	48 be b4 42 80 00 00 	movabs $0x8042b4,%rsi
+  80389d:	00 00 00 
+  8038a0:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  8038a7:	00 00 00 
+  8038aa:	ff d0                	call   *%rax
+    return 0;
+}
+  8038ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b1:	5d                   	pop    %rbp
+  8038b2:	c3                   	ret
+
+00000000008038b3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038b3:	55                   	push   %rbp
+  8038b4:	48 89 e5             	mov    %rsp,%rbp
+  8038b7:	41 57                	push   %r15
+  8038b9:	41 56                	push   %r14
+  8038bb:	41 55                	push   %r13
+  8038bd:	41 54                	push   %r12
+  8038bf:	53                   	push   %rbx
+  8038c0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8038c7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8038ce:	48 85 d2             	test   %rdx,%rdx
+  8038d1:	74 7a                	je     80394d <devcons_write+0x9a>
+  8038d3:	49 89 d6             	mov    %rdx,%r14
+  8038d6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038dc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8038e1:	49 bf 9b 10 80 00 00 	movabs $0x80109b,%r15
+  8038e8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8038eb:	4c 89 f3             	mov    %r14,%rbx
+  8038ee:	48 29 f3             	sub    %rsi,%rbx
+  8038f1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8038f6:	48 39 c3             	cmp    %rax,%rbx
+  8038f9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8038fd:	4c 63 eb             	movslq %ebx,%r13
+  803900:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803907:	48 01 c6             	add    %rax,%rsi
+  80390a:	4c 89 ea             	mov    %r13,%rdx
+  80390d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803914:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803917:	4c 89 ee             	mov    %r13,%rsi
+  80391a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803921:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80392d:	41 01 dc             	add    %ebx,%r12d
+  803930:	49 63 f4             	movslq %r12d,%rsi
+  803933:	4c 39 f6             	cmp    %r14,%rsi
+  803936:	72 b3                	jb     8038eb <devcons_write+0x38>
+    return res;
+  803938:	49 63 c4             	movslq %r12d,%rax
+}
+  80393b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803942:	5b                   	pop    %rbx
+  803943:	41 5c                	pop    %r12
+  803945:	41 5d                	pop    %r13
+  803947:	41 5e                	pop    %r14
+  803949:	41 5f                	pop    %r15
+  80394b:	5d                   	pop    %rbp
+  80394c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80394d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803953:	eb e3                	jmp    803938 <devcons_write+0x85>
+
+0000000000803955 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803955:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803958:	ba 00 00 00 00       	mov    $0x0,%edx
+  80395d:	48 85 c0             	test   %rax,%rax
+  803960:	74 55                	je     8039b7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803962:	55                   	push   %rbp
+  803963:	48 89 e5             	mov    %rsp,%rbp
+  803966:	41 55                	push   %r13
+  803968:	41 54                	push   %r12
+  80396a:	53                   	push   %rbx
+  80396b:	48 83 ec 08          	sub    $0x8,%rsp
+  80396f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803972:	48 bb d1 13 80 00 00 	movabs $0x8013d1,%rbx
+  803979:	00 00 00 
+  80397c:	49 bc 9e 14 80 00 00 	movabs $0x80149e,%r12
+  803983:	00 00 00 
+  803986:	eb 03                	jmp    80398b <devcons_read+0x36>
+  803988:	41 ff d4             	call   *%r12
+  80398b:	ff d3                	call   *%rbx
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	74 f7                	je     803988 <devcons_read+0x33>
+    if (c < 0) return c;
+  803991:	48 63 d0             	movslq %eax,%rdx
+  803994:	78 13                	js     8039a9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803996:	ba 00 00 00 00       	mov    $0x0,%edx
+  80399b:	83 f8 04             	cmp    $0x4,%eax
+  80399e:	74 09                	je     8039a9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8039a0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8039a4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8039a9:	48 89 d0             	mov    %rdx,%rax
+  8039ac:	48 83 c4 08          	add    $0x8,%rsp
+  8039b0:	5b                   	pop    %rbx
+  8039b1:	41 5c                	pop    %r12
+  8039b3:	41 5d                	pop    %r13
+  8039b5:	5d                   	pop    %rbp
+  8039b6:	c3                   	ret
+  8039b7:	48 89 d0             	mov    %rdx,%rax
+  8039ba:	c3                   	ret
+
+00000000008039bb <cputchar>:
+cputchar(int ch) {
+  8039bb:	55                   	push   %rbp
+  8039bc:	48 89 e5             	mov    %rsp,%rbp
+  8039bf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8039c3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8039c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8039cc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8039d0:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+}
+  8039dc:	c9                   	leave
+  8039dd:	c3                   	ret
+
+00000000008039de <getchar>:
+getchar(void) {
+  8039de:	55                   	push   %rbp
+  8039df:	48 89 e5             	mov    %rsp,%rbp
+  8039e2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8039e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8039eb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8039ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f4:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  8039fb:	00 00 00 
+  8039fe:	ff d0                	call   *%rax
+  803a00:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	78 06                	js     803a0c <getchar+0x2e>
+  803a06:	74 08                	je     803a10 <getchar+0x32>
+  803a08:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803a0c:	89 d0                	mov    %edx,%eax
+  803a0e:	c9                   	leave
+  803a0f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803a10:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803a15:	eb f5                	jmp    803a0c <getchar+0x2e>
+
+0000000000803a17 <iscons>:
+iscons(int fdnum) {
+  803a17:	55                   	push   %rbp
+  803a18:	48 89 e5             	mov    %rsp,%rbp
+  803a1b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a1f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a23:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a2f:	85 c0                	test   %eax,%eax
+  803a31:	78 18                	js     803a4b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803a33:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a37:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  803a3e:	00 00 00 
+  803a41:	8b 00                	mov    (%rax),%eax
+  803a43:	39 02                	cmp    %eax,(%rdx)
+  803a45:	0f 94 c0             	sete   %al
+  803a48:	0f b6 c0             	movzbl %al,%eax
+}
+  803a4b:	c9                   	leave
+  803a4c:	c3                   	ret
+
+0000000000803a4d <opencons>:
+opencons(void) {
+  803a4d:	55                   	push   %rbp
+  803a4e:	48 89 e5             	mov    %rsp,%rbp
+  803a51:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a55:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803a59:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  803a60:	00 00 00 
+  803a63:	ff d0                	call   *%rax
+  803a65:	85 c0                	test   %eax,%eax
+  803a67:	78 49                	js     803ab2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803a69:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a73:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803a77:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a7c:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  803a83:	00 00 00 
+  803a86:	ff d0                	call   *%rax
+  803a88:	85 c0                	test   %eax,%eax
+  803a8a:	78 26                	js     803ab2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803a8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a90:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803a97:	00 00 
+  803a99:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803a9b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a9f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803aa6:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  803aad:	00 00 00 
+  803ab0:	ff d0                	call   *%rax
+}
+  803ab2:	c9                   	leave
+  803ab3:	c3                   	ret
+  803ab4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803ab8 <__rodata_start>:
+  803ab8:	74 65                	je     803b1f <__rodata_start+0x67>
+  803aba:	73 74                	jae    803b30 <__rodata_start+0x78>
+  803abc:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  803ac3:	20 64 75 70          	and    %ah,0x70(%rbp,%rsi,2)
+  803ac7:	20 72 61             	and    %dh,0x61(%rdx)
+  803aca:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  803acd:	2e 2e 0a 00          	cs cs or (%rax),%al
+  803ad1:	70 69                	jo     803b3c <__rodata_start+0x84>
+  803ad3:	70 65                	jo     803b3a <__rodata_start+0x82>
+  803ad5:	3a 20                	cmp    (%rax),%ah
+  803ad7:	25 69 00 75 73       	and    $0x73750069,%eax
+  803adc:	65 72 2f             	gs jb  803b0e <__rodata_start+0x56>
+  803adf:	74 65                	je     803b46 <__rodata_start+0x8e>
+  803ae1:	73 74                	jae    803b57 <__rodata_start+0x9f>
+  803ae3:	70 69                	jo     803b4e <__rodata_start+0x96>
+  803ae5:	70 65                	jo     803b4c <__rodata_start+0x94>
+  803ae7:	72 61                	jb     803b4a <__rodata_start+0x92>
+  803ae9:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  803aec:	63 00                	movsxd (%rax),%eax
+  803aee:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803af0:	72 6b                	jb     803b5d <__rodata_start+0xa5>
+  803af2:	3a 20                	cmp    (%rax),%ah
+  803af4:	25 69 00 52 41       	and    $0x41520069,%eax
+  803af9:	43                   	rex.XB
+  803afa:	45 3a 20             	cmp    (%r8),%r12b
+  803afd:	70 69                	jo     803b68 <__rodata_start+0xb0>
+  803aff:	70 65                	jo     803b66 <__rodata_start+0xae>
+  803b01:	20 61 70             	and    %ah,0x70(%rcx)
+  803b04:	70 65                	jo     803b6b <__rodata_start+0xb3>
+  803b06:	61                   	(bad)
+  803b07:	72 73                	jb     803b7c <__rodata_start+0xc4>
+  803b09:	20 63 6c             	and    %ah,0x6c(%rbx)
+  803b0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b0d:	73 65                	jae    803b74 <__rodata_start+0xbc>
+  803b0f:	64 0a 00             	or     %fs:(%rax),%al
+  803b12:	70 69                	jo     803b7d <__rodata_start+0xc5>
+  803b14:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  803b18:	20 25 64 0a 00 6b    	and    %ah,0x6b000a64(%rip)        # 6b804582 <__bss_end+0x6affb582>
+  803b1e:	69 64 20 69 73 20 25 	imul   $0x64252073,0x69(%rax,%riz,1),%esp
+  803b25:	64 
+  803b26:	0a 00                	or     (%rax),%al
+  803b28:	63 68 69             	movsxd 0x69(%rax),%ebp
+  803b2b:	6c                   	insb   (%dx),%es:(%rdi)
+  803b2c:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  803b31:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  803b35:	74 68                	je     803b9f <__rodata_start+0xe7>
+  803b37:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  803b3b:	70 0a                	jo     803b47 <__rodata_start+0x8f>
+  803b3d:	00 63 61             	add    %ah,0x61(%rbx)
+  803b40:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b43:	74 20                	je     803b65 <__rodata_start+0xad>
+  803b45:	6c                   	insb   (%dx),%es:(%rdi)
+  803b46:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b47:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b48:	6b 20 75             	imul   $0x75,(%rax),%esp
+  803b4b:	70 20                	jo     803b6d <__rodata_start+0xb5>
+  803b4d:	70 5b                	jo     803baa <__rodata_start+0xf2>
+  803b4f:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  803b52:	20 25 69 00 0a 63    	and    %ah,0x630a0069(%rip)        # 638a3bc1 <__bss_end+0x6309abc1>
+  803b58:	68 69 6c 64 20       	push   $0x20646c69
+  803b5d:	64 65 74 65          	fs gs je 803bc6 <__rodata_start+0x10e>
+  803b61:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803b65:	20 72 61             	and    %dh,0x61(%rdx)
+  803b68:	63 65 0a             	movsxd 0xa(%rbp),%esp
+  803b6b:	00 0f                	add    %cl,(%rdi)
+  803b6d:	1f                   	(bad)
+  803b6e:	40 00 73 6f          	add    %sil,0x6f(%rbx)
+  803b72:	6d                   	insl   (%dx),%es:(%rdi)
+  803b73:	65 68 6f 77 20 74    	gs push $0x7420776f
+  803b79:	68 65 20 6f 74       	push   $0x746f2065
+  803b7e:	68 65 72 20 65       	push   $0x65207265
+  803b83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b84:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803b88:	20 70 5b             	and    %dh,0x5b(%rax)
+  803b8b:	30 5d 20             	xor    %bl,0x20(%rbp)
+  803b8e:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803b90:	74 20                	je     803bb2 <__rodata_start+0xfa>
+  803b92:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  803b96:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  803b9a:	00 00                	add    %al,(%rax)
+  803b9c:	00 00                	add    %al,(%rax)
+  803b9e:	00 00                	add    %al,(%rax)
+  803ba0:	0a 72 61             	or     0x61(%rdx),%dh
+  803ba3:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803ba6:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  803bad:	68 61 
+  803baf:	70 70                	jo     803c21 <__rodata_start+0x169>
+  803bb1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bb3:	20 28                	and    %ch,(%rax)
+  803bb5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb6:	75 6d                	jne    803c25 <__rodata_start+0x16d>
+  803bb8:	62 65                	(bad)
+  803bba:	72 20                	jb     803bdc <__rodata_start+0x124>
+  803bbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbd:	66 20 74 65 73       	data16 and %dh,0x73(%rbp,%riz,2)
+  803bc2:	74 73                	je     803c37 <__rodata_start+0x17f>
+  803bc4:	3a 20                	cmp    (%rax),%ah
+  803bc6:	25 64 29 0a 00       	and    $0xa2964,%eax
+  803bcb:	3c 75                	cmp    $0x75,%al
+  803bcd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bce:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803bd2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bd3:	3e 00 0f             	ds add %cl,(%rdi)
+  803bd6:	1f                   	(bad)
+  803bd7:	00 5b 25             	add    %bl,0x25(%rbx)
+  803bda:	30 38                	xor    %bh,(%rax)
+  803bdc:	78 5d                	js     803c3b <__rodata_start+0x183>
+  803bde:	20 75 73             	and    %dh,0x73(%rbp)
+  803be1:	65 72 20             	gs jb  803c04 <__rodata_start+0x14c>
+  803be4:	70 61                	jo     803c47 <__rodata_start+0x18f>
+  803be6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803be7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803bee:	73 20                	jae    803c10 <__rodata_start+0x158>
+  803bf0:	61                   	(bad)
+  803bf1:	74 20                	je     803c13 <__rodata_start+0x15b>
+  803bf3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803bf8:	3a 20                	cmp    (%rax),%ah
+  803bfa:	00 30                	add    %dh,(%rax)
+  803bfc:	31 32                	xor    %esi,(%rdx)
+  803bfe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c05:	41                   	rex.B
+  803c06:	42                   	rex.X
+  803c07:	43                   	rex.XB
+  803c08:	44                   	rex.R
+  803c09:	45                   	rex.RB
+  803c0a:	46 00 30             	rex.RX add %r14b,(%rax)
+  803c0d:	31 32                	xor    %esi,(%rdx)
+  803c0f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803c16:	61                   	(bad)
+  803c17:	62 63 64 65 66       	(bad)
+  803c1c:	00 28                	add    %ch,(%rax)
+  803c1e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c1f:	75 6c                	jne    803c8d <__rodata_start+0x1d5>
+  803c21:	6c                   	insb   (%dx),%es:(%rdi)
+  803c22:	29 00                	sub    %eax,(%rax)
+  803c24:	65 72 72             	gs jb  803c99 <__rodata_start+0x1e1>
+  803c27:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c28:	72 20                	jb     803c4a <__rodata_start+0x192>
+  803c2a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803c2f:	73 70                	jae    803ca1 <__rodata_start+0x1e9>
+  803c31:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803c35:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803c3c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c3d:	72 00                	jb     803c3f <__rodata_start+0x187>
+  803c3f:	62 61 64 20 65       	(bad)
+  803c44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c45:	76 69                	jbe    803cb0 <__rodata_start+0x1f8>
+  803c47:	72 6f                	jb     803cb8 <__rodata_start+0x200>
+  803c49:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c4a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c4b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c4d:	74 00                	je     803c4f <__rodata_start+0x197>
+  803c4f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c56:	20 70 61             	and    %dh,0x61(%rax)
+  803c59:	72 61                	jb     803cbc <__rodata_start+0x204>
+  803c5b:	6d                   	insl   (%dx),%es:(%rdi)
+  803c5c:	65 74 65             	gs je  803cc4 <__rodata_start+0x20c>
+  803c5f:	72 00                	jb     803c61 <__rodata_start+0x1a9>
+  803c61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c62:	75 74                	jne    803cd8 <__rodata_start+0x220>
+  803c64:	20 6f 66             	and    %ch,0x66(%rdi)
+  803c67:	20 6d 65             	and    %ch,0x65(%rbp)
+  803c6a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6c:	72 79                	jb     803ce7 <__rodata_start+0x22f>
+  803c6e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803c71:	74 20                	je     803c93 <__rodata_start+0x1db>
+  803c73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c74:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803c78:	76 69                	jbe    803ce3 <__rodata_start+0x22b>
+  803c7a:	72 6f                	jb     803ceb <__rodata_start+0x233>
+  803c7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c7d:	6d                   	insl   (%dx),%es:(%rdi)
+  803c7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c80:	74 73                	je     803cf5 <__rodata_start+0x23d>
+  803c82:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803c85:	72 72                	jb     803cf9 <__rodata_start+0x241>
+  803c87:	75 70                	jne    803cf9 <__rodata_start+0x241>
+  803c89:	74 65                	je     803cf0 <__rodata_start+0x238>
+  803c8b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803c90:	75 67                	jne    803cf9 <__rodata_start+0x241>
+  803c92:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c95:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c97:	00 73 65             	add    %dh,0x65(%rbx)
+  803c9a:	67 6d                	insl   (%dx),%es:(%edi)
+  803c9c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c9e:	74 61                	je     803d01 <__rodata_start+0x249>
+  803ca0:	74 69                	je     803d0b <__rodata_start+0x253>
+  803ca2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ca3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ca4:	20 66 61             	and    %ah,0x61(%rsi)
+  803ca7:	75 6c                	jne    803d15 <__rodata_start+0x25d>
+  803ca9:	74 00                	je     803cab <__rodata_start+0x1f3>
+  803cab:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803cb2:	20 45 4c             	and    %al,0x4c(%rbp)
+  803cb5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803cb9:	61                   	(bad)
+  803cba:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803cbf:	20 73 75             	and    %dh,0x75(%rbx)
+  803cc2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803cc5:	73 79                	jae    803d40 <__rodata_start+0x288>
+  803cc7:	73 74                	jae    803d3d <__rodata_start+0x285>
+  803cc9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803ccb:	20 63 61             	and    %ah,0x61(%rbx)
+  803cce:	6c                   	insb   (%dx),%es:(%rdi)
+  803ccf:	6c                   	insb   (%dx),%es:(%rdi)
+  803cd0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803cd3:	74 72                	je     803d47 <__rodata_start+0x28f>
+  803cd5:	79 20                	jns    803cf7 <__rodata_start+0x23f>
+  803cd7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cd8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cd9:	74 20                	je     803cfb <__rodata_start+0x243>
+  803cdb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803cdd:	75 6e                	jne    803d4d <__rodata_start+0x295>
+  803cdf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803ce3:	76 20                	jbe    803d05 <__rodata_start+0x24d>
+  803ce5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803cec:	72 65                	jb     803d53 <__rodata_start+0x29b>
+  803cee:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803cf1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cf2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803cf6:	65 78 70             	gs js  803d69 <__rodata_start+0x2b1>
+  803cf9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803cfe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803d01:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803d05:	20 66 69             	and    %ah,0x69(%rsi)
+  803d08:	6c                   	insb   (%dx),%es:(%rdi)
+  803d09:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803d0d:	20 66 72             	and    %ah,0x72(%rsi)
+  803d10:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803d15:	61                   	(bad)
+  803d16:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803d19:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d1b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803d1f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803d22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d23:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d24:	20 6d 61             	and    %ch,0x61(%rbp)
+  803d27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d28:	79 20                	jns    803d4a <__rodata_start+0x292>
+  803d2a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803d31:	72 65                	jb     803d98 <__rodata_start+0x2e0>
+  803d33:	20 6f 70             	and    %ch,0x70(%rdi)
+  803d36:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d38:	00 66 69             	add    %ah,0x69(%rsi)
+  803d3b:	6c                   	insb   (%dx),%es:(%rdi)
+  803d3c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803d40:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803d43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d44:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803d47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d48:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d49:	74 20                	je     803d6b <__rodata_start+0x2b3>
+  803d4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d4d:	75 6e                	jne    803dbd <__rodata_start+0x305>
+  803d4f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803d53:	76 61                	jbe    803db6 <__rodata_start+0x2fe>
+  803d55:	6c                   	insb   (%dx),%es:(%rdi)
+  803d56:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803d5d:	00 
+  803d5e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803d65:	72 65                	jb     803dcc <__rodata_start+0x314>
+  803d67:	61                   	(bad)
+  803d68:	64 79 20             	fs jns 803d8b <__rodata_start+0x2d3>
+  803d6b:	65 78 69             	gs js  803dd7 <__rodata_start+0x31f>
+  803d6e:	73 74                	jae    803de4 <__rodata_start+0x32c>
+  803d70:	73 00                	jae    803d72 <__rodata_start+0x2ba>
+  803d72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d73:	70 65                	jo     803dda <__rodata_start+0x322>
+  803d75:	72 61                	jb     803dd8 <__rodata_start+0x320>
+  803d77:	74 69                	je     803de2 <__rodata_start+0x32a>
+  803d79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d7b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803d7e:	74 20                	je     803da0 <__rodata_start+0x2e8>
+  803d80:	73 75                	jae    803df7 <__rodata_start+0x33f>
+  803d82:	70 70                	jo     803df4 <__rodata_start+0x33c>
+  803d84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d85:	72 74                	jb     803dfb <__rodata_start+0x343>
+  803d87:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803d8d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803d92:	74 00                	je     803d94 <__rodata_start+0x2dc>
+  803d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803d9b:	00 00 00 
+  803d9e:	66 90                	xchg   %ax,%ax
+  803da0:	69 07 80 00 00 00    	imul   $0x80,(%rdi),%eax
+  803da6:	00 00                	add    %al,(%rax)
+  803da8:	aa                   	stos   %al,%es:(%rdi)
+  803da9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dae:	00 00                	add    %al,(%rax)
+  803db0:	9a                   	(bad)
+  803db1:	0d 80 00 00 00       	or     $0x80,%eax
+  803db6:	00 00                	add    %al,(%rax)
+  803db8:	aa                   	stos   %al,%es:(%rdi)
+  803db9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dbe:	00 00                	add    %al,(%rax)
+  803dc0:	aa                   	stos   %al,%es:(%rdi)
+  803dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  803dc6:	00 00                	add    %al,(%rax)
+  803dc8:	aa                   	stos   %al,%es:(%rdi)
+  803dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  803dce:	00 00                	add    %al,(%rax)
+  803dd0:	aa                   	stos   %al,%es:(%rdi)
+  803dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  803dd6:	00 00                	add    %al,(%rax)
+  803dd8:	88 07                	mov    %al,(%rdi)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 7c 07 80          	add    %bh,-0x80(%rdi,%rax,1)
+  803df3:	00 00                	add    %al,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 f6                	add    %dh,%dh
+  803df9:	07                   	(bad)
+  803dfa:	80 00 00             	addb   $0x0,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 7c 07 80          	add    %bh,-0x80(%rdi,%rax,1)
+  803e0b:	00 00                	add    %al,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 c2                	add    %al,%dl
+  803e11:	07                   	(bad)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 c2                	add    %al,%dl
+  803e19:	07                   	(bad)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 c2                	add    %al,%dl
+  803e21:	07                   	(bad)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 c2                	add    %al,%dl
+  803e29:	07                   	(bad)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 c2                	add    %al,%dl
+  803e31:	07                   	(bad)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 c2                	add    %al,%dl
+  803e39:	07                   	(bad)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 c2                	add    %al,%dl
+  803e41:	07                   	(bad)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 c2                	add    %al,%dl
+  803e49:	07                   	(bad)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 c2                	add    %al,%dl
+  803e51:	07                   	(bad)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 cd                	add    %cl,%ch
+  803f49:	0c 80                	or     $0x80,%al
+  803f4b:	00 00                	add    %al,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 19                	add    %bl,(%rcx)
+  803fa1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803fa7:	00 e8                	add    %ch,%al
+  803fa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803faf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fbd:	00 00                	add    %al,(%rax)
+  803fbf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fc5:	00 00                	add    %al,(%rax)
+  803fc7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fcd:	00 00                	add    %al,(%rax)
+  803fcf:	00 48 08             	add    %cl,0x8(%rax)
+  803fd2:	80 00 00             	addb   $0x0,(%rax)
+  803fd5:	00 00                	add    %al,(%rax)
+  803fd7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fdd:	00 00                	add    %al,(%rax)
+  803fdf:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 0e                	add    %cl,(%rsi)
+  803fe9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803fef:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 5a 0c             	add    %bl,0xc(%rdx)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  80401d:	00 00                	add    %al,(%rax)
+  80401f:	00 df                	add    %bl,%bh
+  804021:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804027:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 bc 0a 80 00 00 00 	add    %bh,0x80(%rdx,%rcx,1)
+  804036:	00 00                	add    %al,(%rax)
+  804038:	aa                   	stos   %al,%es:(%rdi)
+  804039:	0d 80 00 00 00       	or     $0x80,%eax
+  80403e:	00 00                	add    %al,(%rax)
+  804040:	aa                   	stos   %al,%es:(%rdi)
+  804041:	0d 80 00 00 00       	or     $0x80,%eax
+  804046:	00 00                	add    %al,(%rax)
+  804048:	cd 0c                	int    $0xc
+  80404a:	80 00 00             	addb   $0x0,(%rax)
+  80404d:	00 00                	add    %al,(%rax)
+  80404f:	00 aa 0d 80 00 00    	add    %ch,0x800d(%rdx)
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 72 07             	add    %dh,0x7(%rdx)
+  80405a:	80 00 00             	addb   $0x0,(%rax)
+  80405d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804060 <error_string>:
+	...
+  804068:	2d 3c 80 00 00 00 00 00 3f 3c 80 00 00 00 00 00     -<......?<......
+  804078:	4f 3c 80 00 00 00 00 00 61 3c 80 00 00 00 00 00     O<......a<......
+  804088:	6f 3c 80 00 00 00 00 00 83 3c 80 00 00 00 00 00     o<.......<......
+  804098:	98 3c 80 00 00 00 00 00 ab 3c 80 00 00 00 00 00     .<.......<......
+  8040a8:	bd 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  8040b8:	e1 3c 80 00 00 00 00 00 f4 3c 80 00 00 00 00 00     .<.......<......
+  8040c8:	0b 3d 80 00 00 00 00 00 21 3d 80 00 00 00 00 00     .=......!=......
+  8040d8:	39 3d 80 00 00 00 00 00 51 3d 80 00 00 00 00 00     9=......Q=......
+  8040e8:	5e 3d 80 00 00 00 00 00 08 41 80 00 00 00 00 00     ^=.......A......
+  8040f8:	72 3d 80 00 00 00 00 00 8a 3d 80 00 00 00 00 00     r=.......=......
+  804108:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804118:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804158:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804168:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804178:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804188:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804198:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8041a8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8041b8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  8041c8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  8041d8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  8041e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8041f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804208:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804218:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804228:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804238:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804240 <devtab>:
+  804240:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804250:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804260:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804270:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804280:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804290:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8042a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8042b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8042c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
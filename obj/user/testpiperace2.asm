@@ -0,0 +1,7503 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 02 00 00       	call   8002dd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf 38 3a 80 00 00 	movabs $0x803a38,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba fe 04 80 00 00 	movabs $0x8004fe,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 c8 31 80 00 00 	movabs $0x8031c8,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 9d 00 00 00    	js     800106 <umain+0xe1>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 7f 18 80 00 00 	movabs $0x80187f,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 b3 00 00 00    	js     800133 <umain+0x10e>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 d6 00 00 00    	je     800160 <umain+0x13b>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80008d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800092:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800096:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80009a:	48 c1 e0 04          	shl    $0x4,%rax
+  80009e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000a5:	00 00 00 
+  8000a8:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000ab:	49 bc d4 33 80 00 00 	movabs $0x8033d4,%r12
+  8000b2:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000b5:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8000bb:	83 f8 02             	cmp    $0x2,%eax
+  8000be:	0f 85 43 01 00 00    	jne    800207 <umain+0x1e2>
+        if (pipeisclosed(p[0]) != 0) {
+  8000c4:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000c7:	41 ff d4             	call   *%r12
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	74 e7                	je     8000b5 <umain+0x90>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000ce:	48 bf b5 3a 80 00 00 	movabs $0x803ab5,%rdi
+  8000d5:	00 00 00 
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	48 ba fe 04 80 00 00 	movabs $0x8004fe,%rdx
+  8000e4:	00 00 00 
+  8000e7:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000e9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000ec:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+            exit();
+  8000f8:	48 b8 8b 03 80 00 00 	movabs $0x80038b,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb af                	jmp    8000b5 <umain+0x90>
+        panic("pipe: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba 8a 3a 80 00 00 	movabs $0x803a8a,%rdx
+  80010f:	00 00 00 
+  800112:	be 0c 00 00 00       	mov    $0xc,%esi
+  800117:	48 bf 93 3a 80 00 00 	movabs $0x803a93,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800133:	89 c1                	mov    %eax,%ecx
+  800135:	48 ba a8 3a 80 00 00 	movabs $0x803aa8,%rdx
+  80013c:	00 00 00 
+  80013f:	be 0e 00 00 00       	mov    $0xe,%esi
+  800144:	48 bf 93 3a 80 00 00 	movabs $0x803a93,%rdi
+  80014b:	00 00 00 
+  80014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800153:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  80015a:	00 00 00 
+  80015d:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800160:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800163:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  80016f:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  800172:	49 bf b1 3a 80 00 00 	movabs $0x803ab1,%r15
+  800179:	00 00 00 
+  80017c:	49 be fe 04 80 00 00 	movabs $0x8004fe,%r14
+  800183:	00 00 00 
+            dup(p[0], 10);
+  800186:	49 bd dc 1b 80 00 00 	movabs $0x801bdc,%r13
+  80018d:	00 00 00 
+            sys_yield();
+  800190:	49 bc 20 14 80 00 00 	movabs $0x801420,%r12
+  800197:	00 00 00 
+  80019a:	eb 2d                	jmp    8001c9 <umain+0x1a4>
+            dup(p[0], 10);
+  80019c:	be 0a 00 00 00       	mov    $0xa,%esi
+  8001a1:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8001a4:	41 ff d5             	call   *%r13
+            sys_yield();
+  8001a7:	41 ff d4             	call   *%r12
+            close(10);
+  8001aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001af:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+            sys_yield();
+  8001bb:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001be:	83 c3 01             	add    $0x1,%ebx
+  8001c1:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001c7:	74 2d                	je     8001f6 <umain+0x1d1>
+            if (i % 10 == 0)
+  8001c9:	48 63 c3             	movslq %ebx,%rax
+  8001cc:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001d3:	48 c1 f8 22          	sar    $0x22,%rax
+  8001d7:	89 da                	mov    %ebx,%edx
+  8001d9:	c1 fa 1f             	sar    $0x1f,%edx
+  8001dc:	29 d0                	sub    %edx,%eax
+  8001de:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001e1:	01 c0                	add    %eax,%eax
+  8001e3:	39 c3                	cmp    %eax,%ebx
+  8001e5:	75 b5                	jne    80019c <umain+0x177>
+                cprintf("%d.", i);
+  8001e7:	89 de                	mov    %ebx,%esi
+  8001e9:	4c 89 ff             	mov    %r15,%rdi
+  8001ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f1:	41 ff d6             	call   *%r14
+  8001f4:	eb a6                	jmp    80019c <umain+0x177>
+        exit();
+  8001f6:	48 b8 8b 03 80 00 00 	movabs $0x80038b,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+  800202:	e9 83 fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  800207:	48 bf d1 3a 80 00 00 	movabs $0x803ad1,%rdi
+  80020e:	00 00 00 
+  800211:	b8 00 00 00 00       	mov    $0x0,%eax
+  800216:	48 ba fe 04 80 00 00 	movabs $0x8004fe,%rdx
+  80021d:	00 00 00 
+  800220:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  800222:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800225:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+  800231:	85 c0                	test   %eax,%eax
+  800233:	75 51                	jne    800286 <umain+0x261>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800235:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800239:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80023c:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  800243:	00 00 00 
+  800246:	ff d0                	call   *%rax
+  800248:	85 c0                	test   %eax,%eax
+  80024a:	78 64                	js     8002b0 <umain+0x28b>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  80024c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800250:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  800257:	00 00 00 
+  80025a:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  80025c:	48 bf ff 3a 80 00 00 	movabs $0x803aff,%rdi
+  800263:	00 00 00 
+  800266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026b:	48 ba fe 04 80 00 00 	movabs $0x8004fe,%rdx
+  800272:	00 00 00 
+  800275:	ff d2                	call   *%rdx
+}
+  800277:	48 83 c4 28          	add    $0x28,%rsp
+  80027b:	5b                   	pop    %rbx
+  80027c:	41 5c                	pop    %r12
+  80027e:	41 5d                	pop    %r13
+  800280:	41 5e                	pop    %r14
+  800282:	41 5f                	pop    %r15
+  800284:	5d                   	pop    %rbp
+  800285:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  800286:	48 ba 60 3a 80 00 00 	movabs $0x803a60,%rdx
+  80028d:	00 00 00 
+  800290:	be 40 00 00 00       	mov    $0x40,%esi
+  800295:	48 bf 93 3a 80 00 00 	movabs $0x803a93,%rdi
+  80029c:	00 00 00 
+  80029f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a4:	48 b9 ae 03 80 00 00 	movabs $0x8003ae,%rcx
+  8002ab:	00 00 00 
+  8002ae:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002b0:	89 c1                	mov    %eax,%ecx
+  8002b2:	48 ba e7 3a 80 00 00 	movabs $0x803ae7,%rdx
+  8002b9:	00 00 00 
+  8002bc:	be 42 00 00 00       	mov    $0x42,%esi
+  8002c1:	48 bf 93 3a 80 00 00 	movabs $0x803a93,%rdi
+  8002c8:	00 00 00 
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d0:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8002d7:	00 00 00 
+  8002da:	41 ff d0             	call   *%r8
+
+00000000008002dd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002dd:	55                   	push   %rbp
+  8002de:	48 89 e5             	mov    %rsp,%rbp
+  8002e1:	41 56                	push   %r14
+  8002e3:	41 55                	push   %r13
+  8002e5:	41 54                	push   %r12
+  8002e7:	53                   	push   %rbx
+  8002e8:	41 89 fd             	mov    %edi,%r13d
+  8002eb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002ee:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8002f5:	00 00 00 
+  8002f8:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8002ff:	00 00 00 
+  800302:	48 39 c2             	cmp    %rax,%rdx
+  800305:	73 17                	jae    80031e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800307:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80030a:	49 89 c4             	mov    %rax,%r12
+  80030d:	48 83 c3 08          	add    $0x8,%rbx
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	ff 53 f8             	call   *-0x8(%rbx)
+  800319:	4c 39 e3             	cmp    %r12,%rbx
+  80031c:	72 ef                	jb     80030d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80031e:	48 b8 ef 13 80 00 00 	movabs $0x8013ef,%rax
+  800325:	00 00 00 
+  800328:	ff d0                	call   *%rax
+  80032a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80032f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800333:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800337:	48 c1 e0 04          	shl    $0x4,%rax
+  80033b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800342:	00 00 00 
+  800345:	48 01 d0             	add    %rdx,%rax
+  800348:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80034f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800352:	45 85 ed             	test   %r13d,%r13d
+  800355:	7e 0d                	jle    800364 <libmain+0x87>
+  800357:	49 8b 06             	mov    (%r14),%rax
+  80035a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800361:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800364:	4c 89 f6             	mov    %r14,%rsi
+  800367:	44 89 ef             	mov    %r13d,%edi
+  80036a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800376:	48 b8 8b 03 80 00 00 	movabs $0x80038b,%rax
+  80037d:	00 00 00 
+  800380:	ff d0                	call   *%rax
+#endif
+}
+  800382:	5b                   	pop    %rbx
+  800383:	41 5c                	pop    %r12
+  800385:	41 5d                	pop    %r13
+  800387:	41 5e                	pop    %r14
+  800389:	5d                   	pop    %rbp
+  80038a:	c3                   	ret
+
+000000000080038b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80038b:	55                   	push   %rbp
+  80038c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80038f:	48 b8 b4 1b 80 00 00 	movabs $0x801bb4,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80039b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003a0:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+}
+  8003ac:	5d                   	pop    %rbp
+  8003ad:	c3                   	ret
+
+00000000008003ae <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	41 56                	push   %r14
+  8003b4:	41 55                	push   %r13
+  8003b6:	41 54                	push   %r12
+  8003b8:	53                   	push   %rbx
+  8003b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003bd:	49 89 fc             	mov    %rdi,%r12
+  8003c0:	41 89 f5             	mov    %esi,%r13d
+  8003c3:	48 89 d3             	mov    %rdx,%rbx
+  8003c6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003ca:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003ce:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003d2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003d9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003dd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003e1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003e5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003e9:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8003f0:	00 00 00 
+  8003f3:	4c 8b 30             	mov    (%rax),%r14
+  8003f6:	48 b8 ef 13 80 00 00 	movabs $0x8013ef,%rax
+  8003fd:	00 00 00 
+  800400:	ff d0                	call   *%rax
+  800402:	89 c6                	mov    %eax,%esi
+  800404:	45 89 e8             	mov    %r13d,%r8d
+  800407:	4c 89 e1             	mov    %r12,%rcx
+  80040a:	4c 89 f2             	mov    %r14,%rdx
+  80040d:	48 bf 20 3b 80 00 00 	movabs $0x803b20,%rdi
+  800414:	00 00 00 
+  800417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041c:	49 bc fe 04 80 00 00 	movabs $0x8004fe,%r12
+  800423:	00 00 00 
+  800426:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800429:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80042d:	48 89 df             	mov    %rbx,%rdi
+  800430:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  800437:	00 00 00 
+  80043a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80043c:	48 bf cf 3a 80 00 00 	movabs $0x803acf,%rdi
+  800443:	00 00 00 
+  800446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80044e:	cc                   	int3
+  80044f:	eb fd                	jmp    80044e <_panic+0xa0>
+
+0000000000800451 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800451:	55                   	push   %rbp
+  800452:	48 89 e5             	mov    %rsp,%rbp
+  800455:	53                   	push   %rbx
+  800456:	48 83 ec 08          	sub    $0x8,%rsp
+  80045a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80045d:	8b 06                	mov    (%rsi),%eax
+  80045f:	8d 50 01             	lea    0x1(%rax),%edx
+  800462:	89 16                	mov    %edx,(%rsi)
+  800464:	48 98                	cltq
+  800466:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80046b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800471:	74 0a                	je     80047d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800473:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80047b:	c9                   	leave
+  80047c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80047d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800481:	be ff 00 00 00       	mov    $0xff,%esi
+  800486:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  80048d:	00 00 00 
+  800490:	ff d0                	call   *%rax
+        state->offset = 0;
+  800492:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800498:	eb d9                	jmp    800473 <putch+0x22>
+
+000000000080049a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80049a:	55                   	push   %rbp
+  80049b:	48 89 e5             	mov    %rsp,%rbp
+  80049e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004a5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004a8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004af:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004bc:	48 89 f1             	mov    %rsi,%rcx
+  8004bf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004c6:	48 bf 51 04 80 00 00 	movabs $0x800451,%rdi
+  8004cd:	00 00 00 
+  8004d0:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  8004d7:	00 00 00 
+  8004da:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004dc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004e3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004ea:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  8004f1:	00 00 00 
+  8004f4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004f6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 50          	sub    $0x50,%rsp
+  800506:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80050a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80050e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800512:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800516:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80051a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800521:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800525:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800529:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80052d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800531:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800535:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  80053c:	00 00 00 
+  80053f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800541:	c9                   	leave
+  800542:	c3                   	ret
+
+0000000000800543 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800543:	55                   	push   %rbp
+  800544:	48 89 e5             	mov    %rsp,%rbp
+  800547:	41 57                	push   %r15
+  800549:	41 56                	push   %r14
+  80054b:	41 55                	push   %r13
+  80054d:	41 54                	push   %r12
+  80054f:	53                   	push   %rbx
+  800550:	48 83 ec 18          	sub    $0x18,%rsp
+  800554:	49 89 fc             	mov    %rdi,%r12
+  800557:	49 89 f5             	mov    %rsi,%r13
+  80055a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80055e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800561:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800564:	41 89 cf             	mov    %ecx,%r15d
+  800567:	4c 39 fa             	cmp    %r15,%rdx
+  80056a:	73 5b                	jae    8005c7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80056c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800570:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800574:	85 db                	test   %ebx,%ebx
+  800576:	7e 0e                	jle    800586 <print_num+0x43>
+            putch(padc, put_arg);
+  800578:	4c 89 ee             	mov    %r13,%rsi
+  80057b:	44 89 f7             	mov    %r14d,%edi
+  80057e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800581:	83 eb 01             	sub    $0x1,%ebx
+  800584:	75 f2                	jne    800578 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800586:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80058a:	48 b9 54 3b 80 00 00 	movabs $0x803b54,%rcx
+  800591:	00 00 00 
+  800594:	48 b8 43 3b 80 00 00 	movabs $0x803b43,%rax
+  80059b:	00 00 00 
+  80059e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ab:	49 f7 f7             	div    %r15
+  8005ae:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005b2:	4c 89 ee             	mov    %r13,%rsi
+  8005b5:	41 ff d4             	call   *%r12
+}
+  8005b8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005bc:	5b                   	pop    %rbx
+  8005bd:	41 5c                	pop    %r12
+  8005bf:	41 5d                	pop    %r13
+  8005c1:	41 5e                	pop    %r14
+  8005c3:	41 5f                	pop    %r15
+  8005c5:	5d                   	pop    %rbp
+  8005c6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d0:	49 f7 f7             	div    %r15
+  8005d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005db:	52                   	push   %rdx
+  8005dc:	45 0f be c9          	movsbl %r9b,%r9d
+  8005e0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005e4:	48 89 c2             	mov    %rax,%rdx
+  8005e7:	48 b8 43 05 80 00 00 	movabs $0x800543,%rax
+  8005ee:	00 00 00 
+  8005f1:	ff d0                	call   *%rax
+  8005f3:	48 83 c4 10          	add    $0x10,%rsp
+  8005f7:	eb 8d                	jmp    800586 <print_num+0x43>
+
+00000000008005f9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005f9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005fd:	48 8b 06             	mov    (%rsi),%rax
+  800600:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800604:	73 0a                	jae    800610 <sprintputch+0x17>
+        *state->start++ = ch;
+  800606:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80060a:	48 89 16             	mov    %rdx,(%rsi)
+  80060d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800610:	c3                   	ret
+
+0000000000800611 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800611:	55                   	push   %rbp
+  800612:	48 89 e5             	mov    %rsp,%rbp
+  800615:	48 83 ec 50          	sub    $0x50,%rsp
+  800619:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80061d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800621:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800625:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80062c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800630:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800634:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800638:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80063c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800640:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  800647:	00 00 00 
+  80064a:	ff d0                	call   *%rax
+}
+  80064c:	c9                   	leave
+  80064d:	c3                   	ret
+
+000000000080064e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80064e:	55                   	push   %rbp
+  80064f:	48 89 e5             	mov    %rsp,%rbp
+  800652:	41 57                	push   %r15
+  800654:	41 56                	push   %r14
+  800656:	41 55                	push   %r13
+  800658:	41 54                	push   %r12
+  80065a:	53                   	push   %rbx
+  80065b:	48 83 ec 38          	sub    $0x38,%rsp
+  80065f:	49 89 fe             	mov    %rdi,%r14
+  800662:	49 89 f5             	mov    %rsi,%r13
+  800665:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800668:	48 8b 01             	mov    (%rcx),%rax
+  80066b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80066f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800673:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800677:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80067b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80067f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800683:	0f b6 3b             	movzbl (%rbx),%edi
+  800686:	40 80 ff 25          	cmp    $0x25,%dil
+  80068a:	74 18                	je     8006a4 <vprintfmt+0x56>
+            if (!ch) return;
+  80068c:	40 84 ff             	test   %dil,%dil
+  80068f:	0f 84 b1 06 00 00    	je     800d46 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800695:	40 0f b6 ff          	movzbl %dil,%edi
+  800699:	4c 89 ee             	mov    %r13,%rsi
+  80069c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80069f:	4c 89 e3             	mov    %r12,%rbx
+  8006a2:	eb db                	jmp    80067f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006ad:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006b2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006bf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006c3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006c8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006cd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006d0:	83 e8 23             	sub    $0x23,%eax
+  8006d3:	3c 57                	cmp    $0x57,%al
+  8006d5:	0f 87 51 06 00 00    	ja     800d2c <vprintfmt+0x6de>
+  8006db:	0f b6 c0             	movzbl %al,%eax
+  8006de:	48 b9 e0 3c 80 00 00 	movabs $0x803ce0,%rcx
+  8006e5:	00 00 00 
+  8006e8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006eb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006ee:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006f2:	eb cf                	jmp    8006c3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006f4:	49 89 dc             	mov    %rbx,%r12
+  8006f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8006fc:	eb c5                	jmp    8006c3 <vprintfmt+0x75>
+            padc = ch;
+  8006fe:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800702:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800705:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800708:	eb b9                	jmp    8006c3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80070a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070d:	83 f8 2f             	cmp    $0x2f,%eax
+  800710:	77 24                	ja     800736 <vprintfmt+0xe8>
+  800712:	89 c1                	mov    %eax,%ecx
+  800714:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800718:	83 c0 08             	add    $0x8,%eax
+  80071b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800721:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800724:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800728:	79 99                	jns    8006c3 <vprintfmt+0x75>
+                width = precision;
+  80072a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80072e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800734:	eb 8d                	jmp    8006c3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800736:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80073a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80073e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800742:	eb da                	jmp    80071e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800744:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800749:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80074d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800753:	3c 39                	cmp    $0x39,%al
+  800755:	77 1c                	ja     800773 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800757:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80075b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80075f:	0f b6 c0             	movzbl %al,%eax
+  800762:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800767:	0f b6 03             	movzbl (%rbx),%eax
+  80076a:	3c 39                	cmp    $0x39,%al
+  80076c:	76 e9                	jbe    800757 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80076e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800771:	eb b1                	jmp    800724 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800773:	49 89 dc             	mov    %rbx,%r12
+  800776:	eb ac                	jmp    800724 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800778:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80077b:	85 c9                	test   %ecx,%ecx
+  80077d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800782:	0f 49 c1             	cmovns %ecx,%eax
+  800785:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800788:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80078b:	e9 33 ff ff ff       	jmp    8006c3 <vprintfmt+0x75>
+            lflag++;
+  800790:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800793:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800796:	e9 28 ff ff ff       	jmp    8006c3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80079b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079e:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a1:	77 19                	ja     8007bc <vprintfmt+0x16e>
+  8007a3:	89 c2                	mov    %eax,%edx
+  8007a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a9:	83 c0 08             	add    $0x8,%eax
+  8007ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007af:	8b 3a                	mov    (%rdx),%edi
+  8007b1:	4c 89 ee             	mov    %r13,%rsi
+  8007b4:	41 ff d6             	call   *%r14
+            break;
+  8007b7:	e9 c3 fe ff ff       	jmp    80067f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c8:	eb e5                	jmp    8007af <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	77 5a                	ja     80082c <vprintfmt+0x1de>
+  8007d2:	89 c2                	mov    %eax,%edx
+  8007d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d8:	83 c0 08             	add    $0x8,%eax
+  8007db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007de:	8b 02                	mov    (%rdx),%eax
+  8007e0:	89 c1                	mov    %eax,%ecx
+  8007e2:	f7 d9                	neg    %ecx
+  8007e4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007e7:	83 f9 14             	cmp    $0x14,%ecx
+  8007ea:	7f 4e                	jg     80083a <vprintfmt+0x1ec>
+  8007ec:	48 63 c1             	movslq %ecx,%rax
+  8007ef:	48 ba a0 3f 80 00 00 	movabs $0x803fa0,%rdx
+  8007f6:	00 00 00 
+  8007f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007fd:	48 85 c0             	test   %rax,%rax
+  800800:	74 38                	je     80083a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800802:	48 89 c1             	mov    %rax,%rcx
+  800805:	48 ba 99 41 80 00 00 	movabs $0x804199,%rdx
+  80080c:	00 00 00 
+  80080f:	4c 89 ee             	mov    %r13,%rsi
+  800812:	4c 89 f7             	mov    %r14,%rdi
+  800815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081a:	49 b8 11 06 80 00 00 	movabs $0x800611,%r8
+  800821:	00 00 00 
+  800824:	41 ff d0             	call   *%r8
+  800827:	e9 53 fe ff ff       	jmp    80067f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80082c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800830:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800834:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800838:	eb a4                	jmp    8007de <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80083a:	48 ba 6c 3b 80 00 00 	movabs $0x803b6c,%rdx
+  800841:	00 00 00 
+  800844:	4c 89 ee             	mov    %r13,%rsi
+  800847:	4c 89 f7             	mov    %r14,%rdi
+  80084a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084f:	49 b8 11 06 80 00 00 	movabs $0x800611,%r8
+  800856:	00 00 00 
+  800859:	41 ff d0             	call   *%r8
+  80085c:	e9 1e fe ff ff       	jmp    80067f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800861:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800864:	83 f8 2f             	cmp    $0x2f,%eax
+  800867:	77 6c                	ja     8008d5 <vprintfmt+0x287>
+  800869:	89 c2                	mov    %eax,%edx
+  80086b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086f:	83 c0 08             	add    $0x8,%eax
+  800872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800875:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800878:	48 85 d2             	test   %rdx,%rdx
+  80087b:	48 b8 65 3b 80 00 00 	movabs $0x803b65,%rax
+  800882:	00 00 00 
+  800885:	48 0f 45 c2          	cmovne %rdx,%rax
+  800889:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80088d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800891:	7e 06                	jle    800899 <vprintfmt+0x24b>
+  800893:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800897:	75 4a                	jne    8008e3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800899:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80089d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a1:	0f b6 00             	movzbl (%rax),%eax
+  8008a4:	84 c0                	test   %al,%al
+  8008a6:	0f 85 9a 00 00 00    	jne    800946 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008af:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008b3:	85 c0                	test   %eax,%eax
+  8008b5:	0f 8e c4 fd ff ff    	jle    80067f <vprintfmt+0x31>
+  8008bb:	4c 89 ee             	mov    %r13,%rsi
+  8008be:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008c3:	41 ff d6             	call   *%r14
+  8008c6:	41 83 ec 01          	sub    $0x1,%r12d
+  8008ca:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008ce:	75 eb                	jne    8008bb <vprintfmt+0x26d>
+  8008d0:	e9 aa fd ff ff       	jmp    80067f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e1:	eb 92                	jmp    800875 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008e3:	49 63 f7             	movslq %r15d,%rsi
+  8008e6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008ea:	48 b8 00 0e 80 00 00 	movabs $0x800e00,%rax
+  8008f1:	00 00 00 
+  8008f4:	ff d0                	call   *%rax
+  8008f6:	48 89 c2             	mov    %rax,%rdx
+  8008f9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008fc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008fe:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800901:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800904:	85 c0                	test   %eax,%eax
+  800906:	7e 91                	jle    800899 <vprintfmt+0x24b>
+  800908:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80090d:	4c 89 ee             	mov    %r13,%rsi
+  800910:	44 89 e7             	mov    %r12d,%edi
+  800913:	41 ff d6             	call   *%r14
+  800916:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80091a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80091d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800920:	75 eb                	jne    80090d <vprintfmt+0x2bf>
+  800922:	e9 72 ff ff ff       	jmp    800899 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800927:	0f b6 f8             	movzbl %al,%edi
+  80092a:	4c 89 ee             	mov    %r13,%rsi
+  80092d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800930:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800934:	49 83 c4 01          	add    $0x1,%r12
+  800938:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80093e:	84 c0                	test   %al,%al
+  800940:	0f 84 66 ff ff ff    	je     8008ac <vprintfmt+0x25e>
+  800946:	45 85 ff             	test   %r15d,%r15d
+  800949:	78 0a                	js     800955 <vprintfmt+0x307>
+  80094b:	41 83 ef 01          	sub    $0x1,%r15d
+  80094f:	0f 88 57 ff ff ff    	js     8008ac <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800955:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800959:	74 cc                	je     800927 <vprintfmt+0x2d9>
+  80095b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80095e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800963:	80 fa 5e             	cmp    $0x5e,%dl
+  800966:	77 c2                	ja     80092a <vprintfmt+0x2dc>
+  800968:	eb bd                	jmp    800927 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80096a:	40 84 f6             	test   %sil,%sil
+  80096d:	75 26                	jne    800995 <vprintfmt+0x347>
+    switch (lflag) {
+  80096f:	85 d2                	test   %edx,%edx
+  800971:	74 59                	je     8009cc <vprintfmt+0x37e>
+  800973:	83 fa 01             	cmp    $0x1,%edx
+  800976:	74 7b                	je     8009f3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800978:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097b:	83 f8 2f             	cmp    $0x2f,%eax
+  80097e:	0f 87 96 00 00 00    	ja     800a1a <vprintfmt+0x3cc>
+  800984:	89 c2                	mov    %eax,%edx
+  800986:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098a:	83 c0 08             	add    $0x8,%eax
+  80098d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800990:	4c 8b 22             	mov    (%rdx),%r12
+  800993:	eb 17                	jmp    8009ac <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800998:	83 f8 2f             	cmp    $0x2f,%eax
+  80099b:	77 21                	ja     8009be <vprintfmt+0x370>
+  80099d:	89 c2                	mov    %eax,%edx
+  80099f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a3:	83 c0 08             	add    $0x8,%eax
+  8009a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009ac:	4d 85 e4             	test   %r12,%r12
+  8009af:	78 7a                	js     800a2b <vprintfmt+0x3dd>
+            num = i;
+  8009b1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009b9:	e9 50 02 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	eb dd                	jmp    8009a9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 11                	ja     8009e5 <vprintfmt+0x397>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	4c 63 22             	movslq (%rdx),%r12
+  8009e3:	eb c7                	jmp    8009ac <vprintfmt+0x35e>
+  8009e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f1:	eb ed                	jmp    8009e0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f9:	77 11                	ja     800a0c <vprintfmt+0x3be>
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a01:	83 c0 08             	add    $0x8,%eax
+  800a04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a07:	4c 8b 22             	mov    (%rdx),%r12
+  800a0a:	eb a0                	jmp    8009ac <vprintfmt+0x35e>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb ed                	jmp    800a07 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a26:	e9 65 ff ff ff       	jmp    800990 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a2b:	4c 89 ee             	mov    %r13,%rsi
+  800a2e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a33:	41 ff d6             	call   *%r14
+                i = -i;
+  800a36:	49 f7 dc             	neg    %r12
+  800a39:	e9 73 ff ff ff       	jmp    8009b1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3e:	40 84 f6             	test   %sil,%sil
+  800a41:	75 32                	jne    800a75 <vprintfmt+0x427>
+    switch (lflag) {
+  800a43:	85 d2                	test   %edx,%edx
+  800a45:	74 5d                	je     800aa4 <vprintfmt+0x456>
+  800a47:	83 fa 01             	cmp    $0x1,%edx
+  800a4a:	0f 84 82 00 00 00    	je     800ad2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	0f 87 a5 00 00 00    	ja     800b01 <vprintfmt+0x4b3>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a6b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a70:	e9 99 01 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a78:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7b:	77 19                	ja     800a96 <vprintfmt+0x448>
+  800a7d:	89 c2                	mov    %eax,%edx
+  800a7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a83:	83 c0 08             	add    $0x8,%eax
+  800a86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a89:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a8c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a91:	e9 78 01 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+  800a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	eb e5                	jmp    800a89 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	77 18                	ja     800ac4 <vprintfmt+0x476>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab2:	83 c0 08             	add    $0x8,%eax
+  800ab5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800aba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800abf:	e9 4a 01 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+  800ac4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad0:	eb e6                	jmp    800ab8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ad2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad8:	77 19                	ja     800af3 <vprintfmt+0x4a5>
+  800ada:	89 c2                	mov    %eax,%edx
+  800adc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae0:	83 c0 08             	add    $0x8,%eax
+  800ae3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800aee:	e9 1b 01 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+  800af3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aff:	eb e5                	jmp    800ae6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0d:	e9 56 ff ff ff       	jmp    800a68 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b12:	40 84 f6             	test   %sil,%sil
+  800b15:	75 2e                	jne    800b45 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b17:	85 d2                	test   %edx,%edx
+  800b19:	74 59                	je     800b74 <vprintfmt+0x526>
+  800b1b:	83 fa 01             	cmp    $0x1,%edx
+  800b1e:	74 7f                	je     800b9f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b23:	83 f8 2f             	cmp    $0x2f,%eax
+  800b26:	0f 87 9f 00 00 00    	ja     800bcb <vprintfmt+0x57d>
+  800b2c:	89 c2                	mov    %eax,%edx
+  800b2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b32:	83 c0 08             	add    $0x8,%eax
+  800b35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b3b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b40:	e9 c9 00 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b48:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4b:	77 19                	ja     800b66 <vprintfmt+0x518>
+  800b4d:	89 c2                	mov    %eax,%edx
+  800b4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b53:	83 c0 08             	add    $0x8,%eax
+  800b56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b5c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b61:	e9 a8 00 00 00       	jmp    800c0e <vprintfmt+0x5c0>
+  800b66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b72:	eb e5                	jmp    800b59 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b77:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7a:	77 15                	ja     800b91 <vprintfmt+0x543>
+  800b7c:	89 c2                	mov    %eax,%edx
+  800b7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b82:	83 c0 08             	add    $0x8,%eax
+  800b85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b88:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b8a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b8f:	eb 7d                	jmp    800c0e <vprintfmt+0x5c0>
+  800b91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9d:	eb e9                	jmp    800b88 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba5:	77 16                	ja     800bbd <vprintfmt+0x56f>
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bad:	83 c0 08             	add    $0x8,%eax
+  800bb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bbb:	eb 51                	jmp    800c0e <vprintfmt+0x5c0>
+  800bbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc9:	eb e8                	jmp    800bb3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	e9 5c ff ff ff       	jmp    800b38 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bdc:	4c 89 ee             	mov    %r13,%rsi
+  800bdf:	bf 30 00 00 00       	mov    $0x30,%edi
+  800be4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800be7:	4c 89 ee             	mov    %r13,%rsi
+  800bea:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bef:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf8:	77 47                	ja     800c41 <vprintfmt+0x5f3>
+  800bfa:	89 c2                	mov    %eax,%edx
+  800bfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c00:	83 c0 08             	add    $0x8,%eax
+  800c03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c09:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c0e:	48 83 ec 08          	sub    $0x8,%rsp
+  800c12:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c16:	0f 94 c0             	sete   %al
+  800c19:	0f b6 c0             	movzbl %al,%eax
+  800c1c:	50                   	push   %rax
+  800c1d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c22:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c26:	4c 89 ee             	mov    %r13,%rsi
+  800c29:	4c 89 f7             	mov    %r14,%rdi
+  800c2c:	48 b8 43 05 80 00 00 	movabs $0x800543,%rax
+  800c33:	00 00 00 
+  800c36:	ff d0                	call   *%rax
+            break;
+  800c38:	48 83 c4 10          	add    $0x10,%rsp
+  800c3c:	e9 3e fa ff ff       	jmp    80067f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4d:	eb b7                	jmp    800c06 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4f:	40 84 f6             	test   %sil,%sil
+  800c52:	75 2b                	jne    800c7f <vprintfmt+0x631>
+    switch (lflag) {
+  800c54:	85 d2                	test   %edx,%edx
+  800c56:	74 56                	je     800cae <vprintfmt+0x660>
+  800c58:	83 fa 01             	cmp    $0x1,%edx
+  800c5b:	74 7f                	je     800cdc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c60:	83 f8 2f             	cmp    $0x2f,%eax
+  800c63:	0f 87 a2 00 00 00    	ja     800d0b <vprintfmt+0x6bd>
+  800c69:	89 c2                	mov    %eax,%edx
+  800c6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6f:	83 c0 08             	add    $0x8,%eax
+  800c72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c75:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c78:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c7d:	eb 8f                	jmp    800c0e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c82:	83 f8 2f             	cmp    $0x2f,%eax
+  800c85:	77 19                	ja     800ca0 <vprintfmt+0x652>
+  800c87:	89 c2                	mov    %eax,%edx
+  800c89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8d:	83 c0 08             	add    $0x8,%eax
+  800c90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c93:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c96:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c9b:	e9 6e ff ff ff       	jmp    800c0e <vprintfmt+0x5c0>
+  800ca0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cac:	eb e5                	jmp    800c93 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb4:	77 18                	ja     800cce <vprintfmt+0x680>
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbc:	83 c0 08             	add    $0x8,%eax
+  800cbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cc4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cc9:	e9 40 ff ff ff       	jmp    800c0e <vprintfmt+0x5c0>
+  800cce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cda:	eb e6                	jmp    800cc2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce2:	77 19                	ja     800cfd <vprintfmt+0x6af>
+  800ce4:	89 c2                	mov    %eax,%edx
+  800ce6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cea:	83 c0 08             	add    $0x8,%eax
+  800ced:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cf8:	e9 11 ff ff ff       	jmp    800c0e <vprintfmt+0x5c0>
+  800cfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d09:	eb e5                	jmp    800cf0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d17:	e9 59 ff ff ff       	jmp    800c75 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d1c:	4c 89 ee             	mov    %r13,%rsi
+  800d1f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d24:	41 ff d6             	call   *%r14
+            break;
+  800d27:	e9 53 f9 ff ff       	jmp    80067f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d2c:	4c 89 ee             	mov    %r13,%rsi
+  800d2f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d34:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d37:	48 83 eb 01          	sub    $0x1,%rbx
+  800d3b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d3f:	75 f6                	jne    800d37 <vprintfmt+0x6e9>
+  800d41:	e9 39 f9 ff ff       	jmp    80067f <vprintfmt+0x31>
+}
+  800d46:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d4a:	5b                   	pop    %rbx
+  800d4b:	41 5c                	pop    %r12
+  800d4d:	41 5d                	pop    %r13
+  800d4f:	41 5e                	pop    %r14
+  800d51:	41 5f                	pop    %r15
+  800d53:	5d                   	pop    %rbp
+  800d54:	c3                   	ret
+
+0000000000800d55 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d55:	55                   	push   %rbp
+  800d56:	48 89 e5             	mov    %rsp,%rbp
+  800d59:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d61:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d6a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d71:	48 85 ff             	test   %rdi,%rdi
+  800d74:	74 2b                	je     800da1 <vsnprintf+0x4c>
+  800d76:	48 85 f6             	test   %rsi,%rsi
+  800d79:	74 26                	je     800da1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d7b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d7f:	48 bf f9 05 80 00 00 	movabs $0x8005f9,%rdi
+  800d86:	00 00 00 
+  800d89:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d99:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d9c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d9f:	c9                   	leave
+  800da0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800da1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800da6:	eb f7                	jmp    800d9f <vsnprintf+0x4a>
+
+0000000000800da8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800da8:	55                   	push   %rbp
+  800da9:	48 89 e5             	mov    %rsp,%rbp
+  800dac:	48 83 ec 50          	sub    $0x50,%rsp
+  800db0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800db4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800db8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dbc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dc3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dcb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dcf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dd3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dd7:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  800dde:	00 00 00 
+  800de1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+0000000000800de5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800de5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800de8:	74 10                	je     800dfa <strlen+0x15>
+    size_t n = 0;
+  800dea:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800def:	48 83 c0 01          	add    $0x1,%rax
+  800df3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800df7:	75 f6                	jne    800def <strlen+0xa>
+  800df9:	c3                   	ret
+    size_t n = 0;
+  800dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800dff:	c3                   	ret
+
+0000000000800e00 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e00:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e03:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e08:	48 85 f6             	test   %rsi,%rsi
+  800e0b:	74 11                	je     800e1e <strnlen+0x1e>
+  800e0d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e11:	74 0c                	je     800e1f <strnlen+0x1f>
+  800e13:	48 83 c2 01          	add    $0x1,%rdx
+  800e17:	48 39 d0             	cmp    %rdx,%rax
+  800e1a:	75 f1                	jne    800e0d <strnlen+0xd>
+  800e1c:	eb 04                	jmp    800e22 <strnlen+0x22>
+  800e1e:	c3                   	ret
+  800e1f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e22:	c3                   	ret
+
+0000000000800e23 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e23:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e2f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e32:	48 83 c2 01          	add    $0x1,%rdx
+  800e36:	84 c9                	test   %cl,%cl
+  800e38:	75 f1                	jne    800e2b <strcpy+0x8>
+        ;
+    return res;
+}
+  800e3a:	c3                   	ret
+
+0000000000800e3b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e3b:	55                   	push   %rbp
+  800e3c:	48 89 e5             	mov    %rsp,%rbp
+  800e3f:	41 54                	push   %r12
+  800e41:	53                   	push   %rbx
+  800e42:	48 89 fb             	mov    %rdi,%rbx
+  800e45:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e48:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800e4f:	00 00 00 
+  800e52:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e54:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e58:	4c 89 e6             	mov    %r12,%rsi
+  800e5b:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  800e62:	00 00 00 
+  800e65:	ff d0                	call   *%rax
+    return dst;
+}
+  800e67:	48 89 d8             	mov    %rbx,%rax
+  800e6a:	5b                   	pop    %rbx
+  800e6b:	41 5c                	pop    %r12
+  800e6d:	5d                   	pop    %rbp
+  800e6e:	c3                   	ret
+
+0000000000800e6f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e6f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e72:	48 85 d2             	test   %rdx,%rdx
+  800e75:	74 1f                	je     800e96 <strncpy+0x27>
+  800e77:	48 01 fa             	add    %rdi,%rdx
+  800e7a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e7d:	48 83 c1 01          	add    $0x1,%rcx
+  800e81:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e85:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e89:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e8d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e91:	48 39 ca             	cmp    %rcx,%rdx
+  800e94:	75 e7                	jne    800e7d <strncpy+0xe>
+    }
+    return ret;
+}
+  800e96:	c3                   	ret
+
+0000000000800e97 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e97:	48 89 f8             	mov    %rdi,%rax
+  800e9a:	48 85 d2             	test   %rdx,%rdx
+  800e9d:	74 24                	je     800ec3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e9f:	48 83 ea 01          	sub    $0x1,%rdx
+  800ea3:	74 1b                	je     800ec0 <strlcpy+0x29>
+  800ea5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ea9:	0f b6 16             	movzbl (%rsi),%edx
+  800eac:	84 d2                	test   %dl,%dl
+  800eae:	74 10                	je     800ec0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800eb0:	48 83 c6 01          	add    $0x1,%rsi
+  800eb4:	48 83 c0 01          	add    $0x1,%rax
+  800eb8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ebb:	48 39 c8             	cmp    %rcx,%rax
+  800ebe:	75 e9                	jne    800ea9 <strlcpy+0x12>
+        *dst = '\0';
+  800ec0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ec3:	48 29 f8             	sub    %rdi,%rax
+}
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ec7:	0f b6 07             	movzbl (%rdi),%eax
+  800eca:	84 c0                	test   %al,%al
+  800ecc:	74 13                	je     800ee1 <strcmp+0x1a>
+  800ece:	38 06                	cmp    %al,(%rsi)
+  800ed0:	75 0f                	jne    800ee1 <strcmp+0x1a>
+  800ed2:	48 83 c7 01          	add    $0x1,%rdi
+  800ed6:	48 83 c6 01          	add    $0x1,%rsi
+  800eda:	0f b6 07             	movzbl (%rdi),%eax
+  800edd:	84 c0                	test   %al,%al
+  800edf:	75 ed                	jne    800ece <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ee1:	0f b6 c0             	movzbl %al,%eax
+  800ee4:	0f b6 16             	movzbl (%rsi),%edx
+  800ee7:	29 d0                	sub    %edx,%eax
+}
+  800ee9:	c3                   	ret
+
+0000000000800eea <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800eea:	48 85 d2             	test   %rdx,%rdx
+  800eed:	74 1f                	je     800f0e <strncmp+0x24>
+  800eef:	0f b6 07             	movzbl (%rdi),%eax
+  800ef2:	84 c0                	test   %al,%al
+  800ef4:	74 1e                	je     800f14 <strncmp+0x2a>
+  800ef6:	3a 06                	cmp    (%rsi),%al
+  800ef8:	75 1a                	jne    800f14 <strncmp+0x2a>
+  800efa:	48 83 c7 01          	add    $0x1,%rdi
+  800efe:	48 83 c6 01          	add    $0x1,%rsi
+  800f02:	48 83 ea 01          	sub    $0x1,%rdx
+  800f06:	75 e7                	jne    800eef <strncmp+0x5>
+
+    if (!n) return 0;
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0d:	c3                   	ret
+  800f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f13:	c3                   	ret
+  800f14:	48 85 d2             	test   %rdx,%rdx
+  800f17:	74 09                	je     800f22 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f19:	0f b6 07             	movzbl (%rdi),%eax
+  800f1c:	0f b6 16             	movzbl (%rsi),%edx
+  800f1f:	29 d0                	sub    %edx,%eax
+  800f21:	c3                   	ret
+    if (!n) return 0;
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f27:	c3                   	ret
+
+0000000000800f28 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f28:	0f b6 17             	movzbl (%rdi),%edx
+  800f2b:	84 d2                	test   %dl,%dl
+  800f2d:	74 18                	je     800f47 <strchr+0x1f>
+        if (*str == c) {
+  800f2f:	0f be d2             	movsbl %dl,%edx
+  800f32:	39 f2                	cmp    %esi,%edx
+  800f34:	74 17                	je     800f4d <strchr+0x25>
+    for (; *str; str++) {
+  800f36:	48 83 c7 01          	add    $0x1,%rdi
+  800f3a:	0f b6 17             	movzbl (%rdi),%edx
+  800f3d:	84 d2                	test   %dl,%dl
+  800f3f:	75 ee                	jne    800f2f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f46:	c3                   	ret
+  800f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4c:	c3                   	ret
+  800f4d:	48 89 f8             	mov    %rdi,%rax
+}
+  800f50:	c3                   	ret
+
+0000000000800f51 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f51:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f54:	0f b6 17             	movzbl (%rdi),%edx
+  800f57:	84 d2                	test   %dl,%dl
+  800f59:	74 13                	je     800f6e <strfind+0x1d>
+  800f5b:	0f be d2             	movsbl %dl,%edx
+  800f5e:	39 f2                	cmp    %esi,%edx
+  800f60:	74 0b                	je     800f6d <strfind+0x1c>
+  800f62:	48 83 c0 01          	add    $0x1,%rax
+  800f66:	0f b6 10             	movzbl (%rax),%edx
+  800f69:	84 d2                	test   %dl,%dl
+  800f6b:	75 ee                	jne    800f5b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f6d:	c3                   	ret
+  800f6e:	c3                   	ret
+
+0000000000800f6f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f6f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f72:	48 89 f8             	mov    %rdi,%rax
+  800f75:	48 f7 d8             	neg    %rax
+  800f78:	83 e0 07             	and    $0x7,%eax
+  800f7b:	49 89 d1             	mov    %rdx,%r9
+  800f7e:	49 29 c1             	sub    %rax,%r9
+  800f81:	78 36                	js     800fb9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f83:	40 0f b6 c6          	movzbl %sil,%eax
+  800f87:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f8e:	01 01 01 
+  800f91:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f95:	40 f6 c7 07          	test   $0x7,%dil
+  800f99:	75 38                	jne    800fd3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f9b:	4c 89 c9             	mov    %r9,%rcx
+  800f9e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fa2:	74 0c                	je     800fb0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fa4:	fc                   	cld
+  800fa5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fa8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fac:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fb0:	4d 85 c9             	test   %r9,%r9
+  800fb3:	75 45                	jne    800ffa <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fb5:	4c 89 c0             	mov    %r8,%rax
+  800fb8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fb9:	48 85 d2             	test   %rdx,%rdx
+  800fbc:	74 f7                	je     800fb5 <memset+0x46>
+  800fbe:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fc1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fc4:	48 83 c0 01          	add    $0x1,%rax
+  800fc8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fcc:	48 39 c2             	cmp    %rax,%rdx
+  800fcf:	75 f3                	jne    800fc4 <memset+0x55>
+  800fd1:	eb e2                	jmp    800fb5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fd3:	40 f6 c7 01          	test   $0x1,%dil
+  800fd7:	74 06                	je     800fdf <memset+0x70>
+  800fd9:	88 07                	mov    %al,(%rdi)
+  800fdb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fdf:	40 f6 c7 02          	test   $0x2,%dil
+  800fe3:	74 07                	je     800fec <memset+0x7d>
+  800fe5:	66 89 07             	mov    %ax,(%rdi)
+  800fe8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fec:	40 f6 c7 04          	test   $0x4,%dil
+  800ff0:	74 a9                	je     800f9b <memset+0x2c>
+  800ff2:	89 07                	mov    %eax,(%rdi)
+  800ff4:	48 83 c7 04          	add    $0x4,%rdi
+  800ff8:	eb a1                	jmp    800f9b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffa:	41 f6 c1 04          	test   $0x4,%r9b
+  800ffe:	74 06                	je     801006 <memset+0x97>
+  801000:	89 07                	mov    %eax,(%rdi)
+  801002:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801006:	41 f6 c1 02          	test   $0x2,%r9b
+  80100a:	74 07                	je     801013 <memset+0xa4>
+  80100c:	66 89 07             	mov    %ax,(%rdi)
+  80100f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801013:	41 f6 c1 01          	test   $0x1,%r9b
+  801017:	74 9c                	je     800fb5 <memset+0x46>
+  801019:	88 07                	mov    %al,(%rdi)
+  80101b:	eb 98                	jmp    800fb5 <memset+0x46>
+
+000000000080101d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80101d:	48 89 f8             	mov    %rdi,%rax
+  801020:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801023:	48 39 fe             	cmp    %rdi,%rsi
+  801026:	73 3b                	jae    801063 <memmove+0x46>
+  801028:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80102c:	48 39 d7             	cmp    %rdx,%rdi
+  80102f:	73 32                	jae    801063 <memmove+0x46>
+        s += n;
+        d += n;
+  801031:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801035:	48 89 d6             	mov    %rdx,%rsi
+  801038:	48 09 fe             	or     %rdi,%rsi
+  80103b:	48 09 ce             	or     %rcx,%rsi
+  80103e:	40 f6 c6 07          	test   $0x7,%sil
+  801042:	75 12                	jne    801056 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801044:	48 83 ef 08          	sub    $0x8,%rdi
+  801048:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80104c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801050:	fd                   	std
+  801051:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801054:	fc                   	cld
+  801055:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801056:	48 83 ef 01          	sub    $0x1,%rdi
+  80105a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80105e:	fd                   	std
+  80105f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801061:	eb f1                	jmp    801054 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801063:	48 89 f2             	mov    %rsi,%rdx
+  801066:	48 09 c2             	or     %rax,%rdx
+  801069:	48 09 ca             	or     %rcx,%rdx
+  80106c:	f6 c2 07             	test   $0x7,%dl
+  80106f:	75 0c                	jne    80107d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801071:	48 c1 e9 03          	shr    $0x3,%rcx
+  801075:	48 89 c7             	mov    %rax,%rdi
+  801078:	fc                   	cld
+  801079:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80107c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80107d:	48 89 c7             	mov    %rax,%rdi
+  801080:	fc                   	cld
+  801081:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801083:	c3                   	ret
+
+0000000000801084 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801084:	55                   	push   %rbp
+  801085:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801088:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  80108f:	00 00 00 
+  801092:	ff d0                	call   *%rax
+}
+  801094:	5d                   	pop    %rbp
+  801095:	c3                   	ret
+
+0000000000801096 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801096:	55                   	push   %rbp
+  801097:	48 89 e5             	mov    %rsp,%rbp
+  80109a:	41 57                	push   %r15
+  80109c:	41 56                	push   %r14
+  80109e:	41 55                	push   %r13
+  8010a0:	41 54                	push   %r12
+  8010a2:	53                   	push   %rbx
+  8010a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a7:	49 89 fe             	mov    %rdi,%r14
+  8010aa:	49 89 f7             	mov    %rsi,%r15
+  8010ad:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010b0:	48 89 f7             	mov    %rsi,%rdi
+  8010b3:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8010ba:	00 00 00 
+  8010bd:	ff d0                	call   *%rax
+  8010bf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010c2:	48 89 de             	mov    %rbx,%rsi
+  8010c5:	4c 89 f7             	mov    %r14,%rdi
+  8010c8:	48 b8 00 0e 80 00 00 	movabs $0x800e00,%rax
+  8010cf:	00 00 00 
+  8010d2:	ff d0                	call   *%rax
+  8010d4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010d7:	48 39 c3             	cmp    %rax,%rbx
+  8010da:	74 36                	je     801112 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010dc:	48 89 d8             	mov    %rbx,%rax
+  8010df:	4c 29 e8             	sub    %r13,%rax
+  8010e2:	49 39 c4             	cmp    %rax,%r12
+  8010e5:	73 31                	jae    801118 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010e7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010ec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f0:	4c 89 fe             	mov    %r15,%rsi
+  8010f3:	48 b8 84 10 80 00 00 	movabs $0x801084,%rax
+  8010fa:	00 00 00 
+  8010fd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010ff:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801103:	48 83 c4 08          	add    $0x8,%rsp
+  801107:	5b                   	pop    %rbx
+  801108:	41 5c                	pop    %r12
+  80110a:	41 5d                	pop    %r13
+  80110c:	41 5e                	pop    %r14
+  80110e:	41 5f                	pop    %r15
+  801110:	5d                   	pop    %rbp
+  801111:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801112:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801116:	eb eb                	jmp    801103 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801118:	48 83 eb 01          	sub    $0x1,%rbx
+  80111c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801120:	48 89 da             	mov    %rbx,%rdx
+  801123:	4c 89 fe             	mov    %r15,%rsi
+  801126:	48 b8 84 10 80 00 00 	movabs $0x801084,%rax
+  80112d:	00 00 00 
+  801130:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801132:	49 01 de             	add    %rbx,%r14
+  801135:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80113a:	eb c3                	jmp    8010ff <strlcat+0x69>
+
+000000000080113c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80113c:	48 85 d2             	test   %rdx,%rdx
+  80113f:	74 2d                	je     80116e <memcmp+0x32>
+  801141:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801146:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80114a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80114f:	44 38 c1             	cmp    %r8b,%cl
+  801152:	75 0f                	jne    801163 <memcmp+0x27>
+    while (n-- > 0) {
+  801154:	48 83 c0 01          	add    $0x1,%rax
+  801158:	48 39 c2             	cmp    %rax,%rdx
+  80115b:	75 e9                	jne    801146 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801162:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801163:	0f b6 c1             	movzbl %cl,%eax
+  801166:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80116a:	44 29 c0             	sub    %r8d,%eax
+  80116d:	c3                   	ret
+    return 0;
+  80116e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801173:	c3                   	ret
+
+0000000000801174 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801174:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801178:	48 39 c7             	cmp    %rax,%rdi
+  80117b:	73 0f                	jae    80118c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80117d:	40 38 37             	cmp    %sil,(%rdi)
+  801180:	74 0e                	je     801190 <memfind+0x1c>
+    for (; src < end; src++) {
+  801182:	48 83 c7 01          	add    $0x1,%rdi
+  801186:	48 39 f8             	cmp    %rdi,%rax
+  801189:	75 f2                	jne    80117d <memfind+0x9>
+  80118b:	c3                   	ret
+  80118c:	48 89 f8             	mov    %rdi,%rax
+  80118f:	c3                   	ret
+  801190:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801193:	c3                   	ret
+
+0000000000801194 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801194:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801197:	0f b6 37             	movzbl (%rdi),%esi
+  80119a:	40 80 fe 20          	cmp    $0x20,%sil
+  80119e:	74 06                	je     8011a6 <strtol+0x12>
+  8011a0:	40 80 fe 09          	cmp    $0x9,%sil
+  8011a4:	75 13                	jne    8011b9 <strtol+0x25>
+  8011a6:	48 83 c7 01          	add    $0x1,%rdi
+  8011aa:	0f b6 37             	movzbl (%rdi),%esi
+  8011ad:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b1:	74 f3                	je     8011a6 <strtol+0x12>
+  8011b3:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b7:	74 ed                	je     8011a6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011b9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011bc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011bf:	3c 01                	cmp    $0x1,%al
+  8011c1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011c5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011cb:	75 0f                	jne    8011dc <strtol+0x48>
+  8011cd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011d0:	74 14                	je     8011e6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011d2:	85 d2                	test   %edx,%edx
+  8011d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011dc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011e1:	4c 63 ca             	movslq %edx,%r9
+  8011e4:	eb 36                	jmp    80121c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011e6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011ea:	74 0f                	je     8011fb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011ec:	85 d2                	test   %edx,%edx
+  8011ee:	75 ec                	jne    8011dc <strtol+0x48>
+        s++;
+  8011f0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011f4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011f9:	eb e1                	jmp    8011dc <strtol+0x48>
+        s += 2;
+  8011fb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011ff:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801204:	eb d6                	jmp    8011dc <strtol+0x48>
+            dig -= '0';
+  801206:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801209:	44 0f b6 c1          	movzbl %cl,%r8d
+  80120d:	41 39 d0             	cmp    %edx,%r8d
+  801210:	7d 21                	jge    801233 <strtol+0x9f>
+        val = val * base + dig;
+  801212:	49 0f af c1          	imul   %r9,%rax
+  801216:	0f b6 c9             	movzbl %cl,%ecx
+  801219:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80121c:	48 83 c7 01          	add    $0x1,%rdi
+  801220:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801224:	80 f9 39             	cmp    $0x39,%cl
+  801227:	76 dd                	jbe    801206 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801229:	80 f9 7b             	cmp    $0x7b,%cl
+  80122c:	77 05                	ja     801233 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80122e:	83 e9 57             	sub    $0x57,%ecx
+  801231:	eb d6                	jmp    801209 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801233:	4d 85 d2             	test   %r10,%r10
+  801236:	74 03                	je     80123b <strtol+0xa7>
+  801238:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80123b:	48 89 c2             	mov    %rax,%rdx
+  80123e:	48 f7 da             	neg    %rdx
+  801241:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801245:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801249:	c3                   	ret
+
+000000000080124a <strrev>:
+
+void
+strrev(char *str)
+{
+  80124a:	55                   	push   %rbp
+  80124b:	48 89 e5             	mov    %rsp,%rbp
+  80124e:	53                   	push   %rbx
+  80124f:	48 83 ec 08          	sub    $0x8,%rsp
+  801253:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801256:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  80125d:	00 00 00 
+  801260:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801262:	83 e8 01             	sub    $0x1,%eax
+  801265:	85 c0                	test   %eax,%eax
+  801267:	7e 22                	jle    80128b <strrev+0x41>
+  801269:	48 98                	cltq
+  80126b:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801270:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801274:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801278:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80127c:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80127f:	48 83 c2 01          	add    $0x1,%rdx
+  801283:	48 83 e8 01          	sub    $0x1,%rax
+  801287:	39 c2                	cmp    %eax,%edx
+  801289:	7c e5                	jl     801270 <strrev+0x26>
+	}
+}
+  80128b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+
+0000000000801291 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801291:	85 d2                	test   %edx,%edx
+  801293:	0f 84 80 00 00 00    	je     801319 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801299:	55                   	push   %rbp
+  80129a:	48 89 e5             	mov    %rsp,%rbp
+  80129d:	53                   	push   %rbx
+  80129e:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a2:	49 89 f2             	mov    %rsi,%r10
+  8012a5:	41 89 d3             	mov    %edx,%r11d
+  8012a8:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8012ab:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8012b0:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8012b3:	eb 20                	jmp    8012d5 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8012b5:	41 89 f1             	mov    %esi,%r9d
+  8012b8:	83 c2 30             	add    $0x30,%edx
+  8012bb:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8012be:	89 f8                	mov    %edi,%eax
+  8012c0:	99                   	cltd
+  8012c1:	f7 f9                	idiv   %ecx
+  8012c3:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	74 2e                	je     8012f7 <itoa+0x66>
+  8012c9:	83 c6 01             	add    $0x1,%esi
+  8012cc:	49 83 c0 01          	add    $0x1,%r8
+  8012d0:	44 39 cb             	cmp    %r9d,%ebx
+  8012d3:	7e 15                	jle    8012ea <itoa+0x59>
+		digit = sum % base;
+  8012d5:	89 f8                	mov    %edi,%eax
+  8012d7:	99                   	cltd
+  8012d8:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8012da:	83 fa 09             	cmp    $0x9,%edx
+  8012dd:	7e d6                	jle    8012b5 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8012df:	41 89 f1             	mov    %esi,%r9d
+  8012e2:	83 c2 37             	add    $0x37,%edx
+  8012e5:	41 88 10             	mov    %dl,(%r8)
+  8012e8:	eb d4                	jmp    8012be <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8012ea:	41 83 eb 01          	sub    $0x1,%r11d
+  8012ee:	45 39 cb             	cmp    %r9d,%r11d
+  8012f1:	75 04                	jne    8012f7 <itoa+0x66>
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	75 28                	jne    80131f <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8012f7:	4d 63 c9             	movslq %r9d,%r9
+  8012fa:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  8012ff:	4c 89 d7             	mov    %r10,%rdi
+  801302:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  801309:	00 00 00 
+  80130c:	ff d0                	call   *%rax
+	return 0;
+  80130e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801313:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+		return -1;
+  801319:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80131e:	c3                   	ret
+		return -1;
+  80131f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801324:	eb ed                	jmp    801313 <itoa+0x82>
+
+0000000000801326 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+  80132a:	53                   	push   %rbx
+  80132b:	48 89 fa             	mov    %rdi,%rdx
+  80132e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801331:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801340:	be 00 00 00 00       	mov    $0x0,%esi
+  801345:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80134d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+
+0000000000801353 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+  801357:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801358:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801362:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801371:	be 00 00 00 00       	mov    $0x0,%esi
+  801376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+
+0000000000801384 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	53                   	push   %rbx
+  801389:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80138d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801390:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801395:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b1:	48 85 c0             	test   %rax,%rax
+  8013b4:	7f 06                	jg     8013bc <sys_env_destroy+0x38>
+}
+  8013b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ba:	c9                   	leave
+  8013bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bc:	49 89 c0             	mov    %rax,%r8
+  8013bf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013c4:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  8013cb:	00 00 00 
+  8013ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d3:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  8013da:	00 00 00 
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  8013e9:	00 00 00 
+  8013ec:	41 ff d1             	call   *%r9
+
+00000000008013ef <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013ef:	55                   	push   %rbp
+  8013f0:	48 89 e5             	mov    %rsp,%rbp
+  8013f3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801408:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140d:	be 00 00 00 00       	mov    $0x0,%esi
+  801412:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801418:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80141a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+
+0000000000801420 <sys_yield>:
+
+void
+sys_yield(void) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+  801424:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+
+0000000000801451 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+  801455:	53                   	push   %rbx
+  801456:	48 89 fa             	mov    %rdi,%rdx
+  801459:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80145c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801461:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801468:	00 00 00 
+  80146b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801470:	be 00 00 00 00       	mov    $0x0,%esi
+  801475:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80147d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801481:	c9                   	leave
+  801482:	c3                   	ret
+
+0000000000801483 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801483:	55                   	push   %rbp
+  801484:	48 89 e5             	mov    %rsp,%rbp
+  801487:	53                   	push   %rbx
+  801488:	49 89 f8             	mov    %rdi,%r8
+  80148b:	48 89 d3             	mov    %rdx,%rbx
+  80148e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801491:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801496:	4c 89 c2             	mov    %r8,%rdx
+  801499:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149c:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+
+00000000008014af <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014af:	55                   	push   %rbp
+  8014b0:	48 89 e5             	mov    %rsp,%rbp
+  8014b3:	53                   	push   %rbx
+  8014b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b8:	89 f8                	mov    %edi,%eax
+  8014ba:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014bd:	48 63 f9             	movslq %ecx,%rdi
+  8014c0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d8:	48 85 c0             	test   %rax,%rax
+  8014db:	7f 06                	jg     8014e3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e3:	49 89 c0             	mov    %rax,%r8
+  8014e6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014eb:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fa:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  801510:	00 00 00 
+  801513:	41 ff d1             	call   *%r9
+
+0000000000801516 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 83 ec 08          	sub    $0x8,%rsp
+  80151f:	89 f8                	mov    %edi,%eax
+  801521:	49 89 f2             	mov    %rsi,%r10
+  801524:	48 89 cf             	mov    %rcx,%rdi
+  801527:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80152a:	48 63 da             	movslq %edx,%rbx
+  80152d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801530:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801535:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801538:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153d:	48 85 c0             	test   %rax,%rax
+  801540:	7f 06                	jg     801548 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801546:	c9                   	leave
+  801547:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801548:	49 89 c0             	mov    %rax,%r8
+  80154b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801550:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  801557:	00 00 00 
+  80155a:	be 26 00 00 00       	mov    $0x26,%esi
+  80155f:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  801566:	00 00 00 
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  801575:	00 00 00 
+  801578:	41 ff d1             	call   *%r9
+
+000000000080157b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	53                   	push   %rbx
+  801580:	48 83 ec 08          	sub    $0x8,%rsp
+  801584:	48 89 f1             	mov    %rsi,%rcx
+  801587:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80158a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801592:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801597:	be 00 00 00 00       	mov    $0x0,%esi
+  80159c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a4:	48 85 c0             	test   %rax,%rax
+  8015a7:	7f 06                	jg     8015af <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015af:	49 89 c0             	mov    %rax,%r8
+  8015b2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b7:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  8015be:	00 00 00 
+  8015c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c6:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  8015cd:	00 00 00 
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d5:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  8015dc:	00 00 00 
+  8015df:	41 ff d1             	call   *%r9
+
+00000000008015e2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+  8015e6:	53                   	push   %rbx
+  8015e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015eb:	48 63 ce             	movslq %esi,%rcx
+  8015ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801600:	be 00 00 00 00       	mov    $0x0,%esi
+  801605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160d:	48 85 c0             	test   %rax,%rax
+  801610:	7f 06                	jg     801618 <sys_env_set_status+0x36>
+}
+  801612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801618:	49 89 c0             	mov    %rax,%r8
+  80161b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801620:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  801627:	00 00 00 
+  80162a:	be 26 00 00 00       	mov    $0x26,%esi
+  80162f:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  801636:	00 00 00 
+  801639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163e:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  801645:	00 00 00 
+  801648:	41 ff d1             	call   *%r9
+
+000000000080164b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	53                   	push   %rbx
+  801650:	48 83 ec 08          	sub    $0x8,%rsp
+  801654:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801657:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801669:	be 00 00 00 00       	mov    $0x0,%esi
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801676:	48 85 c0             	test   %rax,%rax
+  801679:	7f 06                	jg     801681 <sys_env_set_trapframe+0x36>
+}
+  80167b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801681:	49 89 c0             	mov    %rax,%r8
+  801684:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801689:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  801690:	00 00 00 
+  801693:	be 26 00 00 00       	mov    $0x26,%esi
+  801698:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  80169f:	00 00 00 
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a7:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  8016ae:	00 00 00 
+  8016b1:	41 ff d1             	call   *%r9
+
+00000000008016b4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016df:	48 85 c0             	test   %rax,%rax
+  8016e2:	7f 06                	jg     8016ea <sys_env_set_pgfault_upcall+0x36>
+}
+  8016e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ea:	49 89 c0             	mov    %rax,%r8
+  8016ed:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016f2:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  8016f9:	00 00 00 
+  8016fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801701:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  801708:	00 00 00 
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  801717:	00 00 00 
+  80171a:	41 ff d1             	call   *%r9
+
+000000000080171d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+  801721:	53                   	push   %rbx
+  801722:	89 f8                	mov    %edi,%eax
+  801724:	49 89 f1             	mov    %rsi,%r9
+  801727:	48 89 d3             	mov    %rdx,%rbx
+  80172a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80172d:	49 63 f0             	movslq %r8d,%rsi
+  801730:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801733:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801738:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801741:	cd 30                	int    $0x30
+}
+  801743:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+0000000000801749 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+  80174d:	53                   	push   %rbx
+  80174e:	48 83 ec 08          	sub    $0x8,%rsp
+  801752:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801755:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801758:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175d:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801760:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801765:	be 00 00 00 00       	mov    $0x0,%esi
+  80176a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801770:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801772:	48 85 c0             	test   %rax,%rax
+  801775:	7f 06                	jg     80177d <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177d:	49 89 c0             	mov    %rax,%r8
+  801780:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801785:	48 ba 68 40 80 00 00 	movabs $0x804068,%rdx
+  80178c:	00 00 00 
+  80178f:	be 26 00 00 00       	mov    $0x26,%esi
+  801794:	48 bf 87 40 80 00 00 	movabs $0x804087,%rdi
+  80179b:	00 00 00 
+  80179e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a3:	49 b9 ae 03 80 00 00 	movabs $0x8003ae,%r9
+  8017aa:	00 00 00 
+  8017ad:	41 ff d1             	call   *%r9
+
+00000000008017b0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8017b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b9:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+}
+  8017c5:	5d                   	pop    %rbp
+  8017c6:	c3                   	ret
+
+00000000008017c7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+00000000008017f8 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+  8017fc:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8017fd:	48 63 ce             	movslq %esi,%rcx
+  801800:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801804:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801809:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801813:	be 00 00 00 00       	mov    $0x0,%esi
+  801818:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181e:	cd 30                	int    $0x30
+}
+  801820:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+0000000000801826 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801826:	55                   	push   %rbp
+  801827:	48 89 e5             	mov    %rsp,%rbp
+  80182a:	53                   	push   %rbx
+  80182b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  80182e:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801832:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801837:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801841:	be 00 00 00 00       	mov    $0x0,%esi
+  801846:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184c:	cd 30                	int    $0x30
+}
+  80184e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801852:	c9                   	leave
+  801853:	c3                   	ret
+
+0000000000801854 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801854:	55                   	push   %rbp
+  801855:	48 89 e5             	mov    %rsp,%rbp
+  801858:	53                   	push   %rbx
+  801859:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80185c:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80185f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801864:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801867:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186c:	be 00 00 00 00       	mov    $0x0,%esi
+  801871:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801877:	cd 30                	int    $0x30
+}
+  801879:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187d:	c9                   	leave
+  80187e:	c3                   	ret
+
+000000000080187f <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80187f:	55                   	push   %rbp
+  801880:	48 89 e5             	mov    %rsp,%rbp
+  801883:	41 54                	push   %r12
+  801885:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801886:	b8 08 00 00 00       	mov    $0x8,%eax
+  80188b:	cd 30                	int    $0x30
+  80188d:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 7e                	js     801912 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801894:	0f 84 80 00 00 00    	je     80191a <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80189a:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018a0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018a7:	00 00 00 
+  8018aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018af:	89 c2                	mov    %eax,%edx
+  8018b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018bb:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8018c2:	00 00 00 
+  8018c5:	ff d0                	call   *%rax
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	0f 88 81 00 00 00    	js     801950 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8018cf:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8018d6:	00 00 00 
+  8018d9:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  8018e0:	44 89 e7             	mov    %r12d,%edi
+  8018e3:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  8018ea:	00 00 00 
+  8018ed:	ff d0                	call   *%rax
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 65                	js     801958 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8018f3:	be 02 00 00 00       	mov    $0x2,%esi
+  8018f8:	44 89 e7             	mov    %r12d,%edi
+  8018fb:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+        return -1;
+  801907:	85 c0                	test   %eax,%eax
+  801909:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80190e:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801912:	44 89 e0             	mov    %r12d,%eax
+  801915:	5b                   	pop    %rbx
+  801916:	41 5c                	pop    %r12
+  801918:	5d                   	pop    %rbp
+  801919:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80191a:	48 b8 ef 13 80 00 00 	movabs $0x8013ef,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+  801926:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80192b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80192f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801933:	48 c1 e0 04          	shl    $0x4,%rax
+  801937:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80193e:	00 00 00 
+  801941:	48 01 d0             	add    %rdx,%rax
+  801944:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80194b:	00 00 00 
+        return 0;
+  80194e:	eb c2                	jmp    801912 <fork+0x93>
+        return -1;
+  801950:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801956:	eb ba                	jmp    801912 <fork+0x93>
+        return -1;
+  801958:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80195e:	eb b2                	jmp    801912 <fork+0x93>
+
+0000000000801960 <sfork>:
+
+envid_t
+sfork() {
+  801960:	55                   	push   %rbp
+  801961:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801964:	48 ba 95 40 80 00 00 	movabs $0x804095,%rdx
+  80196b:	00 00 00 
+  80196e:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801973:	48 bf b0 40 80 00 00 	movabs $0x8040b0,%rdi
+  80197a:	00 00 00 
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	48 b9 ae 03 80 00 00 	movabs $0x8003ae,%rcx
+  801989:	00 00 00 
+  80198c:	ff d1                	call   *%rcx
+
+000000000080198e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801995:	ff ff ff 
+  801998:	48 01 f8             	add    %rdi,%rax
+  80199b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80199f:	c3                   	ret
+
+00000000008019a0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019a7:	ff ff ff 
+  8019aa:	48 01 f8             	add    %rdi,%rax
+  8019ad:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019b1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019b7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019bb:	c3                   	ret
+
+00000000008019bc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	41 57                	push   %r15
+  8019c2:	41 56                	push   %r14
+  8019c4:	41 55                	push   %r13
+  8019c6:	41 54                	push   %r12
+  8019c8:	53                   	push   %rbx
+  8019c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019cd:	49 89 ff             	mov    %rdi,%r15
+  8019d0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019d5:	49 bd db 34 80 00 00 	movabs $0x8034db,%r13
+  8019dc:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019df:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019e5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019e8:	48 89 df             	mov    %rbx,%rdi
+  8019eb:	41 ff d5             	call   *%r13
+  8019ee:	83 e0 04             	and    $0x4,%eax
+  8019f1:	74 17                	je     801a0a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019f3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019fa:	4c 39 f3             	cmp    %r14,%rbx
+  8019fd:	75 e6                	jne    8019e5 <fd_alloc+0x29>
+  8019ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a05:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a0a:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a0d:	48 83 c4 08          	add    $0x8,%rsp
+  801a11:	5b                   	pop    %rbx
+  801a12:	41 5c                	pop    %r12
+  801a14:	41 5d                	pop    %r13
+  801a16:	41 5e                	pop    %r14
+  801a18:	41 5f                	pop    %r15
+  801a1a:	5d                   	pop    %rbp
+  801a1b:	c3                   	ret
+
+0000000000801a1c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a1c:	83 ff 1f             	cmp    $0x1f,%edi
+  801a1f:	77 39                	ja     801a5a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a21:	55                   	push   %rbp
+  801a22:	48 89 e5             	mov    %rsp,%rbp
+  801a25:	41 54                	push   %r12
+  801a27:	53                   	push   %rbx
+  801a28:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a2b:	48 63 df             	movslq %edi,%rbx
+  801a2e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a35:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a39:	48 89 df             	mov    %rbx,%rdi
+  801a3c:	48 b8 db 34 80 00 00 	movabs $0x8034db,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+  801a48:	a8 04                	test   $0x4,%al
+  801a4a:	74 14                	je     801a60 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a4c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a55:	5b                   	pop    %rbx
+  801a56:	41 5c                	pop    %r12
+  801a58:	5d                   	pop    %rbp
+  801a59:	c3                   	ret
+        return -E_INVAL;
+  801a5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a5f:	c3                   	ret
+        return -E_INVAL;
+  801a60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a65:	eb ee                	jmp    801a55 <fd_lookup+0x39>
+
+0000000000801a67 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	41 54                	push   %r12
+  801a6d:	53                   	push   %rbx
+  801a6e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a71:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  801a78:	00 00 00 
+  801a7b:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a82:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a85:	39 3b                	cmp    %edi,(%rbx)
+  801a87:	74 47                	je     801ad0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a89:	48 83 c0 08          	add    $0x8,%rax
+  801a8d:	48 8b 18             	mov    (%rax),%rbx
+  801a90:	48 85 db             	test   %rbx,%rbx
+  801a93:	75 f0                	jne    801a85 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a95:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a9c:	00 00 00 
+  801a9f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801aa5:	89 fa                	mov    %edi,%edx
+  801aa7:	48 bf c0 40 80 00 00 	movabs $0x8040c0,%rdi
+  801aae:	00 00 00 
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab6:	48 b9 fe 04 80 00 00 	movabs $0x8004fe,%rcx
+  801abd:	00 00 00 
+  801ac0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ac2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ac7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801acb:	5b                   	pop    %rbx
+  801acc:	41 5c                	pop    %r12
+  801ace:	5d                   	pop    %rbp
+  801acf:	c3                   	ret
+            return 0;
+  801ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad5:	eb f0                	jmp    801ac7 <dev_lookup+0x60>
+
+0000000000801ad7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ad7:	55                   	push   %rbp
+  801ad8:	48 89 e5             	mov    %rsp,%rbp
+  801adb:	41 55                	push   %r13
+  801add:	41 54                	push   %r12
+  801adf:	53                   	push   %rbx
+  801ae0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ae4:	48 89 fb             	mov    %rdi,%rbx
+  801ae7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aea:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801af1:	ff ff ff 
+  801af4:	48 01 df             	add    %rbx,%rdi
+  801af7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801afb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aff:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+  801b0b:	41 89 c5             	mov    %eax,%r13d
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 06                	js     801b18 <fd_close+0x41>
+  801b12:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b16:	74 1a                	je     801b32 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b18:	45 84 e4             	test   %r12b,%r12b
+  801b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b20:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b24:	44 89 e8             	mov    %r13d,%eax
+  801b27:	48 83 c4 18          	add    $0x18,%rsp
+  801b2b:	5b                   	pop    %rbx
+  801b2c:	41 5c                	pop    %r12
+  801b2e:	41 5d                	pop    %r13
+  801b30:	5d                   	pop    %rbp
+  801b31:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b32:	8b 3b                	mov    (%rbx),%edi
+  801b34:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b38:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	41 89 c5             	mov    %eax,%r13d
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	78 1b                	js     801b66 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b4f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b53:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b59:	48 85 c0             	test   %rax,%rax
+  801b5c:	74 08                	je     801b66 <fd_close+0x8f>
+  801b5e:	48 89 df             	mov    %rbx,%rdi
+  801b61:	ff d0                	call   *%rax
+  801b63:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b6b:	48 89 de             	mov    %rbx,%rsi
+  801b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b73:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+    return res;
+  801b7f:	eb a3                	jmp    801b24 <fd_close+0x4d>
+
+0000000000801b81 <close>:
+
+int
+close(int fdnum) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b89:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b8d:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	78 15                	js     801bb2 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b9d:	be 01 00 00 00       	mov    $0x1,%esi
+  801ba2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ba6:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  801bad:	00 00 00 
+  801bb0:	ff d0                	call   *%rax
+}
+  801bb2:	c9                   	leave
+  801bb3:	c3                   	ret
+
+0000000000801bb4 <close_all>:
+
+void
+close_all(void) {
+  801bb4:	55                   	push   %rbp
+  801bb5:	48 89 e5             	mov    %rsp,%rbp
+  801bb8:	41 54                	push   %r12
+  801bba:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc0:	49 bc 81 1b 80 00 00 	movabs $0x801b81,%r12
+  801bc7:	00 00 00 
+  801bca:	89 df                	mov    %ebx,%edi
+  801bcc:	41 ff d4             	call   *%r12
+  801bcf:	83 c3 01             	add    $0x1,%ebx
+  801bd2:	83 fb 20             	cmp    $0x20,%ebx
+  801bd5:	75 f3                	jne    801bca <close_all+0x16>
+}
+  801bd7:	5b                   	pop    %rbx
+  801bd8:	41 5c                	pop    %r12
+  801bda:	5d                   	pop    %rbp
+  801bdb:	c3                   	ret
+
+0000000000801bdc <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bdc:	55                   	push   %rbp
+  801bdd:	48 89 e5             	mov    %rsp,%rbp
+  801be0:	41 57                	push   %r15
+  801be2:	41 56                	push   %r14
+  801be4:	41 55                	push   %r13
+  801be6:	41 54                	push   %r12
+  801be8:	53                   	push   %rbx
+  801be9:	48 83 ec 18          	sub    $0x18,%rsp
+  801bed:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bf0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bf4:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	0f 88 b8 00 00 00    	js     801cc2 <dup+0xe6>
+    close(newfdnum);
+  801c0a:	44 89 e7             	mov    %r12d,%edi
+  801c0d:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c19:	4d 63 ec             	movslq %r12d,%r13
+  801c1c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c23:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c27:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c2b:	4c 89 ff             	mov    %r15,%rdi
+  801c2e:	49 be a0 19 80 00 00 	movabs $0x8019a0,%r14
+  801c35:	00 00 00 
+  801c38:	41 ff d6             	call   *%r14
+  801c3b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c3e:	4c 89 ef             	mov    %r13,%rdi
+  801c41:	41 ff d6             	call   *%r14
+  801c44:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c47:	48 89 df             	mov    %rbx,%rdi
+  801c4a:	48 b8 db 34 80 00 00 	movabs $0x8034db,%rax
+  801c51:	00 00 00 
+  801c54:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c56:	a8 04                	test   $0x4,%al
+  801c58:	74 2b                	je     801c85 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c5a:	41 89 c1             	mov    %eax,%r9d
+  801c5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c63:	4c 89 f1             	mov    %r14,%rcx
+  801c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6b:	48 89 de             	mov    %rbx,%rsi
+  801c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c73:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	89 c3                	mov    %eax,%ebx
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 4e                	js     801cd3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c85:	4c 89 ff             	mov    %r15,%rdi
+  801c88:	48 b8 db 34 80 00 00 	movabs $0x8034db,%rax
+  801c8f:	00 00 00 
+  801c92:	ff d0                	call   *%rax
+  801c94:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c97:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c9d:	4c 89 e9             	mov    %r13,%rcx
+  801ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca5:	4c 89 fe             	mov    %r15,%rsi
+  801ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cad:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  801cb4:	00 00 00 
+  801cb7:	ff d0                	call   *%rax
+  801cb9:	89 c3                	mov    %eax,%ebx
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	78 14                	js     801cd3 <dup+0xf7>
+
+    return newfdnum;
+  801cbf:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cc2:	89 d8                	mov    %ebx,%eax
+  801cc4:	48 83 c4 18          	add    $0x18,%rsp
+  801cc8:	5b                   	pop    %rbx
+  801cc9:	41 5c                	pop    %r12
+  801ccb:	41 5d                	pop    %r13
+  801ccd:	41 5e                	pop    %r14
+  801ccf:	41 5f                	pop    %r15
+  801cd1:	5d                   	pop    %rbp
+  801cd2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cd8:	4c 89 ee             	mov    %r13,%rsi
+  801cdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce0:	49 bc 7b 15 80 00 00 	movabs $0x80157b,%r12
+  801ce7:	00 00 00 
+  801cea:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ced:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf2:	4c 89 f6             	mov    %r14,%rsi
+  801cf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cfa:	41 ff d4             	call   *%r12
+    return res;
+  801cfd:	eb c3                	jmp    801cc2 <dup+0xe6>
+
+0000000000801cff <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cff:	55                   	push   %rbp
+  801d00:	48 89 e5             	mov    %rsp,%rbp
+  801d03:	41 56                	push   %r14
+  801d05:	41 55                	push   %r13
+  801d07:	41 54                	push   %r12
+  801d09:	53                   	push   %rbx
+  801d0a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d0e:	89 fb                	mov    %edi,%ebx
+  801d10:	49 89 f4             	mov    %rsi,%r12
+  801d13:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d16:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d1a:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801d21:	00 00 00 
+  801d24:	ff d0                	call   *%rax
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	78 4c                	js     801d76 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d2e:	41 8b 3e             	mov    (%r14),%edi
+  801d31:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d35:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 35                	js     801d7a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d45:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d49:	83 e0 03             	and    $0x3,%eax
+  801d4c:	83 f8 01             	cmp    $0x1,%eax
+  801d4f:	74 2d                	je     801d7e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d55:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d59:	48 85 c0             	test   %rax,%rax
+  801d5c:	74 56                	je     801db4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d5e:	4c 89 ea             	mov    %r13,%rdx
+  801d61:	4c 89 e6             	mov    %r12,%rsi
+  801d64:	4c 89 f7             	mov    %r14,%rdi
+  801d67:	ff d0                	call   *%rax
+}
+  801d69:	48 83 c4 10          	add    $0x10,%rsp
+  801d6d:	5b                   	pop    %rbx
+  801d6e:	41 5c                	pop    %r12
+  801d70:	41 5d                	pop    %r13
+  801d72:	41 5e                	pop    %r14
+  801d74:	5d                   	pop    %rbp
+  801d75:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d76:	48 98                	cltq
+  801d78:	eb ef                	jmp    801d69 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7a:	48 98                	cltq
+  801d7c:	eb eb                	jmp    801d69 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d7e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d85:	00 00 00 
+  801d88:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d8e:	89 da                	mov    %ebx,%edx
+  801d90:	48 bf 21 41 80 00 00 	movabs $0x804121,%rdi
+  801d97:	00 00 00 
+  801d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9f:	48 b9 fe 04 80 00 00 	movabs $0x8004fe,%rcx
+  801da6:	00 00 00 
+  801da9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801db2:	eb b5                	jmp    801d69 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801db4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dbb:	eb ac                	jmp    801d69 <read+0x6a>
+
+0000000000801dbd <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801dbd:	55                   	push   %rbp
+  801dbe:	48 89 e5             	mov    %rsp,%rbp
+  801dc1:	41 56                	push   %r14
+  801dc3:	41 55                	push   %r13
+  801dc5:	41 54                	push   %r12
+  801dc7:	53                   	push   %rbx
+  801dc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801dcc:	89 fb                	mov    %edi,%ebx
+  801dce:	49 89 f4             	mov    %rsi,%r12
+  801dd1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd8:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 41                	js     801e29 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dec:	41 8b 3e             	mov    (%r14),%edi
+  801def:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801df3:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801dfa:	00 00 00 
+  801dfd:	ff d0                	call   *%rax
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 35                	js     801e38 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e03:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e07:	83 e0 03             	and    $0x3,%eax
+  801e0a:	83 f8 01             	cmp    $0x1,%eax
+  801e0d:	74 2d                	je     801e3c <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e13:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e17:	48 85 c0             	test   %rax,%rax
+  801e1a:	74 56                	je     801e72 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801e1c:	4c 89 ea             	mov    %r13,%rdx
+  801e1f:	4c 89 e6             	mov    %r12,%rsi
+  801e22:	4c 89 f7             	mov    %r14,%rdi
+  801e25:	ff d0                	call   *%rax
+  801e27:	eb 02                	jmp    801e2b <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e29:	48 98                	cltq
+}
+  801e2b:	48 83 c4 10          	add    $0x10,%rsp
+  801e2f:	5b                   	pop    %rbx
+  801e30:	41 5c                	pop    %r12
+  801e32:	41 5d                	pop    %r13
+  801e34:	41 5e                	pop    %r14
+  801e36:	5d                   	pop    %rbp
+  801e37:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e38:	48 98                	cltq
+  801e3a:	eb ef                	jmp    801e2b <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e3c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e43:	00 00 00 
+  801e46:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e4c:	89 da                	mov    %ebx,%edx
+  801e4e:	48 bf e0 40 80 00 00 	movabs $0x8040e0,%rdi
+  801e55:	00 00 00 
+  801e58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5d:	48 b9 fe 04 80 00 00 	movabs $0x8004fe,%rcx
+  801e64:	00 00 00 
+  801e67:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e69:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e70:	eb b9                	jmp    801e2b <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e72:	4c 89 ea             	mov    %r13,%rdx
+  801e75:	4c 89 e6             	mov    %r12,%rsi
+  801e78:	89 df                	mov    %ebx,%edi
+  801e7a:	48 b8 ff 1c 80 00 00 	movabs $0x801cff,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+  801e86:	eb a3                	jmp    801e2b <readmap+0x6e>
+
+0000000000801e88 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+  801e8c:	41 57                	push   %r15
+  801e8e:	41 56                	push   %r14
+  801e90:	41 55                	push   %r13
+  801e92:	41 54                	push   %r12
+  801e94:	53                   	push   %rbx
+  801e95:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e99:	48 85 d2             	test   %rdx,%rdx
+  801e9c:	74 54                	je     801ef2 <readn+0x6a>
+  801e9e:	41 89 fd             	mov    %edi,%r13d
+  801ea1:	49 89 f6             	mov    %rsi,%r14
+  801ea4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801eac:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801eb1:	49 bf ff 1c 80 00 00 	movabs $0x801cff,%r15
+  801eb8:	00 00 00 
+  801ebb:	4c 89 e2             	mov    %r12,%rdx
+  801ebe:	48 29 f2             	sub    %rsi,%rdx
+  801ec1:	4c 01 f6             	add    %r14,%rsi
+  801ec4:	44 89 ef             	mov    %r13d,%edi
+  801ec7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 20                	js     801eee <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ece:	01 c3                	add    %eax,%ebx
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	74 08                	je     801edc <readn+0x54>
+  801ed4:	48 63 f3             	movslq %ebx,%rsi
+  801ed7:	4c 39 e6             	cmp    %r12,%rsi
+  801eda:	72 df                	jb     801ebb <readn+0x33>
+    }
+    return res;
+  801edc:	48 63 c3             	movslq %ebx,%rax
+}
+  801edf:	48 83 c4 08          	add    $0x8,%rsp
+  801ee3:	5b                   	pop    %rbx
+  801ee4:	41 5c                	pop    %r12
+  801ee6:	41 5d                	pop    %r13
+  801ee8:	41 5e                	pop    %r14
+  801eea:	41 5f                	pop    %r15
+  801eec:	5d                   	pop    %rbp
+  801eed:	c3                   	ret
+        if (inc < 0) return inc;
+  801eee:	48 98                	cltq
+  801ef0:	eb ed                	jmp    801edf <readn+0x57>
+    int inc = 1, res = 0;
+  801ef2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef7:	eb e3                	jmp    801edc <readn+0x54>
+
+0000000000801ef9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ef9:	55                   	push   %rbp
+  801efa:	48 89 e5             	mov    %rsp,%rbp
+  801efd:	41 56                	push   %r14
+  801eff:	41 55                	push   %r13
+  801f01:	41 54                	push   %r12
+  801f03:	53                   	push   %rbx
+  801f04:	48 83 ec 10          	sub    $0x10,%rsp
+  801f08:	89 fb                	mov    %edi,%ebx
+  801f0a:	49 89 f4             	mov    %rsi,%r12
+  801f0d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f10:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f14:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 47                	js     801f6b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f24:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f28:	41 8b 3e             	mov    (%r14),%edi
+  801f2b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f2f:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 30                	js     801f6f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f3f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f44:	74 2d                	je     801f73 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f4a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f4e:	48 85 c0             	test   %rax,%rax
+  801f51:	74 56                	je     801fa9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f53:	4c 89 ea             	mov    %r13,%rdx
+  801f56:	4c 89 e6             	mov    %r12,%rsi
+  801f59:	4c 89 f7             	mov    %r14,%rdi
+  801f5c:	ff d0                	call   *%rax
+}
+  801f5e:	48 83 c4 10          	add    $0x10,%rsp
+  801f62:	5b                   	pop    %rbx
+  801f63:	41 5c                	pop    %r12
+  801f65:	41 5d                	pop    %r13
+  801f67:	41 5e                	pop    %r14
+  801f69:	5d                   	pop    %rbp
+  801f6a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f6b:	48 98                	cltq
+  801f6d:	eb ef                	jmp    801f5e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6f:	48 98                	cltq
+  801f71:	eb eb                	jmp    801f5e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f73:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f7a:	00 00 00 
+  801f7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f83:	89 da                	mov    %ebx,%edx
+  801f85:	48 bf 3d 41 80 00 00 	movabs $0x80413d,%rdi
+  801f8c:	00 00 00 
+  801f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f94:	48 b9 fe 04 80 00 00 	movabs $0x8004fe,%rcx
+  801f9b:	00 00 00 
+  801f9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fa0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fa7:	eb b5                	jmp    801f5e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fa9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fb0:	eb ac                	jmp    801f5e <write+0x65>
+
+0000000000801fb2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fb2:	55                   	push   %rbp
+  801fb3:	48 89 e5             	mov    %rsp,%rbp
+  801fb6:	53                   	push   %rbx
+  801fb7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fbb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fbd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc1:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	78 0c                	js     801fdd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fd5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fdd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+  801fe7:	41 55                	push   %r13
+  801fe9:	41 54                	push   %r12
+  801feb:	53                   	push   %rbx
+  801fec:	48 83 ec 18          	sub    $0x18,%rsp
+  801ff0:	89 fb                	mov    %edi,%ebx
+  801ff2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ff9:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802000:	00 00 00 
+  802003:	ff d0                	call   *%rax
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 38                	js     802041 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802009:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80200d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802011:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802015:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  80201c:	00 00 00 
+  80201f:	ff d0                	call   *%rax
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 1c                	js     802041 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802025:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80202a:	74 20                	je     80204c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80202c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802030:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802034:	48 85 c0             	test   %rax,%rax
+  802037:	74 47                	je     802080 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802039:	44 89 e6             	mov    %r12d,%esi
+  80203c:	4c 89 ef             	mov    %r13,%rdi
+  80203f:	ff d0                	call   *%rax
+}
+  802041:	48 83 c4 18          	add    $0x18,%rsp
+  802045:	5b                   	pop    %rbx
+  802046:	41 5c                	pop    %r12
+  802048:	41 5d                	pop    %r13
+  80204a:	5d                   	pop    %rbp
+  80204b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80204c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802053:	00 00 00 
+  802056:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80205c:	89 da                	mov    %ebx,%edx
+  80205e:	48 bf 00 41 80 00 00 	movabs $0x804100,%rdi
+  802065:	00 00 00 
+  802068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206d:	48 b9 fe 04 80 00 00 	movabs $0x8004fe,%rcx
+  802074:	00 00 00 
+  802077:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802079:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80207e:	eb c1                	jmp    802041 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802080:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802085:	eb ba                	jmp    802041 <ftruncate+0x5e>
+
+0000000000802087 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802087:	55                   	push   %rbp
+  802088:	48 89 e5             	mov    %rsp,%rbp
+  80208b:	41 54                	push   %r12
+  80208d:	53                   	push   %rbx
+  80208e:	48 83 ec 10          	sub    $0x10,%rsp
+  802092:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802095:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802099:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	78 4e                	js     8020f7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020ad:	41 8b 3c 24          	mov    (%r12),%edi
+  8020b1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020b5:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8020bc:	00 00 00 
+  8020bf:	ff d0                	call   *%rax
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 32                	js     8020f7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020c9:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  8020ce:	74 30                	je     802100 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020d0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020d3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020da:	00 00 00 
+    stat->st_isdir = 0;
+  8020dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020e4:	00 00 00 
+    stat->st_dev = dev;
+  8020e7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020ee:	48 89 de             	mov    %rbx,%rsi
+  8020f1:	4c 89 e7             	mov    %r12,%rdi
+  8020f4:	ff 50 30             	call   *0x30(%rax)
+}
+  8020f7:	48 83 c4 10          	add    $0x10,%rsp
+  8020fb:	5b                   	pop    %rbx
+  8020fc:	41 5c                	pop    %r12
+  8020fe:	5d                   	pop    %rbp
+  8020ff:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802100:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802105:	eb f0                	jmp    8020f7 <fstat+0x70>
+
+0000000000802107 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802107:	55                   	push   %rbp
+  802108:	48 89 e5             	mov    %rsp,%rbp
+  80210b:	41 54                	push   %r12
+  80210d:	53                   	push   %rbx
+  80210e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802111:	be 00 00 00 00       	mov    $0x0,%esi
+  802116:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+  802122:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802124:	85 c0                	test   %eax,%eax
+  802126:	78 25                	js     80214d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802128:	4c 89 e6             	mov    %r12,%rsi
+  80212b:	89 c7                	mov    %eax,%edi
+  80212d:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+  802139:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80213c:	89 df                	mov    %ebx,%edi
+  80213e:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+
+    return res;
+  80214a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80214d:	89 d8                	mov    %ebx,%eax
+  80214f:	5b                   	pop    %rbx
+  802150:	41 5c                	pop    %r12
+  802152:	5d                   	pop    %rbp
+  802153:	c3                   	ret
+
+0000000000802154 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	41 54                	push   %r12
+  80215a:	53                   	push   %rbx
+  80215b:	48 83 ec 10          	sub    $0x10,%rsp
+  80215f:	48 89 fb             	mov    %rdi,%rbx
+  802162:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802165:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802169:	bf 66 00 00 00       	mov    $0x66,%edi
+  80216e:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 1f                	js     80219d <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80217e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802182:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802186:	48 85 c0             	test   %rax,%rax
+  802189:	74 1b                	je     8021a6 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80218b:	4c 89 e6             	mov    %r12,%rsi
+  80218e:	48 89 df             	mov    %rbx,%rdi
+  802191:	ff d0                	call   *%rax
+    if (res < 0) {
+  802193:	85 c0                	test   %eax,%eax
+  802195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219a:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80219d:	48 83 c4 10          	add    $0x10,%rsp
+  8021a1:	5b                   	pop    %rbx
+  8021a2:	41 5c                	pop    %r12
+  8021a4:	5d                   	pop    %rbp
+  8021a5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021a6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021ab:	eb f0                	jmp    80219d <create_snapshot+0x49>
+
+00000000008021ad <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  8021ad:	55                   	push   %rbp
+  8021ae:	48 89 e5             	mov    %rsp,%rbp
+  8021b1:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021b5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021b9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021be:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8021c5:	00 00 00 
+  8021c8:	ff d0                	call   *%rax
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 1e                	js     8021ec <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8021ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d2:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8021d6:	48 85 d2             	test   %rdx,%rdx
+  8021d9:	74 13                	je     8021ee <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8021db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e0:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021ec:	c9                   	leave
+  8021ed:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021ee:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021f3:	eb f7                	jmp    8021ec <print_snapshot_list+0x3f>
+
+00000000008021f5 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8021f5:	55                   	push   %rbp
+  8021f6:	48 89 e5             	mov    %rsp,%rbp
+  8021f9:	53                   	push   %rbx
+  8021fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8021fe:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802201:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802205:	bf 66 00 00 00       	mov    $0x66,%edi
+  80220a:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 1c                	js     802236 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80221a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80221e:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802222:	48 85 c0             	test   %rax,%rax
+  802225:	74 15                	je     80223c <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  802227:	48 89 df             	mov    %rbx,%rdi
+  80222a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802233:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802236:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80223c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802241:	eb f3                	jmp    802236 <accept_snapshot+0x41>
+
+0000000000802243 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802243:	55                   	push   %rbp
+  802244:	48 89 e5             	mov    %rsp,%rbp
+  802247:	53                   	push   %rbx
+  802248:	48 83 ec 18          	sub    $0x18,%rsp
+  80224c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80224f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802253:	bf 66 00 00 00       	mov    $0x66,%edi
+  802258:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  80225f:	00 00 00 
+  802262:	ff d0                	call   *%rax
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 1c                	js     802284 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802268:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80226c:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802270:	48 85 c0             	test   %rax,%rax
+  802273:	74 15                	je     80228a <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802275:	48 89 df             	mov    %rbx,%rdi
+  802278:	ff d0                	call   *%rax
+    if (res < 0) {
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802281:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802284:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+        return -E_NOT_SUPP;
+  80228a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80228f:	eb f3                	jmp    802284 <delete_snapshot+0x41>
+
+0000000000802291 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802291:	55                   	push   %rbp
+  802292:	48 89 e5             	mov    %rsp,%rbp
+  802295:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802299:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80229d:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022a2:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8022a9:	00 00 00 
+  8022ac:	ff d0                	call   *%rax
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 14                	js     8022c6 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8022b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022b6:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8022ba:	48 85 d2             	test   %rdx,%rdx
+  8022bd:	74 09                	je     8022c8 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8022bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c4:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8022c6:	c9                   	leave
+  8022c7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022cd:	eb f7                	jmp    8022c6 <gc_snapshots+0x35>
+
+00000000008022cf <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8022cf:	55                   	push   %rbp
+  8022d0:	48 89 e5             	mov    %rsp,%rbp
+  8022d3:	41 56                	push   %r14
+  8022d5:	41 55                	push   %r13
+  8022d7:	41 54                	push   %r12
+  8022d9:	53                   	push   %rbx
+  8022da:	48 83 ec 10          	sub    $0x10,%rsp
+  8022de:	48 89 fb             	mov    %rdi,%rbx
+  8022e1:	49 89 f4             	mov    %rsi,%r12
+  8022e4:	49 89 d5             	mov    %rdx,%r13
+  8022e7:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022ee:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022f3:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	85 c0                	test   %eax,%eax
+  802301:	78 1b                	js     80231e <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802303:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802307:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80230b:	48 85 c0             	test   %rax,%rax
+  80230e:	74 1b                	je     80232b <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802310:	4c 89 f1             	mov    %r14,%rcx
+  802313:	4c 89 ea             	mov    %r13,%rdx
+  802316:	4c 89 e6             	mov    %r12,%rsi
+  802319:	48 89 df             	mov    %rbx,%rdi
+  80231c:	ff d0                	call   *%rax
+
+    return res;
+}
+  80231e:	48 83 c4 10          	add    $0x10,%rsp
+  802322:	5b                   	pop    %rbx
+  802323:	41 5c                	pop    %r12
+  802325:	41 5d                	pop    %r13
+  802327:	41 5e                	pop    %r14
+  802329:	5d                   	pop    %rbp
+  80232a:	c3                   	ret
+        return -E_NOT_SUPP;
+  80232b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802330:	eb ec                	jmp    80231e <diff_snapshots+0x4f>
+
+0000000000802332 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+  802336:	41 55                	push   %r13
+  802338:	41 54                	push   %r12
+  80233a:	53                   	push   %rbx
+  80233b:	48 83 ec 18          	sub    $0x18,%rsp
+  80233f:	48 89 fb             	mov    %rdi,%rbx
+  802342:	49 89 f4             	mov    %rsi,%r12
+  802345:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802348:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80234c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802351:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802358:	00 00 00 
+  80235b:	ff d0                	call   *%rax
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 18                	js     802379 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802361:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802365:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802369:	48 85 c0             	test   %rax,%rax
+  80236c:	74 16                	je     802384 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  80236e:	4c 89 ea             	mov    %r13,%rdx
+  802371:	4c 89 e6             	mov    %r12,%rsi
+  802374:	48 89 df             	mov    %rbx,%rdi
+  802377:	ff d0                	call   *%rax
+
+    return res;
+}
+  802379:	48 83 c4 18          	add    $0x18,%rsp
+  80237d:	5b                   	pop    %rbx
+  80237e:	41 5c                	pop    %r12
+  802380:	41 5d                	pop    %r13
+  802382:	5d                   	pop    %rbp
+  802383:	c3                   	ret
+        return -E_NOT_SUPP;
+  802384:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802389:	eb ee                	jmp    802379 <send_snapshot+0x47>
+
+000000000080238b <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+  80238f:	53                   	push   %rbx
+  802390:	48 83 ec 18          	sub    $0x18,%rsp
+  802394:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802397:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80239b:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023a0:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 12                	js     8023c2 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8023b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023b4:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8023b8:	48 85 c0             	test   %rax,%rax
+  8023bb:	74 0b                	je     8023c8 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8023bd:	48 89 df             	mov    %rbx,%rdi
+  8023c0:	ff d0                	call   *%rax
+
+    return res;
+}
+  8023c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023c6:	c9                   	leave
+  8023c7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023cd:	eb f3                	jmp    8023c2 <receive_snapshot+0x37>
+
+00000000008023cf <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8023cf:	55                   	push   %rbp
+  8023d0:	48 89 e5             	mov    %rsp,%rbp
+  8023d3:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023db:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023e0:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8023e7:	00 00 00 
+  8023ea:	ff d0                	call   *%rax
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 17                	js     802407 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8023f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f4:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8023fb:	48 85 d2             	test   %rdx,%rdx
+  8023fe:	74 09                	je     802409 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802400:	b8 00 00 00 00       	mov    $0x0,%eax
+  802405:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+        return -E_NOT_SUPP;
+  802409:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80240e:	eb f7                	jmp    802407 <free_space_bytes+0x38>
+
+0000000000802410 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802418:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80241c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802421:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	78 17                	js     802448 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802435:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80243c:	48 85 d2             	test   %rdx,%rdx
+  80243f:	74 09                	je     80244a <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802448:	c9                   	leave
+  802449:	c3                   	ret
+        return -E_NOT_SUPP;
+  80244a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80244f:	eb f7                	jmp    802448 <busy_space_bytes+0x38>
+
+0000000000802451 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802451:	55                   	push   %rbp
+  802452:	48 89 e5             	mov    %rsp,%rbp
+  802455:	41 54                	push   %r12
+  802457:	53                   	push   %rbx
+  802458:	48 83 ec 10          	sub    $0x10,%rsp
+  80245c:	89 fb                	mov    %edi,%ebx
+  80245e:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802461:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802465:	bf 66 00 00 00       	mov    $0x66,%edi
+  80246a:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+  802476:	85 c0                	test   %eax,%eax
+  802478:	78 17                	js     802491 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80247a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80247e:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802485:	48 85 c0             	test   %rax,%rax
+  802488:	74 10                	je     80249a <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80248a:	4c 89 e6             	mov    %r12,%rsi
+  80248d:	89 df                	mov    %ebx,%edi
+  80248f:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802491:	48 83 c4 10          	add    $0x10,%rsp
+  802495:	5b                   	pop    %rbx
+  802496:	41 5c                	pop    %r12
+  802498:	5d                   	pop    %rbp
+  802499:	c3                   	ret
+        return -E_NOT_SUPP;
+  80249a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80249f:	eb f0                	jmp    802491 <snapshots_space+0x40>
+
+00000000008024a1 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+  8024a5:	41 55                	push   %r13
+  8024a7:	41 54                	push   %r12
+  8024a9:	53                   	push   %rbx
+  8024aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ae:	41 89 fd             	mov    %edi,%r13d
+  8024b1:	48 89 f3             	mov    %rsi,%rbx
+  8024b4:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024b7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024be:	00 00 00 
+  8024c1:	83 38 00             	cmpl   $0x0,(%rax)
+  8024c4:	74 57                	je     80251d <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024c6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024d1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024d8:	00 00 00 
+  8024db:	44 89 ee             	mov    %r13d,%esi
+  8024de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024e5:	00 00 00 
+  8024e8:	8b 38                	mov    (%rax),%edi
+  8024ea:	48 b8 1e 39 80 00 00 	movabs $0x80391e,%rax
+  8024f1:	00 00 00 
+  8024f4:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8024f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fb:	4c 89 e2             	mov    %r12,%rdx
+  8024fe:	48 89 de             	mov    %rbx,%rsi
+  802501:	bf 00 00 00 00       	mov    $0x0,%edi
+  802506:	48 b8 06 39 80 00 00 	movabs $0x803906,%rax
+  80250d:	00 00 00 
+  802510:	ff d0                	call   *%rax
+}
+  802512:	48 83 c4 08          	add    $0x8,%rsp
+  802516:	5b                   	pop    %rbx
+  802517:	41 5c                	pop    %r12
+  802519:	41 5d                	pop    %r13
+  80251b:	5d                   	pop    %rbp
+  80251c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80251d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802522:	48 b8 dc 39 80 00 00 	movabs $0x8039dc,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+  80252e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802535:	00 00 
+  802537:	eb 8d                	jmp    8024c6 <fsipc_region+0x25>
+
+0000000000802539 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802541:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802548:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  802549:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80254d:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+}
+  802559:	c9                   	leave
+  80255a:	c3                   	ret
+
+000000000080255b <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80255b:	85 ff                	test   %edi,%edi
+  80255d:	78 6d                	js     8025cc <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  80255f:	55                   	push   %rbp
+  802560:	48 89 e5             	mov    %rsp,%rbp
+  802563:	41 54                	push   %r12
+  802565:	53                   	push   %rbx
+  802566:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802569:	48 85 f6             	test   %rsi,%rsi
+  80256c:	74 57                	je     8025c5 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  80256e:	89 f8                	mov    %edi,%eax
+  802570:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802577:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802579:	be 00 00 00 00       	mov    $0x0,%esi
+  80257e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802583:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	78 2d                	js     8025c0 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802593:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80259a:	00 00 00 
+  80259d:	49 63 14 24          	movslq (%r12),%rdx
+  8025a1:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  8025a8:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8025ad:	48 89 df             	mov    %rbx,%rdi
+  8025b0:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  8025b7:	00 00 00 
+  8025ba:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8025bc:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8025c0:	5b                   	pop    %rbx
+  8025c1:	41 5c                	pop    %r12
+  8025c3:	5d                   	pop    %rbp
+  8025c4:	c3                   	ret
+        return -E_INVAL;
+  8025c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025ca:	eb f4                	jmp    8025c0 <devfile_df_snapshots+0x65>
+  8025cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025d1:	c3                   	ret
+
+00000000008025d2 <devfile_df_busy>:
+devfile_df_busy() {
+  8025d2:	55                   	push   %rbp
+  8025d3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8025d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025db:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025e0:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+}
+  8025ec:	5d                   	pop    %rbp
+  8025ed:	c3                   	ret
+
+00000000008025ee <devfile_df_free>:
+devfile_df_free() {
+  8025ee:	55                   	push   %rbp
+  8025ef:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8025f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025fc:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802603:	00 00 00 
+  802606:	ff d0                	call   *%rax
+}
+  802608:	5d                   	pop    %rbp
+  802609:	c3                   	ret
+
+000000000080260a <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  80260a:	55                   	push   %rbp
+  80260b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80260e:	be 00 00 00 00       	mov    $0x0,%esi
+  802613:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802618:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+}
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+
+0000000000802626 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80262a:	be 00 00 00 00       	mov    $0x0,%esi
+  80262f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802634:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80263b:	00 00 00 
+  80263e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802640:	85 c0                	test   %eax,%eax
+  802642:	ba 00 00 00 00       	mov    $0x0,%edx
+  802647:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80264a:	5d                   	pop    %rbp
+  80264b:	c3                   	ret
+
+000000000080264c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80264c:	55                   	push   %rbp
+  80264d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802650:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802657:	00 00 00 
+  80265a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80265d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80265f:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802662:	be 00 00 00 00       	mov    $0x0,%esi
+  802667:	bf 02 00 00 00       	mov    $0x2,%edi
+  80266c:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+}
+  802678:	5d                   	pop    %rbp
+  802679:	c3                   	ret
+
+000000000080267a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80267a:	55                   	push   %rbp
+  80267b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80267e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802681:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802688:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80268a:	be 00 00 00 00       	mov    $0x0,%esi
+  80268f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802694:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+}
+  8026a0:	5d                   	pop    %rbp
+  8026a1:	c3                   	ret
+
+00000000008026a2 <devfile_write>:
+    if (!fd || !buf) {
+  8026a2:	48 85 ff             	test   %rdi,%rdi
+  8026a5:	0f 84 c1 00 00 00    	je     80276c <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026ab:	55                   	push   %rbp
+  8026ac:	48 89 e5             	mov    %rsp,%rbp
+  8026af:	41 57                	push   %r15
+  8026b1:	41 56                	push   %r14
+  8026b3:	41 55                	push   %r13
+  8026b5:	41 54                	push   %r12
+  8026b7:	53                   	push   %rbx
+  8026b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8026bc:	49 89 ff             	mov    %rdi,%r15
+  8026bf:	49 89 f5             	mov    %rsi,%r13
+  8026c2:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8026c5:	48 85 f6             	test   %rsi,%rsi
+  8026c8:	0f 84 95 00 00 00    	je     802763 <devfile_write+0xc1>
+    while (n) {
+  8026ce:	48 85 d2             	test   %rdx,%rdx
+  8026d1:	0f 84 83 00 00 00    	je     80275a <devfile_write+0xb8>
+    int totalWrite = 0;
+  8026d7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026de:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026e5:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8026e8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026ed:	49 39 dc             	cmp    %rbx,%r12
+  8026f0:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8026f4:	48 89 da             	mov    %rbx,%rdx
+  8026f7:	4c 89 ee             	mov    %r13,%rsi
+  8026fa:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802701:	00 00 00 
+  802704:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802710:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802714:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802717:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80271b:	be 00 00 00 00       	mov    $0x0,%esi
+  802720:	bf 04 00 00 00       	mov    $0x4,%edi
+  802725:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+        if (write < 0) {
+  802731:	85 c0                	test   %eax,%eax
+  802733:	78 21                	js     802756 <devfile_write+0xb4>
+        buf += write;
+  802735:	48 63 d0             	movslq %eax,%rdx
+  802738:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80273b:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  80273e:	49 29 d4             	sub    %rdx,%r12
+  802741:	75 a5                	jne    8026e8 <devfile_write+0x46>
+    return totalWrite;
+  802743:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802747:	48 83 c4 18          	add    $0x18,%rsp
+  80274b:	5b                   	pop    %rbx
+  80274c:	41 5c                	pop    %r12
+  80274e:	41 5d                	pop    %r13
+  802750:	41 5e                	pop    %r14
+  802752:	41 5f                	pop    %r15
+  802754:	5d                   	pop    %rbp
+  802755:	c3                   	ret
+            return write;
+  802756:	48 98                	cltq
+  802758:	eb ed                	jmp    802747 <devfile_write+0xa5>
+    int totalWrite = 0;
+  80275a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802761:	eb e0                	jmp    802743 <devfile_write+0xa1>
+        return -E_INVAL;
+  802763:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80276a:	eb db                	jmp    802747 <devfile_write+0xa5>
+  80276c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802773:	c3                   	ret
+
+0000000000802774 <devfile_read>:
+    if (!fd || !buf) {
+  802774:	48 85 ff             	test   %rdi,%rdi
+  802777:	0f 84 c0 00 00 00    	je     80283d <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80277d:	55                   	push   %rbp
+  80277e:	48 89 e5             	mov    %rsp,%rbp
+  802781:	41 57                	push   %r15
+  802783:	41 56                	push   %r14
+  802785:	41 55                	push   %r13
+  802787:	41 54                	push   %r12
+  802789:	53                   	push   %rbx
+  80278a:	48 83 ec 18          	sub    $0x18,%rsp
+  80278e:	49 89 ff             	mov    %rdi,%r15
+  802791:	49 89 f5             	mov    %rsi,%r13
+  802794:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802797:	48 85 f6             	test   %rsi,%rsi
+  80279a:	0f 84 96 00 00 00    	je     802836 <devfile_read+0xc2>
+    while (n) {
+  8027a0:	48 85 d2             	test   %rdx,%rdx
+  8027a3:	0f 84 87 00 00 00    	je     802830 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  8027a9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027b0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027b1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8027b8:	00 00 00 
+  8027bb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027bf:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8027c2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027c7:	49 39 c4             	cmp    %rax,%r12
+  8027ca:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8027ce:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8027d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8027dc:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	7e 37                	jle    802823 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8027ec:	48 63 d8             	movslq %eax,%rbx
+  8027ef:	48 89 da             	mov    %rbx,%rdx
+  8027f2:	4c 89 f6             	mov    %r14,%rsi
+  8027f5:	4c 89 ef             	mov    %r13,%rdi
+  8027f8:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+        buf += read;
+  802804:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802807:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80280b:	49 29 dc             	sub    %rbx,%r12
+  80280e:	75 ab                	jne    8027bb <devfile_read+0x47>
+  return totalRead;
+  802810:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802814:	48 83 c4 18          	add    $0x18,%rsp
+  802818:	5b                   	pop    %rbx
+  802819:	41 5c                	pop    %r12
+  80281b:	41 5d                	pop    %r13
+  80281d:	41 5e                	pop    %r14
+  80281f:	41 5f                	pop    %r15
+  802821:	5d                   	pop    %rbp
+  802822:	c3                   	ret
+            return read ? read : totalRead;
+  802823:	48 63 d0             	movslq %eax,%rdx
+  802826:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80282a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80282e:	eb e4                	jmp    802814 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802830:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802834:	eb da                	jmp    802810 <devfile_read+0x9c>
+        return E_INVAL;
+  802836:	b8 03 00 00 00       	mov    $0x3,%eax
+  80283b:	eb d7                	jmp    802814 <devfile_read+0xa0>
+  80283d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802842:	c3                   	ret
+
+0000000000802843 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802843:	48 85 ff             	test   %rdi,%rdi
+  802846:	74 5f                	je     8028a7 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802848:	55                   	push   %rbp
+  802849:	48 89 e5             	mov    %rsp,%rbp
+  80284c:	53                   	push   %rbx
+  80284d:	48 83 ec 08          	sub    $0x8,%rsp
+  802851:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802854:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+  802860:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802866:	77 45                	ja     8028ad <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802868:	48 89 de             	mov    %rbx,%rsi
+  80286b:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802872:	00 00 00 
+  802875:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802881:	be 00 00 00 00       	mov    $0x0,%esi
+  802886:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80288b:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802897:	85 c0                	test   %eax,%eax
+  802899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+        return -E_INVAL;
+  8028a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028ac:	c3                   	ret
+        return -E_INVAL;
+  8028ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b2:	eb ed                	jmp    8028a1 <devfile_receive_snapshot+0x5e>
+
+00000000008028b4 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8028b4:	55                   	push   %rbp
+  8028b5:	48 89 e5             	mov    %rsp,%rbp
+  8028b8:	41 55                	push   %r13
+  8028ba:	41 54                	push   %r12
+  8028bc:	53                   	push   %rbx
+  8028bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c1:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8028c4:	48 85 f6             	test   %rsi,%rsi
+  8028c7:	0f 94 c0             	sete   %al
+  8028ca:	48 85 d2             	test   %rdx,%rdx
+  8028cd:	0f 94 c2             	sete   %dl
+  8028d0:	08 d0                	or     %dl,%al
+  8028d2:	0f 85 ad 00 00 00    	jne    802985 <devfile_send_snapshot+0xd1>
+  8028d8:	48 89 fb             	mov    %rdi,%rbx
+  8028db:	49 89 f4             	mov    %rsi,%r12
+  8028de:	48 85 ff             	test   %rdi,%rdi
+  8028e1:	0f 84 9e 00 00 00    	je     802985 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8028e7:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+  8028f3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028f9:	0f 87 8d 00 00 00    	ja     80298c <devfile_send_snapshot+0xd8>
+  8028ff:	4c 89 e7             	mov    %r12,%rdi
+  802902:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+  80290e:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802914:	77 7d                	ja     802993 <devfile_send_snapshot+0xdf>
+  802916:	4c 89 ef             	mov    %r13,%rdi
+  802919:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+  802925:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80292b:	77 6d                	ja     80299a <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  80292d:	48 89 de             	mov    %rbx,%rsi
+  802930:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802937:	00 00 00 
+  80293a:	48 bb 23 0e 80 00 00 	movabs $0x800e23,%rbx
+  802941:	00 00 00 
+  802944:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802946:	4c 89 e6             	mov    %r12,%rsi
+  802949:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802950:	00 00 00 
+  802953:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802955:	4c 89 ee             	mov    %r13,%rsi
+  802958:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  80295f:	00 00 00 
+  802962:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802964:	be 00 00 00 00       	mov    $0x0,%esi
+  802969:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80296e:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802975:	00 00 00 
+  802978:	ff d0                	call   *%rax
+}
+  80297a:	48 83 c4 08          	add    $0x8,%rsp
+  80297e:	5b                   	pop    %rbx
+  80297f:	41 5c                	pop    %r12
+  802981:	41 5d                	pop    %r13
+  802983:	5d                   	pop    %rbp
+  802984:	c3                   	ret
+        return -E_INVAL;
+  802985:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80298a:	eb ee                	jmp    80297a <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80298c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802991:	eb e7                	jmp    80297a <devfile_send_snapshot+0xc6>
+  802993:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802998:	eb e0                	jmp    80297a <devfile_send_snapshot+0xc6>
+  80299a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299f:	eb d9                	jmp    80297a <devfile_send_snapshot+0xc6>
+
+00000000008029a1 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8029a1:	48 85 ff             	test   %rdi,%rdi
+  8029a4:	0f 84 41 01 00 00    	je     802aeb <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+  8029ae:	41 57                	push   %r15
+  8029b0:	41 56                	push   %r14
+  8029b2:	41 55                	push   %r13
+  8029b4:	41 54                	push   %r12
+  8029b6:	53                   	push   %rbx
+  8029b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bb:	49 89 fc             	mov    %rdi,%r12
+  8029be:	49 89 f5             	mov    %rsi,%r13
+  8029c1:	48 89 d3             	mov    %rdx,%rbx
+  8029c4:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8029c7:	48 85 f6             	test   %rsi,%rsi
+  8029ca:	0f 84 ff 00 00 00    	je     802acf <devfile_diff_snapshots+0x12e>
+  8029d0:	48 85 d2             	test   %rdx,%rdx
+  8029d3:	0f 84 fd 00 00 00    	je     802ad6 <devfile_diff_snapshots+0x135>
+  8029d9:	48 85 c9             	test   %rcx,%rcx
+  8029dc:	0f 84 f4 00 00 00    	je     802ad6 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8029e2:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8029e9:	00 00 00 
+  8029ec:	ff d0                	call   *%rax
+  8029ee:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029f4:	0f 87 e3 00 00 00    	ja     802add <devfile_diff_snapshots+0x13c>
+  8029fa:	4c 89 ef             	mov    %r13,%rdi
+  8029fd:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a0f:	0f 87 cf 00 00 00    	ja     802ae4 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802a15:	4c 89 e6             	mov    %r12,%rsi
+  802a18:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a1f:	00 00 00 
+  802a22:	4c 89 e7             	mov    %r12,%rdi
+  802a25:	49 bf 23 0e 80 00 00 	movabs $0x800e23,%r15
+  802a2c:	00 00 00 
+  802a2f:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802a32:	4c 89 ee             	mov    %r13,%rsi
+  802a35:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802a3c:	00 
+  802a3d:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802a40:	48 8b 03             	mov    (%rbx),%rax
+  802a43:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802a4a:	00 
+  802a4b:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a4f:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802a56:	00 
+  802a57:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a5b:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802a62:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802a63:	be 00 00 00 00       	mov    $0x0,%esi
+  802a68:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a6d:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	78 43                	js     802ac0 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a7d:	49 8b 04 24          	mov    (%r12),%rax
+  802a81:	48 89 03             	mov    %rax,(%rbx)
+  802a84:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a89:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a8d:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802a92:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802a96:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802a9b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802a9f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802aa3:	48 c1 e2 03          	shl    $0x3,%rdx
+  802aa7:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802aac:	4c 89 f7             	mov    %r14,%rdi
+  802aaf:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  802ab6:	00 00 00 
+  802ab9:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802abb:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802ac0:	48 83 c4 08          	add    $0x8,%rsp
+  802ac4:	5b                   	pop    %rbx
+  802ac5:	41 5c                	pop    %r12
+  802ac7:	41 5d                	pop    %r13
+  802ac9:	41 5e                	pop    %r14
+  802acb:	41 5f                	pop    %r15
+  802acd:	5d                   	pop    %rbp
+  802ace:	c3                   	ret
+        return -E_INVAL;
+  802acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad4:	eb ea                	jmp    802ac0 <devfile_diff_snapshots+0x11f>
+  802ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802adb:	eb e3                	jmp    802ac0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae2:	eb dc                	jmp    802ac0 <devfile_diff_snapshots+0x11f>
+  802ae4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae9:	eb d5                	jmp    802ac0 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802aeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802af0:	c3                   	ret
+
+0000000000802af1 <devfile_delete_snapshot>:
+    if (!name) {
+  802af1:	48 85 ff             	test   %rdi,%rdi
+  802af4:	74 5f                	je     802b55 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802af6:	55                   	push   %rbp
+  802af7:	48 89 e5             	mov    %rsp,%rbp
+  802afa:	53                   	push   %rbx
+  802afb:	48 83 ec 08          	sub    $0x8,%rsp
+  802aff:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b02:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+  802b0e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b14:	77 45                	ja     802b5b <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802b16:	48 89 de             	mov    %rbx,%rsi
+  802b19:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b20:	00 00 00 
+  802b23:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  802b2a:	00 00 00 
+  802b2d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802b2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b34:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b39:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b45:	85 c0                	test   %eax,%eax
+  802b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b53:	c9                   	leave
+  802b54:	c3                   	ret
+        return -E_INVAL;
+  802b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b5a:	c3                   	ret
+        return -E_INVAL;
+  802b5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b60:	eb ed                	jmp    802b4f <devfile_delete_snapshot+0x5e>
+
+0000000000802b62 <devfile_accept_snapshot>:
+    if (!name) {
+  802b62:	48 85 ff             	test   %rdi,%rdi
+  802b65:	74 5f                	je     802bc6 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b67:	55                   	push   %rbp
+  802b68:	48 89 e5             	mov    %rsp,%rbp
+  802b6b:	53                   	push   %rbx
+  802b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b70:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b73:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802b7a:	00 00 00 
+  802b7d:	ff d0                	call   *%rax
+  802b7f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b85:	77 45                	ja     802bcc <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b87:	48 89 de             	mov    %rbx,%rsi
+  802b8a:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b91:	00 00 00 
+  802b94:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802ba0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802baa:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802bb1:	00 00 00 
+  802bb4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bbd:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc4:	c9                   	leave
+  802bc5:	c3                   	ret
+        return -E_INVAL;
+  802bc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bcb:	c3                   	ret
+        return -E_INVAL;
+  802bcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd1:	eb ed                	jmp    802bc0 <devfile_accept_snapshot+0x5e>
+
+0000000000802bd3 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802bd3:	48 85 ff             	test   %rdi,%rdi
+  802bd6:	0f 84 9f 00 00 00    	je     802c7b <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	41 54                	push   %r12
+  802be2:	53                   	push   %rbx
+  802be3:	48 89 fb             	mov    %rdi,%rbx
+  802be6:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802be9:	48 85 f6             	test   %rsi,%rsi
+  802bec:	74 78                	je     802c66 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802bee:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+  802bfa:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c00:	77 6b                	ja     802c6d <devfile_create_snapshot+0x9a>
+  802c02:	4c 89 e7             	mov    %r12,%rdi
+  802c05:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802c0c:	00 00 00 
+  802c0f:	ff d0                	call   *%rax
+  802c11:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c17:	77 5b                	ja     802c74 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802c19:	48 89 de             	mov    %rbx,%rsi
+  802c1c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802c23:	00 00 00 
+  802c26:	48 bb 23 0e 80 00 00 	movabs $0x800e23,%rbx
+  802c2d:	00 00 00 
+  802c30:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802c32:	4c 89 e6             	mov    %r12,%rsi
+  802c35:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802c3c:	00 00 00 
+  802c3f:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802c41:	be 00 00 00 00       	mov    $0x0,%esi
+  802c46:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c4b:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c5e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802c61:	5b                   	pop    %rbx
+  802c62:	41 5c                	pop    %r12
+  802c64:	5d                   	pop    %rbp
+  802c65:	c3                   	ret
+        return -E_INVAL;
+  802c66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c6b:	eb f4                	jmp    802c61 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c72:	eb ed                	jmp    802c61 <devfile_create_snapshot+0x8e>
+  802c74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c79:	eb e6                	jmp    802c61 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c80:	c3                   	ret
+
+0000000000802c81 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c81:	55                   	push   %rbp
+  802c82:	48 89 e5             	mov    %rsp,%rbp
+  802c85:	41 54                	push   %r12
+  802c87:	53                   	push   %rbx
+  802c88:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c8b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c8e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c95:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c97:	be 00 00 00 00       	mov    $0x0,%esi
+  802c9c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ca1:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	78 3d                	js     802cee <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802cb1:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802cb8:	00 00 00 
+  802cbb:	4c 89 e6             	mov    %r12,%rsi
+  802cbe:	48 89 df             	mov    %rbx,%rdi
+  802cc1:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ccd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802cd4:	00 
+  802cd5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802cdb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ce2:	00 
+  802ce3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cee:	5b                   	pop    %rbx
+  802cef:	41 5c                	pop    %r12
+  802cf1:	5d                   	pop    %rbp
+  802cf2:	c3                   	ret
+
+0000000000802cf3 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802cf3:	55                   	push   %rbp
+  802cf4:	48 89 e5             	mov    %rsp,%rbp
+  802cf7:	41 57                	push   %r15
+  802cf9:	41 56                	push   %r14
+  802cfb:	41 55                	push   %r13
+  802cfd:	41 54                	push   %r12
+  802cff:	53                   	push   %rbx
+  802d00:	48 83 ec 38          	sub    $0x38,%rsp
+  802d04:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802d08:	49 89 f5             	mov    %rsi,%r13
+  802d0b:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d0e:	48 89 f0             	mov    %rsi,%rax
+  802d11:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d16:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d1a:	75 4f                	jne    802d6b <devfile_readmap+0x78>
+  802d1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d20:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d26:	75 1f                	jne    802d47 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802d28:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d2c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802d30:	49 be db 34 80 00 00 	movabs $0x8034db,%r14
+  802d37:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d3a:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802d41:	0f 87 9d 00 00 00    	ja     802de4 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802d47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d4b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802d4f:	4d 85 ff             	test   %r15,%r15
+  802d52:	0f 85 cf 00 00 00    	jne    802e27 <devfile_readmap+0x134>
+  802d58:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802d5c:	48 83 c4 38          	add    $0x38,%rsp
+  802d60:	5b                   	pop    %rbx
+  802d61:	41 5c                	pop    %r12
+  802d63:	41 5d                	pop    %r13
+  802d65:	41 5e                	pop    %r14
+  802d67:	41 5f                	pop    %r15
+  802d69:	5d                   	pop    %rbp
+  802d6a:	c3                   	ret
+    size_t totalRead = 0;
+  802d6b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d72:	00 
+  802d73:	eb da                	jmp    802d4f <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d75:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d79:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d7c:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d83:	00 00 00 
+  802d86:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d8c:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802d90:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d94:	4c 89 ee             	mov    %r13,%rsi
+  802d97:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d9c:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802da3:	00 00 00 
+  802da6:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	7e a3                	jle    802d4f <devfile_readmap+0x5c>
+  802dac:	48 98                	cltq
+  802dae:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802db2:	72 9b                	jb     802d4f <devfile_readmap+0x5c>
+        buf += read;
+  802db4:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802db7:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802dba:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802dbe:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802dc5:	75 88                	jne    802d4f <devfile_readmap+0x5c>
+  802dc7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802dcb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802dd1:	0f 85 78 ff ff ff    	jne    802d4f <devfile_readmap+0x5c>
+  802dd7:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802dde:	0f 86 6b ff ff ff    	jbe    802d4f <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802de4:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802dea:	4d 39 e7             	cmp    %r12,%r15
+  802ded:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802df1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802df8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802dfc:	0f 84 73 ff ff ff    	je     802d75 <devfile_readmap+0x82>
+  802e02:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802e06:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802e0b:	41 ff d6             	call   *%r14
+  802e0e:	a8 40                	test   $0x40,%al
+  802e10:	0f 85 39 ff ff ff    	jne    802d4f <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802e16:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e1d:	4c 39 e3             	cmp    %r12,%rbx
+  802e20:	72 e4                	jb     802e06 <devfile_readmap+0x113>
+  802e22:	e9 4e ff ff ff       	jmp    802d75 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802e27:	4c 89 fa             	mov    %r15,%rdx
+  802e2a:	4c 89 ee             	mov    %r13,%rsi
+  802e2d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e31:	48 b8 74 27 80 00 00 	movabs $0x802774,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802e3d:	48 85 c0             	test   %rax,%rax
+  802e40:	78 0c                	js     802e4e <devfile_readmap+0x15b>
+    return totalRead + read;
+  802e42:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e46:	48 01 f0             	add    %rsi,%rax
+  802e49:	e9 0e ff ff ff       	jmp    802d5c <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802e4e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e52:	48 85 f6             	test   %rsi,%rsi
+  802e55:	48 0f 45 c6          	cmovne %rsi,%rax
+  802e59:	e9 fe fe ff ff       	jmp    802d5c <devfile_readmap+0x69>
+
+0000000000802e5e <open>:
+open(const char *path, int mode) {
+  802e5e:	55                   	push   %rbp
+  802e5f:	48 89 e5             	mov    %rsp,%rbp
+  802e62:	41 55                	push   %r13
+  802e64:	41 54                	push   %r12
+  802e66:	53                   	push   %rbx
+  802e67:	48 83 ec 18          	sub    $0x18,%rsp
+  802e6b:	49 89 fc             	mov    %rdi,%r12
+  802e6e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e71:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  802e78:	00 00 00 
+  802e7b:	ff d0                	call   *%rax
+  802e7d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e83:	0f 87 8a 00 00 00    	ja     802f13 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e89:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e8d:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+  802e99:	89 c3                	mov    %eax,%ebx
+  802e9b:	85 c0                	test   %eax,%eax
+  802e9d:	78 50                	js     802eef <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e9f:	4c 89 e6             	mov    %r12,%rsi
+  802ea2:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ea9:	00 00 00 
+  802eac:	48 89 df             	mov    %rbx,%rdi
+  802eaf:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  802eb6:	00 00 00 
+  802eb9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ebb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ec2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ec6:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ecb:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802ed2:	00 00 00 
+  802ed5:	ff d0                	call   *%rax
+  802ed7:	89 c3                	mov    %eax,%ebx
+  802ed9:	85 c0                	test   %eax,%eax
+  802edb:	78 1f                	js     802efc <open+0x9e>
+    return fd2num(fd);
+  802edd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ee1:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+  802eed:	89 c3                	mov    %eax,%ebx
+}
+  802eef:	89 d8                	mov    %ebx,%eax
+  802ef1:	48 83 c4 18          	add    $0x18,%rsp
+  802ef5:	5b                   	pop    %rbx
+  802ef6:	41 5c                	pop    %r12
+  802ef8:	41 5d                	pop    %r13
+  802efa:	5d                   	pop    %rbp
+  802efb:	c3                   	ret
+        fd_close(fd, 0);
+  802efc:	be 00 00 00 00       	mov    $0x0,%esi
+  802f01:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f05:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  802f0c:	00 00 00 
+  802f0f:	ff d0                	call   *%rax
+        return res;
+  802f11:	eb dc                	jmp    802eef <open+0x91>
+        return -E_BAD_PATH;
+  802f13:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f18:	eb d5                	jmp    802eef <open+0x91>
+
+0000000000802f1a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f1a:	55                   	push   %rbp
+  802f1b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f23:	bf 13 00 00 00       	mov    $0x13,%edi
+  802f28:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+}
+  802f34:	5d                   	pop    %rbp
+  802f35:	c3                   	ret
+
+0000000000802f36 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802f36:	55                   	push   %rbp
+  802f37:	48 89 e5             	mov    %rsp,%rbp
+  802f3a:	41 54                	push   %r12
+  802f3c:	53                   	push   %rbx
+  802f3d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f40:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802f4f:	48 be 80 41 80 00 00 	movabs $0x804180,%rsi
+  802f56:	00 00 00 
+  802f59:	48 89 df             	mov    %rbx,%rdi
+  802f5c:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802f68:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f6d:	41 2b 04 24          	sub    (%r12),%eax
+  802f71:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802f77:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802f7e:	00 00 00 
+    stat->st_dev = &devpipe;
+  802f81:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802f88:	00 00 00 
+  802f8b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f97:	5b                   	pop    %rbx
+  802f98:	41 5c                	pop    %r12
+  802f9a:	5d                   	pop    %rbp
+  802f9b:	c3                   	ret
+
+0000000000802f9c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f9c:	55                   	push   %rbp
+  802f9d:	48 89 e5             	mov    %rsp,%rbp
+  802fa0:	41 54                	push   %r12
+  802fa2:	53                   	push   %rbx
+  802fa3:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fa6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fab:	48 89 fe             	mov    %rdi,%rsi
+  802fae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb3:	49 bc 7b 15 80 00 00 	movabs $0x80157b,%r12
+  802fba:	00 00 00 
+  802fbd:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802fc0:	48 89 df             	mov    %rbx,%rdi
+  802fc3:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  802fca:	00 00 00 
+  802fcd:	ff d0                	call   *%rax
+  802fcf:	48 89 c6             	mov    %rax,%rsi
+  802fd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fdc:	41 ff d4             	call   *%r12
+}
+  802fdf:	5b                   	pop    %rbx
+  802fe0:	41 5c                	pop    %r12
+  802fe2:	5d                   	pop    %rbp
+  802fe3:	c3                   	ret
+
+0000000000802fe4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802fe4:	55                   	push   %rbp
+  802fe5:	48 89 e5             	mov    %rsp,%rbp
+  802fe8:	41 57                	push   %r15
+  802fea:	41 56                	push   %r14
+  802fec:	41 55                	push   %r13
+  802fee:	41 54                	push   %r12
+  802ff0:	53                   	push   %rbx
+  802ff1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff5:	49 89 fc             	mov    %rdi,%r12
+  802ff8:	49 89 f5             	mov    %rsi,%r13
+  802ffb:	49 89 d7             	mov    %rdx,%r15
+  802ffe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803002:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80300e:	4d 85 ff             	test   %r15,%r15
+  803011:	0f 84 af 00 00 00    	je     8030c6 <devpipe_write+0xe2>
+  803017:	48 89 c3             	mov    %rax,%rbx
+  80301a:	4c 89 f8             	mov    %r15,%rax
+  80301d:	4d 89 ef             	mov    %r13,%r15
+  803020:	4c 01 e8             	add    %r13,%rax
+  803023:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803027:	49 bd 83 14 80 00 00 	movabs $0x801483,%r13
+  80302e:	00 00 00 
+            sys_yield();
+  803031:	49 be 20 14 80 00 00 	movabs $0x801420,%r14
+  803038:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80303b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80303e:	48 63 ce             	movslq %esi,%rcx
+  803041:	48 63 03             	movslq (%rbx),%rax
+  803044:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80304a:	48 39 c1             	cmp    %rax,%rcx
+  80304d:	72 2e                	jb     80307d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80304f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803054:	48 89 da             	mov    %rbx,%rdx
+  803057:	be 00 10 00 00       	mov    $0x1000,%esi
+  80305c:	4c 89 e7             	mov    %r12,%rdi
+  80305f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803062:	85 c0                	test   %eax,%eax
+  803064:	74 66                	je     8030cc <devpipe_write+0xe8>
+            sys_yield();
+  803066:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803069:	8b 73 04             	mov    0x4(%rbx),%esi
+  80306c:	48 63 ce             	movslq %esi,%rcx
+  80306f:	48 63 03             	movslq (%rbx),%rax
+  803072:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803078:	48 39 c1             	cmp    %rax,%rcx
+  80307b:	73 d2                	jae    80304f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80307d:	41 0f b6 3f          	movzbl (%r15),%edi
+  803081:	48 89 ca             	mov    %rcx,%rdx
+  803084:	48 c1 ea 03          	shr    $0x3,%rdx
+  803088:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80308f:	08 10 20 
+  803092:	48 f7 e2             	mul    %rdx
+  803095:	48 c1 ea 06          	shr    $0x6,%rdx
+  803099:	48 89 d0             	mov    %rdx,%rax
+  80309c:	48 c1 e0 09          	shl    $0x9,%rax
+  8030a0:	48 29 d0             	sub    %rdx,%rax
+  8030a3:	48 c1 e0 03          	shl    $0x3,%rax
+  8030a7:	48 29 c1             	sub    %rax,%rcx
+  8030aa:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8030af:	83 c6 01             	add    $0x1,%esi
+  8030b2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030b5:	49 83 c7 01          	add    $0x1,%r15
+  8030b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030bd:	49 39 c7             	cmp    %rax,%r15
+  8030c0:	0f 85 75 ff ff ff    	jne    80303b <devpipe_write+0x57>
+    return n;
+  8030c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030ca:	eb 05                	jmp    8030d1 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8030cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d1:	48 83 c4 18          	add    $0x18,%rsp
+  8030d5:	5b                   	pop    %rbx
+  8030d6:	41 5c                	pop    %r12
+  8030d8:	41 5d                	pop    %r13
+  8030da:	41 5e                	pop    %r14
+  8030dc:	41 5f                	pop    %r15
+  8030de:	5d                   	pop    %rbp
+  8030df:	c3                   	ret
+
+00000000008030e0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030e0:	55                   	push   %rbp
+  8030e1:	48 89 e5             	mov    %rsp,%rbp
+  8030e4:	41 57                	push   %r15
+  8030e6:	41 56                	push   %r14
+  8030e8:	41 55                	push   %r13
+  8030ea:	41 54                	push   %r12
+  8030ec:	53                   	push   %rbx
+  8030ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8030f1:	49 89 fc             	mov    %rdi,%r12
+  8030f4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030fc:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803103:	00 00 00 
+  803106:	ff d0                	call   *%rax
+  803108:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80310b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803111:	49 bd 83 14 80 00 00 	movabs $0x801483,%r13
+  803118:	00 00 00 
+            sys_yield();
+  80311b:	49 be 20 14 80 00 00 	movabs $0x801420,%r14
+  803122:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803125:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80312a:	74 7d                	je     8031a9 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80312c:	8b 03                	mov    (%rbx),%eax
+  80312e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803131:	75 26                	jne    803159 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803133:	4d 85 ff             	test   %r15,%r15
+  803136:	75 77                	jne    8031af <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803138:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80313d:	48 89 da             	mov    %rbx,%rdx
+  803140:	be 00 10 00 00       	mov    $0x1000,%esi
+  803145:	4c 89 e7             	mov    %r12,%rdi
+  803148:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80314b:	85 c0                	test   %eax,%eax
+  80314d:	74 72                	je     8031c1 <devpipe_read+0xe1>
+            sys_yield();
+  80314f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803152:	8b 03                	mov    (%rbx),%eax
+  803154:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803157:	74 df                	je     803138 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803159:	48 63 c8             	movslq %eax,%rcx
+  80315c:	48 89 ca             	mov    %rcx,%rdx
+  80315f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803163:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80316a:	08 10 20 
+  80316d:	48 89 d0             	mov    %rdx,%rax
+  803170:	48 f7 e6             	mul    %rsi
+  803173:	48 c1 ea 06          	shr    $0x6,%rdx
+  803177:	48 89 d0             	mov    %rdx,%rax
+  80317a:	48 c1 e0 09          	shl    $0x9,%rax
+  80317e:	48 29 d0             	sub    %rdx,%rax
+  803181:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803188:	00 
+  803189:	48 89 c8             	mov    %rcx,%rax
+  80318c:	48 29 d0             	sub    %rdx,%rax
+  80318f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803194:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803198:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80319c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80319f:	49 83 c7 01          	add    $0x1,%r15
+  8031a3:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8031a7:	75 83                	jne    80312c <devpipe_read+0x4c>
+    return n;
+  8031a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ad:	eb 03                	jmp    8031b2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8031af:	4c 89 f8             	mov    %r15,%rax
+}
+  8031b2:	48 83 c4 18          	add    $0x18,%rsp
+  8031b6:	5b                   	pop    %rbx
+  8031b7:	41 5c                	pop    %r12
+  8031b9:	41 5d                	pop    %r13
+  8031bb:	41 5e                	pop    %r14
+  8031bd:	41 5f                	pop    %r15
+  8031bf:	5d                   	pop    %rbp
+  8031c0:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8031c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c6:	eb ea                	jmp    8031b2 <devpipe_read+0xd2>
+
+00000000008031c8 <pipe>:
+pipe(int pfd[2]) {
+  8031c8:	55                   	push   %rbp
+  8031c9:	48 89 e5             	mov    %rsp,%rbp
+  8031cc:	41 55                	push   %r13
+  8031ce:	41 54                	push   %r12
+  8031d0:	53                   	push   %rbx
+  8031d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8031d5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8031d8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031dc:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  8031e3:	00 00 00 
+  8031e6:	ff d0                	call   *%rax
+  8031e8:	89 c3                	mov    %eax,%ebx
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	0f 88 a0 01 00 00    	js     803392 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8031f2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031fc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803200:	bf 00 00 00 00       	mov    $0x0,%edi
+  803205:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  80320c:	00 00 00 
+  80320f:	ff d0                	call   *%rax
+  803211:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803213:	85 c0                	test   %eax,%eax
+  803215:	0f 88 77 01 00 00    	js     803392 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80321b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80321f:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  803226:	00 00 00 
+  803229:	ff d0                	call   *%rax
+  80322b:	89 c3                	mov    %eax,%ebx
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	0f 88 43 01 00 00    	js     803378 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803235:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80323a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80323f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803243:	bf 00 00 00 00       	mov    $0x0,%edi
+  803248:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  80324f:	00 00 00 
+  803252:	ff d0                	call   *%rax
+  803254:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803256:	85 c0                	test   %eax,%eax
+  803258:	0f 88 1a 01 00 00    	js     803378 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80325e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803262:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803269:	00 00 00 
+  80326c:	ff d0                	call   *%rax
+  80326e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803271:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803276:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80327b:	48 89 c6             	mov    %rax,%rsi
+  80327e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803283:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+  80328f:	89 c3                	mov    %eax,%ebx
+  803291:	85 c0                	test   %eax,%eax
+  803293:	0f 88 c5 00 00 00    	js     80335e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803299:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80329d:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	48 89 c1             	mov    %rax,%rcx
+  8032ac:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8032b2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032bd:	4c 89 ee             	mov    %r13,%rsi
+  8032c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c5:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8032cc:	00 00 00 
+  8032cf:	ff d0                	call   *%rax
+  8032d1:	89 c3                	mov    %eax,%ebx
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	78 6e                	js     803345 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032dc:	4c 89 ef             	mov    %r13,%rdi
+  8032df:	48 b8 51 14 80 00 00 	movabs $0x801451,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+  8032eb:	83 f8 02             	cmp    $0x2,%eax
+  8032ee:	0f 85 ab 00 00 00    	jne    80339f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8032f4:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8032fb:	00 00 
+  8032fd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803301:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803303:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803307:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80330e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803312:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803314:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803318:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80331f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803323:	48 bb 8e 19 80 00 00 	movabs $0x80198e,%rbx
+  80332a:	00 00 00 
+  80332d:	ff d3                	call   *%rbx
+  80332f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803333:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803337:	ff d3                	call   *%rbx
+  803339:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80333e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803343:	eb 4d                	jmp    803392 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803345:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80334a:	4c 89 ee             	mov    %r13,%rsi
+  80334d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803352:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  803359:	00 00 00 
+  80335c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80335e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803363:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803367:	bf 00 00 00 00       	mov    $0x0,%edi
+  80336c:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  803373:	00 00 00 
+  803376:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803378:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80337d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803381:	bf 00 00 00 00       	mov    $0x0,%edi
+  803386:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  80338d:	00 00 00 
+  803390:	ff d0                	call   *%rax
+}
+  803392:	89 d8                	mov    %ebx,%eax
+  803394:	48 83 c4 18          	add    $0x18,%rsp
+  803398:	5b                   	pop    %rbx
+  803399:	41 5c                	pop    %r12
+  80339b:	41 5d                	pop    %r13
+  80339d:	5d                   	pop    %rbp
+  80339e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80339f:	48 b9 b0 41 80 00 00 	movabs $0x8041b0,%rcx
+  8033a6:	00 00 00 
+  8033a9:	48 ba 87 41 80 00 00 	movabs $0x804187,%rdx
+  8033b0:	00 00 00 
+  8033b3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033b8:	48 bf 9c 41 80 00 00 	movabs $0x80419c,%rdi
+  8033bf:	00 00 00 
+  8033c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c7:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8033ce:	00 00 00 
+  8033d1:	41 ff d0             	call   *%r8
+
+00000000008033d4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8033d4:	55                   	push   %rbp
+  8033d5:	48 89 e5             	mov    %rsp,%rbp
+  8033d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033e0:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  8033e7:	00 00 00 
+  8033ea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	78 35                	js     803425 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8033f0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033f4:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+  803400:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803403:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803408:	be 00 10 00 00       	mov    $0x1000,%esi
+  80340d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803411:	48 b8 83 14 80 00 00 	movabs $0x801483,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+  80341d:	85 c0                	test   %eax,%eax
+  80341f:	0f 94 c0             	sete   %al
+  803422:	0f b6 c0             	movzbl %al,%eax
+}
+  803425:	c9                   	leave
+  803426:	c3                   	ret
+
+0000000000803427 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803427:	48 89 f8             	mov    %rdi,%rax
+  80342a:	48 c1 e8 27          	shr    $0x27,%rax
+  80342e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803435:	01 00 00 
+  803438:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80343c:	f6 c2 01             	test   $0x1,%dl
+  80343f:	74 6d                	je     8034ae <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803441:	48 89 f8             	mov    %rdi,%rax
+  803444:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803448:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80344f:	01 00 00 
+  803452:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803456:	f6 c2 01             	test   $0x1,%dl
+  803459:	74 62                	je     8034bd <get_uvpt_entry+0x96>
+  80345b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803462:	01 00 00 
+  803465:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803469:	f6 c2 80             	test   $0x80,%dl
+  80346c:	75 4f                	jne    8034bd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80346e:	48 89 f8             	mov    %rdi,%rax
+  803471:	48 c1 e8 15          	shr    $0x15,%rax
+  803475:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80347c:	01 00 00 
+  80347f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803483:	f6 c2 01             	test   $0x1,%dl
+  803486:	74 44                	je     8034cc <get_uvpt_entry+0xa5>
+  803488:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80348f:	01 00 00 
+  803492:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803496:	f6 c2 80             	test   $0x80,%dl
+  803499:	75 31                	jne    8034cc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80349b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80349f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034a6:	01 00 00 
+  8034a9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034ad:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034ae:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034b5:	01 00 00 
+  8034b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034bc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034bd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034c4:	01 00 00 
+  8034c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034cb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034cc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034d3:	01 00 00 
+  8034d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034da:	c3                   	ret
+
+00000000008034db <get_prot>:
+
+int
+get_prot(void *va) {
+  8034db:	55                   	push   %rbp
+  8034dc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034df:	48 b8 27 34 80 00 00 	movabs $0x803427,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+  8034eb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034ee:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034f3:	89 c1                	mov    %eax,%ecx
+  8034f5:	83 c9 04             	or     $0x4,%ecx
+  8034f8:	f6 c2 01             	test   $0x1,%dl
+  8034fb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034fe:	89 c1                	mov    %eax,%ecx
+  803500:	83 c9 02             	or     $0x2,%ecx
+  803503:	f6 c2 02             	test   $0x2,%dl
+  803506:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803509:	89 c1                	mov    %eax,%ecx
+  80350b:	83 c9 01             	or     $0x1,%ecx
+  80350e:	48 85 d2             	test   %rdx,%rdx
+  803511:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803514:	89 c1                	mov    %eax,%ecx
+  803516:	83 c9 40             	or     $0x40,%ecx
+  803519:	f6 c6 04             	test   $0x4,%dh
+  80351c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80351f:	5d                   	pop    %rbp
+  803520:	c3                   	ret
+
+0000000000803521 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803521:	55                   	push   %rbp
+  803522:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803525:	48 b8 27 34 80 00 00 	movabs $0x803427,%rax
+  80352c:	00 00 00 
+  80352f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803531:	48 c1 e8 06          	shr    $0x6,%rax
+  803535:	83 e0 01             	and    $0x1,%eax
+}
+  803538:	5d                   	pop    %rbp
+  803539:	c3                   	ret
+
+000000000080353a <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80353a:	55                   	push   %rbp
+  80353b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80353e:	48 b8 27 34 80 00 00 	movabs $0x803427,%rax
+  803545:	00 00 00 
+  803548:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80354a:	48 c1 e8 05          	shr    $0x5,%rax
+  80354e:	83 e0 01             	and    $0x1,%eax
+}
+  803551:	5d                   	pop    %rbp
+  803552:	c3                   	ret
+
+0000000000803553 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803553:	55                   	push   %rbp
+  803554:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803557:	48 b8 27 34 80 00 00 	movabs $0x803427,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+  803563:	83 e0 01             	and    $0x1,%eax
+}
+  803566:	5d                   	pop    %rbp
+  803567:	c3                   	ret
+
+0000000000803568 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 57                	push   %r15
+  80356e:	41 56                	push   %r14
+  803570:	41 55                	push   %r13
+  803572:	41 54                	push   %r12
+  803574:	53                   	push   %rbx
+  803575:	48 83 ec 18          	sub    $0x18,%rsp
+  803579:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80357d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803581:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803586:	49 bd 53 35 80 00 00 	movabs $0x803553,%r13
+  80358d:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803590:	49 bf db 34 80 00 00 	movabs $0x8034db,%r15
+  803597:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80359a:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8035a1:	00 00 00 
+  8035a4:	eb 0c                	jmp    8035b2 <foreach_shared_region+0x4a>
+  8035a6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035ad:	4c 39 f3             	cmp    %r14,%rbx
+  8035b0:	74 2e                	je     8035e0 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8035b2:	48 89 df             	mov    %rbx,%rdi
+  8035b5:	41 ff d5             	call   *%r13
+  8035b8:	84 c0                	test   %al,%al
+  8035ba:	74 ea                	je     8035a6 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8035bc:	48 89 df             	mov    %rbx,%rdi
+  8035bf:	41 ff d7             	call   *%r15
+  8035c2:	a8 40                	test   $0x40,%al
+  8035c4:	74 e0                	je     8035a6 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8035c6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8035cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035d1:	48 89 df             	mov    %rbx,%rdi
+  8035d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d8:	ff d0                	call   *%rax
+				if (res < 0) {
+  8035da:	85 c0                	test   %eax,%eax
+  8035dc:	79 c8                	jns    8035a6 <foreach_shared_region+0x3e>
+  8035de:	eb 05                	jmp    8035e5 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8035e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035e5:	48 83 c4 18          	add    $0x18,%rsp
+  8035e9:	5b                   	pop    %rbx
+  8035ea:	41 5c                	pop    %r12
+  8035ec:	41 5d                	pop    %r13
+  8035ee:	41 5e                	pop    %r14
+  8035f0:	41 5f                	pop    %r15
+  8035f2:	5d                   	pop    %rbp
+  8035f3:	c3                   	ret
+
+00000000008035f4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8035f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f9:	c3                   	ret
+
+00000000008035fa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8035fa:	55                   	push   %rbp
+  8035fb:	48 89 e5             	mov    %rsp,%rbp
+  8035fe:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803601:	48 be d4 41 80 00 00 	movabs $0x8041d4,%rsi
+  803608:	00 00 00 
+  80360b:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+    return 0;
+}
+  803617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361c:	5d                   	pop    %rbp
+  80361d:	c3                   	ret
+
+000000000080361e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80361e:	55                   	push   %rbp
+  80361f:	48 89 e5             	mov    %rsp,%rbp
+  803622:	41 57                	push   %r15
+  803624:	41 56                	push   %r14
+  803626:	41 55                	push   %r13
+  803628:	41 54                	push   %r12
+  80362a:	53                   	push   %rbx
+  80362b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803632:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803639:	48 85 d2             	test   %rdx,%rdx
+  80363c:	74 7a                	je     8036b8 <devcons_write+0x9a>
+  80363e:	49 89 d6             	mov    %rdx,%r14
+  803641:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803647:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80364c:	49 bf 1d 10 80 00 00 	movabs $0x80101d,%r15
+  803653:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803656:	4c 89 f3             	mov    %r14,%rbx
+  803659:	48 29 f3             	sub    %rsi,%rbx
+  80365c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803661:	48 39 c3             	cmp    %rax,%rbx
+  803664:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803668:	4c 63 eb             	movslq %ebx,%r13
+  80366b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803672:	48 01 c6             	add    %rax,%rsi
+  803675:	4c 89 ea             	mov    %r13,%rdx
+  803678:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80367f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803682:	4c 89 ee             	mov    %r13,%rsi
+  803685:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80368c:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803698:	41 01 dc             	add    %ebx,%r12d
+  80369b:	49 63 f4             	movslq %r12d,%rsi
+  80369e:	4c 39 f6             	cmp    %r14,%rsi
+  8036a1:	72 b3                	jb     803656 <devcons_write+0x38>
+    return res;
+  8036a3:	49 63 c4             	movslq %r12d,%rax
+}
+  8036a6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8036ad:	5b                   	pop    %rbx
+  8036ae:	41 5c                	pop    %r12
+  8036b0:	41 5d                	pop    %r13
+  8036b2:	41 5e                	pop    %r14
+  8036b4:	41 5f                	pop    %r15
+  8036b6:	5d                   	pop    %rbp
+  8036b7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8036b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036be:	eb e3                	jmp    8036a3 <devcons_write+0x85>
+
+00000000008036c0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036c0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8036c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c8:	48 85 c0             	test   %rax,%rax
+  8036cb:	74 55                	je     803722 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8036cd:	55                   	push   %rbp
+  8036ce:	48 89 e5             	mov    %rsp,%rbp
+  8036d1:	41 55                	push   %r13
+  8036d3:	41 54                	push   %r12
+  8036d5:	53                   	push   %rbx
+  8036d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8036da:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8036dd:	48 bb 53 13 80 00 00 	movabs $0x801353,%rbx
+  8036e4:	00 00 00 
+  8036e7:	49 bc 20 14 80 00 00 	movabs $0x801420,%r12
+  8036ee:	00 00 00 
+  8036f1:	eb 03                	jmp    8036f6 <devcons_read+0x36>
+  8036f3:	41 ff d4             	call   *%r12
+  8036f6:	ff d3                	call   *%rbx
+  8036f8:	85 c0                	test   %eax,%eax
+  8036fa:	74 f7                	je     8036f3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8036fc:	48 63 d0             	movslq %eax,%rdx
+  8036ff:	78 13                	js     803714 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803701:	ba 00 00 00 00       	mov    $0x0,%edx
+  803706:	83 f8 04             	cmp    $0x4,%eax
+  803709:	74 09                	je     803714 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80370b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80370f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803714:	48 89 d0             	mov    %rdx,%rax
+  803717:	48 83 c4 08          	add    $0x8,%rsp
+  80371b:	5b                   	pop    %rbx
+  80371c:	41 5c                	pop    %r12
+  80371e:	41 5d                	pop    %r13
+  803720:	5d                   	pop    %rbp
+  803721:	c3                   	ret
+  803722:	48 89 d0             	mov    %rdx,%rax
+  803725:	c3                   	ret
+
+0000000000803726 <cputchar>:
+cputchar(int ch) {
+  803726:	55                   	push   %rbp
+  803727:	48 89 e5             	mov    %rsp,%rbp
+  80372a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80372e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803732:	be 01 00 00 00       	mov    $0x1,%esi
+  803737:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80373b:	48 b8 26 13 80 00 00 	movabs $0x801326,%rax
+  803742:	00 00 00 
+  803745:	ff d0                	call   *%rax
+}
+  803747:	c9                   	leave
+  803748:	c3                   	ret
+
+0000000000803749 <getchar>:
+getchar(void) {
+  803749:	55                   	push   %rbp
+  80374a:	48 89 e5             	mov    %rsp,%rbp
+  80374d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803751:	ba 01 00 00 00       	mov    $0x1,%edx
+  803756:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80375a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80375f:	48 b8 ff 1c 80 00 00 	movabs $0x801cff,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+  80376b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80376d:	85 c0                	test   %eax,%eax
+  80376f:	78 06                	js     803777 <getchar+0x2e>
+  803771:	74 08                	je     80377b <getchar+0x32>
+  803773:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803777:	89 d0                	mov    %edx,%eax
+  803779:	c9                   	leave
+  80377a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80377b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803780:	eb f5                	jmp    803777 <getchar+0x2e>
+
+0000000000803782 <iscons>:
+iscons(int fdnum) {
+  803782:	55                   	push   %rbp
+  803783:	48 89 e5             	mov    %rsp,%rbp
+  803786:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80378a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80378e:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  803795:	00 00 00 
+  803798:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80379a:	85 c0                	test   %eax,%eax
+  80379c:	78 18                	js     8037b6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80379e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037a2:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8037a9:	00 00 00 
+  8037ac:	8b 00                	mov    (%rax),%eax
+  8037ae:	39 02                	cmp    %eax,(%rdx)
+  8037b0:	0f 94 c0             	sete   %al
+  8037b3:	0f b6 c0             	movzbl %al,%eax
+}
+  8037b6:	c9                   	leave
+  8037b7:	c3                   	ret
+
+00000000008037b8 <opencons>:
+opencons(void) {
+  8037b8:	55                   	push   %rbp
+  8037b9:	48 89 e5             	mov    %rsp,%rbp
+  8037bc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037c0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8037c4:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  8037cb:	00 00 00 
+  8037ce:	ff d0                	call   *%rax
+  8037d0:	85 c0                	test   %eax,%eax
+  8037d2:	78 49                	js     80381d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8037d4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037de:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8037e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e7:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+  8037f3:	85 c0                	test   %eax,%eax
+  8037f5:	78 26                	js     80381d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8037f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037fb:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803802:	00 00 
+  803804:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803806:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80380a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803811:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  803818:	00 00 00 
+  80381b:	ff d0                	call   *%rax
+}
+  80381d:	c9                   	leave
+  80381e:	c3                   	ret
+
+000000000080381f <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80381f:	55                   	push   %rbp
+  803820:	48 89 e5             	mov    %rsp,%rbp
+  803823:	41 55                	push   %r13
+  803825:	41 54                	push   %r12
+  803827:	53                   	push   %rbx
+  803828:	48 83 ec 08          	sub    $0x8,%rsp
+  80382c:	49 89 fc             	mov    %rdi,%r12
+  80382f:	48 89 f7             	mov    %rsi,%rdi
+  803832:	48 89 d3             	mov    %rdx,%rbx
+  803835:	49 89 cd             	mov    %rcx,%r13
+  803838:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80383b:	48 85 f6             	test   %rsi,%rsi
+  80383e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803845:	00 00 00 
+  803848:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  80384c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803851:	48 85 db             	test   %rbx,%rbx
+  803854:	74 03                	je     803859 <ipc_recv_timed+0x3a>
+  803856:	48 8b 33             	mov    (%rbx),%rsi
+  803859:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+    if (res < 0) {
+  803865:	85 c0                	test   %eax,%eax
+  803867:	78 75                	js     8038de <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803869:	4d 85 e4             	test   %r12,%r12
+  80386c:	74 14                	je     803882 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80386e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803875:	00 00 00 
+  803878:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80387e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803882:	4d 85 ed             	test   %r13,%r13
+  803885:	74 14                	je     80389b <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803887:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80388e:	00 00 00 
+  803891:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803897:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  80389b:	48 85 db             	test   %rbx,%rbx
+  80389e:	74 23                	je     8038c3 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8038a0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038a7:	00 00 00 
+  8038aa:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8038b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b5:	85 c9                	test   %ecx,%ecx
+  8038b7:	74 07                	je     8038c0 <ipc_recv_timed+0xa1>
+  8038b9:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8038c0:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8038c3:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038ca:	00 00 00 
+  8038cd:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8038d3:	48 83 c4 08          	add    $0x8,%rsp
+  8038d7:	5b                   	pop    %rbx
+  8038d8:	41 5c                	pop    %r12
+  8038da:	41 5d                	pop    %r13
+  8038dc:	5d                   	pop    %rbp
+  8038dd:	c3                   	ret
+        if (from_env_store != NULL) {
+  8038de:	4d 85 e4             	test   %r12,%r12
+  8038e1:	74 08                	je     8038eb <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8038e3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038ea:	00 
+        if (perm_store != NULL) {
+  8038eb:	4d 85 ed             	test   %r13,%r13
+  8038ee:	74 08                	je     8038f8 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8038f0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8038f7:	00 
+        if (size != NULL) {
+  8038f8:	48 85 db             	test   %rbx,%rbx
+  8038fb:	74 d6                	je     8038d3 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8038fd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803904:	eb cd                	jmp    8038d3 <ipc_recv_timed+0xb4>
+
+0000000000803906 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803906:	55                   	push   %rbp
+  803907:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  80390a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803910:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	5d                   	pop    %rbp
+  80391d:	c3                   	ret
+
+000000000080391e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80391e:	55                   	push   %rbp
+  80391f:	48 89 e5             	mov    %rsp,%rbp
+  803922:	41 57                	push   %r15
+  803924:	41 56                	push   %r14
+  803926:	41 55                	push   %r13
+  803928:	41 54                	push   %r12
+  80392a:	53                   	push   %rbx
+  80392b:	48 83 ec 18          	sub    $0x18,%rsp
+  80392f:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803932:	48 89 d3             	mov    %rdx,%rbx
+  803935:	49 89 cc             	mov    %rcx,%r12
+  803938:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80393b:	48 85 d2             	test   %rdx,%rdx
+  80393e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803945:	00 00 00 
+  803948:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80394c:	89 f0                	mov    %esi,%eax
+  80394e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803952:	48 89 da             	mov    %rbx,%rdx
+  803955:	48 89 c6             	mov    %rax,%rsi
+  803958:	48 b8 1d 17 80 00 00 	movabs $0x80171d,%rax
+  80395f:	00 00 00 
+  803962:	ff d0                	call   *%rax
+    while (res < 0) {
+  803964:	85 c0                	test   %eax,%eax
+  803966:	79 65                	jns    8039cd <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803968:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80396b:	75 33                	jne    8039a0 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80396d:	49 bf 20 14 80 00 00 	movabs $0x801420,%r15
+  803974:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803977:	49 be 1d 17 80 00 00 	movabs $0x80171d,%r14
+  80397e:	00 00 00 
+        sys_yield();
+  803981:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803984:	45 89 e8             	mov    %r13d,%r8d
+  803987:	4c 89 e1             	mov    %r12,%rcx
+  80398a:	48 89 da             	mov    %rbx,%rdx
+  80398d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803991:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803994:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803997:	85 c0                	test   %eax,%eax
+  803999:	79 32                	jns    8039cd <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  80399b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80399e:	74 e1                	je     803981 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8039a0:	89 c1                	mov    %eax,%ecx
+  8039a2:	48 ba e0 41 80 00 00 	movabs $0x8041e0,%rdx
+  8039a9:	00 00 00 
+  8039ac:	be 52 00 00 00       	mov    $0x52,%esi
+  8039b1:	48 bf f4 41 80 00 00 	movabs $0x8041f4,%rdi
+  8039b8:	00 00 00 
+  8039bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c0:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8039c7:	00 00 00 
+  8039ca:	41 ff d0             	call   *%r8
+    }
+}
+  8039cd:	48 83 c4 18          	add    $0x18,%rsp
+  8039d1:	5b                   	pop    %rbx
+  8039d2:	41 5c                	pop    %r12
+  8039d4:	41 5d                	pop    %r13
+  8039d6:	41 5e                	pop    %r14
+  8039d8:	41 5f                	pop    %r15
+  8039da:	5d                   	pop    %rbp
+  8039db:	c3                   	ret
+
+00000000008039dc <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8039dc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8039e1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8039e8:	00 00 00 
+  8039eb:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039ef:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039f3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039f7:	48 01 ca             	add    %rcx,%rdx
+  8039fa:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803a00:	39 fa                	cmp    %edi,%edx
+  803a02:	74 12                	je     803a16 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803a04:	48 83 c0 01          	add    $0x1,%rax
+  803a08:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803a0e:	75 db                	jne    8039eb <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a15:	c3                   	ret
+            return envs[i].env_id;
+  803a16:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803a1a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803a1e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a22:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803a29:	00 00 00 
+  803a2c:	48 01 d0             	add    %rdx,%rax
+  803a2f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a35:	c3                   	ret
+  803a36:	66 90                	xchg   %ax,%ax
+
+0000000000803a38 <__rodata_start>:
+  803a38:	74 65                	je     803a9f <__rodata_start+0x67>
+  803a3a:	73 74                	jae    803ab0 <__rodata_start+0x78>
+  803a3c:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  803a43:	20 70 69             	and    %dh,0x69(%rax)
+  803a46:	70 65                	jo     803aad <__rodata_start+0x75>
+  803a48:	69 73 63 6c 6f 73 65 	imul   $0x65736f6c,0x63(%rbx),%esi
+  803a4f:	64 20 72 61          	and    %dh,%fs:0x61(%rdx)
+  803a53:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  803a56:	2e 2e 0a 00          	cs cs or (%rax),%al
+  803a5a:	00 00                	add    %al,(%rax)
+  803a5c:	00 00                	add    %al,(%rax)
+  803a5e:	00 00                	add    %al,(%rax)
+  803a60:	73 6f                	jae    803ad1 <__rodata_start+0x99>
+  803a62:	6d                   	insl   (%dx),%es:(%rdi)
+  803a63:	65 68 6f 77 20 74    	gs push $0x7420776f
+  803a69:	68 65 20 6f 74       	push   $0x746f2065
+  803a6e:	68 65 72 20 65       	push   $0x65207265
+  803a73:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a74:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803a78:	20 70 5b             	and    %dh,0x5b(%rax)
+  803a7b:	30 5d 20             	xor    %bl,0x20(%rbp)
+  803a7e:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803a80:	74 20                	je     803aa2 <__rodata_start+0x6a>
+  803a82:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  803a86:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  803a8a:	70 69                	jo     803af5 <__rodata_start+0xbd>
+  803a8c:	70 65                	jo     803af3 <__rodata_start+0xbb>
+  803a8e:	3a 20                	cmp    (%rax),%ah
+  803a90:	25 69 00 75 73       	and    $0x73750069,%eax
+  803a95:	65 72 2f             	gs jb  803ac7 <__rodata_start+0x8f>
+  803a98:	74 65                	je     803aff <__rodata_start+0xc7>
+  803a9a:	73 74                	jae    803b10 <__rodata_start+0xd8>
+  803a9c:	70 69                	jo     803b07 <__rodata_start+0xcf>
+  803a9e:	70 65                	jo     803b05 <__rodata_start+0xcd>
+  803aa0:	72 61                	jb     803b03 <__rodata_start+0xcb>
+  803aa2:	63 65 32             	movsxd 0x32(%rbp),%esp
+  803aa5:	2e 63 00             	cs movsxd (%rax),%eax
+  803aa8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803aaa:	72 6b                	jb     803b17 <__rodata_start+0xdf>
+  803aac:	3a 20                	cmp    (%rax),%ah
+  803aae:	25 69 00 25 64       	and    $0x64250069,%eax
+  803ab3:	2e 00 0a             	cs add %cl,(%rdx)
+  803ab6:	52                   	push   %rdx
+  803ab7:	41                   	rex.B
+  803ab8:	43                   	rex.XB
+  803ab9:	45 3a 20             	cmp    (%r8),%r12b
+  803abc:	70 69                	jo     803b27 <__rodata_start+0xef>
+  803abe:	70 65                	jo     803b25 <__rodata_start+0xed>
+  803ac0:	20 61 70             	and    %ah,0x70(%rcx)
+  803ac3:	70 65                	jo     803b2a <__rodata_start+0xf2>
+  803ac5:	61                   	(bad)
+  803ac6:	72 73                	jb     803b3b <__rodata_start+0x103>
+  803ac8:	20 63 6c             	and    %ah,0x6c(%rbx)
+  803acb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acc:	73 65                	jae    803b33 <__rodata_start+0xfb>
+  803ace:	64 0a 00             	or     %fs:(%rax),%al
+  803ad1:	63 68 69             	movsxd 0x69(%rax),%ebp
+  803ad4:	6c                   	insb   (%dx),%es:(%rdi)
+  803ad5:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  803ada:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  803ade:	74 68                	je     803b48 <__rodata_start+0x110>
+  803ae0:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  803ae4:	70 0a                	jo     803af0 <__rodata_start+0xb8>
+  803ae6:	00 63 61             	add    %ah,0x61(%rbx)
+  803ae9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aec:	74 20                	je     803b0e <__rodata_start+0xd6>
+  803aee:	6c                   	insb   (%dx),%es:(%rdi)
+  803aef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af1:	6b 20 75             	imul   $0x75,(%rax),%esp
+  803af4:	70 20                	jo     803b16 <__rodata_start+0xde>
+  803af6:	70 5b                	jo     803b53 <__rodata_start+0x11b>
+  803af8:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  803afb:	20 25 69 00 72 61    	and    %ah,0x61720069(%rip)        # 61f23b6a <__bss_end+0x6171ab6a>
+  803b01:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b04:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  803b0b:	68 61 
+  803b0d:	70 70                	jo     803b7f <__rodata_start+0x147>
+  803b0f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b11:	0a 00                	or     (%rax),%al
+  803b13:	3c 75                	cmp    $0x75,%al
+  803b15:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b16:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803b1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1b:	3e 00 0f             	ds add %cl,(%rdi)
+  803b1e:	1f                   	(bad)
+  803b1f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803b22:	30 38                	xor    %bh,(%rax)
+  803b24:	78 5d                	js     803b83 <__rodata_start+0x14b>
+  803b26:	20 75 73             	and    %dh,0x73(%rbp)
+  803b29:	65 72 20             	gs jb  803b4c <__rodata_start+0x114>
+  803b2c:	70 61                	jo     803b8f <__rodata_start+0x157>
+  803b2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b2f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803b36:	73 20                	jae    803b58 <__rodata_start+0x120>
+  803b38:	61                   	(bad)
+  803b39:	74 20                	je     803b5b <__rodata_start+0x123>
+  803b3b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b40:	3a 20                	cmp    (%rax),%ah
+  803b42:	00 30                	add    %dh,(%rax)
+  803b44:	31 32                	xor    %esi,(%rdx)
+  803b46:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b4d:	41                   	rex.B
+  803b4e:	42                   	rex.X
+  803b4f:	43                   	rex.XB
+  803b50:	44                   	rex.R
+  803b51:	45                   	rex.RB
+  803b52:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b55:	31 32                	xor    %esi,(%rdx)
+  803b57:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b5e:	61                   	(bad)
+  803b5f:	62 63 64 65 66       	(bad)
+  803b64:	00 28                	add    %ch,(%rax)
+  803b66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b67:	75 6c                	jne    803bd5 <__rodata_start+0x19d>
+  803b69:	6c                   	insb   (%dx),%es:(%rdi)
+  803b6a:	29 00                	sub    %eax,(%rax)
+  803b6c:	65 72 72             	gs jb  803be1 <__rodata_start+0x1a9>
+  803b6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b70:	72 20                	jb     803b92 <__rodata_start+0x15a>
+  803b72:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b77:	73 70                	jae    803be9 <__rodata_start+0x1b1>
+  803b79:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b7d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b85:	72 00                	jb     803b87 <__rodata_start+0x14f>
+  803b87:	62 61 64 20 65       	(bad)
+  803b8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b8d:	76 69                	jbe    803bf8 <__rodata_start+0x1c0>
+  803b8f:	72 6f                	jb     803c00 <__rodata_start+0x1c8>
+  803b91:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b92:	6d                   	insl   (%dx),%es:(%rdi)
+  803b93:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b95:	74 00                	je     803b97 <__rodata_start+0x15f>
+  803b97:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b9e:	20 70 61             	and    %dh,0x61(%rax)
+  803ba1:	72 61                	jb     803c04 <__rodata_start+0x1cc>
+  803ba3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ba4:	65 74 65             	gs je  803c0c <__rodata_start+0x1d4>
+  803ba7:	72 00                	jb     803ba9 <__rodata_start+0x171>
+  803ba9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803baa:	75 74                	jne    803c20 <__rodata_start+0x1e8>
+  803bac:	20 6f 66             	and    %ch,0x66(%rdi)
+  803baf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803bb2:	6d                   	insl   (%dx),%es:(%rdi)
+  803bb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb4:	72 79                	jb     803c2f <__rodata_start+0x1f7>
+  803bb6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803bb9:	74 20                	je     803bdb <__rodata_start+0x1a3>
+  803bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803bc0:	76 69                	jbe    803c2b <__rodata_start+0x1f3>
+  803bc2:	72 6f                	jb     803c33 <__rodata_start+0x1fb>
+  803bc4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bc5:	6d                   	insl   (%dx),%es:(%rdi)
+  803bc6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bc8:	74 73                	je     803c3d <__rodata_start+0x205>
+  803bca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803bcd:	72 72                	jb     803c41 <__rodata_start+0x209>
+  803bcf:	75 70                	jne    803c41 <__rodata_start+0x209>
+  803bd1:	74 65                	je     803c38 <__rodata_start+0x200>
+  803bd3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803bd8:	75 67                	jne    803c41 <__rodata_start+0x209>
+  803bda:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803bdd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bdf:	00 73 65             	add    %dh,0x65(%rbx)
+  803be2:	67 6d                	insl   (%dx),%es:(%edi)
+  803be4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803be6:	74 61                	je     803c49 <__rodata_start+0x211>
+  803be8:	74 69                	je     803c53 <__rodata_start+0x21b>
+  803bea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803beb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bec:	20 66 61             	and    %ah,0x61(%rsi)
+  803bef:	75 6c                	jne    803c5d <__rodata_start+0x225>
+  803bf1:	74 00                	je     803bf3 <__rodata_start+0x1bb>
+  803bf3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bfa:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bfd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c01:	61                   	(bad)
+  803c02:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c07:	20 73 75             	and    %dh,0x75(%rbx)
+  803c0a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c0d:	73 79                	jae    803c88 <__rodata_start+0x250>
+  803c0f:	73 74                	jae    803c85 <__rodata_start+0x24d>
+  803c11:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c13:	20 63 61             	and    %ah,0x61(%rbx)
+  803c16:	6c                   	insb   (%dx),%es:(%rdi)
+  803c17:	6c                   	insb   (%dx),%es:(%rdi)
+  803c18:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803c1b:	74 72                	je     803c8f <__rodata_start+0x257>
+  803c1d:	79 20                	jns    803c3f <__rodata_start+0x207>
+  803c1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c21:	74 20                	je     803c43 <__rodata_start+0x20b>
+  803c23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c25:	75 6e                	jne    803c95 <__rodata_start+0x25d>
+  803c27:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803c2b:	76 20                	jbe    803c4d <__rodata_start+0x215>
+  803c2d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803c34:	72 65                	jb     803c9b <__rodata_start+0x263>
+  803c36:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803c39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c3a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803c3e:	65 78 70             	gs js  803cb1 <__rodata_start+0x279>
+  803c41:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c46:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c49:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c4d:	20 66 69             	and    %ah,0x69(%rsi)
+  803c50:	6c                   	insb   (%dx),%es:(%rdi)
+  803c51:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c55:	20 66 72             	and    %ah,0x72(%rsi)
+  803c58:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c5d:	61                   	(bad)
+  803c5e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c63:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c67:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c70:	79 20                	jns    803c92 <__rodata_start+0x25a>
+  803c72:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c79:	72 65                	jb     803ce0 <__rodata_start+0x2a8>
+  803c7b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c80:	00 66 69             	add    %ah,0x69(%rsi)
+  803c83:	6c                   	insb   (%dx),%es:(%rdi)
+  803c84:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c88:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c8c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c91:	74 20                	je     803cb3 <__rodata_start+0x27b>
+  803c93:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c95:	75 6e                	jne    803d05 <__rodata_start+0x2cd>
+  803c97:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c9b:	76 61                	jbe    803cfe <__rodata_start+0x2c6>
+  803c9d:	6c                   	insb   (%dx),%es:(%rdi)
+  803c9e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ca5:	00 
+  803ca6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803cad:	72 65                	jb     803d14 <__rodata_start+0x2dc>
+  803caf:	61                   	(bad)
+  803cb0:	64 79 20             	fs jns 803cd3 <__rodata_start+0x29b>
+  803cb3:	65 78 69             	gs js  803d1f <__rodata_start+0x2e7>
+  803cb6:	73 74                	jae    803d2c <__rodata_start+0x2f4>
+  803cb8:	73 00                	jae    803cba <__rodata_start+0x282>
+  803cba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cbb:	70 65                	jo     803d22 <__rodata_start+0x2ea>
+  803cbd:	72 61                	jb     803d20 <__rodata_start+0x2e8>
+  803cbf:	74 69                	je     803d2a <__rodata_start+0x2f2>
+  803cc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cc3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803cc6:	74 20                	je     803ce8 <__rodata_start+0x2b0>
+  803cc8:	73 75                	jae    803d3f <__rodata_start+0x307>
+  803cca:	70 70                	jo     803d3c <__rodata_start+0x304>
+  803ccc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ccd:	72 74                	jb     803d43 <__rodata_start+0x30b>
+  803ccf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803cd5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803cda:	74 00                	je     803cdc <__rodata_start+0x2a4>
+  803cdc:	0f 1f 40 00          	nopl   0x0(%rax)
+  803ce0:	eb 06                	jmp    803ce8 <__rodata_start+0x2b0>
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803cee:	00 00                	add    %al,(%rax)
+  803cf0:	1c 0d                	sbb    $0xd,%al
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803cfe:	00 00                	add    %al,(%rax)
+  803d00:	2c 0d                	sub    $0xd,%al
+  803d02:	80 00 00             	addb   $0x0,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803d0e:	00 00                	add    %al,(%rax)
+  803d10:	2c 0d                	sub    $0xd,%al
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 0a                	add    %cl,(%rdx)
+  803d19:	07                   	(bad)
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803d26:	00 00                	add    %al,(%rax)
+  803d28:	2c 0d                	sub    $0xd,%al
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 fe                	add    %bh,%dh
+  803d31:	06                   	(bad)
+  803d32:	80 00 00             	addb   $0x0,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 78 07             	add    %bh,0x7(%rax)
+  803d3a:	80 00 00             	addb   $0x0,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	fe 06                	incb   (%rsi)
+  803d4a:	80 00 00             	addb   $0x0,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d53:	00 00                	add    %al,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d5b:	00 00                	add    %al,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d63:	00 00                	add    %al,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d6b:	00 00                	add    %al,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d83:	00 00                	add    %al,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 44 07 80          	add    %al,-0x80(%rdi,%rax,1)
+  803d93:	00 00                	add    %al,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803d9e:	00 00                	add    %al,(%rax)
+  803da0:	2c 0d                	sub    $0xd,%al
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dae:	00 00                	add    %al,(%rax)
+  803db0:	2c 0d                	sub    $0xd,%al
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dbe:	00 00                	add    %al,(%rax)
+  803dc0:	2c 0d                	sub    $0xd,%al
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dce:	00 00                	add    %al,(%rax)
+  803dd0:	2c 0d                	sub    $0xd,%al
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dde:	00 00                	add    %al,(%rax)
+  803de0:	2c 0d                	sub    $0xd,%al
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dee:	00 00                	add    %al,(%rax)
+  803df0:	2c 0d                	sub    $0xd,%al
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803dfe:	00 00                	add    %al,(%rax)
+  803e00:	2c 0d                	sub    $0xd,%al
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e0e:	00 00                	add    %al,(%rax)
+  803e10:	2c 0d                	sub    $0xd,%al
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e1e:	00 00                	add    %al,(%rax)
+  803e20:	2c 0d                	sub    $0xd,%al
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e2e:	00 00                	add    %al,(%rax)
+  803e30:	2c 0d                	sub    $0xd,%al
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e3e:	00 00                	add    %al,(%rax)
+  803e40:	2c 0d                	sub    $0xd,%al
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e4e:	00 00                	add    %al,(%rax)
+  803e50:	2c 0d                	sub    $0xd,%al
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e5e:	00 00                	add    %al,(%rax)
+  803e60:	2c 0d                	sub    $0xd,%al
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e6e:	00 00                	add    %al,(%rax)
+  803e70:	2c 0d                	sub    $0xd,%al
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e7e:	00 00                	add    %al,(%rax)
+  803e80:	2c 0d                	sub    $0xd,%al
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 4f 0c             	add    %cl,0xc(%rdi)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803e96:	00 00                	add    %al,(%rax)
+  803e98:	2c 0d                	sub    $0xd,%al
+  803e9a:	80 00 00             	addb   $0x0,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803ea6:	00 00                	add    %al,(%rax)
+  803ea8:	2c 0d                	sub    $0xd,%al
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803eb6:	00 00                	add    %al,(%rax)
+  803eb8:	2c 0d                	sub    $0xd,%al
+  803eba:	80 00 00             	addb   $0x0,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803ec6:	00 00                	add    %al,(%rax)
+  803ec8:	2c 0d                	sub    $0xd,%al
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803ed6:	00 00                	add    %al,(%rax)
+  803ed8:	2c 0d                	sub    $0xd,%al
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 9b 07 80 00 00    	add    %bl,0x8007(%rbx)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 6a 09             	add    %ch,0x9(%rdx)
+  803eea:	80 00 00             	addb   $0x0,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803ef6:	00 00                	add    %al,(%rax)
+  803ef8:	2c 0d                	sub    $0xd,%al
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f06:	00 00                	add    %al,(%rax)
+  803f08:	2c 0d                	sub    $0xd,%al
+  803f0a:	80 00 00             	addb   $0x0,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 ca                	add    %cl,%dl
+  803f11:	07                   	(bad)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f1e:	00 00                	add    %al,(%rax)
+  803f20:	2c 0d                	sub    $0xd,%al
+  803f22:	80 00 00             	addb   $0x0,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 90 07 80 00 00    	add    %dl,0x8007(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f36:	00 00                	add    %al,(%rax)
+  803f38:	2c 0d                	sub    $0xd,%al
+  803f3a:	80 00 00             	addb   $0x0,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 12                	add    %dl,(%rdx)
+  803f41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f47:	00 dc                	add    %bl,%ah
+  803f49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f4f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f56:	00 00                	add    %al,(%rax)
+  803f58:	2c 0d                	sub    $0xd,%al
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 61 08             	add    %ah,0x8(%rcx)
+  803f62:	80 00 00             	addb   $0x0,(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f6e:	00 00                	add    %al,(%rax)
+  803f70:	3e 0a 80 00 00 00 00 	ds or  0x0(%rax),%al
+  803f77:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f7e:	00 00                	add    %al,(%rax)
+  803f80:	2c 0d                	sub    $0xd,%al
+  803f82:	80 00 00             	addb   $0x0,(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 4f 0c             	add    %cl,0xc(%rdi)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 2c 0d 80 00 00 00 	add    %ch,0x80(,%rcx,1)
+  803f96:	00 00                	add    %al,(%rax)
+  803f98:	f4                   	hlt
+  803f99:	06                   	(bad)
+  803f9a:	80 00 00             	addb   $0x0,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803fa0 <error_string>:
+	...
+  803fa8:	75 3b 80 00 00 00 00 00 87 3b 80 00 00 00 00 00     u;.......;......
+  803fb8:	97 3b 80 00 00 00 00 00 a9 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	b7 3b 80 00 00 00 00 00 cb 3b 80 00 00 00 00 00     .;.......;......
+  803fd8:	e0 3b 80 00 00 00 00 00 f3 3b 80 00 00 00 00 00     .;.......;......
+  803fe8:	05 3c 80 00 00 00 00 00 19 3c 80 00 00 00 00 00     .<.......<......
+  803ff8:	29 3c 80 00 00 00 00 00 3c 3c 80 00 00 00 00 00     )<......<<......
+  804008:	53 3c 80 00 00 00 00 00 69 3c 80 00 00 00 00 00     S<......i<......
+  804018:	81 3c 80 00 00 00 00 00 99 3c 80 00 00 00 00 00     .<.......<......
+  804028:	a6 3c 80 00 00 00 00 00 48 40 80 00 00 00 00 00     .<......H@......
+  804038:	ba 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804048:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804058:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804068:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804078:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804088:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804098:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8040a8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8040b8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  8040c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8040d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  8040e8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  8040f8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804108:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804118:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804128:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804138:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804148:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804158:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804160 <devtab>:
+  804160:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804170:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8041a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8041b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8041c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8041d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8041e0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8041f0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804200:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804210:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804220:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,8188 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 19 18 80 00 00 	movabs $0x801819,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 ce 3c 80 00 00 	movabs $0x803cce,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be a6 43 80 00 00 	movabs $0x8043a6,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 a0 43 80 00 00 	movabs $0x8043a0,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf dc 43 80 00 00 	movabs $0x8043dc,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba f7 43 80 00 00 	movabs $0x8043f7,%rdx
+  800117:	00 00 00 
+  80011a:	48 be fc 43 80 00 00 	movabs $0x8043fc,%rsi
+  800121:	00 00 00 
+  800124:	48 bf fb 43 80 00 00 	movabs $0x8043fb,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 d3 36 80 00 00 	movabs $0x8036d3,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 ce 3c 80 00 00 	movabs $0x803cce,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 61 0e 80 00 00 	movabs $0x800e61,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be a6 43 80 00 00 	movabs $0x8043a6,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 a0 43 80 00 00 	movabs $0x8043a0,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf 13 44 80 00 00 	movabs $0x804413,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba ac 43 80 00 00 	movabs $0x8043ac,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf bf 43 80 00 00 	movabs $0x8043bf,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba d3 43 80 00 00 	movabs $0x8043d3,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf bf 43 80 00 00 	movabs $0x8043bf,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba 09 44 80 00 00 	movabs $0x804409,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf bf 43 80 00 00 	movabs $0x8043bf,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	41 89 fd             	mov    %edi,%r13d
+  800285:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800288:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  80028f:	00 00 00 
+  800292:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  800299:	00 00 00 
+  80029c:	48 39 c2             	cmp    %rax,%rdx
+  80029f:	73 17                	jae    8002b8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a4:	49 89 c4             	mov    %rax,%r12
+  8002a7:	48 83 c3 08          	add    $0x8,%rbx
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b3:	4c 39 e3             	cmp    %r12,%rbx
+  8002b6:	72 ef                	jb     8002a7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8002b8:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c9:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8002cd:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8002d1:	48 c1 e0 04          	shl    $0x4,%rax
+  8002d5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002dc:	00 00 00 
+  8002df:	48 01 d0             	add    %rdx,%rax
+  8002e2:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002e9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002ec:	45 85 ed             	test   %r13d,%r13d
+  8002ef:	7e 0d                	jle    8002fe <libmain+0x87>
+  8002f1:	49 8b 06             	mov    (%r14),%rax
+  8002f4:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  8002fb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002fe:	4c 89 f6             	mov    %r14,%rsi
+  800301:	44 89 ef             	mov    %r13d,%edi
+  800304:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800310:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+#endif
+}
+  80031c:	5b                   	pop    %rbx
+  80031d:	41 5c                	pop    %r12
+  80031f:	41 5d                	pop    %r13
+  800321:	41 5e                	pop    %r14
+  800323:	5d                   	pop    %rbp
+  800324:	c3                   	ret
+
+0000000000800325 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800325:	55                   	push   %rbp
+  800326:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800329:	48 b8 4e 1b 80 00 00 	movabs $0x801b4e,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80033a:	48 b8 1e 13 80 00 00 	movabs $0x80131e,%rax
+  800341:	00 00 00 
+  800344:	ff d0                	call   *%rax
+}
+  800346:	5d                   	pop    %rbp
+  800347:	c3                   	ret
+
+0000000000800348 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	41 56                	push   %r14
+  80034e:	41 55                	push   %r13
+  800350:	41 54                	push   %r12
+  800352:	53                   	push   %rbx
+  800353:	48 83 ec 50          	sub    $0x50,%rsp
+  800357:	49 89 fc             	mov    %rdi,%r12
+  80035a:	41 89 f5             	mov    %esi,%r13d
+  80035d:	48 89 d3             	mov    %rdx,%rbx
+  800360:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800364:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800368:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80036c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800373:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800377:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80037b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80037f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800383:	48 b8 10 50 80 00 00 	movabs $0x805010,%rax
+  80038a:	00 00 00 
+  80038d:	4c 8b 30             	mov    (%rax),%r14
+  800390:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+  80039c:	89 c6                	mov    %eax,%esi
+  80039e:	45 89 e8             	mov    %r13d,%r8d
+  8003a1:	4c 89 e1             	mov    %r12,%rcx
+  8003a4:	4c 89 f2             	mov    %r14,%rdx
+  8003a7:	48 bf 58 44 80 00 00 	movabs $0x804458,%rdi
+  8003ae:	00 00 00 
+  8003b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b6:	49 bc 98 04 80 00 00 	movabs $0x800498,%r12
+  8003bd:	00 00 00 
+  8003c0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003c3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c7:	48 89 df             	mov    %rbx,%rdi
+  8003ca:	48 b8 34 04 80 00 00 	movabs $0x800434,%rax
+  8003d1:	00 00 00 
+  8003d4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003d6:	48 bf 3d 44 80 00 00 	movabs $0x80443d,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e8:	cc                   	int3
+  8003e9:	eb fd                	jmp    8003e8 <_panic+0xa0>
+
+00000000008003eb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	53                   	push   %rbx
+  8003f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003f4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f7:	8b 06                	mov    (%rsi),%eax
+  8003f9:	8d 50 01             	lea    0x1(%rax),%edx
+  8003fc:	89 16                	mov    %edx,(%rsi)
+  8003fe:	48 98                	cltq
+  800400:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800405:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80040b:	74 0a                	je     800417 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80040d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800411:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800417:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80041b:	be ff 00 00 00       	mov    $0xff,%esi
+  800420:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80042c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800432:	eb d9                	jmp    80040d <putch+0x22>
+
+0000000000800434 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+  800438:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80043f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800442:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800449:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80044e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800453:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800456:	48 89 f1             	mov    %rsi,%rcx
+  800459:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800460:	48 bf eb 03 80 00 00 	movabs $0x8003eb,%rdi
+  800467:	00 00 00 
+  80046a:	48 b8 e8 05 80 00 00 	movabs $0x8005e8,%rax
+  800471:	00 00 00 
+  800474:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800476:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80047d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800484:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  80048b:	00 00 00 
+  80048e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800490:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+
+0000000000800498 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800498:	55                   	push   %rbp
+  800499:	48 89 e5             	mov    %rsp,%rbp
+  80049c:	48 83 ec 50          	sub    $0x50,%rsp
+  8004a0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004a4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004ac:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004b0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004b4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004cb:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004cf:	48 b8 34 04 80 00 00 	movabs $0x800434,%rax
+  8004d6:	00 00 00 
+  8004d9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004db:	c9                   	leave
+  8004dc:	c3                   	ret
+
+00000000008004dd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004dd:	55                   	push   %rbp
+  8004de:	48 89 e5             	mov    %rsp,%rbp
+  8004e1:	41 57                	push   %r15
+  8004e3:	41 56                	push   %r14
+  8004e5:	41 55                	push   %r13
+  8004e7:	41 54                	push   %r12
+  8004e9:	53                   	push   %rbx
+  8004ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8004ee:	49 89 fc             	mov    %rdi,%r12
+  8004f1:	49 89 f5             	mov    %rsi,%r13
+  8004f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004fb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004fe:	41 89 cf             	mov    %ecx,%r15d
+  800501:	4c 39 fa             	cmp    %r15,%rdx
+  800504:	73 5b                	jae    800561 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800506:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80050a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80050e:	85 db                	test   %ebx,%ebx
+  800510:	7e 0e                	jle    800520 <print_num+0x43>
+            putch(padc, put_arg);
+  800512:	4c 89 ee             	mov    %r13,%rsi
+  800515:	44 89 f7             	mov    %r14d,%edi
+  800518:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80051b:	83 eb 01             	sub    $0x1,%ebx
+  80051e:	75 f2                	jne    800512 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800520:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800524:	48 b9 8c 44 80 00 00 	movabs $0x80448c,%rcx
+  80052b:	00 00 00 
+  80052e:	48 b8 7b 44 80 00 00 	movabs $0x80447b,%rax
+  800535:	00 00 00 
+  800538:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80053c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800540:	ba 00 00 00 00       	mov    $0x0,%edx
+  800545:	49 f7 f7             	div    %r15
+  800548:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80054c:	4c 89 ee             	mov    %r13,%rsi
+  80054f:	41 ff d4             	call   *%r12
+}
+  800552:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800556:	5b                   	pop    %rbx
+  800557:	41 5c                	pop    %r12
+  800559:	41 5d                	pop    %r13
+  80055b:	41 5e                	pop    %r14
+  80055d:	41 5f                	pop    %r15
+  80055f:	5d                   	pop    %rbp
+  800560:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800561:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056a:	49 f7 f7             	div    %r15
+  80056d:	48 83 ec 08          	sub    $0x8,%rsp
+  800571:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800575:	52                   	push   %rdx
+  800576:	45 0f be c9          	movsbl %r9b,%r9d
+  80057a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80057e:	48 89 c2             	mov    %rax,%rdx
+  800581:	48 b8 dd 04 80 00 00 	movabs $0x8004dd,%rax
+  800588:	00 00 00 
+  80058b:	ff d0                	call   *%rax
+  80058d:	48 83 c4 10          	add    $0x10,%rsp
+  800591:	eb 8d                	jmp    800520 <print_num+0x43>
+
+0000000000800593 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800593:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800597:	48 8b 06             	mov    (%rsi),%rax
+  80059a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80059e:	73 0a                	jae    8005aa <sprintputch+0x17>
+        *state->start++ = ch;
+  8005a0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005a4:	48 89 16             	mov    %rdx,(%rsi)
+  8005a7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005aa:	c3                   	ret
+
+00000000008005ab <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005ab:	55                   	push   %rbp
+  8005ac:	48 89 e5             	mov    %rsp,%rbp
+  8005af:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005bf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005d6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005da:	48 b8 e8 05 80 00 00 	movabs $0x8005e8,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+}
+  8005e6:	c9                   	leave
+  8005e7:	c3                   	ret
+
+00000000008005e8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e8:	55                   	push   %rbp
+  8005e9:	48 89 e5             	mov    %rsp,%rbp
+  8005ec:	41 57                	push   %r15
+  8005ee:	41 56                	push   %r14
+  8005f0:	41 55                	push   %r13
+  8005f2:	41 54                	push   %r12
+  8005f4:	53                   	push   %rbx
+  8005f5:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f9:	49 89 fe             	mov    %rdi,%r14
+  8005fc:	49 89 f5             	mov    %rsi,%r13
+  8005ff:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800602:	48 8b 01             	mov    (%rcx),%rax
+  800605:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800609:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80060d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800611:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800615:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800619:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80061d:	0f b6 3b             	movzbl (%rbx),%edi
+  800620:	40 80 ff 25          	cmp    $0x25,%dil
+  800624:	74 18                	je     80063e <vprintfmt+0x56>
+            if (!ch) return;
+  800626:	40 84 ff             	test   %dil,%dil
+  800629:	0f 84 b1 06 00 00    	je     800ce0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80062f:	40 0f b6 ff          	movzbl %dil,%edi
+  800633:	4c 89 ee             	mov    %r13,%rsi
+  800636:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800639:	4c 89 e3             	mov    %r12,%rbx
+  80063c:	eb db                	jmp    800619 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80063e:	be 00 00 00 00       	mov    $0x0,%esi
+  800643:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800647:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80064c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800652:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800659:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80065d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800662:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800667:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80066a:	83 e8 23             	sub    $0x23,%eax
+  80066d:	3c 57                	cmp    $0x57,%al
+  80066f:	0f 87 51 06 00 00    	ja     800cc6 <vprintfmt+0x6de>
+  800675:	0f b6 c0             	movzbl %al,%eax
+  800678:	48 b9 20 46 80 00 00 	movabs $0x804620,%rcx
+  80067f:	00 00 00 
+  800682:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800685:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800688:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80068c:	eb cf                	jmp    80065d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80068e:	49 89 dc             	mov    %rbx,%r12
+  800691:	be 01 00 00 00       	mov    $0x1,%esi
+  800696:	eb c5                	jmp    80065d <vprintfmt+0x75>
+            padc = ch;
+  800698:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80069c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80069f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a2:	eb b9                	jmp    80065d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006aa:	77 24                	ja     8006d0 <vprintfmt+0xe8>
+  8006ac:	89 c1                	mov    %eax,%ecx
+  8006ae:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006b2:	83 c0 08             	add    $0x8,%eax
+  8006b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006bb:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006be:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c2:	79 99                	jns    80065d <vprintfmt+0x75>
+                width = precision;
+  8006c4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006ce:	eb 8d                	jmp    80065d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006d4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	eb da                	jmp    8006b8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006de:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006e3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006ed:	3c 39                	cmp    $0x39,%al
+  8006ef:	77 1c                	ja     80070d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006f1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006f5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f9:	0f b6 c0             	movzbl %al,%eax
+  8006fc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800701:	0f b6 03             	movzbl (%rbx),%eax
+  800704:	3c 39                	cmp    $0x39,%al
+  800706:	76 e9                	jbe    8006f1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800708:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80070b:	eb b1                	jmp    8006be <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80070d:	49 89 dc             	mov    %rbx,%r12
+  800710:	eb ac                	jmp    8006be <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800712:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800715:	85 c9                	test   %ecx,%ecx
+  800717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071c:	0f 49 c1             	cmovns %ecx,%eax
+  80071f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800722:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800725:	e9 33 ff ff ff       	jmp    80065d <vprintfmt+0x75>
+            lflag++;
+  80072a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80072d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800730:	e9 28 ff ff ff       	jmp    80065d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800735:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800738:	83 f8 2f             	cmp    $0x2f,%eax
+  80073b:	77 19                	ja     800756 <vprintfmt+0x16e>
+  80073d:	89 c2                	mov    %eax,%edx
+  80073f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800743:	83 c0 08             	add    $0x8,%eax
+  800746:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800749:	8b 3a                	mov    (%rdx),%edi
+  80074b:	4c 89 ee             	mov    %r13,%rsi
+  80074e:	41 ff d6             	call   *%r14
+            break;
+  800751:	e9 c3 fe ff ff       	jmp    800619 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800756:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800762:	eb e5                	jmp    800749 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800764:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800767:	83 f8 2f             	cmp    $0x2f,%eax
+  80076a:	77 5a                	ja     8007c6 <vprintfmt+0x1de>
+  80076c:	89 c2                	mov    %eax,%edx
+  80076e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800772:	83 c0 08             	add    $0x8,%eax
+  800775:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800778:	8b 02                	mov    (%rdx),%eax
+  80077a:	89 c1                	mov    %eax,%ecx
+  80077c:	f7 d9                	neg    %ecx
+  80077e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800781:	83 f9 14             	cmp    $0x14,%ecx
+  800784:	7f 4e                	jg     8007d4 <vprintfmt+0x1ec>
+  800786:	48 63 c1             	movslq %ecx,%rax
+  800789:	48 ba e0 48 80 00 00 	movabs $0x8048e0,%rdx
+  800790:	00 00 00 
+  800793:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800797:	48 85 c0             	test   %rax,%rax
+  80079a:	74 38                	je     8007d4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80079c:	48 89 c1             	mov    %rax,%rcx
+  80079f:	48 ba ed 4b 80 00 00 	movabs $0x804bed,%rdx
+  8007a6:	00 00 00 
+  8007a9:	4c 89 ee             	mov    %r13,%rsi
+  8007ac:	4c 89 f7             	mov    %r14,%rdi
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	49 b8 ab 05 80 00 00 	movabs $0x8005ab,%r8
+  8007bb:	00 00 00 
+  8007be:	41 ff d0             	call   *%r8
+  8007c1:	e9 53 fe ff ff       	jmp    800619 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d2:	eb a4                	jmp    800778 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007d4:	48 ba a4 44 80 00 00 	movabs $0x8044a4,%rdx
+  8007db:	00 00 00 
+  8007de:	4c 89 ee             	mov    %r13,%rsi
+  8007e1:	4c 89 f7             	mov    %r14,%rdi
+  8007e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e9:	49 b8 ab 05 80 00 00 	movabs $0x8005ab,%r8
+  8007f0:	00 00 00 
+  8007f3:	41 ff d0             	call   *%r8
+  8007f6:	e9 1e fe ff ff       	jmp    800619 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800801:	77 6c                	ja     80086f <vprintfmt+0x287>
+  800803:	89 c2                	mov    %eax,%edx
+  800805:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800809:	83 c0 08             	add    $0x8,%eax
+  80080c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800812:	48 85 d2             	test   %rdx,%rdx
+  800815:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  80081c:	00 00 00 
+  80081f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800823:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800827:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80082b:	7e 06                	jle    800833 <vprintfmt+0x24b>
+  80082d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800831:	75 4a                	jne    80087d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800833:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800837:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80083b:	0f b6 00             	movzbl (%rax),%eax
+  80083e:	84 c0                	test   %al,%al
+  800840:	0f 85 9a 00 00 00    	jne    8008e0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800846:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800849:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80084d:	85 c0                	test   %eax,%eax
+  80084f:	0f 8e c4 fd ff ff    	jle    800619 <vprintfmt+0x31>
+  800855:	4c 89 ee             	mov    %r13,%rsi
+  800858:	bf 20 00 00 00       	mov    $0x20,%edi
+  80085d:	41 ff d6             	call   *%r14
+  800860:	41 83 ec 01          	sub    $0x1,%r12d
+  800864:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800868:	75 eb                	jne    800855 <vprintfmt+0x26d>
+  80086a:	e9 aa fd ff ff       	jmp    800619 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb 92                	jmp    80080f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80087d:	49 63 f7             	movslq %r15d,%rsi
+  800880:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800884:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  80088b:	00 00 00 
+  80088e:	ff d0                	call   *%rax
+  800890:	48 89 c2             	mov    %rax,%rdx
+  800893:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800896:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800898:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80089b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	7e 91                	jle    800833 <vprintfmt+0x24b>
+  8008a2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a7:	4c 89 ee             	mov    %r13,%rsi
+  8008aa:	44 89 e7             	mov    %r12d,%edi
+  8008ad:	41 ff d6             	call   *%r14
+  8008b0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008ba:	75 eb                	jne    8008a7 <vprintfmt+0x2bf>
+  8008bc:	e9 72 ff ff ff       	jmp    800833 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008c1:	0f b6 f8             	movzbl %al,%edi
+  8008c4:	4c 89 ee             	mov    %r13,%rsi
+  8008c7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ca:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008ce:	49 83 c4 01          	add    $0x1,%r12
+  8008d2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008d8:	84 c0                	test   %al,%al
+  8008da:	0f 84 66 ff ff ff    	je     800846 <vprintfmt+0x25e>
+  8008e0:	45 85 ff             	test   %r15d,%r15d
+  8008e3:	78 0a                	js     8008ef <vprintfmt+0x307>
+  8008e5:	41 83 ef 01          	sub    $0x1,%r15d
+  8008e9:	0f 88 57 ff ff ff    	js     800846 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ef:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008f3:	74 cc                	je     8008c1 <vprintfmt+0x2d9>
+  8008f5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008f8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008fd:	80 fa 5e             	cmp    $0x5e,%dl
+  800900:	77 c2                	ja     8008c4 <vprintfmt+0x2dc>
+  800902:	eb bd                	jmp    8008c1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800904:	40 84 f6             	test   %sil,%sil
+  800907:	75 26                	jne    80092f <vprintfmt+0x347>
+    switch (lflag) {
+  800909:	85 d2                	test   %edx,%edx
+  80090b:	74 59                	je     800966 <vprintfmt+0x37e>
+  80090d:	83 fa 01             	cmp    $0x1,%edx
+  800910:	74 7b                	je     80098d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800912:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800915:	83 f8 2f             	cmp    $0x2f,%eax
+  800918:	0f 87 96 00 00 00    	ja     8009b4 <vprintfmt+0x3cc>
+  80091e:	89 c2                	mov    %eax,%edx
+  800920:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800924:	83 c0 08             	add    $0x8,%eax
+  800927:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092a:	4c 8b 22             	mov    (%rdx),%r12
+  80092d:	eb 17                	jmp    800946 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	77 21                	ja     800958 <vprintfmt+0x370>
+  800937:	89 c2                	mov    %eax,%edx
+  800939:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093d:	83 c0 08             	add    $0x8,%eax
+  800940:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800943:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800946:	4d 85 e4             	test   %r12,%r12
+  800949:	78 7a                	js     8009c5 <vprintfmt+0x3dd>
+            num = i;
+  80094b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80094e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800953:	e9 50 02 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb dd                	jmp    800943 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 11                	ja     80097f <vprintfmt+0x397>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	4c 63 22             	movslq (%rdx),%r12
+  80097d:	eb c7                	jmp    800946 <vprintfmt+0x35e>
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb ed                	jmp    80097a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	77 11                	ja     8009a6 <vprintfmt+0x3be>
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099b:	83 c0 08             	add    $0x8,%eax
+  80099e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a1:	4c 8b 22             	mov    (%rdx),%r12
+  8009a4:	eb a0                	jmp    800946 <vprintfmt+0x35e>
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb ed                	jmp    8009a1 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c0:	e9 65 ff ff ff       	jmp    80092a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009c5:	4c 89 ee             	mov    %r13,%rsi
+  8009c8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009cd:	41 ff d6             	call   *%r14
+                i = -i;
+  8009d0:	49 f7 dc             	neg    %r12
+  8009d3:	e9 73 ff ff ff       	jmp    80094b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d8:	40 84 f6             	test   %sil,%sil
+  8009db:	75 32                	jne    800a0f <vprintfmt+0x427>
+    switch (lflag) {
+  8009dd:	85 d2                	test   %edx,%edx
+  8009df:	74 5d                	je     800a3e <vprintfmt+0x456>
+  8009e1:	83 fa 01             	cmp    $0x1,%edx
+  8009e4:	0f 84 82 00 00 00    	je     800a6c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	0f 87 a5 00 00 00    	ja     800a9b <vprintfmt+0x4b3>
+  8009f6:	89 c2                	mov    %eax,%edx
+  8009f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fc:	83 c0 08             	add    $0x8,%eax
+  8009ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a02:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a05:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a0a:	e9 99 01 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a12:	83 f8 2f             	cmp    $0x2f,%eax
+  800a15:	77 19                	ja     800a30 <vprintfmt+0x448>
+  800a17:	89 c2                	mov    %eax,%edx
+  800a19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1d:	83 c0 08             	add    $0x8,%eax
+  800a20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a23:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a2b:	e9 78 01 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+  800a30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3c:	eb e5                	jmp    800a23 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a41:	83 f8 2f             	cmp    $0x2f,%eax
+  800a44:	77 18                	ja     800a5e <vprintfmt+0x476>
+  800a46:	89 c2                	mov    %eax,%edx
+  800a48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4c:	83 c0 08             	add    $0x8,%eax
+  800a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a52:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a54:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a59:	e9 4a 01 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+  800a5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6a:	eb e6                	jmp    800a52 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a72:	77 19                	ja     800a8d <vprintfmt+0x4a5>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7a:	83 c0 08             	add    $0x8,%eax
+  800a7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a80:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a88:	e9 1b 01 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+  800a8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a99:	eb e5                	jmp    800a80 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	e9 56 ff ff ff       	jmp    800a02 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aac:	40 84 f6             	test   %sil,%sil
+  800aaf:	75 2e                	jne    800adf <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ab1:	85 d2                	test   %edx,%edx
+  800ab3:	74 59                	je     800b0e <vprintfmt+0x526>
+  800ab5:	83 fa 01             	cmp    $0x1,%edx
+  800ab8:	74 7f                	je     800b39 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800aba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac0:	0f 87 9f 00 00 00    	ja     800b65 <vprintfmt+0x57d>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ada:	e9 c9 00 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800adf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae5:	77 19                	ja     800b00 <vprintfmt+0x518>
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aed:	83 c0 08             	add    $0x8,%eax
+  800af0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800af6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800afb:	e9 a8 00 00 00       	jmp    800ba8 <vprintfmt+0x5c0>
+  800b00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0c:	eb e5                	jmp    800af3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b11:	83 f8 2f             	cmp    $0x2f,%eax
+  800b14:	77 15                	ja     800b2b <vprintfmt+0x543>
+  800b16:	89 c2                	mov    %eax,%edx
+  800b18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1c:	83 c0 08             	add    $0x8,%eax
+  800b1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b22:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b24:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b29:	eb 7d                	jmp    800ba8 <vprintfmt+0x5c0>
+  800b2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b37:	eb e9                	jmp    800b22 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3f:	77 16                	ja     800b57 <vprintfmt+0x56f>
+  800b41:	89 c2                	mov    %eax,%edx
+  800b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b47:	83 c0 08             	add    $0x8,%eax
+  800b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b50:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b55:	eb 51                	jmp    800ba8 <vprintfmt+0x5c0>
+  800b57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b63:	eb e8                	jmp    800b4d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b71:	e9 5c ff ff ff       	jmp    800ad2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b76:	4c 89 ee             	mov    %r13,%rsi
+  800b79:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b7e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b81:	4c 89 ee             	mov    %r13,%rsi
+  800b84:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b89:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b92:	77 47                	ja     800bdb <vprintfmt+0x5f3>
+  800b94:	89 c2                	mov    %eax,%edx
+  800b96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9a:	83 c0 08             	add    $0x8,%eax
+  800b9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ba8:	48 83 ec 08          	sub    $0x8,%rsp
+  800bac:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bb0:	0f 94 c0             	sete   %al
+  800bb3:	0f b6 c0             	movzbl %al,%eax
+  800bb6:	50                   	push   %rax
+  800bb7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bbc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bc0:	4c 89 ee             	mov    %r13,%rsi
+  800bc3:	4c 89 f7             	mov    %r14,%rdi
+  800bc6:	48 b8 dd 04 80 00 00 	movabs $0x8004dd,%rax
+  800bcd:	00 00 00 
+  800bd0:	ff d0                	call   *%rax
+            break;
+  800bd2:	48 83 c4 10          	add    $0x10,%rsp
+  800bd6:	e9 3e fa ff ff       	jmp    800619 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be7:	eb b7                	jmp    800ba0 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800be9:	40 84 f6             	test   %sil,%sil
+  800bec:	75 2b                	jne    800c19 <vprintfmt+0x631>
+    switch (lflag) {
+  800bee:	85 d2                	test   %edx,%edx
+  800bf0:	74 56                	je     800c48 <vprintfmt+0x660>
+  800bf2:	83 fa 01             	cmp    $0x1,%edx
+  800bf5:	74 7f                	je     800c76 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfd:	0f 87 a2 00 00 00    	ja     800ca5 <vprintfmt+0x6bd>
+  800c03:	89 c2                	mov    %eax,%edx
+  800c05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c09:	83 c0 08             	add    $0x8,%eax
+  800c0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c17:	eb 8f                	jmp    800ba8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1f:	77 19                	ja     800c3a <vprintfmt+0x652>
+  800c21:	89 c2                	mov    %eax,%edx
+  800c23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c27:	83 c0 08             	add    $0x8,%eax
+  800c2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c30:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c35:	e9 6e ff ff ff       	jmp    800ba8 <vprintfmt+0x5c0>
+  800c3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c46:	eb e5                	jmp    800c2d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4e:	77 18                	ja     800c68 <vprintfmt+0x680>
+  800c50:	89 c2                	mov    %eax,%edx
+  800c52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c56:	83 c0 08             	add    $0x8,%eax
+  800c59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c63:	e9 40 ff ff ff       	jmp    800ba8 <vprintfmt+0x5c0>
+  800c68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c74:	eb e6                	jmp    800c5c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 19                	ja     800c97 <vprintfmt+0x6af>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c92:	e9 11 ff ff ff       	jmp    800ba8 <vprintfmt+0x5c0>
+  800c97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca3:	eb e5                	jmp    800c8a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ca5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb1:	e9 59 ff ff ff       	jmp    800c0f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cb6:	4c 89 ee             	mov    %r13,%rsi
+  800cb9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cbe:	41 ff d6             	call   *%r14
+            break;
+  800cc1:	e9 53 f9 ff ff       	jmp    800619 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cc6:	4c 89 ee             	mov    %r13,%rsi
+  800cc9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cce:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cd1:	48 83 eb 01          	sub    $0x1,%rbx
+  800cd5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cd9:	75 f6                	jne    800cd1 <vprintfmt+0x6e9>
+  800cdb:	e9 39 f9 ff ff       	jmp    800619 <vprintfmt+0x31>
+}
+  800ce0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ce4:	5b                   	pop    %rbx
+  800ce5:	41 5c                	pop    %r12
+  800ce7:	41 5d                	pop    %r13
+  800ce9:	41 5e                	pop    %r14
+  800ceb:	41 5f                	pop    %r15
+  800ced:	5d                   	pop    %rbp
+  800cee:	c3                   	ret
+
+0000000000800cef <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cef:	55                   	push   %rbp
+  800cf0:	48 89 e5             	mov    %rsp,%rbp
+  800cf3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cf7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cfb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d04:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d0b:	48 85 ff             	test   %rdi,%rdi
+  800d0e:	74 2b                	je     800d3b <vsnprintf+0x4c>
+  800d10:	48 85 f6             	test   %rsi,%rsi
+  800d13:	74 26                	je     800d3b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d15:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d19:	48 bf 93 05 80 00 00 	movabs $0x800593,%rdi
+  800d20:	00 00 00 
+  800d23:	48 b8 e8 05 80 00 00 	movabs $0x8005e8,%rax
+  800d2a:	00 00 00 
+  800d2d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d33:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d36:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d39:	c9                   	leave
+  800d3a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d40:	eb f7                	jmp    800d39 <vsnprintf+0x4a>
+
+0000000000800d42 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d42:	55                   	push   %rbp
+  800d43:	48 89 e5             	mov    %rsp,%rbp
+  800d46:	48 83 ec 50          	sub    $0x50,%rsp
+  800d4a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d4e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d52:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d56:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d5d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d65:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d69:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d6d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d71:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d78:	00 00 00 
+  800d7b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d7d:	c9                   	leave
+  800d7e:	c3                   	ret
+
+0000000000800d7f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d7f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d82:	74 10                	je     800d94 <strlen+0x15>
+    size_t n = 0;
+  800d84:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d89:	48 83 c0 01          	add    $0x1,%rax
+  800d8d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d91:	75 f6                	jne    800d89 <strlen+0xa>
+  800d93:	c3                   	ret
+    size_t n = 0;
+  800d94:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d99:	c3                   	ret
+
+0000000000800d9a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d9a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800da2:	48 85 f6             	test   %rsi,%rsi
+  800da5:	74 11                	je     800db8 <strnlen+0x1e>
+  800da7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800dab:	74 0c                	je     800db9 <strnlen+0x1f>
+  800dad:	48 83 c2 01          	add    $0x1,%rdx
+  800db1:	48 39 d0             	cmp    %rdx,%rax
+  800db4:	75 f1                	jne    800da7 <strnlen+0xd>
+  800db6:	eb 04                	jmp    800dbc <strnlen+0x22>
+  800db8:	c3                   	ret
+  800db9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800dbc:	c3                   	ret
+
+0000000000800dbd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dbd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dc9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dcc:	48 83 c2 01          	add    $0x1,%rdx
+  800dd0:	84 c9                	test   %cl,%cl
+  800dd2:	75 f1                	jne    800dc5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800dd4:	c3                   	ret
+
+0000000000800dd5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dd5:	55                   	push   %rbp
+  800dd6:	48 89 e5             	mov    %rsp,%rbp
+  800dd9:	41 54                	push   %r12
+  800ddb:	53                   	push   %rbx
+  800ddc:	48 89 fb             	mov    %rdi,%rbx
+  800ddf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800de2:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800dee:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800df2:	4c 89 e6             	mov    %r12,%rsi
+  800df5:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  800dfc:	00 00 00 
+  800dff:	ff d0                	call   *%rax
+    return dst;
+}
+  800e01:	48 89 d8             	mov    %rbx,%rax
+  800e04:	5b                   	pop    %rbx
+  800e05:	41 5c                	pop    %r12
+  800e07:	5d                   	pop    %rbp
+  800e08:	c3                   	ret
+
+0000000000800e09 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e09:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e0c:	48 85 d2             	test   %rdx,%rdx
+  800e0f:	74 1f                	je     800e30 <strncpy+0x27>
+  800e11:	48 01 fa             	add    %rdi,%rdx
+  800e14:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e17:	48 83 c1 01          	add    $0x1,%rcx
+  800e1b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e1f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e23:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e27:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e2b:	48 39 ca             	cmp    %rcx,%rdx
+  800e2e:	75 e7                	jne    800e17 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e31:	48 89 f8             	mov    %rdi,%rax
+  800e34:	48 85 d2             	test   %rdx,%rdx
+  800e37:	74 24                	je     800e5d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e39:	48 83 ea 01          	sub    $0x1,%rdx
+  800e3d:	74 1b                	je     800e5a <strlcpy+0x29>
+  800e3f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e43:	0f b6 16             	movzbl (%rsi),%edx
+  800e46:	84 d2                	test   %dl,%dl
+  800e48:	74 10                	je     800e5a <strlcpy+0x29>
+            *dst++ = *src++;
+  800e4a:	48 83 c6 01          	add    $0x1,%rsi
+  800e4e:	48 83 c0 01          	add    $0x1,%rax
+  800e52:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e55:	48 39 c8             	cmp    %rcx,%rax
+  800e58:	75 e9                	jne    800e43 <strlcpy+0x12>
+        *dst = '\0';
+  800e5a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e5d:	48 29 f8             	sub    %rdi,%rax
+}
+  800e60:	c3                   	ret
+
+0000000000800e61 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e61:	0f b6 07             	movzbl (%rdi),%eax
+  800e64:	84 c0                	test   %al,%al
+  800e66:	74 13                	je     800e7b <strcmp+0x1a>
+  800e68:	38 06                	cmp    %al,(%rsi)
+  800e6a:	75 0f                	jne    800e7b <strcmp+0x1a>
+  800e6c:	48 83 c7 01          	add    $0x1,%rdi
+  800e70:	48 83 c6 01          	add    $0x1,%rsi
+  800e74:	0f b6 07             	movzbl (%rdi),%eax
+  800e77:	84 c0                	test   %al,%al
+  800e79:	75 ed                	jne    800e68 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e7b:	0f b6 c0             	movzbl %al,%eax
+  800e7e:	0f b6 16             	movzbl (%rsi),%edx
+  800e81:	29 d0                	sub    %edx,%eax
+}
+  800e83:	c3                   	ret
+
+0000000000800e84 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e84:	48 85 d2             	test   %rdx,%rdx
+  800e87:	74 1f                	je     800ea8 <strncmp+0x24>
+  800e89:	0f b6 07             	movzbl (%rdi),%eax
+  800e8c:	84 c0                	test   %al,%al
+  800e8e:	74 1e                	je     800eae <strncmp+0x2a>
+  800e90:	3a 06                	cmp    (%rsi),%al
+  800e92:	75 1a                	jne    800eae <strncmp+0x2a>
+  800e94:	48 83 c7 01          	add    $0x1,%rdi
+  800e98:	48 83 c6 01          	add    $0x1,%rsi
+  800e9c:	48 83 ea 01          	sub    $0x1,%rdx
+  800ea0:	75 e7                	jne    800e89 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea7:	c3                   	ret
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ead:	c3                   	ret
+  800eae:	48 85 d2             	test   %rdx,%rdx
+  800eb1:	74 09                	je     800ebc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eb3:	0f b6 07             	movzbl (%rdi),%eax
+  800eb6:	0f b6 16             	movzbl (%rsi),%edx
+  800eb9:	29 d0                	sub    %edx,%eax
+  800ebb:	c3                   	ret
+    if (!n) return 0;
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec1:	c3                   	ret
+
+0000000000800ec2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ec2:	0f b6 17             	movzbl (%rdi),%edx
+  800ec5:	84 d2                	test   %dl,%dl
+  800ec7:	74 18                	je     800ee1 <strchr+0x1f>
+        if (*str == c) {
+  800ec9:	0f be d2             	movsbl %dl,%edx
+  800ecc:	39 f2                	cmp    %esi,%edx
+  800ece:	74 17                	je     800ee7 <strchr+0x25>
+    for (; *str; str++) {
+  800ed0:	48 83 c7 01          	add    $0x1,%rdi
+  800ed4:	0f b6 17             	movzbl (%rdi),%edx
+  800ed7:	84 d2                	test   %dl,%dl
+  800ed9:	75 ee                	jne    800ec9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800edb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee0:	c3                   	ret
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	c3                   	ret
+  800ee7:	48 89 f8             	mov    %rdi,%rax
+}
+  800eea:	c3                   	ret
+
+0000000000800eeb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eeb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eee:	0f b6 17             	movzbl (%rdi),%edx
+  800ef1:	84 d2                	test   %dl,%dl
+  800ef3:	74 13                	je     800f08 <strfind+0x1d>
+  800ef5:	0f be d2             	movsbl %dl,%edx
+  800ef8:	39 f2                	cmp    %esi,%edx
+  800efa:	74 0b                	je     800f07 <strfind+0x1c>
+  800efc:	48 83 c0 01          	add    $0x1,%rax
+  800f00:	0f b6 10             	movzbl (%rax),%edx
+  800f03:	84 d2                	test   %dl,%dl
+  800f05:	75 ee                	jne    800ef5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f07:	c3                   	ret
+  800f08:	c3                   	ret
+
+0000000000800f09 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f09:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f0c:	48 89 f8             	mov    %rdi,%rax
+  800f0f:	48 f7 d8             	neg    %rax
+  800f12:	83 e0 07             	and    $0x7,%eax
+  800f15:	49 89 d1             	mov    %rdx,%r9
+  800f18:	49 29 c1             	sub    %rax,%r9
+  800f1b:	78 36                	js     800f53 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f1d:	40 0f b6 c6          	movzbl %sil,%eax
+  800f21:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f28:	01 01 01 
+  800f2b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f2f:	40 f6 c7 07          	test   $0x7,%dil
+  800f33:	75 38                	jne    800f6d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f35:	4c 89 c9             	mov    %r9,%rcx
+  800f38:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f3c:	74 0c                	je     800f4a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f3e:	fc                   	cld
+  800f3f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f42:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f46:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f4a:	4d 85 c9             	test   %r9,%r9
+  800f4d:	75 45                	jne    800f94 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f4f:	4c 89 c0             	mov    %r8,%rax
+  800f52:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f53:	48 85 d2             	test   %rdx,%rdx
+  800f56:	74 f7                	je     800f4f <memset+0x46>
+  800f58:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f5b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f5e:	48 83 c0 01          	add    $0x1,%rax
+  800f62:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f66:	48 39 c2             	cmp    %rax,%rdx
+  800f69:	75 f3                	jne    800f5e <memset+0x55>
+  800f6b:	eb e2                	jmp    800f4f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f6d:	40 f6 c7 01          	test   $0x1,%dil
+  800f71:	74 06                	je     800f79 <memset+0x70>
+  800f73:	88 07                	mov    %al,(%rdi)
+  800f75:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f79:	40 f6 c7 02          	test   $0x2,%dil
+  800f7d:	74 07                	je     800f86 <memset+0x7d>
+  800f7f:	66 89 07             	mov    %ax,(%rdi)
+  800f82:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f86:	40 f6 c7 04          	test   $0x4,%dil
+  800f8a:	74 a9                	je     800f35 <memset+0x2c>
+  800f8c:	89 07                	mov    %eax,(%rdi)
+  800f8e:	48 83 c7 04          	add    $0x4,%rdi
+  800f92:	eb a1                	jmp    800f35 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f94:	41 f6 c1 04          	test   $0x4,%r9b
+  800f98:	74 06                	je     800fa0 <memset+0x97>
+  800f9a:	89 07                	mov    %eax,(%rdi)
+  800f9c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fa0:	41 f6 c1 02          	test   $0x2,%r9b
+  800fa4:	74 07                	je     800fad <memset+0xa4>
+  800fa6:	66 89 07             	mov    %ax,(%rdi)
+  800fa9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fad:	41 f6 c1 01          	test   $0x1,%r9b
+  800fb1:	74 9c                	je     800f4f <memset+0x46>
+  800fb3:	88 07                	mov    %al,(%rdi)
+  800fb5:	eb 98                	jmp    800f4f <memset+0x46>
+
+0000000000800fb7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb7:	48 89 f8             	mov    %rdi,%rax
+  800fba:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fbd:	48 39 fe             	cmp    %rdi,%rsi
+  800fc0:	73 3b                	jae    800ffd <memmove+0x46>
+  800fc2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fc6:	48 39 d7             	cmp    %rdx,%rdi
+  800fc9:	73 32                	jae    800ffd <memmove+0x46>
+        s += n;
+        d += n;
+  800fcb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fcf:	48 89 d6             	mov    %rdx,%rsi
+  800fd2:	48 09 fe             	or     %rdi,%rsi
+  800fd5:	48 09 ce             	or     %rcx,%rsi
+  800fd8:	40 f6 c6 07          	test   $0x7,%sil
+  800fdc:	75 12                	jne    800ff0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fde:	48 83 ef 08          	sub    $0x8,%rdi
+  800fe2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fe6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fea:	fd                   	std
+  800feb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fee:	fc                   	cld
+  800fef:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ff0:	48 83 ef 01          	sub    $0x1,%rdi
+  800ff4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff8:	fd                   	std
+  800ff9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ffb:	eb f1                	jmp    800fee <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ffd:	48 89 f2             	mov    %rsi,%rdx
+  801000:	48 09 c2             	or     %rax,%rdx
+  801003:	48 09 ca             	or     %rcx,%rdx
+  801006:	f6 c2 07             	test   $0x7,%dl
+  801009:	75 0c                	jne    801017 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80100b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80100f:	48 89 c7             	mov    %rax,%rdi
+  801012:	fc                   	cld
+  801013:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801016:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801017:	48 89 c7             	mov    %rax,%rdi
+  80101a:	fc                   	cld
+  80101b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80101d:	c3                   	ret
+
+000000000080101e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80101e:	55                   	push   %rbp
+  80101f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801022:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  801029:	00 00 00 
+  80102c:	ff d0                	call   *%rax
+}
+  80102e:	5d                   	pop    %rbp
+  80102f:	c3                   	ret
+
+0000000000801030 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	41 57                	push   %r15
+  801036:	41 56                	push   %r14
+  801038:	41 55                	push   %r13
+  80103a:	41 54                	push   %r12
+  80103c:	53                   	push   %rbx
+  80103d:	48 83 ec 08          	sub    $0x8,%rsp
+  801041:	49 89 fe             	mov    %rdi,%r14
+  801044:	49 89 f7             	mov    %rsi,%r15
+  801047:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80104a:	48 89 f7             	mov    %rsi,%rdi
+  80104d:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801054:	00 00 00 
+  801057:	ff d0                	call   *%rax
+  801059:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80105c:	48 89 de             	mov    %rbx,%rsi
+  80105f:	4c 89 f7             	mov    %r14,%rdi
+  801062:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  801069:	00 00 00 
+  80106c:	ff d0                	call   *%rax
+  80106e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801071:	48 39 c3             	cmp    %rax,%rbx
+  801074:	74 36                	je     8010ac <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801076:	48 89 d8             	mov    %rbx,%rax
+  801079:	4c 29 e8             	sub    %r13,%rax
+  80107c:	49 39 c4             	cmp    %rax,%r12
+  80107f:	73 31                	jae    8010b2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801081:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801086:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80108a:	4c 89 fe             	mov    %r15,%rsi
+  80108d:	48 b8 1e 10 80 00 00 	movabs $0x80101e,%rax
+  801094:	00 00 00 
+  801097:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801099:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80109d:	48 83 c4 08          	add    $0x8,%rsp
+  8010a1:	5b                   	pop    %rbx
+  8010a2:	41 5c                	pop    %r12
+  8010a4:	41 5d                	pop    %r13
+  8010a6:	41 5e                	pop    %r14
+  8010a8:	41 5f                	pop    %r15
+  8010aa:	5d                   	pop    %rbp
+  8010ab:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010ac:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010b0:	eb eb                	jmp    80109d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010b2:	48 83 eb 01          	sub    $0x1,%rbx
+  8010b6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010ba:	48 89 da             	mov    %rbx,%rdx
+  8010bd:	4c 89 fe             	mov    %r15,%rsi
+  8010c0:	48 b8 1e 10 80 00 00 	movabs $0x80101e,%rax
+  8010c7:	00 00 00 
+  8010ca:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010cc:	49 01 de             	add    %rbx,%r14
+  8010cf:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010d4:	eb c3                	jmp    801099 <strlcat+0x69>
+
+00000000008010d6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010d6:	48 85 d2             	test   %rdx,%rdx
+  8010d9:	74 2d                	je     801108 <memcmp+0x32>
+  8010db:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010e0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010e4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e9:	44 38 c1             	cmp    %r8b,%cl
+  8010ec:	75 0f                	jne    8010fd <memcmp+0x27>
+    while (n-- > 0) {
+  8010ee:	48 83 c0 01          	add    $0x1,%rax
+  8010f2:	48 39 c2             	cmp    %rax,%rdx
+  8010f5:	75 e9                	jne    8010e0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010fd:	0f b6 c1             	movzbl %cl,%eax
+  801100:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801104:	44 29 c0             	sub    %r8d,%eax
+  801107:	c3                   	ret
+    return 0;
+  801108:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80110d:	c3                   	ret
+
+000000000080110e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80110e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801112:	48 39 c7             	cmp    %rax,%rdi
+  801115:	73 0f                	jae    801126 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801117:	40 38 37             	cmp    %sil,(%rdi)
+  80111a:	74 0e                	je     80112a <memfind+0x1c>
+    for (; src < end; src++) {
+  80111c:	48 83 c7 01          	add    $0x1,%rdi
+  801120:	48 39 f8             	cmp    %rdi,%rax
+  801123:	75 f2                	jne    801117 <memfind+0x9>
+  801125:	c3                   	ret
+  801126:	48 89 f8             	mov    %rdi,%rax
+  801129:	c3                   	ret
+  80112a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80112d:	c3                   	ret
+
+000000000080112e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80112e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801131:	0f b6 37             	movzbl (%rdi),%esi
+  801134:	40 80 fe 20          	cmp    $0x20,%sil
+  801138:	74 06                	je     801140 <strtol+0x12>
+  80113a:	40 80 fe 09          	cmp    $0x9,%sil
+  80113e:	75 13                	jne    801153 <strtol+0x25>
+  801140:	48 83 c7 01          	add    $0x1,%rdi
+  801144:	0f b6 37             	movzbl (%rdi),%esi
+  801147:	40 80 fe 20          	cmp    $0x20,%sil
+  80114b:	74 f3                	je     801140 <strtol+0x12>
+  80114d:	40 80 fe 09          	cmp    $0x9,%sil
+  801151:	74 ed                	je     801140 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801153:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801156:	83 e0 fd             	and    $0xfffffffd,%eax
+  801159:	3c 01                	cmp    $0x1,%al
+  80115b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80115f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801165:	75 0f                	jne    801176 <strtol+0x48>
+  801167:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80116a:	74 14                	je     801180 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80116c:	85 d2                	test   %edx,%edx
+  80116e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801173:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80117b:	4c 63 ca             	movslq %edx,%r9
+  80117e:	eb 36                	jmp    8011b6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801180:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801184:	74 0f                	je     801195 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801186:	85 d2                	test   %edx,%edx
+  801188:	75 ec                	jne    801176 <strtol+0x48>
+        s++;
+  80118a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80118e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801193:	eb e1                	jmp    801176 <strtol+0x48>
+        s += 2;
+  801195:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801199:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80119e:	eb d6                	jmp    801176 <strtol+0x48>
+            dig -= '0';
+  8011a0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011a3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a7:	41 39 d0             	cmp    %edx,%r8d
+  8011aa:	7d 21                	jge    8011cd <strtol+0x9f>
+        val = val * base + dig;
+  8011ac:	49 0f af c1          	imul   %r9,%rax
+  8011b0:	0f b6 c9             	movzbl %cl,%ecx
+  8011b3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011b6:	48 83 c7 01          	add    $0x1,%rdi
+  8011ba:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011be:	80 f9 39             	cmp    $0x39,%cl
+  8011c1:	76 dd                	jbe    8011a0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011c3:	80 f9 7b             	cmp    $0x7b,%cl
+  8011c6:	77 05                	ja     8011cd <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c8:	83 e9 57             	sub    $0x57,%ecx
+  8011cb:	eb d6                	jmp    8011a3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011cd:	4d 85 d2             	test   %r10,%r10
+  8011d0:	74 03                	je     8011d5 <strtol+0xa7>
+  8011d2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011d5:	48 89 c2             	mov    %rax,%rdx
+  8011d8:	48 f7 da             	neg    %rdx
+  8011db:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011df:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011e3:	c3                   	ret
+
+00000000008011e4 <strrev>:
+
+void
+strrev(char *str)
+{
+  8011e4:	55                   	push   %rbp
+  8011e5:	48 89 e5             	mov    %rsp,%rbp
+  8011e8:	53                   	push   %rbx
+  8011e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ed:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8011f0:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  8011f7:	00 00 00 
+  8011fa:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8011fc:	83 e8 01             	sub    $0x1,%eax
+  8011ff:	85 c0                	test   %eax,%eax
+  801201:	7e 22                	jle    801225 <strrev+0x41>
+  801203:	48 98                	cltq
+  801205:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80120a:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  80120e:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801212:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801216:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801219:	48 83 c2 01          	add    $0x1,%rdx
+  80121d:	48 83 e8 01          	sub    $0x1,%rax
+  801221:	39 c2                	cmp    %eax,%edx
+  801223:	7c e5                	jl     80120a <strrev+0x26>
+	}
+}
+  801225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+
+000000000080122b <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80122b:	85 d2                	test   %edx,%edx
+  80122d:	0f 84 80 00 00 00    	je     8012b3 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801233:	55                   	push   %rbp
+  801234:	48 89 e5             	mov    %rsp,%rbp
+  801237:	53                   	push   %rbx
+  801238:	48 83 ec 08          	sub    $0x8,%rsp
+  80123c:	49 89 f2             	mov    %rsi,%r10
+  80123f:	41 89 d3             	mov    %edx,%r11d
+  801242:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801245:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80124a:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80124d:	eb 20                	jmp    80126f <itoa+0x44>
+			str[i++] = '0' + digit;
+  80124f:	41 89 f1             	mov    %esi,%r9d
+  801252:	83 c2 30             	add    $0x30,%edx
+  801255:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801258:	89 f8                	mov    %edi,%eax
+  80125a:	99                   	cltd
+  80125b:	f7 f9                	idiv   %ecx
+  80125d:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	74 2e                	je     801291 <itoa+0x66>
+  801263:	83 c6 01             	add    $0x1,%esi
+  801266:	49 83 c0 01          	add    $0x1,%r8
+  80126a:	44 39 cb             	cmp    %r9d,%ebx
+  80126d:	7e 15                	jle    801284 <itoa+0x59>
+		digit = sum % base;
+  80126f:	89 f8                	mov    %edi,%eax
+  801271:	99                   	cltd
+  801272:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801274:	83 fa 09             	cmp    $0x9,%edx
+  801277:	7e d6                	jle    80124f <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801279:	41 89 f1             	mov    %esi,%r9d
+  80127c:	83 c2 37             	add    $0x37,%edx
+  80127f:	41 88 10             	mov    %dl,(%r8)
+  801282:	eb d4                	jmp    801258 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801284:	41 83 eb 01          	sub    $0x1,%r11d
+  801288:	45 39 cb             	cmp    %r9d,%r11d
+  80128b:	75 04                	jne    801291 <itoa+0x66>
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	75 28                	jne    8012b9 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801291:	4d 63 c9             	movslq %r9d,%r9
+  801294:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801299:	4c 89 d7             	mov    %r10,%rdi
+  80129c:	48 b8 e4 11 80 00 00 	movabs $0x8011e4,%rax
+  8012a3:	00 00 00 
+  8012a6:	ff d0                	call   *%rax
+	return 0;
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b1:	c9                   	leave
+  8012b2:	c3                   	ret
+		return -1;
+  8012b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8012b8:	c3                   	ret
+		return -1;
+  8012b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8012be:	eb ed                	jmp    8012ad <itoa+0x82>
+
+00000000008012c0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+  8012c4:	53                   	push   %rbx
+  8012c5:	48 89 fa             	mov    %rdi,%rdx
+  8012c8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cb:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012da:	be 00 00 00 00       	mov    $0x0,%esi
+  8012df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012eb:	c9                   	leave
+  8012ec:	c3                   	ret
+
+00000000008012ed <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012ed:	55                   	push   %rbp
+  8012ee:	48 89 e5             	mov    %rsp,%rbp
+  8012f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130b:	be 00 00 00 00       	mov    $0x0,%esi
+  801310:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801316:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801318:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+
+000000000080131e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80131e:	55                   	push   %rbp
+  80131f:	48 89 e5             	mov    %rsp,%rbp
+  801322:	53                   	push   %rbx
+  801323:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801327:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801334:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801339:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133e:	be 00 00 00 00       	mov    $0x0,%esi
+  801343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801349:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134b:	48 85 c0             	test   %rax,%rax
+  80134e:	7f 06                	jg     801356 <sys_env_destroy+0x38>
+}
+  801350:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801354:	c9                   	leave
+  801355:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801356:	49 89 c0             	mov    %rax,%r8
+  801359:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80135e:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  801365:	00 00 00 
+  801368:	be 26 00 00 00       	mov    $0x26,%esi
+  80136d:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  801374:	00 00 00 
+  801377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137c:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  801383:	00 00 00 
+  801386:	41 ff d1             	call   *%r9
+
+0000000000801389 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801389:	55                   	push   %rbp
+  80138a:	48 89 e5             	mov    %rsp,%rbp
+  80138d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801393:	ba 00 00 00 00       	mov    $0x0,%edx
+  801398:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b8:	c9                   	leave
+  8013b9:	c3                   	ret
+
+00000000008013ba <sys_yield>:
+
+void
+sys_yield(void) {
+  8013ba:	55                   	push   %rbp
+  8013bb:	48 89 e5             	mov    %rsp,%rbp
+  8013be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e9:	c9                   	leave
+  8013ea:	c3                   	ret
+
+00000000008013eb <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 89 fa             	mov    %rdi,%rdx
+  8013f3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fb:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801402:	00 00 00 
+  801405:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140a:	be 00 00 00 00       	mov    $0x0,%esi
+  80140f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801415:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801417:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+
+000000000080141d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+  801421:	53                   	push   %rbx
+  801422:	49 89 f8             	mov    %rdi,%r8
+  801425:	48 89 d3             	mov    %rdx,%rbx
+  801428:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80142b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801430:	4c 89 c2             	mov    %r8,%rdx
+  801433:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801436:	be 00 00 00 00       	mov    $0x0,%esi
+  80143b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801441:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801443:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801447:	c9                   	leave
+  801448:	c3                   	ret
+
+0000000000801449 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801449:	55                   	push   %rbp
+  80144a:	48 89 e5             	mov    %rsp,%rbp
+  80144d:	53                   	push   %rbx
+  80144e:	48 83 ec 08          	sub    $0x8,%rsp
+  801452:	89 f8                	mov    %edi,%eax
+  801454:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801457:	48 63 f9             	movslq %ecx,%rdi
+  80145a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801462:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801465:	be 00 00 00 00       	mov    $0x0,%esi
+  80146a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801470:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801472:	48 85 c0             	test   %rax,%rax
+  801475:	7f 06                	jg     80147d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147d:	49 89 c0             	mov    %rax,%r8
+  801480:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801485:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  80148c:	00 00 00 
+  80148f:	be 26 00 00 00       	mov    $0x26,%esi
+  801494:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  80149b:	00 00 00 
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a3:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  8014aa:	00 00 00 
+  8014ad:	41 ff d1             	call   *%r9
+
+00000000008014b0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014b0:	55                   	push   %rbp
+  8014b1:	48 89 e5             	mov    %rsp,%rbp
+  8014b4:	53                   	push   %rbx
+  8014b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b9:	89 f8                	mov    %edi,%eax
+  8014bb:	49 89 f2             	mov    %rsi,%r10
+  8014be:	48 89 cf             	mov    %rcx,%rdi
+  8014c1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014c4:	48 63 da             	movslq %edx,%rbx
+  8014c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cf:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d7:	48 85 c0             	test   %rax,%rax
+  8014da:	7f 06                	jg     8014e2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e2:	49 89 c0             	mov    %rax,%r8
+  8014e5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014ea:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  8014f1:	00 00 00 
+  8014f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f9:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  801500:	00 00 00 
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+  801508:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  80150f:	00 00 00 
+  801512:	41 ff d1             	call   *%r9
+
+0000000000801515 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	48 83 ec 08          	sub    $0x8,%rsp
+  80151e:	48 89 f1             	mov    %rsi,%rcx
+  801521:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801524:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801527:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153e:	48 85 c0             	test   %rax,%rax
+  801541:	7f 06                	jg     801549 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801543:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801547:	c9                   	leave
+  801548:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801549:	49 89 c0             	mov    %rax,%r8
+  80154c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801551:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  801558:	00 00 00 
+  80155b:	be 26 00 00 00       	mov    $0x26,%esi
+  801560:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  801567:	00 00 00 
+  80156a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156f:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  801576:	00 00 00 
+  801579:	41 ff d1             	call   *%r9
+
+000000000080157c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	53                   	push   %rbx
+  801581:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801585:	48 63 ce             	movslq %esi,%rcx
+  801588:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801590:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801595:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a7:	48 85 c0             	test   %rax,%rax
+  8015aa:	7f 06                	jg     8015b2 <sys_env_set_status+0x36>
+}
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b2:	49 89 c0             	mov    %rax,%r8
+  8015b5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015ba:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  8015c1:	00 00 00 
+  8015c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c9:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  8015d0:	00 00 00 
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d8:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  8015df:	00 00 00 
+  8015e2:	41 ff d1             	call   *%r9
+
+00000000008015e5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015e5:	55                   	push   %rbp
+  8015e6:	48 89 e5             	mov    %rsp,%rbp
+  8015e9:	53                   	push   %rbx
+  8015ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ee:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801603:	be 00 00 00 00       	mov    $0x0,%esi
+  801608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801610:	48 85 c0             	test   %rax,%rax
+  801613:	7f 06                	jg     80161b <sys_env_set_trapframe+0x36>
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161b:	49 89 c0             	mov    %rax,%r8
+  80161e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801623:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  80162a:	00 00 00 
+  80162d:	be 26 00 00 00       	mov    $0x26,%esi
+  801632:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  801639:	00 00 00 
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  801648:	00 00 00 
+  80164b:	41 ff d1             	call   *%r9
+
+000000000080164e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	53                   	push   %rbx
+  801653:	48 83 ec 08          	sub    $0x8,%rsp
+  801657:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80165a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801679:	48 85 c0             	test   %rax,%rax
+  80167c:	7f 06                	jg     801684 <sys_env_set_pgfault_upcall+0x36>
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801684:	49 89 c0             	mov    %rax,%r8
+  801687:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80168c:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  801693:	00 00 00 
+  801696:	be 26 00 00 00       	mov    $0x26,%esi
+  80169b:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+
+00000000008016b7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	53                   	push   %rbx
+  8016bc:	89 f8                	mov    %edi,%eax
+  8016be:	49 89 f1             	mov    %rsi,%r9
+  8016c1:	48 89 d3             	mov    %rdx,%rbx
+  8016c4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016c7:	49 63 f0             	movslq %r8d,%rsi
+  8016ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016db:	cd 30                	int    $0x30
+}
+  8016dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e1:	c9                   	leave
+  8016e2:	c3                   	ret
+
+00000000008016e3 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	53                   	push   %rbx
+  8016e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ec:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8016ef:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80170c:	48 85 c0             	test   %rax,%rax
+  80170f:	7f 06                	jg     801717 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801711:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801717:	49 89 c0             	mov    %rax,%r8
+  80171a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80171f:	48 ba a8 49 80 00 00 	movabs $0x8049a8,%rdx
+  801726:	00 00 00 
+  801729:	be 26 00 00 00       	mov    $0x26,%esi
+  80172e:	48 bf c7 49 80 00 00 	movabs $0x8049c7,%rdi
+  801735:	00 00 00 
+  801738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173d:	49 b9 48 03 80 00 00 	movabs $0x800348,%r9
+  801744:	00 00 00 
+  801747:	41 ff d1             	call   *%r9
+
+000000000080174a <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80174a:	55                   	push   %rbp
+  80174b:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80174e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801753:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  80175a:	00 00 00 
+  80175d:	ff d0                	call   *%rax
+}
+  80175f:	5d                   	pop    %rbp
+  801760:	c3                   	ret
+
+0000000000801761 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801761:	55                   	push   %rbp
+  801762:	48 89 e5             	mov    %rsp,%rbp
+  801765:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801766:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80176b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801770:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801775:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177f:	be 00 00 00 00       	mov    $0x0,%esi
+  801784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80178c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+
+0000000000801792 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801792:	55                   	push   %rbp
+  801793:	48 89 e5             	mov    %rsp,%rbp
+  801796:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801797:	48 63 ce             	movslq %esi,%rcx
+  80179a:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80179e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b8:	cd 30                	int    $0x30
+}
+  8017ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017be:	c9                   	leave
+  8017bf:	c3                   	ret
+
+00000000008017c0 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  8017c0:	55                   	push   %rbp
+  8017c1:	48 89 e5             	mov    %rsp,%rbp
+  8017c4:	53                   	push   %rbx
+  8017c5:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  8017c8:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017db:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e6:	cd 30                	int    $0x30
+}
+  8017e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ec:	c9                   	leave
+  8017ed:	c3                   	ret
+
+00000000008017ee <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+  8017f2:	53                   	push   %rbx
+  8017f3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8017f6:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017fe:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801801:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801806:	be 00 00 00 00       	mov    $0x0,%esi
+  80180b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801811:	cd 30                	int    $0x30
+}
+  801813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+
+0000000000801819 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801819:	55                   	push   %rbp
+  80181a:	48 89 e5             	mov    %rsp,%rbp
+  80181d:	41 54                	push   %r12
+  80181f:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801820:	b8 08 00 00 00       	mov    $0x8,%eax
+  801825:	cd 30                	int    $0x30
+  801827:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	78 7e                	js     8018ac <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  80182e:	0f 84 80 00 00 00    	je     8018b4 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801834:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80183a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801841:	00 00 00 
+  801844:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801849:	89 c2                	mov    %eax,%edx
+  80184b:	be 00 00 00 00       	mov    $0x0,%esi
+  801850:	bf 00 00 00 00       	mov    $0x0,%edi
+  801855:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  80185c:	00 00 00 
+  80185f:	ff d0                	call   *%rax
+  801861:	85 c0                	test   %eax,%eax
+  801863:	0f 88 81 00 00 00    	js     8018ea <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801869:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801870:	00 00 00 
+  801873:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  80187a:	44 89 e7             	mov    %r12d,%edi
+  80187d:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  801884:	00 00 00 
+  801887:	ff d0                	call   *%rax
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	78 65                	js     8018f2 <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80188d:	be 02 00 00 00       	mov    $0x2,%esi
+  801892:	44 89 e7             	mov    %r12d,%edi
+  801895:	48 b8 7c 15 80 00 00 	movabs $0x80157c,%rax
+  80189c:	00 00 00 
+  80189f:	ff d0                	call   *%rax
+        return -1;
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018a8:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  8018ac:	44 89 e0             	mov    %r12d,%eax
+  8018af:	5b                   	pop    %rbx
+  8018b0:	41 5c                	pop    %r12
+  8018b2:	5d                   	pop    %rbp
+  8018b3:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018b4:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  8018bb:	00 00 00 
+  8018be:	ff d0                	call   *%rax
+  8018c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018c5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8018c9:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8018cd:	48 c1 e0 04          	shl    $0x4,%rax
+  8018d1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018d8:	00 00 00 
+  8018db:	48 01 d0             	add    %rdx,%rax
+  8018de:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8018e5:	00 00 00 
+        return 0;
+  8018e8:	eb c2                	jmp    8018ac <fork+0x93>
+        return -1;
+  8018ea:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018f0:	eb ba                	jmp    8018ac <fork+0x93>
+        return -1;
+  8018f2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018f8:	eb b2                	jmp    8018ac <fork+0x93>
+
+00000000008018fa <sfork>:
+
+envid_t
+sfork() {
+  8018fa:	55                   	push   %rbp
+  8018fb:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018fe:	48 ba d5 49 80 00 00 	movabs $0x8049d5,%rdx
+  801905:	00 00 00 
+  801908:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80190d:	48 bf f0 49 80 00 00 	movabs $0x8049f0,%rdi
+  801914:	00 00 00 
+  801917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191c:	48 b9 48 03 80 00 00 	movabs $0x800348,%rcx
+  801923:	00 00 00 
+  801926:	ff d1                	call   *%rcx
+
+0000000000801928 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801928:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80192f:	ff ff ff 
+  801932:	48 01 f8             	add    %rdi,%rax
+  801935:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801939:	c3                   	ret
+
+000000000080193a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80193a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801941:	ff ff ff 
+  801944:	48 01 f8             	add    %rdi,%rax
+  801947:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80194b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801951:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801955:	c3                   	ret
+
+0000000000801956 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	41 57                	push   %r15
+  80195c:	41 56                	push   %r14
+  80195e:	41 55                	push   %r13
+  801960:	41 54                	push   %r12
+  801962:	53                   	push   %rbx
+  801963:	48 83 ec 08          	sub    $0x8,%rsp
+  801967:	49 89 ff             	mov    %rdi,%r15
+  80196a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80196f:	49 bd 45 3e 80 00 00 	movabs $0x803e45,%r13
+  801976:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801979:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80197f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801982:	48 89 df             	mov    %rbx,%rdi
+  801985:	41 ff d5             	call   *%r13
+  801988:	83 e0 04             	and    $0x4,%eax
+  80198b:	74 17                	je     8019a4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80198d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801994:	4c 39 f3             	cmp    %r14,%rbx
+  801997:	75 e6                	jne    80197f <fd_alloc+0x29>
+  801999:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80199f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019a4:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019a7:	48 83 c4 08          	add    $0x8,%rsp
+  8019ab:	5b                   	pop    %rbx
+  8019ac:	41 5c                	pop    %r12
+  8019ae:	41 5d                	pop    %r13
+  8019b0:	41 5e                	pop    %r14
+  8019b2:	41 5f                	pop    %r15
+  8019b4:	5d                   	pop    %rbp
+  8019b5:	c3                   	ret
+
+00000000008019b6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019b6:	83 ff 1f             	cmp    $0x1f,%edi
+  8019b9:	77 39                	ja     8019f4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+  8019bf:	41 54                	push   %r12
+  8019c1:	53                   	push   %rbx
+  8019c2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019c5:	48 63 df             	movslq %edi,%rbx
+  8019c8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019cf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019d3:	48 89 df             	mov    %rbx,%rdi
+  8019d6:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  8019dd:	00 00 00 
+  8019e0:	ff d0                	call   *%rax
+  8019e2:	a8 04                	test   $0x4,%al
+  8019e4:	74 14                	je     8019fa <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019e6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ef:	5b                   	pop    %rbx
+  8019f0:	41 5c                	pop    %r12
+  8019f2:	5d                   	pop    %rbp
+  8019f3:	c3                   	ret
+        return -E_INVAL;
+  8019f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019f9:	c3                   	ret
+        return -E_INVAL;
+  8019fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ff:	eb ee                	jmp    8019ef <fd_lookup+0x39>
+
+0000000000801a01 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	41 54                	push   %r12
+  801a07:	53                   	push   %rbx
+  801a08:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a0b:	48 b8 a0 4a 80 00 00 	movabs $0x804aa0,%rax
+  801a12:	00 00 00 
+  801a15:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a1c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a1f:	39 3b                	cmp    %edi,(%rbx)
+  801a21:	74 47                	je     801a6a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a23:	48 83 c0 08          	add    $0x8,%rax
+  801a27:	48 8b 18             	mov    (%rax),%rbx
+  801a2a:	48 85 db             	test   %rbx,%rbx
+  801a2d:	75 f0                	jne    801a1f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a2f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a36:	00 00 00 
+  801a39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a3f:	89 fa                	mov    %edi,%edx
+  801a41:	48 bf 00 4a 80 00 00 	movabs $0x804a00,%rdi
+  801a48:	00 00 00 
+  801a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a50:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  801a57:	00 00 00 
+  801a5a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a61:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a65:	5b                   	pop    %rbx
+  801a66:	41 5c                	pop    %r12
+  801a68:	5d                   	pop    %rbp
+  801a69:	c3                   	ret
+            return 0;
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6f:	eb f0                	jmp    801a61 <dev_lookup+0x60>
+
+0000000000801a71 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	41 55                	push   %r13
+  801a77:	41 54                	push   %r12
+  801a79:	53                   	push   %rbx
+  801a7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a7e:	48 89 fb             	mov    %rdi,%rbx
+  801a81:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a84:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a8b:	ff ff ff 
+  801a8e:	48 01 df             	add    %rbx,%rdi
+  801a91:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a95:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a99:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+  801aa5:	41 89 c5             	mov    %eax,%r13d
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 06                	js     801ab2 <fd_close+0x41>
+  801aac:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ab0:	74 1a                	je     801acc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ab2:	45 84 e4             	test   %r12b,%r12b
+  801ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aba:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801abe:	44 89 e8             	mov    %r13d,%eax
+  801ac1:	48 83 c4 18          	add    $0x18,%rsp
+  801ac5:	5b                   	pop    %rbx
+  801ac6:	41 5c                	pop    %r12
+  801ac8:	41 5d                	pop    %r13
+  801aca:	5d                   	pop    %rbp
+  801acb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801acc:	8b 3b                	mov    (%rbx),%edi
+  801ace:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ad2:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801ad9:	00 00 00 
+  801adc:	ff d0                	call   *%rax
+  801ade:	41 89 c5             	mov    %eax,%r13d
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 1b                	js     801b00 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ae5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801aed:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801af3:	48 85 c0             	test   %rax,%rax
+  801af6:	74 08                	je     801b00 <fd_close+0x8f>
+  801af8:	48 89 df             	mov    %rbx,%rdi
+  801afb:	ff d0                	call   *%rax
+  801afd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b05:	48 89 de             	mov    %rbx,%rsi
+  801b08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0d:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801b14:	00 00 00 
+  801b17:	ff d0                	call   *%rax
+    return res;
+  801b19:	eb a3                	jmp    801abe <fd_close+0x4d>
+
+0000000000801b1b <close>:
+
+int
+close(int fdnum) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+  801b1f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b23:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b27:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 15                	js     801b4c <close+0x31>
+
+    return fd_close(fd, 1);
+  801b37:	be 01 00 00 00       	mov    $0x1,%esi
+  801b3c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b40:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+}
+  801b4c:	c9                   	leave
+  801b4d:	c3                   	ret
+
+0000000000801b4e <close_all>:
+
+void
+close_all(void) {
+  801b4e:	55                   	push   %rbp
+  801b4f:	48 89 e5             	mov    %rsp,%rbp
+  801b52:	41 54                	push   %r12
+  801b54:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5a:	49 bc 1b 1b 80 00 00 	movabs $0x801b1b,%r12
+  801b61:	00 00 00 
+  801b64:	89 df                	mov    %ebx,%edi
+  801b66:	41 ff d4             	call   *%r12
+  801b69:	83 c3 01             	add    $0x1,%ebx
+  801b6c:	83 fb 20             	cmp    $0x20,%ebx
+  801b6f:	75 f3                	jne    801b64 <close_all+0x16>
+}
+  801b71:	5b                   	pop    %rbx
+  801b72:	41 5c                	pop    %r12
+  801b74:	5d                   	pop    %rbp
+  801b75:	c3                   	ret
+
+0000000000801b76 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b76:	55                   	push   %rbp
+  801b77:	48 89 e5             	mov    %rsp,%rbp
+  801b7a:	41 57                	push   %r15
+  801b7c:	41 56                	push   %r14
+  801b7e:	41 55                	push   %r13
+  801b80:	41 54                	push   %r12
+  801b82:	53                   	push   %rbx
+  801b83:	48 83 ec 18          	sub    $0x18,%rsp
+  801b87:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b8a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b8e:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	89 c3                	mov    %eax,%ebx
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	0f 88 b8 00 00 00    	js     801c5c <dup+0xe6>
+    close(newfdnum);
+  801ba4:	44 89 e7             	mov    %r12d,%edi
+  801ba7:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bb3:	4d 63 ec             	movslq %r12d,%r13
+  801bb6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801bbd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bc1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bc5:	4c 89 ff             	mov    %r15,%rdi
+  801bc8:	49 be 3a 19 80 00 00 	movabs $0x80193a,%r14
+  801bcf:	00 00 00 
+  801bd2:	41 ff d6             	call   *%r14
+  801bd5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bd8:	4c 89 ef             	mov    %r13,%rdi
+  801bdb:	41 ff d6             	call   *%r14
+  801bde:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801be1:	48 89 df             	mov    %rbx,%rdi
+  801be4:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  801beb:	00 00 00 
+  801bee:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bf0:	a8 04                	test   $0x4,%al
+  801bf2:	74 2b                	je     801c1f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bf4:	41 89 c1             	mov    %eax,%r9d
+  801bf7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bfd:	4c 89 f1             	mov    %r14,%rcx
+  801c00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c05:	48 89 de             	mov    %rbx,%rsi
+  801c08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0d:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	89 c3                	mov    %eax,%ebx
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	78 4e                	js     801c6d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c1f:	4c 89 ff             	mov    %r15,%rdi
+  801c22:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+  801c2e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c31:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c37:	4c 89 e9             	mov    %r13,%rcx
+  801c3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3f:	4c 89 fe             	mov    %r15,%rsi
+  801c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c47:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  801c53:	89 c3                	mov    %eax,%ebx
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	78 14                	js     801c6d <dup+0xf7>
+
+    return newfdnum;
+  801c59:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c5c:	89 d8                	mov    %ebx,%eax
+  801c5e:	48 83 c4 18          	add    $0x18,%rsp
+  801c62:	5b                   	pop    %rbx
+  801c63:	41 5c                	pop    %r12
+  801c65:	41 5d                	pop    %r13
+  801c67:	41 5e                	pop    %r14
+  801c69:	41 5f                	pop    %r15
+  801c6b:	5d                   	pop    %rbp
+  801c6c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c72:	4c 89 ee             	mov    %r13,%rsi
+  801c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7a:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  801c81:	00 00 00 
+  801c84:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c8c:	4c 89 f6             	mov    %r14,%rsi
+  801c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c94:	41 ff d4             	call   *%r12
+    return res;
+  801c97:	eb c3                	jmp    801c5c <dup+0xe6>
+
+0000000000801c99 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c99:	55                   	push   %rbp
+  801c9a:	48 89 e5             	mov    %rsp,%rbp
+  801c9d:	41 56                	push   %r14
+  801c9f:	41 55                	push   %r13
+  801ca1:	41 54                	push   %r12
+  801ca3:	53                   	push   %rbx
+  801ca4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ca8:	89 fb                	mov    %edi,%ebx
+  801caa:	49 89 f4             	mov    %rsi,%r12
+  801cad:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cb4:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801cbb:	00 00 00 
+  801cbe:	ff d0                	call   *%rax
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 4c                	js     801d10 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cc8:	41 8b 3e             	mov    (%r14),%edi
+  801ccb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ccf:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801cd6:	00 00 00 
+  801cd9:	ff d0                	call   *%rax
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 35                	js     801d14 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cdf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ce3:	83 e0 03             	and    $0x3,%eax
+  801ce6:	83 f8 01             	cmp    $0x1,%eax
+  801ce9:	74 2d                	je     801d18 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ceb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cf3:	48 85 c0             	test   %rax,%rax
+  801cf6:	74 56                	je     801d4e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cf8:	4c 89 ea             	mov    %r13,%rdx
+  801cfb:	4c 89 e6             	mov    %r12,%rsi
+  801cfe:	4c 89 f7             	mov    %r14,%rdi
+  801d01:	ff d0                	call   *%rax
+}
+  801d03:	48 83 c4 10          	add    $0x10,%rsp
+  801d07:	5b                   	pop    %rbx
+  801d08:	41 5c                	pop    %r12
+  801d0a:	41 5d                	pop    %r13
+  801d0c:	41 5e                	pop    %r14
+  801d0e:	5d                   	pop    %rbp
+  801d0f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d10:	48 98                	cltq
+  801d12:	eb ef                	jmp    801d03 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d14:	48 98                	cltq
+  801d16:	eb eb                	jmp    801d03 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d18:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d1f:	00 00 00 
+  801d22:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d28:	89 da                	mov    %ebx,%edx
+  801d2a:	48 bf 61 4a 80 00 00 	movabs $0x804a61,%rdi
+  801d31:	00 00 00 
+  801d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d39:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  801d40:	00 00 00 
+  801d43:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d45:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d4c:	eb b5                	jmp    801d03 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d4e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d55:	eb ac                	jmp    801d03 <read+0x6a>
+
+0000000000801d57 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	41 56                	push   %r14
+  801d5d:	41 55                	push   %r13
+  801d5f:	41 54                	push   %r12
+  801d61:	53                   	push   %rbx
+  801d62:	48 83 ec 10          	sub    $0x10,%rsp
+  801d66:	89 fb                	mov    %edi,%ebx
+  801d68:	49 89 f4             	mov    %rsi,%r12
+  801d6b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d72:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 41                	js     801dc3 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d82:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d86:	41 8b 3e             	mov    (%r14),%edi
+  801d89:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d8d:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 35                	js     801dd2 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d9d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801da1:	83 e0 03             	and    $0x3,%eax
+  801da4:	83 f8 01             	cmp    $0x1,%eax
+  801da7:	74 2d                	je     801dd6 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801da9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dad:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801db1:	48 85 c0             	test   %rax,%rax
+  801db4:	74 56                	je     801e0c <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801db6:	4c 89 ea             	mov    %r13,%rdx
+  801db9:	4c 89 e6             	mov    %r12,%rsi
+  801dbc:	4c 89 f7             	mov    %r14,%rdi
+  801dbf:	ff d0                	call   *%rax
+  801dc1:	eb 02                	jmp    801dc5 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc3:	48 98                	cltq
+}
+  801dc5:	48 83 c4 10          	add    $0x10,%rsp
+  801dc9:	5b                   	pop    %rbx
+  801dca:	41 5c                	pop    %r12
+  801dcc:	41 5d                	pop    %r13
+  801dce:	41 5e                	pop    %r14
+  801dd0:	5d                   	pop    %rbp
+  801dd1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd2:	48 98                	cltq
+  801dd4:	eb ef                	jmp    801dc5 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dd6:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ddd:	00 00 00 
+  801de0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801de6:	89 da                	mov    %ebx,%edx
+  801de8:	48 bf 20 4a 80 00 00 	movabs $0x804a20,%rdi
+  801def:	00 00 00 
+  801df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df7:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  801dfe:	00 00 00 
+  801e01:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e03:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e0a:	eb b9                	jmp    801dc5 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801e0c:	4c 89 ea             	mov    %r13,%rdx
+  801e0f:	4c 89 e6             	mov    %r12,%rsi
+  801e12:	89 df                	mov    %ebx,%edi
+  801e14:	48 b8 99 1c 80 00 00 	movabs $0x801c99,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+  801e20:	eb a3                	jmp    801dc5 <readmap+0x6e>
+
+0000000000801e22 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e22:	55                   	push   %rbp
+  801e23:	48 89 e5             	mov    %rsp,%rbp
+  801e26:	41 57                	push   %r15
+  801e28:	41 56                	push   %r14
+  801e2a:	41 55                	push   %r13
+  801e2c:	41 54                	push   %r12
+  801e2e:	53                   	push   %rbx
+  801e2f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e33:	48 85 d2             	test   %rdx,%rdx
+  801e36:	74 54                	je     801e8c <readn+0x6a>
+  801e38:	41 89 fd             	mov    %edi,%r13d
+  801e3b:	49 89 f6             	mov    %rsi,%r14
+  801e3e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e41:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e46:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e4b:	49 bf 99 1c 80 00 00 	movabs $0x801c99,%r15
+  801e52:	00 00 00 
+  801e55:	4c 89 e2             	mov    %r12,%rdx
+  801e58:	48 29 f2             	sub    %rsi,%rdx
+  801e5b:	4c 01 f6             	add    %r14,%rsi
+  801e5e:	44 89 ef             	mov    %r13d,%edi
+  801e61:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	78 20                	js     801e88 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e68:	01 c3                	add    %eax,%ebx
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	74 08                	je     801e76 <readn+0x54>
+  801e6e:	48 63 f3             	movslq %ebx,%rsi
+  801e71:	4c 39 e6             	cmp    %r12,%rsi
+  801e74:	72 df                	jb     801e55 <readn+0x33>
+    }
+    return res;
+  801e76:	48 63 c3             	movslq %ebx,%rax
+}
+  801e79:	48 83 c4 08          	add    $0x8,%rsp
+  801e7d:	5b                   	pop    %rbx
+  801e7e:	41 5c                	pop    %r12
+  801e80:	41 5d                	pop    %r13
+  801e82:	41 5e                	pop    %r14
+  801e84:	41 5f                	pop    %r15
+  801e86:	5d                   	pop    %rbp
+  801e87:	c3                   	ret
+        if (inc < 0) return inc;
+  801e88:	48 98                	cltq
+  801e8a:	eb ed                	jmp    801e79 <readn+0x57>
+    int inc = 1, res = 0;
+  801e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e91:	eb e3                	jmp    801e76 <readn+0x54>
+
+0000000000801e93 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e93:	55                   	push   %rbp
+  801e94:	48 89 e5             	mov    %rsp,%rbp
+  801e97:	41 56                	push   %r14
+  801e99:	41 55                	push   %r13
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	48 83 ec 10          	sub    $0x10,%rsp
+  801ea2:	89 fb                	mov    %edi,%ebx
+  801ea4:	49 89 f4             	mov    %rsi,%r12
+  801ea7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eaa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eae:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 47                	js     801f05 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ebe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ec2:	41 8b 3e             	mov    (%r14),%edi
+  801ec5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec9:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 30                	js     801f09 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ed9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ede:	74 2d                	je     801f0d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ee0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ee8:	48 85 c0             	test   %rax,%rax
+  801eeb:	74 56                	je     801f43 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801eed:	4c 89 ea             	mov    %r13,%rdx
+  801ef0:	4c 89 e6             	mov    %r12,%rsi
+  801ef3:	4c 89 f7             	mov    %r14,%rdi
+  801ef6:	ff d0                	call   *%rax
+}
+  801ef8:	48 83 c4 10          	add    $0x10,%rsp
+  801efc:	5b                   	pop    %rbx
+  801efd:	41 5c                	pop    %r12
+  801eff:	41 5d                	pop    %r13
+  801f01:	41 5e                	pop    %r14
+  801f03:	5d                   	pop    %rbp
+  801f04:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f05:	48 98                	cltq
+  801f07:	eb ef                	jmp    801ef8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f09:	48 98                	cltq
+  801f0b:	eb eb                	jmp    801ef8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f0d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f14:	00 00 00 
+  801f17:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f1d:	89 da                	mov    %ebx,%edx
+  801f1f:	48 bf 7d 4a 80 00 00 	movabs $0x804a7d,%rdi
+  801f26:	00 00 00 
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  801f35:	00 00 00 
+  801f38:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f41:	eb b5                	jmp    801ef8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f43:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f4a:	eb ac                	jmp    801ef8 <write+0x65>
+
+0000000000801f4c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f4c:	55                   	push   %rbp
+  801f4d:	48 89 e5             	mov    %rsp,%rbp
+  801f50:	53                   	push   %rbx
+  801f51:	48 83 ec 18          	sub    $0x18,%rsp
+  801f55:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f57:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f5b:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 0c                	js     801f77 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f6f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f7b:	c9                   	leave
+  801f7c:	c3                   	ret
+
+0000000000801f7d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	41 55                	push   %r13
+  801f83:	41 54                	push   %r12
+  801f85:	53                   	push   %rbx
+  801f86:	48 83 ec 18          	sub    $0x18,%rsp
+  801f8a:	89 fb                	mov    %edi,%ebx
+  801f8c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f8f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f93:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801f9a:	00 00 00 
+  801f9d:	ff d0                	call   *%rax
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	78 38                	js     801fdb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fa3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fa7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801faf:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 1c                	js     801fdb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fbf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fc4:	74 20                	je     801fe6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fca:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801fce:	48 85 c0             	test   %rax,%rax
+  801fd1:	74 47                	je     80201a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fd3:	44 89 e6             	mov    %r12d,%esi
+  801fd6:	4c 89 ef             	mov    %r13,%rdi
+  801fd9:	ff d0                	call   *%rax
+}
+  801fdb:	48 83 c4 18          	add    $0x18,%rsp
+  801fdf:	5b                   	pop    %rbx
+  801fe0:	41 5c                	pop    %r12
+  801fe2:	41 5d                	pop    %r13
+  801fe4:	5d                   	pop    %rbp
+  801fe5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801fe6:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801fed:	00 00 00 
+  801ff0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ff6:	89 da                	mov    %ebx,%edx
+  801ff8:	48 bf 40 4a 80 00 00 	movabs $0x804a40,%rdi
+  801fff:	00 00 00 
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+  802007:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  80200e:	00 00 00 
+  802011:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802013:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802018:	eb c1                	jmp    801fdb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80201a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80201f:	eb ba                	jmp    801fdb <ftruncate+0x5e>
+
+0000000000802021 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802021:	55                   	push   %rbp
+  802022:	48 89 e5             	mov    %rsp,%rbp
+  802025:	41 54                	push   %r12
+  802027:	53                   	push   %rbx
+  802028:	48 83 ec 10          	sub    $0x10,%rsp
+  80202c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80202f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802033:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  80203a:	00 00 00 
+  80203d:	ff d0                	call   *%rax
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 4e                	js     802091 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802043:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802047:	41 8b 3c 24          	mov    (%r12),%edi
+  80204b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80204f:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  802056:	00 00 00 
+  802059:	ff d0                	call   *%rax
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	78 32                	js     802091 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80205f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802063:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802068:	74 30                	je     80209a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80206a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80206d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802074:	00 00 00 
+    stat->st_isdir = 0;
+  802077:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80207e:	00 00 00 
+    stat->st_dev = dev;
+  802081:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802088:	48 89 de             	mov    %rbx,%rsi
+  80208b:	4c 89 e7             	mov    %r12,%rdi
+  80208e:	ff 50 30             	call   *0x30(%rax)
+}
+  802091:	48 83 c4 10          	add    $0x10,%rsp
+  802095:	5b                   	pop    %rbx
+  802096:	41 5c                	pop    %r12
+  802098:	5d                   	pop    %rbp
+  802099:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80209a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209f:	eb f0                	jmp    802091 <fstat+0x70>
+
+00000000008020a1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	41 54                	push   %r12
+  8020a7:	53                   	push   %rbx
+  8020a8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b0:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 25                	js     8020e7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020c2:	4c 89 e6             	mov    %r12,%rsi
+  8020c5:	89 c7                	mov    %eax,%edi
+  8020c7:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+  8020d3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020d6:	89 df                	mov    %ebx,%edi
+  8020d8:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  8020df:	00 00 00 
+  8020e2:	ff d0                	call   *%rax
+
+    return res;
+  8020e4:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020e7:	89 d8                	mov    %ebx,%eax
+  8020e9:	5b                   	pop    %rbx
+  8020ea:	41 5c                	pop    %r12
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+
+00000000008020ee <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	41 54                	push   %r12
+  8020f4:	53                   	push   %rbx
+  8020f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f9:	48 89 fb             	mov    %rdi,%rbx
+  8020fc:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020ff:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802103:	bf 66 00 00 00       	mov    $0x66,%edi
+  802108:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 1f                	js     802137 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80211c:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802120:	48 85 c0             	test   %rax,%rax
+  802123:	74 1b                	je     802140 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802125:	4c 89 e6             	mov    %r12,%rsi
+  802128:	48 89 df             	mov    %rbx,%rdi
+  80212b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802134:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802137:	48 83 c4 10          	add    $0x10,%rsp
+  80213b:	5b                   	pop    %rbx
+  80213c:	41 5c                	pop    %r12
+  80213e:	5d                   	pop    %rbp
+  80213f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802140:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802145:	eb f0                	jmp    802137 <create_snapshot+0x49>
+
+0000000000802147 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802147:	55                   	push   %rbp
+  802148:	48 89 e5             	mov    %rsp,%rbp
+  80214b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80214f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802153:	bf 66 00 00 00       	mov    $0x66,%edi
+  802158:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+  802164:	85 c0                	test   %eax,%eax
+  802166:	78 1e                	js     802186 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802168:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80216c:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802170:	48 85 d2             	test   %rdx,%rdx
+  802173:	74 13                	je     802188 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217a:	ff d2                	call   *%rdx
+    if (res < 0) {
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802183:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802186:	c9                   	leave
+  802187:	c3                   	ret
+        return -E_NOT_SUPP;
+  802188:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80218d:	eb f7                	jmp    802186 <print_snapshot_list+0x3f>
+
+000000000080218f <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80218f:	55                   	push   %rbp
+  802190:	48 89 e5             	mov    %rsp,%rbp
+  802193:	53                   	push   %rbx
+  802194:	48 83 ec 18          	sub    $0x18,%rsp
+  802198:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80219b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80219f:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021a4:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	78 1c                	js     8021d0 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8021b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b8:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8021bc:	48 85 c0             	test   %rax,%rax
+  8021bf:	74 15                	je     8021d6 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8021c1:	48 89 df             	mov    %rbx,%rdi
+  8021c4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cd:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8021d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021d4:	c9                   	leave
+  8021d5:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021d6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021db:	eb f3                	jmp    8021d0 <accept_snapshot+0x41>
+
+00000000008021dd <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8021dd:	55                   	push   %rbp
+  8021de:	48 89 e5             	mov    %rsp,%rbp
+  8021e1:	53                   	push   %rbx
+  8021e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e6:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021e9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021ed:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021f2:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	78 1c                	js     80221e <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  802202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802206:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80220a:	48 85 c0             	test   %rax,%rax
+  80220d:	74 15                	je     802224 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  80220f:	48 89 df             	mov    %rbx,%rdi
+  802212:	ff d0                	call   *%rax
+    if (res < 0) {
+  802214:	85 c0                	test   %eax,%eax
+  802216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221b:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80221e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802222:	c9                   	leave
+  802223:	c3                   	ret
+        return -E_NOT_SUPP;
+  802224:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802229:	eb f3                	jmp    80221e <delete_snapshot+0x41>
+
+000000000080222b <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802233:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802237:	bf 66 00 00 00       	mov    $0x66,%edi
+  80223c:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  802243:	00 00 00 
+  802246:	ff d0                	call   *%rax
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 14                	js     802260 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  80224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802250:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802254:	48 85 d2             	test   %rdx,%rdx
+  802257:	74 09                	je     802262 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225e:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+        return -E_NOT_SUPP;
+  802262:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802267:	eb f7                	jmp    802260 <gc_snapshots+0x35>
+
+0000000000802269 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	41 56                	push   %r14
+  80226f:	41 55                	push   %r13
+  802271:	41 54                	push   %r12
+  802273:	53                   	push   %rbx
+  802274:	48 83 ec 10          	sub    $0x10,%rsp
+  802278:	48 89 fb             	mov    %rdi,%rbx
+  80227b:	49 89 f4             	mov    %rsi,%r12
+  80227e:	49 89 d5             	mov    %rdx,%r13
+  802281:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802284:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802288:	bf 66 00 00 00       	mov    $0x66,%edi
+  80228d:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	78 1b                	js     8022b8 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  80229d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022a1:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8022a5:	48 85 c0             	test   %rax,%rax
+  8022a8:	74 1b                	je     8022c5 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  8022aa:	4c 89 f1             	mov    %r14,%rcx
+  8022ad:	4c 89 ea             	mov    %r13,%rdx
+  8022b0:	4c 89 e6             	mov    %r12,%rsi
+  8022b3:	48 89 df             	mov    %rbx,%rdi
+  8022b6:	ff d0                	call   *%rax
+
+    return res;
+}
+  8022b8:	48 83 c4 10          	add    $0x10,%rsp
+  8022bc:	5b                   	pop    %rbx
+  8022bd:	41 5c                	pop    %r12
+  8022bf:	41 5d                	pop    %r13
+  8022c1:	41 5e                	pop    %r14
+  8022c3:	5d                   	pop    %rbp
+  8022c4:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022ca:	eb ec                	jmp    8022b8 <diff_snapshots+0x4f>
+
+00000000008022cc <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8022cc:	55                   	push   %rbp
+  8022cd:	48 89 e5             	mov    %rsp,%rbp
+  8022d0:	41 55                	push   %r13
+  8022d2:	41 54                	push   %r12
+  8022d4:	53                   	push   %rbx
+  8022d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d9:	48 89 fb             	mov    %rdi,%rbx
+  8022dc:	49 89 f4             	mov    %rsi,%r12
+  8022df:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022e2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022e6:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022eb:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	78 18                	js     802313 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8022fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022ff:	48 8b 40 70          	mov    0x70(%rax),%rax
+  802303:	48 85 c0             	test   %rax,%rax
+  802306:	74 16                	je     80231e <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802308:	4c 89 ea             	mov    %r13,%rdx
+  80230b:	4c 89 e6             	mov    %r12,%rsi
+  80230e:	48 89 df             	mov    %rbx,%rdi
+  802311:	ff d0                	call   *%rax
+
+    return res;
+}
+  802313:	48 83 c4 18          	add    $0x18,%rsp
+  802317:	5b                   	pop    %rbx
+  802318:	41 5c                	pop    %r12
+  80231a:	41 5d                	pop    %r13
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80231e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802323:	eb ee                	jmp    802313 <send_snapshot+0x47>
+
+0000000000802325 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802325:	55                   	push   %rbp
+  802326:	48 89 e5             	mov    %rsp,%rbp
+  802329:	53                   	push   %rbx
+  80232a:	48 83 ec 18          	sub    $0x18,%rsp
+  80232e:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802331:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802335:	bf 66 00 00 00       	mov    $0x66,%edi
+  80233a:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 12                	js     80235c <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80234a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80234e:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802352:	48 85 c0             	test   %rax,%rax
+  802355:	74 0b                	je     802362 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802357:	48 89 df             	mov    %rbx,%rdi
+  80235a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80235c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+        return -E_NOT_SUPP;
+  802362:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802367:	eb f3                	jmp    80235c <receive_snapshot+0x37>
+
+0000000000802369 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802371:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802375:	bf 66 00 00 00       	mov    $0x66,%edi
+  80237a:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  802381:	00 00 00 
+  802384:	ff d0                	call   *%rax
+  802386:	85 c0                	test   %eax,%eax
+  802388:	78 17                	js     8023a1 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80238a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80238e:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802395:	48 85 d2             	test   %rdx,%rdx
+  802398:	74 09                	je     8023a3 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80239a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239f:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023a3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023a8:	eb f7                	jmp    8023a1 <free_space_bytes+0x38>
+
+00000000008023aa <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  8023aa:	55                   	push   %rbp
+  8023ab:	48 89 e5             	mov    %rsp,%rbp
+  8023ae:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023b2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023b6:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023bb:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	85 c0                	test   %eax,%eax
+  8023c9:	78 17                	js     8023e2 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8023cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023cf:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8023d6:	48 85 d2             	test   %rdx,%rdx
+  8023d9:	74 09                	je     8023e4 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8023db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e0:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023e4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023e9:	eb f7                	jmp    8023e2 <busy_space_bytes+0x38>
+
+00000000008023eb <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+  8023ef:	41 54                	push   %r12
+  8023f1:	53                   	push   %rbx
+  8023f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f6:	89 fb                	mov    %edi,%ebx
+  8023f8:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023fb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ff:	bf 66 00 00 00       	mov    $0x66,%edi
+  802404:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	85 c0                	test   %eax,%eax
+  802412:	78 17                	js     80242b <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802414:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802418:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  80241f:	48 85 c0             	test   %rax,%rax
+  802422:	74 10                	je     802434 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802424:	4c 89 e6             	mov    %r12,%rsi
+  802427:	89 df                	mov    %ebx,%edi
+  802429:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80242b:	48 83 c4 10          	add    $0x10,%rsp
+  80242f:	5b                   	pop    %rbx
+  802430:	41 5c                	pop    %r12
+  802432:	5d                   	pop    %rbp
+  802433:	c3                   	ret
+        return -E_NOT_SUPP;
+  802434:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802439:	eb f0                	jmp    80242b <snapshots_space+0x40>
+
+000000000080243b <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	41 55                	push   %r13
+  802441:	41 54                	push   %r12
+  802443:	53                   	push   %rbx
+  802444:	48 83 ec 08          	sub    $0x8,%rsp
+  802448:	41 89 fd             	mov    %edi,%r13d
+  80244b:	48 89 f3             	mov    %rsi,%rbx
+  80244e:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802451:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802458:	00 00 00 
+  80245b:	83 38 00             	cmpl   $0x0,(%rax)
+  80245e:	74 57                	je     8024b7 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802460:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802466:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80246b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802472:	00 00 00 
+  802475:	44 89 ee             	mov    %r13d,%esi
+  802478:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80247f:	00 00 00 
+  802482:	8b 38                	mov    (%rax),%edi
+  802484:	48 b8 88 42 80 00 00 	movabs $0x804288,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802495:	4c 89 e2             	mov    %r12,%rdx
+  802498:	48 89 de             	mov    %rbx,%rsi
+  80249b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a0:	48 b8 70 42 80 00 00 	movabs $0x804270,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+}
+  8024ac:	48 83 c4 08          	add    $0x8,%rsp
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	41 5d                	pop    %r13
+  8024b5:	5d                   	pop    %rbp
+  8024b6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024b7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024bc:	48 b8 46 43 80 00 00 	movabs $0x804346,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+  8024c8:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8024cf:	00 00 
+  8024d1:	eb 8d                	jmp    802460 <fsipc_region+0x25>
+
+00000000008024d3 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+  8024d7:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8024db:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8024e2:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8024e3:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8024e7:	48 b8 3b 24 80 00 00 	movabs $0x80243b,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+}
+  8024f3:	c9                   	leave
+  8024f4:	c3                   	ret
+
+00000000008024f5 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8024f5:	85 ff                	test   %edi,%edi
+  8024f7:	78 6d                	js     802566 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+  8024fd:	41 54                	push   %r12
+  8024ff:	53                   	push   %rbx
+  802500:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  802503:	48 85 f6             	test   %rsi,%rsi
+  802506:	74 57                	je     80255f <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802508:	89 f8                	mov    %edi,%eax
+  80250a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802511:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802513:	be 00 00 00 00       	mov    $0x0,%esi
+  802518:	bf 12 00 00 00       	mov    $0x12,%edi
+  80251d:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802524:	00 00 00 
+  802527:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802529:	85 c0                	test   %eax,%eax
+  80252b:	78 2d                	js     80255a <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  80252d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802534:	00 00 00 
+  802537:	49 63 14 24          	movslq (%r12),%rdx
+  80253b:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802542:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802547:	48 89 df             	mov    %rbx,%rdi
+  80254a:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802556:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80255a:	5b                   	pop    %rbx
+  80255b:	41 5c                	pop    %r12
+  80255d:	5d                   	pop    %rbp
+  80255e:	c3                   	ret
+        return -E_INVAL;
+  80255f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802564:	eb f4                	jmp    80255a <devfile_df_snapshots+0x65>
+  802566:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80256b:	c3                   	ret
+
+000000000080256c <devfile_df_busy>:
+devfile_df_busy() {
+  80256c:	55                   	push   %rbp
+  80256d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802570:	be 00 00 00 00       	mov    $0x0,%esi
+  802575:	bf 11 00 00 00       	mov    $0x11,%edi
+  80257a:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+}
+  802586:	5d                   	pop    %rbp
+  802587:	c3                   	ret
+
+0000000000802588 <devfile_df_free>:
+devfile_df_free() {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80258c:	be 00 00 00 00       	mov    $0x0,%esi
+  802591:	bf 10 00 00 00       	mov    $0x10,%edi
+  802596:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80259d:	00 00 00 
+  8025a0:	ff d0                	call   *%rax
+}
+  8025a2:	5d                   	pop    %rbp
+  8025a3:	c3                   	ret
+
+00000000008025a4 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8025a4:	55                   	push   %rbp
+  8025a5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  8025a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ad:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025b2:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+}
+  8025be:	5d                   	pop    %rbp
+  8025bf:	c3                   	ret
+
+00000000008025c0 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8025c0:	55                   	push   %rbp
+  8025c1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8025c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c9:	bf 09 00 00 00       	mov    $0x9,%edi
+  8025ce:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8025e4:	5d                   	pop    %rbp
+  8025e5:	c3                   	ret
+
+00000000008025e6 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8025e6:	55                   	push   %rbp
+  8025e7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8025ea:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8025f1:	00 00 00 
+  8025f4:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8025f7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8025f9:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8025fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802601:	bf 02 00 00 00       	mov    $0x2,%edi
+  802606:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80260d:	00 00 00 
+  802610:	ff d0                	call   *%rax
+}
+  802612:	5d                   	pop    %rbp
+  802613:	c3                   	ret
+
+0000000000802614 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802614:	55                   	push   %rbp
+  802615:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802618:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80261b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802622:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802624:	be 00 00 00 00       	mov    $0x0,%esi
+  802629:	bf 06 00 00 00       	mov    $0x6,%edi
+  80262e:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+}
+  80263a:	5d                   	pop    %rbp
+  80263b:	c3                   	ret
+
+000000000080263c <devfile_write>:
+    if (!fd || !buf) {
+  80263c:	48 85 ff             	test   %rdi,%rdi
+  80263f:	0f 84 c1 00 00 00    	je     802706 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802645:	55                   	push   %rbp
+  802646:	48 89 e5             	mov    %rsp,%rbp
+  802649:	41 57                	push   %r15
+  80264b:	41 56                	push   %r14
+  80264d:	41 55                	push   %r13
+  80264f:	41 54                	push   %r12
+  802651:	53                   	push   %rbx
+  802652:	48 83 ec 18          	sub    $0x18,%rsp
+  802656:	49 89 ff             	mov    %rdi,%r15
+  802659:	49 89 f5             	mov    %rsi,%r13
+  80265c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80265f:	48 85 f6             	test   %rsi,%rsi
+  802662:	0f 84 95 00 00 00    	je     8026fd <devfile_write+0xc1>
+    while (n) {
+  802668:	48 85 d2             	test   %rdx,%rdx
+  80266b:	0f 84 83 00 00 00    	je     8026f4 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802671:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802678:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  80267f:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802682:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802687:	49 39 dc             	cmp    %rbx,%r12
+  80268a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80268e:	48 89 da             	mov    %rbx,%rdx
+  802691:	4c 89 ee             	mov    %r13,%rsi
+  802694:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80269b:	00 00 00 
+  80269e:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  8026a5:	00 00 00 
+  8026a8:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026aa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026ae:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8026b1:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8026b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ba:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026bf:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+        if (write < 0) {
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	78 21                	js     8026f0 <devfile_write+0xb4>
+        buf += write;
+  8026cf:	48 63 d0             	movslq %eax,%rdx
+  8026d2:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8026d5:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8026d8:	49 29 d4             	sub    %rdx,%r12
+  8026db:	75 a5                	jne    802682 <devfile_write+0x46>
+    return totalWrite;
+  8026dd:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8026e1:	48 83 c4 18          	add    $0x18,%rsp
+  8026e5:	5b                   	pop    %rbx
+  8026e6:	41 5c                	pop    %r12
+  8026e8:	41 5d                	pop    %r13
+  8026ea:	41 5e                	pop    %r14
+  8026ec:	41 5f                	pop    %r15
+  8026ee:	5d                   	pop    %rbp
+  8026ef:	c3                   	ret
+            return write;
+  8026f0:	48 98                	cltq
+  8026f2:	eb ed                	jmp    8026e1 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8026f4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8026fb:	eb e0                	jmp    8026dd <devfile_write+0xa1>
+        return -E_INVAL;
+  8026fd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802704:	eb db                	jmp    8026e1 <devfile_write+0xa5>
+  802706:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80270d:	c3                   	ret
+
+000000000080270e <devfile_read>:
+    if (!fd || !buf) {
+  80270e:	48 85 ff             	test   %rdi,%rdi
+  802711:	0f 84 c0 00 00 00    	je     8027d7 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	41 57                	push   %r15
+  80271d:	41 56                	push   %r14
+  80271f:	41 55                	push   %r13
+  802721:	41 54                	push   %r12
+  802723:	53                   	push   %rbx
+  802724:	48 83 ec 18          	sub    $0x18,%rsp
+  802728:	49 89 ff             	mov    %rdi,%r15
+  80272b:	49 89 f5             	mov    %rsi,%r13
+  80272e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802731:	48 85 f6             	test   %rsi,%rsi
+  802734:	0f 84 96 00 00 00    	je     8027d0 <devfile_read+0xc2>
+    while (n) {
+  80273a:	48 85 d2             	test   %rdx,%rdx
+  80273d:	0f 84 87 00 00 00    	je     8027ca <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802743:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80274a:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80274b:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802752:	00 00 00 
+  802755:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802759:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80275c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802761:	49 39 c4             	cmp    %rax,%r12
+  802764:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802768:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80276c:	be 00 00 00 00       	mov    $0x0,%esi
+  802771:	bf 03 00 00 00       	mov    $0x3,%edi
+  802776:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802782:	85 c0                	test   %eax,%eax
+  802784:	7e 37                	jle    8027bd <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802786:	48 63 d8             	movslq %eax,%rbx
+  802789:	48 89 da             	mov    %rbx,%rdx
+  80278c:	4c 89 f6             	mov    %r14,%rsi
+  80278f:	4c 89 ef             	mov    %r13,%rdi
+  802792:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  802799:	00 00 00 
+  80279c:	ff d0                	call   *%rax
+        buf += read;
+  80279e:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8027a1:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8027a5:	49 29 dc             	sub    %rbx,%r12
+  8027a8:	75 ab                	jne    802755 <devfile_read+0x47>
+  return totalRead;
+  8027aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8027ae:	48 83 c4 18          	add    $0x18,%rsp
+  8027b2:	5b                   	pop    %rbx
+  8027b3:	41 5c                	pop    %r12
+  8027b5:	41 5d                	pop    %r13
+  8027b7:	41 5e                	pop    %r14
+  8027b9:	41 5f                	pop    %r15
+  8027bb:	5d                   	pop    %rbp
+  8027bc:	c3                   	ret
+            return read ? read : totalRead;
+  8027bd:	48 63 d0             	movslq %eax,%rdx
+  8027c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027c4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8027c8:	eb e4                	jmp    8027ae <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8027ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027ce:	eb da                	jmp    8027aa <devfile_read+0x9c>
+        return E_INVAL;
+  8027d0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027d5:	eb d7                	jmp    8027ae <devfile_read+0xa0>
+  8027d7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8027dc:	c3                   	ret
+
+00000000008027dd <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8027dd:	48 85 ff             	test   %rdi,%rdi
+  8027e0:	74 5f                	je     802841 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8027e2:	55                   	push   %rbp
+  8027e3:	48 89 e5             	mov    %rsp,%rbp
+  8027e6:	53                   	push   %rbx
+  8027e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027eb:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8027ee:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+  8027fa:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802800:	77 45                	ja     802847 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802802:	48 89 de             	mov    %rbx,%rsi
+  802805:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80280c:	00 00 00 
+  80280f:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  80281b:	be 00 00 00 00       	mov    $0x0,%esi
+  802820:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802825:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80282c:	00 00 00 
+  80282f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802831:	85 c0                	test   %eax,%eax
+  802833:	ba 00 00 00 00       	mov    $0x0,%edx
+  802838:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80283b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+        return -E_INVAL;
+  802841:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802846:	c3                   	ret
+        return -E_INVAL;
+  802847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80284c:	eb ed                	jmp    80283b <devfile_receive_snapshot+0x5e>
+
+000000000080284e <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80284e:	55                   	push   %rbp
+  80284f:	48 89 e5             	mov    %rsp,%rbp
+  802852:	41 55                	push   %r13
+  802854:	41 54                	push   %r12
+  802856:	53                   	push   %rbx
+  802857:	48 83 ec 08          	sub    $0x8,%rsp
+  80285b:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80285e:	48 85 f6             	test   %rsi,%rsi
+  802861:	0f 94 c0             	sete   %al
+  802864:	48 85 d2             	test   %rdx,%rdx
+  802867:	0f 94 c2             	sete   %dl
+  80286a:	08 d0                	or     %dl,%al
+  80286c:	0f 85 ad 00 00 00    	jne    80291f <devfile_send_snapshot+0xd1>
+  802872:	48 89 fb             	mov    %rdi,%rbx
+  802875:	49 89 f4             	mov    %rsi,%r12
+  802878:	48 85 ff             	test   %rdi,%rdi
+  80287b:	0f 84 9e 00 00 00    	je     80291f <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802881:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+  80288d:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802893:	0f 87 8d 00 00 00    	ja     802926 <devfile_send_snapshot+0xd8>
+  802899:	4c 89 e7             	mov    %r12,%rdi
+  80289c:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028ae:	77 7d                	ja     80292d <devfile_send_snapshot+0xdf>
+  8028b0:	4c 89 ef             	mov    %r13,%rdi
+  8028b3:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8028c5:	77 6d                	ja     802934 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  8028c7:	48 89 de             	mov    %rbx,%rsi
+  8028ca:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8028d1:	00 00 00 
+  8028d4:	48 bb bd 0d 80 00 00 	movabs $0x800dbd,%rbx
+  8028db:	00 00 00 
+  8028de:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8028e0:	4c 89 e6             	mov    %r12,%rsi
+  8028e3:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  8028ea:	00 00 00 
+  8028ed:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8028ef:	4c 89 ee             	mov    %r13,%rsi
+  8028f2:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  8028f9:	00 00 00 
+  8028fc:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8028fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802903:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802908:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+}
+  802914:	48 83 c4 08          	add    $0x8,%rsp
+  802918:	5b                   	pop    %rbx
+  802919:	41 5c                	pop    %r12
+  80291b:	41 5d                	pop    %r13
+  80291d:	5d                   	pop    %rbp
+  80291e:	c3                   	ret
+        return -E_INVAL;
+  80291f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802924:	eb ee                	jmp    802914 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802926:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80292b:	eb e7                	jmp    802914 <devfile_send_snapshot+0xc6>
+  80292d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802932:	eb e0                	jmp    802914 <devfile_send_snapshot+0xc6>
+  802934:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802939:	eb d9                	jmp    802914 <devfile_send_snapshot+0xc6>
+
+000000000080293b <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  80293b:	48 85 ff             	test   %rdi,%rdi
+  80293e:	0f 84 41 01 00 00    	je     802a85 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+  802948:	41 57                	push   %r15
+  80294a:	41 56                	push   %r14
+  80294c:	41 55                	push   %r13
+  80294e:	41 54                	push   %r12
+  802950:	53                   	push   %rbx
+  802951:	48 83 ec 08          	sub    $0x8,%rsp
+  802955:	49 89 fc             	mov    %rdi,%r12
+  802958:	49 89 f5             	mov    %rsi,%r13
+  80295b:	48 89 d3             	mov    %rdx,%rbx
+  80295e:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802961:	48 85 f6             	test   %rsi,%rsi
+  802964:	0f 84 ff 00 00 00    	je     802a69 <devfile_diff_snapshots+0x12e>
+  80296a:	48 85 d2             	test   %rdx,%rdx
+  80296d:	0f 84 fd 00 00 00    	je     802a70 <devfile_diff_snapshots+0x135>
+  802973:	48 85 c9             	test   %rcx,%rcx
+  802976:	0f 84 f4 00 00 00    	je     802a70 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80297c:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80298e:	0f 87 e3 00 00 00    	ja     802a77 <devfile_diff_snapshots+0x13c>
+  802994:	4c 89 ef             	mov    %r13,%rdi
+  802997:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  80299e:	00 00 00 
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8029a9:	0f 87 cf 00 00 00    	ja     802a7e <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  8029af:	4c 89 e6             	mov    %r12,%rsi
+  8029b2:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8029b9:	00 00 00 
+  8029bc:	4c 89 e7             	mov    %r12,%rdi
+  8029bf:	49 bf bd 0d 80 00 00 	movabs $0x800dbd,%r15
+  8029c6:	00 00 00 
+  8029c9:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  8029cc:	4c 89 ee             	mov    %r13,%rsi
+  8029cf:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  8029d6:	00 
+  8029d7:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  8029da:	48 8b 03             	mov    (%rbx),%rax
+  8029dd:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8029e4:	00 
+  8029e5:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8029e9:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8029f0:	00 
+  8029f1:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8029f5:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8029fc:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8029fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802a02:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802a07:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	78 43                	js     802a5a <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802a17:	49 8b 04 24          	mov    (%r12),%rax
+  802a1b:	48 89 03             	mov    %rax,(%rbx)
+  802a1e:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a23:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802a27:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802a2c:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802a30:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802a35:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802a39:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802a3d:	48 c1 e2 03          	shl    $0x3,%rdx
+  802a41:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802a46:	4c 89 f7             	mov    %r14,%rdi
+  802a49:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802a55:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802a5a:	48 83 c4 08          	add    $0x8,%rsp
+  802a5e:	5b                   	pop    %rbx
+  802a5f:	41 5c                	pop    %r12
+  802a61:	41 5d                	pop    %r13
+  802a63:	41 5e                	pop    %r14
+  802a65:	41 5f                	pop    %r15
+  802a67:	5d                   	pop    %rbp
+  802a68:	c3                   	ret
+        return -E_INVAL;
+  802a69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6e:	eb ea                	jmp    802a5a <devfile_diff_snapshots+0x11f>
+  802a70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a75:	eb e3                	jmp    802a5a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802a77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a7c:	eb dc                	jmp    802a5a <devfile_diff_snapshots+0x11f>
+  802a7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a83:	eb d5                	jmp    802a5a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802a85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a8a:	c3                   	ret
+
+0000000000802a8b <devfile_delete_snapshot>:
+    if (!name) {
+  802a8b:	48 85 ff             	test   %rdi,%rdi
+  802a8e:	74 5f                	je     802aef <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802a90:	55                   	push   %rbp
+  802a91:	48 89 e5             	mov    %rsp,%rbp
+  802a94:	53                   	push   %rbx
+  802a95:	48 83 ec 08          	sub    $0x8,%rsp
+  802a99:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802a9c:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802aa3:	00 00 00 
+  802aa6:	ff d0                	call   *%rax
+  802aa8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802aae:	77 45                	ja     802af5 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802ab0:	48 89 de             	mov    %rbx,%rsi
+  802ab3:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802aba:	00 00 00 
+  802abd:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802ac9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ace:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ad3:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802ada:	00 00 00 
+  802add:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802adf:	85 c0                	test   %eax,%eax
+  802ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ae9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aed:	c9                   	leave
+  802aee:	c3                   	ret
+        return -E_INVAL;
+  802aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802af4:	c3                   	ret
+        return -E_INVAL;
+  802af5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802afa:	eb ed                	jmp    802ae9 <devfile_delete_snapshot+0x5e>
+
+0000000000802afc <devfile_accept_snapshot>:
+    if (!name) {
+  802afc:	48 85 ff             	test   %rdi,%rdi
+  802aff:	74 5f                	je     802b60 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+  802b05:	53                   	push   %rbx
+  802b06:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802b0d:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  802b19:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b1f:	77 45                	ja     802b66 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802b21:	48 89 de             	mov    %rbx,%rsi
+  802b24:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b2b:	00 00 00 
+  802b2e:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  802b35:	00 00 00 
+  802b38:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802b3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b3f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b44:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b57:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b5e:	c9                   	leave
+  802b5f:	c3                   	ret
+        return -E_INVAL;
+  802b60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b65:	c3                   	ret
+        return -E_INVAL;
+  802b66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6b:	eb ed                	jmp    802b5a <devfile_accept_snapshot+0x5e>
+
+0000000000802b6d <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802b6d:	48 85 ff             	test   %rdi,%rdi
+  802b70:	0f 84 9f 00 00 00    	je     802c15 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802b76:	55                   	push   %rbp
+  802b77:	48 89 e5             	mov    %rsp,%rbp
+  802b7a:	41 54                	push   %r12
+  802b7c:	53                   	push   %rbx
+  802b7d:	48 89 fb             	mov    %rdi,%rbx
+  802b80:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802b83:	48 85 f6             	test   %rsi,%rsi
+  802b86:	74 78                	je     802c00 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802b88:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802b8f:	00 00 00 
+  802b92:	ff d0                	call   *%rax
+  802b94:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b9a:	77 6b                	ja     802c07 <devfile_create_snapshot+0x9a>
+  802b9c:	4c 89 e7             	mov    %r12,%rdi
+  802b9f:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+  802bab:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bb1:	77 5b                	ja     802c0e <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802bb3:	48 89 de             	mov    %rbx,%rsi
+  802bb6:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802bbd:	00 00 00 
+  802bc0:	48 bb bd 0d 80 00 00 	movabs $0x800dbd,%rbx
+  802bc7:	00 00 00 
+  802bca:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802bcc:	4c 89 e6             	mov    %r12,%rsi
+  802bcf:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802bd6:	00 00 00 
+  802bd9:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802be0:	bf 08 00 00 00       	mov    $0x8,%edi
+  802be5:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802bfb:	5b                   	pop    %rbx
+  802bfc:	41 5c                	pop    %r12
+  802bfe:	5d                   	pop    %rbp
+  802bff:	c3                   	ret
+        return -E_INVAL;
+  802c00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c05:	eb f4                	jmp    802bfb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c0c:	eb ed                	jmp    802bfb <devfile_create_snapshot+0x8e>
+  802c0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c13:	eb e6                	jmp    802bfb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802c15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c1a:	c3                   	ret
+
+0000000000802c1b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 54                	push   %r12
+  802c21:	53                   	push   %rbx
+  802c22:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c25:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c28:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c2f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c31:	be 00 00 00 00       	mov    $0x0,%esi
+  802c36:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c3b:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	78 3d                	js     802c88 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c4b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c52:	00 00 00 
+  802c55:	4c 89 e6             	mov    %r12,%rsi
+  802c58:	48 89 df             	mov    %rbx,%rdi
+  802c5b:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c67:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c6e:	00 
+  802c6f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c75:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c7c:	00 
+  802c7d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c88:	5b                   	pop    %rbx
+  802c89:	41 5c                	pop    %r12
+  802c8b:	5d                   	pop    %rbp
+  802c8c:	c3                   	ret
+
+0000000000802c8d <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802c8d:	55                   	push   %rbp
+  802c8e:	48 89 e5             	mov    %rsp,%rbp
+  802c91:	41 57                	push   %r15
+  802c93:	41 56                	push   %r14
+  802c95:	41 55                	push   %r13
+  802c97:	41 54                	push   %r12
+  802c99:	53                   	push   %rbx
+  802c9a:	48 83 ec 38          	sub    $0x38,%rsp
+  802c9e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802ca2:	49 89 f5             	mov    %rsi,%r13
+  802ca5:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ca8:	48 89 f0             	mov    %rsi,%rax
+  802cab:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802cb0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802cb4:	75 4f                	jne    802d05 <devfile_readmap+0x78>
+  802cb6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802cba:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cc0:	75 1f                	jne    802ce1 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802cc2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cc6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cca:	49 be 45 3e 80 00 00 	movabs $0x803e45,%r14
+  802cd1:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802cd4:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802cdb:	0f 87 9d 00 00 00    	ja     802d7e <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ce1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ce5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802ce9:	4d 85 ff             	test   %r15,%r15
+  802cec:	0f 85 cf 00 00 00    	jne    802dc1 <devfile_readmap+0x134>
+  802cf2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802cf6:	48 83 c4 38          	add    $0x38,%rsp
+  802cfa:	5b                   	pop    %rbx
+  802cfb:	41 5c                	pop    %r12
+  802cfd:	41 5d                	pop    %r13
+  802cff:	41 5e                	pop    %r14
+  802d01:	41 5f                	pop    %r15
+  802d03:	5d                   	pop    %rbp
+  802d04:	c3                   	ret
+    size_t totalRead = 0;
+  802d05:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802d0c:	00 
+  802d0d:	eb da                	jmp    802ce9 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d0f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d13:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d16:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d1d:	00 00 00 
+  802d20:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802d22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d26:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802d2a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d2e:	4c 89 ee             	mov    %r13,%rsi
+  802d31:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d36:	48 b8 3b 24 80 00 00 	movabs $0x80243b,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	7e a3                	jle    802ce9 <devfile_readmap+0x5c>
+  802d46:	48 98                	cltq
+  802d48:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802d4c:	72 9b                	jb     802ce9 <devfile_readmap+0x5c>
+        buf += read;
+  802d4e:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802d51:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802d54:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802d58:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802d5f:	75 88                	jne    802ce9 <devfile_readmap+0x5c>
+  802d61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d65:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d6b:	0f 85 78 ff ff ff    	jne    802ce9 <devfile_readmap+0x5c>
+  802d71:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802d78:	0f 86 6b ff ff ff    	jbe    802ce9 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802d7e:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802d84:	4d 39 e7             	cmp    %r12,%r15
+  802d87:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802d8b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802d92:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802d96:	0f 84 73 ff ff ff    	je     802d0f <devfile_readmap+0x82>
+  802d9c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802da0:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802da5:	41 ff d6             	call   *%r14
+  802da8:	a8 40                	test   $0x40,%al
+  802daa:	0f 85 39 ff ff ff    	jne    802ce9 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802db0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802db7:	4c 39 e3             	cmp    %r12,%rbx
+  802dba:	72 e4                	jb     802da0 <devfile_readmap+0x113>
+  802dbc:	e9 4e ff ff ff       	jmp    802d0f <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802dc1:	4c 89 fa             	mov    %r15,%rdx
+  802dc4:	4c 89 ee             	mov    %r13,%rsi
+  802dc7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802dcb:	48 b8 0e 27 80 00 00 	movabs $0x80270e,%rax
+  802dd2:	00 00 00 
+  802dd5:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802dd7:	48 85 c0             	test   %rax,%rax
+  802dda:	78 0c                	js     802de8 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802ddc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802de0:	48 01 f0             	add    %rsi,%rax
+  802de3:	e9 0e ff ff ff       	jmp    802cf6 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802de8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dec:	48 85 f6             	test   %rsi,%rsi
+  802def:	48 0f 45 c6          	cmovne %rsi,%rax
+  802df3:	e9 fe fe ff ff       	jmp    802cf6 <devfile_readmap+0x69>
+
+0000000000802df8 <open>:
+open(const char *path, int mode) {
+  802df8:	55                   	push   %rbp
+  802df9:	48 89 e5             	mov    %rsp,%rbp
+  802dfc:	41 55                	push   %r13
+  802dfe:	41 54                	push   %r12
+  802e00:	53                   	push   %rbx
+  802e01:	48 83 ec 18          	sub    $0x18,%rsp
+  802e05:	49 89 fc             	mov    %rdi,%r12
+  802e08:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e0b:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+  802e17:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e1d:	0f 87 8a 00 00 00    	ja     802ead <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e23:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e27:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  802e2e:	00 00 00 
+  802e31:	ff d0                	call   *%rax
+  802e33:	89 c3                	mov    %eax,%ebx
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 50                	js     802e89 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e39:	4c 89 e6             	mov    %r12,%rsi
+  802e3c:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802e43:	00 00 00 
+  802e46:	48 89 df             	mov    %rbx,%rdi
+  802e49:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  802e50:	00 00 00 
+  802e53:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e55:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802e5c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e60:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e65:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802e6c:	00 00 00 
+  802e6f:	ff d0                	call   *%rax
+  802e71:	89 c3                	mov    %eax,%ebx
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	78 1f                	js     802e96 <open+0x9e>
+    return fd2num(fd);
+  802e77:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e7b:	48 b8 28 19 80 00 00 	movabs $0x801928,%rax
+  802e82:	00 00 00 
+  802e85:	ff d0                	call   *%rax
+  802e87:	89 c3                	mov    %eax,%ebx
+}
+  802e89:	89 d8                	mov    %ebx,%eax
+  802e8b:	48 83 c4 18          	add    $0x18,%rsp
+  802e8f:	5b                   	pop    %rbx
+  802e90:	41 5c                	pop    %r12
+  802e92:	41 5d                	pop    %r13
+  802e94:	5d                   	pop    %rbp
+  802e95:	c3                   	ret
+        fd_close(fd, 0);
+  802e96:	be 00 00 00 00       	mov    $0x0,%esi
+  802e9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e9f:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  802ea6:	00 00 00 
+  802ea9:	ff d0                	call   *%rax
+        return res;
+  802eab:	eb dc                	jmp    802e89 <open+0x91>
+        return -E_BAD_PATH;
+  802ead:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802eb2:	eb d5                	jmp    802e89 <open+0x91>
+
+0000000000802eb4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802eb4:	55                   	push   %rbp
+  802eb5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802eb8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ebd:	bf 13 00 00 00       	mov    $0x13,%edi
+  802ec2:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802ec9:	00 00 00 
+  802ecc:	ff d0                	call   *%rax
+}
+  802ece:	5d                   	pop    %rbp
+  802ecf:	c3                   	ret
+
+0000000000802ed0 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802ed0:	55                   	push   %rbp
+  802ed1:	48 89 e5             	mov    %rsp,%rbp
+  802ed4:	41 55                	push   %r13
+  802ed6:	41 54                	push   %r12
+  802ed8:	53                   	push   %rbx
+  802ed9:	48 83 ec 08          	sub    $0x8,%rsp
+  802edd:	48 89 fb             	mov    %rdi,%rbx
+  802ee0:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802ee3:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802ee6:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+  802ef2:	41 89 c1             	mov    %eax,%r9d
+  802ef5:	4d 89 e0             	mov    %r12,%r8
+  802ef8:	49 29 d8             	sub    %rbx,%r8
+  802efb:	48 89 d9             	mov    %rbx,%rcx
+  802efe:	44 89 ea             	mov    %r13d,%edx
+  802f01:	48 89 de             	mov    %rbx,%rsi
+  802f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f09:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+}
+  802f15:	48 83 c4 08          	add    $0x8,%rsp
+  802f19:	5b                   	pop    %rbx
+  802f1a:	41 5c                	pop    %r12
+  802f1c:	41 5d                	pop    %r13
+  802f1e:	5d                   	pop    %rbp
+  802f1f:	c3                   	ret
+
+0000000000802f20 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	41 57                	push   %r15
+  802f26:	41 56                	push   %r14
+  802f28:	41 55                	push   %r13
+  802f2a:	41 54                	push   %r12
+  802f2c:	53                   	push   %rbx
+  802f2d:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802f34:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  802f37:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3c:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  802f43:	00 00 00 
+  802f46:	ff d0                	call   *%rax
+  802f48:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	0f 88 10 04 00 00    	js     803366 <spawn+0x446>
+  802f56:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802f58:	ba 00 02 00 00       	mov    $0x200,%edx
+  802f5d:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802f64:	48 b8 22 1e 80 00 00 	movabs $0x801e22,%rax
+  802f6b:	00 00 00 
+  802f6e:	ff d0                	call   *%rax
+  802f70:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802f72:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802f77:	0f 85 85 02 00 00    	jne    803202 <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802f7d:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802f84:	ff ff 00 
+  802f87:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802f8e:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802f95:	01 01 00 
+  802f98:	48 39 d0             	cmp    %rdx,%rax
+  802f9b:	0f 85 9d 02 00 00    	jne    80323e <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802fa1:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802fa8:	00 3e 00 
+  802fab:	0f 85 8d 02 00 00    	jne    80323e <spawn+0x31e>
+  802fb1:	b8 08 00 00 00       	mov    $0x8,%eax
+  802fb6:	cd 30                	int    $0x30
+  802fb8:	41 89 c6             	mov    %eax,%r14d
+  802fbb:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802fbd:	85 c0                	test   %eax,%eax
+  802fbf:	0f 88 89 03 00 00    	js     80334e <spawn+0x42e>
+    envid_t child = res;
+  802fc5:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802fcb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fd0:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802fd4:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  802fd8:	48 c1 e0 04          	shl    $0x4,%rax
+  802fdc:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802fe3:	00 00 00 
+  802fe6:	48 01 c6             	add    %rax,%rsi
+  802fe9:	48 8b 06             	mov    (%rsi),%rax
+  802fec:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802ff3:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802ffa:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803001:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803008:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80300f:	48 29 c6             	sub    %rax,%rsi
+  803012:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  803018:	89 c8                	mov    %ecx,%eax
+  80301a:	c1 e8 03             	shr    $0x3,%eax
+  80301d:	89 c1                	mov    %eax,%ecx
+  80301f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803022:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803029:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803030:	49 8b 3f             	mov    (%r15),%rdi
+  803033:	48 85 ff             	test   %rdi,%rdi
+  803036:	0f 84 41 06 00 00    	je     80367d <spawn+0x75d>
+  80303c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  803041:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803047:	49 bc 7f 0d 80 00 00 	movabs $0x800d7f,%r12
+  80304e:	00 00 00 
+  803051:	41 ff d4             	call   *%r12
+  803054:	4c 01 e8             	add    %r13,%rax
+  803057:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  80305b:	48 89 da             	mov    %rbx,%rdx
+  80305e:	48 83 c3 01          	add    $0x1,%rbx
+  803062:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  803067:	48 85 ff             	test   %rdi,%rdi
+  80306a:	75 e5                	jne    803051 <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80306c:	48 f7 d0             	not    %rax
+  80306f:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803076:	4d 89 e5             	mov    %r12,%r13
+  803079:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  80307d:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  803084:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  80308b:	89 d0                	mov    %edx,%eax
+  80308d:	83 c0 01             	add    $0x1,%eax
+  803090:	48 98                	cltq
+  803092:	48 c1 e0 03          	shl    $0x3,%rax
+  803096:	49 29 c5             	sub    %rax,%r13
+  803099:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8030a0:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  8030a4:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8030aa:	0f 86 c3 05 00 00    	jbe    803673 <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8030b0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030b5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8030ba:	be 00 00 40 00       	mov    $0x400000,%esi
+  8030bf:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  8030c6:	00 00 00 
+  8030c9:	ff d0                	call   *%rax
+  8030cb:	89 c3                	mov    %eax,%ebx
+  8030cd:	85 c0                	test   %eax,%eax
+  8030cf:	0f 88 67 02 00 00    	js     80333c <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  8030d5:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  8030dc:	85 d2                	test   %edx,%edx
+  8030de:	7e 54                	jle    803134 <spawn+0x214>
+  8030e0:	4c 89 fb             	mov    %r15,%rbx
+  8030e3:	48 63 c2             	movslq %edx,%rax
+  8030e6:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8030eb:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8030f2:	00 00 00 
+  8030f5:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  8030fc:	ff 
+  8030fd:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803101:	48 8b 33             	mov    (%rbx),%rsi
+  803104:	4c 89 e7             	mov    %r12,%rdi
+  803107:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803113:	48 8b 3b             	mov    (%rbx),%rdi
+  803116:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  80311d:	00 00 00 
+  803120:	ff d0                	call   *%rax
+  803122:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803127:	49 83 c5 08          	add    $0x8,%r13
+  80312b:	48 83 c3 08          	add    $0x8,%rbx
+  80312f:	4d 39 fd             	cmp    %r15,%r13
+  803132:	75 b7                	jne    8030eb <spawn+0x1cb>
+    argv_store[argc] = 0;
+  803134:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80313b:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803142:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803143:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  80314a:	0f 85 35 01 00 00    	jne    803285 <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803150:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803157:	00 00 00 
+  80315a:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803161:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803168:	ff 
+  803169:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  80316d:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803174:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803178:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  80317f:	00 00 00 
+  803182:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803189:	ff 
+  80318a:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803191:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803197:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  80319d:	44 89 f2             	mov    %r14d,%edx
+  8031a0:	be 00 00 40 00       	mov    $0x400000,%esi
+  8031a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031aa:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  8031b1:	00 00 00 
+  8031b4:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8031b6:	48 bb 15 15 80 00 00 	movabs $0x801515,%rbx
+  8031bd:	00 00 00 
+  8031c0:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8031c5:	be 00 00 40 00       	mov    $0x400000,%esi
+  8031ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cf:	ff d3                	call   *%rbx
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	78 eb                	js     8031c0 <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8031d5:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8031dc:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  8031e3:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8031e4:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8031eb:	00 
+  8031ec:	0f 84 7e 03 00 00    	je     803570 <spawn+0x650>
+  8031f2:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8031f9:	00 00 00 00 
+  8031fd:	e9 c0 01 00 00       	jmp    8033c2 <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803202:	48 bf c0 4a 80 00 00 	movabs $0x804ac0,%rdi
+  803209:	00 00 00 
+  80320c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803211:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  803218:	00 00 00 
+  80321b:	ff d2                	call   *%rdx
+        close(fd);
+  80321d:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803223:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  80322a:	00 00 00 
+  80322d:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80322f:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803236:	ff ff ff 
+  803239:	e9 28 01 00 00       	jmp    803366 <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80323e:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803243:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803249:	48 bf c1 4b 80 00 00 	movabs $0x804bc1,%rdi
+  803250:	00 00 00 
+  803253:	b8 00 00 00 00       	mov    $0x0,%eax
+  803258:	48 b9 98 04 80 00 00 	movabs $0x800498,%rcx
+  80325f:	00 00 00 
+  803262:	ff d1                	call   *%rcx
+        close(fd);
+  803264:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80326a:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803276:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80327d:	ff ff ff 
+  803280:	e9 e1 00 00 00       	jmp    803366 <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803285:	48 b9 f0 4a 80 00 00 	movabs $0x804af0,%rcx
+  80328c:	00 00 00 
+  80328f:	48 ba db 4b 80 00 00 	movabs $0x804bdb,%rdx
+  803296:	00 00 00 
+  803299:	be f0 00 00 00       	mov    $0xf0,%esi
+  80329e:	48 bf f0 4b 80 00 00 	movabs $0x804bf0,%rdi
+  8032a5:	00 00 00 
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ad:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  8032b4:	00 00 00 
+  8032b7:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  8032ba:	89 c3                	mov    %eax,%ebx
+  8032bc:	89 c6                	mov    %eax,%esi
+  8032be:	48 bf 20 4b 80 00 00 	movabs $0x804b20,%rdi
+  8032c5:	00 00 00 
+  8032c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cd:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  8032d4:	00 00 00 
+  8032d7:	ff d2                	call   *%rdx
+            return res;
+  8032d9:	eb 61                	jmp    80333c <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  8032db:	89 c3                	mov    %eax,%ebx
+  8032dd:	89 c6                	mov    %eax,%esi
+  8032df:	48 bf 48 4b 80 00 00 	movabs $0x804b48,%rdi
+  8032e6:	00 00 00 
+  8032e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ee:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  8032f5:	00 00 00 
+  8032f8:	ff d2                	call   *%rdx
+        return res;
+  8032fa:	eb 40                	jmp    80333c <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  8032fc:	89 c3                	mov    %eax,%ebx
+  8032fe:	89 c6                	mov    %eax,%esi
+  803300:	48 bf fc 4b 80 00 00 	movabs $0x804bfc,%rdi
+  803307:	00 00 00 
+  80330a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330f:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  803316:	00 00 00 
+  803319:	ff d2                	call   *%rdx
+        return res;
+  80331b:	eb 1f                	jmp    80333c <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  80331d:	89 c3                	mov    %eax,%ebx
+  80331f:	89 c6                	mov    %eax,%esi
+  803321:	48 bf 19 4c 80 00 00 	movabs $0x804c19,%rdi
+  803328:	00 00 00 
+  80332b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803330:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  803337:	00 00 00 
+  80333a:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  80333c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803342:	48 b8 1e 13 80 00 00 	movabs $0x80131e,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+    close(fd);
+  80334e:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803354:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  80335b:	00 00 00 
+  80335e:	ff d0                	call   *%rax
+    return res;
+  803360:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  803366:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  80336c:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803373:	5b                   	pop    %rbx
+  803374:	41 5c                	pop    %r12
+  803376:	41 5d                	pop    %r13
+  803378:	41 5e                	pop    %r14
+  80337a:	41 5f                	pop    %r15
+  80337c:	5d                   	pop    %rbp
+  80337d:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  80337e:	89 c3                	mov    %eax,%ebx
+  803380:	89 c6                	mov    %eax,%esi
+  803382:	48 bf 70 4b 80 00 00 	movabs $0x804b70,%rdi
+  803389:	00 00 00 
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803391:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  803398:	00 00 00 
+  80339b:	ff d2                	call   *%rdx
+        return res;
+  80339d:	eb 9d                	jmp    80333c <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80339f:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  8033a6:	01 
+  8033a7:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  8033ae:	48 83 c3 38          	add    $0x38,%rbx
+  8033b2:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8033b9:	48 39 c1             	cmp    %rax,%rcx
+  8033bc:	0f 83 ae 01 00 00    	jae    803570 <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8033c2:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8033c5:	75 d8                	jne    80339f <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8033c7:	8b 43 04             	mov    0x4(%rbx),%eax
+  8033ca:	41 89 c6             	mov    %eax,%r14d
+  8033cd:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8033d1:	44 89 f2             	mov    %r14d,%edx
+  8033d4:	83 ca 04             	or     $0x4,%edx
+  8033d7:	a8 04                	test   $0x4,%al
+  8033d9:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8033dd:	44 89 f2             	mov    %r14d,%edx
+  8033e0:	83 ca 01             	or     $0x1,%edx
+  8033e3:	a8 01                	test   $0x1,%al
+  8033e5:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8033e9:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  8033ed:	41 89 cc             	mov    %ecx,%r12d
+  8033f0:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8033f4:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  8033f8:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  8033fc:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803402:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  803408:	44 89 fe             	mov    %r15d,%esi
+  80340b:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803411:	74 0f                	je     803422 <spawn+0x502>
+        va -= res;
+  803413:	48 63 fe             	movslq %esi,%rdi
+  803416:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  803419:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  80341c:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  80341f:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803422:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  803429:	00 
+  80342a:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803431:	49 89 f5             	mov    %rsi,%r13
+  803434:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  803437:	49 39 d5             	cmp    %rdx,%r13
+  80343a:	73 23                	jae    80345f <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  80343c:	4c 01 fa             	add    %r15,%rdx
+  80343f:	48 29 f2             	sub    %rsi,%rdx
+  803442:	44 89 f1             	mov    %r14d,%ecx
+  803445:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  80344b:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803452:	00 00 00 
+  803455:	ff d0                	call   *%rax
+        if (res < 0) {
+  803457:	85 c0                	test   %eax,%eax
+  803459:	0f 88 5b fe ff ff    	js     8032ba <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  80345f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803464:	4c 89 ea             	mov    %r13,%rdx
+  803467:	be 00 00 40 00       	mov    $0x400000,%esi
+  80346c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803471:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	0f 88 56 fe ff ff    	js     8032db <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  803485:	44 89 e6             	mov    %r12d,%esi
+  803488:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80348e:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  803495:	00 00 00 
+  803498:	ff d0                	call   *%rax
+    if (res < 0) {
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	0f 88 5a fe ff ff    	js     8032fc <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  8034a2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8034a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ad:	4d 85 ed             	test   %r13,%r13
+  8034b0:	74 48                	je     8034fa <spawn+0x5da>
+  8034b2:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  8034b9:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  8034bf:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8034c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034cb:	89 df                	mov    %ebx,%edi
+  8034cd:	48 b8 22 1e 80 00 00 	movabs $0x801e22,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+        if (res < 0) {
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	0f 88 3c fe ff ff    	js     80331d <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  8034e1:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  8034e8:	00 
+  8034e9:	41 89 c4             	mov    %eax,%r12d
+  8034ec:	48 98                	cltq
+  8034ee:	4c 39 e8             	cmp    %r13,%rax
+  8034f1:	72 cc                	jb     8034bf <spawn+0x59f>
+  8034f3:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  8034fa:	45 89 f1             	mov    %r14d,%r9d
+  8034fd:	41 80 c9 80          	or     $0x80,%r9b
+  803501:	4d 89 e8             	mov    %r13,%r8
+  803504:	4c 89 f9             	mov    %r15,%rcx
+  803507:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  80350d:	be 00 00 40 00       	mov    $0x400000,%esi
+  803512:	bf 00 00 00 00       	mov    $0x0,%edi
+  803517:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  80351e:	00 00 00 
+  803521:	ff d0                	call   *%rax
+    if (res < 0) {
+  803523:	85 c0                	test   %eax,%eax
+  803525:	0f 88 53 fe ff ff    	js     80337e <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  80352b:	4c 89 ea             	mov    %r13,%rdx
+  80352e:	be 00 00 40 00       	mov    $0x400000,%esi
+  803533:	bf 00 00 00 00       	mov    $0x0,%edi
+  803538:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+    if (res < 0) {
+  803544:	85 c0                	test   %eax,%eax
+  803546:	0f 89 53 fe ff ff    	jns    80339f <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  80354c:	89 c3                	mov    %eax,%ebx
+  80354e:	89 c6                	mov    %eax,%esi
+  803550:	48 bf 98 4b 80 00 00 	movabs $0x804b98,%rdi
+  803557:	00 00 00 
+  80355a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355f:	48 ba 98 04 80 00 00 	movabs $0x800498,%rdx
+  803566:	00 00 00 
+  803569:	ff d2                	call   *%rdx
+        return res;
+  80356b:	e9 cc fd ff ff       	jmp    80333c <spawn+0x41c>
+    close(fd);
+  803570:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803576:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803582:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803589:	48 bf d0 2e 80 00 00 	movabs $0x802ed0,%rdi
+  803590:	00 00 00 
+  803593:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+  80359f:	85 c0                	test   %eax,%eax
+  8035a1:	78 49                	js     8035ec <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8035a3:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8035aa:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8035b0:	48 b8 e5 15 80 00 00 	movabs $0x8015e5,%rax
+  8035b7:	00 00 00 
+  8035ba:	ff d0                	call   *%rax
+  8035bc:	85 c0                	test   %eax,%eax
+  8035be:	78 59                	js     803619 <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8035c0:	be 02 00 00 00       	mov    $0x2,%esi
+  8035c5:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8035cb:	48 b8 7c 15 80 00 00 	movabs $0x80157c,%rax
+  8035d2:	00 00 00 
+  8035d5:	ff d0                	call   *%rax
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	78 6b                	js     803646 <spawn+0x726>
+    return child;
+  8035db:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8035e1:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  8035e7:	e9 7a fd ff ff       	jmp    803366 <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  8035ec:	89 c1                	mov    %eax,%ecx
+  8035ee:	48 ba 37 4c 80 00 00 	movabs $0x804c37,%rdx
+  8035f5:	00 00 00 
+  8035f8:	be 84 00 00 00       	mov    $0x84,%esi
+  8035fd:	48 bf f0 4b 80 00 00 	movabs $0x804bf0,%rdi
+  803604:	00 00 00 
+  803607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360c:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  803613:	00 00 00 
+  803616:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803619:	89 c1                	mov    %eax,%ecx
+  80361b:	48 ba 4e 4c 80 00 00 	movabs $0x804c4e,%rdx
+  803622:	00 00 00 
+  803625:	be 87 00 00 00       	mov    $0x87,%esi
+  80362a:	48 bf f0 4b 80 00 00 	movabs $0x804bf0,%rdi
+  803631:	00 00 00 
+  803634:	b8 00 00 00 00       	mov    $0x0,%eax
+  803639:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  803640:	00 00 00 
+  803643:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803646:	89 c1                	mov    %eax,%ecx
+  803648:	48 ba 68 4c 80 00 00 	movabs $0x804c68,%rdx
+  80364f:	00 00 00 
+  803652:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803657:	48 bf f0 4b 80 00 00 	movabs $0x804bf0,%rdi
+  80365e:	00 00 00 
+  803661:	b8 00 00 00 00       	mov    $0x0,%eax
+  803666:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  80366d:	00 00 00 
+  803670:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803673:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803678:	e9 bf fc ff ff       	jmp    80333c <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80367d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803682:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803687:	be 00 00 40 00       	mov    $0x400000,%esi
+  80368c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803691:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803698:	00 00 00 
+  80369b:	ff d0                	call   *%rax
+  80369d:	89 c3                	mov    %eax,%ebx
+  80369f:	85 c0                	test   %eax,%eax
+  8036a1:	0f 88 95 fc ff ff    	js     80333c <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8036a7:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8036ae:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8036b2:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  8036b9:	f8 ff 40 00 
+  8036bd:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8036c4:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8036c8:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  8036ce:	e9 61 fa ff ff       	jmp    803134 <spawn+0x214>
+
+00000000008036d3 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8036d3:	55                   	push   %rbp
+  8036d4:	48 89 e5             	mov    %rsp,%rbp
+  8036d7:	48 83 ec 50          	sub    $0x50,%rsp
+  8036db:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8036df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8036e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8036e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8036eb:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8036f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8036f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8036fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803702:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803707:	eb 15                	jmp    80371e <spawnl+0x4b>
+  803709:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80370d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803711:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803715:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803719:	74 1c                	je     803737 <spawnl+0x64>
+  80371b:	83 c1 01             	add    $0x1,%ecx
+  80371e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803721:	83 f8 2f             	cmp    $0x2f,%eax
+  803724:	77 e3                	ja     803709 <spawnl+0x36>
+  803726:	89 c2                	mov    %eax,%edx
+  803728:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80372c:	4c 01 d2             	add    %r10,%rdx
+  80372f:	83 c0 08             	add    $0x8,%eax
+  803732:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803735:	eb de                	jmp    803715 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803737:	8d 41 02             	lea    0x2(%rcx),%eax
+  80373a:	48 98                	cltq
+  80373c:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803743:	00 
+  803744:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803748:	48 29 c4             	sub    %rax,%rsp
+  80374b:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803750:	4c 89 c0             	mov    %r8,%rax
+  803753:	48 c1 e8 03          	shr    $0x3,%rax
+  803757:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80375b:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803762:	00 
+    argv[argc + 1] = NULL;
+  803763:	8d 41 01             	lea    0x1(%rcx),%eax
+  803766:	48 98                	cltq
+  803768:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80376f:	00 
+    va_start(vl, arg0);
+  803770:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803777:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80377b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803783:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803787:	85 c9                	test   %ecx,%ecx
+  803789:	74 41                	je     8037cc <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80378b:	49 89 c1             	mov    %rax,%r9
+  80378e:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803792:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803795:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80379a:	eb 1b                	jmp    8037b7 <spawnl+0xe4>
+  80379c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037a0:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8037a4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8037a8:	48 8b 11             	mov    (%rcx),%rdx
+  8037ab:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8037ae:	48 83 c0 08          	add    $0x8,%rax
+  8037b2:	48 39 f0             	cmp    %rsi,%rax
+  8037b5:	74 15                	je     8037cc <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8037b7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8037ba:	83 fa 2f             	cmp    $0x2f,%edx
+  8037bd:	77 dd                	ja     80379c <spawnl+0xc9>
+  8037bf:	89 d1                	mov    %edx,%ecx
+  8037c1:	4c 01 c9             	add    %r9,%rcx
+  8037c4:	83 c2 08             	add    $0x8,%edx
+  8037c7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8037ca:	eb dc                	jmp    8037a8 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8037cc:	4c 89 c6             	mov    %r8,%rsi
+  8037cf:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  8037d6:	00 00 00 
+  8037d9:	ff d0                	call   *%rax
+}
+  8037db:	c9                   	leave
+  8037dc:	c3                   	ret
+
+00000000008037dd <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8037dd:	55                   	push   %rbp
+  8037de:	48 89 e5             	mov    %rsp,%rbp
+  8037e1:	41 54                	push   %r12
+  8037e3:	53                   	push   %rbx
+  8037e4:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037e7:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+  8037f3:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8037f6:	48 be 7f 4c 80 00 00 	movabs $0x804c7f,%rsi
+  8037fd:	00 00 00 
+  803800:	48 89 df             	mov    %rbx,%rdi
+  803803:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  80380a:	00 00 00 
+  80380d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80380f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803814:	41 2b 04 24          	sub    (%r12),%eax
+  803818:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80381e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803825:	00 00 00 
+    stat->st_dev = &devpipe;
+  803828:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  80382f:	00 00 00 
+  803832:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383e:	5b                   	pop    %rbx
+  80383f:	41 5c                	pop    %r12
+  803841:	5d                   	pop    %rbp
+  803842:	c3                   	ret
+
+0000000000803843 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803843:	55                   	push   %rbp
+  803844:	48 89 e5             	mov    %rsp,%rbp
+  803847:	41 54                	push   %r12
+  803849:	53                   	push   %rbx
+  80384a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80384d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803852:	48 89 fe             	mov    %rdi,%rsi
+  803855:	bf 00 00 00 00       	mov    $0x0,%edi
+  80385a:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  803861:	00 00 00 
+  803864:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803867:	48 89 df             	mov    %rbx,%rdi
+  80386a:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  803871:	00 00 00 
+  803874:	ff d0                	call   *%rax
+  803876:	48 89 c6             	mov    %rax,%rsi
+  803879:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80387e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803883:	41 ff d4             	call   *%r12
+}
+  803886:	5b                   	pop    %rbx
+  803887:	41 5c                	pop    %r12
+  803889:	5d                   	pop    %rbp
+  80388a:	c3                   	ret
+
+000000000080388b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80388b:	55                   	push   %rbp
+  80388c:	48 89 e5             	mov    %rsp,%rbp
+  80388f:	41 57                	push   %r15
+  803891:	41 56                	push   %r14
+  803893:	41 55                	push   %r13
+  803895:	41 54                	push   %r12
+  803897:	53                   	push   %rbx
+  803898:	48 83 ec 18          	sub    $0x18,%rsp
+  80389c:	49 89 fc             	mov    %rdi,%r12
+  80389f:	49 89 f5             	mov    %rsi,%r13
+  8038a2:	49 89 d7             	mov    %rdx,%r15
+  8038a5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038a9:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8038b5:	4d 85 ff             	test   %r15,%r15
+  8038b8:	0f 84 af 00 00 00    	je     80396d <devpipe_write+0xe2>
+  8038be:	48 89 c3             	mov    %rax,%rbx
+  8038c1:	4c 89 f8             	mov    %r15,%rax
+  8038c4:	4d 89 ef             	mov    %r13,%r15
+  8038c7:	4c 01 e8             	add    %r13,%rax
+  8038ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038ce:	49 bd 1d 14 80 00 00 	movabs $0x80141d,%r13
+  8038d5:	00 00 00 
+            sys_yield();
+  8038d8:	49 be ba 13 80 00 00 	movabs $0x8013ba,%r14
+  8038df:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038e2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038e5:	48 63 ce             	movslq %esi,%rcx
+  8038e8:	48 63 03             	movslq (%rbx),%rax
+  8038eb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8038f1:	48 39 c1             	cmp    %rax,%rcx
+  8038f4:	72 2e                	jb     803924 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038fb:	48 89 da             	mov    %rbx,%rdx
+  8038fe:	be 00 10 00 00       	mov    $0x1000,%esi
+  803903:	4c 89 e7             	mov    %r12,%rdi
+  803906:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803909:	85 c0                	test   %eax,%eax
+  80390b:	74 66                	je     803973 <devpipe_write+0xe8>
+            sys_yield();
+  80390d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803910:	8b 73 04             	mov    0x4(%rbx),%esi
+  803913:	48 63 ce             	movslq %esi,%rcx
+  803916:	48 63 03             	movslq (%rbx),%rax
+  803919:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80391f:	48 39 c1             	cmp    %rax,%rcx
+  803922:	73 d2                	jae    8038f6 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803924:	41 0f b6 3f          	movzbl (%r15),%edi
+  803928:	48 89 ca             	mov    %rcx,%rdx
+  80392b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80392f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803936:	08 10 20 
+  803939:	48 f7 e2             	mul    %rdx
+  80393c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803940:	48 89 d0             	mov    %rdx,%rax
+  803943:	48 c1 e0 09          	shl    $0x9,%rax
+  803947:	48 29 d0             	sub    %rdx,%rax
+  80394a:	48 c1 e0 03          	shl    $0x3,%rax
+  80394e:	48 29 c1             	sub    %rax,%rcx
+  803951:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803956:	83 c6 01             	add    $0x1,%esi
+  803959:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80395c:	49 83 c7 01          	add    $0x1,%r15
+  803960:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803964:	49 39 c7             	cmp    %rax,%r15
+  803967:	0f 85 75 ff ff ff    	jne    8038e2 <devpipe_write+0x57>
+    return n;
+  80396d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803971:	eb 05                	jmp    803978 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803973:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803978:	48 83 c4 18          	add    $0x18,%rsp
+  80397c:	5b                   	pop    %rbx
+  80397d:	41 5c                	pop    %r12
+  80397f:	41 5d                	pop    %r13
+  803981:	41 5e                	pop    %r14
+  803983:	41 5f                	pop    %r15
+  803985:	5d                   	pop    %rbp
+  803986:	c3                   	ret
+
+0000000000803987 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803987:	55                   	push   %rbp
+  803988:	48 89 e5             	mov    %rsp,%rbp
+  80398b:	41 57                	push   %r15
+  80398d:	41 56                	push   %r14
+  80398f:	41 55                	push   %r13
+  803991:	41 54                	push   %r12
+  803993:	53                   	push   %rbx
+  803994:	48 83 ec 18          	sub    $0x18,%rsp
+  803998:	49 89 fc             	mov    %rdi,%r12
+  80399b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80399f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039a3:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8039aa:	00 00 00 
+  8039ad:	ff d0                	call   *%rax
+  8039af:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039b2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039b8:	49 bd 1d 14 80 00 00 	movabs $0x80141d,%r13
+  8039bf:	00 00 00 
+            sys_yield();
+  8039c2:	49 be ba 13 80 00 00 	movabs $0x8013ba,%r14
+  8039c9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039cc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8039d1:	74 7d                	je     803a50 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039d3:	8b 03                	mov    (%rbx),%eax
+  8039d5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8039d8:	75 26                	jne    803a00 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8039da:	4d 85 ff             	test   %r15,%r15
+  8039dd:	75 77                	jne    803a56 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039df:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039e4:	48 89 da             	mov    %rbx,%rdx
+  8039e7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039ec:	4c 89 e7             	mov    %r12,%rdi
+  8039ef:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f2:	85 c0                	test   %eax,%eax
+  8039f4:	74 72                	je     803a68 <devpipe_read+0xe1>
+            sys_yield();
+  8039f6:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039f9:	8b 03                	mov    (%rbx),%eax
+  8039fb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8039fe:	74 df                	je     8039df <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a00:	48 63 c8             	movslq %eax,%rcx
+  803a03:	48 89 ca             	mov    %rcx,%rdx
+  803a06:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a0a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803a11:	08 10 20 
+  803a14:	48 89 d0             	mov    %rdx,%rax
+  803a17:	48 f7 e6             	mul    %rsi
+  803a1a:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a1e:	48 89 d0             	mov    %rdx,%rax
+  803a21:	48 c1 e0 09          	shl    $0x9,%rax
+  803a25:	48 29 d0             	sub    %rdx,%rax
+  803a28:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803a2f:	00 
+  803a30:	48 89 c8             	mov    %rcx,%rax
+  803a33:	48 29 d0             	sub    %rdx,%rax
+  803a36:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803a3b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a3f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803a43:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a46:	49 83 c7 01          	add    $0x1,%r15
+  803a4a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803a4e:	75 83                	jne    8039d3 <devpipe_read+0x4c>
+    return n;
+  803a50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a54:	eb 03                	jmp    803a59 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803a56:	4c 89 f8             	mov    %r15,%rax
+}
+  803a59:	48 83 c4 18          	add    $0x18,%rsp
+  803a5d:	5b                   	pop    %rbx
+  803a5e:	41 5c                	pop    %r12
+  803a60:	41 5d                	pop    %r13
+  803a62:	41 5e                	pop    %r14
+  803a64:	41 5f                	pop    %r15
+  803a66:	5d                   	pop    %rbp
+  803a67:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803a68:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6d:	eb ea                	jmp    803a59 <devpipe_read+0xd2>
+
+0000000000803a6f <pipe>:
+pipe(int pfd[2]) {
+  803a6f:	55                   	push   %rbp
+  803a70:	48 89 e5             	mov    %rsp,%rbp
+  803a73:	41 55                	push   %r13
+  803a75:	41 54                	push   %r12
+  803a77:	53                   	push   %rbx
+  803a78:	48 83 ec 18          	sub    $0x18,%rsp
+  803a7c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a7f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a83:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  803a8a:	00 00 00 
+  803a8d:	ff d0                	call   *%rax
+  803a8f:	89 c3                	mov    %eax,%ebx
+  803a91:	85 c0                	test   %eax,%eax
+  803a93:	0f 88 a0 01 00 00    	js     803c39 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a99:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aac:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803ab3:	00 00 00 
+  803ab6:	ff d0                	call   *%rax
+  803ab8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803aba:	85 c0                	test   %eax,%eax
+  803abc:	0f 88 77 01 00 00    	js     803c39 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ac2:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ac6:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  803acd:	00 00 00 
+  803ad0:	ff d0                	call   *%rax
+  803ad2:	89 c3                	mov    %eax,%ebx
+  803ad4:	85 c0                	test   %eax,%eax
+  803ad6:	0f 88 43 01 00 00    	js     803c1f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803adc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ae1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ae6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803aea:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aef:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803af6:	00 00 00 
+  803af9:	ff d0                	call   *%rax
+  803afb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	0f 88 1a 01 00 00    	js     803c1f <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b05:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b09:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  803b10:	00 00 00 
+  803b13:	ff d0                	call   *%rax
+  803b15:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b18:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b22:	48 89 c6             	mov    %rax,%rsi
+  803b25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2a:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  803b31:	00 00 00 
+  803b34:	ff d0                	call   *%rax
+  803b36:	89 c3                	mov    %eax,%ebx
+  803b38:	85 c0                	test   %eax,%eax
+  803b3a:	0f 88 c5 00 00 00    	js     803c05 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b40:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b44:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  803b4b:	00 00 00 
+  803b4e:	ff d0                	call   *%rax
+  803b50:	48 89 c1             	mov    %rax,%rcx
+  803b53:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b59:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b64:	4c 89 ee             	mov    %r13,%rsi
+  803b67:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b6c:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  803b73:	00 00 00 
+  803b76:	ff d0                	call   *%rax
+  803b78:	89 c3                	mov    %eax,%ebx
+  803b7a:	85 c0                	test   %eax,%eax
+  803b7c:	78 6e                	js     803bec <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b7e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b83:	4c 89 ef             	mov    %r13,%rdi
+  803b86:	48 b8 eb 13 80 00 00 	movabs $0x8013eb,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	83 f8 02             	cmp    $0x2,%eax
+  803b95:	0f 85 ab 00 00 00    	jne    803c46 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b9b:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  803ba2:	00 00 
+  803ba4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ba8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803baa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bae:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bb5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803bb9:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bbb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bbf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803bc6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bca:	48 bb 28 19 80 00 00 	movabs $0x801928,%rbx
+  803bd1:	00 00 00 
+  803bd4:	ff d3                	call   *%rbx
+  803bd6:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803bda:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803bde:	ff d3                	call   *%rbx
+  803be0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803be5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bea:	eb 4d                	jmp    803c39 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803bec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf1:	4c 89 ee             	mov    %r13,%rsi
+  803bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf9:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c0a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c13:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c1a:	00 00 00 
+  803c1d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c24:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c2d:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803c34:	00 00 00 
+  803c37:	ff d0                	call   *%rax
+}
+  803c39:	89 d8                	mov    %ebx,%eax
+  803c3b:	48 83 c4 18          	add    $0x18,%rsp
+  803c3f:	5b                   	pop    %rbx
+  803c40:	41 5c                	pop    %r12
+  803c42:	41 5d                	pop    %r13
+  803c44:	5d                   	pop    %rbp
+  803c45:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c46:	48 b9 98 4c 80 00 00 	movabs $0x804c98,%rcx
+  803c4d:	00 00 00 
+  803c50:	48 ba db 4b 80 00 00 	movabs $0x804bdb,%rdx
+  803c57:	00 00 00 
+  803c5a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803c5f:	48 bf 86 4c 80 00 00 	movabs $0x804c86,%rdi
+  803c66:	00 00 00 
+  803c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c6e:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  803c75:	00 00 00 
+  803c78:	41 ff d0             	call   *%r8
+
+0000000000803c7b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c7b:	55                   	push   %rbp
+  803c7c:	48 89 e5             	mov    %rsp,%rbp
+  803c7f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c83:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c87:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  803c8e:	00 00 00 
+  803c91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c93:	85 c0                	test   %eax,%eax
+  803c95:	78 35                	js     803ccc <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c97:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c9b:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+  803ca7:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803caa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803caf:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cb4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cb8:	48 b8 1d 14 80 00 00 	movabs $0x80141d,%rax
+  803cbf:	00 00 00 
+  803cc2:	ff d0                	call   *%rax
+  803cc4:	85 c0                	test   %eax,%eax
+  803cc6:	0f 94 c0             	sete   %al
+  803cc9:	0f b6 c0             	movzbl %al,%eax
+}
+  803ccc:	c9                   	leave
+  803ccd:	c3                   	ret
+
+0000000000803cce <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803cce:	55                   	push   %rbp
+  803ccf:	48 89 e5             	mov    %rsp,%rbp
+  803cd2:	41 55                	push   %r13
+  803cd4:	41 54                	push   %r12
+  803cd6:	53                   	push   %rbx
+  803cd7:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803cdb:	85 ff                	test   %edi,%edi
+  803cdd:	74 7d                	je     803d5c <wait+0x8e>
+  803cdf:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803ce2:	89 f8                	mov    %edi,%eax
+  803ce4:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803ce9:	89 fa                	mov    %edi,%edx
+  803ceb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803cf1:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  803cf5:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  803cf9:	48 c1 e1 04          	shl    $0x4,%rcx
+  803cfd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803d04:	00 00 00 
+  803d07:	48 01 ca             	add    %rcx,%rdx
+  803d0a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803d10:	39 d7                	cmp    %edx,%edi
+  803d12:	75 3d                	jne    803d51 <wait+0x83>
+           env->env_status != ENV_FREE) {
+  803d14:	48 98                	cltq
+  803d16:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803d1a:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  803d1e:	48 c1 e0 04          	shl    $0x4,%rax
+  803d22:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803d29:	00 00 00 
+  803d2c:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803d2f:	49 bd ba 13 80 00 00 	movabs $0x8013ba,%r13
+  803d36:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803d39:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803d3f:	85 c0                	test   %eax,%eax
+  803d41:	74 0e                	je     803d51 <wait+0x83>
+        sys_yield();
+  803d43:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803d46:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803d4c:	44 39 e0             	cmp    %r12d,%eax
+  803d4f:	74 e8                	je     803d39 <wait+0x6b>
+    }
+}
+  803d51:	48 83 c4 08          	add    $0x8,%rsp
+  803d55:	5b                   	pop    %rbx
+  803d56:	41 5c                	pop    %r12
+  803d58:	41 5d                	pop    %r13
+  803d5a:	5d                   	pop    %rbp
+  803d5b:	c3                   	ret
+    assert(envid != 0);
+  803d5c:	48 b9 bc 4c 80 00 00 	movabs $0x804cbc,%rcx
+  803d63:	00 00 00 
+  803d66:	48 ba db 4b 80 00 00 	movabs $0x804bdb,%rdx
+  803d6d:	00 00 00 
+  803d70:	be 06 00 00 00       	mov    $0x6,%esi
+  803d75:	48 bf c7 4c 80 00 00 	movabs $0x804cc7,%rdi
+  803d7c:	00 00 00 
+  803d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d84:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  803d8b:	00 00 00 
+  803d8e:	41 ff d0             	call   *%r8
+
+0000000000803d91 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d91:	48 89 f8             	mov    %rdi,%rax
+  803d94:	48 c1 e8 27          	shr    $0x27,%rax
+  803d98:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803d9f:	01 00 00 
+  803da2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803da6:	f6 c2 01             	test   $0x1,%dl
+  803da9:	74 6d                	je     803e18 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dab:	48 89 f8             	mov    %rdi,%rax
+  803dae:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803db2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803db9:	01 00 00 
+  803dbc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dc0:	f6 c2 01             	test   $0x1,%dl
+  803dc3:	74 62                	je     803e27 <get_uvpt_entry+0x96>
+  803dc5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dcc:	01 00 00 
+  803dcf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dd3:	f6 c2 80             	test   $0x80,%dl
+  803dd6:	75 4f                	jne    803e27 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dd8:	48 89 f8             	mov    %rdi,%rax
+  803ddb:	48 c1 e8 15          	shr    $0x15,%rax
+  803ddf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803de6:	01 00 00 
+  803de9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ded:	f6 c2 01             	test   $0x1,%dl
+  803df0:	74 44                	je     803e36 <get_uvpt_entry+0xa5>
+  803df2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803df9:	01 00 00 
+  803dfc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e00:	f6 c2 80             	test   $0x80,%dl
+  803e03:	75 31                	jne    803e36 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e05:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e09:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e10:	01 00 00 
+  803e13:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e17:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e18:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e1f:	01 00 00 
+  803e22:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e26:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e27:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e2e:	01 00 00 
+  803e31:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e35:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e36:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e3d:	01 00 00 
+  803e40:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e44:	c3                   	ret
+
+0000000000803e45 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e45:	55                   	push   %rbp
+  803e46:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e49:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  803e50:	00 00 00 
+  803e53:	ff d0                	call   *%rax
+  803e55:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e58:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e5d:	89 c1                	mov    %eax,%ecx
+  803e5f:	83 c9 04             	or     $0x4,%ecx
+  803e62:	f6 c2 01             	test   $0x1,%dl
+  803e65:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e68:	89 c1                	mov    %eax,%ecx
+  803e6a:	83 c9 02             	or     $0x2,%ecx
+  803e6d:	f6 c2 02             	test   $0x2,%dl
+  803e70:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e73:	89 c1                	mov    %eax,%ecx
+  803e75:	83 c9 01             	or     $0x1,%ecx
+  803e78:	48 85 d2             	test   %rdx,%rdx
+  803e7b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e7e:	89 c1                	mov    %eax,%ecx
+  803e80:	83 c9 40             	or     $0x40,%ecx
+  803e83:	f6 c6 04             	test   $0x4,%dh
+  803e86:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e89:	5d                   	pop    %rbp
+  803e8a:	c3                   	ret
+
+0000000000803e8b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e8b:	55                   	push   %rbp
+  803e8c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e8f:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e9b:	48 c1 e8 06          	shr    $0x6,%rax
+  803e9f:	83 e0 01             	and    $0x1,%eax
+}
+  803ea2:	5d                   	pop    %rbp
+  803ea3:	c3                   	ret
+
+0000000000803ea4 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803ea4:	55                   	push   %rbp
+  803ea5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ea8:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  803eb4:	48 c1 e8 05          	shr    $0x5,%rax
+  803eb8:	83 e0 01             	and    $0x1,%eax
+}
+  803ebb:	5d                   	pop    %rbp
+  803ebc:	c3                   	ret
+
+0000000000803ebd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ebd:	55                   	push   %rbp
+  803ebe:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ec1:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  803ec8:	00 00 00 
+  803ecb:	ff d0                	call   *%rax
+  803ecd:	83 e0 01             	and    $0x1,%eax
+}
+  803ed0:	5d                   	pop    %rbp
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	41 57                	push   %r15
+  803ed8:	41 56                	push   %r14
+  803eda:	41 55                	push   %r13
+  803edc:	41 54                	push   %r12
+  803ede:	53                   	push   %rbx
+  803edf:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ee7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803eeb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803ef0:	49 bd bd 3e 80 00 00 	movabs $0x803ebd,%r13
+  803ef7:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803efa:	49 bf 45 3e 80 00 00 	movabs $0x803e45,%r15
+  803f01:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803f04:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803f0b:	00 00 00 
+  803f0e:	eb 0c                	jmp    803f1c <foreach_shared_region+0x4a>
+  803f10:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f17:	4c 39 f3             	cmp    %r14,%rbx
+  803f1a:	74 2e                	je     803f4a <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803f1c:	48 89 df             	mov    %rbx,%rdi
+  803f1f:	41 ff d5             	call   *%r13
+  803f22:	84 c0                	test   %al,%al
+  803f24:	74 ea                	je     803f10 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803f26:	48 89 df             	mov    %rbx,%rdi
+  803f29:	41 ff d7             	call   *%r15
+  803f2c:	a8 40                	test   $0x40,%al
+  803f2e:	74 e0                	je     803f10 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803f30:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f3b:	48 89 df             	mov    %rbx,%rdi
+  803f3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f42:	ff d0                	call   *%rax
+				if (res < 0) {
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	79 c8                	jns    803f10 <foreach_shared_region+0x3e>
+  803f48:	eb 05                	jmp    803f4f <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  803f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f4f:	48 83 c4 18          	add    $0x18,%rsp
+  803f53:	5b                   	pop    %rbx
+  803f54:	41 5c                	pop    %r12
+  803f56:	41 5d                	pop    %r13
+  803f58:	41 5e                	pop    %r14
+  803f5a:	41 5f                	pop    %r15
+  803f5c:	5d                   	pop    %rbp
+  803f5d:	c3                   	ret
+
+0000000000803f5e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f63:	c3                   	ret
+
+0000000000803f64 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f64:	55                   	push   %rbp
+  803f65:	48 89 e5             	mov    %rsp,%rbp
+  803f68:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f6b:	48 be d2 4c 80 00 00 	movabs $0x804cd2,%rsi
+  803f72:	00 00 00 
+  803f75:	48 b8 bd 0d 80 00 00 	movabs $0x800dbd,%rax
+  803f7c:	00 00 00 
+  803f7f:	ff d0                	call   *%rax
+    return 0;
+}
+  803f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f86:	5d                   	pop    %rbp
+  803f87:	c3                   	ret
+
+0000000000803f88 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f88:	55                   	push   %rbp
+  803f89:	48 89 e5             	mov    %rsp,%rbp
+  803f8c:	41 57                	push   %r15
+  803f8e:	41 56                	push   %r14
+  803f90:	41 55                	push   %r13
+  803f92:	41 54                	push   %r12
+  803f94:	53                   	push   %rbx
+  803f95:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f9c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803fa3:	48 85 d2             	test   %rdx,%rdx
+  803fa6:	74 7a                	je     804022 <devcons_write+0x9a>
+  803fa8:	49 89 d6             	mov    %rdx,%r14
+  803fab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fb1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803fb6:	49 bf b7 0f 80 00 00 	movabs $0x800fb7,%r15
+  803fbd:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fc0:	4c 89 f3             	mov    %r14,%rbx
+  803fc3:	48 29 f3             	sub    %rsi,%rbx
+  803fc6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fcb:	48 39 c3             	cmp    %rax,%rbx
+  803fce:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fd2:	4c 63 eb             	movslq %ebx,%r13
+  803fd5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fdc:	48 01 c6             	add    %rax,%rsi
+  803fdf:	4c 89 ea             	mov    %r13,%rdx
+  803fe2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fe9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fec:	4c 89 ee             	mov    %r13,%rsi
+  803fef:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ff6:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804002:	41 01 dc             	add    %ebx,%r12d
+  804005:	49 63 f4             	movslq %r12d,%rsi
+  804008:	4c 39 f6             	cmp    %r14,%rsi
+  80400b:	72 b3                	jb     803fc0 <devcons_write+0x38>
+    return res;
+  80400d:	49 63 c4             	movslq %r12d,%rax
+}
+  804010:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804017:	5b                   	pop    %rbx
+  804018:	41 5c                	pop    %r12
+  80401a:	41 5d                	pop    %r13
+  80401c:	41 5e                	pop    %r14
+  80401e:	41 5f                	pop    %r15
+  804020:	5d                   	pop    %rbp
+  804021:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804022:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804028:	eb e3                	jmp    80400d <devcons_write+0x85>
+
+000000000080402a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80402a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80402d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804032:	48 85 c0             	test   %rax,%rax
+  804035:	74 55                	je     80408c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804037:	55                   	push   %rbp
+  804038:	48 89 e5             	mov    %rsp,%rbp
+  80403b:	41 55                	push   %r13
+  80403d:	41 54                	push   %r12
+  80403f:	53                   	push   %rbx
+  804040:	48 83 ec 08          	sub    $0x8,%rsp
+  804044:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804047:	48 bb ed 12 80 00 00 	movabs $0x8012ed,%rbx
+  80404e:	00 00 00 
+  804051:	49 bc ba 13 80 00 00 	movabs $0x8013ba,%r12
+  804058:	00 00 00 
+  80405b:	eb 03                	jmp    804060 <devcons_read+0x36>
+  80405d:	41 ff d4             	call   *%r12
+  804060:	ff d3                	call   *%rbx
+  804062:	85 c0                	test   %eax,%eax
+  804064:	74 f7                	je     80405d <devcons_read+0x33>
+    if (c < 0) return c;
+  804066:	48 63 d0             	movslq %eax,%rdx
+  804069:	78 13                	js     80407e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80406b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804070:	83 f8 04             	cmp    $0x4,%eax
+  804073:	74 09                	je     80407e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804075:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804079:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80407e:	48 89 d0             	mov    %rdx,%rax
+  804081:	48 83 c4 08          	add    $0x8,%rsp
+  804085:	5b                   	pop    %rbx
+  804086:	41 5c                	pop    %r12
+  804088:	41 5d                	pop    %r13
+  80408a:	5d                   	pop    %rbp
+  80408b:	c3                   	ret
+  80408c:	48 89 d0             	mov    %rdx,%rax
+  80408f:	c3                   	ret
+
+0000000000804090 <cputchar>:
+cputchar(int ch) {
+  804090:	55                   	push   %rbp
+  804091:	48 89 e5             	mov    %rsp,%rbp
+  804094:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804098:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80409c:	be 01 00 00 00       	mov    $0x1,%esi
+  8040a1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8040a5:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8040ac:	00 00 00 
+  8040af:	ff d0                	call   *%rax
+}
+  8040b1:	c9                   	leave
+  8040b2:	c3                   	ret
+
+00000000008040b3 <getchar>:
+getchar(void) {
+  8040b3:	55                   	push   %rbp
+  8040b4:	48 89 e5             	mov    %rsp,%rbp
+  8040b7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040bb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040c0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c9:	48 b8 99 1c 80 00 00 	movabs $0x801c99,%rax
+  8040d0:	00 00 00 
+  8040d3:	ff d0                	call   *%rax
+  8040d5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040d7:	85 c0                	test   %eax,%eax
+  8040d9:	78 06                	js     8040e1 <getchar+0x2e>
+  8040db:	74 08                	je     8040e5 <getchar+0x32>
+  8040dd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040e1:	89 d0                	mov    %edx,%eax
+  8040e3:	c9                   	leave
+  8040e4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040e5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040ea:	eb f5                	jmp    8040e1 <getchar+0x2e>
+
+00000000008040ec <iscons>:
+iscons(int fdnum) {
+  8040ec:	55                   	push   %rbp
+  8040ed:	48 89 e5             	mov    %rsp,%rbp
+  8040f0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040f8:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  8040ff:	00 00 00 
+  804102:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804104:	85 c0                	test   %eax,%eax
+  804106:	78 18                	js     804120 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804108:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80410c:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  804113:	00 00 00 
+  804116:	8b 00                	mov    (%rax),%eax
+  804118:	39 02                	cmp    %eax,(%rdx)
+  80411a:	0f 94 c0             	sete   %al
+  80411d:	0f b6 c0             	movzbl %al,%eax
+}
+  804120:	c9                   	leave
+  804121:	c3                   	ret
+
+0000000000804122 <opencons>:
+opencons(void) {
+  804122:	55                   	push   %rbp
+  804123:	48 89 e5             	mov    %rsp,%rbp
+  804126:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80412a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80412e:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  804135:	00 00 00 
+  804138:	ff d0                	call   *%rax
+  80413a:	85 c0                	test   %eax,%eax
+  80413c:	78 49                	js     804187 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80413e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804143:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804148:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80414c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804151:	48 b8 49 14 80 00 00 	movabs $0x801449,%rax
+  804158:	00 00 00 
+  80415b:	ff d0                	call   *%rax
+  80415d:	85 c0                	test   %eax,%eax
+  80415f:	78 26                	js     804187 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804161:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804165:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  80416c:	00 00 
+  80416e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804170:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804174:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80417b:	48 b8 28 19 80 00 00 	movabs $0x801928,%rax
+  804182:	00 00 00 
+  804185:	ff d0                	call   *%rax
+}
+  804187:	c9                   	leave
+  804188:	c3                   	ret
+
+0000000000804189 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  804189:	55                   	push   %rbp
+  80418a:	48 89 e5             	mov    %rsp,%rbp
+  80418d:	41 55                	push   %r13
+  80418f:	41 54                	push   %r12
+  804191:	53                   	push   %rbx
+  804192:	48 83 ec 08          	sub    $0x8,%rsp
+  804196:	49 89 fc             	mov    %rdi,%r12
+  804199:	48 89 f7             	mov    %rsi,%rdi
+  80419c:	48 89 d3             	mov    %rdx,%rbx
+  80419f:	49 89 cd             	mov    %rcx,%r13
+  8041a2:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8041a5:	48 85 f6             	test   %rsi,%rsi
+  8041a8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041af:	00 00 00 
+  8041b2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8041b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041bb:	48 85 db             	test   %rbx,%rbx
+  8041be:	74 03                	je     8041c3 <ipc_recv_timed+0x3a>
+  8041c0:	48 8b 33             	mov    (%rbx),%rsi
+  8041c3:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8041cf:	85 c0                	test   %eax,%eax
+  8041d1:	78 75                	js     804248 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8041d3:	4d 85 e4             	test   %r12,%r12
+  8041d6:	74 14                	je     8041ec <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8041d8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8041df:	00 00 00 
+  8041e2:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  8041e8:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  8041ec:	4d 85 ed             	test   %r13,%r13
+  8041ef:	74 14                	je     804205 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8041f1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8041f8:	00 00 00 
+  8041fb:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  804201:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  804205:	48 85 db             	test   %rbx,%rbx
+  804208:	74 23                	je     80422d <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80420a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  804211:	00 00 00 
+  804214:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  80421a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80421f:	85 c9                	test   %ecx,%ecx
+  804221:	74 07                	je     80422a <ipc_recv_timed+0xa1>
+  804223:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  80422a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80422d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  804234:	00 00 00 
+  804237:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80423d:	48 83 c4 08          	add    $0x8,%rsp
+  804241:	5b                   	pop    %rbx
+  804242:	41 5c                	pop    %r12
+  804244:	41 5d                	pop    %r13
+  804246:	5d                   	pop    %rbp
+  804247:	c3                   	ret
+        if (from_env_store != NULL) {
+  804248:	4d 85 e4             	test   %r12,%r12
+  80424b:	74 08                	je     804255 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  80424d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804254:	00 
+        if (perm_store != NULL) {
+  804255:	4d 85 ed             	test   %r13,%r13
+  804258:	74 08                	je     804262 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80425a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804261:	00 
+        if (size != NULL) {
+  804262:	48 85 db             	test   %rbx,%rbx
+  804265:	74 d6                	je     80423d <ipc_recv_timed+0xb4>
+            *size = 0;
+  804267:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80426e:	eb cd                	jmp    80423d <ipc_recv_timed+0xb4>
+
+0000000000804270 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804270:	55                   	push   %rbp
+  804271:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  804274:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80427a:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  804281:	00 00 00 
+  804284:	ff d0                	call   *%rax
+}
+  804286:	5d                   	pop    %rbp
+  804287:	c3                   	ret
+
+0000000000804288 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804288:	55                   	push   %rbp
+  804289:	48 89 e5             	mov    %rsp,%rbp
+  80428c:	41 57                	push   %r15
+  80428e:	41 56                	push   %r14
+  804290:	41 55                	push   %r13
+  804292:	41 54                	push   %r12
+  804294:	53                   	push   %rbx
+  804295:	48 83 ec 18          	sub    $0x18,%rsp
+  804299:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80429c:	48 89 d3             	mov    %rdx,%rbx
+  80429f:	49 89 cc             	mov    %rcx,%r12
+  8042a2:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8042a5:	48 85 d2             	test   %rdx,%rdx
+  8042a8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042af:	00 00 00 
+  8042b2:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8042b6:	89 f0                	mov    %esi,%eax
+  8042b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8042bc:	48 89 da             	mov    %rbx,%rdx
+  8042bf:	48 89 c6             	mov    %rax,%rsi
+  8042c2:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+    while (res < 0) {
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	79 65                	jns    804337 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8042d2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8042d5:	75 33                	jne    80430a <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  8042d7:	49 bf ba 13 80 00 00 	movabs $0x8013ba,%r15
+  8042de:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8042e1:	49 be b7 16 80 00 00 	movabs $0x8016b7,%r14
+  8042e8:	00 00 00 
+        sys_yield();
+  8042eb:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8042ee:	45 89 e8             	mov    %r13d,%r8d
+  8042f1:	4c 89 e1             	mov    %r12,%rcx
+  8042f4:	48 89 da             	mov    %rbx,%rdx
+  8042f7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8042fb:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8042fe:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  804301:	85 c0                	test   %eax,%eax
+  804303:	79 32                	jns    804337 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804305:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804308:	74 e1                	je     8042eb <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80430a:	89 c1                	mov    %eax,%ecx
+  80430c:	48 ba de 4c 80 00 00 	movabs $0x804cde,%rdx
+  804313:	00 00 00 
+  804316:	be 52 00 00 00       	mov    $0x52,%esi
+  80431b:	48 bf f2 4c 80 00 00 	movabs $0x804cf2,%rdi
+  804322:	00 00 00 
+  804325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432a:	49 b8 48 03 80 00 00 	movabs $0x800348,%r8
+  804331:	00 00 00 
+  804334:	41 ff d0             	call   *%r8
+    }
+}
+  804337:	48 83 c4 18          	add    $0x18,%rsp
+  80433b:	5b                   	pop    %rbx
+  80433c:	41 5c                	pop    %r12
+  80433e:	41 5d                	pop    %r13
+  804340:	41 5e                	pop    %r14
+  804342:	41 5f                	pop    %r15
+  804344:	5d                   	pop    %rbp
+  804345:	c3                   	ret
+
+0000000000804346 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804346:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80434b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804352:	00 00 00 
+  804355:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804359:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80435d:	48 c1 e2 04          	shl    $0x4,%rdx
+  804361:	48 01 ca             	add    %rcx,%rdx
+  804364:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80436a:	39 fa                	cmp    %edi,%edx
+  80436c:	74 12                	je     804380 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80436e:	48 83 c0 01          	add    $0x1,%rax
+  804372:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804378:	75 db                	jne    804355 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80437a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80437f:	c3                   	ret
+            return envs[i].env_id;
+  804380:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804384:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804388:	48 c1 e2 04          	shl    $0x4,%rdx
+  80438c:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  804393:	00 00 00 
+  804396:	48 01 d0             	add    %rdx,%rax
+  804399:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80439f:	c3                   	ret
+
+00000000008043a0 <__rodata_start>:
+  8043a0:	72 69                	jb     80440b <__rodata_start+0x6b>
+  8043a2:	67 68 74 00 77 72    	addr32 push $0x72770074
+  8043a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043aa:	67 00 73 79          	add    %dh,0x79(%ebx)
+  8043ae:	73 5f                	jae    80440f <__rodata_start+0x6f>
+  8043b0:	70 61                	jo     804413 <__rodata_start+0x73>
+  8043b2:	67 65 5f             	addr32 gs pop %rdi
+  8043b5:	61                   	(bad)
+  8043b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8043b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8043b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043b9:	63 3a                	movsxd (%rdx),%edi
+  8043bb:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f5442a <__bss_end+0x7374b42a>
+  8043c1:	65 72 2f             	gs jb  8043f3 <__rodata_start+0x53>
+  8043c4:	74 65                	je     80442b <__rodata_start+0x8b>
+  8043c6:	73 74                	jae    80443c <__rodata_start+0x9c>
+  8043c8:	70 74                	jo     80443e <__rodata_start+0x9e>
+  8043ca:	65 73 68             	gs jae 804435 <__rodata_start+0x95>
+  8043cd:	61                   	(bad)
+  8043ce:	72 65                	jb     804435 <__rodata_start+0x95>
+  8043d0:	2e 63 00             	cs movsxd (%rax),%eax
+  8043d3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8043d5:	72 6b                	jb     804442 <__rodata_start+0xa2>
+  8043d7:	3a 20                	cmp    (%rax),%ah
+  8043d9:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  8043de:	72 6b                	jb     80444b <__rodata_start+0xab>
+  8043e0:	20 68 61             	and    %ch,0x61(%rax)
+  8043e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043e4:	64 6c                	fs insb (%dx),%es:(%rdi)
+  8043e6:	65 73 20             	gs jae 804409 <__rodata_start+0x69>
+  8043e9:	50                   	push   %rax
+  8043ea:	54                   	push   %rsp
+  8043eb:	45 5f                	rex.RB pop %r15
+  8043ed:	53                   	push   %rbx
+  8043ee:	48                   	rex.W
+  8043ef:	41 52                	push   %r10
+  8043f1:	45 20 25 73 0a 00 61 	and    %r12b,0x61000a73(%rip)        # 61804e6b <__bss_end+0x60ffbe6b>
+  8043f8:	72 67                	jb     804461 <__rodata_start+0xc1>
+  8043fa:	00 2f                	add    %ch,(%rdi)
+  8043fc:	74 65                	je     804463 <__rodata_start+0xc3>
+  8043fe:	73 74                	jae    804474 <__rodata_start+0xd4>
+  804400:	70 74                	jo     804476 <__rodata_start+0xd6>
+  804402:	65 73 68             	gs jae 80446d <__rodata_start+0xcd>
+  804405:	61                   	(bad)
+  804406:	72 65                	jb     80446d <__rodata_start+0xcd>
+  804408:	00 73 70             	add    %dh,0x70(%rbx)
+  80440b:	61                   	(bad)
+  80440c:	77 6e                	ja     80447c <__rodata_start+0xdc>
+  80440e:	3a 20                	cmp    (%rax),%ah
+  804410:	25 69 00 73 70       	and    $0x70730069,%eax
+  804415:	61                   	(bad)
+  804416:	77 6e                	ja     804486 <__rodata_start+0xe6>
+  804418:	20 68 61             	and    %ch,0x61(%rax)
+  80441b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80441c:	64 6c                	fs insb (%dx),%es:(%rdi)
+  80441e:	65 73 20             	gs jae 804441 <__rodata_start+0xa1>
+  804421:	50                   	push   %rax
+  804422:	54                   	push   %rsp
+  804423:	45 5f                	rex.RB pop %r15
+  804425:	53                   	push   %rbx
+  804426:	48                   	rex.W
+  804427:	41 52                	push   %r10
+  804429:	45 20 25 73 0a 00 67 	and    %r12b,0x67000a73(%rip)        # 67804ea3 <__bss_end+0x66ffbea3>
+  804430:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804431:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804432:	64 62                	fs (bad)
+  804434:	79 65                	jns    80449b <__rodata_start+0xfb>
+  804436:	2c 20                	sub    $0x20,%al
+  804438:	77 6f                	ja     8044a9 <__rodata_start+0x109>
+  80443a:	72 6c                	jb     8044a8 <__rodata_start+0x108>
+  80443c:	64 0a 00             	or     %fs:(%rax),%al
+  80443f:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  804444:	2c 20                	sub    $0x20,%al
+  804446:	77 6f                	ja     8044b7 <__rodata_start+0x117>
+  804448:	72 6c                	jb     8044b6 <__rodata_start+0x116>
+  80444a:	64 0a 00             	or     %fs:(%rax),%al
+  80444d:	3c 75                	cmp    $0x75,%al
+  80444f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804450:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804454:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804455:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  80445c:	78 5d                	js     8044bb <__rodata_start+0x11b>
+  80445e:	20 75 73             	and    %dh,0x73(%rbp)
+  804461:	65 72 20             	gs jb  804484 <__rodata_start+0xe4>
+  804464:	70 61                	jo     8044c7 <__rodata_start+0x127>
+  804466:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804467:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80446e:	73 20                	jae    804490 <__rodata_start+0xf0>
+  804470:	61                   	(bad)
+  804471:	74 20                	je     804493 <__rodata_start+0xf3>
+  804473:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804478:	3a 20                	cmp    (%rax),%ah
+  80447a:	00 30                	add    %dh,(%rax)
+  80447c:	31 32                	xor    %esi,(%rdx)
+  80447e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804485:	41                   	rex.B
+  804486:	42                   	rex.X
+  804487:	43                   	rex.XB
+  804488:	44                   	rex.R
+  804489:	45                   	rex.RB
+  80448a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80448d:	31 32                	xor    %esi,(%rdx)
+  80448f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804496:	61                   	(bad)
+  804497:	62 63 64 65 66       	(bad)
+  80449c:	00 28                	add    %ch,(%rax)
+  80449e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80449f:	75 6c                	jne    80450d <__rodata_start+0x16d>
+  8044a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8044a2:	29 00                	sub    %eax,(%rax)
+  8044a4:	65 72 72             	gs jb  804519 <__rodata_start+0x179>
+  8044a7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044a8:	72 20                	jb     8044ca <__rodata_start+0x12a>
+  8044aa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8044af:	73 70                	jae    804521 <__rodata_start+0x181>
+  8044b1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8044b5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8044bc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044bd:	72 00                	jb     8044bf <__rodata_start+0x11f>
+  8044bf:	62 61 64 20 65       	(bad)
+  8044c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044c5:	76 69                	jbe    804530 <__rodata_start+0x190>
+  8044c7:	72 6f                	jb     804538 <__rodata_start+0x198>
+  8044c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044ca:	6d                   	insl   (%dx),%es:(%rdi)
+  8044cb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8044cd:	74 00                	je     8044cf <__rodata_start+0x12f>
+  8044cf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8044d6:	20 70 61             	and    %dh,0x61(%rax)
+  8044d9:	72 61                	jb     80453c <__rodata_start+0x19c>
+  8044db:	6d                   	insl   (%dx),%es:(%rdi)
+  8044dc:	65 74 65             	gs je  804544 <__rodata_start+0x1a4>
+  8044df:	72 00                	jb     8044e1 <__rodata_start+0x141>
+  8044e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044e2:	75 74                	jne    804558 <__rodata_start+0x1b8>
+  8044e4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8044e7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8044ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8044eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044ec:	72 79                	jb     804567 <__rodata_start+0x1c7>
+  8044ee:	00 6f 75             	add    %ch,0x75(%rdi)
+  8044f1:	74 20                	je     804513 <__rodata_start+0x173>
+  8044f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044f4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8044f8:	76 69                	jbe    804563 <__rodata_start+0x1c3>
+  8044fa:	72 6f                	jb     80456b <__rodata_start+0x1cb>
+  8044fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044fd:	6d                   	insl   (%dx),%es:(%rdi)
+  8044fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804500:	74 73                	je     804575 <__rodata_start+0x1d5>
+  804502:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804505:	72 72                	jb     804579 <__rodata_start+0x1d9>
+  804507:	75 70                	jne    804579 <__rodata_start+0x1d9>
+  804509:	74 65                	je     804570 <__rodata_start+0x1d0>
+  80450b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804510:	75 67                	jne    804579 <__rodata_start+0x1d9>
+  804512:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804515:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804517:	00 73 65             	add    %dh,0x65(%rbx)
+  80451a:	67 6d                	insl   (%dx),%es:(%edi)
+  80451c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80451e:	74 61                	je     804581 <__rodata_start+0x1e1>
+  804520:	74 69                	je     80458b <__rodata_start+0x1eb>
+  804522:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804523:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804524:	20 66 61             	and    %ah,0x61(%rsi)
+  804527:	75 6c                	jne    804595 <__rodata_start+0x1f5>
+  804529:	74 00                	je     80452b <__rodata_start+0x18b>
+  80452b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804532:	20 45 4c             	and    %al,0x4c(%rbp)
+  804535:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804539:	61                   	(bad)
+  80453a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80453f:	20 73 75             	and    %dh,0x75(%rbx)
+  804542:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804545:	73 79                	jae    8045c0 <__rodata_start+0x220>
+  804547:	73 74                	jae    8045bd <__rodata_start+0x21d>
+  804549:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80454b:	20 63 61             	and    %ah,0x61(%rbx)
+  80454e:	6c                   	insb   (%dx),%es:(%rdi)
+  80454f:	6c                   	insb   (%dx),%es:(%rdi)
+  804550:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804553:	74 72                	je     8045c7 <__rodata_start+0x227>
+  804555:	79 20                	jns    804577 <__rodata_start+0x1d7>
+  804557:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804558:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804559:	74 20                	je     80457b <__rodata_start+0x1db>
+  80455b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80455d:	75 6e                	jne    8045cd <__rodata_start+0x22d>
+  80455f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804563:	76 20                	jbe    804585 <__rodata_start+0x1e5>
+  804565:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80456c:	72 65                	jb     8045d3 <__rodata_start+0x233>
+  80456e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804571:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804572:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804576:	65 78 70             	gs js  8045e9 <__rodata_start+0x249>
+  804579:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80457e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804581:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804585:	20 66 69             	and    %ah,0x69(%rsi)
+  804588:	6c                   	insb   (%dx),%es:(%rdi)
+  804589:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80458d:	20 66 72             	and    %ah,0x72(%rsi)
+  804590:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804595:	61                   	(bad)
+  804596:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804599:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80459a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80459b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80459f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8045a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045a4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8045a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045a8:	79 20                	jns    8045ca <__rodata_start+0x22a>
+  8045aa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8045b1:	72 65                	jb     804618 <__rodata_start+0x278>
+  8045b3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8045b6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8045b8:	00 66 69             	add    %ah,0x69(%rsi)
+  8045bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8045bc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8045c0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8045c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045c4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8045c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045c9:	74 20                	je     8045eb <__rodata_start+0x24b>
+  8045cb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8045cd:	75 6e                	jne    80463d <__rodata_start+0x29d>
+  8045cf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8045d3:	76 61                	jbe    804636 <__rodata_start+0x296>
+  8045d5:	6c                   	insb   (%dx),%es:(%rdi)
+  8045d6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8045dd:	00 
+  8045de:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8045e5:	72 65                	jb     80464c <__rodata_start+0x2ac>
+  8045e7:	61                   	(bad)
+  8045e8:	64 79 20             	fs jns 80460b <__rodata_start+0x26b>
+  8045eb:	65 78 69             	gs js  804657 <__rodata_start+0x2b7>
+  8045ee:	73 74                	jae    804664 <__rodata_start+0x2c4>
+  8045f0:	73 00                	jae    8045f2 <__rodata_start+0x252>
+  8045f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045f3:	70 65                	jo     80465a <__rodata_start+0x2ba>
+  8045f5:	72 61                	jb     804658 <__rodata_start+0x2b8>
+  8045f7:	74 69                	je     804662 <__rodata_start+0x2c2>
+  8045f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8045fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8045fb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8045fe:	74 20                	je     804620 <__rodata_start+0x280>
+  804600:	73 75                	jae    804677 <__rodata_start+0x2d7>
+  804602:	70 70                	jo     804674 <__rodata_start+0x2d4>
+  804604:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804605:	72 74                	jb     80467b <__rodata_start+0x2db>
+  804607:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80460d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  804612:	74 00                	je     804614 <__rodata_start+0x274>
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 90                	xchg   %ax,%ax
+  804620:	85 06                	test   %eax,(%rsi)
+  804622:	80 00 00             	addb   $0x0,(%rax)
+  804625:	00 00                	add    %al,(%rax)
+  804627:	00 c6                	add    %al,%dh
+  804629:	0c 80                	or     $0x80,%al
+  80462b:	00 00                	add    %al,(%rax)
+  80462d:	00 00                	add    %al,(%rax)
+  80462f:	00 b6 0c 80 00 00    	add    %dh,0x800c(%rsi)
+  804635:	00 00                	add    %al,(%rax)
+  804637:	00 c6                	add    %al,%dh
+  804639:	0c 80                	or     $0x80,%al
+  80463b:	00 00                	add    %al,(%rax)
+  80463d:	00 00                	add    %al,(%rax)
+  80463f:	00 c6                	add    %al,%dh
+  804641:	0c 80                	or     $0x80,%al
+  804643:	00 00                	add    %al,(%rax)
+  804645:	00 00                	add    %al,(%rax)
+  804647:	00 c6                	add    %al,%dh
+  804649:	0c 80                	or     $0x80,%al
+  80464b:	00 00                	add    %al,(%rax)
+  80464d:	00 00                	add    %al,(%rax)
+  80464f:	00 c6                	add    %al,%dh
+  804651:	0c 80                	or     $0x80,%al
+  804653:	00 00                	add    %al,(%rax)
+  804655:	00 00                	add    %al,(%rax)
+  804657:	00 a4 06 80 00 00 00 	add    %ah,0x80(%rsi,%rax,1)
+  80465e:	00 00                	add    %al,(%rax)
+  804660:	c6                   	(bad)
+  804661:	0c 80                	or     $0x80,%al
+  804663:	00 00                	add    %al,(%rax)
+  804665:	00 00                	add    %al,(%rax)
+  804667:	00 c6                	add    %al,%dh
+  804669:	0c 80                	or     $0x80,%al
+  80466b:	00 00                	add    %al,(%rax)
+  80466d:	00 00                	add    %al,(%rax)
+  80466f:	00 98 06 80 00 00    	add    %bl,0x8006(%rax)
+  804675:	00 00                	add    %al,(%rax)
+  804677:	00 12                	add    %dl,(%rdx)
+  804679:	07                   	(bad)
+  80467a:	80 00 00             	addb   $0x0,(%rax)
+  80467d:	00 00                	add    %al,(%rax)
+  80467f:	00 c6                	add    %al,%dh
+  804681:	0c 80                	or     $0x80,%al
+  804683:	00 00                	add    %al,(%rax)
+  804685:	00 00                	add    %al,(%rax)
+  804687:	00 98 06 80 00 00    	add    %bl,0x8006(%rax)
+  80468d:	00 00                	add    %al,(%rax)
+  80468f:	00 de                	add    %bl,%dh
+  804691:	06                   	(bad)
+  804692:	80 00 00             	addb   $0x0,(%rax)
+  804695:	00 00                	add    %al,(%rax)
+  804697:	00 de                	add    %bl,%dh
+  804699:	06                   	(bad)
+  80469a:	80 00 00             	addb   $0x0,(%rax)
+  80469d:	00 00                	add    %al,(%rax)
+  80469f:	00 de                	add    %bl,%dh
+  8046a1:	06                   	(bad)
+  8046a2:	80 00 00             	addb   $0x0,(%rax)
+  8046a5:	00 00                	add    %al,(%rax)
+  8046a7:	00 de                	add    %bl,%dh
+  8046a9:	06                   	(bad)
+  8046aa:	80 00 00             	addb   $0x0,(%rax)
+  8046ad:	00 00                	add    %al,(%rax)
+  8046af:	00 de                	add    %bl,%dh
+  8046b1:	06                   	(bad)
+  8046b2:	80 00 00             	addb   $0x0,(%rax)
+  8046b5:	00 00                	add    %al,(%rax)
+  8046b7:	00 de                	add    %bl,%dh
+  8046b9:	06                   	(bad)
+  8046ba:	80 00 00             	addb   $0x0,(%rax)
+  8046bd:	00 00                	add    %al,(%rax)
+  8046bf:	00 de                	add    %bl,%dh
+  8046c1:	06                   	(bad)
+  8046c2:	80 00 00             	addb   $0x0,(%rax)
+  8046c5:	00 00                	add    %al,(%rax)
+  8046c7:	00 de                	add    %bl,%dh
+  8046c9:	06                   	(bad)
+  8046ca:	80 00 00             	addb   $0x0,(%rax)
+  8046cd:	00 00                	add    %al,(%rax)
+  8046cf:	00 de                	add    %bl,%dh
+  8046d1:	06                   	(bad)
+  8046d2:	80 00 00             	addb   $0x0,(%rax)
+  8046d5:	00 00                	add    %al,(%rax)
+  8046d7:	00 c6                	add    %al,%dh
+  8046d9:	0c 80                	or     $0x80,%al
+  8046db:	00 00                	add    %al,(%rax)
+  8046dd:	00 00                	add    %al,(%rax)
+  8046df:	00 c6                	add    %al,%dh
+  8046e1:	0c 80                	or     $0x80,%al
+  8046e3:	00 00                	add    %al,(%rax)
+  8046e5:	00 00                	add    %al,(%rax)
+  8046e7:	00 c6                	add    %al,%dh
+  8046e9:	0c 80                	or     $0x80,%al
+  8046eb:	00 00                	add    %al,(%rax)
+  8046ed:	00 00                	add    %al,(%rax)
+  8046ef:	00 c6                	add    %al,%dh
+  8046f1:	0c 80                	or     $0x80,%al
+  8046f3:	00 00                	add    %al,(%rax)
+  8046f5:	00 00                	add    %al,(%rax)
+  8046f7:	00 c6                	add    %al,%dh
+  8046f9:	0c 80                	or     $0x80,%al
+  8046fb:	00 00                	add    %al,(%rax)
+  8046fd:	00 00                	add    %al,(%rax)
+  8046ff:	00 c6                	add    %al,%dh
+  804701:	0c 80                	or     $0x80,%al
+  804703:	00 00                	add    %al,(%rax)
+  804705:	00 00                	add    %al,(%rax)
+  804707:	00 c6                	add    %al,%dh
+  804709:	0c 80                	or     $0x80,%al
+  80470b:	00 00                	add    %al,(%rax)
+  80470d:	00 00                	add    %al,(%rax)
+  80470f:	00 c6                	add    %al,%dh
+  804711:	0c 80                	or     $0x80,%al
+  804713:	00 00                	add    %al,(%rax)
+  804715:	00 00                	add    %al,(%rax)
+  804717:	00 c6                	add    %al,%dh
+  804719:	0c 80                	or     $0x80,%al
+  80471b:	00 00                	add    %al,(%rax)
+  80471d:	00 00                	add    %al,(%rax)
+  80471f:	00 c6                	add    %al,%dh
+  804721:	0c 80                	or     $0x80,%al
+  804723:	00 00                	add    %al,(%rax)
+  804725:	00 00                	add    %al,(%rax)
+  804727:	00 c6                	add    %al,%dh
+  804729:	0c 80                	or     $0x80,%al
+  80472b:	00 00                	add    %al,(%rax)
+  80472d:	00 00                	add    %al,(%rax)
+  80472f:	00 c6                	add    %al,%dh
+  804731:	0c 80                	or     $0x80,%al
+  804733:	00 00                	add    %al,(%rax)
+  804735:	00 00                	add    %al,(%rax)
+  804737:	00 c6                	add    %al,%dh
+  804739:	0c 80                	or     $0x80,%al
+  80473b:	00 00                	add    %al,(%rax)
+  80473d:	00 00                	add    %al,(%rax)
+  80473f:	00 c6                	add    %al,%dh
+  804741:	0c 80                	or     $0x80,%al
+  804743:	00 00                	add    %al,(%rax)
+  804745:	00 00                	add    %al,(%rax)
+  804747:	00 c6                	add    %al,%dh
+  804749:	0c 80                	or     $0x80,%al
+  80474b:	00 00                	add    %al,(%rax)
+  80474d:	00 00                	add    %al,(%rax)
+  80474f:	00 c6                	add    %al,%dh
+  804751:	0c 80                	or     $0x80,%al
+  804753:	00 00                	add    %al,(%rax)
+  804755:	00 00                	add    %al,(%rax)
+  804757:	00 c6                	add    %al,%dh
+  804759:	0c 80                	or     $0x80,%al
+  80475b:	00 00                	add    %al,(%rax)
+  80475d:	00 00                	add    %al,(%rax)
+  80475f:	00 c6                	add    %al,%dh
+  804761:	0c 80                	or     $0x80,%al
+  804763:	00 00                	add    %al,(%rax)
+  804765:	00 00                	add    %al,(%rax)
+  804767:	00 c6                	add    %al,%dh
+  804769:	0c 80                	or     $0x80,%al
+  80476b:	00 00                	add    %al,(%rax)
+  80476d:	00 00                	add    %al,(%rax)
+  80476f:	00 c6                	add    %al,%dh
+  804771:	0c 80                	or     $0x80,%al
+  804773:	00 00                	add    %al,(%rax)
+  804775:	00 00                	add    %al,(%rax)
+  804777:	00 c6                	add    %al,%dh
+  804779:	0c 80                	or     $0x80,%al
+  80477b:	00 00                	add    %al,(%rax)
+  80477d:	00 00                	add    %al,(%rax)
+  80477f:	00 c6                	add    %al,%dh
+  804781:	0c 80                	or     $0x80,%al
+  804783:	00 00                	add    %al,(%rax)
+  804785:	00 00                	add    %al,(%rax)
+  804787:	00 c6                	add    %al,%dh
+  804789:	0c 80                	or     $0x80,%al
+  80478b:	00 00                	add    %al,(%rax)
+  80478d:	00 00                	add    %al,(%rax)
+  80478f:	00 c6                	add    %al,%dh
+  804791:	0c 80                	or     $0x80,%al
+  804793:	00 00                	add    %al,(%rax)
+  804795:	00 00                	add    %al,(%rax)
+  804797:	00 c6                	add    %al,%dh
+  804799:	0c 80                	or     $0x80,%al
+  80479b:	00 00                	add    %al,(%rax)
+  80479d:	00 00                	add    %al,(%rax)
+  80479f:	00 c6                	add    %al,%dh
+  8047a1:	0c 80                	or     $0x80,%al
+  8047a3:	00 00                	add    %al,(%rax)
+  8047a5:	00 00                	add    %al,(%rax)
+  8047a7:	00 c6                	add    %al,%dh
+  8047a9:	0c 80                	or     $0x80,%al
+  8047ab:	00 00                	add    %al,(%rax)
+  8047ad:	00 00                	add    %al,(%rax)
+  8047af:	00 c6                	add    %al,%dh
+  8047b1:	0c 80                	or     $0x80,%al
+  8047b3:	00 00                	add    %al,(%rax)
+  8047b5:	00 00                	add    %al,(%rax)
+  8047b7:	00 c6                	add    %al,%dh
+  8047b9:	0c 80                	or     $0x80,%al
+  8047bb:	00 00                	add    %al,(%rax)
+  8047bd:	00 00                	add    %al,(%rax)
+  8047bf:	00 c6                	add    %al,%dh
+  8047c1:	0c 80                	or     $0x80,%al
+  8047c3:	00 00                	add    %al,(%rax)
+  8047c5:	00 00                	add    %al,(%rax)
+  8047c7:	00 e9                	add    %ch,%cl
+  8047c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8047cf:	00 c6                	add    %al,%dh
+  8047d1:	0c 80                	or     $0x80,%al
+  8047d3:	00 00                	add    %al,(%rax)
+  8047d5:	00 00                	add    %al,(%rax)
+  8047d7:	00 c6                	add    %al,%dh
+  8047d9:	0c 80                	or     $0x80,%al
+  8047db:	00 00                	add    %al,(%rax)
+  8047dd:	00 00                	add    %al,(%rax)
+  8047df:	00 c6                	add    %al,%dh
+  8047e1:	0c 80                	or     $0x80,%al
+  8047e3:	00 00                	add    %al,(%rax)
+  8047e5:	00 00                	add    %al,(%rax)
+  8047e7:	00 c6                	add    %al,%dh
+  8047e9:	0c 80                	or     $0x80,%al
+  8047eb:	00 00                	add    %al,(%rax)
+  8047ed:	00 00                	add    %al,(%rax)
+  8047ef:	00 c6                	add    %al,%dh
+  8047f1:	0c 80                	or     $0x80,%al
+  8047f3:	00 00                	add    %al,(%rax)
+  8047f5:	00 00                	add    %al,(%rax)
+  8047f7:	00 c6                	add    %al,%dh
+  8047f9:	0c 80                	or     $0x80,%al
+  8047fb:	00 00                	add    %al,(%rax)
+  8047fd:	00 00                	add    %al,(%rax)
+  8047ff:	00 c6                	add    %al,%dh
+  804801:	0c 80                	or     $0x80,%al
+  804803:	00 00                	add    %al,(%rax)
+  804805:	00 00                	add    %al,(%rax)
+  804807:	00 c6                	add    %al,%dh
+  804809:	0c 80                	or     $0x80,%al
+  80480b:	00 00                	add    %al,(%rax)
+  80480d:	00 00                	add    %al,(%rax)
+  80480f:	00 c6                	add    %al,%dh
+  804811:	0c 80                	or     $0x80,%al
+  804813:	00 00                	add    %al,(%rax)
+  804815:	00 00                	add    %al,(%rax)
+  804817:	00 c6                	add    %al,%dh
+  804819:	0c 80                	or     $0x80,%al
+  80481b:	00 00                	add    %al,(%rax)
+  80481d:	00 00                	add    %al,(%rax)
+  80481f:	00 35 07 80 00 00    	add    %dh,0x8007(%rip)        # 80c82c <__bss_end+0x382c>
+  804825:	00 00                	add    %al,(%rax)
+  804827:	00 04 09             	add    %al,(%rcx,%rcx,1)
+  80482a:	80 00 00             	addb   $0x0,(%rax)
+  80482d:	00 00                	add    %al,(%rax)
+  80482f:	00 c6                	add    %al,%dh
+  804831:	0c 80                	or     $0x80,%al
+  804833:	00 00                	add    %al,(%rax)
+  804835:	00 00                	add    %al,(%rax)
+  804837:	00 c6                	add    %al,%dh
+  804839:	0c 80                	or     $0x80,%al
+  80483b:	00 00                	add    %al,(%rax)
+  80483d:	00 00                	add    %al,(%rax)
+  80483f:	00 c6                	add    %al,%dh
+  804841:	0c 80                	or     $0x80,%al
+  804843:	00 00                	add    %al,(%rax)
+  804845:	00 00                	add    %al,(%rax)
+  804847:	00 c6                	add    %al,%dh
+  804849:	0c 80                	or     $0x80,%al
+  80484b:	00 00                	add    %al,(%rax)
+  80484d:	00 00                	add    %al,(%rax)
+  80484f:	00 64 07 80          	add    %ah,-0x80(%rdi,%rax,1)
+  804853:	00 00                	add    %al,(%rax)
+  804855:	00 00                	add    %al,(%rax)
+  804857:	00 c6                	add    %al,%dh
+  804859:	0c 80                	or     $0x80,%al
+  80485b:	00 00                	add    %al,(%rax)
+  80485d:	00 00                	add    %al,(%rax)
+  80485f:	00 c6                	add    %al,%dh
+  804861:	0c 80                	or     $0x80,%al
+  804863:	00 00                	add    %al,(%rax)
+  804865:	00 00                	add    %al,(%rax)
+  804867:	00 2a                	add    %ch,(%rdx)
+  804869:	07                   	(bad)
+  80486a:	80 00 00             	addb   $0x0,(%rax)
+  80486d:	00 00                	add    %al,(%rax)
+  80486f:	00 c6                	add    %al,%dh
+  804871:	0c 80                	or     $0x80,%al
+  804873:	00 00                	add    %al,(%rax)
+  804875:	00 00                	add    %al,(%rax)
+  804877:	00 c6                	add    %al,%dh
+  804879:	0c 80                	or     $0x80,%al
+  80487b:	00 00                	add    %al,(%rax)
+  80487d:	00 00                	add    %al,(%rax)
+  80487f:	00 ac 0a 80 00 00 00 	add    %ch,0x80(%rdx,%rcx,1)
+  804886:	00 00                	add    %al,(%rax)
+  804888:	76 0b                	jbe    804895 <__rodata_start+0x4f5>
+  80488a:	80 00 00             	addb   $0x0,(%rax)
+  80488d:	00 00                	add    %al,(%rax)
+  80488f:	00 c6                	add    %al,%dh
+  804891:	0c 80                	or     $0x80,%al
+  804893:	00 00                	add    %al,(%rax)
+  804895:	00 00                	add    %al,(%rax)
+  804897:	00 c6                	add    %al,%dh
+  804899:	0c 80                	or     $0x80,%al
+  80489b:	00 00                	add    %al,(%rax)
+  80489d:	00 00                	add    %al,(%rax)
+  80489f:	00 fb                	add    %bh,%bl
+  8048a1:	07                   	(bad)
+  8048a2:	80 00 00             	addb   $0x0,(%rax)
+  8048a5:	00 00                	add    %al,(%rax)
+  8048a7:	00 c6                	add    %al,%dh
+  8048a9:	0c 80                	or     $0x80,%al
+  8048ab:	00 00                	add    %al,(%rax)
+  8048ad:	00 00                	add    %al,(%rax)
+  8048af:	00 d8                	add    %bl,%al
+  8048b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048b7:	00 c6                	add    %al,%dh
+  8048b9:	0c 80                	or     $0x80,%al
+  8048bb:	00 00                	add    %al,(%rax)
+  8048bd:	00 00                	add    %al,(%rax)
+  8048bf:	00 c6                	add    %al,%dh
+  8048c1:	0c 80                	or     $0x80,%al
+  8048c3:	00 00                	add    %al,(%rax)
+  8048c5:	00 00                	add    %al,(%rax)
+  8048c7:	00 e9                	add    %ch,%cl
+  8048c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8048cf:	00 c6                	add    %al,%dh
+  8048d1:	0c 80                	or     $0x80,%al
+  8048d3:	00 00                	add    %al,(%rax)
+  8048d5:	00 00                	add    %al,(%rax)
+  8048d7:	00 8e 06 80 00 00    	add    %cl,0x8006(%rsi)
+  8048dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008048e0 <error_string>:
+	...
+  8048e8:	ad 44 80 00 00 00 00 00 bf 44 80 00 00 00 00 00     .D.......D......
+  8048f8:	cf 44 80 00 00 00 00 00 e1 44 80 00 00 00 00 00     .D.......D......
+  804908:	ef 44 80 00 00 00 00 00 03 45 80 00 00 00 00 00     .D.......E......
+  804918:	18 45 80 00 00 00 00 00 2b 45 80 00 00 00 00 00     .E......+E......
+  804928:	3d 45 80 00 00 00 00 00 51 45 80 00 00 00 00 00     =E......QE......
+  804938:	61 45 80 00 00 00 00 00 74 45 80 00 00 00 00 00     aE......tE......
+  804948:	8b 45 80 00 00 00 00 00 a1 45 80 00 00 00 00 00     .E.......E......
+  804958:	b9 45 80 00 00 00 00 00 d1 45 80 00 00 00 00 00     .E.......E......
+  804968:	de 45 80 00 00 00 00 00 88 49 80 00 00 00 00 00     .E.......I......
+  804978:	f2 45 80 00 00 00 00 00 0a 46 80 00 00 00 00 00     .E.......F......
+  804988:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804998:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8049a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8049b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8049c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8049d8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8049e8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8049f8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804a08:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804a18:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804a28:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804a38:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804a48:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804a58:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804a68:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804a78:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804a88:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804a98:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804aa0 <devtab>:
+  804aa0:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804ab0:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804ac0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804ad0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804ae0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804af0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804b00:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804b10:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804b20:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  804b30:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  804b40:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804b50:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  804b60:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  804b70:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  804b80:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  804b90:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804ba0:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  804bb0:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  804bc0:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  804bd0:	77 61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72     want %08x..asser
+  804be0:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  804bf0:	6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70 5f     lib/spawn.c.map_
+  804c00:	73 65 67 6d 65 6e 74 2e 73 65 65 6b 20 66 61 69     segment.seek fai
+  804c10:	6c 65 64 3a 20 25 69 0a 00 6d 61 70 5f 73 65 67     led: %i..map_seg
+  804c20:	6d 65 6e 74 2e 72 65 61 64 6e 20 66 61 69 6c 65     ment.readn faile
+  804c30:	64 3a 20 25 69 0a 00 63 6f 70 79 5f 73 68 61 72     d: %i..copy_shar
+  804c40:	65 64 5f 72 65 67 69 6f 6e 3a 20 25 69 00 73 79     ed_region: %i.sy
+  804c50:	73 5f 65 6e 76 5f 73 65 74 5f 74 72 61 70 66 72     s_env_set_trapfr
+  804c60:	61 6d 65 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f     ame: %i.sys_env_
+  804c70:	73 65 74 5f 73 74 61 74 75 73 3a 20 25 69 00 3c     set_status: %i.<
+  804c80:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  804c90:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  804ca0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804cb0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  804cc0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  804cd0:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 69 70     c.<cons>.cons.ip
+  804ce0:	63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69     c_send error: %i
+  804cf0:	0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     ..lib/ipc.c.f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,7584 @@
+
+obj/user/testsh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 57 05 00 00       	call   80057a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+    .comment = "comment6",
+    .data = "6",
+    .data_size = 2};
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+
+    char buf[3];
+    int fd;
+    
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  800036:	49 be c0 50 80 00 00 	movabs $0x8050c0,%r14
+  80003d:	00 00 00 
+  800040:	49 8b 3e             	mov    (%r14),%rdi
+  800043:	be 01 03 00 00       	mov    $0x301,%esi
+  800048:	49 bd ec 2f 80 00 00 	movabs $0x802fec,%r13
+  80004f:	00 00 00 
+  800052:	41 ff d5             	call   *%r13
+  800055:	41 89 c4             	mov    %eax,%r12d
+    write(fd, snap1.data, snap1.data_size);
+  800058:	48 bb a0 50 80 00 00 	movabs $0x8050a0,%rbx
+  80005f:	00 00 00 
+  800062:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  800066:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  800073:	00 00 00 
+  800076:	ff d0                	call   *%rax
+    close(fd);
+  800078:	44 89 e7             	mov    %r12d,%edi
+  80007b:	49 bc 0f 1d 80 00 00 	movabs $0x801d0f,%r12
+  800082:	00 00 00 
+  800085:	41 ff d4             	call   *%r12
+    create_snapshot(snap1.comment, snap1.name);
+  800088:	48 8b 33             	mov    (%rbx),%rsi
+  80008b:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  80008f:	48 b9 e2 22 80 00 00 	movabs $0x8022e2,%rcx
+  800096:	00 00 00 
+  800099:	ff d1                	call   *%rcx
+
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  80009b:	49 8b 3e             	mov    (%r14),%rdi
+  80009e:	be 01 03 00 00       	mov    $0x301,%esi
+  8000a3:	41 ff d5             	call   *%r13
+  8000a6:	41 89 c7             	mov    %eax,%r15d
+    write(fd, snap2.data, snap2.data_size);
+  8000a9:	48 bb 80 50 80 00 00 	movabs $0x805080,%rbx
+  8000b0:	00 00 00 
+  8000b3:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8000b7:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  8000bb:	89 c7                	mov    %eax,%edi
+  8000bd:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  8000c4:	00 00 00 
+  8000c7:	ff d0                	call   *%rax
+    close(fd);
+  8000c9:	44 89 ff             	mov    %r15d,%edi
+  8000cc:	41 ff d4             	call   *%r12
+    create_snapshot(snap2.comment, snap2.name);
+  8000cf:	48 8b 33             	mov    (%rbx),%rsi
+  8000d2:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  8000d6:	48 b9 e2 22 80 00 00 	movabs $0x8022e2,%rcx
+  8000dd:	00 00 00 
+  8000e0:	ff d1                	call   *%rcx
+
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  8000e2:	49 8b 3e             	mov    (%r14),%rdi
+  8000e5:	be 01 03 00 00       	mov    $0x301,%esi
+  8000ea:	41 ff d5             	call   *%r13
+  8000ed:	41 89 c7             	mov    %eax,%r15d
+    write(fd, snap3.data, snap3.data_size);
+  8000f0:	48 bb 60 50 80 00 00 	movabs $0x805060,%rbx
+  8000f7:	00 00 00 
+  8000fa:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8000fe:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  800102:	89 c7                	mov    %eax,%edi
+  800104:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+    close(fd);
+  800110:	44 89 ff             	mov    %r15d,%edi
+  800113:	41 ff d4             	call   *%r12
+    create_snapshot(snap3.comment, snap3.name);
+  800116:	48 8b 33             	mov    (%rbx),%rsi
+  800119:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  80011d:	48 b9 e2 22 80 00 00 	movabs $0x8022e2,%rcx
+  800124:	00 00 00 
+  800127:	ff d1                	call   *%rcx
+
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  800129:	49 8b 3e             	mov    (%r14),%rdi
+  80012c:	be 01 03 00 00       	mov    $0x301,%esi
+  800131:	41 ff d5             	call   *%r13
+  800134:	89 c7                	mov    %eax,%edi
+    write(fd, snap4.data, snap4.data_size);
+  800136:	49 bf 40 50 80 00 00 	movabs $0x805040,%r15
+  80013d:	00 00 00 
+  800140:	49 8b 57 18          	mov    0x18(%r15),%rdx
+  800144:	49 8b 77 10          	mov    0x10(%r15),%rsi
+  800148:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  80014b:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  800152:	00 00 00 
+  800155:	ff d0                	call   *%rax
+    close(fd);
+  800157:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80015a:	41 ff d4             	call   *%r12
+    create_snapshot(snap4.comment, snap4.name);
+  80015d:	49 8b 37             	mov    (%r15),%rsi
+  800160:	49 8b 7f 08          	mov    0x8(%r15),%rdi
+  800164:	48 b9 e2 22 80 00 00 	movabs $0x8022e2,%rcx
+  80016b:	00 00 00 
+  80016e:	ff d1                	call   *%rcx
+
+    // print_snapshot_list();
+
+    // cprintf("\n\n\n**************************************************************************\n\n\n");
+
+    accept_snapshot(snap3.name);
+  800170:	48 8b 3b             	mov    (%rbx),%rdi
+  800173:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  80017a:	00 00 00 
+  80017d:	ff d0                	call   *%rax
+
+    // print_snapshot_list();
+
+    fd = open(TEST_FILE_NAME, O_RDONLY);
+  80017f:	49 8b 3e             	mov    (%r14),%rdi
+  800182:	be 00 00 00 00       	mov    $0x0,%esi
+  800187:	41 ff d5             	call   *%r13
+  80018a:	41 89 c5             	mov    %eax,%r13d
+    read(fd, buf, snap3.data_size);
+  80018d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  800191:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+    close(fd);
+  8001a3:	44 89 ef             	mov    %r13d,%edi
+  8001a6:	41 ff d4             	call   *%r12
+    cprintf("snap3 data: %s; but expected: %s\n", buf, snap3.data);
+  8001a9:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8001ad:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  8001b1:	48 bf c8 3b 80 00 00 	movabs $0x803bc8,%rdi
+  8001b8:	00 00 00 
+  8001bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c0:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  8001c7:	00 00 00 
+  8001ca:	ff d1                	call   *%rcx
+    assert(!strcmp(buf, snap3.data));
+  8001cc:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  8001d0:	48 8d 7d cd          	lea    -0x33(%rbp),%rdi
+  8001d4:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+  8001e0:	85 c0                	test   %eax,%eax
+  8001e2:	0f 85 6e 02 00 00    	jne    800456 <umain+0x431>
+
+    accept_snapshot(snap4.name);
+  8001e8:	49 bc 40 50 80 00 00 	movabs $0x805040,%r12
+  8001ef:	00 00 00 
+  8001f2:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001f6:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+
+    //print_snapshot_list();
+
+    fd = open(TEST_FILE_NAME, O_RDONLY);
+  800202:	be 00 00 00 00       	mov    $0x0,%esi
+  800207:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  80020e:	00 00 00 
+  800211:	48 8b 38             	mov    (%rax),%rdi
+  800214:	48 b8 ec 2f 80 00 00 	movabs $0x802fec,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+  800220:	89 c3                	mov    %eax,%ebx
+    int res;
+    if((res = read(fd, buf, snap4.data_size)) < 0) {
+  800222:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800227:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  80022b:	89 c7                	mov    %eax,%edi
+  80022d:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+  800239:	89 c6                	mov    %eax,%esi
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	0f 88 48 02 00 00    	js     80048b <umain+0x466>
+        cprintf("Cannot read from file test, error%d\n", res);
+        assert(false);
+    }
+    close(fd);
+  800243:	89 df                	mov    %ebx,%edi
+  800245:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+    cprintf("snap4 readed data %s expected %s\n", buf, snap4.data);
+  800251:	48 bb 40 50 80 00 00 	movabs $0x805040,%rbx
+  800258:	00 00 00 
+  80025b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80025f:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  800263:	48 bf 18 3c 80 00 00 	movabs $0x803c18,%rdi
+  80026a:	00 00 00 
+  80026d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800272:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  800279:	00 00 00 
+  80027c:	ff d1                	call   *%rcx
+    assert(!strcmp(buf, snap4.data));
+  80027e:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  800282:	48 8d 7d cd          	lea    -0x33(%rbp),%rdi
+  800286:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  80028d:	00 00 00 
+  800290:	ff d0                	call   *%rax
+  800292:	85 c0                	test   %eax,%eax
+  800294:	0f 85 41 02 00 00    	jne    8004db <umain+0x4b6>
+
+    accept_snapshot(snap3.name);
+  80029a:	49 bc 60 50 80 00 00 	movabs $0x805060,%r12
+  8002a1:	00 00 00 
+  8002a4:	49 8b 3c 24          	mov    (%r12),%rdi
+  8002a8:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  8002af:	00 00 00 
+  8002b2:	ff d0                	call   *%rax
+
+    // print_snapshot_list();
+
+    fd = open(TEST_FILE_NAME, O_RDONLY);
+  8002b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b9:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  8002c0:	00 00 00 
+  8002c3:	48 8b 38             	mov    (%rax),%rdi
+  8002c6:	48 b8 ec 2f 80 00 00 	movabs $0x802fec,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+  8002d2:	89 c3                	mov    %eax,%ebx
+    read(fd, buf, snap3.data_size);
+  8002d4:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  8002d9:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  8002dd:	89 c7                	mov    %eax,%edi
+  8002df:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  8002e6:	00 00 00 
+  8002e9:	ff d0                	call   *%rax
+    //cprintf("snap3 data: %s; but expected: %s\n", buf, snap3.data);
+    assert(!strcmp(buf, snap3.data));
+  8002eb:	49 8b 74 24 10       	mov    0x10(%r12),%rsi
+  8002f0:	48 8d 7d cd          	lea    -0x33(%rbp),%rdi
+  8002f4:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  8002fb:	00 00 00 
+  8002fe:	ff d0                	call   *%rax
+  800300:	85 c0                	test   %eax,%eax
+  800302:	0f 85 08 02 00 00    	jne    800510 <umain+0x4eb>
+    close(fd);
+  800308:	89 df                	mov    %ebx,%edi
+  80030a:	49 bf 0f 1d 80 00 00 	movabs $0x801d0f,%r15
+  800311:	00 00 00 
+  800314:	41 ff d7             	call   *%r15
+
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  800317:	49 be c0 50 80 00 00 	movabs $0x8050c0,%r14
+  80031e:	00 00 00 
+  800321:	49 8b 3e             	mov    (%r14),%rdi
+  800324:	be 01 03 00 00       	mov    $0x301,%esi
+  800329:	49 bd ec 2f 80 00 00 	movabs $0x802fec,%r13
+  800330:	00 00 00 
+  800333:	41 ff d5             	call   *%r13
+  800336:	41 89 c4             	mov    %eax,%r12d
+    write(fd, snap5.data, snap5.data_size);
+  800339:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800340:	00 00 00 
+  800343:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  800347:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  80034b:	89 c7                	mov    %eax,%edi
+  80034d:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  800354:	00 00 00 
+  800357:	ff d0                	call   *%rax
+    close(fd);
+  800359:	44 89 e7             	mov    %r12d,%edi
+  80035c:	41 ff d7             	call   *%r15
+    create_snapshot(snap5.comment, snap5.name);
+  80035f:	48 8b 33             	mov    (%rbx),%rsi
+  800362:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  800366:	48 b8 e2 22 80 00 00 	movabs $0x8022e2,%rax
+  80036d:	00 00 00 
+  800370:	ff d0                	call   *%rax
+
+    // print_snapshot_list();
+
+    accept_snapshot(snap3.name);
+  800372:	49 bc 60 50 80 00 00 	movabs $0x805060,%r12
+  800379:	00 00 00 
+  80037c:	49 8b 3c 24          	mov    (%r12),%rdi
+  800380:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  800387:	00 00 00 
+  80038a:	ff d0                	call   *%rax
+
+    // print_snapshot_list();
+
+    fd = open(TEST_FILE_NAME, O_RDONLY);
+  80038c:	49 8b 3e             	mov    (%r14),%rdi
+  80038f:	be 00 00 00 00       	mov    $0x0,%esi
+  800394:	41 ff d5             	call   *%r13
+  800397:	89 c3                	mov    %eax,%ebx
+    read(fd, buf, snap3.data_size);
+  800399:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  80039e:	48 8d 75 cd          	lea    -0x33(%rbp),%rsi
+  8003a2:	89 c7                	mov    %eax,%edi
+  8003a4:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+    // cprintf("snap3 data: %s; but expected: %s\n", buf, snap3.data);
+    assert(!strcmp(buf, snap3.data));
+  8003b0:	49 8b 74 24 10       	mov    0x10(%r12),%rsi
+  8003b5:	48 8d 7d cd          	lea    -0x33(%rbp),%rdi
+  8003b9:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  8003c0:	00 00 00 
+  8003c3:	ff d0                	call   *%rax
+  8003c5:	85 c0                	test   %eax,%eax
+  8003c7:	0f 85 78 01 00 00    	jne    800545 <umain+0x520>
+    close(fd);
+  8003cd:	89 df                	mov    %ebx,%edi
+  8003cf:	49 bd 0f 1d 80 00 00 	movabs $0x801d0f,%r13
+  8003d6:	00 00 00 
+  8003d9:	41 ff d5             	call   *%r13
+
+    fd = open(TEST_FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY);
+  8003dc:	be 01 03 00 00       	mov    $0x301,%esi
+  8003e1:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  8003e8:	00 00 00 
+  8003eb:	48 8b 38             	mov    (%rax),%rdi
+  8003ee:	48 b8 ec 2f 80 00 00 	movabs $0x802fec,%rax
+  8003f5:	00 00 00 
+  8003f8:	ff d0                	call   *%rax
+  8003fa:	41 89 c4             	mov    %eax,%r12d
+    write(fd, snap6.data, snap6.data_size);
+  8003fd:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  800404:	00 00 00 
+  800407:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80040b:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  80040f:	89 c7                	mov    %eax,%edi
+  800411:	48 b8 87 20 80 00 00 	movabs $0x802087,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+    close(fd);
+  80041d:	44 89 e7             	mov    %r12d,%edi
+  800420:	41 ff d5             	call   *%r13
+    create_snapshot(snap6.comment, snap6.name);
+  800423:	48 8b 33             	mov    (%rbx),%rsi
+  800426:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  80042a:	48 b8 e2 22 80 00 00 	movabs $0x8022e2,%rax
+  800431:	00 00 00 
+  800434:	ff d0                	call   *%rax
+
+    print_snapshot_list();
+  800436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043b:	48 ba 3b 23 80 00 00 	movabs $0x80233b,%rdx
+  800442:	00 00 00 
+  800445:	ff d2                	call   *%rdx
+
+    return;
+  800447:	48 83 c4 28          	add    $0x28,%rsp
+  80044b:	5b                   	pop    %rbx
+  80044c:	41 5c                	pop    %r12
+  80044e:	41 5d                	pop    %r13
+  800450:	41 5e                	pop    %r14
+  800452:	41 5f                	pop    %r15
+  800454:	5d                   	pop    %rbp
+  800455:	c3                   	ret
+    assert(!strcmp(buf, snap3.data));
+  800456:	48 b9 3a 3c 80 00 00 	movabs $0x803c3a,%rcx
+  80045d:	00 00 00 
+  800460:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  800467:	00 00 00 
+  80046a:	be 56 00 00 00       	mov    $0x56,%esi
+  80046f:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  800476:	00 00 00 
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  800485:	00 00 00 
+  800488:	41 ff d0             	call   *%r8
+        cprintf("Cannot read from file test, error%d\n", res);
+  80048b:	48 bf f0 3b 80 00 00 	movabs $0x803bf0,%rdi
+  800492:	00 00 00 
+  800495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049a:	48 ba 9b 07 80 00 00 	movabs $0x80079b,%rdx
+  8004a1:	00 00 00 
+  8004a4:	ff d2                	call   *%rdx
+        assert(false);
+  8004a6:	48 b9 76 3c 80 00 00 	movabs $0x803c76,%rcx
+  8004ad:	00 00 00 
+  8004b0:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  8004b7:	00 00 00 
+  8004ba:	be 60 00 00 00       	mov    $0x60,%esi
+  8004bf:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  8004c6:	00 00 00 
+  8004c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ce:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8004d5:	00 00 00 
+  8004d8:	41 ff d0             	call   *%r8
+    assert(!strcmp(buf, snap4.data));
+  8004db:	48 b9 7c 3c 80 00 00 	movabs $0x803c7c,%rcx
+  8004e2:	00 00 00 
+  8004e5:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  8004ec:	00 00 00 
+  8004ef:	be 64 00 00 00       	mov    $0x64,%esi
+  8004f4:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  8004fb:	00 00 00 
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80050a:	00 00 00 
+  80050d:	41 ff d0             	call   *%r8
+    assert(!strcmp(buf, snap3.data));
+  800510:	48 b9 3a 3c 80 00 00 	movabs $0x803c3a,%rcx
+  800517:	00 00 00 
+  80051a:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  800521:	00 00 00 
+  800524:	be 6d 00 00 00       	mov    $0x6d,%esi
+  800529:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  800530:	00 00 00 
+  800533:	b8 00 00 00 00       	mov    $0x0,%eax
+  800538:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80053f:	00 00 00 
+  800542:	41 ff d0             	call   *%r8
+    assert(!strcmp(buf, snap3.data));
+  800545:	48 b9 3a 3c 80 00 00 	movabs $0x803c3a,%rcx
+  80054c:	00 00 00 
+  80054f:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  800556:	00 00 00 
+  800559:	be 7e 00 00 00       	mov    $0x7e,%esi
+  80055e:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  800565:	00 00 00 
+  800568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056d:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  800574:	00 00 00 
+  800577:	41 ff d0             	call   *%r8
+
+000000000080057a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80057a:	55                   	push   %rbp
+  80057b:	48 89 e5             	mov    %rsp,%rbp
+  80057e:	41 56                	push   %r14
+  800580:	41 55                	push   %r13
+  800582:	41 54                	push   %r12
+  800584:	53                   	push   %rbx
+  800585:	41 89 fd             	mov    %edi,%r13d
+  800588:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80058b:	48 ba b8 52 80 00 00 	movabs $0x8052b8,%rdx
+  800592:	00 00 00 
+  800595:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  80059c:	00 00 00 
+  80059f:	48 39 c2             	cmp    %rax,%rdx
+  8005a2:	73 17                	jae    8005bb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8005a4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005a7:	49 89 c4             	mov    %rax,%r12
+  8005aa:	48 83 c3 08          	add    $0x8,%rbx
+  8005ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b3:	ff 53 f8             	call   *-0x8(%rbx)
+  8005b6:	4c 39 e3             	cmp    %r12,%rbx
+  8005b9:	72 ef                	jb     8005aa <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005bb:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  8005c2:	00 00 00 
+  8005c5:	ff d0                	call   *%rax
+  8005c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005cc:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8005d0:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8005d4:	48 c1 e0 04          	shl    $0x4,%rax
+  8005d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8005df:	00 00 00 
+  8005e2:	48 01 d0             	add    %rdx,%rax
+  8005e5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8005ec:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005ef:	45 85 ed             	test   %r13d,%r13d
+  8005f2:	7e 0d                	jle    800601 <libmain+0x87>
+  8005f4:	49 8b 06             	mov    (%r14),%rax
+  8005f7:	48 a3 c8 50 80 00 00 	movabs %rax,0x8050c8
+  8005fe:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800601:	4c 89 f6             	mov    %r14,%rsi
+  800604:	44 89 ef             	mov    %r13d,%edi
+  800607:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80060e:	00 00 00 
+  800611:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800613:	48 b8 28 06 80 00 00 	movabs $0x800628,%rax
+  80061a:	00 00 00 
+  80061d:	ff d0                	call   *%rax
+#endif
+}
+  80061f:	5b                   	pop    %rbx
+  800620:	41 5c                	pop    %r12
+  800622:	41 5d                	pop    %r13
+  800624:	41 5e                	pop    %r14
+  800626:	5d                   	pop    %rbp
+  800627:	c3                   	ret
+
+0000000000800628 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800628:	55                   	push   %rbp
+  800629:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80062c:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  800633:	00 00 00 
+  800636:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800638:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063d:	48 b8 21 16 80 00 00 	movabs $0x801621,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+}
+  800649:	5d                   	pop    %rbp
+  80064a:	c3                   	ret
+
+000000000080064b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	41 56                	push   %r14
+  800651:	41 55                	push   %r13
+  800653:	41 54                	push   %r12
+  800655:	53                   	push   %rbx
+  800656:	48 83 ec 50          	sub    $0x50,%rsp
+  80065a:	49 89 fc             	mov    %rdi,%r12
+  80065d:	41 89 f5             	mov    %esi,%r13d
+  800660:	48 89 d3             	mov    %rdx,%rbx
+  800663:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800667:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80066b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80066f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800676:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80067a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80067e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800682:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800686:	48 b8 c8 50 80 00 00 	movabs $0x8050c8,%rax
+  80068d:	00 00 00 
+  800690:	4c 8b 30             	mov    (%rax),%r14
+  800693:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  80069a:	00 00 00 
+  80069d:	ff d0                	call   *%rax
+  80069f:	89 c6                	mov    %eax,%esi
+  8006a1:	45 89 e8             	mov    %r13d,%r8d
+  8006a4:	4c 89 e1             	mov    %r12,%rcx
+  8006a7:	4c 89 f2             	mov    %r14,%rdx
+  8006aa:	48 bf 20 3d 80 00 00 	movabs $0x803d20,%rdi
+  8006b1:	00 00 00 
+  8006b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b9:	49 bc 9b 07 80 00 00 	movabs $0x80079b,%r12
+  8006c0:	00 00 00 
+  8006c3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006c6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006ca:	48 89 df             	mov    %rbx,%rdi
+  8006cd:	48 b8 37 07 80 00 00 	movabs $0x800737,%rax
+  8006d4:	00 00 00 
+  8006d7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006d9:	48 bf 13 43 80 00 00 	movabs $0x804313,%rdi
+  8006e0:	00 00 00 
+  8006e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006eb:	cc                   	int3
+  8006ec:	eb fd                	jmp    8006eb <_panic+0xa0>
+
+00000000008006ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006ee:	55                   	push   %rbp
+  8006ef:	48 89 e5             	mov    %rsp,%rbp
+  8006f2:	53                   	push   %rbx
+  8006f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006fa:	8b 06                	mov    (%rsi),%eax
+  8006fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8006ff:	89 16                	mov    %edx,(%rsi)
+  800701:	48 98                	cltq
+  800703:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800708:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80070e:	74 0a                	je     80071a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800710:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80071a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80071e:	be ff 00 00 00       	mov    $0xff,%esi
+  800723:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  80072a:	00 00 00 
+  80072d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80072f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800735:	eb d9                	jmp    800710 <putch+0x22>
+
+0000000000800737 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800737:	55                   	push   %rbp
+  800738:	48 89 e5             	mov    %rsp,%rbp
+  80073b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800742:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800745:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80074c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800751:	b8 00 00 00 00       	mov    $0x0,%eax
+  800756:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800759:	48 89 f1             	mov    %rsi,%rcx
+  80075c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800763:	48 bf ee 06 80 00 00 	movabs $0x8006ee,%rdi
+  80076a:	00 00 00 
+  80076d:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  800774:	00 00 00 
+  800777:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800779:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800780:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800787:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  80078e:	00 00 00 
+  800791:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800793:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800799:	c9                   	leave
+  80079a:	c3                   	ret
+
+000000000080079b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80079b:	55                   	push   %rbp
+  80079c:	48 89 e5             	mov    %rsp,%rbp
+  80079f:	48 83 ec 50          	sub    $0x50,%rsp
+  8007a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007d2:	48 b8 37 07 80 00 00 	movabs $0x800737,%rax
+  8007d9:	00 00 00 
+  8007dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007de:	c9                   	leave
+  8007df:	c3                   	ret
+
+00000000008007e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007e0:	55                   	push   %rbp
+  8007e1:	48 89 e5             	mov    %rsp,%rbp
+  8007e4:	41 57                	push   %r15
+  8007e6:	41 56                	push   %r14
+  8007e8:	41 55                	push   %r13
+  8007ea:	41 54                	push   %r12
+  8007ec:	53                   	push   %rbx
+  8007ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8007f1:	49 89 fc             	mov    %rdi,%r12
+  8007f4:	49 89 f5             	mov    %rsi,%r13
+  8007f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800801:	41 89 cf             	mov    %ecx,%r15d
+  800804:	4c 39 fa             	cmp    %r15,%rdx
+  800807:	73 5b                	jae    800864 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800809:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80080d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800811:	85 db                	test   %ebx,%ebx
+  800813:	7e 0e                	jle    800823 <print_num+0x43>
+            putch(padc, put_arg);
+  800815:	4c 89 ee             	mov    %r13,%rsi
+  800818:	44 89 f7             	mov    %r14d,%edi
+  80081b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80081e:	83 eb 01             	sub    $0x1,%ebx
+  800821:	75 f2                	jne    800815 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800823:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800827:	48 b9 54 3d 80 00 00 	movabs $0x803d54,%rcx
+  80082e:	00 00 00 
+  800831:	48 b8 43 3d 80 00 00 	movabs $0x803d43,%rax
+  800838:	00 00 00 
+  80083b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80083f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800843:	ba 00 00 00 00       	mov    $0x0,%edx
+  800848:	49 f7 f7             	div    %r15
+  80084b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80084f:	4c 89 ee             	mov    %r13,%rsi
+  800852:	41 ff d4             	call   *%r12
+}
+  800855:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800859:	5b                   	pop    %rbx
+  80085a:	41 5c                	pop    %r12
+  80085c:	41 5d                	pop    %r13
+  80085e:	41 5e                	pop    %r14
+  800860:	41 5f                	pop    %r15
+  800862:	5d                   	pop    %rbp
+  800863:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800864:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086d:	49 f7 f7             	div    %r15
+  800870:	48 83 ec 08          	sub    $0x8,%rsp
+  800874:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800878:	52                   	push   %rdx
+  800879:	45 0f be c9          	movsbl %r9b,%r9d
+  80087d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800881:	48 89 c2             	mov    %rax,%rdx
+  800884:	48 b8 e0 07 80 00 00 	movabs $0x8007e0,%rax
+  80088b:	00 00 00 
+  80088e:	ff d0                	call   *%rax
+  800890:	48 83 c4 10          	add    $0x10,%rsp
+  800894:	eb 8d                	jmp    800823 <print_num+0x43>
+
+0000000000800896 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800896:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80089a:	48 8b 06             	mov    (%rsi),%rax
+  80089d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008a1:	73 0a                	jae    8008ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8008a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008a7:	48 89 16             	mov    %rdx,(%rsi)
+  8008aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008ad:	c3                   	ret
+
+00000000008008ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008ae:	55                   	push   %rbp
+  8008af:	48 89 e5             	mov    %rsp,%rbp
+  8008b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8008b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008dd:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  8008e4:	00 00 00 
+  8008e7:	ff d0                	call   *%rax
+}
+  8008e9:	c9                   	leave
+  8008ea:	c3                   	ret
+
+00000000008008eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008eb:	55                   	push   %rbp
+  8008ec:	48 89 e5             	mov    %rsp,%rbp
+  8008ef:	41 57                	push   %r15
+  8008f1:	41 56                	push   %r14
+  8008f3:	41 55                	push   %r13
+  8008f5:	41 54                	push   %r12
+  8008f7:	53                   	push   %rbx
+  8008f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8008fc:	49 89 fe             	mov    %rdi,%r14
+  8008ff:	49 89 f5             	mov    %rsi,%r13
+  800902:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800905:	48 8b 01             	mov    (%rcx),%rax
+  800908:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80090c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800918:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80091c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800920:	0f b6 3b             	movzbl (%rbx),%edi
+  800923:	40 80 ff 25          	cmp    $0x25,%dil
+  800927:	74 18                	je     800941 <vprintfmt+0x56>
+            if (!ch) return;
+  800929:	40 84 ff             	test   %dil,%dil
+  80092c:	0f 84 b1 06 00 00    	je     800fe3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800932:	40 0f b6 ff          	movzbl %dil,%edi
+  800936:	4c 89 ee             	mov    %r13,%rsi
+  800939:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80093c:	4c 89 e3             	mov    %r12,%rbx
+  80093f:	eb db                	jmp    80091c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800941:	be 00 00 00 00       	mov    $0x0,%esi
+  800946:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80094a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80094f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800955:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80095c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800960:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800965:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80096a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80096d:	83 e8 23             	sub    $0x23,%eax
+  800970:	3c 57                	cmp    $0x57,%al
+  800972:	0f 87 51 06 00 00    	ja     800fc9 <vprintfmt+0x6de>
+  800978:	0f b6 c0             	movzbl %al,%eax
+  80097b:	48 b9 e0 3e 80 00 00 	movabs $0x803ee0,%rcx
+  800982:	00 00 00 
+  800985:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800988:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80098b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80098f:	eb cf                	jmp    800960 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800991:	49 89 dc             	mov    %rbx,%r12
+  800994:	be 01 00 00 00       	mov    $0x1,%esi
+  800999:	eb c5                	jmp    800960 <vprintfmt+0x75>
+            padc = ch;
+  80099b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80099f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009a5:	eb b9                	jmp    800960 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 24                	ja     8009d3 <vprintfmt+0xe8>
+  8009af:	89 c1                	mov    %eax,%ecx
+  8009b1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009b5:	83 c0 08             	add    $0x8,%eax
+  8009b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009be:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009c5:	79 99                	jns    800960 <vprintfmt+0x75>
+                width = precision;
+  8009c7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009d1:	eb 8d                	jmp    800960 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009d7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb da                	jmp    8009bb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009e1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009e6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009ea:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009f0:	3c 39                	cmp    $0x39,%al
+  8009f2:	77 1c                	ja     800a10 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009f4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009f8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009fc:	0f b6 c0             	movzbl %al,%eax
+  8009ff:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a04:	0f b6 03             	movzbl (%rbx),%eax
+  800a07:	3c 39                	cmp    $0x39,%al
+  800a09:	76 e9                	jbe    8009f4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a0b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a0e:	eb b1                	jmp    8009c1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a10:	49 89 dc             	mov    %rbx,%r12
+  800a13:	eb ac                	jmp    8009c1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a15:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a18:	85 c9                	test   %ecx,%ecx
+  800a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1f:	0f 49 c1             	cmovns %ecx,%eax
+  800a22:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a25:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a28:	e9 33 ff ff ff       	jmp    800960 <vprintfmt+0x75>
+            lflag++;
+  800a2d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a30:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a33:	e9 28 ff ff ff       	jmp    800960 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3e:	77 19                	ja     800a59 <vprintfmt+0x16e>
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a46:	83 c0 08             	add    $0x8,%eax
+  800a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4c:	8b 3a                	mov    (%rdx),%edi
+  800a4e:	4c 89 ee             	mov    %r13,%rsi
+  800a51:	41 ff d6             	call   *%r14
+            break;
+  800a54:	e9 c3 fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a65:	eb e5                	jmp    800a4c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6d:	77 5a                	ja     800ac9 <vprintfmt+0x1de>
+  800a6f:	89 c2                	mov    %eax,%edx
+  800a71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a75:	83 c0 08             	add    $0x8,%eax
+  800a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a7b:	8b 02                	mov    (%rdx),%eax
+  800a7d:	89 c1                	mov    %eax,%ecx
+  800a7f:	f7 d9                	neg    %ecx
+  800a81:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a84:	83 f9 14             	cmp    $0x14,%ecx
+  800a87:	7f 4e                	jg     800ad7 <vprintfmt+0x1ec>
+  800a89:	48 63 c1             	movslq %ecx,%rax
+  800a8c:	48 ba a0 41 80 00 00 	movabs $0x8041a0,%rdx
+  800a93:	00 00 00 
+  800a96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a9a:	48 85 c0             	test   %rax,%rax
+  800a9d:	74 38                	je     800ad7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a9f:	48 89 c1             	mov    %rax,%rcx
+  800aa2:	48 ba 65 3c 80 00 00 	movabs $0x803c65,%rdx
+  800aa9:	00 00 00 
+  800aac:	4c 89 ee             	mov    %r13,%rsi
+  800aaf:	4c 89 f7             	mov    %r14,%rdi
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab7:	49 b8 ae 08 80 00 00 	movabs $0x8008ae,%r8
+  800abe:	00 00 00 
+  800ac1:	41 ff d0             	call   *%r8
+  800ac4:	e9 53 fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ac9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad5:	eb a4                	jmp    800a7b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ad7:	48 ba 6c 3d 80 00 00 	movabs $0x803d6c,%rdx
+  800ade:	00 00 00 
+  800ae1:	4c 89 ee             	mov    %r13,%rsi
+  800ae4:	4c 89 f7             	mov    %r14,%rdi
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	49 b8 ae 08 80 00 00 	movabs $0x8008ae,%r8
+  800af3:	00 00 00 
+  800af6:	41 ff d0             	call   *%r8
+  800af9:	e9 1e fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800afe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b01:	83 f8 2f             	cmp    $0x2f,%eax
+  800b04:	77 6c                	ja     800b72 <vprintfmt+0x287>
+  800b06:	89 c2                	mov    %eax,%edx
+  800b08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0c:	83 c0 08             	add    $0x8,%eax
+  800b0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b12:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b15:	48 85 d2             	test   %rdx,%rdx
+  800b18:	48 b8 65 3d 80 00 00 	movabs $0x803d65,%rax
+  800b1f:	00 00 00 
+  800b22:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b26:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b2a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b2e:	7e 06                	jle    800b36 <vprintfmt+0x24b>
+  800b30:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b34:	75 4a                	jne    800b80 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b36:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b3a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b3e:	0f b6 00             	movzbl (%rax),%eax
+  800b41:	84 c0                	test   %al,%al
+  800b43:	0f 85 9a 00 00 00    	jne    800be3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b49:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b4c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b50:	85 c0                	test   %eax,%eax
+  800b52:	0f 8e c4 fd ff ff    	jle    80091c <vprintfmt+0x31>
+  800b58:	4c 89 ee             	mov    %r13,%rsi
+  800b5b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b60:	41 ff d6             	call   *%r14
+  800b63:	41 83 ec 01          	sub    $0x1,%r12d
+  800b67:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b6b:	75 eb                	jne    800b58 <vprintfmt+0x26d>
+  800b6d:	e9 aa fd ff ff       	jmp    80091c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7e:	eb 92                	jmp    800b12 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b80:	49 63 f7             	movslq %r15d,%rsi
+  800b83:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b87:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  800b8e:	00 00 00 
+  800b91:	ff d0                	call   *%rax
+  800b93:	48 89 c2             	mov    %rax,%rdx
+  800b96:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b99:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b9b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b9e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ba1:	85 c0                	test   %eax,%eax
+  800ba3:	7e 91                	jle    800b36 <vprintfmt+0x24b>
+  800ba5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800baa:	4c 89 ee             	mov    %r13,%rsi
+  800bad:	44 89 e7             	mov    %r12d,%edi
+  800bb0:	41 ff d6             	call   *%r14
+  800bb3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bb7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bba:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bbd:	75 eb                	jne    800baa <vprintfmt+0x2bf>
+  800bbf:	e9 72 ff ff ff       	jmp    800b36 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bc4:	0f b6 f8             	movzbl %al,%edi
+  800bc7:	4c 89 ee             	mov    %r13,%rsi
+  800bca:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bcd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bd1:	49 83 c4 01          	add    $0x1,%r12
+  800bd5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bdb:	84 c0                	test   %al,%al
+  800bdd:	0f 84 66 ff ff ff    	je     800b49 <vprintfmt+0x25e>
+  800be3:	45 85 ff             	test   %r15d,%r15d
+  800be6:	78 0a                	js     800bf2 <vprintfmt+0x307>
+  800be8:	41 83 ef 01          	sub    $0x1,%r15d
+  800bec:	0f 88 57 ff ff ff    	js     800b49 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bf2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800bf6:	74 cc                	je     800bc4 <vprintfmt+0x2d9>
+  800bf8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800bfb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c00:	80 fa 5e             	cmp    $0x5e,%dl
+  800c03:	77 c2                	ja     800bc7 <vprintfmt+0x2dc>
+  800c05:	eb bd                	jmp    800bc4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c07:	40 84 f6             	test   %sil,%sil
+  800c0a:	75 26                	jne    800c32 <vprintfmt+0x347>
+    switch (lflag) {
+  800c0c:	85 d2                	test   %edx,%edx
+  800c0e:	74 59                	je     800c69 <vprintfmt+0x37e>
+  800c10:	83 fa 01             	cmp    $0x1,%edx
+  800c13:	74 7b                	je     800c90 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c18:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1b:	0f 87 96 00 00 00    	ja     800cb7 <vprintfmt+0x3cc>
+  800c21:	89 c2                	mov    %eax,%edx
+  800c23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c27:	83 c0 08             	add    $0x8,%eax
+  800c2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2d:	4c 8b 22             	mov    (%rdx),%r12
+  800c30:	eb 17                	jmp    800c49 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c35:	83 f8 2f             	cmp    $0x2f,%eax
+  800c38:	77 21                	ja     800c5b <vprintfmt+0x370>
+  800c3a:	89 c2                	mov    %eax,%edx
+  800c3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c40:	83 c0 08             	add    $0x8,%eax
+  800c43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c46:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c49:	4d 85 e4             	test   %r12,%r12
+  800c4c:	78 7a                	js     800cc8 <vprintfmt+0x3dd>
+            num = i;
+  800c4e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c56:	e9 50 02 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c67:	eb dd                	jmp    800c46 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6f:	77 11                	ja     800c82 <vprintfmt+0x397>
+  800c71:	89 c2                	mov    %eax,%edx
+  800c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c77:	83 c0 08             	add    $0x8,%eax
+  800c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7d:	4c 63 22             	movslq (%rdx),%r12
+  800c80:	eb c7                	jmp    800c49 <vprintfmt+0x35e>
+  800c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8e:	eb ed                	jmp    800c7d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c93:	83 f8 2f             	cmp    $0x2f,%eax
+  800c96:	77 11                	ja     800ca9 <vprintfmt+0x3be>
+  800c98:	89 c2                	mov    %eax,%edx
+  800c9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9e:	83 c0 08             	add    $0x8,%eax
+  800ca1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca4:	4c 8b 22             	mov    (%rdx),%r12
+  800ca7:	eb a0                	jmp    800c49 <vprintfmt+0x35e>
+  800ca9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb5:	eb ed                	jmp    800ca4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800cb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc3:	e9 65 ff ff ff       	jmp    800c2d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cc8:	4c 89 ee             	mov    %r13,%rsi
+  800ccb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cd0:	41 ff d6             	call   *%r14
+                i = -i;
+  800cd3:	49 f7 dc             	neg    %r12
+  800cd6:	e9 73 ff ff ff       	jmp    800c4e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800cdb:	40 84 f6             	test   %sil,%sil
+  800cde:	75 32                	jne    800d12 <vprintfmt+0x427>
+    switch (lflag) {
+  800ce0:	85 d2                	test   %edx,%edx
+  800ce2:	74 5d                	je     800d41 <vprintfmt+0x456>
+  800ce4:	83 fa 01             	cmp    $0x1,%edx
+  800ce7:	0f 84 82 00 00 00    	je     800d6f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ced:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf3:	0f 87 a5 00 00 00    	ja     800d9e <vprintfmt+0x4b3>
+  800cf9:	89 c2                	mov    %eax,%edx
+  800cfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cff:	83 c0 08             	add    $0x8,%eax
+  800d02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d0d:	e9 99 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d15:	83 f8 2f             	cmp    $0x2f,%eax
+  800d18:	77 19                	ja     800d33 <vprintfmt+0x448>
+  800d1a:	89 c2                	mov    %eax,%edx
+  800d1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d20:	83 c0 08             	add    $0x8,%eax
+  800d23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d26:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d2e:	e9 78 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3f:	eb e5                	jmp    800d26 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d44:	83 f8 2f             	cmp    $0x2f,%eax
+  800d47:	77 18                	ja     800d61 <vprintfmt+0x476>
+  800d49:	89 c2                	mov    %eax,%edx
+  800d4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4f:	83 c0 08             	add    $0x8,%eax
+  800d52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d55:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5c:	e9 4a 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e6                	jmp    800d55 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 19                	ja     800d90 <vprintfmt+0x4a5>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7d:	83 c0 08             	add    $0x8,%eax
+  800d80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d83:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d8b:	e9 1b 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9c:	eb e5                	jmp    800d83 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daa:	e9 56 ff ff ff       	jmp    800d05 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800daf:	40 84 f6             	test   %sil,%sil
+  800db2:	75 2e                	jne    800de2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800db4:	85 d2                	test   %edx,%edx
+  800db6:	74 59                	je     800e11 <vprintfmt+0x526>
+  800db8:	83 fa 01             	cmp    $0x1,%edx
+  800dbb:	74 7f                	je     800e3c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc3:	0f 87 9f 00 00 00    	ja     800e68 <vprintfmt+0x57d>
+  800dc9:	89 c2                	mov    %eax,%edx
+  800dcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dcf:	83 c0 08             	add    $0x8,%eax
+  800dd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800dd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ddd:	e9 c9 00 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800de2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de5:	83 f8 2f             	cmp    $0x2f,%eax
+  800de8:	77 19                	ja     800e03 <vprintfmt+0x518>
+  800dea:	89 c2                	mov    %eax,%edx
+  800dec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df0:	83 c0 08             	add    $0x8,%eax
+  800df3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800df9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dfe:	e9 a8 00 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800e03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0f:	eb e5                	jmp    800df6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e14:	83 f8 2f             	cmp    $0x2f,%eax
+  800e17:	77 15                	ja     800e2e <vprintfmt+0x543>
+  800e19:	89 c2                	mov    %eax,%edx
+  800e1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1f:	83 c0 08             	add    $0x8,%eax
+  800e22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e25:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e27:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e2c:	eb 7d                	jmp    800eab <vprintfmt+0x5c0>
+  800e2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3a:	eb e9                	jmp    800e25 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e42:	77 16                	ja     800e5a <vprintfmt+0x56f>
+  800e44:	89 c2                	mov    %eax,%edx
+  800e46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4a:	83 c0 08             	add    $0x8,%eax
+  800e4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e50:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e53:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e58:	eb 51                	jmp    800eab <vprintfmt+0x5c0>
+  800e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e66:	eb e8                	jmp    800e50 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e74:	e9 5c ff ff ff       	jmp    800dd5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e79:	4c 89 ee             	mov    %r13,%rsi
+  800e7c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e81:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e84:	4c 89 ee             	mov    %r13,%rsi
+  800e87:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e8c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e92:	83 f8 2f             	cmp    $0x2f,%eax
+  800e95:	77 47                	ja     800ede <vprintfmt+0x5f3>
+  800e97:	89 c2                	mov    %eax,%edx
+  800e99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e9d:	83 c0 08             	add    $0x8,%eax
+  800ea0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ea3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ea6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800eab:	48 83 ec 08          	sub    $0x8,%rsp
+  800eaf:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800eb3:	0f 94 c0             	sete   %al
+  800eb6:	0f b6 c0             	movzbl %al,%eax
+  800eb9:	50                   	push   %rax
+  800eba:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ebf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ec3:	4c 89 ee             	mov    %r13,%rsi
+  800ec6:	4c 89 f7             	mov    %r14,%rdi
+  800ec9:	48 b8 e0 07 80 00 00 	movabs $0x8007e0,%rax
+  800ed0:	00 00 00 
+  800ed3:	ff d0                	call   *%rax
+            break;
+  800ed5:	48 83 c4 10          	add    $0x10,%rsp
+  800ed9:	e9 3e fa ff ff       	jmp    80091c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ede:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ee2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eea:	eb b7                	jmp    800ea3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800eec:	40 84 f6             	test   %sil,%sil
+  800eef:	75 2b                	jne    800f1c <vprintfmt+0x631>
+    switch (lflag) {
+  800ef1:	85 d2                	test   %edx,%edx
+  800ef3:	74 56                	je     800f4b <vprintfmt+0x660>
+  800ef5:	83 fa 01             	cmp    $0x1,%edx
+  800ef8:	74 7f                	je     800f79 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800efa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800efd:	83 f8 2f             	cmp    $0x2f,%eax
+  800f00:	0f 87 a2 00 00 00    	ja     800fa8 <vprintfmt+0x6bd>
+  800f06:	89 c2                	mov    %eax,%edx
+  800f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f0c:	83 c0 08             	add    $0x8,%eax
+  800f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f15:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f1a:	eb 8f                	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800f22:	77 19                	ja     800f3d <vprintfmt+0x652>
+  800f24:	89 c2                	mov    %eax,%edx
+  800f26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f2a:	83 c0 08             	add    $0x8,%eax
+  800f2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f33:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f38:	e9 6e ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f49:	eb e5                	jmp    800f30 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f51:	77 18                	ja     800f6b <vprintfmt+0x680>
+  800f53:	89 c2                	mov    %eax,%edx
+  800f55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f59:	83 c0 08             	add    $0x8,%eax
+  800f5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f61:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f66:	e9 40 ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f77:	eb e6                	jmp    800f5f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7f:	77 19                	ja     800f9a <vprintfmt+0x6af>
+  800f81:	89 c2                	mov    %eax,%edx
+  800f83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f87:	83 c0 08             	add    $0x8,%eax
+  800f8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f90:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f95:	e9 11 ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa6:	eb e5                	jmp    800f8d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb4:	e9 59 ff ff ff       	jmp    800f12 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fb9:	4c 89 ee             	mov    %r13,%rsi
+  800fbc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fc1:	41 ff d6             	call   *%r14
+            break;
+  800fc4:	e9 53 f9 ff ff       	jmp    80091c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fc9:	4c 89 ee             	mov    %r13,%rsi
+  800fcc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fd1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fd4:	48 83 eb 01          	sub    $0x1,%rbx
+  800fd8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fdc:	75 f6                	jne    800fd4 <vprintfmt+0x6e9>
+  800fde:	e9 39 f9 ff ff       	jmp    80091c <vprintfmt+0x31>
+}
+  800fe3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fe7:	5b                   	pop    %rbx
+  800fe8:	41 5c                	pop    %r12
+  800fea:	41 5d                	pop    %r13
+  800fec:	41 5e                	pop    %r14
+  800fee:	41 5f                	pop    %r15
+  800ff0:	5d                   	pop    %rbp
+  800ff1:	c3                   	ret
+
+0000000000800ff2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ff2:	55                   	push   %rbp
+  800ff3:	48 89 e5             	mov    %rsp,%rbp
+  800ff6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ffa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ffe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801003:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801007:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80100e:	48 85 ff             	test   %rdi,%rdi
+  801011:	74 2b                	je     80103e <vsnprintf+0x4c>
+  801013:	48 85 f6             	test   %rsi,%rsi
+  801016:	74 26                	je     80103e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801018:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80101c:	48 bf 96 08 80 00 00 	movabs $0x800896,%rdi
+  801023:	00 00 00 
+  801026:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801032:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801036:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801039:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80103c:	c9                   	leave
+  80103d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80103e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801043:	eb f7                	jmp    80103c <vsnprintf+0x4a>
+
+0000000000801045 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	48 83 ec 50          	sub    $0x50,%rsp
+  80104d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801051:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801055:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801059:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801060:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801064:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801068:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80106c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801070:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801074:	48 b8 f2 0f 80 00 00 	movabs $0x800ff2,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+0000000000801082 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801082:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801085:	74 10                	je     801097 <strlen+0x15>
+    size_t n = 0;
+  801087:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80108c:	48 83 c0 01          	add    $0x1,%rax
+  801090:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801094:	75 f6                	jne    80108c <strlen+0xa>
+  801096:	c3                   	ret
+    size_t n = 0;
+  801097:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80109c:	c3                   	ret
+
+000000000080109d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80109d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010a0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010a5:	48 85 f6             	test   %rsi,%rsi
+  8010a8:	74 11                	je     8010bb <strnlen+0x1e>
+  8010aa:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010ae:	74 0c                	je     8010bc <strnlen+0x1f>
+  8010b0:	48 83 c2 01          	add    $0x1,%rdx
+  8010b4:	48 39 d0             	cmp    %rdx,%rax
+  8010b7:	75 f1                	jne    8010aa <strnlen+0xd>
+  8010b9:	eb 04                	jmp    8010bf <strnlen+0x22>
+  8010bb:	c3                   	ret
+  8010bc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010bf:	c3                   	ret
+
+00000000008010c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010c0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010cc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010cf:	48 83 c2 01          	add    $0x1,%rdx
+  8010d3:	84 c9                	test   %cl,%cl
+  8010d5:	75 f1                	jne    8010c8 <strcpy+0x8>
+        ;
+    return res;
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010d8:	55                   	push   %rbp
+  8010d9:	48 89 e5             	mov    %rsp,%rbp
+  8010dc:	41 54                	push   %r12
+  8010de:	53                   	push   %rbx
+  8010df:	48 89 fb             	mov    %rdi,%rbx
+  8010e2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010e5:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010f1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010f5:	4c 89 e6             	mov    %r12,%rsi
+  8010f8:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  8010ff:	00 00 00 
+  801102:	ff d0                	call   *%rax
+    return dst;
+}
+  801104:	48 89 d8             	mov    %rbx,%rax
+  801107:	5b                   	pop    %rbx
+  801108:	41 5c                	pop    %r12
+  80110a:	5d                   	pop    %rbp
+  80110b:	c3                   	ret
+
+000000000080110c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80110c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80110f:	48 85 d2             	test   %rdx,%rdx
+  801112:	74 1f                	je     801133 <strncpy+0x27>
+  801114:	48 01 fa             	add    %rdi,%rdx
+  801117:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80111a:	48 83 c1 01          	add    $0x1,%rcx
+  80111e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801122:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801126:	41 80 f8 01          	cmp    $0x1,%r8b
+  80112a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80112e:	48 39 ca             	cmp    %rcx,%rdx
+  801131:	75 e7                	jne    80111a <strncpy+0xe>
+    }
+    return ret;
+}
+  801133:	c3                   	ret
+
+0000000000801134 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801134:	48 89 f8             	mov    %rdi,%rax
+  801137:	48 85 d2             	test   %rdx,%rdx
+  80113a:	74 24                	je     801160 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80113c:	48 83 ea 01          	sub    $0x1,%rdx
+  801140:	74 1b                	je     80115d <strlcpy+0x29>
+  801142:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801146:	0f b6 16             	movzbl (%rsi),%edx
+  801149:	84 d2                	test   %dl,%dl
+  80114b:	74 10                	je     80115d <strlcpy+0x29>
+            *dst++ = *src++;
+  80114d:	48 83 c6 01          	add    $0x1,%rsi
+  801151:	48 83 c0 01          	add    $0x1,%rax
+  801155:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801158:	48 39 c8             	cmp    %rcx,%rax
+  80115b:	75 e9                	jne    801146 <strlcpy+0x12>
+        *dst = '\0';
+  80115d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801160:	48 29 f8             	sub    %rdi,%rax
+}
+  801163:	c3                   	ret
+
+0000000000801164 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801164:	0f b6 07             	movzbl (%rdi),%eax
+  801167:	84 c0                	test   %al,%al
+  801169:	74 13                	je     80117e <strcmp+0x1a>
+  80116b:	38 06                	cmp    %al,(%rsi)
+  80116d:	75 0f                	jne    80117e <strcmp+0x1a>
+  80116f:	48 83 c7 01          	add    $0x1,%rdi
+  801173:	48 83 c6 01          	add    $0x1,%rsi
+  801177:	0f b6 07             	movzbl (%rdi),%eax
+  80117a:	84 c0                	test   %al,%al
+  80117c:	75 ed                	jne    80116b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80117e:	0f b6 c0             	movzbl %al,%eax
+  801181:	0f b6 16             	movzbl (%rsi),%edx
+  801184:	29 d0                	sub    %edx,%eax
+}
+  801186:	c3                   	ret
+
+0000000000801187 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801187:	48 85 d2             	test   %rdx,%rdx
+  80118a:	74 1f                	je     8011ab <strncmp+0x24>
+  80118c:	0f b6 07             	movzbl (%rdi),%eax
+  80118f:	84 c0                	test   %al,%al
+  801191:	74 1e                	je     8011b1 <strncmp+0x2a>
+  801193:	3a 06                	cmp    (%rsi),%al
+  801195:	75 1a                	jne    8011b1 <strncmp+0x2a>
+  801197:	48 83 c7 01          	add    $0x1,%rdi
+  80119b:	48 83 c6 01          	add    $0x1,%rsi
+  80119f:	48 83 ea 01          	sub    $0x1,%rdx
+  8011a3:	75 e7                	jne    80118c <strncmp+0x5>
+
+    if (!n) return 0;
+  8011a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011aa:	c3                   	ret
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b0:	c3                   	ret
+  8011b1:	48 85 d2             	test   %rdx,%rdx
+  8011b4:	74 09                	je     8011bf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011b6:	0f b6 07             	movzbl (%rdi),%eax
+  8011b9:	0f b6 16             	movzbl (%rsi),%edx
+  8011bc:	29 d0                	sub    %edx,%eax
+  8011be:	c3                   	ret
+    if (!n) return 0;
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011c5:	0f b6 17             	movzbl (%rdi),%edx
+  8011c8:	84 d2                	test   %dl,%dl
+  8011ca:	74 18                	je     8011e4 <strchr+0x1f>
+        if (*str == c) {
+  8011cc:	0f be d2             	movsbl %dl,%edx
+  8011cf:	39 f2                	cmp    %esi,%edx
+  8011d1:	74 17                	je     8011ea <strchr+0x25>
+    for (; *str; str++) {
+  8011d3:	48 83 c7 01          	add    $0x1,%rdi
+  8011d7:	0f b6 17             	movzbl (%rdi),%edx
+  8011da:	84 d2                	test   %dl,%dl
+  8011dc:	75 ee                	jne    8011cc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e3:	c3                   	ret
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e9:	c3                   	ret
+  8011ea:	48 89 f8             	mov    %rdi,%rax
+}
+  8011ed:	c3                   	ret
+
+00000000008011ee <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011ee:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011f1:	0f b6 17             	movzbl (%rdi),%edx
+  8011f4:	84 d2                	test   %dl,%dl
+  8011f6:	74 13                	je     80120b <strfind+0x1d>
+  8011f8:	0f be d2             	movsbl %dl,%edx
+  8011fb:	39 f2                	cmp    %esi,%edx
+  8011fd:	74 0b                	je     80120a <strfind+0x1c>
+  8011ff:	48 83 c0 01          	add    $0x1,%rax
+  801203:	0f b6 10             	movzbl (%rax),%edx
+  801206:	84 d2                	test   %dl,%dl
+  801208:	75 ee                	jne    8011f8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80120a:	c3                   	ret
+  80120b:	c3                   	ret
+
+000000000080120c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80120c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80120f:	48 89 f8             	mov    %rdi,%rax
+  801212:	48 f7 d8             	neg    %rax
+  801215:	83 e0 07             	and    $0x7,%eax
+  801218:	49 89 d1             	mov    %rdx,%r9
+  80121b:	49 29 c1             	sub    %rax,%r9
+  80121e:	78 36                	js     801256 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801220:	40 0f b6 c6          	movzbl %sil,%eax
+  801224:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80122b:	01 01 01 
+  80122e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801232:	40 f6 c7 07          	test   $0x7,%dil
+  801236:	75 38                	jne    801270 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801238:	4c 89 c9             	mov    %r9,%rcx
+  80123b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80123f:	74 0c                	je     80124d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801241:	fc                   	cld
+  801242:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801245:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801249:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80124d:	4d 85 c9             	test   %r9,%r9
+  801250:	75 45                	jne    801297 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801252:	4c 89 c0             	mov    %r8,%rax
+  801255:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801256:	48 85 d2             	test   %rdx,%rdx
+  801259:	74 f7                	je     801252 <memset+0x46>
+  80125b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80125e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801261:	48 83 c0 01          	add    $0x1,%rax
+  801265:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801269:	48 39 c2             	cmp    %rax,%rdx
+  80126c:	75 f3                	jne    801261 <memset+0x55>
+  80126e:	eb e2                	jmp    801252 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801270:	40 f6 c7 01          	test   $0x1,%dil
+  801274:	74 06                	je     80127c <memset+0x70>
+  801276:	88 07                	mov    %al,(%rdi)
+  801278:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80127c:	40 f6 c7 02          	test   $0x2,%dil
+  801280:	74 07                	je     801289 <memset+0x7d>
+  801282:	66 89 07             	mov    %ax,(%rdi)
+  801285:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801289:	40 f6 c7 04          	test   $0x4,%dil
+  80128d:	74 a9                	je     801238 <memset+0x2c>
+  80128f:	89 07                	mov    %eax,(%rdi)
+  801291:	48 83 c7 04          	add    $0x4,%rdi
+  801295:	eb a1                	jmp    801238 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801297:	41 f6 c1 04          	test   $0x4,%r9b
+  80129b:	74 06                	je     8012a3 <memset+0x97>
+  80129d:	89 07                	mov    %eax,(%rdi)
+  80129f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012a3:	41 f6 c1 02          	test   $0x2,%r9b
+  8012a7:	74 07                	je     8012b0 <memset+0xa4>
+  8012a9:	66 89 07             	mov    %ax,(%rdi)
+  8012ac:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012b0:	41 f6 c1 01          	test   $0x1,%r9b
+  8012b4:	74 9c                	je     801252 <memset+0x46>
+  8012b6:	88 07                	mov    %al,(%rdi)
+  8012b8:	eb 98                	jmp    801252 <memset+0x46>
+
+00000000008012ba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012ba:	48 89 f8             	mov    %rdi,%rax
+  8012bd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012c0:	48 39 fe             	cmp    %rdi,%rsi
+  8012c3:	73 3b                	jae    801300 <memmove+0x46>
+  8012c5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012c9:	48 39 d7             	cmp    %rdx,%rdi
+  8012cc:	73 32                	jae    801300 <memmove+0x46>
+        s += n;
+        d += n;
+  8012ce:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012d2:	48 89 d6             	mov    %rdx,%rsi
+  8012d5:	48 09 fe             	or     %rdi,%rsi
+  8012d8:	48 09 ce             	or     %rcx,%rsi
+  8012db:	40 f6 c6 07          	test   $0x7,%sil
+  8012df:	75 12                	jne    8012f3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012e1:	48 83 ef 08          	sub    $0x8,%rdi
+  8012e5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012e9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012ed:	fd                   	std
+  8012ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012f1:	fc                   	cld
+  8012f2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012f3:	48 83 ef 01          	sub    $0x1,%rdi
+  8012f7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012fb:	fd                   	std
+  8012fc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012fe:	eb f1                	jmp    8012f1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801300:	48 89 f2             	mov    %rsi,%rdx
+  801303:	48 09 c2             	or     %rax,%rdx
+  801306:	48 09 ca             	or     %rcx,%rdx
+  801309:	f6 c2 07             	test   $0x7,%dl
+  80130c:	75 0c                	jne    80131a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80130e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801312:	48 89 c7             	mov    %rax,%rdi
+  801315:	fc                   	cld
+  801316:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801319:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80131a:	48 89 c7             	mov    %rax,%rdi
+  80131d:	fc                   	cld
+  80131e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801320:	c3                   	ret
+
+0000000000801321 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801325:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+}
+  801331:	5d                   	pop    %rbp
+  801332:	c3                   	ret
+
+0000000000801333 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+  801337:	41 57                	push   %r15
+  801339:	41 56                	push   %r14
+  80133b:	41 55                	push   %r13
+  80133d:	41 54                	push   %r12
+  80133f:	53                   	push   %rbx
+  801340:	48 83 ec 08          	sub    $0x8,%rsp
+  801344:	49 89 fe             	mov    %rdi,%r14
+  801347:	49 89 f7             	mov    %rsi,%r15
+  80134a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80134d:	48 89 f7             	mov    %rsi,%rdi
+  801350:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  801357:	00 00 00 
+  80135a:	ff d0                	call   *%rax
+  80135c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80135f:	48 89 de             	mov    %rbx,%rsi
+  801362:	4c 89 f7             	mov    %r14,%rdi
+  801365:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  80136c:	00 00 00 
+  80136f:	ff d0                	call   *%rax
+  801371:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801374:	48 39 c3             	cmp    %rax,%rbx
+  801377:	74 36                	je     8013af <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801379:	48 89 d8             	mov    %rbx,%rax
+  80137c:	4c 29 e8             	sub    %r13,%rax
+  80137f:	49 39 c4             	cmp    %rax,%r12
+  801382:	73 31                	jae    8013b5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801384:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801389:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80138d:	4c 89 fe             	mov    %r15,%rsi
+  801390:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801397:	00 00 00 
+  80139a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80139c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013a0:	48 83 c4 08          	add    $0x8,%rsp
+  8013a4:	5b                   	pop    %rbx
+  8013a5:	41 5c                	pop    %r12
+  8013a7:	41 5d                	pop    %r13
+  8013a9:	41 5e                	pop    %r14
+  8013ab:	41 5f                	pop    %r15
+  8013ad:	5d                   	pop    %rbp
+  8013ae:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013af:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013b3:	eb eb                	jmp    8013a0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013b5:	48 83 eb 01          	sub    $0x1,%rbx
+  8013b9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013bd:	48 89 da             	mov    %rbx,%rdx
+  8013c0:	4c 89 fe             	mov    %r15,%rsi
+  8013c3:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8013ca:	00 00 00 
+  8013cd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013cf:	49 01 de             	add    %rbx,%r14
+  8013d2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013d7:	eb c3                	jmp    80139c <strlcat+0x69>
+
+00000000008013d9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013d9:	48 85 d2             	test   %rdx,%rdx
+  8013dc:	74 2d                	je     80140b <memcmp+0x32>
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013e3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013e7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013ec:	44 38 c1             	cmp    %r8b,%cl
+  8013ef:	75 0f                	jne    801400 <memcmp+0x27>
+    while (n-- > 0) {
+  8013f1:	48 83 c0 01          	add    $0x1,%rax
+  8013f5:	48 39 c2             	cmp    %rax,%rdx
+  8013f8:	75 e9                	jne    8013e3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ff:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801400:	0f b6 c1             	movzbl %cl,%eax
+  801403:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801407:	44 29 c0             	sub    %r8d,%eax
+  80140a:	c3                   	ret
+    return 0;
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801410:	c3                   	ret
+
+0000000000801411 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801411:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801415:	48 39 c7             	cmp    %rax,%rdi
+  801418:	73 0f                	jae    801429 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80141a:	40 38 37             	cmp    %sil,(%rdi)
+  80141d:	74 0e                	je     80142d <memfind+0x1c>
+    for (; src < end; src++) {
+  80141f:	48 83 c7 01          	add    $0x1,%rdi
+  801423:	48 39 f8             	cmp    %rdi,%rax
+  801426:	75 f2                	jne    80141a <memfind+0x9>
+  801428:	c3                   	ret
+  801429:	48 89 f8             	mov    %rdi,%rax
+  80142c:	c3                   	ret
+  80142d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801430:	c3                   	ret
+
+0000000000801431 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801431:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801434:	0f b6 37             	movzbl (%rdi),%esi
+  801437:	40 80 fe 20          	cmp    $0x20,%sil
+  80143b:	74 06                	je     801443 <strtol+0x12>
+  80143d:	40 80 fe 09          	cmp    $0x9,%sil
+  801441:	75 13                	jne    801456 <strtol+0x25>
+  801443:	48 83 c7 01          	add    $0x1,%rdi
+  801447:	0f b6 37             	movzbl (%rdi),%esi
+  80144a:	40 80 fe 20          	cmp    $0x20,%sil
+  80144e:	74 f3                	je     801443 <strtol+0x12>
+  801450:	40 80 fe 09          	cmp    $0x9,%sil
+  801454:	74 ed                	je     801443 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801456:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801459:	83 e0 fd             	and    $0xfffffffd,%eax
+  80145c:	3c 01                	cmp    $0x1,%al
+  80145e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801462:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801468:	75 0f                	jne    801479 <strtol+0x48>
+  80146a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80146d:	74 14                	je     801483 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80146f:	85 d2                	test   %edx,%edx
+  801471:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801476:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801479:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80147e:	4c 63 ca             	movslq %edx,%r9
+  801481:	eb 36                	jmp    8014b9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801483:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801487:	74 0f                	je     801498 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801489:	85 d2                	test   %edx,%edx
+  80148b:	75 ec                	jne    801479 <strtol+0x48>
+        s++;
+  80148d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801491:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801496:	eb e1                	jmp    801479 <strtol+0x48>
+        s += 2;
+  801498:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80149c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014a1:	eb d6                	jmp    801479 <strtol+0x48>
+            dig -= '0';
+  8014a3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014a6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014aa:	41 39 d0             	cmp    %edx,%r8d
+  8014ad:	7d 21                	jge    8014d0 <strtol+0x9f>
+        val = val * base + dig;
+  8014af:	49 0f af c1          	imul   %r9,%rax
+  8014b3:	0f b6 c9             	movzbl %cl,%ecx
+  8014b6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014b9:	48 83 c7 01          	add    $0x1,%rdi
+  8014bd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014c1:	80 f9 39             	cmp    $0x39,%cl
+  8014c4:	76 dd                	jbe    8014a3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014c6:	80 f9 7b             	cmp    $0x7b,%cl
+  8014c9:	77 05                	ja     8014d0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014cb:	83 e9 57             	sub    $0x57,%ecx
+  8014ce:	eb d6                	jmp    8014a6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014d0:	4d 85 d2             	test   %r10,%r10
+  8014d3:	74 03                	je     8014d8 <strtol+0xa7>
+  8014d5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014d8:	48 89 c2             	mov    %rax,%rdx
+  8014db:	48 f7 da             	neg    %rdx
+  8014de:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014e2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014e6:	c3                   	ret
+
+00000000008014e7 <strrev>:
+
+void
+strrev(char *str)
+{
+  8014e7:	55                   	push   %rbp
+  8014e8:	48 89 e5             	mov    %rsp,%rbp
+  8014eb:	53                   	push   %rbx
+  8014ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f0:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8014f3:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8014fa:	00 00 00 
+  8014fd:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8014ff:	83 e8 01             	sub    $0x1,%eax
+  801502:	85 c0                	test   %eax,%eax
+  801504:	7e 22                	jle    801528 <strrev+0x41>
+  801506:	48 98                	cltq
+  801508:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  80150d:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801511:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  801515:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  801519:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  80151c:	48 83 c2 01          	add    $0x1,%rdx
+  801520:	48 83 e8 01          	sub    $0x1,%rax
+  801524:	39 c2                	cmp    %eax,%edx
+  801526:	7c e5                	jl     80150d <strrev+0x26>
+	}
+}
+  801528:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152c:	c9                   	leave
+  80152d:	c3                   	ret
+
+000000000080152e <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  80152e:	85 d2                	test   %edx,%edx
+  801530:	0f 84 80 00 00 00    	je     8015b6 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801536:	55                   	push   %rbp
+  801537:	48 89 e5             	mov    %rsp,%rbp
+  80153a:	53                   	push   %rbx
+  80153b:	48 83 ec 08          	sub    $0x8,%rsp
+  80153f:	49 89 f2             	mov    %rsi,%r10
+  801542:	41 89 d3             	mov    %edx,%r11d
+  801545:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801548:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  80154d:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801550:	eb 20                	jmp    801572 <itoa+0x44>
+			str[i++] = '0' + digit;
+  801552:	41 89 f1             	mov    %esi,%r9d
+  801555:	83 c2 30             	add    $0x30,%edx
+  801558:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  80155b:	89 f8                	mov    %edi,%eax
+  80155d:	99                   	cltd
+  80155e:	f7 f9                	idiv   %ecx
+  801560:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  801562:	85 c0                	test   %eax,%eax
+  801564:	74 2e                	je     801594 <itoa+0x66>
+  801566:	83 c6 01             	add    $0x1,%esi
+  801569:	49 83 c0 01          	add    $0x1,%r8
+  80156d:	44 39 cb             	cmp    %r9d,%ebx
+  801570:	7e 15                	jle    801587 <itoa+0x59>
+		digit = sum % base;
+  801572:	89 f8                	mov    %edi,%eax
+  801574:	99                   	cltd
+  801575:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801577:	83 fa 09             	cmp    $0x9,%edx
+  80157a:	7e d6                	jle    801552 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  80157c:	41 89 f1             	mov    %esi,%r9d
+  80157f:	83 c2 37             	add    $0x37,%edx
+  801582:	41 88 10             	mov    %dl,(%r8)
+  801585:	eb d4                	jmp    80155b <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801587:	41 83 eb 01          	sub    $0x1,%r11d
+  80158b:	45 39 cb             	cmp    %r9d,%r11d
+  80158e:	75 04                	jne    801594 <itoa+0x66>
+  801590:	85 c0                	test   %eax,%eax
+  801592:	75 28                	jne    8015bc <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801594:	4d 63 c9             	movslq %r9d,%r9
+  801597:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  80159c:	4c 89 d7             	mov    %r10,%rdi
+  80159f:	48 b8 e7 14 80 00 00 	movabs $0x8014e7,%rax
+  8015a6:	00 00 00 
+  8015a9:	ff d0                	call   *%rax
+	return 0;
+  8015ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b4:	c9                   	leave
+  8015b5:	c3                   	ret
+		return -1;
+  8015b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015bb:	c3                   	ret
+		return -1;
+  8015bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015c1:	eb ed                	jmp    8015b0 <itoa+0x82>
+
+00000000008015c3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 89 fa             	mov    %rdi,%rdx
+  8015cb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e8:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8015ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ee:	c9                   	leave
+  8015ef:	c3                   	ret
+
+00000000008015f0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f5:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	53                   	push   %rbx
+  801626:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80162a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801632:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801637:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801641:	be 00 00 00 00       	mov    $0x0,%esi
+  801646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164e:	48 85 c0             	test   %rax,%rax
+  801651:	7f 06                	jg     801659 <sys_env_destroy+0x38>
+}
+  801653:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801657:	c9                   	leave
+  801658:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801659:	49 89 c0             	mov    %rax,%r8
+  80165c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801661:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  801668:	00 00 00 
+  80166b:	be 26 00 00 00       	mov    $0x26,%esi
+  801670:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  801677:	00 00 00 
+  80167a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167f:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801686:	00 00 00 
+  801689:	41 ff d1             	call   *%r9
+
+000000000080168c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80168c:	55                   	push   %rbp
+  80168d:	48 89 e5             	mov    %rsp,%rbp
+  801690:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801691:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801696:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8016af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bb:	c9                   	leave
+  8016bc:	c3                   	ret
+
+00000000008016bd <sys_yield>:
+
+void
+sys_yield(void) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016db:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e6:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+
+00000000008016ee <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+  8016f2:	53                   	push   %rbx
+  8016f3:	48 89 fa             	mov    %rdi,%rdx
+  8016f6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fe:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801705:	00 00 00 
+  801708:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170d:	be 00 00 00 00       	mov    $0x0,%esi
+  801712:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801718:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80171a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171e:	c9                   	leave
+  80171f:	c3                   	ret
+
+0000000000801720 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	49 89 f8             	mov    %rdi,%r8
+  801728:	48 89 d3             	mov    %rdx,%rbx
+  80172b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80172e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801733:	4c 89 c2             	mov    %r8,%rdx
+  801736:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801739:	be 00 00 00 00       	mov    $0x0,%esi
+  80173e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801744:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801746:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174a:	c9                   	leave
+  80174b:	c3                   	ret
+
+000000000080174c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80174c:	55                   	push   %rbp
+  80174d:	48 89 e5             	mov    %rsp,%rbp
+  801750:	53                   	push   %rbx
+  801751:	48 83 ec 08          	sub    $0x8,%rsp
+  801755:	89 f8                	mov    %edi,%eax
+  801757:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80175a:	48 63 f9             	movslq %ecx,%rdi
+  80175d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801760:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801765:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801768:	be 00 00 00 00       	mov    $0x0,%esi
+  80176d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801773:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801775:	48 85 c0             	test   %rax,%rax
+  801778:	7f 06                	jg     801780 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80177a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177e:	c9                   	leave
+  80177f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801780:	49 89 c0             	mov    %rax,%r8
+  801783:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801788:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  80178f:	00 00 00 
+  801792:	be 26 00 00 00       	mov    $0x26,%esi
+  801797:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  80179e:	00 00 00 
+  8017a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a6:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8017ad:	00 00 00 
+  8017b0:	41 ff d1             	call   *%r9
+
+00000000008017b3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	53                   	push   %rbx
+  8017b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017bc:	89 f8                	mov    %edi,%eax
+  8017be:	49 89 f2             	mov    %rsi,%r10
+  8017c1:	48 89 cf             	mov    %rcx,%rdi
+  8017c4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8017c7:	48 63 da             	movslq %edx,%rbx
+  8017ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d2:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d5:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8017d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017da:	48 85 c0             	test   %rax,%rax
+  8017dd:	7f 06                	jg     8017e5 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e5:	49 89 c0             	mov    %rax,%r8
+  8017e8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8017ed:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  8017f4:	00 00 00 
+  8017f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8017fc:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  801803:	00 00 00 
+  801806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180b:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801812:	00 00 00 
+  801815:	41 ff d1             	call   *%r9
+
+0000000000801818 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801818:	55                   	push   %rbp
+  801819:	48 89 e5             	mov    %rsp,%rbp
+  80181c:	53                   	push   %rbx
+  80181d:	48 83 ec 08          	sub    $0x8,%rsp
+  801821:	48 89 f1             	mov    %rsi,%rcx
+  801824:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801827:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80182a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801834:	be 00 00 00 00       	mov    $0x0,%esi
+  801839:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801841:	48 85 c0             	test   %rax,%rax
+  801844:	7f 06                	jg     80184c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801846:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184c:	49 89 c0             	mov    %rax,%r8
+  80184f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801854:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  80185b:	00 00 00 
+  80185e:	be 26 00 00 00       	mov    $0x26,%esi
+  801863:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  80186a:	00 00 00 
+  80186d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801872:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801879:	00 00 00 
+  80187c:	41 ff d1             	call   *%r9
+
+000000000080187f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80187f:	55                   	push   %rbp
+  801880:	48 89 e5             	mov    %rsp,%rbp
+  801883:	53                   	push   %rbx
+  801884:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801888:	48 63 ce             	movslq %esi,%rcx
+  80188b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80188e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801893:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801898:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189d:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018aa:	48 85 c0             	test   %rax,%rax
+  8018ad:	7f 06                	jg     8018b5 <sys_env_set_status+0x36>
+}
+  8018af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b3:	c9                   	leave
+  8018b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b5:	49 89 c0             	mov    %rax,%r8
+  8018b8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8018bd:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  8018c4:	00 00 00 
+  8018c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018cc:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  8018d3:	00 00 00 
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8018e2:	00 00 00 
+  8018e5:	41 ff d1             	call   *%r9
+
+00000000008018e8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018e8:	55                   	push   %rbp
+  8018e9:	48 89 e5             	mov    %rsp,%rbp
+  8018ec:	53                   	push   %rbx
+  8018ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801901:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801906:	be 00 00 00 00       	mov    $0x0,%esi
+  80190b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801911:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801913:	48 85 c0             	test   %rax,%rax
+  801916:	7f 06                	jg     80191e <sys_env_set_trapframe+0x36>
+}
+  801918:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191c:	c9                   	leave
+  80191d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80191e:	49 89 c0             	mov    %rax,%r8
+  801921:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801926:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  80192d:	00 00 00 
+  801930:	be 26 00 00 00       	mov    $0x26,%esi
+  801935:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  80193c:	00 00 00 
+  80193f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801944:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  80194b:	00 00 00 
+  80194e:	41 ff d1             	call   *%r9
+
+0000000000801951 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801951:	55                   	push   %rbp
+  801952:	48 89 e5             	mov    %rsp,%rbp
+  801955:	53                   	push   %rbx
+  801956:	48 83 ec 08          	sub    $0x8,%rsp
+  80195a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80195d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801960:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801965:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80196f:	be 00 00 00 00       	mov    $0x0,%esi
+  801974:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80197a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80197c:	48 85 c0             	test   %rax,%rax
+  80197f:	7f 06                	jg     801987 <sys_env_set_pgfault_upcall+0x36>
+}
+  801981:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801987:	49 89 c0             	mov    %rax,%r8
+  80198a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80198f:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  801996:	00 00 00 
+  801999:	be 26 00 00 00       	mov    $0x26,%esi
+  80199e:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  8019a5:	00 00 00 
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ad:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8019b4:	00 00 00 
+  8019b7:	41 ff d1             	call   *%r9
+
+00000000008019ba <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019ba:	55                   	push   %rbp
+  8019bb:	48 89 e5             	mov    %rsp,%rbp
+  8019be:	53                   	push   %rbx
+  8019bf:	89 f8                	mov    %edi,%eax
+  8019c1:	49 89 f1             	mov    %rsi,%r9
+  8019c4:	48 89 d3             	mov    %rdx,%rbx
+  8019c7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019ca:	49 63 f0             	movslq %r8d,%rsi
+  8019cd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019de:	cd 30                	int    $0x30
+}
+  8019e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+00000000008019e6 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8019e6:	55                   	push   %rbp
+  8019e7:	48 89 e5             	mov    %rsp,%rbp
+  8019ea:	53                   	push   %rbx
+  8019eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ef:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8019f2:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019fa:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a02:	be 00 00 00 00       	mov    $0x0,%esi
+  801a07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a0f:	48 85 c0             	test   %rax,%rax
+  801a12:	7f 06                	jg     801a1a <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a1a:	49 89 c0             	mov    %rax,%r8
+  801a1d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801a22:	48 ba 68 42 80 00 00 	movabs $0x804268,%rdx
+  801a29:	00 00 00 
+  801a2c:	be 26 00 00 00       	mov    $0x26,%esi
+  801a31:	48 bf 87 42 80 00 00 	movabs $0x804287,%rdi
+  801a38:	00 00 00 
+  801a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a40:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801a47:	00 00 00 
+  801a4a:	41 ff d1             	call   *%r9
+
+0000000000801a4d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801a51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a56:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  801a5d:	00 00 00 
+  801a60:	ff d0                	call   *%rax
+}
+  801a62:	5d                   	pop    %rbp
+  801a63:	c3                   	ret
+
+0000000000801a64 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a69:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a73:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a82:	be 00 00 00 00       	mov    $0x0,%esi
+  801a87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a8d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a93:	c9                   	leave
+  801a94:	c3                   	ret
+
+0000000000801a95 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801a95:	55                   	push   %rbp
+  801a96:	48 89 e5             	mov    %rsp,%rbp
+  801a99:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801a9a:	48 63 ce             	movslq %esi,%rcx
+  801a9d:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801aa1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ab0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801abb:	cd 30                	int    $0x30
+}
+  801abd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ac1:	c9                   	leave
+  801ac2:	c3                   	ret
+
+0000000000801ac3 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801ac3:	55                   	push   %rbp
+  801ac4:	48 89 e5             	mov    %rsp,%rbp
+  801ac7:	53                   	push   %rbx
+  801ac8:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801acb:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801acf:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ade:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae9:	cd 30                	int    $0x30
+}
+  801aeb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aef:	c9                   	leave
+  801af0:	c3                   	ret
+
+0000000000801af1 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801af1:	55                   	push   %rbp
+  801af2:	48 89 e5             	mov    %rsp,%rbp
+  801af5:	53                   	push   %rbx
+  801af6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801af9:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801afc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b01:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b04:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b09:	be 00 00 00 00       	mov    $0x0,%esi
+  801b0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b14:	cd 30                	int    $0x30
+}
+  801b16:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b1a:	c9                   	leave
+  801b1b:	c3                   	ret
+
+0000000000801b1c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b1c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b23:	ff ff ff 
+  801b26:	48 01 f8             	add    %rdi,%rax
+  801b29:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b2d:	c3                   	ret
+
+0000000000801b2e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b2e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b35:	ff ff ff 
+  801b38:	48 01 f8             	add    %rdi,%rax
+  801b3b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b3f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b45:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b49:	c3                   	ret
+
+0000000000801b4a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 57                	push   %r15
+  801b50:	41 56                	push   %r14
+  801b52:	41 55                	push   %r13
+  801b54:	41 54                	push   %r12
+  801b56:	53                   	push   %rbx
+  801b57:	48 83 ec 08          	sub    $0x8,%rsp
+  801b5b:	49 89 ff             	mov    %rdi,%r15
+  801b5e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b63:	49 bd 69 36 80 00 00 	movabs $0x803669,%r13
+  801b6a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b6d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b73:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b76:	48 89 df             	mov    %rbx,%rdi
+  801b79:	41 ff d5             	call   *%r13
+  801b7c:	83 e0 04             	and    $0x4,%eax
+  801b7f:	74 17                	je     801b98 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b81:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b88:	4c 39 f3             	cmp    %r14,%rbx
+  801b8b:	75 e6                	jne    801b73 <fd_alloc+0x29>
+  801b8d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b93:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b98:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b9b:	48 83 c4 08          	add    $0x8,%rsp
+  801b9f:	5b                   	pop    %rbx
+  801ba0:	41 5c                	pop    %r12
+  801ba2:	41 5d                	pop    %r13
+  801ba4:	41 5e                	pop    %r14
+  801ba6:	41 5f                	pop    %r15
+  801ba8:	5d                   	pop    %rbp
+  801ba9:	c3                   	ret
+
+0000000000801baa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801baa:	83 ff 1f             	cmp    $0x1f,%edi
+  801bad:	77 39                	ja     801be8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801baf:	55                   	push   %rbp
+  801bb0:	48 89 e5             	mov    %rsp,%rbp
+  801bb3:	41 54                	push   %r12
+  801bb5:	53                   	push   %rbx
+  801bb6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bb9:	48 63 df             	movslq %edi,%rbx
+  801bbc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bc3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bc7:	48 89 df             	mov    %rbx,%rdi
+  801bca:	48 b8 69 36 80 00 00 	movabs $0x803669,%rax
+  801bd1:	00 00 00 
+  801bd4:	ff d0                	call   *%rax
+  801bd6:	a8 04                	test   $0x4,%al
+  801bd8:	74 14                	je     801bee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bda:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be3:	5b                   	pop    %rbx
+  801be4:	41 5c                	pop    %r12
+  801be6:	5d                   	pop    %rbp
+  801be7:	c3                   	ret
+        return -E_INVAL;
+  801be8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bed:	c3                   	ret
+        return -E_INVAL;
+  801bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf3:	eb ee                	jmp    801be3 <fd_lookup+0x39>
+
+0000000000801bf5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801bf5:	55                   	push   %rbp
+  801bf6:	48 89 e5             	mov    %rsp,%rbp
+  801bf9:	41 54                	push   %r12
+  801bfb:	53                   	push   %rbx
+  801bfc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801bff:	48 b8 40 43 80 00 00 	movabs $0x804340,%rax
+  801c06:	00 00 00 
+  801c09:	48 bb e0 50 80 00 00 	movabs $0x8050e0,%rbx
+  801c10:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c13:	39 3b                	cmp    %edi,(%rbx)
+  801c15:	74 47                	je     801c5e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c17:	48 83 c0 08          	add    $0x8,%rax
+  801c1b:	48 8b 18             	mov    (%rax),%rbx
+  801c1e:	48 85 db             	test   %rbx,%rbx
+  801c21:	75 f0                	jne    801c13 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c23:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c2a:	00 00 00 
+  801c2d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c33:	89 fa                	mov    %edi,%edx
+  801c35:	48 bf 98 42 80 00 00 	movabs $0x804298,%rdi
+  801c3c:	00 00 00 
+  801c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c44:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  801c4b:	00 00 00 
+  801c4e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c55:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c59:	5b                   	pop    %rbx
+  801c5a:	41 5c                	pop    %r12
+  801c5c:	5d                   	pop    %rbp
+  801c5d:	c3                   	ret
+            return 0;
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c63:	eb f0                	jmp    801c55 <dev_lookup+0x60>
+
+0000000000801c65 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c65:	55                   	push   %rbp
+  801c66:	48 89 e5             	mov    %rsp,%rbp
+  801c69:	41 55                	push   %r13
+  801c6b:	41 54                	push   %r12
+  801c6d:	53                   	push   %rbx
+  801c6e:	48 83 ec 18          	sub    $0x18,%rsp
+  801c72:	48 89 fb             	mov    %rdi,%rbx
+  801c75:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c78:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c7f:	ff ff ff 
+  801c82:	48 01 df             	add    %rbx,%rdi
+  801c85:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c8d:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  801c94:	00 00 00 
+  801c97:	ff d0                	call   *%rax
+  801c99:	41 89 c5             	mov    %eax,%r13d
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 06                	js     801ca6 <fd_close+0x41>
+  801ca0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ca4:	74 1a                	je     801cc0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ca6:	45 84 e4             	test   %r12b,%r12b
+  801ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cb2:	44 89 e8             	mov    %r13d,%eax
+  801cb5:	48 83 c4 18          	add    $0x18,%rsp
+  801cb9:	5b                   	pop    %rbx
+  801cba:	41 5c                	pop    %r12
+  801cbc:	41 5d                	pop    %r13
+  801cbe:	5d                   	pop    %rbp
+  801cbf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cc0:	8b 3b                	mov    (%rbx),%edi
+  801cc2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cc6:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	41 89 c5             	mov    %eax,%r13d
+  801cd5:	85 c0                	test   %eax,%eax
+  801cd7:	78 1b                	js     801cf4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdd:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ce1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ce7:	48 85 c0             	test   %rax,%rax
+  801cea:	74 08                	je     801cf4 <fd_close+0x8f>
+  801cec:	48 89 df             	mov    %rbx,%rdi
+  801cef:	ff d0                	call   *%rax
+  801cf1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cf4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf9:	48 89 de             	mov    %rbx,%rsi
+  801cfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d01:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+    return res;
+  801d0d:	eb a3                	jmp    801cb2 <fd_close+0x4d>
+
+0000000000801d0f <close>:
+
+int
+close(int fdnum) {
+  801d0f:	55                   	push   %rbp
+  801d10:	48 89 e5             	mov    %rsp,%rbp
+  801d13:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d1b:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	78 15                	js     801d40 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d2b:	be 01 00 00 00       	mov    $0x1,%esi
+  801d30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d34:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+}
+  801d40:	c9                   	leave
+  801d41:	c3                   	ret
+
+0000000000801d42 <close_all>:
+
+void
+close_all(void) {
+  801d42:	55                   	push   %rbp
+  801d43:	48 89 e5             	mov    %rsp,%rbp
+  801d46:	41 54                	push   %r12
+  801d48:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4e:	49 bc 0f 1d 80 00 00 	movabs $0x801d0f,%r12
+  801d55:	00 00 00 
+  801d58:	89 df                	mov    %ebx,%edi
+  801d5a:	41 ff d4             	call   *%r12
+  801d5d:	83 c3 01             	add    $0x1,%ebx
+  801d60:	83 fb 20             	cmp    $0x20,%ebx
+  801d63:	75 f3                	jne    801d58 <close_all+0x16>
+}
+  801d65:	5b                   	pop    %rbx
+  801d66:	41 5c                	pop    %r12
+  801d68:	5d                   	pop    %rbp
+  801d69:	c3                   	ret
+
+0000000000801d6a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d6a:	55                   	push   %rbp
+  801d6b:	48 89 e5             	mov    %rsp,%rbp
+  801d6e:	41 57                	push   %r15
+  801d70:	41 56                	push   %r14
+  801d72:	41 55                	push   %r13
+  801d74:	41 54                	push   %r12
+  801d76:	53                   	push   %rbx
+  801d77:	48 83 ec 18          	sub    $0x18,%rsp
+  801d7b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d7e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d82:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  801d89:	00 00 00 
+  801d8c:	ff d0                	call   *%rax
+  801d8e:	89 c3                	mov    %eax,%ebx
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	0f 88 b8 00 00 00    	js     801e50 <dup+0xe6>
+    close(newfdnum);
+  801d98:	44 89 e7             	mov    %r12d,%edi
+  801d9b:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801da7:	4d 63 ec             	movslq %r12d,%r13
+  801daa:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801db1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801db5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801db9:	4c 89 ff             	mov    %r15,%rdi
+  801dbc:	49 be 2e 1b 80 00 00 	movabs $0x801b2e,%r14
+  801dc3:	00 00 00 
+  801dc6:	41 ff d6             	call   *%r14
+  801dc9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801dcc:	4c 89 ef             	mov    %r13,%rdi
+  801dcf:	41 ff d6             	call   *%r14
+  801dd2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801dd5:	48 89 df             	mov    %rbx,%rdi
+  801dd8:	48 b8 69 36 80 00 00 	movabs $0x803669,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801de4:	a8 04                	test   $0x4,%al
+  801de6:	74 2b                	je     801e13 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801de8:	41 89 c1             	mov    %eax,%r9d
+  801deb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801df1:	4c 89 f1             	mov    %r14,%rcx
+  801df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df9:	48 89 de             	mov    %rbx,%rsi
+  801dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e01:	48 b8 b3 17 80 00 00 	movabs $0x8017b3,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	89 c3                	mov    %eax,%ebx
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 4e                	js     801e61 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e13:	4c 89 ff             	mov    %r15,%rdi
+  801e16:	48 b8 69 36 80 00 00 	movabs $0x803669,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e2b:	4c 89 e9             	mov    %r13,%rcx
+  801e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e33:	4c 89 fe             	mov    %r15,%rsi
+  801e36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3b:	48 b8 b3 17 80 00 00 	movabs $0x8017b3,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+  801e47:	89 c3                	mov    %eax,%ebx
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 14                	js     801e61 <dup+0xf7>
+
+    return newfdnum;
+  801e4d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e50:	89 d8                	mov    %ebx,%eax
+  801e52:	48 83 c4 18          	add    $0x18,%rsp
+  801e56:	5b                   	pop    %rbx
+  801e57:	41 5c                	pop    %r12
+  801e59:	41 5d                	pop    %r13
+  801e5b:	41 5e                	pop    %r14
+  801e5d:	41 5f                	pop    %r15
+  801e5f:	5d                   	pop    %rbp
+  801e60:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e66:	4c 89 ee             	mov    %r13,%rsi
+  801e69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e6e:	49 bc 18 18 80 00 00 	movabs $0x801818,%r12
+  801e75:	00 00 00 
+  801e78:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e80:	4c 89 f6             	mov    %r14,%rsi
+  801e83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e88:	41 ff d4             	call   *%r12
+    return res;
+  801e8b:	eb c3                	jmp    801e50 <dup+0xe6>
+
+0000000000801e8d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e8d:	55                   	push   %rbp
+  801e8e:	48 89 e5             	mov    %rsp,%rbp
+  801e91:	41 56                	push   %r14
+  801e93:	41 55                	push   %r13
+  801e95:	41 54                	push   %r12
+  801e97:	53                   	push   %rbx
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	89 fb                	mov    %edi,%ebx
+  801e9e:	49 89 f4             	mov    %rsi,%r12
+  801ea1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ea8:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  801eaf:	00 00 00 
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 4c                	js     801f04 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ebc:	41 8b 3e             	mov    (%r14),%edi
+  801ebf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec3:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 35                	js     801f08 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ed3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ed7:	83 e0 03             	and    $0x3,%eax
+  801eda:	83 f8 01             	cmp    $0x1,%eax
+  801edd:	74 2d                	je     801f0c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801edf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ee7:	48 85 c0             	test   %rax,%rax
+  801eea:	74 56                	je     801f42 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801eec:	4c 89 ea             	mov    %r13,%rdx
+  801eef:	4c 89 e6             	mov    %r12,%rsi
+  801ef2:	4c 89 f7             	mov    %r14,%rdi
+  801ef5:	ff d0                	call   *%rax
+}
+  801ef7:	48 83 c4 10          	add    $0x10,%rsp
+  801efb:	5b                   	pop    %rbx
+  801efc:	41 5c                	pop    %r12
+  801efe:	41 5d                	pop    %r13
+  801f00:	41 5e                	pop    %r14
+  801f02:	5d                   	pop    %rbp
+  801f03:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f04:	48 98                	cltq
+  801f06:	eb ef                	jmp    801ef7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f08:	48 98                	cltq
+  801f0a:	eb eb                	jmp    801ef7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f0c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f13:	00 00 00 
+  801f16:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f1c:	89 da                	mov    %ebx,%edx
+  801f1e:	48 bf f9 42 80 00 00 	movabs $0x8042f9,%rdi
+  801f25:	00 00 00 
+  801f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2d:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  801f34:	00 00 00 
+  801f37:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f39:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f40:	eb b5                	jmp    801ef7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f42:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f49:	eb ac                	jmp    801ef7 <read+0x6a>
+
+0000000000801f4b <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801f4b:	55                   	push   %rbp
+  801f4c:	48 89 e5             	mov    %rsp,%rbp
+  801f4f:	41 56                	push   %r14
+  801f51:	41 55                	push   %r13
+  801f53:	41 54                	push   %r12
+  801f55:	53                   	push   %rbx
+  801f56:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5a:	89 fb                	mov    %edi,%ebx
+  801f5c:	49 89 f4             	mov    %rsi,%r12
+  801f5f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f62:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f66:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  801f6d:	00 00 00 
+  801f70:	ff d0                	call   *%rax
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 41                	js     801fb7 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f76:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f7a:	41 8b 3e             	mov    (%r14),%edi
+  801f7d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f81:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 35                	js     801fc6 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f91:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f95:	83 e0 03             	and    $0x3,%eax
+  801f98:	83 f8 01             	cmp    $0x1,%eax
+  801f9b:	74 2d                	je     801fca <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801f9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fa1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fa5:	48 85 c0             	test   %rax,%rax
+  801fa8:	74 56                	je     802000 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801faa:	4c 89 ea             	mov    %r13,%rdx
+  801fad:	4c 89 e6             	mov    %r12,%rsi
+  801fb0:	4c 89 f7             	mov    %r14,%rdi
+  801fb3:	ff d0                	call   *%rax
+  801fb5:	eb 02                	jmp    801fb9 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb7:	48 98                	cltq
+}
+  801fb9:	48 83 c4 10          	add    $0x10,%rsp
+  801fbd:	5b                   	pop    %rbx
+  801fbe:	41 5c                	pop    %r12
+  801fc0:	41 5d                	pop    %r13
+  801fc2:	41 5e                	pop    %r14
+  801fc4:	5d                   	pop    %rbp
+  801fc5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc6:	48 98                	cltq
+  801fc8:	eb ef                	jmp    801fb9 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fca:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801fd1:	00 00 00 
+  801fd4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fda:	89 da                	mov    %ebx,%edx
+  801fdc:	48 bf b8 42 80 00 00 	movabs $0x8042b8,%rdi
+  801fe3:	00 00 00 
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  801ff2:	00 00 00 
+  801ff5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ff7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ffe:	eb b9                	jmp    801fb9 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802000:	4c 89 ea             	mov    %r13,%rdx
+  802003:	4c 89 e6             	mov    %r12,%rsi
+  802006:	89 df                	mov    %ebx,%edi
+  802008:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+  802014:	eb a3                	jmp    801fb9 <readmap+0x6e>
+
+0000000000802016 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802016:	55                   	push   %rbp
+  802017:	48 89 e5             	mov    %rsp,%rbp
+  80201a:	41 57                	push   %r15
+  80201c:	41 56                	push   %r14
+  80201e:	41 55                	push   %r13
+  802020:	41 54                	push   %r12
+  802022:	53                   	push   %rbx
+  802023:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802027:	48 85 d2             	test   %rdx,%rdx
+  80202a:	74 54                	je     802080 <readn+0x6a>
+  80202c:	41 89 fd             	mov    %edi,%r13d
+  80202f:	49 89 f6             	mov    %rsi,%r14
+  802032:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802035:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80203a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80203f:	49 bf 8d 1e 80 00 00 	movabs $0x801e8d,%r15
+  802046:	00 00 00 
+  802049:	4c 89 e2             	mov    %r12,%rdx
+  80204c:	48 29 f2             	sub    %rsi,%rdx
+  80204f:	4c 01 f6             	add    %r14,%rsi
+  802052:	44 89 ef             	mov    %r13d,%edi
+  802055:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 20                	js     80207c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80205c:	01 c3                	add    %eax,%ebx
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	74 08                	je     80206a <readn+0x54>
+  802062:	48 63 f3             	movslq %ebx,%rsi
+  802065:	4c 39 e6             	cmp    %r12,%rsi
+  802068:	72 df                	jb     802049 <readn+0x33>
+    }
+    return res;
+  80206a:	48 63 c3             	movslq %ebx,%rax
+}
+  80206d:	48 83 c4 08          	add    $0x8,%rsp
+  802071:	5b                   	pop    %rbx
+  802072:	41 5c                	pop    %r12
+  802074:	41 5d                	pop    %r13
+  802076:	41 5e                	pop    %r14
+  802078:	41 5f                	pop    %r15
+  80207a:	5d                   	pop    %rbp
+  80207b:	c3                   	ret
+        if (inc < 0) return inc;
+  80207c:	48 98                	cltq
+  80207e:	eb ed                	jmp    80206d <readn+0x57>
+    int inc = 1, res = 0;
+  802080:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802085:	eb e3                	jmp    80206a <readn+0x54>
+
+0000000000802087 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802087:	55                   	push   %rbp
+  802088:	48 89 e5             	mov    %rsp,%rbp
+  80208b:	41 56                	push   %r14
+  80208d:	41 55                	push   %r13
+  80208f:	41 54                	push   %r12
+  802091:	53                   	push   %rbx
+  802092:	48 83 ec 10          	sub    $0x10,%rsp
+  802096:	89 fb                	mov    %edi,%ebx
+  802098:	49 89 f4             	mov    %rsi,%r12
+  80209b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80209e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020a2:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	85 c0                	test   %eax,%eax
+  8020b0:	78 47                	js     8020f9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020b6:	41 8b 3e             	mov    (%r14),%edi
+  8020b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020bd:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	78 30                	js     8020fd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020cd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020d2:	74 2d                	je     802101 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020d8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020dc:	48 85 c0             	test   %rax,%rax
+  8020df:	74 56                	je     802137 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020e1:	4c 89 ea             	mov    %r13,%rdx
+  8020e4:	4c 89 e6             	mov    %r12,%rsi
+  8020e7:	4c 89 f7             	mov    %r14,%rdi
+  8020ea:	ff d0                	call   *%rax
+}
+  8020ec:	48 83 c4 10          	add    $0x10,%rsp
+  8020f0:	5b                   	pop    %rbx
+  8020f1:	41 5c                	pop    %r12
+  8020f3:	41 5d                	pop    %r13
+  8020f5:	41 5e                	pop    %r14
+  8020f7:	5d                   	pop    %rbp
+  8020f8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f9:	48 98                	cltq
+  8020fb:	eb ef                	jmp    8020ec <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020fd:	48 98                	cltq
+  8020ff:	eb eb                	jmp    8020ec <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802101:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802108:	00 00 00 
+  80210b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802111:	89 da                	mov    %ebx,%edx
+  802113:	48 bf 15 43 80 00 00 	movabs $0x804315,%rdi
+  80211a:	00 00 00 
+  80211d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802122:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802129:	00 00 00 
+  80212c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80212e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802135:	eb b5                	jmp    8020ec <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802137:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80213e:	eb ac                	jmp    8020ec <write+0x65>
+
+0000000000802140 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802140:	55                   	push   %rbp
+  802141:	48 89 e5             	mov    %rsp,%rbp
+  802144:	53                   	push   %rbx
+  802145:	48 83 ec 18          	sub    $0x18,%rsp
+  802149:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80214b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80214f:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  802156:	00 00 00 
+  802159:	ff d0                	call   *%rax
+  80215b:	85 c0                	test   %eax,%eax
+  80215d:	78 0c                	js     80216b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80215f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802163:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802166:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80216b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+0000000000802171 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	41 55                	push   %r13
+  802177:	41 54                	push   %r12
+  802179:	53                   	push   %rbx
+  80217a:	48 83 ec 18          	sub    $0x18,%rsp
+  80217e:	89 fb                	mov    %edi,%ebx
+  802180:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802183:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802187:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 38                	js     8021cf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802197:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80219b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80219f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021a3:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 1c                	js     8021cf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021b3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021b8:	74 20                	je     8021da <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021be:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8021c2:	48 85 c0             	test   %rax,%rax
+  8021c5:	74 47                	je     80220e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021c7:	44 89 e6             	mov    %r12d,%esi
+  8021ca:	4c 89 ef             	mov    %r13,%rdi
+  8021cd:	ff d0                	call   *%rax
+}
+  8021cf:	48 83 c4 18          	add    $0x18,%rsp
+  8021d3:	5b                   	pop    %rbx
+  8021d4:	41 5c                	pop    %r12
+  8021d6:	41 5d                	pop    %r13
+  8021d8:	5d                   	pop    %rbp
+  8021d9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021da:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8021e1:	00 00 00 
+  8021e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021ea:	89 da                	mov    %ebx,%edx
+  8021ec:	48 bf d8 42 80 00 00 	movabs $0x8042d8,%rdi
+  8021f3:	00 00 00 
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fb:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802202:	00 00 00 
+  802205:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802207:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80220c:	eb c1                	jmp    8021cf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80220e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802213:	eb ba                	jmp    8021cf <ftruncate+0x5e>
+
+0000000000802215 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802215:	55                   	push   %rbp
+  802216:	48 89 e5             	mov    %rsp,%rbp
+  802219:	41 54                	push   %r12
+  80221b:	53                   	push   %rbx
+  80221c:	48 83 ec 10          	sub    $0x10,%rsp
+  802220:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802223:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802227:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 4e                	js     802285 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802237:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80223b:	41 8b 3c 24          	mov    (%r12),%edi
+  80223f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802243:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	78 32                	js     802285 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802253:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802257:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  80225c:	74 30                	je     80228e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80225e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802261:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802268:	00 00 00 
+    stat->st_isdir = 0;
+  80226b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802272:	00 00 00 
+    stat->st_dev = dev;
+  802275:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80227c:	48 89 de             	mov    %rbx,%rsi
+  80227f:	4c 89 e7             	mov    %r12,%rdi
+  802282:	ff 50 30             	call   *0x30(%rax)
+}
+  802285:	48 83 c4 10          	add    $0x10,%rsp
+  802289:	5b                   	pop    %rbx
+  80228a:	41 5c                	pop    %r12
+  80228c:	5d                   	pop    %rbp
+  80228d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80228e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802293:	eb f0                	jmp    802285 <fstat+0x70>
+
+0000000000802295 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802295:	55                   	push   %rbp
+  802296:	48 89 e5             	mov    %rsp,%rbp
+  802299:	41 54                	push   %r12
+  80229b:	53                   	push   %rbx
+  80229c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80229f:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a4:	48 b8 ec 2f 80 00 00 	movabs $0x802fec,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 25                	js     8022db <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022b6:	4c 89 e6             	mov    %r12,%rsi
+  8022b9:	89 c7                	mov    %eax,%edi
+  8022bb:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+  8022c7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022ca:	89 df                	mov    %ebx,%edi
+  8022cc:	48 b8 0f 1d 80 00 00 	movabs $0x801d0f,%rax
+  8022d3:	00 00 00 
+  8022d6:	ff d0                	call   *%rax
+
+    return res;
+  8022d8:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022db:	89 d8                	mov    %ebx,%eax
+  8022dd:	5b                   	pop    %rbx
+  8022de:	41 5c                	pop    %r12
+  8022e0:	5d                   	pop    %rbp
+  8022e1:	c3                   	ret
+
+00000000008022e2 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8022e2:	55                   	push   %rbp
+  8022e3:	48 89 e5             	mov    %rsp,%rbp
+  8022e6:	41 54                	push   %r12
+  8022e8:	53                   	push   %rbx
+  8022e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ed:	48 89 fb             	mov    %rdi,%rbx
+  8022f0:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022f7:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022fc:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 1f                	js     80232b <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  80230c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802310:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802314:	48 85 c0             	test   %rax,%rax
+  802317:	74 1b                	je     802334 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802319:	4c 89 e6             	mov    %r12,%rsi
+  80231c:	48 89 df             	mov    %rbx,%rdi
+  80231f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802321:	85 c0                	test   %eax,%eax
+  802323:	ba 00 00 00 00       	mov    $0x0,%edx
+  802328:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80232b:	48 83 c4 10          	add    $0x10,%rsp
+  80232f:	5b                   	pop    %rbx
+  802330:	41 5c                	pop    %r12
+  802332:	5d                   	pop    %rbp
+  802333:	c3                   	ret
+        return -E_NOT_SUPP;
+  802334:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802339:	eb f0                	jmp    80232b <create_snapshot+0x49>
+
+000000000080233b <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  80233f:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802343:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802347:	bf 66 00 00 00       	mov    $0x66,%edi
+  80234c:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802353:	00 00 00 
+  802356:	ff d0                	call   *%rax
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	78 1e                	js     80237a <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  80235c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802360:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  802364:	48 85 d2             	test   %rdx,%rdx
+  802367:	74 13                	je     80237c <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236e:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802370:	85 c0                	test   %eax,%eax
+  802372:	ba 00 00 00 00       	mov    $0x0,%edx
+  802377:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  80237a:	c9                   	leave
+  80237b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80237c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802381:	eb f7                	jmp    80237a <print_snapshot_list+0x3f>
+
+0000000000802383 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	53                   	push   %rbx
+  802388:	48 83 ec 18          	sub    $0x18,%rsp
+  80238c:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80238f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802393:	bf 66 00 00 00       	mov    $0x66,%edi
+  802398:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	78 1c                	js     8023c4 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  8023a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ac:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8023b0:	48 85 c0             	test   %rax,%rax
+  8023b3:	74 15                	je     8023ca <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  8023b5:	48 89 df             	mov    %rbx,%rdi
+  8023b8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c1:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8023c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023c8:	c9                   	leave
+  8023c9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8023ca:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023cf:	eb f3                	jmp    8023c4 <accept_snapshot+0x41>
+
+00000000008023d1 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8023d1:	55                   	push   %rbp
+  8023d2:	48 89 e5             	mov    %rsp,%rbp
+  8023d5:	53                   	push   %rbx
+  8023d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8023da:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8023dd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023e1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8023e6:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8023ed:	00 00 00 
+  8023f0:	ff d0                	call   *%rax
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 1c                	js     802412 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8023f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023fa:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8023fe:	48 85 c0             	test   %rax,%rax
+  802401:	74 15                	je     802418 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802403:	48 89 df             	mov    %rbx,%rdi
+  802406:	ff d0                	call   *%rax
+    if (res < 0) {
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802412:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802416:	c9                   	leave
+  802417:	c3                   	ret
+        return -E_NOT_SUPP;
+  802418:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80241d:	eb f3                	jmp    802412 <delete_snapshot+0x41>
+
+000000000080241f <gc_snapshots>:
+
+int
+gc_snapshots() {
+  80241f:	55                   	push   %rbp
+  802420:	48 89 e5             	mov    %rsp,%rbp
+  802423:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802427:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80242b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802430:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	78 14                	js     802454 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802440:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802444:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802448:	48 85 d2             	test   %rdx,%rdx
+  80244b:	74 09                	je     802456 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	ff d2                	call   *%rdx
+
+    return res;
+}
+  802454:	c9                   	leave
+  802455:	c3                   	ret
+        return -E_NOT_SUPP;
+  802456:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80245b:	eb f7                	jmp    802454 <gc_snapshots+0x35>
+
+000000000080245d <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80245d:	55                   	push   %rbp
+  80245e:	48 89 e5             	mov    %rsp,%rbp
+  802461:	41 56                	push   %r14
+  802463:	41 55                	push   %r13
+  802465:	41 54                	push   %r12
+  802467:	53                   	push   %rbx
+  802468:	48 83 ec 10          	sub    $0x10,%rsp
+  80246c:	48 89 fb             	mov    %rdi,%rbx
+  80246f:	49 89 f4             	mov    %rsi,%r12
+  802472:	49 89 d5             	mov    %rdx,%r13
+  802475:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802478:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80247c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802481:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802488:	00 00 00 
+  80248b:	ff d0                	call   *%rax
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	78 1b                	js     8024ac <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802491:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802495:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802499:	48 85 c0             	test   %rax,%rax
+  80249c:	74 1b                	je     8024b9 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  80249e:	4c 89 f1             	mov    %r14,%rcx
+  8024a1:	4c 89 ea             	mov    %r13,%rdx
+  8024a4:	4c 89 e6             	mov    %r12,%rsi
+  8024a7:	48 89 df             	mov    %rbx,%rdi
+  8024aa:	ff d0                	call   *%rax
+
+    return res;
+}
+  8024ac:	48 83 c4 10          	add    $0x10,%rsp
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	41 5d                	pop    %r13
+  8024b5:	41 5e                	pop    %r14
+  8024b7:	5d                   	pop    %rbp
+  8024b8:	c3                   	ret
+        return -E_NOT_SUPP;
+  8024b9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024be:	eb ec                	jmp    8024ac <diff_snapshots+0x4f>
+
+00000000008024c0 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8024c0:	55                   	push   %rbp
+  8024c1:	48 89 e5             	mov    %rsp,%rbp
+  8024c4:	41 55                	push   %r13
+  8024c6:	41 54                	push   %r12
+  8024c8:	53                   	push   %rbx
+  8024c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8024cd:	48 89 fb             	mov    %rdi,%rbx
+  8024d0:	49 89 f4             	mov    %rsi,%r12
+  8024d3:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8024d6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024da:	bf 66 00 00 00       	mov    $0x66,%edi
+  8024df:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	78 18                	js     802507 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8024ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024f3:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8024f7:	48 85 c0             	test   %rax,%rax
+  8024fa:	74 16                	je     802512 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8024fc:	4c 89 ea             	mov    %r13,%rdx
+  8024ff:	4c 89 e6             	mov    %r12,%rsi
+  802502:	48 89 df             	mov    %rbx,%rdi
+  802505:	ff d0                	call   *%rax
+
+    return res;
+}
+  802507:	48 83 c4 18          	add    $0x18,%rsp
+  80250b:	5b                   	pop    %rbx
+  80250c:	41 5c                	pop    %r12
+  80250e:	41 5d                	pop    %r13
+  802510:	5d                   	pop    %rbp
+  802511:	c3                   	ret
+        return -E_NOT_SUPP;
+  802512:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802517:	eb ee                	jmp    802507 <send_snapshot+0x47>
+
+0000000000802519 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	53                   	push   %rbx
+  80251e:	48 83 ec 18          	sub    $0x18,%rsp
+  802522:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802525:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802529:	bf 66 00 00 00       	mov    $0x66,%edi
+  80252e:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+  80253a:	85 c0                	test   %eax,%eax
+  80253c:	78 12                	js     802550 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80253e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802542:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802546:	48 85 c0             	test   %rax,%rax
+  802549:	74 0b                	je     802556 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  80254b:	48 89 df             	mov    %rbx,%rdi
+  80254e:	ff d0                	call   *%rax
+
+    return res;
+}
+  802550:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+        return -E_NOT_SUPP;
+  802556:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80255b:	eb f3                	jmp    802550 <receive_snapshot+0x37>
+
+000000000080255d <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  80255d:	55                   	push   %rbp
+  80255e:	48 89 e5             	mov    %rsp,%rbp
+  802561:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802565:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802569:	bf 66 00 00 00       	mov    $0x66,%edi
+  80256e:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	78 17                	js     802595 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80257e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802582:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802589:	48 85 d2             	test   %rdx,%rdx
+  80258c:	74 09                	je     802597 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80258e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802593:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802595:	c9                   	leave
+  802596:	c3                   	ret
+        return -E_NOT_SUPP;
+  802597:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80259c:	eb f7                	jmp    802595 <free_space_bytes+0x38>
+
+000000000080259e <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025a6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025aa:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025af:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	78 17                	js     8025d6 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8025bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c3:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8025ca:	48 85 d2             	test   %rdx,%rdx
+  8025cd:	74 09                	je     8025d8 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8025cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d4:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8025d6:	c9                   	leave
+  8025d7:	c3                   	ret
+        return -E_NOT_SUPP;
+  8025d8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025dd:	eb f7                	jmp    8025d6 <busy_space_bytes+0x38>
+
+00000000008025df <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	41 54                	push   %r12
+  8025e5:	53                   	push   %rbx
+  8025e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ea:	89 fb                	mov    %edi,%ebx
+  8025ec:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025ef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025f3:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025f8:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	85 c0                	test   %eax,%eax
+  802606:	78 17                	js     80261f <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  802608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260c:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802613:	48 85 c0             	test   %rax,%rax
+  802616:	74 10                	je     802628 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802618:	4c 89 e6             	mov    %r12,%rsi
+  80261b:	89 df                	mov    %ebx,%edi
+  80261d:	ff d0                	call   *%rax
+    
+    return res;
+}
+  80261f:	48 83 c4 10          	add    $0x10,%rsp
+  802623:	5b                   	pop    %rbx
+  802624:	41 5c                	pop    %r12
+  802626:	5d                   	pop    %rbp
+  802627:	c3                   	ret
+        return -E_NOT_SUPP;
+  802628:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80262d:	eb f0                	jmp    80261f <snapshots_space+0x40>
+
+000000000080262f <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  80262f:	55                   	push   %rbp
+  802630:	48 89 e5             	mov    %rsp,%rbp
+  802633:	41 55                	push   %r13
+  802635:	41 54                	push   %r12
+  802637:	53                   	push   %rbx
+  802638:	48 83 ec 08          	sub    $0x8,%rsp
+  80263c:	41 89 fd             	mov    %edi,%r13d
+  80263f:	48 89 f3             	mov    %rsi,%rbx
+  802642:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802645:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80264c:	00 00 00 
+  80264f:	83 38 00             	cmpl   $0x0,(%rax)
+  802652:	74 57                	je     8026ab <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802654:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80265a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80265f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802666:	00 00 00 
+  802669:	44 89 ee             	mov    %r13d,%esi
+  80266c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802673:	00 00 00 
+  802676:	8b 38                	mov    (%rax),%edi
+  802678:	48 b8 ac 3a 80 00 00 	movabs $0x803aac,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802684:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802689:	4c 89 e2             	mov    %r12,%rdx
+  80268c:	48 89 de             	mov    %rbx,%rsi
+  80268f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802694:	48 b8 94 3a 80 00 00 	movabs $0x803a94,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+}
+  8026a0:	48 83 c4 08          	add    $0x8,%rsp
+  8026a4:	5b                   	pop    %rbx
+  8026a5:	41 5c                	pop    %r12
+  8026a7:	41 5d                	pop    %r13
+  8026a9:	5d                   	pop    %rbp
+  8026aa:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ab:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026b0:	48 b8 6a 3b 80 00 00 	movabs $0x803b6a,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8026c3:	00 00 
+  8026c5:	eb 8d                	jmp    802654 <fsipc_region+0x25>
+
+00000000008026c7 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8026c7:	55                   	push   %rbp
+  8026c8:	48 89 e5             	mov    %rsp,%rbp
+  8026cb:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8026cf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8026d6:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8026d7:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8026db:	48 b8 2f 26 80 00 00 	movabs $0x80262f,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+}
+  8026e7:	c9                   	leave
+  8026e8:	c3                   	ret
+
+00000000008026e9 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8026e9:	85 ff                	test   %edi,%edi
+  8026eb:	78 6d                	js     80275a <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8026ed:	55                   	push   %rbp
+  8026ee:	48 89 e5             	mov    %rsp,%rbp
+  8026f1:	41 54                	push   %r12
+  8026f3:	53                   	push   %rbx
+  8026f4:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8026f7:	48 85 f6             	test   %rsi,%rsi
+  8026fa:	74 57                	je     802753 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8026fc:	89 f8                	mov    %edi,%eax
+  8026fe:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802705:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  802707:	be 00 00 00 00       	mov    $0x0,%esi
+  80270c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802711:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802718:	00 00 00 
+  80271b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	78 2d                	js     80274e <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802721:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802728:	00 00 00 
+  80272b:	49 63 14 24          	movslq (%r12),%rdx
+  80272f:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802736:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80273b:	48 89 df             	mov    %rbx,%rdi
+  80273e:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  80274a:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80274e:	5b                   	pop    %rbx
+  80274f:	41 5c                	pop    %r12
+  802751:	5d                   	pop    %rbp
+  802752:	c3                   	ret
+        return -E_INVAL;
+  802753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802758:	eb f4                	jmp    80274e <devfile_df_snapshots+0x65>
+  80275a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80275f:	c3                   	ret
+
+0000000000802760 <devfile_df_busy>:
+devfile_df_busy() {
+  802760:	55                   	push   %rbp
+  802761:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802764:	be 00 00 00 00       	mov    $0x0,%esi
+  802769:	bf 11 00 00 00       	mov    $0x11,%edi
+  80276e:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+}
+  80277a:	5d                   	pop    %rbp
+  80277b:	c3                   	ret
+
+000000000080277c <devfile_df_free>:
+devfile_df_free() {
+  80277c:	55                   	push   %rbp
+  80277d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802780:	be 00 00 00 00       	mov    $0x0,%esi
+  802785:	bf 10 00 00 00       	mov    $0x10,%edi
+  80278a:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+}
+  802796:	5d                   	pop    %rbp
+  802797:	c3                   	ret
+
+0000000000802798 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802798:	55                   	push   %rbp
+  802799:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  80279c:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027a6:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  8027ad:	00 00 00 
+  8027b0:	ff d0                	call   *%rax
+}
+  8027b2:	5d                   	pop    %rbp
+  8027b3:	c3                   	ret
+
+00000000008027b4 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  8027b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bd:	bf 09 00 00 00       	mov    $0x9,%edi
+  8027c2:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  8027c9:	00 00 00 
+  8027cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027ce:	85 c0                	test   %eax,%eax
+  8027d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027d8:	5d                   	pop    %rbp
+  8027d9:	c3                   	ret
+
+00000000008027da <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8027da:	55                   	push   %rbp
+  8027db:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8027de:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8027e5:	00 00 00 
+  8027e8:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8027eb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8027ed:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8027f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027fa:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802801:	00 00 00 
+  802804:	ff d0                	call   *%rax
+}
+  802806:	5d                   	pop    %rbp
+  802807:	c3                   	ret
+
+0000000000802808 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802808:	55                   	push   %rbp
+  802809:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80280c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80280f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802816:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802818:	be 00 00 00 00       	mov    $0x0,%esi
+  80281d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802822:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802829:	00 00 00 
+  80282c:	ff d0                	call   *%rax
+}
+  80282e:	5d                   	pop    %rbp
+  80282f:	c3                   	ret
+
+0000000000802830 <devfile_write>:
+    if (!fd || !buf) {
+  802830:	48 85 ff             	test   %rdi,%rdi
+  802833:	0f 84 c1 00 00 00    	je     8028fa <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802839:	55                   	push   %rbp
+  80283a:	48 89 e5             	mov    %rsp,%rbp
+  80283d:	41 57                	push   %r15
+  80283f:	41 56                	push   %r14
+  802841:	41 55                	push   %r13
+  802843:	41 54                	push   %r12
+  802845:	53                   	push   %rbx
+  802846:	48 83 ec 18          	sub    $0x18,%rsp
+  80284a:	49 89 ff             	mov    %rdi,%r15
+  80284d:	49 89 f5             	mov    %rsi,%r13
+  802850:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802853:	48 85 f6             	test   %rsi,%rsi
+  802856:	0f 84 95 00 00 00    	je     8028f1 <devfile_write+0xc1>
+    while (n) {
+  80285c:	48 85 d2             	test   %rdx,%rdx
+  80285f:	0f 84 83 00 00 00    	je     8028e8 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802865:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80286c:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802873:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802876:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80287b:	49 39 dc             	cmp    %rbx,%r12
+  80287e:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802882:	48 89 da             	mov    %rbx,%rdx
+  802885:	4c 89 ee             	mov    %r13,%rsi
+  802888:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80288f:	00 00 00 
+  802892:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80289e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028a2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  8028a5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  8028a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ae:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028b3:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+        if (write < 0) {
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	78 21                	js     8028e4 <devfile_write+0xb4>
+        buf += write;
+  8028c3:	48 63 d0             	movslq %eax,%rdx
+  8028c6:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  8028c9:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  8028cc:	49 29 d4             	sub    %rdx,%r12
+  8028cf:	75 a5                	jne    802876 <devfile_write+0x46>
+    return totalWrite;
+  8028d1:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8028d5:	48 83 c4 18          	add    $0x18,%rsp
+  8028d9:	5b                   	pop    %rbx
+  8028da:	41 5c                	pop    %r12
+  8028dc:	41 5d                	pop    %r13
+  8028de:	41 5e                	pop    %r14
+  8028e0:	41 5f                	pop    %r15
+  8028e2:	5d                   	pop    %rbp
+  8028e3:	c3                   	ret
+            return write;
+  8028e4:	48 98                	cltq
+  8028e6:	eb ed                	jmp    8028d5 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8028e8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8028ef:	eb e0                	jmp    8028d1 <devfile_write+0xa1>
+        return -E_INVAL;
+  8028f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028f8:	eb db                	jmp    8028d5 <devfile_write+0xa5>
+  8028fa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802901:	c3                   	ret
+
+0000000000802902 <devfile_read>:
+    if (!fd || !buf) {
+  802902:	48 85 ff             	test   %rdi,%rdi
+  802905:	0f 84 c0 00 00 00    	je     8029cb <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80290b:	55                   	push   %rbp
+  80290c:	48 89 e5             	mov    %rsp,%rbp
+  80290f:	41 57                	push   %r15
+  802911:	41 56                	push   %r14
+  802913:	41 55                	push   %r13
+  802915:	41 54                	push   %r12
+  802917:	53                   	push   %rbx
+  802918:	48 83 ec 18          	sub    $0x18,%rsp
+  80291c:	49 89 ff             	mov    %rdi,%r15
+  80291f:	49 89 f5             	mov    %rsi,%r13
+  802922:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802925:	48 85 f6             	test   %rsi,%rsi
+  802928:	0f 84 96 00 00 00    	je     8029c4 <devfile_read+0xc2>
+    while (n) {
+  80292e:	48 85 d2             	test   %rdx,%rdx
+  802931:	0f 84 87 00 00 00    	je     8029be <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802937:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80293e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80293f:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802946:	00 00 00 
+  802949:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80294d:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802950:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802955:	49 39 c4             	cmp    %rax,%r12
+  802958:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  80295c:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802960:	be 00 00 00 00       	mov    $0x0,%esi
+  802965:	bf 03 00 00 00       	mov    $0x3,%edi
+  80296a:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802976:	85 c0                	test   %eax,%eax
+  802978:	7e 37                	jle    8029b1 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  80297a:	48 63 d8             	movslq %eax,%rbx
+  80297d:	48 89 da             	mov    %rbx,%rdx
+  802980:	4c 89 f6             	mov    %r14,%rsi
+  802983:	4c 89 ef             	mov    %r13,%rdi
+  802986:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  80298d:	00 00 00 
+  802990:	ff d0                	call   *%rax
+        buf += read;
+  802992:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802995:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802999:	49 29 dc             	sub    %rbx,%r12
+  80299c:	75 ab                	jne    802949 <devfile_read+0x47>
+  return totalRead;
+  80299e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8029a2:	48 83 c4 18          	add    $0x18,%rsp
+  8029a6:	5b                   	pop    %rbx
+  8029a7:	41 5c                	pop    %r12
+  8029a9:	41 5d                	pop    %r13
+  8029ab:	41 5e                	pop    %r14
+  8029ad:	41 5f                	pop    %r15
+  8029af:	5d                   	pop    %rbp
+  8029b0:	c3                   	ret
+            return read ? read : totalRead;
+  8029b1:	48 63 d0             	movslq %eax,%rdx
+  8029b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029b8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8029bc:	eb e4                	jmp    8029a2 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  8029be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8029c2:	eb da                	jmp    80299e <devfile_read+0x9c>
+        return E_INVAL;
+  8029c4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029c9:	eb d7                	jmp    8029a2 <devfile_read+0xa0>
+  8029cb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029d0:	c3                   	ret
+
+00000000008029d1 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8029d1:	48 85 ff             	test   %rdi,%rdi
+  8029d4:	74 5f                	je     802a35 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8029d6:	55                   	push   %rbp
+  8029d7:	48 89 e5             	mov    %rsp,%rbp
+  8029da:	53                   	push   %rbx
+  8029db:	48 83 ec 08          	sub    $0x8,%rsp
+  8029df:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8029e2:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8029e9:	00 00 00 
+  8029ec:	ff d0                	call   *%rax
+  8029ee:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8029f4:	77 45                	ja     802a3b <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8029f6:	48 89 de             	mov    %rbx,%rsi
+  8029f9:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a00:	00 00 00 
+  802a03:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802a0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a14:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a19:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802a20:	00 00 00 
+  802a23:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a25:	85 c0                	test   %eax,%eax
+  802a27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+        return -E_INVAL;
+  802a35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a3a:	c3                   	ret
+        return -E_INVAL;
+  802a3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a40:	eb ed                	jmp    802a2f <devfile_receive_snapshot+0x5e>
+
+0000000000802a42 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	41 55                	push   %r13
+  802a48:	41 54                	push   %r12
+  802a4a:	53                   	push   %rbx
+  802a4b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a4f:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802a52:	48 85 f6             	test   %rsi,%rsi
+  802a55:	0f 94 c0             	sete   %al
+  802a58:	48 85 d2             	test   %rdx,%rdx
+  802a5b:	0f 94 c2             	sete   %dl
+  802a5e:	08 d0                	or     %dl,%al
+  802a60:	0f 85 ad 00 00 00    	jne    802b13 <devfile_send_snapshot+0xd1>
+  802a66:	48 89 fb             	mov    %rdi,%rbx
+  802a69:	49 89 f4             	mov    %rsi,%r12
+  802a6c:	48 85 ff             	test   %rdi,%rdi
+  802a6f:	0f 84 9e 00 00 00    	je     802b13 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802a75:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+  802a81:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802a87:	0f 87 8d 00 00 00    	ja     802b1a <devfile_send_snapshot+0xd8>
+  802a8d:	4c 89 e7             	mov    %r12,%rdi
+  802a90:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+  802a9c:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802aa2:	77 7d                	ja     802b21 <devfile_send_snapshot+0xdf>
+  802aa4:	4c 89 ef             	mov    %r13,%rdi
+  802aa7:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802aae:	00 00 00 
+  802ab1:	ff d0                	call   *%rax
+  802ab3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ab9:	77 6d                	ja     802b28 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802abb:	48 89 de             	mov    %rbx,%rsi
+  802abe:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802ac5:	00 00 00 
+  802ac8:	48 bb c0 10 80 00 00 	movabs $0x8010c0,%rbx
+  802acf:	00 00 00 
+  802ad2:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802ad4:	4c 89 e6             	mov    %r12,%rsi
+  802ad7:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802ade:	00 00 00 
+  802ae1:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802ae3:	4c 89 ee             	mov    %r13,%rsi
+  802ae6:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802aed:	00 00 00 
+  802af0:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802af2:	be 00 00 00 00       	mov    $0x0,%esi
+  802af7:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802afc:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802b03:	00 00 00 
+  802b06:	ff d0                	call   *%rax
+}
+  802b08:	48 83 c4 08          	add    $0x8,%rsp
+  802b0c:	5b                   	pop    %rbx
+  802b0d:	41 5c                	pop    %r12
+  802b0f:	41 5d                	pop    %r13
+  802b11:	5d                   	pop    %rbp
+  802b12:	c3                   	ret
+        return -E_INVAL;
+  802b13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b18:	eb ee                	jmp    802b08 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802b1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b1f:	eb e7                	jmp    802b08 <devfile_send_snapshot+0xc6>
+  802b21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b26:	eb e0                	jmp    802b08 <devfile_send_snapshot+0xc6>
+  802b28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b2d:	eb d9                	jmp    802b08 <devfile_send_snapshot+0xc6>
+
+0000000000802b2f <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802b2f:	48 85 ff             	test   %rdi,%rdi
+  802b32:	0f 84 41 01 00 00    	je     802c79 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802b38:	55                   	push   %rbp
+  802b39:	48 89 e5             	mov    %rsp,%rbp
+  802b3c:	41 57                	push   %r15
+  802b3e:	41 56                	push   %r14
+  802b40:	41 55                	push   %r13
+  802b42:	41 54                	push   %r12
+  802b44:	53                   	push   %rbx
+  802b45:	48 83 ec 08          	sub    $0x8,%rsp
+  802b49:	49 89 fc             	mov    %rdi,%r12
+  802b4c:	49 89 f5             	mov    %rsi,%r13
+  802b4f:	48 89 d3             	mov    %rdx,%rbx
+  802b52:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802b55:	48 85 f6             	test   %rsi,%rsi
+  802b58:	0f 84 ff 00 00 00    	je     802c5d <devfile_diff_snapshots+0x12e>
+  802b5e:	48 85 d2             	test   %rdx,%rdx
+  802b61:	0f 84 fd 00 00 00    	je     802c64 <devfile_diff_snapshots+0x135>
+  802b67:	48 85 c9             	test   %rcx,%rcx
+  802b6a:	0f 84 f4 00 00 00    	je     802c64 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802b70:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+  802b7c:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b82:	0f 87 e3 00 00 00    	ja     802c6b <devfile_diff_snapshots+0x13c>
+  802b88:	4c 89 ef             	mov    %r13,%rdi
+  802b8b:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+  802b97:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802b9d:	0f 87 cf 00 00 00    	ja     802c72 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802ba3:	4c 89 e6             	mov    %r12,%rsi
+  802ba6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802bad:	00 00 00 
+  802bb0:	4c 89 e7             	mov    %r12,%rdi
+  802bb3:	49 bf c0 10 80 00 00 	movabs $0x8010c0,%r15
+  802bba:	00 00 00 
+  802bbd:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802bc0:	4c 89 ee             	mov    %r13,%rsi
+  802bc3:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802bca:	00 
+  802bcb:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802bce:	48 8b 03             	mov    (%rbx),%rax
+  802bd1:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802bd8:	00 
+  802bd9:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802bdd:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802be4:	00 
+  802be5:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802be9:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802bf0:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802bf1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802bfb:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802c02:	00 00 00 
+  802c05:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c07:	85 c0                	test   %eax,%eax
+  802c09:	78 43                	js     802c4e <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802c0b:	49 8b 04 24          	mov    (%r12),%rax
+  802c0f:	48 89 03             	mov    %rax,(%rbx)
+  802c12:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802c17:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802c1b:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802c20:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802c24:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802c29:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802c2d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802c31:	48 c1 e2 03          	shl    $0x3,%rdx
+  802c35:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802c3a:	4c 89 f7             	mov    %r14,%rdi
+  802c3d:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  802c44:	00 00 00 
+  802c47:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802c49:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802c4e:	48 83 c4 08          	add    $0x8,%rsp
+  802c52:	5b                   	pop    %rbx
+  802c53:	41 5c                	pop    %r12
+  802c55:	41 5d                	pop    %r13
+  802c57:	41 5e                	pop    %r14
+  802c59:	41 5f                	pop    %r15
+  802c5b:	5d                   	pop    %rbp
+  802c5c:	c3                   	ret
+        return -E_INVAL;
+  802c5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c62:	eb ea                	jmp    802c4e <devfile_diff_snapshots+0x11f>
+  802c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c69:	eb e3                	jmp    802c4e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802c6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c70:	eb dc                	jmp    802c4e <devfile_diff_snapshots+0x11f>
+  802c72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c77:	eb d5                	jmp    802c4e <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802c79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c7e:	c3                   	ret
+
+0000000000802c7f <devfile_delete_snapshot>:
+    if (!name) {
+  802c7f:	48 85 ff             	test   %rdi,%rdi
+  802c82:	74 5f                	je     802ce3 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802c84:	55                   	push   %rbp
+  802c85:	48 89 e5             	mov    %rsp,%rbp
+  802c88:	53                   	push   %rbx
+  802c89:	48 83 ec 08          	sub    $0x8,%rsp
+  802c8d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802c90:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+  802c9c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ca2:	77 45                	ja     802ce9 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802ca4:	48 89 de             	mov    %rbx,%rsi
+  802ca7:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802cae:	00 00 00 
+  802cb1:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802cc7:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cd3:	85 c0                	test   %eax,%eax
+  802cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cda:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802cdd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce1:	c9                   	leave
+  802ce2:	c3                   	ret
+        return -E_INVAL;
+  802ce3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ce8:	c3                   	ret
+        return -E_INVAL;
+  802ce9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cee:	eb ed                	jmp    802cdd <devfile_delete_snapshot+0x5e>
+
+0000000000802cf0 <devfile_accept_snapshot>:
+    if (!name) {
+  802cf0:	48 85 ff             	test   %rdi,%rdi
+  802cf3:	74 5f                	je     802d54 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802cf5:	55                   	push   %rbp
+  802cf6:	48 89 e5             	mov    %rsp,%rbp
+  802cf9:	53                   	push   %rbx
+  802cfa:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfe:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802d01:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802d08:	00 00 00 
+  802d0b:	ff d0                	call   *%rax
+  802d0d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d13:	77 45                	ja     802d5a <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802d15:	48 89 de             	mov    %rbx,%rsi
+  802d18:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802d1f:	00 00 00 
+  802d22:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d33:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d38:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802d3f:	00 00 00 
+  802d42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d52:	c9                   	leave
+  802d53:	c3                   	ret
+        return -E_INVAL;
+  802d54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d59:	c3                   	ret
+        return -E_INVAL;
+  802d5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5f:	eb ed                	jmp    802d4e <devfile_accept_snapshot+0x5e>
+
+0000000000802d61 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802d61:	48 85 ff             	test   %rdi,%rdi
+  802d64:	0f 84 9f 00 00 00    	je     802e09 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802d6a:	55                   	push   %rbp
+  802d6b:	48 89 e5             	mov    %rsp,%rbp
+  802d6e:	41 54                	push   %r12
+  802d70:	53                   	push   %rbx
+  802d71:	48 89 fb             	mov    %rdi,%rbx
+  802d74:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802d77:	48 85 f6             	test   %rsi,%rsi
+  802d7a:	74 78                	je     802df4 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802d7c:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+  802d88:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d8e:	77 6b                	ja     802dfb <devfile_create_snapshot+0x9a>
+  802d90:	4c 89 e7             	mov    %r12,%rdi
+  802d93:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+  802d9f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802da5:	77 5b                	ja     802e02 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802da7:	48 89 de             	mov    %rbx,%rsi
+  802daa:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802db1:	00 00 00 
+  802db4:	48 bb c0 10 80 00 00 	movabs $0x8010c0,%rbx
+  802dbb:	00 00 00 
+  802dbe:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802dc0:	4c 89 e6             	mov    %r12,%rsi
+  802dc3:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802dca:	00 00 00 
+  802dcd:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd4:	bf 08 00 00 00       	mov    $0x8,%edi
+  802dd9:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dec:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802def:	5b                   	pop    %rbx
+  802df0:	41 5c                	pop    %r12
+  802df2:	5d                   	pop    %rbp
+  802df3:	c3                   	ret
+        return -E_INVAL;
+  802df4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802df9:	eb f4                	jmp    802def <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802dfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e00:	eb ed                	jmp    802def <devfile_create_snapshot+0x8e>
+  802e02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e07:	eb e6                	jmp    802def <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e0e:	c3                   	ret
+
+0000000000802e0f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e0f:	55                   	push   %rbp
+  802e10:	48 89 e5             	mov    %rsp,%rbp
+  802e13:	41 54                	push   %r12
+  802e15:	53                   	push   %rbx
+  802e16:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e19:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e1c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802e23:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802e25:	be 00 00 00 00       	mov    $0x0,%esi
+  802e2a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e2f:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e3b:	85 c0                	test   %eax,%eax
+  802e3d:	78 3d                	js     802e7c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e3f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802e46:	00 00 00 
+  802e49:	4c 89 e6             	mov    %r12,%rsi
+  802e4c:	48 89 df             	mov    %rbx,%rdi
+  802e4f:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e5b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802e62:	00 
+  802e63:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e69:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802e70:	00 
+  802e71:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802e77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e7c:	5b                   	pop    %rbx
+  802e7d:	41 5c                	pop    %r12
+  802e7f:	5d                   	pop    %rbp
+  802e80:	c3                   	ret
+
+0000000000802e81 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802e81:	55                   	push   %rbp
+  802e82:	48 89 e5             	mov    %rsp,%rbp
+  802e85:	41 57                	push   %r15
+  802e87:	41 56                	push   %r14
+  802e89:	41 55                	push   %r13
+  802e8b:	41 54                	push   %r12
+  802e8d:	53                   	push   %rbx
+  802e8e:	48 83 ec 38          	sub    $0x38,%rsp
+  802e92:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802e96:	49 89 f5             	mov    %rsi,%r13
+  802e99:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802e9c:	48 89 f0             	mov    %rsi,%rax
+  802e9f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ea4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ea8:	75 4f                	jne    802ef9 <devfile_readmap+0x78>
+  802eaa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802eae:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802eb4:	75 1f                	jne    802ed5 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802eb6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802eba:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802ebe:	49 be 69 36 80 00 00 	movabs $0x803669,%r14
+  802ec5:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802ec8:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802ecf:	0f 87 9d 00 00 00    	ja     802f72 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802ed5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ed9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802edd:	4d 85 ff             	test   %r15,%r15
+  802ee0:	0f 85 cf 00 00 00    	jne    802fb5 <devfile_readmap+0x134>
+  802ee6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802eea:	48 83 c4 38          	add    $0x38,%rsp
+  802eee:	5b                   	pop    %rbx
+  802eef:	41 5c                	pop    %r12
+  802ef1:	41 5d                	pop    %r13
+  802ef3:	41 5e                	pop    %r14
+  802ef5:	41 5f                	pop    %r15
+  802ef7:	5d                   	pop    %rbp
+  802ef8:	c3                   	ret
+    size_t totalRead = 0;
+  802ef9:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802f00:	00 
+  802f01:	eb da                	jmp    802edd <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f03:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f07:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f0a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802f11:	00 00 00 
+  802f14:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802f16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f1a:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802f1e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f22:	4c 89 ee             	mov    %r13,%rsi
+  802f25:	bf 14 00 00 00       	mov    $0x14,%edi
+  802f2a:	48 b8 2f 26 80 00 00 	movabs $0x80262f,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802f36:	85 c0                	test   %eax,%eax
+  802f38:	7e a3                	jle    802edd <devfile_readmap+0x5c>
+  802f3a:	48 98                	cltq
+  802f3c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802f40:	72 9b                	jb     802edd <devfile_readmap+0x5c>
+        buf += read;
+  802f42:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802f45:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802f48:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802f4c:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802f53:	75 88                	jne    802edd <devfile_readmap+0x5c>
+  802f55:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f59:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f5f:	0f 85 78 ff ff ff    	jne    802edd <devfile_readmap+0x5c>
+  802f65:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802f6c:	0f 86 6b ff ff ff    	jbe    802edd <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802f72:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802f78:	4d 39 e7             	cmp    %r12,%r15
+  802f7b:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802f7f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802f86:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802f8a:	0f 84 73 ff ff ff    	je     802f03 <devfile_readmap+0x82>
+  802f90:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802f94:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802f99:	41 ff d6             	call   *%r14
+  802f9c:	a8 40                	test   $0x40,%al
+  802f9e:	0f 85 39 ff ff ff    	jne    802edd <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802fa4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802fab:	4c 39 e3             	cmp    %r12,%rbx
+  802fae:	72 e4                	jb     802f94 <devfile_readmap+0x113>
+  802fb0:	e9 4e ff ff ff       	jmp    802f03 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802fb5:	4c 89 fa             	mov    %r15,%rdx
+  802fb8:	4c 89 ee             	mov    %r13,%rsi
+  802fbb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802fbf:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  802fc6:	00 00 00 
+  802fc9:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802fcb:	48 85 c0             	test   %rax,%rax
+  802fce:	78 0c                	js     802fdc <devfile_readmap+0x15b>
+    return totalRead + read;
+  802fd0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fd4:	48 01 f0             	add    %rsi,%rax
+  802fd7:	e9 0e ff ff ff       	jmp    802eea <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802fdc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fe0:	48 85 f6             	test   %rsi,%rsi
+  802fe3:	48 0f 45 c6          	cmovne %rsi,%rax
+  802fe7:	e9 fe fe ff ff       	jmp    802eea <devfile_readmap+0x69>
+
+0000000000802fec <open>:
+open(const char *path, int mode) {
+  802fec:	55                   	push   %rbp
+  802fed:	48 89 e5             	mov    %rsp,%rbp
+  802ff0:	41 55                	push   %r13
+  802ff2:	41 54                	push   %r12
+  802ff4:	53                   	push   %rbx
+  802ff5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff9:	49 89 fc             	mov    %rdi,%r12
+  802ffc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fff:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+  80300b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803011:	0f 87 8a 00 00 00    	ja     8030a1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803017:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80301b:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+  803027:	89 c3                	mov    %eax,%ebx
+  803029:	85 c0                	test   %eax,%eax
+  80302b:	78 50                	js     80307d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80302d:	4c 89 e6             	mov    %r12,%rsi
+  803030:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803037:	00 00 00 
+  80303a:	48 89 df             	mov    %rbx,%rdi
+  80303d:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  803044:	00 00 00 
+  803047:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803049:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803050:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803054:	bf 01 00 00 00       	mov    $0x1,%edi
+  803059:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  803060:	00 00 00 
+  803063:	ff d0                	call   *%rax
+  803065:	89 c3                	mov    %eax,%ebx
+  803067:	85 c0                	test   %eax,%eax
+  803069:	78 1f                	js     80308a <open+0x9e>
+    return fd2num(fd);
+  80306b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80306f:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  803076:	00 00 00 
+  803079:	ff d0                	call   *%rax
+  80307b:	89 c3                	mov    %eax,%ebx
+}
+  80307d:	89 d8                	mov    %ebx,%eax
+  80307f:	48 83 c4 18          	add    $0x18,%rsp
+  803083:	5b                   	pop    %rbx
+  803084:	41 5c                	pop    %r12
+  803086:	41 5d                	pop    %r13
+  803088:	5d                   	pop    %rbp
+  803089:	c3                   	ret
+        fd_close(fd, 0);
+  80308a:	be 00 00 00 00       	mov    $0x0,%esi
+  80308f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803093:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  80309a:	00 00 00 
+  80309d:	ff d0                	call   *%rax
+        return res;
+  80309f:	eb dc                	jmp    80307d <open+0x91>
+        return -E_BAD_PATH;
+  8030a1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030a6:	eb d5                	jmp    80307d <open+0x91>
+
+00000000008030a8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8030a8:	55                   	push   %rbp
+  8030a9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8030ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b1:	bf 13 00 00 00       	mov    $0x13,%edi
+  8030b6:	48 b8 c7 26 80 00 00 	movabs $0x8026c7,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+}
+  8030c2:	5d                   	pop    %rbp
+  8030c3:	c3                   	ret
+
+00000000008030c4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030c4:	55                   	push   %rbp
+  8030c5:	48 89 e5             	mov    %rsp,%rbp
+  8030c8:	41 54                	push   %r12
+  8030ca:	53                   	push   %rbx
+  8030cb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030ce:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  8030d5:	00 00 00 
+  8030d8:	ff d0                	call   *%rax
+  8030da:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8030dd:	48 be 60 43 80 00 00 	movabs $0x804360,%rsi
+  8030e4:	00 00 00 
+  8030e7:	48 89 df             	mov    %rbx,%rdi
+  8030ea:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8030f6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8030fb:	41 2b 04 24          	sub    (%r12),%eax
+  8030ff:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803105:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80310c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80310f:	48 b8 80 51 80 00 00 	movabs $0x805180,%rax
+  803116:	00 00 00 
+  803119:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803120:	b8 00 00 00 00       	mov    $0x0,%eax
+  803125:	5b                   	pop    %rbx
+  803126:	41 5c                	pop    %r12
+  803128:	5d                   	pop    %rbp
+  803129:	c3                   	ret
+
+000000000080312a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80312a:	55                   	push   %rbp
+  80312b:	48 89 e5             	mov    %rsp,%rbp
+  80312e:	41 54                	push   %r12
+  803130:	53                   	push   %rbx
+  803131:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803134:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803139:	48 89 fe             	mov    %rdi,%rsi
+  80313c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803141:	49 bc 18 18 80 00 00 	movabs $0x801818,%r12
+  803148:	00 00 00 
+  80314b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80314e:	48 89 df             	mov    %rbx,%rdi
+  803151:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  803158:	00 00 00 
+  80315b:	ff d0                	call   *%rax
+  80315d:	48 89 c6             	mov    %rax,%rsi
+  803160:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803165:	bf 00 00 00 00       	mov    $0x0,%edi
+  80316a:	41 ff d4             	call   *%r12
+}
+  80316d:	5b                   	pop    %rbx
+  80316e:	41 5c                	pop    %r12
+  803170:	5d                   	pop    %rbp
+  803171:	c3                   	ret
+
+0000000000803172 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803172:	55                   	push   %rbp
+  803173:	48 89 e5             	mov    %rsp,%rbp
+  803176:	41 57                	push   %r15
+  803178:	41 56                	push   %r14
+  80317a:	41 55                	push   %r13
+  80317c:	41 54                	push   %r12
+  80317e:	53                   	push   %rbx
+  80317f:	48 83 ec 18          	sub    $0x18,%rsp
+  803183:	49 89 fc             	mov    %rdi,%r12
+  803186:	49 89 f5             	mov    %rsi,%r13
+  803189:	49 89 d7             	mov    %rdx,%r15
+  80318c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803190:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80319c:	4d 85 ff             	test   %r15,%r15
+  80319f:	0f 84 af 00 00 00    	je     803254 <devpipe_write+0xe2>
+  8031a5:	48 89 c3             	mov    %rax,%rbx
+  8031a8:	4c 89 f8             	mov    %r15,%rax
+  8031ab:	4d 89 ef             	mov    %r13,%r15
+  8031ae:	4c 01 e8             	add    %r13,%rax
+  8031b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031b5:	49 bd 20 17 80 00 00 	movabs $0x801720,%r13
+  8031bc:	00 00 00 
+            sys_yield();
+  8031bf:	49 be bd 16 80 00 00 	movabs $0x8016bd,%r14
+  8031c6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031c9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031cc:	48 63 ce             	movslq %esi,%rcx
+  8031cf:	48 63 03             	movslq (%rbx),%rax
+  8031d2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8031d8:	48 39 c1             	cmp    %rax,%rcx
+  8031db:	72 2e                	jb     80320b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031dd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031e2:	48 89 da             	mov    %rbx,%rdx
+  8031e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031ea:	4c 89 e7             	mov    %r12,%rdi
+  8031ed:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	74 66                	je     80325a <devpipe_write+0xe8>
+            sys_yield();
+  8031f4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031f7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031fa:	48 63 ce             	movslq %esi,%rcx
+  8031fd:	48 63 03             	movslq (%rbx),%rax
+  803200:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803206:	48 39 c1             	cmp    %rax,%rcx
+  803209:	73 d2                	jae    8031dd <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80320b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80320f:	48 89 ca             	mov    %rcx,%rdx
+  803212:	48 c1 ea 03          	shr    $0x3,%rdx
+  803216:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80321d:	08 10 20 
+  803220:	48 f7 e2             	mul    %rdx
+  803223:	48 c1 ea 06          	shr    $0x6,%rdx
+  803227:	48 89 d0             	mov    %rdx,%rax
+  80322a:	48 c1 e0 09          	shl    $0x9,%rax
+  80322e:	48 29 d0             	sub    %rdx,%rax
+  803231:	48 c1 e0 03          	shl    $0x3,%rax
+  803235:	48 29 c1             	sub    %rax,%rcx
+  803238:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80323d:	83 c6 01             	add    $0x1,%esi
+  803240:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803243:	49 83 c7 01          	add    $0x1,%r15
+  803247:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80324b:	49 39 c7             	cmp    %rax,%r15
+  80324e:	0f 85 75 ff ff ff    	jne    8031c9 <devpipe_write+0x57>
+    return n;
+  803254:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803258:	eb 05                	jmp    80325f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80325a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80325f:	48 83 c4 18          	add    $0x18,%rsp
+  803263:	5b                   	pop    %rbx
+  803264:	41 5c                	pop    %r12
+  803266:	41 5d                	pop    %r13
+  803268:	41 5e                	pop    %r14
+  80326a:	41 5f                	pop    %r15
+  80326c:	5d                   	pop    %rbp
+  80326d:	c3                   	ret
+
+000000000080326e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	41 57                	push   %r15
+  803274:	41 56                	push   %r14
+  803276:	41 55                	push   %r13
+  803278:	41 54                	push   %r12
+  80327a:	53                   	push   %rbx
+  80327b:	48 83 ec 18          	sub    $0x18,%rsp
+  80327f:	49 89 fc             	mov    %rdi,%r12
+  803282:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803286:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80328a:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  803291:	00 00 00 
+  803294:	ff d0                	call   *%rax
+  803296:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803299:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80329f:	49 bd 20 17 80 00 00 	movabs $0x801720,%r13
+  8032a6:	00 00 00 
+            sys_yield();
+  8032a9:	49 be bd 16 80 00 00 	movabs $0x8016bd,%r14
+  8032b0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8032b3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032b8:	74 7d                	je     803337 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032ba:	8b 03                	mov    (%rbx),%eax
+  8032bc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032bf:	75 26                	jne    8032e7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8032c1:	4d 85 ff             	test   %r15,%r15
+  8032c4:	75 77                	jne    80333d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032cb:	48 89 da             	mov    %rbx,%rdx
+  8032ce:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032d3:	4c 89 e7             	mov    %r12,%rdi
+  8032d6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	74 72                	je     80334f <devpipe_read+0xe1>
+            sys_yield();
+  8032dd:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032e0:	8b 03                	mov    (%rbx),%eax
+  8032e2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032e5:	74 df                	je     8032c6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8032e7:	48 63 c8             	movslq %eax,%rcx
+  8032ea:	48 89 ca             	mov    %rcx,%rdx
+  8032ed:	48 c1 ea 03          	shr    $0x3,%rdx
+  8032f1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8032f8:	08 10 20 
+  8032fb:	48 89 d0             	mov    %rdx,%rax
+  8032fe:	48 f7 e6             	mul    %rsi
+  803301:	48 c1 ea 06          	shr    $0x6,%rdx
+  803305:	48 89 d0             	mov    %rdx,%rax
+  803308:	48 c1 e0 09          	shl    $0x9,%rax
+  80330c:	48 29 d0             	sub    %rdx,%rax
+  80330f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803316:	00 
+  803317:	48 89 c8             	mov    %rcx,%rax
+  80331a:	48 29 d0             	sub    %rdx,%rax
+  80331d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803322:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803326:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80332a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80332d:	49 83 c7 01          	add    $0x1,%r15
+  803331:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803335:	75 83                	jne    8032ba <devpipe_read+0x4c>
+    return n;
+  803337:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80333b:	eb 03                	jmp    803340 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80333d:	4c 89 f8             	mov    %r15,%rax
+}
+  803340:	48 83 c4 18          	add    $0x18,%rsp
+  803344:	5b                   	pop    %rbx
+  803345:	41 5c                	pop    %r12
+  803347:	41 5d                	pop    %r13
+  803349:	41 5e                	pop    %r14
+  80334b:	41 5f                	pop    %r15
+  80334d:	5d                   	pop    %rbp
+  80334e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80334f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803354:	eb ea                	jmp    803340 <devpipe_read+0xd2>
+
+0000000000803356 <pipe>:
+pipe(int pfd[2]) {
+  803356:	55                   	push   %rbp
+  803357:	48 89 e5             	mov    %rsp,%rbp
+  80335a:	41 55                	push   %r13
+  80335c:	41 54                	push   %r12
+  80335e:	53                   	push   %rbx
+  80335f:	48 83 ec 18          	sub    $0x18,%rsp
+  803363:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803366:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80336a:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+  803376:	89 c3                	mov    %eax,%ebx
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	0f 88 a0 01 00 00    	js     803520 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803380:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803385:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80338a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80338e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803393:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+  80339f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	0f 88 77 01 00 00    	js     803520 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033a9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8033ad:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+  8033b9:	89 c3                	mov    %eax,%ebx
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	0f 88 43 01 00 00    	js     803506 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8033c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033cd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8033d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d6:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+  8033e2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	0f 88 1a 01 00 00    	js     803506 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8033ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033f0:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+  8033fc:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8033ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803404:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803409:	48 89 c6             	mov    %rax,%rsi
+  80340c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803411:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+  80341d:	89 c3                	mov    %eax,%ebx
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	0f 88 c5 00 00 00    	js     8034ec <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803427:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80342b:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  803432:	00 00 00 
+  803435:	ff d0                	call   *%rax
+  803437:	48 89 c1             	mov    %rax,%rcx
+  80343a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803440:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80344b:	4c 89 ee             	mov    %r13,%rsi
+  80344e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803453:	48 b8 b3 17 80 00 00 	movabs $0x8017b3,%rax
+  80345a:	00 00 00 
+  80345d:	ff d0                	call   *%rax
+  80345f:	89 c3                	mov    %eax,%ebx
+  803461:	85 c0                	test   %eax,%eax
+  803463:	78 6e                	js     8034d3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803465:	be 00 10 00 00       	mov    $0x1000,%esi
+  80346a:	4c 89 ef             	mov    %r13,%rdi
+  80346d:	48 b8 ee 16 80 00 00 	movabs $0x8016ee,%rax
+  803474:	00 00 00 
+  803477:	ff d0                	call   *%rax
+  803479:	83 f8 02             	cmp    $0x2,%eax
+  80347c:	0f 85 ab 00 00 00    	jne    80352d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803482:	a1 80 51 80 00 00 00 	movabs 0x805180,%eax
+  803489:	00 00 
+  80348b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80348f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803491:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803495:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80349c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034a0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8034a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034a6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8034ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034b1:	48 bb 1c 1b 80 00 00 	movabs $0x801b1c,%rbx
+  8034b8:	00 00 00 
+  8034bb:	ff d3                	call   *%rbx
+  8034bd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8034c1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8034c5:	ff d3                	call   *%rbx
+  8034c7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8034cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034d1:	eb 4d                	jmp    803520 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8034d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034d8:	4c 89 ee             	mov    %r13,%rsi
+  8034db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034e0:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  8034e7:	00 00 00 
+  8034ea:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8034ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8034f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fa:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  803501:	00 00 00 
+  803504:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803506:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80350b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80350f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803514:	48 b8 18 18 80 00 00 	movabs $0x801818,%rax
+  80351b:	00 00 00 
+  80351e:	ff d0                	call   *%rax
+}
+  803520:	89 d8                	mov    %ebx,%eax
+  803522:	48 83 c4 18          	add    $0x18,%rsp
+  803526:	5b                   	pop    %rbx
+  803527:	41 5c                	pop    %r12
+  803529:	41 5d                	pop    %r13
+  80352b:	5d                   	pop    %rbp
+  80352c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80352d:	48 b9 78 43 80 00 00 	movabs $0x804378,%rcx
+  803534:	00 00 00 
+  803537:	48 ba 53 3c 80 00 00 	movabs $0x803c53,%rdx
+  80353e:	00 00 00 
+  803541:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803546:	48 bf 67 43 80 00 00 	movabs $0x804367,%rdi
+  80354d:	00 00 00 
+  803550:	b8 00 00 00 00       	mov    $0x0,%eax
+  803555:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80355c:	00 00 00 
+  80355f:	41 ff d0             	call   *%r8
+
+0000000000803562 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803562:	55                   	push   %rbp
+  803563:	48 89 e5             	mov    %rsp,%rbp
+  803566:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80356a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80356e:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  803575:	00 00 00 
+  803578:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80357a:	85 c0                	test   %eax,%eax
+  80357c:	78 35                	js     8035b3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80357e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803582:	48 b8 2e 1b 80 00 00 	movabs $0x801b2e,%rax
+  803589:	00 00 00 
+  80358c:	ff d0                	call   *%rax
+  80358e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803591:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803596:	be 00 10 00 00       	mov    $0x1000,%esi
+  80359b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80359f:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+  8035ab:	85 c0                	test   %eax,%eax
+  8035ad:	0f 94 c0             	sete   %al
+  8035b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8035b3:	c9                   	leave
+  8035b4:	c3                   	ret
+
+00000000008035b5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8035b5:	48 89 f8             	mov    %rdi,%rax
+  8035b8:	48 c1 e8 27          	shr    $0x27,%rax
+  8035bc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8035c3:	01 00 00 
+  8035c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035ca:	f6 c2 01             	test   $0x1,%dl
+  8035cd:	74 6d                	je     80363c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8035cf:	48 89 f8             	mov    %rdi,%rax
+  8035d2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035d6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8035dd:	01 00 00 
+  8035e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035e4:	f6 c2 01             	test   $0x1,%dl
+  8035e7:	74 62                	je     80364b <get_uvpt_entry+0x96>
+  8035e9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8035f0:	01 00 00 
+  8035f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035f7:	f6 c2 80             	test   $0x80,%dl
+  8035fa:	75 4f                	jne    80364b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035fc:	48 89 f8             	mov    %rdi,%rax
+  8035ff:	48 c1 e8 15          	shr    $0x15,%rax
+  803603:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80360a:	01 00 00 
+  80360d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803611:	f6 c2 01             	test   $0x1,%dl
+  803614:	74 44                	je     80365a <get_uvpt_entry+0xa5>
+  803616:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80361d:	01 00 00 
+  803620:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803624:	f6 c2 80             	test   $0x80,%dl
+  803627:	75 31                	jne    80365a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803629:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80362d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803634:	01 00 00 
+  803637:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80363b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80363c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803643:	01 00 00 
+  803646:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80364a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80364b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803652:	01 00 00 
+  803655:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803659:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80365a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803661:	01 00 00 
+  803664:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803668:	c3                   	ret
+
+0000000000803669 <get_prot>:
+
+int
+get_prot(void *va) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80366d:	48 b8 b5 35 80 00 00 	movabs $0x8035b5,%rax
+  803674:	00 00 00 
+  803677:	ff d0                	call   *%rax
+  803679:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80367c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803681:	89 c1                	mov    %eax,%ecx
+  803683:	83 c9 04             	or     $0x4,%ecx
+  803686:	f6 c2 01             	test   $0x1,%dl
+  803689:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80368c:	89 c1                	mov    %eax,%ecx
+  80368e:	83 c9 02             	or     $0x2,%ecx
+  803691:	f6 c2 02             	test   $0x2,%dl
+  803694:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803697:	89 c1                	mov    %eax,%ecx
+  803699:	83 c9 01             	or     $0x1,%ecx
+  80369c:	48 85 d2             	test   %rdx,%rdx
+  80369f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8036a2:	89 c1                	mov    %eax,%ecx
+  8036a4:	83 c9 40             	or     $0x40,%ecx
+  8036a7:	f6 c6 04             	test   $0x4,%dh
+  8036aa:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8036ad:	5d                   	pop    %rbp
+  8036ae:	c3                   	ret
+
+00000000008036af <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8036af:	55                   	push   %rbp
+  8036b0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036b3:	48 b8 b5 35 80 00 00 	movabs $0x8035b5,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8036bf:	48 c1 e8 06          	shr    $0x6,%rax
+  8036c3:	83 e0 01             	and    $0x1,%eax
+}
+  8036c6:	5d                   	pop    %rbp
+  8036c7:	c3                   	ret
+
+00000000008036c8 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  8036c8:	55                   	push   %rbp
+  8036c9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036cc:	48 b8 b5 35 80 00 00 	movabs $0x8035b5,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8036d8:	48 c1 e8 05          	shr    $0x5,%rax
+  8036dc:	83 e0 01             	and    $0x1,%eax
+}
+  8036df:	5d                   	pop    %rbp
+  8036e0:	c3                   	ret
+
+00000000008036e1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8036e1:	55                   	push   %rbp
+  8036e2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8036e5:	48 b8 b5 35 80 00 00 	movabs $0x8035b5,%rax
+  8036ec:	00 00 00 
+  8036ef:	ff d0                	call   *%rax
+  8036f1:	83 e0 01             	and    $0x1,%eax
+}
+  8036f4:	5d                   	pop    %rbp
+  8036f5:	c3                   	ret
+
+00000000008036f6 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+  8036fa:	41 57                	push   %r15
+  8036fc:	41 56                	push   %r14
+  8036fe:	41 55                	push   %r13
+  803700:	41 54                	push   %r12
+  803702:	53                   	push   %rbx
+  803703:	48 83 ec 18          	sub    $0x18,%rsp
+  803707:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80370b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80370f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803714:	49 bd e1 36 80 00 00 	movabs $0x8036e1,%r13
+  80371b:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80371e:	49 bf 69 36 80 00 00 	movabs $0x803669,%r15
+  803725:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803728:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80372f:	00 00 00 
+  803732:	eb 0c                	jmp    803740 <foreach_shared_region+0x4a>
+  803734:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80373b:	4c 39 f3             	cmp    %r14,%rbx
+  80373e:	74 2e                	je     80376e <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  803740:	48 89 df             	mov    %rbx,%rdi
+  803743:	41 ff d5             	call   *%r13
+  803746:	84 c0                	test   %al,%al
+  803748:	74 ea                	je     803734 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  80374a:	48 89 df             	mov    %rbx,%rdi
+  80374d:	41 ff d7             	call   *%r15
+  803750:	a8 40                	test   $0x40,%al
+  803752:	74 e0                	je     803734 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803754:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80375b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80375f:	48 89 df             	mov    %rbx,%rdi
+  803762:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803766:	ff d0                	call   *%rax
+				if (res < 0) {
+  803768:	85 c0                	test   %eax,%eax
+  80376a:	79 c8                	jns    803734 <foreach_shared_region+0x3e>
+  80376c:	eb 05                	jmp    803773 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80376e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803773:	48 83 c4 18          	add    $0x18,%rsp
+  803777:	5b                   	pop    %rbx
+  803778:	41 5c                	pop    %r12
+  80377a:	41 5d                	pop    %r13
+  80377c:	41 5e                	pop    %r14
+  80377e:	41 5f                	pop    %r15
+  803780:	5d                   	pop    %rbp
+  803781:	c3                   	ret
+
+0000000000803782 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803782:	b8 00 00 00 00       	mov    $0x0,%eax
+  803787:	c3                   	ret
+
+0000000000803788 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803788:	55                   	push   %rbp
+  803789:	48 89 e5             	mov    %rsp,%rbp
+  80378c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80378f:	48 be 9c 43 80 00 00 	movabs $0x80439c,%rsi
+  803796:	00 00 00 
+  803799:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+    return 0;
+}
+  8037a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037aa:	5d                   	pop    %rbp
+  8037ab:	c3                   	ret
+
+00000000008037ac <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037ac:	55                   	push   %rbp
+  8037ad:	48 89 e5             	mov    %rsp,%rbp
+  8037b0:	41 57                	push   %r15
+  8037b2:	41 56                	push   %r14
+  8037b4:	41 55                	push   %r13
+  8037b6:	41 54                	push   %r12
+  8037b8:	53                   	push   %rbx
+  8037b9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8037c0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8037c7:	48 85 d2             	test   %rdx,%rdx
+  8037ca:	74 7a                	je     803846 <devcons_write+0x9a>
+  8037cc:	49 89 d6             	mov    %rdx,%r14
+  8037cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8037d5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8037da:	49 bf ba 12 80 00 00 	movabs $0x8012ba,%r15
+  8037e1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8037e4:	4c 89 f3             	mov    %r14,%rbx
+  8037e7:	48 29 f3             	sub    %rsi,%rbx
+  8037ea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8037ef:	48 39 c3             	cmp    %rax,%rbx
+  8037f2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8037f6:	4c 63 eb             	movslq %ebx,%r13
+  8037f9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803800:	48 01 c6             	add    %rax,%rsi
+  803803:	4c 89 ea             	mov    %r13,%rdx
+  803806:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80380d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803810:	4c 89 ee             	mov    %r13,%rsi
+  803813:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80381a:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  803821:	00 00 00 
+  803824:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803826:	41 01 dc             	add    %ebx,%r12d
+  803829:	49 63 f4             	movslq %r12d,%rsi
+  80382c:	4c 39 f6             	cmp    %r14,%rsi
+  80382f:	72 b3                	jb     8037e4 <devcons_write+0x38>
+    return res;
+  803831:	49 63 c4             	movslq %r12d,%rax
+}
+  803834:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80383b:	5b                   	pop    %rbx
+  80383c:	41 5c                	pop    %r12
+  80383e:	41 5d                	pop    %r13
+  803840:	41 5e                	pop    %r14
+  803842:	41 5f                	pop    %r15
+  803844:	5d                   	pop    %rbp
+  803845:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803846:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80384c:	eb e3                	jmp    803831 <devcons_write+0x85>
+
+000000000080384e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80384e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803851:	ba 00 00 00 00       	mov    $0x0,%edx
+  803856:	48 85 c0             	test   %rax,%rax
+  803859:	74 55                	je     8038b0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80385b:	55                   	push   %rbp
+  80385c:	48 89 e5             	mov    %rsp,%rbp
+  80385f:	41 55                	push   %r13
+  803861:	41 54                	push   %r12
+  803863:	53                   	push   %rbx
+  803864:	48 83 ec 08          	sub    $0x8,%rsp
+  803868:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80386b:	48 bb f0 15 80 00 00 	movabs $0x8015f0,%rbx
+  803872:	00 00 00 
+  803875:	49 bc bd 16 80 00 00 	movabs $0x8016bd,%r12
+  80387c:	00 00 00 
+  80387f:	eb 03                	jmp    803884 <devcons_read+0x36>
+  803881:	41 ff d4             	call   *%r12
+  803884:	ff d3                	call   *%rbx
+  803886:	85 c0                	test   %eax,%eax
+  803888:	74 f7                	je     803881 <devcons_read+0x33>
+    if (c < 0) return c;
+  80388a:	48 63 d0             	movslq %eax,%rdx
+  80388d:	78 13                	js     8038a2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80388f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803894:	83 f8 04             	cmp    $0x4,%eax
+  803897:	74 09                	je     8038a2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803899:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80389d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8038a2:	48 89 d0             	mov    %rdx,%rax
+  8038a5:	48 83 c4 08          	add    $0x8,%rsp
+  8038a9:	5b                   	pop    %rbx
+  8038aa:	41 5c                	pop    %r12
+  8038ac:	41 5d                	pop    %r13
+  8038ae:	5d                   	pop    %rbp
+  8038af:	c3                   	ret
+  8038b0:	48 89 d0             	mov    %rdx,%rax
+  8038b3:	c3                   	ret
+
+00000000008038b4 <cputchar>:
+cputchar(int ch) {
+  8038b4:	55                   	push   %rbp
+  8038b5:	48 89 e5             	mov    %rsp,%rbp
+  8038b8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8038bc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8038c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8038c5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8038c9:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+}
+  8038d5:	c9                   	leave
+  8038d6:	c3                   	ret
+
+00000000008038d7 <getchar>:
+getchar(void) {
+  8038d7:	55                   	push   %rbp
+  8038d8:	48 89 e5             	mov    %rsp,%rbp
+  8038db:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8038df:	ba 01 00 00 00       	mov    $0x1,%edx
+  8038e4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8038e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ed:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  8038f4:	00 00 00 
+  8038f7:	ff d0                	call   *%rax
+  8038f9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8038fb:	85 c0                	test   %eax,%eax
+  8038fd:	78 06                	js     803905 <getchar+0x2e>
+  8038ff:	74 08                	je     803909 <getchar+0x32>
+  803901:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803905:	89 d0                	mov    %edx,%eax
+  803907:	c9                   	leave
+  803908:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803909:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80390e:	eb f5                	jmp    803905 <getchar+0x2e>
+
+0000000000803910 <iscons>:
+iscons(int fdnum) {
+  803910:	55                   	push   %rbp
+  803911:	48 89 e5             	mov    %rsp,%rbp
+  803914:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803918:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80391c:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  803923:	00 00 00 
+  803926:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803928:	85 c0                	test   %eax,%eax
+  80392a:	78 18                	js     803944 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80392c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803930:	48 b8 20 52 80 00 00 	movabs $0x805220,%rax
+  803937:	00 00 00 
+  80393a:	8b 00                	mov    (%rax),%eax
+  80393c:	39 02                	cmp    %eax,(%rdx)
+  80393e:	0f 94 c0             	sete   %al
+  803941:	0f b6 c0             	movzbl %al,%eax
+}
+  803944:	c9                   	leave
+  803945:	c3                   	ret
+
+0000000000803946 <opencons>:
+opencons(void) {
+  803946:	55                   	push   %rbp
+  803947:	48 89 e5             	mov    %rsp,%rbp
+  80394a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80394e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803952:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  803959:	00 00 00 
+  80395c:	ff d0                	call   *%rax
+  80395e:	85 c0                	test   %eax,%eax
+  803960:	78 49                	js     8039ab <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803962:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803967:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80396c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803970:	bf 00 00 00 00       	mov    $0x0,%edi
+  803975:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  80397c:	00 00 00 
+  80397f:	ff d0                	call   *%rax
+  803981:	85 c0                	test   %eax,%eax
+  803983:	78 26                	js     8039ab <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803985:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803989:	a1 20 52 80 00 00 00 	movabs 0x805220,%eax
+  803990:	00 00 
+  803992:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803994:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803998:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80399f:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+}
+  8039ab:	c9                   	leave
+  8039ac:	c3                   	ret
+
+00000000008039ad <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8039ad:	55                   	push   %rbp
+  8039ae:	48 89 e5             	mov    %rsp,%rbp
+  8039b1:	41 55                	push   %r13
+  8039b3:	41 54                	push   %r12
+  8039b5:	53                   	push   %rbx
+  8039b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8039ba:	49 89 fc             	mov    %rdi,%r12
+  8039bd:	48 89 f7             	mov    %rsi,%rdi
+  8039c0:	48 89 d3             	mov    %rdx,%rbx
+  8039c3:	49 89 cd             	mov    %rcx,%r13
+  8039c6:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8039c9:	48 85 f6             	test   %rsi,%rsi
+  8039cc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039d3:	00 00 00 
+  8039d6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  8039da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039df:	48 85 db             	test   %rbx,%rbx
+  8039e2:	74 03                	je     8039e7 <ipc_recv_timed+0x3a>
+  8039e4:	48 8b 33             	mov    (%rbx),%rsi
+  8039e7:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  8039ee:	00 00 00 
+  8039f1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8039f3:	85 c0                	test   %eax,%eax
+  8039f5:	78 75                	js     803a6c <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8039f7:	4d 85 e4             	test   %r12,%r12
+  8039fa:	74 14                	je     803a10 <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  8039fc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803a03:	00 00 00 
+  803a06:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803a0c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  803a10:	4d 85 ed             	test   %r13,%r13
+  803a13:	74 14                	je     803a29 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803a15:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803a1c:	00 00 00 
+  803a1f:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803a25:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803a29:	48 85 db             	test   %rbx,%rbx
+  803a2c:	74 23                	je     803a51 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803a2e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803a35:	00 00 00 
+  803a38:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a43:	85 c9                	test   %ecx,%ecx
+  803a45:	74 07                	je     803a4e <ipc_recv_timed+0xa1>
+  803a47:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803a4e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  803a51:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803a58:	00 00 00 
+  803a5b:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  803a61:	48 83 c4 08          	add    $0x8,%rsp
+  803a65:	5b                   	pop    %rbx
+  803a66:	41 5c                	pop    %r12
+  803a68:	41 5d                	pop    %r13
+  803a6a:	5d                   	pop    %rbp
+  803a6b:	c3                   	ret
+        if (from_env_store != NULL) {
+  803a6c:	4d 85 e4             	test   %r12,%r12
+  803a6f:	74 08                	je     803a79 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  803a71:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803a78:	00 
+        if (perm_store != NULL) {
+  803a79:	4d 85 ed             	test   %r13,%r13
+  803a7c:	74 08                	je     803a86 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  803a7e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803a85:	00 
+        if (size != NULL) {
+  803a86:	48 85 db             	test   %rbx,%rbx
+  803a89:	74 d6                	je     803a61 <ipc_recv_timed+0xb4>
+            *size = 0;
+  803a8b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803a92:	eb cd                	jmp    803a61 <ipc_recv_timed+0xb4>
+
+0000000000803a94 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803a94:	55                   	push   %rbp
+  803a95:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803a98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803a9e:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803aa5:	00 00 00 
+  803aa8:	ff d0                	call   *%rax
+}
+  803aaa:	5d                   	pop    %rbp
+  803aab:	c3                   	ret
+
+0000000000803aac <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803aac:	55                   	push   %rbp
+  803aad:	48 89 e5             	mov    %rsp,%rbp
+  803ab0:	41 57                	push   %r15
+  803ab2:	41 56                	push   %r14
+  803ab4:	41 55                	push   %r13
+  803ab6:	41 54                	push   %r12
+  803ab8:	53                   	push   %rbx
+  803ab9:	48 83 ec 18          	sub    $0x18,%rsp
+  803abd:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803ac0:	48 89 d3             	mov    %rdx,%rbx
+  803ac3:	49 89 cc             	mov    %rcx,%r12
+  803ac6:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ac9:	48 85 d2             	test   %rdx,%rdx
+  803acc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ad3:	00 00 00 
+  803ad6:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803ada:	89 f0                	mov    %esi,%eax
+  803adc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ae0:	48 89 da             	mov    %rbx,%rdx
+  803ae3:	48 89 c6             	mov    %rax,%rsi
+  803ae6:	48 b8 ba 19 80 00 00 	movabs $0x8019ba,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+    while (res < 0) {
+  803af2:	85 c0                	test   %eax,%eax
+  803af4:	79 65                	jns    803b5b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803af6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803af9:	75 33                	jne    803b2e <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803afb:	49 bf bd 16 80 00 00 	movabs $0x8016bd,%r15
+  803b02:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803b05:	49 be ba 19 80 00 00 	movabs $0x8019ba,%r14
+  803b0c:	00 00 00 
+        sys_yield();
+  803b0f:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803b12:	45 89 e8             	mov    %r13d,%r8d
+  803b15:	4c 89 e1             	mov    %r12,%rcx
+  803b18:	48 89 da             	mov    %rbx,%rdx
+  803b1b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b1f:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803b22:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	79 32                	jns    803b5b <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803b29:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803b2c:	74 e1                	je     803b0f <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803b2e:	89 c1                	mov    %eax,%ecx
+  803b30:	48 ba a8 43 80 00 00 	movabs $0x8043a8,%rdx
+  803b37:	00 00 00 
+  803b3a:	be 52 00 00 00       	mov    $0x52,%esi
+  803b3f:	48 bf bc 43 80 00 00 	movabs $0x8043bc,%rdi
+  803b46:	00 00 00 
+  803b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4e:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  803b55:	00 00 00 
+  803b58:	41 ff d0             	call   *%r8
+    }
+}
+  803b5b:	48 83 c4 18          	add    $0x18,%rsp
+  803b5f:	5b                   	pop    %rbx
+  803b60:	41 5c                	pop    %r12
+  803b62:	41 5d                	pop    %r13
+  803b64:	41 5e                	pop    %r14
+  803b66:	41 5f                	pop    %r15
+  803b68:	5d                   	pop    %rbp
+  803b69:	c3                   	ret
+
+0000000000803b6a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803b6f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803b76:	00 00 00 
+  803b79:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803b7d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803b81:	48 c1 e2 04          	shl    $0x4,%rdx
+  803b85:	48 01 ca             	add    %rcx,%rdx
+  803b88:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803b8e:	39 fa                	cmp    %edi,%edx
+  803b90:	74 12                	je     803ba4 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803b92:	48 83 c0 01          	add    $0x1,%rax
+  803b96:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803b9c:	75 db                	jne    803b79 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ba3:	c3                   	ret
+            return envs[i].env_id;
+  803ba4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803ba8:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  803bac:	48 c1 e2 04          	shl    $0x4,%rdx
+  803bb0:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803bb7:	00 00 00 
+  803bba:	48 01 d0             	add    %rdx,%rax
+  803bbd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803bc3:	c3                   	ret
+  803bc4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803bc8 <__rodata_start>:
+  803bc8:	73 6e                	jae    803c38 <__rodata_start+0x70>
+  803bca:	61                   	(bad)
+  803bcb:	70 33                	jo     803c00 <__rodata_start+0x38>
+  803bcd:	20 64 61 74          	and    %ah,0x74(%rcx,%riz,2)
+  803bd1:	61                   	(bad)
+  803bd2:	3a 20                	cmp    (%rax),%ah
+  803bd4:	25 73 3b 20 62       	and    $0x62203b73,%eax
+  803bd9:	75 74                	jne    803c4f <__rodata_start+0x87>
+  803bdb:	20 65 78             	and    %ah,0x78(%rbp)
+  803bde:	70 65                	jo     803c45 <__rodata_start+0x7d>
+  803be0:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803be4:	3a 20                	cmp    (%rax),%ah
+  803be6:	25 73 0a 00 00       	and    $0xa73,%eax
+  803beb:	00 00                	add    %al,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 43 61             	add    %al,0x61(%rbx)
+  803bf2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bf4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf5:	74 20                	je     803c17 <__rodata_start+0x4f>
+  803bf7:	72 65                	jb     803c5e <__rodata_start+0x96>
+  803bf9:	61                   	(bad)
+  803bfa:	64 20 66 72          	and    %ah,%fs:0x72(%rsi)
+  803bfe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bff:	6d                   	insl   (%dx),%es:(%rdi)
+  803c00:	20 66 69             	and    %ah,0x69(%rsi)
+  803c03:	6c                   	insb   (%dx),%es:(%rdi)
+  803c04:	65 20 74 65 73       	and    %dh,%gs:0x73(%rbp,%riz,2)
+  803c09:	74 2c                	je     803c37 <__rodata_start+0x6f>
+  803c0b:	20 65 72             	and    %ah,0x72(%rbp)
+  803c0e:	72 6f                	jb     803c7f <__rodata_start+0xb7>
+  803c10:	72 25                	jb     803c37 <__rodata_start+0x6f>
+  803c12:	64 0a 00             	or     %fs:(%rax),%al
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 73 6e             	add    %dh,0x6e(%rbx)
+  803c1a:	61                   	(bad)
+  803c1b:	70 34                	jo     803c51 <__rodata_start+0x89>
+  803c1d:	20 72 65             	and    %dh,0x65(%rdx)
+  803c20:	61                   	(bad)
+  803c21:	64 65 64 20 64 61 74 	fs gs and %ah,%fs:0x74(%rcx,%riz,2)
+  803c28:	61                   	(bad)
+  803c29:	20 25 73 20 65 78    	and    %ah,0x78652073(%rip)        # 78e55ca2 <__bss_end+0x7864cca2>
+  803c2f:	70 65                	jo     803c96 <__rodata_start+0xce>
+  803c31:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803c35:	20 25 73 0a 00 21    	and    %ah,0x21000a73(%rip)        # 218046ae <__bss_end+0x20ffb6ae>
+  803c3b:	73 74                	jae    803cb1 <__rodata_start+0xe9>
+  803c3d:	72 63                	jb     803ca2 <__rodata_start+0xda>
+  803c3f:	6d                   	insl   (%dx),%es:(%rdi)
+  803c40:	70 28                	jo     803c6a <__rodata_start+0xa2>
+  803c42:	62 75 66 2c 20       	(bad)
+  803c47:	73 6e                	jae    803cb7 <__rodata_start+0xef>
+  803c49:	61                   	(bad)
+  803c4a:	70 33                	jo     803c7f <__rodata_start+0xb7>
+  803c4c:	2e 64 61             	cs fs (bad)
+  803c4f:	74 61                	je     803cb2 <__rodata_start+0xea>
+  803c51:	29 00                	sub    %eax,(%rax)
+  803c53:	61                   	(bad)
+  803c54:	73 73                	jae    803cc9 <__rodata_start+0x101>
+  803c56:	65 72 74             	gs jb  803ccd <__rodata_start+0x105>
+  803c59:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  803c60:	6c                   	insb   (%dx),%es:(%rdi)
+  803c61:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  803c65:	25 73 00 75 73       	and    $0x73750073,%eax
+  803c6a:	65 72 2f             	gs jb  803c9c <__rodata_start+0xd4>
+  803c6d:	74 65                	je     803cd4 <__rodata_start+0x10c>
+  803c6f:	73 74                	jae    803ce5 <__rodata_start+0x11d>
+  803c71:	73 68                	jae    803cdb <__rodata_start+0x113>
+  803c73:	2e 63 00             	cs movsxd (%rax),%eax
+  803c76:	66 61                	data16 (bad)
+  803c78:	6c                   	insb   (%dx),%es:(%rdi)
+  803c79:	73 65                	jae    803ce0 <__rodata_start+0x118>
+  803c7b:	00 21                	add    %ah,(%rcx)
+  803c7d:	73 74                	jae    803cf3 <__rodata_start+0x12b>
+  803c7f:	72 63                	jb     803ce4 <__rodata_start+0x11c>
+  803c81:	6d                   	insl   (%dx),%es:(%rdi)
+  803c82:	70 28                	jo     803cac <__rodata_start+0xe4>
+  803c84:	62 75 66 2c 20       	(bad)
+  803c89:	73 6e                	jae    803cf9 <__rodata_start+0x131>
+  803c8b:	61                   	(bad)
+  803c8c:	70 34                	jo     803cc2 <__rodata_start+0xfa>
+  803c8e:	2e 64 61             	cs fs (bad)
+  803c91:	74 61                	je     803cf4 <__rodata_start+0x12c>
+  803c93:	29 00                	sub    %eax,(%rax)
+  803c95:	73 69                	jae    803d00 <__rodata_start+0x138>
+  803c97:	78 5f                	js     803cf8 <__rodata_start+0x130>
+  803c99:	73 6e                	jae    803d09 <__rodata_start+0x141>
+  803c9b:	61                   	(bad)
+  803c9c:	70 00                	jo     803c9e <__rodata_start+0xd6>
+  803c9e:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803ca1:	6d                   	insl   (%dx),%es:(%rdi)
+  803ca2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ca4:	74 36                	je     803cdc <__rodata_start+0x114>
+  803ca6:	00 66 69             	add    %ah,0x69(%rsi)
+  803ca9:	66 74 68             	data16 je 803d14 <__rodata_start+0x14c>
+  803cac:	5f                   	pop    %rdi
+  803cad:	73 6e                	jae    803d1d <__rodata_start+0x155>
+  803caf:	61                   	(bad)
+  803cb0:	70 00                	jo     803cb2 <__rodata_start+0xea>
+  803cb2:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803cb5:	6d                   	insl   (%dx),%es:(%rdi)
+  803cb6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cb8:	74 35                	je     803cef <__rodata_start+0x127>
+  803cba:	00 66 6f             	add    %ah,0x6f(%rsi)
+  803cbd:	75 72                	jne    803d31 <__rodata_start+0x169>
+  803cbf:	74 68                	je     803d29 <__rodata_start+0x161>
+  803cc1:	5f                   	pop    %rdi
+  803cc2:	73 6e                	jae    803d32 <__rodata_start+0x16a>
+  803cc4:	61                   	(bad)
+  803cc5:	70 00                	jo     803cc7 <__rodata_start+0xff>
+  803cc7:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803cca:	6d                   	insl   (%dx),%es:(%rdi)
+  803ccb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ccd:	74 34                	je     803d03 <__rodata_start+0x13b>
+  803ccf:	00 74 68 69          	add    %dh,0x69(%rax,%rbp,2)
+  803cd3:	72 64                	jb     803d39 <__rodata_start+0x171>
+  803cd5:	5f                   	pop    %rdi
+  803cd6:	73 6e                	jae    803d46 <__rodata_start+0x17e>
+  803cd8:	61                   	(bad)
+  803cd9:	70 00                	jo     803cdb <__rodata_start+0x113>
+  803cdb:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803cde:	6d                   	insl   (%dx),%es:(%rdi)
+  803cdf:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ce1:	74 33                	je     803d16 <__rodata_start+0x14e>
+  803ce3:	00 73 65             	add    %dh,0x65(%rbx)
+  803ce6:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  803ce9:	64 5f                	fs pop %rdi
+  803ceb:	73 6e                	jae    803d5b <__rodata_start+0x193>
+  803ced:	61                   	(bad)
+  803cee:	70 00                	jo     803cf0 <__rodata_start+0x128>
+  803cf0:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803cf3:	6d                   	insl   (%dx),%es:(%rdi)
+  803cf4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cf6:	74 32                	je     803d2a <__rodata_start+0x162>
+  803cf8:	00 66 69             	add    %ah,0x69(%rsi)
+  803cfb:	72 73                	jb     803d70 <__rodata_start+0x1a8>
+  803cfd:	74 5f                	je     803d5e <__rodata_start+0x196>
+  803cff:	73 6e                	jae    803d6f <__rodata_start+0x1a7>
+  803d01:	61                   	(bad)
+  803d02:	70 00                	jo     803d04 <__rodata_start+0x13c>
+  803d04:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803d07:	6d                   	insl   (%dx),%es:(%rdi)
+  803d08:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d0a:	74 31                	je     803d3d <__rodata_start+0x175>
+  803d0c:	00 74 65 73          	add    %dh,0x73(%rbp,%riz,2)
+  803d10:	74 00                	je     803d12 <__rodata_start+0x14a>
+  803d12:	3c 75                	cmp    $0x75,%al
+  803d14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d15:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803d19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d1a:	3e 00 0f             	ds add %cl,(%rdi)
+  803d1d:	1f                   	(bad)
+  803d1e:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  803d22:	30 38                	xor    %bh,(%rax)
+  803d24:	78 5d                	js     803d83 <__rodata_start+0x1bb>
+  803d26:	20 75 73             	and    %dh,0x73(%rbp)
+  803d29:	65 72 20             	gs jb  803d4c <__rodata_start+0x184>
+  803d2c:	70 61                	jo     803d8f <__rodata_start+0x1c7>
+  803d2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d2f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803d36:	73 20                	jae    803d58 <__rodata_start+0x190>
+  803d38:	61                   	(bad)
+  803d39:	74 20                	je     803d5b <__rodata_start+0x193>
+  803d3b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803d40:	3a 20                	cmp    (%rax),%ah
+  803d42:	00 30                	add    %dh,(%rax)
+  803d44:	31 32                	xor    %esi,(%rdx)
+  803d46:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803d4d:	41                   	rex.B
+  803d4e:	42                   	rex.X
+  803d4f:	43                   	rex.XB
+  803d50:	44                   	rex.R
+  803d51:	45                   	rex.RB
+  803d52:	46 00 30             	rex.RX add %r14b,(%rax)
+  803d55:	31 32                	xor    %esi,(%rdx)
+  803d57:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803d5e:	61                   	(bad)
+  803d5f:	62 63 64 65 66       	(bad)
+  803d64:	00 28                	add    %ch,(%rax)
+  803d66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d67:	75 6c                	jne    803dd5 <__rodata_start+0x20d>
+  803d69:	6c                   	insb   (%dx),%es:(%rdi)
+  803d6a:	29 00                	sub    %eax,(%rax)
+  803d6c:	65 72 72             	gs jb  803de1 <__rodata_start+0x219>
+  803d6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d70:	72 20                	jb     803d92 <__rodata_start+0x1ca>
+  803d72:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803d77:	73 70                	jae    803de9 <__rodata_start+0x221>
+  803d79:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803d7d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803d84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d85:	72 00                	jb     803d87 <__rodata_start+0x1bf>
+  803d87:	62 61 64 20 65       	(bad)
+  803d8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d8d:	76 69                	jbe    803df8 <__rodata_start+0x230>
+  803d8f:	72 6f                	jb     803e00 <__rodata_start+0x238>
+  803d91:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d92:	6d                   	insl   (%dx),%es:(%rdi)
+  803d93:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d95:	74 00                	je     803d97 <__rodata_start+0x1cf>
+  803d97:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803d9e:	20 70 61             	and    %dh,0x61(%rax)
+  803da1:	72 61                	jb     803e04 <__rodata_start+0x23c>
+  803da3:	6d                   	insl   (%dx),%es:(%rdi)
+  803da4:	65 74 65             	gs je  803e0c <__rodata_start+0x244>
+  803da7:	72 00                	jb     803da9 <__rodata_start+0x1e1>
+  803da9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803daa:	75 74                	jne    803e20 <__rodata_start+0x258>
+  803dac:	20 6f 66             	and    %ch,0x66(%rdi)
+  803daf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803db2:	6d                   	insl   (%dx),%es:(%rdi)
+  803db3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803db4:	72 79                	jb     803e2f <__rodata_start+0x267>
+  803db6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803db9:	74 20                	je     803ddb <__rodata_start+0x213>
+  803dbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dbc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803dc0:	76 69                	jbe    803e2b <__rodata_start+0x263>
+  803dc2:	72 6f                	jb     803e33 <__rodata_start+0x26b>
+  803dc4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803dc5:	6d                   	insl   (%dx),%es:(%rdi)
+  803dc6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803dc8:	74 73                	je     803e3d <__rodata_start+0x275>
+  803dca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803dcd:	72 72                	jb     803e41 <__rodata_start+0x279>
+  803dcf:	75 70                	jne    803e41 <__rodata_start+0x279>
+  803dd1:	74 65                	je     803e38 <__rodata_start+0x270>
+  803dd3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803dd8:	75 67                	jne    803e41 <__rodata_start+0x279>
+  803dda:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803ddd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ddf:	00 73 65             	add    %dh,0x65(%rbx)
+  803de2:	67 6d                	insl   (%dx),%es:(%edi)
+  803de4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803de6:	74 61                	je     803e49 <__rodata_start+0x281>
+  803de8:	74 69                	je     803e53 <__rodata_start+0x28b>
+  803dea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803deb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803dec:	20 66 61             	and    %ah,0x61(%rsi)
+  803def:	75 6c                	jne    803e5d <__rodata_start+0x295>
+  803df1:	74 00                	je     803df3 <__rodata_start+0x22b>
+  803df3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803dfa:	20 45 4c             	and    %al,0x4c(%rbp)
+  803dfd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803e01:	61                   	(bad)
+  803e02:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803e07:	20 73 75             	and    %dh,0x75(%rbx)
+  803e0a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803e0d:	73 79                	jae    803e88 <__rodata_start+0x2c0>
+  803e0f:	73 74                	jae    803e85 <__rodata_start+0x2bd>
+  803e11:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803e13:	20 63 61             	and    %ah,0x61(%rbx)
+  803e16:	6c                   	insb   (%dx),%es:(%rdi)
+  803e17:	6c                   	insb   (%dx),%es:(%rdi)
+  803e18:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803e1b:	74 72                	je     803e8f <__rodata_start+0x2c7>
+  803e1d:	79 20                	jns    803e3f <__rodata_start+0x277>
+  803e1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e21:	74 20                	je     803e43 <__rodata_start+0x27b>
+  803e23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803e25:	75 6e                	jne    803e95 <__rodata_start+0x2cd>
+  803e27:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803e2b:	76 20                	jbe    803e4d <__rodata_start+0x285>
+  803e2d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803e34:	72 65                	jb     803e9b <__rodata_start+0x2d3>
+  803e36:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803e39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e3a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803e3e:	65 78 70             	gs js  803eb1 <__rodata_start+0x2e9>
+  803e41:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803e46:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803e49:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803e4d:	20 66 69             	and    %ah,0x69(%rsi)
+  803e50:	6c                   	insb   (%dx),%es:(%rdi)
+  803e51:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803e55:	20 66 72             	and    %ah,0x72(%rsi)
+  803e58:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803e5d:	61                   	(bad)
+  803e5e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803e61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e63:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803e67:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803e6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e6c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803e6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e70:	79 20                	jns    803e92 <__rodata_start+0x2ca>
+  803e72:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803e79:	72 65                	jb     803ee0 <__rodata_start+0x318>
+  803e7b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803e7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803e80:	00 66 69             	add    %ah,0x69(%rsi)
+  803e83:	6c                   	insb   (%dx),%es:(%rdi)
+  803e84:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803e88:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803e8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e8c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803e8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e91:	74 20                	je     803eb3 <__rodata_start+0x2eb>
+  803e93:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803e95:	75 6e                	jne    803f05 <__rodata_start+0x33d>
+  803e97:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803e9b:	76 61                	jbe    803efe <__rodata_start+0x336>
+  803e9d:	6c                   	insb   (%dx),%es:(%rdi)
+  803e9e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ea5:	00 
+  803ea6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803ead:	72 65                	jb     803f14 <__rodata_start+0x34c>
+  803eaf:	61                   	(bad)
+  803eb0:	64 79 20             	fs jns 803ed3 <__rodata_start+0x30b>
+  803eb3:	65 78 69             	gs js  803f1f <__rodata_start+0x357>
+  803eb6:	73 74                	jae    803f2c <__rodata_start+0x364>
+  803eb8:	73 00                	jae    803eba <__rodata_start+0x2f2>
+  803eba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ebb:	70 65                	jo     803f22 <__rodata_start+0x35a>
+  803ebd:	72 61                	jb     803f20 <__rodata_start+0x358>
+  803ebf:	74 69                	je     803f2a <__rodata_start+0x362>
+  803ec1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ec2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ec3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803ec6:	74 20                	je     803ee8 <__rodata_start+0x320>
+  803ec8:	73 75                	jae    803f3f <__rodata_start+0x377>
+  803eca:	70 70                	jo     803f3c <__rodata_start+0x374>
+  803ecc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ecd:	72 74                	jb     803f43 <__rodata_start+0x37b>
+  803ecf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803ed5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803eda:	74 00                	je     803edc <__rodata_start+0x314>
+  803edc:	0f 1f 40 00          	nopl   0x0(%rax)
+  803ee0:	88 09                	mov    %cl,(%rcx)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 c9                	add    %cl,%cl
+  803ee9:	0f 80 00 00 00 00    	jo     803eef <__rodata_start+0x327>
+  803eef:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 c9                	add    %cl,%cl
+  803ef9:	0f 80 00 00 00 00    	jo     803eff <__rodata_start+0x337>
+  803eff:	00 c9                	add    %cl,%cl
+  803f01:	0f 80 00 00 00 00    	jo     803f07 <__rodata_start+0x33f>
+  803f07:	00 c9                	add    %cl,%cl
+  803f09:	0f 80 00 00 00 00    	jo     803f0f <__rodata_start+0x347>
+  803f0f:	00 c9                	add    %cl,%cl
+  803f11:	0f 80 00 00 00 00    	jo     803f17 <__rodata_start+0x34f>
+  803f17:	00 a7 09 80 00 00    	add    %ah,0x8009(%rdi)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 c9                	add    %cl,%cl
+  803f21:	0f 80 00 00 00 00    	jo     803f27 <__rodata_start+0x35f>
+  803f27:	00 c9                	add    %cl,%cl
+  803f29:	0f 80 00 00 00 00    	jo     803f2f <__rodata_start+0x367>
+  803f2f:	00 9b 09 80 00 00    	add    %bl,0x8009(%rbx)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80bf47 <__bss_end+0x2f47>
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 c9                	add    %cl,%cl
+  803f41:	0f 80 00 00 00 00    	jo     803f47 <__rodata_start+0x37f>
+  803f47:	00 9b 09 80 00 00    	add    %bl,0x8009(%rbx)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 e1                	add    %ah,%cl
+  803f51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f57:	00 e1                	add    %ah,%cl
+  803f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f5f:	00 e1                	add    %ah,%cl
+  803f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f67:	00 e1                	add    %ah,%cl
+  803f69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f6f:	00 e1                	add    %ah,%cl
+  803f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f77:	00 e1                	add    %ah,%cl
+  803f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f7f:	00 e1                	add    %ah,%cl
+  803f81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f87:	00 e1                	add    %ah,%cl
+  803f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f8f:	00 e1                	add    %ah,%cl
+  803f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803f97:	00 c9                	add    %cl,%cl
+  803f99:	0f 80 00 00 00 00    	jo     803f9f <__rodata_start+0x3d7>
+  803f9f:	00 c9                	add    %cl,%cl
+  803fa1:	0f 80 00 00 00 00    	jo     803fa7 <__rodata_start+0x3df>
+  803fa7:	00 c9                	add    %cl,%cl
+  803fa9:	0f 80 00 00 00 00    	jo     803faf <__rodata_start+0x3e7>
+  803faf:	00 c9                	add    %cl,%cl
+  803fb1:	0f 80 00 00 00 00    	jo     803fb7 <__rodata_start+0x3ef>
+  803fb7:	00 c9                	add    %cl,%cl
+  803fb9:	0f 80 00 00 00 00    	jo     803fbf <__rodata_start+0x3f7>
+  803fbf:	00 c9                	add    %cl,%cl
+  803fc1:	0f 80 00 00 00 00    	jo     803fc7 <__rodata_start+0x3ff>
+  803fc7:	00 c9                	add    %cl,%cl
+  803fc9:	0f 80 00 00 00 00    	jo     803fcf <__rodata_start+0x407>
+  803fcf:	00 c9                	add    %cl,%cl
+  803fd1:	0f 80 00 00 00 00    	jo     803fd7 <__rodata_start+0x40f>
+  803fd7:	00 c9                	add    %cl,%cl
+  803fd9:	0f 80 00 00 00 00    	jo     803fdf <__rodata_start+0x417>
+  803fdf:	00 c9                	add    %cl,%cl
+  803fe1:	0f 80 00 00 00 00    	jo     803fe7 <__rodata_start+0x41f>
+  803fe7:	00 c9                	add    %cl,%cl
+  803fe9:	0f 80 00 00 00 00    	jo     803fef <__rodata_start+0x427>
+  803fef:	00 c9                	add    %cl,%cl
+  803ff1:	0f 80 00 00 00 00    	jo     803ff7 <__rodata_start+0x42f>
+  803ff7:	00 c9                	add    %cl,%cl
+  803ff9:	0f 80 00 00 00 00    	jo     803fff <__rodata_start+0x437>
+  803fff:	00 c9                	add    %cl,%cl
+  804001:	0f 80 00 00 00 00    	jo     804007 <__rodata_start+0x43f>
+  804007:	00 c9                	add    %cl,%cl
+  804009:	0f 80 00 00 00 00    	jo     80400f <__rodata_start+0x447>
+  80400f:	00 c9                	add    %cl,%cl
+  804011:	0f 80 00 00 00 00    	jo     804017 <__rodata_start+0x44f>
+  804017:	00 c9                	add    %cl,%cl
+  804019:	0f 80 00 00 00 00    	jo     80401f <__rodata_start+0x457>
+  80401f:	00 c9                	add    %cl,%cl
+  804021:	0f 80 00 00 00 00    	jo     804027 <__rodata_start+0x45f>
+  804027:	00 c9                	add    %cl,%cl
+  804029:	0f 80 00 00 00 00    	jo     80402f <__rodata_start+0x467>
+  80402f:	00 c9                	add    %cl,%cl
+  804031:	0f 80 00 00 00 00    	jo     804037 <__rodata_start+0x46f>
+  804037:	00 c9                	add    %cl,%cl
+  804039:	0f 80 00 00 00 00    	jo     80403f <__rodata_start+0x477>
+  80403f:	00 c9                	add    %cl,%cl
+  804041:	0f 80 00 00 00 00    	jo     804047 <__rodata_start+0x47f>
+  804047:	00 c9                	add    %cl,%cl
+  804049:	0f 80 00 00 00 00    	jo     80404f <__rodata_start+0x487>
+  80404f:	00 c9                	add    %cl,%cl
+  804051:	0f 80 00 00 00 00    	jo     804057 <__rodata_start+0x48f>
+  804057:	00 c9                	add    %cl,%cl
+  804059:	0f 80 00 00 00 00    	jo     80405f <__rodata_start+0x497>
+  80405f:	00 c9                	add    %cl,%cl
+  804061:	0f 80 00 00 00 00    	jo     804067 <__rodata_start+0x49f>
+  804067:	00 c9                	add    %cl,%cl
+  804069:	0f 80 00 00 00 00    	jo     80406f <__rodata_start+0x4a7>
+  80406f:	00 c9                	add    %cl,%cl
+  804071:	0f 80 00 00 00 00    	jo     804077 <__rodata_start+0x4af>
+  804077:	00 c9                	add    %cl,%cl
+  804079:	0f 80 00 00 00 00    	jo     80407f <__rodata_start+0x4b7>
+  80407f:	00 c9                	add    %cl,%cl
+  804081:	0f 80 00 00 00 00    	jo     804087 <__rodata_start+0x4bf>
+  804087:	00 ec                	add    %ch,%ah
+  804089:	0e                   	(bad)
+  80408a:	80 00 00             	addb   $0x0,(%rax)
+  80408d:	00 00                	add    %al,(%rax)
+  80408f:	00 c9                	add    %cl,%cl
+  804091:	0f 80 00 00 00 00    	jo     804097 <__rodata_start+0x4cf>
+  804097:	00 c9                	add    %cl,%cl
+  804099:	0f 80 00 00 00 00    	jo     80409f <__rodata_start+0x4d7>
+  80409f:	00 c9                	add    %cl,%cl
+  8040a1:	0f 80 00 00 00 00    	jo     8040a7 <__rodata_start+0x4df>
+  8040a7:	00 c9                	add    %cl,%cl
+  8040a9:	0f 80 00 00 00 00    	jo     8040af <__rodata_start+0x4e7>
+  8040af:	00 c9                	add    %cl,%cl
+  8040b1:	0f 80 00 00 00 00    	jo     8040b7 <__rodata_start+0x4ef>
+  8040b7:	00 c9                	add    %cl,%cl
+  8040b9:	0f 80 00 00 00 00    	jo     8040bf <__rodata_start+0x4f7>
+  8040bf:	00 c9                	add    %cl,%cl
+  8040c1:	0f 80 00 00 00 00    	jo     8040c7 <__rodata_start+0x4ff>
+  8040c7:	00 c9                	add    %cl,%cl
+  8040c9:	0f 80 00 00 00 00    	jo     8040cf <__rodata_start+0x507>
+  8040cf:	00 c9                	add    %cl,%cl
+  8040d1:	0f 80 00 00 00 00    	jo     8040d7 <__rodata_start+0x50f>
+  8040d7:	00 c9                	add    %cl,%cl
+  8040d9:	0f 80 00 00 00 00    	jo     8040df <__rodata_start+0x517>
+  8040df:	00 38                	add    %bh,(%rax)
+  8040e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8040e7:	00 07                	add    %al,(%rdi)
+  8040e9:	0c 80                	or     $0x80,%al
+  8040eb:	00 00                	add    %al,(%rax)
+  8040ed:	00 00                	add    %al,(%rax)
+  8040ef:	00 c9                	add    %cl,%cl
+  8040f1:	0f 80 00 00 00 00    	jo     8040f7 <__rodata_start+0x52f>
+  8040f7:	00 c9                	add    %cl,%cl
+  8040f9:	0f 80 00 00 00 00    	jo     8040ff <__rodata_start+0x537>
+  8040ff:	00 c9                	add    %cl,%cl
+  804101:	0f 80 00 00 00 00    	jo     804107 <__rodata_start+0x53f>
+  804107:	00 c9                	add    %cl,%cl
+  804109:	0f 80 00 00 00 00    	jo     80410f <__rodata_start+0x547>
+  80410f:	00 67 0a             	add    %ah,0xa(%rdi)
+  804112:	80 00 00             	addb   $0x0,(%rax)
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 c9                	add    %cl,%cl
+  804119:	0f 80 00 00 00 00    	jo     80411f <__rodata_start+0x557>
+  80411f:	00 c9                	add    %cl,%cl
+  804121:	0f 80 00 00 00 00    	jo     804127 <__rodata_start+0x55f>
+  804127:	00 2d 0a 80 00 00    	add    %ch,0x800a(%rip)        # 80c137 <__bss_end+0x3137>
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 c9                	add    %cl,%cl
+  804131:	0f 80 00 00 00 00    	jo     804137 <__rodata_start+0x56f>
+  804137:	00 c9                	add    %cl,%cl
+  804139:	0f 80 00 00 00 00    	jo     80413f <__rodata_start+0x577>
+  80413f:	00 af 0d 80 00 00    	add    %ch,0x800d(%rdi)
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 79 0e             	add    %bh,0xe(%rcx)
+  80414a:	80 00 00             	addb   $0x0,(%rax)
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 c9                	add    %cl,%cl
+  804151:	0f 80 00 00 00 00    	jo     804157 <__rodata_start+0x58f>
+  804157:	00 c9                	add    %cl,%cl
+  804159:	0f 80 00 00 00 00    	jo     80415f <__rodata_start+0x597>
+  80415f:	00 fe                	add    %bh,%dh
+  804161:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804167:	00 c9                	add    %cl,%cl
+  804169:	0f 80 00 00 00 00    	jo     80416f <__rodata_start+0x5a7>
+  80416f:	00 db                	add    %bl,%bl
+  804171:	0c 80                	or     $0x80,%al
+  804173:	00 00                	add    %al,(%rax)
+  804175:	00 00                	add    %al,(%rax)
+  804177:	00 c9                	add    %cl,%cl
+  804179:	0f 80 00 00 00 00    	jo     80417f <__rodata_start+0x5b7>
+  80417f:	00 c9                	add    %cl,%cl
+  804181:	0f 80 00 00 00 00    	jo     804187 <__rodata_start+0x5bf>
+  804187:	00 ec                	add    %ch,%ah
+  804189:	0e                   	(bad)
+  80418a:	80 00 00             	addb   $0x0,(%rax)
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 c9                	add    %cl,%cl
+  804191:	0f 80 00 00 00 00    	jo     804197 <__rodata_start+0x5cf>
+  804197:	00 91 09 80 00 00    	add    %dl,0x8009(%rcx)
+  80419d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008041a0 <error_string>:
+	...
+  8041a8:	75 3d 80 00 00 00 00 00 87 3d 80 00 00 00 00 00     u=.......=......
+  8041b8:	97 3d 80 00 00 00 00 00 a9 3d 80 00 00 00 00 00     .=.......=......
+  8041c8:	b7 3d 80 00 00 00 00 00 cb 3d 80 00 00 00 00 00     .=.......=......
+  8041d8:	e0 3d 80 00 00 00 00 00 f3 3d 80 00 00 00 00 00     .=.......=......
+  8041e8:	05 3e 80 00 00 00 00 00 19 3e 80 00 00 00 00 00     .>.......>......
+  8041f8:	29 3e 80 00 00 00 00 00 3c 3e 80 00 00 00 00 00     )>......<>......
+  804208:	53 3e 80 00 00 00 00 00 69 3e 80 00 00 00 00 00     S>......i>......
+  804218:	81 3e 80 00 00 00 00 00 99 3e 80 00 00 00 00 00     .>.......>......
+  804228:	a6 3e 80 00 00 00 00 00 48 42 80 00 00 00 00 00     .>......HB......
+  804238:	ba 3e 80 00 00 00 00 00 d2 3e 80 00 00 00 00 00     .>.......>......
+  804248:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804258:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804268:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804278:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804288:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804298:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8042a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8042b8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  8042c8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  8042d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8042e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8042f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804308:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804318:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804328:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804338:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804340 <devtab>:
+  804340:	e0 50 80 00 00 00 00 00 80 51 80 00 00 00 00 00     .P.......Q......
+  804350:	20 52 80 00 00 00 00 00 00 00 00 00 00 00 00 00      R..............
+  804360:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804370:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804380:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804390:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8043a0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  8043b0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8043c0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8043d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
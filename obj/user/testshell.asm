@@ -0,0 +1,8545 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 30 07 00 00       	call   800753 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf 28 24 80 00 00 	movabs $0x802428,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf 58 46 80 00 00 	movabs $0x804658,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 74 09 80 00 00 	movabs $0x800974,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf cb 46 80 00 00 	movabs $0x8046cb,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 75 21 80 00 00 	movabs $0x802175,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be 9c 17 80 00 00 	movabs $0x80179c,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf dc 46 80 00 00 	movabs $0x8046dc,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 75 21 80 00 00 	movabs $0x802175,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd 9c 17 80 00 00 	movabs $0x80179c,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf ec 46 80 00 00 	movabs $0x8046ec,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb f7 1f 80 00 00 	movabs $0x801ff7,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb ec 06 80 00 00 	movabs $0x8006ec,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf f1 46 80 00 00 	movabs $0x8046f1,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 53 01 00 00    	js     800310 <umain+0x1af>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 4b 3f 80 00 00 	movabs $0x803f4b,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 68 01 00 00    	js     80033d <umain+0x1dc>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf 80 46 80 00 00 	movabs $0x804680,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 62 01 00 00    	js     80036a <umain+0x209>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd 52 20 80 00 00 	movabs $0x802052,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd f7 1f 80 00 00 	movabs $0x801ff7,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba 37 47 80 00 00 	movabs $0x804737,%rdx
+  80024e:	00 00 00 
+  800251:	48 be fb 46 80 00 00 	movabs $0x8046fb,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf 3a 47 80 00 00 	movabs $0x80473a,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 af 3b 80 00 00 	movabs $0x803baf,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 15 01 00 00    	js     800397 <umain+0x236>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be f7 1f 80 00 00 	movabs $0x801ff7,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 aa 41 80 00 00 	movabs $0x8041aa,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb f7 1f 80 00 00 	movabs $0x801ff7,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf 48 47 80 00 00 	movabs $0x804748,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 d0 00 00 00    	js     8003c4 <umain+0x263>
+    nloff = 0;
+  8002f4:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+    for (off = 0;; off++) {
+  8002fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  800301:	49 bd 75 21 80 00 00 	movabs $0x802175,%r13
+  800308:	00 00 00 
+  80030b:	e9 62 01 00 00       	jmp    800472 <umain+0x311>
+        panic("open testshell.sh: %i", rfd);
+  800310:	89 c1                	mov    %eax,%ecx
+  800312:	48 ba fe 46 80 00 00 	movabs $0x8046fe,%rdx
+  800319:	00 00 00 
+  80031c:	be 12 00 00 00       	mov    $0x12,%esi
+  800321:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  800328:	00 00 00 
+  80032b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800330:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  800337:	00 00 00 
+  80033a:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  80033d:	89 c1                	mov    %eax,%ecx
+  80033f:	48 ba 25 47 80 00 00 	movabs $0x804725,%rdx
+  800346:	00 00 00 
+  800349:	be 14 00 00 00       	mov    $0x14,%esi
+  80034e:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  800355:	00 00 00 
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  800364:	00 00 00 
+  800367:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80036a:	89 c1                	mov    %eax,%ecx
+  80036c:	48 ba 2e 47 80 00 00 	movabs $0x80472e,%rdx
+  800373:	00 00 00 
+  800376:	be 19 00 00 00       	mov    $0x19,%esi
+  80037b:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  800382:	00 00 00 
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  800391:	00 00 00 
+  800394:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800397:	89 c1                	mov    %eax,%ecx
+  800399:	48 ba 3e 47 80 00 00 	movabs $0x80473e,%rdx
+  8003a0:	00 00 00 
+  8003a3:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a8:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  8003af:	00 00 00 
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  8003be:	00 00 00 
+  8003c1:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003c4:	89 c1                	mov    %eax,%ecx
+  8003c6:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  8003cd:	00 00 00 
+  8003d0:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d5:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  8003dc:	00 00 00 
+  8003df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e4:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  8003eb:	00 00 00 
+  8003ee:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003f1:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003f4:	48 ba 56 47 80 00 00 	movabs $0x804756,%rdx
+  8003fb:	00 00 00 
+  8003fe:	be 32 00 00 00       	mov    $0x32,%esi
+  800403:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  80040a:	00 00 00 
+  80040d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800412:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  800419:	00 00 00 
+  80041c:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  80041f:	48 ba 70 47 80 00 00 	movabs $0x804770,%rdx
+  800426:	00 00 00 
+  800429:	be 34 00 00 00       	mov    $0x34,%esi
+  80042e:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  800435:	00 00 00 
+  800438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043d:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  800444:	00 00 00 
+  800447:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  80044a:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  80044e:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  800453:	44 89 e2             	mov    %r12d,%edx
+  800456:	44 89 f6             	mov    %r14d,%esi
+  800459:	44 89 ff             	mov    %r15d,%edi
+  80045c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800463:	00 00 00 
+  800466:	ff d0                	call   *%rax
+        if (c1 == '\n')
+  800468:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80046c:	74 55                	je     8004c3 <umain+0x362>
+    for (off = 0;; off++) {
+  80046e:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800472:	ba 01 00 00 00       	mov    $0x1,%edx
+  800477:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80047b:	44 89 ff             	mov    %r15d,%edi
+  80047e:	41 ff d5             	call   *%r13
+  800481:	48 89 c3             	mov    %rax,%rbx
+  800484:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  800487:	ba 01 00 00 00       	mov    $0x1,%edx
+  80048c:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800490:	44 89 f7             	mov    %r14d,%edi
+  800493:	41 ff d5             	call   *%r13
+  800496:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  800498:	85 db                	test   %ebx,%ebx
+  80049a:	0f 88 51 ff ff ff    	js     8003f1 <umain+0x290>
+        if (n2 < 0)
+  8004a0:	85 c0                	test   %eax,%eax
+  8004a2:	0f 88 77 ff ff ff    	js     80041f <umain+0x2be>
+        if (n1 == 0 && n2 == 0)
+  8004a8:	89 c2                	mov    %eax,%edx
+  8004aa:	09 da                	or     %ebx,%edx
+  8004ac:	74 1f                	je     8004cd <umain+0x36c>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  8004ae:	83 fb 01             	cmp    $0x1,%ebx
+  8004b1:	75 97                	jne    80044a <umain+0x2e9>
+  8004b3:	83 f8 01             	cmp    $0x1,%eax
+  8004b6:	75 92                	jne    80044a <umain+0x2e9>
+  8004b8:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004bc:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004bf:	75 89                	jne    80044a <umain+0x2e9>
+  8004c1:	eb a5                	jmp    800468 <umain+0x307>
+            nloff = off + 1;
+  8004c3:	41 8d 44 24 01       	lea    0x1(%r12),%eax
+  8004c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cb:	eb a1                	jmp    80046e <umain+0x30d>
+    if (nloff < -100) {
+  8004cd:	83 7d b8 9c          	cmpl   $0xffffff9c,-0x48(%rbp)
+  8004d1:	7c 2b                	jl     8004fe <umain+0x39d>
+    cprintf("shell ran correctly\n");
+  8004d3:	48 bf 9d 47 80 00 00 	movabs $0x80479d,%rdi
+  8004da:	00 00 00 
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8004e9:	00 00 00 
+  8004ec:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004ee:	cc                   	int3
+}
+  8004ef:	48 83 c4 28          	add    $0x28,%rsp
+  8004f3:	5b                   	pop    %rbx
+  8004f4:	41 5c                	pop    %r12
+  8004f6:	41 5d                	pop    %r13
+  8004f8:	41 5e                	pop    %r14
+  8004fa:	41 5f                	pop    %r15
+  8004fc:	5d                   	pop    %rbp
+  8004fd:	c3                   	ret
+        panic("STUB FOR COMPILER\n");
+  8004fe:	48 ba 8a 47 80 00 00 	movabs $0x80478a,%rdx
+  800505:	00 00 00 
+  800508:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80050d:	48 bf 14 47 80 00 00 	movabs $0x804714,%rdi
+  800514:	00 00 00 
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	48 b9 24 08 80 00 00 	movabs $0x800824,%rcx
+  800523:	00 00 00 
+  800526:	ff d1                	call   *%rcx
+
+0000000000800528 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052d:	c3                   	ret
+
+000000000080052e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80052e:	55                   	push   %rbp
+  80052f:	48 89 e5             	mov    %rsp,%rbp
+  800532:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800535:	48 be b2 47 80 00 00 	movabs $0x8047b2,%rsi
+  80053c:	00 00 00 
+  80053f:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+    return 0;
+}
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	5d                   	pop    %rbp
+  800551:	c3                   	ret
+
+0000000000800552 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800552:	55                   	push   %rbp
+  800553:	48 89 e5             	mov    %rsp,%rbp
+  800556:	41 57                	push   %r15
+  800558:	41 56                	push   %r14
+  80055a:	41 55                	push   %r13
+  80055c:	41 54                	push   %r12
+  80055e:	53                   	push   %rbx
+  80055f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800566:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80056d:	48 85 d2             	test   %rdx,%rdx
+  800570:	74 7a                	je     8005ec <devcons_write+0x9a>
+  800572:	49 89 d6             	mov    %rdx,%r14
+  800575:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80057b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800580:	49 bf 93 14 80 00 00 	movabs $0x801493,%r15
+  800587:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80058a:	4c 89 f3             	mov    %r14,%rbx
+  80058d:	48 29 f3             	sub    %rsi,%rbx
+  800590:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800595:	48 39 c3             	cmp    %rax,%rbx
+  800598:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80059c:	4c 63 eb             	movslq %ebx,%r13
+  80059f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8005a6:	48 01 c6             	add    %rax,%rsi
+  8005a9:	4c 89 ea             	mov    %r13,%rdx
+  8005ac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8005b3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8005b6:	4c 89 ee             	mov    %r13,%rsi
+  8005b9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8005c0:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  8005c7:	00 00 00 
+  8005ca:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8005cc:	41 01 dc             	add    %ebx,%r12d
+  8005cf:	49 63 f4             	movslq %r12d,%rsi
+  8005d2:	4c 39 f6             	cmp    %r14,%rsi
+  8005d5:	72 b3                	jb     80058a <devcons_write+0x38>
+    return res;
+  8005d7:	49 63 c4             	movslq %r12d,%rax
+}
+  8005da:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8005e1:	5b                   	pop    %rbx
+  8005e2:	41 5c                	pop    %r12
+  8005e4:	41 5d                	pop    %r13
+  8005e6:	41 5e                	pop    %r14
+  8005e8:	41 5f                	pop    %r15
+  8005ea:	5d                   	pop    %rbp
+  8005eb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005f2:	eb e3                	jmp    8005d7 <devcons_write+0x85>
+
+00000000008005f4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005f4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fc:	48 85 c0             	test   %rax,%rax
+  8005ff:	74 55                	je     800656 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800601:	55                   	push   %rbp
+  800602:	48 89 e5             	mov    %rsp,%rbp
+  800605:	41 55                	push   %r13
+  800607:	41 54                	push   %r12
+  800609:	53                   	push   %rbx
+  80060a:	48 83 ec 08          	sub    $0x8,%rsp
+  80060e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800611:	48 bb c9 17 80 00 00 	movabs $0x8017c9,%rbx
+  800618:	00 00 00 
+  80061b:	49 bc 96 18 80 00 00 	movabs $0x801896,%r12
+  800622:	00 00 00 
+  800625:	eb 03                	jmp    80062a <devcons_read+0x36>
+  800627:	41 ff d4             	call   *%r12
+  80062a:	ff d3                	call   *%rbx
+  80062c:	85 c0                	test   %eax,%eax
+  80062e:	74 f7                	je     800627 <devcons_read+0x33>
+    if (c < 0) return c;
+  800630:	48 63 d0             	movslq %eax,%rdx
+  800633:	78 13                	js     800648 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063a:	83 f8 04             	cmp    $0x4,%eax
+  80063d:	74 09                	je     800648 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80063f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800643:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800648:	48 89 d0             	mov    %rdx,%rax
+  80064b:	48 83 c4 08          	add    $0x8,%rsp
+  80064f:	5b                   	pop    %rbx
+  800650:	41 5c                	pop    %r12
+  800652:	41 5d                	pop    %r13
+  800654:	5d                   	pop    %rbp
+  800655:	c3                   	ret
+  800656:	48 89 d0             	mov    %rdx,%rax
+  800659:	c3                   	ret
+
+000000000080065a <cputchar>:
+cputchar(int ch) {
+  80065a:	55                   	push   %rbp
+  80065b:	48 89 e5             	mov    %rsp,%rbp
+  80065e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800662:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800666:	be 01 00 00 00       	mov    $0x1,%esi
+  80066b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80066f:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  800676:	00 00 00 
+  800679:	ff d0                	call   *%rax
+}
+  80067b:	c9                   	leave
+  80067c:	c3                   	ret
+
+000000000080067d <getchar>:
+getchar(void) {
+  80067d:	55                   	push   %rbp
+  80067e:	48 89 e5             	mov    %rsp,%rbp
+  800681:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800685:	ba 01 00 00 00       	mov    $0x1,%edx
+  80068a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80068e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800693:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  80069a:	00 00 00 
+  80069d:	ff d0                	call   *%rax
+  80069f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8006a1:	85 c0                	test   %eax,%eax
+  8006a3:	78 06                	js     8006ab <getchar+0x2e>
+  8006a5:	74 08                	je     8006af <getchar+0x32>
+  8006a7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8006ab:	89 d0                	mov    %edx,%eax
+  8006ad:	c9                   	leave
+  8006ae:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8006af:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8006b4:	eb f5                	jmp    8006ab <getchar+0x2e>
+
+00000000008006b6 <iscons>:
+iscons(int fdnum) {
+  8006b6:	55                   	push   %rbp
+  8006b7:	48 89 e5             	mov    %rsp,%rbp
+  8006ba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8006be:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8006c2:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  8006c9:	00 00 00 
+  8006cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8006ce:	85 c0                	test   %eax,%eax
+  8006d0:	78 18                	js     8006ea <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8006d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006d6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8006dd:	00 00 00 
+  8006e0:	8b 00                	mov    (%rax),%eax
+  8006e2:	39 02                	cmp    %eax,(%rdx)
+  8006e4:	0f 94 c0             	sete   %al
+  8006e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8006ea:	c9                   	leave
+  8006eb:	c3                   	ret
+
+00000000008006ec <opencons>:
+opencons(void) {
+  8006ec:	55                   	push   %rbp
+  8006ed:	48 89 e5             	mov    %rsp,%rbp
+  8006f0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006f4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006f8:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  8006ff:	00 00 00 
+  800702:	ff d0                	call   *%rax
+  800704:	85 c0                	test   %eax,%eax
+  800706:	78 49                	js     800751 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800708:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80070d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800712:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800716:	bf 00 00 00 00       	mov    $0x0,%edi
+  80071b:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  800722:	00 00 00 
+  800725:	ff d0                	call   *%rax
+  800727:	85 c0                	test   %eax,%eax
+  800729:	78 26                	js     800751 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80072b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80072f:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800736:	00 00 
+  800738:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80073a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80073e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800745:	48 b8 04 1e 80 00 00 	movabs $0x801e04,%rax
+  80074c:	00 00 00 
+  80074f:	ff d0                	call   *%rax
+}
+  800751:	c9                   	leave
+  800752:	c3                   	ret
+
+0000000000800753 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800753:	55                   	push   %rbp
+  800754:	48 89 e5             	mov    %rsp,%rbp
+  800757:	41 56                	push   %r14
+  800759:	41 55                	push   %r13
+  80075b:	41 54                	push   %r12
+  80075d:	53                   	push   %rbx
+  80075e:	41 89 fd             	mov    %edi,%r13d
+  800761:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800764:	48 ba d8 61 80 00 00 	movabs $0x8061d8,%rdx
+  80076b:	00 00 00 
+  80076e:	48 b8 d8 61 80 00 00 	movabs $0x8061d8,%rax
+  800775:	00 00 00 
+  800778:	48 39 c2             	cmp    %rax,%rdx
+  80077b:	73 17                	jae    800794 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80077d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800780:	49 89 c4             	mov    %rax,%r12
+  800783:	48 83 c3 08          	add    $0x8,%rbx
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	ff 53 f8             	call   *-0x8(%rbx)
+  80078f:	4c 39 e3             	cmp    %r12,%rbx
+  800792:	72 ef                	jb     800783 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800794:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  80079b:	00 00 00 
+  80079e:	ff d0                	call   *%rax
+  8007a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8007a5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8007a9:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8007ad:	48 c1 e0 04          	shl    $0x4,%rax
+  8007b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8007b8:	00 00 00 
+  8007bb:	48 01 d0             	add    %rdx,%rax
+  8007be:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8007c5:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8007c8:	45 85 ed             	test   %r13d,%r13d
+  8007cb:	7e 0d                	jle    8007da <libmain+0x87>
+  8007cd:	49 8b 06             	mov    (%r14),%rax
+  8007d0:	48 a3 98 60 80 00 00 	movabs %rax,0x806098
+  8007d7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8007da:	4c 89 f6             	mov    %r14,%rsi
+  8007dd:	44 89 ef             	mov    %r13d,%edi
+  8007e0:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8007e7:	00 00 00 
+  8007ea:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8007ec:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  8007f3:	00 00 00 
+  8007f6:	ff d0                	call   *%rax
+#endif
+}
+  8007f8:	5b                   	pop    %rbx
+  8007f9:	41 5c                	pop    %r12
+  8007fb:	41 5d                	pop    %r13
+  8007fd:	41 5e                	pop    %r14
+  8007ff:	5d                   	pop    %rbp
+  800800:	c3                   	ret
+
+0000000000800801 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800801:	55                   	push   %rbp
+  800802:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800805:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  80080c:	00 00 00 
+  80080f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800811:	bf 00 00 00 00       	mov    $0x0,%edi
+  800816:	48 b8 fa 17 80 00 00 	movabs $0x8017fa,%rax
+  80081d:	00 00 00 
+  800820:	ff d0                	call   *%rax
+}
+  800822:	5d                   	pop    %rbp
+  800823:	c3                   	ret
+
+0000000000800824 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800824:	55                   	push   %rbp
+  800825:	48 89 e5             	mov    %rsp,%rbp
+  800828:	41 56                	push   %r14
+  80082a:	41 55                	push   %r13
+  80082c:	41 54                	push   %r12
+  80082e:	53                   	push   %rbx
+  80082f:	48 83 ec 50          	sub    $0x50,%rsp
+  800833:	49 89 fc             	mov    %rdi,%r12
+  800836:	41 89 f5             	mov    %esi,%r13d
+  800839:	48 89 d3             	mov    %rdx,%rbx
+  80083c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800840:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800844:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800848:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80084f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800853:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800857:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80085b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80085f:	48 b8 98 60 80 00 00 	movabs $0x806098,%rax
+  800866:	00 00 00 
+  800869:	4c 8b 30             	mov    (%rax),%r14
+  80086c:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  800873:	00 00 00 
+  800876:	ff d0                	call   *%rax
+  800878:	89 c6                	mov    %eax,%esi
+  80087a:	45 89 e8             	mov    %r13d,%r8d
+  80087d:	4c 89 e1             	mov    %r12,%rcx
+  800880:	4c 89 f2             	mov    %r14,%rdx
+  800883:	48 bf c8 47 80 00 00 	movabs $0x8047c8,%rdi
+  80088a:	00 00 00 
+  80088d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800892:	49 bc 74 09 80 00 00 	movabs $0x800974,%r12
+  800899:	00 00 00 
+  80089c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80089f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8008a3:	48 89 df             	mov    %rbx,%rdi
+  8008a6:	48 b8 10 09 80 00 00 	movabs $0x800910,%rax
+  8008ad:	00 00 00 
+  8008b0:	ff d0                	call   *%rax
+    cprintf("\n");
+  8008b2:	48 bf ef 46 80 00 00 	movabs $0x8046ef,%rdi
+  8008b9:	00 00 00 
+  8008bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8008c4:	cc                   	int3
+  8008c5:	eb fd                	jmp    8008c4 <_panic+0xa0>
+
+00000000008008c7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8008c7:	55                   	push   %rbp
+  8008c8:	48 89 e5             	mov    %rsp,%rbp
+  8008cb:	53                   	push   %rbx
+  8008cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8008d0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8008d3:	8b 06                	mov    (%rsi),%eax
+  8008d5:	8d 50 01             	lea    0x1(%rax),%edx
+  8008d8:	89 16                	mov    %edx,(%rsi)
+  8008da:	48 98                	cltq
+  8008dc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8008e1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8008e7:	74 0a                	je     8008f3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8008e9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8008ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008f3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008f7:	be ff 00 00 00       	mov    $0xff,%esi
+  8008fc:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  800903:	00 00 00 
+  800906:	ff d0                	call   *%rax
+        state->offset = 0;
+  800908:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80090e:	eb d9                	jmp    8008e9 <putch+0x22>
+
+0000000000800910 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800910:	55                   	push   %rbp
+  800911:	48 89 e5             	mov    %rsp,%rbp
+  800914:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80091b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80091e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800925:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80092a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800932:	48 89 f1             	mov    %rsi,%rcx
+  800935:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80093c:	48 bf c7 08 80 00 00 	movabs $0x8008c7,%rdi
+  800943:	00 00 00 
+  800946:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  80094d:	00 00 00 
+  800950:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800952:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800959:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800960:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  800967:	00 00 00 
+  80096a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80096c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800972:	c9                   	leave
+  800973:	c3                   	ret
+
+0000000000800974 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800974:	55                   	push   %rbp
+  800975:	48 89 e5             	mov    %rsp,%rbp
+  800978:	48 83 ec 50          	sub    $0x50,%rsp
+  80097c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800980:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800984:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800988:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80098c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800990:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800997:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80099b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8009a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8009a7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8009ab:	48 b8 10 09 80 00 00 	movabs $0x800910,%rax
+  8009b2:	00 00 00 
+  8009b5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8009b7:	c9                   	leave
+  8009b8:	c3                   	ret
+
+00000000008009b9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8009b9:	55                   	push   %rbp
+  8009ba:	48 89 e5             	mov    %rsp,%rbp
+  8009bd:	41 57                	push   %r15
+  8009bf:	41 56                	push   %r14
+  8009c1:	41 55                	push   %r13
+  8009c3:	41 54                	push   %r12
+  8009c5:	53                   	push   %rbx
+  8009c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8009ca:	49 89 fc             	mov    %rdi,%r12
+  8009cd:	49 89 f5             	mov    %rsi,%r13
+  8009d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8009d4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8009d7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8009da:	41 89 cf             	mov    %ecx,%r15d
+  8009dd:	4c 39 fa             	cmp    %r15,%rdx
+  8009e0:	73 5b                	jae    800a3d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8009e2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8009e6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8009ea:	85 db                	test   %ebx,%ebx
+  8009ec:	7e 0e                	jle    8009fc <print_num+0x43>
+            putch(padc, put_arg);
+  8009ee:	4c 89 ee             	mov    %r13,%rsi
+  8009f1:	44 89 f7             	mov    %r14d,%edi
+  8009f4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009f7:	83 eb 01             	sub    $0x1,%ebx
+  8009fa:	75 f2                	jne    8009ee <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009fc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800a00:	48 b9 fc 47 80 00 00 	movabs $0x8047fc,%rcx
+  800a07:	00 00 00 
+  800a0a:	48 b8 eb 47 80 00 00 	movabs $0x8047eb,%rax
+  800a11:	00 00 00 
+  800a14:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800a18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a21:	49 f7 f7             	div    %r15
+  800a24:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800a28:	4c 89 ee             	mov    %r13,%rsi
+  800a2b:	41 ff d4             	call   *%r12
+}
+  800a2e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a32:	5b                   	pop    %rbx
+  800a33:	41 5c                	pop    %r12
+  800a35:	41 5d                	pop    %r13
+  800a37:	41 5e                	pop    %r14
+  800a39:	41 5f                	pop    %r15
+  800a3b:	5d                   	pop    %rbp
+  800a3c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800a3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a46:	49 f7 f7             	div    %r15
+  800a49:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a51:	52                   	push   %rdx
+  800a52:	45 0f be c9          	movsbl %r9b,%r9d
+  800a56:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a5a:	48 89 c2             	mov    %rax,%rdx
+  800a5d:	48 b8 b9 09 80 00 00 	movabs $0x8009b9,%rax
+  800a64:	00 00 00 
+  800a67:	ff d0                	call   *%rax
+  800a69:	48 83 c4 10          	add    $0x10,%rsp
+  800a6d:	eb 8d                	jmp    8009fc <print_num+0x43>
+
+0000000000800a6f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a6f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a73:	48 8b 06             	mov    (%rsi),%rax
+  800a76:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a7a:	73 0a                	jae    800a86 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a7c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a80:	48 89 16             	mov    %rdx,(%rsi)
+  800a83:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a86:	c3                   	ret
+
+0000000000800a87 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a87:	55                   	push   %rbp
+  800a88:	48 89 e5             	mov    %rsp,%rbp
+  800a8b:	48 83 ec 50          	sub    $0x50,%rsp
+  800a8f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a93:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a97:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a9b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aaa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800ab2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab6:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  800abd:	00 00 00 
+  800ac0:	ff d0                	call   *%rax
+}
+  800ac2:	c9                   	leave
+  800ac3:	c3                   	ret
+
+0000000000800ac4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800ac4:	55                   	push   %rbp
+  800ac5:	48 89 e5             	mov    %rsp,%rbp
+  800ac8:	41 57                	push   %r15
+  800aca:	41 56                	push   %r14
+  800acc:	41 55                	push   %r13
+  800ace:	41 54                	push   %r12
+  800ad0:	53                   	push   %rbx
+  800ad1:	48 83 ec 38          	sub    $0x38,%rsp
+  800ad5:	49 89 fe             	mov    %rdi,%r14
+  800ad8:	49 89 f5             	mov    %rsi,%r13
+  800adb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ade:	48 8b 01             	mov    (%rcx),%rax
+  800ae1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800ae5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800ae9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aed:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800af1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800af5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800af9:	0f b6 3b             	movzbl (%rbx),%edi
+  800afc:	40 80 ff 25          	cmp    $0x25,%dil
+  800b00:	74 18                	je     800b1a <vprintfmt+0x56>
+            if (!ch) return;
+  800b02:	40 84 ff             	test   %dil,%dil
+  800b05:	0f 84 b1 06 00 00    	je     8011bc <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800b0b:	40 0f b6 ff          	movzbl %dil,%edi
+  800b0f:	4c 89 ee             	mov    %r13,%rsi
+  800b12:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800b15:	4c 89 e3             	mov    %r12,%rbx
+  800b18:	eb db                	jmp    800af5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800b1a:	be 00 00 00 00       	mov    $0x0,%esi
+  800b1f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800b23:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800b28:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b2e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800b35:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b39:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800b3e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800b43:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b46:	83 e8 23             	sub    $0x23,%eax
+  800b49:	3c 57                	cmp    $0x57,%al
+  800b4b:	0f 87 51 06 00 00    	ja     8011a2 <vprintfmt+0x6de>
+  800b51:	0f b6 c0             	movzbl %al,%eax
+  800b54:	48 b9 a0 49 80 00 00 	movabs $0x8049a0,%rcx
+  800b5b:	00 00 00 
+  800b5e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b61:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b64:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b68:	eb cf                	jmp    800b39 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b6a:	49 89 dc             	mov    %rbx,%r12
+  800b6d:	be 01 00 00 00       	mov    $0x1,%esi
+  800b72:	eb c5                	jmp    800b39 <vprintfmt+0x75>
+            padc = ch;
+  800b74:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b78:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b7b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b7e:	eb b9                	jmp    800b39 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b83:	83 f8 2f             	cmp    $0x2f,%eax
+  800b86:	77 24                	ja     800bac <vprintfmt+0xe8>
+  800b88:	89 c1                	mov    %eax,%ecx
+  800b8a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b8e:	83 c0 08             	add    $0x8,%eax
+  800b91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b94:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b97:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b9a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b9e:	79 99                	jns    800b39 <vprintfmt+0x75>
+                width = precision;
+  800ba0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800ba4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800baa:	eb 8d                	jmp    800b39 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800bac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bb0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800bb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb8:	eb da                	jmp    800b94 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800bba:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800bbf:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bc3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800bc9:	3c 39                	cmp    $0x39,%al
+  800bcb:	77 1c                	ja     800be9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800bcd:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800bd1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800bd5:	0f b6 c0             	movzbl %al,%eax
+  800bd8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bdd:	0f b6 03             	movzbl (%rbx),%eax
+  800be0:	3c 39                	cmp    $0x39,%al
+  800be2:	76 e9                	jbe    800bcd <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800be4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800be7:	eb b1                	jmp    800b9a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800be9:	49 89 dc             	mov    %rbx,%r12
+  800bec:	eb ac                	jmp    800b9a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800bee:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800bf1:	85 c9                	test   %ecx,%ecx
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	0f 49 c1             	cmovns %ecx,%eax
+  800bfb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bfe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c01:	e9 33 ff ff ff       	jmp    800b39 <vprintfmt+0x75>
+            lflag++;
+  800c06:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800c09:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c0c:	e9 28 ff ff ff       	jmp    800b39 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c14:	83 f8 2f             	cmp    $0x2f,%eax
+  800c17:	77 19                	ja     800c32 <vprintfmt+0x16e>
+  800c19:	89 c2                	mov    %eax,%edx
+  800c1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1f:	83 c0 08             	add    $0x8,%eax
+  800c22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c25:	8b 3a                	mov    (%rdx),%edi
+  800c27:	4c 89 ee             	mov    %r13,%rsi
+  800c2a:	41 ff d6             	call   *%r14
+            break;
+  800c2d:	e9 c3 fe ff ff       	jmp    800af5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800c32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3e:	eb e5                	jmp    800c25 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800c40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c43:	83 f8 2f             	cmp    $0x2f,%eax
+  800c46:	77 5a                	ja     800ca2 <vprintfmt+0x1de>
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4e:	83 c0 08             	add    $0x8,%eax
+  800c51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c54:	8b 02                	mov    (%rdx),%eax
+  800c56:	89 c1                	mov    %eax,%ecx
+  800c58:	f7 d9                	neg    %ecx
+  800c5a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c5d:	83 f9 14             	cmp    $0x14,%ecx
+  800c60:	7f 4e                	jg     800cb0 <vprintfmt+0x1ec>
+  800c62:	48 63 c1             	movslq %ecx,%rax
+  800c65:	48 ba 60 4c 80 00 00 	movabs $0x804c60,%rdx
+  800c6c:	00 00 00 
+  800c6f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c73:	48 85 c0             	test   %rax,%rax
+  800c76:	74 38                	je     800cb0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c78:	48 89 c1             	mov    %rax,%rcx
+  800c7b:	48 ba 6d 4f 80 00 00 	movabs $0x804f6d,%rdx
+  800c82:	00 00 00 
+  800c85:	4c 89 ee             	mov    %r13,%rsi
+  800c88:	4c 89 f7             	mov    %r14,%rdi
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c90:	49 b8 87 0a 80 00 00 	movabs $0x800a87,%r8
+  800c97:	00 00 00 
+  800c9a:	41 ff d0             	call   *%r8
+  800c9d:	e9 53 fe ff ff       	jmp    800af5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cae:	eb a4                	jmp    800c54 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800cb0:	48 ba 14 48 80 00 00 	movabs $0x804814,%rdx
+  800cb7:	00 00 00 
+  800cba:	4c 89 ee             	mov    %r13,%rsi
+  800cbd:	4c 89 f7             	mov    %r14,%rdi
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc5:	49 b8 87 0a 80 00 00 	movabs $0x800a87,%r8
+  800ccc:	00 00 00 
+  800ccf:	41 ff d0             	call   *%r8
+  800cd2:	e9 1e fe ff ff       	jmp    800af5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cda:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdd:	77 6c                	ja     800d4b <vprintfmt+0x287>
+  800cdf:	89 c2                	mov    %eax,%edx
+  800ce1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce5:	83 c0 08             	add    $0x8,%eax
+  800ce8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ceb:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800cee:	48 85 d2             	test   %rdx,%rdx
+  800cf1:	48 b8 0d 48 80 00 00 	movabs $0x80480d,%rax
+  800cf8:	00 00 00 
+  800cfb:	48 0f 45 c2          	cmovne %rdx,%rax
+  800cff:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800d03:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800d07:	7e 06                	jle    800d0f <vprintfmt+0x24b>
+  800d09:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800d0d:	75 4a                	jne    800d59 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d0f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d13:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d17:	0f b6 00             	movzbl (%rax),%eax
+  800d1a:	84 c0                	test   %al,%al
+  800d1c:	0f 85 9a 00 00 00    	jne    800dbc <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800d22:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d25:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	0f 8e c4 fd ff ff    	jle    800af5 <vprintfmt+0x31>
+  800d31:	4c 89 ee             	mov    %r13,%rsi
+  800d34:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d39:	41 ff d6             	call   *%r14
+  800d3c:	41 83 ec 01          	sub    $0x1,%r12d
+  800d40:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d44:	75 eb                	jne    800d31 <vprintfmt+0x26d>
+  800d46:	e9 aa fd ff ff       	jmp    800af5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d57:	eb 92                	jmp    800ceb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d59:	49 63 f7             	movslq %r15d,%rsi
+  800d5c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d60:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  800d67:	00 00 00 
+  800d6a:	ff d0                	call   *%rax
+  800d6c:	48 89 c2             	mov    %rax,%rdx
+  800d6f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d72:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d74:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d77:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d7a:	85 c0                	test   %eax,%eax
+  800d7c:	7e 91                	jle    800d0f <vprintfmt+0x24b>
+  800d7e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d83:	4c 89 ee             	mov    %r13,%rsi
+  800d86:	44 89 e7             	mov    %r12d,%edi
+  800d89:	41 ff d6             	call   *%r14
+  800d8c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d90:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d93:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d96:	75 eb                	jne    800d83 <vprintfmt+0x2bf>
+  800d98:	e9 72 ff ff ff       	jmp    800d0f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d9d:	0f b6 f8             	movzbl %al,%edi
+  800da0:	4c 89 ee             	mov    %r13,%rsi
+  800da3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800da6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800daa:	49 83 c4 01          	add    $0x1,%r12
+  800dae:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800db4:	84 c0                	test   %al,%al
+  800db6:	0f 84 66 ff ff ff    	je     800d22 <vprintfmt+0x25e>
+  800dbc:	45 85 ff             	test   %r15d,%r15d
+  800dbf:	78 0a                	js     800dcb <vprintfmt+0x307>
+  800dc1:	41 83 ef 01          	sub    $0x1,%r15d
+  800dc5:	0f 88 57 ff ff ff    	js     800d22 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800dcb:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800dcf:	74 cc                	je     800d9d <vprintfmt+0x2d9>
+  800dd1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800dd4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800dd9:	80 fa 5e             	cmp    $0x5e,%dl
+  800ddc:	77 c2                	ja     800da0 <vprintfmt+0x2dc>
+  800dde:	eb bd                	jmp    800d9d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800de0:	40 84 f6             	test   %sil,%sil
+  800de3:	75 26                	jne    800e0b <vprintfmt+0x347>
+    switch (lflag) {
+  800de5:	85 d2                	test   %edx,%edx
+  800de7:	74 59                	je     800e42 <vprintfmt+0x37e>
+  800de9:	83 fa 01             	cmp    $0x1,%edx
+  800dec:	74 7b                	je     800e69 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800dee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df1:	83 f8 2f             	cmp    $0x2f,%eax
+  800df4:	0f 87 96 00 00 00    	ja     800e90 <vprintfmt+0x3cc>
+  800dfa:	89 c2                	mov    %eax,%edx
+  800dfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e00:	83 c0 08             	add    $0x8,%eax
+  800e03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e06:	4c 8b 22             	mov    (%rdx),%r12
+  800e09:	eb 17                	jmp    800e22 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800e0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e11:	77 21                	ja     800e34 <vprintfmt+0x370>
+  800e13:	89 c2                	mov    %eax,%edx
+  800e15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e19:	83 c0 08             	add    $0x8,%eax
+  800e1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800e22:	4d 85 e4             	test   %r12,%r12
+  800e25:	78 7a                	js     800ea1 <vprintfmt+0x3dd>
+            num = i;
+  800e27:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800e2a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800e2f:	e9 50 02 00 00       	jmp    801084 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e40:	eb dd                	jmp    800e1f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800e42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e45:	83 f8 2f             	cmp    $0x2f,%eax
+  800e48:	77 11                	ja     800e5b <vprintfmt+0x397>
+  800e4a:	89 c2                	mov    %eax,%edx
+  800e4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e50:	83 c0 08             	add    $0x8,%eax
+  800e53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e56:	4c 63 22             	movslq (%rdx),%r12
+  800e59:	eb c7                	jmp    800e22 <vprintfmt+0x35e>
+  800e5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e67:	eb ed                	jmp    800e56 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6f:	77 11                	ja     800e82 <vprintfmt+0x3be>
+  800e71:	89 c2                	mov    %eax,%edx
+  800e73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e77:	83 c0 08             	add    $0x8,%eax
+  800e7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7d:	4c 8b 22             	mov    (%rdx),%r12
+  800e80:	eb a0                	jmp    800e22 <vprintfmt+0x35e>
+  800e82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e8e:	eb ed                	jmp    800e7d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9c:	e9 65 ff ff ff       	jmp    800e06 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ea1:	4c 89 ee             	mov    %r13,%rsi
+  800ea4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ea9:	41 ff d6             	call   *%r14
+                i = -i;
+  800eac:	49 f7 dc             	neg    %r12
+  800eaf:	e9 73 ff ff ff       	jmp    800e27 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800eb4:	40 84 f6             	test   %sil,%sil
+  800eb7:	75 32                	jne    800eeb <vprintfmt+0x427>
+    switch (lflag) {
+  800eb9:	85 d2                	test   %edx,%edx
+  800ebb:	74 5d                	je     800f1a <vprintfmt+0x456>
+  800ebd:	83 fa 01             	cmp    $0x1,%edx
+  800ec0:	0f 84 82 00 00 00    	je     800f48 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ec6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec9:	83 f8 2f             	cmp    $0x2f,%eax
+  800ecc:	0f 87 a5 00 00 00    	ja     800f77 <vprintfmt+0x4b3>
+  800ed2:	89 c2                	mov    %eax,%edx
+  800ed4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed8:	83 c0 08             	add    $0x8,%eax
+  800edb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ede:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ee1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ee6:	e9 99 01 00 00       	jmp    801084 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800eeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eee:	83 f8 2f             	cmp    $0x2f,%eax
+  800ef1:	77 19                	ja     800f0c <vprintfmt+0x448>
+  800ef3:	89 c2                	mov    %eax,%edx
+  800ef5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef9:	83 c0 08             	add    $0x8,%eax
+  800efc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f07:	e9 78 01 00 00       	jmp    801084 <vprintfmt+0x5c0>
+  800f0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f18:	eb e5                	jmp    800eff <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800f1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f20:	77 18                	ja     800f3a <vprintfmt+0x476>
+  800f22:	89 c2                	mov    %eax,%edx
+  800f24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f28:	83 c0 08             	add    $0x8,%eax
+  800f2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f2e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800f30:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800f35:	e9 4a 01 00 00       	jmp    801084 <vprintfmt+0x5c0>
+  800f3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f46:	eb e6                	jmp    800f2e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800f48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4e:	77 19                	ja     800f69 <vprintfmt+0x4a5>
+  800f50:	89 c2                	mov    %eax,%edx
+  800f52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f56:	83 c0 08             	add    $0x8,%eax
+  800f59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f64:	e9 1b 01 00 00       	jmp    801084 <vprintfmt+0x5c0>
+  800f69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f75:	eb e5                	jmp    800f5c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f83:	e9 56 ff ff ff       	jmp    800ede <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f88:	40 84 f6             	test   %sil,%sil
+  800f8b:	75 2e                	jne    800fbb <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f8d:	85 d2                	test   %edx,%edx
+  800f8f:	74 59                	je     800fea <vprintfmt+0x526>
+  800f91:	83 fa 01             	cmp    $0x1,%edx
+  800f94:	74 7f                	je     801015 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f99:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9c:	0f 87 9f 00 00 00    	ja     801041 <vprintfmt+0x57d>
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa8:	83 c0 08             	add    $0x8,%eax
+  800fab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fb1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800fb6:	e9 c9 00 00 00       	jmp    801084 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800fbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800fc1:	77 19                	ja     800fdc <vprintfmt+0x518>
+  800fc3:	89 c2                	mov    %eax,%edx
+  800fc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fc9:	83 c0 08             	add    $0x8,%eax
+  800fcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fcf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fd2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800fd7:	e9 a8 00 00 00       	jmp    801084 <vprintfmt+0x5c0>
+  800fdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe8:	eb e5                	jmp    800fcf <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800fea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fed:	83 f8 2f             	cmp    $0x2f,%eax
+  800ff0:	77 15                	ja     801007 <vprintfmt+0x543>
+  800ff2:	89 c2                	mov    %eax,%edx
+  800ff4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ff8:	83 c0 08             	add    $0x8,%eax
+  800ffb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ffe:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801000:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801005:	eb 7d                	jmp    801084 <vprintfmt+0x5c0>
+  801007:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80100b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80100f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801013:	eb e9                	jmp    800ffe <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801015:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801018:	83 f8 2f             	cmp    $0x2f,%eax
+  80101b:	77 16                	ja     801033 <vprintfmt+0x56f>
+  80101d:	89 c2                	mov    %eax,%edx
+  80101f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801023:	83 c0 08             	add    $0x8,%eax
+  801026:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801029:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80102c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801031:	eb 51                	jmp    801084 <vprintfmt+0x5c0>
+  801033:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80103f:	eb e8                	jmp    801029 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801041:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801045:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801049:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80104d:	e9 5c ff ff ff       	jmp    800fae <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801052:	4c 89 ee             	mov    %r13,%rsi
+  801055:	bf 30 00 00 00       	mov    $0x30,%edi
+  80105a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80105d:	4c 89 ee             	mov    %r13,%rsi
+  801060:	bf 78 00 00 00       	mov    $0x78,%edi
+  801065:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801068:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80106b:	83 f8 2f             	cmp    $0x2f,%eax
+  80106e:	77 47                	ja     8010b7 <vprintfmt+0x5f3>
+  801070:	89 c2                	mov    %eax,%edx
+  801072:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801076:	83 c0 08             	add    $0x8,%eax
+  801079:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80107c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80107f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801084:	48 83 ec 08          	sub    $0x8,%rsp
+  801088:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80108c:	0f 94 c0             	sete   %al
+  80108f:	0f b6 c0             	movzbl %al,%eax
+  801092:	50                   	push   %rax
+  801093:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801098:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80109c:	4c 89 ee             	mov    %r13,%rsi
+  80109f:	4c 89 f7             	mov    %r14,%rdi
+  8010a2:	48 b8 b9 09 80 00 00 	movabs $0x8009b9,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+            break;
+  8010ae:	48 83 c4 10          	add    $0x10,%rsp
+  8010b2:	e9 3e fa ff ff       	jmp    800af5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8010b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010c3:	eb b7                	jmp    80107c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8010c5:	40 84 f6             	test   %sil,%sil
+  8010c8:	75 2b                	jne    8010f5 <vprintfmt+0x631>
+    switch (lflag) {
+  8010ca:	85 d2                	test   %edx,%edx
+  8010cc:	74 56                	je     801124 <vprintfmt+0x660>
+  8010ce:	83 fa 01             	cmp    $0x1,%edx
+  8010d1:	74 7f                	je     801152 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8010d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d9:	0f 87 a2 00 00 00    	ja     801181 <vprintfmt+0x6bd>
+  8010df:	89 c2                	mov    %eax,%edx
+  8010e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e5:	83 c0 08             	add    $0x8,%eax
+  8010e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010f3:	eb 8f                	jmp    801084 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8010fb:	77 19                	ja     801116 <vprintfmt+0x652>
+  8010fd:	89 c2                	mov    %eax,%edx
+  8010ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801103:	83 c0 08             	add    $0x8,%eax
+  801106:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801109:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80110c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801111:	e9 6e ff ff ff       	jmp    801084 <vprintfmt+0x5c0>
+  801116:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80111a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80111e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801122:	eb e5                	jmp    801109 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801124:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801127:	83 f8 2f             	cmp    $0x2f,%eax
+  80112a:	77 18                	ja     801144 <vprintfmt+0x680>
+  80112c:	89 c2                	mov    %eax,%edx
+  80112e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801132:	83 c0 08             	add    $0x8,%eax
+  801135:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801138:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80113a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80113f:	e9 40 ff ff ff       	jmp    801084 <vprintfmt+0x5c0>
+  801144:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801148:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80114c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801150:	eb e6                	jmp    801138 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801152:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801155:	83 f8 2f             	cmp    $0x2f,%eax
+  801158:	77 19                	ja     801173 <vprintfmt+0x6af>
+  80115a:	89 c2                	mov    %eax,%edx
+  80115c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801160:	83 c0 08             	add    $0x8,%eax
+  801163:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801166:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801169:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80116e:	e9 11 ff ff ff       	jmp    801084 <vprintfmt+0x5c0>
+  801173:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801177:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80117b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80117f:	eb e5                	jmp    801166 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801181:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801185:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801189:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80118d:	e9 59 ff ff ff       	jmp    8010eb <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801192:	4c 89 ee             	mov    %r13,%rsi
+  801195:	bf 25 00 00 00       	mov    $0x25,%edi
+  80119a:	41 ff d6             	call   *%r14
+            break;
+  80119d:	e9 53 f9 ff ff       	jmp    800af5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8011a2:	4c 89 ee             	mov    %r13,%rsi
+  8011a5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011aa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8011ad:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8011b5:	75 f6                	jne    8011ad <vprintfmt+0x6e9>
+  8011b7:	e9 39 f9 ff ff       	jmp    800af5 <vprintfmt+0x31>
+}
+  8011bc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011c0:	5b                   	pop    %rbx
+  8011c1:	41 5c                	pop    %r12
+  8011c3:	41 5d                	pop    %r13
+  8011c5:	41 5e                	pop    %r14
+  8011c7:	41 5f                	pop    %r15
+  8011c9:	5d                   	pop    %rbp
+  8011ca:	c3                   	ret
+
+00000000008011cb <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8011cb:	55                   	push   %rbp
+  8011cc:	48 89 e5             	mov    %rsp,%rbp
+  8011cf:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8011d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011d7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8011dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8011e0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8011e7:	48 85 ff             	test   %rdi,%rdi
+  8011ea:	74 2b                	je     801217 <vsnprintf+0x4c>
+  8011ec:	48 85 f6             	test   %rsi,%rsi
+  8011ef:	74 26                	je     801217 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011f5:	48 bf 6f 0a 80 00 00 	movabs $0x800a6f,%rdi
+  8011fc:	00 00 00 
+  8011ff:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  801206:	00 00 00 
+  801209:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80120b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801212:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801215:	c9                   	leave
+  801216:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801217:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121c:	eb f7                	jmp    801215 <vsnprintf+0x4a>
+
+000000000080121e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	48 83 ec 50          	sub    $0x50,%rsp
+  801226:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80122a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80122e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801232:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801239:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80123d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801241:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801245:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801249:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80124d:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  801254:	00 00 00 
+  801257:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80125b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80125e:	74 10                	je     801270 <strlen+0x15>
+    size_t n = 0;
+  801260:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801265:	48 83 c0 01          	add    $0x1,%rax
+  801269:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80126d:	75 f6                	jne    801265 <strlen+0xa>
+  80126f:	c3                   	ret
+    size_t n = 0;
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801275:	c3                   	ret
+
+0000000000801276 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801276:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801279:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80127e:	48 85 f6             	test   %rsi,%rsi
+  801281:	74 11                	je     801294 <strnlen+0x1e>
+  801283:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801287:	74 0c                	je     801295 <strnlen+0x1f>
+  801289:	48 83 c2 01          	add    $0x1,%rdx
+  80128d:	48 39 d0             	cmp    %rdx,%rax
+  801290:	75 f1                	jne    801283 <strnlen+0xd>
+  801292:	eb 04                	jmp    801298 <strnlen+0x22>
+  801294:	c3                   	ret
+  801295:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801298:	c3                   	ret
+
+0000000000801299 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801299:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80129c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8012a5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8012a8:	48 83 c2 01          	add    $0x1,%rdx
+  8012ac:	84 c9                	test   %cl,%cl
+  8012ae:	75 f1                	jne    8012a1 <strcpy+0x8>
+        ;
+    return res;
+}
+  8012b0:	c3                   	ret
+
+00000000008012b1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	41 54                	push   %r12
+  8012b7:	53                   	push   %rbx
+  8012b8:	48 89 fb             	mov    %rdi,%rbx
+  8012bb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8012be:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  8012c5:	00 00 00 
+  8012c8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8012ca:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8012ce:	4c 89 e6             	mov    %r12,%rsi
+  8012d1:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  8012d8:	00 00 00 
+  8012db:	ff d0                	call   *%rax
+    return dst;
+}
+  8012dd:	48 89 d8             	mov    %rbx,%rax
+  8012e0:	5b                   	pop    %rbx
+  8012e1:	41 5c                	pop    %r12
+  8012e3:	5d                   	pop    %rbp
+  8012e4:	c3                   	ret
+
+00000000008012e5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8012e5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8012e8:	48 85 d2             	test   %rdx,%rdx
+  8012eb:	74 1f                	je     80130c <strncpy+0x27>
+  8012ed:	48 01 fa             	add    %rdi,%rdx
+  8012f0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012f3:	48 83 c1 01          	add    $0x1,%rcx
+  8012f7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012fb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012ff:	41 80 f8 01          	cmp    $0x1,%r8b
+  801303:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801307:	48 39 ca             	cmp    %rcx,%rdx
+  80130a:	75 e7                	jne    8012f3 <strncpy+0xe>
+    }
+    return ret;
+}
+  80130c:	c3                   	ret
+
+000000000080130d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80130d:	48 89 f8             	mov    %rdi,%rax
+  801310:	48 85 d2             	test   %rdx,%rdx
+  801313:	74 24                	je     801339 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801315:	48 83 ea 01          	sub    $0x1,%rdx
+  801319:	74 1b                	je     801336 <strlcpy+0x29>
+  80131b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80131f:	0f b6 16             	movzbl (%rsi),%edx
+  801322:	84 d2                	test   %dl,%dl
+  801324:	74 10                	je     801336 <strlcpy+0x29>
+            *dst++ = *src++;
+  801326:	48 83 c6 01          	add    $0x1,%rsi
+  80132a:	48 83 c0 01          	add    $0x1,%rax
+  80132e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801331:	48 39 c8             	cmp    %rcx,%rax
+  801334:	75 e9                	jne    80131f <strlcpy+0x12>
+        *dst = '\0';
+  801336:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801339:	48 29 f8             	sub    %rdi,%rax
+}
+  80133c:	c3                   	ret
+
+000000000080133d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80133d:	0f b6 07             	movzbl (%rdi),%eax
+  801340:	84 c0                	test   %al,%al
+  801342:	74 13                	je     801357 <strcmp+0x1a>
+  801344:	38 06                	cmp    %al,(%rsi)
+  801346:	75 0f                	jne    801357 <strcmp+0x1a>
+  801348:	48 83 c7 01          	add    $0x1,%rdi
+  80134c:	48 83 c6 01          	add    $0x1,%rsi
+  801350:	0f b6 07             	movzbl (%rdi),%eax
+  801353:	84 c0                	test   %al,%al
+  801355:	75 ed                	jne    801344 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801357:	0f b6 c0             	movzbl %al,%eax
+  80135a:	0f b6 16             	movzbl (%rsi),%edx
+  80135d:	29 d0                	sub    %edx,%eax
+}
+  80135f:	c3                   	ret
+
+0000000000801360 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801360:	48 85 d2             	test   %rdx,%rdx
+  801363:	74 1f                	je     801384 <strncmp+0x24>
+  801365:	0f b6 07             	movzbl (%rdi),%eax
+  801368:	84 c0                	test   %al,%al
+  80136a:	74 1e                	je     80138a <strncmp+0x2a>
+  80136c:	3a 06                	cmp    (%rsi),%al
+  80136e:	75 1a                	jne    80138a <strncmp+0x2a>
+  801370:	48 83 c7 01          	add    $0x1,%rdi
+  801374:	48 83 c6 01          	add    $0x1,%rsi
+  801378:	48 83 ea 01          	sub    $0x1,%rdx
+  80137c:	75 e7                	jne    801365 <strncmp+0x5>
+
+    if (!n) return 0;
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801383:	c3                   	ret
+  801384:	b8 00 00 00 00       	mov    $0x0,%eax
+  801389:	c3                   	ret
+  80138a:	48 85 d2             	test   %rdx,%rdx
+  80138d:	74 09                	je     801398 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80138f:	0f b6 07             	movzbl (%rdi),%eax
+  801392:	0f b6 16             	movzbl (%rsi),%edx
+  801395:	29 d0                	sub    %edx,%eax
+  801397:	c3                   	ret
+    if (!n) return 0;
+  801398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80139d:	c3                   	ret
+
+000000000080139e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80139e:	0f b6 17             	movzbl (%rdi),%edx
+  8013a1:	84 d2                	test   %dl,%dl
+  8013a3:	74 18                	je     8013bd <strchr+0x1f>
+        if (*str == c) {
+  8013a5:	0f be d2             	movsbl %dl,%edx
+  8013a8:	39 f2                	cmp    %esi,%edx
+  8013aa:	74 17                	je     8013c3 <strchr+0x25>
+    for (; *str; str++) {
+  8013ac:	48 83 c7 01          	add    $0x1,%rdi
+  8013b0:	0f b6 17             	movzbl (%rdi),%edx
+  8013b3:	84 d2                	test   %dl,%dl
+  8013b5:	75 ee                	jne    8013a5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8013b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bc:	c3                   	ret
+  8013bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c2:	c3                   	ret
+  8013c3:	48 89 f8             	mov    %rdi,%rax
+}
+  8013c6:	c3                   	ret
+
+00000000008013c7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8013c7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8013ca:	0f b6 17             	movzbl (%rdi),%edx
+  8013cd:	84 d2                	test   %dl,%dl
+  8013cf:	74 13                	je     8013e4 <strfind+0x1d>
+  8013d1:	0f be d2             	movsbl %dl,%edx
+  8013d4:	39 f2                	cmp    %esi,%edx
+  8013d6:	74 0b                	je     8013e3 <strfind+0x1c>
+  8013d8:	48 83 c0 01          	add    $0x1,%rax
+  8013dc:	0f b6 10             	movzbl (%rax),%edx
+  8013df:	84 d2                	test   %dl,%dl
+  8013e1:	75 ee                	jne    8013d1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8013e3:	c3                   	ret
+  8013e4:	c3                   	ret
+
+00000000008013e5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8013e5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8013e8:	48 89 f8             	mov    %rdi,%rax
+  8013eb:	48 f7 d8             	neg    %rax
+  8013ee:	83 e0 07             	and    $0x7,%eax
+  8013f1:	49 89 d1             	mov    %rdx,%r9
+  8013f4:	49 29 c1             	sub    %rax,%r9
+  8013f7:	78 36                	js     80142f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013f9:	40 0f b6 c6          	movzbl %sil,%eax
+  8013fd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801404:	01 01 01 
+  801407:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80140b:	40 f6 c7 07          	test   $0x7,%dil
+  80140f:	75 38                	jne    801449 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801411:	4c 89 c9             	mov    %r9,%rcx
+  801414:	48 c1 f9 03          	sar    $0x3,%rcx
+  801418:	74 0c                	je     801426 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80141a:	fc                   	cld
+  80141b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80141e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801422:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801426:	4d 85 c9             	test   %r9,%r9
+  801429:	75 45                	jne    801470 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80142b:	4c 89 c0             	mov    %r8,%rax
+  80142e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80142f:	48 85 d2             	test   %rdx,%rdx
+  801432:	74 f7                	je     80142b <memset+0x46>
+  801434:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801437:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80143a:	48 83 c0 01          	add    $0x1,%rax
+  80143e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801442:	48 39 c2             	cmp    %rax,%rdx
+  801445:	75 f3                	jne    80143a <memset+0x55>
+  801447:	eb e2                	jmp    80142b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801449:	40 f6 c7 01          	test   $0x1,%dil
+  80144d:	74 06                	je     801455 <memset+0x70>
+  80144f:	88 07                	mov    %al,(%rdi)
+  801451:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801455:	40 f6 c7 02          	test   $0x2,%dil
+  801459:	74 07                	je     801462 <memset+0x7d>
+  80145b:	66 89 07             	mov    %ax,(%rdi)
+  80145e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801462:	40 f6 c7 04          	test   $0x4,%dil
+  801466:	74 a9                	je     801411 <memset+0x2c>
+  801468:	89 07                	mov    %eax,(%rdi)
+  80146a:	48 83 c7 04          	add    $0x4,%rdi
+  80146e:	eb a1                	jmp    801411 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801470:	41 f6 c1 04          	test   $0x4,%r9b
+  801474:	74 06                	je     80147c <memset+0x97>
+  801476:	89 07                	mov    %eax,(%rdi)
+  801478:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80147c:	41 f6 c1 02          	test   $0x2,%r9b
+  801480:	74 07                	je     801489 <memset+0xa4>
+  801482:	66 89 07             	mov    %ax,(%rdi)
+  801485:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801489:	41 f6 c1 01          	test   $0x1,%r9b
+  80148d:	74 9c                	je     80142b <memset+0x46>
+  80148f:	88 07                	mov    %al,(%rdi)
+  801491:	eb 98                	jmp    80142b <memset+0x46>
+
+0000000000801493 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801493:	48 89 f8             	mov    %rdi,%rax
+  801496:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801499:	48 39 fe             	cmp    %rdi,%rsi
+  80149c:	73 3b                	jae    8014d9 <memmove+0x46>
+  80149e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8014a2:	48 39 d7             	cmp    %rdx,%rdi
+  8014a5:	73 32                	jae    8014d9 <memmove+0x46>
+        s += n;
+        d += n;
+  8014a7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014ab:	48 89 d6             	mov    %rdx,%rsi
+  8014ae:	48 09 fe             	or     %rdi,%rsi
+  8014b1:	48 09 ce             	or     %rcx,%rsi
+  8014b4:	40 f6 c6 07          	test   $0x7,%sil
+  8014b8:	75 12                	jne    8014cc <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8014ba:	48 83 ef 08          	sub    $0x8,%rdi
+  8014be:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8014c2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014c6:	fd                   	std
+  8014c7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8014ca:	fc                   	cld
+  8014cb:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8014cc:	48 83 ef 01          	sub    $0x1,%rdi
+  8014d0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8014d4:	fd                   	std
+  8014d5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014d7:	eb f1                	jmp    8014ca <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014d9:	48 89 f2             	mov    %rsi,%rdx
+  8014dc:	48 09 c2             	or     %rax,%rdx
+  8014df:	48 09 ca             	or     %rcx,%rdx
+  8014e2:	f6 c2 07             	test   $0x7,%dl
+  8014e5:	75 0c                	jne    8014f3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8014e7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014eb:	48 89 c7             	mov    %rax,%rdi
+  8014ee:	fc                   	cld
+  8014ef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014f2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014f3:	48 89 c7             	mov    %rax,%rdi
+  8014f6:	fc                   	cld
+  8014f7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014f9:	c3                   	ret
+
+00000000008014fa <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014fa:	55                   	push   %rbp
+  8014fb:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014fe:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  801505:	00 00 00 
+  801508:	ff d0                	call   *%rax
+}
+  80150a:	5d                   	pop    %rbp
+  80150b:	c3                   	ret
+
+000000000080150c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80150c:	55                   	push   %rbp
+  80150d:	48 89 e5             	mov    %rsp,%rbp
+  801510:	41 57                	push   %r15
+  801512:	41 56                	push   %r14
+  801514:	41 55                	push   %r13
+  801516:	41 54                	push   %r12
+  801518:	53                   	push   %rbx
+  801519:	48 83 ec 08          	sub    $0x8,%rsp
+  80151d:	49 89 fe             	mov    %rdi,%r14
+  801520:	49 89 f7             	mov    %rsi,%r15
+  801523:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801526:	48 89 f7             	mov    %rsi,%rdi
+  801529:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+  801535:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801538:	48 89 de             	mov    %rbx,%rsi
+  80153b:	4c 89 f7             	mov    %r14,%rdi
+  80153e:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  801545:	00 00 00 
+  801548:	ff d0                	call   *%rax
+  80154a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80154d:	48 39 c3             	cmp    %rax,%rbx
+  801550:	74 36                	je     801588 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801552:	48 89 d8             	mov    %rbx,%rax
+  801555:	4c 29 e8             	sub    %r13,%rax
+  801558:	49 39 c4             	cmp    %rax,%r12
+  80155b:	73 31                	jae    80158e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80155d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801562:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801566:	4c 89 fe             	mov    %r15,%rsi
+  801569:	48 b8 fa 14 80 00 00 	movabs $0x8014fa,%rax
+  801570:	00 00 00 
+  801573:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801575:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801579:	48 83 c4 08          	add    $0x8,%rsp
+  80157d:	5b                   	pop    %rbx
+  80157e:	41 5c                	pop    %r12
+  801580:	41 5d                	pop    %r13
+  801582:	41 5e                	pop    %r14
+  801584:	41 5f                	pop    %r15
+  801586:	5d                   	pop    %rbp
+  801587:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801588:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80158c:	eb eb                	jmp    801579 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80158e:	48 83 eb 01          	sub    $0x1,%rbx
+  801592:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801596:	48 89 da             	mov    %rbx,%rdx
+  801599:	4c 89 fe             	mov    %r15,%rsi
+  80159c:	48 b8 fa 14 80 00 00 	movabs $0x8014fa,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8015a8:	49 01 de             	add    %rbx,%r14
+  8015ab:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8015b0:	eb c3                	jmp    801575 <strlcat+0x69>
+
+00000000008015b2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8015b2:	48 85 d2             	test   %rdx,%rdx
+  8015b5:	74 2d                	je     8015e4 <memcmp+0x32>
+  8015b7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8015bc:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8015c0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8015c5:	44 38 c1             	cmp    %r8b,%cl
+  8015c8:	75 0f                	jne    8015d9 <memcmp+0x27>
+    while (n-- > 0) {
+  8015ca:	48 83 c0 01          	add    $0x1,%rax
+  8015ce:	48 39 c2             	cmp    %rax,%rdx
+  8015d1:	75 e9                	jne    8015bc <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8015d9:	0f b6 c1             	movzbl %cl,%eax
+  8015dc:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8015e0:	44 29 c0             	sub    %r8d,%eax
+  8015e3:	c3                   	ret
+    return 0;
+  8015e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e9:	c3                   	ret
+
+00000000008015ea <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8015ea:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8015ee:	48 39 c7             	cmp    %rax,%rdi
+  8015f1:	73 0f                	jae    801602 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015f3:	40 38 37             	cmp    %sil,(%rdi)
+  8015f6:	74 0e                	je     801606 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015f8:	48 83 c7 01          	add    $0x1,%rdi
+  8015fc:	48 39 f8             	cmp    %rdi,%rax
+  8015ff:	75 f2                	jne    8015f3 <memfind+0x9>
+  801601:	c3                   	ret
+  801602:	48 89 f8             	mov    %rdi,%rax
+  801605:	c3                   	ret
+  801606:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801609:	c3                   	ret
+
+000000000080160a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80160a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80160d:	0f b6 37             	movzbl (%rdi),%esi
+  801610:	40 80 fe 20          	cmp    $0x20,%sil
+  801614:	74 06                	je     80161c <strtol+0x12>
+  801616:	40 80 fe 09          	cmp    $0x9,%sil
+  80161a:	75 13                	jne    80162f <strtol+0x25>
+  80161c:	48 83 c7 01          	add    $0x1,%rdi
+  801620:	0f b6 37             	movzbl (%rdi),%esi
+  801623:	40 80 fe 20          	cmp    $0x20,%sil
+  801627:	74 f3                	je     80161c <strtol+0x12>
+  801629:	40 80 fe 09          	cmp    $0x9,%sil
+  80162d:	74 ed                	je     80161c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80162f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801632:	83 e0 fd             	and    $0xfffffffd,%eax
+  801635:	3c 01                	cmp    $0x1,%al
+  801637:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80163b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801641:	75 0f                	jne    801652 <strtol+0x48>
+  801643:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801646:	74 14                	je     80165c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801648:	85 d2                	test   %edx,%edx
+  80164a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80164f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801657:	4c 63 ca             	movslq %edx,%r9
+  80165a:	eb 36                	jmp    801692 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80165c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801660:	74 0f                	je     801671 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801662:	85 d2                	test   %edx,%edx
+  801664:	75 ec                	jne    801652 <strtol+0x48>
+        s++;
+  801666:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80166a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80166f:	eb e1                	jmp    801652 <strtol+0x48>
+        s += 2;
+  801671:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801675:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80167a:	eb d6                	jmp    801652 <strtol+0x48>
+            dig -= '0';
+  80167c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80167f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801683:	41 39 d0             	cmp    %edx,%r8d
+  801686:	7d 21                	jge    8016a9 <strtol+0x9f>
+        val = val * base + dig;
+  801688:	49 0f af c1          	imul   %r9,%rax
+  80168c:	0f b6 c9             	movzbl %cl,%ecx
+  80168f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801692:	48 83 c7 01          	add    $0x1,%rdi
+  801696:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80169a:	80 f9 39             	cmp    $0x39,%cl
+  80169d:	76 dd                	jbe    80167c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80169f:	80 f9 7b             	cmp    $0x7b,%cl
+  8016a2:	77 05                	ja     8016a9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8016a4:	83 e9 57             	sub    $0x57,%ecx
+  8016a7:	eb d6                	jmp    80167f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8016a9:	4d 85 d2             	test   %r10,%r10
+  8016ac:	74 03                	je     8016b1 <strtol+0xa7>
+  8016ae:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8016b1:	48 89 c2             	mov    %rax,%rdx
+  8016b4:	48 f7 da             	neg    %rdx
+  8016b7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8016bb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8016bf:	c3                   	ret
+
+00000000008016c0 <strrev>:
+
+void
+strrev(char *str)
+{
+  8016c0:	55                   	push   %rbp
+  8016c1:	48 89 e5             	mov    %rsp,%rbp
+  8016c4:	53                   	push   %rbx
+  8016c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c9:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  8016cc:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  8016d3:	00 00 00 
+  8016d6:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8016d8:	83 e8 01             	sub    $0x1,%eax
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	7e 22                	jle    801701 <strrev+0x41>
+  8016df:	48 98                	cltq
+  8016e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  8016e6:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  8016ea:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  8016ee:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  8016f2:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  8016f5:	48 83 c2 01          	add    $0x1,%rdx
+  8016f9:	48 83 e8 01          	sub    $0x1,%rax
+  8016fd:	39 c2                	cmp    %eax,%edx
+  8016ff:	7c e5                	jl     8016e6 <strrev+0x26>
+	}
+}
+  801701:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+0000000000801707 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801707:	85 d2                	test   %edx,%edx
+  801709:	0f 84 80 00 00 00    	je     80178f <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	53                   	push   %rbx
+  801714:	48 83 ec 08          	sub    $0x8,%rsp
+  801718:	49 89 f2             	mov    %rsi,%r10
+  80171b:	41 89 d3             	mov    %edx,%r11d
+  80171e:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801721:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801726:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  801729:	eb 20                	jmp    80174b <itoa+0x44>
+			str[i++] = '0' + digit;
+  80172b:	41 89 f1             	mov    %esi,%r9d
+  80172e:	83 c2 30             	add    $0x30,%edx
+  801731:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801734:	89 f8                	mov    %edi,%eax
+  801736:	99                   	cltd
+  801737:	f7 f9                	idiv   %ecx
+  801739:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	74 2e                	je     80176d <itoa+0x66>
+  80173f:	83 c6 01             	add    $0x1,%esi
+  801742:	49 83 c0 01          	add    $0x1,%r8
+  801746:	44 39 cb             	cmp    %r9d,%ebx
+  801749:	7e 15                	jle    801760 <itoa+0x59>
+		digit = sum % base;
+  80174b:	89 f8                	mov    %edi,%eax
+  80174d:	99                   	cltd
+  80174e:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801750:	83 fa 09             	cmp    $0x9,%edx
+  801753:	7e d6                	jle    80172b <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801755:	41 89 f1             	mov    %esi,%r9d
+  801758:	83 c2 37             	add    $0x37,%edx
+  80175b:	41 88 10             	mov    %dl,(%r8)
+  80175e:	eb d4                	jmp    801734 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801760:	41 83 eb 01          	sub    $0x1,%r11d
+  801764:	45 39 cb             	cmp    %r9d,%r11d
+  801767:	75 04                	jne    80176d <itoa+0x66>
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	75 28                	jne    801795 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  80176d:	4d 63 c9             	movslq %r9d,%r9
+  801770:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801775:	4c 89 d7             	mov    %r10,%rdi
+  801778:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  80177f:	00 00 00 
+  801782:	ff d0                	call   *%rax
+	return 0;
+  801784:	b8 00 00 00 00       	mov    $0x0,%eax
+  801789:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+		return -1;
+  80178f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801794:	c3                   	ret
+		return -1;
+  801795:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80179a:	eb ed                	jmp    801789 <itoa+0x82>
+
+000000000080179c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	53                   	push   %rbx
+  8017a1:	48 89 fa             	mov    %rdi,%rdx
+  8017a4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c1:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8017c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c7:	c9                   	leave
+  8017c8:	c3                   	ret
+
+00000000008017c9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8017c9:	55                   	push   %rbp
+  8017ca:	48 89 e5             	mov    %rsp,%rbp
+  8017cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ce:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+00000000008017fa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8017fa:	55                   	push   %rbp
+  8017fb:	48 89 e5             	mov    %rsp,%rbp
+  8017fe:	53                   	push   %rbx
+  8017ff:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801803:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801806:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801810:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181a:	be 00 00 00 00       	mov    $0x0,%esi
+  80181f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801825:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801827:	48 85 c0             	test   %rax,%rax
+  80182a:	7f 06                	jg     801832 <sys_env_destroy+0x38>
+}
+  80182c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801832:	49 89 c0             	mov    %rax,%r8
+  801835:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80183a:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801841:	00 00 00 
+  801844:	be 26 00 00 00       	mov    $0x26,%esi
+  801849:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801850:	00 00 00 
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  80185f:	00 00 00 
+  801862:	41 ff d1             	call   *%r9
+
+0000000000801865 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80186a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80186f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801874:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801879:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801883:	be 00 00 00 00       	mov    $0x0,%esi
+  801888:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801890:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801894:	c9                   	leave
+  801895:	c3                   	ret
+
+0000000000801896 <sys_yield>:
+
+void
+sys_yield(void) {
+  801896:	55                   	push   %rbp
+  801897:	48 89 e5             	mov    %rsp,%rbp
+  80189a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80189b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018bf:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+
+00000000008018c7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8018c7:	55                   	push   %rbp
+  8018c8:	48 89 e5             	mov    %rsp,%rbp
+  8018cb:	53                   	push   %rbx
+  8018cc:	48 89 fa             	mov    %rdi,%rdx
+  8018cf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8018de:	00 00 00 
+  8018e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8018f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+
+00000000008018f9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8018f9:	55                   	push   %rbp
+  8018fa:	48 89 e5             	mov    %rsp,%rbp
+  8018fd:	53                   	push   %rbx
+  8018fe:	49 89 f8             	mov    %rdi,%r8
+  801901:	48 89 d3             	mov    %rdx,%rbx
+  801904:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801907:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80190c:	4c 89 c2             	mov    %r8,%rdx
+  80190f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801912:	be 00 00 00 00       	mov    $0x0,%esi
+  801917:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80191d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80191f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+
+0000000000801925 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	53                   	push   %rbx
+  80192a:	48 83 ec 08          	sub    $0x8,%rsp
+  80192e:	89 f8                	mov    %edi,%eax
+  801930:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801933:	48 63 f9             	movslq %ecx,%rdi
+  801936:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801939:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80193e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801941:	be 00 00 00 00       	mov    $0x0,%esi
+  801946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80194e:	48 85 c0             	test   %rax,%rax
+  801951:	7f 06                	jg     801959 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801953:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801957:	c9                   	leave
+  801958:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801959:	49 89 c0             	mov    %rax,%r8
+  80195c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801961:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801968:	00 00 00 
+  80196b:	be 26 00 00 00       	mov    $0x26,%esi
+  801970:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801977:	00 00 00 
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801986:	00 00 00 
+  801989:	41 ff d1             	call   *%r9
+
+000000000080198c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80198c:	55                   	push   %rbp
+  80198d:	48 89 e5             	mov    %rsp,%rbp
+  801990:	53                   	push   %rbx
+  801991:	48 83 ec 08          	sub    $0x8,%rsp
+  801995:	89 f8                	mov    %edi,%eax
+  801997:	49 89 f2             	mov    %rsi,%r10
+  80199a:	48 89 cf             	mov    %rcx,%rdi
+  80199d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8019a0:	48 63 da             	movslq %edx,%rbx
+  8019a3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019ab:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ae:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8019b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019b3:	48 85 c0             	test   %rax,%rax
+  8019b6:	7f 06                	jg     8019be <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8019b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019be:	49 89 c0             	mov    %rax,%r8
+  8019c1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8019c6:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  8019cd:	00 00 00 
+  8019d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8019d5:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  8019dc:	00 00 00 
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  8019eb:	00 00 00 
+  8019ee:	41 ff d1             	call   *%r9
+
+00000000008019f1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8019f1:	55                   	push   %rbp
+  8019f2:	48 89 e5             	mov    %rsp,%rbp
+  8019f5:	53                   	push   %rbx
+  8019f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019fa:	48 89 f1             	mov    %rsi,%rcx
+  8019fd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801a00:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a03:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a08:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a18:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a1a:	48 85 c0             	test   %rax,%rax
+  801a1d:	7f 06                	jg     801a25 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801a1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a23:	c9                   	leave
+  801a24:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a25:	49 89 c0             	mov    %rax,%r8
+  801a28:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801a2d:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801a34:	00 00 00 
+  801a37:	be 26 00 00 00       	mov    $0x26,%esi
+  801a3c:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801a43:	00 00 00 
+  801a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4b:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801a52:	00 00 00 
+  801a55:	41 ff d1             	call   *%r9
+
+0000000000801a58 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801a58:	55                   	push   %rbp
+  801a59:	48 89 e5             	mov    %rsp,%rbp
+  801a5c:	53                   	push   %rbx
+  801a5d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801a61:	48 63 ce             	movslq %esi,%rcx
+  801a64:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a67:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a76:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a81:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a83:	48 85 c0             	test   %rax,%rax
+  801a86:	7f 06                	jg     801a8e <sys_env_set_status+0x36>
+}
+  801a88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8c:	c9                   	leave
+  801a8d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a8e:	49 89 c0             	mov    %rax,%r8
+  801a91:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801a96:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801a9d:	00 00 00 
+  801aa0:	be 26 00 00 00       	mov    $0x26,%esi
+  801aa5:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801aac:	00 00 00 
+  801aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab4:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801abb:	00 00 00 
+  801abe:	41 ff d1             	call   *%r9
+
+0000000000801ac1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801ac1:	55                   	push   %rbp
+  801ac2:	48 89 e5             	mov    %rsp,%rbp
+  801ac5:	53                   	push   %rbx
+  801ac6:	48 83 ec 08          	sub    $0x8,%rsp
+  801aca:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801acd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ada:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aec:	48 85 c0             	test   %rax,%rax
+  801aef:	7f 06                	jg     801af7 <sys_env_set_trapframe+0x36>
+}
+  801af1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af5:	c9                   	leave
+  801af6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801af7:	49 89 c0             	mov    %rax,%r8
+  801afa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801aff:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801b06:	00 00 00 
+  801b09:	be 26 00 00 00       	mov    $0x26,%esi
+  801b0e:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801b15:	00 00 00 
+  801b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1d:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801b24:	00 00 00 
+  801b27:	41 ff d1             	call   *%r9
+
+0000000000801b2a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801b2a:	55                   	push   %rbp
+  801b2b:	48 89 e5             	mov    %rsp,%rbp
+  801b2e:	53                   	push   %rbx
+  801b2f:	48 83 ec 08          	sub    $0x8,%rsp
+  801b33:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801b36:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b39:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b43:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b48:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b53:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b55:	48 85 c0             	test   %rax,%rax
+  801b58:	7f 06                	jg     801b60 <sys_env_set_pgfault_upcall+0x36>
+}
+  801b5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b60:	49 89 c0             	mov    %rax,%r8
+  801b63:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801b68:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801b6f:	00 00 00 
+  801b72:	be 26 00 00 00       	mov    $0x26,%esi
+  801b77:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801b7e:	00 00 00 
+  801b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b86:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801b8d:	00 00 00 
+  801b90:	41 ff d1             	call   *%r9
+
+0000000000801b93 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	53                   	push   %rbx
+  801b98:	89 f8                	mov    %edi,%eax
+  801b9a:	49 89 f1             	mov    %rsi,%r9
+  801b9d:	48 89 d3             	mov    %rdx,%rbx
+  801ba0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801ba3:	49 63 f0             	movslq %r8d,%rsi
+  801ba6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ba9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bae:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb7:	cd 30                	int    $0x30
+}
+  801bb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+0000000000801bbf <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  801bbf:	55                   	push   %rbp
+  801bc0:	48 89 e5             	mov    %rsp,%rbp
+  801bc3:	53                   	push   %rbx
+  801bc4:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc8:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801bcb:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bce:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bd3:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bd6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801be0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801be8:	48 85 c0             	test   %rax,%rax
+  801beb:	7f 06                	jg     801bf3 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bf3:	49 89 c0             	mov    %rax,%r8
+  801bf6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801bfb:	48 ba 28 4d 80 00 00 	movabs $0x804d28,%rdx
+  801c02:	00 00 00 
+  801c05:	be 26 00 00 00       	mov    $0x26,%esi
+  801c0a:	48 bf 47 4d 80 00 00 	movabs $0x804d47,%rdi
+  801c11:	00 00 00 
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	49 b9 24 08 80 00 00 	movabs $0x800824,%r9
+  801c20:	00 00 00 
+  801c23:	41 ff d1             	call   *%r9
+
+0000000000801c26 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801c26:	55                   	push   %rbp
+  801c27:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  801c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2f:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  801c36:	00 00 00 
+  801c39:	ff d0                	call   *%rax
+}
+  801c3b:	5d                   	pop    %rbp
+  801c3c:	c3                   	ret
+
+0000000000801c3d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801c3d:	55                   	push   %rbp
+  801c3e:	48 89 e5             	mov    %rsp,%rbp
+  801c41:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c42:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c66:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+
+0000000000801c6e <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801c73:	48 63 ce             	movslq %esi,%rcx
+  801c76:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801c7a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c89:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c94:	cd 30                	int    $0x30
+}
+  801c96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+0000000000801c9c <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801c9c:	55                   	push   %rbp
+  801c9d:	48 89 e5             	mov    %rsp,%rbp
+  801ca0:	53                   	push   %rbx
+  801ca1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801ca4:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cb7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc2:	cd 30                	int    $0x30
+}
+  801cc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc8:	c9                   	leave
+  801cc9:	c3                   	ret
+
+0000000000801cca <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+  801cce:	53                   	push   %rbx
+  801ccf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  801cd2:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cda:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ced:	cd 30                	int    $0x30
+}
+  801cef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf3:	c9                   	leave
+  801cf4:	c3                   	ret
+
+0000000000801cf5 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801cf5:	55                   	push   %rbp
+  801cf6:	48 89 e5             	mov    %rsp,%rbp
+  801cf9:	41 54                	push   %r12
+  801cfb:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801cfc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d01:	cd 30                	int    $0x30
+  801d03:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 7e                	js     801d88 <fork+0x93>
+        return envid;
+    if (envid == 0) {
+  801d0a:	0f 84 80 00 00 00    	je     801d90 <fork+0x9b>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801d10:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d16:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801d1d:	00 00 00 
+  801d20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d25:	89 c2                	mov    %eax,%edx
+  801d27:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d31:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	0f 88 81 00 00 00    	js     801dc6 <fork+0xd1>
+        return -1;
+    }
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801d45:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801d4c:	00 00 00 
+  801d4f:	48 8b b0 00 01 00 00 	mov    0x100(%rax),%rsi
+  801d56:	44 89 e7             	mov    %r12d,%edi
+  801d59:	48 b8 2a 1b 80 00 00 	movabs $0x801b2a,%rax
+  801d60:	00 00 00 
+  801d63:	ff d0                	call   *%rax
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 65                	js     801dce <fork+0xd9>
+        return -1;
+    }
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801d69:	be 02 00 00 00       	mov    $0x2,%esi
+  801d6e:	44 89 e7             	mov    %r12d,%edi
+  801d71:	48 b8 58 1a 80 00 00 	movabs $0x801a58,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+        return -1;
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d84:	44 0f 48 e0          	cmovs  %eax,%r12d
+    }
+    return envid;
+}
+  801d88:	44 89 e0             	mov    %r12d,%eax
+  801d8b:	5b                   	pop    %rbx
+  801d8c:	41 5c                	pop    %r12
+  801d8e:	5d                   	pop    %rbp
+  801d8f:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d90:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+  801d9c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da1:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801da5:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  801da9:	48 c1 e0 04          	shl    $0x4,%rax
+  801dad:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801db4:	00 00 00 
+  801db7:	48 01 d0             	add    %rdx,%rax
+  801dba:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  801dc1:	00 00 00 
+        return 0;
+  801dc4:	eb c2                	jmp    801d88 <fork+0x93>
+        return -1;
+  801dc6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801dcc:	eb ba                	jmp    801d88 <fork+0x93>
+        return -1;
+  801dce:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801dd4:	eb b2                	jmp    801d88 <fork+0x93>
+
+0000000000801dd6 <sfork>:
+
+envid_t
+sfork() {
+  801dd6:	55                   	push   %rbp
+  801dd7:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801dda:	48 ba 55 4d 80 00 00 	movabs $0x804d55,%rdx
+  801de1:	00 00 00 
+  801de4:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801de9:	48 bf 70 4d 80 00 00 	movabs $0x804d70,%rdi
+  801df0:	00 00 00 
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df8:	48 b9 24 08 80 00 00 	movabs $0x800824,%rcx
+  801dff:	00 00 00 
+  801e02:	ff d1                	call   *%rcx
+
+0000000000801e04 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e04:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e0b:	ff ff ff 
+  801e0e:	48 01 f8             	add    %rdi,%rax
+  801e11:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e15:	c3                   	ret
+
+0000000000801e16 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e16:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e1d:	ff ff ff 
+  801e20:	48 01 f8             	add    %rdi,%rax
+  801e23:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e27:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801e2d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801e31:	c3                   	ret
+
+0000000000801e32 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e32:	55                   	push   %rbp
+  801e33:	48 89 e5             	mov    %rsp,%rbp
+  801e36:	41 57                	push   %r15
+  801e38:	41 56                	push   %r14
+  801e3a:	41 55                	push   %r13
+  801e3c:	41 54                	push   %r12
+  801e3e:	53                   	push   %rbx
+  801e3f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e43:	49 89 ff             	mov    %rdi,%r15
+  801e46:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e4b:	49 bd 21 43 80 00 00 	movabs $0x804321,%r13
+  801e52:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e55:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e5b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e5e:	48 89 df             	mov    %rbx,%rdi
+  801e61:	41 ff d5             	call   *%r13
+  801e64:	83 e0 04             	and    $0x4,%eax
+  801e67:	74 17                	je     801e80 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e69:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e70:	4c 39 f3             	cmp    %r14,%rbx
+  801e73:	75 e6                	jne    801e5b <fd_alloc+0x29>
+  801e75:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e7b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e80:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e83:	48 83 c4 08          	add    $0x8,%rsp
+  801e87:	5b                   	pop    %rbx
+  801e88:	41 5c                	pop    %r12
+  801e8a:	41 5d                	pop    %r13
+  801e8c:	41 5e                	pop    %r14
+  801e8e:	41 5f                	pop    %r15
+  801e90:	5d                   	pop    %rbp
+  801e91:	c3                   	ret
+
+0000000000801e92 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e92:	83 ff 1f             	cmp    $0x1f,%edi
+  801e95:	77 39                	ja     801ed0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e97:	55                   	push   %rbp
+  801e98:	48 89 e5             	mov    %rsp,%rbp
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ea1:	48 63 df             	movslq %edi,%rbx
+  801ea4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801eab:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801eaf:	48 89 df             	mov    %rbx,%rdi
+  801eb2:	48 b8 21 43 80 00 00 	movabs $0x804321,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	a8 04                	test   $0x4,%al
+  801ec0:	74 14                	je     801ed6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ec2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ecb:	5b                   	pop    %rbx
+  801ecc:	41 5c                	pop    %r12
+  801ece:	5d                   	pop    %rbp
+  801ecf:	c3                   	ret
+        return -E_INVAL;
+  801ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ed5:	c3                   	ret
+        return -E_INVAL;
+  801ed6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edb:	eb ee                	jmp    801ecb <fd_lookup+0x39>
+
+0000000000801edd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801edd:	55                   	push   %rbp
+  801ede:	48 89 e5             	mov    %rsp,%rbp
+  801ee1:	41 54                	push   %r12
+  801ee3:	53                   	push   %rbx
+  801ee4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ee7:	48 b8 20 4e 80 00 00 	movabs $0x804e20,%rax
+  801eee:	00 00 00 
+  801ef1:	48 bb a0 60 80 00 00 	movabs $0x8060a0,%rbx
+  801ef8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801efb:	39 3b                	cmp    %edi,(%rbx)
+  801efd:	74 47                	je     801f46 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801eff:	48 83 c0 08          	add    $0x8,%rax
+  801f03:	48 8b 18             	mov    (%rax),%rbx
+  801f06:	48 85 db             	test   %rbx,%rbx
+  801f09:	75 f0                	jne    801efb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f0b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f12:	00 00 00 
+  801f15:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f1b:	89 fa                	mov    %edi,%edx
+  801f1d:	48 bf 80 4d 80 00 00 	movabs $0x804d80,%rdi
+  801f24:	00 00 00 
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2c:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  801f33:	00 00 00 
+  801f36:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f3d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f41:	5b                   	pop    %rbx
+  801f42:	41 5c                	pop    %r12
+  801f44:	5d                   	pop    %rbp
+  801f45:	c3                   	ret
+            return 0;
+  801f46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4b:	eb f0                	jmp    801f3d <dev_lookup+0x60>
+
+0000000000801f4d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f4d:	55                   	push   %rbp
+  801f4e:	48 89 e5             	mov    %rsp,%rbp
+  801f51:	41 55                	push   %r13
+  801f53:	41 54                	push   %r12
+  801f55:	53                   	push   %rbx
+  801f56:	48 83 ec 18          	sub    $0x18,%rsp
+  801f5a:	48 89 fb             	mov    %rdi,%rbx
+  801f5d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f60:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f67:	ff ff ff 
+  801f6a:	48 01 df             	add    %rbx,%rdi
+  801f6d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f71:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f75:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+  801f81:	41 89 c5             	mov    %eax,%r13d
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	78 06                	js     801f8e <fd_close+0x41>
+  801f88:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f8c:	74 1a                	je     801fa8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f8e:	45 84 e4             	test   %r12b,%r12b
+  801f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f96:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f9a:	44 89 e8             	mov    %r13d,%eax
+  801f9d:	48 83 c4 18          	add    $0x18,%rsp
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	41 5d                	pop    %r13
+  801fa6:	5d                   	pop    %rbp
+  801fa7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801fa8:	8b 3b                	mov    (%rbx),%edi
+  801faa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fae:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+  801fba:	41 89 c5             	mov    %eax,%r13d
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 1b                	js     801fdc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801fc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fc5:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801fc9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801fcf:	48 85 c0             	test   %rax,%rax
+  801fd2:	74 08                	je     801fdc <fd_close+0x8f>
+  801fd4:	48 89 df             	mov    %rbx,%rdi
+  801fd7:	ff d0                	call   *%rax
+  801fd9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801fdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fe1:	48 89 de             	mov    %rbx,%rsi
+  801fe4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe9:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+    return res;
+  801ff5:	eb a3                	jmp    801f9a <fd_close+0x4d>
+
+0000000000801ff7 <close>:
+
+int
+close(int fdnum) {
+  801ff7:	55                   	push   %rbp
+  801ff8:	48 89 e5             	mov    %rsp,%rbp
+  801ffb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802003:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80200f:	85 c0                	test   %eax,%eax
+  802011:	78 15                	js     802028 <close+0x31>
+
+    return fd_close(fd, 1);
+  802013:	be 01 00 00 00       	mov    $0x1,%esi
+  802018:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80201c:	48 b8 4d 1f 80 00 00 	movabs $0x801f4d,%rax
+  802023:	00 00 00 
+  802026:	ff d0                	call   *%rax
+}
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+000000000080202a <close_all>:
+
+void
+close_all(void) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  80202e:	41 54                	push   %r12
+  802030:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802036:	49 bc f7 1f 80 00 00 	movabs $0x801ff7,%r12
+  80203d:	00 00 00 
+  802040:	89 df                	mov    %ebx,%edi
+  802042:	41 ff d4             	call   *%r12
+  802045:	83 c3 01             	add    $0x1,%ebx
+  802048:	83 fb 20             	cmp    $0x20,%ebx
+  80204b:	75 f3                	jne    802040 <close_all+0x16>
+}
+  80204d:	5b                   	pop    %rbx
+  80204e:	41 5c                	pop    %r12
+  802050:	5d                   	pop    %rbp
+  802051:	c3                   	ret
+
+0000000000802052 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	41 57                	push   %r15
+  802058:	41 56                	push   %r14
+  80205a:	41 55                	push   %r13
+  80205c:	41 54                	push   %r12
+  80205e:	53                   	push   %rbx
+  80205f:	48 83 ec 18          	sub    $0x18,%rsp
+  802063:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802066:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80206a:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+  802076:	89 c3                	mov    %eax,%ebx
+  802078:	85 c0                	test   %eax,%eax
+  80207a:	0f 88 b8 00 00 00    	js     802138 <dup+0xe6>
+    close(newfdnum);
+  802080:	44 89 e7             	mov    %r12d,%edi
+  802083:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  80208a:	00 00 00 
+  80208d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80208f:	4d 63 ec             	movslq %r12d,%r13
+  802092:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802099:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80209d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020a1:	4c 89 ff             	mov    %r15,%rdi
+  8020a4:	49 be 16 1e 80 00 00 	movabs $0x801e16,%r14
+  8020ab:	00 00 00 
+  8020ae:	41 ff d6             	call   *%r14
+  8020b1:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8020b4:	4c 89 ef             	mov    %r13,%rdi
+  8020b7:	41 ff d6             	call   *%r14
+  8020ba:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8020bd:	48 89 df             	mov    %rbx,%rdi
+  8020c0:	48 b8 21 43 80 00 00 	movabs $0x804321,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8020cc:	a8 04                	test   $0x4,%al
+  8020ce:	74 2b                	je     8020fb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8020d0:	41 89 c1             	mov    %eax,%r9d
+  8020d3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020d9:	4c 89 f1             	mov    %r14,%rcx
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	48 89 de             	mov    %rbx,%rsi
+  8020e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e9:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+  8020f5:	89 c3                	mov    %eax,%ebx
+  8020f7:	85 c0                	test   %eax,%eax
+  8020f9:	78 4e                	js     802149 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8020fb:	4c 89 ff             	mov    %r15,%rdi
+  8020fe:	48 b8 21 43 80 00 00 	movabs $0x804321,%rax
+  802105:	00 00 00 
+  802108:	ff d0                	call   *%rax
+  80210a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80210d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802113:	4c 89 e9             	mov    %r13,%rcx
+  802116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211b:	4c 89 fe             	mov    %r15,%rsi
+  80211e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802123:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  80212a:	00 00 00 
+  80212d:	ff d0                	call   *%rax
+  80212f:	89 c3                	mov    %eax,%ebx
+  802131:	85 c0                	test   %eax,%eax
+  802133:	78 14                	js     802149 <dup+0xf7>
+
+    return newfdnum;
+  802135:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802138:	89 d8                	mov    %ebx,%eax
+  80213a:	48 83 c4 18          	add    $0x18,%rsp
+  80213e:	5b                   	pop    %rbx
+  80213f:	41 5c                	pop    %r12
+  802141:	41 5d                	pop    %r13
+  802143:	41 5e                	pop    %r14
+  802145:	41 5f                	pop    %r15
+  802147:	5d                   	pop    %rbp
+  802148:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802149:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80214e:	4c 89 ee             	mov    %r13,%rsi
+  802151:	bf 00 00 00 00       	mov    $0x0,%edi
+  802156:	49 bc f1 19 80 00 00 	movabs $0x8019f1,%r12
+  80215d:	00 00 00 
+  802160:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802163:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802168:	4c 89 f6             	mov    %r14,%rsi
+  80216b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802170:	41 ff d4             	call   *%r12
+    return res;
+  802173:	eb c3                	jmp    802138 <dup+0xe6>
+
+0000000000802175 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802175:	55                   	push   %rbp
+  802176:	48 89 e5             	mov    %rsp,%rbp
+  802179:	41 56                	push   %r14
+  80217b:	41 55                	push   %r13
+  80217d:	41 54                	push   %r12
+  80217f:	53                   	push   %rbx
+  802180:	48 83 ec 10          	sub    $0x10,%rsp
+  802184:	89 fb                	mov    %edi,%ebx
+  802186:	49 89 f4             	mov    %rsi,%r12
+  802189:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80218c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802190:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802197:	00 00 00 
+  80219a:	ff d0                	call   *%rax
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	78 4c                	js     8021ec <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021a4:	41 8b 3e             	mov    (%r14),%edi
+  8021a7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021ab:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8021b2:	00 00 00 
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 35                	js     8021f0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021bb:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8021bf:	83 e0 03             	and    $0x3,%eax
+  8021c2:	83 f8 01             	cmp    $0x1,%eax
+  8021c5:	74 2d                	je     8021f4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021cb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8021cf:	48 85 c0             	test   %rax,%rax
+  8021d2:	74 56                	je     80222a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8021d4:	4c 89 ea             	mov    %r13,%rdx
+  8021d7:	4c 89 e6             	mov    %r12,%rsi
+  8021da:	4c 89 f7             	mov    %r14,%rdi
+  8021dd:	ff d0                	call   *%rax
+}
+  8021df:	48 83 c4 10          	add    $0x10,%rsp
+  8021e3:	5b                   	pop    %rbx
+  8021e4:	41 5c                	pop    %r12
+  8021e6:	41 5d                	pop    %r13
+  8021e8:	41 5e                	pop    %r14
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ec:	48 98                	cltq
+  8021ee:	eb ef                	jmp    8021df <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021f0:	48 98                	cltq
+  8021f2:	eb eb                	jmp    8021df <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021fb:	00 00 00 
+  8021fe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802204:	89 da                	mov    %ebx,%edx
+  802206:	48 bf e1 4d 80 00 00 	movabs $0x804de1,%rdi
+  80220d:	00 00 00 
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+  802215:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  80221c:	00 00 00 
+  80221f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802221:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802228:	eb b5                	jmp    8021df <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80222a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802231:	eb ac                	jmp    8021df <read+0x6a>
+
+0000000000802233 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  802233:	55                   	push   %rbp
+  802234:	48 89 e5             	mov    %rsp,%rbp
+  802237:	41 56                	push   %r14
+  802239:	41 55                	push   %r13
+  80223b:	41 54                	push   %r12
+  80223d:	53                   	push   %rbx
+  80223e:	48 83 ec 10          	sub    $0x10,%rsp
+  802242:	89 fb                	mov    %edi,%ebx
+  802244:	49 89 f4             	mov    %rsi,%r12
+  802247:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80224e:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802255:	00 00 00 
+  802258:	ff d0                	call   *%rax
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 41                	js     80229f <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80225e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802262:	41 8b 3e             	mov    (%r14),%edi
+  802265:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802269:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	85 c0                	test   %eax,%eax
+  802277:	78 35                	js     8022ae <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802279:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80227d:	83 e0 03             	and    $0x3,%eax
+  802280:	83 f8 01             	cmp    $0x1,%eax
+  802283:	74 2d                	je     8022b2 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  802285:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802289:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80228d:	48 85 c0             	test   %rax,%rax
+  802290:	74 56                	je     8022e8 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  802292:	4c 89 ea             	mov    %r13,%rdx
+  802295:	4c 89 e6             	mov    %r12,%rsi
+  802298:	4c 89 f7             	mov    %r14,%rdi
+  80229b:	ff d0                	call   *%rax
+  80229d:	eb 02                	jmp    8022a1 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80229f:	48 98                	cltq
+}
+  8022a1:	48 83 c4 10          	add    $0x10,%rsp
+  8022a5:	5b                   	pop    %rbx
+  8022a6:	41 5c                	pop    %r12
+  8022a8:	41 5d                	pop    %r13
+  8022aa:	41 5e                	pop    %r14
+  8022ac:	5d                   	pop    %rbp
+  8022ad:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ae:	48 98                	cltq
+  8022b0:	eb ef                	jmp    8022a1 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022b2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022b9:	00 00 00 
+  8022bc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022c2:	89 da                	mov    %ebx,%edx
+  8022c4:	48 bf a0 4d 80 00 00 	movabs $0x804da0,%rdi
+  8022cb:	00 00 00 
+  8022ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d3:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  8022da:	00 00 00 
+  8022dd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022e6:	eb b9                	jmp    8022a1 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  8022e8:	4c 89 ea             	mov    %r13,%rdx
+  8022eb:	4c 89 e6             	mov    %r12,%rsi
+  8022ee:	89 df                	mov    %ebx,%edi
+  8022f0:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+  8022fc:	eb a3                	jmp    8022a1 <readmap+0x6e>
+
+00000000008022fe <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8022fe:	55                   	push   %rbp
+  8022ff:	48 89 e5             	mov    %rsp,%rbp
+  802302:	41 57                	push   %r15
+  802304:	41 56                	push   %r14
+  802306:	41 55                	push   %r13
+  802308:	41 54                	push   %r12
+  80230a:	53                   	push   %rbx
+  80230b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80230f:	48 85 d2             	test   %rdx,%rdx
+  802312:	74 54                	je     802368 <readn+0x6a>
+  802314:	41 89 fd             	mov    %edi,%r13d
+  802317:	49 89 f6             	mov    %rsi,%r14
+  80231a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80231d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802322:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802327:	49 bf 75 21 80 00 00 	movabs $0x802175,%r15
+  80232e:	00 00 00 
+  802331:	4c 89 e2             	mov    %r12,%rdx
+  802334:	48 29 f2             	sub    %rsi,%rdx
+  802337:	4c 01 f6             	add    %r14,%rsi
+  80233a:	44 89 ef             	mov    %r13d,%edi
+  80233d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802340:	85 c0                	test   %eax,%eax
+  802342:	78 20                	js     802364 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802344:	01 c3                	add    %eax,%ebx
+  802346:	85 c0                	test   %eax,%eax
+  802348:	74 08                	je     802352 <readn+0x54>
+  80234a:	48 63 f3             	movslq %ebx,%rsi
+  80234d:	4c 39 e6             	cmp    %r12,%rsi
+  802350:	72 df                	jb     802331 <readn+0x33>
+    }
+    return res;
+  802352:	48 63 c3             	movslq %ebx,%rax
+}
+  802355:	48 83 c4 08          	add    $0x8,%rsp
+  802359:	5b                   	pop    %rbx
+  80235a:	41 5c                	pop    %r12
+  80235c:	41 5d                	pop    %r13
+  80235e:	41 5e                	pop    %r14
+  802360:	41 5f                	pop    %r15
+  802362:	5d                   	pop    %rbp
+  802363:	c3                   	ret
+        if (inc < 0) return inc;
+  802364:	48 98                	cltq
+  802366:	eb ed                	jmp    802355 <readn+0x57>
+    int inc = 1, res = 0;
+  802368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80236d:	eb e3                	jmp    802352 <readn+0x54>
+
+000000000080236f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80236f:	55                   	push   %rbp
+  802370:	48 89 e5             	mov    %rsp,%rbp
+  802373:	41 56                	push   %r14
+  802375:	41 55                	push   %r13
+  802377:	41 54                	push   %r12
+  802379:	53                   	push   %rbx
+  80237a:	48 83 ec 10          	sub    $0x10,%rsp
+  80237e:	89 fb                	mov    %edi,%ebx
+  802380:	49 89 f4             	mov    %rsi,%r12
+  802383:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802386:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80238a:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+  802396:	85 c0                	test   %eax,%eax
+  802398:	78 47                	js     8023e1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80239a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80239e:	41 8b 3e             	mov    (%r14),%edi
+  8023a1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023a5:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	78 30                	js     8023e5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023b5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8023ba:	74 2d                	je     8023e9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023c0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023c4:	48 85 c0             	test   %rax,%rax
+  8023c7:	74 56                	je     80241f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8023c9:	4c 89 ea             	mov    %r13,%rdx
+  8023cc:	4c 89 e6             	mov    %r12,%rsi
+  8023cf:	4c 89 f7             	mov    %r14,%rdi
+  8023d2:	ff d0                	call   *%rax
+}
+  8023d4:	48 83 c4 10          	add    $0x10,%rsp
+  8023d8:	5b                   	pop    %rbx
+  8023d9:	41 5c                	pop    %r12
+  8023db:	41 5d                	pop    %r13
+  8023dd:	41 5e                	pop    %r14
+  8023df:	5d                   	pop    %rbp
+  8023e0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023e1:	48 98                	cltq
+  8023e3:	eb ef                	jmp    8023d4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023e5:	48 98                	cltq
+  8023e7:	eb eb                	jmp    8023d4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023e9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023f0:	00 00 00 
+  8023f3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023f9:	89 da                	mov    %ebx,%edx
+  8023fb:	48 bf fd 4d 80 00 00 	movabs $0x804dfd,%rdi
+  802402:	00 00 00 
+  802405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240a:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  802411:	00 00 00 
+  802414:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802416:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80241d:	eb b5                	jmp    8023d4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80241f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802426:	eb ac                	jmp    8023d4 <write+0x65>
+
+0000000000802428 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+  80242c:	53                   	push   %rbx
+  80242d:	48 83 ec 18          	sub    $0x18,%rsp
+  802431:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802433:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802437:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+  802443:	85 c0                	test   %eax,%eax
+  802445:	78 0c                	js     802453 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802447:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80244e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802453:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802457:	c9                   	leave
+  802458:	c3                   	ret
+
+0000000000802459 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802459:	55                   	push   %rbp
+  80245a:	48 89 e5             	mov    %rsp,%rbp
+  80245d:	41 55                	push   %r13
+  80245f:	41 54                	push   %r12
+  802461:	53                   	push   %rbx
+  802462:	48 83 ec 18          	sub    $0x18,%rsp
+  802466:	89 fb                	mov    %edi,%ebx
+  802468:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80246b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80246f:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802476:	00 00 00 
+  802479:	ff d0                	call   *%rax
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 38                	js     8024b7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80247f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802483:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802487:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80248b:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+  802497:	85 c0                	test   %eax,%eax
+  802499:	78 1c                	js     8024b7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80249b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024a0:	74 20                	je     8024c2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024a6:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8024aa:	48 85 c0             	test   %rax,%rax
+  8024ad:	74 47                	je     8024f6 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024af:	44 89 e6             	mov    %r12d,%esi
+  8024b2:	4c 89 ef             	mov    %r13,%rdi
+  8024b5:	ff d0                	call   *%rax
+}
+  8024b7:	48 83 c4 18          	add    $0x18,%rsp
+  8024bb:	5b                   	pop    %rbx
+  8024bc:	41 5c                	pop    %r12
+  8024be:	41 5d                	pop    %r13
+  8024c0:	5d                   	pop    %rbp
+  8024c1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8024c2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024c9:	00 00 00 
+  8024cc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024d2:	89 da                	mov    %ebx,%edx
+  8024d4:	48 bf c0 4d 80 00 00 	movabs $0x804dc0,%rdi
+  8024db:	00 00 00 
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e3:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  8024ea:	00 00 00 
+  8024ed:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024f4:	eb c1                	jmp    8024b7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024f6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024fb:	eb ba                	jmp    8024b7 <ftruncate+0x5e>
+
+00000000008024fd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024fd:	55                   	push   %rbp
+  8024fe:	48 89 e5             	mov    %rsp,%rbp
+  802501:	41 54                	push   %r12
+  802503:	53                   	push   %rbx
+  802504:	48 83 ec 10          	sub    $0x10,%rsp
+  802508:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80250b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80250f:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  802516:	00 00 00 
+  802519:	ff d0                	call   *%rax
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 4e                	js     80256d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80251f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802523:	41 8b 3c 24          	mov    (%r12),%edi
+  802527:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80252b:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 32                	js     80256d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80253b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80253f:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  802544:	74 30                	je     802576 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802546:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802549:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802550:	00 00 00 
+    stat->st_isdir = 0;
+  802553:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80255a:	00 00 00 
+    stat->st_dev = dev;
+  80255d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802564:	48 89 de             	mov    %rbx,%rsi
+  802567:	4c 89 e7             	mov    %r12,%rdi
+  80256a:	ff 50 30             	call   *0x30(%rax)
+}
+  80256d:	48 83 c4 10          	add    $0x10,%rsp
+  802571:	5b                   	pop    %rbx
+  802572:	41 5c                	pop    %r12
+  802574:	5d                   	pop    %rbp
+  802575:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802576:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80257b:	eb f0                	jmp    80256d <fstat+0x70>
+
+000000000080257d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	41 54                	push   %r12
+  802583:	53                   	push   %rbx
+  802584:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802587:	be 00 00 00 00       	mov    $0x0,%esi
+  80258c:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  802593:	00 00 00 
+  802596:	ff d0                	call   *%rax
+  802598:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	78 25                	js     8025c3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80259e:	4c 89 e6             	mov    %r12,%rsi
+  8025a1:	89 c7                	mov    %eax,%edi
+  8025a3:	48 b8 fd 24 80 00 00 	movabs $0x8024fd,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8025b2:	89 df                	mov    %ebx,%edi
+  8025b4:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+
+    return res;
+  8025c0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8025c3:	89 d8                	mov    %ebx,%eax
+  8025c5:	5b                   	pop    %rbx
+  8025c6:	41 5c                	pop    %r12
+  8025c8:	5d                   	pop    %rbp
+  8025c9:	c3                   	ret
+
+00000000008025ca <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  8025ca:	55                   	push   %rbp
+  8025cb:	48 89 e5             	mov    %rsp,%rbp
+  8025ce:	41 54                	push   %r12
+  8025d0:	53                   	push   %rbx
+  8025d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d5:	48 89 fb             	mov    %rdi,%rbx
+  8025d8:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8025db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025df:	bf 66 00 00 00       	mov    $0x66,%edi
+  8025e4:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8025eb:	00 00 00 
+  8025ee:	ff d0                	call   *%rax
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	78 1f                	js     802613 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  8025f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025f8:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8025fc:	48 85 c0             	test   %rax,%rax
+  8025ff:	74 1b                	je     80261c <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  802601:	4c 89 e6             	mov    %r12,%rsi
+  802604:	48 89 df             	mov    %rbx,%rdi
+  802607:	ff d0                	call   *%rax
+    if (res < 0) {
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802610:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802613:	48 83 c4 10          	add    $0x10,%rsp
+  802617:	5b                   	pop    %rbx
+  802618:	41 5c                	pop    %r12
+  80261a:	5d                   	pop    %rbp
+  80261b:	c3                   	ret
+        return -E_NOT_SUPP;
+  80261c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802621:	eb f0                	jmp    802613 <create_snapshot+0x49>
+
+0000000000802623 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  802623:	55                   	push   %rbp
+  802624:	48 89 e5             	mov    %rsp,%rbp
+  802627:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80262b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80262f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802634:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  80263b:	00 00 00 
+  80263e:	ff d0                	call   *%rax
+  802640:	85 c0                	test   %eax,%eax
+  802642:	78 1e                	js     802662 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  802644:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802648:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80264c:	48 85 d2             	test   %rdx,%rdx
+  80264f:	74 13                	je     802664 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  802651:	b8 00 00 00 00       	mov    $0x0,%eax
+  802656:	ff d2                	call   *%rdx
+    if (res < 0) {
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265f:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+        return -E_NOT_SUPP;
+  802664:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802669:	eb f7                	jmp    802662 <print_snapshot_list+0x3f>
+
+000000000080266b <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  80266b:	55                   	push   %rbp
+  80266c:	48 89 e5             	mov    %rsp,%rbp
+  80266f:	53                   	push   %rbx
+  802670:	48 83 ec 18          	sub    $0x18,%rsp
+  802674:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802677:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80267b:	bf 66 00 00 00       	mov    $0x66,%edi
+  802680:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+  80268c:	85 c0                	test   %eax,%eax
+  80268e:	78 1c                	js     8026ac <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  802690:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802694:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802698:	48 85 c0             	test   %rax,%rax
+  80269b:	74 15                	je     8026b2 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  80269d:	48 89 df             	mov    %rbx,%rdi
+  8026a0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a9:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8026ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026b0:	c9                   	leave
+  8026b1:	c3                   	ret
+        return -E_NOT_SUPP;
+  8026b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026b7:	eb f3                	jmp    8026ac <accept_snapshot+0x41>
+
+00000000008026b9 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  8026b9:	55                   	push   %rbp
+  8026ba:	48 89 e5             	mov    %rsp,%rbp
+  8026bd:	53                   	push   %rbx
+  8026be:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c2:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8026c5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026c9:	bf 66 00 00 00       	mov    $0x66,%edi
+  8026ce:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8026d5:	00 00 00 
+  8026d8:	ff d0                	call   *%rax
+  8026da:	85 c0                	test   %eax,%eax
+  8026dc:	78 1c                	js     8026fa <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  8026de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e2:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8026e6:	48 85 c0             	test   %rax,%rax
+  8026e9:	74 15                	je     802700 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  8026eb:	48 89 df             	mov    %rbx,%rdi
+  8026ee:	ff d0                	call   *%rax
+    if (res < 0) {
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f7:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8026fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026fe:	c9                   	leave
+  8026ff:	c3                   	ret
+        return -E_NOT_SUPP;
+  802700:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802705:	eb f3                	jmp    8026fa <delete_snapshot+0x41>
+
+0000000000802707 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802707:	55                   	push   %rbp
+  802708:	48 89 e5             	mov    %rsp,%rbp
+  80270b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80270f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802713:	bf 66 00 00 00       	mov    $0x66,%edi
+  802718:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+  802724:	85 c0                	test   %eax,%eax
+  802726:	78 14                	js     80273c <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  802728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80272c:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  802730:	48 85 d2             	test   %rdx,%rdx
+  802733:	74 09                	je     80273e <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  802735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273a:	ff d2                	call   *%rdx
+
+    return res;
+}
+  80273c:	c9                   	leave
+  80273d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80273e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802743:	eb f7                	jmp    80273c <gc_snapshots+0x35>
+
+0000000000802745 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802745:	55                   	push   %rbp
+  802746:	48 89 e5             	mov    %rsp,%rbp
+  802749:	41 56                	push   %r14
+  80274b:	41 55                	push   %r13
+  80274d:	41 54                	push   %r12
+  80274f:	53                   	push   %rbx
+  802750:	48 83 ec 10          	sub    $0x10,%rsp
+  802754:	48 89 fb             	mov    %rdi,%rbx
+  802757:	49 89 f4             	mov    %rsi,%r12
+  80275a:	49 89 d5             	mov    %rdx,%r13
+  80275d:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802760:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802764:	bf 66 00 00 00       	mov    $0x66,%edi
+  802769:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  802770:	00 00 00 
+  802773:	ff d0                	call   *%rax
+  802775:	85 c0                	test   %eax,%eax
+  802777:	78 1b                	js     802794 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  802779:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80277d:	48 8b 40 68          	mov    0x68(%rax),%rax
+  802781:	48 85 c0             	test   %rax,%rax
+  802784:	74 1b                	je     8027a1 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802786:	4c 89 f1             	mov    %r14,%rcx
+  802789:	4c 89 ea             	mov    %r13,%rdx
+  80278c:	4c 89 e6             	mov    %r12,%rsi
+  80278f:	48 89 df             	mov    %rbx,%rdi
+  802792:	ff d0                	call   *%rax
+
+    return res;
+}
+  802794:	48 83 c4 10          	add    $0x10,%rsp
+  802798:	5b                   	pop    %rbx
+  802799:	41 5c                	pop    %r12
+  80279b:	41 5d                	pop    %r13
+  80279d:	41 5e                	pop    %r14
+  80279f:	5d                   	pop    %rbp
+  8027a0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8027a1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027a6:	eb ec                	jmp    802794 <diff_snapshots+0x4f>
+
+00000000008027a8 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  8027a8:	55                   	push   %rbp
+  8027a9:	48 89 e5             	mov    %rsp,%rbp
+  8027ac:	41 55                	push   %r13
+  8027ae:	41 54                	push   %r12
+  8027b0:	53                   	push   %rbx
+  8027b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027b5:	48 89 fb             	mov    %rdi,%rbx
+  8027b8:	49 89 f4             	mov    %rsi,%r12
+  8027bb:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8027be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027c2:	bf 66 00 00 00       	mov    $0x66,%edi
+  8027c7:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+  8027d3:	85 c0                	test   %eax,%eax
+  8027d5:	78 18                	js     8027ef <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  8027d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027db:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8027df:	48 85 c0             	test   %rax,%rax
+  8027e2:	74 16                	je     8027fa <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  8027e4:	4c 89 ea             	mov    %r13,%rdx
+  8027e7:	4c 89 e6             	mov    %r12,%rsi
+  8027ea:	48 89 df             	mov    %rbx,%rdi
+  8027ed:	ff d0                	call   *%rax
+
+    return res;
+}
+  8027ef:	48 83 c4 18          	add    $0x18,%rsp
+  8027f3:	5b                   	pop    %rbx
+  8027f4:	41 5c                	pop    %r12
+  8027f6:	41 5d                	pop    %r13
+  8027f8:	5d                   	pop    %rbp
+  8027f9:	c3                   	ret
+        return -E_NOT_SUPP;
+  8027fa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027ff:	eb ee                	jmp    8027ef <send_snapshot+0x47>
+
+0000000000802801 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  802801:	55                   	push   %rbp
+  802802:	48 89 e5             	mov    %rsp,%rbp
+  802805:	53                   	push   %rbx
+  802806:	48 83 ec 18          	sub    $0x18,%rsp
+  80280a:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80280d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802811:	bf 66 00 00 00       	mov    $0x66,%edi
+  802816:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+  802822:	85 c0                	test   %eax,%eax
+  802824:	78 12                	js     802838 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  802826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282a:	48 8b 40 78          	mov    0x78(%rax),%rax
+  80282e:	48 85 c0             	test   %rax,%rax
+  802831:	74 0b                	je     80283e <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802833:	48 89 df             	mov    %rbx,%rdi
+  802836:	ff d0                	call   *%rax
+
+    return res;
+}
+  802838:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80283e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802843:	eb f3                	jmp    802838 <receive_snapshot+0x37>
+
+0000000000802845 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802845:	55                   	push   %rbp
+  802846:	48 89 e5             	mov    %rsp,%rbp
+  802849:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80284d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802851:	bf 66 00 00 00       	mov    $0x66,%edi
+  802856:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 17                	js     80287d <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  802866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80286a:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802871:	48 85 d2             	test   %rdx,%rdx
+  802874:	74 09                	je     80287f <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  802876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287b:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80287f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802884:	eb f7                	jmp    80287d <free_space_bytes+0x38>
+
+0000000000802886 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802886:	55                   	push   %rbp
+  802887:	48 89 e5             	mov    %rsp,%rbp
+  80288a:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80288e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802892:	bf 66 00 00 00       	mov    $0x66,%edi
+  802897:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	78 17                	js     8028be <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  8028a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ab:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8028b2:	48 85 d2             	test   %rdx,%rdx
+  8028b5:	74 09                	je     8028c0 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  8028b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bc:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+        return -E_NOT_SUPP;
+  8028c0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028c5:	eb f7                	jmp    8028be <busy_space_bytes+0x38>
+
+00000000008028c7 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+  8028cb:	41 54                	push   %r12
+  8028cd:	53                   	push   %rbx
+  8028ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8028d2:	89 fb                	mov    %edi,%ebx
+  8028d4:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8028d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028db:	bf 66 00 00 00       	mov    $0x66,%edi
+  8028e0:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	78 17                	js     802907 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8028f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028f4:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8028fb:	48 85 c0             	test   %rax,%rax
+  8028fe:	74 10                	je     802910 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  802900:	4c 89 e6             	mov    %r12,%rsi
+  802903:	89 df                	mov    %ebx,%edi
+  802905:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802907:	48 83 c4 10          	add    $0x10,%rsp
+  80290b:	5b                   	pop    %rbx
+  80290c:	41 5c                	pop    %r12
+  80290e:	5d                   	pop    %rbp
+  80290f:	c3                   	ret
+        return -E_NOT_SUPP;
+  802910:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802915:	eb f0                	jmp    802907 <snapshots_space+0x40>
+
+0000000000802917 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802917:	55                   	push   %rbp
+  802918:	48 89 e5             	mov    %rsp,%rbp
+  80291b:	41 55                	push   %r13
+  80291d:	41 54                	push   %r12
+  80291f:	53                   	push   %rbx
+  802920:	48 83 ec 08          	sub    $0x8,%rsp
+  802924:	41 89 fd             	mov    %edi,%r13d
+  802927:	48 89 f3             	mov    %rsi,%rbx
+  80292a:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80292d:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802934:	00 00 00 
+  802937:	83 38 00             	cmpl   $0x0,(%rax)
+  80293a:	74 57                	je     802993 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80293c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802942:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802947:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80294e:	00 00 00 
+  802951:	44 89 ee             	mov    %r13d,%esi
+  802954:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80295b:	00 00 00 
+  80295e:	8b 38                	mov    (%rax),%edi
+  802960:	48 b8 39 45 80 00 00 	movabs $0x804539,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  80296c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802971:	4c 89 e2             	mov    %r12,%rdx
+  802974:	48 89 de             	mov    %rbx,%rsi
+  802977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297c:	48 b8 21 45 80 00 00 	movabs $0x804521,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+}
+  802988:	48 83 c4 08          	add    $0x8,%rsp
+  80298c:	5b                   	pop    %rbx
+  80298d:	41 5c                	pop    %r12
+  80298f:	41 5d                	pop    %r13
+  802991:	5d                   	pop    %rbp
+  802992:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802993:	bf 03 00 00 00       	mov    $0x3,%edi
+  802998:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+  8029a4:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8029ab:	00 00 
+  8029ad:	eb 8d                	jmp    80293c <fsipc_region+0x25>
+
+00000000008029af <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  8029b7:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8029be:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8029bf:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8029c3:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+}
+  8029cf:	c9                   	leave
+  8029d0:	c3                   	ret
+
+00000000008029d1 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8029d1:	85 ff                	test   %edi,%edi
+  8029d3:	78 6d                	js     802a42 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 54                	push   %r12
+  8029db:	53                   	push   %rbx
+  8029dc:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8029df:	48 85 f6             	test   %rsi,%rsi
+  8029e2:	74 57                	je     802a3b <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8029e4:	89 f8                	mov    %edi,%eax
+  8029e6:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8029ed:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8029ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f4:	bf 12 00 00 00       	mov    $0x12,%edi
+  8029f9:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802a00:	00 00 00 
+  802a03:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	78 2d                	js     802a36 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802a09:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802a10:	00 00 00 
+  802a13:	49 63 14 24          	movslq (%r12),%rdx
+  802a17:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802a1e:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802a23:	48 89 df             	mov    %rbx,%rdi
+  802a26:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802a32:	41 8b 04 24          	mov    (%r12),%eax
+}
+  802a36:	5b                   	pop    %rbx
+  802a37:	41 5c                	pop    %r12
+  802a39:	5d                   	pop    %rbp
+  802a3a:	c3                   	ret
+        return -E_INVAL;
+  802a3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a40:	eb f4                	jmp    802a36 <devfile_df_snapshots+0x65>
+  802a42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a47:	c3                   	ret
+
+0000000000802a48 <devfile_df_busy>:
+devfile_df_busy() {
+  802a48:	55                   	push   %rbp
+  802a49:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a51:	bf 11 00 00 00       	mov    $0x11,%edi
+  802a56:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+}
+  802a62:	5d                   	pop    %rbp
+  802a63:	c3                   	ret
+
+0000000000802a64 <devfile_df_free>:
+devfile_df_free() {
+  802a64:	55                   	push   %rbp
+  802a65:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  802a68:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6d:	bf 10 00 00 00       	mov    $0x10,%edi
+  802a72:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+}
+  802a7e:	5d                   	pop    %rbp
+  802a7f:	c3                   	ret
+
+0000000000802a80 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802a80:	55                   	push   %rbp
+  802a81:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802a84:	be 00 00 00 00       	mov    $0x0,%esi
+  802a89:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802a8e:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+}
+  802a9a:	5d                   	pop    %rbp
+  802a9b:	c3                   	ret
+
+0000000000802a9c <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802aa0:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa5:	bf 09 00 00 00       	mov    $0x9,%edi
+  802aaa:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802ab1:	00 00 00 
+  802ab4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abd:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ac0:	5d                   	pop    %rbp
+  802ac1:	c3                   	ret
+
+0000000000802ac2 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ac2:	55                   	push   %rbp
+  802ac3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ac6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802acd:	00 00 00 
+  802ad0:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802ad3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ad5:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802ad8:	be 00 00 00 00       	mov    $0x0,%esi
+  802add:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ae2:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802ae9:	00 00 00 
+  802aec:	ff d0                	call   *%rax
+}
+  802aee:	5d                   	pop    %rbp
+  802aef:	c3                   	ret
+
+0000000000802af0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802af0:	55                   	push   %rbp
+  802af1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802af4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802af7:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802afe:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802b00:	be 00 00 00 00       	mov    $0x0,%esi
+  802b05:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b0a:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+}
+  802b16:	5d                   	pop    %rbp
+  802b17:	c3                   	ret
+
+0000000000802b18 <devfile_write>:
+    if (!fd || !buf) {
+  802b18:	48 85 ff             	test   %rdi,%rdi
+  802b1b:	0f 84 c1 00 00 00    	je     802be2 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b21:	55                   	push   %rbp
+  802b22:	48 89 e5             	mov    %rsp,%rbp
+  802b25:	41 57                	push   %r15
+  802b27:	41 56                	push   %r14
+  802b29:	41 55                	push   %r13
+  802b2b:	41 54                	push   %r12
+  802b2d:	53                   	push   %rbx
+  802b2e:	48 83 ec 18          	sub    $0x18,%rsp
+  802b32:	49 89 ff             	mov    %rdi,%r15
+  802b35:	49 89 f5             	mov    %rsi,%r13
+  802b38:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802b3b:	48 85 f6             	test   %rsi,%rsi
+  802b3e:	0f 84 95 00 00 00    	je     802bd9 <devfile_write+0xc1>
+    while (n) {
+  802b44:	48 85 d2             	test   %rdx,%rdx
+  802b47:	0f 84 83 00 00 00    	je     802bd0 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802b4d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b54:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802b5b:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802b5e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802b63:	49 39 dc             	cmp    %rbx,%r12
+  802b66:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  802b6a:	48 89 da             	mov    %rbx,%rdx
+  802b6d:	4c 89 ee             	mov    %r13,%rsi
+  802b70:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802b77:	00 00 00 
+  802b7a:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  802b81:	00 00 00 
+  802b84:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b86:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b8a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802b8d:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802b91:	be 00 00 00 00       	mov    $0x0,%esi
+  802b96:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b9b:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+        if (write < 0) {
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	78 21                	js     802bcc <devfile_write+0xb4>
+        buf += write;
+  802bab:	48 63 d0             	movslq %eax,%rdx
+  802bae:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802bb1:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802bb4:	49 29 d4             	sub    %rdx,%r12
+  802bb7:	75 a5                	jne    802b5e <devfile_write+0x46>
+    return totalWrite;
+  802bb9:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  802bbd:	48 83 c4 18          	add    $0x18,%rsp
+  802bc1:	5b                   	pop    %rbx
+  802bc2:	41 5c                	pop    %r12
+  802bc4:	41 5d                	pop    %r13
+  802bc6:	41 5e                	pop    %r14
+  802bc8:	41 5f                	pop    %r15
+  802bca:	5d                   	pop    %rbp
+  802bcb:	c3                   	ret
+            return write;
+  802bcc:	48 98                	cltq
+  802bce:	eb ed                	jmp    802bbd <devfile_write+0xa5>
+    int totalWrite = 0;
+  802bd0:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802bd7:	eb e0                	jmp    802bb9 <devfile_write+0xa1>
+        return -E_INVAL;
+  802bd9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802be0:	eb db                	jmp    802bbd <devfile_write+0xa5>
+  802be2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802be9:	c3                   	ret
+
+0000000000802bea <devfile_read>:
+    if (!fd || !buf) {
+  802bea:	48 85 ff             	test   %rdi,%rdi
+  802bed:	0f 84 c0 00 00 00    	je     802cb3 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	41 57                	push   %r15
+  802bf9:	41 56                	push   %r14
+  802bfb:	41 55                	push   %r13
+  802bfd:	41 54                	push   %r12
+  802bff:	53                   	push   %rbx
+  802c00:	48 83 ec 18          	sub    $0x18,%rsp
+  802c04:	49 89 ff             	mov    %rdi,%r15
+  802c07:	49 89 f5             	mov    %rsi,%r13
+  802c0a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802c0d:	48 85 f6             	test   %rsi,%rsi
+  802c10:	0f 84 96 00 00 00    	je     802cac <devfile_read+0xc2>
+    while (n) {
+  802c16:	48 85 d2             	test   %rdx,%rdx
+  802c19:	0f 84 87 00 00 00    	je     802ca6 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802c1f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c26:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c27:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802c2e:	00 00 00 
+  802c31:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c35:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  802c38:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802c3d:	49 39 c4             	cmp    %rax,%r12
+  802c40:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802c44:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  802c48:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c52:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802c5e:	85 c0                	test   %eax,%eax
+  802c60:	7e 37                	jle    802c99 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802c62:	48 63 d8             	movslq %eax,%rbx
+  802c65:	48 89 da             	mov    %rbx,%rdx
+  802c68:	4c 89 f6             	mov    %r14,%rsi
+  802c6b:	4c 89 ef             	mov    %r13,%rdi
+  802c6e:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+        buf += read;
+  802c7a:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802c7d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802c81:	49 29 dc             	sub    %rbx,%r12
+  802c84:	75 ab                	jne    802c31 <devfile_read+0x47>
+  return totalRead;
+  802c86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802c8a:	48 83 c4 18          	add    $0x18,%rsp
+  802c8e:	5b                   	pop    %rbx
+  802c8f:	41 5c                	pop    %r12
+  802c91:	41 5d                	pop    %r13
+  802c93:	41 5e                	pop    %r14
+  802c95:	41 5f                	pop    %r15
+  802c97:	5d                   	pop    %rbp
+  802c98:	c3                   	ret
+            return read ? read : totalRead;
+  802c99:	48 63 d0             	movslq %eax,%rdx
+  802c9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ca0:	48 0f 45 c2          	cmovne %rdx,%rax
+  802ca4:	eb e4                	jmp    802c8a <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802ca6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802caa:	eb da                	jmp    802c86 <devfile_read+0x9c>
+        return E_INVAL;
+  802cac:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cb1:	eb d7                	jmp    802c8a <devfile_read+0xa0>
+  802cb3:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802cb8:	c3                   	ret
+
+0000000000802cb9 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802cb9:	48 85 ff             	test   %rdi,%rdi
+  802cbc:	74 5f                	je     802d1d <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  802cbe:	55                   	push   %rbp
+  802cbf:	48 89 e5             	mov    %rsp,%rbp
+  802cc2:	53                   	push   %rbx
+  802cc3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc7:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802cca:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cdc:	77 45                	ja     802d23 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  802cde:	48 89 de             	mov    %rbx,%rsi
+  802ce1:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  802ce8:	00 00 00 
+  802ceb:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802cf7:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfc:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802d01:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802d08:	00 00 00 
+  802d0b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d0d:	85 c0                	test   %eax,%eax
+  802d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d14:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+        return -E_INVAL;
+  802d1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d22:	c3                   	ret
+        return -E_INVAL;
+  802d23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d28:	eb ed                	jmp    802d17 <devfile_receive_snapshot+0x5e>
+
+0000000000802d2a <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  802d2a:	55                   	push   %rbp
+  802d2b:	48 89 e5             	mov    %rsp,%rbp
+  802d2e:	41 55                	push   %r13
+  802d30:	41 54                	push   %r12
+  802d32:	53                   	push   %rbx
+  802d33:	48 83 ec 08          	sub    $0x8,%rsp
+  802d37:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  802d3a:	48 85 f6             	test   %rsi,%rsi
+  802d3d:	0f 94 c0             	sete   %al
+  802d40:	48 85 d2             	test   %rdx,%rdx
+  802d43:	0f 94 c2             	sete   %dl
+  802d46:	08 d0                	or     %dl,%al
+  802d48:	0f 85 ad 00 00 00    	jne    802dfb <devfile_send_snapshot+0xd1>
+  802d4e:	48 89 fb             	mov    %rdi,%rbx
+  802d51:	49 89 f4             	mov    %rsi,%r12
+  802d54:	48 85 ff             	test   %rdi,%rdi
+  802d57:	0f 84 9e 00 00 00    	je     802dfb <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802d5d:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+  802d69:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802d6f:	0f 87 8d 00 00 00    	ja     802e02 <devfile_send_snapshot+0xd8>
+  802d75:	4c 89 e7             	mov    %r12,%rdi
+  802d78:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802d7f:	00 00 00 
+  802d82:	ff d0                	call   *%rax
+  802d84:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802d8a:	77 7d                	ja     802e09 <devfile_send_snapshot+0xdf>
+  802d8c:	4c 89 ef             	mov    %r13,%rdi
+  802d8f:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802d96:	00 00 00 
+  802d99:	ff d0                	call   *%rax
+  802d9b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802da1:	77 6d                	ja     802e10 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802da3:	48 89 de             	mov    %rbx,%rsi
+  802da6:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  802dad:	00 00 00 
+  802db0:	48 bb 99 12 80 00 00 	movabs $0x801299,%rbx
+  802db7:	00 00 00 
+  802dba:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802dbc:	4c 89 e6             	mov    %r12,%rsi
+  802dbf:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  802dc6:	00 00 00 
+  802dc9:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802dcb:	4c 89 ee             	mov    %r13,%rsi
+  802dce:	48 bf 00 82 80 00 00 	movabs $0x808200,%rdi
+  802dd5:	00 00 00 
+  802dd8:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802dda:	be 00 00 00 00       	mov    $0x0,%esi
+  802ddf:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802de4:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802deb:	00 00 00 
+  802dee:	ff d0                	call   *%rax
+}
+  802df0:	48 83 c4 08          	add    $0x8,%rsp
+  802df4:	5b                   	pop    %rbx
+  802df5:	41 5c                	pop    %r12
+  802df7:	41 5d                	pop    %r13
+  802df9:	5d                   	pop    %rbp
+  802dfa:	c3                   	ret
+        return -E_INVAL;
+  802dfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e00:	eb ee                	jmp    802df0 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  802e02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e07:	eb e7                	jmp    802df0 <devfile_send_snapshot+0xc6>
+  802e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e0e:	eb e0                	jmp    802df0 <devfile_send_snapshot+0xc6>
+  802e10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e15:	eb d9                	jmp    802df0 <devfile_send_snapshot+0xc6>
+
+0000000000802e17 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802e17:	48 85 ff             	test   %rdi,%rdi
+  802e1a:	0f 84 41 01 00 00    	je     802f61 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802e20:	55                   	push   %rbp
+  802e21:	48 89 e5             	mov    %rsp,%rbp
+  802e24:	41 57                	push   %r15
+  802e26:	41 56                	push   %r14
+  802e28:	41 55                	push   %r13
+  802e2a:	41 54                	push   %r12
+  802e2c:	53                   	push   %rbx
+  802e2d:	48 83 ec 08          	sub    $0x8,%rsp
+  802e31:	49 89 fc             	mov    %rdi,%r12
+  802e34:	49 89 f5             	mov    %rsi,%r13
+  802e37:	48 89 d3             	mov    %rdx,%rbx
+  802e3a:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802e3d:	48 85 f6             	test   %rsi,%rsi
+  802e40:	0f 84 ff 00 00 00    	je     802f45 <devfile_diff_snapshots+0x12e>
+  802e46:	48 85 d2             	test   %rdx,%rdx
+  802e49:	0f 84 fd 00 00 00    	je     802f4c <devfile_diff_snapshots+0x135>
+  802e4f:	48 85 c9             	test   %rcx,%rcx
+  802e52:	0f 84 f4 00 00 00    	je     802f4c <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  802e58:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+  802e64:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802e6a:	0f 87 e3 00 00 00    	ja     802f53 <devfile_diff_snapshots+0x13c>
+  802e70:	4c 89 ef             	mov    %r13,%rdi
+  802e73:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802e7a:	00 00 00 
+  802e7d:	ff d0                	call   *%rax
+  802e7f:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802e85:	0f 87 cf 00 00 00    	ja     802f5a <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802e8b:	4c 89 e6             	mov    %r12,%rsi
+  802e8e:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802e95:	00 00 00 
+  802e98:	4c 89 e7             	mov    %r12,%rdi
+  802e9b:	49 bf 99 12 80 00 00 	movabs $0x801299,%r15
+  802ea2:	00 00 00 
+  802ea5:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802ea8:	4c 89 ee             	mov    %r13,%rsi
+  802eab:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802eb2:	00 
+  802eb3:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802eb6:	48 8b 03             	mov    (%rbx),%rax
+  802eb9:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  802ec0:	00 
+  802ec1:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802ec5:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802ecc:	00 
+  802ecd:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802ed1:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802ed8:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ede:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802ee3:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	78 43                	js     802f36 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802ef3:	49 8b 04 24          	mov    (%r12),%rax
+  802ef7:	48 89 03             	mov    %rax,(%rbx)
+  802efa:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802eff:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802f03:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802f08:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802f0c:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  802f11:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802f15:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802f19:	48 c1 e2 03          	shl    $0x3,%rdx
+  802f1d:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802f22:	4c 89 f7             	mov    %r14,%rdi
+  802f25:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802f31:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  802f36:	48 83 c4 08          	add    $0x8,%rsp
+  802f3a:	5b                   	pop    %rbx
+  802f3b:	41 5c                	pop    %r12
+  802f3d:	41 5d                	pop    %r13
+  802f3f:	41 5e                	pop    %r14
+  802f41:	41 5f                	pop    %r15
+  802f43:	5d                   	pop    %rbp
+  802f44:	c3                   	ret
+        return -E_INVAL;
+  802f45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f4a:	eb ea                	jmp    802f36 <devfile_diff_snapshots+0x11f>
+  802f4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f51:	eb e3                	jmp    802f36 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802f53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f58:	eb dc                	jmp    802f36 <devfile_diff_snapshots+0x11f>
+  802f5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f5f:	eb d5                	jmp    802f36 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802f61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f66:	c3                   	ret
+
+0000000000802f67 <devfile_delete_snapshot>:
+    if (!name) {
+  802f67:	48 85 ff             	test   %rdi,%rdi
+  802f6a:	74 5f                	je     802fcb <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802f6c:	55                   	push   %rbp
+  802f6d:	48 89 e5             	mov    %rsp,%rbp
+  802f70:	53                   	push   %rbx
+  802f71:	48 83 ec 08          	sub    $0x8,%rsp
+  802f75:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802f78:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802f7f:	00 00 00 
+  802f82:	ff d0                	call   *%rax
+  802f84:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f8a:	77 45                	ja     802fd1 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802f8c:	48 89 de             	mov    %rbx,%rsi
+  802f8f:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  802f96:	00 00 00 
+  802f99:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802faa:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802faf:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  802fb6:	00 00 00 
+  802fb9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802fc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fc9:	c9                   	leave
+  802fca:	c3                   	ret
+        return -E_INVAL;
+  802fcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802fd0:	c3                   	ret
+        return -E_INVAL;
+  802fd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fd6:	eb ed                	jmp    802fc5 <devfile_delete_snapshot+0x5e>
+
+0000000000802fd8 <devfile_accept_snapshot>:
+    if (!name) {
+  802fd8:	48 85 ff             	test   %rdi,%rdi
+  802fdb:	74 5f                	je     80303c <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802fdd:	55                   	push   %rbp
+  802fde:	48 89 e5             	mov    %rsp,%rbp
+  802fe1:	53                   	push   %rbx
+  802fe2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802fe9:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+  802ff5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ffb:	77 45                	ja     803042 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802ffd:	48 89 de             	mov    %rbx,%rsi
+  803000:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803007:	00 00 00 
+  80300a:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  803011:	00 00 00 
+  803014:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  803016:	be 00 00 00 00       	mov    $0x0,%esi
+  80301b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803020:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  803027:	00 00 00 
+  80302a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803033:	0f 4f c2             	cmovg  %edx,%eax
+}
+  803036:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80303a:	c9                   	leave
+  80303b:	c3                   	ret
+        return -E_INVAL;
+  80303c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803041:	c3                   	ret
+        return -E_INVAL;
+  803042:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803047:	eb ed                	jmp    803036 <devfile_accept_snapshot+0x5e>
+
+0000000000803049 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  803049:	48 85 ff             	test   %rdi,%rdi
+  80304c:	0f 84 9f 00 00 00    	je     8030f1 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  803052:	55                   	push   %rbp
+  803053:	48 89 e5             	mov    %rsp,%rbp
+  803056:	41 54                	push   %r12
+  803058:	53                   	push   %rbx
+  803059:	48 89 fb             	mov    %rdi,%rbx
+  80305c:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  80305f:	48 85 f6             	test   %rsi,%rsi
+  803062:	74 78                	je     8030dc <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  803064:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  80306b:	00 00 00 
+  80306e:	ff d0                	call   *%rax
+  803070:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803076:	77 6b                	ja     8030e3 <devfile_create_snapshot+0x9a>
+  803078:	4c 89 e7             	mov    %r12,%rdi
+  80307b:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  803082:	00 00 00 
+  803085:	ff d0                	call   *%rax
+  803087:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80308d:	77 5b                	ja     8030ea <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  80308f:	48 89 de             	mov    %rbx,%rsi
+  803092:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  803099:	00 00 00 
+  80309c:	48 bb 99 12 80 00 00 	movabs $0x801299,%rbx
+  8030a3:	00 00 00 
+  8030a6:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  8030a8:	4c 89 e6             	mov    %r12,%rsi
+  8030ab:	48 bf 00 81 80 00 00 	movabs $0x808100,%rdi
+  8030b2:	00 00 00 
+  8030b5:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  8030b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030bc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8030c1:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030cd:	85 c0                	test   %eax,%eax
+  8030cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8030d7:	5b                   	pop    %rbx
+  8030d8:	41 5c                	pop    %r12
+  8030da:	5d                   	pop    %rbp
+  8030db:	c3                   	ret
+        return -E_INVAL;
+  8030dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030e1:	eb f4                	jmp    8030d7 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8030e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030e8:	eb ed                	jmp    8030d7 <devfile_create_snapshot+0x8e>
+  8030ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030ef:	eb e6                	jmp    8030d7 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8030f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030f6:	c3                   	ret
+
+00000000008030f7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	41 54                	push   %r12
+  8030fd:	53                   	push   %rbx
+  8030fe:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803101:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803104:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80310b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80310d:	be 00 00 00 00       	mov    $0x0,%esi
+  803112:	bf 05 00 00 00       	mov    $0x5,%edi
+  803117:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803123:	85 c0                	test   %eax,%eax
+  803125:	78 3d                	js     803164 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803127:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  80312e:	00 00 00 
+  803131:	4c 89 e6             	mov    %r12,%rsi
+  803134:	48 89 df             	mov    %rbx,%rdi
+  803137:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803143:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80314a:	00 
+  80314b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803151:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803158:	00 
+  803159:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80315f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803164:	5b                   	pop    %rbx
+  803165:	41 5c                	pop    %r12
+  803167:	5d                   	pop    %rbp
+  803168:	c3                   	ret
+
+0000000000803169 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  803169:	55                   	push   %rbp
+  80316a:	48 89 e5             	mov    %rsp,%rbp
+  80316d:	41 57                	push   %r15
+  80316f:	41 56                	push   %r14
+  803171:	41 55                	push   %r13
+  803173:	41 54                	push   %r12
+  803175:	53                   	push   %rbx
+  803176:	48 83 ec 38          	sub    $0x38,%rsp
+  80317a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80317e:	49 89 f5             	mov    %rsi,%r13
+  803181:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803184:	48 89 f0             	mov    %rsi,%rax
+  803187:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80318c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803190:	75 4f                	jne    8031e1 <devfile_readmap+0x78>
+  803192:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803196:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80319c:	75 1f                	jne    8031bd <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  80319e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031a2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  8031a6:	49 be 21 43 80 00 00 	movabs $0x804321,%r14
+  8031ad:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  8031b0:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  8031b7:	0f 87 9d 00 00 00    	ja     80325a <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8031bd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031c1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8031c5:	4d 85 ff             	test   %r15,%r15
+  8031c8:	0f 85 cf 00 00 00    	jne    80329d <devfile_readmap+0x134>
+  8031ce:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8031d2:	48 83 c4 38          	add    $0x38,%rsp
+  8031d6:	5b                   	pop    %rbx
+  8031d7:	41 5c                	pop    %r12
+  8031d9:	41 5d                	pop    %r13
+  8031db:	41 5e                	pop    %r14
+  8031dd:	41 5f                	pop    %r15
+  8031df:	5d                   	pop    %rbp
+  8031e0:	c3                   	ret
+    size_t totalRead = 0;
+  8031e1:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8031e8:	00 
+  8031e9:	eb da                	jmp    8031c5 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8031eb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8031ef:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031f2:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8031f9:	00 00 00 
+  8031fc:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  8031fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803202:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  803206:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80320a:	4c 89 ee             	mov    %r13,%rsi
+  80320d:	bf 14 00 00 00       	mov    $0x14,%edi
+  803212:	48 b8 17 29 80 00 00 	movabs $0x802917,%rax
+  803219:	00 00 00 
+  80321c:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	7e a3                	jle    8031c5 <devfile_readmap+0x5c>
+  803222:	48 98                	cltq
+  803224:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803228:	72 9b                	jb     8031c5 <devfile_readmap+0x5c>
+        buf += read;
+  80322a:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  80322d:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  803230:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  803234:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  80323b:	75 88                	jne    8031c5 <devfile_readmap+0x5c>
+  80323d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803241:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803247:	0f 85 78 ff ff ff    	jne    8031c5 <devfile_readmap+0x5c>
+  80324d:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  803254:	0f 86 6b ff ff ff    	jbe    8031c5 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  80325a:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  803260:	4d 39 e7             	cmp    %r12,%r15
+  803263:	4d 0f 46 e7          	cmovbe %r15,%r12
+  803267:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  80326e:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  803272:	0f 84 73 ff ff ff    	je     8031eb <devfile_readmap+0x82>
+  803278:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  80327c:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  803281:	41 ff d6             	call   *%r14
+  803284:	a8 40                	test   $0x40,%al
+  803286:	0f 85 39 ff ff ff    	jne    8031c5 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  80328c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803293:	4c 39 e3             	cmp    %r12,%rbx
+  803296:	72 e4                	jb     80327c <devfile_readmap+0x113>
+  803298:	e9 4e ff ff ff       	jmp    8031eb <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  80329d:	4c 89 fa             	mov    %r15,%rdx
+  8032a0:	4c 89 ee             	mov    %r13,%rsi
+  8032a3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8032a7:	48 b8 ea 2b 80 00 00 	movabs $0x802bea,%rax
+  8032ae:	00 00 00 
+  8032b1:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  8032b3:	48 85 c0             	test   %rax,%rax
+  8032b6:	78 0c                	js     8032c4 <devfile_readmap+0x15b>
+    return totalRead + read;
+  8032b8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8032bc:	48 01 f0             	add    %rsi,%rax
+  8032bf:	e9 0e ff ff ff       	jmp    8031d2 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  8032c4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8032c8:	48 85 f6             	test   %rsi,%rsi
+  8032cb:	48 0f 45 c6          	cmovne %rsi,%rax
+  8032cf:	e9 fe fe ff ff       	jmp    8031d2 <devfile_readmap+0x69>
+
+00000000008032d4 <open>:
+open(const char *path, int mode) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	41 55                	push   %r13
+  8032da:	41 54                	push   %r12
+  8032dc:	53                   	push   %rbx
+  8032dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e1:	49 89 fc             	mov    %rdi,%r12
+  8032e4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032e7:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+  8032f3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032f9:	0f 87 8a 00 00 00    	ja     803389 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032ff:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803303:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+  80330f:	89 c3                	mov    %eax,%ebx
+  803311:	85 c0                	test   %eax,%eax
+  803313:	78 50                	js     803365 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803315:	4c 89 e6             	mov    %r12,%rsi
+  803318:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80331f:	00 00 00 
+  803322:	48 89 df             	mov    %rbx,%rdi
+  803325:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  80332c:	00 00 00 
+  80332f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803331:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803338:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80333c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803341:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  803348:	00 00 00 
+  80334b:	ff d0                	call   *%rax
+  80334d:	89 c3                	mov    %eax,%ebx
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	78 1f                	js     803372 <open+0x9e>
+    return fd2num(fd);
+  803353:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803357:	48 b8 04 1e 80 00 00 	movabs $0x801e04,%rax
+  80335e:	00 00 00 
+  803361:	ff d0                	call   *%rax
+  803363:	89 c3                	mov    %eax,%ebx
+}
+  803365:	89 d8                	mov    %ebx,%eax
+  803367:	48 83 c4 18          	add    $0x18,%rsp
+  80336b:	5b                   	pop    %rbx
+  80336c:	41 5c                	pop    %r12
+  80336e:	41 5d                	pop    %r13
+  803370:	5d                   	pop    %rbp
+  803371:	c3                   	ret
+        fd_close(fd, 0);
+  803372:	be 00 00 00 00       	mov    $0x0,%esi
+  803377:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80337b:	48 b8 4d 1f 80 00 00 	movabs $0x801f4d,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+        return res;
+  803387:	eb dc                	jmp    803365 <open+0x91>
+        return -E_BAD_PATH;
+  803389:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80338e:	eb d5                	jmp    803365 <open+0x91>
+
+0000000000803390 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803390:	55                   	push   %rbp
+  803391:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803394:	be 00 00 00 00       	mov    $0x0,%esi
+  803399:	bf 13 00 00 00       	mov    $0x13,%edi
+  80339e:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+}
+  8033aa:	5d                   	pop    %rbp
+  8033ab:	c3                   	ret
+
+00000000008033ac <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8033ac:	55                   	push   %rbp
+  8033ad:	48 89 e5             	mov    %rsp,%rbp
+  8033b0:	41 55                	push   %r13
+  8033b2:	41 54                	push   %r12
+  8033b4:	53                   	push   %rbx
+  8033b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b9:	48 89 fb             	mov    %rdi,%rbx
+  8033bc:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8033bf:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8033c2:	48 b8 21 43 80 00 00 	movabs $0x804321,%rax
+  8033c9:	00 00 00 
+  8033cc:	ff d0                	call   *%rax
+  8033ce:	41 89 c1             	mov    %eax,%r9d
+  8033d1:	4d 89 e0             	mov    %r12,%r8
+  8033d4:	49 29 d8             	sub    %rbx,%r8
+  8033d7:	48 89 d9             	mov    %rbx,%rcx
+  8033da:	44 89 ea             	mov    %r13d,%edx
+  8033dd:	48 89 de             	mov    %rbx,%rsi
+  8033e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e5:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+}
+  8033f1:	48 83 c4 08          	add    $0x8,%rsp
+  8033f5:	5b                   	pop    %rbx
+  8033f6:	41 5c                	pop    %r12
+  8033f8:	41 5d                	pop    %r13
+  8033fa:	5d                   	pop    %rbp
+  8033fb:	c3                   	ret
+
+00000000008033fc <spawn>:
+spawn(const char *prog, const char **argv) {
+  8033fc:	55                   	push   %rbp
+  8033fd:	48 89 e5             	mov    %rsp,%rbp
+  803400:	41 57                	push   %r15
+  803402:	41 56                	push   %r14
+  803404:	41 55                	push   %r13
+  803406:	41 54                	push   %r12
+  803408:	53                   	push   %rbx
+  803409:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803410:	49 89 f7             	mov    %rsi,%r15
+    int fd = open(prog, O_RDONLY);
+  803413:	be 00 00 00 00       	mov    $0x0,%esi
+  803418:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+  803424:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  80342a:	85 c0                	test   %eax,%eax
+  80342c:	0f 88 10 04 00 00    	js     803842 <spawn+0x446>
+  803432:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803434:	ba 00 02 00 00       	mov    $0x200,%edx
+  803439:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803440:	48 b8 fe 22 80 00 00 	movabs $0x8022fe,%rax
+  803447:	00 00 00 
+  80344a:	ff d0                	call   *%rax
+  80344c:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80344e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803453:	0f 85 85 02 00 00    	jne    8036de <spawn+0x2e2>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803459:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803460:	ff ff 00 
+  803463:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80346a:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803471:	01 01 00 
+  803474:	48 39 d0             	cmp    %rdx,%rax
+  803477:	0f 85 9d 02 00 00    	jne    80371a <spawn+0x31e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  80347d:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803484:	00 3e 00 
+  803487:	0f 85 8d 02 00 00    	jne    80371a <spawn+0x31e>
+  80348d:	b8 08 00 00 00       	mov    $0x8,%eax
+  803492:	cd 30                	int    $0x30
+  803494:	41 89 c6             	mov    %eax,%r14d
+  803497:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803499:	85 c0                	test   %eax,%eax
+  80349b:	0f 88 89 03 00 00    	js     80382a <spawn+0x42e>
+    envid_t child = res;
+  8034a1:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8034a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034ac:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8034b0:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8034b4:	48 c1 e0 04          	shl    $0x4,%rax
+  8034b8:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8034bf:	00 00 00 
+  8034c2:	48 01 c6             	add    %rax,%rsi
+  8034c5:	48 8b 06             	mov    (%rsi),%rax
+  8034c8:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8034cf:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8034d6:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8034dd:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8034e4:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8034eb:	48 29 c6             	sub    %rax,%rsi
+  8034ee:	8d 88 c0 00 00 00    	lea    0xc0(%rax),%ecx
+  8034f4:	89 c8                	mov    %ecx,%eax
+  8034f6:	c1 e8 03             	shr    $0x3,%eax
+  8034f9:	89 c1                	mov    %eax,%ecx
+  8034fb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8034fe:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803505:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  80350c:	49 8b 3f             	mov    (%r15),%rdi
+  80350f:	48 85 ff             	test   %rdi,%rdi
+  803512:	0f 84 41 06 00 00    	je     803b59 <spawn+0x75d>
+  803518:	bb 01 00 00 00       	mov    $0x1,%ebx
+    string_size = 0;
+  80351d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803523:	49 bc 5b 12 80 00 00 	movabs $0x80125b,%r12
+  80352a:	00 00 00 
+  80352d:	41 ff d4             	call   *%r12
+  803530:	4c 01 e8             	add    %r13,%rax
+  803533:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803537:	48 89 da             	mov    %rbx,%rdx
+  80353a:	48 83 c3 01          	add    $0x1,%rbx
+  80353e:	49 8b 7c df f8       	mov    -0x8(%r15,%rbx,8),%rdi
+  803543:	48 85 ff             	test   %rdi,%rdi
+  803546:	75 e5                	jne    80352d <spawn+0x131>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803548:	48 f7 d0             	not    %rax
+  80354b:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803552:	4d 89 e5             	mov    %r12,%r13
+  803555:	49 83 e5 f8          	and    $0xfffffffffffffff8,%r13
+  803559:	4c 89 ad e8 fc ff ff 	mov    %r13,-0x318(%rbp)
+  803560:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803567:	89 d0                	mov    %edx,%eax
+  803569:	83 c0 01             	add    $0x1,%eax
+  80356c:	48 98                	cltq
+  80356e:	48 c1 e0 03          	shl    $0x3,%rax
+  803572:	49 29 c5             	sub    %rax,%r13
+  803575:	4c 89 ad e0 fc ff ff 	mov    %r13,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80357c:	49 8d 45 f0          	lea    -0x10(%r13),%rax
+  803580:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803586:	0f 86 c3 05 00 00    	jbe    803b4f <spawn+0x753>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80358c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803591:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803596:	be 00 00 40 00       	mov    $0x400000,%esi
+  80359b:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  8035a2:	00 00 00 
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	89 c3                	mov    %eax,%ebx
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	0f 88 67 02 00 00    	js     803818 <spawn+0x41c>
+    for (i = 0; i < argc; i++) {
+  8035b1:	48 8b 95 f8 fc ff ff 	mov    -0x308(%rbp),%rdx
+  8035b8:	85 d2                	test   %edx,%edx
+  8035ba:	7e 54                	jle    803610 <spawn+0x214>
+  8035bc:	4c 89 fb             	mov    %r15,%rbx
+  8035bf:	48 63 c2             	movslq %edx,%rax
+  8035c2:	4d 8d 7c c5 00       	lea    0x0(%r13,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8035c7:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8035ce:	00 00 00 
+  8035d1:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  8035d8:	ff 
+  8035d9:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8035dd:	48 8b 33             	mov    (%rbx),%rsi
+  8035e0:	4c 89 e7             	mov    %r12,%rdi
+  8035e3:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  8035ea:	00 00 00 
+  8035ed:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8035ef:	48 8b 3b             	mov    (%rbx),%rdi
+  8035f2:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  8035f9:	00 00 00 
+  8035fc:	ff d0                	call   *%rax
+  8035fe:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803603:	49 83 c5 08          	add    $0x8,%r13
+  803607:	48 83 c3 08          	add    $0x8,%rbx
+  80360b:	4d 39 fd             	cmp    %r15,%r13
+  80360e:	75 b7                	jne    8035c7 <spawn+0x1cb>
+    argv_store[argc] = 0;
+  803610:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803617:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80361e:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  80361f:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803626:	0f 85 35 01 00 00    	jne    803761 <spawn+0x365>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  80362c:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803633:	00 00 00 
+  803636:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  80363d:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803644:	ff 
+  803645:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803649:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803650:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803654:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  80365b:	00 00 00 
+  80365e:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803665:	ff 
+  803666:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  80366d:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803673:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803679:	44 89 f2             	mov    %r14d,%edx
+  80367c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803681:	bf 00 00 00 00       	mov    $0x0,%edi
+  803686:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  80368d:	00 00 00 
+  803690:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803692:	48 bb f1 19 80 00 00 	movabs $0x8019f1,%rbx
+  803699:	00 00 00 
+  80369c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8036a1:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ab:	ff d3                	call   *%rbx
+  8036ad:	85 c0                	test   %eax,%eax
+  8036af:	78 eb                	js     80369c <spawn+0x2a0>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8036b1:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8036b8:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  8036bf:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8036c0:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8036c7:	00 
+  8036c8:	0f 84 7e 03 00 00    	je     803a4c <spawn+0x650>
+  8036ce:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8036d5:	00 00 00 00 
+  8036d9:	e9 c0 01 00 00       	jmp    80389e <spawn+0x4a2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8036de:	48 bf 40 4e 80 00 00 	movabs $0x804e40,%rdi
+  8036e5:	00 00 00 
+  8036e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ed:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8036f4:	00 00 00 
+  8036f7:	ff d2                	call   *%rdx
+        close(fd);
+  8036f9:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8036ff:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803706:	00 00 00 
+  803709:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80370b:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803712:	ff ff ff 
+  803715:	e9 28 01 00 00       	jmp    803842 <spawn+0x446>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80371a:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80371f:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803725:	48 bf 41 4f 80 00 00 	movabs $0x804f41,%rdi
+  80372c:	00 00 00 
+  80372f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803734:	48 b9 74 09 80 00 00 	movabs $0x800974,%rcx
+  80373b:	00 00 00 
+  80373e:	ff d1                	call   *%rcx
+        close(fd);
+  803740:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803746:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  80374d:	00 00 00 
+  803750:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803752:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803759:	ff ff ff 
+  80375c:	e9 e1 00 00 00       	jmp    803842 <spawn+0x446>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803761:	48 b9 70 4e 80 00 00 	movabs $0x804e70,%rcx
+  803768:	00 00 00 
+  80376b:	48 ba 5b 4f 80 00 00 	movabs $0x804f5b,%rdx
+  803772:	00 00 00 
+  803775:	be f0 00 00 00       	mov    $0xf0,%esi
+  80377a:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  803781:	00 00 00 
+  803784:	b8 00 00 00 00       	mov    $0x0,%eax
+  803789:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  803790:	00 00 00 
+  803793:	41 ff d0             	call   *%r8
+    /* Unmap it from parent */
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz) {
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+        if (res < 0) {
+            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
+  803796:	89 c3                	mov    %eax,%ebx
+  803798:	89 c6                	mov    %eax,%esi
+  80379a:	48 bf a0 4e 80 00 00 	movabs $0x804ea0,%rdi
+  8037a1:	00 00 00 
+  8037a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a9:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8037b0:	00 00 00 
+  8037b3:	ff d2                	call   *%rdx
+            return res;
+  8037b5:	eb 61                	jmp    803818 <spawn+0x41c>
+        }
+    }
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
+  8037b7:	89 c3                	mov    %eax,%ebx
+  8037b9:	89 c6                	mov    %eax,%esi
+  8037bb:	48 bf c8 4e 80 00 00 	movabs $0x804ec8,%rdi
+  8037c2:	00 00 00 
+  8037c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ca:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8037d1:	00 00 00 
+  8037d4:	ff d2                	call   *%rdx
+        return res;
+  8037d6:	eb 40                	jmp    803818 <spawn+0x41c>
+    }
+    res = seek(fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.seek failed: %i\n", res);
+  8037d8:	89 c3                	mov    %eax,%ebx
+  8037da:	89 c6                	mov    %eax,%esi
+  8037dc:	48 bf 7c 4f 80 00 00 	movabs $0x804f7c,%rdi
+  8037e3:	00 00 00 
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  8037f2:	00 00 00 
+  8037f5:	ff d2                	call   *%rdx
+        return res;
+  8037f7:	eb 1f                	jmp    803818 <spawn+0x41c>
+    }
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+        if (res < 0) {
+            cprintf("map_segment.readn failed: %i\n", res);
+  8037f9:	89 c3                	mov    %eax,%ebx
+  8037fb:	89 c6                	mov    %eax,%esi
+  8037fd:	48 bf 99 4f 80 00 00 	movabs $0x804f99,%rdi
+  803804:	00 00 00 
+  803807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380c:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  803813:	00 00 00 
+  803816:	ff d2                	call   *%rdx
+    sys_env_destroy(child);
+  803818:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80381e:	48 b8 fa 17 80 00 00 	movabs $0x8017fa,%rax
+  803825:	00 00 00 
+  803828:	ff d0                	call   *%rax
+    close(fd);
+  80382a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803830:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+    return res;
+  80383c:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  803842:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803848:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  80384f:	5b                   	pop    %rbx
+  803850:	41 5c                	pop    %r12
+  803852:	41 5d                	pop    %r13
+  803854:	41 5e                	pop    %r14
+  803856:	41 5f                	pop    %r15
+  803858:	5d                   	pop    %rbp
+  803859:	c3                   	ret
+            return res;
+        }
+    }
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+    if (res < 0) {
+        cprintf("map_segment.sys_map_region failed: %i\n", res);
+  80385a:	89 c3                	mov    %eax,%ebx
+  80385c:	89 c6                	mov    %eax,%esi
+  80385e:	48 bf f0 4e 80 00 00 	movabs $0x804ef0,%rdi
+  803865:	00 00 00 
+  803868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386d:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  803874:	00 00 00 
+  803877:	ff d2                	call   *%rdx
+        return res;
+  803879:	eb 9d                	jmp    803818 <spawn+0x41c>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80387b:	48 83 85 f8 fc ff ff 	addq   $0x1,-0x308(%rbp)
+  803882:	01 
+  803883:	48 8b 8d f8 fc ff ff 	mov    -0x308(%rbp),%rcx
+  80388a:	48 83 c3 38          	add    $0x38,%rbx
+  80388e:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803895:	48 39 c1             	cmp    %rax,%rcx
+  803898:	0f 83 ae 01 00 00    	jae    803a4c <spawn+0x650>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  80389e:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8038a1:	75 d8                	jne    80387b <spawn+0x47f>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8038a3:	8b 43 04             	mov    0x4(%rbx),%eax
+  8038a6:	41 89 c6             	mov    %eax,%r14d
+  8038a9:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8038ad:	44 89 f2             	mov    %r14d,%edx
+  8038b0:	83 ca 04             	or     $0x4,%edx
+  8038b3:	a8 04                	test   $0x4,%al
+  8038b5:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8038b9:	44 89 f2             	mov    %r14d,%edx
+  8038bc:	83 ca 01             	or     $0x1,%edx
+  8038bf:	a8 01                	test   $0x1,%al
+  8038c1:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8038c5:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  8038c9:	41 89 cc             	mov    %ecx,%r12d
+  8038cc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8038d0:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+  8038d4:	4c 8b 7b 10          	mov    0x10(%rbx),%r15
+  8038d8:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8038de:	89 bd e8 fc ff ff    	mov    %edi,-0x318(%rbp)
+    if (res) {
+  8038e4:	44 89 fe             	mov    %r15d,%esi
+  8038e7:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8038ed:	74 0f                	je     8038fe <spawn+0x502>
+        va -= res;
+  8038ef:	48 63 fe             	movslq %esi,%rdi
+  8038f2:	49 29 ff             	sub    %rdi,%r15
+        memsz += res;
+  8038f5:	48 01 fa             	add    %rdi,%rdx
+        filesz += res;
+  8038f8:	48 01 f8             	add    %rdi,%rax
+        fileoffset -= res;
+  8038fb:	41 29 f4             	sub    %esi,%r12d
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  8038fe:	4a 8d b4 38 ff 0f 00 	lea    0xfff(%rax,%r15,1),%rsi
+  803905:	00 
+  803906:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80390d:	49 89 f5             	mov    %rsi,%r13
+  803910:	4d 29 fd             	sub    %r15,%r13
+    if (memsz > filesz) {
+  803913:	49 39 d5             	cmp    %rdx,%r13
+  803916:	73 23                	jae    80393b <spawn+0x53f>
+        res = sys_alloc_region(child, (void*)va + filesz, memsz - filesz, perm);
+  803918:	4c 01 fa             	add    %r15,%rdx
+  80391b:	48 29 f2             	sub    %rsi,%rdx
+  80391e:	44 89 f1             	mov    %r14d,%ecx
+  803921:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  803927:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  80392e:	00 00 00 
+  803931:	ff d0                	call   *%rax
+        if (res < 0) {
+  803933:	85 c0                	test   %eax,%eax
+  803935:	0f 88 5b fe ff ff    	js     803796 <spawn+0x39a>
+    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  80393b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803940:	4c 89 ea             	mov    %r13,%rdx
+  803943:	be 00 00 40 00       	mov    $0x400000,%esi
+  803948:	bf 00 00 00 00       	mov    $0x0,%edi
+  80394d:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803954:	00 00 00 
+  803957:	ff d0                	call   *%rax
+    if (res < 0) {
+  803959:	85 c0                	test   %eax,%eax
+  80395b:	0f 88 56 fe ff ff    	js     8037b7 <spawn+0x3bb>
+    res = seek(fd, fileoffset);
+  803961:	44 89 e6             	mov    %r12d,%esi
+  803964:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80396a:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+    if (res < 0) {
+  803976:	85 c0                	test   %eax,%eax
+  803978:	0f 88 5a fe ff ff    	js     8037d8 <spawn+0x3dc>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  80397e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803984:	b8 00 00 00 00       	mov    $0x0,%eax
+  803989:	4d 85 ed             	test   %r13,%r13
+  80398c:	74 48                	je     8039d6 <spawn+0x5da>
+  80398e:	48 89 9d e0 fc ff ff 	mov    %rbx,-0x320(%rbp)
+  803995:	8b 9d f4 fc ff ff    	mov    -0x30c(%rbp),%ebx
+        res = readn(fd, UTEMP + i, PAGE_SIZE);
+  80399b:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8039a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039a7:	89 df                	mov    %ebx,%edi
+  8039a9:	48 b8 fe 22 80 00 00 	movabs $0x8022fe,%rax
+  8039b0:	00 00 00 
+  8039b3:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039b5:	85 c0                	test   %eax,%eax
+  8039b7:	0f 88 3c fe ff ff    	js     8037f9 <spawn+0x3fd>
+    for (int i = 0; i < filesz; i += PAGE_SIZE) {
+  8039bd:	41 8d 84 24 00 10 00 	lea    0x1000(%r12),%eax
+  8039c4:	00 
+  8039c5:	41 89 c4             	mov    %eax,%r12d
+  8039c8:	48 98                	cltq
+  8039ca:	4c 39 e8             	cmp    %r13,%rax
+  8039cd:	72 cc                	jb     80399b <spawn+0x59f>
+  8039cf:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+    res = sys_map_region(CURENVID, UTEMP, child, (void*)va, filesz, perm | PROT_LAZY);
+  8039d6:	45 89 f1             	mov    %r14d,%r9d
+  8039d9:	41 80 c9 80          	or     $0x80,%r9b
+  8039dd:	4d 89 e8             	mov    %r13,%r8
+  8039e0:	4c 89 f9             	mov    %r15,%rcx
+  8039e3:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8039e9:	be 00 00 40 00       	mov    $0x400000,%esi
+  8039ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f3:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8039ff:	85 c0                	test   %eax,%eax
+  803a01:	0f 88 53 fe ff ff    	js     80385a <spawn+0x45e>
+    }
+    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+  803a07:	4c 89 ea             	mov    %r13,%rdx
+  803a0a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a14:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  803a1b:	00 00 00 
+  803a1e:	ff d0                	call   *%rax
+    if (res < 0) {
+  803a20:	85 c0                	test   %eax,%eax
+  803a22:	0f 89 53 fe ff ff    	jns    80387b <spawn+0x47f>
+        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+  803a28:	89 c3                	mov    %eax,%ebx
+  803a2a:	89 c6                	mov    %eax,%esi
+  803a2c:	48 bf 18 4f 80 00 00 	movabs $0x804f18,%rdi
+  803a33:	00 00 00 
+  803a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3b:	48 ba 74 09 80 00 00 	movabs $0x800974,%rdx
+  803a42:	00 00 00 
+  803a45:	ff d2                	call   *%rdx
+        return res;
+  803a47:	e9 cc fd ff ff       	jmp    803818 <spawn+0x41c>
+    close(fd);
+  803a4c:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803a52:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803a59:	00 00 00 
+  803a5c:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803a5e:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803a65:	48 bf ac 33 80 00 00 	movabs $0x8033ac,%rdi
+  803a6c:	00 00 00 
+  803a6f:	48 b8 ae 43 80 00 00 	movabs $0x8043ae,%rax
+  803a76:	00 00 00 
+  803a79:	ff d0                	call   *%rax
+  803a7b:	85 c0                	test   %eax,%eax
+  803a7d:	78 49                	js     803ac8 <spawn+0x6cc>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803a7f:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803a86:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803a8c:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	78 59                	js     803af5 <spawn+0x6f9>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803a9c:	be 02 00 00 00       	mov    $0x2,%esi
+  803aa1:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803aa7:	48 b8 58 1a 80 00 00 	movabs $0x801a58,%rax
+  803aae:	00 00 00 
+  803ab1:	ff d0                	call   *%rax
+  803ab3:	85 c0                	test   %eax,%eax
+  803ab5:	78 6b                	js     803b22 <spawn+0x726>
+    return child;
+  803ab7:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803abd:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  803ac3:	e9 7a fd ff ff       	jmp    803842 <spawn+0x446>
+        panic("copy_shared_region: %i", res);
+  803ac8:	89 c1                	mov    %eax,%ecx
+  803aca:	48 ba b7 4f 80 00 00 	movabs $0x804fb7,%rdx
+  803ad1:	00 00 00 
+  803ad4:	be 84 00 00 00       	mov    $0x84,%esi
+  803ad9:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  803ae0:	00 00 00 
+  803ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae8:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  803aef:	00 00 00 
+  803af2:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803af5:	89 c1                	mov    %eax,%ecx
+  803af7:	48 ba ce 4f 80 00 00 	movabs $0x804fce,%rdx
+  803afe:	00 00 00 
+  803b01:	be 87 00 00 00       	mov    $0x87,%esi
+  803b06:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  803b0d:	00 00 00 
+  803b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b15:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  803b1c:	00 00 00 
+  803b1f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803b22:	89 c1                	mov    %eax,%ecx
+  803b24:	48 ba e8 4f 80 00 00 	movabs $0x804fe8,%rdx
+  803b2b:	00 00 00 
+  803b2e:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803b33:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  803b3a:	00 00 00 
+  803b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b42:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  803b49:	00 00 00 
+  803b4c:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803b4f:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803b54:	e9 bf fc ff ff       	jmp    803818 <spawn+0x41c>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803b59:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803b5e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803b63:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b68:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b6d:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803b74:	00 00 00 
+  803b77:	ff d0                	call   *%rax
+  803b79:	89 c3                	mov    %eax,%ebx
+  803b7b:	85 c0                	test   %eax,%eax
+  803b7d:	0f 88 95 fc ff ff    	js     803818 <spawn+0x41c>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803b83:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803b8a:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803b8e:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  803b95:	f8 ff 40 00 
+  803b99:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803ba0:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803ba4:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  803baa:	e9 61 fa ff ff       	jmp    803610 <spawn+0x214>
+
+0000000000803baf <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803baf:	55                   	push   %rbp
+  803bb0:	48 89 e5             	mov    %rsp,%rbp
+  803bb3:	48 83 ec 50          	sub    $0x50,%rsp
+  803bb7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803bbb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803bbf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803bc3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803bc7:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803bce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bd6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803bda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803bde:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803be3:	eb 15                	jmp    803bfa <spawnl+0x4b>
+  803be5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803be9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf1:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803bf5:	74 1c                	je     803c13 <spawnl+0x64>
+  803bf7:	83 c1 01             	add    $0x1,%ecx
+  803bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  803c00:	77 e3                	ja     803be5 <spawnl+0x36>
+  803c02:	89 c2                	mov    %eax,%edx
+  803c04:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803c08:	4c 01 d2             	add    %r10,%rdx
+  803c0b:	83 c0 08             	add    $0x8,%eax
+  803c0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c11:	eb de                	jmp    803bf1 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803c13:	8d 41 02             	lea    0x2(%rcx),%eax
+  803c16:	48 98                	cltq
+  803c18:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803c1f:	00 
+  803c20:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803c24:	48 29 c4             	sub    %rax,%rsp
+  803c27:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803c2c:	4c 89 c0             	mov    %r8,%rax
+  803c2f:	48 c1 e8 03          	shr    $0x3,%rax
+  803c33:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803c37:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803c3e:	00 
+    argv[argc + 1] = NULL;
+  803c3f:	8d 41 01             	lea    0x1(%rcx),%eax
+  803c42:	48 98                	cltq
+  803c44:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803c4b:	00 
+    va_start(vl, arg0);
+  803c4c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c53:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c5b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803c5f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803c63:	85 c9                	test   %ecx,%ecx
+  803c65:	74 41                	je     803ca8 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803c67:	49 89 c1             	mov    %rax,%r9
+  803c6a:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803c6e:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803c71:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803c76:	eb 1b                	jmp    803c93 <spawnl+0xe4>
+  803c78:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c7c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803c80:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803c84:	48 8b 11             	mov    (%rcx),%rdx
+  803c87:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803c8a:	48 83 c0 08          	add    $0x8,%rax
+  803c8e:	48 39 f0             	cmp    %rsi,%rax
+  803c91:	74 15                	je     803ca8 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803c93:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803c96:	83 fa 2f             	cmp    $0x2f,%edx
+  803c99:	77 dd                	ja     803c78 <spawnl+0xc9>
+  803c9b:	89 d1                	mov    %edx,%ecx
+  803c9d:	4c 01 c9             	add    %r9,%rcx
+  803ca0:	83 c2 08             	add    $0x8,%edx
+  803ca3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803ca6:	eb dc                	jmp    803c84 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803ca8:	4c 89 c6             	mov    %r8,%rsi
+  803cab:	48 b8 fc 33 80 00 00 	movabs $0x8033fc,%rax
+  803cb2:	00 00 00 
+  803cb5:	ff d0                	call   *%rax
+}
+  803cb7:	c9                   	leave
+  803cb8:	c3                   	ret
+
+0000000000803cb9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803cb9:	55                   	push   %rbp
+  803cba:	48 89 e5             	mov    %rsp,%rbp
+  803cbd:	41 54                	push   %r12
+  803cbf:	53                   	push   %rbx
+  803cc0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cc3:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803cca:	00 00 00 
+  803ccd:	ff d0                	call   *%rax
+  803ccf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803cd2:	48 be ff 4f 80 00 00 	movabs $0x804fff,%rsi
+  803cd9:	00 00 00 
+  803cdc:	48 89 df             	mov    %rbx,%rdi
+  803cdf:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  803ce6:	00 00 00 
+  803ce9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803ceb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803cf0:	41 2b 04 24          	sub    (%r12),%eax
+  803cf4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803cfa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d01:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d04:	48 b8 40 61 80 00 00 	movabs $0x806140,%rax
+  803d0b:	00 00 00 
+  803d0e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1a:	5b                   	pop    %rbx
+  803d1b:	41 5c                	pop    %r12
+  803d1d:	5d                   	pop    %rbp
+  803d1e:	c3                   	ret
+
+0000000000803d1f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d1f:	55                   	push   %rbp
+  803d20:	48 89 e5             	mov    %rsp,%rbp
+  803d23:	41 54                	push   %r12
+  803d25:	53                   	push   %rbx
+  803d26:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d2e:	48 89 fe             	mov    %rdi,%rsi
+  803d31:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d36:	49 bc f1 19 80 00 00 	movabs $0x8019f1,%r12
+  803d3d:	00 00 00 
+  803d40:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d43:	48 89 df             	mov    %rbx,%rdi
+  803d46:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803d4d:	00 00 00 
+  803d50:	ff d0                	call   *%rax
+  803d52:	48 89 c6             	mov    %rax,%rsi
+  803d55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5f:	41 ff d4             	call   *%r12
+}
+  803d62:	5b                   	pop    %rbx
+  803d63:	41 5c                	pop    %r12
+  803d65:	5d                   	pop    %rbp
+  803d66:	c3                   	ret
+
+0000000000803d67 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d67:	55                   	push   %rbp
+  803d68:	48 89 e5             	mov    %rsp,%rbp
+  803d6b:	41 57                	push   %r15
+  803d6d:	41 56                	push   %r14
+  803d6f:	41 55                	push   %r13
+  803d71:	41 54                	push   %r12
+  803d73:	53                   	push   %rbx
+  803d74:	48 83 ec 18          	sub    $0x18,%rsp
+  803d78:	49 89 fc             	mov    %rdi,%r12
+  803d7b:	49 89 f5             	mov    %rsi,%r13
+  803d7e:	49 89 d7             	mov    %rdx,%r15
+  803d81:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d85:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803d91:	4d 85 ff             	test   %r15,%r15
+  803d94:	0f 84 af 00 00 00    	je     803e49 <devpipe_write+0xe2>
+  803d9a:	48 89 c3             	mov    %rax,%rbx
+  803d9d:	4c 89 f8             	mov    %r15,%rax
+  803da0:	4d 89 ef             	mov    %r13,%r15
+  803da3:	4c 01 e8             	add    %r13,%rax
+  803da6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803daa:	49 bd f9 18 80 00 00 	movabs $0x8018f9,%r13
+  803db1:	00 00 00 
+            sys_yield();
+  803db4:	49 be 96 18 80 00 00 	movabs $0x801896,%r14
+  803dbb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803dbe:	8b 73 04             	mov    0x4(%rbx),%esi
+  803dc1:	48 63 ce             	movslq %esi,%rcx
+  803dc4:	48 63 03             	movslq (%rbx),%rax
+  803dc7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803dcd:	48 39 c1             	cmp    %rax,%rcx
+  803dd0:	72 2e                	jb     803e00 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dd2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803dd7:	48 89 da             	mov    %rbx,%rdx
+  803dda:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ddf:	4c 89 e7             	mov    %r12,%rdi
+  803de2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803de5:	85 c0                	test   %eax,%eax
+  803de7:	74 66                	je     803e4f <devpipe_write+0xe8>
+            sys_yield();
+  803de9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803dec:	8b 73 04             	mov    0x4(%rbx),%esi
+  803def:	48 63 ce             	movslq %esi,%rcx
+  803df2:	48 63 03             	movslq (%rbx),%rax
+  803df5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803dfb:	48 39 c1             	cmp    %rax,%rcx
+  803dfe:	73 d2                	jae    803dd2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e00:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e04:	48 89 ca             	mov    %rcx,%rdx
+  803e07:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e0b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e12:	08 10 20 
+  803e15:	48 f7 e2             	mul    %rdx
+  803e18:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e1c:	48 89 d0             	mov    %rdx,%rax
+  803e1f:	48 c1 e0 09          	shl    $0x9,%rax
+  803e23:	48 29 d0             	sub    %rdx,%rax
+  803e26:	48 c1 e0 03          	shl    $0x3,%rax
+  803e2a:	48 29 c1             	sub    %rax,%rcx
+  803e2d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e32:	83 c6 01             	add    $0x1,%esi
+  803e35:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e38:	49 83 c7 01          	add    $0x1,%r15
+  803e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e40:	49 39 c7             	cmp    %rax,%r15
+  803e43:	0f 85 75 ff ff ff    	jne    803dbe <devpipe_write+0x57>
+    return n;
+  803e49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e4d:	eb 05                	jmp    803e54 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e54:	48 83 c4 18          	add    $0x18,%rsp
+  803e58:	5b                   	pop    %rbx
+  803e59:	41 5c                	pop    %r12
+  803e5b:	41 5d                	pop    %r13
+  803e5d:	41 5e                	pop    %r14
+  803e5f:	41 5f                	pop    %r15
+  803e61:	5d                   	pop    %rbp
+  803e62:	c3                   	ret
+
+0000000000803e63 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e63:	55                   	push   %rbp
+  803e64:	48 89 e5             	mov    %rsp,%rbp
+  803e67:	41 57                	push   %r15
+  803e69:	41 56                	push   %r14
+  803e6b:	41 55                	push   %r13
+  803e6d:	41 54                	push   %r12
+  803e6f:	53                   	push   %rbx
+  803e70:	48 83 ec 18          	sub    $0x18,%rsp
+  803e74:	49 89 fc             	mov    %rdi,%r12
+  803e77:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e7b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e7f:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+  803e8b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803e8e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e94:	49 bd f9 18 80 00 00 	movabs $0x8018f9,%r13
+  803e9b:	00 00 00 
+            sys_yield();
+  803e9e:	49 be 96 18 80 00 00 	movabs $0x801896,%r14
+  803ea5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ea8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ead:	74 7d                	je     803f2c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803eaf:	8b 03                	mov    (%rbx),%eax
+  803eb1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803eb4:	75 26                	jne    803edc <devpipe_read+0x79>
+            if (i > 0) return i;
+  803eb6:	4d 85 ff             	test   %r15,%r15
+  803eb9:	75 77                	jne    803f32 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ebb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ec0:	48 89 da             	mov    %rbx,%rdx
+  803ec3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ec8:	4c 89 e7             	mov    %r12,%rdi
+  803ecb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ece:	85 c0                	test   %eax,%eax
+  803ed0:	74 72                	je     803f44 <devpipe_read+0xe1>
+            sys_yield();
+  803ed2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ed5:	8b 03                	mov    (%rbx),%eax
+  803ed7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803eda:	74 df                	je     803ebb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803edc:	48 63 c8             	movslq %eax,%rcx
+  803edf:	48 89 ca             	mov    %rcx,%rdx
+  803ee2:	48 c1 ea 03          	shr    $0x3,%rdx
+  803ee6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803eed:	08 10 20 
+  803ef0:	48 89 d0             	mov    %rdx,%rax
+  803ef3:	48 f7 e6             	mul    %rsi
+  803ef6:	48 c1 ea 06          	shr    $0x6,%rdx
+  803efa:	48 89 d0             	mov    %rdx,%rax
+  803efd:	48 c1 e0 09          	shl    $0x9,%rax
+  803f01:	48 29 d0             	sub    %rdx,%rax
+  803f04:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f0b:	00 
+  803f0c:	48 89 c8             	mov    %rcx,%rax
+  803f0f:	48 29 d0             	sub    %rdx,%rax
+  803f12:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f17:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f1b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f1f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f22:	49 83 c7 01          	add    $0x1,%r15
+  803f26:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f2a:	75 83                	jne    803eaf <devpipe_read+0x4c>
+    return n;
+  803f2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f30:	eb 03                	jmp    803f35 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f32:	4c 89 f8             	mov    %r15,%rax
+}
+  803f35:	48 83 c4 18          	add    $0x18,%rsp
+  803f39:	5b                   	pop    %rbx
+  803f3a:	41 5c                	pop    %r12
+  803f3c:	41 5d                	pop    %r13
+  803f3e:	41 5e                	pop    %r14
+  803f40:	41 5f                	pop    %r15
+  803f42:	5d                   	pop    %rbp
+  803f43:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f49:	eb ea                	jmp    803f35 <devpipe_read+0xd2>
+
+0000000000803f4b <pipe>:
+pipe(int pfd[2]) {
+  803f4b:	55                   	push   %rbp
+  803f4c:	48 89 e5             	mov    %rsp,%rbp
+  803f4f:	41 55                	push   %r13
+  803f51:	41 54                	push   %r12
+  803f53:	53                   	push   %rbx
+  803f54:	48 83 ec 18          	sub    $0x18,%rsp
+  803f58:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f5b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f5f:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  803f66:	00 00 00 
+  803f69:	ff d0                	call   *%rax
+  803f6b:	89 c3                	mov    %eax,%ebx
+  803f6d:	85 c0                	test   %eax,%eax
+  803f6f:	0f 88 a0 01 00 00    	js     804115 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f75:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f7a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f7f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f88:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803f8f:	00 00 00 
+  803f92:	ff d0                	call   *%rax
+  803f94:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f96:	85 c0                	test   %eax,%eax
+  803f98:	0f 88 77 01 00 00    	js     804115 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f9e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803fa2:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  803fa9:	00 00 00 
+  803fac:	ff d0                	call   *%rax
+  803fae:	89 c3                	mov    %eax,%ebx
+  803fb0:	85 c0                	test   %eax,%eax
+  803fb2:	0f 88 43 01 00 00    	js     8040fb <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803fb8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fcb:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  803fd2:	00 00 00 
+  803fd5:	ff d0                	call   *%rax
+  803fd7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fd9:	85 c0                	test   %eax,%eax
+  803fdb:	0f 88 1a 01 00 00    	js     8040fb <pipe+0x1b0>
+    va = fd2data(fd0);
+  803fe1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fe5:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  803fec:	00 00 00 
+  803fef:	ff d0                	call   *%rax
+  803ff1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ff4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ffe:	48 89 c6             	mov    %rax,%rsi
+  804001:	bf 00 00 00 00       	mov    $0x0,%edi
+  804006:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  80400d:	00 00 00 
+  804010:	ff d0                	call   *%rax
+  804012:	89 c3                	mov    %eax,%ebx
+  804014:	85 c0                	test   %eax,%eax
+  804016:	0f 88 c5 00 00 00    	js     8040e1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80401c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804020:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  804027:	00 00 00 
+  80402a:	ff d0                	call   *%rax
+  80402c:	48 89 c1             	mov    %rax,%rcx
+  80402f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804035:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80403b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804040:	4c 89 ee             	mov    %r13,%rsi
+  804043:	bf 00 00 00 00       	mov    $0x0,%edi
+  804048:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+  804054:	89 c3                	mov    %eax,%ebx
+  804056:	85 c0                	test   %eax,%eax
+  804058:	78 6e                	js     8040c8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80405a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80405f:	4c 89 ef             	mov    %r13,%rdi
+  804062:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  804069:	00 00 00 
+  80406c:	ff d0                	call   *%rax
+  80406e:	83 f8 02             	cmp    $0x2,%eax
+  804071:	0f 85 ab 00 00 00    	jne    804122 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804077:	a1 40 61 80 00 00 00 	movabs 0x806140,%eax
+  80407e:	00 00 
+  804080:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804084:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804086:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80408a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804091:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804095:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804097:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80409b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040a2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040a6:	48 bb 04 1e 80 00 00 	movabs $0x801e04,%rbx
+  8040ad:	00 00 00 
+  8040b0:	ff d3                	call   *%rbx
+  8040b2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8040b6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8040ba:	ff d3                	call   *%rbx
+  8040bc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8040c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040c6:	eb 4d                	jmp    804115 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8040c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040cd:	4c 89 ee             	mov    %r13,%rsi
+  8040d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d5:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8040e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040e6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8040ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ef:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  8040f6:	00 00 00 
+  8040f9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8040fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804100:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804104:	bf 00 00 00 00       	mov    $0x0,%edi
+  804109:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  804110:	00 00 00 
+  804113:	ff d0                	call   *%rax
+}
+  804115:	89 d8                	mov    %ebx,%eax
+  804117:	48 83 c4 18          	add    $0x18,%rsp
+  80411b:	5b                   	pop    %rbx
+  80411c:	41 5c                	pop    %r12
+  80411e:	41 5d                	pop    %r13
+  804120:	5d                   	pop    %rbp
+  804121:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804122:	48 b9 18 50 80 00 00 	movabs $0x805018,%rcx
+  804129:	00 00 00 
+  80412c:	48 ba 5b 4f 80 00 00 	movabs $0x804f5b,%rdx
+  804133:	00 00 00 
+  804136:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80413b:	48 bf 06 50 80 00 00 	movabs $0x805006,%rdi
+  804142:	00 00 00 
+  804145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414a:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  804151:	00 00 00 
+  804154:	41 ff d0             	call   *%r8
+
+0000000000804157 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804157:	55                   	push   %rbp
+  804158:	48 89 e5             	mov    %rsp,%rbp
+  80415b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80415f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804163:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  80416a:	00 00 00 
+  80416d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80416f:	85 c0                	test   %eax,%eax
+  804171:	78 35                	js     8041a8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804173:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804177:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+  804183:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804186:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80418b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804190:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804194:	48 b8 f9 18 80 00 00 	movabs $0x8018f9,%rax
+  80419b:	00 00 00 
+  80419e:	ff d0                	call   *%rax
+  8041a0:	85 c0                	test   %eax,%eax
+  8041a2:	0f 94 c0             	sete   %al
+  8041a5:	0f b6 c0             	movzbl %al,%eax
+}
+  8041a8:	c9                   	leave
+  8041a9:	c3                   	ret
+
+00000000008041aa <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8041aa:	55                   	push   %rbp
+  8041ab:	48 89 e5             	mov    %rsp,%rbp
+  8041ae:	41 55                	push   %r13
+  8041b0:	41 54                	push   %r12
+  8041b2:	53                   	push   %rbx
+  8041b3:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8041b7:	85 ff                	test   %edi,%edi
+  8041b9:	74 7d                	je     804238 <wait+0x8e>
+  8041bb:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8041be:	89 f8                	mov    %edi,%eax
+  8041c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8041c5:	89 fa                	mov    %edi,%edx
+  8041c7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8041cd:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  8041d1:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  8041d5:	48 c1 e1 04          	shl    $0x4,%rcx
+  8041d9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8041e0:	00 00 00 
+  8041e3:	48 01 ca             	add    %rcx,%rdx
+  8041e6:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8041ec:	39 d7                	cmp    %edx,%edi
+  8041ee:	75 3d                	jne    80422d <wait+0x83>
+           env->env_status != ENV_FREE) {
+  8041f0:	48 98                	cltq
+  8041f2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8041f6:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8041fa:	48 c1 e0 04          	shl    $0x4,%rax
+  8041fe:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804205:	00 00 00 
+  804208:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  80420b:	49 bd 96 18 80 00 00 	movabs $0x801896,%r13
+  804212:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804215:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80421b:	85 c0                	test   %eax,%eax
+  80421d:	74 0e                	je     80422d <wait+0x83>
+        sys_yield();
+  80421f:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804222:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804228:	44 39 e0             	cmp    %r12d,%eax
+  80422b:	74 e8                	je     804215 <wait+0x6b>
+    }
+}
+  80422d:	48 83 c4 08          	add    $0x8,%rsp
+  804231:	5b                   	pop    %rbx
+  804232:	41 5c                	pop    %r12
+  804234:	41 5d                	pop    %r13
+  804236:	5d                   	pop    %rbp
+  804237:	c3                   	ret
+    assert(envid != 0);
+  804238:	48 b9 3c 50 80 00 00 	movabs $0x80503c,%rcx
+  80423f:	00 00 00 
+  804242:	48 ba 5b 4f 80 00 00 	movabs $0x804f5b,%rdx
+  804249:	00 00 00 
+  80424c:	be 06 00 00 00       	mov    $0x6,%esi
+  804251:	48 bf 47 50 80 00 00 	movabs $0x805047,%rdi
+  804258:	00 00 00 
+  80425b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804260:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  804267:	00 00 00 
+  80426a:	41 ff d0             	call   *%r8
+
+000000000080426d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80426d:	48 89 f8             	mov    %rdi,%rax
+  804270:	48 c1 e8 27          	shr    $0x27,%rax
+  804274:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80427b:	01 00 00 
+  80427e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804282:	f6 c2 01             	test   $0x1,%dl
+  804285:	74 6d                	je     8042f4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804287:	48 89 f8             	mov    %rdi,%rax
+  80428a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80428e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804295:	01 00 00 
+  804298:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80429c:	f6 c2 01             	test   $0x1,%dl
+  80429f:	74 62                	je     804303 <get_uvpt_entry+0x96>
+  8042a1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042a8:	01 00 00 
+  8042ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042af:	f6 c2 80             	test   $0x80,%dl
+  8042b2:	75 4f                	jne    804303 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042b4:	48 89 f8             	mov    %rdi,%rax
+  8042b7:	48 c1 e8 15          	shr    $0x15,%rax
+  8042bb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042c2:	01 00 00 
+  8042c5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042c9:	f6 c2 01             	test   $0x1,%dl
+  8042cc:	74 44                	je     804312 <get_uvpt_entry+0xa5>
+  8042ce:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042d5:	01 00 00 
+  8042d8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042dc:	f6 c2 80             	test   $0x80,%dl
+  8042df:	75 31                	jne    804312 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8042e1:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8042e5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042ec:	01 00 00 
+  8042ef:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042f3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042f4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042fb:	01 00 00 
+  8042fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804302:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804303:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80430a:	01 00 00 
+  80430d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804311:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804312:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804319:	01 00 00 
+  80431c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804320:	c3                   	ret
+
+0000000000804321 <get_prot>:
+
+int
+get_prot(void *va) {
+  804321:	55                   	push   %rbp
+  804322:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804325:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  80432c:	00 00 00 
+  80432f:	ff d0                	call   *%rax
+  804331:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804334:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804339:	89 c1                	mov    %eax,%ecx
+  80433b:	83 c9 04             	or     $0x4,%ecx
+  80433e:	f6 c2 01             	test   $0x1,%dl
+  804341:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804344:	89 c1                	mov    %eax,%ecx
+  804346:	83 c9 02             	or     $0x2,%ecx
+  804349:	f6 c2 02             	test   $0x2,%dl
+  80434c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80434f:	89 c1                	mov    %eax,%ecx
+  804351:	83 c9 01             	or     $0x1,%ecx
+  804354:	48 85 d2             	test   %rdx,%rdx
+  804357:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80435a:	89 c1                	mov    %eax,%ecx
+  80435c:	83 c9 40             	or     $0x40,%ecx
+  80435f:	f6 c6 04             	test   $0x4,%dh
+  804362:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804365:	5d                   	pop    %rbp
+  804366:	c3                   	ret
+
+0000000000804367 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804367:	55                   	push   %rbp
+  804368:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80436b:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  804372:	00 00 00 
+  804375:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804377:	48 c1 e8 06          	shr    $0x6,%rax
+  80437b:	83 e0 01             	and    $0x1,%eax
+}
+  80437e:	5d                   	pop    %rbp
+  80437f:	c3                   	ret
+
+0000000000804380 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  804380:	55                   	push   %rbp
+  804381:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804384:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  80438b:	00 00 00 
+  80438e:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  804390:	48 c1 e8 05          	shr    $0x5,%rax
+  804394:	83 e0 01             	and    $0x1,%eax
+}
+  804397:	5d                   	pop    %rbp
+  804398:	c3                   	ret
+
+0000000000804399 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804399:	55                   	push   %rbp
+  80439a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80439d:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  8043a4:	00 00 00 
+  8043a7:	ff d0                	call   *%rax
+  8043a9:	83 e0 01             	and    $0x1,%eax
+}
+  8043ac:	5d                   	pop    %rbp
+  8043ad:	c3                   	ret
+
+00000000008043ae <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+  8043b2:	41 57                	push   %r15
+  8043b4:	41 56                	push   %r14
+  8043b6:	41 55                	push   %r13
+  8043b8:	41 54                	push   %r12
+  8043ba:	53                   	push   %rbx
+  8043bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8043bf:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8043c3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8043c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8043cc:	49 bd 99 43 80 00 00 	movabs $0x804399,%r13
+  8043d3:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8043d6:	49 bf 21 43 80 00 00 	movabs $0x804321,%r15
+  8043dd:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8043e0:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8043e7:	00 00 00 
+  8043ea:	eb 0c                	jmp    8043f8 <foreach_shared_region+0x4a>
+  8043ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8043f3:	4c 39 f3             	cmp    %r14,%rbx
+  8043f6:	74 2e                	je     804426 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8043f8:	48 89 df             	mov    %rbx,%rdi
+  8043fb:	41 ff d5             	call   *%r13
+  8043fe:	84 c0                	test   %al,%al
+  804400:	74 ea                	je     8043ec <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  804402:	48 89 df             	mov    %rbx,%rdi
+  804405:	41 ff d7             	call   *%r15
+  804408:	a8 40                	test   $0x40,%al
+  80440a:	74 e0                	je     8043ec <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  80440c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804413:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804417:	48 89 df             	mov    %rbx,%rdi
+  80441a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80441e:	ff d0                	call   *%rax
+				if (res < 0) {
+  804420:	85 c0                	test   %eax,%eax
+  804422:	79 c8                	jns    8043ec <foreach_shared_region+0x3e>
+  804424:	eb 05                	jmp    80442b <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  804426:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80442b:	48 83 c4 18          	add    $0x18,%rsp
+  80442f:	5b                   	pop    %rbx
+  804430:	41 5c                	pop    %r12
+  804432:	41 5d                	pop    %r13
+  804434:	41 5e                	pop    %r14
+  804436:	41 5f                	pop    %r15
+  804438:	5d                   	pop    %rbp
+  804439:	c3                   	ret
+
+000000000080443a <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80443a:	55                   	push   %rbp
+  80443b:	48 89 e5             	mov    %rsp,%rbp
+  80443e:	41 55                	push   %r13
+  804440:	41 54                	push   %r12
+  804442:	53                   	push   %rbx
+  804443:	48 83 ec 08          	sub    $0x8,%rsp
+  804447:	49 89 fc             	mov    %rdi,%r12
+  80444a:	48 89 f7             	mov    %rsi,%rdi
+  80444d:	48 89 d3             	mov    %rdx,%rbx
+  804450:	49 89 cd             	mov    %rcx,%r13
+  804453:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804456:	48 85 f6             	test   %rsi,%rsi
+  804459:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804460:	00 00 00 
+  804463:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  804467:	be 00 10 00 00       	mov    $0x1000,%esi
+  80446c:	48 85 db             	test   %rbx,%rbx
+  80446f:	74 03                	je     804474 <ipc_recv_timed+0x3a>
+  804471:	48 8b 33             	mov    (%rbx),%rsi
+  804474:	48 b8 bf 1b 80 00 00 	movabs $0x801bbf,%rax
+  80447b:	00 00 00 
+  80447e:	ff d0                	call   *%rax
+    if (res < 0) {
+  804480:	85 c0                	test   %eax,%eax
+  804482:	78 75                	js     8044f9 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804484:	4d 85 e4             	test   %r12,%r12
+  804487:	74 14                	je     80449d <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  804489:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804490:	00 00 00 
+  804493:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  804499:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80449d:	4d 85 ed             	test   %r13,%r13
+  8044a0:	74 14                	je     8044b6 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  8044a2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044a9:	00 00 00 
+  8044ac:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  8044b2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  8044b6:	48 85 db             	test   %rbx,%rbx
+  8044b9:	74 23                	je     8044de <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044bb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044c2:	00 00 00 
+  8044c5:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8044cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044d0:	85 c9                	test   %ecx,%ecx
+  8044d2:	74 07                	je     8044db <ipc_recv_timed+0xa1>
+  8044d4:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8044db:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8044de:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044e5:	00 00 00 
+  8044e8:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8044ee:	48 83 c4 08          	add    $0x8,%rsp
+  8044f2:	5b                   	pop    %rbx
+  8044f3:	41 5c                	pop    %r12
+  8044f5:	41 5d                	pop    %r13
+  8044f7:	5d                   	pop    %rbp
+  8044f8:	c3                   	ret
+        if (from_env_store != NULL) {
+  8044f9:	4d 85 e4             	test   %r12,%r12
+  8044fc:	74 08                	je     804506 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8044fe:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804505:	00 
+        if (perm_store != NULL) {
+  804506:	4d 85 ed             	test   %r13,%r13
+  804509:	74 08                	je     804513 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  80450b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804512:	00 
+        if (size != NULL) {
+  804513:	48 85 db             	test   %rbx,%rbx
+  804516:	74 d6                	je     8044ee <ipc_recv_timed+0xb4>
+            *size = 0;
+  804518:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80451f:	eb cd                	jmp    8044ee <ipc_recv_timed+0xb4>
+
+0000000000804521 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804521:	55                   	push   %rbp
+  804522:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  804525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80452b:	48 b8 3a 44 80 00 00 	movabs $0x80443a,%rax
+  804532:	00 00 00 
+  804535:	ff d0                	call   *%rax
+}
+  804537:	5d                   	pop    %rbp
+  804538:	c3                   	ret
+
+0000000000804539 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804539:	55                   	push   %rbp
+  80453a:	48 89 e5             	mov    %rsp,%rbp
+  80453d:	41 57                	push   %r15
+  80453f:	41 56                	push   %r14
+  804541:	41 55                	push   %r13
+  804543:	41 54                	push   %r12
+  804545:	53                   	push   %rbx
+  804546:	48 83 ec 18          	sub    $0x18,%rsp
+  80454a:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80454d:	48 89 d3             	mov    %rdx,%rbx
+  804550:	49 89 cc             	mov    %rcx,%r12
+  804553:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804556:	48 85 d2             	test   %rdx,%rdx
+  804559:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804560:	00 00 00 
+  804563:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804567:	89 f0                	mov    %esi,%eax
+  804569:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80456d:	48 89 da             	mov    %rbx,%rdx
+  804570:	48 89 c6             	mov    %rax,%rsi
+  804573:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  80457a:	00 00 00 
+  80457d:	ff d0                	call   *%rax
+    while (res < 0) {
+  80457f:	85 c0                	test   %eax,%eax
+  804581:	79 65                	jns    8045e8 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  804583:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804586:	75 33                	jne    8045bb <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  804588:	49 bf 96 18 80 00 00 	movabs $0x801896,%r15
+  80458f:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  804592:	49 be 93 1b 80 00 00 	movabs $0x801b93,%r14
+  804599:	00 00 00 
+        sys_yield();
+  80459c:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80459f:	45 89 e8             	mov    %r13d,%r8d
+  8045a2:	4c 89 e1             	mov    %r12,%rcx
+  8045a5:	48 89 da             	mov    %rbx,%rdx
+  8045a8:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8045ac:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8045af:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  8045b2:	85 c0                	test   %eax,%eax
+  8045b4:	79 32                	jns    8045e8 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  8045b6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8045b9:	74 e1                	je     80459c <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  8045bb:	89 c1                	mov    %eax,%ecx
+  8045bd:	48 ba 52 50 80 00 00 	movabs $0x805052,%rdx
+  8045c4:	00 00 00 
+  8045c7:	be 52 00 00 00       	mov    $0x52,%esi
+  8045cc:	48 bf 66 50 80 00 00 	movabs $0x805066,%rdi
+  8045d3:	00 00 00 
+  8045d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045db:	49 b8 24 08 80 00 00 	movabs $0x800824,%r8
+  8045e2:	00 00 00 
+  8045e5:	41 ff d0             	call   *%r8
+    }
+}
+  8045e8:	48 83 c4 18          	add    $0x18,%rsp
+  8045ec:	5b                   	pop    %rbx
+  8045ed:	41 5c                	pop    %r12
+  8045ef:	41 5d                	pop    %r13
+  8045f1:	41 5e                	pop    %r14
+  8045f3:	41 5f                	pop    %r15
+  8045f5:	5d                   	pop    %rbp
+  8045f6:	c3                   	ret
+
+00000000008045f7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8045f7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8045fc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804603:	00 00 00 
+  804606:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80460a:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80460e:	48 c1 e2 04          	shl    $0x4,%rdx
+  804612:	48 01 ca             	add    %rcx,%rdx
+  804615:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80461b:	39 fa                	cmp    %edi,%edx
+  80461d:	74 12                	je     804631 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  80461f:	48 83 c0 01          	add    $0x1,%rax
+  804623:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804629:	75 db                	jne    804606 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80462b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804630:	c3                   	ret
+            return envs[i].env_id;
+  804631:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  804635:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  804639:	48 c1 e2 04          	shl    $0x4,%rdx
+  80463d:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  804644:	00 00 00 
+  804647:	48 01 d0             	add    %rdx,%rax
+  80464a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804650:	c3                   	ret
+  804651:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804658 <__rodata_start>:
+  804658:	73 68                	jae    8046c2 <__rodata_start+0x6a>
+  80465a:	65 6c                	gs insb (%dx),%es:(%rdi)
+  80465c:	6c                   	insb   (%dx),%es:(%rdi)
+  80465d:	20 70 72             	and    %dh,0x72(%rax)
+  804660:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804661:	64 75 63             	fs jne 8046c7 <__rodata_start+0x6f>
+  804664:	65 64 20 69 6e       	gs and %ch,%fs:0x6e(%rcx)
+  804669:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  80466c:	72 65                	jb     8046d3 <__rodata_start+0x7b>
+  80466e:	63 74 20 6f          	movsxd 0x6f(%rax,%riz,1),%esi
+  804672:	75 74                	jne    8046e8 <__rodata_start+0x90>
+  804674:	70 75                	jo     8046eb <__rodata_start+0x93>
+  804676:	74 2e                	je     8046a6 <__rodata_start+0x4e>
+  804678:	0a 00                	or     (%rax),%al
+  80467a:	00 00                	add    %al,(%rax)
+  80467c:	00 00                	add    %al,(%rax)
+  80467e:	00 00                	add    %al,(%rax)
+  804680:	72 75                	jb     8046f7 <__rodata_start+0x9f>
+  804682:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804683:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804684:	69 6e 67 20 73 68 20 	imul   $0x20687320,0x67(%rsi),%ebp
+  80468b:	2d 78 20 3c 20       	sub    $0x203c2078,%eax
+  804690:	74 65                	je     8046f7 <__rodata_start+0x9f>
+  804692:	73 74                	jae    804708 <__rodata_start+0xb0>
+  804694:	73 68                	jae    8046fe <__rodata_start+0xa6>
+  804696:	65 6c                	gs insb (%dx),%es:(%rdi)
+  804698:	6c                   	insb   (%dx),%es:(%rdi)
+  804699:	2e 73 68             	jae,pn 804704 <__rodata_start+0xac>
+  80469c:	20 7c 20 63          	and    %bh,0x63(%rax,%riz,1)
+  8046a0:	61                   	(bad)
+  8046a1:	74 0a                	je     8046ad <__rodata_start+0x55>
+  8046a3:	00 00                	add    %al,(%rax)
+  8046a5:	00 00                	add    %al,(%rax)
+  8046a7:	00 6f 70             	add    %ch,0x70(%rdi)
+  8046aa:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8046ac:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  8046b0:	74 73                	je     804725 <__rodata_start+0xcd>
+  8046b2:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  8046b7:	6b 65 79 20          	imul   $0x20,0x79(%rbp),%esp
+  8046bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8046bd:	72 20                	jb     8046df <__rodata_start+0x87>
+  8046bf:	72 65                	jb     804726 <__rodata_start+0xce>
+  8046c1:	61                   	(bad)
+  8046c2:	64 69 6e 67 3a 20 25 	imul   $0x6925203a,%fs:0x67(%rsi),%ebp
+  8046c9:	69 
+  8046ca:	00 65 78             	add    %ah,0x78(%rbp)
+  8046cd:	70 65                	jo     804734 <__rodata_start+0xdc>
+  8046cf:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  8046d3:	3a 0a                	cmp    (%rdx),%cl
+  8046d5:	3d 3d 3d 0a 25       	cmp    $0x250a3d3d,%eax
+  8046da:	63 00                	movsxd (%rax),%eax
+  8046dc:	3d 3d 3d 0a 67       	cmp    $0x670a3d3d,%eax
+  8046e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046e2:	74 3a                	je     80471e <__rodata_start+0xc6>
+  8046e4:	0a 3d 3d 3d 0a 25    	or     0x250a3d3d(%rip),%bh        # 258a8427 <__bss_end+0x2509e427>
+  8046ea:	63 00                	movsxd (%rax),%eax
+  8046ec:	3d 3d 3d 0a 00       	cmp    $0xa3d3d,%eax
+  8046f1:	74 65                	je     804758 <__rodata_start+0x100>
+  8046f3:	73 74                	jae    804769 <__rodata_start+0x111>
+  8046f5:	73 68                	jae    80475f <__rodata_start+0x107>
+  8046f7:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8046f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046fa:	2e 73 68             	jae,pn 804765 <__rodata_start+0x10d>
+  8046fd:	00 6f 70             	add    %ch,0x70(%rdi)
+  804700:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804702:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  804706:	74 73                	je     80477b <__rodata_start+0x123>
+  804708:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  80470d:	73 68                	jae    804777 <__rodata_start+0x11f>
+  80470f:	3a 20                	cmp    (%rax),%ah
+  804711:	25 69 00 75 73       	and    $0x73750069,%eax
+  804716:	65 72 2f             	gs jb  804748 <__rodata_start+0xf0>
+  804719:	74 65                	je     804780 <__rodata_start+0x128>
+  80471b:	73 74                	jae    804791 <__rodata_start+0x139>
+  80471d:	73 68                	jae    804787 <__rodata_start+0x12f>
+  80471f:	65 6c                	gs insb (%dx),%es:(%rdi)
+  804721:	6c                   	insb   (%dx),%es:(%rdi)
+  804722:	2e 63 00             	cs movsxd (%rax),%eax
+  804725:	70 69                	jo     804790 <__rodata_start+0x138>
+  804727:	70 65                	jo     80478e <__rodata_start+0x136>
+  804729:	3a 20                	cmp    (%rax),%ah
+  80472b:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  804730:	72 6b                	jb     80479d <__rodata_start+0x145>
+  804732:	3a 20                	cmp    (%rax),%ah
+  804734:	25 69 00 2d 78       	and    $0x782d0069,%eax
+  804739:	00 2f                	add    %ch,(%rdi)
+  80473b:	73 68                	jae    8047a5 <__rodata_start+0x14d>
+  80473d:	00 73 70             	add    %dh,0x70(%rbx)
+  804740:	61                   	(bad)
+  804741:	77 6e                	ja     8047b1 <__rodata_start+0x159>
+  804743:	3a 20                	cmp    (%rax),%ah
+  804745:	25 69 00 74 65       	and    $0x65740069,%eax
+  80474a:	73 74                	jae    8047c0 <__rodata_start+0x168>
+  80474c:	73 68                	jae    8047b6 <__rodata_start+0x15e>
+  80474e:	65 6c                	gs insb (%dx),%es:(%rdi)
+  804750:	6c                   	insb   (%dx),%es:(%rdi)
+  804751:	2e 6b 65 79 00       	cs imul $0x0,0x79(%rbp),%esp
+  804756:	72 65                	jb     8047bd <__rodata_start+0x165>
+  804758:	61                   	(bad)
+  804759:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  804760:	73 
+  804761:	74 73                	je     8047d6 <__rodata_start+0x17e>
+  804763:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  804768:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804769:	75 74                	jne    8047df <__rodata_start+0x187>
+  80476b:	3a 20                	cmp    (%rax),%ah
+  80476d:	25 69 00 72 65       	and    $0x65720069,%eax
+  804772:	61                   	(bad)
+  804773:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  80477a:	73 
+  80477b:	74 73                	je     8047f0 <__rodata_start+0x198>
+  80477d:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  804782:	6b 65 79 3a          	imul   $0x3a,0x79(%rbp),%esp
+  804786:	20 25 69 00 53 54    	and    %ah,0x54530069(%rip)        # 54d347f5 <__bss_end+0x5452a7f5>
+  80478c:	55                   	push   %rbp
+  80478d:	42 20 46 4f          	rex.X and %al,0x4f(%rsi)
+  804791:	52                   	push   %rdx
+  804792:	20 43 4f             	and    %al,0x4f(%rbx)
+  804795:	4d 50                	rex.WRB push %r8
+  804797:	49                   	rex.WB
+  804798:	4c                   	rex.WR
+  804799:	45 52                	rex.RB push %r10
+  80479b:	0a 00                	or     (%rax),%al
+  80479d:	73 68                	jae    804807 <__rodata_start+0x1af>
+  80479f:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8047a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a2:	20 72 61             	and    %dh,0x61(%rdx)
+  8047a5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047a6:	20 63 6f             	and    %ah,0x6f(%rbx)
+  8047a9:	72 72                	jb     80481d <__rodata_start+0x1c5>
+  8047ab:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8047b0:	0a 00                	or     (%rax),%al
+  8047b2:	3c 63                	cmp    $0x63,%al
+  8047b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047b5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047b6:	73 3e                	jae    8047f6 <__rodata_start+0x19e>
+  8047b8:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8047bb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047bc:	73 00                	jae    8047be <__rodata_start+0x166>
+  8047be:	3c 75                	cmp    $0x75,%al
+  8047c0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047c1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8047c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047c6:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  8047ca:	30 38                	xor    %bh,(%rax)
+  8047cc:	78 5d                	js     80482b <__rodata_start+0x1d3>
+  8047ce:	20 75 73             	and    %dh,0x73(%rbp)
+  8047d1:	65 72 20             	gs jb  8047f4 <__rodata_start+0x19c>
+  8047d4:	70 61                	jo     804837 <__rodata_start+0x1df>
+  8047d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047d7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8047de:	73 20                	jae    804800 <__rodata_start+0x1a8>
+  8047e0:	61                   	(bad)
+  8047e1:	74 20                	je     804803 <__rodata_start+0x1ab>
+  8047e3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8047e8:	3a 20                	cmp    (%rax),%ah
+  8047ea:	00 30                	add    %dh,(%rax)
+  8047ec:	31 32                	xor    %esi,(%rdx)
+  8047ee:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8047f5:	41                   	rex.B
+  8047f6:	42                   	rex.X
+  8047f7:	43                   	rex.XB
+  8047f8:	44                   	rex.R
+  8047f9:	45                   	rex.RB
+  8047fa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8047fd:	31 32                	xor    %esi,(%rdx)
+  8047ff:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804806:	61                   	(bad)
+  804807:	62 63 64 65 66       	(bad)
+  80480c:	00 28                	add    %ch,(%rax)
+  80480e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80480f:	75 6c                	jne    80487d <__rodata_start+0x225>
+  804811:	6c                   	insb   (%dx),%es:(%rdi)
+  804812:	29 00                	sub    %eax,(%rax)
+  804814:	65 72 72             	gs jb  804889 <__rodata_start+0x231>
+  804817:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804818:	72 20                	jb     80483a <__rodata_start+0x1e2>
+  80481a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80481f:	73 70                	jae    804891 <__rodata_start+0x239>
+  804821:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804825:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80482c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80482d:	72 00                	jb     80482f <__rodata_start+0x1d7>
+  80482f:	62 61 64 20 65       	(bad)
+  804834:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804835:	76 69                	jbe    8048a0 <__rodata_start+0x248>
+  804837:	72 6f                	jb     8048a8 <__rodata_start+0x250>
+  804839:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80483a:	6d                   	insl   (%dx),%es:(%rdi)
+  80483b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80483d:	74 00                	je     80483f <__rodata_start+0x1e7>
+  80483f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804846:	20 70 61             	and    %dh,0x61(%rax)
+  804849:	72 61                	jb     8048ac <__rodata_start+0x254>
+  80484b:	6d                   	insl   (%dx),%es:(%rdi)
+  80484c:	65 74 65             	gs je  8048b4 <__rodata_start+0x25c>
+  80484f:	72 00                	jb     804851 <__rodata_start+0x1f9>
+  804851:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804852:	75 74                	jne    8048c8 <__rodata_start+0x270>
+  804854:	20 6f 66             	and    %ch,0x66(%rdi)
+  804857:	20 6d 65             	and    %ch,0x65(%rbp)
+  80485a:	6d                   	insl   (%dx),%es:(%rdi)
+  80485b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80485c:	72 79                	jb     8048d7 <__rodata_start+0x27f>
+  80485e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804861:	74 20                	je     804883 <__rodata_start+0x22b>
+  804863:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804864:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804868:	76 69                	jbe    8048d3 <__rodata_start+0x27b>
+  80486a:	72 6f                	jb     8048db <__rodata_start+0x283>
+  80486c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80486d:	6d                   	insl   (%dx),%es:(%rdi)
+  80486e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804870:	74 73                	je     8048e5 <__rodata_start+0x28d>
+  804872:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804875:	72 72                	jb     8048e9 <__rodata_start+0x291>
+  804877:	75 70                	jne    8048e9 <__rodata_start+0x291>
+  804879:	74 65                	je     8048e0 <__rodata_start+0x288>
+  80487b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804880:	75 67                	jne    8048e9 <__rodata_start+0x291>
+  804882:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804885:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804887:	00 73 65             	add    %dh,0x65(%rbx)
+  80488a:	67 6d                	insl   (%dx),%es:(%edi)
+  80488c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80488e:	74 61                	je     8048f1 <__rodata_start+0x299>
+  804890:	74 69                	je     8048fb <__rodata_start+0x2a3>
+  804892:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804893:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804894:	20 66 61             	and    %ah,0x61(%rsi)
+  804897:	75 6c                	jne    804905 <__rodata_start+0x2ad>
+  804899:	74 00                	je     80489b <__rodata_start+0x243>
+  80489b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048a2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8048a5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8048a9:	61                   	(bad)
+  8048aa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8048af:	20 73 75             	and    %dh,0x75(%rbx)
+  8048b2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8048b5:	73 79                	jae    804930 <__rodata_start+0x2d8>
+  8048b7:	73 74                	jae    80492d <__rodata_start+0x2d5>
+  8048b9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8048bb:	20 63 61             	and    %ah,0x61(%rbx)
+  8048be:	6c                   	insb   (%dx),%es:(%rdi)
+  8048bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8048c0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8048c3:	74 72                	je     804937 <__rodata_start+0x2df>
+  8048c5:	79 20                	jns    8048e7 <__rodata_start+0x28f>
+  8048c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048c9:	74 20                	je     8048eb <__rodata_start+0x293>
+  8048cb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048cd:	75 6e                	jne    80493d <__rodata_start+0x2e5>
+  8048cf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8048d3:	76 20                	jbe    8048f5 <__rodata_start+0x29d>
+  8048d5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8048dc:	72 65                	jb     804943 <__rodata_start+0x2eb>
+  8048de:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8048e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8048e6:	65 78 70             	gs js  804959 <__rodata_start+0x301>
+  8048e9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8048ee:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8048f1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8048f5:	20 66 69             	and    %ah,0x69(%rsi)
+  8048f8:	6c                   	insb   (%dx),%es:(%rdi)
+  8048f9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8048fd:	20 66 72             	and    %ah,0x72(%rsi)
+  804900:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804905:	61                   	(bad)
+  804906:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804909:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80490f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804912:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804913:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804914:	20 6d 61             	and    %ch,0x61(%rbp)
+  804917:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804918:	79 20                	jns    80493a <__rodata_start+0x2e2>
+  80491a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804921:	72 65                	jb     804988 <__rodata_start+0x330>
+  804923:	20 6f 70             	and    %ch,0x70(%rdi)
+  804926:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804928:	00 66 69             	add    %ah,0x69(%rsi)
+  80492b:	6c                   	insb   (%dx),%es:(%rdi)
+  80492c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804930:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804933:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804934:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804937:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804938:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804939:	74 20                	je     80495b <__rodata_start+0x303>
+  80493b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80493d:	75 6e                	jne    8049ad <__rodata_start+0x355>
+  80493f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804943:	76 61                	jbe    8049a6 <__rodata_start+0x34e>
+  804945:	6c                   	insb   (%dx),%es:(%rdi)
+  804946:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80494d:	00 
+  80494e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804955:	72 65                	jb     8049bc <__rodata_start+0x364>
+  804957:	61                   	(bad)
+  804958:	64 79 20             	fs jns 80497b <__rodata_start+0x323>
+  80495b:	65 78 69             	gs js  8049c7 <__rodata_start+0x36f>
+  80495e:	73 74                	jae    8049d4 <__rodata_start+0x37c>
+  804960:	73 00                	jae    804962 <__rodata_start+0x30a>
+  804962:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804963:	70 65                	jo     8049ca <__rodata_start+0x372>
+  804965:	72 61                	jb     8049c8 <__rodata_start+0x370>
+  804967:	74 69                	je     8049d2 <__rodata_start+0x37a>
+  804969:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80496a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80496b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80496e:	74 20                	je     804990 <__rodata_start+0x338>
+  804970:	73 75                	jae    8049e7 <__rodata_start+0x38f>
+  804972:	70 70                	jo     8049e4 <__rodata_start+0x38c>
+  804974:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804975:	72 74                	jb     8049eb <__rodata_start+0x393>
+  804977:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  80497d:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  804982:	74 00                	je     804984 <__rodata_start+0x32c>
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80499f:	00 
+  8049a0:	61                   	(bad)
+  8049a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8049a7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049ad:	00 00                	add    %al,(%rax)
+  8049af:	00 92 11 80 00 00    	add    %dl,0x8011(%rdx)
+  8049b5:	00 00                	add    %al,(%rax)
+  8049b7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049bd:	00 00                	add    %al,(%rax)
+  8049bf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049c5:	00 00                	add    %al,(%rax)
+  8049c7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049cd:	00 00                	add    %al,(%rax)
+  8049cf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049d5:	00 00                	add    %al,(%rax)
+  8049d7:	00 80 0b 80 00 00    	add    %al,0x800b(%rax)
+  8049dd:	00 00                	add    %al,(%rax)
+  8049df:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049e5:	00 00                	add    %al,(%rax)
+  8049e7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  8049ed:	00 00                	add    %al,(%rax)
+  8049ef:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  8049f3:	00 00                	add    %al,(%rax)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 ee                	add    %ch,%dh
+  8049f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8049ff:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  804a0b:	00 00                	add    %al,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 c5                	add    %al,%ch
+  804b49:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  804b4f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 11                	add    %dl,(%rcx)
+  804ba1:	0c 80                	or     $0x80,%al
+  804ba3:	00 00                	add    %al,(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 e0                	add    %ah,%al
+  804ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  804bae:	00 00                	add    %al,(%rax)
+  804bb0:	a2 11 80 00 00 00 00 	movabs %al,0xa200000000008011
+  804bb7:	00 a2 
+  804bb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  804bbf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 40 0c             	add    %al,0xc(%rax)
+  804bd2:	80 00 00             	addb   $0x0,(%rax)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 06                	add    %al,(%rsi)
+  804be9:	0c 80                	or     $0x80,%al
+  804beb:	00 00                	add    %al,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 88 0f 80 00 00    	add    %cl,0x800f(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 52 10             	add    %dl,0x10(%rdx)
+  804c0a:	80 00 00             	addb   $0x0,(%rax)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 d7                	add    %dl,%bh
+  804c21:	0c 80                	or     $0x80,%al
+  804c23:	00 00                	add    %al,(%rax)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 b4 0e 80 00 00 00 	add    %dh,0x80(%rsi,%rcx,1)
+  804c36:	00 00                	add    %al,(%rax)
+  804c38:	a2 11 80 00 00 00 00 	movabs %al,0xa200000000008011
+  804c3f:	00 a2 
+  804c41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  804c47:	00 c5                	add    %al,%ch
+  804c49:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  804c4f:	00 a2 11 80 00 00    	add    %ah,0x8011(%rdx)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804c60 <error_string>:
+	...
+  804c68:	1d 48 80 00 00 00 00 00 2f 48 80 00 00 00 00 00     .H....../H......
+  804c78:	3f 48 80 00 00 00 00 00 51 48 80 00 00 00 00 00     ?H......QH......
+  804c88:	5f 48 80 00 00 00 00 00 73 48 80 00 00 00 00 00     _H......sH......
+  804c98:	88 48 80 00 00 00 00 00 9b 48 80 00 00 00 00 00     .H.......H......
+  804ca8:	ad 48 80 00 00 00 00 00 c1 48 80 00 00 00 00 00     .H.......H......
+  804cb8:	d1 48 80 00 00 00 00 00 e4 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	fb 48 80 00 00 00 00 00 11 49 80 00 00 00 00 00     .H.......I......
+  804cd8:	29 49 80 00 00 00 00 00 41 49 80 00 00 00 00 00     )I......AI......
+  804ce8:	4e 49 80 00 00 00 00 00 08 4d 80 00 00 00 00 00     NI.......M......
+  804cf8:	62 49 80 00 00 00 00 00 7a 49 80 00 00 00 00 00     bI......zI......
+  804d08:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d18:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d28:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804d38:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804d48:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804d58:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804d68:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804d78:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804d88:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804d98:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 72     pe %d...[%08x] r
+  804da8:	65 61 64 6d 61 70 20 25 64 20 2d 2d 20 62 61 64     eadmap %d -- bad
+  804db8:	20 6d 6f 64 65 0a 00 00 5b 25 30 38 78 5d 20 66      mode...[%08x] f
+  804dc8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804dd8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804de8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804df8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804e08:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804e18:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804e20 <devtab>:
+  804e20:	a0 60 80 00 00 00 00 00 40 61 80 00 00 00 00 00     .`......@a......
+  804e30:	00 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804e40:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804e50:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804e60:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804e70:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804e80:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804e90:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804ea0:	6d 61 70 5f 73 65 67 6d 65 6e 2e 73 79 73 5f 61     map_segmen.sys_a
+  804eb0:	6c 6c 6f 63 5f 72 65 67 69 6e 20 66 61 69 6c 65     lloc_regin faile
+  804ec0:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804ed0:	65 6e 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     ent.sys_alloc_re
+  804ee0:	67 69 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a 00     gin failed: %i..
+  804ef0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  804f00:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  804f10:	64 3a 20 25 69 0a 00 00 6d 61 70 5f 73 65 67 6d     d: %i...map_segm
+  804f20:	65 6e 74 2e 73 79 73 5f 75 6e 6d 61 70 5f 72 65     ent.sys_unmap_re
+  804f30:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+  804f40:	00 45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20     .Elf magic %08x 
+  804f50:	77 61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72     want %08x..asser
+  804f60:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  804f70:	6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70 5f     lib/spawn.c.map_
+  804f80:	73 65 67 6d 65 6e 74 2e 73 65 65 6b 20 66 61 69     segment.seek fai
+  804f90:	6c 65 64 3a 20 25 69 0a 00 6d 61 70 5f 73 65 67     led: %i..map_seg
+  804fa0:	6d 65 6e 74 2e 72 65 61 64 6e 20 66 61 69 6c 65     ment.readn faile
+  804fb0:	64 3a 20 25 69 0a 00 63 6f 70 79 5f 73 68 61 72     d: %i..copy_shar
+  804fc0:	65 64 5f 72 65 67 69 6f 6e 3a 20 25 69 00 73 79     ed_region: %i.sy
+  804fd0:	73 5f 65 6e 76 5f 73 65 74 5f 74 72 61 70 66 72     s_env_set_trapfr
+  804fe0:	61 6d 65 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f     ame: %i.sys_env_
+  804ff0:	73 65 74 5f 73 74 61 74 75 73 3a 20 25 69 00 3c     set_status: %i.<
+  805000:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805010:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805020:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805030:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  805040:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805050:	63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72     c.ipc_send error
+  805060:	3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00     : %i..lib/ipc.c.
+  805070:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805080:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805090:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805100:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805110:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805120:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805130:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805140:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805160:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805170:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805180:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
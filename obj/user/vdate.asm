@@ -0,0 +1,7375 @@
+
+obj/user/vdate:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5f 03 00 00       	call   800382 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = vsys_gettime();
+  80002e:	48 b8 e7 34 80 00 00 	movabs $0x8034e7,%rax
+  800035:	00 00 00 
+  800038:	ff d0                	call   *%rax
+  80003a:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  80003d:	48 63 f0             	movslq %eax,%rsi
+  800040:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  800047:	48 c1 fe 35          	sar    $0x35,%rsi
+  80004b:	c1 f8 1f             	sar    $0x1f,%eax
+  80004e:	29 c6                	sub    %eax,%esi
+  800050:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  800056:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  80005c:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  800062:	89 f9                	mov    %edi,%ecx
+  800064:	83 c7 01             	add    $0x1,%edi
+  800067:	8d 41 03             	lea    0x3(%rcx),%eax
+  80006a:	85 c9                	test   %ecx,%ecx
+  80006c:	0f 49 c1             	cmovns %ecx,%eax
+  80006f:	c1 f8 02             	sar    $0x2,%eax
+  800072:	01 f0                	add    %esi,%eax
+  800074:	48 63 d1             	movslq %ecx,%rdx
+  800077:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80007e:	48 89 d3             	mov    %rdx,%rbx
+  800081:	48 c1 fb 25          	sar    $0x25,%rbx
+  800085:	49 89 db             	mov    %rbx,%r11
+  800088:	41 89 c9             	mov    %ecx,%r9d
+  80008b:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80008f:	45 89 ca             	mov    %r9d,%r10d
+  800092:	41 29 da             	sub    %ebx,%r10d
+  800095:	44 01 d0             	add    %r10d,%eax
+  800098:	48 c1 fa 27          	sar    $0x27,%rdx
+  80009c:	44 29 ca             	sub    %r9d,%edx
+  80009f:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  8000a6:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000ac:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  8000b2:	41 39 c0             	cmp    %eax,%r8d
+  8000b5:	7d ab                	jge    800062 <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  8000b7:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  8000bd:	8d 41 02             	lea    0x2(%rcx),%eax
+  8000c0:	89 ca                	mov    %ecx,%edx
+  8000c2:	83 ea 01             	sub    $0x1,%edx
+  8000c5:	0f 49 c2             	cmovns %edx,%eax
+  8000c8:	c1 f8 02             	sar    $0x2,%eax
+  8000cb:	01 c6                	add    %eax,%esi
+  8000cd:	48 63 c2             	movslq %edx,%rax
+  8000d0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8000d7:	48 89 c3             	mov    %rax,%rbx
+  8000da:	48 c1 fb 25          	sar    $0x25,%rbx
+  8000de:	c1 fa 1f             	sar    $0x1f,%edx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	29 df                	sub    %ebx,%edi
+  8000e5:	01 fe                	add    %edi,%esi
+  8000e7:	48 c1 f8 27          	sar    $0x27,%rax
+  8000eb:	29 d0                	sub    %edx,%eax
+  8000ed:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8000f4:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8000fa:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8000fd:	4c 63 c9             	movslq %ecx,%r9
+  800100:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  800107:	4c 89 c8             	mov    %r9,%rax
+  80010a:	48 c1 f8 27          	sar    $0x27,%rax
+  80010e:	49 89 c2             	mov    %rax,%r10
+  800111:	89 c8                	mov    %ecx,%eax
+  800113:	c1 f8 1f             	sar    $0x1f,%eax
+  800116:	41 29 c2             	sub    %eax,%r10d
+  800119:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  800120:	41 89 ca             	mov    %ecx,%r10d
+  800123:	41 29 d2             	sub    %edx,%r10d
+  800126:	4d 89 d9             	mov    %r11,%r9
+  800129:	41 29 c1             	sub    %eax,%r9d
+  80012c:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  800130:	41 89 c9             	mov    %ecx,%r9d
+  800133:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  800136:	48 63 d6             	movslq %esi,%rdx
+  800139:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800140:	48 c1 ea 20          	shr    $0x20,%rdx
+  800144:	01 f2                	add    %esi,%edx
+  800146:	c1 fa 15             	sar    $0x15,%edx
+  800149:	89 f0                	mov    %esi,%eax
+  80014b:	c1 f8 1f             	sar    $0x1f,%eax
+  80014e:	29 c2                	sub    %eax,%edx
+  800150:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  800153:	41 89 cb             	mov    %ecx,%r11d
+  800156:	41 83 e3 03          	and    $0x3,%r11d
+  80015a:	44 89 cb             	mov    %r9d,%ebx
+  80015d:	eb 21                	jmp    800180 <umain+0x15b>
+  80015f:	85 d2                	test   %edx,%edx
+  800161:	40 0f 9f c7          	setg   %dil
+  800165:	40 0f b6 ff          	movzbl %dil,%edi
+  800169:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  80016d:	01 f8                	add    %edi,%eax
+  80016f:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800175:	39 c6                	cmp    %eax,%esi
+  800177:	0f 8c 89 00 00 00    	jl     800206 <umain+0x1e1>
+  80017d:	4c 89 c2             	mov    %r8,%rdx
+  800180:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  800187:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80018e:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  800195:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  80019c:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  8001a3:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  8001aa:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  8001b1:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  8001b8:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  8001bf:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8001c6:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8001cd:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8001d4:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8001db:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8001df:	45 85 d2             	test   %r10d,%r10d
+  8001e2:	0f 84 77 ff ff ff    	je     80015f <umain+0x13a>
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	45 85 db             	test   %r11d,%r11d
+  8001f0:	0f 85 73 ff ff ff    	jne    800169 <umain+0x144>
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	45 85 c9             	test   %r9d,%r9d
+  8001fb:	0f 84 68 ff ff ff    	je     800169 <umain+0x144>
+  800201:	e9 59 ff ff ff       	jmp    80015f <umain+0x13a>
+  800206:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  800208:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  80020f:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  800216:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  80021d:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  800224:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80022b:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  800232:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  800239:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  800240:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  800247:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80024e:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  800255:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  80025c:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  800263:	48 63 c2             	movslq %edx,%rax
+  800266:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  80026a:	45 85 d2             	test   %r10d,%r10d
+  80026d:	74 0e                	je     80027d <umain+0x258>
+  80026f:	f6 c1 03             	test   $0x3,%cl
+  800272:	0f 85 ff 00 00 00    	jne    800377 <umain+0x352>
+  800278:	45 85 c9             	test   %r9d,%r9d
+  80027b:	74 0b                	je     800288 <umain+0x263>
+  80027d:	83 ff 01             	cmp    $0x1,%edi
+  800280:	41 0f 9f c1          	setg   %r9b
+  800284:	45 0f b6 c9          	movzbl %r9b,%r9d
+  800288:	44 01 c8             	add    %r9d,%eax
+  80028b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800291:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  800293:	48 63 c6             	movslq %esi,%rax
+  800296:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  80029d:	48 c1 e8 20          	shr    $0x20,%rax
+  8002a1:	01 f0                	add    %esi,%eax
+  8002a3:	c1 f8 10             	sar    $0x10,%eax
+  8002a6:	41 89 f3             	mov    %esi,%r11d
+  8002a9:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  8002ad:	41 89 c2             	mov    %eax,%r10d
+  8002b0:	45 29 da             	sub    %r11d,%r10d
+  8002b3:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  8002ba:	29 fe                	sub    %edi,%esi
+  8002bc:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  8002bf:	48 63 f6             	movslq %esi,%rsi
+  8002c2:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8002c9:	48 c1 ee 20          	shr    $0x20,%rsi
+  8002cd:	44 01 d6             	add    %r10d,%esi
+  8002d0:	c1 fe 0b             	sar    $0xb,%esi
+  8002d3:	41 89 f0             	mov    %esi,%r8d
+  8002d6:	45 89 d1             	mov    %r10d,%r9d
+  8002d9:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8002dd:	89 f7                	mov    %esi,%edi
+  8002df:	44 29 cf             	sub    %r9d,%edi
+  8002e2:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8002e8:	44 89 d7             	mov    %r10d,%edi
+  8002eb:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8002ed:	44 29 d8             	sub    %r11d,%eax
+  8002f0:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8002f6:	48 63 c7             	movslq %edi,%rax
+  8002f9:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  800300:	48 c1 e8 20          	shr    $0x20,%rax
+  800304:	01 f8                	add    %edi,%eax
+  800306:	c1 f8 05             	sar    $0x5,%eax
+  800309:	41 89 fa             	mov    %edi,%r10d
+  80030c:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  800310:	44 29 d0             	sub    %r10d,%eax
+  800313:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  800317:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031a:	57                   	push   %rdi
+  80031b:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  80031c:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031f:	41 50                	push   %r8
+  800321:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  800325:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  800329:	48 ba 00 3a 80 00 00 	movabs $0x803a00,%rdx
+  800330:	00 00 00 
+  800333:	be 14 00 00 00       	mov    $0x14,%esi
+  800338:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 ba aa 0d 80 00 00 	movabs $0x800daa,%r10
+  800348:	00 00 00 
+  80034b:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("VDATE: %s\n", time);
+  80034e:	48 83 c4 20          	add    $0x20,%rsp
+  800352:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  800356:	48 bf 1e 3a 80 00 00 	movabs $0x803a1e,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 ba 00 05 80 00 00 	movabs $0x800500,%rdx
+  80036c:	00 00 00 
+  80036f:	ff d2                	call   *%rdx
+}
+  800371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  800377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037d:	e9 06 ff ff ff       	jmp    800288 <umain+0x263>
+
+0000000000800382 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	41 89 fd             	mov    %edi,%r13d
+  800390:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800393:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  80039a:	00 00 00 
+  80039d:	48 b8 f8 51 80 00 00 	movabs $0x8051f8,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 39 c2             	cmp    %rax,%rdx
+  8003aa:	73 17                	jae    8003c3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003ac:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003af:	49 89 c4             	mov    %rax,%r12
+  8003b2:	48 83 c3 08          	add    $0x8,%rbx
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	ff 53 f8             	call   *-0x8(%rbx)
+  8003be:	4c 39 e3             	cmp    %r12,%rbx
+  8003c1:	72 ef                	jb     8003b2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003c3:	48 b8 f1 13 80 00 00 	movabs $0x8013f1,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d4:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8003d8:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8003dc:	48 c1 e0 04          	shl    $0x4,%rax
+  8003e0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003e7:	00 00 00 
+  8003ea:	48 01 d0             	add    %rdx,%rax
+  8003ed:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003f4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003f7:	45 85 ed             	test   %r13d,%r13d
+  8003fa:	7e 0d                	jle    800409 <libmain+0x87>
+  8003fc:	49 8b 06             	mov    (%r14),%rax
+  8003ff:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800406:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800409:	4c 89 f6             	mov    %r14,%rsi
+  80040c:	44 89 ef             	mov    %r13d,%edi
+  80040f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800416:	00 00 00 
+  800419:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80041b:	48 b8 30 04 80 00 00 	movabs $0x800430,%rax
+  800422:	00 00 00 
+  800425:	ff d0                	call   *%rax
+#endif
+}
+  800427:	5b                   	pop    %rbx
+  800428:	41 5c                	pop    %r12
+  80042a:	41 5d                	pop    %r13
+  80042c:	41 5e                	pop    %r14
+  80042e:	5d                   	pop    %rbp
+  80042f:	c3                   	ret
+
+0000000000800430 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800430:	55                   	push   %rbp
+  800431:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800434:	48 b8 a7 1a 80 00 00 	movabs $0x801aa7,%rax
+  80043b:	00 00 00 
+  80043e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800440:	bf 00 00 00 00       	mov    $0x0,%edi
+  800445:	48 b8 86 13 80 00 00 	movabs $0x801386,%rax
+  80044c:	00 00 00 
+  80044f:	ff d0                	call   *%rax
+}
+  800451:	5d                   	pop    %rbp
+  800452:	c3                   	ret
+
+0000000000800453 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800453:	55                   	push   %rbp
+  800454:	48 89 e5             	mov    %rsp,%rbp
+  800457:	53                   	push   %rbx
+  800458:	48 83 ec 08          	sub    $0x8,%rsp
+  80045c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80045f:	8b 06                	mov    (%rsi),%eax
+  800461:	8d 50 01             	lea    0x1(%rax),%edx
+  800464:	89 16                	mov    %edx,(%rsi)
+  800466:	48 98                	cltq
+  800468:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80046d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800473:	74 0a                	je     80047f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800475:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80047d:	c9                   	leave
+  80047e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80047f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800483:	be ff 00 00 00       	mov    $0xff,%esi
+  800488:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  80048f:	00 00 00 
+  800492:	ff d0                	call   *%rax
+        state->offset = 0;
+  800494:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80049a:	eb d9                	jmp    800475 <putch+0x22>
+
+000000000080049c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80049c:	55                   	push   %rbp
+  80049d:	48 89 e5             	mov    %rsp,%rbp
+  8004a0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004a7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004aa:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004b1:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004be:	48 89 f1             	mov    %rsi,%rcx
+  8004c1:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004c8:	48 bf 53 04 80 00 00 	movabs $0x800453,%rdi
+  8004cf:	00 00 00 
+  8004d2:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  8004d9:	00 00 00 
+  8004dc:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004de:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004e5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004ec:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  8004f3:	00 00 00 
+  8004f6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004f8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004fe:	c9                   	leave
+  8004ff:	c3                   	ret
+
+0000000000800500 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+  800504:	48 83 ec 50          	sub    $0x50,%rsp
+  800508:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80050c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800510:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800514:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800518:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80051c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800523:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800527:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80052f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800533:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800537:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  80053e:	00 00 00 
+  800541:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800543:	c9                   	leave
+  800544:	c3                   	ret
+
+0000000000800545 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800545:	55                   	push   %rbp
+  800546:	48 89 e5             	mov    %rsp,%rbp
+  800549:	41 57                	push   %r15
+  80054b:	41 56                	push   %r14
+  80054d:	41 55                	push   %r13
+  80054f:	41 54                	push   %r12
+  800551:	53                   	push   %rbx
+  800552:	48 83 ec 18          	sub    $0x18,%rsp
+  800556:	49 89 fc             	mov    %rdi,%r12
+  800559:	49 89 f5             	mov    %rsi,%r13
+  80055c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800560:	8b 45 10             	mov    0x10(%rbp),%eax
+  800563:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800566:	41 89 cf             	mov    %ecx,%r15d
+  800569:	4c 39 fa             	cmp    %r15,%rdx
+  80056c:	73 5b                	jae    8005c9 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80056e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800572:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800576:	85 db                	test   %ebx,%ebx
+  800578:	7e 0e                	jle    800588 <print_num+0x43>
+            putch(padc, put_arg);
+  80057a:	4c 89 ee             	mov    %r13,%rsi
+  80057d:	44 89 f7             	mov    %r14d,%edi
+  800580:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800583:	83 eb 01             	sub    $0x1,%ebx
+  800586:	75 f2                	jne    80057a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800588:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80058c:	48 b9 44 3a 80 00 00 	movabs $0x803a44,%rcx
+  800593:	00 00 00 
+  800596:	48 b8 33 3a 80 00 00 	movabs $0x803a33,%rax
+  80059d:	00 00 00 
+  8005a0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	49 f7 f7             	div    %r15
+  8005b0:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005b4:	4c 89 ee             	mov    %r13,%rsi
+  8005b7:	41 ff d4             	call   *%r12
+}
+  8005ba:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005be:	5b                   	pop    %rbx
+  8005bf:	41 5c                	pop    %r12
+  8005c1:	41 5d                	pop    %r13
+  8005c3:	41 5e                	pop    %r14
+  8005c5:	41 5f                	pop    %r15
+  8005c7:	5d                   	pop    %rbp
+  8005c8:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d2:	49 f7 f7             	div    %r15
+  8005d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005dd:	52                   	push   %rdx
+  8005de:	45 0f be c9          	movsbl %r9b,%r9d
+  8005e2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005e6:	48 89 c2             	mov    %rax,%rdx
+  8005e9:	48 b8 45 05 80 00 00 	movabs $0x800545,%rax
+  8005f0:	00 00 00 
+  8005f3:	ff d0                	call   *%rax
+  8005f5:	48 83 c4 10          	add    $0x10,%rsp
+  8005f9:	eb 8d                	jmp    800588 <print_num+0x43>
+
+00000000008005fb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005fb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005ff:	48 8b 06             	mov    (%rsi),%rax
+  800602:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800606:	73 0a                	jae    800612 <sprintputch+0x17>
+        *state->start++ = ch;
+  800608:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80060c:	48 89 16             	mov    %rdx,(%rsi)
+  80060f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800612:	c3                   	ret
+
+0000000000800613 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800613:	55                   	push   %rbp
+  800614:	48 89 e5             	mov    %rsp,%rbp
+  800617:	48 83 ec 50          	sub    $0x50,%rsp
+  80061b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80061f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800623:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800627:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80062e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800632:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800636:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80063a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80063e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800642:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  800649:	00 00 00 
+  80064c:	ff d0                	call   *%rax
+}
+  80064e:	c9                   	leave
+  80064f:	c3                   	ret
+
+0000000000800650 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800650:	55                   	push   %rbp
+  800651:	48 89 e5             	mov    %rsp,%rbp
+  800654:	41 57                	push   %r15
+  800656:	41 56                	push   %r14
+  800658:	41 55                	push   %r13
+  80065a:	41 54                	push   %r12
+  80065c:	53                   	push   %rbx
+  80065d:	48 83 ec 38          	sub    $0x38,%rsp
+  800661:	49 89 fe             	mov    %rdi,%r14
+  800664:	49 89 f5             	mov    %rsi,%r13
+  800667:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80066a:	48 8b 01             	mov    (%rcx),%rax
+  80066d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800671:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800675:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800679:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80067d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800681:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800685:	0f b6 3b             	movzbl (%rbx),%edi
+  800688:	40 80 ff 25          	cmp    $0x25,%dil
+  80068c:	74 18                	je     8006a6 <vprintfmt+0x56>
+            if (!ch) return;
+  80068e:	40 84 ff             	test   %dil,%dil
+  800691:	0f 84 b1 06 00 00    	je     800d48 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800697:	40 0f b6 ff          	movzbl %dil,%edi
+  80069b:	4c 89 ee             	mov    %r13,%rsi
+  80069e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006a1:	4c 89 e3             	mov    %r12,%rbx
+  8006a4:	eb db                	jmp    800681 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ab:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006af:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006b4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006ba:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006c1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006c5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006ca:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006cf:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006d2:	83 e8 23             	sub    $0x23,%eax
+  8006d5:	3c 57                	cmp    $0x57,%al
+  8006d7:	0f 87 51 06 00 00    	ja     800d2e <vprintfmt+0x6de>
+  8006dd:	0f b6 c0             	movzbl %al,%eax
+  8006e0:	48 b9 e0 3b 80 00 00 	movabs $0x803be0,%rcx
+  8006e7:	00 00 00 
+  8006ea:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006ed:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006f0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006f4:	eb cf                	jmp    8006c5 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006f6:	49 89 dc             	mov    %rbx,%r12
+  8006f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8006fe:	eb c5                	jmp    8006c5 <vprintfmt+0x75>
+            padc = ch;
+  800700:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800704:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800707:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80070a:	eb b9                	jmp    8006c5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80070c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070f:	83 f8 2f             	cmp    $0x2f,%eax
+  800712:	77 24                	ja     800738 <vprintfmt+0xe8>
+  800714:	89 c1                	mov    %eax,%ecx
+  800716:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80071a:	83 c0 08             	add    $0x8,%eax
+  80071d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800720:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800723:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800726:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80072a:	79 99                	jns    8006c5 <vprintfmt+0x75>
+                width = precision;
+  80072c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800730:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800736:	eb 8d                	jmp    8006c5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800738:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80073c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800740:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800744:	eb da                	jmp    800720 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800746:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80074b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80074f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800755:	3c 39                	cmp    $0x39,%al
+  800757:	77 1c                	ja     800775 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800759:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80075d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800761:	0f b6 c0             	movzbl %al,%eax
+  800764:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800769:	0f b6 03             	movzbl (%rbx),%eax
+  80076c:	3c 39                	cmp    $0x39,%al
+  80076e:	76 e9                	jbe    800759 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800770:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800773:	eb b1                	jmp    800726 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800775:	49 89 dc             	mov    %rbx,%r12
+  800778:	eb ac                	jmp    800726 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80077a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80077d:	85 c9                	test   %ecx,%ecx
+  80077f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800784:	0f 49 c1             	cmovns %ecx,%eax
+  800787:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80078a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80078d:	e9 33 ff ff ff       	jmp    8006c5 <vprintfmt+0x75>
+            lflag++;
+  800792:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800795:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800798:	e9 28 ff ff ff       	jmp    8006c5 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80079d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a3:	77 19                	ja     8007be <vprintfmt+0x16e>
+  8007a5:	89 c2                	mov    %eax,%edx
+  8007a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ab:	83 c0 08             	add    $0x8,%eax
+  8007ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b1:	8b 3a                	mov    (%rdx),%edi
+  8007b3:	4c 89 ee             	mov    %r13,%rsi
+  8007b6:	41 ff d6             	call   *%r14
+            break;
+  8007b9:	e9 c3 fe ff ff       	jmp    800681 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ca:	eb e5                	jmp    8007b1 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d2:	77 5a                	ja     80082e <vprintfmt+0x1de>
+  8007d4:	89 c2                	mov    %eax,%edx
+  8007d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007da:	83 c0 08             	add    $0x8,%eax
+  8007dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007e0:	8b 02                	mov    (%rdx),%eax
+  8007e2:	89 c1                	mov    %eax,%ecx
+  8007e4:	f7 d9                	neg    %ecx
+  8007e6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007e9:	83 f9 14             	cmp    $0x14,%ecx
+  8007ec:	7f 4e                	jg     80083c <vprintfmt+0x1ec>
+  8007ee:	48 63 c1             	movslq %ecx,%rax
+  8007f1:	48 ba a0 3e 80 00 00 	movabs $0x803ea0,%rdx
+  8007f8:	00 00 00 
+  8007fb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007ff:	48 85 c0             	test   %rax,%rax
+  800802:	74 38                	je     80083c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800804:	48 89 c1             	mov    %rax,%rcx
+  800807:	48 ba 79 40 80 00 00 	movabs $0x804079,%rdx
+  80080e:	00 00 00 
+  800811:	4c 89 ee             	mov    %r13,%rsi
+  800814:	4c 89 f7             	mov    %r14,%rdi
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	49 b8 13 06 80 00 00 	movabs $0x800613,%r8
+  800823:	00 00 00 
+  800826:	41 ff d0             	call   *%r8
+  800829:	e9 53 fe ff ff       	jmp    800681 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80082e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800832:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800836:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083a:	eb a4                	jmp    8007e0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80083c:	48 ba 5c 3a 80 00 00 	movabs $0x803a5c,%rdx
+  800843:	00 00 00 
+  800846:	4c 89 ee             	mov    %r13,%rsi
+  800849:	4c 89 f7             	mov    %r14,%rdi
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	49 b8 13 06 80 00 00 	movabs $0x800613,%r8
+  800858:	00 00 00 
+  80085b:	41 ff d0             	call   *%r8
+  80085e:	e9 1e fe ff ff       	jmp    800681 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800863:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800866:	83 f8 2f             	cmp    $0x2f,%eax
+  800869:	77 6c                	ja     8008d7 <vprintfmt+0x287>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800871:	83 c0 08             	add    $0x8,%eax
+  800874:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800877:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80087a:	48 85 d2             	test   %rdx,%rdx
+  80087d:	48 b8 55 3a 80 00 00 	movabs $0x803a55,%rax
+  800884:	00 00 00 
+  800887:	48 0f 45 c2          	cmovne %rdx,%rax
+  80088b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80088f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800893:	7e 06                	jle    80089b <vprintfmt+0x24b>
+  800895:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800899:	75 4a                	jne    8008e5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80089b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80089f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a3:	0f b6 00             	movzbl (%rax),%eax
+  8008a6:	84 c0                	test   %al,%al
+  8008a8:	0f 85 9a 00 00 00    	jne    800948 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008ae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008b5:	85 c0                	test   %eax,%eax
+  8008b7:	0f 8e c4 fd ff ff    	jle    800681 <vprintfmt+0x31>
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008c5:	41 ff d6             	call   *%r14
+  8008c8:	41 83 ec 01          	sub    $0x1,%r12d
+  8008cc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008d0:	75 eb                	jne    8008bd <vprintfmt+0x26d>
+  8008d2:	e9 aa fd ff ff       	jmp    800681 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e3:	eb 92                	jmp    800877 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008e5:	49 63 f7             	movslq %r15d,%rsi
+  8008e8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008ec:	48 b8 02 0e 80 00 00 	movabs $0x800e02,%rax
+  8008f3:	00 00 00 
+  8008f6:	ff d0                	call   *%rax
+  8008f8:	48 89 c2             	mov    %rax,%rdx
+  8008fb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008fe:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800900:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800903:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800906:	85 c0                	test   %eax,%eax
+  800908:	7e 91                	jle    80089b <vprintfmt+0x24b>
+  80090a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80090f:	4c 89 ee             	mov    %r13,%rsi
+  800912:	44 89 e7             	mov    %r12d,%edi
+  800915:	41 ff d6             	call   *%r14
+  800918:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80091c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80091f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800922:	75 eb                	jne    80090f <vprintfmt+0x2bf>
+  800924:	e9 72 ff ff ff       	jmp    80089b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800929:	0f b6 f8             	movzbl %al,%edi
+  80092c:	4c 89 ee             	mov    %r13,%rsi
+  80092f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800932:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800936:	49 83 c4 01          	add    $0x1,%r12
+  80093a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800940:	84 c0                	test   %al,%al
+  800942:	0f 84 66 ff ff ff    	je     8008ae <vprintfmt+0x25e>
+  800948:	45 85 ff             	test   %r15d,%r15d
+  80094b:	78 0a                	js     800957 <vprintfmt+0x307>
+  80094d:	41 83 ef 01          	sub    $0x1,%r15d
+  800951:	0f 88 57 ff ff ff    	js     8008ae <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800957:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80095b:	74 cc                	je     800929 <vprintfmt+0x2d9>
+  80095d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800960:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800965:	80 fa 5e             	cmp    $0x5e,%dl
+  800968:	77 c2                	ja     80092c <vprintfmt+0x2dc>
+  80096a:	eb bd                	jmp    800929 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80096c:	40 84 f6             	test   %sil,%sil
+  80096f:	75 26                	jne    800997 <vprintfmt+0x347>
+    switch (lflag) {
+  800971:	85 d2                	test   %edx,%edx
+  800973:	74 59                	je     8009ce <vprintfmt+0x37e>
+  800975:	83 fa 01             	cmp    $0x1,%edx
+  800978:	74 7b                	je     8009f5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	0f 87 96 00 00 00    	ja     800a1c <vprintfmt+0x3cc>
+  800986:	89 c2                	mov    %eax,%edx
+  800988:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098c:	83 c0 08             	add    $0x8,%eax
+  80098f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800992:	4c 8b 22             	mov    (%rdx),%r12
+  800995:	eb 17                	jmp    8009ae <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	77 21                	ja     8009c0 <vprintfmt+0x370>
+  80099f:	89 c2                	mov    %eax,%edx
+  8009a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a5:	83 c0 08             	add    $0x8,%eax
+  8009a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ab:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009ae:	4d 85 e4             	test   %r12,%r12
+  8009b1:	78 7a                	js     800a2d <vprintfmt+0x3dd>
+            num = i;
+  8009b3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009bb:	e9 50 02 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cc:	eb dd                	jmp    8009ab <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d4:	77 11                	ja     8009e7 <vprintfmt+0x397>
+  8009d6:	89 c2                	mov    %eax,%edx
+  8009d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dc:	83 c0 08             	add    $0x8,%eax
+  8009df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e2:	4c 63 22             	movslq (%rdx),%r12
+  8009e5:	eb c7                	jmp    8009ae <vprintfmt+0x35e>
+  8009e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f3:	eb ed                	jmp    8009e2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fb:	77 11                	ja     800a0e <vprintfmt+0x3be>
+  8009fd:	89 c2                	mov    %eax,%edx
+  8009ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a03:	83 c0 08             	add    $0x8,%eax
+  800a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a09:	4c 8b 22             	mov    (%rdx),%r12
+  800a0c:	eb a0                	jmp    8009ae <vprintfmt+0x35e>
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb ed                	jmp    800a09 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a28:	e9 65 ff ff ff       	jmp    800992 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a2d:	4c 89 ee             	mov    %r13,%rsi
+  800a30:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a35:	41 ff d6             	call   *%r14
+                i = -i;
+  800a38:	49 f7 dc             	neg    %r12
+  800a3b:	e9 73 ff ff ff       	jmp    8009b3 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a40:	40 84 f6             	test   %sil,%sil
+  800a43:	75 32                	jne    800a77 <vprintfmt+0x427>
+    switch (lflag) {
+  800a45:	85 d2                	test   %edx,%edx
+  800a47:	74 5d                	je     800aa6 <vprintfmt+0x456>
+  800a49:	83 fa 01             	cmp    $0x1,%edx
+  800a4c:	0f 84 82 00 00 00    	je     800ad4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	0f 87 a5 00 00 00    	ja     800b03 <vprintfmt+0x4b3>
+  800a5e:	89 c2                	mov    %eax,%edx
+  800a60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a64:	83 c0 08             	add    $0x8,%eax
+  800a67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a6d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a72:	e9 99 01 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7d:	77 19                	ja     800a98 <vprintfmt+0x448>
+  800a7f:	89 c2                	mov    %eax,%edx
+  800a81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a85:	83 c0 08             	add    $0x8,%eax
+  800a88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a8e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a93:	e9 78 01 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+  800a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	eb e5                	jmp    800a8b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800aa6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa9:	83 f8 2f             	cmp    $0x2f,%eax
+  800aac:	77 18                	ja     800ac6 <vprintfmt+0x476>
+  800aae:	89 c2                	mov    %eax,%edx
+  800ab0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab4:	83 c0 08             	add    $0x8,%eax
+  800ab7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aba:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800abc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ac1:	e9 4a 01 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+  800ac6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ace:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad2:	eb e6                	jmp    800aba <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ad4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad7:	83 f8 2f             	cmp    $0x2f,%eax
+  800ada:	77 19                	ja     800af5 <vprintfmt+0x4a5>
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae2:	83 c0 08             	add    $0x8,%eax
+  800ae5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aeb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800af0:	e9 1b 01 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+  800af5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b01:	eb e5                	jmp    800ae8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	e9 56 ff ff ff       	jmp    800a6a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b14:	40 84 f6             	test   %sil,%sil
+  800b17:	75 2e                	jne    800b47 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b19:	85 d2                	test   %edx,%edx
+  800b1b:	74 59                	je     800b76 <vprintfmt+0x526>
+  800b1d:	83 fa 01             	cmp    $0x1,%edx
+  800b20:	74 7f                	je     800ba1 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	0f 87 9f 00 00 00    	ja     800bcd <vprintfmt+0x57d>
+  800b2e:	89 c2                	mov    %eax,%edx
+  800b30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b34:	83 c0 08             	add    $0x8,%eax
+  800b37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b3d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b42:	e9 c9 00 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4d:	77 19                	ja     800b68 <vprintfmt+0x518>
+  800b4f:	89 c2                	mov    %eax,%edx
+  800b51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b55:	83 c0 08             	add    $0x8,%eax
+  800b58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b5e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b63:	e9 a8 00 00 00       	jmp    800c10 <vprintfmt+0x5c0>
+  800b68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b74:	eb e5                	jmp    800b5b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b79:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7c:	77 15                	ja     800b93 <vprintfmt+0x543>
+  800b7e:	89 c2                	mov    %eax,%edx
+  800b80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b84:	83 c0 08             	add    $0x8,%eax
+  800b87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b8c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b91:	eb 7d                	jmp    800c10 <vprintfmt+0x5c0>
+  800b93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9f:	eb e9                	jmp    800b8a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba7:	77 16                	ja     800bbf <vprintfmt+0x56f>
+  800ba9:	89 c2                	mov    %eax,%edx
+  800bab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800baf:	83 c0 08             	add    $0x8,%eax
+  800bb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bbd:	eb 51                	jmp    800c10 <vprintfmt+0x5c0>
+  800bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcb:	eb e8                	jmp    800bb5 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	e9 5c ff ff ff       	jmp    800b3a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bde:	4c 89 ee             	mov    %r13,%rsi
+  800be1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800be6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800be9:	4c 89 ee             	mov    %r13,%rsi
+  800bec:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bf1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfa:	77 47                	ja     800c43 <vprintfmt+0x5f3>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c02:	83 c0 08             	add    $0x8,%eax
+  800c05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c10:	48 83 ec 08          	sub    $0x8,%rsp
+  800c14:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c18:	0f 94 c0             	sete   %al
+  800c1b:	0f b6 c0             	movzbl %al,%eax
+  800c1e:	50                   	push   %rax
+  800c1f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c24:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c28:	4c 89 ee             	mov    %r13,%rsi
+  800c2b:	4c 89 f7             	mov    %r14,%rdi
+  800c2e:	48 b8 45 05 80 00 00 	movabs $0x800545,%rax
+  800c35:	00 00 00 
+  800c38:	ff d0                	call   *%rax
+            break;
+  800c3a:	48 83 c4 10          	add    $0x10,%rsp
+  800c3e:	e9 3e fa ff ff       	jmp    800681 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4f:	eb b7                	jmp    800c08 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c51:	40 84 f6             	test   %sil,%sil
+  800c54:	75 2b                	jne    800c81 <vprintfmt+0x631>
+    switch (lflag) {
+  800c56:	85 d2                	test   %edx,%edx
+  800c58:	74 56                	je     800cb0 <vprintfmt+0x660>
+  800c5a:	83 fa 01             	cmp    $0x1,%edx
+  800c5d:	74 7f                	je     800cde <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c62:	83 f8 2f             	cmp    $0x2f,%eax
+  800c65:	0f 87 a2 00 00 00    	ja     800d0d <vprintfmt+0x6bd>
+  800c6b:	89 c2                	mov    %eax,%edx
+  800c6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c71:	83 c0 08             	add    $0x8,%eax
+  800c74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c7a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c7f:	eb 8f                	jmp    800c10 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c84:	83 f8 2f             	cmp    $0x2f,%eax
+  800c87:	77 19                	ja     800ca2 <vprintfmt+0x652>
+  800c89:	89 c2                	mov    %eax,%edx
+  800c8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8f:	83 c0 08             	add    $0x8,%eax
+  800c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c98:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c9d:	e9 6e ff ff ff       	jmp    800c10 <vprintfmt+0x5c0>
+  800ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cae:	eb e5                	jmp    800c95 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cb0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb6:	77 18                	ja     800cd0 <vprintfmt+0x680>
+  800cb8:	89 c2                	mov    %eax,%edx
+  800cba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbe:	83 c0 08             	add    $0x8,%eax
+  800cc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ccb:	e9 40 ff ff ff       	jmp    800c10 <vprintfmt+0x5c0>
+  800cd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cdc:	eb e6                	jmp    800cc4 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce4:	77 19                	ja     800cff <vprintfmt+0x6af>
+  800ce6:	89 c2                	mov    %eax,%edx
+  800ce8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cec:	83 c0 08             	add    $0x8,%eax
+  800cef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cfa:	e9 11 ff ff ff       	jmp    800c10 <vprintfmt+0x5c0>
+  800cff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0b:	eb e5                	jmp    800cf2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d19:	e9 59 ff ff ff       	jmp    800c77 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d1e:	4c 89 ee             	mov    %r13,%rsi
+  800d21:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d26:	41 ff d6             	call   *%r14
+            break;
+  800d29:	e9 53 f9 ff ff       	jmp    800681 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d2e:	4c 89 ee             	mov    %r13,%rsi
+  800d31:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d36:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d39:	48 83 eb 01          	sub    $0x1,%rbx
+  800d3d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d41:	75 f6                	jne    800d39 <vprintfmt+0x6e9>
+  800d43:	e9 39 f9 ff ff       	jmp    800681 <vprintfmt+0x31>
+}
+  800d48:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d4c:	5b                   	pop    %rbx
+  800d4d:	41 5c                	pop    %r12
+  800d4f:	41 5d                	pop    %r13
+  800d51:	41 5e                	pop    %r14
+  800d53:	41 5f                	pop    %r15
+  800d55:	5d                   	pop    %rbp
+  800d56:	c3                   	ret
+
+0000000000800d57 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d57:	55                   	push   %rbp
+  800d58:	48 89 e5             	mov    %rsp,%rbp
+  800d5b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d63:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d6c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d73:	48 85 ff             	test   %rdi,%rdi
+  800d76:	74 2b                	je     800da3 <vsnprintf+0x4c>
+  800d78:	48 85 f6             	test   %rsi,%rsi
+  800d7b:	74 26                	je     800da3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d7d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d81:	48 bf fb 05 80 00 00 	movabs $0x8005fb,%rdi
+  800d88:	00 00 00 
+  800d8b:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  800d92:	00 00 00 
+  800d95:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d9b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d9e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800da1:	c9                   	leave
+  800da2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800da3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800da8:	eb f7                	jmp    800da1 <vsnprintf+0x4a>
+
+0000000000800daa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800daa:	55                   	push   %rbp
+  800dab:	48 89 e5             	mov    %rsp,%rbp
+  800dae:	48 83 ec 50          	sub    $0x50,%rsp
+  800db2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800db6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dba:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dbe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dc5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dcd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dd1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dd5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dd9:	48 b8 57 0d 80 00 00 	movabs $0x800d57,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800de5:	c9                   	leave
+  800de6:	c3                   	ret
+
+0000000000800de7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800de7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dea:	74 10                	je     800dfc <strlen+0x15>
+    size_t n = 0;
+  800dec:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800df1:	48 83 c0 01          	add    $0x1,%rax
+  800df5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800df9:	75 f6                	jne    800df1 <strlen+0xa>
+  800dfb:	c3                   	ret
+    size_t n = 0;
+  800dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e01:	c3                   	ret
+
+0000000000800e02 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e02:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e05:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e0a:	48 85 f6             	test   %rsi,%rsi
+  800e0d:	74 11                	je     800e20 <strnlen+0x1e>
+  800e0f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e13:	74 0c                	je     800e21 <strnlen+0x1f>
+  800e15:	48 83 c2 01          	add    $0x1,%rdx
+  800e19:	48 39 d0             	cmp    %rdx,%rax
+  800e1c:	75 f1                	jne    800e0f <strnlen+0xd>
+  800e1e:	eb 04                	jmp    800e24 <strnlen+0x22>
+  800e20:	c3                   	ret
+  800e21:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e24:	c3                   	ret
+
+0000000000800e25 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e25:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e31:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e34:	48 83 c2 01          	add    $0x1,%rdx
+  800e38:	84 c9                	test   %cl,%cl
+  800e3a:	75 f1                	jne    800e2d <strcpy+0x8>
+        ;
+    return res;
+}
+  800e3c:	c3                   	ret
+
+0000000000800e3d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e3d:	55                   	push   %rbp
+  800e3e:	48 89 e5             	mov    %rsp,%rbp
+  800e41:	41 54                	push   %r12
+  800e43:	53                   	push   %rbx
+  800e44:	48 89 fb             	mov    %rdi,%rbx
+  800e47:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e4a:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  800e51:	00 00 00 
+  800e54:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e56:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e5a:	4c 89 e6             	mov    %r12,%rsi
+  800e5d:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  800e64:	00 00 00 
+  800e67:	ff d0                	call   *%rax
+    return dst;
+}
+  800e69:	48 89 d8             	mov    %rbx,%rax
+  800e6c:	5b                   	pop    %rbx
+  800e6d:	41 5c                	pop    %r12
+  800e6f:	5d                   	pop    %rbp
+  800e70:	c3                   	ret
+
+0000000000800e71 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e71:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e74:	48 85 d2             	test   %rdx,%rdx
+  800e77:	74 1f                	je     800e98 <strncpy+0x27>
+  800e79:	48 01 fa             	add    %rdi,%rdx
+  800e7c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e7f:	48 83 c1 01          	add    $0x1,%rcx
+  800e83:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e87:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e8b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e8f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e93:	48 39 ca             	cmp    %rcx,%rdx
+  800e96:	75 e7                	jne    800e7f <strncpy+0xe>
+    }
+    return ret;
+}
+  800e98:	c3                   	ret
+
+0000000000800e99 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e99:	48 89 f8             	mov    %rdi,%rax
+  800e9c:	48 85 d2             	test   %rdx,%rdx
+  800e9f:	74 24                	je     800ec5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ea1:	48 83 ea 01          	sub    $0x1,%rdx
+  800ea5:	74 1b                	je     800ec2 <strlcpy+0x29>
+  800ea7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eab:	0f b6 16             	movzbl (%rsi),%edx
+  800eae:	84 d2                	test   %dl,%dl
+  800eb0:	74 10                	je     800ec2 <strlcpy+0x29>
+            *dst++ = *src++;
+  800eb2:	48 83 c6 01          	add    $0x1,%rsi
+  800eb6:	48 83 c0 01          	add    $0x1,%rax
+  800eba:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ebd:	48 39 c8             	cmp    %rcx,%rax
+  800ec0:	75 e9                	jne    800eab <strlcpy+0x12>
+        *dst = '\0';
+  800ec2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ec5:	48 29 f8             	sub    %rdi,%rax
+}
+  800ec8:	c3                   	ret
+
+0000000000800ec9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ec9:	0f b6 07             	movzbl (%rdi),%eax
+  800ecc:	84 c0                	test   %al,%al
+  800ece:	74 13                	je     800ee3 <strcmp+0x1a>
+  800ed0:	38 06                	cmp    %al,(%rsi)
+  800ed2:	75 0f                	jne    800ee3 <strcmp+0x1a>
+  800ed4:	48 83 c7 01          	add    $0x1,%rdi
+  800ed8:	48 83 c6 01          	add    $0x1,%rsi
+  800edc:	0f b6 07             	movzbl (%rdi),%eax
+  800edf:	84 c0                	test   %al,%al
+  800ee1:	75 ed                	jne    800ed0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ee3:	0f b6 c0             	movzbl %al,%eax
+  800ee6:	0f b6 16             	movzbl (%rsi),%edx
+  800ee9:	29 d0                	sub    %edx,%eax
+}
+  800eeb:	c3                   	ret
+
+0000000000800eec <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800eec:	48 85 d2             	test   %rdx,%rdx
+  800eef:	74 1f                	je     800f10 <strncmp+0x24>
+  800ef1:	0f b6 07             	movzbl (%rdi),%eax
+  800ef4:	84 c0                	test   %al,%al
+  800ef6:	74 1e                	je     800f16 <strncmp+0x2a>
+  800ef8:	3a 06                	cmp    (%rsi),%al
+  800efa:	75 1a                	jne    800f16 <strncmp+0x2a>
+  800efc:	48 83 c7 01          	add    $0x1,%rdi
+  800f00:	48 83 c6 01          	add    $0x1,%rsi
+  800f04:	48 83 ea 01          	sub    $0x1,%rdx
+  800f08:	75 e7                	jne    800ef1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0f:	c3                   	ret
+  800f10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f15:	c3                   	ret
+  800f16:	48 85 d2             	test   %rdx,%rdx
+  800f19:	74 09                	je     800f24 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f1b:	0f b6 07             	movzbl (%rdi),%eax
+  800f1e:	0f b6 16             	movzbl (%rsi),%edx
+  800f21:	29 d0                	sub    %edx,%eax
+  800f23:	c3                   	ret
+    if (!n) return 0;
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f2a:	0f b6 17             	movzbl (%rdi),%edx
+  800f2d:	84 d2                	test   %dl,%dl
+  800f2f:	74 18                	je     800f49 <strchr+0x1f>
+        if (*str == c) {
+  800f31:	0f be d2             	movsbl %dl,%edx
+  800f34:	39 f2                	cmp    %esi,%edx
+  800f36:	74 17                	je     800f4f <strchr+0x25>
+    for (; *str; str++) {
+  800f38:	48 83 c7 01          	add    $0x1,%rdi
+  800f3c:	0f b6 17             	movzbl (%rdi),%edx
+  800f3f:	84 d2                	test   %dl,%dl
+  800f41:	75 ee                	jne    800f31 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f48:	c3                   	ret
+  800f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4e:	c3                   	ret
+  800f4f:	48 89 f8             	mov    %rdi,%rax
+}
+  800f52:	c3                   	ret
+
+0000000000800f53 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f53:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f56:	0f b6 17             	movzbl (%rdi),%edx
+  800f59:	84 d2                	test   %dl,%dl
+  800f5b:	74 13                	je     800f70 <strfind+0x1d>
+  800f5d:	0f be d2             	movsbl %dl,%edx
+  800f60:	39 f2                	cmp    %esi,%edx
+  800f62:	74 0b                	je     800f6f <strfind+0x1c>
+  800f64:	48 83 c0 01          	add    $0x1,%rax
+  800f68:	0f b6 10             	movzbl (%rax),%edx
+  800f6b:	84 d2                	test   %dl,%dl
+  800f6d:	75 ee                	jne    800f5d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f6f:	c3                   	ret
+  800f70:	c3                   	ret
+
+0000000000800f71 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f71:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f74:	48 89 f8             	mov    %rdi,%rax
+  800f77:	48 f7 d8             	neg    %rax
+  800f7a:	83 e0 07             	and    $0x7,%eax
+  800f7d:	49 89 d1             	mov    %rdx,%r9
+  800f80:	49 29 c1             	sub    %rax,%r9
+  800f83:	78 36                	js     800fbb <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f85:	40 0f b6 c6          	movzbl %sil,%eax
+  800f89:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f90:	01 01 01 
+  800f93:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f97:	40 f6 c7 07          	test   $0x7,%dil
+  800f9b:	75 38                	jne    800fd5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f9d:	4c 89 c9             	mov    %r9,%rcx
+  800fa0:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fa4:	74 0c                	je     800fb2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fa6:	fc                   	cld
+  800fa7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800faa:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fae:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fb2:	4d 85 c9             	test   %r9,%r9
+  800fb5:	75 45                	jne    800ffc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fb7:	4c 89 c0             	mov    %r8,%rax
+  800fba:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fbb:	48 85 d2             	test   %rdx,%rdx
+  800fbe:	74 f7                	je     800fb7 <memset+0x46>
+  800fc0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fc3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fc6:	48 83 c0 01          	add    $0x1,%rax
+  800fca:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fce:	48 39 c2             	cmp    %rax,%rdx
+  800fd1:	75 f3                	jne    800fc6 <memset+0x55>
+  800fd3:	eb e2                	jmp    800fb7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fd5:	40 f6 c7 01          	test   $0x1,%dil
+  800fd9:	74 06                	je     800fe1 <memset+0x70>
+  800fdb:	88 07                	mov    %al,(%rdi)
+  800fdd:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fe1:	40 f6 c7 02          	test   $0x2,%dil
+  800fe5:	74 07                	je     800fee <memset+0x7d>
+  800fe7:	66 89 07             	mov    %ax,(%rdi)
+  800fea:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fee:	40 f6 c7 04          	test   $0x4,%dil
+  800ff2:	74 a9                	je     800f9d <memset+0x2c>
+  800ff4:	89 07                	mov    %eax,(%rdi)
+  800ff6:	48 83 c7 04          	add    $0x4,%rdi
+  800ffa:	eb a1                	jmp    800f9d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffc:	41 f6 c1 04          	test   $0x4,%r9b
+  801000:	74 06                	je     801008 <memset+0x97>
+  801002:	89 07                	mov    %eax,(%rdi)
+  801004:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801008:	41 f6 c1 02          	test   $0x2,%r9b
+  80100c:	74 07                	je     801015 <memset+0xa4>
+  80100e:	66 89 07             	mov    %ax,(%rdi)
+  801011:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801015:	41 f6 c1 01          	test   $0x1,%r9b
+  801019:	74 9c                	je     800fb7 <memset+0x46>
+  80101b:	88 07                	mov    %al,(%rdi)
+  80101d:	eb 98                	jmp    800fb7 <memset+0x46>
+
+000000000080101f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80101f:	48 89 f8             	mov    %rdi,%rax
+  801022:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801025:	48 39 fe             	cmp    %rdi,%rsi
+  801028:	73 3b                	jae    801065 <memmove+0x46>
+  80102a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80102e:	48 39 d7             	cmp    %rdx,%rdi
+  801031:	73 32                	jae    801065 <memmove+0x46>
+        s += n;
+        d += n;
+  801033:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801037:	48 89 d6             	mov    %rdx,%rsi
+  80103a:	48 09 fe             	or     %rdi,%rsi
+  80103d:	48 09 ce             	or     %rcx,%rsi
+  801040:	40 f6 c6 07          	test   $0x7,%sil
+  801044:	75 12                	jne    801058 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801046:	48 83 ef 08          	sub    $0x8,%rdi
+  80104a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80104e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801052:	fd                   	std
+  801053:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801056:	fc                   	cld
+  801057:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801058:	48 83 ef 01          	sub    $0x1,%rdi
+  80105c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801060:	fd                   	std
+  801061:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801063:	eb f1                	jmp    801056 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801065:	48 89 f2             	mov    %rsi,%rdx
+  801068:	48 09 c2             	or     %rax,%rdx
+  80106b:	48 09 ca             	or     %rcx,%rdx
+  80106e:	f6 c2 07             	test   $0x7,%dl
+  801071:	75 0c                	jne    80107f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801073:	48 c1 e9 03          	shr    $0x3,%rcx
+  801077:	48 89 c7             	mov    %rax,%rdi
+  80107a:	fc                   	cld
+  80107b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80107e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80107f:	48 89 c7             	mov    %rax,%rdi
+  801082:	fc                   	cld
+  801083:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801085:	c3                   	ret
+
+0000000000801086 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801086:	55                   	push   %rbp
+  801087:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80108a:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  801091:	00 00 00 
+  801094:	ff d0                	call   *%rax
+}
+  801096:	5d                   	pop    %rbp
+  801097:	c3                   	ret
+
+0000000000801098 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	41 57                	push   %r15
+  80109e:	41 56                	push   %r14
+  8010a0:	41 55                	push   %r13
+  8010a2:	41 54                	push   %r12
+  8010a4:	53                   	push   %rbx
+  8010a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a9:	49 89 fe             	mov    %rdi,%r14
+  8010ac:	49 89 f7             	mov    %rsi,%r15
+  8010af:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010b2:	48 89 f7             	mov    %rsi,%rdi
+  8010b5:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8010bc:	00 00 00 
+  8010bf:	ff d0                	call   *%rax
+  8010c1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010c4:	48 89 de             	mov    %rbx,%rsi
+  8010c7:	4c 89 f7             	mov    %r14,%rdi
+  8010ca:	48 b8 02 0e 80 00 00 	movabs $0x800e02,%rax
+  8010d1:	00 00 00 
+  8010d4:	ff d0                	call   *%rax
+  8010d6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010d9:	48 39 c3             	cmp    %rax,%rbx
+  8010dc:	74 36                	je     801114 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010de:	48 89 d8             	mov    %rbx,%rax
+  8010e1:	4c 29 e8             	sub    %r13,%rax
+  8010e4:	49 39 c4             	cmp    %rax,%r12
+  8010e7:	73 31                	jae    80111a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010e9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010ee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f2:	4c 89 fe             	mov    %r15,%rsi
+  8010f5:	48 b8 86 10 80 00 00 	movabs $0x801086,%rax
+  8010fc:	00 00 00 
+  8010ff:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801101:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801105:	48 83 c4 08          	add    $0x8,%rsp
+  801109:	5b                   	pop    %rbx
+  80110a:	41 5c                	pop    %r12
+  80110c:	41 5d                	pop    %r13
+  80110e:	41 5e                	pop    %r14
+  801110:	41 5f                	pop    %r15
+  801112:	5d                   	pop    %rbp
+  801113:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801114:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801118:	eb eb                	jmp    801105 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80111a:	48 83 eb 01          	sub    $0x1,%rbx
+  80111e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801122:	48 89 da             	mov    %rbx,%rdx
+  801125:	4c 89 fe             	mov    %r15,%rsi
+  801128:	48 b8 86 10 80 00 00 	movabs $0x801086,%rax
+  80112f:	00 00 00 
+  801132:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801134:	49 01 de             	add    %rbx,%r14
+  801137:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80113c:	eb c3                	jmp    801101 <strlcat+0x69>
+
+000000000080113e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80113e:	48 85 d2             	test   %rdx,%rdx
+  801141:	74 2d                	je     801170 <memcmp+0x32>
+  801143:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801148:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80114c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801151:	44 38 c1             	cmp    %r8b,%cl
+  801154:	75 0f                	jne    801165 <memcmp+0x27>
+    while (n-- > 0) {
+  801156:	48 83 c0 01          	add    $0x1,%rax
+  80115a:	48 39 c2             	cmp    %rax,%rdx
+  80115d:	75 e9                	jne    801148 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80115f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801164:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801165:	0f b6 c1             	movzbl %cl,%eax
+  801168:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80116c:	44 29 c0             	sub    %r8d,%eax
+  80116f:	c3                   	ret
+    return 0;
+  801170:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801175:	c3                   	ret
+
+0000000000801176 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801176:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80117a:	48 39 c7             	cmp    %rax,%rdi
+  80117d:	73 0f                	jae    80118e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80117f:	40 38 37             	cmp    %sil,(%rdi)
+  801182:	74 0e                	je     801192 <memfind+0x1c>
+    for (; src < end; src++) {
+  801184:	48 83 c7 01          	add    $0x1,%rdi
+  801188:	48 39 f8             	cmp    %rdi,%rax
+  80118b:	75 f2                	jne    80117f <memfind+0x9>
+  80118d:	c3                   	ret
+  80118e:	48 89 f8             	mov    %rdi,%rax
+  801191:	c3                   	ret
+  801192:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801195:	c3                   	ret
+
+0000000000801196 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801196:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801199:	0f b6 37             	movzbl (%rdi),%esi
+  80119c:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a0:	74 06                	je     8011a8 <strtol+0x12>
+  8011a2:	40 80 fe 09          	cmp    $0x9,%sil
+  8011a6:	75 13                	jne    8011bb <strtol+0x25>
+  8011a8:	48 83 c7 01          	add    $0x1,%rdi
+  8011ac:	0f b6 37             	movzbl (%rdi),%esi
+  8011af:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b3:	74 f3                	je     8011a8 <strtol+0x12>
+  8011b5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b9:	74 ed                	je     8011a8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011bb:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011be:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011c1:	3c 01                	cmp    $0x1,%al
+  8011c3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011c7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011cd:	75 0f                	jne    8011de <strtol+0x48>
+  8011cf:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011d2:	74 14                	je     8011e8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011d4:	85 d2                	test   %edx,%edx
+  8011d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011db:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011e3:	4c 63 ca             	movslq %edx,%r9
+  8011e6:	eb 36                	jmp    80121e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011e8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011ec:	74 0f                	je     8011fd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011ee:	85 d2                	test   %edx,%edx
+  8011f0:	75 ec                	jne    8011de <strtol+0x48>
+        s++;
+  8011f2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011f6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011fb:	eb e1                	jmp    8011de <strtol+0x48>
+        s += 2;
+  8011fd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801201:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801206:	eb d6                	jmp    8011de <strtol+0x48>
+            dig -= '0';
+  801208:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80120b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80120f:	41 39 d0             	cmp    %edx,%r8d
+  801212:	7d 21                	jge    801235 <strtol+0x9f>
+        val = val * base + dig;
+  801214:	49 0f af c1          	imul   %r9,%rax
+  801218:	0f b6 c9             	movzbl %cl,%ecx
+  80121b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80121e:	48 83 c7 01          	add    $0x1,%rdi
+  801222:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801226:	80 f9 39             	cmp    $0x39,%cl
+  801229:	76 dd                	jbe    801208 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80122b:	80 f9 7b             	cmp    $0x7b,%cl
+  80122e:	77 05                	ja     801235 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801230:	83 e9 57             	sub    $0x57,%ecx
+  801233:	eb d6                	jmp    80120b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801235:	4d 85 d2             	test   %r10,%r10
+  801238:	74 03                	je     80123d <strtol+0xa7>
+  80123a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80123d:	48 89 c2             	mov    %rax,%rdx
+  801240:	48 f7 da             	neg    %rdx
+  801243:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801247:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80124b:	c3                   	ret
+
+000000000080124c <strrev>:
+
+void
+strrev(char *str)
+{
+  80124c:	55                   	push   %rbp
+  80124d:	48 89 e5             	mov    %rsp,%rbp
+  801250:	53                   	push   %rbx
+  801251:	48 83 ec 08          	sub    $0x8,%rsp
+  801255:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  801258:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801264:	83 e8 01             	sub    $0x1,%eax
+  801267:	85 c0                	test   %eax,%eax
+  801269:	7e 22                	jle    80128d <strrev+0x41>
+  80126b:	48 98                	cltq
+  80126d:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  801272:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  801276:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  80127a:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  80127e:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  801281:	48 83 c2 01          	add    $0x1,%rdx
+  801285:	48 83 e8 01          	sub    $0x1,%rax
+  801289:	39 c2                	cmp    %eax,%edx
+  80128b:	7c e5                	jl     801272 <strrev+0x26>
+	}
+}
+  80128d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801291:	c9                   	leave
+  801292:	c3                   	ret
+
+0000000000801293 <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  801293:	85 d2                	test   %edx,%edx
+  801295:	0f 84 80 00 00 00    	je     80131b <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  80129b:	55                   	push   %rbp
+  80129c:	48 89 e5             	mov    %rsp,%rbp
+  80129f:	53                   	push   %rbx
+  8012a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a4:	49 89 f2             	mov    %rsi,%r10
+  8012a7:	41 89 d3             	mov    %edx,%r11d
+  8012aa:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  8012ad:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  8012b2:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  8012b5:	eb 20                	jmp    8012d7 <itoa+0x44>
+			str[i++] = '0' + digit;
+  8012b7:	41 89 f1             	mov    %esi,%r9d
+  8012ba:	83 c2 30             	add    $0x30,%edx
+  8012bd:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  8012c0:	89 f8                	mov    %edi,%eax
+  8012c2:	99                   	cltd
+  8012c3:	f7 f9                	idiv   %ecx
+  8012c5:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	74 2e                	je     8012f9 <itoa+0x66>
+  8012cb:	83 c6 01             	add    $0x1,%esi
+  8012ce:	49 83 c0 01          	add    $0x1,%r8
+  8012d2:	44 39 cb             	cmp    %r9d,%ebx
+  8012d5:	7e 15                	jle    8012ec <itoa+0x59>
+		digit = sum % base;
+  8012d7:	89 f8                	mov    %edi,%eax
+  8012d9:	99                   	cltd
+  8012da:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  8012dc:	83 fa 09             	cmp    $0x9,%edx
+  8012df:	7e d6                	jle    8012b7 <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  8012e1:	41 89 f1             	mov    %esi,%r9d
+  8012e4:	83 c2 37             	add    $0x37,%edx
+  8012e7:	41 88 10             	mov    %dl,(%r8)
+  8012ea:	eb d4                	jmp    8012c0 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  8012ec:	41 83 eb 01          	sub    $0x1,%r11d
+  8012f0:	45 39 cb             	cmp    %r9d,%r11d
+  8012f3:	75 04                	jne    8012f9 <itoa+0x66>
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	75 28                	jne    801321 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  8012f9:	4d 63 c9             	movslq %r9d,%r9
+  8012fc:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801301:	4c 89 d7             	mov    %r10,%rdi
+  801304:	48 b8 4c 12 80 00 00 	movabs $0x80124c,%rax
+  80130b:	00 00 00 
+  80130e:	ff d0                	call   *%rax
+	return 0;
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+		return -1;
+  80131b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801320:	c3                   	ret
+		return -1;
+  801321:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801326:	eb ed                	jmp    801315 <itoa+0x82>
+
+0000000000801328 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	53                   	push   %rbx
+  80132d:	48 89 fa             	mov    %rdi,%rdx
+  801330:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801333:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801338:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801342:	be 00 00 00 00       	mov    $0x0,%esi
+  801347:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80134f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801353:	c9                   	leave
+  801354:	c3                   	ret
+
+0000000000801355 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801355:	55                   	push   %rbp
+  801356:	48 89 e5             	mov    %rsp,%rbp
+  801359:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80135a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801364:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801373:	be 00 00 00 00       	mov    $0x0,%esi
+  801378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801380:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801384:	c9                   	leave
+  801385:	c3                   	ret
+
+0000000000801386 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801386:	55                   	push   %rbp
+  801387:	48 89 e5             	mov    %rsp,%rbp
+  80138a:	53                   	push   %rbx
+  80138b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80138f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801392:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801397:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b3:	48 85 c0             	test   %rax,%rax
+  8013b6:	7f 06                	jg     8013be <sys_env_destroy+0x38>
+}
+  8013b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bc:	c9                   	leave
+  8013bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013be:	49 89 c0             	mov    %rax,%r8
+  8013c1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013c6:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  8013cd:	00 00 00 
+  8013d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d5:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  8013dc:	00 00 00 
+  8013df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e4:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  8013eb:	00 00 00 
+  8013ee:	41 ff d1             	call   *%r9
+
+00000000008013f1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013f1:	55                   	push   %rbp
+  8013f2:	48 89 e5             	mov    %rsp,%rbp
+  8013f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801400:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801405:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140f:	be 00 00 00 00       	mov    $0x0,%esi
+  801414:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80141c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801420:	c9                   	leave
+  801421:	c3                   	ret
+
+0000000000801422 <sys_yield>:
+
+void
+sys_yield(void) {
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+  801426:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801427:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801431:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801440:	be 00 00 00 00       	mov    $0x0,%esi
+  801445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801451:	c9                   	leave
+  801452:	c3                   	ret
+
+0000000000801453 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801453:	55                   	push   %rbp
+  801454:	48 89 e5             	mov    %rsp,%rbp
+  801457:	53                   	push   %rbx
+  801458:	48 89 fa             	mov    %rdi,%rdx
+  80145b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80145e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801463:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80146a:	00 00 00 
+  80146d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801472:	be 00 00 00 00       	mov    $0x0,%esi
+  801477:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80147f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801483:	c9                   	leave
+  801484:	c3                   	ret
+
+0000000000801485 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801485:	55                   	push   %rbp
+  801486:	48 89 e5             	mov    %rsp,%rbp
+  801489:	53                   	push   %rbx
+  80148a:	49 89 f8             	mov    %rdi,%r8
+  80148d:	48 89 d3             	mov    %rdx,%rbx
+  801490:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801493:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801498:	4c 89 c2             	mov    %r8,%rdx
+  80149b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+
+00000000008014b1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014b1:	55                   	push   %rbp
+  8014b2:	48 89 e5             	mov    %rsp,%rbp
+  8014b5:	53                   	push   %rbx
+  8014b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ba:	89 f8                	mov    %edi,%eax
+  8014bc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014bf:	48 63 f9             	movslq %ecx,%rdi
+  8014c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ca:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014da:	48 85 c0             	test   %rax,%rax
+  8014dd:	7f 06                	jg     8014e5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e5:	49 89 c0             	mov    %rax,%r8
+  8014e8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014ed:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  8014f4:	00 00 00 
+  8014f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fc:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  801503:	00 00 00 
+  801506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150b:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  801512:	00 00 00 
+  801515:	41 ff d1             	call   *%r9
+
+0000000000801518 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801518:	55                   	push   %rbp
+  801519:	48 89 e5             	mov    %rsp,%rbp
+  80151c:	53                   	push   %rbx
+  80151d:	48 83 ec 08          	sub    $0x8,%rsp
+  801521:	89 f8                	mov    %edi,%eax
+  801523:	49 89 f2             	mov    %rsi,%r10
+  801526:	48 89 cf             	mov    %rcx,%rdi
+  801529:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80152c:	48 63 da             	movslq %edx,%rbx
+  80152f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801532:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801537:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 06                	jg     80154a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154a:	49 89 c0             	mov    %rax,%r8
+  80154d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801552:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  801559:	00 00 00 
+  80155c:	be 26 00 00 00       	mov    $0x26,%esi
+  801561:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  801577:	00 00 00 
+  80157a:	41 ff d1             	call   *%r9
+
+000000000080157d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	53                   	push   %rbx
+  801582:	48 83 ec 08          	sub    $0x8,%rsp
+  801586:	48 89 f1             	mov    %rsi,%rcx
+  801589:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80158c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a6:	48 85 c0             	test   %rax,%rax
+  8015a9:	7f 06                	jg     8015b1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b1:	49 89 c0             	mov    %rax,%r8
+  8015b4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b9:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  8015c0:	00 00 00 
+  8015c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c8:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  8015cf:	00 00 00 
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  8015de:	00 00 00 
+  8015e1:	41 ff d1             	call   *%r9
+
+00000000008015e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ed:	48 63 ce             	movslq %esi,%rcx
+  8015f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	7f 06                	jg     80161a <sys_env_set_status+0x36>
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161a:	49 89 c0             	mov    %rax,%r8
+  80161d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801622:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  801629:	00 00 00 
+  80162c:	be 26 00 00 00       	mov    $0x26,%esi
+  801631:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  801638:	00 00 00 
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  801647:	00 00 00 
+  80164a:	41 ff d1             	call   *%r9
+
+000000000080164d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+  801652:	48 83 ec 08          	sub    $0x8,%rsp
+  801656:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801659:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166b:	be 00 00 00 00       	mov    $0x0,%esi
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801676:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801678:	48 85 c0             	test   %rax,%rax
+  80167b:	7f 06                	jg     801683 <sys_env_set_trapframe+0x36>
+}
+  80167d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801683:	49 89 c0             	mov    %rax,%r8
+  801686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80168b:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  801692:	00 00 00 
+  801695:	be 26 00 00 00       	mov    $0x26,%esi
+  80169a:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  8016a1:	00 00 00 
+  8016a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a9:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  8016b0:	00 00 00 
+  8016b3:	41 ff d1             	call   *%r9
+
+00000000008016b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	53                   	push   %rbx
+  8016bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e1:	48 85 c0             	test   %rax,%rax
+  8016e4:	7f 06                	jg     8016ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8016e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ec:	49 89 c0             	mov    %rax,%r8
+  8016ef:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016f4:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  8016fb:	00 00 00 
+  8016fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801703:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  80170a:	00 00 00 
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  801719:	00 00 00 
+  80171c:	41 ff d1             	call   *%r9
+
+000000000080171f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80171f:	55                   	push   %rbp
+  801720:	48 89 e5             	mov    %rsp,%rbp
+  801723:	53                   	push   %rbx
+  801724:	89 f8                	mov    %edi,%eax
+  801726:	49 89 f1             	mov    %rsi,%r9
+  801729:	48 89 d3             	mov    %rdx,%rbx
+  80172c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80172f:	49 63 f0             	movslq %r8d,%rsi
+  801732:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801735:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80173a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801743:	cd 30                	int    $0x30
+}
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+000000000080174b <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+  80174f:	53                   	push   %rbx
+  801750:	48 83 ec 08          	sub    $0x8,%rsp
+  801754:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  801757:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80175a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801762:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801767:	be 00 00 00 00       	mov    $0x0,%esi
+  80176c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801772:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801774:	48 85 c0             	test   %rax,%rax
+  801777:	7f 06                	jg     80177f <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801779:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177f:	49 89 c0             	mov    %rax,%r8
+  801782:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801787:	48 ba 68 3f 80 00 00 	movabs $0x803f68,%rdx
+  80178e:	00 00 00 
+  801791:	be 26 00 00 00       	mov    $0x26,%esi
+  801796:	48 bf 87 3f 80 00 00 	movabs $0x803f87,%rdi
+  80179d:	00 00 00 
+  8017a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a5:	49 b9 44 37 80 00 00 	movabs $0x803744,%r9
+  8017ac:	00 00 00 
+  8017af:	41 ff d1             	call   *%r9
+
+00000000008017b2 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8017b2:	55                   	push   %rbp
+  8017b3:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  8017b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bb:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  8017c2:	00 00 00 
+  8017c5:	ff d0                	call   *%rax
+}
+  8017c7:	5d                   	pop    %rbp
+  8017c8:	c3                   	ret
+
+00000000008017c9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017c9:	55                   	push   %rbp
+  8017ca:	48 89 e5             	mov    %rsp,%rbp
+  8017cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ce:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+00000000008017fa <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  8017fa:	55                   	push   %rbp
+  8017fb:	48 89 e5             	mov    %rsp,%rbp
+  8017fe:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  8017ff:	48 63 ce             	movslq %esi,%rcx
+  801802:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  801806:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801810:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801815:	be 00 00 00 00       	mov    $0x0,%esi
+  80181a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801820:	cd 30                	int    $0x30
+}
+  801822:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+0000000000801828 <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	53                   	push   %rbx
+  80182d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801830:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801834:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801839:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801843:	be 00 00 00 00       	mov    $0x0,%esi
+  801848:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184e:	cd 30                	int    $0x30
+}
+  801850:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+
+0000000000801856 <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+  80185a:	53                   	push   %rbx
+  80185b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  80185e:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801861:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801866:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801869:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186e:	be 00 00 00 00       	mov    $0x0,%esi
+  801873:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801879:	cd 30                	int    $0x30
+}
+  80187b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187f:	c9                   	leave
+  801880:	c3                   	ret
+
+0000000000801881 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801881:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801888:	ff ff ff 
+  80188b:	48 01 f8             	add    %rdi,%rax
+  80188e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801892:	c3                   	ret
+
+0000000000801893 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801893:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80189a:	ff ff ff 
+  80189d:	48 01 f8             	add    %rdi,%rax
+  8018a0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018a4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018aa:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018ae:	c3                   	ret
+
+00000000008018af <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018af:	55                   	push   %rbp
+  8018b0:	48 89 e5             	mov    %rsp,%rbp
+  8018b3:	41 57                	push   %r15
+  8018b5:	41 56                	push   %r14
+  8018b7:	41 55                	push   %r13
+  8018b9:	41 54                	push   %r12
+  8018bb:	53                   	push   %rbx
+  8018bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c0:	49 89 ff             	mov    %rdi,%r15
+  8018c3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018c8:	49 bd ce 33 80 00 00 	movabs $0x8033ce,%r13
+  8018cf:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018d2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018d8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018db:	48 89 df             	mov    %rbx,%rdi
+  8018de:	41 ff d5             	call   *%r13
+  8018e1:	83 e0 04             	and    $0x4,%eax
+  8018e4:	74 17                	je     8018fd <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018e6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018ed:	4c 39 f3             	cmp    %r14,%rbx
+  8018f0:	75 e6                	jne    8018d8 <fd_alloc+0x29>
+  8018f2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018f8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018fd:	4d 89 27             	mov    %r12,(%r15)
+}
+  801900:	48 83 c4 08          	add    $0x8,%rsp
+  801904:	5b                   	pop    %rbx
+  801905:	41 5c                	pop    %r12
+  801907:	41 5d                	pop    %r13
+  801909:	41 5e                	pop    %r14
+  80190b:	41 5f                	pop    %r15
+  80190d:	5d                   	pop    %rbp
+  80190e:	c3                   	ret
+
+000000000080190f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80190f:	83 ff 1f             	cmp    $0x1f,%edi
+  801912:	77 39                	ja     80194d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	41 54                	push   %r12
+  80191a:	53                   	push   %rbx
+  80191b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80191e:	48 63 df             	movslq %edi,%rbx
+  801921:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801928:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80192c:	48 89 df             	mov    %rbx,%rdi
+  80192f:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+  80193b:	a8 04                	test   $0x4,%al
+  80193d:	74 14                	je     801953 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80193f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801943:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801948:	5b                   	pop    %rbx
+  801949:	41 5c                	pop    %r12
+  80194b:	5d                   	pop    %rbp
+  80194c:	c3                   	ret
+        return -E_INVAL;
+  80194d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801952:	c3                   	ret
+        return -E_INVAL;
+  801953:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801958:	eb ee                	jmp    801948 <fd_lookup+0x39>
+
+000000000080195a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80195a:	55                   	push   %rbp
+  80195b:	48 89 e5             	mov    %rsp,%rbp
+  80195e:	41 54                	push   %r12
+  801960:	53                   	push   %rbx
+  801961:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801964:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  80196b:	00 00 00 
+  80196e:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801975:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801978:	39 3b                	cmp    %edi,(%rbx)
+  80197a:	74 47                	je     8019c3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80197c:	48 83 c0 08          	add    $0x8,%rax
+  801980:	48 8b 18             	mov    (%rax),%rbx
+  801983:	48 85 db             	test   %rbx,%rbx
+  801986:	75 f0                	jne    801978 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801988:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80198f:	00 00 00 
+  801992:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801998:	89 fa                	mov    %edi,%edx
+  80199a:	48 bf 98 3f 80 00 00 	movabs $0x803f98,%rdi
+  8019a1:	00 00 00 
+  8019a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a9:	48 b9 00 05 80 00 00 	movabs $0x800500,%rcx
+  8019b0:	00 00 00 
+  8019b3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019ba:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019be:	5b                   	pop    %rbx
+  8019bf:	41 5c                	pop    %r12
+  8019c1:	5d                   	pop    %rbp
+  8019c2:	c3                   	ret
+            return 0;
+  8019c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c8:	eb f0                	jmp    8019ba <dev_lookup+0x60>
+
+00000000008019ca <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019ca:	55                   	push   %rbp
+  8019cb:	48 89 e5             	mov    %rsp,%rbp
+  8019ce:	41 55                	push   %r13
+  8019d0:	41 54                	push   %r12
+  8019d2:	53                   	push   %rbx
+  8019d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8019d7:	48 89 fb             	mov    %rdi,%rbx
+  8019da:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019dd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019e4:	ff ff ff 
+  8019e7:	48 01 df             	add    %rbx,%rdi
+  8019ea:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019ee:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019f2:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  8019f9:	00 00 00 
+  8019fc:	ff d0                	call   *%rax
+  8019fe:	41 89 c5             	mov    %eax,%r13d
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 06                	js     801a0b <fd_close+0x41>
+  801a05:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a09:	74 1a                	je     801a25 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a0b:	45 84 e4             	test   %r12b,%r12b
+  801a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a13:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a17:	44 89 e8             	mov    %r13d,%eax
+  801a1a:	48 83 c4 18          	add    $0x18,%rsp
+  801a1e:	5b                   	pop    %rbx
+  801a1f:	41 5c                	pop    %r12
+  801a21:	41 5d                	pop    %r13
+  801a23:	5d                   	pop    %rbp
+  801a24:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a25:	8b 3b                	mov    (%rbx),%edi
+  801a27:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a2b:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801a32:	00 00 00 
+  801a35:	ff d0                	call   *%rax
+  801a37:	41 89 c5             	mov    %eax,%r13d
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	78 1b                	js     801a59 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a42:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801a46:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a4c:	48 85 c0             	test   %rax,%rax
+  801a4f:	74 08                	je     801a59 <fd_close+0x8f>
+  801a51:	48 89 df             	mov    %rbx,%rdi
+  801a54:	ff d0                	call   *%rax
+  801a56:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a5e:	48 89 de             	mov    %rbx,%rsi
+  801a61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a66:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  801a6d:	00 00 00 
+  801a70:	ff d0                	call   *%rax
+    return res;
+  801a72:	eb a3                	jmp    801a17 <fd_close+0x4d>
+
+0000000000801a74 <close>:
+
+int
+close(int fdnum) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a7c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a80:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801a87:	00 00 00 
+  801a8a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 15                	js     801aa5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a90:	be 01 00 00 00       	mov    $0x1,%esi
+  801a95:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a99:	48 b8 ca 19 80 00 00 	movabs $0x8019ca,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+}
+  801aa5:	c9                   	leave
+  801aa6:	c3                   	ret
+
+0000000000801aa7 <close_all>:
+
+void
+close_all(void) {
+  801aa7:	55                   	push   %rbp
+  801aa8:	48 89 e5             	mov    %rsp,%rbp
+  801aab:	41 54                	push   %r12
+  801aad:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801aae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab3:	49 bc 74 1a 80 00 00 	movabs $0x801a74,%r12
+  801aba:	00 00 00 
+  801abd:	89 df                	mov    %ebx,%edi
+  801abf:	41 ff d4             	call   *%r12
+  801ac2:	83 c3 01             	add    $0x1,%ebx
+  801ac5:	83 fb 20             	cmp    $0x20,%ebx
+  801ac8:	75 f3                	jne    801abd <close_all+0x16>
+}
+  801aca:	5b                   	pop    %rbx
+  801acb:	41 5c                	pop    %r12
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+
+0000000000801acf <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801acf:	55                   	push   %rbp
+  801ad0:	48 89 e5             	mov    %rsp,%rbp
+  801ad3:	41 57                	push   %r15
+  801ad5:	41 56                	push   %r14
+  801ad7:	41 55                	push   %r13
+  801ad9:	41 54                	push   %r12
+  801adb:	53                   	push   %rbx
+  801adc:	48 83 ec 18          	sub    $0x18,%rsp
+  801ae0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ae3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ae7:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801aee:	00 00 00 
+  801af1:	ff d0                	call   *%rax
+  801af3:	89 c3                	mov    %eax,%ebx
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	0f 88 b8 00 00 00    	js     801bb5 <dup+0xe6>
+    close(newfdnum);
+  801afd:	44 89 e7             	mov    %r12d,%edi
+  801b00:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b0c:	4d 63 ec             	movslq %r12d,%r13
+  801b0f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b16:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b1a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b1e:	4c 89 ff             	mov    %r15,%rdi
+  801b21:	49 be 93 18 80 00 00 	movabs $0x801893,%r14
+  801b28:	00 00 00 
+  801b2b:	41 ff d6             	call   *%r14
+  801b2e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b31:	4c 89 ef             	mov    %r13,%rdi
+  801b34:	41 ff d6             	call   *%r14
+  801b37:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b3a:	48 89 df             	mov    %rbx,%rdi
+  801b3d:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b49:	a8 04                	test   $0x4,%al
+  801b4b:	74 2b                	je     801b78 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b4d:	41 89 c1             	mov    %eax,%r9d
+  801b50:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b56:	4c 89 f1             	mov    %r14,%rcx
+  801b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5e:	48 89 de             	mov    %rbx,%rsi
+  801b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b66:	48 b8 18 15 80 00 00 	movabs $0x801518,%rax
+  801b6d:	00 00 00 
+  801b70:	ff d0                	call   *%rax
+  801b72:	89 c3                	mov    %eax,%ebx
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 4e                	js     801bc6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b78:	4c 89 ff             	mov    %r15,%rdi
+  801b7b:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+  801b87:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b8a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b90:	4c 89 e9             	mov    %r13,%rcx
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	4c 89 fe             	mov    %r15,%rsi
+  801b9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba0:	48 b8 18 15 80 00 00 	movabs $0x801518,%rax
+  801ba7:	00 00 00 
+  801baa:	ff d0                	call   *%rax
+  801bac:	89 c3                	mov    %eax,%ebx
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 14                	js     801bc6 <dup+0xf7>
+
+    return newfdnum;
+  801bb2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801bb5:	89 d8                	mov    %ebx,%eax
+  801bb7:	48 83 c4 18          	add    $0x18,%rsp
+  801bbb:	5b                   	pop    %rbx
+  801bbc:	41 5c                	pop    %r12
+  801bbe:	41 5d                	pop    %r13
+  801bc0:	41 5e                	pop    %r14
+  801bc2:	41 5f                	pop    %r15
+  801bc4:	5d                   	pop    %rbp
+  801bc5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bcb:	4c 89 ee             	mov    %r13,%rsi
+  801bce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd3:	49 bc 7d 15 80 00 00 	movabs $0x80157d,%r12
+  801bda:	00 00 00 
+  801bdd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be5:	4c 89 f6             	mov    %r14,%rsi
+  801be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bed:	41 ff d4             	call   *%r12
+    return res;
+  801bf0:	eb c3                	jmp    801bb5 <dup+0xe6>
+
+0000000000801bf2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bf2:	55                   	push   %rbp
+  801bf3:	48 89 e5             	mov    %rsp,%rbp
+  801bf6:	41 56                	push   %r14
+  801bf8:	41 55                	push   %r13
+  801bfa:	41 54                	push   %r12
+  801bfc:	53                   	push   %rbx
+  801bfd:	48 83 ec 10          	sub    $0x10,%rsp
+  801c01:	89 fb                	mov    %edi,%ebx
+  801c03:	49 89 f4             	mov    %rsi,%r12
+  801c06:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c09:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c0d:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	78 4c                	js     801c69 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c21:	41 8b 3e             	mov    (%r14),%edi
+  801c24:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c28:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 35                	js     801c6d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c38:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c3c:	83 e0 03             	and    $0x3,%eax
+  801c3f:	83 f8 01             	cmp    $0x1,%eax
+  801c42:	74 2d                	je     801c71 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c48:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c4c:	48 85 c0             	test   %rax,%rax
+  801c4f:	74 56                	je     801ca7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c51:	4c 89 ea             	mov    %r13,%rdx
+  801c54:	4c 89 e6             	mov    %r12,%rsi
+  801c57:	4c 89 f7             	mov    %r14,%rdi
+  801c5a:	ff d0                	call   *%rax
+}
+  801c5c:	48 83 c4 10          	add    $0x10,%rsp
+  801c60:	5b                   	pop    %rbx
+  801c61:	41 5c                	pop    %r12
+  801c63:	41 5d                	pop    %r13
+  801c65:	41 5e                	pop    %r14
+  801c67:	5d                   	pop    %rbp
+  801c68:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c69:	48 98                	cltq
+  801c6b:	eb ef                	jmp    801c5c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c6d:	48 98                	cltq
+  801c6f:	eb eb                	jmp    801c5c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c71:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c78:	00 00 00 
+  801c7b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c81:	89 da                	mov    %ebx,%edx
+  801c83:	48 bf f9 3f 80 00 00 	movabs $0x803ff9,%rdi
+  801c8a:	00 00 00 
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c92:	48 b9 00 05 80 00 00 	movabs $0x800500,%rcx
+  801c99:	00 00 00 
+  801c9c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c9e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ca5:	eb b5                	jmp    801c5c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ca7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cae:	eb ac                	jmp    801c5c <read+0x6a>
+
+0000000000801cb0 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	41 56                	push   %r14
+  801cb6:	41 55                	push   %r13
+  801cb8:	41 54                	push   %r12
+  801cba:	53                   	push   %rbx
+  801cbb:	48 83 ec 10          	sub    $0x10,%rsp
+  801cbf:	89 fb                	mov    %edi,%ebx
+  801cc1:	49 89 f4             	mov    %rsi,%r12
+  801cc4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ccb:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 41                	js     801d1c <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cdb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cdf:	41 8b 3e             	mov    (%r14),%edi
+  801ce2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ce6:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 35                	js     801d2b <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cf6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cfa:	83 e0 03             	and    $0x3,%eax
+  801cfd:	83 f8 01             	cmp    $0x1,%eax
+  801d00:	74 2d                	je     801d2f <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801d02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d06:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d0a:	48 85 c0             	test   %rax,%rax
+  801d0d:	74 56                	je     801d65 <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801d0f:	4c 89 ea             	mov    %r13,%rdx
+  801d12:	4c 89 e6             	mov    %r12,%rsi
+  801d15:	4c 89 f7             	mov    %r14,%rdi
+  801d18:	ff d0                	call   *%rax
+  801d1a:	eb 02                	jmp    801d1e <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1c:	48 98                	cltq
+}
+  801d1e:	48 83 c4 10          	add    $0x10,%rsp
+  801d22:	5b                   	pop    %rbx
+  801d23:	41 5c                	pop    %r12
+  801d25:	41 5d                	pop    %r13
+  801d27:	41 5e                	pop    %r14
+  801d29:	5d                   	pop    %rbp
+  801d2a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2b:	48 98                	cltq
+  801d2d:	eb ef                	jmp    801d1e <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d36:	00 00 00 
+  801d39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d3f:	89 da                	mov    %ebx,%edx
+  801d41:	48 bf b8 3f 80 00 00 	movabs $0x803fb8,%rdi
+  801d48:	00 00 00 
+  801d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d50:	48 b9 00 05 80 00 00 	movabs $0x800500,%rcx
+  801d57:	00 00 00 
+  801d5a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d5c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d63:	eb b9                	jmp    801d1e <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801d65:	4c 89 ea             	mov    %r13,%rdx
+  801d68:	4c 89 e6             	mov    %r12,%rsi
+  801d6b:	89 df                	mov    %ebx,%edi
+  801d6d:	48 b8 f2 1b 80 00 00 	movabs $0x801bf2,%rax
+  801d74:	00 00 00 
+  801d77:	ff d0                	call   *%rax
+  801d79:	eb a3                	jmp    801d1e <readmap+0x6e>
+
+0000000000801d7b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	41 57                	push   %r15
+  801d81:	41 56                	push   %r14
+  801d83:	41 55                	push   %r13
+  801d85:	41 54                	push   %r12
+  801d87:	53                   	push   %rbx
+  801d88:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d8c:	48 85 d2             	test   %rdx,%rdx
+  801d8f:	74 54                	je     801de5 <readn+0x6a>
+  801d91:	41 89 fd             	mov    %edi,%r13d
+  801d94:	49 89 f6             	mov    %rsi,%r14
+  801d97:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d9f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801da4:	49 bf f2 1b 80 00 00 	movabs $0x801bf2,%r15
+  801dab:	00 00 00 
+  801dae:	4c 89 e2             	mov    %r12,%rdx
+  801db1:	48 29 f2             	sub    %rsi,%rdx
+  801db4:	4c 01 f6             	add    %r14,%rsi
+  801db7:	44 89 ef             	mov    %r13d,%edi
+  801dba:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 20                	js     801de1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dc1:	01 c3                	add    %eax,%ebx
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	74 08                	je     801dcf <readn+0x54>
+  801dc7:	48 63 f3             	movslq %ebx,%rsi
+  801dca:	4c 39 e6             	cmp    %r12,%rsi
+  801dcd:	72 df                	jb     801dae <readn+0x33>
+    }
+    return res;
+  801dcf:	48 63 c3             	movslq %ebx,%rax
+}
+  801dd2:	48 83 c4 08          	add    $0x8,%rsp
+  801dd6:	5b                   	pop    %rbx
+  801dd7:	41 5c                	pop    %r12
+  801dd9:	41 5d                	pop    %r13
+  801ddb:	41 5e                	pop    %r14
+  801ddd:	41 5f                	pop    %r15
+  801ddf:	5d                   	pop    %rbp
+  801de0:	c3                   	ret
+        if (inc < 0) return inc;
+  801de1:	48 98                	cltq
+  801de3:	eb ed                	jmp    801dd2 <readn+0x57>
+    int inc = 1, res = 0;
+  801de5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dea:	eb e3                	jmp    801dcf <readn+0x54>
+
+0000000000801dec <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dec:	55                   	push   %rbp
+  801ded:	48 89 e5             	mov    %rsp,%rbp
+  801df0:	41 56                	push   %r14
+  801df2:	41 55                	push   %r13
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+  801df7:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfb:	89 fb                	mov    %edi,%ebx
+  801dfd:	49 89 f4             	mov    %rsi,%r12
+  801e00:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e03:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e07:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801e0e:	00 00 00 
+  801e11:	ff d0                	call   *%rax
+  801e13:	85 c0                	test   %eax,%eax
+  801e15:	78 47                	js     801e5e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e17:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e1b:	41 8b 3e             	mov    (%r14),%edi
+  801e1e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e22:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801e29:	00 00 00 
+  801e2c:	ff d0                	call   *%rax
+  801e2e:	85 c0                	test   %eax,%eax
+  801e30:	78 30                	js     801e62 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e32:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e37:	74 2d                	je     801e66 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e3d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e41:	48 85 c0             	test   %rax,%rax
+  801e44:	74 56                	je     801e9c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e46:	4c 89 ea             	mov    %r13,%rdx
+  801e49:	4c 89 e6             	mov    %r12,%rsi
+  801e4c:	4c 89 f7             	mov    %r14,%rdi
+  801e4f:	ff d0                	call   *%rax
+}
+  801e51:	48 83 c4 10          	add    $0x10,%rsp
+  801e55:	5b                   	pop    %rbx
+  801e56:	41 5c                	pop    %r12
+  801e58:	41 5d                	pop    %r13
+  801e5a:	41 5e                	pop    %r14
+  801e5c:	5d                   	pop    %rbp
+  801e5d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e5e:	48 98                	cltq
+  801e60:	eb ef                	jmp    801e51 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e62:	48 98                	cltq
+  801e64:	eb eb                	jmp    801e51 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e66:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e6d:	00 00 00 
+  801e70:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e76:	89 da                	mov    %ebx,%edx
+  801e78:	48 bf 15 40 80 00 00 	movabs $0x804015,%rdi
+  801e7f:	00 00 00 
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	48 b9 00 05 80 00 00 	movabs $0x800500,%rcx
+  801e8e:	00 00 00 
+  801e91:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e93:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e9a:	eb b5                	jmp    801e51 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e9c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ea3:	eb ac                	jmp    801e51 <write+0x65>
+
+0000000000801ea5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	53                   	push   %rbx
+  801eaa:	48 83 ec 18          	sub    $0x18,%rsp
+  801eae:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb4:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 0c                	js     801ed0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ec4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ec8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ed0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed4:	c9                   	leave
+  801ed5:	c3                   	ret
+
+0000000000801ed6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ed6:	55                   	push   %rbp
+  801ed7:	48 89 e5             	mov    %rsp,%rbp
+  801eda:	41 55                	push   %r13
+  801edc:	41 54                	push   %r12
+  801ede:	53                   	push   %rbx
+  801edf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee3:	89 fb                	mov    %edi,%ebx
+  801ee5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eec:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 38                	js     801f34 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801efc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f00:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f04:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f08:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	78 1c                	js     801f34 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f18:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f1d:	74 20                	je     801f3f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f23:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801f27:	48 85 c0             	test   %rax,%rax
+  801f2a:	74 47                	je     801f73 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f2c:	44 89 e6             	mov    %r12d,%esi
+  801f2f:	4c 89 ef             	mov    %r13,%rdi
+  801f32:	ff d0                	call   *%rax
+}
+  801f34:	48 83 c4 18          	add    $0x18,%rsp
+  801f38:	5b                   	pop    %rbx
+  801f39:	41 5c                	pop    %r12
+  801f3b:	41 5d                	pop    %r13
+  801f3d:	5d                   	pop    %rbp
+  801f3e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f3f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f46:	00 00 00 
+  801f49:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f4f:	89 da                	mov    %ebx,%edx
+  801f51:	48 bf d8 3f 80 00 00 	movabs $0x803fd8,%rdi
+  801f58:	00 00 00 
+  801f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f60:	48 b9 00 05 80 00 00 	movabs $0x800500,%rcx
+  801f67:	00 00 00 
+  801f6a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f71:	eb c1                	jmp    801f34 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f73:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f78:	eb ba                	jmp    801f34 <ftruncate+0x5e>
+
+0000000000801f7a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	41 54                	push   %r12
+  801f80:	53                   	push   %rbx
+  801f81:	48 83 ec 10          	sub    $0x10,%rsp
+  801f85:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f88:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f8c:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801f93:	00 00 00 
+  801f96:	ff d0                	call   *%rax
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 4e                	js     801fea <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f9c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fa0:	41 8b 3c 24          	mov    (%r12),%edi
+  801fa4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fa8:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 32                	js     801fea <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fbc:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801fc1:	74 30                	je     801ff3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fc3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fc6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fcd:	00 00 00 
+    stat->st_isdir = 0;
+  801fd0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fd7:	00 00 00 
+    stat->st_dev = dev;
+  801fda:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fe1:	48 89 de             	mov    %rbx,%rsi
+  801fe4:	4c 89 e7             	mov    %r12,%rdi
+  801fe7:	ff 50 30             	call   *0x30(%rax)
+}
+  801fea:	48 83 c4 10          	add    $0x10,%rsp
+  801fee:	5b                   	pop    %rbx
+  801fef:	41 5c                	pop    %r12
+  801ff1:	5d                   	pop    %rbp
+  801ff2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ff3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff8:	eb f0                	jmp    801fea <fstat+0x70>
+
+0000000000801ffa <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802004:	be 00 00 00 00       	mov    $0x0,%esi
+  802009:	48 b8 51 2d 80 00 00 	movabs $0x802d51,%rax
+  802010:	00 00 00 
+  802013:	ff d0                	call   *%rax
+  802015:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802017:	85 c0                	test   %eax,%eax
+  802019:	78 25                	js     802040 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80201b:	4c 89 e6             	mov    %r12,%rsi
+  80201e:	89 c7                	mov    %eax,%edi
+  802020:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  802027:	00 00 00 
+  80202a:	ff d0                	call   *%rax
+  80202c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80202f:	89 df                	mov    %ebx,%edi
+  802031:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+
+    return res;
+  80203d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802040:	89 d8                	mov    %ebx,%eax
+  802042:	5b                   	pop    %rbx
+  802043:	41 5c                	pop    %r12
+  802045:	5d                   	pop    %rbp
+  802046:	c3                   	ret
+
+0000000000802047 <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  802047:	55                   	push   %rbp
+  802048:	48 89 e5             	mov    %rsp,%rbp
+  80204b:	41 54                	push   %r12
+  80204d:	53                   	push   %rbx
+  80204e:	48 83 ec 10          	sub    $0x10,%rsp
+  802052:	48 89 fb             	mov    %rdi,%rbx
+  802055:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802058:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80205c:	bf 66 00 00 00       	mov    $0x66,%edi
+  802061:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 1f                	js     802090 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  802071:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802075:	48 8b 40 40          	mov    0x40(%rax),%rax
+  802079:	48 85 c0             	test   %rax,%rax
+  80207c:	74 1b                	je     802099 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  80207e:	4c 89 e6             	mov    %r12,%rsi
+  802081:	48 89 df             	mov    %rbx,%rdi
+  802084:	ff d0                	call   *%rax
+    if (res < 0) {
+  802086:	85 c0                	test   %eax,%eax
+  802088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802090:	48 83 c4 10          	add    $0x10,%rsp
+  802094:	5b                   	pop    %rbx
+  802095:	41 5c                	pop    %r12
+  802097:	5d                   	pop    %rbp
+  802098:	c3                   	ret
+        return -E_NOT_SUPP;
+  802099:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80209e:	eb f0                	jmp    802090 <create_snapshot+0x49>
+
+00000000008020a0 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  8020a0:	55                   	push   %rbp
+  8020a1:	48 89 e5             	mov    %rsp,%rbp
+  8020a4:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020a8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020ac:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020b1:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 1e                	js     8020df <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  8020c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020c5:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8020c9:	48 85 d2             	test   %rdx,%rdx
+  8020cc:	74 13                	je     8020e1 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  8020ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d3:	ff d2                	call   *%rdx
+    if (res < 0) {
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020dc:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  8020df:	c9                   	leave
+  8020e0:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020e1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e6:	eb f7                	jmp    8020df <print_snapshot_list+0x3f>
+
+00000000008020e8 <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  8020e8:	55                   	push   %rbp
+  8020e9:	48 89 e5             	mov    %rsp,%rbp
+  8020ec:	53                   	push   %rbx
+  8020ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f1:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020f8:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020fd:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 1c                	js     802129 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  80210d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802111:	48 8b 40 50          	mov    0x50(%rax),%rax
+  802115:	48 85 c0             	test   %rax,%rax
+  802118:	74 15                	je     80212f <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  80211a:	48 89 df             	mov    %rbx,%rdi
+  80211d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	ba 00 00 00 00       	mov    $0x0,%edx
+  802126:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+        return -E_NOT_SUPP;
+  80212f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802134:	eb f3                	jmp    802129 <accept_snapshot+0x41>
+
+0000000000802136 <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  802136:	55                   	push   %rbp
+  802137:	48 89 e5             	mov    %rsp,%rbp
+  80213a:	53                   	push   %rbx
+  80213b:	48 83 ec 18          	sub    $0x18,%rsp
+  80213f:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802142:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802146:	bf 66 00 00 00       	mov    $0x66,%edi
+  80214b:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  802152:	00 00 00 
+  802155:	ff d0                	call   *%rax
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 1c                	js     802177 <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  80215b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80215f:	48 8b 40 58          	mov    0x58(%rax),%rax
+  802163:	48 85 c0             	test   %rax,%rax
+  802166:	74 15                	je     80217d <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  802168:	48 89 df             	mov    %rbx,%rdi
+  80216b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802174:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  802177:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80217b:	c9                   	leave
+  80217c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80217d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802182:	eb f3                	jmp    802177 <delete_snapshot+0x41>
+
+0000000000802184 <gc_snapshots>:
+
+int
+gc_snapshots() {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80218c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802190:	bf 66 00 00 00       	mov    $0x66,%edi
+  802195:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 14                	js     8021b9 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  8021a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021a9:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8021ad:	48 85 d2             	test   %rdx,%rdx
+  8021b0:	74 09                	je     8021bb <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b7:	ff d2                	call   *%rdx
+
+    return res;
+}
+  8021b9:	c9                   	leave
+  8021ba:	c3                   	ret
+        return -E_NOT_SUPP;
+  8021bb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c0:	eb f7                	jmp    8021b9 <gc_snapshots+0x35>
+
+00000000008021c2 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	41 56                	push   %r14
+  8021c8:	41 55                	push   %r13
+  8021ca:	41 54                	push   %r12
+  8021cc:	53                   	push   %rbx
+  8021cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d1:	48 89 fb             	mov    %rdi,%rbx
+  8021d4:	49 89 f4             	mov    %rsi,%r12
+  8021d7:	49 89 d5             	mov    %rdx,%r13
+  8021da:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8021dd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021e1:	bf 66 00 00 00       	mov    $0x66,%edi
+  8021e6:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	78 1b                	js     802211 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  8021f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021fa:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8021fe:	48 85 c0             	test   %rax,%rax
+  802201:	74 1b                	je     80221e <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  802203:	4c 89 f1             	mov    %r14,%rcx
+  802206:	4c 89 ea             	mov    %r13,%rdx
+  802209:	4c 89 e6             	mov    %r12,%rsi
+  80220c:	48 89 df             	mov    %rbx,%rdi
+  80220f:	ff d0                	call   *%rax
+
+    return res;
+}
+  802211:	48 83 c4 10          	add    $0x10,%rsp
+  802215:	5b                   	pop    %rbx
+  802216:	41 5c                	pop    %r12
+  802218:	41 5d                	pop    %r13
+  80221a:	41 5e                	pop    %r14
+  80221c:	5d                   	pop    %rbp
+  80221d:	c3                   	ret
+        return -E_NOT_SUPP;
+  80221e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802223:	eb ec                	jmp    802211 <diff_snapshots+0x4f>
+
+0000000000802225 <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+  802229:	41 55                	push   %r13
+  80222b:	41 54                	push   %r12
+  80222d:	53                   	push   %rbx
+  80222e:	48 83 ec 18          	sub    $0x18,%rsp
+  802232:	48 89 fb             	mov    %rdi,%rbx
+  802235:	49 89 f4             	mov    %rsi,%r12
+  802238:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80223b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80223f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802244:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80224b:	00 00 00 
+  80224e:	ff d0                	call   *%rax
+  802250:	85 c0                	test   %eax,%eax
+  802252:	78 18                	js     80226c <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  802254:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802258:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80225c:	48 85 c0             	test   %rax,%rax
+  80225f:	74 16                	je     802277 <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  802261:	4c 89 ea             	mov    %r13,%rdx
+  802264:	4c 89 e6             	mov    %r12,%rsi
+  802267:	48 89 df             	mov    %rbx,%rdi
+  80226a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80226c:	48 83 c4 18          	add    $0x18,%rsp
+  802270:	5b                   	pop    %rbx
+  802271:	41 5c                	pop    %r12
+  802273:	41 5d                	pop    %r13
+  802275:	5d                   	pop    %rbp
+  802276:	c3                   	ret
+        return -E_NOT_SUPP;
+  802277:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80227c:	eb ee                	jmp    80226c <send_snapshot+0x47>
+
+000000000080227e <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+  802282:	53                   	push   %rbx
+  802283:	48 83 ec 18          	sub    $0x18,%rsp
+  802287:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80228a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80228e:	bf 66 00 00 00       	mov    $0x66,%edi
+  802293:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	78 12                	js     8022b5 <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  8022a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022a7:	48 8b 40 78          	mov    0x78(%rax),%rax
+  8022ab:	48 85 c0             	test   %rax,%rax
+  8022ae:	74 0b                	je     8022bb <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  8022b0:	48 89 df             	mov    %rbx,%rdi
+  8022b3:	ff d0                	call   *%rax
+
+    return res;
+}
+  8022b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022bb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022c0:	eb f3                	jmp    8022b5 <receive_snapshot+0x37>
+
+00000000008022c2 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+  8022c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8022ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ce:	bf 66 00 00 00       	mov    $0x66,%edi
+  8022d3:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 17                	js     8022fa <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  8022e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022e7:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8022ee:	48 85 d2             	test   %rdx,%rdx
+  8022f1:	74 09                	je     8022fc <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  8022f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f8:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+        return -E_NOT_SUPP;
+  8022fc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802301:	eb f7                	jmp    8022fa <free_space_bytes+0x38>
+
+0000000000802303 <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  802303:	55                   	push   %rbp
+  802304:	48 89 e5             	mov    %rsp,%rbp
+  802307:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  80230b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80230f:	bf 66 00 00 00       	mov    $0x66,%edi
+  802314:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80231b:	00 00 00 
+  80231e:	ff d0                	call   *%rax
+  802320:	85 c0                	test   %eax,%eax
+  802322:	78 17                	js     80233b <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  802324:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802328:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80232f:	48 85 d2             	test   %rdx,%rdx
+  802332:	74 09                	je     80233d <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  802334:	b8 00 00 00 00       	mov    $0x0,%eax
+  802339:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80233d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802342:	eb f7                	jmp    80233b <busy_space_bytes+0x38>
+
+0000000000802344 <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	48 83 ec 10          	sub    $0x10,%rsp
+  80234f:	89 fb                	mov    %edi,%ebx
+  802351:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802354:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802358:	bf 66 00 00 00       	mov    $0x66,%edi
+  80235d:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  802364:	00 00 00 
+  802367:	ff d0                	call   *%rax
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	78 17                	js     802384 <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  80236d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802371:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  802378:	48 85 c0             	test   %rax,%rax
+  80237b:	74 10                	je     80238d <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  80237d:	4c 89 e6             	mov    %r12,%rsi
+  802380:	89 df                	mov    %ebx,%edi
+  802382:	ff d0                	call   *%rax
+    
+    return res;
+}
+  802384:	48 83 c4 10          	add    $0x10,%rsp
+  802388:	5b                   	pop    %rbx
+  802389:	41 5c                	pop    %r12
+  80238b:	5d                   	pop    %rbp
+  80238c:	c3                   	ret
+        return -E_NOT_SUPP;
+  80238d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802392:	eb f0                	jmp    802384 <snapshots_space+0x40>
+
+0000000000802394 <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	41 55                	push   %r13
+  80239a:	41 54                	push   %r12
+  80239c:	53                   	push   %rbx
+  80239d:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a1:	41 89 fd             	mov    %edi,%r13d
+  8023a4:	48 89 f3             	mov    %rsi,%rbx
+  8023a7:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023aa:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023b1:	00 00 00 
+  8023b4:	83 38 00             	cmpl   $0x0,(%rax)
+  8023b7:	74 57                	je     802410 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8023b9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023bf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023c4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8023cb:	00 00 00 
+  8023ce:	44 89 ee             	mov    %r13d,%esi
+  8023d1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023d8:	00 00 00 
+  8023db:	8b 38                	mov    (%rax),%edi
+  8023dd:	48 b8 e6 38 80 00 00 	movabs $0x8038e6,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  8023e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ee:	4c 89 e2             	mov    %r12,%rdx
+  8023f1:	48 89 de             	mov    %rbx,%rsi
+  8023f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f9:	48 b8 ce 38 80 00 00 	movabs $0x8038ce,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+}
+  802405:	48 83 c4 08          	add    $0x8,%rsp
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	41 5d                	pop    %r13
+  80240e:	5d                   	pop    %rbp
+  80240f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802410:	bf 03 00 00 00       	mov    $0x3,%edi
+  802415:	48 b8 a4 39 80 00 00 	movabs $0x8039a4,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+  802421:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802428:	00 00 
+  80242a:	eb 8d                	jmp    8023b9 <fsipc_region+0x25>
+
+000000000080242c <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+  802430:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  802434:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80243b:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  80243c:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  802440:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  802447:	00 00 00 
+  80244a:	ff d0                	call   *%rax
+}
+  80244c:	c9                   	leave
+  80244d:	c3                   	ret
+
+000000000080244e <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  80244e:	85 ff                	test   %edi,%edi
+  802450:	78 6d                	js     8024bf <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  802452:	55                   	push   %rbp
+  802453:	48 89 e5             	mov    %rsp,%rbp
+  802456:	41 54                	push   %r12
+  802458:	53                   	push   %rbx
+  802459:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  80245c:	48 85 f6             	test   %rsi,%rsi
+  80245f:	74 57                	je     8024b8 <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  802461:	89 f8                	mov    %edi,%eax
+  802463:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80246a:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  80246c:	be 00 00 00 00       	mov    $0x0,%esi
+  802471:	bf 12 00 00 00       	mov    $0x12,%edi
+  802476:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802482:	85 c0                	test   %eax,%eax
+  802484:	78 2d                	js     8024b3 <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  802486:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80248d:	00 00 00 
+  802490:	49 63 14 24          	movslq (%r12),%rdx
+  802494:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  80249b:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8024a0:	48 89 df             	mov    %rbx,%rdi
+  8024a3:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  8024af:	41 8b 04 24          	mov    (%r12),%eax
+}
+  8024b3:	5b                   	pop    %rbx
+  8024b4:	41 5c                	pop    %r12
+  8024b6:	5d                   	pop    %rbp
+  8024b7:	c3                   	ret
+        return -E_INVAL;
+  8024b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024bd:	eb f4                	jmp    8024b3 <devfile_df_snapshots+0x65>
+  8024bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024c4:	c3                   	ret
+
+00000000008024c5 <devfile_df_busy>:
+devfile_df_busy() {
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  8024c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ce:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024d3:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+}
+  8024df:	5d                   	pop    %rbp
+  8024e0:	c3                   	ret
+
+00000000008024e1 <devfile_df_free>:
+devfile_df_free() {
+  8024e1:	55                   	push   %rbp
+  8024e2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  8024e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ea:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024ef:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+}
+  8024fb:	5d                   	pop    %rbp
+  8024fc:	c3                   	ret
+
+00000000008024fd <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  8024fd:	55                   	push   %rbp
+  8024fe:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802501:	be 00 00 00 00       	mov    $0x0,%esi
+  802506:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80250b:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+}
+  802517:	5d                   	pop    %rbp
+  802518:	c3                   	ret
+
+0000000000802519 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  80251d:	be 00 00 00 00       	mov    $0x0,%esi
+  802522:	bf 09 00 00 00       	mov    $0x9,%edi
+  802527:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802533:	85 c0                	test   %eax,%eax
+  802535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80253d:	5d                   	pop    %rbp
+  80253e:	c3                   	ret
+
+000000000080253f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802543:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80254a:	00 00 00 
+  80254d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802550:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802552:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802555:	be 00 00 00 00       	mov    $0x0,%esi
+  80255a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80255f:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802566:	00 00 00 
+  802569:	ff d0                	call   *%rax
+}
+  80256b:	5d                   	pop    %rbp
+  80256c:	c3                   	ret
+
+000000000080256d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802571:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802574:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80257b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80257d:	be 00 00 00 00       	mov    $0x0,%esi
+  802582:	bf 06 00 00 00       	mov    $0x6,%edi
+  802587:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+}
+  802593:	5d                   	pop    %rbp
+  802594:	c3                   	ret
+
+0000000000802595 <devfile_write>:
+    if (!fd || !buf) {
+  802595:	48 85 ff             	test   %rdi,%rdi
+  802598:	0f 84 c1 00 00 00    	je     80265f <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	41 57                	push   %r15
+  8025a4:	41 56                	push   %r14
+  8025a6:	41 55                	push   %r13
+  8025a8:	41 54                	push   %r12
+  8025aa:	53                   	push   %rbx
+  8025ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8025af:	49 89 ff             	mov    %rdi,%r15
+  8025b2:	49 89 f5             	mov    %rsi,%r13
+  8025b5:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8025b8:	48 85 f6             	test   %rsi,%rsi
+  8025bb:	0f 84 95 00 00 00    	je     802656 <devfile_write+0xc1>
+    while (n) {
+  8025c1:	48 85 d2             	test   %rdx,%rdx
+  8025c4:	0f 84 83 00 00 00    	je     80264d <devfile_write+0xb8>
+    int totalWrite = 0;
+  8025ca:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025d1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8025d8:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025db:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025e0:	49 39 dc             	cmp    %rbx,%r12
+  8025e3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  8025e7:	48 89 da             	mov    %rbx,%rdx
+  8025ea:	4c 89 ee             	mov    %r13,%rsi
+  8025ed:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8025f4:	00 00 00 
+  8025f7:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802603:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802607:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  80260a:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  80260e:	be 00 00 00 00       	mov    $0x0,%esi
+  802613:	bf 04 00 00 00       	mov    $0x4,%edi
+  802618:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+        if (write < 0) {
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 21                	js     802649 <devfile_write+0xb4>
+        buf += write;
+  802628:	48 63 d0             	movslq %eax,%rdx
+  80262b:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  80262e:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802631:	49 29 d4             	sub    %rdx,%r12
+  802634:	75 a5                	jne    8025db <devfile_write+0x46>
+    return totalWrite;
+  802636:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  80263a:	48 83 c4 18          	add    $0x18,%rsp
+  80263e:	5b                   	pop    %rbx
+  80263f:	41 5c                	pop    %r12
+  802641:	41 5d                	pop    %r13
+  802643:	41 5e                	pop    %r14
+  802645:	41 5f                	pop    %r15
+  802647:	5d                   	pop    %rbp
+  802648:	c3                   	ret
+            return write;
+  802649:	48 98                	cltq
+  80264b:	eb ed                	jmp    80263a <devfile_write+0xa5>
+    int totalWrite = 0;
+  80264d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  802654:	eb e0                	jmp    802636 <devfile_write+0xa1>
+        return -E_INVAL;
+  802656:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80265d:	eb db                	jmp    80263a <devfile_write+0xa5>
+  80265f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802666:	c3                   	ret
+
+0000000000802667 <devfile_read>:
+    if (!fd || !buf) {
+  802667:	48 85 ff             	test   %rdi,%rdi
+  80266a:	0f 84 c0 00 00 00    	je     802730 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802670:	55                   	push   %rbp
+  802671:	48 89 e5             	mov    %rsp,%rbp
+  802674:	41 57                	push   %r15
+  802676:	41 56                	push   %r14
+  802678:	41 55                	push   %r13
+  80267a:	41 54                	push   %r12
+  80267c:	53                   	push   %rbx
+  80267d:	48 83 ec 18          	sub    $0x18,%rsp
+  802681:	49 89 ff             	mov    %rdi,%r15
+  802684:	49 89 f5             	mov    %rsi,%r13
+  802687:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80268a:	48 85 f6             	test   %rsi,%rsi
+  80268d:	0f 84 96 00 00 00    	je     802729 <devfile_read+0xc2>
+    while (n) {
+  802693:	48 85 d2             	test   %rdx,%rdx
+  802696:	0f 84 87 00 00 00    	je     802723 <devfile_read+0xbc>
+    size_t totalRead = 0;
+  80269c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8026a3:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8026a4:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8026ab:	00 00 00 
+  8026ae:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8026b2:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  8026b5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026ba:	49 39 c4             	cmp    %rax,%r12
+  8026bd:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  8026c1:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  8026c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ca:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026cf:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+        if (read <= 0) {
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	7e 37                	jle    802716 <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  8026df:	48 63 d8             	movslq %eax,%rbx
+  8026e2:	48 89 da             	mov    %rbx,%rdx
+  8026e5:	4c 89 f6             	mov    %r14,%rsi
+  8026e8:	4c 89 ef             	mov    %r13,%rdi
+  8026eb:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+        buf += read;
+  8026f7:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  8026fa:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8026fe:	49 29 dc             	sub    %rbx,%r12
+  802701:	75 ab                	jne    8026ae <devfile_read+0x47>
+  return totalRead;
+  802703:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802707:	48 83 c4 18          	add    $0x18,%rsp
+  80270b:	5b                   	pop    %rbx
+  80270c:	41 5c                	pop    %r12
+  80270e:	41 5d                	pop    %r13
+  802710:	41 5e                	pop    %r14
+  802712:	41 5f                	pop    %r15
+  802714:	5d                   	pop    %rbp
+  802715:	c3                   	ret
+            return read ? read : totalRead;
+  802716:	48 63 d0             	movslq %eax,%rdx
+  802719:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80271d:	48 0f 45 c2          	cmovne %rdx,%rax
+  802721:	eb e4                	jmp    802707 <devfile_read+0xa0>
+    size_t totalRead = 0;
+  802723:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802727:	eb da                	jmp    802703 <devfile_read+0x9c>
+        return E_INVAL;
+  802729:	b8 03 00 00 00       	mov    $0x3,%eax
+  80272e:	eb d7                	jmp    802707 <devfile_read+0xa0>
+  802730:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802735:	c3                   	ret
+
+0000000000802736 <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802736:	48 85 ff             	test   %rdi,%rdi
+  802739:	74 5f                	je     80279a <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	53                   	push   %rbx
+  802740:	48 83 ec 08          	sub    $0x8,%rsp
+  802744:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  802747:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+  802753:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802759:	77 45                	ja     8027a0 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  80275b:	48 89 de             	mov    %rbx,%rsi
+  80275e:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802765:	00 00 00 
+  802768:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  802774:	be 00 00 00 00       	mov    $0x0,%esi
+  802779:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80277e:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802791:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802794:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+        return -E_INVAL;
+  80279a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80279f:	c3                   	ret
+        return -E_INVAL;
+  8027a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027a5:	eb ed                	jmp    802794 <devfile_receive_snapshot+0x5e>
+
+00000000008027a7 <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  8027a7:	55                   	push   %rbp
+  8027a8:	48 89 e5             	mov    %rsp,%rbp
+  8027ab:	41 55                	push   %r13
+  8027ad:	41 54                	push   %r12
+  8027af:	53                   	push   %rbx
+  8027b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b4:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  8027b7:	48 85 f6             	test   %rsi,%rsi
+  8027ba:	0f 94 c0             	sete   %al
+  8027bd:	48 85 d2             	test   %rdx,%rdx
+  8027c0:	0f 94 c2             	sete   %dl
+  8027c3:	08 d0                	or     %dl,%al
+  8027c5:	0f 85 ad 00 00 00    	jne    802878 <devfile_send_snapshot+0xd1>
+  8027cb:	48 89 fb             	mov    %rdi,%rbx
+  8027ce:	49 89 f4             	mov    %rsi,%r12
+  8027d1:	48 85 ff             	test   %rdi,%rdi
+  8027d4:	0f 84 9e 00 00 00    	je     802878 <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  8027da:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+  8027e6:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8027ec:	0f 87 8d 00 00 00    	ja     80287f <devfile_send_snapshot+0xd8>
+  8027f2:	4c 89 e7             	mov    %r12,%rdi
+  8027f5:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802807:	77 7d                	ja     802886 <devfile_send_snapshot+0xdf>
+  802809:	4c 89 ef             	mov    %r13,%rdi
+  80280c:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+  802818:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80281e:	77 6d                	ja     80288d <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802820:	48 89 de             	mov    %rbx,%rsi
+  802823:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80282a:	00 00 00 
+  80282d:	48 bb 25 0e 80 00 00 	movabs $0x800e25,%rbx
+  802834:	00 00 00 
+  802837:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  802839:	4c 89 e6             	mov    %r12,%rsi
+  80283c:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802843:	00 00 00 
+  802846:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  802848:	4c 89 ee             	mov    %r13,%rsi
+  80284b:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  802852:	00 00 00 
+  802855:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  802857:	be 00 00 00 00       	mov    $0x0,%esi
+  80285c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802861:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802868:	00 00 00 
+  80286b:	ff d0                	call   *%rax
+}
+  80286d:	48 83 c4 08          	add    $0x8,%rsp
+  802871:	5b                   	pop    %rbx
+  802872:	41 5c                	pop    %r12
+  802874:	41 5d                	pop    %r13
+  802876:	5d                   	pop    %rbp
+  802877:	c3                   	ret
+        return -E_INVAL;
+  802878:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287d:	eb ee                	jmp    80286d <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  80287f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802884:	eb e7                	jmp    80286d <devfile_send_snapshot+0xc6>
+  802886:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80288b:	eb e0                	jmp    80286d <devfile_send_snapshot+0xc6>
+  80288d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802892:	eb d9                	jmp    80286d <devfile_send_snapshot+0xc6>
+
+0000000000802894 <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  802894:	48 85 ff             	test   %rdi,%rdi
+  802897:	0f 84 41 01 00 00    	je     8029de <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+  8028a1:	41 57                	push   %r15
+  8028a3:	41 56                	push   %r14
+  8028a5:	41 55                	push   %r13
+  8028a7:	41 54                	push   %r12
+  8028a9:	53                   	push   %rbx
+  8028aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ae:	49 89 fc             	mov    %rdi,%r12
+  8028b1:	49 89 f5             	mov    %rsi,%r13
+  8028b4:	48 89 d3             	mov    %rdx,%rbx
+  8028b7:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  8028ba:	48 85 f6             	test   %rsi,%rsi
+  8028bd:	0f 84 ff 00 00 00    	je     8029c2 <devfile_diff_snapshots+0x12e>
+  8028c3:	48 85 d2             	test   %rdx,%rdx
+  8028c6:	0f 84 fd 00 00 00    	je     8029c9 <devfile_diff_snapshots+0x135>
+  8028cc:	48 85 c9             	test   %rcx,%rcx
+  8028cf:	0f 84 f4 00 00 00    	je     8029c9 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  8028d5:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+  8028e1:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  8028e7:	0f 87 e3 00 00 00    	ja     8029d0 <devfile_diff_snapshots+0x13c>
+  8028ed:	4c 89 ef             	mov    %r13,%rdi
+  8028f0:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+  8028fc:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802902:	0f 87 cf 00 00 00    	ja     8029d7 <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  802908:	4c 89 e6             	mov    %r12,%rsi
+  80290b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802912:	00 00 00 
+  802915:	4c 89 e7             	mov    %r12,%rdi
+  802918:	49 bf 25 0e 80 00 00 	movabs $0x800e25,%r15
+  80291f:	00 00 00 
+  802922:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  802925:	4c 89 ee             	mov    %r13,%rsi
+  802928:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  80292f:	00 
+  802930:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  802933:	48 8b 03             	mov    (%rbx),%rax
+  802936:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  80293d:	00 
+  80293e:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802942:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  802949:	00 
+  80294a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80294e:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  802955:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  802956:	be 00 00 00 00       	mov    $0x0,%esi
+  80295b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802960:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 43                	js     8029b3 <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  802970:	49 8b 04 24          	mov    (%r12),%rax
+  802974:	48 89 03             	mov    %rax,(%rbx)
+  802977:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80297c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  802980:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  802985:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  802989:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  80298e:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802992:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  802996:	48 c1 e2 03          	shl    $0x3,%rdx
+  80299a:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  80299f:	4c 89 f7             	mov    %r14,%rdi
+  8029a2:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  8029a9:	00 00 00 
+  8029ac:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  8029ae:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  8029b3:	48 83 c4 08          	add    $0x8,%rsp
+  8029b7:	5b                   	pop    %rbx
+  8029b8:	41 5c                	pop    %r12
+  8029ba:	41 5d                	pop    %r13
+  8029bc:	41 5e                	pop    %r14
+  8029be:	41 5f                	pop    %r15
+  8029c0:	5d                   	pop    %rbp
+  8029c1:	c3                   	ret
+        return -E_INVAL;
+  8029c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c7:	eb ea                	jmp    8029b3 <devfile_diff_snapshots+0x11f>
+  8029c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ce:	eb e3                	jmp    8029b3 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d5:	eb dc                	jmp    8029b3 <devfile_diff_snapshots+0x11f>
+  8029d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029dc:	eb d5                	jmp    8029b3 <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  8029de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029e3:	c3                   	ret
+
+00000000008029e4 <devfile_delete_snapshot>:
+    if (!name) {
+  8029e4:	48 85 ff             	test   %rdi,%rdi
+  8029e7:	74 5f                	je     802a48 <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  8029e9:	55                   	push   %rbp
+  8029ea:	48 89 e5             	mov    %rsp,%rbp
+  8029ed:	53                   	push   %rbx
+  8029ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8029f5:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+  802a01:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a07:	77 45                	ja     802a4e <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802a09:	48 89 de             	mov    %rbx,%rsi
+  802a0c:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a13:	00 00 00 
+  802a16:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802a22:	be 00 00 00 00       	mov    $0x0,%esi
+  802a27:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a2c:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802a42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a46:	c9                   	leave
+  802a47:	c3                   	ret
+        return -E_INVAL;
+  802a48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a4d:	c3                   	ret
+        return -E_INVAL;
+  802a4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a53:	eb ed                	jmp    802a42 <devfile_delete_snapshot+0x5e>
+
+0000000000802a55 <devfile_accept_snapshot>:
+    if (!name) {
+  802a55:	48 85 ff             	test   %rdi,%rdi
+  802a58:	74 5f                	je     802ab9 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  802a5a:	55                   	push   %rbp
+  802a5b:	48 89 e5             	mov    %rsp,%rbp
+  802a5e:	53                   	push   %rbx
+  802a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a63:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  802a66:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  802a6d:	00 00 00 
+  802a70:	ff d0                	call   *%rax
+  802a72:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802a78:	77 45                	ja     802abf <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  802a7a:	48 89 de             	mov    %rbx,%rsi
+  802a7d:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802a84:	00 00 00 
+  802a87:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  802a93:	be 00 00 00 00       	mov    $0x0,%esi
+  802a98:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a9d:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aa9:	85 c0                	test   %eax,%eax
+  802aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab0:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802ab3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+        return -E_INVAL;
+  802ab9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802abe:	c3                   	ret
+        return -E_INVAL;
+  802abf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac4:	eb ed                	jmp    802ab3 <devfile_accept_snapshot+0x5e>
+
+0000000000802ac6 <devfile_create_snapshot>:
+    if (!comment || !name) {
+  802ac6:	48 85 ff             	test   %rdi,%rdi
+  802ac9:	0f 84 9f 00 00 00    	je     802b6e <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802acf:	55                   	push   %rbp
+  802ad0:	48 89 e5             	mov    %rsp,%rbp
+  802ad3:	41 54                	push   %r12
+  802ad5:	53                   	push   %rbx
+  802ad6:	48 89 fb             	mov    %rdi,%rbx
+  802ad9:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802adc:	48 85 f6             	test   %rsi,%rsi
+  802adf:	74 78                	je     802b59 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802ae1:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  802ae8:	00 00 00 
+  802aeb:	ff d0                	call   *%rax
+  802aed:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802af3:	77 6b                	ja     802b60 <devfile_create_snapshot+0x9a>
+  802af5:	4c 89 e7             	mov    %r12,%rdi
+  802af8:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  802b04:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b0a:	77 5b                	ja     802b67 <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802b0c:	48 89 de             	mov    %rbx,%rsi
+  802b0f:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  802b16:	00 00 00 
+  802b19:	48 bb 25 0e 80 00 00 	movabs $0x800e25,%rbx
+  802b20:	00 00 00 
+  802b23:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  802b25:	4c 89 e6             	mov    %r12,%rsi
+  802b28:	48 bf 00 71 80 00 00 	movabs $0x807100,%rdi
+  802b2f:	00 00 00 
+  802b32:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  802b34:	be 00 00 00 00       	mov    $0x0,%esi
+  802b39:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b3e:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802b45:	00 00 00 
+  802b48:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b51:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802b54:	5b                   	pop    %rbx
+  802b55:	41 5c                	pop    %r12
+  802b57:	5d                   	pop    %rbp
+  802b58:	c3                   	ret
+        return -E_INVAL;
+  802b59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b5e:	eb f4                	jmp    802b54 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b65:	eb ed                	jmp    802b54 <devfile_create_snapshot+0x8e>
+  802b67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6c:	eb e6                	jmp    802b54 <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  802b6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b73:	c3                   	ret
+
+0000000000802b74 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b74:	55                   	push   %rbp
+  802b75:	48 89 e5             	mov    %rsp,%rbp
+  802b78:	41 54                	push   %r12
+  802b7a:	53                   	push   %rbx
+  802b7b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b7e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802b81:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802b88:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b94:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ba0:	85 c0                	test   %eax,%eax
+  802ba2:	78 3d                	js     802be1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ba4:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802bab:	00 00 00 
+  802bae:	4c 89 e6             	mov    %r12,%rsi
+  802bb1:	48 89 df             	mov    %rbx,%rdi
+  802bb4:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802bc0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802bc7:	00 
+  802bc8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bce:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802bd5:	00 
+  802bd6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be1:	5b                   	pop    %rbx
+  802be2:	41 5c                	pop    %r12
+  802be4:	5d                   	pop    %rbp
+  802be5:	c3                   	ret
+
+0000000000802be6 <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	41 57                	push   %r15
+  802bec:	41 56                	push   %r14
+  802bee:	41 55                	push   %r13
+  802bf0:	41 54                	push   %r12
+  802bf2:	53                   	push   %rbx
+  802bf3:	48 83 ec 38          	sub    $0x38,%rsp
+  802bf7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802bfb:	49 89 f5             	mov    %rsi,%r13
+  802bfe:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c01:	48 89 f0             	mov    %rsi,%rax
+  802c04:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c09:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802c0d:	75 4f                	jne    802c5e <devfile_readmap+0x78>
+  802c0f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c13:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c19:	75 1f                	jne    802c3a <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802c1b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c1f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802c23:	49 be ce 33 80 00 00 	movabs $0x8033ce,%r14
+  802c2a:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802c2d:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  802c34:	0f 87 9d 00 00 00    	ja     802cd7 <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  802c3a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c3e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  802c42:	4d 85 ff             	test   %r15,%r15
+  802c45:	0f 85 cf 00 00 00    	jne    802d1a <devfile_readmap+0x134>
+  802c4b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  802c4f:	48 83 c4 38          	add    $0x38,%rsp
+  802c53:	5b                   	pop    %rbx
+  802c54:	41 5c                	pop    %r12
+  802c56:	41 5d                	pop    %r13
+  802c58:	41 5e                	pop    %r14
+  802c5a:	41 5f                	pop    %r15
+  802c5c:	5d                   	pop    %rbp
+  802c5d:	c3                   	ret
+    size_t totalRead = 0;
+  802c5e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  802c65:	00 
+  802c66:	eb da                	jmp    802c42 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c68:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c6c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c6f:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802c76:	00 00 00 
+  802c79:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  802c7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c7f:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  802c83:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c87:	4c 89 ee             	mov    %r13,%rsi
+  802c8a:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c8f:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  802c96:	00 00 00 
+  802c99:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	7e a3                	jle    802c42 <devfile_readmap+0x5c>
+  802c9f:	48 98                	cltq
+  802ca1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802ca5:	72 9b                	jb     802c42 <devfile_readmap+0x5c>
+        buf += read;
+  802ca7:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802caa:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802cad:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802cb1:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802cb8:	75 88                	jne    802c42 <devfile_readmap+0x5c>
+  802cba:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802cbe:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cc4:	0f 85 78 ff ff ff    	jne    802c42 <devfile_readmap+0x5c>
+  802cca:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802cd1:	0f 86 6b ff ff ff    	jbe    802c42 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802cd7:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802cdd:	4d 39 e7             	cmp    %r12,%r15
+  802ce0:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802ce4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802ceb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802cef:	0f 84 73 ff ff ff    	je     802c68 <devfile_readmap+0x82>
+  802cf5:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802cf9:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802cfe:	41 ff d6             	call   *%r14
+  802d01:	a8 40                	test   $0x40,%al
+  802d03:	0f 85 39 ff ff ff    	jne    802c42 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802d09:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d10:	4c 39 e3             	cmp    %r12,%rbx
+  802d13:	72 e4                	jb     802cf9 <devfile_readmap+0x113>
+  802d15:	e9 4e ff ff ff       	jmp    802c68 <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802d1a:	4c 89 fa             	mov    %r15,%rdx
+  802d1d:	4c 89 ee             	mov    %r13,%rsi
+  802d20:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802d24:	48 b8 67 26 80 00 00 	movabs $0x802667,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802d30:	48 85 c0             	test   %rax,%rax
+  802d33:	78 0c                	js     802d41 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802d35:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d39:	48 01 f0             	add    %rsi,%rax
+  802d3c:	e9 0e ff ff ff       	jmp    802c4f <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802d41:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d45:	48 85 f6             	test   %rsi,%rsi
+  802d48:	48 0f 45 c6          	cmovne %rsi,%rax
+  802d4c:	e9 fe fe ff ff       	jmp    802c4f <devfile_readmap+0x69>
+
+0000000000802d51 <open>:
+open(const char *path, int mode) {
+  802d51:	55                   	push   %rbp
+  802d52:	48 89 e5             	mov    %rsp,%rbp
+  802d55:	41 55                	push   %r13
+  802d57:	41 54                	push   %r12
+  802d59:	53                   	push   %rbx
+  802d5a:	48 83 ec 18          	sub    $0x18,%rsp
+  802d5e:	49 89 fc             	mov    %rdi,%r12
+  802d61:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d64:	48 b8 e7 0d 80 00 00 	movabs $0x800de7,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+  802d70:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d76:	0f 87 8a 00 00 00    	ja     802e06 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d7c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d80:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802d87:	00 00 00 
+  802d8a:	ff d0                	call   *%rax
+  802d8c:	89 c3                	mov    %eax,%ebx
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	78 50                	js     802de2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d92:	4c 89 e6             	mov    %r12,%rsi
+  802d95:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802d9c:	00 00 00 
+  802d9f:	48 89 df             	mov    %rbx,%rdi
+  802da2:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802dae:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802db5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802db9:	bf 01 00 00 00       	mov    $0x1,%edi
+  802dbe:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802dc5:	00 00 00 
+  802dc8:	ff d0                	call   *%rax
+  802dca:	89 c3                	mov    %eax,%ebx
+  802dcc:	85 c0                	test   %eax,%eax
+  802dce:	78 1f                	js     802def <open+0x9e>
+    return fd2num(fd);
+  802dd0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dd4:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  802ddb:	00 00 00 
+  802dde:	ff d0                	call   *%rax
+  802de0:	89 c3                	mov    %eax,%ebx
+}
+  802de2:	89 d8                	mov    %ebx,%eax
+  802de4:	48 83 c4 18          	add    $0x18,%rsp
+  802de8:	5b                   	pop    %rbx
+  802de9:	41 5c                	pop    %r12
+  802deb:	41 5d                	pop    %r13
+  802ded:	5d                   	pop    %rbp
+  802dee:	c3                   	ret
+        fd_close(fd, 0);
+  802def:	be 00 00 00 00       	mov    $0x0,%esi
+  802df4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df8:	48 b8 ca 19 80 00 00 	movabs $0x8019ca,%rax
+  802dff:	00 00 00 
+  802e02:	ff d0                	call   *%rax
+        return res;
+  802e04:	eb dc                	jmp    802de2 <open+0x91>
+        return -E_BAD_PATH;
+  802e06:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e0b:	eb d5                	jmp    802de2 <open+0x91>
+
+0000000000802e0d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802e0d:	55                   	push   %rbp
+  802e0e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802e11:	be 00 00 00 00       	mov    $0x0,%esi
+  802e16:	bf 13 00 00 00       	mov    $0x13,%edi
+  802e1b:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  802e22:	00 00 00 
+  802e25:	ff d0                	call   *%rax
+}
+  802e27:	5d                   	pop    %rbp
+  802e28:	c3                   	ret
+
+0000000000802e29 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e29:	55                   	push   %rbp
+  802e2a:	48 89 e5             	mov    %rsp,%rbp
+  802e2d:	41 54                	push   %r12
+  802e2f:	53                   	push   %rbx
+  802e30:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e33:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e42:	48 be 60 40 80 00 00 	movabs $0x804060,%rsi
+  802e49:	00 00 00 
+  802e4c:	48 89 df             	mov    %rbx,%rdi
+  802e4f:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e5b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e60:	41 2b 04 24          	sub    (%r12),%eax
+  802e64:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e6a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e71:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e74:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  802e7b:	00 00 00 
+  802e7e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8a:	5b                   	pop    %rbx
+  802e8b:	41 5c                	pop    %r12
+  802e8d:	5d                   	pop    %rbp
+  802e8e:	c3                   	ret
+
+0000000000802e8f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802e8f:	55                   	push   %rbp
+  802e90:	48 89 e5             	mov    %rsp,%rbp
+  802e93:	41 54                	push   %r12
+  802e95:	53                   	push   %rbx
+  802e96:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e9e:	48 89 fe             	mov    %rdi,%rsi
+  802ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea6:	49 bc 7d 15 80 00 00 	movabs $0x80157d,%r12
+  802ead:	00 00 00 
+  802eb0:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802eb3:	48 89 df             	mov    %rbx,%rdi
+  802eb6:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+  802ec2:	48 89 c6             	mov    %rax,%rsi
+  802ec5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ecf:	41 ff d4             	call   *%r12
+}
+  802ed2:	5b                   	pop    %rbx
+  802ed3:	41 5c                	pop    %r12
+  802ed5:	5d                   	pop    %rbp
+  802ed6:	c3                   	ret
+
+0000000000802ed7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ed7:	55                   	push   %rbp
+  802ed8:	48 89 e5             	mov    %rsp,%rbp
+  802edb:	41 57                	push   %r15
+  802edd:	41 56                	push   %r14
+  802edf:	41 55                	push   %r13
+  802ee1:	41 54                	push   %r12
+  802ee3:	53                   	push   %rbx
+  802ee4:	48 83 ec 18          	sub    $0x18,%rsp
+  802ee8:	49 89 fc             	mov    %rdi,%r12
+  802eeb:	49 89 f5             	mov    %rsi,%r13
+  802eee:	49 89 d7             	mov    %rdx,%r15
+  802ef1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ef5:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802f01:	4d 85 ff             	test   %r15,%r15
+  802f04:	0f 84 af 00 00 00    	je     802fb9 <devpipe_write+0xe2>
+  802f0a:	48 89 c3             	mov    %rax,%rbx
+  802f0d:	4c 89 f8             	mov    %r15,%rax
+  802f10:	4d 89 ef             	mov    %r13,%r15
+  802f13:	4c 01 e8             	add    %r13,%rax
+  802f16:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f1a:	49 bd 85 14 80 00 00 	movabs $0x801485,%r13
+  802f21:	00 00 00 
+            sys_yield();
+  802f24:	49 be 22 14 80 00 00 	movabs $0x801422,%r14
+  802f2b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f2e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f31:	48 63 ce             	movslq %esi,%rcx
+  802f34:	48 63 03             	movslq (%rbx),%rax
+  802f37:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f3d:	48 39 c1             	cmp    %rax,%rcx
+  802f40:	72 2e                	jb     802f70 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f42:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f47:	48 89 da             	mov    %rbx,%rdx
+  802f4a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f4f:	4c 89 e7             	mov    %r12,%rdi
+  802f52:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	74 66                	je     802fbf <devpipe_write+0xe8>
+            sys_yield();
+  802f59:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f5c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f5f:	48 63 ce             	movslq %esi,%rcx
+  802f62:	48 63 03             	movslq (%rbx),%rax
+  802f65:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f6b:	48 39 c1             	cmp    %rax,%rcx
+  802f6e:	73 d2                	jae    802f42 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f70:	41 0f b6 3f          	movzbl (%r15),%edi
+  802f74:	48 89 ca             	mov    %rcx,%rdx
+  802f77:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f7b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f82:	08 10 20 
+  802f85:	48 f7 e2             	mul    %rdx
+  802f88:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f8c:	48 89 d0             	mov    %rdx,%rax
+  802f8f:	48 c1 e0 09          	shl    $0x9,%rax
+  802f93:	48 29 d0             	sub    %rdx,%rax
+  802f96:	48 c1 e0 03          	shl    $0x3,%rax
+  802f9a:	48 29 c1             	sub    %rax,%rcx
+  802f9d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802fa2:	83 c6 01             	add    $0x1,%esi
+  802fa5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802fa8:	49 83 c7 01          	add    $0x1,%r15
+  802fac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fb0:	49 39 c7             	cmp    %rax,%r15
+  802fb3:	0f 85 75 ff ff ff    	jne    802f2e <devpipe_write+0x57>
+    return n;
+  802fb9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802fbd:	eb 05                	jmp    802fc4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fc4:	48 83 c4 18          	add    $0x18,%rsp
+  802fc8:	5b                   	pop    %rbx
+  802fc9:	41 5c                	pop    %r12
+  802fcb:	41 5d                	pop    %r13
+  802fcd:	41 5e                	pop    %r14
+  802fcf:	41 5f                	pop    %r15
+  802fd1:	5d                   	pop    %rbp
+  802fd2:	c3                   	ret
+
+0000000000802fd3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fd3:	55                   	push   %rbp
+  802fd4:	48 89 e5             	mov    %rsp,%rbp
+  802fd7:	41 57                	push   %r15
+  802fd9:	41 56                	push   %r14
+  802fdb:	41 55                	push   %r13
+  802fdd:	41 54                	push   %r12
+  802fdf:	53                   	push   %rbx
+  802fe0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe4:	49 89 fc             	mov    %rdi,%r12
+  802fe7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802feb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fef:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+  802ffb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802ffe:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803004:	49 bd 85 14 80 00 00 	movabs $0x801485,%r13
+  80300b:	00 00 00 
+            sys_yield();
+  80300e:	49 be 22 14 80 00 00 	movabs $0x801422,%r14
+  803015:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803018:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80301d:	74 7d                	je     80309c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80301f:	8b 03                	mov    (%rbx),%eax
+  803021:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803024:	75 26                	jne    80304c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803026:	4d 85 ff             	test   %r15,%r15
+  803029:	75 77                	jne    8030a2 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80302b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803030:	48 89 da             	mov    %rbx,%rdx
+  803033:	be 00 10 00 00       	mov    $0x1000,%esi
+  803038:	4c 89 e7             	mov    %r12,%rdi
+  80303b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80303e:	85 c0                	test   %eax,%eax
+  803040:	74 72                	je     8030b4 <devpipe_read+0xe1>
+            sys_yield();
+  803042:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803045:	8b 03                	mov    (%rbx),%eax
+  803047:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80304a:	74 df                	je     80302b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80304c:	48 63 c8             	movslq %eax,%rcx
+  80304f:	48 89 ca             	mov    %rcx,%rdx
+  803052:	48 c1 ea 03          	shr    $0x3,%rdx
+  803056:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80305d:	08 10 20 
+  803060:	48 89 d0             	mov    %rdx,%rax
+  803063:	48 f7 e6             	mul    %rsi
+  803066:	48 c1 ea 06          	shr    $0x6,%rdx
+  80306a:	48 89 d0             	mov    %rdx,%rax
+  80306d:	48 c1 e0 09          	shl    $0x9,%rax
+  803071:	48 29 d0             	sub    %rdx,%rax
+  803074:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80307b:	00 
+  80307c:	48 89 c8             	mov    %rcx,%rax
+  80307f:	48 29 d0             	sub    %rdx,%rax
+  803082:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803087:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80308b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80308f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803092:	49 83 c7 01          	add    $0x1,%r15
+  803096:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80309a:	75 83                	jne    80301f <devpipe_read+0x4c>
+    return n;
+  80309c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030a0:	eb 03                	jmp    8030a5 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8030a2:	4c 89 f8             	mov    %r15,%rax
+}
+  8030a5:	48 83 c4 18          	add    $0x18,%rsp
+  8030a9:	5b                   	pop    %rbx
+  8030aa:	41 5c                	pop    %r12
+  8030ac:	41 5d                	pop    %r13
+  8030ae:	41 5e                	pop    %r14
+  8030b0:	41 5f                	pop    %r15
+  8030b2:	5d                   	pop    %rbp
+  8030b3:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8030b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b9:	eb ea                	jmp    8030a5 <devpipe_read+0xd2>
+
+00000000008030bb <pipe>:
+pipe(int pfd[2]) {
+  8030bb:	55                   	push   %rbp
+  8030bc:	48 89 e5             	mov    %rsp,%rbp
+  8030bf:	41 55                	push   %r13
+  8030c1:	41 54                	push   %r12
+  8030c3:	53                   	push   %rbx
+  8030c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030cb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030cf:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 c3                	mov    %eax,%ebx
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 88 a0 01 00 00    	js     803285 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8030e5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ef:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f8:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  8030ff:	00 00 00 
+  803102:	ff d0                	call   *%rax
+  803104:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803106:	85 c0                	test   %eax,%eax
+  803108:	0f 88 77 01 00 00    	js     803285 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80310e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803112:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  803119:	00 00 00 
+  80311c:	ff d0                	call   *%rax
+  80311e:	89 c3                	mov    %eax,%ebx
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 88 43 01 00 00    	js     80326b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803128:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80312d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803132:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803136:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313b:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  803142:	00 00 00 
+  803145:	ff d0                	call   *%rax
+  803147:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803149:	85 c0                	test   %eax,%eax
+  80314b:	0f 88 1a 01 00 00    	js     80326b <pipe+0x1b0>
+    va = fd2data(fd0);
+  803151:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803155:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+  803161:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803164:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803169:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80316e:	48 89 c6             	mov    %rax,%rsi
+  803171:	bf 00 00 00 00       	mov    $0x0,%edi
+  803176:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	89 c3                	mov    %eax,%ebx
+  803184:	85 c0                	test   %eax,%eax
+  803186:	0f 88 c5 00 00 00    	js     803251 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80318c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803190:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+  80319c:	48 89 c1             	mov    %rax,%rcx
+  80319f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8031a5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8031ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b0:	4c 89 ee             	mov    %r13,%rsi
+  8031b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031b8:	48 b8 18 15 80 00 00 	movabs $0x801518,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+  8031c4:	89 c3                	mov    %eax,%ebx
+  8031c6:	85 c0                	test   %eax,%eax
+  8031c8:	78 6e                	js     803238 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031ca:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031cf:	4c 89 ef             	mov    %r13,%rdi
+  8031d2:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  8031d9:	00 00 00 
+  8031dc:	ff d0                	call   *%rax
+  8031de:	83 f8 02             	cmp    $0x2,%eax
+  8031e1:	0f 85 ab 00 00 00    	jne    803292 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031e7:	a1 c0 50 80 00 00 00 	movabs 0x8050c0,%eax
+  8031ee:	00 00 
+  8031f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031f4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031fa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803201:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803205:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803207:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80320b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803212:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803216:	48 bb 81 18 80 00 00 	movabs $0x801881,%rbx
+  80321d:	00 00 00 
+  803220:	ff d3                	call   *%rbx
+  803222:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803226:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80322a:	ff d3                	call   *%rbx
+  80322c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803236:	eb 4d                	jmp    803285 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803238:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80323d:	4c 89 ee             	mov    %r13,%rsi
+  803240:	bf 00 00 00 00       	mov    $0x0,%edi
+  803245:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803251:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803256:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80325a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325f:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80326b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803270:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803274:	bf 00 00 00 00       	mov    $0x0,%edi
+  803279:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+}
+  803285:	89 d8                	mov    %ebx,%eax
+  803287:	48 83 c4 18          	add    $0x18,%rsp
+  80328b:	5b                   	pop    %rbx
+  80328c:	41 5c                	pop    %r12
+  80328e:	41 5d                	pop    %r13
+  803290:	5d                   	pop    %rbp
+  803291:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803292:	48 b9 90 40 80 00 00 	movabs $0x804090,%rcx
+  803299:	00 00 00 
+  80329c:	48 ba 67 40 80 00 00 	movabs $0x804067,%rdx
+  8032a3:	00 00 00 
+  8032a6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8032ab:	48 bf 7c 40 80 00 00 	movabs $0x80407c,%rdi
+  8032b2:	00 00 00 
+  8032b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ba:	49 b8 44 37 80 00 00 	movabs $0x803744,%r8
+  8032c1:	00 00 00 
+  8032c4:	41 ff d0             	call   *%r8
+
+00000000008032c7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032c7:	55                   	push   %rbp
+  8032c8:	48 89 e5             	mov    %rsp,%rbp
+  8032cb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032cf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032d3:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  8032da:	00 00 00 
+  8032dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	78 35                	js     803318 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032e3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032e7:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+  8032f3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  803300:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803304:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+  803310:	85 c0                	test   %eax,%eax
+  803312:	0f 94 c0             	sete   %al
+  803315:	0f b6 c0             	movzbl %al,%eax
+}
+  803318:	c9                   	leave
+  803319:	c3                   	ret
+
+000000000080331a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80331a:	48 89 f8             	mov    %rdi,%rax
+  80331d:	48 c1 e8 27          	shr    $0x27,%rax
+  803321:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803328:	01 00 00 
+  80332b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80332f:	f6 c2 01             	test   $0x1,%dl
+  803332:	74 6d                	je     8033a1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803334:	48 89 f8             	mov    %rdi,%rax
+  803337:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80333b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803342:	01 00 00 
+  803345:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803349:	f6 c2 01             	test   $0x1,%dl
+  80334c:	74 62                	je     8033b0 <get_uvpt_entry+0x96>
+  80334e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803355:	01 00 00 
+  803358:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80335c:	f6 c2 80             	test   $0x80,%dl
+  80335f:	75 4f                	jne    8033b0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803361:	48 89 f8             	mov    %rdi,%rax
+  803364:	48 c1 e8 15          	shr    $0x15,%rax
+  803368:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80336f:	01 00 00 
+  803372:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803376:	f6 c2 01             	test   $0x1,%dl
+  803379:	74 44                	je     8033bf <get_uvpt_entry+0xa5>
+  80337b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803382:	01 00 00 
+  803385:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803389:	f6 c2 80             	test   $0x80,%dl
+  80338c:	75 31                	jne    8033bf <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80338e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803392:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803399:	01 00 00 
+  80339c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8033a0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033a1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8033a8:	01 00 00 
+  8033ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033af:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033b0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8033b7:	01 00 00 
+  8033ba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033be:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033bf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8033c6:	01 00 00 
+  8033c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033cd:	c3                   	ret
+
+00000000008033ce <get_prot>:
+
+int
+get_prot(void *va) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033d2:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  8033d9:	00 00 00 
+  8033dc:	ff d0                	call   *%rax
+  8033de:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8033e1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8033e6:	89 c1                	mov    %eax,%ecx
+  8033e8:	83 c9 04             	or     $0x4,%ecx
+  8033eb:	f6 c2 01             	test   $0x1,%dl
+  8033ee:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8033f1:	89 c1                	mov    %eax,%ecx
+  8033f3:	83 c9 02             	or     $0x2,%ecx
+  8033f6:	f6 c2 02             	test   $0x2,%dl
+  8033f9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8033fc:	89 c1                	mov    %eax,%ecx
+  8033fe:	83 c9 01             	or     $0x1,%ecx
+  803401:	48 85 d2             	test   %rdx,%rdx
+  803404:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803407:	89 c1                	mov    %eax,%ecx
+  803409:	83 c9 40             	or     $0x40,%ecx
+  80340c:	f6 c6 04             	test   $0x4,%dh
+  80340f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803412:	5d                   	pop    %rbp
+  803413:	c3                   	ret
+
+0000000000803414 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803414:	55                   	push   %rbp
+  803415:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803418:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803424:	48 c1 e8 06          	shr    $0x6,%rax
+  803428:	83 e0 01             	and    $0x1,%eax
+}
+  80342b:	5d                   	pop    %rbp
+  80342c:	c3                   	ret
+
+000000000080342d <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  80342d:	55                   	push   %rbp
+  80342e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803431:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  80343d:	48 c1 e8 05          	shr    $0x5,%rax
+  803441:	83 e0 01             	and    $0x1,%eax
+}
+  803444:	5d                   	pop    %rbp
+  803445:	c3                   	ret
+
+0000000000803446 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803446:	55                   	push   %rbp
+  803447:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80344a:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+  803456:	83 e0 01             	and    $0x1,%eax
+}
+  803459:	5d                   	pop    %rbp
+  80345a:	c3                   	ret
+
+000000000080345b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	41 57                	push   %r15
+  803461:	41 56                	push   %r14
+  803463:	41 55                	push   %r13
+  803465:	41 54                	push   %r12
+  803467:	53                   	push   %rbx
+  803468:	48 83 ec 18          	sub    $0x18,%rsp
+  80346c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803470:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  803474:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  803479:	49 bd 46 34 80 00 00 	movabs $0x803446,%r13
+  803480:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803483:	49 bf ce 33 80 00 00 	movabs $0x8033ce,%r15
+  80348a:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  80348d:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  803494:	00 00 00 
+  803497:	eb 0c                	jmp    8034a5 <foreach_shared_region+0x4a>
+  803499:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8034a0:	4c 39 f3             	cmp    %r14,%rbx
+  8034a3:	74 2e                	je     8034d3 <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  8034a5:	48 89 df             	mov    %rbx,%rdi
+  8034a8:	41 ff d5             	call   *%r13
+  8034ab:	84 c0                	test   %al,%al
+  8034ad:	74 ea                	je     803499 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8034af:	48 89 df             	mov    %rbx,%rdi
+  8034b2:	41 ff d7             	call   *%r15
+  8034b5:	a8 40                	test   $0x40,%al
+  8034b7:	74 e0                	je     803499 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  8034b9:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8034c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034c4:	48 89 df             	mov    %rbx,%rdi
+  8034c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034cb:	ff d0                	call   *%rax
+				if (res < 0) {
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	79 c8                	jns    803499 <foreach_shared_region+0x3e>
+  8034d1:	eb 05                	jmp    8034d8 <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d8:	48 83 c4 18          	add    $0x18,%rsp
+  8034dc:	5b                   	pop    %rbx
+  8034dd:	41 5c                	pop    %r12
+  8034df:	41 5d                	pop    %r13
+  8034e1:	41 5e                	pop    %r14
+  8034e3:	41 5f                	pop    %r15
+  8034e5:	5d                   	pop    %rbp
+  8034e6:	c3                   	ret
+
+00000000008034e7 <vsys_gettime>:
+
+static inline uint64_t
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= VSYS_gettime && num < NVSYSCALLS) {
+        return vsys[num];
+  8034e7:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  8034ee:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  8034f0:	c3                   	ret
+
+00000000008034f1 <vsys_irqs>:
+
+int
+vsys_irqs(uint8_t irq) {
+    return vsyscall(VSYS_irqs + irq);
+  8034f1:	40 0f b6 ff          	movzbl %dil,%edi
+  8034f5:	83 c7 01             	add    $0x1,%edi
+    return -E_INVAL;
+  8034f8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+    if (num >= VSYS_gettime && num < NVSYSCALLS) {
+  8034ff:	83 ff 10             	cmp    $0x10,%edi
+  803502:	76 01                	jbe    803505 <vsys_irqs+0x14>
+}
+  803504:	c3                   	ret
+        return vsys[num];
+  803505:	48 63 ff             	movslq %edi,%rdi
+  803508:	48 b8 00 f0 bf 1f 80 	movabs $0x801fbff000,%rax
+  80350f:	00 00 00 
+  803512:	8b 04 b8             	mov    (%rax,%rdi,4),%eax
+  803515:	48 98                	cltq
+  803517:	eb eb                	jmp    803504 <vsys_irqs+0x13>
+
+0000000000803519 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351e:	c3                   	ret
+
+000000000080351f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80351f:	55                   	push   %rbp
+  803520:	48 89 e5             	mov    %rsp,%rbp
+  803523:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803526:	48 be b4 40 80 00 00 	movabs $0x8040b4,%rsi
+  80352d:	00 00 00 
+  803530:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+    return 0;
+}
+  80353c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803541:	5d                   	pop    %rbp
+  803542:	c3                   	ret
+
+0000000000803543 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803543:	55                   	push   %rbp
+  803544:	48 89 e5             	mov    %rsp,%rbp
+  803547:	41 57                	push   %r15
+  803549:	41 56                	push   %r14
+  80354b:	41 55                	push   %r13
+  80354d:	41 54                	push   %r12
+  80354f:	53                   	push   %rbx
+  803550:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803557:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80355e:	48 85 d2             	test   %rdx,%rdx
+  803561:	74 7a                	je     8035dd <devcons_write+0x9a>
+  803563:	49 89 d6             	mov    %rdx,%r14
+  803566:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80356c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803571:	49 bf 1f 10 80 00 00 	movabs $0x80101f,%r15
+  803578:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80357b:	4c 89 f3             	mov    %r14,%rbx
+  80357e:	48 29 f3             	sub    %rsi,%rbx
+  803581:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803586:	48 39 c3             	cmp    %rax,%rbx
+  803589:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80358d:	4c 63 eb             	movslq %ebx,%r13
+  803590:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803597:	48 01 c6             	add    %rax,%rsi
+  80359a:	4c 89 ea             	mov    %r13,%rdx
+  80359d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8035a4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8035a7:	4c 89 ee             	mov    %r13,%rsi
+  8035aa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8035b1:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  8035b8:	00 00 00 
+  8035bb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8035bd:	41 01 dc             	add    %ebx,%r12d
+  8035c0:	49 63 f4             	movslq %r12d,%rsi
+  8035c3:	4c 39 f6             	cmp    %r14,%rsi
+  8035c6:	72 b3                	jb     80357b <devcons_write+0x38>
+    return res;
+  8035c8:	49 63 c4             	movslq %r12d,%rax
+}
+  8035cb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8035d2:	5b                   	pop    %rbx
+  8035d3:	41 5c                	pop    %r12
+  8035d5:	41 5d                	pop    %r13
+  8035d7:	41 5e                	pop    %r14
+  8035d9:	41 5f                	pop    %r15
+  8035db:	5d                   	pop    %rbp
+  8035dc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8035dd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035e3:	eb e3                	jmp    8035c8 <devcons_write+0x85>
+
+00000000008035e5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8035e5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8035e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ed:	48 85 c0             	test   %rax,%rax
+  8035f0:	74 55                	je     803647 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8035f2:	55                   	push   %rbp
+  8035f3:	48 89 e5             	mov    %rsp,%rbp
+  8035f6:	41 55                	push   %r13
+  8035f8:	41 54                	push   %r12
+  8035fa:	53                   	push   %rbx
+  8035fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ff:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803602:	48 bb 55 13 80 00 00 	movabs $0x801355,%rbx
+  803609:	00 00 00 
+  80360c:	49 bc 22 14 80 00 00 	movabs $0x801422,%r12
+  803613:	00 00 00 
+  803616:	eb 03                	jmp    80361b <devcons_read+0x36>
+  803618:	41 ff d4             	call   *%r12
+  80361b:	ff d3                	call   *%rbx
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	74 f7                	je     803618 <devcons_read+0x33>
+    if (c < 0) return c;
+  803621:	48 63 d0             	movslq %eax,%rdx
+  803624:	78 13                	js     803639 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80362b:	83 f8 04             	cmp    $0x4,%eax
+  80362e:	74 09                	je     803639 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803630:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803634:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803639:	48 89 d0             	mov    %rdx,%rax
+  80363c:	48 83 c4 08          	add    $0x8,%rsp
+  803640:	5b                   	pop    %rbx
+  803641:	41 5c                	pop    %r12
+  803643:	41 5d                	pop    %r13
+  803645:	5d                   	pop    %rbp
+  803646:	c3                   	ret
+  803647:	48 89 d0             	mov    %rdx,%rax
+  80364a:	c3                   	ret
+
+000000000080364b <cputchar>:
+cputchar(int ch) {
+  80364b:	55                   	push   %rbp
+  80364c:	48 89 e5             	mov    %rsp,%rbp
+  80364f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803653:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803657:	be 01 00 00 00       	mov    $0x1,%esi
+  80365c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803660:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+}
+  80366c:	c9                   	leave
+  80366d:	c3                   	ret
+
+000000000080366e <getchar>:
+getchar(void) {
+  80366e:	55                   	push   %rbp
+  80366f:	48 89 e5             	mov    %rsp,%rbp
+  803672:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803676:	ba 01 00 00 00       	mov    $0x1,%edx
+  80367b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80367f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803684:	48 b8 f2 1b 80 00 00 	movabs $0x801bf2,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+  803690:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803692:	85 c0                	test   %eax,%eax
+  803694:	78 06                	js     80369c <getchar+0x2e>
+  803696:	74 08                	je     8036a0 <getchar+0x32>
+  803698:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80369c:	89 d0                	mov    %edx,%eax
+  80369e:	c9                   	leave
+  80369f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8036a0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8036a5:	eb f5                	jmp    80369c <getchar+0x2e>
+
+00000000008036a7 <iscons>:
+iscons(int fdnum) {
+  8036a7:	55                   	push   %rbp
+  8036a8:	48 89 e5             	mov    %rsp,%rbp
+  8036ab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8036af:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036b3:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036bf:	85 c0                	test   %eax,%eax
+  8036c1:	78 18                	js     8036db <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8036c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036c7:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8036ce:	00 00 00 
+  8036d1:	8b 00                	mov    (%rax),%eax
+  8036d3:	39 02                	cmp    %eax,(%rdx)
+  8036d5:	0f 94 c0             	sete   %al
+  8036d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8036db:	c9                   	leave
+  8036dc:	c3                   	ret
+
+00000000008036dd <opencons>:
+opencons(void) {
+  8036dd:	55                   	push   %rbp
+  8036de:	48 89 e5             	mov    %rsp,%rbp
+  8036e1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8036e5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8036e9:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8036f0:	00 00 00 
+  8036f3:	ff d0                	call   *%rax
+  8036f5:	85 c0                	test   %eax,%eax
+  8036f7:	78 49                	js     803742 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8036f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803703:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803707:	bf 00 00 00 00       	mov    $0x0,%edi
+  80370c:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  803713:	00 00 00 
+  803716:	ff d0                	call   *%rax
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	78 26                	js     803742 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80371c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803720:	a1 60 51 80 00 00 00 	movabs 0x805160,%eax
+  803727:	00 00 
+  803729:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80372b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80372f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803736:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  80373d:	00 00 00 
+  803740:	ff d0                	call   *%rax
+}
+  803742:	c9                   	leave
+  803743:	c3                   	ret
+
+0000000000803744 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803744:	55                   	push   %rbp
+  803745:	48 89 e5             	mov    %rsp,%rbp
+  803748:	41 56                	push   %r14
+  80374a:	41 55                	push   %r13
+  80374c:	41 54                	push   %r12
+  80374e:	53                   	push   %rbx
+  80374f:	48 83 ec 50          	sub    $0x50,%rsp
+  803753:	49 89 fc             	mov    %rdi,%r12
+  803756:	41 89 f5             	mov    %esi,%r13d
+  803759:	48 89 d3             	mov    %rdx,%rbx
+  80375c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803760:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803764:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803768:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80376f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803773:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803777:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80377b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80377f:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803786:	00 00 00 
+  803789:	4c 8b 30             	mov    (%rax),%r14
+  80378c:	48 b8 f1 13 80 00 00 	movabs $0x8013f1,%rax
+  803793:	00 00 00 
+  803796:	ff d0                	call   *%rax
+  803798:	89 c6                	mov    %eax,%esi
+  80379a:	45 89 e8             	mov    %r13d,%r8d
+  80379d:	4c 89 e1             	mov    %r12,%rcx
+  8037a0:	4c 89 f2             	mov    %r14,%rdx
+  8037a3:	48 bf c0 40 80 00 00 	movabs $0x8040c0,%rdi
+  8037aa:	00 00 00 
+  8037ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b2:	49 bc 00 05 80 00 00 	movabs $0x800500,%r12
+  8037b9:	00 00 00 
+  8037bc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8037bf:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8037c3:	48 89 df             	mov    %rbx,%rdi
+  8037c6:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  8037cd:	00 00 00 
+  8037d0:	ff d0                	call   *%rax
+    cprintf("\n");
+  8037d2:	48 bf 13 40 80 00 00 	movabs $0x804013,%rdi
+  8037d9:	00 00 00 
+  8037dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8037e4:	cc                   	int3
+  8037e5:	eb fd                	jmp    8037e4 <_panic+0xa0>
+
+00000000008037e7 <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  8037e7:	55                   	push   %rbp
+  8037e8:	48 89 e5             	mov    %rsp,%rbp
+  8037eb:	41 55                	push   %r13
+  8037ed:	41 54                	push   %r12
+  8037ef:	53                   	push   %rbx
+  8037f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8037f4:	49 89 fc             	mov    %rdi,%r12
+  8037f7:	48 89 f7             	mov    %rsi,%rdi
+  8037fa:	48 89 d3             	mov    %rdx,%rbx
+  8037fd:	49 89 cd             	mov    %rcx,%r13
+  803800:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803803:	48 85 f6             	test   %rsi,%rsi
+  803806:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80380d:	00 00 00 
+  803810:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803814:	be 00 10 00 00       	mov    $0x1000,%esi
+  803819:	48 85 db             	test   %rbx,%rbx
+  80381c:	74 03                	je     803821 <ipc_recv_timed+0x3a>
+  80381e:	48 8b 33             	mov    (%rbx),%rsi
+  803821:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	78 75                	js     8038a6 <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803831:	4d 85 e4             	test   %r12,%r12
+  803834:	74 14                	je     80384a <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  803836:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80383d:	00 00 00 
+  803840:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  803846:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80384a:	4d 85 ed             	test   %r13,%r13
+  80384d:	74 14                	je     803863 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  80384f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803856:	00 00 00 
+  803859:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  80385f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803863:	48 85 db             	test   %rbx,%rbx
+  803866:	74 23                	je     80388b <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  803868:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80386f:	00 00 00 
+  803872:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  803878:	ba 00 00 00 00       	mov    $0x0,%edx
+  80387d:	85 c9                	test   %ecx,%ecx
+  80387f:	74 07                	je     803888 <ipc_recv_timed+0xa1>
+  803881:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  803888:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80388b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803892:	00 00 00 
+  803895:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  80389b:	48 83 c4 08          	add    $0x8,%rsp
+  80389f:	5b                   	pop    %rbx
+  8038a0:	41 5c                	pop    %r12
+  8038a2:	41 5d                	pop    %r13
+  8038a4:	5d                   	pop    %rbp
+  8038a5:	c3                   	ret
+        if (from_env_store != NULL) {
+  8038a6:	4d 85 e4             	test   %r12,%r12
+  8038a9:	74 08                	je     8038b3 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8038ab:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038b2:	00 
+        if (perm_store != NULL) {
+  8038b3:	4d 85 ed             	test   %r13,%r13
+  8038b6:	74 08                	je     8038c0 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8038b8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8038bf:	00 
+        if (size != NULL) {
+  8038c0:	48 85 db             	test   %rbx,%rbx
+  8038c3:	74 d6                	je     80389b <ipc_recv_timed+0xb4>
+            *size = 0;
+  8038c5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8038cc:	eb cd                	jmp    80389b <ipc_recv_timed+0xb4>
+
+00000000008038ce <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8038ce:	55                   	push   %rbp
+  8038cf:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  8038d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8038d8:	48 b8 e7 37 80 00 00 	movabs $0x8037e7,%rax
+  8038df:	00 00 00 
+  8038e2:	ff d0                	call   *%rax
+}
+  8038e4:	5d                   	pop    %rbp
+  8038e5:	c3                   	ret
+
+00000000008038e6 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8038e6:	55                   	push   %rbp
+  8038e7:	48 89 e5             	mov    %rsp,%rbp
+  8038ea:	41 57                	push   %r15
+  8038ec:	41 56                	push   %r14
+  8038ee:	41 55                	push   %r13
+  8038f0:	41 54                	push   %r12
+  8038f2:	53                   	push   %rbx
+  8038f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8038f7:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8038fa:	48 89 d3             	mov    %rdx,%rbx
+  8038fd:	49 89 cc             	mov    %rcx,%r12
+  803900:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803903:	48 85 d2             	test   %rdx,%rdx
+  803906:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80390d:	00 00 00 
+  803910:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803914:	89 f0                	mov    %esi,%eax
+  803916:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80391a:	48 89 da             	mov    %rbx,%rdx
+  80391d:	48 89 c6             	mov    %rax,%rsi
+  803920:	48 b8 1f 17 80 00 00 	movabs $0x80171f,%rax
+  803927:	00 00 00 
+  80392a:	ff d0                	call   *%rax
+    while (res < 0) {
+  80392c:	85 c0                	test   %eax,%eax
+  80392e:	79 65                	jns    803995 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803930:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803933:	75 33                	jne    803968 <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  803935:	49 bf 22 14 80 00 00 	movabs $0x801422,%r15
+  80393c:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80393f:	49 be 1f 17 80 00 00 	movabs $0x80171f,%r14
+  803946:	00 00 00 
+        sys_yield();
+  803949:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80394c:	45 89 e8             	mov    %r13d,%r8d
+  80394f:	4c 89 e1             	mov    %r12,%rcx
+  803952:	48 89 da             	mov    %rbx,%rdx
+  803955:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803959:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80395c:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  80395f:	85 c0                	test   %eax,%eax
+  803961:	79 32                	jns    803995 <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803963:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803966:	74 e1                	je     803949 <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  803968:	89 c1                	mov    %eax,%ecx
+  80396a:	48 ba e3 40 80 00 00 	movabs $0x8040e3,%rdx
+  803971:	00 00 00 
+  803974:	be 52 00 00 00       	mov    $0x52,%esi
+  803979:	48 bf f7 40 80 00 00 	movabs $0x8040f7,%rdi
+  803980:	00 00 00 
+  803983:	b8 00 00 00 00       	mov    $0x0,%eax
+  803988:	49 b8 44 37 80 00 00 	movabs $0x803744,%r8
+  80398f:	00 00 00 
+  803992:	41 ff d0             	call   *%r8
+    }
+}
+  803995:	48 83 c4 18          	add    $0x18,%rsp
+  803999:	5b                   	pop    %rbx
+  80399a:	41 5c                	pop    %r12
+  80399c:	41 5d                	pop    %r13
+  80399e:	41 5e                	pop    %r14
+  8039a0:	41 5f                	pop    %r15
+  8039a2:	5d                   	pop    %rbp
+  8039a3:	c3                   	ret
+
+00000000008039a4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8039a4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8039a9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8039b0:	00 00 00 
+  8039b3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039b7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039bb:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039bf:	48 01 ca             	add    %rcx,%rdx
+  8039c2:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8039c8:	39 fa                	cmp    %edi,%edx
+  8039ca:	74 12                	je     8039de <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  8039cc:	48 83 c0 01          	add    $0x1,%rax
+  8039d0:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8039d6:	75 db                	jne    8039b3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8039d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039dd:	c3                   	ret
+            return envs[i].env_id;
+  8039de:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8039e2:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8039e6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039ea:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8039f1:	00 00 00 
+  8039f4:	48 01 d0             	add    %rdx,%rax
+  8039f7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8039fd:	c3                   	ret
+  8039fe:	66 90                	xchg   %ax,%ax
+
+0000000000803a00 <__rodata_start>:
+  803a00:	25 30 34 64 2d       	and    $0x2d643430,%eax
+  803a05:	25 30 32 64 2d       	and    $0x2d643230,%eax
+  803a0a:	25 30 32 64 20       	and    $0x20643230,%eax
+  803a0f:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  803a14:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  803a19:	25 30 32 64 00       	and    $0x643230,%eax
+  803a1e:	56                   	push   %rsi
+  803a1f:	44                   	rex.R
+  803a20:	41 54                	push   %r12
+  803a22:	45 3a 20             	cmp    (%r8),%r12b
+  803a25:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  803a2a:	75 6e                	jne    803a9a <__rodata_start+0x9a>
+  803a2c:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803a30:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a31:	3e 00 30             	ds add %dh,(%rax)
+  803a34:	31 32                	xor    %esi,(%rdx)
+  803a36:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a3d:	41                   	rex.B
+  803a3e:	42                   	rex.X
+  803a3f:	43                   	rex.XB
+  803a40:	44                   	rex.R
+  803a41:	45                   	rex.RB
+  803a42:	46 00 30             	rex.RX add %r14b,(%rax)
+  803a45:	31 32                	xor    %esi,(%rdx)
+  803a47:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a4e:	61                   	(bad)
+  803a4f:	62 63 64 65 66       	(bad)
+  803a54:	00 28                	add    %ch,(%rax)
+  803a56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a57:	75 6c                	jne    803ac5 <__rodata_start+0xc5>
+  803a59:	6c                   	insb   (%dx),%es:(%rdi)
+  803a5a:	29 00                	sub    %eax,(%rax)
+  803a5c:	65 72 72             	gs jb  803ad1 <__rodata_start+0xd1>
+  803a5f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a60:	72 20                	jb     803a82 <__rodata_start+0x82>
+  803a62:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803a67:	73 70                	jae    803ad9 <__rodata_start+0xd9>
+  803a69:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803a6d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803a74:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a75:	72 00                	jb     803a77 <__rodata_start+0x77>
+  803a77:	62 61 64 20 65       	(bad)
+  803a7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a7d:	76 69                	jbe    803ae8 <__rodata_start+0xe8>
+  803a7f:	72 6f                	jb     803af0 <__rodata_start+0xf0>
+  803a81:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a82:	6d                   	insl   (%dx),%es:(%rdi)
+  803a83:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a85:	74 00                	je     803a87 <__rodata_start+0x87>
+  803a87:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803a8e:	20 70 61             	and    %dh,0x61(%rax)
+  803a91:	72 61                	jb     803af4 <__rodata_start+0xf4>
+  803a93:	6d                   	insl   (%dx),%es:(%rdi)
+  803a94:	65 74 65             	gs je  803afc <__rodata_start+0xfc>
+  803a97:	72 00                	jb     803a99 <__rodata_start+0x99>
+  803a99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a9a:	75 74                	jne    803b10 <__rodata_start+0x110>
+  803a9c:	20 6f 66             	and    %ch,0x66(%rdi)
+  803a9f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803aa2:	6d                   	insl   (%dx),%es:(%rdi)
+  803aa3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aa4:	72 79                	jb     803b1f <__rodata_start+0x11f>
+  803aa6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803aa9:	74 20                	je     803acb <__rodata_start+0xcb>
+  803aab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aac:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803ab0:	76 69                	jbe    803b1b <__rodata_start+0x11b>
+  803ab2:	72 6f                	jb     803b23 <__rodata_start+0x123>
+  803ab4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ab5:	6d                   	insl   (%dx),%es:(%rdi)
+  803ab6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ab8:	74 73                	je     803b2d <__rodata_start+0x12d>
+  803aba:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803abd:	72 72                	jb     803b31 <__rodata_start+0x131>
+  803abf:	75 70                	jne    803b31 <__rodata_start+0x131>
+  803ac1:	74 65                	je     803b28 <__rodata_start+0x128>
+  803ac3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803ac8:	75 67                	jne    803b31 <__rodata_start+0x131>
+  803aca:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803acd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803acf:	00 73 65             	add    %dh,0x65(%rbx)
+  803ad2:	67 6d                	insl   (%dx),%es:(%edi)
+  803ad4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ad6:	74 61                	je     803b39 <__rodata_start+0x139>
+  803ad8:	74 69                	je     803b43 <__rodata_start+0x143>
+  803ada:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803adb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803adc:	20 66 61             	and    %ah,0x61(%rsi)
+  803adf:	75 6c                	jne    803b4d <__rodata_start+0x14d>
+  803ae1:	74 00                	je     803ae3 <__rodata_start+0xe3>
+  803ae3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803aea:	20 45 4c             	and    %al,0x4c(%rbp)
+  803aed:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803af1:	61                   	(bad)
+  803af2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803af7:	20 73 75             	and    %dh,0x75(%rbx)
+  803afa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803afd:	73 79                	jae    803b78 <__rodata_start+0x178>
+  803aff:	73 74                	jae    803b75 <__rodata_start+0x175>
+  803b01:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b03:	20 63 61             	and    %ah,0x61(%rbx)
+  803b06:	6c                   	insb   (%dx),%es:(%rdi)
+  803b07:	6c                   	insb   (%dx),%es:(%rdi)
+  803b08:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803b0b:	74 72                	je     803b7f <__rodata_start+0x17f>
+  803b0d:	79 20                	jns    803b2f <__rodata_start+0x12f>
+  803b0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b11:	74 20                	je     803b33 <__rodata_start+0x133>
+  803b13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b15:	75 6e                	jne    803b85 <__rodata_start+0x185>
+  803b17:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803b1b:	76 20                	jbe    803b3d <__rodata_start+0x13d>
+  803b1d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803b24:	72 65                	jb     803b8b <__rodata_start+0x18b>
+  803b26:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803b29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b2a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803b2e:	65 78 70             	gs js  803ba1 <__rodata_start+0x1a1>
+  803b31:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803b36:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803b39:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803b3d:	20 66 69             	and    %ah,0x69(%rsi)
+  803b40:	6c                   	insb   (%dx),%es:(%rdi)
+  803b41:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803b45:	20 66 72             	and    %ah,0x72(%rsi)
+  803b48:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803b4d:	61                   	(bad)
+  803b4e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b53:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b57:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803b5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b5c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803b5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b60:	79 20                	jns    803b82 <__rodata_start+0x182>
+  803b62:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803b69:	72 65                	jb     803bd0 <__rodata_start+0x1d0>
+  803b6b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803b6e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b70:	00 66 69             	add    %ah,0x69(%rsi)
+  803b73:	6c                   	insb   (%dx),%es:(%rdi)
+  803b74:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803b78:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803b7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b7c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803b7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b81:	74 20                	je     803ba3 <__rodata_start+0x1a3>
+  803b83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b85:	75 6e                	jne    803bf5 <__rodata_start+0x1f5>
+  803b87:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803b8b:	76 61                	jbe    803bee <__rodata_start+0x1ee>
+  803b8d:	6c                   	insb   (%dx),%es:(%rdi)
+  803b8e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803b95:	00 
+  803b96:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803b9d:	72 65                	jb     803c04 <__rodata_start+0x204>
+  803b9f:	61                   	(bad)
+  803ba0:	64 79 20             	fs jns 803bc3 <__rodata_start+0x1c3>
+  803ba3:	65 78 69             	gs js  803c0f <__rodata_start+0x20f>
+  803ba6:	73 74                	jae    803c1c <__rodata_start+0x21c>
+  803ba8:	73 00                	jae    803baa <__rodata_start+0x1aa>
+  803baa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bab:	70 65                	jo     803c12 <__rodata_start+0x212>
+  803bad:	72 61                	jb     803c10 <__rodata_start+0x210>
+  803baf:	74 69                	je     803c1a <__rodata_start+0x21a>
+  803bb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803bb6:	74 20                	je     803bd8 <__rodata_start+0x1d8>
+  803bb8:	73 75                	jae    803c2f <__rodata_start+0x22f>
+  803bba:	70 70                	jo     803c2c <__rodata_start+0x22c>
+  803bbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbd:	72 74                	jb     803c33 <__rodata_start+0x233>
+  803bbf:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803bc5:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803bca:	74 00                	je     803bcc <__rodata_start+0x1cc>
+  803bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803bd3:	00 00 00 
+  803bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803bdd:	00 00 00 
+  803be0:	ed                   	in     (%dx),%eax
+  803be1:	06                   	(bad)
+  803be2:	80 00 00             	addb   $0x0,(%rax)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 2e                	add    %ch,(%rsi)
+  803be9:	0d 80 00 00 00       	or     $0x80,%eax
+  803bee:	00 00                	add    %al,(%rax)
+  803bf0:	1e                   	(bad)
+  803bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  803bf6:	00 00                	add    %al,(%rax)
+  803bf8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803bfe:	00 00                	add    %al,(%rax)
+  803c00:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803c06:	00 00                	add    %al,(%rax)
+  803c08:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803c0e:	00 00                	add    %al,(%rax)
+  803c10:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803c16:	00 00                	add    %al,(%rax)
+  803c18:	0c 07                	or     $0x7,%al
+  803c1a:	80 00 00             	addb   $0x0,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 2e                	add    %ch,(%rsi)
+  803c21:	0d 80 00 00 00       	or     $0x80,%eax
+  803c26:	00 00                	add    %al,(%rax)
+  803c28:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803c2e:	00 00                	add    %al,(%rax)
+  803c30:	00 07                	add    %al,(%rdi)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 7a 07             	add    %bh,0x7(%rdx)
+  803c3a:	80 00 00             	addb   $0x0,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 2e                	add    %ch,(%rsi)
+  803c41:	0d 80 00 00 00       	or     $0x80,%eax
+  803c46:	00 00                	add    %al,(%rax)
+  803c48:	00 07                	add    %al,(%rdi)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 46 07             	add    %al,0x7(%rsi)
+  803c52:	80 00 00             	addb   $0x0,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 46 07             	add    %al,0x7(%rsi)
+  803c5a:	80 00 00             	addb   $0x0,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 46 07             	add    %al,0x7(%rsi)
+  803c62:	80 00 00             	addb   $0x0,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 46 07             	add    %al,0x7(%rsi)
+  803c6a:	80 00 00             	addb   $0x0,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 46 07             	add    %al,0x7(%rsi)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 46 07             	add    %al,0x7(%rsi)
+  803c7a:	80 00 00             	addb   $0x0,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 46 07             	add    %al,0x7(%rsi)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 46 07             	add    %al,0x7(%rsi)
+  803c8a:	80 00 00             	addb   $0x0,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 46 07             	add    %al,0x7(%rsi)
+  803c92:	80 00 00             	addb   $0x0,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 2e                	add    %ch,(%rsi)
+  803c99:	0d 80 00 00 00       	or     $0x80,%eax
+  803c9e:	00 00                	add    %al,(%rax)
+  803ca0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803ca6:	00 00                	add    %al,(%rax)
+  803ca8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cae:	00 00                	add    %al,(%rax)
+  803cb0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cb6:	00 00                	add    %al,(%rax)
+  803cb8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cbe:	00 00                	add    %al,(%rax)
+  803cc0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cc6:	00 00                	add    %al,(%rax)
+  803cc8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cce:	00 00                	add    %al,(%rax)
+  803cd0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cd6:	00 00                	add    %al,(%rax)
+  803cd8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cde:	00 00                	add    %al,(%rax)
+  803ce0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803ce6:	00 00                	add    %al,(%rax)
+  803ce8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cee:	00 00                	add    %al,(%rax)
+  803cf0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cf6:	00 00                	add    %al,(%rax)
+  803cf8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803cfe:	00 00                	add    %al,(%rax)
+  803d00:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d06:	00 00                	add    %al,(%rax)
+  803d08:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d0e:	00 00                	add    %al,(%rax)
+  803d10:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d16:	00 00                	add    %al,(%rax)
+  803d18:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d1e:	00 00                	add    %al,(%rax)
+  803d20:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d26:	00 00                	add    %al,(%rax)
+  803d28:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d2e:	00 00                	add    %al,(%rax)
+  803d30:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d36:	00 00                	add    %al,(%rax)
+  803d38:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d3e:	00 00                	add    %al,(%rax)
+  803d40:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d4e:	00 00                	add    %al,(%rax)
+  803d50:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d56:	00 00                	add    %al,(%rax)
+  803d58:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d5e:	00 00                	add    %al,(%rax)
+  803d60:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d66:	00 00                	add    %al,(%rax)
+  803d68:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d6e:	00 00                	add    %al,(%rax)
+  803d70:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d76:	00 00                	add    %al,(%rax)
+  803d78:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d7e:	00 00                	add    %al,(%rax)
+  803d80:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d86:	00 00                	add    %al,(%rax)
+  803d88:	51                   	push   %rcx
+  803d89:	0c 80                	or     $0x80,%al
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 2e                	add    %ch,(%rsi)
+  803d91:	0d 80 00 00 00       	or     $0x80,%eax
+  803d96:	00 00                	add    %al,(%rax)
+  803d98:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803d9e:	00 00                	add    %al,(%rax)
+  803da0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803da6:	00 00                	add    %al,(%rax)
+  803da8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dae:	00 00                	add    %al,(%rax)
+  803db0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803db6:	00 00                	add    %al,(%rax)
+  803db8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dbe:	00 00                	add    %al,(%rax)
+  803dc0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dc6:	00 00                	add    %al,(%rax)
+  803dc8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dce:	00 00                	add    %al,(%rax)
+  803dd0:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dd6:	00 00                	add    %al,(%rax)
+  803dd8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dde:	00 00                	add    %al,(%rax)
+  803de0:	9d                   	popf
+  803de1:	07                   	(bad)
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 6c 09 80          	add    %ch,-0x80(%rcx,%rcx,1)
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 2e                	add    %ch,(%rsi)
+  803df1:	0d 80 00 00 00       	or     $0x80,%eax
+  803df6:	00 00                	add    %al,(%rax)
+  803df8:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803dfe:	00 00                	add    %al,(%rax)
+  803e00:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e06:	00 00                	add    %al,(%rax)
+  803e08:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e0e:	00 00                	add    %al,(%rax)
+  803e10:	cc                   	int3
+  803e11:	07                   	(bad)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 2e                	add    %ch,(%rsi)
+  803e19:	0d 80 00 00 00       	or     $0x80,%eax
+  803e1e:	00 00                	add    %al,(%rax)
+  803e20:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e26:	00 00                	add    %al,(%rax)
+  803e28:	92                   	xchg   %eax,%edx
+  803e29:	07                   	(bad)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 2e                	add    %ch,(%rsi)
+  803e31:	0d 80 00 00 00       	or     $0x80,%eax
+  803e36:	00 00                	add    %al,(%rax)
+  803e38:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e3e:	00 00                	add    %al,(%rax)
+  803e40:	14 0b                	adc    $0xb,%al
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 de                	add    %bl,%dh
+  803e49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803e4f:	00 2e                	add    %ch,(%rsi)
+  803e51:	0d 80 00 00 00       	or     $0x80,%eax
+  803e56:	00 00                	add    %al,(%rax)
+  803e58:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e5e:	00 00                	add    %al,(%rax)
+  803e60:	63 08                	movsxd (%rax),%ecx
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 2e                	add    %ch,(%rsi)
+  803e69:	0d 80 00 00 00       	or     $0x80,%eax
+  803e6e:	00 00                	add    %al,(%rax)
+  803e70:	40 0a 80 00 00 00 00 	rex or 0x0(%rax),%al
+  803e77:	00 2e                	add    %ch,(%rsi)
+  803e79:	0d 80 00 00 00       	or     $0x80,%eax
+  803e7e:	00 00                	add    %al,(%rax)
+  803e80:	2e 0d 80 00 00 00    	cs or  $0x80,%eax
+  803e86:	00 00                	add    %al,(%rax)
+  803e88:	51                   	push   %rcx
+  803e89:	0c 80                	or     $0x80,%al
+  803e8b:	00 00                	add    %al,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 2e                	add    %ch,(%rsi)
+  803e91:	0d 80 00 00 00       	or     $0x80,%eax
+  803e96:	00 00                	add    %al,(%rax)
+  803e98:	f6 06 80             	testb  $0x80,(%rsi)
+  803e9b:	00 00                	add    %al,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803ea0 <error_string>:
+	...
+  803ea8:	65 3a 80 00 00 00 00 00 77 3a 80 00 00 00 00 00     e:......w:......
+  803eb8:	87 3a 80 00 00 00 00 00 99 3a 80 00 00 00 00 00     .:.......:......
+  803ec8:	a7 3a 80 00 00 00 00 00 bb 3a 80 00 00 00 00 00     .:.......:......
+  803ed8:	d0 3a 80 00 00 00 00 00 e3 3a 80 00 00 00 00 00     .:.......:......
+  803ee8:	f5 3a 80 00 00 00 00 00 09 3b 80 00 00 00 00 00     .:.......;......
+  803ef8:	19 3b 80 00 00 00 00 00 2c 3b 80 00 00 00 00 00     .;......,;......
+  803f08:	43 3b 80 00 00 00 00 00 59 3b 80 00 00 00 00 00     C;......Y;......
+  803f18:	71 3b 80 00 00 00 00 00 89 3b 80 00 00 00 00 00     q;.......;......
+  803f28:	96 3b 80 00 00 00 00 00 48 3f 80 00 00 00 00 00     .;......H?......
+  803f38:	aa 3b 80 00 00 00 00 00 c2 3b 80 00 00 00 00 00     .;.......;......
+  803f48:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803f58:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803f68:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803f78:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803f88:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803f98:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803fa8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803fb8:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803fc8:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803fd8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803fe8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803ff8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804008:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804018:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804028:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804038:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804040 <devtab>:
+  804040:	20 50 80 00 00 00 00 00 c0 50 80 00 00 00 00 00      P.......P......
+  804050:	60 51 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `Q..............
+  804060:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804070:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804080:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804090:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8040a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8040b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8040c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8040d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8040e0:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  8040f0:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804100:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804110:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804120:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804130:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804140:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804150:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804160:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804170:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804180:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804190:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804200:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804210:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804220:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804230:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804240:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804250:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804260:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804270:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804280:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804290:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804300:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804310:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804320:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804330:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804340:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804350:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804360:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804370:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804380:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804390:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,6941 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c6 00 00 00       	call   8000e9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800036:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80003d:	00 00 00 
+  800040:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800046:	48 bf 38 37 80 00 00 	movabs $0x803738,%rdi
+  80004d:	00 00 00 
+  800050:	b8 00 00 00 00       	mov    $0x0,%eax
+  800055:	48 ba 67 02 80 00 00 	movabs $0x800267,%rdx
+  80005c:	00 00 00 
+  80005f:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800061:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800066:	49 bf 89 11 80 00 00 	movabs $0x801189,%r15
+  80006d:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  800070:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  800077:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007a:	49 bd 58 37 80 00 00 	movabs $0x803758,%r13
+  800081:	00 00 00 
+  800084:	49 bc 67 02 80 00 00 	movabs $0x800267,%r12
+  80008b:	00 00 00 
+        sys_yield();
+  80008e:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800091:	49 8b 06             	mov    (%r14),%rax
+  800094:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009a:	89 da                	mov    %ebx,%edx
+  80009c:	4c 89 ef             	mov    %r13,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000a7:	83 c3 01             	add    $0x1,%ebx
+  8000aa:	83 fb 05             	cmp    $0x5,%ebx
+  8000ad:	75 df                	jne    80008e <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000af:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8000b6:	00 00 00 
+  8000b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000bf:	48 bf 88 37 80 00 00 	movabs $0x803788,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 ba 67 02 80 00 00 	movabs $0x800267,%rdx
+  8000d5:	00 00 00 
+  8000d8:	ff d2                	call   *%rdx
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	41 5e                	pop    %r14
+  8000e5:	41 5f                	pop    %r15
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  8000ed:	41 56                	push   %r14
+  8000ef:	41 55                	push   %r13
+  8000f1:	41 54                	push   %r12
+  8000f3:	53                   	push   %rbx
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fa:	48 ba f8 41 80 00 00 	movabs $0x8041f8,%rdx
+  800101:	00 00 00 
+  800104:	48 b8 f8 41 80 00 00 	movabs $0x8041f8,%rax
+  80010b:	00 00 00 
+  80010e:	48 39 c2             	cmp    %rax,%rdx
+  800111:	73 17                	jae    80012a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800113:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800116:	49 89 c4             	mov    %rax,%r12
+  800119:	48 83 c3 08          	add    $0x8,%rbx
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	ff 53 f8             	call   *-0x8(%rbx)
+  800125:	4c 39 e3             	cmp    %r12,%rbx
+  800128:	72 ef                	jb     800119 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80012a:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+  800136:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80013b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80013f:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800143:	48 c1 e0 04          	shl    $0x4,%rax
+  800147:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80014e:	00 00 00 
+  800151:	48 01 d0             	add    %rdx,%rax
+  800154:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80015b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80015e:	45 85 ed             	test   %r13d,%r13d
+  800161:	7e 0d                	jle    800170 <libmain+0x87>
+  800163:	49 8b 06             	mov    (%r14),%rax
+  800166:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80016d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800170:	4c 89 f6             	mov    %r14,%rsi
+  800173:	44 89 ef             	mov    %r13d,%edi
+  800176:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80017d:	00 00 00 
+  800180:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800182:	48 b8 97 01 80 00 00 	movabs $0x800197,%rax
+  800189:	00 00 00 
+  80018c:	ff d0                	call   *%rax
+#endif
+}
+  80018e:	5b                   	pop    %rbx
+  80018f:	41 5c                	pop    %r12
+  800191:	41 5d                	pop    %r13
+  800193:	41 5e                	pop    %r14
+  800195:	5d                   	pop    %rbp
+  800196:	c3                   	ret
+
+0000000000800197 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800197:	55                   	push   %rbp
+  800198:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80019b:	48 b8 0e 18 80 00 00 	movabs $0x80180e,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ac:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  8001b3:	00 00 00 
+  8001b6:	ff d0                	call   *%rax
+}
+  8001b8:	5d                   	pop    %rbp
+  8001b9:	c3                   	ret
+
+00000000008001ba <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ba:	55                   	push   %rbp
+  8001bb:	48 89 e5             	mov    %rsp,%rbp
+  8001be:	53                   	push   %rbx
+  8001bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001c6:	8b 06                	mov    (%rsi),%eax
+  8001c8:	8d 50 01             	lea    0x1(%rax),%edx
+  8001cb:	89 16                	mov    %edx,(%rsi)
+  8001cd:	48 98                	cltq
+  8001cf:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001d4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001da:	74 0a                	je     8001e6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001dc:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e4:	c9                   	leave
+  8001e5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001e6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001ea:	be ff 00 00 00       	mov    $0xff,%esi
+  8001ef:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  8001f6:	00 00 00 
+  8001f9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001fb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800201:	eb d9                	jmp    8001dc <putch+0x22>
+
+0000000000800203 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800203:	55                   	push   %rbp
+  800204:	48 89 e5             	mov    %rsp,%rbp
+  800207:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80020e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800211:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800218:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80021d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800222:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800225:	48 89 f1             	mov    %rsi,%rcx
+  800228:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80022f:	48 bf ba 01 80 00 00 	movabs $0x8001ba,%rdi
+  800236:	00 00 00 
+  800239:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800245:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80024c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800253:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80025f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800265:	c9                   	leave
+  800266:	c3                   	ret
+
+0000000000800267 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800267:	55                   	push   %rbp
+  800268:	48 89 e5             	mov    %rsp,%rbp
+  80026b:	48 83 ec 50          	sub    $0x50,%rsp
+  80026f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800273:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800277:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80027b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80027f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800283:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80028a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800292:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800296:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80029a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80029e:	48 b8 03 02 80 00 00 	movabs $0x800203,%rax
+  8002a5:	00 00 00 
+  8002a8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002aa:	c9                   	leave
+  8002ab:	c3                   	ret
+
+00000000008002ac <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002ac:	55                   	push   %rbp
+  8002ad:	48 89 e5             	mov    %rsp,%rbp
+  8002b0:	41 57                	push   %r15
+  8002b2:	41 56                	push   %r14
+  8002b4:	41 55                	push   %r13
+  8002b6:	41 54                	push   %r12
+  8002b8:	53                   	push   %rbx
+  8002b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8002bd:	49 89 fc             	mov    %rdi,%r12
+  8002c0:	49 89 f5             	mov    %rsi,%r13
+  8002c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c7:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002ca:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002cd:	41 89 cf             	mov    %ecx,%r15d
+  8002d0:	4c 39 fa             	cmp    %r15,%rdx
+  8002d3:	73 5b                	jae    800330 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002d5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002dd:	85 db                	test   %ebx,%ebx
+  8002df:	7e 0e                	jle    8002ef <print_num+0x43>
+            putch(padc, put_arg);
+  8002e1:	4c 89 ee             	mov    %r13,%rsi
+  8002e4:	44 89 f7             	mov    %r14d,%edi
+  8002e7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002ea:	83 eb 01             	sub    $0x1,%ebx
+  8002ed:	75 f2                	jne    8002e1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002ef:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002f3:	48 b9 c2 37 80 00 00 	movabs $0x8037c2,%rcx
+  8002fa:	00 00 00 
+  8002fd:	48 b8 b1 37 80 00 00 	movabs $0x8037b1,%rax
+  800304:	00 00 00 
+  800307:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80030b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80030f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800314:	49 f7 f7             	div    %r15
+  800317:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80031b:	4c 89 ee             	mov    %r13,%rsi
+  80031e:	41 ff d4             	call   *%r12
+}
+  800321:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800325:	5b                   	pop    %rbx
+  800326:	41 5c                	pop    %r12
+  800328:	41 5d                	pop    %r13
+  80032a:	41 5e                	pop    %r14
+  80032c:	41 5f                	pop    %r15
+  80032e:	5d                   	pop    %rbp
+  80032f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800330:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800334:	ba 00 00 00 00       	mov    $0x0,%edx
+  800339:	49 f7 f7             	div    %r15
+  80033c:	48 83 ec 08          	sub    $0x8,%rsp
+  800340:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800344:	52                   	push   %rdx
+  800345:	45 0f be c9          	movsbl %r9b,%r9d
+  800349:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80034d:	48 89 c2             	mov    %rax,%rdx
+  800350:	48 b8 ac 02 80 00 00 	movabs $0x8002ac,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+  80035c:	48 83 c4 10          	add    $0x10,%rsp
+  800360:	eb 8d                	jmp    8002ef <print_num+0x43>
+
+0000000000800362 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800362:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800366:	48 8b 06             	mov    (%rsi),%rax
+  800369:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80036d:	73 0a                	jae    800379 <sprintputch+0x17>
+        *state->start++ = ch;
+  80036f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800373:	48 89 16             	mov    %rdx,(%rsi)
+  800376:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800379:	c3                   	ret
+
+000000000080037a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80037a:	55                   	push   %rbp
+  80037b:	48 89 e5             	mov    %rsp,%rbp
+  80037e:	48 83 ec 50          	sub    $0x50,%rsp
+  800382:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800386:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80038e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800395:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800399:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80039d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003a5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a9:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  8003b0:	00 00 00 
+  8003b3:	ff d0                	call   *%rax
+}
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+00000000008003b7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  8003bb:	41 57                	push   %r15
+  8003bd:	41 56                	push   %r14
+  8003bf:	41 55                	push   %r13
+  8003c1:	41 54                	push   %r12
+  8003c3:	53                   	push   %rbx
+  8003c4:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c8:	49 89 fe             	mov    %rdi,%r14
+  8003cb:	49 89 f5             	mov    %rsi,%r13
+  8003ce:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003d1:	48 8b 01             	mov    (%rcx),%rax
+  8003d4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003ec:	0f b6 3b             	movzbl (%rbx),%edi
+  8003ef:	40 80 ff 25          	cmp    $0x25,%dil
+  8003f3:	74 18                	je     80040d <vprintfmt+0x56>
+            if (!ch) return;
+  8003f5:	40 84 ff             	test   %dil,%dil
+  8003f8:	0f 84 b1 06 00 00    	je     800aaf <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003fe:	40 0f b6 ff          	movzbl %dil,%edi
+  800402:	4c 89 ee             	mov    %r13,%rsi
+  800405:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800408:	4c 89 e3             	mov    %r12,%rbx
+  80040b:	eb db                	jmp    8003e8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80040d:	be 00 00 00 00       	mov    $0x0,%esi
+  800412:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800416:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80041b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800421:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800428:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80042c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800431:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800436:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800439:	83 e8 23             	sub    $0x23,%eax
+  80043c:	3c 57                	cmp    $0x57,%al
+  80043e:	0f 87 51 06 00 00    	ja     800a95 <vprintfmt+0x6de>
+  800444:	0f b6 c0             	movzbl %al,%eax
+  800447:	48 b9 60 39 80 00 00 	movabs $0x803960,%rcx
+  80044e:	00 00 00 
+  800451:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800454:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800457:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80045b:	eb cf                	jmp    80042c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80045d:	49 89 dc             	mov    %rbx,%r12
+  800460:	be 01 00 00 00       	mov    $0x1,%esi
+  800465:	eb c5                	jmp    80042c <vprintfmt+0x75>
+            padc = ch;
+  800467:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80046b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80046e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800471:	eb b9                	jmp    80042c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800473:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800476:	83 f8 2f             	cmp    $0x2f,%eax
+  800479:	77 24                	ja     80049f <vprintfmt+0xe8>
+  80047b:	89 c1                	mov    %eax,%ecx
+  80047d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800481:	83 c0 08             	add    $0x8,%eax
+  800484:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800487:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80048a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80048d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800491:	79 99                	jns    80042c <vprintfmt+0x75>
+                width = precision;
+  800493:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800497:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80049d:	eb 8d                	jmp    80042c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80049f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004a3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ab:	eb da                	jmp    800487 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004ad:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004b2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004b6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004bc:	3c 39                	cmp    $0x39,%al
+  8004be:	77 1c                	ja     8004dc <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004c0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004c4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c8:	0f b6 c0             	movzbl %al,%eax
+  8004cb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004d0:	0f b6 03             	movzbl (%rbx),%eax
+  8004d3:	3c 39                	cmp    $0x39,%al
+  8004d5:	76 e9                	jbe    8004c0 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004da:	eb b1                	jmp    80048d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004dc:	49 89 dc             	mov    %rbx,%r12
+  8004df:	eb ac                	jmp    80048d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004e1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004e4:	85 c9                	test   %ecx,%ecx
+  8004e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004eb:	0f 49 c1             	cmovns %ecx,%eax
+  8004ee:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004f1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f4:	e9 33 ff ff ff       	jmp    80042c <vprintfmt+0x75>
+            lflag++;
+  8004f9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004fc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ff:	e9 28 ff ff ff       	jmp    80042c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800504:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800507:	83 f8 2f             	cmp    $0x2f,%eax
+  80050a:	77 19                	ja     800525 <vprintfmt+0x16e>
+  80050c:	89 c2                	mov    %eax,%edx
+  80050e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800512:	83 c0 08             	add    $0x8,%eax
+  800515:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800518:	8b 3a                	mov    (%rdx),%edi
+  80051a:	4c 89 ee             	mov    %r13,%rsi
+  80051d:	41 ff d6             	call   *%r14
+            break;
+  800520:	e9 c3 fe ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800525:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800529:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80052d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800531:	eb e5                	jmp    800518 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800533:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800536:	83 f8 2f             	cmp    $0x2f,%eax
+  800539:	77 5a                	ja     800595 <vprintfmt+0x1de>
+  80053b:	89 c2                	mov    %eax,%edx
+  80053d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800541:	83 c0 08             	add    $0x8,%eax
+  800544:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800547:	8b 02                	mov    (%rdx),%eax
+  800549:	89 c1                	mov    %eax,%ecx
+  80054b:	f7 d9                	neg    %ecx
+  80054d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800550:	83 f9 14             	cmp    $0x14,%ecx
+  800553:	7f 4e                	jg     8005a3 <vprintfmt+0x1ec>
+  800555:	48 63 c1             	movslq %ecx,%rax
+  800558:	48 ba 20 3c 80 00 00 	movabs $0x803c20,%rdx
+  80055f:	00 00 00 
+  800562:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800566:	48 85 c0             	test   %rax,%rax
+  800569:	74 38                	je     8005a3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80056b:	48 89 c1             	mov    %rax,%rcx
+  80056e:	48 ba f9 3d 80 00 00 	movabs $0x803df9,%rdx
+  800575:	00 00 00 
+  800578:	4c 89 ee             	mov    %r13,%rsi
+  80057b:	4c 89 f7             	mov    %r14,%rdi
+  80057e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800583:	49 b8 7a 03 80 00 00 	movabs $0x80037a,%r8
+  80058a:	00 00 00 
+  80058d:	41 ff d0             	call   *%r8
+  800590:	e9 53 fe ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800595:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800599:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80059d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a1:	eb a4                	jmp    800547 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005a3:	48 ba da 37 80 00 00 	movabs $0x8037da,%rdx
+  8005aa:	00 00 00 
+  8005ad:	4c 89 ee             	mov    %r13,%rsi
+  8005b0:	4c 89 f7             	mov    %r14,%rdi
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	49 b8 7a 03 80 00 00 	movabs $0x80037a,%r8
+  8005bf:	00 00 00 
+  8005c2:	41 ff d0             	call   *%r8
+  8005c5:	e9 1e fe ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d0:	77 6c                	ja     80063e <vprintfmt+0x287>
+  8005d2:	89 c2                	mov    %eax,%edx
+  8005d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d8:	83 c0 08             	add    $0x8,%eax
+  8005db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005de:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005e1:	48 85 d2             	test   %rdx,%rdx
+  8005e4:	48 b8 d3 37 80 00 00 	movabs $0x8037d3,%rax
+  8005eb:	00 00 00 
+  8005ee:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005f2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005fa:	7e 06                	jle    800602 <vprintfmt+0x24b>
+  8005fc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800600:	75 4a                	jne    80064c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800602:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800606:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80060a:	0f b6 00             	movzbl (%rax),%eax
+  80060d:	84 c0                	test   %al,%al
+  80060f:	0f 85 9a 00 00 00    	jne    8006af <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800615:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800618:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80061c:	85 c0                	test   %eax,%eax
+  80061e:	0f 8e c4 fd ff ff    	jle    8003e8 <vprintfmt+0x31>
+  800624:	4c 89 ee             	mov    %r13,%rsi
+  800627:	bf 20 00 00 00       	mov    $0x20,%edi
+  80062c:	41 ff d6             	call   *%r14
+  80062f:	41 83 ec 01          	sub    $0x1,%r12d
+  800633:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800637:	75 eb                	jne    800624 <vprintfmt+0x26d>
+  800639:	e9 aa fd ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80063e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800642:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800646:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064a:	eb 92                	jmp    8005de <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80064c:	49 63 f7             	movslq %r15d,%rsi
+  80064f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800653:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  80065a:	00 00 00 
+  80065d:	ff d0                	call   *%rax
+  80065f:	48 89 c2             	mov    %rax,%rdx
+  800662:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800665:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800667:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80066a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80066d:	85 c0                	test   %eax,%eax
+  80066f:	7e 91                	jle    800602 <vprintfmt+0x24b>
+  800671:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800676:	4c 89 ee             	mov    %r13,%rsi
+  800679:	44 89 e7             	mov    %r12d,%edi
+  80067c:	41 ff d6             	call   *%r14
+  80067f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800683:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800686:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800689:	75 eb                	jne    800676 <vprintfmt+0x2bf>
+  80068b:	e9 72 ff ff ff       	jmp    800602 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800690:	0f b6 f8             	movzbl %al,%edi
+  800693:	4c 89 ee             	mov    %r13,%rsi
+  800696:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800699:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80069d:	49 83 c4 01          	add    $0x1,%r12
+  8006a1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a7:	84 c0                	test   %al,%al
+  8006a9:	0f 84 66 ff ff ff    	je     800615 <vprintfmt+0x25e>
+  8006af:	45 85 ff             	test   %r15d,%r15d
+  8006b2:	78 0a                	js     8006be <vprintfmt+0x307>
+  8006b4:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b8:	0f 88 57 ff ff ff    	js     800615 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006be:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006c2:	74 cc                	je     800690 <vprintfmt+0x2d9>
+  8006c4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006c7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006cc:	80 fa 5e             	cmp    $0x5e,%dl
+  8006cf:	77 c2                	ja     800693 <vprintfmt+0x2dc>
+  8006d1:	eb bd                	jmp    800690 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d3:	40 84 f6             	test   %sil,%sil
+  8006d6:	75 26                	jne    8006fe <vprintfmt+0x347>
+    switch (lflag) {
+  8006d8:	85 d2                	test   %edx,%edx
+  8006da:	74 59                	je     800735 <vprintfmt+0x37e>
+  8006dc:	83 fa 01             	cmp    $0x1,%edx
+  8006df:	74 7b                	je     80075c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e7:	0f 87 96 00 00 00    	ja     800783 <vprintfmt+0x3cc>
+  8006ed:	89 c2                	mov    %eax,%edx
+  8006ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f3:	83 c0 08             	add    $0x8,%eax
+  8006f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f9:	4c 8b 22             	mov    (%rdx),%r12
+  8006fc:	eb 17                	jmp    800715 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800701:	83 f8 2f             	cmp    $0x2f,%eax
+  800704:	77 21                	ja     800727 <vprintfmt+0x370>
+  800706:	89 c2                	mov    %eax,%edx
+  800708:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070c:	83 c0 08             	add    $0x8,%eax
+  80070f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800712:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800715:	4d 85 e4             	test   %r12,%r12
+  800718:	78 7a                	js     800794 <vprintfmt+0x3dd>
+            num = i;
+  80071a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80071d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800722:	e9 50 02 00 00       	jmp    800977 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800727:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800733:	eb dd                	jmp    800712 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800735:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800738:	83 f8 2f             	cmp    $0x2f,%eax
+  80073b:	77 11                	ja     80074e <vprintfmt+0x397>
+  80073d:	89 c2                	mov    %eax,%edx
+  80073f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800743:	83 c0 08             	add    $0x8,%eax
+  800746:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800749:	4c 63 22             	movslq (%rdx),%r12
+  80074c:	eb c7                	jmp    800715 <vprintfmt+0x35e>
+  80074e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800752:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800756:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075a:	eb ed                	jmp    800749 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80075c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075f:	83 f8 2f             	cmp    $0x2f,%eax
+  800762:	77 11                	ja     800775 <vprintfmt+0x3be>
+  800764:	89 c2                	mov    %eax,%edx
+  800766:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076a:	83 c0 08             	add    $0x8,%eax
+  80076d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800770:	4c 8b 22             	mov    (%rdx),%r12
+  800773:	eb a0                	jmp    800715 <vprintfmt+0x35e>
+  800775:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800779:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800781:	eb ed                	jmp    800770 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800783:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800787:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078f:	e9 65 ff ff ff       	jmp    8006f9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800794:	4c 89 ee             	mov    %r13,%rsi
+  800797:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80079c:	41 ff d6             	call   *%r14
+                i = -i;
+  80079f:	49 f7 dc             	neg    %r12
+  8007a2:	e9 73 ff ff ff       	jmp    80071a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a7:	40 84 f6             	test   %sil,%sil
+  8007aa:	75 32                	jne    8007de <vprintfmt+0x427>
+    switch (lflag) {
+  8007ac:	85 d2                	test   %edx,%edx
+  8007ae:	74 5d                	je     80080d <vprintfmt+0x456>
+  8007b0:	83 fa 01             	cmp    $0x1,%edx
+  8007b3:	0f 84 82 00 00 00    	je     80083b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	0f 87 a5 00 00 00    	ja     80086a <vprintfmt+0x4b3>
+  8007c5:	89 c2                	mov    %eax,%edx
+  8007c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cb:	83 c0 08             	add    $0x8,%eax
+  8007ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d9:	e9 99 01 00 00       	jmp    800977 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e4:	77 19                	ja     8007ff <vprintfmt+0x448>
+  8007e6:	89 c2                	mov    %eax,%edx
+  8007e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ec:	83 c0 08             	add    $0x8,%eax
+  8007ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007fa:	e9 78 01 00 00       	jmp    800977 <vprintfmt+0x5c0>
+  8007ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800803:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080b:	eb e5                	jmp    8007f2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80080d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800810:	83 f8 2f             	cmp    $0x2f,%eax
+  800813:	77 18                	ja     80082d <vprintfmt+0x476>
+  800815:	89 c2                	mov    %eax,%edx
+  800817:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081b:	83 c0 08             	add    $0x8,%eax
+  80081e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800821:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800823:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800828:	e9 4a 01 00 00       	jmp    800977 <vprintfmt+0x5c0>
+  80082d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800831:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800835:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800839:	eb e6                	jmp    800821 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80083b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083e:	83 f8 2f             	cmp    $0x2f,%eax
+  800841:	77 19                	ja     80085c <vprintfmt+0x4a5>
+  800843:	89 c2                	mov    %eax,%edx
+  800845:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800849:	83 c0 08             	add    $0x8,%eax
+  80084c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800852:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800857:	e9 1b 01 00 00       	jmp    800977 <vprintfmt+0x5c0>
+  80085c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800860:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800864:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800868:	eb e5                	jmp    80084f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80086a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800876:	e9 56 ff ff ff       	jmp    8007d1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80087b:	40 84 f6             	test   %sil,%sil
+  80087e:	75 2e                	jne    8008ae <vprintfmt+0x4f7>
+    switch (lflag) {
+  800880:	85 d2                	test   %edx,%edx
+  800882:	74 59                	je     8008dd <vprintfmt+0x526>
+  800884:	83 fa 01             	cmp    $0x1,%edx
+  800887:	74 7f                	je     800908 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800889:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088c:	83 f8 2f             	cmp    $0x2f,%eax
+  80088f:	0f 87 9f 00 00 00    	ja     800934 <vprintfmt+0x57d>
+  800895:	89 c2                	mov    %eax,%edx
+  800897:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089b:	83 c0 08             	add    $0x8,%eax
+  80089e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a9:	e9 c9 00 00 00       	jmp    800977 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b4:	77 19                	ja     8008cf <vprintfmt+0x518>
+  8008b6:	89 c2                	mov    %eax,%edx
+  8008b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bc:	83 c0 08             	add    $0x8,%eax
+  8008bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008ca:	e9 a8 00 00 00       	jmp    800977 <vprintfmt+0x5c0>
+  8008cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008db:	eb e5                	jmp    8008c2 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 15                	ja     8008fa <vprintfmt+0x543>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008f3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f8:	eb 7d                	jmp    800977 <vprintfmt+0x5c0>
+  8008fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	eb e9                	jmp    8008f1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090b:	83 f8 2f             	cmp    $0x2f,%eax
+  80090e:	77 16                	ja     800926 <vprintfmt+0x56f>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80091f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800924:	eb 51                	jmp    800977 <vprintfmt+0x5c0>
+  800926:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800932:	eb e8                	jmp    80091c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	e9 5c ff ff ff       	jmp    8008a1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	bf 30 00 00 00       	mov    $0x30,%edi
+  80094d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800950:	4c 89 ee             	mov    %r13,%rsi
+  800953:	bf 78 00 00 00       	mov    $0x78,%edi
+  800958:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80095b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095e:	83 f8 2f             	cmp    $0x2f,%eax
+  800961:	77 47                	ja     8009aa <vprintfmt+0x5f3>
+  800963:	89 c2                	mov    %eax,%edx
+  800965:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800969:	83 c0 08             	add    $0x8,%eax
+  80096c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800972:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800977:	48 83 ec 08          	sub    $0x8,%rsp
+  80097b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80097f:	0f 94 c0             	sete   %al
+  800982:	0f b6 c0             	movzbl %al,%eax
+  800985:	50                   	push   %rax
+  800986:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80098b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80098f:	4c 89 ee             	mov    %r13,%rsi
+  800992:	4c 89 f7             	mov    %r14,%rdi
+  800995:	48 b8 ac 02 80 00 00 	movabs $0x8002ac,%rax
+  80099c:	00 00 00 
+  80099f:	ff d0                	call   *%rax
+            break;
+  8009a1:	48 83 c4 10          	add    $0x10,%rsp
+  8009a5:	e9 3e fa ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b6:	eb b7                	jmp    80096f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b8:	40 84 f6             	test   %sil,%sil
+  8009bb:	75 2b                	jne    8009e8 <vprintfmt+0x631>
+    switch (lflag) {
+  8009bd:	85 d2                	test   %edx,%edx
+  8009bf:	74 56                	je     800a17 <vprintfmt+0x660>
+  8009c1:	83 fa 01             	cmp    $0x1,%edx
+  8009c4:	74 7f                	je     800a45 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cc:	0f 87 a2 00 00 00    	ja     800a74 <vprintfmt+0x6bd>
+  8009d2:	89 c2                	mov    %eax,%edx
+  8009d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d8:	83 c0 08             	add    $0x8,%eax
+  8009db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e6:	eb 8f                	jmp    800977 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 19                	ja     800a09 <vprintfmt+0x652>
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f6:	83 c0 08             	add    $0x8,%eax
+  8009f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ff:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a04:	e9 6e ff ff ff       	jmp    800977 <vprintfmt+0x5c0>
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	eb e5                	jmp    8009fc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1d:	77 18                	ja     800a37 <vprintfmt+0x680>
+  800a1f:	89 c2                	mov    %eax,%edx
+  800a21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a25:	83 c0 08             	add    $0x8,%eax
+  800a28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a32:	e9 40 ff ff ff       	jmp    800977 <vprintfmt+0x5c0>
+  800a37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a43:	eb e6                	jmp    800a2b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a48:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4b:	77 19                	ja     800a66 <vprintfmt+0x6af>
+  800a4d:	89 c2                	mov    %eax,%edx
+  800a4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a53:	83 c0 08             	add    $0x8,%eax
+  800a56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a61:	e9 11 ff ff ff       	jmp    800977 <vprintfmt+0x5c0>
+  800a66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a72:	eb e5                	jmp    800a59 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a80:	e9 59 ff ff ff       	jmp    8009de <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a85:	4c 89 ee             	mov    %r13,%rsi
+  800a88:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a8d:	41 ff d6             	call   *%r14
+            break;
+  800a90:	e9 53 f9 ff ff       	jmp    8003e8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a95:	4c 89 ee             	mov    %r13,%rsi
+  800a98:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a9d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aa0:	48 83 eb 01          	sub    $0x1,%rbx
+  800aa4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa8:	75 f6                	jne    800aa0 <vprintfmt+0x6e9>
+  800aaa:	e9 39 f9 ff ff       	jmp    8003e8 <vprintfmt+0x31>
+}
+  800aaf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ab3:	5b                   	pop    %rbx
+  800ab4:	41 5c                	pop    %r12
+  800ab6:	41 5d                	pop    %r13
+  800ab8:	41 5e                	pop    %r14
+  800aba:	41 5f                	pop    %r15
+  800abc:	5d                   	pop    %rbp
+  800abd:	c3                   	ret
+
+0000000000800abe <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800abe:	55                   	push   %rbp
+  800abf:	48 89 e5             	mov    %rsp,%rbp
+  800ac2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ac6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800aca:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800acf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ad3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ada:	48 85 ff             	test   %rdi,%rdi
+  800add:	74 2b                	je     800b0a <vsnprintf+0x4c>
+  800adf:	48 85 f6             	test   %rsi,%rsi
+  800ae2:	74 26                	je     800b0a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ae4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae8:	48 bf 62 03 80 00 00 	movabs $0x800362,%rdi
+  800aef:	00 00 00 
+  800af2:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800afe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b02:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b05:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b08:	c9                   	leave
+  800b09:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0f:	eb f7                	jmp    800b08 <vsnprintf+0x4a>
+
+0000000000800b11 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b11:	55                   	push   %rbp
+  800b12:	48 89 e5             	mov    %rsp,%rbp
+  800b15:	48 83 ec 50          	sub    $0x50,%rsp
+  800b19:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b1d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b21:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b25:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b2c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b34:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b38:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b3c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b40:	48 b8 be 0a 80 00 00 	movabs $0x800abe,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+
+0000000000800b4e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b4e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b51:	74 10                	je     800b63 <strlen+0x15>
+    size_t n = 0;
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b58:	48 83 c0 01          	add    $0x1,%rax
+  800b5c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b60:	75 f6                	jne    800b58 <strlen+0xa>
+  800b62:	c3                   	ret
+    size_t n = 0;
+  800b63:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b68:	c3                   	ret
+
+0000000000800b69 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b69:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b71:	48 85 f6             	test   %rsi,%rsi
+  800b74:	74 11                	je     800b87 <strnlen+0x1e>
+  800b76:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b7a:	74 0c                	je     800b88 <strnlen+0x1f>
+  800b7c:	48 83 c2 01          	add    $0x1,%rdx
+  800b80:	48 39 d0             	cmp    %rdx,%rax
+  800b83:	75 f1                	jne    800b76 <strnlen+0xd>
+  800b85:	eb 04                	jmp    800b8b <strnlen+0x22>
+  800b87:	c3                   	ret
+  800b88:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b8b:	c3                   	ret
+
+0000000000800b8c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b8c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b94:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b98:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b9b:	48 83 c2 01          	add    $0x1,%rdx
+  800b9f:	84 c9                	test   %cl,%cl
+  800ba1:	75 f1                	jne    800b94 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ba3:	c3                   	ret
+
+0000000000800ba4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ba4:	55                   	push   %rbp
+  800ba5:	48 89 e5             	mov    %rsp,%rbp
+  800ba8:	41 54                	push   %r12
+  800baa:	53                   	push   %rbx
+  800bab:	48 89 fb             	mov    %rdi,%rbx
+  800bae:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bb1:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  800bb8:	00 00 00 
+  800bbb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bbd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bc1:	4c 89 e6             	mov    %r12,%rsi
+  800bc4:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  800bcb:	00 00 00 
+  800bce:	ff d0                	call   *%rax
+    return dst;
+}
+  800bd0:	48 89 d8             	mov    %rbx,%rax
+  800bd3:	5b                   	pop    %rbx
+  800bd4:	41 5c                	pop    %r12
+  800bd6:	5d                   	pop    %rbp
+  800bd7:	c3                   	ret
+
+0000000000800bd8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bdb:	48 85 d2             	test   %rdx,%rdx
+  800bde:	74 1f                	je     800bff <strncpy+0x27>
+  800be0:	48 01 fa             	add    %rdi,%rdx
+  800be3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800be6:	48 83 c1 01          	add    $0x1,%rcx
+  800bea:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bee:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bf2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bf6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bfa:	48 39 ca             	cmp    %rcx,%rdx
+  800bfd:	75 e7                	jne    800be6 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bff:	c3                   	ret
+
+0000000000800c00 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c00:	48 89 f8             	mov    %rdi,%rax
+  800c03:	48 85 d2             	test   %rdx,%rdx
+  800c06:	74 24                	je     800c2c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c08:	48 83 ea 01          	sub    $0x1,%rdx
+  800c0c:	74 1b                	je     800c29 <strlcpy+0x29>
+  800c0e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c12:	0f b6 16             	movzbl (%rsi),%edx
+  800c15:	84 d2                	test   %dl,%dl
+  800c17:	74 10                	je     800c29 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c19:	48 83 c6 01          	add    $0x1,%rsi
+  800c1d:	48 83 c0 01          	add    $0x1,%rax
+  800c21:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c24:	48 39 c8             	cmp    %rcx,%rax
+  800c27:	75 e9                	jne    800c12 <strlcpy+0x12>
+        *dst = '\0';
+  800c29:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c2c:	48 29 f8             	sub    %rdi,%rax
+}
+  800c2f:	c3                   	ret
+
+0000000000800c30 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c30:	0f b6 07             	movzbl (%rdi),%eax
+  800c33:	84 c0                	test   %al,%al
+  800c35:	74 13                	je     800c4a <strcmp+0x1a>
+  800c37:	38 06                	cmp    %al,(%rsi)
+  800c39:	75 0f                	jne    800c4a <strcmp+0x1a>
+  800c3b:	48 83 c7 01          	add    $0x1,%rdi
+  800c3f:	48 83 c6 01          	add    $0x1,%rsi
+  800c43:	0f b6 07             	movzbl (%rdi),%eax
+  800c46:	84 c0                	test   %al,%al
+  800c48:	75 ed                	jne    800c37 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c4a:	0f b6 c0             	movzbl %al,%eax
+  800c4d:	0f b6 16             	movzbl (%rsi),%edx
+  800c50:	29 d0                	sub    %edx,%eax
+}
+  800c52:	c3                   	ret
+
+0000000000800c53 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c53:	48 85 d2             	test   %rdx,%rdx
+  800c56:	74 1f                	je     800c77 <strncmp+0x24>
+  800c58:	0f b6 07             	movzbl (%rdi),%eax
+  800c5b:	84 c0                	test   %al,%al
+  800c5d:	74 1e                	je     800c7d <strncmp+0x2a>
+  800c5f:	3a 06                	cmp    (%rsi),%al
+  800c61:	75 1a                	jne    800c7d <strncmp+0x2a>
+  800c63:	48 83 c7 01          	add    $0x1,%rdi
+  800c67:	48 83 c6 01          	add    $0x1,%rsi
+  800c6b:	48 83 ea 01          	sub    $0x1,%rdx
+  800c6f:	75 e7                	jne    800c58 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c76:	c3                   	ret
+  800c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7c:	c3                   	ret
+  800c7d:	48 85 d2             	test   %rdx,%rdx
+  800c80:	74 09                	je     800c8b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c82:	0f b6 07             	movzbl (%rdi),%eax
+  800c85:	0f b6 16             	movzbl (%rsi),%edx
+  800c88:	29 d0                	sub    %edx,%eax
+  800c8a:	c3                   	ret
+    if (!n) return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c90:	c3                   	ret
+
+0000000000800c91 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c91:	0f b6 17             	movzbl (%rdi),%edx
+  800c94:	84 d2                	test   %dl,%dl
+  800c96:	74 18                	je     800cb0 <strchr+0x1f>
+        if (*str == c) {
+  800c98:	0f be d2             	movsbl %dl,%edx
+  800c9b:	39 f2                	cmp    %esi,%edx
+  800c9d:	74 17                	je     800cb6 <strchr+0x25>
+    for (; *str; str++) {
+  800c9f:	48 83 c7 01          	add    $0x1,%rdi
+  800ca3:	0f b6 17             	movzbl (%rdi),%edx
+  800ca6:	84 d2                	test   %dl,%dl
+  800ca8:	75 ee                	jne    800c98 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caf:	c3                   	ret
+  800cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb5:	c3                   	ret
+  800cb6:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb9:	c3                   	ret
+
+0000000000800cba <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cba:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cbd:	0f b6 17             	movzbl (%rdi),%edx
+  800cc0:	84 d2                	test   %dl,%dl
+  800cc2:	74 13                	je     800cd7 <strfind+0x1d>
+  800cc4:	0f be d2             	movsbl %dl,%edx
+  800cc7:	39 f2                	cmp    %esi,%edx
+  800cc9:	74 0b                	je     800cd6 <strfind+0x1c>
+  800ccb:	48 83 c0 01          	add    $0x1,%rax
+  800ccf:	0f b6 10             	movzbl (%rax),%edx
+  800cd2:	84 d2                	test   %dl,%dl
+  800cd4:	75 ee                	jne    800cc4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cd6:	c3                   	ret
+  800cd7:	c3                   	ret
+
+0000000000800cd8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cd8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cdb:	48 89 f8             	mov    %rdi,%rax
+  800cde:	48 f7 d8             	neg    %rax
+  800ce1:	83 e0 07             	and    $0x7,%eax
+  800ce4:	49 89 d1             	mov    %rdx,%r9
+  800ce7:	49 29 c1             	sub    %rax,%r9
+  800cea:	78 36                	js     800d22 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cec:	40 0f b6 c6          	movzbl %sil,%eax
+  800cf0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cf7:	01 01 01 
+  800cfa:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cfe:	40 f6 c7 07          	test   $0x7,%dil
+  800d02:	75 38                	jne    800d3c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d04:	4c 89 c9             	mov    %r9,%rcx
+  800d07:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d0b:	74 0c                	je     800d19 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d0d:	fc                   	cld
+  800d0e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d11:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d15:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d19:	4d 85 c9             	test   %r9,%r9
+  800d1c:	75 45                	jne    800d63 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d1e:	4c 89 c0             	mov    %r8,%rax
+  800d21:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d22:	48 85 d2             	test   %rdx,%rdx
+  800d25:	74 f7                	je     800d1e <memset+0x46>
+  800d27:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d2a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d2d:	48 83 c0 01          	add    $0x1,%rax
+  800d31:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d35:	48 39 c2             	cmp    %rax,%rdx
+  800d38:	75 f3                	jne    800d2d <memset+0x55>
+  800d3a:	eb e2                	jmp    800d1e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d3c:	40 f6 c7 01          	test   $0x1,%dil
+  800d40:	74 06                	je     800d48 <memset+0x70>
+  800d42:	88 07                	mov    %al,(%rdi)
+  800d44:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d48:	40 f6 c7 02          	test   $0x2,%dil
+  800d4c:	74 07                	je     800d55 <memset+0x7d>
+  800d4e:	66 89 07             	mov    %ax,(%rdi)
+  800d51:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d55:	40 f6 c7 04          	test   $0x4,%dil
+  800d59:	74 a9                	je     800d04 <memset+0x2c>
+  800d5b:	89 07                	mov    %eax,(%rdi)
+  800d5d:	48 83 c7 04          	add    $0x4,%rdi
+  800d61:	eb a1                	jmp    800d04 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d63:	41 f6 c1 04          	test   $0x4,%r9b
+  800d67:	74 06                	je     800d6f <memset+0x97>
+  800d69:	89 07                	mov    %eax,(%rdi)
+  800d6b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d6f:	41 f6 c1 02          	test   $0x2,%r9b
+  800d73:	74 07                	je     800d7c <memset+0xa4>
+  800d75:	66 89 07             	mov    %ax,(%rdi)
+  800d78:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d7c:	41 f6 c1 01          	test   $0x1,%r9b
+  800d80:	74 9c                	je     800d1e <memset+0x46>
+  800d82:	88 07                	mov    %al,(%rdi)
+  800d84:	eb 98                	jmp    800d1e <memset+0x46>
+
+0000000000800d86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d86:	48 89 f8             	mov    %rdi,%rax
+  800d89:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d8c:	48 39 fe             	cmp    %rdi,%rsi
+  800d8f:	73 3b                	jae    800dcc <memmove+0x46>
+  800d91:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d95:	48 39 d7             	cmp    %rdx,%rdi
+  800d98:	73 32                	jae    800dcc <memmove+0x46>
+        s += n;
+        d += n;
+  800d9a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d9e:	48 89 d6             	mov    %rdx,%rsi
+  800da1:	48 09 fe             	or     %rdi,%rsi
+  800da4:	48 09 ce             	or     %rcx,%rsi
+  800da7:	40 f6 c6 07          	test   $0x7,%sil
+  800dab:	75 12                	jne    800dbf <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dad:	48 83 ef 08          	sub    $0x8,%rdi
+  800db1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800db5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800db9:	fd                   	std
+  800dba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dbd:	fc                   	cld
+  800dbe:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dbf:	48 83 ef 01          	sub    $0x1,%rdi
+  800dc3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dc7:	fd                   	std
+  800dc8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dca:	eb f1                	jmp    800dbd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dcc:	48 89 f2             	mov    %rsi,%rdx
+  800dcf:	48 09 c2             	or     %rax,%rdx
+  800dd2:	48 09 ca             	or     %rcx,%rdx
+  800dd5:	f6 c2 07             	test   $0x7,%dl
+  800dd8:	75 0c                	jne    800de6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dda:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dde:	48 89 c7             	mov    %rax,%rdi
+  800de1:	fc                   	cld
+  800de2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800de5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800de6:	48 89 c7             	mov    %rax,%rdi
+  800de9:	fc                   	cld
+  800dea:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800dec:	c3                   	ret
+
+0000000000800ded <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ded:	55                   	push   %rbp
+  800dee:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800df1:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+}
+  800dfd:	5d                   	pop    %rbp
+  800dfe:	c3                   	ret
+
+0000000000800dff <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dff:	55                   	push   %rbp
+  800e00:	48 89 e5             	mov    %rsp,%rbp
+  800e03:	41 57                	push   %r15
+  800e05:	41 56                	push   %r14
+  800e07:	41 55                	push   %r13
+  800e09:	41 54                	push   %r12
+  800e0b:	53                   	push   %rbx
+  800e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  800e10:	49 89 fe             	mov    %rdi,%r14
+  800e13:	49 89 f7             	mov    %rsi,%r15
+  800e16:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e19:	48 89 f7             	mov    %rsi,%rdi
+  800e1c:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  800e23:	00 00 00 
+  800e26:	ff d0                	call   *%rax
+  800e28:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e2b:	48 89 de             	mov    %rbx,%rsi
+  800e2e:	4c 89 f7             	mov    %r14,%rdi
+  800e31:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  800e38:	00 00 00 
+  800e3b:	ff d0                	call   *%rax
+  800e3d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e40:	48 39 c3             	cmp    %rax,%rbx
+  800e43:	74 36                	je     800e7b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e45:	48 89 d8             	mov    %rbx,%rax
+  800e48:	4c 29 e8             	sub    %r13,%rax
+  800e4b:	49 39 c4             	cmp    %rax,%r12
+  800e4e:	73 31                	jae    800e81 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e50:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e55:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e59:	4c 89 fe             	mov    %r15,%rsi
+  800e5c:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e68:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e6c:	48 83 c4 08          	add    $0x8,%rsp
+  800e70:	5b                   	pop    %rbx
+  800e71:	41 5c                	pop    %r12
+  800e73:	41 5d                	pop    %r13
+  800e75:	41 5e                	pop    %r14
+  800e77:	41 5f                	pop    %r15
+  800e79:	5d                   	pop    %rbp
+  800e7a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e7b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e7f:	eb eb                	jmp    800e6c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e81:	48 83 eb 01          	sub    $0x1,%rbx
+  800e85:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e89:	48 89 da             	mov    %rbx,%rdx
+  800e8c:	4c 89 fe             	mov    %r15,%rsi
+  800e8f:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  800e96:	00 00 00 
+  800e99:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e9b:	49 01 de             	add    %rbx,%r14
+  800e9e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ea3:	eb c3                	jmp    800e68 <strlcat+0x69>
+
+0000000000800ea5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ea5:	48 85 d2             	test   %rdx,%rdx
+  800ea8:	74 2d                	je     800ed7 <memcmp+0x32>
+  800eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eaf:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eb3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eb8:	44 38 c1             	cmp    %r8b,%cl
+  800ebb:	75 0f                	jne    800ecc <memcmp+0x27>
+    while (n-- > 0) {
+  800ebd:	48 83 c0 01          	add    $0x1,%rax
+  800ec1:	48 39 c2             	cmp    %rax,%rdx
+  800ec4:	75 e9                	jne    800eaf <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ecc:	0f b6 c1             	movzbl %cl,%eax
+  800ecf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ed3:	44 29 c0             	sub    %r8d,%eax
+  800ed6:	c3                   	ret
+    return 0;
+  800ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800edc:	c3                   	ret
+
+0000000000800edd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800edd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ee1:	48 39 c7             	cmp    %rax,%rdi
+  800ee4:	73 0f                	jae    800ef5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ee6:	40 38 37             	cmp    %sil,(%rdi)
+  800ee9:	74 0e                	je     800ef9 <memfind+0x1c>
+    for (; src < end; src++) {
+  800eeb:	48 83 c7 01          	add    $0x1,%rdi
+  800eef:	48 39 f8             	cmp    %rdi,%rax
+  800ef2:	75 f2                	jne    800ee6 <memfind+0x9>
+  800ef4:	c3                   	ret
+  800ef5:	48 89 f8             	mov    %rdi,%rax
+  800ef8:	c3                   	ret
+  800ef9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800efc:	c3                   	ret
+
+0000000000800efd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800efd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f00:	0f b6 37             	movzbl (%rdi),%esi
+  800f03:	40 80 fe 20          	cmp    $0x20,%sil
+  800f07:	74 06                	je     800f0f <strtol+0x12>
+  800f09:	40 80 fe 09          	cmp    $0x9,%sil
+  800f0d:	75 13                	jne    800f22 <strtol+0x25>
+  800f0f:	48 83 c7 01          	add    $0x1,%rdi
+  800f13:	0f b6 37             	movzbl (%rdi),%esi
+  800f16:	40 80 fe 20          	cmp    $0x20,%sil
+  800f1a:	74 f3                	je     800f0f <strtol+0x12>
+  800f1c:	40 80 fe 09          	cmp    $0x9,%sil
+  800f20:	74 ed                	je     800f0f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f22:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f25:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f28:	3c 01                	cmp    $0x1,%al
+  800f2a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f2e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f34:	75 0f                	jne    800f45 <strtol+0x48>
+  800f36:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f39:	74 14                	je     800f4f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f3b:	85 d2                	test   %edx,%edx
+  800f3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f42:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f45:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f4a:	4c 63 ca             	movslq %edx,%r9
+  800f4d:	eb 36                	jmp    800f85 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f4f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f53:	74 0f                	je     800f64 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f55:	85 d2                	test   %edx,%edx
+  800f57:	75 ec                	jne    800f45 <strtol+0x48>
+        s++;
+  800f59:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f5d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f62:	eb e1                	jmp    800f45 <strtol+0x48>
+        s += 2;
+  800f64:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f68:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f6d:	eb d6                	jmp    800f45 <strtol+0x48>
+            dig -= '0';
+  800f6f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f72:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f76:	41 39 d0             	cmp    %edx,%r8d
+  800f79:	7d 21                	jge    800f9c <strtol+0x9f>
+        val = val * base + dig;
+  800f7b:	49 0f af c1          	imul   %r9,%rax
+  800f7f:	0f b6 c9             	movzbl %cl,%ecx
+  800f82:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f85:	48 83 c7 01          	add    $0x1,%rdi
+  800f89:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f8d:	80 f9 39             	cmp    $0x39,%cl
+  800f90:	76 dd                	jbe    800f6f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f92:	80 f9 7b             	cmp    $0x7b,%cl
+  800f95:	77 05                	ja     800f9c <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f97:	83 e9 57             	sub    $0x57,%ecx
+  800f9a:	eb d6                	jmp    800f72 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f9c:	4d 85 d2             	test   %r10,%r10
+  800f9f:	74 03                	je     800fa4 <strtol+0xa7>
+  800fa1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fa4:	48 89 c2             	mov    %rax,%rdx
+  800fa7:	48 f7 da             	neg    %rdx
+  800faa:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fae:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fb2:	c3                   	ret
+
+0000000000800fb3 <strrev>:
+
+void
+strrev(char *str)
+{
+  800fb3:	55                   	push   %rbp
+  800fb4:	48 89 e5             	mov    %rsp,%rbp
+  800fb7:	53                   	push   %rbx
+  800fb8:	48 83 ec 08          	sub    $0x8,%rsp
+  800fbc:	48 89 fb             	mov    %rdi,%rbx
+	int i;
+	int j;
+	unsigned char a;
+	unsigned len = strlen((const char *)str);
+  800fbf:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fcb:	83 e8 01             	sub    $0x1,%eax
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	7e 22                	jle    800ff4 <strrev+0x41>
+  800fd2:	48 98                	cltq
+  800fd4:	ba 00 00 00 00       	mov    $0x0,%edx
+	{
+		a = str[i];
+  800fd9:	0f b6 0c 13          	movzbl (%rbx,%rdx,1),%ecx
+		str[i] = str[j];
+  800fdd:	0f b6 34 03          	movzbl (%rbx,%rax,1),%esi
+  800fe1:	40 88 34 13          	mov    %sil,(%rbx,%rdx,1)
+		str[j] = a;
+  800fe5:	88 0c 03             	mov    %cl,(%rbx,%rax,1)
+	for (i = 0, j = len - 1; i < j; i++, j--)
+  800fe8:	48 83 c2 01          	add    $0x1,%rdx
+  800fec:	48 83 e8 01          	sub    $0x1,%rax
+  800ff0:	39 c2                	cmp    %eax,%edx
+  800ff2:	7c e5                	jl     800fd9 <strrev+0x26>
+	}
+}
+  800ff4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff8:	c9                   	leave
+  800ff9:	c3                   	ret
+
+0000000000800ffa <itoa>:
+int
+itoa(int num, char *str, int len, int base) {
+	int sum = num;
+	int i = 0;
+	int digit;
+	if (len == 0)
+  800ffa:	85 d2                	test   %edx,%edx
+  800ffc:	0f 84 80 00 00 00    	je     801082 <itoa+0x88>
+itoa(int num, char *str, int len, int base) {
+  801002:	55                   	push   %rbp
+  801003:	48 89 e5             	mov    %rsp,%rbp
+  801006:	53                   	push   %rbx
+  801007:	48 83 ec 08          	sub    $0x8,%rsp
+  80100b:	49 89 f2             	mov    %rsi,%r10
+  80100e:	41 89 d3             	mov    %edx,%r11d
+  801011:	49 89 f0             	mov    %rsi,%r8
+	if (len == 0)
+  801014:	be 01 00 00 00       	mov    $0x1,%esi
+		if (digit < 0xA)
+			str[i++] = '0' + digit;
+		else
+			str[i++] = 'A' + digit - 0xA;
+		sum /= base;
+	}while (sum && (i < (len - 1)));
+  801019:	8d 5a ff             	lea    -0x1(%rdx),%ebx
+  80101c:	eb 20                	jmp    80103e <itoa+0x44>
+			str[i++] = '0' + digit;
+  80101e:	41 89 f1             	mov    %esi,%r9d
+  801021:	83 c2 30             	add    $0x30,%edx
+  801024:	41 88 10             	mov    %dl,(%r8)
+		sum /= base;
+  801027:	89 f8                	mov    %edi,%eax
+  801029:	99                   	cltd
+  80102a:	f7 f9                	idiv   %ecx
+  80102c:	89 c7                	mov    %eax,%edi
+	}while (sum && (i < (len - 1)));
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	74 2e                	je     801060 <itoa+0x66>
+  801032:	83 c6 01             	add    $0x1,%esi
+  801035:	49 83 c0 01          	add    $0x1,%r8
+  801039:	44 39 cb             	cmp    %r9d,%ebx
+  80103c:	7e 15                	jle    801053 <itoa+0x59>
+		digit = sum % base;
+  80103e:	89 f8                	mov    %edi,%eax
+  801040:	99                   	cltd
+  801041:	f7 f9                	idiv   %ecx
+		if (digit < 0xA)
+  801043:	83 fa 09             	cmp    $0x9,%edx
+  801046:	7e d6                	jle    80101e <itoa+0x24>
+			str[i++] = 'A' + digit - 0xA;
+  801048:	41 89 f1             	mov    %esi,%r9d
+  80104b:	83 c2 37             	add    $0x37,%edx
+  80104e:	41 88 10             	mov    %dl,(%r8)
+  801051:	eb d4                	jmp    801027 <itoa+0x2d>
+	if (i == (len - 1) && sum)
+  801053:	41 83 eb 01          	sub    $0x1,%r11d
+  801057:	45 39 cb             	cmp    %r9d,%r11d
+  80105a:	75 04                	jne    801060 <itoa+0x66>
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	75 28                	jne    801088 <itoa+0x8e>
+		return -1;
+	str[i] = '\0';
+  801060:	4d 63 c9             	movslq %r9d,%r9
+  801063:	43 c6 04 0a 00       	movb   $0x0,(%r10,%r9,1)
+	strrev(str);
+  801068:	4c 89 d7             	mov    %r10,%rdi
+  80106b:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  801072:	00 00 00 
+  801075:	ff d0                	call   *%rax
+	return 0;
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+		return -1;
+  801082:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801087:	c3                   	ret
+		return -1;
+  801088:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80108d:	eb ed                	jmp    80107c <itoa+0x82>
+
+000000000080108f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80108f:	55                   	push   %rbp
+  801090:	48 89 e5             	mov    %rsp,%rbp
+  801093:	53                   	push   %rbx
+  801094:	48 89 fa             	mov    %rdi,%rdx
+  801097:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+
+00000000008010bc <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e5:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010eb:	c9                   	leave
+  8010ec:	c3                   	ret
+
+00000000008010ed <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	53                   	push   %rbx
+  8010f2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010f6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f9:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801108:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110d:	be 00 00 00 00       	mov    $0x0,%esi
+  801112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801118:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80111a:	48 85 c0             	test   %rax,%rax
+  80111d:	7f 06                	jg     801125 <sys_env_destroy+0x38>
+}
+  80111f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801125:	49 89 c0             	mov    %rax,%r8
+  801128:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80112d:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  801134:	00 00 00 
+  801137:	be 26 00 00 00       	mov    $0x26,%esi
+  80113c:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  801143:	00 00 00 
+  801146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114b:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801152:	00 00 00 
+  801155:	41 ff d1             	call   *%r9
+
+0000000000801158 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801158:	55                   	push   %rbp
+  801159:	48 89 e5             	mov    %rsp,%rbp
+  80115c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80115d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801162:	ba 00 00 00 00       	mov    $0x0,%edx
+  801167:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80116c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801171:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801176:	be 00 00 00 00       	mov    $0x0,%esi
+  80117b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801181:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+
+0000000000801189 <sys_yield>:
+
+void
+sys_yield(void) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b2:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b8:	c9                   	leave
+  8011b9:	c3                   	ret
+
+00000000008011ba <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	53                   	push   %rbx
+  8011bf:	48 89 fa             	mov    %rdi,%rdx
+  8011c2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ca:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011d1:	00 00 00 
+  8011d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+
+00000000008011ec <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011ec:	55                   	push   %rbp
+  8011ed:	48 89 e5             	mov    %rsp,%rbp
+  8011f0:	53                   	push   %rbx
+  8011f1:	49 89 f8             	mov    %rdi,%r8
+  8011f4:	48 89 d3             	mov    %rdx,%rbx
+  8011f7:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011fa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ff:	4c 89 c2             	mov    %r8,%rdx
+  801202:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801205:	be 00 00 00 00       	mov    $0x0,%esi
+  80120a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801210:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801212:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801216:	c9                   	leave
+  801217:	c3                   	ret
+
+0000000000801218 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801218:	55                   	push   %rbp
+  801219:	48 89 e5             	mov    %rsp,%rbp
+  80121c:	53                   	push   %rbx
+  80121d:	48 83 ec 08          	sub    $0x8,%rsp
+  801221:	89 f8                	mov    %edi,%eax
+  801223:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801226:	48 63 f9             	movslq %ecx,%rdi
+  801229:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80122c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801231:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801241:	48 85 c0             	test   %rax,%rax
+  801244:	7f 06                	jg     80124c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124c:	49 89 c0             	mov    %rax,%r8
+  80124f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801254:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  80125b:	00 00 00 
+  80125e:	be 26 00 00 00       	mov    $0x26,%esi
+  801263:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  80126a:	00 00 00 
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801272:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801279:	00 00 00 
+  80127c:	41 ff d1             	call   *%r9
+
+000000000080127f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+  801283:	53                   	push   %rbx
+  801284:	48 83 ec 08          	sub    $0x8,%rsp
+  801288:	89 f8                	mov    %edi,%eax
+  80128a:	49 89 f2             	mov    %rsi,%r10
+  80128d:	48 89 cf             	mov    %rcx,%rdi
+  801290:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801293:	48 63 da             	movslq %edx,%rbx
+  801296:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801299:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a1:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a6:	48 85 c0             	test   %rax,%rax
+  8012a9:	7f 06                	jg     8012b1 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b1:	49 89 c0             	mov    %rax,%r8
+  8012b4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012b9:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  8012c0:	00 00 00 
+  8012c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c8:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  8012cf:	00 00 00 
+  8012d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d7:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  8012de:	00 00 00 
+  8012e1:	41 ff d1             	call   *%r9
+
+00000000008012e4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012e4:	55                   	push   %rbp
+  8012e5:	48 89 e5             	mov    %rsp,%rbp
+  8012e8:	53                   	push   %rbx
+  8012e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ed:	48 89 f1             	mov    %rsi,%rcx
+  8012f0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801300:	be 00 00 00 00       	mov    $0x0,%esi
+  801305:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130d:	48 85 c0             	test   %rax,%rax
+  801310:	7f 06                	jg     801318 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801312:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801316:	c9                   	leave
+  801317:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801318:	49 89 c0             	mov    %rax,%r8
+  80131b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801320:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  801327:	00 00 00 
+  80132a:	be 26 00 00 00       	mov    $0x26,%esi
+  80132f:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  801336:	00 00 00 
+  801339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133e:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801345:	00 00 00 
+  801348:	41 ff d1             	call   *%r9
+
+000000000080134b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80134b:	55                   	push   %rbp
+  80134c:	48 89 e5             	mov    %rsp,%rbp
+  80134f:	53                   	push   %rbx
+  801350:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801354:	48 63 ce             	movslq %esi,%rcx
+  801357:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801369:	be 00 00 00 00       	mov    $0x0,%esi
+  80136e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801374:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801376:	48 85 c0             	test   %rax,%rax
+  801379:	7f 06                	jg     801381 <sys_env_set_status+0x36>
+}
+  80137b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137f:	c9                   	leave
+  801380:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801381:	49 89 c0             	mov    %rax,%r8
+  801384:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801389:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  801390:	00 00 00 
+  801393:	be 26 00 00 00       	mov    $0x26,%esi
+  801398:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  80139f:	00 00 00 
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a7:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  8013ae:	00 00 00 
+  8013b1:	41 ff d1             	call   *%r9
+
+00000000008013b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013b4:	55                   	push   %rbp
+  8013b5:	48 89 e5             	mov    %rsp,%rbp
+  8013b8:	53                   	push   %rbx
+  8013b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013df:	48 85 c0             	test   %rax,%rax
+  8013e2:	7f 06                	jg     8013ea <sys_env_set_trapframe+0x36>
+}
+  8013e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e8:	c9                   	leave
+  8013e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ea:	49 89 c0             	mov    %rax,%r8
+  8013ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013f2:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  8013f9:	00 00 00 
+  8013fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801401:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  801408:	00 00 00 
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801410:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801417:	00 00 00 
+  80141a:	41 ff d1             	call   *%r9
+
+000000000080141d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+  801421:	53                   	push   %rbx
+  801422:	48 83 ec 08          	sub    $0x8,%rsp
+  801426:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801429:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801436:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143b:	be 00 00 00 00       	mov    $0x0,%esi
+  801440:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801446:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801448:	48 85 c0             	test   %rax,%rax
+  80144b:	7f 06                	jg     801453 <sys_env_set_pgfault_upcall+0x36>
+}
+  80144d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801451:	c9                   	leave
+  801452:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801453:	49 89 c0             	mov    %rax,%r8
+  801456:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80145b:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  801462:	00 00 00 
+  801465:	be 26 00 00 00       	mov    $0x26,%esi
+  80146a:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  801471:	00 00 00 
+  801474:	b8 00 00 00 00       	mov    $0x0,%eax
+  801479:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801480:	00 00 00 
+  801483:	41 ff d1             	call   *%r9
+
+0000000000801486 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801486:	55                   	push   %rbp
+  801487:	48 89 e5             	mov    %rsp,%rbp
+  80148a:	53                   	push   %rbx
+  80148b:	89 f8                	mov    %edi,%eax
+  80148d:	49 89 f1             	mov    %rsi,%r9
+  801490:	48 89 d3             	mov    %rdx,%rbx
+  801493:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801496:	49 63 f0             	movslq %r8d,%rsi
+  801499:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014aa:	cd 30                	int    $0x30
+}
+  8014ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+
+00000000008014b2 <sys_ipc_recv_timed>:
+sys_ipc_recv(void *dstva, size_t size) {
+    return sys_ipc_recv_timed(dstva, size, 0);
+}
+
+int
+sys_ipc_recv_timed(void *dstva, size_t size, int deadline) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+  8014b6:	53                   	push   %rbx
+  8014b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bb:	48 89 f1             	mov    %rsi,%rcx
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+  8014be:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c6:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014db:	48 85 c0             	test   %rax,%rax
+  8014de:	7f 06                	jg     8014e6 <sys_ipc_recv_timed+0x34>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e4:	c9                   	leave
+  8014e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e6:	49 89 c0             	mov    %rax,%r8
+  8014e9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014ee:	48 ba e8 3c 80 00 00 	movabs $0x803ce8,%rdx
+  8014f5:	00 00 00 
+  8014f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fd:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  801504:	00 00 00 
+  801507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150c:	49 b9 79 34 80 00 00 	movabs $0x803479,%r9
+  801513:	00 00 00 
+  801516:	41 ff d1             	call   *%r9
+
+0000000000801519 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801519:	55                   	push   %rbp
+  80151a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_timed(dstva, size, 0);
+  80151d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801522:	48 b8 b2 14 80 00 00 	movabs $0x8014b2,%rax
+  801529:	00 00 00 
+  80152c:	ff d0                	call   *%rax
+}
+  80152e:	5d                   	pop    %rbp
+  80152f:	c3                   	ret
+
+0000000000801530 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+  801534:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801535:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80153a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801549:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154e:	be 00 00 00 00       	mov    $0x0,%esi
+  801553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801559:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80155b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+
+0000000000801561 <sys_irq_wait>:
+
+int
+sys_irq_wait(uint8_t irq, int seen) {
+  801561:	55                   	push   %rbp
+  801562:	48 89 e5             	mov    %rsp,%rbp
+  801565:	53                   	push   %rbx
+    return syscall(SYS_irq_wait, 0, irq, seen, 0, 0, 0, 0);
+  801566:	48 63 ce             	movslq %esi,%rcx
+  801569:	40 0f b6 d7          	movzbl %dil,%edx
+    register uintptr_t _a0 asm("rax") = num,
+  80156d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801577:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157c:	be 00 00 00 00       	mov    $0x0,%esi
+  801581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801587:	cd 30                	int    $0x30
+}
+  801589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158d:	c9                   	leave
+  80158e:	c3                   	ret
+
+000000000080158f <sys_region_phys>:
+
+int64_t
+sys_region_phys(const void *va, bool write) {
+  80158f:	55                   	push   %rbp
+  801590:	48 89 e5             	mov    %rsp,%rbp
+  801593:	53                   	push   %rbx
+  801594:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_region_phys, 0, (uintptr_t)va, write, 0, 0, 0, 0);
+  801597:	40 0f b6 ce          	movzbl %sil,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80159b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8015af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b5:	cd 30                	int    $0x30
+}
+  8015b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+
+00000000008015bd <sys_alloc_dma>:
+
+int64_t
+sys_alloc_dma(void *va, size_t size, int perm) {
+  8015bd:	55                   	push   %rbp
+  8015be:	48 89 e5             	mov    %rsp,%rbp
+  8015c1:	53                   	push   %rbx
+  8015c2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_alloc_dma, 0, (uintptr_t)va, size, perm, 0, 0, 0);
+  8015c5:	48 63 da             	movslq %edx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cd:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e0:	cd 30                	int    $0x30
+}
+  8015e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e6:	c9                   	leave
+  8015e7:	c3                   	ret
+
+00000000008015e8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015ef:	ff ff ff 
+  8015f2:	48 01 f8             	add    %rdi,%rax
+  8015f5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8015f9:	c3                   	ret
+
+00000000008015fa <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015fa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801601:	ff ff ff 
+  801604:	48 01 f8             	add    %rdi,%rax
+  801607:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80160b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801611:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801615:	c3                   	ret
+
+0000000000801616 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801616:	55                   	push   %rbp
+  801617:	48 89 e5             	mov    %rsp,%rbp
+  80161a:	41 57                	push   %r15
+  80161c:	41 56                	push   %r14
+  80161e:	41 55                	push   %r13
+  801620:	41 54                	push   %r12
+  801622:	53                   	push   %rbx
+  801623:	48 83 ec 08          	sub    $0x8,%rsp
+  801627:	49 89 ff             	mov    %rdi,%r15
+  80162a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80162f:	49 bd 35 31 80 00 00 	movabs $0x803135,%r13
+  801636:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801639:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80163f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801642:	48 89 df             	mov    %rbx,%rdi
+  801645:	41 ff d5             	call   *%r13
+  801648:	83 e0 04             	and    $0x4,%eax
+  80164b:	74 17                	je     801664 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80164d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801654:	4c 39 f3             	cmp    %r14,%rbx
+  801657:	75 e6                	jne    80163f <fd_alloc+0x29>
+  801659:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80165f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801664:	4d 89 27             	mov    %r12,(%r15)
+}
+  801667:	48 83 c4 08          	add    $0x8,%rsp
+  80166b:	5b                   	pop    %rbx
+  80166c:	41 5c                	pop    %r12
+  80166e:	41 5d                	pop    %r13
+  801670:	41 5e                	pop    %r14
+  801672:	41 5f                	pop    %r15
+  801674:	5d                   	pop    %rbp
+  801675:	c3                   	ret
+
+0000000000801676 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801676:	83 ff 1f             	cmp    $0x1f,%edi
+  801679:	77 39                	ja     8016b4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80167b:	55                   	push   %rbp
+  80167c:	48 89 e5             	mov    %rsp,%rbp
+  80167f:	41 54                	push   %r12
+  801681:	53                   	push   %rbx
+  801682:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801685:	48 63 df             	movslq %edi,%rbx
+  801688:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80168f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801693:	48 89 df             	mov    %rbx,%rdi
+  801696:	48 b8 35 31 80 00 00 	movabs $0x803135,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+  8016a2:	a8 04                	test   $0x4,%al
+  8016a4:	74 14                	je     8016ba <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016a6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016af:	5b                   	pop    %rbx
+  8016b0:	41 5c                	pop    %r12
+  8016b2:	5d                   	pop    %rbp
+  8016b3:	c3                   	ret
+        return -E_INVAL;
+  8016b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016b9:	c3                   	ret
+        return -E_INVAL;
+  8016ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016bf:	eb ee                	jmp    8016af <fd_lookup+0x39>
+
+00000000008016c1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	41 54                	push   %r12
+  8016c7:	53                   	push   %rbx
+  8016c8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016cb:	48 b8 c0 3d 80 00 00 	movabs $0x803dc0,%rax
+  8016d2:	00 00 00 
+  8016d5:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8016dc:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8016df:	39 3b                	cmp    %edi,(%rbx)
+  8016e1:	74 47                	je     80172a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8016e3:	48 83 c0 08          	add    $0x8,%rax
+  8016e7:	48 8b 18             	mov    (%rax),%rbx
+  8016ea:	48 85 db             	test   %rbx,%rbx
+  8016ed:	75 f0                	jne    8016df <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016ef:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8016f6:	00 00 00 
+  8016f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8016ff:	89 fa                	mov    %edi,%edx
+  801701:	48 bf 18 3d 80 00 00 	movabs $0x803d18,%rdi
+  801708:	00 00 00 
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	48 b9 67 02 80 00 00 	movabs $0x800267,%rcx
+  801717:	00 00 00 
+  80171a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80171c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801721:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801725:	5b                   	pop    %rbx
+  801726:	41 5c                	pop    %r12
+  801728:	5d                   	pop    %rbp
+  801729:	c3                   	ret
+            return 0;
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	eb f0                	jmp    801721 <dev_lookup+0x60>
+
+0000000000801731 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801731:	55                   	push   %rbp
+  801732:	48 89 e5             	mov    %rsp,%rbp
+  801735:	41 55                	push   %r13
+  801737:	41 54                	push   %r12
+  801739:	53                   	push   %rbx
+  80173a:	48 83 ec 18          	sub    $0x18,%rsp
+  80173e:	48 89 fb             	mov    %rdi,%rbx
+  801741:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801744:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80174b:	ff ff ff 
+  80174e:	48 01 df             	add    %rbx,%rdi
+  801751:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801755:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801759:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801760:	00 00 00 
+  801763:	ff d0                	call   *%rax
+  801765:	41 89 c5             	mov    %eax,%r13d
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 06                	js     801772 <fd_close+0x41>
+  80176c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801770:	74 1a                	je     80178c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801772:	45 84 e4             	test   %r12b,%r12b
+  801775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80177e:	44 89 e8             	mov    %r13d,%eax
+  801781:	48 83 c4 18          	add    $0x18,%rsp
+  801785:	5b                   	pop    %rbx
+  801786:	41 5c                	pop    %r12
+  801788:	41 5d                	pop    %r13
+  80178a:	5d                   	pop    %rbp
+  80178b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80178c:	8b 3b                	mov    (%rbx),%edi
+  80178e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801792:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801799:	00 00 00 
+  80179c:	ff d0                	call   *%rax
+  80179e:	41 89 c5             	mov    %eax,%r13d
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 1b                	js     8017c0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017a9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8017ad:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017b3:	48 85 c0             	test   %rax,%rax
+  8017b6:	74 08                	je     8017c0 <fd_close+0x8f>
+  8017b8:	48 89 df             	mov    %rbx,%rdi
+  8017bb:	ff d0                	call   *%rax
+  8017bd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017c5:	48 89 de             	mov    %rbx,%rsi
+  8017c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017cd:	48 b8 e4 12 80 00 00 	movabs $0x8012e4,%rax
+  8017d4:	00 00 00 
+  8017d7:	ff d0                	call   *%rax
+    return res;
+  8017d9:	eb a3                	jmp    80177e <fd_close+0x4d>
+
+00000000008017db <close>:
+
+int
+close(int fdnum) {
+  8017db:	55                   	push   %rbp
+  8017dc:	48 89 e5             	mov    %rsp,%rbp
+  8017df:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8017e3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017e7:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	78 15                	js     80180c <close+0x31>
+
+    return fd_close(fd, 1);
+  8017f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8017fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801800:	48 b8 31 17 80 00 00 	movabs $0x801731,%rax
+  801807:	00 00 00 
+  80180a:	ff d0                	call   *%rax
+}
+  80180c:	c9                   	leave
+  80180d:	c3                   	ret
+
+000000000080180e <close_all>:
+
+void
+close_all(void) {
+  80180e:	55                   	push   %rbp
+  80180f:	48 89 e5             	mov    %rsp,%rbp
+  801812:	41 54                	push   %r12
+  801814:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801815:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181a:	49 bc db 17 80 00 00 	movabs $0x8017db,%r12
+  801821:	00 00 00 
+  801824:	89 df                	mov    %ebx,%edi
+  801826:	41 ff d4             	call   *%r12
+  801829:	83 c3 01             	add    $0x1,%ebx
+  80182c:	83 fb 20             	cmp    $0x20,%ebx
+  80182f:	75 f3                	jne    801824 <close_all+0x16>
+}
+  801831:	5b                   	pop    %rbx
+  801832:	41 5c                	pop    %r12
+  801834:	5d                   	pop    %rbp
+  801835:	c3                   	ret
+
+0000000000801836 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	41 57                	push   %r15
+  80183c:	41 56                	push   %r14
+  80183e:	41 55                	push   %r13
+  801840:	41 54                	push   %r12
+  801842:	53                   	push   %rbx
+  801843:	48 83 ec 18          	sub    $0x18,%rsp
+  801847:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80184a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80184e:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801855:	00 00 00 
+  801858:	ff d0                	call   *%rax
+  80185a:	89 c3                	mov    %eax,%ebx
+  80185c:	85 c0                	test   %eax,%eax
+  80185e:	0f 88 b8 00 00 00    	js     80191c <dup+0xe6>
+    close(newfdnum);
+  801864:	44 89 e7             	mov    %r12d,%edi
+  801867:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  80186e:	00 00 00 
+  801871:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801873:	4d 63 ec             	movslq %r12d,%r13
+  801876:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80187d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801881:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801885:	4c 89 ff             	mov    %r15,%rdi
+  801888:	49 be fa 15 80 00 00 	movabs $0x8015fa,%r14
+  80188f:	00 00 00 
+  801892:	41 ff d6             	call   *%r14
+  801895:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801898:	4c 89 ef             	mov    %r13,%rdi
+  80189b:	41 ff d6             	call   *%r14
+  80189e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018a1:	48 89 df             	mov    %rbx,%rdi
+  8018a4:	48 b8 35 31 80 00 00 	movabs $0x803135,%rax
+  8018ab:	00 00 00 
+  8018ae:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018b0:	a8 04                	test   $0x4,%al
+  8018b2:	74 2b                	je     8018df <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018b4:	41 89 c1             	mov    %eax,%r9d
+  8018b7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018bd:	4c 89 f1             	mov    %r14,%rcx
+  8018c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c5:	48 89 de             	mov    %rbx,%rsi
+  8018c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018cd:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+  8018d9:	89 c3                	mov    %eax,%ebx
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	78 4e                	js     80192d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8018df:	4c 89 ff             	mov    %r15,%rdi
+  8018e2:	48 b8 35 31 80 00 00 	movabs $0x803135,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8018f1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018f7:	4c 89 e9             	mov    %r13,%rcx
+  8018fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ff:	4c 89 fe             	mov    %r15,%rsi
+  801902:	bf 00 00 00 00       	mov    $0x0,%edi
+  801907:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  80190e:	00 00 00 
+  801911:	ff d0                	call   *%rax
+  801913:	89 c3                	mov    %eax,%ebx
+  801915:	85 c0                	test   %eax,%eax
+  801917:	78 14                	js     80192d <dup+0xf7>
+
+    return newfdnum;
+  801919:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80191c:	89 d8                	mov    %ebx,%eax
+  80191e:	48 83 c4 18          	add    $0x18,%rsp
+  801922:	5b                   	pop    %rbx
+  801923:	41 5c                	pop    %r12
+  801925:	41 5d                	pop    %r13
+  801927:	41 5e                	pop    %r14
+  801929:	41 5f                	pop    %r15
+  80192b:	5d                   	pop    %rbp
+  80192c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80192d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801932:	4c 89 ee             	mov    %r13,%rsi
+  801935:	bf 00 00 00 00       	mov    $0x0,%edi
+  80193a:	49 bc e4 12 80 00 00 	movabs $0x8012e4,%r12
+  801941:	00 00 00 
+  801944:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801947:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80194c:	4c 89 f6             	mov    %r14,%rsi
+  80194f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801954:	41 ff d4             	call   *%r12
+    return res;
+  801957:	eb c3                	jmp    80191c <dup+0xe6>
+
+0000000000801959 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801959:	55                   	push   %rbp
+  80195a:	48 89 e5             	mov    %rsp,%rbp
+  80195d:	41 56                	push   %r14
+  80195f:	41 55                	push   %r13
+  801961:	41 54                	push   %r12
+  801963:	53                   	push   %rbx
+  801964:	48 83 ec 10          	sub    $0x10,%rsp
+  801968:	89 fb                	mov    %edi,%ebx
+  80196a:	49 89 f4             	mov    %rsi,%r12
+  80196d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801970:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801974:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  80197b:	00 00 00 
+  80197e:	ff d0                	call   *%rax
+  801980:	85 c0                	test   %eax,%eax
+  801982:	78 4c                	js     8019d0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801984:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801988:	41 8b 3e             	mov    (%r14),%edi
+  80198b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80198f:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801996:	00 00 00 
+  801999:	ff d0                	call   *%rax
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	78 35                	js     8019d4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80199f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019a3:	83 e0 03             	and    $0x3,%eax
+  8019a6:	83 f8 01             	cmp    $0x1,%eax
+  8019a9:	74 2d                	je     8019d8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019b3:	48 85 c0             	test   %rax,%rax
+  8019b6:	74 56                	je     801a0e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019b8:	4c 89 ea             	mov    %r13,%rdx
+  8019bb:	4c 89 e6             	mov    %r12,%rsi
+  8019be:	4c 89 f7             	mov    %r14,%rdi
+  8019c1:	ff d0                	call   *%rax
+}
+  8019c3:	48 83 c4 10          	add    $0x10,%rsp
+  8019c7:	5b                   	pop    %rbx
+  8019c8:	41 5c                	pop    %r12
+  8019ca:	41 5d                	pop    %r13
+  8019cc:	41 5e                	pop    %r14
+  8019ce:	5d                   	pop    %rbp
+  8019cf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d0:	48 98                	cltq
+  8019d2:	eb ef                	jmp    8019c3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d4:	48 98                	cltq
+  8019d6:	eb eb                	jmp    8019c3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019d8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019df:	00 00 00 
+  8019e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019e8:	89 da                	mov    %ebx,%edx
+  8019ea:	48 bf 79 3d 80 00 00 	movabs $0x803d79,%rdi
+  8019f1:	00 00 00 
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	48 b9 67 02 80 00 00 	movabs $0x800267,%rcx
+  801a00:	00 00 00 
+  801a03:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a05:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a0c:	eb b5                	jmp    8019c3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a0e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a15:	eb ac                	jmp    8019c3 <read+0x6a>
+
+0000000000801a17 <readmap>:
+
+/* Read like read(), but a device that can may map the data at buf
+ * instead of copying it, replacing the pages mapped there.  Mapped
+ * pages are read-only, so buf is not for read() afterwards. */
+ssize_t
+readmap(int fdnum, void *buf, size_t n) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	41 56                	push   %r14
+  801a1d:	41 55                	push   %r13
+  801a1f:	41 54                	push   %r12
+  801a21:	53                   	push   %rbx
+  801a22:	48 83 ec 10          	sub    $0x10,%rsp
+  801a26:	89 fb                	mov    %edi,%ebx
+  801a28:	49 89 f4             	mov    %rsi,%r12
+  801a2b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a2e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a32:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 41                	js     801a83 <readmap+0x6c>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a42:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a46:	41 8b 3e             	mov    (%r14),%edi
+  801a49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a4d:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	85 c0                	test   %eax,%eax
+  801a5b:	78 35                	js     801a92 <readmap+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a5d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a61:	83 e0 03             	and    $0x3,%eax
+  801a64:	83 f8 01             	cmp    $0x1,%eax
+  801a67:	74 2d                	je     801a96 <readmap+0x7f>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801a69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a6d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a71:	48 85 c0             	test   %rax,%rax
+  801a74:	74 56                	je     801acc <readmap+0xb5>
+
+    return (*dev->dev_readmap)(fd, buf, n);
+  801a76:	4c 89 ea             	mov    %r13,%rdx
+  801a79:	4c 89 e6             	mov    %r12,%rsi
+  801a7c:	4c 89 f7             	mov    %r14,%rdi
+  801a7f:	ff d0                	call   *%rax
+  801a81:	eb 02                	jmp    801a85 <readmap+0x6e>
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a83:	48 98                	cltq
+}
+  801a85:	48 83 c4 10          	add    $0x10,%rsp
+  801a89:	5b                   	pop    %rbx
+  801a8a:	41 5c                	pop    %r12
+  801a8c:	41 5d                	pop    %r13
+  801a8e:	41 5e                	pop    %r14
+  801a90:	5d                   	pop    %rbp
+  801a91:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a92:	48 98                	cltq
+  801a94:	eb ef                	jmp    801a85 <readmap+0x6e>
+        cprintf("[%08x] readmap %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a96:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a9d:	00 00 00 
+  801aa0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801aa6:	89 da                	mov    %ebx,%edx
+  801aa8:	48 bf 38 3d 80 00 00 	movabs $0x803d38,%rdi
+  801aaf:	00 00 00 
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab7:	48 b9 67 02 80 00 00 	movabs $0x800267,%rcx
+  801abe:	00 00 00 
+  801ac1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ac3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801aca:	eb b9                	jmp    801a85 <readmap+0x6e>
+    if (!dev->dev_readmap) return read(fdnum, buf, n);
+  801acc:	4c 89 ea             	mov    %r13,%rdx
+  801acf:	4c 89 e6             	mov    %r12,%rsi
+  801ad2:	89 df                	mov    %ebx,%edi
+  801ad4:	48 b8 59 19 80 00 00 	movabs $0x801959,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+  801ae0:	eb a3                	jmp    801a85 <readmap+0x6e>
+
+0000000000801ae2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ae2:	55                   	push   %rbp
+  801ae3:	48 89 e5             	mov    %rsp,%rbp
+  801ae6:	41 57                	push   %r15
+  801ae8:	41 56                	push   %r14
+  801aea:	41 55                	push   %r13
+  801aec:	41 54                	push   %r12
+  801aee:	53                   	push   %rbx
+  801aef:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801af3:	48 85 d2             	test   %rdx,%rdx
+  801af6:	74 54                	je     801b4c <readn+0x6a>
+  801af8:	41 89 fd             	mov    %edi,%r13d
+  801afb:	49 89 f6             	mov    %rsi,%r14
+  801afe:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b01:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b06:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b0b:	49 bf 59 19 80 00 00 	movabs $0x801959,%r15
+  801b12:	00 00 00 
+  801b15:	4c 89 e2             	mov    %r12,%rdx
+  801b18:	48 29 f2             	sub    %rsi,%rdx
+  801b1b:	4c 01 f6             	add    %r14,%rsi
+  801b1e:	44 89 ef             	mov    %r13d,%edi
+  801b21:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	78 20                	js     801b48 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b28:	01 c3                	add    %eax,%ebx
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	74 08                	je     801b36 <readn+0x54>
+  801b2e:	48 63 f3             	movslq %ebx,%rsi
+  801b31:	4c 39 e6             	cmp    %r12,%rsi
+  801b34:	72 df                	jb     801b15 <readn+0x33>
+    }
+    return res;
+  801b36:	48 63 c3             	movslq %ebx,%rax
+}
+  801b39:	48 83 c4 08          	add    $0x8,%rsp
+  801b3d:	5b                   	pop    %rbx
+  801b3e:	41 5c                	pop    %r12
+  801b40:	41 5d                	pop    %r13
+  801b42:	41 5e                	pop    %r14
+  801b44:	41 5f                	pop    %r15
+  801b46:	5d                   	pop    %rbp
+  801b47:	c3                   	ret
+        if (inc < 0) return inc;
+  801b48:	48 98                	cltq
+  801b4a:	eb ed                	jmp    801b39 <readn+0x57>
+    int inc = 1, res = 0;
+  801b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b51:	eb e3                	jmp    801b36 <readn+0x54>
+
+0000000000801b53 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	41 56                	push   %r14
+  801b59:	41 55                	push   %r13
+  801b5b:	41 54                	push   %r12
+  801b5d:	53                   	push   %rbx
+  801b5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801b62:	89 fb                	mov    %edi,%ebx
+  801b64:	49 89 f4             	mov    %rsi,%r12
+  801b67:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b6a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b6e:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801b75:	00 00 00 
+  801b78:	ff d0                	call   *%rax
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	78 47                	js     801bc5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b7e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b82:	41 8b 3e             	mov    (%r14),%edi
+  801b85:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b89:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801b90:	00 00 00 
+  801b93:	ff d0                	call   *%rax
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 30                	js     801bc9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b99:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b9e:	74 2d                	je     801bcd <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ba0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ba4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	74 56                	je     801c03 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bad:	4c 89 ea             	mov    %r13,%rdx
+  801bb0:	4c 89 e6             	mov    %r12,%rsi
+  801bb3:	4c 89 f7             	mov    %r14,%rdi
+  801bb6:	ff d0                	call   *%rax
+}
+  801bb8:	48 83 c4 10          	add    $0x10,%rsp
+  801bbc:	5b                   	pop    %rbx
+  801bbd:	41 5c                	pop    %r12
+  801bbf:	41 5d                	pop    %r13
+  801bc1:	41 5e                	pop    %r14
+  801bc3:	5d                   	pop    %rbp
+  801bc4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc5:	48 98                	cltq
+  801bc7:	eb ef                	jmp    801bb8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bc9:	48 98                	cltq
+  801bcb:	eb eb                	jmp    801bb8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bcd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bd4:	00 00 00 
+  801bd7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bdd:	89 da                	mov    %ebx,%edx
+  801bdf:	48 bf 95 3d 80 00 00 	movabs $0x803d95,%rdi
+  801be6:	00 00 00 
+  801be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bee:	48 b9 67 02 80 00 00 	movabs $0x800267,%rcx
+  801bf5:	00 00 00 
+  801bf8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bfa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c01:	eb b5                	jmp    801bb8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c03:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c0a:	eb ac                	jmp    801bb8 <write+0x65>
+
+0000000000801c0c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c0c:	55                   	push   %rbp
+  801c0d:	48 89 e5             	mov    %rsp,%rbp
+  801c10:	53                   	push   %rbx
+  801c11:	48 83 ec 18          	sub    $0x18,%rsp
+  801c15:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c17:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c1b:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 0c                	js     801c37 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c2f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3b:	c9                   	leave
+  801c3c:	c3                   	ret
+
+0000000000801c3d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c3d:	55                   	push   %rbp
+  801c3e:	48 89 e5             	mov    %rsp,%rbp
+  801c41:	41 55                	push   %r13
+  801c43:	41 54                	push   %r12
+  801c45:	53                   	push   %rbx
+  801c46:	48 83 ec 18          	sub    $0x18,%rsp
+  801c4a:	89 fb                	mov    %edi,%ebx
+  801c4c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c4f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c53:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801c5a:	00 00 00 
+  801c5d:	ff d0                	call   *%rax
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 38                	js     801c9b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c63:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c67:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c6b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c6f:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801c76:	00 00 00 
+  801c79:	ff d0                	call   *%rax
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	78 1c                	js     801c9b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c7f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c84:	74 20                	je     801ca6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c8e:	48 85 c0             	test   %rax,%rax
+  801c91:	74 47                	je     801cda <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c93:	44 89 e6             	mov    %r12d,%esi
+  801c96:	4c 89 ef             	mov    %r13,%rdi
+  801c99:	ff d0                	call   *%rax
+}
+  801c9b:	48 83 c4 18          	add    $0x18,%rsp
+  801c9f:	5b                   	pop    %rbx
+  801ca0:	41 5c                	pop    %r12
+  801ca2:	41 5d                	pop    %r13
+  801ca4:	5d                   	pop    %rbp
+  801ca5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ca6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cad:	00 00 00 
+  801cb0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb6:	89 da                	mov    %ebx,%edx
+  801cb8:	48 bf 58 3d 80 00 00 	movabs $0x803d58,%rdi
+  801cbf:	00 00 00 
+  801cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc7:	48 b9 67 02 80 00 00 	movabs $0x800267,%rcx
+  801cce:	00 00 00 
+  801cd1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd8:	eb c1                	jmp    801c9b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cda:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cdf:	eb ba                	jmp    801c9b <ftruncate+0x5e>
+
+0000000000801ce1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	41 54                	push   %r12
+  801ce7:	53                   	push   %rbx
+  801ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  801cec:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cf3:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	78 4e                	js     801d51 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d03:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d07:	41 8b 3c 24          	mov    (%r12),%edi
+  801d0b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d0f:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 32                	js     801d51 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d23:	48 83 78 30 00       	cmpq   $0x0,0x30(%rax)
+  801d28:	74 30                	je     801d5a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d2a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d34:	00 00 00 
+    stat->st_isdir = 0;
+  801d37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d3e:	00 00 00 
+    stat->st_dev = dev;
+  801d41:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d48:	48 89 de             	mov    %rbx,%rsi
+  801d4b:	4c 89 e7             	mov    %r12,%rdi
+  801d4e:	ff 50 30             	call   *0x30(%rax)
+}
+  801d51:	48 83 c4 10          	add    $0x10,%rsp
+  801d55:	5b                   	pop    %rbx
+  801d56:	41 5c                	pop    %r12
+  801d58:	5d                   	pop    %rbp
+  801d59:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d5a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d5f:	eb f0                	jmp    801d51 <fstat+0x70>
+
+0000000000801d61 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+  801d65:	41 54                	push   %r12
+  801d67:	53                   	push   %rbx
+  801d68:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d70:	48 b8 b8 2a 80 00 00 	movabs $0x802ab8,%rax
+  801d77:	00 00 00 
+  801d7a:	ff d0                	call   *%rax
+  801d7c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 25                	js     801da7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d82:	4c 89 e6             	mov    %r12,%rsi
+  801d85:	89 c7                	mov    %eax,%edi
+  801d87:	48 b8 e1 1c 80 00 00 	movabs $0x801ce1,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+  801d93:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d96:	89 df                	mov    %ebx,%edi
+  801d98:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  801d9f:	00 00 00 
+  801da2:	ff d0                	call   *%rax
+
+    return res;
+  801da4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801da7:	89 d8                	mov    %ebx,%eax
+  801da9:	5b                   	pop    %rbx
+  801daa:	41 5c                	pop    %r12
+  801dac:	5d                   	pop    %rbp
+  801dad:	c3                   	ret
+
+0000000000801dae <create_snapshot>:
+
+/******************* snapshot start **************************************/
+int
+create_snapshot(char *comment, char *name) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	41 54                	push   %r12
+  801db4:	53                   	push   %rbx
+  801db5:	48 83 ec 10          	sub    $0x10,%rsp
+  801db9:	48 89 fb             	mov    %rdi,%rbx
+  801dbc:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801dbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc3:	bf 66 00 00 00       	mov    $0x66,%edi
+  801dc8:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801dcf:	00 00 00 
+  801dd2:	ff d0                	call   *%rax
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 1f                	js     801df7 <create_snapshot+0x49>
+
+    if (!dev->dev_sh_create) {
+  801dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ddc:	48 8b 40 40          	mov    0x40(%rax),%rax
+  801de0:	48 85 c0             	test   %rax,%rax
+  801de3:	74 1b                	je     801e00 <create_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_create)(comment,name);
+  801de5:	4c 89 e6             	mov    %r12,%rsi
+  801de8:	48 89 df             	mov    %rbx,%rdi
+  801deb:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df4:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801df7:	48 83 c4 10          	add    $0x10,%rsp
+  801dfb:	5b                   	pop    %rbx
+  801dfc:	41 5c                	pop    %r12
+  801dfe:	5d                   	pop    %rbp
+  801dff:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e00:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e05:	eb f0                	jmp    801df7 <create_snapshot+0x49>
+
+0000000000801e07 <print_snapshot_list>:
+
+int 
+print_snapshot_list() {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e0f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e13:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e18:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 1e                	js     801e46 <print_snapshot_list+0x3f>
+
+    if (!dev->dev_sh_print) {
+  801e28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e2c:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  801e30:	48 85 d2             	test   %rdx,%rdx
+  801e33:	74 13                	je     801e48 <print_snapshot_list+0x41>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_print)();
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3a:	ff d2                	call   *%rdx
+    if (res < 0) {
+  801e3c:	85 c0                	test   %eax,%eax
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e4d:	eb f7                	jmp    801e46 <print_snapshot_list+0x3f>
+
+0000000000801e4f <accept_snapshot>:
+
+int
+accept_snapshot(char *name) {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+  801e53:	53                   	push   %rbx
+  801e54:	48 83 ec 18          	sub    $0x18,%rsp
+  801e58:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801e5b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e5f:	bf 66 00 00 00       	mov    $0x66,%edi
+  801e64:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801e6b:	00 00 00 
+  801e6e:	ff d0                	call   *%rax
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 1c                	js     801e90 <accept_snapshot+0x41>
+
+    if (!dev->dev_sh_accept) {
+  801e74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e78:	48 8b 40 50          	mov    0x50(%rax),%rax
+  801e7c:	48 85 c0             	test   %rax,%rax
+  801e7f:	74 15                	je     801e96 <accept_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_accept)(name);
+  801e81:	48 89 df             	mov    %rbx,%rdi
+  801e84:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8d:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801e90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+        return -E_NOT_SUPP;
+  801e96:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9b:	eb f3                	jmp    801e90 <accept_snapshot+0x41>
+
+0000000000801e9d <delete_snapshot>:
+
+int
+delete_snapshot(char *name) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	53                   	push   %rbx
+  801ea2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea6:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ea9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ead:	bf 66 00 00 00       	mov    $0x66,%edi
+  801eb2:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	78 1c                	js     801ede <delete_snapshot+0x41>
+
+    if (!dev->dev_sh_delete) {
+  801ec2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ec6:	48 8b 40 58          	mov    0x58(%rax),%rax
+  801eca:	48 85 c0             	test   %rax,%rax
+  801ecd:	74 15                	je     801ee4 <delete_snapshot+0x47>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_delete)(name);
+  801ecf:	48 89 df             	mov    %rbx,%rdi
+  801ed2:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edb:	0f 4f c2             	cmovg  %edx,%eax
+        return res;
+    }
+    
+    return 0;
+}
+  801ede:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+        return -E_NOT_SUPP;
+  801ee4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ee9:	eb f3                	jmp    801ede <delete_snapshot+0x41>
+
+0000000000801eeb <gc_snapshots>:
+
+int
+gc_snapshots() {
+  801eeb:	55                   	push   %rbp
+  801eec:	48 89 e5             	mov    %rsp,%rbp
+  801eef:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ef3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ef7:	bf 66 00 00 00       	mov    $0x66,%edi
+  801efc:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801f03:	00 00 00 
+  801f06:	ff d0                	call   *%rax
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	78 14                	js     801f20 <gc_snapshots+0x35>
+
+    if (!dev->dev_sh_gc) {
+  801f0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f10:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  801f14:	48 85 d2             	test   %rdx,%rdx
+  801f17:	74 09                	je     801f22 <gc_snapshots+0x37>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_gc)();
+  801f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1e:	ff d2                	call   *%rdx
+
+    return res;
+}
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f22:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f27:	eb f7                	jmp    801f20 <gc_snapshots+0x35>
+
+0000000000801f29 <diff_snapshots>:
+
+int
+diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  801f29:	55                   	push   %rbp
+  801f2a:	48 89 e5             	mov    %rsp,%rbp
+  801f2d:	41 56                	push   %r14
+  801f2f:	41 55                	push   %r13
+  801f31:	41 54                	push   %r12
+  801f33:	53                   	push   %rbx
+  801f34:	48 83 ec 10          	sub    $0x10,%rsp
+  801f38:	48 89 fb             	mov    %rdi,%rbx
+  801f3b:	49 89 f4             	mov    %rsi,%r12
+  801f3e:	49 89 d5             	mov    %rdx,%r13
+  801f41:	49 89 ce             	mov    %rcx,%r14
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801f44:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f48:	bf 66 00 00 00       	mov    $0x66,%edi
+  801f4d:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 1b                	js     801f78 <diff_snapshots+0x4f>
+
+    if (!dev->dev_sh_diff) {
+  801f5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f61:	48 8b 40 68          	mov    0x68(%rax),%rax
+  801f65:	48 85 c0             	test   %rax,%rax
+  801f68:	74 1b                	je     801f85 <diff_snapshots+0x5c>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_diff)(from, to, cursor, records);
+  801f6a:	4c 89 f1             	mov    %r14,%rcx
+  801f6d:	4c 89 ea             	mov    %r13,%rdx
+  801f70:	4c 89 e6             	mov    %r12,%rsi
+  801f73:	48 89 df             	mov    %rbx,%rdi
+  801f76:	ff d0                	call   *%rax
+
+    return res;
+}
+  801f78:	48 83 c4 10          	add    $0x10,%rsp
+  801f7c:	5b                   	pop    %rbx
+  801f7d:	41 5c                	pop    %r12
+  801f7f:	41 5d                	pop    %r13
+  801f81:	41 5e                	pop    %r14
+  801f83:	5d                   	pop    %rbp
+  801f84:	c3                   	ret
+        return -E_NOT_SUPP;
+  801f85:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f8a:	eb ec                	jmp    801f78 <diff_snapshots+0x4f>
+
+0000000000801f8c <send_snapshot>:
+
+int
+send_snapshot(char *from, char *name, char *path) {
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+  801f90:	41 55                	push   %r13
+  801f92:	41 54                	push   %r12
+  801f94:	53                   	push   %rbx
+  801f95:	48 83 ec 18          	sub    $0x18,%rsp
+  801f99:	48 89 fb             	mov    %rdi,%rbx
+  801f9c:	49 89 f4             	mov    %rsi,%r12
+  801f9f:	49 89 d5             	mov    %rdx,%r13
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801fa2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa6:	bf 66 00 00 00       	mov    $0x66,%edi
+  801fab:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 18                	js     801fd3 <send_snapshot+0x47>
+
+    if (!dev->dev_sh_send) {
+  801fbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fbf:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801fc3:	48 85 c0             	test   %rax,%rax
+  801fc6:	74 16                	je     801fde <send_snapshot+0x52>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_send)(from, name, path);
+  801fc8:	4c 89 ea             	mov    %r13,%rdx
+  801fcb:	4c 89 e6             	mov    %r12,%rsi
+  801fce:	48 89 df             	mov    %rbx,%rdi
+  801fd1:	ff d0                	call   *%rax
+
+    return res;
+}
+  801fd3:	48 83 c4 18          	add    $0x18,%rsp
+  801fd7:	5b                   	pop    %rbx
+  801fd8:	41 5c                	pop    %r12
+  801fda:	41 5d                	pop    %r13
+  801fdc:	5d                   	pop    %rbp
+  801fdd:	c3                   	ret
+        return -E_NOT_SUPP;
+  801fde:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fe3:	eb ee                	jmp    801fd3 <send_snapshot+0x47>
+
+0000000000801fe5 <receive_snapshot>:
+
+int
+receive_snapshot(char *path) {
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+  801fe9:	53                   	push   %rbx
+  801fea:	48 83 ec 18          	sub    $0x18,%rsp
+  801fee:	48 89 fb             	mov    %rdi,%rbx
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  801ff1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ff5:	bf 66 00 00 00       	mov    $0x66,%edi
+  801ffa:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 12                	js     80201c <receive_snapshot+0x37>
+
+    if (!dev->dev_sh_recv) {
+  80200a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80200e:	48 8b 40 78          	mov    0x78(%rax),%rax
+  802012:	48 85 c0             	test   %rax,%rax
+  802015:	74 0b                	je     802022 <receive_snapshot+0x3d>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_sh_recv)(path);
+  802017:	48 89 df             	mov    %rbx,%rdi
+  80201a:	ff d0                	call   *%rax
+
+    return res;
+}
+  80201c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802020:	c9                   	leave
+  802021:	c3                   	ret
+        return -E_NOT_SUPP;
+  802022:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802027:	eb f3                	jmp    80201c <receive_snapshot+0x37>
+
+0000000000802029 <free_space_bytes>:
+/******************* snapshot end ****************************************/
+
+/******************* df start ********************************************/
+
+int
+free_space_bytes() {
+  802029:	55                   	push   %rbp
+  80202a:	48 89 e5             	mov    %rsp,%rbp
+  80202d:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802031:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802035:	bf 66 00 00 00       	mov    $0x66,%edi
+  80203a:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 17                	js     802061 <free_space_bytes+0x38>
+
+    if (!dev->dev_df_free) {
+  80204a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80204e:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  802055:	48 85 d2             	test   %rdx,%rdx
+  802058:	74 09                	je     802063 <free_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_free)();
+  80205a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205f:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+        return -E_NOT_SUPP;
+  802063:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802068:	eb f7                	jmp    802061 <free_space_bytes+0x38>
+
+000000000080206a <busy_space_bytes>:
+
+int
+busy_space_bytes() {
+  80206a:	55                   	push   %rbp
+  80206b:	48 89 e5             	mov    %rsp,%rbp
+  80206e:	48 83 ec 10          	sub    $0x10,%rsp
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  802072:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802076:	bf 66 00 00 00       	mov    $0x66,%edi
+  80207b:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  802082:	00 00 00 
+  802085:	ff d0                	call   *%rax
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 17                	js     8020a2 <busy_space_bytes+0x38>
+
+    if (!dev->dev_df_busy) {
+  80208b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80208f:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  802096:	48 85 d2             	test   %rdx,%rdx
+  802099:	74 09                	je     8020a4 <busy_space_bytes+0x3a>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_busy)();
+  80209b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a0:	ff d2                	call   *%rdx
+    
+    return res;
+}
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020a4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020a9:	eb f7                	jmp    8020a2 <busy_space_bytes+0x38>
+
+00000000008020ab <snapshots_space>:
+
+int
+snapshots_space(int start, struct Df_snapshot *records) {
+  8020ab:	55                   	push   %rbp
+  8020ac:	48 89 e5             	mov    %rsp,%rbp
+  8020af:	41 54                	push   %r12
+  8020b1:	53                   	push   %rbx
+  8020b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b6:	89 fb                	mov    %edi,%ebx
+  8020b8:	49 89 f4             	mov    %rsi,%r12
+    int dev_id_file = 'f';
+
+    int res;
+
+    struct Dev *dev;
+    if ((res = dev_lookup(dev_id_file, &dev)) < 0) return res;
+  8020bb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020bf:	bf 66 00 00 00       	mov    $0x66,%edi
+  8020c4:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  8020cb:	00 00 00 
+  8020ce:	ff d0                	call   *%rax
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	78 17                	js     8020eb <snapshots_space+0x40>
+
+    if (!dev->dev_df_snapshots) {
+  8020d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d8:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8020df:	48 85 c0             	test   %rax,%rax
+  8020e2:	74 10                	je     8020f4 <snapshots_space+0x49>
+        return -E_NOT_SUPP;
+    }
+
+    res = (*dev->dev_df_snapshots)(start, records);
+  8020e4:	4c 89 e6             	mov    %r12,%rsi
+  8020e7:	89 df                	mov    %ebx,%edi
+  8020e9:	ff d0                	call   *%rax
+    
+    return res;
+}
+  8020eb:	48 83 c4 10          	add    $0x10,%rsp
+  8020ef:	5b                   	pop    %rbx
+  8020f0:	41 5c                	pop    %r12
+  8020f2:	5d                   	pop    %rbp
+  8020f3:	c3                   	ret
+        return -E_NOT_SUPP;
+  8020f4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f9:	eb f0                	jmp    8020eb <snapshots_space+0x40>
+
+00000000008020fb <fsipc_region>:
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * maxsz: size of the region accepted at dstva, set to the size received.
+ * Returns result from the file server. */
+static int
+fsipc_region(unsigned type, void *dstva, size_t *maxsz) {
+  8020fb:	55                   	push   %rbp
+  8020fc:	48 89 e5             	mov    %rsp,%rbp
+  8020ff:	41 55                	push   %r13
+  802101:	41 54                	push   %r12
+  802103:	53                   	push   %rbx
+  802104:	48 83 ec 08          	sub    $0x8,%rsp
+  802108:	41 89 fd             	mov    %edi,%r13d
+  80210b:	48 89 f3             	mov    %rsi,%rbx
+  80210e:	49 89 d4             	mov    %rdx,%r12
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802111:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802118:	00 00 00 
+  80211b:	83 38 00             	cmpl   $0x0,(%rax)
+  80211e:	74 57                	je     802177 <fsipc_region+0x7c>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802120:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802126:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80212b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802132:	00 00 00 
+  802135:	44 89 ee             	mov    %r13d,%esi
+  802138:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80213f:	00 00 00 
+  802142:	8b 38                	mov    (%rax),%edi
+  802144:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, maxsz, NULL);
+  802150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802155:	4c 89 e2             	mov    %r12,%rdx
+  802158:	48 89 de             	mov    %rbx,%rsi
+  80215b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802160:	48 b8 03 36 80 00 00 	movabs $0x803603,%rax
+  802167:	00 00 00 
+  80216a:	ff d0                	call   *%rax
+}
+  80216c:	48 83 c4 08          	add    $0x8,%rsp
+  802170:	5b                   	pop    %rbx
+  802171:	41 5c                	pop    %r12
+  802173:	41 5d                	pop    %r13
+  802175:	5d                   	pop    %rbp
+  802176:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802177:	bf 03 00 00 00       	mov    $0x3,%edi
+  80217c:	48 b8 d9 36 80 00 00 	movabs $0x8036d9,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80218f:	00 00 
+  802191:	eb 8d                	jmp    802120 <fsipc_region+0x25>
+
+0000000000802193 <fsipc>:
+
+/* Same as fsipc_region with a reply page at most */
+static int
+fsipc(unsigned type, void *dstva) {
+  802193:	55                   	push   %rbp
+  802194:	48 89 e5             	mov    %rsp,%rbp
+  802197:	48 83 ec 10          	sub    $0x10,%rsp
+    size_t maxsz = PAGE_SIZE;
+  80219b:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8021a2:	00 
+    return fsipc_region(type, dstva, &maxsz);
+  8021a3:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8021a7:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+}
+  8021b3:	c9                   	leave
+  8021b4:	c3                   	ret
+
+00000000008021b5 <devfile_df_snapshots>:
+
+/* Get the space used by snapshots starting from the start'th one.
+ * Fills at most DF_SNAPSHOTS records and returns their number. */
+static int
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+    if (start < 0 || !records) {
+  8021b5:	85 ff                	test   %edi,%edi
+  8021b7:	78 6d                	js     802226 <devfile_df_snapshots+0x71>
+devfile_df_snapshots(int start, struct Df_snapshot *records) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	41 54                	push   %r12
+  8021bf:	53                   	push   %rbx
+  8021c0:	48 89 f3             	mov    %rsi,%rbx
+    if (start < 0 || !records) {
+  8021c3:	48 85 f6             	test   %rsi,%rsi
+  8021c6:	74 57                	je     80221f <devfile_df_snapshots+0x6a>
+        return -E_INVAL;
+    }
+
+    fsipcbuf.df_snapshots.req_start = start;
+  8021c8:	89 f8                	mov    %edi,%eax
+  8021ca:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021d1:	00 00 
+
+    int res = fsipc(FSREQ_DF_SNAPSHOTS, NULL);
+  8021d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d8:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021dd:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 2d                	js     80221a <devfile_df_snapshots+0x65>
+
+    memmove(records, fsipcbuf.df_snapshotsRet.ret_snapshots, fsipcbuf.df_snapshotsRet.ret_count * sizeof(struct Df_snapshot));
+  8021ed:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021f4:	00 00 00 
+  8021f7:	49 63 14 24          	movslq (%r12),%rdx
+  8021fb:	48 69 d2 8c 00 00 00 	imul   $0x8c,%rdx,%rdx
+  802202:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802207:	48 89 df             	mov    %rbx,%rdi
+  80220a:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+
+    return fsipcbuf.df_snapshotsRet.ret_count;
+  802216:	41 8b 04 24          	mov    (%r12),%eax
+}
+  80221a:	5b                   	pop    %rbx
+  80221b:	41 5c                	pop    %r12
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+        return -E_INVAL;
+  80221f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802224:	eb f4                	jmp    80221a <devfile_df_snapshots+0x65>
+  802226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80222b:	c3                   	ret
+
+000000000080222c <devfile_df_busy>:
+devfile_df_busy() {
+  80222c:	55                   	push   %rbp
+  80222d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_BUSY, NULL);
+  802230:	be 00 00 00 00       	mov    $0x0,%esi
+  802235:	bf 11 00 00 00       	mov    $0x11,%edi
+  80223a:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+}
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+
+0000000000802248 <devfile_df_free>:
+devfile_df_free() {
+  802248:	55                   	push   %rbp
+  802249:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_DF_FREE, NULL);
+  80224c:	be 00 00 00 00       	mov    $0x0,%esi
+  802251:	bf 10 00 00 00       	mov    $0x10,%edi
+  802256:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+}
+  802262:	5d                   	pop    %rbp
+  802263:	c3                   	ret
+
+0000000000802264 <devfile_gc_snapshots>:
+devfile_gc_snapshots() {
+  802264:	55                   	push   %rbp
+  802265:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_GC, NULL);
+  802268:	be 00 00 00 00       	mov    $0x0,%esi
+  80226d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802272:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+}
+  80227e:	5d                   	pop    %rbp
+  80227f:	c3                   	ret
+
+0000000000802280 <devfile_print_snapshot_list>:
+devfile_print_snapshot_list() {
+  802280:	55                   	push   %rbp
+  802281:	48 89 e5             	mov    %rsp,%rbp
+    int res = fsipc(FSREQ_SH_PRINT, NULL);
+  802284:	be 00 00 00 00       	mov    $0x0,%esi
+  802289:	bf 09 00 00 00       	mov    $0x9,%edi
+  80228e:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a1:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8022a4:	5d                   	pop    %rbp
+  8022a5:	c3                   	ret
+
+00000000008022a6 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022aa:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022b1:	00 00 00 
+  8022b4:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022b7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022b9:	89 70 04             	mov    %esi,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022c6:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+}
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022d8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022db:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022e2:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022ee:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+}
+  8022fa:	5d                   	pop    %rbp
+  8022fb:	c3                   	ret
+
+00000000008022fc <devfile_write>:
+    if (!fd || !buf) {
+  8022fc:	48 85 ff             	test   %rdi,%rdi
+  8022ff:	0f 84 c1 00 00 00    	je     8023c6 <devfile_write+0xca>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802305:	55                   	push   %rbp
+  802306:	48 89 e5             	mov    %rsp,%rbp
+  802309:	41 57                	push   %r15
+  80230b:	41 56                	push   %r14
+  80230d:	41 55                	push   %r13
+  80230f:	41 54                	push   %r12
+  802311:	53                   	push   %rbx
+  802312:	48 83 ec 18          	sub    $0x18,%rsp
+  802316:	49 89 ff             	mov    %rdi,%r15
+  802319:	49 89 f5             	mov    %rsi,%r13
+  80231c:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80231f:	48 85 f6             	test   %rsi,%rsi
+  802322:	0f 84 95 00 00 00    	je     8023bd <devfile_write+0xc1>
+    while (n) {
+  802328:	48 85 d2             	test   %rdx,%rdx
+  80232b:	0f 84 83 00 00 00    	je     8023b4 <devfile_write+0xb8>
+    int totalWrite = 0;
+  802331:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802338:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  80233f:	00 00 00 
+        size_t minSize = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802342:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802347:	49 39 dc             	cmp    %rbx,%r12
+  80234a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memmove(fsipcbuf.write.req_buf, buf, minSize);
+  80234e:	48 89 da             	mov    %rbx,%rdx
+  802351:	4c 89 ee             	mov    %r13,%rsi
+  802354:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80235b:	00 00 00 
+  80235e:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80236a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80236e:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = minSize;
+  802371:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        int write = fsipc(FSREQ_WRITE, NULL);
+  802375:	be 00 00 00 00       	mov    $0x0,%esi
+  80237a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80237f:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+        if (write < 0) {
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	78 21                	js     8023b0 <devfile_write+0xb4>
+        buf += write;
+  80238f:	48 63 d0             	movslq %eax,%rdx
+  802392:	49 01 d5             	add    %rdx,%r13
+        totalWrite += write;
+  802395:	01 45 cc             	add    %eax,-0x34(%rbp)
+    while (n) {
+  802398:	49 29 d4             	sub    %rdx,%r12
+  80239b:	75 a5                	jne    802342 <devfile_write+0x46>
+    return totalWrite;
+  80239d:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+}
+  8023a1:	48 83 c4 18          	add    $0x18,%rsp
+  8023a5:	5b                   	pop    %rbx
+  8023a6:	41 5c                	pop    %r12
+  8023a8:	41 5d                	pop    %r13
+  8023aa:	41 5e                	pop    %r14
+  8023ac:	41 5f                	pop    %r15
+  8023ae:	5d                   	pop    %rbp
+  8023af:	c3                   	ret
+            return write;
+  8023b0:	48 98                	cltq
+  8023b2:	eb ed                	jmp    8023a1 <devfile_write+0xa5>
+    int totalWrite = 0;
+  8023b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8023bb:	eb e0                	jmp    80239d <devfile_write+0xa1>
+        return -E_INVAL;
+  8023bd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023c4:	eb db                	jmp    8023a1 <devfile_write+0xa5>
+  8023c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8023cd:	c3                   	ret
+
+00000000008023ce <devfile_read>:
+    if (!fd || !buf) {
+  8023ce:	48 85 ff             	test   %rdi,%rdi
+  8023d1:	0f 84 c0 00 00 00    	je     802497 <devfile_read+0xc9>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023d7:	55                   	push   %rbp
+  8023d8:	48 89 e5             	mov    %rsp,%rbp
+  8023db:	41 57                	push   %r15
+  8023dd:	41 56                	push   %r14
+  8023df:	41 55                	push   %r13
+  8023e1:	41 54                	push   %r12
+  8023e3:	53                   	push   %rbx
+  8023e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e8:	49 89 ff             	mov    %rdi,%r15
+  8023eb:	49 89 f5             	mov    %rsi,%r13
+  8023ee:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8023f1:	48 85 f6             	test   %rsi,%rsi
+  8023f4:	0f 84 96 00 00 00    	je     802490 <devfile_read+0xc2>
+    while (n) {
+  8023fa:	48 85 d2             	test   %rdx,%rdx
+  8023fd:	0f 84 87 00 00 00    	je     80248a <devfile_read+0xbc>
+    size_t totalRead = 0;
+  802403:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80240a:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80240b:	49 be 00 60 80 00 00 	movabs $0x806000,%r14
+  802412:	00 00 00 
+  802415:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802419:	41 89 06             	mov    %eax,(%r14)
+        size_t minSize = MIN(n, sizeof(fsipcbuf.readRet.ret_buf));
+  80241c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802421:	49 39 c4             	cmp    %rax,%r12
+  802424:	49 0f 46 c4          	cmovbe %r12,%rax
+        fsipcbuf.read.req_n      = minSize;
+  802428:	49 89 46 08          	mov    %rax,0x8(%r14)
+        int read = fsipc(FSREQ_READ, NULL);
+  80242c:	be 00 00 00 00       	mov    $0x0,%esi
+  802431:	bf 03 00 00 00       	mov    $0x3,%edi
+  802436:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+        if (read <= 0) {
+  802442:	85 c0                	test   %eax,%eax
+  802444:	7e 37                	jle    80247d <devfile_read+0xaf>
+        memmove(buf, fsipcbuf.readRet.ret_buf, read);
+  802446:	48 63 d8             	movslq %eax,%rbx
+  802449:	48 89 da             	mov    %rbx,%rdx
+  80244c:	4c 89 f6             	mov    %r14,%rsi
+  80244f:	4c 89 ef             	mov    %r13,%rdi
+  802452:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+        buf += read;
+  80245e:	49 01 dd             	add    %rbx,%r13
+        totalRead += read;
+  802461:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802465:	49 29 dc             	sub    %rbx,%r12
+  802468:	75 ab                	jne    802415 <devfile_read+0x47>
+  return totalRead;
+  80246a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80246e:	48 83 c4 18          	add    $0x18,%rsp
+  802472:	5b                   	pop    %rbx
+  802473:	41 5c                	pop    %r12
+  802475:	41 5d                	pop    %r13
+  802477:	41 5e                	pop    %r14
+  802479:	41 5f                	pop    %r15
+  80247b:	5d                   	pop    %rbp
+  80247c:	c3                   	ret
+            return read ? read : totalRead;
+  80247d:	48 63 d0             	movslq %eax,%rdx
+  802480:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802484:	48 0f 45 c2          	cmovne %rdx,%rax
+  802488:	eb e4                	jmp    80246e <devfile_read+0xa0>
+    size_t totalRead = 0;
+  80248a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80248e:	eb da                	jmp    80246a <devfile_read+0x9c>
+        return E_INVAL;
+  802490:	b8 03 00 00 00       	mov    $0x3,%eax
+  802495:	eb d7                	jmp    80246e <devfile_read+0xa0>
+  802497:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80249c:	c3                   	ret
+
+000000000080249d <devfile_receive_snapshot>:
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  80249d:	48 85 ff             	test   %rdi,%rdi
+  8024a0:	74 5f                	je     802501 <devfile_receive_snapshot+0x64>
+devfile_receive_snapshot(char *path) {
+  8024a2:	55                   	push   %rbp
+  8024a3:	48 89 e5             	mov    %rsp,%rbp
+  8024a6:	53                   	push   %rbx
+  8024a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ab:	48 89 fb             	mov    %rdi,%rbx
+    if (!path || strlen(path) >= MAXPATHLEN) {
+  8024ae:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  8024b5:	00 00 00 
+  8024b8:	ff d0                	call   *%rax
+  8024ba:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024c0:	77 45                	ja     802507 <devfile_receive_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_recv.path, path);
+  8024c2:	48 89 de             	mov    %rbx,%rsi
+  8024c5:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8024cc:	00 00 00 
+  8024cf:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_RECV, NULL);
+  8024db:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024e5:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8024fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+        return -E_INVAL;
+  802501:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802506:	c3                   	ret
+        return -E_INVAL;
+  802507:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80250c:	eb ed                	jmp    8024fb <devfile_receive_snapshot+0x5e>
+
+000000000080250e <devfile_send_snapshot>:
+devfile_send_snapshot(char *from, char *name, char *path) {
+  80250e:	55                   	push   %rbp
+  80250f:	48 89 e5             	mov    %rsp,%rbp
+  802512:	41 55                	push   %r13
+  802514:	41 54                	push   %r12
+  802516:	53                   	push   %rbx
+  802517:	48 83 ec 08          	sub    $0x8,%rsp
+  80251b:	49 89 d5             	mov    %rdx,%r13
+    if (!from || !name || !path) {
+  80251e:	48 85 f6             	test   %rsi,%rsi
+  802521:	0f 94 c0             	sete   %al
+  802524:	48 85 d2             	test   %rdx,%rdx
+  802527:	0f 94 c2             	sete   %dl
+  80252a:	08 d0                	or     %dl,%al
+  80252c:	0f 85 ad 00 00 00    	jne    8025df <devfile_send_snapshot+0xd1>
+  802532:	48 89 fb             	mov    %rdi,%rbx
+  802535:	49 89 f4             	mov    %rsi,%r12
+  802538:	48 85 ff             	test   %rdi,%rdi
+  80253b:	0f 84 9e 00 00 00    	je     8025df <devfile_send_snapshot+0xd1>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(name) >= MAX_SH_LENGTH || strlen(path) >= MAXPATHLEN) {
+  802541:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802553:	0f 87 8d 00 00 00    	ja     8025e6 <devfile_send_snapshot+0xd8>
+  802559:	4c 89 e7             	mov    %r12,%rdi
+  80255c:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+  802568:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80256e:	77 7d                	ja     8025ed <devfile_send_snapshot+0xdf>
+  802570:	4c 89 ef             	mov    %r13,%rdi
+  802573:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802585:	77 6d                	ja     8025f4 <devfile_send_snapshot+0xe6>
+    strcpy(fsipcbuf.snapshot_send.from, from);
+  802587:	48 89 de             	mov    %rbx,%rsi
+  80258a:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  802591:	00 00 00 
+  802594:	48 bb 8c 0b 80 00 00 	movabs $0x800b8c,%rbx
+  80259b:	00 00 00 
+  80259e:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.name, name);
+  8025a0:	4c 89 e6             	mov    %r12,%rsi
+  8025a3:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8025aa:	00 00 00 
+  8025ad:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_send.path, path);
+  8025af:	4c 89 ee             	mov    %r13,%rsi
+  8025b2:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  8025b9:	00 00 00 
+  8025bc:	ff d3                	call   *%rbx
+    return fsipc(FSREQ_SH_SEND, NULL);
+  8025be:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025c8:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+}
+  8025d4:	48 83 c4 08          	add    $0x8,%rsp
+  8025d8:	5b                   	pop    %rbx
+  8025d9:	41 5c                	pop    %r12
+  8025db:	41 5d                	pop    %r13
+  8025dd:	5d                   	pop    %rbp
+  8025de:	c3                   	ret
+        return -E_INVAL;
+  8025df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e4:	eb ee                	jmp    8025d4 <devfile_send_snapshot+0xc6>
+        return -E_INVAL;
+  8025e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025eb:	eb e7                	jmp    8025d4 <devfile_send_snapshot+0xc6>
+  8025ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f2:	eb e0                	jmp    8025d4 <devfile_send_snapshot+0xc6>
+  8025f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f9:	eb d9                	jmp    8025d4 <devfile_send_snapshot+0xc6>
+
+00000000008025fb <devfile_diff_snapshots>:
+    if (!from || !to || !cursor || !records) {
+  8025fb:	48 85 ff             	test   %rdi,%rdi
+  8025fe:	0f 84 41 01 00 00    	je     802745 <devfile_diff_snapshots+0x14a>
+devfile_diff_snapshots(char *from, char *to, struct Sh_diff_cursor *cursor, struct Sh_diff_record *records) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	41 57                	push   %r15
+  80260a:	41 56                	push   %r14
+  80260c:	41 55                	push   %r13
+  80260e:	41 54                	push   %r12
+  802610:	53                   	push   %rbx
+  802611:	48 83 ec 08          	sub    $0x8,%rsp
+  802615:	49 89 fc             	mov    %rdi,%r12
+  802618:	49 89 f5             	mov    %rsi,%r13
+  80261b:	48 89 d3             	mov    %rdx,%rbx
+  80261e:	49 89 ce             	mov    %rcx,%r14
+    if (!from || !to || !cursor || !records) {
+  802621:	48 85 f6             	test   %rsi,%rsi
+  802624:	0f 84 ff 00 00 00    	je     802729 <devfile_diff_snapshots+0x12e>
+  80262a:	48 85 d2             	test   %rdx,%rdx
+  80262d:	0f 84 fd 00 00 00    	je     802730 <devfile_diff_snapshots+0x135>
+  802633:	48 85 c9             	test   %rcx,%rcx
+  802636:	0f 84 f4 00 00 00    	je     802730 <devfile_diff_snapshots+0x135>
+    if (strlen(from) >= MAX_SH_LENGTH || strlen(to) >= MAX_SH_LENGTH) {
+  80263c:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802643:	00 00 00 
+  802646:	ff d0                	call   *%rax
+  802648:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80264e:	0f 87 e3 00 00 00    	ja     802737 <devfile_diff_snapshots+0x13c>
+  802654:	4c 89 ef             	mov    %r13,%rdi
+  802657:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+  802663:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  802669:	0f 87 cf 00 00 00    	ja     80273e <devfile_diff_snapshots+0x143>
+    strcpy(fsipcbuf.snapshot_diff.from, from);
+  80266f:	4c 89 e6             	mov    %r12,%rsi
+  802672:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802679:	00 00 00 
+  80267c:	4c 89 e7             	mov    %r12,%rdi
+  80267f:	49 bf 8c 0b 80 00 00 	movabs $0x800b8c,%r15
+  802686:	00 00 00 
+  802689:	41 ff d7             	call   *%r15
+    strcpy(fsipcbuf.snapshot_diff.to, to);
+  80268c:	4c 89 ee             	mov    %r13,%rsi
+  80268f:	49 8d bc 24 00 01 00 	lea    0x100(%r12),%rdi
+  802696:	00 
+  802697:	41 ff d7             	call   *%r15
+    fsipcbuf.snapshot_diff.cursor = *cursor;
+  80269a:	48 8b 03             	mov    (%rbx),%rax
+  80269d:	49 89 84 24 00 02 00 	mov    %rax,0x200(%r12)
+  8026a4:	00 
+  8026a5:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8026a9:	49 89 84 24 08 02 00 	mov    %rax,0x208(%r12)
+  8026b0:	00 
+  8026b1:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8026b5:	49 89 84 24 10 02 00 	mov    %rax,0x210(%r12)
+  8026bc:	00 
+    int res = fsipc(FSREQ_SH_DIFF, NULL);
+  8026bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026c7:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	78 43                	js     80271a <devfile_diff_snapshots+0x11f>
+    *cursor = fsipcbuf.snapshot_diffRet.ret_cursor;
+  8026d7:	49 8b 04 24          	mov    (%r12),%rax
+  8026db:	48 89 03             	mov    %rax,(%rbx)
+  8026de:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8026e3:	48 89 43 08          	mov    %rax,0x8(%rbx)
+  8026e7:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+  8026ec:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    memmove(records, fsipcbuf.snapshot_diffRet.ret_records, fsipcbuf.snapshot_diffRet.ret_count * sizeof(struct Sh_diff_record));
+  8026f0:	49 63 44 24 18       	movslq 0x18(%r12),%rax
+  8026f5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8026f9:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8026fd:	48 c1 e2 03          	shl    $0x3,%rdx
+  802701:	49 8d 74 24 20       	lea    0x20(%r12),%rsi
+  802706:	4c 89 f7             	mov    %r14,%rdi
+  802709:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+    return fsipcbuf.snapshot_diffRet.ret_count;
+  802715:	41 8b 44 24 18       	mov    0x18(%r12),%eax
+}
+  80271a:	48 83 c4 08          	add    $0x8,%rsp
+  80271e:	5b                   	pop    %rbx
+  80271f:	41 5c                	pop    %r12
+  802721:	41 5d                	pop    %r13
+  802723:	41 5e                	pop    %r14
+  802725:	41 5f                	pop    %r15
+  802727:	5d                   	pop    %rbp
+  802728:	c3                   	ret
+        return -E_INVAL;
+  802729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272e:	eb ea                	jmp    80271a <devfile_diff_snapshots+0x11f>
+  802730:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802735:	eb e3                	jmp    80271a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802737:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80273c:	eb dc                	jmp    80271a <devfile_diff_snapshots+0x11f>
+  80273e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802743:	eb d5                	jmp    80271a <devfile_diff_snapshots+0x11f>
+        return -E_INVAL;
+  802745:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80274a:	c3                   	ret
+
+000000000080274b <devfile_delete_snapshot>:
+    if (!name) {
+  80274b:	48 85 ff             	test   %rdi,%rdi
+  80274e:	74 5f                	je     8027af <devfile_delete_snapshot+0x64>
+devfile_delete_snapshot(char *name) {
+  802750:	55                   	push   %rbp
+  802751:	48 89 e5             	mov    %rsp,%rbp
+  802754:	53                   	push   %rbx
+  802755:	48 83 ec 08          	sub    $0x8,%rsp
+  802759:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  80275c:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+  802768:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80276e:	77 45                	ja     8027b5 <devfile_delete_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_delete.name, name);
+  802770:	48 89 de             	mov    %rbx,%rsi
+  802773:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80277a:	00 00 00 
+  80277d:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_DELETE, NULL);
+  802789:	be 00 00 00 00       	mov    $0x0,%esi
+  80278e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802793:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8027a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ad:	c9                   	leave
+  8027ae:	c3                   	ret
+        return -E_INVAL;
+  8027af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027b4:	c3                   	ret
+        return -E_INVAL;
+  8027b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ba:	eb ed                	jmp    8027a9 <devfile_delete_snapshot+0x5e>
+
+00000000008027bc <devfile_accept_snapshot>:
+    if (!name) {
+  8027bc:	48 85 ff             	test   %rdi,%rdi
+  8027bf:	74 5f                	je     802820 <devfile_accept_snapshot+0x64>
+devfile_accept_snapshot(char *name) {
+  8027c1:	55                   	push   %rbp
+  8027c2:	48 89 e5             	mov    %rsp,%rbp
+  8027c5:	53                   	push   %rbx
+  8027c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ca:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(name) > MAX_SH_LENGTH) {
+  8027cd:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8027df:	77 45                	ja     802826 <devfile_accept_snapshot+0x6a>
+    strcpy(fsipcbuf.snapshot_accept.name, name);
+  8027e1:	48 89 de             	mov    %rbx,%rsi
+  8027e4:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8027eb:	00 00 00 
+  8027ee:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+    int res = fsipc(FSREQ_SH_ACCEPT, NULL);
+  8027fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802804:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802810:	85 c0                	test   %eax,%eax
+  802812:	ba 00 00 00 00       	mov    $0x0,%edx
+  802817:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80281a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+        return -E_INVAL;
+  802820:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802825:	c3                   	ret
+        return -E_INVAL;
+  802826:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80282b:	eb ed                	jmp    80281a <devfile_accept_snapshot+0x5e>
+
+000000000080282d <devfile_create_snapshot>:
+    if (!comment || !name) {
+  80282d:	48 85 ff             	test   %rdi,%rdi
+  802830:	0f 84 9f 00 00 00    	je     8028d5 <devfile_create_snapshot+0xa8>
+devfile_create_snapshot(char *comment, char *name) {
+  802836:	55                   	push   %rbp
+  802837:	48 89 e5             	mov    %rsp,%rbp
+  80283a:	41 54                	push   %r12
+  80283c:	53                   	push   %rbx
+  80283d:	48 89 fb             	mov    %rdi,%rbx
+  802840:	49 89 f4             	mov    %rsi,%r12
+    if (!comment || !name) {
+  802843:	48 85 f6             	test   %rsi,%rsi
+  802846:	74 78                	je     8028c0 <devfile_create_snapshot+0x93>
+    if (strlen(comment) > MAX_SH_LENGTH || strlen(name) > MAX_SH_LENGTH) {
+  802848:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+  802854:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80285a:	77 6b                	ja     8028c7 <devfile_create_snapshot+0x9a>
+  80285c:	4c 89 e7             	mov    %r12,%rdi
+  80285f:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+  80286b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802871:	77 5b                	ja     8028ce <devfile_create_snapshot+0xa1>
+    strcpy(fsipcbuf.snapshot_create.comment, comment);
+  802873:	48 89 de             	mov    %rbx,%rsi
+  802876:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80287d:	00 00 00 
+  802880:	48 bb 8c 0b 80 00 00 	movabs $0x800b8c,%rbx
+  802887:	00 00 00 
+  80288a:	ff d3                	call   *%rbx
+    strcpy(fsipcbuf.snapshot_create.name, name);
+  80288c:	4c 89 e6             	mov    %r12,%rsi
+  80288f:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  802896:	00 00 00 
+  802899:	ff d3                	call   *%rbx
+    int res = fsipc(FSREQ_SH_CREATE, NULL);
+  80289b:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028a5:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  8028ac:	00 00 00 
+  8028af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8028bb:	5b                   	pop    %rbx
+  8028bc:	41 5c                	pop    %r12
+  8028be:	5d                   	pop    %rbp
+  8028bf:	c3                   	ret
+        return -E_INVAL;
+  8028c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c5:	eb f4                	jmp    8028bb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028cc:	eb ed                	jmp    8028bb <devfile_create_snapshot+0x8e>
+  8028ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d3:	eb e6                	jmp    8028bb <devfile_create_snapshot+0x8e>
+        return -E_INVAL;
+  8028d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8028da:	c3                   	ret
+
+00000000008028db <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028db:	55                   	push   %rbp
+  8028dc:	48 89 e5             	mov    %rsp,%rbp
+  8028df:	41 54                	push   %r12
+  8028e1:	53                   	push   %rbx
+  8028e2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8028e5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8028e8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8028ef:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8028f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8028fb:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802907:	85 c0                	test   %eax,%eax
+  802909:	78 3d                	js     802948 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80290b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802912:	00 00 00 
+  802915:	4c 89 e6             	mov    %r12,%rsi
+  802918:	48 89 df             	mov    %rbx,%rdi
+  80291b:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802927:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80292e:	00 
+  80292f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802935:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80293c:	00 
+  80293d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802948:	5b                   	pop    %rbx
+  802949:	41 5c                	pop    %r12
+  80294b:	5d                   	pop    %rbp
+  80294c:	c3                   	ret
+
+000000000080294d <devfile_readmap>:
+devfile_readmap(struct Fd *fd, void *buf, size_t n) {
+  80294d:	55                   	push   %rbp
+  80294e:	48 89 e5             	mov    %rsp,%rbp
+  802951:	41 57                	push   %r15
+  802953:	41 56                	push   %r14
+  802955:	41 55                	push   %r13
+  802957:	41 54                	push   %r12
+  802959:	53                   	push   %rbx
+  80295a:	48 83 ec 38          	sub    $0x38,%rsp
+  80295e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802962:	49 89 f5             	mov    %rsi,%r13
+  802965:	49 89 d7             	mov    %rdx,%r15
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802968:	48 89 f0             	mov    %rsi,%rax
+  80296b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802970:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802974:	75 4f                	jne    8029c5 <devfile_readmap+0x78>
+  802976:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80297a:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802980:	75 1f                	jne    8029a1 <devfile_readmap+0x54>
+    size_t totalRead = 0;
+  802982:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802986:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  80298a:	49 be 35 31 80 00 00 	movabs $0x803135,%r14
+  802991:	00 00 00 
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802994:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  80299b:	0f 87 9d 00 00 00    	ja     802a3e <devfile_readmap+0xf1>
+    size_t totalRead = 0;
+  8029a1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029a5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (!n) return totalRead;
+  8029a9:	4d 85 ff             	test   %r15,%r15
+  8029ac:	0f 85 cf 00 00 00    	jne    802a81 <devfile_readmap+0x134>
+  8029b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8029b6:	48 83 c4 38          	add    $0x38,%rsp
+  8029ba:	5b                   	pop    %rbx
+  8029bb:	41 5c                	pop    %r12
+  8029bd:	41 5d                	pop    %r13
+  8029bf:	41 5e                	pop    %r14
+  8029c1:	41 5f                	pop    %r15
+  8029c3:	5d                   	pop    %rbp
+  8029c4:	c3                   	ret
+    size_t totalRead = 0;
+  8029c5:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8029cc:	00 
+  8029cd:	eb da                	jmp    8029a9 <devfile_readmap+0x5c>
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029cf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029d3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029d6:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8029dd:	00 00 00 
+  8029e0:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_n      = size;
+  8029e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e6:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        int read = fsipc_region(FSREQ_READ_BULK, buf, &size);
+  8029ea:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029ee:	4c 89 ee             	mov    %r13,%rsi
+  8029f1:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029f6:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+        if (read <= 0 || size < (size_t)read) break;
+  802a02:	85 c0                	test   %eax,%eax
+  802a04:	7e a3                	jle    8029a9 <devfile_readmap+0x5c>
+  802a06:	48 98                	cltq
+  802a08:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a0c:	72 9b                	jb     8029a9 <devfile_readmap+0x5c>
+        buf += read;
+  802a0e:	49 01 c5             	add    %rax,%r13
+        n -= read;
+  802a11:	49 29 c7             	sub    %rax,%r15
+        totalRead += read;
+  802a14:	48 01 45 a8          	add    %rax,-0x58(%rbp)
+    while (!PAGE_OFFSET(buf) && !(fd->fd_offset % BLKSIZE) && n >= BLKSIZE) {
+  802a18:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  802a1f:	75 88                	jne    8029a9 <devfile_readmap+0x5c>
+  802a21:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a25:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a2b:	0f 85 78 ff ff ff    	jne    8029a9 <devfile_readmap+0x5c>
+  802a31:	49 81 ff ff 0f 00 00 	cmp    $0xfff,%r15
+  802a38:	0f 86 6b ff ff ff    	jbe    8029a9 <devfile_readmap+0x5c>
+        size_t size = ROUNDDOWN(MIN(n, FSREQ_BULK_MAX), BLKSIZE);
+  802a3e:	41 bc 00 00 10 00    	mov    $0x100000,%r12d
+  802a44:	4d 39 e7             	cmp    %r12,%r15
+  802a47:	4d 0f 46 e7          	cmovbe %r15,%r12
+  802a4b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  802a52:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a56:	0f 84 73 ff ff ff    	je     8029cf <devfile_readmap+0x82>
+  802a5c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+        if (get_prot((char *)buf + i) & PROT_SHARE) return false;
+  802a60:	49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+  802a65:	41 ff d6             	call   *%r14
+  802a68:	a8 40                	test   $0x40,%al
+  802a6a:	0f 85 39 ff ff ff    	jne    8029a9 <devfile_readmap+0x5c>
+    for (size_t i = 0; i < n; i += PAGE_SIZE) {
+  802a70:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a77:	4c 39 e3             	cmp    %r12,%rbx
+  802a7a:	72 e4                	jb     802a60 <devfile_readmap+0x113>
+  802a7c:	e9 4e ff ff ff       	jmp    8029cf <devfile_readmap+0x82>
+    ssize_t read = devfile_read(fd, buf, n);
+  802a81:	4c 89 fa             	mov    %r15,%rdx
+  802a84:	4c 89 ee             	mov    %r13,%rsi
+  802a87:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a8b:	48 b8 ce 23 80 00 00 	movabs $0x8023ce,%rax
+  802a92:	00 00 00 
+  802a95:	ff d0                	call   *%rax
+    if (read < 0) return totalRead ? totalRead : read;
+  802a97:	48 85 c0             	test   %rax,%rax
+  802a9a:	78 0c                	js     802aa8 <devfile_readmap+0x15b>
+    return totalRead + read;
+  802a9c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aa0:	48 01 f0             	add    %rsi,%rax
+  802aa3:	e9 0e ff ff ff       	jmp    8029b6 <devfile_readmap+0x69>
+    if (read < 0) return totalRead ? totalRead : read;
+  802aa8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aac:	48 85 f6             	test   %rsi,%rsi
+  802aaf:	48 0f 45 c6          	cmovne %rsi,%rax
+  802ab3:	e9 fe fe ff ff       	jmp    8029b6 <devfile_readmap+0x69>
+
+0000000000802ab8 <open>:
+open(const char *path, int mode) {
+  802ab8:	55                   	push   %rbp
+  802ab9:	48 89 e5             	mov    %rsp,%rbp
+  802abc:	41 55                	push   %r13
+  802abe:	41 54                	push   %r12
+  802ac0:	53                   	push   %rbx
+  802ac1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ac5:	49 89 fc             	mov    %rdi,%r12
+  802ac8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802acb:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+  802ad7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802add:	0f 87 8a 00 00 00    	ja     802b6d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ae3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ae7:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+  802af3:	89 c3                	mov    %eax,%ebx
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	78 50                	js     802b49 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802af9:	4c 89 e6             	mov    %r12,%rsi
+  802afc:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802b03:	00 00 00 
+  802b06:	48 89 df             	mov    %rbx,%rdi
+  802b09:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b15:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b1c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b20:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b25:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802b2c:	00 00 00 
+  802b2f:	ff d0                	call   *%rax
+  802b31:	89 c3                	mov    %eax,%ebx
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 1f                	js     802b56 <open+0x9e>
+    return fd2num(fd);
+  802b37:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b3b:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  802b42:	00 00 00 
+  802b45:	ff d0                	call   *%rax
+  802b47:	89 c3                	mov    %eax,%ebx
+}
+  802b49:	89 d8                	mov    %ebx,%eax
+  802b4b:	48 83 c4 18          	add    $0x18,%rsp
+  802b4f:	5b                   	pop    %rbx
+  802b50:	41 5c                	pop    %r12
+  802b52:	41 5d                	pop    %r13
+  802b54:	5d                   	pop    %rbp
+  802b55:	c3                   	ret
+        fd_close(fd, 0);
+  802b56:	be 00 00 00 00       	mov    $0x0,%esi
+  802b5b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b5f:	48 b8 31 17 80 00 00 	movabs $0x801731,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+        return res;
+  802b6b:	eb dc                	jmp    802b49 <open+0x91>
+        return -E_BAD_PATH;
+  802b6d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b72:	eb d5                	jmp    802b49 <open+0x91>
+
+0000000000802b74 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802b74:	55                   	push   %rbp
+  802b75:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802b78:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b82:	48 b8 93 21 80 00 00 	movabs $0x802193,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+}
+  802b8e:	5d                   	pop    %rbp
+  802b8f:	c3                   	ret
+
+0000000000802b90 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b90:	55                   	push   %rbp
+  802b91:	48 89 e5             	mov    %rsp,%rbp
+  802b94:	41 54                	push   %r12
+  802b96:	53                   	push   %rbx
+  802b97:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b9a:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ba9:	48 be e0 3d 80 00 00 	movabs $0x803de0,%rsi
+  802bb0:	00 00 00 
+  802bb3:	48 89 df             	mov    %rbx,%rdi
+  802bb6:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  802bbd:	00 00 00 
+  802bc0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bc2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802bc7:	41 2b 04 24          	sub    (%r12),%eax
+  802bcb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802bd1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bd8:	00 00 00 
+    stat->st_dev = &devpipe;
+  802bdb:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802be2:	00 00 00 
+  802be5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf1:	5b                   	pop    %rbx
+  802bf2:	41 5c                	pop    %r12
+  802bf4:	5d                   	pop    %rbp
+  802bf5:	c3                   	ret
+
+0000000000802bf6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802bf6:	55                   	push   %rbp
+  802bf7:	48 89 e5             	mov    %rsp,%rbp
+  802bfa:	41 54                	push   %r12
+  802bfc:	53                   	push   %rbx
+  802bfd:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c05:	48 89 fe             	mov    %rdi,%rsi
+  802c08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0d:	49 bc e4 12 80 00 00 	movabs $0x8012e4,%r12
+  802c14:	00 00 00 
+  802c17:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c1a:	48 89 df             	mov    %rbx,%rdi
+  802c1d:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802c24:	00 00 00 
+  802c27:	ff d0                	call   *%rax
+  802c29:	48 89 c6             	mov    %rax,%rsi
+  802c2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c36:	41 ff d4             	call   *%r12
+}
+  802c39:	5b                   	pop    %rbx
+  802c3a:	41 5c                	pop    %r12
+  802c3c:	5d                   	pop    %rbp
+  802c3d:	c3                   	ret
+
+0000000000802c3e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c3e:	55                   	push   %rbp
+  802c3f:	48 89 e5             	mov    %rsp,%rbp
+  802c42:	41 57                	push   %r15
+  802c44:	41 56                	push   %r14
+  802c46:	41 55                	push   %r13
+  802c48:	41 54                	push   %r12
+  802c4a:	53                   	push   %rbx
+  802c4b:	48 83 ec 18          	sub    $0x18,%rsp
+  802c4f:	49 89 fc             	mov    %rdi,%r12
+  802c52:	49 89 f5             	mov    %rsi,%r13
+  802c55:	49 89 d7             	mov    %rdx,%r15
+  802c58:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c5c:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802c63:	00 00 00 
+  802c66:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c68:	4d 85 ff             	test   %r15,%r15
+  802c6b:	0f 84 af 00 00 00    	je     802d20 <devpipe_write+0xe2>
+  802c71:	48 89 c3             	mov    %rax,%rbx
+  802c74:	4c 89 f8             	mov    %r15,%rax
+  802c77:	4d 89 ef             	mov    %r13,%r15
+  802c7a:	4c 01 e8             	add    %r13,%rax
+  802c7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c81:	49 bd ec 11 80 00 00 	movabs $0x8011ec,%r13
+  802c88:	00 00 00 
+            sys_yield();
+  802c8b:	49 be 89 11 80 00 00 	movabs $0x801189,%r14
+  802c92:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c95:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c98:	48 63 ce             	movslq %esi,%rcx
+  802c9b:	48 63 03             	movslq (%rbx),%rax
+  802c9e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ca4:	48 39 c1             	cmp    %rax,%rcx
+  802ca7:	72 2e                	jb     802cd7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ca9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cae:	48 89 da             	mov    %rbx,%rdx
+  802cb1:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cb6:	4c 89 e7             	mov    %r12,%rdi
+  802cb9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	74 66                	je     802d26 <devpipe_write+0xe8>
+            sys_yield();
+  802cc0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cc3:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cc6:	48 63 ce             	movslq %esi,%rcx
+  802cc9:	48 63 03             	movslq (%rbx),%rax
+  802ccc:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cd2:	48 39 c1             	cmp    %rax,%rcx
+  802cd5:	73 d2                	jae    802ca9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cd7:	41 0f b6 3f          	movzbl (%r15),%edi
+  802cdb:	48 89 ca             	mov    %rcx,%rdx
+  802cde:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ce2:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802ce9:	08 10 20 
+  802cec:	48 f7 e2             	mul    %rdx
+  802cef:	48 c1 ea 06          	shr    $0x6,%rdx
+  802cf3:	48 89 d0             	mov    %rdx,%rax
+  802cf6:	48 c1 e0 09          	shl    $0x9,%rax
+  802cfa:	48 29 d0             	sub    %rdx,%rax
+  802cfd:	48 c1 e0 03          	shl    $0x3,%rax
+  802d01:	48 29 c1             	sub    %rax,%rcx
+  802d04:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802d09:	83 c6 01             	add    $0x1,%esi
+  802d0c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d0f:	49 83 c7 01          	add    $0x1,%r15
+  802d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d17:	49 39 c7             	cmp    %rax,%r15
+  802d1a:	0f 85 75 ff ff ff    	jne    802c95 <devpipe_write+0x57>
+    return n;
+  802d20:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d24:	eb 05                	jmp    802d2b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d2b:	48 83 c4 18          	add    $0x18,%rsp
+  802d2f:	5b                   	pop    %rbx
+  802d30:	41 5c                	pop    %r12
+  802d32:	41 5d                	pop    %r13
+  802d34:	41 5e                	pop    %r14
+  802d36:	41 5f                	pop    %r15
+  802d38:	5d                   	pop    %rbp
+  802d39:	c3                   	ret
+
+0000000000802d3a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d3a:	55                   	push   %rbp
+  802d3b:	48 89 e5             	mov    %rsp,%rbp
+  802d3e:	41 57                	push   %r15
+  802d40:	41 56                	push   %r14
+  802d42:	41 55                	push   %r13
+  802d44:	41 54                	push   %r12
+  802d46:	53                   	push   %rbx
+  802d47:	48 83 ec 18          	sub    $0x18,%rsp
+  802d4b:	49 89 fc             	mov    %rdi,%r12
+  802d4e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d52:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d56:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802d5d:	00 00 00 
+  802d60:	ff d0                	call   *%rax
+  802d62:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d65:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d6b:	49 bd ec 11 80 00 00 	movabs $0x8011ec,%r13
+  802d72:	00 00 00 
+            sys_yield();
+  802d75:	49 be 89 11 80 00 00 	movabs $0x801189,%r14
+  802d7c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d7f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d84:	74 7d                	je     802e03 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d86:	8b 03                	mov    (%rbx),%eax
+  802d88:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d8b:	75 26                	jne    802db3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d8d:	4d 85 ff             	test   %r15,%r15
+  802d90:	75 77                	jne    802e09 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d92:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d97:	48 89 da             	mov    %rbx,%rdx
+  802d9a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d9f:	4c 89 e7             	mov    %r12,%rdi
+  802da2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802da5:	85 c0                	test   %eax,%eax
+  802da7:	74 72                	je     802e1b <devpipe_read+0xe1>
+            sys_yield();
+  802da9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dac:	8b 03                	mov    (%rbx),%eax
+  802dae:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802db1:	74 df                	je     802d92 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802db3:	48 63 c8             	movslq %eax,%rcx
+  802db6:	48 89 ca             	mov    %rcx,%rdx
+  802db9:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dbd:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802dc4:	08 10 20 
+  802dc7:	48 89 d0             	mov    %rdx,%rax
+  802dca:	48 f7 e6             	mul    %rsi
+  802dcd:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dd1:	48 89 d0             	mov    %rdx,%rax
+  802dd4:	48 c1 e0 09          	shl    $0x9,%rax
+  802dd8:	48 29 d0             	sub    %rdx,%rax
+  802ddb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802de2:	00 
+  802de3:	48 89 c8             	mov    %rcx,%rax
+  802de6:	48 29 d0             	sub    %rdx,%rax
+  802de9:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802dee:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802df2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802df6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802df9:	49 83 c7 01          	add    $0x1,%r15
+  802dfd:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802e01:	75 83                	jne    802d86 <devpipe_read+0x4c>
+    return n;
+  802e03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e07:	eb 03                	jmp    802e0c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802e09:	4c 89 f8             	mov    %r15,%rax
+}
+  802e0c:	48 83 c4 18          	add    $0x18,%rsp
+  802e10:	5b                   	pop    %rbx
+  802e11:	41 5c                	pop    %r12
+  802e13:	41 5d                	pop    %r13
+  802e15:	41 5e                	pop    %r14
+  802e17:	41 5f                	pop    %r15
+  802e19:	5d                   	pop    %rbp
+  802e1a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e20:	eb ea                	jmp    802e0c <devpipe_read+0xd2>
+
+0000000000802e22 <pipe>:
+pipe(int pfd[2]) {
+  802e22:	55                   	push   %rbp
+  802e23:	48 89 e5             	mov    %rsp,%rbp
+  802e26:	41 55                	push   %r13
+  802e28:	41 54                	push   %r12
+  802e2a:	53                   	push   %rbx
+  802e2b:	48 83 ec 18          	sub    $0x18,%rsp
+  802e2f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e32:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e36:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+  802e42:	89 c3                	mov    %eax,%ebx
+  802e44:	85 c0                	test   %eax,%eax
+  802e46:	0f 88 a0 01 00 00    	js     802fec <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e4c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e56:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5f:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+  802e6b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	0f 88 77 01 00 00    	js     802fec <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e75:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e79:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+  802e85:	89 c3                	mov    %eax,%ebx
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	0f 88 43 01 00 00    	js     802fd2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802e8f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e99:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea2:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  802eae:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	0f 88 1a 01 00 00    	js     802fd2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802eb8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ebc:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+  802ec8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802ecb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ed0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ed5:	48 89 c6             	mov    %rax,%rsi
+  802ed8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edd:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  802ee4:	00 00 00 
+  802ee7:	ff d0                	call   *%rax
+  802ee9:	89 c3                	mov    %eax,%ebx
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	0f 88 c5 00 00 00    	js     802fb8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802ef3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ef7:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+  802f03:	48 89 c1             	mov    %rax,%rcx
+  802f06:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802f0c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f17:	4c 89 ee             	mov    %r13,%rsi
+  802f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1f:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+  802f2b:	89 c3                	mov    %eax,%ebx
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	78 6e                	js     802f9f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f31:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f36:	4c 89 ef             	mov    %r13,%rdi
+  802f39:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+  802f45:	83 f8 02             	cmp    $0x2,%eax
+  802f48:	0f 85 ab 00 00 00    	jne    802ff9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f4e:	a1 c0 40 80 00 00 00 	movabs 0x8040c0,%eax
+  802f55:	00 00 
+  802f57:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f5b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f5d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f61:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f68:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f6c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f72:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f79:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f7d:	48 bb e8 15 80 00 00 	movabs $0x8015e8,%rbx
+  802f84:	00 00 00 
+  802f87:	ff d3                	call   *%rbx
+  802f89:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f8d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f91:	ff d3                	call   *%rbx
+  802f93:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f9d:	eb 4d                	jmp    802fec <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802f9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fa4:	4c 89 ee             	mov    %r13,%rsi
+  802fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fac:	48 b8 e4 12 80 00 00 	movabs $0x8012e4,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802fb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fbd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc6:	48 b8 e4 12 80 00 00 	movabs $0x8012e4,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802fd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe0:	48 b8 e4 12 80 00 00 	movabs $0x8012e4,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+}
+  802fec:	89 d8                	mov    %ebx,%eax
+  802fee:	48 83 c4 18          	add    $0x18,%rsp
+  802ff2:	5b                   	pop    %rbx
+  802ff3:	41 5c                	pop    %r12
+  802ff5:	41 5d                	pop    %r13
+  802ff7:	5d                   	pop    %rbp
+  802ff8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ff9:	48 b9 10 3e 80 00 00 	movabs $0x803e10,%rcx
+  803000:	00 00 00 
+  803003:	48 ba e7 3d 80 00 00 	movabs $0x803de7,%rdx
+  80300a:	00 00 00 
+  80300d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803012:	48 bf fc 3d 80 00 00 	movabs $0x803dfc,%rdi
+  803019:	00 00 00 
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803021:	49 b8 79 34 80 00 00 	movabs $0x803479,%r8
+  803028:	00 00 00 
+  80302b:	41 ff d0             	call   *%r8
+
+000000000080302e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80302e:	55                   	push   %rbp
+  80302f:	48 89 e5             	mov    %rsp,%rbp
+  803032:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803036:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80303a:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  803041:	00 00 00 
+  803044:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803046:	85 c0                	test   %eax,%eax
+  803048:	78 35                	js     80307f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80304a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80304e:	48 b8 fa 15 80 00 00 	movabs $0x8015fa,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+  80305a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80305d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803062:	be 00 10 00 00       	mov    $0x1000,%esi
+  803067:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80306b:	48 b8 ec 11 80 00 00 	movabs $0x8011ec,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+  803077:	85 c0                	test   %eax,%eax
+  803079:	0f 94 c0             	sete   %al
+  80307c:	0f b6 c0             	movzbl %al,%eax
+}
+  80307f:	c9                   	leave
+  803080:	c3                   	ret
+
+0000000000803081 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803081:	48 89 f8             	mov    %rdi,%rax
+  803084:	48 c1 e8 27          	shr    $0x27,%rax
+  803088:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80308f:	01 00 00 
+  803092:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803096:	f6 c2 01             	test   $0x1,%dl
+  803099:	74 6d                	je     803108 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80309b:	48 89 f8             	mov    %rdi,%rax
+  80309e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030a2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030a9:	01 00 00 
+  8030ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030b0:	f6 c2 01             	test   $0x1,%dl
+  8030b3:	74 62                	je     803117 <get_uvpt_entry+0x96>
+  8030b5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030bc:	01 00 00 
+  8030bf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030c3:	f6 c2 80             	test   $0x80,%dl
+  8030c6:	75 4f                	jne    803117 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030c8:	48 89 f8             	mov    %rdi,%rax
+  8030cb:	48 c1 e8 15          	shr    $0x15,%rax
+  8030cf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030d6:	01 00 00 
+  8030d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030dd:	f6 c2 01             	test   $0x1,%dl
+  8030e0:	74 44                	je     803126 <get_uvpt_entry+0xa5>
+  8030e2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030e9:	01 00 00 
+  8030ec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030f0:	f6 c2 80             	test   $0x80,%dl
+  8030f3:	75 31                	jne    803126 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8030f5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8030f9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803100:	01 00 00 
+  803103:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803107:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803108:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80310f:	01 00 00 
+  803112:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803116:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803117:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80311e:	01 00 00 
+  803121:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803125:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803126:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80312d:	01 00 00 
+  803130:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803134:	c3                   	ret
+
+0000000000803135 <get_prot>:
+
+int
+get_prot(void *va) {
+  803135:	55                   	push   %rbp
+  803136:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803139:	48 b8 81 30 80 00 00 	movabs $0x803081,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+  803145:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803148:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80314d:	89 c1                	mov    %eax,%ecx
+  80314f:	83 c9 04             	or     $0x4,%ecx
+  803152:	f6 c2 01             	test   $0x1,%dl
+  803155:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803158:	89 c1                	mov    %eax,%ecx
+  80315a:	83 c9 02             	or     $0x2,%ecx
+  80315d:	f6 c2 02             	test   $0x2,%dl
+  803160:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803163:	89 c1                	mov    %eax,%ecx
+  803165:	83 c9 01             	or     $0x1,%ecx
+  803168:	48 85 d2             	test   %rdx,%rdx
+  80316b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80316e:	89 c1                	mov    %eax,%ecx
+  803170:	83 c9 40             	or     $0x40,%ecx
+  803173:	f6 c6 04             	test   $0x4,%dh
+  803176:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803179:	5d                   	pop    %rbp
+  80317a:	c3                   	ret
+
+000000000080317b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80317b:	55                   	push   %rbp
+  80317c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80317f:	48 b8 81 30 80 00 00 	movabs $0x803081,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80318b:	48 c1 e8 06          	shr    $0x6,%rax
+  80318f:	83 e0 01             	and    $0x1,%eax
+}
+  803192:	5d                   	pop    %rbp
+  803193:	c3                   	ret
+
+0000000000803194 <is_page_accessed>:
+
+bool
+is_page_accessed(void *va) {
+  803194:	55                   	push   %rbp
+  803195:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803198:	48 b8 81 30 80 00 00 	movabs $0x803081,%rax
+  80319f:	00 00 00 
+  8031a2:	ff d0                	call   *%rax
+    return pte & PTE_A;
+  8031a4:	48 c1 e8 05          	shr    $0x5,%rax
+  8031a8:	83 e0 01             	and    $0x1,%eax
+}
+  8031ab:	5d                   	pop    %rbp
+  8031ac:	c3                   	ret
+
+00000000008031ad <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8031ad:	55                   	push   %rbp
+  8031ae:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8031b1:	48 b8 81 30 80 00 00 	movabs $0x803081,%rax
+  8031b8:	00 00 00 
+  8031bb:	ff d0                	call   *%rax
+  8031bd:	83 e0 01             	and    $0x1,%eax
+}
+  8031c0:	5d                   	pop    %rbp
+  8031c1:	c3                   	ret
+
+00000000008031c2 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8031c2:	55                   	push   %rbp
+  8031c3:	48 89 e5             	mov    %rsp,%rbp
+  8031c6:	41 57                	push   %r15
+  8031c8:	41 56                	push   %r14
+  8031ca:	41 55                	push   %r13
+  8031cc:	41 54                	push   %r12
+  8031ce:	53                   	push   %rbx
+  8031cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8031d3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031d7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031db:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (is_page_present((void*)addr)) {
+  8031e0:	49 bd ad 31 80 00 00 	movabs $0x8031ad,%r13
+  8031e7:	00 00 00 
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  8031ea:	49 bf 35 31 80 00 00 	movabs $0x803135,%r15
+  8031f1:	00 00 00 
+    for (size_t addr = 0; addr < MAX_USER_ADDRESS; addr += PAGE_SIZE) {
+  8031f4:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  8031fb:	00 00 00 
+  8031fe:	eb 0c                	jmp    80320c <foreach_shared_region+0x4a>
+  803200:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803207:	4c 39 f3             	cmp    %r14,%rbx
+  80320a:	74 2e                	je     80323a <foreach_shared_region+0x78>
+        if (is_page_present((void*)addr)) {
+  80320c:	48 89 df             	mov    %rbx,%rdi
+  80320f:	41 ff d5             	call   *%r13
+  803212:	84 c0                	test   %al,%al
+  803214:	74 ea                	je     803200 <foreach_shared_region+0x3e>
+			if (get_prot((void*)addr) & PROT_SHARE) {
+  803216:	48 89 df             	mov    %rbx,%rdi
+  803219:	41 ff d7             	call   *%r15
+  80321c:	a8 40                	test   $0x40,%al
+  80321e:	74 e0                	je     803200 <foreach_shared_region+0x3e>
+				int res = fun((void*)addr, (void*)addr + PAGE_SIZE, arg);
+  803220:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803227:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80322b:	48 89 df             	mov    %rbx,%rdi
+  80322e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803232:	ff d0                	call   *%rax
+				if (res < 0) {
+  803234:	85 c0                	test   %eax,%eax
+  803236:	79 c8                	jns    803200 <foreach_shared_region+0x3e>
+  803238:	eb 05                	jmp    80323f <foreach_shared_region+0x7d>
+					return res;
+				}
+			}
+		}
+    }
+    return 0;
+  80323a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80323f:	48 83 c4 18          	add    $0x18,%rsp
+  803243:	5b                   	pop    %rbx
+  803244:	41 5c                	pop    %r12
+  803246:	41 5d                	pop    %r13
+  803248:	41 5e                	pop    %r14
+  80324a:	41 5f                	pop    %r15
+  80324c:	5d                   	pop    %rbp
+  80324d:	c3                   	ret
+
+000000000080324e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80324e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803253:	c3                   	ret
+
+0000000000803254 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803254:	55                   	push   %rbp
+  803255:	48 89 e5             	mov    %rsp,%rbp
+  803258:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80325b:	48 be 34 3e 80 00 00 	movabs $0x803e34,%rsi
+  803262:	00 00 00 
+  803265:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+    return 0;
+}
+  803271:	b8 00 00 00 00       	mov    $0x0,%eax
+  803276:	5d                   	pop    %rbp
+  803277:	c3                   	ret
+
+0000000000803278 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803278:	55                   	push   %rbp
+  803279:	48 89 e5             	mov    %rsp,%rbp
+  80327c:	41 57                	push   %r15
+  80327e:	41 56                	push   %r14
+  803280:	41 55                	push   %r13
+  803282:	41 54                	push   %r12
+  803284:	53                   	push   %rbx
+  803285:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80328c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803293:	48 85 d2             	test   %rdx,%rdx
+  803296:	74 7a                	je     803312 <devcons_write+0x9a>
+  803298:	49 89 d6             	mov    %rdx,%r14
+  80329b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032a1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8032a6:	49 bf 86 0d 80 00 00 	movabs $0x800d86,%r15
+  8032ad:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032b0:	4c 89 f3             	mov    %r14,%rbx
+  8032b3:	48 29 f3             	sub    %rsi,%rbx
+  8032b6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032bb:	48 39 c3             	cmp    %rax,%rbx
+  8032be:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8032c2:	4c 63 eb             	movslq %ebx,%r13
+  8032c5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8032cc:	48 01 c6             	add    %rax,%rsi
+  8032cf:	4c 89 ea             	mov    %r13,%rdx
+  8032d2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032d9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8032dc:	4c 89 ee             	mov    %r13,%rsi
+  8032df:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8032e6:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  8032ed:	00 00 00 
+  8032f0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8032f2:	41 01 dc             	add    %ebx,%r12d
+  8032f5:	49 63 f4             	movslq %r12d,%rsi
+  8032f8:	4c 39 f6             	cmp    %r14,%rsi
+  8032fb:	72 b3                	jb     8032b0 <devcons_write+0x38>
+    return res;
+  8032fd:	49 63 c4             	movslq %r12d,%rax
+}
+  803300:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803307:	5b                   	pop    %rbx
+  803308:	41 5c                	pop    %r12
+  80330a:	41 5d                	pop    %r13
+  80330c:	41 5e                	pop    %r14
+  80330e:	41 5f                	pop    %r15
+  803310:	5d                   	pop    %rbp
+  803311:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803312:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803318:	eb e3                	jmp    8032fd <devcons_write+0x85>
+
+000000000080331a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80331a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80331d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803322:	48 85 c0             	test   %rax,%rax
+  803325:	74 55                	je     80337c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803327:	55                   	push   %rbp
+  803328:	48 89 e5             	mov    %rsp,%rbp
+  80332b:	41 55                	push   %r13
+  80332d:	41 54                	push   %r12
+  80332f:	53                   	push   %rbx
+  803330:	48 83 ec 08          	sub    $0x8,%rsp
+  803334:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803337:	48 bb bc 10 80 00 00 	movabs $0x8010bc,%rbx
+  80333e:	00 00 00 
+  803341:	49 bc 89 11 80 00 00 	movabs $0x801189,%r12
+  803348:	00 00 00 
+  80334b:	eb 03                	jmp    803350 <devcons_read+0x36>
+  80334d:	41 ff d4             	call   *%r12
+  803350:	ff d3                	call   *%rbx
+  803352:	85 c0                	test   %eax,%eax
+  803354:	74 f7                	je     80334d <devcons_read+0x33>
+    if (c < 0) return c;
+  803356:	48 63 d0             	movslq %eax,%rdx
+  803359:	78 13                	js     80336e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80335b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803360:	83 f8 04             	cmp    $0x4,%eax
+  803363:	74 09                	je     80336e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803365:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803369:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80336e:	48 89 d0             	mov    %rdx,%rax
+  803371:	48 83 c4 08          	add    $0x8,%rsp
+  803375:	5b                   	pop    %rbx
+  803376:	41 5c                	pop    %r12
+  803378:	41 5d                	pop    %r13
+  80337a:	5d                   	pop    %rbp
+  80337b:	c3                   	ret
+  80337c:	48 89 d0             	mov    %rdx,%rax
+  80337f:	c3                   	ret
+
+0000000000803380 <cputchar>:
+cputchar(int ch) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+  803384:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803388:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80338c:	be 01 00 00 00       	mov    $0x1,%esi
+  803391:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803395:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+}
+  8033a1:	c9                   	leave
+  8033a2:	c3                   	ret
+
+00000000008033a3 <getchar>:
+getchar(void) {
+  8033a3:	55                   	push   %rbp
+  8033a4:	48 89 e5             	mov    %rsp,%rbp
+  8033a7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8033ab:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033b0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b9:	48 b8 59 19 80 00 00 	movabs $0x801959,%rax
+  8033c0:	00 00 00 
+  8033c3:	ff d0                	call   *%rax
+  8033c5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8033c7:	85 c0                	test   %eax,%eax
+  8033c9:	78 06                	js     8033d1 <getchar+0x2e>
+  8033cb:	74 08                	je     8033d5 <getchar+0x32>
+  8033cd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8033d1:	89 d0                	mov    %edx,%eax
+  8033d3:	c9                   	leave
+  8033d4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8033d5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8033da:	eb f5                	jmp    8033d1 <getchar+0x2e>
+
+00000000008033dc <iscons>:
+iscons(int fdnum) {
+  8033dc:	55                   	push   %rbp
+  8033dd:	48 89 e5             	mov    %rsp,%rbp
+  8033e0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033e8:	48 b8 76 16 80 00 00 	movabs $0x801676,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033f4:	85 c0                	test   %eax,%eax
+  8033f6:	78 18                	js     803410 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8033f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033fc:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  803403:	00 00 00 
+  803406:	8b 00                	mov    (%rax),%eax
+  803408:	39 02                	cmp    %eax,(%rdx)
+  80340a:	0f 94 c0             	sete   %al
+  80340d:	0f b6 c0             	movzbl %al,%eax
+}
+  803410:	c9                   	leave
+  803411:	c3                   	ret
+
+0000000000803412 <opencons>:
+opencons(void) {
+  803412:	55                   	push   %rbp
+  803413:	48 89 e5             	mov    %rsp,%rbp
+  803416:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80341a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80341e:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  803425:	00 00 00 
+  803428:	ff d0                	call   *%rax
+  80342a:	85 c0                	test   %eax,%eax
+  80342c:	78 49                	js     803477 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80342e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803433:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803438:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80343c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803441:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803448:	00 00 00 
+  80344b:	ff d0                	call   *%rax
+  80344d:	85 c0                	test   %eax,%eax
+  80344f:	78 26                	js     803477 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803451:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803455:	a1 60 41 80 00 00 00 	movabs 0x804160,%eax
+  80345c:	00 00 
+  80345e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803460:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803464:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80346b:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  803472:	00 00 00 
+  803475:	ff d0                	call   *%rax
+}
+  803477:	c9                   	leave
+  803478:	c3                   	ret
+
+0000000000803479 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803479:	55                   	push   %rbp
+  80347a:	48 89 e5             	mov    %rsp,%rbp
+  80347d:	41 56                	push   %r14
+  80347f:	41 55                	push   %r13
+  803481:	41 54                	push   %r12
+  803483:	53                   	push   %rbx
+  803484:	48 83 ec 50          	sub    $0x50,%rsp
+  803488:	49 89 fc             	mov    %rdi,%r12
+  80348b:	41 89 f5             	mov    %esi,%r13d
+  80348e:	48 89 d3             	mov    %rdx,%rbx
+  803491:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803495:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803499:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80349d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8034a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8034ac:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8034b0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034b4:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8034bb:	00 00 00 
+  8034be:	4c 8b 30             	mov    (%rax),%r14
+  8034c1:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  8034c8:	00 00 00 
+  8034cb:	ff d0                	call   *%rax
+  8034cd:	89 c6                	mov    %eax,%esi
+  8034cf:	45 89 e8             	mov    %r13d,%r8d
+  8034d2:	4c 89 e1             	mov    %r12,%rcx
+  8034d5:	4c 89 f2             	mov    %r14,%rdx
+  8034d8:	48 bf 40 3e 80 00 00 	movabs $0x803e40,%rdi
+  8034df:	00 00 00 
+  8034e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e7:	49 bc 67 02 80 00 00 	movabs $0x800267,%r12
+  8034ee:	00 00 00 
+  8034f1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8034f4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8034f8:	48 89 df             	mov    %rbx,%rdi
+  8034fb:	48 b8 03 02 80 00 00 	movabs $0x800203,%rax
+  803502:	00 00 00 
+  803505:	ff d0                	call   *%rax
+    cprintf("\n");
+  803507:	48 bf 93 3d 80 00 00 	movabs $0x803d93,%rdi
+  80350e:	00 00 00 
+  803511:	b8 00 00 00 00       	mov    $0x0,%eax
+  803516:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803519:	cc                   	int3
+  80351a:	eb fd                	jmp    803519 <_panic+0xa0>
+
+000000000080351c <ipc_recv_timed>:
+}
+
+/* Same as ipc_recv, but give up with -E_TIMEOUT when the gettime()
+ * clock reaches 'deadline', unless it is 0 */
+int32_t
+ipc_recv_timed(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, int deadline) {
+  80351c:	55                   	push   %rbp
+  80351d:	48 89 e5             	mov    %rsp,%rbp
+  803520:	41 55                	push   %r13
+  803522:	41 54                	push   %r12
+  803524:	53                   	push   %rbx
+  803525:	48 83 ec 08          	sub    $0x8,%rsp
+  803529:	49 89 fc             	mov    %rdi,%r12
+  80352c:	48 89 f7             	mov    %rsi,%rdi
+  80352f:	48 89 d3             	mov    %rdx,%rbx
+  803532:	49 89 cd             	mov    %rcx,%r13
+  803535:	44 89 c2             	mov    %r8d,%edx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803538:	48 85 f6             	test   %rsi,%rsi
+  80353b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803542:	00 00 00 
+  803545:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_timed(pg, size ? *size : PAGE_SIZE, deadline);
+  803549:	be 00 10 00 00       	mov    $0x1000,%esi
+  80354e:	48 85 db             	test   %rbx,%rbx
+  803551:	74 03                	je     803556 <ipc_recv_timed+0x3a>
+  803553:	48 8b 33             	mov    (%rbx),%rsi
+  803556:	48 b8 b2 14 80 00 00 	movabs $0x8014b2,%rax
+  80355d:	00 00 00 
+  803560:	ff d0                	call   *%rax
+    if (res < 0) {
+  803562:	85 c0                	test   %eax,%eax
+  803564:	78 75                	js     8035db <ipc_recv_timed+0xbf>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  803566:	4d 85 e4             	test   %r12,%r12
+  803569:	74 14                	je     80357f <ipc_recv_timed+0x63>
+            *from_env_store = thisenv->env_ipc_from;
+  80356b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803572:	00 00 00 
+  803575:	8b 80 24 01 00 00    	mov    0x124(%rax),%eax
+  80357b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (perm_store != NULL) {
+  80357f:	4d 85 ed             	test   %r13,%r13
+  803582:	74 14                	je     803598 <ipc_recv_timed+0x7c>
+            *perm_store = thisenv->env_ipc_perm;
+  803584:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80358b:	00 00 00 
+  80358e:	8b 80 28 01 00 00    	mov    0x128(%rax),%eax
+  803594:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size != NULL) {
+  803598:	48 85 db             	test   %rbx,%rbx
+  80359b:	74 23                	je     8035c0 <ipc_recv_timed+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80359d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035a4:	00 00 00 
+  8035a7:	8b 88 28 01 00 00    	mov    0x128(%rax),%ecx
+  8035ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b2:	85 c9                	test   %ecx,%ecx
+  8035b4:	74 07                	je     8035bd <ipc_recv_timed+0xa1>
+  8035b6:	48 8b 90 18 01 00 00 	mov    0x118(%rax),%rdx
+  8035bd:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8035c0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035c7:	00 00 00 
+  8035ca:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+    }
+    return -1;
+}
+  8035d0:	48 83 c4 08          	add    $0x8,%rsp
+  8035d4:	5b                   	pop    %rbx
+  8035d5:	41 5c                	pop    %r12
+  8035d7:	41 5d                	pop    %r13
+  8035d9:	5d                   	pop    %rbp
+  8035da:	c3                   	ret
+        if (from_env_store != NULL) {
+  8035db:	4d 85 e4             	test   %r12,%r12
+  8035de:	74 08                	je     8035e8 <ipc_recv_timed+0xcc>
+            *from_env_store = 0;
+  8035e0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8035e7:	00 
+        if (perm_store != NULL) {
+  8035e8:	4d 85 ed             	test   %r13,%r13
+  8035eb:	74 08                	je     8035f5 <ipc_recv_timed+0xd9>
+            *perm_store = 0;
+  8035ed:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8035f4:	00 
+        if (size != NULL) {
+  8035f5:	48 85 db             	test   %rbx,%rbx
+  8035f8:	74 d6                	je     8035d0 <ipc_recv_timed+0xb4>
+            *size = 0;
+  8035fa:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803601:	eb cd                	jmp    8035d0 <ipc_recv_timed+0xb4>
+
+0000000000803603 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803603:	55                   	push   %rbp
+  803604:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timed(from_env_store, pg, size, perm_store, 0);
+  803607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80360d:	48 b8 1c 35 80 00 00 	movabs $0x80351c,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+}
+  803619:	5d                   	pop    %rbp
+  80361a:	c3                   	ret
+
+000000000080361b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	41 57                	push   %r15
+  803621:	41 56                	push   %r14
+  803623:	41 55                	push   %r13
+  803625:	41 54                	push   %r12
+  803627:	53                   	push   %rbx
+  803628:	48 83 ec 18          	sub    $0x18,%rsp
+  80362c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80362f:	48 89 d3             	mov    %rdx,%rbx
+  803632:	49 89 cc             	mov    %rcx,%r12
+  803635:	45 89 c5             	mov    %r8d,%r13d
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803638:	48 85 d2             	test   %rdx,%rdx
+  80363b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803642:	00 00 00 
+  803645:	48 0f 44 d8          	cmove  %rax,%rbx
+    }
+    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803649:	89 f0                	mov    %esi,%eax
+  80364b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80364f:	48 89 da             	mov    %rbx,%rdx
+  803652:	48 89 c6             	mov    %rax,%rsi
+  803655:	48 b8 86 14 80 00 00 	movabs $0x801486,%rax
+  80365c:	00 00 00 
+  80365f:	ff d0                	call   *%rax
+    while (res < 0) {
+  803661:	85 c0                	test   %eax,%eax
+  803663:	79 65                	jns    8036ca <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803665:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803668:	75 33                	jne    80369d <ipc_send+0x82>
+            panic("ipc_send error: %i\n", res);
+        }
+        sys_yield();
+  80366a:	49 bf 89 11 80 00 00 	movabs $0x801189,%r15
+  803671:	00 00 00 
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803674:	49 be 86 14 80 00 00 	movabs $0x801486,%r14
+  80367b:	00 00 00 
+        sys_yield();
+  80367e:	41 ff d7             	call   *%r15
+        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803681:	45 89 e8             	mov    %r13d,%r8d
+  803684:	4c 89 e1             	mov    %r12,%rcx
+  803687:	48 89 da             	mov    %rbx,%rdx
+  80368a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80368e:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803691:	41 ff d6             	call   *%r14
+    while (res < 0) {
+  803694:	85 c0                	test   %eax,%eax
+  803696:	79 32                	jns    8036ca <ipc_send+0xaf>
+        if (res < 0 && res != -E_IPC_NOT_RECV) {
+  803698:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80369b:	74 e1                	je     80367e <ipc_send+0x63>
+            panic("ipc_send error: %i\n", res);
+  80369d:	89 c1                	mov    %eax,%ecx
+  80369f:	48 ba 63 3e 80 00 00 	movabs $0x803e63,%rdx
+  8036a6:	00 00 00 
+  8036a9:	be 52 00 00 00       	mov    $0x52,%esi
+  8036ae:	48 bf 77 3e 80 00 00 	movabs $0x803e77,%rdi
+  8036b5:	00 00 00 
+  8036b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036bd:	49 b8 79 34 80 00 00 	movabs $0x803479,%r8
+  8036c4:	00 00 00 
+  8036c7:	41 ff d0             	call   *%r8
+    }
+}
+  8036ca:	48 83 c4 18          	add    $0x18,%rsp
+  8036ce:	5b                   	pop    %rbx
+  8036cf:	41 5c                	pop    %r12
+  8036d1:	41 5d                	pop    %r13
+  8036d3:	41 5e                	pop    %r14
+  8036d5:	41 5f                	pop    %r15
+  8036d7:	5d                   	pop    %rbp
+  8036d8:	c3                   	ret
+
+00000000008036d9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036de:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036e5:	00 00 00 
+  8036e8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8036ec:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8036f0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036f4:	48 01 ca             	add    %rcx,%rdx
+  8036f7:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8036fd:	39 fa                	cmp    %edi,%edx
+  8036ff:	74 12                	je     803713 <ipc_find_env+0x3a>
+    for (size_t i = 0; i < NENV; i++)
+  803701:	48 83 c0 01          	add    $0x1,%rax
+  803705:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80370b:	75 db                	jne    8036e8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80370d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803712:	c3                   	ret
+            return envs[i].env_id;
+  803713:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  803717:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80371b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80371f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  803726:	00 00 00 
+  803729:	48 01 d0             	add    %rdx,%rax
+  80372c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803732:	c3                   	ret
+  803733:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803738 <__rodata_start>:
+  803738:	48                   	rex.W
+  803739:	65 6c                	gs insb (%dx),%es:(%rdi)
+  80373b:	6c                   	insb   (%dx),%es:(%rdi)
+  80373c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373d:	2c 20                	sub    $0x20,%al
+  80373f:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  803743:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803746:	76 69                	jbe    8037b1 <__rodata_start+0x79>
+  803748:	72 6f                	jb     8037b9 <__rodata_start+0x81>
+  80374a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80374b:	6d                   	insl   (%dx),%es:(%rdi)
+  80374c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80374e:	74 20                	je     803770 <__rodata_start+0x38>
+  803750:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  803755:	0a 00                	or     (%rax),%al
+  803757:	00 42 61             	add    %al,0x61(%rdx)
+  80375a:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80375d:	69 6e 20 65 6e 76 69 	imul   $0x69766e65,0x20(%rsi),%ebp
+  803764:	72 6f                	jb     8037d5 <__rodata_start+0x9d>
+  803766:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803767:	6d                   	insl   (%dx),%es:(%rdi)
+  803768:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80376a:	74 20                	je     80378c <__rodata_start+0x54>
+  80376c:	25 30 38 78 2c       	and    $0x2c783830,%eax
+  803771:	20 69 74             	and    %ch,0x74(%rcx)
+  803774:	65 72 61             	gs jb  8037d8 <__rodata_start+0xa0>
+  803777:	74 69                	je     8037e2 <__rodata_start+0xaa>
+  803779:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80377a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80377b:	20 25 64 2e 0a 00    	and    %ah,0xa2e64(%rip)        # 8a65e5 <__bss_end+0x9e5e5>
+  803781:	00 00                	add    %al,(%rax)
+  803783:	00 00                	add    %al,(%rax)
+  803785:	00 00                	add    %al,(%rax)
+  803787:	00 41 6c             	add    %al,0x6c(%rcx)
+  80378a:	6c                   	insb   (%dx),%es:(%rdi)
+  80378b:	20 64 6f 6e          	and    %ah,0x6e(%rdi,%rbp,2)
+  80378f:	65 20 69 6e          	and    %ch,%gs:0x6e(%rcx)
+  803793:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803796:	76 69                	jbe    803801 <__rodata_start+0xc9>
+  803798:	72 6f                	jb     803809 <__rodata_start+0xd1>
+  80379a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379b:	6d                   	insl   (%dx),%es:(%rdi)
+  80379c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80379e:	74 20                	je     8037c0 <__rodata_start+0x88>
+  8037a0:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  8037a5:	0a 00                	or     (%rax),%al
+  8037a7:	3c 75                	cmp    $0x75,%al
+  8037a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037aa:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8037ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037af:	3e 00 30             	ds add %dh,(%rax)
+  8037b2:	31 32                	xor    %esi,(%rdx)
+  8037b4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8037bb:	41                   	rex.B
+  8037bc:	42                   	rex.X
+  8037bd:	43                   	rex.XB
+  8037be:	44                   	rex.R
+  8037bf:	45                   	rex.RB
+  8037c0:	46 00 30             	rex.RX add %r14b,(%rax)
+  8037c3:	31 32                	xor    %esi,(%rdx)
+  8037c5:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8037cc:	61                   	(bad)
+  8037cd:	62 63 64 65 66       	(bad)
+  8037d2:	00 28                	add    %ch,(%rax)
+  8037d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037d5:	75 6c                	jne    803843 <__rodata_start+0x10b>
+  8037d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8037d8:	29 00                	sub    %eax,(%rax)
+  8037da:	65 72 72             	gs jb  80384f <__rodata_start+0x117>
+  8037dd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037de:	72 20                	jb     803800 <__rodata_start+0xc8>
+  8037e0:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8037e5:	73 70                	jae    803857 <__rodata_start+0x11f>
+  8037e7:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8037eb:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8037f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f3:	72 00                	jb     8037f5 <__rodata_start+0xbd>
+  8037f5:	62 61 64 20 65       	(bad)
+  8037fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037fb:	76 69                	jbe    803866 <__rodata_start+0x12e>
+  8037fd:	72 6f                	jb     80386e <__rodata_start+0x136>
+  8037ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803800:	6d                   	insl   (%dx),%es:(%rdi)
+  803801:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803803:	74 00                	je     803805 <__rodata_start+0xcd>
+  803805:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80380c:	20 70 61             	and    %dh,0x61(%rax)
+  80380f:	72 61                	jb     803872 <__rodata_start+0x13a>
+  803811:	6d                   	insl   (%dx),%es:(%rdi)
+  803812:	65 74 65             	gs je  80387a <__rodata_start+0x142>
+  803815:	72 00                	jb     803817 <__rodata_start+0xdf>
+  803817:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803818:	75 74                	jne    80388e <__rodata_start+0x156>
+  80381a:	20 6f 66             	and    %ch,0x66(%rdi)
+  80381d:	20 6d 65             	and    %ch,0x65(%rbp)
+  803820:	6d                   	insl   (%dx),%es:(%rdi)
+  803821:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803822:	72 79                	jb     80389d <__rodata_start+0x165>
+  803824:	00 6f 75             	add    %ch,0x75(%rdi)
+  803827:	74 20                	je     803849 <__rodata_start+0x111>
+  803829:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80382a:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80382e:	76 69                	jbe    803899 <__rodata_start+0x161>
+  803830:	72 6f                	jb     8038a1 <__rodata_start+0x169>
+  803832:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803833:	6d                   	insl   (%dx),%es:(%rdi)
+  803834:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803836:	74 73                	je     8038ab <__rodata_start+0x173>
+  803838:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80383b:	72 72                	jb     8038af <__rodata_start+0x177>
+  80383d:	75 70                	jne    8038af <__rodata_start+0x177>
+  80383f:	74 65                	je     8038a6 <__rodata_start+0x16e>
+  803841:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803846:	75 67                	jne    8038af <__rodata_start+0x177>
+  803848:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80384b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80384d:	00 73 65             	add    %dh,0x65(%rbx)
+  803850:	67 6d                	insl   (%dx),%es:(%edi)
+  803852:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803854:	74 61                	je     8038b7 <__rodata_start+0x17f>
+  803856:	74 69                	je     8038c1 <__rodata_start+0x189>
+  803858:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803859:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80385a:	20 66 61             	and    %ah,0x61(%rsi)
+  80385d:	75 6c                	jne    8038cb <__rodata_start+0x193>
+  80385f:	74 00                	je     803861 <__rodata_start+0x129>
+  803861:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803868:	20 45 4c             	and    %al,0x4c(%rbp)
+  80386b:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80386f:	61                   	(bad)
+  803870:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803875:	20 73 75             	and    %dh,0x75(%rbx)
+  803878:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80387b:	73 79                	jae    8038f6 <__rodata_start+0x1be>
+  80387d:	73 74                	jae    8038f3 <__rodata_start+0x1bb>
+  80387f:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803881:	20 63 61             	and    %ah,0x61(%rbx)
+  803884:	6c                   	insb   (%dx),%es:(%rdi)
+  803885:	6c                   	insb   (%dx),%es:(%rdi)
+  803886:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803889:	74 72                	je     8038fd <__rodata_start+0x1c5>
+  80388b:	79 20                	jns    8038ad <__rodata_start+0x175>
+  80388d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80388e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80388f:	74 20                	je     8038b1 <__rodata_start+0x179>
+  803891:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803893:	75 6e                	jne    803903 <__rodata_start+0x1cb>
+  803895:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803899:	76 20                	jbe    8038bb <__rodata_start+0x183>
+  80389b:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8038a2:	72 65                	jb     803909 <__rodata_start+0x1d1>
+  8038a4:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8038a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038a8:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8038ac:	65 78 70             	gs js  80391f <__rodata_start+0x1e7>
+  8038af:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8038b4:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8038b7:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8038bb:	20 66 69             	and    %ah,0x69(%rsi)
+  8038be:	6c                   	insb   (%dx),%es:(%rdi)
+  8038bf:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8038c3:	20 66 72             	and    %ah,0x72(%rsi)
+  8038c6:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8038cb:	61                   	(bad)
+  8038cc:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8038cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d1:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8038d5:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8038d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038da:	20 6d 61             	and    %ch,0x61(%rbp)
+  8038dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038de:	79 20                	jns    803900 <__rodata_start+0x1c8>
+  8038e0:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8038e7:	72 65                	jb     80394e <__rodata_start+0x216>
+  8038e9:	20 6f 70             	and    %ch,0x70(%rdi)
+  8038ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038ee:	00 66 69             	add    %ah,0x69(%rsi)
+  8038f1:	6c                   	insb   (%dx),%es:(%rdi)
+  8038f2:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8038f6:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8038f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fa:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8038fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038fe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ff:	74 20                	je     803921 <__rodata_start+0x1e9>
+  803901:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803903:	75 6e                	jne    803973 <__rodata_start+0x23b>
+  803905:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803909:	76 61                	jbe    80396c <__rodata_start+0x234>
+  80390b:	6c                   	insb   (%dx),%es:(%rdi)
+  80390c:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803913:	00 
+  803914:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80391b:	72 65                	jb     803982 <__rodata_start+0x24a>
+  80391d:	61                   	(bad)
+  80391e:	64 79 20             	fs jns 803941 <__rodata_start+0x209>
+  803921:	65 78 69             	gs js  80398d <__rodata_start+0x255>
+  803924:	73 74                	jae    80399a <__rodata_start+0x262>
+  803926:	73 00                	jae    803928 <__rodata_start+0x1f0>
+  803928:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803929:	70 65                	jo     803990 <__rodata_start+0x258>
+  80392b:	72 61                	jb     80398e <__rodata_start+0x256>
+  80392d:	74 69                	je     803998 <__rodata_start+0x260>
+  80392f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803930:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803931:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803934:	74 20                	je     803956 <__rodata_start+0x21e>
+  803936:	73 75                	jae    8039ad <__rodata_start+0x275>
+  803938:	70 70                	jo     8039aa <__rodata_start+0x272>
+  80393a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393b:	72 74                	jb     8039b1 <__rodata_start+0x279>
+  80393d:	65 64 00 74 69 6d    	gs add %dh,%fs:0x6d(%rcx,%rbp,2)
+  803943:	65 64 20 6f 75       	gs and %ch,%fs:0x75(%rdi)
+  803948:	74 00                	je     80394a <__rodata_start+0x212>
+  80394a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803951:	00 00 00 
+  803954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80395b:	00 00 00 
+  80395e:	66 90                	xchg   %ax,%ax
+  803960:	54                   	push   %rsp
+  803961:	04 80                	add    $0x80,%al
+  803963:	00 00                	add    %al,(%rax)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 85 0a 80 00 00    	add    %al,0x800a(%rbp)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 73 04             	add    %dh,0x4(%rbx)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 67 04             	add    %ah,0x4(%rdi)
+  8039b2:	80 00 00             	addb   $0x0,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 e1                	add    %ah,%cl
+  8039b9:	04 80                	add    $0x80,%al
+  8039bb:	00 00                	add    %al,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 67 04             	add    %ah,0x4(%rdi)
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 b8 09 80 00 00    	add    %bh,0x8009(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 04 05 80 00 00 00 	add    %al,0x80(,%rax,1)
+  803b66:	00 00                	add    %al,(%rax)
+  803b68:	d3 06                	roll   %cl,(%rsi)
+  803b6a:	80 00 00             	addb   $0x0,(%rax)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 33                	add    %dh,(%rbx)
+  803b91:	05 80 00 00 00       	add    $0x80,%eax
+  803b96:	00 00                	add    %al,(%rax)
+  803b98:	95                   	xchg   %eax,%ebp
+  803b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b9f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 f9                	add    %bh,%cl
+  803ba9:	04 80                	add    $0x80,%al
+  803bab:	00 00                	add    %al,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 7b 08             	add    %bh,0x8(%rbx)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 45 09             	add    %al,0x9(%rbp)
+  803bca:	80 00 00             	addb   $0x0,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 ca                	add    %cl,%dl
+  803be1:	05 80 00 00 00       	add    $0x80,%eax
+  803be6:	00 00                	add    %al,(%rax)
+  803be8:	95                   	xchg   %eax,%ebp
+  803be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bef:	00 a7 07 80 00 00    	add    %ah,0x8007(%rdi)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 b8 09 80 00 00    	add    %bh,0x8009(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 5d 04             	add    %bl,0x4(%rbp)
+  803c1a:	80 00 00             	addb   $0x0,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803c20 <error_string>:
+	...
+  803c28:	e3 37 80 00 00 00 00 00 f5 37 80 00 00 00 00 00     .7.......7......
+  803c38:	05 38 80 00 00 00 00 00 17 38 80 00 00 00 00 00     .8.......8......
+  803c48:	25 38 80 00 00 00 00 00 39 38 80 00 00 00 00 00     %8......98......
+  803c58:	4e 38 80 00 00 00 00 00 61 38 80 00 00 00 00 00     N8......a8......
+  803c68:	73 38 80 00 00 00 00 00 87 38 80 00 00 00 00 00     s8.......8......
+  803c78:	97 38 80 00 00 00 00 00 aa 38 80 00 00 00 00 00     .8.......8......
+  803c88:	c1 38 80 00 00 00 00 00 d7 38 80 00 00 00 00 00     .8.......8......
+  803c98:	ef 38 80 00 00 00 00 00 07 39 80 00 00 00 00 00     .8.......9......
+  803ca8:	14 39 80 00 00 00 00 00 c8 3c 80 00 00 00 00 00     .9.......<......
+  803cb8:	28 39 80 00 00 00 00 00 40 39 80 00 00 00 00 00     (9......@9......
+  803cc8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  803cd8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  803ce8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  803cf8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  803d08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  803d18:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803d28:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803d38:	5b 25 30 38 78 5d 20 72 65 61 64 6d 61 70 20 25     [%08x] readmap %
+  803d48:	64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 00     d -- bad mode...
+  803d58:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803d68:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803d78:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803d88:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803d98:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803da8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803db8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803dc0 <devtab>:
+  803dc0:	20 40 80 00 00 00 00 00 c0 40 80 00 00 00 00 00      @.......@......
+  803dd0:	60 41 80 00 00 00 00 00 00 00 00 00 00 00 00 00     `A..............
+  803de0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803df0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803e00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803e10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803e20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803e30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803e40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803e50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803e60:	3a 20 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     : .ipc_send erro
+  803e70:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
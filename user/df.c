@@ -26,6 +26,29 @@ print_busy() {
     }
 }
 
+static struct Df_snapshot snapshots[DF_SNAPSHOTS];
+
+void
+print_snapshots() {
+    for (int start = 0;;) {
+        int res = snapshots_space(start, snapshots);
+
+        if (res < 0) {
+            cprintf("[Errorr] Snapshot space cannot be counted: %i\n", res);
+            return;
+        } else if (res == 0) {
+            return;
+        }
+
+        for (int i = 0; i < res; ++i) {
+            cprintf("%s%s: exclusive %d bytes, shared %d bytes\n", snapshots[i].ds_name,
+                    snapshots[i].ds_deleted ? " (deleted)" : "", snapshots[i].ds_exclusive, snapshots[i].ds_shared);
+        }
+
+        start += res;
+    }
+}
+
 void
 umain(int argc, char **argv) {
 
@@ -44,6 +67,8 @@ umain(int argc, char **argv) {
         print_free();
     } else if (arg == 'b') {
         print_busy();
+    } else if (arg == 's') {
+        print_snapshots();
     } else {
         cprintf("Incorrect flag for df:'%c'\n", arg);
     }
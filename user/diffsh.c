@@ -0,0 +1,41 @@
+#include <inc/lib.h>
+
+static struct Sh_diff_record records[SH_DIFF_RECORDS];
+
+void
+umain(int argc, char **argv) {
+
+    if (argc != 3) {
+        cprintf("Usage: diffsh <from snapshot> <to snapshot>\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    struct Sh_diff_cursor cursor;
+    memset(&cursor, 0, sizeof(cursor));
+
+    while (!cursor.dc_done) {
+        int res = diff_snapshots(argv[1], argv[2], &cursor, records);
+
+        if (res < 0) {
+            cprintf("Snapshots cannot be compared: %i\n", res);
+            return;
+        }
+
+        for (int i = 0; i < res; ++i) {
+            struct Sh_diff_record *record = &records[i];
+
+            if (record->dr_type == SH_DIFF_CREATED) {
+                cprintf("+ %s\n", record->dr_name);
+            } else if (record->dr_type == SH_DIFF_REMOVED) {
+                cprintf("- %s\n", record->dr_name);
+            } else {
+                cprintf("M %s blocks [%u, %u) size %d\n", record->dr_name, record->dr_start, record->dr_end, record->dr_size);
+            }
+        }
+    }
+
+    return;
+}
@@ -0,0 +1,23 @@
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+
+    if (argc > 1) {
+        cprintf("Too much arguments for snapshot garbage collection\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    int res = gc_snapshots();
+
+    if (res < 0) {
+        cprintf("Snapshot garbage collection failed: %i\n", res);
+    } else {
+        cprintf("reclaimed %d bytes on disk\n", res);
+    }
+
+    return;
+}
@@ -0,0 +1,21 @@
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+
+    if (argc != 2) {
+        cprintf("Usage: recvsh <stream file>\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    int res = receive_snapshot(argv[1]);
+
+    if (res < 0) {
+        cprintf("Snapshot cannot be received: %i\n", res);
+    }
+
+    return;
+}
@@ -0,0 +1,23 @@
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+
+    if (argc != 4) {
+        cprintf("Usage: sendsh <parent snapshot> <snapshot> <stream file>\n");
+        for(int i = 0; i < argc; ++i) {
+            cprintf("       arg position %d argument:%s\n",i, argv[i]);
+        }
+        return;
+    }
+
+    int res = send_snapshot(argv[1], argv[2], argv[3]);
+
+    if (res < 0) {
+        cprintf("Snapshot cannot be sent: %i\n", res);
+    } else {
+        cprintf("sent %d bytes to %s\n", res, argv[3]);
+    }
+
+    return;
+}
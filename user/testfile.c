@@ -3,6 +3,7 @@
 const char *msg = "This is the NEW message of the day!\n\n";
 
 #define FVA ((struct Fd *)0xA000000)
+#define MAPVA ((char *)0xB000000)
 
 static int
 xopen(const char *path, int mode) {
@@ -18,6 +19,32 @@ xopen(const char *path, int mode) {
     return ipc_recv(NULL, FVA, &sz, NULL);
 }
 
+/* One FSREQ_READ_BULK request, received at MAPVA */
+static int
+xreadbulk(struct Fd *fd, size_t *size, int *perm) {
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+    fsipcbuf.read.req_n = *size;
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+    ipc_send(fsenv, FSREQ_READ_BULK, &fsipcbuf, PAGE_SIZE, PROT_RW);
+    return ipc_recv(NULL, MAPVA, size, perm);
+}
+
+static void
+check_big(const char *what, const char *data, size_t len) {
+    for (size_t i = 0; i < len; i += 512) {
+        if (*(int *)(data + i) != i)
+            panic("%s /big from %ld returned bad data %d", what, (long)i, *(int *)(data + i));
+    }
+    for (size_t i = 0; i < len; i += PAGE_SIZE) {
+        if (get_prot((void *)(data + i)) & PROT_W)
+            panic("%s /big mapped a writable page at %ld", what, (long)i);
+    }
+}
+
 void
 umain(int argc, char **argv) {
     int64_t r, f;
@@ -123,4 +150,32 @@ umain(int argc, char **argv) {
     }
     close(f);
     cprintf("large file is good\n");
+
+    /* All of /big comes back read-only from a single request */
+    size_t bigsize = (NDIRECT * 3) * BLKSIZE;
+    size_t size = FSREQ_BULK_MAX;
+    int perm;
+    if ((f = open("/big", O_RDONLY)) < 0)
+        panic("open /big: %ld", (long)f);
+    fd = (struct Fd *)(0xD0000000 + f * PAGE_SIZE);
+    if ((r = xreadbulk(fd, &size, &perm)) != bigsize || size != bigsize)
+        panic("bulk read /big returned %ld bytes in a %ld byte region", (long)r, (long)size);
+    if (perm != (PROT_R | PROT_LAZY))
+        panic("bulk read /big sent permissions %x", perm);
+    check_big("bulk read", MAPVA, bigsize);
+    close(f);
+    sys_unmap_region(0, MAPVA, bigsize);
+    cprintf("bulk read is good\n");
+
+    /* readmap() maps the same blocks over the pages it is given */
+    if ((r = sys_alloc_region(0, MAPVA, bigsize, PROT_RW)) < 0)
+        panic("sys_alloc_region: %ld", (long)r);
+    if ((f = open("/big", O_RDONLY)) < 0)
+        panic("open /big: %ld", (long)f);
+    if ((r = readmap(f, MAPVA, bigsize)) != bigsize)
+        panic("readmap /big: %ld", (long)r);
+    check_big("readmap", MAPVA, bigsize);
+    close(f);
+    sys_unmap_region(0, MAPVA, bigsize);
+    cprintf("readmap is good\n");
 }